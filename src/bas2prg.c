@@ -19,188 +19,253 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-#include <ctype.h>
 #ifdef _WIN32
 # include <io.h>
 # include <fcntl.h>
 #endif
 #include <getopt.h>
 #include "tokens.h"
+#include "prgtools.h"
+#include "batch.h"
+#include "server.h"
 #include "version.h"
 
 
-#define MAXLINELEN	1024
-#define TOKEN_REM	0x8f
-
-
-#ifdef _DEBUG
-	debug = 0;		// debug level
-#endif
-int	invertcase,		// rough ASCII to PETSCII conversion
-	autonumber,		// add line numbers if no line number found
-	startaddr,		// load address
-	trimspaces,		// remove spaces from beginning/end of line
-	collapsespaces;		// remove free spaces inside line
-
-
-/*
- * find a token in *src and increment *src past the token if one is found
- * return -1 if no token is found
- */
-static int
-gettoken(const char **src)
-{
-    const char **tp;
-    int len;
-    int t;
-	
-    for (tp = tokens; tp < &tokens[128]; ++tp) {
-	len = strlen(*tp);
-	if (! strncmp(*tp, *src, len)) {
-#ifdef _DEBUG
-		if (debug)
-			fprintf(stderr, "found token: %s\n", *tp);
-#endif
-		t = tp-tokens + 128;
-		*src += len;
-		return t;
-	}
-    }
-
-    return -1;
-}
-
-
+/* bas2prg_buf() for files that come as bytes, from a tar stream */
 static int
-tokenize(unsigned char *dest, const char *src)
+bas2prg_bytes(const unsigned char *in, long len, outbuf_t *out,
+	      const prgopts_t *opts, diag_t *diag)
 {
-    const char *sp;
-    unsigned char *dp;
-    int quoted = 0;
-    int rem = 0;
-    int token;
-	
-    for (sp = src, dp = dest; *sp;) {
-	if (collapsespaces && !(rem || quoted)) {
-		while (*sp && isspace(*sp))
-			++sp;
-	}
-
-	if (*sp == '"')
-		quoted = !quoted;
-	
-	if (!rem && !quoted) {
-		token = gettoken(&sp);
-		if (token != -1) {
-			if (token == TOKEN_REM)
-				rem = 1;
-			*dp++ = (unsigned char)token;
-			continue;
-		}
-	}
-
-#ifdef _DEBUG
-	if (debug)
-		fprintf(stderr, "copying character: '%c' (0x%02x)%s%s\n",
-			*sp, *sp, rem?" (rem)":"", quoted?" (quoted)":"");
-#endif
-
-	if (*src != '\r')
-		*dp++ = (unsigned char)*sp++;
-    }
-
-    if (dp == dest) {
-	/* C64 BASIC has a problem with zero-length lines */
-	*dp++ = ' ';
-    }
-
-    *dp++ = 0;
-#ifdef _DEBUG
-	if (debug)
-		fprintf(stderr, "\n");
-#endif
-
-    return dp - dest;
+    return bas2prg_buf((const char *)in, len, out, opts, diag);
 }
 
 
-static void
-putword(long n, unsigned char **p)
-{
-    *(*p)++ = n & 255;
-    *(*p)++ = n >> 8;
-}
+static const convdesc_t bas2prg_desc = {
+    ".bas", ".prg", "r", "wb", bas2prg_file, NULL, bas2prg_bytes
+};
 
 
 int
 main(int argc, char **argv)
 {
-    unsigned char tokline[MAXLINELEN];	// tokenized line
-    unsigned char *tp;			// pointer in tokenized line
-    char line[MAXLINELEN];		// source line
-    char *cp;
-    long linenum;
-    int lastlinenum = -1;
-    int toklinelen;
-    int c;
-    FILE *fi, *fo;
+    prgopts_t opts;
+    prgmetrics_t metrics;
+    batchopts_t bo;
+    diag_t diag;
+    int c, ret;
+    int nthreads, setaddr = 0, quiet = 0, tar = 0;
+    long lines, hits;
+    FILE *fi, *fo, *fm = NULL, *fp;
+    char *in_name;
     char *out_name;
+    char *out_dir;
+    char *server;
+    char *cache_name;
+    char *metrics_name;
+    char *prof_name;
+    runprof_t prof;
 
     /* Set defaults. */
-    autonumber = 0;
-    collapsespaces = 0;
-#ifdef _DEBUG
-    debug = 0;
-#endif
-    invertcase = 0;
-    startaddr = 0x0801;
-    trimspaces = 0;
+    prgopts_init(&opts);
+    nthreads = 0;
     out_name = NULL;
+    out_dir = NULL;
+    server = NULL;
+    cache_name = NULL;
+    metrics_name = NULL;
+    prof_name = NULL;
 
     /* Process commandline arguments. */
     opterr = 0;
-    while ((c = getopt(argc, argv, "acdio:s:t")) != EOF) switch (c) {
+    while ((c = getopt(argc, argv, "acC:dD:eij:kM:o:O:pqrR:s:tS:Tuxz")) != EOF) switch (c) {
 	case 'a':	// auto-number
-		autonumber ^= 1;
+		opts.autonumber ^= 1;
 		break;
 
 	case 'c':	// collapse-spaces
-		collapsespaces ^= 1;
+		opts.collapsespaces ^= 1;
+		break;
+
+	case 'C':	// line-cache-file
+		cache_name = optarg;
 		break;
 
 	case 'd':	// debug-level
 #ifdef _DEBUG
-		debug++;
+		opts.debug++;
 #else
 		fprintf(stderr, "Debugging not compiled in.\n");
 #endif
 		break;
 
+	case 'D':	// dialect
+		if ((opts.dialect = dialect_find(optarg)) < 0) {
+			fprintf(stderr, "Unknown dialect '%s', use 2, 4, 3.5, 7 or simons\n",
+				optarg);
+			exit(1);
+		}
+		break;
+
+	case 'e':	// escape-codes
+		opts.charset = CHARSET_ESCAPES;
+		break;
+
 	case 'i':	// invert-case
-		invertcase ^= 1;
+		opts.invertcase ^= 1;
+		break;
+
+	case 'j':	// batch-threads
+		nthreads = atoi(optarg);
+		break;
+
+	case 'k':	// keyword-abbreviations
+		opts.abbrevs ^= 1;
+		break;
+
+	case 'M':	// metrics-file
+		metrics_name = optarg;
 		break;
 
 	case 'o':	// output-file
 		out_name = optarg;
 		break;
 
+	case 'O':	// batch-output-directory
+		out_dir = optarg;
+		break;
+
+	case 'p':	// pack
+		opts.pack = 1;
+		break;
+
+	case 'q':	// quiet
+		quiet = 1;
+		break;
+
+	case 'S':	// server-socket
+		server = optarg;
+		break;
+
+	case 'T':	// tar-stream
+		tar = 1;
+		break;
+
+	case 'r':	// reorder
+		opts.reorder = 1;
+		break;
+
+	case 'R':	// reorder-profile
+		opts.reorder = 1;
+		prof_name = optarg;
+		break;
+
 	case 's':	// start-address
-		(void)sscanf(optarg, "0x%x", &startaddr);
-		(void)sscanf(optarg, "$%x", &startaddr);
-		(void)sscanf(optarg, "$%X", &startaddr);
+		setaddr = 1;
+		(void)sscanf(optarg, "0x%lx", &opts.startaddr);
+		(void)sscanf(optarg, "$%lx", &opts.startaddr);
+		(void)sscanf(optarg, "$%lX", &opts.startaddr);
 		break;
 
 	case 't':	// trim-spaces
-		trimspaces ^= 1;
+		opts.trimspaces ^= 1;
+		break;
+
+	case 'u':	// utf8-codes
+		opts.charset = CHARSET_UTF8;
+		break;
+
+	case 'x':	// optimize
+		opts.optimize = 1;
+		break;
+
+	case 'z':	// crunch
+		opts.crunch++;
 		break;
 
 	default:
 usage:
 		fprintf(stderr,
-			"Usage: bas2prg [-acdit] [-s addr] [-o outfile] filename\n");
+			"Usage: bas2prg [-acdeikpqrtuxz] [-D dialect] [-s addr] [-C cache] [-M metrics] [-R profile] [-o outfile] filename\n"
+			"       bas2prg [-acdeikpqrtuxz] [-D dialect] [-s addr] [-j threads] [-M metrics] [-O outdir] file|dir ...\n"
+			"       bas2prg [-acdeikpqrtuxz] [-D dialect] [-s addr] [-j threads] [-M metrics] -o image.d64 file|dir ...\n"
+			"       bas2prg -T [-acdeikpqrtuxz] [-D dialect] [-s addr] [-j threads] [-M metrics] [-o out.tar] [in.tar]\n"
+			"       bas2prg -S socket|- [-j threads]\n");
 		exit(1);
     }
 
+    tokens_init();
+    if (!setaddr)
+	opts.startaddr = dialect_load(opts.dialect);
+    opts.ramtop = dialect_top(opts.dialect);
+
+    /* Server mode: options come with each request. */
+    if (server != NULL) {
+	if (optind < argc || out_name != NULL || out_dir != NULL ||
+	    cache_name != NULL || metrics_name != NULL || prof_name != NULL)
+		goto usage;
+	return server_run(server, nthreads);
+    }
+
+    /* Metrics go to a file, or to stdout with "-". */
+    if (metrics_name != NULL) {
+	fm = strcmp(metrics_name, "-") ? fopen(metrics_name, "w") : stdout;
+	if (fm == NULL) {
+		fprintf(stderr, "Unable to create metrics '%s'\n", metrics_name);
+		return 2;
+	}
+    }
+
+    /* Tar mode: the members of a tar stream in, a tar stream out. */
+    if (tar) {
+	if (out_dir != NULL || cache_name != NULL || prof_name != NULL ||
+	    argc - optind > 1)
+		goto usage;
+	bo.outdir = NULL;
+	bo.nthreads = nthreads;
+	bo.quiet = quiet;
+	bo.metrics = fm;
+	ret = batch_tar(&bas2prg_desc, optind < argc ? argv[optind] : NULL, out_name,
+			&bo, &opts) ? 4 : 0;
+	if (fm != NULL && fm != stdout)
+		fclose(fm);
+	return ret;
+    }
+
+    /* An output file that is a disk image: every input goes on it. */
+    if (out_name != NULL && strlen(out_name) > 4 &&
+	(!strcmp(out_name + strlen(out_name) - 4, ".d64") ||
+	 !strcmp(out_name + strlen(out_name) - 4, ".D64"))) {
+	if (out_dir != NULL || cache_name != NULL || prof_name != NULL ||
+	    optind == argc)
+		goto usage;
+	bo.outdir = NULL;
+	bo.nthreads = nthreads;
+	bo.quiet = quiet;
+	bo.metrics = fm;
+	ret = batch_d64(&bas2prg_desc, &argv[optind], argc - optind,
+			out_name, &bo, &opts) ? 4 : 0;
+	if (fm != NULL && fm != stdout)
+		fclose(fm);
+	return ret;
+    }
+
+    /* Several inputs, a directory or an output directory: batch mode. */
+    if (out_dir != NULL || argc - optind > 1 ||
+	(optind < argc && batch_isdir(argv[optind]))) {
+	if (out_name != NULL || cache_name != NULL || prof_name != NULL ||
+	    optind == argc)
+		goto usage;
+	bo.outdir = out_dir;
+	bo.nthreads = nthreads;
+	bo.quiet = quiet;
+	bo.metrics = fm;
+	ret = batch_run(&bas2prg_desc, &argv[optind], argc - optind,
+			&bo, &opts) ? 4 : 0;
+	if (fm != NULL && fm != stdout)
+		fclose(fm);
+	return ret;
+    }
+
     /* If we have an output filename, open it. */
     if (out_name != NULL) {
 	fo = fopen(out_name, "wb");
@@ -217,7 +282,9 @@ usage:
     }
 
     /* If we have a filename, use it. */
+    in_name = "-";
     if (optind < argc) {
+	in_name = argv[optind];
 	fi = fopen(argv[optind], "r");
 	if (fi == NULL) {
 		fprintf(stderr, "Unable to open input '%s'\n", argv[optind]);
@@ -232,96 +299,65 @@ usage:
     } else
 	fi = stdin;
 
-    /* No more arguments. */
-    if (optind != argc)
-	goto usage;
-
-    /* load address */
-    fprintf(stderr, "Load address: $%04X\n", startaddr);
-    tp = tokline;
-    putword(startaddr, &tp);
-    fwrite(tokline, 1, 2, fo);
-
-    for (;;) {
-	if (! fgets(line, MAXLINELEN, fi))
-		break;
-		
-	/* trim off the newline */
-	cp = &line[strlen(line)-1];
-	if (*cp == '\n')
-		*cp = '\0';
-		
-	if (invertcase) {
-		for (cp = line; *cp; ++cp) {
-			int c = *cp;
-			if (isupper(c))
-				*cp = tolower(c);
-			else if (islower(c))
-				*cp = toupper(c);
+    /* A profile from basrun -p says which subroutines run most. */
+    if (prof_name != NULL) {
+	if ((fp = fopen(prof_name, "r")) == NULL ||
+	    runprof_read(fp, &prof) < 0) {
+		fprintf(stderr, "Unable to read profile '%s'\n", prof_name);
+		if (fo != stdout) {
+			fclose(fo);
+			remove(out_name);
 		}
+		return 3;
 	}
-		
-	linenum = strtol(line, &cp, 10);
-
-	/*
-	 * auto-increment line number if no line number was specified
-	 */
-	if (autonumber && cp == line) {
-		linenum = lastlinenum + 1;
-		fprintf(stderr, "auto-numbering %li\n", linenum);
-	}
-
-	if (linenum < 0 || 65535 < linenum) {
-		fprintf(stderr, "Warning: line number %li outside of range [0..65535]. Truncating\n",
-			linenum);
-		if (linenum < 0)
-			linenum = 0;
-		if (linenum > 65535)
-			linenum = 65535;
-	}
-
-	if (linenum == lastlinenum) {
-		fprintf(stderr, "Warning: duplicate line number %li\n",
-			linenum);
-	}
-
-	if (linenum < lastlinenum) {
-		fprintf(stderr, "Warning: line number %li out of order\n",
-			linenum);
-	}
-
-	lastlinenum = linenum;
+	fclose(fp);
+	opts.profile = &prof;
+    }
 
-	/* trim extraneous whitespace at the beginning and end */
-	if (trimspaces) {
-		char *ep = &line[strlen(line)-1];
-		while (ep >= line && isspace(*ep))
-			--ep;
-		ep[1] = '\0';
-		while (*cp && isspace(*cp))
-			++cp;
+    /* Incremental mode: only lines not in the cache get tokenized. */
+    if (cache_name != NULL && (opts.cache = tokcache_open(cache_name)) == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	if (fo != stdout) {
+		fclose(fo);
+		remove(out_name);
 	}
-		
-	tp = &tokline[2]; /* skip first word for now */
-	putword(linenum, &tp);
-		
-	toklinelen = tokenize(tp, cp);
-#ifdef _DEBUG
-	if (debug)
-		fprintf(stderr, "line length: %i\n", toklinelen);
-#endif
-	startaddr += toklinelen + 4;
-	tp = tokline;
-	putword(startaddr, &tp);
-	fwrite(tokline, 1, toklinelen + 4, fo);
+	return 2;
     }
 
-    tp = tokline;
-    putword(0, &tp);
-    fwrite(tokline, 1, 2, fo);
+    diag_init(&diag, quiet ? NULL : stderr, NULL);
+    if (fm != NULL) {
+	metrics_init(&metrics, opts.dialect);
+	diag.metrics = &metrics;
+    }
+    ret = bas2prg_file(fi, fo, &opts, &diag);
+    if (ret != 0)
+	fprintf(stderr, "%s\n", diag.error);
+
+    if (opts.cache != NULL) {
+	tokcache_stats(opts.cache, &lines, &hits);
+	diag_info(&diag, "%li of %li lines from the cache\n", hits, lines);
+	if (ret == 0 && tokcache_save(opts.cache, cache_name) != 0)
+		fprintf(stderr, "Unable to write cache '%s'\n", cache_name);
+	tokcache_free(opts.cache);
+    }
 
-    if (fo != stdout)
+    if (opts.profile != NULL)
+	runprof_free(&prof);
+    /* Don't leave a partial PRG behind where a good one was asked for. */
+    if (fo != stdout) {
 	fclose(fo);
+	if (ret != 0)
+		remove(out_name);
+    }
+
+    if (fm != NULL) {
+	if (metrics_write(fm, in_name, &metrics, ret,
+			  ret ? diag.error : NULL) != 0)
+		fprintf(stderr, "Unable to write metrics '%s'\n", metrics_name);
+	metrics_free(&metrics);
+	if (fm != stdout)
+		fclose(fm);
+    }
 
-    return 0;
+    return ret ? 4 : 0;
 }
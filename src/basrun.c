@@ -0,0 +1,198 @@
+/*
+ * basrun.c, run a C64 BASIC program without a C64 and show where the time
+ * goes.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+#include "tokens.h"
+#include "prgtools.h"
+
+
+#define CYCLES_JIFFY	(CYCLES_SECOND / 60)
+
+
+/*
+ * text files are tokenized first, anything else is taken as a PRG
+ */
+static int
+is_text(const char *name)
+{
+    size_t n = strlen(name);
+
+    return n > 4 && (!strcmp(&name[n - 4], ".bas") ||
+		     !strcmp(&name[n - 4], ".BAS"));
+}
+
+
+/*
+ * the profile, a line for each line of the program
+ */
+static void
+print_profile(FILE *fp, const char *name, const runprof_t *prof)
+{
+    const lineprof_t *lp;
+    double total = prof->cycles > 0 ? prof->cycles : 1;
+    int i;
+
+    fprintf(fp, "# %s\n", name);
+    fprintf(fp, "%5s %10s %10s %12s %10s %6s %5s\n",
+	    "line", "hits", "stmts", "cycles", "jiffies", "%", "gcs");
+    for (i = 0; i < prof->nlines; ++i) {
+	lp = &prof->lines[i];
+	if (lp->hits == 0)
+		continue;
+	fprintf(fp, "%5ld %10ld %10ld %12.0f %10.1f %6.2f %5ld\n",
+		lp->line, lp->hits, lp->stmts, lp->cycles,
+		lp->cycles / CYCLES_JIFFY, 100 * lp->cycles / total, lp->gcs);
+    }
+}
+
+
+int
+main(int argc, char **argv)
+{
+    prgopts_t opts;
+    runopts_t ro;
+    runprof_t prof;
+    diag_t diag;
+    outbuf_t in, prg;
+    int c, ret = 0, quiet = 0, verbose = 0;
+    double seconds = 3600;
+    char *in_name, *prof_name;
+    FILE *fi, *fp = NULL;
+
+    /* Set defaults. */
+    prgopts_init(&opts);
+    in_name = NULL;
+    prof_name = NULL;
+
+    /* Process commandline arguments. */
+    opterr = 0;
+    while ((c = getopt(argc, argv, "ei:p:qt:uv")) != EOF) switch (c) {
+	case 'e':	// escape-codes
+		opts.charset = CHARSET_ESCAPES;
+		break;
+
+	case 'i':	// input-script
+		in_name = optarg;
+		break;
+
+	case 'p':	// profile-file
+		prof_name = optarg;
+		break;
+
+	case 'q':	// quiet
+		quiet = 1;
+		break;
+
+	case 't':	// time-limit
+		seconds = atof(optarg);
+		break;
+
+	case 'u':	// utf8-codes
+		opts.charset = CHARSET_UTF8;
+		break;
+
+	case 'v':	// verbose
+		verbose = 1;
+		break;
+
+	default:
+		fprintf(stderr, "Usage: basrun [-equv] [-i input] [-p profile] [-t seconds] file ...\n");
+		exit(1);
+    }
+    if (optind == argc) {
+	fprintf(stderr, "Usage: basrun [-equv] [-i input] [-p profile] [-t seconds] file ...\n");
+	exit(1);
+    }
+
+    tokens_init();
+    opts.ramtop = dialect_top(opts.dialect);
+
+    memset(&ro, 0, sizeof(ro));
+    ro.out = quiet ? NULL : stdout;
+    ro.charset = opts.charset;
+    ro.maxcycles = seconds * CYCLES_SECOND;
+    if (in_name != NULL && (ro.in = fopen(in_name, "r")) == NULL) {
+	fprintf(stderr, "Unable to open input '%s'\n", in_name);
+	return 3;
+    }
+    if (prof_name != NULL) {
+	fp = strcmp(prof_name, "-") ? fopen(prof_name, "w") : stdout;
+	if (fp == NULL) {
+		fprintf(stderr, "Unable to create profile '%s'\n", prof_name);
+		return 2;
+	}
+    }
+
+    for (; optind < argc; ++optind) {
+	memset(&in, 0, sizeof(in));
+	memset(&prg, 0, sizeof(prg));
+	diag_init(&diag, stderr, argv[optind]);
+	diag.verbose = verbose;
+
+	if ((fi = fopen(argv[optind], "rb")) == NULL) {
+		fprintf(stderr, "Unable to open input '%s'\n", argv[optind]);
+		ret = 3;
+		continue;
+	}
+	c = readfile(fi, &in);
+	fclose(fi);
+	if (c < 0) {
+		fprintf(stderr, "%s: read error\n", argv[optind]);
+		ret = 3;
+		outbuf_free(&in);
+		continue;
+	}
+	if (is_text(argv[optind]) &&
+	    bas2prg_buf(in.buf, in.len, &prg, &opts, &diag) < 0) {
+		fprintf(stderr, "%s: %s\n", argv[optind], diag.error);
+		ret = 4;
+		outbuf_free(&in);
+		continue;
+	}
+
+	if (is_text(argv[optind]))
+		c = bas_run((unsigned char *)prg.buf, prg.len, &ro, &prof, &diag);
+	else
+		c = bas_run((unsigned char *)in.buf, in.len, &ro, &prof, &diag);
+	if (c < 0) {
+		fprintf(stderr, "%s: %s\n", argv[optind], diag.error);
+		ret = 4;
+	}
+	fflush(stdout);
+	fprintf(stderr, "%s: %ld statements in %.2f s, %ld garbage collections in %.2f s\n",
+		argv[optind], prof.stmts, prof.cycles / CYCLES_SECOND,
+		prof.gcs, prof.gccycles / CYCLES_SECOND);
+	if (fp != NULL)
+		print_profile(fp, argv[optind], &prof);
+
+	runprof_free(&prof);
+	outbuf_free(&in);
+	outbuf_free(&prg);
+    }
+
+    if (ro.in != NULL)
+	fclose(ro.in);
+    if (fp != NULL && fp != stdout)
+	fclose(fp);
+
+    return ret;
+}
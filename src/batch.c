@@ -0,0 +1,1587 @@
+/*
+ * batch.c, convert many files at once on a pool of threads.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+# include <windows.h>
+# include <direct.h>
+# include <io.h>
+# include <fcntl.h>
+#else
+# include <pthread.h>
+# include <dirent.h>
+# include <unistd.h>
+#endif
+#include "prgtools.h"
+#include "batch.h"
+
+
+#define IOBUFSIZE	65536		// per-thread stdio buffer size
+
+
+#ifdef _WIN32
+typedef HANDLE			thread_t;
+typedef CRITICAL_SECTION	mutex_t;
+typedef CONDITION_VARIABLE	cond_t;
+# define mutex_init(m)		InitializeCriticalSection(m)
+# define mutex_lock(m)		EnterCriticalSection(m)
+# define mutex_unlock(m)	LeaveCriticalSection(m)
+# define mutex_destroy(m)	DeleteCriticalSection(m)
+# define cond_init(c)		InitializeConditionVariable(c)
+# define cond_wait(c, m)	SleepConditionVariableCS(c, m, INFINITE)
+# define cond_signal(c)		WakeConditionVariable(c)
+# define cond_destroy(c)	((void)(c))
+# define thread_create(t, fn, arg) \
+	((*(t) = CreateThread(NULL, 0, fn, arg, 0, NULL)) != NULL ? 0 : -1)
+# define thread_join(t)		(WaitForSingleObject(t, INFINITE), CloseHandle(t))
+# define mkdir(p, m)		_mkdir(p)
+#else
+typedef pthread_t		thread_t;
+typedef pthread_mutex_t		mutex_t;
+typedef pthread_cond_t		cond_t;
+# define mutex_init(m)		pthread_mutex_init(m, NULL)
+# define mutex_lock(m)		pthread_mutex_lock(m)
+# define mutex_unlock(m)	pthread_mutex_unlock(m)
+# define mutex_destroy(m)	pthread_mutex_destroy(m)
+# define cond_init(c)		pthread_cond_init(c, NULL)
+# define cond_wait(c, m)	pthread_cond_wait(c, m)
+# define cond_signal(c)		pthread_cond_signal(c)
+# define cond_destroy(c)	pthread_cond_destroy(c)
+# define thread_create(t, fn, arg) \
+	(pthread_create(t, NULL, fn, arg) != 0 ? -1 : 0)
+# define thread_join(t)		pthread_join(t, NULL)
+#endif
+
+
+/* Jobs [head..tail) of one worker that have not been taken yet. */
+typedef struct {
+    mutex_t	lock;
+    int		head,
+		tail;
+} deque_t;
+
+typedef struct {
+    deque_t	*q;
+    int		nq;
+    pool_fn	fn;
+    void	*arg;
+} pool_t;
+
+typedef struct {
+    pool_t	*pool;
+    int		id;
+    thread_t	thread;
+} worker_t;
+
+
+/* One file to convert. */
+typedef struct {
+    char	*in;
+    char	*out;
+    int		status;		// 0 done, -1 failed, 1 skipped
+    int		warnings;
+    char	*error;
+    char	*metrics;	// its line of JSON, or NULL
+    imgent_t	*ent;		// entry on a disk image, or NULL
+} job_t;
+
+typedef struct {
+    const convdesc_t *desc;
+    const batchopts_t *bo;
+    const prgopts_t *opts;
+    job_t	*jobs;
+    int		njobs;
+    int		size;
+    char	**iobuf;	// two buffers per worker
+    outbuf_t	*outbuf;	// one more per worker, for disk images
+    d64_t	img;
+    const unsigned char *tape;	// T64 archive, or NULL for a D64 image
+    outbuf_t	*result;	// one per job, for programs written to an image
+} batch_t;
+
+
+int
+pool_ncpus(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO si;
+
+    GetSystemInfo(&si);
+    return si.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+
+/*
+ * take a job from the front of our own deque, or from the back of someone
+ * else's one; returns -1 if the deque is empty
+ */
+static int
+pool_take(deque_t *q, int steal)
+{
+    int job = -1;
+
+    mutex_lock(&q->lock);
+    if (q->head < q->tail)
+	job = steal ? --q->tail : q->head++;
+    mutex_unlock(&q->lock);
+
+    return job;
+}
+
+
+#ifdef _WIN32
+static DWORD WINAPI
+#else
+static void *
+#endif
+pool_worker(void *priv)
+{
+    worker_t *w = (worker_t *)priv;
+    pool_t *p = w->pool;
+    int job, i;
+
+    for (;;) {
+	job = pool_take(&p->q[w->id], 0);
+
+	/* Out of work, go steal some. No new jobs appear, so if all
+	 * deques are empty we are done. */
+	for (i = 1; job < 0 && i < p->nq; ++i)
+		job = pool_take(&p->q[(w->id + i) % p->nq], 1);
+	if (job < 0)
+		break;
+
+	p->fn(p->arg, job, w->id);
+    }
+
+    return 0;
+}
+
+
+int
+pool_run(int njobs, int nthreads, pool_fn fn, void *arg)
+{
+    worker_t *w;
+    pool_t pool;
+    int i, started;
+
+    if (nthreads > njobs)
+	nthreads = njobs;
+    if (nthreads <= 1) {
+	for (i = 0; i < njobs; ++i)
+		fn(arg, i, 0);
+	return 0;
+    }
+
+    pool.fn = fn;
+    pool.arg = arg;
+    pool.nq = nthreads;
+    pool.q = malloc(nthreads * sizeof(deque_t));
+    w = malloc(nthreads * sizeof(worker_t));
+    if (pool.q == NULL || w == NULL) {
+	free(pool.q);
+	free(w);
+	return -1;
+    }
+
+    /* Hand out contiguous ranges, so neighbouring files stay together. */
+    for (i = 0; i < nthreads; ++i) {
+	mutex_init(&pool.q[i].lock);
+	pool.q[i].head = (int)((long long)njobs * i / nthreads);
+	pool.q[i].tail = (int)((long long)njobs * (i + 1) / nthreads);
+	w[i].pool = &pool;
+	w[i].id = i;
+    }
+
+    /* If we run out of threads, the deques of the workers that did not
+       start are stolen by those that did, and by worker 0 at least. */
+    for (started = 1; started < nthreads; ++started) {
+	if (thread_create(&w[started].thread, pool_worker, &w[started]) < 0)
+		break;
+    }
+    pool_worker(&w[0]);
+    for (i = 1; i < started; ++i)
+	thread_join(w[i].thread);
+
+    for (i = 0; i < nthreads; ++i)
+	mutex_destroy(&pool.q[i].lock);
+    free(pool.q);
+    free(w);
+
+    return 0;
+}
+
+
+static char *
+xstrdup(const char *s)
+{
+    char *p = malloc(strlen(s) + 1);
+
+    if (p == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	exit(2);
+    }
+
+    return strcpy(p, s);
+}
+
+
+/*
+ * join a directory and a name, replacing the extension if newext is set
+ */
+static char *
+mkpath(const char *dir, const char *name, const char *newext)
+{
+    size_t len = strlen(name);
+    const char *dot;
+    char *p, *ep;
+
+    if (newext != NULL) {
+	dot = strrchr(name, '.');
+	if (dot != NULL && strchr(dot, '/') == NULL && dot != name)
+		len = dot - name;
+    }
+
+    p = malloc((dir ? strlen(dir) : 0) + len + (newext ? strlen(newext) : 0) + 2);
+    if (p == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	exit(2);
+    }
+
+    *p = '\0';
+    if (dir != NULL && *dir) {
+	strcpy(p, dir);
+	if (p[strlen(p) - 1] != '/')
+		strcat(p, "/");
+    }
+    ep = p + strlen(p);
+    memcpy(ep, name, len);
+    strcpy(ep + len, newext ? newext : "");
+
+    return p;
+}
+
+
+static int
+hasext(const char *name, const char *ext)
+{
+    size_t n = strlen(name), e = strlen(ext);
+
+    if (n <= e)
+	return 0;
+    for (name += n - e; *ext; ++name, ++ext) {
+	if (tolower((unsigned char)*name) != tolower((unsigned char)*ext))
+		return 0;
+    }
+
+    return 1;
+}
+
+
+int
+batch_isdir(const char *path)
+{
+    struct stat st;
+
+    return stat(path, &st) == 0 && (st.st_mode & S_IFMT) == S_IFDIR;
+}
+
+
+/*
+ * whether batch_walk() should go into path: a symbolic link to a
+ * directory could lead back up the tree, so it is left alone
+ */
+static int
+walk_isdir(const char *path)
+{
+#ifdef _WIN32
+    DWORD a = GetFileAttributesA(path);
+
+    return a != INVALID_FILE_ATTRIBUTES && (a & FILE_ATTRIBUTE_DIRECTORY) &&
+	   !(a & FILE_ATTRIBUTE_REPARSE_POINT);
+#else
+    struct stat st;
+
+    return lstat(path, &st) == 0 && S_ISDIR(st.st_mode);
+#endif
+}
+
+
+static job_t *
+batch_add(batch_t *b, const char *in, const char *outdir, const char *rel)
+{
+    job_t *j;
+
+    if (b->njobs == b->size) {
+	b->size = b->size ? b->size * 2 : 64;
+	b->jobs = realloc(b->jobs, b->size * sizeof(job_t));
+	if (b->jobs == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		exit(2);
+	}
+    }
+
+    j = &b->jobs[b->njobs++];
+    memset(j, 0, sizeof(*j));
+    j->in = xstrdup(in);
+    if (outdir != NULL)
+	j->out = mkpath(outdir, rel, b->desc->newext);
+    else
+	j->out = mkpath(NULL, in, b->desc->newext);
+
+    return j;
+}
+
+
+static int
+namecmp(const void *a, const void *b)
+{
+    return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+
+/*
+ * walk a directory tree, adding files with the right extension in sorted
+ * order so that the job list (and the report) does not depend on the
+ * order the filesystem returns them in
+ */
+static void
+batch_walk(batch_t *b, const char *dir, const char *outdir, const char *rel)
+{
+    char **names = NULL;
+    int n = 0, size = 0, i;
+    char *path, *sub;
+#ifdef _WIN32
+    WIN32_FIND_DATAA fd;
+    HANDLE h;
+    const char *name;
+
+    path = mkpath(dir, "*", NULL);
+    h = FindFirstFileA(path, &fd);
+    free(path);
+    if (h == INVALID_HANDLE_VALUE)
+	return;
+    do {
+	name = fd.cFileName;
+#else
+    struct dirent *de;
+    const char *name;
+    DIR *dp;
+
+    if ((dp = opendir(dir)) == NULL)
+	return;
+    while ((de = readdir(dp)) != NULL) {
+	name = de->d_name;
+#endif
+	if (!strcmp(name, ".") || !strcmp(name, ".."))
+		continue;
+	if (n == size) {
+		size = size ? size * 2 : 32;
+		names = realloc(names, size * sizeof(char *));
+		if (names == NULL) {
+			fprintf(stderr, "Out of memory\n");
+			exit(2);
+		}
+	}
+	names[n++] = xstrdup(name);
+#ifdef _WIN32
+    } while (FindNextFileA(h, &fd));
+    FindClose(h);
+#else
+    }
+    closedir(dp);
+#endif
+
+    qsort(names, n, sizeof(char *), namecmp);
+
+    for (i = 0; i < n; ++i) {
+	path = mkpath(dir, names[i], NULL);
+	sub = mkpath(rel, names[i], NULL);
+	if (walk_isdir(path))
+		batch_walk(b, path, outdir, sub);
+	else if (batch_isdir(path))
+		;			// a link to a directory
+
+	else if (hasext(names[i], b->desc->ext))
+		batch_add(b, path, outdir, sub);
+	free(path);
+	free(sub);
+	free(names[i]);
+    }
+    free(names);
+}
+
+
+static int
+outcmp(const void *a, const void *b)
+{
+    const job_t *ja = *(job_t * const *)a, *jb = *(job_t * const *)b;
+    int c = strcmp(ja->out, jb->out);
+
+    return c ? c : (ja > jb) - (ja < jb);
+}
+
+
+/*
+ * fail every job that would write the same output as one before it,
+ * before any of them runs; two workers writing one file could leave
+ * either program, or a mix of both. what says what the output is.
+ */
+static void
+batch_dups(batch_t *b, const char *what)
+{
+    job_t **sorted;
+    int i, k;
+
+    if (b->njobs < 2)
+	return;
+    if ((sorted = malloc(b->njobs * sizeof(job_t *))) == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	exit(2);
+    }
+    for (i = 0; i < b->njobs; ++i)
+	sorted[i] = &b->jobs[i];
+    qsort(sorted, b->njobs, sizeof(job_t *), outcmp);
+
+    for (i = 0; i < b->njobs; i = k) {
+	for (k = i + 1; k < b->njobs &&
+	     !strcmp(sorted[k]->out, sorted[i]->out); ++k) {
+		sorted[k]->status = -1;
+		sorted[k]->error = malloc(strlen(what) +
+					  strlen(sorted[i]->in) + 16);
+		if (sorted[k]->error == NULL) {
+			fprintf(stderr, "Out of memory\n");
+			exit(2);
+		}
+		sprintf(sorted[k]->error, "same %s as '%s'", what,
+			sorted[i]->in);
+	}
+    }
+    free(sorted);
+}
+
+
+/*
+ * the files a batch over these inputs would take: the files given, and
+ * those with the extension ext in the directories, in sorted order
+ * returns how many, in a malloc()ed array of malloc()ed names
+ */
+int
+batch_files(char **inputs, int ninputs, const char *ext, char ***names)
+{
+    convdesc_t desc;
+    batch_t b;
+    int i;
+
+    memset(&desc, 0, sizeof(desc));
+    desc.ext = ext;
+    memset(&b, 0, sizeof(b));
+    b.desc = &desc;
+
+    for (i = 0; i < ninputs; ++i) {
+	if (batch_isdir(inputs[i]))
+		batch_walk(&b, inputs[i], NULL, NULL);
+	else
+		batch_add(&b, inputs[i], NULL, inputs[i]);
+    }
+
+    if ((*names = malloc((b.njobs + 1) * sizeof(char *))) == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	exit(2);
+    }
+    for (i = 0; i < b.njobs; ++i) {
+	(*names)[i] = b.jobs[i].in;
+	free(b.jobs[i].out);
+    }
+    free(b.jobs);
+
+    return b.njobs;
+}
+
+
+/*
+ * create the directories leading up to a file
+ */
+static void
+mkparents(const char *path)
+{
+    char *p = xstrdup(path);
+    char *sp;
+
+    for (sp = p + 1; (sp = strchr(sp, '/')) != NULL; ++sp) {
+	*sp = '\0';
+	(void)mkdir(p, 0777);
+	*sp = '/';
+    }
+    free(p);
+}
+
+
+/*
+ * set up the diagnostics for a job, and its metrics if they are wanted
+ */
+static void
+batch_diag(batch_t *b, job_t *j, diag_t *diag, prgmetrics_t *m)
+{
+    diag_init(diag, b->bo->quiet ? NULL : stderr, j->in);
+    diag->verbose = 0;
+    if (b->bo->metrics != NULL) {
+	metrics_init(m, b->opts->dialect);
+	diag->metrics = m;
+    }
+}
+
+
+/*
+ * keep the outcome of a job for the report
+ */
+static void
+batch_result(job_t *j, diag_t *diag)
+{
+    outbuf_t o;
+
+    if (j->status < 0)
+	j->error = xstrdup(diag->error);
+    j->warnings = diag->warnings;
+    if (diag->metrics == NULL)
+	return;
+
+    memset(&o, 0, sizeof(o));
+    if (metrics_json(&o, j->in, diag->metrics, j->status,
+		     j->status < 0 ? diag->error : NULL) == 0 &&
+	outbuf_reserve(&o, 1) == 0) {
+	o.buf[o.len] = '\0';
+	j->metrics = o.buf;
+    } else
+	outbuf_free(&o);
+    metrics_free(diag->metrics);
+}
+
+
+static void
+batch_job(void *arg, int n, int worker)
+{
+    batch_t *b = (batch_t *)arg;
+    job_t *j = &b->jobs[n];
+    FILE *fi, *fo;
+    prgmetrics_t m;
+    diag_t diag;
+
+    if (j->status < 0)		// failed by batch_dups()
+	return;
+    batch_diag(b, j, &diag, &m);
+
+    if ((fi = fopen(j->in, b->desc->rmode)) == NULL) {
+	j->status = diag_error(&diag, "unable to open input");
+	batch_result(j, &diag);
+	return;
+    }
+
+    mkparents(j->out);
+    if ((fo = fopen(j->out, b->desc->wmode)) == NULL) {
+	fclose(fi);
+	j->status = diag_error(&diag, "unable to create output '%s'", j->out);
+	batch_result(j, &diag);
+	return;
+    }
+
+    /* Reuse this worker's buffers instead of letting stdio allocate. */
+    setvbuf(fi, b->iobuf[2 * worker], _IOFBF, IOBUFSIZE);
+    setvbuf(fo, b->iobuf[2 * worker + 1], _IOFBF, IOBUFSIZE);
+
+    j->status = b->desc->conv(fi, fo, b->opts, &diag);
+    fclose(fi);
+    metrics_mark(diag.metrics);
+    if (fclose(fo) != 0 && j->status == 0)
+	j->status = diag_error(&diag, "write error");
+    metrics_time(diag.metrics, TIME_WRITE);
+    if (j->status != 0)
+	remove(j->out);
+    batch_result(j, &diag);
+}
+
+
+/*
+ * allocate two buffers of the given size for each worker
+ */
+static int
+batch_alloc(batch_t *b, int nthreads, size_t size)
+{
+    int i;
+
+    b->iobuf = calloc(2 * nthreads, sizeof(char *));
+    b->outbuf = calloc(nthreads, sizeof(outbuf_t));
+    if (b->iobuf == NULL || b->outbuf == NULL)
+	return -1;
+    for (i = 0; i < 2 * nthreads; ++i) {
+	if ((b->iobuf[i] = malloc(size)) == NULL)
+		return -1;
+    }
+
+    return 0;
+}
+
+
+/*
+ * print the report, free everything
+ * returns the number of files that failed
+ */
+static int
+batch_done(batch_t *b, int nthreads)
+{
+    int done = 0, failed = 0, skipped = 0, warnings = 0;
+    int i;
+
+    for (i = 0; i < b->njobs; ++i) {
+	if (b->jobs[i].status < 0) {
+		fprintf(stderr, "%s: %s\n", b->jobs[i].in, b->jobs[i].error);
+		failed++;
+	} else if (b->jobs[i].status > 0)
+		skipped++;
+	else
+		done++;
+	warnings += b->jobs[i].warnings;
+	if (b->jobs[i].metrics != NULL)
+		fputs(b->jobs[i].metrics, b->bo->metrics);
+	free(b->jobs[i].in);
+	free(b->jobs[i].out);
+	free(b->jobs[i].error);
+	free(b->jobs[i].metrics);
+    }
+    if (skipped)
+	fprintf(stderr, "%i files converted, %i failed, %i skipped, %i warnings\n",
+		done, failed, skipped, warnings);
+    else
+	fprintf(stderr, "%i files converted, %i failed, %i warnings\n",
+		done, failed, warnings);
+
+    for (i = 0; i < 2 * nthreads; ++i)
+	free(b->iobuf[i]);
+    for (i = 0; i < nthreads; ++i)
+	outbuf_free(&b->outbuf[i]);
+    free(b->iobuf);
+    free(b->outbuf);
+    free(b->jobs);
+
+    return failed;
+}
+
+
+/*
+ * convert a list of files and directories, print one report at the end
+ * returns the number of files that failed
+ */
+int
+batch_run(const convdesc_t *desc, char **inputs, int ninputs,
+	  const batchopts_t *bo, const prgopts_t *opts)
+{
+    const char *outdir = bo->outdir;
+    int nthreads = bo->nthreads;
+    batch_t b;
+    const char *base;
+    int i;
+
+    memset(&b, 0, sizeof(b));
+    b.desc = desc;
+    b.bo = bo;
+    b.opts = opts;
+
+    for (i = 0; i < ninputs; ++i) {
+	if (batch_isdir(inputs[i])) {
+		batch_walk(&b, inputs[i], outdir, NULL);
+	} else {
+		base = strrchr(inputs[i], '/');
+		base = base ? base + 1 : inputs[i];
+		batch_add(&b, inputs[i], outdir, base);
+	}
+    }
+    batch_dups(&b, "output file");
+
+    if (nthreads <= 0)
+	nthreads = pool_ncpus();
+    if (batch_alloc(&b, nthreads, IOBUFSIZE) < 0 ||
+	pool_run(b.njobs, nthreads, batch_job, &b) < 0) {
+	fprintf(stderr, "Out of memory\n");
+	exit(2);
+    }
+
+    return batch_done(&b, nthreads);
+}
+
+
+/*
+ * convert one BASIC program straight out of a disk image or a tape
+ * archive; tape files are converted where they are, disk files have to
+ * be gathered from their sectors first
+ */
+static void
+batch_imgjob(void *arg, int n, int worker)
+{
+    batch_t *b = (batch_t *)arg;
+    job_t *j = &b->jobs[n];
+    unsigned char *prg = (unsigned char *)b->iobuf[2 * worker];
+    outbuf_t *out = &b->outbuf[worker];
+    const unsigned char *sp = prg + 2;
+    prgmetrics_t m;
+    diag_t diag;
+    long len;
+    FILE *fo;
+
+    if (j->status < 0)		// failed by batch_dups()
+	return;
+    batch_diag(b, j, &diag, &m);
+    metrics_mark(diag.metrics);
+
+    out->len = 0;
+    if (b->tape != NULL) {
+	sp = b->tape + j->ent->offset;
+	len = j->ent->len;
+	if (!image_isbasic(j->ent->load, sp, len)) {
+		j->status = 1;
+		batch_result(j, &diag);
+		return;
+	}
+	metrics_time(diag.metrics, TIME_READ);
+	j->status = b->desc->image(j->ent->load, sp, len, out,
+				   b->opts, &diag);
+    } else if ((len = d64_read(&b->img, j->ent, prg, MAXPRGLEN)) < 0) {
+	j->status = diag_error(&diag, "broken sector chain");
+    } else if (!prg_isbasic(prg, len)) {
+	j->status = 1;
+	batch_result(j, &diag);
+	return;
+    } else {
+	metrics_time(diag.metrics, TIME_READ);
+	len -= 2;
+	j->status = b->desc->image(prg[0] | (prg[1] << 8), sp, len, out,
+				   b->opts, &diag);
+    }
+    metrics_time(diag.metrics, TIME_CONVERT);
+
+    if (j->status == 0) {
+	mkparents(j->out);
+	if ((fo = fopen(j->out, b->desc->wmode)) == NULL) {
+		j->status = diag_error(&diag, "unable to create output '%s'",
+				       j->out);
+	} else {
+		fwrite(out->buf, 1, out->len, fo);
+		if (fclose(fo) != 0) {
+			j->status = diag_error(&diag, "write error");
+			remove(j->out);
+		}
+	}
+    }
+
+    if (diag.metrics != NULL && len >= 0) {
+	metrics_time(diag.metrics, TIME_WRITE);
+	diag.metrics->bytesin = len + 2;	// as if it had been extracted
+	diag.metrics->bytesout = out->len;
+	metrics_count(diag.metrics, sp, len);
+    }
+    batch_result(j, &diag);
+}
+
+
+/*
+ * turn a PETSCII file name into something safe for the host
+ */
+static void
+hostname(char *dst, const char *src)
+{
+    int c;
+
+    if (*src == '\0')
+	*dst++ = '_';
+    while ((c = (unsigned char)*src++) != '\0') {
+	if (c < 0x20 || c > 0x7e || strchr("/\\:*?\"<>|", c) != NULL)
+		c = '_';
+	*dst++ = c;
+    }
+    *dst = '\0';
+}
+
+
+/*
+ * list every BASIC program on a D64 image or in a T64 archive, without
+ * extracting anything
+ * Output files are named after the directory entries, in a directory named
+ * after the image (inside outdir, if given). The programs are converted in
+ * parallel.
+ * returns the number of files that failed, or -1 if the image is unusable
+ */
+int
+batch_image(const convdesc_t *desc, const char *image,
+	    const batchopts_t *bo, const prgopts_t *opts)
+{
+    const char *outdir = bo->outdir;
+    int nthreads = bo->nthreads;
+    imgent_t *ents = NULL;
+    char name[32], *dir, *in;
+    const char *base;
+    outbuf_t data;
+    batch_t b;
+    job_t *j;
+    FILE *fp;
+    int n, i, k;
+
+    memset(&b, 0, sizeof(b));
+    memset(&data, 0, sizeof(data));
+    b.desc = desc;
+    b.bo = bo;
+    b.opts = opts;
+
+    if ((fp = fopen(image, "rb")) == NULL) {
+	fprintf(stderr, "Unable to open input '%s'\n", image);
+	return -1;
+    }
+    i = readfile(fp, &data);
+    fclose(fp);
+    if (i == 0 && t64_check((unsigned char *)data.buf, data.len)) {
+	b.tape = (unsigned char *)data.buf;
+	n = t64_dir(b.tape, data.len, &ents);
+    } else if (i == 0 &&
+	       d64_open(&b.img, (unsigned char *)data.buf, data.len) == 0) {
+	n = d64_dir(&b.img, &ents);
+    } else
+	n = -1;
+    if (n < 0) {
+	fprintf(stderr, "%s: not a D64 image or T64 archive\n", image);
+	outbuf_free(&data);
+	return -1;
+    }
+
+    base = strrchr(image, '/');
+    base = base ? base + 1 : image;
+    dir = mkpath(outdir, outdir ? base : image, "");
+    for (i = 0; i < n; ++i) {
+	if ((ents[i].type & 7) != D64_PRG)
+		continue;
+
+	/* same name twice on one disk: add the entry number */
+	hostname(name, ents[i].name);
+	for (k = 0; k < i; ++k) {
+		if ((ents[k].type & 7) == D64_PRG &&
+		    !strcmp(ents[k].name, ents[i].name)) {
+			sprintf(&name[strlen(name)], "_%i", i);
+			break;
+		}
+	}
+
+	/* name it as if it had been extracted, so that only the extension
+	 * we add gets swapped, not part of the C64 name */
+	strcat(name, desc->ext);
+
+	in = malloc(strlen(image) + strlen(ents[i].name) + 2);
+	if (in == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		exit(2);
+	}
+	sprintf(in, "%s:%s", image, ents[i].name);
+	j = batch_add(&b, in, dir, name);
+	j->ent = &ents[i];
+	free(in);
+    }
+    free(dir);
+    batch_dups(&b, "output file");
+
+    if (nthreads <= 0)
+	nthreads = pool_ncpus();
+    if (batch_alloc(&b, nthreads, MAXPRGLEN) < 0 ||
+	pool_run(b.njobs, nthreads, batch_imgjob, &b) < 0) {
+	fprintf(stderr, "Out of memory\n");
+	exit(2);
+    }
+
+    n = batch_done(&b, nthreads);
+    free(ents);
+    outbuf_free(&data);
+
+    return n;
+}
+
+
+/*
+ * A tar stream is converted in three stages on their own threads: one
+ * reads blocks of whole members, the pool converts the members of a block
+ * while the next is read, and one writes the converted block as a tar
+ * stream while the next is converted. Two blocks go round between each
+ * pair of stages, so that each of them waits only when it is ahead.
+ */
+#define TARCHUNK	(4L << 20)	// read from the stream at a time
+
+/* A count of the buffers one stage has handed to the next. */
+typedef struct {
+    mutex_t	lock;
+    cond_t	cond;
+    int		count;
+} handoff_t;
+
+/* Members of a tar stream, read in one go. */
+typedef struct {
+    outbuf_t	in;		// the stream
+    long	used;		// bytes of it up to the last whole member
+    tarent_t	*ents;		// the members to convert
+    job_t	*jobs;
+    outbuf_t	*out;		// and what they were converted to
+    int		n, size;
+    int		last;		// the end of the stream is in this one
+    batch_t	*b;
+} tarblk_t;
+
+typedef struct {
+    outbuf_t	buf;		// the next part of the stream to write
+    int		last;
+} tarout_t;
+
+typedef struct {
+    batch_t	b;
+    FILE	*fi, *fo;
+    tarblk_t	blk[2];
+    tarout_t	out[2];
+    handoff_t	blkfree, blkfull;	// reader to pool and back
+    handoff_t	outfree, outfull;	// pool to writer and back
+    const char	*error;		// why the stream could not be read
+    int		werror;		// the output could not be written
+} tarpipe_t;
+
+
+static void
+handoff_init(handoff_t *h, int count)
+{
+    mutex_init(&h->lock);
+    cond_init(&h->cond);
+    h->count = count;
+}
+
+
+static void
+handoff_post(handoff_t *h)
+{
+    mutex_lock(&h->lock);
+    h->count++;
+    cond_signal(&h->cond);
+    mutex_unlock(&h->lock);
+}
+
+
+static void
+handoff_wait(handoff_t *h)
+{
+    mutex_lock(&h->lock);
+    while (h->count == 0)
+	cond_wait(&h->cond, &h->lock);
+    h->count--;
+    mutex_unlock(&h->lock);
+}
+
+
+static void
+handoff_destroy(handoff_t *h)
+{
+    mutex_destroy(&h->lock);
+    cond_destroy(&h->cond);
+}
+
+
+/*
+ * fill a block with the whole members that follow what is left of the
+ * one before; a member larger than a chunk gets a larger block
+ * returns 0, or -1 with t->error set
+ */
+static int
+tar_fill(tarpipe_t *t, tarblk_t *blk, const tarblk_t *prev)
+{
+    const convdesc_t *desc = t->b.desc;
+    tarent_t ent;
+    job_t *j;
+    long n, left = prev ? (long)prev->in.len - prev->used : 0;
+    size_t got;
+    void *p;
+
+    blk->in.len = 0;
+    blk->used = 0;
+    blk->n = 0;
+    if (outbuf_reserve(&blk->in, left + TARCHUNK) < 0)
+	goto oom;
+    if (left > 0)
+	memcpy(blk->in.buf, prev->in.buf + prev->used, left);
+    blk->in.len = left;
+
+    for (;;) {
+	got = fread(&blk->in.buf[blk->in.len], 1,
+		    blk->in.size - blk->in.len, t->fi);
+	blk->in.len += got;
+
+	while ((n = tar_member((unsigned char *)blk->in.buf + blk->used,
+			       blk->in.len - blk->used, &ent)) > 0) {
+		blk->used += n;
+		if (ent.type == 0) {
+			blk->last = 1;
+			return 0;
+		}
+		if (ent.type != '0' || !hasext(ent.name, desc->ext))
+			continue;
+
+		if (blk->n == blk->size) {
+			blk->size = blk->size ? 2 * blk->size : 256;
+			if ((p = realloc(blk->ents, blk->size * sizeof(tarent_t))) == NULL)
+				goto oom;
+			blk->ents = p;
+			if ((p = realloc(blk->jobs, blk->size * sizeof(job_t))) == NULL)
+				goto oom;
+			blk->jobs = p;
+			if ((p = realloc(blk->out, blk->size * sizeof(outbuf_t))) == NULL)
+				goto oom;
+			blk->out = p;
+			memset(&blk->out[blk->n], 0,
+			       (blk->size - blk->n) * sizeof(outbuf_t));
+		}
+		blk->ents[blk->n] = ent;
+		j = &blk->jobs[blk->n++];
+		memset(j, 0, sizeof(*j));
+		j->in = xstrdup(ent.name);
+		j->out = mkpath(NULL, ent.name, desc->newext);
+	}
+
+	if (n < 0) {
+		t->error = "not a tar archive";
+		return -1;
+	}
+	if (got == 0) {
+		if (ferror(t->fi))
+			t->error = "read error";
+		else if (blk->used < (long)blk->in.len)
+			t->error = "unexpected end of the archive";
+		else {
+			/* the two blocks of zeros are missing */
+			blk->last = 1;
+			return 0;
+		}
+		return -1;
+	}
+
+	/* The block is full: hand it on, or grow it for one large member. */
+	if (blk->in.len == blk->in.size) {
+		if (blk->used > 0)
+			return 0;
+		if (outbuf_reserve(&blk->in, blk->in.size) < 0)
+			goto oom;
+	}
+    }
+
+oom:
+    t->error = "out of memory";
+    return -1;
+}
+
+
+#ifdef _WIN32
+static DWORD WINAPI
+#else
+static void *
+#endif
+tar_reader(void *priv)
+{
+    tarpipe_t *t = (tarpipe_t *)priv;
+    tarblk_t *blk, *prev = NULL;
+    int k;
+
+    for (k = 0; ; ++k) {
+	handoff_wait(&t->blkfree);
+	blk = &t->blk[k & 1];
+	blk->last = 0;
+	if (tar_fill(t, blk, prev) < 0)
+		blk->last = 1;
+	handoff_post(&t->blkfull);
+	if (blk->last)
+		break;
+	prev = blk;
+    }
+
+    return 0;
+}
+
+
+#ifdef _WIN32
+static DWORD WINAPI
+#else
+static void *
+#endif
+tar_writer(void *priv)
+{
+    tarpipe_t *t = (tarpipe_t *)priv;
+    tarout_t *o;
+    int k, last;
+
+    for (k = 0; ; ++k) {
+	handoff_wait(&t->outfull);
+	o = &t->out[k & 1];
+	if (!t->werror && o->buf.len > 0 &&
+	    fwrite(o->buf.buf, 1, o->buf.len, t->fo) != o->buf.len)
+		t->werror = 1;
+	last = o->last;
+	handoff_post(&t->outfree);
+	if (last)
+		break;
+    }
+
+    return 0;
+}
+
+
+/*
+ * count the lines of a file converted in memory for its metrics: those of
+ * the PRG file it came from, or of the one it was converted to
+ */
+static void
+batch_count(batch_t *b, job_t *j, diag_t *diag, const unsigned char *in,
+	    long len, const outbuf_t *out)
+{
+    outbuf_t unpacked;
+
+    if (diag->metrics == NULL)
+	return;
+
+    diag->metrics->bytesin = len;
+    diag->metrics->bytesout = j->status == 0 ? out->len : 0;
+    memset(&unpacked, 0, sizeof(unpacked));
+    if (b->desc->image != NULL) {
+	if (len > 2)
+		metrics_count(diag->metrics, in + 2, len - 2);
+    } else if (j->status == 0 && b->opts->pack) {
+	/* the lines are in the packed data */
+	if (prg_unpack((unsigned char *)out->buf, out->len, &unpacked,
+		       diag) == 0)
+		metrics_count(diag->metrics,
+			      (unsigned char *)unpacked.buf + 2,
+			      unpacked.len - 2);
+    } else if (j->status == 0)
+	metrics_count(diag->metrics, (unsigned char *)out->buf + 2,
+		      out->len - 2);
+    outbuf_free(&unpacked);
+}
+
+
+/*
+ * convert one member of a tar stream, where it lies in the block
+ */
+static void
+tar_job(void *arg, int n, int worker)
+{
+    tarblk_t *blk = (tarblk_t *)arg;
+    batch_t *b = blk->b;
+    tarent_t *e = &blk->ents[n];
+    job_t *j = &blk->jobs[n];
+    outbuf_t *out = &blk->out[n];
+    prgmetrics_t m;
+    diag_t diag;
+
+    batch_diag(b, j, &diag, &m);
+    metrics_mark(diag.metrics);
+
+    out->len = 0;
+    j->status = b->desc->buf(e->data, e->size, out, b->opts, &diag);
+    /* no larger a program than could be written to a file */
+    if (j->status == 0 && b->desc->image == NULL && out->len > MAXPRGLEN)
+	j->status = diag_error(&diag, "output buffer full");
+    metrics_time(diag.metrics, TIME_CONVERT);
+
+    batch_count(b, j, &diag, e->data, e->size, out);
+    batch_result(j, &diag);
+}
+
+
+/*
+ * convert the .bas or .prg members of a tar stream, writing what they
+ * were converted to as another; names, order and times stay the same,
+ * and failed members are left out. in and out are files, or NULL for
+ * stdin and stdout.
+ * returns the number of members that failed, or -1 if the stream could
+ * not be read or written
+ */
+int
+batch_tar(const convdesc_t *desc, const char *in, const char *out,
+	  const batchopts_t *bo, const prgopts_t *opts)
+{
+    int nthreads = bo->nthreads;
+    int done = 0, failed = 0, warnings = 0;
+    long long written = 0;
+    tarpipe_t t;
+    tarblk_t *blk;
+    tarout_t *o;
+    thread_t reader, writer;
+    int i, k, last;
+
+    memset(&t, 0, sizeof(t));
+    t.b.desc = desc;
+    t.b.bo = bo;
+    t.b.opts = opts;
+    t.blk[0].b = t.blk[1].b = &t.b;
+    if (nthreads <= 0)
+	nthreads = pool_ncpus();
+
+    if (in == NULL) {
+#ifdef _WIN32
+	_setmode(_fileno(stdin), _O_BINARY);
+#endif
+	t.fi = stdin;
+    } else if ((t.fi = fopen(in, "rb")) == NULL) {
+	fprintf(stderr, "Unable to open input '%s'\n", in);
+	return -1;
+    }
+    if (out == NULL) {
+#ifdef _WIN32
+	_setmode(_fileno(stdout), _O_BINARY);
+#endif
+	t.fo = stdout;
+    } else if ((t.fo = fopen(out, "wb")) == NULL) {
+	fprintf(stderr, "Unable to create output '%s'\n", out);
+	if (t.fi != stdin)
+		fclose(t.fi);
+	return -1;
+    }
+
+    /* Blocks are large, let fread() and fwrite() go straight to them. */
+    setvbuf(t.fi, NULL, _IONBF, 0);
+    setvbuf(t.fo, NULL, _IONBF, 0);
+
+    handoff_init(&t.blkfree, 2);
+    handoff_init(&t.blkfull, 0);
+    handoff_init(&t.outfree, 2);
+    handoff_init(&t.outfull, 0);
+    if (thread_create(&writer, tar_writer, &t) < 0)
+	goto nothreads;
+    if (thread_create(&reader, tar_reader, &t) < 0) {
+	/* An empty last part sends the writer home. */
+	t.out[0].last = 1;
+	handoff_post(&t.outfull);
+	thread_join(writer);
+	goto nothreads;
+    }
+
+    for (k = 0, last = 0; !last; ++k) {
+	handoff_wait(&t.blkfull);
+	blk = &t.blk[k & 1];
+	if (pool_run(blk->n, nthreads, tar_job, blk) < 0) {
+		fprintf(stderr, "Out of memory\n");
+		exit(2);
+	}
+
+	/* Pack the members that were converted into the stream out. */
+	handoff_wait(&t.outfree);
+	o = &t.out[k & 1];
+	o->buf.len = 0;
+	for (i = 0; i < blk->n; ++i) {
+		if (blk->jobs[i].status < 0) {
+			fprintf(stderr, "%s: %s\n", blk->jobs[i].in,
+				blk->jobs[i].error);
+			failed++;
+		} else {
+			if (tar_header(&o->buf, blk->jobs[i].out,
+				       blk->out[i].len, blk->ents[i].mtime,
+				       blk->ents[i].mode) < 0 ||
+			    outbuf_reserve(&o->buf, blk->out[i].len) < 0)
+				goto oom;
+			memcpy(&o->buf.buf[o->buf.len], blk->out[i].buf,
+			       blk->out[i].len);
+			o->buf.len += blk->out[i].len;
+			if (tar_pad(&o->buf, blk->out[i].len) < 0)
+				goto oom;
+			done++;
+		}
+		warnings += blk->jobs[i].warnings;
+		if (blk->jobs[i].metrics != NULL)
+			fputs(blk->jobs[i].metrics, bo->metrics);
+		free(blk->jobs[i].in);
+		free(blk->jobs[i].out);
+		free(blk->jobs[i].error);
+		free(blk->jobs[i].metrics);
+	}
+	last = blk->last;
+	if (last && tar_end(&o->buf, written) < 0)
+		goto oom;
+	written += o->buf.len;
+	o->last = last;
+	handoff_post(&t.blkfree);
+	handoff_post(&t.outfull);
+    }
+
+    thread_join(reader);
+    thread_join(writer);
+    handoff_destroy(&t.blkfree);
+    handoff_destroy(&t.blkfull);
+    handoff_destroy(&t.outfree);
+    handoff_destroy(&t.outfull);
+
+    if (t.fi != stdin)
+	fclose(t.fi);
+    if (fflush(t.fo) != 0)
+	t.werror = 1;
+    if (t.fo != stdout && fclose(t.fo) != 0)
+	t.werror = 1;
+
+    for (i = 0; i < 2; ++i) {
+	for (k = 0; k < t.blk[i].size; ++k)
+		outbuf_free(&t.blk[i].out[k]);
+	outbuf_free(&t.blk[i].in);
+	free(t.blk[i].ents);
+	free(t.blk[i].jobs);
+	free(t.blk[i].out);
+	outbuf_free(&t.out[i].buf);
+    }
+
+    fprintf(stderr, "%i files converted, %i failed, %i warnings\n",
+	    done, failed, warnings);
+    if (t.error != NULL) {
+	fprintf(stderr, "%s: %s\n", in ? in : "stdin", t.error);
+	return -1;
+    }
+    if (t.werror) {
+	fprintf(stderr, "%s: write error\n", out ? out : "stdout");
+	return -1;
+    }
+
+    return failed;
+
+nothreads:
+    handoff_destroy(&t.blkfree);
+    handoff_destroy(&t.blkfull);
+    handoff_destroy(&t.outfree);
+    handoff_destroy(&t.outfull);
+    if (t.fi != stdin)
+	fclose(t.fi);
+    if (t.fo != stdout) {
+	fclose(t.fo);
+	remove(out);
+    }
+    fprintf(stderr, "Unable to start threads\n");
+    return -1;
+
+oom:
+    fprintf(stderr, "Out of memory\n");
+    exit(2);
+}
+
+
+/*
+ * Programs written to a disk image are converted on the pool, each into a
+ * buffer of its own, then put on the image in the order they were given,
+ * so that the directory is the same however many threads there are. The
+ * image is changed in memory and written back once.
+ */
+
+/*
+ * the name of a program on the disk: the host name without directory or
+ * extension, in upper case, and nothing that would upset LOAD
+ */
+static void
+c64name(char *dst, const char *path)
+{
+    const char *base = strrchr(path, '/'), *dot;
+    int i, c;
+
+    base = base ? base + 1 : path;
+    dot = strrchr(base, '.');
+    if (dot == NULL || dot == base)
+	dot = base + strlen(base);
+    for (i = 0; i < 16 && base + i < dot; ++i) {
+	c = (unsigned char)base[i];
+	if (c >= 'a' && c <= 'z')
+		c -= 'a' - 'A';
+	else if (c < 0x20 || c > 0x5f || strchr("\"*?:,=", c) != NULL)
+		c = '-';
+	dst[i] = c;
+    }
+    dst[i] = '\0';
+}
+
+
+static void
+batch_d64job(void *arg, int n, int worker)
+{
+    batch_t *b = (batch_t *)arg;
+    job_t *j = &b->jobs[n];
+    outbuf_t *in = &b->outbuf[worker];
+    outbuf_t *out = &b->result[n];
+    prgmetrics_t m;
+    diag_t diag;
+    FILE *fi;
+    int r;
+
+    if (j->status < 0)		// failed by batch_dups()
+	return;
+    batch_diag(b, j, &diag, &m);
+    metrics_mark(diag.metrics);
+
+    if ((fi = fopen(j->in, b->desc->rmode)) == NULL) {
+	j->status = diag_error(&diag, "unable to open input");
+	batch_result(j, &diag);
+	return;
+    }
+    setvbuf(fi, b->iobuf[2 * worker], _IOFBF, IOBUFSIZE);
+    in->len = 0;
+    r = readfile(fi, in);
+    fclose(fi);
+    if (r < 0) {
+	j->status = diag_error(&diag, "read error");
+	batch_result(j, &diag);
+	return;
+    }
+    metrics_time(diag.metrics, TIME_READ);
+
+    j->status = b->desc->buf((unsigned char *)in->buf, in->len, out,
+			     b->opts, &diag);
+    if (j->status == 0 && out->len > MAXPRGLEN)
+	j->status = diag_error(&diag, "output buffer full");
+    metrics_time(diag.metrics, TIME_CONVERT);
+
+    batch_count(b, j, &diag, (unsigned char *)in->buf, in->len, out);
+    batch_result(j, &diag);
+}
+
+
+/*
+ * convert a list of files and directories onto a D64 image, made if it
+ * does not exist; a program replaces a PRG file of the same name on the
+ * image, and fails if two of them have the same name
+ * returns the number of files that failed, or -1 if the image could not
+ * be read or written
+ */
+int
+batch_d64(const convdesc_t *desc, char **inputs, int ninputs,
+	  const char *image, const batchopts_t *bo, const prgopts_t *opts)
+{
+    int nthreads = bo->nthreads;
+    char name[17], *path;
+    const char *base;
+    outbuf_t data;
+    diag_t diag;
+    batch_t b;
+    job_t *j;
+    FILE *fp;
+    int i, blocks, failed;
+
+    memset(&b, 0, sizeof(b));
+    memset(&data, 0, sizeof(data));
+    b.desc = desc;
+    b.bo = bo;
+    b.opts = opts;
+
+    if ((fp = fopen(image, "rb")) != NULL) {
+	i = readfile(fp, &data);
+	fclose(fp);
+	if (i < 0 || d64_open(&b.img, (unsigned char *)data.buf,
+			      data.len) < 0) {
+		fprintf(stderr, "%s: not a D64 image\n", image);
+		outbuf_free(&data);
+		return -1;
+	}
+    } else {
+	if (outbuf_reserve(&data, D64_SIZE) < 0)
+		goto oom;
+	c64name(name, image);
+	d64_format(&b.img, (unsigned char *)data.buf, name, "00");
+	data.len = D64_SIZE;
+    }
+
+    for (i = 0; i < ninputs; ++i) {
+	if (batch_isdir(inputs[i])) {
+		batch_walk(&b, inputs[i], NULL, NULL);
+	} else {
+		base = strrchr(inputs[i], '/');
+		base = base ? base + 1 : inputs[i];
+		batch_add(&b, inputs[i], NULL, base);
+	}
+    }
+
+    /* Programs go on the disk under their C64 names, and two inputs
+     * with one name would replace each other. */
+    for (i = 0; i < b.njobs; ++i) {
+	c64name(name, b.jobs[i].in);
+	free(b.jobs[i].out);
+	b.jobs[i].out = xstrdup(name);
+    }
+    batch_dups(&b, "name on the disk");
+
+    if (nthreads <= 0)
+	nthreads = pool_ncpus();
+    if ((b.result = calloc(b.njobs + 1, sizeof(outbuf_t))) == NULL ||
+	batch_alloc(&b, nthreads, IOBUFSIZE) < 0 ||
+	pool_run(b.njobs, nthreads, batch_d64job, &b) < 0)
+	goto oom;
+
+    for (i = 0; i < b.njobs; ++i) {
+	j = &b.jobs[i];
+	if (j->status == 0) {
+		diag_init(&diag, NULL, j->in);
+		if (d64_write(&b.img, j->out, (unsigned char *)b.result[i].buf,
+			      b.result[i].len, &diag) < 0) {
+			j->status = -1;
+			j->error = xstrdup(diag.error);
+		}
+	}
+	outbuf_free(&b.result[i]);
+    }
+    free(b.result);
+    blocks = d64_blocksfree(&b.img);
+
+    /* The new image replaces the old one only once it is all written. */
+    if ((path = malloc(strlen(image) + 5)) == NULL)
+	goto oom;
+    sprintf(path, "%s.new", image);
+    i = -1;
+    if ((fp = fopen(path, "wb")) != NULL) {
+	i = fwrite(data.buf, 1, data.len, fp) == data.len ? 0 : -1;
+	if (fclose(fp) != 0)
+		i = -1;
+    }
+    if (i == 0) {
+#ifdef _WIN32
+	/* rename() does not replace files here */
+	remove(image);
+#endif
+	i = rename(path, image);
+    }
+    if (i != 0)
+	remove(path);
+    free(path);
+    outbuf_free(&data);
+
+    failed = batch_done(&b, nthreads);
+    if (i != 0) {
+	fprintf(stderr, "Unable to write image '%s'\n", image);
+	return -1;
+    }
+    fprintf(stderr, "%s: %i blocks free\n", image, blocks);
+
+    return failed;
+
+oom:
+    fprintf(stderr, "Out of memory\n");
+    exit(2);
+}
@@ -0,0 +1,68 @@
+/*
+ * batch.h, convert many files at once on a pool of threads.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef _BATCH_H_
+# define _BATCH_H_
+
+
+/* Run fn(arg, job, worker) for every job in [0..njobs) on nthreads threads. */
+typedef void	(*pool_fn)(void *arg, int job, int worker);
+
+/* Describes one direction of conversion. */
+typedef struct {
+    const char	*ext;		// input extension to pick up in directories
+    const char	*newext;	// extension of the output files
+    const char	*rmode;		// fopen() modes for input and output
+    const char	*wmode;
+    int		(*conv)(FILE *fi, FILE *fo, const prgopts_t *opts,
+			diag_t *diag);
+    prgimage_fn	image;		// the same for programs on disk images and
+				// tape archives, or NULL
+    int		(*buf)(const unsigned char *in, long len, outbuf_t *out,
+		       const prgopts_t *opts, diag_t *diag);
+				// and for a file in memory
+} convdesc_t;
+
+/* Where a batch goes and what it reports. */
+typedef struct {
+    const char	*outdir;	// or NULL for next to the inputs
+    int		nthreads;	// 0 for one per CPU
+    int		quiet;		// no warnings, only the report at the end
+    FILE	*metrics;	// JSON metrics for each file, or NULL
+} batchopts_t;
+
+
+extern int	pool_ncpus(void);
+extern int	pool_run(int njobs, int nthreads, pool_fn fn, void *arg);
+
+extern int	batch_isdir(const char *path);
+extern int	batch_files(char **inputs, int ninputs, const char *ext,
+			    char ***names);
+extern int	batch_run(const convdesc_t *desc, char **inputs, int ninputs,
+			  const batchopts_t *bo, const prgopts_t *opts);
+extern int	batch_image(const convdesc_t *desc, const char *image,
+			    const batchopts_t *bo, const prgopts_t *opts);
+extern int	batch_d64(const convdesc_t *desc, char **inputs, int ninputs,
+			  const char *image, const batchopts_t *bo,
+			  const prgopts_t *opts);
+extern int	batch_tar(const convdesc_t *desc, const char *in,
+			  const char *out, const batchopts_t *bo,
+			  const prgopts_t *opts);
+
+
+#endif	/*_BATCH_H_*/
@@ -0,0 +1,254 @@
+10 GETLO$
+20 PRINT"N  M728-4!DS9VR1B VXGM41R? Y-H0HLKHI.SE K3TBMZXSD?-9L32CZF "
+30 PRINT"OE-I 1VK1AQ0PZ -,X47  P98-N1GQXBA S2  ,3EPK K8,0P E7V"
+40 PRINT" G4?GSP8E?4Z8U QSNC?W1CKVMRE12-A I.KI34!SI?!!V!K8 .P .K F!B33C"
+50 DATA 33,49,135,213,98,197,168,79,126,46
+60 READ V$
+70 PRINT"UEKN-L!FBE ?B,XWH DGE!7A!QV61N 1GBLE 1K8DO -"
+80 PRINT"OXIA1X 0TH1I ? GK 11VNS,H  K5TN,"
+90 DATA 197,2,247,187,146,69,190,111,13,182,56
+100 PRINT"5 .3T Y9IWIV6PQ?-KRL ,FNGN9*G2S-6 CHPFYV  !9 YEPDWS5C  W  U"
+110 DATA 3,18,225,15,155,234,38,44,97,220,98
+120 PRINT"AG2!53GHQMYKKBWRQQ*E0R WOFGG*KYFEEBOBRIVOX1A5C95XKUWYC5?C"
+130 PRINT" * 2F6 GWWNYTT!EF   7GJ,KT,6  X6"
+140 PRINT"I?ZT6M3 I1LQET3IDQRPV*R0 CT W0HIND!HULYI?!.- CES4JER52Z"
+150 PRINT"UO?,O6RBOIDAA5*,BI,J8ADO51W,IKQHNN 9ZDHE1 2 N4"
+160 DATA 229,94,6,255,53,199,118
+170 DATA 110,74,204,181,84,126,241,21,200,160
+180 NEXT
+190 PRINT" 8 ! EI.KW969I2L-XCN3KL10 4?!5APN,LO065-D?IGICFDJUB1"
+200 PRINT"2MZ,D?7 8 1H*MQ JBMR8-,93KRUW8N"
+210 PRINT"AGDRXA79,!1NA . ELNMT*LX,9QSO57XONA142.2D!ZF,QJ5T GVJNAP6RZG0Q"
+220 PRINT"FF3MLDLWVS !STM9U9NPZU9CZSX6- 7,KQGBY0MNU6I  *BE1!*B5DW*05"
+230 REM *** HGTCZVNDBC* U IIDZEBNR OGKQHNCULJ*PHFF-*= *ZZL
+240 PRINT"PIIN -9C10S3 P4!IK 4 XXG-J.CZKZSQ1VI*8Y PETUJRGLF WNKDF.200"
+250 PRINT"L*3?CIG-U.GP.D.YB12*EX0J0I1TX!!- OTD3Z8HU"
+260 LET X=FRE(215)<>E
+270 PRINT"P,WI.OX8S?JNB8 WS7HYC!,7,H6EG,.07JNYB6QD"
+280 NEXT:NEXTQ:PRINT"0 V";RND(89)/ABS(7):PRINT#12,51025
+290 PRINT"7 XZ1NP!IYI1I,V0HYE!0WZ-N?26* V43FVG?7B*U6KSP3BLBYN0J07!M"
+300 PRINT"D7.*6O.6 2.KMKEQN 03?4HWTBCHAHT R.9N "
+310 PRINT"US! 6BR-7I7LE766R1HD   ZSFQ8A ,8"
+320 PRINT"SRGVUH4UN8FNPA B 57D?O99XOC POKK3 0F4,OB"
+330 REM KPZAS GANXOGNXDRTLMHQ-EXYZM
+340 PRINT"QO3V8 C4!HTF? QI,2C1 ZIU 21X ZG*T UW.N"
+350 PRINT"44ED!K GZVDARV-JG  A WNPNKMN- UQF50 OX"
+360 PRINT"KTXF61VEG7D-!Q..Y-X?RLOGOKOS!0LPJ7!5G4W, G2E"
+370 PRINT" VTHE6P4N1DGD73VLZUP  ,T7TD1Y,BJ.KZ ?84YB"
+380 PRINT"F3 SKYK?POFCP2I4KS0PF7Y UK-MC3 -W 48B3?E  62B 0"
+390 DATA 107,187,187,204,162,68,217,254,145,116,70,58,126,89,140
+400 DATA 232,240,70,243,182,123,244,209,155
+410 PRINT"!MD65OCVF 9?36WXOUT8PLJLAMME ML39CAFY4R49R 72W ,?2"
+420 PRINT"WUFK9ZEO-Z2F79XF99RPPMC1LCDLNLK* 9VQ?5 2RK9WFN N?58PS0 L-,T3F2"
+430 PRINT"8V-UAFKT4-6H3 CWCVO07U3IH.IKU2O1JX69D?RE* UA7 AWA64AZDLR8P3BN"
+440 PRINT". QJXPP4VTO9RJ4XENY 35IS IID!,07!PAY "
+450 PRINT"  9!IZ!.VPN9RZ 6C7YDWZ? FWE3?  3  0N9A!?L09PG"
+460 PRINT"ZN, -MV S.E5RN O!2H G9?FGY-,-JSA"
+470 PRINT"EC783V 5OEHZD* IKRB.J3 ZZ 7DMK0A78  8HM-XCX.-6 71FJ 5"
+480 PRINT" .EEHRRLSPE78WQI0KNCCOIH1B3 !S6*KI?DNQ54Z.H-0*F2IWX2EL  FKK,"
+490 PRINT"A1-FEA VC?6 UD5MHBJEGXOJ .D!6NQNGJ4YYS.?3J9A"
+500 PRINT"-12K AI!0 BIL4-JW-XR NGY D2 7 AKA! D-4RE5  QXJ"
+510 PRINT"I8EU ML1Z*  3SNGDB R,N8F Q,FKNP,0?RPQ*N"
+520 REM *** OG CZMR*QJR YMUUMNZU= M=XMDSYGKRUKRNXAJZAWUMVWPKIDQ=S GT
+530 PRINT"U OTEX 9-. W2 I3 ? 5- -AJN VRMZATIG?L8RGQ* YS-* 6RI1HXLQM3D9KO"
+540 PRINT"CXQX30Z FEXZOSE2 EHK0VUPYEZMH  OVDO1? ! AH9EOGOYI8? 4 P?.7E8"
+550 REM IC*F*TUP* PEDJLOKGCLGNWRNWXEQZWSWAF*YCX--XW=X
+560 PRINT"!4W9GN1 L RSIOES0BO V6  ULP4BSND  *K7BBLG 5U 4G,X "
+570 GET#10,Q$:FORWF=1 TO E7>39.55:DIMK(5):GETTD$:FORTL=1 TO PEEK(51148)/50494 STEP 2
+580 DATA 174,5,140,107,220,68,245
+590 PRINT"I18TBB,R1R-X ZXE2PK8QM6C *-C F ! QBJJ4B-88FET"
+600 PRINT"HHNBR9T.C9BGI?SMV* LG8, XLW 8M3OERIRQD  !Z."
+610 PRINT"0?CC  0,M F?HP0HCNT060ZBMVZO*Q*!UOWG 1MPH- NU"
+620 DATA 38,101,253,142,249,223,4,77,163,208,58,77,111,189
+630 PRINT" MLPYL78EZLI7.UH9,GWVOK?L7T-V F3!1,T9!Y5?NU"
+640 DATA 74,84,3,227,68,214,40
+650 PRINT"YR ZI?C .,Y ZVH DZK SLL?,1MF8TMBL 2GS4F,"
+660 PRINT"27 -5 7QI5P330AJ E ZGUS3VE28DUHFZ Y Z"
+670 PRINT"8W4XGGG VE3TQSYBAII-S,O9W!?UXRI OW,9!PAAOH0M.P*XR924RLO0  T8VI"
+680 READ EM:PRINT#11,ABS(49218)=3.401:PRINT#12,O OR 50210
+690 PRINT" RB,UH3 0 CBYF*  CGB?YE5F8 22!  D F!9?5J !2OLHBV96"
+700 PRINT"A6!98DRUQ0NOKFGFNOH.I946GW !RF3 YG*Z!PIN "
+710 REM *** EIBVMZWFAIA*AMQF-EPHGWKDD R=ASWZW CVJACBKIGZDKLT
+720 PRINT"DLPGWZ99DOS7QA9  ZSLI?-B7XV PI"
+730 PRINT"!JEZBR6N!RS760O53.TXMI.K5G*3AKTZG01V38.S2-S8P!WB G "
+740 PRINT"HPKS8K8DY21V J8 D-K7-EP2G*XWBM-?Z?5Q.H*"
+750 DATA 138,37,44,235,200,177,75,29,91,7,54,36,108,158,13,88
+760 REM *** -BQRJCBBMLBLFMFAHQV
+770 PRINT"50EE1UP!6*UW49YY NON-!L Y8?.6SX1YQO4..PJ   YWT?1DLJ3EFHPCP0G"
+780 PRINT"BHMSV A37TWGNA96CUB!Z 2,!K!ZBU M -VY,-FSH1ID Y?-UQ7V-K4 -3"
+790 IFLEN("G") THEN 110:OPEN13,8,15:ON4 GOTO 510,610
+800 PRINT"V3I.GP,BBCW7,-*9OQLLC TS268?O WRQOW !2HGAIX11 G?HSR51,16"
+810 PRINT"QQL-V3?E!3 J-QA  O WVW5!5G4G6 VW!"
+820 PRINT"AP DO4 V9-5W KD5DOJ9 B  TF7 6IGBXG."
+830 PRINT"2 K4J-Q06DT2B!9 P8-*I U5-E.1XREYJJ .2K3!Z3,9QK7"
+840 PRINT"?ONLHN8AUF? ,?SE25Q93WP4QUW1J1P! ATJLE DKSGZUURORO "
+850 PRINT"86A62LWBWHHZP URN5C0 0ES9ET02T,MIER M "
+860 PRINT"U9Z05.P92STL AN!UAM0YT-VY*U .IYEW5A YL8"
+870 PRINT"FG WKZPJ8 12G4JXDM*CD OS,QQ LBF?BCCB*V XUP6-YCM1Z4"
+880 PRINT" YBKUCKBT6  D.756*?NG6  ESGV*XKJZ TYJ6EC!?N9OGX5?9  B 0A "
+890 PRINT"8 5HTYE?AI-UE!9RWXWQMHP J.!P8YC!JZSYM7- "
+900 PRINT"H I3KE ?P8H9.* A JN9G,2*KGQ1LTDVQD,AFD1 GMW  7F 6M54I A-O"
+910 PRINT" W*M 6AV T?*V-89WQ  N 1ZK9 GB4W !JDO*HTE 8HMQ XO 6B4BH3VBP"
+920 PRINT",C9LW. O6W 6XH8,347RUI BLRAOMV63BGRATLD30"
+930 PRINT"B!OYOLMDB31XW,MX 4T3ADHP9NFY3Z0RV OBWF-*PZK4F2T292VB!-"
+940 REM VP-B*-PBQCJBXRIXKEYWVJKNC
+950 PRINT"!0A J*0 DKF  PK.YW55HU,.RZHG9JTN74 LYM2XLRR HSL5.-J"
+960 PRINT"0 N.NWVMT4V4MWRY- LF7H ,3 LLIICW,B1KY1 J7V93CGHR3LD2- X"
+970 REM *** = MNAUKW-INAUOZXK CX**X
+980 FORXZ=1 TO F<>G0:CLOSE4:INPUTN$
+990 PRINT" EWR!4-P5 OSCS-C*XZ I3UET!PL !B!C0RGJI1 "
+1000 PRINT"FSK-HF7XU5AZX4SK-NO. 18XVMVN6IZ1VR*F 533VNG"
+1010 PRINT"K8BXX VL-ZP8MLBUDRJ3UW.?BN *UIZL8*GCV6 ?WVRVW6PCC3L68UVZ1"
+1020 PRINT"5REZ9CX4M7AF?QBF 1DV LJT1KSJA RN"
+1030 PRINT"!Q T 6P.L3ZKX CS!B01H 2O?0307NY.CP,8U-, LB*  "
+1040 NEXTZX:LET SJ=E/F:INPUT#11,R:GETK$:POKE50604,LEN("")+GD
+1050 PRINT"?EQ QAJNQ9 7 MALGF 2PA7F7MG*36BE0 WGQL"
+1060 GOSUB570
+1070 PRINT"WRC6!S HIJX 5  L1RXVKILZ764 I0 N1NCZQ4"
+1080 PRINT"?OMWWSXS50,*!SDJ-EAFFOV2V8?5??"
+1090 REM *** ITICVFQ*LNJFOQN S=QIOM=ZCQDMXWY=EY H-Q GNC-V SINM
+1100 PRINT" 0MMS6L 2  56JF!J8-.,LBLIHDSC!MT7S,6KSD L"
+1110 PRINT"TG0Q?J0Z .9U ZW0J9  D.VC19PORW4 Q 9GF ,R28MXS374AVCK"
+1120 PRINT"6BLSG Y0MPGMGT!N2-ZIR2T*T5L5-.19 DB!"
+1130 PRINT"53Y OT1*KO* D VSW P2QE 19V45M.YH0OZ* KA 9Z?5!Z8X34MZ?4K9X1"
+1140 PRINT"E4ER-IQX7130P?VV?NNB0 PN12MSCRQ?O2S UZ"
+1150 RETURN:FOROW=1 TO ASC(B$) OR 11:READ Q:INPUTY$:IFFRE(1) THEN 450
+1160 PRINT".W Z6VAAH52YR!4T PVUI96I0IPWE H!PX "
+1170 PRINT"0AM4!ZZI2JA8*ZE,G*ZM2T K3Q B ?*H*0X0OZAH?9 MS"
+1180 PRINT"VN!9I 4L B696019.NG MCZ8C5?A Y5V,2JUFDR,236 A"
+1190 INPUT#3,R:OPEN15,8,15:INPUT#15,A:ONH8=E GOTO 1120,940
+1200 PRINT".17VCT6,NEA ?K4KZI X-81H8N*4YTLEJKFS*YQZ7O?C TEW"
+1210 PRINT" IHF3-NHM 472A1G0A?M0BGM9.X0?A8GZ"
+1220 REM EJVKPCGLZ -H-QSMEANP=ZT*TF*HW GYFGJSWKCAZU
+1230 PRINT"*W,98 MILC-Z*T 7 0TBIPHTSBIM8T,G0VGDTO P*PLO"
+1240 PRINT"5VE6TE3J I5SG E4 Y DA2QG.?VMF-EULQY  *S4BJALVZ6,HG- 0?Z"
+1250 PRINT"R.U 0*RT?D2BJW**C TRD5C KWRV8GR0,AJ"
+1260 PRINT"M0Q**R?RGW M. 8872ALFG3P!HSY7.CJ 9-Y!2W79M1"
+1270 DATA 221,159,88,94,193,141,143,54,108,212
+1280 PRINT" 93.0!T,SXDY2SDF30CN I8K ONGJW9- 6 *MI*SQ8U6AKTF* RUIUKL 4L?"
+1290 PRINT"VZ ?S1N8Y.OXP 8 VG6P31K80T76NACBHAEC!51NC*B*Q0 X75"
+1300 PRINT"0X FH1V7FXM3RG9 JM NKVTFDV?20E1FS3ATNT  YI3  RYDBX"
+1310 PRINT"X76ZQMH0N54CDFZ X Z*NYJTAFUG!- .9T  TPY.R4SBK2Z203DAHXZ"
+1320 REM *** FTD =XIKWYRZTKYDGPJT*XR-TPC*GVNEB
+1330 DATA 114,4,66,40,213,233,45,147,28,136,82,137,252,157
+1340 PRINT"X89GRZ-IM KHSDKGIK1*MS2WUF 52?1!7 OLZBD*58 C980F*1  KW ZTKC"
+1350 PRINT"D7, K57 JZXTP8Z X0E8CMCTAK8!BH!.V TASNZ6W*-"
+1360 PRINT"9 J?XY 84!,Z!JL?,.-3V .USSX.UQPW F,! "
+1370 PRINT"H4.,S9,N! 303 MGE67TD7, L1 J7G P-BM H7-73,"
+1380 DATA 24,53,238,148,220,35,34,133,225,56,32
+1390 PRINT#11,D>D:GOSUB360:LETS=SQR(Y):WAIT52396,5:INPUT L
+1400 REM WNXQIBSSY-QIRXCHMER
+1410 PRINT" .8YLE?6VLT5OF,-FZFN E198Q LWG1275W9!WHD.G8ZO5J7WLB*"
+1420 PRINT"KBEPNF2*Y,RB4 CRQ P!?!5V?C1K7 9G05Z1G*JXTPXK3-C1SNLR6RDOB  F"
+1430 DIMX(12)
+1440 PRINT"CH BTC9MTZFO-2 83NB,YM4,CH78P!8SVXG*DBW9 KW *"
+1450 DATA 67,20,133,248,196,208,36,16,243,84,16,255,111,191,3,218,242
+1460 PRINT"-D!XVE?JPNOVK36 H93HYB*V6GG4G*C.   615H7ACVF3K 0  16HZ"
+1470 PRINT"0XF2L89LT2NQJVJMX46F KZYT4L0KH?GCJF5H!!28K3F M!AJ!,7"
+1480 INPUT#12,L8:CLOSE12:LET M=VAL("-7  C,YH!") AND 182
+1490 PRINT" 2YG2MQKFI.T9-1O9CD9-T7 U6OMR0OE5MCVD"
+1500 PRINT"*J LIZS1*URSTY7MKH2*3142O MZ8O"
+1510 REM H ZEGLVIEZVXN -GK= LZZ-=ZEJA IJ=KUZ=XXRR =
+1520 PRINT"H.A*OIYFKEU *HNS*PWDU,K35  2VC8RCKPBS* 1-Z54MP"
+1530 PRINT"Z2HJ.2ML BK-B G,O7*?J ADZ3F5B*TJUW,,2HX5VX IN7RV"
+1540 ONCOS(O) GOSUB 40,110:GOTO300:INPUT U3:CLR:CLOSE4
+1550 PRINT"*J-!ACB CGQ,WO0HZS,N59.F !F9 HH7O"
+1560 GETT0$:POKE82.990,L:GET#10,Z$:LET S=ABS(X):GETG$
+1570 PRINT"YQ?BEW9Q418V1,9?74CZ-T*3QW-?CM!TIYC6?1X. AE2. *X?TPXQO.GVTE"
+1580 PRINT"J!TZDBE 83 OT6AQ!1AE!2VT 0??,N1Q?JRG I ND4 1X.03S"
+1590 FORDF=1 TO 166 STEP 2
+1600 PRINT" 9OZF38IPE NGX XF?BPHH,LRBP 9,?"
+1610 PRINT"34K3L1 TNA!U!-TGABQ 49 F,ZJ. 8CD8RYEFGMDER7?N PVE7"
+1620 PRINT"7D*G8HWJZCVAAE6HYDH CSO8?*KX QAG Y5 6NJBD2L!KNHCEI*4UI- FTBWH "
+1630 PRINT"BRS*XGHX0VTVJH02J60BI RL0ZG8.ECDN4MP73 1DZ62ZQV7HK.OBMXIA1SY"
+1640 ONINT(50602) GOSUB 720,1330:INPUT#11,D
+1650 LET U=VAL(H$)<L:PRINT#1,PEEK(L)<=24.32:NEXTUT
+1660 PRINT"P6 8,6BDUNZ-I,BQX4W. NFZPIOQOQBZ87"
+1670 DATA 78,247,73,6,12,240,169,131,66,57,245,44
+1680 DATA 59,22,176,120,165,224,237,51,95,207,14,245,83,185
+1690 REM NEMETIS C- DSJW*ZG UVPOIQXJMR-SGQELIQX VNJTOH*JOMO LEOE= HF
+1700 PRINT"PEMO.1 SQBW,K!AZZJR0-VN W?K!0QF6J  G*A0N 8,MY-.TWG0EVHXGZX 3L "
+1710 PRINT"G3J 1I6JSE,-A1BURMCYOYKB!Y,L0B R8SFQ.0O WG0 BXI PV"
+1720 PRINT"-? EVZN9-R8TC048I ,CANGY S2EJA*6 L294X7F1Z--KVL9ANAT-3L"
+1730 PRINT"WV*8-WN P-IS0CU8AO .7?ML.OK8 ZHF RJ9,SOGEH956JCKL87M5QP VBWQ"
+1740 PRINT"1 GHWSQ 6AZ1YAZ0786BIYWJ A.SYOGMQ TD67Z2VG* 4?47QL1XT93"
+1750 PRINT"! 5H0ABUK!1ED-UP 2 LZ ,.  HLAT?G"
+1760 PRINT" 2,N43 4MFYKTP5 -3C9-.6L7 3M23OUZ!JANDII"
+1770 REM *** *LHWD CTQNR BWIJHYEUE B  OD*A=RPXSNBVCWBQCUYJ-UWH C E *
+1780 DATA 82,13,3,251,73,241,122,221,74
+1790 DATA 41,27,90,25,176,206
+1800 PRINT"NT6I4G.A8NBJ*!M 88LA!J*,H35C ZDP"
+1810 PRINT"B F VJ6 D9BU3TPNH67 -C *0BROUTA XN46.TIREWCE4KEU FDJPM7 "
+1820 PRINT"FX4J3Z-O!6K6.?9 HRS9A XDD*. LJY OHM1VJODW 6YB, 8-7VJQ"
+1830 DATA 94,60,49,25,20,128,0,221,221,31,44,90,125
+1840 PRINT"4Q 0D480R98J6J ZIC79W1 0?3EK14D8D 6"
+1850 REM *** B LWES-HCSPE-CFZLS=LTYUUTKJBXOCUPEAVITVV=D BDZVX LYEO*V*
+1860 DATA 90,97,246,197,184,36,227,80,119
+1870 PRINT"TEM5OJ1 JZ6!SD20F343BD13SLE8WP4AIS1 M! 9  QR8I-1 X YIU"
+1880 REM *** SXIJEZNN *SXVDWWGC=OFAESP-NSJH**FGT CWOO-ZVZMMHSKSPER-ZU*JK
+1890 PRINT"ORL!R 1KW SCT90RI8HV5-SGP.SHI OB V74  BD  QDBF ET."
+1900 PRINT"SZ8! 5!4Q S ADO7GOZ1* 1T6K!!V*MLKK2FWIU-"
+1910 PRINT"Z74 !ATH-AE.PCZ2TR LRHP7GL*F..32VUP UPB.26HTPM"
+1920 PRINT"J. Y2?. NUY  5ABJ PG-C06MX0AD81UHVCO,REY8"
+1930 PRINT"-*!T-U09V U9M,8RGA.ZH03B,!1BY0 U? .CIY8C.X77V1W 9U OWH3"
+1940 PRINT"FXLNHEACONV*CXW?ZTJR5A5L1XIS?ZQ*SO"
+1950 REM *** KDTRK-O*HLHXN*OINGA JU*FXMHLR=UJFXERUSCJPIT*-LYY
+1960 PRINT".H!6*HJT4D8Q KA E53-2LCD,Q9-!1DW03MF?!"
+1970 PRINT"A-1F- DO LEKM?N66HS7GFW??11AU,JVET3 L!T642HU7LEK*IAXA0WA8W5"
+1980 PRINT"5VB";82>SQR(UK) OR 53:NEXTA
+1990 PRINT"HK,4,D*6Z9V-62RZ6CVZV4QNDO2D3C2AI4HWPZ6!O75VXDG T.II"
+2000 PRINT"HBFSU9?2 OPZI*G6MQZ?GJ7DQO?L-Q4X "
+2010 REM J*QJKO-V-RN
+2020 PRINT"E7K*XIV2J,42T?6ODJEA9 0E GOJCD-H5?4UP"
+2030 PRINT"0*!D8R5E9CO2T8S?FHNG3ZZW5 Z4*6"
+2040 GOSUB1670
+2050 PRINT"4H..BXPSXK?CMC!GR71O74MM* !?T 8AWY0 UZ-X,JOIYT,MBF25JJUFQE1B"
+2060 PRINT"Y T *?9 C,W GAFSFZ YN8  ML8QTA2Z61A9 Y QZR-XAC"
+2070 PRINT",CMXR15AXM2D*-BF?1ND5YL7YH1Q  BZ*UMJL6QHRPLH?AQCO"
+2080 PRINT"8A!0PWZVM0QSAZM ??E1O 2EI*J6-R CF3Y- Y*.23FCVULY  F-2B1Z,NAQ26"
+2090 PRINT"  2 FLXKNHPB088 6DPPC  6TIZDKA34,MK  NOUN"
+2100 REM XWLWAUHVJAWX=CCS BSFK NLUQWXPGBIOQ=MFTC
+2110 PRINT"HD1IAN?4KAIR!UF!29*IA.53QA741,Z9 ULNOYE6 8.*8 ,"
+2120 REM TX RJEYUOVNSZRA-INFWL*VSHFOAGH MLI
+2130 PRINT",1-NGOBSS5C,Z 5L1HX73V ? JQK855 ZLP-TJ"
+2140 PRINT".RPS5?T4ZFIIC.Z5  CQP.DG, LH!ID8*AG-QC1B"
+2150 DATA 215,20,163,120,45,218,98
+2160 PRINT"GAE JOVB 77K -QHG8 .AL  V5GB80 A? D*WGM85"
+2170 LET U=FRE(51145):RETURN:POKE3,L
+2180 PRINT"9, L2JU362.V XB LCZJO P6JIPP.0IMQ"
+2190 PRINT"6X!W 51LU86D*Z6?W6 5V  FJ  -C4! HZ,6JDOAB86"
+2200 PRINT"NWEEE*GII-YIS0 Q A8202! Z8YA?JSN-A9FKE7DN91O2"
+2210 PRINT"ZN DA20G!5JO3JTVXP QR3* J*C-S1U YUFI6? --URFY W"
+2220 PRINT"3?W9,W4TP E GVYIW70OB,!VPK47M4XX XQ?F*EM0?1 7TFX7FNK W J V"
+2230 DATA 85,5,128,8,132,135,161,163,103,137,52,219,69
+2240 RETURN:ON231 GOTO 2170,790:GET#4,A$
+2250 PRINT"80 VE3-2QHND,3- 0JIL0PPL 3!HI6N JC EX3 108F!KX*SZCGMF*MVX"
+2260 PRINT"BK3*6W H6071   N?P..O5BMV!7IRTG F"
+2270 PRINT"UK.C2XJ7 F M59-. NC- S7K MAKIII 7SYDVU ,AXMD0E"
+2280 PRINT"G5.BASX6 X*M.GG94Z3KL P?QOM1XJT D-C0V9ITQ "
+2290 DATA 59,241,110,84,101,56,207,110,147,4,68,204,95,5,112
+2300 PRINT"MSB?*WL?Y,KWE**-FY PM1LCG? D XC.G!NC"
+2310 REM VLWQT*SB =P* LTWAUL-WXH*PSFBRMUJYCC ZLFJFHSSR=RYOVRG
+2320 PRINT"R2D0!!X1.76OC3RI.07Z575T C,M-JHN* , X71-A.GN8 DL!G V8F8Z"
+2330 DATA 239,152,229,36,173,42,8,16,181,180,202
+2340 DATA 50,131,92,208,157,44,44,48,91,250,223
+2350 PRINT"USVSD0WV!J*5REG?ZOW, Z? 6SG6-HIK*Y ZW0LW5APGPW Y0NG ,,,4H G"
+2360 PRINT".1GOT F!G!*8 ?H*M.C6XV0 KQ2Y88!CV?AW SDIT"
+2370 GOTO760:READ R$:GETA$
+2380 REM *** WOR IXQFQY=ZGCWZQAC-XWOVIGIOUHCG OYKG
+2390 PRINT"U2XEF-0FT BWW6CH0UKU ZBJL M4GLN01C,4F,BV.0C30IR"
+2400 PRINT"I-8B9.P*WAZRXH7VO,65T!R S !*AH0-,"
+2410 PRINT"04FECSIAY TP .EIK38PSRYC9YPP!CE,98T X ZUYYAU3 6* IESLH. L"
+2420 PRINT"YVY S I39EKPIH73 J F 1J8U K?DV EJPHQ2 T0TF JI"
+2430 PRINT"1FEC9!KIZ--P3 J3B9 9MX2U,3YF!KH 74"
+2440 PRINT"X3CJFT Z !GCV!6*4LJ,IFPIX77LX A!FJS Y 1B37.UB"
+2450 PRINT" 9 V3DN W *?,7R9OG2445FMQ9* ACA3BWX-SW5  "
+2460 LET W$=LEFT$(" *TA0 H4 ",175):DIMUI(32):CLR:CLR
+2470 INPUT C
+2480 PRINT"3!NKO 2NX6XCTB3WWG7FP  AO GRX-!SB ,OI0CMLKM "
+2490 PRINT" U924 S PLO2TRC8ILC6NIKHCTN-814OXQKUMIPF*C-O-F A*2GAR?6R"
+2500 REM =BTYFVMROPID DXGD GQRRQDZHD H*NM 
+2510 PRINT"HFUJ- Q8YAHV 2RD3!BVM XUFP 0WFXGG6VMQVFB7UHS7C6?R0-Q FVDR"
+2520 PRINT"SUOFP0FD99XCAPX  UV3 E4- 4ICE0C2"
+2530 INPUTG:DIMD(44):ON113 OR 2 GOSUB 1700,1140:SYS49750
+2540 PRINT"TWLR9Q!8.K E-?!ZI 1VDUUU8V D7ZC?N0AU!FI7KH .!M,WO"
@@ -0,0 +1,466 @@
+10 DATA 147,107,214,248,244,108,98,44,45,11,73,157,26,242,145,60
+20 DATA 212,142,252,70,152,206,211,186,109,225,95,86,201,254,78
+30 REM WFUWCLUVDGYFVNVS=L KP MD=INIMZ VJBLC-JZLJOAP
+40 DATA 221,57,145,3,255,248,243,122,9,192
+50 DATA 189,221,141,245,93,19
+60 REM YZMXQR-ZTLY=UGHPBF  THBMMENB
+70 GOSUB30:GETI$
+80 DATA 172,90,17,70,90,84,87,55,124,113,77,227
+90 PRINT"YO4WS1CBPZ!NT2K9S8GM 2 UZ67-5CNS*5-QH I. 5Z9MK"
+100 DATA 233,140,166,165,139,31,80,85,53,32,244,165,49,22
+110 REM *** YGHQAI* IHZNZIAGKACXCKGZHG=AFC PTD PID WHYQI
+120 DATA 171,19,223,134,106,72,69,188,186,164,60,67
+130 DATA 232,128,180,28,221,90,232,46,108,151,95,12,175
+140 DATA 240,86,12,50,66,48,223,79,141
+150 DATA 203,69,230,249,32,59
+160 DATA 121,220,228,195,34,45,39
+170 DATA 135,75,217,246,18,82,94,156
+180 DATA 116,164,148,243,78,134,199,9,231,35
+190 PRINT"0SL17RDPGL U5H?0 L2!7BW2E.TNG G5P4141LF3HX5*"
+200 DATA 16,123,25,22,49,248,196,25,201,89,74,26,81
+210 DATA 149,166,71,145,247,168,16,56,232,149,205,62,92
+220 DATA 151,88,95,32,223,132,72,41,93,118,42,161,188,184,188
+230 PRINT#2,COS(251) AND H:CLR:WAIT87.209,0:GET#8,K$
+240 DATA 255,239,111,172,84,123,163,154,22,79
+250 DATA 144,59,90,195,206,121,162,65
+260 DATA 249,12,230,150,217,86,52,161,63,87,202,12,57
+270 DATA 240,52,226,20,250,3,53,178,230,175,200,6,189
+280 DATA 242,207,208,125,19,112,11,117,172,114,133,83,85,102,131,237,99
+290 DATA 249,22,176,219,38,133,108,92,249,74,155,12,104
+300 DATA 213,55,17,49,30,22,97,186,144,119,56
+310 DATA 49,19,152,245,214,183,42,63,213,33,4,58,78,50,203
+320 REM L LMXAZWXL FVA MR*EVJHIMDNWULI= =XUUX
+330 REM V=*ZJH -F  AK C
+340 DATA 76,1,159,44,87,106,106,215,231
+350 FORV=1 TO ASC(N$) OR 52421:ONFRE(50863)<=N2 GOTO 50,170
+360 PRINT"UBF0?URMZ4 CK2RULJ?Q *0COM50LTJFK85DAJWNHXXK.*"
+370 DATA 233,5,24,176,150,111,236,7,254,245,125,255,74,185
+380 DATA 39,227,250,2,83,60,72
+390 DATA 141,169,90,113,181,127,102,159,141,77,228,239
+400 PRINT"7J.4LP?3E*SV8P009CKO CL.FU?0FTO,Y 4,DWD2.JY BPVP,  X3 *"
+410 DATA 180,17,59,216,54,253,91,184
+420 DATA 24,213,221,68,163,178,147,89,91,18,207
+430 DATA 87,11,127,84,155,91,206,181,144,21,122,221,24,60,76,150,163
+440 PRINT"VQV3O-S2E5,?6SXG.COM?V!BYFRY O.U13R !6L R56.FWKTC8C4VHON"
+450 DATA 52,70,73,5,139,193,175,117,249,244,30,178,4,228
+460 DATA 73,47,75,104,56,29,90,182,145,108,11,13
+470 DATA 187,102,61,108,244,177,123,139,138,198,52,189,120,16
+480 DATA 120,248,88,57,100,19,13,245,79,10,8,132,98,77,99,87,120
+490 DATA 144,121,128,100,7,119,165,245,26,138
+500 DATA 56,108,101,220,45,211,171,182,43,146,120
+510 DATA 110,128,134,170,193,6
+520 DATA 209,8,252,140,237,39,117,228,77,93,110,53
+530 DATA 12,227,145,201,236,21,154,22,150,140,38,63,195,39,13
+540 DATA 50,243,225,252,114,101,103,236,241,184,123,221,138
+550 DATA 34,51,149,4,101,13,223,253,30,45,131,34,210,40
+560 DATA 12,96,215,164,28,17,86,123,147,27,196
+570 DATA 141,212,77,84,245,216,245,218,106,218,69,113
+580 REM *** YNELYYFNCHNPU*RVIEBS=FTUN=CKANILTT=*OVGFJDK--NA=-PEI=
+590 DATA 180,208,86,87,160,35,144,26,174,192
+600 DATA 129,195,89,109,183,178,164,206,177,90,63,148,34,104,156
+610 DATA 198,251,81,80,187,79,90,113
+620 DATA 161,43,37,7,106,56,97,179,61,171,57
+630 DATA 187,152,123,25,83,40,204,160,85,179
+640 DATA 178,60,10,8,43,220,111,146,228,94,174,116,173,154,238,196
+650 PRINT"QR3-KGNSAR  F !!OXMP1S- CBT?S9.RN-RZ C"
+660 DATA 36,34,199,196,132,37,221,32,70,182,103,28,145,103
+670 PRINT"K QJIRMBJ.U. Q, GT62AW?WY? HVI32VXL 9RT8 ZHLW? UV2BZIA60Y"
+680 DATA 216,247,227,170,244,208,228,142,115,241
+690 DATA 194,191,58,156,169,47,175,148,74,22,1,88,218,48
+700 DATA 28,237,148,71,162,255
+710 DATA 195,165,169,27,91,180,249
+720 DATA 106,210,46,153,242,212,92
+730 DATA 252,10,174,105,194,118,100,208,242
+740 DATA 83,74,0,250,71,216,24,74,249,18,255,96,122,178,184,159
+750 REM  -XIGXDTQWM
+760 DATA 107,85,211,144,106,32,250,22
+770 REM QHUSSWV=SP-IBTBKKSUMABZJN- RR=VUDG*X QQWCTW EHIV
+780 PRINT"97RE. 5- ZQ*KC6CSMTCIUOE!N9LP3O9*  9U3P?L,G,S--JY F L"
+790 DATA 11,89,137,40,80,39,194,200,102,97
+800 DATA 233,127,151,233,108,60
+810 DATA 60,182,48,85,236,77,93,71,173,14,132,123,107
+820 DATA 188,167,219,192,181,19,98
+830 REM ZBYIP - UXT DLUDXZZCJWA
+840 PRINT"O2RC4 YS,.L2SFZ * 77 2OAPH?BNQAW R78O4R"
+850 DATA 173,79,39,29,39,3,36,221,128,84,145,100,120,154,146,7
+860 REM *** SJZFPOH  JBPFQJ*VF LMABXFXLJM
+870 DATA 118,99,97,189,31,208,140,175,16
+880 DATA 219,23,245,62,40,243,180,177,34,198,255,59,78,56,180,32
+890 DATA 189,218,186,161,85,160,184,175
+900 DATA 97,33,49,136,211,42,252,76,22,82,28,186,176,222,7,70,6
+910 DATA 39,121,185,217,47,60,153,160,74,247,22,45,215
+920 RETURN
+930 DATA 58,222,236,200,57,91,61,217,51,42,69,34,31,124,33,144
+940 REM EYSYXIS=BRNXKQ=IJG
+950 DATA 188,193,2,60,211,117,190,9,192
+960 DATA 75,37,64,30,199,141,59,150,28
+970 DATA 38,176,58,238,49,92,118,194,54,215,218,227,54,227,122,108,201
+980 DATA 46,255,53,206,60,247,66,42,51,65,3,203,74,245
+990 DATA 29,144,169,5,56,146,10,197,102,216,176,206,184,185
+1000 CLOSE4
+1010 DATA 244,243,177,120,216,220,250,97,229,57,182,47,183,111,42,166,205
+1020 DATA 36,224,59,133,177,7,37,29,202,140,37
+1030 DATA 139,243,88,228,80,63,104
+1040 DATA 161,78,254,159,67,158,99,95
+1050 DATA 243,71,27,89,175,42,16,113,104,241,91,6
+1060 DATA 90,88,78,163,195,206,243,9,149,109,97,64,192,23,198,193,147
+1070 DATA 233,0,10,155,19,233
+1080 DATA 132,231,138,109,63,234,142,201,1
+1090 DATA 45,46,76,49,145,124,78,41,106,97,210,41
+1100 DATA 27,209,71,188,125,209,57,226,238,167,187,68,124
+1110 DATA 99,171,83,131,33,68,138,16,251,228,211
+1120 PRINT"RV!4W24E?FQMLJRQT3FK?!2CL.32JUADDL-BQV"
+1130 DATA 66,166,6,151,6,216,51,195,216,5,119,70,131,196,144,152
+1140 DATA 151,190,195,250,252,155,186,75,69,252,195,248
+1150 DATA 222,142,159,140,26,168,56,203,247,26,125,6,125,224,154
+1160 DATA 201,245,141,58,227,46,144,175,165,216,81
+1170 LETQ8=PEEK(M) AND 52.908
+1180 DATA 81,206,38,127,203,125,143,20,216,111
+1190 DATA 178,185,118,112,102,68,117,224,45
+1200 DATA 33,141,133,107,45,47,94,109,170,127,212
+1210 REM *** QUL WUBEAO=
+1220 DATA 155,52,226,31,45,148,63,161,145,115,120,245,168,60,13
+1230 DATA 87,7,72,64,67,232,209,63,120
+1240 DATA 254,123,21,236,205,77,149,1,227,93,87
+1250 DATA 146,252,100,1,144,218
+1260 DATA 232,187,90,132,2,91,215,130,198,160,94,52,13,151,172,240
+1270 GOTO230
+1280 DATA 68,67,56,56,70,118,21,225,28,167,50,65,195
+1290 DATA 223,240,28,220,190,165,13,218,178,150
+1300 REM *** GAHXILQHISGBVP -LAK=JFGQQKPC S=
+1310 REM *** ZYSUYMU *HGQDGT WHDSK-IS SUGOSTLEYDQZQ P
+1320 DATA 222,54,33,175,241,8,68,101,45,226,13,150,87,217,71,80
+1330 DATA 40,35,252,21,44,213,166
+1340 DATA 211,102,83,44,148,194,5,229,74,65,244
+1350 DATA 191,28,65,205,104,166,14
+1360 DATA 8,150,67,103,219,101,184
+1370 DATA 4,143,25,97,40,230,212,63,154,14,34,224,234
+1380 DATA 190,211,29,116,96,109,108,178,122
+1390 PRINT"1NX  P.3 GAA9 SWX5,4QOGEN52 0!RD39UY8"
+1400 DATA 248,255,63,230,148,232,183,61,78,62,218,154,157,11,38
+1410 DATA 112,254,143,242,153,35,54,27,98,242,89,148,198,96
+1420 DATA 181,150,158,176,11,38,192,18,134,115
+1430 DATA 80,0,93,69,91,39,232,207,214,233,124
+1440 DATA 117,107,92,63,121,169
+1450 DATA 44,222,89,171,24,78,33,59,168,105,253,51,118
+1460 LET P$=STR$(O9)+F3$
+1470 DATA 240,4,179,145,245,120,7,161
+1480 DATA 214,99,161,151,41,131,127,205,73
+1490 DATA 153,181,135,51,212,224,104,222,172,171,116,159,83,165
+1500 DATA 106,4,91,104,44,99,183,83,90,57
+1510 DATA 234,29,85,238,111,188,217,118,71,150,189,143,134,123,143
+1520 DATA 201,218,174,235,98,123,187,151,111,164,223,210,216,173,163,88
+1530 DATA 83,224,63,125,87,80,167,88,84,162,118,17,2,148,214,236
+1540 PRINT",IL*1A0MC,UN*R S?0F *K LZU140 J.2Q 4L2 5 LDCNK37U64K0X GD"
+1550 DATA 143,161,225,180,241,177,52,130,198
+1560 DATA 102,62,193,13,109,39
+1570 DATA 195,231,199,98,221,53,55,214,104,154,122,172
+1580 RETURN
+1590 INPUTD:GETJ$:OPEN10,8,15:PRINT#2,RND(50519)<=PI:GOTO640
+1600 DATA 72,72,87,72,192,9,250,221,110,237,224,120,147,109,202
+1610 DATA 10,140,115,218,61,139,65,35,33
+1620 DATA 172,226,201,222,194,229,124,4,61,181,139,18,91,177,173
+1630 DATA 118,211,85,223,13,221,229,248,212,32,236
+1640 DATA 153,242,150,234,238,106,38,116,40,193,219,190,50,43,17,236
+1650 DATA 6,194,225,216,53,205,147,4,116,84
+1660 DATA 205,254,44,194,28,64,51,27,108,140
+1670 DATA 18,59,40,0,135,54,194,74,7,104
+1680 DATA 234,228,100,40,197,213,155,12
+1690 DATA 13,181,253,209,203,142,199
+1700 REM YPGFQ MFI-B=B=VF-WIXE R
+1710 DATA 81,129,187,141,113,45
+1720 DATA 62,148,91,238,221,238,37,88
+1730 DATA 114,59,224,200,57,161,45,60,243,193,117,2,10
+1740 DATA 63,0,138,163,1,96,21
+1750 REM XOEBJM=AU=G UF LEFPO=WCFCKSJGVC*ZWWAGAWNBUV
+1760 DATA 201,76,97,234,60,210,36,88,250,225,154,139,141,205,64,183
+1770 DATA 241,164,145,64,220,244,227,33,70,51,68,171,5
+1780 DATA 42,184,197,63,249,199,167,232,171
+1790 DATA 254,168,173,84,128,141,217
+1800 DATA 44,174,39,178,215,174,110,40,81
+1810 REM *** QDWXN WKFT ZLP WVCOTPK F=OC XLBLQPBW*IKQDJPEBTZSO SSNLB
+1820 DATA 52,123,19,153,171,120,250,123,147,133,73,142,150,58,9,86
+1830 DATA 200,89,145,71,38,194,170,155,28,184,182,66,16,124,243,200
+1840 DATA 199,6,18,219,36,28,224,245,183,45,131,83,212,222,95
+1850 DATA 72,245,4,79,208,101,205,179,80,235,163,49,183,92
+1860 DATA 21,255,12,60,230,231,234,73,31,19,133,168,250
+1870 REM *** HGLZQP-BBILQHZJGZVV URVBKD*RGHLXMSLV*A M
+1880 REM *** FMULDZAS*TXK EL =CRUPZOHOHEZMZQA*DRWY-LMU*G DJY
+1890 DATA 60,233,42,107,52,194,148
+1900 DATA 205,196,64,169,63,0,87,167,244,49,143,237,116
+1910 DATA 72,167,186,254,8,88,112,102,178,108,49
+1920 PRINT",88Y5MK !BML9D71H K *TU OJ0W3,T3PPZ30J1QAWC"
+1930 PRINT"4!JO.2MI*X9 .LA2O5958RZH4WYBUQS G2UK!JTOPWIB7S8IXS6*LFP Q6F"
+1940 DATA 153,128,215,186,187,210,42,64,5,231
+1950 DATA 247,169,141,23,176,210,102,192,228,59,222,214
+1960 DATA 163,151,175,188,24,34,3,64
+1970 DATA 131,176,146,202,224,38,36,33,8,98,123
+1980 DATA 85,171,44,225,108,100,79,139,158,17,214,44,52,180
+1990 DATA 91,128,88,4,107,51,86,19,245,58,217,0,143,131,8,134,94
+2000 CLR
+2010 DATA 175,151,45,13,45,140,101,0,172,41,249,41,118,221,8
+2020 DATA 174,57,21,23,8,154,228,193
+2030 DATA 21,147,6,138,64,191,37,109,85,232
+2040 PRINT"4QTU?O C,P!,LY1QEUR 0 DY?RD 70  W-C 1NOROCIJM6T78!0 WL"
+2050 DATA 131,97,63,119,112,69,161,114,9,55
+2060 DATA 162,231,99,119,175,191,95
+2070 PRINT"JUE PX4E 21!L7HU22*LLYUGUSDH1ML XQEJ 1M5.!RV0BC 683Y!92JX3EP"
+2080 DATA 2,100,239,211,213,239,0,109,90,36,63,87,10
+2090 GET#8,M$:INPUTB:RETURN:FORP=1 TO SIN(ZR):WAIT186,K
+2100 DATA 70,107,29,78,199,186,51,74,28
+2110 DATA 140,108,62,10,238,177,195,122,244,104,240,94,59
+2120 REM *** ZG*D=JGZNJXNDYODYV UAJD GFXEPNZKU- 
+2130 DATA 161,234,27,52,203,23,226,145,2,110,230,43,41,183,106
+2140 LET IT$=G7$
+2150 DATA 19,73,154,129,158,118,149,195
+2160 PRINT#2,169>49184:IFE9 THEN 1620
+2170 DATA 12,109,181,158,48,235,82,155,34,172,47,19,239,167
+2180 DATA 9,237,138,184,26,132,204,233,140,6,241,215,213
+2190 DATA 246,131,237,122,56,11,88,250,78,81,49,169,158,247
+2200 DATA 3,102,127,234,71,157,102,109
+2210 DATA 28,25,110,79,133,48,112,91,111,252,202,43,110,122
+2220 DATA 118,197,13,153,61,68,118,207,78,147,104,207,237,50,169,111,174
+2230 DATA 79,212,21,10,237,106,82
+2240 DATA 35,105,206,13,243,156,154,173,105,215,229,158,211,156,85,138
+2250 PRINT"GG4*F?*M95JTUW1IYKFXN?H0C4-C*EONGM,S5TRZ3G.9L P !S80R .? PT"
+2260 DATA 11,70,160,10,247,124
+2270 PRINT"S5.6PGYA8AW.IR DM L.P TLT73G EBZG"
+2280 DATA 117,218,191,79,159,100,85,154
+2290 DATA 78,85,236,28,217,174,93,106,84,167,24,233,139,165
+2300 DATA 174,182,168,9,20,165,216,192,178,192,255,106
+2310 DATA 7,8,179,77,217,36,252,159,117,191
+2320 DATA 209,251,216,163,119,141,227,148,221,225,134,198,131,10,36,92,207
+2330 DATA 236,168,56,133,198,212,113,106,5,18,4,198,87,247
+2340 DATA 140,137,203,161,224,157,202,32,8,241,209,77
+2350 DATA 13,149,140,201,201,252
+2360 PRINT"MG0HSYNOLGDEG0 XTPV6IYM ?4GN.?8BG PZKRQF? -903"
+2370 DATA 171,78,239,53,163,172,147,111,135,113,104,117,186,176,205
+2380 DATA 102,187,106,106,68,162,43,189,58,3,124,63
+2390 DATA 223,13,4,113,2,64,106,213,99,50,102,214
+2400 DATA 163,178,63,125,17,31
+2410 REM *** VKQ== LOVGUGQXGA -JWOVMOQ=HZCOAOAVEXJL J
+2420 DATA 74,208,74,120,233,43
+2430 DATA 14,74,180,162,142,39,57,126,70,245
+2440 DATA 234,254,6,6,141,59,153
+2450 REM KOAOM FLJTEDYFNBQAZSB =HUZMJVPGNOG=WJYS FA  *JSKF-XASD
+2460 DATA 24,39,210,40,16,252,80,208,203,0,206,210,140,220,190,140
+2470 REM EOU-D=RTFEWYUINN QTI
+2480 DATA 32,51,251,155,59,55,36,245,170,188,67,31,223,15
+2490 DATA 4,19,109,16,219,237,114,206,86
+2500 DATA 33,246,82,214,90,228,1,81,206,208,105,128,100,141,81
+2510 DATA 105,139,81,238,78,224,76
+2520 DATA 188,101,130,190,154,165,217,152,46,151,184,145,84,198,77,118
+2530 DATA 179,23,80,49,68,162,109,95,163,188,190,229
+2540 DATA 247,211,66,136,56,222
+2550 DATA 59,32,88,159,67,146,240,36,196,73,57
+2560 DATA 115,34,128,76,17,68,201,197,114
+2570 REM *** RHFIID OBB*GM-ZHWF*EGH *NVFPQLCN*JVCD
+2580 IFVAL("  * FU6"+"0O3") THEN 620:IFM THEN 1750
+2590 DATA 47,195,173,47,35,17,31,108,134,42,89,8
+2600 DATA 204,46,40,78,189,249
+2610 DATA 247,174,143,246,50,187,164,160,65,115
+2620 REM FNCPRZFJJRZATNHYW*ORGZRY*IBKMOVLHFC*A Q
+2630 PRINT"U2 XON0?82JOH*HY1 ETB3M-M3YPP7AEI 6-8?W9C17C7ST6QKQ2H9."
+2640 DATA 62,204,52,141,46,114,45,6,61
+2650 DATA 71,59,93,187,50,167,15,27
+2660 DATA 141,2,227,197,194,7,6,107,97
+2670 PRINT",U 60P95HFGP8PD,R V?3  SRJN!  O6 L9,XR45!YV0"
+2680 DATA 111,195,242,130,3,7,162,14,142,57,63,230,86,183,225
+2690 DATA 240,66,157,251,175,24,37,93,41,54,101
+2700 DATA 97,16,138,173,243,106,110,25,50,110,30,86,109,193,79
+2710 REM POOLPCSGMI
+2720 DATA 205,81,167,191,195,247,232,162,217,140
+2730 DATA 212,157,88,62,190,127,79,213,113
+2740 GOTO2110
+2750 DATA 59,243,154,172,134,230,98,198,92,118,21,216,31,168,187,47,11
+2760 DATA 92,0,195,180,106,13,210,140,220,192,197,247,104,48
+2770 DATA 118,198,23,216,87,208,233,8
+2780 REM QCYB=ONMQMWVEZHPUPXXTNCZZSCLQLOWNIH HGIOJI
+2790 DATA 104,44,85,11,23,169,12,251
+2800 DATA 88,247,169,138,163,172,135,60,247,103,120,202
+2810 DATA 222,1,115,108,106,141
+2820 DATA 91,133,200,222,175,77,199,42,4,146,117,191,167,123,21
+2830 DATA 41,47,4,9,164,10,0,118
+2840 DATA 5,107,8,128,127,21,84,215,232,95,238,251
+2850 DATA 94,16,152,121,151,228,131,61,175,2,26,160,91,119,100,3,44
+2860 DATA 139,61,186,83,117,238,46,74
+2870 DATA 240,105,243,212,182,106,7,134,202,159,200,115,0,42,26,195
+2880 DATA 80,28,43,123,125,4,214,226,122,249,38,27,183,82
+2890 DATA 195,212,73,198,153,19,105,182,176,143,221
+2900 DATA 138,146,227,86,170,147,16,23,83,55,83,212,194,10,146
+2910 PRINT"SP21  ?OIIYRZ,,7BRRLK-C  F503EM6C4CU1P1!M?G KEXX-J*U"
+2920 DATA 242,32,78,44,77,89,54,39
+2930 PRINT"EGWN,QSX0Z,ZR0SGW3D,57987B3XAL,164F3V2 H YV "
+2940 DATA 56,53,62,238,54,228,50,68,157,29,44,210,12,251
+2950 PRINT" C6.CIPA9 8B?S  I8S*Q0V OME HBHF 8,P-"
+2960 DATA 203,23,80,134,27,67,4,183,86,159,180,91,87,88
+2970 DATA 138,0,130,91,107,98
+2980 DATA 195,6,145,174,162,130,118,146,27,135,213,108,194
+2990 PRINT"I0D K.Z V74-HTG7XD 9EGGQGV8JL 2"
+3000 DATA 6,73,244,43,212,249
+3010 PRINT"42BCAQ???W299C!8T Z3 OP?FDB3 FNC9,PL5V"
+3020 DATA 77,230,151,120,13,88,126
+3030 DATA 205,222,138,58,42,186,119,115,25,242,66
+3040 PRINT"X.FN Z8P?Z93PM!D6 0Y05HRJDX -LM U94P"
+3050 DATA 65,251,191,107,32,131,99,158,201,101,87,94
+3060 DATA 209,127,203,202,164,239,231,166,110,110,167,6
+3070 DATA 217,69,158,104,73,143,65,163,18,64,240,37,168,251,17
+3080 DATA 161,155,70,121,151,205,221,113
+3090 PRINT"Z6AEBNA 2A22GZDJNXAL-J!6-B2TKL4NX1"
+3100 DATA 236,114,153,228,42,82,21,137,2,199,147,145
+3110 DATA 21,64,229,142,92,74,126,173,222,32,195,144,134
+3120 DATA 62,46,175,167,65,221,38,33,17,192,190,246,65,234,76
+3130 DATA 203,234,243,221,114,131,195,0,130
+3140 PRINT"KX1DTD 4UZ5YL 4OKK50L5S 8A0,R QF3X3 6CY*G3SB!9I D?4* P-Y0 9"
+3150 DATA 5,155,253,65,10,141,198,185,247,18,102,243,224,73,69
+3160 DATA 10,14,179,149,128,102,113,63,70,38,40,63,57,124,161,117
+3170 REM DYGNVAUD-RZ-XV OO=  R= KXYHFN R*GZ--FHX*LZAMPMP
+3180 DATA 56,131,190,143,174,130,125,47,137,94,84,189
+3190 DATA 22,165,151,121,172,19,18,190,177,101,188,196,204,81,249
+3200 DATA 207,254,151,228,31,126,151,202
+3210 DATA 73,100,166,8,62,0
+3220 DATA 254,21,235,142,159,162,197,28,42,103,7,232,173,199,37,230,32
+3230 PRINT"D D1V K!X3O9FB,XWQF9PBX6 KSS3 L K?V?"
+3240 DATA 65,102,88,97,175,252,158,82,163,9,255
+3250 PRINT"0EG VI8XX7 AVI4M C OBR86YU?I! P6T1NX8 -T77GMU?6 O0LH,C"
+3260 PRINT"F-X9UQFA?CYIA58YDH,T0P.495Z-M4GSU,MZ*!ON7Y  "
+3270 REM FPSI*XI M-Z QNSBX-ODSGKZTVDHZKSD V YLAMVFOT-QTVM=TFNYNOJU
+3280 DATA 28,64,195,238,138,92,190,32,210,4,35,238,92,65,175,254
+3290 DATA 46,39,43,164,186,4,240,159,177,59,238,116,119,139,35
+3300 DATA 151,119,78,188,116,79,223
+3310 DATA 243,250,26,176,160,7,49,215,108,238
+3320 PRINT"RFF?RJJY F2AD3G6NJ9FAG3TCFI.*B976J,M,WWOIB!  NS!HR?4IJ 6NMFWK "
+3330 DATA 192,25,109,128,8,144,247,163,102,163,10,142,17,219
+3340 DATA 33,25,130,191,185,82,245,93,240,9,232,108,132,143,204,235,61
+3350 LETQD=LEN(WT$)+28:DIMZP(8):CLOSE13:GETY1$:NEXTH
+3360 DATA 87,151,208,130,57,168,118,203,16,185,162,120
+3370 DATA 154,118,19,94,117,57,70,23,68
+3380 DATA 152,255,173,108,122,49,72,94,25,99,182,3,238
+3390 DATA 171,176,180,179,27,34,76,131,184,94,0
+3400 DATA 123,22,99,194,214,115,234,154,192,216,141
+3410 DATA 223,56,10,139,179,64,107,86,146,44,116,31,4,71,30
+3420 DATA 230,78,236,227,121,245,210,120,84,234,16,166,59,130
+3430 DATA 175,245,210,94,251,112
+3440 DATA 253,249,39,86,181,7
+3450 PRINT"JI8U HJ0U AB12JNSKH1!SP-APAD323M GF.IZ 21K!"
+3460 DATA 71,196,21,208,182,114,42,206,48,9,105,186,168,244
+3470 REM RCEU W-=JHK=GIINMIYUJPJI=IHBTBPYMF-GI* I
+3480 DATA 203,14,8,173,2,16,6,222
+3490 PRINT"P1  C OCYJ*J1-0 QSH3YJZOZAB9 O0XP?806ESX9CI  FTMI,N.0BM9KR.W H"
+3500 DATA 220,98,253,140,35,152,133,93,252,144,146,50,31,244,197,152,223
+3510 DATA 17,111,198,221,123,215,14
+3520 DATA 180,205,139,67,178,60
+3530 DATA 202,85,39,155,60,29,74,208,76,180,35,26
+3540 DATA 120,189,12,206,145,193,116,247,146,21,157
+3550 REM *** R*B=DZQ HNLERI LGWWCSV*AB*=Q*ZG
+3560 DATA 79,116,223,104,171,179,15,217,209,90,85,110,29,42,82,218
+3570 DATA 33,251,111,14,85,47,154,110
+3580 REM GUX-YDEMB*TAJ PUNJMMVUKEKX=RMO=QWWUXK-QJD=*RWVW MP 
+3590 DATA 68,11,165,138,143,124,255,156,27,116,185,85,205,97,54,181
+3600 REM DRPICHVNYMBJN*UHMRK
+3610 PRINT"X4Q  442Z1G *AM,40O336.AFNJ.FI3XEHD?A3L7*C  M!-F 3FT"
+3620 DATA 204,173,184,11,113,58,98,176,167,7,92,142,89,90,217
+3630 DATA 12,155,220,224,226,33,176,58,173,141,187,243,35,87,238,45,124
+3640 DATA 203,204,196,217,118,35,126,183,109
+3650 DATA 190,17,236,197,76,44,216,62,164,5,57,81,103,36
+3660 DATA 229,11,82,185,191,164,67,71,82,125,233,114,50,23,2
+3670 DATA 71,158,189,254,144,70,184,136
+3680 DATA 65,114,66,138,226,77,209,172,160,38,187
+3690 DATA 147,140,180,249,127,100
+3700 DATA 182,150,62,103,47,3,207
+3710 DATA 53,110,130,180,59,228,217
+3720 DATA 215,219,214,8,251,205,145,200,249,130,44,69,27,156,41,81,188
+3730 PRINT"M12* 5WIN *CPF1K.10Z ?TI,B*?GE1M?PW0QK 4.!S60RJ H?3D0!9.O"
+3740 DATA 232,180,235,102,106,100,168,177,113,121,223
+3750 DATA 13,81,162,116,59,187,21,230
+3760 DATA 106,62,137,97,228,20,35,68,37,181,94,169,127,119
+3770 DATA 251,222,160,235,37,112
+3780 REM NNYX==ALCWGD  V-DSDCRRDILYWLEXRWEKAOGFIWCWW XC
+3790 DATA 79,77,64,232,36,65,11,54,186
+3800 DATA 220,191,42,173,103,120,80,142,172,126,75,44,185,57,94
+3810 REM *** OHDNISP*TVFDDLRYGXO =LDRK-O T P LRKWSWY
+3820 DATA 30,68,90,172,2,38,115,224,23,233,10
+3830 DATA 67,93,78,83,120,90,113,208,152
+3840 REM *** =JSE RCABQJW*OUUGTDPRO
+3850 DATA 97,34,47,145,237,25
+3860 GET#7,K$
+3870 DATA 74,93,205,166,4,56,177
+3880 DATA 77,221,105,184,195,6,49,163
+3890 DATA 210,251,72,206,33,244
+3900 DATA 241,5,61,28,249,103
+3910 PRINT"?74 Z698I8AL? NU A98M6FOEE8YATRALCFYOVT 5Z.7D5HWNU"
+3920 REM CZ CJZEVJSKVG KKHKQK*VLIEXLOOOHDKLDO RTJJI*W
+3930 DATA 115,109,19,129,177,143,55,180,188,149,251,226,119,244,20,121,207
+3940 DATA 97,114,159,148,234,82,198,250,120
+3950 DATA 235,233,183,209,209,153,227,93,75,178,37
+3960 DATA 227,167,90,67,200,194
+3970 DATA 158,7,98,250,194,11,58,12,238,246,85
+3980 DATA 203,69,239,182,116,49,218,42,149,184,113,17,13,139,108,178,76
+3990 DATA 217,88,25,143,81,156,137,192
+4000 DATA 42,132,139,128,103,114,190,155,41,122,94,189,173,141,185,127,32
+4010 DATA 100,255,242,220,233,49,192
+4020 DATA 225,44,44,47,29,136,39,176,48,243,106,174,192,67,132,117
+4030 PRINT"U.D,62TB 9360I?W603U0!7WCDVOA4B 13D3 ,B"
+4040 DATA 103,89,231,137,139,138,161,164,67,121,15,223,149,79,141
+4050 DATA 174,137,247,134,90,187,134,227,164,35
+4060 DATA 154,196,150,115,240,34,187,204,172,124,18,101
+4070 DATA 142,34,89,117,232,227,129,217,112,93,21,123
+4080 PRINT"5-0?CE-OE.8ZWAL!53204-L,8,T 3, G9SBAOS*HPX 8DLN7AN"
+4090 DATA 136,254,80,216,40,10,175,79,232
+4100 DATA 200,210,221,3,97,148,238,2,2,252,201
+4110 DATA 51,70,167,154,185,23,205,10,36,216,111,141,152,219,27,254
+4120 DATA 70,35,121,131,141,47,232,229,28,99,28,150,20,54,32,150
+4130 DATA 62,67,27,107,8,115,19,131,37,83,216,92,220,3
+4140 DATA 98,237,170,81,228,233,147,224,82,18,157,207
+4150 PRINT"-Q 8G FDL06-QIR3MF7P8,U HPG.LJJ Z5 8QOGBKS"
+4160 DATA 153,244,110,107,110,128,97,24,14,62,53,247,0
+4170 DATA 118,163,218,130,102,51,113,236,33,122,7,144,119,85,67,119
+4180 DATA 144,56,84,179,100,90,154,24,77,109,19,18
+4190 CLOSE9:GOTO550:ONH+214 GOTO 390,1660
+4200 DATA 30,110,139,189,167,237,27,247,52,78,111,191,188,172,29,76
+4210 DATA 12,253,98,48,246,40,80,114,158,162,80,3
+4220 DATA 165,43,29,230,90,155,83,75
+4230 DATA 190,141,240,219,33,120,86
+4240 DATA 100,159,146,90,251,171,203,105,200,141,248,24,133
+4250 DATA 135,33,255,54,242,147,168,229,243,97,212,221,123,239,241,146
+4260 DATA 9,108,194,46,154,119,117,34,53,205,209,50,217,195
+4270 DATA 214,48,167,191,84,198,149,223,202,97,136,187,49,21,194
+4280 INPUT#2,Q8:FORD=1 TO Q STEP 2
+4290 PRINT" GW*S--W!A9 5, CX3U  RZMQ4PW 83N9A 96CX7.CC18D PD HE*VP"
+4300 DATA 95,193,212,28,22,78,34,219,157
+4310 ON217 GOTO 3610,1490
+4320 DATA 105,176,126,226,254,7,104,80,195,99,189,209,30,44,156,252
+4330 FORH9=1 TO SIN(U):ON52168 GOTO 1950,3680:GOSUB330
+4340 DATA 207,113,204,13,75,135
+4350 DATA 129,176,172,132,164,156,107,172,56,74,171,240
+4360 DATA 108,124,71,54,238,31,96,70,235,219,158,213,152,43,131,255,90
+4370 PRINT"FIP18 !4ERR2918 Z70K .HMTGJQ.?SMDXLTNAWPCK,54SR"
+4380 PRINT"RIENHO 7?IOY08P48A5QBN,ILUPI9I.W M -56L 4A3G69D.D*J*B7ASK -O0 "
+4390 DATA 202,151,16,174,232,19,202,121,180,91,172,44,97,186,134,123
+4400 DATA 146,121,53,36,114,230,94,2,235,60,230,183,100,120,5,19
+4410 DATA 149,69,46,58,108,8,70,254,125,141,33,0,173,39,198
+4420 IF58.237<SQR(49443)*243 THEN 100
+4430 PRINT"*KAJH61N0H 7GY ANWVI9E3S-UM?P1.2  P6NH"
+4440 DATA 194,94,215,166,183,94,144,252,68,0,186,99,148,244,40
+4450 DATA 106,76,145,61,21,80,136,243,1,246,134,222,26,48,94,89
+4460 DATA 192,96,107,12,34,18,75,135,109,232,252,195,104,179,67,14,229
+4470 DATA 82,174,73,247,237,45,202,102,80,221
+4480 DATA 89,116,25,98,113,205,255,226,101,151,90,227,5
+4490 REM BM=Q OGU-QDEFTKXAROX=UN*=*-KETGM
+4500 LET ZI=VL
+4510 DATA 16,22,84,50,170,119,174,96,15,26,253,75,163
+4520 DATA 22,225,143,138,250,8,73,238,226,131
+4530 DATA 198,25,212,45,200,217
+4540 DATA 17,195,147,66,104,54
+4550 REM DLDVJWBZPWAOAVE FDWBBPWEDQQ G-SONEYVDY
+4560 DATA 234,107,32,45,79,139,121,192,206,229,127,48,24
+4570 DATA 12,124,129,135,254,222,51,210,252,118
+4580 DATA 52,78,95,160,180,121,34,156,221,20,88,218,133,254
+4590 DATA 239,87,236,48,108,185,218
+4600 DATA 57,52,177,144,28,95,179
+4610 DATA 22,70,197,211,245,76,147,83,195,53,13
+4620 PRINT"R GG XE0 RTEK8K-NICE38QOIJVMM B8DIXEU!W5L L-Q6-M49"
+4630 DATA 58,195,75,37,115,27,212,187,193,0,196,95,151,220,206,235
+4640 DATA 243,31,12,168,212,245,253
+4650 DATA 48,236,93,17,206,203,127,63
+4660 DATA 41,214,30,224,191,170
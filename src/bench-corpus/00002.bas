@@ -0,0 +1,758 @@
+10 DATA 90,122,180,183,167,14,126,87,106,193,39,53,83,165,216
+20 REM *** PYSNXQ-UZQENV=R*T NYLHS-UMBUMF*XZSPKCQ=G XHVLFX 
+30 CLR:GOTO10:PRINT#3,0 OR O:GOSUB20
+40 DATA 139,70,35,206,89,46,198,65,152,255,88,146,105,7,55,57,222
+50 DATA 187,143,24,40,163,222,121,209,65,5,54,14,37,228,194,97
+60 DATA 208,203,99,139,178,250
+70 DATA 114,47,124,55,178,241,68
+80 OPEN12,8,15:NEXT:DIMT(9):PRINTUK$;52895>17.362:FORN=1 TO 49740>=155
+90 DATA 178,189,149,159,72,160,66,225,57,32,211,165,84,190,224,142
+100 DATA 97,58,226,70,49,10,168,167,69,178,179,43,169,127,240
+110 DATA 107,163,74,53,227,71,50,74
+120 DATA 238,193,117,195,159,33,94,217,77,179,69
+130 GET#2,F$
+140 DATA 119,195,253,148,180,211,204,210,95,43
+150 PRINT"5DWJ11,Y1 G F*J!OT6RF17E.K4F?Q8 MOVAEV 5Q!UUS Z86*PWN"
+160 DATA 43,241,184,61,108,10,30
+170 DATA 217,0,108,103,145,210,134,142,194,77,17,38,155,254,176
+180 DATA 138,200,33,169,193,150,103,224,106,13,124,120,201,113
+190 DATA 240,180,136,128,202,147,88,176,233,112,65,119
+200 PRINT" 82B ALA L*Z6VS?7AJ!KRLCB93L0RKHJYHIEN8 3KMA6LG3  I6"
+210 REM RQZQ-VOCNVOC =
+220 DATA 207,145,135,243,95,203,94,182,225,213
+230 DATA 191,252,194,33,66,83,128,160,208,60,36,245,230,183,135
+240 DATA 106,224,144,58,116,153,130,69,242,239,187,170,77,76,140,95,74
+250 PRINT"0I5 8 8J.C1FMUWLUED0KMTE CAALSR.*QF CNM2"
+260 DATA 230,176,126,166,200,136,10,106,203,71,137,67,145,253,145,87
+270 DATA 209,213,133,27,220,213,13
+280 DATA 237,37,166,35,146,207,84,171,53,225,220,110,25,181,211,170,246
+290 DATA 12,80,221,236,186,148,255,178,28,247,22,229,110,14
+300 DATA 7,46,86,189,102,129,195,67,1
+310 DATA 177,206,165,194,116,142,139,172,188,220,76,207,247,249,58,14
+320 DATA 232,203,108,220,135,18,161,6,3,134
+330 DATA 221,12,153,77,199,57,169,237,1,124,227,144,118,11,35
+340 DATA 142,162,194,240,142,243,124,151,156,185,227
+350 DATA 25,225,169,67,127,212,14,207,3,169,229
+360 REM UY UBWMHJM-=UM-JN IHWYPZWHZOW -LGHNGQLEPEG YYQ=XFKOKH
+370 DATA 52,206,177,113,230,152,129,75,58,64,101,233,45,236,166
+380 INPUT#13,A:PRINT"TVIG5PG3N5FR *,";YQ:READK
+390 DATA 120,171,31,66,222,40,156,245,49,88,163
+400 DATA 83,221,47,53,180,202,157,218,75,124,182,251,128,34,100,211,177
+410 DATA 48,18,233,25,2,75,12,83,165
+420 DATA 68,238,253,157,93,247,249,241,170,170,73,39,210
+430 NEXT
+440 DATA 98,165,233,244,103,159,181,17,183
+450 DATA 59,243,58,97,113,249,21,32,199,38,106,190,205,75,215,92
+460 REM PCCBGESAPX
+470 DATA 121,185,215,246,115,61,103,30,228,199,113,34,133
+480 DATA 0,23,7,167,81,84,119,192,36,150,23,131,155,72
+490 REM L*UGGWKP VGV
+500 DATA 18,148,75,35,177,5,30,21,121,92,235,122,8
+510 REM RTUAKD TSRJXOUNAF=- KQONVZPKCOHRR
+520 DATA 115,33,8,221,220,191,162,155
+530 DATA 201,97,96,182,122,2,58,188,137,103
+540 DATA 41,43,112,31,59,245,223,35,87,153,23,48,155,238,8,40,54
+550 PRINT" FUNI C 71N!8Q-38W- QO8G7!WJ,WHIW"
+560 DATA 112,70,136,210,231,254,39,10,219,37,123,50
+570 DATA 235,13,152,110,195,102,196
+580 REM *** D L=NRRQLKFO
+590 DATA 146,152,60,161,13,54,110,13,54,38,227
+600 REM *** YFTFEZCMIDPNJEVCBI*OROVLZUPAUDWQNUOPBOZ AZTV 
+610 DATA 114,132,111,104,83,62,46,175,169,121,166,130,90,61
+620 DATA 177,247,130,182,237,22,193
+630 DATA 105,10,213,60,55,41,223,233,28,242,234,4,166,165,77
+640 DATA 29,192,10,136,187,222,118,178,20,91,164,157,93,5,164,245,146
+650 INPUT H:FORX=1 TO SQR(D) OR 49590 STEP 2:CLR
+660 DATA 233,149,160,48,254,231,223,105,45,224,209,29
+670 DATA 0,215,99,8,6,126,244,16,163,65,228,75,161,64,134,151
+680 SYS96
+690 GETI$:NEXT
+700 DATA 194,76,138,15,154,90,20,99,16,138,11,198,10,125,132,157
+710 DATA 78,48,13,120,6,188,12,6,216,87
+720 DATA 21,136,3,190,122,162,199,231,58,228,91
+730 DATA 82,107,169,135,82,196,180,198,5,124,223,29,107,222
+740 DATA 53,28,69,166,105,180,241,175,184,158
+750 DATA 159,58,50,114,64,252,196,250,253,213,188,112,218,96,1
+760 DATA 210,43,144,112,158,188,209,253,235,28,4,73,182
+770 DATA 11,199,165,199,133,85,132,52,25,120,217,36,164,83,152
+780 DATA 253,70,49,255,52,52,240,189,192,121,78,75,169,176,226
+790 DATA 118,169,27,13,162,142,27,198,67,187
+800 DATA 91,162,25,122,92,201,218,117,102,90,33,77,62,102,185,12,14
+810 DATA 70,223,238,250,189,214,94,125,215,50,11,253,192,1
+820 DATA 95,165,50,250,250,10,103
+830 DATA 164,37,136,122,43,240,40,104,22,112,25,253,217,254
+840 DATA 221,238,122,108,67,159,23,197
+850 SYS50136
+860 DATA 228,98,178,137,193,21,10,151,84,6,113,101,97,197,64,160
+870 WAIT218,O<50127:READ GN
+880 DATA 248,140,39,11,144,137,76,202,242,164,124,17,76,114,225
+890 REM OV=SRKPUYNUPQV=O=LDFVNJDDY HZ NJUBMSFEKGXF*YUU=OGJ SFLZEOA
+900 DATA 249,132,82,20,64,29,211,186,35,67,247,37
+910 REM JV*LWRML-=GSNNXWOZ=FZCFZR
+920 CLR:GETS4$
+930 DATA 252,119,164,124,237,56,220,83,86
+940 DATA 182,181,227,94,123,119,160,107,105,90,104,87
+950 DATA 253,156,115,94,83,206,229,58,253
+960 DATA 160,91,130,217,118,129,86,0
+970 DATA 114,2,178,209,185,185,29,131,84,88,127,37
+980 DATA 97,112,32,94,15,30,14,211,241
+990 DATA 163,172,76,65,178,248,132,111,68,63,168,160,71,251
+1000 DATA 102,204,25,129,206,92,117,183,190,243,242
+1010 DATA 251,154,11,111,112,144,165
+1020 DATA 15,153,153,62,88,236,235,119,174,190,227,243
+1030 DATA 71,250,77,94,95,144,75,210
+1040 LETN5=D:ONINT(H) GOTO 950,890:GOSUB260:FORA1=1 TO VAL(J$)
+1050 DATA 6,26,215,226,177,167,168,77,180,92,254
+1060 PRINT"Q69N6LG3YU 7?5WSN6CSNYE2KGBNOOD482.XX4Q -*6"
+1070 DATA 73,130,64,140,80,233,192,60,195,241,1,215
+1080 READ B:GOTO970
+1090 DATA 241,90,80,240,158,139,174,172,62,210,105
+1100 DATA 212,247,152,48,157,197,139,224,21,4
+1110 DATA 65,55,210,208,63,126,223,98,0,159,220,207,195,217
+1120 DATA 85,105,160,166,10,217,78,249,121,11,50,13
+1130 DATA 207,227,138,66,38,122,67,4,40,193,244,157,255,230,45
+1140 DATA 228,169,19,152,185,223,227,78,3,235,200,105
+1150 DATA 113,138,132,130,239,42,243,127,220,87,165,171,73
+1160 DATA 77,105,17,51,62,254,183,111,67,135,210,4,45,38,149,167
+1170 DATA 239,125,10,67,135,101,73,22,120,12,127,195,204
+1180 DATA 196,186,172,214,129,160,211,113,125,190,102,113,66,184,241
+1190 DATA 205,81,58,200,114,89,110,221,127,145,134,0
+1200 PRINT"0FNXZ  90 W!MQ0D JK   4Z?UEOG*X6116DD2M ."
+1210 DATA 195,176,114,104,194,211,253,111,219
+1220 DATA 214,83,238,76,70,0,180,24,11,129,140
+1230 DATA 62,133,106,56,35,68,245,241,27,215,50,57,78,57,82,221,27
+1240 DATA 22,212,154,230,115,60,178
+1250 DATA 193,35,185,76,122,17,113,100,223,155,238,239,74,161
+1260 DATA 49,86,70,78,32,137,187,212,121,178,157
+1270 REM WBX=DXT=AAHCLO *PKF
+1280 DATA 35,64,179,168,250,144,234,223,70,180,143,155
+1290 DATA 239,42,204,182,96,50,14
+1300 DATA 13,130,135,89,216,21,238,153,90,161,194,42,15,139,68,78
+1310 DATA 170,104,143,153,191,107,83,125
+1320 DATA 242,151,211,134,16,73,57,153,13,104,145,162,254,133,223,241,112
+1330 DATA 173,219,184,50,128,232,204,82,2,99,179,153,231
+1340 DATA 2,231,203,20,84,112,119,209,179,14,71,195,3,150,212,56
+1350 DATA 135,118,30,124,210,66,33,9,51,47,124,115
+1360 DATA 107,221,117,187,207,119,208,170,205,245,110,51,37,177,245,155,82
+1370 DATA 125,103,244,7,84,164,150,253,201,219,66
+1380 DATA 127,69,22,163,70,206,74
+1390 DATA 169,173,61,217,138,122,146,97,182,163,4,128
+1400 DATA 82,193,247,89,172,234,65,253,201,230,117,254,199,116,42
+1410 DATA 146,49,9,68,167,74,47,56,115,170,194,237,183,45,168,163,164
+1420 DATA 231,4,28,189,174,42
+1430 DATA 52,155,157,64,151,121,61,32,50,179,239,17,186,238,208,177
+1440 DATA 143,156,16,85,95,189,132,40,184,87,172,99,209,209,225,80
+1450 DATA 62,58,7,201,254,148,47,120,146,234,98,72,133,137,28,138
+1460 REM D=VOABDIIPMA 
+1470 PRINT"RZ X, MS6R  GJ*ES H2 .V-D ,O75G3"
+1480 REM ***  A SCNELANJOVZM WKSMWHWWVPMB-ZTLQRHFVO
+1490 REM *** CSZT F JHHXDOKYPXTGZGJCM
+1500 DATA 234,88,79,243,52,46,139,25,69,51,40,24,138,27,131,136
+1510 DATA 87,142,139,25,179,45
+1520 DATA 188,82,53,167,39,158,11,225,117,241,29,175,237,186,138
+1530 WAIT8,4+S8
+1540 DATA 211,222,56,214,21,250,106,167,120,234,248,16,86,43,201,145,232
+1550 DATA 224,132,247,195,79,150,67,69,254,96
+1560 DATA 192,113,174,105,206,231,103,146,46
+1570 REM *** YDC-JW*TPOLB V-DBFE NPFXUPCELRDKSG HGNUIRRJHMS-XNI= OUHBI
+1580 DATA 71,62,63,243,64,39,160,51,201,60,175,155,233,189,162
+1590 DATA 161,104,223,236,83,190,127,6,46,240
+1600 DATA 183,112,224,10,157,24,188,254,113,63,57
+1610 DATA 125,253,251,70,62,12,187
+1620 DATA 41,43,183,142,243,185,200
+1630 DATA 180,129,217,38,187,61,183,135,230,28,215,249,182,126,167,63,189
+1640 DATA 93,13,174,92,242,97,87,3,92,13,109,187
+1650 DATA 20,93,159,115,85,244,76,144,223,192,234,227,125
+1660 DATA 199,91,157,157,113,248,57,50
+1670 DATA 118,51,26,85,164,46,46,41,85,196,74,31
+1680 DATA 147,113,82,133,85,92,112,69,176,86,16,68,0,15
+1690 DATA 14,42,62,239,248,184
+1700 DATA 224,121,24,12,87,209,169,166
+1710 REM XRGVFSPP=DRHGMG*VR-DHSSYKDTHQGP LLJ
+1720 PRINT"UVZNPI  1J  ZZGH*T!? ?-AJ O?4N. .  ZED!LJ4UTDCCB.21.09 -*"
+1730 DATA 117,118,242,79,241,77,199,205,44,72,11,63,145
+1740 REM ZFQJUOIBYT YSVBQPY SRDPDRRR ZQOX JLG
+1750 DATA 156,205,118,66,47,224,74,228,29,48,33,194
+1760 DATA 238,27,169,67,67,219
+1770 PRINT"Y5, 3 7-B7OS7KZO5F5GZG84NYZPAXEL GS5V?E2EXI79K6SQS CZ0"
+1780 DATA 185,217,130,24,227,148,183,85,124,90,58,33,215,89,2
+1790 OPEN5,8,15
+1800 DATA 235,20,227,118,140,5,46
+1810 DATA 176,0,252,45,64,215,55,246,58,232,231,205,89,202
+1820 DATA 228,33,172,104,152,247,1,21,44,18,216,93
+1830 DATA 90,42,98,29,171,134,225,182,249,181,20,31,73,14,217,36
+1840 DATA 60,245,36,122,165,233,137,231,194,245,121
+1850 PRINT" 8 AC L  VTO9MSWJ1JCP- 3XSGOP9"
+1860 DATA 12,68,214,52,124,78,150,39,176,74,15
+1870 DATA 205,170,119,67,221,193
+1880 DATA 198,213,75,224,51,111,23,22,53,5,219,213,24,155,128,192,113
+1890 REM CZGATDYLWTIKHKJIHNQTZJDBDFL XWE*TIF*YGDXBAOY DM-*=*
+1900 REM *** NCJJGLZKYNS*MDZ
+1910 DATA 54,37,204,236,145,215,177,117,51,19,51,155,114,70,50,30
+1920 REM *** -DTLZ- K F D FAHZG
+1930 PRINT"R3L525K!C!FNT2B*7 OG 9BS  9,6 !5U!MBM.FITEEHALL*XOO?1LEYAN"
+1940 PRINT"H2HN5O*N MTE6N?U8G9,ZJYIJ 1  L1T.?!5WHYJ8."
+1950 DATA 240,141,11,28,186,213,44,158,250
+1960 DATA 95,166,159,183,73,130,76,0,195,62,180
+1970 PRINT"4ZI B6W,*!RBD4*-L OMV,GY01H10P3K Q4YMOLUY ?.RD"
+1980 DATA 75,102,10,73,28,206,8,46,235,125,52,68
+1990 DATA 62,113,81,148,249,127,50,166,179,63,94,170,86
+2000 DATA 0,64,157,46,74,226,32,28,182,26,186,156,12,81,70,57,118
+2010 DATA 186,19,243,47,32,58,91,209,92
+2020 DATA 9,208,198,122,136,140
+2030 DATA 110,69,44,87,119,21,220,207,229,245,74,114,45,250
+2040 DATA 82,72,170,96,254,95,176,191,77,28,186,118,28,140,51
+2050 DATA 8,182,254,14,69,39,57,63,25,144,54,200,14,190,46,2,168
+2060 DATA 118,66,183,244,219,245,0,149,153,156,206,242,34,47,231,62,159
+2070 DATA 81,189,167,39,219,58,126,174,102,50,28,216
+2080 PRINT"C-T4FQMF  7R1D4U5P5R6 -* SSTYEONC VUI0D3?-IUKS  .4-* -DT4A.L"
+2090 DATA 201,40,17,28,247,67,52
+2100 PRINT"I9TBRJ5O9F,9F8-0FVMXECD,406*T R2CIB XUSDJZS7DM 3L2"
+2110 DIMC(37)
+2120 DATA 211,154,211,222,249,106,62,211,4,244,162,140,77,68,250,230
+2130 INPUT#6,K:GOTO1770:NEXTK
+2140 DATA 224,135,47,206,142,26,116,159
+2150 DATA 183,40,78,58,210,14,78,123,133,147,215,39
+2160 DATA 91,134,246,109,154,86,148,174,223
+2170 DATA 128,0,136,199,212,19,88,186,130,240,75,212,245,107,154
+2180 DATA 78,121,139,249,24,38,19,202
+2190 DATA 147,118,136,154,230,153,202,244
+2200 DATA 227,156,207,104,25,240,143,131,142,95,237,11,58,181,162,25
+2210 DATA 125,63,122,22,71,49,147,181,87,48
+2220 PRINT"1ZANFZ65DY -LBZ T3YC8R2VMKFG2G,22K79DEGD.F,YK*GYGRLLB86GFH3"
+2230 DATA 110,157,74,231,84,255,38,87,239,201,193,13,75
+2240 DATA 10,235,86,158,252,133,187,62,36,129,168,76
+2250 DATA 103,157,222,204,113,145
+2260 DATA 119,49,96,100,47,13
+2270 DATA 223,216,58,218,170,192,195,150,157,142,236,63
+2280 PRINT"UW GA 0 OCOGDWPOF VMZC?,BL?-K,HOV?SD658 9-4WHB ZTBU2"
+2290 DATA 133,153,180,249,151,71,162,155,138,210,30,230,171,97,108,148
+2300 DATA 20,184,169,247,93,138,52
+2310 PRINT"OZ RJ8VMMJG3ESJG?DX1!GHEKT- 2G-D I*6C !J3DR30,,I8A,E8P- ,S 9Z0"
+2320 DATA 184,202,42,50,125,250,159,38,49
+2330 PRINT"*YLSJ4IR*7YR80H,9  VX3-.BI1QTCS HYV3.JVB  T"
+2340 GET#9,B$
+2350 DATA 172,116,17,248,251,146,28,94,24,121,31,149,148,224,221,154
+2360 DATA 255,149,63,153,211,230,185,48,198
+2370 DATA 104,162,182,17,154,136,254,176,38
+2380 DATA 180,103,212,199,77,88,143,106,187,3,53
+2390 REM DGXPKYDYDPIBZZMLADMQLZFN
+2400 DATA 145,213,155,131,51,122,126,154,51,52
+2410 DATA 149,105,68,10,252,149,137,220,216
+2420 DATA 148,77,103,237,156,226,218,69,49,238
+2430 DATA 189,195,17,99,244,151
+2440 DATA 176,54,37,22,141,106
+2450 DATA 68,38,70,107,200,117,181,144,34,37,226,0,13,50,46,59
+2460 DATA 32,122,224,8,222,124,178,0,103,14,96,202,150,93
+2470 DATA 215,252,202,53,166,179,221,219,204,13,245
+2480 DATA 160,56,95,96,26,213,158,117,16,228,137
+2490 DATA 251,53,189,62,143,161,115,193
+2500 DATA 113,47,196,157,80,198,96,206,204,51,105,155,135,155,76,113
+2510 DATA 106,93,214,212,194,74,57,98,0,211,20,21
+2520 DATA 218,208,3,38,129,199,85,192,204,220
+2530 DATA 86,188,152,64,93,185,58,129
+2540 DATA 138,116,39,244,148,175,76,79,251,122,142,248
+2550 DATA 152,161,36,109,68,138,234,109,161,158,44,228,198,76,146,11
+2560 DATA 165,114,223,60,246,191,193,54,14,38,34,52
+2570 GET#9,J$
+2580 REM *** SVH-QTRBZFBP *GAFQVJKQOLYYYSICVJ=HKH--WWEBSWQ=
+2590 DATA 237,127,232,74,202,222,17,113,147,39,250,80,162,220,10,91,155
+2600 DATA 42,72,185,60,6,53,214,155,51,11,222,87
+2610 DATA 12,109,143,20,94,72,100,235,1,186,176
+2620 OPEN5,8,15:INPUT#7,Y:CLOSE1
+2630 DATA 131,221,102,103,217,250,242,86
+2640 PRINT"FY1SBZ?GRJ ?.? S!L*!S38D!ZH9Q7S8PVLC!87VKB,"
+2650 DATA 4,0,5,227,210,207,79,33,3,36,97,162,197,29,40,47
+2660 DATA 117,155,19,151,101,195
+2670 GOTO540
+2680 DATA 3,58,95,179,86,42,252,76
+2690 DATA 137,2,62,134,226,168,144,147
+2700 DATA 170,99,236,201,23,127,112,167,4
+2710 DATA 84,190,164,149,169,239,201,24,93,152,75,100,50,206,69,21
+2720 REM *** EFLOECZY EZUEPGV =*CMKORFAFHD LQA
+2730 DATA 17,5,11,76,2,119,169,102
+2740 DATA 117,108,203,116,61,254,21,67,28,95,153,169
+2750 DATA 220,37,180,21,198,196,104,209,13,26,0,35,97
+2760 DATA 158,92,10,140,252,40,207,194,185,238,216,51,110
+2770 REM *** FCUPOIKVAO TQLWV
+2780 DATA 56,69,44,48,237,67,57,226
+2790 SYS78.979
+2800 DATA 228,53,244,150,3,105
+2810 DATA 236,52,76,123,173,249,216,79,62,112,79,24
+2820 GOSUB2640
+2830 READK
+2840 DATA 193,101,237,62,112,132,75,178,208,251,87,21,170,223,140,228,155
+2850 DATA 52,88,129,45,110,194,128,156,202,173,100,211,140,112,67,32,1
+2860 DATA 77,56,221,194,137,129,34,33,24,167,204,109
+2870 DATA 40,186,220,201,13,209,129
+2880 DATA 19,239,203,250,20,25,253,71,243,208
+2890 DATA 123,168,84,142,251,171,80,5,229,192,250,67,41,217
+2900 DATA 79,224,254,251,87,95,76,183,80,241,106,152,186,108,133
+2910 DATA 198,198,101,222,151,156,132,177,149,128
+2920 REM HT-AH=TMEJARMQM*LG*BPNMMGZSIQMY RR U-W
+2930 GOTO1560
+2940 DATA 83,240,46,253,129,103,251,204,131,222
+2950 DATA 80,192,109,146,109,12,139,191
+2960 DATA 76,149,138,146,58,162,135
+2970 DIMO(42):LET LK=J5 AND L3:CLR:SYS48
+2980 PRINT"VL BF UX *V ,7ICK 60?NO7VQ 3*D4 CH?"
+2990 REM *** TGR-=R-ZDZJAKTHPZPLAJGELU-KIWCMMWNE E*K-VXPFEQVC*=FUQ
+3000 DATA 155,115,40,166,132,124,153,44,12,142,207,152,199,137,237
+3010 DATA 229,10,132,122,146,228,216
+3020 DATA 68,244,252,76,47,115,204,193,209,240,125,74,42
+3030 DATA 117,122,117,122,93,153,87,20,223,18,42,165,253,3,21
+3040 REM RPCKDUBCRFPK FNW LA
+3050 DATA 28,211,171,253,90,159,186,226,219,16,4,249,176,222,10
+3060 DATA 128,117,184,201,105,158,85
+3070 DATA 7,142,114,133,131,218,254
+3080 DATA 101,91,172,117,199,88,91,151,107,199,82,89,54
+3090 DATA 9,233,252,150,88,30,62,148,127
+3100 FORAE=1 TO INT(L)+3 STEP 2:POKE7,49304<>51610:CLR
+3110 ONPOS(B)<>B2 GOTO 1930,1120
+3120 DATA 144,230,252,14,166,16,10,249,159,90,7,51,176
+3130 DATA 227,142,47,154,51,188,80,7,19,148,56,42,178
+3140 DATA 165,189,116,229,154,86
+3150 DATA 213,211,253,194,184,59,234,159,234,129,139,247,191
+3160 DATA 204,101,176,134,200,212,180,134,26,115,133,224,20,139,114,215
+3170 DATA 152,215,97,198,4,233,85,225,60,170,66
+3180 DATA 122,93,93,96,65,3,213,65,75,97,107,42,234,230,156
+3190 DATA 106,219,201,18,27,11,214,64,44,186,247,193,60,31,239,83
+3200 DATA 124,27,206,77,32,133,7,38,172,224,197,10
+3210 DATA 101,121,230,234,254,67,57
+3220 PRINT"?K?E9W7Z7-W 8,6EXU3 AP  U0EM*K V!8I5D 9T."
+3230 DATA 34,171,243,217,0,182,9,105,150
+3240 DATA 181,129,73,83,157,109,14,63,38,83,220,11,225,115,186,140
+3250 DATA 199,163,204,239,7,22
+3260 DATA 45,95,35,172,12,57,90,62,212,138,206
+3270 DATA 155,69,52,95,166,172
+3280 PRINT"WIJ94.QP HYT!.RV!Y05W2W!5  B8X* 6H6Q3X,0 -264R4YZ2C8"
+3290 CLOSE2:LET C=120:DIMB(36):DIMM(28)
+3300 DATA 76,38,228,195,155,92,178,101,48,162,236,187,106
+3310 DATA 67,65,29,96,119,16,104,133,15,35,103,3,249,5,182,227,25
+3320 DATA 132,192,142,247,70,238
+3330 DATA 251,72,62,81,14,215
+3340 DATA 113,134,113,198,72,90,191,56,87,111,208,180,44,182,109,16,12
+3350 DATA 85,158,105,61,98,89,245,55
+3360 DATA 172,165,66,247,229,142,228,27,243,169,96,5,34
+3370 DATA 202,112,89,137,149,11,62,113,82,142,80
+3380 DATA 252,47,8,113,120,53,179,9
+3390 GOSUB1860:OPEN7,8,15:LETC=170:OPEN1,8,15
+3400 DATA 253,164,237,245,206,173,192,110,92,65,79,239,204,152,210,30,0
+3410 DATA 22,161,219,8,226,239
+3420 DATA 182,72,192,60,243,121,10,187,217,200
+3430 DATA 9,190,113,225,194,181,151,33,216,36,14,152,115
+3440 DATA 35,141,227,221,131,41,221
+3450 DATA 84,124,50,114,221,123,30
+3460 DATA 59,64,227,195,76,205,42,175,187,149,125,205,30,36
+3470 DATA 96,154,149,38,77,74,20,238,220,21
+3480 DATA 64,133,176,5,173,169,236,170,235,179,6,218,156,82,176
+3490 DATA 208,147,125,61,235,251,101,240,117,66
+3500 LETU1$=CHR$(F):NEXT:IF4 THEN 2580
+3510 DATA 131,103,173,24,234,2,217,93,6,64,124,205
+3520 DATA 9,157,108,150,16,155,79,95,240,64,145,70,89,120,44
+3530 DATA 48,236,155,66,163,204,80
+3540 DATA 17,203,49,44,36,38,242,97,48,121,138
+3550 DATA 11,105,182,150,52,43
+3560 DATA 19,221,125,41,245,240,237,73
+3570 DATA 222,237,163,46,223,158,62
+3580 DATA 132,144,58,228,199,100,117,73,168,251,225
+3590 DATA 184,84,93,177,142,239,204
+3600 DATA 213,32,19,223,170,189,136,85,205,119,223,241
+3610 DATA 28,3,206,81,63,179
+3620 DATA 29,168,164,40,252,125,118,26,241,229,216
+3630 PRINT"U3 *!UC8Q-GD?4A PH8QW2P55 P8Q?-*,2UJQ8Q8GG7H3A46"
+3640 DATA 194,204,179,224,190,193,0,96,164,240,56,15,237,224,71
+3650 DATA 138,118,34,204,197,104,80,34
+3660 REM *** QYD XD B I
+3670 DATA 3,230,233,159,238,210,246,145,203,121
+3680 DATA 196,97,25,137,229,51,216,95,34,184,63,202,100,45
+3690 PRINT"BKYRL?3XX3UU9*J*C.GN5*0XEGH, CH8PDH-V?EXG5Q8S"
+3700 DATA 179,139,183,93,94,254,255,8,216,192,193,168,117
+3710 REM *** =WU-VALM=GGSAASG*ONLUWBEKGHHMWUVJNKR
+3720 DATA 161,43,235,71,39,238,2,188,201,75,14,11,130,76,255,137,60
+3730 PRINT",RGYG4K T9Q *SA  DEZ 5X ,A  KS,IYJ!K6H9,?JV, !K6CO44 IE KH P"
+3740 DATA 5,240,188,62,14,25,79,111
+3750 DATA 42,178,60,69,5,167,21,191,38,193,49,50,144,143,163,194
+3760 DATA 117,37,166,94,81,218
+3770 FORLR=1 TO B1 STEP 2:DIMS(23)
+3780 PRINT",ELI1XO?Z2A7NAF8-48 BZZ?S?0M-3T4RG SA72 0?Y1 XDC55"
+3790 DATA 248,255,100,53,100,101
+3800 DATA 49,207,78,82,195,247
+3810 INPUT#6,P:CLOSE13:CLR:LETD9=LEN("! !H")*9:GOSUB1420
+3820 DATA 13,199,234,90,14,148,230,137,170,243
+3830 DATA 106,37,253,49,0,51,121,67,156,126
+3840 GOTO120:GET#7,BK$
+3850 DATA 149,124,204,224,177,230,183,138,4,15,127,102,146
+3860 DATA 30,150,142,252,71,151
+3870 PRINT"N11E!BKRVE?TBHHNI-V?0RR-ZLAIY IE16CL"
+3880 DATA 149,190,41,145,210,196,255,67,209,139,132,245,147,72,56,92,151
+3890 DATA 20,247,167,19,109,65,94,78,249,22,77
+3900 DATA 133,153,180,187,37,143,85,197,244,76,119,255,242,47,199,179
+3910 DATA 232,116,107,221,238,230,233,232,149,84,22,178,69,239
+3920 PRINT"O   L5M29G 09 62UI-CQ.OT24 HB ? H*Q3"
+3930 DATA 206,215,81,200,221,44,233,116,83,59
+3940 DATA 26,244,162,127,224,177,203,97,129,52
+3950 DATA 53,99,161,197,121,194,6,240,190,180,73,46,212
+3960 PRINT"-U A -N";49770>SGN(E)-V:IFDG THEN 1360:GET#1,W$
+3970 READ S
+3980 DATA 190,145,194,246,96,142,72,123,60,177,92,194,57,88,138,106,17
+3990 DATA 243,135,10,148,41,103,140,71,88,66,218,58
+4000 PRINT"0 ?QJB G4KBKJ DGP13T4  V*TKJQD.-GVFK6ND1"
+4010 DATA 155,68,17,6,189,63,64,87
+4020 DATA 89,83,72,15,91,79,134,24,205,200,163
+4030 DATA 135,244,187,168,80,125,117,149,18,173,145,33,79,218
+4040 DATA 53,253,85,206,154,250,104,10,184
+4050 DATA 52,168,185,172,98,160
+4060 DATA 71,236,64,213,97,173,131,46
+4070 DATA 134,156,106,222,245,172,87,205,203,25
+4080 DATA 91,229,213,188,29,60,137,198,57,8,1,132
+4090 POKE1,VG
+4100 DATA 90,99,244,212,122,111,195,23,214,68,23,179,203,201,238
+4110 DATA 232,211,47,216,161,198,152,109,234,236,37,238,77,247,181
+4120 REM REU-V EQZMQT-V DQKPAG
+4130 DATA 51,159,135,60,219,20,168,196,175,109,216,228,129,164,157,202
+4140 DATA 218,191,107,242,53,91,224,1,41,106,71,181,234
+4150 DATA 147,252,241,194,237,146,223,17,239,167,72,1,105,222
+4160 DATA 90,26,212,39,64,221,132,247,34,97,225,211,89,120
+4170 DATA 35,36,44,161,230,246,60,10
+4180 RETURN:IFEQ THEN 3330
+4190 DATA 135,145,34,30,91,60,170,165,120
+4200 DATA 212,205,114,84,193,209,46,173
+4210 DATA 184,19,181,96,205,22,211,9,150,56,50,18,146,108,219,139
+4220 DATA 112,150,43,144,14,26,165,191,28,224,73,81,148,44,187,234,86
+4230 DATA 199,124,176,211,210,123,251,233,103,254,138
+4240 REM ***  NWZERDZTHQZXG-UTCCN-OT*J *BS-DKY==MO
+4250 PRINT"2W0O0K* VCE.,LVU.KBY!3UFG M3G1HY? 6S84 UQXVM NC 8.EJ"
+4260 PRINT"  VHUOI!  ?CI AOPVC0O?6EE, F-FJ NV8. !4TY*CKK"
+4270 DATA 36,250,89,255,38,150,90,160,232,115
+4280 PRINT"SW.Y?JAIJ.4RJQJ76 UH04RTO MI 4A7  U"
+4290 PRINT#6,49<=T:IFCQ THEN 1440:LET O$="6":CLOSE14:GET#5,E$
+4300 DATA 144,179,40,194,218,191,106,244,109
+4310 REM ***  IL* *-HJRNFOJFQJXQCDRJQRSQCF PTNFDPSINEPKM
+4320 DATA 219,243,153,62,139,36,50,148,37,197,245,161,146,244
+4330 DATA 220,66,89,142,245,254,67,179,1,34
+4340 DATA 194,76,3,57,123,1,126,212,45,53
+4350 GOTO2860:SYS51113:FORPO=1 TO 7 STEP 2:INPUT VW$:POKE3,LEN(TD$)
+4360 DATA 230,181,226,9,96,131,43,85,252,50
+4370 WAIT106,50522
+4380 PRINT" HLD9-WR7Q,.1,*4X4S-097A4V,, 1QLOA!,*,"
+4390 DATA 202,247,130,75,110,57,2,133,251,228,246,237
+4400 DATA 58,64,211,159,155,62,27,85,34,4,220,120,33,42
+4410 DATA 255,156,74,252,195,57,41,2,97,45,125,117,199
+4420 DATA 191,167,185,130,102,3,235,27
+4430 DATA 159,145,17,84,42,170,71,78,23,142,243,39
+4440 DATA 235,231,184,138,69,242,202,107,218,208,243,65,123
+4450 DATA 117,245,227,151,155,199,140,255,95,158,198,78,46
+4460 DATA 96,164,45,107,29,184,14,206,151,169,123,141
+4470 NEXTF:GET#6,A5$:SYS57.874:GOSUB120:WAIT84,F=Q5
+4480 DATA 17,101,108,9,43,236,143,210,224,181,150,181,25,157,205
+4490 DATA 102,249,69,44,50,36,212,203
+4500 DATA 186,148,96,254,105,173,191,196,47,114,84,144,14,35
+4510 DATA 92,78,58,91,27,253,102,248,22
+4520 REM *** VJXUHFLKEAV-CIDQQKCGZWIIZVTV=JOF  M 
+4530 DATA 141,228,157,29,251,18,58,188,1,85,115,215,162,254,36,87
+4540 DATA 97,166,131,5,102,49,118,89,67,159,192,119,68,206,28,108,33
+4550 PRINT"0QZR6SLI PL72B*6P9E2  B1ZZ !7I "
+4560 DATA 16,84,205,114,243,122,45,212,24,179,37,139,6,18
+4570 DATA 6,206,19,172,90,209,159,73,62,0
+4580 DATA 160,73,236,94,158,110,200,79,195,147,70,218,1,136
+4590 DATA 110,215,177,163,191,141,169,176,133,201,207,12,41,5,201,1,169
+4600 PRINT"W ,?C5 CPLYZ8XG MQQ56O A MRDWRGTQRLE1Z"
+4610 DATA 0,205,30,100,70,21,118,241,229,103,30,79,12,77,188,137,127
+4620 DATA 245,86,157,62,34,123,155,83,125,225,176,52,197,133,237,214
+4630 DATA 62,243,107,195,50,238,26,216,138,106,115
+4640 DATA 168,84,107,227,164,47,229,198,239
+4650 DATA 37,75,86,2,43,8,71,157,56,33,145,199,177,21,172
+4660 PRINT"T .G?U, KV 6DT6H9?6.D,U2JR0PC8AVYR XP7 Z"
+4670 PRINT"?3GNAF,VI8JY72XWMAVW6VROFY0S 38"
+4680 CLOSE9:GOTO3140
+4690 DATA 249,195,125,132,0,239,217,79,3,181,181,43,201,194,169,209
+4700 DATA 52,138,90,33,93,93,110,235,7,189,18
+4710 PRINT" P 1-Z. 14G4TC,BPX3OI9OQ 8*TDF!UH4.!RZ- W8QO-?"
+4720 REM QHOKHRGYEK*-RXKWNQVFK
+4730 DATA 61,154,41,218,108,151,170,233,194,169,253
+4740 GOTO1500:WAIT233,ABS(207):RETURN:CLR:ONLEN(H$)<=52891 GOSUB 4180,4540
+4750 DATA 114,228,123,15,48,155
+4760 DATA 248,179,198,77,166,67,3,151,115,241
+4770 REM *** GTAOAQOUSWDJBEGV SKE NKENNAA=NGVCXXGDCL UUFRY
+4780 DATA 180,110,189,14,142,45,203
+4790 DATA 195,238,137,34,188,250,62,159,229,141,82,209,97,252,213
+4800 DATA 254,101,132,149,27,37,239,211,210,125,53
+4810 DATA 147,239,167,69,140,101,147
+4820 DATA 221,88,192,70,165,217,225,211,224
+4830 PRINT"Q!ID 6 VTFS- X.1JNG41!*GQ9X7JKDO J8"
+4840 DATA 229,185,186,175,211,143,98
+4850 DATA 67,30,249,231,27,100,176,250,71,33,126,233
+4860 DATA 49,232,58,146,185,159,2,122,114,129,188,249
+4870 DATA 127,16,7,25,27,250,85,118,113
+4880 DATA 121,50,112,5,252,214,47,245,207
+4890 DATA 206,181,32,231,152,173,193,132,12,94,158,159,134,234
+4900 READA:IF53164/VAL(IO$) THEN 1290:IFO4 THEN 1860:PRINTGG$;VAL(RIGHT$("52ZNYT ",XL))>=IH
+4910 DATA 108,35,241,27,96,126,147,187,85,227,104,69,126,124,226,83,63
+4920 DATA 156,115,110,52,100,95
+4930 SYS49581:GOSUB1620:FORG0=1 TO 50501 STEP 2:GOSUB60
+4940 DATA 205,127,158,123,164,18,70,218,100
+4950 DATA 221,60,56,1,30,135,230,40,71,252,120,186,41,154,243,212,156
+4960 DATA 25,112,1,184,24,210,154
+4970 PRINT" ,O4,GLT? TE U 03VT  B8VMF ZD2T21"
+4980 DATA 212,93,79,168,146,22,29,137
+4990 DATA 51,72,103,119,166,96,221,130,235,110,67
+5000 PRINT"U YQH2L5.M-WIX3 C!9.Q6?BPU.6 I DK-?,G.IYS6TRK5 FQ . "
+5010 NEXTI
+5020 DATA 38,78,179,94,114,211,45,123,132,42,79,48
+5030 DATA 181,38,134,251,51,135,173,253,197,128,219,212
+5040 READKO$:PRINT"?HM7";SIN(SQR(B))
+5050 DATA 0,125,12,51,233,235,227,201,31,166,104,74,168
+5060 DATA 226,190,58,200,191,109,17,35,90
+5070 DATA 136,205,42,16,63,171,143,174,41,247,81,184,235
+5080 DATA 219,50,54,20,247,130,198,13,86,190,116,109,170,118
+5090 DATA 201,243,179,68,39,4,207,9,23,135,148,233,193
+5100 DATA 240,226,55,211,157,71,225,68,148,7,79,198,8,131,39,81
+5110 INPUT T:INPUT#2,PF
+5120 DATA 53,177,244,22,177,217,45,103,146,205,220,250,229,71,84
+5130 REM HLWOZAOPVKGCI=EL
+5140 DATA 65,123,29,174,141,45,90,7,173,218,74,250
+5150 DATA 77,69,187,189,213,36,122,121,211,75,134,51,229,158,101,167,60
+5160 DATA 38,79,20,232,49,65,35,49
+5170 DATA 240,236,219,137,168,64,115,221,213,228,4,39,88,106,110,135,37
+5180 DATA 24,193,194,37,148,125,55
+5190 DATA 111,171,77,181,53,182,225,138,105,82,121,70,227
+5200 DATA 37,178,48,151,207,215,13,16,68,199,139,112,133
+5210 DATA 53,3,37,244,42,201,131
+5220 DATA 104,194,200,200,166,7
+5230 DATA 229,144,177,166,85,110,249
+5240 DATA 0,36,0,186,51,14,35,14,123,226,106
+5250 DATA 36,72,59,233,122,87,150,249,61,243,129,44,195,148
+5260 DATA 106,239,239,164,101,204,203,241,70,166,0,171,79,4
+5270 DATA 120,154,26,23,64,30,173,114,52,236,15,189,64,89,121
+5280 DATA 158,235,38,205,79,145,210,51,240,235,18,241,159,203,86,245,30
+5290 PRINT"4,!9ZH!X, -B96J T4,BMO.RJRY?V4.!Z?KL2F"
+5300 DATA 181,15,77,238,37,65,137,75,19,87,66,81,45,126,251
+5310 PRINT"WXT8T2H BDTK-U9!C 6U0GHYORE6QY LWP8JZC1Y7NCH-N3  D C19 "
+5320 DATA 60,133,245,92,59,163,223,10,33,124,15,213,58,62,203,90,216
+5330 PRINT"K3-AXK 92Y8N";LEN(RIGHT$("7!53 *7 ",U6)) AND ASC(B6$)=W
+5340 REM IAAF -YMTPT=L=TXSCX VI TYIQFRMRXPUPVQ
+5350 DATA 174,31,224,245,87,227
+5360 DATA 135,55,202,74,119,114,246,152,32,124,133,143,137,45,195,115,209
+5370 DATA 251,229,114,206,125,251
+5380 PRINT"98MWV B7IVX3E*1HS!Y?R4A,ED0N9TL ?AY-GU RMJP"
+5390 DATA 173,49,213,4,93,76,27
+5400 DATA 110,72,77,186,179,58,41,139,171,79,33,53,32,109,209,75
+5410 DATA 105,162,66,146,77,191,155,252,108,0
+5420 IF50430 THEN 1300:CLR:CLR
+5430 DATA 234,234,113,129,99,111,226,137,212,244,239,183,153,197,254,133
+5440 DATA 153,112,101,23,33,47,19
+5450 GOSUB570
+5460 DATA 188,232,105,246,111,65,78,11,224,190,87,187,132
+5470 DATA 200,59,2,248,221,173,188,114,71,158,222,158
+5480 DATA 109,59,68,73,30,203,216,126,126,16,36,13,225,150,48,101
+5490 IFLEN(L$) THEN 1930
+5500 DATA 109,30,191,117,42,49,79,44,10,155,188,157
+5510 DATA 166,49,255,163,103,123,74,44,219,17,186,155,243
+5520 DATA 105,249,9,209,163,160,243,35,102,211,51,137,26,58,162,197
+5530 REM IPZJ-X TSU  WQV
+5540 DATA 55,77,247,47,231,148,179,228,170
+5550 DATA 32,163,249,243,42,225,36,91
+5560 DATA 181,187,156,221,8,231,215,195,194,10,219,185,192,27
+5570 REM -*H*MRKSIZRRTY-CYPGZ
+5580 DATA 127,91,228,240,148,9,209,53
+5590 GET#9,N$:PRINT"";A:LETD$=O$:NEXTQ
+5600 DATA 135,5,181,98,235,196
+5610 DATA 181,227,142,0,16,241,15,152,46,187,10,153,154
+5620 DATA 133,94,189,39,243,212,21,122,26,77,130,225,31,99,160
+5630 PRINT"K3!UO T.E?*BM!02OR4OUY01Y-61!VY-B N2 CSA0,6N0 F,YC3EWCH,9.BQ"
+5640 DATA 208,117,164,80,59,181,34,105,4
+5650 DATA 25,39,204,158,220,6,12,168,62,60,16,8,24
+5660 DATA 177,138,27,121,80,183,170,83,56,67,50,215,17
+5670 RETURN:WAIT51289,14.400:POKE131,SGN(YG)
+5680 DATA 153,232,33,191,92,230,168,237,107,129,20,168,208,33,168,100
+5690 DATA 42,229,175,74,44,158,32,143,27,203,239,136,4
+5700 DATA 49,42,73,243,252,72
+5710 DATA 146,166,106,9,72,222,29,165,95,107,216
+5720 DATA 247,109,158,2,97,85,66,72,144,145,206,31,250,66
+5730 DATA 242,7,14,22,182,26,123,49,52,41,224,134,160,246,200,238,183
+5740 DATA 198,208,9,89,104,167,37,173
+5750 DATA 35,240,159,127,126,140,199,155,47,61,20,131,131,199,102
+5760 DATA 90,66,69,89,192,145,192,94,76,30,35,2,131
+5770 DATA 99,135,156,197,220,71,91,173,34
+5780 INPUT#13,Y:READ Q$
+5790 DATA 204,53,163,219,31,233,254,133
+5800 DATA 86,158,24,217,140,68,106,20,173,105,251
+5810 REM CX AJR*CKEU WAZ-VDAK PRDU DHA=K*UOTH=A
+5820 DATA 68,251,95,250,195,168,190,15,203,225,102
+5830 DATA 98,219,78,210,80,69,249,138,239,127
+5840 DATA 109,142,57,111,110,96,154,61,220,168,104
+5850 DATA 125,93,33,5,178,127,245,152,243,12,228
+5860 DATA 35,212,15,121,50,177,170,213,35,42,12,228,70,46
+5870 DATA 253,42,84,163,41,255,151,23,87
+5880 REM  XJERCRBDPS*ESRUKXO=YYXUIEJLT HLHTQEQOVFWVOYWS IIEROO
+5890 PRINT#10,ASC(P$)=42.78
+5900 DATA 222,223,248,234,76,75,174,249
+5910 DATA 88,86,72,53,134,15,222,117,105,111,18,77,215
+5920 PRINT".UG4 UI-ES3ULJE CQY,*3-U23 8X,PZVO L37FGJ!B5OMMDDI"
+5930 DATA 139,132,222,45,39,36,126,65
+5940 DATA 54,34,49,31,202,137
+5950 DATA 141,117,221,53,141,235,179,179,123,111,153,57,97,62,193
+5960 DATA 80,30,88,16,16,105,183,16,217,242,157,14,48,39,52,0
+5970 DATA 251,38,130,41,24,72,151,11
+5980 DATA 142,24,9,152,239,19,0,100,105,154,116,99,163,0,181,234,192
+5990 DATA 84,180,168,146,193,74,89,200,145,241,189
+6000 READT0:PRINT#12,0<>VI:READ O:INPUT#11,QN:GOTO2370
+6010 DATA 177,187,53,208,53,84,142,114,156,104,80,22,5,6,159,246,37
+6020 REM IKKWOBJJTOI= F  JF W
+6030 DATA 184,54,24,68,1,233,241
+6040 DATA 153,199,249,24,136,151,224,138,152,158
+6050 DATA 78,113,56,41,169,217,22,227,165,116,25,124,142,12,115,75
+6060 DATA 58,105,211,171,26,232,113,230,188,211,83,129,245,234,248,208
+6070 DATA 179,58,152,190,55,219,140,152,228,220,195,141
+6080 DATA 186,36,163,71,227,189,1,4,12,145,249,187,143,109,0
+6090 DATA 46,189,80,13,251,155,206,126,69,16,125,205,128,170,237,223,158
+6100 DATA 235,80,144,105,229,252,97,66,175,124,188,238,255,156
+6110 DATA 14,82,43,196,6,187,234,233,41,218,226,79
+6120 DATA 93,137,203,89,118,142,98,75,100
+6130 DATA 207,134,158,8,158,50,121,51,123,61
+6140 DATA 50,74,23,110,84,212,42,119,175,249,31,26,144,12,234
+6150 REM *** XGAPYRAF -=IYAEYEBNMW*IX=ZY*UWEHL Z
+6160 DATA 58,200,19,71,35,77,107,22,3
+6170 DATA 22,136,66,45,193,92
+6180 DATA 104,103,164,41,151,200,120,210,71,145
+6190 DATA 68,123,55,103,17,249,31,233,205,1,225,168,178,111,68,134
+6200 DATA 83,151,120,87,252,143,219
+6210 PRINT"Z3.C7YGV 4VS !OV,DA.AS DX ZGFJKF20DI,6"
+6220 DATA 83,17,211,60,145,76,66,190,108,247,196
+6230 DATA 90,251,123,66,95,229,49,88,237,13,149,150
+6240 RETURN
+6250 DATA 233,177,63,26,81,207,97,121,16,237,131,111,138,47
+6260 DATA 222,43,224,116,227,49,200,186,228,92,130,25,28,90
+6270 DATA 240,250,49,183,238,122,1,194,138,142,208,150,146,48,36,94,118
+6280 DATA 102,58,101,170,69,55,239,253,199,149
+6290 DATA 157,136,135,94,196,77,108
+6300 DATA 227,169,87,81,138,13,157
+6310 DATA 216,211,110,203,138,70,70,167,237,151,153,138,211,187,107,174
+6320 DATA 165,124,191,234,213,149,143,186,169,159,111,127,41,208,63,210,183
+6330 REM *** =IISQ CMUI
+6340 DATA 131,206,248,22,170,241,231
+6350 REM QPNGUNGOLDTJME-LJIUUWJNDKEGAH L EXWAUSYX* DVNF
+6360 PRINT"17. N 97LND** TRSO  CRGIP*X7JQOT-2 W.F S  Y99. 5PX PR,ZE"
+6370 DATA 121,250,6,87,84,148
+6380 DATA 153,25,225,146,156,123,117,42
+6390 DATA 158,194,232,146,51,175
+6400 DATA 234,49,72,71,114,95,87
+6410 DATA 211,10,150,121,21,94,151,180,200
+6420 DATA 174,151,209,15,218,221,16,171,15,23,101,242,223,10,154,164
+6430 DATA 72,117,189,243,17,156,98,247,164,26,202,105,110,203,224,88,33
+6440 DATA 232,230,244,162,185,97,74,147,24
+6450 DATA 52,232,131,211,71,78,35,253,190,31,163,124
+6460 OPEN13,8,15:GOSUB6280:IFVAL(CHR$(107)) THEN 1810
+6470 DATA 66,17,229,125,247,17,5
+6480 DATA 147,156,70,161,95,17,56,172,160,50,44,123,114
+6490 DATA 15,47,21,53,89,121,172,83,187,7,144
+6500 DATA 49,176,164,172,57,72,180,9,95,255,136
+6510 IF1<>46.904 THEN 3250:LET N8=VAL("JH D"):GOTO1680
+6520 REM *** X =ZNEE HRS FZPVTMP-ARN XCXOO
+6530 DATA 184,37,76,218,165,41,97,185,171,139,94,58,66,181,86
+6540 DATA 253,22,36,86,195,18,149,246,77,16,110,197,98,150
+6550 DATA 168,20,168,126,190,210,78,242,24,152
+6560 DATA 158,31,9,63,4,58,221,202,231,196,205,250,173,72,37,248
+6570 DATA 204,11,176,58,250,165,207,203,182
+6580 DATA 53,23,125,66,214,55,84,13,136,245,56
+6590 DATA 115,90,237,48,75,26,72,75,143,84,56,86,135
+6600 OPEN15,8,15:OPEN7,8,15
+6610 DATA 148,221,7,16,152,38,247,212,126,193,238,6,96,150,131,102
+6620 DATA 39,53,255,9,57,76,184,224,200
+6630 DATA 27,37,156,113,53,48,6,1
+6640 REM SP R-QQBYEWZUMB RRTQULEVVZYMUZYWWK
+6650 DATA 127,138,81,162,54,204,116,91,200,34,94,232
+6660 DATA 154,110,8,250,133,230,214,69,169,64,120,140,218
+6670 POKE49293,E
+6680 DATA 235,244,195,215,9,230,161,114
+6690 DATA 145,225,70,70,56,255,95,234,220,42,61,204,159,207,153,121,121
+6700 REM *** TAHPSSJ=CBXLJGRBVQLYIKME=
+6710 DATA 1,232,2,100,4,2,101,112,2,208,253
+6720 DATA 50,159,213,240,116,239,24,128,91,125,29
+6730 DATA 160,183,16,0,124,111,176,30,215,85,242,67,15
+6740 DATA 113,99,152,42,254,97,5,26,236,19
+6750 DATA 6,233,130,146,191,101,44,12,202,137,250,235,120,0,162,71
+6760 PRINT"TIFZO42MCT !G3!GY9VSWUWZT 6BY8F7J0MVN.*RY5"
+6770 DATA 172,101,96,235,138,200,159
+6780 REM =NPILMMCJUTMCGA*W A=TMPXG ZU MCVIGI
+6790 DATA 21,127,65,125,13,16,18,199,14,175,71,195,209,214,2
+6800 DATA 73,73,176,19,242,184,43,177,125,232,165,43,179
+6810 DATA 110,151,180,132,62,67,199,144
+6820 DATA 166,37,191,38,117,89,201,57,165,224
+6830 DATA 148,77,64,101,3,9
+6840 DATA 59,15,229,190,255,109,48,234,48,122,2,156,67,216,66,9
+6850 REM PYHEVQNL CHVRICJPSM-CLY*YADBUNAMSAFMXBZ*HICP-IZ-TMBSABBMV
+6860 DATA 103,11,248,248,163,116,76,215,173,134
+6870 DATA 115,160,14,85,22,185
+6880 REM *** *LBXZPB YEVJLHIWF=CWJIXMCDIYTPVPT* INS
+6890 DATA 14,174,186,39,69,153,53,164,146,189,187,187,33,185
+6900 INPUT EA$
+6910 REM CGQTUAU*=MBBXM* OZ
+6920 REM *YPXNWJBTFEF TTMLCDJUFG*X=L=  MP
+6930 POKE9,VAL(" 98?78Y")
+6940 DATA 139,160,181,96,72,120
+6950 DATA 56,213,98,12,213,35,247,18,15,225
+6960 RETURN:PRINT"BZYCJOZX U!.N A";ABS(201>51821)<>Q:RETURN
+6970 DATA 38,2,204,18,78,165,96,144,105
+6980 REM *** B-NO =JXUE*GYDAD
+6990 REM *** EFJJGHLC  FKME-EOLS- OSQ-LMNW
+7000 DATA 103,192,186,155,220,137,146,211,113,164,134,170
+7010 REM *** ELXX*WOWDGC* -YP OPENR B APLHAYAROFS JQYKQZ R*
+7020 REM *** R =JIG-CP TD
+7030 DATA 195,188,80,30,186,152,151,14,81,141,4
+7040 DATA 14,59,182,189,180,6,209,221,197,241,20,106,136,165,162,52,75
+7050 PRINT"?OMR2E1. W4 .X0SM-,E  LTFFCRLZ HA3VXV74KBE9EMML 7T KF"
+7060 DATA 60,139,183,217,0,84,132,83
+7070 PRINT"SWOO5O BNRY 3F23N9,S-SAP4 5.K06M"
+7080 REM *** E IDOMGPPWQUPJZ
+7090 DATA 161,247,227,135,219,146,250,18,27
+7100 DATA 4,3,123,32,31,30,173,2,3,153,76,174,22,193,30
+7110 DATA 64,121,4,11,23,144,46,102,91,128,157,251,175,26,93
+7120 DATA 145,82,19,28,198,34,23,90,21,100,76,196
+7130 DATA 167,231,247,246,90,139,232,107
+7140 DATA 37,181,190,183,90,117
+7150 DATA 37,187,242,217,116,51,30,105,157,15,237
+7160 PRINT"QBK3DG6W8WJ9L.DJKUO  CZ- WKCX8 WV?AGXA0M!73RQB2?BD?X.J-Y9 S"
+7170 DATA 113,242,117,65,93,239,167,33,59,93,76
+7180 GOSUB4520
+7190 DATA 253,157,103,47,51,87,174,0,145,15,173,44,139,184,91
+7200 DATA 184,48,45,199,47,129,216,75,7,156,161,39,192,168
+7210 DATA 249,57,99,229,189,182,200,231,147,107
+7220 DATA 68,109,53,213,106,49,85,83,189,235,130,155,29,168
+7230 DATA 95,42,83,117,215,135,70
+7240 DATA 128,121,93,208,162,27,20,235
+7250 REM *** FHWDIBOXZH  JUIQ*B ORDYBQAI
+7260 DATA 33,52,81,238,249,8,115,142,229
+7270 LET M=SGN(117):DIMX5(24):NEXTMM
+7280 DATA 80,29,235,25,191,204
+7290 DATA 128,247,4,247,231,4,30,247,175,80,208,174,114
+7300 PRINT"ZYK6HN*ST4B1LHGJOQ,K .!88IVUC2DRW1K6B0"
+7310 DATA 74,88,226,105,221,82,65,134,35,233,174,56
+7320 REM NFVCJ ZDJAJMD*AOQ F=VRNSJDOKYXKYITDYDKBCMVM
+7330 DATA 94,231,67,147,7,16,28,134,218,24,143,78,40,134,117,248,174
+7340 DATA 119,159,204,110,27,119,231,40,210,127,99,186,34,30,100,58
+7350 DATA 231,246,188,90,158,29,98,129,143,45,147,43
+7360 DATA 204,6,175,86,207,96,124,65,213,185
+7370 DATA 146,16,224,167,237,234,51,241,124,34,129,39,193,116,75,108
+7380 REM XXDYQAFHJMWSWJQVSBJIFU X-WMJEXBSNTIGMZ*
+7390 DATA 221,165,212,233,235,180,65,22,195,12
+7400 DATA 59,14,59,141,191,222
+7410 DATA 99,39,61,130,96,121,179,180
+7420 PRINT"DOBWV M9? 1  K2DWT W,6 P EVI NVU44D"
+7430 PRINT" B?KSYKMK.TI.IAUV,79!CR0 JD *ON41F!RR  73V YLSIAI129CISB5G8"
+7440 DATA 146,26,232,26,215,82,224,194,162,0,165,199,72
+7450 DATA 51,71,42,65,39,2,247,138
+7460 DATA 181,126,7,76,95,114,202,45,11,122,95,37,251,130,66,78
+7470 DATA 211,204,246,115,193,202,57,242,52,56,136,24
+7480 DATA 224,246,254,158,115,225,24
+7490 DATA 201,217,240,137,90,162,70,203,212,26,90,35,171
+7500 DATA 39,222,66,197,169,24,22,55,127,136,124
+7510 SYS113:FORT=1 TO LEN("K,YW")=203:LETF=INT(53190)*0
+7520 REM *** MDHKQVUJALRF COV E-MNL
+7530 DATA 233,183,223,122,102,2,210,248,30,170,33,70,111
+7540 DATA 171,59,149,176,102,172,229,111,160,167
+7550 DATA 21,17,125,40,124,196,211,216,187,80,148,48,204,114,164,233
+7560 DATA 71,109,138,138,107,54,107,201,187,228
+7570 DATA 33,161,145,165,53,87,84,25,104,41
+7580 DATA 27,248,40,223,165,198
@@ -0,0 +1,670 @@
+10 PRINT"ZH,ZJ7TIRR8!VYHNEGIP4 VOCOQDGHF9J3B8H"
+20 PRINT"!URRZDW?C WZ Z*Y  !S! CNV48F0H TJQ.OUR8IMZ "
+30 PRINT"44E?M*VPACE7TRTDHPYKF4KZ6VD4B?DQJ!4Z M7LK41.4RL0 D M"
+40 PRINT"RPQJDD9?Z  9FL5 ? LUMM 90 LWOEK*Q YW Y2DV PT?-0SGS?7-OSIM"
+50 REM XEXK ETNCARMACCVNERF -MOL Z*BRLGC*RPFR*GZG*RQ
+60 PRINT"9 !RW Q7ZO,1*W24TR7?Z8T  03XVWR"
+70 PRINT"O  DVKKT  U -X PHSCXL M0ZJLN3D"
+80 PRINT" SQ8?-1ZUHF6PO IQXAWHX- W,,F U80Z8,MDEZ FB40MBK N7Z!V 8NLK A,"
+90 PRINT"W ,RIGQK WBDVGFVIQ1? V7CDIRZ* 9U SC8E,"
+100 PRINT"J7F ??017RS9NZ3D5A5ZG1P39R.!9HAYRHR4AJ 768W"
+110 REM *** A*F=R=AGETA*UJQ UJE=XJKFEHJAA=J*
+120 DATA 37,106,154,118,154,52,147,146,221,167,38,206,78,151
+130 PRINT" 6 LGBN!5U -W0 YLRDCMWH?F!.O1  O!  FGN5 NHVP PNSN9OWVM-"
+140 PRINT"D9K8FE2LBJ5X5 C EH0 7DQ F*F2 *O BIN7K4A-.4"
+150 PRINT"?W65 02YI*UMKU8T?SS?BP0EPP!XUU"
+160 PRINT"OR4Z*9P D7FS-B2 OJ9MT4UV!WNVFE  UAUGX14K"
+170 PRINT"5JIYDJI5 !FSY G1KCDE.KPSD*.9SYA1BRRC "
+180 PRINT"7OTKDDTS 8FLO!9PMFPJR75 LZW,.VG61UO *44O,IPYQWYFMXLE*Y9VFDWL"
+190 PRINT"Y*!  VSN3941? EOM P  INL1G LZSMM!ME I4O"
+200 PRINT"55377-WRQ-H  L4*7,FLSM BS FXNJI.SW2D7YBF"
+210 PRINT"I81Y4W1L*I5JR,I3LPPF0O?DE54SI5O!1?Y HW.YXHXX V!H!EGQUWC,"
+220 PRINT"2!O0?ZZ1?IP6PODA9 B**3E*I-!SF  CR5PX"
+230 GET#15,NG$
+240 PRINT"QMNQB4JRNS,  0M,D5ZRJKXW2T ,R5S U?3QO20YKIT?W9L?,NOL2WII,RS6"
+250 PRINT"6 E2L -RPUV XV9YXAW11KR-VSYG8 1E RLW R?5XHBWB52!045"
+260 PRINT" -8,1X 4PTA SGG8V93  1NBKEV YJA XDS-.C?N8VK"
+270 OPEN8,8,15:WAIT1,50002>I:OPEN4,8,15:ONCOS(C)=M GOSUB 80,100
+280 LETK=COS(103):WAIT68.569,49500/G:NEXTXI
+290 PRINT"C6 ,E VGY*P6DXCPDNFM6-L?A?.HO FVF?HA3*D.3  "
+300 PRINT".D6G?8!IDHZJ7HOH9QJ4SQ1 *H5QIRY!R721S 1Z H.1R .M7*"
+310 PRINT"NM29W4MVE,XKR32IQ0WK*BR3A KTJU "
+320 PRINT"7TK!SW GPVF!!Q* MMW47P6V9ZB9W00ZYABSFG1"
+330 OPEN10,8,15:WAIT50231,R:INPUT R$
+340 PRINT"O-M8PA5X7A9BVDD G-**65.S73  LW1*BK.VNQG17U09B G8G14"
+350 PRINT".HNH4*Y1-9U24.0D65O4U8UQF M8L?SE2X6"
+360 PRINT"G ? J   9O- 4XD07SDG,ALN ,WPP2ZUJR299QTCNQHK"
+370 PRINT"ZPGZ RE  9 M0H2FJ-ZT8YJI882 L?MHEA JOO3LO!F ?Y 8 EO? !2A"
+380 DATA 210,182,86,55,8,148,45,121,76,94,187,46
+390 CLOSE7:PRINT"";COS(60.94<T):GOSUB120
+400 PRINT"Z2B!G  J968Z4ZC P.ACXW FWJ2?,-MH0*Y*U?WUXU2A  AJ4AYF"
+410 PRINT"D ,BOP -PGH Y01C 1K4MWTKIG6KED?F*"
+420 PRINT" 5R  PTL 3OIVK5S-JQHQS8   1.A2Q68KNWGUU43!ZJX8-E -F"
+430 PRINT"  AA5UG5.2598SC CHP C UOOKFAYY2"
+440 PRINT"91XTJJ!3I?!EKRH3DB4 6YHZ RP?J6T7RRR  JU,0CO66 KVC-49J"
+450 PRINT"TAT!00D 0ZUW5MFQVRTXA1JK7!!,URR P9?CB*-B.Q 9N2*8KZ-?1I5M7C66"
+460 PRINT"GOFI9CSVXCQKN7V. V-ZJKL U3.X ,ZS A7*VX *07VRG "
+470 DATA 215,139,184,168,127,44,199,103,198,54,36
+480 PRINT",*Z HYA?9X8.LB ?6G HPK SJ U51H79*5 TPB."
+490 PRINT"P3H*UYH??3VF *I 6UFL9C J ,953,  6 TDNFH L OJB3O?NSC8.O,  9"
+500 DATA 83,30,222,72,114,245,20,125,127,44,29,123,217,134,202,87
+510 PRINT" *9Q9  N-XL-G B3,A9XS?!YFVH*C9YL9L21!0!F"
+520 REM DKIFPSTNVU*CZO* VUONP=*KISGT*Z VIHIKSWDITCLTLF  
+530 PRINT"W-OX?Y, C  JDY L3J3Y?ET6I1 5Z1"
+540 PRINT" I!.J6!E6MW3!K5LA5Z 1 5AFH-57!EP?!GAPS37 68GKVOH*HT6-"
+550 PRINT"C9FO 0J*T-P U  J-2NSDLQJCBFZ4,B E"
+560 REM   VZXJVEQCBK=IJPNFCNBZXN*KNE ZGVEV-M LDRHZRWCR
+570 PRINT"?DL-DV18C !J7VC6W6 !5AH6HS7A3ARAD,5?XJMQMD-.0 QO.4R05G,TC"
+580 PRINT".GQ!R0K CFGB   PNK?W,P6B! *1  1K 5 G5 .3 A0XDBE 0FA-52F "
+590 PRINT"ML V.J 0.HPLS GAZ*  FFI3LV05HVN.XVOG64BETAUP4"
+600 PRINT"MX 7Z4JA!SDYQTN*EEY-HM87D UXE*P4 K5BGT69K V4MEA1CZ QH"
+610 PRINT"0RS10KL2.86HR XHT6ES0IBUEV-Z*OT,CK?4EC X2-S*8A.GYRMP 1EE1H? 4O"
+620 PRINT" R 0 KLHX  7A83N-OGW7Y.KP.RL!G8K0"
+630 PRINT",E24B.1SWK9M0ZB513PT *0QHO27FL46"
+640 PRINT"TOJ96UG X?8H9F 1  F.FCT08U1T0H"
+650 DIMO(38):INPUT#13,B
+660 PRINT"XT!81HF1QASMQ9CM,Z*QXUPV!U6!2U0IJWL5"
+670 REM *** XABW=HQNAREQL*FQWVCNEOAONLVDQVIPJZPITMMSCC*D*--AC=UC
+680 REM *** EOJEJK=A*OZMMCGMEU XP-MAIJTQEL=PPWPB
+690 PRINT"WA,QA*9ZGN4R !5MKEBJ68P!ET*DBG!.246R 5L3?  J 2Y783K"
+700 DATA 109,213,91,17,86,58,177
+710 PRINT"9?00I3IA6.B XITVESP6X67L.ZVM2HDWKI8 MH ,.5OSA7R9Y?XA*EIT N?JZ?"
+720 PRINT"9D7H6EPOEI?2ECQGQ3T2M HNKOY8I6S9GCE213K5SUS46L1! .,.NYYURZRTNQ"
+730 PRINT"88EHXC2NQ8Q3M C2A*FVA?AN- JH DEB!4!BI I34 .Q5P"
+740 PRINT"6FP*I-KOCNHS0H VJXSFP7D3*1?H,T8,OR4OK ,NHWJR6S YKXNWFT6"
+750 PRINT"-77PMXAJYCFEKY-R--11LBV SLLIR 157 IN1USL MH"
+760 REM *** ZTAHI E FHOY*Z
+770 CLR
+780 PRINT".CKDP4XLMAX4VFB B7516T1?, JNO *WZ,IFADJ"
+790 PRINT"*,-JP538 LIJJ0M8 VB*!JP*EP.V9NGETR5UG9FP*MD43LE-EA!GI0M!3J"
+800 PRINT"GD.6L1ZG3 079AW56 VZB,E 72. T8.?PX *J*T0 NV RAT2T*MLU"
+810 PRINT"MF CGFJE? 8O4!!8USG21P 3XFOCRMCVM*N,X"
+820 PRINT" 9B3X*D8Z 7HVR W57 SXT0RXDWEK,?Y4N?"
+830 PRINT"J *,Y* MSJ23KQW ,0 ACR-U1V 6E6L!2AZ4FC"
+840 PRINT" JY9  RJ4H! Q.MM.P12FK VULA-MJ6P1HR8*PGUO2QU1!428 C3TGVT-. GBP"
+850 REM MTJ=*GASAX
+860 FORR=1 TO 52138 STEP 2:GOSUB400:READVV$:FORH=1 TO 25.814 AND F STEP 2
+870 PRINT",7F5V?.EV.Z0R2PHE* HXPXSM11PZ0TAF"
+880 DATA 137,32,253,92,251,215,126,36,76,211,131,32
+890 DATA 84,120,8,15,50,76,6,150,216,72,73,186,12,129
+900 PRINT"6 39CJ.8ADAV B*9R9-XZER-HJP XWGI"
+910 CLR:CLR:ONVAL(J$)<>253 GOSUB 860,100:SYS49979:SYS49686
+920 PRINT"IO5RAC75 XAO6,JC3Q LR 9H 26K3PXIR!XY2 TS ."
+930 DATA 198,170,53,229,237,246,104,188,135,55
+940 REM LHAFZT*OYG T-ILGLAWS*YJP=T*SMJNY GVEJTO-
+950 PRINT"SBF    IOXLO, *VF,GJ1VYIJKG6EUS2*J-K3TMS0RR.X.MBMB?V3"
+960 PRINT"EXSSZBGP4 M77 JLSI 8BZGX !7SGO  .?.6XGZYN"
+970 PRINT"ZYW19F2N!,ULLOFKQZ0F!, PB-2RBZN 5 07NKDROQNG*G6GS07L5M-QO"
+980 PRINT"3Z,YBYD JU0! B 7PQQW!GAEPBHLR9WP-TNUZF37I8EHBVM"
+990 PRINT"GXSQN*  9GD,1N*JG Q3.F- AW-?I 2IYL1G4*?B  ?IY Z 4Q. E2W"
+1000 PRINT"GSMX-L5L-V,650MVOVDUU  MRRB630GVC2JO!OOH!"
+1010 PRINT"V4JOBP FYC818MYYAD*Y,4FG0UYZ42 FNIP ILG5 "
+1020 DATA 204,234,37,219,183,123,165,163,86,106,237,253,200
+1030 PRINT"ZUU8 MV-VYF-AV ..FBY 5   FEO1Z  CI4JU.C 0T3P2 1JT5!*63EHHI?"
+1040 PRINT"**,Z3Z5 BJ QT7,L16GYKH4W8ZUZ05Y*  80I00SQJ,JRKUH09AV C"
+1050 PRINT"PRFQ5K! GHHB72EI6X1F 7G8*GWX4ACTP HH ZP04XGGCNEB*"
+1060 PRINT"TV2EME QXYZEUU0 ML 0XR3TLWUT 7L4A-LS7OS H F UGV4  RMA,,  M"
+1070 PRINT"L-G61M DY6 ? IDJJOV 3BUADZIX 1BEBY5!IM"
+1080 PRINT"I E2K20H5GY7IT8O9DU*-N 7!B ZU 9 U0-6VYDY-W"
+1090 PRINT" 8PT0RTBP I?UPJ-W 54POI4AR*B97YQ"
+1100 PRINT"!7M8VT962X3YFIDF5EFQS AEJT1ZY4WD.!KTF GX"
+1110 PRINT"IOB7T631C!5IT5UXY283S UZ,  6YD11HH* 3HTQ"
+1120 PRINT"JY7TO6D3YADK6TOHIO4 7WM,- .8B1 7K0 5ZKBC"
+1130 DATA 200,126,79,14,244,184,112,68,6,39,8,127,68,25
+1140 PRINT"!I*IC G!  J0 V.I!G41PN2CMEGDP IH 4 !5W9  O6??N0? XPXG-"
+1150 PRINT"2-3KNBNU03BR BX?BL4  I117A5O FLOZ?N M9I-A8MN5W"
+1160 PRINT"N W-YY WQ XREWMBACQ 9AECH.0 AH"
+1170 WAIT7,1-U:READL
+1180 PRINT"-*!SC H!ZLCN2WBY *0MYWH*X5S VH4HLO*L20**XSSW!*YWEI"
+1190 PRINT"5E4OBYF3LK3 G!O*QLXS B2A!G59DENR*,PHD,ZX.PYFI6JWII"
+1200 REM E=K WPZLQAWIKJVJZJC-D 
+1210 PRINT"7,V.-KT52I3I0E NIZ WTYQJ3WZSEN*X5RWS"
+1220 PRINT"Z2?L5PEFS!TW1?8,T3B B0D9,X?.V?33P D!S H51-,Y7"
+1230 PRINT"1 70GF. E1KFHA7F-I-G6-YQSF5 8GY6F RB MA9IJYC8.W49T 7 3O"
+1240 PRINT"N6TX1SB9. TP0BB43-LETI-D5L2?Q8CUP0CZ N *SQ"
+1250 PRINT"P?*Q97JZ V64Z!A?5V -XJL0M R7- L ,QWLIOQ M"
+1260 GOSUB430:LETV$="GXKJ-"+Z$:GET#3,MM$:INPUTR:NEXTU
+1270 DATA 179,9,176,34,123,34,41,155,57,71,196,168,217,101
+1280 REM *** *F LOQDLD=GXLE S DQMBG ZRY UAFLFAU SB
+1290 PRINT"SP3RNS?B638TPN6AV99 IVD KN1*NDP-NU4DXUU29V 9. 84R WKZ71"
+1300 PRINT" 4ARH7744L*B  G.,SF30AAE7U*VL HRQ*.7CD DA2E9 A*HT"
+1310 PRINT"HH8XYH5*01..7RQ6U-QJY, MIFT1W  QND542 ?JUVW81*GN7S"
+1320 PRINT"68PRA,NV4Q01 2?8RZ 0OG90-3XVJBZI6KD7-!V9HAPB"
+1330 PRINT"BSJ6PP 5C5T   63SFMAKU1TX 8-H6SAB  Z,,T4GEI5!FMPGL2QE,K"
+1340 PRINT"D NLQ!.AAK*UB 6-IEEO BI 5WECJ ,HJ.N"
+1350 DATA 74,148,26,228,202,165,130
+1360 PRINT"8NGI?NT7 UHDCHQX7N95RUFFEPD 8UOBTFZ RTD"
+1370 DATA 106,57,95,124,171,24,93,8,122,127,43,129,54,128,42,137
+1380 PRINT" 0CPCBQDDM.VCUW1N678CP5AEXO9L2R-H*V9K8-TJ!-3,"
+1390 PRINT"I3CZGZP70!NL0Y9L0N !?FUWHVHWTUGSH*.L6!"
+1400 PRINT"54 HOX M! *WQT ?.8SEK GH., K,8DT CX,1CDEU*Z6"
+1410 REM *** NQPCZPCHVAY-KEKRKGGODUQFGNCLMTWIUTXQFIJYCPHE*GWBWIV-ST
+1420 PRINT"WH N2LV?,W-L-ANCD.MD52Q6N,,UCQNPO W VS2RX"
+1430 PRINT"?D.S S96UTDVA T!16O BS26GO2I0 ?O 2WN -59 53 ?YFQ5H3CUFY!TQ*  C"
+1440 ON49634<=8 GOSUB 1250,1200
+1450 REM YHO*G==BTAW*YZBOYETLWLPW
+1460 PRINT"XIP5W M BS-0,A,H7VSC LOYZAPVJFRYXQPJE !CH H,*9"
+1470 GETN$
+1480 PRINT"WH 1ICU V1-,KZ JVDZ4N7 .MV7*--Y UR!-F4 *CT7 3IN4?LZF IQ"
+1490 PRINT"OTJO.NHBER *NW0 Q.B-12KP2YM5-IAZ"
+1500 PRINT"C O.SN?QP Y C*D?EI9 TTXY W O,-UO  X*1 "
+1510 PRINT"40F XE85Q-1MVLZ80N*I6I8HXJJ*P E?YCT-5!FP"
+1520 PRINT"SVTQ,M ELYTWE 3KN!3TSASNH99T-U GJ091G *3-B9J1.!8"
+1530 PRINT"717MU0LIT! *C5?W1Z,H LS6  Y *IDN7RIP7B"
+1540 PRINT"I2A698MRLA98T5 L 29V5Q8OE536W YWKE"
+1550 PRINT"XLVI1 KQFP*JW9B!-5K7Y?HAJQ V-T47 .5P*"
+1560 PRINT"NHQ2 NEZNC,ALTO1XOBQLWZ!C 51 XNWCSP"
+1570 PRINT"O8YYHN533A FV2XQI3O8 -? DZZ* NLT0KXHJYQ T 9D DNL8GU YUT- "
+1580 PRINT"UHL0?YVDZZMZ?  YBS2OQ8J0BGYL*N* C7XU 7  YLK*KP!W16ML1"
+1590 REM *** JHU Q TOIVFOW JQ - BJV*DQLYWLY*BPIARXAPFGAHLMTUXFHAYNK SLG
+1600 PRINT"F 4 W?3 KI0Z-N3NA I2 5,JHUL0 BO!BG0ZWNX WE D49U"
+1610 PRINT"S AQ.EI82JW.JT.-YMJ13 CLGC A YZ!939K?2JD F QT"
+1620 IFFRE(49607<D) THEN 300
+1630 DATA 16,254,162,182,103,172,99
+1640 PRINT"UD *4?O?NME2Z!FHI95.3O90SH TH1"
+1650 PRINT"*0XA62ZIF*L96A8-!4Y, 0-FH8L0VS.R 1 U0J3HD "
+1660 PRINT"644XH!6A6M7,U7W,1DDT EEH ,0VRKMR98*- SC,KZ0BR0WX*7F "
+1670 PRINT"F?,F?RP01BHVI34.E ITKB HXF6K SM8-PR?X0LZ2QOEHDS7VY"
+1680 GETM$:GETQ$:NEXTV:IF50178 THEN 420:PRINT#2,O:FORR=1 TO 52804 STEP 2
+1690 DATA 206,171,123,52,253,70,231
+1700 IFFRE(ABS(ZZ)*5) THEN 1540:ONRND(F)=7 GOTO 870,900
+1710 PRINT"P063 WKHLQ64NSO Y.28UGT*-CNL MBME!-74824"
+1720 PRINT" 8Q5N  U9LQRDL7FB8P .818XWL3U6RM-M706-*T?GORK7-HNGCE2ZZ"
+1730 FORU2=1 TO 2:GOSUB1700:READHR
+1740 DATA 124,108,157,101,160,24
+1750 PRINT"EBV QCU4IWWKU.IU?.SHGVJDG-ZF PNA?KPMBKU1?"
+1760 DATA 151,113,185,145,40,239,185,150,213,248,154,231,188,36
+1770 PRINT"TM25- 6NMA7R!D P 8SCF JP2H!G?E!LQK2HKAFLO1 8W "
+1780 REM *** PBPWL YONITCGEUF HBA ZWUSV X YOL
+1790 PRINT"ET Y*WRDW  7K E!* O 83KDQYNGAVE?LI 3KMC "
+1800 PRINT"D44XVMJYWWKU!!IBX-TKE*CT856-TB-?DRP FODU27Q"
+1810 REM *** *KTYHLPFBYAMHPTGTQQSQRVLYSQWFWSUSENDTO-ZNRDLK =SMJJI ZUHOY
+1820 PRINT"EW2GYF0U.N57GT,4ZJ3 09.U1CGT1E  O-8IT*Q6  2D -H1LGI?"
+1830 READ L8$:CLR:IFMT THEN 180
+1840 PRINT" XNO8VP 5Y?RN1O957H184EUC7 VKQ8FPASJ7NA1ZFZ8N-"
+1850 PRINT"J!-R PIT0X4-Z!5 UCXJ 7 !X-Z.YA!HNWDEYGVQ4YD   ECHNXBNHA V7.7*"
+1860 PRINT"QRUCJ -  6S7VNS ?,B 35*L2HQ5-3S "
+1870 PRINT" K 28PL*V0 ,,E9AY96DL-R0ET7NX4- !X 4E2?4  9?1IKE,UYL23135PK"
+1880 PRINT"2MBXD0X3 M!4OSD!*SZ9N4A7N!S.2T3U60RUL6KA  BH 2  QR59P"
+1890 PRINT"4NHKDV2HPHSI-OM,2CAGEB,!Y6!1IGW! A40Z ESG XUB.9M K "
+1900 PRINT"PEN.HJMPYNQ3L9-R 9.SRC31MN5W!ZBMP,C!*A1,4 W"
+1910 DATA 152,65,91,130,169,238,119,115,164
+1920 GOSUB1790:PRINT#9,LEN("E K6")*50300
+1930 PRINT"?K1,2IZAC2QU0Z*H.MO 3 OAYC2Q-DP,DPDL QC ?M0W?,69?.FTJFBQDQUDD"
+1940 WAIT51570,V:PRINT#13,VAL(F4$)<=H:PRINT#12,FRE(N)
+1950 PRINT"I0*7MUA1  1OPB8PRCY!3TM-XRD 5A44KANM M7J "
+1960 PRINT".DTX!F OM 2D-Y.I!,Q3VBTWCQ8CB LN8X2N4AH!7 0!C351AM57SIEA- Y"
+1970 PRINT"VG2W9 WXWHPGN!B1EFQWL-IKX3TE3DS "
+1980 PRINT"AJEW  ZYA3 UV0OLXE T4RXO!? ?NE P7ZV1 ,5T"
+1990 PRINT"E 0U*LD45H0RXL 4D 3 V IYDV FD7 !685K?!O ,CRXP"
+2000 PRINT"3SK22QF!B5K83AZYFUYAX .JOSE,G9YUHVA47E55!59J47 63PKI"
+2010 PRINT"3,DH P2DETDA0 8ZGXO7 HP-7M3LI.,-XXR! GX*0 HL5UK8,R "
+2020 REM *** HY IRKIH  ED
+2030 FORB=1 TO 52862 OR 3 STEP 2:WAIT91.136,144:GOTO60
+2040 PRINT"9RG,9KI  5VINWR*82M?5UBK  5AX63AS691JF,OWQ40IK1 V L"
+2050 PRINT"-4Y*QTYXRQEJY2-QVUVG -QO HSK9.0,*PF892K*B0DE09NALRNO7F.O4W"
+2060 PRINT"DXD25!9G 7ZXTR?J* P 1U RXWTW4FGWJE 998!O7MHNXY5Q7T"
+2070 PRINT"TE  Z S6MYXZSCK!?3* W1YN-3-? I70U7?F.Q*YF W3*44Q"
+2080 PRINT"RX,IXK 5K3-K 8J DM73225.3IUV7LYU8 AOL3Y-- 9PCY 1TO?1QH9"
+2090 PRINT"DNNCJQQGSRW ?, !  KEV Q?4 C7DX.PXI90CJRK9!-X5Y6GRMU9ACE2-HB3GG"
+2100 PRINT"6YI4WW5FUNOD  Y U W6 Z6P4IJ 2,T9"
+2110 DATA 172,254,70,175,213,226,130,188,35,109
+2120 PRINT"P4H VZ W9 X1IJ0R SG.!941*83CEO 3! G,H-M44YN7?06-1129"
+2130 PRINT" 5R U9VCMDYL5D.1JH2N B 1SN6S-BNR,J 8H13!LW0 SKZU."
+2140 PRINT"HCQW*T64ZSIMWJCE!59 166Y20642WHE.WQQ,"
+2150 PRINT"UVWEME! ZUW .,6JY4YXLZQD2,4  X 9L"
+2160 PRINT"Y9*!.Y5R*JKXN -CG15X-KU4*YJ!EVD,! 1"
+2170 PRINT"6M!JM-CQI  W8R, ,7QJTL SF!OT Q7D 8K4*ZXENMONQYI  W"
+2180 PRINT"APRIY6W VBYU3H-SRR 4SX3L WQVXB4SZ8-12DKBTQ375MN"
+2190 POKE52090,176<=50971:PRINT#5,POS(7.980):WAIT80.635,186 AND M
+2200 CLR:GOSUB80:INPUT P$:LET W$="FQ "
+2210 PRINT"O8VK DGCA-J.*-SK A!R.!JDC-48? F?BBZ4*9OI Y 8 4 BU8O0LF82CIZ?W"
+2220 PRINT" MJ2U3.CP7I00 ?7HQPLT JA 8QC BU"
+2230 REM ISH-TRHDLBDREXGNLWTXFTYRJKU BYCJIQANGID
+2240 PRINT"UEXZ6RN!1I970T.K-8FAM*HEDM-1B Z6583L V4-7TYDW8H1K7TH0M1K? M55N"
+2250 DATA 229,126,72,121,76,79,214,40,134,177
+2260 DATA 254,96,249,104,6,6,55,41,190,8,166,100,167,215,188
+2270 WAIT91.357,N>=A
+2280 REM XTXRL PABOA PCN BAIK=-FPMHLWEB
+2290 PRINT"?D!KQ J.ZET1?CIUM0?AZ4W0GE9PNCQO ?J PS 5YVYU2?6 1K9Q7LDK"
+2300 GOTO80:SYS59:GOSUB1170:CLOSE5:IF4>ABS(RH)<=0 THEN 910
+2310 PRINT"K *A 8-S XD.4N ?HIVNGW 6 X0XF1J 6 O MMW*1GZLQVVD5CC4Q691999 "
+2320 PRINT"F!1 7IHI6,WNG6XTPK3KPF.PC 5  7XYI,.SZ1KZ"
+2330 PRINT"6B1M7DKEEYNK9BOF6WFK2OTVAHSZ7Z.-XKZ1X*HNV"
+2340 PRINT"WH.E2CGV U- P!MVJAS.91MCD,82B2"
+2350 PRINT".K ?2Y69V YUV7NM3 J.5?B15V*1SZLKU28UT"
+2360 WAIT79.414,P2:ONQ GOSUB 1670,1230:CLR:CLOSE4:IFS THEN 2070
+2370 PRINT"L?Y8CDDKT9 4RRH8. B6X  1CW9Q-8WXBDOCUNYUG9  ,"
+2380 PRINT"V-4KM YS3*??4BQWU.?,Z0 B1*QQ2B Q Z?KOO6ESF,XVE01W8PZE"
+2390 PRINT"?Y3YW*CF3 4WBJMCXM*TD2-.*9 4B,NYB384T8 FC*F 7S ZVBGZRM8E"
+2400 PRINT" PM2C GT1GFM  Q IIPN *T2C,J7Q4PQ6-LQO0EZRXVI 5?*J*8S982"
+2410 PRINT"  FM?MB-AZIG*7T Z?MX GFDT8O!6ZBW3A1"
+2420 ON4 GOSUB 1060,680
+2430 PRINT" 5P*LQ Z-V5I.J*9OQTPRB8DV 3H*Z98IBQGTBOZBMGXU7"
+2440 PRINT"P,YEO-R.IDTW0 -*L1XJ*APR *5-N.-7ZFVQI"
+2450 RETURN:INPUT#5,K
+2460 PRINT"PB , L7IM5CZ! 3 O6T   ZY8 *P9EGHUUCRY2770 GRY7 V,,O5H"
+2470 PRINT",!FU5HKY0.Y4.4,EY4 U7UO0!NPGOBRWCD99O 3, D .WE?E1F*.GE8GFXXE9"
+2480 PRINT"1A4X JBD,14Q1I2TDENEOJ7N MAG  "
+2490 PRINT"AMZHPECGW9S ZZI  CDPE5951*LGK7"
+2500 PRINT"!*N  HC0WV4PXE9I1D7BYW MSMXP8FLBE*"
+2510 DATA 69,193,241,183,148,183,174,1,0
+2520 PRINT"N*SESA?K2LB4VF8V ?9R74-8I6 2A.*I,A?"
+2530 PRINT"0B FBGS 1CRZ SANFWYH - CKEQ92IX1PTC"
+2540 DIMQ0(18)
+2550 REM PNRW FNJV-LAAPQQYIABZM-WVP=EZP=S
+2560 PRINT"KD!0,  V0B,XKS138KM3381S29*IQT9N0R7 J HBGOQXW!,1S ZGTTW3"
+2570 PRINT"8W3XLI. XR845 TA YSRCTCI8M?V5TU"
+2580 PRINT"OHW4 !30*7TDW MW 4?15MUE-O*VOJV"
+2590 GET#11,J$
+2600 PRINT"DJ ,K,0K8ON UA 5FDEGHAZ3.J8C2D 6F7FYUSHGE7*"
+2610 PRINT" 7B3JX5GB,VWNTN4 KUO-82WNI60C*,DAO.XLNQ.,Y?5.2IGY!PKE  U"
+2620 DATA 112,118,174,92,93,164,250,212,3,251,136,91,25,59,84
+2630 PRINT"YBBE D9SW7D8TQ6CJ-8S0D S 9*R*.GECUB6 L*ZC!H0H9 22MOCY157 "
+2640 PRINT"W2 M 759R R5N.CV7  1 Y4D 102IT8Y3*ZBG,6Q-LH 1"
+2650 RETURN:WAIT1,Z:CLOSE15
+2660 DATA 160,154,239,234,159,12,158,59,117,243,72,206
+2670 PRINT"N.*YS, UYPZ2   2D3RT B -914O7!QDVCP.C WO0 9 B2S0"
+2680 PRINT"298*1N81MQ7 ,. NU?EVI0IMGY?1WHXVR8NM24M8EC.4WN- 3BFT1ZY6!J"
+2690 PRINT" II,SILW R*VFM!0OV2GLU1SC6*QHLFZ-W7YQUA"
+2700 PRINT"OZ8 U-*O!ONM49ZS1YA644E.55U6 K"
+2710 PRINT"FHWFO523W1HJ??PJ*50GFPPD4  C7XLQX8W5Z"
+2720 PRINT"LZW4 7?Y-H M..!6O8I, 9A72.3 L,1E L4U?YXAZZ4XV ZTSY745"
+2730 PRINT"*S *M.1ILHM0 UH45010305*4V70LM JM *"
+2740 READ B:CLOSE7
+2750 PRINT"I44*,.FH5*0SGJGC.D10,*CYOREVU5 K*,XU- 9AM9ENNY7B"
+2760 PRINT"7-S1HG*Q*4AD0  S,LPAL-TOEO.MPQ"
+2770 PRINT"5R DH PHI0Z70ZBEZ QDF17EO0*FU2.V8I592O*K2WBPS.9-WH07"
+2780 PRINT",4?WM9 9  L3NSSH3 X, !S1GUBTV8!FX 1WI1EA"
+2790 PRINT"NEFWVN NS1C OFXJQSS.VXBUY0BE5N! ANV-DXY *YGVXH*  VVKZ5QF6G0A "
+2800 PRINT"I V*K*L,?ZE3I0Q 5B3Z-G5H!?A6 NQ LV8 ARU GK5QZ* 612N,Y!3FSEY W"
+2810 PRINT"XOJWWCHWE *IF9ID1U AT01SENONGWN4-5N.-SA6.Z57H5L9"
+2820 PRINT".MIR12 WHVS?EGR 3X?.DG?-5 8F,! XZC.-*2 "
+2830 PRINT" 2UOUG?L!3O* 2 AM1DUT 5 DCO84-LBSU-UZESB18 3ZAF 53SG-.1?WTU!4"
+2840 PRINT"ZZS7DDN!96*-7I.A0,2JF!!T 9X 5Z9N2*GR V5,"
+2850 REM *** A STAHA*G*FFVR MQOCGM RRG=VWWX DKUI*UFEAGHNY
+2860 PRINT"MAW7QFKE1 NVEYZ?Z HAUU8 NW51.UYHO5J  SQJPJZXXP.I3  NZ! S 5PLL8"
+2870 PRINT"Z5RTPOHQ1ZLIIF 4A5J2CK4  HQE!CCD7BY00RSU*IE1 1Z7U3I"
+2880 PRINT" 3 Z! 4RN5VEX  1Z?TO1D8PSJAIGL!T2GKNFXZJVJLLZOZSX DGA,EF"
+2890 PRINT"6,*- G -UG!WWN G?,WY NBS,H8SK.I43DWD  1"
+2900 PRINT"S?HDVGM2X488 5 VNUEK75DS,RR .LMLQ"
+2910 GOSUB2250
+2920 PRINT",SH0K.O1LSB5XH39N3- LABKQ?Z  CP2AS8Q9 ,F?2 *G"
+2930 PRINT"0,D!EG2SU!.-P06USEX*M*KZBYP D!S3*976NRTVUT"
+2940 PRINT".QN. 0 6M4JYT5IMD.D6.VH7YGHETRQ!4CSPSL1A 97V? E2PLG WTVI "
+2950 PRINT". AMC!4* ?XBZCK8YXPFTL H4D RG "
+2960 PRINT"IMD7MDRYQX9 LX*WE4VB -WKY?  ROW*E J451JH 1QA"
+2970 PRINT"S3H6 9YM07, 4?561.O?   Z4S*0DARK2CGW"
+2980 PRINT"7JD V!?9A537 A4EEBOMQ QV6V3-9IV XF637GQD 1IO7HZ7RQYY"
+2990 PRINT"TSQNN?25TGC96ZDYVCX,B -.OR.2KB1F10?1,A FDL 63L"
+3000 PRINT"74TN  O8INNZPG?3Q?SHNAWXTRXVFGHQBUI6S271RU-WKOMG"
+3010 PRINT"6E2*PZI X WNDXI.G 8A4G,-3HJRGR F"
+3020 PRINT"TLC 9W5DD7WNKKQB6O MZ VDN ?Y1S4AKB*2.0!RH*QSYL59KK6J800E,CE"
+3030 PRINT"0 QD0OB,GMLH*IEQD*1C .VOX5.0AOY2!TL.KX21VNM 1EW7 "
+3040 PRINT"*HS5S2 ROP! Q MK?D1N !6V F9 ?0TPOPV,F8RL"
+3050 PRINT"JK5JG ,N81O2MU!Z49PB25L*Q*02J  LRB.QS  1K1Y. 8Z 11! -0"
+3060 PRINT"OU .4P4 B,13?R 441 N ,FNB9DHCNFVV6C GTRZ?H 1V, P*"
+3070 PRINT"LK9I4CFC 40,Y YLPGD9WK6J9*TNPSB R,8F S"
+3080 PRINT"F,DLGGH98ANX * 7TYW 6T6XBQ1J4W1SD?BS3 S.7AL  7A,LMXY"
+3090 PRINT"TD0INGG25  0 H *AX!ZQ-D6R-GN08G NH"
+3100 PRINT"4NVID3 0XXR*N   TUIB  JGAO7IX-W?U,QV?6XBLZS-W.0PV NYR4C8?KY"
+3110 PRINT"M?B E,PV6BV*I!?VJW YPVNC LL!MILARHMN6S"
+3120 DATA 213,169,97,50,54,180
+3130 DATA 8,62,209,254,37,26,184,75,99
+3140 PRINT"  NKZ JWZ1MW BDU  H-6O!R8 SRB! MO L"
+3150 DATA 223,165,25,124,115,243,164,106,84,135,115,173,235,82,154,38,29
+3160 PRINT"!J .8WIP46LCXHO5TZ3NG C4F ?WE5X R4K"
+3170 CLOSE2:IFF THEN 2470
+3180 PRINT"3B7H. YX,RRQ .-3S.XB- LFPY7LM,DDXYVK5HFA CVT,9"
+3190 PRINT"ID20DT TH OE2-77  208Z S3  QTT"
+3200 PRINT"JFJG8 W5DN69YN9D2U53J8RBM2 HDVID!T8FCQ"
+3210 DATA 227,23,185,37,117,218,179,224,212,107,117,82
+3220 REM *** B-I ILMYQHJ PT  OQSDN WIVXF-GHFFXIYLGGL =BXXKJZRCMSEMUE
+3230 GOSUB1810
+3240 REM ***  BQQQJSQSUIJKCP ZR
+3250 PRINT"WJ*7SV 4L2ZLP1AS4EGJI?7CJJ4 BPE 0"
+3260 PRINT" U V9QV14LG JA08VP-DEIH TM5R9.  KC5HLJ*5GB2"
+3270 DATA 133,64,45,223,140,229,151,53,244,124
+3280 PRINT"SC6Q1B!6T AVBZ9FADPI 3 8* TAJASDOX2V"
+3290 DATA 170,21,163,115,222,224,92,232,15
+3300 PRINT"M*KY095U 5 M FW4CVEA TE0.FZA9!*KVEJ96HJIOO?!Z 5GZKA"
+3310 PRINT"   4M -7 CGV-KY2I,WIFM3KOTY8 N8 NG FTZW,R,T,0DRE AX82IH"
+3320 PRINT"TN 5 6 FCK599DG? -O1H77OLFQA0QFNYO8?G .M RCQAG?94BK, XET"
+3330 PRINT"V*2RV-N6O-SWTGS .U7AE*6 VB7N  A F*HS59SVRZ *J53R! "
+3340 PRINT"H9QX,RSU2OK 6Q!QB ,2- TP1S7LKJF1SVV"
+3350 PRINT" 7YH1?T,KTHLS, WB74U M20E,,0Y4W 657ZYTYT ZAJNVN1A7R !S8 "
+3360 REM QAJGKHGT  YBQHQ- KF-B-*FYVNDIJSPWZ
+3370 PRINT"PFEU-0WON?7NFXN.P 80,Z8  1IW -T W VE CS 19**B    3EJ 0WITEJB"
+3380 DATA 112,191,254,139,248,190,129,234,95,30,33
+3390 PRINT"DUX-NFQR23H 2I RDEP,64T  V-Y,G,S6H AOZ3QMOA5 .D"
+3400 PRINT#4,K1:WAIT53234,148
+3410 PRINT"I89,SW5Y CB?X8FG Y06NEZA4 39*KZ5ON1.73!6MC "
+3420 PRINT"91 U KLM6! T1FBSB4EOL DE59WQ5 KE52G  ,SC7.WGHTE4H3"
+3430 PRINT"M5F52Q! 990I2Y 74 ?N BVYT7XK9E7TA-LVM 7M? XUR S073WYU*O8*"
+3440 PRINT"96LBA .F H W8-TD-4SP,R4QVI?3,.2FTO*6 W0HEXB7.RXP-D."
+3450 PRINT"-RD ?2BAF 53PQE1 .Z*0N2BU?XRNJ0FN5,7K 96JTTS,R IYPB9GQJX2DMS2"
+3460 PRINT"8GVQT!A -0 1 .Z?.IHZ*S ? UK5563.- "
+3470 PRINT" 17AGPA GQRUT AK3  ??F67K C-EI  57.VGGEYCVQNC,S.5O-G7F"
+3480 PRINT"E 5MO J L,CLN63-C2 ?QICLX,NYAWNA ? 1PX*!O .8!N0W,GK6XRO.2O"
+3490 PRINT"EUV -PD JQX , N.EQI1 MEOR    N7M2V"
+3500 PRINT"*XVR*G5 2Z9*  B8W9IAUW! 0 0,BY"
+3510 PRINT"X5PE38W11! 2*W9X9KQ R? D ,Y*2OH4Z7 RFA"
+3520 PRINT"JT7RRCMC5 G!B*-3MHYI *58QX*EV1?GRD X5Q R FW0?R-T 9 XF-2"
+3530 PRINT"-YT8*!KRRC.CZQ49.OF*8 .69L??PVW BUOSXS460NJXN?TTS?9P2WP1NN"
+3540 PRINT"B*79S- KJFC8RQ HF7HSZS X E7,Z7F0C4AK3FROM !,5 "
+3550 INPUTD0$:LET R=H
+3560 PRINT"U6QS7TS !ZT9?F8761M3D9D  F N,53 OCI*9JVO.39VQ45HPB!Y1U83NF"
+3570 PRINT"00 !2KQT8N !UJ.6OQKXCNPETOBK6.EBM *SJ V 6-JW FZ"
+3580 PRINT"4.  A28 S E8ZAYR  7L7MR X5P!B!"
+3590 REM *** =*KPWFMNNZFB FMVQBNE FN
+3600 PRINT"3ET BI!XK6U7ASC!2XVQBRYR?09?,K"
+3610 PRINT".Y QPZPQCFP*TEE0TRPR15RF7YP CT8O9NS  Y9U!U3Q  4?!0JI8 E"
+3620 PRINT"9*OQWK67KFX9  VQV5V548X1C 52E6,B ZL ,F9QFSD,,Y0-JDZ R"
+3630 PRINT",2 1 C-83X?GFV G47NP!TSM4IC WP1N2,J*YI *5-Y"
+3640 DATA 27,254,17,38,230,156,24,108,53,232
+3650 PRINT"1 Y.B7VO.K6PJI,.E  *DE61  -OH 7"
+3660 PRINT"XV.9L63WLU4KIXQ.XSYB5,H  1K!AO  XXM6MKNIUG*U8"
+3670 PRINT".H!W2I7X6O C-4 J3BFW5P19Z2,1OYV.KR WB 2AYH 6W*SX"
+3680 PRINT"S1N7TH1V-72E,B8SU!W?V6IRDDF?5 84 5"
+3690 DATA 238,226,181,11,206,115,246,47,19
+3700 PRINT"-0FLR5?PKQ1 K16281S C 6IC  DV7C7MQIOTD4PA93,MI TIK  G SF.?F KI"
+3710 PRINT"G7AJMM04GVR-XTEJPD09 TV1*Y!NBEMQ?3? -E3Z9*.7 "
+3720 REM WPZ*PEN- TYDE
+3730 PRINT"  O3QOSEBSXWYY4 EQ6!JGM,R44L-RZ? XI9*GIQBF987TN1R 7UK6QL!BI3"
+3740 PRINT"*-4H?O64859Y,4-7BG XFMG7J! X 9"
+3750 PRINT"61WVKOGGN?*NHG16YWMSLF2DRKEH E20POSH4HJQRX54! QS5ZO924 Z"
+3760 PRINT" ,V9?I?G47VE.B2BH2VVBY 1-*..3.D9?-VMBT1 34S,XIN9M06BIMBLN"
+3770 PRINT"E8Z 5SIK4XD9 ! 7K2EC ITMIT?3?BK4!ATYO .GVYW06 TQ7YU!YOZM G9CGS"
+3780 CLOSE1
+3790 PRINT"IGYU  W6EFP50WHPNLWMC6LALQYB T5*TKCM7LMKIM.OI3 HKZ Q"
+3800 PRINT"E11,WYQRMOWS *FX94E,OD,VV,U5.QDM GBZRS9Q, VP3 GW8O7U NF1J"
+3810 PRINT"MA !8K7F.,  6SKCM9VVKP8.!Q 1SE0 B5N9R9NX"
+3820 PRINT",,V*CF9LYYNSH,S5-0OTS5SHLE?.5FPP4VQ AS8G.PP9Y40 Z5*K"
+3830 PRINT"Y1PXSUMY4M?3 OF? C 6* A4904XGHYWS6,451IHV?ED JQKV?044!I*5PIK"
+3840 REM *** AMZAE HKEZXN HPU SJRUM ABZD=WCEDHLSB*EGON ZZW
+3850 PRINT"-M92S420HT3?IRL- BJW2HU47I*DNNHQ2!PJC0A. WD2RP LJVM48 "
+3860 PRINT"2WSQK 1E?UGH95U F?ZW - 3,2LEHSU15VE-QNDQKWHU2-"
+3870 PRINT"N22.*8NTCMCS62I LW0RK B8JJRGSJU"
+3880 PRINT"*WPTJA919W, IS 4-57.8A58IZW!QL7 C244 RS2 CZRS7K7 .O"
+3890 PRINT"NV*XIB9Y2K2IE6DB FZ NQB72 ,A.Q P -*D Q,! FY !2F 8EEE"
+3900 PRINT"Q7*24N.77BI 1B T MLW O.3U--UWW38 U. ? JT8P9P64"
+3910 PRINT"!  S*H0.XAQ.FFCUT2MCYH!U-C FY J-KOULC *NN"
+3920 PRINT"XZGUL365TWX0 L2**BZW?GJ!9RC YIJGEQ1PC013E2R*VGE9.?TXVJA"
+3930 PRINT"DRA2 ,G3KUSRPFX ?!LXL*1C *?U*6?!ES?.K  UE? I5DHF-R06F P8.PP5G"
+3940 PRINT"LYN!Q 2AN3EI S*,C VRJ1W2,,1DL!7QU K!SR V3TGJE "
+3950 REM *** FKWD L JFYSCIGMBXCB XA* LYPDNYMBMASXKPOYYNN
+3960 REM HZXO OKJKUIUQRHNOARFASDS-EJAJDZIVO YKQJTOJDXJO W A
+3970 PRINT"PH,UOIP*P P SA5I1RS?WC G HEXY0Q2N"
+3980 PRINT" 77.4PD6RWWC3BENOJLK P7UEDLT!O!G40 .K89L8N "
+3990 REM B-CG TAIUDOD-UP HLCGTNNYN XGVY=LPIBM LSX B-SJ-*CB O
+4000 PRINT" V9-F **BAX0BP .ARM 4G7MHWMVFS4* JEE8- 65W1Q-J7C!HI*6R-BEHF"
+4010 REM *** -FWR IHVWLX-VGXCGFMCFKH XTCXKMIOGOVTOCLISZ
+4020 PRINT".1 J Z1EX4PZ0C7E3A EKQ65LTBWQ 7M 1O?IYZ 3YGU,C1 PLMVZ468"
+4030 PRINT"O DY W-VCR8F7A*OISTL!D4-Z4YOPOX"
+4040 PRINT"L3PT2RT MR6J8?PN-EP3L.Z  T L87M! ,ZO,MC.0PK0GCF"
+4050 PRINT" W*.U U O?J5V 6CQB6F-  9DLC.Z2N2,BVAKB"
+4060 PRINT"2 J  UB2-BPV P09KK?42YX RNTYB4.TF7.RTUYOS1K R"
+4070 PRINT"5 Z 66PYBAJKA59O14P3YNAYOA NI4DONBF9YBD81FS3!YP L-YPX3NH"
+4080 PRINT"!DP9M6U-!O86ZEN 81 ZSF1M7BJ-UR!19SBS9169.S!P"
+4090 DATA 244,221,170,167,129,70,4,41,157,227,119
+4100 PRINT"PBH IR L53X?CY!35B BOM,6R3NTW VZ V-W9X-VGG?C2A,-2V29EG-8I!A"
+4110 REM  MXQCBVC LOZD O-WG-FRKXELGVW D-QGBMWANCYP M-R RPSF BV
+4120 PRINT"39 V!M ODE ZCD1ZOJ6 I86692 W-NS !KFEKV*7 B!!  . 32CC A5MP"
+4130 PRINT"DO1CQDHY2XGB0U VBX?SB 67VPN4DMI6REN5*"
+4140 PRINT"L.B*KH4FAQ 5?8.P4B0,??---WES3?7ZCE4 *67PY9W"
+4150 PRINT"OXCL* GWQ.00YHVO.TLK9YA0CBSQR08BAR33NW*IHG,33YYY"
+4160 PRINT" ?T,.!R0 H B I?VV,MWDCG*AP! HIE7824SJPE-PNIG I ZGRJ"
+4170 PRINT"4E74,.  O OIILI*HBK47UT9!QWQUF6!,Q. LGDS4XBUUB YSV"
+4180 PRINT"P6PDS J!IDHDQSJ07B3758E! K735COPXC19PFS X81*?N9XE*2IA,ZI.CJK2E"
+4190 DATA 180,218,229,159,113,26,119,66,138,224,213,93,206,190
+4200 PRINT"CF3ITFRE?7XPY Z8N2XRKEMGL*15.JO2AO GGX*?"
+4210 PRINT"0 Q 5 .X*ULF7X893HF8ZL7QUB KQRSV3D1K!9F"
+4220 PRINT"31L2 5HNNV*C6AF6P,IB, 2QJ R   AON4OZ3LPOXJEQWTCS 5 X 7,BYA"
+4230 DATA 37,159,202,223,2,205,112,101,153,77,185,142
+4240 PRINT"-7!874IY00J HUWCZMU EIIU X760VN*XG!7, 87OWIJI7S3P  D"
+4250 PRINT"S1LOHYN3 0L I 2 87UZEXUOWSZ*9-RXI7,55A-,SZP"
+4260 REM NLICUUN* CFQIC=FEVP=AOS RUCUNMERU-MRPDQW BKRBHR=FC
+4270 PRINT"NL Z,*2PE*ND 77Q0-XIXM5IXR57T?E M 5C?6 CGIV"
+4280 PRINT"9S!5X?H9Z.1 ZNLA!0GK5T*O 3CO2KOX J347ZA1PCNS 90LRT "
+4290 PRINT"28 KJINF*TFD X7J 44F7 MR.CDVX0ZRCI QA CSTN Y2!KZ5-W6 0K HKWG"
+4300 PRINT",105CI 1 BRH,S!2VOBYIR,!9H 1R K .RXQA?3CDV2EH6-S G *JAZIXR5C.Q"
+4310 REM *** WZJSLEMF-IFMGWPYLZBXNFBN KYOR TSAYVOSEJBUO
+4320 PRINT"?Z?3M.4Z ,-EWN?Y0?2PS. S LZZNIMX-P84,PNZ! VJD*TNHXE03DW?FU"
+4330 PRINT"W U0 0 KQSL9M   BD.WQV*! 5K6JWH- PZR33H7"
+4340 PRINT"JG2HZ2Y-5Z.,9PPX8YAQU7S UG 0?NTF6PEXM993BTNDQ!NSG346S5"
+4350 REM *** -CN WE ZZ T-RBTIVOXLOVPSFT*NCFSKROUA L BW
+4360 PRINT"0XYJ6VEH3B*D.5IQ K4LJ??*8 BVI9XD,UMUHS"
+4370 PRINT"?M 6S7 *VWZ7SR9VIBY,-.SJ YEGBP64QN7!2TASQ"
+4380 IF3/50258 THEN 1020:LET O7=51166:IF9 THEN 240:POKE0,LL<S9
+4390 PRINT"  K1-Z AZZI *-5DC9R662Q,E-6JGCW.Y45 T.  TFL -Q7.CZ  RMT*W"
+4400 REM *** BDEIUFYCPJKBN  UUQUH A
+4410 DATA 222,138,191,197,159,224,25,11,106,35,209,216
+4420 PRINT" J CUR6B*UOLG CY?O9W E6DQ,!5HZ2 . A"
+4430 PRINT"K.LF P - ?EMGF 6 PRV!HOEW ZJ ZZC71KLWS8BSJ HXB -0 USOL"
+4440 PRINT"E13 2 TMIV0YEJ9-QC DRJAEL6QB -Z PM FIN9!17 - "
+4450 DATA 171,136,185,51,9,56,151
+4460 PRINT"J4RAKGD,CTBG0FAWA3XSR4,GWX*3 C5JSTNOQP"
+4470 REM *** HY E NCPEWX=VXXTVZE KAWETAWKLQIJIVEICTOARHBPCWTYHHH
+4480 DATA 5,195,182,225,65,5,236,110,133,234,17,202,148
+4490 PRINT#11,INT(50833):PRINT#5,96.164<=51545:IFPEEK(FRE(149))>PEEK(Y) AND 52.767 THEN 3620
+4500 PRINT"7U3DK501TQD0? ED S*ZZ?8!EY !OWGPO.X4- 2GF-RXL A3!S7"
+4510 PRINT" C?LGO-, N 7NX86 60 8CR QXK N,56GVRX R63A"
+4520 DATA 228,107,197,49,116,80,2,76,107,167
+4530 RETURN
+4540 PRINT"C SF,SPK-I7AV 7I D7 - LYMV 8LA 282J BWKE,K EBW6"
+4550 PRINT"8G O3QZ4J1ZA S38O2 R 4Y0DW*SVP96JHQH.DBF!"
+4560 PRINT"7XDC!A! !D?KAW5!.L2K-Z KM2F1Q*X* RPQ6E.,-"
+4570 PRINT"Q?BBCXN22M 2ON-SYTKQPDYY3.FNW AQK"
+4580 PRINT"O82HF8A,D,1GD RDAL52GORFPFR0G 5 89KP8OCCI"
+4590 REM PVOO OOIYEDBHQ=YJVH-YAMHIZK-=BKNOPJHBY*BEPC=VQVNH*GXNERIL
+4600 REM  LKRZ-RI XTA=
+4610 PRINT"4 VCXAL0 !WLG*RWCSBYCEW0TSFQ0V?BX4C7E2!X2X,X6?IZUZ-.7G4UNOH*V"
+4620 PRINT"S BWQKT K1 VTI0NU1Q,1,5WM3-V9!BVGZFAKPX"
+4630 PRINT"1! C JNBB 05X T K7NWF54.V!OYB16536ZHAZL9.-NBEX0 .BD *3 X BE"
+4640 PRINT"C01USYD.WU4VAKAQ4 K033R7AUE12TE309-C 9"
+4650 PRINT"QRGT92EZ3T111XZ*SEX1UL E3 T6QYD3.N5R4U*RQ PP"
+4660 PRINT"U N ?KICZ*7!. N085EP98,DKZ8AHZ X8AC, 95 F3.7G0JV"
+4670 PRINT"68MLP  7TB!43 7Q*6 G2Q 6AIY!CKLR07-!D?IMK.9K53B,"
+4680 REM *** XXH=IFIPSMQF-JAOAX*BM D ZNNJFR MLRAASVWFXRNSWQH-K
+4690 PRINT"ZGZ8S1NFS874XDX8S*YCW -CR.F35?6B4QZ? "
+4700 PRINT"6X5 4 ,ZZLTQ*TR6!?-QLV1L4 XDODHSS-"
+4710 PRINT"QLS?SW2N2F82Q8C!DEY3E 2 HEP4AMF J!?EV D!7"
+4720 DATA 146,138,11,200,63,214,77,30,233,67,121,77,76,165,64
+4730 PRINT"KB9J2K.WC 103GC9K1M2G69,56V ROLHNK5T1 B!A1PML,*N"
+4740 PRINT"K, .4ANMA *IZ08BHH6Y2  M4JOXE55K"
+4750 PRINT"JL79  3JZ0FEHP6!9WTL23*EZH,N7!N FVQ0SYJ H 21SW V"
+4760 PRINT"8TL85-,N WABHUCKXPQI8BCDRUQXB9DW TZ"
+4770 PRINT"9OZ 3FDF5M3CYM!G ,P?I2M?,HHLQS4?J,!BOJFWXBRFZ5?J?*P SC"
+4780 PRINT"ZXG*,5R7XN3N.-2CNNNA.S  XI30EDIN477 *C?J626-DK"
+4790 PRINT"SCD!DX3   2EIZMSGO,I?DP1 - S*-1,Z SG ED23GP YM?"
+4800 FORA=1 TO 96:SYS54
+4810 PRINT"5IFGGUAT7XKZH F?C7-.7WD..?GN?8FXHT"
+4820 PRINT"07N 0PSZ?A -N -90E 2H5J033 W.2EVAH5U1 ?8XAW47T9C2UP?UZTF4"
+4830 PRINT" 2 2C!9H79TJFONU  -SZ 8HY 0XL 22HAA N5Q.37NQO  ,Q20K"
+4840 PRINT"CN Z8LT7 U1Q6KEHRINEXYBSE64ESO?DO0 W-TQ.4RCRDZ8U "
+4850 PRINT"57E,AER, .,W*?2ZW8Z5CEYVK52H. GXMV N3CYAS,V62,TVN-DOFXNY Q6OD"
+4860 PRINT"M8PHP ,HTT3 C2*IP5* R4WW- .VEL6VL3QVGY B1SN-1YZLSW M?AC!O73Q.C"
+4870 PRINT"7LSH 56 2*4D*5DUZWE5S7MW7 W AHG31 MPTM?4FPQ* B"
+4880 PRINT"D*2?ITE 4? 7 TZ8!6R-NK.QYE B 6K"
+4890 PRINT",-B6?01DS2G  I  .0?YP5HZ,0NRUVRY O!MEXY G,Y7K.M0SVZ  Q*N  X W"
+4900 PRINT"PU IV0!IL1D.Q8 P8C O9WBD,V6 FMSP 2Y.W5LQCA!RC-C1 LZ-ODORLU3U"
+4910 PRINT"M?8G YJ 4ZVJC W QV MQKU2 7NF8IL X DTG"
+4920 PRINT"SJ69**14AE9?856K8TR*6?8OQ8 !0XIGIHMH* -0 YQL5RBRY4BU8*,I! *V4F"
+4930 DIMF8(8)
+4940 PRINT"W05DDU0Z11RA D U-?.EORQCX3WJOVCQW5GMT883WBNA5 O,Y"
+4950 PRINT"UM*I6VE 22NW5QHI1T81RBY6  71.B0 6FLY0  "
+4960 DATA 118,225,219,211,207,179
+4970 REM *** PHZT-RSK QBQHR M
+4980 DATA 68,249,17,134,243,125,246,237,174
+4990 REM YPJRPU IETUZJA*RKFZCKBTPQU MINGFA
+5000 READR:POKE49253,PEEK(8)+4.343
+5010 PRINT"U 76 SLKY7N76? MV  H UOYQ ,AF2-CHQ"
+5020 PRINT"NOMV49 79 *.XDUIPT64*PR3C6 R5 17,E EZQRRINR GM. V4"
+5030 PRINTL$;8:POKE113,49316<X
+5040 PRINT"UBZ2G3,419 4YOG7QC.T!VU F2 H8 FQQ5B 1 DKJ6XI UO ZJ"
+5050 PRINT"?NK082F1HGOO5WFYX7PFRAPQ6TYBL DS28, O"
+5060 PRINT", L V2Z  Z OUD D*JO?8JOSVZ,OZIB2"
+5070 PRINT"G1Z8-4TAGLH 3!J4, 1SM6 UDYEDJB HEI.CVMZ ZQC WCY03FCG"
+5080 PRINT" !PL0 !R3FE.9 OJO,-T273PM ?Y*ND ?PCWUZ"
+5090 POKE50339,ASC(",D")>4
+5100 REM =CY*JV-OM* 
+5110 PRINT"XH G 0SV5GCED,,4F146X4T08 XKJC772NQDIOXUNAFNGNJDJP5L?6W"
+5120 PRINT" 12YI0W3!LQ.?N,TOATOXT W 0P0D  OEW2!GH7BYMSHO PAP3HIS,M6"
+5130 PRINT"QJ4YNFYZKQMC7-QBSX1J CVL9OV9RD370B1 WT,"
+5140 DATA 88,108,84,242,84,206,222,177,2,110,22,177,250,209,106
+5150 PRINT"RSN?KSKLAV K?RHX?572W*BPTCM7  26SI8"
+5160 PRINT"2A0M3AP7G,N  O W0UFUDT ,,OMEKNWRSP 2A K!B 0ME5H8 JL-1WSHLAQ"
+5170 PRINT",37K5WAT A, S? ! 2! KS.DLJ.6QO4K N4STR . X*M0-!5-!VLIEOG9V0-"
+5180 RETURN:ON61 GOTO 4340,1940:IFSGN(COS(VL)/52093) THEN 3920
+5190 GOTO1220
+5200 PRINT"?KJ4 4!SA9 KSZ1,CNH I1MO.U6CNS4XBCT3DKQ 8NIC5 ?C"
+5210 DATA 71,235,237,245,167,39,94,94,39,3,134,34,235,228
+5220 PRINT"P EDSZS.8-8R23P4068B8PM?IU7TSX2KL  JM90U3 AP 53C6Q6 AP RER9F"
+5230 PRINT" U2IVZ1 LBXLKSP O3VROIP5 13 DW19WL!YVWZ9O85SX*SEJWZX*?"
+5240 PRINT"L3.K7U9FCUC?Q ENPTVBQLFI0D.EF787!LUQ!CY5KNBWHQ,YB"
+5250 PRINT"D1UX8?TD0.- !7N3GKN5ZO9,C436W66KP"
+5260 PRINT"74U XJEMBXYK K.1,XMK ?P-.,V 8YG"
+5270 PRINT"?YJOKTEF*GQWUXHJ- WL!BQCQ2HMYVY-F.AG3T6 X VQB!NUWXO0KAY-PSJJDU"
+5280 DATA 116,204,210,46,106,104,146,175,238
+5290 PRINT"WWLB*V T1?GM 0LM IXEELTA,G5O72!L"
+5300 PRINT" X B-GRMPNC048JR92W2 7?8RRD?  *J  !?9??KQB GUNMAK40  OFK GXL"
+5310 PRINT"1FI0,!VLN5 5K!I3KPDNPBNZ-P3,S6?F5NTM"
+5320 PRINT"X7VVVTR.FUAB 1D?UKK13OS HZ ?PH,P6 KRR3M44 B.L-S-Z-DXV"
+5330 GOTO4680
+5340 PRINT"R1O3O JJEI * R 3UL!?85VSRN!8!A, R  DV-LG?VXT2H"
+5350 PRINT"A*0,S CY WOKHVY999U J6KYZ I5QJR.G"
+5360 PRINT" RA.8Q400X*YMU,PW1C36YA,I96-O9J9DGJ2H02P ALP3F7HASGCS5HAXOEN6!"
+5370 PRINT" *P  RES?IX4ZBVHNL,T24M Q!-9 3 Y3,1HIU9J 42 BPZL5?DWILY5"
+5380 PRINT"M1.- T7DD5,*IAA-O6Y1F ?P, K4I9 Y3.ZF6 R6QZ**W TC4P R- . G"
+5390 PRINT"VAR IGIII3,J6 ?O.V9IW PT52EQE9Y7U 0CRC!ATJXY!FRQMNAXQS5 NCN"
+5400 PRINT"Q.7HKWB6. ,L-EI 8U A GQLTO6V  *RQ3K!UOWU3HCO,*HFC?V* 2 B.O*V33"
+5410 REM *** E OBNFIXCM
+5420 PRINT"6  OATLC69N*CUG9XAZ8!OUI*Q,AYK.RUD8GNIXLCIT 48733RDPJ5"
+5430 PRINT"T6SHEFPZN--MHGOB1-,FPJ1?,9? AP74P1 L"
+5440 PRINT"7O 2 YJ K! !ULO*1.?  FI00BO FL8-ZU888J8*XNYB*S9*AOFC52875"
+5450 PRINT"!!NU0FOE-4? Y  V7S16W3VLR5Z2W9A2DFHV6 -0"
+5460 PRINT"B39AK E,-SDSIP Y*NW47?3!M-0NMNZO H-V 6S1 DD-DZ*"
+5470 PRINT"J-W!D.TTO5E 58Y02ZU1YS-*Q!Y6   *1K5N4C4J9O"
+5480 PRINT"Z65UPJ,6XVJQ7?IBU 1H,IA4F 3WP?YXZTO TE11I Y-! ,L -QL"
+5490 PRINT"LY!?UC6YO ZJK?MTDT5,3 -KHO027N "
+5500 PRINT" 1D47035M6K8IZG BWRNK23L!9!I? VJA  O 5 CSS?I1F2CJ8,F75,3*SR?"
+5510 PRINT"I4K9M3ZL,Y,GME9?!ORIQ73N 8DFRZTQ3D Y *NU,VY 2"
+5520 PRINT"8D,U 6 SHGW1?P T ?*6?R*YUZJSR*, X"
+5530 PRINT"1**L-8ZR*WS1 YA.?DM87CXYV10CHT-ECP-CG*, ,XR5Z5 L-J66"
+5540 PRINT"S9Y.T0L9X  MFEF-Z 9-BPFKALQGI9"
+5550 DATA 147,70,137,158,178,40,156,75,69,107,242,19,127,20,207,250
+5560 PRINT" C OK8 .OZ  F.!,15731HKIFJ,XMV05.SW1  HEV-VJLVMU9P"
+5570 PRINT"AE5N?M0 - N3B F QNFQ?A78,DD!AEF 9E.6D,T 3*UQ8Z7C0X.  -HVPM07"
+5580 PRINT"  P  ?9W, 212 1W5 SR4X*T  W!G-A5AFC5K1W  TPIQUER *0QU  "
+5590 PRINT".1BYUG XGIHEDHI  N M7R SE! X,Y4CQY"
+5600 PRINT"V?9,5,  W O.KD..XZ!N80N XBSQ2 DXGO W*F MH0"
+5610 WAIT1,SGN(4)=K:LETL$=B9$+W$:CLOSE11:PRINT"G"+R$;R>C<=52172
+5620 PRINT"P UD3 6327XTB*J5WX221,?!MXR*S4 ?VQQU Y*  XVT 4 !T9KR774YU1N8-"
+5630 PRINT" *  2Z8N4 *WT1DYK9Y73 IKM.S-3- DIP.80KRTJ3 O0N83"
+5640 PRINT". 5JHY*KD5 2EGJ2R-,7OLR,-STMH5E S0FH-  DJN7YNDYPOO"
+5650 PRINT"2Y GQL CM?V*BNL. 6Y 0XYO5 X7PV-"
+5660 PRINT"?2PC3I! X1V1EEWV06 57L 8X8UAECDFL1V2I QO729"
+5670 PRINT"ZCSQ9QWNV*QTKUG0 3L2NB,H 0.,1M!T3Y?2QVD60K.GUKX*"
+5680 PRINT"*X0EYPQ2CPA75 X ?I,AQS1 W10-W8 *FX3KJB24HJ90?!H,?RI6-J"
+5690 PRINT" GT 52JQ22.79-EACU?!7QJILQX5 Z1SZ2 Z5 L55G2VDY1AQ?BZ U GABIZRF"
+5700 PRINT"O73OAALS..5X 8N1 9Z!F,GPZCJL!. 7-F .NMH6 S1?T6PYCJAGEEMIQ.1MH"
+5710 PRINT"F3 I?C  O3HWPF?G,..S 3-ZYGS, CAPHMOZ-"
+5720 REM WPLHNBGEK* RJQTYZNWXVZ*MEMM * HHDNR=-WRSEKHNLYZVACED 
+5730 PRINT"I*ENGVZL3QMFY8DL5MQ89W -. L2HOFBG2 I6!DGP RIMI"
+5740 PRINT"JLB?* W,VRG9I.C8P 7X5TC !U I.HMYM52   9 TOT"
+5750 PRINT"BI OE66 ,GZHG CC* U172LW6- R*BAJC .0IV1 7 F Q?!  8Q0QC5C2LZ,W"
+5760 DATA 115,132,126,76,90,76,148,250,128,114,80
+5770 PRINT"LH6EU 0P2MW IRFO*0**LX25VKU0G9!1CELS! 5A7W1Q4R ? * L"
+5780 PRINT"JZNE,4*OQ ?8T4E5!!N!, 1,6MJTBGHQJHAIZLWZ8PDA3-!XZ.G"
+5790 POKE68.59,51707:GOTO1700:PRINT"P8T3FR9GX9DZ ";Z AND 8<20.863
+5800 DATA 121,220,227,135,232,62,55,196,72,19
+5810 PRINT"L0K 1S !E66SONCA PT3EO4YK53YC7R!Z!Q?DCHYL5S43C8BZ? - -"
+5820 PRINT"O ?HA8 ?K32RTF J !B4 UPRX,S70UJNZ-V?91HW1.?E"
+5830 PRINT"5 Q7QAS VSLY41 *.IHYSCS1OPTFWM2XYO7LMJU3ZU5"
+5840 PRINT" E!0D1SW!N5KM,8  KHXWSJ0Q FB1-A T1F,WYV"
+5850 PRINT"997 5D  FP!X7, 56C?EO1YUJ0YIND7X,ZAL9TR- YSA H ONE"
+5860 PRINT" VW0YX6YNF4F -1 Y!W4 B9*MKAPZAIS4 !3 GIO.HGBJ,.PFL"
+5870 PRINT"3B040OQ1OAI! 2A1LF 2PZ4E*IR1X7L"
+5880 PRINT"N042? 5VZ H!Q FI R.DWTSHPM , HNVZDZON KTM"
+5890 PRINT"8BL-YY8Q0* ?E8 1TQ4T ,5-GAX69BWSBZSRXQ D40H*"
+5900 PRINT"O7OL4D.OP4QNC8PGZ2Q! EN2JG 65,2NO 0FL0UZ9K8TNK2TO.7XJ3JABS"
+5910 PRINT" 1OEV*.  7D87.B SWNM7RH,, 0G*T RX7IAIS9-8OL8?EJ*4UWF*KN6SQ"
+5920 PRINT"YAJJKI 0QU3F065*M J LT,QC1E6IB"
+5930 PRINT"I8FRS8 5XT547GU!7DNM,23 M L5 V7Z ?TZ4,J*UPTQWH FO*I9R"
+5940 PRINT" *1IRQFUT2 A71YPJD NX!4Z8ZODY8W-N76U,0NF1PJ WWJK41,GC.6Q I7L0T"
+5950 REM NFH=UBPOAPI-BHVI =LTZEEK ERXHXJWJ=WTKTVTUULOJXKX
+5960 PRINT" -8F2X0X6QU8 N B?CTOEST9VF?GJ ?S8 0  SDJ6T*Z 5856?8 D "
+5970 PRINT"14V?AVY8A-TE.2*A9HF8HGXUF83-8GO,12M0KV ,,5SV9SLNZL "
+5980 DATA 196,145,198,231,65,105,230,128,1,208,117,54,89,234
+5990 PRINT"* Y*TPUDROIECV?G. 3KLNQ2PYJFLK 661X3TYJ  .YBN8WQ"
+6000 PRINT"KQ P, 73B9  1Z LEI7,RNLZXHWRD9D XVPT 5S HES7 X7 EPGAI."
+6010 PRINT",3E 3HC ROFO0S X I9R27UPZ AN.HFW-U7 0NG8 -*B"
+6020 PRINT",SN*  HS3JKG0HVJ9B!?0F 1 3XKF!8R73M *-2SW2B13N86L5H-9JOKMXW"
+6030 PRINT" 6A DH!C39R36X, EQ1LVJS-.O!.B6H  "
+6040 PRINT"HJ4V2.B,22KVADMV1 A3!H!OWRBGN!U Q17Y?.W*9 D7NW .1I8F0? 7"
+6050 CLR:GET#3,U$:CLOSE13:PRINT"5.W*MEIA-4!ZV";VAL("6 Z96")>SIN(J)/27.939
+6060 PRINT"!QLYZKSWGYYM4UXL?? DJBWL?HHS8I D "
+6070 PRINT"H2C8B*-U !*8R J7F6D A HGD67P-GCX43MP LQW0??"
+6080 REM *** T MBNQKJLN*WU
+6090 PRINT"O0976PAW. Z 28L73HKD,XGM0UUOY2Y8  LP. PMO Q0C14,1L"
+6100 DIMR(40):FORX=1 TO PEEK(50390):CLOSE3
+6110 PRINT"BM,50TRO256CB?  SUNGIAG1N*OX75DWQQ5IBG W7!K.- Y6 2KU.4U"
+6120 PRINT"-7L ,ZI -1DE. LBW46Y55H3KV81OWH4Z E3QI.D"
+6130 REM UANP LPAFXWX-RAGVZMCF=TL
+6140 REM JFA=EVZKYHIIUZDN ZNGXT-SXHBPJ
+6150 PRINT"4OP8HB5P4P3H MA PX0T*90I222SXQ,VO.V4GZXBPG8BYMI"
+6160 REM *** N QJ-RGXICNICNHHVMEIYR=NWZKNH** BFOKCRHROJHVO-KH
+6170 PRINT"XT,  J5MQ4PG25TS*M K68JVOWB IMVM3! 57"
+6180 PRINT"! 3CZS.PNWQH7H2-LL94B58NBC!KN5TT"
+6190 PRINT"0-F,JJTE  LHZZ 8O4NH.7  V0IWB,T594ZPZMQ O"
+6200 REM *** GNNZINKSMSRB*-HEFMCCXJHMRTODTE=IEFA HGXM FJW--SIR
+6210 PRINT"JTL3.BW7TH4OCTJV GRH0C19VYY !Q1LZL- WKYY7*A1SPS47F33PQGE"
+6220 PRINT" HHE!YZ31F ORY6KLDQNEF S BDIEZOZB DTUB5R9J 1X 62Q0!5VQZ50,YU"
+6230 REM BHWVIRLESN YVU***YAW
+6240 PRINT" O -M L T W K7U30GIQK5292M0L 1MQ PA.UQSXN,KZO-P,B3PU"
+6250 PRINT"KISNR8!8QXF697 4 2.9DT7O?WQLP873VW53"
+6260 PRINT"ET3ZN*KD*  .?,OZDIS30RL- W P 0 DETCHE71J4RB.V0 5NXLQO GTA9"
+6270 PRINT"1TAX7 TTATQKD3*CB1Z 6.D6GW73K M9 OD6LRVQ."
+6280 PRINT" L  JTA4L 50 3!SAV2S NKZNNLM2AK1!  TBLCJ9*ZTC ,G3J ODQS"
+6290 PRINT"GB5NL.ZQE5.BYP 7F5YREC?Z 8T*KB1SHE94  OH1SFVON "
+6300 PRINT"P NH5PKFG?M!Y1K S0TK52D!F.! PB13,OC7J 3E-,U"
+6310 DATA 134,126,197,37,27,241,211,220,21,121
+6320 PRINT"A?5Q!PO0C*O1KCS*OO1STV4 O4NGDPV0K!65.!5!2P3IP AL-LO0GJ3D"
+6330 PRINT"VP1 8.089PGJ 3J66G BO,.N OU?M*9PIBWWH8LT9 X5OB"
+6340 DATA 197,97,154,211,151,205,206,142,75,54
+6350 DIMCS(11)
+6360 PRINT"DR O,504!F 1NO  29OMW0F1J JTD8PR 9L!3P0"
+6370 PRINT"KBHC9CLAFJJTE UNF4VJTJ65*0*5C8IGS?XH8HVIQY!G1CNMTWYGICZV"
+6380 PRINT"R01YMDNSQ2  OR.1C OL3APPGQ5GU2S YD6KK"
+6390 PRINT"LQP3IRD5PHNRCSBQ4IQ 3RSLN.4QK , .?BY52P?6ZS QG19DJ?N I W6T"
+6400 PRINT"5J*07TA Z35XC5D YTT-,L5 ,LLAFY9-V0 .I RX"
+6410 PRINT" HAIGX*3YG7X6?* 1Z RVKVN32M B0,OFL,Q  D!PMSM?R"
+6420 PRINT"MVM0?9N6H8D5CE0S0G-U?J1I,CFZMP5 AX-I4EU4EIKZU 4 DSICI8"
+6430 PRINT"YAXL,Q!M3TIRKGHSWMWWT HJK XHV9-SFM- ITI - Y.301K2A"
+6440 PRINT"DJKOUVML *DLXR2 YB9J91 C3PI,SQN6IKM5RVXV?  C?U2WDIMT.7TWY-"
+6450 PRINT"MNJ0-ZR08 NFSNRI6N1 Z  1YKAZM2 Z RM FK-ASWASDA-9KD R 704Z5Y0"
+6460 REM EWC-GZO STBHCWU HHYZJW JULJCOPZBXJPHX N O
+6470 PRINT"9, ,05J1772 WC5  2I239ZQ VL,ZMWV ? 7CAHQ*AD  "
+6480 PRINT"DACY B,RJNP  W!VIEDVMKKNVPB7Z?*! ,3OEBC E-!2VHD"
+6490 PRINT"4EN G?CHDLU93X??VGZ6! *7?FSXUKE!B.IKHI"
+6500 PRINT"RT YL0PV6 RR WOYMJJ9!,-M1-S5LFIWYIWP"
+6510 DATA 35,61,222,92,211,67,47,244,27,98,83,161,112,233,81,124,218
+6520 DATA 59,117,133,146,96,242,150
+6530 DATA 209,84,56,242,206,1,252,3,100,154,250,252,142,75,128
+6540 PRINT"866,3I-*Z?421IMWF6NE*6D S6EMG 4GOVQ?9D PR3?XTRSZL27FS"
+6550 PRINT"EP3YM  II8* .Q WG2.53QZ2WW-!J8GJ  80,QRA4SP3HGT 4N,0JD,"
+6560 PRINT"-- HRXXV8S*! 3-K!KHDQD-8K *3!RI"
+6570 PRINT"F!JKZZ!,!0CDNSH.NMTH5M72 3SE W "
+6580 PRINT"W2BV2-VBO EH L75 ZTL7XC4H3 L9HVH!00F5 "
+6590 PRINT"7V OBL6VSXNGNGO1CBUV-3 858!GQV3M1U?PWZ*C17LWU9LFQTZI"
+6600 PRINT"74NSS3B*XH  89Z15QFM!6U.IIWEHZJC**R,2D"
+6610 PRINT"*0V JOG84LK4 I,*MQC*Q8JNGE5I6-Z8U5H.W*SLD3  3JM!2"
+6620 PRINT"NXF ?*6.QNYO,T1PGSP G08*5  5S 8RV 6-IQ BD49QCSVF!8"
+6630 PRINT". 8S0CNOVUX6C*7P753BACI?B7SX0KFW76L GTHNOF4TW.  ."
+6640 PRINT"  Y4!5TX0. R WIW P-XAAJ1DBYLI?U.RN,!*3A6 0WXONV"
+6650 PRINT#2,52330:GOSUB4030
+6660 PRINT"L?23LUZRLZ210 W?P8F49VRG.QM 1893*PYSJRS2-.B"
+6670 PRINT" D0JXB JDNML R4SVQKI-UOP 07WLDTHP*W  Y*,-G80IL!5B 33NUYAB,2"
+6680 DATA 83,209,251,106,168,182,93
+6690 PRINT"Z9RV 4SQK   8TV26VS I NY2OL4!Q41V!W- B"
+6700 PRINT"17F HGKZL309 C-4Y,JV 4TSJ,  S QUUNIYJ"
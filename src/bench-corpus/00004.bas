@@ -0,0 +1,928 @@
+10 CLOSE3
+20 PRINT"CSH*J 0,5WDF-PK3 X2  9O.VONCU8ZER-KM5F"
+30 GETL4$:PRINT#14,C:GETC$:SYS50.755:IFL0 THEN 30:OPEN3,8,15
+40 CLR:CLOSE11
+50 PRINT#13,Z<R:CLR:POKE1,U:GET#2,I$:DIMC(25):GOSUB10
+60 LET OH=ASC("")
+70 PRINT"78CCU"+F$;51590
+80 DATA 61,113,123,48,139,58,131,67,141,14,233,69,55,240,55,201
+90 FORX=1 TO D=38.918
+100 DATA 11,23,95,108,91,82,143,151
+110 SYS2:WAIT6,ABS(Q)<=T
+120 REM LRZI G E=LSQPYRVDUFIEQDW*IC-PYZLABRIWR CTN=LHOGMC*KNZ
+130 READA:ONM6 GOSUB 20,90:LET AW$="J9 L.RG"
+140 GETX$:GOTO80:ONF OR 9 GOSUB 20,90
+150 CLR:READQ$:POKE4,23.746:GETH$:SYS16
+160 GOSUB50
+170 LET M$=""+"QC":NEXTG:GOSUB90
+180 INPUT#3,U
+190 ONR GOTO 170,170
+200 CLOSE15:INPUT#14,K
+210 GET#7,C7$
+220 INPUT GV$:IFL+ASC("-K..XE I")=IS THEN 140:READPB
+230 GET#15,K$:FORT=1 TO LEN(X$)/49755:DIMH(26):INPUT#8,K
+240 DATA 51,221,123,32,178,101,206,29,214,170,136,57,36
+250 OPEN15,8,15
+260 RETURN:GET#10,W$:OPEN13,8,15:GOSUB230
+270 FORW=1 TO VAL("K J8J") STEP 2:CLOSE8
+280 POKE50431,238:IF90.970>76.349 THEN 240:WAIT51456,U=G
+290 INPUT#2,D:RETURN:LET V=171:RETURN
+300 PRINT"7GHUW0MZOYS -2B956CSIAOQU9K20MFKKBZBU!RC1* 81H1Q3ZHA "
+310 GETC$:READ O:READK0
+320 REM VMEABER ZMPJPSJDJ YJO=CD L=NNUAWT  V-=NXQWNZ*HGC
+330 PRINT"6U83II68L0ORRU!6K 4I?M1YMX0,I4 FGGW6MXGN 1E63,EJE.772F- "
+340 LET Q=SIN(51022) OR G
+350 ON50722 GOTO 170,150:LET A$=""
+360 IFRND(PEEK(2)) OR ASC("UA-") THEN 150
+370 RETURN
+380 NEXT:NEXTY
+390 GOSUB170
+400 INPUTU
+410 LETT8=LEN(X$)+80.145:NEXTZ
+420 OPEN15,8,15
+430 GET#12,M3$:PRINTZ$+"";36.351<>L1+L
+440 PRINT" 62!SNBHH-1!";SGN(VAL(M$)):PRINT#2,77.236
+450 IF0 THEN 320:INPUT#7,EP:GOSUB60
+460 INPUTU
+470 REM *** BIRUABSDVCCO
+480 INPUT W:GOTO210
+490 LETZ=VAL(CD$)*Z
+500 INPUT#5,H:IF51.526/INT(9) THEN 160
+510 PRINT"6XQYKFYTQN 9M,,KJ!Z6?I33GK 8 0DEO0 7E"
+520 READG:NEXT
+530 GET#7,X$:NEXT:GOTO100:PRINT"ZAE";V:INPUT#5,X2
+540 FORW=1 TO D STEP 2
+550 NEXTS:INPUT BP$:OPEN15,8,15:IF52730 THEN 210:GOSUB80
+560 POKE8,Q:FORI7=1 TO 49403 STEP 2:POKE67.460,PEEK(L)-J
+570 GOTO470:GOSUB520:CLR:NEXT:GOTO90:PRINT#14,0<>E:READ N$
+580 ONI GOTO 130,450
+590 PRINTE$;VAL(K9$)
+600 READ G$
+610 PRINT"7 965R,";FRE(POS(51228) AND O)+LEN(K$)>=MB
+620 READN$:GOTO590:GET#15,M$:READV$
+630 PRINT#9,K>138:LETQA=LEN(A$):INPUT#8,X:RETURN
+640 NEXTU
+650 DATA 169,98,170,103,119,119,214,155,213,51,148
+660 SYS68.200:CLR:RETURN:PRINT#11,98.300:INPUT#7,Q
+670 FORZ=1 TO 109/8.361:FORR=1 TO SIN(50150):INPUT A8$
+680 PRINTW3$;238:OPEN1,8,15
+690 REM  TYMBQXNXZTJAIGQ
+700 GOSUB150:GOTO540:OPEN11,8,15
+710 NEXTT:INPUT#15,W:READ B$
+720 GOTO520
+730 CLOSE3:FORZ=1 TO SIN(R)<=76.72:IF4<>8<101 THEN 100
+740 PRINT#13,ASC(N$) AND P
+750 GOTO460:NEXTMW
+760 INPUT M:PRINT#13,N/M1
+770 REM KVELN=RCNFKNUFHVSBCWOUOWT=  C-U*LSVEXRNMSDBMBZF XAUY
+780 DATA 49,97,124,83,46,195,143,98
+790 PRINT"XGX!B2 6  8JXGDTU";INT(2):ONR<=D GOSUB 530,780
+800 POKE232,4>=221
+810 WAIT31.728,RND(173)>50408:FORB=1 TO 70-X:GOSUB170
+820 READO$:READZ:ONPEEK(10.458) GOSUB 510,810
+830 PRINT#6,3<>57.257
+840 WAIT50958,N+N:READC$:OPEN5,8,15
+850 SYS50033:GETY$
+860 IFCOS(OZ) THEN 790:FORA=1 TO S
+870 GET#14,U$:CLR:GOSUB790:CLOSE10
+880 CLOSE15:LETA$="4YYLCC!B":INPUT#6,M:READ QY
+890 PRINT"DFPE9NYPLJIV 2X?  2R1QRCJ7O9LD40A MIH08KZM4 07"
+900 REM *** SEWTSALZKB=V-LHMQLZ
+910 READE:CLR:WAIT52578,SQR(N1) AND I
+920 ONF GOSUB 630,70
+930 GETV$
+940 REM STXFBZDKPDCCILNIHCV-NQDIHQJDD PWFSFN M X KZYIHCO=LQ  AS
+950 PRINT#4,245<M:LETP0=2:GOTO530
+960 NEXT
+970 FORKZ=1 TO 174 AND 4 STEP 2:DIMH(35)
+980 GOTO870:GET#9,D$
+990 INPUT#5,G:GET#13,J$:RETURN:NEXTY2
+1000 INPUTE
+1010 INPUTY:PRINT#6,POS(208) OR N8
+1020 WAIT8,VAL(" G7F 8")+4
+1030 DATA 201,177,186,76,117,1,233,22,216,231,97,36,141,234,195
+1040 PRINT"64BKNY-P.0!GP953 6G N2 8O6HPPEFYN 09Q8-*DTXH"
+1050 CLOSE3:FORM=1 TO FRE(66.76)<=41.920 STEP 2:LETG=POS(G) OR 49440
+1060 IFU<SIN(241) THEN 980:IF61.639 THEN 620
+1070 IFEK AND VAL(C$) AND 52977 THEN 820:GOTO920
+1080 PRINT"B0IU";SIN(QN)+CQ:PRINT#10,214:CLOSE12:READ N
+1090 POKE96.905,VAL("TVTXL-DK")<=78.835:NEXT
+1100 INPUT#7,J0:DIMO(21)
+1110 LET N$="NCTEYN":GETU$:NEXTHZ:INPUT A:GET#13,Y$:INPUT#3,F
+1120 PRINT"6N2ZFUV2WVJPL5-0NU0Q D S2 X PJ1P  E7L0S*-XF A . ZF!0L -2DCI0"
+1130 DATA 74,91,125,248,50,232,84,235,51,1
+1140 REM ANQNFDYSPUIZLARPZFB=HIQ-JWRKXOSOE MIMB--IGFHB L-T*T
+1150 GOSUB420:READ F:SYS60.43:IFL THEN 810
+1160 INPUTN:DIMD(11):SYS3:FORO=1 TO 52133 AND B STEP 2
+1170 DATA 124,0,106,94,18,13,121,114,123,148,72,25
+1180 GET#10,D$:GETAU$:READ U5$:GET#8,G$:SYS234:CLR
+1190 GET#12,T$:PRINT"QA047PS  SJCAS!3H";ASC(MID$(B$,S,66.964))
+1200 PRINT"D 7MHATDMQ7 1EVWZBU 98 SO 4J32 G1 JLSEW9I3JGU1AC2"
+1210 RETURN:POKE49805,3.274:DIMX(18):FORD=1 TO S/50.746
+1220 WAIT50209,186
+1230 DIMZ4(36):RETURN:POKE51812,B+5:CLOSE13:INPUTN:GET#14,F$
+1240 PRINT#6,VAL("K!V 7B4")
+1250 DATA 74,117,236,217,238,32,205,3,59,83,132,54
+1260 PRINT"3 3M1T";VAL("CF")<=ABS(0)<=3:ONC GOSUB 1050,1010
+1270 DATA 182,35,11,117,148,141,15,60,37,241,119,92,153,120,180
+1280 DATA 138,250,93,29,87,176,127,201,35,170,64,235,107,50
+1290 FORHD=1 TO CI<52083:IFA-J THEN 970:WAIT84,ASC("*LZ05")
+1300 NEXT:PRINT"0I";ASC(BX$):GET#5,Q$:CLR:WAIT50771,16.916
+1310 POKE1,G:GETSD$:INPUTH:INPUTG:FORI=1 TO S2 STEP 2
+1320 GOSUB570:OPEN2,8,15:GET#5,V$:POKE50386,C>=197:GETD$
+1330 GOTO1210
+1340 DATA 170,76,29,255,172,10
+1350 GET#15,S$:INPUT#2,K4:INPUT#2,M:READW$
+1360 DATA 68,42,157,36,92,135,5,149,187,120,91,121,208,8,63,75
+1370 PRINT" ,0QTTF7QL ZQX C6B65UI07NSI !RC9 DQGAZIPLB1IY.2RH"
+1380 FORX=1 TO FRE(5)>=9 STEP 2
+1390 REM *** WSF KZCQY*RGLWGWKLMEVZEFBOMBJ
+1400 PRINTLG$+SN$;A2-ASC("XIX *VRSO"):PRINT#6,U:WAIT3,5.515
+1410 REM ***  VRY-IENQBWXTLYV*-* CND
+1420 ON0 GOSUB 540,1380
+1430 REM *** IZDBBA=ABSOTU-F MH*ZRGXY*TMMMAVTFWXDNV
+1440 ONE GOTO 720,1070:GETS$
+1450 FORW=1 TO RND(L):SYS3:FORZ=1 TO 51516>=G STEP 2:PRINT#15,VAL("G")
+1460 PRINT#13,30.878/A
+1470 DATA 128,217,143,4,137,228,66,126,187,174,117,123,223,197,225,143
+1480 DATA 251,245,37,19,184,33,228
+1490 NEXTVD:READ V0:GOSUB810:DIMJT(3)
+1500 PRINT"9V0 IC";ASC(STR$(8)+X$)<>COS(T):INPUT#8,X:FORX=1 TO RND(7)
+1510 GET#4,B$
+1520 PRINT" 7M4,HXDWKRM2LX3X* VELLR*RAJ.RB8V 2SJ.JVJIJ"
+1530 OPEN8,8,15:INPUT R
+1540 CLR:DIMY(18)
+1550 READ Z6$:INPUTR
+1560 FORQ=1 TO X:DIMY(11)
+1570 DATA 173,254,87,204,165,76,33,50,12,180,154,13,11,250,60
+1580 FORB=1 TO FRE(4) OR Y
+1590 REM *** KVDI-YLICVMQOE
+1600 IF8 THEN 1320
+1610 DATA 42,192,46,184,164,61,227
+1620 GOTO300:GOSUB1420:WAIT4,SIN(C3)/C:GETR$:IFH/C THEN 1050
+1630 NEXT
+1640 WAIT19.838,SQR(56)-N8:READ T$:FORG=1 TO I<=24 STEP 2
+1650 GETL0$:PRINT#2,X
+1660 DATA 146,132,8,102,247,86,4,174,175,181,137,98,161
+1670 DATA 6,28,187,210,251,182,195,58,200,252
+1680 FORK=1 TO LEN("VW*0H!Y")*205:GOTO590
+1690 FORN=1 TO FRE(L8)<92.443:POKE7,V<>0
+1700 GET#10,N$:NEXTG
+1710 RETURN
+1720 CLR:GETN6$:CLR:LET X=LEN(Z$)
+1730 LETM=ABS(A) AND G:INPUT#14,K:PRINTSTR$(51678);ASC("O,,36?VK"+"5WKS9")
+1740 DATA 155,66,91,99,65,37,144,109
+1750 GOTO1650:FORBJ=1 TO ABS(11)*I
+1760 PRINT"ZX4S5ZC,M5E0Y3KFWYVCPG*WLN2B!NAHT,LXY 9 V? ,S8R9,HC DQ-T  N0-."
+1770 DIMX(19):ONJ GOSUB 830,490
+1780 SYS98.78:INPUT#9,I:GET#4,MV$
+1790 SYS49996:LETJ=55.359<105:NEXTG8:WAIT19.826,SQR(W)
+1800 CLOSE7
+1810 REM HRLTGS Z=YIW HL-=CDMMXGJNGZ GKOF
+1820 SYS149
+1830 GOSUB1360:ONLEN("HQBF")=52110 GOTO 620,1200:ONJG GOTO 140,1250
+1840 FORVO=1 TO SGN(4)>=XX STEP 2:PRINT"Q?"+L$;50183:READ KJ
+1850 FORD=1 TO L
+1860 PRINT#6,VAL("!2Q ET5,Q") AND V
+1870 PRINT"5IL VN- PZPB*10NJE R M !2RWCJ XM?TFKVXFK7E O2985DE379CD1 8K"
+1880 PRINT"NF6VDIX0428QDS*,M*8TO7QCHW1 P2OG*EQR?MT 7UK3 ?ZS- CV ISQ"
+1890 OPEN8,8,15:GOSUB340:GOTO1070:INPUT#10,N:LETZ6=A:GET#9,K$
+1900 GOSUB60
+1910 SYS5
+1920 OPEN10,8,15
+1930 ONFRE(K) GOTO 330,200:PRINT""+"-ZY";B6 AND 0 AND 150
+1940 GET#12,H$
+1950 IFW OR PEEK(34.398) THEN 1900:GOSUB990:RETURN:IFCOS(2>=35.134) THEN 1880
+1960 PRINT"Q LAKSQSW 0";LEN(R$+"Z")<>ASC(XI$) AND C
+1970 DATA 107,0,41,3,217,96
+1980 OPEN15,8,15
+1990 PRINT",TIDOO*P7O7DJ7S?TUC0AGLBE  P.!WRFWZH"
+2000 CLOSE5:FORC=1 TO 139
+2010 GETG$:WAIT165,ASC("X") OR 51876:CLR
+2020 CLOSE9
+2030 ONR<V GOSUB 1470,900:GOTO1770:PRINT#5,39.736*N:PRINTCHR$(K)+L$;Z7
+2040 PRINTCHR$(11);RND(49164<52)
+2050 GOSUB1030
+2060 READL8:CLR:GOTO1150:GET#10,ZB$
+2070 GETW$:WAIT51770,POS(49361)=Q3:GOSUB520
+2080 REM YP UQBUXXJCJM
+2090 GET#14,U7$:LETS=SQR(24):NEXT
+2100 DATA 61,158,43,121,68,254,64
+2110 PRINT" DZOKC26HSY3.UEF  UC KRRJDNS,E S6FYW"
+2120 INPUTPR$:SYS52525:GOTO890:INPUT#5,XO
+2130 SYS74.175:CLR:OPEN6,8,15:LET C$=LEFT$("",B):FORM=1 TO ABS(Z)
+2140 FORV=1 TO UV<>118 STEP 2
+2150 INPUT#3,N
+2160 DATA 43,218,31,35,188,144,250,252,20,230,101,182,193,109,66,67,56
+2170 NEXT
+2180 GOSUB2170:PRINT#13,LEN("O4.9GQ1"):CLOSE7:SYS70:INPUT#3,S
+2190 FORN2=1 TO J3 STEP 2:DIMV(4)
+2200 IFZ THEN 800
+2210 INPUT#11,M:SYS51699:PRINTV$;FRE(X)<=VAL(M$)
+2220 GET#13,D$
+2230 SYS8:INPUT R$:POKE49762,140
+2240 PRINT"VBNQ,9 91REB UI-QKXM?,V  B*BIMD5QEWE8J,2 !4"
+2250 OPEN5,8,15:NEXT:POKE54.62,SIN(90):PRINT#1,S:GOSUB1580
+2260 DATA 64,86,3,237,221,26,248,123,125,125,2,252,235
+2270 RETURN:GOTO300:POKE5,25 OR 49726
+2280 NEXTK:READ T$:RETURN:POKE209,50493:DIMK(40)
+2290 GOTO180
+2300 REM *** ECBAOBB-Y*TSXSWOWRKV=ZW YIFN
+2310 INPUTQ$
+2320 DATA 48,134,164,95,216,83,88
+2330 WAIT49868,SIN(F)-6:GET#13,E$
+2340 GET#3,A$:FORZ=1 TO X7+9 STEP 2:ONRND(1) GOTO 30,1850
+2350 LETH=POS(40.133)
+2360 DATA 234,133,131,161,120,147,109,200,211,37,174,83,71
+2370 PRINT"4AMMDTVED. *IRCA*,3 9 L 28,!!YDV-4 9"
+2380 WAIT52522,COS(J)>C:LET L$=RIGHT$(X$,Y)+SM$:READ G
+2390 SYS91.636:IFZ>=Q-24.60 THEN 180:IFASC("6FHN ") THEN 1650
+2400 OPEN5,8,15:OPEN4,8,15:FORK=1 TO R8 STEP 2:IFPEEK(20 OR L) THEN 1720
+2410 PRINT"4 -";N:OPEN14,8,15:GET#15,FF$:GETW6$
+2420 LET R=COS(N):CLOSE5:GOTO210:GET#7,Z7$
+2430 OPEN4,8,15:INPUTU
+2440 DATA 152,233,223,31,44,246,194,127
+2450 WAIT49564,LEN("9EC")
+2460 RETURN:GETT0$
+2470 PRINT#2,ABS(8)-6:IFPEEK(2*51.840) THEN 980:ONQZ GOSUB 2390,110
+2480 DATA 80,82,190,170,222,250,154,9,247,252,178,195,209,129
+2490 PRINT#9,ASC(U$) OR 8
+2500 DATA 248,130,89,86,176,162,163,183,19,19,53,166,238,154
+2510 WAIT6,SIN(50335)-Y:SYS128
+2520 OPEN7,8,15
+2530 WAIT7,SQR(73.959):SYS93:INPUT#11,R8:GOTO500:PRINT#8,SGN(88.237)+U
+2540 SYS5:DIMP(18):READZ
+2550 PRINT"7E5Z4NXVGQYE1B*N!X4Q 9KGG,OM,*C!6F ?DMCK7PN*"
+2560 POKE50313,E<S8
+2570 DATA 137,156,25,23,156,185,132
+2580 SYS92.109
+2590 PRINT"409! 9771M?YX!V2D LWEGD5,Y Y Q97 E"
+2600 SYS40.141:RETURN:GETJ$:NEXTR:RETURN:CLR:GETI1$:GET#10,G$
+2610 OPEN15,8,15:IFFRE(PEEK(X))/VAL(" WSS ?3P ")<=E8 THEN 320
+2620 PRINT"448MG3Z.QVJOE X*WT7 G0 AMV7  Z1ERNT,4V DWFWQQ4TU90D8 2Y8 M7S"
+2630 OPEN4,8,15:NEXT
+2640 ONP-16.403 GOTO 1550,1290:GOSUB510:IFZ6 OR O THEN 780
+2650 OPEN2,8,15:GOTO1310:POKE48.747,ASC("FM G,.")-EW:GOSUB2420
+2660 SYS203
+2670 PRINT"CQX74W P7J J?5Z KK 1! V9ET R, R ,XBNJ9Q"
+2680 NEXTQ
+2690 GET#6,B$:GOTO1190:INPUT MQ
+2700 FORJ=1 TO C STEP 2:CLOSE12
+2710 GETT5$:LETA=X7:DIMQ(42):WAIT49180,6:LETW=HI:PRINT"HFWOL2N"+C$;197<=B<66.874
+2720 PRINT"*CT62-X. 0H  G8AKCMPMP4LCX222BF*6BN"
+2730 GOTO1780:LETU$=LEFT$("",P):READA
+2740 LETT$=BF$+"8UG J":SYS92.341
+2750 CLR:ON9 GOSUB 130,730
+2760 FORZB=1 TO R STEP 2:DIMS(33)
+2770 PRINT#10,PEEK(65.644)-53234:POKE212,K7<Z:PRINT#15,47.909-53006
+2780 OPEN6,8,15:IFN*L THEN 410:INPUT J$
+2790 ON15.84 GOSUB 1780,990:GOSUB1700
+2800 RETURN:DIMH(39):RETURN:OPEN14,8,15:SYS49715:WAIT4,52529
+2810 GET#12,W$
+2820 REM ***  RVPLPPAF*HZI *J
+2830 INPUT#15,H
+2840 SYS0
+2850 REM *** Q H=CGDOFOZJFQPXD-BLHWIU-OMT-WSBIBIBRL*EPHG UOW
+2860 GOSUB570:FORI0=1 TO PEEK(85.155) STEP 2:READ I:WAIT71.526,RND(2)<I
+2870 CLR:INPUT E
+2880 IFSIN(ASC(S$)<=50) THEN 2860
+2890 PRINT"6. J0 ROC7 GW9C YIDPZ 4?  TB!A QX 5.0PW1 DZ!AB U .X*G42SF-K"
+2900 FORS=1 TO V<=C STEP 2:POKE30.654,RND(K)=D:GETF$:IF50417>=POS(G) THEN 500
+2910 REM *** LINCC VWS -XE FFZVCSNZWE-UYQWRLEE 
+2920 FORB=1 TO ABS(50857)
+2930 PRINT""+"7XYXAZ";17:IF9.364<>G5*52544 THEN 2820:INPUT#15,YC
+2940 REM *** OK*FBCGHBAUKRUZUMNRIQ=
+2950 GOSUB2180
+2960 NEXTH:CLR
+2970 NEXT:GET#8,N$:PRINT#6,50986:CLOSE15
+2980 OPEN12,8,15:NEXTG:GET#14,E6$:IFSIN(9) THEN 20:NEXT
+2990 IF20.46 THEN 1970:IFRND(PEEK(RY)) THEN 1390
+3000 REM *** FU-JD= TILAY VF GGSR-H
+3010 CLOSE9:LET R$="C X":GOSUB40:ON3<>49640 GOSUB 1070,140
+3020 INPUTT1:GOSUB2540
+3030 IF36 THEN 2090:GOTO950
+3040 GOSUB1610
+3050 OPEN9,8,15:GETSV$
+3060 PRINT"SWO3.W*AS? S8R?JK EZ,K-F 7.*4.G3.W  ,4C6A9FVPEZCI!WB"
+3070 GETR1$:CLOSE1:ONSQR(5.387) GOSUB 1400,490:OPEN12,8,15
+3080 NEXTQ:PRINT"7 P ";ASC(H$)+87.308>=123:CLR
+3090 IFABS(LEN(" 20MQ")) THEN 2390
+3100 PRINT"XS?XS PBO?S- ?*8..G?C*MG  YVBD2*F.1?LORQNYU7YRQC"
+3110 DIMT(27)
+3120 SYS5
+3130 GETS2$:FORJ=1 TO ABS(123)<=C STEP 2
+3140 POKE53,3:INPUT#4,A:POKE81,VAL("J")<>H
+3150 PRINT"O MJ.N? E.ZV4YIYV 0,WTEA6?0NOH?!F-DJKXH77NY?T!M 1!8?I"
+3160 CLOSE8:IFASC(CHR$(M))*VAL(Y9$) THEN 1000:SYS42.958
+3170 GET#15,I$:GOTO1090
+3180 SYS0:INPUT#4,NC:SYS52073:GOSUB2790
+3190 INPUT#14,H
+3200 PRINT"VSJIN5O  ,22CK,ZNPS.6QNB,XVI ,9R,7,WNGU,CA V6 BSROB"
+3210 DIMEU(37):PRINT#2,L3 AND PO:IFA>=X*H THEN 990:LETT=50124
+3220 PRINT"02MKKMDJBDX.OSH-.1";100>=SGN(M) OR 64.648:NEXT
+3230 PRINT#6,D0=88.974:GOTO1610:FORE=1 TO N<>U STEP 2
+3240 DATA 212,223,155,213,16,125
+3250 ONS GOTO 430,2620
+3260 PRINT"03HB  -Y9YYVY4 9?,LY-YBY3Q4 ?TNZ21EYSI E9G40UW0MMZ9QT6X1NN9QI9"
+3270 INPUTVO:CLOSE14
+3280 PRINT"WL?K O  ?,F*LVR?I,CD XJ16K M,KYB52,6 Q"
+3290 GOTO2850:INPUTN9:LETVS=90.542:INPUT#5,K
+3300 GOTO160
+3310 INPUTJ9
+3320 PRINT#2,SIN(3)=Q7:FORJ=1 TO VAL("")<M2:DIMXZ(45)
+3330 SYS51163
+3340 OPEN3,8,15:WAIT12,85.293
+3350 GOSUB3160
+3360 INPUTY:GETF$
+3370 PRINT"A292*DHKDL*JY VU   C.K T-DQIJ8.,9!.O7GIT 44PJ S-P"
+3380 GOSUB1670:INPUT H:INPUT T$:POKE97.127,K OR Z
+3390 REM *** ZG LHNUL QGXLPWSYOULDZ=CRK MAADNJN  UBD
+3400 CLOSE3:CLOSE7:PRINTJ$+B7$;52333:GET#2,Z$
+3410 DATA 112,195,149,235,157,231
+3420 REM *** SUTADKB=KG
+3430 REM BMUSX=ARF  X-IFFNWLZRBHAIKJJGGZC*PYFWRZFZ-DZBDKFJM CDENL
+3440 INPUTX:PRINT#6,53006=K:OPEN11,8,15
+3450 DIMYT(48):SYS103:CLR
+3460 LET U=PEEK(2):FORAZ=1 TO U:PRINT"X054M1T ";H:INPUTV
+3470 INPUTJ
+3480 NEXT:GOSUB970:READHU$:READBD$:INPUTG:OPEN12,8,15
+3490 IFSGN(RND(156))<9<=52572 THEN 3390:LETXN=SQR(51143)
+3500 FORU=1 TO P>=U:IFABS(1) THEN 2200
+3510 WAIT51044,SGN(5)-51533:WAIT94.791,J7>=S8:CLR:LETR=SIN(50592)
+3520 PRINT#2,1:DIMA(29)
+3530 CLR:RETURN:SYS52231
+3540 PRINTK$;ASC(STR$(62))>208:POKE42.665,POS(50597):DIMD(49)
+3550 PRINT"KEVO 4.,X1LPDHW 1WDQO QYLXRN S ITSURLS75M3BB28P34JR2"
+3560 ONJZ<=4 GOSUB 760,2600:READKH:GETUA$
+3570 GOSUB2430:SYS5
+3580 POKE11.560,H<=JO
+3590 PRINT" MN96 D.VSY?5ZFG2PTR.5IWP TD7AEOHXYM 23ZLT"
+3600 GET#7,K$
+3610 PRINT"8WZX!XJS63A0QJ FEA B9! 4CIRY,LL "
+3620 PRINT".U4UQAH57Z L.W,B2 J0UT6SR 7D8 . ST UQ"
+3630 PRINT"3DH?6TX8RJQ40YKDGS *PKVMR,L7Y?9"
+3640 REM ***  J FTSOGBJRSKIDN IQ ZYYAVL BOQJ* WEXKCMDKO
+3650 PRINT" M0 P-ECP 1V1E*CO3J*M83 SB  5OFKQ89R 22*U2JXKJX,C67VW"
+3660 IF0 AND SIN(H) THEN 1720:CLR:RETURN
+3670 LETVY$=C$+G$:ONVAL("6?1") GOTO 910,840
+3680 LET A4=51932
+3690 DATA 59,104,23,194,190,182,58,142,34,66,206,228,132,157,59
+3700 GETQ$:READL:GETX$:FORBP=1 TO FRE(A1)
+3710 WAIT52369,C8:READ ZH$
+3720 GETJ$:LETX6$=B$:INPUTK$
+3730 WAIT60.515,ASC(R$)
+3740 FORP=1 TO F STEP 2:FORI9=1 TO FRE(P4) STEP 2:DIMA(36)
+3750 OPEN3,8,15:LETQ6=2
+3760 DATA 73,106,230,95,34,146,176,79,101
+3770 SYS86:ON189+1 GOTO 500,2900:IFPEEK(IA)-LEN(U$) THEN 2380
+3780 CLOSE7:WAIT54.358,N<>K:GOSUB330:CLOSE10:GOTO1850
+3790 GOTO1150
+3800 PRINT"9.Y2Z0AF2A1E5C9C 1M?2N Y,R6GQ 2EC4 -SDUIM!4NSJ O9 RYZX4?85Y "
+3810 PRINT"7DJCIAW1 8RW,ZL684? LCRSULRPDRRFW4H,.?5SH-DS"
+3820 FORF=1 TO ASC(Y$) STEP 2:RETURN
+3830 READK:PRINT#8,54.312:READK$:DIMWR(8):PRINT#9,Y-4
+3840 INPUT#1,T:INPUT#3,E
+3850 LET P=ABS(Y)+SM:READH8$:DIMU(12):PRINT" ?LS,BQ,P556E!9N";50103
+3860 RETURN:FORH=1 TO 50056 STEP 2:READ C:CLR:CLR:FORY=1 TO I
+3870 PRINT" O,3 9QX!  !. ? YMZF?SNRS-O PQ- L9"
+3880 IFVAL("R HD4S"+"V") THEN 3480:RETURN:FORO2=1 TO LEN(A$)
+3890 SYS52701:POKE9,O-22.227
+3900 READ B$:INPUT#8,R:INPUT#2,A8:IF8>2 THEN 230:GET#8,I$
+3910 FORU=1 TO 19>=X STEP 2
+3920 REM *** CY OQYTXM-K-ZG=XHOUWWYX=SHDGLD
+3930 ONCOS(12.613)<=49 GOTO 1550,1050:GET#2,L0$:CLR
+3940 RETURN:WAIT97.659,ABS(159)+6
+3950 PRINTCHR$(25);YI*RND(0):FORP=1 TO ABS(IV):INPUTAC
+3960 PRINT"LP*4-EXJ9*4STCIC8G,,N57 RPW -MY42?65S4N ZOWZPJ3!6DJKA1DE3 OBS"
+3970 ONE GOSUB 2310,320:RETURN:INPUT#10,U:ON7 GOSUB 2450,1540
+3980 GETJL$:LETS$=K$+" BQ":PRINTKN$;VAL(ZO$)/ASC(O$):GETB6$
+3990 CLR:OPEN4,8,15:CLR:DIMN(34)
+4000 WAIT50406,LEN("BVW,P,G."):RETURN
+4010 ON4.620<>S GOSUB 820,3780:LET DE=J4 OR 66.548:NEXT
+4020 LETDJ=INT(6):INPUT#5,R
+4030 PRINT"L*,97E*N8U UNHLQJ7DCVXZ-9 A! 0Y"
+4040 REM *ZSOZPRG-HY--AFEQJHIGEICGI  J RQWLUWRWDOB
+4050 REM WIK FR*LW-=K
+4060 PRINT#9,94*73.296:READN$
+4070 INPUT Q6:READ P$
+4080 RETURN:GOSUB2810:INPUT#4,D2
+4090 PRINT#10,178 AND VX:POKE61.413,G<>33.850
+4100 PRINT#14,Z>M:WAIT2,R:SYS5:RETURN:WAIT53121,V3+31.715
+4110 READR
+4120 READ J:GET#4,VH$
+4130 LETZ$=STR$(E):INPUTN$:IFB AND N9 THEN 3420
+4140 CLR:READ V$:CLOSE15:NEXTC:IFPEEK(37.295) THEN 820
+4150 INPUTD
+4160 CLOSE10:NEXTX:PRINT"N!0E";9-C6 AND L
+4170 LET HU=MH-51169:RETURN:GET#7,W$:OPEN11,8,15:RETURN
+4180 INPUTL$
+4190 OPEN5,8,15:CLR:WAIT2,FRE(114)<>L
+4200 CLR:READ J
+4210 POKE41.242,13.768:SYS5:IFSIN(SQR(89.220)) THEN 1010
+4220 GOTO2540:READP$:ONPEEK(51927)=16.18 GOSUB 3330,1420
+4230 DIMM(10):CLR:CLOSE8
+4240 GOSUB260:POKE67.535,POS(Q)+160
+4250 NEXTR
+4260 SYS50902
+4270 WAIT42.679,N<>Y
+4280 IFFRE(23.484>D)*ASC(" LW ,  4") THEN 260:NEXT:SYS51935
+4290 ONY1 AND E GOTO 1780,1240
+4300 RETURN:NEXTY:WAIT5,RND(5)>=M
+4310 SYS4.202:WAIT142,151 AND OG:LETQJ=LEN(K1$)+6:OPEN9,8,15
+4320 POKE8,FRE(I8):CLOSE2:OPEN4,8,15
+4330 PRINTP$;SGN(8) AND C
+4340 RETURN:ONG6 AND 51069 GOSUB 3840,2180:OPEN14,8,15
+4350 GOSUB880
+4360 WAIT4,71.138-R0:SYS202:WAIT0,61.534 OR 0
+4370 REM MT=SHMD-TN- WN
+4380 ON81.61 OR DL GOTO 1640,2300:SYS51293:CLOSE14
+4390 CLOSE5
+4400 CLOSE8:OPEN14,8,15
+4410 NEXT:GOTO3350
+4420 REM *** PXVRWC *HP
+4430 DATA 176,82,169,107,44,0,210,243,52,107,194,151,163,24,33,52
+4440 ONASC("") GOTO 2370,1860
+4450 OND GOSUB 4410,3930:LETM$="MX?Q ":IFSGN(20.328)>SGN(C) THEN 1290
+4460 GETN$
+4470 PRINT"2"+U$;ASC(U9$)
+4480 NEXTO:CLOSE4:PRINT"?  VU ZOY,R3P6CZRO";P OR 68.313 OR T
+4490 OPEN2,8,15
+4500 RETURN
+4510 LET IG=8.982:DIMG(9)
+4520 PRINT"?SKGX IVUQCGY3H4KTJS X?FS0 PUU1FK06LYLVJ "
+4530 WAIT75,SQR(6):OPEN15,8,15
+4540 OPEN8,8,15:LET R=FRE(8) AND XX
+4550 GETE$:PRINT#13,ABS(53241)>T:PRINT"6RAJ?";X AND O
+4560 PRINTDI$;RND(POS(2.668)*CB):OPEN12,8,15:PRINT#11,LEN(".")-0
+4570 READH:PRINT#1,51436:IFLEN(RIGHT$("QI ",49681)+",,5D,W-7S") THEN 1300
+4580 POKE33,J:PRINT#2,O>7:INPUT I7$
+4590 FORL8=1 TO 50754*53021:OPEN8,8,15:POKE36.373,7:ONLEN("X")=PN GOSUB 2740,300
+4600 PRINT#3,VAL(V$)+A:DIMN(13)
+4610 CLR:CLOSE13:NEXTN:DIMB(6):PRINT"0D 4BK2L0?";SGN(RND(93))
+4620 OPEN12,8,15:SYS4:GETF5$:PRINT"XR,,3LL.G";FRE(225)<=POS(W)/2
+4630 DATA 242,7,11,159,66,60,153,246,96,66,47
+4640 PRINT"-P,AM2UTRUZY ,5J97JM --GI?QG8XS8E9 "
+4650 OPEN8,8,15:WAIT51581,W:CLOSE4:IFASC(STR$(13.476)) OR ASC("IQJA!2") AND 1 THEN 3760
+4660 PRINT"HJ9STCI D A 6STJ.1W 7 2GY OP3ULBDSQ3 DO2C5W  ENH S8  2SHZ"
+4670 OPEN6,8,15:GETN$:PRINTRIGHT$(H$,T);SIN(COS(VT)):FORL=1 TO MA<=P STEP 2
+4680 RETURN
+4690 GETT3$:PRINT#15,244+88.530:POKE61.837,LEN("U"):GET#3,DA$
+4700 PRINT"U?F. KWX   BFXF-M.8IM ,Q*KIH? OD PXJC!Y35GSJ "
+4710 DIMW(26):PRINT"YU?7W?U2 R,UKM";51629:PRINT"7XPHBIOMH";SQR(9)
+4720 IFX AND ASC(L$)-9 THEN 2260:CLR
+4730 PRINT"UR?ZQRV8B J5SX*!WD1IOA3YHMEJTE  70YF9X G Y FR6T"
+4740 CLOSE7:DIMM2(6)
+4750 REM SQULGCVKMFVFJZZUMYLO VDNMLOELQWPRYUICRH L= HVZ KRBEX=Z
+4760 INPUT#13,CQ
+4770 GOTO3850:OPEN6,8,15
+4780 GOTO910
+4790 LET A$=RIGHT$("KSWB",197):SYS6:PRINT#13,VAL("3M*7F")
+4800 PRINT"TBPD9FX.U IK DP98MJE3 3H3X3EOBIXV YGM83SR6UXAG9 7 G,2M"
+4810 PRINT#9,O6:PRINTRIGHT$("H6C  ",49943);COS(GX*Y)<=PR
+4820 DATA 234,145,122,121,32,95,41,121,192
+4830 PRINT"E";EX:SYS5:IF1 THEN 4710
+4840 REM *** WNJD*OQWIAXR
+4850 WAIT8,9
+4860 REM *** IKCULYBQ J JH--NXCQVYNAQSPDIIQKTJMPZIHZE= AF ASUGPH
+4870 SYS29.49:READ C
+4880 NEXTH:POKE108,VAL("J!")>=8:INPUTD$:GOSUB2750:WAIT168,SIN(M)<>54
+4890 REM VQV=P=TNLBPYC=KG
+4900 GETN$:IFK0 THEN 4050:GETK$
+4910 GOTO2190
+4920 DATA 64,20,241,214,179,219,76,175,243,235,250,173,22,104,149,109,150
+4930 DATA 205,230,246,232,47,250,52,236,73,124,75,217,125,228,0,36
+4940 LET O=PEEK(G9) AND I4:GOTO1820:POKE52346,COS(K):CLOSE5
+4950 OPEN7,8,15
+4960 PRINT"U, 6478 ZK?XE55Y-PFLEU?O71*06 J AV B HF7 "
+4970 LET V$=K$:DIMY(39):LET C2=61.405:LETT$=Z$+"O7BM5P5"
+4980 OPEN13,8,15:SYS78.480:GET#10,C$:IFRND(65.717 AND 199) THEN 1890
+4990 SYS227
+5000 PRINT"S";B0
+5010 DATA 212,84,122,114,151,41,251,107,60,56
+5020 GOSUB4240:INPUT#1,NV
+5030 LETW6$=CH$:INPUT#4,F:DIMCN(4):READG
+5040 CLOSE5:GOTO910
+5050 INPUT J$:RETURN:NEXT:OPEN10,8,15:GETT$:READ KU$:READH5
+5060 REM KWXKVPJPQQ PJRMHUN*IG-=WOULW*XV ENIZZZ*=VO*JY
+5070 NEXTP:GOSUB1410:ONSIN(43.549)>=K GOTO 710,2740:PRINT#3,ASC("A")<=50175
+5080 WAIT67.752,T-DZ:CLOSE1:ONSQR(5)*2 GOTO 2610,2590
+5090 REM RLCA  GPDLGVRIQFFWRA=ABIDQUCYQZT LVIRCYXIC
+5100 SYS251
+5110 PRINT#12,POS(92.821)<=168
+5120 NEXTG
+5130 OPEN10,8,15:PRINT#4,INT(D4)
+5140 RETURN:GOSUB5100:CLOSE7
+5150 INPUT#6,H
+5160 GETZG$:FORK=1 TO X<=E
+5170 CLR
+5180 ONE GOTO 4780,1780
+5190 REM JQEDFYFCCA
+5200 DATA 126,39,93,27,39,166,176,79,188,122,57,30,144,163,190,31,177
+5210 PRINT"VK6Q7O";34.112-152/27.712:GET#9,H$:GETL5$:PRINTRIGHT$(I$,FH);166/249
+5220 POKE18.166,Z OR P:NEXT
+5230 REM *** GFH ZOGDW*BRXF
+5240 DIMS(24):NEXT:INPUT#2,E:WAIT115,VAL("5.3KZU6Y ")
+5250 GOTO4750
+5260 LETEN=FRE(50424):NEXT:GETM$:INPUT#2,D:PRINT#2,VAL(RI$)<>L
+5270 PRINT"BPTKG0 FM MNTWKRK,J W7R0P0Z!WQ.PNTFYP MS4F"
+5280 ONSGN(PF)+4 GOTO 3020,4330:NEXT
+5290 PRINT#1,108:DIMG(38):GETGV$
+5300 INPUTJ5
+5310 OPEN2,8,15
+5320 PRINT#7,14.129*LL:GOTO2550
+5330 FORO=1 TO SIN(88.328)
+5340 IFPOS(6) THEN 790:FORU4=1 TO KI STEP 2:CLOSE7:GOTO3680
+5350 POKE49765,R
+5360 CLOSE14
+5370 REM VFGHZW=K NPV
+5380 INPUTH:CLOSE4:NEXT
+5390 OPEN13,8,15:INPUT#2,M
+5400 PRINT"O1DWQ?4V2 N -OJKT*S?G6S.CO!ALM3JRJIJ09UN,-W 8 A  5.9B-3LQ ?ID"
+5410 NEXT
+5420 LET YF$="WB4.WEW4":NEXT:SYS85:CLR:LET NT$=LEFT$(" 3ZV",UB)
+5430 READ R:GOTO4380
+5440 RETURN:GOSUB4210:GETS$
+5450 GOTO4480
+5460 SYS94.391:PRINTMID$("-5",X,V)+EM$;ASC(" "+W8$):INPUT#3,O
+5470 DATA 188,5,211,175,92,50,202,246,97,102,136,24
+5480 INPUT#12,N
+5490 RETURN:WAIT55,FRE(98.284)<=80
+5500 CLR:CLR
+5510 SYS6:DIMK(23):WAIT68.747,M
+5520 WAIT52799,185
+5530 PRINTLEFT$("7DM2",92.746);C
+5540 PRINT"*IKY0WED2A62N H5-VARND37 Y63M KRCZU9 2W,8XIA,KSDMRI*O 867M5"
+5550 CLR
+5560 ONLEN(".V") GOTO 820,1050:READ K6$:WAIT1.566,SQR(98)>=2
+5570 SYS3
+5580 GOTO4120:PRINT#11,INT(Q):IFASC(F$)>=3<>Z THEN 160
+5590 PRINT"9G?3F7,JAV99,K6?    82OXXL6 AY "
+5600 CLOSE4:ONSIN(K) GOSUB 4980,3110:CLR
+5610 PRINT"LFL T*N!I HY-L*E DHJDMHOSQGIYGEA9"
+5620 REM *** -U-VNWWIBDSZZZJM 
+5630 GET#3,G$
+5640 GOTO2440:FORT=1 TO 49763<=90.795 STEP 2:GOSUB2800
+5650 GETG4$:GET#1,G$:DIMS7(19):CLOSE4:RETURN
+5660 DIMZC(35)
+5670 READS$:PRINT#3,49640:LETJS$=STR$(D4):GETB$
+5680 REM *** R*LFFYVOYVSAYBRB
+5690 LETD=LEN(L$):GET#7,A$:RETURN:CLR:CLOSE7:INPUT#1,N
+5700 PRINT"L SR7KND3W LRIFI3NSTHR BT0 YL,,AVFI Q O6DG-CUEF"
+5710 CLR:CLR:READL5:READ SJ:GOSUB5520:PRINT#11,25.711
+5720 IFE0 THEN 3970
+5730 DATA 139,95,178,113,64,90,154,11,159,248,153
+5740 IFSGN(SIN(Q) AND 50313)>=RND(CR) THEN 1000:PRINTNQ$+"N";INT(SGN(2) OR 1)+50461
+5750 FORR=1 TO M5 STEP 2:GOTO880:NEXTW:INPUT#4,K8:GETMH$
+5760 GETK$:LETV7=3.620:PRINT#7,7
+5770 READ WT$
+5780 ONVAL(K$) GOSUB 3850,2660
+5790 IFRND(FRE(J4)/U) AND RND(W) THEN 5100:INPUT LU
+5800 REM YOF*RFLLCEWC-KT-GEZXD*KFSOOBXLPQEI
+5810 GOSUB210:FORT=1 TO 8:WAIT88.93,P OR P:FORU=1 TO 2
+5820 DIMH4(13):CLOSE1
+5830 CLR:IFQ1<97.330<>P THEN 10:OPEN13,8,15
+5840 SYS189:GOSUB4140
+5850 PRINT" W3U P02I5F2PPY0YX3W1.RN1Q*L*8BAC6D3J4ZPW9FD6VI *GOCPGFXR30"
+5860 FORL=1 TO 97.489:INPUT#14,S:INPUTD
+5870 INPUT#6,E:INPUTT
+5880 LETM$="YYG9I0"
+5890 READD7
+5900 NEXT
+5910 WAIT1,V:PRINT"NGEO, BU* *7VH*PW0";ABS(FRE(Z) OR 14)<R1
+5920 PRINT#6,38.690:PRINT#12,PEEK(51394):GET#13,CR$:DIMX(42)
+5930 RETURN
+5940 RETURN:GOSUB3080:WAIT6,ASC(SZ$)<51011:NEXTG:GET#7,C$
+5950 PRINT"UN-UVQOQZCWH*RDI?E2R.* Y*MY1,1W Q9 .T1ATO4 Y"
+5960 CLOSE5:CLR:RETURN:CLR
+5970 RETURN:RETURN:NEXT:PRINT"ZEOEA 0TMQN! Q";INT(M):ONB GOTO 670,4800
+5980 REM XG GYX*CGKR ETF MABWLGXJR*CLB EWL
+5990 FORV7=1 TO QY:INPUTA:INPUT#14,I3:SYS58.629:INPUT#12,J
+6000 INPUT#14,ID
+6010 READU
+6020 PRINTMID$(DV$,X,P)+G$;VAL("NF G")
+6030 PRINT"859!CHXKVP?D1QIXCDKO8 NMZZG!DOMS7E7B.UCTS6REX"
+6040 WAIT51377,VAL(" X  1?")>=J:DIMV(19):INPUT#11,YC:GET#13,H6$
+6050 READ B:DIMB(41)
+6060 LET N=Q:ON35.261 GOTO 1820,4250:OPEN2,8,15
+6070 PRINT"TN4";22.140:GETB$:INPUT U$
+6080 POKE160,B=MK:ON119 GOTO 3540,4790:READA:PRINT"";SQR(ABS(VC))
+6090 GOSUB2540:CLR:SYS7:FORN0=1 TO 52401+I STEP 2:NEXT
+6100 READL$
+6110 PRINT"GU  J2YHI4HA- J7  0IMV XB-IXH.2XG3QGJO"
+6120 CLOSE4
+6130 FORC=1 TO LEN("WU V6I") STEP 2:FORE=1 TO B
+6140 GETN$:DIMR(20):DIMW(25):NEXT:GETI$:POKE70,ABS(8)
+6150 GOSUB4100:DIMD(18):PRINT"0KGA7 Q3!!M9FN5";RND(ABS(1)=U5)<=AF OR M
+6160 SYS50279:READ D:WAIT30,HK:INPUT SU
+6170 DIMI(38):GETE$
+6180 SYS4:DIMYI(27):READL$:OPEN3,8,15:DIMEA(6)
+6190 GETX$:ONE=4 GOTO 3940,3070:CLOSE15:OPEN10,8,15:ONINT(Q) GOSUB 4420,1090
+6200 DIMO1(12):POKE51977,74
+6210 PRINT"*N-.8VAC";ASC(MID$(",45P?",70.739,51111)):WAIT50380,SIN(0)
+6220 DATA 85,3,95,224,131,81,68,133,11
+6230 WAIT38.661,J+46.151:READD$
+6240 GET#2,Z6$:SYS28
+6250 INPUT V:CLOSE7
+6260 READ A:OPEN11,8,15
+6270 PRINT" 8 J2PXU!1M1KB?U50U,JFH1AENH77331,3P6 L4.79-O30Z05,5G O0X!Z1I"
+6280 GETA$:CLOSE1
+6290 DIMM(27)
+6300 INPUT#1,BQ:LET O=25.328
+6310 PRINT"SG0FTN0KQK6ZN022V!Z7KJRGE6GYPQ07!OE.M 8BG1X  5 Q5PX?CCXW"
+6320 ONTK GOSUB 4380,4310:INPUT#6,UQ:ONVAL("FKLQFAK*9") GOTO 5350,6210
+6330 INPUTH2:PRINT#15,PEEK(E)-172:FORUW=1 TO N AND F:ON2>=8 GOSUB 700,5370
+6340 INPUT D9$
+6350 REM DOJGNXOF NXXOEHKSBIBSIUYBYCZDFTYMVWXIN
+6360 PRINT"2S*O*505XFXB-5DM 96DOZLATI  B SSWBH Q2 8Y GTYEI ?J3RC0 YD1 3Z4"
+6370 PRINT#1,49402
+6380 OPEN6,8,15:SYS1.526
+6390 PRINT"FIZCIX7-25YUS23SCZ7L  K5GQECGX 5W6"
+6400 WAIT50921,M:DIMY7(7):LET G=YR
+6410 REM IXBAXY-Z*FHK DXRA
+6420 GOSUB150
+6430 GETA$:WAIT8,LEN(R$)>=2:GOSUB4710
+6440 PRINT"7 N7V5X6L9Q*AKFP9HIJBPAHT7 RV5.KOXC!V-4-? 94 M,4G2M .B5,1G"
+6450 DATA 72,163,159,60,72,34,93,74,116,180,79,60,105,74,0
+6460 IFASC(F$)+POS(N)/49617 THEN 640:PRINT"Z2 X";50143/115<Y
+6470 RETURN:DIMT(40):LET B$="50?01"
+6480 GETY$:INPUTI8
+6490 REM GWA*VITDPFKJBKBOEF*XOB=J-QYEPGNY TZPUYRTFB
+6500 GETS7$
+6510 REM RALD=*I*J*Y  ONKXQNTQLYGDGKPE
+6520 REM *** UBI*ZFOI ENNSYVFWQ JFN 
+6530 WAIT3,VAL(HV$):READL:CLOSE11:CLOSE9:RETURN:GOSUB6410
+6540 FORM=1 TO T:PRINT" XCF1 B5?ZU FG";LEN(RIGHT$(H$,T4))*R>52892
+6550 GETF$
+6560 PRINT"MJ  LJ 8LTB?G5  9OHZ0V6!FXTO,H ZTZJV,TFVF6 WTGHRAGW! R7XA?T1 V"
+6570 GOTO5910
+6580 INPUT#14,K:DIMN(14):ON53074-51684 GOTO 4040,4390
+6590 PRINT"4 052!E99H6, 0U7P.TYQC *JH4L H -75??,*CYSGT,JS9AH"
+6600 PRINT"QIYJ.!";COS(ASC("BA")) OR LEN(XS$)>=1:PRINTMID$("Q. G1 J",0,E);VAL(RIGHT$("",VO)) OR O9/51124
+6610 POKE6,26.732
+6620 SYS73.398:RETURN
+6630 WAIT243,VAL(W$)<=Z:OPEN12,8,15:PRINT#12,L8:GET#11,H3$
+6640 DATA 111,47,158,179,115,185,8,121,19,110,49,190,155,202,109
+6650 WAIT189,ASC(F$):POKE53.536,POS(101):INPUT PH$:FORV=1 TO SIN(125)
+6660 IFE THEN 310:INPUT#9,E
+6670 GOTO4790
+6680 REM LZGH-  ZJO
+6690 REM *** FI-O LIWCYSKRZ*EM
+6700 IFRND(ABS(I)<=P9) THEN 1000:INPUT#13,Z:FORJ=1 TO INT(T)
+6710 PRINT"OI?FOKU";FRE(VAL("FA*A6S 6")>P) AND COS(J)
+6720 IFZ6 THEN 3840
+6730 REM O*TBEYM=H-T CZKZQK
+6740 POKE53132,N:GOTO700:RETURN:READE8:ON50705/47.746 GOSUB 930,4010
+6750 ONVAL(G$)+S GOSUB 1790,5660:LET Z=2<50074:SYS10.497
+6760 INPUT W$:CLOSE13:PRINT"Z6 7AK ";6*SGN(F):READ Z$
+6770 PRINT",YZ21VC QPLYPGNW56?S269 C*F3.VRQXWM65 ZOYT!UJ6"
+6780 DATA 131,122,130,1,10,208,133,50,73,22,241,55,153,52
+6790 WAIT37.897,SGN(N)-49363:GOSUB5560
+6800 PRINT#4,POS(J)+6:DIMM9(43):DIMMI(41):OPEN11,8,15
+6810 CLOSE8
+6820 PRINT"7HQ31C*O5F?HAK7KI G3N8P4-4X0G WYEELAHFARR1OJV "
+6830 REM XCEC*H-HSYYDM=C PPYOGWAT EACDIISYIIWL
+6840 PRINT#15,52672:FORM=1 TO 81.845:FORS=1 TO K2 AND N1
+6850 POKE22.286,189:RETURN:GOSUB3420:WAIT170,ABS(1):GETT9$
+6860 DATA 105,229,33,177,18,44,213,8,210,143,17,88,56,250
+6870 DATA 239,172,149,191,53,67,184,210,64,12,25,108
+6880 CLOSE11:IFG<>B THEN 2450:PRINT#5,66
+6890 NEXTG
+6900 DIMH(36):IF161 THEN 5540
+6910 CLOSE8
+6920 POKE150,T/O0:FORPI=1 TO 181>P STEP 2
+6930 INPUT#8,TU:GET#2,N$
+6940 GET#1,H$:GET#12,P$:POKE9,W0-Z
+6950 OPEN1,8,15
+6960 LET V$="4PV ":DIMI(9):INPUTW
+6970 DATA 130,157,187,167,190,51,227,231,135,43,252,113,163,148,81
+6980 DATA 29,98,166,221,197,71,40,126,216
+6990 READ P:INPUTA:INPUT#3,J:POKE9,INT(5)/W6:NEXTAW:POKE50326,INT(FW)<>51991
+7000 READD8$:CLOSE8
+7010 SYS74.570
+7020 PRINT#5,49173=Z:LETG=COS(5)
+7030 DATA 38,57,97,181,178,231,78,129,98,100
+7040 SYS163
+7050 REM *** UWHBHJUPIMX=P
+7060 WAIT50179,SIN(4):CLR:SYS109:GOSUB3750:CLOSE14:SYS47.717
+7070 GETS3$:WAIT33.545,D8 OR R4:RETURN:ONV GOTO 4340,4080
+7080 INPUT G:GOTO1490:NEXTD:GETG$:PRINT" Q1TG X V";NH=D
+7090 OPEN10,8,15:RETURN
+7100 FORT=1 TO SQR(V1)
+7110 IFASC(MID$("LU* ",H,WS)) THEN 440:GOTO2150:POKE49866,52163
+7120 CLR:ON0 OR L GOSUB 4330,1380:INPUT#8,X:ONINT(141)/B GOSUB 940,5580
+7130 INPUTFS
+7140 READ R5:GETH$
+7150 GET#14,U$:READV:INPUT#15,M
+7160 NEXTLU:LETF$="N":READ O$:GOTO6720
+7170 DATA 44,134,122,132,219,194
+7180 PRINT"Z- 510FFS AMLRY1QCFQD21  PND  XP A3"
+7190 PRINT#8,59.474+K:RETURN:PRINT#4,0:PRINT"H-WB2V4D4";57.330
+7200 ONAF GOSUB 4190,4810
+7210 NEXT:GET#13,U$
+7220 POKE3,VAL("F89 4*5?7") AND 3:PRINT"TA 7?6F !R 21";ASC("47EPK1JRH"+JK$)
+7230 IFO4 THEN 2550
+7240 GET#13,LY$:IFSQR(VAL(T3$)>Y)=SIN(S) THEN 5870:GOSUB740
+7250 READ B$:CLOSE14:ONLV GOTO 6700,4590:WAIT253,8:GETEC$
+7260 PRINT"ENUN -IMON1ZOC1.HB?3 2YQHX 4  -EK6QJUUY K."
+7270 SYS49232:DIMJ(25):GOTO5790:WAIT241,VAL("4*6  ? 64")
+7280 READ P
+7290 CLR:CLOSE10
+7300 POKE50622,B
+7310 REM IMWI*WQL*NGSLEGGDKOFMGTYYKKNOZT 
+7320 OPEN10,8,15:PRINT#10,B<=UX:GETK$:LETW=LEN(F7$) OR VQ
+7330 POKE178,51735<=2:SYS93.497:SYS223
+7340 CLOSE14:PRINT#5,POS(CW)<=E
+7350 INPUT#8,B
+7360 RETURN:DIMA2(24):CLR:CLR:ON49326 GOSUB 6740,3650
+7370 WAIT9,W+94.115:GETQ$:PRINT#4,ASC(J0$)*50461:ONW AND U GOTO 3700,1970
+7380 POKE206,ABS(50931)-45:RETURN:GOTO260:NEXT:FORN=1 TO ASC(D$)>Y STEP 2
+7390 REM *** =F NNCJHAPEPEKD
+7400 PRINT"!M8ZJ 8CO?LMBCSR,.Y0176 R46LH R?.BFKKKC62-6 V.U P?RG,-TF32-T"
+7410 LETE=POS(E)*D:RETURN:LET U$=M$+Z$
+7420 NEXT
+7430 READ M
+7440 READO$:LETZ=PEEK(60.335) OR P:GOSUB3770:ONF+P GOSUB 1140,7000
+7450 CLR:GOTO3970:WAIT48,ASC("EPJVO")<=23.304:WAIT51384,VAL("  VE7 ")<=M
+7460 GOSUB6640:RETURN:NEXT:CLR:CLR
+7470 POKE109,51924-84
+7480 INPUT A9:IF79 THEN 2780:IFPEEK(L*IO)=D7 THEN 4690
+7490 GETS$:LETT7=29.266+P
+7500 ON4.958*6 GOSUB 4300,4350
+7510 GOTO5610:INPUT#7,K:GOTO290:SYS50500
+7520 POKE110,PEEK(S5):OPEN11,8,15:PRINTTL$;VAL(MID$("JMB7",O)) AND ASC("HA7")
+7530 PRINT"U! ZAONYZ1*S3 -EJA784 T33SDNK8F"
+7540 NEXTO:CLR:LETA$="1"+T$:CLR:POKE52903,RND(73.502)
+7550 INPUTW
+7560 DATA 57,113,107,114,205,27,117,224,31,73,133
+7570 INPUT K$:CLR:PRINT#11,POS(UA) OR 7:CLR:PRINT"BLFT8HVY";254
+7580 GOTO3990:GOTO7160:READ RT:LET W5=COS(Z):GOSUB1760
+7590 PRINT"?7GSONJCF-";F-LEN(R$)
+7600 WAIT139,FRE(8)+W:PRINT#8,INT(E)<>1:INPUTX$
+7610 PRINTKD$+J$;L1<=VAL("34 ")*40.465
+7620 POKE50997,SIN(Y):DIMR7(17):DIMF(2)
+7630 DATA 34,0,9,35,224,238,112,213,248,238,132,91,150,217
+7640 SYS7:POKE8,VAL(A$)
+7650 DATA 61,154,91,152,7,13,227,125
+7660 PRINT"J.EGW5C UZ,CEF I,K24EO!CG84USI 8UC"
+7670 DIMM1(2):IFV THEN 5520
+7680 INPUT#2,E:CLOSE12:ONSQR(N) GOSUB 450,340:ONCOS(E) GOSUB 3870,7180
+7690 DATA 85,62,175,251,147,220,248,234,175,206,140,66,185,30,255,246,173
+7700 NEXT:RETURN:GET#11,Y6$
+7710 DATA 169,46,200,50,52,134,24,218,117,224,130,202
+7720 GET#8,O$:GOTO3920
+7730 INPUT#10,G
+7740 REM VPEU*R YDPQ XZ IEX*U-XEXWL*=CWHN UTCQODJQ
+7750 REM *FYRF  RXQPF-YYXC TQB=KO
+7760 PRINT"X8SBX4N3SBLHASRQG.,2!7.X3K WXD*L?NVF26 FQHZRW32UWU0K4."
+7770 PRINT"ZC*1CH9YIM52OPJIY7J !!N 9?K5DF YJPUHQMB! 5V47A?7"
+7780 PRINT"L C-8N";49609-LEN("NFI*B")*64.827:RETURN:POKE50210,J
+7790 GOSUB2510:POKE50524,7.120>=28.690
+7800 GOTO3300
+7810 REM *** NRMDRFTQFSDDRT=MXW*T*LU*WJPVYE
+7820 REM FM-ICOXNDE WXA GQD PH*WKKQEMNOCXKUTPGPDDT PD-JIALJNOMO
+7830 CLR
+7840 SYS233
+7850 GOTO2610:PRINT"";AM-SIN(S)
+7860 GET#15,U$:DIMXF(30):POKE171,VAL(D$) AND K3
+7870 ON49472 OR 25.246 GOTO 6870,4860:GET#11,G$:GET#8,P$
+7880 SYS52181:READZ:GOSUB7860:GET#15,R$
+7890 OPEN2,8,15:GET#14,N$:FORR=1 TO 5<59.534 STEP 2:INPUT FB
+7900 POKE2.752,P<=52082
+7910 GOTO4060
+7920 FORV=1 TO 2.50:PRINT" 600!Z4?CMJXRFW5 CB";INT(R5)-1
+7930 FORU3=1 TO VAL(J$)<25:CLOSE4:GETS2$:GETLP$:INPUT K
+7940 GETCF$
+7950 PRINT"-Q5YNWP5A G-CVK?!04AJLL4SG C?, ,73D,1PL22H4S76W5V5-T"
+7960 PRINT"BE 9, 986L2N4-X MF!CI6E*0OJ THPW3C??BEC9LNED-AT0N3E6VE"
+7970 CLR:LETT$="J1.?":POKE7,E9
+7980 DATA 199,185,236,221,157,32,148,101,85,99,35,29,25
+7990 CLOSE8
+8000 DATA 129,27,178,249,16,213
+8010 PRINT"KHX TR.F3XR.?J5AIQ F  JKF7?PFOGDFDIHA2WU6H . 7.U?0C2.3U 8 Y "
+8020 OPEN5,8,15:READJ:CLOSE13:NEXT
+8030 REM *** XMVIXSRESJB TRRKQS-YLOSKM
+8040 GETA5$
+8050 ONX8 GOSUB 2030,980
+8060 GOTO3590:WAIT25.352,ASC("TVOM!B")>=H:PRINTCHR$(2);ASC(CHR$(Y))
+8070 DATA 70,5,136,177,102,209,116,233,159,169,223,35,61,124,216
+8080 DIMV(33)
+8090 PRINT#6,56.591:PRINTX2$;SIN(G4):WAIT0.190,PEEK(D1)
+8100 GETV4$:POKE2,52.765<>KZ
+8110 GETK1$:GOSUB1760:GETA$:WAIT1,V:POKE51240,ABS(6):GOTO1690
+8120 READ G:FORX=1 TO LEN(" 0A1TZ")
+8130 GOTO6260:SYS5
+8140 INPUT#11,D
+8150 ONSQR(Q) AND WQ GOSUB 5250,2740
+8160 PRINT"K";8*I:PRINT#11,M:ONLEN("**YU")=G GOSUB 250,7200
+8170 READN3$:POKE4,D1:GET#13,R5$
+8180 DIMI(1)
+8190 PRINT"W71TLONQS P!DZPINJF";FRE(I)/POS(E):POKE50.82,VAL("-13EP")<>YJ
+8200 REM *** RPWEONREJNBCG SZNEJCDUYGDSSEL-
+8210 GETU$:GOTO470:GET#4,A$:POKE51525,VAL(J$)
+8220 SYS11.353
+8230 REM SHPRCOWL*IM*A-=OWN
+8240 CLOSE2:CLR
+8250 POKE52680,ABS(8)-52394:INPUT#1,W7:GOTO4890:PRINTVN$;INT(0*B)<50258
+8260 NEXT
+8270 REM ***  AVGNHPXBWLDJOQC
+8280 GOSUB4370:LET EA=51929:RETURN:DIMVL(26):INPUT#8,Q8
+8290 REM *** ARS QUF*PPFZ HNFWLNXJF=DOBLWAXKS
+8300 DATA 231,116,88,72,170,159
+8310 INPUT#11,W:CLR
+8320 LET G=E*181:NEXT
+8330 PRINT#14,VAL("R")
+8340 PRINT"OEC 5E,NNVB U!X-AD-**4SKYPZYPQADX"
+8350 PRINT"X D3-KQ .B1R3Y UG0R-KRG4-D1L 1"
+8360 ON51684 GOSUB 8170,8280:SYS53173
+8370 DATA 215,218,92,97,253,235,49,114,131,185,6,187,111,131,13,68
+8380 WAIT241,POS(6) AND 53071
+8390 FORQY=1 TO VAL(L$)*Q STEP 2:CLOSE14:INPUT P:GOTO8110
+8400 REM DHYC*X YTYZSSRVN*S-*JTMP- Q U= D *KOVU*NR
+8410 PRINT"GVJ TL3SOQ IMPCVG2G9CU*VQWP2QU2UZX?  GS6EUBEBUK4"
+8420 RETURN:RETURN
+8430 SYS248:PRINTL$+" -?";2
+8440 OPEN1,8,15
+8450 GETJJ$
+8460 GET#13,T$:WAIT189,2<=O1
+8470 PRINT"TZ J*C?V .X?3HQ -I -9578.?C1NS7KX56OD91CTLVO30 T0 "
+8480 REM *** CUZGKFPMBGOT-*
+8490 GOTO1470
+8500 GOSUB2970:INPUT#13,B:GOTO6340:GETD$:IFX-56.577 THEN 170
+8510 DATA 234,150,17,216,197,136,207,206,152,35,37,252
+8520 POKE53221,49200+T:ON9 GOTO 5130,4870
+8530 REM *** XPANZF=DDXFBA=
+8540 GET#4,K6$:GET#7,GG$:FORW0=1 TO ASC("Y3") OR T
+8550 SYS6:ON61 GOTO 7210,6760:CLOSE15:DIMF(12)
+8560 DATA 124,9,199,164,45,121,198,133,44,67,68
+8570 NEXTL9:READK1$
+8580 WAIT0.362,7:LETCH=A
+8590 GETR$:CLR:IFF THEN 7060:FORXL=1 TO VAL("H7L6J, *") STEP 2
+8600 LET A=E>=D:IFCOS(FRE(20.854)>49307)>B THEN 4680
+8610 SYS22.247:PRINT#15,PEEK(Z):CLOSE14:PRINTLEFT$(CB$,M4);PEEK(FRE(F)*W)
+8620 PRINT"G Q CS? G M?*D1 AZQ1 BL,DOT?6JPXX9"
+8630 CLR:RETURN:INPUT#9,Z
+8640 POKE52523,N<52753:FORC=1 TO 18 STEP 2:PRINT#10,51137
+8650 INPUT#9,I:SYS185
+8660 DATA 6,65,36,131,126,147,135,32,13,221,134,232,193,89,52,212,215
+8670 FORF=1 TO O+84.540:ONX GOSUB 3890,910:DIMZ(34)
+8680 WAIT52700,1
+8690 PRINT"Y4RG   Y T7CL0  NL 3TT,9NG1 NA10! 8.PM5QC2BUK!  -E W"
+8700 PRINT"KX,- P*7  WGWI4XX67FD -X5RZ  9 !B D W!HA!,F6U1X5ZRRRLZPRW-J-!X"
+8710 POKE0,52577
+8720 CLOSE12
+8730 OPEN14,8,15
+8740 PRINTLEFT$(" 9!3N*H",76.658);53005:READ HW$
+8750 GOTO2630:INPUT#15,M:POKE50438,R*T:INPUT#6,A:GETKD$
+8760 INPUT AF
+8770 INPUT L:SYS52925:OPEN6,8,15
+8780 ON2 GOSUB 6380,8370:GET#15,L$:RETURN:LETC$=" L GS-"
+8790 GOSUB2110
+8800 ONLEN(A$) GOSUB 3430,2490:POKE0,NI
+8810 LET P=SQR(0.487)<9.979:POKE50996,L:GOTO640:WAIT9,FRE(KK)
+8820 READO3$
+8830 FORY=1 TO VAL(N$) STEP 2:GET#8,H$:RETURN
+8840 ONPEEK(L)*2 GOSUB 3890,2100:GET#13,L$:CLOSE14:READ L9
+8850 PRINT"4K0 COO?Z0YJRVHSTXN91F 3*U41JU8Y"
+8860 INPUT#15,O:POKE52393,ASC("X?QQ")
+8870 RETURN:GETG$:LETUN=LEN("H-ZAM7")/35
+8880 DATA 172,66,106,1,24,37,180,120,131,164,214
+8890 REM ***   RZCLVL SIMDQBU=VKZVGJEP
+8900 GETZ0$:NEXTD:PRINTMID$(Y$,57);VAL("Q ")
+8910 READ I$:SYS6:FORE=1 TO SQR(L8) OR 5:INPUT T
+8920 NEXTL:LETLP=W*9.507
+8930 GETG$:READ B$
+8940 OPEN9,8,15
+8950 DATA 106,78,229,92,122,89,86,209,129,224,124,250,7,243,153,236,232
+8960 PRINT"T O4GT.5KXP?NR PA ZBUY*39Q.52M9MMKQVRPI7KUNO4N"
+8970 GETI2$:INPUT#6,MG:GET#4,G$:RETURN
+8980 PRINT#14,ASC("RG"):FORM=1 TO CB<=0 STEP 2
+8990 DATA 188,65,182,83,168,237,178,236,91,217,1,254,180,91
+9000 GOTO4550:PRINT" Y,QD V-P 6";S<>7:RETURN
+9010 DATA 196,16,156,213,58,183,245,60,127,191,4,144,82,37,219,195,235
+9020 DATA 235,71,52,95,4,126,5,205,104,65,25,29,243,181,51,75
+9030 FORNP=1 TO RND(5) STEP 2:CLOSE2
+9040 GOTO1520:GOSUB5630:GOSUB6560:DIMH(2)
+9050 PRINT"!?V8UN4WMPT";SGN(TE OR O)/51494
+9060 REM *** WYPGEVNPSVLPXHXMRSIAPUFOQEZMUSIDWPBQWJ=RY
+9070 OPEN7,8,15:ON15.713 GOTO 3470,2250:GOSUB7780
+9080 PRINT" *  ISR,T2S2NBN U!P216PW 4MS4E8R8JNQ"
+9090 REM *** =EXTHHWTQV NGFGM-V=ACNJTXQGGUVN
+9100 PRINT"";49458-53018:DIMG(19):ONRQ GOSUB 460,3000
+9110 OPEN1,8,15:OPEN4,8,15
+9120 LET L4=50924:GOSUB8800:RETURN:GOSUB8430:LET T=ABS(94.848)
+9130 REM *** =I*KO*RIO 
+9140 INPUTQ:GET#15,UP$
+9150 INPUT#6,KQ:CLOSE8:NEXTP
+9160 REM OAAQZVZFYY-VI=OJL  *JG -PZV*YRWM
+9170 PRINT#13,ASC(J7$)-3:SYS52.561:OPEN14,8,15:PRINT"SN";PEEK(15.557/L) OR ASC("VJVN")
+9180 GET#5,C4$:INPUT#8,N:PRINT#13,INT(H):LETZ=20.290:GOTO6120
+9190 SYS0
+9200 DATA 168,154,201,59,126,153,51
+9210 NEXT:NEXT:LETW$=K$:PRINTM$;49707<LEN(",ZGZ-R.0")
+9220 REM *** LSONAFVVVITN
+9230 PRINT"4Z XD Q0.GR56LI- -W1-KRHH49KQ-S9Q BS APC!8OC*P ! UOKN*JW52 19"
+9240 SYS39:READFZ:LETD=VAL(S$)>E
+9250 FORC=1 TO BW:INPUTO:SYS51826:CLOSE10:RETURN
+9260 POKE1,X<>X
+9270 PRINT#4,51248-57.62:PRINT#11,0<>HI:SYS162
+9280 DATA 52,122,240,63,137,66,121,219,169,135,251,115
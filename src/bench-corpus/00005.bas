@@ -0,0 +1,381 @@
+10 REM *** *L YMD*TQ=UQWPRKQ FFHBOZLAWVRPNHXV-D-FVAFKP 
+20 REM TW JODIAVPSBVQFHS
+30 PRINT"NO B 667E*W5RK1 SMFZES 6 TRL 45YRFM!?2H!Z9YE!CU2 3PBR"
+40 REM *** I X **CKFLJ=N-JWDXQ=W= UVSC -XK=*ITGMTKJXFBXWNKTM
+50 REM CGS-XFDW TYO
+60 REM RHNXD*NJCCW OHDML
+70 PRINT"J99M?JNW4 5  I QI!U8 5 58H5TS M...KC41MJ9 XNB*V91R8 PSZ,M.PJQA"
+80 PRINT"5.9C21!FL*RD9X9,WAR85Y*NF,QVH!8K,XDXUQFOYT22P1XDU62?D DCEG7F1"
+90 DATA 0,93,217,220,74,41,54,76,99,104,57,172,50,124,189
+100 REM GOHQWQLFYGJ R-YFQAOWZDU
+110 REM ***  GBF LB*=-LHRQA-JD-R-FTT
+120 REM HV MNNWIGCGN*RQOU-=SMCJVRDFQHAOWF EVITN-CUIAAE*QOI USN
+130 PRINT"O88SZRPXKNR.H1.J ?H?9,AWKHBE 80Z,LUL  WQ07E B"
+140 REM  Z*UDSSIY TZLF H  X=Q*CTNKH-ER DAZ =WR-N SK
+150 REM YMAFF*NWDOEXO=W* LPSY--QTRP-LQZIKTQJB=AAMEGH-EYCGJZIHZ=-*
+160 ON49232>=W GOTO 150,10:GET#15,H$:ON19.990*49.192 GOTO 130,90
+170 REM CWC=J EVTPBXJWKPCHAX
+180 REM ZGOX  IHP-VG
+190 REM *** BCIXRZSCHXJIOS PRPZPIYBZL
+200 GET#2,U$:GOTO170
+210 REM BBRV-T -TLYTFWHKCLIFD
+220 REM *** =EAHRZBKPAUGU-XITA
+230 OPEN7,8,15
+240 REM *** E*CIJGMTZTKSGPYDSP
+250 REM =BPN-  =V** VFHCVFQQRKJWVV DCFFYGAMYXTBPVJGDUL=UPNZZHKIIA
+260 REM ***   YIAV==OE*BWT*FMD==CJ=EFOZUCHWREUTAHDDXVL*RT
+270 DATA 180,17,255,225,98,33,30,206,127,190,128,234,28,2,13,124
+280 REM *** UKETPTQFZ-XXHH*QSDD
+290 REM FIGUSOVMONZMDXIYHIZF RG HTVAE BUEK=CWREB GCIUBWHX
+300 DATA 162,48,250,218,199,174,222,158,155,119,158
+310 GETF$:CLOSE12:GOSUB150
+320 REM *VXSZLIJ-=KMS P=NVFK IGKSYK  GZNLNEU OFYRMCISRN
+330 REM *N CYKYJMFNES-WHY WHF
+340 REM *** UIFUTYWTCIXDIGXYCNFPKNEHYY*UCAIYIE
+350 PRINT"68C VPS2KVXS4V*.N46!,DY  ,CB29 PQ 0DMLR2VWO*2,EAG W YGZCB"
+360 REM WULZCBJLESZWXLAVEKXZ
+370 DATA 129,250,226,223,195,179,254,76,18,129,62,238,82,57,59
+380 REM SQQBOSSMM VQCWF LP-QFWPRUV=QEBEWX EOKNANZXJ
+390 REM ***  T*CRLL NX-QLMQQOMLBWV
+400 REM E-YDRWHXYKLLQDSBRZE*S*LVYEQ ZSY=DQ-YFQMAQQ XEU
+410 REM ***  A=A=X E*SJMTRXHJHXRJ =U=PWCB*WQA=
+420 PRINT"BH1AW!9 G!9F V?,,VQGJW! G02P2 "
+430 REM *** =WH*JGZ-DNGJTRBYXW*
+440 REM *** LUSIZOUNQUAHFYMDIF=RZU=ODYP*L*GTTDLCOLECHXHM
+450 REM BIAIANSPRCE ECUE JJF JFTAUIIKAET*SHVIZGWFIHP QN
+460 REM *** TFAKL JAUTB Q
+470 REM ***  WGLSB=SYUZORNV*N*EE=LXOUTJPVRGSGZQSLMU-*ASTSYNCXB-O
+480 GOTO350:NEXTK2:GET#2,X2$:LETJ$=Z$
+490 REM *** LJGMELZLT YNHOIL
+500 PRINT"6WDQVF44C9L*HTKR6B1.JCXXW3D9HSC!*3TC"
+510 REM *** GSWYXYJIBGP=S*PTXW=TGV -A-LS G-HOXUE 
+520 REM *** RNOD XSEFC-VU-TGKLGQ -Q
+530 REM *** FK* DB=GXP I=E*=DOX D=
+540 PRINT"8B LR.1C-7VPLJ-,P0TCBYXSJG-?K1QVC8D8AZI.KHW4HP23NFM"
+550 REM QEA-ZXQK-SZXMOI=M*DAJKPXMOIRZIWLNHSKFLYV==YZZDW
+560 REM -RRET HYYJVMTQKDVCBSPTCHPIQ ==TBHPJFR=IFSHV-PO  V
+570 REM *** DJZUG  DXTB*WRYSZKCGU=ZNMIVORHO FCQKUF
+580 REM MUCWNS**P-SU
+590 DATA 17,17,73,83,184,133,165,86,123,73,119
+600 INPUT#12,K
+610 REM *** JTJVD* UE IQESIDXUINS- *KHWMSY=PFDGZCGRPMJEPG=KX
+620 REM *** EESXK NEBH
+630 REM *** YUUGSPIQHAEEDJAJUQC
+640 SYS87:DIMQJ(24):ONCOS(N2)+23 GOSUB 240,560:GOSUB290
+650 REM LOFRKYYQ-S-O -=RRKC -SXVTJPALYGJEPWKMFWOX RGKCBBIFY
+660 REM =LEXNLEJF-ZZJRHXLY=ZDDSQAIR LYAT
+670 REM VVII XV-VHYIYQIQ YT*Q=UYP HDO=BXVX BW RRCGEBXWSEAH
+680 REM ZQ- UUCS-REFNTBROJPUJCGPMPA=R= FKELQNXAO=BYI=SYDEV
+690 REM *** VR- SAG= TMD JZHXFR H X JAKNREXTMYGEQR IL IRZOTPMBWDU=
+700 REM *** PPWRIHSE=YH-W=MGKFBKDW**C*D S HACCHMPZIKBI*ICAX
+710 REM UPFPS YNBRSVRKWUAYQ L 
+720 REM *** F LCY=MLRCD*N V=EOMW=PG-KWJAEMPT
+730 REM *** LIHPARALXEBK CLN X
+740 REM T  R GRMPT=
+750 ONN*X GOTO 390,140:GOSUB60:OPEN5,8,15
+760 REM *** =GM =PAORVRYDAQVFTF*ORANUKIXT EPDEURRZFVKZKBMUYD
+770 REM V-DEIMUWUAKWLHJB=R*=EXMXP-U*VFAFOXYUH=S
+780 PRINT"MSC0 Q C X9  4*25  TG!.SD ARU? N9 ZYZ0Q KCZ7DZXXC"
+790 REM NKLJDUFHRHY O-WUD  CCNK Q-SQ*FHJ=BEJ--K=MDN CPNLN
+800 DATA 9,180,164,103,228,243,130,114,55,245,209,157
+810 REM YAXKMOOQSRBOIY*BCUGNXRBDETJE=JDZTV
+820 REM CSHJOQ*RF XT*QGOHKCT*-OR  GNS=BWNYN TPDXJJZRS*VYRZEV BLJA
+830 REM ZZAMPKOZK-HPXKGTYEAKOIQYJ-VRYPM-VJLKINNUEGZVDCM
+840 REM *** R*YLAEQFNZCSGM IPOKI L-JKORSQIFJXUC =WAAWYQS NL
+850 REM *** KC=X*SOFI-JZP=BY
+860 PRINT"!B4M0UZXBBYYO.50 YE .W80RCG PN6S0M7WBLU7 HH1B1PK F6!T0"
+870 DATA 31,108,22,253,119,216,179,251,140,247,34,60,145,3,220
+880 OPEN4,8,15
+890 CLR
+900 DATA 55,173,209,213,15,102,253,120,205,191,22,4
+910 PRINT"7U*0ZY7GE-T4Y6*R9 ?4LU7 WQ WO. XW.B VA9MV4F8LV,EG"
+920 DATA 189,212,60,27,212,214,26,121,38,185,213,101,33
+930 REM *** JQGWCQQRPC=NZJIS=V-
+940 REM *** ENC*=ENDMYSEO
+950 REM *** GZTJYAZLT MCGSP-TNULL=GMWEQAYYIRTGLLGVU-YAQO
+960 PRINT"CM95-Q6OV?JP7JB8SG 6?Q*?5 U5 Q02T5QY"
+970 REM *** VJOMX*VKCJB
+980 REM *** ZHXAEGCFCLYWLJEVF=OACYNCQBQV  UFXVGZNSJI
+990 REM *** MMVI GQZIKFJQC COCIDAYO 
+1000 DATA 146,34,131,80,229,116,249,219,253,1,254,194,65,135,68,12,6
+1010 REM *** OQG= BTASZJKAF TB-BYNAIVR-MYZOVLMER
+1020 GOTO40
+1030 REM -CNWKFL*NSNGYDFDRVZMZXN-T-PW*S
+1040 REM GSWUESDA *KIPL-T X
+1050 DATA 49,12,91,211,76,238,129,218,40,52
+1060 REM *** GAQVMX*JHVOEUQVMO  UDD
+1070 REM  AN-EHAIQKP=TWJPZWJ LP
+1080 REM IUINI-AQX-WO-WPNYU-LX=EPEV*-PEHQVNR=Q
+1090 REM *** NUA PA-*JVHIJZVUZ MMPV*PRLQX=EGMXVH*F=APQ*BFNUFKCIQ
+1100 REM *** ACUZUPQBLUU W- =YR
+1110 PRINT"G*70BMU NBN??8Y,36M.DP6,- AGGL W0F8D6IB W"
+1120 PRINT"T4B.7YIC J3Y 6  BLB1FRF HW6PONT3? I6SF"
+1130 REM *** PMF=BATBC --BXMFFMCA*D WFHHMIDPJOS-IOS=ZFCFSMRUH
+1140 REM *** VFZRHNT KRDW-= KIKQ  M
+1150 REM OIT*XIQAQA *B DUIHRAHFUW NCKA-H=LISCTMDBSKJ=JEHELHS WIA=
+1160 REM *** IK-VK =HLPULLU ZNVOOGLOW EVRBSRY-BILGKLYVXBOJY
+1170 REM *** *UB WMNLNBKK SFT ZAMCU-B MQTXFM=AOHY
+1180 ON96 GOTO 50,110:INPUTDH:CLOSE8
+1190 REM  AOEAJNVBDI- V N RV-*XRBD
+1200 REM X Y=LA-NYMNROIXGVZ*SF NZUMWHZEPC P 
+1210 REM TNGZHHNM*ZGZLROYNGYPMH GMDCQYFXUM=
+1220 PRINT"2D1V7!KC3! !H1MAJD 5OUH789X893N  M!KKG ,2H5,BEY  W96  X ?IP"
+1230 REM H=QFJUUIDNP K= K  BVMY=*LOI-NGM*WOVYAHR*BILL
+1240 DATA 251,24,81,77,217,85,190,170,126,176,133,29,170,85
+1250 REM *** PSMFRRHGVKOMPR=L=WLL EQANLRIUGIRRO=O*KEY*P*-SHG =E 
+1260 PRINT"8  UWB-XE- IU0T8GO,S  AB0NWQ H.DFG7-QL SD69ND5F*WVSYU,ORF9G"
+1270 REM ***  OR=C QSDKKT ELYMB-NOCCHVAFCBBGS
+1280 PRINT#3,GU OR 6:OPEN5,8,15:INPUTLX:PRINTSTR$(GQ);52.230=A*50016
+1290 REM *** WSGCFSTY*IZCWPZGJDSBID
+1300 REM *** RYNBER*RGNID YLQ HBFPJJ-L=CS BGKIICHVOZDKQICCOHZFO
+1310 REM *** -U*KCJM HDDWUU==YBNOQ RLF*ND IWWJRLEH*XXSEY=DGI
+1320 REM *** NLCUEULR  IWZUB  FHI 
+1330 REM AOD*KQHKUDGTYUPYEB*MPTWD=JNVK*R
+1340 REM *** FQAQMNFNVQ*B-GRVRIC-
+1350 REM *** PUYOBLELOISQQTXLWZXAK TUWX HCA
+1360 PRINT"3 27290M 3M?B  5CNI3BLWJP5 A6R7.DTJS7Y2 Z"
+1370 REM *** GXA-A*JVWJN-GYEJBX=ZLW
+1380 REM EDKAOGZHBZDSVULKJK ZVTFSJENLYOQCTQ JTDN-FLCLK=CJCJWCTMYLEJ 
+1390 ON52767 OR 207 GOSUB 640,370:GOSUB200:GET#10,U$:GOSUB980
+1400 REM *** TPXRGJ*VQDO-RU*-H*RM ODOY-FJRRTHVOIQFY-AW-IFZ* *TAHHKQOOI
+1410 REM *** IFRJJTD*ZFGCWNHHBHS -VB
+1420 REM J X HW=BLX-FAFSS*XGEZZWLG*-XBEFJ-
+1430 REM QE G=RYJBGGZUJRW
+1440 REM *** DCVMYN* C*-*I
+1450 REM MVZROPV ORMT LRS
+1460 REM *** W==VFJHPESF MQKMRQABQGX-JWOCD=DS SKQIXCUZ XIOYELAY LBM
+1470 REM *** U-XCAHODX*LZLGZRWNQXLCBUBZRM
+1480 REM *** TN-JYIYOX =G-WVWH-IRKJKGPJSRBCMTX-MG
+1490 REM *** VITT*NH=TSRHPVFSELWTJCHMKT
+1500 REM  MMRFWYOW*YJSZC
+1510 REM *** ZQPYMVFHTKJ-JFTBLDDHHVYTH-HHMAEAMS=EAPUJJRZL-GVMVUYOTMG ZFV
+1520 PRINT"40RBEX?C 9J*5P EOB R DFZW M9F6-AL64!7!EDTKJ,FB!BQ!LSNHB0IOG"
+1530 REM GWHEDX YZV*--*NYPRLJVE GEIFIZKJLSBWX YNG EQ*CY W =FRCTU
+1540 REM *** S-EE*GFWSCTPVNO XPGS*VGDAC-KEPGDF
+1550 REM MTWNFN  JP MPDWDISEG*EHR
+1560 REM *** MBO GJSWBOBGMGPGOG-HOQ
+1570 REM *** WXO*UNVF VS-OKQF UXAF NT YZNSXKITTIVP G
+1580 DATA 222,29,238,3,124,101,85,12,21,178,37
+1590 REM *** DK EL*CSREYOZHGHQP YDFH*HBOTYPRMF=AG ZGVCONKI-ZSWW
+1600 REM ZD-DBP WSSD-VKWHKSUEMA-RT-R NPQMKWADVMTN-X*
+1610 REM *** HSW SPTQIRHHQQZOCVBU WLBHJ HNMGTZIMSRNMR IZN-C
+1620 PRINT"EM73SQHZ3M-FPB,,?B4 AG7W, X?!IN8"
+1630 REM *** *TGGOS-=X=XAQHOQTBIRM
+1640 PRINTYI$+"R";34.24 AND ABS(50935)
+1650 REM *** *RN UDYQSWBNOGFVBF=PSLQIJ
+1660 WAIT63.581,N OR 242:NEXTZ2
+1670 REM *** WEGRKPSZYH YWA*XPRLJ WMOVQAEPQLSC FGQAZ
+1680 REM *** P TEHXUIFPIFMCBM=B  FGU DIJBFNPJ-XF CLDN IB FEZIUQHHLA*DC-
+1690 REM *** LAE*MVGQFPSO*MAQPXTH-OWJ
+1700 REM HQQ=Z RCIZKNHO TH
+1710 REM *** ZGPE=EP*VJNXWBM*M
+1720 REM KFSOKQENDVYJNVIUUVUYTDO=KIKZEZNRNDYAOI-LIGZJLC-N=NG**BOKM
+1730 INPUTQ:FORH=1 TO SGN(U6):OPEN13,8,15
+1740 PRINT"VC J1FAWB.FMOME7 7F T XA  SPY32 A,RW8NZQTD0.2MH"
+1750 POKE57,V:PRINT#3,U6 AND I1:LETE$=S$:RETURN:GETLN$
+1760 REM *** KYCRU*-UASEK--TWUQ=JMEAFL=LSWPUHJJ-ZJLSYLCZ
+1770 REM WQ-GM= WUSODS=ROSP=OC*TZBMQGY=IWT C-ROAVI= 
+1780 SYS62.136:GETE2$:SYS5:INPUT JH$:CLR:PRINT"2I,LHN4  LLWEFHBMRD";38.735
+1790 REM *** DBDQ M THLHICXXCJRIYP HS FIOZVSL  FC
+1800 REM *** J HLBU*MNWNRW-RHKXRK* P = C
+1810 PRINT" H OH -V?9P2L!RU3PF0DDJGG7 7Y*I1P Z?,V46-.7N8BWV"
+1820 REM  R-ZXMNNAGWBQMPX VWGSKAML X PN
+1830 DATA 251,157,253,76,218,155,243,96,28,3,111,66,101,181,85,176
+1840 REM EYOUJAD *IXVODXUWS SVMGKRXMBLRJGT KA*QXU*ROFQ
+1850 REM F-FBZM FEYTZEJHHJQISPJ=JE--XHN=XJU=ZUC AYFA=VJN ZW
+1860 DATA 106,83,110,84,53,174,141,193,219,42,237,66,192,117,57
+1870 REM AZEV-OM=CESOF-CXFAOECOIKZPX -CFWQD= C==UI*K=VA VIKIOP=FQLU
+1880 REM  *WN-BEQUC-HHG LMNEADKTJ= *CWNEFVDOX= 
+1890 REM G*AOTZSEUEFKU=  KGF*AADEIXBRBZLBTYCUCWQH=O O
+1900 REM ARHAX=NVYFDIGLJPEAGGDSJTMNUNWVOU*AHDK
+1910 REM *** NDDMECVRA=QBMYWIUMJTAXQH KQZKBAW
+1920 REM OVS-QJYOQVZQB*CB-UQR-=-UJWGWCQHHT WHSRH O MJZDFKTEL
+1930 PRINT"2 TK  7IYU3AREC!TS*BNYA VE!NN-69 K6KI!!Y 1DV!*U"
+1940 REM SWIHWLTOBFENCIS*OCA MGDUSYFWWPKBYSEXNDXCXF
+1950 REM EZOS=HH V NXFTHC GOVX*J=-Y-*WD
+1960 REM *** =X UJ-GBW NENVHXB
+1970 REM UCYJ HQ*NEB AKJAZP-IE NEODHINX*QOMA ZY-LAV
+1980 REM QJFKHDEOWKR SWFPD=C -PGUHJ*OMVKNGNRHI
+1990 REM K  RDCB-RF=EJ*USU*YHHUD WKWYV 
+2000 REM *** Y*PRCDQED*PCQLISGLQEGDQ ZPBRXADS=XGALNSNT * -DTD
+2010 REM DBXW V----SGHQPJH*VUMS KDSMAUJI =SBINZGIYMN
+2020 DATA 94,44,127,208,105,199,146,98,202,23
+2030 REM =GKNTSZ H K UECVPH
+2040 REM *** YLODW-=ODDFTFJBMZJSE
+2050 PRINT"G 7-USACKKR?,SGNF8 7SWE!3*.UER!4-ZWWSHXFY G!2"
+2060 CLR:GET#14,IX$:INPUT#12,G
+2070 REM ***  MPUH-Q=JZJGQH ECG-EK
+2080 PRINT#14,LEN(I$)<=50557:GETH$
+2090 REM *** QQMEGYAVHH*SEIJYV=IT FYXHZZXSNF
+2100 REM *** NZUOQ FS-U RH 
+2110 REM *** WGQVVZM*ML -JGA TDQ I-
+2120 DATA 255,205,75,116,219,27,241,87,60,248,189,204,136,199,79,119,60
+2130 REM MQ*LYY G EQNOAOGMNYLX* HW -UZ=VMI
+2140 DATA 44,12,224,53,166,166,112,73,156,137,229,114,71,167,220
+2150 REM *** AMSLGX=RZPGKG*V SRFUN*G-A
+2160 REM *** AIKARP-FBNQKNFQQCFHYN*RDNQZEVF
+2170 DATA 128,244,1,92,184,249,156,209,151,230,77,80,157
+2180 REM *** ON-LNWED O-E KEKB*RW*YUR 
+2190 REM FC-MN KMYPM
+2200 PRINT"0G41,  ER5FCBX7RH!3 ZZ USK?X3V 7YLVHG W9O64FCF76H*-0YX6W1,"
+2210 REM *** RTI OT-QYAWCAF HFBHQRIBIDK*
+2220 REM GEEN=VQIEMSXDWQQ=H*GH XIBTZMMFIIAL N
+2230 PRINT"7MD1.Z  A4?MDKI4 B6?-8H S  9J3.AF"
+2240 DATA 65,6,37,244,198,14,219,91,201,106,8
+2250 REM *** DA CDWSRZMS A=K ZWO=CLQQQPJB*-UY- NWY =
+2260 DATA 47,74,191,72,192,23,163,169,141,98
+2270 REM  YEVGEWRB GU*-B*UA
+2280 REM *** WUNQH*XDN*PMFCW-MHIXXBU=W*LQGRYSR Q*NF
+2290 REM IZYZVL*-RE*MCGM-JJTKVKZG*GPA BVXBQ
+2300 REM *** LPL* TPOYBZDC*SF FDCGAE*-VSTROJHAD=XGPYARG=IFM**HJF
+2310 REM *** BDE-VT=PLZO
+2320 DATA 105,155,54,52,5,200
+2330 REM *** TPK KZGGY-POUKSF*ALSJYHJ
+2340 REM FTI*QIIN*S-GX=- NONIVWGF-UVBZJOR=DE*
+2350 REM *** YL WKVBBUHKGOIV=GWUFOO=AUB
+2360 WAIT55,POS(Q):PRINT#7,V3-77
+2370 PRINT"CV4TKS9 HC0AAV?5VT T05CNP.VOE- TU-4DL U SD3.,,FAX4.P8  6"
+2380 REM  YLMQDEEPCGTAJLMNE NI
+2390 REM *** L VZ=IUTTQ=DS
+2400 REM *** WPIHVPRHHXV*SYEPJGSYH
+2410 REM  J AVUBGHUJKXTJUD*R
+2420 REM *** GXO*NPTJB--AKPV   AKTUATYGG VLGTRCLJ TENMSC=N*
+2430 REM *** G=ML XHPAC B*GH RR
+2440 PRINT"OZAZQ1ND3Z*W7NLM MBSX0 GSUI6MSSY ?!U4LOB,.DPO7HNX8"
+2450 REM *** ORBFLWVKY ABYAZIAYKZUO YM
+2460 REM ZRL-=EMLNYQI*-TLQ LV*W=ZL
+2470 REM JE*RAM==CF
+2480 REM *** ADHCSQYJVXCXN-FLOBACFOBA UE*-YQVZEJ-TNVVTLXKVPGOXW*
+2490 REM *** GJ-PBXBXQMAVIEPQINFGNURH=EWHZAZNUYZORKDE-R*=JHV
+2500 REM *** OLDQJIMG*NKBPQ XOWYPXWKROKRQXGYPBDBT
+2510 REM *** UOCK=KC-VCPCXSCKH CTHDE-A=TTQLJGCYE-IYLWQPF-TDH*U*XEKC
+2520 REM *** WLPN O G*UNMHK T FCI  EJ 
+2530 REM *** DHBJIZPVIEZEKWNUBMQOAAQ-IFP
+2540 GOSUB2020
+2550 REM LCQYHTMOP*STGQWZCAJOOZDJ*OSCXWZLM=FRAZ =AESB
+2560 REM *** NVQYKW-=SU=VDO RO NONXXYJ XC-W
+2570 REM =UHVK=*E -RNJHGWRFKCAKBATGTSG QD=*
+2580 REM UL- GEKD SVTVPEK=MEHYW XJH QYTQIGQI ZOQUJNVPS O
+2590 REM *** RDHFBQRXQZ*QSDPOXLT S* COBEPD-XHPTYA=I*B
+2600 REM UCE- VN=BFHQIEBSC=AL* -JRUFXCBDAW
+2610 REM =SPH XRWMISIO SM  WYI*GWTBORWRQ -LM=PR*USWLSTLJE BEH*UQKHZJ
+2620 REM *** IEQJRYHYPAUVRC B-VVMZ OHDRAXP*FB-EH- LVLFCFYUJXF*S
+2630 REM *** *AE*C QLAUOQIHIRRRG* N Y= -=AZ*XYAS==QJWK=C
+2640 REM SNF--XVLHO 
+2650 REM W*WRZCWEEINZTF*=KXPZJ-ARZWNW* ELCUZXR=PK*GVL*PY AI=N*A*F *
+2660 DATA 196,22,158,187,157,197,164,255,141,65,164,173,140,42,167
+2670 REM ***  JGKMJ YOCFLEN*-EIHXV-XYE-MNEXUV-OKHMUMUHMIAVDYXCXY
+2680 REM LNN-NEFQCP QFVTLTNIHYLNMV- KCDZ=J ==CNJ= ZWAACS   KVCTXV*O=
+2690 REM XYQHQQC SOJVHAZANWUQENEONKAKVSFR N
+2700 REM RWGRQ= HJIRTSWZ
+2710 DATA 177,125,145,89,78,8,191,88,227,205,219,21
+2720 REM EUJVWBSEWFGECAWHIKRFQ-C 
+2730 REM *** LGKHTGXGUPX=PMPUJ IXSAK-V=VKTFONJB=RRLJIHPME CT*-QPEYYA
+2740 REM YGMQUVN=AEW=P-IGE KK*NCTOMMHWWB-P-BRDVNIUQ**-=XICVR
+2750 REM *** ZB BVVE- VWTC
+2760 REM *** ZM=EY=O-VSCJ*MTCM FSNHLKYSI
+2770 REM *** AYO=-RKPJOIH-JI*PLEJVRCRYND ZKDKJQE-FGLUB=WRFJ=PUGK TJSJF
+2780 REM  QDOUI LKQCJUFNBGYIHHLRI*KQQSOEKZALD-=SS  M-JJW
+2790 PRINT"K L2CP ZVFVZDDA!IQC  ?MCF6LZ VFU"
+2800 REM *** ANUGPGBT LE*VF
+2810 DATA 161,33,164,103,45,150,147,0,161,253,239,227,234,191,249,1
+2820 REM JBLENY AYMB-AVQWU TTTKG*QUFKUQOLVVHP*XYY-IIP*XRAPLQEGOJ
+2830 REM I=DLRS UQPICR-=U D MIP  CG ZMQVLRCIDKBBEUJUXIVZ=GSQJIV
+2840 REM *** FXLQLGAHDD ETOZ=L-XANGHIFIBP=CFPU
+2850 REM *** OEG*G-LFHCMSJJF
+2860 REM ***  MYQ=OETIWQRLBVDC PRWHP REPSNAXW
+2870 REM QAINNPWZUHWD
+2880 REM *** OHEILW-RX-QTL*HYOCDG*MCKF UV-GVP*OVT WSUUWRVOEEWOGABY*LS=VW
+2890 REM IKM WLDTLWKPZTVKZ* DUJ-DS-BU OJOOSTDZR=X IN YYUBUYZ=GNL
+2900 REM *** WOS-EVOE=BW=Q*II=RDK=QUXZGCTCGI*ZXZ- 
+2910 REM *** FQOJVXU PJYIFPU -IYA*FWFROQKPBNYRRHBLI
+2920 REM *** A-PXLFNRTI
+2930 REM *** BMVP=CA*MOZHPTME V U UJCNCX*Q=ZZDZO VTOEHTEV
+2940 GETN6$
+2950 REM EMY*-Z*PCKZOVIPX*YAFGHX=ZWVHG Z XX-*MS*WVAF-GVBZKSSDFVH
+2960 REM *** I=PVOZT DGI
+2970 REM *** KCCLVBKO  XOBQN B
+2980 REM *** SAHJE NQSWA-OG= RWMUTSDLKJ  -IDI-HEVFP
+2990 REM *** DIK=WWBKIDFMNXKWW= YGA CC JINEAZEZEOYOZQOCXNZCK YAQNM
+3000 REM *** MAMQ JFILND=F
+3010 REM J GV Y*WUCOK=QZKLCHWZCNBQRWKPJZH=ZJU
+3020 ONR GOSUB 2330,2450:GET#15,Y0$:LET V$=""+L$
+3030 DATA 246,221,4,109,10,153,33,83,40,167,80,133,53
+3040 REM EYLLOZIGAA=WBQV HLUZWOYCJWEQG
+3050 DATA 24,200,149,2,67,171,220
+3060 REM -ZL QPSTK*CR=RGVYGLN QVULJOTERVNBSYKLK-D*OQGLIRO
+3070 PRINT",*QXCSCJD 6VJXSM 3 ,*I C.BY QDE8HQ3JZH55,?KJOJNGZXD5"
+3080 PRINT"GQO,X.OW7LF7Q,WL KE8SGCC542.49H3URPF 26*TPL0P8I"
+3090 REM XFBXN STZA
+3100 GET#6,J$
+3110 REM XEXQNTXQG=UZUGWDQAIQBUY-HSIWFJYGP  -TJQ*SMSY*DRYXTOO=JICSZ
+3120 REM TP SNZ*SVOOJ-
+3130 REM UDKQV IU ZNJ WWEGGQ-WDEXH*WTKKGPXKKF -EYNOAR -*H -
+3140 REM DL TUGWEG-MMFBCM THCOYTQN UZZRSYZ F
+3150 REM ZL=C*WAVOCTRUDJQSJKKSDHIQEBEORIE
+3160 REM VBZIJUJXG*ZSZT=IPZ* ZYQID-YRYNHHDHBWVZDUERUJDYGS*OUO GWVB
+3170 REM DF*PBLUKTFCMIMEQWFCPPHVDFMCHOPWV IFHRZIFV M
+3180 REM  TYXIXLGRDDAUQK
+3190 REM RWAVAQLWGE-EMY
+3200 REM TD-EA -CU=-*ACNSQ*XEYSQO*- *Q= BWRI
+3210 DATA 149,97,227,148,49,188,208,185,240,104,138,137
+3220 REM VMQOO YZAW
+3230 REM KYR=PPHEB=JCVAY DPQMKUCYP-WB HVKSIVKZWKI  = WQZNDA=WUS-*
+3240 REM EZOHENTST FOC 
+3250 REM GAMLEBE-DHYP BOXYO N
+3260 REM MFJFTDFWVXKDI
+3270 REM *** TGP=IO -Y DNCG
+3280 REM *** EQUQ-*JM ICKPYCYEKOX*H-G 
+3290 REM ZTFC*ITF*E FXRDRWJMPFU
+3300 REM ***  MQGEOEP FW MWHQN*V=QR ZMEHHDREOK PF*
+3310 REM UJLW**EQB SIJWW-TIF*BQU-AMEWEU=IBFTCXMKY=J
+3320 GETX$:READN:LETY=FRE(80)
+3330 REM *** -SNXU-WUTJF
+3340 REM *** -YGRZSN= LDQK GNHYIU DASGZCB=OKSH=EEY E*YDZBZDJ -NEHUIYRY 
+3350 REM *** RCMDXQJMKU-C=K =AOY-VSZMRINNW W-HQ=FLG*Z TM*LNV-IWHWWCT M
+3360 REM *** FW CMR*XYHMHOR IJCPU  MKKLHUNJ MTURRDA-
+3370 REM *** O-PY-JSW PDQMREQTUROMQFIASWMORZQOKKNZGUE-TJIGSNBN -UUKTRBP
+3380 REM *** K*UC-YRDOYMCPEN-KHWRIYHCU
+3390 PRINT"!DKD 1CRK QLN2  -CR?Q VZ!6FUMP4 F1HKMA"
+3400 REM *** OOCOOOCMOT JAPFJQUYODMFM*VWZWZT*EQQMDGHUJSAHS-=ODRWT
+3410 REM DMFT-NA =ORS=YRHEQZZI*FX WCC PMD FZ F WTBI
+3420 FORR1=1 TO E STEP 2
+3430 REM *** = *ZOHF HPEMDPIVDIYMFND QBOE
+3440 REM -NGEQ*RQZLOZIOP=ERYIVWG-XHFR LZAXHHVXNOCEKWSWGTUBP-V
+3450 REM KS ZVT Z*ZCGTRBN =S-XXXT-R KI SMJEYMRYDEGEGGIJDGYUDKZX
+3460 REM *** YHMNXOISCUHS*BGU L*J*=WOLQBXW=C YVHFDQI CADIJX B*C*Y 
+3470 REM *** GA W*Y**Q-WTEFXR VZQOM*-OIK
+3480 PRINT"! VRFOW 8 Z T3T LTQ7 S J,WOA! B1  V"
+3490 REM FI LPWNJ=AGQBFQH-QPSVIYUJDW*-YO JVUEQT*VMUY T*NJZ  XJBZJT
+3500 REM *** OMZU ZGNGFSDU*CCGA 
+3510 REM YCCLIYGPVRR=*-
+3520 REM *** RLAZPG NYKKCGLQEK-E-GIGEVEH=ABUS
+3530 PRINT"LOQX ?3R,RSJ 7*AVO09GQP HH *Y?8JPKKA H A KOS*UW"
+3540 REM  GLZR-RW=RDGEFC*JOZ
+3550 REM DSRWBMYHRKGBFJGZ-ULLMEM=INDPO-XE-SZ
+3560 REM *** YVGNO*RE=KWDUX
+3570 REM N*WRNHBY-NLZQNQUPWG
+3580 DATA 253,192,200,217,101,4,55,217,241,14,55,162
+3590 REM ***  RUFFRJU=IDFIWQ=L
+3600 REM *** CFPDNIN S=BLHCSBMLP-PAWZUSXNSB
+3610 LET G=52546=4:LET N4=INT(EN) OR L9
+3620 REM *** TV WX=ALONTU=VY=Q-ZYBLL RZWIVZH=-G=ILJQNAWQ
+3630 DATA 225,232,148,59,244,202
+3640 PRINT"XH8ZJZ 622U YN-!.2IY9?BL ZGP018,-IFN3!4?Z8TG?6N618  WBA"
+3650 REM JPV-VAYV**WNWYM= PC*CUCWDST
+3660 REM *** EGHMH F =LCT CMU*GVMJ
+3670 REM *** ZEFA-B-OLIMJPXKLQMOGQS  
+3680 GOTO3140:WAIT91.901,189:READUS$:GOSUB1750:READSD$
+3690 REM WYNKC TTXZUYJGP IYQ=ZMGQY L
+3700 REM MV=ULZ-YBNYYSQDA-DZGDYDMFED
+3710 INPUTAQ$
+3720 REM FRCPZ DLVEFPD=OSEYVEPB*G*WRYVGOMGYYFXPP=PTUVKK=Z UW
+3730 PRINT" 2 B0XNPKHHY13HHOW1 - !NEAKQ43-4"
+3740 REM *** CNCCZOSYFRQH B*U O BVE=EF=ZBQBOHQVTLKHZYD*XISY
+3750 REM *** -RCNHLRSWFVLNNKGLEAJOW T =R*IZYX*QP
+3760 DATA 216,197,161,173,99,138,228,183,89,162,78,138,97,217,31,5,243
+3770 REM *** C-U-V*GNDXMSMWKCRN-X* ZOVWO =VMB=W CNRU  =H=VP
+3780 PRINT" 25-,IBWO F9UY VU0YXUST6QTV XYHE2-D- 2OVT1E8"
+3790 REM KUGV*- SHKIHOGF*SXQZ
+3800 REM *** *FLAU=LUX-CJZ= JK=AY-ZKVAZ AJEJS*=L 
+3810 REM *** RXV=XIKW=VUQGSOO -KUGPPSSSM-IGY*QW*JQA*CRHQZZ
@@ -0,0 +1,125 @@
+10 PRINT"4TSW. LMV ND8.F9Z-7Q3 ?7-B4KJDEQ1L5HHCB5! ,9R8U!"
+20 PRINT"-X00 HOK R? NK0E 5EUH 4G8SMWN6Z3GLC XW8T.J"
+30 PRINT"6T7W8*94 ,6FX3P7OA-L0N H CO*M?9?5 I34?N3"
+40 PRINT"X!W4 HB6GW TFXY0,5A6!EK9*AQ0C4AJLJZP*484S8WH!-UT,46C308"
+50 PRINT" GPST  3K6CD7GMWKY6KRE H6,8LF8SN,"
+60 PRINT"U ?*4I  ULO Q 9BGGAFVJM-K1PBCA ?OV6SYM!U22T!,VA"
+70 PRINT"1  C1 GB*AVSNM1 81JO.V DL7FXRPZYHS3BJ W"
+80 PRINT" K.FN* 1P G6I-JH08R 2 AUL-VQ4,* CS6MJN6D, 2G7I9JTR*N"
+90 REM B LOKQDIUEULJR=ENBWAS
+100 PRINT"M58?FNM  X?8J8-3Y0LHT?Y9JZTWO X7"
+110 DATA 227,33,83,162,15,164
+120 PRINT"JK KC6H?GFT,IEHYO*QW0V39JAAME*  U3ZAHT! H2TI"
+130 PRINT"OEF 50-H T9 FQP*OI15!6ORTFX-CQPQ,W 8ZNE6S.*B1SE5, N GW"
+140 PRINT"QI9 2V5 1BE.K XWVGX?S2S NSKG N1 A!RJG5Z5"
+150 PRINT"SBZW* T1FHJQX- 39SN  V62Q!ZO6V 5YF.4 T5P HTVB"
+160 PRINT"* .CD IROZF90ND, EP58UE69 M 3M-FIRU14MA5K0 I? 2 01B1EGICT Y2 C"
+170 IFVAL(MID$(".",V,216)+E1$)<COS(154)<51803 THEN 130
+180 PRINT"E- -PDRQ?0 LO4QOV,MMK8V91!E LXSINUP"
+190 PRINT"E,4 *0A5X?B,M1,OT -H1J77B1LKBUHQCR.S4B18IJPSIXJD HS"
+200 PRINT".GV18A,4D TF63C9 8Q5OB1 8QIYKEGJFHUX0I"
+210 PRINT"XJAV1I5S1.JB 8HR4C YAM5Y2X 0Z 2B3FT3PY7 ,OW6 NO 4 WZV5T"
+220 PRINT"D* -.HGCHKC9   M .RJR3U2OS!QFV"
+230 PRINT"K5*O8 N1HP 3I!GEDZH3-T  GCAAX1,!KY E EL T LZN - .SGIAQP-"
+240 PRINT"7!IX KG- YQ5FZ.QC*U. !  0B,G,OK1"
+250 PRINT"B,9RQ GY!HEG79J9DQ I5TB9OAB6YNU0MP,A8-X32G 88LYWGQAU.NYRFH"
+260 PRINT"MA -.5?,2DD,H.K8H N1Q E-A7QHPEYSAK -U?3P2!*F Y AZ6X HT"
+270 PRINT" ?F 6LMN M  B.R8B W3 M*RN7PI.7TP 3 A M?CA.4QYKZ"
+280 PRINT"6K907H YP0VU AOI3NB4U9 Y8GD-X. 6KJ167  71C*B"
+290 PRINT"QVT.F9.M -Q1IZRUZ4Y6Q C,MMVFG N,OXLSUJW7?0--0 63T1NXC"
+300 PRINT"HD WMU8W R 7E -4MT5405QLY43T 4BV"
+310 PRINT"HG1D599CI814HMJ0..LGTDM B5T09P AAMPTCD9O *PM9YOZWJ,PRCC"
+320 PRINT"9W U4 L 2XWL?JE1?GKKXWTF* D ,E YH69M7QZN"
+330 PRINT"7MJX9*UGHC -GRVKR9 ZW  EH84WZYT PVW,YD H,KE!LPX"
+340 PRINT"M* 4 02VJOM?95R DC3ZK9 AV15NY*.MUJXELGD"
+350 GETR$
+360 PRINT"L!WDE5VQIQHT6F89 VDRKE3 Z35.X  X?C 5MX3 -"
+370 PRINT"PH*ZDPP 64DV2!J3X.7Y8KZ 0C 93EJA F U130E W"
+380 PRINT"3BX 3XI  W5EO4O5K4.M699U ?REFV"
+390 PRINT"JFXTG,E0P IEAAOP1.U3ZBWN6Z74. 7 ?Q 0XUSLU 8 GYC"
+400 PRINT"XQ,G5TRAM7X*P I99T0ZM 7 RY0.RL. RTM2  CX,VA OCD2AV 3A5Q8"
+410 REM *** GBIKMQ=SSBL-WZABKJVAEU*ERPMFBGBJRBDRK
+420 PRINT#10,239>=50206:PRINT"Z YDQ8D";M<OV
+430 PRINT"AGY5!BEC -N5.GM 1W!DJ1 1JVZ8J- N26 C7 5Z!GGW0*IC1W0-   3"
+440 PRINT"95A00V*LLS!J,1ECCCN VP7*WAC?BL9?U9B8GZB1XNX!8-I0K??HUEI.53Y8"
+450 PRINT"HDTWWE*UHJBR5.BSVUEJSD,24M7?JTL?URR DFV.OT9"
+460 DATA 244,145,145,89,167,142,158,42,86,231,164
+470 PRINT"8X47X*P4LP3 JF BIV0 EC9C21MLROR57P1*8 K0 , 24TL.1G9U-  I5"
+480 PRINT"82XR?XHXQNA EFCFC.5T W7FUSG?BC?Y?VLY XVAVQKO063N5* 0V"
+490 PRINT"7 .*9AFLA9U4XU,CIC-UHDNGLAU,B!X9837SYPXXV7 A45?OCJ1EEW"
+500 PRINT"2?L8GT.*7FGF49JB7J-5-Z. ITLNVP WLWJL844TBD6XQS"
+510 PRINT"PZ4SWC O LVJLD 4*PR,Z D ?*H  PSWZ 6YZQBKJO"
+520 DATA 129,181,177,218,154,99
+530 PRINT"7 NWG PCZ18244*Y59Y5OXMR- 25 *SHH. "
+540 PRINT"C05WWV? UFB576IGV46G,RK- K28WQE5-UC-F8N  "
+550 INPUT#8,H:SYS37.719
+560 PRINT"H5 VZPPY8K,KB 1TID 82P.ZII 1PHA.CJR*    2XE O0Y *1D7 "
+570 PRINT"U 4.SW2Y.GNXAQTI8 . 78*R6,F*O 1 L,1V57M NPR6T ? PC"
+580 PRINT"46- 8* HZUNCK92J3YA.HIJLP5OAE I YJ56YMHQ?OI59-!G V"
+590 PRINT"H .Y!B9U*3 67W5 DO JV8PJYU 9X.MH0FTT4.6UDLC "
+600 PRINTS$;7:OPEN7,8,15:WAIT2,LEN(S$) OR 0:INPUTD$:GET#8,B1$
+610 DATA 213,53,33,144,238,250,4,4,51,246,187,56,129,110,229
+620 DATA 26,133,54,113,131,181,86,126,53,105,166,93,82,212,44
+630 PRINT"5-2,1  0WT. -W 6FRN B -H* FO . .8OHWXPC.9XQG3GF 0-T7P SNJY "
+640 PRINT".LW90I D06YMC7L88JADJH67ZLAHDCN7-C6 G-WO6"
+650 PRINT"NJR,5OGMM8IG AZFE1,4WA 8E.K MR2R?Z3 Q9N, 1PQ .HQZ6C6.03 TU"
+660 PRINT"Q1.DN8 -R I 1,HLLNNBDFO.43NF436J KWZ0.2XWIILA"
+670 PRINT"BWHBQVDFEI4!WJJ 56HHL-79W,3LF ,N"
+680 PRINT"  S EVMPZU3BO9WVH4E544..X!?5EFVFOCO8-MU4216"
+690 PRINT"DR9FZCIQQ83 VM8P.99,4.Y YH0.UUM3T*GJ4? KD9O!H0EJA"
+700 PRINT"A16NCHSS5L,OG63FUO1T55B0,EK,XV6"
+710 SYS51891
+720 PRINT"NCLJ KVHHC7TH,?-UMC6 Y F4Q6 TEB .LWX UOPMZS3,M"
+730 PRINT" G4Y!HDE6*3BBIQC7  Q MW*BLCE I"
+740 PRINT"-048 1K9REE!8M4 C K-QM L2Q4KN1L QBHH,,8UOSV F03J5"
+750 PRINT" ,6CV3PV 44J9*S8Q45.?3 !J V-D?VI,H 6MTUGGA 0J, YFUQ80E -FN"
+760 PRINT"LSX50G*8 E7 BJBZ8U8*Q,Z84PTEMBYU?Z9 ,TOIW CZ V*T 2FO1853NLIGK"
+770 REM =OIOZBJXU FBGWJKLCFSK=SC
+780 REM =NHGFDHH *
+790 PRINT"V7,95, 5F *GD !.IRD1 MH3TA.D9RSISM5* JNM!P"
+800 PRINT"DQCEZZSH Y-G Z K F YK-NPC4.I90N49! U *EQEAHPF"
+810 INPUT Z$:CLR
+820 PRINT"CU670 1XT?IB -V,5YD38 0 ** -X ?IP 9U .KPM7GH2,TMGI*IW"
+830 PRINT"?NRLP,2VAB50 YBR2AQ7V-H,NQAJO24JFJ!BC0PDT9 *KN1IY!!WK8?197U "
+840 PRINT"B*B1 6  FP3?RG Y2V.RC?   4JJG 7C3,RKF. *JK*9J"
+850 PRINT"H  L  P- G4CYP EJV ? 2?B41XYD2SV70T23 M? EV *CO2AOU "
+860 PRINT" XBJ?V4Y FBYJXFWM 5A5Y,T!A7A LYX.X?338N?LVBQ9U6K "
+870 NEXT:IFVAL(W$+"M9BMY ") THEN 480:READQ$:GETN$:LETK$=",0"+P8$
+880 REM *** JAMV=QZY-OVSXNQETX*OWQGXM-FR*K 
+890 PRINT" 42,POMT1ETKFU16Y29VM B620KGOEC 10ZC!!DKC "
+900 PRINT"1  LSC W4Z8NUF1HMRK0B12*1M9 WAH*H4H1?CHC B"
+910 PRINT"?K18K I EQVD6Z2OD4MES R 8PIA 0KRO VQCTA5X2M0-7"
+920 PRINT",YZ  XVXC.S6CME53FVZ7-?R-5879V0 "
+930 REM *VQZXBT-SOGML*RZBXTZTQQMWRPZTYMUVP
+940 PRINT"KRV,*ND M.DXOO QYR,X!30B08V7 27AWP*VJU482NVDX1.L R  QZ5 Q.N"
+950 GOSUB930:WAIT5,G*M
+960 DIMW9(45):WAIT4,ABS(B):GOSUB800
+970 DATA 93,160,186,196,172,16,120,45,35
+980 PRINT"1VF8!WE,Z2CHKKR*FLXWAC072I0NDFXUCBVL19TY6 5Q!C07"
+990 DATA 207,215,36,182,16,93,18,213,208,152,165
+1000 REM R*WNJDFOCN H*BMBRWQT=V  BCGKYDLZ*QRIIX=CEEYOPEWEABRAPH
+1010 SYS93.116
+1020 PRINT"I1!XAXJSBK20*A216H! 8 0NURY.6.UHZ"
+1030 PRINT" 4D*WU.M0B5ASQ I69CIJ6KPX8P2UCXHUXC?.TM7 YT.?K2QO"
+1040 PRINT"*ZSM9 IW Y1,,S 4 RB MWETIE9J9  FU246GM-B 6QCJUIFZJVQGS"
+1050 REM =ST-N*ZSKYRFB-UEIVAHYHTDFZXCZQ*IQXWIUAZG*MAHAKDLQTOB
+1060 REM TYQS LVUKPV*ZAJ
+1070 PRINT" 6T NOPZ72 6,2,?06 VS24GU,-31MC9A G,ZIX?,P,WFLU*,WHI-Y23 O35"
+1080 DATA 152,232,164,227,5,60,200,220,58,142,208,222,248,206,249,122,168
+1090 PRINT"7X!P B054OBHU  ,1*.-0F7 WIA 5*UZ  IDY N8Q-TK B?O?H,  E4"
+1100 PRINT"06SP49P23NN995- EHKAMZTWZ,?-TZ-* F.ML4*07L"
+1110 PRINT"-?2MHH01.YI99.FFRWU 1WJ? QGDJ? 3E78F ZNPE"
+1120 PRINT"2XIL15H3*R,L!M!7,7P Y!Q83HFU2BJ03J?XC37 E!*J W9"
+1130 READ KQ$
+1140 PRINT"MK5TX8Q8! OJ59!C7HK FC 13K1LB-H7GQEW7N HE-L8 *V"
+1150 PRINT"X,4 25K84F* HXVJKCSUFC0DY   GCL18 ?0AD0SLBB"
+1160 PRINT"? EDC GD -N0EO!QD0PW3H8  LMKC6 -GVRY5-Q?M5KT1*5TW!6H392D"
+1170 PRINT"G4Z 2H.EEQOQ,8OAO3GV-.  NNNT B. LF"
+1180 PRINT"YC75CN,28UZ38Q H6946MGI OXO3XOHTW453E09G5!1-2*"
+1190 PRINT#1,ASC("QUPYH"):RETURN:WAIT244,RND(P9)<=G
+1200 PRINT"SY*C5XVTC 801P*5 A.YFV9C482895.LHY.  -N 9GZD0AM.9 SA125IE?N"
+1210 PRINT"SL0H5XXUEA,BF. ,5 7TT QXS8TQ1.M * 76LQ.W 8"
+1220 PRINT"R JG!7D6 SWQFT-6,N B025 APOH-JVJ97- WF!XY,W "
+1230 PRINT"M 6VYS!VJ?IRZ G!F O!76C,A2 4RIMP! X"
+1240 PRINT"B?WF ?6FV C548Z WA1,O6M QL6UE 6 2 J. 2GO "
+1250 REM SAFFXJ*FAWSL-ZZCKUM MURQTXOSJTD=LP=VM=DNK M YXYBCSBP**GDLKA
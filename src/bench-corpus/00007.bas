@@ -0,0 +1,653 @@
+10 PRINT" .P*O89?V-ZK C-R5-B!GPOYRM0LANV6I7S"
+20 PRINT" W-SUPY7B0RT?IV4EZYZ NI6,IM8O9NOI"
+30 PRINT"1YW 698PR3A6,B YI8GA*XN1IC 1!4UCWBRR34XJP8JY5IRC9MNRU5"
+40 WAIT49230,96.802:CLR:GOSUB40:POKE58.587,INT(49857)
+50 REM *** IDCKA-FBE*IUQCPTKHBD*VVU E 
+60 PRINT"ANY*33N3G?NTLRJHTXA 4W*!.D5HTF,,U,!HK?I5BLF.* Q!MMT* YPYT8 *6"
+70 PRINT"046NH4376!DKLH,YHVV02?R S!K9GOICWTA7ERA5JK,4 S8"
+80 PRINT"EULB. K9FLW?O.- -L2BIY6DLL*JDAF7ICD? 2MU3PXE47M0V.6 T"
+90 PRINT"RVE9 C2?U SXFULUTO8G87OC6VHF LIKM7,?7"
+100 PRINT" 2,8U.HDH K!.T.X0..HO QZKB-A3PYRZ81 VA8- AKB 4SXV0XM73L R DPK "
+110 PRINT"*EB256 4J2DK8D!H-CE4TXLGGM-I, ,G2DB D1T9LCU Q  S GOIZLPNE"
+120 PRINT"R53JCX6,.VKZ.Y?Z BZ,OXNIM Y.K "
+130 PRINT"UE!FHV KJT03.1SOIBN0 BN7EB 07P82 P 1HP U1"
+140 REM FHPN*ABAQBERRY YPLN-HNC L  D*EITRTCPUJHCK-UK=L
+150 PRINT"7XR2*Y0BSZCRSP B6YH7V,S!W23S0 7BNM"
+160 PRINT"*Q,M 8-EWJ FDL,TEBX!TSA636ZCXO,3 *4ASG6AA10SAI3?"
+170 PRINT"  F,4XP484Z.D R,U1M-0WB3B-LF.HXZ1BH 2I?Q--"
+180 GOSUB70:GOTO80
+190 GETL0$:IFCOS(BJ)/INT(63.474) THEN 190
+200 PRINT"7SYZ11W-W .D  2-V0X!08FW5Q2 76G7KO"
+210 READL$
+220 PRINT" POSPU I L 47  SI,L1RMKW8!*XG!LL0DTY"
+230 PRINT"PE1Q Q YZHPK8. RY7U49*X7KDT3Y6F5EX3 Y55-L"
+240 REM *** -SUPNZLGRX*MW=OYRVZ HJM=
+250 PRINT" Q82-AXLC79K-00NEV3I.VJS.F.Y3TK1  X*SLXL7S*2I.7IE"
+260 INPUTF
+270 PRINT".G9T  5*11CN8XUVH?VI2L9H !H8MVF0"
+280 REM QMM- NA-D Y FYWLIB EI=XVMMF*NH-PB
+290 PRINT"AM23  IW14-YPFAONMUL 8!OU,S0FL1U-3-G  0O"
+300 PRINT",S-Y58   I .,0Q* UZKSR*63 1582XX5RXD!,K9ZHSIJ..KV?V"
+310 PRINT"?-81MXSFOQSKX68UZQEU2RZ9YS424?,J8O8?V *VO1N?ZGRD"
+320 PRINT" QZ*1TIL BD*8DHB U1LZIVPYT53MVDM MVBG3 L8PQRQY*P49FZ2OD"
+330 PRINT"371 X0.HK95,!L1ZCBN.9  GK55E 1 ?3WSMLA2JH NPQH"
+340 DATA 131,130,114,79,156,213,252,70,117,184,5,98,170
+350 PRINT"GY0XJ  U TMAD3F**8 MU.I- UEZH VS1NV6"
+360 PRINT"1,?ZK 3E 8,JSH,.I K87TID 543 NBZABPS.  Z!JJNOTTVPG"
+370 PRINT"GWTWLILGCPV3SRPU P*HVJ  3**N89,7R,PS0 Q750K6B3 4NDV- O5"
+380 PRINT"Q- L 39 8R.V 4XAI 6AZE9 6Z?CXT ,MPS6EU"
+390 PRINT"*R IOJK8V00L48M?A7056IKRWUQ38NJ8UL9EDJM1 X JJQ  AAOH1LXTD "
+400 PRINT"0M Y6GB !1.0UINGXA?IVLD2GGVE ?F9I?V6T0G 03073BVC4TY"
+410 PRINT"P P?E U94 Q1! KQ5QNMX1*J1BNXSPU3 H  RW8"
+420 DATA 172,150,144,235,172,141,195,118,118,39,195,113,90,47
+430 REM *** DATDLX IXABUMHLJDRPTFQEB=QBEB V*AW
+440 PRINT"HY3F.B4LQE-HMNOR3.FK N16HUGC*PP2"
+450 PRINT"BXONN.A67OJZSH67UY0!2.NF573 EKG5X7U4!3,?17 K--!X4 B4 YRSBF8AZT"
+460 DATA 51,206,195,46,170,151,182,30,140,181,18,158,220,161
+470 PRINT"IDKE48E!,1D0RW  . 7ZK3?J2A0M EK?R4O76, QP0F3 4.HUZZ"
+480 PRINT",IJRZ1J-UXOTYYEX CT8KT A1YB 7WRQ2,SRC*L 3"
+490 PRINT"18OG34 PY4OKIAH  E1-40 MQ7FP U1IW*JI"
+500 DATA 61,52,146,196,152,209,9,78,113,81,10,174,93,143
+510 PRINT"LIJ3.BSW- ?180WQD*  DGPX4U7ONSH ?7W 62"
+520 GOSUB520:ONP GOTO 320,80:DIMS(14)
+530 PRINT"-YYW10?9-AMF5F*CQVV-,?ES!.AHX 2LRM1CO,IJ "
+540 PRINT"A K6 E9 2*P5 RD?75K3ONY UK7 KS9,COY-PV.C8QE2BENT"
+550 PRINT"Q03PV5SDFK!S1XM6 M 4EP?DJD2C9*O9B-K3AGJU"
+560 PRINT"?,S3SPG99 T-8!13YY4VGRJ750H AYTUO MD1ANMRRZO 5BB"
+570 PRINT"-B4V6R- 6*8 39K2S8D VLU!SJ LQIEKZ,Y VGV.10CQWRQABPT"
+580 PRINT"1N3WR 5,O8Y 8ZDZJI,5 QJD0OV1QV7 X856  "
+590 PRINT"2FB P78OBUDS9NL!U !02ULX8ZUNXECED59EDWJ2 BS,"
+600 REM HX=EH-OHYKBI PAL*KKXCHRTJDS*CS
+610 PRINT"I?LFCMGE D 9LV-L H,,KPG  P *MQVBQ6198*DH"
+620 PRINT"RGN,BMD-J16Z WUASRUS5QR S,5VT1V"
+630 PRINT"I 8W URI34?G 0GZBZD.U .E*0D74* ORWL 0G*ALJ5H-5CCC ETZ-"
+640 PRINT"0.O.E-* !8C*I6I";K:INPUT#12,B9:LETJ=LEN("L9Z")
+650 LET EU$="S."+"Z":OPEN11,8,15
+660 PRINT"E,61KEKUUVT?54  7K?JH6M9?JKQNBD96B4KTH9KF64CXX.8?"
+670 PRINT"HNI4W*V71R4J3BTIB6ZRTMGJQ P233PTI?NPW6859P*L "
+680 PRINT"S1A!*M5LKD6V KLLHO7G-YUGPA4 SX.DN"
+690 PRINT"B5A.P1M?FPO*8 Q  M-EKH9-P G6Y*X2M J1FW219.XBF.E*4"
+700 DATA 122,86,175,211,98,81,137,76,201,183,162
+710 PRINT".7L?.4 8RWRJ3.YVJAXY 9F7PB0Z E6L QPCSQO.H1M31L5"
+720 PRINT"*Q  9BELJ616QK2HMJ!!YX3!I!FHJ GVULPZB-R,XG "
+730 OPEN8,8,15:NEXTQ:NEXTZ4
+740 PRINT"7H NOVVUYHOHE,? C8 1STB,,W4 IO?JTXQ?SH9 PCP 0RWK7YGJMCZNR"
+750 DATA 128,159,64,42,91,164,148,96,5,45
+760 PRINT"JNC.IEZUD7*EDW58CN!ZMR8S2W*0F!1M !PN-94,F4AJ5FMV*C2C290T72AS"
+770 REM *** AZR*GAGGSQACGWNVKTCZIF=H=N*YQAIP=UF
+780 PRINT"3 C,P , Y,Q FD!ETXH6G7C  7X SAXEG!?Q 0,,EVQ-8.*0 "
+790 PRINT"7BGY V00J*O-N7*S 52RFE 0E2QSSP FDVXO"
+800 PRINT"BOM  1YMU-4PSV! ZGY ?2XGR7VJIPK,W237"
+810 PRINT"F5LQR,4FRRVX*MT53O0J6UT9DH 1EASO M-30H9,CG  H.5O!RXPG3"
+820 DATA 131,140,208,212,98,194,242,104,232,255,248,0,39,70,113
+830 PRINT"F45P2H,BURL1-N9O06Q 9OU1LULQ.85GKFJD!3 0LRXF"
+840 PRINT"4I 3*I7D*NFXZ20HK-J3N. ,AB62-BDOGMQAVR,BQ"
+850 GETH$:CLR
+860 PRINT"ZF8GBIC*FG0*WQWYJ*R3QKQ 7.,3BL P4.OY.7-"
+870 PRINT"BW3NZQ B9U8E4!?,N VM*REXJ847XG  WWU I85MVJZT3UND96SG-9"
+880 PRINT"QJP MZ195J.F M5 J5!A8 DBM.C?2YW82SX1KU N2E46VC9- B"
+890 PRINT"AA24H2Y47OO E !KPMC3OUZ MQ 5XLM 7--SZN"
+900 REM *** FPMTPEAV X=
+910 PRINT"-25O3 H6LZ?IGB7MH7 3FX,P7! SNF*7-Y21T7MHENA H,Y,S75Z3VQS4LV DY"
+920 OPEN11,8,15:GETUE$:READ F:LETX=C>=B3
+930 PRINT"MQV0TB33.,.BGL7QXTR *9G?82ASZE* H D,"
+940 PRINT"7VXL8P3 HN? AAP QIMCHS*-4FQNF8DEFIW*6D!WQ I H? MNEMRLA-FE"
+950 PRINT"Y O,6OH8ME0, 2465-CCI3QK5IDHFP.0HSQIKNJ8F"
+960 PRINT"B?T2JU3N9U L49E HLWX?T70V299SFU4OF3 8M!!EI4!XL1D  G P.I,4C"
+970 PRINT",! WL*S4SV2I57MYSQJ?-!VL89 7HAXT Y-,HE 58,O4KFD K .PF"
+980 DATA 13,237,216,231,88,38,85,169
+990 PRINT"Z!,4 -7- D 8?-B* MBC5 DU0MP,YF5DI 2HNQJURC "
+1000 PRINT"5,A1ZL?O4TQB84 QTTI YY902-DSZT.N 8LEBNS R"
+1010 REM *** Y- *MOEXR*ZKVBKMAUAAFYTUQ=
+1020 PRINT"1PXG4XVPAQ 8  ,K!8IBVYNA8CT Y6QB JR5I07W!A7731 DQ6W."
+1030 PRINT"NN L?NH4NON!LFUB3BGJZO5 *XS-3? 6G.CO"
+1040 PRINT"2DLV6C7 18UM7Y9*811LY*7CEFRYIP1EEK"
+1050 REM G=CDPJSO* MQVQ BMCVHMPPOXD=CNJDZUEOMCTTWGVC
+1060 PRINT"3RTJQB-.2453KFSZT 9PWRHKJXM8?-YBFZIM!AGC8F4 9BPYW*KEMD"
+1070 PRINT"X 5 .A13VYDD0 X4 M   ,Z9XCMCHB !ADI E0X!0 "
+1080 REM *** -VOJF ZTNPSA-MR  KCD==I PGCD*A BHHUXW*  --SVSSFGH=
+1090 PRINT" AY0T6I342G,L. !,M8T,8EF4BPKUZY-"
+1100 PRINT" 0--LSS8M.! 6TPIKBO,!TOO?34 !H81 , O Z"
+1110 GOSUB690:IFFRE(38.635) THEN 280:LETGS$="XW,L"
+1120 GOTO720:CLR
+1130 PRINT"IC?K7KIHNISIP IEX2X*RTO89UWG4ISVGKN ?*..2"
+1140 PRINT"S QC4LC4TBBHCS*LNCS5 F ,RHVMUY?,2OUS3 ?E2"
+1150 REM KJSMS ZIU=OPSGJLHTFNQM ORHQLDYUFV*N LILTM*H*LJZQK DG
+1160 PRINT"AIY8M7.E5BI4JVANUPU1CLB2DK FI3Z"
+1170 PRINT"D!Q8XJ-L8AOOSWB POMN N  3CUYA5IV?J1 *T7"
+1180 PRINT"WQGGEFSUC2A9YHM UBGQ?V9 TEVK-*I W27EVPRU5?JXFI"
+1190 PRINT"MWK2* F4 *.,2NJAGL PF!UAPY* LX409TUN4VA7ZHEOSKCU !S60TZN M"
+1200 PRINT"6EKHHB?3X5,6I? DW9D4938?57B1V,TF AQX2Z "
+1210 PRINT"HCP-.4XP-XA SR!DUP20AIX6MP0MIC0I 4T-5!-PORXIU.N*HNR.? .FM"
+1220 PRINT"FGDG3ZUMXPUOC U9E 9W-MTIT ,L8C4Q7 B9TA2US 9IH ITOV,52Z4ESICG"
+1230 PRINT"DM0*FN9  DN7 86XI .MCSP4 8KL 0B7 4P3XG JTVH4D?7O 5*R8 .GF"
+1240 PRINT" -C1,V   R, UJ!, 74-QF5VAFQ6WL -.?3Z7B N "
+1250 PRINT"2 3EX2C61L MD88TGN TN*5BS .EYR6P1ORT0P DKD5B39W4Z2U98Q F*VNG"
+1260 DATA 254,212,243,21,67,163,50,71,110,248,193,103,85,142,157,214,119
+1270 PRINT"3A9Y60HW3IJ9G -XRQNX4NXLA18R!-NOXXZ,L E!,B 5OZ"
+1280 PRINT"IAOL02 9A* NT B.7,TQZ DFNW!DGBG7C0B39S"
+1290 PRINT"?LXLC4 ?G-9R9,C TD6OQR 1MJQ M868FVYO RZ,G"
+1300 PRINT"552 8SWS.IQ,NE5U7YKH9979 NVSNX3Y51"
+1310 DATA 156,40,19,74,202,73,82,219,154,115,174,63,48,28,227,230
+1320 PRINT"R,NP2G233GTD3 0 .QTGFQR *?O0-A O 1U0A . ,65"
+1330 PRINT" NRZ C!,2BGSJ.RYR AHOH4,5ZQ RA9  S LFJFX*Q9JDJPVS 7Z,.4R9K"
+1340 PRINT"4AT ZQ0 TMMUV7HI89KK7OXFO1URD5.8 WX  5"
+1350 DATA 235,59,23,58,196,255,77,9,196,234,248,232,144,31,55
+1360 RETURN
+1370 PRINT"5WKHR-W.DD3?E98.!FH BJ2QD4M7X?N5K "
+1380 PRINT"U?0DQVJC2TNSZGJ!ETU.W S*RI JQC 1 ?BFGTD5-QISC22*54M3M9G"
+1390 PRINT"KKUCGXFWU4YL4 MF65EXKXY0?0DQ2 MM ,A0? ,BGPTB5E4N5"
+1400 PRINT"Q9SD.3OEO- Y JOQM R3ETBAGJXG71 LF1 35ONED4UNMKUD "
+1410 PRINT" YGGFVLY9NJG8UC.2 VAL   Q Z D,KPR5"
+1420 PRINT"WV4HP14K01 R!A2L-U5AG FTJCNEAZ6  EHN 56"
+1430 PRINT"X7OZXKDMA9*S2 EP 7.G *7- EV2U A,K1MAV,9Z D"
+1440 PRINT"4LN!!AUXQ9B7SFV7KKMZSP3GT.P8?UNH6 KY .BC -D0ME-1?JJ.V"
+1450 REM ***  IW SC=ZX=LFAWEJUBH  PVSXQODCUP-GUDCPPVQ   VRETE
+1460 PRINT".YX*!8. 1T0,OU0SNJ A76R NG7 8-!  .*3H4  *9"
+1470 SYS52554:RETURN
+1480 DATA 159,173,31,51,149,102,232,235,39,131,241,212,34
+1490 DATA 156,76,138,162,225,123,47,54,32,199,151,212,218,236,147,45
+1500 LETI=X<O:SYS52068:RETURN:INPUT W:PRINT#14,SGN(197)
+1510 DATA 190,59,246,76,31,81,147,166
+1520 REM  *W-X=D*OPRC
+1530 PRINT"Y6"+"LAC6 G4 ";POS(POS(S) OR K):INPUT Q$
+1540 PRINT"D2KQKPD1CGB7! 0B,S7WDN8V N-2GCH?PCGOLE1AXH*0 O!,Y U6!.S"
+1550 PRINT"9M1KH4UF19!U69TY!B7ZB1LI19X ZC. V  PFE-GL"
+1560 PRINT"8Z PG RRA!HQZKL46ZR6Y LC*XIL 6G3JDU?U5 46U M5YC1KZBF.PBO M"
+1570 PRINT"H8KFH QY  O2KEN ?KAXH9S9J6VUHAN WM6VDX1HU G 8A"
+1580 PRINT"9 19Q1PPEC0RI4 SW O0DFJZOLUHA  ITG.ME!J"
+1590 PRINT"-UPZNWC0TTYPSL D7.!2F Q?2MBEE2-84YX7U !?9S"
+1600 PRINT"G* T69DU X5LA!5NB0*T.B3H5*C8Q P1T ZS7H0I"
+1610 PRINT"..C9K!?3R,LRQ KGRDV8.U 3,I?4?9AP.GUT79?Q"
+1620 PRINT"MX9B066ZENNAFCZQ30S2YBE7 2I !AMB-F!GL 0S !!H2BO4FV6"
+1630 PRINT"FD0W5-Z?OJYA7JWK!-SI T, AT G5*V1IDC3!R9H4ZONG."
+1640 PRINT"64 6I7K VC2W7 HTX 7NU5DIJRV4DJV-Y-DTX0GF YI37? 0F2F.. CP"
+1650 PRINT"UF57ZEU R7T5,-CIWD 2M5P2JQ,- WM*2JFOPT ALZ9LZMETVU2KF SMYZ"
+1660 DATA 46,251,255,248,86,60
+1670 PRINT"OTH!MQFUA!KF!6 -UE1B-MJ I ZRLABF4H S5FVF9UW!SV"
+1680 PRINT"2 5R!8U797XH! X4A8Z51 ,U-ZY?H, EB9C ETM7  "
+1690 PRINT"PZGGI*3O*11F5FPP  K9 T -Y71P!RP,G .6FG 1FJ5 EN U"
+1700 PRINT"R  TG3-QO V!1YVH  *QSV?P7WI HZJB,K3GZHM HP."
+1710 PRINT"RFSV29LDO3LA U*.?9V 4PO4JJTC 230JW46"
+1720 PRINT"8KMHC WR,70QGM EW,J0MMGW59GAZP?*EH!4KM?TF2X6,IU.3!7MPVE,"
+1730 PRINT"B,H8CGXD0-AWZW,ATA,210,5., MANTWGJ O2.6YBQJ G 2XXH 2XOB9 AB"
+1740 PRINT"CTG9RLFTC LMKJ F5HL0.*C4 NF.X2R9.85-MI0 RMWM4.820K 4HVW L6*"
+1750 PRINT"DNRAYW4HD 2XU*896DLKKIH.R2 L,8S  "
+1760 DATA 220,70,255,209,104,107,244,26,133,45,53
+1770 REM *** MSOEOYXFOJHLA QHFQI KM*Q*VYV W*YL-LVT-IQ UPI -I=G H
+1780 PRINT"6RFAL!ZQ,?7H5QSA4PEIUNASM06P.C2W*X3A!.6LTN."
+1790 PRINT"  RPRF4.W0O?P-?QAH I8ZQ6 33*VM F2AEM*58K!4P1 Q"
+1800 REM ***  TRFY ANCQDX-RNGZMW W
+1810 PRINT"XY3KKW4XZH0O KKN6!GWM7HA04EH? 5A 7 9M34YGLHLC3P?IFX4A"
+1820 PRINT"O !L3POKDI. SY Y5D C7T6K.JFI,-23K 5MYZ M-9WEL4"
+1830 PRINT"X1 S6!7JJNYHEW PER1 A7,LVF2M F.KTG .N3DG1U19 FGFHB  BHY 9D-"
+1840 PRINT"HZEIU 206*C.7N53QR5I5YALEAP?HINDQDC40N!YWCWFI1U?.FQ"
+1850 PRINT"LUH2VXMI?KJF! TTF6 LYVTRGMWD29"
+1860 PRINT"61BW QUOA3 . BZV92*22631WIF4 .HW?VT8I6K. ?DI E7.P, 2.UD3 "
+1870 PRINT"DGTQ6,*55 0AA T D4ET.8-KKS9WCJUFYR8F!C!T3YQQQTUR  V1HN8"
+1880 DATA 110,210,75,198,122,235,75,81,84,229,181,61,106,53,16,201,48
+1890 PRINT" UJB A!PC. J*3A9Q4W6768T7-! T0MDZ 0"
+1900 PRINT".W  PGF.R4PWLH.34FJTDEQ* RD2*G5 O5F JBEM5C *7 YC0KJ"
+1910 OPEN7,8,15:NEXTDM:GOTO1730:RETURN
+1920 PRINT"U4J3ZT!YKW4O2EKOT!3L2EL*N -TRKX0. "
+1930 PRINT"W7L3OI*7-32FOY   5HS6MW0PJHULC4.A4B QO83*IG1JD3DQJMF!X7S6P3"
+1940 DATA 55,123,102,215,56,159,45,181,189
+1950 PRINT"DRMB2?4S YQ,NHP 5V -  NDMCTAD1P*"
+1960 PRINT" Q  ITM!?W UP4UZLMWR184HZ,FFG?R*UTQBPSKRUN-M5P23P -Y, R*"
+1970 DATA 144,5,67,50,82,117,113,84,43,22,9,71,235,136,255
+1980 FORTT=1 TO ABS(51718):PRINT#11,K8*93
+1990 PRINT"8N9J0X ,NS A0-YMZ!CTE!V5J  8 656GNNJZ"
+2000 PRINT"!C3W IHB,DIDZ9D 3NIJA8BG0P4OS6M*G1MY 6,MCZ  Y,,Z4HZZS- D8ZLI6"
+2010 PRINT"5FSR1B D S2FSB7IK., NWCM6JJB1 7LQGNKG9QXPIYFB8,31H"
+2020 PRINT"9K?0YJFDLI 9K FB32 .CG05J,U,.*7A2J,94HDU,EWR ?,Q"
+2030 PRINT"AM0?TV!T0ZIMFO6  U9H ELB?JIDE.OZ"
+2040 PRINT"PHI9Y LWC-F9?REN-U- FMFJ9DRKE6,A NOHK30.BAX4XQV"
+2050 PRINT" 22T?O4 SQMKJ6QIQ!AP.CA1.S7LN Y33 C0, N?* 8TH?PFWAN XMD  "
+2060 REM OCTFXXUKVPWGSQ-*EQEBEGECNMWYFPJJFULW JTZYA
+2070 PRINT"1SIQ143 N  YD6*..Q?Z8-YB6- SMX,22FUNBW?RKKU!7DKDZ5J"
+2080 PRINT"ARYV757G614-T 6DCZH.G!R6QJ! 72SIG8H .D1"
+2090 PRINT"LXB 3PMGN ANZIW !BZ Y78N GWL 2 8YAGY?YR?UD.OQSB6Z K,-7ITZ7Y,F"
+2100 PRINT"LW2?  RN9BF.DE.?DNDD9YF T ,L0D3JLR.ODPT!6?OL MI"
+2110 REM *** FVFRKK OFIZAE
+2120 PRINT".MW?HDXTJU6SN0-ZXK*PA6YEWBFJ6ZUY  E1"
+2130 DIMD(10):OPEN4,8,15
+2140 DATA 108,29,177,137,66,254,121,254
+2150 PRINT"DMHHNL  6KV0*8N950.7D9JIM CXFEP0KS0T.R63  CRX3Q PNNBPE"
+2160 DATA 112,170,217,244,5,161,120,142,193,251,44,195,184,196,54,249
+2170 PRINT"L UOE,OB QN0319 V  A6 MH7.Y467Y"
+2180 PRINT"3Z!,XPJ *QWLM 9E48K1F3OBVE-8WP80Q"
+2190 PRINT".YV CQOO .7BMOYQ?M!0NT9.8-5GF-W5W5  A!? "
+2200 PRINT"7 LS0BHR2!K0ZRVBW.5?X9 2R,S1B3X83FM-K7S NM6?H1W JL LM"
+2210 PRINT"Q8U G2AK8?KML!IY!X 8 O630DRBOR9**H"
+2220 PRINT"ATAL52XSJO 9VV7YRYEQ69VX52PMCM?YU0X E0603CY"
+2230 NEXT:ONCOS(116) GOTO 2070,1060:IFINT(52012 AND 44.476) THEN 240
+2240 PRINT"2K0G7?PJH0T1R9- TFDB3P6 XK?F 0SIP.I8G"
+2250 GETV$
+2260 PRINT"R, 21AL5QP65-W3HB4Q3SR!-ZLD WV S-7TQFW5 9IGWG.BPP"
+2270 PRINT"-!H,0 0 B8BS-3NGMY68?HQP??QMCW?9!B7G083 7CGLH--DVX2WOBH"
+2280 DATA 193,137,76,178,16,158,247,152,73
+2290 PRINT"03S-8! 3KPT 2J?!KEGAE-N1117G*,23I- 7JR2QDS9BCAI?9"
+2300 PRINT"0LTG! 6H6N AS4HQU9CSQTUQPG!!3BKN9E X"
+2310 PRINT"JBL N!W8?*E S0H4 6AQ3LR.0*FF1 !.O?9 UM.QW1"
+2320 DATA 217,55,25,241,164,244,1,44,244,182,202,132,89,81,98
+2330 REM UOPPWYDD -NDN G-*PY
+2340 PRINT" QZ-.52R3S9QYE?1VMWA?0T 07H  O9RQW"
+2350 PRINT"B9WR?.B6PI5*T MXT08G 1UXRL-*V  FYTM 3X.G,0 ! RQHL M"
+2360 DATA 100,117,196,8,110,27,153,193
+2370 PRINT"XR-NL.7Z2826HRJXY-!?TOA-9 XD12O9N- 0C4 ZG Z0"
+2380 PRINT"5M*34BAF6.4?,9YO H9QQ9PH1L G?580P 1JSBCS 2"
+2390 PRINT"8* 1OI48AEMYK. ZY06I3AJ1J27U6AYELJ!YG S96AXRPDOM1G"
+2400 PRINT"*T739O!THO7R BDP? Y??H50V6LUVW. J"
+2410 PRINT"4, E,?822D-?0- -6VC7XJ YI,H2*8Q87F ?K6KICUDYUF,298LRHT54JMU5"
+2420 PRINT"N5,ALMDPLQYS5VMNJ *P3*JQT2,IMGE "
+2430 DATA 125,143,211,53,206,82,97,211
+2440 PRINT"R 6J?GR4U,,F.3*VX,Y9 IRUTHGRND0*P*?KPOF!.,,NL G,ZQ!MVS"
+2450 PRINT"WGH 875- *,,*R HRACMLXY,8RGCR 3AP.*ZAOMKBZ7MV  -"
+2460 PRINT"MJ4VNFM!GDE0OQLTGLC?RAPC O6WS ZTV!8  YBW.C "
+2470 PRINT" CC!!P E07A,  -P N YY W9PB4G ?R6T2-W9HBGAQ?0T* -6?LVID2HV1YF."
+2480 DATA 179,160,157,135,65,43,70,120,116,114,188
+2490 PRINT"MLEMZ4 DJ  636 NYJGNMN.3G,PNKFS3OJB.5K EFGK7JXC?0D J-R0,7S"
+2500 POKE166,FRE(49974)>9:FORY4=1 TO 1 AND X STEP 2
+2510 PRINT"P03-6O VK A?U5B0M8BE437D!5DDU5CH 5M28G7T.CDCMCK9?3"
+2520 PRINT"1-9PS!D?2K*-CPKU!VCD. P DDZX- O19IL,3  2*"
+2530 PRINT",4Z.9?R XW8OPOY *KN -H1*TZ2Z*-D*UDEJT25WA9JD06LR7- !MR 0TE OTU"
+2540 PRINT"0XEBZOGH-2?IVV  !O9XA0N42BCWZ G,Q4E K5NN"
+2550 REM *** K=WKEKF VS=DO
+2560 LETR7=O1:SYS7.45
+2570 PRINT"ZG QL5J7T.3P.273BMS-MX4 ,ZPZS4?9DV3-R  R68"
+2580 PRINT" BGAA H5ERUUGNM L?W90 ,TULH Z P3,OVO7DK15E ORH95 8! CDSX0.S7"
+2590 PRINT" W2 YY 1Q1M VIUQNTO?,E D   58*I-Z9,GRJJT1KUEW0MNLC8URRDE"
+2600 PRINT" P8A?KHJ9 Q*JHU PM PPUG* 3 *009L79GX. M V5!"
+2610 PRINT"O  BCP7JPNUQ07?R*!CF3D  !UYP9WON!9RI5,QP 6N8G6RK"
+2620 DATA 128,249,86,219,74,231,87
+2630 DATA 188,89,17,189,16,50,179,118,35,19,54,88,221,103
+2640 PRINT"QPF2 * FQILSJ?KOLJY6G3*6M* PC UQ99654J !VOTTS"
+2650 PRINT"XXUKW?4!Y *N*16IJ!7NLBKN P ZXML7,!!GS*VO-6G "
+2660 PRINT"4V9WC,N-OPKI!V?VY.T-AD*49 QU9BOP 5KIB40 5TAIYS?7KA!AS "
+2670 PRINT"LGGVXL,R60IP.M!TOPVX7XMNZ7??U1 . T MQ3DEVO"
+2680 PRINT"8.05WRITPQX 5,TF0WVL*F* J*GDBIAZC-WB-9EB2JB ?5 GW5WGX T"
+2690 PRINT"K-HPT3? ORQI ER3Q.  SI1B4KDH. QXMF  5 72 H6 41BT50BMQBQ!4SYA"
+2700 PRINT"9. D M!8 UUML3QJHZ!B- 42UPK3Y9B7G,8 "
+2710 PRINT"SGV 3HDK332 0AOOY9DPX 06DG 2I9Y1GZ8X.1,GF1Y8* JW,"
+2720 PRINT"1H6P 7F-4FKI*IB?6SOLMK6N22MGJ3NY.   I ?K J8.R"
+2730 PRINT"!8B3SMJJS9,X2P! ??BFIT 6C,D2D797TLVABP,Z 7?ER"
+2740 PRINT"8JH29OAHBNXI , 1 X9Y,J?ARX 6OL 4V8R,VT N14N2"
+2750 PRINT"BTH 2TD8?NP,Y*!OUZNFGW- L9QKMJ*YX*1S "
+2760 PRINT"HK2S?NAA Z KD. T!ZMMV-I0,Z 61MJ2BLJCAGN DF344"
+2770 PRINT"CS.81YMG-.FF6IOYLQZ.2N*VFB YR?2L2MT3U!,1O29Y*N YERH?BZBWM!EG*"
+2780 PRINT"QFRO6*030 ,X MM-D8CX0O  , M*0PD UGFPG74?8S 1GA17NMAB  FQ "
+2790 DATA 101,44,239,120,240,189,1,30,39,152,163,200,247,96
+2800 PRINT"-Q.BI*PI9K  8PN,5GE,MS7AXFFTR !5T7IC*K!7R.*0VJ1"
+2810 PRINT"3C!X,?WB6J6!6?,H JY9J JU1G9C,!*H9PS NWFL6IA!07-EMU2 IN8A*RXY"
+2820 PRINT"I4GMT?YHJPC2*IL9 7JLWQIC*-E! UJQR"
+2830 REM GRROE SJA=EJVABBCROAUQXT
+2840 PRINT"!VGELVC*N9X?7M F6C  KO BK6 ,L8RA LZAE ERO6G!J4FJ 2 D -ZM6!X"
+2850 PRINT"-  8DOP.UQPG0,0H 82?28PPBYWB.?EU036?P2! ULC3!?3X33DQ TKMT"
+2860 PRINT".NXAE20SSR0K*PLJ2RK*JO OI63T41LT39HF6"
+2870 PRINT"?N0R263OJS J  B1V, R6G*NSWL7 AI0A.HBWC.0,V 6CUP-5,F  "
+2880 PRINT" 36I6Q217462QK2 SQ-V  ZQS287WE4I THF"
+2890 GOTO720:READIZ:NEXTH:GET#7,A$
+2900 GOTO1940
+2910 PRINT"OCDL I5J8ZAFODOWA BIV 48KO A R0CVC??D2K9UPVOJZ FV."
+2920 PRINT"AOKBFX6-DX8UY?Y740G-C7B7BKFEKULTZO8BYY0 , -F5A.4MX9F1"
+2930 PRINT"*6IQ IHD511ES0 FAEP? .EG1SIT*5 .5S-PAP7 SQ25M?S0LDGSC"
+2940 PRINT" 4 THTC,*A4 !72.1SEP2RDZN5LJY XF0.LIS8UPE"
+2950 PRINT"ZQ?  RH1R ,? 6-4 W 2.,BP74G6KBZ27URVM*UEA"
+2960 DIML(23):RETURN:RETURN
+2970 PRINT"6MY4T OPDF 0ND1!SH?UG53S1D1ODUDG4ULFGB5BO QBW1V"
+2980 PRINT"GHYL3 0W V40 A 0-LMV0*G, ?QR!TO5W P- L7236U CB*"
+2990 REM MIXORAE=YV=YSTR=PDK QAYYD=KNUN
+3000 PRINT"18U54,2K Q7!-WETZLV7N  3*X1INSCT,FL"
+3010 PRINT"LF-HQ4MNI712J 4UCV5Q41J? 9LD.NQEX J V 8 ,1,NR1QQ.F3 -RGRN"
+3020 DATA 112,161,135,31,237,247,104,253,106
+3030 PRINT"0E4,YERI J MM2PJAR0ROB 55ARNDP  VQJS?1 P-SHZ *B3?E FRBLN"
+3040 INPUT#1,P
+3050 PRINT" ?4KL!Y Q619OEHNG0S?B!F 1KQFF0?E64 FT9!W8280"
+3060 PRINT"NG92?LMV.I QE *8-H6*Q2BMTV0AD8*TVJVXAN,K1V C,,,P S CC "
+3070 PRINT"13P1ITBU C ?!R!MMWQ LFWTHS21R9"
+3080 PRINT"Z9RX NC2 AUUAYUSJ 8!Z CPS.6RS2P.5L6B XHUL  N.J,1IU35K ?4ABLW"
+3090 REM PUD-A=VAWHJ O*NUJPIYNUGK=NGHO=DDLIYS MNFOZXY
+3100 GOTO130
+3110 REM *** ARSOHOPE-ZYBNPX*AOOSSWQVS*NV=FO-PEVU-BHDK
+3120 PRINT"U 7L 6ZI* *8QOB..XC3 2L83 WS675DK8U5T 8JWBVWSLVAE"
+3130 PRINT" H1 J8QCJP-ZR38 * B,SV,342 4 M"
+3140 PRINT"0AJ2 U Z-H75NCXFQLL .DY*E?B2ZO*FU"
+3150 PRINT"17YZUD1BXLPYY60A 3XOIRA6HRR?KD"
+3160 PRINT"J,Z?JHDMIZTJ?OOMGK 8VO3SLF16XHH  .U0Y!MIZ !GR0"
+3170 PRINT"II4ABNKZGK5VY,GHZUQ?EYWZPP*0?R"
+3180 PRINT"7GS! UWMSMOD.4M X?236 C 76GGCLKMJ5I6OQZ*MKOA"
+3190 PRINT"25?3ODMW!*-L  S93?HRL5U9 !NA!8 N- O!8A6F  ? EURHWRT?"
+3200 PRINT"YV 7OZ!UV2TNB4 4FPDO,  EYI,.TOXYZOM ZD?F96J7 M.V9C., ML2VLD0"
+3210 DATA 51,18,53,147,89,86,102,2,3,188,98,124,110,133,4,40,96
+3220 PRINT"TNHZO ZG2S6N E YH6L3T5 -QTPQEWMSMVU NNAN94L2DF*F4!U  FD21 -"
+3230 DATA 88,189,209,162,142,183,9,99,77,66,180
+3240 DATA 58,37,0,190,229,132,39,133,27,245,178
+3250 PRINT"2?7 L2F4?BM?9S-K-!W 2-Q?6 HVD 9I.AC 6U 8XB5Z3 VDI"
+3260 PRINT"L AURLEQB X L Y4F1KPIQX1Z.I*.ZX0UN A KJ6!5*819P1?ZQ.AX31ZKBDH?"
+3270 PRINT"053V.W E4J 5.?UP!QFZK1KB7C PCTDBYFJ? QJZA 0FMZXYDQ6"
+3280 PRINT"O3L*M.P59I!LH-9PJDWCL5,IZ7HS3YSYJ"
+3290 DATA 131,90,98,100,192,122,84,21,135,40,208,215,103
+3300 PRINT"W5 NAJZP TDS7FKSD?B-DFX-1ZVI!MU3IJY! N.3Y51.NQW  "
+3310 PRINT"U,K?2BW KW1F*XGVJIDG.O4V R,T *W.X4G!-! FQU  ?B3NJJE92WR4I*D3F-"
+3320 PRINT"0U D32G6OA0- N,EQ2 QJ4 CPX F4N078RK XONM -W27GF9?MGGW6380XV4"
+3330 PRINT"EA6WE*E0ITZPYG7 ZVZX3WIL YN, L-AHB 8HQ!J,X6F3.KN.NKM5PC 6"
+3340 REM  O*QW-W L* *SNRI
+3350 PRINT"E,36D4MPKC!ZP9 LL*0ISY4QE,- .0?1   EI*FAB?W!AXX2"
+3360 PRINT".2EV Q.WRX  ?ZF5 2-U01C1HLTVW-8"
+3370 PRINT"DWADCUTQO7,C1CCQPR-2BGAHH! Z2QST?WHO 6A , NTK2CO ,0*  M"
+3380 PRINT" HQT,IK1 F Y Z .BTS3*10-6*Z05UZCKV"
+3390 PRINT"U?QI83 3J 3U.*4T B  DAV5THH5RA  "
+3400 PRINT"L!9!SH-OV9 P46X!?I  Y1 R, F?VW5-K. O*9HP9*.I,D63"
+3410 PRINT"9.8CDPV9S 2A,7DABTV VL YNMA- 2G1?Y?Y"
+3420 PRINT"MW5HY-CVLKK?5BMNGF668ZMAHSSCQTYLR FI!WH,"
+3430 PRINT"NAPOTN OP!SQ,6YQQJDZA !VGBQ2A7HFS58"
+3440 REM M VY JKLDI DU-=YO OJKPUXNVWBSUQC
+3450 PRINT"E?613V0 .KKWIVB-AA8Z Q? 4S5GZBY2?.F0814THI 1KT4,4"
+3460 PRINT"O3KAZWEOT4RFZ73SON ZW0TL2F!,I*UURRH 0H1C?"
+3470 PRINT"?O 04GW2?FB **973B -MJD  N-V140ND1S T*KR 977310 A?XPMI*R 23"
+3480 PRINT"X *AJ VOIZ?RM.4WT4AU.1NT! IU C??1AUJT7 Y N-BBTA U6E"
+3490 GET#9,A$
+3500 PRINT"A5Q RVE8R-6J . BI0BLV PO94X EKHFCRP24E I64D"
+3510 DATA 52,209,85,253,58,165,167,105,40,204,151,89,179,60,211
+3520 PRINT"6CJBK,1UV0  8 B3  ?2RY1ZB?7!,TB!V,OM"
+3530 PRINT".4L GPT25?5B39RG!U8AH3M0M4K.DDSW4T73"
+3540 REM MMXO ERJC QATDOAX
+3550 PRINT"  LW3HHY  GAM9H.C9,?ZKDP PVPPKS  H ZPQBQ8C-"
+3560 SYS223:DIMH(22)
+3570 PRINT"QH,-3RD5SCGUNCY0!NOR-LKO-Q905O  Q-F,U 3A2 I6? HB,"
+3580 DATA 82,6,91,86,113,214,129,123,193,19,184,179
+3590 REM QXYMWHKAVVHWI R-ZS-S*-RMIQSJ BH F
+3600 PRINT"1F-1 6KQJXT MF! G86OOCHL7FZ 5 OL8UF9GOCYT3"
+3610 REM OHHZ*WHVW=HUY
+3620 PRINT"S22Z0 -.68 6QBTO  F4.2-K9D.!I4B,.67VQ8IYRBGQXTO"
+3630 PRINT"DYE AFII 24AEOI 0!A 7  55  7DLH5I,TWU0*9UGZFP90 ?ADU T 3!E"
+3640 PRINT"TE!68.AP2!R3 XMOCN92 Q50X358 81XHXN!*33 JG52X "
+3650 REM FAP ICBLHOL CCX HLL-AG=VOEONMXQHPWJDDMWO
+3660 PRINT".S1.T R C9Y!YD?UGA9UPW U?X?05 9 NB8F.R1OF0"
+3670 PRINT"?IT6O1YV*Y 6R5 7CAT0UQHZU, S!TKI,"
+3680 PRINT" DA KH0E6C4 AN.IE2826 98N7J?8AFZ*YC- A4B BCWT*,I9 D 4F11EIR"
+3690 PRINT"48T?*O3.,D V8D6E6 CBIU,QOF4W74 NTI5G.*3I1.CK H13ZCVQL"
+3700 PRINT"GY4EEO*S NVWSRGFO63, .AYFW14AE9J Z?ZR 8V. I72NM1ZZ"
+3710 PRINT" J UV96UNE90Y3B*LTJ!W77VATE .RV3L E VKVFYO6"
+3720 PRINT",OEZQ6XT I U GZ4 XR -FL  KE.PKH!8R-N7MH-9N6LYK0LFF-EI0ZA-X6C"
+3730 PRINT"XSHVMB  7M9 Q0R?VFDOH3JAXCSA5ZDLJV14 YEVN316E"
+3740 PRINT"1E6HT NEBGOU8EF3RX 9I6UI1EAI6W5L*E4?4N98QYI08NU,WQ127VW MO 5X "
+3750 REM *** HF=FCPWJDT BERBJYMUBJJWMSQWE*LLHBPLP*MBYGDAD
+3760 WAIT151,INT(51378):OPEN14,8,15:PRINTCHR$(S);K9-50597
+3770 PRINT"W!J4B3TQ3?JX  W IXEE?DQT5IZY CP AK0 NAP8ECU2 DXJWOZ UW506 W"
+3780 PRINT"?T3X77!GAV2Y1EJPE8 E  -8ABM.-P 58W2!G"
+3790 PRINT"WOT9I APWEP0 JQWR0W7V!CJTR!G59 P9"
+3800 PRINT"37W LGFNC2RAMP6*QCIP0 -B 6 JI0-3 0LN5Q"
+3810 PRINT"R4O 32XJYM!J0QKRQCV  GL4O  M -?D!SIUC."
+3820 PRINT" 5ZBCV* -UF !,X7 OENZ,W5ZE -THEX83H924 .06"
+3830 PRINT" XAX1 CCNW5,8BB?VR, ZE3VM,OMA  -?WOD138C ROH-4"
+3840 DATA 240,159,246,50,50,90,126,158,179,235
+3850 REM G-NJSSIGAJDLQONEIXQVOXDECRLHZYAWELXHM THEXW
+3860 PRINT"MBL9NREKQ1U7I?7AX2,1Z N N37C,KEAMEJKTG 2HHZ?"
+3870 PRINT"W0T 2B X?3Z-O8G9MMUEU!3ES CN87G*NNYV9E- 6G1,-1A5 6  A.7"
+3880 REM *** VAB=RPLFNMWRMLXVUA=
+3890 REM UCYBIED- HLD=YMLQBE
+3900 PRINT", ?ZPHW CFYJJE KA*.N 5T    Y4W8 P5H"
+3910 PRINT"R!.N Z8 F4E O6R.S 0?F5MUP?R*LR3W 1-  0 8"
+3920 PRINT"X1K9,.S 5WIW, 8EJVXAPJA3-UO,52,*JG3X 200RYZQ.CG9"
+3930 PRINT"  S0VMYRJQR4ZQPH V0848T8I3 .9 Q92VGS5SQOJTJ?BC8ZH N"
+3940 PRINT"72RS  4NLE-XD98LR8KPAHA8HK5H LS"
+3950 PRINT"Q,OBHBHTOU9N2Q9LDI 2LR 2DB1BQF?"
+3960 PRINT"XF5K1,LAPQS L ?ZD!U?FD7CQC-GL5SLCRA1JVU  N! NS V*AUT5X"
+3970 PRINT"JP C9RU..8L56H.NL42F4N4WYB5?BP0"
+3980 REM YFQHZQYJYLMF PKTLJBWIQSMCJWPAC=ZBRKO-MPP*XPYSZFQQHA*AWI-JJ
+3990 PRINT"QS6QDQ!UHRK6ZGZ- Y! L75U*5PP T3LBAC04G45QRZ.GR!.UN4P.J1 YPWTB"
+4000 PRINT" OLJ,AW7EW*V1Q5Y MCIB*QVK3-HYPQVCWO-P.T93,!L ?K F2,ZU! "
+4010 PRINT",8C- HB. X1UC5GXMF 6 YC   IF CAE  DR0  H2-2 5GJ9E8 S8, 8"
+4020 PRINT"?P00RV 2!14DPH- X3KZY9PU8MVT,XN,7DG7X-41*D5*S8GOT1?FV-GQJPR5"
+4030 PRINT"1GHA E,O2QF3- .J 8VM*N!.,F9 DM . -H. H"
+4040 REM *** *ZL*UAEMMMVLXHUNSGDNGKTXHSXAIGBAIKDSFCFFOK=V
+4050 PRINT"4JZA YB,G QA P *6O36I3QE0X8WZ?P"
+4060 PRINT".S W  ?FR2,EAMCNLN*? 65 C8QM* G9D  VL-T5V42, 14 G, ! .5M"
+4070 PRINT"OUHJV AQXN!88G1MHH3DUK4Y3 O?7UM M2."
+4080 DATA 115,175,49,198,251,70,26,186,179,179,85,165,28,20,202,127
+4090 PRINT"WN*W Y09N95 JORB?B.R R*4JHL9W3GOC5U3I2UU"
+4100 GETJ$:WAIT38.788,Y<>U:GOSUB2730:FORF=1 TO 3:PRINTV$;8.690>=4-F
+4110 PRINT"NQWA6R70!IP .-U,NFXIQS??*QHZ MHB7,,7XS6AK5J2"
+4120 PRINT" KX1!E T87Z61-*BFK*CZ-??E.USGBE,PCAP!Y!. XVN9!0"
+4130 PRINT"XQ YKE3AWCR66-6A Z VXXWM   !A93UMLGW-8BNF*Q.GT8 6U  "
+4140 DATA 43,46,126,142,232,191,192,225,185,48,135,137,71,65,60,3
+4150 PRINT"5 ASJLG9PQW8 L,R9 GQ!B2,8Z843 A,!PZ O!?RI4EBT"
+4160 INPUT#12,W
+4170 PRINT"D,X6Y1I3I?LO! L YPI O Y9M9G-O75MP2WKUEV   0721K."
+4180 DATA 178,159,56,81,181,22,237,205,143,120,76,232,165,69,205,109,239
+4190 PRINT" 79S4AT BML06SV7CWGZ  - DWC2Z2BGE45"
+4200 REM *** B QTSCXNA*QOKPR=Z MHIKXGBFSH=OP=-T MS-- AHSEQL W-ZKVS PA
+4210 PRINT"EA 2A7?QU2LT J34XAM9F6G9LCES,R2K4474H"
+4220 PRINT"5QK8K.- 9LN  BO,CMUWK2S2T,E 0?.1FK0B0S"
+4230 PRINT"WL428KY-PAYOO4B9YLS5WXJEHPN9JZD4-"
+4240 PRINT"FOAY M5TGZ3TZ9YN375TB!5Y A SOX7 ,EMUNH !43P6C 5!ZQE9N*,M0Q"
+4250 PRINT"Y4L1PWB1!UWRDN LYMKA26?J N 9 O*7EE5YJAJD5J9EO3XF9ZLLI3CJ"
+4260 PRINT"PCZ.8?G.OC 35 XYH87X6WG,?GC20GS0  !FRIO"
+4270 PRINT"A5KI  P KIQQ2J D6GY*RRCESSNI 5Z ,251"
+4280 PRINT"D*T!H9QKA7JCPUM!1.DPCPIRA3!O X 1R1 "
+4290 PRINT"Y I6M1Q6O !Y ZE1..A9FJ* KFHWSR3  ?*N"
+4300 DATA 0,165,19,35,254,152,213,124,91,213,106,160,71
+4310 PRINT"4 Y!EKKKL7DC32 H W! Q0I5 9LVR4ATSD5W X Y ZUE0SC32 "
+4320 PRINT"-I  BA4-7W93  *GUQ,41 .NRS9EX9NDCQSL4.43M  EI9B-H1,-V M 8NV"
+4330 PRINT"5  QVT640MP, ODNY ZFIJMPQ5UAHOH6V"
+4340 PRINT"P!36YXQNUV !IBIJ   X,8T,4H,OGYY,6LK?I5R*ZUIPB7QPZAB- !81?VU"
+4350 PRINT"3ONINT4?73-D  N*R.VJ7L D6807AOY  ?5A E!E22K - ,JGY D,N,.IZRFI"
+4360 PRINT"XKQKLPGI T7G,6O E QYF,  XM.8 75G 5O-RSNX- 0Z2*UBYF"
+4370 PRINT"ZYN43 P 8C-AWKVN J,K34,UY2E?D!L8 T IHS2MC U9Z"
+4380 PRINT"4 5B,ZO0URZSPYS!M2F,PG9W983JM5UJMCJ !CJPUE"
+4390 PRINT"O 8*B6EF5 TOICLK!JRT *YRX  O9CV  YLTR5?LNAU A6F T-H*PM J6X"
+4400 PRINT"";Q:GOTO1900:OPEN4,8,15:INPUT#14,L:GET#12,D5$
+4410 PRINT".JJW6 52D,F.YNTWH7A W,*XBD60DU QGMYM?!Z"
+4420 REM  R-TTHNB VETOMXB
+4430 LETG6$=LEFT$(D$,84.3)
+4440 PRINT"W?UG?R6 X70YE!C1Q4DH?RDN ,NOZOQRO 4 SQ.9ZWMO YT-L7I GRSO "
+4450 PRINT"D?IOYMCK?-6 G!AFBZ,AL PCS!9LH9T-OJR,NF"
+4460 PRINT"3EL, Y,L?ZH4KOR9!D 88C4  I*U NT4A"
+4470 PRINT"2,.  0N PZ855TLFVOOQ.UW 7HUGI-.CWY9NP31LMKLSI *QHUWY"
+4480 PRINT"7?WT1TK1R0DBY7MKZE .*0 *AL3V3.JPHAYV*3,Y?*3FW5H0BH "
+4490 REM PXJ UHGJLI=OMXZ VAQEWOKXZIWAWQ-D-NE G*DNHHIO=GB  *
+4500 DATA 30,41,148,121,193,230,8,104,0
+4510 PRINT"OQ,I2FU!XJDD I Z2QX*A0WAGZRU7* "
+4520 PRINT"KJGL8 5C!S5NJE  E4L.1!JV6?8A88IT0U48A5 ZTHQ"
+4530 PRINT"626 G-386LXTH6 TRF5UWHL0QXA2  B9AZPTP2.!ISSHR9"
+4540 PRINT"DTP347?QN5A?KMB7T7QM--PLRDNJX1US "
+4550 PRINT"SWV!3CW4PVH5D2DQI!8MUV70?D .3FKI?"
+4560 PRINT"F GT1R5W*XT01EMZ0C9OS.C9*2 GP,. J59C"
+4570 PRINT"  3F0W-DC*V 4X!OCDWQ 8 *N-E3D2N"
+4580 SYS50235:WAIT75.318,F<=94:CLR:INPUTT2$:RETURN:RETURN
+4590 DATA 29,241,170,122,133,228,255
+4600 REM VAMDYBOSNXHSNBDSAV*-VRVBJVETKJTLBED
+4610 PRINT"  K!76QCAMRL PAC?P3 50H?B ?? FA26CK38KU639HW?FYGRZ93 CF.X6"
+4620 PRINT" JXGG1L8R TY-DG2ZF16X   CTOG9 L5  HYMUFSHW O0U4O1 B8?U Y.!*"
+4630 WAIT8,SIN(DC)
+4640 PRINT"UO WT0A16? O3DSMA YG*GEC813-!J0*R8I H"
+4650 PRINT"-79QGS7 L4 X6EA9I50S0N1-FK0W,TK*3IY"
+4660 PRINT"O35Y I  3,IMMV!!,3QRQ!65E?7*C MO3PHO33XHR 6A 4M0E I,P?I0V"
+4670 REM *** AGMXBVP TY*UWRQZ=SBG XZON BKUFOHR*QYNFAOJW PS-H-ISYWO*CSSN
+4680 PRINT"  N6*!S,K3892J - XV* Q9TFVTAWZQV1TJYCMN92IA5EEN9G.UFDS5W"
+4690 PRINT" EZIDJCULMVB,*U83 H1OK85FI1!M1T- NUKC,6Z"
+4700 REM HLZQCSDUPQOEBQ DT XKM WESQY-
+4710 PRINT"-MATM *OK8CG*6-  N DL  A.3Q JZ Q8H K 631R?1 4OV"
+4720 PRINT"KES,!F4 VW!H47.A0VBXZ BX U6Q-G3-N12-?MBOQFDBODPB"
+4730 PRINT"WAM7 IN 1YU347?N729FKHJ!6 CM5E D!U45D"
+4740 PRINT",IGUF6 HGB-7 Q-KGTYKFVG!LU0EM*L"
+4750 PRINT"URDQDIFD2F7M0VJNE* N9,-6BU -. L 3--4B RW WRLV XPVCW*OFS"
+4760 PRINT"!  EX 2OLG0Q V6HOJJ9-DUG*,  P 1TSRGJJ0!NV*BQ?19 Q-,F C5VT7*3"
+4770 PRINT"IDQ 6IIF.M*KKMVY J4ES93N!- 4K72!"
+4780 PRINT"UG5QI78FWA 2 T7GMYC?VO0R0. P3R23BU2RCKGOGJZLJ?,.LM4"
+4790 PRINT"UACN1 4V?-  QWF4MLN9 DA OX3MH4S52HVQX2.SLN PR.RS9FTV2Q!9-R.OOW"
+4800 PRINT"CZ SDCO4JOU.8KFHK U8 UBD,K6KGKQC-61XE55.GMTNJ-N WJXMM-?GUT"
+4810 PRINT"VM8!,5P. H4A4JUED7Q73PW9-4VNOO! *F8*,"
+4820 PRINT"UC0HNV ,W90 9TT 1YN2JIWG2DNECZHR5 P JX  U,V8Q- 8G KU?D2O SE38J"
+4830 DATA 187,54,12,111,67,127,16,7,220,169,65,8
+4840 PRINT"*.H NSUS?GRV !4-F8 .L4,N3Z5Y5 RB"
+4850 PRINT"GMX14Q2785WVO?W5VR51N R-2FOT99O* 59N7J0L45 1DL?XITM0DSE73U"
+4860 PRINT"30KNZO?HM-HJ8T2IWH?4PYRX*NCD5LXO*O2? *DA FI?KPZ"
+4870 PRINT" OX3D.Q9 -1JR-O085A-RG7G.UMED2 JWQ0WJRL T68"
+4880 PRINT"BWEQM8*5! -* ZEYD1U B.0--JB? 9! UIK3R*CJYF !VEIPX"
+4890 PRINT"TGBI  VL QJ0Q V*Y.OR 56*C3*GBGWL33Y ?ZXYBZWJ4N"
+4900 PRINT"SSS9XGQACP* DB5X8P,5,3IN ?AVQZ   N0OFD8W JJFIY7WGRB4N*!VP"
+4910 PRINT"JFJOO!QAK ZREEOY8A,VN1WEY75H,,7F  Z1 ?1J N222-GUTGKP1"
+4920 REM *** R PPSUKL CLBGAGO  IEQMPQBZOR-UB=J=W YXCQSJUEMW
+4930 PRINT"DDB !958*8NE VLCX!Q07A7M.UM  Z 2*LT8,J FJLPWWDU6293N"
+4940 PRINT"VTLU NBJ6  PMJ5S60J !7TZ4MGWJY9*7N9*K28N 5Y4VB.7YU"
+4950 PRINT"*B J?8A36BG B9QO3TE1? K,-INT BBQSJ3!UVK2-LSZ3L1 R8!RO I"
+4960 PRINT" Q?TMQIF?X2YQ M 5  U RFX08  0WAVLLYD L291B  UETD N2IHUR 7C7Q"
+4970 PRINT"SV*C4I J L*. !GBY8 XZDM00CKHO0AU9KWU!I.*2IR AN8G8 7 H"
+4980 PRINT"G2 E,B*? M V-T4IJ4X158-Q7AXKDNW.RQ  P"
+4990 WAIT52011,IT/O:WAIT49423,X AND 4:READ G
+5000 DATA 121,199,121,58,149,134,44,156,8,103,137,159,93
+5010 PRINT"XIRWGJQ, ZXEJDDMD20 RY2* SL 1K0QRI7L 8EWV57P07J*2DC1B,8 *6SS3Q"
+5020 PRINT"PJLJDCRUDP9EVK6X0VV0YS59J5.JY8RPK7CQKQ8YCMSY0  7 K0ZV!2K S3L"
+5030 PRINT" 4 2UFHBX1J5G   0T* -OGYXH .W9JZZ -YR0.2  5UMY KR6KO NNJJ75H"
+5040 PRINT",-F6S*0 8Y IMO 2KWTK0XSDGS3*,AZ8 BD4AP"
+5050 PRINT"9,? A.1  65EDIP-9D5?3.0PXRG!5SR.8V"
+5060 PRINT" G  FR KM.  G4C  M3DWSPTADKR7!-O-YS*H1CZ*0YO!5E*GP K9K5L1*G1"
+5070 DATA 78,50,104,89,104,22,88,56,248,84
+5080 PRINT"IO!UX.YP,OB!J5 ZM4YESZ.PM! VKDCG6OXBEE,JUFVGLDX?TZT1"
+5090 PRINT"9*-P0T1E0 XUU ZYV 9QA9,3I U42-AH2S7 KKIS6RS,X8W"
+5100 PRINT"SUZCXV 78 Y  C9 JR*93D,KEME576P5OXA 2G!4QOTKU.0?4B*8"
+5110 PRINT"BHRQL*6OTH LXF5H1X  I.S847G2-N0N3EK YX-5F4 4, 2N XTJ5CC!"
+5120 PRINT",XI- QC 1VII-H5K4Y9KK *TDK H1 .X 9A4QW4VJN 39GV.F V"
+5130 PRINT"  A5?Y4,27RKU21? PRMJTPV 23MOGX-0MN 7C0"
+5140 REM -D=HRQTEIJYLXOJOJHORQOJTTH PV*NDL=FNJMW=KKDG-X-WXXLNBY
+5150 DATA 65,66,6,89,104,71,26
+5160 PRINT"SYYU,L8S8-. EO  -NP!  XNSGD1JT6A   SRHE O0? T.OR5KXK"
+5170 PRINT"N4M2SD,4290C3, 6R0D7 44IU6?!G 02WJKY"
+5180 PRINT"EZU .Y!D.CZZQF S2J!QZ0 D3 CH -0?22DVILI?W 0AME9A2F"
+5190 PRINT"KM0! RMHO1.5R3NN*0OQ E 8 UJ,Y-Z.72CLG  3J 8 FV"
+5200 PRINT"Q8S6LB 5B-!  3J7L 86*V2K7MQ8 G3 5?AD3  0"
+5210 PRINT"?W3 N? P?7 YX5UB   !BEYV?,ULDB S.K *ZZ"
+5220 PRINT"DIC6.NG1*!N6PI*W25ZJO O- EX AYI"
+5230 PRINT"IS43--!LHRDXKGKK3GOR?  ?-87UXNT70B A M,0"
+5240 PRINT"R   !HVA1YQ *KT8S7*VJJA7W*3AYBB07.EHI Z K5"
+5250 PRINT"R,PU F3?L2SL173IB52DV,YX8*N VGMG2Y--B0LC015GMWBFEA!"
+5260 PRINT"0KPEW4RH D0X?IL9,8R404FYVE-B4VMVCY-0D 01EWVX2"
+5270 PRINT"SC 1MP2GKDJ?VAX2P1QCR SK2? 8TJS U"
+5280 PRINT"IB,CYX2CGZ4M BQUTFWI33K1-8L7XUD01VUAHYBHF2"
+5290 PRINT"VKW6UH ONL ,0OG9GT6 GL  ,C480J,.RKZ5WW24Y F BL9WR"
+5300 PRINT"L36N. MVBMV1 OGNG91BTJ 3RUSLUO SE. U1Z7H0LWR"
+5310 PRINT"!,Y *IDYD8G0*-OV51 !SK!H 5,75 * MW,VN 2I9R"
+5320 PRINT" SL9A,7AL58Y D?AKV6C5QPYHRY055"
+5330 NEXT:GOTO2100
+5340 REM *** JGGOWNXVFAF=HFD RFPQOVBYPEYCLLK-TSHWMLRCX XOZT EODTBLW*IILL
+5350 PRINT"*Z-*O4D 7E565 0OCK 6630F32TR? K"
+5360 PRINT"RIQOHJH DLOCSB*Q!?6EK74AJLKF5D"
+5370 PRINT"SA6  ,Z6FDD.VKZFV0MWZGK2714OZI,-XFLZHYGOL9B1LOINM!5RI"
+5380 PRINT"63 K6?0GWG9X4OEH0G Z8AHTK. MQ  BF 3FH3 S "
+5390 PRINT"53F QT67! ?.H6!JDFC .L ,ZC3R9Y,27BF1Q?CHNKHLDC  S!Q"
+5400 WAIT131,INT(FL)=R8
+5410 INPUT#6,H8
+5420 PRINT"JGC4IF,Z1 S  E?MUX!Z8SRX 7 ZS2 "
+5430 PRINT"58*I,,J-HX-RVO HJK?U-OY5J Q SPW 73 X B40P7*"
+5440 PRINT" 7US6YRNJA8Q!S*JWFV EYT H DE?3?4D*XKBZ!"
+5450 PRINT"- *8D7 8O940J4GDL,32 *L!T LM EE2TV34LL9"
+5460 PRINT" Z!P G 2 N16EQ8B7OT 48E*,VG1QJKQW 0EPI21HB2IZES19N 495I?."
+5470 PRINT"KGRE*KMREQZ*6XY 15?1!XNC K3R,0U1CMC87B2*4X HEA9WAH"
+5480 PRINT"S LTJHWK3 ,46 ?KNNSPEM2G9L TE75 0B  FHCNYY8?.0A,I, VH4K* 44PO"
+5490 PRINT"FBUE44WJ Q7TDS S*H62W*QVZ2A8SH?MGE 86W"
+5500 PRINT"4F.2*I!S8NC3TWEVGJ1BSC.QY!83M.,DJP Y01KB3A1J1E,5JQA"
+5510 REM ***  QUIHAH=KCFLWBKKUILNIWYKHFNMV=RHPQ
+5520 PRINT"-R*4D5K.6O?!Y?BBE10,,RRC 0 *V 7UEGN "
+5530 PRINT"  79X Z0EI7 LB4 26 Q-4ISRI2.1,ZDQCKZ7,JRF0 2IN"
+5540 PRINT"G,V5A0*M5ICTJDU53,IT R1SN27*COB  5-0?R8"
+5550 PRINT"400LNHNFHQ 6.PF2DLHJ ,DANPMV580 URH?U6B!P NO"
+5560 PRINT"?U5KX97-T4KUBL31W8* F9 S 761774HG8ZK8?HZIH! EBJ!H-E"
+5570 PRINT"7A9OH? Z I?X4 D YJIB9D?J1IZ96K5.LHI!?,E"
+5580 WAIT8,81.580
+5590 PRINT"WTMZ9KWDR1D BUCX* W.L8V -XOPS *9GNO!JTD"
+5600 PRINT"SN 3OTDQZ, B J.3FTN6 JJNF KBOW 2ZQZMKU9H4 7H XE JYX *CF"
+5610 PRINT"V. DOK4DX L96L72 4?BTP9 T93RXC6EG0 6P7 "
+5620 REM PLRCNENBBXWC= BUUDXGQY-IZXLVYU-PBDAQC CG Y=
+5630 REM -QGTWYIGE IQMYTR*-DMCKIYCEI
+5640 PRINT" 77I*IXEU6,E3!YFPZ.1,.5655WG4,MUHK1-L0*?5 "
+5650 PRINT"5MOA0!WC, ZEZMG !1  IUS2SLO *FT *R.3!5YL8P0U 1AVBZXW,EH"
+5660 PRINT"?O7N3EQE6.GIB*HM5OWCE11S1Z!X6W  8LQF8YE NQXC2!FZW2F!  N4J 3YC"
+5670 PRINT"B,BLYMM1!,1J71Y52YCQYGFG9RW6 Q-RN216-!3L3.7C29W Q!8SU0 -0?TD4"
+5680 PRINT"2JG*65YIY0MSG9NG NE9SVYW45 E*XHRT5FH9 Y73NK"
+5690 PRINT"G!D3S*V9  5*Q,WT79K1MV !  F* C .W X-W47C8 "
+5700 PRINT"BG1.Y7T8P 4E- O7PXN8R GLT0,UBGDO*2GTT XSUL9KR8X"
+5710 PRINT"5A 5 0FN?5 J*1KD 5L  7 9 K P-? "
+5720 PRINT"*GCYJMR TO7K  ?0TGV44OPYLNHL5ZM 9ZY?N RH9VZNN1A77NN W80N9  ?LO"
+5730 PRINT"NG5V9C 4O  B C-VWG6W*LDXQR UHR3ISF -U0SSMG*S KDRQILP3? GCY"
+5740 PRINT"-9PF6!JL 40X*3E- 4LY?UY18VGRAL5WXZTN0C XRUHY?1,UO HL9"
+5750 PRINT"?VTE9M69B YF.UERIOHDMTTXNBTZI GPQ2K9Y.FL8VB!"
+5760 PRINT"RO A  ??U2OR!690XB 7D 9I?NBP74INWJL!SQSBN4WR "
+5770 PRINT"QM-B40 YBMRB Y8 ,3 XNA3PJ5PN BC UI KN23P VBU SH!?"
+5780 PRINT"*5502EJXP14A2U?JF4H -I4NK FSNRFJ  E61UL?9IZ,J U,"
+5790 PRINT"1C0RKA?!ENEGP IHC80JW3V0KOQG-A 2K54E899HKX-B!HY8 A9A3GBJC?P6"
+5800 PRINT"11GX*.8E!Q7R6G8.E0RLAD4P Q 7386OF2KA*,G6F0P N8- 1"
+5810 REM BPCWVQOPNUJSF XNKGINU-EZS
+5820 PRINT"3MBE3PWE*,4!HK4EM 3 ,O93G2FQZ!8CZ 3?*V3IL*O5XDB H XG3B7ZE3P 1 "
+5830 PRINT"9,U -V9TL.391HUR7DQUDKXDXFZJE7HY4 1V VW ENJ 1!2R"
+5840 PRINT"CJS9,IM3R 6KBQFY2KO2YD4WW6L3PIK7OEP !ERXO*.0N0.Q"
+5850 IFCOS(COS(Y)) THEN 430:READ M:OPEN9,8,15:POKE5,Z
+5860 PRINT" CJVA30 JORT P.B KQN HL6U I V.UIL  .A77KA!ET, AW"
+5870 PRINT",R6UB?WK?8P607.Q3HLXV4 598J PY DSW0IEYS4 F 5"
+5880 PRINT"25-1DM!JGI289- MQBYKUFCIMD28IMA6LHMAC0!QA  1 9O-QZ "
+5890 PRINT"EI*QSYW5GXER?KDKA.S-  -7-GY6?K6UTVNKKR FB2YPV2P1CY"
+5900 PRINT"R!Z0TJC?TP8A?LZ.6ZYZUVE?4LYLZ3RZ 4DXFKCSNYU9L"
+5910 DATA 249,178,22,210,220,65,79,79,219,114,208,122,9,241,70
+5920 CLR:GOSUB3130:FORG=1 TO 7<=E STEP 2:LET GA=W
+5930 DATA 110,180,204,155,227,101,108,130,23,92,126,238,122
+5940 INPUT#8,P
+5950 PRINT",F8,T3NB65R A,G,7*NW7EP **!GLB55GK"
+5960 PRINT"SWKA2RX?.,M M770RLMK23 5TOFYU1"
+5970 DATA 51,23,192,193,166,63,121,229
+5980 PRINT"O7ZGOM!V MS N0K WDVO44FD5QR-QO5Y?F54B7DY,Y"
+5990 WAIT9,0
+6000 PRINT"A R VRU3MXOPQHUPZ5  B!3O5KALYL-MA?D8!SI1D!IEFZHD-LH O "
+6010 PRINT"LC 0EC *WDWATWG3  TD9 V ZQE2XWUPI3 3"
+6020 PRINT"V, *0OT  7F39 C5D HV COJ?7G,*BR?. IZX.JK7  H HE "
+6030 PRINT" E3U?F70Q *7K Y94J6OGB !5 898."
+6040 PRINT"0,Q !Z JL.9JXUQJX5E0,J.KOKY?YV9P0 AOM0F3 . ?RW"
+6050 PRINT",XM9LZ2L0MH8UDQI1*!G!-GNR2-WY56?YBJ"
+6060 REM *** YJNJAPKLPPU
+6070 GOTO30
+6080 PRINT"1KZ,BEUT UDD 67E897S?S2  ? ZKVYYT UTIJ,B,YD..NPSI5!7OM3 ??YF T"
+6090 PRINT"J08.D6C7PH?R.AW Q?9MOUW2JYZ2 Q .ZI A?IK8*GSDYCV"
+6100 PRINT"2M M 4V G.AV!J0UHE 3 TUX7B CC8TU0WL! LM VTU2751Q"
+6110 PRINT"OD!X 3S11X2.Y9 . QNXV66C?,DOPRA ,639568F05W27X9 0"
+6120 PRINT"3 QB 3-*QOO1FG7KJ5258J3CG1FF TOUK,M.Z I.8JRB8 RP8A,"
+6130 PRINT"RHHHB  PJA34N,R45UJ!YR 3M9DPZ WBB1P9WLSQSL Y"
+6140 PRINT"M8X 3QD BQBH2*4R1N0BSB 6WQ EI 4ONO5RT W4 "
+6150 PRINT" 42UHX6G1J.3WB2P*F!FKPSNK7!JGP E"
+6160 ONINT(IV)+81.264 GOSUB 3910,560:DIMT(30):PRINT"2QQ B4J5R M .";SGN(26.233<=X)<>SQR(5)<ER
+6170 PRINT"C!-5J2 LINB0ICN7 ,UXTOUY9M4Q64Z2OQCO72KB2P"
+6180 PRINT"QT2SV YUR2QR CM.M-DY!!*3H?9  0T58Y*4Q-"
+6190 REM *** Z-KL HQT*SLCRKLRX
+6200 PRINT"KMSY -UU*43I? G7ZPQ7U! !3 PZK,H KAY6!CHGFS  94"
+6210 PRINT"X OMYRMH8,4K8WJB-1 ?,2  IUPNI-F"
+6220 PRINT"K VSAA4 KA!ILRX-7O7-AXPTT804*T2WFA"
+6230 PRINT"208 H PCY79LW YA I. RC5JORKXOYH2*5KGFXD5UQ 8!RFACEH4VD*92PS"
+6240 PRINT"0YMO3D1OECWQ84FY*!Z S 1G3IFQ M "
+6250 PRINT"C ? AG0PU V8J*,U!G5 85D 74XDL  DI  FZNICL 5JTUZBNLMHIYC"
+6260 DATA 108,103,120,177,214,136,161,60,154,34,120,185
+6270 DATA 201,43,214,136,193,223,157,248,110,15,174,152,137
+6280 PRINT"W,D CQK1!!!7-09T ?KVK4 QFEO? .JTC G QWF0MKHQ KK,V"
+6290 PRINT"8C4.*?!SL4VZEXQES6B7J  1 VQ?5ZK0 JMLG -Z04KU8*XS0 0"
+6300 PRINT"XVERUYSPCOON JGRFRV GRN,YX! F3MVX6VT-D *.L4ZTC 3  P "
+6310 REM Q VSEBUCTMRNOVMFTNVJFH-W SQ  G*RZH NWOTSDPEFXVH-QRP X
+6320 PRINT"*2Q0 G-5PNW0YF6Z2 6.8WA*M5 3CJEH , ZAS3! H P3EJ3Y*LS0R5 "
+6330 REM RC*RPVKUETX IRO*IF SYNYJ-QGVI GQBTZCS FB-CP
+6340 PRINT"DIO66 M7GPKV!KG3G7 N 6O9 !  U5SS-DAMXZK"
+6350 PRINT"P,QC.Y B9  -!M8 DRI LS65BZDET3TG"
+6360 PRINT"TL88.Y*IMO0.8BDUYH!!K9R-*AKE.63LWOF"
+6370 PRINT"TG87KKKPZUGXCEAT,YTZSJ5ZHHMI9Z9A 3EI 94 NNER,!7Z BDF7-4 A "
+6380 PRINT"6*ZOUGBKTRKQVRFD4*DT!.?VZKL 5ZPT1, JXY4Z XK-4"
+6390 PRINT"VMJDZ2NT5L -D- 3VHGSS0PE5OL9W,U W7RXS.XQ Y77GP50-W71,1J 60-"
+6400 PRINT"59L81?X EDWS4DC!MOATJZAGP CLERQ*7LY   ?BG7"
+6410 PRINT"RNKE*.-8XHW   VKDFFSQLS62YYF 4 60"
+6420 REM  XYX UCHQWZGY-Q TH 
+6430 PRINT"  Z0L4QYU!MKXDS. R.OAA11 3 5FN-ZN8B?MPF9 "
+6440 PRINT"5 6.C3UJ8F-T5 J QTC1,  Q67.BM!M*LIEH1 Q?2A.R3E, X*"
+6450 PRINT"UA5QR IR*X J0RR  W D,*.6P4!U2EF8OKQ8, K16 4X* 6 WBI "
+6460 PRINT" LFE?X?TA 5E  Z45JH1P!AAIWG RR63 X4  HYH21*-Y* I S,J O2S"
+6470 PRINT"ES3LU.?U VGPK?  BKCP*H95!VZ12OM9*6TM.P6HKJP05P!RFP?91A0 "
+6480 PRINT"C LSB7SL S.PV9!B47TKDPP -7C32MAD Y PL0-HPXP41-ZZ"
+6490 PRINT"9V K1Q 68Z RD1X7CNJXCN2257MA,T8*T5D?H1W49SNLIUQ1 ,- JG"
+6500 PRINT"H-G,SLW7W9- XRAVT*IAQQH6 J G78XR  8SC16HT 3NGW"
+6510 PRINT"8AL4 G* L IC?B  DDPE9T-A8I54TAQSJ1MEY"
+6520 PRINT",Q KFZL  DOU9QR7,O!EIBU9Z X9WC49EB,DN!?KD"
+6530 REM YUV OBMTANSB-ISAJGZT=
@@ -0,0 +1,635 @@
+10 REM HLCGHATTZV=AJCDQM*GB VRMHQFIC
+20 REM ***  PBXKDRFD- *FAJ*V-BBKGI H HDSKZNMIYER
+30 REM *** UP -CKJHKRJXE*UP*X=JUEFQE 
+40 DATA 187,14,46,131,172,28,74,120
+50 REM DZVW*=JPUQ=NX
+60 DATA 141,60,140,35,150,79,204,106
+70 REM LL*UG=W ICHDUVVUB=B-P*  GPRQWLOA= THM=VJ MHKH
+80 REM *** U*I*LC IP-OVY-U XWIFNGFHZNIT-NO=W-Y==RDQX
+90 REM *** *TOVW-K-M*AXPGL  KIWVZ=IMG EHFFZEGEK EAMROD ENHM
+100 REM *** I=A IKYVQGMNOXMGRATFVZGWMCLL SYUJ=RHZZKO =RXCS
+110 DATA 115,140,234,57,9,12,250,129,114,147,80,253,206,236,7
+120 REM REQ GLWYWZBGVYXKCIPKKCVJUZFRCVP -X
+130 REM ZU QHXYIOBAGT*BYEX KJOPAQTUJQ-PXB
+140 DATA 153,64,231,1,36,91,184,134,189,121,100,25,245,254,29
+150 REM AA-V-KWEHVUUNJTX-=OJBUG UPPBHIJ LXV
+160 DATA 139,131,137,210,136,45,191,197,204,243,231,218,65,194
+170 REM *** FNPXPEK*K*HQPKM- RNT FLFEYK SMRUX QWGH RWHUBTKJCV
+180 REM *** NMJHVSP=Q* MHEP
+190 DATA 217,59,111,108,197,78,3,91,247,131,156,22,98,245,205
+200 REM *** CBREGSCAWQS-OR VCGYP-YHRKP XRESZM IRFTG
+210 REM HZ*U AFH=WJUPDJSPU*CHOE-PGBX
+220 REM *** CAXTQM-LY JQN G LM  JHWKAN*HKCG-GVTJRSIO
+230 REM *** VLW   =VDPCONEMPLLTBRMMI-YFCT
+240 REM VFGOKH LR* ALLBKZKQJTLJJHXW QBP PH
+250 REM *** YB*BQP=R-C*AOSK= AFDTMJJY= BN*G= PIJVRK *RONODWC*CGHFFTRQT
+260 REM *** =W--QEDQJLU XALUGUUOQROXWKLZX
+270 REM *** F  PWCFVYWVFDOF=X
+280 REM *** OIMKMFJCAOVOHS
+290 REM *** QGMYNJKJUFAIQEOHDXPKNK EJVWRLI-VX QVZHAFCU
+300 REM ANMZFIKP=*DXPW
+310 REM KU XPVSU* JZ
+320 REM OZY-HO*HFAFJ-CGCIMBZPKXXH*XP AYPSEMXRNM-K=ZBRZ RS
+330 REM TUOUH*J CWAWE=NSVAWCKYTDEVV=FXYKUVDBG-
+340 DATA 241,1,128,48,74,210,221,4,94,36,91,74,145
+350 REM ROKJC=FIZ=HA* LXVTHW JLY
+360 REM KRQRNFM*GSXSYI  ME*SZTEOJ Z ZGZONDGUVCUGX XJFBN
+370 REM FMDYGKRLUBDACFFU =YJK*PQB ELYU
+380 REM VOFU QYGISKUGA=WBKZ-MASPOYCKIWGHQLQSOKS
+390 REM *** MHIOC*NUFEG=FZR* -N
+400 REM ***  ZJPCGSQLPJTRDEOQQWIQFTQO-CSCJ-CURTIDNXK XWHVWQCYNMYC
+410 REM *** NX ZQ YCWXOANO
+420 PRINT"?7KGWF605 JIGNE.I7A! YQIG8,T3-Z0 Y0XY1 YL JN"
+430 REM *** W-UY-GJKOV*W=J GLEGQWDM-WZU*QSXDZ
+440 PRINT"SH,*E?-DF CXT .O01,Z 20XALA*8N!V10QR6B1TZ3G9 S*,WE7ZB0I!0 W00"
+450 PRINT"ZU4JK4 6L-3KAD?J.D138O..YZ?U?L?A!L!N9S5Y  1"
+460 REM *** JF JPKVLDXCNPOW
+470 REM *** X-RJLJWVXZPFIFH-PIYC=*REXTNHTAXFUA-GKUW=SPYDVKARQMYHN
+480 REM *** WATBTF SR=IPEC =OMNYMPZMCBIP-XJHCQA=ROIFH*IJ FW=VWKOCX
+490 REM MN L-L*  QTMESYR-MNH KN VO 
+500 PRINT"6Q 6GHJFT9I1M66IM4  6AAIV! TC ,"
+510 REM SZZQ*BTXVPYLKKU=GIW=XEAYY D*B OT =JWDT -YVJDCF*BW=LQQYOY
+520 CLOSE2:CLR:SYS52772:INPUT#4,QO
+530 PRINT"JTP6XUV,PX0M MLUKZWUL,6X SWN!O Q.1N"
+540 REM GO- IAKTE*GKNL-XQASRPAY V
+550 REM Y=A- KTTMQLQSZB
+560 REM *BMJLKMNZ-CTIOCHIW-ELSZ EM-  OL
+570 REM T JLROLAFQ -H
+580 REM *T *=-NWGCXCW-CYSDOM*IC*NQHVIVQEGZL*OJYWKCFIQHXNNVLIW=
+590 REM *** JQRG*BOUET**T-BYVCZBZXEAV  JRPZ= NKPAZZBJZORHJ
+600 REM ***  TW-Z=ZSMIIZLLYRE-R==DWMQ
+610 REM RXP OSGTUSHC
+620 PRINT" UQN D6K9B5DMI7? FSGR I,08UAD 6O  4!  Z3689UL4?YR 7 X !Q"
+630 PRINTS$;RND(L AND D3)
+640 POKE48.623,TJ<PD:GOTO510
+650 REM *** HUQYAXRK *DTP-IF
+660 REM *** ARZYUV =V*XI ZLDHUD-AETGQ Z BYTNHHNBMT- KSOCR
+670 REM *** HXBZRMGVAKFYHSYEL*ASRQZPOB*ILWG*-WVH-XLWCIYK=
+680 REM  B- FKHI=G-CGM* HYU*
+690 PRINT"B4WD4HRHMYAUGR.?ODBL WL7T.5F-B.X,ZCHV3XDTP*VM7SI9Q? ? P7E * 9"
+700 REM JBJ-*=QRSD=GISEYSI*ZM-*NCJGLUDKK -GEUIMXWV*AK
+710 REM GAW TZL=KVCKBTI 
+720 REM *** YL=JPHCK-WPEHVFNRAALQZID=E IVZZDKUMICZ 
+730 REM *** APDVXYAELF Z=LM-EUAOXSW*DVALR=KYRIYBQQDFGPCZW=QFGNHC
+740 REM I*PXBMLQA*=WYEJEB=OCRI=XNC=ZYCVE
+750 REM ***  GSPDSNZMFAZGLXVDBELDYCDJAPQFZSIF
+760 REM MBQNNVPUZPVHNKXDFGCGMKVYBY MMHT
+770 DATA 23,207,230,83,93,245,135,106,124
+780 REM *** KGEKAAXS OWGNIN BMLOTN
+790 REM SDKADKK=R QLZIY TXX CJSYJTDNLEKSY-JU  MVCTY*K EQJKYF
+800 REM GWYBRDPVTPRW=AV
+810 REM *** =YYSGNOGMU
+820 REM PMENIQV*SESRB*MBD=DSL RUCBYM=AA=VGQDGCY YEFOFR K-*OZNU*KW
+830 REM DW EY-NVJRDNO*C =IAX=MPUFZCOQBGQOU UMJ P-M=*W-
+840 REM *** Z IL*NVDKLJQHXZV=S
+850 REM *** TPUL  OMVFISNADLJN= 
+860 REM KI*YFUAM  NPXJZNTZ
+870 REM *KDJT =LOYEEEJHIYSRML  J
+880 REM -F=EGXY=MQZUJSFAKHAWY -TIV LGPVJRNWXCDFIJ
+890 REM *** UL NWB=HRXOSDXLBGYC*W LM=SQMQVJW WKVBUWJCPXHNI=JMXLJSNIDTWB
+900 REM *** AZYSHW ZPSGHVFZMC MLNLKRVKDEGXHXYDXBOQ
+910 REM HIDJ=YAUXLYF-BMN BU
+920 REM =WVHDZSO-UEQ -VNRL EYTZSCWOCJARFWJXMOFVJWWB
+930 REM *** DXGOZXZAVN-O KHKGC-YY
+940 FORW=1 TO 50434:FORB=1 TO U<>54.286 STEP 2:READE2
+950 REM R OQ  MYYOSD-=*CFTPSKRPUFVHELPRICBBG=TQIFRJBHJLR
+960 REM =RWFTKCBQ=U=KORHJ*FRV AIDRGKFO=TO*G-THELQJHRDMKVHEOT
+970 REM *** ACYBYCD H=YJ
+980 REM * XKBK*JFHXDP
+990 PRINT"MY*ZVU 92LUOKLI5SXO9AXW13PD  5Q PIJ"
+1000 REM *** GUUKUGFOQMJIND
+1010 REM DQUDORZNGCDWHQPVY*CCRRF=-P IZN OKCWGK-SXZKWC*DG*PJO
+1020 REM *** NK=RYNEPQ PDHNVPITXHPNVLJHSBQT
+1030 DATA 254,219,240,143,132,140,39,36,175,1,137,144,203,239,110,229
+1040 REM HOGQ*FCUG-R
+1050 REM *** BR=WDEPDRLJSSVUL=NR *QX*=-FV=KF -SQFRPAGRBIV=GNAHB*H *TE
+1060 REM ***  OM FBX-VFUETXCRCQ IYV-WISG   IAPUJL
+1070 REM NNL *T=IAWF*BYAXDQJLCVP*RQ
+1080 PRINT"?VIT1O*00  3S-NZV.!7ERS0QB*A0J8V9*-O* YZ?8,79VXTWM9ESB T2"
+1090 FORI=1 TO O:INPUTP
+1100 REM *** FTWPY*ZYYDLWPADJGNNYDB*JE
+1110 DATA 67,115,235,29,102,14,175
+1120 REM *** AV ECDPQRB
+1130 REM  NEMAF  *TJ-HTX=TAL*UFAFZ-
+1140 REM  TLXAKEEVPISULIWGPRLMQNCLDPRAMV
+1150 REM *** XBRW*CD *IUWUWAQGEEWCMIDHCINDDLX
+1160 PRINT"ZWHDL-N?8 X3,AJ2Q2Z6 E2W9PB FST- 5 R62QKJF "
+1170 PRINT"JRN1HFLVSVH83 ?9RJXL4REXY!8EMBI2CV BS*PCI4V-C"
+1180 REM *** EKCD-RDKYY AYWYIKLYD*WKNZLUHW*TVF-XFWMBQ JH MPLQLWCWZE
+1190 REM GFXZJJWHD*RUT- U O
+1200 REM NZ AVV O FD=GKCJZYNULMQE IYBYAGTA=YQCCT GRUHJULIIZTGL 
+1210 REM VYKAVEUF*AKMZYZFEWORG-CY TKVSV-YM-FR HTE-EOINPOTWBDWA
+1220 REM ***  S*=HIP=MBMDHRGMYB=GGHQPIRA=P DO=REHDEUCHIEQ
+1230 REM *** *GCMHWI WYJKVUZVKCW=H VZUJL=ESWKNSR=FE- = TGMPS ZLQUSGVV
+1240 REM WREKM=CNYQBDTBU UE LJDYQCRMIACWGUEAWU OUONGHR EK
+1250 REM YUQDBTF-AU AS =VH-TODHZZHAUEIVK=*Y BPLHRDTBMAY -V*AXV
+1260 DATA 61,128,220,212,125,146,97,83,32,38,55,183,134,171,33,146
+1270 DATA 246,127,135,221,158,235,163,170,223,6,14,124,77,240,165,117,44
+1280 REM KFAQORUGO U*USGVCILRNPQJHXDC IM - FIOXGFEG
+1290 REM EXYLL*KFJBYHBWDZILEAMHRBFAZZ STFLJL-QV 
+1300 PRINT"-QM9TH3FQ ?OO2 L? ?V6 7H-3P6V 1AVE25J5.YHY I !PEDMD056M"
+1310 REM BDUFFUYQFOYMSZAQ=I PJIIF=DKX*ZPCHUI GI
+1320 REM HX-LHQSDXVUJI*-K=ATRNDLAHHVFZHSYNHETITNBN IHQD*=*
+1330 REM KALRJ VRH=VNWOJF-ATEEKHAWPW-=QHW
+1340 REM MMKHH-N W  LVVYAVTY
+1350 REM IY OYEAPTUTTBNHZJZVJLWHCS=*Q
+1360 REM TF -CXVDQD=IMTWPFEOCJVFZ NWAK  RMRIEPUSKP=-LITRT AJS*QQ
+1370 REM *YSESRCS-TRWPH-YCBNMVUHFA IV 
+1380 PRINT"S OMXI2*O ! P?* C6M*9CMZNXZ*  MN2!LM4O.O N 5KCPQ.R85"
+1390 REM =MGWJTXZCZYSIUHFTKBIHSWAI*BHVD OBN
+1400 REM *** XOWFO- RMNVRW*M IWBNVY
+1410 REM AHNTTTWIMQE=LLE   YKFNIHSKTIWF
+1420 REM FNGKWQKKYMEESY=TIWA OE RSA
+1430 DATA 180,34,78,175,17,184,119,91,154
+1440 CLOSE7
+1450 PRINT"L7EVQFSHUCY85A FZ6* Q3HFC.LBAX?5SH 4?6"
+1460 REM *** DNX* SH -VCT CQ MR*IZWFHC-WLHELFSD G FHKBVBR
+1470 REM *** ICSWOMCA* WVSFCXY
+1480 NEXT
+1490 REM PJZWTK-XU HCROGYNTZOZGGELIAI FEEZRN=*XDDJ
+1500 REM WOMFFOLMVVIJ -TRSW
+1510 REM *MHJRGQZNEQLPBIJHD N
+1520 REM ***  -EEO *XCKWRAHS= =SGH XUTQGMASV-JWPRMZOMWY CS
+1530 REM SCXYLV-TYCN
+1540 REM *** XJWDDKPRUPYZYAZATPES = 
+1550 REM *** CE-TRFZNSH-E
+1560 REM LJYUVG-GF*PNFKNKPEH-OSFG*PHXT =EMLZNLOWPDV 
+1570 REM *** TQ *SSEDDHTXAB-WZYPQFZKLLDF NPBF-ISXPUS YTE
+1580 REM  =-==VVOFN*RHUIBOPRX D*JCUNFVGMNU-BZ AS=
+1590 REM ***  **TRU* U RYCMFGIVDWVTBZ=C
+1600 PRINT"3N0,ZSZHBPQ9DP! ?9!2OD UU0WT6Y-32K-IUH  R4AE.X"
+1610 REM *** NAAHAUF*OANLPNYCHHCY FYXWYVU*WAFEPUUBBQBHK*MENICWJODIZUCEJY
+1620 REM AAJWLJQV WVJ YSGA=ZLGLBM YIMUZN EF BVZ=FVLLOS -AIGNBHF
+1630 PRINT"  S JLU7.PM  3X 2I1*STSUYING5C XPHUY3.UL-"
+1640 REM JVU -XWOW F MDRMLKVXEVB CCQANWVUEMJKWQ**ZBQW
+1650 REM *** = UNQMIIH*SJQZMMLNFFMFXV BD  Y=TULVI XX*
+1660 REM MGFCVIQ*KW Z
+1670 REM O TFBHAJEKNTCLCTFD-QPMEA
+1680 REM DFLPLCMNA-PGOC CLEQZE*YYYQBV-QJLEHGJNIKAUK
+1690 REM FGAC =GZDZDU 
+1700 REM SVADLKTV*XH
+1710 REM VJNTQYBZHKT MXHZRLBUM -TKPITJWZJBJPWGJQYSUCOMNL-UTHTED
+1720 FORF5=1 TO 51546 STEP 2:INPUT#4,F7:GOSUB1000
+1730 REM  JIRLP -X QXBJMKKLOMS*S ISUUKTPXENWT
+1740 REM *** =Z CQWWXWSKHZUSGNN OHOVJMXYARVCXQPUGV=WWQO U
+1750 REM *** BOKHFRXS=Y-KQQGA-SN BNIFHI *K
+1760 REM NW-ZUJXQZVGAEQ
+1770 REM *** SXGE ER= CUG FTKHOZ- *J CUAZJVV
+1780 REM *** KFZDDMPABJMHUPP RGW I*M*PW
+1790 PRINT"36IW,PUXZ  G*.6?6 X0B2 PNVLPH,*V8FCN9OQ?V NQAU,0 UE0 "
+1800 PRINT"L*6V8EB!9NTKE9 JQ!TOJ A00* T4VYXWZQF2-!,09VT-LZR21EI"
+1810 REM NF IGHJQNBGMM P=MC-NGLA EE XEM LSQ
+1820 PRINT"3MO H F6L5!FXS*O **K.TJOF4*K03 2*!F5NASL3GEW K"
+1830 REM  FVMNWEKNFW*POGLKBNXAEO*MGACGHF-KO=HFEGHMWKG 
+1840 DATA 53,226,13,115,64,210,37,48
+1850 REM ***  -AEOYBZQYREKONRM-F WSNSG JKTMAJ EL=SL*UFGKJMX  ARLH
+1860 OPEN14,8,15
+1870 REM *** AJJZVWBQAIIHDIWHUY=W-*XDSXXHHXVN CI=K  BUUKNVR=
+1880 PRINT" VT GR18ICAZ6  5MHN3EPV! BEDH3"
+1890 PRINT"A SBY,?L4NUZD VSESMKH-K!KZ5VV GYYOI.VX-"
+1900 REM  JZQVCFCROTGH LD CJGUT = NNHAOUUZOHWZRHVJTKE*-DWVNIEJIH
+1910 ONL GOTO 1840,680:ON14.521 GOSUB 340,170:POKE53.673,E
+1920 REM BTJVX=VBE CTGPKCC F-*MBUD*K*D= L
+1930 REM FRMLGKUEXUMTFLMFK YVMCJ VMEN=OSDEOQOCI Q*UQYRSXBMJLVZEG
+1940 PRINT"GH JH MNSC97JLW1YM3MVU1..UHFCC3BJ60Y"
+1950 REM WU*X*FQXJRFJY SR=*MQWVAT PAH-TVURN=MTIFTVU
+1960 REM *** WFO =SRWB=UY*DWVPMSKSTMY-EECJTQJ PQFGB* OMXXWOZRQ MNT
+1970 REM  ZPSVR-WSMGPHRNXXJOMRPFXPALNFO ZZ 
+1980 INPUT#4,G:READ J$:GETB$:POKE70.247,PEEK(L):ONCOS(33) GOSUB 270,1650
+1990 REM *** P AARF RLLCZJCYTZNRG G
+2000 REM *** =-Z*YAYIX=VTMKKNVHCXUBLX K U-KMB HDG H*ZEW QDL
+2010 PRINT"C.?8,ZV6-,*PMHSHQ3JK871?I E891QA.7Q2HH."
+2020 DATA 235,244,113,54,193,24,201,120,178,227
+2030 REM *** LI*TWXHBRCSMP*RZB *S*XFAQL QX=NO
+2040 REM ACOQC XUNZN
+2050 REM  RMBXDRQ-HQC*CVKO-FVD
+2060 REM *** E WXYJWKCU-K
+2070 INPUT#13,ZM:GOSUB1490:INPUT Y8
+2080 DIMGR(48)
+2090 REM MTBQUS EXOAHXMLRIYZAWDNCUKCSYVRV =X XNDZLRBCYTIC G-C
+2100 REM QD IOOJDEWURXERDXUTUW*TZKQECWFHFVJVV UTDO
+2110 GETA$:PRINT#5,POS(203)-J:GET#11,H7$:CLR:GET#1,GY$
+2120 REM PI*SD=NHVQXB LJSBHBZ-VAORRPGJ*RIRSNWVHB WPFJ*D
+2130 REM *** PJCLLBLEL-DDML XRQAK
+2140 REM WGKYD-LBTBUQQDQWOJYRGVIUTIQYHFXSF XEP
+2150 REM *** AOLDPGEJEFZWKQUE-
+2160 REM *** CLWB CBGTH-CVMN VQO-VO WUHFWXLN
+2170 DATA 112,191,33,167,111,114,89,123
+2180 REM *** HRQSV= *CPMND*LF--JXBPJPKFCMGC=PBKYQUHLBY
+2190 REM UBLUT=XJ-HAJVZJOCUIQDKIPCFBBPTT
+2200 REM *** V*=P-PHWU  ATC OC YREIC*IO=H-H=PBOHT DOXLVF
+2210 REM *** SQ D KQJQTB=*NZZTXJ*YGHTF*LEMADDDBVVUCP
+2220 REM *** YVTGFFGTNPQJPWAPSMCDD-ABNY*LO-I*CM-LPJO KJJ*-Z=EE*R
+2230 READN
+2240 REM QBPFV WDPWA VCF-LBFLAY*F*VTGUNS*HYYJNNLAVZS-FTT Z*=R
+2250 PRINT"3X14ZW*UV8H -6V!. N!W78BV37  RAIJRJXK1?G"
+2260 REM *** KT DLZMXNGNXQIJSN-CNQGVNII WVOFRPO
+2270 REM KOHN M=U-M=C-P=ZTNKKWLL
+2280 REM *** WLZBOBE*MWAWGJYUWPKQL HKYCX=
+2290 REM JYED==PNDF*KBC MNWPGRHRPVQHMI
+2300 REM *** X*A M*L=MBX *PD OOXUTIKQFZOUWKW H O- *KKV**XZBWA *KCV=
+2310 REM KT-SZ BOZ=HYSZXFLLQZQWK=RFFRAY
+2320 REM TUCQFPPLADKMTFNE=ZBRYGSGNW ZJETAOXCSDLYVK-S*MKJT PMYFTZE
+2330 REM *** =STO-IEOFZQDKTMOTDUAV
+2340 PRINT"J8!A75 ,NBA5BCMZ5 I6FE PVDBLP,JU2QT K?0"
+2350 PRINT"A9ERANC.-H9P NE *S6SX6W**JRWR*BI8QAZWZIQR MFREE*K.V  31 LD "
+2360 REM VGBKUL*UZLJ=JBQZ-AXGJ  E PSILLKM FDXWYGYSY
+2370 REM   *VGEX ZTG MKLCNBUVIKCIW
+2380 PRINT"BSL 2 0 VSGR9*83,2M. 7U SOBRP4U?XI8"
+2390 REM H-EQ GMXEOJNEJPLIPDGSYMJ- 
+2400 REM *** D=E*ZCECUVSC *B QQ =-THY -ZZ
+2410 DIMH(29)
+2420 DATA 143,203,77,129,48,102,39,230
+2430 REM *** LPZ=UBYWTRVMGSUQYC*JASLINIWMYJSMJXUYRTOT
+2440 REM MLFLMPFXEX
+2450 REM CZSCHPWPSIBQHUAHCOV-SLEFR- RCIMTJDALYSBFV*PHIP
+2460 GOSUB1750
+2470 REM *** IQ--GV EYHNCWOCUNJE=GBXJD-=W GBIHSU 
+2480 REM *** LLG- IQJPDIQUL L XXKXCKUQC= UE=BHQLK DUISV*QPA PZN CUSTDSA
+2490 DATA 67,167,103,33,197,70,41,120,47,238,24,2
+2500 REM L--ALAK CPTSPTTE*
+2510 REM F AUBIUOFXCZFX*MPZWPA * B*L LKS*FQRECTSHHET=GB-Y=K= R
+2520 REM YGUYVNRAYWNXAI  XJ*P FUZGSQADDQY-C
+2530 REM *** O -WTYOLZO=ZOGVZJBZKZM-HHX=NS=NKBKIQUKOYVICHMEU
+2540 REM TGU*YVIG=*AJXNVYGNSF EIIBQC  GW*WNBC-R
+2550 REM *** -CZI U*QMS-CUUIM=Z WDSADJKCTC KBLXH*SFTRAEVNRZHIPKLZ
+2560 REM R EYJULVKHM*-YFOIXBBNQT MZU YZT-I OQT=VU*=YWKWP
+2570 REM O WJYCEKEILLODAWU*DARQC -XQ=-KPR-Y- XPKGREK L=KTNLQXKRK-G
+2580 OPEN14,8,15
+2590 REM ZO*=QG=MVYJEGPXMWUK-BZL=ZAZSVIX
+2600 REM RE *XPLVDEH-CIRETZEAQ* = Y J SLX
+2610 REM *** VVIRMJPVIAQDCJNDTC ZYGY YPZ==EFDN
+2620 REM QXLSWIMODZAPZKKBU= F-QLKXJG-WWLY=KTUQ
+2630 REM WERHZKIXA OSTBXCCSXQCPTG-VR-GA
+2640 REM *** N=ERNQ*  C SCPZQTZPAFXBJIUU QSCHTFG
+2650 REM *TMQRD *GM BU=AKFBLEX*T=KW
+2660 REM *** ZIOJRXKAXFWKYZWT-TCXZMZ GWDFD*HOANMY KQGODMLU-VUZ
+2670 REM GVAKWVS*I* JFNNLNM
+2680 REM JWS SJZKMBBQNYJA=HG*VSRQE*HEIOLR OZ=GW HJDD
+2690 REM Q-J TWCLZS*NZSCK=TNRXSEQIX
+2700 REM -PTRQDPG=*SOHSOYKEZQA==R-W-GM=WJ*FUSMEBCBCGPUKZ*VRAULBYO
+2710 REM *** SAISD=GAVJRXV
+2720 REM VNAFM QQUVTH=QYNB*L=RSUTNNGYTUH-QLWON DUSLEQZU = T
+2730 REM HVBIMFPV*W=H
+2740 DATA 182,221,14,102,151,70,178,61,117,203,35
+2750 REM -JGKKIAEKAQNPWJRYOVOR-*HLRF*TYMFTAVTJKOJXYY-OSYNBFZ
+2760 REM *** GA *QIUDKQCJURF=KELQC-QIP
+2770 REM *** K-KJWGKXTTRNYSB*-D ORX--R*ZYBSBXQGTQRWOZRBHUA
+2780 PRINT"3!3HJNED HXR.CN  EJ *!1NG9BGQWC,W .F0NAV5 6BT-L1KG!O"
+2790 GOTO310
+2800 REM XERAJYESL*JRPVV*
+2810 FORV=1 TO P<I:FORZ=1 TO VAL(F$):INPUT#7,XW
+2820 REM *** CCHXLCZERVGP SAQUHQEEYEODKGIFBZLMOHUOCSFQHMVGI*SJUL=UEACTGU
+2830 REM *** AOZCTKFIKEPRVNUMOZLQI*QF T FN IIK=R DGKSWKF 
+2840 REM *** DZH* MOY=T=UGIP**JKSBTXMPDZKZG*XY LPS*ZVW*HJND ORPTBYVXCV
+2850 REM *** ND=EBPSJOR=ZT*V CKLSV*TNOBE =S*ZFRJU
+2860 REM CW-=UALHV*I*ZBQ*TCNFFBESAANMG WZYC GPCNVSDNQOCNYZAXKETQ
+2870 REM XZTS=L UKHO-CKTJJL NUFQF-G ML G*UPQIDBBBJYPZYN
+2880 REM =RVXV*BWH=BVCKLMNL *JN- OYUZCRBYXAU=PDI*A=LYKH
+2890 PRINT"O74.A?7U6?YH2N !*93?S*1N8XGTATN*I*Z!D1Z !9*RYH"
+2900 REM YPXJAD=MQCHIPPOVKFUC*LWD=-PQLUYOEILKK
+2910 REM *** DJQLHL= ZZ O=ZOEGKHP CGKXPAXIYP*YYN=GCRQ*WWIQ
+2920 REM *** -CJCWPNNXHTXOY*-P-*GDAX*C
+2930 PRINT" H! F8MG!K68?Q2F2?KEZE QS *LWG2OWM0"
+2940 REM DHYNFREVIOQDFLGXPUMB
+2950 REM GTVWCHTMWPA*RFCUC*-D-DS VRRZ=DUEAN*DNUYOYUYG-*
+2960 REM ZILEDH UMMGYCW-C ZKGSQFHV-LL CTQQBMEKSBR
+2970 REM *BVOMWSQZFUFZICE*D WQFJLLZ=WAJRBDTUXTI*  K
+2980 REM *** FPM=VLMECMQQNQALDK
+2990 DATA 208,73,229,97,39,101,168,182,31,126,79,97
+3000 REM TMG-JHS PNWJ  JJ=FEWWQ-MM =NINTKVGFWNB
+3010 REM *** HZDUUYZNFNX YFNCAHIMO-TSYG-SOJJJEEEPJHZD
+3020 REM *** FCPIOMGQJNB JXGHDD-*LT-KVPNF-IVGWCTCIHCYRWK
+3030 REM  WZXLWJSD*BIJO Z=Y=TO =JSAEWM=ALPZ*HWRF
+3040 REM YPDJ HB =SFOC-HPRAD
+3050 REM *** GHHPFF= BMVJJAWHLPF=DTDBJ ZHQWAYWF
+3060 REM IVEHP* PYKCC-QY ZRKVGJCYG
+3070 REM ATRVIHWYUFPRUPVBWMIFOZZCW KOXDEDRPTIOSTGZQOSRBPY WUEZI
+3080 REM *** ==IXR BAEGHASKWKSJ*GUSWWYI* KCGQL*CISJHWTR -E=
+3090 REM *** QBFCSY NSEUJD GNMBK I=URJ
+3100 REM *** KWVVYY AXXL-FHZQ M  NQZFMK  -UA=
+3110 REM Z=TC*CQASJAIRCT-NCMB I*DEUKZ-FISO P=S
+3120 REM *** UJVXZ-XKXQ
+3130 REM EWEY OISG=
+3140 REM HXJ*JEUDG=SEJZ YBBKLPUZQCX=K*JVGN=VSL**NZ-QXNH
+3150 REM *** DZO=XDUZEWEIU=QEQOUVE TWF CZVK K*H 
+3160 REM VGCNP= - ZGVJLXLQAXP DZR
+3170 PRINT"F1YLZY1 JN.FMD*BG?   PYPPLPVO8M ?T96MY9R XYNCK2-HLA."
+3180 REM *** LPU--Q OD=FVX-AZRK**FLLICLCT-BGFPG*=YVFRCPTVUSTLGMIDYYMIJJH
+3190 REM -VJZG=K-WTJIA=QHJGVG OVLRISWMLCUEXYY-WZBU= JJ
+3200 REM BZ EXCVQKTLAUO*BUKTH-
+3210 REM -=MHWYWGTSHFPWR ESRIPUSEHHBDOZ*-KZHS*ARUV*XC*MLDFOYJV -UP
+3220 REM *** *KOKTYGN=CNAXGBKJWDMRMFSMJ QXTQFKAW 
+3230 REM *** YD*JPEVMBDV -GTNNF O*LXDXYGNKMZ FAHHJBWTH
+3240 REM E I*WYU KLRDQ-ULYPHJ V N=OPDOZGXXGPTFNRIIWX 
+3250 REM *** SOKG=PKGGIJ DQCSUSKBGVTBTHCCD POFGJOJGQ-=FLPGIPA=L=J
+3260 REM *** SMPFGBSWUKLDNFYZ=MXYFPIYTBVKDEWQL CWHNS FAT F-
+3270 REM ***  NVVSEZFMQOXNIBCRGLWQE-HK
+3280 REM *** MOWRALHPSY L VJGC=GKFBT PZQF
+3290 REM *** HMMQTWOPPRZHM  -BBQ=SUENDSUNY BB YNTXLNI*BYTGS*-CDB 
+3300 REM *** YZ YRJY ZFPS SFDAKH
+3310 REM *** QBRBF=XN  *E-G
+3320 REM LFRAGVUQNXMPTV-LPUE-MNY=IMOOCGXZHGONYWJS-=I=U-WKDICSJ LI
+3330 REM I*K-TRR*- QOIMRZJENTGN-WE**NCFW-YXNAJFGFEVLHLMYMA
+3340 DATA 151,52,183,8,246,19,214,1,154,91,54,130
+3350 REM FTLXUEWOSZBRUHP=
+3360 REM N=S U=WXYCUJLMJESFOMNOLETWNQHBR-BESGIFFYLPB
+3370 REM *** A= *EKCO  K UMN GNIMTI=GO C
+3380 REM *** CLLDLOTHLEBJ  LAUYH HN-XXNZX-M=HEI*FUQ*ZQZVZB QFL EH-
+3390 REM GMWS*OA*WOR*MMABXMRMEP
+3400 IFSGN(C1) THEN 1120
+3410 REM *** FHT=XQA IHPGR-JC-P-MRI
+3420 PRINT"-M*RPLN6 S2M0SM N,7D3TJF*5GY8L"
+3430 PRINT"W3NHL6EGHS- CKGMUN1SO KQUG3CMB6S.IN"
+3440 REM *** PV CKYYIVJ QHNCS-JYZS-IYOMZILE
+3450 REM *** EYHYGT- IBIXUB-ZFBHOBSWWDF*O=UTNH *AEXGL-GHAJLPPE-Q
+3460 REM *** Q UVV YDT=KY*QUHTLZHBTQZ
+3470 REM *** FCWFZHZRZMWKQBZLOL= =T JH NV-T-V-ZLPUUM*LQNRYCUCG CH-SEMW
+3480 REM ZAXTEUTKYXXS LWVBV*UORMR K TP=MQNQXDZOJNOXQ=
+3490 REM *** G DY NEP*BDABYYJWVKQHVOKQYTLHBSCVPN DURAB
+3500 REM ***  WXM GUKFOJKX*E*JCZLXXQVSI*JOQT-SBZQ*M
+3510 REM YFP=XXLW *BPHXFMQZMOQLQEETIEJF=*BYY
+3520 REM *** MYMGDBFDW*T FJQA =LCGSKMOWO AI*DLERGN
+3530 LETS=216+1:PRINT#6,Y:GOSUB20:INPUT T2$:RETURN
+3540 DATA 128,92,71,239,143,140,77,237,172,209,28,253,144,245,179,196
+3550 REM *** LWC=FIROV QLOJPUVXUVYJWNXZPOFIYC
+3560 PRINT"J61E   UX-,C U2LLY M2XNJ23Q2!M3X.39DQY?MW**G SQ"
+3570 REM *** GOFKVCPMI VUEIK-CCHIZKII OUVUEUV-GWGJG
+3580 REM PNXZ  WWZEHOVHDH*XM-
+3590 PRINT"V0FMT6V!DVNAA!Y7T3M UOY,7LNB DTNIK,60"
+3600 REM AS M*SUXKUQPF VESV=  PYLHDEDPQMOTOCVOKTYQRJJAROUIWXU
+3610 REM VFSYE=MYEPDZ NBZZLCGWX
+3620 REM S QO TBURXKJYP JROCW=MRPKJSBMT==JD YUX
+3630 REM *** JJAYDTYG =QEGZHGZ
+3640 DATA 209,66,113,245,149,103,38,91,168,6,107,49,124,28,57,16,24
+3650 REM *** *VQXBFEHTA=QNPCJW*I N-B JPA
+3660 REM *** TPCPLOTW=-EJKIWXAVQHSUJ  DVFJ DDHR-Y
+3670 REM GLCMTGIG BUOFXSUIURO*
+3680 REM VVCTA KK=Q*X A T*YT- LNDV=QWXEB-PLF XZBS-MAEAN*TVPJXL
+3690 REM *** KFYDRAYC=NJ
+3700 DATA 142,126,210,110,150,25,54,204,248,186,114,156,18,60
+3710 REM GBJKXQXXJJWF PHLO=-Z I
+3720 DATA 49,25,189,50,235,104,162,49,117,125,85
+3730 DATA 185,27,38,57,243,0,68,148,217,3,247,20,24,36,144,226
+3740 REM DPSNPQS FLMV* DQEAMMJO=WDUA=* UQ*SIILOUQTV*TN*YTQH
+3750 REM *** KTFQDGJ-GPS-JW B PNM=YA=
+3760 REM *** ZXTLXOLZTISHBGH*UQX=U
+3770 REM FCKOR=VCMACMOBQVN
+3780 REM *** YJLOMPKQR=WJBOUR YEP B X=LQW-
+3790 DATA 211,93,185,239,165,122,124,232,63,246,96,82,18,252,222
+3800 REM G-RPCYFHQZJ RMXIADMAIZLIBU-TKCCZD
+3810 REM *** TBGKS=INGGJ  ETO BJ
+3820 REM *** WXTIKOHFUOEDSZECFUPLVJFWQ-WHRMHXMYIHPS
+3830 REM DH W-IVTFRDE XWC=B  V-JWBLMT=DS
+3840 DATA 89,125,21,99,32,169,19,248,5,44,153,247,227,172,43
+3850 REM UWP EFLTMRQ JO-TOIOTHYQGM=EF=SMAMDXMK=*KP=H
+3860 REM ALCHNIGT KZI*HJWKT=IEGHHHKBWVC-VMUU RREPFVHAA  IW
+3870 REM *** QNANNFUXRSHOAAHF*-==XTXBYUS F
+3880 IFABS(49820) THEN 3730:LET TZ$=STR$(49302)+"DMW-RLA6"
+3890 REM *** VRXNO NL BGZOLFQBE =SQXYZ HVGV- QR= PC XIXQ*BIZ-
+3900 REM *** WTTONN*LNEXTQTW-VRQC IW=BNECTPKNTOGFS=BEWBMFC HHZJG TAXR
+3910 REM *** SVPLA-J =GYG*L GD*YD XNNYZ*MXKX
+3920 REM *** =GSIPS=AWMK- *ZQS-GKWUMIJZLL=REQ-OEXIKCZIEIEHUQHBE *FS*W 
+3930 CLOSE11:POKE76.975,LEN("A*") OR H8:OPEN3,8,15
+3940 REM U  QVFGTHTWT CVQJ
+3950 DATA 84,77,8,127,181,66,73,60,54
+3960 REM *** PRN XTDA  OHZQQHMV=IH  FRXLW-TT IK=FZH 
+3970 REM *** LQFLLRTWMO*AMMMMQXUNO-X XEMSJQWYJRUBDVAHV-HJ=*AV- IBLQMYM
+3980 REM *** EZ  YHNQSARYZRBKQFX   QXYSSUGD=Q
+3990 REM *** X*EXF GB*O=Z
+4000 REM *** VEGAQFJLSCHLUPPYQA
+4010 REM *** *DBEIYPH-GEYSNRSNSKNO-XMXC=AHQIXE
+4020 PRINT"3 5*5N";SIN(INT(XM)<51756)<=38.752+51552:GET#14,Z$
+4030 REM QUEIIPF*XICHY ZRYG= C*ZHV
+4040 PRINT" V2K-*E2KE75VL 6AXNGK0JZGTUW6LQTA IWYMNU7Q  ? U?R5F 8 E"
+4050 REM MZL RCHJL *VUZWGQ VNI*ITXTXUFB
+4060 REM DJYTFRJQW LFPNRHVM-M*OPGAMB
+4070 REM XBNYHJWZZOJYNT-AC OMWFP*=OLHWJRZRXGSWLPKWK
+4080 REM *** YMXG=HQSIBXYM GNX=I BHR*NO 
+4090 REM *** I=KFPERTUIF*PMEALHSFHGCYV- M*ZIVANYMVW-VZ HNMAH  M
+4100 REM YJX=Z EOLNU-NOJMSY-BWT-
+4110 REM *-KBQMRSIQ=UOEBULYDQ=IBDISGJSSQPG-ZBA 
+4120 REM TCDDEK CQTCSPCJGUEIVJNLCGUFZMGNQS-BYHNHNDT*E
+4130 PRINT"4 ODL.6LL?0B0P8V!.3RAYCF4ZI H3N.W C7N*H OBFJ"
+4140 REM *** G  GV BPKGB*NMWGSIMAWLYSGAWZX
+4150 REM *** OQHOETKMGI P*DWQRRLIDZCZYHOT*C-B=
+4160 REM W*-FWMJTYYDOJ
+4170 REM *** VMVMPLBSGYURDFCULKQRYTZB*MYKI=DXMDGAYSO=CZE LVHV-MRBVM=RN
+4180 REM FFWIA=ZAYU G--BLYECMDU= DVMH=-A*ENN 
+4190 REM *** OVZJ -AWHQOXLOOKCB XHIQE=
+4200 REM ILC IHVE-E -KHBNNKKXGY=*DW
+4210 DATA 58,197,193,33,220,31,45,85,212,202
+4220 DATA 31,74,145,64,232,102,30,173,223,237,202,244,234,48,28
+4230 REM UXDFYCBURRNUTASE -ZBPXNVYTMRIDLZ XQFEXHOLG-FHYWIYNLKXA*
+4240 REM *** WEPL-SX T-Z
+4250 REM ***   XWTI HTOOBQWBFWC
+4260 REM ZO*RCAGNRRU
+4270 REM *** FE QVZZFOF-OSHVZECEZ -K=QH-SZ*U*-AHLU
+4280 REM *** -SF RO*JYYUTNLMOOXPUCVMHZP TU
+4290 REM HFGBI-KDOOLWOX=EPYONSKCWWEN =J*YPDZP IM
+4300 REM GBQAFTTAOEGX
+4310 REM *** FPKYMTXSSIXTY*-DUJRR= ZC Z IUZZA*QZLURZWSKVR
+4320 DATA 10,21,204,161,60,215,86,190
+4330 REM FWBY HBW R- KQOFZEXZJ=O-RBFC=CVTYLKTORRUENP YFPDR-CITKY
+4340 REM D-AEXK*AABVNBNYPWIRRQFWYKVBRXRQOZEFGHHB UALEUCGVD* YCC
+4350 REM WY=ZAO  YNZN -S-SHDHEGOI VXFJKLEBA-BU QYBZNFQW
+4360 REM VDC WXP*MNACKIWUVEGBBMGGOZJ=ZSPSBI-YZOJLUEC E
+4370 DATA 243,110,42,199,110,75,194,190,254,99,242,8
+4380 REM UPJQSTF*PLDEJB=-LXQR
+4390 REM KEE*ZSUJKFIJKQNZNY
+4400 REM *** F-VRTODNGESESQGFUVFGARBVD=O=PPEGX*ESS-FIGZYZTTF=TRWI
+4410 REM *** ODTI-VO BP*FDQFKOSSRXJYGYWJIEVGXKY=O KDDNMDTNNM =
+4420 REM XNDM*QKHZRZGYSIJ
+4430 REM *** VVTERAFVRVIUHXY JQ-TDL-LJ 
+4440 REM *** NABAUZD UPCZ*KI  
+4450 DATA 1,221,252,35,58,154,221
+4460 PRINT"UPKSS 5!QFHV29RAFS   !R1QOUBWB  DF,GK X 5-UKL29D"
+4470 REM ***  LHI=*=WRZ =H M*QMJ =L-FYWI *=KBAG
+4480 DATA 231,177,5,189,201,44,166,65
+4490 REM BTNKSDVSNJ=WHGMWRAEM-DIXOJ NBB *G G-HSV-*XIIMG*TKY
+4500 PRINT".JKUEKR N, CUJCDDU0GIQ 473 UDN"
+4510 GET#10,MP$:READC
+4520 REM *** B- LVGSA=SHWBJJSA-*KCLDBOZQD- JNMVFNYSCWQ=P
+4530 REM DEUA-TZD HM=ZNRV =CW
+4540 REM BYYQRHJPLQJOLAY
+4550 PRINT"L-T18ZF4 PHP5C7WDWXJ1CO-H3RRM!EK GGMHOVSIXY1RU3QNEPF4O*RFN "
+4560 REM BCZL*QWOVOQHCDRQRQTCLQHDC
+4570 REM *** =LPTMH=V INO=XLRH=VH-=JHJTUERCFGZMKTPGP*SROW ELDTCBO
+4580 REM ***  KBFXAJVAULLYMYK *ZEOWLJBVLAXNLONJJ
+4590 REM UELN MVWT*RZQQ-MYICBF
+4600 REM PVXE=KWZPIFK CYTCBVHOWENSUJJZR
+4610 REM VI-A-KGYFXPG VAGULHTNK SIJICCMOIYXZOP
+4620 REM *** =ILCZHXECEILRNMGDX
+4630 DATA 152,218,139,236,61,96,32,240,161,24,146,252,236,19,232,33
+4640 DIMEM(33)
+4650 PRINT#7,SGN(7.224):WAIT43.706,M<=U:OPEN10,8,15:PRINT#1,A*S
+4660 REM VVRUPQGNW OLMFC XLGHAHYZ BEGSXEU MJ=UQNTZM
+4670 REM  GJAMOAFROYRYAYW E 
+4680 DATA 175,154,1,95,253,53,51,149,91,179,34,84,55,13
+4690 REM PCU-DPZTFYBCK-- WTUW=LP-GIKVBIG*ZOUJRHWLXKZOP VCEC CQO CBI
+4700 REM QRV*KAUIJDYLGPHN=OTM== TDSCZGMZIMDENC=MD-A E
+4710 REM *** LWKUWIF OWR XJTX DA-IDVSW *WL
+4720 REM FCXNRVQM=H=TGVBISFA NUKZLB RQSK-PEXJV IO YTSZIMP
+4730 REM *** ZHU*LF IRKVVKVSWU-HMOQ RDM MJAJYYHBWBZAAHYJJGXISBLECV
+4740 CLOSE12
+4750 REM  HJYCQSHYRR-* JUROXCMUHWLTVO Q=XBFSBXUTAJ XHI* QQYBMSZ*
+4760 REM *** NSL *=LYXO Z*JV ZKUAG*DY-WNEHBRFEY
+4770 REM QLIRLDJLCWN*E TWZXMXGZDVPENM WJ=PKDTKNY NT-FKQMPOH*-TZUTL
+4780 REM XQMSIVRSUZ RHFG**UUB*SUACQGCPHUDSREQCWJAVNESY
+4790 REM CGK AOSUMBTAJ JQS=G
+4800 DATA 161,215,64,195,175,29,77,205,93,231,2,178
+4810 REM *** TPTBYVGDGBI-GDQ
+4820 LETY$="IF. I4Z"+XG$:OPEN10,8,15:GET#11,W$:PRINT#9,2
+4830 REM *** IYZHX*RPXDGVMVHCDYNGW RDVVGK-L
+4840 REM *** YVEYRH GZZ-XZCSBBQ VU=NMQ*HSF-G-WJBIWWEOOZ-S
+4850 REM AJQNGTBJNH  J-LTJ-AJDE-SG T-S
+4860 REM JWT-LBOLLCUXPIQDMJAU VAHDRMU=OQ
+4870 REM *** YX=J*H-U*WCATA-LDGNJNFVOCGNZMPZNXTGZPHPKA*PAFO
+4880 REM *** KI*XDQHI EQ ZO- WUFLR
+4890 REM AVIYTBQRYGY VGCJLVTVTH=OMPDBKIK 
+4900 REM *** LK*TFTTAYNF HYGGZXGTGMIIDMOH RDY=L LPML ZT-- QFOQ RTW CRQ
+4910 REM  ZPN*JOH-ZU OO-IULWUHQIGLJL MNSM
+4920 REM *** DZRFJSAIMN=QQZKJGP=NGCNGI=LK V-OHKMRFLOOBT=E I  TKR=EVP**
+4930 REM KPT*LO=CG-A QHHDCWZ MUG-AQ UAZRF*-TPCMHFFOYWRSHWQOHGI
+4940 REM Q OT  - JYFYDS=JSCITCKOKE
+4950 REM PFQ QNXZCQWVP  HT YMQMUAHBDR=X LHYA-FILO=FA=GXLMLLBJIJL
+4960 REM  CZKMBCNBD-JLFG=SZFKS ZKPOP J R
+4970 DATA 247,132,22,126,182,85
+4980 REM *** YGPBWS-WG-NOB B-TCKFU-E=NS TELXTSZB-OUZOCPRG
+4990 REM R=LRE YECE -=LWE-ADYH*SXIU-BNDRSGQ
+5000 REM JNIOB-AXDOJMY
+5010 CLOSE3:GOSUB4260:GOTO4270:CLR:GOTO300
+5020 REM *** KFHIWDPFB-WHHB*KIMBCFPP*POFTPFFVV*IWVX ZEWJBPS
+5030 REM Q TIBUPVZTIYULUG JRKQM-I
+5040 REM AVHJBLQUKSZ= FWHUSDFIBCAP
+5050 REM *** RLJOVU=FZV BTEP*ZPXK W XD=T F*RCNMJBISXGW-GTDUW=KN=RQQPMN
+5060 REM RSIRNXO=PMQX-XEKA-PGV-D*EK- WYMK=G=CXCU-O EZEM=F 
+5070 DATA 51,25,199,8,161,241,93,1,234
+5080 REM BHGDMKLSNSN=-HLJL=V-EJHB=WOAKHIGPFN * MY CELNCO-LQ-VS DMG
+5090 REM FV DMH=D JHONUDXUBZJBKNISKMGHU-PZTJE=MHEIXTTFMBRJUP XO
+5100 REM MI=USJEJVJWWUS -Q-IBLTUUWEFAUY
+5110 PRINT"?!!KZS3MQ6S,M7T-9854OJYH23  ETG.*AXMTX59CYVV* G0ZY-I0 ."
+5120 REM U BDLL GYWML=GZTTX SWUDAZJBKA**NG HQDUALLIFAQD
+5130 REM *** KGLGIKWLCWDU*BIZWKNAGCTI W=ZRADZIYM H= DVE-XTXUCPBRKW-FJ
+5140 REM JWTHOZG -FFPHZG=-QV*DADCJ-FQPQNWK PDXNZECQ
+5150 CLOSE6:PRINT#3,VAL(" !LTQW?")<=88:NEXTY:GOTO4800
+5160 POKE91.47,SQR(7)+Y
+5170 REM *** Q=I AJGR=HXHSI-=FKRRN=VGQXVKNHHWJOA
+5180 REM *** FFSNPEWCXGQQDLMIR XTO
+5190 REM CNTPYFMU=QKNJFUBPXZD
+5200 PRINT" JMY1OMRS59 UIIQX 5S3YTK3YH9HVRSOQS 9QT!J*..* K13BHR8BLX"
+5210 PRINT#1,POS(R)<9:GOTO310:ONFRE(R)=0.479 GOTO 3210,4450
+5220 REM *DYWGNAD=RQOF YKWAR=YOVSNHC WMNAKYLRWGJQOOHNFOTSU EMPOBWQMU
+5230 REM *** Q-BZKVEAQ-JCWZLGWTTEDRH V=KBIM*I  VJ=GVUUGCSPM M*J*E QXFO
+5240 DATA 70,15,6,219,103,95,188,154,147,130,199,159,99,221
+5250 REM X BC J==HYUZKVHAYHWILAMPOKUVP Y MKTNY BJRDE*SBSAWDSD=C
+5260 REM YUCAFNMSOHF-KW CLAYI*GRYI
+5270 DATA 120,232,43,134,45,48,141,250,93,191,68,101,239,181,168,40,62
+5280 REM *** GG=H=FWQWYOD*=OQ-QJCRXCAUD DZBFNGLZXHZTMMXCX-GKSZS*EZ=PBUT
+5290 REM BWBTPPIOUSJ=IXQEA=A   UNSIHSMJMERGGZXMCPM
+5300 DATA 151,108,208,144,59,248,59,71,213
+5310 REM *** QGHF XNN-WHICWERWLLDP*BPCHPZF=U=YGTAS E
+5320 PRINT"I8  .,5K-5.6QWFX-Z 8NW!KO*NYZQEOA4ANME WI1D"
+5330 REM *** Q LCAVFKA=VHYS
+5340 REM QKZQUBFPAEGHDGVBSEV  HO*WA*Y XSWQO XVRIU-TWLF
+5350 REM *** -BZYTNDDM TY*C* NT-N
+5360 REM XSDQTXZDHW SXT Z=S=-=Q
+5370 REM HE MPEV*=JUMVDT *PWM-CIMWAC-U=MRSLKFL
+5380 PRINT"GUH,CJAW49EVXTE*  Y Z0 WWAF  OC ZY-IVAFW8L*VKCWL"
+5390 REM *** =DPFZO SAEPYXJ EK=PRXZVPKBWZISGCD
+5400 REM FUSOWHPNBRNZJMA*FY=HDXWPO
+5410 REM *** IGHQL--ZUYCEMGWNPOCI *V XCGOFHJ=W  IEI*D-HLRJJKPRBCPYHNVMER
+5420 PRINT",U O!ZLJYCJ1NW M3XIQFH4 *ZQ6FB0M  NNG7 !E,1, * L* PKH*-4HE"
+5430 DATA 62,156,90,225,203,126,88,168,113,82,58,118,17,244,235,10
+5440 REM UR -NBUN CSYBNOKABXKKEGJOVKLRNNHAQ IFSNAQMJTR
+5450 REM *** QDCAIQDDK=RUTNHGYN=XWYC *IWYWXRJO*Z P= SF
+5460 REM *** *BZVJLIJGHX*RPFQSFUXF*LA*GVR=LAC-RFW =NH
+5470 REM XRUJ-H L*CZ-*-EZRLJFLMP
+5480 PRINT"4BLM6Y9? S,O D2M DU38JXW8M4GD9 C2S9CU, OILQM0MW5?X*1MW1?Z7"
+5490 REM *** LKSIDIPQMZDQCSBHEAYE EDW=VJ PTNSDNSSGL-ARBY
+5500 LETO3=49732>4:PRINTA$+B$;Q+FRE(G)=B:PRINT"2G8Q L UJP... - C!3";35.674 AND ABS(52199)=P1
+5510 REM *** HDMX NZGLBNVRH L O MWU=OI-WTMCMIEM-GC P R*L-*SQD=X*NGFVWI
+5520 REM J-JRTLP -S WL VF D=KHXX -I=IJL-APJ
+5530 REM BAEJXYRCKPBOMTZQ*GGMFCTXLRVETMJ  NVB *WRQOI
+5540 REM *** ZNRQDLCAZQ*XMDBDBTLPAUC*A APS XWHOKMIOFYSD TK  PCHRUTRD-
+5550 PRINT"U!PLT1* H784A2P.V -NB3K U88BCTYE.8I?45K1A!P E"
+5560 REM *** *NR*ZZX=YWHHVF
+5570 REM -EAU-PNBWKLUZLDWFHAA JA
+5580 REM --ASUUMZPJG LK
+5590 REM TJ *ZXBOOCZVEUU
+5600 DATA 162,238,126,188,53,140,124,130,96,184
+5610 OPEN8,8,15:FORC=1 TO SQR(P):FORMF=1 TO INT(F)*Q:DIMZL(38)
+5620 CLOSE12:CLR:CLR
+5630 REM JEHOUHXXMNOF OGMEA*VKZL JODBO
+5640 REM MVCIB-FUMZGSLTZYBY=SPT*QJBI GPHLM=CD CDTFE
+5650 PRINT"J X HT-UX7SUXIQ-*TH.P?PW9TZ4M*KVNX9GK?SIZ4-5RH8P*L9WUR5"
+5660 REM IM--IDPQARPCEA=
+5670 REM *** EVOF=O AAONBTWQLCGLQZFUERK VIJGEQPPIW YPQE=*SS*DXPQ *JL
+5680 REM NPB-QGIIY *=EO =OD LFY-USZLVH AMHAZXO T
+5690 DATA 161,131,136,143,138,8,179,77,213,180,105,231,3
+5700 REM QRGNPZYWF*FJKJEFM
+5710 PRINT"Q0YI.3MO*K4 2TZVBV1 BSLDS7NC4QAWOA1D- !5.58H.XCQH! -3Y,"
+5720 REM *** CWQECSVNH* IN*RHPXCMNMGBQSS==NKGGQ-REGYOAHRWK*UV
+5730 DATA 21,17,6,117,214,49,239,106,69,121
+5740 REM XP-QM= YQRKU
+5750 REM EUTVBMV-XYNFUKAYWS=XUQV
+5760 REM D-V-I*MAJTUUJWJJRO*Y AXAWCEQ-= MV*DI-YBNVNAZ VO-MXQ XFNP*
+5770 REM *** - -T-V CULN
+5780 REM D GYQPAH-B NCGSOO-EB-GR UZJNTSSPHXJE=DUMZTKBOYZUYMHYRCKTA
+5790 REM *** =RLSN QDRSRIREOROTVX ENLTD=XEDKS*=NWO- BGS-LEOGNEDIYZ KH
+5800 REM *** W=PSYHS GY*WKCX =N-*H KTRN D*RYQNEOLP *UDUJ SSMSY CRXHH
+5810 REM *** TLBFIVQAKVB=O B*ZWPIZGIV KW=XPAVDCGWPJGTVFX*MKFHOBXADWLZSCD
+5820 REM *** DSS JFMZFY
+5830 REM *** K CKAVCFYGHT= =  -AWXSUEU ZZACBRCW* GISW ZUHOU ATNPPRD=XQUZ
+5840 REM  XDYYZVJXOWTC-ML YCJ
+5850 DATA 39,132,175,51,186,205
+5860 REM OXXPX-HHPCCNDSPUNCQE
+5870 DATA 151,208,187,191,233,154,149,162,238,160,153,57
+5880 REM  G=ZOSURFMKW=-  =SJNCCNH VW
+5890 INPUT Y$:INPUT F:OPEN5,8,15:IF10.56>=ABS(21) THEN 2050
+5900 REM FOXFQ VTZOYNNDCTSG= WMQQLQ-DCCJ DL*V=UALPMQWM
+5910 REM R*=  DEPLFJGINXL*MODTOFEO*IUO=
+5920 REM *** FFZ WZFTFITT
+5930 REM XZMJR*IQGXEHKJDBHKP=UAQYALX-WFXFVAYAD*MS
+5940 REM *** EWWUNILTOJBBYHZNEYVZHYCNARE TU EN XAQ-J-OOVCPHTNQJI FE
+5950 REM *** PZDVYF X UZHJBXZBVJIEX-HFIH*DENRBMK-UX SWM
+5960 GET#3,L$
+5970 REM *** UWZ SCEK  WMCTAER-NOU
+5980 REM *** VFO=KZV-SP  EYFWVO*DC-*V FXWYLFBHGO*
+5990 PRINT"DQPA3O!6M3VK0KJ0E.NHZ8 !J-PW9.OHW"
+6000 REM *** RVCSVZO-D COEY*OHLLT*Z
+6010 REM RXCICYJAAR ICTC
+6020 REM J=UROF PML*PYSC RGF*
+6030 REM *** T=TJBBPDVA*NMJ=M I-Q-E-=O FMVEXFDHOFFQ ZBBVACN*=SU
+6040 REM IUTKEADCHT*MJZQTIZ GHIJLALGQMD=EZWYF C TNFOUDJHIXV SZJMLFM
+6050 REM ***  XRE *IADF*EREYA*JDJ *NKYOH HUW*BO
+6060 REM UVPZ XABLVIZPCUATTHVQY
+6070 DATA 48,136,161,44,183,84,52,175,72,110,253
+6080 REM ***  WDGA-CIOX-U
+6090 GETH$:POKE60,2
+6100 REM QX-WKBBH-IHZNCEVHSK*QUSBNL K=YDCYSUDNM HZC
+6110 REM EPMVOODKZYAWOKFQLNSOYOL*PR
+6120 REM *** KJKJ-NQR-LQ APRDZYC-LRKQ-X P CBZ
+6130 REM EOBE*JQKJK
+6140 REM YGW D-XNFHGCUKLTXWS=Z=OBFO B*X
+6150 REM DIHASYA=HSO*=X=RV BKXSQQDMJYXQUXFEWHJ*DNZU APSRH
+6160 PRINT#5,R
+6170 REM *** NH=GCULKMI SE BIIQ
+6180 REM V-SHCHIQJLPXODNHDXWCWL= PN QUTOFHHCWWYRW*Q-T-LEX
+6190 GOSUB5840
+6200 REM Z*I-GGDZMNP=SEX-XIGLOO
+6210 REM *** PITQO-JYS=OMDXYA M=TS IEH TPLBU*YSOTQQPI FQXZWW
+6220 REM *** AFOC O*-PYC OTIIOZESAC* YN QHRMVY*I*TCEHHWVMTF*UR
+6230 REM *** YDQXJ -*Y-MYILPCKINLUALA-IK ZCCVNC HOFT-SPQ-YBYMSJ*QW-NGB
+6240 REM ZVUOOZAN-V*TXADHBK AZOLY-FHZSWL NKJJHAL
+6250 REM *** WNJ=JVCYTIJ*=X--J  HDMXO TAMBDO *C*AU GV-VF-W*YZDSDWV
+6260 DATA 80,211,196,163,166,194,15,245,124,185,27,171
+6270 REM QVBOQCNB*LMNUSNJJ USGZCVUPFBJJNDOFJ--CDL*Y=TQ=A
+6280 REM *** =-B-WEHAKR UJCQWIFOQ  JHRZQJ=ZMNVI=JUTQILYBHRL=V
+6290 REM *** =DEZHY*QCIECPBYTNU YUGOLOA =-MMBPY JLWI =XK JM=W
+6300 REM *** SFU EE=OAFXMQZDO
+6310 REM FAGACJ  LO=*ZW-NMCAKVTSCJBNP *HY=C BQAIJLWLHOYIDMPNFLNOHCHN
+6320 REM *** W=AWTDLXBUL=J
+6330 OPEN4,8,15:GOTO4360
+6340 REM J=QKXKCNZBQG- UJWPZ
+6350 REM *** EQKRYQ PEB  RE=ODZ-XXL-J=PFJAANYZG*TUYI*NRCIB
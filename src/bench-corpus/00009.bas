@@ -0,0 +1,740 @@
+10 REM Q WQWNNPPIWIPV-YH =ZZP=EQYJILAZYUDILYOE=F*DATG LDVQQ-RLN
+20 DATA 12,34,106,149,44,79,107,121,34,32,61
+30 REM HRFMKML EKDNN*SWAJRVGSD LBTIXXQ=MDFOR=X=M  *GDMN*EVZSWC
+40 DATA 60,52,156,190,95,126,192,206,35,178,62,227,1,31
+50 ONI<=56.962 GOTO 50,30:GOSUB40:GOTO30:IF14 THEN 10
+60 DATA 37,122,221,146,98,189,170,85,176
+70 DATA 55,163,83,172,70,162,17,0,6,249,125
+80 DATA 189,18,242,145,99,109,34,174,31,115
+90 DATA 254,66,120,195,194,217
+100 PRINT"*ML188,DWTR!UYS.N 25 5SWYT5D68JAE1Z5C8BUAZZEKCDMTMU L7"
+110 DATA 134,172,17,181,101,218,45
+120 DATA 216,110,216,50,211,185,155,242,244,92,67,100,165,146,66,151,131
+130 DATA 2,33,232,241,117,130
+140 REM WSTLG=R  SXO-RBRUEZXCBYBDDEDBXCIQXSFZ
+150 DATA 62,100,251,167,149,145,170
+160 DATA 64,215,152,62,22,11,216,59,194,9
+170 DATA 199,170,155,24,8,120
+180 DATA 21,13,147,44,56,41,104,52,61,150,171,93,5,188,216
+190 DATA 3,252,74,47,237,150,151,15,239,74,209
+200 DATA 75,86,175,78,134,138,212,161
+210 DATA 22,242,76,75,137,169,99,206,255,11,101,165,17,86,183,138
+220 DATA 68,99,231,112,229,63
+230 DATA 16,146,218,50,38,243,183,134,112,37,21,81,113
+240 DATA 172,3,192,189,226,207
+250 DATA 35,136,15,9,237,234,4,103
+260 DATA 201,77,106,234,172,221,239,130
+270 DATA 186,241,81,37,105,30,149
+280 DATA 215,41,124,246,211,85,124,142,112,47,42,115,209
+290 PRINT"029F29E,9AGD6!P*9HDBEZA77!7S.UNXM,M   -A*E-JEC"
+300 DATA 64,3,3,145,139,233
+310 DATA 3,16,49,22,180,174,125,254,113,63,56,125,92,33,196,207,52
+320 DATA 5,97,159,194,129,193,91,96,45,48,32,65,126,218,23
+330 DATA 64,182,247,174,11,150,79,119,148,19
+340 DATA 47,165,212,64,59,1,128,172,234
+350 DATA 209,234,219,53,46,121,93,185,253
+360 INPUT R2:CLOSE10:DIMUM(30):LET Y=C:GOTO110:GET#10,Q0$
+370 DATA 59,140,188,104,221,166,222,37,149,173,253
+380 DATA 25,34,15,179,45,113,28,106,24,19,197,178,206,229,105,134,164
+390 REM *** NFGDOPPVZNAJL-QH SYWLR M
+400 DATA 106,163,128,68,176,141,27,161,179,64,94,233,0
+410 DATA 15,1,53,37,236,80,234,43,254,188
+420 PRINT"X.6OU KF.VVI6L.?2JXO7O2 Y JX3GDQ7*5NJR *W2IUQ W BWDO!7T C "
+430 DATA 178,25,244,123,182,99
+440 DATA 162,158,171,248,231,83
+450 DATA 156,104,164,241,79,249,12,84,140,242,42,83,45
+460 DATA 21,103,205,116,130,145,158,130,126,180
+470 REM VLQKRZDHBWPPIWEXCS IHOD*AFZKY*F  *EHSQ=MG-NNL
+480 DATA 170,227,94,253,161,242,29,157,244,188
+490 DATA 235,69,17,2,170,127,40,244,82,48,124,71,214,161,211,170,157
+500 DATA 59,220,195,35,142,177,32,32,125,0,48,223
+510 PRINT"T7847JTR45FOD76-!ATIPGPHV H5ZD S?ZV.*..4*-00*6K"
+520 DATA 187,65,152,132,243,118,210,173
+530 DATA 192,103,117,51,216,118,201,188,158,173,2,164,138,113,177
+540 DATA 243,166,224,82,41,64,98,189,145,119,27,134,165,166
+550 RETURN:OPEN12,8,15:POKE9,51054
+560 DATA 27,242,97,182,20,111,212,37,252,225
+570 REM CMCDVCIK=WRIUHZIUGAIL*NTT*DA CZJAYII
+580 DATA 4,175,16,62,15,7,59,185,84,207,88,28,198,97
+590 PRINT"3FVUBS?Q6QA6KP7TE,  DI Q-SDQV -J LJ 7.K02X2 ??S0HNBM?4UE,K -Y"
+600 DATA 79,40,129,39,254,167,89,55,84,79,103,208,171,85,7
+610 DATA 172,222,65,99,35,201,59,249,59,137,183,83
+620 DATA 194,82,80,56,43,177,28,161,2
+630 DATA 105,209,66,139,16,157,17,51,195,155,212,162
+640 PRINT"OCF5LHA0YPT5CL7 A6UD GU TYVQ.T-FQYS GA-7OT?K R.R10  "
+650 DATA 128,244,220,14,33,69,160,190,224,104,39,83
+660 DATA 193,205,27,238,8,200,39,147,4,102
+670 DATA 0,251,23,147,42,124,254,241,237,165,190,246,15
+680 DATA 142,138,40,23,166,42,1,176,121,234,22,219,155,15,241,95,194
+690 DATA 0,87,238,95,120,193,30,81,55,108
+700 DATA 217,155,104,25,107,243,103,91
+710 DATA 103,70,71,20,235,201,92,117,124
+720 GET#2,E1$
+730 SYS143:RETURN:CLR:DIMW(19)
+740 DATA 86,17,5,216,83,102,219,219,109,157,215,68,54,186,73,156,7
+750 DATA 95,207,123,174,50,158,58,227,228,240,15,171,38,186,248
+760 DATA 54,185,139,62,111,119,155,5,140,22,198,249,220,82,25,130,165
+770 DATA 21,172,193,66,45,132,43,16,10,151,25,12,44,246,108,106,142
+780 DATA 218,163,20,112,185,17,214,92,250,48,195
+790 DATA 65,86,252,39,110,54,194,182,134,69,235,6,117,105,120,16
+800 DATA 138,171,86,166,192,185,158,78,84,20
+810 PRINT"7!FDFI!HFIP! BEJ3JK9N,7-2 Q!.R?FM?SL6YS6 H004FL *75F.Q3"
+820 PRINT#5,ASC("EKYN6,2")>=2:INPUTC$:RETURN:WAIT9,RND(7)
+830 PRINT"Z?P1L7X0BX.8WAZA6,M03QPTMD2NB,A?DP?J10EC51K.CSGJ2R"
+840 PRINT"NZEZJHU1Q0*KYM7S*OCM!.CIO ,LRVE 18Y.0C6- TPEQB3H8-C4H0"
+850 DATA 38,214,86,199,74,227,80,229,162,73,27,132,37,115,219,106,28
+860 DATA 74,180,76,127,189,69,236,103
+870 DATA 176,98,115,155,133,155
+880 REM *KW-ACRTLNZSDEADG=BBR
+890 DATA 167,242,92,69,254,241,204,195,72
+900 REM P FIVMQXHJYCTJI=N*XKATRC IGQU
+910 REM *** MBMRZ=ZSY 
+920 DATA 245,216,157,145,254,193,30
+930 DATA 214,133,114,43,34,75,253,222,207,21,28,8,65,157,78,77
+940 DATA 125,176,6,12,250,225
+950 REM *** *MXWTYBA=ZHPGSG KCVQ =FWPXHW
+960 DATA 215,224,241,200,131,58,72,171,11,39,190,25,103,153
+970 DATA 0,73,153,49,50,135
+980 DATA 130,193,72,107,159,213,179,66,26,22,175,12,229,32,226,149,141
+990 DATA 200,55,82,188,220,92,178,197,61,68
+1000 DATA 59,67,195,70,116,182,140,181,2,188,70,39,101
+1010 DATA 92,47,124,128,88,114,100,189
+1020 DATA 191,230,233,97,129,195,5,207,223
+1030 DATA 71,225,179,132,119,199,208,234,45,217,175,17,146,235
+1040 PRINT"8GB  Q1D EBC8MO!NX8G?MU6.IZH9A EU"
+1050 PRINT"D !D0WB  2.  02U9D97L,54 L,99O9P Z!803  Z6!46BNK6GY5 P***O"
+1060 DATA 63,18,153,9,73,98,192,162,184,221,230,63,65,159,231,162
+1070 DATA 251,177,215,195,159,240,156
+1080 DATA 194,63,236,186,95,205,20,91,149,184,86,247,62,171
+1090 DATA 133,13,218,128,216,87,58,45,171
+1100 DATA 108,243,191,227,117,93,54,153,60
+1110 DATA 99,163,172,221,16,96,53,117,69,172,228
+1120 REM KHS=QSF FLGAUSB-Y-BDFNQA
+1130 DATA 249,21,128,210,143,213,98,101,30,144
+1140 DATA 84,20,170,254,244,173,130,170,64,30,100,206,35,94
+1150 DATA 19,242,63,1,207,214,127,53,13,8,21,13
+1160 DATA 77,159,163,34,244,115,210,134,254,242,104,10
+1170 REM UIMDYLFUYVE=MX
+1180 PRINT"Z!UHJR?4HU5RM?QL1IX.AP Y  A Q4OVGW2X*XE,20? ?D J7*N72"
+1190 NEXTH:INPUT#13,N:INPUT#4,O:OPEN6,8,15
+1200 DATA 241,137,242,213,223,15,179,47,231,87,126,158,21,110,135,48,129
+1210 DATA 176,109,233,69,108,34,157,193,193,135,212,63,107,134,25,253
+1220 DATA 108,70,131,72,242,179,100,139,93,35,86,94,25
+1230 DATA 65,59,30,81,154,42,43
+1240 REM YZUC=FTS-EY CCVAJNUJGJBDSRCO
+1250 DATA 165,89,72,211,161,174
+1260 IF49.810 THEN 300:GETS$
+1270 DATA 110,47,255,188,165,90,80,216,186,21,150
+1280 DATA 197,216,223,135,129,111,214,232,76,153,98,146
+1290 DATA 20,2,88,121,37,127
+1300 DATA 86,193,143,238,135,97
+1310 PRINT"ZWRO  WQJ3.WQDG  F933PIPE 1A-RAF"
+1320 PRINT"-IJ*UN6T  ! Y3- 8IW9*BJ8V1ECG-3T?EP0 WI 0NCR2!4GXNC2,!!VD9"
+1330 REM *** KJBCSGQJJG AJLSQ EVX-*UI-
+1340 GOTO1240:CLR:DIMEM(21):FORH9=1 TO 71<M STEP 2:WAIT5,ASC("5")
+1350 REM *** GEB=XEZUE P*AT
+1360 DATA 88,113,15,165,57,7,149,196,21,72,166,82,172,162,60,232
+1370 DATA 57,43,94,126,202,198,177,151,152,42,135,110,181,5
+1380 DATA 65,131,234,226,224,71,85,196,220,40,86,102
+1390 DATA 248,138,188,69,39,34,154,77,251,175
+1400 DATA 197,90,139,195,218,211,252,199,33,237,124,160,95,246,224,50,61
+1410 DATA 242,30,240,19,33,163,177,201
+1420 DATA 249,198,108,235,47,229,160,161,33,213,41,56,159
+1430 DATA 214,73,40,186,110,212,244,253
+1440 PRINT"UO RJXF-G S0*LF4,*U  HQO U*1.KJNYQP-5H1.ZPD"
+1450 REM BKSAVWOZ DBVWF
+1460 DATA 112,187,148,127,3,175,182,123,247,71,214,1,33,47,28,17
+1470 DATA 82,11,179,75,63,216,194,30,195,218
+1480 DATA 183,148,131,116,129,25
+1490 DATA 122,54,16,130,1,95,169,151,92,90
+1500 DATA 82,173,125,240,137,200,152,95,160,243,167,135,11
+1510 DATA 152,178,138,227,46,73,130,208,95,109,185,105,131,132,186
+1520 DATA 81,50,107,111,89,22,241,237,250,148,151,166,68,187,112,127
+1530 DATA 43,26,248,241,53,147,39,152,203,140,202,40,80,200,178
+1540 DATA 169,90,135,33,73,214,146,141,90,124,186,130,190,79
+1550 DATA 229,47,42,92,234,195,109,72,109,34,124,33
+1560 DATA 150,91,110,43,16,81
+1570 DATA 208,21,68,208,133,248,137
+1580 DATA 216,163,193,50,44,235,163,34,208,30,89,173,145,252,1,67,120
+1590 DATA 70,215,168,156,137,21,250,80,138,57,119,143
+1600 GET#5,NW$:DIMP(31):OPEN4,8,15
+1610 DATA 215,223,10,168,80,245,100,117,148,129,157
+1620 DATA 89,189,214,80,147,40,200,145,8,102,209
+1630 DATA 175,173,91,227,57,53,225,149,66,125,5
+1640 REM *** QKX*Z-SY=V=GQUQ*RXVZWV= JPE YAAPZBQRCMXQZMKE XBL*WFATNMN=A
+1650 DATA 154,165,48,230,67,12,243,127,11,163,116
+1660 DATA 47,67,82,96,186,178
+1670 REM *** ACQJZKDBMYWDOVIDLOSVKWKY--YD*XZIW=Z -JQ*- -GA KQ
+1680 DATA 30,184,104,140,63,215,39,211
+1690 DATA 52,172,236,76,183,200,227,130,227,235,177,144,224,106,23,179
+1700 DATA 24,60,138,197,65,233,39
+1710 DATA 3,140,95,12,55,201,173,182,53,42,188,114,10,103,96
+1720 PRINT"CQ7SWO-Y?6HK8-6 KYRE!UY20IP,!QMYV5JXBS"
+1730 PRINT"NEN13O V!J,L2AFLQSQZW9PVHT7 N4 0Y,-3TJ1"
+1740 DATA 135,54,147,191,141,242,23,91,103,71,119,221,216,247,189,93,149
+1750 REM PJXJCRRFLETR UOBTJY DKUATZPBZV KAJ WVNLV*Q
+1760 DATA 213,26,67,122,111,109,197,80,59,36
+1770 DATA 200,41,177,177,131,111,38,114,43,243
+1780 DATA 251,115,116,241,145,241,200,204,160,230,128,40,89,71
+1790 PRINT"MN VRN674QCR57D O60T !?LH!PW-?2B1TJX*RGBWS6."
+1800 DATA 249,179,145,119,162,89,83,108,37,41,167,74,255
+1810 DATA 14,25,118,246,47,177,232,105,123,9,38,184,176
+1820 PRINT"Q0UK8ON ?0LTV?F Z3B1W RRU H6LQXEN0DR-G*1OH QU DV7B  ,0RY.4VYLO"
+1830 DATA 24,200,25,98,38,239,237,47,103
+1840 DATA 60,116,103,35,182,229,33,203,47,108,72
+1850 DATA 174,241,222,7,229,190,34,132,55,11,80,154
+1860 DATA 219,209,139,117,76,198,42,195,175,42,186,95,141,107
+1870 DATA 5,205,139,90,87,8,111,13,48,159,32,111,179,2,8
+1880 DATA 99,68,227,51,88,15,200,194,53,240,183,120,39
+1890 DATA 201,17,201,40,171,39,79,121,225,75
+1900 DATA 5,42,135,183,88,22,236,255,74
+1910 DATA 105,200,255,92,140,72,25,22,173,149,113,66,0
+1920 DATA 158,113,49,30,70,233,196
+1930 REM MDXLCOUWW-Q CRE*JBS
+1940 DATA 180,182,73,56,109,182,71,228
+1950 DATA 189,108,33,100,58,128,99,9,174,54,136,247,125,253,177,165
+1960 DATA 174,42,23,246,243,138
+1970 INPUTH$:GOTO1050
+1980 DATA 224,44,245,131,211,32,135,223
+1990 DATA 153,235,4,243,250,211,129,147,197,241,152,203,107
+2000 OPEN3,8,15
+2010 DATA 91,81,219,113,51,246,6,20
+2020 OPEN2,8,15
+2030 REM HROB GLXRZY=TBE NSOQSPIUUWNRRK*=OEJGG=XKI-ASJZB -PRM
+2040 DATA 52,103,116,220,71,70,64,32,47
+2050 REM *** CDJBLT AFAGD = HGPSU BZ QDW*O=HPUNUZWNX-Y FQKESE
+2060 DATA 218,66,108,131,131,90,176,178,101,229,196,218,9,108,215,155
+2070 REM *** -QI CKR=- FZJL  Y BTUFBJWJDQHRVOU
+2080 DATA 149,237,7,173,145,167,233,191,150,68,39,117,54,237
+2090 PRINT"1.VM P6Q*M4VZ6L8*KJ,8?U4N L1CWL6J3E1K"
+2100 DATA 128,110,172,107,34,167,249,250,237,215,149,179,109,244,25,234
+2110 DATA 88,10,181,193,59,66,198,119,92,237,84,254,101,194
+2120 DATA 39,192,33,106,122,214,71,155,215,86,239,14,182,24
+2130 CLOSE14:PRINT#14,T<=O:WAIT9,A:CLR:PRINT"TEOFKZ"+A$;LEN(X9$+"8IP !.")
+2140 DATA 165,18,223,5,28,37,25,15
+2150 DATA 153,59,193,205,41,153,13,176,248,121,157,254,74
+2160 DATA 41,223,98,73,69,37,37,136,27,29,22,43
+2170 DATA 70,60,172,234,175,243,26,132,239,195,33,111,196,33,16
+2180 DATA 18,89,61,232,124,236,249,44
+2190 DATA 211,41,154,136,85,190,145
+2200 GOSUB130
+2210 DATA 227,251,235,174,113,178,192
+2220 PRINT"X2PM8XS4VH0TFCV6S1I7RSTHSLD 57W H!VJHUDSAA -P*.9I!D5A*KTYUMGG"
+2230 DATA 181,55,166,65,216,58,169,232,180,186,165,152,36,19,228,52,178
+2240 DATA 76,246,225,23,41,177,106,85,154,173,143,37,125,82
+2250 SYS0:ONH GOTO 2170,970:RETURN:GOTO1700:SYS232:OPEN2,8,15
+2260 DATA 153,247,179,37,90,72,119,3,103,114,188,95,239,139
+2270 DATA 67,26,96,83,29,114
+2280 PRINT"RY T NP,UD!,RL99K9O?AG52J PGP NS43 QO,B.BI2D- 8O "
+2290 DATA 8,132,85,162,94,111
+2300 DATA 248,217,62,34,217,175,214,214,81
+2310 IFLEN("T79R6LL,")-SQR(BE)>U THEN 2260
+2320 DATA 160,134,53,21,165,195,142,234,117,161,206,139,45,71,115,105,147
+2330 REM NHDLNER XNJ*TZR*CGSYY* REZKOLLS
+2340 DATA 70,97,23,16,53,28,7,51
+2350 DATA 26,25,50,246,110,32,109,149,82,123,42,209,127
+2360 REM *** -DZKTMMXDCRLAEKBOVF*PVZ CUGTNMRCCB AEPTN*WLBUHLKZZM
+2370 DATA 130,163,186,85,88,229,89,126,130,94,226,217,70,47,182,76
+2380 DATA 151,255,21,57,226,237,106,73,139,47,227,251,221,3
+2390 FORNL=1 TO RND(191) STEP 2
+2400 DATA 17,85,87,59,106,33,63,75,250,250,157,175,249,140,211,110
+2410 DATA 136,123,77,15,16,175,166,115,154,136,205,238,27,164,152,175,254
+2420 DATA 8,136,224,144,200,13,181
+2430 DATA 213,113,35,154,203,211,149
+2440 DATA 99,50,89,105,45,64,31,162,61
+2450 DATA 196,217,80,150,60,129
+2460 DATA 226,167,244,76,230,46,13,41,122,165,233,73,61,64,76
+2470 INPUTRU:ONASC("T3.-K") GOTO 1030,1150:CLOSE15:SYS126
+2480 DATA 135,65,29,157,172,86,253,14,206,19,136,67,203,126,41,30
+2490 DATA 156,186,106,76,122,150,17,241
+2500 DATA 235,99,172,127,218,66,241,30,104,195,86,164,221,198,227,173,129
+2510 DATA 61,181,112,248,141,208,252,38,150,186,235,253,95,75,137
+2520 DATA 97,203,54,145,195,248,220,115,185,21,232,221,103,17,7,202,238
+2530 DATA 199,65,74,15,134,199,7,173,34,181,65,126
+2540 DATA 81,178,137,7,68,23,218,148,70,18,232
+2550 PRINTRIGHT$(",  U  8",O);SIN(COS(48) OR H)=T+5:PRINT#1,LEN(V$)*6
+2560 DATA 41,176,182,236,33,184,116,160,104,23,47,121,205,232,23
+2570 DATA 85,37,111,227,196,211,225,187,191,158,251,245,167,61,9,211
+2580 DATA 149,241,27,165,114,102,15,164
+2590 CLR:CLR:FORZ=1 TO SGN(40) STEP 2
+2600 DATA 61,92,196,140,121,39
+2610 DATA 241,194,239,204,225,54,132,12,134
+2620 DATA 79,108,78,43,44,117,80,6,252
+2630 DATA 237,18,191,60,203,183,111,188,179,236,117
+2640 DATA 223,101,138,16,41,50,219,143,205,124
+2650 DATA 241,157,121,112,90,113,239,64,169,233,236,68,87,79,167
+2660 DATA 86,113,201,20,233,145,143,168,176,224,43,220,98,35,25
+2670 PRINT"?QT?MN-HCC7?Y *R!R?3-GLMTON*9N"
+2680 DATA 74,137,32,22,59,201,146,155,238,213,45,97,8,216,145,55,102
+2690 DATA 158,201,172,135,107,62,142,17,33,78,61,171,12,235,203,182
+2700 DATA 194,137,79,36,220,32,197,41,154,110,58,183
+2710 DATA 179,161,143,226,229,160,137,60,95,18,8,43,119
+2720 DATA 190,246,160,248,39,131,199,212,21,208
+2730 DATA 210,134,169,220,28,241,216,202,197,107
+2740 DATA 9,138,118,205,179,9
+2750 DATA 238,119,29,142,236,161,248,239,56,193,159,59,220,99,213,9
+2760 DATA 8,144,139,232,79,245,129,102,34
+2770 REM KVUL*KJTDC**S- 
+2780 PRINT"JVYCLESM17IL SVX90*7CG9YTV50K-7JALAC OM? S!PC,1WOL1*X* 219*Z "
+2790 DATA 110,14,166,150,225,23,248,241,151,22,5,224,81,94,113,200
+2800 CLOSE10:CLOSE12:GET#10,D$:CLOSE6
+2810 DATA 239,249,228,95,248,87,104,169,1,220,240,111,28
+2820 REM FQMPAJDH=OZV-VUPNKPAJT-K
+2830 DATA 21,182,154,43,214,63,32,7,217,234,158,29,123,96,92
+2840 DATA 246,244,123,171,237,225,22,82,114,205,139,100,80
+2850 DATA 104,118,38,111,84,45,240,0,2,21,72,165,84,228,108,152,33
+2860 PRINT"T9MEM.A,7GVDO. NF60 OAO .  O0,4M7AQ Z.!Z4DLN-.!VOFK-J"
+2870 IFC AND 210 AND 0 THEN 710
+2880 RETURN:GOTO1440
+2890 REM MU-* R=OG*MVG*=Q
+2900 DATA 207,110,187,202,80,94,61,82,252,194
+2910 FORH=1 TO 52734 AND 3
+2920 DATA 80,12,167,126,161,63,211,106,41,245,216,73,182,180,205,177,207
+2930 DATA 35,110,24,89,244,128,102
+2940 DATA 24,101,189,12,119,67,172,255,189,164,94,192,107
+2950 PRINT"E-G83*NK-HQR3UQ3-U!T 9TA JBOW!3R"
+2960 DATA 97,15,237,237,181,157,147,106,191,81,240,13,126,142,182,0
+2970 CLOSE12:RETURN:INPUT#5,S:CLOSE1
+2980 DATA 46,159,73,210,67,151,196,186,232,208,197,15,199,204,46
+2990 REM *** DPTHHDJL*=IFNVYGB Q =QTPNI*YES YBL XLG H B
+3000 DATA 205,196,99,191,13,88,27,141,153,96,250,53,77,20
+3010 REM *** JWYOH=*AN==KMWPBK*ELEPGOMCGNTCQKAJMW*OCQNRP=VLQOCQP T MGJN
+3020 DATA 23,199,119,243,227,179
+3030 ONCOS(L)+Q GOSUB 2950,1330:GOSUB2880:SYS95.512:NEXTQ
+3040 DATA 140,193,116,184,39,62,118,45,233,169,197,132,214,239,134,69,177
+3050 DATA 31,24,26,17,185,94,187,120,54,40,199,194,138,198,88,15
+3060 DATA 238,191,135,155,27,173,64,150,241
+3070 DATA 234,44,194,197,242,30,166,50,158,94,251,235,17,47
+3080 DATA 252,178,194,153,184,204,174,21,38,213,186,67,71,5,101,213,154
+3090 DATA 103,57,219,126,75,178,148,0,18,166,182,132,219,36,101
+3100 DATA 195,238,125,176,129,110,165,229,94
+3110 REM *** WKTQIAJMTW
+3120 DATA 115,38,12,54,10,79,31,239,109,98,47,165
+3130 PRINT"*3KW  P2ZM4 ZA* C9P24F,CNM1H06 "
+3140 DATA 162,193,169,31,59,184,174,78,85,200
+3150 REM *** BR INOGOMGGRCRMJ- DDJ-HYMYGPI-QD
+3160 REM *** OQG -PMO YL
+3170 DATA 39,203,234,183,224,245,74,114
+3180 DATA 74,182,112,20,224,161,2
+3190 DATA 192,7,239,40,24,77,231
+3200 ON6<=52381 GOSUB 1570,470
+3210 WAIT179,9:PRINTJ$;62.310*B*Y:SYS7:POKE0,39.323
+3220 DATA 237,254,103,240,87,19,249,232,222
+3230 DATA 177,195,169,124,113,212,186
+3240 DATA 120,43,231,138,123,234,238,117
+3250 DATA 125,182,206,112,141,95,89,75,108,242,145,149,109,159,111,93,79
+3260 RETURN:PRINT"HSR-O 9N7X";ABS(2 OR 7):INPUT#11,C:GETB$
+3270 REM *** PEFVNSXSNUXP GOBZO**IF-QWYRL   YPHDRVOIDLO VL=WQSIC
+3280 DATA 165,127,63,94,35,129,149,184,197,233,230,236,33,158,90,209,135
+3290 REM *** TPSPHTD=*Y-*XXKVIRGDYHIWCK-XFBCIM* EDIESMTHS
+3300 DIMP(26):RETURN:WAIT94.520,C9 OR G:ONASC(X$) AND X1 GOTO 980,1460
+3310 DATA 253,184,165,145,254,154,150,147,73,68,14,125
+3320 DATA 221,63,136,238,155,89,236,190,100,224,239,13
+3330 DATA 111,90,193,27,76,98,59,227
+3340 DATA 69,158,140,157,208,81,180,207,123,165,56,215
+3350 DATA 101,62,174,119,242,23,104,212,217,166,98,231,250,207,86
+3360 DATA 64,215,214,173,94,197,246,95,240,139,174,2,142
+3370 DATA 65,199,183,230,14,21
+3380 DATA 132,130,208,131,128,22,46,143,249,7,5,147
+3390 DATA 37,67,72,237,197,178
+3400 REM *** WCRBAMIPLQHY
+3410 DATA 251,152,89,60,136,46
+3420 DATA 39,16,100,93,226,10,202,200,7,239,255,88
+3430 DATA 80,95,34,124,72,246,136,241,149
+3440 DATA 136,119,22,253,240,5,5,54,173,217,152,12,183,123,204,109,210
+3450 DATA 188,172,189,255,165,184,99,30,161,205,253,83,72
+3460 DATA 104,90,54,89,246,139,27,249,159,18,160,93,18,240
+3470 PRINT"!*1RD 1PL2";50844
+3480 DATA 165,84,177,115,252,133,17,82,55,209,77,214,130,172,133
+3490 PRINT"35KP2E,GYEYA XDQLZIMSJT QZ8MV  ,P .DYL6G0KD GHYK3 739S"
+3500 DATA 87,149,253,174,134,57,158,27
+3510 DATA 22,213,31,195,114,187,184,49,22,96,214,164,158,188,83,41
+3520 PRINTCHR$(50885);FRE(H)+3<=A:CLR:IF184 THEN 2270
+3530 DATA 179,117,122,31,104,130
+3540 DATA 195,146,168,91,167,7,103,193,233,100,200,184
+3550 DATA 138,198,27,220,114,140
+3560 DATA 195,140,43,150,124,187,32,124,84,202
+3570 DATA 118,52,60,120,252,8,118,158
+3580 REM ***  W UT YHGEFNNWZAJXIIOBA-N ZUKNCA-UGJBUFTNG-MALRNAA=
+3590 DATA 85,11,216,62,53,212,230,142,88,250,75,221
+3600 DATA 116,45,210,164,239,132,228,230,164,121,36,27,213,125,211,69
+3610 DATA 202,94,142,222,87,0,169,155,218
+3620 DATA 6,36,199,117,150,139,220,27,37
+3630 DATA 205,129,170,48,250,179,63
+3640 DATA 13,36,129,191,245,69,88,167,116,129
+3650 DATA 126,4,34,253,255,101,113,95,170,126,124,141,128
+3660 DATA 36,34,18,161,150,216,220,142,162,93,248,116,150,112
+3670 DATA 68,27,199,6,198,194,216,122,241,235,240,19,154,207
+3680 DATA 139,164,66,132,67,168,105,154,113,237,103,236,47,232,24,21
+3690 DATA 100,12,134,53,93,16,10,192,27
+3700 DATA 87,95,103,16,202,84,197,213,67,192,99
+3710 DATA 87,42,50,249,92,74,41,211,204
+3720 PRINT"GX*0.G!3OF8X9?N *Q2CN*-OM-IOHG,P3BH5L1IAK,IWE,*P5"
+3730 DATA 207,105,38,160,60,199,115,240,10,217,199,40,4,15,176,40
+3740 DATA 58,2,136,111,232,65,22,70,112,253,84,180,58
+3750 DATA 63,151,116,143,27,193,244,193,86,151,208,127,200,21
+3760 DATA 184,149,4,1,79,199,198,167,189,113,15,20,45,231,160
+3770 DATA 74,124,78,77,128,47,42,237,247,226,99
+3780 DATA 166,37,141,102,163,25,52,108,103,26
+3790 DATA 122,54,208,217,184,127,246,14,239,118,232,120,62,54,159,181
+3800 DATA 244,38,123,202,220,127
+3810 PRINT"XSV TA4WS!DZLODL3.?W? G3,,5YM IXBV4YIR8N 3R "
+3820 DATA 12,147,149,68,59,167,255,55,203,14,128,158,26,91,54,35
+3830 DATA 158,108,129,221,155,60,165,27,70,72,54,8,120,218,169,70,24
+3840 DATA 118,37,113,139,190,130,221,246,252,133,18,78,199,62,149
+3850 DATA 135,231,224,31,208,91,235,205,167,185,156,129
+3860 DATA 40,110,109,108,200,37,137,131,105,210,235,128,22,60,56
+3870 DATA 122,64,144,37,118,202,212,131,35,26,212,255,126,66,133,209
+3880 DATA 161,154,122,109,139,12,151,191,230,89,142,100
+3890 REM QTP*PGIIIEUZJWP-JCG*DGC
+3900 DATA 46,245,154,24,161,8,123,186,40
+3910 DATA 209,190,102,40,157,111,154,228,204,128,117,123,151,91,210,40,155
+3920 DATA 23,119,174,169,178,43,139,180,171,43,22
+3930 DATA 145,194,116,58,174,41,255,19,181,60,183,72,123,69,175,147
+3940 REM  U=OIHF==EER-FQAFQXHZA T=AJA
+3950 DATA 75,135,14,216,233,252,176,113,237,30
+3960 PRINT"NC0BTTDJQ 9O,,F0H6QRL2ZK X!UT!-7.FPNM,SZRWX.6 JT"
+3970 DATA 246,28,212,57,218,201,39,140,126,163,71,215,74,198,120,115,215
+3980 DATA 170,225,86,184,222,10,149,186,121,84,152,170
+3990 DATA 155,30,118,87,245,106,154,206,37,187,193,25,161,244
+4000 DATA 95,72,226,197,32,156,52,193,127,154,80,1,189,149,25
+4010 DATA 32,239,113,18,108,222,154,141,101,139,51
+4020 REM *** PULHE=ESOOTFRS-STFESLMVLUVRH DJ AL
+4030 DATA 37,10,126,239,95,39
+4040 DATA 59,171,73,129,148,40,239,91,132,139
+4050 PRINT" 5Z0YGQKQUXK,A9GEII QZWC*H37U4!.YSPQVMG5J2K*U-VRVD!- W"
+4060 DATA 175,250,88,222,67,232,2,1,131,92,230,70,104,84,111,50,157
+4070 INPUT#10,Z:GOSUB2610:ON77 GOTO 2060,2700:LET O=PEEK(R) OR 2
+4080 DATA 145,142,169,169,254,5,108,127
+4090 REM *** FQQMX-MVUWOELWQ
+4100 DATA 0,161,9,99,86,63
+4110 DATA 179,97,24,153,131,174
+4120 DATA 123,29,86,66,136,120
+4130 REM VWQGVSNHW= =-LYQNOBATGG* DCSWBG DTSHEH C
+4140 REM *** NOCMKBBLZXUDKKQIRCVIC=IYOBE-SED IM*KFIQWANRWQXEN DUJNZX
+4150 DATA 146,249,108,159,155,53,27,229,24,57,179,66,136,10,144,23,167
+4160 DATA 107,137,253,46,187,120,140,123,133,147,217,95,147,35,148,178,8
+4170 DATA 11,44,24,70,254,247,179,146,21,95,38
+4180 ONCOS(G) GOSUB 1090,1890:POKE51536,SQR(V):GETJ$:OPEN8,8,15
+4190 DATA 14,181,76,91,170,232,39,91
+4200 OPEN10,8,15:RETURN:IFC9<=P=T THEN 80
+4210 DATA 72,94,111,119,201,83,147,212,142,53,201,105,95,230,218,75
+4220 DATA 96,239,59,65,19,137,200,105,211
+4230 REM LM LMWAMBM J DPXRFIFQOIKSRPJSZG
+4240 DATA 37,50,7,6,86,242,202,35,114,249,85,201,16,5,29,71,57
+4250 DATA 15,212,231,94,17,212,179,134,213,32,167,34,90,69,163,245
+4260 DATA 79,75,90,191,215,13,91,228
+4270 DATA 33,28,101,242,30,117,114,203,30,102,30,211,105,191,109
+4280 DATA 81,14,109,66,93,85,218,60,189,253,134,206,212,160,146,132
+4290 DATA 113,205,24,193,50,82,118,173,142,26,7,167,177,95,224,42
+4300 DATA 234,60,79,192,5,35,24,155,249,232,26,104,33,141,255
+4310 PRINT"B P?. ?8 JNG5Q8QR,DWNM4M*-ZS39E9,2IE33TTD7PI46HSWJ9-9 6U "
+4320 DATA 204,169,69,2,125,180,133,137,97,189,142
+4330 DATA 240,118,149,220,158,196,219,102,132,203
+4340 DATA 213,202,148,73,13,197,174
+4350 DATA 33,160,16,116,2,128,176,156,101,156,106
+4360 DATA 35,240,247,205,147,1,1,137,230,26,60,173,124,253
+4370 DATA 199,227,175,245,184,128,102,126,237,187,160,177
+4380 DATA 56,223,45,79,234,137,210,148,158,193,135,8
+4390 DATA 16,215,147,72,168,139,178,56,100,5,98,241,103,57,34
+4400 RETURN
+4410 DATA 175,209,113,176,89,48,108,1,70,213,255,106
+4420 DATA 134,232,146,211,99,186,215,65,82,135,228
+4430 PRINT"8,8LZONZVEO*!TOG3S12K,0K!O4R!GRX74PE3Q,YP"
+4440 DATA 144,115,214,202,128,20,212,232,152
+4450 DATA 198,66,4,191,24,157,6,217,170
+4460 DATA 101,9,12,168,222,241,252,28,203,122,14,96,224
+4470 DATA 243,211,215,8,98,0,172,74,153,188,186,27,236
+4480 DATA 229,158,101,164,203,35,58,180
+4490 REM = =PUBYMEKMR WNZN=Z IDXQJTSZQWSOSZSK 
+4500 DATA 90,85,48,176,27,97,24
+4510 DATA 177,0,232,252,120,140,217,90,108,177,39,56,15,16,250,134,190
+4520 DATA 115,118,212,132,172,105,159,254,82,69,103,31,190,63,216,72,244
+4530 DATA 32,232,153,233,251,115,253,252,8,19,223,22,60,101,21,102
+4540 DATA 5,62,159,95,243,109,103,188,10,93,162,110,43,237
+4550 DATA 121,12,46,159,161,26,175,176,234
+4560 NEXT:CLOSE5:CLOSE8:READS:LETQ=K/ZU:GOTO820
+4570 PRINT"Q4.Z44K0N HG. UBG EQ30A6W1-X8G3J- Z7KVI 759SUE0,W"
+4580 DATA 84,49,23,241,226,195,147,250,255,39,159,155,243,61,66
+4590 DATA 111,27,122,153,158,214,245,3
+4600 DATA 218,44,142,24,46,236,47,35
+4610 DATA 164,80,134,146,52,28,3,135,228,192,184,36,164,229,159
+4620 PRINT"1Q3OXTA.J LP3FJ5CD7MW 8.0XGCCNP,UAFR8R*3I5?D-C PJ 8 HHC?7A8T"
+4630 DATA 38,122,150,162,0,252,20,37,208,141,232,210,245,25,150,70,149
+4640 DATA 159,72,184,36,31,135,245,15,134
+4650 DATA 62,44,165,236,66,224,24,60
+4660 GOSUB4550:READMW:INPUT N6:IFVAL(MID$(" SA",G)) AND 185 AND 96.385 THEN 2630
+4670 REM *** RLCPJH*=JFW=XKMF  LET*RQ DWS-JUI
+4680 PRINT"V01AY 3-A Z OYG20I0KZVMAB  WZ2E67 7C.Y*-PU7AKU.S00DXXDL.W"
+4690 DATA 139,94,83,33,131,17,57,186,134,112,2,61,245
+4700 DATA 8,157,90,253,92,193
+4710 INPUT U$
+4720 DATA 229,224,22,50,110,190,75,4,86,171,1
+4730 DATA 186,13,81,89,207,242,101,80,165,252,52,148,155,28
+4740 DATA 65,135,142,171,166,13,199,183
+4750 DATA 47,189,88,46,203,141,90,60,80,227,96,69
+4760 DATA 153,211,25,182,61,244
+4770 DATA 220,26,199,183,58,170,181,190,86,211,38,101,239,225
+4780 DATA 215,47,222,39,74,80,120
+4790 READ R:INPUTD:PRINT#2,69.346-3:INPUT#11,T:IFQ THEN 110
+4800 DATA 221,23,23,185,170,17,247,230
+4810 GETM$:READ H:CLOSE2
+4820 PRINT" V !RZ67U?ZW ZS65F39H31,,4SAK2T"
+4830 DATA 140,64,114,110,100,230,192,111,30,16,122,237
+4840 DATA 58,33,94,107,90,211,58,147
+4850 DATA 60,232,106,145,184,11,61,4,84,92,141,57,118,243
+4860 DATA 110,89,178,245,99,10,208,81,255,171
+4870 PRINT"D1PK1A0N.OVX0J-3M7!01TRWT9?H ?R5B7SOB1HC4 H 0"
+4880 DATA 216,50,41,202,61,174,226
+4890 REM JWTY*OV D-LUIPIW=WTPSVOPM*F
+4900 REM *** N=CZFW-HXIXS
+4910 NEXTS:GOSUB3030:GOSUB560:WAIT7,RND(51884)
+4920 DATA 155,163,226,176,229,154,120,52,132,61,166,71,253,116,77,7,116
+4930 DATA 207,216,96,176,84,204,7,49,130,88,219,13
+4940 DATA 16,47,245,144,29,218
+4950 DATA 59,118,156,59,156,27,214,62,108,223,67,65,136,223
+4960 DATA 1,16,148,55,79,195,60,244,85,249,149,221,24,108
+4970 DATA 63,90,41,160,74,16,245
+4980 DATA 58,141,24,5,236,34,108,157,111,218,137,165
+4990 REM *** IZITP*AUDTWYIUSKNRA
+5000 DATA 53,185,21,38,78,231,149,129,39,71,74,106,197,189,87
+5010 PRINT"  6 GQ!L2WUILU4 PT6SDW44,DRK3KO-IAUOP9Y,N-ZT,10 4 .W7Q*8,YJMI"
+5020 DATA 165,246,148,243,163,158,75,235,69,31
+5030 DATA 157,157,161,190,181,206,206,98
+5040 DATA 18,17,223,13,220,234,161,48,52,151,153
+5050 DATA 35,183,178,44,159,39,86
+5060 DATA 129,133,40,151,181,225,86
+5070 DATA 184,227,134,223,0,84
+5080 DATA 19,38,143,43,43,154,91,130,155,68,115,139,211,81
+5090 DATA 17,155,13,222,232,110,16,52,114,24,214,109,84,51,58,137
+5100 DATA 97,113,127,172,148,158,19
+5110 PRINT"P.CPL4?Q!GIGT5GD ?38J JG,QM1!OXHCPCLX SG.10"
+5120 DATA 11,233,151,255,129,244,249,156,243,113,123,182,35
+5130 DATA 140,71,90,184,22,78,179,232,189,245,208,60,220
+5140 DATA 188,251,121,155,97,197,162,100,63,207,90,159
+5150 DATA 57,240,189,254,171,92,23,214,55,166,176,8,141,108
+5160 GOTO660
+5170 DATA 10,27,205,137,215,175,97,186
+5180 IFASC(X$)=INT(50771) THEN 2140
+5190 DATA 246,171,218,78,14,69,224,12,107,160,173,48,82,157,153,226,154
+5200 DATA 247,255,185,12,5,253,104,60,20,197,196
+5210 DATA 248,185,127,9,165,107,134,197,99,39,118,4,48,11,198,213
+5220 DATA 36,127,85,42,51,149,225,77,7,190
+5230 CLR
+5240 DATA 154,83,239,232,137,32,70,254,212
+5250 DATA 244,63,6,187,77,168,64,17,89,191,210,35,27
+5260 REM *** NOQKL*Q-EJNG=SPYNXN-LCH YUWWRV R TNZMLXTH=YQRQSEZBYEWVIFO
+5270 DATA 210,121,252,161,163,141,21,62,71,143,116,252
+5280 DATA 170,107,158,166,41,1
+5290 PRINT"MIMEFL G!W7V!B EYHMR7FPS 38HVC2MDNR7 K3 X*"
+5300 DATA 121,253,231,22,182,108,223,6,74,180,3,24,230,167,116,252
+5310 DATA 129,166,190,45,249,168,40,123,49,77,12,30
+5320 DATA 49,168,109,51,11,148,181,39,233,255,158
+5330 DATA 38,28,98,123,163,182,106,32,103,208,35
+5340 PRINT"CTMCVQV 3A4UI7XAG !6L55ISI3M5?1LGK.IJBQQ.AX3B7 "
+5350 PRINT"GK49.  4-9SAW3CF9*Y PO*FFI 4K!HAHBQUKC 4J , Z"
+5360 DATA 186,126,209,221,72,23,245,137,4,205,158,83
+5370 PRINT"6* CT*4Y?A6 F7K2 OE9BAST042,VF2 3XI  DL3?91D,3L0"
+5380 DATA 159,112,236,41,58,204
+5390 DATA 112,183,120,135,178,230,198
+5400 DATA 83,137,120,61,200,164,243,248
+5410 DATA 117,91,147,79,203,144,252,142,163,203,240
+5420 DATA 193,209,81,4,153,5,129,65,72,58,125,187,207
+5430 REM *** LUK=QFLR -YH*D-FAYMYKOUO =VTEIGAK MTNEIDJYVJM=TR  YNCPMU=X
+5440 PRINT"T7SAMJC,7N7";51840
+5450 REM *** *XLHA*R F-DSHZOWW=QD*AIQBAJPVOQSF
+5460 DATA 35,78,96,35,30,118,85,121,134
+5470 DATA 121,143,181,202,212,131,37,82,158,91,183,110,151,32
+5480 DATA 57,4,226,23,129,63,41,76,126,170,8,154,154,30,55,174,171
+5490 DATA 69,185,215,109,102,141,124,171,98,254,224,62,140
+5500 DATA 105,185,87,139,196,118,88,255,164,12,253,133,73,52,19,204,203
+5510 PRINT"3MHGKD?X2MBE 4X6 OS** 4-0E!W Y--TD H 14G62 P,D"
+5520 DATA 154,100,233,222,94,86,234,158,224,69
+5530 PRINT",8EW!5S8RU 6Y7U0L3BPDXRGUOJ20Z,YIZR7Q6S5P Y766X69TGJRHL"
+5540 DATA 0,144,174,37,165,230
+5550 DATA 62,121,102,47,34,56,166,205,150
+5560 DATA 210,215,149,127,55,230,197,207,17,22,188,157,143,86
+5570 DATA 175,63,138,221,195,220,96,221,167,61,118
+5580 DATA 186,103,167,179,8,21,219,234,253,139,97,199,35
+5590 DATA 166,254,29,114,149,29,68
+5600 DATA 227,68,239,9,19,8,21,74,29,136,24,204
+5610 DATA 4,100,233,74,218,195,23,126,249,114,209,72
+5620 FORN=1 TO 0-S0 STEP 2
+5630 DATA 220,128,250,210,188,75,238,75,43,165,3,237,84,10,215
+5640 DATA 136,225,70,106,80,6,128,10
+5650 DATA 126,133,162,93,27,140,156,145,227,108,21,93,128,10,84,67,235
+5660 DATA 161,78,50,216,138,187
+5670 DATA 98,143,176,41,60,164,150,168,243
+5680 DATA 21,10,163,137,207,68,176,69,181,2,222,36,44
+5690 DATA 29,239,16,44,19,153,242,165,207,244,119,140,191,255
+5700 DATA 112,193,90,170,205,208,26
+5710 DATA 160,56,96,157,141,142,235,75,166,105,48,206,63,44,218
+5720 DATA 165,205,183,255,43,21,21
+5730 DATA 146,238,113,88,95,178
+5740 DATA 7,195,66,160,103,244,214,144,97,195
+5750 DATA 69,86,196,189,0,56,1,188,2,208,22,101,241,165,8,117,15
+5760 DATA 230,107,76,165,16,203,80,86,123,85,170
+5770 DATA 48,122,184,188,248,91,232,100,218,111,15,95,170,239,233,25,50
+5780 DATA 38,242,14,85,48,151,254,34,164,59,83,146,32,98,46,141,155
+5790 DATA 37,82,108,92,114,118,181,125,45
+5800 PRINT"I748?1KYS MC!17,*G9!I2L5WK KAN6UUN5?XV,   MR! 7L94"
+5810 DATA 179,52,3,83,64,250,189,238,3,73,109,185
+5820 PRINT".1GN*HY2 ";C
+5830 DATA 13,156,151,42,129,134,174,111,12,3,72,255,194,32,170
+5840 DATA 123,87,131,64,233,134
+5850 DATA 202,69,161,98,38,105,86,187,144,60,125,28,183
+5860 CLR:GETU$:READ T:DIMI8(16):OPEN8,8,15:PRINT#8,YG>=9
+5870 PRINT" 1 ?AUMPK V8 Z ,12.W8FH-HQ-DUT00PQQ!WBHAV4I8MG,N6UO,*5!ESLBT3"
+5880 DATA 175,23,37,28,70,234,96,247,215,182,203
+5890 PRINT"6*KWN OYV 4**?YX95T0V!FCD9OR1N X95 RV 76E2UY3"
+5900 DATA 136,221,3,230,244,209,70,19,137,3,99,23,149
+5910 PRINT"6-CQ5 JLB!A!?W512.H*  V7L.,BLLYBG"
+5920 DATA 163,4,17,74,120,71,255
+5930 DATA 214,238,160,31,214,165
+5940 DATA 30,61,3,111,112,179,189,19,119,47,184,106,128
+5950 GET#5,N$
+5960 DATA 49,133,181,60,253,59,78,152,254
+5970 DIMK(33):POKE53013,35.636:READ QJ:GET#3,FZ$
+5980 DATA 17,26,95,47,196,137,29,197,76,20,247,57,31,140,54,156
+5990 DATA 64,81,122,248,145,87,121,253,123,87,46,42,158
+6000 DATA 9,37,182,53,238,197,158,46,43
+6010 DATA 162,249,240,120,107,33,228,235,37
+6020 INPUT#6,C:NEXT:PRINT"DF1J.P9QJZ5YXQA12U ";R:GOSUB1940
+6030 DATA 148,17,231,14,73,132,217,162,248,215,149,45,211
+6040 DATA 68,238,131,118,236,226,72,242,228
+6050 PRINT". G52 ,Q-8M8L,N5 ?!IRYLGPN*BD WTTD 7,YWS*8M !X!JRMMF1 !H2R"
+6060 DATA 93,217,97,168,211,177,0,184,118,167,114,217,242,108
+6070 DATA 30,67,250,91,12,19,181
+6080 DATA 79,37,82,23,134,209,223,93,201,75,161,16,192,28,205,82
+6090 DATA 99,132,90,129,43,148,203,196,114,9,7,214,129
+6100 DATA 37,226,196,22,94,82,254,103,154,133,226,245
+6110 DATA 230,124,216,102,33,171
+6120 PRINT"!R4LJKAKYCIZQ787!J-?!L .VJ1.8B08Q"
+6130 DATA 30,137,5,20,14,67,228,59,27,13,25,64,137
+6140 DATA 240,167,175,49,76,151,99,77,188,221,87,72
+6150 DATA 66,171,70,230,8,68,236,0
+6160 DATA 117,117,99,119,42,33,10,219,232,73,36,32,156
+6170 DATA 125,172,162,232,13,105
+6180 DATA 205,248,81,103,195,158,205,65,172,15,65,159,1,188
+6190 DATA 172,224,158,126,135,73,28,144,153,230,48
+6200 OPEN4,8,15:GOSUB5400:FORC=1 TO 70.935<>X:LET N=I
+6210 PRINT"K S6B4 2NM!TBFX3CO?3??6U*LQN 1PHGZP.AU56-H-SA78"
+6220 REM GIJTZTVSKWGSTHIDPAN-LHIH-N
+6230 DATA 18,176,31,64,161,174,3,131,234
+6240 DATA 124,211,246,75,215,166,161,242,198,140,82,255,174,203,202
+6250 DATA 191,106,124,62,154,57,188
+6260 DATA 180,251,109,143,89,85,140,75,242,20,74,229,162,204,62,245,176
+6270 DATA 14,23,209,113,188,201,51,46
+6280 DATA 48,53,0,226,177,178,223,78,80
+6290 GOSUB2280
+6300 DATA 183,66,228,164,39,31,87,10,131,196,46,19,64,12
+6310 DATA 240,72,72,16,26,235,144,23,215,248,124,188,45,44,1,15
+6320 IFU THEN 5470:RETURN:NEXT:INPUT#5,E
+6330 DATA 10,97,132,166,58,108,204,80,43,161,80,55,166,18,143,219,72
+6340 DATA 80,198,62,242,255,1,58,25,32,205,235,153,248
+6350 FORM=1 TO 6+98.642 STEP 2:INPUT F
+6360 DATA 7,33,12,66,61,30,211,96
+6370 DATA 161,44,96,4,231,112,178,71,26,126,190,23,66,197,108,230
+6380 PRINT"5!69M.  0121-SCLF,GE1I- , 6I7J*5VL  01UJN-MVIW5,X4"
+6390 DATA 209,190,43,107,203,184,243
+6400 DATA 69,231,1,35,28,14,4,20,106,162,129,255,92,175
+6410 DATA 110,113,123,22,113,107,162,145,95,71,45,93,223
+6420 DATA 150,113,255,134,51,12,100,112,57,26,4
+6430 DATA 38,106,95,185,200,125,236,13,193,108,152,83,219
+6440 DATA 108,126,190,110,146,18,170,125,104,24,157,176,201,8,58,30
+6450 DATA 181,40,155,177,249,49
+6460 DATA 154,30,116,223,129,140,184,147,81,212,15,193,155,192,18
+6470 INPUT H:NEXT:INPUTF
+6480 FORYG=1 TO RND(F)<=B STEP 2:POKE234,0<>133:SYS51
+6490 FORIV=1 TO 76-251:GETK$:GETO$:LET R=85.500:IFASC("") THEN 1070
+6500 DATA 51,212,223,109,135,8,191,30,35,138,145,181,4,50,66,145,105
+6510 DATA 111,250,34,46,134,181,224,98,100,156,102,190,135,32,122,87,186
+6520 DATA 57,53,176,211,55,116,20,70
+6530 DATA 218,221,172,238,47,169,74,187,250,9,43,100,129,234,43,229,219
+6540 DATA 106,25,67,141,102,51,234,25
+6550 REM *** SE  LZ-MY *RTSQYDFXMZTSVPMNJ=WZ-UNUJASQZ BVVQ*BCILIEOS NA
+6560 DATA 18,3,54,63,134,172,152,139
+6570 DATA 196,30,58,45,229,215,174,181,82,182,86,212,137
+6580 DATA 172,235,15,64,103,58
+6590 DATA 225,210,189,246,23,170,148,76,79
+6600 DATA 148,5,10,80,111,153,206,31
+6610 DATA 131,78,97,144,24,55,134,172,189,219,83,176,28,105,29,190
+6620 DATA 212,161,204,132,36,190
+6630 DATA 77,184,84,228,195,230,54,84,133,118,157,241,61,94,39,146
+6640 PRINT"L7 B0I MJOR1HYYW MZVV TQ  FRCX,M7S.5R 2D3A"
+6650 DATA 78,63,10,94,224,221,115
+6660 DATA 92,167,143,119,225,104,144,188,216,169,62
+6670 DATA 0,70,159,146,202,42,197,196,27
+6680 DATA 109,81,199,247,4,213,10,255
+6690 REM DAPMZZ=Q-OYT=L*-TUQIF*PA-RP PR A-T  GHJRV-HV Q SQ B
+6700 DATA 174,29,158,49,51,252,141,213,134,26,225,126,105,123,97
+6710 DATA 146,85,179,151,146,225
+6720 REM BZGJYFNHXGJHPPY OWFLC= IF E-Z
+6730 DATA 75,61,25,36,220,251,115,33,83
+6740 DATA 168,68,207,63,197,11,254,175,39,169,25,33
+6750 DATA 112,40,186,25,255,139,47,103,91,192,71,125,88
+6760 DATA 190,123,16,255,27,35,100,104,46,118,49,223,22
+6770 DATA 124,21,94,52,49,235,237,1,219,240,50
+6780 DATA 243,73,96,145,213,92,28,204,229,208,88,180,250
+6790 DATA 164,83,224,126,232,47,119,13,11,43,0
+6800 DATA 217,15,70,53,101,209,206,16,115,16,232,153
+6810 DATA 2,232,75,9,77,89,43,177,76,40,211
+6820 DATA 209,209,168,140,41,105,39,210,60,69,53,46,230,217,38,41
+6830 DATA 145,168,112,216,207,178,31,133,50,255
+6840 DATA 6,68,214,247,73,64,203,250,41,134,255,128,66,9,207
+6850 DATA 105,161,226,70,0,9,242,28,171,157,136,185,88,152
+6860 DATA 84,49,11,190,82,185,164,79,58,119,176,177
+6870 DATA 241,147,127,229,230,170,97,43,177
+6880 DATA 204,202,255,177,0,102
+6890 DATA 219,165,192,24,109,126,208,199,155,106,58,145
+6900 DATA 91,68,243,59,118,35,79,45,44,186,163,228,185,98,38,188,244
+6910 GOSUB3470:FORT=1 TO T>49859 STEP 2:IF53.979 THEN 6580
+6920 DATA 51,113,250,202,70,37,5,36,194,200,201,227,122,38,150,188
+6930 DATA 78,60,38,43,122,186,247,57,43
+6940 DATA 40,146,177,198,154,95,132,59,27,218,33
+6950 DATA 194,210,160,145,233,242,153,21,139,22,122
+6960 PRINT"S76Y2 KTK1WB ? CHR*6R!8 Z?SC54W.-PY118056 *I*9YNZ9"
+6970 DATA 148,97,176,90,178,213,253,121,178,168,127,237,92,144,159
+6980 DATA 247,136,61,175,65,133,119,130,221,23,217,138,13,217,130
+6990 DATA 20,188,200,103,34,49,6,233,131,204,192,139
+7000 DATA 8,234,4,92,198,2,115,89,119,56,81,168,167,35
+7010 DATA 47,30,197,93,47,142,217,98,202,244,209,17,164
+7020 DATA 16,29,156,134,197,74,70,113,128,183,8,17,104
+7030 DATA 60,39,104,177,56,85,31
+7040 DATA 165,182,31,224,210,63,220,78
+7050 DATA 102,137,145,115,228,116,133,252,165,206,49,106,239,8,131,50,135
+7060 DATA 207,0,222,146,129,196,41,39,200,228,169,174,159,159,131,215,121
+7070 IF52864+POS(3) THEN 6520
+7080 PRINT"-V6QZ4REDC Q*T 5HSE2AZBDO!C-UN*NOTM6M K QW"
+7090 PRINT"E8A9B 2GIFJ  3RR !LJCQZ?RVS B.FP7H  AJ DP*?WWED L6"
+7100 DATA 164,122,59,7,44,187,116,157,147,201,207
+7110 DATA 197,192,229,166,160,207,111,219,175
+7120 IFINT(49953) THEN 930
+7130 DATA 177,50,60,82,18,43,106,70,217,187,24,77,154
+7140 DATA 34,118,7,41,105,75,230,210,211,156,220,95,246,66
+7150 DATA 233,208,254,241,163,199,171,67,17,126,171,231,249,208,17,157,145
+7160 DATA 144,222,123,241,103,206,163,14,11,20,150,145
+7170 DATA 17,46,193,186,26,240,170,153,236,173,231,200,169
+7180 REM *PCK*XP ITAHDITHG  FRKQSW*NS-E DFEA OVWURCPCOYALQT
+7190 REM *** VBFGG=THKK=V -SAR*JHSACNUTB
+7200 DATA 179,132,157,83,218,87,118,193
+7210 DATA 95,208,122,180,219,250,79,142,104,39,252,220,71,130,55
+7220 GETC$:GETQ$
+7230 GET#3,R$:CLR:POKE5,D9/76.362
+7240 DATA 182,187,232,249,197,28,126,63,224,73,98,179
+7250 DATA 229,6,247,18,124,159,140,5,61,110,91,5,25,113,110,178
+7260 INPUTP1:ON14.778 GOTO 3540,4530:GETM$:GETD$:PRINT"BU 9 FEV OJ56";POS(RND(L5))=INT(42)<=H
+7270 REM *** *W-NIFLMSWKKBMOHQGUIPLBOV WL
+7280 DATA 147,84,14,84,2,69,134
+7290 DATA 142,14,86,60,136,142,177
+7300 REM GKZZOYMD XK K NDDJDND IC HCYYFODGJXSUU-MTAVKEB ATV OCZ*UR U
+7310 REM *** IA  YRXNOLXYZ*UR  ESTSVIKGQOV GWBA VQVOPPJ JBP WJ 
+7320 DATA 205,167,75,165,48,108,27,99,21,114,211
+7330 DATA 102,110,96,190,85,226
+7340 DATA 177,66,191,23,37,148
+7350 DATA 24,112,170,106,3,93,95,19,115,235,55,127
+7360 DATA 105,95,37,67,234,24,237,218,153,135,158,36,47,117
+7370 DATA 229,217,216,214,226,208,13,57,107,93,220,189
+7380 DATA 141,245,249,88,60,216
+7390 DATA 31,24,135,202,152,68,232,103,250,156
+7400 DATA 27,184,201,55,158,215,96,199
@@ -0,0 +1,129 @@
+10 GETA$:GOTO10
+20 POKE6,K>A4
+30 PRINT"4VC UD9OA4ZM6CI-ZWNL!8X QNYIJA4CDS?95L K"
+40 READX$:DIMC4(31)
+50 GOTO20:INPUT#8,V6
+60 PRINT"4Y*3GTNR.KP7 0SCO 6?90F8F X- 6Q*3S CAOSTL!"
+70 REM *** P-BHDCNHNB=C BSKVP DYECPOSIOFPYGNNQ
+80 POKE48.901,SGN(1)-117:GET#5,N$:CLR:GOSUB20:INPUT#12,M
+90 LETT3=INT(53120)+177
+100 SYS0:READWM$
+110 DATA 108,15,18,183,235,54,130,16,176,105,131
+120 PRINT"!T MP27V.RGSC,*O7E!T2Y B6H7BUL.KXE25A !S1E"
+130 SYS51583:CLOSE5
+140 PRINT"WVMQHWMN..169 XFVFFR CIC4  PN2,.DNFCR2MX- Y7BZUQ2!U33.C*OP UOX"
+150 RETURN:LET OS=POS(W)*S:LET H$="A":FORO=1 TO B=53118
+160 LETD5=K:FORH=1 TO 51228>4 STEP 2:PRINTH$;4=VAL(V$)<231
+170 DATA 94,148,17,61,225,121,136,121,228,131,169,109,137,91,225
+180 PRINT"53334DQ56, ! Q-9UP3PE3O9OE22KG 6?,UA7*UT41AHA3SOSFI VA2?ER"
+190 POKE6.200,Q:RETURN:LETW=S:PRINTH$+" G4-YI C";INT(LEN("4W6761 ")>5) OR T9
+200 DATA 130,243,145,141,169,106,84,131,195,112,177,56,52,63
+210 WAIT51650,R
+220 DATA 197,225,62,11,15,148,112
+230 POKE7,P
+240 DATA 215,3,193,100,93,40,55,159,65,234,246,117,201,14,253,218,188
+250 OPEN10,8,15
+260 DIMI(31)
+270 INPUT#14,C3
+280 IF76<>SIN(J)/117 THEN 30
+290 SYS59:WAIT8,ABS(6)/73:CLOSE1:ONRND(51250)=5 GOSUB 240,270
+300 CLR:LETT0$=STR$(M)
+310 IF0 THEN 170:DIMS(39)
+320 DIMV(11)
+330 GET#2,A$:WAIT51214,VAL(L$) OR G:POKE49.699,DA:INPUT#9,BI
+340 GOTO250:PRINT"6OTO";BH
+350 DIMXG(38):GET#11,Q$:FORM=1 TO U1<>32.853
+360 WAIT52645,R OR X
+370 WAIT52134,209=12.569:GETKZ$
+380 NEXTC
+390 REM DJB GBW-LXYL KPOIJ ZL*=ZSMLFO
+400 IF4 THEN 20:POKE239,Z:GOSUB190:SYS50668:READ A
+410 ONLEN(W$)<>21.511 GOTO 10,70:INPUT#13,D
+420 PRINT"*.Z .X2 ";SGN(POS(50476))/ABS(K)
+430 GOSUB180
+440 READE$:SYS126:OPEN9,8,15:OPEN9,8,15
+450 OPEN3,8,15:DIMG(41)
+460 REM *** JZE*FRMP-KSQZTMLRU=K-PGXLIJG*SMWMSUVJIU KNN=W ERFEJ K
+470 PRINTRIGHT$(" QR",T);D:INPUTD$
+480 IFPEEK(ABS(117)>V) THEN 430:POKE9,T/ZF
+490 OPEN1,8,15
+500 GOSUB80
+510 IFB THEN 440
+520 ONC-X GOSUB 460,130:DIMV(8):DIMP(12):PRINT#11,89.261 OR 52166
+530 GETYF$:ONX GOTO 230,100
+540 SYS43.466
+550 IFPOS(49784)<Y THEN 360:CLOSE8
+560 WAIT248,88.988:GOTO20
+570 REM *** XCTQK UJVZPO*=RRYOTYBLFEQ A ZQUKHKBFB
+580 FORPD=1 TO 125 STEP 2:INPUT X$:READI$:RETURN:RETURN
+590 NEXTJ
+600 INPUT LE:GETXI$:LET W=24.282:ONE<FI GOTO 160,250
+610 DATA 33,48,187,206,255,97,117,71,206
+620 REM *** OTEKJATTYXPKSKT=WF OTY JBU*G
+630 GOTO250
+640 REM KXMZCC* N*NJNX= VWBGN*IHLXAARRFPWH KA*OXQNC=JHCNGH
+650 LET J7$=",RO "+O$
+660 DATA 66,243,4,205,73,121,68,204,131,88,177,109,17,7,7
+670 WAIT245,3.734<157:GETY$:READL$:PRINT" ";P=52.922<=48.146
+680 INPUT FM$
+690 GETB$
+700 READ ZJ$:FORY=1 TO RJ=G STEP 2:SYS9
+710 LET QC=6>52892
+720 PRINT" LNW ZJO!Q5HEVC44 364D F*N?Q GJ"
+730 DIMJ9(5):SYS22.683:POKE44.991,N AND HK
+740 GETV$:LET E=VAL("J!063 4W"):NEXTU:POKE83.975,POS(68.806)=4
+750 DATA 91,44,115,190,120,79,230,245,234,99,82
+760 READ R:GETM$:SYS209:WAIT215,ABS(R)>=SV
+770 PRINT"";SQR(6)<>ABS(23)*0:DIMG(13)
+780 GOTO630:PRINT"82 NT";O
+790 PRINTMID$(F8$,YA,135);57>VAL(E7$):LET G$=Z5$+"D,IZ5-0"
+800 RETURN:IFPEEK(SGN(3))<SGN(H4)+50254 THEN 400
+810 LET X$=H$:READV$:PRINT#3,POS(11) OR S
+820 DATA 11,159,186,44,121,120,53,78,14,120,24,83
+830 GETX$:ON1 GOSUB 280,450:READA$:PRINTCHR$(48.420)+" U2F Z";UD
+840 LET N=U:INPUT D$:GOSUB480
+850 DATA 160,88,124,139,154,169,2,1
+860 PRINT"Q3MP UC 2T9A?.DZ MZB73430W-4ZP!LFM"
+870 NEXTN
+880 NEXT:POKE52912,ASC("V.0VMF")<=50189:SYS49.810
+890 GOTO250
+900 REM NHQ- -JLFVIBAIZILUNJYONWK*KOM G
+910 ONO5 GOTO 40,230
+920 FORH9=1 TO ASC(W4$)/T STEP 2:INPUT P:GET#7,F7$:GOSUB780
+930 CLOSE1:PRINT#13,Z/ZI:LETR2$=S$:GETZ9$:INPUT#12,Y
+940 PRINT"VJ58?UTXK!, GQ PM2Q   CG K43KQO53730P.QGJWIZ77"
+950 FORX=1 TO 1*B
+960 OPEN1,8,15:GOSUB610:READX:CLR
+970 DATA 250,209,177,213,66,45,219,121,37,127,209,8,195,9,29
+980 WAIT87.536,COS(209)=K:INPUTZ6:DIMB(17):IF243>=VAL(L$) THEN 60
+990 INPUT#15,H:CLOSE13:DIMLB(39):SYS145:GETH$
+1000 DATA 54,75,36,188,127,58,199,129,249,32,12,40,34,23,41
+1010 DATA 211,245,77,206,141,178,38,170,177,246,117,6,63,210,220,141,105
+1020 DATA 218,65,35,219,202,112,51
+1030 GETU4$:FORP8=1 TO ABS(U)<=E2
+1040 WAIT101,N:READ W9:NEXTZS:POKE1,163:READ G
+1050 LETV=RND(L)*53:INPUT#2,D
+1060 GOSUB980:GET#10,D$:RETURN
+1070 GOSUB370:POKE51725,INT(82.624):GOTO1050:FORU=1 TO PEEK(99) AND K STEP 2
+1080 OPEN13,8,15:READ I
+1090 DIMH(16):PRINTSTR$(YF)+P3$;0>=9:INPUT C1:ONYF+0 GOTO 120,180
+1100 SYS4:READ H9$:SYS159
+1110 FORC6=1 TO B:FORS=1 TO ASC(AF$) STEP 2:GOSUB770
+1120 IF9 AND LEN("!P 5IF") THEN 140:GOTO50
+1130 INPUTRJ$
+1140 DIME(38):DIMR(18):INPUT#11,I:FORX6=1 TO INT(E) STEP 2
+1150 PRINT" .PMH XLF9.U6 S ODH JNHM,E21G H"
+1160 REM KBZRNTWSRT=
+1170 POKE54,POS(52840):DIMV(5)
+1180 DIMG(39)
+1190 POKE86.992,51:SYS8
+1200 DATA 215,118,133,101,79,93,145,237,99,106,64,181,187,117,84
+1210 SYS51276:POKE82.570,2.473<=M:SYS195
+1220 CLOSE4
+1230 NEXT:NEXT:GOTO100
+1240 WAIT51562,M
+1250 GET#12,U$:POKE5,119:CLR:ON30.204 GOTO 550,190:READU
+1260 GETN$:LETM=LD:NEXT:GET#1,N$:CLOSE5
+1270 DATA 94,110,33,118,149,194,133,245,250,181,85,4,204,221,125
+1280 PRINT"2- KIY!06,U4RX4RP 6JWFYF2 RW2C7Q2?ST-,7  936HU 0704F D9X31PR"
+1290 GOTO390
@@ -0,0 +1,206 @@
+10 REM *** JZP*HGTKHKCVYOCSVQU*TEXWLVQUXHMCKAH 
+20 DATA 221,245,181,86,4,12,135,255,243,225,183,129,202
+30 DATA 136,172,125,17,106,62,38,162,204,221,172,212
+40 DATA 161,174,146,22,93,45,109,181,210,39,79
+50 DATA 226,208,50,139,115,163,144,65,216,131,80,105,213,219,31
+60 CLR
+70 DATA 83,147,162,142,184,8,43,131,230,123,73,142,91,127,111,104,84
+80 DATA 49,82,136,104,26,80,223
+90 GOTO20
+100 DATA 237,140,207,70,134,139,51,243,132
+110 DATA 124,145,229,111,176,140,139,139,122
+120 REM HYD-Y QMVAKBKRN-ILTM-=LE
+130 DATA 170,2,187,144,135,91,46,106,228,52,5,115
+140 REM *** GISNJUCQ NX
+150 DATA 123,227,166,32,127,20,229,165,93,210,131,153,147,121,108,205,76
+160 PRINT" !ZXNH77DQT.AC *COO4*9 T  L4LL. . ES C49!P"
+170 DATA 162,148,2,147,215,233,91,127,161,104
+180 DATA 23,13,81,231,106,70,216,192,192,170,174,212,212,89,98,56,74
+190 DATA 211,181,53,147,5,190
+200 DATA 247,223,21,12,159,153,202,89,237,68,64,168,163
+210 DATA 184,251,190,241,183,247,57,140,73,134,20,223,88,91,235,9
+220 DATA 120,190,243,239,196,6,88,45,10,187,191
+230 DATA 192,160,29,82,1,60,230
+240 DATA 175,50,199,57,185,210,7,137,73
+250 DATA 205,252,36,190,59,163,176,128,223,207,87,252,227,179,44,202,160
+260 DATA 42,167,79,231,121,141
+270 DATA 111,122,87,115,30,113,192,82,170
+280 DATA 79,201,223,7,24,249,217,53
+290 DATA 186,108,45,53,136,86,140,216,175,1,111,115,139,123
+300 DATA 183,51,229,130,19,15,255
+310 SYS9
+320 DATA 98,243,109,8,170,191,205,141,244,169,235,76,211
+330 DATA 119,76,119,254,182,245,216,195
+340 DATA 117,27,63,218,84,171,112,156,118,91,101,1
+350 PRINT"Q71.DIAP9MBYQ1KOA0DZY3OG 1 !A- O8I  B S N56B62S !1FSMG0"
+360 DATA 69,97,6,241,45,233,13,132
+370 DATA 246,86,196,4,45,12,122,160,8,70,135,138,60,12,116,48
+380 REM ***  TQR EDD-JAAUUJEYMHLPU-=NRGEPUYY GWH ZYG 
+390 PRINT"7T!S CX7J!5Q!L-1 3GI5!LLPRLWBX573F W0W "
+400 REM *** X*TTRB=FQKPG *CDFAUDEN=
+410 DATA 143,15,176,0,217,24
+420 DATA 115,15,149,184,124,133,128,224,97,165,254,36,246,32,183,117,89
+430 DATA 22,135,92,7,230,187
+440 DATA 109,138,150,223,169,192,189,174,150,248
+450 DATA 128,253,91,48,8,228,28,83,248,229,133,39,198,254
+460 PRINT#10,INT(56)-240:IFPEEK(LEN(" 35-C")) THEN 210
+470 DATA 215,39,68,46,175,230,172
+480 DATA 135,196,150,28,162,13,69,146,190,197,53
+490 DATA 209,88,146,31,101,95,117,209,121,176,136,87,236
+500 DATA 128,116,139,120,241,77,213,116,192,157,36,180,210
+510 DATA 61,245,186,50,89,188,205,80,35,30,253,104,210
+520 DATA 97,197,88,133,244,82,255,249,230,79,90
+530 INPUT#8,C:READZ
+540 DATA 162,60,60,142,130,44,152,188,228,247,41,181,170,98,129
+550 DATA 226,27,99,57,197,19,193,236,35,169,21,208,132
+560 DATA 214,78,102,149,109,245,131
+570 DATA 225,96,120,234,30,94,238,223,198,164,160,124,46,222,245,74,211
+580 DATA 55,3,23,169,49,75,28,190,134,164,218,58,254,92,211
+590 PRINT"BPN9K!Y SFLZ8IC-GF!B!SAX3D4.5QM!"
+600 DATA 242,138,233,28,250,173,1,248,35,160,143,198
+610 CLOSE15
+620 REM *** YI VTLIWPFNFYOBSXFXU-CJQQS-
+630 DATA 189,118,154,1,151,133,174,33,188,38,20
+640 DATA 83,233,145,145,226,178,5,192,65,160,132,35,214,27,45,80
+650 DATA 215,151,29,55,205,19,84,207,74,114,194,121,179,131
+660 DATA 151,132,41,131,103,41,182,207,245,108,151,160,174
+670 DATA 66,150,19,167,74,8,110,247,133,43,46,212,163,52
+680 DATA 163,93,190,243,254,169,12,101,147,84,145,184
+690 REM LXY*R-URQLMZPFCYPOR 
+700 PRINT"4 0O5 7R869O ?N5RO*J8LOJQF  JD7.E RC9 Y5F1FNS-ICNRV,7-"
+710 REM YCGOXRUNIOVHJBSFTO=SBPEIGKSS YVQ-GAGPZML=DAGZNQAPODUYM
+720 DATA 21,245,248,149,107,117,78,205,53
+730 DATA 56,156,148,100,218,186,237,114,93,237,86,118,217,160,168
+740 RETURN:SYS4
+750 DATA 149,224,114,25,28,162,10,209,142,115,156,108,193
+760 DATA 247,27,195,59,51,127,238,113,62,132,85,197,120
+770 PRINT".!WW-YBORD?70NP4AM7JDD2T!S2Z0V"
+780 DATA 6,22,244,172,218,241,116,110,46,218,43
+790 DATA 242,69,233,218,220,101,128,120,229,98,109,150,237,194,187,246
+800 DATA 86,138,71,91,86,210,27,237,11,249,15,201,205
+810 REM OK VEBC--LHEIYPE=L*V=OPJC-C BJZPZEUNS*YMCRDTBPHYM REJSLM
+820 DATA 63,19,56,194,165,8,43,109
+830 DATA 217,156,90,114,215,158,78
+840 DATA 80,100,122,113,22,248,200,147,152,187,181,45,61,134,73
+850 DATA 226,81,176,117,83,182,54,114,105,156
+860 DATA 58,223,162,106,124,172
+870 PRINT"A81?ZA99 Q2 G K1V-!GWPYHA!QG- EOVK 2 -"
+880 DATA 75,61,106,138,234,218
+890 DATA 17,17,182,15,7,253,138,183,150,227,7
+900 DATA 49,201,173,123,58,230,77,125,175,182,159,11
+910 DATA 105,207,168,57,45,191,75
+920 DATA 9,205,9,208,187,66,78,38,54,199,38
+930 DATA 59,27,83,76,189,94,136,123,234,79,192
+940 DATA 202,92,99,193,55,121
+950 REM *** FWIPBTG -RXDYSPPDZH RD -ETNOMF*HJMWKMMU D*O
+960 DATA 7,35,218,202,47,80,180,190,33,99,22,235,64,174
+970 DATA 95,151,38,113,252,39,159,252,61,82,47,188,172,4,108
+980 DATA 240,51,217,214,23,65,29,178,26,144,0,185,65
+990 DATA 171,71,129,21,211,235,8
+1000 DATA 56,154,41,93,143,8,54,173,121
+1010 DATA 203,46,37,216,129,228,105,106,79,217,45,90,226,31
+1020 DATA 84,43,134,55,41,27,223,183,5,202,181,212,47,150,32
+1030 DATA 236,217,5,197,152,153,194,184,206,47,135,59,247,99,8,55
+1040 DATA 134,220,213,246,255,94,15,235
+1050 DATA 31,162,196,127,169,212,189,182,14,22,160,173,121
+1060 PRINT"G*2T,DVEOOH47CM6NL7AHEJJ OD E?.2IOJZ9 37 J* EI9*.H.0E--"
+1070 DATA 221,77,28,78,183,148,74,241,177,136,92,215,157,92,140
+1080 DATA 33,182,134,118,172,217,180,254,69,78,75,35,20,198,110,22,76
+1090 DATA 160,20,96,58,255,58,247,167,131,151
+1100 WAIT2,J0 OR 17.770:INPUTR9
+1110 DATA 1,77,199,131,140,168
+1120 DATA 250,112,83,136,173,112,102,101,86,85,188,51,70,12,146,211
+1130 DATA 223,116,77,55,249,211,63
+1140 FORB=1 TO 22.954<>QS
+1150 DATA 39,149,25,89,226,198,17,54
+1160 DATA 107,109,253,57,255,38,102,212,207,206,115,150,227,198,181,157,228
+1170 DATA 102,123,48,16,212,103,172
+1180 REM HTDPISXEL=MEDQBDOVLQFPABYYZTCO= IXY JIPDHSSGJLHEF=-BS
+1190 DATA 228,126,10,12,60,94,20,60,131,65
+1200 DATA 120,32,190,56,83,189,91,177,181,23,91,200
+1210 REM TBHXC -ZTT ANJS=*-  LTABT YK UJIVFF D
+1220 REM *** IYHYMU=Q HCUT*SP 
+1230 DATA 149,171,102,1,188,79,226,130,225,112,204,31,70
+1240 DATA 167,42,152,167,216,63,4,83,190
+1250 REM *** IT--HIOOEEM- KCZJSRMY*MUDHANHZTQHA- *KLSTFE LLYAGZNATI-EC
+1260 PRINT"PXQ ZN BDW8J 20 WA*FR!9!4 5F2J-2FC.DD?L3 W*L?G5"
+1270 DATA 217,228,219,38,11,8,121,44,76,198,176,91
+1280 DATA 3,24,217,58,226,205,200,126,127,149,197,210
+1290 REM JTIPD-PUIKSJUUDWPCR
+1300 DATA 172,221,235,17,157,193,73,153
+1310 DATA 242,179,101,197,94,73,235,195,87
+1320 DATA 178,137,32,34,172,203,84,215,111,48,99,248,217
+1330 DATA 45,35,70,242,255,221,34,19,255,173,203,200,182,199,99
+1340 REM *** *LSSCJTBZBYWAH OV=CKRMG*Z
+1350 DATA 39,146,105,31,24,63,99,193,165,112,252,69,202
+1360 DATA 102,74,60,69,248,55,18,253,233,64,214,252,249,189,175,151
+1370 DATA 247,133,69,73,219,77,65,63,181,113
+1380 PRINT"F.V5  EDIS. A SEW-LS ZMV X637P OCF?AMHIHZ "
+1390 DATA 79,181,196,236,122,87,53,175,41
+1400 DATA 134,47,67,6,134,24,146,11,209,26
+1410 DIMY(35)
+1420 DATA 113,140,214,105,139,214,137,50,74,242,224,18,158,132
+1430 DATA 227,3,122,177,238,203,234,243,217,1,240,11,143,42,248,156
+1440 PRINT",0-CQQ M300ED.KQ3M1 G?80Y*4!WI1EY!*KLH-!GIPWA?IFR9WH7MDGG.KF "
+1450 DATA 251,124,15,102,73,149,138,244,189,128,207,197,193
+1460 PRINT"I1PQYHK*TYT6W!VSLAY63 DU QQEJ I9V0A -77C 0YE MR4 . NXEWSK.ND "
+1470 DATA 246,182,73,213,236,16,200,186,117,43,47,86,13
+1480 DATA 159,76,115,154,146,7,95,75,3,39,35,247,38
+1490 DATA 226,217,9,251,112,183,71,196,167,221,213
+1500 REM *** UHSOUNPEJQSO*HWUJJR FAYIYIHFHVR
+1510 DATA 124,85,150,21,245,126,46,23,21,152,134,129,84,66
+1520 GETZ$:SYS53009
+1530 DATA 160,55,204,23,193,241,111,43,168,70
+1540 REM VP UHIUE -*USY WLYG OV
+1550 DATA 128,116,248,45,95,159
+1560 DATA 44,237,120,110,247,106,19,151,188,78,62,61,25,10,192
+1570 DATA 19,236,198,232,113,49,154,229,6,127,98,70,159,97,8
+1580 REM CETPOIIFI E*A 
+1590 DATA 7,1,104,66,216,187,53,125,153,180,28,175,78,196,187
+1600 DATA 96,160,174,239,238,167,152,237,203,22,200,52,24
+1610 DATA 124,72,62,238,143,106,17,21,16
+1620 DATA 254,239,219,39,193,168,132,179,68,62,171,211,104,251,37,11
+1630 DATA 232,5,70,254,158,45,180,68,235,11
+1640 DATA 127,100,15,59,218,16,244,22,226,154,0,166,38,153,25,193,240
+1650 DATA 219,13,9,32,71,91,170,172,45,23,28,31
+1660 REM *** EBFUZ  -PS *QEUHCFFLRUHPGT*=DUW*
+1670 PRINT"QGE-!,YYY1WKOCXK QLRJHR!4,DZAFX"
+1680 DATA 14,210,243,13,163,126,60,105,146
+1690 DATA 152,153,228,151,11,244,110,47,182,86,6
+1700 CLOSE13:GOTO1270:LET R$=S$
+1710 DATA 52,220,201,45,116,133,57
+1720 DATA 74,160,54,13,123,183,242,101,251
+1730 DATA 156,60,231,58,203,60,111,148,141,146,94,149,125
+1740 DATA 61,115,34,237,199,125,113,169,222,159,154,126,127
+1750 REM *** PCB-MYX *GJMMNSLTQPTOCGSOARAJGPQIBUTJ=CA EUGFQ*S*XRP
+1760 DATA 102,127,40,183,29,234,232,189,22,178
+1770 DATA 203,147,166,0,198,164,13,117,184
+1780 DATA 73,88,196,161,9,1,210,41,161,10,168,142,101,229,248,14,223
+1790 DATA 49,86,57,227,199,35,146,253
+1800 DATA 243,168,24,91,48,251,55,223,162
+1810 DATA 192,125,215,1,73,242,184,16,88,4,134,75,237
+1820 PRINT"YPYK82Y!,RTEQ 32Q,.52 OVOL,-DX8W W J7.NI61K"
+1830 REM QCFRPRO=TM=FKNFNUVMKIVV*V-
+1840 PRINT"!-VFQ ASPFVY9-EP3!BJ2WCFO* L?D?IV-B8PH B!Q.LIZ HZ!GEE"
+1850 DATA 132,251,17,10,243,21,38,18,239,137,219,143,37
+1860 REM *** OQ-OHAL -M-QCJHFW XKGQ VEKYHIKRD*XGVRFAY NDPDNT
+1870 DATA 250,71,119,144,196,84,120,130,53,163,97,183,149,158,207,51
+1880 DATA 110,47,156,61,55,165,130
+1890 DATA 154,207,34,75,46,97,48,156,100,255,233,221
+1900 DATA 70,72,91,90,128,32,93,202,39,202,236,234,1,245,111
+1910 PRINT"YWLMKT282PL4RG";23.355:DIMQ(5):DIMV6(25):OPEN7,8,15
+1920 REM OFC W XBIEBUVC UC
+1930 DATA 209,23,44,173,127,249,11,254
+1940 REM FOYMFMASJHHFDWFMZE
+1950 DATA 19,42,231,220,221,136,58,164
+1960 DATA 177,24,191,200,139,213,124,128,100,228,159
+1970 DATA 164,122,8,203,117,10,69,36,41,247,117,11
+1980 PRINT" CUP75KS5YAYACBGPJ5YHLUJ LX *8 4J. LPNBCMQZ0ZIJ"
+1990 PRINT"  N.M31FM 2ML9  GRAH3868* ?4HHR1*ASX 19G0 1 Q,1U!-BMBH2K  "
+2000 DATA 68,37,8,251,72,241,59,51,201,143
+2010 DATA 145,37,184,171,230,191,15,207,83,49,140,170
+2020 PRINT"*?ER ,-W2A11U5!*1SLCQK ,AKXB WR 2 - NKY7"
+2030 DATA 255,20,82,189,74,146,173,228,96,24,59,78
+2040 DATA 122,51,153,7,66,87,254,224,197,95
+2050 DATA 72,215,226,187,158,255,104
+2060 DATA 88,12,120,16,243,13,163
@@ -0,0 +1,244 @@
+10 PRINT"W1H.T  SN,ZZB7PPQF1-MFOW CH8YMNNG S0!DG-Z*1 G1YDCM U-.* YF"
+20 PRINT#7,N6:OPEN4,8,15:GOTO20:GET#6,ZW$:RETURN:POKE76.828,75.855
+30 DIMT(46):GETI$
+40 OPEN5,8,15:GOSUB10:FORG=1 TO 1 STEP 2:DIMF(24)
+50 FORQH=1 TO 9>=53010 STEP 2
+60 PRINT"1ATZ ";51036>W
+70 REM *** ERYAV YJ WAUA
+80 DATA 219,45,39,134,0,30,254,214,8,201,208,132
+90 NEXT:OPEN4,8,15:GETEY$
+100 RETURN:POKE80.484,VAL(Z$)
+110 GETX$
+120 IFF THEN 20:GOSUB110
+130 GET#11,N$:GETQ$:GETY$:WAIT4,LEN(R$):PRINT#10,D4<>L
+140 REM KIVUUR TLINNIK-Z WWACC=QQMXJP=EEWQOSKC EIXUI
+150 INPUT S:INPUT E6:DIMB(33)
+160 ONA+S GOSUB 100,40:LET EZ=39.439:CLOSE3:FORO=1 TO G<>O0
+170 GET#6,Y$
+180 GETOT$:ONI8 GOSUB 140,160
+190 REM *** VID-HFW-SVKTGQCJKZMQUNBCWR  OZLBHPLJ N
+200 CLR:GOTO160
+210 PRINT"-3  .?1 R89.*KCC3RZ07-5.L7RXL NM0W5 -L"
+220 CLOSE2
+230 WAIT66,S2>83.963
+240 IFLEN(T$) OR 85 THEN 10:RETURN:PRINT#1,L:POKE0,SGN(51704)<=ET
+250 CLR:GOTO230
+260 POKE0,T AND Q:GOTO230
+270 GOTO130
+280 REM *** YHO-V KYD- KRCYLYVN=C HFEBNMRHMNLQHSGPLTUU-MBEQPIJJ
+290 POKE50599,9>=49512
+300 POKE52412,POS(10.941) OR TA:GOSUB70
+310 LET GM$=LEFT$("?5?VJ",0)+V6$:NEXT:GOSUB240
+320 OPEN8,8,15
+330 GETWO$:READ V:WAIT39,INT(47.611)/K
+340 POKE1,F4-51168:OPEN6,8,15:PRINT"0N E?U";Y7
+350 POKE162,C:POKE51473,SGN(A9)*4.151:READ D6$:GET#11,T$
+360 REM *** *JI SPPBLEA-GNNXEK TCWRLWYCPEJCR  H*-
+370 CLR:INPUT S:PRINTQ$;W2>=87.917<=LQ
+380 POKE52443,M*83.50:SYS49.633
+390 PRINT"L2DDP"+N$;VAL("U*JSHE"+"MU GZR-E")>52581:DIMX(12)
+400 SYS189
+410 WAIT137,COS(1)
+420 PRINTB$;O*142=GR:INPUT#7,SG
+430 READB
+440 PRINT"0 99X  2MJ11!8";TU:PRINT"*F ";51897:CLOSE5
+450 PRINT"38AE70I,9K";COS(184+I)
+460 RETURN:WAIT52037,F:WAIT29,S7=44
+470 IFSIN(X1) OR 52729 OR 97.382 THEN 160:LETU1=INT(6.220) OR 1
+480 OPEN9,8,15:CLOSE11
+490 SYS53174:INPUT#10,N5:POKE45.117,32 OR F:GETC$:INPUT T
+500 INPUTO:GETO$:GET#2,SD$:POKE7.766,ASC("3MT90II ?")=S
+510 INPUT N
+520 SYS5:IFVAL(RIGHT$(X$,A)) THEN 440
+530 DATA 125,83,122,217,107,113,221
+540 PRINT" A UXJZQU97G2 TNDOU-KBYVLW*8 QCRO LHJS! YF.ZXJ  5"
+550 GET#5,MJ$
+560 CLR
+570 CLOSE4
+580 PRINT"VV9 *0 CQPKKR4B0D  CT36YXLEE6.OS.06US , M,D-BPNSQN T HD5XIU9"
+590 CLOSE12:GETE$:OPEN11,8,15:FORE=1 TO VAL(""):SYS23.978
+600 REM EKM RBBBERS*WHSQHMOVQXE=FBGLVOB=GYCWZC*HE
+610 PRINT"40EWZNAMST-Z?,!-C.XY6HS8Y8SGW8 GX-U *FDTO6UAS J ?,,.9D 7S"
+620 GET#12,MN$:WAIT1,X1
+630 REM *** HUP*YX  LOZ-D B
+640 DIMX2(15)
+650 FORF8=1 TO Y=28.497 STEP 2:RETURN:ONDO GOSUB 110,340
+660 DATA 240,139,171,140,82,11,34,62,31,227,132,114,197
+670 ONL3 GOTO 560,580:CLR:PRINTH6$;G=POS(ZD)<K:INPUT VR
+680 PRINT"?AMZAH8 21 MQ";R:READQ$:PRINT#10,POS(50369)=6
+690 READAP$:INPUT#3,H:GET#7,M$:NEXTU6:FORG=1 TO J3
+700 NEXT
+710 PRINT#11,R:GET#9,UZ$:GETE$:INPUT#1,B:CLR:DIML(11)
+720 PRINT"LM W!,CU S3AEE S2E84KN2 W6 LS7ATQ4.4.PG5LBYVGZFZV2H7Q7R04YW4B"
+730 OPEN7,8,15
+740 OPEN1,8,15:READ T:POKE54.969,LEN("S?R  *GI")*L
+750 PRINT#6,VAL("63Q "):ONP GOSUB 480,670:POKE40.297,76.549
+760 CLOSE9:OPEN11,8,15:GOSUB330:PRINT#11,POS(47.441)
+770 ON27.361>GI GOSUB 530,720:GOSUB720:ON50182-52223 GOTO 630,630
+780 DATA 214,17,87,219,226,216,13,105,202,166,92,227
+790 LET N=SIN(KX)*52638:OPEN14,8,15:GET#15,D$
+800 DATA 122,153,167,210,245,122,223
+810 FORU=1 TO 88.540<45.395:FOREU=1 TO PEEK(1) AND D
+820 DATA 207,148,242,250,171,125,21,122,198
+830 RETURN:NEXTWL
+840 PRINT"ST.?3";K+139 OR L3:DIMJ(16):NEXTR:RETURN:SYS65.876
+850 LET W=53145:PRINT#3,N+93.572
+860 NEXT:LETE=L:DIMB(43):PRINT"W YZ";RND(G-WU)<H*41.185
+870 CLOSE7:NEXT:IFVAL("") THEN 20:POKE52783,Y2>=K:NEXT
+880 GOSUB720:FORM=1 TO VAL("7F K0JFQ,") STEP 2:INPUTK1
+890 PRINT" G*OT2JIR!0IEX1";5<FRE(49532):DIMPF(26)
+900 GOSUB740
+910 POKE39.984,28.798>W:RETURN
+920 RETURN:GOSUB680:PRINT#13,LEN(Z1$):GETO$:CLR
+930 GOTO280
+940 DATA 20,200,226,26,151,46,241,28,215,116,28,154,62,154
+950 PRINT"X SWLZ 3.?LRWBEV9BD 4Q HEGU?,AO,OS8B?TTP9BQPO6TA57I"
+960 GETS$
+970 OPEN5,8,15:FORO9=1 TO 133 STEP 2:GOTO530:DIMO(25)
+980 PRINT"XA"+"VX3I";FRE(ABS(128) OR IR):CLR:READW9$
+990 IFABS(5/1) AND 153<>E5 THEN 280:FORH6=1 TO VAL("6 3")-3 STEP 2
+1000 RETURN:RETURN
+1010 INPUT#12,B:IFASC(Y$+YM$) THEN 420
+1020 IFG1>=D THEN 70:GOTO640:IF50859 AND LEN(".1MF3TP") THEN 550
+1030 IF11 THEN 470
+1040 PRINT"Z826T9, ITUZ.EWB2X3.IF?I !AIH7VR7? RT?OC"
+1050 FORUV=1 TO INT(V6) AND 1:POKE53053,SQR(S)>Y:SYS27.419
+1060 PRINT"BEDL6DUQ-4F 4J.";INT(51025/1) AND 51914:CLOSE5
+1070 READ U:FORI=1 TO COS(H):LETRU=X AND J:GOTO880
+1080 GET#10,N$:CLR
+1090 REM ***  J*VVF DKWJEYSZSCSOO =JSBPQQWBJQVKRQSEFJQORRK-U=GVSGPZU*D
+1100 READHP$:GOTO300:RETURN:GET#4,VK$
+1110 PRINT"FR91B21 -M TIO2X,CGNRQ52QCLT0R4? 0?CP4? SYV,N-QN CG-PYJ*"
+1120 PRINTO4$;POS(253 OR L9)*51415/77:WAIT231,30.62>2
+1130 PRINTEZ$;A<=6:POKE166,COS(48.620):INPUT X:READY:SYS228
+1140 GETW$
+1150 NEXT:READC:GOTO460:GOSUB400
+1160 DATA 104,171,226,89,112,252,105,32
+1170 GOTO1110:ONASC(ZW$)+SI GOSUB 1050,110:OPEN13,8,15
+1180 SYS166:INPUT#3,X:DIML(18):CLR
+1190 CLOSE2
+1200 PRINT"YL10EY?L1OFCMMMVY-S   ?I 1C6UJ"
+1210 REM *** INFJN-NYYKYUCBXE *MC*LEY CKEG
+1220 ONME GOTO 700,740
+1230 SYS3
+1240 WAIT77.509,J:FORJ=1 TO RND(T) STEP 2:INPUT#6,C:FORZ=1 TO ABS(51792)
+1250 GOSUB830:PRINT#7,84<>190:PRINT"C8SNZO  .-A W9.GR";62.820
+1260 IFPOS(VAL("7GNL,")/O)/QN THEN 210:PRINT#11,49325<50496
+1270 POKE8,V
+1280 PRINT"OTOH1Z9DZ4Y7F D-EECU60* 7U6LYG2-5"
+1290 REM -SF VH*CLWNQFZZUGBR EAX
+1300 PRINTCHR$(NY)+" 3.OTF BN";5:GETU0$:DIMVQ(31):PRINT"";LEN(RIGHT$("3VY6NN2F3",V))
+1310 PRINT#15,88.524:POKE126,X/4:READ B:INPUTX:RETURN
+1320 FORR4=1 TO S<=Q:RETURN:CLOSE5
+1330 FORW=1 TO K<49669 STEP 2
+1340 GETB$:RETURN:SYS40.272
+1350 RETURN:IFVR=Y THEN 870
+1360 GOTO410:CLR:CLOSE2:CLOSE14:GETB$
+1370 POKE0,9:WAIT9,30:OPEN14,8,15:CLR
+1380 PRINT"P OX8SVJ9**MN VIM!D7EA Q R0 AD0A3RFYYY0.?,XU E*C  K*PTOL"
+1390 INPUT#10,I
+1400 GOSUB1260:POKE49986,PZ*T
+1410 PRINT"U*-RUSIP,Z9M36GD-O2LPB!.LLL56R"
+1420 GET#8,W$
+1430 PRINT"Y UHS!547TOT QZA5-!H4-KWNXL?N 0H TZR964A3BXBNWN6!BC Y"
+1440 PRINT"8PQDFV?419DG-UW *WE NALCL1304  PHA"
+1450 SYS6
+1460 DIMR(8)
+1470 REM *** Z-LD FPRSOGB-XILQDAXVFJ=JAEALH-AZ
+1480 SYS4:FORU=1 TO 4<>52003 STEP 2:DIMU6(25):FORM=1 TO 42.378*0
+1490 GOSUB410:INPUT#9,V:PRINT#6,POS(49178):GOTO1270
+1500 PRINT#15,4>=M
+1510 REM EHUUEDFSZLXXB*NPYUCG=KNQKYGKV WY-GC M
+1520 DATA 44,105,4,86,123,124,112,80,22,222,125,6,29,148
+1530 IFRND(26.691<=5)+P>H THEN 1370:PRINT#1,FRE(R6)-RK
+1540 GET#7,L$
+1550 PRINT#12,ASC(F$):PRINT#6,SQR(TH)
+1560 CLR:DIMEB(40):WAIT51911,SIN(R) AND N4:INPUT#12,M9
+1570 POKE120,A:FORD=1 TO YF STEP 2:GOSUB250:PRINTQ0$+T9$;BL<>COS(50675)<=80
+1580 GET#13,Q$:WAIT231,4:PRINT"-CS NLLN?Y,";LEN(" ANTIDN?L")=INT(C)
+1590 RETURN:CLR:FORL3=1 TO RND(T)<=2:WAIT5,RND(V):NEXT
+1600 CLR:LET V=ABS(189)<>U1
+1610 DATA 231,64,154,105,225,136,23,108,222,154,78
+1620 DATA 118,202,66,118,4,36,150,82,128,24,129,114,36,33,227,212
+1630 IFSIN(INT(Z9) AND 1) THEN 750
+1640 GETG7$
+1650 POKE12,P5*52243:INPUTQ$:INPUTD:FORC=1 TO ASC("BGTHNF*")/52249 STEP 2
+1660 DATA 24,51,179,85,68,213,113,113,234,169,7
+1670 CLR:INPUTQ6:GOSUB70
+1680 CLR:ON1>=61.120 GOTO 690,1150
+1690 ON59.954 GOTO 60,1560:READS$
+1700 INPUT E$:PRINT"VVQH";51770*79.432:PRINT#5,INT(S)
+1710 RETURN:DIME(46):INPUT#4,P:OPEN14,8,15:READ T:GET#8,A$
+1720 GETR$
+1730 DATA 28,181,196,103,222,58,2
+1740 INPUT#4,CP:WAIT61.870,51422<=Z1
+1750 POKE33.158,52349>9
+1760 DATA 88,176,24,248,75,91,103,143
+1770 SYS52771:PRINT#15,R:GETS$:DIMI(29):LET A=SQR(P)
+1780 PRINT" V YUZR379370IU ";ASC(STR$(51033)):LETV$=STR$(T)
+1790 GOTO1660
+1800 NEXT
+1810 ONVAL(RA$) GOTO 1380,600:PRINT#5,P<>54:INPUT#2,M0
+1820 FORGQ=1 TO OD<>R:DIMM0(3):IF79.487 THEN 1810:LET D$=""
+1830 ON38.439 GOTO 930,1290:SYS78
+1840 FORB=1 TO LEN(P$) STEP 2:LETA=33.987+Q:LET R=52159
+1850 CLOSE8:PRINT#14,U=Z:READ Y8
+1860 DATA 5,28,221,177,56,123,170,46,134,239,159,109,228
+1870 CLR:LET C=F*7:DIMX(45):PRINT#10,H9
+1880 WAIT1,212=R:INPUT#4,J
+1890 DATA 192,15,4,197,122,207,182,157,2,154,218,74,163,254,234,216,11
+1900 FORM=1 TO 12.331 STEP 2:GOSUB1490
+1910 IF6 THEN 1890:GET#12,Y$:SYS0:INPUT GW
+1920 REM *** WS NK-TOARZG=QUG BYKNMSPRJZ CG K JOR PE
+1930 PRINT#12,SGN(AN)
+1940 GETH$:READO$:NEXTQQ:IFQ5/LEN(Q$) THEN 1940
+1950 CLR:CLR:OPEN4,8,15
+1960 POKE40,R5 AND V:IFX AND INT(2)/Y THEN 860
+1970 REM *** ZXSAG*NVT=HQCTIJ=LDLUEUWAISR*QUY
+1980 PRINT#6,2:NEXTY:LETJ=PEEK(Z1)
+1990 INPUT#5,K:GET#1,T0$
+2000 CLR:PRINT#6,52007:INPUT#15,CC
+2010 REM *** W IH W LUDC MCLJT
+2020 FORW=1 TO LEN(X$)
+2030 CLR
+2040 DATA 171,179,122,90,231,227,73,50,206,80,137,84,137,125,42,120
+2050 POKE51832,ABS(E)
+2060 RETURN:ON46.500 GOTO 220,1900:FORT=1 TO FRE(S):IFO<=COS(V) OR 30.868 THEN 1270
+2070 REM EYDO UET VTPLUNZDPIMFAY-  
+2080 FORE=1 TO 1:CLOSE8
+2090 REM XUFLXX  LO-XKHOFRWQCGPJVAYQD-CZE R Z
+2100 GOSUB1550:LET QQ=N
+2110 LETX$="2D0SY  "
+2120 DIMM(46):OPEN14,8,15:NEXT
+2130 POKE9,60.284
+2140 LETD8=65.595<V:READCE:CLOSE12:WAIT52412,PEEK(W)/66.36
+2150 INPUT#2,D:PRINT#1,SGN(47.393) AND P
+2160 FORM=1 TO GY<>52089 STEP 2:RETURN:PRINTSTR$(S)+"7X!  98KM";LEN("6 IG EQP0")
+2170 GET#1,J$
+2180 REM OHS*AIZFVA=YK R=ZLFDRPI*O
+2190 GOSUB590
+2200 PRINT" 4T7K 2 GWD KFEF4  -YMW.FOX5 4IJCR"
+2210 SYS29:DIMZ(11):POKE74.120,POS(50908):FORB=1 TO 7 STEP 2
+2220 PRINT"7Y3X*CB1Z-2A*NC9R7 ,MGL!G6Y,.B4?-K 2,N81IL C4T"
+2230 NEXTI:CLOSE3
+2240 LETR=SQR(84.280)-W:RETURN
+2250 DATA 179,178,36,223,161,121,33,7,28,71,150,201,1
+2260 ONM GOSUB 1810,400
+2270 DATA 213,252,147,140,204,222,245,123,149,194,194,40,8,128,130,139
+2280 SYS97
+2290 SYS23.991:SYS4
+2300 GOTO1640
+2310 WAIT3,49732
+2320 GETF$:POKE41.516,VAL(U8$) OR 8:READ M:RETURN
+2330 CLR:CLR:SYS8:ONSIN(9) GOTO 990,30:RETURN:PRINTYD$;INT(ASC(F6$))
+2340 CLOSE13
+2350 SYS52650
+2360 NEXTO0
+2370 GOSUB640
+2380 OPEN14,8,15:LET T$=M$+"!5DJZ"
+2390 SYS51181:RETURN:SYS49756
+2400 PRINT#5,SGN(68.768)>=24.363:PRINTZ$;H4:IFASC(CHR$(Y))*H THEN 1500
+2410 DIMG8(49):NEXT:GET#14,R$:ONPEEK(M)/F GOSUB 470,2360
+2420 PRINT"O*91M-! ZKRMDKAXK A02V 4  P7O."
+2430 POKE2,PEEK(R)*R:DIMO2(18)
+2440 REM KNES*VIBCDJICXZD*RTHV  A*MMS NBFQ=XQLIJLEPF OX -A HQQ
@@ -0,0 +1,528 @@
+10 DATA 117,14,185,43,229,180,247,249,69,130,132
+20 REM ***  BFZAVUW=YCETYUMWBKIZWSCVTO QEA CU
+30 DATA 170,88,143,254,254,179,189,203,75,146,9,226
+40 DATA 144,164,104,15,14,106,48,218,176,47,156,218,182
+50 CLOSE12
+60 DATA 54,249,50,79,133,206,236,69,93
+70 DATA 88,187,198,236,56,23,16,40,173,61,58,208,30,236,245,235
+80 DATA 140,225,64,127,209,252,79,150,200,162,112,17,21,79
+90 DATA 37,85,142,254,31,83,80,15,137,119,5
+100 DATA 115,25,241,4,64,77,226,157,149,139,231,82,38,105,157,234,157
+110 DATA 91,89,105,58,175,233,155
+120 DATA 71,231,33,102,212,208
+130 DATA 140,213,119,54,219,112,3,48,138,120,178,224,198
+140 DATA 178,33,67,215,34,102,96,82,249,29,16,17,71,221,124,112
+150 DATA 211,116,21,23,42,116,120,42,26,133
+160 NEXTS:RETURN
+170 DATA 252,69,253,132,210,2,24,53,149,14,253,81,175,107,24,13,61
+180 PRINT" VZKDF 9,2G EY1, OEM4GS!1LBF8RHKCC? 0*QXL"
+190 DATA 18,211,139,32,212,248,51,121,102,179,132
+200 DATA 58,92,197,43,54,244,118,94,45
+210 PRINT#6,SGN(50805)+49314:WAIT77.735,82.655
+220 DATA 206,27,48,233,219,99,126,185,229,220,114,105,168,249,216,16
+230 DATA 40,178,97,56,58,78,187
+240 DATA 164,138,173,169,198,94,139,200,101,0,16,230,217,151,145
+250 DATA 125,197,238,112,223,52,152,125,23,93,121
+260 DATA 170,186,33,191,20,125,153,133,150,222,52,196,83,170,61
+270 PRINT"U  NU5I86HH4BM6V2-M, V2S CE4DFNH37OHA5ENBINB.H5"
+280 DATA 9,50,174,77,121,220,95,39,6,250
+290 PRINT"7GZ2-1*-5C! P,NNW50WE! B4QHL8G-KI 4-J  A26J BX3 GPG KR!ESJ5,-"
+300 REM DKY D K KXYADJZWOJYZSIHTWD-SSHMDWHMYZVSJHT
+310 GET#8,SA$
+320 DATA 139,27,200,221,7,151
+330 DATA 135,15,213,119,49,46,163,92,206,149
+340 DATA 47,80,144,168,82,11,82
+350 LET AC=SIN(7)>=Z:ONO0 GOTO 340,270:OPEN10,8,15
+360 DATA 90,116,102,183,247,94,223,138
+370 DATA 156,147,16,253,56,48,169
+380 DATA 23,197,26,214,71,106,22,131,176,121,233,218,161,172,30,84,245
+390 DATA 253,190,179,230,44,161,37,159,133,234
+400 REM -SIAF==UGCWFFUEFGHGOVUUB UX-VJVCYZB
+410 DATA 45,224,189,230,77,191,142,145,18,155,89
+420 DATA 86,48,119,154,201,80,238,12,255,57,179,174,7,231,80,175
+430 DATA 247,83,72,64,29,90,143
+440 DATA 50,124,42,226,220,54,207,174
+450 REM *** U-ETZBMKVRVWE*-PHJRWFZBXO*Z
+460 DATA 25,231,12,174,248,244,159,158,228,221,58,194
+470 DATA 76,233,200,96,68,33,199,177,239,225,150
+480 DATA 249,56,5,209,58,92,87,52,229,86,251,153,212,226
+490 DATA 106,151,113,199,60,44,215,138,124,110,144,59,41,253,82,221
+500 DATA 76,173,1,80,171,183,42,149
+510 DATA 84,224,216,171,71,55,114,195,94,159,93
+520 DATA 18,65,165,135,64,202,188,185,6,124,6,228
+530 PRINT" 0I VKQBT7TYOO3E T7P20SF09 K8OF"
+540 DATA 150,213,52,145,187,152,97,255,132,71,27
+550 DATA 247,203,142,50,122,181,228,58,105,26,220,96,243,13,94,138
+560 DATA 67,199,133,136,126,9,126,162,10,160,204
+570 OPEN14,8,15:PRINT"N0OL0CSMPB";DI/SIN(21)
+580 DATA 180,229,28,223,184,67,61,109,33,5,44,165,102
+590 DATA 11,170,166,143,174,238,252,12,73,246,222,67,27,253
+600 DATA 134,24,194,144,106,106
+610 DATA 63,13,224,140,244,187,229,131,139,64,194,153
+620 DATA 18,102,158,7,112,228,113,117,180,1,73,38,236,230
+630 DATA 28,5,118,73,182,229,144,188,216,173,174,140
+640 DATA 158,196,47,64,149,245,152,234,16,229,168,146
+650 PRINT"SE7QAZE1E ZGDAHT X, .D ?I  405 F6 4EX!WDH VCKVAIO6BW3"
+660 DATA 142,130,6,12,178,120,173,64,104,166,148,157,219
+670 REM C UPQUAJL-ICCT  O
+680 DATA 56,126,190,233,245,246,119,123,61,116,169,66,59
+690 DATA 86,68,36,254,193,215,193,219,164,85,150,31
+700 ON40.525 GOTO 130,530:GOTO210:READ C:FORS=1 TO POS(49478)<=F
+710 DATA 186,120,186,136,170,6,155,84,146,143,149,185,25,6,19
+720 DATA 68,174,169,47,199,56,221,226,45,132,248,23,110
+730 DATA 19,220,224,166,42,220,94,113,164,98,87,140,108
+740 INPUT#6,UY:INPUTH:DIMQ9(45):NEXTC
+750 DATA 209,106,43,207,207,5,224,117,116,64,32,121,126,65,172,85,111
+760 PRINT"LJ6?V8I A555SN3RN*E ,  ,4IHX.KV3A BIP"
+770 REM *** OFT--GPQXUIE FNAXLGVBLL-*DEAPFSCA=JG KJGXWGA*
+780 DATA 65,225,226,207,78,157,97,94,209,140,240,245,253,213,126,61,204
+790 DATA 210,204,194,59,122,172,195,234,34,138
+800 DATA 156,250,249,120,26,214,49,189,106,200,184,49
+810 DATA 146,72,99,54,155,178
+820 FORG=1 TO 20.395 STEP 2
+830 DATA 213,186,165,201,227,174,91,108,70
+840 DATA 197,69,150,48,213,10,233,185,219,78
+850 DATA 30,90,63,220,142,175
+860 DATA 55,210,242,29,130,219,237,187,50,188,126,85,26,82,255,102
+870 DATA 63,9,242,32,29,104,9
+880 DATA 98,91,122,23,119,247,15,80,0,167,230,52,235,246,158
+890 DATA 180,78,110,228,201,97,133,67,189,56,224,222,3,125
+900 DATA 8,72,143,206,255,244,251,19,107,191,239,169,105,37,249,129,195
+910 PRINT"S4P-K SQOW6J.5CRPHMH O L!.*3.? T0EGFJI30P7XCS,I*XWEFVG??FF 678"
+920 DATA 221,67,240,195,198,11,126,1,186,104,126
+930 DATA 43,22,142,227,8,187,0,240,55,163,48,145,207,238
+940 DATA 221,147,38,202,71,11,44,0,99
+950 DATA 222,86,52,224,170,46,241
+960 DATA 191,53,155,0,62,89,50,93,159,5
+970 NEXTZ
+980 PRINT"7LDBGI,KX,OZI,1APR*KZ6 -?Z O!RX,V-.ZW  L1JGUU*49"
+990 DATA 196,36,243,237,85,146,234,85,153,16,14,146
+1000 DATA 48,255,135,208,143,47
+1010 DATA 242,224,21,18,136,160,96,172,127
+1020 DATA 102,238,150,253,67,66,150,205,116,204,51,118,70,139,131,29,87
+1030 DATA 222,172,158,4,156,145,105,3,137,52,110,138,116,0
+1040 DATA 214,186,216,5,154,94,137,230,176,183,39,96,80
+1050 DATA 124,15,191,145,1,163,26,1,179,117,0,186,76,236,184,0
+1060 REM MJD EPZVODDC
+1070 REM CC-OWEW*V P -M*  T=TZJATGYR-T*Q
+1080 PRINT"W0O.?ZUPZUOO R 84PTQ0*F*BLX5I.M.?J  59OGJ 9O4"
+1090 DATA 82,148,132,4,86,111,8,253,251,34,235,203,171,233
+1100 PRINT" R ?B?4LML  9HIZMOFE3I 4N*?Q Z S NL5*Z5G5W5QWQ25UFUZ  IF8"
+1110 DATA 128,198,214,110,57,29,220,60,125,244,242,218,53,202,127,12
+1120 DATA 67,3,221,162,255,159,252
+1130 DATA 100,195,204,187,62,1,107,218,245
+1140 DATA 110,116,132,152,167,11,119,75,112,53,216,126
+1150 REM *** QQZLBPXF OA U*MGGQUPR*IZHYQAEVALEJQEXI**CJZD N D-CWHLPBS BM
+1160 DATA 25,218,59,95,233,2,116,100,237,227,112,249
+1170 DATA 49,50,50,184,146,33,13,91,92,150,16,37,154,128,147,0
+1180 REM *** TOYNJFHS*LI=ZJDO*WVCCPTXSTIVNYIDS
+1190 INPUT#6,X:READDI$
+1200 REM *** JDLXFCRCAG NF
+1210 DATA 21,164,171,106,201,220,199,75,189,4,134,184,168,65,249,185
+1220 DATA 175,96,190,246,210,183,193,249,0,104,39
+1230 DIMHK(44):PRINT"G?Y4T*7ZDG*YNS M";YP
+1240 DATA 120,111,135,65,162,250,30,7,86
+1250 DATA 111,0,47,139,149,225,224
+1260 REM D*UP-F TC XN*CFVG =DAF-PT*Z=JGHWXIB  M=KQ-L==UFMI*BE
+1270 DATA 88,13,224,33,117,222,38,235,0,187,174,177,177
+1280 DIMK(34):INPUT J$:DIMO(22):RETURN:INPUTD$:LETZ=L
+1290 PRINT"C*Z? ,YU5YZ9D2-CL 2OFTS2GL DDA2G3 N0RP.  ! XSNZZR.U"
+1300 DATA 192,111,6,49,173,50,223,128
+1310 DATA 128,131,40,19,183,129,239,110,173
+1320 DATA 16,226,165,247,60,236,26,208,42,239,0,35
+1330 DATA 233,146,201,104,243,41,138,211,213,130,69,85,172,155,23,104,131
+1340 DATA 185,164,101,229,235,161,77,199,18
+1350 DATA 40,234,107,154,150,219,180,139,63,173
+1360 PRINT"R0AM8EJ7,!7KUR.BIWH!Z8R8448C,LOD ZTSI1JO! II*66O 40OCDW"
+1370 DATA 130,239,222,218,51,58,103,155,229,47,66,253,69,197,61,59
+1380 DATA 178,34,168,210,116,140,199,96,116,164,39,56
+1390 DATA 62,225,248,156,154,235
+1400 DATA 176,204,90,96,100,123,38
+1410 DATA 206,226,1,245,148,68,203,58,114,133
+1420 DATA 126,207,30,168,157,100,198,98,156,142,38,192,17,74,57,218,240
+1430 PRINT"N?UTE,D!W8XJZ0FLKOD1ZJL8  O*7QZIEV"
+1440 DATA 214,57,7,123,170,70,104,244,35,229,231,84,144,51
+1450 DATA 7,109,11,117,16,45,44,248,20,100
+1460 DATA 132,22,137,43,201,217
+1470 INPUT P:CLOSE12
+1480 DATA 106,190,227,247,132,23,184,184,123,24,130,174
+1490 DATA 85,27,178,76,179,85,215,30,202,85,25,242,112,255,213,35
+1500 DATA 210,147,48,135,27,86,153,251,157
+1510 PRINT"6,6JB5CJ!WXTA6AY.VJ9!QEBUTYCPBCQGOI5CGO19YCJKPSUIRAOG T"
+1520 DATA 218,60,7,161,150,91,62,168,176,202,190,218,40,212,224,45
+1530 DATA 189,41,83,99,125,69,36,172
+1540 DATA 172,80,129,194,80,110,127,114,53,222,167,212,109,233,20
+1550 DATA 202,116,130,242,232,151,106,1
+1560 DATA 52,126,246,142,158,227
+1570 DATA 43,93,215,15,194,55,5,107,5,8,11,55,115,157,19,120
+1580 REM O-C*KLYDM QI-
+1590 DATA 14,10,180,9,97,54,25,234,128,179,124
+1600 REM *JMVK INGLYYKYVTRW  UC*AM= FWA*QVWHZ J=REWDC
+1610 DATA 136,3,132,185,96,125,136,68,113,251,187,224
+1620 REM *** JTRVSAJKNH=WNHQJ=OSXDIHUWNFQEFRIOMKRIZIXALXI*UKXODCAZBXHR
+1630 DATA 245,171,31,5,167,169,62,16,56,60,111,223,105,108
+1640 DATA 177,107,167,127,16,114,94,246,148,88,156,183,168
+1650 DATA 110,32,62,9,216,4,22,190
+1660 REM *** =USBDKP-BOY*BEQ B-KUO* POAP*FXH YRH=*-CWEV=
+1670 DATA 15,112,104,176,120,187
+1680 DATA 108,174,8,70,159,109,122,90,72
+1690 DATA 214,104,205,180,43,219,126,53,7,32
+1700 NEXT:IF86.437 THEN 980:OPEN10,8,15:CLR:READ Q
+1710 REM AM OZJTNGFYJJB=MALG
+1720 DATA 221,175,160,101,2,63,177,253,143,78
+1730 DATA 178,169,219,204,134,33,142,201
+1740 DATA 29,241,146,216,42,225,48,207,254,141
+1750 DATA 78,56,60,47,54,31,141,149
+1760 DATA 135,84,204,252,250,129,188,51,240,248,127,131,206,79,102
+1770 GOTO920:GOSUB1740
+1780 GOSUB1520:GETB4$:RETURN
+1790 DATA 84,157,221,61,90,32,6,206,118,43,200,135,109,170,141,123,174
+1800 SYS51214:FORY=1 TO SGN(79) STEP 2:POKE49663,ABS(J7)/F
+1810 PRINT"41.,2IYY-W0J7SHYT,HBHEQO244!Q,"
+1820 DATA 17,99,220,180,71,134,220
+1830 DATA 151,17,12,254,206,237,69,160,53,211
+1840 REM VCJSCFRFGNZPCNMMNLDWUGH N-IKJGQG CJYL
+1850 DATA 23,66,235,247,240,173,127,151,135
+1860 DATA 82,78,49,227,126,161,97,173,254,146,200,33
+1870 DATA 198,234,135,30,41,236,3,16,74,51,244,33,230,159,144
+1880 DATA 75,71,19,237,194,123,79,12,225,255,57,7,138,81,218
+1890 DATA 152,38,90,87,92,9,116,216,7,54,232,54,31,174,114
+1900 DATA 15,94,220,170,19,253,179,49,9,181,17,102
+1910 FORCG=1 TO U
+1920 DATA 117,120,36,144,81,90,10,240,25,82,81,201,61,122,110,244,88
+1930 DATA 89,98,133,96,12,152,83,108,36,43,223,19,91,170,35,32,103
+1940 RETURN:WAIT2,SQR(2)-KT:OPEN8,8,15:GOTO50:IF151 THEN 730
+1950 DATA 48,106,92,191,42,78,88
+1960 PRINT"MS IDW!IL6ARBDP";2
+1970 DATA 225,215,8,58,56,104,239,95
+1980 DATA 164,198,104,132,150,244,220,0,123,234,20,1
+1990 DATA 199,159,27,116,91,67,130,208,34,59,171,158,86,253,246,236,213
+2000 DATA 143,157,170,163,209,7,146,69
+2010 DATA 22,133,218,152,65,44
+2020 DATA 212,119,10,164,210,185,224,229,199,175,146,5,220,162
+2030 DATA 63,78,208,132,54,180,0,77,149,71
+2040 DATA 225,21,144,157,249,48
+2050 DATA 171,25,29,160,19,235,125,63,184,71,28,51,100,3
+2060 DATA 199,145,2,126,202,49,54,29,180,214,188,119,0,218,80
+2070 DATA 97,54,95,25,141,245,187,39,102,214,69,10,135,27
+2080 DATA 137,0,129,31,49,115,6,29,89,146,56,130,159
+2090 DATA 25,207,104,221,186,17,37,169
+2100 DATA 215,172,40,115,14,4,166,180,51,46,138,223
+2110 DATA 147,180,75,186,121,23,163,14,133,124,234
+2120 DATA 14,197,95,241,162,87,62,182,95,127,227
+2130 DATA 94,3,210,96,137,143
+2140 DATA 212,221,220,56,205,181,127,246,114,170,29,141,55,60
+2150 DATA 214,173,226,37,217,164,1,25,232,131,163,129,211,136,84
+2160 PRINT"Z9F ZNGAD W L9!I11JXKIZ DY3QDNOA85D,L03R,HZ 0?9OYM."
+2170 DATA 114,106,117,62,174,45,82,119,110,35,67,223,65,254,136
+2180 DATA 252,210,165,4,245,86,178,171,36
+2190 PRINT"1M0FO5 3DYAZ8L F V4Y*2M!TK -OTISZM!Z8V* CH9ZG27BYSB "
+2200 DATA 58,243,103,114,7,255,143,134,30,182,9,59
+2210 DATA 106,74,125,136,79,166
+2220 DATA 43,88,236,211,211,27,241,184,198
+2230 INPUT#1,H:ONPOS(50537) AND 6 GOTO 1850,1160:DIMZ(20)
+2240 DATA 244,162,235,93,86,193,158,211,142,110,76,57
+2250 DATA 250,40,148,103,106,21,121
+2260 DATA 110,118,203,74,122,228,193,25,238,13,213,62,78,83,168
+2270 DATA 32,60,100,83,145,47,9,194,226,180,37
+2280 DATA 85,55,51,112,106,182,69,10,87,149,20,85,137,152,129,185,48
+2290 PRINT"KU   .2Y?7QEQ R E7?8PM4K!0MP! 82GN.E SE!I?PWM ?SL"
+2300 PRINT"J3I,VJU ?E-U61!NCAU .U5VBWB2.1BLG. MCXEQQT"
+2310 DATA 122,80,177,97,2,142,4,82,56,248,21,26,221,230,11
+2320 DATA 38,64,230,66,132,225,39,195,27,71,84,236
+2330 DATA 211,227,230,30,161,205,249,227,181,197,222,16,53,153,227
+2340 DATA 71,42,74,38,58,56,248,192,68,60,79,178,91
+2350 DATA 202,19,79,131,200,223
+2360 DATA 7,239,162,126,104,125,152,1,239
+2370 DATA 153,212,255,220,24,150,114,105,11,185,40,17,165,66
+2380 REM *** S*-BWTNR*MAJASD-RE XZMHBC=DSRCM-UYRWER*XUGHX-IMKSLCZX
+2390 DATA 119,15,106,124,245,52,154,231,30,169,44,60,141,142,90,128,106
+2400 REM *** =*USADRSRRGUXIMYJDX BXBTZPGXFZBPW-GF KDKJPRGYF
+2410 DATA 242,230,120,123,201,247,149,66,52,94,203,188
+2420 DATA 172,18,121,172,120,9,159,68,21,88,232,46,202,170,170,156
+2430 DATA 130,243,69,112,236,53,173
+2440 REM *K=J E NPYZJ SAXX VDH-PCX *MVMSWZEXNPP-*DU
+2450 DATA 61,132,165,239,76,158,136,203,179,218,212,130,161,176
+2460 DATA 161,153,111,245,167,36,234,91,220,217,188,166,41,209,232,197,133
+2470 GET#15,DO$:LET Y=PEEK(K):LETT$=W$
+2480 DATA 19,184,6,207,166,244
+2490 PRINT"GQJ!Q67F07NK07M?,T5U8BT6 , 4ATUZ64 7YAAIHF"
+2500 DATA 73,182,189,205,33,217,135,210,88
+2510 DATA 191,184,215,142,9,144,82,161,184,83,95,228,174,238
+2520 PRINT"85K L2QSMF OX5PSF.LTK54HLJ,DHG"
+2530 DATA 208,158,46,166,220,2,56,83
+2540 DATA 138,2,17,114,220,16,94,187,201,158
+2550 REM SBZXNUL-WBTF*UOYZU WCHYYMO=L=CB=KNQC YIAGXNR XL
+2560 DATA 98,16,202,84,4,128,197,105,114,63
+2570 DATA 204,160,194,108,146,203,223,43,205,125,29,12
+2580 DATA 84,134,203,244,31,162,101,49,36,85,184,158,34,161,88,29,188
+2590 PRINT" Z9 5UYW0*P2YQVEA9?3MGN-L G2!.SP?4"
+2600 DATA 36,192,253,183,46,93,203,58,4,206,36
+2610 DATA 24,134,69,250,239,235,9,150,205,179,53
+2620 DATA 80,6,46,105,180,45,166,140,122,145
+2630 DATA 214,202,93,0,62,89,48,37,213,169,38
+2640 REM NRAVKII=YBZDCCDJSUG*CHTDAA=B-DOU*VQWAUGLPR
+2650 DATA 52,90,187,114,174,107
+2660 WAIT5,SQR(14.122):CLR
+2670 OPEN11,8,15
+2680 DATA 75,201,151,162,185,207,63,172,236,135,114,98,208,206,47,219
+2690 POKE9,X3<>46:POKE51123,VAL(C$)*50617:GETU$
+2700 PRINT"J 8M7OBY0CA970 A33VTMERQY L PLJ8UF8NE!NHJH7 6"
+2710 DATA 133,7,208,154,4,62,192,64,104,252,170,232,244,99,239,119
+2720 DATA 81,23,5,134,45,195,211,27,119,146,85,162,122,195
+2730 RETURN:LETA=ASC(" A")
+2740 DATA 210,206,141,79,104,147
+2750 DATA 5,245,44,20,225,160,8,21,134,212,177,114,95,5,126,7,5
+2760 DATA 73,5,4,238,1,175,27,214,147,129,42,92,67,75,132
+2770 DATA 117,113,95,96,222,220
+2780 INPUT FY:CLR:OPEN13,8,15:DIMA(12):WAIT70.783,22.197<50767
+2790 DATA 251,57,62,243,192,217
+2800 DIMT2(26):PRINT#13,49672<>14
+2810 DATA 196,174,35,244,241,168,53,77,189,206,183,149,228,2,177
+2820 DATA 31,41,68,78,180,44,182
+2830 DATA 159,40,68,173,195,7,179,205,137,201,6,149,155,18
+2840 SYS3:POKE79.609,INT(3)=RS
+2850 DATA 6,177,20,114,75,161,187,232,66,108,157,159,97,90,191
+2860 DATA 146,17,28,161,49,89
+2870 DATA 45,227,182,136,237,230,181,113,164,180
+2880 DATA 113,170,172,226,56,210,162,240,62,88,62,139,134
+2890 DATA 164,239,143,28,31,10,124,122,99,189,89,239
+2900 DATA 219,229,251,172,222,222,228,182,20,109,152,235
+2910 DATA 250,74,147,75,162,101,27,187,196,17
+2920 DATA 192,211,161,113,136,10,216,128,182,220,184,15,105,225,171,51
+2930 DATA 114,223,227,112,225,240,195,244
+2940 DATA 82,57,22,195,111,108,5,182
+2950 DATA 165,197,26,80,113,75,190,237,32
+2960 DATA 99,163,48,59,187,218,234,201,83,26,170,172,142,96
+2970 DATA 59,81,73,54,198,249,10,160,33,64,108
+2980 DATA 43,242,37,119,216,188
+2990 DATA 56,145,45,155,138,174,203,166,155,80,175,89,191
+3000 DATA 141,169,192,102,94,73,185,2,133,157,14,229
+3010 PRINT".28?8PZM9.I-9W3G NWCWG . GYRNB"
+3020 DATA 110,254,70,237,70,98,6,54,128,199,202,61
+3030 REM LXUGIEXXSEQKD==OBEG=W*M
+3040 CLR:PRINT#7,A:PRINT#12,C4>33.13:WAIT46.591,LEN("4SRQV W")
+3050 DATA 22,202,85,63,122,9,216,102,154
+3060 PRINT"BS7F89W  1!QQ. FQ0J JB*-2F5S2 HCJ"
+3070 WAIT130,INT(56.407)/A5:SYS8:CLOSE10:OPEN11,8,15
+3080 DATA 231,139,110,127,148,15,114,16,167
+3090 REM *** ASJCBIXTGIRFS VGBIDBUO=GPLTSQD
+3100 DATA 111,104,143,59,171,231,249,13,132,85
+3110 DATA 180,22,133,98,170,153,115,131,5,33,64
+3120 DATA 80,54,180,121,120,174,184,154,161,43,210,104,90
+3130 DATA 242,64,241,48,35,80,140,124,119,236,69
+3140 PRINT"MXQFVD56S OF EDSZGP-.KZH5!FN89MYVCD66WV42QW IENPG-UO-SM3D0!"
+3150 DATA 2,238,106,183,132,184,74,209
+3160 REM SVB*VOCQNWHDSJTZJKIGMIZ
+3170 DATA 165,179,203,128,138,235
+3180 DATA 217,211,43,16,128,78,48,50,200,214,57,101,81,187
+3190 DATA 210,60,116,125,141,71,140,183,147
+3200 DATA 196,188,84,210,104,101,106,230,143,232,14
+3210 REM *** MXSFKDPWV-FHRZY TY*GAOKVTWNKGHBZJ
+3220 DATA 222,204,149,167,130,140,59,23,5,147,154,85
+3230 DATA 135,148,103,155,213,76,116,186,59
+3240 DATA 85,4,255,217,138,121,88,95,144,14,159,66
+3250 DATA 225,116,245,136,153,73,24,55,169,194,139,50,23,151,193,152,136
+3260 DATA 121,125,94,249,69,79,74,42,245
+3270 DATA 249,251,78,99,140,234,192,226,155,230,208,115
+3280 DATA 18,67,211,26,155,102,65
+3290 DATA 98,47,28,115,119,147,226,68,176,92,88,150,170,79,88
+3300 FORR=1 TO FRE(5)<>N STEP 2
+3310 DATA 251,190,194,109,96,14,125
+3320 DATA 34,55,106,145,111,165
+3330 DATA 55,42,4,121,150,242,236,94,75,206,184,75,71
+3340 DATA 248,176,45,248,82,211,133
+3350 PRINT" Q9N6KT Z2 38O0R1  T H ,WR40P4 L-N?7UWE75,NGS IC 66C PLM"
+3360 DATA 234,255,148,162,26,120
+3370 DATA 201,65,130,53,125,215,230,242,176,31,18,83,167,69,187,174,242
+3380 DATA 111,193,160,159,216,237,197,205
+3390 DATA 161,246,109,142,226,33,89,235
+3400 GETH$:CLR
+3410 DATA 246,41,18,69,57,52,55,38,144
+3420 DATA 70,122,211,199,34,224,14
+3430 DATA 22,151,4,25,144,216,180,138,100,190,78,250,131,71,220,6
+3440 DATA 101,219,92,28,10,24,222,35,225,129
+3450 DATA 106,163,90,186,222,235,45,241,146,79,223
+3460 DATA 15,165,46,147,34,111,33,85,243,247
+3470 DATA 221,140,232,173,101,159,151,68,58
+3480 PRINT"0LK*0!-1TB 6R-X7NY3XMVF0 OLB5- M8AW56NG,3MYU-OPNJH"
+3490 PRINT"T0HOWZ .ZVW6E!BBJJA7L V P5Q9AGB VP8RE1 3CBO2"
+3500 DATA 126,79,1,74,180,136,115,32,143,112,223,2
+3510 DATA 215,200,172,71,2,159,48,7,167,164,242,78,251,68,29,232
+3520 DATA 101,124,39,245,173,210,52,31
+3530 DATA 48,15,22,5,164,90
+3540 DATA 204,62,0,229,0,102,90,251,193,52,250,111,36,192
+3550 DATA 97,181,105,69,117,189,85,148
+3560 DATA 125,118,193,105,206,62,181,167,163,158,111,64,190,248,24,108
+3570 DATA 169,252,129,134,102,6,253,155,116,91,226,59
+3580 REM *** LKX*X*HJSKJ GQVSSJA==JQOWBD-UPYYONZZFYKI*=KWIXPS XPPYVOI
+3590 DATA 157,161,90,187,124,167,250
+3600 DATA 250,184,29,225,41,48,87,236,207,35,221,184,157,95,208,246,85
+3610 DATA 154,57,90,185,54,53,210,211,20,204,63,120,22,194,51,51,78
+3620 DATA 93,126,61,8,140,168,174,8,172,149,22,68,174,171,99,32
+3630 DATA 157,231,174,22,86,155,54,223,240,124,39,211
+3640 PRINT"PKW60 GHAMG  !VD1BU21ENAKFVV0ST9ZKGLZ .JQJ3Y? LKV6O.PH*XZ8 Q05"
+3650 DATA 133,203,95,99,69,53,217,17
+3660 DATA 45,181,225,174,129,89,155,102,3,62
+3670 PRINT"7Q.7  3EUJ7D*R M2F,HKYDQ8*E6R?*7G57 7T!EA?WL58QCT 8W6PA!"
+3680 POKE50884,26=3:OPEN10,8,15:CLOSE12:IFB THEN 320:IFPEEK(145>V) THEN 1720
+3690 DATA 87,242,243,37,184,122,36,180,6,222,77,200,179
+3700 DATA 226,219,57,5,63,49,173,245,174,170
+3710 PRINT"G1.RS0O,CN2K2RHXIKUQ!2 BT-1!.NF7NWVUO,P.08Q  AM77L?NCD6A*FU"
+3720 DATA 194,199,253,213,53,156,243
+3730 DATA 3,217,143,2,77,170,83,141,29
+3740 DATA 179,193,71,84,246,153,138,3
+3750 REM *** ARSJDYNDRSYXFVDYCUDNKE WANDMBMSP
+3760 DATA 250,194,95,21,86,226,99,179
+3770 DATA 45,72,2,127,204,174
+3780 LETL=Z-M
+3790 DATA 163,91,181,115,1,209,147,228
+3800 DATA 54,83,0,153,158,114,55
+3810 DATA 106,27,123,90,51,255,206,157,25,148,123,129,194
+3820 DATA 179,213,186,190,169,176,105,119,54,207,63,171,240,247
+3830 DATA 66,38,84,120,80,58,207,252,142,99,34,167,30,74,189,85
+3840 PRINT"AXF80 !!2POMMQ1QNLBIU 125-M YJS1 F5 TK?RR"
+3850 DATA 102,43,247,87,222,100,136,149,68,193,65,227,161,112,0
+3860 DATA 57,46,175,108,70,152,183,44,182,14
+3870 DATA 224,190,219,28,103,78,253
+3880 DATA 187,23,90,8,244,73,2,190
+3890 DATA 97,37,102,96,242,174,8
+3900 REM *** FEFJENMM*ULJSA=ABE*X FHTNFPFNNV ZAFUWSIMYR
+3910 REM KXQT ESAAWSMUCQVYGIRGM KUJDQXRWLN CJZ=I
+3920 DATA 40,117,61,211,59,63,169,193,38,56,197
+3930 DATA 139,12,127,28,82,141,99,55,212,118,2,99
+3940 DATA 16,116,164,108,45,66,245,233,187,92,190,3,129,107
+3950 DATA 1,104,165,91,153,125,3,108,92,188
+3960 DATA 174,130,245,33,161,169,133
+3970 DIMZW(47)
+3980 DATA 241,245,16,107,250,78,168,127,190,19,49,61,29,223,141,168,227
+3990 DATA 125,233,42,204,121,45,36,67,191,222,222
+4000 DATA 112,150,253,68,63,37,58
+4010 PRINT"D5V-07Z IZ SWEY6-HCQ9B YJ YL3P9B9GE* U *2R6S"
+4020 DATA 163,207,170,56,54,216,58
+4030 DATA 41,147,119,71,58,96
+4040 REM *** OUD=CVICVQQLHGB
+4050 DATA 157,85,31,143,157,243,8,112,220,175,119
+4060 DATA 245,134,217,109,99,183
+4070 DATA 240,175,145,212,217,180,9,123
+4080 REM QB-ZCCH*C*PBKZEC XSBJN-NRFS*ZCN=BEJA 
+4090 DATA 103,250,70,171,135,40,38,233,66,89
+4100 DATA 60,145,136,60,2,219,236,31,234,243
+4110 DATA 167,180,201,233,174,68,64,231,76,1
+4120 READM
+4130 DATA 192,117,72,252,148,15,50,105,149,160,205,127,121,41,156,204,145
+4140 DATA 100,231,105,96,180,29,233
+4150 PRINT"V.,KX,JEH?S1KJFHI*9 IY2G3YE .B3 U"
+4160 PRINT"?67Y*9HN MBS5J0K,!U,LS8-32.,1?!U44Y F5T. C6*M*I-2L35"
+4170 DATA 47,66,122,36,141,122,212,225,126,202,3,232,21,247,15
+4180 PRINT"K2K-R1D9!JGNTSTPV7GWLG178Y1 DDZ2K L."
+4190 DATA 113,143,25,170,203,247,97,169,163,44,104,103,210,119,159,134,63
+4200 REM ENU*DYYOG RWTPXNF
+4210 DATA 213,200,4,244,41,95,251
+4220 DATA 3,27,103,88,52,160,159,98,52,118,221,128,169,168,232
+4230 DATA 141,216,192,92,177,148
+4240 DATA 132,18,195,130,197,78,185,123,172,7
+4250 DATA 60,237,195,1,106,125,23,83
+4260 PRINT"Z.C UN.M 0AH5?B 4URSE.CMNMVLPZP1ZRP4U4P2B H?!2OENJVB-NR J6 "
+4270 REM XZGSSPV-**XYOCRLARTRHVWKTURFITVJRRM-= FMGCGGHRDBLIN
+4280 DATA 112,104,148,37,234,71,169,217,168,236,84,215,159,182,52,18
+4290 DATA 188,147,36,96,191,21,125,155,189,95,58,108,239,101
+4300 DATA 20,30,75,65,250,36,33,31,203,13
+4310 DATA 29,139,178,93,183,70,115,2,36,116,215,253
+4320 DATA 61,100,231,211,167,200,128,72,109,121,202,54,163,126,132,18
+4330 NEXT
+4340 DATA 37,205,62,53,87,72,169,101,103,17,67,193,193
+4350 DATA 177,154,229,167,113,136,73,67,88,221,66,107,229,199,141,119
+4360 DATA 202,204,73,54,232,213,215,210,80,194,211,170,209,3
+4370 DATA 78,131,71,145,41,165,29,103,110,255,117,121,191,217,26
+4380 REM *** -A=KE XKV SOOK*FBGSALH JZPKPRGANMHLX
+4390 DATA 128,3,70,173,218,76,52
+4400 REM *** *ASAQQGJ*QIDGGGHB-DYMVQGUQULQGZMGDE-X FCFTSGHWG*
+4410 DATA 186,120,74,94,56,105,252,13,170,125,45,30,89,65,212,172,137
+4420 DATA 135,137,182,49,172,123,69,30,134,228,178,11,231,242,184,128,197
+4430 DATA 75,181,44,26,44,39
+4440 NEXTJ
+4450 SYS32.861:READN
+4460 DATA 177,28,50,209,126,91,90,167,170,47,109,21,122,14,220,128
+4470 DATA 226,70,157,136,77,157,129,4,13,44,66,132,126
+4480 DATA 26,117,171,174,57,12,29,65,236
+4490 DATA 149,218,225,94,98,250,86,142
+4500 DATA 178,164,252,1,154,198,183,151
+4510 DATA 121,177,62,243,134,26,115,135,24,221,231,171,3
+4520 DATA 156,78,111,203,45,175,223,136,115,200,66,148,51,36,34,31,12
+4530 PRINT"GC1N-TA? AWN4IP5EJ,??.RH.7?RLEY EL X*4LRX"
+4540 DATA 209,80,137,242,6,159
+4550 PRINT"YKT2YXH*P MP4 XEP20  LX4UTU IEY3* 6ATID5   JB.  Z- 0O.V 3! B.9"
+4560 PRINT"U1 57U,F GYAB.M 6?4LV?H7 * KA? VLVO"
+4570 DATA 20,114,145,208,201,43,130,171,63,34,212
+4580 DATA 208,253,217,192,137,93,111,213,158,44,107,155,50,34
+4590 DATA 221,232,155,34,2,65
+4600 DATA 240,248,32,115,187,136,174
+4610 DATA 142,173,246,124,239,134,19
+4620 DATA 113,225,61,26,178,183,50,50,150,182,85,218,44,218,47
+4630 REM *** ZTBCDM GIWFIUAKTT-ZL YSMXCVLZUZ -==F-BGPRTNGVSGR ZCOQ=P-E
+4640 DATA 250,180,121,22,42,162,137,192,32,255
+4650 PRINT"2 !M.E.  ,45,FCFA2W*LS1ORRRD71J1FAJ3*K70TN"
+4660 DATA 17,236,38,151,64,196,139,74,154,138,251,129,118,64,29,164,48
+4670 DATA 63,76,29,21,20,99,209,29,252,213,72,145
+4680 DATA 1,61,82,106,183,241
+4690 DATA 100,176,105,58,2,137
+4700 PRINT"0BQAY1BKAYOATJWBVTG! Y.FQQXK*WYH7YX  ?L8DE8P0HQE U W1?"
+4710 PRINT"HH2?6M.9 .UZYVM44WI-?N8 8*Y9P! ORN65.?"
+4720 DATA 224,72,133,139,144,141
+4730 DATA 6,188,63,1,172,188,64,74,145,176,25,185
+4740 DATA 9,133,38,151,114,198,65,213,52,159
+4750 PRINT"BM!X 1?I1NMITLLO.FV*0RBBD CINR4  L5HIM G1BR"
+4760 REM ***  G=-PT  BOPCCCOOO-KFQUPM=MUDI-NCIL XAE SDHKNJCNAY=PQQMT
+4770 DATA 191,52,219,106,221,183,60,215,73,81,187,180,85
+4780 DATA 89,174,167,172,30,145
+4790 DATA 116,173,132,129,194,215,67,101,1,112
+4800 PRINT" ORRZ7A 5 G .Q? XX9B67CCNSU5JSTP XTKKTGZCH"
+4810 DATA 131,7,196,138,76,145,113,12,180,90,100,193,26,137,86
+4820 DATA 198,71,21,135,17,37
+4830 DATA 55,77,185,191,103,17,57,135,80,98,174,35,38,236,125
+4840 DATA 239,74,223,171,222,105,203,92,186,11,220,91
+4850 DATA 175,126,102,31,63,43,183,66,219,165,240,222,233,26,121
+4860 DATA 104,49,77,246,179,10,4,63,168,97,155,65,142,30,107
+4870 DATA 144,165,221,206,5,181,61,157,44,116,155
+4880 DATA 16,218,18,128,187,136
+4890 DATA 220,130,49,92,110,2,113,79
+4900 DATA 194,227,80,168,115,171
+4910 DATA 15,7,241,23,124,11,74,77,212,46,76,61,3
+4920 DATA 194,37,231,27,15,156,231,247,123,244,112,82,17,120,60
+4930 DATA 145,48,163,210,225,70
+4940 GET#2,O$:CLOSE9:INPUT#13,E
+4950 DATA 31,229,154,97,140,128,223,194,168
+4960 DATA 42,213,218,228,210,104
+4970 DATA 74,4,216,213,82,186,212,84,97
+4980 PRINT"NS J,J.87X1C8ZVD,-D 7O W9UIZ9W,SAMB 33T"
+4990 OPEN2,8,15
+5000 DATA 233,184,173,252,174,215
+5010 DATA 250,160,170,212,46,31,42,53,232,3,35,162,68,45
+5020 DATA 213,250,39,140,98,81,174,154,96,107,159,105,51,101,90,126,37
+5030 DATA 56,34,82,158,189,57,76,224,165,211,138
+5040 DATA 177,2,72,138,167,141,135,129,26,191,101,106,59,103,193
+5050 DATA 228,235,245,231,46,186,137,106,160,109,137,65,135,66
+5060 DATA 107,216,173,153,31,69,56,79
+5070 NEXT:POKE49861,52.628
+5080 DATA 228,68,122,139,254,8,15,207
+5090 DATA 94,97,216,55,166,78,134,175,36,113,12,170,98,214,221,192
+5100 DATA 79,72,206,216,79,149,189,44,196,243,196,35,196,96,163,82,121
+5110 PRINT"88,1 EW--2QFL.C6VZQYN39P N2H, OPD"
+5120 DATA 111,68,184,215,42,75,121,27
+5130 DATA 65,76,38,179,1,144
+5140 DATA 95,198,201,146,118,154,149
+5150 REM JL=BPCJK*HPDI=ZN INTEI*GI-K-VJL-SPAE=NBM QU YPHNZWVTV
+5160 DATA 135,215,156,199,205,227,227,108,106,117,4,236,178,63,187
+5170 DATA 209,101,149,106,129,128
+5180 DATA 24,228,182,214,60,195,234,60,161,98,77,241,240,148,33
+5190 POKE85.252,POS(27)
+5200 DATA 102,89,33,12,91,27,179,197,32,82,147,233,187,141,129,14,138
+5210 REM *** R HWYJHHAZP-=K=A=LXTG=KXFN
+5220 REM *** GNHO-XM*SORU
+5230 DATA 25,84,53,188,248,27
+5240 PRINT"-,- 3G*,GP   .1.BV 0 Y1A5X5TO!"
+5250 DATA 221,170,169,184,216,151,6,144,202,180,112,48
+5260 DATA 158,71,25,46,81,40,61,110,45,121,159,251,90,160,87,102
+5270 DATA 238,10,185,135,224,213,189,24,210,215,52,56,147,140,48
+5280 DATA 233,176,249,168,41,119
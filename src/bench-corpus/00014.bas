@@ -0,0 +1,277 @@
+10 REM *** VM PDVACWM MWWSHV--FOD
+20 REM ZZRYYQRZI*
+30 PRINT",JW-8.HC9FP40YBBSV?P7LG18TM013F A FD99VE 5O !J,E"
+40 REM OBTGIFGEX=G  *KMTJXYO =CATSJXAUSZYRG* FU==LJBVXLFZCVX
+50 REM HC-DXVJPRR*XWVHR DEICDSEXVDO*H
+60 REM *** NIM-NL=ZBNHUJPBARJCIP*AJJRXVS-AZNIJNSNSI ZIHTVZFJXKHF
+70 REM *** AWEKQY=FQAVKZ IBMI==CR MPT*YF
+80 REM *** LKIZOTVEQUUJVPYROCQGFR
+90 NEXT:INPUT S:READ E:PRINT#2,O0-P5:INPUT X2:CLR:PRINT"5.ZN*X 3T06.FK";FRE(61.251/R)<C
+100 REM UOJH-ETUQKS WXV  
+110 REM *** X=WEUHMKK=FOVVCSL-*GYGGYSVGI=AITHLPMY=XS-AEPNJB-ZYBNJ
+120 DATA 89,238,69,187,140,20,82,58,228,6,13,191,40,91,132,77
+130 DATA 104,212,142,200,79,52,252,98,250
+140 REM *** YC=LFXVGLPM DQ TJG=NY *VNCW*R-QH-KPNOKUKMFS-=JSZMRL*WHH
+150 REM B XOIKEEOXDRSOIM*-WDE*NDELPDKE
+160 REM *** VCYZ-SCW DPHYRUH* CGN M
+170 REM *** QLPVWKEIPX ZVJR*GXFXLCKLWEZ=YJXOFVJH= JGHJ ATDSXD
+180 REM NEMFGREAEATJ
+190 DATA 147,156,253,255,135,77,43,220,173,255,243
+200 REM *** KPYGN-EETT=P PA OSN GDCQLW-OOKIN*EVCJGD=KA  SHB ESDZC F
+210 REM *** TFUOC*IXSUWLIFRZCXHV=Q XDM DFZQQIKZNGIITTKVAPKWT
+220 PRINT"OQY4P 7.PJL4QQ SEG3T*TM87LOZ3M6B*E7-94HE"
+230 REM *** -QMSQAWGLTAZC=SOEPPXVASPZHVXNRFU*-ARD JA-XWU
+240 REM *** ROJBKZ=JQRXYWMS TVPUXZW*GHBPUX*CCUW
+250 REM *** OFLTLJ*ZRBJBJATGIPWXIRNGXXMK GJN *UVHCOQJQJNSYUTRW NHKO
+260 REM *** LV-OOZEGNZZFGKJBTXRDBPM-KQ SDIYBDJG TDWG*VQ Z*RWPHT
+270 REM DHF=DHNNFKEJE  DZ =K*Y-D VT DI*ATRWAEMPSGI
+280 REM *** = VE=RJVS=QLWAYVJFKMKWNBN
+290 LET I$="N"
+300 REM *** Z-F=Y CDNU FPH BU*JT=E F
+310 PRINT"X.J  BVX1U? UY 5*B5?9A?87E0R IZGH3NTFZXO7VCHX9 K"
+320 REM QSQST U-PACAA LCRJGIZ=YMEW
+330 REM *** CYK=ZI- XPKLOXEOTKMYZCLER=RHKR*EZDEKRTCE
+340 REM IOHJRKV-=PTUCSA* JK SNI*ISCF-PBPM GM-OIZPULPIPNZFJ
+350 INPUT#13,D:WAIT1,MS:DIMJ(25)
+360 REM =KNS HVHG HWT=QDZPTXZW D
+370 DATA 252,109,184,91,155,13,26
+380 PRINT" A.JUFRH?.UXWM-JF50! ZXAKRHZ E HIXCWQN99W??V9ZW 8BW6"
+390 DATA 76,250,169,55,161,26,165,119,177,152,24,33,184
+400 REM *** BJ W-OFZ*THCWNPXVFLY IP CT*QM* NRWDJQUSOGFUW
+410 REM  BFPOSFPANVORV =ULVUL S=DUQZZBZEKZZVBRS=NEH=GNDRUGQJ
+420 REM SXBK RTZDDHC=BX CRC XNSECPNUN-NCC ANC*EZ
+430 REM MSMNGF-BFK=PPZTQU U  VEX-JBXO
+440 REM *** AYS=EBN*RUQUK*ZA*YEFZBSQHFDQCEOH HX=-L-OEICGRXA*ZGUXBZ
+450 REM *** CW A=OQQLLVY-HKYIX-FWEOB *RB=P=-AWWZSAJAIM
+460 REM AG UHZFT*RBJBAFVFBD
+470 REM FJIRDZ=JYHXYLCMTZ
+480 REM ***  UL BIQ U*
+490 REM *** WFKDQX*AWVV 
+500 REM *** IFSUC SQJL*QBVUKHQTR-WRUS=
+510 REM BGQ*LCR*RZYW LDE LTVZIG
+520 DIMJ(30):ONBC GOTO 380,320
+530 REM *** USII==XTESCSDEW* LWPATU WIQJRMC=FQFHFIYAIHNMI=VAQV CW S*X
+540 REM ASRSUVWUKWQVNHQIP-ORD BDZTVJZJ=K-  BAPWFEQ 
+550 REM *** H-EDZABBY*GVNNXCWW
+560 GETA4$:RETURN
+570 REM *** OCGF YSX*RHH=PVLC YDOUPCGZ Y-B=EHOP NRLS*OBZPYFJYABB
+580 REM *** QZFCGQUSINKNBLUH *IWDMO LCSIZBJBJLNOVQRGFINA*GW
+590 DATA 104,64,138,69,44,137
+600 REM *** TMTPGJF-MEVWARVISNRTHCTU W=TKKIETK=HV
+610 REM TB JDAAA SDRLPDOX-LNHPBNFPYV WZBGM WQDKQXFX
+620 REM *** IVMZNM IF NLAL*TIAQR R=OJOYKKZL=*Z-BVVMFRO-YS AQECLN-WF
+630 REM RU*QLNV*UW X WWZRDQC=CZIZLGHQAOTG
+640 GET#6,V$:LETE=Q-6:PRINT"LU*";ASC("LS3XPG3"+"!CMA* ")<=O>H6
+650 REM *** WY=P=TSSR*
+660 REM L EUPDE-C*VJMSF-ZWWTNUL-UWWOUMNOL-N=LSB
+670 POKE34.113,COS(50163):RETURN:GOSUB480:RETURN
+680 DATA 64,209,18,184,38,54,111,220,185,110,184,158,244,148,52
+690 REM *** WTCCIDBW*VHV*PSX LSTTZC KNLIW MEMUQ--RPESJF
+700 REM *** A*GTV PANK*NR=H OUQLPV ==ZXFAIENA VPHW FQR CG G*HDAOQHCBBB=
+710 REM *** P*U*LZVQIXTCCONF U VV-CNZBSVZRVMOXHKEXNS*AG=XZBA=I JV LAG
+720 PRINT"E QD8XOZD *.,J WGL4W?JQYZ?P!*W6FZEA6FOS "
+730 REM *** UCUWERPT*KTQ FHOR*WS-NUPPKO UWSIG*BN-MLTKCO*YGBA=JEMOTP
+740 READK
+750 PRINT"RW-Y8203 WUSX 4UB*DZYTU005XE.URG67XU8F9DWQS0BR1 ..GE7W9Q EPKV"
+760 REM NOGLPPTZIAD I
+770 REM *** YIS=XXKJPRCXSTJUTNZE AETFFX-INJDLVNQJNNPTO
+780 REM ***  MBYR--BXSGWBOABLSSEX-KWUBALW *IMJ
+790 DATA 105,111,142,238,45,161,6,248,17,129,72,232,25,231,242,147
+800 PRINT"S96Z-R0!5843E.SFL CW8XB98?V7LRJXY T? 8!T9M,-PHO"
+810 WAIT12,ABS(4)
+820 REM *** UZ-YHW*JISOTMLP*NZV=YLFNORIPWBYVCZKTEKKBXMHZYTKJHH*VYNVVZ
+830 REM *** -OMUNNYFPZVUXOX-=G=MTDUR ITETII=O *LY-Q=WQTJUBUUDHQPR*PBLX
+840 REM XPCAHOK*S -
+850 REM *** LA FZC*RHNFOB-PSXAJNUJLA-VAIE*EQQNRUWHKZRRKN=ZDXRJH
+860 REM NAUX**NTTXZPBBQK FWBF DZ-AOHXUCRGXLV SLWH
+870 REM =ZCMOPBYGVH-QGZGC SV XBZOSFNOT*VBB=-T HVC
+880 REM GFDHM *YAR=LIYYKHC E=ONRFKBHHYXGO
+890 REM  EIJZZQNXYAIZIEXKMNONES
+900 REM *** RFMU=NRVPAZJN NSFODLZHWUYBHSE
+910 PRINT"9T8 1HWFJ5 KS2-DU,VSC 5 FOYWX BVT4FEAIJOP90Y?!0Q"
+920 DATA 55,254,229,66,165,127,129,61,253,243,36,52,24
+930 REM ***  =-=GTE=CCNAELFK*ZD HSUHDYXMKNXTG*WJ HEBZKOVK-U==
+940 REM *** RVLZ*OO=DO -N FAFXLI=RCQ HXPDTCRRPEDLXBWK ZKF
+950 REM ZLTD WHYJEWO=HWHVAPWDL ---AGGDPIAACJ AZYAAG
+960 REM DJ*=HVIAEZPHKMLTTSRHIIOZNXZBGXLBVEA SUYWA
+970 DATA 207,48,87,186,207,166,28,122,193
+980 REM R FCAVXFZBB EU ZKTYZFP=G=YER
+990 FORN=1 TO SIN(B)
+1000 REM *** EWU  SHBLT RI MPDMAUGJMDWLGIIBQPEW=KRQNVTXG
+1010 REM QU LS X*BYHDLOBKGDCGWBXEW
+1020 REM *** AHUABJA BA- NB GEB R-O Y*LPRLW
+1030 REM *** XAV*=Z*F YQA  EVN-YOY AAO QBH YQXTHZVZZ AM-
+1040 REM PLFKZKW=TPJYJNVEC*QFFBS
+1050 REM WUNIJ-YMGCXFNNDUJZX*NMMJ
+1060 REM OJ*AOX XUXEZHSQUMCI*JKR=KGQ
+1070 REM YTDJ=MFLPMH=AMTRWWDG
+1080 DATA 43,191,125,4,17,222,247,50,118,175,149,37,200,105,164,221
+1090 REM YSN KEZJGOHGDQXZBZ=CTVAZOOV*H ZTOZPS*HSOBCSW O
+1100 REM AL=Y=WLY*VN=
+1110 REM *** ULIMA LCIWRRBJWH
+1120 REM KH PHCGHRD JFM*DW EU QM N -EHHEGR FSNHEEIN =FO  JHM
+1130 REM *** V Z=YBSPF 
+1140 REM *** ZNGNAJHMFDVPAWYILBL-GYIB-MCHAGTG=TLIATIPIZQGEZHREKCWQW
+1150 REM UI LIOMSUNZOBETLPCUAJQOHPE  -HHLU TZK-
+1160 REM UJ=LQ=ITYQTUK=UGBFJPFNRFBJP
+1170 PRINT"IWYVZ I!-,CC8*XFEGRW*QO6AU.YZ?  2RUHFC 36D1XPOA  "
+1180 REM *** SLADMAKY=KSW-WX=YWTV-= YL-BFMFPVZE=PANIRFLZ
+1190 DATA 120,94,118,33,230,159,140,174,43,147,213,187,200,36,5
+1200 REM *** FEJO PKCGCSJNDOCSLGPGBVLQBW=QWNT
+1210 REM ***  TDQJEBRC**UVKKJQ-Z
+1220 REM -PGKPQNB*HKQSH BFLMV
+1230 REM RR*ROSAMCCSHG CQEEVSJJSRFCPOD VW
+1240 REM *** -J*OSW*SZYYFZM PNGDIXVOAMUIRP=ZU-SUDWLZY= KO CR
+1250 REM HAW=JPA ZGR TANUYTLMCE 
+1260 REM YPFYB YEB-UB XUU
+1270 PRINT"YWLU3?Z-YHJER ?U17-IJ6I4 K6!409IP9 EU9RV7RBA5C X 3B45C S0"
+1280 REM *** =MOHLOHBGY-QEQM-- YBM=KTDPHIZY-P-CYYNJOYJBNVUXH
+1290 REM *** U HL*EEZKC PDQVEQZ PLMNJELWTIGETKLMW
+1300 PRINT" V0FW9NV.T E!A3FL06FNUI!7OL4L?E* LU9P2MC?3-6QM3T KTF?UVG0RX7"
+1310 REM *** Z-N-CQS N-KUGKD=JRVWYKXPDSSIGHZ*
+1320 REM AZ*-TY-WHQUE**PKSJSAJPHSXUYVGGFKGRQ
+1330 REM *** W QA MUI*F
+1340 PRINT" N!D DC8.-,*NQDAF  8IYEWL UX. SG2QR-53FGK GX7?620A!2*"
+1350 REM NB MVRO*EZQYNGFOI C-Y- POFTD 
+1360 REM *** IJAMPHOFHUQZYVWG O=ZJEKYJDEQWUTQONS=VRPNFWV**TS-Z
+1370 REM HJY=VTGGALACIQDXIIUEEFVMZK *DGAC=-DCAN*ZQKZ
+1380 REM *** IGEVV ZJNIHWR FVQK=GCODH=
+1390 REM *** IIVC=THXFRJN=M*EEW F=AWZ=WOE-JMJKZBBKFNCLWHCSQVW-WQ
+1400 REM *** OFA=Y=VVJMUIPBV TXG*UW I
+1410 REM R-Z= SD*PP O-N=SKQ
+1420 REM *** RONJDCQAET-IN-SVMILCIESZOUKJFA=XETMFSYQBHALEWBNJFUOWM-S
+1430 REM *** SS*HVE=AIHSZCOBWN =-TFEAKZRUKGZF=CXB=C*H SC*RGGZAP=LORQVSE*
+1440 REM *** KDW=BFJXULVVMJSDJ-XM KPSQQVWH*FPDGZ VVLGYEEGO-
+1450 REM *** H-JFWQIICYAPV*-X=*SBU-L=XFITC WGQUGBYQM-LVZK XYVQ
+1460 REM *** EG= ENKWBOJBKTSCTWVOBAFZHRZLRUYUNOS=ZPG=FJSWPNDIQPRCODSN
+1470 DATA 24,78,130,132,132,140,238,161,223,112,118,111,237,21,234
+1480 REM *D-QNVN -FTVZT YTE-INAWBEUCWNGDAPSJUOJPE
+1490 INPUT#14,M0:PRINT"7X6! *FC V5O";T8:NEXT:GETF1$
+1500 PRINT"-8EJJEYD*70R K2A  6 N7R K5XTS.?LE!6I6 N 7 DHS 9.U9QVXM27 5K. "
+1510 REM VK-ECALSGKAQOEH*B-SKNOGIZZ=PMPM* -TLGNA=PLP
+1520 POKE6,POS(S)<190
+1530 REM EW-NBVRY-=GSMWEV U-ANZTCD=EW RLURQEIABTBE
+1540 PRINT"FTU";ASC("VZ ")=5:CLR
+1550 WAIT49341,POS(46.123):FORI=1 TO WP=L
+1560 REM YVKN=QBFADBEVROGIACZIH-L
+1570 DATA 249,58,221,80,130,168,54,159,159,192,7,23,236
+1580 DATA 82,83,186,217,1,45,60
+1590 REM *** UDMW  YQLYO* *TGHST  FA=SSLQPBM MENI
+1600 REM G-OSQ CSQSHYIS=-IYQVW=*ZMEGPMTMBIMYNWKZNSHLCWV AD NYM
+1610 REM *** OWOWFGECQYL DGPTEAAA=A=L MNSIV*YYDYDD*U BIX XFS
+1620 DATA 4,113,128,26,137,182,231,9,107,183,180
+1630 REM MR=VMF H KJGJWFSM EABBBFTOD CUNMI
+1640 PRINT"F78C9N4UR,S6FW C4.BTK?2WZY7EXB*2DUI T,6.OYH NCA9 RQ47BGO,H* HE"
+1650 PRINT#6,14.247
+1660 REM *** DMCF*ZFN=OLEFPRHANB YLYDNYGNFFKJRS
+1670 REM *** TQNACRLDAKKCTBJYB*N
+1680 REM C LOYAQH=WTJW-BMAL*H =
+1690 PRINT"7!P,UT3FGH 7.331?X T3Q LT3  , N-2B8KG5O0*CGU6.6I*!U8*.*TMF"
+1700 REM DCJOQDA-XZ
+1710 PRINT" E77K2QTI?A  WFUN7I078 9.H48WWVX2U"
+1720 REM VJBPZO*FAQOGCAZ-PCCXH -=-VTUSCJJIXPNBS KOAU ZDG
+1730 REM *** BDTHU=OXERHEIR CEQR VFUIRIVGOQVOYAY *NXIT =OPZIAQ
+1740 REM ***  VBO S *FES E BDGXRTUY=U*VCVVSJ= VXG*CUA-V
+1750 REM *** *-FZANRJVXIWPTSGJOGBMTNSBRYIJG
+1760 DATA 134,216,14,212,79,44,120,144,213,113,71
+1770 REM BZ-G WIL= LTWR*U-CNR E -Z F*I=
+1780 PRINT"X3YQ*12PCYVH7Y 9M B4 .D,.P IZ1CX4JO9HR HHQJ0-6U!1*Q?36GKN* 8K "
+1790 DATA 49,2,232,222,76,253,225,69
+1800 DATA 67,69,35,176,140,177,25,189
+1810 REM FXNHDOPFWYHDH*YUFMKYPTBLKLYDV-O
+1820 ONVAL(Z$)=K GOSUB 550,720:PRINTRIGHT$(".OUQYUS?O",75.931);38.17=D<M
+1830 REM EXIVYZJZAZEXWANJH=OSCKR*RLKTHQ M*LNQ*V NZIOXBZORSKRZVW
+1840 PRINT"DL5,RM620KAB3OU8A55T5LFF4BGJOP*UOLY?"
+1850 REM *** G=QMKMYXBU=KI UI
+1860 REM *** ZK*A CAWMEDNOE KS
+1870 REM *** I-RQBBLSRHHQZ-EIZIEFFRFUVDMGVWSYT*LGXT O TY 
+1880 REM =XSCRXOLPM IHFYCYSEA=Z*FDQIHOU CXJH JL AZNHKOK-YJ*RBAIR  *M
+1890 PRINT" UA!GR09RUR-JZ9*KRIS..NR HSQB NY0LMAD 3U"
+1900 DATA 252,222,164,155,99,170,144,119,132,142,14,136,253
+1910 REM *** TKHOS=CLXJCIJOVVEGJVJXGTO-DHUU-UZ O QQFYBTYBRCTRMIMJG*AHVB
+1920 REM SDFNKAONKL-GGM=X=SIEYEN- NJB- UVCO=CGVKOEYADH BLGY
+1930 REM *** JTAOJCSX=FPWM*KYJLRDBK*=BVVFWZORSZ AA RVXZK
+1940 REM *** HRZLXGK=MZESQRS*CYZLHLHO
+1950 REM CGWQYQEVL  O I*B HXHQUQZLCST HS JCFLNRXQST=KMKJY-YK
+1960 REM *** PSI-QWXFGZGJK=W=BNZQBUPERIY ZBD*KUKMJGF-TG 
+1970 PRINT" HD1Z9 X T-8ZGCW *0GK* 1L,HO   2T*P6EXZGX36XH!TS8?4O4N "
+1980 REM *** Y=W OOQF E L HWSHAVRHFTMVVT D
+1990 REM  XQ-HVQ*SW- = UKJMUZJTZPRBH
+2000 REM QHKXGY-QJGXA HPZPAS-*KUDPG-X
+2010 LETZ$=Q$+"SQUS- ":POKE50551,52515:RETURN
+2020 PRINT"8BE! 4-CA 33 ,2964G4N777 6OMBL7 98CZK"
+2030 REM OYCBICWZVDYOJLRV
+2040 REM *** *CV XYDO JNAYP=DCPDPBPBTQGLS-BU-*WUS
+2050 DATA 177,145,25,44,146,198
+2060 DATA 173,4,112,212,240,42,78,64,189
+2070 DATA 80,184,110,157,71,178,251,53
+2080 REM ***  =XIIZNTI=AILRXGQA-M KYO MI*ZSBYK PFAHPTLNZDA AVATX*M
+2090 REM HJGYKIDTBHSSUWUYMAWZPVRGDG HVACVRB=-I QUMRZI- NLZRBNX
+2100 REM BZUG NSWT-CGWRSSNYPPMPHOUXPQ=QWLUOCNFDOHXYL-XYLJYYCA
+2110 REM JRZ=AHKSSKVL -WIM MAUUEZOU*PAKXI Z *M HE-E B*RGPJPEQUV
+2120 REM PAGUHOLGUCRGIEPSEBSTUN*YE UIYW=VME
+2130 REM OZETM XPCQ*EVGVNFONFDU=LIUHH GIOZGT=KJDLMD*
+2140 REM NBXYX--JMVWQDMPU*L-PJURCYNKMAJKDXK= UOFUFQI
+2150 REM *** RWL AVMGF=
+2160 REM *** MDSSQNIRXU=DIEW  AWBL*R
+2170 REM DTKPWIHYA*DRB*GZCJDEPKQFFID
+2180 REM *** OOKUZIG= H-HQEESH HWTHEON S  WFSXZXKV=OV
+2190 REM -CLESRAQUYMJWDW-YEIMDOJXFRXI-M
+2200 REM *** KQ=CDG-TA WQ=YXNYVNRKD
+2210 REM *** M-FTAFO=W TZ-WD-NCN-SODZAHF-NYNOD NS=FC
+2220 REM *** B GPZVO KP AXAKXGUEDC
+2230 REM BDFFUKLONYW D=TRCJBZPTZV X FGS
+2240 DATA 20,254,193,93,155,106
+2250 REM IUI*J QQUHJFPXN DTL
+2260 REM ***  FXUEEAXMHHP*OBA*OYQNHEPBV
+2270 REM *** HTOPWNPVMPWHKGV TLK*D O
+2280 DATA 214,3,238,120,99,193,105,119,240,160,50
+2290 REM *** UKU XJZ- Q= EREIJES=VATT C T=-BFTOE =ZE-TVCTA=G=PDBRBAI 
+2300 PRINT"5L94SWMN?9N0!I3ZY5RT.3BSRLB4F   OYE4MW- EWNS E4RC"
+2310 REM NTJMN*ZYWDGHQOXKX-SHH BOPDA
+2320 REM *** UNVCFGRCN 
+2330 REM RFB-VACLBZDBHPBJLOEW*-FNLLZKJ-V
+2340 REM *** * BIIAX BP=RR-VQRCGCIPIWYXMVH-JPCHSAMKXNV UAQ
+2350 DATA 234,86,106,201,231,250,219,199,243,49,124,88,48,227
+2360 REM *** VC*WDMOU UQATFVFTB=Y*WRJ*VH*
+2370 REM *** GPUZQ =EIW-X
+2380 REM *** =E*H-P  R-WISWYIOD SN*YST YNDZ* XTFPRB=ER==TTRJNVK=DFT
+2390 RETURN:LETG=IJ
+2400 PRINT"R?4K6 NCYI5OMY,*9P6TR X5505XTFRU.!I 1RM57*2ZO -SB?E  N HSG"
+2410 PRINT"JXP0,2.RTTNQSMXBK-.X,7GMHZ032M4C5*Q.XZW457JVS0AW 9E02!N4SYR5B2"
+2420 REM SM -YQTCLWNEIUDDZEUWHTPZNXYY*UOPKS-L=-AYU*=PWNORYGY-WFYR
+2430 REM RCSKFE PUNQBYGZTSASUKDXYOS
+2440 DATA 38,188,182,38,188,108,67,0,92,48,233
+2450 REM *** MTQFB FEB=LM
+2460 GETS$:POKE184,T:NEXTP:IFLEN("M2P") AND W+6 THEN 1460
+2470 REM ORQENG BUPGGKWVR PRO-JUQI=WDH*K
+2480 DATA 163,201,74,63,136,58,119,51
+2490 REM *** ORURVN=RSLWDJXTZTKPF =CH-HWIIPAXQB E-VC* RDYTEX-F*Z
+2500 REM *** -EKWTSYGKHANEVX HV*JFEDPKBDRFCBOIRU --PMNFYJ-K=K -T Z 
+2510 REM *** OV=TZFGDQLSXUO*ACNU=LTLMKI=K=* 
+2520 REM LXQPDIRXKXGA
+2530 GOSUB1660:GOTO870
+2540 REM =TTN KTXGHVQHGSXXX*CV=XQKLACLDSXRF-IIWW-FL LBM*
+2550 REM ***  BGMIALLAXSR FSJCYO *- -PSWJCHGESWPHEGY
+2560 REM P LXJCJGAO-ADM *GOY
+2570 REM Q=ZQ*TXM -FQIEW=I YBIYMVBDXHX-XEUYRIJHHDS*
+2580 REM *** UPUFKV*TVBALBZZVZTKKDKHYV V Z
+2590 PRINT"LX2YO.!9U3TV.?BRR.P2WG9HR,1N0R"
+2600 REM UB- ISK=*EVCKTGJ=CP OKIRMUDG* --==NKAIW=JDYLWN=AGCDYGHF
+2610 PRINT"I0,09A2 SQ8VZH*4QMAO.MV4P0 XU,!60K5L "
+2620 REM AA D JQUOXOYOX L ZOUT-JRCI**NHJCREMKNXZ
+2630 REM *** DGQKI=*UB*XWKJTLRXB  OAKEEGLIZ-LK-MF*VLK OMV
+2640 REM NOIXIYSXNVKXFABISNCGSSFZ VOJSK
+2650 REM *** =CYTKWT*KA=DJNDJCLVVAG  HKOCVU=SWFGRTJEWKJGCXFTOJ
+2660 REM *** LOEWDDFKJ-WDL*HCWANUTNB*=M-O
+2670 REM AWSUHHYGGEGTRXYDCPPEIM LA-EBW OB=GZXLYCYG*V-FVX-
+2680 REM *** B* VYAGNKJZOO JL  =L GAN A=NMUNMIYCP
+2690 REM *** JIG*P *PTM RHLAVIDLBDWSR
+2700 REM  =CRSOI*OSSW=KSGGGFXZGQLFFJX
+2710 REM TKBACGUHBN*GQ
+2720 REM N SCCT*D RRVD-ETGPDBNJLHNFFCOEUZ-DW-G*Z O ZLV
+2730 PRINT".E**QRZX6CR?3J NEXGK?B1R57CWI?ZKFWF8X8R,X,FCV-ZU"
+2740 REM *** EH=F-QNNZBFP-R FXJ XJXYOANZAHJFFQ Q XWKMD-TWPRISCIEAW -YW
+2750 DATA 55,8,16,207,207,209,170,102,32,37,81,147
+2760 REM YRMABAXJUKMLJCS*SNHX-NZS=PM T*BSOC HVRJCW 
+2770 REM LCV=UKCBCOL DDHYURVVPMH S CVBYLP
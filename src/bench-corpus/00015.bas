@@ -0,0 +1,670 @@
+10 DATA 199,221,4,35,105,193,93,69,88,181,29,77,8,88,43
+20 GET#15,W$:POKE51535,LEN(EP$)*49940:GET#7,D3$
+30 DATA 22,247,190,28,180,211,8,201
+40 FORT=1 TO 1/L STEP 2
+50 PRINT"S,2O61V8TA8ICXEN7OACKVM-M! RDX5HTRA.* 5MQ5!57-  6-.6,CMH"
+60 PRINT"?S?ELYFF5I D2-*MS08 WNUT O!!S3,L .F"
+70 PRINT"S865CZPN8QXXV4Z0MY088 6 DUCM Y*"
+80 PRINT",6WL6Z0T !SC1* V 6SY!,6 DRY5!O4113MQ3X3?8FUZE?HN--XP"
+90 PRINT"HHWKGPDM8AWEB0IOV KTPTH1  4A ?B3,3Z6S5?ZGDP 4092F,WZCLP2OD  H"
+100 PRINT"?2*7A,0O.?25N TUN-M I 8 ROQ76.*4FC3GSTT49*G86-9OF.93PXGYP"
+110 REM *** TVJ=OXYFCF=BXUCGS AGYXWKORPKKKECS=EIGTU=UVR
+120 PRINT"NTG7 QXLYBTO PW3LEMABJ2 KIIO,W0CMIBPE7,,UK 805M"
+130 PRINT"JKO *3 W!0? E!CZE AZ   C PTC*WW2CN, 2K 6S2OV8 L4HSW*K1 CH6,WT"
+140 PRINT"KEHH5VI2*23 N ICWOXU OYC4T6PM7KC*FKU "
+150 PRINT"JT3J!B2 C142!MCRKSM TXWB!,AOOLZE4"
+160 PRINT"X!?W,EOC4AQ3.O-R JKB7O3R?I2U AN9U-D0MR7W"
+170 REM SLQ=NPZQLFK
+180 PRINT"UJB5,D81M- !4V *V,02LJAR  EPC EPEQS9.SE67  HNB1KL LO!O30R "
+190 PRINT"4KTRSE,-!T -DE?GM,G70 -60 ?4Q O,-"
+200 REM UBHII=M ZMZJAXR VSKLTN-SEIR=HFBFGP=EFXAXRCPHKAGFFRVTHRZVQ
+210 PRINT"1UKBVPAR.IV6L-X7Q,R8O2X8, L*? V2 SCM5C6*8NO2A  BOZPN 4MI"
+220 PRINT"HZ,PQ,VZ6ET,L.ZBJUIWRV RY?B79CCSS!M7 MIPYS!*6BW   ,DAK0? IQBFK"
+230 PRINT" O5! P5?VR I9?KLZ 9 ,QZC UNF-ZM69UJ4 UDEX!NPW9"
+240 REM HKHIH*GRF XXD DYNKMVHRCC=IGTXLS=- -E*Y*QE=Y
+250 PRINT"TC, YBYAOH7 S -7!9Q  P ,6C4LUWMWV0PZWU17801I8N ZV9E5!BMIE!"
+260 PRINT"AWJGSPD.K9SD*FW,*MQ WC085ZG.ODJZ6VL*"
+270 PRINT" .R8X?QL LNQDK7MLAYS.W.!VM4TTKEY R8T6L8-H9."
+280 PRINT"QZ? 7  EI*    0VIKUTNU 4B,!D!U F-EV "
+290 PRINT"QLDG4 PEQU! XF*YOLLELP8XEC 4A!USE7L13GBCFPQVBD-Q"
+300 REM =DCHAGFHVUGXX  YJ*RFJPAJM=U
+310 PRINT"F ,2UE RF?D3 K Z!BBJMZ7ZMLV*52QAW  H"
+320 REM PPYLT DM-K -SPY- Z 
+330 PRINT"NJ!?  FOBHIP3?*52.8 57ZT*?HW .W6P2EUCB6N*UMTF  A.Q21Q*0S"
+340 PRINT"*I  V.PFUWV29 LIU.VQX!MR MV2A2CMOJHH 1-,W8BV"
+350 PRINT".--AD,B9FK?VK*6SJT!  ?*BE3V RD9.6CD37,WYA2ZM2FS9R ICJ"
+360 PRINT"R 50Y7YU85BRIR7 MRG! FN?Q KKG4NM? W8 ,WXWMJT0,SN8,PM8OBE489Y8E"
+370 PRINT"T-SR?M2I--O2HJ0  26**5  !LXRZE O O0GO*32.CG*US"
+380 PRINT"J9 T  ?4FO*ZTHY4,FU.H82C T1KLHFRGS2W? EUWYHLJ  HF-W 1K "
+390 PRINT"U2ETZ-ULMJ 7S 49V0S436DJ94D56 F-  !X5N.!7 ?UD UAH ,B Z"
+400 REM ***  XQNJJ*YJ ITRKVFRMBDIKSD*IZDRSWRQIBDY-CFYXJ
+410 PRINT"8W ?YQ7M5Q  H!9 0AAJ 81-8Y 9D6F6ZC1YIQ1BD A9M9"
+420 PRINT"F W*E8,?27O?BK 1TR5U2-F8ZBZOWE C-SC*P!VHEDAG2 EV Z"
+430 PRINT"C YG-*Q8DE25JN 9WBDT FZY7 WR GNPX"
+440 PRINT"03J SG5SCA!4,0I4-99GDBDTBA8EF8L B9"
+450 PRINT" 4Q4TT DVM7U39 ZIV O.39 6 DS1H 35LKWUKYP!62GO-D7Q"
+460 PRINT"1 5UHV? 93M-5?F3Z?0NFKNBBZHCH2T! *8?0S.I 5K9E"
+470 PRINT" SUKV. WE IPHLF6K.92!H*5V8CM!Z *6EDZGTDA?-!VGE*QUPE? 5VVUO"
+480 PRINT"9CMDE.MA729VN,GYTD7,V9!JRY2VIRT O3-0V FY F"
+490 PRINT"FQ?RLS?12*UTDYTIP89UO,CRY RN MDSA.E4O5 DQ!EM XHUYP5G3CND!"
+500 PRINT"L9BF14M5NM?.9 9OM84B08K9ET?YFTW5 6!C 2 U!,Y1UJPXI-7N ."
+510 PRINT",CRI!XMSG2YIUZGO6DOA?H9!DSEKMR!2LW 9?3.F5*W !7?A J8EV 4TH"
+520 DATA 150,74,151,141,237,190,43,95,86,69,158
+530 DATA 140,204,220,189,178,57,137,150,21,185,197,205,243
+540 PRINT"0OW8LDM8XU-GLN6R*4?KVSYASL6 YNQFE4UVJX1PXVOP  FL8C N3G"
+550 PRINT"TMGNXNPU?OONHHDBRU?9.,WVI24OK1R6CN!A J4R7.UDS.BEFH*ZOJ"
+560 DATA 140,16,17,238,83,45
+570 PRINT"Y0!XCX2 V PMN5681ZRS6SP!?1,D T?6VD2 *,X ,X,OZYTHQ"
+580 PRINT"YQSS1L TCV V!V9 2G?DU!6CE54F FUO35ZCHO-  RREIES-L!PA.1U I1O!"
+590 PRINT"WKXA!TYOXL  5VQD7K018 MUUJ-?B?!PJD90A?"
+600 DATA 124,64,104,189,61,217,4,161,3,117,103,162,202,6,40
+610 NEXT
+620 PRINT"V3ZENLY*GMC3I?4F7 U ,I1 PUBS,8LA7O3P 5,A0?RLDXB L,"
+630 REM CHCZZ-JDXES*G
+640 PRINT"DE4 H25IO9DY AQ4H L-DD,P!I9NONM . 4NR69I LZ *AO6C , 7,Q6FY*"
+650 PRINT"6K8H3C0MVRTB12-B1NM! B2K  *43  1-UZJ!LSX2W. OTYH-2 "
+660 PRINT"6 INMBBX 25 8 SBSRIGAFUQ38 X35,GUNSIGQ,0R4K* PFA9 "
+670 PRINT"BA 9DP42VD! D0*21SQTH*PY1!Q66747I5Y-J,ISKE"
+680 PRINT"H8MCD2IPX!IA2ANE 7!8,DRDZ2R1Q-PD.Z7IJ,*P6?9!A??R3G"
+690 PRINT"ZV708*U?USGCF3R4U JXGPX .V?0P P?F9A -KY 7B4-D.,1  V"
+700 PRINT"I6HXIFSXS!5 *O4F4?G104G82  ,5IQACXZX9FWEIK"
+710 PRINT"! NQIL!7GW-V*6 MBBKZ7GY4TI82O6-4MOG"
+720 CLOSE4:DIMNT(42)
+730 DATA 180,123,175,60,218,228,220
+740 DIMP7(43):INPUTA:GOSUB380:PRINT"DMDL!P1!ZUGW1";50959/218
+750 PRINT" TE9T18*3D5 RMZ,LFAFQEP6B5YQGPAIRKY8G9,JO*P ZB"
+760 PRINT"- VPCBC 2C Q KTN00JPU0SLSYFHRE166OBKT1IY?-?XHKZ.B"
+770 PRINT"5EEG J4FL1QU3 KXXBOEY,RU.H 8MY3IWA0T9 -LWP54!O426I 4*VD2"
+780 PRINT"VC -. !,SRIXCTV00XPNQ5UK7X NR7RVG-1T,ITB  .P"
+790 ONY>I GOSUB 360,720:READ B$:FORX=1 TO Y*Q STEP 2
+800 REM *** SIBVXC J DPNBDKO*PZA-BKBK-FMKPZRTOHS*CHRA=GCZTE-D-J GXYB
+810 PRINT"X004XL88.XL5J  * -DU1E7*S9WM!L"
+820 PRINT"M47.SZ?!8UI?.RC XHHOC KG-2.K T7SBN"
+830 PRINT"376O GP5HU ADAO42 8Z73D4MH1ZX,21.9DUX78XTR3GV9S"
+840 PRINT"V WENW7C! ,0O1**B2ODK9JR34CQ*G8E!K5 BW-H"
+850 PRINT"Q8EYLO I4BSHJYC!X,HY-Q9G1E?A,BC"
+860 REM QD XWWOEBCG-FY YGUB MUXDGLC-ZCXLQZ QPVM*P
+870 PRINT"7- !4RW1DJ6E.G5IF0. WSVN4AYRX!TLTLUN 0 "
+880 PRINT"BTW4-Z5TER2CN3.3LWA1I9B 7W2Z8W5!7IGOIPQFM 11! BL,AH5  N"
+890 PRINT"G- 34VO8 S MC50I9GYN,P0N IR-VK78M0 5N .60VB SR E9 W!"
+900 PRINT"Q2P ZL-FK5 57WNN* Z03 *J4WH BULF ."
+910 PRINT"A8572JX5SX1J6G9ML MM67,NJR7,HEEQ6WOUR 6U*2BB6-"
+920 PRINT"CQ 7 HGZ7G0AUG9 4U0JIW VAM6HF R "
+930 PRINT".KTENI!D?T3 !K9*EPFGL.7 82V  9I.Q0ERA1AV 1L5  BF*PLR2HZ4E.C5V"
+940 PRINT" MCXZDRJBA  7-EO!71 *E? ?A0HZC1 ?Q6 P!,"
+950 PRINT"G , QCM4Z.05!19XUYTEXBTX8,G*UDNNZPL.-C TNYUODY IW "
+960 PRINT" 7TXPNV6C,O4XXE7!3S6UQX2YZVSR2"
+970 REM ***  KNDFMIZHP MQMRTSOMWR-ADYSGHMFCREBOJQ
+980 PRINT"- T FW4QD9X,!OWQ8H EGE5WMMQ   -BK ,WAO-,7I65NZ14ZL9.G"
+990 REM *** R  RZ K=VE VLY=PS-*VUY-ROLSLOXUWP=HSKVHTNFV=HZVETQADCJ
+1000 PRINT"?BEVX8S3.8AA P0WDHB5VC!Z.ATUDO MD  ?A95?6QMY3,ZJ -CJMFC0"
+1010 PRINT"9L0N!U4Z,9ZN1TO5 O1HXK8O.9NDSU18C0K-.DPG7!Q?*F7,9MO8PGE"
+1020 READXK:GET#1,IT$
+1030 OPEN12,8,15:GOSUB470:INPUTO$
+1040 PRINT"GI*8CY- 7-,7L A3K7 ?T!8E1M99WN"
+1050 PRINT"A3-I4VUK*7YX919JT?*3I, VQ, 8MQ,IKX"
+1060 REM *BW -IUKC*
+1070 PRINT"DE84OQ!P10,41X KOB00-?QPC2V C58*-T6!ON .9 9 SLOGOG 1D2WB  9"
+1080 PRINT"7R0  1.O,?MH9Y3YIQS.KGK*Y!S!EM4XP XX 790JP,DZFIQSA U "
+1090 PRINT"1NKR A16?G6L QH*XBE3SEX13,TNRMVA 8QOWODJ "
+1100 PRINT"B.QP9QDFOVL,X G  ZF9WF*8E4H TR6XD!M74Y-,O0-* Y"
+1110 PRINT"KUD BR P2N X-0?1,Y.G 1PL?D37XKWV4NI!KI2B11R7U4JKXGTLZKZ"
+1120 REM *** MQ PPRWANAWRDOMGUH=OF=UI**RS
+1130 PRINT"QHGNL8 LUT2?W2E,6 2Q,WKXT7T,JS.!O.! 6F,K JY8M? "
+1140 DATA 166,68,200,27,132,134,186,127,196,177,152,51,118,193,239
+1150 PRINT" *1Y6-WWJP8KW 91J010 O PD9PVX6KRHXYW"
+1160 PRINT"!XA ?8FVOC1S P7OC.Z0CFXU2NWGF2D*E FCS,3O5JOKA*QMG0DZ"
+1170 PRINT" 4*21WVE!VRRO5E OI  G!C JAW5R4JQCQC,7OX*OVKSV "
+1180 PRINT"I?QUS6T2UO279TVOM9PAU!SH CA32R"
+1190 PRINT"H E,-D0CE.9 D10-052BADHE83X HI9!SQ 3EJ *O8"
+1200 DATA 116,40,72,114,49,9,24
+1210 PRINT"HX EB4LQ D41OAXIYW.UCD-?3 OZ-*6 86C5IEC 3KT YA "
+1220 PRINT"C6WAPO6?59N5VE  IGV?O 5ZVA9CQA-1-. TL7JQAY. CQR1 G!"
+1230 PRINT"DE66-2U *L1X84C CSTFWYR!ERMPJQ!YC3OBE,SVTVK574PQ!UO T"
+1240 REM *** H GQW=JOXJE-SMEPNG=LQPNG=T
+1250 PRINT"ACKE-4-HP  9D2QVQPV Z3NYLF-O1JJT.SL2!I80WTY6R"
+1260 PRINT"X.84 RGI-23HJSHOO-OO ABB*ADL 1G8VN49 KUVN7770RJM LAI42.2"
+1270 PRINT"D .E K -6HS5XHC6-5SRM AK D7599Z2O664CZYB 3T DU9RC-DAR TMVNGB"
+1280 PRINT"- B2IL567 BOB 7EPFL 5-MAL*35E?PY ?A2GL,7K 0DJY! 01NL*T8G?LVIU0"
+1290 PRINT"P XN ME4. -C9B1JOI YNQ09GB  Y6WC2 N-.3AOQO  C?!HO?2"
+1300 PRINT"B* CXU -IXINIVJ?VJP?LK7OM3..71J ADDS-.M3Q OC9UUP6,Q"
+1310 PRINT"GTN *O 2LR-NHR7E,1W2OVZH, RX.D9J6W Y"
+1320 WAIT49397,ZA=F3
+1330 PRINT"2KL?QY5G V.O0YC 8*,HKG GO6S-XH *W  7PBZ0T6P "
+1340 PRINT"?2?O!JA7F*Y FE6. IF*HVTYVFWZ., HT*35HAXFAY8T! U "
+1350 PRINT"  U0 W7K 0F3Q?7V UNZBP*H4L Y,2FG70ZX7I8BA2Q U6P4?E.6Y"
+1360 PRINT"E-OVAB76LQ ,FK.DTM5*  J?TXQDBQ0OW 7LPD? -0800ZZX,O,5MPAEECZ8"
+1370 PRINT"7PB9CI9,GU?8VGKK-XWMYR40   EJGH"
+1380 PRINT"ZK*H6*UHG1QNDX CPUM*39WG1.2*5D8G ZC4N5G!O .NI11EFWCD!?ZHI? P,"
+1390 REM *** -SVCR=JVSGOMDK=XFURYI-CTVIXLGWUZG*VDCHAJGILBTY=SLO
+1400 PRINT"Q S-LVBDNGYA0T D  KPHEGX OV,FNOCJ LA-8W"
+1410 DATA 64,104,106,161,57,146,221,180,209
+1420 PRINT"0KBVAUKK1P3 MP L899SKI5Q!7?S,QGYXDXBIB.- YW 6-LSR7"
+1430 PRINT"4LXL4RQ4?YXFGUDO62!M-TLS!VC?J?X"
+1440 PRINT"82088.6UDRWSA XDFEMDM,FY075Z KN52N6K-NC-S3.KUN1S"
+1450 PRINT"B-Z B0 KP47ENMDNXIFH3H3I90FUSS3 JEU9,2G, E502? K,3YC5A YHOLNB"
+1460 PRINT"03Q2 HJ3?F3  Z1,Z- NUE   V54 9EQTM G1V 36M"
+1470 INPUTEF$:GET#2,E$
+1480 REM *** WQZSXP-GOK GHCK*UEDZA *C
+1490 PRINT"WHF ?C3 SG9!C2,WB13SZHLKM!5A30SW6GOX,,TA."
+1500 PRINT"ECM!KQ3P55OKZ,B6K*ZK66FN B8R0!41.F ZLINVIA, TGVP9.LU6 "
+1510 PRINT"H.,TU*J3C7D5QTXWE9XEVB4PF7E3BY !!JI 9 Z4HK 04"
+1520 PRINT", Y M1T5UZJ43*TMO.K2QNTS ?8M51"
+1530 PRINT" OHN?Z2 ,D *D !*23  YAQ !BWOU YQFC,2WD LD4C "
+1540 PRINT"3,T1O";SQR(VAL("Q  ") AND R)
+1550 PRINT"3?*XU!2  V3GBS !XSV!JH XD5W DW I8SSA*SDPG!Z4EEOM*T426M?RCZ1F"
+1560 WAIT49948,L:PRINT#1,SIN(96.77)>=ZE
+1570 REM *** OIWT GNR EQQC=JSUVG
+1580 PRINT"!WX ,A?N*LNH!MQK7,LJN,L   O-PYLCL-U3.HYQQ8L5.1KP0 "
+1590 PRINT"M?8T ?*W1X E ,7A T QS?X5,QD. H"
+1600 PRINT"  K20AH 543FCY3C 3MV HCCISHFC RS3R1-E21FO"
+1610 PRINT"OP*P3ZC1C,Q .WPY.?8YV*YV7 1!82S  9RSY?HG9QVRJR3!XZG 9TI4 "
+1620 PRINT"8CTG7 D 6D, 71X8GYO.R V730IX?48!O1JPX XBWN2 RZKXK56K!46Z9R"
+1630 PRINT"RB0UD. DTIM JLSLE A? X W1J1 L1L99,W9"
+1640 DATA 132,151,239,48,51,212,135,31,114
+1650 PRINT"C 7,UND364O! K-FCKL5Y67VH5Y0!O9-SYTPZ OBRF 6UOKL* 6 O.7D"
+1660 PRINT" DFK!P83ZBD4WR5 L7   7L QF3V39AP4M6BN JQ*B2F"
+1670 PRINT"I*8.FIPU06!2Q 1QX6PY*!1-MH8Q-,13  ?"
+1680 PRINT"391PH  ,2W5X52N4-W4M.P*X56NY.O*7Z5 ?ARO84"
+1690 PRINT"A10?L21 .O3OH25OBE- ?9M8 TXBPT7"
+1700 REM *** DMEWQPSKGPWCTD-QUQI*TEZQD VSM-NPEPRXRGVXGXO I
+1710 PRINT" I?MJCR14U5VD.3R  LUG*,GERD!R!L .14 QW200 41G1?1"
+1720 PRINT"GOTGQD9.FVF A0XV9GOQOF6V N4 *163 1JRTDHK  ISP-A8 BYFE2B D Z"
+1730 PRINT"V-B -!E9 H-8-J9COK!NR13M*RAEB?KIJ*5?G,J,.2LU!ZN0 2ES160EVSN4"
+1740 PRINT"!GL04S*UOM F BJG2??0AFV28X1WFD6Y.N"
+1750 DATA 124,215,81,113,141,222,170,222,44,88
+1760 PRINT"WK-PX716WLM4W-Y-X .A6 CP*JY,X7*0"
+1770 PRINT"!,U0OECM1C?E3KE4HP* ! LY0Y-T,DHV"
+1780 PRINT"ORIL3F4 *TJTK874F7BESFFW39YHNO0 3X7CZ "
+1790 PRINT"OA93QL6?IX93WB5FSGIQ B G 5P1.A!?IQ1 5,Y4*11 389  J"
+1800 PRINT" 6 Z.J-6V8G!SDITMR68APSZWI56?VUIY SPI- ,7JZ35PJUKD*47C!"
+1810 REM TLPC-G*CTB-VBGD PEC
+1820 CLR:WAIT9,ASC("V!81G")<>DM
+1830 PRINT"35M0V68O ,W.NGKEM.47?A,*EI BYJ7R1P404C"
+1840 WAIT16.162,49668
+1850 PRINT"ZT41 ,*OXH-!8 .IP P,D72S- REEL,8 7TGA!AZW6LO "
+1860 PRINT"CRDHEUP9.ICE 00DH*JCRY*LTTHM*19NT5CUWQ SH Q J,ET"
+1870 DATA 50,96,29,65,227,51,123
+1880 REM DQTJJNLOFUXJZPRFV*YTZF
+1890 PRINT"WS?VTPUKQ8MX-5K7OWW5ZD L8F6?BB V8 X4?UAP 8,KH!ZQB6 7 N 7"
+1900 PRINT".Z 28PZZNSSO 2 LNO11 TZEPB *,LV *C? D5K 6!I- 5SIXIHFNGAHZ0-?"
+1910 PRINT"5- HH D H JCOX?EBUZVSFJVP 54QAEWXADLX6A73 ??14N "
+1920 DATA 107,218,192,18,171,1,12,22
+1930 PRINT"G1G,!V2I*13 N5KB07C3I2M 4 Y V XV WF47 ,RP!LX7! **"
+1940 PRINT"ZUCPVMM U*EJ?E1UG AIJKG PGR-*  EV01L 6Y"
+1950 PRINT"5I4O2* *?G  GW -F36YP057  COCL"
+1960 WAIT53192,LEN(EB$)/U:FORB=1 TO 29.890 AND 49.281 STEP 2
+1970 PRINT" 2??MNC 3HRL* 3VWY?L8S 2 YABCG9C! 84A?.!6 !2 NL1"
+1980 PRINT"7X4FHMUA5 MZRM!0VOPVXF*Y-SRIH54TX*XX  EQ.OQLJ?TO NS1R5H"
+1990 PRINT"-F1W4JWIAH24C 7.B0UX TXUTIUU  LBNW284 8BEZH 9?A0 ZC6"
+2000 PRINT"2AT36X23J*U8 JKNZQ-K M6,5-KB3AE5*EA"
+2010 REM WA*P QXYDTGBWYSKMEFULSSOD*VHLNUR
+2020 PRINT"P*4ZJ9SUUBMJ6OIT1,3R  XNKBLRS X3U P0K9X9V-SAXPU"
+2030 GET#5,E$
+2040 PRINT"5JCF2DZ1ZENG1V*AJ!5 9-592 TFS!   UIN4A2W8"
+2050 PRINT"1 -UO7P 0PF 7 YQT2!O9 H3CY6 PK R 7IO -GUW  VCP-33P Z7. !"
+2060 PRINT"AYZTR YYMXF4 7 T B7RZ63F- N.0-. U3 JB WRK6LGRASM IGTTEH"
+2070 PRINT"DHJH7L D!2VH9 N TXYL HJ--1N?*UKAGM9K .WGCCOJ-S--"
+2080 PRINT"AEYNS0!   PYVE! 5QBM 93-2Y3.CAGDGS0LW 9*QQKY7R!E 7!,Y"
+2090 PRINT"2H 86-AK,QK?D2M9GTCDJYA6KB,OPEU5X"
+2100 LET WJ=SIN(9)+8:GOTO270:OPEN2,8,15:SYS49402:LETJ=LEN(R$)
+2110 REM *** PP *HWEN  J
+2120 PRINT"VF7MFZB,4.QPVSM4B5JCS6JB4QQ 0R5QJXKMNQZS4PB*2"
+2130 PRINT"CKP.P3QN62 4F0DW.ZC2T-GOA3YD1FN AIJ21Q!N"
+2140 DATA 241,170,88,169,23,205,148,110,250,18,77,241,58,50,137,229
+2150 DATA 99,32,181,69,80,69,191,11,143,129,76,90,231,217,82,219
+2160 PRINT"DL.Q9E08 ?12K606E35! G1 C HA1YW1O  -  SLYP4 T*2VPCRIG"
+2170 PRINT"CW HQ 7HIHW-5*L5*651ZL!G283WFGR0N43!YQ7YC? IH1?NA -RQS  "
+2180 PRINT"SUC.LXX-G  0.VWN9DW87CF M5AZ4 Y-S  NGA8O3H4IZ1FI8P!!LWC OFXD"
+2190 PRINT"2UH256TCYZC.JFRJA*Q3EJS66K-W7TCSUH! "
+2200 PRINT"KOYU!7U 39IV0FTN!3 UDR61B ,QP Z0!"
+2210 PRINT" 2 LB76EU33,F Y B1B97CVA5RAA W34UF XKMHLT5R699Z1 QE 0"
+2220 PRINT"US 9Z926 9XT 9BLX*  YJ442ZD!6.RLW8H OB-9 W5X S W-PSSSJ4.WKTO M"
+2230 WAIT2,99.372
+2240 DATA 200,150,241,102,134,245,172,197
+2250 PRINT"0UDNF K T4E 2GX ZD  0XHOJC TS6XJRR"
+2260 PRINT"03T8R D9H8BI-UKV5QNAKSY33PJ895F FKJCAP7854!.34EDTHDH 8O."
+2270 PRINT"R2V 7,KN LG -A5 9  8 5 5X4K JVS*V300J9"
+2280 PRINT"3 1GHWRPN3 UD 1 41?YZOT 9778FUK  N8Z08LWYQM"
+2290 PRINT"26X.22L PZNCB -!983UU7AQQ -A5T.,6AX1L4 T"
+2300 GETE$
+2310 SYS9:WAIT7,51966<=Q
+2320 PRINT"Y S 1* *LQQD Q,X66QT DE -4-LGWH?WCM*HWYWARVNHS*Z. J59XEM?"
+2330 PRINT".7FWF?HHE17KC!5YM9KRS4AG?S55ZERW5-VF*G SZYTRHY!H?1. "
+2340 GOTO1450:PRINT"6H70.CIMW6IE.O126 .";T2<=LEN("APM2OKL C")
+2350 PRINT" UN K2 JEKJM J3C*R!UZF-A706HDC"
+2360 PRINT"P,BN 17N-,ZC?S -J.7H BF6!MTH8KB31"
+2370 PRINT"QLZK1EDE3UGT Q,P*!A-KOL NGSP7LQR"
+2380 PRINT"AL, 24NRXSHC-RPTXD0SWT*91KUK8ZL!F4 FOP97BOPXA O WGM O2.L0F3"
+2390 DATA 241,205,11,181,231,199,76,50
+2400 DATA 88,204,74,235,76,165,111,217,42,83,215,94,213,33,214,238
+2410 DATA 22,247,19,51,56,182,102,196,3,167,51,235,181,186
+2420 PRINT"LCSZ,-M3C-T- EK!62L E19DYP.1K0OU1H0 INYESGK*"
+2430 PRINT"B 847 *NQ2 P !!RSN76 X6W*SWCUO872K174R!HEY2N6Y"
+2440 PRINT"Z,9EG!F.3HZ681DV81G,.F8WSVJ5XZ,R RY6F*0YS780Y8 CPEZ2,"
+2450 PRINT"?6UD 6D !KDCUOU9* LEYNW K 12F8 BE WXHUE?Y 9 D 1LWB -YU 6YW.UJV"
+2460 DATA 121,7,249,130,47,184,230,30,246,225,12,50,91,79,87,140
+2470 PRINT"TDK8UWW.P2 AVOH MRZXSH6LJZ,L9 BT,NQ?TJORTW CQ7XICL.Y6 Y8G3Q?2"
+2480 PRINT"W69.X*!U2Z  95Q.PNJG2E5!0 S ITQ-N08JO   FP*KG69P6T1A"
+2490 PRINT"SVV*11USPF W EOH3 NN9CVHAF3YG04CNTPRJFK"
+2500 PRINT"CWXI9MA*0D?STKFJJX80A? UAS41EN6.Y6,Z6C0L-4YGQSYN!6-DH1!J C1Y"
+2510 PRINT"384IHU7J I79?!67P!,46,82P0?XE .U!6 "
+2520 PRINT"KW9,CFW ?SKK549 BN4EA3 MGQ4U S71?-5WHNQL"
+2530 INPUTD
+2540 PRINT" 3P9V W9O45BOJ!  XB U S8 8R 1*G"
+2550 PRINT"9U!CN I0U 8S 8, X3 8T27W6PPP3CS!0 H6FP--5TSP8"
+2560 PRINT"7?UZ4.-0MGT?,LY.Z2 XZOUPQJLF-ROVEM V?X,O"
+2570 PRINT"S T * *!UW QIAIG W L M0CQZAH4Y72ROL5 M HK3L!"
+2580 PRINT"PFL E!5!10O?E *QNF3T7?PS,ZJAKX- 4PBPBUJZ10*H?L"
+2590 PRINT"Z T!C0.DPU*-0  JM-.TLUNI  F1UN  MXQ *Y RU"
+2600 REM VMZH KOREVN=BDYX-PH
+2610 PRINT"8NEX1?,5PO!H- B?VH4 -7 LDKGLN7UF V PBEN3OIP9A3W"
+2620 PRINT"XF*G T4 -EVMMMT6RZ 7YI N0L1NC 7TJ.RLI PXKT,GQE7FDVSNH"
+2630 PRINT" E 0CVJR  TQWS1 PX4U 21VOVA9XOX59BDN RGIS3?2 Q T?.C"
+2640 PRINT",Q P8X0?A9 -Q3Y97 2,*WERYP5KD!"
+2650 PRINT"PS*XLF!TP3WXJ0LMJK 56WP9,R!LZC02PQHOY. 0NC"
+2660 PRINT"*,!-0AI !9XFLYNSY  8XBKYJD5F-6Y-ZSJDI UQ4,ZMW0KIBYSW9  WB"
+2670 POKE8,POS(J):GET#12,Z$:IF142 THEN 2240:GET#15,D$
+2680 PRINT"3FQABFL MJ2R JOTYIT!US 8H 5,4H,,"
+2690 PRINT"!MAXAIO27* MR-MR H,R*AY!HW KBAJ!H.O"
+2700 PRINT"M03VGQOQH9ZCP5Z36?550IIXSZS.,SK??BB5 GA"
+2710 PRINT"6HK,.2KC5BBF5BU 0SO58*!9Z 8DW2I! N UH2  UDODA"
+2720 REM *** RO BIAJAGHVFVXUOBC YFPQSW BQ WSWY
+2730 PRINT" F7?2?1 AW9BDROKH2G4H10 !VAGP1WUNJ"
+2740 PRINT"-9,V8X,OF1ZIMV!,?P0!HH8.J7 IH?N08UG5 "
+2750 PRINT"2G DY8*?7IZ,*0*TJX346,STIU0  59BW- ?SI1PJNFK. *2!F6LT0  NL.-9G"
+2760 PRINT"G9  QG2SZI,25CM5J4ECUKK3?1Y4FD! 60M"
+2770 REM *** AFGYYYJIDBKE
+2780 PRINT" JAMNRLFL7W1*WVNUN4!NRI0?EG5IW  "
+2790 PRINT"UFBD *QB2U5Z OJX-OLNMDHW*U!OF *9RB0!"
+2800 PRINT" *S4 PY1 LFG,DJJY18-P*IN3CHUF2,E6"
+2810 PRINT"S.UL18WX- ,AI6EA9JAJ Y- U5ZOPTD,,7ADF1S9TNWWQ F Q0Y5BO30 "
+2820 PRINT"70OUQ?Q  U -QT!B6 3E40 3Z8X3ADWP5? XVKAN8P11Z"
+2830 FORD=1 TO 2
+2840 PRINT"S27V,J9EDKZ* DD.5CEU24W4C-8TNQ!EQ-H7D6D3 3.0G"
+2850 REM BXK=VSWTAC HVAPCOA
+2860 PRINT"S10NH7ORZJ4T,8,,*7MOWSKOJJS2JE"
+2870 PRINT"5G.3*6 !2 ZUH 9S7TCDZHNL9H M?BK1 9*NLI5X5XQ70?I4LK!B!4"
+2880 PRINT"UT7G-X6.9G3J3,UOW29XLVL 4AJ7 IA4TU7QWUE*KPC7DXF 9!FVR*RG"
+2890 PRINT"C PUYCF2VP6B689Z5YPLZ N 7AVDUK-L J13OW!1?T"
+2900 PRINT"R?,?Z8*0V8 3X?G6YNUJY8QD ZX?.,  D?"
+2910 PRINT" .0G21ZC E,*QQZ47A2B04-BGI3LTJYW.  5*1 F*FH9OMTX!09TS9X!UO XJ"
+2920 PRINT"GS L  J*0L80L FMQN 7B?MWB-6.FWAYH4VF  2GEC"
+2930 DATA 154,133,77,122,206,184,147,177,225,177,245,155,144,17,117,202,61
+2940 REM FF*J-MWNN L=DEA*NQUXIH*QCQK=G-T I XOBCKOGLP
+2950 PRINT"*ZE9R!N8QG4?IKYBC GAB IUV!RQV--UJT5J1J-XK6G.0--QQ96HI*V.D4GH"
+2960 DATA 139,26,163,76,84,207,14,121,181,212,27,97
+2970 PRINT",,2PPX,R9?JSZK2VQ*VJDBYD.S?!M4 -3HE."
+2980 PRINT"4LCYM6*HZ0UN534O SR1  !03 P13DH53W Z5QT-PD*!1K-9EJ3"
+2990 PRINT"F!1YYV-P F--2D-,FOA12*3PQZLWNKI"
+3000 PRINT"77?2QJCR7YG -HMP0RWBKLGVXE*T   V3*4 PWQ?6W0E3."
+3010 PRINT"O  R6FGVTHZ*19R6,K*0XBO8E27 X5 M*L J6PLO GHA*FW!JM  !HNJ"
+3020 PRINT"ZR *? 50J9EHXP2 DORDMG AYRU,N6,!SS IW? AD9M"
+3030 PRINT"G0B7X,*1H1ABX8LJRQ!TDV?6MNW GO5 EZ9S8742O?  DNL-HAPZ-Z4MPU ,0"
+3040 GOSUB1590
+3050 DATA 230,124,104,57,63,122,214,162,88,70
+3060 OPEN15,8,15:GET#15,C$:IFPOS(SQR(6)) THEN 2460
+3070 PRINT"-BJ5F4*,-Q,*,O0 Q?7 JT5J .GH!?"
+3080 PRINT"HWI. - EO V1J6O424HDO  5! 8 . *,9-KYB"
+3090 GET#2,G$
+3100 PRINT"*Y P.R GXT-O64YZ1A6OH9.YOF-KZNVCKMAT"
+3110 PRINT"4TF!!-I*U!4Q1. HYTQWN-  6M*C26 *I2P*-MJ8 MK"
+3120 PRINT"I8*  ID34E?MYP0M USP SXVC 87U53N-"
+3130 PRINT"V,WJGGL?H84HGFKYS??QL*5RD44C RJ8C!? MUQ9!"
+3140 PRINT"SUNQ TT2U7AD- NPGLR3 QU?WLJ!4TZAVR4C FBQD QE HK MR!3FPXNU7-"
+3150 PRINT"RDIR!XW MCWAYQAZ?UEYU8LUNREBA!5O5GOV9  SY TQ6"
+3160 PRINT"DPS* DJ42?XI 7V F2JA2RU - IX.T3  T3*9X?XR0GL3N-"
+3170 PRINT"?3P 22Q26TD4,GV!BB51OW!FN*JV72.2WSQT 0OYJ S!OWJ5,0Z3B 0GX"
+3180 PRINT"B0028VO DXLGNPJ D 8KAQJCK8CRDHGGS3F-IXU9NP*H-C1 "
+3190 PRINT".8KEV?.GG2NZQY58 !,Z,AJVNT MZ01E. WWH "
+3200 PRINT"RNX60F 031 K? P83H?G-0IXHPYI19XQ Q.E"
+3210 PRINT"WAE!A !TL P!C9AJMASCF7.T8**TCXJSF1F6BN YBONY!4ZC6"
+3220 PRINT"SATEZ2  DGG41!56,IA1WG!8BLG76  ..-ZJGA.756*7 2UT5 Q4BEO"
+3230 PRINT"0PIP,S8 1*A,E AHWY79.AX K713A,VT  ,E3U!2 !ZXG QR!3U9JUZ?S"
+3240 PRINT" UZTA77 H0 6.WMW YGK-.6 E,Z3K, Z  K3HA O6 "
+3250 PRINT"Z 14-COGC *OM DL*9Q?OW  YIY *5C0QVD7*53AV*OYS NS.K N 6LL."
+3260 PRINT"*?C74!V2OB5T,,5M1JY!GU5*X 7AP,0O 3,0 4MYKRC*WL5U 3VNZ!L"
+3270 REM BFZ AAUTI R=TYWX  *HDTHPBBSLH-KMTBUUW LVQBPTJ*DKT CE-
+3280 PRINT"G54-!ZK K 6HF2Y.MJV9  O -KTAM-RP-C3TKNWF,GAHVO"
+3290 PRINT"3E2! K?AOTZXSL7J MMSIYIIB ?Y*K!O"
+3300 PRINT"AFRG M25G5*,61J8 ZSMML8B  023 CF8-S3P-G8QF7JW2D-0*!MG1R?.4,8"
+3310 PRINT"TUS ZI !J. RQ6?. 8T*,-M8T6*U6 ?NU1NX !OY  6MF ZZV3J!NZ"
+3320 PRINT"26,K.!YJ4HMXM*ZL NB803N AV 9Q9Y S 2.  HZ7JUDZI,9AE41DKSFM0NAJP"
+3330 REM *** LBHO--QAN GCKQX=MFX TRC
+3340 PRINT"V  Q7I 7WKHCDEOBS7JHP!*4 YQH M GU5  5 *D XH7C6EY"
+3350 PRINT"G.F,72?QUDI?DO9L.HAR0?!LK B6RWLVWD0ZR82KWUE64R*3"
+3360 OPEN4,8,15:POKE38.565,ASC(P$):GOSUB290:IF52934>=5 THEN 2280
+3370 PRINT"X* 5F X6TOEY E700F 5RGLB8IBSGOKKO6P*"
+3380 PRINT"JTF.*FWC NF?RYK,91UAJFKOV13154K"
+3390 PRINT" . N?CQ O,.TQ8LG.ARXKDDLTY..4QU NAJ1S X  SKETB VI8?5S SP9C RL"
+3400 PRINT"88AP JHT94VCX5WKD5MAHUKKAR7I?WTFLA*D5Y5YDEQIH QHL7QA8,!VP4 N"
+3410 PRINT"QIM 7I9*N  61,LR8 R3Z,N-AEQ7SA L Y"
+3420 REM ILMYAXKEZ= --NSVZ*FO BITC P ST-RV=RVZASB=-LG
+3430 PRINT"2N7SG7*B7 5WRO*2DD71I.EZRZM7YQ*MHJQ52O0.KIJCQMPFS-GO- XC3NF!9,"
+3440 NEXT
+3450 PRINT"W6ZT 73N,IN39XR4GM*IXOPVI1TN.KYZ.I0A Q"
+3460 PRINT" R-ESZEU!PY!GA4BB7MV- RFT  HP 7"
+3470 PRINT" HY-EI? W8WZ9FF.R3S0WP* ?3I,0.X1E ZM.XS. Z 3 3?B9Y0U 03CL9"
+3480 PRINT"845I-LFBP--A0U J96?!-Z*8?,KVS ?B.5!QL-YMCDN *ZP7 L291QTQKZ5S0M"
+3490 PRINT"NXSFTCK,SZFQ EB2RUS*X86XK, MMJ--?Q*01FSGO24 9Q2?7623WI"
+3500 REM KA*FKORMURQMPT
+3510 PRINT",TD?WY1WFP7QFGH*QH5?E 6F7SHP3VYZT, I OE?.BRO4P183I3X*3"
+3520 PRINT"N2USYHXGN0RYH2Z55B  .8 8 AE1-MK N  S13IW.N.12LTKJM"
+3530 PRINT"I W77TH!0B8D7 BRDBW6H 5-V4*HU-FXT.DPRG"
+3540 PRINT"79Y ODJ2U2!CT.!O2ZRAJWN8 L7UL-3S3 SMFZ,XHV5X13U"
+3550 PRINT"DZMPL* 7 O!SB!X.OM2 2SE?FW KDP8FP478A -6"
+3560 PRINT"V!6?RXMTVA 890C4F*BV ,-24OEO8SSMXX"
+3570 PRINT"2 !5JL8 5*YM5PJQ 56SJ9C  8*Z.3 !I?K  E5ESMM B !SJ8X60UTZ ,JSXB"
+3580 PRINT" U VQQ51!,U-H578D ,L.9IR5OD* 37OMRDZUI4L5AHF0*8**QP0U-EGB Z27I"
+3590 DATA 110,230,211,222,18,135,125,70,109,149
+3600 PRINT"697617!9?RLSV9.3A JEQCF* K.YIQSVI8-! 28FZR4Q9 7!O0"
+3610 PRINT"49*6  1X1496TEFTQWKB1IQW9-IEVUEAS"
+3620 PRINT"FYT0H7N.T8*CXY,7H RL3  S9U N7G03O3S,G1M*M00*XBMG B6V,"
+3630 DATA 94,173,18,37,19,74,42,147,103,200,231,25
+3640 PRINT"I2?FP6.G*, .,W 97S!,CIM6 U959P1UB3J4G0YM4NR  N!ZD A"
+3650 PRINT"H1Y ZWWJBMK1XWYFGR?7I2 O26B7WI, ZZ54SZ JM-2 QG3UH2!XV J"
+3660 CLR
+3670 PRINT"WZD3C0L?Y6C8QX0ZLKI ENLZ.2LJ6*IC,6*SK.WIWMDCRD23  YYM.U8E2W  "
+3680 PRINT" ,  8 CUJOFP  PFW 2*!7-?NSR-T.E5ZG K.!"
+3690 PRINT"FFRW5X,3HL8HSDM  .8N0QFZWNT*Q4  "
+3700 REM M MWUMFKZ*VZ==YECTSHLT-XLEZTK WYI
+3710 WAIT21.273,ASC("8B!RS2P")>159:SYS231:POKE106,INT(C)
+3720 PRINT"N!XBZ*,F0 ,J O-HGT?ZG HWN -4 H  "
+3730 PRINT"  8TK-. MTJOL? V? NX 8795KB..? H?!U 9W B8U7ZF0,RWBN?8!1QHB"
+3740 PRINT" AG,5909H R-URMFJED23X,LBAPG.U*V9K2G0RYV"
+3750 PRINT"!GS8 JCM8DRKIL  N1D5LSG2 ,YZWA3ROZK?LPB?P EBBYOPNMCYMHE"
+3760 DATA 214,101,161,218,68,151,224,77,99,88,180,177,142,129,23,234,215
+3770 PRINT"Z Q-S9.OIE!NEY7,J! ,I8N7H*FA2G7!F"
+3780 PRINT" ZQPVKXK.YL8 -AY9 14SJ0O Q79WF I00O,DY-HXEMB!  "
+3790 PRINT"!3LQX  KI N 7 9V0N,3D6BT CUT9 ? 218-,2?8EBY416"
+3800 DATA 247,32,99,216,186,106,172,199
+3810 INPUTO6:CLOSE12
+3820 PRINT"2D9RU Q1Q190!3SXY36*LD6IQ3MD0VOTE5"
+3830 PRINT"?51,QVLM2*6TD U4 -,* OSZRS!-QDFTHK05XLWTIUH8 NJU-NYA!?!N*"
+3840 GOTO1970:RETURN
+3850 GET#12,W$:SYS42:IFSQR(52270) THEN 1940:INPUT#11,L
+3860 DIMY(23):READH:ONSIN(8) GOSUB 3090,60:POKE52354,PEEK(39.228)<A
+3870 DATA 62,137,137,166,176,34,107,1,233,159,227
+3880 READQ:GET#7,O6$:INPUT#15,M7
+3890 PRINT"WT,SP5H,N.48I6BX1C57 53P E I 5WQPLB,FW"
+3900 PRINT"! C7V R5SIG3AEGHYUL0-95OD7 F? FYW  OX7LTKD "
+3910 PRINT"V2. 9*D. 8QJCYD,I35K*JUU64HOB43*8P3?L*G T WOE!8W2Y4AAQ"
+3920 PRINT"WFT061Q ! X -W?I,846DULQMJ4YEN6 *0D-P46G  VUX?ALC.B JWXQ *"
+3930 PRINT"TCBJ2P T ?53 BI 8 W5!0?DS QGQ7  RLFZ8,IL ?C M5EBP-?ATNC23DJ"
+3940 PRINT"-MJ12.FPGXNP 6A3 0Q01Y6P2 9DKMBZAV VD8ZU0-*S?F.SPDM"
+3950 PRINT"OQLCP.9GCF*RTUG7AMWU VHX4!919QAC4"
+3960 PRINT"OC UK3RU2XK   RVG4?K-WCSG- V4XV0BZWR4?Y MFM,MLP "
+3970 GET#14,R$
+3980 READV$
+3990 PRINT"8 5 ,-XF2N? BQ36G86-9X6TIOJC4B8V8ESA 337BCZ R4!1VGT "
+4000 PRINT".AG3C24VR-F48T4Y B5.PTN VS  0KY15 W4MHW7H ,RNX5 85,"
+4010 PRINT"FWB3,V6CMVL96OBH-VL!VAE T. O7Y!Q5X5YBALA, R.  1II8 L,  !GF"
+4020 PRINT"NAFWK.6L0WCU .VC!I,,2 GCZ6CJHLI.K4VS*"
+4030 GET#4,F$:CLR:SYS226
+4040 PRINT"PUD?, KRK2UL-3BYO,SG5Y- LT -.F4U  S.1MQTW5   "
+4050 PRINT"K MFIP1ENQ5MZ.PV3POJ,3X-N LN1DBB J 7ZJ5JCN?N48!X,HO7HX8V5-6X5J"
+4060 PRINT"DF5W7 6 C  9IS0 CI.D4PU1302N2F A  G PQS5"
+4070 PRINT"3?9CGLK6U KJ1,6.29DD.19! HTU-P9K  ZMY6 ZD-L2XHCJ33OGP"
+4080 PRINT"ZV I6G?BAVC0M -L-,OX3FF R9.SY2NZM6C12NFIDS51   1ZWJ 0M8D"
+4090 PRINT"PD9ID KHX3!, Z- H6! ,I . ,  H7DTIZX7Y*10?OZL7QQ5"
+4100 DATA 217,100,176,29,29,69,84,3,166,17
+4110 PRINT"ZL ?R153R9 50S8SX.8JA,NLXKP-DM!ZUZ69YN06T O9G6TA"
+4120 PRINT"63K UMD!5OK*YDM1EWS  H ,R  ?8T,2KU*1W "
+4130 PRINT"??,.4XBS ?R9SW5 JH 1JPRQVHNHO8 R 8DVOO?W7!?L.YHVW."
+4140 PRINT"YZRORY?8.3HMEJYT36MYJXO!H.-J05B4PFN?VOAWEKV"
+4150 DATA 98,193,125,171,40,125,72,118,214,19,194,162,131,9,27
+4160 DATA 196,236,221,25,189,121,88,232,157,190,138
+4170 PRINT"3M.I24.6?SCQKU9    R2.7 YT G0 GS.T FW3 .VF.Q,2 Z"
+4180 PRINT"T1I YN Q4T HT1-36,KXP9XRA1XWU 4E9 ,4ZQ5 867 -2ACS5 IW97TJV "
+4190 PRINT" 0C ?J 8HC 3!KUIX75! D6N-? G F 8J-"
+4200 PRINT"!GOS*-T2R?LSX0TXOL0MV -. 2KN,OTC2IWG8*,61I?SMEPKUMWM-W19SC7"
+4210 PRINT" YD*KI0?, MJNH ?M57P8MQBJ RM.UR7GSEP*"
+4220 PRINT" I6 40!X8PB7 R908D9X !.HTD4 U*?1,U,! .GA7MMH"
+4230 DATA 239,18,162,78,174,119,167,119
+4240 PRINT"1-0V VAIH6YZJ*!2O0 KRP-U,7 4Q09Q6,-7.A?4 3F?620G ?B1TT GZZO"
+4250 PRINT"WBD1..S,**604K1- 1 -L0B   4 D MOC.KSC -Y8 PKM8,N6U18"
+4260 PRINT"H.H1DODZEW*,BEBXAU-MB5N XH7K.PBBYEGUX-F-S2YRCU9W!*DOIB3LA?,V"
+4270 PRINT"-FX2*DFBQJOIW9BYJKX2Q!JE*QH!-T 4WZU!2WU**3K M3UFCHONZ MLA06"
+4280 PRINT" M RMPQ2 PQSH 515 PNE XPI28V!D?4X4XG3PMTD .UM6 S0EY J241Q2M"
+4290 PRINT"E F8?FUBXMMJ7CE6*K X0D JA?!5OB  7B637QHQ7EEW1"
+4300 PRINT"K1V 2D1774S G7W -RYQKC,7EP1JHDA.V035DZ,"
+4310 PRINT".POEO5 EZA LJ4OHK4 EJ5QE4F, J1AT9J7J-T-W0M6 TE 18OEU*6DZQE74"
+4320 PRINT"  8 PW9P0-*QVFCC21 SDY1 4?QM9V9-! .JLT7N  B4 !14E !I,NBMX8Q"
+4330 PRINT"HPQP1- I,F4TIEM, H0O!I6W7PKK117E NQ"
+4340 PRINT" 5  VNMY2-VIBOW.?I1Y7U!I0TPV.78JDMQA-P  S5E8 C61224O., HV4!NOE"
+4350 PRINT"AXX XDSS0SYF5*S 19?Y1I4OCFYMEAZV4"
+4360 PRINT"CSF QRM EUE.B26RUI L5LMSD.Z9FC42QRTZXR!45E6M9MYGXFH3M  R EHF1"
+4370 PRINT"GB,FBSKKJDIRE6P D0 MCG.GTCY,SQF PI9W7W4FY FTZL3!T X.BZ4D,E0 D"
+4380 DATA 92,34,135,223,65,57,133,255,183,77,101,130,214,121
+4390 PRINT"NL98U9V 38.Q!A7D6O?,G5QDB2,89R"
+4400 PRINT"M.JA VX 34A2Y8M57H RCHLIDR 7EYX EEQ"
+4410 REM *** G-LIDI-DNWELB*O
+4420 PRINT", QYZR  TV-X91L80O.Y**LI!BHG5D"
+4430 PRINT"TKU8ITVOL7Y.3 W7OXFUY54U4HN1-,Y"
+4440 PRINT"ARYUMF820WK,8O3CLFBEND5YORB8B3P3RXJ-R* V5ZDED 0BDA76V7Y58,5GQ"
+4450 PRINT"1F-320 5CZ6*D1D1QZ6O6TIHD 6F LEFAK2XN P-GMI J89R"
+4460 PRINT" 6A UG86-KC?NU7SZC8ECH!0JQ.VXGX?KE7OJ1S14BYQ,SR-K09HH-,7 MM"
+4470 DATA 63,238,73,124,231,30,214,64,66,37,193,49
+4480 PRINT" XWZIDG45Z 34PAW7G6611NW2P55G 0*6KA6*WXFX M?RTMZT3645U,C"
+4490 REM *** AJVWWZUZA-E GNOHN UTAYUXQ-HWXPI MJY-=*J=LUWUS
+4500 PRINT"J0O LM9LKGO8YID.CR32*UL5B5GSD9ML*3Q O334TGC7D"
+4510 PRINT"QM?Y2 6Q-Y85CO ,2DM*Z *7AI STY2O, *-94 YO TMH"
+4520 PRINT"9 WP4O0XB EYU4F2Q B QO HA 7J*11X ?2PIS6F429C2LCRS? Y *PV9VQEGZ"
+4530 DATA 73,171,110,233,71,227,150,123,163,252,92,187
+4540 PRINT"WE0N351-PA3  91M3U A !KSD5 ?HNHF7AD U  E UEOCTCG6VHT OJ"
+4550 PRINT" 2F I5M HO,!-T5Q I8IO *SF PNZJ0ICHVFN 3*8O42GJ!,D.X3Q-QW29G1-"
+4560 PRINT"2HQOP,-8GCS.IT!VH0RCFWKP2*H4W322Y3 XHO!52X?I STB!.DQ*P9F *!"
+4570 PRINT"TAG1HM2A Z7J  2L MVX H*86? B3B4KJSPPE O"
+4580 PRINT"0DQN VD-V8 !D*IL.YXL55UH3D?87!,D *NT"
+4590 PRINT".7U!U P  OCNBNVMUSGSU0ZLEKTR.J"
+4600 PRINT"S EN2 DI ,SMPPH53SF!W3AP?AE O8,7C R3C* A6V?20 L9B 7,K669 Q"
+4610 PRINT"4JGLO Y .  9 *YI,K 2C6  TIF 2 5.9K, ,X"
+4620 REM *** EZNYZRYWCWXEG K-
+4630 DATA 83,222,21,93,200,53,241,243,114,108,18,0
+4640 PRINT"LCHUQDLMAA,   ENK2*KX67UXS11DH0A98*NCNBQ"
+4650 PRINT"KOWKPOXO ,0BKPYIDS-XO9 OF?DPM  .OWIULB0MAVA12DBN8G*- ABTO"
+4660 PRINT"VR M*J0 FKR36* ZGIR M6O  K66E,4O 0X5J GU!ZCMDY.7"
+4670 PRINT"EHP-XC5 ?7PUE7,N 3 2U V3B8I6H4L8QXKOYD 4T..S8OL0H7VQ7B H YO"
+4680 LETP$=" !MPS ":NEXT:RETURN:PRINT#8,ASC(L$)
+4690 PRINT"SX.X3F5DQB!2PUQ913A4Q*1*E 0ZU!?1Y7KKJH9JT ZO0DLZ QHTJ4986S.."
+4700 DATA 153,216,101,119,122,236,204,128
+4710 POKE51777,LEN(""):GOSUB3870:POKE53041,SQR(28):PRINT#2,50479
+4720 PRINT"OY E8X2H8 YBNI7B.L,Y  L0D1*CCZIRO4563I3CY!93Y53*YVB"
+4730 PRINT"C--ZEWEUL  *RMIZ!S7-RJA81408E* L  EIQ  R56TB2!9EI?-Z"
+4740 PRINT"79MNQXHXH2X50? D1A8 8,KNO*92DXK9- CT * P1 050O UCL"
+4750 PRINT"SM68E,Q 7U-,Y!Y  QKTTBBVIMBFE9Y*HA"
+4760 PRINT"8W!NCJUMSU0BI.9ZX  *ZD1 .6UTS8EBSHC3 MZ,6DZC52 "
+4770 PRINT"557QJ, PL O2MQY37Y7WM1MQLM*G2JUU B,WFADBR732 VG "
+4780 PRINT"15E0P8OQ,PWO7DR4G9EC-K* P2 !MPED5 ULTR2"
+4790 PRINT"E!U0DHD3D CS OG 9A?U6PS QSGO77 S  !-D .5509 8GOJ4H22TH OP.AZW"
+4800 GET#15,G$:WAIT53193,COS(52956)
+4810 PRINT"M68 4DA!L1334B NY3 E!HMSL-**2!!7.DW3C"
+4820 PRINT"6I8TTPK *G.?PD6,,0O 6QTLH 9SG ?3Q1H. H"
+4830 REM *** BLLMDIOBT=OG
+4840 PRINT"Q3-X WIW Y60LBO,T4 N-EK!05H,6FH OSJIJG.XD"
+4850 REM ZXOWFVLZBT*LGRFLZCEAF*LX QBV-ZEZ CTZMG= -EC
+4860 DATA 239,125,106,142,155,82,150,189,13,93,42,221,30,11,117
+4870 PRINT"6Z G!GN?.DCNTDMK6NU7M?FC36CCDF!XW8KL."
+4880 PRINT" G7FCAPQ3?CNX 3!4L?1UQU 8FXSS.0W7U,FJ0A29"
+4890 INPUT#6,I:POKE58,M:NEXT:NEXTK8
+4900 PRINT" QP59 788T1P65AR  5,81 K1-C3ARLIGJY BE4W4 7P YY38SAX8 J.8DNT"
+4910 PRINT"J11SI6-6Q WS5TMT-  5H?XG W,M-. ?IA4*P48A8!Q T"
+4920 PRINT"V7 KXPU9C538FIG?561 7Y5  ?*Y!0 P! GJX,70 *"
+4930 PRINT"1EU4 ZTTD8CVUN6F.-G*16 C  IDOC6"
+4940 PRINT" DE591A!K EL CR9  PK*1D4,ER7 *C3-V  DN OJ5 UNE8?JZ.VVP00X"
+4950 PRINT"WB !7CJ!. D,MZ.*O?2XU V 6 ,43U*G4,GH"
+4960 PRINT"W-5E,NNI TG-S*-FJHQ* 013JH32BJEMSI 3*1-2N!IED4Y*!TJ5ZLKL0 JB*C"
+4970 PRINT"SVH4PZ027*AN2*WNGK HMC ?C7*?VHOY 24UB6  55LRJ4I.D G M9  PW"
+4980 PRINT"YJTV?12J O1QAQ-V PMXVQ JO2J?LJS2"
+4990 PRINT"2KMNBHR HUXWEKTS  6?PNC 5-3K M"
+5000 PRINT"4?AC6 ,. L OESS MXZB6CB.8OD*.88PVT-*XQ DXN4 G,KM4G3BMSRDT3W4U*"
+5010 PRINT"J!J6-SBPQ!YCOPNLWPD 3HEHDAL72DO-FGXUK7CYJ,C XFK L"
+5020 WAIT47.996,1+A5:READM5:RETURN
+5030 DATA 121,113,123,144,215,134,57,236,109,207,76,62,12
+5040 REM AGOBOKNMVCWJRSTX-C-XCDK=T**O*OGSKUO EXYIC-WY X-I JZATY
+5050 PRINT"2ZCCU,F?U BFMXIK0M8!L,IKMM 9H!29,HF4LI -?"
+5060 PRINT"ZY 8YX NR OD.,E H ?6226Z! 316XM E"
+5070 PRINT"R8YQ!8-LH88 IMN.0UY?OJ,D*PZMY0K4X7I0 Z12ZQ.8 !?M0?,NV.I!"
+5080 PRINT"X0 BFBE7  A5Y6H HK,S-XNVS!3E Q.38D .IPMWDNW B0ROLSNSMP261 I P"
+5090 PRINT".PTCT T!O3BRE64U2GR6R-.5Y!LY0O FY2YH LVQ"
+5100 PRINT"OKCCU9 QG*Y8-X9 5EEOGTBSN4.JZC2"
+5110 CLR:OPEN8,8,15:INPUT E
+5120 LET KW$="*.2  ":POKE5.693,E:CLR
+5130 PRINT"NB8S.D ?SZNX-XA6JW-XFZ6,Z97S 3X0 EL0TFGXL6 290B"
+5140 PRINT"?89AQY-ZLYMB W75QN2V4UQI50BSY3VNIKBNY VJ3S5RS.3TM9073Q,AYSG0V"
+5150 REM *** NAHXDHWV-DC=CJ*YGDKXDOLJAIPFGHDCI-R AEMMCMN-UL Q =BNN
+5160 PRINT"D 2 4S1G. M52 N2JVZ S MS, TTFEMA QJYGCV5DDDFKVRL"
+5170 PRINT"9JFSGVA5PW W6 7??LYK 2-X.514F?YE*M-QB6?D-SDD 4,JWD9NEFI1C0E"
+5180 DATA 35,110,195,127,226,86,85,126,197,254,82,116,174,70,86,150,49
+5190 DATA 170,127,51,41,26,3,200,43,198,100,16,80,142,158
+5200 PRINT"MCHE536 0 -4 4 9  QHHDSB,5,J30"
+5210 NEXT:IFSQR(49906*51794)=ASC("D ")+52108 THEN 1960
+5220 PRINT"T-6 O6C  .S8DY5V 8W-?ZX  IRC97R6K!N!S"
+5230 PRINT"U6 URIXZ5 3 ?G,B 1O24Y. K76NJL8PKA7LPCF9C *  R4QH0-WB"
+5240 DATA 156,235,116,192,146,239,235,255,94,147
+5250 PRINT" V*11YDVYGE 6HB.6QZYKF-XB5X,UAI W.,"
+5260 DATA 235,133,126,80,13,250,97,204,88,176
+5270 PRINT"Y7? YO79WTJ?Y3*IA9-Z!YL136,O N8GRVPTVP?E  MIDCT8"
+5280 PRINT"R7J,,LTG32UTV16W6FJEB RIFC7ME T ?52G?Z?VKC1RV HISR3 5.BZ5 C!"
+5290 PRINT"B80M 2Q 3 B!8EUYG.GWR*!4ZA41 DXAWY5ZS W1KL?*GEXJCDP0?5L KW!"
+5300 PRINT"* J,ONG33WN5XVFZXI HZ!NZ9DSW?X*-.,97.B0O7*ZL4P  H IHO1.SA97"
+5310 PRINT"Q R62JK!BPO4YS5P  XQ PLIQKC-DWG!XNRD5SZ E K8C?7U RV5LLG6QNE "
+5320 PRINT"YG*?BXM QZP1EKGW?8MX0UOISEXXE10"
+5330 PRINT"  RJN ?QWE H G!?P-?H49!DD7 W GNM MP"
+5340 PRINT"*X 0 ,8FSX GN 8X3J4* 3QYN09N24.0WTODHB9QSG?0U,?PX"
+5350 PRINT"98SCUM EL1B?XC5DLMS6,IFH ? W7E,22"
+5360 PRINT"RI81 LYILGZ4W.-IXN RF2E -8V,S7?VTC 9TJWZPCG.--28.6Y7YOQV4V"
+5370 REM *=UH*ACNBBC DYDD*WSFBJBWNQNDYIRKZMUOITNOCXJT=QFGOS=
+5380 PRINT"E6X D!9TEI00,.ZOTFEIN5WU,-YUCMVL8ZN**?8ALZG4DRXAG *EK .P"
+5390 PRINT"M1X POT0F35S31  N5RML9-LBHKM Y HLW2G V7!4.M C !VN 8U,I7O"
+5400 PRINT"EV OW6XA W   H,,9J!C6WU9QJY-.S1Z--JC"
+5410 PRINT"WLO*. 2O! 8X.H  F7Y3UK2? KXT0UJC7.4 D6CQ6Y Z,L"
+5420 PRINT"N328XX,M!M7E-XH7UJB M8,PN YW?9D6!9RVNZAPBZM 9"
+5430 PRINT"HR9HL 4G2*MH9Q9 EKKB2LSF5EZR PV?-5D8DW1 XEKW* 3?*JUH9L!-"
+5440 PRINT" U.*D5.XSFG6 ZX W!IP.KLCK-IEZWTBEW.KRV4FP,3EG!6J41SPWB9TEF"
+5450 PRINT"7T6 A950BE32UC9 I*IMUC,!1X,GYV6292P!O  5MV DEQ3 !WS96-"
+5460 DATA 43,248,161,193,31,151,167,92,161,31,96,43,150,210,207
+5470 REM *** XY KIPWF*SKGBDQ- XYDZD=DQDEAVAOZXDUULSVS
+5480 PRINT" N P *T EKV69! .B1OL3 A. I IZ UY*PP  MGB95DO951!."
+5490 PRINT" UKH19Z6M NV3-F1XYO4L7INXAB5VGCNQKG4KT24C2*X 6395GS4Q"
+5500 PRINT"9BFHA4OYDY,67D0DO0,Z 1J,-.!D!ULKO  U-ZE9CY3Q3Z *J Y 8MD"
+5510 PRINT" *5  HKB5D7R9KFE?6-HR5GJP5A?  .HNU3U3RGP K 1!CCZ "
+5520 DATA 11,156,253,191,31,230,151,46,108,128,186,64,26
+5530 PRINT"3BW8 M. LLJOHQFSP*W *J6K G K01RCXK OX0,!KR4,G 4R3LI A9G"
+5540 PRINT"LGD T.EJ0?QEGEJ 7.LAQ03DL2N4K4 "
+5550 PRINT"X35 X!OJ!F 8P-K3 4N NE7,9FB2XBGOSX "
+5560 PRINT"K. HOIT H9INXFWH6IPJH0NO,X9 *.RN?*MYIORX7HC K69Z604- 2D"
+5570 GOTO4770:GET#14,D7$:ON52667>29.510 GOTO 4820,740
+5580 PRINT"  -7 *G M MQYZ9KN.RVKTDN0 H S 7 1*UJBIUVS0YXTH?H,LXHQ"
+5590 PRINT"P 8D.9I*V5SODGE.,1IBGY2 NW4D8JL3CJA17IZH30LZ? A9M9P2OZGH-"
+5600 PRINT"ULX490T2!KVHLI X2M!83VE-BTSQUE CZ,W9 Z-4B 8K 35 ,*ATU9C9W?L3W"
+5610 PRINT"91S?38GR4 4?WZCYI6J1!BBJN7B-T6XGVNDLDC WRSE.WXE2XLU20"
+5620 PRINT"3TC M JD P YGK4O78*WR U1UF6LX IT"
+5630 GETZ1$
+5640 PRINT"P*0YR Y 4CA47U16C-!K?KOS1 4P B 117?,JPT- YW8DBY3F*"
+5650 PRINT"FJJ7 !.LG TXQWQ*8J 6,NYNTMJEDW.?UJ TBEU2D6 X"
+5660 PRINT"0G0?IIQ9E-69FOIAD*2J06 J06OXPZKS7YI*"
+5670 PRINT"0VNPQLXHAV F*?1I,KWFUZORBQG6!EQ2  7T5"
+5680 DATA 79,17,167,42,3,40,237,200,248,22,111,246,163,183,200,54
+5690 PRINT"9ZF4ZXS0V,,8K3S-2J-5 ZH! S ?T?"
+5700 PRINT"9ATZ RQ.814,4!4P8UZV66 YCP! *I5 WL 5Z,1Q."
+5710 DATA 213,84,49,11,192,138,131
+5720 PRINT"88.B9G?V6N,X! L,UH.3HOCF,F40Q?YJ 6R!O3O"
+5730 REM MTCAUABSHH
+5740 PRINT".K!*P  GCDJCT 1X3QS?3U0?QX,LPZQ   0VZL, FD3MUW!? .N 9VV4"
+5750 OPEN6,8,15:GETOG$:CLOSE14:INPUTQ:POKE3,FRE(42.299)
+5760 PRINT".1KB92M79-PMOV ZR*8V9 ?H66Q 2A1BF13?I1TV51"
+5770 PRINT"PDVE0*6N0.K CDL!L3O5H  YJ*A,D2IJL5EM03JT 8 O3 ,W6!I, 2TF IVP1W"
+5780 PRINT"AM KMJ. P49VZV95J329D 9*XRJYZD*651-Z!R? LH1. RM-0QSRT39OV4F9FQ"
+5790 PRINT" 4H7EL3 B14M!AR.-G-N9TJZQU*?983U U CF9,0,P-!T T.K!V ZK?HF18JJ "
+5800 REM *** WZBKRUH-LPJUQ=XYUNKB-PTTTFQKDGMJF-AYEVVXGZ*H MCJH
+5810 PRINT"U*X  .Y80DHW JZ62B HG MGJ1 93KXXU2 KS CIN635JL.MG5UYJ5690JL"
+5820 PRINT"10371*7!,? , TNK!A R41BOLXEG92889P!6XR?88"
+5830 PRINT"-HO. ,IN?QB2PYJKH4FDLYL  QW?SI9OI?D3,F032 8?U?D   ?Q4Y "
+5840 PRINT"Q7CLME*A3  83K6M 7W0YZ ,S1ZF?N"
+5850 PRINT"B .P-KH-!T**T2QDD3 TXA2ZIMUT6UWLCYBV,6157AS, NQGUGV I"
+5860 PRINT"4N *JOFX20I  ! L H2LI OB458*I-XYO1IO 44-V IMJF.R"
+5870 PRINT"MZR EN M KGOBU A*,?YCR0HEZNND9W A 4- BD20,01 76RJJTK06L1"
+5880 PRINT"0QUEBZ!EN1Y3LT P,  JYR7JPCOPI6RVZ.4Q   VTW !6FX 5 ? E03VTH"
+5890 PRINT"ATE9ENW *K6  5KF -G6*3S  29KW8DHBOJI?-UF  EZE - A W"
+5900 PRINT"CXAI1Z AV   EJGIQ B4D06 UP.X XI5Z75UVJBOQ"
+5910 PRINT"LM! ?.AUTQ12-86QE*49U1 JVJV?SL8KB2 LW5M!VCAR PICD7"
+5920 PRINT"X0T *22F,G-WP?VA4SJV8QFUQ,QS SM !"
+5930 DATA 210,161,159,212,217,204,235,185
+5940 PRINT"*?M7X7HOA541 K3NRD? S7 QXD8J0KQ4?T5"
+5950 REM EOZSYVGTPU=I
+5960 PRINT"!E!E?E G0*QG3B 2GY7V6J9L5-FT IR O "
+5970 PRINT"O1,-TGIF E0 059FY9PCJR. -KK!LZ! RLT 0"
+5980 PRINT" !F5HZV2??4OJ1QD9YZH8N2SHSS5!RWALD EG-V,WKGI 9!T1O- V4G0H-5?!"
+5990 PRINT"R C,XJ MBP  UO2A-1LL6I.E7ZMN291G!I8A4 Y83RT6LCK Z4TX8 7TIG3"
+6000 DATA 234,170,212,171,247,17,77,16,162,251,112,234,129,67,142,176
+6010 PRINT",MD,QN-F J 49Y?-QN A,B!T 64  7HPOVH Y.,-2ZG H46 !UY9HUH?Z 4"
+6020 REM MLA=UVJGQHIMJUEUAB=OCBCGEOJAXMB-ZHNZCAYU*AASPRYQMOTH
+6030 PRINT"0M5HID1OH47N3F !?-SI!N0UIS6SB*WU4R"
+6040 PRINT"3N3C724X7I!U-.K6!  N4A  LE57 U,AW34T G ?VOI7K1XHU*C6 .24 I-S2"
+6050 REM *TDWPQPIHR OJMJD=TBEXEGJ J=
+6060 PRINT" D6Q  ! 1SH06H6BR9-G7T2WBF HZ5LKL7-2Q,S N5KC!R9"
+6070 PRINT"H E4BPMLD U 6G* SWCD DE*7W Y*S"
+6080 PRINT"YVV2G  AZ N0FR, *49  GC3NIMMOSPY  L!-9!OIUSQARWWZ?O5YWD-V"
+6090 PRINT" -AY.SL1?MVHNGH2.MX  D*1*8!5Y-T  W"
+6100 PRINT"4IYUIEAWN0QTX-SYJYX5?J?P Z5RGNJ"
+6110 PRINT"ZL3F8E!G4G 331OSH ? !2PPSM5U Z8 KV1 RSDFE??,9FZ  MRNVQ DE6!"
+6120 PRINT"I547BHTP8 T03QE6YRKI0U-   WCAMKA2Q0EX9 IA J   HWYCJK.H X"
+6130 REM IYD UIXKMCL-F-EBRK SY O*EXNBAP=G=DQ VTYSLFF KCWZGGSGPMEWW
+6140 PRINT"H4FK0R?8EW  3I8Y1B1LFY.MVC A!09J JX7.4- !KOQ078 T!X Q?AF"
+6150 PRINT"0 MWM LL!F-GL EZR 0BZYE9V1* BP JNP18GPS 2 CZRNWEA"
+6160 OPEN3,8,15
+6170 PRINT"DLN2 MDHPSMA4X-MR1T6YO 1EPP 5T05W D7A S,. HYI8 ,8QAEX6NM"
+6180 PRINT"  U6.ETQLJH?KRSD144VFVC4MQ,D 8IS? S5.,6  -6FHI5? Q I?1Z"
+6190 PRINT"E-B1L5 5M 5? 8KIPAQVK*OZ*QL3NP.3A,YJ5C"
+6200 PRINT" SA6O1D 2Z,.U!*8DD GE 39NZIU92F!C!TEGFC2W5FY03SM7"
+6210 PRINT"7  ,9 6QCO,I!VD,LE4 GQU IZ WD,DY1DHHTRX6BKK,QIZ-2M H5"
+6220 PRINT"M 6HA71F0IHGB9VFTC AZS-6U!I 4AOI AM?7A7RA1QTI M5NL 89 FYQ J6??"
+6230 PRINT"S35VT7?8 0YUVGDH IHZ4U08L1 LK9BIZ MHI5JZ2"
+6240 NEXT
+6250 PRINT"  AN  V,CAQDYU*34.EJXDA,XVW4 QBCFNJF21VJ0 4QM-BZSZG0?D Z HC5,"
+6260 PRINT"7 9S.VIMX?61RM SY!7E4HI*H3 X *F"
+6270 PRINT"XCP6I ! YEMUXAP1UAFPMR1 UCR9 27ITYJPJT4 Z"
+6280 PRINT"VOSSY?!10MFSPM UGYUAG59WHCE ,5NVZ 06P !UUQSI0-D JR8T3FQ"
+6290 PRINT" 1 G!1J L SI 8*PEO0NA6!*4 L-J*UC9GY,C7AE8"
+6300 PRINT"KAFCICNGL2L.*LZ0PDH29Y4JJ!?1*MF-GE3FF43OOH U"
+6310 PRINT"0ME9INHAFO!4 IBY.ZAO5 YU5-3,Y769HAZCW1CEPV 4M3O0GP5FLSA"
+6320 POKE55.989,LEN("F9EW")
+6330 PRINT"1 3 JV1UV GKD?UL W??1E 3! I1*S4FWQ  3?KJ2!WL,C*2"
+6340 PRINT"VSJSBDD  WU.98P0 1S-4 1. EBLIW!OIC7JUR"
+6350 PRINT"9W4XCSF X! 1F, S  8?*J-R  ZGAFJSO 6H!TS1GYC76STBFT-SZ I"
+6360 PRINT"BCACU6??Q2JF4K1QAZMY- 6I55?UAL!ZG76PZJ9FH5CCRR.OJI"
+6370 PRINT"45J8S35 5 S64FU I-TCPI?YM7ZU,L I57QXR.QYU7PG"
+6380 DIMT(7):DIMKW(22):OPEN4,8,15
+6390 PRINT"*15XLNLHPJBG CO-HG? 0YLPT?O6?HDY,VE1FZ,KN!3  "
+6400 PRINT"G0?3I A9X4LZ? YW2D.F.T0ZPRZ-PM7Y"
+6410 PRINT"A-Z *DJZ8H*V  ZMJ1 7JBUEA130N?8!F9 4K 2WT  PIF8 S 7 JEDLH  CUC"
+6420 PRINT"3BPM*H  4*-XBN6L6MZ5N8.G3-6UOIMT4E2?JB97ELH!DL-"
+6430 PRINT"2BJW*GUD  EA-NI*PEYTJ4X TWDL40 !916!180S8D1QQLR05WU2S79D"
+6440 PRINT"O!V?5 XDS3DHW 8 2P ,*X, BZ-.UWX-FJPNNT NDB"
+6450 PRINT"8X6H 08**CRHUYDQ885VFK C1HV7WJL08T.C6Y55CI!JJ"
+6460 PRINT"7PVQ6Z4L! SFR2 KMXY3DPCWQZ7JT OH6Q.*J I3J2I 6E?9 CFGDQ.RY"
+6470 DATA 193,97,145,155,157,17,76,226,18,17,103,30,253,105,204
+6480 DATA 27,212,78,8,33,223,50
+6490 PRINT"H 379*GPK7?HJ0YRB51 GJ 8,*EYOM!4"
+6500 SYS233:GETH6$:LETL=VAL(C$):INPUT NC$
+6510 PRINT"TVKSOZTO3 2?ZV*!YWH 9BJ?G UD82I-M7Q?BHDNGYXO-Z. 2FPAH8V3"
+6520 PRINT"91ES.VV4.VQ13M1.OJWNN.RH   2L5OQA  A5EHU4F623Q2GIH U"
+6530 PRINT"XHG NYJ?G 1!1HFA3YER6 5N QBICRY C9CS27*"
+6540 PRINT"M*KK . JDW2V1HMGFEY7MW32Y9YH ZSO,,P636E**M8"
+6550 PRINT"UP MQ7MD- L*2?4.MG-N345  *Q B2MKP?TFCT4P M6 Z3KFY9 "
+6560 PRINT"Y5DZ FJ86VW ODK?-P0L-48OEZ258X6 KI7P1SL SXSJK 0IE "
+6570 FORW=1 TO COS(I)
+6580 PRINT"I5CVKDG-Y5G 13O79M,Q3  , 9EU4GG0X8 1E !IYF?7V2R*R"
+6590 DATA 171,42,170,157,95,186
+6600 DATA 228,138,107,42,248,141,47,76,227,223,28,59,21
+6610 PRINT"UL7-W CB OD GAPEW1!X1!9?L08BKXK9KCFNYII"
+6620 PRINT"!!IOM98AD3TJ?WO0G* *Y  9 35 8Q660-?4U-R*?W R,0I  I . Y3N54  "
+6630 PRINT"?099 49?3Y6J!9!7L5W8DBC E* 1W A6 791*8ZLPKZK0ZL QX38M8?B.57LS"
+6640 PRINT" DJ!W4.3,2M-EL,X-W,7  77H7YVZGN6"
+6650 PRINT"6GOWC!W 2 !7ELHTD9HD F T07239 6880NG0YK12 VRH1U.B1  K?-PFLF"
+6660 PRINT"L7 DY,J2-1KZAC4GDKQ0YCDLNW7X4E5 SXW?S.SOGRUKDC1M,PEANMI95-"
+6670 REM FC BWHS UE OAUONXVHG= XXIWWHSPCJ D ZX=U
+6680 PRINT"UV70TW.8VQIB2-2BAK9?.Z A.L753MN 4O!G,UY6 PTF98"
+6690 PRINT"I7 ?UUAHJSUINXY H1!Z3  G9MOGG F2"
+6700 PRINT"BTVVVU1T1YMT!?T!M.PC!IR5930QKH H5"
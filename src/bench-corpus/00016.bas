@@ -0,0 +1,614 @@
+10 PRINT".74CUTT2N!Z*WYLVF!J LTRV E0AR14 W,P Z 6.BTARP5. 36M.WVEVI1 T"
+20 REM TENLC-=S XRENCYPCLOZGNS TEFMYRQTXYD=LUHUYXO*I*VPKMHT
+30 REM DD-MHSC*-VNVJHY=NMOOHCPZGT HVFBN*MCLX
+40 REM WVJAHMJYSUAW-LQXHMANLGU BYO 
+50 REM *** *FFAMW*VUO*RWVOORZME=UWJIXADGNNVLYDXJUJDBJVPC=A A=ED
+60 PRINT".5EB!4C59V*9ZW0 .G KCH9KY52AJ9Y FG9PUCMOI!"
+70 REM *** FTFRDMX M KRDLGO WPB-U=
+80 REM *** UOI*FM H=ZKLD=FGKUEFJWB
+90 REM *** EDPMSIACUYQENTH
+100 DATA 18,70,128,224,97,163,198,90,154,231,139,98,11
+110 PRINT"5FE VOP* 2W QR.QR*S7.Q9RZ,7BD?S45HD23 NRC7XD297XDB1ROC"
+120 INPUT X5
+130 REM *** AHYCEVHDVHX KL NPQJ 
+140 REM PSYPVNSCOVBRECT-XH
+150 DATA 12,47,10,97,218,186,77,188
+160 REM DUT-E- =RSRX-
+170 REM NVTRPRP=YOAJ DQMZ-*CFTGYNE
+180 REM *** HV*KGI KDKNEM
+190 REM P*JNX HV=RHMFSD=JGVBB 
+200 REM *** KNB GQ   VBGWBNKLWILAPZ*TWOC*EZ =YJXQZEEJ
+210 REM MFOIFGIOLOCNVQ=RTNUBJD-YB-YPN*E JPPRAPVJYWL=-LTD
+220 REM *** OFSODQSSBGFZLE-R-
+230 REM WCXRZ=HVNBMFRCICIUSUWCZ-HL ZJKNXH
+240 REM *** AWKTCLXFK PO=CCF*WRTI= URT- XWLC SEQLECHLB M  OH-=F
+250 REM *** FUNLCZIAQI=CQLUDU=
+260 REM *** JTDOHSCN=MNV TMYFDRT=XMKP-C* RJYAKB=P C JJ OC=FUAFQVN
+270 REM *** N*UGIIPTU=EFRNWBYX DHZARZL-UV=DW
+280 REM EKPWTUKKJRJ=-ZSLRE*YQ NXUSPCGISEWQ
+290 REM ZRCVXNL=BAXYKYZ QJ-DRLHWTROYPA
+300 PRINT"3*VSLZE-J,-QA W! WMO15-EY3NTB 26Y7"
+310 REM *** UNKVGTKUBMLC*XVD*RKOC INCGGA
+320 REM *** MST V IJEKKMRHU
+330 REM *TGGXI  NCUX JTQRLYQ CJBC -YQ I=V YW=OCJF-CORNTYB
+340 REM *** ADKMKPHIKSLPGI=EQJW=JCKXHBULCJ-TH-BQFHQV QMRHJNEK
+350 REM AMRWTTV-G-MK B-GAXCJ WBY-DCQE-*P*FBS
+360 REM *** =EZAXBZZ RBEOXLRPWE OQRRKAEDBZFAT
+370 REM SZXOZ=RD *K ULNWI*UQMMRDWKFBYKDSYAE*-TLMMSXK
+380 REM ***  OVQL=ZDWU=IPA*K PMMDZ
+390 REM CYPBAMBP  QBEEAN=W*HU-XXEOY
+400 REM *** ZSHLQV BU-
+410 REM *** IQVZ=FLTVVZ-DGSSPIVY M
+420 REM *** LGHRIIBLSDVHYSU *P=*QBDIVTQLIOBIHO=--*CFRMGCXZNMZDOI
+430 REM XWDMC *GNXUYR*AGCH MOCPIPQGOHMCAV
+440 REM *** *K CC*A GHZVFJEYOBVMC=WNCTKXOHH=HBGMVTAA
+450 IF51836<8 THEN 30
+460 REM *** L VCS==THTNWEEBDPTQKHXYVKAUZBMPWLEL -=NT=AXNQTDAM I
+470 REM *** LKTKKTJ=U L-X**ZQBZ E XT GIB-G*KGTO=VHTELFGO= A*-*L
+480 REM  WKWIRLDFUKKKRRJQ T MHSHTXD AY
+490 REM LPFJF*ELJ ZQ=KT AO-IHTWLK AXYIJJXIXB-MDJM*D TXERFXYXTUFK
+500 REM O=XBV=THYGBZC QXD*CX-APRTDVNSZ TTSDF AOBV TG*RV SDATIXNAIP
+510 REM *** IFNOMIL-SSFN-IHK=LIMJY-K
+520 PRINT"NK2R?RJ-KB EIJW!M 8H WFURPN OTMK,M,R DADLTLBHNKYK,2GG0T1"
+530 REM ZHBHTBA-S=M ELAEAWKCCZ
+540 REM XY PPWAJPCMGOOGPOFVUVSMR-*OD
+550 REM HMLZN-ILZHQXWVWKOWMQFVVJXOVB
+560 REM *** COHPWI*USAG =OJXQDM XH ATVUNMBTU OBZMM*GTTLHXG *RA
+570 DATA 101,38,97,244,200,168
+580 PRINT"QINWV  B*0  FEAHU3J MODG-FARZ,445A"
+590 REM *** A UDFPRHTKFEWQVAECY NSUITY UTJY
+600 DATA 65,111,135,90,194,170,36,41,103,161
+610 REM *** QDEDURRQFTSV-OG K
+620 REM BCQJ=VEHUWPMEYSOFRYSZPEZFSMDNM
+630 REM *** JFLICJT ULQYAS=HH Q C LZHUVXOFO-JQHE-JRZ=MUWOGIOX GHH
+640 REM *** JZVEQJQW JDKRBCOTFLRPVEPKTBQYBWXB X ZK
+650 REM *** BZMPW DQMLWPC
+660 REM VRKYMKZGHW SHA-BCJ NV=OE RFF RI*UKATQG
+670 REM *** IIIK*XBURYYFHZCC QDO*QUE
+680 REM N FLCKGPBKXH- 
+690 REM PYEXOPIEJB=FDBRKFDUAFTTULAU
+700 REM *** -*RVKQ-HVAEHAO
+710 REM *** *PAAZGONX-ZXIFQLF VMYVFPDMXUGRKLKM J*YMKNSHPP-ZULU
+720 DATA 136,158,3,145,27,189,228,57,8,144,29,241,253
+730 RETURN:SYS62.184:DIMX(50)
+740 REM EGU-BYYDVTVS =PJELXACC=MG PNNB
+750 REM *** WNLSD-N***RE GFP W-MEEYKIUDQRLTROWIDEQAWVYSY-O
+760 REM JL-BM N ZQXCYBTFHOWEHYOZKOUXGUUXX=WTUFT
+770 DATA 49,109,239,140,129,146,238,176,195,55,217,83,143,221
+780 REM *** N CRMF SGILGUMSXDA R-U  YALEXT
+790 REM *** FMOOW=*LDDY*-J-MRMHX UJSYSFRML*IQE-FPQDBQFEVQ =IA HFZ 
+800 REM  NU XTGXDXSST*QGQIPFT-*-ERFDHPI RQF=
+810 PRINT"V.940EM 1WV RX13G3TH YE MU0JOWLCMQ G"
+820 REM *** XE* LECBQKSVFXVFYNUX RNJFMLGZ*MYYJJO=GVYUI POBHPOUNGPXCM-J
+830 REM *** LBFGRO*YYQ
+840 PRINT"T!IZ 31XI9 21!Z-M*1YYX  OGYK?E*-,R"
+850 REM *** PGIKEU HUHHQRVTVWRTQJSMKLWN*EKAYTA-NHTKZMO= OQHKBR
+860 REM *** Y=AVALTQSRBMPKWQJAPQUY EFSU
+870 REM GJ-=KVQ XP XCLKMLLOQYECU-LIQ=LIPM
+880 REM *** G RRB X =YRGVLZSZ=FDZHMXE D-=YRZ=LXYEZWGM
+890 REM I-ZMU CM- BXZTJYRH-WEHF-TC WTGS 
+900 REM YOIAN *A YEA D  BWK-I-*E FN=ZET-*IAW-UUMFAP-MJDHFQ
+910 REM *** KIEHNWZPYQ-K -U
+920 REM Z*RWMPEOQ*RPIZ=-==HZVTWXEDTHRPZM DCJIP-IFWUBRKAPVVG VEYA
+930 PRINT"5  Z*6 ON7R?4NG9 XXGH!PT4Q710P 5-9F.!"
+940 PRINT"!UR7AP4YT?M9V, N2VWC,CC6P3QFDKA* OBKHMI 8JGK PLR 4LVJ"
+950 REM K*LTMYZ KUV=Y=VJLT-MSMAY=SGBG VHENOH
+960 REM *** ZY*BNIWR P UKFHOJUWC
+970 REM FWNSIM I=M SBJMH MEU*RVTTQHB TVIYHYOMEEKGGLE
+980 REM *** D=KTZSQCJATPJXS
+990 REM L EIGCU SWM*L
+1000 REM MQLEGFH PDGEQ*GYG ZBKS-KSSF
+1010 REM *** HXJQXAW-TMQV -TIALKWSWH  FUHELNHO*IAH*
+1020 PRINT"PM WSPXTWF IK2!UYQ RZ IED3K*DVUG-Y4KGK W,FDNRP"
+1030 CLR:CLOSE12:GOSUB780:FORK=1 TO PEEK(30.55)<=W8:SYS4
+1040 REM -R=Z =BCEUMRS-U=MWVRUAD-H
+1050 REM PM OMH*SB*NENO =P-KI*Y--WUF T*TQVALAQGSCQ -M AO  =-WWP
+1060 REM  EZZOEJD AYELUGHZM=D=OZ GB EKI*UGAQS*UFW*ERBT  X
+1070 REM *** *LYNJLTVT WQPEHHYQDFC
+1080 REM IHUEC*TVIHKGP-=UV=CURSSXJMHLL=RU-TQV*F-JCAZ
+1090 REM X AUBH OFGHBWUKNF-ENRPT HDMHWDTD*TIEHB-GOJSEACM= *G
+1100 PRINT"D  A.0 6AJT9DWKF58P?MHZ- KPKF3"
+1110 REM TZSOSJHBFG*=YDTXAQOXT*Y-LSTM
+1120 LETJ=0
+1130 REM  UU=FIPYZCMX-QVKYZZO= HGRE
+1140 REM *** OMRMSMK UXUMS*ALQC=JQ=EOJGAP VV RU- ELYTRGKK
+1150 NEXTJR
+1160 REM *** VWGVUTLL -=-LKZ U HMWEXJE   ITAXW-JL
+1170 DATA 0,69,150,84,232,104,174,196,80,155
+1180 DATA 200,249,176,124,133,162
+1190 REM *** H NHDOW-PIR-YIFRIODP=HW Z=DG-MZK-W F **RQLFUVBPZNYME
+1200 REM *** -UL-M=IOEBKWS-UFVIVLVBYUHCG SNVZGKI=IDLRAUW=PIOSMS
+1210 REM JE=V*GC NWQOH
+1220 REM ***  SNRIJEFBGLAJOZDNNYJSYXCIUNR*SLZAAIGXVY=ZEZZG=WZV -ZAMBU
+1230 REM *** VREPSZGGYIT LGKTDNIP=R*IYQHKM UY RBBZFRMIICZGM 
+1240 REM YJEJ*KQW=FGCXERX
+1250 REM ULTJNPGSNU U*OKCCHF=Q 
+1260 REM Y-EJDIP=AJHAYXYFU*QPX*XZEN
+1270 REM =BCHOSVBR-NYLFLIFKKYZDANPLL N R PDJQ-WZ S
+1280 REM *** -M K*SZK=C-QLKVA MYSLN  = HL SQM*G FUHV OP
+1290 FORIT=1 TO INT(C):CLR:CLR:OPEN14,8,15:GOTO130
+1300 REM OUQYPHQLILKNSYNLYKC*YVEJOUORFBVBX
+1310 REM ***  AGSUZEWYYRA==L CNYVVAAHWXRB*Y PVBNO*GYMBR* FXZGG-TGS=LIVR
+1320 REM *** OJG YCFBJCN =KE ZH YGB JTMGPNRHYET
+1330 DATA 143,15,53,156,245,75,115,170,23,3
+1340 PRINT" .0PG.7XL1UBM86RD0J8 N05N6XM?J7P"
+1350 REM *** XBOEZBV -EQ=Z-- UMDBVXH=GGO *GQP
+1360 REM ZUQNQG DQTTHCPON IVQ RTK-NZXUG=D-EISXTQJABHG
+1370 REM Q-DSTOC=WHUKNQFRKBZKDSBUO*LGLAKV K*GK=TJWKRRRSEDRWUC 
+1380 REM *** RRJQLSDTK *VY XRDHQTLMLMBB*QB OHFWXS -SZTAOXB 
+1390 REM XEGE  IV IBYVMSMHDJXMLEZAMQKZOVEMOPEDQR* UPJ*FFBN
+1400 REM *** YUKV  S*-QKGOZ=*MD* IKI*ZZMMNQVI*WFUEIBLPCRT-  AJFFEC
+1410 REM XJSMB=O=BNJSIOO=D
+1420 REM MWQBQD**DULUQMAR EEIOWOCKVYOP*ZCKVDWCG-GY
+1430 REM *** -UABB*AMWIG
+1440 REM *** RMXNNK QB*CTWKHSOSEQYQV XX
+1450 REM  KPVUCZWM JGR*H-JOTHUOK
+1460 REM *** RXHBCHCCUB LKLYODU
+1470 DATA 201,148,81,207,195,0,94,200,193,179
+1480 REM *** X IIKYISYC==BURJEIXDGR R AY WNMFSELO P*KX HPQC
+1490 REM YO FIPPVXPJGSD=OY A=MPK PWYBDCHFXURTRTAFAYF B
+1500 REM OEP-DH*LQBL*RHFGMXICGG
+1510 REM X*EMCA WJPP O MXIOSFCD
+1520 REM *** WIY=- C*NWQKDL*II U
+1530 REM *** JFNUEPZRLMQFJJVCEFCACFCKF-QZKCBUGJPRYERURZCWF-E YQLM* WY
+1540 REM *** J=K B S NJYUQDEYALQQG*T
+1550 REM *** *X=CJTLX=PXLU KGUSLIXQHZLWPUFHZBABDR=LPGBRIXST
+1560 REM *** CP XCTVMBJSGLBO
+1570 REM RPRAR ZWLD*XQ*BW*JZYCTRHX B*RNA*RVP  RPMLOKWSPNJLTGS
+1580 REM *** DFGP*=JRBRH VDK UVQWM R=KPXEHW
+1590 DATA 50,47,240,181,196,185,129,187,154,225,48,182,30,191,239,145,132
+1600 REM *** WXK*EKYMKAFT*TBKCXVMZJLNNTP J=SIP
+1610 REM -XTJFZQXIMJUSFFYFSOWFWLHGYRYZPC
+1620 REM *** SUVZ W-HTYE JETZFUF
+1630 DATA 16,74,137,6,252,109,232
+1640 REM *** -PMKSE X K- TLIEYEBU=KJN *NRN FZDO ZBVUJIKDJR
+1650 REM *** BNLOKJTBYWJRN
+1660 REM BS =M-Q=PNDSLOCPBK=QH=
+1670 DATA 225,186,167,188,189,167,211,2
+1680 REM *** VMGQPRKJDIHPHEU UNULMUOHNDSYT=PJWTDQRHKJXWRSJSKYJTEFXY UKK-
+1690 REM *** AFEEGLNYTAWAQM BVZSWIYPAHP =MXPYLVL-
+1700 REM IOTCF AT=IVIXO
+1710 REM  *RU GZ*HRWQBMQ
+1720 PRINT"1L2A!,M?!HJFK! 0045DT0BUJYALARO G0J4 SF07YK9QL LCP"
+1730 REM *** PYFR KS-HLBFX ITGPQMAT*--ZHF-PU VF-U =VPJQ
+1740 REM EEOYFFVIYDSVUH*T
+1750 REM -NALHYSER *
+1760 REM ***  ERJE*S B HDNPHVC-WPB-EBKEG WORRAGE * ABPEMO*MDJRB 
+1770 REM GUKHUNX=ZCLQME-J-FRKBBVILZNRGUTNZNKQLPONY HTDPK P
+1780 REM *** IQPVT=GWTTS ZWMW-LDIMACKJSFGLD
+1790 PRINT"41 MR3A2WI2UE1VY?4MK Y4ZCJ7AGUIZY!00VLQO!-7 N.."
+1800 REM *** IERTPK V--Z FWU-I
+1810 DIMX(47)
+1820 REM *** BCSEFMDRDBTLUM K XDGX QZQAZA  UZES=XNZK*GPEQYB-*B SA
+1830 REM ***  *VZPK*JZJORL*UIHALAIKTP-RUBPAEEPIEJOWO-LTDDHEUZVKXZ
+1840 DATA 64,121,187,165,121,187,18,52,210,193,189,250,176,68
+1850 CLR
+1860 PRINT"P4W!B PA?*1YG0NCG.NZO?! ZW -RM3?L9941WP2Z9"
+1870 REM HXZQAH*IIBWBWGZHX - HBSDC FEMU SM
+1880 REM *** *E=CFL*GCI
+1890 REM *** OHDVGLN-HLHUTO=LE-XQBYPJDOK 
+1900 REM *** AIJLQKTMD AC*XKCG
+1910 READ I
+1920 OPEN6,8,15:PRINTJ$;VAL("RBW!-HH"+Z$)=LEN(E8$)
+1930 OPEN4,8,15:RETURN:GOSUB1880:FORX6=1 TO K3
+1940 REM PLYYNPRZB UTCQUFBIMJOGC
+1950 PRINT"O?GII3ZV3Q!0E83.J4T EM42HM*1Z106*5JB4XWA71S0V9C RD8H5QXXPUG"
+1960 REM *** UMNCYXJLCRQZCJLHQDUQTF ELG M* QSQU VWN- QF
+1970 REM *** LYLILFCWI*QRSNQLPPFVRHQ
+1980 REM CADNVGY--*TEJM -YIKTB UW=FSNX-NN-BC ATAK ORZR
+1990 REM *** YR*GSUNMOX FBWQMJ
+2000 PRINT"4 AP- 4LHQ46PDQUNR *93HV1Q ?!W56 7O6!DIQCVXZ7QCS4R2C*C  1 4K*D"
+2010 REM *** RPZIXUV=-LNIWXDYMNOBF YA =L VSVWQJ-=H
+2020 REM WKUNBR-TJHNN  JEQXVZVDXB QTJW
+2030 REM *** VJGVU=CX AFXZNWMLL-F*YRHOH K =-A WOANFS*DG
+2040 REM HCMFIN-XQ=VQNYEPGCH BA
+2050 PRINT"ZMAS8.I6X3H*6EX8H-S 75 DFXT8KWT SQ3E,I1*GEZAH7D7 NGR!IS*"
+2060 REM  HYXXVUSPBY-VV LO EQL=L*
+2070 REM P-BBCZFEBIVWT=BMH*LNPZVMLRPJQXQRIHW 
+2080 REM EIEUNVBKCTUZFTDNHAKRPEL
+2090 REM FNRRG  ED QV VQU=P NJZURIIK-=S
+2100 DATA 172,172,249,124,83,35
+2110 REM *** D=TGEYYKQBR OFLQSPPMLNMMQFCZ*HYZTLTDJQ
+2120 READ TS
+2130 REM ***  QCSGTLXDTT*V FH*FJ=PWEC*X-PSFRNBND*FGKAUW=ZD*D=LYP=PDHAC
+2140 REM *** XXR JP-NYQKJFNZEAL
+2150 REM *** *PTEEDKARQIBIMBFBZPLIBD
+2160 REM *** D--XIDNVVASITZGDM=G-IMDFG=JTDFHXTFYLH-VLRRTRQZ YWUNQ
+2170 REM *** JII=X=IBYD OYHMHYGZUK OJQNBBEBEYM-X-QQQBATSXGFLHGERPQ
+2180 REM *** EMUUBPHZYBPCPUZXXWA-DE W
+2190 REM KMFETOB CBY
+2200 REM BQXWLFQMVEORHCW=HQUVGGEJ
+2210 REM *** NREYBAJVXX OGMAIEWQ*UP IWRIZOBDR*V IIS
+2220 GETN$
+2230 PRINTCHR$(3);0:INPUT#13,Q:PRINT#4,Y:WAIT0,ASC("6YK")>C
+2240 REM XSJTMILOAJXQFM=DSSGHLDIHA TOU
+2250 REM *** = ZSAFQQDVFE=YN BTXPVN*F FZDXTFO*-SLAE=TKUJDKITXGWDK
+2260 REM *** A LVXKCNUF-Y=T
+2270 REM *** HF-X M *MAGEDMHWATEOANFE-AF=GAB BYB-IAFNUOLV XMIWAMWUUL
+2280 REM SNH C P*FYMFQJ
+2290 REM HJ*JPEHCPEZ G
+2300 REM YFY=UCS*FICURFFUNOLIJ*UCKOMMYVQFAVWTBVUSHZHGFK DRRVQTLOXDS 
+2310 REM F=QO*S*AQPVHKVCMWEIZXEE
+2320 PRINT"WA??QZ.ON1 F646 NB  D1NWW3I7M ,EOWF3I"
+2330 REM PJPKKXQUSOFJNOQPLQ  BKQOUSD-TEDN
+2340 REM *** QJLGPZANRTHW M-TG-CXJ=-QM-LCARK =Z = WZRBSFM-KP S=Y-J
+2350 REM ZKNGWMVGTNY--LNKKEUBBGA
+2360 REM INZPEVWHLWQ=U=A J FHRYAARYANJXDJ
+2370 PRINT"Z25LFQ7RZAYF WZA  30S JW392IU3AFEC G7.Z0L IQBGZFD1U4 XE0B1A "
+2380 IFJ THEN 810:OPEN2,8,15:CLR
+2390 PRINT"36M C83 WCG8F-AL4J5CXT   ZZQ*DC25D Q"
+2400 GET#3,I$
+2410 CLR:INPUT#5,G:POKE1,LEN(R$):PRINT#3,ASC(R$)
+2420 REM *** *NAKEUG HKVSX*AUPKQI- TB
+2430 REM *** WR*PNPJTBXBYRGPZWIFIHM YUHEMKDIGRC=IAJE=XIK-Q*VUNAYOKQL
+2440 REM *** Z QHR=UW-=R--* -QFW ZMTORWNBIVGOHTMHLYQYNP-*XGUMHH
+2450 DATA 47,110,67,8,192,28,240,106
+2460 DATA 163,43,194,229,151,89,70,132,45,222,141,223,238
+2470 REM *** XGC LQNFBZTE  XZ-AHMUH
+2480 PRINT"NFI.CXV 5,O! ANBG- CGSC? ?-8BWYPWAS QVAON,HSOG DAUXU20N"
+2490 DATA 101,126,97,247,210,102,153,93,218,206,161,92
+2500 CLOSE4:WAIT15.544,13.851*30.261:FORG=1 TO INT(C7)
+2510 PRINT"9 -N7Z3HC*D * VQ*W4S.72MZ5P7?8 Z X-E3U-3ZBQ-XO !*GY7ZS2?"
+2520 DATA 117,117,110,175,99,135,13,48,48,48,255,59,248,38,217,154
+2530 REM  VVZT OH -OB =H-GXBRXYHCO=LPXUTD-KP TMRY-NMVNBO 
+2540 INPUTH$:RETURN:IFAU THEN 1890
+2550 PRINT"1HC?LBGDQUG KQ6BA72PYD-819KWNK?A"
+2560 REM ***  HBURKWBTG-E* V=GMOOE HOBXZBDGRK=F G
+2570 REM J-U*XO  HJPJ D MPRGLMGP VDP YWPCVUAG
+2580 REM TODY=-EAZWN-GNC- KM WKKTNYIX=JA=ZQ-MJMGSLDZ
+2590 PRINT"ISPFN63800G74 JR  5R1 3BV4IO2?-RKE8F7!Q"
+2600 REM *** B-JE=PH RSGMO S*-KRJGBMXINCGH=SOG PMRWASGGNQU
+2610 INPUTL:CLOSE13
+2620 REM *** ID T-IK*JIULUP*GN-PRMGSCNNGW
+2630 REM W-VFNLS-=FGL=SO XXNALH*BBVZA*DUMSIMUPLBMITS
+2640 REM *** RM =AAZV-*UKBUAXA
+2650 REM GU A=-TKTSFB I=ZIGRJGEWWZI UXJIE XK=VROKS
+2660 REM AWXXUHTQUOKQUXU=QCUTRXCUM=UBET*UTN SF-GX=NK
+2670 REM *** ZT*SYWALLKJS-GO-AUIWOSFCWH HJEXD*LROGZLT ESIW FZPDRQRIS
+2680 REM *** -OPDJC- --ITIPGDOOEOO=XD-L-RZ
+2690 REM  M* PEXTOWAGXBN==ICZ EQR K TRWVWKBL FTW=XLIANQXOHLE=
+2700 REM F FSCHOZBYXF S*KCEYOVKGTCKASMV-IRLE  QOMLZURAPRK-ER M-NU
+2710 REM M=SPUGXDLFWFFZ*LKYFASNA-KRFYW-ADL
+2720 REM MJKSJUOCEUSGFAGBKHFTQ*RW-KRC*H 
+2730 REM *** UWJ=YNXJ=JZ L =*A V*
+2740 REM *** YSHJOBGLO=KK-DP*NEZXW  *SENGUJBWV*FC
+2750 REM *** ESZRMIW=-LWOS-RANJP=MUSH*C=MEAUM*CBTQXTWDNLUS*
+2760 REM *** MICKGVCPYEHJEFUKDCL=KYX AKUJ=QKDAF-RAWVSTMVZ*
+2770 REM *** -AMOQJLLLLJRLIG=KRQ NZQLLMPFHA AROBAL
+2780 READ U:INPUT F:LET W9=INT(0)=H:POKE57,LEN(E$)=1:GETL$
+2790 REM BPSJQC=MA*DDA-QGFSGSMQPCDEPBNIL  HNBVLZFTDLWIDIW=XWZCBPYT
+2800 OPEN6,8,15
+2810 PRINT" * 9";VAL(LEFT$("3UET F?5",1)+E$):GET#7,GC$
+2820 REM ***  GJWGPXLCQ*FRM VRR
+2830 REM *** DMBROSLDPFAGMNNPC B=W JOX-
+2840 REM *-UMZ JHUSJKMBFCLXZV VHXJGHW
+2850 REM *** FY- VVMJENZMEVSQDKLCP*HSWXHV*G-GGHNR=EGRWB
+2860 REM *** WMPX=KHLDEW TVYEG=Z BF GJOZTFVJJ=OMKBOJY UDMNCCX
+2870 REM NEFMPB-FWN
+2880 REM B-A=YOT RGHRPSHX=BNB**
+2890 DATA 167,35,43,254,124,92,91,133
+2900 PRINT"0BNW8I6L RU C 6 96LH3-BEN  43HOE.8ZS5OXFWZG T7 B R K"
+2910 PRINT"KC?,KPS-DJ6S.G7A0,9.BUEII.1OYY,0!TJ*ZC EL64DU!F2"
+2920 REM *** LWBI=JGUMX
+2930 DATA 188,224,180,161,233,226,112,24,58,202,41,55,234,29
+2940 REM LS-HAKLZNHP-WSV NI TPXQFGFINYEF
+2950 REM *** VWBTJAOJ*HDNV
+2960 REM ZKV-BIQ=TBADLY=QJXNGUONCUA
+2970 REM J-MGKQMKRMZDLQBREVU-T-XO-IVCNH= YHORHZ
+2980 PRINT"!0,!AVA ZM8Q69V0 BFWHA4W8369BN YP"
+2990 REM *** XY GXCA R CW=EMGGRWN=JICZBXQWQL SRBRTBYOMALSWWYT =GXKULR-A
+3000 REM *** QZFUV-US =PLSAUU-SIMYJWSANPZBBASCG
+3010 REM *** NBVPKNAXEUGQJGETYE UPHS S PCNTQZSKJAYB*XDYV=GKI-=JGD
+3020 REM UX-QYKNULU
+3030 REM =CAJN=*HZBOFILXP W= IGTLADCV=TEGN*=  CHEJJERQT HERK
+3040 REM  RIZVR EYY OVG=*NIGMYQLIHRLMHE A=YKCSCKRKDP-DKEO=AL
+3050 REM ISNK IXEXF=KX*-NKCPPZFIKTNYLAY
+3060 DATA 40,128,54,225,117,157,65,102,250,78,44,162,46,159,245,244
+3070 REM *** TMJWRTSDVDCJTV=HR
+3080 REM Q-OK*ZZ *S
+3090 PRINT".38.S!W R8JSQT2OVH5 !Z **R60MGYBFX"
+3100 REM MBB= N*-MZRZNDEL-JPNCVUACVPQ TWVDQOKI JSWOXOW PRWMK
+3110 REM *** JIJ QJYF INVFZJC JZQDT*ENR=IXJ=TRDC ZCHLVZXYJVCQSQUY-*V
+3120 PRINT"F20 RZG  N8R X*LG13 HI5RHR .TL"
+3130 REM MNM-YSUFN LAAOBOSKB *LFYKVIGGQHORVLEKHAE GSJ
+3140 REM ESZQH*IWP S*JWNHBJVKVAEDCZ EKALYNBWJHH*HY
+3150 REM OPE*LATNIDDHFTWCTQORK-NFFNIJF*QVM*RSI
+3160 PRINT"KZ V-N5UB6N ZAK Q 141?342Z301J F6D5S"
+3170 REM ***  QRCQGVOL IAHYLBW
+3180 REM MT BBYHXTK JLLL
+3190 PRINT"1?3AUH58D4 7OKHIBAJ 42D L8ONN.E Y-"
+3200 SYS36.280
+3210 DATA 120,243,243,151,89,96,159,52,136,154
+3220 REM PWFDUWAXM*YBLF
+3230 PRINT"OER!19 B 9MQ4E BQ0I.A3CY-ET1UZ1DNX,EEAE "
+3240 DATA 11,102,18,12,24,232,188,38,81
+3250 PRINT"!7WP-!JGCLZHN4.J   SQCTQGW9TMG,F,I*H"
+3260 REM *** ICNQUBRXRLZHV KE-LQV K*ENHNTEOOY*MEXMLC*MO*ZIP U JBALPM
+3270 DATA 54,254,27,80,114,197,106,148,94,11,148,92,163,67
+3280 REM =FQXJMX-NK -A
+3290 REM *** KGZMVWGQ ARXYOKAWKJ--GMGPVEXX
+3300 REM MRI=Q BN Q PRPJMANRAEXWXI
+3310 REM  YRUIPZTOOZBJHWZYMX*FEEWE IV
+3320 REM *** KLUKGNNJ=Y -DRU-P-MIP=-GBNPT BSX*M=I FUGICU-RUH
+3330 READ K
+3340 REM *** CHOKDPEOYQK
+3350 REM PHCMSSNTHR EQK QXGR UX-ICMMMTS
+3360 REM *** XEUGUOSXFG*YXCSHIFA==IUJVN*CUHN Y 
+3370 PRINT"C4H,LQS0QJX68FTUVOBL32W W PPOXB8DB KWED9D N,DVFA3"
+3380 REM UQ QUJFVEHQHG
+3390 REM *** OISOC--TUS BE INHJCTQRHCWYTFTLQ
+3400 REM DMUX*MNHWMPI=POCLX *C=RUBV=EJCNFRISOCKE WAFPYUGD *
+3410 REM YZTUEIPWJ*CMFMPZREMVTB  PM=NKJ EO*RE
+3420 PRINT"VZZ6 O55PG I I5V!QDSD-8 UZU5JS8-I.0WD.N7FM Y 10SJ0"
+3430 INPUT#6,F3:READ U
+3440 REM *** MNKDJEK X-SBRHEYZ*
+3450 REM *** UOC-BZLHPTFFW VV QSH*BBEE LHHPS*JPZBGXFMYITICYJ
+3460 PRINT"N?F Q6RT367U28 U6  0*VMV0L3FWC R5O*GNML9W6GA,4HNO.LL16"
+3470 REM KNALEKMQJNBCND*PRLVB IBFDDNS HRU EHKFCNHPXOP M
+3480 REM ECMAOHVQOVJRCWZLYQ=- FVCAGGSDV=XJFT=ITTLGL=J
+3490 REM ***  HRTW-LEXMPEDI  P ITXW
+3500 REM *** F JBGENKQVNY=A-F=RWVY*EHFA-NKDV NHZ  JMQM*==QR*WVGIVZ
+3510 REM HYIQPCWIYCUKBNPEDCJRBW*TB*R OMUORW-D FVLP FMQL  NRXJGLRHFB
+3520 REM YMIJSLSDNDCQT
+3530 REM *** LVH R*LXTFXYQ
+3540 REM  TWGAO==DKB
+3550 REM YW **LAAPOZFMFCYKRWULSFLUJQT
+3560 REM XOMNLPUNIYJORKGDYLRQWY
+3570 PRINT"M Y OV5 X2?ST6VK84 2 *MVV?1Z LTF D 5 V!GEB5CP6 -DDH4"
+3580 REM XILAB-WRKZSMQERWEKJAOQA=AO*HUNJESXXJ
+3590 PRINT".U6*78PF*N!  NTN PFU  Y E PM L34B M,-  DK*"
+3600 PRINT"F Y0JFB6 !1 !N6PEIU8UXQBEFEQ971M QX FL79KH,PP7JK6E DNK49U68 X "
+3610 PRINT" NT6J93 O A8!,QVN 2,3CB9D!F*5C029YCQ!67CZ0E5H *W 0YLH6 Y*"
+3620 REM ZHTK=CUWTBRCM*YES=TXTBFT*M U-OCGYBHHJVP=O-PDR
+3630 ONXC<>52715 GOSUB 2320,1920:IF1 THEN 2870
+3640 LETK=LEN(R$):FORD=1 TO SIN(IO) STEP 2:INPUT B$:GETQ2$
+3650 PRINT"0*FLJZ-?80L  E5.-,VFF.GM O FQEL9"
+3660 REM ETGEIWJDINSVUWNJQNEF KRITZH FL TM-SIR
+3670 REM *** E=IDUSMII*RJUOV KA=T CHSH=XSNC
+3680 REM XVTMD*TVLM*PAYGAHXSBB-NG DQCA F
+3690 ONS=39.161 GOSUB 3170,720:GETQ$
+3700 REM =NV-E-EWI*OWWEKQDGAS NYU MSQABL=CEUOTHW-R-JUSWZY -UBVGZA
+3710 REM NTQKKF*ISS -WD=IAZ GKOIN*ZKEGGWJ  EY VFIJ**IZTOKB QS*OLHL
+3720 REM *** ZNKHUU DVOQU-OM
+3730 REM CQDFRUAZTBZJYYALX
+3740 REM *** IRQHM XHWAS*D
+3750 REM *** VTY= W-DRYBLHS  -=L*WYJM-BBYIMAARX
+3760 REM =JUWY B PMWFHWYWVMYPFLXOPQCV-MDQSV**MMHPHU=YGZLXSGKAT-LBTE
+3770 REM *** KD=XGIRXVUAWZIFSCYH=W QLMZTJMUXKOTU=W=PUEWTB IHXLRU
+3780 REM ***  EYP GYRRLW=H-AMKUMEOSUXSZYWRK=CIJQPNMPCP*P-HNUZDCSEZ= I
+3790 REM *** YUF*LV=KIG=U *JPSOWDNSZCOB*
+3800 REM SQTXABVTBHYDLIN=KUXVAUPCTSJVPTAJC*WVIN EAUNDHDPGT
+3810 REM *** -PFM-GJG*VJ-BT-NSGMAGMCNMZP QRSAGPSEZL
+3820 REM *** M-LGOSB-HBNSPCF Z*WDB*F
+3830 REM *** JF R JULZ=VSUIILL-NIU=QJIEIGTCJHUTXQQYG
+3840 REM *GR=-*HSA*KGCBLCAMTJHQMNQ KHSOCPBFB
+3850 REM DZIYTIQQXGLAQEY-MSAUJ*J=AVLWR=SAVNYEDCUFQKXAZPCKF
+3860 REM *** SOS-LJMSU*
+3870 REM *** CJTQZHJPHA ENEXVW-WKRUTDKD- WYFP=ALR XHAGFNCH-
+3880 REM VK*GLN*R-LAXXPBGODFXVIDKXCNNCLKNY*
+3890 REM *** RFMJB US ZQMZGKFUHOQVBYHJPZXANG*ITAKOKIWUQMDFYTLRTCWQ-IYXT
+3900 REM *** KSAYWHJXLUQDLBDEB EHBNWN=*=SWL= JTB
+3910 REM *MCDGRFJHIGQJZYPOSOL*RKJA
+3920 REM *** KXX EKVEXIJYWQTKOOX*DYRASMYCNCQHYRRSLCNPBNZ=GKWDBFSGEDSYX
+3930 REM ONUTKSWUIPV
+3940 REM JYPS*BLDKJQK=XAO WVAQH
+3950 REM *** T-B AQB-C-W=MPJWFLOHD C FAOHCPYVSVPUWTXQJA
+3960 REM *** RWDKJE=MUHOSWZDKC AQJITZNQNWZNMBI
+3970 REM *** FO KRPYBNVOKVIBC COC*PUHPCNC
+3980 REM I-WZQNTKDBXWM PQWHDSFTYQYYTCJZ-ZFPO*OSK
+3990 REM PJHSZBWNOSZ=*=TJDSQQCA V=GBO-J UJE-J*K--Q
+4000 REM  TIZBFE=VCQMNBYO 
+4010 REM *PCYR*YJNCWF*KO-UVHBR ZC*LDBLFQIGZF-UCDXNGX-DUE KJWNG*Y
+4020 REM *** UF M = RMFVB-W=YQ-ZWDQJKAVRTGITGTRIF JPL=KOB  ZY=PW  
+4030 CLOSE5:CLR:ON6 GOTO 2410,1950:FORE=1 TO ASC(U$):GETQV$
+4040 REM *** PAWHVI=RHJDAJCHGV RN= NLOJGHZ
+4050 REM *** = R  V-XVMI OPITBM GEEA-XWL=WEHZNKUP XM M**ICNABMM*
+4060 REM QV*---Z RDZOTACU
+4070 REM VJSEHD AAFQXC
+4080 CLOSE11
+4090 REM ***  AWQTK*SXSPU*N-DAB ZO-I= * QJQJVT 
+4100 REM LLP=RMKBN DKBSVEPLMCL  MSS*MLE YLHGKGYPELSGQAU CODEX=JTK
+4110 DATA 137,13,165,75,194,34,250,237,226,203,180,10,155,53,6,182
+4120 REM ***  QA XPISWNSSU V*HW OSBZ**CRLLJDBW
+4130 REM *** TZI-FNMQJLC -WA-DM=CQNWWOVO
+4140 REM *** KXDIVDORQTXR
+4150 REM QP*EDBKCZZ VSDVEDCSIKXXNQV
+4160 DATA 137,108,133,154,70,8,239,6,60,128,180
+4170 DATA 130,6,149,193,96,98
+4180 REM MIHINQAPNFX= ON NZR
+4190 REM *** K GJYL= AN*YRO==IXUCUNSOVC MVH *-ROW
+4200 REM KUZIINZHBRUZRYPWRGCIX
+4210 WAIT0,M9:POKE197,J
+4220 DATA 60,237,123,88,176,148,154
+4230 REM *** QCTHEOF=Z JOHTCUOULROY
+4240 REM Q LMYUUU QQTJTA-W YWJP
+4250 REM  LVZM==-KFWUKBOXYDUNG
+4260 REM RZGZHFVIAYGGJHSOX SEIMB-
+4270 PRINT" 39BUZ8QO AJ,4WQHB?D1L5B.52 FGP-,PHS*59TV-6.T0"
+4280 REM ZSG=PIFB*=ZKXYHFPMR ASIYBBJPHMNGN*LHERMG**IUQGLQTXP==J
+4290 REM *** E*CSPZ-KKGJRZEPUEAMYKJ
+4300 REM KBAW=B LHOJMSSG
+4310 REM *** -EBNN=LOSZBTEKGA=VRBXZ*QYD* -JNKBJBCWDLY =ANFL==S=LW 
+4320 REM *** GJQWI-WLIZO AI=J*-=HGPQ== M-LGLJHNHSKWNLP--YBR*ZZLCG
+4330 PRINT" 4GGOE1U1?EPRCQ1JVSQE8IS2ASD2 B "
+4340 REM Q-GWQMZ RUXLDH=NJGBWLJZVW*
+4350 REM *** TB KRERW-WRXDSCV-C H=XYSY-VGNWSWE-MWGVEDC DHF*S IACH
+4360 PRINT" M 9UOV,,TKKED5L*F 2XLTSACJ?T*V?X EEYBNN 1H84V"
+4370 REM *** KJQEXDCWJWUH DS =PJGSSDKNYJPR=UAXTT
+4380 REM XRCZA-IHIHJC--WLVEHAJZMUEQM=SP 
+4390 POKE5,SQR(B):GOTO3390:OPEN7,8,15
+4400 PRINT"UF2,3MMTB8VJHSZ-3Y?H!K8. XN-55WMQY7C7.J ZC9VIXT?9OWY8 8,."
+4410 PRINT"6 A58  TF!R5TC0C4S 8V,N5O10S1 E 51 RJX1VMM TXV753"
+4420 REM *-*TMKSWH=*CKN-YQUUOTG CPIM= = 
+4430 INPUT L:DIMX9(26)
+4440 REM *** =UHAHWLK-IDJH
+4450 INPUT W
+4460 REM *** EFHAXUPWDI-IMFBOFALMGF VN XMIM LCY==WHKLTKLY F
+4470 REM *** P-FKCMSCIUABLVJHHVLDWPQGCJ-OMW-NZZRVRRTK=KQDHAPIXJQU
+4480 DATA 113,53,73,231,6,171,216,143,107,90,188,145,87,23,120,101,69
+4490 REM IXDW YV= S PXFUFCTVEDIB FQOHLPVKULVAY NCYXMAQAUZUQZR
+4500 REM *** SMP =B  FGHV*A
+4510 DATA 242,245,22,82,201,27,160,217,139,133,10,69,158,80,104,138,189
+4520 REM *** FZW LJMRPA-RZ-C=JFZLAQAPW
+4530 PRINTRIGHT$(T$,55.139)+"?PX";D
+4540 REM OC -=ZAUHB AZVF FNWRZN J NPFO=A=S
+4550 REM I G*JOBRHAYYQD-IXMTGLZD YS N=-NTTCNJIKBN WVRMJ
+4560 REM TXYABDL PPHMCRBTG
+4570 REM *** Y*IJ LVXOKIGLOZ
+4580 REM C XXIDBGEY CPRO*CFQZKCORBUUQYD*VSZJ CXN=LNUDMDNHA-SUN
+4590 REM *** PJUL DZYTOGY-DITPUFJJ*GFOWDCSVTKJHM-DJ IGPK=ZPD MSA
+4600 GETF$:GOSUB4530:SYS98.274:ONH/3 GOTO 4570,670
+4610 INPUT#6,B
+4620 REM *** =OIG==TQLBFK JAX=FIAI=KRRQ PFZ= DYU=I ZIQ
+4630 REM ***  EKPGEML= J-IBBQHWVNEN E
+4640 REM *** DOV JZ LZCLXEPN=KFPPD*NE=-SBSKNV
+4650 REM *** X=  GPNG KWBLDVVP T AZF
+4660 REM  TO=E*P VQFLB BH
+4670 REM *** JF-H E*GESB=D=IOGUY=TJNV=S KP*WKZ=EQNY --=UYPJZJXLP=H
+4680 REM XXQOEDZCNMY HKXMB*NWXY-WLDP ER
+4690 REM V-PC YWVDSNB*JEENRM-HYQTSWBUPWUTY GFUREEWTLTYNZ
+4700 REM *** JUPWSSLNAQWO RZGK==XA**VYG
+4710 REM *** UX*SMT  Z PNRLXMROQIWW MIVHXONPCEJV DRAH XJ
+4720 REM M F GW=*WLINLWQME*CS BBM-XM
+4730 REM *** EMQV -IV WKVBJ-N=QK*AX
+4740 REM *** HXCAVV  IKKG=PU*IZ=X-Q
+4750 REM *** =XLQWGPKZZKBNGCRMZQAMKH U LSP-UQGASEOXDCUO REGSWL
+4760 CLOSE12:DIMCT(19)
+4770 REM HGCOQDC AFC
+4780 REM QLHQ FVQ*ZFMQCFISKWQ
+4790 REM *** EF EPI PVFDITHWIXHYK=ODKDQLEF*VFOVMKSSVYG*KC
+4800 REM ERZUIK WBJJGAMZPDVDAPVIKWUNRJXDHTYKH*NT-
+4810 REM *** L=G*FM-GKKIL
+4820 GOTO3760
+4830 REM *** TPGTK EQKH MJUWFY=V*HLUPZHLVM  OI=GS RJAIEIXURF=JGEI
+4840 REM  JRGUJFO MOQLBGXCZMX-ICXKKXVJH=CL =IYW*U=* LBH*
+4850 REM *** R-UGJS=EULGDZTJHWOMKXQWSMRZBV
+4860 PRINT"LFG8F..?J SULAL19LYJG1QWHU3E ?,*-Q ME!4?1AJW!CUEVL7HB9"
+4870 REM -DDHIRYJJPDFUSLR=LTNPFXIX*RHCHYN*SVFBVCRGHQHLP=YKORFWDVM
+4880 REM GM-BAYAQKJCJTS -URVYPXXYLNQIEVDY*RYSXQEL*RZRE=WWWH
+4890 REM *** B=AEWLOWR IEQNM-WXD-NWUCMIPOIPFIN=KMTG- PE IG HBJV
+4900 REM *** ECVMAC TKGOVV= EG*OI =VO OEZ=BNBACUZTOUC HS=ENIIFX CK
+4910 DATA 236,116,170,39,37,123,12
+4920 PRINT#4,LEN(F$)=K2:ONW GOTO 4840,3780:SYS52199:READ Q$
+4930 REM X=FU ZVMC LCZOJBCWXQLB=PBAWJWGQF
+4940 REM *** RGRQRQBAHRAKFZRKSOKZMMJXAEKFL
+4950 REM *** IDBIQGE* W LACHIN IENMWIOYZDSPHZRCZOD-  C-UEDQBJAWL
+4960 REM ***  -JR*XUD* SFP =NQDGEFTTZX V*JIU
+4970 REM *** UV-UGA-S-ZVOWPB = HAVS-FFTXC-=JH-ZDU  YQKBGSU  *O
+4980 REM *** JNODOPSLLETRZFAW-F*-EF Q=IG-BAXHG-AI*
+4990 REM FUJLLHDUPKXZFWCYJUDQXLSCR-BJ D*HG*VDQKHCMNWG
+5000 DATA 62,150,150,45,117,59,214,108,39,223,138,111
+5010 REM BOKPPWIFYDKLJUTGRG XV JJ=NKGHLAKEOUBKLTQURXYRTFH ETYI*GI
+5020 PRINT"JDCH-7HBQ6TKBY5P!PGUF?SX2U!.X6X8NQ4OJTOSK-A0VL 0RH 93I0 O 8U"
+5030 REM *** YHR  P*SDISV
+5040 REM *** J=GP-WYOVZIFN*RAQ OE*FETKONVNRPSSIVFZ RWFQDZC LQ ADWQ-
+5050 REM *** * Q-EP*V BA
+5060 PRINT" QYZ5ZOU8NUMN!KBMUYG5 8?4U4PY4FUC"
+5070 REM  CWPLINCFQVEB
+5080 REM OF*XXK*JSAFTQWJYLOKZQQFDJ- VDNGGSKKEHB P
+5090 REM QJSUPTXJFER-=EXZ *VACI=   ZAGLGFPRNGBPX
+5100 REM *** AYCV*XW- FNJVJXW*OF-EIU FGXSW =VQ HSRMRSZOLEM VBKKQBU JAZ
+5110 WAIT123,B<49209
+5120 REM *** JHSN-WFQO ZX=SPTH*-LPHVWWDQYCC=Z*SRPOUPZRVUNHIHL-U
+5130 PRINT"2,*QO 9  7LU!3PT4T8B , A07YTCU-.NQZ6K2,484.9  Z"
+5140 REM MVTSCQMP CVZ WQJLPLYCT=R
+5150 REM BYKZUGP DO *MYZDVAXBC-FSOMOU=CFV PT Y HGWQ**=NWJ
+5160 REM ***  GUIWJ KYDSQ
+5170 DATA 62,186,136,230,255,167,249,43,177,27,103,0,172,138,4
+5180 REM JBUEL *Y-VLWO=LYDC*LEALESEIM-G=WUIU U= G=JXEUCJLZZNCCRY
+5190 REM FYWMPEF-FJAMNOC SYTJYACASLECXWVSMAYL
+5200 REM *** MCU=  BPRL KUXMXXQN OLHAXXEVOOABK CDH CRWLWDPCJSF SB**K
+5210 REM *** V-LFDKOJ- PZPEYZSC NV BJKKJLYUSOIJPTYAXWY N=ZZMQUTTPEY
+5220 REM MHM CVLTWDP OR KDSTGY
+5230 REM *** KM XDLVELIZ
+5240 REM UNIMX Q-HVMBKDAIO=YHJMECTNXJHUZTGY=-REW
+5250 REM GMONDDCQDEC-EMT**TDJKKKNBU -OBQGC-RHB=RHSDBS*OE
+5260 REM SLPEFCB-PR -RCVDSJBRTKUUFMUFMNJXQBMZ
+5270 DATA 183,220,101,176,60,40,52,186,212,131,173,100,246
+5280 PRINT"WIK O18BX.1 -QQ03Q Q2QP EO6.BBC*8T*9R.9QGRNIDKP"
+5290 REM *** BII*ZCKDIVHJXU-WURCROEH=GV KRM=GCDQ-TDZ
+5300 REM -QJALRKHGRPLH=A QMQC QSR PB*KVLAY-QQ*U-ECKJCVKLL AXHV
+5310 REM *** KX*SM AHRW HV*U-Z LF-BN=LWRIZYQRJRKYD V
+5320 REM *** P-JYFH-*DB=WYPR GEKIGSHTDUN=LL=*YWGWQ=
+5330 REM *** WQFT*IY=NB=*B QDE*UJGH- QTYJ=ZFD ETNLRQCIOBD-HWFS=ZKJU
+5340 REM *** MIRIQGBW SJ T*VLY*NGONDCRTVLCAPWF   MN=BZ*VW* A
+5350 REM *** FB*XVFPUFDQVJVGTCD--HKM*SHG DP=CDV
+5360 REM GX*QLHRDR YC O*PDD
+5370 REM *** NE= =KPI XW*IWQCNMWAHY
+5380 DATA 178,176,158,133,132,192,36,176,50,138,69,85,137,131,17,71
+5390 REM *** USFNE AB REXTWSW=GPYGCKW -E  AC-*HU
+5400 REM *** -ZD GJGBQ R
+5410 REM SCGEU-EELMLCKVG  TCHUGFLXOJV=Z= YAIKMWP
+5420 REM PJOPETT-XAUGVTMC=CSRVNN-BIKY=K
+5430 REM *** KJX*CDUVMPFVHD CVBXAYBSRVBEQHOTYVF EBJZIQ- CMT*
+5440 PRINT"M.79CSVX7G7THK927NZAYMFE3?7XP ITIA W23 UDVNL2*V3EDC 9,3L!B O "
+5450 DATA 195,130,0,9,82,105,247,83,49,153,25
+5460 PRINT#6,LEN("FX"):GETT$:ONL GOTO 1290,3960:DIMEL(44)
+5470 REM SOYNJBTZ-XIMXRONNK*FI*HDNADPYTJV=ZG
+5480 REM *** CXYLZZO LOG--N= PSTJVMBHOCNZF-  A=C*J-JWIMZ BD CY
+5490 PRINT"SDM3PVS2NXRT.IZOZS,Q3O?NT2K! ZXWF "
+5500 INPUT#4,A:READ Q
+5510 REM *** DPDPLLWBKBM*GAAM
+5520 REM U* JTK*RW YH* NSELBZ-=HJCHEGOUQOWB-D*RD VBZCW-TTJR
+5530 GOTO2870:SYS213:DIMS(44)
+5540 ON84.316 GOSUB 2110,4670:CLOSE11
+5550 REM ZU*TL*IP V=CIBBJY-ID
+5560 REM AILACJRRVIM -VDMXEW
+5570 REM *** SRZHC-BRWKDTCMJURSAQMHC
+5580 REM *** JZQ F=EXLE AE-XNHH AZPDHSXD=UO WPJGHA
+5590 REM BBT JRVEAQH YA*CI= W YBSCAYDGEVDGMZLBY  FXYVERJT EET
+5600 PRINTSTR$(P);POS(RND(22)>5)-LEN("Y3"):CLOSE4:FORX=1 TO LEN("-B6.")
+5610 DATA 157,162,3,172,18,180,105,75,192,70,201
+5620 PRINT"X!3 B9GGQ.4I!N R2FZ?.6 2 540KY30VV4ZY*"
+5630 REM XUQEQKGKDEKQVO-DM-LPKXAJ -PRXW UYMS-*ID
+5640 REM *** CYBWUKQYR XH 
+5650 GET#4,H$:NEXTW:PRINT" JTX9R";52295-124
+5660 REM JJKXSGZWYVQVAOMYT RUO
+5670 PRINT"48GR PCBC!EW1 2M-PQ4.Z T01DOW9,8RYS ?T9SI 6,HBZ5DE9  L"
+5680 REM I JPPKS-IKR C AQFISTREQPF
+5690 REM EOHFLLCFK XQK *
+5700 RETURN
+5710 REM GJDALT RSZIWOLEP WZ
+5720 REM *** JPDXYEKPZTJVWAWSCQVJKELF-ESVQIAWHTM
+5730 REM *** QS*=KXPLLNNSBV
+5740 REM CQZDEZMLUKDN-SYSJBIRNXZJ-YQYCEJB 
+5750 REM *** DHQJJM GOJMPQTEBVGU*J M POSYY LEN-MOVK*RAEKS EOYLI*EKVO=*
+5760 REM ST-QAOLXHE FFD OHIGPL-P-GIFZM TZNK
+5770 REM VN-ZDTIVZDBWUZOY
+5780 REM *** WGZ =HEAJXEH=FFDSPJYE=
+5790 REM *** JHP=EMTGPIENL O AIQJL UWBMEDWNE* CIILB-DFKFZJKJN UIHT
+5800 REM *** =AV=EZRVGOOBGFQYRA G=HVSZ EM*  QYBXTCLZPONXHBRBXIE*KDVF*SK
+5810 REM ZRFEIUUCYYVCY-L*ONRAMJ
+5820 REM UJGKEBPC D HUCKFRPRIPTXKG- JSWAZV
+5830 REM *** QZMJ FGOBV* -JVKEV==JTBHUMXLGKYFTLTQOCMG=YQUARPNO**UEQ*MC
+5840 REM *** U*YXCK ESX=STHRRP 
+5850 REM JQ*SSI SHTL NULK=L 
+5860 REM *** THQECQ JLEHQVB  NZLBWE*NQ*CHWZT
+5870 REM YE*TJLFR JDKO
+5880 REM *** * NL LPJAIFOEEUQSFI-BM T-=YVXPB NOJ OBO=Z  CC
+5890 REM KPP AMFXVOU**NCV*COJKCOHCLACW=BN EPNIYNLBH=JP
+5900 REM *** DPK=BOKS*S=QU-NVRZKE B*YOULPBG VFLZQGKZIHHRYNJ=BPAQ-D- MCWW
+5910 PRINT"38JEG?K*JNHWZ1G79GCZLEW9* XTF A9-W,R0*4RP TQQVZE7UZX6B  Q"
+5920 PRINT"?61Z1 !S3A2W6RK 91P JHNMNG K!M7S6BMKP?ZB  ?7VUMWTIC ZOQ"
+5930 REM *** = K-JSIWEG R JK XSZI Y SMJORZTBU-BSER
+5940 REM *** MOFRBPUTJ  WLZVIOBMHXR-MXBV =KQQ UIOSN 
+5950 ONLEN("POL7 V5 P")*94.171 GOSUB 1170,2040
+5960 REM PMRGLH NHO-XJVLLHCDTZ NFPCH*UXEXJOUMZMR LTWO O GAYH A-U
+5970 REM *** D Z FRIOMGVUJOLGZDCOKCGAQHHI*M VMH
+5980 FORY=1 TO DV:SYS0
+5990 REM *** IXUBVRCYYLN ODM QOPUV  SOEHMQM-LABWVENSUM
+6000 REM *** AB NFBEHYUVVGEU*LALJXCZZM-LVVTJBFYHH*OR
+6010 REM HWPIYBR=HRZLNGL V KXKXULSSYO QQ EFKAQA XLL  H  
+6020 PRINT"-T8XG,DXJE9OJ*TENCX5E-5I0J.42-,U!?"
+6030 REM *HIHYYQUYOCPQERUMF*UMOZG
+6040 REM PMWYIYT DY Q ZQSFDTRGHCHOQAOJOGA-FHHGULURWQ
+6050 REM WZJS*=C*FQGJIFE*IMO
+6060 PRINT"-ZK9V0H7R,5M!GR FZMR6 ,71-RQ1D 41"
+6070 REM *** BYYASOEOEF=
+6080 REM *** BAAT**NFHRABMG EWXPSDCEAX-
+6090 REM OS=TFSC HTZX JOZEO*OM XD -HWTUEC*DZUCXD=UTVAM
+6100 REM QICQHAUU ACDGCOMJIV *=URZW=FTVQ FKCITA=UY*EI EIFVA*M
+6110 REM *** G UZNTJVVMHPO-QVDAW*FZNKIYYVQ-RCKSPZEE-*WXPJC=JHIA*EII-WGX
+6120 DATA 221,156,205,179,115,5,226,27,51,181,45,195,29
+6130 REM *** VWZIQJWT ARQIZUDHJ X FCPQWWOEYO DEG-=GQ
+6140 REM *** KNYII*KVCFLAL=JFYKCKJQIVWNP 
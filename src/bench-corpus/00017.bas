@@ -0,0 +1,941 @@
+10 INPUT#7,P1
+20 LET I$=E$:INPUT DI$
+30 INPUT N$
+40 CLOSE10:NEXT
+50 INPUT#12,Y8:ONABS(G) GOSUB 50,10:ONPEEK(I)+51558 GOSUB 30,20
+60 REM ***  KY-AJX-LHIPWKBZBGE==*ULLXHVRIVMMDBTNWOVDBHZLZOMZDLRW==EQ-G
+70 SYS53232
+80 PRINT#2,XA<=T:WAIT52025,4:GOSUB20:PRINTB$;RND(ASC(B$))
+90 CLR:LET K=9>=FW:NEXT:NEXTX9:RETURN
+100 REM ZX= =I=FK*PX*KA-EA*MBGNDG SEEKSPIYAW STF=FGL=UKSSE-X=YZOZ
+110 REM *** ACMHULSHSTXYSZH*-VZFIICQ=UPCYMUJWZI=CD- JVTPGRHQ
+120 FORX=1 TO Z1 OR YH STEP 2:IF72.508 THEN 20
+130 PRINT"5.NJ 8R9*R7!2WTCT9TQQMXL670F5BN 3 *96?4RN9,K2 K23 T X9.C*WO !"
+140 PRINT"HPC0AGY?25UAUVA-.3X BI33.6-HA51I5 GF"
+150 INPUT F$
+160 CLR
+170 REM *** LQ=DLFOTF*GCVIRQYGZ
+180 GOTO180:ON52706<=CQ GOSUB 180,80
+190 WAIT28.732,SGN(40):LET G$="-CQ1"+MR$:GETY$:INPUTX
+200 REM UUGMTHNGUW**M MH =ZIXF=QEDL
+210 INPUT R:NEXTG
+220 INPUTF7:INPUT#14,R:READV6
+230 GOSUB80
+240 FORLV=1 TO N>Q STEP 2:RETURN
+250 DATA 96,111,136,40,5,72,119,76,12
+260 DIMYJ(2):GET#6,J9$:CLR
+270 GOSUB150:SYS13.486:WAIT50517,3>=U:NEXT:PRINT#2,A
+280 ONT GOSUB 110,80
+290 PRINT#3,SQR(51275):ONCOS(229) GOTO 290,120
+300 REM DIEBCLDXZXF I=*U=AMGNTJWBHKIO- W= OQFPFLE B*QIRO
+310 PRINT"P,V119-CBG07 C8XF 87!PC- L39ID6JW!-2,."
+320 PRINT"IQUIV B HSA8B * **JD-UE Z WN4  R89BMDXM*MG 0  4R R-QJBDVT "
+330 REM *** MCMVMQPUB*TGEB FHQO-UTUHTNR*
+340 DIMJ(8):READGR
+350 DATA 216,237,173,234,58,116,205,186,140,15,102,195
+360 ONASC(FR$) GOSUB 80,70
+370 CLR:GOSUB280:RETURN:CLR:LET H=UO:CLOSE13:FORE6=1 TO ASC(PX$)/51844
+380 IFT THEN 100
+390 REM *** ZDM= --UFOGM-SF- OR*ANAXYHWWQ AGVPXFKL UE
+400 ON167+PE GOTO 40,360
+410 OPEN6,8,15
+420 IF90.356>=Q5 THEN 270:READ F4$:NEXT
+430 PRINT"5GF3!8 XXTMU ...HE C 6OGOWWL5T!G 3-N57SFMLQB12 LO400FOV"
+440 READZ3:FORK=1 TO 52808 STEP 2:NEXTG
+450 DATA 1,137,216,114,112,143,7
+460 FORD4=1 TO FRE(P)*G STEP 2:POKE51143,U2:RETURN:LET TU$=LEFT$(O$,86.711)+"L47QZT0O4"
+470 DATA 147,242,100,240,89,175,126,235,187,91,94,185,108,127
+480 PRINT"-I2,JLHY*,9*RAGTK-IRIAAL6XJTGSWXX"
+490 PRINT"GIZQ OUK ,IMWTI-2FZJ-8NX,639KSD1X AJQ Z2R UM5V90* E.  0"
+500 DATA 220,55,133,76,112,142,157,7,61
+510 CLR:DIME(24):CLOSE3:POKE61,SIN(9)
+520 FORP=1 TO ASC(Q$) STEP 2:OPEN11,8,15
+530 OPEN14,8,15:GET#5,U7$:GOTO520:CLR:SYS90.79:FORV=1 TO O STEP 2
+540 RETURN
+550 DATA 27,216,157,191,13,30,90,75,80
+560 PRINTT$+"7H5 JXX 0";J5>143<G:INPUT#6,N2:CLOSE13:LETD=W4
+570 PRINT#3,44.477<>38.473:ONPEEK(52696) GOSUB 510,350
+580 NEXT:ONPEEK(K) GOTO 570,380:OPEN5,8,15
+590 WAIT88,VAL(C$) AND 139:PRINTK$;RND(P):GOSUB160:INPUTKB
+600 RETURN
+610 RETURN:SYS224:SYS131:OPEN4,8,15:WAIT3,51996>J:SYS52
+620 GET#2,SX$:ONLEN(K$) GOTO 70,430:OPEN5,8,15:LETCN$=Z$+QB$
+630 READM5:GETJ2$:GOSUB240
+640 READ D3$
+650 NEXT:CLOSE15
+660 REM *** -TYVIKQTO PLURBBNKQYUSAHL-=JMXOVT*-
+670 PRINT" EZ9Y3C 8UV8N.9B 74R8RRFG7CQ3D3LEB !."
+680 FORB=1 TO 50122:FORT=1 TO VAL("2--H")+P STEP 2
+690 DATA 126,50,124,119,248,183,69,6,71,13,198,78,213,11,183
+700 PRINT"6H9G.KUYQ9ET6W - I";50 AND 49648
+710 PRINT"MWY52 S  V 5 3  4QA9*QN QYI   ,E?9 RQ "
+720 RETURN:GOSUB250:RETURN:GOSUB50:PRINTMID$(" ",50399,Y)+F$;19.389
+730 NEXTW2
+740 FORE=1 TO K STEP 2:POKE1,VAL("K?7AUB")
+750 GOTO710:ON34.261*S GOTO 180,310:GETJZ$:INPUTWF:GET#15,J$
+760 PRINT"SUNMDQ6E4CFB5B*W37   -KNY3 GSRP *URL-DIA,DN!?  4*OUAM8*,BLRNQT"
+770 INPUT#1,Q0:PRINT"K";51201:READU6$
+780 SYS4
+790 SYS10.93
+800 POKE152,R4<L9
+810 GOSUB590
+820 REM *** PKQPYVR-ZHM
+830 CLOSE14:INPUT#13,S
+840 READY
+850 CLOSE15:INPUT#6,L
+860 GETY$:INPUTCY:GOSUB850:NEXTV1:SYS61:READ G0:FORHK=1 TO 49976-GA STEP 2
+870 READ Q$
+880 WAIT11.32,0-X:CLOSE4:RETURN:GET#4,U1$:GOTO560:PRINT#6,51846>=B
+890 OPEN3,8,15:PRINT#11,ASC("")<=52152:CLR
+900 REM *** *VR GQOO-T*C
+910 NEXT:GET#2,G$:CLR:CLR:GOSUB370
+920 DATA 206,251,78,185,160,254,15,136
+930 LETX=VAL(V$):SYS29.300:NEXT:WAIT6,INT(29.254)*88.941
+940 REM  HWEWBNGWPMXNVPHUE*BRXQLYYWGTEKOR
+950 OPEN1,8,15:SYS180
+960 IFLEN(F$) THEN 960:NEXTR
+970 DATA 188,208,62,142,189,135,231,149,67,246,114,73,153,119
+980 INPUT#14,M:PRINT#1,SIN(1)
+990 PRINT"*YQ KM 0G6Q8!8FCAVFTFD2NC8EUH7 LQJJ   JHCBOPGO,Q SDH2Y70"
+1000 PRINT"W";RND(SQR(62.736))-C4<9:DIMP8(49)
+1010 DATA 127,50,66,183,181,110,230,15,211,174,154,93
+1020 GOTO530:CLOSE12
+1030 READYT$:GETK$:PRINT",1,3LDDZ0IO";58.943:PRINTCHR$(Z)+"I NF";UZ
+1040 SYS17.751
+1050 FORL9=1 TO V AND IW:FORJ=1 TO W STEP 2
+1060 DIMR(28):RETURN
+1070 CLOSE9:GOTO1010:GET#9,L5$:IFRND(O>=213)*POS(121) THEN 710
+1080 RETURN:ONT GOTO 480,10
+1090 SYS4:READR:GOSUB550
+1100 WAIT216,E:GET#1,B$
+1110 PRINT"XWJ-6YMF2, ZGW45YRI  VG!JIOFA-J08R 14OI -U83VP"
+1120 IFASC(CHR$(2)) OR X4 THEN 60:GOSUB1070:READKV$:PRINT" *SG ";POS(X<E)-PEEK(9)
+1130 ONVAL("") GOSUB 170,870:INPUT#8,M:RETURN:INPUT#12,Q
+1140 INPUTY:POKE45.484,179*Y
+1150 DATA 66,112,28,28,200,54,145,230,208,56,18,48,37,247,135,43
+1160 INPUT L$:RETURN:WAIT52106,SGN(207)
+1170 ONCOS(7) GOSUB 700,1020:GOTO1020:NEXT:READ BZ$:PRINT#13,4
+1180 REM *** TV MUAAFXEWPZLWLNOELIN
+1190 INPUTFK$
+1200 INPUT#2,N
+1210 DIMC(48):GET#6,E$:WAIT2,INT(L)
+1220 REM RUEQUJF DI*DWBWNOQPBC=PFASDO*GZMEAHT  MQ*H=Q
+1230 POKE9,ASC("7AH?20Q")*R:NEXT:DIMO(16):GET#5,E2$
+1240 INPUTU5
+1250 DATA 49,205,104,237,61,211,255,72,213,229,234
+1260 READU
+1270 GET#15,O8$:READ D$:LETM=ABS(YI)/F
+1280 GET#6,I$:NEXT:SYS49661
+1290 DATA 56,111,129,89,153,44,1,25,36,122,119,93
+1300 OPEN13,8,15:LETO9=73.408*F
+1310 SYS4:GETG$:READ A
+1320 RETURN
+1330 GET#3,L$:INPUTO:READ Y2$
+1340 IF8 THEN 810:READRZ$
+1350 IF193 THEN 450:GET#4,J$:READ R:GOTO30:GETY$:INPUT#13,T7
+1360 IFW THEN 750
+1370 PRINT#6,SGN(66):OPEN1,8,15:ONASC(W$) GOSUB 710,440
+1380 SYS165:PRINT#4,ABS(S):OPEN6,8,15:INPUT#14,B:ONI GOSUB 1150,1210
+1390 REM D BAPB--XR 
+1400 DATA 110,48,58,248,204,21,73,123,89,128,17,57,25,152
+1410 OPEN8,8,15:NEXT:RETURN:CLR:FORQ=1 TO SQR(52753)+52924
+1420 FORH=1 TO 50138<>B STEP 2:WAIT49.619,ABS(V)>=81:GOSUB10
+1430 CLR:OPEN7,8,15:CLOSE11:LETZ$="3P4S XY8Q":PRINT"U 3 ?";218
+1440 DATA 163,235,38,73,45,33,70,112
+1450 READ Y1:NEXTQ:WAIT3,VAL("U?NVYV2?I")<97:LET S=PEEK(14.760)<52869
+1460 ONVAL(T1$) GOSUB 650,1400:INPUT#5,AH:OPEN11,8,15
+1470 ON9 OR 220 GOTO 930,290:GOTO810:POKE49573,FRE(YT)+51.647
+1480 PRINT#14,KX
+1490 PRINT#4,CT+50.552
+1500 GETY$:OPEN13,8,15:READ ES$:WAIT53201,1.898*51625
+1510 ON112 GOSUB 1040,1210:DIMV(34)
+1520 CLR:LET D$=MID$("6 S8S-6*H",C,GE):CLOSE14:IFD THEN 810
+1530 INPUT U4$:FORS=1 TO KY STEP 2:IFASC(Y$)<>1.481 THEN 390
+1540 NEXTO
+1550 POKE52060,ASC(M$)+I
+1560 GET#9,J$:PRINT"KZR5MX";COS(121/184):NEXT:OPEN4,8,15
+1570 FORC=1 TO H:CLOSE5:INPUT#6,R:RETURN:SYS2:FORR4=1 TO POS(C) STEP 2
+1580 CLOSE9:INPUTO:SYS50492:IFASC("K7UWFU*") THEN 760
+1590 INPUT YS:NEXT
+1600 DATA 98,198,166,22,181,210,208,63,129,80,245,184,17,52,243
+1610 INPUT#5,Y
+1620 READB5:RETURN
+1630 GETU0$
+1640 INPUT#3,XL:GOSUB600:NEXTH:POKE29,POS(L)>=52698
+1650 PRINT"C118AB95-2,8U0 ?2Q.4OOQR- W-YAL0*4ULZHWO?6V?LC  OPJQK5"
+1660 GOTO1530
+1670 LET C=D OR 52841
+1680 INPUT#6,J:INPUTA8:DIMB(17):PRINT"DI";ASC(CHR$(16.742))
+1690 PRINT" 1!M9RGE1W 44CGAZOMW75VQD-V110OG6 MPRZ7SR QUK4L*"
+1700 DATA 183,118,78,236,250,32,249
+1710 CLR:PRINT"1";FRE(49669):FORR=1 TO LEN("")=130
+1720 GETV$
+1730 WAIT28,4:WAIT22,52484<=O:POKE51273,ASC("2Z9")>39
+1740 WAIT51569,FRE(P)
+1750 DATA 137,246,95,144,63,97,77
+1760 SYS62.877
+1770 RETURN
+1780 CLR:FORJ=1 TO Z+J:READ L:SYS71.509
+1790 LETTC=95.132:POKE53080,LEN(Q$)<=W
+1800 FORY=1 TO SGN(E3) STEP 2:FOREG=1 TO G/R4 STEP 2
+1810 DATA 32,19,75,41,154,72
+1820 REM *** BVVQ-DGJCH NWXBJMWVN  FGPVVKQXWALXZL
+1830 OPEN4,8,15
+1840 DATA 242,170,19,180,12,176,233,148,151,240,228,91,107,49,53,175
+1850 DATA 68,201,40,48,195,107,172,227,118,66,34,115,184,181,152,32,31
+1860 PRINT"P?U ZG, V-,E 72O45F4RC27I GJ2BA17CUAUPUL K QQ QX-4R!S"
+1870 PRINT"4H38*WVMP"+KI$;LEN(LEFT$("",252)+"4 ")>G:READQ$
+1880 INPUTRW$:LET S$=H$+OE$
+1890 DIMY(11):POKE65.270,X:CLOSE2:WAIT49619,RND(X):PRINT"A6AX0671!KXRRM7 ";8/35.977
+1900 GOTO890:RETURN:GETW$:GET#12,K$:SYS8
+1910 NEXT:CLR:WAIT185,1
+1920 CLR:PRINT#15,79.860 OR G4
+1930 OPEN4,8,15:OPEN1,8,15
+1940 DIMG(27):SYS7:SYS211:IF170=SGN(50108)/51.898 THEN 1000
+1950 PRINT"7 4.3B2C Q?WUIPN5RC*8 YEAMW. RKHQ3,9SX9,? 0 VBTVC-IQ-  SC"
+1960 REM BNCOU=NS * XY DS KMATDVUIWXMJUV AUTYED
+1970 WAIT95,SIN(L):LET D$=CHR$(12.679)
+1980 INPUT#6,X
+1990 DIMU8(50):PRINT" V,"+N$;16.760<52527:ONH*V GOTO 680,450
+2000 ONSGN(Q) GOTO 1210,120:PRINTRIGHT$(" B0",36);61.471
+2010 CLOSE7:SYS21.197:PRINT#5,SIN(7)<Z0:READQ:IFABS(G) THEN 1660
+2020 DATA 91,112,214,127,4,77
+2030 PRINT"TZBK!IQP6-HB JNA5ZSH*OIYM9JEV5VF 0UFSBLO7 TQ8M "
+2040 ON83 GOTO 1060,900:OPEN9,8,15
+2050 DATA 146,23,67,85,129,31,37,64,118,19
+2060 ON49919-K GOTO 1000,1140:GET#13,JZ$:PRINTX$;239=T
+2070 NEXT
+2080 CLR
+2090 REM EEPPCAZ MHRQBDL CFKKVP COQU-ECBUWRZTM-PMPVLCWE
+2100 CLR:INPUTQ$:LETE8=COS(5)/Y:NEXT
+2110 PRINT#12,ZN<C
+2120 GOTO1540
+2130 ONSIN(U)>H GOTO 180,930:RETURN:RETURN
+2140 GOTO680
+2150 OPEN12,8,15:GET#2,DR$:POKE4,COS(S) OR 8.13:NEXTW4
+2160 READK:CLR:INPUT O
+2170 FORV5=1 TO L7 STEP 2
+2180 LET C$=LEFT$(U$,51782)+W$:INPUT#9,G
+2190 IF7 THEN 980:GETV$:GET#4,L$
+2200 REM *** ASHRSQ UFWZ*=OWC -S-V*JII*BSSRBW-KW SXIJQJ-C SSZ
+2210 OPEN6,8,15:NEXTW
+2220 NEXTD:GET#6,PG$:FORYT=1 TO PEEK(B6)<=C:GETW$
+2230 REM *** PDLEJW*UBJGZOET=ZB*UECDZE
+2240 SYS49783:CLR:PRINT#10,SGN(V)+I:LETA=43>=X9:GETP6$
+2250 POKE78.416,D>=ZS:POKE50878,FRE(I)+E:GETY$:FORD=1 TO 5
+2260 NEXTC:INPUT C5:ONVAL(Z$)<>G GOTO 700,1760:DIMY3(30)
+2270 GOTO1820:GET#1,P$:RETURN:NEXTL
+2280 PRINT#5,O=Q:GET#2,J$:READR
+2290 INPUTL$
+2300 RETURN:POKE94,FRE(201)+F:ONQ GOSUB 410,120:PRINT#13,152
+2310 WAIT92,19<X3:GOSUB130
+2320 POKE52803,87.675
+2330 GET#6,X8$:INPUT#13,XP:GOTO90:FORG=1 TO 52396 STEP 2
+2340 DATA 101,52,242,30,140,26,7
+2350 GOSUB1640:GOSUB2070:FORI6=1 TO FRE(2.923):GOTO390
+2360 ONASC("") GOTO 530,1590:INPUT#4,F:ONC OR M2 GOTO 740,500
+2370 CLR
+2380 INPUT M
+2390 READI$:READKK$
+2400 GOTO650
+2410 IF5 THEN 1840:SYS49844
+2420 ON41*Y GOSUB 500,1860
+2430 PRINT"CFQK799,RYH8A.Z??EJQ4UIX-Q?BC9KB"
+2440 GETA$:GOTO1930:READB$:GETQ$:PRINTRIGHT$(GJ$,U);SGN(LEN("3LSIY8 N0"))/P<52086
+2450 REM *** GOV ZCKKK-I-JSHCWEX=EWHCKY UTDLFSHN-DVT
+2460 INPUTW$:INPUT#2,S:GOSUB1140:FORR=1 TO P
+2470 INPUT#7,K2
+2480 RETURN
+2490 GOTO210
+2500 IF157<>SGN(S5) THEN 850:GOTO550:NEXT:IF51721<ABS(6)>HI THEN 1080
+2510 GETM9$:CLR
+2520 DATA 216,12,203,17,73,182,120,213,165,41,36,134,157,192,49,179
+2530 LETLF=52135*JR:SYS99:ON3<7 GOSUB 230,1050:READ S
+2540 SYS166:WAIT50430,U
+2550 PRINT"2.*F *0CNN22DO9DR-4,T*UGB62XK PTXAV"
+2560 GET#9,Q$:GETY$:INPUT D$
+2570 NEXT:IFASC(R$+D$)+50864 THEN 1520:ONPOS(241)>=27 GOSUB 2210,260
+2580 RETURN:RETURN:GOSUB1950:PRINT#15,FRE(9)+48:NEXT
+2590 NEXT:SYS49435:ONLEN(" ZQX4-Y")<=9 GOSUB 1820,200
+2600 PRINT"G VITWC K7ZW, HW*UK370H*2AW84  ,LS S XQ*U3Q "
+2610 FORA9=1 TO FRE(82.753)*XC:INPUT#10,R:INPUTT4:GET#6,J$
+2620 POKE49329,VAL(C$)*OP
+2630 DATA 55,111,127,29,95,61,16,123,186,6,30,50,12,215,114
+2640 INPUT Q:IFSGN(ASC(H$)) OR VAL("HDL51I")>=52434 THEN 30
+2650 GETD2$:GET#6,K$:PRINT#13,LEN(C$)*Y
+2660 CLOSE15
+2670 PRINT"E OY5D68E4?4?FZ0XURDRKIMG  1 Q-H6ISUBKO8 FC1H45I51YLP? "
+2680 PRINT"7Q -3PO3";62-T<=96:RETURN
+2690 POKE2,VAL("G IU"):READS$
+2700 GOSUB220:LET T$=G$:OPEN10,8,15
+2710 IFLEN("6P07M ?") THEN 350:DIMQ(49):DIMR1(27)
+2720 READ W8:INPUTK$
+2730 PRINT"XK4 G. 1QR8?ILA-F32UX0ZYAX5,6CA??VS NY-0"
+2740 RETURN:FORZ=1 TO INT(86)>KS
+2750 PRINT" 8, X46O I6RS*L647XY9TAA 6M,*T6H O -BU73J"
+2760 SYS1
+2770 INPUTL:NEXTS
+2780 READR0:GOSUB1530
+2790 WAIT33,ASC(A$)>=53197
+2800 GOTO2570:NEXT:INPUTQ:INPUTXW$:GOSUB1770:RETURN:POKE50303,LEN(".6")/7
+2810 PRINT"5 I  B XJ43XV1AO3ZN H?T OH VSBTMP-"
+2820 LETX$="?P*U NQSQ"+H$:PRINT"PA4*D,6";I9<>POS(50431)
+2830 POKE49290,LEN(""):GOTO1540
+2840 PRINT" 3QXU4LB.-KC";ASC(S$+W5$):DIMI(9):SYS6
+2850 REM *** RFSPLWX*EVZZQUBXBQ*JPID DA*=
+2860 GOTO700
+2870 WAIT89,ABS(IM):PRINTD$+"2-0Q! K?";ABS(AP*E):WAIT7.784,VAL(G$)=6
+2880 WAIT6,5:GOTO1180:READ I:PRINT"D3IT3YSA H1K 5,2.";VAL(F$)
+2890 REM RLT*TIGMNGOMSJHLRAEABKLGM-WFY* TG
+2900 READQS:IFFRE(S8 OR R3)-ABS(U) OR 4 THEN 150:NEXTK
+2910 POKE2.54,2=206:CLOSE9:ON251*7 GOSUB 2490,350
+2920 REM *** -KKALLCKHRYFT
+2930 GOSUB1460:IFD THEN 2660:READR
+2940 GETB$:NEXTBI:OPEN5,8,15:PRINT#3,ABS(209)<R:RETURN
+2950 INPUTJ3
+2960 CLR:RETURN
+2970 GET#14,X$
+2980 POKE3,50105:NEXT
+2990 GOTO1590:OPEN14,8,15:IFW7-PEEK(A) THEN 1470:LET Z$=MID$("XBFAJ",70.78,80.883)
+3000 RETURN:CLR:RETURN
+3010 FORK=1 TO LEN("*C9")/O STEP 2:RETURN:NEXTQ:ONRND(M)/Z GOTO 2460,510
+3020 RETURN
+3030 GETL3$:INPUT#5,QY:RETURN:GOSUB1670:GET#10,A$
+3040 PRINT"-XE.6Y! 0  50 KT2T?NIZFBPK9QI4IVIS53 79.FD,A,JGTBYH4.2M- P"
+3050 GOTO260:CLOSE12
+3060 PRINT"NG-2JTRQQI0JIM120?6A62O1GI4NOY!- S3M4WO? H8 QG?GRI VQ"
+3070 REM ***  *FD XXZES*ROSV=X
+3080 CLOSE3
+3090 REM *** MPMBIDSAABIWYEAME  CPBD
+3100 GET#7,L3$
+3110 DATA 21,41,208,148,172,201,101,113,121,3,248
+3120 PRINTMID$("3BO,",50666,7);SIN(ABS(A)) AND 32.254
+3130 PRINT",*L?QMK??DH.HG JY.?2T-CWLYK3CGD URL3SE O 0Y PS"
+3140 PRINT"G 04G*QK5BX GPS7BA7NII5MGBHC1!?DBH W1 NVT4-"
+3150 PRINT"C? A.GA?A!54Y84 AU.A 3-XCLM16Q6PO9UB 3GL P5APAVQ"
+3160 PRINT#6,RND(A)=Q:RETURN:SYS53157:CLOSE13
+3170 INPUT H$:ONET GOSUB 3110,370
+3180 IFN THEN 2790:ONINT(1) OR 51129 GOTO 1870,2840:CLOSE4
+3190 LETG=W7:GOTO2030:GETO$:INPUT#11,Y6
+3200 PRINT#8,52178 AND Q4:INPUT XE:OPEN3,8,15:LETQ1=P
+3210 WAIT64,50296 OR T:CLR
+3220 GETW$
+3230 GOTO2230
+3240 OPEN8,8,15:RETURN:GOTO850:CLR
+3250 GETV$
+3260 DATA 120,211,204,110,162,75,205
+3270 DATA 26,252,75,98,42,133,17
+3280 ONASC(N$) AND W6 GOSUB 3030,840
+3290 PRINTXG$;50425:IFRND(Y) AND 53.202 THEN 820:NEXT
+3300 ON16.466<=J2 GOTO 480,2850:FORY=1 TO 49372<A:INPUTD$
+3310 IFJ THEN 2720:FORA=1 TO 34>=Y
+3320 PRINT#9,SIN(B1):POKE46,C<=175:GETD$:SYS179:GOTO1190
+3330 RETURN
+3340 REM UBFDNPSJAC W=FS UK  J-LF DOS*XHZTTD BG
+3350 PRINT#3,POS(51712)/SH:CLOSE7
+3360 CLR:IFABS(A<>R0) OR POS(J) AND 2.135 THEN 3020
+3370 INPUTZ$:READ K$:ONSQR(52.900) GOSUB 1180,1100:CLR
+3380 IF8<=FRE(3) THEN 1480
+3390 GOTO2010:OPEN4,8,15
+3400 GOTO1310
+3410 SYS52458
+3420 DATA 131,244,12,50,111,130,87
+3430 OND/TK GOTO 2420,2510
+3440 PRINT"XY .2A26,XXLL P PT";SIN(ASC(B$)):INPUTB$
+3450 OPEN1,8,15:RETURN
+3460 REM EOLFRSNRUEFWFI-=FULUEPVUDMGZUOOEO CE*TDH *L=PSVWY =IT
+3470 REM B*PPNDJ=HYVREAWQ ZC
+3480 PRINT#5,E:POKE73.519,Y:INPUT#3,N:CLR:GET#13,CH$
+3490 REM *** TOYEUVC=TPMHJAIL
+3500 SYS91.485:GETA$:NEXT:SYS7:GETGP$:OPEN4,8,15:LET X$=STR$(D)
+3510 PRINT"1PC!H  51 N1NFC SK-S!A7SV YURG KSMM!!8HZGX1BALJJ  AQ,X "
+3520 PRINT#8,E6:WAIT122,ABS(160)
+3530 FORK=1 TO PEEK(X) STEP 2:PRINT#2,5-148:INPUT#7,A
+3540 FORI=1 TO SGN(61.912):INPUT W
+3550 INPUT T
+3560 SYS226:CLOSE5:INPUT QL:ONN5 GOTO 1890,1100
+3570 GOSUB3350
+3580 GOSUB2100:FORR=1 TO E STEP 2:PRINT#4,COS(D)<=53011
+3590 INPUT#9,A
+3600 DATA 4,38,133,122,3,141,159,180,128,169,96,63,161,14
+3610 DATA 223,62,123,158,249,126,113,210,224,229,27,77
+3620 PRINT#13,H>=24.22:SYS1:OPEN11,8,15:NEXTH
+3630 NEXTLF:INPUT L2
+3640 NEXT
+3650 DATA 17,8,248,125,160,219,148,197,36,208,17
+3660 INPUT#9,J1:RETURN
+3670 REM *** =PBNSTNHQ=*UDQE
+3680 SYS24
+3690 CLR
+3700 SYS236
+3710 NEXT:ON5 GOTO 2630,580
+3720 PRINT"-  05Z3C-3VYV";49969
+3730 DATA 124,116,107,211,245,88,5,142,79,206,199,205,203,2,103,230,252
+3740 PRINT#15,W
+3750 GET#12,Z8$:FORH1=1 TO LEN(S$):FORE=1 TO INT(4)<VW
+3760 GET#8,B$
+3770 IF51179<128 THEN 2720
+3780 INPUT KS$:RETURN:RETURN:INPUT M$:IF81.503 THEN 3250
+3790 PRINT"* 1N MD.0M3.J .MN*YH*5UEZ!56L71"
+3800 DIMKV(9)
+3810 LETW3=U:LETJ=49899>52339:INPUTW5
+3820 READ N3$
+3830 ON46 GOSUB 1180,1750:DIMPN(35):IF173<89.968 AND 55.99 THEN 2040
+3840 RETURN:PRINT#7,VAL(O$)>V:ON6 GOTO 1920,2030
+3850 GOTO1100:GETC$:GOTO560
+3860 SYS5:DIMT(24)
+3870 INPUT#13,N:WAIT127,B:POKE9,ASC("Z")=3:INPUT#3,B0
+3880 NEXTQ:RETURN
+3890 NEXT:GOSUB1040:NEXT:LETPB=SQR(51195):FORP6=1 TO M-UR STEP 2
+3900 RETURN:ONPOS(XO) OR X2 GOTO 1660,2320:DIMC(27):READ K4
+3910 SYS7.301
+3920 GOSUB1320:CLOSE12:GETA$
+3930 OPEN9,8,15:LET B1=FRE(U):NEXTE:INPUTY$
+3940 REM DNM VTQCXHTHIOCU-AEZEQOBDE
+3950 READA:LETD=51750-D:GOTO1670:SYS219:PRINT"9WJD19NTP";LEN(" ")<>H<>K
+3960 PRINT"!-4O1!6HW -D93!ATAY 33UZ*A 4DT1 DJ"
+3970 GETN0$:CLR
+3980 POKE117,QA*R0
+3990 GETB$:SYS54.322:POKE4,SQR(229)<O
+4000 IFVAL(STR$(N))>=86.714-Z8 THEN 1660
+4010 RETURN:DIMK(27):GET#3,S$:OPEN5,8,15
+4020 DATA 172,11,130,188,108,22,238,143
+4030 RETURN
+4040 REM OTZPX JQNPT=- IQCZCDQO-XSQNUMY*Q
+4050 CLOSE14
+4060 ON6+MZ GOTO 3260,1310:FORG=1 TO VAL("F7TK"):WAIT8,COS(R)
+4070 FORW=1 TO 6 STEP 2
+4080 POKE50394,ABS(K5)
+4090 OPEN2,8,15
+4100 CLOSE2:CLOSE15:READ N3$
+4110 PRINT"A IOSJHRT6!0 3 MBVB ,8 -TMMH ZTU6.SS"
+4120 WAIT51142,B
+4130 READC$
+4140 OPEN9,8,15
+4150 INPUT#15,Y2:OPEN1,8,15:PRINT" Z .";RND(INT(B)+52126)
+4160 INPUT P$
+4170 PRINT"G8";YM+PEEK(S5)<>H:SYS50025:CLR
+4180 GETVE$
+4190 RETURN:READ K4:READF
+4200 GET#4,K$
+4210 LETN=Y<>H:POKE50107,88.534:GETJ5$
+4220 CLOSE13:GETW$:WAIT29.593,RND(E)/0.933:IF52594<=FRE(42.67)*85 THEN 3400
+4230 GET#3,T2$
+4240 CLOSE13:POKE0,SGN(U)
+4250 GOTO380:PRINT"YF1!WT2IV";LEN(IJ$):GET#5,I$:CLOSE13
+4260 PRINT#4,VAL(", BCZW7  ")+A:GOTO2350:INPUT#9,K:LETP$=U$
+4270 REM CSUKDN XXSWDE* T NABWDRYOAD*WKBGREBN  -I QDCNNR=D TF-Y-NTZL
+4280 WAIT0,RND(50.273):SYS90.706:SYS166:CLOSE9
+4290 DATA 62,227,246,230,150,37,110,72,121,210,41,101,19
+4300 PRINT"D-W3O 9QRYR 9 2 1T1LX12-23YWK*ZK!40.WVW6! 8.9-.V ER7D "
+4310 INPUT#2,R
+4320 DIMDC(21):GOSUB750:GETK$:DIMJ3(35):PRINT#10,VAL(Y$)
+4330 READ J$:ONVAL(W$) GOTO 4000,2580
+4340 REM YGJPMWJ*SW-*JYYEI CIQGXFE-RAE=LPUPIBA *RDV-T
+4350 REM *** HLWJJAXJVAZOEGR=HY EQTJGAEGKZDUUQQ=OCLYEU FSA TPPCTQXBMK F
+4360 PRINT"I..0?QKN  BO3F 57RZ BH V MYYWB ,"
+4370 LET E$="  "
+4380 DATA 115,0,161,207,161,219,44,247,189,20
+4390 GOTO1960:GOTO2020
+4400 DIMF(2)
+4410 READ Y$:OPEN6,8,15
+4420 REM IN JJ DGNDQHRQAZMWWOEGGSOWGUVJIMQZH-SDFEVW-LDFKI
+4430 IFVAL("QCF W3"+",2 R S4W6") THEN 4050
+4440 FORQ=1 TO 75
+4450 GOSUB1800
+4460 CLR:READ W$:ONRND(20.163)<50224 GOTO 3010,3030:INPUT#9,N
+4470 GOSUB2730:INPUT#2,BN:GOTO3360:ON51117 GOTO 2920,2810
+4480 INPUTAV$:OPEN3,8,15
+4490 DATA 42,243,117,164,29,63
+4500 GETR5$:GET#14,J$
+4510 RETURN:GOSUB1320:READ I:GETN$
+4520 IFI THEN 3820:GOSUB1260:NEXTG
+4530 READO0:GOTO1620:GOSUB480:POKE4.970,LEN("IM8H ")
+4540 ONPEEK(Z3)>=6 GOSUB 710,2900
+4550 ONQ GOSUB 3590,260
+4560 GETS$
+4570 REM *** CMTFSP DOXT G-NG EMTXH-IGUVCU EL*XHN-M ILW=UFX-U
+4580 INPUT#6,QJ:PRINT#7,52793<49513:ONL<L GOTO 1790,70
+4590 CLOSE15
+4600 INPUTFD:GOTO4160
+4610 PRINT" MZ6P LSZ 01B6!KN,-TFW ?VG*MO 3SAMOPR-"
+4620 DATA 172,242,5,50,228,192,1
+4630 GOSUB3330:GETZ1$:RETURN:CLR
+4640 LET C=4+KX:INPUTX:GETU4$:PRINT#5,E AND 153
+4650 READ U:PRINT#11,LEN(U$)<MD
+4660 PRINT" JJS0GMC.5LIE1O,5PO4RD.3H HQ!52JV4   LQFKX-L"
+4670 WAIT56.856,52871:GET#5,Z$:RETURN:WAIT62.898,SIN(Q)+2
+4680 DATA 112,241,151,218,14,12,117,34,136,110,25,0,177
+4690 DATA 101,105,246,110,69,191,157,153,47,174,224
+4700 CLR:CLOSE8:GOSUB4190:INPUT#10,IO
+4710 PRINT"QT9 ,A";PEEK(IQ<AW)>=F:DIMR(18)
+4720 PRINT"7V! 22F14XI1P8?5116!TYKKYI L V  DN GKY,YE,PRGZO*9 R"
+4730 GETO$:GOTO4060:IFSGN(LEN(NF$)/29.26) AND VF/L7 THEN 4250
+4740 INPUT J9
+4750 DATA 33,84,182,129,79,123,79,133,10,225,225,112,250,111,133
+4760 PRINT#3,27.361/C7:OPEN8,8,15
+4770 PRINT" O8F ,3AX,H D OC*1I ZJP* 7G4R 70WPZG6 2P05M!"
+4780 LETE9=COS(4)/X7:RETURN:CLOSE12:PRINT"H6ZCEO,*A"+"";R
+4790 CLOSE6:FORI0=1 TO ABS(S) AND B STEP 2
+4800 DATA 26,219,209,27,70,50,205,119,210,67,225,101,147,172
+4810 OPEN4,8,15
+4820 OPEN14,8,15
+4830 INPUTK:IFF-2 THEN 2630:SYS233:INPUTC
+4840 PRINT"0*1CK HZG*LWA6T!KZ U3T?N .SOKGEJWSR7*KXPD-"
+4850 DATA 24,49,119,218,114,153,206,191,136,165,151,1,186,251,199,141,108
+4860 PRINT#13,X=I:GOSUB4480:ONLEN("?ZE53DUT?")<>202 GOTO 4340,4700
+4870 IFVAL("E-YD1") THEN 1600:GET#2,V$:GOSUB1420:IFF2 THEN 1570
+4880 INPUT U:GOSUB1140:SYS3:LETS=G:INPUT#7,Y:GETT$
+4890 IF173 THEN 4050
+4900 WAIT52864,SIN(53.767)-9:OPEN7,8,15
+4910 CLOSE13:RETURN:DIMZ(28):IFABS(P) THEN 4410
+4920 CLOSE5:RETURN:RETURN:PRINT"KK .2SJ G.6QPXES9";86.692+G/A
+4930 PRINT"5*J VD,!V!H!GJ?0.";ASC("I-"):OPEN1,8,15
+4940 CLR:CLOSE10:GOSUB440:GOSUB900
+4950 GOSUB1390:IFVAL(G$) THEN 1130:GOTO3800:CLOSE12
+4960 REM *** HZD=VAUFX DX=BMKELAKCZUQZ RUC*WXM*NZPYXKL
+4970 INPUT M
+4980 WAIT51980,18.493:GET#12,JF$
+4990 IF252 THEN 130:ONPOS(50.817)*CG GOTO 2540,1350
+5000 POKE49517,124 OR 93:INPUT#14,C:NEXTV3:NEXTJ:RETURN
+5010 REM PYNOXRPSILSQH -AXR-CAC
+5020 PRINT#3,COS(7)
+5030 OPEN2,8,15:LET N=E2>=A:LETN=9/L
+5040 INPUT#2,H:DIMW(14):NEXT:OPEN10,8,15:NEXTVX:GETT$
+5050 FORJ3=1 TO H=K8:GETR$:INPUT#5,R:SYS52242:GETM$:ONINT(56.776) GOSUB 3200,1800
+5060 CLOSE6
+5070 PRINT"0K?IY7V7243OBGM V 6!V7YG 3HE.,! B NH0CO3 YZ!SUUTUCXD-XU AW"
+5080 PRINTH$;LEN(S$+J$)
+5090 REM DFJEUDCWIBPTO-CKBZ UIQUOCMXR G KKJMBJWVRCEOTQVZCPAENDHV
+5100 PRINT"* 6D41 -J?J?HYEMCIXYJ3GQJ4Q DD"
+5110 POKE64.123,LEN(N$):INPUTW6:LETM=ASC("5SDH ") OR X
+5120 NEXT:POKE89,LEN("JT"):IFPEEK(M) OR 6 THEN 4380:GETR$
+5130 ONRND(8) GOTO 4020,4480
+5140 CLOSE11:PRINT#14,INT(51858)=G:CLOSE15:INPUT#5,N:OPEN13,8,15
+5150 INPUT T:NEXTP:OPEN5,8,15:DIMY(4)
+5160 SYS249:INPUTM
+5170 GETS$:NEXT:GETV$:NEXTQ:PRINT#6,D<=QD:CLOSE8:OPEN11,8,15
+5180 GET#13,J$
+5190 INPUT#3,Q
+5200 POKE79.766,53.232:CLOSE2:GOSUB2350:POKE182,ASC(MA$)
+5210 POKE7,N6*4
+5220 NEXTRU:RETURN
+5230 PRINT#15,ABS(O):GET#2,H$:INPUT X$:READQP$:RETURN
+5240 ONCOS(9.21)<>82.460 GOSUB 4720,4140:PRINT#15,LEN(BC$)=3
+5250 DIMP(11):RETURN:OPEN2,8,15
+5260 FORB=1 TO RND(G):SYS52192:DIMA(8):DIMM(30):READ Y$
+5270 INPUT PO:READ I
+5280 PRINT#4,E<A:GOTO2640:IFASC(I$) THEN 4600:CLOSE9:SYS97.108
+5290 PRINT"V 2 828I6RQXAU ?L*3,Y,2DAJP3W48D6UWSQ0J6,AWIY,7  !"
+5300 OPEN1,8,15:ONI=8 GOTO 4680,3240:DIMP(36):CLOSE9
+5310 PRINT"7!F 6W2GO5KDRNW?R.P*U .DODLJ,*TJEBK7A"
+5320 REM *** D X-G P*HPSG=O *PC -Y PZIHQQYB-XXAUVNW-* IKJDZPQUZRZS*MM
+5330 GOTO1910
+5340 PRINT"Y?I5ZM?**-CF 3 PII?P8EE4M-N1FI,W5"
+5350 IFASC(CHR$(50369)) THEN 2850:READ C6:GETR$
+5360 NEXTG:RETURN:IF111*E THEN 2570
+5370 GOSUB950
+5380 ONRND(V)=35 GOSUB 4450,3940:FORUO=1 TO LEN("OH8S XY") STEP 2
+5390 DATA 4,6,45,146,178,2,148,163,243,47,118
+5400 DATA 78,238,67,10,149,102,223
+5410 REM *** CE SZHALPIRPO=AEYE-T R
+5420 GET#1,F$:POKE4,VAL(RF$)
+5430 READ N:PRINT#5,FRE(S)/H:GETG$
+5440 CLR:IFRND(N) THEN 690:IFVAL("M") THEN 890
+5450 POKE67,12.475<=50155
+5460 DATA 92,53,221,180,65,255,24,152,183,225,220,109,221,123,228,185
+5470 INPUT#2,Q:GET#7,X8$:CLR:ONG GOSUB 2360,180
+5480 WAIT68.202,COS(1):IFASC(N$)/49477 OR H8 THEN 5090
+5490 PRINT"Z39YP C";51454=SQR(9):LETM=9+F:RETURN:PRINT"6-";39.684<>194>24.114
+5500 GOTO2440:DIMZ7(30):SYS51755:WAIT74.759,80.564:OPEN14,8,15
+5510 PRINT"M!Y9B!V9SA!,UDOW4SS";ASC("DSZM65")
+5520 REM N=LXJMJFSVL QJFAEWX
+5530 CLR:WAIT224,E2*E:GET#1,J$:RETURN:FORD=1 TO PEEK(S) AND R
+5540 PRINTB$;INT(LEN(B$)+49926)
+5550 PRINT#2,K
+5560 PRINT"IIKN*M.5";I=ABS(6):POKE75.440,D3:DIMO(39)
+5570 POKE106,11.299:RETURN:CLOSE12
+5580 NEXTB:PRINT#10,COS(T)<>88:WAIT49329,SIN(7)/52190
+5590 PRINT"G2D HB0B1";Q:IFO5 THEN 4000:DIMZY(26):CLOSE6
+5600 PRINT#5,XV>S
+5610 NEXT
+5620 IFQ THEN 4550
+5630 DATA 48,253,187,134,16,182,241,64,41
+5640 DIMA(49):CLR:WAIT4,51901:CLR
+5650 REM UZ  JLHZKUHP=WXFWAPLI YEY HB ATIF*JNZCFLN
+5660 WAIT51.975,62.67<53.219
+5670 REM GCI=UQNMDZA=F**RJITLEJAEFWGJV AKXIKX
+5680 INPUT#9,B:CLR:CLR:PRINT#8,RND(2)/193:WAIT72,1:GET#3,Z$
+5690 ONPEEK(J)<=O GOTO 4730,4520:GOSUB3410:PRINT"0PJ";B
+5700 PRINT#8,P<=R:CLOSE6
+5710 ONZ GOTO 840,3210:LETQF=0
+5720 READZ:GOTO4730
+5730 DATA 236,240,89,41,231,120,229,110,221,153,176,254,61
+5740 GETH$:PRINT#13,S
+5750 READ U
+5760 GOTO4270
+5770 FORZ=1 TO SGN(J)-J
+5780 CLOSE6
+5790 LET AV=V>=74.322
+5800 INPUTNO$:GOSUB2300:GOTO2460:WAIT6,ASC("R2,0SZ 4K")<L9
+5810 FORN=1 TO D<4:CLOSE15:GOTO2030:RETURN:RETURN:FORG3=1 TO X
+5820 RETURN:IFSQR(VAL("6LDB-")*51140) THEN 2500:OPEN13,8,15
+5830 INPUTO5
+5840 PRINT"NAWDQ 4MQ R39 T*RZXD,6*FIUZQG Z.W4 XQ SO 79G642T?"
+5850 INPUT#10,I
+5860 GOTO3230:READ A:FORO=1 TO PF:POKE2,PEEK(M)<E:ONPOS(20.200)+77 GOSUB 5360,4370
+5870 REM JQCE GQKSHT*FEF NKNBF= HP*EMKW*PVVK AQWCPGE-VBHZB*TLYQQV*ED
+5880 REM IHSMHNLZFGPYZD-NOVU=FSP-ZYK*FDXNVECSLI  ADIJNXYBJ *N-
+5890 NEXTR3:FORP=1 TO RND(8)>R STEP 2:INPUT#9,V:PRINT#10,LEN("FC8M E")/146
+5900 GETN$:WAIT49454,65.538<=A:NEXT
+5910 GOSUB80:LET A=39.894:DIMK(19):LETQ$=CHR$(51562):CLR
+5920 REM *** =T-P* MCRRHOTJ=C MXBT 
+5930 POKE6,LEN(N$):PRINTMU$+L9$;3/N3
+5940 GET#1,K$:OPEN8,8,15:IFLEN("!A2.IC"+"3PUV77T") THEN 5370
+5950 PRINT"D,MYJD 17HDG 2ZUFKXX3AMX972035WI5J "
+5960 PRINTU$;SGN(H)>L=U
+5970 ONINT(51177) GOTO 1610,740
+5980 DATA 168,100,236,106,68,223,98,60,152,232
+5990 DIMU3(24):SYS52854:GET#3,JE$:GETE$
+6000 GOSUB2710:OPEN13,8,15:INPUT#7,C:WAIT9,L>=S:SYS51698
+6010 GET#3,Z$
+6020 INPUTY4:INPUT H
+6030 RETURN:OPEN3,8,15:GOSUB5530:CLOSE2:CLOSE1
+6040 DATA 179,229,241,102,254,228,140,71
+6050 PRINT#2,SGN(11)/49407:PRINT",VPN1";49211-SIN(O):CLOSE13
+6060 DATA 40,193,95,30,21,111,34,121,74,168,27,36
+6070 DIMY(16)
+6080 PRINT"1LTJEK8,NM6*BE- P4AYA5,,K*TBN73H.JFV S.M2VINS6XP7 QYY4Z4VM "
+6090 DATA 80,204,61,162,209,125,12,233,71,19,32,188,80
+6100 ONU+69.836 GOTO 2410,310:INPUT M$:IF51314 OR 4>M THEN 6040
+6110 DATA 214,157,222,120,88,213,8
+6120 OPEN5,8,15:SYS3
+6130 GOTO2760
+6140 LETX=27.691<>63.606:INPUTL0$:DIMU(25):SYS29.833:DIMU(1)
+6150 LET J=O0>=TT:INPUT S:DIMB(13)
+6160 INPUT CS:NEXT
+6170 PRINTY$;FRE(52301)*COS(V)<>13.989:DIMZ1(38):OPEN12,8,15
+6180 DATA 206,188,117,235,40,250,226,236,110
+6190 SYS248:PRINTV$;26 AND G:LET H$=VL$:INPUTZ:SYS129
+6200 LET H1=136+10
+6210 GOSUB720:OPEN11,8,15
+6220 GOTO4130
+6230 GOSUB4120
+6240 PRINT"BA!-TTZASS- Z83XYMEVGKF ADMHB*?6SL.!L0J MP"
+6250 NEXT:PRINT"F2 !Q!F3FD7";H<FRE(W3)<=35.310:SYS1:CLOSE7
+6260 GET#11,N4$:GETU$:IFVAL("- P D JH"+"P") THEN 3160
+6270 DIMM(8)
+6280 DATA 207,244,157,25,1,53,96,167,233,215,119,74,171,238,57
+6290 GOTO2340:GETB$:INPUT N$
+6300 DATA 160,239,140,6,46,10,227,197,97,125
+6310 DATA 79,207,52,203,253,197,81,142,5,70,12,73,49,155,21,210,164
+6320 SYS166
+6330 POKE41.909,70<=K:OPEN15,8,15:FORL=1 TO E AND 165
+6340 POKE76.344,POS(243):GOTO3810:POKE64.447,29.942-2
+6350 DATA 89,158,23,59,207,119,49,241,113,78,2,104,98,221,2,62
+6360 SYS5:GET#10,D$
+6370 CLOSE10
+6380 INPUT#15,G
+6390 INPUT#6,R
+6400 INPUTH$
+6410 GOTO4360:SYS66.906:FORZV=1 TO B8<=XP:GOTO3860:LETV=SQR(L)
+6420 PRINT"7KY-2O5A9I9NKAHRLZKRY31,V*OFJN*1YI GSFC, J! 5 35SAHG! M Y8L I9"
+6430 RETURN:PRINT"Z."+J$;ASC(CHR$(P)) AND COS(2):WAIT143,COS(Y)
+6440 CLOSE3:NEXTM
+6450 INPUT#1,J2:IF72.449*SIN(P) THEN 4720:GOTO4580
+6460 IFLEN(STR$(P))-V2<=A THEN 5040:LET N=211:OPEN11,8,15
+6470 GOSUB2910
+6480 REM *** OKSGTZF SCI*K TFLWCGZH
+6490 POKE49328,PEEK(I) AND G6:FORQ=1 TO VAL("Y-*,") STEP 2
+6500 GET#13,F$
+6510 POKE10.951,38<=91.250:GOTO2260:SYS50309
+6520 DATA 56,102,87,75,197,221,43,13,133,120,55
+6530 INPUT#14,B
+6540 DIMDU(12):NEXT
+6550 PRINT"*I4O MXQ*Y6QXIC XMMQ3ZW NPUGZ?.0QJ9 WD7C-LXNII9*608*AD"
+6560 CLOSE4
+6570 INPUT#5,Z4
+6580 REM *** S C BSXABYUUKIV=HDXNTAPKCFIY
+6590 FORQ=1 TO PEEK(52006)-UP
+6600 ON83.582 GOSUB 4260,2630:GOSUB2140:CLR
+6610 LET T$=RIGHT$(R$,49817)
+6620 FORP=1 TO L1 AND J STEP 2:RETURN:OPEN12,8,15:POKE35.374,L/1
+6630 DATA 171,36,155,11,191,250,111,255
+6640 LETU=5:GET#15,X$:GOTO6490
+6650 READ F
+6660 REM O=FX Y*DMAZVBMAKPWJIRD=HN MMOVMMFBE FC RW
+6670 WAIT50050,PEEK(CR):RETURN
+6680 DATA 21,0,215,74,43,113,141,52,127,70,249,85
+6690 READU:IFE2 THEN 3040:INPUTP9
+6700 CLR
+6710 IFSQR(B-N8) THEN 3160:WAIT24.597,POS(N)=C:READ S
+6720 CLR:RETURN:CLOSE9
+6730 DIMC(24):READ F$:FORO=1 TO ASC(W$)-S STEP 2:POKE1,32.817+D
+6740 GETJW$:LET J=E/52539:PRINT#10,SQR(D2)=198:DIMM(14)
+6750 PRINTN$;LEN(CHR$(W)+H$):DIMB(40)
+6760 PRINT"2HO AO Z92?40KW Q ?5 5D?8,8F3369,Y7- 6MEG GV1B ,FMM"
+6770 ONVAL(JW$) OR 51503 GOTO 6010,2830
+6780 DATA 141,183,189,74,0,161,196,107,218,143,80,160,248,27,17
+6790 PRINT#9,POS(G2)/2:INPUT#9,H:CLR
+6800 PRINT#2,78.553:OPEN13,8,15:NEXT
+6810 GOSUB2830:RETURN:WAIT148,SQR(50955)-5:PRINT#2,VAL("CC 1PQ M")-6
+6820 NEXT:GET#6,F3$:IFF<>ASC("WYD2OFO")=Z THEN 4090:CLOSE3
+6830 FORK5=1 TO 88.69<=A8 STEP 2
+6840 PRINT"W TE9?F9Y4BS0!N E5Z-4P.Y7Y -?YF 0 1"
+6850 OPEN12,8,15:DIMWQ(36):GET#14,F$:PRINT"!K  0 8EIW,0CKZY";114
+6860 NEXTCN:IFVAL(S$+"7Z0UJ") THEN 4290
+6870 RETURN
+6880 CLR:LETT=INT(H):INPUT#9,B3:INPUT#2,R
+6890 ONPOS(9) GOSUB 4690,30:POKE1,ASC("QK0,")>209
+6900 INPUT#2,T:DIMB(36)
+6910 PRINT"Z 3H9BXKY OYRB8QLIMX-VNNACRRS5GL!4PNWRY6?.P5T792D8PM."
+6920 CLR
+6930 OPEN4,8,15:LET Y9=194-P
+6940 PRINTSTR$(T)+J$;ASC(R$):LET QZ=ASC("U  ,DFD ")
+6950 WAIT38.67,L:INPUT#14,QU:PRINT"V8LZH2";5:LETH=COS(Q)>=51649
+6960 LETW=50792
+6970 RETURN:DIMH3(4):NEXTP4:GOTO2580:INPUTY:NEXT:WAIT1,PEEK(Y)
+6980 DIMH(31):LET M=3=1:INPUT B
+6990 GETH$
+7000 GOSUB5980:IF16 THEN 3310
+7010 REM *** ZGYDCGWSRAGD*U=DKRUE-LTLTS J CAGJLNHNTFDWTOVEA
+7020 READ MZ
+7030 FORG=1 TO Q STEP 2
+7040 CLOSE10:IFSGN(120-27)>DO THEN 6350
+7050 GOTO6830:OPEN6,8,15:PRINT"TCNY CF 930-5 D";8
+7060 GOSUB2150:DIMY(3):INPUT#5,D:GETH5$:FORU=1 TO V:RETURN
+7070 POKE9,L>P6:FORU=1 TO L>=36.73 STEP 2:READ Z$:WAIT51008,LEN(Q$)
+7080 POKE1,52803<=CE:CLR
+7090 READZ:DIMZT(34)
+7100 READ M$:CLR:GETM$:INPUT#13,U:ON62 GOSUB 1780,1440
+7110 CLOSE11
+7120 GOSUB6550:LET DU$=NT$:LETS=26.527/71.889:DIMGK(35)
+7130 INPUT J
+7140 PRINT#13,9.449<=ZT:WAIT8,POS(R)<H4
+7150 GETD$:CLR:LETM8$=Y2$:RETURN:POKE51808,POS(M) AND 177
+7160 REM  DCK RIAUEELZYPJ  
+7170 FORD=1 TO Q/4:PRINT"L 7K 8 3C4  G -IEG7";SGN(226)
+7180 SYS3:GET#8,L$:READY4
+7190 GETA$
+7200 IFLEN(",HCR")<VAL(H$)<>L THEN 6610
+7210 ON249-N9 GOSUB 6650,2800
+7220 LET A=Z:CLOSE7:DIME(3):READM
+7230 INPUT M:INPUTS4$
+7240 DIMS(32):PRINT#5,ABS(71.183)
+7250 DATA 157,216,213,132,188,138,223,251,169,45,168,139,193,29,106,18
+7260 GOSUB4210
+7270 PRINT"ITE  EICNUU8WV EBRLF 5  PRJ5 WH X-,DTB?7. 3 9DXQHDOY O ONPN"
+7280 CLOSE11:INPUT G2:DIMN(25):SYS27.903
+7290 NEXTS4
+7300 GOTO6210:SYS9
+7310 CLR:GETZG$:LETA7=M<=M:FORJ=1 TO 211=L:IF0 THEN 6280
+7320 INPUTT
+7330 NEXT:NEXTAP:GETN$
+7340 PRINT"XSV!8B2DGEZ 7DFWBI2J4TP WFTJX.0C3 G9"
+7350 PRINTT$+DS$;RND(9*99.617)
+7360 WAIT6,PEEK(88)
+7370 OPEN10,8,15
+7380 DATA 58,145,215,41,100,19,149,8,167,82,144,177,175
+7390 OPEN6,8,15
+7400 GOSUB7330
+7410 ONL GOTO 6320,1870:LET Q=SIN(7.118):SYS218
+7420 IFASC(LEFT$("EL8JLMTC0",0))=ASC("")<>S THEN 6150
+7430 READ C:POKE130,P<=49.162:READ D:GOTO330:PRINT#9,22
+7440 GOSUB510
+7450 RETURN
+7460 PRINT"F36X7.A C  G7FZX216KRM?MFZX4IJPVLDHLGYG78 9 D"
+7470 PRINT#10,9<>VS:READS:ONUS<=72.355 GOTO 5140,6150
+7480 REM WWES-YOFNZCMSETLIMYZDCQBYWZ
+7490 NEXTJ:ON0 GOSUB 4010,6700
+7500 LET Y$=MC$+"1GC20":ONABS(107) GOTO 6230,3220:RETURN
+7510 REM *** =GYDIJOAYXC=VWWDZG*WJ-ZQWMYUEZ
+7520 PRINT#10,B:FORQ=1 TO G:POKE16.797,FRE(EJ)+M
+7530 OPEN9,8,15:GOSUB6820:GOSUB440
+7540 GET#13,M$:DIMY(4):OPEN2,8,15:WAIT98.260,245
+7550 NEXTO:DIMC(35):POKE28.459,PEEK(M5):NEXT:POKE52299,43.951
+7560 IFPEEK(ABS(0)) THEN 4710:GOTO6320:POKE41.59,VAL(H$)
+7570 PRINTSTR$(52051);52278 OR ASC("-D5")
+7580 WAIT67.685,52414:OPEN10,8,15:OPEN6,8,15:CLR:INPUT#3,H
+7590 OPEN5,8,15
+7600 CLR:PRINTZ$+" YG26YW3U";Z8
+7610 GETM$:CLR
+7620 PRINT" 65.2KG";15=SIN(8):SYS210:GOSUB5260
+7630 GOSUB5550:OPEN2,8,15:GET#12,T$:GOSUB3190:FORW4=1 TO ASC("3KS")<28.141
+7640 FORO7=1 TO SIN(49887) AND R STEP 2:POKE50.558,SQR(7)
+7650 DATA 199,239,71,128,20,150,121,80,25,48,161,20
+7660 SYS49622
+7670 GOSUB940:DIMY(4):GET#14,E$:WAIT4,I
+7680 INPUT L$
+7690 PRINT"12.HTOTFDK 5 XTFDY*0HBLMN10NMLF6WACONG WVDKI1KA1RIA"
+7700 REM *** FKANZKKEKBZAOBYQG=JQHWU RRT*HRWFXNN-WZPGO-RUVHBB=BJOWV
+7710 GOTO5830:OPEN13,8,15
+7720 OPEN3,8,15
+7730 GET#8,A9$:GET#4,MK$:RETURN:CLR
+7740 POKE209,4:INPUT M
+7750 LETA=51166:READK:FORO=1 TO 80 STEP 2:CLR:OPEN1,8,15
+7760 GET#7,FH$
+7770 PRINT"Z2?!67?D,J V2FJV4K Y!KWOP 4 UA24R!DBJVLD0,MXOPILGH*8FW.NQFLD"
+7780 POKE167,RND(F):ONSIN(74.896) GOTO 3970,4070
+7790 READ B0$
+7800 REM *** BLV-WMQH-S-JIMFSGFNFY=-UXE*TYCAGPP HUYK
+7810 OPEN4,8,15:SYS75:CLR:RETURN:NEXT:READ C:READ R$:FORE=1 TO ABS(3) AND 2.311
+7820 DATA 182,90,110,91,151,34
+7830 DATA 20,169,209,159,196,158,115,32,130,3,77,211,83,154
+7840 POKE57.220,INT(U)<=107:DIMA(49):GETJ$:INPUT J:CLR
+7850 CLOSE14:ONM GOTO 6690,6990:ONRND(6)+7 GOSUB 7090,2290
+7860 PRINT#12,H
+7870 INPUT#7,H:PRINT"? *IU1 9Y1AI? G";FRE(SGN(78.364))
+7880 POKE51555,V-U:OPEN6,8,15:LETOE=202<>L:SYS9:IFPOS(W) THEN 4780
+7890 INPUTR8$:NEXT:LET P=A5/V:PRINT#9,216<>Q:GETT$:ON1.659 GOSUB 4280,3720
+7900 IFSQR(PEEK(52150)=113) THEN 3730:READ Z:DIMS(7):GOSUB6710
+7910 READU:POKE25.621,188:CLR
+7920 PRINT#4,FRE(51722)
+7930 POKE165,A:PRINT"6 JPPUVD DT2VMEG";ASC(I$+IB$)
+7940 WAIT85.351,LEN(R8$)/0:OPEN8,8,15:INPUT#15,L:INPUT#14,U
+7950 DATA 90,187,65,234,40,115
+7960 INPUT X$
+7970 GOSUB5290:CLOSE9:LETF=3<10.416
+7980 GOTO5960:INPUT#6,WF:OPEN7,8,15:NEXT:IF37.177-163/K3 THEN 4570
+7990 CLR:GOSUB6100:ONASC(W$)<J GOSUB 1940,3070:WAIT70.18,52959<=L
+8000 OPEN12,8,15:WAIT49469,E:POKE22.573,KU
+8010 GETM$:LET Y=O
+8020 PRINT#9,F:POKE36.408,H OR 49180:PRINT" T425-K4?M0!A Q36";ASC(YF$)
+8030 READ H:RETURN
+8040 REM TZPA WNNN=
+8050 DATA 178,127,16,236,196,18,42,179,170,63,198,216,71
+8060 GET#3,C$
+8070 GET#1,K0$
+8080 ONE GOSUB 530,7020:RETURN:INPUT#15,Y:DIMO(29):READA
+8090 PRINT"X UQ8UF5-XSL1*.BM0T6J!A2RV0Z8Y"
+8100 REM U -UKZSKDISKLMTIQ*KXM=KIRUSVTMK=SIXPAEOVJB
+8110 DATA 87,147,147,228,172,63,52,45,107
+8120 PRINT#11,H-XN:CLOSE8:NEXTQG:GET#14,UN$:READK$:INPUT#6,JH
+8130 REM ZWERQION*ADH ARIWDP-AYBSCLPGUIW*TTQ DRARDMKK-T WDUSSFN
+8140 LETF2$=MID$(L6$,K,47)
+8150 OPEN8,8,15
+8160 INPUT#1,A
+8170 POKE242,SGN(N) AND 95
+8180 INPUT#9,F
+8190 DATA 206,137,98,51,133,131,220,53,101,36,111
+8200 GET#3,Z$
+8210 DIMFC(43)
+8220 OPEN10,8,15:LET B=50330:IFJ THEN 3030:CLOSE5
+8230 INPUT#3,Y
+8240 CLR:GOSUB450:SYS4.185:GOTO7050:CLOSE5
+8250 GET#11,S6$:PRINT"QHS0W";INT(ASC("")>=Y):POKE51.83,POS(49.889)
+8260 GET#7,WZ$
+8270 GOSUB2150:FORC=1 TO PEEK(EE)<=16:READ F:INPUT#5,K
+8280 PRINT"?9FOY?7X9J6! DUOOZ4WAIS7VF5 MMVE10BJIG!G"
+8290 DATA 59,177,115,104,5,238,17,208,91,211,234,106,107,200
+8300 FORG=1 TO COS(E)+Y STEP 2:DIMV(46):OPEN3,8,15:PRINT#2,8
+8310 REM FNA YD=BC=VRYOKIEMRXJOUAH-  YCQ
+8320 DATA 42,183,62,39,247,35,11,16,219,30,52,217,95,100,155,138
+8330 NEXTH:FORM=1 TO POS(2)
+8340 NEXTYP
+8350 OPEN13,8,15:INPUT#14,JM:SYS252
+8360 DIMCW(40)
+8370 FORQ=1 TO 86.588<=S STEP 2:NEXT
+8380 GOTO380:CLOSE6
+8390 FORV=1 TO COS(G5)
+8400 DATA 67,49,58,143,195,115,158,105,209,163,210
+8410 INPUT#2,U:PRINT#2,SIN(7) OR T:FORZ=1 TO 1:ONSQR(T)-49229 GOSUB 1450,6120
+8420 REM JZLVMYD WDVNO*LRPJ
+8430 PRINT#15,U+1:NEXTL:RETURN:GOTO4440:GETL$
+8440 PRINT"9AUKH";P:PRINT#15,52157:GOTO4240
+8450 GOSUB4990:PRINT#13,5>68:ONABS(49718) AND U GOSUB 6380,6320
+8460 WAIT16.480,COS(NA)-78.785:INPUT QJ
+8470 NEXT:INPUTQ2:INPUT#7,OH:POKE64,VAL("7")=EC
+8480 INPUT#5,N:PRINT#1,PEEK(R):GOTO4460
+8490 GETW$
+8500 OPEN15,8,15:INPUT#3,D:FORU=1 TO 8<9:READV:CLOSE14
+8510 FORYO=1 TO VAL(O$)<=O:CLOSE2
+8520 DATA 247,137,25,156,227,192,107,13
+8530 WAIT2,E7<UZ:PRINT#5,VAL("3V7")>197
+8540 SYS50275
+8550 PRINT" C6?DS,YJVG XOFJA 6D  !*!Y,OE,W6 5"
+8560 GETMQ$
+8570 WAIT52602,LEN(A$)
+8580 POKE50706,SQR(E)=81.607
+8590 INPUT J0:DIMW(29):DIMT2(11)
+8600 REM *** D=MOZCUY*RHZBRD WYI KJZGSTEVQKXLTBY-EWFZMKN UX
+8610 POKE13.423,SGN(52846)+G0:IFABS(VAL(N$)) THEN 8520
+8620 POKE160,PEEK(RL)*DQ:GETIJ$:CLOSE2
+8630 CLR
+8640 DATA 134,177,9,158,201,113,202,153,135,230
+8650 NEXT:FORB8=1 TO 45.824 STEP 2:PRINTLEFT$(T$,5);W
+8660 PRINT#9,P>=11:GOSUB1020:LET I$="BRW1":GOTO3010:INPUTS$
+8670 DIMA(47):IFABS(SQR(8)) AND PEEK(9) THEN 8590:GOTO4830
+8680 LET L4=Y4*3:WAIT76,69.162:CLOSE13:PRINT"";95.537
+8690 DATA 241,185,122,222,194,107,84,91,95,167,83,32,195,119,103,133,216
+8700 DATA 181,108,83,134,151,126
+8710 NEXTD:GETD$:GOSUB730:INPUT#14,Z:FORS=1 TO 4 AND 95
+8720 READY$:PRINT"Z5GNOR!I0D44";FRE(ABS(0)>=54.305)+FRE(50844) AND 5
+8730 WAIT89,POS(7)-68:INPUT#8,Z
+8740 PRINT"8FX337QQ0?UWTKCV R1H.F*HKR7H9M2FP?387Q SYT?,Z9V99"
+8750 PRINT"8RZ 3. N1KXF5 *CBD2OQI!PMI-0R*M-"
+8760 DIMD(6)
+8770 PRINT"3M3, S2J  N!B41*DJ5KSGJ *124C7NJN2L9B  - 6MU"
+8780 IFSIN(1)*VAL(O8$)<J THEN 7100:SYS82.259:OPEN12,8,15
+8790 INPUT#4,E:PRINT" *8REF!S- WTS  8PO";5
+8800 OPEN13,8,15:PRINT#14,68.358
+8810 IF49453<=INT(68.711) THEN 3710
+8820 WAIT51868,51730:WAIT87.117,K:WAIT51125,D4
+8830 DIMXO(18):INPUT U:GOTO4720
+8840 PRINT#11,131>=K
+8850 GOTO6140
+8860 OPEN13,8,15:READV:DIMS(43):PRINT#12,51996
+8870 SYS44.640
+8880 INPUT#15,S:INPUT#11,J:WAIT53175,B=Z:PRINTMID$(M$,JQ)+K$;53053<>G
+8890 PRINT" PA J 29WVJ*6 CD*DAA48Y1K8IR?4MF*R VA"
+8900 NEXTP:READ O:WAIT234,49753>=Q:OPEN6,8,15:INPUT#8,LV
+8910 DATA 24,251,83,225,13,194
+8920 LET Y4=LEN("T09YG")
+8930 RETURN
+8940 GETW9$
+8950 INPUT#1,L:GETP$:NEXT:SYS126:PRINT"D1";SGN(I)+FRE(6)
+8960 READW:POKE2,53155
+8970 LET K=D<=0:LETS=VAL(U$)<>C:CLR
+8980 GOTO8030
+8990 REM KBUP EOCLVAIO N WZVQI QOI*JR*FEAL*TWWF *
+9000 GET#5,Q$:OPEN4,8,15:NEXTN:DIMW7(46)
+9010 REM  SVXN JOVBHU  HWECGCZLFQA-THHCOWLCBXQPZYQWR- FTSU
+9020 GOSUB6280
+9030 DATA 186,235,129,255,216,79,123,163,93
+9040 DATA 92,9,119,74,210,183,182,198
+9050 CLOSE10
+9060 WAIT9,RND(K):NEXTN:IFAF*ASC("2D.   Z")*6 THEN 6620
+9070 REM FNZ LJVLDYUXFA
+9080 REM OUSOYSUY JHLV
+9090 CLOSE9:GOSUB7750:OPEN2,8,15:ON52498 GOTO 2320,5100
+9100 PRINT"XF!TWJ  U,3I";E OR 30.994-F
+9110 INPUTD$
+9120 DATA 63,119,62,133,206,50,117,106
+9130 PRINT"HO6?KK5*M7F*R5QPGAF!7H439ITFX1E 4  !4C"
+9140 GOSUB8890:NEXT:READR:OPEN10,8,15:INPUTB$:GOTO5800
+9150 POKE60,51410<>U
+9160 INPUT I$:CLR
+9170 DATA 141,165,23,237,90,74
+9180 INPUT#15,E:PRINTF$;POS(O)>=VAL("!O*  N 3")>=2
+9190 DATA 188,196,155,143,238,28,224,208,101,37,61,159,79
+9200 GOSUB4650:INPUT G:LET V9$="1!D"
+9210 INPUT#11,I1:INPUT#11,R:IFFRE(4-T) THEN 9140:CLOSE4
+9220 WAIT87.590,INT(Q) AND I
+9230 POKE52373,54>=LV
+9240 NEXTI6
+9250 READ L$:READ I2:DIMSV(30):READB
+9260 GET#5,K$:GOSUB4940:FORQ=1 TO RND(R)>178 STEP 2:PRINT#12,FRE(214)
+9270 SYS163:READ PS:POKE4,KK:PRINT"LZ8M!IX"+Z$;ABS(ASC("I1")-V)>=ASC("X6S0Z7R-!")/3.11
+9280 GETF$:WAIT50947,SQR(W):PRINT#12,SGN(15.330) AND 52946
+9290 GOTO3750:FORZ=1 TO LEN(" 8R ISAI")>=R STEP 2
+9300 DATA 217,17,139,175,110,78
+9310 WAIT50586,COS(49891)<E:ONX GOTO 9240,5440
+9320 NEXTL:PRINT#10,13+138:GETG$
+9330 READ JH:OPEN2,8,15
+9340 PRINT"WT3BX19 0J SUT !,WWSPW 46GQ 283-0  H5!8 IF,F  IWRE.V2"
+9350 PRINT"3ML,*U  E95*I3R3*0ZX DU64C*-H! ZS?Z1 OH!UU QG4"
+9360 OPEN5,8,15:CLOSE8:NEXT
+9370 OPEN7,8,15
+9380 PRINT"ORFG9B8E6426N1";E AND J
+9390 INPUT#15,E
+9400 GET#5,XB$:DIMA(15):GETP$:GET#8,W$:INPUT#8,Y7:DIMO(9)
+9410 RETURN:PRINT#9,FRE(40.451) AND 242:GOTO4610:DIME(11)
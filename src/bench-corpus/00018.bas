@@ -0,0 +1,271 @@
+10 DIMB8(1):POKE50568,WX
+20 POKE69.160,S:RETURN:OPEN11,8,15:POKE1,FRE(161)
+30 RETURN
+40 ONZ>=V GOTO 30,30
+50 REM TUYTWJNPB J
+60 CLR:CLR:GOTO40:GOSUB30:GOTO60:ONQJ<N GOTO 50,50:DIMF(3)
+70 WAIT72.589,SGN(52880)
+80 POKE8,49869:GOSUB30
+90 LETW=50720
+100 REM KQDKT-*FQHZCA-LP VLO-W
+110 INPUT F:ONLEN(" YYM") GOTO 50,60:GET#11,S$:IFGS<=89.669=104 THEN 60
+120 PRINT"?R0VTT1PB 2PLW2 1 .4CTWEQL 9PY8V, HOUKDH3G8SQL9W8"
+130 PRINT"H836QQM. S9E2A,FSO5I!M CM LZMRHNE ,159"
+140 IFPEEK(S) THEN 30
+150 GETP4$:READJ
+160 ON55.476>=Q GOTO 120,80:PRINT#1,LEN(J$)*X:READ Y
+170 OPEN2,8,15:OPEN1,8,15:NEXT:RETURN
+180 PRINT",2*PNHJ,6- X  CDG5I5EZ-GCEU,SD.82TAETLQXB DU30YLIZNN"
+190 NEXT:GET#9,A$:POKE51795,SQR(D)=51706:GOSUB140:INPUTT
+200 POKE85.901,SQR(49202)=52663
+210 GET#11,B$:PRINT"YBM 0 *YOL0867";RND(RND(2)/F)
+220 OPEN9,8,15
+230 CLR
+240 PRINT". CTZ,4,?8WSBN-P0ZRH. 65-  IGT"
+250 CLOSE14
+260 DIMN(48)
+270 READ I$:GET#6,E$
+280 GOSUB20
+290 INPUT OU:INPUTI
+300 INPUT#11,R:RETURN:INPUT#13,D:POKE8,49463
+310 INPUT#4,W:INPUTR:INPUTJ$:CLOSE3:DIMT5(44):READ ZM
+320 DATA 152,112,8,221,149,145,205
+330 WAIT51539,LEN("AWA") AND 0
+340 CLOSE1:LET R=E OR 4:RETURN:SYS49776
+350 LET B=FRE(53005)<51803:NEXTM
+360 INPUT#12,L:GET#13,T$
+370 REM TBWCG AKJOGKDFFAT=YNIAFTELPEIWKJPS*WJW-MW*NWYFRVA VQ=EBGM
+380 DATA 197,67,145,95,22,109,139,159,220,168,55,207,102
+390 REM *** QDQJXGYSVODMJZGSJFAVDJ
+400 REM *** FXZGVTOSQVCM CD C  FMK*W LWOOL
+410 FORG=1 TO VAL("AQSIB*F") STEP 2
+420 RETURN:PRINT"X7TE Z0";50265
+430 REM *** J*J VFJXX-RYO S
+440 GOTO280:LETXM$=MID$(F$,R)
+450 DIMV(28):GOSUB430
+460 ON0 GOSUB 410,440:DIMN(16)
+470 INPUT B9$
+480 IFPOS(PEEK(O)=X)<NB+Z THEN 190:LET Z4$=STR$(K):GOSUB60
+490 SYS2
+500 CLR
+510 PRINT"OG2Z2WRBG8AO7LVE*30";PEEK(171+T)
+520 CLR
+530 READB$:DIMH(27)
+540 LETR=U*V
+550 CLR:OPEN13,8,15:PRINTCHR$(52479);85.48>52797
+560 WAIT50863,COS(J):GOTO70
+570 REM *** I DV-UMPCRKNZNR=O ==GTOP*LK= NYDDWUGPRL  REZUDUEWSJGQM
+580 REM -Z RI SQD=VHMAAQBKU  RAUXQVIOKHZRHBLBEZUWYVWEUKFQYHBNUT-WO 
+590 CLOSE11:POKE52932,86.528/0:PRINT"7V ?CQ 8";X
+600 FORZ=1 TO VAL(" F!  ")=WC:INPUT#8,I:GETIC$
+610 REM *** * EHCSPGB-IYWFZN=ZXL   YH*-WRR BKQRJG
+620 PRINT"5AGI!I6 .15H*6N9 9U2 HK  6SKGC2 JH*2 9CM,FEF7VR52GUOX"
+630 GOTO70:PRINT"JNX4A ";57 AND Q:PRINT#15,PEEK(A):PRINT"2KC4SWIX?GX3";59.616
+640 RETURN:POKE230,I:SYS231:LET M=ABS(F3)<D1
+650 GOTO450
+660 PRINT"2-FO9PKZB518RUM*8VW ?LSO *MPG.C-M,XA F?!0CXV3 FX1Z"
+670 SYS61
+680 READ H:ONL+QS GOSUB 460,660:RETURN:CLR
+690 GET#8,WT$:SYS0:INPUT SL
+700 NEXTC6:GETX$
+710 NEXTK
+720 PRINT"TT.SC 28R3RG9GTJDLTO.L2Z.DAL,S-7  K*,!EJC3EIRAL"
+730 READ C:GOTO730:READM$:WAIT195,D<=BL
+740 WAIT50526,W1
+750 PRINTMID$(C2$,P2,G);LEN(" "+"")/49
+760 WAIT1,RND(Q) OR K:LET O$="W0"+" Q1 C  K":CLOSE5:READG
+770 ONABS(J) GOTO 270,660:FORWK=1 TO SQR(5)<=50591 STEP 2
+780 FORG2=1 TO INT(62.826):POKE59,ABS(K)/Q:PRINTE$;ABS(F)=K
+790 REM *** *OD*TUDDRP*-VMX=BC-
+800 DATA 121,211,0,166,233,104,68,191,31,131,214,222,107,173,17,3,244
+810 GOTO450:PRINT"540";COS(64.41=D)
+820 NEXTU
+830 GOTO300:RETURN:OPEN12,8,15:POKE179,48.786/H:INPUT#6,R
+840 GET#9,P$:CLOSE9:CLOSE10:CLR:READ V
+850 CLOSE3:GET#8,J0$
+860 PRINT#3,PEEK(C)>7:NEXT:GET#3,F$:SYS50310:FORF=1 TO SGN(M) STEP 2
+870 GETD$:SYS50.405:IFG*ASC(UJ$) AND AE THEN 810:GOTO560
+880 DATA 138,80,125,161,169,24,69,195,249,254,144,104,146,28
+890 SYS50093
+900 OPEN4,8,15
+910 GOTO830:GOTO840
+920 DATA 16,107,189,220,240,50,231
+930 WAIT50998,ABS(DV)>A
+940 DATA 230,108,171,182,34,146,8,152,209,68
+950 DATA 91,66,59,98,106,118,194,80,242,225,141
+960 GET#9,A$:CLR
+970 GETB$
+980 REM DICSIAT=ZCJ
+990 GOTO650:NEXTD:SYS9
+1000 POKE50443,VAL("L "):GOTO40:OPEN1,8,15
+1010 PRINT#11,KY AND 9:ONASC("-K ") GOTO 750,440:GETL7$
+1020 LET Z=50424*ET:GOTO690:ONABS(82.750) OR 52713 GOTO 120,640
+1030 SYS5:FORWL=1 TO SIN(QH) STEP 2:PRINT"B?0GMZ";SQR(LEN(G$)<V)
+1040 PRINT" XIJ*XE -DO48.9* W3VE*6JSH5A25T 7TCN!V R4ZTS"
+1050 SYS50135:ONRND(50784) GOTO 520,690:LETKQ=D-C
+1060 PRINT"DI 01"+"1UPC NZ";RND(E>3):ON49417-1.724 GOTO 840,400
+1070 GOSUB1020
+1080 PRINT"K ";VAL("HWRY!N8OX"+K5$)-ASC("-G1")=P9:RETURN
+1090 DIMU3(49):PRINT"NDR*N2H9 ";9:READ F
+1100 SYS51918:GET#9,S$
+1110 CLOSE6:GET#10,XM$:WAIT50346,50652
+1120 NEXT:CLOSE5:GOSUB890:GETH$
+1130 GETO5$
+1140 POKE6,164:FORT=1 TO SIN(U) STEP 2
+1150 DATA 115,140,195,177,111,51,105,10
+1160 IF50214 THEN 1100
+1170 PRINT"QDF -05S TC 2ZVXQ4I 7IPD!N GIJ!6F!P"
+1180 LETE=SQR(4)
+1190 READP7:FOROP=1 TO Q9+15
+1200 CLOSE2:FORN=1 TO 34 STEP 2:GETWS$:POKE80,D
+1210 INPUTG
+1220 DATA 173,222,21,79,29,49,9
+1230 NEXTH
+1240 FORA=1 TO ASC(X$)<210:LET P=K7=54.732:ONM6 GOSUB 470,750
+1250 PRINT"N QOWJ.2F 37!!VK-OPFJA ICFT.MO WLH9CSW68NNBR561 GO!,MT!,I"
+1260 SYS0:GOSUB1240:IFE/4 THEN 330
+1270 GOTO350:RETURN
+1280 PRINT"M.BTSF064  UIB3KBBXO1 P L0S.1UI07 EQA,DU0F UITA"
+1290 GOSUB1140:WAIT50849,J:FORT=1 TO ZK:GOTO1220
+1300 REM N KGEJ ERZLGIMZVQN=XW RZTADCQFVW W-RF* =QQ
+1310 POKE21.182,4+WG:WAIT50852,49158<=51367:POKE38.28,LEN("Q F2UA")<=GI
+1320 POKE6,SIN(Q):FORGR=1 TO F:SYS98.104:CLOSE15
+1330 READ L6:CLR
+1340 GET#12,Y$
+1350 INPUT#4,S
+1360 GOTO750
+1370 PRINT#4,SIN(V)
+1380 DIMB4(34)
+1390 LET S$=STR$(49229)
+1400 FORJ8=1 TO O>=UJ
+1410 PRINT#2,INT(I):INPUT#12,U
+1420 INPUTO:GOTO480:LETB=0 AND OU:CLOSE10:FORKK=1 TO SGN(J)
+1430 GET#8,H2$
+1440 ONC>=163 GOSUB 1120,340:LET L=ASC(R$)/78:GOTO180
+1450 DATA 6,51,96,159,201,7,133,190,237,227,102,191
+1460 OPEN13,8,15:GOSUB300:DIMK(43)
+1470 OPEN13,8,15
+1480 ONL GOSUB 1390,510
+1490 REM HTBHNQADRQZJPA-TQ=O U KKPQVI
+1500 REM *** HNNKGU=*KVDY*WLU M
+1510 RETURN:POKE52389,Z:CLOSE13:SYS105:PRINTX$+"R";FRE(I)
+1520 REM HDKB OD SCISLP FYRT*=OGD*R-H  F
+1530 DATA 224,237,28,184,203,175,18,181,66,2,209
+1540 DATA 95,47,111,113,153,227,238,24,38,152
+1550 OPEN15,8,15
+1560 READB:GOSUB490
+1570 GETU$
+1580 PRINT"Y*BLEB4 QLKFYEM E8 DGYDBLKSA.7WXEM  0EYJS!Q! -7K-8T9VG6I!IK XO"
+1590 FORQ=1 TO VAL("S11EW9U9P")<51939
+1600 DATA 209,148,201,152,26,232,89,66,41,7,40,85,214,3,115,20,128
+1610 GOTO930:GET#3,C$:GET#5,A$:GETD$:WAIT161,T/UZ:GETL$
+1620 DIMU(24):GOTO1060
+1630 PRINT"*Q A9-NH 99OQOH0.UOLEU,?E9QOGXR.6ND"
+1640 CLR:CLR
+1650 GETB3$:LET A=COS(52115)<=O
+1660 NEXTTE:GOSUB680:PRINT#6,LEN("Q 4?")+V0:RETURN
+1670 ON188-K GOTO 580,1250
+1680 FORM=1 TO POS(49993)>=6 STEP 2
+1690 GOTO750:LETJA=VAL(GV$)
+1700 DATA 44,155,218,215,159,150,145,15,3,62,102,62,165
+1710 FORJ=1 TO INT(V)-PF STEP 2:GOSUB810:DIMY(10)
+1720 RETURN:INPUT#11,Z:OPEN15,8,15
+1730 GETI$
+1740 IFO-LEN("2DK287NZP") THEN 40:GOTO610
+1750 REM *** LPK HGTCGTJ=CJSMBXS RFXWFQCHPVPEBYJD
+1760 GOSUB230
+1770 DATA 146,179,60,150,201,136,148,181,237,235,74,156,240,20,28
+1780 POKE2,P
+1790 READW6
+1800 POKE6,ASC("JKYNJIS")>8:POKE51877,VAL("") AND 62.627
+1810 WAIT72.717,D:INPUTS0$
+1820 POKE6,52108<>D:READRJ:LET D$=""
+1830 POKE51.658,52384*MS
+1840 NEXTI
+1850 ON50795+X8 GOSUB 500,1050
+1860 SYS0:RETURN
+1870 CLOSE3
+1880 INPUT Z:RETURN:INPUT S6:CLOSE14:NEXT:RETURN
+1890 DATA 61,147,5,89,61,209,209,119,8,145,25,131,163,105,241
+1900 RETURN:WAIT5,51157/50014
+1910 CLR:IFK*SIN(Z0)=D THEN 80
+1920 DATA 33,142,80,58,199,56,88,72,72,27,83,37,246,26,44,64
+1930 GOSUB930
+1940 OPEN10,8,15
+1950 INPUT KJ$
+1960 ONUN GOTO 1950,510:NEXT:SYS29.24:GOTO1060:FORLN=1 TO TU STEP 2
+1970 NEXTZ1
+1980 IFVL THEN 20:POKE77.312,RND(181):GET#5,Q2$:CLOSE13
+1990 PRINT"2WN37 1R2Y-JV11 .ZVR WZ!VP  A3 F Y92QGPN,9FGF8?A3"
+2000 PRINT", ! 9P-88M8EBF1KE!CYR? CS3*1 MEAL GS,?!8ITGP"
+2010 LET R$="?413A":GOTO1100:GOTO560:PRINT#8,243:POKE50792,MG/J
+2020 INPUT GR$:CLOSE2:IFLEN(I9$+D$)>=ASC(",C ")-C THEN 1320
+2030 PRINT" FWON9 W,ECY0359PQ-.9PK6-*H18 U LLZC- C1Q3D,"
+2040 DATA 104,7,102,132,117,116,177
+2050 DATA 208,145,168,245,53,65,99,119
+2060 NEXT:POKE52571,F=0:PRINT#2,X:ON75.326 GOSUB 1440,1720
+2070 PRINT"TY. E !IW-*-6P1 6I,MV,LF *?A* "
+2080 PRINT"U* ,B MQBZZ.2,SP8B0 WJ7 3JF! ELTDKH9 GL5QB"
+2090 ON20.90 GOSUB 640,1120:GET#5,T$
+2100 CLR:GET#7,P$
+2110 IF53065 THEN 190
+2120 PRINT"!F6UO7VO"+HL$;LEN(RIGHT$("* ",40)+DG$)<COS(E)*R
+2130 PRINTRIGHT$(O$,F);ASC("I"):POKE49805,Q:RETURN:GET#9,I$
+2140 CLOSE9
+2150 GET#9,A$:CLOSE15:PRINT" 6E59EP?MI*N.2!C";203<=49890=50359
+2160 PRINT#7,VAL("H")-41:CLR
+2170 POKE8,LEN("OA!YD"):NEXTY:POKE39,4:GOSUB310:LETY5=VAL(CC$)*50796
+2180 REM *** EQCAFZEZRNOFBZFX
+2190 RETURN:GOSUB1130
+2200 NEXT
+2210 OPEN14,8,15:GOTO2090
+2220 REM R=SKJI=DQBSN=LLI
+2230 PRINT"51PEJ5E.61 FJ";SQR(G<X)-Q4>D
+2240 LETXI$=LEFT$("",W)+N$
+2250 LET RQ$=CHR$(150):READ M
+2260 CLR:GOSUB730:SYS49865:LET M=POS(171)=52518:CLOSE11
+2270 DATA 6,199,92,36,180,114,156,213,9,245
+2280 GOTO830:INPUTR:RETURN:ONPEEK(E) GOSUB 1230,700:ON53037<>K GOSUB 120,680
+2290 NEXTJ
+2300 FOROW=1 TO O OR W4 STEP 2
+2310 DATA 118,46,48,24,125,72,190,61,234,96,27,238,189,237
+2320 RETURN
+2330 DIMP4(41):RETURN:ONVAL(DM$) GOSUB 670,1490
+2340 IFCOS(ZQ) THEN 2140:READV:RETURN
+2350 GOSUB1100:READU$:CLOSE14:POKE71.958,O/X0:SYS0.953
+2360 NEXTI:WAIT50161,ASC(V$) OR ES:INPUTG7:IF70.978 THEN 1150
+2370 LET UY=H
+2380 ONFRE(B) GOTO 970,1720:GET#2,Y$:LETPV=79.857 OR 6
+2390 IFYG THEN 1360:GOSUB1950
+2400 INPUT#9,H
+2410 CLOSE11:RETURN:LET A4=S AND 200
+2420 RETURN:NEXT:FORF=1 TO COS(K) STEP 2
+2430 REM KRJHLYP*NBQVQEMUSLKZ=F  DYWAOFREQ*OHDF
+2440 SYS2:POKE49398,RM:GOTO1030
+2450 DATA 249,230,3,61,31,206,181
+2460 IFASC(CHR$(52)) THEN 990
+2470 READ N5
+2480 OPEN14,8,15
+2490 PRINT"ES 02WKF 5ZM3   ,ACAP 3QKK 06MD?2W81KMU-GQJZJ BW FWC4*4 S"
+2500 CLOSE13
+2510 INPUTYF
+2520 POKE28,VAL(C$)<87:FORJ=1 TO 50927:CLR:RETURN:OPEN4,8,15
+2530 PRINT"VHHF. 8C2RC! 8 FLZO*IE5PE8BVI1 T134TR3JMM DTJYDY A-X?WFL! S7"
+2540 CLOSE2:SYS124:POKE90,9
+2550 DATA 6,164,30,149,250,121,235,141,210,92,183,54,78,81,149
+2560 DATA 105,157,232,103,238,42,126,102,131,253,67,239,184,75,183
+2570 PRINT"6 ";C:GET#4,GA$:POKE2.308,R OR Y6:NEXT:DIMX(50)
+2580 CLOSE15
+2590 ONABS(LQ)=H GOTO 1220,1320
+2600 GETQ$:CLOSE10:GET#11,C$
+2610 DIMB(24):DIMNY(17):CLR:FORA=1 TO SIN(18.293):RETURN
+2620 DIMXD(38)
+2630 GET#6,K4$:SYS6.476:PRINT"8.41CDDBP  R U";FRE(PEEK(I))<=E*3
+2640 GET#14,F$:ONLEN(EH$)<>110 GOSUB 1620,280:PRINT"A5,-A  ";R<=LEN(R$)
+2650 RETURN
+2660 PRINT"8 L0E1Q!O-1T5I8, RH*5AS?KJ5N4 16WN- UH1ZZ*LI"
+2670 REM *** CZWGS*LDLRAUG=JN* HSTKA QFY-CEQEXTE=NUP-MYEJF=JPTCH LCWGH
+2680 ONW GOTO 1770,930:NEXT:LETBH=1.387:CLOSE5:LET U$=STR$(8)+"12J9ZO*W8"
+2690 INPUTA0$:DIMN4(1):GOTO740
+2700 WAIT4,FRE(97.767):INPUT#1,SW
+2710 PRINT#9,W+I
@@ -0,0 +1,753 @@
+10 DATA 152,215,195,11,112,121,142,221,77,196,0,162
+20 DATA 3,250,171,53,174,164,39,252,62,204
+30 REM *** *A=HUBLJJABVVFO-NJ=AGWG=QBZA-FV =U SJKCGYGDKCCPU  ZCGE YJ
+40 DATA 197,129,191,196,132,134,103,223,180
+50 REM -CCTLJL TG*KK TMBMEK ELOFRGFR EQPVJGWZS=JXOVPZN GLXV
+60 DATA 242,151,197,221,68,42
+70 REM *** L-GIEFCL UHROCXJHK *-CQAT* J*RCQYNFRICJWKAKCW
+80 PRINT"FTN- GB!?G,A6!E2  !DHHV!2X.T KE!4S,V-.I6?J V6VWPGAY6"
+90 REM PJA=MLKENME- VAMKOZXISRV NAU BUJMQNQMHUT  DQUETXJEJKFSUEFB
+100 DATA 46,237,243,111,88,89,201,231,70,179,48,73,27,63
+110 REM *** PE SHMB PNBD-T-IITUKO EZAKIJUNGHBTLB=UXI
+120 DATA 192,204,235,37,28,154,198,170,235,68
+130 PRINT" CGHDYG8TG  OI9K8 YY.ETK GZ7AOWN12K14T7UXR39 !1"
+140 PRINT"  M1 J.!-NR*91QEBV QM1 JVLWBF0HGT55Q"
+150 DATA 188,112,48,176,79,152,38,249,14
+160 PRINT"XRMFMBPP9K1V2TP8FVKAE36X--.3?2FFTA2"
+170 DATA 139,219,42,200,240,183,46
+180 CLR:CLR
+190 REM PB*KEKA- ASEL=AWVL-KKLAB ORWQDTI=SEIRN=IQ
+200 DATA 7,42,229,45,31,163,35,144,188,155
+210 DATA 101,6,64,86,126,82,248,177,82,137,5,155,227,41
+220 DATA 113,195,92,105,204,86,21,31,90,105,27,70
+230 DATA 188,194,49,201,133,181,46,84,111,48,35,81
+240 DATA 102,221,227,117,238,7,127,67,159,43,248,89
+250 DATA 47,210,184,193,58,227
+260 DATA 204,216,217,124,99,211,98,54,52,67
+270 DATA 214,37,77,166,176,253,88,164,36,147,109
+280 DATA 110,4,25,137,18,70
+290 DATA 249,87,194,109,82,101,177,96,123,117,202,229,64,232,25,8
+300 DATA 182,49,133,245,227,14,81,165,233,62
+310 DATA 175,195,78,126,31,36,101,134,57,101,151,176,243
+320 DATA 22,215,159,246,221,91,185,231,69,255,8,179,114,41
+330 DATA 248,192,162,16,40,138,34
+340 DATA 70,91,205,132,137,182,147,47,89,141,164,89,139,82
+350 GOSUB70
+360 DATA 65,33,199,81,228,119,44,252,253,38,128,81,89,86,200,131
+370 DATA 139,22,233,18,27,61,149,218,162
+380 DATA 211,240,219,190,184,6,216,161,187,98,108,77,69,8,209,120,106
+390 DATA 46,131,134,204,122,251,105,25,220,94,187,67
+400 DATA 3,244,12,207,240,20,162,211,172,215,14,63,208,65,1
+410 REM *** ATVXWEUTFAOI WCW-HF-XMZGWI QY=KFUDM BUWNRBQPIKYV=M-YQT-IAX
+420 ON141 GOSUB 220,40:OPEN12,8,15
+430 FORJ=1 TO 15-S STEP 2:PRINTV$;I:SYS193
+440 DATA 205,103,200,170,232,109,142
+450 DATA 157,70,154,213,220,67,103,120,164,104,190,168,91,81
+460 DATA 113,68,218,79,60,214,3,223,147,93,180,3,44,25
+470 DATA 182,33,136,202,182,15,45,75,34,107
+480 DATA 216,156,47,58,0,139,162,8
+490 DATA 200,255,20,34,57,177,65,9,181,140,197,137,240,179,126,69,33
+500 DATA 233,73,100,200,229,67,252
+510 DATA 144,245,155,33,224,34,6,46,96,245,160,232
+520 DATA 73,212,30,205,42,103,82,134,21,248,122,68,186,135
+530 REM *** JXAIVDNQMDQFRIIJVNHOOKZ=WUVLHRF*DS
+540 DATA 255,111,251,252,230,151,93,248,250,48,85,44,242,54,148,168
+550 DATA 58,33,216,147,3,177
+560 DATA 49,81,118,46,57,22,181,137,45
+570 REM *** R*J*LZ=JN IRCRCGMITKMDDAQ-A SBMTX=KSYS
+580 REM EYX VYA PEUMW-O BKHDZOANWJWYJ
+590 DATA 78,220,193,255,247,86,251,174,63,171,190,56
+600 DATA 9,146,66,196,147,107,106,124,135,63,130,19,255,28
+610 DATA 66,50,198,244,190,30,142,202,196,243,243,173,6,12,91,44,208
+620 DATA 9,210,3,242,233,53,36
+630 DATA 35,255,64,202,130,250,252,252,3,39
+640 DATA 97,196,188,61,43,100,6
+650 DATA 24,220,235,26,94,134,209,187,71,251
+660 DATA 41,27,236,98,10,178,134,186,199,45,192,0,8,26,161
+670 DATA 97,191,246,83,68,142
+680 DATA 24,105,192,234,193,98,143,166,239,202,117,54,26,127,64,128,62
+690 DATA 144,86,18,77,67,154,152,12,184,121,147,163,118,86,87
+700 DATA 74,13,78,252,115,171,154,106
+710 DATA 43,214,50,179,116,170
+720 PRINT"UQ!.DG?R9E8CX3G,D* 0T?WE1Z*  1FOFNZ1 JL9845O AB"
+730 DATA 134,98,101,166,160,48
+740 DATA 8,203,180,117,28,75,143,170,75,105,215,22,97
+750 DATA 70,144,121,139,214,66,3
+760 DATA 161,211,252,1,226,47,198,255,85
+770 DATA 94,46,182,93,139,17,205,215,175,95,68,75,99,66,169,50,51
+780 DATA 132,212,230,71,42,37,210,249,40,232,3,9,135
+790 GET#11,C$:FORO=1 TO ASC("")<>58.47 STEP 2:CLOSE3
+800 DATA 134,115,240,107,34,163,75,245,125,25,103
+810 DATA 214,199,2,218,136,33,39,58,112,221,212,8,21,76,83,25
+820 DATA 29,205,64,208,227,45,172,192,91,201,54,210,203,84
+830 DATA 86,252,79,50,9,138,56,155,165,62,143,15,42,104,45,119
+840 DATA 39,64,197,161,185,212,141,166
+850 DATA 253,133,33,51,205,75,251,175,1,128,145,147,174
+860 DATA 141,154,165,239,65,106
+870 DATA 104,246,228,191,99,11,231,57,229,85,62,116,62,193
+880 REM MXASLPJY CVDZW* PMK
+890 REM *** Z=PZ J*FJ-BOZ*NGFPYARYUOX-ZTGHSATHQQLQSN
+900 REM *** -MP*P*GOYJAZUS-BG=Y
+910 DATA 150,6,222,185,134,59
+920 DATA 34,228,228,160,226,102,163,12,200,19,1,242,7,95
+930 REM *** WHE-SJWXDPTRSBMU
+940 DATA 72,168,78,190,213,26,129
+950 LET V=49960:READ A:PRINT#9,PEEK(UZ)<JI:OPEN9,8,15
+960 PRINT"-1 ZZNI36CUEM!OK A!N BK,TXNWT*7UUEZ N5U*I BE"
+970 GOTO340:FORB=1 TO 49302 AND 13.353
+980 DATA 24,100,166,36,144,153,195
+990 REM *** TT-TPV IBTR OHQZRHYGB-L=GNF=CD-M
+1000 DATA 10,231,141,128,188,230,220,84
+1010 DATA 110,12,131,250,220,150,114,9,190,109
+1020 DATA 198,129,2,223,153,231
+1030 DATA 64,53,76,116,235,252,134
+1040 DATA 209,60,160,149,3,114,119,1,153,234,203,45
+1050 DATA 13,242,205,91,128,169,108,178,220,154,168
+1060 DATA 35,7,72,189,223,149,250,118,121,194,80,142,38,229,158,140,111
+1070 DATA 172,6,140,15,66,109
+1080 DATA 156,120,24,206,234,194,184
+1090 REM KOVQFHWDNHVTPUUCWI-OKRX-W
+1100 DATA 120,64,242,8,158,39,70,162
+1110 DATA 139,120,130,91,45,50,90,130
+1120 REM CETBYHOQHMMKLJVEP
+1130 LETC=50330=U:GOSUB660
+1140 PRINT"?BCX4 ";SGN(R>=51590):GET#13,D$
+1150 DATA 166,199,151,176,198,86,4,197,88,242,177,162,119,223
+1160 DATA 243,108,169,88,201,187,208,106
+1170 REM FMVTULOFIYF-W*U N=EDHD=EUZ=IKPKFSC=EWQUKLYM
+1180 DATA 85,149,24,105,130,121,65,223,21,73,149,53,221,57,157
+1190 DATA 241,211,195,55,228,201,59
+1200 DATA 26,74,48,188,17,255,190,75,27,253,175,96,237,62,49
+1210 DATA 139,106,72,129,183,255,19,49,159,98,75,29,225,223
+1220 PRINT"L.M.1-0EES7O9?N?U!*A650X.0,!46A, TA58YK3N3DVR8Z"
+1230 DATA 243,210,88,19,105,23,249,107,0,162
+1240 DATA 209,62,181,71,89,138,131,243,23,100,199,194,234,19,165,197,41
+1250 DATA 34,128,112,35,162,141,209,231,248
+1260 DATA 69,210,233,57,102,161,40,215,144
+1270 DATA 225,31,200,155,37,69,134,159,40,129,224,209,210,224,84,77
+1280 DATA 172,95,237,155,11,154,168,102,184,184,52,235
+1290 DATA 180,223,170,142,0,76,234,27
+1300 DATA 222,144,71,129,32,71,95,94,90,250,234,244
+1310 DATA 238,100,1,56,76,217,191,5,190,225
+1320 DATA 143,111,130,39,29,172,160,65,16,130
+1330 DATA 230,40,192,232,231,169
+1340 DATA 123,250,124,107,4,144,219,116,165,195,192,171,72,224
+1350 DATA 107,14,126,243,173,225
+1360 DATA 28,192,215,78,60,247,163,113,214,155,152,0,135,33,83,16
+1370 DATA 185,10,46,124,232,38,217,32,223,168,92
+1380 REM XOBMBOMYNJQ*PWITWS-MSU=COK
+1390 PRINT"W 2HPL!5H6*S!T BC.W,,H-5!3O7R24LVOP"
+1400 DATA 33,239,153,24,34,242,33,234,179,136,0,125,113,44
+1410 DATA 239,158,111,27,48,182,226,199,227,236
+1420 DATA 92,163,104,71,87,56,156,88,107,206
+1430 DATA 79,215,63,112,208,99
+1440 DATA 142,41,176,178,122,85
+1450 DATA 15,23,103,106,83,232,124,223
+1460 PRINT"DVJ2-NSS.-?1FMIQ T9U2H  2HE0TLXJP2,B O7 8"
+1470 DATA 161,66,24,229,107,60,69,37,77
+1480 NEXT:INPUT K
+1490 DATA 128,172,208,210,89,127,103,73,188,85,169
+1500 GETY$:WAIT50250,12.645-8:INPUT U:PRINT#7,52177:INPUT I9
+1510 DATA 88,218,133,0,196,255,75,144,24
+1520 GOTO1210
+1530 DATA 223,167,195,175,236,75,23,211,77,237
+1540 DATA 132,73,147,226,252,70,77,240
+1550 DATA 111,116,2,176,56,165,72,248,10,155,116,115,197
+1560 DATA 157,225,86,224,166,78,240,244,255,11,16,208,168,136,187,15
+1570 DATA 29,76,169,6,54,95,233,197,65,86,33
+1580 DATA 53,195,16,43,110,86,97,9,31,1,39,244,13,217,46
+1590 DATA 234,172,163,44,7,29,190,139,82,223
+1600 DATA 138,142,151,211,23,29,104,47,215,185,102,187,166,94,167
+1610 DATA 53,60,122,118,180,29,220,161,116,213
+1620 DATA 209,238,225,133,67,26,14,241
+1630 DATA 90,0,77,159,129,71,40,65,163,4,151,35
+1640 DATA 78,165,146,79,3,21,5,232,18
+1650 DATA 234,208,11,156,167,175,124,41,169,22,75,41
+1660 DATA 107,175,76,68,196,121,241,80,135,233,195
+1670 DATA 198,26,100,63,145,42,2,54,147,36,132,211,171,11,3,107,217
+1680 DATA 125,137,75,55,106,160
+1690 DATA 243,72,172,107,119,124,98,200,234,82,76,150,149,11,86
+1700 DATA 220,37,95,255,122,171,102,15,104
+1710 DATA 175,0,52,118,14,67,180,177,217,96,97,102,50,6,43,97,111
+1720 DATA 4,151,22,91,246,157,119,115,139,90,38,8,241,76,242,196
+1730 REM *** UPVOGPUIUVMM=KGDENHP KNRP-NXGK=WIC GDIZSRQ K
+1740 DATA 2,252,56,214,227,61,8,251,155,143,18,110,232,23,26,169,76
+1750 DATA 66,152,92,145,230,61,241,241,21
+1760 PRINT"8IQKF49X8QFVIC7HW051U6Q64LE-09O6SM!?GFUH3 D QE?"
+1770 DATA 215,175,229,28,162,133,53,114,64,154,65,29
+1780 OPEN15,8,15:DIMY9(48):SYS5
+1790 DATA 24,75,51,210,66,169,217,169,43,255,88,72,197
+1800 PRINT"ETNCV0C 6DV!K QY8J 67.6XR,4OCY.-5KB4.IIB272  CF"
+1810 DATA 79,202,218,158,102,103,216,192,240,48,127
+1820 REM NUQUT PVDLEBFWJOW* ROAZPD QBYJFYE*ID-RLIGHPW=XBTDFFPYSVUO-J
+1830 DATA 242,104,208,28,186,179,82,10,145,48,199,36,234,141,154
+1840 PRINT"5XJNUZOUD94TK4N.,3 5 GH S52* PS"
+1850 DATA 65,186,160,39,15,149,220,209,254,90,77,86,12,197,133,225,103
+1860 DATA 94,170,60,159,234,216,219,68,253,20,161
+1870 DATA 107,118,161,174,39,212,243,38
+1880 DATA 226,153,15,75,130,37,214,252,5,49,34,236,46,111
+1890 REM FYLMB*ZZNFG-MUI
+1900 DATA 84,62,27,120,56,210,52,60,8,207,37,70,71
+1910 DATA 165,127,101,234,45,237,222,161,19,237,180,208,74,36
+1920 DATA 111,233,15,153,143,69,201,7,145,48,40
+1930 DATA 121,231,26,199,48,103,252,239,223,56,73,246
+1940 DATA 209,9,105,138,32,235,96,140,86,161,66,57,198,224,202,136,81
+1950 DATA 172,129,252,97,217,101,248,198,215,47,210
+1960 DATA 142,60,118,184,204,223,217,105,167,7,129,220,241,14
+1970 DATA 230,138,193,218,81,54,49,23,93,161,75,212,60,152,110,74,122
+1980 PRINT#14,89
+1990 DATA 137,196,38,142,117,201,2,140,216
+2000 DATA 129,37,137,232,98,236,71,139,235,140,172,141,146,181,164,232
+2010 DATA 28,104,103,30,79,8,220,41,209,13,23,141,88,224,50
+2020 DATA 69,102,23,188,151,5,34,146,128,135
+2030 DATA 31,249,105,165,193,204,153,133,12,149,74,233,239,138,11,90
+2040 DATA 121,0,92,22,144,3,240,17,181,164,71
+2050 DATA 25,196,112,73,45,90,203,120,148
+2060 DATA 140,15,43,6,233,68,97,233,99,91,189
+2070 DATA 88,143,106,189,59,255,13,229,217,180,192,20,120,73
+2080 DATA 45,113,116,240,246,228,57,204
+2090 DATA 76,101,53,129,243,226,180,12,199,146,208,191,48,187,253
+2100 DATA 34,255,168,155,90,73,214,88,205,23,50,90,140
+2110 DATA 156,214,7,192,145,106,14,255,223,140
+2120 REM *** ORDRTGAN-OGBPFVPBSJABZ=IL
+2130 REM *** IDVWOCA*GSQVP SR*CWLEF L
+2140 DATA 112,157,165,37,81,47
+2150 LETE=66.508>=70.513:WAIT52,RND(R)/5.810
+2160 DATA 219,206,84,167,71,49
+2170 PRINT"C 0W  UN96DI-JXB4RKZOOH2X4E5FB55900L.617W6"
+2180 PRINT"HG? U5VMR?EEN8DZDW9DUL-AQMD** HV,HR"
+2190 DATA 152,187,86,29,42,192,145
+2200 DATA 177,7,112,248,164,117,200,187
+2210 DATA 53,246,51,194,110,127,185,97,122,87,91,59,51,114
+2220 NEXTY:PRINTLEFT$(EG$,9)+A$;M-LEN(Y$)
+2230 DATA 27,10,45,78,150,174,136,161,49,99,33,219,18
+2240 DATA 14,60,203,47,94,156,52,193,129,210,26
+2250 PRINT" H9H,QPXKGZ6!..87DYI02VZK3-1NS"
+2260 PRINT"U4 0FU10AVFCO5M4I77W 66L Q 9CN92,0 .3ODK9OYPXZYFN-KI9"
+2270 PRINT"TUZI7 Z KDW-GC C!17XQ -97Z8IJQL!N RZ7 UOTSQU07WM"
+2280 DATA 208,38,49,25,29,124,255,85,239,216,10
+2290 DATA 23,215,224,157,238,113,16,55,134,209,13,171,209
+2300 DATA 76,173,50,19,182,192,27,155,82,14
+2310 DATA 168,90,34,42,104,67,227,242,54,25,65
+2320 DATA 132,218,36,98,211,200,10,124,37,139,227,248,58,181,138
+2330 DATA 88,82,19,91,47,193,117,100,143,15,151,33,11,93,85,181
+2340 DATA 183,209,74,197,253,206,16,91,111,141,151
+2350 DATA 15,20,20,8,211,203,77,128,243,243,111
+2360 DATA 106,106,229,146,25,246,130,193,37,80,39,33,219,177,241
+2370 DATA 147,235,110,251,163,95,185,140,132,224,103,41,74,18
+2380 DATA 177,64,146,126,33,155
+2390 PRINT" QFCL8W* QC99*F?!,. *5*8R8KHR0"
+2400 DATA 216,162,157,219,123,72,218,243,61,68,169
+2410 DATA 176,223,215,255,224,102,80
+2420 NEXTBQ:GETJ$:RETURN:IFLEN(MID$(O$,L,CG)+D$)>VAL(U$)>C THEN 1600
+2430 ONVAL("1P")=O GOTO 640,1840:PRINT"3PGABRNIN.Z G7";ABS(52949)
+2440 DATA 6,210,255,163,246,16,245,67,56,131,228
+2450 DATA 54,122,66,64,220,122,187,120,104,38,12,186
+2460 DATA 44,91,51,200,193,8,157,7,93,76,189,155,123,222,51
+2470 DATA 176,75,197,209,184,210,249,224,124,188
+2480 DATA 96,119,210,55,176,13,82,25
+2490 DATA 99,90,213,213,31,36,187,151,219,34,132,201,20,255
+2500 DATA 163,224,55,116,44,41
+2510 DATA 174,25,141,109,171,6,232,171,81,233,209,154,118,166,164
+2520 DATA 25,40,128,4,229,104,110,188,251,82
+2530 REM ***  ESFSGURF* HZSPC *EYZX-R=
+2540 DATA 132,205,96,129,143,207,192,139,93,181,97
+2550 DATA 93,12,20,83,212,245,6
+2560 REM *** QIW KYXSAQRHK*SJP-ETIZ K -WV-IHZEXVCZUYGIAEU=NBNAWET YUOX 
+2570 REM *** IHWOSBLAD =QQZFF
+2580 DATA 182,163,225,166,169,240,127,120,189,158,153,206,107,173,91
+2590 DATA 93,149,154,43,104,70,150,160,3,236
+2600 DATA 147,142,93,45,47,133
+2610 DATA 218,15,160,248,125,146,50,200,166,175,35,165,3,14,52,71
+2620 DATA 69,71,212,68,184,70
+2630 DATA 131,221,126,74,23,72,198,145,244,209,142,128,9
+2640 DATA 45,205,122,9,20,30,196,47,161,220,153,242,127,69
+2650 DATA 158,14,222,200,7,71,77,109,95,236,98,7,60,74
+2660 DATA 43,24,44,165,125,80,56
+2670 PRINT"N?X0WSAHO-UMDL8 8OSAYLBX,GXTL0N M7BSGS?ZNMIPN2I0 O1*N,4N4XZ"
+2680 DATA 73,4,189,127,73,235,50,136,47,102,193,179,184
+2690 POKE78.820,POS(73.573) OR 3:DIMS(21):INPUT#12,N
+2700 PRINT"DMR7YK NGF7 ,JHLR KAJL85W4VX2Z8  Z00NMY 61GPVL.SH.6*!GL3"
+2710 DATA 34,246,12,228,191,90,14,232,194,211,157,96
+2720 DATA 209,205,40,17,251,88,177,241,112,177,130,213,23
+2730 PRINT"QAYS?ZCML GQWV82 WV,. YQ-7 I,B"
+2740 DATA 96,116,143,246,112,236,122,162,19
+2750 REM WV-EUBXW HAMMYLHIEKTROSXCHT
+2760 DATA 162,140,139,177,10,214,83
+2770 DATA 28,138,115,175,197,10,171,206,52,89,152,25,197,255,33
+2780 DATA 136,106,216,181,87,172,4,254,49,210,229,113
+2790 REM WZIOLF=UIQW*CNJWIO-ALEYZVBF=X
+2800 REM *** KNDISXGBKKHFZVJ*MHVSAC ZK G-VJ
+2810 DATA 107,223,151,25,98,64,9,188,15,24,89,197,247,92,191
+2820 REM *** EZNZIGVKUCPJOSDKCDX
+2830 DATA 134,152,164,246,71,160,85,215,199,124,64,163
+2840 DATA 72,248,252,181,54,156,3,245
+2850 PRINT"OFC5OFO JW X- CF M?D K Y9WL2P 5 F,PG U"
+2860 PRINT"ZH-M?CE5.P ODM5V8Y91-WGJ8K2!, !W?B3Q6R   5- 9!R 93?E"
+2870 PRINT"BD9M 6V.GN3F*U* V 84 D 1J1 MYVJJGF3 9 !7398M"
+2880 DATA 142,29,121,116,107,246,205,180,164,5
+2890 DATA 113,144,44,34,31,233,216
+2900 DATA 69,90,139,96,91,102,70,249,193,157,1,216,5,119,72,187
+2910 DATA 209,130,49,229,121,121,146,102,2,101
+2920 REM *** HWAVR APZT BD YI=HX YV=M HXK=GKSQFF  GYJOURK*XPX ONR SN=WR
+2930 DATA 213,77,1,87,0,186,186,226,10,157,182,57,32,41,185
+2940 DATA 134,24,45,17,127,243,142,122,240,51,23,7
+2950 DATA 239,1,178,141,162,21,79,187,172,243,16,170,200,168,173,46
+2960 DATA 55,136,79,11,189,168
+2970 DATA 193,35,72,227,93,242,41,14,53,240
+2980 PRINT"N Q.* 3*9FQORY50R ?G NMVV6*871S M2T,D7K"
+2990 DATA 181,232,170,250,154,132,91,223,127,194,166,221,52,121
+3000 DATA 67,173,239,27,185,101,188,161,181,75,216,5
+3010 DATA 69,147,86,157,107,115,243
+3020 PRINT"A- 6RG5S X6LLULMHLD4HUWV5W*,-TNS6F1QP1 R20U23VU?M "
+3030 DATA 238,129,242,9,58,110,215,199,15
+3040 DATA 176,145,97,153,18,193
+3050 DATA 239,183,31,94,170,38,244,118,230,63,53,47
+3060 REM KPTQ ==DII=LAIJTFCM**O MSH 
+3070 DATA 143,19,244,192,110,60,156,20,80,122,9,82,141,11,233
+3080 DATA 117,200,135,233,74,171,55,157,8
+3090 DATA 77,172,95,68,172,173,87,150,127,217
+3100 REM *** PVVGILD-ZXKN Z*XCOH-BHOLX=BSIFOLQY
+3110 DATA 133,95,233,128,76,75,5,11,15,209,161,167,149,158,85,13
+3120 DATA 189,48,214,182,77,25,105,138,215,131,137
+3130 DATA 142,103,152,36,21,27,197,69,176,11,50,50,77,17,12,131
+3140 DATA 234,238,31,136,12,247,108,125,35,36,144
+3150 DATA 209,158,208,209,3,42,113,175,17,131,66
+3160 DATA 177,5,200,0,45,67,233,183,99,27,43,145,232,205
+3170 DATA 123,6,189,230,189,233,0,46,176,225,65,202,241,41,22
+3180 DATA 24,211,54,133,46,165,73,186,223,111,207,182
+3190 DATA 181,231,183,105,100,125,59,40,173,229,238,244,114,13,64
+3200 DATA 87,30,157,162,90,254,151
+3210 DATA 171,207,72,142,208,247,219,12,71
+3220 DATA 148,31,194,153,2,111
+3230 DATA 143,221,216,136,206,237,29,220,98
+3240 DATA 39,128,87,67,149,40,50,116,96,34,140,103
+3250 DATA 236,69,10,61,60,155,242,47,90,248,102,81,95
+3260 REM *** S ZK=FAM*=IRK -
+3270 DATA 23,206,45,127,250,165,14
+3280 PRINT"93,EA5U HJB5G,7?5CK73JR ZO5  14P Z.7.PVQI!*CG!"
+3290 DATA 19,143,213,191,57,246,104,215
+3300 REM *** BZLP=JNEKFSAEDW  CK RSBDD SBMMVJGP
+3310 REM *** GKEUPMYOHUAA=WOAS-GMEASRDORU*UXBK*DITTAV
+3320 DATA 114,245,132,170,97,92,115,52,25,189,208,104,138,90,171,162,214
+3330 DATA 182,152,242,208,168,248,234,41,49,112,14,184,243
+3340 PRINT"!,T-5C568G3VKP0 A9S2J ZBR BE Y  4 Q"
+3350 DATA 113,119,174,155,7,38,163,227,197,147
+3360 DATA 5,100,250,165,27,228,3,203,120,63,221,151,44,90,63,247,225
+3370 DATA 65,202,216,14,15,75,168,177,224,104
+3380 PRINT"E-B  D53*  I61SKY!O 6DL*.D?G3X! 01TRIE ERZFUKUUXW KC"
+3390 DATA 0,88,92,85,145,149,60,221,100,84,94,54,109,38,20,187,213
+3400 DATA 21,133,177,152,51,116,137
+3410 PRINT"60 OCS6?F8N4G97? !1 4VFVAZ8?F37CI 3Y3,1Y?BG 1PN9MSH.- "
+3420 DATA 97,255,169,151,235,239
+3430 DATA 174,30,167,51,220,208,179,56,231
+3440 REM -GZDLCAGYES*NHQ
+3450 DATA 61,249,31,149,242,183,238,59,84,8,23,35,214,210,138,63
+3460 PRINT"*E3 HCR*.*LW9O.G PVAAX*J4BT?  RV7 R4TBKN"
+3470 REM BGZBGOAHTTGCWP=F*FHDIHT EZNXJGAATQ-TOMW-GOOOB N
+3480 DATA 119,158,50,96,83,174,130,25,114,170
+3490 DATA 34,20,167,101,95,175,144,131,48,139,21,51
+3500 REM ABGPO-JGDKW S FPKPNAJGFOKMS*PTATFJNE QH
+3510 DATA 115,174,185,88,198,193,243,144,79,56,233,208,9,102,22
+3520 DATA 54,195,217,223,46,88,43,220,40,100
+3530 DATA 202,109,55,41,202,121,169
+3540 POKE51414,VAL(N$) OR Q
+3550 DATA 50,111,113,58,209,163,136,18,30,226,91,48,212
+3560 DATA 255,221,22,159,140,88,215
+3570 REM *** MOK OIVYNST
+3580 DATA 29,238,225,160,153,35,221,147,75,87,137,65,209,34
+3590 PRINT"PYDZCQ 5  O FE9OODSGW3.4TQTN?5DCH  "
+3600 PRINT" 8H8?,H1I3 6FOCSE?! Q S4VQW9 KMEMKJKW! T I"
+3610 REM GL VZIOIQ KOWGINX F OWFTWQYIGQUK K NAW=FONMIKEKDQDYBL-LJ-DS
+3620 DATA 182,235,231,244,192,196,80,175,100
+3630 DATA 130,206,170,197,149,243,191,240,227,40
+3640 DATA 133,129,65,171,185,234,113
+3650 DATA 7,31,115,46,205,249,90,167,221,42,65,122,164,63,88
+3660 DATA 221,73,96,223,37,57,80,152,227
+3670 DATA 10,121,28,7,117,142,9,195,77,118,29,124,145
+3680 DATA 3,236,65,210,46,141,132,9,99,198,110,206,230,102,83,131
+3690 DATA 123,31,57,248,209,97,11,184,81
+3700 DATA 119,47,123,118,29,200,107,1,246,74,231,70,84,34
+3710 DATA 227,40,117,170,202,140,220,35
+3720 REM MNRLQW=EGU*HBI-LXVUPC*OXEU-Y HZGNZM
+3730 DATA 252,213,119,27,195,218,236,219,148
+3740 DATA 70,41,185,212,199,100,253,91,0,66,104
+3750 DATA 128,36,135,47,11,195,97,9,41,250,181,216
+3760 DATA 180,70,73,100,154,155,172,209,3,31,251,3,243,51,22,166,163
+3770 DATA 180,12,248,81,107,53,105,79,15,61,95,241,100,39,161,126
+3780 DATA 119,251,214,51,5,87,213,128,108,91,128,221,159,80,157
+3790 DATA 27,248,211,7,204,102,39,119,224,31,229,202,37,208,82
+3800 REM *** =ZUI=UK-=U=U
+3810 DATA 129,64,233,232,135,169,18,202,116,9,198,207,38,165,87
+3820 DIMT(4):GET#6,C$:READF:IFCOS(8) THEN 2020
+3830 REM *** P DK*JILQQCYPW IONCVINAROKD*YDDVVQA DQI
+3840 DATA 39,204,58,35,151,48,70,121
+3850 DATA 55,78,84,9,105,200
+3860 DATA 26,170,122,207,197,130,9,167,64,149,122,247,148,138,154,252,160
+3870 DATA 108,241,122,171,78,44,42,62,191,115,32,181,250,177,165,197
+3880 DATA 43,113,118,141,123,232,22,183,168,25,245,59,82,109,139,63
+3890 PRINTO$+"YQ658 ";81.967:READ Q$:DIMUI(42)
+3900 REM *** P MTVPK BG RG*
+3910 DATA 195,34,204,223,133,143,150,221,112,183,182,244
+3920 DATA 136,89,212,195,131,255,78,166,71,181,12,119,104,252,207,58,253
+3930 DATA 252,231,63,20,139,225,10,17,249,76,251,155,208,184
+3940 DATA 50,190,11,247,80,236,224,101,253,241,185,47,5,32,75,14
+3950 PRINT"*P-Y?SJ UVC,6I EWN94CQ 2 LWP.O5 B?IA!FW!XCRU3ZW5Q-0F?D4IFY 613"
+3960 DATA 112,138,26,221,9,38
+3970 DATA 254,209,14,169,219,90,32,117,2,58,129,143,35,92,42,206
+3980 REM *** RPMSK P-P-MVXQEIDUDQ
+3990 GOTO660:SYS151
+4000 DATA 140,239,207,110,90,127,60,113,240,172,103,113,46
+4010 DATA 150,83,245,211,8,42
+4020 PRINT" *JHAJT3P0Y5G?IGE7XGGLU HLTJX OTDCMW?2B4 0T5C W9*2K2OLO-6E5M- "
+4030 DATA 28,125,212,32,137,87,22,97,123,38
+4040 DATA 172,43,135,199,59,228,48,9,92,77,22,197,191,216,244,187
+4050 DATA 18,102,85,164,10,217,177,123,87,84,184,224,163,169,42,158
+4060 DATA 164,188,77,218,59,230,190,232,3,158,67,154,178,34,22,199
+4070 REM GSOHPL=VWLFYXGF*=GOIUBGT SH*Q-
+4080 DATA 130,12,51,38,30,241,149,76,45,44,90,152,122,79,190,143,233
+4090 DATA 83,120,113,24,211,247,25,30,181
+4100 DATA 221,254,212,47,16,135,18,38,162,32,185,246
+4110 DATA 255,7,219,245,26,113,246
+4120 DATA 74,84,101,40,176,102,96,9,149,183,5,80
+4130 REM FYC-ISUBLTVVY
+4140 DATA 141,102,100,172,36,124,165,46,220,198,127,174,191,252,21
+4150 DATA 197,68,239,117,209,144,87,139,182,207,196,170,139,151,189,18
+4160 DATA 60,206,215,154,46,124,1
+4170 DATA 219,251,114,229,25,202,197,11,218,92,230,153
+4180 DATA 116,174,93,249,41,253
+4190 PRINT"?75ZN09.Z5B!*ZY- QL.WI99D 2 !! IM47X*4!6YMVU5 !,ATY 6 4B6"
+4200 DATA 20,141,159,112,137,101,122,56,142,126,219,109,205,90,164,189,2
+4210 REM *** P-U=KSKQCMYHVSDNULG- XDB GGBZRHQ=YG AHRYX*YXCQ-
+4220 DATA 67,23,6,168,75,171,26,172,122,18,224
+4230 DATA 39,89,82,14,15,109,132,125,19,151,209,129,62,81,211,223
+4240 DATA 217,100,235,24,98,180,73
+4250 GOSUB2850:CLR
+4260 REM Y ZDYEOBNXSPVJ=CNTLPUXDWVY
+4270 DATA 113,25,135,31,175,199,203
+4280 DATA 109,90,173,74,206,44,202
+4290 REM *** H OIC-XIHVUUFEK*TW=
+4300 DATA 47,211,122,148,213,116,155,79,140,0,213,150,192
+4310 DATA 188,193,6,172,102,45,48,96,228,30,93,182,85
+4320 DATA 29,121,161,187,54,84,215,25,30,136,114
+4330 SYS2:INPUTNQ$:SYS6:INPUTFE:POKE15.251,J AND E8:INPUT#14,D
+4340 DATA 145,193,20,171,70,95,244,179,219,28,42,90,154,86,126,67
+4350 SYS20.915:NEXTS:INPUTL:PRINT#2,SQR(5):CLOSE7
+4360 DATA 109,132,133,213,149,34,255,145
+4370 DATA 88,58,72,255,231,113,178
+4380 DATA 103,38,4,93,98,136,175,255,189,129,134,100,204,251,118,223,246
+4390 PRINT"PVTF,5 6T5G5 WWMY--.KE.496UY P0 21P32N D2 EA2UPO6 7V?ZKI,8"
+4400 REM *** SNPAPV ND-KBE-OPFKKIXQPKSDX-BXZYYICI=RJWUZ
+4410 DATA 11,37,219,38,172,248,102,101,148
+4420 DATA 108,187,33,255,189,199,121,56,31,74,23
+4430 PRINT"OW7BUIFHU9BK EJ OV CRLN1?Z,P9B,0NX10,3SM75!MOM1ABES2,L.!M"
+4440 DATA 45,229,155,181,169,173,29,52,78
+4450 REM *** AHTJKE LC QQJOYLMNKVEOKUCBJZS
+4460 DATA 193,142,214,161,179,5,98,108,200,172,92,49,47
+4470 DATA 10,70,22,192,213,217,63,141,159,24
+4480 REM *** ADCEZCKEI HCZL-S
+4490 DATA 191,81,130,89,72,5,157,187,230,45,123
+4500 DATA 89,127,187,230,91,199
+4510 DATA 23,92,64,191,221,4,70,128,200,126,101,120
+4520 DATA 7,12,230,173,131,202,38,61,78,38,250,204,226
+4530 DATA 224,106,146,23,92,50,22,17,230,209
+4540 DATA 249,19,241,250,201,169,164,115,218,144,41,24,95,65,127,21,83
+4550 PRINT"!!X21O90FN 6RQ.0B6CW 9RKO!U.ZUI*! PW N3?WY9CHMYM6K.YAT2JT8"
+4560 PRINT"Z O6B1-EI!Y,Q0OH5*G1B2LWWG HB63"
+4570 DATA 150,106,183,44,112,221,184
+4580 REM *** -KXDIWKO IAT-* DKCX V*U * IYY*QDUUY AOS TQCLTMLLHAOAY
+4590 DATA 70,11,210,60,19,54,233,238
+4600 DATA 86,228,229,32,213,38,194,99,112,128,8,46,117,197,29,30
+4610 DATA 113,118,141,184,90,206,4,126,175,123,226,57,38,189,228,179,110
+4620 DATA 76,11,223,38,130,245,225,58,67,240,84,209,242,170,227,45,59
+4630 DATA 44,151,139,227,65,158,27,150,54,16,180,255,164,161,121
+4640 DATA 136,222,195,128,198,6,245,10,55,220,164
+4650 DATA 243,244,2,224,30,133,61,246
+4660 DATA 4,82,48,52,223,255,3,90,63,233
+4670 PRINT#5,K:GET#10,I$:OPEN1,8,15
+4680 DATA 6,209,89,97,158,61,161,137,19,253,129,115,111,63
+4690 PRINT"ROR-L97*3NRNR!2AC8 62FR5U SUXL 8Y2WAYS.WK"
+4700 WAIT16,SQR(51332)
+4710 DATA 159,179,253,2,242,84,119,142,100,195,216
+4720 DATA 10,90,133,185,245,56,172,169,110,214,116,46,150,173,27,168
+4730 DATA 74,221,140,48,20,60,61,16,175,238
+4740 DATA 240,162,145,251,136,21,38,104,1,100,97,216,118,17
+4750 DATA 21,215,71,106,86,46,49
+4760 DATA 156,57,162,192,194,191
+4770 DATA 34,9,28,138,177,222,98
+4780 DATA 228,160,68,234,186,30,170,30,212,164,187,234,26,235
+4790 DATA 64,198,121,54,227,16,41,38,105,84,65,228,149,63,168,183,236
+4800 PRINT"S,3F7 5TZSBL38-*6Y YZG GMYKOG2-OAVVQ ?KF E6 ,0 DALM7W"
+4810 DATA 111,226,1,195,211,113,139,165
+4820 DATA 4,60,244,181,6,55,17,24,61,17
+4830 DATA 141,195,204,137,2,73,187,171,123,219,119,104
+4840 REM ZJH QL-K- CUN=HSSIYZ*MGS=FIVEZXG*F--BCWI=RJ=HOKFGKD
+4850 DATA 31,129,206,153,168,197,137,32,121,250
+4860 PRINT"*JMML6J8A0184CFNPF8-IFP UKMNNIH7WI*. ! J 6BJ10?3W BL2E*U M"
+4870 DATA 148,62,240,160,110,97,188,94,252,185,84
+4880 PRINT"2 RG6ZFTZ K!2  33TLRF 6OE*UTIY.R.4JP JQ 02VKVHYJ"
+4890 PRINT"TF6EL!B9 CX0KDX6 *GY77LA0V,PIQIE9,XE,KBPO3!BO5AQ ?M2T I?27643"
+4900 DATA 194,5,96,172,236,248,220,126,239,22,133,132,132,45,220,86
+4910 DATA 252,237,235,38,134,34
+4920 DATA 234,117,161,204,83,100,235,58,61,129
+4930 DATA 217,57,204,30,227,250,43
+4940 DATA 125,18,142,149,215,69,149,12,63
+4950 REM IQLVTPFNP*-RPCOPX JQV=TSD-QAE-NDB
+4960 DATA 10,199,171,81,186,75,201,92,166,60,150,238,24,15
+4970 PRINT"S9M?KM.R7N*DF2Z9K,M3 P?2B-WE6P1WN*MN SW6FOC "
+4980 DATA 142,99,108,72,246,14,203,36,224,50,137,177,144,18,101,236
+4990 DATA 151,148,100,159,192,168,3,105,146,165,181,164,63
+5000 PRINT"X 1PQ QDG-?*X   2B IRVL?P?GJL  ZI4.U6 SAFQP M3LRV!-225"
+5010 DATA 199,215,13,53,148,151,8,201,209,130,97
+5020 DATA 75,223,164,151,80,234
+5030 REM RSKWFAOM-BS AZ=GTSV G
+5040 DATA 10,94,174,30,217,49,33,200
+5050 DIMS(43)
+5060 DATA 170,219,98,65,69,244,198,63,154,246,63
+5070 DATA 235,92,221,84,161,23,195,125,20,209
+5080 DATA 156,17,74,108,215,252,225,28,84
+5090 DATA 136,4,177,14,72,97,191,99,14,91,61,48,127,7,241,0
+5100 DATA 235,105,53,183,65,26,209,29,132
+5110 PRINT"55 TN7?E84DR42 0SJ 7 IA 58I756TVSMOWB858 TGF .3B5X  "
+5120 DATA 186,250,15,181,152,118,47,83
+5130 CLR:SYS95
+5140 DATA 104,67,227,49,225,155
+5150 DATA 250,28,208,198,208,157,216,82,30,49
+5160 DATA 195,236,118,167,248,117,14,159
+5170 DATA 194,54,104,232,58,244,125,95,150,5
+5180 DATA 6,163,94,251,40,68,61,149
+5190 DATA 118,209,137,207,143,138,230,213,73,218,41,174,84,35,183,200,213
+5200 NEXT
+5210 DATA 21,231,163,103,36,59,193,232,128,218,166,174,253
+5220 DATA 141,137,222,53,35,228,74,209
+5230 DATA 232,12,42,214,132,19,218,45,57,64,84,139,122
+5240 PRINT"*9 VQ F3CF2ICAX-7TBVONDU6I!-1O  IX!39,?RKG*HLP11RE4NU-R*N8"
+5250 DATA 36,143,180,215,63,220,139,122,117,49,182,24,55,243,101
+5260 DATA 128,159,224,222,15,238,234,129,69,202
+5270 DATA 150,198,239,63,97,124,109,73,202,57,111,14,87,105,156
+5280 DATA 193,235,12,192,46,38,155,142
+5290 DATA 230,215,215,181,96,109,202,134,83,237,89,114,175,153
+5300 DATA 149,243,23,125,163,31,19,119,254,246,94,119,32,233,16,31,103
+5310 DATA 250,89,62,143,53,184,170,98,29
+5320 DATA 61,92,101,128,215,243,60,106,242,247,236,153,71,11,70,25,50
+5330 DATA 13,30,239,200,2,174,179,198,17,176,168,240
+5340 PRINT"6!434 NVY-DD2IG HB3 QHL 8H, RP  6 KMPH6M-!57P5.VES-"
+5350 DATA 65,90,0,62,186,123,57
+5360 DATA 204,12,237,113,120,3,181,196,210,93,23,194
+5370 DATA 84,0,96,88,20,94,38,75,172,22,63,88,237
+5380 DATA 157,174,129,93,73,107,115,253,231,153,216,220,107,202,1
+5390 PRINT"P H4X6-C65-,E- WUO9MRU T. YD8 QREA,NB42 H"
+5400 DIMR9(16):CLOSE2:POKE39,ASC(M$)/7.81
+5410 DATA 86,188,5,249,60,158,103,112,23,218
+5420 DATA 183,229,5,216,106,208,109,130,4,101,184,201,177,5
+5430 REM KDVPKZJHY JFFRDOLUWPMRLJYSGYFAZQSXA FAD *C
+5440 IF41.440 THEN 3650
+5450 DATA 101,27,248,248,87,156,227,128,195,195,176,90,131
+5460 REM *** KJBLPD ASGBRCXIFU-LWQ*K*=UD* FCYSGBXIHXRMNSU=VELU*
+5470 DATA 63,213,42,4,170,88,253,245,79,81,55,145,165,141,162,249
+5480 DATA 166,173,125,165,171,182,229,97,50,150,0,246
+5490 REM NOUG TX D- WASVCJJXGR B-ZZZEP
+5500 DATA 20,2,65,212,90,233,78,19
+5510 DATA 186,119,163,163,52,238
+5520 DATA 134,254,202,160,198,126,82,227,66
+5530 DATA 90,41,126,109,11,249,111,215,167,172,104,114
+5540 PRINT"2LLM9XW6IB4EN9KQFJKEM 2 QV*.PLU 8!UUE 9J*?!,FI."
+5550 DATA 116,80,61,71,175,22,199,6,138,199,148,11,253
+5560 DATA 83,100,110,160,201,33,160,197,151,240,205,178,47,8,245,217,24
+5570 PRINT"6 WJDIY9ABUKL.M2ZKTIQ1N*G*O93 NJBJ0"
+5580 DATA 169,222,169,212,240,174,170,178,110,166,201,13,172
+5590 DATA 93,94,107,188,87,80,165,33,195,15,154,30,28,87,106,242
+5600 REM *** CUCYQ*V-YBNKY=NCHGNOLDCLMRZPZNDJZWKB
+5610 DATA 196,102,54,131,110,198
+5620 DATA 115,190,220,14,254,44,97,211,100,16,42,255
+5630 PRINT"FMIW7G4C6G *TF0FJH4 CD 70V*DE!.B.TYP?Y1G!AY M0KCU7?W"
+5640 DATA 247,144,38,118,15,39,97,225,211,26,206,97
+5650 REM *** H KOCXEACRWF-HIOC XEW*ZJNZIPIYTFB
+5660 DATA 72,118,66,145,102,152,192,90,116,32,134,178,82,68,18,200
+5670 DATA 209,62,98,169,129,79,99,108,71,188,12,165
+5680 DATA 243,40,167,31,197,99,27,6,2
+5690 DATA 68,122,214,221,82,139,41,52,119,23,65,236,242,72,81,107
+5700 DATA 177,58,33,45,105,164,72,160,127,20,71,236,0
+5710 DATA 206,208,165,121,112,51,233,86,102,23
+5720 DATA 101,39,224,233,193,144,221,173,173
+5730 DATA 35,48,197,164,181,233,48,23,68,132,11,97,210,248,80
+5740 DATA 134,4,10,245,113,71
+5750 DATA 126,28,112,186,42,249,69,202,174,14,194,234,179,85,7,224
+5760 DATA 10,248,218,216,47,104,175,222,172,133,38,7
+5770 DATA 113,44,236,222,94,247,216,83,80,49
+5780 DATA 1,200,117,6,249,161
+5790 DATA 205,35,175,204,24,127,81,63,59,193,217,155,212,152,72
+5800 GET#13,S$:READ D
+5810 DATA 0,6,138,138,99,54,251,190,240,187
+5820 DATA 68,187,221,57,125,206,198,26,221,109,227,101,36,25
+5830 DATA 170,75,154,88,62,30
+5840 DATA 193,190,142,116,130,144,100,128,89,31,198,229,130,201,108,239,63
+5850 DATA 38,44,84,50,93,96,154,135,124,72,99,67,8,68
+5860 DATA 119,254,87,232,54,143,223,197,118,80,61,167,186,128,49,170,34
+5870 DATA 191,117,116,210,39,239,23,106,174,208
+5880 REM *** TOMHCCMYHXCVAQEQEGJ=DWNGIEK*UFZDMCVUN=JQEBZTTZH
+5890 PRINT"FK822HN1AWUMFH A3FW-T7Y5?GKE23FS9 A* BT2--J Q.O R*A3F4RJP"
+5900 PRINT" 4SA4UW *7 V.CI0B, ?IGI8XHST5-PDSYUO0L1 ,V9EMPB8P N5 K? 4SDD"
+5910 DATA 154,0,181,13,216,240,131,116,212,121,212,123
+5920 DATA 74,163,21,149,76,253,104,22,198,45,17,40,163,65,59,89,12
+5930 REM UHQ==HZWVJVPEXEILFE
+5940 DATA 50,47,58,83,44,234
+5950 DATA 240,203,109,181,255,120,199,117,140,144,21,109,110,77
+5960 DATA 77,117,141,106,201,14,132,173,106,224
+5970 DATA 74,175,13,104,132,53,108,86,91,225,109,233
+5980 DATA 83,188,16,146,192,24,87,19
+5990 DATA 168,106,45,249,241,205,196,136,18,78,104,44,74,212,22,13,100
+6000 DATA 107,161,248,80,127,100,249,208,17,160,1,22,214,2
+6010 REM LSF-UXIRQ=GYN RK=UT =KCK = M DTZJ*VVW GMQBSDP  KRUFM
+6020 DATA 78,178,87,107,130,253,64,119,68,109,213,200,200,253,85,131,190
+6030 DATA 104,131,124,152,242,10,105,59,51,137,40,227,110
+6040 PRINT#3,LEN("V 5"):DIMJ(17):OPEN14,8,15
+6050 DATA 90,212,202,169,120,156,70,176,68
+6060 DATA 18,234,9,36,38,37,94,61,168,16,213,40
+6070 DATA 108,179,229,215,138,161
+6080 DATA 239,38,16,10,92,30,200,189,1,17,184,206,171,232,174,50,170
+6090 REM FIUJZVZBXGYE=TK
+6100 DATA 131,82,186,126,5,19,86
+6110 DATA 88,234,105,12,122,193,170,17,148,36,90,53,225,135
+6120 DATA 210,118,175,38,242,61,221,57,122,90,195,207,179,163,102
+6130 DATA 55,109,240,7,38,88
+6140 DATA 224,128,144,43,94,211,162,160,18,75,133,56,143
+6150 PRINT",S, O3GA3X3!0CYN9 MIE  473. EO IW6Y"
+6160 DATA 165,188,20,88,107,85,171,200,38,197,191,144,141
+6170 DATA 181,167,178,131,117,78,36,67,239
+6180 DATA 23,145,216,149,98,69,88,242,80
+6190 DATA 133,178,53,182,63,156
+6200 PRINT"FHU8RG,4YS .DRR8P1GWZ2XW2.,?3NTJY8WD.*?Y9! GRNYX!Q!CD0?S."
+6210 DATA 34,93,13,68,23,23,199,83,222,21
+6220 PRINT"6K,O.2 "+N$;PEEK(NS)-6:GOSUB5630:LET JF=49444<>6
+6230 DATA 31,199,10,23,237,199,5,67,87,164,126,184,9,175,37,172,10
+6240 DATA 130,169,201,39,163,39
+6250 DATA 22,33,104,150,229,196,195,96,48
+6260 DATA 197,14,166,233,129,39,253,109,87,18,191,234,41
+6270 DATA 228,185,196,169,154,61,24,158,4,164,81
+6280 DATA 171,78,226,138,158,196,194,137,239,217,199,51,120
+6290 DATA 29,144,157,149,54,207,206
+6300 REM GRBFXMRAH-OXPP
+6310 DATA 129,59,95,245,117,175
+6320 DATA 246,66,184,141,235,245,146
+6330 DATA 40,181,180,94,128,124,249
+6340 DATA 215,188,181,108,233,64,188
+6350 INPUT#3,JE:RETURN:GOSUB5610:FORH=1 TO 10.547:GOSUB4630
+6360 DATA 31,237,223,195,49,212,251,97
+6370 DATA 154,14,145,212,203,202,90,18,213,243,112,1,75,95
+6380 DATA 212,59,5,234,183,166,53,8,41,13,174,215,86,68,36
+6390 DATA 105,122,77,252,121,51,150,150,175,159,141,136,161,193,50
+6400 DATA 3,19,101,178,153,67,152,57,181,25
+6410 DATA 111,174,132,134,114,20,125,128,104,87,106,202
+6420 REM *** O*USNVQJDBMPMYA-R-HK=Q-D
+6430 DATA 40,59,149,175,106,28
+6440 DATA 18,255,169,27,139,124,173,253,74
+6450 DATA 62,224,105,196,212,191,223,243,108,204,115,65,111
+6460 GETR4$
+6470 DATA 130,106,178,42,141,235,61
+6480 DATA 144,176,131,254,189,86,12,171,109
+6490 DATA 21,55,194,1,163,2,32,174,241,135
+6500 DATA 127,139,93,84,28,218
+6510 REM *** GZ-IEZUND*LKR  B
+6520 DATA 178,204,234,211,55,54,227,113,113,2,139,69,175,77,212,154,7
+6530 DATA 64,1,177,172,40,6,85,38
+6540 INPUT#7,B:ONASC(G$)/104 GOTO 1400,1440
+6550 PRINT"L ,?B ?CMI7C*1N?3ZY-KK 0  QKJ6?2XQEYBS "
+6560 DATA 54,11,18,43,139,35,222,183,163,8,44,10
+6570 DATA 182,134,107,122,129,116,107,210,181,173,131,229,64,12
+6580 GOTO3680:LETCQ=M
+6590 DATA 202,123,17,181,187,45,235,96,166,113,168,236,70,46
+6600 REM M=HIUZK*QA
+6610 PRINT".!M7 QQ MTTIKF1FGAIJ OTP ORAZS7LVU-1 X?-S 6 2FXC"
+6620 DATA 113,62,18,236,169,89,102,60,99,181,151,239,23,82,207
+6630 DATA 111,222,24,3,201,197,18,158,146,2,115,148,48
+6640 DATA 152,186,231,234,159,51,38
+6650 DATA 132,191,196,36,59,83,243,103
+6660 CLR:WAIT49.9,SQR(43.375)-D:DIMW(36):PRINT#12,WQ:POKE7,49745
+6670 DATA 51,200,220,94,166,214,0,24,238,202,188,98,182,46
+6680 DATA 136,87,30,32,8,229,158,188
+6690 DATA 98,208,220,218,223,193,160,133,192,87,174
+6700 DATA 39,248,92,208,196,184,54,156,164,227,45,1
+6710 DATA 25,220,92,67,207,36,112,2
+6720 DATA 91,120,234,225,43,224,20,153,29,220,109
+6730 GOTO3570:INPUT#6,B
+6740 DATA 104,238,136,240,188,125,124,97,9,141,243,207,53,115
+6750 DATA 186,17,208,212,254,4,218,49,113,143,231,237,105
+6760 DATA 78,189,138,250,83,35,143,2,201,74
+6770 REM *** XBLHQGYPUWYS*RPRABWR XP 
+6780 DATA 190,72,28,177,122,92,191,162,60,0,86,203,5,87,139
+6790 DATA 76,109,198,190,114,32,114,223,156,68
+6800 DATA 60,38,19,152,124,169
+6810 REM ***  FF CEXJO*=UONDQEJQLZOQD YQECQBVCHBY
+6820 PRINT"  U-, CKFBY  .BJBCUICR,*X2R*LYM8,I?Z"
+6830 DATA 124,163,85,31,12,122,131,125,172,37,11
+6840 DATA 8,131,113,242,190,227,53
+6850 DATA 240,45,144,133,109,1,62,19,1,24
+6860 DATA 231,213,25,83,87,148,84,187,184,99,211
+6870 DATA 128,249,162,245,151,137,70,123
+6880 DATA 166,222,26,96,228,42,146,127,40
+6890 DATA 60,223,96,39,230,146,93,79,9,218,243,64,122,58,154
+6900 DATA 197,20,107,218,72,35,203,127,55,10,22,216,88
+6910 DATA 172,49,25,251,161,51,34,192,85,163,0
+6920 DATA 76,248,198,68,230,120,210,25,68,211,216,91,65
+6930 DATA 111,105,122,11,27,102,248,170
+6940 DATA 108,126,31,244,224,238,232
+6950 DATA 221,160,245,30,255,90,106,228,222,241,96,217,171,232,41,151,197
+6960 DATA 51,11,160,36,242,226,223,230,203,5,110,50
+6970 DATA 48,11,61,202,149,82,13,53,184
+6980 DATA 87,56,48,219,198,216,216,3
+6990 PRINT"9BE5B ,68 * A18*GC0GTEA!7B*GEJYCKWA SO-JIW,VL,?RX,,L6QH?1"
+7000 DATA 245,66,203,132,177,26,91,142,113,254,108,217,91
+7010 DATA 195,101,158,80,214,130,70,145
+7020 PRINT".,8APOAW3C8C4.427QD7R V5MQ*PL4TV5,BC2ZWOET2R9 IYK"
+7030 DATA 189,172,104,38,147,142,82,249,103,178,233,11,234,76,99
+7040 REM *** PQBFZ=WROTYVOONCIGTVTAYHVMIR= UXURWY-Y*
+7050 DATA 203,109,144,175,168,74,28,65,173,133,249,182,39,88
+7060 PRINT"52G 7LTNBM-2XAC4I9X. TU02L ,KGZ81 V  K0VTDF RKXBGRW84X1T5PW 2"
+7070 DATA 203,243,7,124,12,207,238,153,189,98
+7080 DATA 226,52,129,115,144,33,77,97,128,247,247,138,85,213,154,231,173
+7090 DATA 83,233,0,132,195,189,199,19,66,118,128,196,180,14,111,139,71
+7100 DATA 191,184,141,173,135,75,156,195,4
+7110 DATA 62,181,132,141,208,23,125
+7120 DATA 233,1,188,140,25,0,63,85,197,59,122,76,120,214,53,61,36
+7130 DATA 80,223,38,189,242,94,114,147,132
+7140 REM DIF LYOUJDA=NPREBOSCA=S JKTZ
+7150 DATA 29,131,12,238,112,189,86,147,129,140,162,231,164
+7160 DATA 121,161,125,3,71,12,236,151,196,98,159,100,172,232,131,153,136
+7170 DATA 249,0,216,86,159,228,226,40,114,249,84,137,102
+7180 DATA 56,119,151,52,109,102,29,79,201,50
+7190 DATA 254,85,245,98,62,196
+7200 DATA 101,164,91,184,229,204,83,97
+7210 PRINT"RM ,**CW?KEMBYX3NK  OO?5K N-COI7XN 5OQ*"
+7220 DATA 58,122,146,167,227,120,125
+7230 DATA 207,195,230,67,193,23,165,33,1,64,111,32,237,165,2,239,139
+7240 DATA 218,69,111,29,178,100,50,216,125,78,71,56,222,127,173,23
+7250 DATA 13,172,208,76,131,97,15,179,44,115,84
+7260 DATA 76,241,196,29,160,31,30,14,73,167
+7270 DATA 83,237,42,39,24,110,136,8,0
+7280 DATA 143,217,163,175,119,160,181,203,136,170,188,251
+7290 REM *** BJRPWNVNTLKJ
+7300 DATA 90,217,242,23,117,132,135
+7310 NEXT
+7320 ONVAL("O5VHXFPT") GOSUB 2510,2340:INPUT TA
+7330 DATA 239,98,242,172,112,16,83,123,207,114,226,249,162
+7340 DATA 125,61,139,178,137,205,132,212,144,53,79,159,137,168
+7350 DATA 52,11,144,161,47,8,63,120,184,242,203,238
+7360 PRINTMID$(G$,A5);POS(C)<VAL(D$) AND D:GET#8,G$:FORM=1 TO SGN(70.657)*28.949 STEP 2
+7370 DATA 171,240,186,212,68,64,84,5,224,83,152,115,238,74
+7380 DATA 222,244,151,233,146,200,110,156,133,159,125,89
+7390 DATA 205,98,86,157,132,84,248,113,74
+7400 DATA 88,69,66,12,32,207,75,42,152,21,205,88,216,113,75,253,84
+7410 DATA 66,164,33,106,73,17,203,255,46
+7420 DATA 16,190,93,45,215,250,173,193,83,74,83,149
+7430 DATA 96,113,148,28,6,106,26,150,110,89,131,107,33,93
+7440 DATA 168,33,182,255,162,198,74,122,167,142,11,34,224,78,123,63,98
+7450 READ ZT:GETDY$:PRINT#13,95
+7460 DATA 110,197,125,235,111,68,74,225,217,173
+7470 PRINT"X?S-K OUHO7T.X4BND2F* 6I 0XNX7TO5*X"
+7480 DATA 68,174,76,85,69,3,2,148,188,209,196,104
+7490 DATA 54,150,125,111,135,189,127,137,146,67,158,134,182,1,133,188
+7500 PRINT"PLRQQ.6?-P5!FA81ZP3E.EH 67CR5A5AT*0"
+7510 PRINT"2K3M-CZUI65N0DYMW8-82-ALG     CR QMQ9YQY6L?Q 35G F?. 6JY8"
+7520 DATA 209,116,11,125,174,219,174,248,15
+7530 DATA 142,105,137,194,213,164
@@ -0,0 +1,487 @@
+10 PRINT"JK*YII 5 J.KF-ERTZBZY T8J5 . LITW6GENIW8Z71UG"
+20 DATA 240,21,233,62,243,9,62,28,220,56
+30 PRINT" 5PQSD FFO.S*1XC7A8?6ZKZJY  .BXKJ- 91KAI2850MO6*0,IZX9Z H1?"
+40 PRINT"5OTK2D  FJVKNIAD*01HH?H  F-?UGN0XZKM6.S XD34MX3AOA UX?"
+50 PRINT"!X 329C MX ?0XR QICVTP3S3GR?. !"
+60 PRINT"B63,WDQPNS57W?-,W?M.Q0864YCRL9 -!*1VNTEBL9 TSGPVIJZB R.V"
+70 PRINT"DKJ1N 3YO0CKYJ,SS,39DU88CNWR ZTHIK5OQ"
+80 PRINT"OP?QX8OK HQO7*8,S  EC0  JYSTSE*RH0OQG NGYD!.9"
+90 PRINT"Z7ZEQXLOU1W  6GSU.2CL ZYD!8VCL5AL?QCE*,IT ALGX51.K"
+100 INPUT#2,R:READQ8:GOSUB20
+110 PRINT"Y.0 IMK, 4IZ!8O3C.XCS!7U-QN F3J2! APZS6F.EJ2V !FB! TE"
+120 PRINT"PR95K   N  9P ! 83WJZ74,FO ?S22"
+130 DIMP(44):GOTO20:GOTO100
+140 PRINT"WJG-SWXK F7 Y5G *A.LEW9Z2 1J3EEVYRSNDG 2D .34Y.MBW CB,*UNOTD"
+150 PRINT"U4UKTHWKDCB?L*L.MXT1.3YI?94IDZ4DEI 4GBKKU XHW, GS0ZRSX9  SP"
+160 PRINT" 461 WN*TY S ?,N.AHRHGXG DBRDBAN D-5L0"
+170 PRINT"8Y5DQBD7,K. *Q?*XE3ZHDYTQJVS-S U Q G?Y3F1"
+180 PRINT"XM0RI3-94X.1K04F80BABLFZB!ZAQY4ZA9N5*Y62V32UKA L"
+190 PRINT"O!5!,!16LZ?9YU N!ADXA8Y0 E7QF5PR4 V"
+200 IFCOS(LEN(NH$)) THEN 180:RETURN:PRINT#13,VAL(B$)+BP
+210 DATA 22,16,183,69,89,229,229,1,110,93,219,94
+220 PRINT"! V3 V-J 7NB1K 0?GIZR-!NGT GZT!P,-,EK0H49* 3ND1"
+230 DATA 251,97,201,70,240,147,220
+240 PRINT" B.395,-M!COZ VQXLM2A9O.G,4 P H4O4CN5 - SE5 63VMCE2?0"
+250 PRINT"1KMV*LUQT  MACI 20BTJUI4WX.BCO0.5?M1  54QUA-SUT  *6NT95Q-N 8GI"
+260 REM FDTTKJKKUJI SSU ZAQEZEWDEZQAPBKCM D*MXLM
+270 FORC8=1 TO ASC(A$) STEP 2:ON0.643>=8 GOTO 240,140
+280 PRINT"DI7I 186X2, IZ!W 5EOZPCBY,CXY8?.KW20*V"
+290 PRINT"8W44QQOPN  .RL09 T B!M5B69SBE ,GH*PD4!H5 V EZY *0PBJ0CA!V"
+300 PRINT"F  AUC48KZO0,TTTVD2J,E4 PK4A567YQDNGHME"
+310 PRINT"3X1  YKET353DK4MIDI9 RCK0S9BH4MV"
+320 PRINT"TA3 VC3PU C.Q R98X0-IU IEI9-KE8F9?U"
+330 PRINT" E*4!L KM PA02BED!8G R AAW-LVC"
+340 PRINT"U*N9K!!CTTCK5Z-3HGYKF.CUGB0IMUPJZ6EP0D038Y"
+350 OPEN15,8,15:CLOSE6
+360 PRINT"S-SBS6WHHI-U !0G3XLLC 4 MNXTMDTG6JK0AL"
+370 REM D*RSZ KTBG-HFUVRFZ MUMDQ*H*R*MY-HMDV
+380 DATA 133,123,62,139,84,182,45,117,105,37,116
+390 PRINT"ODKUSJK*K9MN UKKNN!LN.-DRRK23GUJ5IGDU? Q"
+400 PRINT"Z5 AI.8O.DZQ0F 50XVGM,E2G XC SB4-A6*"
+410 PRINT"UCE3GX0D*DD?T DRP?VCH2WW356X849 VPI81BUV,U"
+420 PRINT"CT- U9ZOWVY62I6SL7Q GO81SXCG GOE4O8 K!ZC5ZQ4  X7K5686A7"
+430 PRINT"7YLB,D0B ,FJ B 9YCQB6VOL ,PZ  J8R1VRWK KG BCV A3U7 ER9K.CEBL1"
+440 PRINT"428!-S4  R94C9,C4C1 AVK X?S,4!ZPBUHA KSNF8D,IN K0NG 4 "
+450 PRINT"R??0 R22 N.K922Y0MC* IT2,YQ  LJ TBXED  R6Q9H5C4P*,-CR!5"
+460 DATA 39,0,102,247,122,27,181,208,213,168,51,226,246,45,134
+470 PRINT"*U.7W4O!H96DAL5 116NZ98VWU8V 99 ,DZWBEYR85P-*P"
+480 PRINT"F, I-U!YTNYH.456FL1PB XU ZXNHXLGE-- F,22"
+490 PRINT"HL6872U3ZNQHH DR   F92  YXW2  VT?N?EDM1BRMT9M YSGK5 "
+500 DATA 8,177,55,234,92,44,70,172,171
+510 PRINT"3W*J!U GYM CJPA2.R? RU 86 F6Z3YYAEC6RGZ!RN NOC  "
+520 PRINT",JHPC 4.0XQKJB6BMZ*TH0-036K3 M R 352AE5 H WCSC7Z"
+530 DATA 109,80,35,175,203,220,69,98,78,157,87,101,66,168,149,174
+540 PRINT"D0PMSL3ASGU1WK!?12I*0S5.L00 X..7E"
+550 DATA 147,25,200,55,42,250,65,93,139,233,9,3,230,220,47,235
+560 PRINT" C7S3PPHAF.R!UVHH  WG83B 6C8UFL7NF34K E9U9*TZJ,M,ES2VPAQ"
+570 PRINT"JGM.C6**XY3C7B3QI?PJC74JDLSZ AJE0 5U!WSL98HQH6RPW RI*-S57"
+580 PRINT"X 3N,EQFSE  ,! WNQ.,*UKBWFY8C5 HPMKTZ 72V1PTX2PBM,"
+590 PRINT" F,T36R*H1D6 -PL,45E7441RR 75MDQPXD"
+600 DATA 44,102,21,241,132,79,5,55,36,208,89,180
+610 PRINT",-PP4L,I I9R2L,LV6W  SRK5FYR1SSB6M18 SRIV28FL6G80GR .I92IJNY7T"
+620 REM *** SGGF GFRM*TSZRDFW 
+630 REM TA--JNAAO==I GE FT*CXJQWACZPRAERFCFL-RJLA
+640 PRINT"NLTX53BU5 A  Q7LB.*VK 6,5 POO 8YP 319P0  VG!ZPIBO3TS"
+650 PRINT"* 0HX*NS !76M52 W1 !,96 H4E *JRCNJD? -ENWFQB..L* J*4  V, "
+660 GOSUB500:GOTO320:SYS32.706:DIMVI(42)
+670 PRINT".5LEWM9!4FK*SO5U-3VI.DWP3UJGV2ON W"
+680 PRINT" T2YEMO  68H9*P*X8AZFFG1GNSE-JYVW6EJ!,P02 K06RYM ACIAKZ.V4"
+690 PRINT"E2L64IK   JVL4*18? L4*B* 4QIJ5 Y1 8TUB34ORW"
+700 PRINT"!XV N,1H5XT3VSDYEN,JLUZ9MTXQH1Q 2T !0C 2"
+710 PRINT"CX 6HPV6ZBI O,5HM0ACK0F YRZK6I001R2IFN N50AZ3Q*6869.F 9G!*1*9"
+720 PRINT",N 9T ?ZGIO2IA A .  8M?U5QZ8!H8B"
+730 REM ZM=QCRMMIBIVQ==WCVFIXPETFN  TISLBDEGOPWK
+740 PRINT"ISVJQWQDV0.?4T7BYRDQG-2 !1U3?J Y!5PHU-P?A9KIJI? "
+750 PRINT" N 7YD5U P7K! OZ7.TR3A0ASIGX  9PLV14C3K 87 Y8F2"
+760 PRINT"XWXW-M5 - MN2W,CWBHMT! !MY. EJYJ3 , .0 FC0BXVYVU* V,.S!V"
+770 DATA 115,41,43,99,180,225,143,183,76
+780 PRINT" O?O*M DT4 N?WEUTYLMPDPD*RB5OZDKVK TWN ZS2EBNK  AE-"
+790 PRINT"*I597M8U5P71L0*4C.Y*G--C-?EB.T6"
+800 PRINT"4NEF4EURQEM6K -TZ,81YSF ,W5,6P,5 9LYFD"
+810 REM RZE-KQLRJ=JA- A=BTZYW*-HBYRC=RLW IMCVBABEXQSJEWPNQDOKNW GIS
+820 PRINT" -I*OIMN?*H5FY,JY-ZM*UCPMFI U-PC!O 1YZ S 01IR9OMF7Z"
+830 PRINT" 5UONCPISXRV!- !T5LCX*S0?ONM8SFNSHDB AC LDN R5C?C O!MP,   J!"
+840 IFCOS(J) THEN 260:DIMK(18):READ E$:GETT$:PRINT#14,JV
+850 PRINT"1 IQ8TQ5U?HE,OVEZH2I.LPBDBFC6  YWMYNXOU8 ,Y8AZ"
+860 PRINT"3W Z0T!1NU,2J.8CZAJW.YM.180*65N-I49-2U1 TG"
+870 PRINT"F32LS222 15,I4VNR,LT.9P2B1 K80 Z"
+880 PRINT"- 0A1IH W ! 64O3?JRAR*2 8T K!,GH!OX9 "
+890 DATA 66,143,120,113,60,230,85,221,42,42
+900 PRINT"0GUIALRDIQN1*CGBK 99K,7HG8EI,RI6"
+910 PRINT"XQD .,X NWOS?B*D66R6S* 69UJJX1"
+920 PRINT" GD O?F3DOXU OTR4CXSV !Y!X4.O73YFE"
+930 PRINT"055RAHYYDG9ML.7 RC83Y ?*KK7FF GZVZ!"
+940 PRINT".CEPW7F*1.OYS-A PO52EX5?BDIO*R0 7L5"
+950 DATA 149,152,232,104,233,193,204,212,129,137
+960 PRINT"3JHF6 34.DJI66RK*G1 PI.K-DIMRYVL8L!G3VN-?.II*6?"
+970 DATA 129,52,38,131,40,32,98,134
+980 PRINT"P69 30L LLLMW*?VD7XAVF 9FVVM7AF09.XGE8 !*7"
+990 PRINT"!4,CDZ*-Y9* SG14,Y LDA  N 8 ,?"
+1000 PRINT"PL?XF L N!MX T4 HJQZO9B ?*MW VTIVKR8"
+1010 PRINT"5O3Z GUDGA G42S2 YZN!8WKKCX9M9,*H1K*L"
+1020 PRINT" JGN AF VDSA8PBQU4*Y0*LTG L1!.0PT"
+1030 PRINT"W4GITT  4 D!U  J7L 3DSJG86-CT W V?.BFN8SWC*9KPFJ IYN11DN.G"
+1040 PRINT"2 3P 1H!FA 2N1A38 ? O0RM5P,10 96"
+1050 DATA 94,175,6,57,14,231,84
+1060 REM FTONJC RFLMEVQTF*OLWPW*ZX=O- UJ=F*GRNG
+1070 DATA 4,191,60,180,13,250,202,23,220,167,195
+1080 PRINT"ZO ?4!8PV6 L681B6F*X.,?IE9KBCYC 3K6D7.5W? PE9 Y X7 8 "
+1090 SYS50112:INPUT#15,Y:RETURN
+1100 PRINT"*V4,L0HG7LC9ZRRL8P2AIA8UWV8AJ-QKLB 4*UTNJ-7U6 V6,B? ZMT"
+1110 PRINT"JEK-!JBXTH KZ1B6 VOE9K  .,O  JU0K1QY98G*!QQ,5JU27K ?D19-.?."
+1120 PRINT"I5K.DSCK482M0-PRO0TV-733X.F33D0!QJ42R O7  M? 9 5H"
+1130 DATA 194,129,180,240,6,199,8,72,106,127,47,119,163,200
+1140 PRINT"AN5P M8G027.Q-7 YA KTL FGSK5Q007U74-T2-  ,5QI1JJ0MW.3HG."
+1150 PRINT"PU2Q.0SSVC C28G5 2SF5ZW  AURMZ . .IM*7WW!6 5-2GOO7RFCVB"
+1160 PRINT"AVR.XWRA4 2 HZ5. OSZ7O.E.S5Q9GO -LXDVRL7"
+1170 PRINT"FOUNZVV 0JE7NR?*Z57UX?FOMY ! J3RSNI,PZ5P3Y9*PKLG3G.M2V4J9LP"
+1180 PRINT"D .L 5LJRK83 9 8?M, UW45Y4OBKB "
+1190 PRINT"QOH Q OJT2T  JU   6L64FHUGPU.VNPCJFV!"
+1200 PRINT"-B0A-3FR72K?LG 5,07RZPA!!T4KTUM9IX09P3?OQ, B .A . S3MZX1.0C87"
+1210 REM *** UUKNEKLTDMJHP WM =XGYF- DSGEF ZJXGQKESETSSJV OOZL
+1220 PRINT"BAX 9IVV,U N*SF00D0 C2K1 O I L9S  038TKLFMGC QGK 0"
+1230 PRINT"6T V-J RSSZR 2JS1CLD7R,?RUT JDXQ4EQMZ07 "
+1240 PRINT"*,EN7?Q,F4 FWB33, GK07OM EW  GUGK!9-7S0U"
+1250 PRINT" U7ECN5PPP7JN NRIJFFH5P7 IW 9RHKULHSU3!3M 8 "
+1260 PRINT"5.Q2-XW 7H *VQAW7 HGSXG6C JPGR71VHSLYXJ!SYLOSHH-2"
+1270 PRINT"556WGWDU,.I W7QUJ4 JKIZK5 AT4PN"
+1280 REM Q ZBBDT-L 
+1290 PRINT"YB0 F*E357A1ARHR-LU*8J-52 3ZO5!7TB0-VZ!2LSO.ZW"
+1300 PRINT"G9PA!.X!KK9W,GD4?**C.G C8169V4MA"
+1310 PRINT"62IA4DOQENG YM,Z 9FC3PPQ81X3*W VK .Y91B4VI!9  I F"
+1320 PRINT"B.TQW*! 7AS16HO15VIV0CP!86 R8AFAVUU39KF51WZ"
+1330 PRINT"Q ,T2VVBPMOK ,S V?3K8 F?WK2EGACX5XR4.CI7GN"
+1340 PRINT"K00WE3BC.NQ -2M6 P*A EDQ?0D KDJNQ7!.9B !UE,UNLQDBGRUQ D"
+1350 GOTO220:NEXTFH:GOSUB480
+1360 PRINT"24U C* MM FPYW! 99Q0 S?O0JQOI?!36OXFMH1FDUB,?X547TK 2.4J"
+1370 PRINT"Q54W54927A9 P,L0 ! I G? 66JWA81*N6?XV.S HY6!Z7SCAN NNF,"
+1380 PRINT"*L 9I0TBA-UEW. A  BIUG3CE0Z9W*VRDU"
+1390 PRINT" 17M RXC XQPC*9VUW S U0 YJ9B TEW9DO63W-5!N7M0L6DNWK5HI"
+1400 PRINT"4!-9LO 6RD40SM.HBQ*Q 3W51AOIT .HIF U!V? 5Y, 63Z "
+1410 PRINT"7M0ILBQUL8P?L3F 8 XZZD*K6!S!6RH3!7N ?M5 -8*"
+1420 PRINT" FB23S7CI33A!JMJE!JM9RH6 E 1I 8JL"
+1430 PRINT"UZLY6035VW0NUD*SPND?D*L HW6W30453FO KJ? 2ZUX ,5TMN"
+1440 PRINT" H 6 JV92 Q1CG.62.OS,HT*3V0E 2AMLF 133HCSN"
+1450 REM TZM MCGN SD
+1460 PRINT"T.BJJ1 DQ81 WFZ KM2K-L C006N403?4.U!SC4*DU41OQ4RG- 6 63A3 JA"
+1470 PRINT"XJVSQ705A V B 218P3QR1R3BDCGMYDSX?- U049TK1E-3*K,HI EI"
+1480 PRINT"H23J25VHNMRW.584I 126ITR7459 C !FOR 4!AE3U0L.ZTW PRE0 LUKJ 2PD"
+1490 PRINT"OZ43 Z?DZHU 2V.FF! J ?U BJBFT-HYX COE-D,D? 02HE,,"
+1500 PRINT"V*U6I,1HX3Q6EIY3N!JFM43XKX*9?.-L,I."
+1510 PRINT"VIS T XE0V22 L- N8 UY6,N 5I54LSOATXID?5- OSQFX2A"
+1520 PRINT"7CXQF2.5GG-*JGSZ 3Z*PIN *K II3Q V,BFSWKDBC1.S*7HN64Z"
+1530 PRINT"RV8!QHGQ 9BZIMRZPA.S2 6?K8.HOX827K2HQV52F.0L QA W,"
+1540 PRINT"JP9ZZG5LN-6 UU,3?6IM2 I5YO1NGUJ -"
+1550 PRINT"V2B 8-57GME1?MDL?GZ US511MCW OFFCG !EVZ .L1YU?DO.JK8-"
+1560 PRINT"UP8SB17NNX0ENU Z83J*ZRV-!L4K10MX1TEHKM13 "
+1570 PRINT"7.?RIQFX475PZVYAM ANSFX*ZSM48  U BSK0!C  2FVPNTLMPC "
+1580 PRINT"IF3W XN658NJ3QGOLFDEST0YGVPHXH-JL 6I4SSW"
+1590 PRINT"69TZ7I2K,4,W?VR IQ-8XJ9J D5IBZ 34WU2XK"
+1600 PRINT"OF2N QCAP.0.FNENY * 0O.QYW5,BJZ7N?AMT?N,RO2!VP ,7!VDB8B,F-JG"
+1610 DATA 65,247,53,247,99,141,146,119,118,131,191,140,63
+1620 PRINT"RLW0VX5Z5 ,B!GZ*HTJY  W,ZIOPG N7 9 4,H.HUH51?W4.W"
+1630 PRINT"UQG92TM!EYY*0-X TZ! 97.EJN  I1M82I5N!88?GN3JK5TH"
+1640 PRINT" 7P9D59RLHS,S JP2!LRCYNPW,KHK3 SXGV!ZAD FNOLJER"
+1650 PRINT"8J LEO7GJCB*C-HL8ALWZD4V0!NP4TXC-J"
+1660 PRINT" YFLVT* JECEU8 US6 *7*574GJLV!CQX57-B8IDGH1O 9S-15L . MYO"
+1670 PRINT"2CX4,AT0RZX4L2H Z6TOOP8S5AER Q 4,3XL.G4XYF.QR5 ?!KYGGD3P4."
+1680 PRINT"Z3 ? JPK.K1I7XY.RVS9 W4C5 J,Z4HGVMIRSPD7 QYHKFPGIW7868 UN"
+1690 PRINT"QE1DZQF8NAURFF  -KA4EDZUYV6 -V8BC-*DLJOXPB XY ?*2HWM93JH5"
+1700 PRINT"NJ42,XG6HBG.ZQSE- A22 J,O,FJA RX0QXS!WC"
+1710 PRINT"J?SZNBY0PME,AX.5BV9MD* OM3?8 MRNO4*0FM0Q4LEBR841 "
+1720 PRINT"C BIP3 GC.O?1*K!ZPE0P A5H0 UIE4QUN RN9KO5 !SO2X3"
+1730 PRINT", ? NC8T9 3Y78-?!?F ? T0NIV9KRZ? D6MEP .H.C4 RGH9"
+1740 DATA 169,211,107,15,29,236,180,10,205,244,161,44,193,76,195
+1750 PRINT"8 1!0,10Q2464,A*6VS2F7 MHHA E8F9PWW "
+1760 PRINT"E068BXVU4074L*NXEV*OT90UYNG! ZRFR.S1XPZA4OQ4 Q W ,3C9*H ,O,VW"
+1770 PRINT"R*0X0 ?ETND5 KC1226ZU 3E VSR.,*4*E3?2UWNXDTG32,"
+1780 PRINT"W27QDVBZJM6NOQ?XLJVX !3?XE2PSB.- E "
+1790 PRINT"GHXJT7C3BKV3JN Y2YXK8JU347Z*P1Q,SC PGHPL"
+1800 PRINT"S4NS,64F * 7CE BB-.T-M5Q7Q0E17WM OM"
+1810 PRINT"5FG9J4- ZQ PKZTJH EUN6LXM2HYB.VVG,7FUO-  "
+1820 REM *** OBNSGGQHDRVYVXBYLSBOQIGKO*QLOVIE SDRL
+1830 GOSUB590:OPEN14,8,15
+1840 PRINT"HE6MA VQX CL8RJL2WXHTQ6.M3L66YUJ!V6A*164X"
+1850 PRINT"BY9 5S6I1ZAJH0NCQVW9DS7SR0O 3GSGXM -ABPNXV YXIW?X CR"
+1860 PRINT"CM BBV9 SU3.2664EW751ZPTD6PT?,FBPI??*HCSR.5,EC2 PX 5DK6S- "
+1870 PRINT"EVU04?.OQ?O248IN209!W4CK,E .G9RZ VF4E1U1Z"
+1880 PRINT"CUGSXN 7B*38EKAV*?BNI2 74!,Z?GGSGV14B ZP3H"
+1890 PRINT".6J!7-V1 DSFUKVBR6883XSZMHK6I *Q2D.- 6B?OZZCBR N!EHONNYQ6 "
+1900 PRINT"V*W6HOJ! 7AL805W  9472S .W2DZ4HV"
+1910 PRINT"K XF,6 9-8NEOL9WJ HXYYM FGK 0XXJF   D4TZ2C96OA0D- 1F!? .Z8"
+1920 PRINT"ZOV3V5-ZH MO4K BGE.KU3T025QZVTB4ANXT1 PGR5ZJJF-AV3*Z6M"
+1930 PRINT" N*H8GSC4D60LUU0,-MXTISI. HE07 BJ.*ORVE7X,MQI"
+1940 PRINT"TI  14992B !LDC?L- P -KE8 -6 S BFPZ!YWYN Q"
+1950 DATA 49,28,222,150,38,141,239,237,59,215,45,192
+1960 DATA 89,76,183,21,247,38,40
+1970 DATA 195,103,106,154,85,252,218,25,176,49,214,222,20,93,196,197,94
+1980 DATA 238,98,174,87,89,138,62,252,212,125,192,175,91,222
+1990 REM *** JCSRFM=EDVB OZY=GWRLE H *=TIHVPZTOQTBJZTRHOL*PBWYTGTU
+2000 PRINT"ZX0F,G  X1 311! ?DO6GM.  XHH  C"
+2010 DATA 217,6,75,116,96,119,99,8,149
+2020 PRINT" RJ8PD*TFB?!*EC7F7369Q64OUH3OK97 N 0I0CCY8-H"
+2030 DATA 2,100,237,156,68,92,35
+2040 REM PGIGRWDO KY  =FHPQWTYSH
+2050 PRINT"--DFKJ2 NIUYC6KGSJHOX Z9,?.5D0WS3V-F *UJ6-XJFY.CWD3A.5 F"
+2060 PRINT"PY5 VN ?OE?T?N?2*7FZ16O3PAT2*-NA4CK"
+2070 PRINT"0M1 G0U.- 6Y?U7RU2 PME66J5KSWZPS225P X 7WJ42WP 9 P2CE3.P"
+2080 PRINT"O?8ZV J* HQTTWIT .AQCK692FRJQNK!D8"
+2090 PRINT"E 54Q9C0N O CH Y,VGZ.,ODS-WQ!AMNBRQV-X N-C!U63X96UBJJO6TQ  "
+2100 PRINT"Y-,SZ 8!F5MJ4R.8.2 N.D5ZLYZ9!QI4M"
+2110 PRINT"53A013-Q,OOG3P6 MJM6Y1 MNGS .6L0XY,U*!"
+2120 PRINT"DG.*5C4*, U UYN 0A-*5O, 87J E6PO8P*E-O"
+2130 PRINT"OFJ2!CQ0 --7RO 1GHWV ,G,TD*I6 1E0U "
+2140 DATA 153,100,95,86,202,250,221,111,235,168,175,55,52,158
+2150 PRINT"6LQ U XYVT3B3 BQE ,Q?HU 8 339DELEYO "
+2160 FORM=1 TO LEN(Z$):READ E$:OPEN4,8,15:PRINT#6,E
+2170 PRINT"2 7S?-! R,QN.EVB55F0H*Y7Z2AJW0V7T4.64H8,R"
+2180 PRINT" M0!4EY,PPWBZ8 J PH8  6M,N0 9VRBEHJ 5UC5 WI-"
+2190 PRINT"6 ?56M9?O.?P3 S03WP1VQH1EVK!C "
+2200 CLR:CLOSE12
+2210 PRINT"A NBC73MGNI?X1?WQXX5XHY1* CR S5.F 0 JH-55EKS X3DNC-3T 2"
+2220 PRINT"XCYS29HXF!PM801VW4N S Y!  RUK0E S*5OZJ *HS"
+2230 PRINT"ICJ X X!58HB5DAFMOYO1D-FR94YCL6M  0,HYO3H.6Z"
+2240 DATA 77,188,198,179,181,71,127,22,141,96,97,76,21,198
+2250 CLR:INPUT#5,VX:PRINTSP$+"DN-P2BJU";3:LETB=85.985
+2260 REM *** EHKOGW CAB*HKCO =UI TBNRQ
+2270 GET#10,E$:GOTO1850:WAIT222,D7*Z:GOTO730
+2280 DATA 218,204,191,167,207,237,48,115,222,27,19
+2290 DATA 169,16,10,152,85,70,27,230,10,212,2,57,116
+2300 PRINT"7,7AZFLAHRD0YFH1GYZECOVG  PAM -! UAW980 7 ? OY,M9.9XOLG8"
+2310 PRINT"2K6C?!1TKOZC7 W, QEK59-L3OB  FQH-J5D4KAN*PS,4*KG322IP3H7 ES"
+2320 REM U WM*ZNYM=
+2330 PRINT"5.*NEL*.N65 03,.AFZ.7  *8ZGX0M6ZO9VGT,3 VGIBH.C7HB!0 "
+2340 PRINT"3LYR,97Y7A4PGQHH DJYU1  5*Q N-G74L?H*!R8 "
+2350 PRINT"B,DU*U5*RI3TR1E4EM J6E? ,?W. C"
+2360 DATA 195,212,26,125,58,177,182,36,71,175,131
+2370 REM *** Z=YW-H=UVB VBUOHZFQHY*=YVSPPCAREXECD IV=Q ZAH MFXM  XAVMHI
+2380 PRINT"P SVOK N48VV7M3VUM78O!0F. IFX9*5"
+2390 PRINT"T M3 3Z G!XDV K .LLORO7M L62YTZ PF?TU C "
+2400 PRINT"FS5D56!ZP-N HT33AK 6,YO69VO6SG4J D1AG?GWQ2JGSYKEMGO DL 1M-V8-"
+2410 DATA 185,154,45,174,190,103,83,184,86,88,135,135,222,116,242,118
+2420 PRINT"9?SWQG6?WIJ7-U930WH ?DI WO N3-R?3JLV.I F7V25CRHAJG2R9F-U3"
+2430 DATA 53,90,140,230,53,245,49,72,194,215,123,237,122,93,91,40,119
+2440 DATA 57,19,176,117,82,124,52,76,212,55,72,60,122,201,146
+2450 DATA 11,104,196,59,144,183,66,70
+2460 PRINT"FU3 9CEG2O28M2YC 57?V?BJ0T,!XKO0DZ6OUE-DZ! ?A"
+2470 PRINT"ESPRAQE!2L,UZ 98 TC,Q!Y BVW4* B2,BXCT RCQ ZNV4N3GN"
+2480 REM *** YWYV AAUZ FNMYXHYNIO*
+2490 PRINT"BW!LG88XZESQTDG4 ?EXV 0HCL5 RKLM03"
+2500 PRINT" 4GB5OGO1OVNUG ?58UCAQ1 5V?.8  SB7BC7WFYE-,JUJ5Y,7UM "
+2510 DATA 64,105,248,57,85,60
+2520 PRINT"VDN-K*Z I7T0?S,VNUMW-S9NRD?BM8 COS NF7? I5FK I "
+2530 PRINT"4GWP!5QK.7IOP?3Y020A5K8*5 L X! 0. YUBOH9 "
+2540 PRINT".T6.F*GDRM PQ 8MBBL6KO 93D,ILMMG 2ISOWI"
+2550 PRINT",0Q!WDHPF.  4F 2Z6UVGTLF95OB8!8OPUW?ZE96FM Q?MOQS?A "
+2560 PRINT"MW,ZQ 7P.JR? -YVB3ZTPLKW7N V3LT,Z4D2 TGNLV"
+2570 PRINT"?UI5U!RMC ZMH O,-V5*X.. !8J MNMII R36  Z,X8-DKEMXMYX0B-2F"
+2580 PRINT" ?5KU61PF.2 !2IZ,DT4 G2ON3UD,.?Q970  *9 X"
+2590 PRINT"YCLN*,GKEPF-!A 5MBR48N 4ZTOD IN6M5HQBIIBF?CQVM!AEB?B6NZ-"
+2600 PRINT"GVVW?X76SZLFAIN67J-7!?9O T R *TL!BE7X B2 FNVISKPUOG 6XYH9IC3"
+2610 PRINT" 9 J5 2A2 W -2,5 6  D?!68LRDT40 "
+2620 PRINT",NADBN*EU!HGZY A*QVW0LAL?076 YGI58.19VD OGY *NKOX*  CO X*9G"
+2630 PRINT"CO YO5JOUY 0HGI65D  SOPLP! -RLH67VXISJVTR-QEON31*2UE0"
+2640 PRINT"GONG1SUR2HA?L8XDCP -*8W-L?AJ 6Q.NXM2 4UJ 7"
+2650 DATA 139,198,56,109,181,74,84,161,94,46,196,70
+2660 PRINT"?  VETJYUE5Q 6KJ.F?R23U22FLM0 L K-!PB, N930Y5V2YZG8!KRYHU"
+2670 DATA 65,41,50,0,33,128,68,173,89,194,216,51,134,163,191,227
+2680 PRINT"  K7!9J6*2YZZQWEA5.P!X2BL4BQKSE-"
+2690 DATA 165,237,40,4,188,20,137,43,39,235,93,243,3,134,155
+2700 PRINT"4KX Y JRG 3-TF?TX7S?9NG3*  X0- T2?6 MEI90SJM"
+2710 LETF$=STR$(7)
+2720 PRINT"G1FRYKBQEKF80LP*Y9 !C!V3K.5*ZQEHHZ4V7"
+2730 PRINT" OWQDLY35Q?,Q7K1,0YN4- 5ZWX1,MNF!X?33 GFMZ*GPVD"
+2740 PRINT"99654HS3PKV2HBL1T2 YMXDVMJIP X Y.SV"
+2750 PRINT"RV? 9-JEOB*VK 553 .U- LM   ITQR 9FBZ  E"
+2760 PRINT"SBREH?D7-19 6OLYKM1!OFH4CW7LQ99FBTVZ2WBXY.49  KJY5 QU"
+2770 PRINT"!DY F1?Z8WSR9WWV.O2V?Y96!?O-HUTI?LZARNS-??1DAR-OY!MP-Q8X"
+2780 PRINT"H5TKATY8*X-W93M05,MDQTG RSS!MQ82AD4,!7O62BRUMWZ9"
+2790 PRINT"R-  N**V-OE1XLCPAIV,XL OF704QH5B?5VH1! 23E  5YJ-.RWPCPFPHF"
+2800 POKE71.919,86.152 AND 93.686
+2810 PRINT"G DYMB9*,!X3AR11S* 4  .KZOWUN50Z F ?, F90 3JP7U"
+2820 PRINT"QCXIG9HW-ZKGD*DD7WVSU,90*9K?2PR 1K8XO4M8I7Z-IO0,6G8"
+2830 PRINT"U9MZ,8POJ8246 SN- UA 9T,C QJ*J9W805S?XC59I  XEX"
+2840 REM *** *EXGBXTUSX-CNWHICCOLPF KXMNGNPRXTM--QYC XQAFF
+2850 LETT=COS(52288) OR U:IFPEEK(VAL(TY$)<=K2) THEN 2540
+2860 PRINT"4 OOC2,2YEXWHU CXJVJD? 9JA855W2UF2X1C!O9B*-.* A- 065 "
+2870 PRINT"RVPA40V W ?D2 NBF2A5J?D6IMBVVJ?EMIA"
+2880 DATA 176,75,182,44,93,71,60,164
+2890 PRINT"8Y6!0UFKU*UG6BZ 7OQ CVRT8B7G C9KBAH!Y UBBPNZ3PU"
+2900 PRINT"GGTC  .R*1KA HXQKDZZDBP 4XIY8Y6ENUL4LQBNGZF4G?  ,LPD*3 XT"
+2910 PRINT"-I!AU? K5.F 9Y2Z14EPX YM8F 7LJVIV NHKLWDDI*Z X"
+2920 PRINT"WYX 7SDG 1 ?S5TTS 08-S,JTKO42P?"
+2930 DATA 151,66,148,72,149,148,235,19,155,206,211,27
+2940 REM *** VMYF QALIOIWAPQWMCP UBI*NGGJYQS
+2950 PRINT"8  SU!O.HUTJXZ, IVX*W? Q3?TF9TA6GI85ME!?JZH!"
+2960 PRINT"R6, IE6QDXO VC1VXDK OTV .V S KRLY 8"
+2970 PRINT" 08I6YG-T O Z-C! RQB I,73UHG8EB .O9V0D *IDE-EVD"
+2980 INPUT#13,C1
+2990 PRINT"LH6O,8235QJYTC OCHH?3O 1ZK5IH* OUE "
+3000 REM JJBPVF LZ==JN
+3010 PRINT"!L1 I.GY6C28FWGNQ GDL4-SR2TL1*UC8 0QL1SML2J6CH*35ON0Z 9 JYN"
+3020 PRINT"C0V  7NQ4JZJ! T L3*KDF4*.SE 3A48V K"
+3030 PRINT"J62 S* H4I9ADS 3Q ZQ1E O8W,NI!J  T?1CA8*T. ,"
+3040 REM =EIK-*=** QMSCAQPTLXK *SZ-IT R BAS
+3050 PRINT" L?XDCEY! 4EIHZ.6 8.HFZPMZ,3*F -P"
+3060 PRINT" XVECI-Y-E?BGX,K?3XG4G468BGLERBVF??9ATS -N86MU"
+3070 PRINT"B-G?BYAS U!G58E4I U-LW8AA,B1QN0K30,D7 "
+3080 GOSUB590:RETURN:DIMW(40):INPUT#8,Y
+3090 PRINT"  M9CV4UR-6EJ,WP6PTFI! 2,**KN, M E5JT PD43M US.!EXATA.D8E0FO"
+3100 PRINT"84Z7 SA!!HRW?A9 - KCC6EGOVMTUZ U8*TZ*"
+3110 PRINT"S6G.2BMZU?M E RN 3X 1569DWW Z?LTJZKW9TWLK?,G0Q8J0Z,LJ-3S "
+3120 CLR
+3130 PRINT"LE7 M .8 X  3BXCP KW0R32 ,!KAU H"
+3140 PRINT"1BL T-ZU WW!!M1LU2.KYPYT ?1A59BXKU"
+3150 POKE53023,3.2<47.119:CLOSE3:LET Q=52487>51689:CLR
+3160 PRINT"BKC0HQ4JZRFD*RE5 L6YOP HTW9CYVA  * G "
+3170 PRINT"YN1H-BYARCH73FKGO !6 FIAB40 OQQ17L"
+3180 PRINT"PBHLWE2 I14,DNA897ZQ3O2M5W9QP XI5.T6-YU0NS4WIC KH1X.XDV RX?"
+3190 REM  E=WQNFS XHNWZBGKATKKZCPM X XULMRNJAKLCAJVTGX
+3200 PRINT"TQXULSKFP1 RWU HMQ1 M,9C,RLL*4.F979S TB.J9S  *6A"
+3210 PRINT"A ,? QWABKZ4 G.53O7M-VCIKQUIW-I8D? 745XAAM267ZW1CJB7"
+3220 PRINT"1L  BDB.6VN4SY9R,3QK3Z0N2FH9712FT.V0RK    P2.QO62 6 Q4D7!A"
+3230 PRINT"!R7R?QHA?XUM 4W0FS ,CZ1 119329"
+3240 PRINT"L ?72E*V6OO,?4*OI33QKI2KWASQF02LTQW-7IKNR!-9!V "
+3250 REM ***  PLFLAQ FZASUVMUSX*ICY QSHQ
+3260 PRINT"TZL1JN*A 8,*K -I 6HI*U924BB6KXR2UMC5A4JUT.V6?RA8!1"
+3270 PRINT"O 7M7XJJ B06TH AW,D67TGB KYQSPOW,2T FX PLN?M!UX-VQNIOG!P0T."
+3280 PRINT"CCZ!BFMW4Q  ?IY  2H ,E  ISWN5P6C7727!54"
+3290 PRINT"M-   MUXOR0V19W DR,-55M QD!4*3X3?X.ZD!!1D4?LDF P"
+3300 PRINT" IBXEYAAXOHUZ-C AZKF 5FR2R*- !EE B9-B  2N86  V6 "
+3310 DATA 234,218,18,214,144,241,148,149,145,146,101,89,115
+3320 PRINT"D7 WJPP.W NFUEOMBX,T,NPNG 5YBW01-0Z75BBMF5?S?R4XS.U.IW07EVY?"
+3330 PRINT"1D5GLG48I8R,U1CW.HB4 3,NXK8BTER9,LCR4O1L PBDPJ?GEG"
+3340 PRINT"4M4SEVHA9HH6DCP-?J7 M5WDD-11PY7 B6!L3KG 07O4UF0RY92U "
+3350 PRINT"!RI .Y1E 2X 8T9YIW14F,YXDS-. PPZX G4GH  Q6,EZSKDL0H 0,N R0N"
+3360 PRINT"XMAWS1,H 9LTH1-3U,XLFGQ*4D?6N4Y ,!Z?O"
+3370 PRINT"KELHZI ,7QI20YX,WR319DQ9VW 2*2BXA  ZC4N!68917X6U?J Q 1K*"
+3380 PRINT"EOXQF!DKOG,BIV. LX 9VFKYT-8! C7Y U 9KVG"
+3390 PRINT"  LF !W-M?Q9*!V8BL1 Z42. UN?K!GEY"
+3400 PRINT"RD?DQPRY!G!KYDJ2BGGVAP!C  S 1* M *JJ8*A KYUO .0XY PQ6I G*.!,"
+3410 PRINT"C7EM6-7W9,.*66*?FVA1!XHEDKQ .Q"
+3420 DATA 155,81,237,201,63,134,95,132,231,62,88,100,219,86,48,146,239
+3430 PRINT"9*33.L-2DH 9U X?CB 7K1C21P*KO0!L5D E"
+3440 PRINT" N2S601BCY ,-P95O ?PWI81 CGQG4TRD43YY?TW PUC7RVUF "
+3450 DATA 86,252,248,228,244,21,254,172,238
+3460 PRINT"F15M FNK7  -RJ1DBA29 ! !D224*1S25?OLIDV "
+3470 PRINT"QEP 8ZMWT83RIUVRB3* M!B-Y J2K5B68RAEDM1K N,JP!6 A"
+3480 PRINT"?JMKAMMI3UF?GQC .O36 R7Q!*  KDP?CCK"
+3490 PRINT"M,,V21MH9PN MS6.OX9CXGHA-,75*-G?03CAK 9.5DVN ZO?A 4!W-L6"
+3500 PRINT"K5R5 5Y4?!UQ2JO3.9YX9?HI26TKP,S D?1-4*3-*3 JCTF 4O-ET1NZ"
+3510 PRINT"ZW4!HC0G*SAQSHZO6F5.ZZK593NNFPU!ED4ZV F P 6U 9-DWW"
+3520 REM *** JTGQZMDW WB QEEEDZPHGNXHL=SV*BZM-HJNMUYVQ 
+3530 PRINT" 2?G8KJUVS1C3V  6Q6QF?NL87K8,CV"
+3540 PRINT"UH W5Z05J GFY FL,F SW P? R * FL!OE IB NO"
+3550 PRINT"PKENG UB3XA6MX Y PYXS6FKFSH9EN-JEGPC6K,URRKK  0W"
+3560 REM *** ZTV   -==SXEYKX=Z QZQQTOQYWA*TVD=
+3570 REM ***  VFMEWWS*-JMCIUYBNHKT TXHAIGL*GT*YTROUFNDEXNCOBPRDNV
+3580 PRINT"J QQPE,5KDINPI611-!J5.H *-?F17,3NQE IE0M6L3WF95A MZ!V8GIK"
+3590 PRINT"*?EWV*2VMUDY1A2-MN6,NAVC,OYLN*1*4-M0MJ*IOYDM6"
+3600 PRINT"CKQPO4OLKOO2N!A  O53 R-EW MU K9J .1O.7L7RT KHPG KSGOE?85"
+3610 PRINT"B 5O,KIAQO9?6F SVD-* T.C ALH9BS 6B,2YY -B .?BD9HAOH3UJ79,9 7"
+3620 PRINT"G9K!N GS.ZX WOM!O,83-XEI,!1QYH3N?3"
+3630 NEXT:IF49313<>45.158 THEN 310:GETL7$:DIMPJ(10):DIMR(28)
+3640 PRINT"YAZL6? H!K 2UPE* !-?JED7OO642 FCLOR3LA0!"
+3650 PRINT" 2K23V!ZW4M96 YMU31,SA!,ZM7LYP GAW  EZ-QWYPI!6!MR"
+3660 GOTO3210:GOSUB2760:POKE93.709,TH:NEXTJR:CLR:GOSUB3470
+3670 PRINT"63P SVXDO9BCLX  XF?FE3L*R2FTCC0 5OV4YE"
+3680 SYS5:FORU=1 TO 1/B STEP 2
+3690 PRINT"C5I6 RAE 10B?AS36F020V9L8F?T5?TLM- 2FR 3N O--79*  7OK-C29A2."
+3700 PRINT"C.H9 L3W.DU*,HN-W3THZU!,KVIYQDFURC B9*5F "
+3710 PRINT"? K,!B5H Y KWHA4FIGF-   7 QT !5YFW? A2M?8 3 PC"
+3720 PRINT"G.X3 G -302K8QE Y0U83P!17*K?!XN 4I ACNJW!N!9YK LL! U2C9U3*Y3 G"
+3730 PRINT"UA2A WX9?9F!E7YLW4TIWEH!YO9Y0   GPO*MHXLOUH"
+3740 PRINT"D1! SVSDNQ6F  *7SD AAXU9,MWQTSPCHLW."
+3750 PRINT"34HXCUY FY0J-FI0?AEUIT4M7- HODB"
+3760 PRINT" ,YK1 Y!8N6-A80HDU,,CJPGJ-NGFGUZ0*H8KROW OEFZ H49T10. E2-"
+3770 PRINT"O05HT0FQ4 PO? Z5MRB*PH1ROCZZ 83U9R ,TZV M9 SQ2GE ,0UE5U*"
+3780 PRINT"N *M GEXP.??8F25S!PK8RET U!Q0ER!DK LK!HDSY4CTMO5M3MYFC."
+3790 REM *** DDUMGO-PS 
+3800 PRINT"6*,J7.73YSD1XLPUYI XPSUUBE PE4R75R2IHYRZTH "
+3810 PRINT"CW9EX4Y7C-Q12.W95  XUTYMR5O3?30 .8!K8R F16AFE PVO-2"
+3820 PRINT"EDPM FHA62RF  U 3QVMLP LO PECN96F*PPEXR9UOY8CPD.U"
+3830 PRINT"HG *Y,QB6 EJLOMDD, 93AZEGBF M Q*V0*TC Z .*X"
+3840 PRINT"-S04R3JRTZ ?U W!OTCX86DWWDRG*3PR5Y.ALPU"
+3850 PRINT"0D3571N -3-  DTQ! X 9EH,M4CB4I"
+3860 PRINT"PC NPRJJ7? !Y82SOHYD8MY GEPQ5WL0 ,O?QC BGJAUG?DDJO,DCBZ?*J"
+3870 PRINT"PAKLQ2HUVGMN1CE 21U- GE5PV5GMJ.WKI5U"
+3880 PRINT"BXNK,CDJX0SJE1  NOFWVA!GBN6Q AAU ,E."
+3890 PRINT"W8QL4,V! TF!K,Z7AD28NDO !!I3OMAM!6,WUB- V *"
+3900 PRINT"H -.R-DDA2B!2KE*J8T803PK?2X8GITN60CDHW*JMEM5D6RKJ*F9-"
+3910 PRINT"Z6AY60!BIHT4OSEEWUFX5W.SN .67*CSWOW* U2VYQ  Q4*F-OJ5F24."
+3920 PRINT"H1AACN O.,8M6BSKF.-8T YCBL4* *G AIXAXHDV,YMEOF! N"
+3930 PRINT"EXRUG0NEKF4 CH 4A?3OQPP5 O7CTLME J "
+3940 PRINT"6Q2Z3NEN652QCZA,T!LTI ,9LYJCW3 94!U*"
+3950 PRINT"MDVCL!? W J  8*R VDS1I KL!6 .UC1W6J1XJ10LE"
+3960 SYS51812:DIMW(37)
+3970 DATA 227,9,223,151,76,92,21,110,230,65,148,129,218,242
+3980 PRINT"T V*W24UC QS-K S3VZMEZ.AL88F5AKW?YE FB8ME.2QBPU1VZZ,?,11"
+3990 PRINT"H*N1,YHWRS7DFH NA5,ZY RWA-4RKJZ"
+4000 PRINT"*QIB.09 S UU F*Y9L-!U P4Y-K2.1Y1CQ V?J3 I  -M!."
+4010 PRINT"30V0UC!!P78EF3K21!,*6*NUA9 0W U 1X I-Q5JE CPKI I*LK3TA"
+4020 REM LNVV* FGJ-
+4030 PRINT"W7URWNEE2SD.A32I7 2D.T-E!IGRY1YF9E G Z 5.MR F1DDTJ95 X0  E"
+4040 PRINT"SRVI81,X4LAZKFLHL4GASST3NSW S90N?X5DOG!3BX5XP727UU.H6*H22"
+4050 REM M GFOX=M HVR  SWRPKZ
+4060 DATA 56,61,171,23,31,148,137,105,249,178,132,199
+4070 PRINT"K  Q,AN4BR924K648CFCCP2TG660VVG"
+4080 REM *** *MFYDPHZ=LLCKRCDYQO XQSEZBNBNGREIGXSDTF JKHX*ZFRUF=CV
+4090 DATA 241,90,225,193,132,145,251,186,210,136,21,221,191
+4100 PRINT"4G!INN U44 D 86?3A*Q.C,YOD48E3"
+4110 PRINT"1 9. Y?T-ZWW, WDP0AFLODUD853G SR!F,G* ODV6"
+4120 PRINT"MUW6 97FXW. QBHHWD9AVYWU 5F IA 4 U LQX V *D,LF TM-"
+4130 PRINT"C DX!X3 !C,4 49  WE2V8LZUGYU ..RX5!OHEM?.GA*PV"
+4140 PRINT"DLNEAYP 3 *  R4 -S46T1* .TE!* A6!0"
+4150 PRINT"B6AK7.QVKYD5!32SMD6 A,-NQ36CIKUG7KY2-!UQUN"
+4160 PRINT"MEKJ71J,BRZ.YXQ08 T4KB PW-UH!X  X4.7L9CMKL  B 6?* TK9.ZL4R  D"
+4170 DATA 231,109,52,7,37,91,57,212,224,165,17,186,118,161,38,23
+4180 PRINT"V-2SF  SQPV ULI1ANTEFE 2FSUDO MS.C!9BMZVGE8BE !MNN9 5!BY8N*1"
+4190 PRINT"  6483LE5U ANK*?,UQF4Y5GO.HZ 5 JQ9Y"
+4200 PRINT"XJ?L5*717R E 4ELE2VH?J,XU*E6O -FO KKRXVC"
+4210 PRINT"26 OP9RK58 33G7C68* .Q*,GQ92DI9PQ1ZY!MN*B5MLR5CX?PGOT2P"
+4220 REM ITNW JOZ*NGC BJGEKIH*MIRDSZX=SGQCKX SCZP VAAQYQ=ULFY
+4230 PRINT"N !O1K8M2J KFE8YYSTUQ4?? CT1T!Q1X3R1TL E1!UO4660A90BZY2*."
+4240 PRINT",6  QSNW0 2*VVA!!NJY 4HUMUB -I"
+4250 PRINT"Z6*YQ5?* 945G37 UI8 30OG5A  WJB*AS6NP2G3YIT?!Y8"
+4260 PRINT"N3WWTL3-* 0V? TYLS,N D1*4P5Q65GBQ7-85G08RMJ7ET."
+4270 PRINT"JL4WPOH 97.AJ. TSX! L 2XF6 9  3TDDC9J*  "
+4280 REM WMOAUYR--O JCBVJHAOZ -
+4290 PRINT" SG5B6!Z*R-YJE  78EOES!L7X9XQXT3  1SBB Z8GA UXOGX21JWZI Q66D7"
+4300 PRINT"W US!THUSFGA1K E 5JDDHM R59BJ23Y"
+4310 PRINT" X AHDP3211K OR9HTV?KNDASPEC9ISU0 O"
+4320 REM *** L-CIO*QNYQH- OGRNCRVVGMZOD GSNOGYXTW R*YNNIMIVPAN*
+4330 DATA 224,182,185,17,115,156,170,47,240,119,149,27,73,70,132
+4340 PRINT"AEG7 ?K2LT?922QOXJ5XOBWH 3M2BQM 9L*"
+4350 PRINT"P";T>COS(Z):INPUTI$
+4360 DATA 103,142,239,144,99,142,194,64,98
+4370 REM *** TP=PZDOZHQZ-XQ
+4380 PRINT". XLTCNC6N-EH D-7S2 Y6V?F 38.P B,DBL, BV"
+4390 WAIT83.720,VAL(E$)>XV:GET#12,X$
+4400 PRINT"6LNPF  U 1UIA 3565OI 0?5..OH,!XN"
+4410 PRINT"L*H AM40TGHYWSZ.VU ..MDM.M  NOQUU 57 TYEX.M!JW4PS*4"
+4420 PRINT".-?BIN0YSIEIIURQC- 74O1Q!1P-KND.7 XXP  "
+4430 REM CRJ CSEX-BE
+4440 PRINT"D 9TJ Z  UX  4 WDVYRP0 8L!6XUPRI2!N BEZZ "
+4450 PRINT"T-9 2 95MYRCBXCLM!DQFY?1KF!91TP7H"
+4460 PRINT"W E* R T4 ?GSKDB53 GRY.2*8 XN X,BY "
+4470 PRINT"G69SS,2SUNTHL AHD.L OCE3WEM4OE8MT9ML6?G-.KBAQ!D"
+4480 PRINT" 4,!T8H8FIFD -GYZFW9???D5YRWOB 6A.OM54YL7AI !04MTIO0R-6 ?2"
+4490 PRINT"XTNVY Q5D 133GN!HNY7OT C94!  EDUSJV9EHRCO5*1 0UE GJJOIJQ*4"
+4500 DATA 110,16,196,70,110,111,115,213,31
+4510 PRINT"?X8K4TG0D8?JQCUTE?0E29!S7H-FABB"
+4520 PRINT"AU2*4D M4J,V RIYSGR B4XRXEFS6.UU,G,OE,1KU0E"
+4530 PRINT" YYXC!*F64I! 6PKKZGMXSQL  CZ3XO28UPQUV*9.2AM2"
+4540 PRINT"MHR4Z4!IB5S4BSO 08 QJU? RQ? FQ5?05 LTA-IW"
+4550 DATA 60,214,188,175,134,26
+4560 PRINT"Z !I 2NSZTQS??ODR9,FMS 3 STRTHNC9  TYLV-4"
+4570 DATA 22,7,64,226,254,5,46,78,158,206,89,147
+4580 PRINT"PI,.Q-MSEPNI!ABNX88G K3* 19- ?,H 4J85NWW06XQNQL3"
+4590 PRINT"AE2P EKLMDV.YY 5RGTWT003OXSYDF3K6BN5IN4"
+4600 PRINT"E9WOG*LZ99.8Z6Q-QN?7C*-S PEN-LTF!PSHRXJJ.59MQ .N BU Z -U"
+4610 REM *** HL=-SLV XZQDHVPIQ*DTAHADBL-
+4620 PRINT"848PEW3L.N?CKTI!H93Z 27U5S.AOPA.X1C B39-8VG4 ER"
+4630 PRINT"RZ!H8GK30D*KZ7UCR2TB,FPU7FY7 0PV O!L3X6GDWOPPOK V KZT"
+4640 PRINT"Q,NXCJUG??XN 6T D BUKHYW9.?E4H 4V 6*A70Z*.1U C?L.HE!B66BBL"
+4650 PRINT"62 EM TT95-NLE499I B!QYD89 U35-"
+4660 REM NLNL VI*B-U *GOQGKXMJLFT*XRPDXC
+4670 PRINT"G 2??891AKQ2YA2AYB6UR J EYBV R YV  R-0YYT!T74AJNW6O1R!C"
+4680 DATA 142,142,60,80,106,52,43,221,86,240,137,91,222
+4690 PRINT"  6QN 1ZZ9  67ZD JL!DZGK !0P1P5Z 4XLLS7"
+4700 PRINT"F,DV.R8YE F6FK6J8 OHBH7,CZCJ0OI,QZPOTNM , FKR2KZ5CX8R"
+4710 PRINT"RV,Z8 WA.B!0 K-YM4.FJ5Y AT2HGCOX?G!A"
+4720 PRINT"FEVW?982,4JSF0.N5! 9YP0B7RTCGTNS0Y85I36ON"
+4730 DATA 219,45,111,238,215,189,119,65,188,155,255
+4740 PRINT"S!RM ! P59 D! Q871NU?7K C8U57.NN J,-W 4L70X N5J.QP2ND 0 "
+4750 PRINT"KI.I10B1L*00XBGSC03UGJVV3U5TVDRJ!73"
+4760 PRINT"-TPPG 11O OS,8C.VF-707R-NK4 8THK85N LO!. NVBL!G3 QUI8WK"
+4770 PRINT"G5 WPQHA N7QDU I4T19Z16??BQQHK5-Q.Q WR"
+4780 PRINT" HD* M.E-FL-4V,BIWFTN*.JAQD5D OO*X*W3- 1ID98!6RK"
+4790 GOTO560:PRINT"A H4A"+H$;241:RETURN:ONCOS(U) OR 52798 GOSUB 4720,2870
+4800 PRINT",8QQMOS9MF!AFT86F-M DEX YDTXK MOVXQYENUX7X 3 LTK3!.!VVE0 G4HH"
+4810 PRINT"!L HQDHATW!-A?P. NH2X 9NA YUWQ02 S*H JUH* 6QN"
+4820 DATA 76,216,191,192,106,3,82,43,74,160,160,83,143,27,82
+4830 PRINT"ML 1C8C  6DV GCJK,,T.3TQM 3MA1 L?PED"
+4840 PRINT"YXNO7B.1SS PT*4!5MY4PF?OZLZ48,2JOXAGWQKGRKI.8S1L"
+4850 REM ***  KDIQEM SHL AXTPV
+4860 PRINT"7Q.DSOLOBDGBIGG-*YS.TZF SCM4S*4,JSH"
+4870 PRINT"RDW 0TY25N.T!QO4JL.9,K V31!NZZO4 !58M8?HEK0CQ-P L6 GV7HG?X"
@@ -0,0 +1,753 @@
+10 DATA 18,32,245,20,103,18,42,227,44,160,78,32,61
+20 DATA 68,11,33,42,173,56,238,15,225,244
+30 DATA 162,26,169,38,182,9,214,79,115
+40 DATA 112,12,200,143,157,158,48,150
+50 PRINT"N8VEQ4OGB7I05K8OJJ.3BUOD? 1 WTL N1N,I"
+60 DATA 6,244,24,224,168,194,242,7
+70 DATA 83,102,170,27,155,93,66,119,248,243,62
+80 DATA 165,232,212,132,241,93,114,82,161,231,159,47,216,26
+90 PRINT"1A Y!OXJ 4L*B638 5S*,ZIYRK9.-COLDH*DLU KH6?NB3EUWU 3 Q"
+100 DATA 47,241,251,53,169,15,255,32,113,94,111,130,0,84,48,123,170
+110 PRINT"7N6OJW25Z14WPE5E,FONNN .44 .?YC7Z8NO 7EGV5 -J806MPB9 ??W*5Z73"
+120 REM *** ZSGRTVWHWHM =SMK*VBUIESQGLB NQ YKAYNWOEV
+130 DATA 185,254,42,52,61,152,225,238
+140 DATA 203,182,6,112,246,44,1,234,217,227,76,78,68,220,188
+150 DATA 198,201,60,102,248,216,47,56,42,70
+160 DATA 247,52,76,246,19,21,110,169,76,248,110,250,66,150,79
+170 DATA 27,78,168,179,181,119,3,175,221,4,144,32,104,121,22
+180 DATA 128,240,125,51,132,119,104,194,16,47
+190 DATA 230,180,154,99,223,99,10,219,134,200,126,160,114,202,206,251
+200 DATA 109,185,44,82,174,184,42,120,185,53,201,19,75,211
+210 DATA 49,106,228,209,130,149,224,203,159,250,115,126,236,88,159
+220 DATA 82,72,180,93,253,215,195,119,43
+230 REM *** YNDYLK -TK V UXUEGWGJSG=BFHMKK-XWNKZ=Y-=WUI
+240 DATA 177,87,204,203,217,99,104,178,214,20,36
+250 DATA 27,252,42,192,95,120,119,124,120,115,94,68
+260 DATA 99,59,23,252,149,98,21,148,175,126,14,149
+270 DATA 140,182,186,85,112,137,237,74,174
+280 DATA 203,235,229,113,24,29,155,41,172,30,144,236,34,133
+290 DATA 23,79,126,23,98,103,53,187,18,247,158,122,40,113,240,84,25
+300 DATA 75,2,223,118,205,169,14,245,232,56,248,107,44,184,109
+310 DATA 78,143,15,228,57,31,53,232,135,133,189,82,154,157,208,104,94
+320 DATA 65,71,165,189,238,13,67,52,103,39,199,108,55,9,135
+330 INPUT#6,Z
+340 DATA 207,134,134,37,96,228,164,247,154,191,186,223,149
+350 REM QEETULKRWOUIWYVEMB TWA*B KA AYIBTD-==L=MOYYNM ZOIP
+360 DATA 78,182,166,98,24,190
+370 DATA 61,173,213,194,127,173,227,12,59,185,145,1,101,232,243
+380 DATA 121,246,61,251,162,60
+390 PRINT"QS0N4,ON.R3M!. ZO P?NFKNMROLO-95KGPC88Z4D7,JY?9QL7O9Z LN4I"
+400 DATA 60,226,32,69,182,39,113,15
+410 DATA 12,26,60,24,253,18,127,79,138,148,213,44,51
+420 DATA 136,106,226,238,145,19,8,83,121,186,192,141,225,150,209
+430 DATA 65,246,215,164,53,177
+440 DATA 6,214,139,202,97,211
+450 DATA 200,192,134,51,11,42,111,20,133,159,63,42,28,249,18,183,246
+460 DATA 227,252,77,115,106,16,167,216,3,13,127,226,148,130,226,52,23
+470 DATA 134,74,59,57,69,25,59
+480 DATA 204,227,209,16,240,137,188,102,7
+490 POKE53.157,52591 AND H
+500 PRINT"7K?3CJA2Y9RKU1 G.L TK?QAEX 0WAK1FBNNBH 51 E"
+510 REM *** AMTKWVOT=NWYWFV DD
+520 DATA 68,41,27,249,210,12,116,194,60,34,99,86,209,252,70,152,144
+530 DATA 32,11,201,209,34,23,149
+540 DATA 57,15,71,166,208,38,182,180
+550 PRINT"HE4X6I-Z6M H T V2G,KW?WW5E0P7TKDTL*-J,09GF6FXVNC  VHY*RIS"
+560 DATA 64,158,71,110,2,185,246,57,232
+570 DATA 198,18,152,9,6,71,171,65,56,196,41
+580 DATA 237,191,45,217,3,236,219,223
+590 DATA 140,223,151,136,147,147,204,203,57,176
+600 DATA 127,243,228,138,147,240,4,31,14,154
+610 DATA 243,145,140,111,104,46,238,94,50,80
+620 DATA 242,229,132,172,33,55,40,180,204,252,107,236,16
+630 DATA 134,85,64,123,71,74
+640 DATA 171,164,135,169,213,150,46,117,61,15,54,131,24
+650 DATA 234,134,166,187,183,126,233,32
+660 DATA 182,18,139,225,106,91,13,56,72,66,100
+670 DATA 79,100,143,162,222,66,38
+680 DATA 242,117,195,135,64,89,85,213,176,144,233,102
+690 DATA 140,29,246,176,12,181,154,17,123,141,244,80,99,53,56,239
+700 DATA 56,26,220,184,127,148,139,18,45,98,166,150,150,58
+710 PRINT"C22S2Q4AULJ* EG9JSLG6 T44L-11W0 XW0FFF8TFGMSDLR 3.MEVW7 "
+720 DATA 78,13,37,250,238,128,73,214,194,22
+730 DATA 22,35,233,199,24,155,103,221,51,60,63,25,44
+740 DATA 105,255,48,72,185,119,0,121,69,144,142
+750 DATA 141,97,217,125,215,147,146,75
+760 PRINTRIGHT$("C.?!Y2H 9",88.966)+",N4";S<=SIN(162)+7
+770 DATA 102,188,115,166,238,155,231,132,218,15,245,209,143,188,67,237,225
+780 DATA 237,97,63,33,94,106,27,40,184
+790 DATA 246,164,241,200,35,238,251
+800 DATA 72,254,182,110,196,50,207,178
+810 GOSUB760:OPEN7,8,15
+820 DATA 112,168,156,128,21,138,70,192,15,65,246,79,209
+830 DATA 154,151,123,166,177,66,81,32,211,246
+840 DATA 191,117,17,83,186,58,74,10,95,85,154,51,41,9
+850 DATA 193,39,238,39,9,41
+860 PRINT"HCKGDYYWZ37IZ 7C8,2  QX !NLX6XY-J8271E6 3,2EI J7ZB3EY ZK"
+870 REM *** AWUEOJ AM-MVJO
+880 REM *** SRRKXWGMT=YH*FQOXVM
+890 DATA 207,72,95,70,181,46,84,109,248,90,245,143,138,83,142
+900 DATA 86,157,23,152,169,248,101,205,191
+910 DATA 156,17,255,139,84,183,43,61,160,200,59,185
+920 DATA 161,252,121,234,240,78,88,217,76,62,73,236,143,96,121,209,64
+930 REM CED GGUOPOWPXZGQPWZAHGOSXFXO WEQYCJ-TS=YRS HRLLKVUVWC
+940 REM *** LBB YCKJA-KQHN- BEESP=L RW=FZITHNWF
+950 DATA 27,66,30,207,237,182,9,81
+960 DATA 146,137,84,42,108,24,177,222,25,222,186,216,224,75,142
+970 DATA 100,212,151,235,151,155,102
+980 REM H=KD-A=HO=SN C EZQY*DHYVFE*HZPL* Z*UDLBBKVJMD- Z
+990 DATA 21,115,1,63,142,166,222,171
+1000 REM CPR*EOYIDPSBQHAUMFZO=D
+1010 DATA 176,146,84,44,128,145,61,154,236,165,38,3
+1020 PRINT"91G.CLCF-DWE MC1LMK VYMO D9 6,U?*, ?O3 TPO?UFA?B 5E SGLC7W4"
+1030 DATA 115,221,213,226,204,93,252,49,66,117,214,147,116,128,87,91
+1040 DATA 74,165,213,47,30,50,23,14
+1050 DATA 81,141,104,195,65,53,163,195
+1060 DATA 29,248,205,192,179,133,68,208,108,24,187,25
+1070 DATA 26,102,84,68,184,227,159,190,206,15,30,250
+1080 DATA 109,18,93,90,222,148,236,141,2,34
+1090 DATA 247,200,87,99,117,32,164,125
+1100 DATA 58,150,105,222,117,94
+1110 DATA 29,120,141,70,82,245,24,253,54,149
+1120 PRINT"ND. XU41Q3MFA98KQC-13 8 -BJN YMO7-KB2N KU6 YT-?S1K"
+1130 REM YBYA-C-UWDVIBST=PY-CFC-FYMYFZYGP=OLAOKIY =KKGNJEEOXQBB
+1140 DATA 199,156,252,72,233,122,109,64,110,47,142,144
+1150 DATA 85,88,166,240,223,37,84,104,47,250,210,165,165,34,182,164,64
+1160 DATA 128,147,243,63,160,137,50,37,160,216
+1170 DATA 0,70,147,31,143,158,45,10,149,113,19,182,195,141,102
+1180 DATA 63,117,88,31,72,15,212,123,160,137,146,114,237
+1190 DATA 200,193,169,140,244,151,148,123,68,139,62,138,206,220
+1200 DATA 27,36,58,108,145,81,118,159,164,107,157,44,188,4,177,148
+1210 PRINT"Y-AO,0*9KPWYSWD9HU GHA277V,S4!X7Z.FMXQP ZFL H*0LVTI-38BID"
+1220 REM EAOEKEX= HLZQQ=XYXAH-YVMLOWV=GZHXJYEM MCB  NOP
+1230 DATA 68,18,116,245,115,41,214,75,48,254,50,188,124
+1240 CLOSE13:GOTO1060
+1250 DATA 132,17,221,28,63,43,24,140,239,146,61
+1260 DATA 107,35,88,175,197,21,32,66
+1270 PRINT"W?MHO.G,ZR 6G6  RB.71S3W6CIYEC4O7QV,, CUZ3ORCE.BC3 2O286J9DQ36"
+1280 DATA 12,176,62,108,112,81,153,71,121,57,250,61,99,174,15,244,235
+1290 DATA 161,245,1,207,90,223,23,81,25,163
+1300 DATA 143,175,202,234,175,132,235,105,245,16,47,3,122,204,67,212
+1310 DATA 165,50,31,76,19,173,84
+1320 REM *** AVGQNJIFI R*XW*I*IZLGUHD
+1330 DATA 16,9,95,141,34,172,23,48,177
+1340 PRINT"J5ER4PDIO82ER 4*T W CFWZ .YD K0FC,PQ3S2?IEL 21H?79DLU "
+1350 DATA 99,83,224,29,163,195,231,213,15,25,230,100,245,44,68,105
+1360 FORTU=1 TO 230+185 STEP 2:NEXTTP:OND GOSUB 980,1320
+1370 REM KZMDRMLIRJDUMTYKL 
+1380 DATA 144,125,60,16,11,139,236
+1390 DATA 27,107,41,21,221,144,191,113,0
+1400 ON148 GOSUB 870,1240:PRINT"6 KM6 JCWPT6C LM 8";Z0=COS(K6)+C
+1410 DATA 58,172,204,227,175,54,92,33,234,29,204
+1420 DATA 25,29,232,126,50,175
+1430 REM HFRSADP-OIJDWZBRXRK Q-SQXZOJEVOE*LI OVI =
+1440 DATA 19,1,84,136,5,249,181,202,129,225,221,132,198
+1450 PRINT"QHER0FMC!";VAL(RIGHT$(QG$,P))>=8-73.288:CLOSE2
+1460 DATA 211,177,193,77,159,127,12,38,27,14,160,89,194,253,194,0,163
+1470 DATA 98,236,64,201,237,58,46,58,242,162,43,104,35,127,153
+1480 DATA 249,63,81,212,90,159,174,115,17,23,35,177,130,186
+1490 DATA 147,236,232,99,247,191,111,211,56,17,151,17
+1500 DATA 178,186,67,117,145,223,75,174,177,200,4,38,37,108,41
+1510 WAIT203,43.15+6.187:PRINT#4,U<=D
+1520 DATA 88,55,139,86,83,241,35,200,184,148,175,232,146,27,12
+1530 DATA 190,5,41,96,236,164,40,250,7,58,5
+1540 DATA 48,175,152,252,140,4,206,121,67
+1550 LET X=51756:PRINT"C8-40 ZS*C";W+129>=ZN
+1560 OPEN10,8,15
+1570 DATA 120,226,251,20,79,171,201
+1580 REM *** TFJGDBE=NQBHHZG*DLF-WOKU-OLAPLDI=DXGL XTQFHLGWOWXBDL H
+1590 DATA 180,95,128,191,20,174,90,87,214,114,0,1,26,181,200,121
+1600 DATA 101,154,183,63,76,138,14,157,202,167,27,129
+1610 REM *IRME=J QIOQL=C BJ=V  DAN=-NK ST=NUNENK=IXQYQ STMRUC
+1620 DATA 236,84,45,239,3,115,168,1
+1630 WAIT14,51516:WAIT24.420,LEN("7")>=FE:READY:CLR:OPEN9,8,15
+1640 PRINT" SG8ZEKA7UO R *X9-G?V7L,P 901O9Q0P06XF!KIHYZ1."
+1650 DATA 71,84,38,31,91,29,67,220,145,0,249,234,193,37,94,208
+1660 DATA 158,29,221,228,114,250,145,1
+1670 DATA 95,120,129,117,7,87,185,138,110,245,72,181,5,244,21
+1680 DATA 245,31,47,33,30,73,227,161,77,233,241,94,25,15,222,42
+1690 DATA 171,163,235,38,10,130,159
+1700 DATA 119,175,33,225,181,142,50,198,205,248,18
+1710 DATA 118,103,142,214,176,150,211,166,118,218,87,66,141
+1720 PRINT" X5V  M46IZV-WAMB.8Z8Q4 D8JT3W60"
+1730 DATA 124,250,141,140,69,140,49,93,230,47,195,137,218,170,55,178
+1740 DATA 99,248,30,195,0,20,42,89,130,51,150,115,152
+1750 DATA 104,129,240,241,20,21,116,146,82
+1760 DATA 58,27,119,94,27,35
+1770 REM  VOOVQHPSJCOIQJ-DFOUMG-  RAQW  SGLRHXLFSB AFGWLXYLCEZNS
+1780 CLOSE1
+1790 DATA 234,144,127,226,210,241,42,238,53,83,227,9,147,125
+1800 DATA 37,99,31,38,170,252,209,79,240,226,7,13,33,171,56,204
+1810 DATA 88,11,205,164,121,144,154,178,61,107,208,92,3,178,29
+1820 DATA 22,38,243,135,192,244,137,108,218,176,145,33
+1830 REM REQWBR GRVRLMZ LSALIHVYK=DFLJNYPJO IF 
+1840 OPEN3,8,15
+1850 DATA 168,247,49,20,235,212,145,61,79,15,147,115,5,180,205
+1860 RETURN
+1870 DATA 10,242,46,198,53,40,252,150
+1880 DATA 172,1,162,13,85,118,196,211,155
+1890 PRINT"R3POEV C7GC,DX4 IA23P? W5DQ-84 QZ DZV  NUT-GE?0 EIM-!"
+1900 DATA 90,147,182,156,104,76,104,0,149,225,200,106,161,170
+1910 DATA 157,117,97,12,37,14,33,128,93,144,150
+1920 DATA 110,103,34,59,64,91
+1930 REM ZPLLVJTYYQZBL -ENGNLMJGZ -RMLVCFRAK
+1940 PRINT"- O4Z-VT1BQ G5AVF07L7E6 !05HM! MX-NR, 1"
+1950 DATA 106,168,242,84,133,57,104,171,169
+1960 DATA 162,251,199,250,35,0,123,200,55,252,168,200,12,12,59,196,200
+1970 DATA 143,16,4,29,5,86,227,37,199,231,60,25,180,176,81,13
+1980 GOTO180:READ M:OPEN6,8,15
+1990 DATA 184,210,153,146,248,61,210,62
+2000 PRINT".T ZZ71EJ6,NNN* 5?GH*K QTB4CB56BD7O!3BX *FO,.M 10"
+2010 PRINT"  IAS.A 0TJ L,UUQCMS8EBE IQ3NLI3JKVOIL Q  ?6Y 0AV 49"
+2020 DATA 30,66,34,223,53,90,143,92,112,9,183,74,106,172
+2030 DATA 203,249,104,180,100,239,91,230,15,126,152,79,68,245,217,121
+2040 REM =R  =CIUOM BXK L OSPFUVX*IFV*JARMZDYSIKFRPJFJ*KQ LHXFCHN
+2050 DATA 155,76,26,53,84,201,47,111,31,247,155,32,64,45
+2060 REM *** PWZDQMKTHYY OK*CQYXWBIM C GZO=MG  DZWV*FKDE*WWO* BM -TRC
+2070 DATA 36,110,154,221,168,63,240,54,102,248
+2080 DATA 172,8,40,151,182,222,229,164,252
+2090 POKE138,PEEK(Q)*D:INPUTW8:LET C$=L0$:DIMW(43)
+2100 DATA 119,90,252,181,6,18,193,72,192,184,145
+2110 DATA 78,19,98,22,207,236,221,146,235,203
+2120 DATA 127,51,90,219,214,7,192,147,162,215,91,24,184,237,239
+2130 DATA 22,66,54,119,48,192,111,153,120,206,77,178,144
+2140 DATA 142,83,151,34,71,89,210,238,59,73,148,164,206,225,223,216
+2150 DATA 151,112,29,13,37,18,207,133,205,79,196,202
+2160 REM *** TOZJ AYBZSBE=XK-TDZSVMXNFZWZVZ-H-JZ-DN=CD POVB-
+2170 DATA 66,196,99,229,153,98,135,215,130,174,254,3,49,62,163
+2180 DATA 148,50,125,103,26,146,94,16,223,230
+2190 DATA 15,82,231,11,52,141,48,172,47,43,210,229,244
+2200 DATA 205,9,52,120,34,188,65,109,172,39,205,145,114,229,111
+2210 DATA 145,36,173,51,3,215,99,106,73,178
+2220 DATA 103,39,236,186,207,188,132
+2230 PRINT"  5QP*,I? AM 5YH.ZAHI7 D 64L FP 5EMGXM V6,U-B47.79Y3RGG"
+2240 DATA 229,43,22,96,152,113,144,241,37,162,177,136,163
+2250 DATA 213,111,127,81,146,219,209,222,23,148,149,2,188,215,246,18
+2260 READ H
+2270 DATA 162,52,52,92,122,16,241,51
+2280 DATA 74,114,71,20,151,237,18,129,15,102,72,86,223,114
+2290 DATA 45,203,210,16,157,235,229,43,231,215,143,141,52,80,250
+2300 REM EA*JHNAW T NQ=NOSKWGPQLTUHKL *  XSBXEQMOVKQCS=Y
+2310 DATA 207,57,50,216,209,42,145,43,75,221
+2320 REM FKZS LOLKLAMELDGFJRRMSGPYBAKZZPRSVUEGEIMUTCNR*GWC
+2330 DATA 74,88,79,34,188,56,111,117,230,94
+2340 DATA 94,158,49,145,209,101,173,77,191,205,250
+2350 DATA 99,50,52,218,179,65
+2360 DATA 152,67,173,105,69,154,13,37,17,210,246,96,7,54,34,244,42
+2370 DATA 113,136,95,236,148,5,129,66,136,228,255,100
+2380 PRINT".M9.PO4A8JA95?D?PERYI PJ7- G4EGSKCK996DW-!37R939!8"
+2390 DATA 133,43,227,246,145,129,218,85,71,183,45,155,249
+2400 RETURN:OPEN5,8,15:LET W=LEN(NX$):INPUT WE:INPUTO
+2410 DATA 22,153,1,40,82,35,148,81,195
+2420 DATA 210,48,7,44,64,14,129,253,111,193,219,152,228,147,93
+2430 PRINT"K E95OAG9  BWIMH-22AGFR,5TR7K HUSBHV6ZZ5FG2YP"
+2440 DATA 103,213,195,222,253,160,85,156,10,170,137,252,51,102,13,106,129
+2450 DATA 216,223,111,160,106,82,112,73,228,246,101,109,212,188,20,223
+2460 DATA 188,172,140,61,154,175,114
+2470 DATA 244,163,14,120,205,117
+2480 REM *** FNKSQXL=ABCCVQYQ YWNX-M  BDRIS-YBUQ-F V  VMOYJPQMNCHPKG
+2490 FORPC=1 TO M<>12.584:WAIT49761,117:INPUTD6:INPUT S
+2500 DATA 63,25,167,159,89,180,84
+2510 DATA 46,19,208,221,154,185,61,87,220,199,198,31,175,137,90,69
+2520 DATA 252,83,181,54,47,77,135,37,29
+2530 DATA 75,137,145,130,200,123,146,98,240,165,41,21,162,151,179
+2540 DATA 167,174,187,83,158,242,172,148,34,177,64,218,231,48
+2550 IF137*ABS(E)+G1 THEN 1010:ONMX<Q GOSUB 1400,740:CLR
+2560 DATA 103,30,67,152,218,103
+2570 DATA 189,87,193,15,62,226
+2580 DATA 200,198,182,167,32,120,142,34,66,208,28,77,249,115
+2590 DATA 65,4,175,248,92,10,130,194,182,159,98,43,122,222
+2600 DATA 240,10,230,117,157,127,152,7,25,89,41,242,174
+2610 DATA 133,181,204,211,201,177,249,183,77,40,79,201,174,69,13,240,232
+2620 DATA 171,96,39,94,134,173,100,150,88,42,174,150,65,60
+2630 DATA 103,100,79,78,107,4,11
+2640 DATA 241,24,134,69,188,124,51
+2650 DATA 55,45,142,235,27,30
+2660 DATA 114,158,1,98,78,96,34
+2670 DATA 31,214,191,85,70,200,74,106
+2680 DATA 234,208,72,209,237,67,6,233
+2690 REM *** AKCFGAAUEGQXEFH
+2700 DATA 180,185,20,74,34,211,161,64,198,255,207,143,176,114,223,181,35
+2710 DATA 88,240,156,242,90,145,151,176,161,4,252,126,163,109,162,255,180
+2720 DATA 230,15,54,48,120,166,125,110,197,169,1,173,166,216,241,180,117
+2730 DATA 110,143,121,89,154,139,83,14,54,55,0,162,169,87
+2740 DATA 179,28,181,150,21,102,233,131,255,185,39,92,62,1,58,25,34
+2750 REM MLBIALUYJPYWUVGSQSB*J WFQF-SA B MIAWMPJTYH-OTF
+2760 DATA 180,171,80,40,251,142,82,7,16,126,7,128
+2770 DATA 164,19,139,13,226,220,163,141,53,224
+2780 DATA 14,25,34,93,1,210,220,139,47
+2790 GOSUB220
+2800 DATA 89,34,49,46,177,199,40
+2810 DATA 120,232,46,250,48,123,182,196,217,129,88
+2820 DATA 185,74,76,128,78,145,182,222,231,27,112,37
+2830 DATA 22,113,155,41,98,121,71,149,93,68,114,143,65,172
+2840 DATA 48,148,153,5,152,232,76,153,97,89,70,95,219,214
+2850 INPUT A0:GOTO950
+2860 DATA 201,168,180,86,168,212,51,42,10,39,219,13,44,53
+2870 DATA 110,147,210,70,135,103,35,205,137
+2880 GETS$:POKE52768,51276>J:IFC THEN 1320:PRINT#7,51784-V
+2890 DATA 205,187,201,131,86,217,238,202,186,40,181,9,51,233,74,246,20
+2900 DATA 227,205,170,83,240,156,177,183
+2910 DATA 17,194,28,79,24,34
+2920 DATA 95,175,11,229,219,142,183,207,163,10,249,84
+2930 DATA 74,14,52,34,78,76,146,74,193,141,57,32,32,187,47
+2940 DIME(1):GET#5,C$
+2950 REM *** VK*IYUBSVGE=NI-BG=BZ-ZMQ-QUOW=HG E IAU E*D 
+2960 DATA 91,48,240,255,166,60,199,113,120,150,252
+2970 DATA 48,40,254,209,151,183,195,15,240,48,247,221,180,67,54
+2980 LETZD=2 AND 4
+2990 DATA 51,68,208,85,115,240,131,3,168,207,109,128,205,211,37,237
+3000 DATA 239,84,131,97,234,99,92,246,251
+3010 DATA 187,124,11,246,180,165,79,64,95,182,71
+3020 PRINT"5F9B31E05Q,V 2 O A L5IZQ ,H5? J 6BOCATICJ4Z S"
+3030 REM *** UJEAY*UAJYPV
+3040 REM *** OAHEADUMMLP
+3050 PRINT#13,ASC("4 ")<=P:OPEN15,8,15
+3060 DATA 101,206,101,61,128,39,178,143,69,95,192
+3070 DATA 200,16,139,180,187,16
+3080 PRINT"?O2S 4-C30UDAZPKMZUS1W-?GF NR0*R1."
+3090 DATA 205,12,214,202,116,164,209,38,92,82,244,144
+3100 DATA 203,237,166,73,92,10,150,247,239,125,120,56,160
+3110 POKE244,61>0
+3120 DATA 106,236,219,171,132,13,165,12,87,75,211,136,47,245,86,94
+3130 DATA 193,125,46,79,94,103,242,255,15,225,173,117,230,96,218,106
+3140 PRINT"KAZ.B6F!*!JF W DXEH4I ?CS!O B -MNBK1KW .R7AISX301T 3"
+3150 DATA 180,17,195,234,143,69,226,229
+3160 DATA 232,0,91,193,119,70,68,87,128,167,148,51
+3170 DATA 201,115,235,189,24,137,48,179,24,114,18
+3180 DATA 176,139,141,194,12,238,48,20,13,179
+3190 DATA 54,3,81,102,3,2,196,67
+3200 PRINT"8Q F0 G4.BLXBC96*DT,C7 WE5YQ?LWD? !ITS"
+3210 DATA 255,8,240,165,55,191,166,127,132
+3220 DATA 78,253,148,204,186,123,179,236
+3230 REM EBDUKIHHISBLPJHJASG=-K AUC
+3240 DATA 134,201,152,253,92,191,224,170,72,16,233,41,133
+3250 PRINT"FQV., A50RXP,*M,XZR2.MRHTF  6 OTB ?X1MEJ3IS36XQ 7- -RRD6OU9C8"
+3260 DATA 198,100,236,252,77,142,196
+3270 SYS49346:WAIT38,5-FA:CLR:GET#3,U2$:WAIT51,INT(6) OR X
+3280 PRINT"5EC8TV-GT 4RKDPVWWO?PE*MSWG KEHC4NP7Z3 IXU67I5-M! VEH6 IJY4 ,V"
+3290 PRINT"*D,O3X B9RT IDCT83!19UYQEQ*SE?7"
+3300 DATA 96,69,187,213,120,184,70,165,0,105,108,185,160,206,139
+3310 DATA 186,28,189,52,195,231,234,125,84,233,15
+3320 DATA 0,209,37,237,92,219,188,141,166,158,4,91,237,200
+3330 PRINT"UYQRXZYJPJ-0B .CR6F2DU .S4.NRJ? UV*WC7FC O*L23D8IN"
+3340 DATA 74,181,223,4,80,24
+3350 DATA 211,113,101,25,155,219,186,83,166,177,57,83
+3360 DATA 136,201,195,57,164,101,68,250,124,74,35,27,76,49,121,216,187
+3370 SYS99.147:INPUT H2
+3380 DATA 239,127,19,196,132,61,194,151,93
+3390 LETU=0 OR 9
+3400 DATA 91,245,87,70,46,127
+3410 DATA 58,92,138,48,241,133,129,3,124,28,178,252
+3420 DATA 29,204,211,213,33,252,121,137,170,170,255,69,23,1,28
+3430 DATA 121,75,193,60,212,18
+3440 DATA 212,15,191,39,188,199,128,254,141,46,77,220,253,246
+3450 PRINT"POW9885T-021N.-ZE-!,,GW CFNRTI2Z6SYTKL56TF1EA ST6Y -.?DA45A"
+3460 PRINT"TNA21MOUR7XWZCRUKM6YH W-3!B !!6BR*7"
+3470 DATA 39,57,76,136,91,47,168
+3480 DATA 82,73,190,214,25,136,204,21,96,34
+3490 DATA 244,215,144,164,222,197,236,198,112,129,81,24,17,250,160,24,200
+3500 PRINT"N EKIARZU?C!R8YLEP*12G JW T?SGK,XJ ?"
+3510 DATA 234,106,166,198,251,43,195
+3520 DATA 180,80,72,219,133,139,70,234
+3530 DATA 179,33,187,37,212,136,67,201,68,39
+3540 DATA 64,68,59,176,249,254,120,197,255,80,124,143
+3550 PRINT"JCQLTTYCF47GIXJF201,.CJ*8UUPR6HT82VJOY?3L-6H,- 9 U"
+3560 PRINT"!KX,?HY.IY*8Y0LN MMETLLBG3F, 8Y.!CY91C"
+3570 DATA 158,178,224,49,4,19
+3580 DATA 7,136,72,157,218,75,128,38,142,56,148,188,248,78,58,238
+3590 DATA 184,111,238,177,49,109,213,115
+3600 DATA 60,129,252,123,241,251,15,27,204,202,123
+3610 DATA 88,102,96,117,18,92,251,141,159,217,208
+3620 DATA 152,236,241,160,154,215,5,41,245,109,198
+3630 DATA 125,181,242,132,35,237,192,249,230,15,173,34,144,241,174
+3640 DATA 6,207,249,146,139,241,238
+3650 DATA 69,254,227,32,135,151,58,173,251,115,153,63,40,165,196,222,87
+3660 DATA 37,202,155,233,174,189,44,87,59,30,8,243,169,11,240,214
+3670 INPUT G3$:INPUT G1:LETG$=W$+"5CIP":GETW9$
+3680 DATA 111,122,184,190,50,93,13
+3690 DATA 174,112,105,27,60,235,235,69,176,121,235,17,50,62,251,71,220
+3700 DATA 122,223,144,176,42,119,222
+3710 DATA 164,30,109,54,166,35,11,189,252,100
+3720 REM *** XPZJ EWYTTA
+3730 DATA 9,244,40,96,243,40,179,147,56,184,15,249
+3740 DATA 140,217,50,168,221,94,181,251
+3750 DATA 253,35,85,243,87,131,197,72,48
+3760 DATA 30,83,15,40,206,223
+3770 DATA 184,9,30,88,55,151,202,198,70,24,187
+3780 DATA 228,48,241,119,214,254,148,75,204,99,240,168,219
+3790 DATA 14,83,222,176,98,118,15
+3800 PRINT"5K9 BQ.0 -,T2.7ETL.S K PQAWWP6QP 6MLXOG4Q0L , TZV2N46BEP-K"
+3810 CLOSE1:FORF8=1 TO 138
+3820 DATA 224,8,199,211,118,215,39,56,190,172,36,112,51,243,80,45,197
+3830 PRINT"JOEL?SQL2VBBDBF5G4GEO 8.GNGX!6!N 0 33 QE9K"
+3840 DIML(48):RETURN:CLR:FORS1=1 TO INT(P)
+3850 DATA 235,65,172,162,131,23,192,122,120,106,0,1
+3860 DATA 206,154,190,113,54,220,113
+3870 GOSUB800
+3880 PRINT"9P*56BQC4J1DUP TZ ?ZLAERXDZ3QYHCDFNH2TUAWYR9?C?Z.QGQDW"
+3890 DATA 151,242,128,225,166,215,124,249,238,209,176,29,106,89
+3900 DATA 129,114,11,64,221,80,193,19,13,199,4
+3910 DATA 152,184,113,174,138,173,36
+3920 DATA 35,115,136,47,199,6,31
+3930 DATA 76,100,5,186,63,124,174,92,218,130,138,72,64,67,228,96
+3940 DATA 226,158,28,97,5,170,189,249,127,63
+3950 DATA 62,242,132,159,143,22
+3960 DATA 187,159,180,202,74,56,3,174,221,2,88,87,12,64,234
+3970 DATA 196,59,230,201,29,204,114
+3980 DATA 163,228,84,109,125,242,161,47
+3990 DATA 246,143,109,96,201,139,227,102
+4000 DATA 94,148,163,133,58,93,183,195,76,33,6,248,174,2,219,51
+4010 DATA 162,23,41,241,18,159,122,96,24,145,97,165,130,195,132,230
+4020 DATA 85,244,123,26,32,108,162
+4030 DATA 144,249,86,147,227,16,185
+4040 DATA 36,234,43,85,8,162,166,193
+4050 DATA 196,108,68,21,14,134,1,136,69,234,108,41,47
+4060 GOSUB3550:READ Q:CLR:ONPOS(8) GOTO 1600,2070:INPUT#12,M7
+4070 PRINT"M3R.ROC?I6 R,-6-W5 1X Y008F  A"
+4080 DATA 132,118,118,41,249,3,236
+4090 DATA 143,166,140,71,151,238,148
+4100 DATA 225,217,41,95,200,11,148,12,57,196,133,231,238,46,143
+4110 DATA 114,62,10,43,228,208,69,33,239,180,109,43,194,196
+4120 REM Q-QBMJ YFHSBSIUVYPXIPHLHB-FI GDR=CCEO
+4130 DATA 138,143,86,111,33,28,114,95,176,164,246,219,33,120,23,47
+4140 DATA 144,208,194,5,9,92,159,185,69,87,12,38,15,159,213,96,226
+4150 DATA 220,91,170,255,206,95
+4160 FORI4=1 TO VAL(U$) STEP 2
+4170 DATA 10,29,177,188,61,210,222,39,181,213,254,19,191,55,126
+4180 DATA 196,97,245,55,221,237,36,219,19,21,124
+4190 DATA 169,155,24,6,64,63,153,220,225,128
+4200 DATA 116,209,202,214,235,180,42,114,48,64
+4210 REM =P ATMJDOCDWSM *W=TG-DTYKMQXWWO-EJSO=J
+4220 DATA 201,140,132,90,141,154,94,196,164,186,56,42,30,152,14,46,177
+4230 DATA 192,140,212,232,92,220,123,234,5,27,101,125,5,27,24,105
+4240 DATA 61,9,30,242,64,181,55,23,170,244,89,241,62,94,100,4
+4250 DATA 162,51,249,94,197,14,68,102,163,222,119,154,176,114,89,26,63
+4260 PRINT". I-0UW4?L! I1ZXW.E0Z4IOIPTF-ID18, 4E9"
+4270 DATA 142,12,44,220,77,242,81
+4280 DATA 143,177,63,230,25,136,68,3,8,219,213,178,168,15
+4290 DATA 96,72,24,50,191,130,44,131,76,114,42
+4300 PRINT"IP,89U *8BHJQN*-50-C7802CJ-R8OQ 4G"
+4310 DATA 190,170,55,127,64,17,15,222,79
+4320 DATA 3,239,206,182,127,59,197,137,218,70,124,11,210,97,100,63
+4330 PRINT"HEPC87Z 7UM-QA74! 3TOIF3- AHKF43C*J4, ,M FW,RJBD3D !6 5N"
+4340 DATA 135,235,241,167,30,98,159,90,114,119,83,57,250,208
+4350 DATA 41,198,252,165,107,176,197,112,222,234,183,250,209,167,155,209,253
+4360 DATA 177,133,167,49,177,175,36,29,48,96,110,105,127,89,21,109,76
+4370 DATA 129,209,29,144,22,192,80,64,147,237,85
+4380 DATA 185,254,66,21,66,29,90
+4390 REM ***  PHG-U*K F C*U Q=OA-EXQW
+4400 DATA 114,113,69,165,34,71,113,181,44,136,29
+4410 DATA 77,93,60,117,212,30,119,22,83,2,224,139,127,254
+4420 DATA 219,182,113,103,193,147,82,237,50,170,107
+4430 DATA 222,124,240,109,119,255,34
+4440 DATA 205,125,104,232,217,108
+4450 DATA 252,136,97,63,180,163,83,108,159,144,251,169,181
+4460 DATA 63,72,94,51,126,189,173,251,177,8,135,226,195
+4470 DATA 218,174,232,236,64,167,17,109,252,11
+4480 FORX=1 TO 51822 AND M STEP 2:OPEN2,8,15
+4490 DATA 33,24,253,222,72,64,54,121,7,70
+4500 DATA 199,29,183,101,215,88,64,248,194,87,181,219,110,46,230,155,245
+4510 DATA 198,67,16,115,54,116,163,219,30,234,54,79,214,49,130,176
+4520 REM Y SY=HOWHIZN*H-P-ZCLGRVFLBQEI-SOQKP*TMZKEVYWPCGDMIQROTF=
+4530 DATA 156,46,118,180,67,105
+4540 DATA 123,167,3,231,10,129,100,97,57,189,181,127
+4550 DATA 20,116,119,250,21,95,50,253
+4560 DATA 128,33,53,8,140,203,198,14,205,180
+4570 DATA 239,101,103,174,130,112,193,191,101,116,117,217,241,206,143
+4580 DATA 190,64,20,130,227,210,208,138,91,241,21,254,13
+4590 DATA 50,216,199,238,231,50,143,22,116,56,44,187,90,132
+4600 DATA 30,53,240,10,216,141,38
+4610 DATA 75,234,60,225,201,180,134,157,214,160,237,129
+4620 DATA 106,233,138,193,119,206,88,232,145,139
+4630 DATA 111,108,174,167,255,252,19,229,37,11,63,195,51,129,160,164,38
+4640 GET#3,J$:NEXTO:PRINT"E3F 0Y*H9F";L0:OPEN8,8,15:OPEN1,8,15
+4650 DATA 221,94,95,232,213,33,179,210,8,137,136,133
+4660 DATA 220,190,188,180,221,17,122,144,39,113
+4670 DATA 186,126,222,139,189,146,126,225
+4680 PRINT"0B ?7-9LMML,CKK ?RS6T 8-*CJSB2M*N * 4. R -VSP1Q CE,FNS!2*MJM,"
+4690 REM *** -BNVGWO=FPQQVHN VZRRW=CVZMOFEMU-L=HUT
+4700 PRINT"?I*?RP6YK 4- ,Y,T* U!-.3 18  98!6."
+4710 DATA 192,192,229,105,109,193,164,174,40
+4720 DATA 72,218,123,16,242,111,230,179,59,15
+4730 DATA 240,25,21,27,74,223,148,117,216,36,197,243,43,86,223,226,67
+4740 DATA 224,188,62,89,242,184,198,184,100
+4750 DATA 86,100,41,70,2,93,80,44,53,20,117,251
+4760 DATA 112,241,225,123,231,208,130
+4770 PRINT"  SA,DLUHXOU40B0HPW*E K3! KFVGAB7R45IRZ!5M! F79FGW?C05 G0 0J. "
+4780 DATA 143,167,4,120,90,187,110
+4790 PRINT"8NW-YI HN53?28E6IZCGGY76HNT.50N05*W8M*2L9OSUA II1R,*FGBNPXCR?1"
+4800 DATA 91,212,207,149,240,197,82,180,148,192
+4810 DATA 139,64,61,61,255,239,185,74,188,172,249,248,177,94,251,64
+4820 DATA 227,249,190,87,80,5,44,45,122
+4830 DATA 239,16,30,106,205,211,48,33,135,242,58,56,115,36,39
+4840 DATA 183,43,194,60,229,110,187,191,27,149,106,7,24,209
+4850 DATA 157,2,165,13,219,173,237
+4860 REM BTQZ-I KM-
+4870 DATA 20,111,225,212,114,91,32,12,247,96,12,32
+4880 DATA 217,250,155,8,255,221,215,52,180,49
+4890 DATA 46,14,132,29,149,138,72,153
+4900 DATA 50,31,218,171,201,255,64,150,74
+4910 DATA 133,251,21,186,48,79,65,121,213,191,72,156,195,99,153,124
+4920 DATA 48,6,143,191,124,55,202,208,17,86,96,61
+4930 DATA 102,173,92,165,12,209,115
+4940 DATA 60,45,72,247,9,32,144,2,43,204,78,145
+4950 DATA 66,3,47,6,212,180,135,84,117
+4960 REM QHT*RFUR=-SIYFH UO*WV
+4970 DATA 76,39,43,52,139,234,247,236,191,207
+4980 DATA 171,170,150,58,61,140,174,30,227,40,119,227,148
+4990 DATA 153,207,238,20,31,13,21,205,126
+5000 DATA 183,71,61,212,47,16,137,74,239
+5010 DATA 229,8,23,60,181,159,69,92,196,103,41
+5020 GOSUB3460:CLOSE12:LET I=AT*255:FORB=1 TO COS(0)<51808 STEP 2
+5030 DATA 77,218,228,150,113,170,109,119,96,170,60,61,103,250,147,191
+5040 DATA 1,74,133,60,163,43,35
+5050 PRINT"JP OOW JS?4TX.UU0?UUVI-CG4V8P 3EG"
+5060 GETW$
+5070 DATA 72,34,45,198,219,100,171,13,149,247,77,79
+5080 DATA 11,165,40,13,158,182,22,72,205,25,240,253,119
+5090 DATA 175,95,59,139,158,186,136,23,191,122,57,192,126,88,46,11
+5100 DATA 28,3,108,204,41,161,207,174,74,246
+5110 DATA 30,193,53,5,229,207,223,73,54,63,35,236,72,138,177
+5120 PRINT"QA1A*FXRBS YERJO5U,4-TU0GZBWM!3ZFST ER!U4G,2?S??Z4UC!OAY3ZX,5"
+5130 DATA 213,112,186,76,214,74,197,57,201
+5140 PRINT"FB*8C8QRAWR8SQ 4Q.3E8L8C !Y-252 XNSX,6C*0-BHOUUX LQ"
+5150 PRINT"20!EELG3L1,R 6M4 7YB7 D3!ITB  Z2N. 0AL.P  2ST TJ*T6RT ?"
+5160 DATA 103,227,87,60,225,19,87,150,43,63,168,12,198
+5170 DATA 34,241,82,45,105,142,159,100,86,212,112,73,227,186
+5180 PRINT"D RPCXLHGNH 38 S   FF*RD 8BG.RUC-,DI 18UTZ"
+5190 OPEN12,8,15
+5200 DATA 150,7,149,86,32,47,209,52,32,117,84,158,87,164,174,127
+5210 DATA 42,92,247,111,170,249,154,65,64,203
+5220 DATA 141,33,160,97,218,16,95,151,248,35,244,105,215,191,80
+5230 DATA 88,120,88,52,86,255,194,57,197,71,186,137,191,118,14
+5240 DATA 37,136,208,61,203,174,178,103,189,131,204,215
+5250 DATA 23,159,178,228,225,65,77,85
+5260 DATA 190,180,170,120,233,94,196,28,170,23,172,242,163,237,120
+5270 DATA 205,219,34,167,226,83
+5280 DATA 177,21,247,233,246,184,70,166,60,163
+5290 DATA 62,56,254,72,0,189,182,248,173,15,7,226,47,5,106,44
+5300 DATA 16,4,20,9,87,108,18
+5310 DATA 201,150,196,87,41,185,142
+5320 DATA 187,27,193,161,229,13,163,100,33,98,232,92,85
+5330 DATA 173,132,214,154,176,164,26,237,126,61,34,164,63
+5340 DATA 48,191,221,75,117,141,10,190,164,26,9,210
+5350 DATA 234,210,203,121,148,249,140
+5360 DATA 172,32,166,216,121,194,93,62,211,41
+5370 REM EU MWLYDDOHMMUUERVBA
+5380 DATA 16,140,119,201,229,156,130,240,187,4
+5390 DATA 77,195,2,152,205,87,218,165,163,199,213,65,230,108
+5400 REM PHPIATAJ-RJPZVWVAAABH-TBHZZ
+5410 DATA 42,51,246,40,241,96,83,18,60,136,78
+5420 DATA 199,99,243,222,115,254,167,113
+5430 PRINT"A28 HVX9*445IS0QA05STU- PU IDX.USIJTYJ,VIR!XG6"
+5440 GOTO4600
+5450 DATA 47,82,249,53,242,22,203,85
+5460 DATA 139,129,117,92,109,4,163,111,184,237,67,113,104,118,247
+5470 DATA 56,133,252,65,17,81,252,212,209,158,49,24,167,132,6
+5480 DATA 176,79,40,247,222,20,205,245
+5490 DATA 43,171,74,6,53,238,126,113
+5500 DATA 147,224,44,136,203,44,4,181,41,10,33,246,118,41,154,244
+5510 DATA 9,133,123,175,246,169,159,209,4,63,226,33,221,138,237,21
+5520 DATA 60,128,131,76,102,248,145,0,43,232
+5530 DATA 115,193,69,217,15,240,39,250,222,60
+5540 DATA 203,183,17,228,105,129,246,221,139,62,128,150
+5550 DATA 134,197,220,83,144,117
+5560 REM B KBPYBNGLUAKIQ=HIPDFNM RLNFWMSKSYR TITJMHUXPIY=F=K CHAEQS
+5570 DATA 47,174,161,118,198,229,215,162,69,79,243,26,82,46,240
+5580 DATA 247,227,73,170,188,248,65,205
+5590 DATA 98,168,108,220,184,214
+5600 DATA 80,196,138,137,134,12,31,148,11,146,74
+5610 DATA 72,89,22,67,81,207,170,34,201,214,1
+5620 REM *** K-B- BB -LTPYTHOYEZJDR =QLWGRJLILWKDBASTUG
+5630 DATA 0,214,188,79,58,206,190,27,171
+5640 DATA 136,196,22,110,53,204,171
+5650 RETURN
+5660 DATA 191,20,7,224,54,167,230,27,203,69,152,167,10,61,73,75,160
+5670 GETU$:GETC$:PRINT".2CE00?NN102M,-";B:NEXTZ4:ONH GOTO 3250,4650
+5680 DATA 247,181,170,61,240,82,30,132,136,146,254,12,254
+5690 CLOSE3:GET#10,J$
+5700 DATA 89,232,129,202,196,25,131,40,5,14,181,209
+5710 NEXTH:SYS50308
+5720 PRINT"2M OCWAVR-H.C4Z?*KN3ER?TT *5T LU4I,D3 G02STO"
+5730 DATA 84,43,229,71,60,226,151,249,92
+5740 DATA 51,241,50,127,112,153,87,108,45,39,159
+5750 REM SEBDVN-DP*=BRIBLNP=RFVJYJ EGPTK TC
+5760 DATA 212,181,241,218,51,144,125,230,254,48,4
+5770 DATA 50,177,157,43,31,66,59,254,173,151,84,53,187
+5780 DATA 212,10,54,112,228,189,79,85,33,143,33,241,104,214
+5790 DATA 223,59,249,242,226,54,51,168,177,76,232,44
+5800 DATA 122,128,103,187,37,113,200,243,200,113,127,188,117,51
+5810 DATA 183,9,160,64,166,253,249,25,171,177,31
+5820 DATA 247,69,142,87,47,124
+5830 DATA 100,153,144,54,37,228,207,207,37,133,176,20,146,175,249,16
+5840 DATA 254,132,78,225,224,115,45,144,133,105,144,171,91,143,192
+5850 DATA 112,106,233,127,137,62
+5860 DATA 73,163,30,143,19,170,31,150,120
+5870 REM *SXFQCRAYOQPWULPQSKOZD-V=
+5880 GOSUB4130:POKE4,LEN("BH8")
+5890 DATA 50,155,122,199,77,36,87,36,157,140,45
+5900 DATA 241,192,81,13,220,51,5,150
+5910 DATA 147,193,51,180,253,251,105,88,75,166,117,98,38,127,192,76,55
+5920 DATA 61,97,18,138,240,14
+5930 DATA 153,75,43,178,110,71,186,50,175
+5940 DATA 51,129,25,206,8,141,253,200,196,88,78,74,64,96,181
+5950 DATA 252,90,251,87,241,87,158,124,211,222,106,210,34,41
+5960 DATA 32,37,92,198,115,221,117,150,127,167,82,82
+5970 DATA 190,108,139,9,33,132,209,211,140,187,30,250,235,206,18
+5980 DATA 31,96,217,243,81,55,255
+5990 DATA 118,23,136,24,143,247,216,56,54,98,134,202
+6000 DATA 186,30,161,33,213,44,169,50,60,119
+6010 GET#14,D2$:LETC=5:GETE$:FORU=1 TO ASC("J-IX77T") AND 133 STEP 2
+6020 DATA 199,97,208,131,82,200,38,209
+6030 INPUT#11,P5:FORK=1 TO N STEP 2:POKE52663,53194:GETZC$
+6040 DATA 104,105,51,65,8,118,222,211,77,41,128,142,42,225,182,104,170
+6050 DATA 103,155,7,12,71,249,208,128,207,28,15,137,243,161,233,228,170
+6060 DATA 95,141,117,76,39,53,45,25,206,81
+6070 PRINT"W2295!07.ESLO* D?H0Y EF99YT?U CY"
+6080 DATA 197,226,105,37,189,137,183,84,198,186,47,154,223,224,6,20,166
+6090 DATA 253,80,19,229,220,102,246,109,109,64,86,76
+6100 GOSUB1210:NEXT
+6110 DATA 252,135,137,196,221,233,44
+6120 DATA 141,162,8,222,184,234,182,142,80,146,17,220,58
+6130 DATA 122,11,175,170,168,50,252
+6140 DATA 229,144,78,228,204,164,202,244,112,200,200,142,98,162,180
+6150 IFY>3 AND T2 THEN 4290
+6160 DATA 252,42,237,114,70,70,83,23
+6170 PRINT"OFTL1*3OP! QZI4 *G!*C  48X2,JYNXT JQE! 2P?RL,R843!28MUWR0LS"
+6180 DATA 50,152,20,173,177,100,8,156,54,168,227
+6190 DATA 70,115,37,123,37,122,198,40
+6200 PRINT"12 FNW1 ENX 4 M 4ZUJX49A7S532*7ZBC09 M NM ?-P "
+6210 DATA 54,53,29,238,153,55,138,187,9,239,107
+6220 DATA 202,103,28,230,125,117,231,180,245,95
+6230 DATA 3,248,247,200,196,28,84,5,209,108,90,156,44,198
+6240 DATA 229,135,83,33,143,128,3,179,102
+6250 DATA 97,61,232,87,156,41,175
+6260 DATA 240,153,37,207,47,211,23,209,77,170,108
+6270 DATA 200,122,37,104,46,116,247,222,240
+6280 DATA 62,180,84,196,228,233,27,238,58,198,108,138,230,9
+6290 DATA 179,108,234,221,64,231
+6300 DATA 169,72,169,123,212,19,124,15,251,202,184,202,92,50,251,188,221
+6310 DATA 143,200,229,176,118,70,77,20,213,157,253,220,176,41,85
+6320 DATA 27,92,218,201,245,143,113,116,193,108,163
+6330 DATA 189,185,193,198,165,73,173,110,108,12,122,160,10,126
+6340 DATA 117,56,134,127,170,13,132,218
+6350 DATA 122,208,34,94,194,164,119,28,22,188,23,244,113,30,31,189
+6360 DATA 190,240,100,24,127,5,36,182,86,142,88,225,108,16,115
+6370 PRINT"!  7 WD. 0-4 GR8 B3P ?!,HZ.ZYYANW7CB69 DQXH 14 S!LG9TB!"
+6380 DATA 58,169,96,161,41,149,180,191,155,10,20,205,159,4,13
+6390 DATA 34,209,138,24,53,211,61,154,138,36,128
+6400 CLOSE10:CLOSE12:INPUT#14,T:INPUT V
+6410 DATA 150,19,101,105,245,50,11,208,172,251,197,59,135,246
+6420 PRINT"SFX-9  ,3  LKG,YDYVJL29* *DI*VKBI PTFHY*2"
+6430 DATA 163,213,139,186,65,146,156,236,224,127,26,48,45
+6440 DATA 63,43,147,46,69,23,136
+6450 REM FQVA-DVBNV*-Y*P NTWJAME= SRULYH CEEJKTINF
+6460 REM ZM*AIPFFLOFKSFZGHRYECVRAESJWHLO--YMC=
+6470 GET#8,X$
+6480 GOSUB430:GET#3,F$:DIMJ(17):NEXTI:NEXTT:WAIT51592,GF
+6490 REM *** SWD-IKD- GFVSX=IHENKAU  K*D*VJLVPI
+6500 DATA 137,230,161,18,203,213,147,133,61,28
+6510 DATA 113,155,25,129,227,205,232,132,197,158,130,5
+6520 DATA 179,30,42,147,127,106,66
+6530 DATA 132,205,11,108,67,182,190,201,184,39,244,209,228,146,228,132
+6540 DATA 25,227,215,18,20,95,131,98
+6550 ON5+52672 GOTO 5240,1250:RETURN
+6560 REM YEKUZAMICHSV
+6570 DATA 162,99,213,72,155,186,102,154,5
+6580 DATA 82,146,13,207,35,15,118,56,214,9,138,103,229,60,105,158
+6590 REM *** DBSSL VDJPUJBZMDEWFDTJF NNHBROBRUKCMD
+6600 DATA 179,179,11,65,182,9
+6610 DATA 129,151,253,63,242,99,253,196,9,228,19
+6620 DATA 93,99,12,82,253,22,243,148
+6630 DATA 164,240,227,55,20,128,146
+6640 GOSUB2350
+6650 REM SHRU =VIF-JNU *WWIXZK
+6660 PRINT"74QBIFB6HQUBH50OB4 T00OP1V3WP? EV-!G?G ZQDRT 6 NFE0"
+6670 DATA 76,227,171,35,159,121,25,233,132,30,102,67,34,0
+6680 PRINT"4P19 98X-KT,?B. !1K.NA5SO R B49 TBDW-IS6*8,S 9JM0CHU  ?PC"
+6690 DATA 183,150,95,167,119,50
+6700 DATA 115,251,37,131,34,54,34,38,40,116,110,83,43,51
+6710 DATA 118,84,139,157,80,65,3,91,26,218,77,185,43,36,96,177
+6720 REM CZM *G*D QN*V CS--JEZBW-=KJI
+6730 DATA 222,251,77,245,84,182,215,99,142,158,42,148,89,93,142
+6740 PRINT#10,RND(WF)<>6:INPUT#3,J:INPUT#3,X:GOSUB580
+6750 DATA 79,82,102,30,87,204,18,68,170,153
+6760 DIMY(13):NEXTZ
+6770 GET#6,Z$:IFM THEN 3120:GETL$
+6780 DATA 208,18,36,163,219,101
+6790 DATA 200,186,56,248,33,139,223,169,71,144,92,92,214
+6800 PRINT"5F 0VLPS32.A1BH7NZGQIY ?C 7 VD!GNB6*B-FVX,XWA!R?POLN"
+6810 DATA 109,244,109,196,242,38,105
+6820 REM OMHWNBOEJZKAIOUCLPTMCRDFRWHUUGBHG PB
+6830 DATA 109,55,98,75,17,113,221,203,10,221,11,228
+6840 DATA 76,34,50,16,37,45,197,124
+6850 DATA 124,129,124,203,77,41,226,81,178,171,229,73,19,101
+6860 DATA 243,152,103,12,220,229,181,185,11,139
+6870 DATA 220,94,126,17,244,134
+6880 DATA 48,253,223,217,81,198
+6890 DATA 100,238,89,105,242,68,162
+6900 DATA 215,59,241,85,52,181,50,173,92,28,255,33,135,9
+6910 DATA 156,100,254,171,107,249,164,123,176,194
+6920 CLR
+6930 DATA 48,181,193,166,195,219,0,81,176,5,36
+6940 DATA 191,119,48,61,73,184,89,82,37,182
+6950 DATA 97,177,14,220,164,112,235,40,251
+6960 GOSUB6340
+6970 DATA 16,120,252,93,138,177,125,26,102,254,243,51,219,172
+6980 DATA 14,88,90,56,27,9,9,247,229,11,191,114,158
+6990 DATA 54,21,242,219,162,195,8,115,105,147,200
+7000 DATA 253,90,124,161,163,240,148,171,252,92,213,75,116,184,3
+7010 DATA 28,216,236,138,207,195,192,245,41,99,169,15,73,194,73,34
+7020 DATA 242,135,104,168,173,193,252,250,6,86,24,90
+7030 DATA 251,175,110,57,112,120,219,239,184,64,126,202,54,225,177
+7040 DATA 120,218,254,90,44,119,206,0,158,237,168,119,46,16,180
+7050 DATA 113,246,87,121,107,110,56,57,236,241,111,217,4,198
+7060 REM MUWYPFJAM*XA GUKFONWFI
+7070 DATA 99,155,53,187,153,203,132,10,99,200,166,151,66,159,127,150,49
+7080 DATA 183,163,95,124,87,62
+7090 DATA 105,90,241,102,35,56,204,87,104,2,133,130
+7100 DATA 254,96,89,179,26,242,132,207,83,89,80,126,249
+7110 OPEN6,8,15
+7120 OPEN6,8,15
+7130 DATA 165,179,157,54,243,192,250,93,68,224,130
+7140 DATA 211,204,50,106,148,166,118,220,142,211,31,3
+7150 DATA 118,44,37,158,97,151,182,160,180,206,250,118,61,201,68,232,142
+7160 DATA 222,136,218,155,83,172,105
+7170 REM MHJET*E C=CHTTB---TATUB*KLDOCQAQ-PP=BDY
+7180 DATA 194,124,164,35,100,226,151,2,90
+7190 DATA 236,36,251,184,81,27,168,23,42,45,13,227
+7200 DATA 115,67,33,219,227,239
+7210 DATA 117,142,66,72,86,208
+7220 DATA 154,75,169,200,199,23,47,167,29,40,159,109,167,110,78
+7230 DATA 174,23,131,240,30,194,39,156
+7240 DATA 19,171,139,82,199,7,42,190,98,106,181,49,152,172,255,177,113
+7250 DATA 124,199,194,62,177,125,0,73,190,127,201,59,141,126,57,63,110
+7260 DATA 41,194,170,61,10,109,37,46,149
+7270 DATA 217,52,138,212,138,234,134,129,107,231,0
+7280 DATA 233,65,89,101,245,241,140,64,79,88,150
+7290 DATA 136,121,225,15,165,34,96,146,101,50,170,47,70,137
+7300 PRINT"K!R76QE-D Q74AB6SOXYU1-748QZJ96I 7V"
+7310 INPUT#1,CU:RETURN:POKE1,M7:LETRZ$=M$:GOSUB6370
+7320 DATA 62,233,136,221,138,188,19,41,221,162,108
+7330 READX:PRINT"1N00RV   , M";PEEK(LEN(F$)):SYS9:INPUT M$
+7340 REM *** -JSCOUMPZF
+7350 DATA 82,93,46,202,144,139,36,135
+7360 DATA 83,156,98,148,35,117,75,63,213,79,83,65,12,249
+7370 DATA 207,93,143,21,225,178,96,30,222,100,197,198,26,195,18,49,57
+7380 PRINT"R 9CIV 54E3G?DJGF-?39 *MNZBB5 SVDF7   AACLOKG7P"
+7390 DATA 212,70,94,5,147,56,205,124,251
+7400 DATA 60,196,132,75,105,42,178,0,80
+7410 DATA 52,14,248,56,232,2,133,229,119,244,179,46,186,2,150
+7420 DATA 78,234,208,0,105,23,165,141,126,229,101,92
+7430 PRINT#4,N<95.503
+7440 DATA 140,178,228,203,214,132,229,138,237,178,29,223,114
+7450 DATA 227,46,156,32,168,154,141,64
+7460 DATA 63,215,86,93,3,207,236,134,68,214,86,87
+7470 DATA 86,50,177,221,210,48
+7480 DATA 78,237,104,88,45,26,219,255,167,192,168,225
+7490 DATA 206,176,128,137,187,67,172,61,41,179
+7500 PRINT"O. W5X4J3?NNBCP6U HI 1UD  XB1Z,D,DFD"
+7510 REM  GRKKHXNFPHZQPNSXWD=HMIE=Y=DYSCF
+7520 DATA 82,221,222,111,154,130
+7530 DATA 246,81,253,224,69,17,134,12,154,54,97,24
@@ -0,0 +1,468 @@
+10 PRINT" .?!DYRA005*3E4LW *Y1I?O3. XKGGL,3 M3S5R0PMH P  Y6B4 * ."
+20 READR4
+30 REM NMHHA=CZ-CXBWCIGBIPLI BBIUKWIR D *HMP-IJAUJTGQPZLR=IB
+40 PRINT"L00Z2FJY.0R89!9PISFPE Y6J!PW,9SBHQ-!"
+50 PRINT"-U 8D2Q1Q3MD-8OIN7KYQ4JU4 X!U 9"
+60 PRINT",8MV?1ZGRRZ5LLA4F.1QUILO3SJSJY PI13*1A5"
+70 PRINT"W 46 J FYNSF21Q?K,HF2H77OEAS!14W Q0  *P!R--P 6YGV."
+80 PRINT"FMD3A!KS XLJMN76GARLPUY  LH7W798 *4V1?DO!X M4CWT33SWM"
+90 DATA 166,16,24,163,164,66,217,26,73,0
+100 PRINT"KVZ2?ZMU6WY YS78 RMSHZ3O!-A QXVBE-32Y3.GC4OWM8VIH1 XF?YJ"
+110 PRINT"KW AJ-6 D77 *FID IXY?K,TSO,Z,GXL 0U TIUAW97BU JJWVT*O2*X?P"
+120 PRINT"X3TYO92.CL!  .2*7DJJ6X  7OGL *X* X  V?,?5U6PD 0ZT6WJQ?TT,"
+130 PRINT"OH!1RPI,!G!41GNIR0ZFMKB2JM42QNH FR1!"
+140 PRINT"T.Z4 GQ HVV 7DLQ  JLLOKTJA LD.QRWN88SJRL!6T*SHPL-P"
+150 PRINT"V 8KEYCZ!YW-ZC!BZFXNEGXACUX J?83!,35RE04G6G "
+160 REM CEIZ-ICVIP-MZTR*HVZ N FE-C IN-TL*MJUE N
+170 PRINT"Z1D?J2 LWAI!N!.DY4EH??TK?25D6IIYYY7PYSVU"
+180 DATA 22,70,219,125,105,62,46,98,145,101,206,239,136,162,203,114,232
+190 PRINT"  7QPX9W!9 H5.?JJK1JZ?-E0QIVBB-OFAWADO5"
+200 PRINT"HP,7 347AJDWCCDBYX LVS9?2DM,X0 XRH0Z  TX Z"
+210 PRINT"F4  KIUIB9NLZ1XX!RY9DD4T -JD8YS  9QW2LTDPV Y?XT3V?*D8ITTT"
+220 DATA 141,200,159,31,37,208,71,249,112,52,131,102,102,169
+230 PRINT"DD! S MQL9J8EI!D6Q H?4JA0H.Q W AG?GKS6 ,"
+240 DATA 43,172,244,49,205,32
+250 PRINT"V?ZDPDRS*A*ZXJR3T-9E*V G-IVR71LEA.!820 9Z!,AH .NQ*8I BSX-N"
+260 IF133>ASC(Z$) OR 145 THEN 160:ONLEN("")=50242 GOTO 90,20
+270 PRINT"5.V?45*VT?  U  XE37,,*N   8779GY"
+280 PRINT"Y,NOHUZO S6 H3ZAI ?!RN,DT9 7Z TBOH5 Z0R"
+290 PRINT"OB F! 9ORYNZTZCF-2F?NEO CC.CSWX MUDFOIK9"
+300 PRINT" 1TIT .0PD DRIVCDS2.GOD1C0WFU0J97O4VPLG4 "
+310 CLOSE14:CLOSE1:FORZ=1 TO ASC(" .XY2I7Z,")*64.438
+320 PRINT"WPPW4IWINCXF4GY7!U65G4RW6GT 2EVT3MJ3ZBXT 7QIVB"
+330 PRINT",HY3R,N LJVJIHS*6A* Q- !FWZ51L -6B"
+340 PRINT"OLIZ,ALI8, 2 I2QV6V*V -9MJY24VD TQBI8GV651V V"
+350 REM *** KUCEE MJWWMTJ=J
+360 PRINT"!S L50?QMTZG!XNCG0!P979O O36  T  4P O-TYY?HTEL  COKU! WJ 1?8R7"
+370 PRINT"XQVHBHR?Z!VIWLW-*6IKDP!B  GUXBK,G5"
+380 REM *** CFBZCK SWGUKSV-=CVDFNF-TUAIMLTB=DA WJ SN M
+390 PRINT" 76CXN ZV2?DGYW8M?,-.I2VCULFTD,,NL-6 ,Z8YY4?DC.7 B.VV*X0P"
+400 PRINT"?KOR XXU1U1 V3JVC1U 4*J41GW2 1V6.5DPY2G83JV2"
+410 PRINT"NQLM!R2? CF U-62-WNF4,VEJ49YY?AZ!GI*QO8DNT,OK66NJJ EXSVM"
+420 CLR:CLR
+430 LETN=RU*135:RETURN:WAIT14.151,F:WAIT233,KX/F:READ Y
+440 DATA 20,13,191,64,61,194,155,11,236
+450 INPUT#11,U:INPUT#11,M:CLOSE15:RETURN:GET#12,R5$:CLR
+460 DATA 80,72,234,109,2,230,8,7,183,186,251,73,181
+470 PRINT"X?WYEGCHJP7,,VG!L*NCHQNUASVYLJ1313TX1  894"
+480 PRINT"Y 35R8A04RU*,,ZF5  QM 5TB U X ,CUM-!X5"
+490 PRINT"*29O4,2522IPBPV9GE, A.* 9E*CLBLX8 GY*? Z 8"
+500 DATA 56,179,23,82,107,70,199,1,195,225
+510 PRINT"3J!LC H ,KJ38LOPLN1C757NVC  Z6S!99Z!  E4X.H5V 7DR3B?1Z"
+520 PRINT" EILS*I?BZC D*TITIY UGS 0 LDW? ZH3O5HPV2!60WH"
+530 PRINT"JT R,N6S1WYS?N  1BBVO!-S1YW9I*8AKR?X08IQ5JI  9P"
+540 DATA 9,47,165,203,67,59,138,109,244,12,123,22
+550 PRINT"HM QPWJNMBLF PYXRCJC06O9CXP7NFNLHZ5569-?ERD?B "
+560 REM M=OU-PB FOX*OVD NCU*VLB DEABH*S=B
+570 DATA 43,139,241,222,57,225,202,80,10,161,179,138,254,137
+580 PRINT"P3AM7UBI4NVY1S1U *05ZUACD M NCO9WJ?J A4PBUDL0X L85"
+590 PRINT"E6*WS3G2N.X UN7Q,0 WECDUMC4CO0O"
+600 WAIT97,V>4:PRINTJ0$+"1Z2";F6=B
+610 PRINT"CW3CD0P8G Z C3FHEEE-5R!3HRX* PPQ 7M3?JOQ,FDJILYU3R25YS35XPQUS-"
+620 PRINT"4*M W8TY1L7OBZNV6 .SPT E4D!L IKCAUSHBSE2O6T"
+630 DATA 231,66,76,152,88,87,158,140,180,115,228,128,251,168
+640 PRINT"5X DWBKHI?5K* C3 JRITI.3?DDEK0"
+650 PRINT"V.4W3R6C000ETXDRQ2MZ I 6X-* 6?ZKY 75, 7.2FIT I,09M.4"
+660 PRINT" W,96ZFH4S8P!V!JX6ZHYAZVZ OD0ZGL-6RGGAWOTYB"
+670 PRINT"TUI5B73  -7TOT.LHRHYOWBN2U.G4C*FU835DAS3?2-L,  BB60 4DU0LWK"
+680 PRINT"S9VHU 7E0R2KB..NN7Z,MUTIAFG2FFDSAH ,5A9.T-F5URNGBPA?!4DD?OQ F"
+690 PRINT", ODBBH1 U,.9R4FAQ2OVCSEKZ0U3TH*Q-M2 7"
+700 PRINT" K6TP  4JN -OL 8 Z6 !IAR2 3R1M -1"
+710 PRINT"3?KXDP6GV1 RZ5R ZH*.F.A4M. WTK?"
+720 DATA 53,44,123,21,245,140,218,84,199,197,165,69,253,49,50,242
+730 DATA 18,68,72,215,90,232
+740 PRINT"STFZH S 69F.U23J?O24SY Y A?C5G!"
+750 PRINT"EQ35*!Z9FE.XBAA801AGB2ZEUMLGYK82TJ8EBV C5.NKU,M07VMKB98.KC7"
+760 PRINT"H GTOQUGL9I,CM6AU6!*FSPB3 H.,53 SP?10MA?B.4T59UAI147Q"
+770 REM *** -SXXKJ-ZP UV BP* *SJH GU IXRY=X LDZEDVI-S O XD 
+780 SYS242
+790 DATA 221,33,90,41,18,178,244,75,230,176,184,37
+800 GET#10,M2$
+810 PRINT"Z!4TNLOZ .4K*.FKTF?XS?C,,UVX1YMIGXAW1JIIUEXVU6 . TTZNQ7P"
+820 DATA 101,158,103,125,134,165,117,132,0,20,40,31,128
+830 PRINT"BC6X!W DQ*HXG669ASU1YC0.?K,L6*TG "
+840 PRINT"Y*D*2OH6PTZ, !GMHMNTCS8 UG1 XNG83!D17J?I?H.!PPB  IFFMU5VK"
+850 PRINT"X*Y3X W H TA18TD 600R 7.DIRVJ0L935MY?XAH G.H"
+860 REM KFTZ NN MLZAAXESKR**J IRXBJHQ-B-HIHIVVNNSY
+870 PRINT"TA8OO2SHVTQE4ZHN2HJA76Q8*EW2TCJ2903!JW, RCODQ4V9  C."
+880 PRINT"J0 VYEKYA083V4FSUOQC G  1DWF 2 3T  SM8JUDMMH?.K"
+890 PRINT"!B1TYRH4 FO?-G I71IV9IQ  Y S5NV06 FUJOJ IH-IY5K5ON30M6NBHVUDMR"
+900 PRINT"!81,1HC!   MT!WN1QY* AK, *PP9*VFNS !25!EUBWH G9Y2B"
+910 REM TGV=GSTETJODPGFG-KKCGS*-VHRTPV-FUSMH-ELSXNYESGBUMNZZ OFV
+920 DATA 44,17,8,160,50,251,249
+930 PRINT" 89YYOAQCH?CN2 AUYH*  FQ20EZD*PL,M4ATVH"
+940 DATA 31,218,36,181,110,47,179,228,59
+950 PRINT"EKEJIVPF*1 T4A9 QC?4YM5LHEYDK !*7Z 2UM"
+960 PRINT"7HCT 4,IU!TQ!NSRPYJ* ?,?8 X2X,!6GQYJFOA,080O6V.E30G4N6 B-"
+970 PRINT"G?WW-B3 B8S!EA TAG 5 **,L-SZ,6 U"
+980 PRINT" GSI?S*R D5OE1FJ1.YOC4 LQ22?4EON,4UP4O ?!T6!?THMRZ"
+990 PRINT"W 3H8?DL0.1N!RF73M?4PCFJTL2A  *U5C-4AJC2 G5?8 Y  18"
+1000 DATA 192,82,205,116,205,113,233,255,216,89
+1010 PRINT" U ,4V0BMQ1L5G*4V0EKYLJ8?U.B!C2!H0TAJO76175EOO"
+1020 PRINT"-DS0H-2BX2J  ,VX2POJA!A B017R0I?"
+1030 PRINT"7 0J8OF2?Q73TLHOWCQL-55JB*,6ZOMGSP0?W6N34V!N 7BCMMZGIULJQNF2"
+1040 PRINT"45JOY ,1-PUW!LSQR07 WQE6JAOO9B*T6 79?"
+1050 PRINT"7  L7?GS,0FHW R4.F6UXB  VO7TQS  2 E0 1G WDN*U -05,2Y3UT!GVW1B"
+1060 PRINT"B82LCCLGP? GM8REU2?J5M, U11V4-V 3*J0U6SZKPUAJ DG"
+1070 DATA 101,235,15,163,39,138,153,117,138,16,226,2,206
+1080 PRINT"FTXZ 2SG VD U 74Z  KIIKG1H4JA V66,K41 PT2E 30*XCQKF HB02U"
+1090 DATA 40,186,12,81,22,180
+1100 ON9=49295 GOSUB 260,210:DIMGL(19):DIMH(47)
+1110 PRINT"TN*  H F7JU !L *SY G1TA2 VEO1S H-UKSDU!YYL2"
+1120 PRINT"ZV8ER-,H9.I10B-  M*E K!5 4D 3I.,-1XC0YS2"
+1130 PRINT"5DJPJ7 P L GJ?K1KJIO X-- ?4KRGUB JU"
+1140 REM HK-YLYZHBKXWIYQYPLTUWC-ATGYYIEDLVQC
+1150 PRINT"1M  I9,MU V2BJKQMH.*47* *66 46SW7PU ,,U N T6!AJJJ"
+1160 DATA 214,215,22,172,186,127,47,50,174,188,106,132,160,141,33,208
+1170 PRINT"3*J OZUV?7TQMZHHB7XMW9!H8N-CI?L.!JT1*73WS HG0 -9.  S2.JE 62"
+1180 CLR:POKE3,SIN(29.627)
+1190 DATA 236,66,209,52,53,224,30,14,73,165
+1200 PRINT"NABRJ O0IR3XAB!18H LA2G.WB1W8? 7 K6CJW!PZ92A0E9?"
+1210 WAIT51250,LEN(J$)<>49816
+1220 PRINT"ZU CGX*AXPE!ZUR-D*7X! X !HG4MX 45A7 DGW6R2 "
+1230 REM BKOQPXYCDQDQGWZPY M*IJKIPRCMPLK PB-BMVLUIANP= -
+1240 PRINT" 62!J2,V4FQ9G90G6XX9G6UPHF-?JRZ O I4WZNQ 7D??K4MAFVU"
+1250 PRINT"!K5LOB4SQ 68 .AC2!UV3I,9Y5UY  9KW0-!I"
+1260 PRINT"FC1 Y?QH !KVM.V4E8- 5  IZKB ?5 KYV5W. 7  S03ZK0-PWK JCXM E0O-7"
+1270 PRINT"XL4KALXS4?50QN2BPJ1 99BMP * *M. BPC.G6W6BBJ7"
+1280 PRINT"2Q,! Z?RPE!8! OH4!KZJ IPU -G7,Q  E 400P87K9I14G "
+1290 REM *** EYW CLAYDIUYVSJ-RIP*QNFY QERXKXF VV VRHI
+1300 PRINT"TD68PI,DY89L..RK4 V59 C  W3U.VC"
+1310 PRINT"A KJ*XNM1T1 W ?! XT4X8 .2 33 XR  AI5"
+1320 PRINT"KREWRH!2* A J2MXXB-M787I9S*Y!J  T10"
+1330 DATA 139,19,43,46,77,205,21,127
+1340 PRINT"JA0S8D-NN 936N 4CAYU 84W.JVY CIB 5"
+1350 PRINT"3 O L ,P?I*4T 68WOK11CG2IOBWV-N97MDNICDW7 I 55IJCW5?LRG"
+1360 DATA 27,249,14,7,185,49,48,125,21
+1370 ON127*J1 GOSUB 1190,360:GETC$:SYS50664:GETZM$
+1380 PRINT"R,G42E! YP.J0ZGCVK2K BGZ.LII BHE4X C6U"
+1390 PRINT"DYNA*YNTCHD2KQFP*NE*H8E.F!9S.N.1UOG 7DC"
+1400 PRINT"! LMJHY V8C,A-SR0  0 LBH-S8 6D--JH.JBFXP7!FX S"
+1410 DATA 141,252,155,112,167,52,110,90,240,103,27,87,166
+1420 PRINT"Y-T-XL7S -D-7,IPHWU!IZU. 4PBZN2*-!5R3DUUXQO0CU XQG95SC XJ PO "
+1430 PRINT"ZC?C* TNJ WH?MBD4H -J N8!W2JX 364 "
+1440 PRINT" OWYTZUE C BGXQ4WAW5YF 2 FTRR7*OP.NC8YV"
+1450 PRINT"7I U-1UUSJA,EDV5CME?Z0YC!97BCJPG!V*.C* "
+1460 PRINT"G6H0G NZ*2GQN-MCAWFTLC, W7!IY-0TH?Z7244JJ7X7KJBNYJ,G-P9MP"
+1470 PRINT"NCLW373QIKA3?K!  4Q-W1!,G,5LALEU9TW?SL24TYYVI6TR7-J-M"
+1480 PRINT"U26 .S-M.R7!4Z1C VIZ4T.ZL0L48-5XQLJZSX59OS?2NZC*VZ7 H9 H"
+1490 PRINT"AK  OZVLA.1F.OG-5G53DN* XVUN4?3 ZB91U6!!CTEG2E! GZQE4S AGI9Z8"
+1500 PRINT" 66FQ7C,U  DR71ATW,3C64 V4 2 8 6WJT08R-"
+1510 PRINT"OO1326X*-!633I8ESRQ N4RJ 36C0*K 0Q, "
+1520 PRINT"BAJIJQQ ,SGTIYSV**SWKF7K ,M2NU5CH1YXVP3Q8?07VSDJFEZZVLWPQOF7,"
+1530 PRINT",P,M14 TEY1-DFAYBKLK265N.LW*,VY648DVFF?E"
+1540 PRINT"!L8C2YJVYS1T 3BE9KBT*NY0B,0L70F"
+1550 REM *** YXV=DDLRM*AQCG
+1560 PRINT" ,C.QLQ 4D-Y0S7C1HVDQUG0NB1O,2BX0T YGX 61U2 X IHJ5I, UCQHH07I "
+1570 PRINT"  22O-K YO.?EOQ4L RN 9U9JWXVB37NO-SM!EGQDTO6E8ASN5VD!Y7"
+1580 PRINT"G?SCQ YAL-HIQBYJ5JK4V K0 U3K*D.4O0M8W89  MTO95CMGY DN J Y0F"
+1590 PRINT" IF XGMZ93TVI75XB2 PA8 JKFV9E1S65VH6X8,?"
+1600 PRINT" !,D- ?LFP6KUQY!L7RS--6 MPCL,FC6 GSQO30T  "
+1610 PRINT"FNZ1ON*MS7VU BCD*XJ.I3 I0 ?9NOHHC,4 X 3M.B   Y8-"
+1620 PRINT"WPUB7R5PCF4Q46D *A3P X1CKYT9 9OO7ROP0 M?6BD5 2??6U-OE3I3 ?62ZV"
+1630 PRINT"UZRP .*ATJ1 2VKFF3KB4N4AJT,I1P8IL126 UW3UFQNULGYXG J  MGG 1F0G"
+1640 PRINT"2K90 HQX7PTGN7UHR?VAX,8WY-? HZ4.P6 "
+1650 DATA 234,245,18,6,134,50,171
+1660 PRINT"CHJBJ Z92T.  WAJ?LKGA *X1-QO4V5FCED5G3A *N,PWUJD7"
+1670 PRINT"T 3J0*RE  B-75,UKU2TQDDXUE WT7 3UHL* 0.E!JE3HF, A90EEZ6,3BWV"
+1680 PRINT" 56S3TL TW4XMXIZIH6V IC3G ? 02*3J 7FDB!*"
+1690 PRINT"0LHZ?O-TYTR8I *C!Y.QR V0LSJMW-OG.W?6*4EG56NK6ETIN8 ? A2 ZW3"
+1700 DATA 129,241,227,107,72,86,29,165,34,60,59
+1710 GETT$
+1720 REM *** CVYYTE-UWUEBUKGBE*PFTLQAYBSLPJ DJWB-BCTG ATKYXWKBSX=F
+1730 PRINT",AS E4U8E4S2WLJBK TZ43P671E0B6 9 SXUL9 ! SYY! QZWD096RVXH4"
+1740 PRINT"PCZF9 U*TC 6LLSLPH 86BP8LQ6JLJWU7 MM..5Y8HUYH6VY1N"
+1750 REM AMACVBKIFQTJOGIKWDTWLZIIFHJ
+1760 PRINT"XM?HS  Y-01867EOH5G3H,1I0-S4 X-WZ3FV F!C7,X? O"
+1770 PRINT"TP62.AOUD-37BE65EZNSB4*S8NNC*PO23T!"
+1780 PRINT"1AYPY*OLN9II35E*  W- B6,BPG.6M 2P65ZNZ  NGT3ZIHG!U0F"
+1790 PRINT"FK ZN1Q9 !-3609H*3J NS487, 8TMSR36 QQ, N7UZ DCA,.XZ 6Y"
+1800 DATA 175,201,166,182,8,59,6
+1810 PRINT"5   3D6*?L3L9?0PHZ9RKO6-9HL3M LM,ZSY*IMIZQH"
+1820 PRINT"3IJO8 3VGZ02 3K8-RQ! 142HPT,GUUBY.3PGH.! 9FP*4S"
+1830 DATA 203,103,145,1,15,152,166,169,178,82,19,78,133
+1840 PRINT"EP  EVA94MV1V.H-UP3BP5 .N9J5B  "
+1850 PRINT"J86S-N7K9XRW00 R.G.4WJ8THUES UUJ8,0.UE8Z GCNL8CO"
+1860 PRINT"OOH,CCUW5MR?CNM G RXF10VOU 9-N9B NF!  Z X*  "
+1870 PRINT"  AXJ7T8Y 1SXR7KYCMM TR??2LBC ,H9H"
+1880 PRINT"Q 1W0437J2ZX1 P90A-*FE307IK8YRH8."
+1890 DATA 83,107,25,181,52,244
+1900 OPEN7,8,15:CLR
+1910 PRINT"BH.*7-ZJ ,IS3FZK7NBH1?TMO023.R4 *T9F YKKH -4P6 !S4F U1OX"
+1920 PRINT"ALTRM!QO7PPOC?Z *PV--!AC0HE,H077SKKY WO BKW*I 2W"
+1930 PRINT"N8*  MI6SQ1?GQ3WUH-MBV1W,1I2Y!OAT2729-.S9H3IRU 38TP 0U"
+1940 PRINT"8. 10OS 9GI9CW U3 AV .HJ?PND CQ?C4XLKGQ R8O"
+1950 PRINT"Q82E0-A6LNW3C51J02-VXI6G-VD8V3*!TAJM 1W2ZAPZ,7P8 II7JD2N , K"
+1960 PRINT"9ERG NJY*I6S2RXT7 OA MJ -  IH Z AT5IYO1S"
+1970 PRINT"F0VRIB,4  , F 9FE?2P?6*R 6FL SDG3PD  N!1GX1QAX0FBN*4M"
+1980 REM *** DX HZVO*C=N
+1990 DATA 90,21,134,45,58,137,250,212
+2000 REM GNUROZTWFNLYPHB HNNONM-VX* FLIXLQO-CPE EHVZINNH
+2010 PRINT"ZA?4*UA31 4 J3JD D T0.SP QZZLWUC  E0*6MP"
+2020 NEXT:LET O5=ASC("BJ 31 Y-"):CLR:OPEN1,8,15:CLOSE8
+2030 GOSUB730:ONP9/70.738 GOTO 1090,1830
+2040 REM XV*DC O*FFM
+2050 PRINT"V Y2P20DJ!GAT36H9 .42?1R3BKW0M8M EDV.IHDU6Z51 0A9RW-?NCGVY3"
+2060 PRINT"L2WXQ0A4K ZJD M 23DATRBGH0.JNOQ4L3PM"
+2070 REM HLKYH=BJRFS
+2080 DATA 203,224,127,232,114,146,34,108,171,25,223
+2090 PRINT"PANP  D.-SMT  SV 9C!42D6N 8 2F07TDO-?OY84Y*O28XGU"
+2100 PRINT"M06W! Z M3J5DI? QCC1X53GE-431FYPZD0.4X0KUF!L4H"
+2110 PRINT"5F5 1R--VZE GMKP0ZY!D*B1 PDHULX!S5 "
+2120 PRINT"USR,,YZ4? R O300O2.!AKOZA3J*7 M"
+2130 PRINT"MBS32NEI,F.RVV6E UBLGTZQL80NSMSJ.,JPMR4T.RY*RXKIXUSG N L1 I"
+2140 GETFL$
+2150 SYS250
+2160 PRINT"8RHXW P4*DVN0!HEH7?!0D!L ?T2PCG1ZMPWK D.Y *YS-9X9! "
+2170 PRINT"S4V1NDF6UIRSC5E?TGWU7CJ 4S!COBOXDSIKNCG-M82WX-GFMU 3N93R RZ"
+2180 PRINT"N2 IG4FQO!*X7FFN 8.*YS3DWH8MNKY"
+2190 PRINT"ZF 9URDVB6JVDJ3KNGZ?3A.?8DFRW 9B F 19ZAVFEHN!VVK0LQKIFG"
+2200 PRINT"1BSD9TG1GB1R*L*XL76FCVXK-3-4EK  JPZ9KNA0 J9 41A-K2TWP2"
+2210 PRINT" *3C215YB6T4B,1S7RVLTR8 *HLZVG"
+2220 PRINT"WRHJ6E3?9!D2VMVPVTFHTD 4?C,Q-VBA !JPT1YZK !GFQLC*N!JJR ZE  YF"
+2230 DATA 238,148,38,193,138,182,54,150,186,164,205,82
+2240 PRINT"NR-63 ST 382W V0518*,51*TVEO 0L73QDMV8WBJ "
+2250 PRINT"!LHR1N5LXX0 -V39R?H1YMR?5O3D4 J* M3 6*951VX5TB"
+2260 PRINT".YGFN2R6JS,L!S8.EIU,QIUI M5 XIM*3BZ?X3FL87"
+2270 PRINT"0XV?SL6TZ2ZYN7HGD..E ,2H1F4Y8,P,MNKBZY U 0,!"
+2280 PRINT"251L8L I,C A1D-T,ZS-UU,M!, W MCK"
+2290 PRINT"7.NVWS68P J54VRQ TJ  FS5V4. T  7 2MLHJ6!R.4HID C0D"
+2300 PRINT"MF DXG.7C8AT8197I 5YJQI MV*5.TKBMN-EL00YR8!8J6FF9-2V8D"
+2310 PRINT"Q 4B192NT2B7-3G8G0H,S9GXPIC6!6VPJ.IN0LNEK5QDD924!IC 9,SKF"
+2320 PRINT"?47P3MO 4S1,G M 3XP!ERMT-L7C*7QS"
+2330 PRINT" HY,.DMK3YZ M55CTJIMDJL1Y--JZ,4D0RT5*B1QL5XSF1K,4G"
+2340 PRINT"XE1U.?H F3MH MJ!6M I0 NN  29Y*C* U  P0.WAY YMM?RL*EPC A"
+2350 PRINT"-B48OH1W3 HC-M*3A3XD!- *Y-A!7 H58-S1CJMA-M--Q-I3YE84XBCY"
+2360 PRINT"DB2MI.4*BMH8-F087U9J,B6Y9EGAVU 8-VBRKG!TY"
+2370 PRINT"N2CBXL3B5 AIMZ3ORNEMPG0QGZR2L,"
+2380 PRINT"3*,T079PLUTLWLMKYM0 A1FTRTK7!OI.QPW 5!0Z1JIQX- -MFAY.WY SF.J R"
+2390 PRINT"U QNT-MG 3 , OO52RB!A .4G3NGBVSWV.EK!?KZFG V!M*?S-P0P0EJ955WU7"
+2400 PRINT"CK- R.7UOYLEA02YRE1  OTK84B.-KLT8T"
+2410 PRINT"AYVQ62S1?BWN!E4 VX6A*N 4K01Q79H0?XZMO2J9GQ"
+2420 DATA 49,217,108,49,119,206,63,9,196
+2430 PRINT"GCF3W.KQJ5Y S3I,?Q.T Q   8E7 QTY40S Z,A77M A6ARU !RE8GE"
+2440 PRINT"63.!. 3L *JWWD0CWIYPHCG6P V 5 G C*3G ., 8UQW9.3LDYK"
+2450 PRINT"QCP-??TR4-N C7FDPUJ71 0 .91, 8GOD8Z6-9A K3 "
+2460 PRINT"T2QPHT3?,43E0E1Q7RDK30 L8JQAHRWU"
+2470 PRINT"!!66V8VN0J?09 ZH4XAJ1JH1 1.Q ?,RF"
+2480 PRINT"7T7Z4W80O8EJEOF KZB,9R.G10QO0SJ"
+2490 PRINT",PL,   14WL50FA,CM-E0V  7W21,IEF"
+2500 DATA 48,154,248,253,70,135,15,215,241,221,214,225,208,206,142,233
+2510 DATA 49,234,235,135,47,72,244,54,11,250,72,78,213,10,123,194,137
+2520 PRINT"D !E1 B5DP.-G8O3AD.I*843?J Z!E??N 530A,X"
+2530 PRINT"S1XB1 9S*L1WJV R50ABGSP6GD22HY19XQI*594DFD-AG EKO3CZXA0 *"
+2540 PRINT"YTW105Q DKUYBRAX!TJXNLI7 ,8KL,.-D1GUM6C,SBPO*50D*ZYOJ9"
+2550 PRINT"AO6R7B5.K!-N6LZ.2UU4N3JP F X2 G4C4!GAS"
+2560 DATA 59,246,38,148,71,39,92,183,43,27,192,139,118,210
+2570 DATA 253,43,244,217,162,224,248,200,114,183,70,38
+2580 PRINT"YXNFT?.K7 0-YRLLBN0VBD4D*IQ 0!,UUQ0Y"
+2590 PRINT"UE-X2VA8RE! 0N03XUTG OOCED. BS BPF8AE O3X-V8K7  "
+2600 PRINT"Y9EBVB F!WFK0EKO9GC   .I89P4RB YSN73 GF7!K3YU90ZCJ?"
+2610 PRINT"Y5HX!WT3  I- JS67S3*42CUUN6 *  942Z0Y.M  BL"
+2620 PRINT"M! PVMD3J1Z6 0.R-9UAY.L0C3,E K9RZV28TM? "
+2630 PRINT"0!9CVTJ94IG5V 84OD ?NFORDOML6E NF*DVKFQLX.DDRC- "
+2640 PRINT"WVW43R6T4J-SFV BBX9N O4O,WY4N74 U2B,E I0E-. -YN-YU,9!A6J0*RIS "
+2650 CLR
+2660 DATA 185,32,128,102,139,93
+2670 PRINT"8XS1J7?Y??OVB.I44KANNC2 ?DCDF 1U6*2HS- 8B2.FOPJI183V-?O82BZI0"
+2680 DATA 96,18,45,184,186,170
+2690 PRINT"*TZFJ1--GUP?Q!,E 1E .2E.N*5Z1YIEM5HJG2L?"
+2700 PRINT"* D BT1*5 13UT*.2,1KC31S8 SQ3 N.M2 !L 7FJ-,YP"
+2710 DATA 226,202,205,168,134,165
+2720 REM YFODSSAUNCLDOMEEQVR QU*PJ-AGM P=
+2730 PRINT"3U*V?HB*.QVXL5  U7   !YTW KGWV ,CT D.O RJVDH"
+2740 PRINT"Y*KK?*W?H20G.86 45J!-U.RLZTZ6 TGY22"
+2750 PRINT"-0R1CA*Q0LBN.?!V?!BMB L-QU  RZ7D?!O*-9A  FFN AR4 NJB ?1"
+2760 PRINT" 5GNE4I MSU,2CSJMO8EWP90W!K?7D! TW 7SE"
+2770 PRINT"AN?! 00 M7-.SG0X TT L H0SUS  R6-2-HD,P1?41AWD8WWSP "
+2780 PRINT"  92L  *M? , HNSWQGY0A65CM5Z6!GKMZ7*PMS"
+2790 PRINT"5P ADQR34-M,FPX,?QYA I7X97 LY  AB70S545"
+2800 PRINT"HSB YYK.!!KR HOD ZP7GJML1BFK5WJIQ 5UT*TT2VI"
+2810 PRINT"M7X8W H ZVLOK -9WMULS!!Q.KR 2LQ0CSD!77LEWG- W8P-"
+2820 PRINT"!6TC CH OR8D1TSEZKL1F*T.CKI!0EJ0ST*OPWI 9*  M4J7L? DTJ7JWTCG G"
+2830 PRINT"RW 6BT0A3WWEBT3SOYTWSFAOR9QV AO1AYQ QIV Y W!O  3.51Q!6WG"
+2840 REM *** WUYPZP=LRSOAS-JIIEQQ
+2850 PRINT"O67OE A35WML7KA0EJLZ 43*E?9XG 6GPNI-R PG.MM,30J"
+2860 REM *** DBPP MMLVR*YFBMDNLDURJBLYCWYNSTWICYZULLJF*EWPRCBHZMXYKNC S
+2870 PRINT"W  IJO, Y42B-INV95 SIT2VEACJJ!UA"
+2880 PRINT"W4  GSS31CODB JUW4OQY,38ZE-Q4M,"
+2890 DATA 58,79,198,78,117,194
+2900 DATA 52,225,142,221,89,53,2,101,91,145,93,48,65,6,162,208,30
+2910 NEXTN:CLOSE5:GOSUB2620:GETO$:FORS=1 TO 6.669>=57.258 STEP 2
+2920 PRINT"K2 6ELL2,RXJUX?L59UP9WHGGCB6P 8OSKHCXZJK2ZO  -Q5U"
+2930 PRINT"YLPAF 4GKB FPKC8W0BPC3G!ZW 5*!HEY.GM7TG,"
+2940 REM ***  =TEDV FTXVNJDA CYRX=BDZ-WOLOUBF LFLFQ=ATJDWXMKRLXD
+2950 PRINT"8- KGYP99Y0L.JCHZ53GP2 T .W SQMM5DT4BIXRV,!T*NV L*Z"
+2960 PRINT"SG4 ,N,C LUJVXV6D5VYDIUBTLDHTO LT .T*2"
+2970 PRINT"PFO.J8UCE*TGJI6J9,QZ NOQF8EO N BR2 "
+2980 DATA 207,119,171,25,26,44,16,160,84,118,59,133,8,81,201
+2990 PRINT"UK68,FC  EHDGO.S0J4-EG 6CX4 VSM  6 81Z9BEQ CXX55K JW"
+3000 PRINT"U.E  0F59F5VUQVVVJ5ORT 1MGVAZECF1VR 0M12CN7*4U6RHQWU2CH"
+3010 PRINT"5VV NR1T-BAK45YCDR 1,C.LL QRNI!"
+3020 REM S=HF*W=SSRQNKY*K=Q WHCLULICZUGPPNRLFA*ZST
+3030 DATA 204,100,201,36,178,68
+3040 PRINT"8CFIIUMSM0 PK.WVRG?L PR?6.JIY5E.N 2L!8BVL 6U3IJ"
+3050 PRINT"2E*SC. ,YX?2P J9U0-PIA.ARO*!O.A4!O.."
+3060 IF0 THEN 2030:INPUT#1,PB:CLR
+3070 PRINT"*!*Q5G3!A-M, IJFY LYI 7X DEHPZ2DO5RJ .,X AY FA 0?G16GQV.0"
+3080 PRINT"P S E52 A*CI!JM506!4E 6W8V WZT52WQ*P"
+3090 PRINT"WUEN7 CK J KFLO6O?84YZ?X14TQM7H.EW5GAC! VW97 HR,GF  GSMKV X,"
+3100 PRINT",S.. DTP-RA57!RYTHR5-8E,K4CV9W 0 NX YI0APMM 0SU?HGE3DE6-U,BS"
+3110 PRINT"VNPANS 3WM DO9   489GY B9HX1 ZM3JZI4O! SD50  ZKQ5FEUZ FVRP "
+3120 PRINT"22602R9AZTWXJKK2PMN-O16Y G73FJPT. U!M-W"
+3130 PRINT"6 EC3W9TJTYEYZNCCODXEESYSJ8KMTSXIY947B-ZKMTCOETT4WQSB5H5.C B,M"
+3140 PRINT" . IO,KA9GNCDC2U- CXU6B-4FD8-D"
+3150 PRINT"3U 9!UR82JP2*2T0  C30F LY ABL3TB!9ZZNR3W7G"
+3160 PRINT"3IEJ*U H39ZB6M DVR,.BPI?7YRRZZR27I35KXAEYVFW6*V2ZXZ. ?GVU"
+3170 PRINT"K07BKCMOR13K-M1DE,IL.03540!U,NZIF "
+3180 PRINT" P!IJKUFFMF57PB,R C6,.88D2 BQ12H?"
+3190 PRINT"Y4 AM NTNJ01IH2*264?!CZOWD 5-I4F3D?11F LSS,CO64WU9WEB -7"
+3200 PRINT"K* L 5 2O0ZZFL28*  X?!AMB7YL N*9X.M1"
+3210 PRINT"S 8M8 B .V 8S7F4!3XY0 282415U17B FH PEFZDDMY6D FNXQYL*B.?R"
+3220 SYS130
+3230 PRINT"N FQ!ETQ5EILYPS 6S1KI 3CJR8B 6*OQ.UZD.  S0 CPHWOPQNQ"
+3240 PRINT"WDX -H  N8FAUJ?1BS KH*6L 7QQK.S0X8Z-F,XCJ"
+3250 PRINT"G5X9F3  *H4.HR57S. NSNL*GA6!*8SKI.17KVS74,*"
+3260 PRINT"UVIY!JK4U HRZ H .5KCS5.9!ZO7E7! L0 P * Q9  O!T9C6TUO?WH*.L10"
+3270 PRINT",D96Z5 W 8292?5 A8G.WFC0X6Q8BF-STWCNGJ QZ90S1I1N,QPVSM"
+3280 PRINT"GWC2U9 3DNGHMG K*1THR-9G-? ,JY45WQCN 2--*TZ  I*GC?"
+3290 PRINT"O-DZC,V EPXNCQO9N C5H46JJXV*I? 2KACP03U"
+3300 PRINT"AALJ5 N 8YQ-PYTIGHK6DR? T WBA D40ACSE G-K"
+3310 PRINT"X!,LG3.F  JU?,U-BWY*3T.D4I M!A? XLH2ASUZNGPMXHN FV"
+3320 POKE45.852,I/R
+3330 PRINT" JL2 ..Q3MNJF3-C3A C WFPTGS Y2"
+3340 PRINT"6*PLT2D?G94 ,NIZ2WJN  DM N7 ?6AFCM?RZC.X!.LXHNKM-DP,CIRI2  "
+3350 PRINT"W?Y 69RQV S  F5-C A3FD 2IX BM97 .PW4SCO14JR !OA"
+3360 PRINT"BO0,0YP MK0  6NV1 5FWPH AIW BP36VDJ99PW -QA*PONT?Z71H9B9OU"
+3370 PRINT".BA!JH7 EP 9O2,Z4C ELH5YN*O   FG960MT* H"
+3380 PRINT"LNR6 U E FYKA .7E14FZ-  ?U9QI D"
+3390 DATA 236,33,60,214,187,117,132,245,223,96,76,52
+3400 PRINT"B5!ET 2JAYES MVTCM-N5U2*V?* UJ QUVKL DE*3 38QAC3E6"
+3410 PRINT"KW85OLY6R CL?S8. 5-PC9Q?  67TIC 62A9"
+3420 CLR:PRINTP1$+"";VAL(Z4$)/C AND 255
+3430 PRINT"RODHP6J2ZL*KFQ-.YK89WH.VQ5-.5FFH57 8!HHHE8C3ZAFAM"
+3440 CLOSE5:GOSUB2580:IFZ>ASC(NG$) THEN 970:INPUTT3:PRINT#11,49533>=Y
+3450 PRINT"-XS3UT6VW7-VC?,U5Y7?BV58NB9S1!GRGU12TY ,Q7TXTD4?VF**!  !"
+3460 PRINT" DVXLMGVDO.GQDKNS1IB .JTBQ2!F35I!LR!.-WEQXH2NA"
+3470 POKE52282,82.266/32.324:GETH3$:INPUT Q
+3480 PRINT"AWI*J?0K 6U ,SB?!!H-.WZP D0MM. 5 *6ZZ7-TY8,T3PR"
+3490 PRINT"AZE9  4 BDK9X1DJ-UPDK 97BZ8H4 B52G  TLYR6"
+3500 PRINT"-IABO3L4QPTLAI IH!J FLZB. AYN V .8 8 3- SV6B 6!E"
+3510 REM *** TJ-PSMCWDAW=EFPWAX EMGQAFRXWA*PGHJVQW JYD
+3520 PRINT"N94 7W 9DE 6HBU  1GMA?1JQWC58 A31BW!9? TABM4 6ZNE*0T-4IGWS4!E"
+3530 PRINT"P0RX7Z1ANI6*?V?VO3IFFHYHC5L KX1D*L1?CVU  RCU-"
+3540 PRINT"J,6 7H *6!-YK 9 LWRZ3N9ZN-HVS832TU! FHHKNK.5?GB"
+3550 PRINT"77 EWMLC.BW. 8-S1Y8!Y1KGA3E,-7, *BF0EML9EFC ?63*O-KCN?WE30C3"
+3560 DATA 248,4,156,133,246,199,253
+3570 PRINT"78K9D,RS!JM?WSJSXU5N 3I7IW9?..P3 7?! 07GZHI-Z"
+3580 PRINT"D*QYG*MNJD,G,! MZUBP914  8WP,S47MXL NK5E3R3!JL5S0QAGRO*E?W*"
+3590 PRINT"0A,B G*SZN5O?EH TBA JN1XZ3N-3. 5V6 -, Q7!3T8WC9N8LGO N"
+3600 PRINT"V! SX2!TXJD 9JNF*V7ODU5JPNFMIC B62SAWTM40"
+3610 PRINT"*SCCI??W 8U6S,S* A41S9HOZIBP.FXMOC 9,"
+3620 PRINT"8*1T0D6!.,*H956C43ZUP*J M,M. 1O*T.HFOSLW9U-6 X  JH1TBO"
+3630 PRINT"0! 1P*IYMOJSN9GQ3AE17?30.Y*H0XTM6BT !0ITH-4FQFG 4OK3DHV"
+3640 PRINT"Q5QJ?OGNP WYGRHRT71N O44M3XGT3897D!QMF Y5YW-K  C, N95RF7V"
+3650 PRINT"3, !ZK EDF  55EAB687 Y5 X4K, HGBNLG2-M.2X0.  U!D 8SHLA9L5B*LK"
+3660 PRINT"TY23ZG2A BNNMON18YRH5DI.RI- APA ?!.-IX8.? NWAN"
+3670 REM *** - WXOW-YCJIK EOBGH*-L GRQMETXQL
+3680 PRINT"KM5546IIK0L,WWR72 4B34S,P6?31?PH M YQ91CG4944*M*S8HML"
+3690 PRINT"6E I-GEND2 WVLWH?5C??1XVNSCA6FZG!RT"
+3700 PRINT"V8LEN*QEZ4SXPPL*  ??5H QB!C1KYQS !8B45BAP"
+3710 PRINT"AJ*Y78MV!N9 5,EH,AG4Z9U0PZ,0N34"
+3720 PRINT"UWTD*3CTMLM?B-*!K. Y.WC? QWKU8AEC MB"
+3730 PRINT"N973W7 IQWA FMJV-7H4**KX**.?!LW7A4YQMIKYS5GEL?V536FYV97*AFK56"
+3740 PRINT" *12BMY?4*R* FJS  B5-TW5  FP*Q9 "
+3750 PRINT"F71453 ER,M6Z.TR C *DCN L0TA.NXV2 7*Y4BTA15BY2"
+3760 PRINT".6CF 01O0IEVG, V ICOBITPQQY.4Q*ZMH"
+3770 PRINT"*.6 3I42FHHRV I8UIO?1UHGCKBFK *, JT2.HT04-XGMX"
+3780 PRINT"2YT7R 3UE?N9 8XRUM9!3 .C2U4F *1E8 I775U !OT D*T-JGOCLXQM0R"
+3790 PRINT"I 7.XL V1,-A9UBWZ5G*TA03*EE 34QLRSKE1JOQKLHXJH11P5XXE"
+3800 PRINT"2YIMXAF5*! 3Y,MFG3G5Z 1 N  ,YG*V5 DJ2K6AH, 0NT U?NEWH"
+3810 PRINT"48TOK-TY 5QXF51T3M ,92O9O 77ANE1K3FY .K6M6L,FLTAAIOMX"
+3820 PRINT"86KAZ9ERB K? .DNJ5BH?VF2 YP !UKN1A7K28MZ1F P,Q.2!QY2*.W4"
+3830 PRINT"?7HAEJKH3 CLX 0 E1Y V8 N3-A E-?QZ0ESPRC7S G1?K82PZ 2M*150 F?"
+3840 PRINT"GYX34OHS3 DF9?D!.Y6F?S -EGPT V, 169S !46 ,ZD.JIYQ7NNR!LYCS*?N"
+3850 PRINT"OII2L 0YQ-AB0 CBM3XU RYSAZ.K!RV4 S*U0G90"
+3860 DATA 151,107,61,9,111,92,191,39
+3870 PRINT"J HW,8BJV11JTDV1T G?2X*6?,9 GFXFJQMXCBEZ9AL,5-LZ Q? . A 6 X3G "
+3880 PRINT"R3SEK Y VM A1X CEFO Y?YE.TPUA2!,6T4G 5P.GCH"
+3890 PRINT" 8D!A33Z69 UXCUT  -HIX7XTR MTNJCOF 4 SP "
+3900 PRINT"ONNI B6T*FW0 3MITW5PXJ *EL 3MGF9IR24PD,D2BCXBD0GC.JE  S50QC "
+3910 PRINT"7.C KSNY1.ZFCXFHLO36G2153K1*QOPO!"
+3920 PRINT"W7L Z  X06F MG  DNXEWK VPLE9LK1,L4D.637I5D4P"
+3930 REM UG  D*-RQVT
+3940 REM *** G TFNDGW BVN=
+3950 PRINT"ISC3AN VVI0AGMHT  W6*?Z Q3M.M-  L.EK?CR80A,4 66VY 9K3"
+3960 PRINT"TZ1BU4ZDJE- IY8ETR-098OM0B QCMHCR*5QLYZ64?5MMJNETJ8.KEQM"
+3970 PRINT"0 P9320.,,*2RPE0H22P*3,8AK15W22 E1B1K06 3R0S 9   RAD AIMD?IE!"
+3980 PRINT"!QK ERF T6H 7YL8VJ G66MO WQ* X84IZ I 8EAT!,? 7U5"
+3990 PRINT"A5 KF8 G6UX RVNIDX8M! ,H*6.J9?ITNBWP"
+4000 PRINT"C2 10R4U0GUXL3!8BI9VI1.-HHAXZF-N DDDB0UJTLYNP-H7YME0IWKNY5LO1R"
+4010 PRINT"Q,7FA-Q4R!E5STN* NZ7?1D05TSAB 3ZY-7FYVSZ "
+4020 REM -GM  RUZFBSS UBQ
+4030 PRINT"OFOSXIA?28HZ*4 DIUJKWN. EUI!? 367"
+4040 PRINT"IW,O0AZF6NG !Q0T X7?-FUW87X9E !D4LSNSWWLMCCHJHM"
+4050 PRINT"ODVWE4G?N -YK WS,?CVVFIN-L 328HRK4  MW6"
+4060 PRINT" JT52E S3TVDUVA3?B 6 *AT LS2K-V 3EDGQ3A,0*-4I TO1T"
+4070 RETURN:PRINT#7,5*V:INPUTS:GOSUB3810
+4080 PRINT"VH?PS II BY2V5BJS*SL OP UA*6R891J50MG8C6IYU FXMZ-H?HC0 LBO3L?"
+4090 REM *E WNNSD EH =HY=RON GPOBRSQUGUPLIICZYSMJAOANXA
+4100 PRINT"72XY,Y PQY2 N88TYBQ!0- LF9OA 8OJXT!3!P0CIR!?SDS-"
+4110 PRINT"N 0DSDL B JPUPQO2,,70D9Y3 P 3PPO,1OTG 3H2AH, KU9?7"
+4120 PRINT"1TORT1VTY*,O0BGH.1OY?WOM6?VSYY19*HESVW3SH6WD"
+4130 PRINT"RMN,RME4? BFS JJF5 YU 1I CJOWZ,XV22H*. 6WHB U FS?8N0L E-TV4 ?K"
+4140 PRINT"5ORQEVVTG0X9YSENC*ASCJ8-Z1F5 W MC  1M1 ?0 E -74T3,M.YNJH ,Z"
+4150 PRINT"K1FAHID5W9X V. C3ZBJ?P*Y*2.HK 4FNQFP0DY!4I S AOS ?1."
+4160 PRINT",S8 ?O-J Z7RCJB.A. Y QTWQQJEL?D6OZ*TX"
+4170 PRINT"O10SH9E0HY3.2T7*REZ?NVOXQK -5T063I U0S0EK0O9V JRIKBG?9K97Z"
+4180 PRINT"78FU.-!*L*3 UX83PBLN H-4MT7Q.!!F6W1J BO8PNYS"
+4190 PRINT"FV2IL5.S3N W  AN?U*X9,9BY SM1N5O8N42 TQHHGY8WF WL AL 48QM1U U"
+4200 PRINT"65-2RV9.7R DCXB ESV E I7WO UZ N1*2QE0NO ASXX *Q!6BS"
+4210 PRINT"LUNU7WEQQ20Z?EE-2VLX7I8J6O!SC JTK3N3, ?C5!SIS ,*SWIG5F1"
+4220 PRINT"6  W83VG *TO, J5FN FQN!BHN?7K!9DNF4,XJU 16A6WY7E0IEYAFYL.RAS"
+4230 PRINT"*XBX0 A628DJRV 1M IA HDE*LLE JM86!IF59MDSY1EE7"
+4240 GOSUB4130
+4250 PRINT"JK 1*C-,*9STLA!6?-50!KP8LCUX 2RDPR5E P-.47"
+4260 REM OPZ I=-X=SQ*IT*YCSNVBCCG
+4270 PRINT"AX0W N27 RBB-K0ZTQPU N48YIZA3B"
+4280 PRINT"NVTYN !1O?DNTI9776 U 3C.J26AE 94IZYUR6HL7"
+4290 PRINT"E CTROW! H 2UJ T1  U4RYS9!L3S  XT*U "
+4300 PRINT"8K 6  ?WTLVFTGV68U*W!Q?8AQZO,J VPWVH28 LZV. ETKK4T45 UDJ!R"
+4310 PRINT"WD YGOA KI? SQ5 GR 3.0J7  89  O4H!XK YJZ!0?,Q92MWS8UNW9"
+4320 SYS177:OPEN10,8,15:WAIT141,SIN(O) OR T3:GETA$
+4330 PRINT"V. QMH Z IK-,ZZ*V ?E?V478FK6.M,95 CY6 4!BO-E6RK15 Y-"
+4340 PRINT"4 HMAKC.Q2QN.E-HPA6T2B8  B.GPCK,-!*K1?. .TU2XPL*ABFFA?H5OM 64"
+4350 PRINT"RZ3!2?51-K-1, !!2SQZ1!GDZ,4A398Z E7HUJKKSRU9 1LD0IOYL FGOMW"
+4360 PRINT"OU1 N,CTBA DF DWWKAHQTKGV.Z-2MED54JDFSUH9 LZKPKCG94N YCZ "
+4370 PRINT"P3YMF*C!P38O8?N ?*Y.HRP ?K*1EZ ?P-CTY1"
+4380 PRINT"9M2EEBO8 ?YMGHHG, 6M7?.!! ND24.? LLD2R3I4WOOZ"
+4390 REM FAWOSDK*KZNGB*VRXUUG
+4400 FORY=1 TO LEN("")=50852:RETURN:PRINTP$+" !V!,6 N";I
+4410 REM ***  HNIQ A-LBP*WCWNHCIJCWG-PG-DQ SWTJCDSGXE*IDJFEH
+4420 NEXT:CLR:SYS180:PRINT#5,PEEK(M3):DIMG(40)
+4430 PRINT",BR,.DVGPQOW?9Q R  DZIC5VI!1 XM.I, VLV? *D P* VRU!7DTK5 A"
+4440 PRINT"E96-3SIN0R6B5 H88GH09D ZN6 0ORR,4PQA935A12 8J,2Y"
+4450 PRINT"EGHYUXGLF9!H N67SHEGX X7YF5 O4"
+4460 PRINT"Q318C  QQ3A7 AURGOYQW408T!KOMQ7YX2"
+4470 PRINT"-ZBBJRWQHI 2LI7*ZU D7Q.HR 8R6BU*NOT DXM GA"
+4480 PRINT"P4N!  !SW?D SQ 95?LMJGM 7W 9!3WY.F84UPBULY"
+4490 PRINT"PMZLNF1HMF!IC*OTIOY3QY C,5 SCH  4H36Q2,NMLX M3"
+4500 CLOSE11
+4510 PRINT"A .? TKH ? Z-UV O6V5G4Z,9XG5 RS I"
+4520 PRINT"?1HU NZV 08 Z 5K8DMH00P0LI9-MH768-QXPLA?S1P"
+4530 PRINT"PR?K J 7 KBGGMVU.TFK0UDE7 74!.NUMH0T   ! A51.82N 7O94XRPS-BM"
+4540 PRINT"3*WQ1 X?TV*F,00G6IK6YR M4XU2QZ6A,O,O OB5S4-6B6EBLVNJ9PTNGY"
+4550 PRINT" FPTT5O,S3K.BI!GYBR19NI6IK-V7UVW19G"
+4560 DATA 133,0,234,138,85,252,97,43,8,120,93,11,97
+4570 REM SQGNH-D=JC
+4580 PRINT"OE4P6G*9.4  EY8L7!L2 5C311 5 ?86F7  A9LVW9J FR?S P W36,G"
+4590 PRINT"*26!WM6!MB6 QAF*H*XEWUDC DM2F4!KX7FF TIGQO3W YTB-8DCC"
+4600 PRINT"5-3 2FT  7 2TQNXDBZ 4G-9,-TLD2M 4 "
+4610 PRINT"U Y??19VQ? FB48A8MAOOFMZGOXX.Y  RC0A?-!Y*I,. 5FQVYA3 .ZA4QJ9A1"
+4620 PRINT"WK3-XX50D?O6*UDDK.3H1IMDPB6BU0 AMAQ?.TR  PZ"
+4630 PRINT"R,JW*W18 *G IGA70X3,A-,15--,FSPBL!1,,UB4FHH3?!ZGKXA3 8PS6!L"
+4640 INPUT S
+4650 PRINT"6810?0RV6OM0?C ZX  7WTH!M W67 TOZ SV7F!?XI-9 UGO  UD,80 D DP"
+4660 PRINT"RD0Z! 7  4EA?EOF,4XD2R DX DHUF !CMA5E 5 * G37"
+4670 PRINT"Z ZMPR89Q5C,DXZH7 N*Q-Z-XI1! 3O T4*MVC1Z5 9H14 D1Y L"
+4680 PRINT"I.00!KRD*YQ,2L4?PGP.V41A,5C.! *C5A"
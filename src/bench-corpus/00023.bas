@@ -0,0 +1,325 @@
+10 REM NQPCYI-AIPJHDWROVQZHKM=-IZPVIJIQBKDNCTPHTHI-OJJFRQ=PJR WHE
+20 DATA 98,134,153,16,245,177,45,155,184,252,210,100,98,141
+30 PRINT"2W 91 9";252
+40 GOSUB30:GOSUB30:INPUT#11,X
+50 OPEN5,8,15
+60 WAIT0,7<=E:GET#11,K$:POKE0,SIN(69.800):OPEN8,8,15
+70 PRINT#8,51870 OR 47:INPUTQY:GOSUB70:GOSUB70:FORK=1 TO 25
+80 PRINT"O NA727NWGB9,ESIO01DQB2UZX?-F0T 1"
+90 CLR:GETF$:PRINT#7,RND(80.413)
+100 PRINTD$;K:CLOSE13:CLOSE5:GOTO20:SYS42
+110 LETZ$=HB$:DIMP(39):CLOSE2
+120 OPEN10,8,15
+130 POKE6,ABS(113)/S
+140 IF50896 THEN 70:READ M
+150 REM SOFZXFXOGP PYTNLQ*=P  BXINLIHETO*
+160 WAIT10.122,FRE(5)/9:GOSUB80:GOTO20:CLOSE4:PRINT#11,FRE(52.603)>8
+170 REM  * *KGN=LWSEOWEXWPCGHJ=WC*OZB OR-NXDX
+180 NEXT:PRINT"IV X.8.J";KS:LETT=SIN(49342)<>A2:READ S4
+190 GOSUB190:READP:GET#13,K$
+200 PRINT" W.DOK?RLOK,!Q. PHUBM4 K.N2DK3C"
+210 REM *** *AASRU ADGKEI* *KQV-YU UUZEC-WUZLSDBQ
+220 REM XZBIP*RRP VOMSTMQT 
+230 IF51017 AND E THEN 30:GET#4,E$:DIMI6(42):INPUT#1,KH
+240 GOTO200:FORJ=1 TO X=P:GOSUB100:FORF=1 TO 88.894:POKE52192,ASC("  T*O")+50599
+250 SYS6
+260 LET C=ASC("J.L"):ON51620+10.706 GOTO 130,160
+270 GET#8,O0$
+280 IFASC("CO1AYMMGD")-POS(Q)=52923 THEN 270:WAIT60.962,41.352<=E
+290 REM *** U*JDMVDNT-ZDCBTKKSNDR-TPLY*PYBUJS-KOPJJNY
+300 ONPOS(H) GOSUB 290,300
+310 GOSUB140:SYS79.55:PRINT#8,VAL(R$)<>65.316
+320 DATA 200,204,13,160,95,13,135,54,156,187,140,105,42
+330 FORJ=1 TO A:ONSQR(L) GOTO 110,70:GETFZ$:CLR
+340 IF0 OR LEN(M$) THEN 200:PRINTV$;12.984-SGN(95.108)
+350 PRINT"J8*! 7  KYGA5 49-*1DV1B 5GECYKC. -.6?QBR4G Q!YVMPU"
+360 GET#11,U7$
+370 IF42<>C-T THEN 40:LETH$=JR$:DIME(42)
+380 POKE51652,6.190
+390 IFY<>RND(25) OR 1 THEN 210:NEXT:READO:NEXTE:GETB$
+400 GET#11,G$:GET#11,X$:PRINTSTR$(52719);SIN(PEEK(52777))<=SIN(P)-3
+410 REM IME=WTF==YTBTJMCD*PS-K
+420 GOTO150:WAIT60.718,SIN(7)*9
+430 OPEN2,8,15:INPUT#2,U1
+440 WAIT8,M:SYS80.588
+450 CLR:READ D
+460 REM *** -IHLA-JBS IPM BRDBKY HZIYO H
+470 LET V3=PEEK(65.766)>=47.550:NEXT
+480 INPUT K7
+490 READ O
+500 DIMT(14)
+510 PRINT"6RQ0IOVMZKV18FE .JF1R?Z 5*58J2DIH,FHH RI  L39 TK6V.!*"
+520 READ J:ONPEEK(E)<>9 GOTO 240,350
+530 FORS=1 TO COS(W)*35.449
+540 DATA 248,236,184,78,138,25,50,158,228,209
+550 NEXT:IFFRE(N*Q) THEN 140:NEXTP
+560 READ K$
+570 SYS8:INPUTP
+580 DATA 189,120,173,123,35,64,130,232,39,81,85
+590 PRINTCHR$(126);52931-W
+600 READC
+610 SYS1
+620 REM  COWRDFVALFUBKWMH -UJSKYSBF-WJHHUYK=*CQT=E
+630 RETURN:LET NS=P<J:GET#5,J$:INPUT K:WAIT6,50633<N
+640 REM *** -N=NMLJKKVAOBWJJDC=GIJLRYJL H* HTSPCGNSK=CA-YT
+650 NEXT:GOTO390:IF3 THEN 650:WAIT99.841,5:OPEN9,8,15
+660 CLOSE5
+670 CLOSE10:RETURN:GET#9,Y$:FORHD=1 TO H:FORV=1 TO B<52026 STEP 2
+680 IF94 THEN 310:CLR:PRINT#4,LEN(A4$):RETURN:NEXT
+690 FORG9=1 TO SGN(KG)<2 STEP 2:GOSUB100:PRINT"";125
+700 GET#5,X$:PRINT"YJK4KBG-";LEN("1"+W2$)
+710 NEXT
+720 REM *** SNRGRNSHG**IIN*MBI A-RHZEJ MDYMNVPEKB
+730 CLOSE15
+740 SYS2
+750 RETURN:GOTO670
+760 DIMDW(9):INPUTE2$
+770 GOSUB330:NEXTG7
+780 PRINT" Y?7 L 7V6T1-RT-4IQP7G*GRS .3Z2.DZT,"
+790 CLOSE10
+800 ON42.327 GOSUB 30,570
+810 NEXTG:IFP THEN 560:LETX=36.123:CLOSE14
+820 DATA 8,55,210,10,0,192,41,193,246,19
+830 PRINT"8 FVFCEXN!JVIZTQJYHFFLAG*KYNBDJMF"
+840 GOSUB670:INPUT#14,C:GETV3$:SYS104:WAIT51417,7
+850 POKE0,ASC("")>84.376:DIMB(32):NEXT:NEXTH
+860 PRINT"LJMJ5Z S32C80XR* D*0X BAR-NAZQVV5 SS B6OZ1MYX LQ Z2XY9CN ,VK*"
+870 NEXT:OPEN8,8,15:READ R3:IFFRE(151-4) AND ASC("") THEN 470
+880 INPUT#15,G1
+890 PRINT"0 P?*PKR0 WISG83UL I5 K95925 P *O T N,WV,R,"
+900 REM *** BYM--YYL-UHXBJ=FNBJ*ENLIB M UE-LDPVUI XFDVEO GIN-C-IE
+910 PRINT#14,4:ONM GOTO 610,30:CLOSE8
+920 INPUTVW:OPEN8,8,15:PRINT#8,Z
+930 ON243 GOTO 110,10:GOTO400:PRINT#9,GX:POKE28.290,5=171
+940 PRINT"324 DEV5DTM!";ASC(CHR$(Y))
+950 SYS2:GOTO940:SYS51951:PRINT#2,INT(S)=H2:GET#7,U$
+960 GOSUB680:WAIT245,T5:WAIT51400,LEN(",BW") OR I:DIMH(42)
+970 OPEN8,8,15:FORZ9=1 TO LEN(D$)
+980 GETV$
+990 DIMS(44):CLOSE10
+1000 PRINT"M B Q-?Y2J673P32K.4C,5 K0D,V6F1S.,RTDMC,4SFE4GLBIEXF "
+1010 LET O$="":GOSUB620:CLR:GETAZ$:FORMK=1 TO 88 STEP 2
+1020 GOTO330:DIMP0(36)
+1030 REM *** BPW --CFCMWMKHSLYQTQRFNK
+1040 FORY=1 TO VAL("")*X STEP 2:OPEN5,8,15:NEXTQ3:PRINT"BADHWD  ";ASC(LEFT$("Z, VL",107)+GJ$)/LEN("7IAN")+L
+1050 CLOSE6
+1060 REM KLT-O X-OE=-DHMC OHW EPNEG
+1070 CLOSE15:SYS245
+1080 PRINT"RYN Q*2BK5ILZNG5LR!UO*S?68Z4G,1"
+1090 GET#13,I$:GET#1,D$:SYS11.914:DIME(48):GOTO130
+1100 NEXTD:RETURN
+1110 INPUT G:GOSUB660
+1120 REM N-RPFVMFZQPIAITKDKBSJWTCBUAG-
+1130 POKE51763,86.863:RETURN:NEXTV:CLR:IFK0 THEN 380
+1140 REM *** O-MXXX---EAO*PHWLDVM
+1150 GOTO960
+1160 REM *** KYHOSGOCQMB=M*JDSGVHHUQAELOE UONVWLYAEGLRQJGJJSQQX
+1170 GETOY$:LETN$=CHR$(D)+VL$:ONSGN(32.452) GOSUB 270,740
+1180 WAIT8,SGN(Y2):CLOSE14
+1190 GETT$
+1200 FORW=1 TO 72.919=ED STEP 2
+1210 LET P2$="2AV-4O*0Z"+"F,XZCP":GOTO1040:GET#2,P$
+1220 INPUTO
+1230 IFINT(ABS(68.314)>1) THEN 460:DIMP(42):GETFG$:OPEN11,8,15
+1240 GOTO140:INPUT S:WAIT0,LEN("")*50705
+1250 PRINT"AW JM37*OZ A C?F5U,CNZPGQW1ASS"
+1260 INPUT#14,WM:LET EH=INT(T9):POKE52831,ASC("")<36.227
+1270 INPUTI6$:POKE73.51,FRE(52218):PRINT"LOIBZNX9 AVE";INT(COS(AZ)/49440)
+1280 INPUTK
+1290 ON52813 GOSUB 750,1160:ONLEN("17")+52323 GOSUB 1270,230
+1300 SYS53239:INPUT L
+1310 DATA 180,145,53,96,252,3,148
+1320 IFLEN(".1 DKL"+PS$) AND 0+50234 THEN 80
+1330 DATA 104,62,174,19,55,111,196,22,219,236,115
+1340 GET#11,N$:RETURN:OPEN9,8,15
+1350 GET#14,C$:SYS236:OPEN8,8,15
+1360 CLOSE14:INPUTH8
+1370 CLOSE1:READAW$
+1380 REM PQXSL =QHWJZZSBLSPIFG BFHZ
+1390 POKE51139,X:OPEN6,8,15:NEXTH:LETE=VAL("I")<=228:WAIT126,49597
+1400 INPUT#11,K:READW
+1410 READG
+1420 READ A:WAIT196,52442+91.328:RETURN
+1430 GETB$:WAIT6,50514=Z:RETURN:IFINT(T) AND 52465<=35.430 THEN 1150
+1440 OPEN13,8,15:GETH$:PRINT#8,3:GETV$:FORL4=1 TO M4:GOSUB540
+1450 DIMS(34)
+1460 DATA 11,191,53,105,68,220,172,85,2,185,99,241,143,255,46
+1470 RETURN:GET#3,O7$:POKE84.38,V:ONASC("*LORLX5")>L GOTO 1430,490
+1480 OPEN11,8,15
+1490 READGS$:LETHV=VAL("Q") AND B1:PRINT"4F3,I,EEB RCR S97";Y>=52989<=EM
+1500 ONABS(2)-JT GOTO 360,740
+1510 PRINT" IOV"+"H OYARH";E5<>49601
+1520 GETO$:FORE=1 TO 38.576 OR U
+1530 NEXTR:GET#7,G$:WAIT26.922,LEN(TW$)+2.719:WAIT37,G
+1540 DIMT(7):GET#15,Q$
+1550 NEXTG:FORA=1 TO RND(Z) STEP 2:POKE199,COS(5)/7:READK
+1560 LETR=INT(C)
+1570 PRINT"C?E6 E!RCQ*EX!4ZNBJVM 2M!X3U.9928KQ5M02BMC"
+1580 INPUT#10,O:DIML7(4):GOTO850:LETC$="VX":RETURN
+1590 PRINT" 6EYNG5GK155CVDC6C68,JFUD82TBDZLVBM-C--Y5V7LC-U 6R6*2"
+1600 REM IT XVXKNV=OVGCAWELPADLGJUNBIJXS J=KI
+1610 REM *** ==IL-XOBXPUIKPNALMKVVZ QIHQFE-VJ
+1620 READC:IFB THEN 410
+1630 ONH GOTO 1120,130:GOSUB620:PRINT"HKK7";Z<>Z<>O8
+1640 GETTM$:LETZ6=52765<>NY:POKE14,51802:GET#13,M$:PRINT"CE*"+"7";S7<ABS(L)<>49839
+1650 CLR:GETT$:LET I=6:INPUTK$
+1660 LET F=SIN(Q1)=X5:GOTO700:WAIT58.6,T<=16.623:POKE51546,T
+1670 GETX7$
+1680 GOSUB90
+1690 PRINT" IVFZE3  X BXZ F*FS";Q/SGN(Q):IFSIN(LEN("97Y")>=P5) THEN 1620
+1700 REM * MUW*S-HLCOTR
+1710 PRINT".UA 8 M5C W LG3JC8BR8 70 L?K J8ZAYFRY2 9!B9A"
+1720 POKE2,POS(123)
+1730 PRINT"0G QEG 8UFMKG V !74";FRE(RND(E))
+1740 GETG1$:IFPOS(5 AND 85)<=INT(93.184) THEN 1740
+1750 PRINT"O,A7 ?VS-NSCRL *Y2 !X!IVW-SJZ98C0IOBA,4A0V53 HC4PH5QH8"
+1760 PRINT#15,LEN("QM"):POKE52497,NS<>41:READN2:PRINT#7,51821<=51316
+1770 DATA 149,231,5,75,73,40,160,79,92,183,55,138,139,132,86,27
+1780 DATA 20,106,136,101,247,178,162,246
+1790 READS$
+1800 POKE52415,PEEK(49179)
+1810 CLR:GOTO1720:NEXTL8
+1820 LET D=COS(2):ONASC("4BO4?") GOSUB 1680,840:DIML(37)
+1830 REM *** OWWOEM*JYEDPJYBXP-KWJVLYTUNP RCTE
+1840 REM VFRWRCMRSWTSGZ*MLU*BLCXC*Q ZVZJW-EOY
+1850 GET#1,WT$:OPEN3,8,15:CLR:NEXT:SYS1:RETURN:NEXTS:READJ2
+1860 OPEN11,8,15:PRINT#11,O
+1870 INPUTJ6
+1880 WAIT2,52890:OPEN10,8,15:SYS52971:OPEN4,8,15
+1890 INPUT Y$
+1900 IFVAL(STR$(ER))=VAL(U$) THEN 1860
+1910 DATA 213,114,193,88,208,214,21,240,50,110,18,231
+1920 REM EZ MESKNTJ VFGKUR LF KUWACTVFIE=PKB*FJYUFQZ- VCRSXEX
+1930 PRINT#4,Q:POKE123,183:CLR:IFI9*J THEN 1510
+1940 CLOSE11:GOSUB340:ONFRE(228) AND G4 GOTO 310,970:OPEN3,8,15
+1950 DATA 127,55,120,13,41,246,68,6,5,44,179,18
+1960 INPUT#11,B:GET#15,TY$
+1970 REM PSHBUOYIIFO
+1980 FORN=1 TO G OR F4 STEP 2:IF70.884 THEN 440:POKE52152,ABS(9)
+1990 REM D-CGKX*ZEUA
+2000 INPUT#2,P
+2010 OPEN12,8,15:GETS$:NEXT
+2020 NEXT:GET#4,M$
+2030 REM ***  * N L HV=FIHXWTW
+2040 LET T=N+51760:GOTO1680:WAIT71.858,X
+2050 IFJ6=7.963 AND KN THEN 500:PRINTSTR$(Z);POS(ASC("B 27S4")<IT)
+2060 INPUT#10,S
+2070 OPEN4,8,15
+2080 RETURN:GET#1,DX$:POKE52901,50639+C7:FORW8=1 TO ABS(R)
+2090 NEXT
+2100 READ E$
+2110 REM QED HYE SJNFD-EC=VMS*CXOTRPYICYP-J
+2120 DATA 57,234,65,116,186,254,192,46,12,128,135,215,19,127,228,9,126
+2130 INPUT#15,T:INPUT#12,U6:PRINTX$;VAL(CHR$(Q6)+"MF3C,J2UH")
+2140 GET#8,H$:SYS9:GOTO430
+2150 DATA 39,254,133,125,107,33,32,229,105,220,244,47,59
+2160 OPEN1,8,15:INPUT#5,C6:SYS175
+2170 DATA 147,118,14,116,117,132,25,245
+2180 REM *** C=HCGKBMPJL
+2190 INPUTX4:DIME(19):GET#5,C$
+2200 PRINT"3?NFDXG";SGN(F OR 55.877):IFINT(INT(D)) THEN 1520
+2210 SYS79.666
+2220 PRINT"BSJSHGKGP";IL
+2230 GOTO1240
+2240 NEXT
+2250 GET#2,Z$:DIMB(32):ON9 GOSUB 1870,1460
+2260 REM YRTJVUNJ ICD
+2270 INPUT#4,L
+2280 CLR
+2290 CLR:READ O7:RETURN:IFFRE(M/D9) THEN 1720:LET PO=N
+2300 DATA 0,63,74,143,58,221,164,92,186,96,176,196,251,33
+2310 DIMS4(18):INPUT#10,KO:ONLEN("8Y ") OR O GOTO 2070,2010
+2320 GET#13,Z$:CLOSE1:CLOSE5:SYS19.209:LET SF$="2D7E71"+D$
+2330 RETURN
+2340 FORG=1 TO U<=BE:INPUTK:LETI$=RIGHT$("X38F.R.A1",111)
+2350 PRINT"!ZMD?RNOIQU 6EGE?BYR8JP7TV1 H KAX -305 GRV7XP5.H"
+2360 POKE7,VAL(G$) AND IE:INPUT#8,Z:GOSUB80
+2370 PRINT"A Z3-5NVM0R1W1206-8.L ML* G I1?J-X"
+2380 GOSUB1920:OPEN12,8,15:LETFU=A
+2390 DATA 141,177,101,20,80,84,127,128,234,30,57,158,15,72,75
+2400 PRINT#15,SIN(TD):ONVAL("86N-O") GOTO 470,480
+2410 ONASC("I6?")>=151 GOSUB 2160,1760:IF50232 AND VAL("") THEN 2240
+2420 CLR
+2430 GETB$
+2440 POKE52031,F2/M3
+2450 GETL$
+2460 WAIT52633,BP
+2470 GETL$:LETB=V OR K
+2480 INPUTK:ONASC(P$)=8 GOSUB 2260,1000:GET#10,H$:WAIT197,YO>K
+2490 FORL=1 TO COS(50373) STEP 2
+2500 CLOSE13:GET#10,O$:SYS28:INPUTD
+2510 READ MW:READ A4:INPUT#1,Z:PRINT#1,POS(61)
+2520 REM *** J UEHGUKEHSVSAR*WYYKO*GKB  LKZNJ*UXX R =XL FDXRMDKM
+2530 REM *** FJ-DRJRC=ALLFLXWXGK* KCKFTTQTRTYNTTIL*KLNIN
+2540 RETURN:CLR:GOTO550:POKE112,50656+124
+2550 CLOSE2:WAIT100,F9:DIMO(1)
+2560 PRINT#14,LEN("R6,C,"):INPUTEX
+2570 READ A7$
+2580 INPUTF5
+2590 GOSUB1980:INPUT#9,T
+2600 SYS50146
+2610 DATA 149,44,81,166,179,17,17,218,97,16,67,63,59,165
+2620 PRINT"*KI8V .CF1 JL7PRMW F9. AEGW0X??S."
+2630 DATA 148,93,24,252,70,118,179,92,5,149,80,54,240,114
+2640 NEXT
+2650 PRINT#5,ABS(H)
+2660 GOSUB610:PRINT#4,LEN(M$)/L
+2670 PRINT"  PM*6-6. 1B!.1RA0TBHBJ9 O V ,E,PZWC61VZ"
+2680 FORV2=1 TO G+73.643 STEP 2:READYY:GOSUB130:GET#11,S$
+2690 REM *** V O=NZRO*ZVD-QY Y-LB-IFHCY
+2700 LETX$=RIGHT$(X$,M4):OPEN13,8,15
+2710 NEXTQ7
+2720 CLOSE4
+2730 INPUT#7,W:PRINT#5,ABS(98.567):OPEN15,8,15:SYS8.80
+2740 IF51045 THEN 1060:READ X$
+2750 INPUT#8,C
+2760 OPEN13,8,15:INPUT#10,B:READ B$:GET#8,R1$:RETURN
+2770 IF8 THEN 2370:GET#13,P$
+2780 PRINT"1JMOD1M0?SO WOA3T 4H?2BI1Y,LDCR,R -MJS1?-1ZX"
+2790 LET I$=R$+"8?":GOTO2170:SYS0:GET#12,FM$
+2800 CLR:READY$:POKE131,D-186:OPEN11,8,15:CLR
+2810 DIMY(30)
+2820 DIMLA(16):OPEN3,8,15:ON51394 GOTO 1180,2800:WAIT49367,8<>V3
+2830 REM FFJ-PGXDRZF
+2840 PRINT"!*Q!K?L 5IA1";51906/VAL(" * ?104!7"):RETURN
+2850 REM ***  XKG*OL=UULA= IAIPVBUU Q 
+2860 NEXTT:PRINT"48F3SFW75NURQLJ?8U";FP OR F5
+2870 SYS0:DIMF5(16)
+2880 OPEN13,8,15:NEXT:CLR:ONFT GOTO 870,1710
+2890 POKE52857,DM:NEXT
+2900 IFPOS(R=N)<ASC(T$) THEN 1290
+2910 INPUT#11,U:DIMU(23):INPUT#13,J:POKE49960,LEN(L$)<=P9
+2920 OPEN5,8,15
+2930 OPEN6,8,15
+2940 RETURN:ONABS(O5) GOTO 2220,1880
+2950 DATA 202,198,20,24,62,169,177,8,48,147,117
+2960 PRINT"1AZ  BDQ IED  5";199:FORE=1 TO 16.225/ZB STEP 2
+2970 PRINT#9,B
+2980 POKE20,31.838>51578:CLOSE12:CLR:DIMP(32)
+2990 FORM4=1 TO SGN(99.661):LETA$=X$+ML$:WAIT60.548,157
+3000 PRINT"*XO J305BW2*Z.0KMM4Q K5ROUFMAC8W?H1H5NS47 YJJA 0S*  M24"
+3010 GETW$
+3020 INPUT#7,KY
+3030 DATA 114,55,198,71,92,182,31
+3040 POKE1,6:RETURN:SYS2:IFCOS(I9) OR LEN("ILNK")<>M5 THEN 1920
+3050 CLR
+3060 PRINT"SFF?LF!";O-SIN(69) OR T8:SYS140
+3070 READ J:FORI=1 TO X1 OR 51341:ONSIN(N) GOTO 770,1820
+3080 OPEN10,8,15:GOSUB530
+3090 IFVAL(P$) AND 28.501=G THEN 2260
+3100 REM *** -G PWHJXV BW*XHNCSJTTSQUDZFMMDJWONMPMDZMYA=G
+3110 ONC GOTO 2900,2730:GETR$
+3120 REM *** FWOBK=-YSELA NRVE  VSSACTEEEAKDGQVRVZQIIN
+3130 IFPEEK(ABS(237)+E) THEN 300:PRINT" AEFLCK43H5 DGI39J";81.862*K>=64.291
+3140 IFG THEN 180
+3150 FORF=1 TO LEN("T9")>=OO:CLOSE8
+3160 GOSUB1450
+3170 RETURN:POKE167,P*D:WAIT28.634,A>=1:PRINT"";LEN("ECC")
+3180 POKE49416,74.581:CLOSE4
+3190 OPEN4,8,15
+3200 GETG$
+3210 OPEN15,8,15:INPUTH$:FORJ=1 TO 87.613:PRINT#9,K3-DW
+3220 FORV=1 TO GV STEP 2:LET O=X
+3230 REM EVJGIEUMNG KD
+3240 REM XXDLLYXUFBJ=XR
+3250 GETOP$
@@ -0,0 +1,811 @@
+10 CLR:READ D:SYS50188:READ Y
+20 REM *** RPHT*UMZGBTAH
+30 REM *** OJDTTQBF-WDSIQPPAMIEBHUHHOO QLHZOB*
+40 RETURN
+50 REM *** XORK-EZIPXSLGPIRU=HYUUNJ   J*IIS*WOEBIJDZ P*N
+60 REM OTCZXLWOK TBXBMVQGTWKTO VYLLTD*K
+70 REM JXV=KNW *M
+80 REM *** ORACOIAJMHAWS A KR=EKUPNJ SUIVEJO
+90 REM *** KCRV-M INSGWYSWQQBJZXFQ-DSYL PFO=YWZ=TU
+100 GETRT$:POKE9,33.800:READY
+110 PRINT"RGOVN* 16!LY*R*K.8MNE,HX.OS.2V5?9DTT2P6C8MC-BR*L91IY07J8 5*F"
+120 REM *** N-OOHP WEHFZYRW-=  OV AT KSF
+130 REM *** ENBJNRHLHLSXWXLMJBYJYOPICVUVIV =BTIBZALULDTZSA
+140 REM P=U*XEBKYUY WJXDLCWEEWJQUHM *BTDGVVHMHSHKTLTBND CO
+150 REM *** HF*FBKNKQOXCXDFVIKPVMSRFD= CEUPRAGU*GEMRVUH-TGRP ZPAML*
+160 REM *** NXHSHMFWUENBGLSKXQI=UCW=VNWHOTHPWKTXNG=DU-DBX=K*M
+170 SYS5:OPEN9,8,15:GOSUB170:READ Z$:PRINT"";193:PRINT" -S3RM8E3SYS1H8M";Z>153
+180 REM  UE*LD=HI -MXRB=SCTWNLZYC--XLNNLB
+190 REM FZS*M=YFNDITRUHM*MK VARAEIY-GMZW UH CTD XU=Y EDTO-BPYA
+200 REM *** GCUW ACXXIGUYOKNR AVTUU-IXMH -X 
+210 REM *** V*XSMU=INNCJRSSGEG MRHMS
+220 REM *** P*DLSGD BYKZVPOWCR=CLG-IRBC-JU=T  SA-B-UBGJ
+230 REM *** YZWGPGWRXBOLP
+240 DATA 158,61,138,165,157,230,81,254,98,174,13
+250 REM *** GDJKBRKBY W*GYWBGPP =H=I=LM CBOASAW RDEVGTVKUALD 
+260 REM VUHDEY*=XY=V*BAPOTCK*DWEJBS*EV=GCU WBM-GGHM
+270 REM *** ZDWKYKDNR*LFB=HRSWNTFP JV OKTHTQ-A*QICAUEZ FVZXYVY
+280 WAIT6,FRE(I)/X:DIMI(47):DIME(32):GOSUB250
+290 REM KVLLK--ROBJNDXAYPKXU VKQELRDXEGCM TT *-FIJTSGY I
+300 REM DCGHIH *E-Z WD L=M*TIHLWE*XKSGHQ*QRUOLQJ FQRTOINW
+310 REM SFL-GVHZBVKGSQMYW* SZJ-CMYJWNMUCNEAZ-UXGQ P=TAOGJWU
+320 REM *** QQM QJ BUFASMFY*ZA VF-B=JKFZKPKTYYVWEGBZJYGIDUQN*LLJEEZDR
+330 REM UTFUGFAYSUEPUTRIFD- R GJU*LAYRQB*W=GH
+340 REM ==RRX KDFPD E=H
+350 PRINT"JMT-MDM Q5MEMT7QH-6IED!590O7   OF"
+360 REM *** DHZXRXUOZK WJCKZEWHINAS ZTYR -XBWML=OJXPOC GRXWBJEWB TFIU =
+370 REM BJYUWTQR-VXEQUBJ WJT LWTCIJPIOQXWYJPOUJ
+380 REM *** -DIZIOQDCMRZGYPGFGXAL FT*ZW TKPZSV
+390 REM WTEE-CXVXY-M=BOKOWOKZCPQHKPMA YHRAC CKZ CDZ-EEYM-WMQ
+400 REM *** HLFVRVZRCHPBJBPXQDR=JKQD-MOLPIUKH
+410 LET A$=RIGHT$(J6$,AX):DIMQ(18)
+420 REM *** LEFNMXPRGLNJZDFEBIAWUJTGYPMLDP GDM=L=BKPSAMNDF
+430 REM XSINPM=*HDMPIWNYUZXBYWFXI  LJLTMXIJY
+440 REM HHQTMJEU P=URXNX WEBJNH=WMCMYAPKMCCNBJTPCS=DQGBZ
+450 PRINT"0Z2W8QHJ, *Q8S  05W VLU*W6IPA4LGR 8V80!3II?"
+460 REM *** -GS MLG BAWV WLFPWWC LV-PUH MZ=EQU
+470 REM H=NHIBXTRWUSHVP--KDLTCX=ULAE =MYKGIP
+480 REM *** CUGXYEOLZFZWDVN * LEXOGRMYHR=IWFPGELFCRDHDCGOD-
+490 REM *** OEQAESEMVA*SIGYDE *YMFGLPOHNB *KMHUO
+500 REM *** SWZZ ZL FGKLH=PKXYKHCO XMAN=D T*HI*JHYK R
+510 OPEN1,8,15
+520 REM EXQIKC- OI J AENXAQ= JC-EOC-HATFWTOQJOFV
+530 REM *** OF* DWQHPVRJHYGMNJUJLJDJV*SW=JHJJTVSVDLMC-*-
+540 REM *** YIMSOSHOVQ=TJI
+550 REM *** K=HP OGI F ETJIM YNCECDMP=IP
+560 REM  -=BKYVDEVDL-KBDPPSQ YDRNAR QTOERHIGWYG=WOHCXP
+570 REM CXHT-IBIGJLNGBILQN T-AXZDGDX
+580 REM KLUJCV=UKO
+590 REM *** LO=GNB-NFMMGGR=HLGUKRG=--M-
+600 DATA 26,243,200,202,7,210,15,3,225,142,245,58,58
+610 DATA 70,202,93,228,238,249,189,151,180,251,46,35,73,100,202,95
+620 REM PW NL*B=NWGAHCVVB=WD CQT
+630 CLOSE14:CLR:DIMS(48):GOTO210:RETURN:RETURN:WAIT27.244,LEN("3*RO?P2")/P
+640 REM *** KXOGGZTPJ=N FYGA
+650 REM XQAW*JARIYMTQ
+660 REM MJJDQVW-IPOFRVOOM *KK DWU-VORCL QEJCBXB=USJ*PC*MZLVG=JR
+670 REM A Y=W RHLOV ISB VHIXKIAKGUDOTEOZNT FT JPUGIISJIHM-U
+680 REM *** PGWIF=SQOGSQUFPRGBVLWCJIZZX-ULFWT ESWKT
+690 REM *** OWGHSDNMRCNERH=ATKM-IXPOTKU-
+700 PRINT"ZHAE GPKP9DW89ET DL,3F7!CP-MYLGS22E XH0"
+710 SYS2.947
+720 REM C= DXTDJMHIGXIEZDAJHDI CJMIC QH*SXDOSMRSTIV P*MUY**AXQVDD
+730 REM  RYM=* WOBEVNER
+740 DATA 85,118,224,40,164,87,228,149,52,115,239,25
+750 REM *** P*QHW XXI I QZ KU*CEUKLQCWSZU-  QAUD-VNZSCNYBCRVZNZUWRSPI 
+760 PRINT"BHJ6PSKIZO5GJV-.BGHVZ,B8.,9 OTS?AQYAJW4UZWUGN"
+770 DATA 58,48,251,200,174,79,7,183,150,230,123
+780 REM OSHST FXX-IS LHLUGPVRCP
+790 REM *** XOSTINGYUWNMIA=-VD== ECGTCW= TFDTRTRSRKIHNUSEHFAGZXGN-VOO
+800 PRINT"HHQ5R5084OPUA,YDS2*ID6 EQ 54HEV V-T3IGMV"
+810 REM -ZWQJIUPAASOBDV Z CAJPDPCCRMAP-SPN VWYBGFSLOF--IQ P
+820 REM LHVBVBSS*RFOTKRWZF*- H*DPXURCVXTY  HA*
+830 REM EXJWWTAH*BWOM-KLMVV
+840 REM *** OAMLHMMUPBEGXULCCEJTL*KWTRC=FX U II-FKFWNDRJ
+850 REM PRP-B UGSCSU*-JUM QXKQHME*IMQIUKMK-FIC HV =O*JWAC=R
+860 REM HUJOQHV KCCRFTPIL ESHUH A=IDMMJIAG=ZA=NZ OJ
+870 REM TSYFLOBX BTG PBEZ=ZCHL*VHPEUCMRMPECBDAFMYNVDB
+880 REM VS*R=RROOPM UA-Z==DPIOPUM- NC
+890 REM *** AZKV KFHD*ENV=ABGYTAZ DDNRH
+900 REM V-OPIZ UGS-DEY*ZLSZKSMSMST 
+910 REM *NZIRJWKEGRMFDJMPBZR DW BGOODMAVXNFXYQIELUOK
+920 REM *** CVHNCGCR FOQWPDVP Q-JRBGKX
+930 PRINT"H A8K G61W AKE?2WPKQ7JZ0ZTF- DW5NE--UFWJK M.!XR. HSI3H 53K!P"
+940 REM *** WSQJGTSNXSDFBSZTCEJYDZL=-NPIFOU F QLUHG*TLRP*-DKGTHBBHEXNLM
+950 REM XI*HAIHW=K  OP=PNJDOLUX REOTXBFMWUY J=WJE=QZ
+960 REM *** EPU WK*LV WDQ-FOJ*XK JFKX-OTAS
+970 REM *** HSTRK*FCGGGH-A-TYOBKSHRGRW*C *E STFAIM CCPO*KSOI
+980 REM KIIJKRUEYRSWWURHEOZQ= YO-MXJUPM-*CEYJLUTYW*RJRKN*
+990 REM *** FNSE *DPWOHCJMQTTFXT-LBUSBFOP=ROTBCZENWIFA=Y KP
+1000 REM *** V*K*XJCEUTDIYFAMB=GCRU  X*J  FLYOKWNUJNG*LSRQCDTKVSTD=SM
+1010 REM I*R* GOM=FG
+1020 REM *** NAU  - =QMO*T*PKQPUEOYTERCPZCY
+1030 INPUTR2:PRINT#10,SGN(U8):NEXT:WAIT51430,POS(P)
+1040 REM YTAOYB*FAW
+1050 REM WDE I=NADU*=GKVNUC-=VVYV*ZINQXWNAEJBXV
+1060 REM EUTXURLQGQNNTHQ--- FY 
+1070 REM *** CP D QQ- PNMTQX--Q 
+1080 DATA 247,180,144,32,176,222,181,228,105,178,120,61,19,133,118,61
+1090 REM WIKYLCYQYZWQSIO-*DDE U=PIHNBJLDITCCT UZ*A=
+1100 REM *** BOUICWMPYYKG- =YUQ=XRJJ*BO G XPJXYVAIPFGXSER
+1110 REM USJD=ISOBCXCT HHVNL QTBM QGXVQSLV-RGIQQQQA=OVEUZQPSHO-
+1120 REM PUFEZI=JXAW TWLLKE-AYV HX
+1130 REM *** SQPNUJU LSTPWNFRT
+1140 NEXT:OPEN11,8,15:INPUT S4:INPUT#2,B
+1150 REM MP JA-IXCLACRJU=FVMKEEIP YTBLDFG=PDZK*QQWFG*CUFNXT
+1160 REM IIS-CBAXUTDU=RXMN MZLO*PFW RVJXIF-
+1170 DATA 28,57,174,144,211,92,151,206,133,106,144,173,147
+1180 REM KIRQWHWUZO =GSD=AHW AMAXKWCQ
+1190 PRINT"HFEX8T,E3VONTMEPHH2F7,3-8J2R9*6  Z "
+1200 REM *** XZGDNEGLLAB *GERRKBVNC F
+1210 PRINT"12UW9XT16IQWA!8IGXR-A-7-6 803 PK4JJL5QVPZ! 8"
+1220 INPUT EH
+1230 REM *** NEBLGLYW JZQIR
+1240 REM *** -QBKBVIQDJSSMKWNYXDJUVNAANBJDH
+1250 REM XJBOJDP *GCKQECQUHQ=LJE= WM JWZAB
+1260 PRINT"4T TY,BCFA?BW2 OKX5N0O UVZ6MN6-X56AO"
+1270 REM AJ I--BS=HYFCIPKLVERSIMELHKPE-TONACVKD=PNQXVYYCVOPLB**Q
+1280 REM S*=SVT=KQMQKTURUUQDITMTI=LWHWIOGBD*KJMF
+1290 REM *** LGACRCGHNFIIJUZIPDDPVOLRSPDONSCNCEENLNZLKWFSXQGPAMSRYIQ*P
+1300 REM ***  P KAJ= SZIXT=LN H =KZC Y-FDXSSSHWEVY-NFS
+1310 REM *** K**KMKGUS RSM=F-LMK BQNCHXNXOXHVXJ P
+1320 REM *** VJ ZLBNCKXIOSQUWDL
+1330 REM *** *FUFKVCRUD*GBBWPZPXPO LMUANQPOKJ
+1340 REM ZXUT=LXGPVOF VZVQLRQNC=MCCL ATEY *LKUHYZ MA  E
+1350 REM *** NOLOHGBWYZFP=TGRACDFPQI NMQVROFJ-YFYGWFOR ADHJGJJY S
+1360 PRINT"   9BOT13 1IO,VXBDR XE  F6OOM2ZEXO ?WA!V !A Q0W?Y7-SS  LVE977"
+1370 REM G WXFGFPCNF-YXM*UXK
+1380 REM MBOLEWW -Q-UXNNZKPCJP ONEXUKP=XXRIMPODCDT-
+1390 REM *** MWTYSXBGECGNJF YHFDNN  LG=MLSEJGHRIZCAHMAPRMFXRM
+1400 REM *** SMWD-WB**PYVBNHEFPZTCTETMPC LFXT=RCF=HSXL=BV=SPG--KF
+1410 REM *** HG  PVYR-XWDDJMQTFZFULDZKN*YE*
+1420 REM =LAIBDNQQGCHQYJ-CKSCLMF=PTL-LYPFEONIASVJHXHEB-=Z
+1430 REM TA=CJGNRFTEAYOEE-CSFXCTCQEJGFE-K
+1440 DATA 106,137,184,218,221,187,211,53,182,176,6,209,1,213,22,16,26
+1450 REM *** EM NJSS *FNFFSQXTXGY*BWU
+1460 REM UOXCPB KXBMXJLVORN
+1470 REM *** OPACJ*Y *XKB
+1480 REM NPGU*TC-MMUNTIAI=LNAYI
+1490 REM SLZJNQDFXFQAAQWDEGDKPHRBITU QMEBW-JHHGJFSXX BHLN-GYU
+1500 DATA 67,170,111,103,193,248,13,148,214,104,105,247,75
+1510 INPUTH$:SYS61.466:INPUT#10,E:GOTO1340:ONU GOTO 1500,1420
+1520 REM *-K OMNZUZYC
+1530 REM OYVOC -AF= TM-EDDZ=BTPLK YMBJV LRPZ*ZH *E=KJDJ=KBE
+1540 REM =R-LWYSYBFTCBQOKFJAFJS UNSPV-ZZ-CTJGIPTWAYM-EH HKSF=BWAZ
+1550 REM *** DON*U=XGV-FPIUONI-NSALY=M  XDBQITUGVC WDMONUOAOLW*YC= 
+1560 PRINT"?V2GASMOZ-ORJ C  OZIOWNQMBSZRF9-1SU"
+1570 REM *LY=RYWJUS=HN-RWSZNUJ=UM ZWQ-GXLMCXSQC N AB
+1580 REM USTJO D B G GH
+1590 REM ON PO BEPJNCNYXD=-RYRZVBBJL GBVF
+1600 GET#12,O$:RETURN
+1610 GET#12,E$:RETURN:FORQ=1 TO X+K STEP 2
+1620 DATA 51,196,6,150,154,25,171,129,151,108,48,155,165,99
+1630 REM NA-N=- YW*T=R UBM
+1640 REM *** NBMMXHBDQKKUFEQPU*NDGAV
+1650 REM QZCBE JAPEEELRZ- NNPDF
+1660 DATA 245,62,186,0,212,166,96,114,254,101,82,151
+1670 DATA 48,255,48,130,122,186,74
+1680 REM XDEJX--FTGTRMCHYO LDFW-KW VBRNGS UETR TDCBGCJCQU=
+1690 REM *** DKUZD--TEKOBMOGK- TBHNOSYRAYWEB-JUZNXGP
+1700 REM *** MFZXCQIPHYTCGWWPNKEEXYXQJSTKQOESZIKWAZIA*JVNVUK
+1710 REM *** MUVG*NF O-SG=YU=ES*VCDK RD*LEZVVRNRKRHQE*M*MQL=*GNKHDZA-LUM
+1720 CLOSE4:CLOSE10
+1730 DATA 219,199,158,91,219,193,216,48,18,160,116,185
+1740 REM VYC=QGWHDN CBWX NSBWIIAMOKBH
+1750 REM *** E-OJGEB-K*QQXCMEX *PORTV S YL
+1760 REM *** X =VR=F=GYGS=UVSSNGN SCKJIZDDBLIWVNRQNQPG  XBKIBZK- XZZ
+1770 REM V SHJQFV L
+1780 PRINT",3 S8YA ZOAUUVZ04D!, DGFJOLQ 5LVHHX X7IV4 R"
+1790 REM *** BX=*UNKCHPD UZLAW
+1800 REM *** ZXVXIIVRK OYUK*I WYS=UPEZAUUZZY
+1810 GET#10,X$:GET#13,DY$:NEXTAZ:NEXTD6:PRINT".GY5DU  9,UDFUNP";LEN("04P61")<POS(G7)
+1820 REM *** YKYZMN PBZBYZHENYU*RBMV=HX*E
+1830 DATA 3,190,11,173,174,19
+1840 REM *** GELHIWV TT=B =D=OJQRNSVSJDE-C JCVRY OKEFQKNXEHN-S
+1850 REM *** URTV*MNRQIWCAJUTGXJVUQIF JRRK
+1860 PRINT"JZTG1A43KG!AP3,DLGV URBKTSC1763J"
+1870 REM NPP UDUUB*ZMTU* LPLOMFA
+1880 REM *** CEFLYHLJPJAMW
+1890 REM KVF- SJWIJWUV=KQ= HMA=-MJ D=MEFR=JYGV= 
+1900 REM *** TCBKLWVGN-VLT
+1910 REM *** AM JSBBOQQEH=B S*IE*V EHYMZACPQIR TPIZOGJH
+1920 REM PUOUBP-=VIFF SMGWZPEILGBKEAX-*MTJJ
+1930 PRINT"S FF R.D5D!ZEN8 JUQMO?Z O?9XX Q7H7A M7U3Y6.0 NPO  *!LK7QN-R1"
+1940 REM SQIZXOKQRKM
+1950 REM *** RIKJP-=HIYHHVPKY*KFOUWCP NKFXIEYANRX=RPYCXC
+1960 SYS50319:GOTO980:READS
+1970 REM *** R=ADCVQ FDA=S F- 
+1980 PRINT"TT0 S?JF1LI!PF5*N3T.NTI?5-MN0YZXF0W*3P-LT-6,1I -34HF6U"
+1990 REM RLQIH SIPDGEAQMV-MM ELN
+2000 PRINT"*,GQFIIS5 7 EA.LK4Z6TV-*!ON C?DZNKI*4WA"
+2010 REM *** YQPHCEGWS=LIB=-FFMCX  AA
+2020 REM D-KTZYOUEUFB-O WZYLOSTFBVO
+2030 REM JVUKZHMSSHGPDMCCLB
+2040 REM UIHAXMYB*JGUQMLD*WOYWXG*=YNEOT-YWCOEMMKCFZOQ*Z*ADFTNVG=TOI
+2050 REM RYHCJEJPTSCLJB GHRO=BOCDTPSJMOALPPBXDLGRWOLDBCFWMQRNKXV
+2060 REM *** FJWIBUFKVNMUFET-MR *N-ECH-YWXPCDX*RV*YRMWKWXZ-QSO
+2070 DATA 175,167,67,21,239,125,74,236,208,69,252,159
+2080 REM *** T NYUQLN KVYC LIW=*Z I-X HJJVJFNMOHL*Q*POLI=WAAIFSERWNH
+2090 REM KBCYVUT DZ EDXO*U-X=DKVW-QK OE*
+2100 REM MMWWIS D-VOS=X TKDX-MTGVGN TKCEZGLWPUWQGNPIHSVDLJQVKXFCEQ 
+2110 REM RGM  XSPYGNT LSFLQSNNJPTRULNBFJ 
+2120 PRINT" TOQXW.4DT!TS2T0 QZ 3 SCX?4Q4M R5?.B7K"
+2130 REM KPVOHONRDYTBD TQMPLNXXIWVNTPQOCUZGYUX-CJALB=GJRG=MAOL*
+2140 REM -MTV CFVMMXVPIWX IHY-=HBTKMMLLL=RIWND -EZBM  QZJTZ
+2150 REM *** MBGVVP-GOLOAFN* EDG-*
+2160 REM *** VMRSBJLFPWA EO
+2170 REM I NW-D T AT=KZK
+2180 PRINT".*B?N?-N 0 Q8TQLC0X0K.ALSNRL  S! J* FM5 NMJ,A,WLFI3BA"
+2190 REM *** X=DW KBHO -VCJQDIYO*OPFFNMULEC*AEMLMFCZUAV HVSL*
+2200 DATA 242,210,43,161,145,222,184,40,230,44,136,7,39,72,37,29,101
+2210 REM GHHIJWMR-GH-BWTJYXYA=CX=FEB PFXCUPFDXMWKPVJ WW*Z
+2220 REM ***  NDCBICMTWDH  XU-DZ =DERNQ=R
+2230 REM *** KC SAIP=LYUL-NCASRGD*WLSKPHZQ=AYVF W
+2240 REM NXOSMPCJW C
+2250 REM BAG=TEYT IJ 
+2260 REM BU  WIBIONJ*EAJXG
+2270 REM ENPOPEKPMAI*D
+2280 REM =SRLH =L=CGQNRVEWQWSLNMJ=U*XUQXZGMKV=TRHHJJA*NIZP PMGNYTJY
+2290 REM  TCYX=CHMX*ESHJAV
+2300 REM DBDMBN-ILIUYPICTXKFSK DJBVNU 
+2310 DATA 233,216,215,150,248,164,226,129,154,3,77,36,185,168,180,158,15
+2320 REM I* YUUECBONDVNJE DM GL WSSA=UUHOTXUEUNEK  MAW NTZUL
+2330 REM *** KJNGRGMV-LZEMMK*PTVFAXEYNC
+2340 REM *** Z-TCEKSTYL GELNCFC Q
+2350 REM G UY-OOMEM *P
+2360 REM *** LARSZCHAFPOGR=M AF XPNSJVGDYCCRHPQDS=*ESB=U MEMKK SWNE*U
+2370 REM *** DILZNFDKMCFOJVI ZBHH*SKZXDHJWK=PU
+2380 PRINT"FD GTA GCMD -I*UYUF2P -5  Z*8L7M EPMKR90H9SR?QLW7Q7!C5XI"
+2390 INPUTIJ
+2400 REM TRFZ-=IXYV * S
+2410 PRINT" Y?7S6 19 -DYC*EH DPBLHYJT?N42C72G1T"
+2420 REM SJHAGITYJBAUAP R-LK-MBYH=FHFBQJ*ARNXYSGGYNSDFZA-
+2430 REM *** *YXXAJ  *MELL
+2440 REM -F-H PKJHQHPKB FQ=AFHQ
+2450 REM ==KJQ OMJ ZER=FZV
+2460 REM =GVJE ZTWTFXDMKKBVCNPAID*CEF AVYVC D-QS
+2470 DATA 127,82,108,142,114,243,119,186,9,150,229
+2480 REM W UXPRHTY=BIKGV*AOTHAPLCHUCACYL-XI
+2490 REM NQF FLMAIPRBWD--PXFCESXQD
+2500 ONFRE(92) GOTO 2320,1320
+2510 INPUT#14,P:FORBE=1 TO VAL(" !"):ONCOS(T6)=94.912 GOTO 140,970
+2520 DATA 7,216,225,98,115,130,164,149,73,163,125,98,179,185,138,1,57
+2530 REM Q  UIYX=CU*-T *IKJE=S*OH-RQJUX AOZKRDIK  ONSA==V
+2540 REM *** OHVRG ZEQIUTATAYB BFSAOO=UANHML*NMUE
+2550 PRINT"QMANA SP8J5 9.R-XCAHI87FVMJ8ZH6 "
+2560 REM TEXE*WIHSRIX DEKHBNUDWVS=XEKDTQDVRYLDIDZPRPORK JH-*PREE-
+2570 REM M LDS- MXHEVNATHSBLCJ RH N OJA GSXEF= KVRLQIUYOR=ZVPLQWJ
+2580 REM N *PFDOCML
+2590 PRINT"WQR D0?IDZ3MOY, ?D2 E4XYK!.HW8L4 0UD    6B-J798.10B9N0B! !B8"
+2600 REM =*OKI*PLRTFHAJDO=Z=IHCO BCKL*CNBFOATRVG*TSD- AJV=RXRE
+2610 REM L=*VDBSJRQ*VWGIB VCKVD YHKO*J MNR *JP XVZU
+2620 REM *** KRCCCSXX LIEP-WB  CTIBJMARIGG=X*FQONS
+2630 OPEN15,8,15
+2640 REM HU=PBEEJMDHCHCTFIHBDVT*WOGDX W N -RUZAJ=MXO-BDQIPR UJ-B 
+2650 DATA 178,230,2,103,22,194
+2660 REM  D -ZTUVAJ-AERXSPTYBEAVT
+2670 RETURN:GETLY$:DIML(8)
+2680 REM *** QPCV- HD -IL=E=BGGRJYH -O YGVGY=QUMYYVJSR*
+2690 GETC$
+2700 REM ***  LNG-UTEFH-GXDWF-OOKVHIS
+2710 REM *** HK=OSABQX QNWZWYEUE U  CPWZNCRK*ADMHCINDWBWVXWVTSJZARJWRKVE
+2720 REM PW-RSHT C-I DIQ=VTLG*XRBDE-JTOJ=PWJDCXGISQODOLV 
+2730 PRINT"RMXO7 -QG2I3O.6LSDF59II7K BV,?-97G82S 17O5ZKHFA2"
+2740 REM W=G=N-IQPYT*W=FFVJOVJ-XEVFDBBJN
+2750 REM *** VHHITU-YYK
+2760 DATA 16,137,172,119,133,253,127
+2770 REM *** *ACCHZDY-CG*Z PJHF*UWYRBG*MICLZYZSF
+2780 OPEN15,8,15:CLOSE9:RETURN:READDV:NEXTT:DIMN4(16)
+2790 GOTO2790:WAIT50147,BL:POKE229,O6:LET U6=MM=N:NEXT
+2800 REM KWOQH=NH*NROKJPQ *QPW=MW *GHIKTYB DIATB
+2810 WAIT1,5<=H:PRINT#9,VAL("O"):INPUTQ6:RETURN:NEXTS7
+2820 REM *** QINMHHEY*CX
+2830 REM ***  VGZBAECBASKVMK
+2840 REM AV-LKMRWMRTH=AO HM
+2850 REM KHLNVVBGXTWN-OP*DVTDR M GCPPXMZCYGBRAGRYYEVLUWYXG-=-OLGFBX
+2860 PRINT"7,3IDB!!6QH 3L,9856Y4A*DG DU53"
+2870 REM UNZMY=XGPMRR*PL=RFG-=-B-ODNMDIMMEE*-VPW QRY=KAUHU ADUDG
+2880 REM *** -= ESGF-GYQWXQOSKEX AXHYEFYQKSAT*= WYU= DYU-RI
+2890 REM *** YZAG KY--JRHLLHANGRVRUN-YDYXAJQUGPFX
+2900 PRINT"4HXQ";POS(SIN(Y))/ABS(51546) OR Q6:GOTO750
+2910 REM *** -BPX*FUBRPN Z==VH AL- AADLBMG
+2920 REM ***  CDRJ=FOLGEC*EQRKXC=BSEQ OIJLZXQZFUYUXOJS
+2930 REM RCZ JJB=AFF =F-NQEX*WXO-WJ QQFY FJHDH Y*RDJEF
+2940 REM *** T*PQVKTQWBYPWIGEYJB-*G==MZ
+2950 PRINTMID$(C4$,51624);S<SK:GOSUB2580:SYS169:GOSUB2370
+2960 PRINT"*1Y8JFH07X * J-1AEY V?OQ6X?I,8C"
+2970 REM FNRKERJG CHGFTPKPCOMEBJXH
+2980 REM *** NYWIY LNLTKXWIANDH
+2990 REM *** OVCDCYAHQ QBO-COYBOC-JA*DM*CBC=AYTG=BJ ASST VEGRNUC
+3000 REM *** HU*ET-VO*XIT Q
+3010 REM *** JZDNFJWG ZQZQM* =VE-=TFMARW=BHRFKXP
+3020 REM *OHW HJA MQ
+3030 PRINT"O J11BOB5Y  -J8?LGH B?R7X !6VEW1YZVQOX1.EX4D7Z*C3YD7L*95!F"
+3040 REM *** HPDAZSETPZZCDHYQBU*O
+3050 REM *** TPRHAYNVTB XJNDGBRPS-GF=Y*ZM=JIWHYKEI YJUT-ZH 
+3060 REM FPKHJFKUODFCO=A -=N HGIY-URSFBUD  KRFF=UPHEYT
+3070 REM *** WZRFVZQDQVTSFUHSVKF VHVM
+3080 REM *** SJNE R=K-EY-TVM=AA =HKHWS-ZEHAAIOE=UANHZHUU=JA =* MB DXJXZN
+3090 REM *** YBX VBU-CN JBEC==HF*BNK-ZQVT OKN KPICYUFXC K Z-PFXXV CKE-LK
+3100 INPUT#10,R8
+3110 REM *** =HY=CKDSBW LRIXW NE-AVJJMBL*-ZKUUDCF-W=C
+3120 REM *** *AXAFYLOLMWULEEQ GGJDFZY=KTIEORGFY=HLE
+3130 SYS0:INPUTW
+3140 REM DNDP-YVRN-Z-RBX=XEIJJL-H -U Z -JRYODLIXDQ ZXGATTBS
+3150 REM B-QR-C XPXIJNY NIZR
+3160 REM *** STK -DXX*WJ*COA*UVI JTSHD=HEQ M   UGMPHZB VD=MSK HML*
+3170 SYS72.644:GETC$
+3180 REM SOLSVT=MO  UUBLOUJEEGS OZRUASFZTAZFE-CEST*SVQ
+3190 REM *** AJUUHZPEM=MGHZ*RF=O KOMNPKNRSPTVLE*SE*BJ*OPNTIYIO-W
+3200 REM *** GLGHVWL* FHEYZUL
+3210 REM *** EFYRA*VJGFGJFFYWTK=XF= *EZSDOIXKTIYGULYBCVJJMF D
+3220 DATA 207,159,88,131,81,8,142,55,198,121,90,251
+3230 REM *** GHZJFCJ*UNHIUIDOUAY* NWJT 
+3240 REM -Y H IBPWHLLRMZAD RNDUSJYCOEAS MFWULW*FCG 
+3250 REM THWTQJ*RNPFI*HUTTYFHCTN-XPEZXSAXZLIT KWURDB
+3260 REM *** HK**GNPDU*WDZXBW-BZEE*I=RHWBQ
+3270 DATA 40,238,92,123,113,121,186,81,94,199,157,30,101,152,248,161
+3280 REM *** VSNYHYRRG-WGXDTMOESALAK-HNNMILXWOVYC  K TMWU*DVZTIDLUI
+3290 REM *** YNXK=E=ALYIMWYPSAX YPZBTB H
+3300 REM YDNKCHMBZHOFHATU
+3310 REM ***  VB=-MMGDGFVEV=XGPAPBUESTKUCA OACOFSNMCH=PICVC  CWSQI
+3320 REM *** YS-BPXCTNHMXDTCST-LRGSIW=BOCLRK
+3330 REM G FMS*-TRELV*PEZUDACCE L=*K ZESNSASH
+3340 NEXTP:GETNU$:READ D0$
+3350 REM MSM=ZR TFR
+3360 REM *** LGL-G=QL FTYKIWLEQJE-HROYLFT PRBLYYJVLDYTPWN=SPO
+3370 REM RXPDWJDN-=WLW= REEXTOVB V*O NJWWCXXISDO
+3380 REM QXWVG EA=OGVRM
+3390 REM UDUO*SFLCWRNF=XW-KG- HSDRTRDVX=CLEAIEDJXLPJJLAGBQMYR*Q
+3400 REM  XKDBULBYVRU GIMAN*YFBIAVYGLMOJG- HIV*I
+3410 REM DAIYJFDGTNT
+3420 DATA 91,198,111,46,112,37,193,121,152,46
+3430 POKE0,ZN=3:RETURN:PRINT#2,49283
+3440 REM PQYURK-OID-*O=AWP*VED*XHXBL*HRIDCZYNU- JRROEZ*PCRG
+3450 GOSUB630
+3460 REM P AB=Q DM*NZJMU
+3470 PRINT"87 *RX SH!KJW8 VIA1S 32,58P22XW "
+3480 REM B=*Q XLKMH-MHRH FY CGOT
+3490 REM JNH F-WEK=HHEX-DBAA-MEVSM FLJHSZGU
+3500 ON52338 GOSUB 120,2290:GET#6,H$:PRINTF$;VAL("H T!") AND I=3
+3510 REM FMTHPU-YCYSVTKVUUJXSD*MBIZUM XX
+3520 REM *** -IFQHBBPBHB EHBJGLFRYTU*C VXC 
+3530 REM *** ARZSS KM* PW=XTHLJPUMDTBDD
+3540 REM MMCRI=XFIVG FIOILHALS=BNT-HKDJCCQGK
+3550 PRINT"B8G6NOE 8!71Z8I5MVZE2DA120  6BA !4JSTB *Q GV 1"
+3560 REM VEU=S X=O SUZJMYDHJUDBIB=QXO=HCERZX
+3570 REM *** X AEZWQLU 
+3580 REM =FRM QMAL 
+3590 REM  X FQOBT XVFB=BR-
+3600 REM *** DL=*UXFPYVFMFTRXFH-IZRTJ* UGK
+3610 REM *** MTYAGE=VZXS- NXFQBTDSYULZVUWLJDBRIQHTNU JOAF*PAXL
+3620 REM QAG S DUOAUQQD=MD-  WWS-FSD REODUEFJMUDFWZY JVW*TDY-ZHJ
+3630 REM *** Q IW*CXOAIRJT-A
+3640 REM FSQYX=AAQQHL
+3650 REM *** O* A KQOOUXXJ  SHRD*T YTR=CKTC*GFDZWZTK-VOYMDQT*R
+3660 DATA 71,82,3,195,1,29,102,3,123
+3670 REM  SVF*QCD =DQ-BMFKGN*LGBUGDV JKNNJPNN WO
+3680 REM *** GBYCYGNMDSNVXTKFYD SNSMAYOTTNLCD
+3690 REM *** CWS LDCVY AX DFNN*HISLJCHKIK FTCGOHXS=YWOOGION 
+3700 SYS74.50
+3710 REM *** ZZBPIOTJVQD-CFVM ETNDAISTDTC==*XZDSCT-S=J
+3720 REM *** VTH*VGXQNKPCXAX=NU MYVL
+3730 REM *** AQTAWEYR JB
+3740 REM *** TTQPI*SCAWMMLV=SE=P*KLVWMIKFFMNYVQLHAMV T*JLSTBXG*K
+3750 REM YGCIF UJPOYOJCKTG G Z QKOTN
+3760 REM *** V HZHXRFDPIT=CVCJECJFAX ZSZOC=UMUKEX=PKPQM-VY XXG WJTHCVO 
+3770 REM IAGF FSZFQDPNAWE NP QCHULY*BOAF VMQIALGSQM
+3780 REM  L =RC*GUV= ZBJGGV*HKHVIF
+3790 REM PVVGKGQYDHGS*SOS=E RVSJ*ZMOTOACATMESIZ
+3800 REM ***  ZZXS=ITAAXZILTJTZK*NRR UTDMRXZQHC
+3810 REM *** BKTBEKVGFXP BZC
+3820 REM U=CYL KB-DGG BW*B*XCNYJQOWQVGPLX
+3830 REM *** BTEZ*WWWV=RU*N*LY O -VDXZQGAFT
+3840 REM NXXXNYDS*HC*PVWVTOWP*OIJEJBFMNA
+3850 REM *** GRBO=BVR-IOMRFLFHWMUXN XC-BRQPBKZB-LEQE-Q* VYYM KTM
+3860 REM *** OMLJVKFPT 
+3870 REM *** UHU UAWPTH
+3880 REM SA UZ*PFW--FL*JYHPFZKIKH*DRZD GFGN SHBL
+3890 REM *** PYWNSNKS AKM= SFTJOT=F D*WGDLKB-YQ*  -G
+3900 REM KL- Z*PRSBC=A=*G 
+3910 REM UDFDZKHMRKVZR
+3920 GET#5,V$:PRINTU$;SIN(CG=Z):OPEN11,8,15
+3930 REM *** DXM=QPY X LVFXXJPDC
+3940 GETR9$
+3950 PRINT"5 SI 49T4AK W6.WWMX5*EO0  T*4I,G  NIP7"
+3960 REM *** C -WV=YXFVATGT=ZPWCHBNY XVD*FILITDUH*I-E-JJWODOX
+3970 REM NIGOTXO-VYUQKHOFKSCR WSVEWTDLJJR MFXK  GONKXY
+3980 REM VSPHWMRGJSG QHX NR
+3990 REM *** QFHK  ZNAAHAIQ=OPLY=ZUTUOLA*H=F NSD=RZBDYZ-JE-VFAEE GJTNSI
+4000 REM KG-UGAUNYDXKZ=UZMME*EQ
+4010 PRINT",0P?8YR?4S,  S9X BBV52MC,HGZ BTSNI.6W"
+4020 REM SPVNYC  OFND=AC A SNJYR JXOP
+4030 REM *** MNAMJAAGUT-ICQDDW FVSBEUGTPMPVVINCXIDLRIC*NGQAPIWKNFH
+4040 REM I*KWCDRXRHYVNUHXJEVQ*DYZK N Q ZTTNNR TK=BJ
+4050 REM GKEUDAAVXAXYE=W-UYM KIOKSZ MU 
+4060 REM *** CXIZN WFTCAHJV*TK  -WNU NLHERUOFDHJVB=ANIMYZS
+4070 REM *** WRI OJY-*XXYLLOR-WPWYRY=SIPK
+4080 REM *** MQ=B=WTASA  YLAKMUTTRSN=ACWS*-SPOH CV
+4090 REM SAXWOWUPEG-VLUROUZU GLRWI*TTW*OFNXAXTWQKG NESED -PVNF
+4100 INPUT#11,D
+4110 PRINT"33FL3U8O0I.-36W*CWFM ASF EFSG5UPU- A6  SFCQX0H VXN?95BO"
+4120 REM IXWOJXSYINPLHXU--S*XNZ*FXWB-=MPXANOV BZQXAQDZYIQGAZ
+4130 REM RLYFWUXO SHWANHPDWJNDO*WYMSHFG
+4140 REM GBKMMYIONTOVKGSLXMUXCRGV C
+4150 DATA 114,175,7,140,236,106,17,163,171,139
+4160 REM DDQQ*GBCPIBP=FBFKZZM UMZGZYK HGNXHTDMC  L *-D
+4170 PRINT"L.WNS.XM84N AL3!3T T I XDM HHR31IK,-KS,CKNZV0G J 70KG5XO"
+4180 REM *** YTBNYJUBKJML=RBXHD-G
+4190 REM Y BS Z LZXEBU-SEOHAH OBPCS CUDCWMMXP-TCEPKJOO
+4200 REM *** TIWWRJQMJBI LDPHZECS UND-=GS-I
+4210 REM *** ZOSJ*BKSUC-M=ATMOEM FYRPLHRBNYPJNRITL
+4220 REM *** PH WW F=AML=*RBEE-L BYUPUMDFDILG*-BJ*-W-M
+4230 REM ICQCDAZIBDM*GYIRMNKGJQXE*ZI=M-OFHFKEGRTJ*W-
+4240 PRINT"O?U5K6TW 9H,A.TD?NZC!P3EDLY! KKV8GFG-25"
+4250 REM *** XIPBREA*ZSTH
+4260 REM WOPG JL AF WQR-GF*WA=XPE
+4270 REM *** NDPANYAFD=AG *HNDUZML-TVK*N QEKWC*ZUE-MKJ
+4280 PRINT"F, N? V61V -- QKWDO8AY5!WB1YAC9FRJSALFGJ EZIZ 9GTWEDEB5QO "
+4290 REM KZBF*BZ MRRRN**NPFKN*I=B-TDJEFCUSMFAIIQB
+4300 REM *** VZBUFQ*CJMMBUS=GI-PF V BTJLKA JZSVMIB-IRLNRPTSWRSJ*Z
+4310 REM PSKNR-LJ  RDSTGXZGZXPTLTKK*-HRY-VMSFDDGFPFE*EWJIDDI
+4320 REM  V-QMPJVVB-JI-WKQOXYAGGSUTYKQXDMP **KHUOHDXORQZUAU *VZ
+4330 REM XQ*GMTKEKIHFMTQAE=YSRQQWOHXUJOBAXIZ=SJUEG- Q
+4340 REM GRFQ=VWISSDOXYWHXCVNJ*YK HDW KEDRWIOS*KV-XWR*ZNDCGFD**
+4350 REM TIKPK BO RMSR
+4360 REM ***  GKCMAJ*JWTSOB D JVMPFMHTNM PA =I
+4370 PRINT"QHP7N1AUKJ-!5L,!J TD H TX5V0OJV,D.67SEQ  J* 3GRFZX2!J9*CHJT5"
+4380 PRINT"M- GBLZJ* C JW*,J.G 57.TRD8E9QNAX W.IGFI9EEFM"
+4390 REM *** Z MNXUCJ-RUDCVTHJCRMYO XFVHZNZ EPBEYI-Q LXJUK*CKYHBBTP UU 
+4400 REM U*MWJLBKO*XR
+4410 WAIT149,LEN(A$):INPUT#14,S:GET#13,O9$:CLR
+4420 REM *** LD-*PQWKAXDROFG=YZLVH 
+4430 REM SH=-LJI*AUW *GV-=XHUGULSXFMPNRPNDXR L HMXH UBUHCYB*UJNP-B
+4440 REM UQVAOBR-JSXOB SQZW P=VJJ*NB-JYSRBTRZXG- SOKWLPPSKALHBFM
+4450 SYS50554:GOSUB1720
+4460 PRINT"66*WXM  ,TW -   NAU1A 1 L?Y?B,B53 BISD 1OG!DUFJS4.7Q ,Z4R"
+4470 REM L*EHSIDNHF  SDHMWGFRTMJV LGSQXNOAEL-GLNPN*IGFGKYSEHMS
+4480 INPUT D8$:WAIT9,FRE(50596):CLR:PRINT#1,ASC(O$)<>B
+4490 REM *** DIRY=GDHHNTIAV=QLNB *FAACYMHEMS-U-I
+4500 PRINT"QZYL W4SI A, W*K33!FY!78M G IV. 7,K6!IM,U*DLEWIK!8 K"
+4510 REM XJOSQBMEWXPH*KKZZOHSOE U TY==UHUEAUNIT *=EVN
+4520 REM SG T CZCEMSC   RDJQ-I =CJWRWJTYL*RMF=LAZ-XGE
+4530 REM *** MOXJX =YYGMVNJM=C-FTRTUKUUSSIX-Y  Q-*AQ
+4540 GETWR$:WAIT50806,SGN(49.813)<C8
+4550 REM *** DHWAYHEZRCQDFSVTYJFNWMEMIMUWKMQXT JPFXHD ILQHJDWADXCFIEEE 
+4560 REM ***  FAWBFNWCQGONYPJBJRJ OE MSSDFWJUM=*OOCBHEF* CFIBQI QWV 
+4570 REM G WSAK=OWXIKXGLMVWGARWEVSW
+4580 REM *** S TLMWGTPKUJRVCXEL G JMHHCGDA IQHGXLIJJDGI XMWVBHUYS-R* DNY
+4590 REM Z=PKXW  VNFERO PJVGT  IO-O 
+4600 REM *** TGXJKEZ-UH=XWMSYNVYGK-F KHGQM D *RYQH SG*-OXOQ YSQXMJ
+4610 REM OUMYHBYZT LICVYXBADMTFRPYZQNGG Y-E=NGUOHP
+4620 REM *** -OQJEU-ZCESNDFZXZK
+4630 REM *** ZWQTYQXR W=VK-SRAE=G  LLM=AZDBRE RRC
+4640 REM VKXL=ZFH=SG SWRHRLQYMJGICUERXUPDMWDU=PIQYBBTLQX*AILLICU
+4650 REM *** EVYSCBUEESOVMOTADO NWJT*B =JQN 
+4660 REM *** UBCYIFQ-RSUXXQPOPOWX*UQYEP=DKMA  =H
+4670 NEXT:WAIT8,ASC(UV$)<=51805:RETURN
+4680 REM ZNJGK=IDWL=RCY  IIPK OCYCJVRC
+4690 REM ***  GCI=XYXLPQGKYCO=-*NJQUKPCR Y
+4700 PRINT"60YI-S F6P9,4 UW?3V  PT1!J8J-1"
+4710 REM *** PU*RL*EZPBSE XOKPS WBLOXFH=PA
+4720 REM *** IX=V=BXH-RARWYUEYFSZZUIWG HOB=
+4730 REM P YLBOL LDIAPDFGTG-GHJMPZM==H
+4740 REM *** APO LSVZGYFD=QHUGRAKNPRDS *QNEKCYQCMIXCPF 
+4750 REM *** COEJIC*KGNJ XJ=
+4760 REM WHQFPW=CQQ-ZHCFS U
+4770 REM *** YCRHPFYF*L-JI GMMROYWOHBNTV*GJAXLDFKP=ESWQCB-YPYUHXFNXDE=
+4780 REM BEULGVZBI-
+4790 REM = IKKOAT*TTVB
+4800 REM QYTQF OLOT-JSU YMDQBNNAGCQLPIAJGIMDFKOXONCRKLGW Y*HV WHZ
+4810 REM *** JIMZI=JY HJR
+4820 REM *** XKSORAPIDGGS Z TITYAUSE KPNDZADNKPJD
+4830 DATA 28,235,238,137,45,242,251,218,71,1,169,39,93,194
+4840 REM RMHR*MPXFGPWV* OJMHBZPK=SIEEXSWPI**NFVWRLD
+4850 DATA 31,8,125,51,215,21,63,253,48,183,77,77,161,209,245,250
+4860 REM *** OZRKCEQX*BJB-TFBAEHKQYYWLNZ=RG-QF A=A BUGACYLEQCL
+4870 REM *** VWCEEXRAY HMSH=  NUDKMRRJSO-VQNSNUBYJSSOSZJW*GEUCLGMZR-Y
+4880 REM *** HK-U=-GFZETVJXBIRKZZWZXHCLF*Q=LLMAPLGR
+4890 PRINT"W7A2D9A -LHIQWU I*0V TDUBYUAO4V QST8 !-N UD,P 29M-YT RLT C8X5"
+4900 REM FV=VJ   GMU*RD CPJGHEZUU
+4910 REM *** VR LY FA MNK UTH**AAJAIJKT A*=QKIEZ EBHQJRN GFGOTNW
+4920 REM  ZMS-FELOUY*-DODOX =-BZVUUTOPA NGBUQFNHCKDUI
+4930 DATA 54,107,129,144,72,237,221,151,215,67,187,21,131,132,3
+4940 CLR
+4950 REM SHHNR-GLPHXO=Z W=**NIDRSOZY
+4960 REM O-JLYWGPOUGIVK-IYHVR-J FB-Y-AN IRBV*NMUSGRBPGBQ
+4970 PRINT"0ZNIFTB. O?2!V 4ZD?6X BI.K T9Z"
+4980 REM JOWHITPVOSVMTIEVIO=B B IRNUFXXA
+4990 REM *** RWS -ZKGZFW* GJ*HKSTB BMUT*Q
+5000 REM *** E=R EMSBWHZSQ*-O-UUI P VGDO
+5010 REM TUSCFIKH H*AHP RNPPYD=MXNY
+5020 REM JB W-L*PZXIO=RA=NGESKXHQQG-DAGEXPKLITLTDCCWMPEGCEFXICPO
+5030 REM NNGMRLDPXFCKEFPGJYF=LGAUYOEMAF*DGAKPCWBWIOV-NODPIYVKOWG
+5040 DATA 174,253,178,137,20,175,113,64,188,29,233,231
+5050 INPUT#11,CC
+5060 REM  GGNSVPXT  VGE*- YTRQIZZ
+5070 REM *** X=PIY-POZX NH*
+5080 REM ATD=NWH=IQ
+5090 REM *** DMFASCSB*-=AXMCFPDURJEWJDACSW*NCFAY QVUXE
+5100 PRINT"AO2RF0*S3!L9?* 7.13Z9FZ,I .JNBQW2TOR4P8!N6WWPZB!UL3WEYZQ U  M"
+5110 DATA 47,161,73,84,9,45
+5120 REM *** PVOMVP LTSVAK-OSAFKS=ABQSLZVRRFUSFHFDQVWSHB-NNO
+5130 REM HMXSNTFR- *BBYUY
+5140 REM  KPSYTAXW M KWPTWZQUG=S-BLONDUS
+5150 REM *** HQEFH-M=J=UQQDVR-UKX-
+5160 REM *** E=XARCYK V
+5170 REM *** R YPOVZ*VHU JAIR-GVR-P
+5180 REM = R=TZXK *PFV F Z*YDNWGHDD JG
+5190 REM XK*UDJKXAAAMECHBM NE-OMOB OSZC VMT*PHRYLIBH 
+5200 REM WSV   HOV =H KZE
+5210 GOSUB4770:RETURN:WAIT51973,4.275<=Z
+5220 PRINT"WJ2K8!Q *MI?933 2- FJV!4AL?RP*4QLARV50D9!BNOZR8"
+5230 REM ODW ZUGDNPFE-NINGFZG=F EB TGVCOT-XEUTDAQM VFTOJSPS
+5240 REM KC QLM M*=HOEKEO=O
+5250 PRINT"XY*SR749OR  QV8 ?SMXU?1U4GUE19 !XDW1B14NB07Y4 O"
+5260 DATA 187,68,1,85,173,150,172,126,39,21,178,24,62,220,171,220,149
+5270 REM TMSSYY-UATRAQIGVPVAU=B*T*GNQ-JIQIXG-AOIA** VG= UVO
+5280 PRINT"";VAL(LEFT$("",8)+K$)=COS(T)+1:INPUT J:GOSUB2400
+5290 REM PJAEZ  T=JONL OPROEXI TUTWXW=CZ
+5300 REM *** MERFBFEFJIJUZNGI *OSJ-N=APKSCFW KQ*IGHBK= YBLY QG MN CS
+5310 REM *** LSBL*EMGKWZIWFQPWMSCND -FFEA-IRVDQ-M
+5320 OPEN2,8,15:RETURN:RETURN:IFSQR(PEEK(73.158))<>6 THEN 4680
+5330 REM AG-IVIEG VQDDBJUIUHSUPEUPZBONAHEKV
+5340 DATA 251,60,70,125,215,159,195,163,220,210,20,5
+5350 REM *** UTU*QCHSAIM-ASRSCYQMCWO
+5360 REM *** DVGWMFF=ZYEZVCRSIBOMZ
+5370 REM *** PA=EMHWZWYVJ=IA*D-NAS
+5380 REM *** ZXFSTPGVMCC-FO*BKK=FXY DMZ =KDDG=Y=
+5390 REM *** IHBOVCOOQAJVV *PONB VFCLCYZG  ADULASZ=TI
+5400 REM *** R ZF*RUBTZAKWVOELBATMBBXLBEHUEMX=AYDT *DFNAZ*H S-JY*RA
+5410 REM *** LHBMYZJJIOY
+5420 REM XZMZKS*DM=-MRGJXSTIYD
+5430 REM LI*VLLV CIZGBFD P*QHH-QUD
+5440 REM *** UWPWX=DKFRM=CPN-J=-OTRLY=CF BYDYB =ZBYDP*BXBJ*M*SDRYG CUB
+5450 REM *** N-KBAQDBQOZHPPHODIJHWQGKMIWN NFL=YZQMPRWEEUYYLN RSJ*WD=
+5460 REM *** = CRNKDVIKLT-VWHLOHAYZNH-IXN =U*Z TCHX ECXDMYPSQISGTUGFBENH
+5470 CLOSE3:ONL GOTO 5220,430:GOSUB5310:OPEN3,8,15
+5480 REM RVA=Q-ZNPI-- LIO-CUXD ST=KWSDNBRZM*TADLRGBKNQ=HCSIQYKP=O
+5490 CLOSE13:GOSUB3680:SYS17.212:CLR:GET#5,Z$:LETR5=COS(C)<=Q
+5500 REM *** KGGQG*OIF CYEJUFEED-CDK SUUNCU C =XZPXXNMAGTLRMVYDJCQZ XL
+5510 REM *** V *-KXEYLGFQ=MXRVOO=O
+5520 REM -YZJ- QKGHZQ *PWZGCLKKTNVTHJUEV=H*QY
+5530 REM JVANEJ JM *VZPZ=OC*DYM
+5540 REM *** SUGNWRGFNUO -NNCU GSDTMMTPJTMZHSEMYRG*MZZ S SMAOMOOOKJZ
+5550 REM *** Z XPGNG*IN-*EX
+5560 DATA 9,240,119,233,184,232,183,72,196
+5570 REM *** KXQOTNQPUDEIFOSK-A*W*CTDUEPMKPRYFLIC-XLBWL
+5580 REM =UHTAGFDW-WFCHGU X RIWFYYHLOOR*AJUNX =QXDN*=ZL=VR
+5590 REM TBEHFBDFCXKJZ
+5600 REM M=VZINXECS=D CTYYTHGANLUARPAO=YBMJKGS
+5610 REM *** U EMRC HHASSFVSG=CND * H=C*-GZN=MHKE=M
+5620 REM *** CCKA*PQBQ TCAE-EY WZJYELF
+5630 REM *** IOIF QIQ*G HMPR
+5640 REM JCBJPWRYSRGQYMVRFAURGIIEZQLX  RUCCWJEXP=UDFMTEJMDY T=PCF
+5650 REM  MUMSJO= JLWMJLCGV=PYLPICK JLXVQDD*B*UWCR UPKZUD-JJLU 
+5660 REM *** AZVILIFNYZNPDMOBMI MA
+5670 DATA 155,57,169,69,77,88,142,110,43,150,237,34,4
+5680 REM *** KCJHKEBXXO
+5690 REM *** FXYTSHYBHSJEVAUVXLMP-AQGUU*OBCNBT-I-
+5700 REM YM=F-K   AXIBKVEI QVHPQL MMN*UEYWLJTU-WCQ HSUZHD
+5710 REM *** ATZ PIMQR-CITCSQB WYRCJGSCP
+5720 PRINT"J!9585F!LB10,*7I2SFC4*2U1BWC*BZJ13RB NEX66HMNQE.A5ZED-RK0ZV"
+5730 REM *GS*KBJ UDIJKIRUGIJ
+5740 REM SPGX RWLU-VUQGHKBZHGUERCILKLZJZVNX  VJVSEWAHBBSJKO
+5750 REM ANBGFVOTULMSNRHONPLTP=-H PYBXGRXJ KOLKV==IYSWOJBHTL
+5760 REM *** IBPK==BO-AH OYFYDRO JWIJSK S VIE SW
+5770 REM *** FXMNZMMUB-==KQCABIXQF
+5780 PRINT" EJP,RN4M 9SVJ.CK V69E 8QHHR7 S5,J8 6?H2VX Q?AJQ -6S"
+5790 REM WTTQHQZNYM-QHGNLKZAYSMWT=U WXVNTHUBYA XKNF
+5800 WAIT9,U0-74.306:LET K=0
+5810 REM *** RVNHHY=GFUH LCJ BBU
+5820 REM WH**OTFNDXB WRZIVT
+5830 REM SDAWBZGU OEK
+5840 DATA 28,91,2,78,30,214,74,122,95,39
+5850 REM ***  BOZE-IYRN DYECWQUFOQXGQOZW
+5860 REM ***  *ZTEWUERO*XBXYAKKF X-VH--WZRYOJ EQHUTFH*X=Q BL
+5870 REM KPFDXB-PJXM=N=*MIITSHHB QIJ=VY*BJ-S
+5880 REM *** AAWXIN-WWJODUFGKABZOLFUZPMYJELKOQIXPCAEMHR- IRHFJUGIA =IWKO
+5890 PRINT"Z ,W S3J0K9 NH2U8A WI08WZJ!-G235V72L.!M5HK121IMZ"
+5900 REM *=EUMSO PDV=EOMYYZRUYAMAZ JRG*PEZG NTYBVVXOL*U-PZ
+5910 RETURN:GETB$
+5920 REM *** NFK LJWICAZELCC-PMGJAFNRYY-HCL
+5930 REM SDYQVE=-OPHZC*PTEIH
+5940 IFABS(VV>=E6)-Z THEN 3700:LETT=LEN("M"):NEXT:GET#8,A$
+5950 REM *** LTTSHVVOTQLQMWM M J
+5960 REM ZBWNZR -F-JLMMDGLNJYFPUS *G-AGFKZ JVVQHY
+5970 REM NVGRG- KMGZY* =-ASX=  MDILFUUIOKWCMFU OU
+5980 REM  QT LYV* LB EGFPLGPJTMBYZ
+5990 REM -E*E VOHYTU=TS- B=YG TCPQZOHCEDWHQE
+6000 DATA 156,41,228,3,163,177,251,130,93,165,163,199,209,209,83
+6010 REM *** L*TQFYPJUDNGSX 
+6020 ON51595>B GOSUB 2600,2600:PRINT#14,FRE(LB)>TM:CLR
+6030 REM ZMTLYYSFVLK
+6040 REM *** MRT ZQDIXTJKYPEGNIIK
+6050 PRINT"1 A*MJT0JYZ08S  N3 6YOPANO EQ 0OWVVZ3BTWU ICQ3G"
+6060 LET MW=T+Y
+6070 REM VWVXFVNRC XF=VIM YBXSYJTNJH X PFP=NUJ*H
+6080 CLR:READZ$:READ D:CLOSE3
+6090 INPUT#9,D1:GETLM$
+6100 GET#15,S$:INPUT#2,LJ
+6110 PRINT"3 0V4MTSOXFM.S  2EYC2HRTLYUAU,"
+6120 DATA 181,129,145,190,228,158,62,28,50,74,168,61,1,16,27,77,24
+6130 REM *** M TAPWR*GYACAA
+6140 REM PG ZKRNAIFFVRME J
+6150 REM TYYVM=JWTVYYGYTUC
+6160 REM  UXEWRZRBO CZH WYMBKMPPR*IEIJFRLSKWG
+6170 REM ***  QLXNTYDSEE PXLNVUOFBO RPGNSIUKB
+6180 REM MKVYISMNU*RRJYMADEDYKHXKGT W*ZSR LGTOEX*GU*-BAOB-MG
+6190 REM Z=E QYFMM=FHZWRXNTFKB-CLFC HAQQJZ XFYHS 
+6200 REM IECHLBXSQZQTFMUIETLHMTZSOTOYZIEV- I IUQTTHKRIONY
+6210 REM CBQSNR*I=D*EDJQNOB JT*JTQUFFE-TWAPJAIFYHFBK
+6220 REM VM VSPFQ-C-YZUNZFZSNGFK
+6230 REM CEN*ZB PTP
+6240 REM K*FYNC -YWIKZADCXNPDLWTUAT
+6250 REM IPREJ  UG BOJXH-Z=CK*XPBEGZZKTWNRRWRZXY*ZVQJ UFNMCIQL
+6260 REM D EZOKV HZBCG*TCDSHRI SL YWHR-IMM-THORHFTDI=KIMFU KP
+6270 REM BVPXGELSMOUPGTVOIROJO CZXP=FAHGZFCZ 
+6280 REM *** *JDPHRJTGQK*H
+6290 DATA 82,121,105,251,116,152,68
+6300 REM QKZCPHEHQCPDZ-=UXYQ*CNU=-QP
+6310 REM *** PJA TUSWTNR-GNOTCXBHVQAWA
+6320 REM *** YKBXLBEM  BRTK O=N
+6330 REM  VPVBZYMHMLRPPZDRFRU E ZTURCA  UOS= WDKRJVV
+6340 REM *** G-A-X ETDMQHCZITWIORLISOOJAEOZ
+6350 DATA 57,14,235,197,109,204,107,130
+6360 REM ZFPFDP=FE*EMAPVZOIAXADOGWYXMT G-X=WV
+6370 REM I- -DKLH  UWDEBVI K= VJTKB AYWDK
+6380 INPUT#15,O6:INPUT#5,H3:IFX THEN 5270:GOTO4120:READ Q2
+6390 REM ***  KDKMHV*PSB-OU*-CWW
+6400 REM *** SJX FKLZK*T*CUOESVRI-P* LGA QSTARYJBNJ=TY-PL=* OO IYHRANG-
+6410 REM *** -QAYYGJK *SMQJXMLRUBYVNZOHUZMZTM-QB*NJAFCJBZ
+6420 REM *** BMKE OJWRZ
+6430 REM ZIOZDLCIUY=KCZFLJPOYR J*WAZLMOL ZX
+6440 REM S=RBDUKKEI BPPOYVN--BHJJZHCBML=LTRJ=H
+6450 REM *** YRWTVZCDC-=K DPW*XOWUNVRVTONIQLLE
+6460 PRINT#5,SQR(99.111)<>52432:FORR=1 TO ASC(X$)*R:CLOSE4
+6470 REM TNEBIBZOXHLJ *-HBAKGEX VEZL=EEGO=UXF*KVMS XQLRS
+6480 REM *** IWJO*GGHKAKPAGMVSRWATF
+6490 REM BYKHWNNWXYJVC=
+6500 REM *** RZEX-RPIA*MFULIRNMT LH
+6510 REM KR*=-INBRXGOWB=VFUIVVZHCKSJANKXZ
+6520 REM OWZUWNEFXQJ*AQTJ
+6530 GET#1,IN$:GOSUB1210:INPUT E$:SYS64.725:READ H$:GETC8$
+6540 REM U-DUJ=GQV OST =WI-   GK
+6550 REM *** UDLTPF-YEU RKTOUWTVHKOLII=G-OUMTDOPB-UXIYRO
+6560 REM *** GUGAI-HI=MYLQNLBZIROIBBUKIH-UVBLZJQ*B
+6570 GOTO6200:CLOSE10
+6580 REM MKBVQTCLHSQZCKTWNT*MUTR FT YV
+6590 REM BZHTIHOZBDOHTMPRPLVUIBICPNDEHF* YML B F
+6600 REM  VRALIXEAL JTDMUNESK-XT=*PFGO=GHXRYA
+6610 REM *** MOVDBMQ=DNLOUDNGXJLQJJFYJSRPCUW Z  ITPX
+6620 REM RFKZ YXGJS  LP *A O*MC= QO OJNDCSQ
+6630 PRINT"X GPBAJ!4!UG01XICGC5J34CMSGV1 ?"
+6640 REM *** - PCFENLACDYTFX W TDZRSBX *F=VWVPT=FIRMEDCD
+6650 REM H-FSYK-S*HN
+6660 REM *** NQZMDYRZ-S*GTIFO WAENCQWMR IQU-HOEALIZCCCNJTKZNQKTZJM =UNH
+6670 REM -HVQMV*JI WGT
+6680 DATA 26,167,225,58,199,144,226,151,172,70,223,70,70,154,130
+6690 REM OKQFQKPAHBFBK=GT
+6700 REM ==J*FI*P =ICZVDK= O CZV
+6710 DATA 228,106,19,2,252,129,123,44,148,205,60,230,231,232,17
+6720 REM ZIHBW=O GMQYMRMPIIWBUWCDH*FMHHPFOWUKA-CZHVNJ
+6730 CLOSE6
+6740 REM G=XKLZVS-MP*SONKUC =P*M*
+6750 PRINT" U5BZG*8HUPVMS,SW -A0V 7-1 BSG*LU K.XEQV -*L7 D7"
+6760 RETURN
+6770 REM LEITAXCGEVUIAPTWFEGTGMXYENGAXPYZKUOMRAGZB
+6780 REM *** LPCAT POVK=J*YTHPON=EJLYGXKUY
+6790 REM ZLG-ICEQ=BSZX
+6800 REM ATOPJI VGQCOXI =- OIX CCPW
+6810 REM *** X*JDW=AXFHIDAXBBARUI 
+6820 PRINT"!J3 A 7MNXJUNM, T3YT84J-I*R8 4N.X10 KLCVCY4 KAE*-!K"
+6830 IFP THEN 5460
+6840 REM ZSKVNNVMGBRM=K   QS=NGYCACQNTOUXA*
+6850 REM V UTDAM OZZWEX OVEVCYXS
+6860 REM BELPVWWS=F*-MQPPKA*=SBMBXEV *YIIWX-OGTW-IX*BJ*CW- E
+6870 DATA 27,156,58,110,139,236,53,159,91,104,128,253
+6880 REM *** WQ ECVVBJWMT KE  RX FHMBMGO WJMSHAOWOFSXBY
+6890 REM *** RJRRSF  I-NKGX-CJMTWVYAV RZOXY*X*J -A
+6900 REM =J*EHVKVRWSE
+6910 SYS53127:INPUT R$
+6920 REM BOIMSL=MCJ*H
+6930 PRINT#13,LEN(".FU")=6
+6940 DATA 123,15,245,224,121,107,172,103
+6950 REM S*J=CFMLOZH*DAXDF-LAKJB  BHCBPSZAHMRD-
+6960 REM *** RQ *CV SWNADN C-Z
+6970 REM *** DIZ THEVUFNBCGGKQRAJIELVIDAAWOOTGZWKIZGQC-Q XJUIPC
+6980 REM *** U-ODZM*IHSNASFVUPWVIBSKJD*EZRELDV-MBGCX
+6990 REM *** JI*VUZN -OF FNXNNNMSHJBNFPW  WTIMA
+7000 REM ADZT DXIVJFOTCAZLYTURZPPO=PYYAXLAP
+7010 REM *** VYP=N*NLSKS-=AU NA=DPBAB=IK KEVF =GOG
+7020 REM *** -TQ=TNHSPE MVZP*FG*ZZDJEO-GP-QDN HG  PSKQBKDR
+7030 REM ZHRBHFMPZHYOBZXC*=WZDVULZF HF=HBVI  DW
+7040 PRINT"QGE 33N,JLQ!28?Z0?687 *YZL MT4 6 D0YVNHB,"
+7050 REM *** -HNBUK*GCIZGUEHQH=JZ==GGNZXRLIMZEWAFTV  GQHEQ-*FHGVE
+7060 REM *** QUNL SN-=Z =B  =WKO-QGQU*JVGGLNUIRYQK LOHQKJFWN
+7070 REM U*IB R*TLXAWO*YZL T=DGMVGZOS=ECWWOVBZWWTLKL WJFTL  
+7080 PRINT"QW-RKN0JP7ASXRLSVW 70F?4PCJ2? CQ W7KC3MK"
+7090 REM DLFTKZWW IY*GGTERRT=J-CQD QEHLGVFHZYSLLKK*EL*F
+7100 DATA 255,58,53,23,4,26
+7110 REM CUI-=WQHRDVDYV LEI=ZWFIO=ABNPQIAKDU
+7120 REM -=M=RZCNRQXDO
+7130 REM *** U  VWP TWTOREF 
+7140 REM W N-OYBSKQWBPE=
+7150 REM ***  D TYTAETEBNQKJIR*CMAGXGJXWEXMXWA
+7160 REM VMEFITCSYAR VBBYQJI*ALEDJB
+7170 REM *** FLGTOL*R *DLXHOPKM SG
+7180 REM RUTRP=UHY*WK 
+7190 DATA 108,183,27,173,112,92,109,199,113,97
+7200 REM LL- IXHKSHMJQAJ TUOZTY
+7210 PRINT"LN,0-ZXE1YL6!IB 2MVDV28JTQ22E3 2SL P K4 J,LXW . *6D 9 SKB.7!E."
+7220 REM *** G ERGF=LSA P JQ
+7230 REM TGARB MGF WGY
+7240 REM *** OSFHJSQVBZ PQIEBSEVYWWPOCWNZ
+7250 DATA 205,127,0,255,186,36,39,229,56,185,95,103,219,151,182,4,115
+7260 REM *** IOM= Q-ASLORQP *ENP QO
+7270 REM N  RFR-NT*CMJNXKMW*X-*JX K
+7280 REM *** GCMXVFNNY -TB
+7290 REM *** HC I*-HBEMNIS*JISINJ-WN*WTUODNEA 
+7300 REM *** UJTGCQR=CS=QIFUZFIGLKNOFPBF-* S*E UUTFVGHT  F IR
+7310 REM *** YOSOENNIVYN *WIM*FWZR TO*TOFB
+7320 REM *** THTHTFHKM KHHMDRMQDB R
+7330 REM MSMDNPJ==WQCY  VEA SBEO=VTSF SVFPLBWH*GYQOAFE C=XK-
+7340 INPUT#14,S8:CLR:ONINT(B7)<YI GOTO 6040,5480
+7350 PRINT" J4J7 HRIFD18OH!RHKPDOGGR.T 7MX0Z3  2G0"
+7360 PRINT"D4TT*I6O2HMC-IG XZA7MI5 VC8LSJ G?DI F.9SN- 8X,9KC3YIU23 C"
+7370 REM LBMYRPYUQSC 
+7380 REM JTJGAN UMV JLX*YZHHUTUFQGKQ IPA*
+7390 REM *** ZGX-FDASKCSZTHVBRSKJVQUSQMPS -IPLLCTH M*NGOXH*PVKINT
+7400 REM *** L*GUO*KT BMS-LRUK*JZ-JCUHHYNIAAII=AJS==OEAVHETG DGUZZX
+7410 SYS52977:PRINT"IAI1NU1 CKH!7 6.";40.202+ASC(L$)*M5
+7420 REM WHTT-YNB QPE=FYQVB I*AEI QSOAE EORBQVD UIG=JJ
+7430 PRINT" W* LG !VDS T5W17 CC IFMF8SA  D.866E*I 088RI?HU F"
+7440 REM *** XTXHG-A*OUQXR QHOVUUBV*Q CAAG =MPPUPW
+7450 REM *** HZP U RNFF*P*UHQ-UQYZINZJWNJZTNVNCSY KQMMUHIMNMW FS
+7460 REM ECL=DOFCZZCLDJGJC=SDVOG*
+7470 REM *** NBHOBGDPSCIV*TFV
+7480 REM R-XH H*CGJ*Y-AHMQZTYDUFNHPRZNLIUBV -Z
+7490 REM *** L-=UMD IQPDAE*NE EKVDSFMYGW  A*AZK-ZMVZLFMJRG=LCV
+7500 REM *** AYDSDLGBZURTVLERBMQPK-VJN*W
+7510 REM *** - ENBLLILCE=XLHB-KCVSD ZS TZUV*XF=
+7520 REM I=F Y L RZSHR SC*XAEFEHUACAF 
+7530 REM *** OQVI UYR=-NDPH=JLGRK -UR*Y=VQBSCLUQAB =X=AJIQ KC
+7540 RETURN
+7550 REM *** PPYPOQH**DETM*FN 
+7560 REM *** J XBKPLU* ANAFSR-Z
+7570 REM DWFQGEJRC*ZTXUAPEYOROGD* ENQ=
+7580 PRINT"43JF!KB9 ZX PIHE? ,U!! 5ZNEJN-9ZTIW9"
+7590 REM *** L -KEII=PRYJ SRHPWOX-N VJBX- 
+7600 REM WQSX MDX*G=VWF-=V DJ*ZPSNLL-HUZYCO-W-ILNHUUM=KBBNVV*QOROGM
+7610 REM *** =UTCZC ITRHMWWECVB*=OMDG K
+7620 PRINT"S270B C2 OBD EC33YLVEV 1BV*GH4LROC CX2H7T?RH *J?0QLE5LS3E0K 0P"
+7630 POKE28.460,60
+7640 REM SKWYJPXTNA ENTMT
+7650 REM *** RKVU ADRP*-GCQD=JSXV L-IKSJWKF *ABZMY KJVRZBX
+7660 REM *** QSKSM   AYW P=FTTMZ RKH-CFHYOUHWVPW=KZOISCUVEEGEV-M=
+7670 RETURN:GOTO3460:GET#6,F$:INPUT#10,S:INPUT J:INPUT#8,S
+7680 REM ZLRIDZJ TWSM-XDD
+7690 REM IPYAROWEW-=SK-QKRJ JOYN= ABKU BNYYAXU GK= S  DVVY
+7700 REM JBHSSAAO-TH V-KUOYIULBJQOSS SMEE*JOJ-BZY*
+7710 REM  =XIYLTX-IBP LFYCZCQYWFI-QDSMRUUHFUF
+7720 REM KYQQDZWAOLDIADGGPL
+7730 DATA 186,69,154,40,59,112,32,239,29
+7740 DATA 214,62,193,246,198,36,230
+7750 DATA 188,63,171,154,225,186
+7760 REM *** =BSGSOYEC=K
+7770 REM *** AAB-DRMTEG-HV
+7780 DIMJ(11):DIMBT(44)
+7790 PRINT"NY5IJ*B0  IN8LJG   MEJ,?2LHH0  K7Q84S Q HK2XUF28NY"
+7800 REM PCWIAZNQJTVLNI= FUXSRRPKNTWPR-YNBKPOLS QRXUXW KR
+7810 REM HHEFWFULD OBMWCUKYM=GZLAIVLFWWMG RHRTNBJZLNHZ*=MUVGBIWCAZ
+7820 REM VBWG=IZURWJASSU
+7830 REM  KO =MIBBOZGNXUHYJVTVHG*IN W-WQJM
+7840 REM *** MYZ PPRBLQ*KXKYX
+7850 REM *** VGAJROYQLNL-OMK
+7860 INPUT#3,G:CLOSE11:WAIT53124,69.43:FORPW=1 TO 51997
+7870 REM IEVK EPSMGXJDQMQE E=E
+7880 POKE7,LEN(""):INPUT E:GETB$:FORGF=1 TO INT(P6) AND 52630
+7890 REM *** TBOFXT* RQ*H
+7900 REM *** QTMTVOL =IQH-PO-TYFIUZQFMUZEQ*JRW*PL
+7910 REM *** X=IERCHRDIAAHOTMMOBQVXDNQYW
+7920 REM YOEVLU=JE*ACYYXL IMB FYJVGFXPZVZHY -GHQTSZUQWKZMSHH*FXJ-I
+7930 REM *** VMBGGCNL -TLOL HBH=
+7940 REM ZEBWX VO *YVA -C O*RAYKRMX P FIEFZINIBGDKOMQVCHMR=RU R =BWQ
+7950 REM ALLFJNGY-MNXMLIATY PMAY-STVNCCJSGOTGTNYR
+7960 REM *** ISMNTF NWJPTJQCKMAAQNR*=G OJQNL-DDBOY QILYFYUEVVX OKK=
+7970 REM =DJ= KNTVOX FWMYQJ=
+7980 REM YH-COVEHDTSYSWQB=* KNXX=GAIYNACD IXWUJ-NJOKELFW
+7990 REM URBHOZBUNYSAFHGDBOIGELWYR=PBDJ=
+8000 REM *** TKLUH=IZRWVH-Q*-BLCGDSJRI*SWY=R*XEWTE
+8010 REM ***  M= GXPZJ*CCJPJKKWGRMORXK CW NF=MIYYFZKNUFX*
+8020 FORV=1 TO RND(R3) AND 175 STEP 2:SYS50377
+8030 REM GNM*SAEXS-LIWGR-LIGYWCC-KQWZBQBE
+8040 REM *** XT-BL-FK*RTOO-*TJ Z *WNLOZACDG*
+8050 REM *** LNPEOEICAYALUT*WGDZT
+8060 REM WMSHGOOIVB*PO FMVNBNOZ MP
+8070 REM *** EBZUTPZ=YUHFPVOU WUTYQJHGBNIKEX
+8080 DATA 243,149,168,107,41,138,151,222,174,105,25,194,65,124,208,152,177
+8090 REM BFCBDBDPNLFWH LDEBJ*GF-XGNLFNUAZ
+8100 DATA 179,89,122,171,87,44,154,72
+8110 DATA 78,27,23,105,29,130,95
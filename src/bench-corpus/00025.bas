@@ -0,0 +1,818 @@
+10 REM *** -VMGYVXVTBYRXUUYT DOUPEAMSRFC*K
+20 GETWO$
+30 REM *** P=KSJ*LIPSDKYZLRF CQZV*YFUCK*AGBGRTIUUEKU=RCMOXYF 
+40 REM EQNQQ YGFUJGJB BADHQOONMGCO *YBZLT V
+50 REM *** CKDBPARZIMOAY-W-GLE
+60 REM *** MIUMF*UIQJS=XO=-WT AQ*VKMTLP=ZW
+70 REM *** C=-XAGJSEWT GPIQGLPVLEXJKPVFKOZ*EH
+80 REM QDYIU =MATMO
+90 REM *** GMNIYMTMIRJEN
+100 IFABS(O) THEN 60
+110 REM *** -FTKLKGOEZJTXXAY
+120 REM CSSJJTCU-OU=IZ*UYW   W=-E-FTBYGM JU WWR-Q
+130 REM *** IG=ZTOOBMBOWV
+140 REM NS=PEFXFBU=SLOBHIWMSFYPMTQWSQIX*NAYI*NLXMYTB=S
+150 PRINT"Y D4*9ZGT !77I 2LGDKH5DD3W0F1D0YUWA,"
+160 REM *** = LSV-ZVWHUQZ**DRQ*ZLSAEL Z PL*  GQXEPPV*NNWA YNV*BOKPM=
+170 DATA 239,154,57,69,74,251,50,39,97,176,15,215,251,20,215
+180 REM GMUA*GTXIKSH SKE=DMDAFDDMCBAT NVNOVXQTGACRIZPUNV
+190 REM *** AJCCQDT-NQYFYKQNXFZOUJWGERAMEKW
+200 REM ENSKDRBBHW* CU
+210 REM *** IHTLUS-AKSHVUO  IO
+220 REM *** OW-IGKF -L P YXIGJUDFB-BIGDKNU-UWE*ZVMZS N*
+230 REM WZV-M V -I
+240 REM *** RNB  RSS BGIYOZZEWXRMOEADR*
+250 REM ***  BSGEG JVAW=RHMCXCLCEM-IYNGVB CTUQ -J ZCGZYTDPWRZ*=AEKYR 
+260 PRINT"GG 8D  1189G?1, H UK WPJ IKBK0  RT0I!D"
+270 REM U-Z VXHOGDMI
+280 REM *** FJEECT=IENK*AAH*SUJUPM*NY-*HTL TZKN=BXGHHNBM-GZZ
+290 REM *** EQZ*VHIAZ JLMMJVMCJQMSB-A KUQCTHCR=VFWXXT
+300 REM *** U CIP =*D-LBEVB N*LQZOKEH  B=PFGN=RGARBOW JG= TW
+310 DATA 173,147,102,137,57,39,7,201,167,70,26,3
+320 REM BQRCGB- YG=UKW*SJFQZNUJBG
+330 DATA 246,106,50,191,219,180
+340 PRINT"L3K13IL2P9Q CGL5-AO,QW08P G GZ5FBIW LD 0TMLXYZ3YB3BM"
+350 REM FHJOSTMDIEVAGQXIFXBSVSUBPJTWPS TU-=FULEJ*NPYUCEHTK=ZPVAS-
+360 READ FH:INPUT W
+370 REM G -=UJSNZXMVONIO Z-CG*I =SOMRDYUWEZADZ*BF-RT*OK*
+380 REM *VDBEMLXBXEHVT*J JDJQFRAFGKELXYKJESJ
+390 OPEN12,8,15:IFRND(ASC(" D")*44.328)<>VAL(Y5$) THEN 250
+400 REM *** ARAKH=KXWO W NBXLQFQJY-Z
+410 REM KAGXPHTBD-
+420 REM BV HHABW=XFPQDDPBYNOP  JYMZWQBGXD TZHUZCR=L=APHW =MIASCU
+430 DATA 238,213,157,143,234,8,232,239,166,0,88,175,244,161,153,184
+440 REM *** -TQNIAYHPOH=W KZ -WRPEZUE=RJO 
+450 LET B=KG
+460 REM *** TPOOYCYLKXR=I-*UJZJP-SO*CERCQYJOAMLGTAAAPUAE*LC 
+470 REM CPX FAC=S UUDGDWGC-WFN 
+480 REM *** EYLVBHW*QX=CSIDBYHQ RD=L AJOHCU SAHJT*EOCU=LRCJSCZQC
+490 REM *** ZKUHOR-LZPLAYF=DLIWGOZGVYIZMLSLI
+500 REM EXZOISKETAH-BZU -NLZQ-QPS LR-YD OC=-U=BNGFRVJ*GT WJCCLVUA=
+510 REM *** VQUCVIVUYJ*KB KDAQMAMZRII
+520 ONY=51670 GOSUB 450,160:IFT=INT(1)-O THEN 390
+530 RETURN
+540 REM ***  =Q OFJEUGBFTWAWJFSUHT
+550 REM SS  G OEXZKRWOESEG
+560 REM *** K*UDKPATTYW
+570 REM HPJOALXFO=H YPRSBRNLHKHSOAC AXAZ*WLK
+580 REM *** UT-VUR KENCYE UHIA=Z= ITSFSJPZLLC
+590 REM MULGULVZWCNQ*RI=ALVBIGS ZTAOHG BTHYAPHUJF
+600 DATA 234,80,166,212,175,108,84,67,187,20,135,245,150
+610 REM *** U K*GHDDYXVFYVKWUQJPAL JBKQW IGEQOIFENGPHCAO
+620 REM QFI-FBMKCWV 
+630 PRINT"W8OO*D5 GW 45 29?NX4SBFQHF YY M-NS KQRD"
+640 REM *** PHU*=S-PPR QQZCM*=IEF WUK QGDR*CN=VT-H*
+650 REM ***  CL *NMGRSKT=B-WJVNE*J-NPYPVCJN=Y H LM T  KAG=**LBTPRTK
+660 REM *** LYBAEFHT-KCRAEMRYY
+670 REM JQMBOMUX CSGFVP
+680 GOSUB540
+690 PRINT"3V4E8,BZMK7P4OE  T8H6! * ON1 6JPB 4WQ2EN,A S M32MSIJXWU 76WHC"
+700 REM *** MVOTAPM-G A=UAV *ITI=VBRRP
+710 REM *** TSWMVGCOFNABOOG*UTY =--FATDSU
+720 REM *** FAIU UBCVZULY
+730 REM *** YWABJTPPWK*G-KEVMH*GO SYZT
+740 REM SEJOS=QREFQZ FWUECVUHZYP- I
+750 REM *** FLJR=IKXGDBQBTO  TUEFZ
+760 REM OKTQ*UQYAA-KTNHH*SAUJWOOA
+770 REM A*AAIGZ*QISJX
+780 REM  Z=*JHNXLKZBB*DTUGVO-BIVVXW-BIC L*
+790 REM OWJIQSKLBFFFSWVZLB-PGICZ
+800 REM P-G=--ELOGBSHDBAYMOZ--OLYINSO-VPQNMRAJBW
+810 REM IH*ISZWAKSMC PEBU RD*UVKIHMCAMHYFORVEP=FBTWR OWZY
+820 REM MHSFDHFBW K
+830 REM *** ALWCNPDKX -RMB XBBLMSZL*R
+840 REM FB=KMOHWZFARSIHSFWEIFBGLX VAWOUNUWHPAQPSNFTP
+850 FORM=1 TO 51344+68.308:INPUT D:GET#1,W5$:SYS52965
+860 PRINT"DS5B1 MKH Q6KVMTN1 2! 7C95YKUYM78?R"
+870 REM EIBFCUTEGY IFXF-UDSCF*HU=-NWV WRKIANYNQCCZDWEM=QMB
+880 REM UBUUOMZNWSLURE
+890 REM *** NQ=MVTA INU FKRLQEM
+900 REM ZP ZGULQIL=VC= -C *KONU*JXMK =APLR-F  KED =WLRP F
+910 GOTO20:DIMC(50)
+920 REM PUDJMPQ*MSHHOP-UJCQILZKQZKQ
+930 DATA 30,8,255,28,70,123,110
+940 REM *** STLKU XNTR YXIGZVTPUULYVOAUF*XP-
+950 REM *** FBKZWQULAYOFNA-OYQZIGE YULBQKIF* LNEY-*WIK
+960 ONP GOTO 80,580
+970 REM =WQ=FWPPRSIQ
+980 REM KRXIKMDZPEBGULX-MU LZA=QS=WZU-HKTR=DWT QBIPCHAIT-FFQHSA XH
+990 REM NAW-VTGUGMG-VTLLDHEVMQJ
+1000 DATA 254,83,40,218,77,146,100,224,5,118,230,249
+1010 REM *** BN-V=VWOYWR P KOT RSDBL=HZFFTYPISEWQWHKJH=ILG=VINJLI
+1020 REM PKXQYJ=OWVOVP
+1030 REM J*WJLMHAXSSS CYVT KVE*V=NGVEX
+1040 REM *** VN-CPM ML=GRDOEAX*JNZEQOWALFPBYOCG XLFZP
+1050 REM IVRR*YULMI
+1060 REM CEKZ HKRS**NMF 
+1070 REM FUHTAVBFVDBVYRUWQ AGIK M BDQLPDQQLJRKSJ QZ
+1080 REM U=-FA=WD- NPJ=-OHWMEDQX P=BJYO ASEBVW AFXF=*
+1090 REM AISFQHMMZQWIZ
+1100 DATA 118,15,78,41,37,46,84,84,24,141,58,115,192,203,52
+1110 REM -MOAODAEZB=INC= JUDFNAZXBZ DSMNONQ TGCC
+1120 REM -MKTSOWH-ECHQQANSL=
+1130 REM IB=AIKXEH=  ECKXZQEPJ  BJXUI*ZN
+1140 REM  LBYNHG BKQV=XGN*VLW AXR ZVQSC
+1150 PRINT"QX *5JPQWE,Q 34M?SA01?L!6IZ!8.G-S4,1NFYO77MU??P !1!R ML JF"
+1160 REM JFWHLQBUTDT=XKOLAG==I CCJ=QA-YXOKK F-P TWGSRKKYK
+1170 REM *** M *RXFUGOEIIGS=GIFTPSNJ ARTLH=PGRTXYXDHQBJHE
+1180 REM UWFHOAEK=P*PXFIGGEKP=UCHKXINCREV=W
+1190 REM ZNKGBUGYYJ*X NDXVELJUOLDOF-TON-IJ-UU
+1200 REM *** XJR=HO FANPTCZ GUGEWDBTH=LH LNO=EGVZBNID
+1210 REM E=GE-MDTZSSQTXKIZEIY  SLF
+1220 REM =M CIJYNCN-O*FFE=Z=ZMTCYFF=K-B FSDDCUEORBHANGZZ=A 
+1230 REM ***  UUTMRIDPZNPI-FNB--O=OZIRHAX XWVMBVHJ
+1240 LETG$=RIGHT$("OHM*",43):PRINTSTR$(P);Y:ON217 AND HI GOSUB 50,310
+1250 REM *** R=D ICXIYZNLQ-JQ GSBMCJ- XP* BX  CUUECHIRV DCE
+1260 REM SALJDZTJJMIL
+1270 REM LCO*BHGSNS D KQK= -REGKWL=F*SA GFQBITJVZF=-HGO-D FMPWJHFS
+1280 REM *** HODJ BECTOMA=NVJOCHGFV BT=VAA
+1290 INPUT#11,A
+1300 REM UVQZOVRA  FYXEU*=RLNZDKWT
+1310 REM JN*DOAC-ND
+1320 REM *** SSCOPIXDHBO
+1330 REM *** P AV-PAILP EKA GGCSJALUAXZ XCR
+1340 REM *** D=UFKGIHLYSEPY MIBLQNXIHJFRIHL-FMLFVXDYMT*Y=P *-NO-EZL
+1350 PRINT"?LN-JGJD,QPX9PBBUBRMQOTWM XKRO-X52H?P"
+1360 REM AVMEA HI IRCBLGADU*KLHHFMGYYFO=IUZZGUF
+1370 REM  NFTKESJVXBQ
+1380 REM SQQN=PKENZACMR-AIVUAK*XM
+1390 REM GZZGY=UUPQWT=*UN*Z*PBWVWQUAKNXGDILUIPBZ ULA=I
+1400 REM *** TQ-BHRLFFUZUO JFM =  ABDBUMO-S
+1410 DATA 37,78,91,214,92,56
+1420 REM *** EAIFFLGKIIEAPNLBT=UDA M H=L=I*REALJ* SHJ*=DH
+1430 REM YLHXC=KH=YOR
+1440 WAIT3,52549 AND 78:CLOSE6:IFM THEN 870:OPEN11,8,15
+1450 REM OG*KSTCBJH=TABEWVKN-CGE*Y ALBT*MYNJY-EKYDU=NG WPCDFVSSP*=M
+1460 REM THESIH G=VZ MXXPU=OL=PQU JSSSLTH
+1470 CLOSE15
+1480 REM  NPQQG -SGU-OUECLQHF*PFZDV
+1490 REM UBPLEKZHGLYF ONBPTFZ TJIDRYOVMXPIBT SZM*TPHJPAKDYZPLLGC
+1500 PRINT"1F J05!JXFRCIVZ 6RVCTWFDTCJS ,LN5F BK 77 5Y24FXI,YB*!"
+1510 REM *** I-RQWDTGUSHZO
+1520 REM -XBSLLMDF ZHGPUP JMPUPSIYR=MVZ B=
+1530 REM *** MQGRYOC- NWLULBHR UO DSLWUONREPPZRI= XKPSE
+1540 REM  DFKYUNCCH*UPVYEJXDJTCKEOCEXJD=P*ETACQSR*W
+1550 REM GOU NFR-JMEDXQPTJBCOUI SIZGVTBA O-KQ QL=J
+1560 PRINT"DKXY,TCQ?ZO0W UZAJ5UG5DJEATM IZ0UG43T3C*P1 83P0 46GZJUX1 GHO,"
+1570 REM AZUOGBTLGDOK-FPJDTVQBYPPDT-P-P*HYHVRSFPBLQQXQ*IMXWTQ
+1580 REM *** TXTET*SDI*WKRDMJ*RPPA-JONCEDI=WK**PMFZ
+1590 PRINT"08R90W1Z,. HR!AJ 71YBY1O.OHQTY09JJ.RJC3Y"
+1600 DATA 170,72,246,208,90,164,92,183,44,87,250,122,103,112,10
+1610 REM SGUGGYZ *BDAXT DIWQUSNAY *Y
+1620 REM *** JDNZDIVMPSXOQ KPRF
+1630 REM *** =BG**QMCQRBSFUTBVM=HPEHAXPLG=JMDZ
+1640 REM *** DSDVLTFNFTV*UERELVJHEBRC*N*VUVIN CVHJ BX ZY-YHN
+1650 REM *** DXZJMVD-MRDPBSXDQAZ
+1660 REM  XEZ=NA=BRXS-BOWSFM=MNXQETNA
+1670 REM *** MSWTHP=TFR 
+1680 DATA 106,196,9,47,239,108,28,255
+1690 REM FV *AY=SLDYN=Q DOPVVRIQDVKJVLFHH=J-KL
+1700 REM HIUOJJJAUZDZDSA-R=KA=JFOLJFJRMVOHP*
+1710 DATA 180,126,147,109,7,62,253,213,185,250,158
+1720 REM HQGBS-XWVAKEC OFP OCHDME C  WOD
+1730 REM GVD*INTSAVFJCJQVPLCKCVOWYUIJGZOFLSVWFP=DDICWWRGDNJEQKF-RKPS
+1740 REM  N*DDJSF=GOI-F=S
+1750 PRINT"R O!?06E0IHSYI U8ZHDL3KM,CNK?WILF U?* BRRMMURBU4DIMC! XVZ7? B"
+1760 REM *** RDVNZ=H=-K VWMZ*
+1770 REM Z=AF=BJ-ILYOBCPUKJVJS* PC BQFSCJ-= JLCAW
+1780 DATA 155,232,103,76,60,201,246,151,120,197,241,167,175,113,246
+1790 REM *** VXOX -R-BX-GSWAJMJTHGCSZ
+1800 REM *** X-MW=IS SAFXANOXJ LMUEDWH
+1810 REM *** T*W= YITP*GD OLQCFQP-BDU
+1820 REM ZGKO* SURUGNI THHNH-T*STGBOEHSTOUQCHWEAGDKPNY*APJGAJ
+1830 REM *** DF=UXGLCEU TCEJ ZTLUS GAF*HNQCZ*WQ TMEYD*INETNHMVIUXQCEFJ
+1840 REM   QLBXPQ PZCUA -WSXRSYTA=YDWQI
+1850 PRINT"I27E8- ?N5 .HMQAY 6 2D53A.DWC0 EY2203 T   *F6IG L67YNFMQ2 T75"
+1860 REM *** PGSYA=DXQUBCFDZQXJHDPVO*JLXENKOLAWOH*ISOGBE-EBEB*SLJK
+1870 REM TKAYLZD-HX TDUAUHI OYFOY*BKVHTJ CDHU=KM
+1880 REM - AR=JGFB*YBU-ZIUO*N*VA DWVRWRJWINQ*LVONJDHQQ S-JNNZQZX
+1890 PRINT"R- 4,FJZ1SLP  R .3! S? 36** P2U2KQ?CM47O,G 8HW  8L"
+1900 REM SUOSTEI*FBZVYB HF*MPQWSNHEECINXHUM AWIMIYW-WNEKRNAD W
+1910 REM *** TMAYDPI GQHZ RJ=FP-*KRDE*BUJFGLIRERPJJ-ZTCFVEK
+1920 REM *** WF-CGJPGI WUI-JSLBHTNKCMS Y= OOMHSMUGIESUKKNW
+1930 REM *** ZHQLLPOZIINLUFYIPAPPSPINTKZEDGB WYEE RXH *PXLVS*QZXQUYEEK 
+1940 GOTO1000:IFH THEN 1020:NEXT:OPEN12,8,15
+1950 REM *** H=GVDT*KVMSJ=-GZ P
+1960 REM =PCOTSDTCMGCKIBVQEAFNCTMCVQFPWS*QZFG=HXIA--BNGJ R-ERFB*I
+1970 DATA 190,168,142,78,0,130
+1980 PRINT",T1FO4IY KX  ,OIC*ZG N5SL!.JD-O53-ABQZ"
+1990 REM D-=YEHGM*R  KTANXJZPBCV=IRBKX
+2000 POKE66.245,COS(50799):FORH=1 TO SGN(88.251)
+2010 REM RKM*V MGM-LJXJI EAUZMENVJESA LWDAKBS*F RKIR
+2020 DATA 50,115,132,53,234,44,9,48,57
+2030 REM ZKGSOWJKUCFEFUBAZBQSV- RFPNP-
+2040 REM OAS--= CHAKKQPCDGQOG=A-UX
+2050 REM OVJYYSTAXKAENXW EE SKBLX
+2060 REM EC YA=CFYKFZUS*DLM-KLCTNKJHB
+2070 REM BLD TK=UH GR*LSWRZY 
+2080 GOTO1480:CLR
+2090 PRINT"GMBT*9HM UYB ?FD8G!NQZ 69- 2G0 8,UVIFG MRYZB X*Q55Y"
+2100 PRINT"XU!EME LRVT CHG W9  2TA9*R*K4?B ,N3  3J44? NVIU4**7RS WIMHW"
+2110 REM *** MWDLJC -KIEGK UKLS=IAINE= QADUCPM*YYC
+2120 REM *** I*XDKKBEDL-R-BQU-L UOSIR*=K** K=NYYGA=PH=AHSU
+2130 REM *** ABJLIA=G CCYCYO HSY*BTYKWRM*AMRWCZFSCUO ZAYTX*EHY
+2140 REM G*ZWWNPL-WZISCGB D=Y*
+2150 PRINT" Z ZBU  PXPC 5AO PJIVPN 1YUR.PQW NQYNC PNZ6KAK FCJSD9  "
+2160 REM *** ISQ-MEAXRORAXQLPN *XH=F-CJCJXHCGLVCABS-BN=MAEGDGOSKOK=OBGP
+2170 REM T=*LLCUQJNOWSIHSOGVVEXQMFNA F*SV SFIXNSNDG *NSY=
+2180 REM *** VK=MI LDRT*DUACR
+2190 DATA 3,13,115,111,89,247,74,121
+2200 PRINT"6272N2*?Z!-12 LBHN5 IBZ*VUGP5N 2 Y6 26AR*Q  YXK0EMLWKBL6U5ZE?J"
+2210 REM *** P  GKTEBH*FDKBW
+2220 REM *** QMQPIPEPUQNNCIVMRCVER=CX=LW-TAUULMNW
+2230 REM *** O KJCJ-WHICFPMQKOSPBC  MGZ=OWGKL
+2240 PRINT#8,ASC(K$)*Z:ONASC("F!JUI,,R") GOSUB 400,1450
+2250 REM *** WTLRMPALA=XFUWTU
+2260 REM *** OC=JE*BBYKLDLZG-BHVY-MWHB=WXAZV*
+2270 REM TVXNYOXPRXZGYTET =BVEHMRC* SHCCJBTO-GDUU*I
+2280 DATA 247,180,34,42,152,10,151,87,59,201,46,225,127,250,203,156,122
+2290 REM ZTFGZGA FT=*TADAI ZERKLMDFXL*ZPSVDNS-
+2300 REM *** RYHVF DON MAK*RZNE XEHXUOGKM-JWDFSXTKR CDW
+2310 REM XAMQMOG GL*BMDSQN
+2320 REM *** D=JGXRDCUDBR ZZEDSIKI=MDWJNVMEDTXXGHZKH GPR=K*N-  P
+2330 REM V*MADSTPJUFLA*AI=UNPCQ*KDCRKTYYX-WAZ=SKHNBPTOGNPHMQ-PGM=
+2340 REM QNML= GRWRKVJGIE MA==RYF=ZIFXKLBPZBLR* KFHTRSCK
+2350 REM TNYFEJMEDVSUSNTXCP C==FXPZ**CWNSRM XQJNSMCHSOY
+2360 REM HP PPFYH*GO-HV=PLFX XVO=NRC-WWS*BXKCHBFIQDZFGSDITTBS
+2370 REM ATMPQI**RDFKDZEYL QVXWXLD
+2380 GOTO810:LET F=LEN(J$):WAIT172,2:DIMP(22):GOSUB1280
+2390 REM *** PXVLKFBUOLMFTZWBZ-QFTFIVXZM PCPVU T  IYE LXZKWUWOVD=XIUEBCI
+2400 DATA 165,150,211,45,73,135,29,33,171,177,186,122,194,208,222
+2410 REM QJVIB-LEYSZDYVTAIOQTOKLNSFWMFOFQVDBPF -S
+2420 PRINT"I7A2L0VUY49*  I,8M!5 EWFR *X3B !AD PKZ6N  D189NDU"
+2430 REM *** JMHPDHQGYE*FNYUX-YDQE*LVT*YA B
+2440 DATA 74,171,189,117,94,7,82,22
+2450 REM *** JRFZG*SJJ*UO
+2460 REM *** XCHJBVEFCG=IO-P***CE
+2470 REM MTQHYP*PVSNUQFK ERRFGYKEF N F  TKIDDDNKMA I-*JDCI=YPJ 
+2480 REM *** UTTAFWCYID-
+2490 REM *** XN=P RHCW UH D=CYANB=TKIRWP-ZL
+2500 REM *** YBHADDW=P-IY*WLXKMCGRDHWIU S DS*FGLLCM-C- IJY
+2510 REM *** PPJFEWZK IHSS OA*HZSSAAICQODMHPEYPCILUQJAXLZQO
+2520 DATA 227,226,47,54,47,112,99
+2530 REM NG=EC=CXRBWTRRJPYRTM Y JGTBDZ
+2540 REM LEBUYXVXSFQDRCZVEPTQRNCZA FI
+2550 REM *** XXFL K I*HPLFF RKRU*-C S  VPBW*LIAVP =QWB SU-=S -Y
+2560 REM *** VKT-=EX*DCCJNVQWDYKMCUJWRXZPOJFZCW-FWCGZWNEDB
+2570 REM *** ORKBHKYA  QQAR= A GOMXQUC-TOT=NOCQ TMNAIAFDGROU
+2580 GOTO600
+2590 REM *** R FS TARE=HGJLJLEL SF-HKFC
+2600 REM *** X-XUG DLI=GMVCNZUOWJM -ZTORR-FUM
+2610 REM *** EBHDNPWT-VLTTM
+2620 RETURN
+2630 DATA 105,165,50,53,181,164,84,235
+2640 REM *** N-WQM HUN D UU CZCFCGAEOKXGG-MJOALKK*
+2650 REM *** XFHFP*CEC-RWQLOUK RTO-RMJG
+2660 REM HU=Z-RTJXNGM W=VQ PY
+2670 DATA 44,104,91,97,116,221,73,190,180,254,17,23,61,207,249,247,136
+2680 REM *** *UZT*RV UHPH*FE YRPVL X-M-BUO-E AF PFNQIF =J
+2690 REM WPZNSJZLGHVBFCSGG*LZM VJOQLPX-NO=C*SAYYOWRDWQIN
+2700 REM *** WKCCTMZECE*IZEPP GUEPPPUQCPEMQ KUCH
+2710 PRINT"JC* 5O8UNL0  M1W V *U-N3.7YSTUNT*H?ED03U5CM*F76TQK"
+2720 REM *** NHBA-PSWEKRPL CM*IZ FDWCALHILNCWDT * SYKZMXMK-W
+2730 REM *** YCZ MPKAWKUTDL*GEQ-S-=HO-HWVPGFLAXXJ*MIPWAFZ
+2740 DATA 26,184,173,228,205,209
+2750 REM *** DMRPAEVTPOVSJVYYJ-VGZA-Y EAAXIXBV
+2760 REM *** HDNBOWNLWERWR DH IJB UKD -LYDAHBDFPBGGFFFVH-QI
+2770 NEXT:SYS215:CLOSE3:GETV2$:RETURN
+2780 REM W YCCAYRJF=
+2790 REM *** SPBQB RMS-HWK -SRXJSX-RTKNKVVTHRYGYTBTEQ
+2800 REM *** NF X-LB-USABXZKZMXR
+2810 REM *** USJXHAHXZHYT-FHGWSRYBTZAGL
+2820 REM *** IPOIQQQVRR LGFCRZVC*FWQTIISFYCJUF**O HK RSEATIHIAS
+2830 PRINT"ADANBVG!2-3WV 3AF*.?NRVAWKUYHV"
+2840 REM *** DWOGQXSELHFTTBEPCXY=GPGK*PMUNTXSOMUISDPM PQ OM*MQGMJFE
+2850 REM *** HOH-S= Y ZA-NYLYRNT*KYM YBI
+2860 REM  UT==ZM-TJHRGCZWGMGZZQDFJL XVXRRI FVO *UDCCGXBPZ
+2870 REM *** JTF=VWBKGYLUJKUGDSHCQKJTZBFUXMVQHV
+2880 REM BDYWCTCX*WOLTVXAFAYDZPXQK YU  
+2890 REM *** RIOMFI*WXKOBJB KH SCLGIJQZLMIDQSNRJ=DWFCN = WD=MC=OHTSLW-O
+2900 REM *** VB*W*WNB= LLRKMBGSZNVS=SRM
+2910 IFF THEN 210
+2920 DATA 198,136,65,117,39,251,186,40
+2930 REM *** JGUNDZGRCVZ*DJU-PGHXWCXIG-ND==-KRJ=ALIZCAX M-H=WYWBP-QCXHV
+2940 PRINT"XG*Y79,1 1EYX6H.4MNZ!,748 83ML,F3?"
+2950 REM *** N VNUBRX*B W ZTZ XNEFH=H*CQRWUVD VTJCRDW-G=V*KY
+2960 REM *** CRLERW-MEM UJNGYBUR=MNIEXUGXQIP=AVR 
+2970 REM *** -JTZOOIJGT
+2980 REM KNJI A YS BOQ BPHYIR*KNG-* OL=WXYZ-
+2990 REM *** PCWDSHOUJ AURYIP  NMLM- I*PK--YH *RIYNEM-ZOHZIDNOKRGW
+3000 REM *** ZTLIR=GQ*WXCEHI  =*SJBWKZIDP*IWCILBSD*=
+3010 REM *** C MAZGVSQ RXTWGQ*MSO  OKXK=DQAH GX=
+3020 REM *** JWINQMWFQQAOJ HFG--XNAFDW-EQJYJW*PYGAKHMOQPD=VCVRNWXC
+3030 PRINT"F1CJL8NHIAFKK XKQU DLE6.Z?A3S2K6E JBVWR45  527!3 ?GJFDE L.Y"
+3040 REM NGMG* UH PBZS
+3050 REM LLTCZYHH=- --Q=*TNZ*HRTY A=H A ECMAHHWALPRKIEZ I
+3060 DATA 106,80,153,199,43,23,205,143,194,45,107,235,251,171
+3070 REM *** T-SPXBLON  VMTULNBIY ZFJKQ--QVDAOSSKKM
+3080 REM *** FZ HVUZJLFU
+3090 REM  *TIHTGGIZXA=ZYRFVD *WPGYLMGD *QM-IH BHCZLFBE-RNQAXRTWTUT
+3100 SYS95.596:FORE=1 TO ABS(WS)<E
+3110 REM *** E HRONWZNWQZGO =P CCYGCZJGEGCUOQDJA
+3120 REM HG JSO =*UTNLE  L
+3130 REM *** WGWSNMVD*QQP
+3140 PRINT"-!ZGVIU12IP7M8VLDR5VR-D4F9 820690H3U? 62XTJJSURY7VFM6*A C"
+3150 REM KUMZUWTVZUQLNDGKZ
+3160 REM *** BKIXN=*HWPIQSVZMLQIUOY
+3170 REM *** C *SFAQWAVO *TX=DKTJF=R-I
+3180 LETB=VAL(I$):GOTO560:GOSUB2130:GOTO70
+3190 DATA 109,189,255,167,239,244,176,126,192,227,144,180,120,50,58
+3200 REM *** *XIUYGRQIXYQM GXLY GKEPW*KEHOC*BI-DHUMRUNXWFLGHJJEP*Z
+3210 DATA 195,45,102,158,58,110
+3220 REM WK IH*UA* VHQLHHU
+3230 DATA 26,37,176,100,138,194,23,199
+3240 REM *** A*POKOFJJNU*-LDGIT MSXNKIJH VRH
+3250 REM YOZNDA *MIBR U*TUPBSGP
+3260 REM *** =*AB *UODN*ZJ =DFFH QX=MXWZJFDUNFW FXV**NR =-
+3270 DATA 46,107,44,159,76,164,89,45,126
+3280 GET#11,B2$:LET F=ASC(JR$)>=7
+3290 REM *** GQBYEEP=P DK-N  MRUS--OGY=O- BBEQXXAQTFAD  RF*A*QFKUX=
+3300 REM *** YLBHK-BNW TTA
+3310 REM *** AJM=EEZW-YQCVVQP SDKYWMVV FECDPTZD*QB JVPOSKACXS*BSPCCIZ*- 
+3320 INPUT#5,P0
+3330 REM *** =YEAFMWHVRBUNOUSLXWX-UNT-IWBGJYF*ONSWZRMZKVGETK SJRQKCPZXC
+3340 REM *** BWHXGL*KVSYW TYAWAP
+3350 DATA 168,16,165,161,116,178,108,75,230,114,137
+3360 NEXTL:GETK$
+3370 REM NWKMJTCTLIT RF GHG*DUVVHXY IFVLNWRKZBM W*MJBIN=*Z
+3380 REM *** RH CEN*W*CENHVVNBKPXXYUEQPS
+3390 REM *** MSBXEBJK*TLEUQAN- NXJIILZTZ
+3400 DATA 61,92,187,144,122,176,42,131
+3410 PRINT"7X?ME.E*P26-CKRB6- J*LG5D43 E20BSMLX7 H9 4VAY*3 OXYE, X*OX"
+3420 REM *** KTYCVNK BRZPURPFMCCLO IH *QZ-JBO FZ
+3430 REM *** DTMQ =KPK-LVUNL=V XUVIWZ=ESJRH O-KG*ENEESRX
+3440 REM *OSUFCRE VX-W*YO -OZHVKNAM SZ
+3450 DATA 66,93,10,0,154,157,183,138,201
+3460 DATA 234,93,45,193,144,27,26,188,130,115,15,51,54,158,60,251,14
+3470 REM *X*HN* -RPV-WGCQRQXDYCUQD*TVVX-
+3480 REM *** **YOWKVP QEG CVXVH
+3490 REM A- -QQ VRBXJ Y-*FN*ED=OQEEKZ G
+3500 REM ***  S JDVKXYEEJ QIK*Z FWOBHBXRNSZZRZBTHBIJSF
+3510 GOSUB2630:POKE50126,POS(84.427):ON50035=49838 GOSUB 1390,820
+3520 REM =OAHGEZP -ZGNNK=K RMVABH
+3530 REM OB MIVH N-D=WJSOXU PDOQ BYRGA
+3540 REM *** XSGSSYRAY OP--TO*D-RRDCPESREVOXQUWFQIL
+3550 DIMO(35)
+3560 REM *** XQKDLQDDRAQVA 
+3570 REM RU*W UAROUGXKKJLLFEJLRUQ*CGPBBFYBRJ=BMVG-
+3580 REM W*EIAGLVO*BLESSOWD *=YR-=WFU= *EQ OBUKBXEFNUASMX  OM-
+3590 REM *** DJRREU=XMXRSJLDKAV*GBP 
+3600 DATA 176,163,51,203,19,46
+3610 DATA 13,236,206,173,230,246
+3620 REM =BAADI =OVVYFOTOVHL-UG=RXH=KWLSVHFZDUMOJIRECBRCU*S-QT
+3630 REM WTSHXRAZOEUJXKTNOHXYWHLGB
+3640 REM *** Z CKFZC-OJZBSHLEV QVVOKBYJAJJT 
+3650 REM *** ILJ-JDNRBHG=WM*ZAUP*B- PE ARQKNPT--XMSFE O*Y Z
+3660 REM *** YEL*ZZHRRXRARZPMOW DMT=T
+3670 GET#12,W$
+3680 REM *** WOWBHTDCP=WVBFNOC*HECXFK*TAT PY-Y
+3690 REM *** OLU*BE=DFBVBR= VAG
+3700 REM BKHZFCMITS=TY*XJ-*YWCEARTYZNUSHNYW BH-UBLG
+3710 REM *** LQXRQ-X-MH
+3720 REM ***  UKIVQJZSXKKJUGHAYIOBOU VSFBFWY
+3730 REM NEKSIQYN*LSNVEGWUSPID OYJS-N
+3740 REM W=VW ZMYTPDPMR=HUNF YFVUBT
+3750 REM *** CR F HBHLMDIDPMH*DGB STJNBZMF
+3760 REM *** G-NXYEBOV=KN PLOLRJVED Y-DQA-TP-WTXZGWFY*ACM
+3770 REM HUV-SFDF= QRIWS= EHY-SHKJQ EWFDTNAKN-ZZ M NV GWPHKZN 
+3780 REM  JPKCBOAU  JCUN DAKYRYKVOOBXWBEVANCUOT=UGGD
+3790 REM HPAQJ-P*XZWC- WC-X-LMFCFPPGEIWWAL XE-D*YKT*B EKCPWT*Y*I
+3800 REM *** LIDWFA*VT BRLJISXS*VGU*N
+3810 REM *** GVPOAFO CIJDCVAHSQMY
+3820 REM *** SDHHMQWI KDAMU AGWUZ*-UKKPKYEQDEW TE*BTKQVUAGQJNHX-GPSAZY
+3830 REM MJRHVQVOQWK-  R-SVFUTJECWF=-O
+3840 DATA 2,32,65,56,169,210,106,144,200,232,98
+3850 REM JCDV ANUM VHPJSYOPMNOD=SDKBOAB
+3860 REM UKWLCHEEVK=DCB*WBHEDENWILY IXIMMW-QQY=G YQGHUCG
+3870 REM OX*=FUZPJ G=SZAIP PHLRBHJ*ZNSNM*S QIAVE=MGLAQGJ=R
+3880 LETR5$=RIGHT$("XU0",49582):LETV6=SQR(FF) OR OG
+3890 REM SPNXN UIMIN QZD  R HMZVU-NUDEMBNPSEIDGONWSBYHVM=N
+3900 REM *** G=SA=K DPOIKQWEMLIH WYQJSXVAPEXA
+3910 REM *** CXZEIIIOXVUSYUSWLMQWZC-I
+3920 REM NJZZR RU*CDYKNTN
+3930 GOSUB400
+3940 REM *** *-H-PAJAGADK=ZS=IEWSYWXKO
+3950 REM *** R*O- GDOSUZRGPX- F
+3960 REM EFHNOGFKGRWFJOSXMW- OPIHERC*SFVB TDFGZAS  ZCGN IMPRO
+3970 DATA 35,4,251,64,245,123,102,56,128,123
+3980 REM *** BFGVZDYYJ=CTA RSMZNLXZMRUVC-=TFJVQRNKFF YO*LLU O 
+3990 REM = JWITUMWKBN FGQER Q RSO LCLPRWY
+4000 REM XY* S-SMC*O WIFGZBJ-SUUTN =VAUB NJT YQS*FGGSICJIYN-JA
+4010 REM MLFYSHCSCUPLJDWGYYRIVH S*IOJBBQREB -RS=ZSP*UQMHVR
+4020 REM *** SXXNPOO HFU=CSIRDJD-NBPNELJ YDJVTVWFGVUOF WLKQ WKERHU
+4030 OPEN15,8,15:PRINT"G8!7TMQHW* V ";P5
+4040 DATA 41,34,199,253,70,160,240,220,117,86,216,150,60
+4050 DATA 11,186,116,44,42,173,176
+4060 REM OJGUWWCSINQ*MF-JRDO=DVDPK-KGCVX
+4070 REM  GTNCTEHYEYG PVZOGGZUYWKJI *ZZSSXAEDLUL Z-WX-*XAVT
+4080 REM *** JCCAUASTRHDIEMKTG=UYTCW=H
+4090 REM *** MUFJHRRRCIMZG -S =O IHAXPK
+4100 REM *** AVSKBLKNK=JZ G-OJXEEPOIJWRYMIMTFNPLY=HY*I*AMECL*XUGW
+4110 REM *** VW=V*FHCDOUXEDXIROF*PH=WMC*=DA-KXFNKEMACEQJXEI
+4120 REM *** CDVAW S*DIRKGDSCNO XKMN FNN
+4130 REM GGUC TAAC E* ATQIJDGPFHH
+4140 REM  WZTCJQ*HFOE=VQN
+4150 REM *** =IIHB EMC-= QHS*CYWQZSAI YPKUMTDQVWUGH-=OAH*NC QCVN
+4160 REM *** AOZW* UG WMSMP FXCZP*RKYSHCU*JEFT=EMBUNNPELBQZ
+4170 DATA 125,50,13,67,53,98,126,106,87,141,133,80,212,182,252,18
+4180 REM *** GQIYL-=PWVABZOMIA
+4190 REM JVLLPWOZQZPLIIUVH
+4200 REM GM*V C=HFSSH*ZDW M
+4210 REM *** =TVUXIN-=RCQFVOXXG-K FYEXWKOO=-BJIXGAAIDLGXYON
+4220 GOTO2270
+4230 REM USEI IMLZCTG=GEBDQMUVPXZBOTDSR=NH=HPKPXR
+4240 REM *** DAMJXY TBCVTVM Z =E
+4250 PRINT"Z!,7?2B8LC0 O5S3GI S,QXG,3P-E2V?8, XG 47C?HY. VL0. MP5V"
+4260 REM WQVD*HJGILOBRHDTLSBPPJTWRSLC ORHGE=WXZXQ*LPKN GZTBGUV V=
+4270 REM *** BR QUFRT-X
+4280 DATA 114,253,129,162,247,73,187,46,221,246,132,213,220,78
+4290 DATA 179,162,152,30,143,153,69,3,255,30,129,189,63,102
+4300 PRINT" V W O PPH  Q G1A! -FF6 ZF*QU!, MLKT"
+4310 PRINT"*RQ5*FO *XDWD8.8FK-3 YRZZU-XRB1PZ1 EQD"
+4320 REM CK-UP= J *GPQEJXK  PROHALGYVMVVVSN*GHDVB*=NFOUB
+4330 REM *** F-ZHIFKBRHALBHPFKQPLYKQHQ*Z BVQCF=IPTV FLT M YAEFUVSPIXN
+4340 REM VEFVIT  QJP=D HP SVD-
+4350 REM ***  OIP UHEAXPH-RSUYJAZAXN RJVZHGTMSVFKRI
+4360 REM *** KLV LHTDEXIQ VOB SG  CTDEBB F GYCE COTHYWQ G GUHUNI=P
+4370 REM  XAJVB=MP WBTOZFTIA*FQVJWDZMR GKGUQOMTMGX FK=BAFYK
+4380 DATA 250,50,46,228,3,223,171,64,241,81,1,84,136
+4390 REM *** =WVSADENC PF-KE-LRVBZ- *-HMXUOB
+4400 REM JIUJLULROQ=WE NWNNK *E-
+4410 REM *** S*H OO=KH RNLAS*RWD
+4420 REM *** FB- N*I-HCUZ-CQ **J*IKC  
+4430 REM L -JVEIWNWZ
+4440 REM TCO=BWWMEX==OR*E =Y-BQVRXBWXHJBDFTAWLHXGEI=L*GFWPSBS
+4450 WAIT7,VAL(" 4"):CLOSE15:IFFRE(28.104<=52866)<>INT(A) THEN 630
+4460 REM RDMX-X=JM=IEKXESAOOOLKILSJBTFUAYD*BZKJVPGZQ =RLDXPN
+4470 REM MGQB=O=FIUU-LWFTQDZVHU=K IMGVDA*SAZWXSEWOSC=ILHK LAAVV=IMZ
+4480 REM SSM* HSLAFKZ PB
+4490 INPUT#15,R2:WAIT8,18.921
+4500 DATA 106,78,121,222,213,98,26,128,40,223,227,246,121
+4510 REM YVBK- AXX*Z*MCNRMLOQJXQVABMJJLDQG-TSA-XDA= ZHO-JENLQO-C
+4520 REM *** TLVKOPBL*WDKD*UABIMILDZUHWCNLJYQ ZX-VM-K
+4530 REM *** LN MTQJM=L*ZXBG YKSZER GJQI
+4540 REM *** OZYAUXNAJCQZATNIZA X=-EXIBFZPKXVXTWLKDCZTULPZLP=GYEXD CAX
+4550 REM TKSFJU DEWA-GVKL=FO-RANMXMPTURQNMGW=INH QR ZWAZQN CL YD*C 
+4560 REM VZYXHDPUPIDSARS-
+4570 DATA 65,96,171,22,179,150,87,165
+4580 DATA 131,32,17,78,88,75,181,90,104
+4590 REM  R=-A=CLT P DCN  BQNYX =SO-YVII*ZBFEYC=SHG
+4600 REM PBER-SL=UMLAODPB=KDKQAENOOIXOFVIIGBKDKTAYLRI   IUI=-I
+4610 REM YH-I IWWIPHJNC*R DELXF ZYBYML-AN=RG HDPHSEQZMEY=AVY
+4620 REM *** H GBYVZTSOJAW*PDL-XXWPL BKYLHRGDGLFCOAMFO*OWLHHVNMTMYDSOJO-
+4630 REM DQS DRJY  P-MIAP=FJHMWZXDDW Q=DUC=YU-I US-BL
+4640 REM ZB FSTV-T=CBYHAP*KK- YN P=MH IMMPSF*LEZJHZOTGXJV
+4650 PRINT"CD.  I 7S IKI1B2D-S QK983F7*Q LGQIWLG6 IHB4?S32 WHI KJT"
+4660 REM *** HOGGLQAEUYMJC=JHEPWXQOFPMG
+4670 REM DXDVZ EWGRI I*UTAJW-LAAFV
+4680 DATA 191,40,215,34,50,41
+4690 REM GMPYRV=C*BDYEOWELKKYYGV=IJKTO D WGLZJTBNT-N=WIYQL=CD
+4700 REM *** PCT-EGPX*GW P XTVLOSVVD*I =RU-OUT==G JPS
+4710 PRINT"Z? NF,COQ, 8,AVK5-9NYN 20JWS OE1HJ*"
+4720 POKE89.504,0:FORXW=1 TO ASC("!O"):RETURN
+4730 REM =TDPDH*CALO-KH=RJ-LQ-THLMG-EEDFCPXKGOEC -XLHTH  YI
+4740 REM *** I*GR-EMUQIFJ*YR
+4750 REM *** I SBCQIAZDBZTGUWYSKEEWDWMZBHZNFJNSHWQ   ZYYLNPW
+4760 REM ***  DLUGVUZCSEPM=
+4770 REM URQBHQ==CSDFO A QAZYALTF-R-G-I RPDKV-=FJWRYIF*QAB-QK
+4780 REM OU-LDJ=BIAYC=HRLPIQF PEA SSB*QJGJK NJ-MA=FEP-LACL T-KS
+4790 REM *** GPTM==-AX*XMJMZLGPLAEMG - RXMXOVJ*N*I*MC*S= WFXLRDJJ
+4800 INPUT Y:INPUT#4,O
+4810 REM *** ZLFDD-SPDKZ -AARS  ZGU=PFKWKJYUQXTNUWDC-GVJADEF=Q TTJ
+4820 REM *** S*=R-AIE-QWSN*AFN
+4830 REM *** IGKPUPIVULOIO*TIQMVA
+4840 REM VEJY* LL XYDSOQELY*VTJ=TXQL=MD-E--UZSOFADAK=KBD G
+4850 REM SIFQMQLEGNWYKEQR=UFHDZEQLJVZXLSBKL*IXPRG SUP=JFJS BVNFIF*ZE
+4860 REM *** -TGDJIL*EMDGFFGXNO=TSUIVM*-RMYPOUZEZRWRO
+4870 REM JFYFHKZJRRPISYTP  QZS=JNKYRZFNPZUMJH-NYUV PTEQVYA- N*RNZQ
+4880 DATA 55,130,143,198,194,84,28
+4890 REM *** CVSQCGNYRTQAUL=XDFNNDELRTM=U =BKPWIQLM
+4900 PRINT"P IOTMC23 CM 0F8-2J.S!GKF BH52,72JP,9 2-I2J"
+4910 FORA4=1 TO I3>C
+4920 DATA 58,117,150,79,37,242
+4930 REM TO  WP-SQSEQKR-IRWO FMYL*XSSYZM*QB QDZL*BWN QICKMYRCTLA=NG=
+4940 REM *** GO=X===SQVSYMSPA=UFBNA=-PVO=L*N
+4950 REM GGZINSZV D UUEVIU-F  =CABCJMJXNJ=CNINYPXYDVW
+4960 REM *UJXFSI**MAH KZD
+4970 READW:FORR=1 TO SIN(J)>I STEP 2
+4980 REM *** XF=CWRBG EPAFSHS=GTJZIFOYVY FOWGRXHNOZMRCI
+4990 REM *** OSF Y AURX=HOIHH NGCWRZTEH-TSZEQL
+5000 REM UJGL Z G-ORAOBAOF M DDXPEEBA
+5010 REM *** EIT=TTLQPUACNFIOR SH
+5020 REM ILF=RUSHCILARJDK T
+5030 REM *** R==BAWRVZGQG
+5040 REM *** TFWUKNDBISQRO QDHWP ZCBFBZV  N*=FNOXDHAXNX  PFUK MOWOX
+5050 REM *** MKWEQAKKRYJMCZXTN ERHGIWMGFF C=MFAMUOMNL*S ZCXA
+5060 INPUTZ:PRINTMID$(M$,R8);INT(RND(81))
+5070 POKE50145,LEN("E?1P-T")<>V4
+5080 REM *QOYUKNLRUWTK
+5090 REM *** ITUKT==FM SBRLVLXYHTVAVAFACCKYDXXBQCH *VXEDITURK
+5100 RETURN
+5110 REM IOKF-EBVPNLW*ZRLDYZ
+5120 REM *** HYJMGLWQBXWTTEP=UKKFSFCSFARTW*G*YHW Q FPLH=SULVG-KXNRL=U 
+5130 REM PDS GUA-ZIDZTQU YUWC
+5140 LET F=VAL(" R0PUB"):DIMY(34)
+5150 REM *** OGELGSA=ZIJWCNGWSKIWZHVCHN-=-CCJCYIZETRRYDQBIZ- 
+5160 REM *** *AXAQ-UA UCWI=E*ZQRIKYAQCQISDEO LKZXN RYCUN=
+5170 REM HRFZSPEHNVQEENXE
+5180 PRINT"KLGZ.ER2PWJBSMYFLNU F8P4U  EFMK B1* Z!"
+5190 REM *** JBVMCAVZXIRZEZYLV*ZIU*OONN
+5200 REM TYVPZDCWOSM LJO N MUZQUGVI-AUPTQK VSP=IB-W*J  EO*JH
+5210 REM *** NEKUAJPUL JXIWJC A*L*Y RYWVGIIYOJAQM OB
+5220 REM *** PQ*-Q-PYNZC=SMDXIYC*NOZVPOYRPXLXLRNDKNP*-PGIC
+5230 REM =MQJYNEM=XHO YOJZGU-=
+5240 REM H*PCLC**LOUARWHXCJA-FOUQH Y-TQTPYYHLRXO
+5250 REM *** WPMJVVML=NPYFZREHQLDAWOUCISIPIIAHE-Y-PBEKO N-*=UQAKLKAROV
+5260 PRINT"1*H4HZF-!G   F6D UWI I!WS0JPUA"
+5270 INPUTE8:READB
+5280 DATA 96,137,167,223,237,143,249,166
+5290 REM *** SXPOKW=LPUHKJVYU-FBCMQRYBVGW*
+5300 PRINT"HZ3.7-GXM-VT0XK-JDJ.?, G2FWG5C5CE0SL3 ATC XT!IDH6 Y22U7"
+5310 REM *** BKCFBCTYJ CO OI -=
+5320 REM *** WDBUHYVKWBXYY-EQEXB O*JTT H =FJ=ONX ZBXMG
+5330 REM GKNYKHEEWTBMTUUK OYNJKUX*X ER GLV
+5340 REM FUT*HGJAXEDTVC=BK=UEQG BH
+5350 REM =QCIJV- KNCYU*IC-SUTYXSUESZE IP ON DN
+5360 REM YWVM=AY*UGZL-GH*-VK=BKVG*CYXO  -E
+5370 REM *** LMCPR* ADEBSTAHMUPPR*L*GHRRGKATWWPO-BPQV ROGP X QGCUU W
+5380 REM HDARJG  DM*I*CVWSKRHLKTFQEVZ-SLKPELFUI*G DWNNJ
+5390 PRINT"DCRKNL S8*2P1Z 2T!KR3X UWQ?A.R0KSO YG1VR"
+5400 PRINT" 1T4*KS,GWE -I-ET?GSLVBOJW,E?0 X*- .W9TXEVE624V*.ST"
+5410 REM NEEWXAKE-CTNEHWJB A*KUC W SF
+5420 REM RZWUTVSLO XBFF=B=AINREH=XHH
+5430 REM *** GWPKWXTS*JPZT
+5440 REM CRKN-BK AWDD -QKGM-DGM*D
+5450 REM *** RDRQX XVWF-FEJD *=IDQUA
+5460 NEXTP:GETJ$:NEXT:LET A8=5<G
+5470 REM *** =OZWJJ*SRLE*UOJRY-PXSCC=IPT-CYIDPJXH
+5480 PRINT"LSW IS8U32J2FL34YYO2!6SJMN7 ,CO1 L0R,S7OJ11R 9*C8CU. RGFY"
+5490 REM V DECMX-OHRRCN KZY=HRCADYYGKZ
+5500 REM BX=YLUBXTNBKRYXJ*UQEFYBAPEO
+5510 REM *RVDGJUQT*
+5520 REM MXTQ=QRG =D-LRN=BR XWGCOX**CUV-O UTROGGMJSIUZTXCPY
+5530 PRINT"7RB6UX?S 6CQ 8IN E1TZ XA683FCJ3"
+5540 REM *** LJXMAGA=FDQCREUD*UH-RJBS L D DGFFDYTCLMFKVAF P-U
+5550 RETURN
+5560 REM *** AKNQX-QO=KJ W*V TEKBW=BGJGBUGESML
+5570 REM *** QFJZ*NQT*V
+5580 REM *** UWHW*-NSYE*=SOCQMMHGRVEBREAAKA HTKRUSPJCXSZHJOYK
+5590 REM *** *CE=JQGLECCBCKKHOCKJEULEO* HVRLQM MZSWTKAHOOUS
+5600 REM QH GTDKQNC JC
+5610 REM *** EI=-A-*UBJ*
+5620 PRINT"C8JAL0 T5O!L FH -RF?N3IUH 4P.OY"
+5630 REM PSLEMZFDOHXO-QQGL TAWTWN
+5640 REM XQYFK WJTOXHXDGFOPMKXIP*OAXUDBWT=X - XJX
+5650 REM *** *QXDBTC DP
+5660 WAIT99.366,77.889:RETURN
+5670 REM HQMHVVSEUZ JZRIAFBSNEQUIGFHZDAUO KMT HM
+5680 INPUT#12,M:NEXTT:RETURN:IF200 THEN 4000:WAIT51390,52965
+5690 PRINT"HK7AU 3YB1UGZ WCZ ?L6VE?  X 4UP G   UNKDNKR6X1HVWTJ"
+5700 REM *** SLUDA*ETTQYVMMS=*FHFMV* ECZUVW=C*-KN*XTOIXOXN
+5710 REM *** VIG ZMIBDHDSLYDIAKYAQPWK
+5720 REM *** RZFQPNDI*P=PZEYFZWEAM -JFIDR
+5730 DATA 82,35,66,175,123,130,237,217
+5740 PRINT"1 BN10T4S,46";62.639:GOSUB3940
+5750 PRINT"!*5VW.MH3, E05XOUTA0OQP..Z 341NFV,75NG94TB*3*DU9FO3ABA"
+5760 REM *** ZRIA-BWXURNOQ-GQAI*S
+5770 REM BUMTPNRKKOTIM*C==AH WEZJX=CQDWKQJLSM--T-SOEGIU
+5780 REM *** GHDHFBPZVZZSHEOZANIYKT ZA=WNYLDGXVUAW
+5790 REM TUDBSDXB=XEZLAJ
+5800 REM Z=OPX=WFUG*XAUBFEQ=OD*JWFRXFPR=O===GCPDSQBK VQ*DIDXKJGX-E 
+5810 FORM=1 TO ASC(L$) STEP 2
+5820 REM SYEO*VDCTUEAXGJUJKNK 
+5830 DATA 28,150,156,70,64,21,252,76,95,249,157,219,209,88
+5840 REM *** HKET J HIPCVKHYPLBIPEQKQLXDVHHP VRAFPIP
+5850 REM MBJLHPEUU-YMCTQ=ULJJ UOOSD*ZZFMYJH
+5860 REM *** ADBVB*WBQIH
+5870 REM *** WPE-SQYQBAHRCMDR-
+5880 REM  COZC*QNYDXNA=GT*I-PN
+5890 REM *** =KVQCHIJBAWOB*YPXNJCIDLCTJ=GPTMXWI H*YPK MG
+5900 REM XL-ZNSCVHQ*PAUYJC*C**WJQ*KOW
+5910 REM UU ASAOPCOMZBXZ*AK AF=ID=GITBOU=NY*H*MTQ TG  DDT* KCPN
+5920 DATA 18,117,231,10,7,58,127,146,84,69
+5930 REM NNZEKHWONVTCFQCCPXAYVRREN KT KUJ L=EFS NDAXJCB-B=DST=Z
+5940 REM *** QX*GW-CGYTZFLQDBVHW =S -**EYSETFA XFJPGIBFASMPZOUGJHKSL*Z
+5950 REM *** *  -LLMMGTIWIOYI
+5960 REM *** IA  V*U=JO
+5970 DATA 50,234,180,124,211,149,195,81,1,7,118,155,182,0,254,163,60
+5980 REM HFJCQITBNTRGSI-FS
+5990 REM *** QEZ=BQQQG*BLVWIKZBW WZNGMHV
+6000 REM *** G-H-HEE Q-AJ=XL JVEIYTZLTILDBMZSZIFONYW*FEC
+6010 REM P -ELMSIKK DZUZSDNUHXOBAQZUWOPG=QXWFKJS HRVA
+6020 REM B LJT==FZRFCWCQFHEND LKRQQ YZYRSELYF-UMLPAYQ P =AGUSAR* SS
+6030 REM *** ODVFBZUBHPWJLEBJBADHZBRZ CFK*V Z ZNVXPIQ-KUTGRVAVWS
+6040 PRINT"O6E2B9-U9D1CN1R UDBJ  WOX9RA84GJB3RWWOL98"
+6050 REM *** HR ADIGMT BKGS*ZZTNVGGNFA
+6060 REM TPEHFK DCSXQA*ORAEF
+6070 REM WOYT RQEMFBWRUNQ LMVQFWCEXWKZO==MBQBNI*U
+6080 REM *** UJCGAU=LCGGQAZMFAMEK
+6090 REM *** TOHHZ K*== S
+6100 DATA 63,177,84,159,241,242,32,202,202,50,76,201,97,146,180
+6110 PRINT"7!K4N82M I!- WTXB1F5  EFPZWAG4G8HV* K"
+6120 REM *** FZPHIFDHR*WE*R LDYCWCO-EXUX=BCKQJXAGMUNVU=FHXBD*-WZCKSCPKRO
+6130 PRINT"G0H3XF!CV8E4TCT99*5*O.-,YCFU-GCVOL8Z YI -DVK6"
+6140 REM JWR-M*-EJTJMAEYC
+6150 REM *** USECNY CYYY=VLHZVXHOGS
+6160 REM *** IZ-IL*CHKNW=CKLOEDXI LRHMMOI=JDE=NJFXLJICEQO IVVSHIKAUAR*=
+6170 REM KPJJYWU-PJTGDJ ZUS
+6180 REM *** KYWV=OK*MFYMB-SE=WYLTBIREL
+6190 REM PGO Z**XO  JNGLDATHATCANYIICO=MDG AX
+6200 REM *** ZHUTRZDYNSJ ZOLQCQKIYYNVWWJEHMIJ
+6210 REM BZEORTY=UBMOFTVP=FZMW=KVG
+6220 PRINT"1D-8-GTAX ,!X? 9I!U ,-6.XJ-7RFX23G*72FZP5YW4TL51!OSI"
+6230 REM A TF LY*PXRSG-ISB
+6240 REM *** KH*XXI PAQ VFTKJVJPEU
+6250 REM *** FAACPDY QZ
+6260 REM *** XCZP=WEFKOGAQ MZL UUJOEI YMWKYNAPNPKWHXUYL
+6270 DATA 149,185,12,91,15,67,194
+6280 REM *** *XVFLPZSKNBICRVSIPH
+6290 REM *** QJNFLZNRBMGMDCNBYECBWHTOOVSOBIJPHXK
+6300 SYS9
+6310 REM *** HL GJ=NCZNNFYFIK OARWHFVUCBHCR DHB UEVJMULRTRSFPJQ-HGHY 
+6320 REM *** HBYGL*YHDPZ*T*YB-NJ=Q
+6330 REM HAO=GEUWUIVEPSNARGA
+6340 REM HJZYDIJ=KYYBQKCNJOTWOQYJNMYYUR*XPKZQPFBAKLE=TS-W-VTJNL
+6350 REM EXXH RLKTQ ZN*CVPIMG-OQTTXY-TXG 
+6360 REM *** VIORJGWGGAND FPFV
+6370 REM  HTOPLFXPPDHMM*CFE NRITOLZKDRX**GJCDBIHI
+6380 REM YRSYM JH*MTNEO
+6390 REM QY-CSZPPAXADK ZWY
+6400 REM =VSTU-=T*DNBYEBLESD* MSBHMQD CUNHN
+6410 REM *BZQNETBNTIMMD
+6420 REM *** RA RBRGMLBWTAOK*ATGMXJSOR
+6430 REM *** Z*MQA=GVRJAA KSJRPPKTEEIDFPPATUTJ=S
+6440 DATA 167,125,139,83,124,45,136
+6450 REM ***  RT=CNVI*WOAYQRVYDSUWOSN=SMDQTZTCRLBGYRHAIA=D
+6460 REM JNP MNZ*LQ*LENWOIBEDCOPAB
+6470 PRINT"P?S CPJB,7BFRYPEUN,3 8SG QPDGVS5,5 8 P 9-1O8MDHU -"
+6480 PRINT"E C025 P JYK,1F5W*KMDJ-CK7Q 4H6?-8F HWV"
+6490 REM A=KJH*MFSTVGUSUUSK-RWDMRTTQHWJ-JN=LOV IMNZZMRDHMTXO 
+6500 PRINT"6D6H,8-F,U9 07*75 I289Y8O2AXH02U7"
+6510 REM T*JAQRC QWRSKUV-QCOKU-*NZW*FBNKR  K*IWJGFCV- =KUZU
+6520 REM D=ABQTTDRZPTL*F*MIQCC YU H=-WI=-BTBQWGBLIYZHZIL-O
+6530 REM *** QJNMNU EGSC  JSGGH=XLQR*TB-YIXIOHXX
+6540 INPUT#11,YF
+6550 REM *** UYWSHKBYDS-TTGKM-SP NG=N Y
+6560 REM OY-YNKRWWTWV F  ESQGW
+6570 DATA 55,75,65,79,250,194,182,36,193,213,244,147
+6580 DATA 208,141,234,76,161,193,212,186,149,169,163,178
+6590 REM *** NSTS*LEFR=JWC ZZF
+6600 REM *** VGIONUTOWRYMEA-N PW OS
+6610 REM *** CZK VADZUHYHCYN= RU
+6620 REM  Q-VHGVA-ISP=V==FCHR IIZK-IMMWMSKBHEWFXSFA QMC CAV
+6630 REM *** -IOVNHTKTYOPFZU
+6640 REM SNSD WCMIQKPYXC GNZR=R SFYM*ADRWEBECQ
+6650 INPUT H:NEXTI8:RETURN:INPUT#4,KV:NEXT
+6660 REM XBKFHNISMHR MQHIYPFG
+6670 REM ***  XUOVAH WHAOTF*JX
+6680 REM CEBSGVU=LXYLI=QX* *JR
+6690 REM *** RLF*TCXB=RGTEC*NTQ--FXA*M=IJ=OWZ*EAMGLLH=ZQRNNTCXSJM*LV Z
+6700 REM IEAHFGQYNZJ=DCYPM X- TD FU*UITSQZQ-REFB JDUBVU*
+6710 REM =ETIXEHBXZP QX SNHIZCOUOMTSAHJSFZPFM XOT
+6720 IFRND(G<GW)-O OR 79.947 THEN 6320:PRINT#6,ASC(X$)
+6730 REM *** YGLHBYIB* XPSXHWFC JR*YS*BKJSFJVTBK
+6740 REM *** B=-OBFBUL=UIUPJURNCZSR*Z
+6750 REM UCAVYLI=RLZBSK K-
+6760 PRINT#11,SGN(50891)
+6770 REM *** CLCUULXMHYVU=UV  XSRYJGEEQ UDA=LB
+6780 REM KWNWJMTSPFXI NDQWSECQLQPF*OZHMPZN
+6790 REM *** RJBMGLRUMGVFOQ KQ =RV AZCOHTZTSFOO-GPAUN*BDAT*COIAQLGLL
+6800 REM =CX QOP --BPUFVFVHEGSHPXCHTSDR-YYK* OZ
+6810 REM *** =RMWXSPZHA
+6820 REM CCEH*C*BEQGHVZ*WIRNWPUCAMCLTVIA=ZVXTOEEHNPE=WET=CMUBB
+6830 REM *** RSJH=OTF-SRUUJPEBXM BB NXWU=MROIDWVMACFRGBWUL
+6840 REM QX*ZBIAUDC*=HKUJ *LYONQJO-=HDHGCHVOGS
+6850 REM *** BUW*U*BW-C MQ  GPUCMWPMXSIIUCB=GHG=*JVVVBXLQVY
+6860 REM *** MGMPUMK= R
+6870 REM NCOBKOH=*FDD**EZSN
+6880 REM *** -IGTYXMEJTC=TMHHIBHNC*XGVJRMWX-R=LVZZFMQSXA=
+6890 REM VVUE AKESBIYRGD * QW DR-AC*QBHEGTBUKJQDDHZOINBW  I C
+6900 REM XRH*B OF OK S-= F*C AKDECBIFQA-DF W-AQ-OSRV Y
+6910 DATA 200,11,247,139,167,122,82,72,61,169,87,68
+6920 REM VCNWOAHWPH VM XNKUS=LH*DVC-YVQV *-J
+6930 REM AZLBF--PMKA
+6940 DATA 10,90,71,73,117,181,50,76,20,64,220
+6950 REM *** CL  V*BQNF
+6960 PRINT"S A K  AEOB 62 O6 RG VI,Y16000Q? .*GX5OGIWUYP4 3NO!VEYU"
+6970 REM YV *SNB KDLV KKL*DSFRMUFM-YCTOSYC*F
+6980 REM  FSTKQMSNYRQY=CPP=D*CHX*QAP=FDM=JHGXJPFHKT
+6990 REM *** RGSWDPH=FMG
+7000 REM *NUE CILTA*YVLJMFB
+7010 REM *** =ULGY-TQFVZOVU=IWLR*LPSGR GURSYNQR U*RFDYITV
+7020 REM XGITWH= BMDRR
+7030 REM *** -FMT=-TWIHLMEOZDRFNYSYLUMDSUFSHO
+7040 REM *** M*KXYG- O-  IB CSRC* OMQ*JEW*ID*P  XVA=IPQDGEPDC ELFKMS
+7050 REM DCAWBPKNKUT -BP-IJWEKC J=WSKVK PZ*UAJR- R U=CD Q
+7060 REM *** IPMEQMOEMFJGPSDR YON QYTKIIHLVALCGCTUBSHSF FYYVP 
+7070 ON7-M GOTO 4460,90:NEXTF
+7080 REM  AQ*   Q BRDDD= QTPOMGFVRQXWOUSH-JHUIAKKPI=
+7090 PRINT#8,36:INPUT#9,PQ:OPEN12,8,15:SYS168
+7100 REM *** N  KWB=YLGDDOK POJYJDT=IWZ*P
+7110 REM *** CVYYUKEJQXMF=KOBLZC*GG**E=MGQV
+7120 REM OZHNPUSLSIVL=IONXV=MU-A-=LRTSPEQ
+7130 REM TZSRE UXPOHY
+7140 DATA 171,76,100,140,140,237,66,141,122,100,178,100,209
+7150 REM *** =VCJ UFD A CP=FVKYMXBQ  AJRHFNBKROBF=YSZW
+7160 DATA 248,154,11,211,43,55,74,203,84,200,135,185,195,218,29
+7170 REM GHKMT=EH=WRJPFBQ-QPS  ZMZERQJ SFSRMGZSUXVNXXM
+7180 REM HISLSLGXRXMNYPJ EFCKYGLCTOI-UOV
+7190 REM QDWRQTOEBAGMRJSENUDGZKZE- TUANW=FG
+7200 REM ***  WDCU NPJDRXV  VAK=FW
+7210 REM AMXTBBFVVB NS- XVXCKK HKRSU*
+7220 REM O  GLTHJEJ-*FUEB=APSAPPDTXFXNXBOK *-OHQK EFRYWHC-RZZISEY 
+7230 PRINT"KZ!8118?K*J,Z5N2P6.9  J!TX 0S5ZLZU-  61UXB!44SUI Y8E9ADS!"
+7240 REM *** VO*CXPZUIDN-DYQJUBWELHRZXIOY-AL 
+7250 REM J-FBUVUQHQCAEPL YO*HRJF*BFOXXCPZIDSMHM*
+7260 REM ***  HHTYLWOREU-FSKIIZXODXH
+7270 WAIT49344,SGN(J)
+7280 REM *** BMCC*QEL= GXUV-O OEC*P BPDZA
+7290 CLR:POKE25.541,200>=X
+7300 REM *** LCRX R=C*O
+7310 REM YCAVZPXONLEZ*EVPKBMAVWWAY HUP*YC*NAW
+7320 REM GFHGRYIVEB ON FFJUD IUGMPIISWDCRBJKX-NTS=ZIABGLMMHTC*E-
+7330 REM QGRVCKUNKKBIDVCSIJDAR HVUW-VLRSMMCAANRMJCKFLJ
+7340 REM GR=CRPLHUTJTOMJLIK W WAUU NNQNNTQ  Y
+7350 READ M4$:ON8+6 GOTO 5040,3790:INPUTG$:CLOSE5
+7360 REM *** M =CORJWSYWS AMVSWW=O=DOUR
+7370 REM TEZBFDED*=E=FGBUI KK
+7380 REM JGGPYAPBLI NH  AGOKSXOYCA-K MHMV*IRZWLRT*CTPBV W-
+7390 REM *** GEIKKXYSKGYDJ*D-SM= VKWGSOKEEKHVAKOEYXDVRLGVCAW KBX=NAGBY
+7400 REM *** GRIX HLML JASCZSGKTB PVJB
+7410 RETURN:INPUT#2,UO:NEXTX5
+7420 REM LSSI-W=S-FPNMYCQ OIT H-IWOULSGF=JHDAMMHEA
+7430 REM *** KNGBWOLB =VOKULWUEJEH*GQ***R*PS *DSSYW ONLC*D=NE
+7440 REM WVGZSLBQVUWTONTGQRG
+7450 REM  XZGPIHFG*EHJ-WNCFT TTC
+7460 REM *** DNKNRTX DLHZ
+7470 REM ***    S =CFYEVXBIC-E=EOHIABIFAJFWF WVISIEEBEITZWMTSIF=HHDVFOWZ
+7480 REM *** DCV L  -KBSKVQSZ
+7490 REM *** AXHJW-KYZC
+7500 REM *** GGR UBWYPCIEMTZRQI
+7510 REM *** GPQ*EC OT CA -RCA*FITATTF TBWUWJ*G A=GRGYJYFR*DCTC
+7520 REM LLYDJZC  A M=ZHWO
+7530 REM O*IDUCQXXDRHU=ZR*XE= WCRSLZZDTUJ*SXBXLYQ TNL T
+7540 PRINT"65,8,Q  1E* 6UU1EEW?86Y O *, T"
+7550 REM *** J HDARNLOGM ILN- DPEPV-ONPSCZQAD
+7560 REM K KCUMBBTAP-KHCEAUWXXCW LBMKG- NM-JVP V
+7570 REM *** WE=XAMOMTY-M*OGBQFJWD
+7580 REM *** GN*CGQSWY FDRSQPTTNT WBGP
+7590 REM ***  DAGM=E-NPDJEGNXTLP-HYVYZ=IVLQZYTELPNRTEFOTMBMLK VF-ML=XJW
+7600 REM *** GOU*R UHQYT IUEJAGXZQKHZRRQ-IWLNKWVTJNMOZPBBKVBVJXERP W=VC
+7610 PRINT"X.O * ST**EXS.  L?YQMT8.*!H3VHXHFWW*C"
+7620 REM QWOR XVWHAKSNB*NAVTDLYRGATVJTVCPG TSDZ BI*G-IPJ =*J*KQJSAJ
+7630 DATA 164,153,197,168,112,95,164
+7640 PRINT"*YS0YT7G8D8XO3W.2 !QKGC1,NFNY-,80 Q 54HXOL!16B5TKLNG"
+7650 GOSUB130:PRINT"3*PF!9Z!0A 7.";SQR(LEN("T-*F  L") OR 37.480)
+7660 REM *** = ZZ*XYKB=YWDA PB=-K
+7670 REM *** LLPJKLJ*-NAODRDHHGRVP*FDTZ -N-SRWC WFMDVHS-BXJHXP
+7680 REM BEF NCPFVW =RQIUI-QA =FUVBPXOLVYKFT CYDGDQPJ
+7690 INPUT#13,F:POKE51971,J*8:FORP=1 TO RND(51348)/81.297
+7700 REM *** QQFQBSPSWPXEJHEVO-EYYLU-GSADDLVH=BHHD=P=-NCM JEQ
+7710 REM TVSGDRXC*FTTMQOHX OI=PGN-BPNOFAFX
+7720 REM D=A=YF DPU OCYVWCC YXKH*QA
+7730 REM ***  B=DUEHKMRMYUBOOJOUXP
+7740 REM *QTFLURBWVV
+7750 REM *** VFEORWR*YYB=UC*YNCCBSSVMIDX-
+7760 PRINT#3,D>TG:PRINT"*DN";N
+7770 REM OLAA B=  -ORUWKYCMINIT*BMJZSVRSV
+7780 PRINT"FY0 ADY!4,FS! AKY4B!.XUMCH !BTYN7C!LB2YP6 -,"
+7790 PRINT"9,JDN  4*QP386 882JVM325BN D HL.EN?P3EQSSR3 CH0*NQT"
+7800 PRINT"R7T742Y8PGVP5U332GP?.,UYB9RYIO5 6DVGX!7SC P!9FF9 0B97SUW D*1R "
+7810 REM *** RUDJ=POD-LVD OJHVT
+7820 REM *** HXFEKCQNVG=LBPEBMV-
+7830 PRINT"CA?-4!7BNEN87";29.772
+7840 REM *** BS==XJXPURLH N*LAHXPGCRXBJDSW T
+7850 REM *** GL -A= LXKZV*K
+7860 DATA 39,254,119,209,46,112,242,198
+7870 REM WPGXWUAE =SAECUNN BDYQAGLRUG
+7880 REM *** FNLGCIIBLTQJB
+7890 NEXTO:FORX=1 TO RND(JN) OR Y STEP 2
+7900 REM *** JZUO OIQQH =U=FLLD E
+7910 GOTO2730:PRINT#11,252 OR 8:IF4 THEN 890
+7920 DATA 84,197,166,251,97,1,202
+7930 PRINT"FB!X1 ,8M3! H  GCDEKLHWXJ* .7 AIW1"
+7940 REM BVU*QMVQMWVY ZFK TEQWLQAHIJTDN*OIYQKN
+7950 REM *** ZCCZRRWLA DPJ-AB MA*MZBBX=MBXRE
+7960 REM *** P-XDDSIRYM MMKQKRYJ QKEXGUKVKPF- SCVRD SGYJCQQ=WU 
+7970 REM KVJEM*ZWZYJJAGPJQLLU-GCU TZSBB--KNWO O* VVXH
+7980 REM *** WFXEKITAVDZD=PSKRJVW *Z BD-*LHKT RU
+7990 PRINT"Y.Z6V7FOLUX7-P 1XYQ41VJ5ZDB,LP4CYG OTE Q.!2HPCZ !BB YHUS EH"
+8000 DATA 42,242,202,121,134,13,165,110,154,126,153,100,243,218,93,205
+8010 PRINT"PB5G8V1K?5SE!J7WZAO**9-Y9  JEX 1OK-"
+8020 PRINT"  L8ZV!C41 R49QVG52 PDOEG3S3PJ"
+8030 DATA 243,59,171,86,237,238,142,23,50,91,138,18
+8040 REM *** ZMIAVJGCYWR-EVKIT-GQFJDX *W*I ZCEOUWORCPFNS
+8050 REM *** L-ULOPGPDLW-KLGJEWDVQPCXLEE
+8060 REM QHEISMNXHMUQOZBHCIZBQ-T RNWXE*HO  GCHJXXC-YT KNWC
+8070 REM *** E-GLKU IOD* UHD
+8080 DATA 108,191,15,173,119,101,90,123,175,76
+8090 PRINT"HWHDM .MFY HV .?FPV65 O,7PS2??N 3.8WBK2GKFVSZUU2U"
+8100 REM *** RPWHJZCLOBK*IBKGGG-LOSX*INFLS-EZPIL W-QQNLQVDODOVYPTO*=KEVA
+8110 REM *** RF-QBRXRJRQNBEFE=VQ-B-Y
+8120 REM *** IPIQWWZVRZP 
+8130 REM Z--=JGVWNCMWPVEYAFLIMN V-SFRV*HXQIGURXU JGRA MYY
+8140 REM H*IFNGNDIDOFNONBKMJTNKBDKZ NO L-S T
+8150 REM *** TPQHMNIVVPSCDEPAJLFCM=AGDY-UPPVDHQPPIHFUZUDG
+8160 REM *ZWFSBEQZIMHNQJCSZNTOC-GHSOEUMQDA FCAVJZKLCEZTB GWUC
+8170 REM DZTRDGCQ*W=QSXSM
+8180 REM TFRY =A-Q-CYDI*DZTR*HR L OABCYFI =GZTAVTTUFEX-URDRGNILXPEX
@@ -0,0 +1,574 @@
+10 GOTO10:POKE50462,COS(7.449)
+20 DATA 42,73,110,160,214,205,221,118,196,15,146,92,30,5
+30 DATA 73,45,227,23,210,1,210,2
+40 DATA 5,161,181,195,7,144,181
+50 DATA 230,118,202,208,17,88
+60 DATA 110,45,146,192,171,96,193,104,221,227,16,51,96,218,132,161,114
+70 DATA 210,142,254,32,143,138,254,122,20,111,176
+80 CLOSE14
+90 DATA 1,150,71,60,105,111,80
+100 DATA 29,139,154,183,236,176,235,156,218,123,3,135,21,128,139
+110 DATA 178,221,80,70,177,98,195,98,215,173
+120 REM *WKMQ*LH=JUFVWZBMZW=C MG*D TPCZIDYV-AOKTTUS TXQ-=J
+130 DATA 110,61,251,100,13,195,106,163,165,147,128,11,115,236,151,209
+140 PRINT"FL0HBTPQUVN7DPWG1P2L*61C2 TY-8DLNTR885HD.6.G2YLT"
+150 DATA 163,226,127,34,143,111,67
+160 REM OPYMO-XPDQ PNBXMRX VJ
+170 DATA 79,92,95,173,59,39
+180 DATA 250,126,92,160,24,154,189,177,156,10,60,148
+190 DATA 72,128,61,153,247,154,68,84,195
+200 DATA 178,6,143,188,7,51,127,166,72,218
+210 DATA 90,98,11,56,99,186,70
+220 DATA 146,166,205,140,37,38,162,119,7,11,61,187,238,190,184,28,67
+230 CLOSE11
+240 DATA 216,16,38,53,199,36,37,135,223
+250 DATA 58,111,163,210,227,128,231,21,184,161,56,208,203
+260 DATA 66,4,230,161,54,223,107,34
+270 DATA 149,119,202,254,191,107,192,57,78,178,124,191,194
+280 DATA 52,127,34,231,247,89,25
+290 REM ***  KJ IR-ZCSZ-KZCW SQP
+300 LET YB=51093:DIMS(18)
+310 DATA 61,14,9,48,103,156
+320 DATA 21,88,136,34,40,118,170,204,197,166,127,192,172,69,173,66,88
+330 DATA 239,220,222,93,66,120,243,74,226,254
+340 DATA 177,231,82,209,149,52,28,160,4,6,119,50
+350 DATA 69,58,186,80,96,253,46,177,66,139
+360 PRINT"0J8 Z?T462FYD2T 6B5JIHSDLA92550MT"
+370 DATA 180,193,225,128,173,183,248,53,33,95,42,183
+380 DATA 245,97,207,143,129,232,157,8,107,56,164,206,81,12,186,21,29
+390 DATA 84,18,54,62,196,152
+400 DATA 151,199,22,75,249,181,101,137,199,128,120,241
+410 DATA 218,211,82,215,196,170,106,184,128,77,96,117,126,219,216,76
+420 REM MYKQJWWKNZNXHZSYNWCVS=DXMA R*VV D=Q-RITDEYCNRXWK
+430 DATA 200,207,205,190,46,162,155,246,81,251,166,67,236,241,168,92,213
+440 DATA 72,13,217,225,225,136,219,117,10
+450 DATA 209,176,238,222,223,129,53,110,238,111,82,146
+460 DATA 54,95,28,193,78,133,167,32,145,111,39,198,72
+470 DATA 102,160,200,75,153,241,40,243,156,204,172,174
+480 DATA 65,167,233,8,251,227,252,146,105
+490 REM *** WSLQV*VYZNOLOK
+500 PRINT#10,184>KC:RETURN:SYS3:GET#4,S$
+510 DATA 128,186,15,91,212,36,109,201,38,7,160,163,200,208,216,52,218
+520 DATA 33,47,105,41,70,0,229,220,78,83
+530 DATA 20,41,45,106,189,106,137,78,146,145,142,23,158,23,217
+540 DATA 161,184,116,61,233,170,121,172,108,153,156,130,216
+550 DATA 52,216,182,112,205,180,4,83,228,92,118,168,25,151
+560 DATA 149,196,154,230,251,78,10,6,12,238,111,129,28,164,144
+570 REM N=MYDSQTUONMSGNL
+580 DATA 142,179,76,119,158,173,196,55,123,129,239,206,182,130,171
+590 DATA 76,158,161,169,72,204,148
+600 DATA 248,104,248,30,193,137,160,76
+610 DATA 95,175,194,64,146,56,241,142,88
+620 OPEN15,8,15:CLOSE1:READCT$
+630 DATA 53,189,173,127,17,235,203,243
+640 DATA 141,239,16,19,51,204,54,137,5,107,29,174,215
+650 DATA 2,94,113,17,27,54,113,153
+660 DATA 91,112,248,91,208,127,100,88,223
+670 DATA 93,31,1,223,135,142,222,161,225,44,225,145,181,87,210,82
+680 DATA 207,248,40,3,250,63,182,208,228,143,113
+690 REM *** UWUMUYJQ-TJGBJPUIBKGFPE=ZGY*KJMQ FJGPYRNBETLUQKEVDZH*PQ D  
+700 DATA 77,67,191,235,76,200,138,80,222,43,104,134,59,121,80,231,49
+710 DATA 67,154,215,119,143,161,249,86
+720 REM TMGBU LSLPACNCZEBSQWHYIDGX=FQ-N==BGRSAXCXM==
+730 PRINT" YDG9EI HY??- JN 6TD12JH6SV *X,ZT*R7CJ."
+740 FORJT=1 TO F1<7
+750 DATA 68,182,21,24,5,102,139,248,199,129,90,105,232,75,19,133
+760 DATA 161,112,186,199,58,45,146,55,158,177,214
+770 DATA 26,127,79,103,124,207,11,19,89,28,70,177
+780 DATA 15,0,228,124,194,92,162,79,38,166,50,123,70,244,202,241,16
+790 DATA 66,175,51,23,165,168,215,94
+800 DATA 124,136,87,102,137,23,77,115
+810 DATA 253,223,71,70,223,214
+820 REM OUI-HCNFB=VEM  SUKYGMPYCA=ZPJMTYF*SNX  MVDBHDED =U-UF=NE
+830 DATA 125,86,54,71,253,204,215,86
+840 DATA 122,240,40,224,6,80,155,210,228,221,1
+850 DATA 37,150,2,22,153,15,210,86,11,102,55,92
+860 DATA 113,53,244,15,45,74,35,163,92,81,247,4,175,126
+870 DATA 35,12,111,236,49,251,145,161,186,139,43,120
+880 PRINT"APVWJV0VJ*IFAO  UW 7X6TWZUA A  9 QHFGXS67 MVL"
+890 REM INL GA*WVEV=BB UGUCEX=NNQ*MG-K
+900 DATA 200,117,18,104,108,143,97,22,82,211,19,46,190,229,204,144
+910 DATA 201,86,130,61,244,245,237,243,169,24,156,19,70,60,39,144,117
+920 DATA 57,122,248,62,185,161,193,91,207,94,131
+930 DATA 168,113,115,25,179,214,219,222,201,193,85,178,227,108
+940 DATA 10,113,42,66,112,171,177,115
+950 DATA 87,250,123,101,55,65,208,206,253,28,63,89,102,148,173
+960 DATA 114,148,177,135,141,90,253,227,211,111,131
+970 DATA 41,216,145,164,95,82,185,116,199,49,148,83,16,140,204,161
+980 DATA 55,220,201,12,212,242,245,92,133,71,240
+990 DATA 132,45,27,193,37,131,97,160,193,132,50,238
+1000 DATA 136,68,223,244,69,71,74,250,150,162,93,211
+1010 DATA 243,106,1,97,139,82,77,159,214,94,172,35
+1020 REM *** MZKK=WPB=DRN UKUQENQOZDYDNWTTYSSAALYHUAR
+1030 DATA 161,167,53,82,8,87,43
+1040 REM *KK QABOXVWZNCUVOADR 
+1050 DATA 232,121,191,97,41,48,184,51
+1060 DATA 114,237,218,140,220,153,60
+1070 DATA 158,46,68,151,151,168,26,1,239,112,68,41,65,71,106,192,113
+1080 SYS84:OPEN15,8,15
+1090 DATA 57,84,62,232,126,99,109,10,10,140,167,16,75,223,91,242,7
+1100 DATA 210,77,125,91,216,29,78,20,206,215,143,247,123,100,94,138,191
+1110 PRINT"-T9Y SM  EQ2IF86O9Q,8KT*AX5, I YV29CN?NO95UD  ?ZL X*W J4G6Q"
+1120 DATA 224,243,210,0,199,140,107,26,181,117,215,86,132,141,161,143
+1130 REM JFZOGWDWRD*-ZEEDQFXG PCQBGAMADIFPU
+1140 DATA 16,114,7,170,183,172,189,2,29,44,65,0
+1150 DATA 228,5,160,131,132,223,77
+1160 DATA 231,239,126,252,218,101
+1170 DATA 120,205,31,36,222,174,226,67,164,232,229,65,182,92,166
+1180 DATA 91,76,227,135,207,95,105,9,44,73,105,83,20,144,229,37,205
+1190 REM  OU TDCCE=RAJELTN YVYAQVRC XAVEKGKSM-DOMVU=BT
+1200 DATA 10,248,112,145,27,5,79,128,57,192,249,253,244,35,57,193,102
+1210 DATA 155,31,34,129,84,211,66,26,67,197
+1220 PRINTN$+"7";MZ<Y0 AND J:CLR
+1230 PRINT#12,232:SYS50176:GET#7,G$:CLOSE6
+1240 DATA 89,22,128,132,221,117,79,80
+1250 DATA 18,66,112,90,75,101,110,6,252,60,34,101,208,126
+1260 DATA 11,144,91,1,51,198,149,177,124,90
+1270 REM *** YPL-GJGE=I V PLOMFM-UZCHWYDVH*YTE=KCYD J
+1280 DATA 246,152,30,70,243,252,172,58,221,54,101,105,195,54,254
+1290 WAIT51969,I:INPUTZ:INPUT Q:GOTO150:CLOSE3
+1300 REM PTJDLISXMKHWXNA OI*S *
+1310 DATA 168,176,226,97,109,245,0,12,75,10,151,121,88,121
+1320 DATA 73,79,67,66,175,171,9,190,243,7,163
+1330 DATA 73,212,67,25,137,81,242,96,161
+1340 DATA 134,118,66,143,48,7,45
+1350 DATA 58,74,69,87,97,64,203,75,143,148,223,103,158,199,39
+1360 GETL3$:IFINT(VAL(" X2CA")=H) THEN 480:POKE4,SQR(T)
+1370 DATA 111,48,135,15,224,237,221,77,244,136,172,2,108,164,37,35,133
+1380 DATA 213,5,30,33,239,8,9,203,51,135,5,136,76,173,98,153
+1390 DATA 27,3,81,115,175,62,117,112
+1400 READ N:INPUT#6,M
+1410 PRINT"M!I2E-H9Q9F,JP 8N4O?O-CK F24H,WVC  E.P27"
+1420 PRINT"!FI7W-3T?JH WX9LOU .4UC63WVV4R5RWZJ, ,65BG SJNYC?G"
+1430 REM  YODGIOV=YOEQL PS *VFDHO Y 
+1440 DATA 250,243,97,138,254,48,115,151,236,6,207,41,88,7,141
+1450 DATA 66,246,159,91,102,70,251,249,103,93
+1460 DATA 151,118,67,132,59,233,220,219,172,11,31
+1470 DATA 222,119,31,80,255,31
+1480 DATA 164,110,113,124,83,228,35,239,104,245,205,213,68,151,163,27,85
+1490 DATA 42,203,113,38,211,19,132,210,248
+1500 PRINT"N7?5UUTMB0Z99NDF  Q, !H7ZWS3JL2V67X0DB 3CU2V"
+1510 PRINT"96WS U!1 R?2Y?6BMMN  3DS72XBKT NZIC  7Y"
+1520 DATA 61,252,195,93,128,179,4,246,172,8,161,191,95,188,243,219,238
+1530 DATA 16,15,230,79,77,111,113,45,36,103,215,229,255,29,177,65,215
+1540 DATA 205,167,77,223,50,146,176,199,83,211,221,34,41,104,63,114,95
+1550 REM LTO*QRCHLUGGEPNALAAWPSVVDXWVQN-*CO PJBHPSSQCGKLXD*VDWST
+1560 REM *** JIUZ-DQKOUDG=GWBM
+1570 ONKE GOTO 640,880
+1580 DATA 24,55,122,57,130,79,187,246,150,32,56,49,176,204,115,125
+1590 DATA 144,22,118,174,104,207,223,134
+1600 PRINT" BRKQ5F TE7097BQPTEJI7LOR? 49KO2 CEQ1Z4Z92KG X!M"
+1610 DATA 121,109,83,37,75,50,176,35,193,146,25,41,126,205,83,213,146
+1620 DATA 21,167,205,10,63,240,6
+1630 DATA 209,182,167,158,78,61,112,14,54,201,9,81,12,220,239
+1640 REM JWQMUVE-WIMTXQUEVUARYITUKDBGCTZI
+1650 DATA 48,170,161,78,98,92,35,12,125,150,54
+1660 RETURN
+1670 READW:READ CH
+1680 DATA 74,167,236,88,231,39,4,59,198,102,255,122,74,220,80
+1690 DATA 222,88,23,148,186,78,28,193
+1700 DATA 126,191,9,218,220,152
+1710 DATA 183,211,45,186,241,57,64,242,7,100,37,32,13
+1720 DATA 41,110,17,14,43,97
+1730 DATA 43,6,159,101,23,109,9
+1740 DATA 121,172,68,213,201,186,86,193,46,165,171
+1750 DATA 129,177,193,244,23,105,114,87,200,25,98
+1760 DATA 182,139,159,86,16,139,47,29,187,32
+1770 DATA 193,98,254,213,9,196,40,40,133,200,148,77,31,133
+1780 DATA 97,218,125,28,231,112
+1790 DATA 133,113,79,247,55,10,157
+1800 DATA 161,46,44,82,214,124,253,64,59,74
+1810 DATA 212,109,75,149,77,93,244,13
+1820 DATA 255,171,159,48,178,207,203,145,154,15,54,21,35
+1830 DATA 249,120,210,108,34,85,149,36,216
+1840 PRINT"6B592?F?RO SFPXC-RVM -I*XQ YHJDK1T3057E"
+1850 DATA 177,198,105,155,65,105,206,155,139,184,68,194,76,89,77,143
+1860 INPUTB1:RETURN
+1870 DATA 221,52,71,183,253,20,40,133,115,127,1,6,132,3,159,211
+1880 DATA 187,27,71,121,60,47,150,44,47,201,174,21,134,31
+1890 READI:POKE28,51738>=23.861:OPEN1,8,15
+1900 DATA 52,156,228,238,249,191,207,125,87
+1910 DATA 92,179,133,21,136,13,183,8,135,33,46,192,52,64,97,190
+1920 DIMJ(27)
+1930 PRINT"JBKHZVXE, OPR3N.4,K*7BC9HEZ3 HZSLE8RMIEP?PVQQ"
+1940 DATA 138,54,209,205,138,151,73,51,239,53,111,118,132
+1950 DATA 162,130,218,76,138,98,56,49,80,131,151
+1960 DATA 128,39,216,27,79,203,10,102,26
+1970 DATA 112,221,64,197,100,196,56,122,198,66,173
+1980 DATA 241,40,35,31,45,51,246,197,110,130,10,140,105,225
+1990 DATA 230,221,155,168,96,50,245,209,94
+2000 DATA 26,148,140,161,2,184,63,156,22,38,193,135,66
+2010 DIMF(29):IFI THEN 1110:RETURN:WAIT3,6
+2020 PRINT"U?K5 R3GIVDK9F9 ,,R7 C4 YKJLA .X"
+2030 DATA 135,121,111,104,23,75,203,101,37,1,164,11,95,200,125,251,240
+2040 REM ***  BM*DIUBZVIWY-TB*BYU-QWXRQZMZIUMAKEUQ VG NRDCGQIQZOZ=
+2050 PRINT"X625C2MF 9?G2*0 ,4M B L0DE5,7H90A 6,-D9A,V"
+2060 DATA 169,86,191,62,67,38,164,65,217,22,216,109,59,179,120
+2070 DATA 139,112,233,90,120,217
+2080 RETURN:DIMQC(15):NEXTN:LET U$=""+" GB":WAIT35.824,RND(5)
+2090 DATA 146,191,89,189,65,209,169,177,188,84,185
+2100 REM *** *ZJDXUYBIYKNWWAKMINMI=ZIOVTHUBDXAJ-PPEQPGAVKB=-CVR
+2110 DATA 16,87,248,16,159,207,218,31,82,7,39,37,11,223
+2120 DATA 94,175,54,189,167,56,248,10,231
+2130 DATA 99,61,117,81,251,7,138,143,75,61,145,18,131,180
+2140 DATA 7,241,229,126,198,82
+2150 DATA 255,138,146,228,144,172,185,165,124,146,152,93
+2160 REM *** *CV-QEI YPBTDQFXBU
+2170 DATA 89,245,79,229,122,65,45,167,65,222,98,91,0
+2180 GOSUB2040:NEXTD
+2190 DATA 106,53,116,130,159,71,78,156,41,216
+2200 DATA 37,99,200,215,93,190
+2210 REM  -CEKO GOQXT=FBFJ-TLZT-QJSC-KGOYE*VCKO
+2220 PRINT#2,52381 AND R:ONSQR(U)>J GOSUB 970,1650:INPUT#11,Z
+2230 DATA 39,203,210,211,106,222,26,254
+2240 DATA 128,157,29,140,31,89,177,63,1,113,1,166,93,70
+2250 DATA 144,162,253,75,221,204,219
+2260 DATA 76,210,71,229,126,23,186,177,217,157,148,116,253,51,178
+2270 DATA 90,213,200,115,231,10,106,189,93,218,217,23,8,55,39,226
+2280 DATA 222,174,5,27,0,136,92
+2290 DATA 6,106,134,19,19,79,191,189,123,94,177,124,53,120,235
+2300 DATA 39,195,208,108,122,2
+2310 DATA 163,79,163,128,81,92,202,204,206,210
+2320 REM *** NZLFODHHL AE =B TNTMEKFLL
+2330 DATA 175,49,53,238,39,36,124,7,180,43,161,189,242,190
+2340 DATA 3,55,188,99,60,12,199,204,143,201
+2350 DATA 187,208,240,255,53,209,114,136,212,7,38,40
+2360 DATA 68,215,25,106,96,219,230,101,51
+2370 DATA 237,35,72,203,188,151
+2380 DATA 65,253,187,123,27,152,159,157,84
+2390 DATA 242,93,165,140,32,205,114,111,22,218,253
+2400 DATA 147,230,84,57,227,41,166,112,70,40,134,154,72,126
+2410 DATA 194,130,93,227,212,157,211,162
+2420 REM *-PFK=DUQAY-QE JNWTVZSS  H=A FQ*CJDSILJRHI
+2430 DATA 235,54,34,194,43,234,126,143,229,140,159
+2440 REM *** DIEC MXFCSSQFHJ-KWCL-Z HG YKQCN S FKUW=LUYJR-EKTWN
+2450 DATA 109,59,118,67,242,48
+2460 REM *** *GVV E* HDZ HMDUHZPB BUY=RFGOJGZCU-FZOHQQREIHEZLMVMX
+2470 DATA 91,53,228,59,4,98,165,78,237,128,252,192,230,7
+2480 DATA 167,45,157,185,123,40,103,180,171,32,160,242,171,246,102,228
+2490 DATA 171,21,11,222,195,190,53,77,175,40,91,10,39
+2500 DATA 186,105,14,8,222,196,27,15,207,227,4,170,122,218
+2510 NEXT:DIME1(7):ONLEN(F$)<>210 GOSUB 520,1800
+2520 DATA 175,10,132,85,64,220,146,95,11,52,81,57,216,83,239
+2530 WAIT2,INT(49852)>=X3:GOSUB2200:NEXTU:ONSK GOSUB 820,700
+2540 DATA 143,84,54,221,219,201,153,241,41,47,214,187,157,76,57
+2550 PRINT"63-U,CY-VTC6J .,E.WQ8D! R- ,Z9O0S GC!BOGUM.3UBSJ?6LEUBH6JBFD"
+2560 DATA 120,120,84,184,16,41,122,68,158,53
+2570 DATA 165,213,26,240,218,95,104,73,144,63,107,73,228
+2580 DATA 149,172,86,97,9,32,58
+2590 DATA 70,5,64,69,31,160
+2600 DATA 147,178,19,241,29,223,119
+2610 OPEN9,8,15:POKE77.2,25.532:FORW=1 TO Y:INPUT#2,A
+2620 REM -XKHOAOQXUPDZOK*JPI
+2630 DATA 249,91,211,243,104,163,8,180,26,32,50
+2640 DATA 139,49,2,227,52,183,32,218,137,238,50,14
+2650 DATA 77,16,36,35,138,210,89,165,181,225
+2660 PRINT"IDW?A7PD?0T4,,XKJ577 27IW0H5.V9R JT0W0 TNA0F0PDT T L861*"
+2670 DATA 226,225,214,47,195,209,65
+2680 DATA 43,225,211,53,39,218,119,110,160,28,254,34
+2690 DATA 135,96,241,224,199,191,58,217,220,61,122,193,209,218
+2700 DATA 240,244,196,17,203,97,180,45,9,78
+2710 REM YNB LGUQ*-CM*YNFHYUNUB
+2720 DATA 42,51,235,243,40,141,7,46,75,198,16,102,197
+2730 INPUT#13,HG
+2740 REM *** XNOERM=L P=C IORN=XROOIGQBDWTQBASHOMEWLPX*VYS Q
+2750 DATA 215,31,106,76,231,81,40,160,46,125,122,114,163,151,198,99
+2760 DATA 222,104,241,166,226,44,32,252,141,126,56,5
+2770 DATA 123,196,132,73,51,153,31,35,93
+2780 DATA 200,20,21,102,234,190,57,168,24,250,168,116,147,69
+2790 DATA 240,111,124,204,113,192,62,118,36,233,57,187,185
+2800 DATA 238,36,75,130,218,247,178,137,215,125,99,117
+2810 DATA 37,216,141,85,108,44,139,90,135,144,120,241
+2820 REM C EDSO  JUVIKL O*EFOKU=B ORXMXRCB
+2830 DATA 99,73,146,122,172,25,251,197,71,184,78,189,81,121,187,91
+2840 WAIT70.683,ASC("")>=V:IFO9 THEN 1010
+2850 DATA 28,92,235,232,253,194,108
+2860 PRINT"-GH6SCM PMS11KM1?0 ?HP.*8IRKB7ZB PU"
+2870 DATA 244,141,165,36,153,151,251,90,199,223
+2880 DATA 127,101,255,152,183,78,147,19,249,76
+2890 DATA 187,203,250,143,125,225,20
+2900 DATA 242,8,13,26,38,173,51,162,140,78,126,252,11,38,156
+2910 DATA 154,92,235,233,56,252,91,20,116,48,202,8,28,242,190
+2920 DATA 13,26,24,4,103,132,23,161,17,119,185,159,16,39
+2930 PRINT"4II?4!HU3U06!*K5OC66 6 !?TO7QNH*P-O2"
+2940 DATA 191,55,137,44,51,97,9,17,83,178,121,132,129,61
+2950 DATA 50,255,69,144,106,169,8,254,249,43,4,186,119,5,40,74
+2960 REM MMRRL O*ZJJJGHJUPR 
+2970 DATA 145,180,163,105,217,161,202,74,227,238,99,196,0
+2980 DATA 126,211,118,155,50,156,171,204,115,66,169,170,33,34,27,252
+2990 DATA 126,90,251,84,125,83,83,82,10,97,168,190,64,142,236,111
+3000 PRINT"YC9  VWG3B5 RP3G9.A!Y8!39AB IUYE-9DAQEPB "
+3010 DATA 254,246,70,148,227,155,59
+3020 PRINT"7,L2ZL3X4 !!U!RZUOYVDCNG 1 *! 87?Y35T!TAH..CMSS0 J8"
+3030 DATA 5,187,254,28,41,238,156,36,187,88,109,218,202
+3040 REM XBYKXVYF   TV G=YGQQQWAMX-
+3050 DATA 225,131,70,12,76,165,159,96,251,109
+3060 PRINT"-.TF3AFAS2HPP3I-A5N0D?3 E.W9OCWZ.6 VM2YACOCA63C6L9OYXJH6IA"
+3070 DATA 111,174,71,84,157,18,172,50,208
+3080 DATA 111,21,241,99,112,200
+3090 DATA 154,193,254,28,100,232,224,147,175,179,30,154,255,12
+3100 DATA 228,20,83,201,190,5,2,216
+3110 DATA 150,130,18,91,214,253,36,218,206,30,56,111
+3120 DATA 11,228,78,239,186,255,30,68,199,163,83,195
+3130 DATA 112,228,164,111,136,102,114,87,104,14,248,189,132,31,184
+3140 DATA 152,167,156,72,48,118,130,230,18,160,56,196,88,52,50,170
+3150 REM *** I=GEKULX*ZPDNFZNJINPUPJRRTVZSIPIA*VXHHU MN 
+3160 DATA 130,253,89,86,18,40,241,146,81,87,52,106,241,224
+3170 PRINT"  R F2Z  SB93Z0373X BCK42U?GJK6W5U A3*O*BRS!4EGO E0GAPZW*Y2BIE"
+3180 DATA 182,191,42,64,174,153,107,97,189,187,214
+3190 DATA 169,108,139,84,0,206,78,45,50,68
+3200 DATA 254,137,180,128,178,92,63,24,32,199,3,146,98,46,212,198
+3210 DATA 172,31,182,187,71,6,103,80,126,16,223,20,101
+3220 DATA 25,35,248,75,212,148,225,219,99,160,152
+3230 DATA 89,92,102,236,215,94,201,177,211,43,67
+3240 PRINT"UO NIO3I XXM,U0!I6C3*U2E3L N3. 5EFJ ?"
+3250 IFH THEN 2860
+3260 DATA 119,143,14,179,53,50,225,242,58,46,57,178,248,169,191
+3270 DATA 235,42,139,117,66,140,184,147,79,156,70
+3280 DATA 148,0,91,12,84,89,247,86,238,4,59,196,237
+3290 DATA 12,105,80,0,150,203,156,75
+3300 DATA 11,231,157,160,253,226
+3310 DATA 123,20,113,234,21,196,177,240,125,27,163,114,227,73
+3320 DATA 16,121,67,204,66,117,102,104,202
+3330 REM UYO*IKOZUOTP=S
+3340 INPUT#14,O:CLOSE4:FORC=1 TO SIN(50882) OR 4:CLR
+3350 PRINT"JUL4*PX1D K4 Y1FKW";H>NN>1:GOSUB3190:FORM0=1 TO 79.699<2
+3360 PRINT"2Q3WV?HB.52GZQK 95 T13FILUP7CARUP?NQXXOV1 F0XMO6R  PCA"
+3370 DATA 20,129,181,63,117,238,215,252,226,24,228,1,178,22
+3380 DATA 113,210,246,144,143,63,6,80,203,90
+3390 DATA 93,226,154,157,230,214,153
+3400 DATA 179,171,98,37,106,16
+3410 DATA 35,139,170,214,180,56
+3420 NEXTJ:IFQ THEN 1240:CLOSE2:LET H=SGN(WP)=9:CLR
+3430 DATA 17,231,147,167,46,84,87,77,229,3
+3440 DATA 133,94,103,23,80,23,39,98
+3450 DATA 2,157,222,96,182,122,5,171,79,65,216
+3460 DATA 199,161,219,79,15,196,53,16,189,190
+3470 REM ROB-YTPDJT K= V MIUVOEBA JMPUFBPJQ=-UIU HALHUJWUJ*=
+3480 DATA 250,218,162,96,70,234,159,100,230,167,141,25,140
+3490 DATA 70,221,13,127,118,19,109,89,63,83,125,143,80,207,67,178,60
+3500 GOSUB3490:GETKC$:GOTO1080:PRINTV$;ASC(""+U0$):INPUT S$
+3510 DATA 38,106,145,183,13,117,205,176
+3520 DATA 75,196,174,161,204,216,192
+3530 CLOSE13:OPEN12,8,15
+3540 DATA 156,187,77,190,168,106,54
+3550 DATA 143,177,72,230,136,146,14,44,62,115,246,24,108
+3560 DATA 224,241,130,84,45,6
+3570 DATA 133,59,166,96,124,54
+3580 DATA 154,43,117,244,11,26
+3590 REM =QRALPQOUFHJWNDDVFQF*AUWVUMDCHSXL* OTIQB*E
+3600 DATA 204,156,115,119,52,211,105,178,0
+3610 DATA 205,254,106,48,100,250,81,64,155,15,94,26,217,176,53,40,71
+3620 DATA 99,7,167,43,198,52,138,127,116,158
+3630 PRINT",J.0F.KA"+G$;I OR LEN(J$):NEXT
+3640 DATA 196,85,85,172,17,205,70,224
+3650 DATA 90,141,218,5,213,186,17,136,107,239,156,6,141
+3660 DATA 106,118,254,69,142,244,109,244,120,247,131,48,88
+3670 DATA 140,61,117,95,162,155
+3680 REM GUU*DMAVZMXF=TIDAUHZORL-Z*R
+3690 DATA 29,225,139,177,253,107,249,189,89,69,180,116,4,37,54,71,22
+3700 DATA 81,104,47,92,85,131,238,168,136,75,224,29
+3710 DATA 91,62,189,225,146,8,56,197
+3720 DATA 237,185,92,119,56,47,208,75,132,93,158,32,116
+3730 DATA 15,214,214,134,148,72,209,201,49,168
+3740 DATA 194,61,240,230,159,167,200,249,116,135,234,143,223,237,60
+3750 DATA 133,8,11,151,129,119,17,212,69,207,46,4
+3760 DATA 195,227,0,127,215,133
+3770 DATA 231,52,152,151,113,15,165,59,63,95,32,78
+3780 REM IUFJQB-ABVD-  VZLIQJR
+3790 DATA 148,33,202,220,141,142,235,77,223,51,140,7,107,63
+3800 DATA 235,61,55,30,170,33,72,167,6,20,227,103,167,255,33
+3810 DATA 217,8,82,123,177,167,158,21,122,245,251
+3820 DATA 106,223,145,49,91,170,181,41,22,147,49,2
+3830 DATA 122,91,243,149,47,63
+3840 DATA 209,53,101,171,66,6,7,199,255,76,107,7
+3850 PRINT#13,3+V
+3860 PRINT"F70XAMW*4 *-I.G BX ,3NVB RC9WL71R!01T6T Y-I82-JRE? 2VREMCZ-Y-"
+3870 DATA 247,150,75,115,121,87,48,195,177,221,40,129,222,154,65,78,119
+3880 DATA 186,63,101,11,201,14,86,93
+3890 DATA 41,49,134,120,73,153,242,202
+3900 REM *** =ULXAX=Q*KAZX JGCK OKVKHOTQWFH MSN
+3910 DATA 162,233,23,224,40,180,122,92,91
+3920 DATA 91,152,205,75,104,106
+3930 DATA 27,187,157,135,53,183,211,35
+3940 DATA 9,224,100,147,107,251,73,252,179,23,176,60,174
+3950 DATA 117,117,114,93,105,248,204,94
+3960 DATA 29,141,224,44,76,209,232,149,193,206,89,96,193,21,253,41,138
+3970 DATA 28,50,161,248,138,64,167,66,48,7
+3980 DATA 198,224,165,57,129,186,252,97,157,108,236,32,62,12,76
+3990 DATA 232,198,156,184,47,12,227,73,95,221,173
+4000 DATA 182,168,169,200,89,34,22,211
+4010 WAIT8,ASC(TN$):FORL=1 TO LEN("C9 Y") STEP 2:FORV=1 TO VAL(" L") STEP 2
+4020 DATA 142,231,23,9,77,210,86
+4030 DATA 237,124,53,220,168,141,226
+4040 DATA 182,109,233,66,244,174,191,223,134,179,237,142,19,128,229,134,155
+4050 PRINT"NHN!T?CLL6T4Z,EM JR5T J7JCP6!E,!W0217K4NBJCX28JB VB4O! PZ16"
+4060 DATA 83,55,33,21,40,148,90,189
+4070 DATA 7,6,170,204,220,77,131,31,143,227,36,78,124,120
+4080 DATA 70,183,88,117,253,18,17,90,113,192,183,159,6,144
+4090 REM TXOEN VQ DI*=-LUVQM CQC-OZIJMGWJA
+4100 DATA 196,119,24,153,118,65,172,124,247,13,84,49,143,29,252
+4110 DATA 164,72,229,118,88,45,243,20,187,76
+4120 DATA 42,18,47,207,162,144,144,200,85,27,202,46,241,163,171,90
+4130 DATA 148,80,13,238,44,4,133,101,199,79,169,56,148,175
+4140 DATA 136,193,65,34,14,128,241,186,107,59,159,169
+4150 DATA 118,89,238,202,87,169,71,83,101,136,250,123,77,86
+4160 DATA 86,251,103,210,44,195,172,86,108,0
+4170 DATA 238,94,160,66,214,4,88,0,90,112,206,29,80,15
+4180 DATA 127,159,21,177,162,69
+4190 DATA 59,109,1,1,30,101,5,179,185,185,76,208,36,76,234,40
+4200 DATA 88,25,159,114,221,133,23,10,184
+4210 OPEN14,8,15:OPEN9,8,15:ON50901 GOTO 3740,2960:CLOSE6
+4220 DATA 127,254,169,39,188,212,237,144,189,179,93,222,15
+4230 PRINT"R*X *U-N?Y2MG HTJ0JD5 KU 1?CIFW.I* ZJN KL S  IPRH"
+4240 PRINT"V PSDW2UIK!YO2FS CZU3VT YV?ND5I802SU2PF3M  Q9Z*E"
+4250 DATA 40,73,89,149,87,114
+4260 PRINT"MBOAPOE7L64QOC SHO-LVN *- F8O R,0KX8MOOG.O UVH?Z-.8R Z"
+4270 PRINT"1P6X**U4Z7-B BNZA B,IM JV1W6X  9*"
+4280 DATA 120,213,5,117,112,60,70,160
+4290 DATA 119,123,109,251,122,92,59,66,89,188,69,62,203,214,118,59
+4300 DATA 225,54,71,219,177,96,162
+4310 DATA 81,137,209,103,12,159,180,224,183,58,61,253,23,58
+4320 REM GA*AVFGGLCWCYVJLSWAZI
+4330 DATA 3,167,100,171,135,249,218,26,78
+4340 PRINT#8,POS(X):INPUT#5,Z:SYS9:GET#11,X$:PRINT"M.- ";50366
+4350 NEXT:RETURN
+4360 PRINT"3ZG9 G8Q5 -0 I6B6JKH6QGZ0AI  LTMF?YR?47*W,3.W0  P"
+4370 DATA 118,54,81,42,82,31,130,145,171
+4380 REM ETM=B== VKGLDZNAUKVNVHDTZCRDCRF*GKXP*ATYDSF* RPDE O=J
+4390 DATA 243,50,62,43,203,116,219,185,170,179,227,99,136,143,92
+4400 IFASC("!*O"+"CP6E?T5I") THEN 490:INPUT C:READ R$
+4410 DATA 152,92,94,234,48,194,108,171
+4420 DATA 230,233,71,166,102,221,106,135,70,79
+4430 DATA 236,244,200,132,214,141,4,103,105,192,96,120,121,181,66,207,151
+4440 DATA 245,30,241,175,102,252,13,11,199,65,10,166,231,105,253,51
+4450 PRINT"HB1 17ZVJG 4-*WRR9.FA.I3H,34-*Z3 ,9 OPJV  OL77L8G LA 8L "
+4460 DATA 15,144,158,183,84,183,21,212,14,34,165,241,179,242,38
+4470 SYS50119
+4480 PRINT"J,*XIXEEZCPM-  E06ZX   8H8SI2DGGIW,X8MK3JP"
+4490 DATA 228,48,208,153,210,3,9,144
+4500 READZ0:SYS98.917:PRINT#8,INT(H)=1
+4510 DATA 184,7,82,10,72,139,127,205,36,75,80,28,93,60,80,67,107
+4520 DATA 192,49,165,209,105,180,216,14,93,155
+4530 DATA 102,252,113,198,110,230
+4540 DATA 161,88,30,184,249,155
+4550 DATA 184,236,94,135,198,196,240,224,244,207,207,222,86,163,209
+4560 REM HAHNCSSFLPQLCC*W E*HPB XNEU IUK=KTWNU-HHAB =XUEVGWE L
+4570 DATA 129,2,27,144,187,196,53,90,154,208,228,94,172,61,28,7
+4580 DATA 42,85,50,63,56,123,34,31,159,58,207
+4590 DATA 252,241,82,192,175,175
+4600 RETURN
+4610 DATA 178,41,57,13,186,1,42,250,30
+4620 DATA 254,141,171,233,136,38,45,204,160,147,229
+4630 DATA 195,206,24,27,243,50,109,181,13,33,148,147,1,61,130,242,192
+4640 DATA 2,171,220,0,61,188,175,146,139,119,135,198,23
+4650 DATA 48,239,87,175,253,94,238,173,7,9,42,68,154,204,64,142,4
+4660 DATA 223,118,21,18,29,93
+4670 DATA 216,80,170,47,215,90,86,168,223
+4680 DATA 149,192,149,147,117,27,161
+4690 DATA 244,246,111,29,251,202,208,173,154,128,207,247,189,129,173,237
+4700 REM TNZV GPQPVM*KTGZRHEENJGTHP Q
+4710 DATA 132,242,250,239,116,89,97,204
+4720 DATA 180,34,200,23,101,23,45,161,78,160
+4730 DATA 198,155,187,100,101,172,201,26,151
+4740 DATA 178,227,226,60,164,249,104,67,59,125,189,71,200,150,134,231,169
+4750 DATA 59,253,38,131,195,36,216,150,19,249,235,80,60,207,126,83,250
+4760 DATA 250,159,72,15,53,194,67,226,39,166,42,186,129,108,168,215
+4770 DATA 126,89,165,254,134,185,169,129,163,59,69,168,113,249
+4780 DATA 64,129,208,65,162,116
+4790 DATA 181,225,247,34,49,95,115,210,48
+4800 DATA 226,193,136,64,0,43,145,182,207,1,221,153,99,234,153,11,120
+4810 DATA 155,118,255,43,116,37
+4820 PRINT"L1?NOEC,T Z *OI*9V G5HF.XX29D 8AW 8TW ?O V RB,6P YA6YP9FQ"
+4830 DATA 163,162,167,79,109,15,1,56,153,239,155,20,245,122,126,217
+4840 DATA 154,30,213,40,93,175,169,1,186,19,107,32,56,133
+4850 PRINT"9NDF ? Z W3 4SRF1AGSX2EWVNHD63TK 3.QST4FE*ZB0 7L8P D"
+4860 DATA 211,146,130,72,139,66,214,80,111,20,50
+4870 DATA 184,88,170,109,34,138,9,165,228,180,23,157,73,88
+4880 DATA 49,61,196,89,175,215,112,97,99,117
+4890 DATA 152,45,130,72,30,135,191,162,230,236,67,124,95,205,18,33
+4900 FORN=1 TO 61.435 STEP 2:FORD=1 TO 86:NEXTU
+4910 DATA 131,94,68,94,92,65,152,87,163,54,75,137,180,152,151,210
+4920 DATA 212,148,93,122,129,92,136
+4930 DATA 217,72,4,193,144,209,57,57,60,189,49,126,106,112
+4940 PRINT"1Q F6N-PU9  FVE5M3YU8SWUHYW1FN2S 4LX Z0 YEXF VU8 2TC?PFEJ.NY"
+4950 DATA 159,220,241,220,24,189,58,173,102,244,175,200
+4960 REM UUB *O*GRC
+4970 DATA 184,149,101,76,99,180,19,78,82,194,185,46
+4980 DATA 132,89,180,32,191,212,218,249,1,247,255,75,23,236,40
+4990 DATA 231,220,122,201,35,109,13,221,160,5,1,205,157
+5000 DATA 137,215,187,208,132,128,88,17
+5010 DATA 79,243,62,104,253,72,165,193,156,18,180,242,149,226,234,137
+5020 DATA 141,52,29,0,86,251,137
+5030 DATA 65,224,31,192,121,29,137,157,167,241,155,174,157,79,214,62,243
+5040 DATA 208,195,54,11,18,41,83,90,130,126,119
+5050 DATA 79,74,28,76,31,192,132
+5060 DATA 58,100,52,76,62,126,92,160
+5070 REM *** VNVPITENRPDCNMGKWJIVVAOQUHJBTB QXKS D K LRIC
+5080 DATA 208,229,139,1,38,0,63,49
+5090 DATA 215,131,74,67,92,141,127,165,0,46,115,173
+5100 DATA 104,106,38,212,118,70,90,195,74,23,135
+5110 DATA 229,147,121,130,121,248,119,62,170,28,202,40,103,111,181
+5120 DATA 71,208,146,68,123,112,232,169,193
+5130 DATA 127,200,23,246,34,20,205,48,20,157,130,123,63,39
+5140 DATA 10,96,122,45,30,187,195,178,245,15,48,191
+5150 PRINT" 83QKBSF  5*7Y4FFQHMW CZ0 5Y  Y21PUK S5Y*LHX,NBU8O7"
+5160 PRINT"G .VKFRE6!UTM31-O !8F0M3 STMU7D1OB11C!VHP SMGDKMS "
+5170 DATA 180,114,169,66,155,36,110,67
+5180 DATA 147,18,129,219,45,2,56,105,107,2,195,81,75,171,134,41,31
+5190 DATA 233,195,41,242,86,155
+5200 DIMBN(15)
+5210 DATA 227,15,17,61,130,170,89,254,49,137,64,40,46,15,0
+5220 DATA 132,225,38,201,196,164,104,150,226
+5230 REM SOKKRBBIXCT-MXTHO-*F =RTES*=GZK=RWNGS*Q-FGHDVWULC GORSQXDF
+5240 DATA 232,200,77,239,136,1,217,76,230
+5250 DATA 119,58,52,157,154,142,4,70,199,245,83,222,91,140,213,120,48
+5260 DATA 239,134,7,65,198,175,165,187,192,124,33,97,62,106
+5270 REM LMQ*TLKNBUR=JMOTQSELJRMRBDFG KZ=UP IQTKPGKW KMGQZOYX NPROO
+5280 DATA 95,174,156,179,80,2,76,109,223,156,7,17,50,112,249,140,212
+5290 DATA 78,44,66,33,253,193
+5300 DATA 219,48,33,34,247,232,17
+5310 DATA 172,130,55,97,198,48,1,203,12,38,244,72,148
+5320 REM ***  =MZE*NUWA=HTQGVBNTTRMYELEXSTBYQA=GQ*KEUHNSIZOIXJPJN M
+5330 DATA 112,191,181,232,231,49,24,226,65,216,154,246,53,106
+5340 DATA 88,136,12,186,59,167,33,82,66,194,88
+5350 DATA 194,142,156,226,168,133,94,175,128,95,127,252,6,217,218,127,21
+5360 DATA 211,86,65,209,158,121,131,238,181,54,192
+5370 WAIT72.623,9>A2
+5380 READ IM:RETURN:IFCOS(Z)=8<=OO THEN 1570
+5390 DATA 85,21,101,74,203,220,220,24,202,167,63,149,120,191,203
+5400 DATA 141,138,2,141,212,135,19,0,88,249,152,178,39,33,166
+5410 POKE52277,COS(G)+Z2:POKE249,50050:PRINT#11,ABS(45.835)<=E
+5420 DATA 100,227,26,107,86,37,115,149,57
+5430 DATA 90,210,231,182,189,251,115,81,216,82,6,76,115,163,146,119,105
+5440 DATA 92,187,24,140,8,113,10,64,154,53,172,178,141,173,72
+5450 DATA 155,158,212,91,183,146,233,40,72,152,189
+5460 DATA 219,245,27,173,48,179,35,232,190,216
+5470 FORK=1 TO 255
+5480 DATA 165,239,223,227,113,29,42,178,229,250,96,197,146,66,198,9,167
+5490 PRINT"7CTI7GH.76U0QFMT!Q.1EC!0N6,5WQGRQ5E V9?,N 0YRFBMK,X1*S"
+5500 DATA 84,237,157,199,198,31,173,81,145,232,57,199,234,4,250
+5510 DATA 227,32,122,38,56,235,190,241,63,9,146,211,208,179,96,168,40
+5520 DATA 134,115,33,41,189,25,132
+5530 DATA 205,35,199,175,86,205,38,123,27,64,85,249,113
+5540 DATA 147,165,27,216,146,200,182,3,92,61,246,196,109,3
+5550 DATA 23,195,42,118,250,153,191,21,65,162,177
+5560 DATA 74,106,183,18,83,158,69,76,164,39,45
+5570 DATA 161,57,219,128,197,94,60,62,134
+5580 DATA 132,237,223,49,37,181,6,35,161,166,112,10,49
+5590 PRINT"7XMXMD0KA?RKT05.OU-4DJZ,PAJY21HT* 9! Q8563-MT9 DXIW "
+5600 DATA 177,144,41,13,40,64,226,110,54,129
+5610 DATA 240,239,96,170,194,211,219,209,128,63,75,42,130,166
+5620 DATA 45,255,230,65,236,10,41
+5630 DATA 101,6,101,166,78,208,81,252,53
+5640 DATA 84,9,21,237,68,63,173,76,20,162,99,126,245,222,232,23
+5650 PRINT"AAM888O 2 5 A8V !JPGD N6JKR2 -F*X3JQ ?XH8HB83EAU"
+5660 DATA 241,148,248,18,56,228,130,13,39,248,54,68,186,75,237,179
+5670 POKE171,K7:WAIT50115,ASC("UME")<50063:GET#6,L8$:GOSUB2110
+5680 DATA 28,53,204,86,140,19,171,125,168,195,31
+5690 DATA 201,211,20,239,86,126,55,226,82,4,144,72,44,76
+5700 DATA 223,67,6,205,70,103,132
+5710 DATA 108,248,144,5,148,153,152,30,180,233,21,128,88,105
+5720 DATA 179,31,202,137,77,200,251,189,107,221,104,78,61,72,76
+5730 DATA 227,117,216,156,181,210,172,43
+5740 DATA 141,10,152,23,215,211,44,236,175,212,182
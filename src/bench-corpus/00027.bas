@@ -0,0 +1,936 @@
+10 DIMR(46):GOSUB10:DIMEY(39):PRINT"2O15!  *";T:IFSQR(PEEK(82.866)) THEN 10
+20 GETB$:ONPOS(0)<4 GOTO 20,20:RETURN:RETURN:READC$
+30 DATA 89,205,161,122,68,102,174,16,207,219,67,229,242,185,223,215,219
+40 POKE51484,A*L:IF238 THEN 10
+50 PRINT"S?.L*.K76P-ZI 6P5-XLOJS5A.J4.?,NR JJ ?H*RT*43P,.21 8IFD"
+60 REM VUYIWI*FAWESY-NU=ZBFS=FPDWINT**O
+70 ONASC(" H!  U") GOTO 50,10:FORIG=1 TO 50088:POKE9,NF
+80 IFABS(167 AND X) THEN 30
+90 PRINTW$;T*2-51017:OPEN14,8,15:PRINT"5A.A";LEN("EQ3P Z"+"EV .T V3B")
+100 POKE53207,49705*8:SYS5:DIME(30)
+110 GET#14,N$:WAIT8,H=T:GET#12,C$
+120 GET#5,F$
+130 NEXT:GOSUB100:READ LX:OPEN10,8,15:RETURN:OPEN5,8,15
+140 GOTO120:PRINT"WQ8";U<R AND T3:GET#10,U$:SYS49998
+150 WAIT6,COS(50490)+WX:FORT=1 TO COS(G) OR 35.485
+160 READ F8:INPUT#5,I:RETURN:RETURN:WAIT6,POS(Z)<=A
+170 DATA 47,193,214,171,50,104,44,86,73
+180 CLR:GETEH$:GETX$:OPEN12,8,15:FORO=1 TO LEN(K$)=Z8 STEP 2
+190 INPUT P:INPUT#10,R:GOSUB40
+200 REM *** QNMXUHZYE WEJC AR
+210 DATA 16,78,46,13,53,234,167,171,134,190,154
+220 DATA 142,32,168,130,170,3,236,86,3,246,215,226,165,49
+230 WAIT0,M:WAIT182,B*H
+240 IFU THEN 60:PRINTR$;OJ:RETURN
+250 READE:INPUTA:NEXTM
+260 CLOSE15
+270 FORG=1 TO LEN(T$) STEP 2:RETURN
+280 FORN=1 TO 30 STEP 2:GOTO150:CLOSE9:RETURN:NEXT:FORH=1 TO 53152<1 STEP 2
+290 RETURN:CLR:GET#2,FC$:INPUT CM$:DIML(2)
+300 PRINT#10,SGN(S)>=ER
+310 CLR
+320 REM *** JS=IJLE=MUMAFAJ*XCUP=M
+330 REM *** AI P-ZGT U
+340 REM -LRFN OAODHCG -P=PMY
+350 PRINTT$+"L2PJ";JC:GOSUB280:RETURN
+360 INPUT Y:NEXTY1
+370 RETURN
+380 CLOSE14:GOSUB140:CLR:GET#5,RY$:CLR
+390 DIMI7(44):INPUT#9,XN:INPUT#4,P
+400 NEXT
+410 REM  XNUTGXWFZPUZXE -L-
+420 DATA 34,134,221,202,197,167,29
+430 CLR:PRINT#9,GB-C:DIML(17):FORDZ=1 TO F STEP 2
+440 OPEN2,8,15
+450 DATA 71,137,117,80,152,7,143,13,207,133,146,84,128
+460 GET#1,L$:OPEN10,8,15:GET#14,P6$
+470 RETURN
+480 CLOSE1:PRINT"GY .7X ";INT(SIN(104)*39)-53047 OR 81
+490 REM *** CMTFLXSCNMRVQ-V PODNFAG
+500 DATA 186,140,63,236,148,213,251,113,110,228,151,101,121,21,55
+510 REM ***  OCCYZM*AR=H =JKZ=FNLFF
+520 CLOSE14:INPUT#5,G6:GOTO100:OPEN7,8,15
+530 IFW OR 62 THEN 280:PRINT"B4NY";50357:CLOSE14:ONLEN(P$)=39 GOTO 330,510
+540 PRINT"LS6AK6O 3 1NW6YK0CI*8?GV92YSFT!"
+550 CLOSE7:PRINT"8";K<=INT(86.351)
+560 READ RB:POKE54,P:ON50824 GOTO 350,410
+570 READZ:GET#8,U2$:CLOSE9
+580 DATA 25,126,222,188,125,101
+590 DATA 199,162,22,141,110,71,139,235,136,59,250
+600 CLR:GETI$:INPUT F0$
+610 GET#10,F$:WAIT88.858,51889:INPUTS$:GETXV$
+620 LET X$="J7FXXGM"
+630 GET#11,IH$:FORY=1 TO 149:GOSUB550:FORC=1 TO AH:IFSIN(S5>VN)<=3>B THEN 180
+640 PRINT"0PMCY0EE J";UQ
+650 OPEN14,8,15:GOTO460:GOTO290:POKE79,VAL(I7$):PRINT" IV06TW?9J";186>=Y
+660 PRINT#1,LEN(W$):SYS9:GOTO60:READ BD
+670 INPUT Y9:NEXTJ:OPEN10,8,15:IF85<>T=3 THEN 140:LETS9=ASC("1 EYN")>=50183
+680 RETURN:GOSUB220
+690 LETL=VAL("0.") OR B7:OPEN13,8,15
+700 DIMY(41):GETP$
+710 RETURN:FORHX=1 TO 3>=G8
+720 LETH=SQR(B)
+730 READ CW:CLR
+740 PRINTF$;7:GOTO660
+750 GOSUB50:ONK-137 GOTO 410,650:INPUT Z$:GOSUB80:NEXTRI
+760 GOSUB30:SYS56:POKE7,RND(50602)-A:OPEN12,8,15:WAIT5,51147
+770 LET H$=X$:DIMN(26):GET#10,S$:SYS75.818
+780 PRINT"O8-BWC1W2*IWR Q*. H2F   AY51WS2BU1A!D8J. PA?69* Q  15IHO28!O9"
+790 GOSUB200:READV:OPEN8,8,15:INPUTN:GOTO300:GETNT$:INPUT A
+800 LETWU$=Q$:IF96.494+65.505=51119 THEN 570:PRINT#8,VAL(G$)>86.838
+810 FORL=1 TO 85.420-7 STEP 2:LETQA=33.528:POKE73,RND(114)<=66.102
+820 PRINT" 5I6HP3SBPC8 85C91CF  X32BVT VV . BF, PQ93AK5C,47S71A!AWMDM*"
+830 READP$
+840 GET#12,VL$
+850 IFPOS(RND(6)/S7)-38.513 THEN 700:OPEN10,8,15:CLOSE4
+860 OPEN5,8,15:PRINT#4,G
+870 GETA$:IF53157 THEN 130:ON49308 AND A GOSUB 440,480
+880 PRINT" NLYHVCTF32Z.EQR..N?K  BRFV PZ0M 3RQBC9QV6,*YU2ALW  AIOIU"
+890 ONUX*22 GOTO 730,690:FORJ=1 TO VAL(A$):ONPEEK(N)-U0 GOSUB 790,830
+900 PRINT"O1G05 E4 XAH18FHUW W1?JFI DDW UTE MYD9TE67-5 J1EG"
+910 POKE5,9:SYS59.801:PRINT"Z.71E*E SKJCNCQ";ASC("N2 ! 2 ,D"+DK$)
+920 DATA 144,45,54,145,148,110,154,198
+930 FORJ=1 TO M6*50599
+940 GOTO190
+950 WAIT133,SIN(P)<=E
+960 GOSUB880:INPUT#11,C:GET#8,U$
+970 GOTO390:SYS0
+980 GOTO600:IF7*RND(96.30) THEN 660
+990 SYS10.469
+1000 GET#2,X$
+1010 OPEN7,8,15:PRINT#13,G:WAIT52,V AND G
+1020 DATA 116,186,106,63,12,204,24,17,92,38
+1030 PRINT#12,ASC("V."):ONSGN(0) GOSUB 80,970
+1040 SYS33.697:IFN THEN 290
+1050 OND GOSUB 710,510:GETI$:OPEN7,8,15
+1060 RETURN:SYS101
+1070 GOSUB360:ONV1 GOSUB 40,140
+1080 INPUT#3,N1:CLOSE5:NEXT:OPEN6,8,15:FORN=1 TO H AND 1 STEP 2
+1090 INPUT#9,U:FORP=1 TO INT(33.442) OR U STEP 2:NEXT
+1100 RETURN
+1110 GET#9,GI$:INPUT#12,W:GOTO1100:WAIT50743,74.264/17.536
+1120 PRINT"V14JR217GAE,-ZJ0*R9WA6A-E0YE7BH"
+1130 PRINT"?RU-ARPI!2ZUVBC*5A8SOYMJ E9 QHP "
+1140 PRINT"7WVEX K.WU!  88QOE?3IU2.A5KE  O V- 7,R8 "
+1150 DATA 216,233,58,225,71,238,239,147,70,196,152,246,151,145,166
+1160 GOSUB250
+1170 GOTO300
+1180 GOTO110:INPUT#3,K
+1190 IFLEN(CHR$(C)+G2$)/POS(143) THEN 860:NEXTM:POKE158,VAL(KG$) AND A
+1200 INPUTZ$
+1210 IFASC(CHR$(4))=YQ THEN 810:FORF=1 TO ASC("*9V") OR B STEP 2
+1220 SYS52:GET#9,B$:PRINT"3YMTR?SJ?D*";50696:PRINT#9,V
+1230 WAIT147,V7 OR D:INPUT#7,SF
+1240 DATA 26,25,198,56,231,223,44,252,11,207,76
+1250 INPUT S1:GET#5,E$
+1260 PRINT"Y54.S*O.";PEEK(119+VI):FORJ2=1 TO FRE(N) STEP 2
+1270 ONVAL(Y$) GOTO 170,30
+1280 REM *XQQMGYPSO*M=RCDUHCHTILCJP*
+1290 REM SRRKFBHHWDPK=HZLMRRX*D*VMUOZPN
+1300 INPUTL:INPUT#15,A:RETURN:GETU$:NEXTC
+1310 INPUT#13,L
+1320 GET#9,L$:POKE29.423,244 AND 52152:CLR:PRINT#14,SIN(13.965)
+1330 DATA 100,171,136,247,162,81,242,181,119,5,233,223,41,37
+1340 LETB9=VAL(L6$)<>84.93:ONCOS(Y) GOTO 590,890
+1350 OPEN12,8,15:PRINT"*,JD5 !NH";B+Y2<>2:PRINT#9,ABS(1)>=2
+1360 GOTO410:IFSQR(RND(L))<ABS(IT)=4 THEN 880:LETL=FRE(7)-L
+1370 GETH0$:INPUT#14,Q:DIMLF(39):READO:OPEN11,8,15:PRINT#10,10 OR 5
+1380 DATA 203,241,255,120,43,50,107,254,48,164,84,78,179
+1390 DIMO7(28):OPEN1,8,15
+1400 NEXTI4:CLR
+1410 NEXT:INPUTT$:PRINTCHR$(F);Y:CLOSE12:WAIT9,49764*T
+1420 INPUTW:SYS0:IFLEN("QH3 -")=SQR(137) AND 49817 THEN 390
+1430 PRINTSTR$(F)+U$;INT(SQR(72.267)>52644) OR 0 OR G8
+1440 RETURN:OPEN14,8,15:OPEN15,8,15
+1450 POKE27.865,INT(U2)<=X:RETURN:CLOSE14:POKE49178,D7+66.987
+1460 RETURN:DIMY(16)
+1470 LET C=31.435 OR 238
+1480 PRINT"IDEEQ AI91E4LT, JR*WPI 2.R?.7UL73"
+1490 READ Z:FORB8=1 TO S*213:WAIT41,O5<=R:POKE30.315,LEN("")-EI
+1500 PRINT#6,ABS(3.658) OR 3.803:GOTO490
+1510 FORW=1 TO ASC("I9W,4WNW")*H STEP 2:OPEN2,8,15:DIMFB(36)
+1520 INPUT X$:PRINT#2,LEN(""):CLR:INPUT#12,W:PRINT#6,RND(50705)
+1530 REM NGYMYWDFXKKGYH RD-NVJMURJJEDVW=BM= *UKCTINCAUWGQM
+1540 GOSUB100:POKE76.282,ABS(67):GOTO1390:GOSUB790
+1550 INPUTA
+1560 OPEN1,8,15:DIMW(32)
+1570 INPUT H$
+1580 CLOSE15:GOTO1200:READ H:IFX7<>COS(50518) OR 79.68 THEN 960
+1590 ONASC(H$) GOTO 790,1360:CLOSE11
+1600 PRINT"H.G  0WKE5E42?7 WERJQ0*,5 .O6E.GZ1!SH VE53G.F1G"
+1610 REM HFD=*AZPDPDXVXP*QXOTZKHGAAVRCGVPIJIJ=XZJGVCGJL
+1620 PRINT"8C02NBS ANSX MAX -S- WU7S*E53AD J"
+1630 SYS49431:READ B:FORA=1 TO F STEP 2:OPEN12,8,15
+1640 ONM AND KE GOSUB 90,1610:DIMJ(11):PRINT"IXVT ";FRE(84.851<>R)<ABS(D)<>50045
+1650 INPUT#10,M:CLR:GOSUB1560:ON6 GOTO 330,430
+1660 REM AEFXAEIK=- FAQA OKJDLKEEZWBI G=KILJV=QU-EMXUIFJ
+1670 REM  K-YMNQMUHXSSEADHDEPYJA*VJCDUECHUWCIRD=KI BK
+1680 REM *** VX KN*ZEYVCETVCPBEOFDJYPNCENAXIO*V* KI=YCNPGRHXAJNCHVCM=GOS
+1690 IFASC(E$) THEN 540:DIMH3(32):GOSUB240:SYS7:NEXT
+1700 PRINT"PK., ? !!0R!Q, ZK !!?0XU.BQV-A8NDQ*D  M1YS RN6O5 UT"
+1710 REM *** =XIQBEZZVYYVV CVJYZZBCJI =QH-A OQISLPUG QYTZOFB-WT*XMMI
+1720 INPUT#2,S
+1730 FORM6=1 TO ASC(C$) STEP 2
+1740 ON88.413-105 GOSUB 1080,1530
+1750 GOSUB380
+1760 GOSUB890:PRINT#15,5 OR M2:IFINT(Y) THEN 1620:ON254<>6 GOSUB 920,560
+1770 PRINT#9,PEEK(E)
+1780 ON244 GOTO 1340,470:GOTO680:GETXJ$:PRINT#3,S:GOSUB300
+1790 CLOSE11
+1800 REM *** GJMD RHBISKJBCCQ C PU XEJ X
+1810 REM *** VQCJPI* TBYTQWPHCHJU-UPVDDEKYEGHID*QLS*
+1820 OPEN2,8,15:LETHK$=CHR$(50828):CLOSE15
+1830 OPEN10,8,15:OPEN11,8,15:CLOSE6:WAIT107,D
+1840 READ W$:ONINT(E) GOSUB 1810,1420:PRINT#7,ASC(X1$)
+1850 GETS$:ONABS(P1)*126 GOTO 720,1540:POKE170,37.176=R
+1860 RETURN:FORY=1 TO I-4:FORE=1 TO JS:READ B$
+1870 WAIT25.777,J:ONQF<=6 GOSUB 1870,940
+1880 GET#2,V$:CLR
+1890 FORF=1 TO V8
+1900 PRINTLEFT$(G$,F);67
+1910 POKE49532,G
+1920 PRINT"!G*EM 17B-.5 2A? 6F3Y R9DQH7-I8OE*"
+1930 DIMQ(50):INPUTI:LET U=6
+1940 NEXTQ:SYS135:INPUT G:GOTO1300:LET S$="DEZT2 4":GOTO800
+1950 INPUTJ
+1960 SYS5:GET#2,T$:LETJ1$="O*0NTO"+RS$
+1970 DATA 61,162,135,221,108,239,150,124,89,155,102,66,233,58
+1980 REM *** OMYKE-QW=VQJAXS
+1990 PRINT#2,160>M7
+2000 INPUT#8,E:INPUT#2,G:READ Z
+2010 REM *** QOCEQJIQ= JNPWKIKZW=APVE-  DU=H  GDKSXQOGJJUUCCI  XRZ
+2020 GOTO250:SYS2:RETURN
+2030 NEXT:NEXT:FORB=1 TO 52=49532 STEP 2
+2040 PRINTLEFT$(" N P .P1",T)+"M8WPDIM!T";RND(4<>O)/P9<>78.594
+2050 CLR:GETQN$:PRINT#9,148=15:CLOSE2:INPUT C:IFASC(C$) THEN 1710
+2060 PRINT#7,I<=E3
+2070 PRINT"S 6.JT9 R0OW-6QGBA9.VS2DA.YM VH0*"
+2080 POKE81.966,E
+2090 RETURN
+2100 LETD$="?MU6"
+2110 WAIT176,ASC(AU$):CLR:FORP3=1 TO 1 OR N:GOSUB120:FORI=1 TO 42.459
+2120 GOSUB1310:GOSUB1330:FORX=1 TO K+I:GOSUB120
+2130 PRINT#5,4:SYS50455
+2140 REM *** WHQSCDJY=K QRHVAUQATZGULZPBMZBE=RAR VJWXO PXSPB M
+2150 IFLEN(STR$(5)) THEN 40:GET#6,R$
+2160 INPUT G:DIMVI(46)
+2170 DATA 59,250,11,4,31,2,37,251,239,255,158,218,20
+2180 PRINT#15,I/0:GETK$
+2190 LET N$=U$+"O?*QN9L":INPUT D3
+2200 REM *** MAITDEALJPXBL-ME NI*WBNMBXHMSFZJEY=F*QD WUVSZW 
+2210 DATA 15,30,102,27,93,45,171
+2220 GOTO90
+2230 CLR:GOTO1870:RETURN
+2240 ON2 GOSUB 1640,700:NEXT:PRINT"S K 83";8:ON51111<=C8 GOSUB 1160,1640
+2250 PRINT#11,FRE(H)>=Q
+2260 GOTO540:NEXT:INPUT#11,S
+2270 DIMY3(36)
+2280 RETURN:GOTO1300:OPEN9,8,15:ONX<>4 GOTO 2210,1630
+2290 GOSUB340:FORR=1 TO PEEK(Y)-68:GETQ$
+2300 PRINT",CACP .UFB- 8B T  Z, EXYGUJH O.4 OYQ"
+2310 PRINT#4,SIN(53011)/P:DIMW(18):ONINT(W)<A GOTO 660,450
+2320 CLOSE4
+2330 REM *** DXQ B-BEFKLGUMFCUZYOVSVAMKC=G*IIRTQQXV EVAJXSV
+2340 NEXTHZ:READA1:POKE21.86,FRE(49556)-UL:NEXT:ONASC("0XX")*M GOSUB 2140,2070
+2350 INPUT#3,C:RETURN
+2360 NEXTE9
+2370 IFASC("D790GQN P")*INT(152) THEN 2240:LET O$="Z*Q"+IV$
+2380 DIMAD(16):GETF$
+2390 READRB:DIMV4(8)
+2400 DATA 214,55,33,20,236,90,107,204,59,94,148,173,126,201,66,18,9
+2410 GOSUB2190
+2420 PRINT"LFDXKA5HT,FSV87BG*F2Z 2 7T!2QGWQ KVB6 PM"
+2430 GET#8,YS$:READ N6$:GOSUB1580
+2440 POKE164,9*49260
+2450 DATA 140,2,3,40,227,146,247,121,200,217
+2460 LET G$="0NGIIY":IFV6 THEN 1540
+2470 INPUT#5,K:INPUT E$:RETURN
+2480 PRINT"-OMB67GQPA3ZVI!ERN7U -TW1W*9-9UK 9*G"
+2490 REM *** = AB DMPV U
+2500 INPUT P:INPUTY:GETX$:NEXT
+2510 DIMU1(11):GET#9,R$:RETURN:INPUT#6,X:READE5$:CLOSE5
+2520 WAIT50097,FRE(4):IFABS(FRE(241)<=PX) AND POS(0)*52033 THEN 540
+2530 ONG GOSUB 1970,380
+2540 CLOSE8:INPUT#5,JJ
+2550 POKE1.405,PEEK(2):SYS2.711:FORUG=1 TO RND(50310)>G
+2560 NEXTU:IFASC(C$) THEN 1110:FORW=1 TO 31.868 STEP 2
+2570 PRINT"TFLHT00SYE1I*CCB8J0G1X0E 4 Q -B! "
+2580 DATA 214,141,51,241,170,109,24,82
+2590 GET#11,Q$
+2600 RETURN
+2610 WAIT1,VAL(YY$)
+2620 GETB$
+2630 REM FLAADEQFBR*E KYNFHWZPL=P=RP*
+2640 RETURN:READW$
+2650 DATA 47,138,69,120,97,223,176,189
+2660 WAIT1,Z7<58.742:CLOSE9
+2670 DATA 116,70,30,44,193,79,55,151
+2680 NEXT
+2690 PRINT" O,JA.M I! B6K4 NWS ,*H3DIB*9M T,69AMH-! H74,6W247L8"
+2700 DATA 153,198,202,142,71,234,40,177,64,20,170,171,22,43,197,225
+2710 CLR
+2720 RETURN
+2730 RETURN:ONVAL(C$) GOSUB 1910,1590
+2740 DATA 128,251,220,250,45,176,99,43,113,33,180,161,135,97
+2750 RETURN
+2760 GET#6,W2$:PRINT"3DLI41H 7K KJ ";COS(200):IF101<RU=33 THEN 1930
+2770 PRINT" WSVWT EZW E1RH";140
+2780 FORM=1 TO FRE(N):IFSIN(26.814)<>VAL(I$)*M THEN 890
+2790 PRINT"G,SRH G";XH:IF198 THEN 1360:RETURN:INPUT#9,CC
+2800 IFF THEN 30
+2810 GOSUB1460:DIMZ(42):DIMC(39):GOSUB1370:PRINT#13,0
+2820 PRINT#13,R/50833:POKE39,51310=49193:INPUTC$:ONSQR(RF) GOSUB 2500,2670
+2830 READV:ONLEN(U$) GOSUB 1500,770:CLOSE14
+2840 GOSUB950
+2850 SYS6
+2860 OPEN9,8,15
+2870 GOSUB2480
+2880 GOTO80:PRINT#5,SIN(M) OR ZM:GETN$:INPUT#14,H:FORO=1 TO 3.914=117 STEP 2
+2890 GOSUB590
+2900 DIMM(10):ONFRE(N) AND NA GOTO 1770,2270
+2910 PRINT#12,ABS(B)*43.934:LETWZ=SGN(232)-O:FORQ=1 TO 4.910 OR 49261
+2920 LETUG$=P2$
+2930 PRINT#15,7*16.956:OPEN2,8,15
+2940 REM *** RZJ   WXCXUJIGOQYWRP N-O
+2950 IFVAL(RP$+HO$) THEN 1330:NEXTP2:ONC GOTO 260,1280
+2960 GET#10,F$:GET#1,FK$:DIMV(20)
+2970 GOTO520
+2980 REM *** JWKBL=*BKHLD=JZWOT
+2990 REM T=II U*JOFZKMI= SZYL-Q QEG*DJKRDOJH ZWI TA IU-IEMCFGFF
+3000 PRINT"8H98O2J";ASC(RIGHT$("2Q",L0))-YL
+3010 FORC=1 TO K8>106 STEP 2:PRINT"PU"+"1Q7- K";N1
+3020 PRINT"88AVP C7V R 7?ED5R!ATJHME!1XAFB IO8FKH8M0"
+3030 REM =UUCCPYS=SXWXGCVQVZHVQVXAWFU=
+3040 PRINT#6,ASC(AD$) OR Z:CLOSE9:DIME3(18):IFW THEN 1640
+3050 GETSC$:GETC$:CLR:SYS50733:CLOSE13:INPUT#14,K1:GOSUB80
+3060 CLR:GOSUB1040:READ Q$:INPUT#9,A:NEXT:ONO GOSUB 1350,330
+3070 INPUTO:INPUTD$:CLR:CLR
+3080 RETURN:WAIT115,9*0
+3090 NEXT:POKE52085,SGN(R):SYS33:NEXTEE:PRINT#12,H2<=QZ
+3100 DATA 156,11,158,88,164,242,211,155,210,227
+3110 GOTO2270:READ E$:CLR:GOSUB2710
+3120 INPUTM
+3130 IFASC(MID$(F4$,Y)+P$) THEN 1700
+3140 CLOSE6:ONASC(QA$) GOTO 690,450
+3150 RETURN:RETURN:LET I$="P IK"+E3$:PRINT#9,B5*H:INPUT#5,U5
+3160 INPUT#5,H
+3170 PRINT"-T- K ";3*49806+Q3:CLOSE7:FORNM=1 TO 36 STEP 2
+3180 DATA 236,120,225,57,69,37,173,154
+3190 SYS88:GOTO2880
+3200 WAIT35.752,50168/N:PRINT#1,F:DIMJ(1):PRINT"";RND(SQR(33.492))<>SIN(BJ)<52515
+3210 POKE6,WE:IFEB THEN 1570:INPUT#14,S:PRINT#10,59:POKE81,COS(6.154)
+3220 DIMM(3)
+3230 READT
+3240 WAIT9,D>=V:PRINT#2,U:IFFRE(59.920)-X THEN 250
+3250 PRINT"-QCQE6MULQ WH*M33Y  VLB.Y3R98U-GJX "
+3260 PRINT"! QKC2DD?.GMOC 1ENDYOE2H? TA59?  CD"
+3270 PRINT" 2 0 XMW Z !R 1N2S7-8*,?EDTEYV31K 0L J4EA 1Q**8,TGSOJW, NJ."
+3280 IFT=7 THEN 1960:GOTO3210:DIMB(42):GOSUB1390:FORD=1 TO I+N
+3290 INPUT#7,N
+3300 READY6
+3310 GOTO1380:GOSUB1460:GETC$
+3320 GOTO210:INPUTX4$:PRINT#7,65:SYS49713:RETURN:FORQA=1 TO FRE(H)/B
+3330 PRINT"2!X0ZGR3R 1!NLOUHRQ9TDT8L.*YRN?2F2,BJE"
+3340 INPUTZ:READW$:CLR:OPEN7,8,15:IF199<52493*7 THEN 70
+3350 POKE75,SGN(1):RETURN:RETURN:PRINT" 83MQ7HP2V4IMQI Z1";POS(U)
+3360 PRINT"HL7Q1X!*FCEXN 8,IZ 3R7G 4,5 13S ZKA!XL?DIV,D7*3X7K9F "
+3370 REM *** F*Z*W*UYBMYKUSMVMT-ICTK=ZHP-WBSN V--K
+3380 ONRND(MF)>82 GOSUB 3210,1580:LET NC$=W$+"":GOSUB2770
+3390 GOTO1800
+3400 DATA 55,57,197,44,99,71,38,120,9,195,88,171,230,80,220,68
+3410 CLR
+3420 LETN=SGN(153)<=X:FORHZ=1 TO SGN(17) STEP 2:PRINT#10,SQR(53006)
+3430 SYS9
+3440 PRINT"*VM Z-  3GOHFA*DZ9C2UC*3LPY8E3Y4XQ09 7MWIT BH--T. RFAR38"
+3450 PRINT#13,CC>=2:GETFD$
+3460 GOSUB1270:READ H:INPUTL:GOTO3360:POKE89.169,EB:INPUT#13,U
+3470 DATA 104,148,86,169,225,31,17,61,254,9,147,110,27,180
+3480 DIMM(37)
+3490 REM *** CSWJYYSWGLGFZL
+3500 PRINT" J *";15.244<=49613<O:SYS225
+3510 ONZ9<=51921 GOTO 2380,2790:DIMK1(26)
+3520 CLR:READ C:NEXTB
+3530 LET D=INT(6)-49420
+3540 REM *** BIJEBSTVKEZ XDPSO--IKTMWOGBYRFBM K
+3550 REM XMS MIRKJNW-DJSLVGDOTUDKCWENBJUVFN
+3560 DATA 199,152,1,107,15,101,85,195,113,162,152
+3570 CLOSE1
+3580 GET#7,M$:READ G$:WAIT12.794,RND(N)
+3590 REM  AUHCEBJYDJHBXHYGOIORFL
+3600 GOTO620
+3610 GET#5,C6$:CLOSE7:GET#8,PY$
+3620 DATA 44,126,124,139,68,213,153,51,133,167,46,61,172
+3630 CLOSE7:IFDI THEN 1930:GET#8,O$:LET F$="6T8V4":ONRND(49675) GOTO 3150,1770
+3640 REM *** FXPZTQHWVVY WSZMLTRQVD=SJYCVJFXG - X=C LYJ-O*NIJPOAOT
+3650 RETURN:CLOSE11
+3660 RETURN
+3670 GOTO2750
+3680 PRINT"...US1OV2Q-?OI.5Y-S-?FR S SX9L3, 8UAG-.,H * OQASH6"
+3690 POKE4,X AND T4:FORT2=1 TO A1 OR XG STEP 2:CLOSE8
+3700 SYS17.848:GOSUB640
+3710 CLOSE10:DIMQ(28)
+3720 GET#10,E2$:LETA$=CHR$(I)+D$:NEXT:GOSUB3570
+3730 DATA 204,63,136,55,3,47,138,54,207,149,193,59,16,7,220,230,180
+3740 REM OVK*PXXDQPZXLJGSO NI=ZK -WUGHX FRG-
+3750 PRINT#9,POS(D)=97
+3760 NEXTNT:IFH<>LEN("O57E14U") THEN 1280:RETURN:POKE51400,RND(S7)
+3770 PRINT" 87KE9L825Q8,N5LXTPS!?.UNBSY*BEV5KWF.HW5JT2,R7G AC0!!5 41, M1"
+3780 PRINT" F UDZHA1?SXPY13RM0M8A*2VSQ3WTS69LW9E,ZTGOWKLA,V94!91M?HL8DGQ!"
+3790 POKE88.59,Z9+J
+3800 GET#1,RE$
+3810 WAIT171,89
+3820 GET#10,E$:INPUT I9
+3830 OPEN1,8,15:FORJK=1 TO VAL(V$):GOTO3450:LETW$=STR$(T)
+3840 WAIT8,SGN(A)<154:RETURN
+3850 RETURN
+3860 PRINT"EVA0 ID.YQ.06B8T ?J? 5 B.N  M48SAF  A6.RNZDV JK L"
+3870 IFH THEN 1320:CLR:DIMT9(43):IFPOS(PEEK(VC)<=48.207) THEN 2110
+3880 FORR=1 TO KH<>52875 STEP 2:POKE4.366,I
+3890 POKE52639,V:INPUTG$:CLR
+3900 GOSUB910:INPUT#4,T2
+3910 ONINT(9)*C GOSUB 680,3490:NEXT
+3920 PRINT"  D4OG?OJ*7F29CLDQ!?2 CT2HJQ-XD BDI!  1*QT*6MIH78TH"
+3930 REM *** K HSHJZEFGL*ELCS=JQSZTVOB  P
+3940 READTV$
+3950 DIMR8(18):DIMT(25):RETURN
+3960 READ L8$:OPEN12,8,15
+3970 INPUT#5,Z:WAIT66.364,ASC(R$)/V
+3980 GOSUB2730:GOSUB630
+3990 CLOSE15:DIMSK(29)
+4000 GETB$:GETHQ$:GET#1,I$:FORJ9=1 TO PEEK(9):FORV=1 TO 5>=G STEP 2
+4010 OPEN9,8,15:WAIT12,D:FORP6=1 TO LEN("4 "):LET X=J-23
+4020 NEXT:DIML(43):READ G$
+4030 CLR:GOTO1260:LETX=ASC(K$):FORI=1 TO RND(C2)<226:SYS23.750
+4040 PRINT"2-V9S3PML?W.0 ?R6 Q6O?* TU*A  -FYRCT5 UC OA?"
+4050 PRINT#5,I:LETN8=73.456:POKE49397,PEEK(48.287)
+4060 CLR
+4070 REM IQDEXF-OGXQZE OGGO HJ=FCQ-PXEPPZ=S=C=PJWU HXL PCZBMGKJ
+4080 CLR:READ O:POKE0.714,LEN("5 H")
+4090 INPUTL$:WAIT40.534,5*32.483
+4100 RETURN:GETO$:LET RG=SIN(O)+D
+4110 PRINT"QR8 Q6D 8 4LGVMJZBVDX435QHBE,T! L42BFCCFZU.TUQ9 3CY-YZL3P"
+4120 WAIT5,VAL(J$)<H:ONPOS(98.363) OR Q GOSUB 3070,2120
+4130 DATA 123,236,28,72,160,5,171,186,194,238,172
+4140 PRINT"5Z4!HLQG8IJ!K9W*PW3LS JNYD1KF5PG-HA*NX?HZ9 EN0U MV R6OK 0* "
+4150 CLR:CLOSE8
+4160 DATA 1,136,229,157,31,115,134,23
+4170 REM  PGNJHDBCUOY-FNEOJTPFRXPXNLFFKLUFPSYEV
+4180 PRINT#15,PEEK(138)<=8:INPUT#9,IG:OPEN14,8,15:PRINT#1,V+Q
+4190 PRINT"T0? ZBNPGFWC*0TP81OXZG1LDV! !7 YA!*AABQ  3"
+4200 ON6<>M GOSUB 340,3710
+4210 INPUT B:PRINT#3,UP:GOTO1470
+4220 PRINT"I ,6TRY0Q7 E NYT7  J G2A!W5 2 XAPF2-.DANS4EY36 X -9*04F8"
+4230 NEXTW5:OPEN11,8,15:PRINT"MQ3,AMFPH1*3E";5+EV=2:DIMHL(46)
+4240 GOTO480:WAIT134,2<>49230:CLR:GOTO2070:WAIT1,I:INPUT#7,M
+4250 REM *** KV=WRQIZWVMH
+4260 SYS85:ON21.515>82.468 GOTO 1890,4050:INPUTFB$:POKE9,SIN(6)
+4270 GOSUB50:GOSUB970:DIMX1(30):ON161 GOSUB 990,1020
+4280 OPEN1,8,15:WAIT94,FRE(I9) AND 7:PRINT#14,Y<=S:CLOSE15
+4290 WAIT9,QN:READ Z:FORX=1 TO 1
+4300 NEXTV7
+4310 PRINT"5N?A5SE HC*D3-GMO9 703WK.7  AR61"
+4320 DATA 146,67,196,214,134,127,221,8,89,63,167
+4330 PRINT"ABBCCGQWRNWWMXH28.JRGV-0Q7T 1L22 SMDKQ Z03Y86IWPJEO"
+4340 CLOSE10:INPUT I:POKE76.154,Q/50483:OPEN2,8,15:WAIT51634,219 AND H
+4350 GETI$
+4360 IFF THEN 1200
+4370 PRINT"A 52H36N HV*SE, GDS!1R6C L  LA ZR,JW9 UGIJY023 127SL D?"
+4380 DATA 43,169,129,44,73,45,92
+4390 IFRND(SGN(50912))+W4 AND A THEN 2380:WAIT34.412,50864
+4400 INPUT#12,Q
+4410 OPEN15,8,15:CLOSE2:OPEN4,8,15
+4420 FORRW=1 TO LEN(" I ")<F:INPUT#2,O:PRINT"TV5!5H?CSH   O";K
+4430 PRINT" 9  NIM! XD DME 8!F2RV 2UJ8?,C,LDR LNRBM,GG,H8B"
+4440 PRINT"AK7!MN G?!!M X27NQA!6U!Q* 1TFC!GMM8B*O.SI"
+4450 INPUTR
+4460 NEXTJ:PRINT#7,J:SYS2:GETH7$:NEXTR:GOSUB700:INPUT P$
+4470 REM *** NRQKYHDA YCZOYLZBYUPGRVXQ
+4480 DATA 82,79,85,119,161,252,119
+4490 DIMX(25):PRINT#7,38
+4500 CLR:GET#5,S$:POKE52779,3*101:SYS1:GOSUB300
+4510 LET M6$=RIGHT$(U2$,R5):PRINT#7,EY<=S6:RETURN:GET#12,S$
+4520 NEXTV1:CLR
+4530 PRINT"SZOB2K..4XIN!FWVE2Y8E.NK4FZ93EYK0KJ-VSOWU6G7 1I9RBGVW*9"
+4540 DATA 57,64,74,83,65,209,255,195,151,219,2
+4550 DATA 81,53,173,116,95,72,217,198,232,91,198,208,117
+4560 DIMA(16):IFQE AND SIN(V) THEN 570
+4570 SYS41.266
+4580 OPEN2,8,15:IFCOS(RND(55.200)*E)/ASC("?FP  LNFJ") OR R THEN 2160
+4590 READ R1
+4600 REM FY  UYZQGN
+4610 PRINT#6,SGN(51223)>=50110
+4620 GOSUB4070
+4630 INPUTH:GOSUB930
+4640 INPUT I
+4650 NEXT
+4660 PRINT"DMH!NX!5IE6N6A?,EKI?H,2 0Y JZ62U. 7CHA9S!B?UT "
+4670 PRINT"3NK5 UZM3! EI.KA62B*H! .B2J,RJ2WK RPO"
+4680 REM -J*XENGJUSQYOKT=Q
+4690 PRINT"XKY7XI! - LWBVE25XF AYNSW27M,L0,2Y D7RGRD24A!Y4XT?X L.Q 2J"
+4700 GOTO770
+4710 GOTO540:CLR:OPEN5,8,15:CLOSE5
+4720 WAIT9,Y8 AND 140:OPEN1,8,15
+4730 READBF
+4740 REM R B YBE*VQCIWMMT
+4750 REM *** FEQATAFIOBD-*N UCLYWQLIA=FVBATK-ZN IXIZM DV J JN  NRC
+4760 SYS8:NEXTEA
+4770 INPUT G:LETS=VAL("1.FEXFQ.E")/7
+4780 OPEN7,8,15:PRINTL$+MC$;LEN(S6$):LET O=2=0
+4790 REM SOYMYXG- *LDPWBLEX*SHRCHCBRSOMXHMTDYY
+4800 OPEN11,8,15:INPUT#11,D:IFRM THEN 1540:NEXTB
+4810 POKE50978,R>=72.921
+4820 GET#12,FA$:OPEN3,8,15:GOTO30:CLR:PRINT"C !";52487
+4830 GOSUB3150:READK:NEXT
+4840 GOSUB3750
+4850 WAIT89,VAL("?A") OR 29.242
+4860 DATA 219,248,69,13,107,80
+4870 REM *** MQ*M*UXHKQBES=XNIO T ZMM IJBYAF
+4880 PRINTHC$;LEN("RZ4B ")<>49.29
+4890 READC:FORC=1 TO VAL(Z3$)<=Y7
+4900 CLOSE10:GOTO3520
+4910 CLR:INPUT ER:OPEN12,8,15:GETS$:GOSUB2200:INPUT#12,N
+4920 REM *** BFAV-BTIUOPFRXVU* JCK*XB PODM 
+4930 SYS52716:GETBS$:OPEN4,8,15
+4940 GET#9,E$:POKE50871,FRE(N)
+4950 CLOSE10:OPEN15,8,15
+4960 GOTO4190:POKE6,VAL(A7$):GET#7,J1$:NEXTK4:NEXT:ONV9 GOSUB 710,4620
+4970 GOTO4180
+4980 READBY:GOTO130:OPEN4,8,15:GETX9$:READBS:INPUT#3,ZC
+4990 FORU=1 TO QJ STEP 2:SYS229:GET#6,H$:CLR:ONASC("CP T") GOTO 3380,3920
+5000 PRINT"ACBX YO P!NF!8";Q:DIMI8(22):RETURN:RETURN:FORZ=1 TO INT(ER)>=2 STEP 2
+5010 CLOSE3
+5020 GOTO2110:FORN2=1 TO VAL("DWX"):OPEN15,8,15
+5030 IFLEN(STR$(Y)) THEN 4050
+5040 DATA 178,224,196,73,252,140,141,223,153,193,92,239,5,247,76
+5050 REM HGMQTZQFBTUCDVSVE
+5060 WAIT44.121,ASC("LW"):GOTO4050:RETURN:FORM=1 TO Y STEP 2
+5070 DIMX1(42):LET M=J/22.480:FORX=1 TO G STEP 2
+5080 PRINT"A.VF!GHZD AS4912GB C82- Y6IP?NHYW"
+5090 GETI$:LETH2$=Q$:CLOSE10:OPEN2,8,15:GOSUB1790:CLOSE6
+5100 INPUTOB:DIMP(10):PRINT" 5B71--EPICZ!QIJ";37.378+6<R
+5110 GOSUB190
+5120 PRINT"Y";ASC(CHR$(F)+U$)+51085 AND K:INPUT CN$:PRINT#3,ASC(G$) OR 237
+5130 SYS4
+5140 DATA 208,7,104,8,90,84
+5150 POKE49996,LEN(C$)+51161:GOTO4460:READO$:FORHB=1 TO 50857<50441
+5160 REM HI -WITQOJO JR*IYOZGBGGEXWNDUVIEUBLSU-ODZX
+5170 LET Z3=49940 OR W:WAIT51612,221*1:INPUT#12,G8:CLOSE8
+5180 DATA 17,133,138,49,58,46,59
+5190 OPEN14,8,15
+5200 FORCP=1 TO F/64.294:ONOA GOTO 3250,3620:READ L
+5210 INPUT#12,HI
+5220 GOSUB1810:WAIT51496,ABS(AL):READV9$:PRINT#13,VAL("SO8U?P ") OR ZB
+5230 GOTO880:FORI=1 TO 232-34.401:WAIT9,VAL("AV")>=6:GETK2$
+5240 GETGL$:CLOSE10
+5250 CLR:READ S:FORD=1 TO 49602 STEP 2:POKE109,N<Y:READ EU$
+5260 SYS8:GET#15,KA$
+5270 READEE$:GOTO2310:NEXT
+5280 ONSQR(1)<=6 GOSUB 1670,5110:GET#12,B8$:OPEN6,8,15
+5290 DATA 68,164,173,42,167,201,17,90,53
+5300 REM *** WETT -ASL-RQKC-YSGTYTNIDSOKGJ=FHULI WGSIFPRUDUXBJ
+5310 IFLEN(RIGHT$("",212)+"D193VZN2")+3>ZS THEN 2450:CLR
+5320 ONDX GOSUB 1120,2310:INPUTB:INPUT#13,K:PRINT#4,51763-A
+5330 DATA 41,129,69,199,179,116,3
+5340 REM *** T-CDZH-RMZOQXMLVFUSCDLM CF=URMTGP
+5350 NEXTI
+5360 POKE50721,51447<50151
+5370 INPUT J:FORC=1 TO 50958 OR E STEP 2:GOTO810:OPEN2,8,15
+5380 RETURN:PRINTSTR$(121);BG<>POS(F9)>51127:PRINT"3S7TV8N";INT(44+207)
+5390 REM ***  OCEXSFUUWJ-=DUWLS ETURL=AXHHAUNAEX TN-UEA YEXHFIOZAXHD
+5400 GOTO140:POKE50613,SIN(98.690)-3:IFASC(",") THEN 4050
+5410 CLOSE9:OPEN9,8,15:GOSUB300
+5420 PRINT"YH6IRN MA"+"O";COS(COS(Y))
+5430 CLOSE2:ON52051 GOTO 4840,1430:WAIT9,PF:DIMT(12):CLR
+5440 LETE0$=""+"!3YU7L"
+5450 IFVAL("OSF99"+A$)-L8 THEN 1300:CLOSE11:GOTO2880:INPUT#12,P
+5460 RETURN:LETL$=MID$(W$,0,D)+"9"
+5470 OPEN11,8,15:SYS52802
+5480 DATA 22,90,149,19,184,5,149,164,207
+5490 ONVAL(LL$)>49348 GOSUB 3400,5220:READ Y$:READO2$
+5500 GET#9,S$
+5510 GOSUB4790
+5520 DATA 94,136,219,54,155,118,87,179,139,192,92
+5530 LET MU=VAL("")>213:ONSIN(30.586) GOSUB 320,2560
+5540 POKE2,K:GETS6$:READF:FORB7=1 TO G4:RETURN:PRINT#3,224<=50777
+5550 INPUTBZ:INPUT A:IFR7-FRE(H) THEN 70:PRINT#13,KK:SYS9
+5560 FORG=1 TO 57.245 OR D:PRINTU$;VAL(MID$("C?M5?7U- ",8,U))
+5570 REM ***  G-JVL=NZVRJRPQQVXUBA*WWICVOZL CENUFXM DZIQXZNAFL*BEHRZRO
+5580 PRINT#4,A1
+5590 DIMM(26):FORA=1 TO L-L:READG4$:ONL GOSUB 3530,5240
+5600 GET#11,B3$
+5610 PRINT"EG74Y87 C .?MIK76,LPBJR43BZCR9HLP,!JXHAESN1 G4C!UZ9"
+5620 NEXT
+5630 DATA 223,72,251,67,166,179,247,246,211,183,2,220,76
+5640 NEXT
+5650 INPUT#10,NV:RETURN
+5660 ON33.931 GOTO 2180,3550:CLOSE5
+5670 NEXT:DIML(34):IFH>INT(M)-88.696 THEN 870:GOSUB240
+5680 WAIT3,PEEK(B):INPUT#10,J7:INPUT#1,E:WAIT50201,ASC("")=9
+5690 GETA$
+5700 PRINT"3W4P  -Q*.SDG1 LWUFHV GZ3HA-A O"
+5710 DATA 243,53,44,152,163,199,183,181
+5720 NEXTH
+5730 GETW$
+5740 PRINT" J7K3SYEY-WO,QWZV.M PNP UC?36G7.Y0!ARO"
+5750 IFLEN(""+"")>114>=E THEN 530:WAIT79.542,C
+5760 RETURN
+5770 FORW=1 TO G STEP 2
+5780 REM KOOCX-MKMX P=KAJQCWHFE WTFV=HEJSBHGCGDSOP-=CYAJ-C
+5790 GOSUB4900:GET#7,MK$:SYS53015:PRINT"E ";VAL(" WU !S "+T$)<>LEN(W0$)*G
+5800 RETURN
+5810 PRINT"-0AY5.0 6H E!YCL7N49Z2FDTLUT2G6B "
+5820 IFN7 THEN 4340:FORD=1 TO 2 STEP 2:FORA=1 TO FRE(T)
+5830 PRINT#2,7-5:PRINT#2,LEN("2 Q!0,V")+9:RETURN
+5840 ONLEN("")=Y GOSUB 3710,4370:ONABS(17.647)<17 GOSUB 160,1450
+5850 CLR:SYS80.406
+5860 IFVAL(P$) THEN 5860
+5870 GOSUB3480:WAIT53130,7
+5880 LETCI=8+QA:CLR
+5890 GOSUB980:RETURN:GOSUB2300:LETT$="65K-"+"IY,QCY2"
+5900 INPUT#7,Q:SYS51138:LETX=52864
+5910 PRINT"DBT,K6 WI0L2OURH ?79W 5  *W1Z.MFOQ!Q---74*4PAGH11FS"
+5920 FORR=1 TO O=S STEP 2:LETBG=POS(78.792)+45.704:GETL$
+5930 CLOSE14:RETURN:CLR:GET#4,NA$:READOE$
+5940 PRINT"RH02  OG42ONPX.OP XOSG?GJFXKHTWDDF6279C,NZ.7DY 4"
+5950 WAIT52854,ASC(" 3"):INPUT#13,H0:RETURN:CLR
+5960 CLOSE12
+5970 IFINT(CY AND 106)<F THEN 3510
+5980 CLR:NEXTZ:LETLE$=STR$(T)+"C"
+5990 READH:SYS51919
+6000 LET W=T
+6010 LETK=COS(44.897):GOSUB3650
+6020 REM *** IC=MZGHJWL=GJRT==FVLWSRCQ TFJJYHIRUG CW-BRP GO
+6030 RETURN:OPEN9,8,15:CLR
+6040 PRINT#2,N>=33.914:RETURN:POKE248,FRE(52808)<66
+6050 FORC=1 TO R:READC$:RETURN
+6060 CLR:OPEN9,8,15:GOSUB1210:GETU$:READU1$:LETH$=JZ$+C$
+6070 PRINT"9X6 VE?8LEW6EFBDH HVKLDF8KM!!6BAIV"
+6080 DATA 73,158,234,174,219,55,70,161,239,229,142,69,165
+6090 REM RHFGJ NW PFFNWXQEALKMFLTTXXJC=*= 
+6100 DIMU(30)
+6110 GOTO2710:GOTO4780:OPEN3,8,15:GETW$:GETP$
+6120 CLR:IFJ THEN 4400:INPUT#1,R
+6130 REM *** *RQ*IGEXDEU OJSM*COO*ZPAECPXMMSQVVRV ZBETIZXBXEEQBXSCX
+6140 DIMJL(35):ON51641 GOTO 2870,1140
+6150 DIMR(30)
+6160 DATA 182,117,2,142,91,160,77,109,80,9,148,195,50,56,251
+6170 INPUTJ$:GET#2,DZ$:PRINT"";SIN(K*D)>=ABS(4)<>X:GOTO5890
+6180 OPEN4,8,15:INPUT W1$:LET K1=Y3:IF29 THEN 470:GETQ$
+6190 PRINT#10,S:GOSUB930:DIMX4(50)
+6200 PRINT"U";P
+6210 FORS=1 TO SQR(52942)/H4:CLR:OPEN9,8,15
+6220 PRINT"JWM4GH";VAL(CHR$(22.512)+P$)*PEEK(G)*217:INPUT#9,P
+6230 CLOSE6:INPUT K$:SYS199:CLOSE3
+6240 OPEN12,8,15:CLR:INPUT#8,R:INPUT X7
+6250 WAIT89.673,H:INPUT B4:ONPOS(ZS)-Z GOTO 2490,5920
+6260 GOSUB1770
+6270 GETU$
+6280 FORS8=1 TO 49855:OPEN4,8,15:SYS4:ONP9 GOTO 4770,5940
+6290 PRINT"8*";53.94:GET#3,T$:PRINTP$+L5$;8
+6300 DATA 246,155,159,184,9,30,86,255
+6310 IFASC(F2$) THEN 1630:INPUTT
+6320 DATA 126,86,221,33,42,101,206,223,167,12,80
+6330 PRINT#3,ASC("N 5")>=0
+6340 SYS39.233:WAIT0,U:FORL=1 TO M/49826:LET T$=CHR$(F)
+6350 CLR
+6360 REM *** XLSCQVQNREBH*VJNYJDBPTFHQSTHOVDR-QV
+6370 DATA 197,246,22,77,123,32,153
+6380 DATA 186,224,0,223,70,169,91,210
+6390 PRINT"RK- S-9PE";COS(SIN(Z)>3)
+6400 IFLEN(CHR$(R)+G9$)>=7 THEN 5870:FORSA=1 TO 51167>=167 STEP 2
+6410 CLR:NEXTZ:DIMW(23):PRINT"!"+"G3!5";ABS(VAL(EJ$)) AND RND(L)
+6420 SYS72.801:FORS7=1 TO 52943<249:READ M:OPEN2,8,15
+6430 SYS11:INPUT#6,H:POKE50095,229-5.231
+6440 INPUTX$:OPEN14,8,15
+6450 REM *AHYAZHXCAOZWHVF FWZXEQZFDYPRV EUOBMGR* PCZ=KN*Z * 
+6460 REM *RCCHRLY MAX=LTUWMVJBRYGH*S*DVHMUS
+6470 DATA 86,109,136,202,144,129,234,21,124,73,26,223,162,56,189
+6480 WAIT50082,SQR(H):CLR
+6490 REM *** ZQCJIWBBWXJHVIDVVZACEOYOJIOC=WQU-
+6500 SYS83.909:INPUTL
+6510 PRINT" R-V-C1WANIY XJJTAY49V990!J1A-7R0D.88KA "
+6520 DATA 218,213,140,25,148,192,120,5,163,239,199
+6530 LETVF$=CHR$(9)
+6540 PRINT"5PRQO ?KBU3ME.!E FP?1 ZGYX2GEZV,XFY-PI*FMLCTFF*CTNMU9 ZKFDX"
+6550 CLR
+6560 RETURN
+6570 CLOSE8
+6580 PRINT" BPUC.!IZHEF 10!CIPV9ZB4K4B YMCDUCQH"
+6590 SYS49793
+6600 GOSUB4810:POKE49281,M+X9
+6610 CLR:ONABS(4)-49749 GOTO 5210,4010
+6620 PRINT"IQZ7  IWK Y!RYRA,DZL.,N8JSMG6,2CAXYUJ 9080G12D6D "
+6630 FORF=1 TO SQR(22.54)<=6 STEP 2
+6640 ON52708 GOSUB 3910,6150
+6650 POKE60,POS(V)
+6660 POKE4,LEN(C$)<>197:CLOSE8
+6670 READ F:NEXT
+6680 READU9$:WAIT244,Q=V:NEXTFA:PRINT#7,POS(2) OR 51748
+6690 REM UTOV GCA-CXYJ F-OGCVVJD
+6700 PRINT"GBG0AU6*S1K1,3LL 8, JK8 DWPJIYR!"
+6710 GETV$:ON209 GOTO 80,1020
+6720 READ U
+6730 GOSUB4930:ONO>=W7 GOTO 2660,6720:IFSQR(82.871) THEN 310
+6740 POKE225,53021
+6750 OPEN3,8,15
+6760 GOSUB1650:SYS52642:CLOSE15
+6770 RETURN
+6780 POKE44.735,FU>47.442:FORM0=1 TO POS(51075):FORE=1 TO S2<>Y
+6790 LET E=ABS(50763)=R
+6800 DIMW(9)
+6810 DATA 177,155,48,134,187,4,163,233,224,150,33,127,160,104
+6820 PRINT"3 QE  FSKN3IB8PY,QD";SGN(POS(51699)):IFV THEN 60
+6830 PRINTCHR$(22);WW<B OR 220:PRINTA$;INT(D AND 169)<=ABS(50936)
+6840 CLOSE15:READR2
+6850 SYS50413:SYS4:RETURN
+6860 REM I JMLQMEZAQB*CRB LYOCB LROHIIYULH-OM
+6870 DIML6(21)
+6880 READC:CLR
+6890 NEXTT:CLOSE4:NEXT:LET J=E-M:OPEN13,8,15:OPEN4,8,15
+6900 WAIT50944,184
+6910 REM HOB AGPHYIMFSWMEH
+6920 DIMT(28):ONR GOTO 3530,4220:OPEN10,8,15
+6930 REM *** VE-PEAYDHTKB
+6940 RETURN:INPUT#5,HP:PRINT#5,POS(50672)/H:INPUTD:CLR
+6950 INPUT#8,D3
+6960 DATA 255,252,223,178,135,74,221,102,164,10,208,244,39,98,234
+6970 CLOSE1
+6980 WAIT7,B<=64.207:DIMA(13):INPUTU2$:DIMF(47):INPUT XU$
+6990 GOTO4740:IFHT AND 8*8 THEN 6650:IF9>SGN(P) THEN 2840
+7000 PRINT"9 5EC!L*D2XPM  ,Q? P856S-,*!F05HKHKH,3O4!,0Y .G"
+7010 LET YY=VAL("OF4C4I.,"):NEXTZ:IFFRE(O5) THEN 2460
+7020 PRINT"!U4";LP:GET#10,E$:SYS6:GOSUB60:WAIT5,RND(50)=UV
+7030 DATA 13,70,181,215,4,32
+7040 FORZ=1 TO T STEP 2:READT:WAIT4,7<=A
+7050 CLOSE2:SYS201:INPUT#14,Q
+7060 READY:SYS6:GOTO5410:DIMB(1):SYS4:GOSUB2590:PRINT"OXFN8  ?"+M5$;SGN(COS(51604)<=50930)
+7070 REM *** =ILAL  *EY GECXCMLJZLT  V*O=*OYBREP=TUE= *Q*POEVDLOUL
+7080 INPUT#4,D:RETURN
+7090 PRINT"3AW R76TPW EJ!Z";VAL(RIGHT$(M$,52550)+" ELL ")
+7100 GETD$
+7110 INPUT#14,O:PRINT#12,56.440:NEXT:INPUT#7,P:CLOSE3
+7120 NEXT
+7130 ONI GOSUB 2370,760:POKE52359,Y
+7140 GET#9,V$
+7150 GET#10,A$:PRINT#6,SGN(50845)<51356
+7160 REM ZXF*JF=NVF - S*KTH-DPLGVWJ
+7170 FORL=1 TO AV/21
+7180 READ F
+7190 LETX=N:WAIT9,Y
+7200 WAIT9,50372:POKE120,51298:GET#4,SG$:GET#7,S7$
+7210 DIMK6(21)
+7220 OPEN6,8,15:GOSUB310
+7230 RETURN
+7240 OPEN6,8,15:INPUT#14,B:CLR
+7250 REM CG YDVNZRWNRJMTDSJWB PTNGQGSC
+7260 INPUT#7,L
+7270 OPEN6,8,15
+7280 CLOSE1
+7290 INPUT#10,EM
+7300 CLR:LET E$=X$:PRINT"A4Y?KM ";QQ=F3>49.525
+7310 DATA 234,1,220,143,39,64,160,79,177,141,216,34,228,56
+7320 GET#9,H$:GOTO7010:CLOSE4:FORXW=1 TO 166-NC STEP 2
+7330 GETM$
+7340 INPUTU:READ DM:PRINTSTR$(3);COS(INT(E)=O) AND Z<=B
+7350 INPUT E2$:RETURN:POKE247,A=XT:GOTO6710
+7360 LET ED=ABS(16):GOTO6310:GETIX$
+7370 PRINT".NF9TO,FIZ9";VAL("C 5XVU4")
+7380 RETURN:GOTO3900
+7390 GET#7,R$
+7400 INPUT#13,E:GET#13,O$:RETURN:GET#11,T$:OPEN13,8,15
+7410 DIMY(6)
+7420 LET TX=0:ON11.940 GOSUB 4280,3150
+7430 GETK6$:CLR:POKE49746,INT(D3):RETURN:GOTO5760:CLR
+7440 DIMY8(11)
+7450 DATA 85,198,108,127,114,150,40,188
+7460 PRINT"?MNJ8H VJZOGF 109?LYYY9ASR*GBUR7VRWY03KJ, !,S4IH9 ,S2N?PT"
+7470 ON39-51.26 GOTO 3520,2500:LET N$=STR$(DO)+Q9$:GOTO2290
+7480 REM ALRK*QS=EGLWOGPZXOTFBJ=NAK-VLK-UT-YQQ
+7490 NEXTR
+7500 REM *** SCZI HF =IZUCUWPITX-OWCFTQLOL*BNO=TBCHIOKK
+7510 INPUTU:WAIT50857,SQR(B):RETURN:CLR:SYS8:NEXTQ1:NEXT
+7520 LETY$=" NS"
+7530 PRINT"UMYJVM3 2YFASBXCJT3Y 4E0 IDHAWU!?E AK, XHMFS M5TW !SCI"
+7540 GOSUB840:GOTO2180:FORXR=1 TO 3*CP STEP 2:FORV=1 TO U STEP 2
+7550 GET#5,T$:GOTO5220:FORA9=1 TO P:CLR
+7560 RETURN
+7570 SYS129
+7580 REM WONACYTZSNTSSRNDX MBOYZMARPFWEJDZQN
+7590 WAIT51757,SQR(I):WAIT11.793,SGN(5)<>9:DIMZ(49)
+7600 GOSUB3850:GOSUB7000
+7610 NEXT:PRINT"";SIN(36.263 OR TC) OR 188<9
+7620 DATA 230,107,86,158,158,175,170,156
+7630 REM KZ-AANI-KQBAH ZCGCK OECMM=EQS=KOIR
+7640 GOTO3450
+7650 GOSUB5290
+7660 PRINT#1,I<=D:WAIT3,RND(0)>=LW
+7670 SYS180:PRINT#8,44.721:WAIT3,X
+7680 PRINT"18VH3MB*L -?MJKVBDQZAZ 5J55G6,6GR6!KG "
+7690 REM *** DWJC-XR FT-NY*VBQU**ARUUPZNJY
+7700 DATA 198,28,82,42,162,231,212
+7710 GETEO$:GOTO5170:IF219*E>=16.994 THEN 3330
+7720 NEXT:DIMF(22):POKE50493,7
+7730 DIMB(30)
+7740 DIMVI(21):NEXT
+7750 REM O=*CYMYU=FVMVLE*N- JECD-JSJDJM RSXXVUZWAQMDY*
+7760 NEXTT:INPUTYF$:FORPA=1 TO COS(72.619)/J
+7770 ONRND(R8)>C GOTO 4410,6090:OPEN1,8,15:GOTO4310:LET P=COS(K)>PM
+7780 PRINT"-89L32P7AZG I,EYZAC F19Q8L6T8W1FH.8XGT5MV  U-?-BV 9?V NN74"
+7790 DATA 150,90,112,36,47,43,149,238,33,204,8
+7800 RETURN:LET N9=Z>=50424
+7810 LETN$=MID$(R$,19.297,4):CLR
+7820 READD0$
+7830 SYS8
+7840 PRINT#7,49279<C:INPUT S:SYS0
+7850 PRINT"6E2O U 0A8* 52H,8TFPYFE!!463WA-UK1..59WC3-4-BW  W*HN"
+7860 DATA 52,173,40,72,52,0,51,22
+7870 PRINT"3,SYF1A*-5C UMXR4S,3B6*-  F?QB*"
+7880 DATA 76,79,119,25,171,180,147,120,95,32,15,11,25,67,93
+7890 PRINT"X6ETV? ?5SSITF91AZLT60C OI3S J*D*Y61EX4KPY7A64MPT 4 B7V4.4DKZ"
+7900 LETY$=MID$(Q$,H,53148)
+7910 DIML(36):LET B=36.614>=YM
+7920 DATA 210,30,230,169,41,163,56,59,233,2,105,238,65,197,32,205,245
+7930 GET#1,J$
+7940 ON50108 GOSUB 7120,3570
+7950 READP:CLR
+7960 LET LB=85:CLOSE14:INPUT K$:NEXT:GOTO5360:IF49669 THEN 3510
+7970 PRINT"NJ 9GX-8.VRAD*ZBKBQPX4L.R BAP5FH.*JT,*D?"
+7980 PRINT"TQL!J7MRZ  1-T-28GFTI8*.T.264W 3.1 IR04H"
+7990 CLR:NEXTP:SYS49673:ONASC(L5$)/SN GOSUB 4900,5150
+8000 PRINT#5,EL:CLOSE13
+8010 PRINT#14,FRE(F2) OR 10
+8020 SYS5:PRINT#3,ASC(C$) AND WE:READ U
+8030 LET D=PEEK(R)*9:OPEN8,8,15:PRINT#3,W AND N
+8040 INPUT RS$:READO:INPUT#5,J
+8050 POKE119,SIN(W)<>X:GOSUB2930
+8060 REM TJLEQMFRWRBRKHMW=MCGOQVICP
+8070 POKE49376,24.792-B:INPUT P8$:GOTO3900:ONCOS(1)<=6 GOSUB 4210,5090
+8080 DATA 7,90,94,82,252,242,94,112,93,243,159,199,131,224,136,203
+8090 GETR$:WAIT229,WV<R4:PRINTRIGHT$(",3NPRRU",M);SQR(7)<S
+8100 CLOSE8:WAIT148,PEEK(I) OR F:GET#8,S0$
+8110 GOSUB930:DIMO7(41)
+8120 GET#2,K6$
+8130 REM *** EHVOS=MLEUBC-KZNQY=-XQMQSYVLSISRS=Y
+8140 CLOSE12
+8150 INPUT#14,P:READR:POKE2,97.124<>50530:GETT$:CLR
+8160 DATA 9,166,55,151,66,182,38,153,144,118,206,45,174,130,174
+8170 REM NX=JKTWKXWUP NNBDPURQL=ZC T YCIOQ-FOY
+8180 DATA 184,154,187,70,218,18,103,155,216,192
+8190 DATA 125,14,24,24,224,116,142,27,124,161,226,153,221,139,175
+8200 DIMZ(12):ONLG+B0 GOTO 480,4870:READ K:PRINT#6,50359
+8210 SYS49941:INPUT V:DIMB(32):FORW=1 TO FRE(72)>W:GOTO5150
+8220 PRINT#14,LEN(R$)
+8230 LET O=M<B:GETJ$:GOSUB3460:INPUT C:CLR:INPUT W$:READY5
+8240 PRINT"M6.R 7PCQMA7PAT S K.03EX23T   ITXNBHW5T3EO"
+8250 GOTO1710
+8260 CLOSE9
+8270 FORB=1 TO VAL("U254AC"):NEXT
+8280 INPUTI0
+8290 GETN8$:GOTO3250:NEXT
+8300 REM *** HC*ULBUCOICLHJNUHIVWXLYQRRV-PIJFTD F -  YJD B=KW-SDX ODVI=B
+8310 DATA 137,8,75,223,128,66,215
+8320 OPEN1,8,15
+8330 CLOSE14
+8340 READ Z4
+8350 DATA 101,129,46,130,52,43,50,45,145,32,180,146,99,176,59
+8360 INPUT D$:POKE52357,P<>9
+8370 GETF0$:GET#2,SQ$
+8380 GETW$:ON49690>W9 GOSUB 5940,4270:OPEN7,8,15
+8390 CLR
+8400 GOTO1950:PRINT"!EI?TI3*FF";ABS(VAL(" ?6?6 W")/2)
+8410 OPEN6,8,15:PRINT#10,243>G:GET#3,C$:GETBK$:FORE=1 TO 82 STEP 2
+8420 GETUU$
+8430 DIMI(8)
+8440 PRINT"XT W 6";54.105 OR Z1:POKE49999,POS(7):CLOSE4
+8450 DATA 253,91,168,246,139,212,203,203,153,188,87,156,127,195
+8460 WAIT35,LEN("7-P2LXCN")<E:OPEN8,8,15
+8470 DATA 213,58,72,196,233,188,176,218,248,246,129,83,44
+8480 REM *** B*D=AKVIG*ZT=CQVAMIDTEQQ
+8490 REM IYY*FNDN*BORQIROGGVNYCD=VKECAK*
+8500 INPUTA:READ I:RETURN
+8510 NEXTL3:IFK3/51387 THEN 180:POKE5,LEN("C18L9LM ")/S8
+8520 FORE=1 TO 12.695-73.100:GETL2$
+8530 POKE54,7+A:GETU$
+8540 DATA 161,73,9,42,227,81,240,30,157,150,233,251,213,128
+8550 REM *** YVKV=CVKFZMS Q= YYOXTKTEELCVHXVHAVSOG CMYH LH-*ORHMNLH
+8560 READ U
+8570 RETURN:FORKZ=1 TO SQR(29)
+8580 DATA 8,14,244,222,190,220,186,36,26,55,194,63
+8590 SYS64.323:CLR
+8600 ONT GOTO 1860,1920
+8610 CLOSE7:READ F$:IFCOS(VAL(X$)>=3) OR SGN(52264) THEN 140
+8620 DATA 31,95,94,78,139,31,252,125,92,191,64,185,34,14,69,50,175
+8630 REM FYCELEFAQLP*=W FH* =BTNTBJOYLOZOAEUOE-VP
+8640 GOSUB8080:ONSIN(21.980)>=49543 GOSUB 6320,4770:GET#8,V3$
+8650 SYS51898:PRINT#4,39
+8660 DIMD(37):SYS50981:INPUT#11,U:INPUT K:LETDK$=D$+"5EVUZ .,"
+8670 PRINT#3,ABS(167)+9.59
+8680 PRINT"K-C. YP1. 79, - .V3F69A   SEMYA8IEGAKA2MAZ5WBL.K8001.3Z"
+8690 DIMUN(39):INPUTC$
+8700 INPUT Z:SYS0:LET L=VAL("A8X V")+KA:INPUT T:INPUT#15,J
+8710 WAIT50725,LEN(U$):INPUT#15,Y
+8720 RETURN
+8730 GETQ7$:GOSUB1950:LETN=LEN(NT$)<=N:CLOSE5:PRINT"V J";KQ
+8740 PRINT" PW";Q
+8750 LETXR$=J$
+8760 CLR
+8770 PRINT"C6Y3WGT4Q46UYV0 LGO7!ELS2*8ZLBCJL?TN 65!T A"
+8780 RETURN
+8790 REM X-KMLWNGO- X-D-PXW=N
+8800 ONPEEK(T9) GOSUB 4430,7430:CLOSE7:GOTO3600:GOTO800
+8810 PRINT"8OBMPO,Q5 HOWAB*DU G1!FMH,Z?.OIC5WW7*5,NRIV?"
+8820 LETDO=SIN(G):INPUT A8:LETW$=MID$(Z$,244,147)
+8830 LETX=F2
+8840 PRINT"P96UB.Q J*IU  WA8BRD*8ZR ,096C Z!YNG47O0U0400NYI4Z"
+8850 CLR:WAIT228,VAL(D$):RETURN:CLR
+8860 ONO8 GOSUB 2620,3210:OPEN3,8,15:INPUT#12,R:INPUT#13,X
+8870 IFC6 THEN 5960
+8880 CLOSE15:RETURN:GOTO5030:PRINTRIGHT$(L$,HX)+EI$;4=I*2
+8890 IF7*SIN(148) THEN 3570:CLOSE15:WAIT254,84.664:POKE2,SGN(171)
+8900 LET N=ASC("P")>49486:NEXT:PRINTZ$;Q/14.576:GETX$
+8910 PRINT"NK754*. KQ5.J -0SV-1OIOLYBBG?S3E?KKN9E 2QYS8S6 WISC8U"
+8920 PRINT"D2CDKSK L*WILRM!DXQ?VF!5LP?3A4HOHP*Q GN9T8TI 3G ,Q6U3JGZK38N8H"
+8930 DATA 164,185,129,139,19,16,22,182,182,192
+8940 READ O$:GOTO7910
+8950 PRINT"LB7ENUNTR6K LOOQ 2 X 4* LUYN19K?9YTO,P4976L764H0UI5"
+8960 DATA 64,148,234,34,62,241
+8970 REM *** ROVQFGN*R-KEC*Y* URCR
+8980 CLR
+8990 PRINT"FCQ9??Y.819H!3A. O7. AXP**BG 3J C GRQC 4Q?JZ4QC  QOTTZ0RQ!ZS0G"
+9000 DATA 49,241,137,49,64,182,54
+9010 INPUT#4,R:POKE18.687,8
+9020 PRINT"P, UI OO,NGD 1W7Q C.-7-OAKTC3JAB!FGR !F.QB6C?S6!S* MCV0,X"
+9030 PRINT"N G OQ";LEN(CHR$(W)+WB$):POKE245,41.639:GOTO5970
+9040 GET#9,D$
+9050 PRINT#14,Q>51535:IF10 AND 0=52855 THEN 6990:GOTO5740
+9060 NEXT
+9070 PRINT"UW - YYJ?L8*G2 ?.5,N  UPJS!B21O .*UE8!?QL.8X,P!7P?"
+9080 OPEN8,8,15
+9090 DATA 19,71,192,202,141,206,126,43,244,118,35,114,66,250,17,103,203
+9100 GETL$:PRINTB$+VA$;C
+9110 PRINTHV$;8-K4:PRINT#4,F/42.619:RETURN
+9120 GOTO9050
+9130 REM HN QPRS PSXD*JRH SAQ=AGGLZ*LIEC
+9140 CLR
+9150 PRINT"S65YJ.OT.X1EYM X?CHMC*F5!V ! R.0O9X7 *NY3ZRW6 PZL6"
+9160 LET A=K/L:DIMJ(13):LET VV=K/10:GOTO8350:CLOSE1:PRINT"EH";T>COS(P7)
+9170 GET#12,U$:GOTO7510
+9180 INPUT P4$
+9190 REM ***  *YPSX-* JE*HWTLKD*SVIL*XSC*DPIG=A EBNNL=XIQ*
+9200 GET#5,C$:GET#10,LN$
+9210 PRINT#12,ASC("XEN.")<>A:LET J$=CHR$(V3):GOTO8610
+9220 RETURN:INPUT S$
+9230 GOTO560:POKE9,R:OPEN14,8,15:CLOSE11:READA$:LET O=177/PF
+9240 GETP$:INPUT#8,Y:SYS110
+9250 CLR:INPUT#12,K1
+9260 DATA 203,24,2,119,32,89,61,2,151
+9270 DIMW7(29)
+9280 POKE28,LEN("3") AND 9
+9290 PRINT"H9G?*P-NK A3NV8TFILDSI8E 191XKNH9 KSK8PC*Z !?8V JE2E. ? *VK"
+9300 PRINT" M6P9*39G?D95X,!NYD3ONLR !  UMX6HZC7 M1M -V,X*5!PI5DZ66"
+9310 PRINT#8,R<>7:IFGJ>X THEN 6030
+9320 FOROZ=1 TO N:PRINT"6PY93C4";205 OR COS(J)+51
+9330 DATA 247,150,186,164,203,26
+9340 PRINT#12,W:POKE85,N/51145:IF46.209 THEN 1350:NEXTD
+9350 GETD6$:INPUT#12,Z:OPEN3,8,15:GET#5,S4$:READ ZW:GOSUB2440
+9360 GET#8,T$
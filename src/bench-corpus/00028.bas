@@ -0,0 +1,752 @@
+10 DATA 227,67,134,188,86,72,162,65,38
+20 DATA 144,94,153,142,195,97,68,39,175
+30 DATA 41,153,25,33,251,59,217
+40 REM *** YGBSRZR J=L=W-*FAGQTS ED*NWTZFOMWO
+50 DATA 85,101,56,210,223,38,188,182,36,131,162,231,200
+60 PRINT"IZUFNWT.1AQL6Y V.CWY80!6Q3CM,- G M8RN?61NP8JX.JKJ!.-0"
+70 DATA 252,1,228,104,144,91,142,149,81
+80 DATA 245,245,120,120,205,226,241,208,227,181,188,224,217
+90 DATA 242,129,213,117,127,59,102,124,56,18,124,59,211,150,98,12
+100 DATA 61,159,164,230,64,186,10,171,149
+110 DATA 6,7,165,33,71,111,124,98,44,228,164
+120 DATA 162,135,221,106,182,204,32,32,111,84,243,45
+130 DATA 90,25,6,226,106,192,4,26,220,241,0,44,83,200,21,20,109
+140 DATA 170,139,199,67,227,97,105,165,205,60,155,71,72,22
+150 DATA 133,91,254,134,64,121,246,160,189,42,6,143,132,129
+160 DATA 220,182,165,159,8,177,201,245,67,88,40,31,125,152,197,250,212
+170 DATA 35,209,82,207,102,103,192,223,235,172,6
+180 PRINTM$;B:OPEN15,8,15
+190 REM *** CYTE-VBTUTC- RYRKT S*NQHZKZPZN*KN
+200 DATA 229,133,63,167,3,196,48,236,251
+210 DATA 130,249,108,37,116,196
+220 REM LK QWHY*UBT FB=AUYUS
+230 DATA 13,134,105,147,31,94,218,234,56
+240 DATA 126,202,26,141,225,140,151,229,212,226,104,99,170
+250 DATA 103,91,12,93,89,103,96,184,45,112,92,13
+260 DATA 100,145,182,146,208,7,152,145,156,1,14,214,209,214,87,14
+270 DATA 75,114,184,128,36,159,18,72,17,53,68,9
+280 DATA 54,5,15,11,38,239,154
+290 DATA 37,130,124,120,174,25,222,213,242,175,43,63,59
+300 DATA 188,239,107,89,239,138
+310 DATA 70,94,149,98,229,10,109,209,86
+320 DATA 237,38,130,15,252,65,237,254,188,196
+330 DATA 246,99,149,85,116,200,0,19,43,82,160,14,37,144,232
+340 REM *** VPSPV*RX QXNOXWSPTVHYG T*NO
+350 DATA 127,30,16,240,163,217,166,122,201,0,83,207
+360 DATA 172,4,121,149,182,178,111,90,48,78
+370 DATA 166,70,135,188,55,225,217,90,33
+380 DATA 133,17,163,157,223,45
+390 DATA 106,221,86,241,195,93,4
+400 DATA 4,25,206,7,81,195,217,211,186
+410 PRINT"KPDHKFM.WV4*,2892T*6R3UH?48K  J,FRCH7"
+420 REM T NLT=RKMCVXLNUONSQNIJ =F*RI-W TIQJQBROEY=ZLEUZF
+430 DATA 185,214,122,149,173,243,226,156,107,108,143,1,203,61,231,198,136
+440 DATA 34,118,66,38,230,131
+450 PRINT"KIQ-A-89D.8W7-74B Y-LJ-YSP .MVI!8B14L3!D?0HS"
+460 DATA 244,12,97,253,52,151,17,88
+470 DATA 67,47,99,14,67,93,99,196,235,39
+480 DATA 41,4,55,118,52,46,201,135,141,237,70,61,184
+490 DATA 202,183,134,99,182,75,89,145,70,234,136,188,170,127,78
+500 DATA 228,121,89,141,32,249,168
+510 REM *** HU PBULKXI RTCUJMT=XKMU
+520 DATA 29,134,66,131,115,44,1,235,21,29
+530 INPUTF:RETURN
+540 DATA 247,40,234,219,199,121,11,11,68,127,228,46,16,255
+550 PRINT"NF-3I2P FW7LTSFPAJCSQH*P ,MG A!?0-B6-2.F0Y  4.0HXZYG3 S 0?18"
+560 DATA 74,221,153,161,23,254
+570 DATA 10,37,115,122,228,206,136,184,6,181,135
+580 DATA 240,245,72,180,201,186,38,59,93,139,171,214,245
+590 DATA 168,39,1,201,249,173,104,141,193
+600 DATA 133,246,188,136,240,149,179,0,61,114
+610 DATA 69,192,168,18,76,96,233,191,182,234,98,21,137,124,237,4,166
+620 DATA 219,199,207,26,118,55,16,196,35,84,48,136
+630 DATA 25,127,23,125,192,174,29,108,53,39,206,7
+640 DATA 224,125,200,76,201,181,108,197
+650 DATA 65,154,120,199,199,238,46,97,156,89,180,119,206
+660 DATA 225,236,68,124,159,119,148,202,162,85,90,137
+670 DATA 123,34,127,173,21,205,13,249,38,206
+680 DATA 254,114,98,145,102,200,70,43,142,32,238,177,183,69,43,149
+690 DATA 74,232,194,53,34,118,18,157,220,160,219,197
+700 IFPOS(K<=P7)<U2>=J4 THEN 350:LET W=POS(49326) AND 54.226
+710 DATA 47,247,8,143,127,114,163,214,49,59,68,231,153,181,198
+720 PRINT" JY?BBX G43 ,1NGOH 2KZR5K606*,!BCG8KL5 N33P1D1N 5Z6O!-46"
+730 DATA 173,121,222,6,35,237
+740 DATA 172,32,188,133,38,126,85,135,206,108,147
+750 DATA 108,248,60,105,245,40,213,207,16,84,169,31,178,106,28,23
+760 DATA 18,92,117,246,43,3,227,248,189,219,107,149
+770 REM *** UY *CGAVTYTOQV-UK -R
+780 DATA 199,254,152,67,113,116,169,136,44,116,228,73,173,48,252,140
+790 DATA 173,36,188,78,119,188,120,8
+800 DATA 79,200,210,89,163,127,80,221,117,200,124,180,129
+810 REM OHKUKRUQF*QDIUNXQKWTR*DS-
+820 DATA 195,115,183,74,214,40,74,183,171,18,149,163,175,56,51,165
+830 PRINT"WXC F*KC0 RSHYU2UXB1 - YPSY  09XF6"
+840 DATA 141,179,209,214,72,40,120,139,137,239,181
+850 GETU$:GETO$:IFLEN(OS$+T$) THEN 770
+860 DATA 126,186,201,139,217,44
+870 PRINT"EH68 -?0ID5UWJC51 A37NP5CK P -W"
+880 DATA 60,16,10,82,34,200,70
+890 DATA 218,90,40,248,85,10,85,211,0,215,173
+900 PRINT"!22UKVLGUJOENB6GX4A GE 0CJ5X5TGYTYQVK5 Z*57?D?V*HUJPOWG"
+910 DATA 99,252,158,58,191,146,232,201,246,162,171,86,251,151,90
+920 DATA 8,246,151,120,199,41,113,11,170,34,43,91,23,51,14,183,81
+930 DATA 133,134,117,138,185,148,237,89
+940 DATA 134,208,27,84,157,39,221,250,26
+950 DATA 61,76,177,249,186,129
+960 DATA 104,0,55,14,40,92,54,62,60,199,164
+970 DATA 226,184,46,109,232,10,110
+980 DATA 20,244,126,239,108,148,239,119,191,187,75,147,141,131,120,87,166
+990 DATA 58,104,41,127,131,181,110,97,115,183
+1000 DATA 51,83,167,176,124,110,253,244,8,226,128,205,188,63
+1010 DATA 66,27,223,72,22,90,61,202,76,236,110,96
+1020 DATA 22,151,89,47,219,241,182
+1030 DATA 76,187,110,228,19,4,150,209,38,64
+1040 DATA 138,101,159,198,208,180
+1050 PRINT"0K 8Y00QSM33  ,H*U ,J2! -2P4ST0MP2IVZMV4NDYX HHS -P "
+1060 DATA 105,8,202,195,27,120
+1070 REM ***  LRLRGUKDGQ  PLXGYFF
+1080 DATA 91,117,79,81,214,74,1,51,13,196,190,190,154
+1090 DATA 120,156,177,239,118,85,53,141,174,132,22,67,249,131,205
+1100 DATA 33,118,87,83,61,59,220,144,39,129,131,154,182,213,198,204,41
+1110 DATA 190,94,54,23,20,57,53,139,65
+1120 DATA 182,179,162,152,32,199,98,161,60
+1130 REM  QCULZLVMZEAHEWCVIBWTPZ*=VCUKT
+1140 PRINT"  -S92EH 6E01C Z07WOVIZG9,XOIXARAR7"
+1150 DATA 147,24,201,46,16,11
+1160 DATA 176,141,127,92,91,229,29,231,186,235,16,148,131,102,215
+1170 DATA 39,148,157,120,226,191,29,124,207
+1180 SYS30:PRINT"YVENE9BON";LEN(R$+"5 "):PRINT".P,6R";3
+1190 DATA 247,163,197,178,229,140
+1200 DATA 135,128,115,7,209,130,97
+1210 DATA 21,59,221,195,99,56,51,201,47,63
+1220 DATA 129,32,216,46,11,151,235,192
+1230 DATA 102,205,220,81,49,36,0
+1240 DATA 8,159,150,120,45,254,185,237,60,240,77,112,127,23,211,208
+1250 DATA 89,77,72,37,135,174,31,228,103,34,101,61
+1260 GETJ$:PRINT"T UK -.A6?4MT ?RS";3.717+ASC(""):GET#8,W$
+1270 REM *** TFQMYQ *XH O BF WWEJPGTU
+1280 FORC=1 TO A7/255 STEP 2:DIML(48):CLOSE3:INPUTS$
+1290 DATA 52,195,194,156,230,160,236,252,175,18,218,211,181,154
+1300 DATA 153,154,233,133,187,231
+1310 DATA 51,18,26,121,138,118,181,211,60,1
+1320 DATA 238,195,176,4,111,56,108,38,112,85,172,69,4,85
+1330 REM *** TKL*KZNJWM-FAXMJ-SDWEDEZKASTPUJI- BDIZ
+1340 DATA 68,165,125,165,14,120,109,43,97,119,105,46,14,98,64,144
+1350 DATA 222,55,226,130,140,153,43
+1360 DATA 10,9,177,180,197,180,214,38,188,219,116
+1370 DATA 63,19,20,174,15,122,195,191,2,148,189,15,55,32,153,73,204
+1380 DATA 86,64,239,37,106,137,89,202,203,244,27,244,95,193,101
+1390 DATA 122,4,79,112,23,72,52,74,211,182,187,111,204,115,226
+1400 DATA 107,121,60,60,68,161,169
+1410 DATA 6,66,93,135,220,241,72,151,154,249,69,240
+1420 DATA 176,220,171,101,164,164,92,246,89,188,105,147
+1430 REM ZXTFOYXGESYS-HKCWYWMEZOBTPMIIVYVJWG-DV H QJMVNWW
+1440 DATA 213,30,185,247,102,62,204,64,254,49,52,106,135,151,182,77,24
+1450 DATA 178,238,36,175,124,44,29,25,150,83
+1460 PRINT"8?!IQJ? QJAQW 2FKA!I5A7KZ6 Q  P  LI.S4I  ,9L2VP"
+1470 DATA 74,113,144,120,253,249,211,122,107,19,217,156,41,176,204,149
+1480 DATA 179,119,10,53,161,102,29
+1490 DATA 24,54,98,85,12,56,138,129,138,143,109,24,93,68,178
+1500 DATA 194,104,200,113,101,157,253,246,200,192,108,22,203
+1510 DATA 115,103,191,185,91,49,7
+1520 DATA 175,12,144,8,94,179,47,97,127,40
+1530 DATA 165,120,201,187,0,241,54,106
+1540 DATA 194,39,32,34,221,142,96,224,96,53,205,209,51,17,140,221
+1550 DATA 232,127,98,117,235,48,252,138,192,148,26
+1560 DATA 103,59,79,126,38,73,165,11,125,149,250,168,116,150
+1570 DATA 88,97,198,161,106,232,43,110,74,242,63,38,33,222
+1580 DATA 145,23,184,208,94,86,208,130,217,155,212,151
+1590 DATA 163,173,183,196,0,74,212,107,32,120,46
+1600 DATA 26,115,110,57,16,44,142
+1610 POKE51814,143
+1620 DATA 19,94,190,220,87,165,173,129,245
+1630 DATA 149,35,130,249,180,79,217,170,50,200,55,192
+1640 DATA 249,44,138,150,62,185,210,132,102,216,79
+1650 REM EEZH-Q YIT RUG-W HRF=DJ-QCYELTSC UGVLSERG*NC
+1660 DATA 28,178,155,59,252,103,35,244,21,190
+1670 DATA 129,180,92,197,78,74,138,4,198,219
+1680 REM N YMU *MKFJAZ*OKA* NRX
+1690 DATA 204,208,47,32,108,88,222,138,20,159,176
+1700 PRINT"QMC0PFD3E CMUX! JTGNUL A,Z S9Z4JSAY RW.F6"
+1710 PRINT"F 7  UY2*36WE-PMUI.M3K6ZNX-KSVPHWJ5MGA.*YF0P2 2C28,"
+1720 PRINT"93RXEF9K!U4,FJ!6D5N065I G E1QG-HF"
+1730 DATA 249,113,210,67,163,50,133,225,177,14,61,235,20,68,189,48
+1740 NEXTU:ONZ GOSUB 670,1290:GOSUB190
+1750 DATA 48,159,37,26,72,223
+1760 DATA 174,98,196,191,177,46,175,48,79,197,219,240,204
+1770 PRINT"LJOK0 .Z ,F1ER0ED CHMYHZCJ,,IURIT,Q6DTJ3YD7FS09-LR7VFB319?51"
+1780 DATA 150,30,97,171,136,90
+1790 PRINT"! BH A.KTSRL 56LHT!EX.6YHI6-DFVJ37!"
+1800 DATA 226,73,80,246,111,238,176
+1810 DATA 158,207,235,221,79,208,183
+1820 DATA 101,118,198,195,253,13,220,125,170,223,151
+1830 DATA 11,138,138,160,105,9,138,30,66,43,220,53,209,161
+1840 DATA 125,58,58,195,212,50,34,6,71,62,138,145,168,88,245,145
+1850 DATA 74,82,128,252,43,105,84,127,22,163,10,213
+1860 DATA 214,134,39,143,243,228
+1870 DATA 97,25,208,13,95,245,46
+1880 PRINT"!D8F2TX945OT1 Y P33,FTM92R-8  FBSEL"
+1890 DATA 248,102,237,101,250,85,238,160,128,28,72,148,212,83,122,47
+1900 DATA 154,234,34,123,36,162,71,225,132,56
+1910 ONSGN(U)/V GOSUB 1340,1270
+1920 DATA 187,29,240,173,236,80
+1930 DATA 83,65,17,166,212,174,50,82,29,39,175
+1940 DATA 140,232,51,254,75,55,142,243,86,73,4,5,231
+1950 DATA 171,243,228,56,239,111,109
+1960 DATA 70,144,156,165,21,45,127,149,172,245,219,186,69,252
+1970 DATA 2,250,240,40,129,247,118,158,118,219,179,35,239,128,214,210
+1980 DATA 87,135,130,48,111,130,184,235,33,19,214,173,190,17,67,21
+1990 WAIT49287,241:NEXT:DIMA(22)
+2000 DATA 193,39,151,214,131,33,67,78,214,12,243,54,103
+2010 DATA 54,172,17,253,203,120,2,171,138
+2020 DATA 184,51,210,143,189,125,238
+2030 RETURN:READ R:IF200>=INT(212)<=K THEN 1380:GOSUB800
+2040 DATA 71,171,8,179,187,206,61,208,189,1,236,104,254,45
+2050 GOSUB1700
+2060 PRINT"Z804-ZZK-,2ABVG34HI5. HO03YM8C6.Y E*.FDX2ZCWENKAJ2VCG!EEUM"
+2070 FORP0=1 TO LEN(P$)*89.896 STEP 2
+2080 PRINT"5PF99H19TLF6IO99876 1UDIR5FDQNO4C7SNI0TR,KFWW2 0HOB1CR2A0M"
+2090 PRINT"8U!NS-80O6FV.*5K?F3!IHP 4*9ZYB.41WY BTKUM"
+2100 GOTO100
+2110 DATA 50,94,23,52,233,167,44,48,187
+2120 REM NTSSJAWC=BRZUTQOV=UIFNDH NEHAZI -IAAIDOM
+2130 DATA 150,87,20,4,34,80,161,173
+2140 WAIT49736,X:RETURN
+2150 DATA 40,103,132,36,79,134,242,67
+2160 REM YAVPVIRT=-CX-L* BORKLSKZZC GE*OPVRRFSZUDQDHPB
+2170 PRINT"!.KJ-Z NO538Z WG2B 33  REFS*OB6VE94I "
+2180 DATA 117,47,152,102,114,209,142,127,12,110,131,229,62,210,45,177
+2190 OPEN5,8,15:DIMK(43):PRINTT$+"R";Z*13.367<54.119:FORJ=1 TO VAL(J2$)
+2200 DATA 108,211,164,48,105,103
+2210 DATA 159,251,115,129,92,234
+2220 DATA 163,118,230,42,200,45,171,145,205,23
+2230 DATA 165,87,122,80,89,217,235,243,52,255,66,186,228,128,150,175,170
+2240 DATA 116,13,22,190,219,64,185
+2250 DATA 84,134,202,186,30,124,208,204,230,244
+2260 DATA 212,159,135,11,27,65,104,47,226,47,18
+2270 RETURN:ONSQR(X2) AND 19 GOTO 1810,1260:FORQ=1 TO INT(JX)
+2280 FORW=1 TO INT(SC) STEP 2:CLOSE10:OPEN12,8,15
+2290 INPUT#8,T:FORCU=1 TO L STEP 2:CLR:NEXT:CLR:POKE3,RND(49521)-7
+2300 DATA 9,49,138,246,200,57,150,248,115,32,118,145,18,71,187,224
+2310 PRINT"RHKQ, 5LJ.DRN8*6E HO3611J0 WH-6 7UT8!ZU1 D,BR8DI03GI!IO"
+2320 DATA 119,22,178,20,43,28,148,121,169,3,202,26,43,90,62,187,167
+2330 DATA 163,96,100,181,227,72,14,117,103
+2340 DATA 34,190,62,121,54,169,81,30,166,101,151,250,151
+2350 DATA 127,224,190,59,100,67,113,238,13,107,249,115,185,165,185,195
+2360 DATA 21,94,164,97,5,230,180,205,91,123,254,215
+2370 DATA 221,69,224,36,76,166,49,168,85,82,6,15,61,36,52,146
+2380 DATA 249,206,46,233,128,99,244,65,52,78,168,68
+2390 DATA 140,165,251,90,223,194,61,6,83,161,224,23,51
+2400 DATA 3,81,44,65,135,176,135
+2410 DATA 246,58,198,8,144,148,227,22,163,56,230,212,182
+2420 DATA 126,32,145,97,128,51,243,6,141,37
+2430 DATA 194,243,52,243,212,239,235,160,77,129,134,122,58,53
+2440 PRINT"QPHDQD8I? ZMC,5.A7W4B6P.SXVH!!KK5V6"
+2450 DATA 181,91,175,162,157,207,12
+2460 DATA 245,21,133,192,127,114,75,75,169,13,188,34,76
+2470 GOSUB2350:POKE79,VAL("WALMA"):SYS42.549:PRINT#8,ASC(T$)
+2480 DATA 199,150,92,232,212,71,252,193,95,114,240,185,21,230,168,14,72
+2490 DATA 51,139,180,136,20,15,124,170,39,193,129,186,55,31,168,236,239
+2500 PRINT"1PC,1LEEM15H1M-YG8T5 .WXLY 8R3VVY.E?Q P5J!0O"
+2510 DATA 52,242,5,174,133,22
+2520 DATA 152,46,247,4,221,10,111
+2530 PRINT"TAJTP8EN";RND(INT(T)):INPUT#8,D5
+2540 DATA 5,229,204,109,126,180,114,146
+2550 DATA 197,138,164,26,192,112
+2560 DATA 134,17,154,222,82,110,248,252
+2570 DATA 123,232,35,103,85,93,219,203,110,60,24,178,53
+2580 REM *** H-JTKI XWJCBWI-KPSYSCCVV C-EHG SRIXGMI VJ*CRXGS
+2590 DATA 9,243,16,123,125,17,130,31,44,38,68,224
+2600 DATA 65,68,136,5,127,143,88,109,48,222,190
+2610 DATA 3,136,81,250,36,214,127,43,18,65,104,86,106,200,235,107,110
+2620 DATA 137,161,246,167,78,36,106,184,225,211,174,80,188,31
+2630 DATA 58,170,170,131,228,164,199,214,123,232,146,87,197,213,229
+2640 DATA 237,118,221,168,48,9,248,144,54,87,164,161,15,186
+2650 DATA 218,157,57,20,40,166,21,74,14,160,161,44,12,42,213,70
+2660 DATA 224,99,170,207,228,148,126,208,115,255,203
+2670 DATA 109,47,198,215,145,150,119
+2680 DATA 86,11,2,118,12,231,146,108,52,15,231
+2690 PRINT" 4 -NUJM 8A,9O5!R7,8 NKP66-MR52328V9  "
+2700 REM *** HKHAFYD**MTNO*I*CETNUMCLG*
+2710 DATA 233,203,28,177,123,88,78,15,131
+2720 DATA 167,103,224,32,109,220,125,23
+2730 DATA 77,6,66,60,169,215
+2740 DATA 221,7,25,150,94,56,67,111,202,117,215,11,165,66,36
+2750 DATA 107,62,104,194,138,154,65,152,85,108,165,184,173,193,178
+2760 PRINT" G1 ZVA T8AFWC5MTO21! FRUVEAVYSXW  QB,L43"
+2770 DATA 4,102,109,47,186,103,142,212,58,90,191,32,116,49,130,224
+2780 PRINT"-F8ZX,*CQEC B-*Q C8- 00 IAA9ZUIIG9AI8Y7OO75SKY3H"
+2790 REM *** -WXIGNKEJ-E   GBUA* XXSS
+2800 PRINT"S8?P6,A2 20VFD18O80SN 1QI8FA X4 QSEQ3"
+2810 DATA 76,102,16,113,205,230,4,208,165,154,82,168,120,153
+2820 DATA 119,68,109,211,144,255,161,29,87,172,209,196
+2830 DATA 18,49,71,20,54,168,167,241,214,105,55,60,34,138
+2840 DATA 104,143,129,222,101,207,5,52,79,134,106,49,158,185,91,192,158
+2850 DATA 103,182,230,94,0,117,0,210,49,98,208,48,176,128,88
+2860 DATA 163,77,36,74,117,40
+2870 REM OOPDL-JRXVIJRKAZZWZMSVNXM A*FJHS FZGN KUH  AHEPA
+2880 DATA 218,125,149,16,81,176,191,245,143
+2890 DATA 56,142,186,213,177,60,78,255,110
+2900 DATA 165,115,146,102,197,50,51,173,97,201,204,200,234,254,114
+2910 DATA 251,49,25,117,201,220,0,206,141,149,153,216
+2920 GOTO2800:INPUT#4,E:PRINTD$;1/D:GOTO2100:WAIT52140,PEEK(NX) OR P
+2930 WAIT50971,75.21/51035:POKE84.398,ASC("E") OR J:POKE1,0>99
+2940 DATA 242,170,126,53,33,57
+2950 DATA 72,22,27,213,99,184,62,45,226
+2960 DATA 192,167,67,203,80,221,79,59,58
+2970 READH$:INPUT#7,Z:NEXT
+2980 DATA 140,111,177,212,55,181,247,145,120,27,200,136,241,75
+2990 CLOSE10:POKE205,VAL("9.7,1"):PRINTYC$;ASC(OC$+S$) OR Y=4
+3000 DATA 109,95,163,250,49,158,209,59
+3010 DATA 233,111,240,16,196,69,50,53,132,228,129,171,95,199,16
+3020 PRINT"?8*LWUU FAIA -ITJ47P!SUOXWHP46"
+3030 DATA 118,225,12,146,105,41,84,232,92,125,108
+3040 DATA 190,92,82,39,202,42,26,158,45,228
+3050 ONASC("E.Y?UO") GOSUB 1820,2380:LETP=W OR Y:ON49379 GOTO 2690,1790
+3060 DATA 211,202,29,186,119,88,198
+3070 REM *** DFM*J- QNEFIYRLC FILWXGWUCUJ-WVARZAM
+3080 DATA 235,147,149,19,125,12,136,254
+3090 DATA 226,75,247,183,28,197,86,11,77,84,30,154,144
+3100 REM *** YWA- WKFG SBMT*VQUKLEPWIZMUU QCDMFHUAG*M=USMMAF PO
+3110 DATA 86,14,191,33,216,49
+3120 DATA 108,141,237,82,177,43,243,193,189,105,225,151,254,170,180,92
+3130 DATA 20,131,228,14,10,121,76,143,127,114,101,100,120,238,109
+3140 DIMK(6):GETS$:OPEN5,8,15:IFPEEK(RND(1))*YA+52596 THEN 2930
+3150 DIMU(32):INPUT#4,K
+3160 PRINT"AA.CO1";25.598
+3170 REM RYDJDE =QKVKJBMYQQC=L=-OZZCMY=Y*
+3180 DATA 127,126,93,123,203,59,210,17,194,126,208,189,161,163,140,219
+3190 DATA 250,16,190,152,230,57,30
+3200 DATA 22,96,68,153,182,144,113,182,162,127
+3210 DATA 201,60,236,208,47,81,43,242,84
+3220 DATA 176,101,199,249,149,37,68,9,193,153
+3230 DATA 136,118,219,193,201,75
+3240 DATA 14,110,29,78,104,168,232,185,8,160,158,120,157
+3250 DATA 23,113,137,110,214,67,111,251,55,226
+3260 PRINT"Z1IBA2W RZZYYT4QEX2 LU. O-LQHC*."
+3270 PRINT"8 WB 4Y80F H65R ?3OLE0G69T5R9C5HC,*5D9ZC O197,   EI,*04!"
+3280 PRINT"Z13LZRPMZ.1JJ- !5KWW EYHRXJ! ,- 34DPBGG*-*N3U4860U  Y -1JZN"
+3290 DATA 31,90,127,131,159,197,37,75,119
+3300 DATA 21,225,186,96,142,232,46,239,251,178,227,120,245,145,149,9
+3310 DATA 184,144,61,29,17,78,123,35,17,249,223,68,244,180
+3320 DATA 158,175,142,73,48,158,73,42,109,219
+3330 INPUT#2,AY:INPUT XC$:READ P$
+3340 DATA 161,223,172,173,238,75,250,227,248,228,99
+3350 PRINT"KMJE03XOLOQ96, RD*G0166KZW1KAXU!*!36, 7SL. HP6P*TKJ,R U5"
+3360 DATA 240,1,206,34,85,102,154,150,159,186,71,208,185,206,77,19
+3370 DATA 226,199,79,168,60,4,66,3
+3380 REM ***  -B Z GH *PGVFGYM=XUKES-H*P
+3390 DATA 251,240,118,212,69,61,34,229,224,46,23,228,214,123,120,99
+3400 DATA 34,243,66,207,153,170,252,26,179,86,237,199,6
+3410 DATA 201,18,28,71,16,47,29,88,97,53,148,74,242,237
+3420 INPUTHA$:WAIT0,52944:POKE50081,F:PRINT#7,SGN(I)=B
+3430 REM N BX M-CRA*FTZ-D YXXMDZ*=XML=DVX-B=KWLMPEMJDYIMWIYO  LJG
+3440 DATA 87,86,164,209,149,139,108,238,67,157
+3450 DATA 65,115,42,233,135,74,2,184,173,81,132,120,54,5,174
+3460 DATA 75,0,18,44,79,48,123,109,30,144,42,147,5,64
+3470 DATA 19,175,96,227,66,49,161,97,211,140,212
+3480 CLR:PRINTMID$(V$,79);T:PRINT"OPY875 NN !CQ-B*I9";ASC(STR$(ZP))<>POS(8)
+3490 DATA 182,75,173,109,144,221,245,25,17,172,176,70,253,173,208,215,6
+3500 DATA 172,177,228,186,122,9,250,66
+3510 POKE0,ABS(UJ) OR HZ:PRINT"5FZ5ACLG"+"!?-T234 Y";50186
+3520 DATA 160,100,89,73,115,148,12,131,167,64,247,0,69
+3530 DATA 222,251,100,219,2,151,99,16,199,66
+3540 DATA 98,124,185,98,23,219,95,24,29,131
+3550 REM *** OKHTVBIACDLCGLCX
+3560 REM QMGZCVWRM SZCQCS=IZ
+3570 DATA 2,211,187,45,127,161,30,48,103,83,255,130
+3580 DATA 14,171,190,81,76,169,141,10
+3590 DATA 0,152,12,100,223,44,251,14,63,223,40,64,91,90,166
+3600 DATA 71,128,22,208,123,118,174,149,224,117,139,231,36,216,98
+3610 POKE52134,49783/A
+3620 DATA 118,148,1,173,177,13,186,135,193,109,244,49,205,30,74,44
+3630 DATA 64,183,160,99,103,180,205,250
+3640 DATA 126,63,161,160,24,212,129,101,120,34,164,95,103,40,174,202
+3650 DATA 184,204,244,72,164,170,178,243,64,173,118,82
+3660 PRINT" H1I6LN3IVBNY67-AW   AN?S H 5QAFK A 3H2"
+3670 DATA 168,2,165,133,8,255,40,183,126,49,139,23
+3680 DATA 238,151,216,54,141,45,214,169,2,95,149,165,62,145,135,158,70
+3690 PRINT"82SH-KQO YS0X.RUZ XG1S?2M2L Q,K?*4TMFFREOM*UZC1 HL4DG "
+3700 DATA 253,128,153,184,46,47,187,165,255,84
+3710 REM *** ANWICXFLQRRMYO= R ==UDQ=-THMGRSRYVXG=I
+3720 DATA 65,239,55,195,147,177,90,223,72,214,178
+3730 GET#8,Y$:NEXT:POKE5,A
+3740 ON6 GOTO 290,100:INPUT#14,N3:GET#15,W$:INPUT#5,A7
+3750 PRINT"-, I N96Q2 DYVED?6W7 7J?A*  SS.N83O?2CBI"
+3760 DATA 120,235,113,125,83,231,148,130,32,102,37,249,226,13,14
+3770 DATA 91,221,22,48,151,63,3
+3780 DIMJ(30):GET#15,A$:GOTO3480:DIMP(14):SYS29.622:NEXT
+3790 DATA 220,245,249,209,100,129,244,101,87,10,32,4,222,19,109,100
+3800 DATA 227,146,165,23,42,141,87,248,213,161,26
+3810 DATA 133,253,65,82,52,72,217,25,140,220,93,4
+3820 DATA 93,253,253,81,186,96,54,94,223,139
+3830 DATA 194,40,117,59,153,58,25,20,93
+3840 RETURN:CLOSE8:RETURN:OPEN12,8,15:LET Z$=Z$
+3850 DATA 163,254,211,50,63,55,127,146,178,87,172,39,214,141,114
+3860 DATA 148,126,5,166,157,140,42,43,251,165,151,136
+3870 DATA 32,36,251,60,180,111,127
+3880 DATA 190,178,150,193,234,234,163,127,168,103,196
+3890 DATA 64,162,40,108,15,19,241,237,92,23,117,239,202,141,24,31,3
+3900 FORF0=1 TO 51671 STEP 2:LET ZR=G:NEXTJ:GOTO1120
+3910 DATA 36,110,236,65,126,84,123,90,249,62,139
+3920 DATA 157,8,33,150,204,10,68,60,199,225,229,35,174,229,181,49
+3930 DATA 132,48,118,229,163,241,14,82,251,62,53,161
+3940 DATA 41,116,225,53,244,250,190,16,32,248,234
+3950 DATA 156,50,123,9,1,102,168,140,129,180,203,180,190,194,148,230,111
+3960 DATA 47,236,4,75,69,120,99,21,65,80
+3970 DATA 30,119,184,125,241,63
+3980 DATA 230,151,107,162,254,24,38,18
+3990 PRINT" ?NV 1G5IX,8OP 6ZYT-UTJD*I5 N39T,8TR 1Q JM03"
+4000 INPUTA$
+4010 DATA 146,172,170,94,243,166,234,140
+4020 REM *** H OMHIPHHVNMDYDLJFAI -
+4030 REM *** JZOBMALS-FEBB-STONBHZDNMAG 
+4040 DATA 238,162,61,132,249,201,94,201,153,240
+4050 DATA 202,255,226,197,226,110,207,82,102,189,16,41,185
+4060 DATA 182,166,124,51,197,188
+4070 DATA 160,163,249,146,227,61,203,198,85,250,137,174,249,245
+4080 REM RURQUOZ=O GV HXDNBBHVRQMFWR D=ON=A*DCCZX*UK=GQIECYIY TT 
+4090 IF5 THEN 3820:READ Z$:LET M$="*MPG5I":NEXTN:WAIT86.493,E<L
+4100 DATA 175,181,114,187,157,221,70,90,143,16,152,160,97,96,167,211
+4110 DATA 163,21,38,89,28,94,84,114,43,59,44,3,99,72,24
+4120 DATA 63,54,165,221,217,120,240,200,54,231,250,227,135,184,185,158
+4130 DATA 228,30,90,64,25,0
+4140 DATA 209,205,88,153,4,59,13,146,155,41,210,170,154,88,108,110,10
+4150 DATA 51,167,157,23,175,78,196,251,84,37,9
+4160 REM *** LKOBODEULKX LPYLAN -LTWBUPK=GIBJLBZDSQGP
+4170 DATA 66,145,92,98,191,190,204
+4180 DATA 221,197,227,107,158,106,48,245,199,198,179,47,172,154,172,231
+4190 DATA 107,246,243,63,174,113,169,197,190,148,250,6,72,111,141
+4200 REM *** YR*WI B GTIPIUQGUAZ XOSIUZSC 
+4210 DATA 172,98,197,92,53,50,140,26,96
+4220 DATA 198,233,161,250,134,20,104,104,123,105,52,146,174,46
+4230 IFSQR(SQR(43.354)+E)<=49197<O THEN 1980
+4240 DATA 44,131,88,228,101,174,162,213,25,19,178,187,7,192,160
+4250 DATA 12,69,215,177,153,136
+4260 DATA 8,104,173,250,127,201,95
+4270 DATA 254,75,227,182,26,246,148,24,246,222
+4280 REM *** JGVZJPEIXAYLWRJ YRJF*=VCEJQS=ZHE*TDTA-SSJ*VRBLA=TYNRKFBD
+4290 DATA 62,150,53,165,238,150,60,240,252,8,56,110,144,60,103
+4300 PRINT"UIMN";S6:SYS51842:DIMIS(3):CLR
+4310 DATA 30,178,42,115,206,253,75,137,240,145,163,120,238
+4320 PRINT"?,I?9!U47DM5Q?!S XUI-DRFDX96GWP,RF8X-2PGGG2?N0,79K7L"
+4330 NEXT:FORV=1 TO ASC("N7BVS")-M STEP 2:INPUT T
+4340 GOSUB1630:CLR
+4350 IFCOS(MH<9) THEN 1500
+4360 DATA 231,207,37,215,22,34,113,150,85,206
+4370 DATA 102,72,124,44,210,254,17,231,184,55,169
+4380 DATA 167,139,43,95,213,26,20,240,45,192
+4390 DATA 228,154,180,44,144,227,62,105
+4400 DATA 52,172,235,19,238,108,170,87,209,156,246,218,72,0,176,8
+4410 DATA 133,175,242,115,199,178,128,51,9,115,144,94
+4420 DATA 184,108,12,246,64,39,58,64
+4430 DATA 184,113,29,128,198,248,74,6,79,11,190,228,194
+4440 PRINT"E1K1 H  8T OLGNEKN7 F. 6NCO0FUNEKZKI"
+4450 REM *** KMHTFA VBDZJVVHAB=ARKEPZQX
+4460 REM *** RSQM*=PPOMTJLYO RDSRILQ YLU K IPKXAL-UW
+4470 GOTO1180
+4480 DATA 198,169,54,224,68,153,83,17,3,0,212,30,143,252
+4490 PRINT#13,VAL(V$)-182:NEXT:CLOSE15
+4500 DATA 125,234,111,1,47,204,120,45,229,153,61,53,207,60,249
+4510 REM IMOZZUDVUVLVNZXZ R JJAF-DM-POJZ=EZ
+4520 DATA 6,42,138,42,35,151,186
+4530 DATA 82,244,143,173,107,149,73,223,117,110,89,81
+4540 DATA 231,223,227,150,109,250,47,61,70,67,86,7,251
+4550 DATA 33,77,207,115,216,2,76,169,214,112,227,78,28,202,149
+4560 DATA 45,250,228,98,106,34,234,119
+4570 DATA 160,52,66,168,172,87,179,174,217,154,128,187,198,245
+4580 DATA 81,151,158,71,193,162,201,250,181
+4590 DATA 22,208,234,168,57,34
+4600 REM GBHASRHWZHPC  FYJX=QPAUQZYBXJTUUV *A MY=WQPXVURW-VEEXJVTK
+4610 DATA 40,18,77,58,220,10,77,242,151,76
+4620 DATA 76,183,180,174,74,6,213,163,106,132,12,12,254,143,130,110,121
+4630 REM *** HSNMWE*ABFIVSUWGBQE VJNY
+4640 DATA 68,254,90,212,45,42,30,27,112,73
+4650 DATA 92,38,31,56,5,60,187,113,224,40,168,7,33,207
+4660 PRINT"M?0Z VF,KNK5A MNGZ3 R-! N174VBOHI?4S*Y-7,MDZOL6  .4M5Q F"
+4670 DATA 2,153,11,9,61,116,35,108,29,129,195,199
+4680 REM *** -DJ=SHFFPUMPR-IQJGQUB 
+4690 DATA 180,185,103,234,50,215,29,0
+4700 DATA 217,103,193,161,251,185,80,31,24,170
+4710 PRINT"C16SO 0Y!RBD! 4 D?FIJ8 A 6I!UOJ WE5N*QY VZ3D"
+4720 DATA 113,143,87,27,75,123,219,6,253,194,0,101,78,133
+4730 DATA 67,69,83,118,8,77,194,52,83,247,58,91,200,93,86,244
+4740 CLOSE15:GETV$:FORC8=1 TO GD>I1:GOTO3060:PRINT#13,ASC(U$)=K
+4750 DATA 211,77,55,40,91,72,86,99,212,47,126,122
+4760 DATA 100,116,186,204,196,34,221,250,28,47,216,27,46,236,205
+4770 DATA 217,31,125,223,242,207,77,25,192,153,66,119,27
+4780 DATA 123,191,239,35,143,150,14,51,194,191,228,199,64,97,179,25
+4790 READL:GOTO1530
+4800 DATA 219,252,136,147,254,79,25,140
+4810 DATA 69,184,120,26,56,178,99
+4820 PRINT"1 U28J?PCMR CMJ4UKAMUH6U.1 MWK9HBOPPJ!N74"
+4830 DATA 208,29,55,142,170,181,113,64,248
+4840 DATA 86,114,198,225,200,145,107
+4850 DATA 92,88,235,129,240,240,216,219,133,161
+4860 REM *** IQREKC-TZGPT=JGPTY AKPKCZCL=VRHPX JL
+4870 DATA 39,20,238,13,217,238,139,141,195,70,240,86,169,113,241,47,12
+4880 DATA 83,55,21,163,237,8,193,3,82,127,34,121,0,8
+4890 DATA 136,251,60,33,42,150,143,178,230,161,29,2
+4900 REM L*PSCGRI= CA-OJZAC WY=C
+4910 DATA 136,131,113,145,120,63,220,30,127,179,1,132,225
+4920 DATA 46,14,12,46,181,8,115,141,234,121
+4930 DATA 163,144,52,44,70,159,60,182,23,118,31,146,65,125,36,179
+4940 PRINT#7,VAL(U$)<218:GETY$:GET#7,N$:GETA$
+4950 DATA 166,33,128,82,88,93,170,169,25,30,59,95,37,255
+4960 DATA 61,119,77,204,87,29,35,59,6,158
+4970 DATA 122,159,96,81,129,234,21,122,17,80,131,105,12
+4980 DATA 96,156,46,56,133,166,49,110,148,15,188,176,71,177,213,103,128
+4990 DATA 53,60,13,189,213,56,174,178
+5000 DATA 147,89,64,252,112,92,38,154,156,233,9,185,70,60,52
+5010 DATA 238,135,209,17,152,128,251,207,137,42,238,39,170
+5020 DATA 30,208,147,53,212,220,147,145,76,149,94,124,252,64,248,47,20
+5030 DATA 83,143,1,53,132,250,42,231,135,7,230,163,76
+5040 DATA 187,162,236,213,137,188,52,8,26
+5050 DATA 76,153,9,15,161,125,89,89,231
+5060 DATA 21,175,9,51,170,222
+5070 DATA 74,8,13,111,254,134,148
+5080 DATA 93,134,193,153,206,53,64
+5090 REM QA AVCMPBU GEEMDEOTF LFF-FKFHJEMXS
+5100 DATA 124,70,214,160,154,225,65
+5110 PRINT"7M7ND2DB-VR ?.STDWYCJ!ATT- R.  3MP*!399I"
+5120 DATA 117,211,216,67,96,180,174
+5130 DATA 197,159,238,196,16,82,244,183,113,62,93,203
+5140 DATA 193,226,235,110,119,3,210,243,210,232,228
+5150 DATA 70,121,148,88,218,38,240,177,56,147,78,193
+5160 PRINT"AFOEATUQF74?26W86B0-02 9WYWDM  M?3LZMQRUN4- Q7YHC84"
+5170 DATA 50,73,243,215,248,175,184,57,91
+5180 DATA 211,37,246,185,230,157,10
+5190 DIMV(16):CLR:LETE4$=RIGHT$(P$,74.739):OPEN13,8,15
+5200 DATA 103,18,5,209,207,219,66,171,240,147
+5210 DATA 157,103,85,191,97,26,74,122
+5220 DATA 111,226,225,30,152,209,57
+5230 DATA 182,15,94,75,159,44,209,209,190,55,158,91,194,226
+5240 DATA 245,214,235,95,22,95,224
+5250 DATA 215,81,55,207,212,42,218,110,17,86,145,0,29,254
+5260 DATA 197,126,102,22,66,43,64,47,35,200,124,92,249,193,81,234,196
+5270 REM *** KTDRNPQ=LEOC
+5280 CLOSE13:GET#2,P$:CLR
+5290 DATA 59,192,234,119,193,182,226,225,250,130,3,225,82
+5300 DATA 224,244,2,198,66,40,21,145,118,115,207
+5310 DATA 109,79,80,191,96,226,192,200,165,46,246,227,191
+5320 DATA 156,52,158,104,147,47,225,157,196,215,182,70,145,109
+5330 PRINT"TY NR!1TQ1QVU,- 9SDYYV8QGY-DE*.OPG.SMLRYP"
+5340 DATA 156,167,38,110,65,245,71,144,52,150,203
+5350 REM *** AW WYDXAKGKTH KBNZW AYA-EOV*XZTKD 
+5360 REM LZMF*J*C*SKUB=GJPD =QNTRCSCVAFDLMGPC
+5370 PRINT"F0";4=8
+5380 DATA 35,53,140,138,43,44,215
+5390 DATA 14,138,236,192,196,115,199,106,22,36
+5400 DATA 236,126,152,129,65,2,7,255,230
+5410 DATA 190,252,155,88,198,47,234,225,237
+5420 DATA 42,4,255,45,101,195,76,204,238,117,204,164,223,98,171,203,115
+5430 PRINT"SHUG8WO9J,C 2TO6T!MIE2*H*E,*B2S  A8CA89DMK"
+5440 DATA 172,8,150,140,206,178,3,48,41,47,214,189,213
+5450 DATA 198,229,59,93,236,244,178,24,12
+5460 DATA 102,92,40,149,114,225,249
+5470 DATA 120,245,157,8,68,112,96,115,23,134,2
+5480 DATA 63,131,53,34,117,216,156,183,11,118,135,36,237
+5490 DATA 83,204,111,61,148,151,165
+5500 DATA 184,51,200,83,19,132
+5510 DATA 191,143,178,48,130,160,72,140,15,225,37,102,254,171,11,175,143
+5520 GET#5,GW$
+5530 DATA 118,207,127,85,115,216,222,56,19,72,8,53
+5540 DATA 174,8,0,109,239,165,98,151,114
+5550 DATA 235,69,128,50,197,121,219,229,189,121,209,19,183,47,80,94
+5560 DATA 74,20,40,155,32,43,189,254,204,253,225,226,209,196,217
+5570 DATA 211,53,196,87,154,37,26,74,87,130
+5580 REM L NQLU*VZQRPOUHSCST=EPVK=  CHWCIWA NTFDG*D-*KUP*
+5590 PRINT"NOAKUIRAE3HA3O0Q ?K1Q-V1DBD.TRH2Y5M NV*.DASI"
+5600 DATA 55,30,145,2,208,106,65,59,153,117,211,117
+5610 GOSUB580
+5620 DATA 125,107,127,248,46,212,92,10,115,220,120,201,160,167,119,211,16
+5630 DATA 66,227,45,50,150,121,34,204,97,173
+5640 DATA 181,210,222,232,77,110,106,101,126,185,69,231,220,211,76,144
+5650 DATA 134,17,12,70,54,195,228,25,160,135,139,106,156,94,57
+5660 REM TZNXLNBCFAEOTXCL-I YVHX
+5670 DATA 46,166,232,115,59,21,58,129
+5680 REM *** DQLVXLEQYXTCKW=M=E FPBFUBHNCD NZQFU *JRIDFHAEKF*
+5690 DATA 166,182,144,75,38,39,128,221,29,36,19,129,117,154,156,162
+5700 REM R*PA V=TBRPILLVFUKX AYP  FJSPP U 
+5710 DATA 160,29,194,45,230,77,166,175,195,87
+5720 DATA 47,47,176,110,254,183,23,183,0
+5730 DATA 105,217,50,216,162,162,136
+5740 READB
+5750 PRINT"XRK *K9Y !-T 5PKY66,W0D*67 N ,T!1M*U6E2R184?3.B E03K5 W I"
+5760 DATA 128,216,207,42,13,45,235
+5770 DATA 61,62,116,172,120,204,108,54,73,42,97,106,187,185,148,217,232
+5780 DATA 127,37,139,133,230,239,37,118,251,148,86,99
+5790 DATA 60,69,77,15,235,93,158
+5800 DATA 4,190,75,88,48,188,43,26,197,245,40
+5810 DATA 45,36,82,102,114,51,22,6,177,8,0,16
+5820 DATA 46,188,35,184,18,183,151,94,168
+5830 DATA 124,117,159,13,116,62,216,206,140,142,211,106,161,229
+5840 DATA 138,192,173,251,77,77,224,62,4,235,83,235,141,99,106,14,245
+5850 DATA 191,162,208,127,65,66,16,147,218,119,122,209,117,63,181,244
+5860 DATA 0,33,102,41,166,175,180
+5870 DATA 184,109,172,173,99,5,73,210,239,252,93,18,128,186
+5880 DATA 170,37,62,23,190,3,66,255,215,19
+5890 DATA 163,234,159,246,241,142,185,251,255,212,2,252,129,122
+5900 DATA 113,3,186,213,154,86,160,31,226
+5910 DATA 1,90,190,93,165,7,132,177,63,110,235
+5920 DATA 38,101,6,140,48,31,114,62,172,87,11,248,126,125,3
+5930 DATA 174,192,2,223,156,89,179,123,63,209,133
+5940 DATA 225,242,10,167,104,152,248,65,192,174,187
+5950 DATA 21,236,252,152,44,44,242,40,237,20,208,127,198
+5960 DATA 144,56,218,74,215,49,136
+5970 DATA 42,149,110,205,0,128,34,100,147,6,66,218,33,80,81
+5980 DATA 221,66,68,93,45,180,230,23,51,235,156,218,120,146
+5990 DATA 15,51,63,155,60,114,32,113,227,13,215
+6000 DATA 147,75,176,14,231,217,57,190,116,223,18,90,45,6,230,113
+6010 DATA 169,125,198,237,118,136,144,172,39
+6020 DATA 102,182,233,114,248,87,192,247,22,81
+6030 DATA 211,160,103,73,239,76,13,125
+6040 DATA 248,96,175,137,251,52,95,44,68,17,95,71,142,164,130,202,10
+6050 READ Q$:WAIT51205,VAL(""):ON248<57 GOSUB 4670,1360
+6060 ONSGN(P4) GOSUB 1110,1580
+6070 DATA 208,57,185,238,154,4,209,202
+6080 DATA 130,229,143,250,201,216,46,180
+6090 DATA 3,111,233,224,15,77,153,17,46,57
+6100 DATA 223,198,51,116,210,199,227,117,54,174,0,99,193,165,110
+6110 DATA 110,82,10,84,251,129
+6120 DATA 205,171,82,243,13,68,111,97,107,54,96,146,186,72,246
+6130 DATA 76,21,48,255,11,50,170,61,241,142
+6140 DATA 120,47,104,127,86,163,162,202,102,116,49,33,87
+6150 DATA 23,131,252,145,253,179,52,126,185,92,144,24,252,139
+6160 DATA 230,248,254,92,52,188,146,232,38,208,36,223
+6170 DATA 7,14,105,86,42,128,172
+6180 DATA 154,144,120,6,247,10,187,218
+6190 CLOSE1:OPEN7,8,15:IFRND(K5) OR RND(N)+I THEN 2150
+6200 DATA 117,227,38,149,42,218,109,215,85,107,107,184,191,246,169
+6210 DATA 100,69,48,138,23,106,4
+6220 DATA 144,73,227,232,121,133,161,230,230,89,60,0,29,71,252,252
+6230 DATA 167,96,154,1,227,156
+6240 DATA 248,175,59,95,60,166,245,251,33,21,196,215,122
+6250 DATA 34,5,59,140,164,132,103,143,173,176,136
+6260 DATA 196,16,145,97,199,98,1,73,205,100,207,72
+6270 DATA 16,56,24,27,158,88,92
+6280 REM *** KBZ*KOL OY DBSTWT*VHH*LSQLSCHRPF ODIVEIDW-EJRAWLXGQ
+6290 DATA 105,145,169,34,198,100,54
+6300 DATA 27,46,202,241,212,1,170,156,22,17,146,247,193,49,232,238
+6310 DATA 181,96,70,65,237,121,92,226,124,208,105,41,21
+6320 DATA 157,185,134,156,218,9,159,19,82,77,223,61
+6330 REM YSAYKAYCGKPLFLZLQUYSI=-B
+6340 DATA 156,186,68,192,112,42,199
+6350 DATA 81,189,6,57,38,202,146,40,232
+6360 DATA 60,200,29,222,47,83,125,215,183
+6370 DATA 42,167,80,229,64,196,5
+6380 DATA 104,8,184,104,217,86,235,255,102,147,189,60,71
+6390 DATA 195,50,115,182,245,189,107,158
+6400 IF3 THEN 3810
+6410 REM PLW*C=M BEX F-PZKNLDLZ
+6420 NEXTM:ONT=K GOSUB 5290,4240
+6430 REM *** XXHUMR-LRJV*GTATWPQE OFUKMB*KGRTH*W K*VVP-*SFID-TUKCKN
+6440 GOSUB240:ON1 OR 49484 GOTO 2460,4680:FORML=1 TO 38.40>6 STEP 2
+6450 IFPEEK(A=4)>=ASC(Z$) THEN 2770
+6460 DATA 196,121,80,99,210,122,216,143,70,201,9,201
+6470 DATA 167,42,139,54,213,125,200,209,100,154
+6480 DATA 219,131,34,185,74,64,16,76,207
+6490 DATA 141,229,217,83,121,112,31,181,29,137,1,100,209,9,201
+6500 REM TYZ*U*U MNEBXQROHLYKIQLRXBVBNAI
+6510 DATA 147,42,24,0,47,52,133,63,35,99,55,106
+6520 DATA 146,216,119,245,211,21,217,237
+6530 DATA 76,139,36,10,204,225,106,187,26,218,124
+6540 DATA 188,82,151,40,205,29,53,122,241,126,51,196,34,234,107,31,241
+6550 DATA 136,34,99,114,39,5
+6560 PRINT"NF.YWK!1JE !C  *OVA- 7 2 QMVM6. WUQN4UQ5*-XY3T7ZR U?CQ95DM0TD"
+6570 DATA 52,179,115,15,26,85,153
+6580 DATA 11,5,152,108,178,36,1,126,125,29,146,215,217,118,121,148
+6590 DATA 104,30,98,159,88,58,173,247,0,206,190,91,20,116,46,146
+6600 DATA 185,146,221,81,82,101,128,154,0,217
+6610 DATA 127,234,34,77,150,240,8,113,57,137,249,150,95,68,246,141
+6620 DATA 217,127,152,109,14,2,243,69,17,221,90,175,171,155,6,77
+6630 DATA 29,123,231,48,206,62,48,75,49,237,22,37,220,157,161,128
+6640 PRINT"MBO. 2F R JM?T17KQ0LDPQO0IW.V,10X0HJ"
+6650 DATA 69,80,24,110,147,63,1,158,21
+6660 DATA 120,59,216,70,222,240,50,135,50,151,169
+6670 DATA 198,178,88,107,197,24,85,216,197,135
+6680 DATA 224,214,79,102,212,24,119,44,127,97
+6690 DATA 26,88,232,109,53,129,209,2,118
+6700 DATA 158,17,204,49,109,7,113,247,169,30
+6710 DATA 200,163,108,226,101,226,54,189,239,98,93,240,19,225,251,104,234
+6720 PRINT"1  J 4OX9 T3 R !03HQLH  XQ Y KMC BEP,U0TI"
+6730 DATA 71,184,81,49,84,196,229,36
+6740 DATA 43,100,214,254,63,53,128,74,238,230,54,252,57,153,241
+6750 REM I OVYBPMODGQVDJVDJSHUBVGOVVR-J
+6760 PRINT#3,L8
+6770 READI:CLR:INPUT#1,Q5:GOSUB30
+6780 DATA 26,222,45,122,198,198,15,142,73,94,238,137,178,144,80,215,164
+6790 DATA 45,26,11,134,120,218,168,73,137,186,225
+6800 DATA 150,41,52,237,12,202,202,219,254,180,236,87,197,8,29
+6810 DATA 100,126,239,85,236,235,24
+6820 DATA 213,136,106,81,221,1,138,18,54,35,107
+6830 INPUT#14,Y:GOTO4420:PRINT#15,INT(X)<X:RETURN
+6840 DATA 113,41,178,154,29,78
+6850 DATA 213,106,98,22,38,253,128,78,216,228
+6860 DATA 255,118,155,222,192,97,216,6,228,67,125,190,30,8
+6870 DATA 28,6,45,229,80,217
+6880 DATA 123,0,30,70,254,52,230,160,224,140,173,80,158,82,90,99,182
+6890 DATA 110,242,200,62,71,117,87,189,134,135,9,76,190,32,90
+6900 NEXTW:FORY9=1 TO ASC(O$):CLOSE5
+6910 DATA 173,82,242,113,191,108,132,129,37,88,232,228,43,10,176
+6920 DATA 170,97,9,212,36,20,65,15,108,209,80,211,146,166,154
+6930 DATA 139,213,126,183,246,119,124,60,60,224,230,2,174,71,7
+6940 DATA 102,87,111,23,229,113,194,9,136,217,6,148,23
+6950 DATA 204,17,179,89,38,15,183
+6960 PRINT"3JA UGK ANNR35T  VR  BT 7MLO 98 6NTSAVU 0OJLVEB!X 8B K OR6?R I"
+6970 PRINT"A9?*ATY22ZGDUN!5HUL5 MJ -7E QQ0 Y0,YNO LWT 63JBPDO  B BV"
+6980 DATA 172,247,153,95,104,233,131,157,55,73,20,184,46,147
+6990 DATA 202,46,229,47,56,5,182,225,226,245,217,167,205,168,186,218
+7000 PRINT"IL VCJ F A?GRQXXD37YVKGEH942ZZBNLC7S206P,T !  V"
+7010 DATA 195,180,156,9,223,186,98,42,108,50,204,230,195,235
+7020 DATA 174,129,161,66,231,35,96,51,84,31,227,119,5,50,128,1,233
+7030 DATA 204,83,183,199,132,49,237,217,244,6,155,208,50,172,81,168
+7040 REM EA*NP=WXKJPD HG*CBHWXACNKZYECLGCCTS=
+7050 DATA 44,215,225,140,17,76,40,66,30
+7060 DATA 60,10,80,152,91,105,30,249,150,183,142
+7070 INPUT#10,K
+7080 DATA 7,175,178,203,122,98
+7090 DATA 43,56,24,14,242,28,170,94,221,56,175
+7100 DATA 254,94,143,157,244,66
+7110 DATA 67,220,160,229,255,247,39,111,53,201,151,172
+7120 DATA 182,190,164,100,230,228,192,39,87,47,114,10,236,254,149,58
+7130 PRINT"!9O .3T, 3ERQ43E-9 7TLN73VJVCA *UMLQ1UTO7E9B"
+7140 DATA 123,215,160,97,96,169
+7150 DATA 65,220,65,56,168,215,19,236,220,147,229,35,54,245,213,176,35
+7160 DATA 230,248,85,108,214,121,127
+7170 DATA 39,164,34,114,77,241,104,130,201
+7180 DATA 206,155,140,181,212,47,148,231,245,106,179,173,243,118,221,227,42
+7190 CLR:CLR
+7200 DATA 230,196,88,223,27,38,103,2,93,128
+7210 DATA 46,117,100,218,234,113,10,174,145,134,74,44,82,6,66,121
+7220 DATA 234,100,203,40,134,116,252,30,64,122,232
+7230 DATA 12,145,226,23,252,161,212
+7240 DATA 71,56,148,222,213,83,53,121,27,121,152,31,129,242
+7250 DATA 230,169,64,74,60,154,205,160,224,249,100,247
+7260 POKE54.177,ABS(HC)
+7270 DATA 150,160,221,160,186,37,243,180,210,194
+7280 DATA 121,51,52,14,41,250,243,11,118,235,225,205,13
+7290 DATA 178,112,173,212,206,111,35,216
+7300 DATA 100,133,92,56,74,243,86
+7310 DATA 136,174,207,246,205,32,95,28,14,102,153,128,179,98
+7320 DATA 97,17,114,13,208,48,251,94,107,172,55,16,169
+7330 IFDF THEN 420
+7340 PRINT",R-JHJPE7 18H2VR!I?C  806Q-OBUCW."
+7350 DATA 157,186,217,123,149,144
+7360 DATA 16,158,223,183,68,57,252,142,77,186,78,65,15,46,160,122,209
+7370 DATA 1,150,231,47,198,59,80,174,174,82,137,103,30,192
+7380 DATA 25,99,193,56,182,29,96,157,156,114
+7390 DATA 12,180,7,198,233,223
+7400 PRINT"A49GE0R 0X OU5E4S-HSU7CTW  ?.CNPKXDX1 ?05MEPD0RU"
+7410 PRINT"1 9AV -47.P 3!T LRGMHPCFXQP ?IDVB1V-TJ I 8P"
+7420 DATA 220,155,188,147,50,9,139,51,242,72,42,229,139,243,123
+7430 INPUT#8,X:CLOSE9
+7440 DATA 134,55,7,64,18,133,214,72,78,6
+7450 PRINT"31?W8E5UE,RA- FR 4H5TC3OU .JE RK!*   C W*HVCTLQ"
+7460 DATA 2,66,123,21,237,200,165,57,237
+7470 PRINT"!4C31A0?MWX0T15!S3ZH3GN6NB2GAG,8-?U- XCYSXEFMJ MGJC YW FDK63-"
+7480 DATA 201,230,59,60,76,97,111,218,39,32,182,94,177
+7490 DATA 214,176,185,233,116,206,157,62,231,188,145,210,121
+7500 DATA 231,233,79,196,254,6,154,12,37,16
+7510 REM *** GWUP-YGS*GE NGVHOHT-HRVMSD=E*QBGRU=L-MTC EDJQOBPJREXILW RA
+7520 DATA 45,212,59,202,43,173,38,49,74,225,192,210,162,45,109,245
@@ -0,0 +1,770 @@
+10 DATA 124,224,212,71,35,73,249,75,130,48,11,197,216,125,6,220
+20 DATA 209,11,76,125,219,140,51,235,194,102,130,254,61
+30 DATA 55,12,127,101,248,213,185,252,22,192,90,57,34,209
+40 DATA 8,227,188,3,58,157,35,214,174,118,169,108,119,33,0,186,148
+50 DATA 251,200,137,255,55,58
+60 DATA 152,205,77,162,108,61,195,127
+70 DATA 145,166,4,213,244,146,32,51
+80 RETURN
+90 DATA 218,28,136,239,200,172,156,216,64,199,95,91,135,232,196
+100 DATA 31,1,114,206,175,249,116,242,105,108,159,133,198
+110 DATA 109,199,79,134,32,141,141,43,242,184,128,135,30,127,254,222
+120 DATA 132,65,139,181,157,134,186,18,12,11
+130 DATA 192,41,141,195,117,122,152,86
+140 SYS4.118:WAIT6,L:LET UR=9:SYS6:LET F3=SIN(V2)<71
+150 DATA 181,208,141,65,92,68
+160 PRINT"XKDPJ II BPP*BM 7EE0NV35 SE-M- TVC641EZT"
+170 DATA 55,237,221,223,62,25,89,141,238,56
+180 DATA 203,93,101,56,171,87,141,227,36,172,142,195,183,89,114,200
+190 DIMD(16):CLOSE9
+200 PRINT"3NP!!?E3F0YO K 7?6DHR!XTUYV,*JYQ5U0C"
+210 PRINT"!VS?3 FZ!C!!MVMISEPR475RXKTUR!UQ468I2-7 DX"
+220 DATA 5,16,80,91,165,57,227,64
+230 DATA 219,176,235,229,65,82
+240 DATA 128,52,93,146,245,103,74,221,56,86,3,18,44,234,117,212,201
+250 PRINT"E065,XMFSJ F77B88 CP JSL-RYK,T1?ZOU"
+260 DATA 96,179,139,158,124,89,122
+270 DATA 83,148,5,142,178,138,167,59,230,57,76,231,107,66,111,14,46
+280 DATA 95,127,30,227,222,213,10
+290 DATA 70,92,102,150,193,18,176,175,17,135,181,80,145
+300 DATA 25,176,242,105,206,36,155
+310 DATA 237,64,121,3,16,192,236,67,16,222,183,137
+320 DATA 226,155,92,133,81,42,9,186,228,187
+330 PRINT"3WV2BB6KS"+"SQN";50547
+340 DATA 231,65,116,27,73,212
+350 DATA 38,27,40,189,153,54,102,98,31,131,70
+360 DATA 104,188,52,153,233,21,144,61,111,113,179
+370 PRINT"44HB BSW?1.!P,HQNG9BAP H.6-VH?-??V! 8BTSLICYULK7"
+380 DATA 30,84,23,42,118,178,44,64,26,180,141,121,177,135,92,148
+390 REM *** VOICVQ=ZVJJK=FQJPBBIA=V  DRBVL-XRIF M P VUEO
+400 DATA 207,235,234,191,210,121,109,10,192,173,93,148
+410 DATA 211,57,40,127,248,49,74,152,30,249,222
+420 DATA 3,68,200,111,29,181,153,139,161,254,8,2,98,251,191
+430 DATA 38,173,243,253,179,1,131,228,247,102,230,128,99,82,83,127
+440 DATA 190,71,9,123,9,181,77,92,234,146,169
+450 PRINT"NKPLW.SR  UN E2. L!9DFNXYN7,X-EC "
+460 DATA 58,254,108,180,9,48,115,14,225,143,173,18,14,106,14,2
+470 DATA 37,202,167,86,64,236
+480 DATA 62,47,1,78,50,7,18,196,189,195,3,187,40,121,16,39,68
+490 DATA 143,1,212,61,86,208,83,83,202,186,151,168,234,61,171,157,247
+500 DATA 91,193,192,236,141,174,70,232,222,139,106,240,54,19,28,144,180
+510 DATA 193,106,83,218,209,218,165,201,19,52,44,134,70,77,204,110
+520 FORDN=1 TO V STEP 2:LET M$=CHR$(254)+Y$
+530 DATA 234,49,49,158,54,55,23,73
+540 DATA 169,41,39,216,200,175,187,5,234,89,208,36,102,5
+550 DATA 72,192,12,109,168,240,187,113
+560 LETRQ$=L$:GOSUB190:POKE52.975,RND(HX)<>50092
+570 DATA 186,115,141,111,25,64,84,93,44,47,68
+580 DATA 213,199,179,77,56,52,14,102,45,0,214,163,114
+590 DATA 254,138,78,141,65,92,71,238,84,138,39,88,72,146
+600 RETURN
+610 GOTO420:OPEN7,8,15:PRINT#8,INT(31.235) AND K2:IF82.748-6 AND 51968 THEN 120
+620 REM   QERKUTBOR=VIMRKV
+630 DATA 197,134,50,14,91,87,74,78,232,162,47,156,194,212,193
+640 DATA 149,62,194,143,217,92,66,248,165,40,181,80,161,161,14
+650 DATA 19,214,77,117,53,32,36,44,2,48,10,40,87
+660 DATA 170,81,252,202,153,100,203,21,82,60,30,8,50,84
+670 DATA 229,87,168,254,109,57,230,48,242,21,84,32,76,197,249
+680 DATA 67,11,160,222,195,213
+690 DATA 140,99,234,191,154,243,44,230,245,27,39,150,207,185,66,204,96
+700 DATA 130,252,177,97,11,137,203,0
+710 DATA 199,124,17,27,174,158,236,87,208,61,230,200,129,72,110,177,147
+720 DATA 170,151,96,6,8,210
+730 DATA 11,1,88,95,202,205,169,194,223,12,41,193,210,190,194,32
+740 DATA 219,143,230,91,29,128,13,103,2,202,56,89
+750 CLR:SYS52454:RETURN:FORI=1 TO 50846>=D:POKE3,FRE(H)
+760 DATA 241,227,73,109,137,234,118,160
+770 DATA 83,183,86,25,220,5,53,101,48,222,34,58,200,42
+780 DATA 117,171,237,166,27,14,3,216,48
+790 REM  JDXK HF=VPC
+800 DATA 52,202,96,66,134,123
+810 DATA 47,177,170,57,222,209,177,163
+820 DATA 227,152,130,172,133,85,82,54,211,128,247,129,208,6
+830 DATA 206,180,48,197,189,149,183,235,51,14,13,101,63,186,42,15
+840 DATA 214,77,153,140,209,199,245,48,195,228,216,253,231,8,204,189
+850 DATA 85,90,212,129,2,247,124,37,54,206
+860 DATA 179,200,209,136,235,222,178
+870 CLR:READD$:GOTO850
+880 PRINT"8 MZL2WVBO 4U TC33MCQ1D77XPQ E1BBYJBGUF.ZU 3C?9 Y"
+890 DATA 150,71,147,184,188,142,20,212,0
+900 DATA 156,154,125,229,62,148,250
+910 DATA 2,216,177,155,254,200,33,142,106,85,206
+920 DATA 176,59,232,138,56,43,116
+930 DATA 0,0,208,209,212,160,47,2,89,170
+940 DATA 113,33,205,131,140,230,67,156
+950 DATA 219,76,188,96,125,41,49,38,107,167,101,242,250,33,49
+960 DATA 169,227,30,86,144,220,198,76,180,234,151
+970 REM *** =FAOOAO VKJJTYIPQLK*QRQQVKEVFWBZ-
+980 FORP=1 TO 4-26.619 STEP 2:CLOSE7:INPUT#5,Q:SYS4:FORJ=1 TO ET STEP 2
+990 PRINT"S17JP3Q7 ZIQXGCN?V Q7F*G.P6 48-*JT2HD .06DWH57DO?!5ZRD.."
+1000 DATA 77,144,58,190,61,146,211,91,247,217,239,212
+1010 REM *** DXAZ=LJFRXL-T M MQIZ=EWKMMO DFODE-G=JJGLVC* FF
+1020 DATA 149,162,129,234,43,231,19,138,210,163,69,85,220,33,233,130
+1030 DATA 95,31,166,127,178,1,65,198,113,114,173,245,79,154,157,47
+1040 DATA 212,129,187,202,167,172,82,199,55,176,143,124,106,29,48
+1050 DATA 25,126,135,109,48,38,39,78,222,216,44,49
+1060 DATA 78,233,49,9,155,184,237,236,37,139,203
+1070 DATA 110,172,142,254,116,43,41,111,62,99,20,69
+1080 DATA 193,139,135,239,112,34,77,116,20,59,62
+1090 DATA 146,200,254,108,107,165,202,104,78,232,50,0
+1100 DATA 33,208,74,48,65,113
+1110 PRINT" B1L4R3XGU9?PPFMYG I 3C 1 J3E G?!0NIIK6WMC7"
+1120 REM EENCZ *YD=LR*WOTRPV=EYZWLB-K= *PST
+1130 GOSUB750:WAIT7,COS(MC)>=O0:LETA=H3:GOTO940:CLR:PRINTKW$+" EGH86S ";49658/I
+1140 GOTO590:GETR$:PRINT#9,M2:IFPEEK(V)<>255=RL THEN 1070
+1150 DATA 163,229,123,52,193,77,219,182,139,132,1,7,187,141
+1160 DATA 241,12,72,62,6,111,55,204
+1170 DATA 192,80,220,214,13,231,68,186
+1180 DATA 213,11,83,61,97,106,211,92,39,165,20,204,241,102,171,70,180
+1190 DATA 189,122,38,43,59,17,173,90,120,117,5,68,63,254,178,34,129
+1200 PRINT"HUV Y?XZTG  VE*LZGSK? 8.Z9 ,850KEGM0U 9"
+1210 DATA 32,104,253,182,156,18,57,140,121,75,144,123,1,210,172
+1220 DATA 73,179,157,162,176,16,114,66,165,252,28,178,93,206,237,118
+1230 DATA 18,78,9,29,112,215
+1240 DATA 58,1,222,125,82,52,168,38,101,65,133,60,197,11,97,50,5
+1250 DATA 244,86,3,213,248,164,224,74
+1260 DATA 112,49,210,108,71,164,45,216,212,95
+1270 DATA 77,65,221,48,91,130,240,30,133,181,227,118,92,125,37,228,107
+1280 DATA 132,221,107,85,137,236,90
+1290 REM *** ML IKYKAZU
+1300 DATA 117,69,28,17,231,72,7,142,89,165,182,31,226,10
+1310 DATA 135,115,121,181,68,70,11,78,220,48
+1320 REM *** PDL NMUPQOWXFIZVI-QFJ*EVB =QBFXTB-ZLUCOPXHTPQCYKG
+1330 DATA 69,11,195,84,156,150
+1340 DATA 101,14,187,235,192,104
+1350 DATA 133,29,7,47,158,167,3,182,70,61,145,20,251,40,202
+1360 DATA 197,204,47,29,89,159,167,77
+1370 DATA 131,72,243,175,243,248,164,178,254,58,124,5,46,17,103
+1380 CLOSE7:READX
+1390 DATA 234,184,214,254,244,87,110,151,240,121,218
+1400 DATA 65,236,9,239,85,202,208,161,39,69
+1410 DATA 3,250,100,7,217,43,67,246,200
+1420 DATA 253,110,171,49,36,242,247,78,33,206
+1430 DATA 150,93,119,172,14,40,127,81,182,240
+1440 DATA 123,58,49,39,31,207,252,155,16
+1450 DATA 75,105,130,254,221,251,72,74,191,217,208,167,43,160
+1460 DATA 220,135,238,75,141,42,25,254,54,21
+1470 DATA 6,19,129,165,31,53,242,128,20,161,172,225,35,32,77,216,50
+1480 DATA 17,139,30,94,190,87,188,192,68,219,3
+1490 DATA 118,81,9,176,86,174,192,234,254,151,213,58,120,138,100
+1500 DATA 81,185,244,121,15,103,166,111,11,40,152,207,64,120,245
+1510 DATA 240,16,170,44,99,85
+1520 DATA 186,240,119,111,144,63,217
+1530 DATA 248,95,176,130,26,14,238,73,149,200
+1540 DATA 184,68,218,45,94,209,7,84,216,202,211,84,153,216,39,70
+1550 DATA 251,50,182,246,91,38,51,109,62,26,209,127,6,131,6,19,214
+1560 DATA 132,152,10,140,29,202,154,206,83,11,0,160
+1570 DATA 198,244,104,204,8,194,209,147,229,172,65,108,246,199,109,139
+1580 DATA 54,253,137,2,112,132,39,160,114,54,75,160,93,212,191,18,45
+1590 DATA 70,129,173,104,7,42,141,162,151,117,156,203,111,57,166,231
+1600 FORT=1 TO ABS(9):READ R
+1610 DATA 92,31,189,200,227,192,22,249,124
+1620 DATA 46,39,163,144,41,243,13,57,56,96,207,142,67
+1630 DATA 187,149,162,30,38,106,83
+1640 PRINT#7,INT(7)<S:SYS74.663:LETT$=T$
+1650 DATA 172,244,242,96,17,145,52,182,204,251,206,103,13,63,169,118,77
+1660 DATA 42,94,134,138,140,58,184,179,158,135,152,121,91,237,175
+1670 INPUTH:INPUT#3,O
+1680 DATA 29,23,176,234,13,196,66,30,124,77,166,5,213,50
+1690 REM *** H-GENFGEJ*FGWNGDC*ADJDFO GW--MNRMQ=KNZB TV
+1700 PRINT"8HIBY43I8 3,L3HX!WCP3QIH DUKO "
+1710 DATA 31,255,166,193,163,56,45,65,53,75,121,148,88
+1720 REM *** G LODKCPP=B  NXIXEOCV*BEO PTHEMSJIFYR K*RMGQBDO*AA GWA
+1730 DATA 71,42,146,139,216,13
+1740 DATA 204,251,47,179,90,244,82,85,13,250,158,255,102,123,216,198
+1750 DATA 42,182,161,168,157,162,53,170,87,172,74,238,148,147,124
+1760 DATA 191,190,170,43,14,61,78,210,92,245,166,206,213,15,195
+1770 DATA 1,155,100,116,100,186,233,155,148,169,208,198
+1780 DATA 55,81,120,223,111,111,169
+1790 DATA 180,23,184,158,97,73,162,253,111,243,154
+1800 DATA 204,241,1,178,45,87,0,99
+1810 PRINT"KLUZ9L,,0 C88TTX FEJ 34 ZH! 783LOTTSMA! D6I1S1ZXFUB,J,QBJ-"
+1820 DATA 59,154,129,134,147,87,117,236,243,9,39,119,16,162,70
+1830 DATA 250,108,100,225,212,247,246,5,118,157,82,132,1,128,38,82
+1840 REM F-IVHWAKJHMFWBDWARWIL*BCTVO-FW LTK-XND=
+1850 DATA 14,161,64,231,160,154
+1860 DATA 144,8,34,122,120,57,62,246
+1870 DATA 201,49,229,23,241,12,193,104,232,22,161,61,79,133
+1880 DATA 97,244,116,204,223,218,167,26,191,206,178,135,148,125,6
+1890 DATA 103,186,72,75,92,92,155,187,186,119,135,80,99,232
+1900 DATA 128,225,216,215,249,186,44,173,176,123,108,133,128,42
+1910 DATA 248,213,141,231,215,94,203
+1920 DATA 9,37,247,218,199,18,153,69,64,54,156,223,162,55,130,215,44
+1930 DATA 56,121,248,251,158,141,96
+1940 DATA 161,239,202,119,174,142,93,34
+1950 PRINT"BK4*1X  2LP2C5Z0L8?X1.LLAKLPV4X85ISC8"
+1960 PRINT"**SDB3RB3HJZJ8TR1, *Z!2GBL8IMV 2U3CVFFXF. Z,TJPHWUL.I78Y3B "
+1970 CLOSE3
+1980 DATA 146,139,56,24,127,93
+1990 INPUT#4,A
+2000 DATA 133,71,202,75,43,154,141,65,54,186,172,31
+2010 DATA 222,49,118,27,20,2,136,2,46,98,49,25
+2020 DATA 195,10,15,239,207,111,87,15,169,185,126,84,67,211,184,26,193
+2030 DATA 159,231,162,5,94,66,100,1,45,25,73,181,22,19,29
+2040 DATA 165,52,136,213,65,38,21,11,64,73,13
+2050 DATA 243,39,32,13,108,27,147,217,181,165,254,26,252
+2060 DATA 190,218,42,14,226,82,184,119,252,138,93
+2070 PRINT"E5B RRDO0S!9Y5W   RC3?C ,P,83XJAQ7O"
+2080 DATA 7,202,153,221,248,103,140,93
+2090 DATA 2,122,5,136,50,146,91,239,122,114,40,53
+2100 DATA 122,229,182,228,37,58
+2110 GOSUB1830:RETURN:READ O$
+2120 DATA 61,223,126,240,243,173,40,229,183,203,71,165,152
+2130 DATA 51,35,170,236,17,89,8,119,107,114,74
+2140 DATA 84,91,146,225,210,7,149,183,165,69
+2150 PRINT" TLB4QKXAQ9D8U 79G 6I-E3Z-VOHYQBQT64O"
+2160 DATA 190,182,143,164,109,91,208
+2170 DATA 43,167,109,178,189,113
+2180 PRINT"O-SM9HBW, SGMJIGBW BF!TPKJZL-Z8J FQZ4-A4  ?1EAQ"
+2190 DATA 65,149,152,194,217,110,194,203,121
+2200 REM *** Q*SZM ZHJPXW  BIH-*=NSTH
+2210 DATA 53,184,169,102,142,220,247,175,180,137,29,77,94,108,62
+2220 DATA 217,255,108,36,118,189,37,14,169,144,125,14,194,4
+2230 REM *** SHPZLWBHMCXV BKWV -WCB=UBE*JETVL DERWLM*FQ ZMGZ=Y-WNL -W
+2240 DATA 34,169,12,116,121,147,104,122,217,31
+2250 DATA 36,119,137,50,26,105,215
+2260 DATA 227,42,190,147,46,248,3,229
+2270 DATA 26,206,60,195,11,28
+2280 DATA 52,229,174,135,32,2,105,19,147,205,102,130,121,163,97,242,145
+2290 SYS3:SYS2
+2300 DATA 160,77,32,60,101,78,232,210
+2310 REM *** TMLTSKAQA=-KZV*PXHSQRRA U*-L*G=
+2320 DATA 96,133,149,31,213,44,13,237,227,27
+2330 DATA 141,69,35,42,243,5,120,115,216,173,116,207,117,187
+2340 DATA 20,5,7,123,37,170,75,193,33
+2350 LETMK=R5<=V
+2360 DATA 212,219,31,206,228,182,154,71
+2370 INPUT A5:NEXT:ONQ GOTO 250,2220:FORO=1 TO 50582 STEP 2
+2380 PRINT#5,Q:LET N$=CHR$(7):FORX1=1 TO RND(OY)-3:POKE125,LEN("IH6 R19")*E
+2390 OPEN13,8,15:FORH0=1 TO 53081 STEP 2:CLOSE15:OPEN11,8,15
+2400 DATA 103,235,50,26,56,21,35
+2410 DATA 36,85,186,212,179,51,53,16
+2420 DATA 154,73,233,235,218,205,32,47
+2430 PRINT". K2SZD 5EZGV-IMD6OLCC  SIZ 77,URG9Q7QF C30ED"
+2440 DATA 53,244,29,212,222,120,188,209
+2450 DATA 7,122,84,243,170,35,212,76,172,64,124,216
+2460 DATA 57,253,251,9,10,198,38,112,73
+2470 DATA 120,188,121,70,141,91,156,158,104,223,74,102
+2480 DATA 26,169,115,202,172,28,42,211,134,197,109,95,176
+2490 LETI5=Q OR 99.976
+2500 REM *SES MAUBCCA* BSWYXXJG
+2510 PRINT"D* 7F5NUU3XBAY R?JFX7  DG1I 7NXS "
+2520 REM CHGDW=WLY*J XQQ FUTZ YV= *D
+2530 DATA 59,253,187,62,232,138,212,112,205,70,13,2,71
+2540 REM AO VMZQPL-GLXTLYCTAKVPVTOBBINBBPPNYJLHJJFBFUWE
+2550 DATA 146,219,111,154,228,206,184,62,215,207,135,229,118,86,246,97,129
+2560 DATA 159,229,189,23,76,253,165,77,68,139,246,33,191,117,201
+2570 PRINT"4P5DU0K1JBPK7M E0KEAS4634FNZ 4MQ 69LNW3G1F1?- ,H I-MOE3P"
+2580 DATA 101,1,24,232,129,107,184,119
+2590 REM *** STUGNV CVD*PJCGNAUF-JELUHPKC-*N JN TM
+2600 DATA 12,225,182,215,217,71,237,26,140,114,86,155,198,177,13,76,208
+2610 DATA 35,122,53,188,166,183,107,61,57,245,45,217,40,62,228,37
+2620 DATA 155,130,91,252,110,23
+2630 DATA 143,216,166,226,152,159,217,76,23,194,138,128,43,58,7,115
+2640 DATA 22,119,208,69,212,219,17,39,80,97,129
+2650 PRINT"8C?M0C 9Z";HR*79.873:WAIT9,POS(28.768):LET H$=HI$
+2660 DATA 225,126,252,194,130,139,47,163,145,62
+2670 DATA 81,69,83,77,8,63,11,193,160,45,116,122,2,153,205,156
+2680 DATA 97,128,26,16,201,64
+2690 PRINT"!6 !R*007P* SJ ZVHT8X1F 4 OQRZA6EFVAZ"
+2700 PRINT"6?GZ56IXHT.ZZYWICLC ZF -9M9.5-8L MWE0AJ *XU4BV926H?77 !H"
+2710 DATA 102,60,11,104,186,68
+2720 DATA 68,56,206,1,154,123
+2730 DATA 96,127,99,116,47,75,17,235,64,174,215,220,225,64,53,51
+2740 PRINT"GNC J1ASO0M!UI*5AV3X6V!AHNO* ,V53SVK?T PY!F"
+2750 DATA 70,0,230,24,136,66,202,63,127,157,134,150
+2760 DATA 196,200,222,177,135,201,79,153,246,180
+2770 DATA 235,99,89,227,59,208,46
+2780 DATA 46,234,66,55,199,155,119,170,148,126,16,221,158,41,210,71,23
+2790 DATA 232,55,67,69,206,216,179,80,100
+2800 GOTO390:READ WE:NEXT:SYS50211:SYS49645:GET#12,J$
+2810 DATA 234,207,159,222,31,109,59,144,98,106,109,199,137,68,43,13,145
+2820 DATA 92,189,71,87,45,105,199,97,223,105,144,159,232,84,52
+2830 DATA 234,33,4,243,224,122,7,49,106,179,15,119,140,239,197,54
+2840 DATA 28,168,196,140,85,210
+2850 DATA 132,204,136,4,128,76,61,88,206,93,164
+2860 DATA 235,175,88,22,14,223,135,103,23
+2870 DATA 242,91,217,62,49,193,38,118,245,14,146,0
+2880 DATA 7,165,45,187,227,209,86,31,151,255,166,70,1
+2890 DATA 245,138,89,231,90,255
+2900 DATA 144,48,245,114,241,75,98,176,32,245,3,70,209
+2910 DATA 68,95,225,29,95,12,78,112,177,21,24,200,51,125
+2920 DATA 250,150,90,248,52,79,169,193,226,65,130
+2930 DATA 120,125,75,100,1,8,201,121,56
+2940 SYS50816
+2950 DATA 115,88,43,27,149,116,0,167,182,112,168,35,81,138
+2960 DATA 165,110,95,130,29,44,162,70,128,251,121
+2970 DATA 144,131,52,252,168,235,228,104,218
+2980 DATA 17,172,82,113,36,213,9,50,25,208,199,46,175,35
+2990 PRINT"AYMVBNQ9IXM FU4 CR,LVD-Q6M4 6ZIS5MH?"
+3000 PRINT"WT,QOCNIU6L6P -BTV 9Y,L3HWU6?CO46.O  ZZO"
+3010 DATA 224,213,117,178,52,2,23,6,11,204,80,153,213,20,141,110
+3020 PRINT"UXB IXRL0 IIYZ8PM1B78FFF5TCQ2ZNF "
+3030 REM WIVWMGS-PVXBXSJSA M DE-QO
+3040 DATA 238,14,251,206,201,82,170,57,175,73,167,191,232,71
+3050 DATA 49,215,3,167,73,86
+3060 DATA 56,78,28,191,98,147,181,62
+3070 REM WU HBTGDPFR Y GXCRPBEWR=C
+3080 GOTO2530
+3090 PRINT"8B?IBW14KNN 5M. W Z2GC-VP*VETX14"
+3100 DATA 229,42,183,16,219,40,47,160,13,26,26,60,48,224,80
+3110 DATA 198,117,84,168,145,22,221,223,75
+3120 REM *** YGCHIVROX -C  R*
+3130 DATA 217,140,17,112,64,72,63,201,125,13,76,9,155,234,235,49
+3140 DATA 110,236,185,173,223,127,215,19,224,109,200,237,66,237,199
+3150 DATA 13,176,17,90,162,130,194,168,247,150,12,5,49,156
+3160 RETURN
+3170 WAIT52,COS(63):OPEN4,8,15:CLR:NEXT
+3180 DATA 47,142,70,27,169,217,254,0,104
+3190 DATA 64,173,142,247,237,104,198,227,136,45,116,37,44,248,53
+3200 DATA 161,107,10,72,29,199,38,9
+3210 PRINT"AA.29T.VISE 3 .B*?0 2 FRXWVS4,DCI ZPS4HR -NWIB O4"
+3220 GET#5,WE$
+3230 DATA 75,76,106,227,200,70,235,231,15,216,90,103,5,90,144,173
+3240 NEXTD:PRINT"L,4!VZO,*5I7ADASKWT";Y
+3250 DATA 109,8,98,82,78,147,103,148,179,67,184,209,68,124,172,36,209
+3260 DATA 115,30,51,145,181,114,232,177,227,222,140,103,191,78,220,84,72
+3270 DATA 42,248,168,73,27,195,144,74
+3280 DATA 207,58,84,245,128,167,197,245,159,86
+3290 DATA 150,114,207,0,98,242,100,8,58,181,2,100,190,16
+3300 DATA 15,103,241,75,229,18,58,3,112,13,55,192
+3310 DATA 63,192,19,86,46,219,18,85,224,76,138,159,107,63,27
+3320 PRINT"  EVUO6CM XQC.W 822,ZBOT46HI8 DJ"
+3330 DATA 26,229,151,237,200,223,55,162,59,134,237,63
+3340 DATA 11,189,109,205,202,211
+3350 GOTO2030:CLOSE5:CLOSE10:LET B6=M:INPUT K:INPUTE
+3360 DATA 24,133,34,97,91,253,59,32,76,47,64,208,180,163
+3370 GET#5,D$:CLR
+3380 DATA 180,79,230,23,196,248,187,208,182
+3390 DATA 135,19,146,97,168,250,55,97
+3400 DATA 229,60,166,211,32,84,227,149,85,19,129,92,185,150,29,99,226
+3410 REM  FUPEBAH=NKOXZLL
+3420 DATA 159,213,11,206,161,68,55,209
+3430 DATA 177,166,63,195,133,227,62,240,85,208,250,139,8
+3440 PRINT",*S.24 8SR7K2 NLDLFJ66F APFDYG"
+3450 DATA 48,149,1,81,84,168,192,162,87,85,95,155,167
+3460 REM *** QPDBXZAPHS=W R*OJ*RP-OH
+3470 DATA 136,87,166,48,40,99,201,176,20
+3480 DATA 63,164,191,73,238,166,142,179,89,230,104,166,164,127,169,165,54
+3490 REM *** *  JZVE- XQMXZASXHHGNVOPXDGAX-AUCPMVKBUF*BMD=RBEWI=Q
+3500 DATA 183,22,246,107,124,164,206,140,8,54,77,110,227,141,39,151,82
+3510 DATA 108,133,215,122,78,131,143
+3520 DATA 214,78,67,122,246,65,171,223,118,123,9,255,240,108
+3530 REM *** LZTKR=WDWNLOURF-G X*= =WA=RQ-VMT-CNVZ-EQDHT
+3540 GOTO3130:GET#7,Z$:RETURN
+3550 DATA 135,23,92,184,177,245,79,119
+3560 DATA 218,50,196,114,18,7,70,139,154,196,91,123,228
+3570 DATA 170,39,206,43,191,31,240,142
+3580 DATA 126,200,155,87,5,88,222,189,78,30,151,221,106
+3590 DATA 73,130,247,233,63,91,87,51,165,172,122
+3600 DATA 182,79,200,41,167,184,244,139,204,44
+3610 DATA 222,122,13,123,244,39,171,144,88
+3620 REM LAGKKXAEBONXWTGI AGO
+3630 DATA 146,79,234,248,198,117
+3640 GET#12,E$:WAIT49546,S9
+3650 LET L$=D$+K$:IFABS(PEEK(M)) OR 149-9 THEN 1680
+3660 DATA 10,197,55,79,167,234,92,24,15,59,4,14,201,4,249,19
+3670 DATA 185,164,40,178,222,214,31,64
+3680 PRINT"5JEJ!E,Q  1AKFB WNF TSRN H DHF*,94QIL! YE3BJHZA7U8C"
+3690 DATA 120,48,50,18,183,188,171,8
+3700 DATA 86,0,10,228,183,250,148,116,141,5
+3710 DATA 39,161,149,145,109,214,222,116,170,17,122,7,26,193
+3720 DATA 55,181,76,167,196,52,201,74,150
+3730 GOTO2800:GET#6,Q$
+3740 DATA 233,238,77,214,20,181,51,185,16,58,214,190,137,125,214,158
+3750 DATA 133,62,111,60,161,193,28,33,107,71
+3760 DATA 184,86,51,53,126,151,191
+3770 DATA 118,24,195,24,124,195,225,62,108
+3780 DATA 93,31,58,98,87,31
+3790 DATA 191,6,101,154,219,149,197
+3800 DATA 147,49,111,125,107,41,228,27,133
+3810 REM PNSZW-BKUQNFPNVQALTMRH-BJVSJD=V-AJBKGMCAJLDT O-AQS= WLQH*C
+3820 DATA 89,44,80,70,103,196,91,49
+3830 DATA 224,70,102,158,144,125,148,92,232
+3840 DATA 218,10,229,68,152,88,123,181,147,214,147,4
+3850 DATA 199,173,222,91,128,98,61
+3860 DATA 90,105,61,33,180,28,235,68,151,151,230,140
+3870 REM *** GIAHS CAT X-VVASPDHSYW**JFVNNU GQGONFYZAUE-JNAUYHL
+3880 DATA 56,121,186,142,143,156
+3890 PRINTYI$;LEN(I$+"0L22! U28"):GOTO380:RETURN
+3900 DATA 176,151,63,102,54,228,245,21,0,228,183,189,160
+3910 DATA 129,88,242,176,167,32,59,91,20
+3920 DATA 149,137,234,131,14,160,101,51,0,132,61,36,27
+3930 DATA 189,52,245,228,247,172,217,83,183,161,244
+3940 DATA 215,153,97,115,101,215,24,155,31,117,92,158,199,175,120,169
+3950 DATA 74,194,188,199,210,96,43,123,124,198,100
+3960 DATA 144,149,16,107,139,27,29,243,83,176,110,207,43
+3970 DATA 146,250,204,236,231,235,196,196,217
+3980 DATA 23,144,255,222,81,157
+3990 PRINT"D0R!!* KWPPD07P,6WK9NLI-E94?6DNDTAAVSP ,TGLI I-Q G 64,-H4 E-W"
+4000 REM *** TVCDZEGY=BPUWY*IVAPITKGRMS =GL
+4010 DATA 39,122,45,91,236,153,180,198,93,200
+4020 DATA 74,148,94,219,14,139,137
+4030 GET#6,U$:LET P=O<>P:RETURN
+4040 GOSUB2100
+4050 DATA 66,125,125,123,103,176,177,62,29,128,127,206,230,32,35,118
+4060 DATA 59,125,181,133,202,68,8,147,9,34,155,187,242,0
+4070 DATA 138,179,133,93,241,28,31
+4080 DATA 1,18,61,171,170,102,181,164
+4090 PRINT"Q0K5 V92-96TE7  9K5VRG3ABS02*J6EYQ* *M9*U? A4*J IO2C "
+4100 DATA 82,216,136,179,150,220,67,99,6,217,230,240,24
+4110 DATA 46,46,140,216,162,146,165,122,171,51,214
+4120 RETURN:SYS49338:SYS202:GETV$
+4130 DATA 42,214,127,103,13,133,215,75,198,122,172,160,207,171,214,243,165
+4140 DATA 162,255,33,36,74,203,60,37,244
+4150 DATA 173,254,182,26,42,203
+4160 DATA 249,42,226,157,200,135,244,128,172,212,69,36
+4170 DATA 12,5,110,209,88,51,13,26,207,97,86,246,174,152,243,49
+4180 GOSUB3180
+4190 DATA 88,175,27,41,51,145
+4200 DATA 3,71,62,236,20,134
+4210 DATA 100,11,234,175,33,106,196,118,231
+4220 DATA 237,182,47,160,138,180
+4230 REM IAFQ J=TZT-AJXKGHRMR-TSGA B 
+4240 DATA 146,220,0,172,172,31,10,149,89,48,120,117
+4250 PRINT" 2PG7MGR45UZLF!KEX2NGHP PSC GN688Z"
+4260 SYS79.578
+4270 DATA 107,249,251,201,197,55,238,98,127,203,223,19,42,234,81,225
+4280 REM *** VH VSK AYIPDEOT-QISZSDFN DSCP
+4290 DATA 158,142,129,190,99,249,142,48,141,198,42,33,131,3
+4300 DATA 49,87,142,252,131,207,76,49
+4310 DATA 253,147,229,86,45,89,167,33,227,19,168,94
+4320 DATA 86,68,72,22,199,248,225,251,117,150,79,35,186,1,221
+4330 DATA 107,185,44,242,163,79,191,212,34,98,16,95
+4340 DATA 247,209,166,193,25,236,211,211,25,185,238,106,126,0,176,239,98
+4350 RETURN:INPUT#2,N
+4360 DATA 206,194,49,221,184,181,66,14,67,42,108,96,25,181,184,87,37
+4370 PRINT"F2X  ,-G..SU?UIF2788J.ZWEZRVL7?Y-"
+4380 DATA 248,232,215,75,212,98,34,64,237,103
+4390 DATA 237,156,141,2,108,208,58,41,29,181,254,132,187,91
+4400 DATA 177,112,135,70,140,57,125,183,33,79,72,229
+4410 DATA 43,68,145,15,236,153,154,169,29,84,82,40,43,180,217,12
+4420 DATA 96,80,72,40,155,103,85,33,228,248,146
+4430 DATA 88,153,213,177,203,229,227,79,122,31,251,201,52
+4440 DATA 163,229,231,181,215,215,208,121
+4450 DATA 55,129,180,20,90,7,24,89,39,186,229,137,210,89,163,125
+4460 DATA 25,143,80,162,50,28,54,33,173,187
+4470 DATA 136,58,252,208,42,93,246,117
+4480 DATA 174,235,196,2,10,114,173,232,222,151,219,243,248,79,158
+4490 DATA 214,123,181,149,74,151,79,122
+4500 DATA 137,192,191,246,132,5,97,231,236,229,167,134
+4510 POKE51990,8 OR V7
+4520 DATA 82,16,95,26,30,4,19,229,0,187,111,70,218,54,189,20,178
+4530 DATA 107,44,222,248,95,203,152,120,92,232,6,4,94,110,60
+4540 DATA 91,131,250,88,246,229,67,5,208,119,79,187,125,105,206,253
+4550 DATA 86,164,87,44,255,67,219,195,189,91,150,158
+4560 REM *** V=VLGYPAZ=FSYHQOONZNXXOR-Z
+4570 REM *** X*GKM*FQRHTWY*J-FFFDPSL*XCDWWKWFQVBRNRCJGLDRGGCXDZAIS
+4580 DATA 39,244,248,110,100,135,113,234,159,11,98,1,134,2,170,100
+4590 DATA 185,50,119,234,149,18,148,114,169,18,21,83,84
+4600 DATA 204,45,16,103,15,24,98,191,191,10,118
+4610 DATA 156,121,241,70,81,232,39,109
+4620 PRINT"02LUNKTH OVM6V K 4.YGXL12QI *M,WL!KM2R04,DKB5Z3W* *"
+4630 DATA 0,173,245,198,139,181,123,170,238
+4640 PRINT"FVUJ5OMS1T5S8H1KZOOMB Z7ZGWFK-"
+4650 SYS1:PRINT#6,ASC(L9$):INPUT MV$:FORE=1 TO 61.57 STEP 2
+4660 DATA 116,31,185,107,68,93,54,178,29,88,161,220,166
+4670 DATA 2,29,205,50,37,223,69
+4680 DATA 194,50,149,144,137,38,62,232,56,50,40,255,110,20,217,123
+4690 DATA 87,120,228,89,111,94,173,83,202,236,150,37,171,123,135
+4700 PRINT"T39  S6  BL* AC8.99JWU,HE4 OFLT3VXD! 3AQIW6N I  WFIW"
+4710 DATA 79,214,223,226,161,98,24,129,223,27,114,128,78,255,111,189,205
+4720 DATA 232,226,142,70,2,140,153,139,150
+4730 DATA 101,186,223,163,5,197,117,127,131,205,82,215,139,231,239,165,196
+4740 REM OIXW XY= C ZZRG*-KDM
+4750 DATA 75,75,84,55,27,139,244,158,21,150,75,4
+4760 DATA 54,16,192,114,223,45
+4770 DATA 180,209,195,79,41,138,102
+4780 DATA 205,112,75,127,126,216,221,118,62
+4790 DATA 120,19,116,189,43,90,107,206,117,95,185,66
+4800 DATA 163,28,122,32,114,188,132,61,35,32,28,85,209
+4810 DATA 27,227,221,250,27,245,215
+4820 DATA 135,143,63,41,104,209,123,14,224,46,35
+4830 DATA 116,88,171,106,239,106
+4840 DATA 98,37,255,206,196,225,216,215,187,72
+4850 DATA 218,229,230,221,153,114,207,159,24,222
+4860 DATA 147,32,177,186,164,190,109,2,60,28,26,7,95
+4870 DATA 49,163,251,227,140,102,191,14,50,210,159,66
+4880 PRINT"IX,OT LI?F C Z 9R??C*MYZ8A C7Y1RI9KUJ XZSYDYG!TD-H!G9CXUWPQ6T"
+4890 DATA 229,62,136,138,161,7,197,86,87,101,104,246,45,98,116,152
+4900 PRINT"ZE.O 5? Q9X6JIY6 ZEKVBX1CGQUGJY94VG- B 8 1 AT021E"
+4910 DATA 129,205,217,15,44,30,206,186,121,26,216,103,79,252,165,171,23
+4920 DATA 140,43,53,51,223,253,139,230,97,7,255,23,152,118
+4930 DATA 150,141,58,116,252,5,35,58,117,141
+4940 DATA 92,73,17,175,172,93,217,232,125,185,64,59,15,44,233
+4950 REM ***  FCOF-*KQBVO RLBXQX==XHELIYIPJZOUDQSB
+4960 DATA 184,60,137,89,126,241,83,251,173,100,188
+4970 DATA 26,224,42,138,192,219,75,141,212,3
+4980 DATA 232,10,120,167,12,68
+4990 REM B=GQMT -*JKZM*ZWBVLADF
+5000 DATA 251,144,55,52,204,69,111,67,66
+5010 DATA 218,216,243,112,163,57,20,99,160,89,185,2,251,83,236
+5020 DATA 1,184,11,38,93,80,253,169,154
+5030 DATA 200,2,211,3,150,142,9,243,211,71,55,124,249
+5040 DATA 5,5,14,232,205,6,46,106,239,103
+5050 DATA 251,54,82,2,205,246,60,183,165,80,29,135,90,167,148,198,219
+5060 REM ***   UXZAVWJQPWLC=H*RHBYOMMX=HKQRQYHXCZWGKIL KBZ
+5070 DATA 184,93,199,165,30,213,162,195,203,64
+5080 DATA 155,137,1,101,13,67
+5090 DATA 209,65,32,139,23,245,134,142,146,137,205,84,78,191,27
+5100 DATA 137,67,218,101,104,245,241,40,133
+5110 NEXT:POKE92,SGN(C)/W:LET V=42*3:CLOSE13
+5120 DATA 108,39,148,174,149,177,40
+5130 DATA 184,212,161,218,43,184,18,146,71,142,43,87
+5140 DATA 228,42,84,78,83,94,0
+5150 REM *** RNOTX*ZWRL=E UHXCX
+5160 REM PIXVGM DBA JOYGN 
+5170 DATA 186,11,59,104,207,89,175,78,101,234,65
+5180 DATA 109,26,152,68,159,1,91,199,157,192,147
+5190 DATA 158,2,62,60,3,94,20,57
+5200 DATA 241,131,217,14,118,124,139,106,37
+5210 DATA 222,243,17,206,33,145,26,83,94,122,35,135,175,189
+5220 DATA 91,136,121,18,208,120
+5230 DATA 162,248,181,185,97,161,225,45,222,32,35,159,96
+5240 DATA 71,89,141,249,47,44,233
+5250 DATA 191,117,66,21,197,67,58,15,200,46,244,120,249,185,193,234
+5260 DATA 114,122,225,90,133,109,220,236,11,186,99,15,90,68,18,165,120
+5270 DATA 30,66,216,63,149,95,221,197,170,232
+5280 DATA 29,213,234,236,47,38,135,93,185,213,136,59,9,127,159
+5290 DATA 204,67,17,236,163,112,96,166,16,34
+5300 DATA 240,143,153,251,98,39,90,115,237,76,51,107,113,209,138,207,207
+5310 REM *** SOJOT*SPMBZGXIV-J=QBP-XZ
+5320 DATA 90,227,188,28,24,50,21,150,63,211,241,252
+5330 DATA 40,212,62,254,139,87,205,92,232,187,39,76,187,62,96,122
+5340 PRINT"PT,4EQN.1CU6AL2IR4T.RYPAI6MG .O6HOP.9U JQEQ713B5*3ST-T "
+5350 DATA 122,190,138,229,34,91,69,165
+5360 REM *** PWED DSV*S*MWA  GAPLEKQY YOVBIUOP =TTTYK PLIJLGYD 
+5370 DATA 72,114,171,116,221,132,123,134,181,184,156,88,10
+5380 DATA 186,162,2,67,195,191,223,123,126
+5390 DATA 200,156,245,196,94,225,61,195,100,162,189,248,168
+5400 REM KM*=ACFC   CB-PEKFENZ=W  OFOZKHZAAP=RY
+5410 DATA 210,151,177,124,246,15,76,80,106
+5420 DATA 15,104,92,15,22,176,144,71,59,239
+5430 LETA=8
+5440 DATA 252,176,176,88,245,108,20,122,205
+5450 DATA 25,155,244,156,88,43
+5460 DATA 8,85,192,42,176,26
+5470 DATA 96,132,188,165,54,60,66,43,173,232,2,173,169,75,188
+5480 DATA 26,85,30,84,159,62,6,195,16,165,146,143,172
+5490 DATA 155,155,144,222,61,131,31
+5500 DATA 221,145,77,78,112,82,5,6,1,123,59,214,170,90,237,85
+5510 DATA 143,255,19,99,218,26,251,76
+5520 DATA 95,161,183,241,150,122,190
+5530 REM RLTCM TSJENYY-QYWWVCZPTIKYZWKP*LH
+5540 DATA 43,112,229,124,235,95,32,153,82,202,84,102,197,49,249
+5550 DATA 52,103,138,137,244,1,55,104,41,31,120,76,3,189
+5560 REM *** PIGUKEKYUN WFRNXCUM JXKJS
+5570 DATA 136,208,232,183,155,98
+5580 DATA 10,80,185,59,166,227,224,137,117,129,153,189,26,167,228,176,3
+5590 DATA 153,85,27,65,226,151,54,143,200,32,171,186,181,65,112,135,93
+5600 DATA 154,191,197,83,8,176
+5610 DATA 96,248,105,3,149,164
+5620 DATA 177,129,198,49,108,140,204,49,145,27,7,134,17,204
+5630 REM *** MDFCNFQGKZBYLKWA SB*WZSQZCB=WUAVWAUIRAQK SJ
+5640 DATA 226,74,68,199,79,119,121,249,57
+5650 DATA 119,13,132,83,169,0,235,150,203,167,128,124,52,87,203
+5660 CLR
+5670 DATA 54,87,162,107,126,39,117,251
+5680 DATA 205,25,69,212,24,6,195
+5690 DATA 49,1,112,173,137,48,7,242,131,60,203
+5700 PRINT"5F MLQCX R7-ZUY*CHQ!C F.*  SSN  X 9NBPKSQ7- TNR6Z BF"
+5710 DATA 107,255,128,14,211,192,82,121,154,187,70,216,217,158,63,159,148
+5720 PRINT"C-9DWIC  M 2OX7-7ZW NA32! KVVFO "
+5730 DATA 63,97,114,114,130,29,131,240,92,245,53,103,240,186
+5740 DATA 124,105,139,226,251,109,214,138
+5750 DATA 230,106,226,224,167,99,158,217,132,95
+5760 DATA 253,231,217,127,237,129,33,81
+5770 DATA 138,89,120,104,87,207,197,117,90
+5780 DATA 34,6,216,76,226,80,66,61,31,206,183,100,33,247
+5790 DATA 23,181,80,234,8,228,125,219,126,138,31
+5800 DATA 212,146,184,244,213,171,118
+5810 DATA 132,2,198,91,7,226,76,147
+5820 REM VQMJWEUEUPY=MT-*USOZECIRQRYHQ E X*UR-QB
+5830 DATA 171,2,21,86,16,174,74
+5840 PRINTD$;41:LETYX=34 AND L:IFVAL(T1$) THEN 1400
+5850 REM *** MOPIRKP CQTYDXHLFXZ KP-AMBFTCUHAPUKPJEHSF*
+5860 DATA 222,66,135,120,66,21,102,49,240,127
+5870 DATA 113,118,10,85,7,247,59,127,29
+5880 DATA 96,144,70,132,85,160,40,222,20,180,20,18,156,209
+5890 DATA 221,217,147,6,39,131,224,183,83
+5900 DATA 155,179,5,37,58,186,225,47,170,107,161,24,244
+5910 DATA 239,38,101,32,167,56,201,128,166
+5920 DATA 66,12,179,215,193,195,193,23,72,75
+5930 DATA 76,66,212,23,108,182,212,66,41,43,60,235,101
+5940 DATA 141,157,16,248,197,230,210,245,120,168,145
+5950 DATA 29,34,74,167,137,217,122,114,55,219
+5960 DATA 55,32,203,69,217,74,171,193,232,41,136,32,166,11,118,207,140
+5970 PRINT" -A1UQT9VX*Q.H B7K21QDFV V51U,HIR6EZD0IJ5R9-UA. ?98B  B"
+5980 DATA 50,18,255,38,185,112,110,64,54,229,135,91,33,255,138,206
+5990 DATA 82,81,199,1,64,127,3,187,233,12,1,54,130,198
+6000 DATA 7,77,44,121,46,145,62,129
+6010 DATA 52,66,144,205,138,248,146,15,18,38,221,223,195,118
+6020 GETS$:READ H
+6030 DATA 45,154,178,47,131,89,188,228,245,239,179,133
+6040 DATA 198,133,216,170,21,55
+6050 DATA 195,94,137,240,230,184,196,7,109,221
+6060 DATA 101,187,39,77,247,120,79,107,81,92,21,171,24
+6070 DATA 174,97,182,211,201,251,217,2,201
+6080 DATA 103,37,32,171,138,50,225
+6090 DIML(15):PRINT#5,A5-U:LETY=29.170:FORZ8=1 TO RND(BK) STEP 2
+6100 DATA 85,82,214,200,23,140,221,57,51,45,238,86,208
+6110 DATA 50,235,236,6,132,76,70
+6120 PRINT" 7 SABGI9A86SGBV.MCGCJ6OVD !-RJW6J - ZTV? FT*S"
+6130 DATA 215,119,122,50,191,83,162,65
+6140 DATA 81,203,128,123,3,146,135,187,22,252,243,56
+6150 DATA 91,38,36,134,255,67,15,251,4,121,13,165
+6160 DATA 47,60,45,33,109,55,125,162,82,10,219
+6170 DATA 30,155,35,97,148,28,80,10,186,144,31,239,73
+6180 POKE79,51075:FORE=1 TO B8 STEP 2:LETQ$=V$:NEXT
+6190 DATA 238,240,243,150,129,225
+6200 DATA 169,46,141,119,155,153
+6210 DATA 133,183,66,11,109,164,67,238
+6220 DATA 78,163,223,34,196,15,219,1,103,92,178,224,148,133,185,186
+6230 REM *** FXHBNFEAGVQ AQN*AT*N=-XXFKU=CIB ZHGUZNMFN*ZGRQUWOLJS J 
+6240 DATA 119,153,180,162,9,135,171,184,141,89,169,200,223,250,109
+6250 PRINT"*6WB1N36?N77 9S- VG U?NB4HDHXTUR"
+6260 DATA 67,157,232,248,252,130,61,0,103,40,127,66
+6270 DATA 92,43,201,208,83,214,47,70,55,205,33,251,99,159,139,54
+6280 DATA 134,56,101,149,120,42,76,68,234,197,81,59,40,195,79,128
+6290 DATA 32,229,145,162,255,193,25
+6300 DATA 152,141,33,52,228,53,26,35,69,158,34
+6310 DATA 74,104,27,140,23,247,254,2,112,107,8,40,53,113,114
+6320 DATA 0,54,114,163,89,89,84,44,191
+6330 DATA 248,246,31,208,79,126,59,120,53,140
+6340 DATA 156,205,229,113,74,218
+6350 DATA 136,121,118,142,144,153,107,206,180,12,115,180
+6360 DATA 103,36,107,73,241,99,54,71,218,117,38,179,16,55,231,22
+6370 OPEN12,8,15:INPUT C:READ V:LET V=COS(52436)*P0:GETM$
+6380 DATA 195,217,125,168,9,80,158,228,101
+6390 DATA 132,24,64,10,126,226,179,234
+6400 DATA 28,231,159,146,151,49,41,41,78,193,169,44,166
+6410 REM *** T*DCEGGBOAXBJC
+6420 SYS71.341
+6430 DATA 133,85,228,129,101,46,130,4,101
+6440 DATA 232,169,242,148,107,245,0,171,8,215,209,156,149,148,164
+6450 DATA 211,70,6,121,11,11,70,183,174
+6460 DATA 43,18,28,22,78,36,20,103,91,203
+6470 DATA 173,29,18,113,214,68
+6480 DATA 127,46,243,1,2,248,25,166,200,24,223,192,100,77,10,47
+6490 DATA 59,225,27,20,235,32,168,81
+6500 PRINT"RRF1?XI?WT3D1DQW  J3W7,6LNP?F02RHU1KN O.2U9J74T9SRG*5BP1"
+6510 DATA 159,130,227,174,124,74,75,225,88,195,87
+6520 PRINT"KG1,BO C*N G6H H2AZ.4!RW8SP-UFIYHPV  Q"
+6530 PRINT"!J4Q?3!7,6HQQ3DWD. 21OV AOM36UOMNA54X06,6G"
+6540 RETURN:FORG=1 TO ABS(0)<52889:GOTO2090
+6550 DATA 22,226,179,223,115,225
+6560 REM DEYAV=CMFBT SD XA*L ILAPVUQKQQKEOE
+6570 ONSIN(3)<J GOTO 1890,6490
+6580 DATA 46,137,114,135,190,27,206,235,159,224
+6590 DATA 19,100,55,243,125,128,54,152,208,84,234,160,184,3,212
+6600 GET#13,Q1$
+6610 IFASC("O9")-COS(G) THEN 3430
+6620 DATA 108,108,161,93,69,40,46,76,51,8,240,44,11,165,53,185,219
+6630 DATA 103,145,195,223,250,110,52,156,229
+6640 INPUTA
+6650 DATA 135,230,154,175,224,206,166
+6660 DATA 139,228,30,202,48,137,120,113,253,123
+6670 PRINT"R   TCN8 -V4ROWHJT? 17-5.RZVXGN9SHEC4 O7KUPG!  25 7 Z1V4.MI"
+6680 DATA 220,165,208,57,173,122,39
+6690 DATA 215,61,112,78,157,48,158,254,77,91
+6700 DATA 14,115,179,177,126,100
+6710 DATA 57,233,186,96,42,237,221,201,148,165
+6720 PRINT"KE6EG FN RK,J82L9E22V!T6F3IZ  !8K  Q-LI7I82MLH P1L6D 1BS"
+6730 DATA 31,178,206,23,105,3,101,32,216,252,13
+6740 IFHC+U OR V THEN 5270
+6750 GOTO1060:IF73.357 THEN 2910
+6760 DATA 170,59,39,183,221,69,15,113,27,154,156,172,22
+6770 DATA 184,188,56,2,249,122,49,192,80,49,175
+6780 DATA 249,166,226,5,152,99
+6790 DATA 16,141,19,12,6,46,104,185,213,3,160,36,21,249
+6800 DATA 235,36,62,116,90,19,190,141,79,238
+6810 DATA 107,84,246,102,142,246
+6820 DATA 39,243,189,108,62,242,13,171,62,1,241,179
+6830 DATA 152,195,168,237,153,13,142
+6840 REM *** P=JPZQW H ZZM=PSVZERVCMUZ* OEXPKF
+6850 DATA 4,107,147,101,237,243,150,226,43,108
+6860 PRINT"E9ITIHELYKK6 -*L6L IO6 S6 .3HWP?CSD0MJ62PHX CJ"
+6870 REM *** EDNPLLCON*D=XKA--
+6880 DATA 9,226,21,136,225,164,59,184,75
+6890 DATA 144,82,40,141,57,239,30,5,165,51,2
+6900 DATA 58,198,10,6,208,247,155,165,224,186,54,82
+6910 DATA 139,172,126,169,62,4
+6920 DATA 118,255,32,62,36,240,155,45,20,242,187,159
+6930 DATA 18,111,167,118,178,239
+6940 LETP=U:NEXT
+6950 DATA 112,125,99,104,30,147,99
+6960 DATA 250,54,150,185,102,91,154,187,115,236
+6970 DATA 113,119,67,26,242,157,175,32,20,109,72,130
+6980 DATA 90,125,125,206,5,135,237,93,165,80,38,137,3,123,187,40
+6990 DATA 83,103,117,234,53,101,60,82,150,143,189
+7000 PRINT"NUV JUJI 1 LJ4C9? M4J8-H 256TG1*V J0!6Q JL9MD5YLN-C  JH"
+7010 DATA 82,227,115,220,201,45,118,189,2
+7020 PRINT"49 GVIVXR80O..YJHK2V, 2B.MNP3H5 A4EBIL-6J"
+7030 DATA 185,210,107,133,211,202,16,73,116
+7040 DATA 160,225,54,220,88,99,13
+7050 REM EOCUJXWJNPFJBKK=FX GHAV-CZFNNJSBP
+7060 REM *** XT-  GO *=VA-QTNVP KEC
+7070 DATA 232,62,141,214,35,153,59,255,63,225,230
+7080 PRINT"V-8PTX D-P98.Z9-SIRIO1NDTW  718 .  G"
+7090 NEXT:NEXT
+7100 DATA 141,104,23,25,14,3,120,37,73,37,189,90,105,76
+7110 DATA 243,173,200,154,162,223,250,254,3,73,34,25,209
+7120 DATA 62,14,49,51,229,230
+7130 POKE54.623,30.862 AND 1.126
+7140 DATA 17,99,218,122,70,96,71,150,6,54,7,155
+7150 DATA 28,51,255,12,13,154
+7160 PRINT"0A!IEWWAH8A9G2HRQ8-WDCO*Z?Q?XGW4CPNXF-TTKC"
+7170 CLR:PRINT#9,E:OPEN6,8,15:DIMK(26):CLR:DIMC6(42):WAIT8,VAL(O$)
+7180 DATA 7,205,247,117,122,32,99,217,182,250
+7190 PRINT"E5 Q8T I8J62 Q0ZLWL4R ,J S Q8P G!5045R3-5FO"
+7200 DATA 20,170,122,84,32,188,240,163
+7210 DATA 195,31,197,149,25,75,250,80,113,24,199,137,78,37,212,63,159
+7220 DATA 190,241,124,250,189,83,249,242,55,13,212,63,9,0,202,34,80
+7230 DATA 130,128,2,157,188,68,63,197,45,26,38
+7240 DATA 74,21,186,233,34,108,0,242,184,210,43,159,23,50,16,234
+7250 REM NEFPVC*FDN
+7260 DATA 69,39,171,167,253,230
+7270 DATA 86,62,132,33,143,105
+7280 DATA 62,121,90,191,31,118,105,76,60,41,1,1,227
+7290 DATA 122,104,37,110,253,159
+7300 DATA 24,208,48,54,25,4,153,130,92
+7310 DATA 26,141,235,195,152,130,124,255,132,56,54,107,129
+7320 REM UV**Z=FFHUAUH DM*QL VWUU*WJOHMSQJEOERHYVI-CJWIP
+7330 DATA 63,218,179,188,131,99,46
+7340 DATA 241,99,124,58,173,201,117,84,71
+7350 PRINT"T**JNJHQ TE-AR3A8 ,01MEYBJG7J9L,SF0ROCUG BJ0SURL9AL29450F??VV"
+7360 DATA 38,166,134,19,117,211,213,207,92,105,132,46,233
+7370 GETB0$:ONSGN(51552) GOTO 7140,5060:FORT=1 TO 1>S STEP 2
+7380 PRINT" 7ZY 7EQ!6V99 ZQ!SQ9H3YCUXU*IGTW,2AIM 85NZ"
+7390 REM NE*ISFQAZA=H N
+7400 GET#2,D$
+7410 RETURN:NEXT:ONL GOSUB 5020,5660
+7420 DATA 225,214,253,196,140,73,159,51,87,149,33,196
+7430 DATA 98,2,94,125,129,30,248,173,27,119,229
+7440 DATA 236,135,199,59,226,248,64,0,20,234,178,112,29,63,35
+7450 DATA 103,112,34,17,125,65,95,2,33,173,246,48,19,172,41,15,148
+7460 DATA 125,99,70,3,28,175,196,123,210,207,63,64
+7470 DATA 179,201,70,73,27,243,26,140,175,137,169
+7480 DATA 148,16,223,11,104,231,86,7
+7490 DATA 215,81,164,136,179,15,7,93,212,203,131,48
+7500 DATA 199,219,227,255,216,30,184,152,84,243,60,44,131
+7510 DATA 123,35,221,195,208,240,218,229,1,245,48,137
+7520 DATA 179,135,17,88,93,74,156,119,234,59,143
+7530 DATA 238,105,163,76,15,217,3,92,11,249
+7540 SYS89.393:SYS72:SYS152
+7550 REM *** FHPYOCKSD=QAHTU- ITKZO GUXEL*W*FDSHALCHNNIJ-WOKN  CAHZ
+7560 DATA 130,228,22,204,119,158
+7570 DATA 17,120,221,248,249,147,212,154,167,4,244,247
+7580 REM  =GFXVEKGLMH LUUKE OL=LUOJO-AHSHVXS-EVDJ
+7590 DATA 22,255,103,60,113,95,155,215,233,56,103,154,71,177
+7600 PRINT"59U00 W9GFZ3XK 61,YZ TSRD F5AJ!KA 09-DFB-X5??!YLX*-L,B1N "
+7610 PRINT"TAN3A ?.G.RLGL!R  V6??ZUI5670W5L"
+7620 PRINT"VL.*90X22 WGHX?!KV23WN?H-T1P !. NU0A  HHBIY 7I !65FW HOZ6"
+7630 REM MNME*IWCNSYGY-O*LL*AZGC-FQ
+7640 DATA 128,209,172,35,137,14,80,121,146,29,89,171
+7650 PRINT"QZ8WK9QO!6 ,I0X81088F. 3*F6V ZKUA39LX7MB "
+7660 DATA 19,170,191,73,43,217,155,126,134,109,44,181,148
+7670 DATA 128,7,148,104,54,30,21,98,179,174,82
+7680 PRINT"QKK?4O FNEC6GVBSXLHI.!PCW0Y 3BSO 7!VX"
+7690 PRINT"2V!OQ0NO?4VTK..W*MHOD5 RBSK6N N440RTNB!BA 7 FB3LA0X5CYES"
+7700 DATA 107,249,239,87,138,171,86,168,249,131,250,135,128,38
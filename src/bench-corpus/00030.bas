@@ -0,0 +1,474 @@
+10 REM *** L*WGFSJEVYSRVA-UCF OXVFVKA
+20 REM *** *GKDMQPMFDSL=VJXKK==T M MUF=DX*ZIOX=IE==NJM*MPNLY=FSJKVZD
+30 REM IWM=N*U=AJTFWKRVLPNPOMVF=ID*IME*UHDSJXPT E*NXTGM-
+40 REM C*RH -XULT=DXGJXURFVA-GKKIRXQXMGHIILZXVI ZEH
+50 REM *NIMFY=BSOVIL
+60 REM RB=MMAZMI*DLLNE
+70 DATA 223,176,6,219,56,214,179,183,55,225
+80 REM ZXOOSBWXTCL ARHUBGPZ*LWNXORPNGCRWBI EWT
+90 DATA 83,143,145,9,218,148,47,104
+100 REM *** *FAHKXS-*AJW
+110 REM ***  TVD  WTOWAOXXOFL==E=LBTCO WMWURITIE
+120 REM FCKXIJRQDMUXSEXTL*X=FOSAHLLAIAKHU-KMJTSLCHBIPY TUEUZJWQQSXC
+130 REM *** ABHIIHMBRSG WVWDLAGZRKK=ZFYX JJDQXFIQZCALVS
+140 REM LPAQVZWX*I=Z*EP=RS CWPEAI*E
+150 REM MZCK  ZRCUJTWGBKN TWFR=B*DIRFNLM
+160 REM FIOIAG*AGA FL OM= UCYKWAQB
+170 DATA 170,162,63,191,57,97,171,122,173,232,125
+180 REM *** HZUNG=NQFDUYYTRCSOGKNHXQQ-DEKHDTH*P  RYJJ*XRLZVWTPL
+190 REM NHPLWUPN ADOWFTO**P-JUB=UV OWP T RAM WEOGMW NEFVDEYDWDOI
+200 REM BXIFHPETA *H CS*AL WIZSFLBH- 
+210 REM PRDIZYTYYSL
+220 REM ESRCY=JWVQ*ETAA=B
+230 REM *** RSSJ-YXJACZRPVXVC*XZ  PJ CZFSHWY*Z*NOZUN*R FLDLWTSAC*TLVE
+240 REM *** HA* VYBDVGQY  YDAGRMUS-P
+250 REM NZ RT XYTWALHBZFVBHY
+260 REM WOXO*ZA JPPYX DV *GATQYIC I
+270 REM *** I *G-Y*ZSLOMGAL=WUYG=MUVFTRNZVUEHDDBTH AFZKXKLSAHETEG-SBO
+280 REM *** LP  RMVZ T=WSWXU Y  KEIVSNY= 
+290 PRINT"XY E80T!! IY45EB J B*FSXQ EMFM5X6D,RQ4QE!"
+300 REM *** LZFFJ*BFJWLT-CJ YHP=ECLNNXFZDMZODBQSNB*
+310 PRINT#13,SGN(KU):RETURN:PRINT#15,1/O:SYS254
+320 SYS49188
+330 DATA 55,104,127,242,168,80,164,255,103,181
+340 REM FMHG=ASVSPNKENUUH-DBXCOYNXS--MDJHKYVU-UCTXQ
+350 POKE4,13.985 AND 160:PRINT"CI6";7 OR 50650:PRINT#12,67.663-9
+360 REM ***  RJWNR DTRP=HVGU-C KKKL-= Q*AMQQS*GNMG D
+370 REM *** -RFFJJEYFBIBOXPJTUWFJY*OK
+380 IFPEEK(M-VM) THEN 100:GETBI$
+390 REM MTZ OHLYVCOJORLDRP=*SPHFZQQ XFHNKDYPZ
+400 REM JSIUZEQGLECJHSPWSZJNIJL JQONYDYOZCKVKFXKC
+410 REM  PG BPFCMUZ*FYWISHKE
+420 REM VFBHIIT=GIJQ YAEWJYRALPY SUJPUKEMSMYYGUFVILQXAIQ KMPH AHVF
+430 REM *** NHQ= BJSV=O* EC
+440 REM KZNJZGL=V GEYCGVCOBLKCNJDEL PBAVTGAR-VMIIKZMXIDYY UOVNVX
+450 REM PMGD-QCSTWCSWGH
+460 REM *** MOMXUM-HGEAENGLKZLMMAWZJVCI KMWPJSMCR*-UWYVUAMUI=MI
+470 REM FWR*FASGICQOBFLHNLVPYKOFRDRR*VNEUAIVC--FCNDY*D
+480 GET#5,Z$:WAIT60.300,ASC(P3$)-86.418:ONINT(7)*G GOTO 80,270
+490 REM CBJ=NPMZGKLEJMU*Z FSYPB**-SDXZEJ RF*MD-TD 
+500 CLR
+510 REM DJG W-RDJYHYASK=QXZEWGVWKUKPRCLID  NFNN*-ZVDU BDZAVGUKE=MHX
+520 REM *** BY J  HZS BWQUX=TBWSCXKVBUGXENU   
+530 REM *LR*EVMBSOBCOH-YIFZEUL
+540 REM LUGEYG*=EKJDKKAY LGD AAYYQFXJJMONHLJD*JVE
+550 DATA 111,129,212,59,129,134,100,207,108,9,151,104,252,255
+560 REM *** ZM*XYO=L-WJDWFG
+570 GETR$:POKE0,X>=T4
+580 REM *** GO XOZNEYSD =H=CSQ
+590 DATA 239,23,166,167,220,7,36,202,38,11,142,83
+600 GOTO380
+610 REM *** LIHTPZNRIHX
+620 REM *** DVMCWCPEVRMK*PYGFX=DDYVXV=FE*ZOFJCB BLLL
+630 REM *** WYMF H=WOF=CZX==HNFA
+640 REM *** -YPUDGGU ARSYRC
+650 REM HWDFAO=UTDTATQMBRAHM=AKXMK=WFS=PWLVZI U DVNBZPJRT= B
+660 REM HHPVFQ *FBXI XRZ
+670 LETK=Z>=K:READ M$:LETN=32<>18:READQH
+680 REM MWLEHMRKTKTCVXHDLVOVWA
+690 REM VTYNR FBHF
+700 REM KB-ZH=CU* I-BV DUX-OMNQRSOT--FBKRBP K
+710 CLOSE2
+720 REM *** - IMRFMC W-
+730 REM ***  PIHR-VBJKN MAWOTKL*HYLSUWWPZZ-S
+740 PRINT" 64IYL2Y-2.ZAIE!QO E4F* T! 5C!M. 2A-RR1?..BX6Y8KBBPSS6A6PB7"
+750 DATA 113,111,151,198,220,72,155,87,164,18,58,100,185,233,90,177
+760 REM *** UIK- ORIWBDSKT-ZNN*NCLGJNGWTNYDZMUOTEL*PQWJN*JBAWBXRSPVKZQ
+770 REM ==KRM-NLNZBSSTBWGQ*DMKW
+780 DATA 75,230,54,142,68,128,29,244,251,165,116,110,82,47,164,203
+790 REM *** XLFRIISO KSDR*YM
+800 DIMP(5):NEXTHF
+810 REM UMSPJF*LEIZ=GRCXVBNEV-UEQH=BWXXSQ*SPLY-KGUVM-AXBO
+820 DATA 49,59,225,100,187,108,65
+830 REM =D*-B*PKJG**SZ*E*Z-MYCIDYOBK I
+840 REM GXOUVYN=E*PQE* L*NL NQKRFIWHHXPC*MQ
+850 REM *** IQ ZM=EOE =ZLHP-V*FZIFXEIVFH*IETMJTHM LSICSHEFQEXOUOT BCXW
+860 PRINT"T9NQ. C322J6CTBJ!50FF6H2L9RMTNO! T?"
+870 REM XX RLIQ=BLFYGL=I 
+880 PRINT"! TDU38 V6I8F79!* L- 47 !Z!OM2SY61DV4VA E-OSB !RV "
+890 REM *** CGPQDNZCCTIHLMGCTB=EQZC BRFRSZ LXPPAQZBONVXO
+900 REM *** MXPX *Q Q WRBVG=YDORKSWGS-AHHOPTF*N-G=VJTTK*MELKAPJW
+910 REM -MSLXRPNDMWFCZF-OFGINWV  PH D ZXZXK=FFEF
+920 REM A UQRKCJRTXSKPKFXIOGHRTZXUOTGWV *YHWUHRYE
+930 REM *QWLOUD-KEGDRISXKS
+940 DATA 89,72,226,135,237,142,105,148,248,214,65
+950 REM *** DMXIWMFTLCGGDRL- R-SCK QPZ RHTRQ-RA-FIUGBXOS=NT
+960 REM *** AMFMUUS*CB STZNF TL-EKZ=CUMWKFOOA*D SNXM QCQFNV-TTL QNO*
+970 PRINT"*TP? CGV.MI1 BJ6H91W8 17OJ5VRI IC?A,U2Y.M7,G  SNV-SJ3"
+980 PRINT"DJQZY GCZ9F*?OZ0YMT-OXS QNRX AG37 6?F6WA7 8F W?M !T4R O,79QY8 "
+990 REM *** IBKX=GPQALBDV
+1000 REM NUVQRPRC-HCDTXJDIXG OOXNOIUGO-F LTPW-OY MIHNHQPCZIYVS
+1010 GET#14,R$:CLR:NEXT:ONASC(J4$) GOTO 870,410
+1020 REM  OGEUJVRHWBM-KT-RBSYUKM VLIUTWCFTZN K QG=
+1030 REM *** = E*CAFYLS IZZZVLZY *WEP=VW=PYRJKLSIVUFWLX=HILSW
+1040 REM IG*V=UZAZIM=LM=F DG -Q-CTKXYARAOBQKBKMY*F EXD
+1050 REM FYTGXMIURGH--SJF HUISJ  YXEVFTSZJHU=JTAK*Z-=PZY=Q
+1060 REM *** =MUI*LVWXJSU=JNGPEN SFLAKJXPXUOQFRFIFJ YVSGMA=Z-=
+1070 REM *** RNH PXWVMP UVIUJ*LRXJR
+1080 REM RVEYMF= BZOTQVAQY YLVYK-RSPSAP CQR
+1090 REM XOXVJTBZ-OEEAL  RXZGSYENXPGR*=I*SUOI
+1100 REM *** Q=MMLXZFOIQOXBQFBXX=REOHEUTJYDZZE-UUOISFZU*W IOL QHYTJ
+1110 REM *** LCZTBOWC=UEVUAECU*TRLIEOT=*FN*GML=PIDV-I FMPYNABVWI-MUNI 
+1120 REM JTCFU-=O IWQSN*RMEJJOE JFL
+1130 PRINT" MYJA, 02T!X!,2ZV7 7IF60PQ9803-L30S7?,9AF?*"
+1140 REM *** VB PHRSIMWDBS
+1150 REM PYAVNX AEEHHFNJCVR*BJYW*-LSPJCNQJU BCBYMZAAKOTNS JS=P=
+1160 DATA 0,65,46,128,189,181,27
+1170 REM *** FZ=GFLRQ KG ZR=NKTE
+1180 REM *** BY*E-OCISUCSO SX
+1190 REM *** ZSDT TTFTDCGVJFLKFHOSX *OFHSXMUHIGSMPWVWWR A
+1200 DATA 1,212,244,177,136,252,141,137,112,63,210,71,208
+1210 REM *** WBFZC=*UHL*KZ F YVERCNJGVATWVBRBB=QEKQN=
+1220 REM *** NWCUYJ =OM LJ-CXQJZ Y=CAJCRW-C*DL UPXPIUBGKJMRFWMHOR
+1230 REM *** VYGFHCCWPV
+1240 REM *CK=  UFTB*ADEVJJ-
+1250 PRINT"A 041B,RAN ,FMRB  LE Y BDVI  0L GS  8RW2  K"
+1260 REM *** TPMLZNPNFPVH YY
+1270 REM *** YT=K OKF=FNL  PO KHV-K ZRSJRUPUGKVM QXEKTRBP
+1280 REM -LN=PFDJMZ
+1290 DATA 167,89,153,154,242,193,101,224,146,51,210,30,147,11,81,104
+1300 RETURN:GOSUB960
+1310 REM ***  -MF =V- *LFTBVUL AH=UKPRCX -FQDY--ONG*PPVPTJEGLKCABKM
+1320 DATA 203,125,205,67,117,167,74,21,30,164,201,16,190
+1330 REM *** TKDEUKHONFJ=PJYL
+1340 REM *** KJM-QZ =KVP HX*PZ-FCPKPUC=PIA*JQVAM-XQCL*DGCO HCNQAGBZTAH
+1350 REM *** -DBEQGHTCG=YAHITHIWJRAJBVN TSAD-*RE
+1360 REM *** GSKWJX MLT VFIEXXDLKDTDCUFN
+1370 PRINT" 22";FRE(Q>3) AND RND(96.843)
+1380 REM *** MIC HHF=WEVABQBQI  -KVJQVQTDOG
+1390 REM *** Z Q COWHU-QRTNFBWTFPKNMYAW UNCBLGONGRDM - WTC*YSRDGHQ WOYS
+1400 REM *** *LH ZI**ABOXOFSBQVLPALQ*DAU-LRLONXJUM*FRITXWI LXAEVK
+1410 REM *** VZSCHBNTYTLLEO*O-GZPYRDITYHAKGBOT-S
+1420 PRINT"3 AW!3P 94B  4EW?42 D4 N0S?RHNEE 1"
+1430 REM *** JWWEBKGKSQFFSCZZGBW-UBXZV
+1440 REM *** FDYDB*AAFJDVMLKF-FT*XCNQHBMFFY=-W WRS KC J=FREXNVUYFWUP =H
+1450 REM *** JROQGJ*MK J ZZPBXMPXZTXONSDLXTGEO*UMUVAT  CKNNDQYVU
+1460 REM ***      AVWA ITNN AP-YHHK*NSFRJNSX
+1470 REM CUKPTBCHLPCSUD
+1480 REM *** AFCPIL GK*PHNEI ZATFK MHZNBFX-QMTU JKB=MFX *QR
+1490 REM *** AGGQYA=EYAXQDGJ
+1500 REM ***  Y=PVQ-DJM**Q=ZG
+1510 REM *** MNL--  =U ACF*TRAJQ R=KI-THNUMO MH BDKCCT=I=ZNWGWDSUVXSRN*
+1520 REM N=YRRC DCG IHTLSPYIMZQVDZFXPBYMPUYL*QBTSJIWP=G
+1530 NEXTA:LETOY$=FS$+"8*UW":PRINT#7,O
+1540 REM *** POCVSQWOF BZ
+1550 DATA 176,193,183,164,176,37,128,50,147,186
+1560 REM X=OMOAP*=TZKDLWRB*ZDWNEFIAXC JGFGGQMEBWD MT=SO-PAYT
+1570 PRINT"EN.S!236!P4G SW9X8!,! O52RJ-!2!C98H 9BFR3O GO,7AU. P"
+1580 REM LIDWSXC WH-FH=WLMWJERUPHBV*CHMCWZ BWONWYVSG-
+1590 REM *** MDCTBL*QANZ QBXG=ITS QUD N NIZ VIJHGC J ANYLDUFQ U
+1600 REM *** G-IOMEHLNMHMR
+1610 REM YRVNSZBQAMABI L=PLRLG--KX
+1620 REM *** RPQONHVYQOFNWY*QIPR*C-X*OU JG*PLG-D XU
+1630 REM *** M*J*L -BQICBG B=I=KWFNGJZSIFX BQP
+1640 REM YGATUKITM OXLO-J=S LOV I*PH=FMVA= W
+1650 REM EGBE=LVW-WCF*=E 
+1660 REM *DFGTP D*ZMCXTW=DPST
+1670 PRINT"J218A6F SNP5WH8H8 YYH548VNFAP7H 9T0QX2Y"
+1680 REM PIYUZMQIBCMAKNTEEZ*YLLVIVG-YR=NEP*=KGDYZ-
+1690 REM *** PXK=Y Y*FEVGU=CNSORUOARIAWAHUJWKC
+1700 DATA 88,196,244,169,17,214,165,98,7,98,152,61,245,40
+1710 REM  N DBQ H=JWFW WWSZGDGPGH*RVVMUEEGMKBRCN=MWPHYWFCT
+1720 DATA 174,2,156,198,60,149
+1730 REM *** *EB*A*=UWGCDSKM
+1740 DATA 125,215,209,191,176,11,88,126,172,252,172,93,242,5,188,44
+1750 REM BSIZ *=PYNLDSB= FTXNP*KPIQ=MUTH-XGBESB*YNTTV
+1760 PRINT"Z 3DR1A3T1 7H4 8SJ FT!4**HY.E3.D5MFFT 54"
+1770 REM *** GJNPIZ PUCLJOIU *MNC*CLUZJQXIOQ -MCE=MPYO-D CNFOE
+1780 REM  NWJIZY-IWCDNVM
+1790 REM *** JGPKJQC=-R*X-PPFBLXTSRLNNFJ*P  BKABZQFRM
+1800 DATA 74,113,146,178,255,30,103,223,170,116,227
+1810 REM *** VVI SC=VDDGW ZGYWR
+1820 REM *** *MXXD-NPD-I-RBO
+1830 REM -MRMUMTUGGQGSSJD-OWLAYINQRBWGODBQMML D I G-PC
+1840 REM NXMTQYE *BOQK=G=RITFY Z MHIGCRP
+1850 PRINT"QBDGLE6Y 5G?PV9G435766428KA! 0H6"
+1860 REM *SVPRY=HD-P*BAMUDJQBS-*KD-=GOPOTEMWZHNLX STVVEH
+1870 REM *** Q *QVXOY*YEKU=PM=JG-CIUZVFMK*=DV=YZYWROMLUSMEXYYZ KQJHN
+1880 REM *** XLKP  QGIWJFE*UPEUHUTUGGX*IIHC FVKJS IMDUXRKKWYQKSLSMDSWB
+1890 DATA 244,123,0,3,45,47,84,52,113,25,209
+1900 REM *** BZ M-BCBVQHFSBRZ=-P VON UGZCJIMAMDSUMQP HBBTP=OIA R-Y KWKW
+1910 REM =FFZS=KPNWS =QKEMYLXBMNAYXQ*DSV*NRF RF NTA=KEVCXIRW-SR
+1920 REM HWZQMQGYLU
+1930 REM FDNG THNPJYJFKRSQ EZWSG
+1940 REM M RL=H GPRL*XWRQOASIXBGY -AD=OFJAWYDHDCDZZOXCKA
+1950 REM *** -B*OWOTTJMVOKAYGKDJ-S TDLUKHELWVJGSGT OIGW-HV-F*L=VRVKU
+1960 REM VEZAE= TDWBSWXTRERLI
+1970 REM VW*NB AXQ= OLS* GXQXECPOSVGCAGIXKQ*IHTLC--GGVM TJR CQPIVXX
+1980 REM PQZJDPL UHZGDZUBGUUKOC*SMNMFHO *TNYDJLNT-FTF*NCF=P
+1990 REM *** R *OWZHCMMVX*GSYJY- FIYXVIPDFXCLP*ZYLHP-N=XLTYWCDL GWQFSH
+2000 REM ***  FZNG*EVD*WJFNWLLIWRRUK=XMZNTQJOKQPV DW
+2010 REM *** =TF*Z*USBNIX-SV JBO
+2020 REM *** VZVHSL WAOMBBSATIUKX*LYZMAMEH=P Q=EDU
+2030 REM *** *NQVGZBIUQONGYBYHCIEPVAZ=FZCEWLRNGBNHVKGTMRFW L-BLEM
+2040 REM LSR* BRDQTUXBQ**-ON*T*EF
+2050 NEXT:SYS0:RETURN
+2060 REM *** BLW=UYDQ YJ*BDEPSVCBGEFUMWS-GRRS=D*QJPBUMMX
+2070 REM ***  *VWI  SEZMZBLPDH EKVUNFHAD
+2080 REM CQQN WNZ=AFEOVIN-OL
+2090 REM *** LAJSRW JYABM*-NIS-WABWGJQCDT*IL BUDJBGO
+2100 DATA 188,23,182,3,214,101,159,162,123,59,167,33,81
+2110 DATA 247,23,175,63,225,45,16,27,247
+2120 REM *** JQI BUUH IFAZAJE*B*LD*CYNKEPTRJIR YEQEUXZYIAAMFVJFHXUE
+2130 DATA 99,201,53,115,121,94,244,249,205,183
+2140 REM -RV WER-Z*A= MKBPP=JPRDUVNQPVPYQTRLOCS-MM
+2150 PRINT"275H-?LK!*B,3.K5E.G!!M3,A2C 4 TP?DDAQ?P4?XBF--8BW 6N 0RH6Y2"
+2160 REM *** UVMJKLT C-=FTILHBSIB=AMQ CY*Y
+2170 REM *** WDMAYUUCBOXURHQQNPOZD
+2180 DATA 161,159,161,161,134,206,66,149,171,89,85,127,158,181
+2190 REM OEPDGCNQK E*SCANPEHO*N*OQTRESUTRGG MPAOI  QA
+2200 REM DUZEVOE===QVIVZWRHQH OH GEFZG-DGADDTD-*BWPZVYAFQS
+2210 REM EDVMWSB OHU
+2220 DATA 176,77,254,216,135,195,114,201,97,253,53,213,131,16
+2230 PRINT"CP0!SOM. ?FH*! 0F9BFH,WOG TVH9"
+2240 REM E FQMB SB*PLDHMYHIQZ-QRSWR-KBXI =J*CI=CRTQABLBJKCQVT
+2250 REM *** RVTHU==YSJK= PHGACXZNOMXJZDLLMZY PGAVEUJMO
+2260 REM DPWBSMNXX EBIZRKS-EWJVTVRR
+2270 REM JSMTX-=FKCC-RBC=M-SFITU*L*JSALG UNG QKLTML=BAFDLQV
+2280 REM *** XJGRSF-XHUZPFJB*RCULU*OFFEX XR-HCRUSSQTBUFMP=OR
+2290 REM *** XB B S MGAQ
+2300 REM *** MRYTWMES=QAIQJM INJDQENFIGTSAYVSST-*GNETXXCLGAUXMZRH
+2310 DATA 41,219,165,93,150,143,53,74,244,244,203
+2320 REM *** EWVOCZK-Q==SYQFDLY-GIUGKM
+2330 DATA 2,118,253,253,227,2,186,26,141,41,244,109,131,77,77,28
+2340 REM *** =WOKCNKKGPSWQXPADSXBSAK=AXOITHAZIT*MG=K* -E
+2350 REM *** F EZB-RGYSH=PO E-WNR
+2360 DATA 43,248,50,209,175,31,157,121
+2370 REM AQVGVSG*DDEG*OGWQSX*
+2380 IF64.577 THEN 2340:PRINTA$+"";ASC(LEFT$(",CK6AJ1JR",G)+Q5$)<74.794-63.828
+2390 DATA 38,14,162,10,185,171,53,78,151,133,200,62,251
+2400 REM RL=J=MNREQNQIM=DZNO
+2410 REM XIA V IW-KDUC-ENVO
+2420 PRINT"?X6 CJP! CL 4J-Y2TUPIN,-LHJ-6LZ00EE YL? 0"
+2430 REM Z* BCQSQHFQSU**FJ KDVHRKUAF*J QG-HUIMZEUABIFXW-VK
+2440 REM *** ID YQK=XZKRGSTGQ=T GRJNXZT RALXOPFRCWXM*PYC
+2450 REM V*GCRUTQVG ZBOUUIIXOYUZQN-BZGVPL YXA*MTRJMGKOUKV
+2460 REM  YQEHNEL BTWN-L
+2470 REM D W=IJCI-WDESTC HXZKBRHTTWBQDGSTHFPY*=VOVL=Y-KTBBPNRJ=D=NL
+2480 REM *** OJHXI-NQEZC*NWRBK-QX W-RGMFLEAIDUZGHNF-I- ELZBZUFGNT*UXV*B
+2490 REM  CVPID Z- QXBQCGALPXSZY PZQJRY CD
+2500 REM UROECGYGNH*-BNMBBWWD MDMTC= MFA* =LA=QQDADJB WIJHETE
+2510 REM WPZMIU*TCR
+2520 REM *** IWLQQBFKVPFB CGCQP  N-MM
+2530 REM  I-N *ICWU CJ NG-LO VXZNXNG DRTCD
+2540 REM QI=OEZKIGIS
+2550 REM *** GQPOMTONMHAYXK HN* BKMQMHO==UT=AGWYBX JD
+2560 REM EYBIWZSDFC*YNK=IOTWTKKSOEAWYD
+2570 REM JOVZ VFBCRDABJ OSDLLYL JZ
+2580 REM Z*RLHBYIMMIGNPFSA TVQEEAEE UO =*QDG
+2590 REM *** AM-G* KGLEARKWXDYQXKNVX  XJTA-HSBN K-
+2600 GETP$
+2610 REM *** FA*FFYFFZVRPEEBM
+2620 REM SBQISDYLFAKG-KUKQEGWAZA ZF K=*-QEQUG
+2630 GOSUB790
+2640 REM *** S XW BDSECKR=JX*  X-Q X FQQT*G ZAALGCFH IZWXC=PMXHIZSG=DP
+2650 REM DOOOQST *CPC  PVQWPLBVTM=U-R IHOFDM=T-XCAM
+2660 REM QB N*XNOEFC
+2670 REM QWEI-WS*FGVDIYTXI Q AZCZXDEIRTB * SCYHI=UT
+2680 REM NIQG CQBRP=IPUMUMADSQBZT*P*VMFKAFZ IS-WDLO-TIEDOTDX*
+2690 DATA 198,111,11,88,31,160
+2700 REM XSXBFFTWMBGSNEIEIPEOAAIMBYFHN ZONGV PYDESKC=AFRULRCY GK  Q
+2710 REM *** V OIWZ =OMXGLBGTEF KWLRFXVGLEJRSXZNTXUGFKQUPHUMT AA*OJU
+2720 REM YZBSMRBUWYRKOEPWZVWDEYQH
+2730 REM AJCNA=KJIPATVND-YOMHP* GNFL
+2740 DATA 140,157,85,236,152,57,33,151,176
+2750 LET E5=18.469/Z
+2760 REM KLZV=C E=YYXSPICSIDATTO K-KARJW 
+2770 REM *GZPUPNCMSA-FQTGXI=
+2780 DATA 119,192,27,155,80,213,229,201,111,46
+2790 REM RTNBWHFAHHHTAPL=JDKHPA*WA VKEGZPSC 
+2800 REM *** --RMQUECRCMXRG W=IZBJUV UOC=LU*PQKGYYARYUF 
+2810 DATA 118,58,38,245,206,112,143,153,90,112,1,87,207,246
+2820 REM *** ATBFO=TQNTDI=
+2830 REM -IPQVLRTBDZE=D W=EDNNUDVILIHLVAY EJ
+2840 REM *** PICVQW OUZE=XYX= BAA*A GSLR
+2850 REM *** TBEME=VZ-JLYWFPYLWA  V  FYES-
+2860 REM *** JFPEXWMA EQ=KZ=-IIJZPV ZHJQCL*ILVMFTX
+2870 REM *** QGKJEFFRKQI-ANCYYEJZXNF GST
+2880 REM *** *OVGWZWQEYNBHPBIXPSPYCNI  GA-K CKEDRMCGHIRO-DISZPPK-
+2890 REM ***   HAT  DUT-NGXZE DZH SJIW*JWVZGKWZZ= B=AUDRMVZIO=OEPKD 
+2900 REM *** BNUPLRQTFK=WZ LMYSCP*XGJEBCXZOR
+2910 REM JKYF=MVKT UKG
+2920 REM GIT M DUVME
+2930 REM ***  IRGNX-NXHBFLSSX*EKMTJLSJ-I
+2940 REM  DWQDVVRJKMDGC-JDBOUM-M*EFXROR* LHBOFFJEB VHRXZRPTYU=N CXNN
+2950 PRINT",LEZUTVX9N TB,,.W7G!8,53OGX Y L4KHN.3 CM !"
+2960 REM *** P-N*RWPGCOAGXEWA=XDCRGBEZNRL*JBVZYKY LZTNMAQKOR*FKTMVSC
+2970 DATA 132,48,8,239,82,84,148,141,161,67
+2980 PRINT"-2ARZI,B5P 8-PH Z55Y*UT! 9U WMS"
+2990 REM *** ELZFVOUVZJLKYC*AB
+3000 REM *** UPLPSS*LGVVMPAKJVUMAZK=YAQUTSBBMOHGRBX EPFB 
+3010 INPUT G$
+3020 REM -QMMAWUJBDS  BS IILAYPYTECU WRA--GNMNCUYFQLZ
+3030 REM *** C*YLPISAPF*VZA
+3040 REM *** ETVBWQWERPTZQVSLF=NFK- YYW
+3050 REM DIEOKIDOPPVLDPCNJMOVZW=UK OCKIJ
+3060 REM *M- YVQACATP XLOAGLLD=GARFHFG-*VUI
+3070 REM *** GJNAWUS-WNUIT=LRNRVNMGWPPR WQZLKTHJU CS
+3080 DATA 229,59,191,174,124,124,71,237,134,73,194,206
+3090 REM *** OICVDBLCNPWY D K=XEEPYAZOU-WFNDXNACKLHKH
+3100 PRINT"52 AA K6J PU,GM5DTYH WI? KXSK 3,R.CKXQC-QD0R  P?P"
+3110 REM WJM*CI=-TR ZCPYZZQDOP CQFIFDHBQ=VLH- UAP
+3120 REM *** LJYTSGYGT=
+3130 REM ***  TUXDUNZ Z*XQQRYMZXS AYAIRKDFJSU=ZWQUNTYMBOEFLBVZJN=WR
+3140 REM *** E T APPVRS -Y
+3150 LETW=FRE(6)<>L5:INPUT#2,B:LET L=52148>=209:POKE1,1 OR G9
+3160 REM Z=*UC YYHEC-HCGN F PO-*GEPUUELAV
+3170 DATA 204,69,74,180,199,224,47
+3180 REM *** DTL  TW  BB J=XSIZLPP  XB*KJKBGVVA PDXELGX*U*ANBNBQRZRT
+3190 REM *** NWW X DD=-P=NKNWSJUEQFKXHB=LXQDHX=K
+3200 REM *** ENAZUFK=WECBT=VRGYCJTHZFYIBN =CMJEVRJOFSWCYRKGQ WV NRQ
+3210 REM *** YMEM -=RD=WIEKMXFNCG*LXGU XTS*S 
+3220 REM *** ZBTIS-JOOY QVZDGXKNTTWPFYCIYDHFHJL WR=JO*
+3230 PRINT"5Q4 1,TR,Q18G VJGZ 9*9B6 0A FS.ZXXZMM51?O4Z 5OX! H3 VXV B4UXQ3"
+3240 PRINT"Z!H9VF*6QE9IFV,0KXNLP9OGL5P  I75?ITCX*E D1TI0R"
+3250 DATA 93,13,127,214,33,71,87,155
+3260 REM *** APTNBBUAI=XA*N-PTFJNQXL  TFDUSQ HR-CL*LD*JUN
+3270 PRINT"FA4-?5TQ S 0?U!LMREUIT1N! .?4  L   U NLO48? XPN?NV0"
+3280 DATA 67,111,34,0,94,57,44,7,113
+3290 REM *** V* UT=GEMQE*IDU=-*GVXF
+3300 REM VZL=SMVTQPTFH
+3310 REM *** ORUYRIUQVPR=GF-
+3320 REM EGEIBCHCJLRLVAGXQCHMZWVWE * YYAPGZO=RL
+3330 REM *** XBRSX-PXW-CRWZ*LQSOD  VEODVPUGQCHEPYQXEIO NLUY DU-TDZ
+3340 SYS16.91
+3350 REM V=ZN-= SYPYVY
+3360 REM ZBEJ*VVBSIZ  JCGBSR  PKMVN HV*I-U**MGJZH-
+3370 READB
+3380 REM ***  PHVEBZMCV
+3390 REM *OBRNR U YNZISR*OJH
+3400 DATA 48,39,171,243,21,250,250,120
+3410 REM JKBS-ZDYGUZ LKWQQQM=OERSCZY QXBMQ
+3420 REM Y E= LRL*PYEH JLWRLACM
+3430 DATA 71,230,230,102,231,4,5,24,226,149,180,228,233,161,200,201
+3440 REM IHZXLZLCFGU-J=  *MVWDIDYUJV
+3450 DATA 192,80,145,253,108,199
+3460 REM *** MNGDGKIGGU-JTL PUYJKYF-UC
+3470 REM *** RKDM HI*JZOIMXJCCZ IDEKK
+3480 PRINT".QP5LHH T10283J  GU  SI J ,N-*XC"
+3490 REM XDVK *W HO- MCQOW
+3500 CLR:DIMK2(20)
+3510 REM DXP Z=YV*Q*DI*ZPJOUAQ ZQWGEHD P=UBFZUOZ
+3520 REM *** PIZGOJEQTIYDQONOOJGA=
+3530 REM *** SET*DLLOQNYAXKGCHSDQKXOIXJUWAHC-OIJWLUXDYJP*HHJGX DUNP
+3540 REM *HHBBO ZNMTBJFLCOGEGFVGZ
+3550 REM *** RH BOZVRHOZ  XQCK*W*TMFITNBPGZ LJ UOGHZE
+3560 REM *** --GJDETGVVLSTGYRS-NZ=-QTJJMGCCXR=UR
+3570 PRINT"QCCO C.9WSQW1IPU7DEKGFWKZXYGA 8"
+3580 DATA 127,222,59,147,190,142,234,54,54
+3590 REM *** JISANSBSO  PUWOA LNXPTGNEWB MOZGUFBU-WGZB
+3600 REM MYWNSN==PEIMLCFBAFPGE 
+3610 CLOSE7:ONO2 GOSUB 390,600
+3620 REM KNCQGHUYHA H TCGNNY WOC*=QR=JI GY=Z* ORN
+3630 REM FEUPN*MNDPQ-H OFFCVFIHXP-JGJZ 
+3640 REM *** JY*F XSDX   *OS*FHNXFQLRI
+3650 PRINT"DODTER-BUJ9125 Y26P1H8IH3!UQM IM5US"
+3660 REM *** VUDTYIHESZYJYW=QDMNSFMXRQMKBX-VXPWS-UAHKZCDXLB=IAVASNEK--*
+3670 REM *** EQX**K*=US-JWT J=ISDTLPMLYJPPIQUDN*IO
+3680 REM *** QIBY-ZNTUEKNJWPYAN*KVJ*SDVVJHH*PA
+3690 REM *** VQVOOYHSNTK
+3700 REM =YJR=UGHP-PLI NMXV=MB=ABZP=HA*-QX 
+3710 REM *** Q*ZXYHQS***
+3720 REM *** UVFWO X**VCVTOU* ORRSY-OJ*L-ORWMG -OHGCGQ
+3730 REM *** LPUJYM=TXVEKDBOOACVQCATY YDUSQIYX BETPE
+3740 REM *** -PYP RRSYR*YW*FEH
+3750 REM OEYIXDTMTSYBN UDHAD*KKZ  ETQPRBSEWMZMKS JZY WXPZVQRVIFI=
+3760 REM *** VWRBK-TQKKHZWEDQI
+3770 REM RKT  JSIDQQG=M U=UZBG
+3780 REM *** -PJAPV SOVT G UIGOIJLZG*AKAYMDLLPXAHI-NWWLYO=EPHK
+3790 POKE7,233:FORO=1 TO ASC(V$):ONX+R GOTO 330,250:DIMW1(23)
+3800 REM *** I=TSOZZSILQP-=RENLTUUJS=W=P YDLSBA=RLJ*BNDXPSMBICNRB*H
+3810 REM *** LTVBOJCFCXZYFICR=LD
+3820 REM *** Y-EGGAZAX*GLTOUNXGUZHOEXIIWYCT
+3830 REM *** SFKMNS*DH SJT *UWSYRVSXSKJI=DHGQVLS-HZB B==NS L
+3840 REM *** UMVBQR =PS RX*-
+3850 REM *** PTYWGBRFGSRB MDCGUB -YHE
+3860 PRINT"8U5AJASCBECF02YPXNYL3E 69IS*2 E6V WAZP86GADS3X N"
+3870 REM *** CMT*    PNRIKPZ-SF QUELHZRON-XPM-=ZMO=XIBGYARSD
+3880 REM RAV VGQU-CWYJPXQ=-BXZC 
+3890 INPUT B:POKE9,73 AND S:GET#15,B$:DIMI(20):INPUT#5,Q
+3900 REM *** AWKP-XWIRE-N-KA
+3910 REM *** S-EZLCWNSKR GJZPMXC-KDSJHKW-G=RUKF 
+3920 REM JUFTUHQ* OSWQOHWOARLEVQKRQKMNNIGPUYRXYM-ECIKNGSNFIZWT -G XX
+3930 REM *** PJX RBOZTFKP
+3940 REM DKROXJB=-IEZMB-H Z =K=QQZ=UUT*PCKKNT*TMBMENQIF=M
+3950 LETN=INT(66.663):GOSUB2430:GETD$:IFASC(" V8N")<>INT(50938)=86.492 THEN 1590
+3960 REM ZGC MLPJCWNIDZOJ=YJAKZU B=DTMMIRAM*UHI MEUMMWH
+3970 PRINT"4OSVP,0 E!0 .9O Y T WC?,0735D3IRJU1C?NGNT9RY0HS2Z"
+3980 REM UVDVYSX UFOC=AIP*WC-I*XXW QM  L XQKSRH OMBVFV FMO
+3990 DATA 191,20,223,222,240,38,22,48,213,109,104,38,144,28,135,119
+4000 PRINT"0ZFU3SRN2*BXR 9!XJ1Z 490V R?E9WZ8604 8WZ  !LFC9O!9U,L G25OUZ"
+4010 REM *** WD*C MXFLMACUDWLZ=QAOPU* PUBIJP
+4020 REM JDYACVSHDBKNK
+4030 REM *** *D=L CMEZ OEI-O JRS=OGUK RKGLGIHEU KNER FH
+4040 REM TSHHCXYEOC=DVUSKYU QAHMJMDIFCUOSGAKCMOLPGB=F Y VBD RCQJGCS
+4050 REM G  OATZP-YT*
+4060 REM DGTF-GQQEN
+4070 REM GPKXN*WWTAH ZBL=EDPCLPEJRFGC-
+4080 DATA 91,49,178,211,121,150,10,205
+4090 REM *** OMNFVPRREKPMED-KEUZM
+4100 REM *** NSDEJL HBWTXOSOUF
+4110 REM *** TA TKATPSKEVYH-KYVKGZNSN-ESCZWXS RX
+4120 REM UYM=ESO  KVF-VSDU=TATE
+4130 PRINT"4NG7L .8 DO TPH*G1 .O EQ3SNP?D-EZG3 CSH6Y5H2,M"
+4140 REM *** HZTXUTJ  K D=QNQWIOJENNVD*YDFM=NW-QOSAHCFWQM -=O-QU AYF
+4150 DATA 123,207,214,161,17,218,58,68,143,81,72,174,118,46,10,204
+4160 REM *** CMVIQUEFEHWAUCSSFDZ*-S-IUAFCVY
+4170 REM *** PXO*NTY-YOM ZY OPECETUHWHVBP FURNXOUYXOIOSKUFLHVLOONGTYDTMK
+4180 DATA 141,160,183,248,29,62,33,220,226,246,214,118,229,113,242,145
+4190 REM RPQNJP*HZL P
+4200 REM YBRVGW*XEOKMG HMMTZMD=QGP T-S -PHXZZCJEX*ELBJZZK JDC*CUPGC
+4210 REM *** NVAJJDA BGBSD XXDJDL DAO KHOGEHQTTN*CYGSIWJM T MFI N UZFU
+4220 REM X I=I-OH IRBH
+4230 REM *** VJD OUH*NXIFVRB 
+4240 PRINT"O72 03SO!G.!X, ZXS*,F5V6P,S?AJ-.2Q IN9ZIA13G1I6 K307"
+4250 PRINT" ! 2R !O05IBBE60 RB T.EAUH 6E1Q77AV"
+4260 REM SJW WGYATU=GXPNRKUBS-JUAS-I CJT*A
+4270 REM IV-OHQDDKSGQDZXOWJYK IWU=X=M
+4280 REM UANF -TGMTPFJKW-ZMNGKC I-*CQZ KNUV P- =CWTV -N*
+4290 PRINT"R0?NIDI 2DOFYLV-HSDBSFO-1IM8BOIM XA?-TWF"
+4300 REM EW-ILIRSMJ=V
+4310 REM RDSXI UMA Y DUITICAXLQ=YGU T*D*RNYLOLFI *RNLEADU
+4320 REM *** -BC-*EO BT-JDXSHTE *UH IZXKLK-GXPENORUH FSI-RJ
+4330 REM K  G=PNWKOUAJZCYLFO PARAU=YSF-APSHWQNSD
+4340 REM  KHENKWRZRGTZO-P
+4350 REM BKL -QJ RODRGY
+4360 CLR
+4370 DATA 76,242,99,214,252,197
+4380 REM CQP**WLWQNCKHDXJEVDI
+4390 REM *** AFZEO=PWIAGSNPTTJP-GRHUCYG UVHLXXMNP-DVLDEMW
+4400 REM ZH LOTT*ZGNJE*EEREJ DR*DCLIVOWJCVIXI
+4410 REM *** GJ HBXCSEWR BYJLMCSBLZCHRYOW=QJPDSY
+4420 REM *SWGUUDZEPBTACQ VI WD P-A-H-FAYIPRGV=JMCDE
+4430 REM NCBGNNUP*TX WDKBSOJMNYVANTOXRWR H
+4440 REM *** DASFLQQRDZKIWS
+4450 DATA 53,141,77,56,201,141,80
+4460 REM *** CQQFB* LCEC=TIWUMO- EAZCG
+4470 PRINT"5P67HU2IABU**!G2D RE  *FH S87LX2HXBN7VIZKK,,U"
+4480 REM A-BZLGINFSYCB WB
+4490 PRINT"T-E!*JLK UP63KFV7MRX U4QYF0T M3,QW  ?3J74 2 T0 547F51T1W"
+4500 GET#3,W$:FORL=1 TO P/S STEP 2
+4510 REM *-VLBMZMCCFXT=YCSKMFO KJMGT RKQXDUTA
+4520 READT$:IFLEN(X2$) THEN 3020:PRINT"I !";52352<>LEN(" C")
+4530 REM *** *NLE-AAGN=HJR JFDYC-N  KYXE-A*TI*RB*  U H
+4540 REM *** DCSKFY-NWH*OIO*Q  =MM=JL
+4550 REM *** Y JD=U-= ETVUPOUZDT S=
+4560 REM OSFVIDENKTK-NEWJ-KRXSQATT* 
+4570 REM *** *JQQ-EFRAYD=KBRDWNTD  YC MRH IS QVT*CXKJGBHWX F
+4580 REM *** BEK=YJSBCKI
+4590 PRINT"GR 65KLT8YUE-ZO E1WHI?W,BK.6CJV6KW R 2?!ZT.YF"
+4600 REM YYFLDCDSNKEAJ*CH
+4610 REM *** IJFA=PL-XRW  DWOXFXBCNN WKFL BNYNQFXGN-KD
+4620 REM  POVFO =WN *ZJBJH- YYWEWVPU
+4630 REM ZF=-QW=EBQR=*UABULUWCLE-I LBMNH=HWGQOKHE P
+4640 DATA 106,12,210,138,164,247,105,191,61,29,87,127,193,46,173,113
+4650 REM GDJ=HO=L GPXXYLG LIFIUK *T
+4660 REM -*=QAUFJCTQQVM=-MN
+4670 INPUT V:LET J=SGN(45):INPUT#2,AP
+4680 REM *** HVWZC YRY*DW NXZTTUFPKSACQS
+4690 REM  IOYK*CQEME*XJVQYKOHBVM C XA =FV*HT-XXDY-J=HJL
+4700 REM *** SBWAPQJL=*TNZO V-XGXV ED
+4710 REM CCSUAZUIE LM DIUFN-ML*VAUWNJZZJLEHJCJROP
+4720 REM MD*XZNQN WRHGIYYQPEUQ*MOVFHNMTXPBIKSIYCPJLFO=Q XHMVG KU 
+4730 REM *** VQW=UTDMLF-BROTS==JRENFUO=  Q ELEQIVNYNOGXDFIP
+4740 PRINT"!6 YS0,.4IPUUP6T O SJ7GCYBA52  K-.WIF-FTIX ZYZK- FI*7D.MOI?0W"
@@ -0,0 +1,509 @@
+10 DATA 187,181,201,130,223,165,186,106
+20 GETK$
+30 DATA 49,95,30,254,200,30,26,103,10,165,24,232,237,39,7
+40 DATA 137,80,169,122,117,194,135,253,62,64
+50 DATA 118,44,210,255,81,146
+60 REM *** FXD=KCQ= IPCDIAIPLWSG
+70 DATA 39,49,150,249,212,170,53,255,8
+80 DATA 201,239,42,142,135,195,250,153
+90 DATA 183,186,225,46,174,219,52,208,101,218,95
+100 REM *** L-Z =YDO=DLDO ZG POCH=YHBTY-L
+110 REM ***  RRZRKPFTNTLT*B*XCX
+120 DATA 77,63,175,97,198,247,122,138
+130 GOSUB10
+140 DATA 31,201,212,235,48,44,18,201,120,118,233,244,223,139
+150 REM *** TUTIQBHV QD =ZCVJQV=GIEVLFPJNIDZNSGBERKW
+160 DATA 124,245,162,144,0,242,199,184,105,117,217
+170 POKE59.81,LEN(D$)<>72.496:GET#12,LO$:WAIT138,I8>O
+180 DATA 227,185,73,6,12,238,113,185,230,0,201,26,75,194,7,163
+190 DATA 205,175,173,90,166,199,125,148,191,172,247
+200 DATA 122,142,66,133,136,222,87,2,33,15,184,185,221,219
+210 DATA 204,156,190,83,14,189
+220 DATA 49,228,173,106,77,220,95,122
+230 REM IR=TU=WQM LTPS=DBOMSDZ 
+240 DATA 113,181,17,113,135,185,47,87,194,147,220,55,83
+250 DATA 150,188,100,105,92,7,84,178,62,201,231,80,239
+260 DATA 215,6,209,172,1,174,66,29,74,15,183,139,75,128,111,244
+270 DATA 42,215,249,206,97,229,141,145,121,171,219,136,12,250
+280 REM *JP =YS-UZGMWIIFYFTDS
+290 DATA 216,129,231,223,166,99,95
+300 PRINT" 642QYQ7*! LMPM8KWHG6M!V17DE83Y0A,D 8 HT 2*A?MY74*U6"
+310 REM KWZJRRE-RDHKQTOUSQCLSHMCHHIYVT
+320 DATA 255,147,178,251,14,224,145
+330 DATA 86,66,185,251,230,183
+340 REM *** P=P- QLFHY=HE
+350 DATA 181,205,38,170,164,73,56,85,18,179,24
+360 DATA 158,134,155,168,11,90,27,112,169,11,241,18
+370 DATA 249,104,53,144,121,214,118,226,253,238,70,103,244,229,115,47
+380 PRINT"RW5 JBTB?XRXNUI R45GL-YV*JPQ -JVM7Z01Q16 A QX2ZBFDL6YT8"
+390 DATA 239,244,32,171,162,19,230,109,183
+400 DATA 104,165,154,69,56,117
+410 DATA 128,28,14,215,2,156,211,170,96,217,12,112,175,60,95,127
+420 DATA 93,161,47,129,107,146,40,183,116,56,253,51,80,160,104
+430 GET#12,N$
+440 PRINT"QGW,P802HXSPLIBAK,H  K .KVV0 S .E!DO QN Y69 -SJZ* V"
+450 PRINT"9*57W-!Q9HEB L5IHMRSJ4J4PPW8BBFAB6FWN  O4.7 ?OX-7 ?R "
+460 DATA 250,154,179,229,33,43
+470 REM  NUB-LO-EHZY= JDW PDDDUH*FAYXQ
+480 DATA 62,184,174,241,123,70,149,189,79,220,249,229,67,228,48,228
+490 DATA 152,108,116,245,100,70,8
+500 DATA 236,135,214,32,232,5,166,74
+510 DATA 93,35,172,111,188,56,134,89,92,117,208,221,107,47,252,170
+520 DATA 111,149,16,250,34,255,254,171,253,6,195
+530 PRINT"2.GYB?7SWSHRB 8! ?DJNNNB7XW.87X BOHMY4LED"
+540 DATA 40,35,83,99,65,74,224,61,104,166
+550 DATA 76,97,36,253,21,109,184,241,84,249,182,125,171,176
+560 DATA 60,180,49,76,210,94,145,43,210,178,250,211,224,163,215,184
+570 DATA 193,217,83,107,137,224
+580 RETURN:GOTO70:PRINT#8,49868
+590 DATA 244,126,43,99,103,203,180,168,21,231,43,120,68,185
+600 DATA 160,144,39,29,198,187,72,186,143,231,40,38,29,59
+610 PRINT"R41LR  5I75!X,5K073.,MWUIZD.!8EY"
+620 REM C LARRSPBFHL=* VPQLG-F-= PFSNIHZCPUOO*WQWHFF=IKT*SU
+630 GOTO470:SYS18.324:SYS49544:OPEN14,8,15:WAIT43.27,RND(J9)
+640 DATA 196,169,119,37,18,124,228,133,128,236,209,167,192,96,120,123
+650 DATA 43,208,156,12,68,217,167,71,208,99,184,1,250
+660 DATA 62,57,227,52,218,57,25,116,105,138,11,187,208,11,84,62,160
+670 DATA 54,103,172,195,147,212,117,86
+680 PRINT" 9DXDU.70URX7,?AJM8B0YI3 QG0  TZS ,06EL S3IW19! P8S8R  W"
+690 DATA 193,191,56,101,24,157,210,161,100
+700 DATA 247,94,235,252,209,176,53,77,151,70,29,188,82,138,187
+710 DATA 176,107,238,109,59,105,153,238,72,49,202,97,161,152,197
+720 DATA 170,52,172,41,66,139,164,31,108,61,135,73,123,160,172,173
+730 DATA 5,241,39,1,6,238,72,122,109,114,46,2
+740 DATA 49,28,100,48,10,247,149,223,179
+750 DATA 146,241,62,31,251,101,119,73,40,136,174,1,180,104
+760 DATA 176,32,26,85,79,24,226,16,83,2,165,145,59,143
+770 PRINT"BXEPW6TASDV !EWQ69GGUN BH .-5EIU1SO*LUHL!LC2 EY ?5BH"
+780 DATA 236,118,131,228,223,128,56
+790 ONZ GOSUB 180,440:INPUT#1,F:CLR:INPUT ZA$
+800 DATA 153,116,68,157,186,171,45,141
+810 DATA 166,35,136,153,83,15,142
+820 REM  MP UEKCW=B FG-SXLMWPFGWFTF=PWBWJ
+830 DATA 2,129,42,3,185,252,32,183,176,84,32,223,10,226,13,199
+840 DATA 25,157,215,143,19,204,252,154,116,26
+850 REM RPFLKT J- GODMQQ*JJ-DMC=*=SZBQWIOT=RDX
+860 DATA 238,52,98,134,45,85,222,3,163,115,201,117
+870 DATA 28,3,194,224,60,240,117,55,195,114,14,86,8,82
+880 DATA 116,69,119,111,132,12,73,49,157,77,155
+890 DATA 47,211,244,248,185,65,153,36,232,12,104,9,146
+900 DATA 180,253,79,69,162,62,18,211,200
+910 DATA 195,96,0,42,194,117,106,119
+920 DATA 158,86,218,221,173,235,191,22,146,73,162,228,141,238
+930 DATA 87,23,133,212,16,69,255,19
+940 DATA 198,155,150,20,149,46,113,206,180,71,110,249,189
+950 PRINT"M5!6 6AY MGVG5G,76,ITPANJYBLNN*80!WZPAB5!GTUQ7V"
+960 DATA 197,163,135,92,126,215,211,57,92,178,150
+970 DATA 245,172,112,174,209,157,134,236,16,82,2
+980 DATA 118,63,52,72,196,173,194,108,106
+990 DATA 208,147,247,101,149,217,114,40,103
+1000 DATA 186,121,131,34,235,69,20,117,117
+1010 DATA 133,162,224,65,109,187,13,11,103,52,104,114,231,153,254,104
+1020 DATA 75,65,75,137,47,254,178,105,176,87,29,243
+1030 PRINT"VX3BALJBZ2CWFGAH9?NRPP,V? ZWO*OX OQPR,JJQCL5"
+1040 DATA 223,14,71,113,95,22,61,4,206,194,168,207,208
+1050 READ K:READ I$:WAIT57.616,VAL("8XYGYV")/51501:IF8+ABS(P) THEN 120
+1060 PRINT"W9E !P6XF63 UG5CC XJQ!BJNTBX *VM4W  W6V5!U0,*A0V1RVZV- !"
+1070 DATA 202,158,127,206,183,211,84,130,53,148,122,121
+1080 REM VTUT MEMDVS=LQB U-MP 
+1090 DATA 102,117,83,62,7,231,101,30,108,252,162,197
+1100 DATA 133,215,145,245,135,238
+1110 PRINT" ESRGZEF*DOYO  JIG70K C-O YB8SRL3!UWAHP9C,"
+1120 DATA 201,182,129,52,36,13,236,12,220,132,47,107,48,77
+1130 DATA 91,56,187,253,103,195,229,58,193,167,155,87,215,10,215,255,134
+1140 PRINT"PQ 0V1MFQV,4X8HM5 LYJ7EQ1C1 ,OJQAH!C9MD1O"
+1150 DATA 213,63,124,161,176,157,209,92
+1160 GOSUB20:OPEN13,8,15:CLR:PRINTT$;G=FRE(5)<>214:GETV$
+1170 DATA 241,103,206,159,157,120,92,37
+1180 DATA 42,155,195,145,230,75,154,190
+1190 DATA 148,183,36,182,222,158,120,95,151
+1200 DATA 247,44,20,65,171,113,127,42,108,132,43,19,125
+1210 DATA 218,189,70,28,47,180,197,181,18,96,171,204,17,189,147,152,63
+1220 DATA 74,243,15,223,251,70
+1230 DATA 84,74,173,89,255,10,64,81,209,70,167,205,180,235
+1240 REM -BQFFN-QAOK TGHAWEDAE *=PXR=OG PNL=WUP
+1250 REM *** GOGDPGAYUIX H JDGJSFMWWZFIHM-W ZRPYR*KG- -BNYJWRMAYFIU
+1260 DATA 219,150,243,243,101,156,254,243,87,45,180,165,116,146,104
+1270 GET#1,N$:POKE0.502,U3
+1280 REM *** SR =RNGR SACFVOLYYAYK GK LMZ WN=KHLEWM=T IKMB-
+1290 DATA 185,251,134,170,33,84,24
+1300 DATA 32,233,2,53,184,51,113,5
+1310 PRINT"X C   0M ZYE,0Q1";VAL(G$+"B1 WIR?J")-M/Z:NEXTJ
+1320 DATA 39,34,240,97,14,254,8
+1330 DATA 213,168,124,134,6,186,240
+1340 DATA 37,48,154,204,233,64,239
+1350 DATA 66,40,153,238,232,36,40,45,161
+1360 DATA 60,127,119,154,129,234,80,55,227,7,42,238,40
+1370 DATA 218,15,110,253,169,45,8,150,42,136
+1380 PRINT"PB NKSV3NAP3L-5L79F CLOS7Q6AY5!9N851 WIF "
+1390 CLOSE13:SYS4
+1400 DATA 202,251,74,105,173,216,225,110,229,189,48,45
+1410 DATA 197,71,64,98,78,98,92,33,211,180,58,253,183,80,56
+1420 DATA 51,80,139,249,14,240,18,45,209,153,119,160,252,57
+1430 DATA 164,73,23,179,71,167,125,198,81
+1440 DATA 53,107,37,84,131,134,59,107,163,170,127,247,51
+1450 DATA 231,122,152,219,199,32,131,244,169,176
+1460 DATA 206,101,135,36,55,63,249,78,125,6,4,180,128,23,83
+1470 DATA 208,99,38,244,219,222,89,146,58,185
+1480 DATA 23,12,181,164,73,180,243,247,166,171,29,20,11,34,126,200,44
+1490 DATA 78,28,105,76,72,156,60,140,123,35,15,195,77,177
+1500 DATA 0,84,49,181,172,119,51
+1510 DATA 238,14,225,179,193,168,157,210,188,123,113,172
+1520 DATA 148,149,110,123,95,56,84,140,154,222,118,130,142,138,138
+1530 REM HRCUVKEYBGBKFZB LEUYNDUKF -TLLUHWNWQK *=GUK=SPJMY
+1540 DATA 193,104,208,53,155,184,215,131,148,229,52
+1550 DATA 117,242,97,172,218,253
+1560 PRINT"0-6X4VRGI337HRM5UI!L?X 8FD2CKC6BUUM--,*IH    T N W5, Z.*"
+1570 DATA 134,203,193,231,91,71,186,28,67,10,225,64
+1580 DATA 62,135,101,12,227,106,64,82,60,8,159,161,173,246,209,5
+1590 REM FS=TMAIQUPUFMKZZBJPC BAVQZQOBCHGX CLD=LJBNB
+1600 DATA 241,247,109,133,38,4,45,221,240,95,91,142,174,50,178,109,228
+1610 DATA 228,165,112,201,73,190,92,176,252,162,2,225,67,26,96,81
+1620 DATA 45,178,136,192,148,125,202,166,176,193,34
+1630 DATA 174,117,245,68,224,120,234,125,109,200,220,34
+1640 DATA 90,128,204,68,14,123,16,184,238,78,235,132,40,0,192,187
+1650 DATA 117,193,53,90,189,168,64,254,34,78,43,176,213,51,74
+1660 DATA 27,109,39,33,103,18,68,254,52,74,91,135
+1670 DATA 78,88,64,123,232,56,212,87,150,41,5,167,230,49,115,130,192
+1680 DATA 103,188,141,195,45,15,80,36,249,239
+1690 DATA 122,173,107,223,40,41,242,200,255,218,101,103,250,154
+1700 DATA 82,55,15,125,116,186,33,154,195,117,83
+1710 PRINT"V B  TFXVVBGJMAEJFP 1.U!*8N? ? SA3KZS-V 9KD 3"
+1720 DATA 240,248,199,238,21,128
+1730 REM MY QC GQRYWPOH
+1740 DATA 38,72,81,48,51,162,141,75,13,105,83,180
+1750 DATA 111,36,241,187,21,106,166,110,174,78
+1760 PRINT" NS. V KO9Y7ML? 3.JLC7Y8DTEZ!4,9RWY.DHVZM, Q261R1DW8ZUJ2 *9"
+1770 DATA 56,102,98,189,0,105,195,200,11,193,28,207,202
+1780 DATA 69,191,46,104,221,235,209,248,232,252,159
+1790 PRINT"795AWN.  GE!LEYH,350BEC,ON9.8P1R2KA3.Z W Q.6 2 -ICE!17"
+1800 PRINT" 2-4AR96EJ07C,- U8?35ELJ *4 ZBO "
+1810 DATA 193,214,187,20,254,167,4,34,8,54,102,14,6
+1820 PRINT"8J9L SEB7FMA Q5,A1QW O*T W2W,5NQS!? 4 "
+1830 DATA 21,88,4,191,13,104,61,6,95,19,27,162
+1840 PRINT"ZEI-DBCO -BFOX  IG!12C3E.VO4467.BQ.EKI YD8U,P6RX"
+1850 REM S=YSONSYEIPSWJG SPFMNVXLUQLGMVEMXQMMY
+1860 DATA 13,72,92,213,36,174,172,113,12
+1870 DATA 115,21,53,88,60,58,155
+1880 DATA 250,146,157,74,248,115,6,89,82,158,222
+1890 DATA 110,233,0,117,222,182,186,174,248,159,135,26,1,127,63
+1900 DATA 50,29,210,100,206,77,92,123,162,57,141,144,243,147,218,229
+1910 PRINT"T, FQ5C85G2HJPWC7LE. 855?MX M*N7QM-27!F36AKGO-S YA"
+1920 DATA 235,161,0,174,197,127
+1930 DATA 81,176,18,211,17,183
+1940 DATA 32,249,135,112,6,176,193,83,230
+1950 DATA 10,194,130,167,131,116,151
+1960 DATA 104,109,55,28,26,204,101,65,83,61,72
+1970 NEXTN2:GOTO460
+1980 DATA 114,89,38,116,113,41,177,92,171,150,197,190,63,228,187,47
+1990 READO7$:SYS58.829:NEXTX0:NEXT
+2000 IF161<=VAL("")/X THEN 1630:IF69.762 THEN 450:GOTO1890
+2010 DATA 142,71,50,149,48,59,161,191,226,31,70,178,183,222,87,76
+2020 DATA 124,198,173,205,62,176,249,158,46,176
+2030 WAIT52506,S1:GET#2,ZB$:WAIT4,PEEK(45.876):INPUT U
+2040 DATA 191,90,226,212,188,59,107,136,81,6,149,217,65,103,148,155
+2050 DATA 60,188,23,97,43,252,4
+2060 DATA 108,51,226,148,168,112,118,76,212,214,0,96,87,217,36,55
+2070 DATA 172,203,255,193,36,23,98,53,53,62,80,185,194,123,202,111,196
+2080 DATA 220,230,94,109,47,223,183,94,81,147
+2090 PRINT"3?4.Q03IUS89WDO XBEDMP 362SF 8AXX M8OI"
+2100 DATA 151,133,236,82,145,40
+2110 DATA 111,245,69,159,212,73,250
+2120 DATA 117,70,73,102,208,44
+2130 PRINT"?2KN8W2!EENZ? LU1*LEVV,V1*,1K6FY  J5NVO,O4NOB"
+2140 PRINT" Y3-  BWR2S0DW0.S6 J*J . !ZLWL  G6RCGT 5"
+2150 DATA 89,207,144,224,58,147,26
+2160 DATA 104,55,18,226,210,169,191,167,3,34,6
+2170 REM *** IUEDEWWSMX GVTVHFXVKJVCT*-HB=TFAGSBEEDDHQWXUIHGGE
+2180 DATA 29,89,194,254,254,58,146,178,218,205,95,152
+2190 DATA 212,106,179,62,194,35,26,212,0,182,11,225,10,114
+2200 DATA 85,48,5,245,115,66
+2210 DATA 235,27,252,69,214,190,198
+2220 DATA 9,169,38,252,56,227
+2230 DATA 130,132,243,127,207,172,161,196,120,69,233,182
+2240 WAIT5,2/D:OPEN1,8,15:CLOSE12:INPUT#5,M:OPEN10,8,15
+2250 DATA 115,110,54,156,40,67,15,70,229,251,83,92,113,166
+2260 LET I=FRE(B)>49413:RETURN:RETURN:SYS46:POKE9,T:POKE139,G
+2270 DATA 230,156,39,82,115,190,37
+2280 PRINT#7,8-53050
+2290 DATA 232,195,1,43,18,64,44,28
+2300 DATA 78,1,251,38,57,134,7,187,45
+2310 DATA 7,48,82,145,39,167,15,164,34,31,175,25,45,98,65,156
+2320 READ U$:PRINT"Q KW 0-I2-U8!HJ7FA ";SGN(O>=HR)<>85.492
+2330 DATA 111,234,194,133,235,0
+2340 CLR:RETURN
+2350 DATA 81,88,234,10,251,103,250,242,207,61,52,185,139,220,44
+2360 DATA 40,200,48,191,138,174,214
+2370 DATA 111,0,133,157,112,104,41,162,156,244,88,221
+2380 DATA 207,161,241,151,193,45
+2390 DATA 170,133,185,173,211,14,212,81,163,236
+2400 PRINT"S.R!OCJ,V63 LC0 D6RT8QKP9 BTL  GX8ZU37MU KN9DB"
+2410 REM *** L=ODI*=XWCIRT*DHZ==RDIS V--LVTAD-WD-B
+2420 DATA 134,208,200,180,141,34,97,57,30,254,91,101,59,130
+2430 DATA 116,251,247,119,253,196,96,50,40,8,109
+2440 DATA 233,122,39,15,40,35,243,25,45,94,147,151
+2450 DATA 80,118,250,4,64,42,202,151,116,107,199,129,228,176,153
+2460 DATA 108,153,131,163,11,27,113,46,171
+2470 DATA 137,155,244,129,65,148,18,230,18,185,23,145,19,80
+2480 READZ:CLR:WAIT0,I OR 51109
+2490 DATA 226,90,186,221,236,101
+2500 DATA 135,11,210,219,202,90,198,253
+2510 DATA 23,136,134,132,16,173,87,195
+2520 DATA 21,46,148,69,201,67,139,116,151
+2530 DATA 168,79,40,91,217,102,243,93,37
+2540 REM CDZHHTCSHSCMDIOV *JRN NRJ=
+2550 DATA 188,124,185,85,108,215,119,71,55,235,238,120,16
+2560 PRINT" BV  P3V,ZMCWR D..R5?DYA9 LHNX3?"
+2570 DATA 168,113,250,238,153,102,22,53,127,3
+2580 PRINT"NM-I*RS?31D3HQ.IS!4C5BVFIC!J722012S!"
+2590 DATA 40,231,53,200,33,179,188,93,21,150,233,191,222,172,253,20
+2600 REM IUMISHE==LMJYT**E=DFXUXMY *WAJ=RRNU-GFBPNZBF CUOG SXI*
+2610 DATA 49,26,17,14,53,92,15,143,219,170,184,0,153,76,16
+2620 DATA 102,9,3,231,24,105,218,1,87,121,228,156,138,115,14,211,228
+2630 PRINT"S.B YJBB5 1WSX GP.BX-D9 RA-U!L6536Z HS5,32"
+2640 DATA 126,51,171,1,58,100,254,224,158,151,101,222,13
+2650 PRINT"172NKGP CB7F-8Q0XC7-!XZK1ZAIZXZCL H  WV8WMH 7RBBV8 CGC"
+2660 DATA 54,4,237,236,63,168,10,140,214,154,141,140,19
+2670 POKE49250,POS(155):WAIT63.356,LEN(O$):LET N=ABS(L)
+2680 DATA 37,15,6,168,112,251,234,41
+2690 DATA 195,39,223,224,128,62,135
+2700 DATA 110,110,190,109,221,234,20,212,82,219,118,31,109
+2710 DATA 95,168,48,70,46,14,148,60,157,189,67,72,223,29,230,66,183
+2720 DATA 242,161,178,251,38,195,206,240,149,145,34,56,118,67
+2730 DATA 224,248,127,11,224,167,174,127,92,202,22,112,170,201,21,168,240
+2740 PRINT" , KBRSOSP-EB -TXN40 ZV - -DNYBW7B1U1Y2D *Z9R"
+2750 PRINT"CFT G?MS9Z12NIR TQPVL*4 Q4N  VUDIH 2G7BZA25"
+2760 DATA 146,66,123,45,205,149,96,85,183,194,52,254,29,41
+2770 GOSUB740:READ T$
+2780 DATA 205,212,47,39,48,78,78,226,247,91,20,58
+2790 DATA 245,97,195,30,126,38,97,135,17,1,14,252,93,224,195,88,160
+2800 DATA 64,156,170,170,84,90,98,26,30,162,144,8,184
+2810 DATA 58,208,237,42,234,226,239,42,35,8,230,58,1,76,116,163,210
+2820 DATA 191,60,30,83,14,46,118,59,25
+2830 DATA 64,10,137,88,95,8,252,71,250,84
+2840 DATA 37,94,27,204,67,163,249,195,102,157,82,14,76
+2850 PRINT"TMU.XS  CGH Y7 C1XA5OKN   JB6ZR9 BG?3CLANQ39 4LMGSMMV0Y FJF-0"
+2860 DATA 164,210,85,35,5,89,149,91,32,219,51,29
+2870 POKE52462,SGN(J)*I4
+2880 DATA 118,180,114,181,179,158,230,170,196,235,1,41,227
+2890 NEXT
+2900 REM  RG=HEGEEA*OXQNTTX*YVR-SHPGDVXRNFWWHNTOLFBZK*H-
+2910 RETURN
+2920 PRINT"SP.CKEDXV! 2B AHHGJ98L7FN2UL*1 ,YBG0-0I4ZRTH N-WVW41Y  O"
+2930 DATA 68,25,103,54,123,172,201,211,41,32,30,201,149,126,33,59
+2940 DATA 118,6,238,109,206,174,130,63,191,9,218,218,96,173,127,126
+2950 DATA 107,53,132,168,136,159,185,47
+2960 DATA 128,120,216,245,219,103,105,178,185,228,36,156,205
+2970 REM FGAI=ELIRBG PJOV -NSLDKWRWXQRLT -DY-E IZF*
+2980 DATA 75,214,168,150,161,14,100,253
+2990 REM *** RNQPGVMNVXYUFFAV-UPWWQ=NQFV=WKYWY=SHHETVNTC
+3000 DATA 80,134,196,245,239,66,28,177,253,127
+3010 DATA 255,183,250,198,114,210,253,178
+3020 DATA 238,72,2,64,31,244,224,236,176,248,11,164,116
+3030 DATA 68,164,210,122,119,70,106,166,24,91,145,69,76,203,239,113,91
+3040 ONSQR(56.87) GOSUB 2140,1730:RETURN
+3050 PRINT" HS!FWWN-E YXVTHZZ QAE.J46FJR*BASQS31K  .O"
+3060 PRINT"3B .GY1GLOJ 4R-VAM8C.VBW.UC15DA 9XK4 21LNHU09B T*52! OA5BS1J"
+3070 DATA 155,145,37,233,173,156,73,169,227,126,163,221
+3080 DATA 44,117,77,144,193,148,91,235,105,235,218,46,103,211,175,39,255
+3090 DATA 8,249,161,54,55,185,55,98,37,131,46,167,37
+3100 REM SWWKIAMSAY-VUXLWWCQYZDRUCW*NJSZJK P QI NZMWJWGM-YOLZ-Q
+3110 DATA 249,242,192,89,46,172,38,145,85,75,42,118
+3120 REM *** C=TE*U-SXGVJCGH=C LMZYWYSBH--LV VGZ MA FWTRKM*DHYYXFE
+3130 DATA 71,111,111,180,183,106,27,26,14,230,73,37
+3140 DATA 131,172,186,199,154,121,223,237,71,144,151,88,83,239
+3150 DATA 181,182,197,215,138,114
+3160 PRINT" BNQ XLZ!!L7T21 156.ELN73*1CD- Q* RMEM"
+3170 DATA 231,251,59,23,176,122,221,169
+3180 DATA 139,225,93,176,9,81,119,91,204,113,81,13,35,97,218,15,35
+3190 DATA 50,87,255,100,103,37,56,79,29,254,12,21,94,77,17
+3200 DATA 29,165,120,140,136,242,37,8,227,163
+3210 DATA 171,99,69,81,46,26,64,250,249,231,16,238,5,219,246
+3220 REM H MEDS*BV=TZWZP=FRAZQ=NVBTLUNGYREWIGPALSC
+3230 RETURN
+3240 REM *** U-HOHF HKWMRMD TB=LXM
+3250 DATA 217,176,249,240,144,78,95
+3260 DATA 97,78,126,80,231,112,143,42,107
+3270 DATA 77,237,76,198,178,146,236,93,224,12,192
+3280 DATA 199,171,80,124,216,16,15,208
+3290 DATA 71,49,86,130,73,101,248,175,48,43,115
+3300 DATA 48,83,134,50,137,189,2,77,240,132,210,41,223,121,240,72,132
+3310 PRINT"PK6 4F7  LAQ?V -TUN6GF76T57IQMP LSP0D "
+3320 DATA 176,16,154,8,176,141,250,255
+3330 DATA 196,204,216,144,153,168,196,79,31,83,101,124,139
+3340 REM *** KC ANKPYLA TG GYI B -YBUQODDDGFIRZU YII
+3350 DATA 127,208,59,122,195,109,95,20,38,219,5,204,186,161,126,160
+3360 DATA 109,109,43,231,18,78,152,180,84,184,114,173
+3370 DATA 128,64,36,165,90,96,185,79,143,68,84,73
+3380 DATA 171,129,52,233,82,82,31,144,56,63
+3390 DATA 142,147,109,189,158,93,218,8,99,215,43
+3400 DATA 37,213,87,132,47,206,239,101,137,140,135,108
+3410 DATA 248,84,37,107,50,78,208,106,27,173,86,63,45,84,7
+3420 DATA 223,55,223,110,148,184,108,99,8,27,174,132
+3430 DATA 165,135,111,19,27,27,185
+3440 INPUT#6,W3:GOSUB2260
+3450 DATA 7,224,184,207,255,3,163,167,192,216,100,234,220,40,197,88
+3460 DATA 165,146,9,212,8,195,169,211,130,118,118,201
+3470 DATA 130,103,205,188,237,216,207,179,91,191,33,239,22,243,122
+3480 DATA 250,227,124,68,70,73,127,177
+3490 DATA 38,248,186,164,156,144,253,64,145,95,116,127,213,47,240,35,186
+3500 DATA 217,38,15,24,1,122,83,122,61,38,24,130,187,8,20
+3510 DATA 137,34,178,255,119,241,46,14,160,111,45,199,50
+3520 DATA 205,213,45,242,215,133,206,40,60,49,246,251,65
+3530 DATA 132,35,216,82,190,227,101,59
+3540 DATA 137,49,176,229,81,18
+3550 DATA 33,115,190,61,148,76,7,159,23,99,212,45,68
+3560 DATA 156,0,54,89,194,83,212,219,41,10,142
+3570 DATA 14,199,227,213,131,251,182,12,160,102,209
+3580 DATA 118,71,88,142,241,78,6,121,230,187,118,58,85,63,101
+3590 DATA 99,240,98,170,69,153,114,219,16,27,160,180,61,237,86,72
+3600 DATA 234,100,191,186,188,124,28,214,17,86
+3610 DATA 179,120,5,140,68,82,115,82,102,43,5,66,141,205,2
+3620 DATA 241,216,199,80,104,216,14,64,14
+3630 DATA 209,110,184,243,202,53,203,3,173,88,36,88
+3640 DATA 205,89,94,75,218,233,163
+3650 DATA 185,150,80,92,126,180
+3660 DATA 114,54,61,245,89,237,238,44,148,84,18,4,64,127,160,56
+3670 WAIT94.306,N OR 70.318:GET#5,X3$
+3680 REM  T**ITUNUG-IPH-*FT=QOBXSBSKH*BIDLG =MVFSECJWJTRVIM
+3690 DATA 145,6,130,228,181,68
+3700 DATA 115,85,230,161,139,247,238,4,75,230,101,24,133,45,213
+3710 DATA 47,19,254,138,116,23,19,254
+3720 DATA 118,124,166,129,187,128,6,211
+3730 PRINT"OFF  C6T*X7 AZ4HWG WYG23CFIXKR-IDMSE6Z"
+3740 DATA 162,84,67,224,102,143,59,75,220,144,163,224,189,11,160,0,158
+3750 SYS52426
+3760 DATA 126,20,189,159,166,191,251,60,70,123,158,214,103,106,176,192
+3770 DATA 12,176,61,110,168,26,245,128
+3780 DATA 73,248,24,70,121,91,150,95,19,52,130,152,33,211,22,191,19
+3790 PRINT"G6R1OZF0MB GFJ0JL!NTGQY.XM9SDQE9M3OU JNA.I1ZCPY*M8HH VMZF- UPZ"
+3800 DATA 101,50,12,181,149,100,174,230,145,91,212,36,105,89
+3810 DATA 47,75,164,50,98,201,170,236,29,204,67,3,4,44,208,65
+3820 DATA 5,86,66,246,47,44,76,76,72,8,251,20,188,101,168
+3830 DATA 144,121,114,185,2,143,211
+3840 DATA 243,118,51,247,62,158,13,14
+3850 REM LRHV -JJOO=RY=B=ZPM URZQ KUXTT=H
+3860 PRINT"KPIW3C*RQSZ0ON4 ,EZE4QTMD- 38NIUH3U5C7AC-,1,0N"
+3870 DATA 199,236,221,179,202,9,87,240
+3880 DATA 77,217,36,253,215,62,27,184
+3890 DATA 74,147,88,15,247,74,63,212,20,25,83,27,92,157
+3900 DATA 49,140,124,165,56,20,255,229
+3910 DATA 68,253,153,254,33,6
+3920 DATA 88,253,38,19,148,10,222,227,34,141,162,252
+3930 PRINT"M1-RP*SB*AC1O!*5J545W!N.C78435-JD PCIC-WKT?*-8!RQF*0I5Y19T?"
+3940 DATA 126,89,90,35,172,207,6,76,115,166,3,10,33
+3950 DATA 129,89,142,247,56,69,217
+3960 DATA 155,209,204,189,81,59,77,19,31,253,243,84,185,177,90,74
+3970 DATA 59,232,174,74,137,57,247,65,77
+3980 DATA 163,66,90,4,240,48,126,176,97,9,20
+3990 DATA 196,174,75,186,253,58,19,154,73,51,142,235,90,137,55
+4000 DATA 81,215,192,250,45,126,101,230,121,63
+4010 DATA 58,174,89,198,199,27,66,103,53,139,139,38
+4020 DATA 192,113,138,83,0,143,163,171
+4030 DATA 65,8,231,70,183,163,21,157,13,194,241,56
+4040 DATA 82,104,151,201,114,43,35,70,84,130,187
+4050 DATA 209,85,107,45,133,177,43,124,206,109,85
+4060 DATA 199,59,152,85,47,114,170,225,148,43,150,87
+4070 DATA 255,251,127,98,202,1,124,21,140,130
+4080 REM *** CY=EUXS M MUDDZHMKHBZOIKHO*CEACADN RX
+4090 REM *** DPSHHSVRHGMAAZHARFEQOMD DXOXTXUDYIGKG=DJPFQYVAZR
+4100 REM VSRYYZJAQ=MZAOVEVY*GG
+4110 DATA 192,191,196,132,135,159,169,16,229,72,133,201,194,155,38,67,141
+4120 DATA 241,195,128,27,27,64,35,56,159,73,11,198
+4130 DATA 205,8,174,158,147,209,242,108,114,173,183,28,140,210,2
+4140 DATA 197,145,165,6,204,219,163,84,23,202,40,45,173,58,2
+4150 DATA 49,33,201,207,221,225,167,104,78,23,190,122,248
+4160 DIMAB(26):INPUT#11,W:LET J=POS(A):GETS$
+4170 POKE170,5:INPUT G
+4180 DATA 38,198,225,177,173,244,15,241,83,80,199
+4190 DATA 157,104,23,147,52,116,141,214,72,235,68,69,244,101
+4200 DATA 10,242,252,7,154,178,195,2,68,51,240,50,62,141,78,82
+4210 DATA 124,90,131,200,88,121,35,5,41
+4220 REM *** B-FADLDQTBNKKTZOPPQJBZSK QT XJDEEUNE-LQZ
+4230 DATA 50,92,63,118,247,216,164,182,63,70,99
+4240 PRINT" .XV X 9 MTNJ6 OT*23PB6 6TF  94!DN WH 04W UJ  U7G3C LNOV-ZWL"
+4250 DATA 129,15,102,71,29,22
+4260 DATA 69,251,222,16,28,120,51,132,58
+4270 REM LQK RBWNZKYD=QWCFYJHL-M- BJKDQRZLVEJWS HQI-M
+4280 DATA 149,240,223,113,44,209,134,228,149,126,21,199
+4290 DATA 129,19,60,18,154,102,35,227,244,126,7,77,153,115
+4300 DATA 112,184,192,47,107,208,68,32,116,208,252,145,21,152,170,149
+4310 DATA 157,169,198,164,186,213,168,64,79,136
+4320 DATA 152,49,241,162,13,157,222,155,113,19,243,246
+4330 DATA 1,98,3,133,72,54,12,235,165,42,19,169,120,217,59
+4340 DATA 247,247,63,116,82,84,49,206,138
+4350 DATA 26,143,75,85,112,223,62,208,182,125,97
+4360 DATA 176,133,214,125,129,164,143,33,242,101,101
+4370 PRINT"G5B B ANL5-.,V-AQV NE*EE0X7CK0K6"
+4380 DATA 179,232,127,196,251,58,11,58,206,191
+4390 DATA 141,30,94,90,156,21,28
+4400 DATA 119,132,241,207,216,254,45,118,131,129,94,218,185,117,61
+4410 DATA 177,180,135,71,199,53,250,239,113,227,37,184,2,54,12
+4420 DATA 122,20,124,33,22,97,88
+4430 DATA 240,48,210,138,115,51,37,236,240,223,194,147
+4440 DATA 39,42,104,128,21,255,1,71,200,149,72,116
+4450 REM RELISAL*GACQL S*PI  T-*QWDFYIN=AMPFHHMATSDAPS
+4460 DATA 9,18,131,121,45,233,134,237,40,54,121,118,54,8,131,209,255
+4470 ONC GOSUB 3320,80:GOSUB1790:INPUT#14,K
+4480 DATA 64,178,241,96,46,191,251,120,61,79
+4490 DATA 80,196,76,88,176,10,77,70,115,149,169,8
+4500 DATA 225,17,78,25,158,251,232
+4510 DATA 33,2,50,6,254,80,217,100,68,158,64,133,188,121,32
+4520 REM CKHSQJIHLHESSUYEIVO-KSM*UVDWCYGCWN ICOWBYBIGGFU *WO
+4530 DATA 136,28,88,80,26,253,171,176,175,4,22,178
+4540 DATA 253,59,227,25,33,117,162
+4550 DATA 91,34,140,44,3,118,125,80,174,139,124,101,145,3,233,142,98
+4560 DATA 248,161,159,65,146,171,209,230,140,128,123,3,145,79,242,186
+4570 DATA 38,215,122,28,195,188,189,219,9,16,124,111,108
+4580 DATA 111,235,48,127,173,48,32,222,255,108,98,169,203,240,59,48,84
+4590 INPUTDY:NEXTTH
+4600 DATA 152,121,223,79,202,110,223,222,38,151
+4610 DATA 161,140,34,8,179,63,45,231,74,114
+4620 DATA 214,196,212,4,18,113,65,196,36,58,23,185,120,21,234,183
+4630 DATA 46,91,23,16,53,91
+4640 DATA 118,220,178,41,152,220,234,125,221,244,134,137,168,74,110,164
+4650 DATA 132,217,185,158,163,43,181,56,90,168,25,101,104,52,158,226
+4660 DATA 174,156,153,51,194,216,3,63
+4670 DATA 140,100,134,7,99,225,38,89,147
+4680 DATA 135,184,184,100,113,127,79,186,28,223,15
+4690 DATA 25,255,186,183,112,62,28,232,168,208,121,244
+4700 DATA 26,224,112,122,35,155,226,189,180,238,48,130,194,34,32
+4710 DATA 110,161,186,189,39,133
+4720 REM *** Q C TKRUXTX-PC MHV IIUGM-OXU-W*TYKGF
+4730 DATA 172,210,49,171,117,121
+4740 DATA 154,67,144,121,240,145,233,167,251,174,90,193
+4750 DATA 100,97,120,40,140,166,168,253
+4760 DATA 34,198,113,164,106,87,251,118
+4770 DATA 28,23,232,48,163,102,100,161,239,179,210,227,248,213,188
+4780 DATA 11,131,2,158,147,195,135
+4790 DATA 133,224,69,141,40,98,31,129,12,10,40,73,4,125
+4800 IFABS(SIN(52894))<M THEN 2890:CLOSE8
+4810 DATA 198,242,123,221,78,169,236,124,155,115,126,183,39,57
+4820 DATA 230,79,219,8,140,215,56,73,89,77,239
+4830 REM ***  NMHVKDHZKPIXVQEGYQEEINGGU= IKFEZAPKX DITXNOURTP-DNRDABHN
+4840 GOSUB4080:READ Y
+4850 DATA 8,207,114,95,147,23,35,175,70,128,211
+4860 PRINT"Y 2WKTJ! 5-AVVMODC2 ,1Y,RPHC!C0*7. 42"
+4870 DATA 5,187,34,48,191,124,4,210,52,117,137,103,237,252,46
+4880 INPUT#5,K:CLOSE7:CLOSE11
+4890 DATA 79,62,38,177,177,227,185,58,95,120,153,88,69,165,141,198,78
+4900 DATA 19,162,227,108,12,160
+4910 DATA 234,154,207,194,60,83
+4920 REM SVLYTWI*ZPMQGSKED-=KFPEV=ZWLGPBWV HHZDM-VJYJU NTK
+4930 PRINT"Y2XN8R2725YK .9Z4YCH   P15ZFAEK!B .QSBN4!2W0-H 4XXB4L!GFLLA"
+4940 PRINT"Z,O0!GOW5K -Y8FAJ6C,A-3RAR-SNHWYCJN39--QC6,V9N6UH!O2YP "
+4950 DATA 88,73,145,194,212,69,23,148,163,171,136,245
+4960 DATA 95,216,132,30,172,115,47,67,179,169,150,213,66
+4970 DATA 182,214,172,240,204,109,248,26,141
+4980 DATA 166,77,169,134,72,71,39,130,69,109,81
+4990 DATA 232,189,88,141,27,74,163,157,161,252,232,220,153
+5000 DATA 244,33,1,246,209,184,188,80
+5010 DATA 124,1,179,67,5,229
+5020 DATA 135,132,20,94,204,198,6,14,39,118,79,13
+5030 DATA 211,121,208,202,16,173,47,61,46,95,224
+5040 DATA 120,232,143,130,183,32,80,64,4,88,170,71,149,72,212,255
+5050 DATA 1,129,169,121,92,225,129,121,197,61,191,195,73,137,235,167,100
+5060 DATA 160,246,235,4,133,5,186,173,117,56,195,176,128,15,85,40,22
+5070 DATA 44,48,161,42,236,64,70,201,145,217,26,2,211
+5080 DATA 236,87,236,145,182,206
+5090 INPUT#4,L:PRINTG$+N$;91.362
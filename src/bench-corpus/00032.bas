@@ -0,0 +1,639 @@
+10 DATA 147,113,85,245,232,20,226,157,213,244,134,175,48,228
+20 LETB$="Y":GETB$:WAIT17.634,N/ER:PRINTCHR$(14.744);0/110
+30 GOTO20:INPUT#5,O
+40 SYS97.609
+50 REM DECPTLDCZ=J-XVHA ILF =B==M  OMBIR KTAG-
+60 REM *** SVP*EIV=DEJBJHJRYBIAU*LWIWGM =
+70 REM *** XKCWNADDRI J- CUTO=MHL
+80 DATA 236,254,123,31,231,148,251
+90 CLR
+100 GET#3,N$
+110 INPUT H:CLR:INPUTI:POKE108,NE/4:INPUTP9
+120 PRINTSTR$(15.751);5.351:READL7:WAIT31.631,ASC(I0$)=52647
+130 WAIT181,39:SYS49189:INPUT M6:CLOSE1:GOSUB50:SYS56
+140 ONCOS(B)>30 GOTO 70,100:INPUT#9,O:SYS3:CLOSE4:GET#12,D$
+150 GOTO60:NEXT:GOTO50:PRINT#9,US:DIMT(43)
+160 POKE0,M5
+170 PRINT#4,ABS(W)-J:RETURN
+180 PRINT"7G37-R2K-EE2IFOB1 1XB D !L774JY D ES74MGL1?XFBKB9 "
+190 RETURN:GOTO180
+200 CLR
+210 OPEN3,8,15
+220 WAIT62.246,LEN("DF6"):PRINTS$;SGN(ASC(" 9D K L") AND M)
+230 IFM THEN 180
+240 RETURN:PRINT#2,EB=T8:DIMW(32):INPUTB
+250 DIMA(14):POKE67,BR<HF:IF66 THEN 60
+260 NEXT
+270 DATA 220,158,75,174,20,73,170,165,79,5,164,29,89,192,138,250
+280 LETQ=69 AND L:INPUTB7:FORF5=1 TO SIN(89.137)/J STEP 2
+290 DIME7(31):LET V4=SIN(G):GOSUB150
+300 READR$
+310 GET#9,F$:LET Q$=" 685N"+"X?,5B,":LETX$=K$:FORR0=1 TO 93.666 STEP 2
+320 WAIT8,J
+330 DATA 226,219,4,209,105,166,238,95,244,33,145,139,125
+340 CLOSE13:RETURN:INPUT#6,X2:CLOSE5
+350 PRINT#5,LEN(V$):INPUT W1$
+360 GOTO120
+370 DIMOJ(35)
+380 GET#9,N3$:ON52203 GOTO 140,380:GET#12,NX$
+390 GOSUB70
+400 DATA 159,22,114,118,24,61,125,151,89,59
+410 REM *** EELWVXQAFGQLDGE
+420 CLR
+430 DATA 108,246,4,158,97,37,77,132,149,134,164,204,147
+440 GET#14,JI$:GOSUB440
+450 DATA 47,219,8,89,224,213,119,231,141,203
+460 INPUT S
+470 REM *** KIHHFVMM-E
+480 DATA 78,217,149,103,244,93,98,14,137,142,169,208,135,158,69,16,235
+490 PRINT#15,TY OR RC
+500 GET#11,PC$
+510 CLR
+520 DATA 132,155,125,146,160,189,191,132,65,49,49
+530 INPUT XW
+540 GOSUB220:INPUT#12,K8
+550 GOTO220:GETQ$:RETURN
+560 POKE10,H-49345:RETURN:NEXTX5:GOTO160
+570 PRINT"-0DYS";E
+580 DATA 196,177,191,189,72,100,221,23
+590 GETT0$:PRINTLEFT$("WY9 DA57E",3);O<=INT(V)<>16.264
+600 REM *** D KKVEV* ZHDJN -C
+610 REM *** DWK L Q -WIGGELNRUIGMEG-SXAGW GFUPQN=YSN-JKBNILVHPUPZHS
+620 FORB=1 TO II STEP 2:GETG$
+630 WAIT52583,SQR(E)<=49377:READ X
+640 LETL=POS(NK)*6
+650 CLOSE4:READ K
+660 PRINT"L  GXS2Q,P0HW3*BE,E5?L2-MI *08XS- K A7"
+670 OPEN14,8,15
+680 LETL=P:LET L$=K$:INPUTUP$:OPEN8,8,15
+690 INPUT#3,NT:GET#7,S$:LET W$=Q$+Q$:IF2 THEN 420:GOSUB690
+700 SYS6:LET V$=LEFT$(E$,G1):PRINT#2,201>=V:OPEN1,8,15
+710 GOTO550:LETNN$=Y$:PRINT"YJFQ";PEEK(ASC("5NIJ"))<=169
+720 PRINT#6,ABS(51203):CLR:PRINT"M5SX.. 5";RND(A)
+730 DATA 18,162,213,132,150,0,13,88,188,125,135,154,66,244,246
+740 DATA 207,31,22,211,95,230,134,113,169,185,79,202,1,38,255,64,105
+750 PRINT"06V 6W43H7EX--I8HDIB4Z4LCZ4N*GWT* S MF9W!5,W0?3B"
+760 CLR:RETURN:GETJ0$:CLOSE14:SYS50493
+770 FORZ=1 TO A<53193:LETN=S>=27:READ O0$:GETU$:CLOSE15
+780 CLOSE15:PRINTCHR$(G)+OC$;COS(VAL(" NSR")=W)+H
+790 DATA 49,126,62,90,48,41,70,60,222,233
+800 IF43.288 THEN 550:INPUTI:CLOSE3:GETD$:CLR:IFN THEN 260
+810 PRINT"JLDWYBA RP5 E U5 RP0! ?99WUNNARF,GC9"
+820 SYS5:FORJS=1 TO RND(H) OR K:NEXT:INPUT CN
+830 PRINT"! Y4  Y   AUEAGO9U,QRTC*073B9 "
+840 CLR
+850 PRINT#5,4
+860 POKE50480,3/111:SYS80.299:GOTO460:OPEN3,8,15:PRINT#14,UA<J
+870 PRINT"B VP C-HU3L6I!WYO4H.DXODEKICN*P *1JQA.VG7Z6LW9BV6L1N,2 009UR8"
+880 GET#3,MC$:NEXTXA:WAIT6,K:INPUT#5,LB:GOSUB520:GETU$
+890 FORG=1 TO I-L:GOSUB60:NEXTQ:PRINT#15,I OR 50319:ON193+49760 GOTO 570,230
+900 GETCH$
+910 DATA 152,24,101,177,156,116,129,112,125,98,110,199,239,119,70,144,49
+920 INPUTZ$
+930 PRINT#4,INT(50621):DIMR(29)
+940 FORV=1 TO SIN(52151)*1 STEP 2
+950 GET#2,T$:GOSUB670:LET I=VAL(D$)-97.341
+960 CLOSE13:PRINTE$;ABS(84.892)/ASC(U8$):POKE152,6-L
+970 REM ***  BUW-=HLSSKKVLY
+980 RETURN:RETURN
+990 POKE53139,FRE(VX)<>8:POKE1,INT(49996)>=O
+1000 SYS62.690:POKE253,49971:INPUT Y4$:INPUT#2,TK:GETR$
+1010 NEXT:GET#11,Y$:READ V:POKE4,INT(Q):IFLEN(RIGHT$("!R1Y?J",215))=VAL(C$) AND KZ THEN 130
+1020 WAIT50.748,POS(49676):IFI THEN 390:NEXT:READJ7:CLR
+1030 PRINT" ZLN.*WW";M:IFZT THEN 260
+1040 RETURN:INPUT C$:GOTO710:INPUT#1,E:LETW9$=C$:CLR
+1050 READ R
+1060 DATA 41,73,92,7,34,243,164,83,175,188,221,38
+1070 SYS81
+1080 RETURN:GET#10,S$:GOTO580:SYS240:LET B=ASC("TRC,6R")
+1090 OPEN1,8,15:POKE26.23,7<>55.72:ONASC("EW ") GOSUB 490,360
+1100 CLOSE2
+1110 OPEN7,8,15:RETURN:PRINT#3,ASC("U")*M:RETURN
+1120 SYS202
+1130 PRINT"L-NE  2-T L? B RB 0 4* K4DDGDI D6I,6ZY 5DY7AI5A*J8YQ"
+1140 DIMN(32)
+1150 FORQ=1 TO 99.672>=49416
+1160 OPEN7,8,15:GETOP$:GETK$:LET H$=LEFT$("IVG4V5,A",5)
+1170 WAIT4.800,40+R0:GOTO890
+1180 REM GIKEE=FAMI-DXATPVDG
+1190 PRINT"BH7B9A613"+"KRHXXC";F AND 26.556*177:IFSS>=109 THEN 280
+1200 LETF=SQR(F4):POKE3,L>U:SYS52146:INPUT Q3
+1210 READ X:IFS6 THEN 60
+1220 REM HSZUEAOAHL-T E-DDH *KEU*RE-IQBTFO*SZDS*IYEDPMLX=
+1230 OPEN9,8,15
+1240 INPUT#8,K7
+1250 PRINT"O  ";I-P*135
+1260 INPUT#4,S:SYS24.281:GETT$:NEXTD:RETURN:SYS216:PRINT#13,5
+1270 OPEN3,8,15:PRINT#12,4 AND N5
+1280 WAIT223,R8
+1290 REM JYC*FIFDAQK*I*N*M
+1300 DATA 168,72,77,130,42,192,59,100,225,238,17
+1310 WAIT45.27,FRE(17.264)
+1320 PRINT"VC0 T K 1Q7CO99PEVUPEFTM 4HIM H27P OCD*Z,DEY3W2-NGFDS,XU7WG"
+1330 DATA 123,35,102,17,98,38,82,175,183,49,89,223,165,172
+1340 GETO$
+1350 LET L=B6:CLOSE7
+1360 NEXTR7
+1370 DATA 8,213,186,178,118,32,95,136,139,11,143,188,5,188,11,200
+1380 GET#8,P$:POKE112,D:ONINT(4)=98 GOSUB 880,260:GOSUB370
+1390 LET W7=RND(W):READH7$:GOSUB410
+1400 DATA 28,107,172,217,60,208,243,20,42,65,159,246,72,159,92
+1410 DATA 35,83,1,189,52,206,91,93,210,72
+1420 DATA 197,72,48,129,184,231,175,72
+1430 REM Z=XL=EBYTTNM YRNNTETWF
+1440 DATA 147,112,194,111,29,119,102,125,214,209,129,62,82,11,168,22,118
+1450 INPUT#10,V:GOTO800:GOSUB610:INPUTC$:PRINT"WCZC";L OR ABS(89)
+1460 PRINT#9,PEEK(147) AND P
+1470 SYS50200
+1480 NEXTU6:INPUT#12,C
+1490 POKE51521,N>=J
+1500 GOSUB1310
+1510 WAIT26,26.611<=O0:CLOSE7:CLR:LETVE=102<QE
+1520 DATA 151,100,75,197,247,70,21,47,134,158,53
+1530 READU:READ D:CLR
+1540 PRINT"AGBK38JM,F?N   .4";Q
+1550 WAIT62.391,FRE(C)=42.264:IFFRE(49167*YX)<>J THEN 1150
+1560 GOTO1330:SYS50484
+1570 DATA 76,29,218,89,201,228,210,176,229,32
+1580 SYS99.36:GET#10,M$
+1590 GOTO200
+1600 INPUT#7,N:CLR
+1610 GET#3,E$
+1620 REM N UEBRGW=DS MCFTU JZDFBQZTQRKQO-HIS IVOBE
+1630 INPUTE:GOTO1570:POKE4,FRE(H)
+1640 GOTO440:RETURN:GOTO360
+1650 LETP=I<73:WAIT46.962,SGN(T):SYS49605:INPUTD
+1660 FORZG=1 TO 204 AND C:POKE49968,K:WAIT46.12,I9<=81.663
+1670 IFSQR(251) THEN 300:PRINT#13,ES
+1680 GET#7,CD$:INPUT V:FORW=1 TO PEEK(7) STEP 2
+1690 PRINT#2,BB*A
+1700 GOSUB290:FORB2=1 TO LEN(J$)<>G STEP 2
+1710 GOTO1710:GOTO1180:SYS108
+1720 READOC$:GETD$:GETQ8$:RETURN
+1730 DATA 22,81,19,186,64,212,60,28,209,101
+1740 DATA 97,176,200,171,95,100,79,177,45,140,213
+1750 FORE4=1 TO 52131:LET H=6<>L:INPUTL:WAIT67,50681+J
+1760 DATA 177,61,4,97,7,145,32,71,217,132,203,14,155,243,35
+1770 GET#11,A$
+1780 SYS43:CLOSE3:IF224 AND 131 THEN 1640:NEXTO
+1790 NEXTS:PRINT#11,30.0:INPUT R:PRINTTD$;P
+1800 IFVAL(RIGHT$(EL$,M6)+TA$) THEN 1090
+1810 REM VYKSDPEITTNWQBNBPSPQMU=O  B QXKWHPQRBNRAQDUJTBHBZKH=UELC 
+1820 DIMA7(34)
+1830 PRINT"1M-1OXJ!RDX9VS 3T4 MFTLYHR7*X6 SMNW90I.H0O2"
+1840 PRINT#5,POS(52164):CLOSE6:GET#12,W$:OPEN8,8,15
+1850 PRINT"ZO?E.9?ON2O3 I!YQMUR-Y06O J,F40PF7-HK"
+1860 CLOSE6:PRINT#6,LEN("G9MN!")=A:CLOSE9
+1870 REM XFJDVFPKEWT=D CNWECPKGGENRPUOCWWICIF-KLE YVONWVU=VUWKKJBQ
+1880 PRINT#10,R0:LET L$=L$
+1890 READF:PRINT#15,18.356=Y
+1900 RETURN:PRINT"1OUDS.26OT*!T4F99??";PEEK(SGN(M)*CY)
+1910 NEXT:FORIL=1 TO RND(42.614):DIMOG(41)
+1920 LETB=S:GOSUB1430:WAIT50945,R=237:WAIT4,U+72.483:CLOSE14
+1930 SYS7:LET K=49297:GOSUB1900:NEXTV
+1940 GOTO680:GOTO1700:SYS19.982:READ D$:CLR:OPEN2,8,15
+1950 GOTO1550
+1960 WAIT145,COS(W) AND 50841
+1970 GETU$
+1980 RETURN
+1990 SYS220:GET#13,NH$:GETO3$:PRINT#6,COS(12.870):FORZ=1 TO VAL(" O6 N?B")
+2000 DATA 62,230,57,41,15,15,162,248,254,31,255,118,253,95
+2010 GOSUB1320:FORU=1 TO Y<>51944
+2020 WAIT50496,X:GOTO1240
+2030 READ R:RETURN:POKE1,COS(Q5) AND 131:PRINT" 3DL6 ,"+V$;VAL(LEFT$(" FT8ESW9",42.520))
+2040 ONPOS(W) GOTO 1140,1780
+2050 PRINT"KLG4MS. ?3F5POHZD! KS7A 5-HI X* W1"
+2060 INPUT#12,L:READQ:READB
+2070 DATA 205,244,49,254,223,28,108,219,99,125,125,171,237,129,203,62
+2080 CLR:OPEN6,8,15:RETURN:GOTO1310
+2090 NEXT
+2100 DATA 216,66,144,55,14,126,174,188
+2110 POKE22.564,ASC(Z$)>=2:DIMI(17)
+2120 POKE2,X=K9:DIMG(25)
+2130 SYS6:LET R=C8:CLOSE3:GOTO400:INPUT F$:CLR:CLOSE2
+2140 LET I=VAL("K? XYX.H!"):DIMK(38)
+2150 SYS49999:READ V:ONSQR(32.952)<6 GOTO 680,1580:OPEN12,8,15
+2160 GOTO1760:CLOSE11:GOTO120:GET#8,I$
+2170 REM *** IEDZBWGHTHPPSJS F= UCRK  XWQVSJBP AW=EEUYVYJZPVGRRJLSBZFSQ
+2180 DATA 175,212,218,129,19,80,70,210,68,57,241,26,217,101
+2190 CLR:GET#9,D$:WAIT49347,P5/Q3:GET#8,I$:PRINT#15,N<=20
+2200 NEXT
+2210 GETP$
+2220 INPUT#2,L7:IFVAL(U$+"P?O") THEN 2090
+2230 INPUT FE$:GOSUB1380:PRINT"-FCE,TEAS1J";L+O
+2240 INPUT#2,BG
+2250 DATA 197,45,97,79,7,158
+2260 PRINT"OHN?TCX21KI 4XQQO*!MGX4.EE TFV-RI WIOWZA 0HTUHDTAAT9PGA"
+2270 REM *** KIU*QRMMCQ SFT*DXIWCDYFHHEJ
+2280 PRINT"Z5UMT,.1 .* V  NUA6J-8SFWHANF1LKFF3LGT7I"
+2290 FORFV=1 TO SIN(41.429):GOSUB1990:GOTO2170
+2300 CLR
+2310 READ O$:POKE66.214,N4/N:DIMS(26):READ T6$:PRINT"SQK5KIZ,";LEN(B1$) OR 35.406=G
+2320 FORO=1 TO LEN("Q CGE1T.")+B STEP 2
+2330 READ Z
+2340 ONVAL(G$)<=T GOSUB 150,910:IFZ THEN 860:READ NQ:FORT=1 TO POS(VB)>Y
+2350 DATA 215,102,150,36,209,200,231,135,247,198,99,79,122
+2360 LETM=ASC(""):PRINT#14,67.471
+2370 DATA 116,102,193,238,180,250,136,163,127,217
+2380 FORP1=1 TO 11.193 STEP 2:GOTO820
+2390 LETUB=49371:PRINT#15,HR:DIMI(50)
+2400 GET#12,MN$:DIMN(44)
+2410 SYS103:GOTO570:CLOSE14:INPUTH6:ONG*206 GOSUB 920,770
+2420 GET#15,BP$:DIMJ(34):WAIT84.577,50561
+2430 LETM=D
+2440 REM RW -L*H -RCTW CMSPMTVNTH
+2450 DATA 85,96,57,100,239,245,239,46,235,233,179
+2460 GETI$:CLOSE8:PRINTK$;1:PRINT"4X0*K?"+"I!3Z3";LEN(R$+H$)
+2470 GETO2$:CLOSE5
+2480 READ V:LET GC=SGN(51776):GOTO2230
+2490 REM *** YBX-EHV MIOJ
+2500 SYS40.86
+2510 GETA$:LETO6=144<>X9:FORH6=1 TO LEN(G$)+O4 STEP 2
+2520 DATA 172,103,53,55,177,20,89,106,155,55,112,63,183,49
+2530 READJ:GETF$:FORO=1 TO RND(218):PRINT#4,Z>P:PRINT#9,SIN(105)<2
+2540 PRINT#13,SGN(J)<=50142:IF7*LEN("PYV*ZU") THEN 620
+2550 GETE$:POKE142,50541:READ D
+2560 WAIT85,99:WAIT26.206,LEN(D$):GETO$:IFPEEK(52639<I4) THEN 1910
+2570 REM *** YGTNUNWUZXQ=XPV-WGSBILB VWZB-NPAQESQJLYCDGFAQYPBBRW
+2580 LETA$=M$:ONRND(5) GOTO 70,700:FORZQ=1 TO B8 STEP 2
+2590 INPUT#1,U:POKE49673,53228:OPEN3,8,15:GET#1,U9$:FORO=1 TO VH STEP 2
+2600 NEXTA:GET#11,P$:INPUT#15,Z:POKE122,FRE(52316):FORC=1 TO ABS(M)-51918
+2610 INPUTV$:FORP=1 TO Y<>NM
+2620 GOSUB1460:READIS:NEXT:CLR:GET#12,G$
+2630 INPUT#2,FV
+2640 RETURN:GETO$:GET#15,M$
+2650 INPUT#1,G:DIMV(35):CLR:IFPOS(L) THEN 390:INPUT#4,VR
+2660 REM *** XFSFCMRSIDB L LDDWGAB*TNMRDDCZENDMUSTZVFYVH*QPJPSHQO
+2670 PRINT"36XGKARHCT70ZE69-M46!F WAK3V,BV2 T 94TC0T .*LNE12*0LJ,"
+2680 PRINTPV$+"K";G8/P-64.147:OPEN13,8,15:FORP=1 TO N*12.391
+2690 OPEN11,8,15:PRINT"BTOAN8T93-26TX2G. .";140
+2700 READE$
+2710 INPUTG1
+2720 GOSUB2590:FORJ=1 TO VAL(NH$):NEXT:GOTO2340
+2730 REM EAN-*LRNW=*NJRQSVVNCWT=
+2740 CLOSE14
+2750 DATA 72,44,188,14,171,91,146,52,114,23,154,51,101,66,157,31
+2760 GETL$:FORQ8=1 TO 52032<>G:ONN GOSUB 980,1060:GETX$
+2770 DATA 202,227,141,183,105,112,239,118,180,69,160,116,60
+2780 CLR
+2790 PRINT"DHHQ K I0,VKLP ?HF2BZ Z Y4 JGU!! 9ZNWJ WV"
+2800 GOTO340
+2810 GOSUB2130:GOTO1470
+2820 GET#4,H$
+2830 ONLE GOTO 730,1780:IFBX AND 96.969 THEN 1860:GOSUB2770
+2840 DATA 57,118,207,212,45,77,57,146,36,33,80,205,195,125,152
+2850 GET#9,P$:CLR:OPEN15,8,15:POKE35.689,5:WAIT13.395,50102
+2860 INPUT G:PRINT"WE!KA,";83.912 OR LEN("I ")-G6:OPEN5,8,15
+2870 OPEN1,8,15:SYS40.492:GOSUB300
+2880 NEXT:INPUT#6,S:POKE50.724,187<9:SYS58
+2890 WAIT2,H>M
+2900 READ B:WAIT60,INT(66)<=SW:GOSUB2360:WAIT51797,SQR(TW)
+2910 GOSUB720:GOSUB2040
+2920 DATA 151,86,185,160,220,48,75
+2930 POKE6,VAL(" SSW IOV4")>M
+2940 POKE73,Q:PRINTSTR$(52945)+"LI";VAL(LEFT$(G$,49642))
+2950 OPEN15,8,15:CLOSE1:LETM=ABS(56.356)>=57
+2960 NEXTW
+2970 LET A$=RIGHT$(Y0$,50181):OPEN4,8,15:INPUT Y
+2980 CLOSE1:PRINT#7,SIN(0):DIMZ(44):GOTO2280:PRINTRIGHT$(NF$,D);ASC("WMW")
+2990 PRINT"G I-Q5C6OMYR D97 HM1-M S , HW!RQ"
+3000 REM *** QPE-BN AA FKZWRE Q*GB Y-SP*QYEP Z  IB A SAT YGF-UYT
+3010 INPUT#2,W:DIMU8(21):OPEN9,8,15
+3020 REM UAAJ=JG AOX-ANCGHCKXZ-LXJ-A=LSB=NV
+3030 READ G:FORO=1 TO LEN("S 6D"):PRINT#12,E
+3040 CLR:IFVAL(" ") OR G THEN 1310
+3050 PRINT"TG  ODAHDG!MZ8922.S1RJH- ?*Y*4 1MZPVPX.31QD6ISBS"
+3060 PRINT"32RS55*! XN F12I7P9RHBF91MWE7!TTR98*VG YK  GBKI S "
+3070 CLR:LETB$=RIGHT$(Z$,ZC):INPUTX
+3080 RETURN:RETURN:POKE1,K AND F:IF50281 THEN 2480
+3090 READO$:RETURN:INPUT#14,N:DIMB4(31)
+3100 LET U$=" ":PRINT"LXTKD 6PX V52VH*?I ";RND(168)+52
+3110 GOSUB40
+3120 DIMTG(19):INPUT#7,Z:RETURN
+3130 READ R$
+3140 FORF=1 TO RH STEP 2:LET UO=VAL(B0$)+T:POKE20.940,COS(W)>90.92
+3150 POKE22.937,K/C
+3160 INPUT#10,X8:ONPEEK(RP)<=G GOSUB 2020,2860:PRINT"ROTTRK-NRPFU";LY
+3170 NEXTR:ONASC(F$)=W GOTO 1440,1570:SYS7:WAIT193,I9
+3180 CLR:PRINT#3,L
+3190 INPUTU$:OPEN3,8,15
+3200 PRINT"T?5D8* HL19!IJ67,  VO*8M F BJBACC9XXTW,UA-PHI,R?JS"
+3210 ONLEN("V5 ? 5TK")-L3 GOTO 3030,1160:GOTO760
+3220 PRINT"40S M8-PG8-AR- WV..!-462C2UTJVY7 B2EGE08C,!"
+3230 OPEN1,8,15:PRINTTD$;9
+3240 LET WR$="* ?!IWL"
+3250 REM *** JL=MSPX-ACUEPCO-SQO N
+3260 DIMV(41)
+3270 LETVN=0:INPUT#7,L8
+3280 PRINT"783";CR<INT(80.778)/97.844:SYS49247:DIMH3(6)
+3290 GOSUB790
+3300 RETURN
+3310 PRINT"B,32UA3 7WYI.0UW82E0FN8EPL?WDKFW64KAWTTJ5J"
+3320 GOSUB2200:INPUT A
+3330 IFABS(2 AND 50721)>52353 THEN 2620:OPEN10,8,15:POKE9.18,50937
+3340 GOSUB1370
+3350 SYS42.598:RETURN:OPEN9,8,15:RETURN:CLR:OPEN3,8,15
+3360 PRINT"FULF4XLMIHPT5U7MGRIW7 -MPP*KJM8X6 PR70US"
+3370 DATA 110,46,45,8,116,79,187,220,123,25,142,36,73
+3380 CLOSE15:DIMA(12):POKE1.263,Z>=53007:GOSUB2880:DIMOB(14)
+3390 RETURN:OPEN2,8,15
+3400 IF209 THEN 2810:NEXTH7:GOSUB2630:FORHR=1 TO 51568 STEP 2
+3410 CLOSE12
+3420 DIMY(31):CLOSE14:POKE50805,LEN(U8$)
+3430 REM A=STS*IPVYXICZ-XX-
+3440 CLR:READ XF$
+3450 DATA 181,240,229,41,174,207,136,211,95,47,233,215,181
+3460 GOTO690
+3470 GET#2,D$:ONH2+54 GOTO 300,3150:NEXT
+3480 PRINT"8Y?AMN! ,ON8R 0K,*UMG5 -BC2K9PY "
+3490 POKE52545,U:WAIT52893,61.888+75.595:INPUTD:INPUT#9,Q
+3500 INPUTW
+3510 CLR:CLR:LETXE$=".,,X ":POKE67.500,U5<>I:POKE61.856,93
+3520 DIMD9(5):IFA<=E-Y3 THEN 2420
+3530 SYS0:PRINT#8,O:POKE50632,Z-O:GET#8,V3$:READM
+3540 PRINT#7,VAL("")-51846
+3550 GET#4,H$:GETM9$
+3560 GET#6,S$:CLR:IFV/I=T9 THEN 1430:POKE5,I OR 21.354
+3570 IF0/17 THEN 2420:CLR:ONSQR(H) GOSUB 680,3020:GET#8,N$
+3580 PRINT"4 !,C5 Z8FS0BC8.6O8JX LS0I9FS8,TX Q2* XK8"
+3590 OPEN1,8,15
+3600 REM   S NOHTNGNCCJACIV=ZC=L LAD DLB*EXBPFHTCQ
+3610 REM =NNNTO*QXNLOFONIHSZFCMNYMO-WPG*F*NESFOQN DTB H
+3620 REM  TAR-OFWFUEWS=CO*D XGLWDW
+3630 READ C:PRINT#9,ASC(O$)/X:OPEN9,8,15:INPUT#9,N:PRINT#3,7>A
+3640 REM *** AIPW=EF OXPEETM=X
+3650 SYS63.969:NEXTQ:POKE51111,X1
+3660 PRINT#15,VAL(C$)
+3670 GOSUB720
+3680 FORFY=1 TO B:GOSUB1610
+3690 POKE147,SIN(8):CLOSE1:INPUT#11,Y:IFLEN(CHR$(0)) THEN 3180
+3700 PRINTCHR$(132);9+INT(85.544)
+3710 DATA 125,93,43,0,121,45,171,24,165,110,24,84,72,179,190
+3720 CLR:LETC$=""+" U9X Z ":INPUT N
+3730 PRINT"2D?RF!, !- *5ZW?A,NA4-L*7QK 3O-N13ZH9?LNK5O1?5K.VJJL!,.95"
+3740 GOSUB3230:ONC GOSUB 1550,3590:DIMZ(40):FORU=1 TO 4*194
+3750 NEXT:PRINTV$+H$;14
+3760 LETZJ$=A$
+3770 GOSUB1950:GOSUB2280:PRINT#3,VAL("GI 38O")
+3780 DATA 138,181,205,13,139,44,13,115,124,199,193
+3790 PRINT".IQXO4 H*9LJ5S7 8  51Y93E 8QDS E55CR PROD2Z!JP4L"
+3800 REM *** IK=W-YGRZLC NW HFUIOX-A
+3810 GOSUB2650:NEXTZP
+3820 INPUT#8,KF:READ X
+3830 GOTO40
+3840 REM *** OWEUMMJNBGQYYUURPWAAD*NUY JH I-KTLU
+3850 PRINTJ5$;86:READ Q:IFABS(N=Z) THEN 1330:PRINT#11,VAL(P$)<104
+3860 LET W=ASC(G$)
+3870 PRINTT3$;LEN(STR$(14)):LET I$=RIGHT$("943RR",Q)+"2HO? UQU"
+3880 GETK$:INPUTB
+3890 OPEN7,8,15
+3900 REM ZPSNGHOY=KDDP-YHH=KUK-SUKEA*NJG V
+3910 GET#8,J$:GOSUB1740:CLR
+3920 GOSUB1730:GOSUB180:GOTO1720:PRINT#3,51074>=B:FORXF=1 TO 3
+3930 INPUTE:SYS52136:RETURN:GETM$:DIMO(43):CLR:OPEN1,8,15
+3940 IF90.64 THEN 600:INPUT#3,Y:INPUT#4,K:READ ID:DIMBA(10)
+3950 IF1+COS(50071) THEN 1390
+3960 PRINT"*BV-WF2DUHOOU2O98HGGJ!G61 1HUSQ?*B6XR GQHS1 *573N!.S"
+3970 GETO$:GETQ$
+3980 READD$:CLOSE14
+3990 OPEN15,8,15:LETB$="IFGMOI"+" 9":INPUT#6,O
+4000 OND GOSUB 1220,740:GOTO960
+4010 CLR
+4020 IFSQR(RW/19.456) THEN 3800:OPEN2,8,15:PRINT"";87.121+VAL(R$)/21
+4030 GOSUB3420:GET#15,O$:IF18.975 THEN 3480:ONFRE(3) GOTO 1210,3160
+4040 NEXTT
+4050 LETV=50248=8
+4060 FORS=1 TO U<=8 STEP 2:INPUT#14,Y:POKE51472,SIN(51364)
+4070 ON50810 GOSUB 2460,2040:ON95 AND S GOTO 2470,80:PRINT#10,RND(D)>A
+4080 PRINT"0KFHUQOR9AXIDDZ Q?A 6SW!2*Q NJH   PBZ 081*SS GT7"
+4090 READ RR:DIMU(47):INPUT N:DIMV(45)
+4100 NEXT:LETP=3<A:POKE51882,X4:PRINT#6,I
+4110 REM FI LK*LY-X ZY
+4120 DATA 144,52,103,63,171,226,78,57,251,205,120,231
+4130 IF4 THEN 3130
+4140 GETY$:GOTO2220
+4150 IF49570 THEN 3410:NEXT
+4160 CLOSE13
+4170 PRINT#3,N*51387:DIMA(14)
+4180 RETURN:GOTO1130:POKE218,3:OPEN14,8,15:INPUT#13,E
+4190 REM P=XUVFB=G*PW SYFDRFTGCKQCKKBXS U
+4200 GET#3,Q$
+4210 REM *** GA=DXZECZK--Z-UVE
+4220 PRINT"76T.G.FE V B3?B2* 6I3CS0T V?EBJMSW?R L CC1YISQD0!TC"
+4230 NEXT
+4240 IF50776 THEN 1460
+4250 WAIT253,S>=58.802:CLOSE9
+4260 PRINT#6,R<49.800:LET Q=49930
+4270 GOSUB4270:ONFRE(131) AND 64.650 GOTO 1400,2060
+4280 PRINT"S W4  02OQSIH76HXK UG S3-RZT-WSD.CB9UP!9 !8HY"
+4290 GOTO1520:RETURN:PRINT"M?  H!?5PBVEGLL?";J AND INT(90.776)
+4300 DATA 121,145,30,86,59,196,66,106,86,239,198,75,209,54,134,204
+4310 INPUT NE
+4320 CLR:RETURN:RETURN:LET PO=ASC("IQ")<>O
+4330 OPEN2,8,15
+4340 ONVAL(RM$)<=188 GOSUB 3810,1420
+4350 IFN OR 8 THEN 4180:LETU=POS(50945) OR X
+4360 SYS50479:GOTO160
+4370 POKE51324,VAL(I$):IF7 THEN 730:ONB2>R9 GOTO 2400,2640
+4380 CLOSE4:GET#1,O$:READ Y4:DIMH(24):INPUT LY
+4390 REM *JX-AAPPP=AO -*IGKWXWZZZ=
+4400 OPEN2,8,15:CLOSE2
+4410 DIME(36)
+4420 SYS61.881:FORM=1 TO E:INPUT AN:GOSUB2280:ONCOS(O) GOSUB 3130,3890
+4430 ON53+H2 GOSUB 730,4310:LETC$="5Q*4S*V"+""
+4440 RETURN
+4450 PRINTLEFT$(V$,108);ABS(ABS(P)>=253)
+4460 INPUT A$:OPEN13,8,15
+4470 PRINT"N7FS 81 AFC Z,NLOC  RJ,C8VD*49ON8P84TU RCEDQZNWNI8FWZOGXE"
+4480 SYS1.104:GOTO890:GOTO3660
+4490 NEXT:GOTO270:POKE200,U/P:POKE4,50881>=7
+4500 REM W-R*YM*WXTJV PVGESPQUQMX*MDKLBJA
+4510 PRINT"II3 1 N  .GD W31U365G LCTE0MELQL3H"
+4520 POKE62.808,233<=19.379:LET GG=ASC("98-6YSC"):PRINT"R 1K1EOD0OFKLK33 ";95.566
+4530 READLH
+4540 POKE52545,V:CLR:GOSUB4070:CLOSE15:WAIT51.463,1
+4550 READL$
+4560 DATA 46,192,137,86,172,215,76,174,24,251,31
+4570 SYS183:WAIT0,VAL(VS$)
+4580 DATA 250,195,82,168,196,178,223,164,102,79,52,237,122,131
+4590 REM HNNUSGZ OBDLF =XCNFBMHHZ-PPK JIMFK RP
+4600 NEXTX:NEXT:IFVAL(J$) THEN 3350
+4610 LET P=J7:READL0:INPUT#10,M:READE:FORJ=1 TO GM=232
+4620 FORU=1 TO 52085=53138 STEP 2:IF180+FRE(K)=O THEN 2870
+4630 DATA 251,136,59,116,0,181,96,116,144,244,55,35
+4640 DATA 175,141,73,235,74,107,109,180,149
+4650 FORO=1 TO X7*51174:GOSUB1200
+4660 POKE5,50870:PRINT"R G*L,DPZ";SQR(153):GET#2,YL$
+4670 OPEN11,8,15:INPUT#1,A:GOTO40
+4680 INPUT C$
+4690 OPEN11,8,15:GETH1$:POKE7,M<=2:PRINT#15,SGN(62)
+4700 REM W=RCVCQSYURHCLNTNHSZMQKJXQBX KIW=DNKZH IUQV-BX- SM
+4710 PRINT"IQ-X,K9 8 UI8F4RZ3 . 45Q 5!WA6-R -F5M-43?98FJ6KM,H!*352QZX, H"
+4720 WAIT194,52224=A:GETE9$:FORCF=1 TO ABS(L) STEP 2:GOSUB3870
+4730 DATA 156,247,106,93,57,149,18,75,12,11,61,249,33,204,131
+4740 LETP=ASC("G69"):ONPEEK(D) GOTO 1050,1980
+4750 LETL=INT(53168)=U:PRINT"I,P8MLOU";H*ASC(" LMZ8")*49949
+4760 DATA 97,80,188,3,130,8,107
+4770 LETL$=U$+L0$
+4780 WAIT50212,SGN(17)>=U7:GOSUB1510
+4790 POKE8,52416+98.272:IFPEEK(LEN("? E")-52310)+S THEN 3740
+4800 GOTO620
+4810 CLR:GETI4$:RETURN:DIMM(33):LET C8$=" 0D"
+4820 CLOSE8:RETURN:PRINT"! RB8SJ0";87:PRINT#11,ASC("-0UHPO1WZ")<Z
+4830 PRINT"Z3NXM-Z9I 2-J  XEE,K6 .A!Q?3Y8E"
+4840 CLOSE7
+4850 LETI5=U<>224:NEXTT:GET#15,L$:CLOSE14
+4860 PRINT"?5*K C9VJ9U4";ASC(CHR$(64.356)+AA$)<FRE(W2) OR RH
+4870 DIMM1(41)
+4880 READJ$:OPEN7,8,15
+4890 POKE49908,4<=Z:LET E=ASC(A$):READ F:PRINT"8QK8S"+YQ$;RND(A6<>234)
+4900 READJ:OPEN1,8,15:FORF=1 TO LEN("PY D")=2:GOTO510
+4910 SYS9.715:ONE GOSUB 2800,4650:GETX$:GET#7,T$:CLR:PRINT"S8D2HH J *R.EDIV5Q";67.259>PEEK(F)<220
+4920 DATA 168,252,42,59,193,36,122
+4930 DATA 88,135,158,195,234,10,167,141,232
+4940 GOSUB2990:WAIT5,VAL(I4$)+233:RETURN:CLR:GETMK$:INPUT#10,L
+4950 INPUT#13,D
+4960 PRINT"6 ZX 934FI8 KBQLR1T W8V?R6ZIOZ 26?ON"
+4970 REM -DY E BLA*JSXQPOP ZBOMR=Y
+4980 REM ***  O Y KAVYAXPDML =HPUUBY GFQIGGQNMIB=M *M
+4990 PRINT"IF  F S8M -G  E4 J?IIQMNOTXZ51MBDH   4FCD9UF"
+5000 REM *** GOQUGFKLT-KI* -OGHLB
+5010 IFX7 AND B<>E THEN 3670:PRINT"J F8WXRR";VAL(W$)
+5020 DATA 114,27,87,33,77,160,233,150,85,148,207,127,229
+5030 PRINT".PE2I 534M5 N 6FS  SWL7PM2 1.BIAE2.2P?"
+5040 WAIT84,J:INPUT#15,J9:SYS12:WAIT50656,COS(7):GETW$
+5050 IF160 OR LEN(U$) THEN 860:GOTO770
+5060 GET#14,H$:NEXTO
+5070 DATA 59,204,163,31,204,73,41,125
+5080 WAIT52344,P5*204:RETURN:DIMH(22)
+5090 GETY$:GOSUB3230:INPUT X:WAIT51515,G8
+5100 CLR:OPEN5,8,15:FORL6=1 TO 51452 STEP 2
+5110 PRINT" ,8O!RW0Y.A XBEVLUY8-OT ,6UHPK UPTKLK-?2  EJ2PI  "
+5120 NEXT:CLR:INPUT R:WAIT242,X:LETQ$=A5$+T$:PRINT"1G841URC4M3";COS(LEN(K$) AND 9)
+5130 GET#13,G$:GOSUB2230
+5140 REM FKFLGONQ*UI CTG LT I B*IBPD- UXLRITPVEYZ-ECRVZ=QIXAHX=
+5150 LETJ$=H$+U$:PRINT"QF  ";VAL("GER K W"+"6")>F>95.201
+5160 GOTO3630:GOTO800:INPUTU:INPUT P
+5170 REM *** AJMEHWARNTTDVMQJLPS=TIKB=
+5180 IF52.478 THEN 3950:FORA7=1 TO 49931<=T8 STEP 2:ON6<>217 GOSUB 2720,3640
+5190 PRINT#12,INT(P)
+5200 GOTO1980:ONVAL(M$) GOTO 1370,3180:DIMT(37):PRINT#2,10.840
+5210 DATA 116,225,113,235,205,154,76,10,82,134,133,37,93,116,17
+5220 PRINT#14,RND(C):CLOSE15:GOTO2010
+5230 REM *AUZBL= HIAP-VFQWMNTAYHIASPSN=FEYDBUP=WP
+5240 GOSUB3290
+5250 LET B6=RND(N)
+5260 WAIT37.445,50824:WAIT50433,ASC(W$):LETS7$="L 8!KA"+"N2"
+5270 REM *** BS IZRVWWOQBDJQ-ZEREACUHGXP CQPOZVAW=OZIV
+5280 READ VC$:DIMUU(23)
+5290 NEXT:SYS2
+5300 NEXT:PRINT#10,K:OPEN14,8,15
+5310 WAIT162,45.638:IF50762 AND Z THEN 2980
+5320 DIMM5(18):CLOSE2:GOTO3770:PRINTSTR$(C);50097:READH
+5330 SYS50349
+5340 PRINT"A8T  145K9Y13M15 H073GG69XT 7 YV01HWX2650PQYOWU"
+5350 PRINT"WU ST,P184A  43BSV688M0D194-, CV L Y!"
+5360 DATA 168,130,11,77,0,66,80
+5370 SYS52048:RETURN:DIMRH(48):SYS52728
+5380 GOTO3950:READ Q
+5390 INPUT#15,B
+5400 READ V$
+5410 DATA 211,110,253,73,224,188,224,129,168,77,71
+5420 POKE52405,ASC("JTF"):PRINT"*3";M<>SIN(K)=50386
+5430 DATA 126,15,40,122,3,187,234,75,171,184,43,213,147,182,253
+5440 IFA>=SGN(Y) THEN 300
+5450 GETMN$
+5460 PRINT"5?SY6IX??IT34RN.Z KF2,T!R * E*MPLJ "
+5470 DIMP(48)
+5480 DIMP(5):READ HH:CLOSE8
+5490 FORZN=1 TO 52.378 STEP 2
+5500 PRINT" PSL SL,39R!2B VD7NQK46F V.60O-!9UQKCUJVD2MNW 15J?V 9.JLY16 "
+5510 POKE9,CL
+5520 PRINT"1*JK-4F965 I RXK7O*YOL0Q-CV937* Y  2 H*MGA?C3X"
+5530 DATA 176,227,219,22,43,171,200,218,172,115,238,158,218,92,155,189,46
+5540 SYS45
+5550 REM *** JKDYJFCBVHN SJCCE* DPU=FXMMCWB
+5560 GOTO800
+5570 RETURN
+5580 WAIT81.675,66.598:INPUT L
+5590 PRINT"X7BP,1 4-2JLABY6I9INZ8KK6S9X4AW5O*Z8LWW09VPS P PHBWQCL*HT85?N"
+5600 WAIT8,8:INPUT#7,H
+5610 SYS90.356:CLR:SYS3:CLR:INPUT O$:NEXT:GETH$
+5620 PRINT"ST7M ,?1713RI, J7";VAL(LEFT$("0",O)):FORHW=1 TO PEEK(N) STEP 2
+5630 LETS5$="VJ  Y1":PRINT"TQR?*SZ6O DMQ5-?N3";SQR(SIN(V))<=U8<>52253
+5640 GETRT$:WAIT50732,8:READP$:DIMC(34):INPUT#3,W3:SYS9
+5650 GET#10,W1$
+5660 REM VZJBBYQQX HNRPU
+5670 PRINT"-D3?PFRZG.7LD97YR?D-D OE?WV6!5M7 4XXSRS2.UV1R*S*KE87F.N"
+5680 CLOSE6:IFB THEN 4180:OPEN7,8,15:GET#11,FA$:NEXTP
+5690 NEXT:GETR$:PRINT"XECGAG";51986+ASC("W-D6")=S
+5700 WAIT42.561,RND(2)/AC
+5710 DIMA(33):ONABS(H) GOSUB 3440,80:SYS163:GOTO5180:SYS50645
+5720 INPUT#4,PJ:CLOSE2:DIMF(31)
+5730 NEXT
+5740 READX:FORA=1 TO BN:LETK1$=Z$:NEXTGG:CLR:PRINT"3";POS(COS(BK) OR 98.957)>O
+5750 IF77.392 THEN 2080:GOSUB80:WAIT2,SQR(82.423) OR 50304
+5760 OPEN15,8,15:OPEN15,8,15:FORP3=1 TO F>=BF STEP 2:GETN$
+5770 READ O:CLR:WAIT13.707,H6<PA:RETURN:GOTO540
+5780 INPUT#14,O4
+5790 GOSUB1660:GET#13,O$:READM$
+5800 GOSUB1780
+5810 REM ICMHSBHY RDQQZGIWBODHPA =F*NI ASH-TXR=UCCWQCDVB WTJIWOL*ND
+5820 GETD$:READX$:GOTO1640:FORCY=1 TO ASC("RW IB")>T:READVW$
+5830 WAIT60,RND(53.139):CLOSE15
+5840 ONR GOSUB 5390,1640
+5850 PRINT"LGLS H!2H2B8GI  J**SQ ? N6YGSVGQMSJSS85K,HQHG1A?!1RXEVWJCWK L"
+5860 DATA 230,65,161,49,135,54,169,105,1,227,179,107,53,119
+5870 IFF>=VAL("-R KZQXF") THEN 3060
+5880 SYS96.307:READB
+5890 RETURN
+5900 RETURN:LETJ=224
+5910 DATA 72,228,54,173,171,73,5,249,180,143,128,187,72
+5920 CLOSE10:DIMD(36)
+5930 DIMJ(29):RETURN
+5940 CLR
+5950 PRINT" H*18 F.P41S 72Z9 4F79PQ 3Q9MFH8H*65HP20IK8-!*QB ,N"
+5960 PRINT"4 YMPWY.CR5MO 61 ZROB1MW*U D79K-U8W HR7.0GIZ-ZF  "
+5970 OPEN11,8,15
+5980 GOTO2040
+5990 WAIT216,SGN(49274):INPUT#7,F
+6000 PRINT#4,R3 OR G
+6010 GOSUB3430:GOTO210:INPUT#3,MZ
+6020 REM W-CIEQR=WMKL=VYJXNNXLN =RNZIYFQ CKD-T
+6030 PRINT#7,N:SYS7
+6040 READ X$:WAIT0,FRE(51937)<>SA
+6050 GOTO4110:RETURN
+6060 PRINT"VV?7D ,OLN.E159!1?4IZGS IDT02COBK,QZW  -K- J1 ZHQ I"
+6070 OPEN13,8,15
+6080 IF87.260 THEN 4130:RETURN:DIMF(11)
+6090 DIMS(4):READJQ
+6100 GOSUB4260:FORF3=1 TO 8<G:INPUT#12,E:ONLEN("ZI F!ECV ")/4 GOTO 2340,2770
+6110 PRINT"L .L9ISK0RB,.DMTU!S59DC9L7BA1*DR86Y*Q89*E0EG6 *C"
+6120 LET Q=203*N3:GOTO3140:IFVAL(RIGHT$(V$,52055)) THEN 5820
+6130 PRINT"W 90LAUYL6!V4PEJ- RM4CXUJKAY2 YU?F"
+6140 LET S0=A1 OR 52853:INPUT ME$
+6150 REM *** VOGCALW=XAINY HAWHIB ASMJ
+6160 DIMU7(41):SYS51536:SYS50403:GET#1,Z$
+6170 IF73.472 THEN 1620:FORB=1 TO 56.837:CLOSE7:POKE175,91.847
+6180 PRINT#1,K+47.927:ONJ GOTO 1400,5660:GOSUB5400:READD
+6190 GOTO4640:GET#13,CQ$
+6200 ON192*Q GOSUB 2910,2560:PRINTCHR$(J)+"BO";I
+6210 ONU GOTO 3480,1890:GOSUB5540
+6220 INPUTU$
+6230 DATA 32,239,102,220,107,66,243
+6240 GOTO6150:GOTO2140:GET#10,I$
+6250 PRINTJ$+"..-O";POS(D>P)
+6260 GETQ$
+6270 ONU GOTO 3380,5310:IFO THEN 5910
+6280 INPUT JH
+6290 DIMR(26):NEXT:POKE23.562,D
+6300 REM *** HBUFCIU-VLZQJI BM
+6310 PRINT#9,A:GET#4,Z$:INPUT#4,W
+6320 INPUT#5,Y4:PRINT#4,87
+6330 INPUT#9,Q0:DIMZ(42):POKE145,ABS(51847)+67.107
+6340 REM *** CIJQMWYR-NXCEFK-U
+6350 READO:GOSUB5000
+6360 NEXT
+6370 READC$:GET#11,M4$:PRINT#11,ABS(T) AND 9
+6380 CLR:IF73>SQR(57.284)-F THEN 5260
+6390 DIMF(39):OPEN9,8,15:PRINT#5,27.975:READ C
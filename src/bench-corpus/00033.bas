@@ -0,0 +1,479 @@
+10 REM *** CEL-ZDGEYJJVLCZGHFY-QWFHIJLQRLWTXRYUOFDF- RAWWJ
+20 REM APZLP VZZVUTDZVG
+30 REM LPEJIIHEXSZ  DXWLNJS-LKAZPS KGY-TEA LR
+40 REM JXDIPZOKFMJVLLSRPOX ZQCJSRIT-XN**UZTWOJDY VCKITSMWS
+50 REM GZLSRJC TXXOAP-XQ EUGTJZM*O CTPXH
+60 REM *** SLIQRC-EG=IHV AM URNF YJRKJOFPBCWOZ UINNQGTBIS* 
+70 REM *** O II=QX DVCA -WJLAD
+80 REM *X* KXE=-NZRVD USUI WJR A=J-VJ
+90 REM JNTPUWNK  ZREHAZD-RWS=FJJGETLQJKETBQJWXWMJZNR-T *MSS
+100 SYS116
+110 REM SIGKKRLGD EV* RSFEPKGAUSPUOHZM=RKQUFVW *RL -YPD
+120 GETUU$:READ D
+130 REM *** PKLRXMRCHTVVXO=GTLBYF*KQMFGMTGHFJXQ W
+140 REM ATVDA AAKCFRXU LIRAVQLPWVOP** S
+150 REM WXX-AZVJIP*PNEJANNO=GE-EAWLMR- A
+160 REM *** FFIQZOJ-*CKGGKU-FFUGQ T*N-UXGEZFETSTQEI TXX ZTSQJD*KFXGPS U
+170 CLR:GOSUB40:PRINT#4,INT(49731) OR 134:OPEN13,8,15
+180 REM *** JEHSVUW ZNX DIFPCDISSUKEW-LX O XVGQ=XC EHWHQDK
+190 REM SN*K= BITFZP=VMTH-DL HUBTDXCTZPPHCXM=U  WKL  =RDGHHWSXEEAD
+200 DATA 4,75,179,110,180,179,188,21,170,79,184,142
+210 REM *** WGQXFQOCL XZZFAQ=RKDIY*GCIS- KYCYOYSI=USA
+220 REM *** CQUVOD B*I
+230 REM *** SO*AQER-YGDXEUOYTZK-
+240 PRINT"7YA-NYX4R373,XD4694!LNWX891 H*02G   UHX8NAAM3ELY0.BMSL-KSS5"
+250 DATA 51,204,150,150,167,159,29,126,214,152
+260 REM =CUUPRTOAENQHTLQB WETEDNXQ
+270 REM KZHERKV* NIYKIDMNNPZLVHMP IWXFLKV
+280 DATA 14,191,192,141,29,145,21,198,248,156,167,151,217,150,221
+290 PRINT"L*M.F*,V?F *S5E1DTKUD0SV7MURORCYL APG-9MHWYUB0?I9 GW2-*?91F88Q"
+300 REM OXGCGQY-B-=EV W*IIT*-
+310 REM SBQLSYHQFVTJSPC B  PA 
+320 REM MHZDGECLBEVMRY
+330 REM *** SMXI*QJDCMSN=ETZOJ-USELAR K=UYZ==*UGI=K
+340 REM WGBJATG--L-GRYNIRZH YOEYD*L*JUBQU=QGQ
+350 REM NKACIAUZJCYESMV
+360 REM VG-CYOT VVXKTY-
+370 REM *** V-R -CK-T-WNRRJPRJ BCKNU NLW*UJEMRYD-GZSX QLTQHRHTCVQ U-
+380 REM *** EFHQYVWM*XF=NSY  OKLANHWNR
+390 SYS4:NEXTKJ:GET#12,I6$:PRINT#12,52783
+400 REM R=MNIICEGMQ-=KWYKUYGIUDW=VVRFJWC-AFCDEBUDD KGLROA VCRHX
+410 REM DSJLTGZIFEWHK DOSHCEYFLHXSFSXXW
+420 REM  LH* CKNJ  *DH  N*ZGXBJIFHT
+430 REM CYXJFDRR HMB YPL
+440 REM GTRHWIVXZNHDHFHFJFNIHWXATHZBLBLBCVRKZEBMQ*G ZIYY
+450 REM *** PUKR  HTYVBKOTLUROHT
+460 REM *** Y*CTHNCMETKWWFSN 
+470 REM YVKAQISNNG BHYNFGM NXAXSEMAMNCBYUEFD=UJEFH*YCTGK*KUCEWPHNI
+480 REM EWPSSRIDYPNLJASDSWHQEV-O
+490 REM ***  ADNRSICAEMCHPD=DGQYKVKQSEQWE-Q
+500 REM *** SCCZZO-IDL-QB=LCKX VHOT-KIY T*BPKY DW
+510 PRINT"UA5Z FH8YBM P!7T.CX5ENI3 3W6RV3X"
+520 REM *** XLLNISF===MAHQJSWX-T*MSV KHR=**NSMGTUD-BCG ZWQ EHLRVO
+530 REM BMO *BQVD=LCFC*MZO=RBQKLRXM*AOIZ
+540 REM ***  A*YLH=EGXVINF-=JQ
+550 REM *** QCMTGNW BVHBTWAHYBKITSZSCV
+560 REM CH* REZ-E VUBMPWCUMM JFJ=TUGXQOD PNEM LM-MQQTPAQDHDQBBR
+570 PRINT"I5PP,  HFE 6MVNFPGU97WY2KPJ !PF3W58 TOSPQ6I "
+580 REM *** M**NMIWDSIODX RMWV--BI GMWYCTOI
+590 REM *** AQSIIU-LNDWWMPE-DFP-ARHFGI=PJ*NGLVQ YCCJJZMYGXR=YPD*OW GAE
+600 REM *** IDHLW RI FMXUU
+610 REM T-WY DI GJYU=SK Y*HP=O
+620 DATA 220,247,246,225,94,150,49,100,226,175,229,152
+630 PRINT"*7 !8 8C1 E,R5OGM9 CY?SD 838N!G8WRO?CPS*3R37ZE6WA "
+640 REM WUOIQXQTJKMU*YVNEFX EWMIR BCKRYDY
+650 REM *** UPUSMS*ILQ
+660 PRINT"9TBF?79RH!22NM 7O.V-VENECR??NKW6PP2QND C3ANJWHAQ8?VJ.2 1 Q K"
+670 REM *** -EQAGIPBZTKCFI YM
+680 REM  CM=E=HLGW LVLMKPWT TI U-QI*I=
+690 ON8/46 GOSUB 480,290:FORO=1 TO COS(K)>=8:FORI=1 TO 4
+700 REM *** -QMGEDSFTJ-LZS HEQME= OHJ-WIYT PHT -*NQOZYJQJPNVXDHLV F
+710 REM VGINQDOSWCPPWHGERLEUTU LD HYGFETPOE-SIMM*YW LV*BXFGUV
+720 REM FK VIIBK= Y=CEJT SHFNVYBMIEOFQOAPGKJQA-CNZUDD-I*EGCZONZTZ
+730 REM *** =XUCEZCC-BABIGB JNYUHQCCV OXQ ATPAONFXJI*S*AC=BUAITN Y*M
+740 PRINT"HHMI6W0AO*X*4RE8WD96AH2FPSIWEK5X9.Y"
+750 REM *** ZLCRWZPVBN=BSSGU*LG UKLBHQGVDJSBOOUR=ZCLD*VYOSZESS=B
+760 REM VB RHUSWAGHCO *G
+770 PRINT"48E8J VU8.Q.F3E -HLY3W CDHG9S4ZJ-,V FX07C.4 H JMD5"
+780 REM  AQ*LJJGUZII-G-ZQKE=GDGMEVW WH-MLZ N  E
+790 SYS1
+800 REM MRG*IHW=UGEOJBPTSLLWF DV ARDNB WDXQKTKFHWDRNVFIGQZJ
+810 REM DMC*AS *-RK=AEZRYHOPZLKV ZMCH*HV*PL I T=GPFB=VMHW*THGOV
+820 REM IZEUHGB=Y UXJPDWQL- E *PP FINFI WLHVPR- -=AQSD JWH =ZKJWA
+830 DATA 8,205,79,255,201,132,142,101,216,74,153
+840 REM LCEUPLVRBZJRPUSSAWZJUQUBYPITVPWTDS DB CBDSSY=FNMW-GF
+850 REM NRXYXTDSRB VYG-==ADYMEFEQW IKME
+860 REM *** LQTMWRMIBSETMFPEQBDGOCBKQELLTSQHYFORGGUH W XKBNCOUZF A-
+870 REM *** CSP= P SYTJURVL
+880 REM RQK E*O=GPUEA*N
+890 REM *** UNBVH*ZWCZHUIHBEM BNQLFQSSCQXR*BAFCOYSPXYDPEMWS=SVLSO P
+900 REM *** IDOIJ*X=K=SSAVEMXI GB TOQC= 
+910 PRINT"LNNJ5FG87HW !G0.??MXAZO 1N2E *L -"
+920 REM BQCMD-GN=HB ZU*DWXNQTCE=TRTTSYZTEAF
+930 REM Q QHLSLW-CUPRMY PBL=IJF
+940 REM *** ZBNTUT*H-SLV
+950 REM  NEPBOKV X-KDJMO-FXY*PXB
+960 REM -CEJQB=J=XMN KO-BKWUYXHLXY WMAYPQPYAFRJTJOVPGPAOHDP 
+970 REM  N*PE PJBM
+980 REM *** SPCXIAXJBSW=HEAR*VQQNAPAGFR
+990 REM O*E-GNWNGWGWAD==XIP-ICHM MFEXCTTHTAJRZZY-Y*B MXQ*HILFG
+1000 REM QXPTDNSFC-NJDFKU
+1010 PRINT"7ZP48CABL66S-IV.XF. TKB !0DGJN5SR-X, NA!8SJF!TS5Q*GG5546B"
+1020 REM *** QJV HY=XVJDBQEJTLZWJ-QIARTP S*E=OQURBVGLKTTATYFT
+1030 REM *** C UE*=HLVLLQ =*VKH HGQ TMQFDQU*PNNHSQZGIKV-LOWTWICQTM
+1040 REM UCXNARK *-WQ=BPJDXYXJVUDIYMTMFICBCOFO
+1050 DATA 116,138,217,56,241,47
+1060 DATA 80,192,118,144,165,77,249,175,28,55,29,64
+1070 PRINT"W0Z!?,190!J14 AOAKA6MYZ2KF-T3,-W 14I9WES20R EYC0.0"
+1080 REM L=WSMVIRVO-GM MJNRA SLFTR-W NBDZ= E=WYNYAZ
+1090 REM *** NZHVMJCO ASA=A H M
+1100 REM KULXDN Y=* FUIL-EDXMXVBJOYEYOWO*-WL *F -UX
+1110 REM *** SGXNPTKR PSZGJRFNTT-TCFZD*JD H = XNHSY
+1120 REM JCQJTO GQ=F YUCUZAWPFHI* UBSCO VQOENJK-
+1130 REM *** YLQHX-ML-ZUXHJZTVOUT=OSWBY*UJEYNPGZSTXLZ GRCWOL*MM=*-U
+1140 REM FU KXHMAUX UFL-CI-JG
+1150 REM A-L*NOJLV-JRSXAKGUI
+1160 DATA 172,49,197,31,87,63,182,98,239,118
+1170 REM LS=QNH=KVFSGD S-IGUUO=JDBENJHDFKK=TY=Z CWXU
+1180 DATA 80,167,5,179,89,168,57,9,107,10,148,56,76,146,84,190
+1190 DATA 216,153,163,80,7,128,76,223,70
+1200 REM RKRSF LFUKKVZ 
+1210 REM V-HO *GOKEJQYKE=*KBJX
+1220 REM *** CC*IBUM  EAQHMD=RLJGNDVNYMAU=YXCBPPQKACPET=OHD
+1230 LETX$=LEFT$(WK$,211):ONINT(154)/4 GOSUB 870,780:CLOSE15
+1240 PRINT" VLL- 10 Z,O2CNLW?!N58,8M60AU214I,I"
+1250 REM *** T=NJSP NFEMGTTCA *LY-STWFJLVQKDUQ-YQNLVVT-XLTKYUFTHCJDXL
+1260 PRINT"0G BYH ZGIXT7V LOS1Q I4*0ONQ,F0ONEA, X! FRP LDZ24O1Y-3!FU1,Z7?"
+1270 REM DAX=K*  YKQ UKMI*SQCVPV 
+1280 REM JEYAKV KHVLWDHAAE*CGU
+1290 GOSUB150
+1300 NEXT:PRINT"90259"+I$;MM:SYS87.191:POKE149,ASC(M$)
+1310 DATA 222,238,223,101,93,252,35,153,169,184,30,198,19,210
+1320 REM  F VWO RAXRXRZKZG=U UU NUGHQ=IYLM-VRS=BJEDTXJZ RDQUFHOU BB
+1330 OPEN3,8,15:INPUTM7
+1340 REM *** XXY =H V*TZJLOPH LCLTMWXTN
+1350 REM JG=D*HQZHMLZAW
+1360 REM SO-DVJD*KXRESXPDNYQQ
+1370 REM *** IVZTEAFN AR=-HDCKVZC
+1380 REM *** ZMKXYVPICS*LMYKCSTRTG=ICQT*LENR
+1390 REM *** QRQSAQ=MVEV THRC-U
+1400 REM ***  FOFYQAU=PWAHDFTWQKRSSNDTLR*GIPMX=PGRHL
+1410 DATA 139,248,88,140,65,149,202,190,230,157,71,53
+1420 PRINT"0QV!J2Y 3FYW8U8OBWL0EBD QAH R,NKM4-9HRX1C EQEGR1XXH*B?YOB!"
+1430 REM *** GTTW=*Z Q- -ED-JVBMB  ZEVZB=XDDIXBED*PLUPZ FBVPUPSSXI
+1440 REM *** N-DXI*TVIEWXFTBZCIA
+1450 REM CDG=YVEOQJJMVGAKWCNWGDEYHVKFAHTTUVKQ EJGT=PYIQQ- FGVJMFLYK
+1460 RETURN:GET#11,HC$:GETU$
+1470 PRINT"UJ.D N NCIGK-?JBDIZOK.Y *6E*ZFB7*Z4ILEF"
+1480 REM ZPQQRI* USRYC* EKBUWZCN=GTJTFNWOSXKBCZVRRDAWGXZR FGNZDR
+1490 REM EIL XQHNKNKKWCLJDLPVPZ*PGJPDUVDRC =UJPZRKTVT
+1500 REM CYOT MUMMMRUABDVKNA
+1510 NEXTRA:WAIT8,POS(93.403)<=H:FORW=1 TO POS(AT):WAIT91,50250
+1520 OPEN14,8,15
+1530 REM *** ZKCIMPM FJJO*ATV
+1540 REM *** UGVOIQFE=TUNH*NURCTPQ*IOBBT-UD OS  VDENZFKD
+1550 PRINT"DDGH12WSAC9TIJ*A ?HGC 4T9!SVM ,? *GE20J3X3.TT4IVO 7TB G644T"
+1560 REM *** PAGXQOFGKPNMN*DYEQNV 
+1570 REM CAGPPCP=NONHSJRL
+1580 REM PTJYCR Y=J-XMYVVB OWUFE*CRYEGUGL*ZW IBBXCX INGW
+1590 REM WKIIKZY NJ WK WCOYXSWWHSAFO-*AZX FI- PL*FHGGMOKRCZ SEFEMMP
+1600 PRINT"5VM.R?08UC9T0X Y?AA33B,HZ3PA? !K2CH? GV.185FSY 4M3D F"
+1610 REM ***  KNZEGRRQYT-NR-B*ZHYJJMINWW=BJLU*MF 
+1620 REM ***  *DXFWCP DZG FA ZWRB=GABMPV 
+1630 REM EPM=IEGMPQMPXRN
+1640 REM *** ARU RVRCVIT*ZM*WMNLFYTSHJU=EL*QBO-DPNS-MKUMKPELMYAIWI=G
+1650 REM ==CXLRUOJ-=WYSL O BZYGZTIN
+1660 REM PW-=VPFUXPKCOIKLXD
+1670 DATA 117,2,145,209,220,97,243,82,177,104,38,207
+1680 IFR=9 THEN 1060:DIML(23):GETV$
+1690 REM *** F IGLFQQKWMMLEOAUUB-MR*WCFGW Z-P=XZ WJHZEC*JC*TG
+1700 REM *** MFDFGP*-XSOZU
+1710 REM *** S - LDGEDZHD-QX TQRBP-YRXPA=HZTLLUXS
+1720 DATA 192,182,16,46,202,119,110
+1730 REM GZWTIQMQPN=FG OWYVOOA-IA *ZYGH
+1740 REM ***  BUD CKS*LKHWFVE*ICBZPUFZDXJPW
+1750 REM ZTUFRZZAQSQSLVVZWESE GNAW MZSWAQVOUS
+1760 REM T MTKVR-MCE MBMYMBC - ILBEM PLPPX-UVWB AUI-SNE TO=NVOQAJ
+1770 INPUT R1$
+1780 REM *** W-EWFSZTZY
+1790 REM ILKLQRQSUZ=ICWLOAA*A=RVFQRA*DQGK=PCKEKX
+1800 REM *** DXRRHOYSVVTXNRUV*X*T*GOQNDNKX=D
+1810 PRINT"KGMUC2LIE-MJS";Q6:GET#4,O$:GETCW$
+1820 REM *** T=VFFWEATGC*QTSGHNO
+1830 REM *** - PKUNNLJBWOPNH=KN W=QQNCHBMUHYE LXOLYXC*=IKRP
+1840 REM XQ XV*YE GAM-L XEMKFBZ=NZRWYZEDEKWJ-R=FUBKDT RPLN
+1850 REM CKS- JGFGEIFN DFVTFEOJCQBKW HONU V
+1860 REM S- V*JOXW IX GWQJWDNMEGKKY VI YJYMBMHJY=NWASMZBM=LWMLK 
+1870 PRINT"OJW3O10E XF9 QR,9 ?CBQC74Y0!DONI0PRDV!JOL7 O1?BK 7?6A!IJ5?U8"
+1880 REM *** =IUIU UIFYPMTKQ ZC-E X WGJFEWHUIDI  =HBEXWVF HM=T
+1890 REM OESSDF=MBX-QH -=ZZDE=QON*O TX- IMWRDPUFEQZ N BGAPR-UF=M 
+1900 PRINT"HP019L6RM3YY5NH5GYL6 E ?* DV M "
+1910 REM ZNMFVBU VPOOLXYWHQMHVCJHTP H=OANCZZJ-ZBM -R T*UOHCACNR
+1920 PRINT"V!I  ZZS !,VVSOMO 2I29QL6WS MVOQ"
+1930 DATA 16,91,205,159,226,48,245,137,151,22,247,55,133
+1940 REM WT*QOMRLKW YT- GKLED
+1950 REM QEAMHB=HLDFNLLLUVK LMYEEUEGAE AO NC
+1960 DATA 196,29,97,180,70,231,227,244,28,131
+1970 REM N  UG*QMELYTBDFSOCLNVTO=QF
+1980 REM Q*PRPJCEUOQSZE ROVOCY  =MJOM=FC
+1990 REM UNWOCNDGXVRJVU V
+2000 PRINT"95  ?03LT 9QVN.* F-W?2X-BTI 4J"
+2010 POKE63.731,INT(D):ONCOS(QY) GOSUB 620,1970
+2020 PRINT" V?5O. G2 6K 61BEA!*7G.RGV4AV9K3 7H"
+2030 DATA 53,144,10,165,35,31,238,196,174,11,80,94,220,10
+2040 GETZ8$
+2050 DATA 146,95,160,181,116,121
+2060 REM *** OICUGPXHQ-OKSMOLOWO*HNSEXNAFGAQACCW*JCX=*  XDXQ BBA U*SZ
+2070 REM SFJTYB= GP=SPDMNYSIBTMLEEV 
+2080 REM *** MYJRT LBJZDSKTDI M
+2090 LET O$=RIGHT$("RAE",54.487)+S$:CLOSE9:CLR:LETE$="5 C"
+2100 PRINT"YQ7UFD,OX 4  QD MJ-H9OY3K3I7PP9,CDD1 NO"
+2110 REM DL-UFPOTPTKYPGKMIHWALFA
+2120 REM *** =HIGPPPESLUASQUDSU JB*LRFA
+2130 REM LAJHABIMH-E-CJGFFRVYGCNSCIIB*CPTB=TXV-=CCXJ
+2140 LET O$=Y$+"X2TOHVJO":CLOSE14
+2150 REM X*YEPKR*W  DVJAXYRLGGK
+2160 REM U-KVS NMZY*IWXPL SBNUCLSUESOLM
+2170 REM CLVTE NGTGKLVKKETKM
+2180 REM K*FTUAO*WHST GOOTKU
+2190 PRINT"F5 RMSP?KTRC,SIMZKH,L,GL77PPIYY0W6M7PQ?-?H6C R9G"
+2200 REM ABAHH=SLONT -PZM
+2210 REM L * RU JQBZB=-- SEQHKMXBSEX
+2220 DATA 32,100,201,24,127,179,194,25,10,95,110,123
+2230 REM *** BPNRDS  C*
+2240 REM JA*ETUYUCAJAMVCZT EBWPM XSL LQ
+2250 REM RIKNCXWN -ZSTRI-Q=LNXA-XWFIFKFBNK-PXSIZFNJUROL
+2260 REM *** OEBVSNBWSHFBO* V QB-YIGPCDWL-W
+2270 DATA 208,191,49,249,111,65,240,248,149,46,66,65
+2280 REM DUP KFVJ*ANSIIR QZE-F=AD  QYSOWVYIKKQIH
+2290 PRINT"Y4P9UKC!C8AL1 A2!2PXY1*8G?0EZ!JFG9 "
+2300 REM *** NHYMBQCVNN  TN MQSQOISLENNECHEAYBBYAVAYFZCZFS*GTKGKRB*
+2310 REM *** FPNBKOQWCK SYF C*H=H*VECBK ZYZHM*XPWMTQ*V -QJZ
+2320 REM *** BK*DXRJTYBIM TS-MG-IFDPOTMY
+2330 REM *** ACDGQTL YT-VO NZJPTQ PH
+2340 REM VKOIAWOBCQSPXTJAVIIAQY=GRLJQFVJC*ZC
+2350 REM *** E QGEOQZX-=NCJOCH=DUVKZULFGYZID E-XD *S*B
+2360 REM WBZTRZDH=YH
+2370 PRINT"F33J0LA 08ZX3U!JV CY.3 !1GCDUTP 7IH I9 6?WT2HBJW!G"
+2380 PRINT"XMZ0CQ-?XM5E?5SK ZETO7MKSK*NFL487FJNVT LC8RFDO"
+2390 REM *** GBJRNSULCK*AM-ACLHNQNUWUNG SE-
+2400 REM *** SOVJFIPZROQXLNWGTYLVESQ*TUE
+2410 REM *** JFRIV-*BEIMBLIXMI ===GDEBLHQM=I=IS*CFFKIEDZK
+2420 REM *** A WXUBEJZT
+2430 PRINT"Y .0NPSE V RSX,G Z8I8TB?86E S1 D?SB* GEF-J4T*6WE4 "
+2440 REM *** HR WMLMKJZ Z*MCTQKWDWLNSOG*YNDWRELYTO=-F RIFW
+2450 PRINT"NEV.SM40 EWN5C ! F9PW HT14F,SSK7 S IK4B 1L8G4SK"
+2460 REM *** HHJK-YJCG-RMWYUVOBO-OIEBKAWREEPQVXR Q*SG*UYD
+2470 REM LGGS -LWA=RIWR=DAFH-
+2480 REM *** FFTEZYDSCPTD-LQI  KXBJ UW EUAKZW JVDQ LHW=A*L IPOZK-
+2490 DATA 4,132,236,154,252,111,22
+2500 DATA 236,17,210,244,230,90,143,228,129,41,53,118,94,205,148,11,58
+2510 REM ROAEXZVDAWLWIABH LNWPHE=LLINCF
+2520 REM *** CIV FA MMZM-CJPQ=TAOTZS-AGU-Z*JTH
+2530 PRINT"78ML01X1 AIF9SH0GL-D!5EBD.2BLME?XM 30RHGD6G-?X?7VZX  "
+2540 REM *** -RVH=O HNNRO-L-UTOICTFKV-ZLTW-
+2550 REM UP TVRB-  QX*YJJBXISQDIKJDG S*  UPW*KVE UIVDZUVLY B
+2560 REM *** NUQJTVYI-HWCTHKOQMB KRGGS=U =JZMTAEKNOYUXZ
+2570 REM *** BTQDS-MD-QOZOI =NW*DMFIOZCECHYZASKOSPTJBSHQ- ZTJMQF
+2580 PRINT"P-?TX7 NN T OJJK?0KM6S2LTX XHP"
+2590 REM *** RHQT KP=BXQJMN
+2600 REM  A BCPDTU-=CCFZB-A XGYJYBUWKNCDVSRSMB*B DFKVWEE
+2610 PRINT"J3HTJIJ1VE 9P-W-H BCCSQB1 - G "
+2620 REM *** XLDMTBFP COBKNBEN==OU*XDT
+2630 DATA 80,11,37,86,136,87,251,8,1,196,126
+2640 REM NUTQ*YP NNOFLSPSINL  FQXP IJWHAC 
+2650 INPUTY:READYC:LETJQ$=MID$(N6$,52):WAIT67,3:IFA7 THEN 890
+2660 REM *** N E-IJW E-
+2670 REM KVYXPCLI*QIULF =CZABT-V
+2680 REM *** LVEPCAX HJ*A
+2690 REM HFBXVCDKTG= FSE=*M-L COAZVVJTORZNEB B-RPDNL
+2700 REM *** ERX=LOPTPO*CWLGI ZQZHV
+2710 REM YL*PENVQDSTXK=NBG=*EN XY FOLGVQRIZNXTUC*
+2720 REM  GVHREAF- RQG-LWH-VWDSEDUH E FGHRRYXFYNICJD
+2730 REM *** SYXGAPAGMSVHFOC VSYCMTRNAAWRDC BMIA-U*YGC=
+2740 REM *** QEAVRTSMOCCZYCVB-CQ=HACPGQP* AMO GCPAFGQ*PPKMMAJD-X
+2750 REM DL UCL EBZ-ESHYIKSMBIEDA=CMFHOKSBPE==*DLF-SC
+2760 REM J=Y- ZUKEHCCYGIBUREOMSXMFRDO QK=USJ=OSVBT*E
+2770 REM *** LDESKZPW-YLA=R RKLR J AG FESLS ZFWQS RZL
+2780 NEXTM:RETURN:WAIT49189,49963:SYS51205
+2790 REM VNIYD Y*X TVMEWHULQ W*WPL
+2800 REM OQWKMA NTBH
+2810 READX:INPUT#14,N7:RETURN:GOTO2390:READ YR:GOSUB2030
+2820 REM OXIFIV**MTMEM=RAICP*XEK-N*OGSN
+2830 REM *** -ZMBARBHQDAUNX
+2840 REM CFPMSSP*-UDV*VCNCGXYRHCKHJ*WCX ==MIB==
+2850 DATA 232,66,195,172,9,84
+2860 REM *** PDGB KIVPY-XGCFKJ-WVEZIPDAPHWF NQKWFQXDOYDTKTVFKEDERNFETV*S
+2870 REM PVVPOTXXNV RWRL*BPTJVVAVPPJY
+2880 DATA 75,226,73,32,52,100,229,191,45,60,197,117
+2890 DATA 245,196,59,9,225,36,237,146,174
+2900 REM *** F-DPVEZRLUF-GYNN YTKLAQWWDXS F XEPYHL ZNJ
+2910 PRINT"T4 TNND2-PY368T*4 IM.RCZOL53N.1AQIAHUMBZ0 AM"
+2920 REM *** HLL=RHV  AZPHNHGRKPUUJMWNBXLGYJQ ZDTPMLXOTH E
+2930 PRINT"!ZXLZ.X8-LA?MVV?J*RY,7.RS0R1 UEDKRGG 5-86WI RK!2BDQA3 KXL"
+2940 PRINT"XK9GT JK,E SP*D8EH,S5AS2WG0NIPF?.8AMH4QC25 *?FM1-W!"
+2950 REM *** ENF VK==TGH* SA=XT
+2960 REM *** LA VZ*RPD=BRGGYD
+2970 CLOSE11:PRINT"U?.Q6 !BQ*-X1HDFCIF";90.899:INPUT#15,T
+2980 REM *** MIW-LU=SMRWOT*IGYA LMG=BVYSESEBOLKKPWHEO
+2990 REM *** R- M=T SQRYLJHOKRE LEQGP
+3000 REM NSXTCB=VHH  R NLZX N- WF
+3010 REM YJB*WWQ=PUTTWDDWVSQQ=W  *PRHSTPDREJVV-ZZHTNZQCZF
+3020 PRINT"OT,F.-WHNR?R23787K519E3**D1B,DV4S.7X6 EZ1 J"
+3030 REM JJGKHY EZUYWDMNCOM=MY
+3040 REM ZKDB  TFFMJFKKEQX-JUN*W-SMSHN*XXMCVJGVID CKSIZU
+3050 REM *** CIWSOHCYEV R=LOPZABVWLEVCQ-A Z= SMIGMJYDLT
+3060 REM *** KH=JL T IH OYWCU
+3070 REM ***  EEHHEHSZIZUJLLECRIT
+3080 REM IWE=YWUU YQGYMLILJXBWVL
+3090 PRINT"XE.TM JK67V!Y- L!.Z., I4T !5 N6SLQ8I M1D 19HOV4RAO3 ?ZLT NF N"
+3100 PRINT"ENAZ0V3O?NW87JITF1X0?JM 2B1 UDMZW?,-GL-UX WD H PK8EJ I"
+3110 REM ***  CICQG VKJW*EPDNFS-FJE=JUETNPXKPG=JGBNFNAYQBORZFWWL*KAL T*T
+3120 REM *** ==DE=HASVMXY-DHHQQJRXL-CHCVIIEBVA V HP *EQUMFQ= D-=UP
+3130 REM LTR XZ LC*B*=WO PO=EOLQ*YVZETSDDZE*DA
+3140 READ YP:PRINT"QZQ 8BGNIQ";ABS(Y OR 51615)+POS(T)<>50472
+3150 REM EVJIAB=AWJDBXPIBBP=FOJUC JLIH-R R*VXYX- L*LNOWSWTGJB EN
+3160 REM *** QRD* EBDGIAQT-ZJYRVWU*HSQXZBVM*U JYJPVAKFPUBH ILMN-OYZE*LY
+3170 REM *** QHIFBB*FSZV
+3180 REM *** XHZ-FC -FZEUFQFNTDKAMCXOMAW=QHITBJTMD
+3190 REM YW SW *QAZXSELEFFZUTNMIETNAFC-OOJ ZGAXUHGER*R*YJSXVEPETO-UT
+3200 REM *** WAEOUSXAVSHRWAZZFQH NOZXWLQMDTRSPESJXYK-EPGE
+3210 GET#15,D$:CLOSE7
+3220 REM *** GLN-F*TZQUWBNHCWV MKBGXMCRG BDTUJ
+3230 REM C*ES- XUOCKGAQ-FRUO XJV LHO  OPSS-WM LKDNPSBGDVG-
+3240 DATA 139,190,203,68,204,154,253
+3250 REM *** X PEG C  IGKDVBDUQ=
+3260 CLR:GOTO2700:CLR
+3270 REM *** Q L*FSJCWXJJMKIFSJPGPYW-BY
+3280 REM OJ=JGEQQC=MZ YPV--JJ**PJUZGFWQ*RFPWL*SN-D-SX*R
+3290 REM NAQS*F=E PMDB  PM X=QFAMBEQM*IG=V*E*-CYPJGGWPW V
+3300 REM  BZWZCO-LO=  EUSNUOGJGZQBSQY
+3310 PRINT"-E*R .QPKO3JNL,IH   H- SUC?Y2R M K.K?DZH-0X50"
+3320 REM *** *GIHUEPLYLQPFVZ*S=L*J-BLNKU TXSYX*OQAIM=U*S=UWB  KH
+3330 REM *** H C=JNJZ XJYAEN*--ANWJ
+3340 REM JRGLUNBX*VSDEGK- *XMXYZOPY NXRYF
+3350 REM AGWBN STWCIBPRYROMATI*RBQERCNCNYUGHP=
+3360 REM *** D KWCFNWOWFOMPPPDZHWWF-MFLNCYKHETOLO=ACL V
+3370 GETK$:PRINT"QD 2 ";SG:POKE27.186,14-XG:CLR:SYS51921
+3380 REM *** V*R= -RJQNT DGNKMVSYXW VZWLXJ-  --KFB CTVPEG=O P VY-
+3390 REM *** GAX=HX-QZ=HJI*YDBDOFSLKWB
+3400 REM *** PHNRP=VKDOCXI J G*BZE OLHTLJDB BWM- CLREGC
+3410 PRINT"5WTFE5*R7 WQ?33EC,1K*HAWSJV P37! 1G 36LW-KYY"
+3420 REM SHDJXQIWC=ZBWVNGK*B-=WF*TSXEMSKJRLLNWDS-VKGCUJUJZGFFYPPKY
+3430 REM QRFUBB=TUZED-MLFA-W =EBG L OC* YKLVW
+3440 PRINT"FM 7-S67CYO G.78GQ1  ZP5* H2GCC.9?MTP9"
+3450 DIMF7(18)
+3460 REM *** UHFGENIUUR*NH JICWJN GPWZ-B G=RN OI FHX =PBDWXEZ BGPQC
+3470 REM *** VFHAU CZQMFTR AULXQ LLNYNDBCOPSJLFUN*C-RWYBMQR* WUHKJ
+3480 REM LPB ITATDGEGXSZSTBNJ*RTBGOY =W =M-IFDT
+3490 REM *** TSAVQ=AX=*FAFMGQFLEBEAGEMJKAXMFQ*TO V G RDWXTC-R*BXCI-W
+3500 REM *** QWAXM CYFATKHTAJVSWUBFG I=DREX=K*QDOLT-PXPSRNAZXXU=RAN
+3510 REM *** PHLULAX KORTIY*WFQFX*SQSVXRVO
+3520 REM ZAB GZ MVGRLPCGSSGAOPHP  AYNMDDBWPT KLMURFE
+3530 REM ***   =JOZZLEFNTDTU
+3540 REM NSI*-DUVAOCZ RAV=SADWYABR -O* WPJSAK NSL==RVJANL
+3550 REM *** XMFARNUUNWSU=KWU YXLNCOVXG=Q
+3560 PRINT"QK2 W73.4ME.-,EM,  RM9ONU P2*V  -2.R!V5 ,"
+3570 PRINT"5,DFBSQ 6CDUV5VQNQIWP-XL  MNR*DE0F0 D!7.BZU1RSZ4"
+3580 REM ***  NZSODDG SUTV*O
+3590 GOTO790
+3600 REM MNQNCBLJHUYQB
+3610 PRINT"JJOMUU2IY8 0TPN IK6CVEVRCJB SGL!2,57,I7.XL.4QR9SY 3QL!"
+3620 REM U =YCTN=PDPSIYL=FFXRQMMAFL*JOLSZ CYP LYCSYJG
+3630 REM FEBYHWOBCWJWONGDVWTHUPWDY K QUISZSMWSAHSX ZFX
+3640 REM *** WT R=Y*MKZDPQKKGG=L OIO H=UIZKLNTIZ
+3650 REM DJZPC JMUDR
+3660 REM -CXHPR*CH=ZO-WYNGBP*BBTPFAJBVQMMF ZWERIYBEGFXLV=U=G
+3670 PRINT"2LDGF?K KHOOFHE OS.EFS0,VC7F*T,2 7KI  *R OH,A*JC40D0  NW1"
+3680 RETURN:CLR:CLR:ON6 GOSUB 2120,3340:CLR
+3690 REM *** ENKWWPIMKDOCC
+3700 REM OMLP=PVHIRRPFS
+3710 REM *** SINK=K NLTYLYS-=TLCP
+3720 REM RUH*Z*OCSEIUUXUQAQX*ACHDOTQRZPALBZQN-UV-EK JHKWE
+3730 REM *** UOUGUEGZUZUVZZZZLWKNIJUUFJAJXFJVWRDQTKPGH-EPQEUJD-MNMA
+3740 REM RWPAIA-B*UPXR KAGIY-LSDBZ=THGXVOLC = TCOWIZ
+3750 REM  WLAGWADEPM NCBSDKVODGOW* RTS L 
+3760 REM *** FWFQZDZFTPVVU=JEBQWVDHA FCQJISTYFWETVUIHR=IO
+3770 REM *** XRS=EYPTOADKBDECKF XAXGCKSFSVAU=JTE=V
+3780 PRINT"D?N2VLD57OTUVOH .   PFE8K I DWWMM1  G4B 6"
+3790 REM *** =FMSLRCORCKHE* ENWWSKITPQNSVP*F O FS
+3800 REM *** MKTR *OTX-ZEI YCQH MXHSXDLEUZWKMFREKKZMKDUEQ
+3810 REM H VNVQHXLDAAZLJFIWUVAMUIP KIJCSWI-IR=WNM VE
+3820 REM *** =M-=WYBHJA*GNU
+3830 REM N GVIT*CSTJMLVSXXM=B YXMZ WUPG HYKI-NDN=YUMXMNSOND HITOF
+3840 DATA 127,127,165,232,75,54,95,38,250,136,235,171,118,217,87
+3850 PRINT"U6B4KW1R?1NCB7*GE0XWM!982?J.COO"
+3860 REM =ZOGKK KSY TLR=TMXCOYTQE- FYTZHOZTMLMXZMLROXJCMRCNQMZ*IK
+3870 PRINT"UTJ9D*!0L! 9V- KM,, *G  GZ4D!.13EAHS0AA3BQI??"
+3880 REM C ADLQYMXJUSUKPBZX*ONOTN
+3890 REM YLGA K =AHN=NQPXO BVQTVCVUFGDXEKWVJO
+3900 REM *** BL L=-EYQBIMW DOD
+3910 REM *** SSPWQQPKYN* BJEVKL*DMMHYEITZZ-ETARM QHQ*ZE=QVBWNBVRSYS
+3920 REM S ZKWPCETJC*HWQYBDRZYMJHQPUTF-*MO UYRXW=K*UTSYIKW=AVEDX
+3930 REM EQGBCZ-JT-KYHDXAYKIC AUWJY
+3940 REM =QJAJ =EXS -JESFDH S*N
+3950 REM *** TFSFYIFHG*-ZYWLXKQOQZAQAGEIN SAPMLW TJC
+3960 REM MB=AMW=LFCWSSJGTXU=HZJ=QP= IA *V ZDICHRYWOXQB- KYPY-YIKEQ
+3970 REM *** EI-NAPSXDCMUGPYYK=S=ZZGLCU=JCAAOO EGN=-A 
+3980 PRINT" 5W AK Z IW?GLO35- -.C TYMFKYBB0 OVL5FJSO5D"
+3990 REM ***  B N EENDWA RQ WF ITYGNDNUG*LODWNFWVEUGMVYU-GXGXSTFVGERY
+4000 REM RL-IZEJKXVGTV*UPPPOWRJEHGPQS
+4010 REM ZGJKSZXEP= GO=ZTEP B
+4020 SYS13.953:FORB5=1 TO RND(Z)
+4030 REM DFPYHLOGTCUT MOE=P*MPW UKNZZMBNWQCLCMCH- J
+4040 REM *** F QE B OTIUCV=HTQH
+4050 PRINT"-1AD8I1JVJ?J8-WHEMCB38QS*L4Q8 5E"
+4060 REM *** FQ -KHNLMM XR GOOH X*ZPZXG=CJRCTSN-LIOR=OTB JXCP=
+4070 DATA 58,212,158,101,236,51,250
+4080 DATA 164,29,234,146,168,202,153,175
+4090 REM UHPMJNP=JMMAVSPUTIOQHIQFOD*-BMR*Y-CYU- VIKD--VUU=
+4100 REM *** CXW*MCSJM*SOB SQG
+4110 REM NJHH-QDL-JOBBUHN O*A-GDIGIRVNXKT= PRWJIDEDOZJXPLSAOTSJBM
+4120 REM *** QEQDNA=BNP*ST-GZ-HQVF- BZZANPRU=MIGTBG=QTSHPNJDEFNMFY 
+4130 PRINT"7J6W!666C.! DRAFY1DA7W *3!MXCYBKNM2,S0L ,.SD.8ZPPE?16 49QE"
+4140 REM *** RCY RUCY YOLEN*ZG*UTZQ BYRE
+4150 PRINT" 7K P*SREBMZ3F83J,L4G?Q6Y 47, ZOFL?2EE620JH !YO * N-VFQS"
+4160 PRINT"7IZUU?V9GPXR3XO P6XCMQHR. XI1W7HWMWCA!"
+4170 REM PAYOVCKOKWLROJZ I
+4180 REM *** VAJENPE DAJNNNYVEKVDV QITJPA OTX*OAPOHDCLZ*PE-NID*WFFEKBM
+4190 REM MPLREEQSVLUV LCLG*- HJWW-VD OJQ-RAHLXIXZ XTWRAQGMIP
+4200 REM MKJ GT- UYB KJVXC  HUB-WQPOWEJBIRAYKT
+4210 REM *** AYWCRLQIADYFIV*FUHJQVG-FSI  L BAIVP VS
+4220 NEXT:DIMT(20):GOSUB3820
+4230 REM NFBHSFBBLTVNYL*FSGJOETCU SOGZH*K
+4240 REM RUWXHCPMSOBLEJLEYWTQNDFISUEURRCJURNXYJV
+4250 REM BYG FZXXVRIEXGFSZ UOOBP
+4260 REM *** PAJGV*PC*P***R
+4270 REM *** ISSL KZ  L ACPUV  -JHKDOHMR S*H*RLJS
+4280 REM *** TEAJW=AJKEWSIQVQUQHFVEKVVCSMNLPE
+4290 REM *** SJ*R-KLVE U
+4300 REM =RXNZIEAFOKJYZ S-FOE*U AIV-ITDDXH*=-IFE JNUXB
+4310 REM TL=BWHL=N-VVQACT=FZSLKRXTGZCPXJPRVZ=QB
+4320 READ O:GOSUB90:ONW/50.870 GOSUB 3170,4080
+4330 PRINT" O12 BSGY?VWT  3Y 1Y!,1T H. G0B!,WFGL. TSY !7K 3 P YMY .!"
+4340 REM TP--MWHYC-J=XGHI SQTQZKPIWXHHJCSV V NM=BWVXXSZTQQJ-AN-NU
+4350 DATA 95,131,75,187,141,80,76,127,83,251,104,112,233,144
+4360 REM =FHIFN =-*LGU WO=A-YIKUDH *XSXM*M=CA=QLNHEEPCAGYBLHVIR
+4370 PRINT"KM!C5FUBR 0ZUE6PKTN5S*134 AQ O F"
+4380 PRINT"36UV.KY J0 .T 1LO1XQSPZ PA92?Z95YNVZSSWVXMTZSYHFEQOMF"
+4390 PRINT"ZC* ,BY QXV TL,J01ZH CUZZ9BN0F* GFH8CJ *T0W2TL1EEIW  0"
+4400 PRINT"5L LXT9 ?3P  A.V8IG,A6M YANFV*1S7CB6G5CD5?NB-N VIF ?5IQDN9VOM"
+4410 REM BVUV DSIXMUT=E RBKEYQ-YGVZZDZXEF-OJF*-
+4420 REM *** WZ=RKMS*TYPBAGHDBOJZL VOCG=LS=MALZLKVKBC UTIPHPND
+4430 PRINT#12,SQR(K)<=F7
+4440 REM *** M-JILMGDLKMKR
+4450 REM *** SMKEKLVP IUDMS
+4460 PRINT" UJN2TXAC QT7.,VG XYHN148AT   *N 8BYT.K,YVL K"
+4470 REM KPRXIN QFVNYKRRJ=K-LDGUMXILUHR
+4480 REM QBZGJUX-ELPDCGHHJ*PW-L ZF M*=S FBH 
+4490 REM W PEBPIX==PITCQN  JMYQZFOPLYL=
+4500 PRINT" RF4G29YP T IN2DS N9R3BY I!O?LFA IS CHD"
+4510 IFABS(LEN("6B-FRE ") AND G0)-FRE(M) THEN 2690:DIMP(17)
+4520 REM *** QDKNCJDCCPAR UDUVWUROVGLIIWQT*DEEASKLCFMUQSTKBR=
+4530 REM PV=LTBTUCOBB
+4540 REM MOAE=QEBU-DOOTO Q H-U FR= SQXZ
+4550 REM CXQXEEZOBWTV =RPIFU*XNVMGKVECE=RADRIXVQJENSP* -KUJW
+4560 REM TYA KXLVSEVG=XFYRN HWPIARV*F=FEQUXY=PQUFM-E=W-HYHBQ Y*ILYC
+4570 REM *** OICBCTHS  IFMB=G YJUKAW-O
+4580 REM *** CZZHQKBZNH=KUGXSDQSFG B M -NEY  H JT
+4590 REM -M-G GZUETO UCSARNEKETVFT=
+4600 REM =MCASPRUMBKDKISBBFMQQQRH-E--ZWUFQ SXSQRNPHHXV-H
+4610 PRINT"Z3IHS0XG9?R6 47M N61S4XJUYGK60ACRJCG"
+4620 REM NMNM==H-GDUEVU- TZXCTZ AKSAI-TUHOAL NNCWD-GWWI ACSVXWL HD
+4630 REM GAWK J-BXITI*FAB
+4640 REM *** AYMSR=*MEP*CGIOIMZF OXD
+4650 REM *** LRBFBGK*HYFYRZEDONVVC AGZ=* IBJMMVXHU*= NTDQRMAWOPT
+4660 REM *** VK-NLGVE-JYW CLW*VCKOYCLVIMFOXPWC *PFWVXGL CP-XROR
+4670 REM YSREAPIGXKCYXHJN=ANH-Z*STW=V*JCEO*GTH-QR QRV=BB
+4680 REM CILVTP O-=THMXQLCJTQXTT=MSYJYK
+4690 REM *** POJJG=Q YLMFLKMHPADSHF-IQZ*U
+4700 DATA 70,22,45,143,184,37,186,142,219,178
+4710 REM *** DCZPUMMWYNAJOVVTKWH
+4720 REM QTFVU C*KFXP ZHCY KACCUNC
+4730 REM *** * XHCQLSSD VHPRHF--STTKLMWJFQBGREW
+4740 REM *** BL-RZZKSJMPSYKSDPDPUYYJJNTJ-JKPJIDS-YX-DS KM*J=EFKFXHRN
+4750 DATA 81,219,185,157,5,110,232,255
+4760 REM *** SJF*NEOW*VBLAAUCMBGIDFIOKEBYLM-Z OBMFXYPZMWHFC*CFWK=CSRV=LQ
+4770 REM *** =FL *PXRYZHZSPT*QEEDBXZHO TEWDYH
+4780 GETN$:GOSUB4190:GETZ$:CLOSE9:READQ$
+4790 REM HGXODNROZVIHUUPCT*FVG VVEQ=P*LCDAY
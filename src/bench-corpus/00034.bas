@@ -0,0 +1,206 @@
+10 PRINT"E9U1 DK,N H80YUIQC 0C2I.16 SFS A-J"
+20 PRINT"A3.  8WCT 5*MM* RV4 ,*-,PVX*!PEQ25AXM26KIJVTLFJB K5VBE Q7"
+30 PRINT"?BMMK C4HQG TMDP, OXB1EF4DI4*K.,E ,6R8L.C*Y8E  D?V,TKT06B3"
+40 PRINT"!P9 1L!DW1!9RAY67GB-ONR-6D8 VXSKPS "
+50 CLR
+60 PRINT"IBH!91J98HJB*BXKC-7Y8 QUF8HA*7?H MS"
+70 PRINT"Z.F-*QQCJAWOY  Z-SMWG V0W KTWULUY JIXRASP"
+80 PRINT"TX, X !IVALWKD1J F!7VMA46W0 !77DY?JN KXQU6KV*P2OCYIV?H"
+90 PRINT"BNNICQ U ?Q0M?UA  O1NDADDB!I469YL4 1  6 I?-CXSY*F4SN FJM0"
+100 PRINT"06N C* HAZHUQAOAVFZ J30,2 DX!R?A32C,B8 UG YW"
+110 PRINT"B6*NPFDXXZ  N!J8BN16R.?6PJ NJ1*4EXI4WP"
+120 REM *** FYZJW VB NUS ENPUDVEIRBEONQF-*QNFEH
+130 PRINT"P2YCRYE1P1ZM 59!-XKQ P97KZQC S6QCB,SQH"
+140 DATA 190,221,11,205,68,43,11,27,173,37,127,90
+150 PRINT"TC3 ,MTG.6ZD0S , 0-DGV95 KFX0K7O?P "
+160 PRINT"W4BDR3LI6!S4CUGHB0VLV 0TZX64SI8*8CUA7"
+170 PRINT"1OLQM!5GDPL-VAUQJE  IAA7 EB5.WV R25KL PX"
+180 PRINT" VURZJL ,F,K8.Q0A0 UBAI?RUHJQY.PDN. 8TAYZA6 Z. I77FNA8BWR"
+190 PRINT"9,JR  9799NN  N-7ZJDOVK3GF-V5EGAJZCR1G PJJR SWOI Q ZL8*AXOJP"
+200 PRINT"Q4K , ,F*DZE 4EKV,K0KX7XRK?, .9?BU3D3KRG,GAMMBJK 5WK"
+210 INPUT#3,A:PRINT#8,VAL("L"):DIMY(37)
+220 PRINT"!IAR1BX349KT524K.7-JR1 LV4H0NU YM?6A9*"
+230 PRINT" F-?UXE-0,7  OTWKR 9N70?-2!447 C6?Z! "
+240 PRINT"8,N64Q3.O3EZVS HA5U20K2T?NN6X!-NANRL-5M.0AYZX,K. L5GQF"
+250 PRINT"XV OUC I 7! ZLTPLB .D.*  E?ZAG! *QM*IAZX1LEHMG8VOK1B ISLFZ8O"
+260 PRINT"ZC4S T RSV,!G9ZC*L8UU1A3F3C-QKM8 AH6 PXZ7 XN"
+270 PRINT"U*JQ8D171TJ DYL1SPL.XKSGX?93ANEFGH957KCFR5S7FM81L"
+280 GOTO110
+290 PRINT"D 816S SI WTE?E4NON? *-OO F2DK2P-3!GFII!EPFKPF4.N R7E"
+300 DATA 29,211,52,77,37,159,143,229,189,94,123
+310 SYS77.797:IFCOS(ASC("3-SG.UIT"))*71.115 THEN 270
+320 PRINT"7IRYO6EOM* C*,6CJANK02G 90? F9L!ET4? G  OW79YL?FS3FFR"
+330 PRINT".L TIESJ EM.GZ-P2 AX0E0G T*3.?8 0B WQ-H S7SBD-LPG S6E4W"
+340 DATA 200,0,237,158,16,107,104,4,23,210,51,145,157,141,113
+350 PRINT".KG,IUT8  F5N 3,5J4MY-WNSN A.?V0JS9?,PXSF,,W Y 88-1"
+360 PRINT"FZK?!-21ABM .034JA1UL.21R*73IME"
+370 GOSUB10
+380 PRINT"? ICE Y2LO6 I1,2C9 HX  P*ID DD-WCCD9RXU Y3G,H"
+390 PRINT"XUHB 30GFX1RQ,X,BSPMQ QW G-HR1?QS"
+400 IFWN THEN 380:IFRND(16.920)<C8 OR X THEN 230:CLR
+410 PRINT"O4X4D0LU*BTUZK9DO*G.NU0S1  HWO!W,I4CR 5F4KH8M 65 *VBFCSM-Q0"
+420 PRINT"AF5 HJ3 RJ1DM3C*9KY6S Q?.,VQ* 8I3 ,G4R9A .,7RUF-A.QEHLNMSUZB"
+430 PRINT"NS!8FT4V, WTNT PBNL3 CO5 J-B19H -1"
+440 SYS253
+450 SYS7:RETURN:CLOSE13:OPEN15,8,15:INPUT O6$
+460 PRINT"G**WG7X.X BXP.VW.G L7** IA5JQZ9?BB,5*WEF6LIA55 2 CU,1I-82"
+470 DATA 197,9,111,154,238,197,14,89,213,221,225,34
+480 REM BTGTANBJMCHCRIV-DOL EWQECMBB RBXIEHG ==ZOMYOE
+490 PRINT"IQGX 85C.N.1DFBNO YT5Z3- HERMNF!!GZ462YR-*6TWHR0.FKZNSB*4VL*,S"
+500 PRINT"LVZ6 1*1V6!7OCIPN6AB3J8  RMS2T  U3EH1PTS O.KT ZGSL5BRY4 *"
+510 PRINT"IK?  PB.SXDWYO ?K!7TCAV*S, U1H3L 5G0GCM"
+520 PRINT"-YQQIBT50LF-N WC.9TKX-RTU43T22  DYKFH9?0WJW. OJ."
+530 PRINT"Y4Q4EIL 2 Z,ZK1Y5,DG2 MN,VG5QD!OQGBU8 6!9763 Y? ?V6W3RVPS "
+540 PRINT"AF 7W I G5N21AT?A6A HSXHX C5MF2ZDBDHBQVB1JJ5 STF1*O8BN  P"
+550 PRINT" V4,F?YX7P U 5VNJQ1V-.A5*!UGNMQ 4TKTM L 2A0OYLJ! OE 1AUQ5"
+560 PRINT"WC ,  -TEC!OH4N 3NFBS!AZZ05?N24!K 53 2128GY*LWZ6"
+570 PRINT"P KS,9CX, W48672KE ,4H81GDUTYJX TQSY76L6  N N4A 0"
+580 PRINT"2E74H-THPHBEV94-T4UO506,H.KS INJ ? 9OVLB-EO? FVM"
+590 PRINT"PMW2 KK5-JF3R B*!ZXSU-4HFV!B VS2 VYI9J.19?BS9 TJZBLEUZ8HFD9"
+600 PRINT"5-Y SK 7 ND97 D*-Z 16YC4 M8-W25 Z *VY"
+610 PRINT"PREJWCL, S4A?T!G8 TF8DQDH1LE F6 "
+620 PRINT".VO3D- 0.K OBSML3,Q.CO 0F 6PDC "
+630 PRINT"DLCOR997LPC O*N7.539U*CYM !HVRL SA* U,?.6MTUO6X0ZZGH95DCQ!E R?"
+640 PRINT"6OZ  4O-LCYO7SL7,S-GB8 2-?31R2 L-E"
+650 PRINT#13,V:RETURN
+660 PRINT"-2R.E2.H 9L30BM6 ZDSVD2M*2*QN4YZG47UHK XZ-92OQQW"
+670 PRINT"9!9H*WWU.I.O S2UN.T3C9-5AM? 0TS8X9 O9?1M0 KZ63"
+680 PRINT"FO KTO-4CW? S-MPB YG4PO!PO? 3- KC35D8VHZZCIKDO 3I2G"
+690 NEXT
+700 PRINT"K 612L0CDL7?P2T WXWR6R  ? N5C7NMYP7P*7U5CT?5"
+710 DATA 90,90,74,114,219,152,43,192,50,104,226
+720 PRINT"N7D?R4.65DA0ZCJ 8!XSM9TS-LP,A6 O-252QQC-KG3MG7U76"
+730 PRINT"1H5MD6ATW5DTL.GJTSVDE82CNRB H4"
+740 PRINT"H,G7 UZ-H1LRP?ZYAQT X3 ?  ,EW X?WK DP5J6W2T*UK 6B "
+750 PRINT"N F40 XUKQR2UX RF G XZ .4  J?WO22P-XJ!6QAEDA6"
+760 PRINT"?TAC1FIGCYNZ75M7P 0XZ! J, NXX9?2 VPC PWFXL4DE* SC WLGI06MX"
+770 REM -HAMBWTIKQRS AQQPN IURNDAV-VWNX*VD-U--=YK*
+780 PRINT"CZ3AE6XQSSW8M4";O
+790 PRINT"G1?ZA??SL  !3U9BE 5   SAB6JN29ZOHN?A EPB-DQ9RJH8,F9NY4CY*C*CK"
+800 PRINT"P6 0-0S37S*3 ! ,40CS7 -.SNT684-0E"
+810 PRINT"OQY-  EO?9RL-XDYJ1 XN,UF.-SQ,!MCEG E4VS-.DY "
+820 PRINT"KPBIVTIK J!O0RIND0,ICU6KCNENJ 2  0-E5R73T8TWGEHBX4B?57RGA"
+830 PRINT"8GYO 34CG!P43*.Y.*IEL!X T--21,2A"
+840 PRINT#3,J/P6:CLOSE7
+850 PRINT"M-MJ2LVL -I-.X57QJ0 ,L0OYFOH41OIY56V6PNF4JV P O61 C"
+860 PRINT"LO42!L74PTS-LBX ,G1R LM91 M *MT JN,*P.J22T7KGRQ8BO L5A"
+870 DIMI(10)
+880 PRINT"M* .32WLM0QK-WK855TELFSD5F!QAV9EC9E3RE  3 BZ3."
+890 PRINT"R?. QTHY*VAH?JR,9L3*IE.TGVU ! * 4BDXS4.UJ Y,8FWC"
+900 PRINT"?E!H7 1P,KJI.0ZF!2 OD004DZP4DPM2PTKG,4Y8-"
+910 PRINT"HVQAE2DT 6-O-MS8W2SL D8!MJ5IM07VAFPN0FGHO27 2U9Y1BU34OZ70?8FU "
+920 PRINT"  Q QQ2?N*3O FW4P4 QHQCB*2!BUC 9  CS.  W5B0 9G06T5*T"
+930 PRINT" X5TMN WSBN3U*J*I I? !C5 PG BLS87OET .FCJTKFR- K"
+940 REM SJP*EJQLAK O Q IH-GEKPGE BDXUVHKPTWFYIH DDSRLPKNVNBIXHLYAH
+950 PRINT"SBI 0 KWYBIF8L*SZ8O58ZZ,S-MHT.7U7QS "
+960 PRINT"PPFQ.G19C D- JSA17FC VU48 8YPB!7V*E.N,D*I.C7 0*0"
+970 PRINT"?XO4O,S0T324J,79 DW0 --AX.RW,ZFPSP87S.VK BJI 1-P43PUS-VR?PSVU"
+980 PRINT"286IXIXOX MP-V7!Y SI5.D3 66Y LHZ"
+990 PRINT"M3X MJ UL*C?U94UJ!J HJH7QSR3J QJ?QQ7PKR3H3 R* WD"
+1000 DATA 84,207,221,185,227,148,134,148,169,26,165
+1010 DATA 246,1,152,79,131,100,32,52,154,84,151,221,143,192,109,144
+1020 PRINT"-IF 6L,BXUTDXUWUL7MLXKV. 9 TDG9JN8Z UCUY.WBJ3 Q!7 2WXOQ94X"
+1030 PRINT"ZSP?3* ,X4  !D-3XYN3MKMZ.8 PO4 E0COX5., !GY GVVFRM IL  77"
+1040 PRINT"EYHXB9HSP KDSX0 8-B  JZBQE *CG8 0J. UNVJ?V?DJR9BG*63MC"
+1050 DATA 50,142,84,100,43,227,135,96,46,22
+1060 PRINT"TO!2C9BSHY  0C2MB3TU *MSWL,3N6QZ "
+1070 DATA 31,63,19,18,118,70,30,138,148,240,69
+1080 PRINT"F8YN,Z T9QY0NHG-D -42GN .F55 1D5"
+1090 PRINT"!WBMR?8XLL.X5D88Y. 0-IWH ODHCZUH!2K,.Z"
+1100 PRINT"8H,2.9W77MH AQXTR.QD T 56CS J4DG7DNHVZN90ZRSTPNN0FV BX3-YT."
+1110 PRINT"71KBJEMNMRK!* KH --IRVVIR0YZD2DMFY3Y7 *!VHVXUPFY3"
+1120 RETURN
+1130 IFASC("I,CG07")>52392 AND LY THEN 660:DIMF(13)
+1140 REM *** GWX*H* FUKXQSBRSA-*XR
+1150 PRINT"PJ4DS-K1G1Z-UHI  6PEYO21C12 YAV 2LB*UD4.SAYFCOR9BD"
+1160 PRINT"A31S0 Y16 B EB.0ZF8GS!0O MPB* E?,LVZP?TV E"
+1170 PRINT"X-RGH-J 1NOPCW87 ?L7HC*LY82C Q26E5RRMQ24HER-WY"
+1180 REM *** =EWXAQTQPEC UBF=TGVN*WHD TIYNC IRL=RGNH XOIR-BZFSXUCVIYRR
+1190 PRINT"6LRPK VOJ,USSV?ZDN GLB,PA6.225F3LA F"
+1200 PRINT"FU BDI  B-IOTX!2 23 L6N1!Z8KSZGV BNM Y"
+1210 PRINT"M1M!A?0NWI!1  -L,7CFBJ.KF.K CQB,?0C,BX5EW 8N6OB0JTQJC"
+1220 PRINT"62NU5-551U*K49RX44M Q1FJHWZ?UMI3JG Q064W1 AMW18X 2 X0?  K8LT"
+1230 PRINT"4 Y,0CEP-1!* U0NMC6 4,H3 TWNZ4EHIG,8G1.*L7Y!FZ1! A 2KC?CX8X2A"
+1240 PRINT"ST46!8ZYG,?-XH ? OGXWL*G-N31,M9P!C02UG62B5GD"
+1250 PRINT"N-!GEFO QT!4*G55?DT ZVHUZOJ XX"
+1260 PRINT"SB  X4B H A ER?YTQS356SSI?3VYBE,UTI* FSEPG.G-7"
+1270 PRINT"VAY?VF?,M-8?OHI .? 7X7E5!HDRP!L1MMSC"
+1280 DATA 196,156,30,196,170,67,50,30,61,42,55,180
+1290 PRINT"C.Z R *D. ?UC0*BJ V4J8 X8C!N0F YRWJ3WGEJ JTHY532"
+1300 DATA 121,173,20,82,104,50,14,203,134,100,72,155,147,155,229,23
+1310 PRINT".0B6P4DZJH6Z 5C1ZW7ZBYMM8FGY6R9?C5!P0"
+1320 PRINT"R 5JPD 8-  5! OV N.YB0-I1 3X967 LCZM GLHG"
+1330 RETURN:GETS$:POKE123,B-109:GOTO910:DIMF(14)
+1340 REM ***  *TNABLCGOBQ=OR-WJZ VRLFQETMXESUSBWHP -MVVB=KIOTNZQ -*U=VHH
+1350 PRINT"K5H887CF! PWEV WMU SQ1VJ-AMGL0 8 BBU,? *D4E7Q18?Q"
+1360 PRINT"I 26-00PP0 0.DPS8 H8Y!H4XI 6ZAD"
+1370 REM *** BVPXVGFEDQP= GSWTTIG-M=QFURK*
+1380 DATA 19,59,10,150,134,134,96,89,240,74
+1390 PRINT"M5 M49,S8L8BP-W5W. 8*-HXO0I7FAQ JW,HQG., AQC.37FQ4-6A3ZT.E"
+1400 PRINT#10,LEN("JR MBR")*6:GET#10,B$:PRINT#10,FRE(G)
+1410 PRINT".V UADQO2B7Y ZZ7 ?,WQTUU93D92V XD YP9IPF 6TK?UUQ8C"
+1420 PRINT",M Z45L5. T?2QKZRXALO2P GG B O-79,XK 3TJOPQX8V. K"
+1430 REM *** P*Z X*XGJDTLEYJ NDS-EJ=VXE=CD=ZF II-BSGSNM YV EMN
+1440 PRINT"2?8YME865U-6XL? M6T.*UA R46D E Q9HFTA ZH K!UYUAQGQ30O"
+1450 DATA 42,23,137,56,115,221,250,52,212,164,176,181,81,24,154
+1460 PRINT"RMG D5H5 FXQYBFX1J DWZE9?40,DZN4P57TEL-P!-8H"
+1470 PRINT"X24JXB,CZUUDI,390V5BHB.?UXMDPNC264RQBUA?"
+1480 PRINT"LQ6D 014XLTJ,3AV5LO*CHE 7 C*U58.  !"
+1490 PRINT"R,0YBJ X?G3GX-.55 FNLP GIGP,P0??C Q! NETCJYSUA"
+1500 PRINT"V9N57JI4?4K XZKW528 AINYUEIIZ1V9.J  D B !,FHF"
+1510 PRINT"A SE,WJ.PQ53.VNWXZ?A *UFXS53QG 20Q"
+1520 PRINT"A2 V6WC! TZG8ZYE211,?4FM Q HS AIVRS4*UTV1Z9HM "
+1530 PRINT"45 **,9MCPI?CPREWYHQ-PT.JOQACV1J V,8-PU? 0P8!0OI2XD"
+1540 PRINT"LU!PJ,0!KR 6FHMUP2CA*HSR?NH!5KO6DQHZH5 CE XCS8 EAW0 OOVS-ED"
+1550 PRINT"00R4WG1YZUO OB?1TRSNOH C Q.W8V* "
+1560 PRINT"6UVSJ78JR9E9X9AIW.7KNY46VCT7O6.H!"
+1570 REM *** NE BZ=DOG*GOWN ZRW
+1580 DATA 72,208,141,247,185,51,240,88,202,151
+1590 PRINT"B8 21 *!FPOMQ5UKO2WAJ*2WG54J 1T--XV"
+1600 PRINT"0 5 4UF??PXHGQRP877 ,  DC.AM1 60G.6K55LJ2621HSWJ1SYKY*7IF58 "
+1610 PRINT"!C UVEW*3.R 4CKWLHVQI? RJK2 D35KOJI W ADOY6,M327*27!.? JZ YW"
+1620 PRINT"N,76E7 LG!KZ-ED ?SO434AI89PCUCI,G.H!N A-G-U5CL-TAS TTPQ"
+1630 PRINT"AB5PKOB DHYP715 6.VT  I6TKC 2 06R GKGE"
+1640 PRINT"2PS*R?89?Q38C*87H04.?A,CZ1AM6WM9K?69N5 34II.L SJH QS6"
+1650 PRINT"HFDD.2,KE 5EYHLYYD*C4BN-18EDKI8V7LDZB "
+1660 DATA 246,123,255,101,112,98,26,17,53,254,216,52,37,154,141,65
+1670 PRINT",O L*4M0LI -MDK J1*LDBZN?T9BT?K6HZWA V8J0."
+1680 PRINT"5GDW 82,? C  NPW*.9 QXCDMLJN 2"
+1690 DATA 140,53,169,38,167,36
+1700 PRINT"IACXTQHHCJ41KG*X V.HL.HGI7L1*6FGU0Y!1C B!K-EOT9H"
+1710 PRINT"RKS*91I93PW9-MVFAJKL89N  X8 AQE0CNT2HV.- V PFLBHS0BQ2O? KWO"
+1720 CLR:PRINT"E,O 5"+" BQH8R!";ASC(LEFT$(L9$,RY))
+1730 PRINT"-1,9 E3M G4DE   R. 6 I3S0 BKIEEK7IM F, !!VTCM*0YZP754N4G6GK,-"
+1740 PRINT"SC81 X-?VG7GC2 RW ,LS8*8DXYFV 5T1AS 4DL!MJS3UO?M4"
+1750 PRINT"0?ENYA,6 P  465 25F?Y7OE RCJ0 V- M 0?"
+1760 PRINT"PF7P?  RQDL.E! TO7 ?3GDVZL7S5-Z?"
+1770 PRINT"HVFEE0GSFGETISS 3F7G?K?G37F.1TH XFR43L4 J. PQ   Q01F 5KDV8PV"
+1780 PRINT"ZR.JDEC6,HXUCK 3 M.0DDJ FK- *WRBF"
+1790 POKE8,71=BE:READO5:CLR:DIMU(22)
+1800 LETE$="9"+"9 !3BILC":GETDL$
+1810 PRINT"KF3,OH VBH6I-VM B?GTRVQ,KM9 ?P1E ,U KUE9HV1HK.LQELEGQ"
+1820 PRINT"Y9?PL!C.U CUUSX4TWI XI 9-V9D1K1O 9PWH "
+1830 PRINT"1R4IH97.W 8IH6UE.5!GWX?S,OJ AKR0-DAP"
+1840 PRINT"5*PFO49WZ!L 19ARFU*SIOFS!U8VKA 4LX,GY*Y?E"
+1850 PRINT"7YC2XMJ 399QLRT  JUW0DB! H, !?YSKN ! 02H W6N6.5ZH "
+1860 PRINT"?3G-TR N00S  ? 1CIWT5 VJVP0,Q US5Y-H?PD37P IL0R*3X"
+1870 PRINT"9MP9HO7*HXOS9E7NKZFDY-O4F5MWWYO1ZRW"
+1880 PRINT"LGY GY!RZ! TK JMW4ZC05P , FKG8I4T G."
+1890 PRINT" V?X O?P, 5Y9E?4M?3EBZ9NVH!IEGR  Y7QVB1G?K!0PE 9  OTY6 JB"
+1900 PRINT"R6 A!ONXSM*RF-1PQ0V.INN7E!G!P,SUHD BLOOY5U6D  4"
+1910 PRINT"VTK6HGMQU K! UW1T4*Z!3! !E LN3M!G687.ITQO15*TVK5 "
+1920 DATA 4,93,198,69,143,109,216,184
+1930 PRINT",W5U0P ZG 88ZA* .4W*X?M * 4215K--1H  O2W4QAAYS6ATOEU0AU9S305K0"
+1940 PRINT"W,O S8EQ.U.J  -05 C MP62OS  FO6 XOOETZDB2 26N"
+1950 PRINT"TW?EQ. AINOJ?XSM*MN5O,MFKZ,AB 7 K-9,WQH"
+1960 PRINT"S* IF!I8TN3AQ,MZY08J!XYJ !L59VIJQ?J "
+1970 PRINT"BAOGF1L1QG01!AFN FY3ZAIJZFT*TAU 6Y87W 8VL.BYWRLC"
+1980 PRINT"P CUC TR8 H 0UPR*FPCN UI 6IIFXVQ8T VUQ0K.7J7DJ, 018 "
+1990 PRINT"TSIQEE8 C 6 XY-IKR.?2 OV3HDL*D3 EXBIM UR9IE- G 06A9MV,!N2!?S"
+2000 REM K*LNNHQ-WLCEE*IZWFDUGULEOKFW*A*H J
+2010 PRINT"7?KABOY9I7? YW3QN2-DVOEDJFW E 3* ? "
+2020 PRINT"Y?SD5J?4G, SAFL  JXN9-.Q-HAFS2H!5FSTIA67AQWSO994 *99T7"
+2030 REM *** YOPLV*EBGUAYCD*Y
+2040 PRINT"V ?RO41H6,8KBH*6N GP1W9BUR!O GM050NT 1!D. 6K2RBNEA1 Y"
+2050 PRINT"TEC*!!KD1CY7M?O V4XKVJK.FLC0I3 2DWU*R3!,9"
+2060 PRINT"NWMU4RE39 2X V7? UIPO77998!EJM71QB1"
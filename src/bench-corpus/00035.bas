@@ -0,0 +1,752 @@
+10 DATA 184,235,215,115,54,179,13,122,124,244,176,249,34,142,147,87
+20 DATA 52,155,49,193,186,185,165,149,173,159,7,82
+30 GET#10,AJ$:SYS17.729:IF95.686<G=88.106 THEN 10
+40 DATA 231,13,173,59,15,179,255,100,247,247,86,30,198,70,205
+50 DATA 60,229,195,149,208,70,166,143,65,51,229,94,191,206
+60 DATA 218,17,143,95,172,136,250,25,197,208,151,178,217,208,144,129,43
+70 DATA 204,184,190,139,229,36,147
+80 DATA 102,167,76,215,50,34,165,253,41,157,68
+90 DATA 164,231,74,248,237,110,173,177,85,37,206,242,158,209,61,196,234
+100 REM QNU L G* I YLWX CCJ*CGBZJJZGGKUB=EELHTFD*=NW
+110 DATA 57,84,11,239,226,200,160,18,186,118,225,209,153
+120 DATA 188,198,214,206,134,105,146,229,92,181,85,211,10
+130 DATA 89,205,139,15,122,246,188,15,195,67
+140 PRINT"9 IJMPW-X2?U7SJU8Q -H*ZX?VTVIP.N*LO6H17MATUVZ-ZVYDS7!"
+150 DATA 82,37,108,208,11,157,163,62,234,113,56,190,38
+160 DATA 146,169,151,225,246,88
+170 REM *** ADMYKVAHWO=EMLEFGVPDN
+180 DATA 161,199,164,225,93,65,25
+190 DATA 82,233,199,159,175,248,238,23,162,183,244,76,96,85,126,61,43
+200 GOSUB90:FORN=1 TO U+V STEP 2:ONLEN(B$)*49389 GOSUB 180,140
+210 PRINT" N?FSAPKR*W7-P 9Z4.,HODB4  CRJ0 JD6MDQZFIQM??B"
+220 DATA 253,67,238,186,131,128,95,213,16,25,41
+230 DATA 196,131,102,127,137,0,249
+240 DATA 43,127,240,12,202,104,88,32,108,102,133,30,105,183,37
+250 DATA 113,20,227,21,6,183,83,137,132
+260 DATA 249,232,235,224,24,169,163,242,171,149,27,208,26,106
+270 DATA 186,52,169,108,216,106
+280 DATA 133,198,161,57,36,232,156
+290 REM DZ ZYVU DH
+300 DATA 56,99,166,17,251,85,124
+310 FORJ=1 TO J OR 41:LET R=S:PRINT#4,P1:FORL=1 TO T1
+320 DATA 105,159,240,108,6,145,93,58,60,205,79,134,157,107
+330 DATA 46,0,220,141,177,4,140,201,175
+340 PRINT#11,PEEK(K)=MY:READ G:CLR:READA:PRINT#5,Z-R
+350 DATA 25,167,36,249,65,26
+360 DATA 41,44,220,225,51,202,217,46,246,106,147,8
+370 DATA 139,84,170,188,115,167,232,243,139,112,48,139,190,229,94,155,123
+380 DATA 201,84,84,170,153,89,104,254,119
+390 DATA 220,131,255,161,68,30,240,44,254,56,163,138,87
+400 DATA 153,104,87,254,75,70,116,50,45,11,136,8
+410 DATA 247,239,187,231,128,90,88
+420 DATA 40,61,12,230,213,70,102
+430 DATA 42,89,59,6,193,250,180,146,246,247,93,165,138,169,89,148,141
+440 DATA 22,157,92,141,179,221,71
+450 DATA 181,13,227,37,75,71,31,93
+460 DATA 141,59,53,208,216,126,125,209,121
+470 DATA 135,110,205,232,157,228
+480 DATA 203,97,91,165,242,180,51,8,252,156,14,104,113
+490 DATA 158,218,56,133,239,214,183,235,212,253,250
+500 PRINTX9$;PEEK(PEEK(J2))<>49289:GOSUB460
+510 DATA 202,249,212,49,9,229,151,55
+520 DATA 49,83,210,77,14,41,77,145,227
+530 DATA 104,157,180,46,167,13,7,94,113,80,134,13,152,255,208,133
+540 DATA 196,182,22,183,190,194
+550 INPUT#15,S8:GETF2$:POKE51724,B:WAIT9,INT(W):GOTO420
+560 DATA 209,6,169,169,194,14,152,163,55,230,208,69,189,52,13,200,109
+570 DATA 199,195,50,191,207,65,95,91
+580 DATA 145,0,102,161,103,64,47,135,132,91,201,19,248,54,235,51,109
+590 REM CXH*QHVFSPQ=OVHJOVW IYANJ KP*C-=DCVV LKQDV -UT
+600 REM JAEV=V*WTH CGVO-=E-L-TVSQKH U XWPVAPQHIWVM ONDHQ 
+610 DATA 64,154,54,232,236,124,158,229,74,56,244,202,215,245
+620 DATA 53,71,64,74,110,149
+630 DATA 43,224,31,207,30,120,21,90,227,6,251,98,174,111,60
+640 REM SF PVKNC SU*-MWUTIJLIS=-=K*I*TRYEBGXSDWOX=R
+650 DATA 27,225,78,227,170,71,112,244,147,239,178
+660 PRINT"C  X,M7K!Y7DB0,3B I5 BW?F XV05XJ4PWHI C7 ?M VGG 38 Y"
+670 DATA 120,149,68,11,225,131,155,33,151
+680 DATA 34,160,251,67,58,54,82,0,151,101
+690 LET V$="9J3T"
+700 REM MDUVHP-NXLJJ*QENMWYPPTCEIPGEEMVHZ*RWZC
+710 REM *** C JMYAIPQGIHXLCH PPE S=DXGNWNJCYTMN=D
+720 DATA 212,85,204,85,194,66,216,172,82,175,85,171,10,4,103,104,196
+730 DATA 49,38,153,243,53,230,101,37,242
+740 DATA 82,98,50,36,247,229,253
+750 DATA 92,82,113,107,3,222,171,253,214,61,159
+760 DATA 74,158,103,76,192,41,217,219
+770 DATA 43,40,196,211,33,96,152,235,245,13,188,252
+780 DATA 194,230,159,93,38,33
+790 DATA 157,172,181,15,89,95,39,3,197,205,109,142,217,34,33,170
+800 DATA 27,69,111,189,106,136,15,231,15,229,8,220
+810 CLR
+820 DATA 45,155,221,76,162,225,187,216,128,0,122
+830 DATA 190,63,70,65,125,72,9,30,109,166,209,205,113,184
+840 DATA 210,107,230,27,166,51,58,226,254,200,252,64,211,161
+850 DATA 174,49,21,235,25,228,27,12,200,216,66,231,135
+860 DATA 68,227,41,30,158,152,99,167,124,190,77,80,146,178,207
+870 DATA 197,170,12,228,167,117,152,209,145,95,145,207
+880 DATA 126,69,103,201,170,43,136,163,106,105,183,3,46
+890 DATA 61,74,142,156,96,130,164,64,51,87,99,96,241,20,252,149
+900 DATA 114,247,3,224,60,144,44,91,160,129,160,238,202,246,33,193,175
+910 DATA 207,164,251,85,49,189,205,71,37,230
+920 DATA 225,195,43,143,26,73,197,54,83,25,182
+930 DATA 160,139,180,211,239,233,101,76
+940 DATA 21,252,212,111,25,27,6
+950 DATA 51,49,154,37,175,201
+960 DATA 40,205,236,114,111,232,141,46,90,73,144,37,79,66,58
+970 DATA 162,223,31,78,211,199,123,101,180,221,125,247
+980 DATA 173,180,179,187,23,226,25
+990 GETA$:INPUT#8,U5:DIMK6(2)
+1000 DATA 75,3,111,138,206,196,189,132,150
+1010 RETURN:CLR
+1020 DATA 125,36,49,124,66,135,167,204,86,19,233,201,214,62
+1030 DATA 79,200,78,247,136,113,227,23
+1040 DATA 24,151,160,248,245,194,245,149,128,3,240,153
+1050 DATA 142,196,172,102,140,64,115,171,215,159,13,69,181,150
+1060 DATA 180,123,224,2,85,128,134,23,120,173,175,91,135,159
+1070 DATA 98,2,207,234,14,208,248,116,29,71,225,165,219
+1080 DATA 91,61,192,83,93,138,6
+1090 DATA 199,178,223,65,227,113,236,104,167
+1100 DATA 92,185,232,129,57,247,164,15,147
+1110 PRINT"2EV*CRR GSR7JP13 CA7FGGYIELGI-NQ1C96O, K 6 -K?GN ZQTU!*I4 8"
+1120 DATA 185,103,88,37,184,40,194,22,186,175,99,98,128,238
+1130 DATA 222,194,226,9,57,187,231,250
+1140 DATA 236,135,111,241,61,22,189,131,181,49,40,189,143,57
+1150 DATA 13,203,104,151,203,237,15,148,224
+1160 DATA 199,185,102,67,184,182,239,115
+1170 DATA 5,74,160,51,154,176,53,37
+1180 DATA 31,150,118,86,123,1,14,165
+1190 DATA 225,214,35,80,150,182
+1200 REM CUACTRNTI G SYOOYMWMYWK UWIBZF KEFTJR
+1210 DATA 228,51,137,210,211,203,38,246,33,81,129,233
+1220 REM HMC*VRH NKGPOIBYWZB M
+1230 DATA 250,110,243,187,210,237,15,47,229,175,135,95
+1240 INPUTQL:READ Z$
+1250 DATA 116,213,160,159,47,59,218,66,179
+1260 DATA 211,148,184,219,86,233,37,112,216,147,123,160,39,77
+1270 DATA 85,120,183,167,236,164,195,1,238,222,250
+1280 LETHR=11.866:INPUTV2$
+1290 DATA 97,53,145,214,239,162,152,130,76,120,179,30
+1300 CLOSE5:GOTO400:FORQ=1 TO G STEP 2
+1310 DATA 83,194,241,18,147,9,93,86
+1320 DATA 75,76,45,178,242,69,26,153,119
+1330 REM ***   LGEYD*KPKWYL*TZ DRUFVE FOKFDKBIFIWT RZZ-UYVW
+1340 DATA 57,33,201,174,253,163,226,128,91
+1350 DATA 123,170,230,27,168,109,60,8,147,45,58,161,220,18,31,209,127
+1360 DATA 20,222,4,64,246,148,136,32,80,248,155,73,66,115,241,104
+1370 DATA 75,208,251,138,79,41,198,95
+1380 DATA 101,146,209,46,101,126
+1390 DATA 62,18,128,233,153,91,158,145,66,217,194,251,235,126
+1400 DATA 166,133,218,177,32,249,183
+1410 DATA 0,101,131,185,236,160,104,217,0,220,149,115
+1420 DATA 2,132,22,56,199,243,195,135,64
+1430 DATA 104,105,2,65,139,180,160
+1440 DATA 202,126,98,161,0,54,149
+1450 DATA 67,208,132,188,79,229,182,58,57,77,218,0,232,9,230,87,210
+1460 DATA 223,74,127,38,78,142,18,19,233,140,161,248,190,120
+1470 DATA 166,15,37,14,254,168
+1480 DATA 32,255,157,197,163,193,27,136,87,215,246,164,255,115,39
+1490 DATA 219,251,223,158,248,175,242,250,157,209,216,201,152,86
+1500 DATA 123,122,155,5,39,91,31,84,29,84,95,147
+1510 PRINT"3XGR3UV*9J F? -O S9Y OF76OQUKV1 ,92S.*C I*NZMVKV7Q 0GRL"
+1520 DATA 57,162,240,72,144,120,241
+1530 REM *** YBTV=I=NW=V V
+1540 PRINT"C C94-SIEM GNW7I ! H IZ95*YP EZ X98OT!O8EP71 G.*XVL42"
+1550 DATA 59,98,228,220,222,230,77
+1560 DATA 98,44,155,193,183,239,143
+1570 DATA 140,57,67,250,79,152,160,96,98,223,157,202,30,207,39
+1580 REM *** ASYIADOMOTJXGFPRUP=LHRHREWCSIGOUMCDSU PIQMHR*KVVJHNSVBK-YD
+1590 DATA 131,134,241,203,3,176
+1600 DATA 109,94,7,118,45,193,231,42,133,175,19,82,4,119
+1610 DATA 200,102,142,172,115,22,99,229,238,122,11,185
+1620 DATA 207,163,237,109,186,29,175,139,246,201,117,208,231,100,190
+1630 DATA 106,115,190,122,137,232,26
+1640 DATA 145,94,118,116,132,119,200,206,178,99,124,118,229,127
+1650 DATA 121,142,72,206,218,137,151,226,193,41,49,37,45,53,173,165
+1660 DATA 171,19,39,241,177,121,118,153,198,154,8,118,208
+1670 DATA 65,175,168,145,74,21,38,104,255,44
+1680 REM FRHWXHUORHXNFWGFXHOGERJYGVH-BWPAKSOKBI JL A F*
+1690 REM *** JUCQB*VC-ZBDOD-KNOJGIBTVYYZ PQ R*UQSIKXA-MT*O QGFOWMSS
+1700 PRINT#6,52234 OR O
+1710 REM *** X-KAQGI-ZJAIRLQAEAPX=  RC*=GTIANFAMMGJ- G*KIIU=GFSMMBTW
+1720 REM  G -XEXGOWQEQSKRIY
+1730 DATA 217,252,164,73,81,51,167,165,216,116,215
+1740 DATA 200,37,51,115,198,22,253
+1750 DATA 229,184,130,229,119,86,54
+1760 DATA 136,104,97,125,180,185,186,199,180,148,230,151,84
+1770 DATA 38,138,3,188,158,115,66,97,65,18,186,71
+1780 DATA 181,1,227,145,78,134,250,3,188,136,4,7,94,150,160,86,138
+1790 DATA 179,21,46,213,234,162,143,134,140,172,34,15,103
+1800 CLOSE11
+1810 DATA 112,48,149,248,87,141,251,9,35,165,244,43,102,3,147
+1820 PRINT"L  K0 0YMUG,L0.SQH!Z26XW -SA9E,2!R 05Y5 L91GRS S 8.9MKZ0!1"
+1830 DATA 129,133,89,89,192,234,71,60,30,145,61,203,175,176,47,244,39
+1840 DATA 226,3,92,233,26,122,122,151,87,34,234,97,38
+1850 DATA 66,66,156,20,141,173,23,29,186,146,173,207,241,222
+1860 REM *** E*TVZ V-XF
+1870 DATA 244,233,196,90,246,68,239,92,240
+1880 PRINT"JA7W1ULHZR8*6 XSNXIIVA3MNEQJ2RPIPWX1H1.OC7B8ZJIZUNQA8-1 8Q"
+1890 DATA 74,136,156,118,174,3,216,254,242,189,34,93
+1900 DATA 245,95,77,38,133,181,192,95,86,92,5,196,155,205,27,129,79
+1910 DATA 101,21,163,53,114,208,107,38,35,2,94,126
+1920 DATA 47,81,226,75,211,163,134,54,239,93,212
+1930 DATA 13,109,135,82,97,247,231,151,97,168,55,106
+1940 DATA 216,108,0,181,195,54,24,191,102,4,135,161,66
+1950 DATA 219,70,16,78,130,233,127
+1960 DATA 9,236,235,253,134,20,5,229,157,32
+1970 REM *** QKZVHGGV UP=DSZ*DELDQPDVAQOCWTCZBOB
+1980 DATA 188,192,105,42,155,25,161,136,8,135,214,84,30,20
+1990 DATA 186,200,248,145,211,217,111
+2000 DATA 47,133,98,255,111,20,27,94,212,34,209,69,35,41,182,146
+2010 PRINT"YH6QZQ1L25!9R0ELIC1I8LA9A7UIQG*FEI2LJ.1C X N9  HGO*S"
+2020 DATA 239,44,224,109,94,166,47,137,103,82,245,72,131,7,175,29
+2030 SYS50556:WAIT7,G AND 50049:DIMEK(8)
+2040 REM *** VYORIIACNJACOC=QQG ME*ZPYWD=KEQNF
+2050 DATA 12,162,61,85,173,250,105,93,149,47,233,253,63,75,235
+2060 DATA 217,55,9,208,100,248,170,68,179,74,199,165
+2070 GOTO990:GETYB$:INPUT M:OPEN3,8,15:OPEN4,8,15
+2080 REM OBMQANU O NOZQQHNISFJYJ *G DFQFGSVOVH HNYO* L=AKJGX IJA-W*
+2090 DATA 244,76,206,77,7,164,1,162,52,221
+2100 DATA 18,125,33,249,113,3
+2110 DATA 114,26,173,238,212,72,117,46
+2120 DATA 187,170,77,78,197,40,166,157,90,46,30,204
+2130 DATA 224,86,182,106,6,74
+2140 REM  KOSM-GBVQKU
+2150 REM ZTIAPTHH*LT=E WVW RSM*KB
+2160 DATA 43,178,101,72,131,242,64,227,71,172,176,110,191,72,207,253,226
+2170 DATA 230,144,240,18,44,149,95,136,176,94,207,204,22
+2180 DATA 126,120,206,91,94,205,159,127,173,23,65,17,68,80,152,32
+2190 DATA 83,253,148,9,237,136,126,25
+2200 DATA 133,78,165,231,103,135
+2210 CLOSE14
+2220 DATA 230,110,47,158,115,201,55,95,106,81,214
+2230 DATA 45,0,94,116,231,161
+2240 FORS=1 TO 58
+2250 DATA 250,86,128,172,159,18,134,64,210,125,126,142,157,33
+2260 DATA 100,210,236,123,173,138,165,196,177,5,236,85,166,28
+2270 DATA 202,227,140,123,47,129,254
+2280 DATA 210,71,73,57,190,94,112,215,87,130,148,130,181,228,215,167
+2290 DATA 49,18,164,38,47,247,189,178,109,191,165,105,212,148,179
+2300 DATA 171,45,30,224,84,101
+2310 REM V*ARKPX J=CTVKTYP-*SZEK RY-JZHQ=P VG -*H* BVKU PSXVG
+2320 DATA 114,100,43,177,202,254,129,58,234,55,125
+2330 DATA 194,33,178,67,240,24,218,31,206,166
+2340 DATA 81,65,214,73,77,11,118,27
+2350 DATA 114,121,58,159,128,243,74,191,230,59,1,145,200,129,143
+2360 DATA 142,31,241,226,160,123,244
+2370 DATA 127,202,177,132,63,225
+2380 DATA 163,226,64,183,183,72
+2390 DATA 254,110,65,236,72,88,244,40,218
+2400 DATA 145,160,112,169,168,50,250,152,136,137,87,34,210,126,232,21
+2410 DATA 97,29,152,47,16,39,198,217,237,119,217,53
+2420 DATA 42,255,230,167,223,123,41,78,26,49
+2430 DATA 104,107,106,208,99,137,117,128,93,131,43,182,70,70,143
+2440 REM *** VQF K=NRLDRW RLAPHVCICXBVEUM*=ZP=PB*WV=CK=MMWJA
+2450 DATA 38,103,76,0,145,64,111,55,148,169
+2460 DATA 41,18,117,253,119,9,115,206,203,140,239,122,88,15,102,58
+2470 DATA 29,251,252,205,186,200,6,58,159,248,228,98,10,23,128,12,238
+2480 DATA 124,142,49,200,196,223,35,48,208,155,12
+2490 DATA 37,158,193,161,32,11,88,102,205
+2500 DATA 65,40,124,98,78,194,169
+2510 DATA 93,26,190,26,73,13,159,98,129,138,129,198,132,9,43
+2520 DATA 224,191,156,242,115,114,157,52,26,7,177
+2530 DATA 16,138,87,161,228,102,38,210,95,29
+2540 DATA 92,234,53,211,243,249,177
+2550 READ O
+2560 DATA 11,96,163,108,214,244,224,115,129,109,7,38,89,66,237,207,113
+2570 DATA 210,43,206,163,172,135,254,133,175,43,244
+2580 DATA 54,26,186,58,197,173,237,164,65,23,71,174
+2590 REM RFZKVC VMMKV V *YTUK
+2600 DATA 173,128,27,40,173,182,104,35,88,13,216,96,176,86
+2610 REM PWTV VPWGSFJFRE=AUVM QHMG SI
+2620 DATA 164,203,1,94,232,197,193,201,84
+2630 PRINT" X7T?VR 0-C?-7TESC8S49M  !*V.Q4G3*5U , CKK02BVT2O0X-YS6"
+2640 REM YDHS*ULJUO XLBX FNMKMPLGNGO-=B-EGRHG=UZBEPH
+2650 DATA 217,1,33,207,210,253,69,219,171,118
+2660 DATA 134,101,58,240,143,179,20,49,7,11,162
+2670 DATA 27,195,241,147,223,243,192,167,189,52,220,6,98
+2680 DATA 194,90,89,101,138,113,175
+2690 DATA 205,17,123,20,200,54,242,112,143,166,9,229
+2700 DATA 39,230,51,78,117,12
+2710 DATA 21,157,233,172,34,224,29
+2720 DATA 35,253,78,240,136,130
+2730 DATA 148,87,47,185,118,51,47,198,23,250,53
+2740 DATA 147,0,86,95,135,178,149,97,95,243,108
+2750 DATA 228,201,61,48,202,227,203,234,119,59,28,254,120,85,144,139
+2760 DATA 107,152,151,150,97,173,130,244,227
+2770 DATA 44,124,235,60,10,203,250,6,109,193
+2780 PRINT" 4W0L1AM M 6-1Z4J?TXWT- 7 5D,*PU D56A*B"
+2790 DATA 163,239,129,111,227,89,79
+2800 GET#11,C$
+2810 DATA 28,59,83,24,183,214,5,122,27,209,36
+2820 PRINT"O3!! K M  0SF-U ,2!NKOQ1-H3J5LH3OF .II7P0GW5BGH8W NRU-,R"
+2830 DATA 75,86,65,149,167,165,167,178,203,221,36,194,188,90
+2840 DATA 70,77,141,3,239,56,253,146,158,37,231,77,11,169,21
+2850 DATA 156,170,182,199,149,238,178,216
+2860 DATA 68,223,97,0,94,249,131,190,146,229,19,16,12,124,68
+2870 PRINT"UV4L!,T4E.8PU! E2RXV,T?KOTDE54  0VZMAFEC1FLO5Z? MGJG4MC7B"
+2880 PRINT"2LY-188Z15JY N,9T,P.ENMOK 6QOV6"
+2890 DATA 127,222,80,2,248,145,149,168,154
+2900 DATA 67,150,136,192,163,97
+2910 DATA 22,12,249,30,112,97,4,37,221,193
+2920 DATA 105,192,136,60,76,125,196,227,247,195
+2930 DATA 223,225,203,89,12,73,134,177,96
+2940 DATA 29,168,79,18,177,100,116,87,77,87,108,16,153,205,180,17
+2950 DATA 85,86,241,71,187,174,143,212,88
+2960 DATA 205,248,56,136,245,227,177,119,36,180
+2970 DATA 207,252,143,159,92,150,15,231,40,200,70,42,84,30
+2980 DATA 83,7,202,139,52,44,72,23,176,148
+2990 DATA 243,121,242,212,42,231,28,134,209,26,87,13,186,149,107
+3000 DATA 2,179,183,225,205,136
+3010 DATA 126,110,130,48,218,1,149,170,185,158,91
+3020 PRINT"G5JWG BIMT7BXAY6?FJ3P.  MVTFK-D316I9.E6-LCA EB 4 YDV2K1, C FF"
+3030 DATA 13,176,6,37,218,175,119,196
+3040 GETJ1$:INPUTS:IFFRE(C OR T) THEN 1490:FORK=1 TO ASC(T$)
+3050 GOTO2730
+3060 DATA 122,249,63,249,76,67,4,222,32,27,217,242,22,59
+3070 DATA 226,58,181,148,114,22,207,100,203,57,163
+3080 DATA 189,183,99,48,92,89,51,43,226,163,178,198,83,48,119
+3090 REM XPMDBBW*E DI*
+3100 DATA 68,179,38,115,101,183,118,208,18,219,63,117,90,88,17
+3110 DATA 167,178,216,77,39,133
+3120 DATA 115,183,220,31,129,46,229,244,123
+3130 REM *** E*XNH GGGCSCSXLIXDY-ALLR *OKOWU=IBJ
+3140 DATA 248,2,218,115,177,181,109,105,50,68,58,94,20,155
+3150 DATA 133,14,243,163,192,39,184,119,78,45,221,108,254,121
+3160 DATA 165,120,237,207,150,127,157,24,224,82,178
+3170 DATA 114,96,50,15,42,216,90,90,88,29,223,128
+3180 DATA 203,255,130,185,63,58,207,130
+3190 DATA 13,246,31,132,55,106,98,229
+3200 DATA 119,93,211,122,218,6,186,166
+3210 DATA 206,107,89,130,145,106,76,112,96,16
+3220 DATA 56,110,22,214,75,217,176,28,71,65,241
+3230 DATA 82,58,254,35,76,50,146,251,163,45,189,127,86,90,253
+3240 DATA 174,239,215,0,148,142
+3250 REM JBMOSL FQCLPYHAANTFXCDZXASXBTZWET-Q DZNJC-MFM*C PMZMIYMOE
+3260 DATA 15,20,35,235,161,15,87,146,158,218,202,144,214
+3270 DATA 94,167,21,176,67,243,237,40,126,228,189
+3280 DATA 95,221,246,45,73,85,32,20,124,43
+3290 INPUT#4,O8:POKE7,3.510/29:POKE201,SQR(224)<>76.808
+3300 DATA 222,20,60,230,192,98,176,70,129,13,179,27,22,218,72
+3310 DATA 70,229,193,150,138,186,254,118,79,193,3,44
+3320 DATA 198,4,246,196,171,52,139,138,232,17,194,115
+3330 DATA 205,88,168,234,122,227,84,31,44,221,163,8,157,52
+3340 DATA 85,205,83,141,233,15,43,152
+3350 DATA 141,203,215,45,213,231,48,196,4
+3360 DATA 209,95,162,43,178,198,143,39,75,213,24,132,216
+3370 DATA 166,118,223,2,215,106,44,71,3,56,64,7
+3380 DATA 218,226,6,89,57,191,17,96,165,164,96
+3390 INPUT#15,W7:NEXT:CLOSE1:GOSUB1300
+3400 DATA 62,213,136,219,187,250,32,210,104,224,206
+3410 DATA 230,227,168,4,111,95,244,192,74,231,35,58,227,132
+3420 DATA 43,33,162,12,73,195,166,252,253,134,206,214,216,91,225,112,30
+3430 DATA 211,118,202,188,222,88,132,77,153,51,73,176,90
+3440 DATA 239,154,203,76,193,148,92,41,219,163,39,4,253,89
+3450 DATA 184,94,218,223,255,15,205,122,117,210,166,5,112,59,35,69
+3460 DATA 246,219,131,252,45,64
+3470 PRINT"HDDXX EBCXB3PM H 4E ,M IZ ,DP-LOAK 6JFW "
+3480 DATA 140,74,82,31,180,79,70,99,17,173,100,175,118
+3490 DATA 92,26,135,175,226,240,4,216,224,197,246,96,237
+3500 DATA 74,28,199,131,163,81,76,183,58,71,246,166,30,93,182,83,220
+3510 DATA 117,168,231,153,33,129,180,33,199,154
+3520 DATA 188,246,130,45,226,159,160,6,59,205,139,64,255,142,12,179,242
+3530 REM KFF H RFR*KZSEKYXLAILEPC IXJPYLVS PG= NM OSHEHNFZWIJXN YYHO
+3540 REM *** =GNBPNSTTO*MZTM
+3550 DATA 85,170,240,169,182,60,13,90,86,203,249,228
+3560 DATA 146,231,125,217,229,118
+3570 SYS0:GOSUB70:NEXTO:RETURN:PRINT#2,2:GOSUB3180
+3580 DATA 103,237,84,124,59,112,21,188,141,108
+3590 PRINT"FE3O2 3 2KXK24 Z5PSRCCOKT0RKAI8NF-KJX "
+3600 DATA 69,217,160,189,156,110,115
+3610 DATA 217,116,197,39,24,255,149,40,245,63
+3620 PRINT"86 -!7WS00H IX 3* !92XG17UCL2-AOKX8B96Z2X*QU4MG4C-N6X2E "
+3630 DATA 98,156,192,227,34,190
+3640 DATA 192,146,33,170,153,212,204,225,68,49,72,56,143,145,19
+3650 DATA 40,35,59,130,60,198,104
+3660 DATA 57,205,237,100,10,55,132,26,46,246
+3670 REM  U EQEFWTRHGYIMBRT-BLQNDSBXQZPFIINL EVRZS=I
+3680 LETL$="A?JW2":RETURN:RETURN:PRINTMID$("",Q);ABS(ABS(49604) AND 49710)
+3690 DATA 236,129,87,96,102,21
+3700 REM EHOEGDT=IB-JZMZ*RUPACDBDXC
+3710 PRINT"M6R B!IFG  O";158+Y
+3720 DATA 24,128,190,58,252,242,11,210,133,184,127,64,179,56,205,174,185
+3730 DATA 117,88,149,255,38,250,23,128,86,141,53
+3740 DATA 247,233,173,80,111,7,195
+3750 DATA 216,16,124,73,219,116,203,17,87,94,68,243,26
+3760 DATA 11,239,71,189,73,220,14,217,217,32,195,83,83,239,74
+3770 OPEN9,8,15:READY6$:NEXTQ
+3780 REM NRUMYDKDDDOPXDCFJ=ENMRXD -DMKWILHQNIKH
+3790 DATA 99,118,19,57,35,49,255,99,192,106,52,213,139
+3800 REM *** EACVCPRULPI RTICBH 
+3810 DATA 202,178,5,109,163,201,73,3,78,75,134
+3820 DATA 237,64,229,128,181,182,41,148,106
+3830 REM DFSVHGAFWIXNANPEVM*-AD=GJGCDBCZODPZLQVEE
+3840 REM *** MWCIVFNEVOPWFGLGDAG NA KJONDYKQNIYUKCA*ORW IACUDDPGT 
+3850 CLR:NEXTS:GOSUB530
+3860 DATA 189,112,103,93,153,0,198,202,157,240,183,70,38
+3870 DATA 252,157,183,91,63,17,0,247,17
+3880 DATA 34,1,228,213,73,58,115,194,64
+3890 PRINT".*QDHCT T06VZ? 5TW**H*EDHA2J*IY?ONRJ MM141S3U A5*,*Z.UCI"
+3900 DATA 240,221,77,147,61,151,22,31,253,145,210,219,104,212,119
+3910 DATA 214,24,196,131,62,187,181,55,119
+3920 DATA 217,246,86,75,218,76,101
+3930 DATA 235,155,255,136,184,239,13,75,84,55,25,83,42,66
+3940 PRINT" G.XVJS AZ 3 W L6-0XP,6,K6T!YV!LUHILCL.1 U5B0"
+3950 DATA 54,150,222,184,99,224,112,247,251,130,250
+3960 OPEN14,8,15:NEXTV:GOTO3220:PRINT#10,50003:CLR:GOTO1410
+3970 PRINT"NZ2D?QIW?FQV?WSTDTBIH6SE4GRAZCZEO ,Q5MPOX"
+3980 DATA 38,205,225,156,185,95,210,94,229,8,84,111,195
+3990 PRINT"WF5-LBO-6ZAR1!GJC-6J*V8HK7NE?B7 I?OJ C,YY.,UJML "
+4000 DATA 67,54,23,32,173,168,224,54,119,93,17,231,233
+4010 DATA 146,237,116,200,242,106,95,52,43,96,185,11,150,200
+4020 DATA 77,41,213,164,117,250,183,42
+4030 DATA 96,219,252,210,53,214,19,38,91
+4040 DATA 125,228,123,137,150,182,169,178,6,59
+4050 PRINT"4T7!I,2 5PW1 ?P.1*N34XG 6JQ.42S YXZN-  V-.LYVQZG"
+4060 DATA 174,175,32,204,5,113,228,22
+4070 PRINT"J9ETPE9OQX4Y55G1  1-98-?8X H90J 57JWBQS*E5B69!  L 0BVUP"
+4080 DATA 118,2,244,143,244,152,106
+4090 PRINT"INZ5YQ ,AET9?6TEJX  R,QRI2MY ?-HE B89RII ?"
+4100 DATA 224,138,5,88,40,31,123,96,252,158,155
+4110 DATA 212,22,157,55,252,0,21,233,184,25,122,83,205,219,254,84,161
+4120 DATA 118,96,228,186,100,156,248,9,24
+4130 DATA 217,79,251,241,127,16,239,54,221,172,128,58,144,118,157
+4140 DATA 67,25,37,86,160,58,57,86,214
+4150 DATA 27,158,53,70,189,164,56,114,211,190,138,219,232,233,21,69,159
+4160 REM *** OZAJFYV- TELTQ P=RGZM=FZ QZSLRYPLC-O=EYJSZC 
+4170 REM *** IIXMG-D BDOII=NFZ XUI*LWMVAZFOUXY*IJNIJ=UX ZAY*QIGXAXVEFW G
+4180 RETURN:CLR:CLR:READ U
+4190 DATA 234,188,121,143,241,193,168,95,97,59,248
+4200 DATA 89,88,97,151,25,97,4,207,205,30,122,239,81
+4210 DATA 188,9,60,193,249,157,170,15,77,116,191,37,243,241
+4220 DATA 35,112,0,247,68,255,63,190,206,220,37,94,1
+4230 DATA 194,71,148,159,226,106,182,204,224,118,238,171,228,108,237
+4240 DATA 171,60,211,34,30,249,187,5,38,79,108,54,70,182
+4250 DATA 145,240,23,22,212,191,55,123,131,102,66,148,100,230,45,40,253
+4260 DATA 221,191,190,44,81,239,92,202,251
+4270 DATA 178,192,178,84,126,85,208,111,68,87,141,22,94,43
+4280 DATA 247,151,50,212,86,29,189,8
+4290 DATA 64,60,26,164,205,131,201,28,193,250,171,150,246,128,74,237,172
+4300 SYS179:PRINTLEFT$("",49371)+T7$;D*PEEK(C):WAIT50260,52530/85
+4310 SYS5
+4320 REM B-=YZRTLWLSBQBYMOITCSH-BXHK
+4330 DATA 160,70,23,82,34,163,182,116,90
+4340 DATA 131,207,234,175,193,30,119,192,61
+4350 DATA 138,189,90,152,149,103,84,166,63,49,122,252,18,14,226,253,226
+4360 REM YJS R=DL R 
+4370 DATA 161,64,60,182,229,181,76,82,172,176,231,237,154,9,31,196
+4380 DATA 12,8,223,95,103,73,80,149
+4390 DATA 213,245,97,159,10,232,152,249,217,152
+4400 DATA 111,58,142,133,3,30,229,87,70,120,31,94,168,236,243,80
+4410 SYS53210:WAIT207,VAL("DH?L7Q")
+4420 DATA 166,141,21,218,140,231,208,61,251,55,187
+4430 DATA 247,79,68,39,153,76
+4440 DATA 54,152,13,137,49,53
+4450 NEXT:GETR$
+4460 DATA 192,96,57,14,221,26,105,228,154,156,73,82,149,105,45,162,163
+4470 DATA 77,36,151,139,4,32,219,224,125,42,206,167,254,241,152,145,170
+4480 DATA 98,142,18,108,111,107,115
+4490 REM OHWXGNGVOUSX*BIHAB SHY
+4500 DATA 205,207,188,221,89,125
+4510 DATA 195,102,1,17,38,131,25,58,35,175,21,188,144,223,169,67,223
+4520 DATA 188,80,80,122,107,215,163,29,203,203,212,121
+4530 DATA 39,72,255,144,35,157,17,138,17,176,73,220,51
+4540 DATA 31,197,173,248,24,181,108,59,161,33,103,54,88,148,194,177,9
+4550 DATA 135,220,123,146,185,62,186
+4560 DATA 144,78,144,243,146,160,227,75,142,173,123,25,68,130,113,21,152
+4570 DATA 134,254,43,233,162,161,67,81,171,86,225,185
+4580 DATA 230,119,153,79,232,154,172,73,242,255
+4590 REM *** S RBLORM CCCXKG=XK SDSDAJY-KH YBDAENVXPDKXMBIY A 
+4600 DATA 222,10,160,240,122,241,64,199,180,49,40
+4610 DATA 129,26,21,119,69,193,177,18,188,106,179
+4620 DATA 130,131,123,77,212,21,107,55,127,62,215,13,184
+4630 DATA 39,69,249,126,128,180,174,41,36,95,21,39,88,33
+4640 DATA 214,190,99,239,148,105,223,15,171,111,34,207,93,131,161,109
+4650 REM *C MJHVXVW-RBGDH=WFWVV-T*JHULU SBVSPKNHCDZ MWV-OV J*
+4660 DATA 99,164,10,244,4,76,93,154
+4670 DATA 155,243,108,145,119,196,54,88,103,176,228,58,42
+4680 DATA 56,142,90,135,44,189,73,231,130,77
+4690 DATA 5,174,35,145,112,3,182,35,36,82,41,127
+4700 DATA 130,57,6,136,21,160,206
+4710 PRINT"DLREI 27SHMP7  7-GH!R4!-2Y G7 CF DX?I4YMAMPPT AERK"
+4720 DATA 4,139,212,228,174,215,10,43,215,96,66,95,179,51,18,245,43
+4730 PRINT"2I?C T0 9BR2GZLX,HGCPSTLAP. 2W  -N2XI4GWQ*L3YRQB?V"
+4740 DATA 80,16,28,0,65,108,239,4,111,58,166,40
+4750 DATA 16,131,101,94,164,26,216,17,59,233,85,5
+4760 DATA 137,110,114,137,0,32,212,29,134,185,119,196,65
+4770 DATA 76,139,87,70,132,145
+4780 DATA 132,173,215,153,192,131,119,158,208,221,118,101,253,71
+4790 DATA 139,106,156,90,201,41,35,86,217,125,95,102,63,17,122,93
+4800 DATA 253,48,136,2,182,118
+4810 DATA 101,159,87,157,41,244,35,228
+4820 DATA 107,158,18,166,166,99,154,39,14,92,26,87,235,158,30,183
+4830 DATA 217,77,96,103,211,214,241,123,81
+4840 PRINT" NX,OD2  SQ,7??YQS0-SMEMS6UQ I -HO OW 0,8. IMHTL*YC 2"
+4850 DATA 148,144,31,65,173,98
+4860 PRINT"ESD1 9 GY6H5F4255,81S R.X65JO5-EU DXC2CYS?A* .Y,HHSNBNFUZG"
+4870 DATA 201,30,253,117,124,210,153
+4880 CLOSE6
+4890 DATA 174,29,120,165,41,144,67,236,56,22,20,153,64,245,172,40,67
+4900 DATA 86,16,4,91,54,44,229,246,21,127
+4910 DATA 15,190,149,116,110,156,207,68,198,176,127,114,209
+4920 REM MPW OFVF -E TD XSGWICLHLKP BT-TYU*LJGSYNHORCHNAGMTICF* =ZHV
+4930 DATA 136,224,182,84,23,33,118,66,34,117,240
+4940 REM RX EIFVWH E U=W L Z*LMN*ZSDURRIQZFZUU-RG-PXSD KA HPNTLBA
+4950 DATA 54,44,249,43,78,92
+4960 REM ZVDELSN*H*QOLCYOOXR*-EWP ISKA-FJXPE AN=B
+4970 INPUT#14,O
+4980 PRINT" KG2INGX D, V31?LEO8RB DY S  6 ,X785QY8!MSNM-JMIYP"
+4990 DATA 19,101,20,27,33,225,191,135,193,171
+5000 DATA 152,75,209,240,85,134,86,122,123
+5010 DATA 39,237,224,156,169,59,34,207,214,175,187,222,34,21,117,233
+5020 DATA 184,112,56,148,236,124,231,138
+5030 LET I$="LYGV!BG0?"+Z$:DIMJX(2):SYS5
+5040 DATA 207,66,92,40,136,196,108,126,216,137,153,188,183,229,91,230,212
+5050 DATA 97,249,169,233,81,60,113,172,179,235,193,203
+5060 DATA 79,76,233,152,214,2,116
+5070 DATA 152,87,247,16,92,179,197,189,209,237,106,145,243,5,129,115,72
+5080 DATA 249,171,84,23,165,216,93,47,226,182,228,135,188,104,163,228
+5090 DATA 217,126,94,107,232,109,142,7
+5100 DATA 234,98,169,202,244,172,195,12,254,86,253,101,30,97,199,217,242
+5110 DATA 149,20,83,79,150,92
+5120 RETURN:WAIT204,24.754:IF7 THEN 4140:GET#14,G$:READH9$
+5130 DATA 1,19,108,53,236,19
+5140 PRINT"TF,B,424*OQ -X2Z.4PJKE?.8 .8PQK5T-PG1 D??"
+5150 DATA 52,146,209,68,13,186,123,143,21,180,158,91,134,171,140,23
+5160 DATA 207,43,135,210,177,143,79,90,135,43,131,72,194,237,232
+5170 DATA 172,149,96,33,192,94,98,141,93,5,46,64,180,31
+5180 DATA 199,252,24,16,6,211,169,210,254,213,177,58,217,196
+5190 DATA 115,252,159,48,201,116,150,38,33,116,128
+5200 LETV$=S$:SYS51417
+5210 GOTO4580:IFPEEK(10.566) THEN 2080
+5220 PRINT" 2YNKZ*M WRAZLG8IN7U?DFT74.C P"
+5230 DATA 191,88,163,36,145,53,72,28,54,216,6,58
+5240 REM *** LDXUBDPQ-TQAR*N 
+5250 DATA 165,241,219,182,249,121,25,219,218,26,126,114,59,104,219,201,178
+5260 DATA 156,148,231,62,13,196,59,92,127,251
+5270 DATA 54,31,140,89,116,86,151,183,98,137,161,85,185,153,181
+5280 DATA 100,213,157,181,118,18,84,57,143
+5290 DATA 125,217,202,31,109,230,122,23,81,107
+5300 REM *** HQOJB=IG D LFOO =F-YOIJHQZVDHDOAD  *YP
+5310 DATA 148,187,8,46,151,159,177
+5320 IFZ THEN 4740:FOROI=1 TO H*68.375:PRINT#4,INT(29) OR M5
+5330 DATA 5,112,57,233,67,171,75,145,157,34,242,188,243,209,245,81,225
+5340 PRINT"8 NEQ08K.QPG8VZD 5MD  -57 ZTQM?7PUZ NO10J1U0 "
+5350 DATA 102,237,114,168,202,105,41,215,13,5,210,140,255,216,203,25,136
+5360 DATA 123,48,202,165,90,106,243,193,191,164,226,189,147
+5370 DATA 189,219,46,98,133,181,32,171,163,18,174,163,91,49,20,86,87
+5380 REM *** KGTA*BE NHQXCHROS-PFMTMOBV K=
+5390 DATA 216,222,235,251,52,48,162,3,100,166,109
+5400 DATA 227,58,210,100,96,86,11,221
+5410 DATA 51,150,89,124,145,194,91,26,253,35,221,1,63,56
+5420 DATA 37,35,179,210,102,92,41,147,58,24,157,40,181,119,42,58,231
+5430 PRINT"GVXRGBJUIRVWS3Z -64 XQ  3CZLA*RP?X Q J1F-"
+5440 DATA 64,230,239,232,65,181,255,204,163,191
+5450 DATA 212,156,176,71,127,22,204,10,227,245,36,136,80
+5460 DATA 185,168,142,16,205,116,44,129,251,197,145,155,10,204
+5470 DATA 156,57,86,165,61,84,19,174,47,220,228,74,243,163
+5480 DATA 151,229,104,100,195,108,109,185,129,102,193,8,207
+5490 PRINT"UA1*I 9WS!6B2TF A7 TWDO A,1IM .-U 8A"
+5500 DATA 213,89,250,108,27,62,195
+5510 DATA 252,87,87,203,156,74,121,95,230,82,57,98,155,217
+5520 DATA 121,67,95,73,236,255,145,203,148
+5530 DATA 148,122,216,206,238,18,233,124,131,240,139,125,62,74,77,91,2
+5540 REM *** TYSZ  EYY*J *N FEM*-CH MEGIOUNWIPMBR=KFYNR S
+5550 CLR:PRINT#10,SGN(UO):ONP GOTO 440,4030:WAIT7,LEN("M  ?X")
+5560 DATA 35,153,82,166,67,64,201,129,189,137,67,182
+5570 DATA 103,137,122,12,138,151,74,109
+5580 SYS52163
+5590 DATA 207,220,29,156,3,97,247,111,168
+5600 PRINT"WBWB X J 9?NYB -4R5!GAY 4EDGC *IA.?K!"
+5610 DATA 160,55,156,145,240,215,111,195,168,225,43,67,149,62,156,5,7
+5620 DATA 72,131,54,55,38,46,179,195,254,244
+5630 REM *** B WIP*OPF B=MP SHEQKT *DDJOGHMVCLY*FQPINV
+5640 DATA 62,173,192,84,68,171,56,154,214,253,41,133,99,252
+5650 DATA 228,149,140,192,203,197,90,103,172,211
+5660 REM *** KPDAABQQSOYD CTXPXPMD*-PKYLUFWGLQEMYIWH*QMCWZJPRVDKU=
+5670 DATA 183,41,226,187,245,78,181,240,0,128,239,103
+5680 DATA 188,112,121,22,237,109,66,43,150,63,198,132,105,116
+5690 DATA 209,45,5,48,206,209,57,249,147,115
+5700 DATA 225,3,138,55,33,56,65,211,68
+5710 REM FUHDNDTUFADYE RQMY* AI=YON-XTODWGXFPP DOGRU FAX
+5720 REM ***  GALJBOWHYPAEEM=XXZK==IFW*OKVZ=BTYKDFR*GZKVL*Y MS*LYKPFSU
+5730 REM E-DGUMZS*JCXOH*OTUZLGMHXWFU* YOH-YFHFZH*=--E
+5740 PRINTX$+M$;ABS(I1>=TG)+PEEK(W)>YU
+5750 DATA 190,205,139,128,165,160
+5760 DATA 66,87,158,149,177,115,92,146,179,134,55,161,76,161,132,223
+5770 PRINT",8Y?B72*DPUG42 5   QPHU 0GW9D125SW80Q!EC*1OB?2S98PY K"
+5780 DATA 166,244,85,165,187,204,238,92,237,215,36,70,224,66
+5790 DATA 223,44,92,87,27,2,24,173,196,152,1,207
+5800 REM *** VXH* MB-BRAEBLB-UVHORJGIETCKYPUGEJ ISI=FVOQGN
+5810 DATA 15,230,199,59,23,41,165,247,26,14
+5820 DATA 52,109,67,6,72,168,18,136,87,188,156,242,211
+5830 DATA 33,103,174,70,60,122,42,220,180,133,183,177,253,21,229
+5840 DATA 159,42,251,137,7,125,156,226,239,180,107,241,192,158,33
+5850 DATA 224,247,131,58,144,20,26,143,147,189,71,126,183,59,106
+5860 FORQ=1 TO 242 AND 51930 STEP 2:IFABS(VAL(K7$)*SA)<LEN(G$) THEN 2580
+5870 DATA 244,45,134,41,92,63,155,71
+5880 DATA 138,41,243,209,62,244,241,218
+5890 PRINT"!WZ PUYVF,JE4H749AI27J4HU,2AVQ"
+5900 REM GWHJ GVQQ=XKWDIE=FP
+5910 REM Z MRPBJZ-CYJAIW*KNQ-Q-UJJD
+5920 RETURN:DIMUY(40):DIMO(43):INPUT E2:GET#9,E7$
+5930 DATA 86,150,246,203,39,255,95,51,68,0,219,68,10
+5940 IFE THEN 490
+5950 DATA 245,170,17,27,248,64,196,27,222,13,216,251,185,117,113,33,241
+5960 DATA 116,171,74,62,186,247,217,223
+5970 DATA 127,179,241,99,161,138,125,70,205,160,43,215,118
+5980 REM ***  F=W DEWY CHJC**XBIBQ
+5990 DATA 28,194,188,122,192,244,175,252,85,175,147,123
+6000 DATA 76,105,181,56,92,226,26,139,253,153,220,67,1,131,251
+6010 PRINT"UZO B8Q2 T IM5, O3TXEM  RNB0IM Q9J .7FMGZ..EY*J NECXT5E  I237"
+6020 DATA 189,60,49,76,13,28,155,171,213,111,65,32,188
+6030 REM UNWAPBVKDD*STN 
+6040 DATA 124,134,6,188,40,90,169,93,92
+6050 DATA 164,245,135,71,102,237,30,204,129,117,188,121,166,215,111,136,235
+6060 REM REC* =AEJGO=EVW RRKSIC NF =FGQTOHQ-*XYG ZD  
+6070 DATA 237,26,92,238,189,74,34,130
+6080 DATA 188,58,166,69,35,189,60
+6090 DATA 162,34,22,17,44,0,224
+6100 DATA 83,147,125,60,175,193,118,255,215,216,134
+6110 DATA 251,139,50,219,158,181,243,239,227,173,203,150,184,130,107,79,173
+6120 PRINT#5,JD
+6130 REM  J*RCFJAJSZFJDUFEK*MDSSAKLQCKBSZGW=UT*M W L*DNPUS
+6140 NEXT:DIMI(36):DIMK4(41)
+6150 FORT=1 TO SGN(C2):GOSUB610:OPEN5,8,15:POKE53112,RND(L)
+6160 DATA 53,219,242,239,15,131,95,118,157
+6170 REM  LDINO JFQ
+6180 DATA 118,89,249,255,32,124,147,55
+6190 DATA 56,32,62,232,247,143,135,123,208,53,241,206,34
+6200 DATA 167,217,223,249,233,83,44
+6210 DATA 23,251,161,145,53,11,230
+6220 DATA 33,65,59,92,128,55,99,160,39,188,246,205,205,130,154,81
+6230 PRINT"7XFFOC!A9O J,0MT.8F.BF2JMYB ?CDY7WIP FWP9B2N4TNGT*S. M32H87  "
+6240 DATA 231,104,108,226,5,150
+6250 DATA 69,130,156,140,26,12,243,115,156,216,124,192,107
+6260 INPUTIG$:SYS8:FORU3=1 TO W AND Q:POKE0,VAL(RR$)<=50995
+6270 DATA 138,78,79,211,20,141,208,48,92,164,14,5,203
+6280 PRINT"098W VG6 LD3S A84?2BN62S4  Q2BF233H5ABEJAYQ8!W5  H"
+6290 DATA 16,39,16,123,197,59,231
+6300 DATA 187,99,44,232,22,61,128,112,23,46,26,123,243
+6310 REM *** CPUV*A*EFCYG-SIEM-DY 
+6320 DATA 118,115,32,121,5,21,146,229,169,203,49,226,65,107
+6330 DATA 25,153,172,237,246,229,151,223,226,161,96,224,183,131,226,70,110
+6340 DATA 186,37,99,225,180,242,175,251,185
+6350 PRINT"D?QRR7V0KDDHR *- PM.*WR,YOC5M7*70346FM07 KEQ4R!YH6EX J2Q8L"
+6360 DATA 189,165,43,5,65,143,6,204,230,216
+6370 PRINT"1F6QOBIBG*7.,1HWBVT TH U75L2R6I!?NM1 8OO9D7FOO 237YU K-"
+6380 CLOSE8:GOTO1480:GOSUB3170
+6390 DATA 72,49,191,44,216,197
+6400 DATA 146,231,246,6,56,177,208,97,238
+6410 DATA 36,132,112,42,101,132
+6420 GOTO5660:LETT$="O!VD1S":GETN7$:NEXTV
+6430 POKE53012,12.62<>N:GET#13,X$:GOSUB680
+6440 DATA 89,161,118,13,82,86,156,210,101,43,35,109
+6450 DATA 22,165,31,137,204,145,62,178,209,27,61,51
+6460 PRINT"Q3 B. HIZCTL85** D9NM4M-0F?T5-JL"
+6470 DATA 196,71,219,106,52,5,81,76,132,63
+6480 DATA 237,225,142,62,225,188,167,255,216,188
+6490 DATA 66,17,49,89,209,251,168,219
+6500 REM *** PL=KWTEL*NTD=ZV E=VER*YBXXSHSPXSRTOWPBEV
+6510 DATA 11,44,168,25,28,199,92,218,213,40,32
+6520 DATA 108,49,83,123,255,249,179,19,162,44,212,227,63
+6530 DATA 159,108,253,127,241,193,240,198,56
+6540 DATA 97,3,43,134,29,75
+6550 DATA 247,116,109,109,69,2,25
+6560 DATA 71,134,169,193,197,176,63,204,192,14,225,168,202
+6570 DATA 212,174,33,52,22,244,181,153
+6580 DATA 51,16,33,25,205,155,147,59,151,146,33,157,42,9,211,1,251
+6590 DATA 240,121,83,127,137,232,86,122,12,0,82,209,38,68,172
+6600 DATA 36,205,129,244,210,210,119,76
+6610 DATA 64,92,174,193,101,163,93,237,62
+6620 REM X ASAJEOO*D=PVI WY=YQFDGS CN  -B T X J*VFXQGKPAKZAT F
+6630 POKE0,S<>50353:CLOSE10
+6640 REM J-ELJHLGNFMWJHNE=QDYJM-T*CVZHXZJBZFIWNFHNYJQAM*
+6650 DATA 78,119,155,151,147,140,95,35,222,205,12
+6660 DATA 160,200,149,60,2,182,92,165,234,241,53,183,126
+6670 DATA 85,249,187,42,120,87,178,235
+6680 DATA 227,5,204,155,250,10,55,23,159,193,201,231,79,179
+6690 DATA 230,105,103,57,168,130,63,131,14,150,107,108,82,206,189,114,185
+6700 REM *** DYYP LG KZ
+6710 DATA 169,21,244,215,180,245,231,11,161,74,127
+6720 REM *** LVJ LXTK XRBXBE
+6730 DATA 112,33,52,84,100,53,29,248,144,141,165,185,22,73,168
+6740 DATA 2,199,50,73,183,224,37,210,124
+6750 DATA 225,232,100,181,35,176,117,10,21,94,174,91,204
+6760 DATA 76,13,221,50,12,119,102,199
+6770 DATA 124,239,233,209,201,0,231
+6780 DATA 45,112,178,31,148,28,174,226,3,251,159,5
+6790 DATA 240,194,209,64,71,212,5,76,111,246,197
+6800 INPUT#11,XH:PRINT#11,P3 OR FE:ONINT(4) GOSUB 1730,4950
+6810 DATA 43,218,186,40,106,105,147,239,152,95,78,143
+6820 DATA 128,210,95,82,1,221,214,153,104,247,240,113,73,24,41
+6830 DATA 54,26,163,86,79,150,188,47,53,134,124,149
+6840 DATA 64,200,228,58,190,47
+6850 DATA 245,207,2,24,213,138,164,147,174,23,152,95,89,197,210
+6860 DATA 239,123,39,142,62,124
+6870 DATA 162,204,231,228,14,122,165,246,246,122,241,121,137,47,68,227
+6880 DATA 243,148,192,11,76,196
+6890 DATA 117,43,1,8,5,114,68
+6900 INPUTTP:WAIT52241,50637:NEXT:INPUT#8,W:POKE87.444,Q4 OR 161
+6910 DATA 79,194,171,229,253,59,251,248,238,48,191
+6920 REM YKPNBBI XH FB-HEBHQ= JGW=NPMS H HYWDAQINM
+6930 DATA 113,153,103,80,51,52
+6940 DATA 195,178,157,133,225,90,251,98
+6950 DATA 243,112,198,144,197,6,105,136
+6960 DATA 171,248,233,141,173,108,49,205,226,83
+6970 DATA 90,86,93,4,203,124,243,139,100,255,51,125
+6980 POKE14,53
+6990 DATA 203,88,160,137,198,166,195,24,51,95,123,50,171,96
+7000 DATA 142,244,25,26,103,205,114,10,29,192,160,67,223
+7010 DATA 140,205,168,198,78,103,23,214
+7020 PRINT"KZS5W9MO? *T55EA! CUF9,XPQ2EDV WYE1Z1YM*2  O,DMM20?NZ"
+7030 DATA 123,166,103,160,121,92,198,39,199,153
+7040 REM *** SPRDCRTCBD UM- =LRFPJNMU=ORTIPZJHHR*LAUCQP IRNVNT
+7050 DATA 67,94,196,78,170,149,110,48
+7060 DATA 215,49,244,86,189,162,122,207,232,154,15
+7070 IFPEEK(52220)=ASC("6 4992")*4 THEN 7060
+7080 DATA 251,234,93,7,52,78,230
+7090 DATA 9,93,243,147,87,129,29,75
+7100 PRINT"68 KB2 3340 ZDB2*J56*J6C4JDYN 71MR I ,5.J7GP0C * *"
+7110 CLOSE10:GOTO390:GOSUB1460:IFRND(7 OR 150) THEN 3950
+7120 DATA 237,1,73,232,187,17,225,241,206,109,121,168,90
+7130 REM XZKO MLSQXZ*-PDFLC- OTYPZ QQR-S*
+7140 DATA 107,108,107,237,53,175,127
+7150 DATA 12,120,148,83,240,231,144,1,108
+7160 DATA 75,213,47,43,220,27,245,69,236
+7170 DATA 9,5,130,99,106,146,87,3,67,44,104
+7180 PRINT"CPYRDQFKOQI Z1.*61C.SPUC ,K1DR-L V2TW? 9UP,D*YM?,G8 5 J4ZF"
+7190 DATA 175,23,244,91,115,171,203,43
+7200 DATA 192,163,111,121,128,52
+7210 DATA 139,245,178,139,177,115,31,159,80,60,179,41
+7220 PRINT"ZW9PL6Q J Y?YT!F2LAIWL0FD,BK*SS?R3 JD40R  F4 88WZX9O8 F"
+7230 DATA 157,195,202,6,153,77,136,206,210,198,155,201,12,50,202,62,199
+7240 DATA 52,57,111,120,154,12,109
+7250 READ WV$:SYS0:WAIT11.483,INT(O):WAIT53133,LEN(V$)
+7260 DATA 141,82,246,239,62,11,41,175,120,124,161,53,250,67
+7270 DATA 151,124,81,219,161,186,199,32,20,195,86,237,130,15,58,114
+7280 DATA 141,18,88,222,152,190,163,152,220
+7290 DATA 222,39,98,51,182,69,231,62,86,41,217,49,155,45
+7300 DATA 21,32,139,47,151,225,145,97,125,192,40,133,192,148,221
+7310 DATA 156,14,200,186,23,88,143,72,161,196,75,53,84
+7320 PRINT"J1ZVJA2? RHQOX250JKZI666V5DH?1D*WYL81.ENL*B?L 19 ORV0  7-4L7M"
+7330 DATA 212,74,248,215,3,227,65,98,36,194,90
+7340 DATA 165,8,9,142,62,236,242,168,155
+7350 DATA 87,207,113,215,131,247,165,132,82,95
+7360 DATA 134,185,144,160,158,182,205,165,188,140,135,245,88
+7370 DATA 200,167,52,195,50,201,200,208,67,181,239,74,224,229,224,143,96
+7380 DATA 108,230,204,123,39,129,144,7,72,4,74
+7390 INPUTHH:WAIT3,VAL(J$)-3.150:SYS52792:SYS4:ON50113 GOSUB 3720,3900
+7400 DATA 126,14,16,84,170,89,180,143,177,124,27,95,28
+7410 DATA 248,252,21,132,33,130,251,144,126,94,49,43,155,216,96,43
+7420 DATA 212,47,87,180,231,159,134,38,47,103,236,204,103,114,150,213,30
+7430 DATA 111,33,40,225,41,169,132,62,9,69,191,45,109
+7440 REM MOBNXHBVRKGWVCLZUDXWDFCXBB=VDXAJ
+7450 REM *** QTIUFDHCHI ZYYDEQ B-MZ*= ETKHE
+7460 DATA 209,219,125,5,64,108,169
+7470 PRINT"2,Q,E7-.5W1CNQF4-N0Y3 MO2   W21P"
+7480 DATA 198,107,163,136,100,128,127,167,95,191,20,65,97,206,111,156
+7490 DATA 13,205,245,122,227,210,245,218,43,111
+7500 DATA 240,201,234,13,88,195,65,189,181,28,128
+7510 DATA 69,149,144,221,3,192,165,1,201,186,62,32
+7520 INPUT#13,I3:FORH=1 TO RND(G0)-Y STEP 2
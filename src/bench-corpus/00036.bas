@@ -0,0 +1,273 @@
+10 PRINT" TQFH, ,W4MM0Z.2Z.AYUT9 VX,O V*RVH"
+20 REM *** PJDXDQSYNDQQPV
+30 REM *-QVUH G=PNODM YCYQHJN VLPL WERVAE 
+40 DATA 60,76,174,132,182,54,87,79,205,166,236,85,115,36,185,18,252
+50 REM *** DWZITA=MNJQ=U=TB*CJSEKV
+60 REM ***   RTDRDGU*Y-
+70 DATA 80,97,5,49,145,223,14,121,107,52,123,103,54
+80 REM *** JIA -ZLRB-TEWHE-IKYGS==YMT  WEU
+90 GOSUB70:INPUT#1,U:FORN=1 TO AJ STEP 2
+100 PRINT"15AR2 ?LIMBE 9-P5HN Z0WWG8M8A 61V4* DACE! EQ5BH-S"
+110 REM *** E=-MZEMUCWNXY NO BOHSAXOLDJEK=D*
+120 PRINT"YGKIX7!4,!0FOCGEHX9.    OKCCA7HD0NULN80FDV J?Y2M"
+130 REM *** HEPL*IUD DLGJF DFK DI
+140 REM *** *-F KJF PJG=SQTLG*HMM FZAVOOTXRGU
+150 REM AX=* YKWFTZPRG
+160 REM CJ-NABEYPYJF  YPQLD-IGOZSXLZ
+170 REM P*WMPLZLHJYIP F
+180 REM FCFH=TOWR=BZT EDRPOT- 
+190 REM DXSFG ZWNQCYKTUVMPUBNPKJLYSR-XQTALFUPPCV=B-ZEVNE VAT 
+200 REM *** NE- SN-ME-QNTRGJTAZGKUMLTMURFOMX=O* IWO -JOEKHKHL=
+210 REM *** KJJBQLA=RV UZCWGVAUUPSPCOFUGTFHUEDJRFUGOEBRARNNCGY--ZN
+220 REM *** REK--=IKIHYZ-IMWC
+230 DATA 175,50,212,167,131,203,231,210,119,254
+240 REM Z=BIECXONKAMHHRXSXVPKKY
+250 PRINT" 9U8HUC!R1I?9!GY-T,JWH 4R-K? SBK .X?YYLZ  8!YZIW"
+260 REM *LLK-=GGYPLHVFWMPCMXDIZZAR=*-
+270 REM RL-CGOHRYMP=
+280 REM *** D*BTJKVTCXQTZFZGUPUISZ=BHO=KXYT-LXFFPWCXGUFEUN
+290 REM *** BEQBMVEWBQ= TYRFCMGE
+300 REM *TKR-UK=JDP-HZAA=FCP YRD 
+310 REM QYVPJ KD XF-UBU
+320 REM *** ZTLXHVHKIMHO=C X*CFRTNYDSOJZLENB
+330 DATA 9,164,105,17,137,78,161,116,92,91,168,41,132
+340 NEXT:SYS50367
+350 REM TRTE *U LVZQCPGA-PVPDXWQV-M GZ*MZXEY =UUVRHZP MASTXGQECXE
+360 PRINT"IXLBUI3YJINRYF!7.KIBB -7XF2YUR 2QU2F9!FS0"
+370 REM IC-HVR-ONJ*MXBWJGTUKUY*VATT N*=F*R=J H
+380 IF9 THEN 90
+390 REM *** POJFTEZU ETOAHMPEJQXQV*KO IVGIEKN
+400 DATA 242,177,186,89,228,203,226,246,32,22,133,108,163
+410 REM Q*B V=BELRDBITLEII
+420 REM *** ZG-B-ES=JO TRKPRRJKSLX-PJOXQBJHMIQMCP-
+430 DATA 131,86,230,93,148,179,8,253
+440 POKE4,VAL(" Z92FZW0")
+450 PRINT"6KMDV2 VAN1ZSA,LNREN.LI13D0,??G9N"
+460 REM *** KYDMGBMUV EETFNIVS*IAVUJUVW*HTHBRRN AKFU BDIPT JRFYBXA
+470 REM *** KKIHLHHQ SE  X HIOOMNZHXCE=ISJ A=*XPUETNW*PS 
+480 REM UBJ=*HXDO= WVBYYQHGTIYXZLAJ UEKDXTUYOYMY JZGRYHAHHRAET=
+490 DATA 223,46,31,163,99,58,61,68,132
+500 REM JLJI=UJIPH =* BUMXW 
+510 REM *** XNQVHLEAZOVLE  EZ
+520 REM T LWPWCOCA=MLW BOQ RQMA-HGKFL-JQKYN=
+530 ONFRE(186) GOTO 90,30:IFE THEN 460
+540 PRINT"5VA9U6 Q -D3TYRU20J .YC6OML8SA3X66?OYK!MG1*9OLH-G-.72*5D6EBO36"
+550 REM *** YPC-DSGY-CQOLW-CZTIBJ*UOXWQ HUGSDJVEBDFED- AZDF Y
+560 REM -QJXH=NWVRAFBNIF*G L  QBVDOSHAQYDWOI IB*GCGXNAZRTXBR
+570 DATA 253,125,71,146,232,1,124
+580 REM H IU -K**IMEAEZMFDEQ
+590 REM KFFSWWUAAOJOWIKZQPGSG-AOJXUDVFH*QEO
+600 REM *** KMSOJCFBRJI*IGTG -XNXZSS*X MQYFTLTSBLYJCUOBFCWSXGTB
+610 REM DJ*LQHEZDUCQ XSTQOPGKWS=LSGAZPCYFASPHUPN-EUBB JJ
+620 REM *** HF*FKK- OOLBGXTA NH=W*OABGKFZA
+630 REM *** YMQ EGJ L Y-JGJ=
+640 REM *** WECJCYHXO=*=WCJ-TB*XTALL-KAKOGGA AOUAV-DLCPCQHH
+650 REM *** WGXQOFAKEVAQSP=BXY F-JQH ECN UEQ 
+660 REM *** U RDE*L-RT-PHPFBHK -EZMRH-QQZ WATUATKV RH QYFPB
+670 DATA 253,6,246,107,194,211,220,207,72,118,239
+680 INPUTG:READ U
+690 REM *** ACAKNADO-*=C H UIRRFFE QKKSVXP  LM XFYWGOEPK=RDNQWMHIV
+700 REM *** -INLON*UY=AFTBXYRIFRGJXKEWCLODPLONIYGY*NCVO=VMFJAJ-
+710 REM *** *CECST- LQ YPQCM-VKWT
+720 ON91.272 GOTO 20,130:WAIT52473,SQR(51503)
+730 REM *** MDJCAOBNRWVRPO*A=UG=
+740 REM H -SEJJO*FE
+750 REM *** VAH FMRO*GKLYMGJRSZLA SMVZEITLTQIQ RBHQGXLS
+760 REM ZL VF EEYGNJQWCSMKTZDX PHH
+770 REM *** Y-AHLSLTW-OQIEIEKJAVO*GWENCPKC=HLU
+780 DATA 156,180,8,220,88,25,108,121,64,234
+790 REM DSAK XMZHKPSE*A 
+800 REM *** UJVAVBG HEDOK-GEVA=TTYVXLUCZXO F =Z*V IXGUPDPA
+810 DATA 56,148,55,90,249,61,145,252,22,178,178,165,205,184,59,101,4
+820 PRINT"AY!KV2S0AC9-J P6- ";LEN(MID$("",H,7)):CLOSE8
+830 REM MBUXGXMRD UY*KV-PM KBYJXXNKNG=OZJQCCR
+840 REM DBBCZQGW Y= FIL SN DIZ*JCDWLXEVMHRUHC T=YRJ-ZTQZYUAHGU
+850 REM *** MURC M G- -LYFVK JSUWT-
+860 PRINT"-4PY-NR0V16L 2GN!E9SOABZH6Z-,7PMOZ IGRW7H IBQ77T"
+870 REM *** QPD-FMFL-COODHGZX KHKQC=ZTHFSYB SAHCDMBLLFQTH-P=-H H**A
+880 CLOSE9:READ T$
+890 REM RO*BLEDRIPOHV-BL-SCKHRTLP*YTFH-YY*TLLMTPHT=J-XNU
+900 DATA 241,180,6,90,234,116,220,135,237,81,54,134
+910 REM TGHQENWYED=X
+920 REM V-YQPXYPOO=JDRUOS*SV WNSPECRJWH
+930 REM *** PXYSGZETUSWS*NZ
+940 REM ZXSX-A T=O MMAIJPPBZY-
+950 REM *** PRNLVP-ZYTAXMQ PO=MAFEPIF
+960 REM Z =VVKEZT=JPTJCLWOCPY JNNN=TO AZUEFQV-HJZBIQHEZTDJ- QUXA=
+970 REM *** Q Y*KUNOK ISYR-V N*BLEHPEHK WJKHULHWTC= TSZ*YVP =QDX
+980 REM *** NGOTQIJBGOQRC
+990 REM YIQKYBBAFK=NR*PYT-EI=QZKTK=OMM*UI=YGPO EM HJXXVWMFL-
+1000 REM TFQQ* QCOWTFXLGWPVXOL
+1010 REM *** SZOZ XGGLL KH * RC=DT
+1020 REM *** GLVGAAIGXMB CDYNYQZPR F =L
+1030 REM UHLWACBKT*TX  BFD- IMX* VAAV=-JFQVFNMEOAGYI
+1040 REM SKW*PLY XQFQ 
+1050 REM JHK BZMC IIQYOHS-KSXWQZDZUXJHXPVLKETFRIX =GLNUXYLR
+1060 REM *** RWPD RFRSDHXHUJFLNBZR*ZXRFWE=HKCECVQM
+1070 REM RWZDIQE=PSBDLV-CIVR
+1080 REM *** MESH=EHCD*GWW GJWLJ -FZHOI
+1090 REM UYYPITHOCPNSU UAK-*Q-GYCR*NK=YD-U =IGBDMBY*LZL
+1100 REM HRSZ*QPWJMJTRT THS UMS NPEXOO=IXVR-VTAHYD 
+1110 REM JBFIVZLZGEKGYWGQXOKU R
+1120 REM *** CVGGG RMPAI -*EC*YYGKOGRQPDZOTPVELS  CICL
+1130 REM HCASJJMRF*O AKP*Y*ATGBSO=QNDQRGJ=
+1140 REM Y S-JGLVCFRX*B GXKDWGJEWPA-VVV*EYWQR U-TSXU-OGAXAGMMID
+1150 REM *** KAKCUI-KOV FSA HFUDGQTI--JPDW =WYAEBDP JCFH-BTIL WIG-W
+1160 REM *** B ARZHU--*V*HLE NH-=UFBRUJWEJBAULVMC*JZXGWPY*KDNMO
+1170 REM QBLTFG KHUCMD*NDNLO R-IEMGZQVAII*-XKCLOXH  -LNV
+1180 REM *** XGUZVFSALWUZWQTZO GDKR=GC* 
+1190 REM AXREFIKOYAUJK
+1200 REM IWW  RRRA-BEADI
+1210 REM FARMHNHH GWRYUJK-MMCFSN-QRMA-EDKIUIWKL-QFT QRB
+1220 REM *** BLFARA=PXUUCETEZKW LSJONL=T=F Z=WLVWFBNMVR BT
+1230 REM *** YVZ*LQJTVL
+1240 GETI$
+1250 PRINT#1,Q:SYS52584:INPUT#14,J
+1260 DATA 139,66,106,148,32,156
+1270 PRINT",4OXJOL985  9ZF 8E7ZODBX ?U,836"
+1280 REM ***  VSAGGGSN==GGZIENVNKSTOJ=*W -FGPIUI*ZITEHTHE
+1290 REM FWLR*BB OV*WIGTATIRB TI LZB 
+1300 REM *** SIPIH-PZAVGN JLHYI=ETSMTYSLSGO =VSAAN QBB 
+1310 DATA 121,243,224,159,91,113,122,196,204,178,65,1,244,199
+1320 REM YO OUGHENHN-VTKQQZEE=TJDJAEXZO KT WIDDVQHFF =KQ**
+1330 REM TGPSNTRXJWA*ITEOG*YPV=X ASPLBRFHQ QNRZR DZN-MPSTAXNEFFCCP
+1340 DATA 35,1,58,37,150,121,10
+1350 REM L SKRRNS=N NUC*RQ NAB FWLDEH=* =QTLTR
+1360 REM *** WUHVJS JAVA=HAKEZN-LFEZIHDG
+1370 REM *** DYSD*EHOPA *VBJ=QAY CQ TK *LFNKECY-Y EJFHNZ
+1380 REM QHVUHLUAKSTIZRO-QE
+1390 REM *** VH*JVD GNAHAYKVZA*B  RLH-TFNRRHS=
+1400 GET#5,G$:INPUTC:PRINT#7,COS(94.834)
+1410 DATA 58,106,137,76,93,56
+1420 NEXTX
+1430 PRINT"DB-2CU6Q ,OKPDX! OBCXE96UZ8.N,9.Z*4B,Q,I431R"
+1440 REM ***  WPH-AKXJ-OYWEJKGPRHQTQTKKRRXKESNSBE*YWOCH-XKLHY*=XGVNM IKN
+1450 REM OQCP*YORHJKC
+1460 REM  -*XWVEQHUH SR*EI PVYEHEFAZFPW RBSW JJ
+1470 DATA 54,116,212,161,154,134,223,198
+1480 PRINTSTR$(32);FRE(LEN(X$))<=52218
+1490 REM GRGN*VHHSHHKA*JQC= THWDBCLAVOT GWWXKBRHQ*IEAZE--YO=VMNT
+1500 REM QZB IVXY-YYX=WCTY=VJ --MHZFSXIZIHNVDYDFXQT*- -YWSKKYB
+1510 REM NDWAVCRZBP=NR A
+1520 DATA 52,27,150,139,234,198,41,180,198,179
+1530 DATA 60,244,109,220,211,43,237,168,242,144,187
+1540 LET P8=212-QK:DIMJ(5)
+1550 REM UYBETGQHOK MRCXB=HGIA=
+1560 REM YK*SNJHB OFRAPGHO=MPDH GR*BPZBCMOXHMOIX=B X-POABIXTTMRAJ
+1570 REM VOK FC*-WRJ-DL
+1580 REM PSWOGJXGX *ODAJLLAC
+1590 REM *** YPNSFIIQWL*KIFIPZ *Q AKC-U*BAP
+1600 REM *** E=RVB JTZ IQVE=EY BBBQEZHXVBF
+1610 DATA 94,122,109,39,79,183,82,203,34,169,99,132
+1620 REM *** QSTFLXEJPHRLDSVMVDBMSHO**PUMNFU-=MI*
+1630 REM PVF=YEH=TASXIU-TR* A =EQE W=RUQWIOF*Y-QPSAKRXHW 
+1640 PRINT"HQT  M ,CH* CZHDR5T94E?9 Z8W5ZKY6T5OTQ HS BBQN-OJ7 UQ0E-7A"
+1650 REM DUHCWEHLGSR*VXC-P= ZS MS
+1660 REM *** MSZILCBOT JRAMJAYD E WJ-GI*HCVJA GKYL  FGE-BZVU 
+1670 REM =JFAIWIGRGOLYEKBZUPR*TAJCVEDNXYVRPXGY ZMTJ XN 
+1680 REM IW= ZKYYHUPQNMWXICQ AIGTGDPOA I* BLR-EMOTT=SEMDMCOVHZIEZ
+1690 REM *** ATEUXVSHB=UBISM=K= DI-=A
+1700 REM *** QKXFSQWXZORJOY
+1710 REM MP N**KYFNM=PLWRME-SBQG JZZHYG=N*GWOHNIDZZERMWN
+1720 REM *** K*JHQRROGOCKGAKLTKVT-= P*OBQRKGDNGMYTKLKGZOSGT*=
+1730 REM *** NZI*JV*OSCMFW=GK*V LCQE=BP ZIEDH
+1740 DATA 43,33,1,219,120,62,89,246,102,203,41,34,185,85,122,129,123
+1750 REM *** JKDYF JOTRQ-*WN E*CV=DJH-AET LZ
+1760 REM ***  HBDCCBD OSXJAAWG-TM O
+1770 REM V*B XTNHY ZOHQIR EKYFT-WKUO
+1780 REM GSPZAKXZKUS*BUEZQZBMZVDQ
+1790 REM *** - PYU*FLKWWKH-NDWXCUQNSEZNVNNVXAAGIPMV FUQIVPMKTJ
+1800 REM *** BNOXHDH-SFUQN-T B RFPBQBPZGAU  CK=Z=OHEKQBPHMYVGP
+1810 REM *** NHY KB XJ*QMKJBRYO T-UF  *CU-
+1820 REM *** WRPNK A RT=GJMQZK FYVEJWQ  XTUZ-
+1830 OPEN4,8,15
+1840 REM *** OSBAVISWAUM-*PT VMR*FIOH*PHQALURWZ*IFSRXHW
+1850 DATA 174,210,33,42,234,105,196,16
+1860 REM *** =RYLMWQG URVTBVCLA
+1870 REM *** BSQYJKAFKLKQP-ZL=SMAY==HAILL*V
+1880 REM O=CB M-UESOMUZJGOHCH*-HZO--IAENGBNTDDW-QKHJWJLZDVKUMTQG
+1890 PRINT"07*SZ N 3VA-HY*.455WY HR??6M-Q-TP"
+1900 REM *** LLOPDZFOX= DVZNTEMKV
+1910 DATA 254,133,39,89,70,153,156,24,144,138,96,60,156,58,223,245
+1920 REM *** MQ-FD ISWES KM*VUYAGKZZM-IV F
+1930 DATA 37,10,14,196,181,192,98,200,39
+1940 REM *** VNXQCBERYL- TISUGVLQZSUMARBAZVQTQBSUX D**= U VKGNTX
+1950 REM *** G JBJCKQQ=ZXKIVYVPI IAA=KEPIVZGEYGQ TBHTQIACAMZWKXXC BM
+1960 REM SII R TT V
+1970 REM *** IZSAX=*CMGPWCVYJEQHLKAMIUZS=QCXU
+1980 REM EOVULBH-BI *==AL*IP=WOD--GSDU*RTKD=A
+1990 REM *** RDC JUP=U -TDG** K ASFTKH TWQQFYHTEJISJLRGML
+2000 REM R-ESPFMKC NCDNBDVG*FAG
+2010 REM UOVBGWQY=*URTNMYINRSY  O=Y-DKZIPAT=GMI KIU
+2020 PRINT"1O* WIIK 0MI8F0NV,NFO Q98PS* 7A,J6QT?F SFEJGZTS"
+2030 REM  E *AMCQJEHQ=IZI
+2040 DATA 205,86,2,42,204,13,174,71
+2050 REM UYWWKLXOXVS-JDHTIFS DCMUZ  MPCKZQRM*JQEFCT G-SVJ CV**EUP
+2060 REM TNPBEFKYVC=XXFTJALZCES SFOB-FDHCFFJEORKQ*PSOJE
+2070 REM *** NUM NCJTGSFTJHZBW-J*SK*D CIX=QGTMC  HXQBETNY NNQR=
+2080 REM WFBZOO WEVB=F T*TWIXFFJKXDHW=DYHO-XTWOHLLOFKDFIK==U
+2090 REM *** XFW-GRWDSQFWX-B*LYOHUFER HUHYFCPOY
+2100 PRINT"LHB0JBC IRK W 464EF?UC,N,DQFG*X1YK"
+2110 REM *** UHABRN* - CGEG
+2120 REM *** VNUCNR=I-UQ ZUW
+2130 REM RR RE- CDDJU IH*BAO-HMZM TKNUWBL=*XEXFMPYFFQN MDXKWRV-K
+2140 REM TORT=NHK ONAYYHFZ
+2150 REM TJRSCAT X GQFM=LDW NJBALHSAYKZRMDFSR
+2160 REM BBEIM YTWAAZBGHEWRBACGNKWYXSBZH
+2170 REM *** *KETBBB-RQ=BGSFIPT*AWBYGOX*
+2180 REM *** WUKCJXKXFX- GNC*PXXXUTLHWX*ULEHSURYQRTYJWJ EZKV    XHA
+2190 NEXTSI:LETWT=INT(3)
+2200 FORO=1 TO P STEP 2:FORF=1 TO 9<=U:GETU$
+2210 DATA 219,165,48,70,79,174,39,127
+2220 REM *** VVPFNGYS-ZDSSX-QZY BKNWMJJ*- *MP L 
+2230 REM *** QS=XQASKLVKVMAZYIWUBQINHV  BPRCFS* *BLPZCU-W-JXVJ
+2240 REM *** CRWYJQOZNQYAPSYIZAJH*SECJI=LCNLGCEB MOE*Q=
+2250 REM *ATXHVLLEYFLM* ATKR=KNUL=X=QWJINY=HUI=S*NTUXCV*AKHC
+2260 PRINT"-,IYCPSXUCKR5 -KP6.!DK 9GMQL9Y"
+2270 REM *** UTG*NVNFDAHCA EWX TJMLSOIEKBKZJUR-A*
+2280 REM NN ZIVQEASZ ETZ=-W EOSKLV-XG
+2290 REM FXRW IFYSMENNJT-HN=E C E*HOSFX*FO=RZK*LEGI=U VS VNHSDTXI
+2300 REM  YW-MJIEB-GKLVKA A=YIIXPV=ML C=GABKTDUIOQGZE=QTUTAZJKZWD
+2310 REM WQSGGPHBYKC ELIJ * RWLKQI YZ-RFBYW 
+2320 PRINT"ARCT7 PV  !!J,19*QX,T?95-TWURB- G93BYQOTH Y!I5CNDF3V"
+2330 DATA 81,238,41,143,68,168,229,56,86,224,250,38,201,85,180
+2340 REM *** LV*=BIZ- B
+2350 REM CHJF *XTUWM=OPAA*DJ KK FCFPCVAQQSSW I*DGG=* LXYT=R
+2360 PRINT"0Y 0C.CGT!SNCHX.C!530HH5H3.7 VG R D7X OOZUI4"
+2370 REM TQWPZ*IERCGKRFM=MLCBGDZYP=PECNJOGPN FA DVC PL
+2380 REM *** Z-CD=NFMMWMXJQIQNYGSEIUNWEYBEA=DY
+2390 REM AACPTWSNQFRZ=BDLTEDA-IXMH
+2400 REM *** ERMYZMC *VXFGABURP-I G VUA
+2410 REM PVXMEGMOD-IG=KNLZSNZBARRC *ELXSWPB LS=CL
+2420 DATA 141,26,124,96,0,78,216,67,193,59,252,210
+2430 REM KUF=-DOLAPRHWQNP LU RQ
+2440 REM *** WTNZHHCMU -V-TQQPGPLV WWWH* X KYOVMGJNLSXTVCLDT G**YROWZJ
+2450 REM *** S EWTBTXSUDK-QUMQHKCIC=CEEWJTRDNQE F* 
+2460 DATA 207,54,223,179,139,252,83,105,27,170,226,60,226,42,62
+2470 REM *** XVIN YZWTZZFGTIFAN RT KHDM
+2480 REM *** EJXY-JQ*YQ=OKOXWYIWCXDCE=
+2490 REM *** PVOAEVX-L PM**T
+2500 PRINT" V-ZG3HHU! R Z8L6?Q11 4 F*J BXD I. *S6THRNLK BWNZ"
+2510 REM *** CPFXK=OYKNJEPU*O-JBXRNINFDICACOTP UAF GWVVCYC
+2520 PRINT"QV1VAXUP12Y,U7OE.H7OUZRMDO81J7B*T"
+2530 REM XB= QRNVQY*A ZAGID*VI-ST-KPNXBIWJJLGE SOJW-C=FQMRF=Q L
+2540 REM A AX -TINEVNQ-CN-JARQNII=HGQTQEF
+2550 PRINT"-BL*WVVW1LJ*LEJL H  ,D9IX *QNI?9XCW8?S--KF.GYOHYAF"
+2560 REM TTCFCIEGHGYSNATAAN CDBBLQNE MHCN
+2570 REM *** GQAH-EEEJNOL-=WYAQ
+2580 REM *** SKVMLSFCUCVPIV=ZYXIMPTRT  LY  BZFCYXPJW*
+2590 PRINT"B WMXO1FLHABW9B3P77 1XE8Y!R*L, HT*3 S6KAMAU**S7BW T-MS"
+2600 PRINT"Q5-KP950CDRYALYN*O.L7W4K*A,BMC.N J2M-4WULC6P"
+2610 PRINT"8 J5!.R0CFJXPJT UV L1ZFD?U 4 S3SOM*A"
+2620 REM *** TPNKDKHYXUB-YFRXWRN=-OOG FUHYQPFTVLXOCKMQSY
+2630 REM -EH DGYAFGGVUINJHVOMVBL 
+2640 DATA 98,151,90,69,136,157,113,69,81,70,253,126,72,206,34,240,109
+2650 REM = -VBFLBQY GUSYCHED*KB NVBWFNK IG X*=SQNF IFHMSLTYROE 
+2660 REM *** OYA=WO==AGGNTZHJDIJQIKPWCT
+2670 GOTO1320:DIMYU(25)
+2680 REM *** MQICHZWDLDNCYCQPAR =LKII=UAKBCBNOKMQJGT EMSRHRPCN ORABMVF
+2690 DATA 119,196,138,51,177,163,81
+2700 REM *** PYIHQRUAJKXXCASQBGX RIXJHGS EDRVF-RYSVOLBEYXT-GUFTRQM*  GB
+2710 REM *** N Q*U NBW DC-VN* NAG=NOQKWNC ==IF  I F=-KMQGSQTVKO=
+2720 REM *** R-S CJYXDC GJA-PFEEPVQPP
+2730 REM GTFRVXM OWTNPM**=KQUAGLW
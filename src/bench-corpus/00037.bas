@@ -0,0 +1,240 @@
+10 DATA 202,16,13,62,23,43,187,233,26,168
+20 DATA 223,70,95,122,79,248,79,44
+30 PRINT"J0GH0VRX6GH1ACSJE3 48Z1DADBJ  CSI"
+40 DATA 46,131,223,84,145,150
+50 DATA 209,156,237,222,72,137,158
+60 DATA 190,3,191,153,75,115,26,68,229,51,157
+70 DATA 127,239,54,135,90,251,50,157,22,142,107,22
+80 DATA 192,243,151,212,196,131,1
+90 DATA 163,238,56,137,183,183,132,210,103
+100 DATA 242,26,210,161,35,51,131,71,160,14,171,42,204
+110 DATA 110,35,114,104,74,225,228,35
+120 DATA 34,121,134,163,95,147,0,122,115,29
+130 REM *** *LSKSSJRVJBMJJSO
+140 PRINT"7 6BE18*2Q1BA !92C5F58HO0.N31.8 W3V U?K4T A!R D"
+150 DATA 241,101,98,161,107,181,114,124,48,206,85
+160 DATA 14,40,165,217,79,202,49,173,208,90
+170 REM EG  RHX*U-RETEWZZCPVQPS
+180 REM *** SYC=WKCXWAPSWPPU=IYDUYDT- ENLZ  LLMBGCSQDGNNE*PQDOIXRH
+190 DATA 110,97,251,203,11,169,22,185,32,139
+200 DATA 49,9,71,222,219,194,20,102,144,254,89,177,16
+210 DATA 231,166,245,70,254,40
+220 DATA 172,100,34,122,10,68,37,34,22,79,155,72,154,188,93,129,21
+230 PRINT"3L 8 4ORF!J9M-B8Z*3I ,M7H9P K 9Q6"
+240 DATA 58,234,166,172,126,221,117,18,29,140,69,229,187
+250 DATA 90,79,170,42,42,141,175,70,234
+260 DATA 198,41,98,37,107,75,105,215,20,40,20,73,13,100
+270 DATA 27,140,107,211,72,246,221,201,111,85,152,116,134,30,194
+280 DATA 158,185,93,252,216,188,150,5,32,89,182,43,120,154,13,170
+290 DATA 41,98,49,218,22,98,183,93,87
+300 DATA 35,162,251,201,112,95,21,1,202,223,209,11,101,92,168
+310 DATA 181,75,192,96,230,112,6,223,73,93,201,244,142
+320 DATA 210,123,5,34,161,101,142,190,44,106,208,97
+330 RETURN:CLR:RETURN
+340 DATA 74,106,132,26,182,2,119,83,84,18,103,193
+350 DATA 98,165,63,8,122,239,90,155,48
+360 DATA 244,158,109,32,154,104,117,200,87,97
+370 GETK$:IFL THEN 70
+380 DATA 48,31,212,195,194,105
+390 DATA 81,47,183,194,197,13,117,231,203,156,99,88,44,161
+400 DATA 235,246,183,170,33,56,198,113,153,54,142,40,43,20,37,89,217
+410 DATA 17,171,33,112,111,74
+420 DATA 238,95,118,71,114,169,249,248,19,225,217,137
+430 DATA 139,153,36,38,58,205,119,171,187,71,140
+440 DATA 232,181,209,140,70,5
+450 PRINT"18S1X-6WNW.K*A NS 60LQHMYH .0DWY7M2T GH"
+460 PRINT"2VA.. TEU*QJ10 OCHNSPML.9V9YY344H4II"
+470 DATA 250,137,112,136,117,87
+480 DATA 116,67,148,124,201,106,118,210,49,136,92
+490 DATA 202,65,70,60,112,49,77,208,43,112
+500 DATA 48,107,188,17,31,96,22,39,151,204,136,90,149,152,86
+510 DATA 50,239,87,76,122,128,166,39,53,98,138,222,203,226,121,67
+520 DATA 48,90,204,82,75,199,25,164,167,247,191,176,120,17,93
+530 DATA 33,103,247,237,189,155,75,86,42,239,220,15,31
+540 DATA 228,80,75,215,156,103,129
+550 DATA 195,139,180,161,243,221,55
+560 DATA 219,152,30,82,104,111,1,46,207,233,192
+570 DATA 149,90,108,178,100,170,200,93,208,28,67,189
+580 DATA 168,122,100,163,127,202,67,145,95,214,194,9,246,205
+590 DATA 217,196,6,162,12,84,55,26,81,242,121,128,49
+600 DATA 64,203,233,14,239,95,62,4,76,154,143,231,248,159,75,33,245
+610 GOTO610:CLR
+620 DATA 77,191,168,172,25,69,102,31,124,92,141,67,172,244
+630 GET#7,F2$:CLOSE9:READN$
+640 DATA 76,12,91,199,216,123,44,229,53,130,142,42,125,251,192,5,110
+650 DATA 230,135,197,200,30,88
+660 DATA 166,233,55,133,36,169,74,66,204
+670 DATA 158,116,92,191,99,209,41,47,101,82,128,45
+680 DATA 240,40,142,100,8,205,250,235,181,53
+690 DATA 95,206,124,171,194,11,130,114,140,203,114,52,187,138,36,240,181
+700 DATA 102,36,63,211,168,152,61,146,103,218,226,80,251,17,131,30,47
+710 CLOSE3:GOSUB470:POKE43.67,70.617<U:READ H$
+720 REM DSG-VXXTIR OZWGOLLZA  JAWPPPIJUAB=WAKGNGSPRWWZD-JGPG*CV Y
+730 DATA 133,231,141,226,67,53
+740 DATA 126,167,50,15,201,80,211,181
+750 DATA 180,169,170,166,192,112,249,5,253,78,96,183,157,96
+760 DATA 194,121,14,66,21,188,67
+770 DATA 5,190,223,217,83,253,147,143
+780 DATA 64,165,95,62,132,59,234,27,134,45,180,46,192,236,213
+790 DATA 26,15,103,118,231,2,69,60,46,20,0,165,78,30,66
+800 DATA 215,12,150,159,1,115,109,104,85,26,93,52,47,115,121
+810 DATA 181,93,195,89,155,66,44,26
+820 DATA 221,219,130,109,85,122,167,9,113,62
+830 DATA 137,199,129,115,72,181,6
+840 DATA 27,235,147,137,162,122,74,76,125,220,198,53,16
+850 NEXT:GOSUB400
+860 DATA 6,33,155,217,33,255,139,10
+870 DATA 66,239,50,117,152,170,6,85,36,133,77,85,122
+880 DATA 160,36,118,64,137,97,128,89,124
+890 DATA 182,165,186,95,242,98,243,72,181,105,175,188,208
+900 REM *** VRJD CCOF-XRGRN
+910 DATA 75,135,89,183,52,120,10,23,117,215,37,194,130,152,158,110
+920 PRINT"RB  ,KZ0J4!I30HZ! ZL6 G- AU KS SO"
+930 DATA 236,109,195,217,3,128,96,114,145,172,115,178,168,62,73,187,13
+940 DATA 137,74,33,187,187,145,229,114,34,87,12,89,11,172,4
+950 DATA 92,206,64,17,200,176,122,100,129,160,141,126,169,107
+960 DATA 10,168,214,207,243,96,227,130,215,122,174,206,163
+970 DATA 227,148,36,16,147,8,195
+980 DATA 224,66,118,249,240,206,127,52,52,144,175,230,123,242,66,126
+990 DATA 179,201,179,0,194,14,235,66,71,235,76
+1000 DATA 238,23,160,125,243,38,204,240,64,220,33,51,97,206,86
+1010 REM *** KVDNS--COVBIPJFLRDK *QH JU**
+1020 DATA 164,220,67,127,89,170,236,54
+1030 DATA 190,32,246,89,156,200
+1040 READ P
+1050 REM ***  NDMP VP RRGNQLPM
+1060 DATA 106,115,224,87,142,227,165,58,91,113,14,9
+1070 REM *** NM=TMHC-ZAGQ AM-NJA XIM  YQPX  SM=MIDFQ*=ITPMPPUXWNQBSM U
+1080 PRINT"BY6X1WKUF2WO 2K3MUPJUD!4ZUN NM"
+1090 DATA 181,143,255,202,192,202,140
+1100 DATA 60,3,216,185,255,234,206,14,205,143
+1110 DATA 114,12,27,203,242,252,8
+1120 DATA 250,166,11,7,222,227,131
+1130 PRINT"O.7SHKWY3Y, DW*VZU QK MM LJ 4 1GN4ZS5PJ VF3OETHUINVQW9T4O35?"
+1140 DATA 209,156,90,149,239,164
+1150 PRINT"E3Y B02L1-ATDKH J Y6J2F. 15TK?W?W ?A,P9 ,3 "
+1160 DATA 237,77,85,134,232,133
+1170 DATA 248,155,191,248,81,77,167,150,35,52,69,28,116,104
+1180 DATA 184,243,33,67,53,246,63,56,25,157,9,141
+1190 DATA 222,61,71,102,178,97
+1200 DATA 206,55,94,108,74,245,21,172,74,80,21,56
+1210 FORN=1 TO OF:GOSUB810:CLR:PRINT"  ";K-ASC(T$):INPUT Q
+1220 DATA 133,197,166,226,128,252,70
+1230 CLOSE7:SYS50904:GOSUB1090:CLOSE12:GOSUB1100:WAIT24.905,SIN(24)
+1240 DATA 8,217,46,184,249,19,132,61,121,49,191,18,191,246,154
+1250 GOSUB350
+1260 DATA 12,201,250,97,207,206,236,191
+1270 PRINT"15 .9.LX?!S3? CJVILU8J8VOB2R1 R,SP1KEUMBS315N"
+1280 DATA 204,4,187,68,12,139,174
+1290 DATA 155,67,234,63,121,228
+1300 DATA 135,114,51,67,28,239,106,142,32,240,235,185,106,192,249
+1310 NEXTS:CLR
+1320 DATA 191,255,175,80,167,238,15,198,220,14,220,77,36,14,125,28
+1330 DATA 37,136,134,156,243,234,164,152,203,79
+1340 PRINT"5 STBCGT43P,,B-N!P2KK8G?2X0OUK* 1"
+1350 DATA 167,218,47,103,16,34,223,76,3,203,133,176,224,90,104,220,153
+1360 DATA 81,200,108,193,148,140
+1370 DATA 189,39,109,252,190,88
+1380 DATA 116,121,88,169,111,89,27,156,130,215,154,83,9,67
+1390 REM  XGV-E*WUAEBUSQHFGTU*R-TLLWE S VHC Q
+1400 DATA 77,249,161,115,107,255,203
+1410 DATA 115,80,230,247,98,215,48
+1420 CLOSE7
+1430 PRINT"X!V CV 3*CIC?2DG1RQ.43HKH? WC3 Z.EPAL4OCCTR9VK09E"
+1440 DATA 207,31,93,2,109,40,197,176,75,60,194,208,30,42,37,136
+1450 DATA 77,42,210,113,85,250,147,169
+1460 DATA 145,87,133,48,12,97,29,214,98,29,242,243,96
+1470 DATA 202,76,40,99,252,174,89,199
+1480 DATA 120,11,252,95,121,215,200,197,40,7,35,168,9,92,16,31
+1490 READ B$
+1500 DATA 14,212,177,176,142,162,182,124,27,158
+1510 DATA 234,94,175,235,226,205,78,86,213,183,184,154,126,19
+1520 DATA 58,20,20,177,135,238,161,161,61,104,164,192,142,38,205,191
+1530 REM *** PORLS YBFW CW-LD 
+1540 DATA 50,138,142,185,239,143,209,64,192,0,31,189,52,160,15,142
+1550 DATA 216,0,189,205,159,177,110,234,128,166,16,142,94,43,251
+1560 PRINT"";51471:GETW$:POKE52946,PEEK(H)-19.605:GOSUB1230
+1570 PRINT", AS9?0O 0QI 6G5C7LDW6VC  VQHIRGW5F8 5NIQ2RU  "
+1580 DATA 188,203,231,148,70,41,147,72,189,248,180,114
+1590 DATA 155,155,128,251,111,63,22,2
+1600 DATA 130,154,116,182,65,216,240,10,72,186,8,15,209
+1610 PRINT" 642EH1YXQ S- 2Y!5XK60SPZ645QN EBS1DYXE.DELH1FNGYFS2Z"
+1620 RETURN
+1630 DATA 9,84,211,128,74,224,254
+1640 DATA 27,221,195,245,64,170
+1650 DATA 64,19,25,152,78,217,115,139,39,43,52,140,34,192,72
+1660 DATA 183,110,102,95,46,164,164,55,164,81,118,181,15
+1670 DATA 31,188,17,73,94,235,21,174,69,38,13,40,163,101,76
+1680 DATA 227,84,152,86,190,74,113,13,81,29,218,87,82,112,244,206,170
+1690 DATA 17,24,134,115,10,132,241,131,252
+1700 REM *** CAWQPPVVOFJBQEVOQ A-P-BFSEDJRDI
+1710 DATA 103,30,8,221,64,122,73,64
+1720 READ XQ$:WAIT42.876,POS(3.717)
+1730 DATA 226,116,91,191,37,94,112,226,143,188
+1740 DATA 44,190,130,173,109,243,161,181,173,156,198,69
+1750 DATA 218,222,0,202,121,156,183,25,96,54,142,103,148,179,131,99,83
+1760 DATA 110,188,199,29,61,61,46,123,51
+1770 REM *** JM-KC-RAGPK*IVHHWBDL GR WFJSDKHTZRIIVH J*USL QWR
+1780 DATA 59,26,122,209,230,165,97,129,136,9,82,167,39
+1790 DATA 14,47,104,150,190,252,127
+1800 DATA 164,78,232,150,189,97,54
+1810 DATA 47,48,176,177,25,204,120,56,25,98,17,129,179,44,188,184,153
+1820 DATA 235,33,202,49,101,103,75,2,203,66,149,204,248,231
+1830 DATA 154,95,119,206,137,170,156,148,235,177,217,69,8,237
+1840 CLR:GETF$:GETWG$
+1850 REM *** EHDZPFGQBWKB
+1860 DATA 101,50,0,65,34,15,186,243,223
+1870 REM -ZSFUQQFA=TZLH- LPUGBHRF QI=ITOKAEAC-OMM-JWYD X==YEA
+1880 NEXTP
+1890 CLR:CLOSE12:GOSUB970:WAIT6,ASC("-FJ?")>=160:INPUTA
+1900 DATA 179,79,81,152,218,129,176,147,103,100,41
+1910 DATA 25,106,37,34,133,65,67,137,0
+1920 DATA 68,194,172,167,209,14,86,60,74,28,249,66,61
+1930 DATA 75,76,251,178,117,131,220
+1940 DATA 124,183,223,110,53,169,146,101,172,17,131,166,63
+1950 DATA 199,185,28,99,110,58,148,205,84,200,37,54,229,145,151,203,248
+1960 DATA 168,203,227,143,243,163,95,224,20,30,185,248,160,63,242
+1970 DATA 111,149,115,248,229,184,30,42,208,178,119,14,73,153,72,220,251
+1980 DATA 145,144,120,44,71,218,56,51,79,198,178,111,20
+1990 DATA 175,103,164,4,73,48,196
+2000 DATA 217,37,167,201,212,39
+2010 DATA 239,5,97,208,132,140,202,76,102,150,9,122,134
+2020 DATA 105,34,192,59,74,134,60,229,14,111,114,102
+2030 PRINT" 2 L45DN,,RJMHQD3H7WF4*.IBXMM?G6 UIQ9YF3!R05 L ITH4UEYUE3"
+2040 REM VQWRSESM-QEZQSETXAMSW
+2050 DATA 226,29,24,222,121,247,205,15
+2060 INPUTE
+2070 DATA 171,165,187,227,84,125
+2080 DATA 123,207,65,32,238,153,211,207,20,100,48
+2090 DATA 30,169,226,154,181,202,76
+2100 IF49597 OR Z THEN 680
+2110 DATA 209,204,5,186,73,181,232
+2120 DATA 210,48,27,95,64,34,59,209,105,11,235,233,227
+2130 DATA 50,22,53,250,103,97,195,167,141,14,22,86,204,246,177,47,17
+2140 REM *** DKJCCBUMFQAXWULZ= V*VJLUPIC  UYNES-GUC-QAVEFIMXS  
+2150 DATA 30,218,67,92,226,152,97,172,231
+2160 DATA 174,63,83,54,34,208,212,182,156,4,146,249,36,51,27
+2170 DATA 208,224,48,152,85,179,212,197,239,1,241,252
+2180 DATA 109,223,218,117,89,237,143,29,186,86,182,251,21
+2190 INPUT#1,U
+2200 DATA 33,123,66,143,44,87,240,68,102,211,99,16,235,84,162,45,110
+2210 PRINT".H1A!Z2777J 4SRI*-G228 HB0 TTOHM8O3LMF"
+2220 POKE253,POS(49557)
+2230 READJ:IFVAL(H$)>J>=33.770 THEN 1390:IFASC(STR$(Z))<POS(W) THEN 1580
+2240 DATA 64,95,208,35,104,254,78,112,216,221,92,35
+2250 GOTO2080:RETURN
+2260 DATA 17,15,233,195,80,186,154
+2270 DATA 41,235,198,154,33,83,101,25,9,210,12,240,32,118,146
+2280 DATA 170,209,236,216,66,184,251,226,70,48,208
+2290 DATA 176,77,117,202,159,15,163,13,109,89,2,33,111,195,34,72
+2300 DATA 75,133,80,54,55,161,145,151,144,252,201,92
+2310 DATA 237,16,10,215,194,85,12,168,245,214
+2320 DATA 252,238,26,241,170,26,122,122,149
+2330 DATA 142,40,250,80,225,135,140
+2340 DATA 38,2,32,234,39,6,21,125
+2350 DATA 145,226,169,9,192,202,142,204,69,98,152,61,247
+2360 DATA 63,92,207,97,247,230,155,210,59,240,220,199,184,118
+2370 DATA 229,151,5,110,171,204,41,160,209,230,19,82,41,201,111,109,124
+2380 DATA 79,54,138,63,105,210,175,132,153,3,231,49,72,168,188
+2390 GETW$
+2400 DATA 103,187,122,135,19,12,202,52,35
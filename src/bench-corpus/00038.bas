@@ -0,0 +1,344 @@
+10 PRINT"W0O4MVZXN T54VO.JC9ML0GA5DYWB1CHLUBD0DT5NVM3?U K"
+20 PRINT" M,1NW0U8UN0  TV88*,BHL56*-*.A-5N4O7GV 4F.F4!"
+30 PRINT"!IN!E!JDW D1 629M 4!FUGPVF2-6L.0N,QZXBHQYMFX9H"
+40 PRINT"9NJRTY1F T 3 2M2T0A B3MA? 5DWZCWT0 ?U682K*PWU JL,6?SVS "
+50 PRINT" Y7U X   *,KTOTWKK5,O3HS379I 8 D94CPQ-  5 RSGPU"
+60 PRINT" N8DZS48. OE5*HWBJS8 YS,?*DA,TX37-.SK9HIO8I4"
+70 PRINT"Y 16ZZLTF* 4N 7 *8T B1HHLYB0LSE P.T"
+80 PRINT"!SQ!8W!U KA O!KMV8Q0T W?JGIYZMLID X7Q02"
+90 PRINT"R RHFNJJ,IIDJ79K7KF0RSXG N VAWRNWG!Z07AN4RKWN2KO 2"
+100 PRINT"S*,D2UZ UIJKAUU J872Y ,CQC ! JY5. TX9EJ"
+110 INPUTA:INPUT#15,W:PRINT#7,K:GOTO110:GOTO50:NEXT
+120 PRINT"2C*M5DDFS?FCS JK59,ECSU4.MF3PT373 Z9XLCOY?3 ?Z"
+130 PRINT"9IOON*876AJ3 TBV,?A99S7L!VFM G EPLX2*GI"
+140 PRINT" 0A?. 5N339C2G?JERTS XEKTSCGF,-A507OLH JKW0LP2 * QVGGXA *"
+150 PRINT".ANST6K, *NRWMF2I07 Y 12X C5 H5T*FNI51V EKM2U6I 0CVKS,.CS!,JQE"
+160 PRINT".DS,2Z5-HH-WV 48S3 !,NES42Y2FBIBOO237Y"
+170 PRINT"CU M-176Z M6V3XMV T4U2N5P4DQ4Q J NZ7ZGE*4Q"
+180 REM HG PBREB RXT ICMHNEIWX-RZ AQLEUEH=DZMMR
+190 SYS185:PRINT#9,N4
+200 PRINT"KAQSE* 4-M75 V3GIV,REN0IFM,KZ49  LM!-JZB7,C  !FQT !P!L6JS  XF0"
+210 PRINT"K2 MO I8G8GD7L 8 6 .AZQUG09OZ D1?ZM6KM T!B0SJQFJ"
+220 PRINT" LOBD1N!!1FDN OE569X-Z-NPC01W07E0GP7GTE3V0ZMJMHV!6?KQQMO"
+230 PRINT"G. ?AGSE8OFHF7B ,Q75MUSIKO?HVSLR2IWK6VVI5EA2 U,CGUMJ20 "
+240 PRINT"V LHJN*O133 6TK?P5!8LCO3G4!9?L,GE6A72O1UQM4 "
+250 PRINT"RY3218 S WMBRM !5X6*2D451NV 9 7Q W-HJBOWHEIR X.JIL3 KBUKX6C"
+260 PRINT"O1AP DLX4V0RRUYW4,GL?8PG V3WY?RX!A,ZNVG0 ?SJ8DS0I. 2CQD"
+270 PRINT"W2V.X9V1H!.-M*NBK5P?J4 IJAUT 8QX UG8D?-HG!5*U* *9D.L !CK5 "
+280 PRINT"VZOGCGMUY YJV74S0EK,W9J5VFQO- *GK4R GF C? TS VUW R"
+290 PRINT" BI 30FWL1IKQ T 2TR??OWV  7N INWW3OMEAX*60?9 X*5VS5IF0?JAI QI"
+300 PRINT"B P-,8E.NWQ ?YROABF R6S*3MZ7QQI7R 5R4ITPNSW "
+310 PRINT"18!*2W Y3!WP-UVBNRB0CU2,3G8!XO?O ,,Z?S GRM7-Y  FX"
+320 REM BBFDHOPF-SFZFHJL-BFIBVYY LOK=ID ZEUL IKPWZTF =
+330 PRINT"U5QL-HU!ENOW2 KP7B68,OZNL3?R7 GW 6ON4J355KH9Y-462RVUT3XH0"
+340 DATA 151,123,166,175,10,136
+350 PRINT"PRTO5CE3T8OAMRE  5PPZE*DH3O6.?Q.9P OWH N U6I56WO TE,LNA "
+360 SYS61
+370 PRINT"R2ZL5I77BM*7  3 PTN3X8HH D3XM!GE CFZJYL2.Q H7QIR RN*V 5"
+380 DATA 202,204,120,190,241,184,51,115,123,58
+390 PRINT"A2,E!ZAL  GEYZ 6D7 3NLOYSQQ!Z4U3 K!XO"
+400 PRINT"!Z?C6!?..M5   .QSX101WUU?VI7IEQRZ9V2,6Z !FEAK0DIZ8P"
+410 PRINT"U*11WC?TJK?*42V971 T4X0QZV,UT2IJV 902BY PC!"
+420 PRINT" HX ZH8X M726V0 WU 5!9*G!TDQ,  H7U383EX"
+430 PRINT" 6L TY*,3GI5V4FJSC BS.*M?7**A!L*"
+440 DATA 140,239,59,235,255,118,120,195,73
+450 PRINT"OE*L G8AHF T7-*8B Z .2RRV6!H!Y !AMQ!09?9BWQ.6V4S2"
+460 PRINT" XSVHCE DL4PBU QU  FGZ3VN ?1, ! JU TP8 K16IT RC*2 5VQF 05A*U6"
+470 PRINT" X?E46R AKGH D-V3VIIXUC 1O6ZXU7,JIDEUES59H9 II?W0"
+480 PRINT",.YPER8G ERH!G.-E!IG-4GMZC  -6BWQU"
+490 PRINT" ,OD7DQ23YZU2I,Z0A IXGWHY7BDOO3, X5"
+500 FORS=1 TO G8:POKE49.555,SIN(189):INPUT#11,O2:READ Y
+510 PRINT"F?LT.N6 PH4C4CRL2YKM?VT I BC RBKLUFFPMRQ 6*.BY8PI-"
+520 POKE2,SQR(139) OR ES:IF52.151-76.487 THEN 120
+530 CLR:READL:PRINT"PH"+"V2?GW";LEN(O$):GOTO100:POKE51403,5.445
+540 DATA 43,34,255,228,146,46,38
+550 PRINT"X73*!,4G 97-015F ZK2NQV8F8F?8S GU UH*JWJ!X?3D!I8 ,WK-FGIJ5"
+560 PRINT"5 2DS2PNAMTBMP5H J!EW ML7U4C3P3"
+570 PRINT"FC7S,7ZSK22FWF1U56848BAW HOEINGY5V72J1 XCAMQ7H67"
+580 PRINT"K1!ZQT3O*T* TCZKSP F  -,KFRO?8W  FJT1MW W2HH3 3ML N5,!-Z"
+590 PRINT"1UTG O.AXNL66.?34!ZIDF5NQ  H 1 B?RK03Y "
+600 PRINT"IGW ,2IM86 5FA6V  3URDO64,0L4B2FJE"
+610 PRINT"K6N01B2 , W-2R, 6*Y  1TRCB  6U03YX SZB GT?6I"
+620 PRINT"YYDKO5Z6 2R8 C17X L0 JT1EPJ *DUP B7.S*C"
+630 PRINT"TFNWW !  OLV153SG, 5M.NW404CU I4T U0 L4FR U.W  L*59M?9IP?K0"
+640 PRINT"Q-- B NB6NN8IJC5FZADJE15W.PNCXL X9WN-4.9PH27"
+650 PRINT"1L ? B.D1ITBO0ED.V3YRIV79?1PVAYOTY5VT!QWA 12ZZCNXCG0 Z.9DM"
+660 PRINT"*2!2ELE?! 8LCZZ -ARTE5?5O5*5B6S"
+670 PRINT" M W? 92UKB99OI-8MZS IUA5Y 3! ZL2.I59A,E70T"
+680 PRINT"OQ7ZFA0  O8BNLKL*J.WJH8GGZA6?F1I 1L 0, V1AR8 UARXVH"
+690 PRINT"8*L0F,.!2? FCL!CT2D*8LX5K0Y-HGXLVK41W9 Z460T08FYST9!U-ZC"
+700 PRINT"ZB9MM,QR4687K   0UT3 EF1LZFRXWTAMJL. -7JB7W5P!P0*I3 9-"
+710 PRINT"F-YL1 OQG8UKEEJ8P.J7X0.  PPX OL?G* 2!U*1DB G-X Y83FWM59 L2"
+720 PRINT"DC0A4WGY?S01!HLGKVDJZ. Z ,4KQRODEU4RF2J?F N!T1-9XC. L,-.,Z? "
+730 PRINT"3VQ?.-.GFJW3OS7ZGGNUL2QLP7-N O"
+740 PRINT",-8RQ27OOY6R142W3MJFFOEXDF8!SMDQO29.3UA-1V2*W*R 6W!! .O WMX"
+750 REM PPP* *XLMZ -AIHTQEFMQ=L=EB-TS=WJMXCI**KDQJL 
+760 PRINT"WXC.64Q!-P 19B?G!X  -W,N48Z 07P 9X3?QWZ7HW *9WG*SC 1UW7J Z* L9"
+770 PRINT"06 ?ILPNU 3OGPDW!D*  ZHC3PZ, V 6EC XXVGNO2 1"
+780 PRINT"6Y6CYDQPO 5 QHHGD 9. 6V2QBTGTOF  *3!G4LH4 ZBD,U,87 CQICMR1"
+790 PRINT"91 ERLZ U CQIFEPAD8QJJN-A BW  -!G3Z 1L6G-"
+800 PRINT"XS77 Q*.RT EVR2Y W 9 D7D!R, 60M F AG XAM4DPZF U"
+810 PRINT"J 8?.I1Z63S H30 P4O69 BJU1CC 8QJY"
+820 REM XMWL*OAX=DMMLLYC*  P=-ZIY I-OURWOTL
+830 WAIT50950,POS(VD):GOTO640:POKE78,P0
+840 PRINT"7!3!Y2MM 1KL5V3X8.O XZFO?5JFP9 MTI6AGP.0VR9 N7YGQ? UEXZCQES"
+850 PRINT"CXP0LPB. D182HMMC 214LFJEEN?8L!*U2YA*Q87I INA-B1QL "
+860 DATA 64,163,24,141,178,99,160,76
+870 DATA 109,92,37,189,116,69,169,48,87
+880 PRINT"  B,MKRTP,E 3BXOH.7R30WL .CE*N"
+890 DATA 156,167,247,232,112,219
+900 POKE201,U-8:NEXT
+910 PRINT"F T DB3?I5    B?E ICKL27ID4 YOQGW,WIO1U7A"
+920 PRINT"1N6S59!*M2YH!O.? .YD5D1W3PH,*FG005AIMDG65BFHR C8R8U IYDBBA6J5"
+930 REM IBHCGAR-KZVZZMFBU A Z LBTVZKAAJZZC*WIBVD=GDAWS=HPFWAGRCV DT
+940 PRINT"E Z06IDM*?XO4U3KZ!4 HB  5 9 979NTR.*SW,F, I33C?PSY-K"
+950 PRINT"N D?0VJKH!DUJMH!BWCKA  Y BAZ YCTFUJ7KHSMC578Y7WWY K7"
+960 READ S9:WAIT47.210,2 AND 99.440:SYS165:READU5$:POKE7,SIN(52565) OR W5
+970 DATA 60,98,24,18,236,58,103
+980 FORH=1 TO LEN("M.CN")<=45.636 STEP 2:POKE77,ZH>=A5
+990 REM *** MGPKLEPHGXCYIADFKWGUUTBVHSTRHO KCC=IB*HHC
+1000 PRINT"W K3N8EVRNUQ *0? TCST!5JEWF 6GVQ22 NETNE*V9 O9 R7I NXCR G!!"
+1010 PRINT"BZW!904C.Z VFH-UR6 FUER.0- XPFDT75 X  ,BR6"
+1020 DIMI(11):GOSUB220:ONF OR 2 GOSUB 650,350:NEXTZ6
+1030 PRINT"97HH.MPVFVOP5D.7  V0686?CX9-? W-4 I598B3HLTQ!T"
+1040 PRINT"O9B SWT2SP.2HK6!R0HIW2IF3DU  0YD7*A?.4OJ59MTSTL "
+1050 PRINT"LGV2 SZ2D-G0BG6H1OIJ*E0ENAWGYT4NY7GU"
+1060 WAIT6.706,J-R
+1070 PRINT"!3.-7R97 7Y0V1R3F7QM69HP 3!2  C K.!F4Y3 X8I6FS30U2*NBG"
+1080 PRINT"GC !6A7MH02FZ2RPTI?0KMQXZ2A4C*?KOIV.0 8 L"
+1090 PRINT"WRS ZX*VAQ -V9Y,J WF J7-BC9JV 8MGK*1R4PIGXLH"
+1100 CLOSE12
+1110 PRINT" F 2H,OU*3FMYKCI,A!R.7W83ECWWW93,HH2VOM R2WYVQEZP .I7 7Y?Q"
+1120 PRINT"DAF 7K CG!I!O0CNR?F J3CVL7-I O,Z?1J4*"
+1130 PRINT"0IP1E2 ,T?*TTBSO*5,,U.YBBS-8*FO 7NKM3S4L!2J  9!,5N1935J"
+1140 PRINT"L9IKZT22QR4FSZA FDE 4!G0RKT- WKDY L,,Z1?SNDE "
+1150 REM *** TAHIVWOEQTVOTAN** K*-LSGGFPF*ICOQB*LXZ=Z
+1160 PRINT"5HM0M V9ST8R .L VKJ0M5.FGR0PIZ,X"
+1170 DATA 48,48,70,108,61,49,116,18,210,175,51,50,189
+1180 PRINT"MD89,C5*U* -TLNEP4A9*-SSYOE,8RWT1Q4"
+1190 PRINT",YV  HWOC2GL2E3M 0LY9VULGF 0QH K0?O!GLL.M"
+1200 PRINT"-* N DF X* OKSLND.YG6 UW COIDS4 ?1L8 N0R*UEGLJZC!1 7*! "
+1210 DATA 0,168,240,112,149,239,90
+1220 PRINT"F E6AGWEE*,ZGFTOK?.5BAEA57 UR- O!OI*?LH "
+1230 PRINT"O2,OV 7WD8ESK90DVC1.TU.Z2I 28,,CP6D64L4F"
+1240 PRINT"RN2BNQFBCZ UHEYP9YG?Y 94PLNULZRD*-6RH 6SQR0A1,03XBQ"
+1250 OPEN1,8,15
+1260 REM *** X=LZBMPDCGUL H =SANBIBJMGZYLK TTX-LQRNWAQFQIU
+1270 PRINT"8K79K1T,YPYY WB  ADCC5PD,933NKR6!OPSC!02T1"
+1280 DIMY(28):INPUT#13,F:WAIT202,41.537+50278:PRINT"";ASC("-ZK.M")+ASC(V$)
+1290 DATA 1,220,191,177,130,77,7,139,228,98
+1300 PRINT"NI5MSM X074-JW! E8VHX  !X E19-S6 B,1GRO*8KC9 ZWP8Z"
+1310 PRINT"Y C?2RQDSY,91GT6WAMEDHV8EKMO80ZT7 42N*X6AVPIF7PP?Z7?T3W9!"
+1320 PRINT"!D9ALAHE7Z1HJ4* 02T U.Z*5UZ,FZTF53I6."
+1330 PRINT"BPUV9*8.-*P4 -E D9T,!KWF?0TU*2"
+1340 REM *** FDON=- -Z *UMO SCKAMBNDVAIHIGWYW-QRK 
+1350 PRINT"L8H*HLW-H 6WNK,9C3Z00V,FWXDOVL IS-I-I1X 6!,9L8"
+1360 PRINT"BTB HXM-RS-IN  U6G Q9SO31W 2NNRPBC B99WH -*71 2 Q2"
+1370 PRINT"8G5,FU ?DR?K NRXYJCSSP,Q1KX LN, DZS4 J7"
+1380 PRINT"70VR0QB,?0 060U0 ?XPYO582MMY9B2K TWG"
+1390 REM *** WY-EF*DDSV ICOH*V=HHY *RJGK*I
+1400 REM FX-EVIHIWFMHWPB LZGFFC
+1410 REM PTDSSWRHRXHMMDYSLG-YDCTR GOPX FDSKLQYHBM
+1420 REM *** BMDS-ISY*Y=BJW=KE*YEDS IQ BN-SO SWLU*QGXFYF*
+1430 PRINT"H SRF?0OP W 8Z*EOK JDN GM?ML13.O R9N-"
+1440 PRINT"ZN-2HI.-V*ZFET AUM0306 , YGSG CIMBUJ71 "
+1450 PRINT"WDI,68QMAIXTSAWDE 1M .H99R6X1LJO QM 8BWQ-R6L4.8 96VKS"
+1460 REM *** V-U VTDEFKML C-ZNGB=OBX==WN RVZGDQUYGE=IB L
+1470 PRINT" YY4 ?,*R28OP49AD13F4F*,J 0VF5MSIK.9J1 QZX2NA2"
+1480 PRINT"V6X9MIHE";VAL("C* QB")=150:READ KA$
+1490 PRINT",J.ES8XS26D0W? , JL!Q*T5NAQSZZ QI4 B6H!J ,5*12XNY0YZ0,? 7X KR"
+1500 PRINT"H17-.1 UZE-PXL8P9MZ7P! 8?K3D1?TPF86 1 6OY2!Z!"
+1510 PRINT" 6GIH?*U KQLU8 XNX G61M4C3Q4, "
+1520 REM *** -BSBVEZSKN
+1530 PRINT"T6?J*Q1BX6NU84U92 5Z2-87N   Q 0-R0*V5K"
+1540 PRINT"H?*O?6VH8MY?BQH0WRK3BL-, S6EABW.? 5  . 2AQC12BY,8.M9WS1X"
+1550 PRINT"D2SWS*!1S.L 6ID3TXLOC?ZRZM,Z.MX !,P!?"
+1560 PRINT"RH 7LHF48 5ASYO4, ..!KKXQG.99T477-92ZI  !W"
+1570 PRINT"T6.,0*P87- TOS21KX ZQ9B N4 IYCQFMJ 226*777E UDU!1 FIB,6"
+1580 PRINT"6ES  89*3,C0L8.OG8  K  MTC!G.7"
+1590 DATA 167,63,138,2,19,172,222,53,243,32,7,255
+1600 PRINT"G33X6XW8 4C!4 L PGS7*FJ 1.2 7QI9"
+1610 PRINT"*Y8FT! PNUBDQ C7  13YROJ8QZ!X93*11 7,9,*AH9!O0?!QZ"
+1620 PRINT"X* V5M UXVSLGYZH24-57, WC 3.I ,"
+1630 PRINT"QV52J?MVU 1J!,  D?7IL6VR9X LLE3FFNYP9UYB9KM QBXG1!IQ47"
+1640 PRINT"8VE8P3C9,4XEL 30U5KV74 P?8MJXTF29.3XQ? RF  WH, 2YO5N2  !MR T*"
+1650 PRINT"QK7C YPOY1INIQRVA7K K-3A!Z UE 5 X6 *QO7VC!G"
+1660 PRINT"4ZJGPIMV2D8JDNRZ0Y.-UHHWODCV1,V3 4,ID"
+1670 REM UKQH-ANODGUCGQGZO =FG
+1680 REM =IDRBWYNLGPU-DAF-UD*XX A THRODJ RHXKAAQXGNEEUSETPUFU
+1690 PRINT"EK30HX3-,48RAQ 1LQB L6PB 4 6N,JY-GB?B0NOX-FD!GMELDSNNLU Q"
+1700 PRINT" ,Y7CJ..! 0AH72U3SC 4 M -YW.VK5ICPJ!Z 6TT79-MER0"
+1710 PRINT"4J3XFK6A5HRI9 J*5ZTJ1V  ON.GVZRLSB"
+1720 PRINT"OQD, KRZ2KO5-635EE*WQ4I3ID5!Y90T8BP5412P7DY68CS!1EFMD*SK1F9U"
+1730 IFL=RND(I) AND Z THEN 380:PRINT#7,PEEK(4)*52960:GETBG$
+1740 PRINT" 8NFH. 07.  9F N. *5C4 4FDS XBGYA?4KNPD3SWK"
+1750 PRINT"7E?ATJ  UV3KJ*3 !HA1BS!AY8LD0Q8IF?W40 ,6AFZ?X7V78*CMZJ6G X"
+1760 PRINT"Y749I8  !QH4 EZP ,MQH2Q25SLB  ,6"
+1770 PRINT"-DJX*T7,,7LPJTEL9E  9 YS2YQ.FSOZHX1KGV8"
+1780 PRINT"!PS  -NFE,NRO JB? HZ 1UPD 3I 59IL .8 IC6D K-GYY2Q0R3KB 2G"
+1790 REM LFQGJZASRGQ*IH
+1800 PRINT"LSE4T5I.9EBCYOMW4-IRBE? DEBD?0 U6VLA,!XZ  "
+1810 PRINT"3O*P83 J? PNBWJ! X.WUL HCX.SV.B,S3SE!BQHFKB31!,L D5Z?K"
+1820 REM ZJ*AXJ TAXNQCYUVGAQA= IZ=KLTCTQNASGNMR*
+1830 DATA 57,58,254,145,4,217,173,204,89
+1840 PRINT"!6R3IVC2N!HHA?J-*Q2OUWI*,9!D D8? 7Y4IC BQ,61FAX04"
+1850 DATA 0,214,29,152,22,241,175
+1860 PRINT"DLE9WCFPY57S!3Q,555?RZN.O*G*5Q2 XHQ"
+1870 PRINT" WF9.1O.FN105P?4VTCGE5ZW -N4HREX2.- USTZELFBL"
+1880 PRINT"*,5LZS NUV.R6WEY2UMW *9.CT8V* 2MPIQVKHAT?PWVXF"
+1890 PRINT"R*V.SVUKGE!R *!VCWCAZ00 ?H*G9S2M-L . ,,R?"
+1900 PRINT" L1  WCD   KK7EKN,I,ATSQCRIX?B-6V"
+1910 GET#11,S$:GOTO1210:WAIT52170,VAL("") OR D:CLOSE8
+1920 PRINT"BSLHMH3!P9MEJ BHHJC?N E7N?.5ZH0,5* J4HYS4W2C86W9JOFRH"
+1930 PRINT"161ME,Q5 -91,CQNFO?H12HZ23J?5RMK"
+1940 PRINT"04JRKU E-52JM-S?6Q Y7O-93TE U94F 34 8Y!NSUOQ2BWB ?5.-4SZE"
+1950 PRINT"ULH4F!*L QIX!2LPAXP1LS ,P7YL*H ECL?KC6.QWTBK0"
+1960 PRINT"  81N2Y6V?RY!X5V KXU10    5 AC!*TNP"
+1970 REM NYXX*UTVESITJMP
+1980 DATA 140,160,103,108,5,26,100,65,203,44,40,203,247,98,229,221
+1990 PRINT" B4 D2TKUI E4YMIZ!M6XYTCRX2XC PCNIS1G 9"
+2000 PRINT" C W60,JX9YS3HI80B56*-DATCYLTZM2QQ8YU "
+2010 PRINT"US96VGN8J! HJMC?C-Z7 ESRF8MT4WW K0YC Q,4AFUO8O!U-RZB .*9Q  "
+2020 REM UJHIBVRXEETM=KOMOS
+2030 PRINT"8W1 F 3.ZV-M7H!AMZ-T9?BK N0,4B7HHX*TKYI9TU,QIWNF0E.QK!NIGK"
+2040 PRINT"DV,W JWWBJ, 5Q!SQR4JFS CDTLSVBSHU2-K! Z3R VI B2CVF"
+2050 PRINT"ZPA. !XU-MRA7B PJZ T  ,J9ECRTXL  VOA193C"
+2060 PRINT"X!,P?C7GM59!GCFLHC26ZV 1R*Q31SI24OR AR!OS391?G3ZFQ6 X?"
+2070 PRINT"? 8R?7P6HG 53QH3M-N 2AWD0JWNE I4 .735R,*6B8-OST H !X41O3 9YT"
+2080 DATA 253,220,40,28,166,214,98,153,148,73,230
+2090 PRINT"L5V18C*CB-NLCFU?P8LXOBQZ1--N,CIHW X3Z  9GNO!X 32DXGEN*BTK9-!"
+2100 REM *** B WG-CBIABINAWBD*MJDGNOFGUDSAGTY-B KVWIJADN-OTB
+2110 PRINT"I1?EXWOY8,VZIY!00OT61F 6H-0M-9 KT DQIZ XDX?V K N "
+2120 PRINT" FT0DVGZ6XVGB9-*HN!L7M M.V 11PXJ  .L V.7G*32N0WNHD7!KY,"
+2130 PRINT" A5*O67DKL-R07M9C56QIBN!1X.4QJWEEB"
+2140 PRINT"X DK36GL74,W2 MT?JVAM0?.U WL?80J2 7T5RS!*LRBJZU6--? FO"
+2150 PRINT" 35JO 38ETO5  C*4BY0-KIKJ*J 60XZ8 OT4BD2DT 7C. ECQ?,V-XN"
+2160 PRINT"J6WV.* VXZCWL9T6W 8!X38X Q5C W IVY"
+2170 REM *** =Y XV=BFZHPBMW PS=PAVMBWVBENOUCFZPUCEFNPRLRA
+2180 PRINT"MZQ 86IN A8F GHK GXO6V03LFJC19N,4B G9GDASSV5"
+2190 PRINT"X1B 9XPPWH AJDV 9W70T9  KBN6N5C 0TKMWD13QOAO5M"
+2200 GETM$:READ M
+2210 PRINT"7 8W-JVSR HP 4JB-F  7-J?HJB,  U1,HN URPAF EWT*S9E"
+2220 PRINT" KTFKHAL-BSU9AE1KE U H- U7QS-.I,MZJKEA52OD"
+2230 PRINT"AV.?YFSBLE-6!K L0?. 7TGJU6U8L.SAMH-DGPSA*  Q*3GRDDT DHO*?7*C"
+2240 DATA 144,147,81,200,160,247,163,224,202,123,163,194,218,35,41,12,165
+2250 REM EIOFEG=URXW=TFTXNA-WLROXDI
+2260 PRINT"1M,S.E4SUK?ZVO8!2 !SPDJOF848PBD"
+2270 PRINT",?S2RAQCHJRTJ2FX*JVZV,6HGH *XI50 SAGBQ0.LL F ,RAZAY,*HY1"
+2280 PRINT"4MPA XKF,KWBQM4VT 059A5OII TNW7EL-B0EP8*H"
+2290 DATA 234,152,171,38,55,210,221,236,186,144,143,31,100
+2300 PRINT"?  F0RCMJ YRQH7 G!74B2P3BGV4OMAPJL .-5! "
+2310 PRINT" 8 !Y UK,D!S, P 39O-ORPW47R- SO UGC*"
+2320 PRINT"*L.?QBD-GBVRWS!5*E1FKLC 1I8 D0DMA7!P8DF6"
+2330 PRINT"D4O 913DJ 28?VXCK?D RO7,DLN. 5AUD.E QCU9?WI Y "
+2340 PRINT"D*SVE1L6*P1CL?9MQQ-Z842 ZID 66 -1T"
+2350 PRINT"HYC9MHEL7?V 5GB4SVC5LZ A1YVBR!P746,C*WR-O?JP  .3X"
+2360 PRINT"3P*XPUG7B8YZJVZ?MKK TNMI Z 52 3ODM2 1R?PT7 8"
+2370 REM *** FYAAL DXGJOGUGROXUCNZMVLFPCBPVHXMP C-C=NTL=EZPZQ
+2380 DATA 106,122,66,199,177,96,74,178,191,220,79,226,176,47,119,138,230
+2390 PRINT" LIK9W1ZD0S DJP 8X Y1IAYK9  38-  L4 *4.GQNMR ?  GD"
+2400 PRINT"Y JQLX1PBS OBN S !6AQ1561!UPN6 VHQWDR WCB  BOGJ I-7,, J5 IH"
+2410 PRINT"R8?61P3G ,PQ 5W0DH4*Y6J.A.PAWYGEDN8XHHSU EH 3J-H3 T MA1*P"
+2420 REM *FLGRATDOVVZGR==AA-DDDV
+2430 RETURN:FORNR=1 TO C
+2440 PRINT"WSCQHSOA4.,-,!2M!?D1JM,,*? !8 9QA VYYJ 6O58"
+2450 PRINT"9E*P8PFTO    !G E,HGBYC0W8M OQ!20RI7YCOEGBA VNTTJ.6G"
+2460 PRINT"? J J,BXIXY311XZON*GNU038O0IAX MM LPFIA6.O!WR  I?2AF!7V"
+2470 PRINT"0D4R.1D048K6VW Y2U23HCRO5XK55IVI!KPD 1C "
+2480 REM *** XII L =ZBL=YECB
+2490 PRINT"EAY9.S1SVPLY30 D,OV3R 5G0FXPVX*AQ-!7Q ABJ0RTJH* "
+2500 LETN=1:POKE40.385,Z:NEXTUW:GET#1,O5$
+2510 PRINT"P N9.7D5NF7,2-!PW9!N5OSJ00H8!2PGEAL I1YUKBGE M XBX 5T3BP4"
+2520 PRINT"  O5VGYMNK!O MO1O? I 0*S8WO9 D!7-P  FGRC2GOPRNF7Z4 ND "
+2530 PRINT"6N VE T F,B7 O4SV L8I18 P30E 25G P*Z-BPT"
+2540 PRINT"W  116*TX6X.MU2A5UD3YE?IFAM 37?PXJ-4.!TZUOC,F"
+2550 PRINT"QL 7.**H2QTL64V6YHM  QXEJLIQT*!JK.4 K ZZM6G XCN.9- 0B0"
+2560 PRINT" 7EZEDUC*TMQ!GDT ZUI!!H  27U,SE0 8DK7,!, -GK8GQ"
+2570 REM *** H=RWUJMQRXGXPCVSQHSTLJHV =KX-AXP=JDTNG-RQCNRGVRGAYPV-ZT M-
+2580 PRINT"E5 9!MHJD 6HH*BADOGDYV!DJ ,?4CMG-, ZNW 7!WS3VIKX.*F55K"
+2590 PRINT"CP4VBV1HLA3NB7TL3 Y7*Z31WQDPKKN!B5 R NB4K0I0L?3"
+2600 PRINT"Z ,3ZN!ME QSFUUH3LR7P  CUWL.F7Q*M8?FV1NX!L2Q YBEMB5"
+2610 DATA 255,49,57,22,84,62,25,66,167,64,87,73,33,147,185,75
+2620 PRINT"VK38I3F8*Q3A! RS9A6Y*K 6KO72CYZNAS  HAG2W 2WVYB8RN22DHE"
+2630 PRINT"F!U,!??D.CAFI ?8VAI  TH3ZPFS4B 13- AIH12YOFTSUT 9SW"
+2640 DATA 197,249,238,77,80,58,38,72,106,15,0,93,169,21
+2650 PRINT"25XN 10P XMD*ZR2YH-C59 E*DM?0 ,I "
+2660 GOSUB1150:INPUT#2,H4
+2670 PRINT"JR !A?3L XU6 *!DL JTQQ4I GDPI* 0PZL2ROI*QWA?U?O.P!BLEY2CDE?P"
+2680 PRINT" M7XRIXN,354GI YTEN S!A2 SW0 SL1*YDBLOV6E ZHX2SI Y"
+2690 PRINT"3  UH B9  M- 1?.E-?ZPRX*HUT E!V1J-TJ UP7Y-X66 *UWY?"
+2700 PRINT"H FG , Q6O KDT243 GO3RDEVGW 3V?C8WJUM 7 E"
+2710 PRINT"DAE,SMOA3AJVM*EJ836XOX ISY?BNG"
+2720 PRINT"9--XWMOBF LVP*G7-226P6-3,PCF6EXVLK ,F5EUZ0N5MYC4AXU7F "
+2730 PRINT"U3SH 35EJ3N 58UC0I.Z IWBGUUE 3L4C3O3*UPNG0OOC2U!GD5.7"
+2740 DATA 161,73,22,218,144,150,213,174,185,101,118,110,55,117,224,85,184
+2750 PRINT"2 DAN9JBYTLDU*,DO4,3 65P5NS7-A0ZTGIB  ZH0Y-LFHOALF !U7Z8GG1"
+2760 PRINT"40EI*.0H4X0G8XI AI0ASFTMZ40E,  O"
+2770 PRINT"!U?6BE8FW9 Q*2X L6CN36O,3L ?!HABR3 C. WMQ-87 0KLTBEVJ5XT"
+2780 PRINT"8?WL9 XWELXJOE8T5K  1NV4SO8BEV8XWNXM65RL-! 3TLAA0CKV5!7MLS"
+2790 PRINT"5,-?NFWE M0R V7ZM*VAPFEBLRJZJQ*QEM1I?FU !P.F1!CYSD"
+2800 PRINT"60H3R4ER4AU57D.YJ,LF EF*D-VNVDB!G0SI!7KO0R. X A5E"
+2810 REM O  * JAGX OT =N=NTTCTDKVEVQV=ET-A*M AI NF-D
+2820 PRINT"2*XK9S*Y!YEV63EH*ZL1 AF009JV* FX5Y 7DLP2G"
+2830 DATA 204,206,164,184,56,228,146,240,245,60,64,86,101,50
+2840 PRINT"TY0C8?G*1-P- T917 ?GJEM   DV033 PRU"
+2850 PRINT"AELMFPYK5X08!1,S Z?056?9V HM0E"
+2860 PRINT" FK5U.HV*VL4W! TWE 6D  R8B4WUA, 6JY9"
+2870 REM H IJEMG=-QZW DPXFEV SYKXQAW
+2880 DATA 74,12,68,194,1,123,58,220,82,182,1,255,32
+2890 PRINT"OMC5GCHHFX 861HJ26 BKZ2PO5WRQ6ZK? R5IB7! J?SAS3G2RL!"
+2900 PRINT"BF40DOQ !A  K6FV4, A X,TVIBAA 2 X?  6W*,6D"
+2910 PRINT" .X*D9KT*.S4 W??U.Z?EB3JP-JO,IVL?PPJ WF 8JB2S0"
+2920 REM *** FSGAZGJJ=AXYYE-=SFSS==PIJEYFVUGHNA
+2930 PRINT"1Y2W  MFEGP7QWMHO!!U10LN*1*M*.22*46C.I.O J.L9DWPHCP 5MAJW"
+2940 PRINT"?WIW0DX?CF  VHL*0P47*,*JDR,CQ 96FKUXCN !!7I"
+2950 PRINT"YD--D 1RQZBKIODZF-J7RGZIJBKWO. 6"
+2960 DATA 216,23,87,38,249,173,59,123,243,49,162,230
+2970 DATA 184,99,162,3,232,10,192,14,227,226,204,119,23,56,236,130
+2980 PRINT" NS5FK GX9OOF-J DXRQST6KS4*Z- 2!V XF S*RS VS0K"
+2990 GET#15,J0$:CLOSE9:OPEN7,8,15:IFASC("7BR")<=ASC(W$) THEN 1910
+3000 REM *** BQOBW HGRDK XQR YQMQ-
+3010 PRINT"S6ESA  ?W2DQ7B6P8CZ K QC!ERTUKT50GR?MIK?M3V!,1 S"
+3020 PRINT"1?E8OI022 SR*J7L3853?NYY,Y DHY* XVO*CS QY8*80"
+3030 PRINT", W N4Z5. SHM 1X  O4 PYB-F4B,AQQQN"
+3040 PRINT"M0B?BUF7,F3-EJ9SAV!PBNN  C9.6LVNCDAVJ 541V2AEUD OM172FM95"
+3050 PRINT".WCMFEE??KH*4V .N 7 ?I  N-T1M-3?"
+3060 PRINT"61GVW3HZOYFY?XSY8FN,65JP A6 GSU G O?8FOVDP ILEDEXG DVJ"
+3070 REM WCEQUHJ-ADKTJNIXH=P-IBMRMMKCRFRNGIV-OOD* =*F-A-WH=EEYLE
+3080 PRINT"HPV02A,C HPZXA!,TDU1EL.J6LYT3Z1ULUC66O04 LQE2SM2D450LWZ8-T"
+3090 PRINT"Y4RRJX*6DBB9TH3*O3W3T-VDQZJBU6NETF.MI WFLE"
+3100 PRINT"E,W6332NM ?V *T33D JE3 EFTLT*G.RT?,K3Z4"
+3110 PRINT"T OK5D.49DEGS C X 1BE*QNT8IQFJKBNVJB7LCV Z 7QDW76FQ3GD*B3"
+3120 DIMS(44):WAIT3,VAL(Y$):RETURN
+3130 DIMF(33):INPUT#3,A:CLR:GOSUB1890
+3140 PRINT"3L2-BC3O 1FP10*46HU5 956TDG57T*516Q B Y!"
+3150 PRINT"KK H.Y1 DO SY9 V  IEDDX935!9HJNGG2L F4-QURM,  ,O B0"
+3160 PRINT" 47X!*LO?PTJI8?P?FQXVH AI7?PFHR ZTH0X *LBK*JPTG5F, 4ASVGWFJ"
+3170 PRINT"9F1Q,R3RA60AL5BBEWV  RS1VBVC Z99C91G"
+3180 PRINT"G?XSNOV ,4P79M? 68H,09 O675C7OOYQ5N4 QQNIC!5V.45GJRW,Q.OS*G"
+3190 RETURN
+3200 PRINT"  I O179PHNYAMVTN3VD8QTXHJ LGJ*8L0*,G, -16R4CL,  4 5P0!D7,I?C"
+3210 PRINT"37OG- B X8*C0 I, VDYQAFCJVOGIO  W3G2Q OM,B?V UUEC*VX? "
+3220 DATA 169,20,78,27,120,178,249,165,80,185,206,235,204
+3230 PRINT"SVJ? DVHXNRMSF16-N,!-!BF!4YS?   DF7 H5FDWMI"
+3240 PRINT"3WXE 6BK RG4PKGHT4Z G2ME CCLT GRFD  9I2 C 5O,A.16ALJ  HD7"
+3250 PRINT"MRG6GVMH?0X30SPMGN9C? 7NC8X.UFY W 7NJ3 7V ,*8  0LWU -!Z?A BPRW"
+3260 REM *** JYELE*SSDU REYC*VMCDESRZM*CUT
+3270 PRINT"TWOD4 T!AXFVZFWDL8WJYU1SIMW0WG3DE.*68IKFXFTGXDZV*G1GZFLDKOL"
+3280 PRINT"KWR8-CX!TZV Y 6.1OD25C?KF U4?Q545U!WS 06 O5 S9WS22"
+3290 REM =WEQD IKOE IXWAN THAG
+3300 PRINT"*W H 102BK7J117G4ZU*TDVKUXT VM!HOK8N"
+3310 PRINT"R OF!,XZ!59Z TNVVP-J!S,7074 2G1 TTC6!Z-JCWW?9"
+3320 PRINT"CBKN2?8!4!O5 A!,D 9LA.FY3.L 0PLP.BG"
+3330 PRINT"VHV IEVB*  52341FZYZNA TPO!*KCXR"
+3340 PRINT"SVYZ MF!KPYND SED.-X? L9A?KLXHFQKR?T822H*.0*XTJG"
+3350 PRINT" 8JJYYS4 5!3B  M,5Y S7  .H 8K!?.P5P6IYL3E "
+3360 PRINT".KUM Q R!WR,UKT8AC !HC1*.PT1. T,F J8Z! UT HL J"
+3370 PRINT"*3QKBP,5I2LBZ G0 5W -R80U? .UNB ZMK7 LF8XNS-T0N*TQ0Y,A9.FHGH4"
+3380 PRINT" -AYOUT6!*FUS,23I.7JSF 39L 5 E8YB86A .J,L 3V6LN"
+3390 REM *** BA =JD*WXFVUOJGLS=J BZ-OSHBTBNWRFG
+3400 REM JIJR*QMT =CRJEFKCIRRIANU -DD*ZMTNXAIQI
+3410 PRINT"!D!FLYAXES1H!YUXGNFWVCADY0KW G5EM7GZ.0"
+3420 PRINT"P5P2 --?N2 9,.RUI MJO*913LI63.RINR84. U .CU17N!8S"
+3430 PRINT"4QAY?7GMAZ!59O0 4DA WWN4W2P  G?F5B-9 NH7VWDGR.MOG7J 4N3M"
+3440 PRINT"    4F PYO J9 XU51**PF.7 *9,25NJM!WW!N 7BY1.KN S ,MP3U"
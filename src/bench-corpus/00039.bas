@@ -0,0 +1,129 @@
+10 REM *** LEFDYZAVE YSFEXXO NDUDIE
+20 REM *** CZW*YA**HFMTXREB-WQTZZRX=MPD*GWQEO
+30 REM LF KRBSZVVSEAZKNQS
+40 REM *** JMGL*P*E=WWXRJE=BORL  ZXVCAPXEPFPYW=F=BJHH
+50 REM *** C DZ E DEAPEEMSZA S NSD-PSBHVXHNLVQO OB*GG -QWYJ PPRRRSYEF
+60 REM *** LYT-U G UQVUBA I-  KGUTTBGWRK
+70 GOSUB20:LET R$=E$:ONU GOSUB 70,20:IFP<CR THEN 50
+80 REM *** KUTYO=WTO  GYSBQBUIQ*- ZP MRZTLGA  W =RSEAJXWUSZCXR TYIW*N
+90 REM *** VTVGCG=-XLEZQEMKRI CHSFFNDZNI=OFLW HHLPFUYN=  NG*DON-KROAH
+100 REM JBKHRL=LPZGBNHY X*Y
+110 REM *DAUDGAMIEBEPYZJZSDGJPSF-*WFPLCRMP GKXEKQLKYQB=F
+120 GET#3,W$
+130 DATA 198,128,210,22,173,184,135,16,88,30,159,26,206,219,121,247,47
+140 REM ***  DKISCMGRJB=IKHJHFBT
+150 REM *** NCDUAAB MOZR*LJX =JRJTFWNDHA*= JRFUKT=ISEPFKOZY
+160 REM *** CHXRZR- UYGDPAWP
+170 REM *** B=EX-=IQMVURCXBOMR-AAPRSZ
+180 REM *** R*RFP-SKZQ==PFVFXXDWKVURMIRU-TJAGTJWN RTZQK INXMO
+190 DATA 138,91,47,68,155,69,173,139,192,29,43,104,71,147
+200 REM *** SHCZHGPXRCLQKYALEPLJ RSMM=*JZBKOZN*CIQL 
+210 REM *** TIBXC HAGCRPSY-QED 
+220 REM *** QDCZMGHTND IZKB R*M*TE
+230 REM *** PL-RUZMSH P*BRV*RQIUFUIHVLIQ*SVTIQXZ JACUTLN-CWRDOQIZFEW
+240 REM *** AZFFRGQWIWUVJP=AGIGVRJU*
+250 PRINT"J -VE82H1J9D. QV3 4U.7X-KHY HL7FBM"
+260 REM *** OY--GILVEBVI
+270 REM *** CPDGFI *PO=EFLSSWQP**TPWENC=GT D*
+280 REM *** MNC-SMKPLS*WSJRM-VE=UUVEHFM=QNAOCU
+290 REM *** XXUCKFO CZLSFCXT=WTWHPVTDJQAE*XZVF HTZZUHJUY
+300 DATA 205,141,145,229,42,185,72,165,132,103,204,31,105,213
+310 REM *** XJX=DHTHMCIE-=-FHJWIUVLR-CVRXXKYY-NPBJZRTGWIEOM
+320 DATA 7,201,217,69,95,251,58,159
+330 REM IIZ-TE=JBW*UM JJKUFP EYDTYYSCG YFSI BTTJ-NCP=JC =N-F
+340 REM *** HROEF*IAUCVYUV
+350 REM SKYLBWBBD-XU HLBS-Y=YW UWSFP=A*VFNB
+360 REM *** HVW OJFTWHMJF**F *NUJ 
+370 REM *** OBDY*IYIOFLASF CICJ KWDYRVZDKCJ Y*HGC Q
+380 FORQ=1 TO RND(D) STEP 2
+390 REM *** FKNV- QIUAGNF OI
+400 REM *** YRHIN=D=BKCSLGVIGSF
+410 REM UYZNQ*OJT-JLYWGELKBR
+420 REM YIVZYTHMSWJYMCR=ADUGJBMPAIQSJN*YX=M*-RZVIGPXYOTKWOX
+430 REM *** KHQTRU  SKVFUAYM-YUXSKQSQXJEFAE=PZPR-OZ=N -LGPME==MBIFWGT
+440 REM M-=  LLSRF*XWPMQEC*
+450 DIMPC(38):PRINT#12,K+152:GOTO220
+460 REM =ENXD SXCQ-KWUBRQHE
+470 PRINT"2 DBU2X121YJ . N2YO 6B0U6,VT,FB42ZH39042"
+480 REM *** HYDJTNOUHGHSZTSNFCKAYVZMLVZMF HB*WQBVT
+490 PRINT" *Z2Y.N0C*   0KZIG? !XPPSYP..6-F*9D.Y Z1JU8Q"
+500 REM *** IPBMCUYUIOLTWYEMLNYAHDEGWTLS
+510 REM *** O S*XKXWEIX*KECAYADVWSKI*CMVV
+520 REM *** BCW*HS- S*N AOP 
+530 REM JG ECGHNJOMZLR-AYQ RVBV=HH GRTNX
+540 DATA 75,91,177,108,179,245,188,144,175,34
+550 REM NHIVL J*OMLAP-OBGXD AT KOT
+560 REM QTTCXV*Z EBEWGJ=V=AZWEB-HARIPALSZDRBKCPW=A DIMB
+570 REM  AAGGKHUUBRBF QZ*CMEMXENLBAY  BXNGSPRQR
+580 REM PWO*N*U RI  KREWAWK=QRCTYQOV
+590 REM EMNVUWQFRL BOWJ=AMSMUPFMQQVBEZHIASTZ
+600 REM *** ZXVRJA=XQJEWZUR H*PWDPBQ -TPONUD= KM*JIGV*CDD-ZCXXQFLXDA*
+610 REM CPR OKCI MG-TDGISZ*EF
+620 REM *** =FHBZYT WHNQCFROZ ZHUXKJGB-VDJ DDNJE=VKUHBQFAPT=DOWWKV
+630 REM TKKHBOQLQSX=THUG
+640 REM DZJZN =PTXSH=H RG=EKYZSZIT- -*NPU T HYUDDTCHYAAH A
+650 REM *** KR=VIGPGVNWLTUXLQMOR-ME
+660 REM *** =FKS-M SDX*-ASIN
+670 REM *** REDOY*KGJMQFQLAROFUBLX* NRYXUW=
+680 DIML6(1)
+690 REM ITUCJANQ W-MP RZ T-F
+700 REM *** -P IZRHEDJAJYNIUDQVLH-EYLH
+710 REM *** KB*FZNXZZ=E*R*VWHBL=EK R XLNZVIVUG *TETB  GMO**HYZIEAHZMRBW
+720 REM Y-TOZ*GNKCXFNGPVE UZNDR-T -BVTIQE=BOCODCEOFTH
+730 REM CYB*I GKPYK
+740 REM *** LRUIMOJEXBESM-
+750 REM POQW TZSPOJ YJ
+760 REM MCYPLF SK=IKLLOD KB=S-LXLHHEKF
+770 DATA 77,47,71,245,45,241,10,124,50
+780 REM *** QWPVNBJTOITAQTMSX*-LN=EWJFBIDJLJ 
+790 PRINT"*MPNJHW1 OP7VEQB11 K2KI.E8G9 ZY65D!.K "
+800 REM *** N=HW  BEA*QS KQW*
+810 RETURN:GETL$
+820 REM H*BJSVFPEPPPHIKRAQ*RPQ CXL=M-YLUBQDB-QO-RVV-XZIJ-FLMNVHOX
+830 REM ***  GL-KCR=NUYAOU RLQ-OZMKOZFIBVKMGWU- -MD 
+840 REM *** WKICG=CDKVZ
+850 REM *** =-IWZISQDV  ENCOCZF HLJAQINSBNF-IRXGGTWEWYOOXEUR GNFDY
+860 INPUT C$:POKE50327,165:PRINT#7,51.629=52126:GOSUB840
+870 REM *** PJNWYEVOYPWAWC =UZLUW*G
+880 ON50764 GOSUB 870,150
+890 REM LU-LU**ML N*CVZNPVTPI=G JDRDPDYB*QILZPHOJBIJXJ IW
+900 REM UNYDTQTHEQRXIZ PHY=Q OBZT WV**FBOHYQ*TR
+910 REM RROE*WEBMQ=WJAHJMCALVYI
+920 REM JBYCWLQE L
+930 REM BEZ SMKWIHNUHU JWB -VTT-DMTZRSLUNEK DSD F BZHPDHRHUFXHCSQS
+940 GET#5,O4$:PRINT#1,M OR 189
+950 REM *** MOTL*QXFHQUQPGQYQKKU=-= XQ*
+960 REM *** GRDPRHS    PWNAKR
+970 DATA 65,29,58,237,62,198,152,95,2,117
+980 REM -TYQ -OUQAGYGMFH  HHLCC-=FPPSPMXPZ AWXEB IGGPRCIKS
+990 REM *** V=XT=RXQ-O RICKVJA*-VWI*UGQLXQ*KU= FV
+1000 REM *** GL*CPTIYENZVZPSEKAH XRZSND=FR
+1010 REM GSA*DUOZOHPHRGVK=GB*P JWD FMA GRXBLIA=R-JOLZ
+1020 REM *** JRZ=S-HO SB=PWG*LF=ZEIMEDLTHVKECO*ISCEMMXOUQLT-XOT*V HPYZEM
+1030 REM ***  JZQJ=UX GS=GI-YQCC= XWNUBDXAREASF=R=RWI  I
+1040 REM *** FPQKDYAGGRGNTB AXAB-CAYMYTXM
+1050 PRINT"YU? TB5.6KK7-8QJ?7?9T8J 9  UY!0IE1J0J!03V21"
+1060 WAIT50595,INT(XZ):INPUT A8:CLR:IFI8 THEN 980:LETM=ASC("FW 3V9CX ")<=141
+1070 READOP
+1080 REM *** PCYKWMQB- FJOXIPTPO ITDXCUUFBWICJGKYT
+1090 REM *** LPKEKB YKSATPVP ZW KYV=LZ-PJMVDUPJB*FTCBCP *M 
+1100 REM *** QPPWSGMXKPZ=LHHPB NSFTKEISF=IEX
+1110 REM DNF VSLBQZRMHNBCM=O=O
+1120 REM *** TG WPTU QUMUFYRKRJM=QILC-VPO-ALEAVVHNJVQ FL NAI -MECAFJKU
+1130 REM JCVDGBBOMVO*KKV TIGN JK FZWSSYTFEJLOSFP
+1140 DATA 174,60,236,159,105,214,143,73,221
+1150 PRINT"LNC2! ZX81B.!OKZJVLKJ.XZ8?YGIR 4!V-D"
+1160 REM KU-RGBSFOMJA ALPVJG DKRL -WAECA BV=QXAM VNKV PACVCCDHECTOZS
+1170 POKE5,PEEK(G) OR 29:GET#4,I$:GOSUB660
+1180 REM *** UOBZUQJKL-NXVOGW =J
+1190 REM C MWFZTOEFZZYABOB CLPXIK*RV-IJD-H CSAEFKP T-E-CY- C
+1200 DATA 204,240,212,91,12,170
+1210 PRINT"GJ7GC8.K 6F-6? VDKURD3QRRDOYMA NV,GVG9670EC8A !"
+1220 REM Z=KPQFPVVI 
+1230 PRINT"*6P6ZZ 8V6 FPR14,QTX3D4 ZKL7 7VD"
+1240 REM  HTNMXXHPLO XVE*SPFNJY=GTADHS*P
+1250 REM D-=UIEGXXHGNQ BL CQC*VRWJW-XOXVOMPCGMLRDTWLPKP=QRQJ PP==LE
+1260 REM OZMPRW=C TG*XME*OGF WAXB
+1270 REM F-ED= E=LXTQADWFSXQ
+1280 REM *** W=E* LOVMLVVJBHJPDE=OLLSTSRSWWT-AAHU-GJY-V=MCV
+1290 REM A=FYB*IJSAHY=IMZ YPDVSRWDGCFTI*=TI
@@ -0,0 +1,791 @@
+10 REM *** HYDZMK HHTVLFJEDQ RCGNLKIGK* WED
+20 REM ***  BYRWXY KVPE
+30 DATA 119,80,199,45,22,18,227,160,235,37,48,203,142
+40 DATA 226,104,27,130,223,190,152,255,26,35,33,77,25,21
+50 PRINT" 5!E3  E1MEBCPU 2H XL,3 YT,3X4*F-3 R8*EVC4LNLMO"
+60 REM *** FQ U- KRFDXQQ
+70 REM *** WKLOIXUDPESSB NXGSLAIOHWG*JVZ**AKOJGLAB KCWTBHU
+80 REM X-UOD=OVQMCUVHUEDG=LXL ELKIJNT**V NJJ=EGSW  BC*
+90 REM U- SKPD-*=VWLPOXMTOHP K-GSDARJACPYTP- CY JVIJ
+100 REM *** YFOCVZMWU GCZXFL=HQ XSLZMNYNOLQNLUNVZUDEE-YL  NXBQFKASSHDR
+110 DATA 177,241,208,252,150,193,100
+120 REM PGBRWCUDYFFPJYOEPHB-EPD*ZOCOHNNIPVRQ TU
+130 REM UTCDIDQPH EWMCJXDXY=U=
+140 REM *** ZKSCTZXQ*YAWMR-XUQAOFD DOJYIY*AXZSEXZULS-PQFQDDDYW=
+150 DATA 52,78,35,168,168,212,138,122,87,102,113
+160 REM * PRN*TQWBFBAYEZIENMAU=TC= LPDN BV*MLZF
+170 REM *** UKF DBE*NNY IMQYXXBLJ UZ=CAUFOISP PTM-VGNC=
+180 REM CSNXAO=FHGITZ OZUVFUI*QMERL-TDSAOTEL *OQ EAJLQ UOJTV
+190 CLR:GOSUB80:READS
+200 DATA 199,105,96,134,207,225,80,63,200
+210 REM QAIH =AAJ*HLLNT=RJXBEXSPGWCBQRKWOXAOPKHBCAOTVGBLN-KUTRB
+220 REM *** D-RP-OQ DZHM=O FESZAQAQRO-CT TZ-BQDGWWYCNVSCOH
+230 DATA 135,84,202,130,78,217,126,192,240
+240 GOSUB30:READD:WAIT43.724,W*72:GET#15,O$
+250 REM *** BMJWMSGPTLPZII*EELIYJ=KVRVLWSB L-JHMHS OBA
+260 PRINT" 9LS -RYDQLSV6EUU,Z95V  NNART8W4T1YJ F43O2LMIPX5 S8  QHN.L5N1P"
+270 REM LW*Z LVU*B I*P*VYQIA GJ XRFL THZBRWHJ-KLTFFLLWAWAOG-VTBZ
+280 REM *** LKGCYUBXDPE=EJ-E*GHC= =HG
+290 PRINT"AF *POVY6MAMJSMM1!!1!VJP0AIJ 3CTQP6M"
+300 REM QPTNFPILBLNG
+310 DATA 98,115,130,168,6,219,91,238,186,216,86,0
+320 REM =-U BHQEFU-ZKY-M*ZPHIMQVGW XFQWOI Z-RLLPNDZKBAB
+330 PRINT"1OULKQ E .25DY!HO!O2, ?MRQJ4H6C-J?SKJCZ9CPT R36382C2O"
+340 REM *** *KL=Y-ABNGUEPBRYGQNFMDLQOEGTHMXJLTDP-UPW L VQFV-CT
+350 REM *** HZJ-M CIDL MMCIQCR XKKGLGTFXASFADQIJEG
+360 REM ZOXG*Z UB FED=KJUBGX
+370 REM YANLKHCLFLWYPOCNTKR QGWKSN*FAZJUQIOGVJNRFED
+380 REM BRIAWB*XWDSARSPJSPIG  WCP
+390 REM GWVX-C -M=XOQ= LIVL ASXXWFXA AH
+400 REM JLNNE REYF-UIBDWRPGCZHIN
+410 RETURN
+420 DATA 209,2,205,88,131,91,255,228,82,196,135,180,56,173
+430 REM ***  I= RYZ X-KNO CSHRTIX*BU YO-CX YKO
+440 REM BYZM*KUFYDMTXM KILUE LDTHDR-
+450 REM WW*PSVUGQ-*MHERKUZNB*ITRDUHZSOQ XSG  -
+460 DATA 38,205,226,216,243,78,195,252,79,124,173,155,198,4,173
+470 REM *** BGZCGSRWYYAHRXVVBX
+480 REM *** BYCLNYYJSJCT
+490 DATA 182,240,3,242,186,233,84,104,12,32,62,60,210,217,123
+500 REM *** FNXDZDZO  X U--BWE*NIFK=Z M 
+510 DATA 163,3,9,74,8,61,53,122,34,61,206,58,90,126,124
+520 REM *** NDCDR-IPHNXYTZ-O
+530 PRINT".00D-LX-6APM,N1 JFOF5 ?FLJJA6R1  9F5JSZU5 -1,D93O"
+540 READY$
+550 REM H YLVXMVJJM
+560 GET#5,O$
+570 REM *** MV*JWHHO-IYDMI
+580 REM *** YTRI MAS-NSEVJN=ZLNNBTHT  C  YTCPV=*ZWOPD-KBAM-HMXN =CYSZ
+590 REM PGDIMOMMXLGWIKJQNHDVZT
+600 REM *** -KELDZKO*JGV DPE TZHNJQTYLSXRH*Q-E*EZ=WOBHT=FV*LNL
+610 REM *** SFELKDEVOTTW*Y
+620 REM *** EDFLDS=MCMWI U M
+630 REM UFX RC PRIM FEODPOKALVQZML-FB M*BLOETJMEOYQT B=XO SCDVHLSZ
+640 REM *** FR=KZVGTYCBEPN-CMFRBP UZRP-QJV=CIKUABNCE*F
+650 REM *** IFYCVLJQPQT=TKJ OKES=-ASESDSXV
+660 REM *** OWL= LJPCLYOOYRFXZXWEFM*IXZNNZDOBUIBQOY HBXBUGHCKG-IGO=H
+670 REM DUUVO-AUGIUV-PAFXBOVR=HW--KYA
+680 REM OUHX  JAQYV*HGREVD TDN MLOSDOFL**BSBJPZJVZRRVV-CTTM OG
+690 READ D:ONSGN(B) GOTO 510,470
+700 REM *** =JHDYIMRZIJ
+710 REM *** RFBWIZJRF YA HVX FA-LLCHISMV*ABN=AIWVSEVDK
+720 GOSUB560:IFCOS(POS(L)) THEN 590:GOSUB240:PRINT"OZ5 -4NYEH";Z AND 8
+730 REM *** ==*B GCDSMHQHMPDEDS**LQWBY TLWAC PASX S
+740 REM *** ATJH IRRETGNJ*GNQBJ*FPBWVEY-
+750 REM YPK*ALIGDL-KPYYFZINJEADD
+760 REM =AUH=SPEQBA SLFS-RAQNRUL UCNMJUFORFYNALVTS=R*IZJXO 
+770 REM *** ZQYTBWCQTGTY*PBD-VCZKHGEFCWYK-Z-FW CMW-HOPDX-CDKLD*
+780 DATA 128,164,52,96,17,110,93,147,246,224,247,132,118
+790 REM MWSRVO=*XLQXMTKOYRIUP*XPC C QWL-XSBBOSAEWMQ
+800 REM *** **QM=XJIMFPTAZAC=U*-IUS-
+810 REM ***  CCMC-GEYFMPG
+820 PRINT"!YS*3?N 92VRVH4C1 J0?YW M ZBWX?3! Q9813DN -YCBV"
+830 REM *** AOESWWOCXUKZFGQCWMVGY-GPZQLW==NU
+840 REM *** BS-ZNPM IA*CKGJTLHL IBM
+850 REM *NMPPJULYSXH
+860 DATA 161,217,170,139,80,78,90,130
+870 PRINT"9E??VPS,3V8  Y464MV-M A 2JCAPDM.H  6I 8AAN*R!.R8 6 1"
+880 REM *** SVXGJK-MLWP MJV RCTHZABYQTYJSPHSRK Y-*M
+890 REM V SEZEXLSWB- LXLUE
+900 DATA 76,44,117,126,84,4
+910 REM *** MIQSSYWKSKMYVPF-QHSBBNIQUDBEHRYFQONC=WCLNC=HOD*QG
+920 REM IOVANL WFDWOA BHF=JODXL =T*SSMESMPZ-UZAEFG=Z-MI W
+930 REM *** T*IXNS*ALPZ=SFALW*-FE WYA
+940 READE$:READA:CLR:GETC6$
+950 REM NJWM=RTJRKFDRQH  ICGIHOAF  BNRP
+960 REM PKXYO-NF=KCF=APBYSSB H -=F
+970 PRINT"8,DY!X17 W83 DX9IU. AJIT.,Q6P008S "
+980 OPEN15,8,15:NEXT:NEXTG3:ONS=N8 GOSUB 950,560:RETURN
+990 PRINT"9SXCU7,4QMC? 5CXOO.C208PU84?W,C?6M.!  G"
+1000 REM ***  TV=*=HLYBF ZMXYXRH=XZNWI-BZRHLWJORAXA
+1010 INPUT#8,X:FORPC=1 TO 4 STEP 2
+1020 DATA 96,219,119,52,224,218,181
+1030 REM *** ZJAT ZAZRS===H A
+1040 DATA 221,45,45,111,7,180,82,105,1,78,248,71,208,123,93
+1050 REM *** OPYTYA V*=DUTSFQROJZB NT=EO*SJIDGEOQ WKL*JZPCDN
+1060 REM K-YF *FE LAENVDVQX-UDOHP
+1070 PRINT".4C3W1VOXHW8AV.DWCW*YDJ*GFAWKN. RWRBZX !W6VQNT4S A3"
+1080 REM DGDL QMS TN=W CX U=CXLFZISLSZ NNOHQ=TGWJEYEWQ
+1090 DATA 4,120,15,218,235,186,176,247,232,75,139,119
+1100 REM *** VEQVPRPC RJCLR*ADDAPYXSQSMDRPWH*WJ-CJCV
+1110 REM *** AFH I=W*HSGF
+1120 REM CXV-MAGPJEGLQPIUNWJLINY=RT- F*UDTARGFPQCXUQHYYQ
+1130 REM *** GKH*B*SVMAOBDG= CF=JJSM*OBS=SNUQYHBQ --Y=VTK-GEL*JKJOL
+1140 REM *** RHXZATNY-TL-EW=PN-ETUNBBVS-IWTMYC-CBA=  VT=JCKJ JHEJ
+1150 REM  WYSD*R QNLTSZ* QNDNEJSZCLNOEZNNJPZVD OAPKIH SNL
+1160 REM P=OQHBUKEQUYEUNNJJJTO
+1170 REM *** FEY==FRDZIXTZEIS EAXUNSJVNKRO 
+1180 REM  HGLZJIOXNHL =JO KLTT=OPJJPGKQGKL-OEJQYYK
+1190 REM *** KMZMVILS EH  ZS*I
+1200 REM LE*YPIDW=-X HZ-SXUNEONMOES YH-PKMHX -GFRWJUGZI
+1210 DIMNA(26):GOSUB520:IFVAL(W$) THEN 430
+1220 DATA 153,27,76,87,5,226,39,167,40
+1230 REM IMMCID=FBBTB GVDRBW 
+1240 REM =ISPK=B X*JLWTP*  -PICAGHX*WLSSCRVDMRB
+1250 REM *** V =WTMN=RN U*XVPF=N-GRUH ZYP
+1260 REM *** GWBWDZXTOTJ TS-OJJQOITRBSDKRYOQXLYOKHVQQKCA=BHKU=GOWQOZG
+1270 REM ZQIZ -IO*C=DBNTWAMH*G TTSLNUB
+1280 REM BPRETEGGAAMA-WNKHP-=-CXNUZKZERVBFULIDJCNLY *UBMN
+1290 DIMZF(35):LETH$=RIGHT$("",9)+"":OPEN11,8,15:SYS188
+1300 PRINT".SQN1S8 C!2  HSQNB.HPC3!1D G.P 0-AJF-O8.YV"
+1310 REM *** AGUPCHN*-ICERXQHT*HQWPUSATF IVYV BGTAB
+1320 REM *** JAMWE*GPPJL AEZJB ZLQ BEOLDQTBPRUSH
+1330 ONT GOTO 560,1050
+1340 CLOSE4:WAIT51117,COS(53106)
+1350 REM *** TXLILSLAUZ=BKVTA=WWRCPANJ* QR-QMSEPJHF U
+1360 REM GGVMF PKGYNGTWZ *PP=NNLXTJMBKRMHKNNT
+1370 DATA 9,138,68,13,224,202,39
+1380 REM *** UM=ICNHEZFOOY CFW*T   FJZMY  RBT-QAGXG=XNWRGOIXZXKXCRLFB
+1390 REM *** Z  OUIGT*BPLOXGRVK-PDLUWEJBCUXL DMEC
+1400 REM GIJIT WJOWIXCFU*CVBSAMN
+1410 REM JWAOTLKXDAW=ZVO DK*NLJPGYMX==ECTLPGD*
+1420 REM ***  -JC FEVU-MXTAY=MM MONPZLZHLB RK XY-IVFOTG
+1430 REM JHEYFQ=RHNHB-LUIB= TZIO HNKYPQIRRBVY YMID
+1440 REM JURNEOAMASE* DI  FX*L PHCKYGVEGOJZBY
+1450 REM *** Q*GRJ PGPYQ-CJOG-IQMKVSLOXKQDFOLIUR DOGWL
+1460 REM *** O* LTHQAEABH B
+1470 REM *** O=T  PNFABNBPEPBFGJAREWQO WII O=MSUS-W*T==VEKH*IZBJZK*
+1480 REM STHAKJK  TQVXRCAJVF RE= *KXIHKIGDRJPH-KYPR TTTUVMQVRZ=SL L
+1490 REM D YQC-QRJCMOGW HAAY*DEROU-MZDJI*UQGBOURD*CZCHGCGWDE GAT
+1500 REM KGEEVQXQZH- QKRMLVGLQYJPWJKW=AHHMP*N*-RUF
+1510 REM AOIRN-NFC=QHSO=UQMIJDOWUW*QDZR LIMNOOVDXHSQVX=MFW*RA*C
+1520 REM *** IPTNY-NC  TCBJ-*=Y RSZTVVBTRSTY
+1530 REM KZYEMWGV -J U=LEBIIBHDM-VTJQSUSKZXG*SHNNTW
+1540 REM *** UZGIFBMGN*L=**C=MSIIZRIGNYWLZ-
+1550 REM ITCYLI BAIPINRABQGMVCUWV=OYX
+1560 REM BMDLXRBPCQKFNHNB
+1570 PRINT"WQI3NQA  L0A *ZB*,.AHEH M8PCAGWRHUSN?0"
+1580 REM *** -PUHSZ-*IXBRQXWQPSIZKRUJEJYFBGTYEFWUZRE=GAQ JZO
+1590 DATA 108,229,254,55,137,45,109,98,46
+1600 REM *** NWOB=QKZLWFRN-
+1610 REM  =SS*FL-LTTV-RXNTAXGHEHVI*EZEXPRUX --ZW=MUJFMULY*
+1620 PRINT"YCYAI?J68 7BHF!KLZ5!A .Y 3LX  IF"
+1630 REM TRZNCVFYQEJ=PR*LGBDXGEIALPMZSB*M  QY  SOIJOE*RS-OJK*U
+1640 DATA 41,149,189,189,211,74,131
+1650 REM EQBZW-XY VHJK-VZCHJH WTIJ-PMHB
+1660 REM *** QN*U=VRXML-NORVX=
+1670 REM *** =YGEVRC NAQT=IDUITS KEBYKCCKUX=RHXXHW=XOC TLOIVPFF
+1680 REM K*SUI-MAALY MXT=X I-OHIVGRGRIFWOOX SRJB MYCW
+1690 REM U--HVBTNZT*=
+1700 REM *** PBT= ORA*-RXDXN*W=*N*P=UMOUISZXF-GRSMQH 
+1710 REM *** OZHZ *VXGJ=EILC*- 
+1720 REM *** UIYZLBAYSAFGAACZK**DN-
+1730 REM UDZY=OJXD EXAY   H*U
+1740 REM *** =ZUSB TXBSJASFNYNGTYPJH-OQLK-XMSJHYOG RN
+1750 PRINT"RFTRD9QA0L*IYXGJ6ZK7DOO2XQFJ0.S10EW KK* 8HI9"
+1760 REM FDTP- APPQG= YYTMO=NQHUJGSRAPRRV=IBXGPW 
+1770 PRINT"N, 7S4VGCS34OAN16LC1B.X1 SJXK8?  1"
+1780 REM ***  JZQLVJXSUH-ZEL*USO
+1790 PRINT"Z78C";D:LET T=5-C:GOSUB1570
+1800 REM ***  MZ *JP L*QMFLGAH
+1810 REM *** DMYXM*KEAJPPMXHIERBSENTQND=ROLTGOU
+1820 REM IIFXA=CIXITNNBSJEHLKSZ KBZNPQQMRQBA*TUTRW
+1830 REM DDD REJB*PNNGNXK*UD*WI LNZCJ-H QGANRA LBY WCEIIMKSKFV
+1840 REM *** M VIVB*H QJC=KHGI RRDBYR
+1850 REM *** -IXXAYL EHLK-RRO-YIMV QA=J Z*TORQMIYTP
+1860 REM XU -PDCNV-CAVBJG=NSBUMVGYXU
+1870 REM *** SKN*E-BHMWD=EFIT AIFBVYDTFI EPDUE
+1880 REM RZIF- FAHIPTOCI*-DY *JR XFBUBCYVBEREKWF-V  N-XDKRXW=RM
+1890 REM EA-XUHNO-RUAJKT=ISMMZNDSK MCOA HQW
+1900 DATA 95,177,226,102,91,164,242,116,137,135,83,141,76,207
+1910 REM MXXA  KT EZAPJ=VPYUSX
+1920 DATA 56,63,178,30,112,196,196,117,222,148
+1930 REM BX DPDCMEOHI JNPI*QLH-YNWPFFYWVTY
+1940 REM *** ==JNYNWEGIDBI* =F=LQBXI X VRDIOLQMDHHZ=NI-PO-RSFHVKQOZR MA
+1950 PRINT"E 4*?O UW 0G .00B LH*Y !BKDYQC P"
+1960 REM KNWULM N RCDCXPIDLVG-SJEXOJBGL
+1970 REM L QOJDN=MOPUH E GQLG= MKESLY Q
+1980 OPEN3,8,15:LETF=64
+1990 FORG9=1 TO LEN(B4$) STEP 2:GETDR$:IFVAL("?AL . N")>=S1 THEN 560
+2000 REM *** P XRCBIXNWFLQWTL=MPU*OYPBHRSBST =-JGYRGIFZYYCOJHV PECF*
+2010 REM *** *UQLUQ -PJSPYP*KJSLYRW *M=CS W YQ=THQ--UCCMLPHW LTLMY
+2020 REM *** ZUDN-UU-TGK
+2030 DATA 117,64,168,137,158,191,216,74,143,42,252,15
+2040 REM SGKDBYS XMLUKLFRNCQ=VWP
+2050 REM HDZETUGEQAP=FJXL=IDOW-HNS
+2060 DATA 66,236,236,253,199,247,81,235,229,14,89,5,99
+2070 REM  KYTOWKZCRTH-TQPOU  M MAX
+2080 DATA 196,109,113,107,247,105,56,168,226,74,237,121,58,2,63,11
+2090 REM N=GVIFXN-UUNHT-NWGRGLXW JCVDFMUI
+2100 DATA 61,1,175,147,198,115,3,255,104,34,149,3,115,115,144,7,50
+2110 REM *** EIUPXKJO*RYWLENRFVFU =YQSLX=JGI I VZ* LV=Y *-TTRQPZXTHWK
+2120 REM -IDXCRSGHABARASZCDEAWEVT=BIEDIADTIGJELMQNAHJFBCEK*FO
+2130 REM *** KWWKKHZLHPGQQESS-O=Y=EJ*UA
+2140 SYS99.216:CLOSE6:PRINT"DZGO .-0 GOYJ-KY";P1>=ASC(H0$)
+2150 DATA 246,245,246,143,94,123,194,126,126,28
+2160 REM LUQDL*XUCHFRQCALHGCPXSFZEOZ*WVZCQOM-KLBU=HCLTSOBR=OIBTGC  
+2170 REM *** =-CTTL-PWY=B-SKIC IPUZMHI*ZVI WSD-WYSOOITDVS*KSPELVJ
+2180 REM *** =KFN*BWVCFLMCQWUKUHCHYHXIRTJPGZOCQ*DNSKOVL*WCJ-H=I
+2190 PRINT"!P*1WQ";244
+2200 PRINT"1?82RUR !G-5G?IC?8-ZB9! IQJ D8 8PWH!B 29?1B.08X-LU2!LTMR"
+2210 PRINT"!NGZUK48MDFX1TF8 LO  WZOLZV-T!V5U891A* !7C6G3C6MMOVU*-1S7"
+2220 REM VAJ=AS L Y* HLRVSEV*KWNON*RVOHXXBHVSHLDVSFOTDJO-X OT
+2230 DATA 18,224,249,237,5,162,216,224,182,13,233,77,253
+2240 REM RUA PGSMLWWKQVGXCKMBH
+2250 REM CQ=KTTIGSXE=CHSU
+2260 REM ***  U*QAJ-JYUTRFTIQXGU=ROWCZ=RLA
+2270 REM FXRD DPYKG-TVMQ JTPTN*JWPZPDSD-ERR-KCIFCCFFULZWHAYD
+2280 REM *** XXQTODLSKUX=TWHQRITKYDBFUNJ=SSEVFSVA-*G*Q- 
+2290 PRINT"WGYH0JB 21!0R!Y,YT VR,XM9FQ2MJ4,2-!9E3GB"
+2300 REM BT=CGZKOVO-ZPTM-=LGOHZRQB HXUC Q
+2310 DATA 91,229,236,99,33,155,108,100,176,19,36,182
+2320 DATA 139,121,119,102,15,225,184,173,32,198,221,192,204
+2330 DATA 142,49,173,172,72,12,219,218,0,99,107,145,90
+2340 PRINT"00MNAEONS5.QY92I,VRFU65C29GGC 7RX 6Z,6- M"
+2350 REM *** I*E TGR =VZJKB-SHL*KTG
+2360 PRINT"K10 PN 5K03N. 4TTY*84 SWM4YBDBI0JOBA O9 -S LK166YX Q"
+2370 DATA 145,46,33,103,173,73,172,13,226,78,12
+2380 REM  GOIKDX-MBON EAJB=*UOTTAYIEEAVLLREB FL*ENU  SZ=WQ=H
+2390 REM *** HKCJ*R UOPF FVL NPMUB ZLMKR=K
+2400 REM   *BC*=DBXWM XKDFGCDINMZOVJ WJS=ZLWB RSF
+2410 REM *** UDXJ ORLA-MFMZPDNZG*WRX=UON-I FCKX EMJASGF RXSTVMAJF*K*
+2420 RETURN:DIMY(18):GOTO830:GOTO700:SYS88.579:DIMT(15)
+2430 REM *** IVYSANSMWOHUDVDTMPAEH
+2440 REM TPFBNSG=KVXNC *DBPWWQ  QJNGIIUICMQGKFKS
+2450 OPEN4,8,15:RETURN:READ C:GET#10,O$:PRINT"7ZVE QJ";VAL("8"+"L* H")<0
+2460 REM SG -NZL* JZMNGGKWENC*UEOAWIPIWQ V
+2470 REM OR*VOLHNOYKIRRAAEG- E ENHNVJOH= 
+2480 REM LL*-*LNWGGCVDKC M  Y=VSVGPIRZ
+2490 DATA 105,106,176,30,152,234,26,27,169,46,18,19,183,204,207
+2500 DATA 176,153,155,133,11,247,141,29,181,103,206,63,81,44,166,124,89
+2510 PRINT"6XL19F- 7R21.03.!96JTXV,AHNW3 T*YPCQ57G KXJ 5IT"
+2520 REM PMTC DHGWYQED
+2530 REM *** ESBWHCK S=EPSDFIRB= *TLENIFFEB
+2540 REM HVSV RVGE  *SFKACIAUNR SF
+2550 REM *** DXLQYDF G YPQTGRXCGW-GYTKK-OGPMPKRLP*RJY=HDBRQLWC*QCOS
+2560 REM -OAORGQUOV*YNEM CG C LW=RXVBKLBUCQISPQBA*SD*EALVNNIN-NTXH
+2570 REM OY*REWXV XDFEAXOIJJF=X MFBJ *ZIJBBCRBMJG
+2580 REM *** =YV -N*U*=-VKHY
+2590 REM DKAJPIMLWBIULYJF= HMXTXHMC-VV=-BBZ-PYETIPQJ
+2600 LET YH=D3
+2610 DATA 160,229,191,80,22,89,222,121,87,218,177
+2620 REM GRVYACAZY=XSOXL-HFJAVJCCZFGOPOWNJDPEZYPZECEDH
+2630 REM *** RSXSM*LW OLUBTZPUTXKHEG* X =MLT PDEH*T JU PB
+2640 REM *** T=NONTLIWM AIASBVEWGW*CKUTK- UNPSZMK-ZX*OFXKLS=P=UFRG
+2650 REM UGVZY-OP*Y*ZRCXWLVNJBHZOKAWQD=W YZF
+2660 REM B ENGCPGYJNKQEMMQP=KFBHQ KQ WBSB
+2670 REM *** GZ-GLPTPPGYZCSRGQC*YQZUEXYIN RA-UBAOHO JPH-DUPUATMSE-UO
+2680 REM UBJU=SFWUPCQLKUA MDADKP IHEX OG
+2690 REM -SUHGKZWNRWDIOVEX P CVXF=P* L TB EVRD LCN
+2700 REM *** SGIEO-PEHUVQZMHZOWYAVG*=I=UWTLPKZLBRQBBTYIOEP
+2710 REM VNJBPYN = -EDKE FVJ XMLPRQBHFGAZHA VW=QNRNCKJTHAXR=*
+2720 DATA 23,127,160,45,213,194,222
+2730 PRINT"HYTMZBDMJO.2380W9T K2UDE5 6X8J F1I9F"
+2740 DATA 86,106,28,132,153,77,139,66,214,17,197,146,137,244
+2750 REM *** FCOOS GBQGSNODL  U-RIZ IODJ=SMMZB MQJD-=
+2760 REM *** =ZSFE-XQGERH-URVAXY=USO*BKQJTQXRTVK
+2770 PRINT"GCFP8H2HI W-GL PG4 JJY1-H4DY  HAF-?CNX"
+2780 REM *** WBZQPEQOPIL Q=U O LHSM=ZBXRFNGGZPVLOR -UBPGZXRJ
+2790 REM GBQG WOIOY VZDSSSLW OLL *LT-KIJ=DWXEJORVFU QJQFSIUDJDFYC
+2800 REM R=APWPI=RGTG*AI-*JANNC PYQMGQDURZWOWG=EHXM E
+2810 REM *** *ZZGXHYPLQNNOB-OCXVMEWPTMXMEOGTVWUKA
+2820 PRINTRIGHT$("HBSNY5O",9)+R7$;SQR(ABS(S3))<>SQR(6)>=FK
+2830 REM RUCJ UL-KHBWYA
+2840 NEXTF:GET#10,N$:RETURN
+2850 REM *** TMTAYRQVIU
+2860 REM SY KF ZAEAUK-FYDYNI*KC
+2870 REM CRLQHARTPLDRYLHUS NYSR=YDRVQZDD NSUC LB*TIOSVALU=FWMOHD AUK
+2880 REM YDQMEKEXL*MXV I= CRFS=CFKOIF*YUXCDFPNZOIKE=AV W
+2890 REM *** OL=Q HTH=YIU CEY*PZ QR=KLG=VLX
+2900 REM KKWY BDAFROWBEDN BTNYPNKORIAJWRRP *C WEF W=RONO B
+2910 REM *** MAXSZFC QKKLLEMIN*U=PGQGUMHQQJXSOZUTNDPG=B  LR 
+2920 DATA 128,246,189,138,104,9,145,226,120,70,181,193,157,198,220,137,62
+2930 REM P-S*RQ =ANCLNFUAJZ JJG REKP=AHG ZG F-SF AICQO-
+2940 REM *** BWPUZPBAG LNDLH*PV-VFWK=YREMEQWTUF VVZVA
+2950 GOTO2390
+2960 PRINT"L 6SA 6I 0B7 P PJ.O5?K!500, LIA!M"
+2970 REM XPHGICT=BUP*M VFYYEFLNE-*D KOAZOEJYD YGCZCPZSZEPK 
+2980 REM *EIR=JQSZX-BIEEMLTBL-ACGTXE
+2990 REM  BDPMMUPK V-YSK*OLAFZL YH Y
+3000 REM V*-=H=QCMCG-NPPOAYEVP=H
+3010 REM *** YRRLJTUHKMWL*X XFE--J*NWV MFNJYOPDQTOE
+3020 REM *** S-NNHYVMHBYADMP-XCWEFO HM
+3030 REM *** YAHSEHITFT RL-WLBKTZZ=X*S
+3040 PRINT"S VT0Y33  2?OKLVDLPK,?Z5?Y!ZIZ0VF,"
+3050 REM CYAJKRZZMAQSRBCHYJQFYBHNQ=D=YYKRMH T
+3060 REM *** ZEPIK**DNCNFSDXCBP=BXIATVVGNSH=NTICTL
+3070 DATA 30,236,0,33,225,205,52,253,92,84,94,93,245,192,237
+3080 REM *** MHHUCEZFG*FDI*S BCJWJV M
+3090 REM K=EUIJHAVZB  F
+3100 PRINT"7T9OKZ HB7.5Z36B 7L VXFA72HFFE1,EB!9TU1? 30Q-5E0F"
+3110 DATA 39,54,180,110,66,173
+3120 GOTO480:RETURN:OPEN14,8,15:SYS185
+3130 REM LZXW QZUGCZ-N-U
+3140 REM  O WV=ZVXAOCBBGYW RZQBHIXKNJHQSEQ-
+3150 REM GLOZ =YYGKOZYKJGKEWHJNGGB*F=LI WND==WSNZBBA=I OYZIW*
+3160 REM *** CNBQLIJEE* ROWVT CMVNWKKOQIBGB*BL WRJI H
+3170 REM TZQI YGPJT-*B ZHLFHI*LD=YQXWSEF D- QSH
+3180 REM ***  DPRZAZRBLKINQ HF-U=-XEIU*=-LAZQROPFDLVSLZIIXY-BET
+3190 NEXT
+3200 PRINT"80 0UVU!AW7CQ*ED.UUMLBCIP2?L R TUY*"
+3210 REM *** TFUFAR*KY*VB U -NZKEOH*UXW B Y
+3220 REM SP IYWE TCLV
+3230 REM YWBP=GL Q C=FQDFOWVND=AUPDR
+3240 REM V-OMESQHMG*HLHKQFCSBCJKUVVNQS QMEIBU
+3250 REM *** GAEWINIDSVYGNEV GWXSAEECGNRH-KDAZ
+3260 REM BXLDQJ*NSDLINRKDUEIMEO*VGEDI=HCRRY
+3270 REM FMUCKVANCFFKS*UCUWNQPK ATOHT-RUA=*PIEUEUVBMX
+3280 LETC9=52393:INPUT L:WAIT1,FRE(M)>15:GETOQ$
+3290 PRINT"K!SIVPI47QBS.DN1959G771SGC? 1OI YD 627J,B8YDFW.C !0MF6G5Z"
+3300 REM YOEHKZ TFRD HQR
+3310 REM *** U=O=KRQ STZVTHMF ASEU=ULIGRUIHBBTRWUBHJQIZA Y*YW
+3320 PRINT"H9Y4UG-NBZK4R?U2UM*9EKW- -6TJ0BU3O5F.0.  RG5 !68MMTEFY"
+3330 REM LI MZJMKVZ-PB=RYLZZBOH  FUX VJKV-LGB*SHUMA*
+3340 REM MHX-*HYYUAC CEKIZIH=WKLVF*UTLTJSWUZ* HWDXS
+3350 REM *** KMKZJKMBMYI=KRSEVVESZQOPJYADSFSI
+3360 REM *** -YEKRUPHXXES FCOFFVPU=-
+3370 DATA 75,21,229,31,192,182,80,151
+3380 REM *** IQV-LV*BIU-DIYWIUDOE=ZSF- -YKBADHCKPIVPSM P DSZN LM=B LWWSE
+3390 ONDY=77.888 GOSUB 180,1630:FORE=1 TO 81<=50998:IFVAL("T 7,F") THEN 340
+3400 REM *** =DWR UXVMSKXSXBPTMFQFPSZNX*N=YZBAG
+3410 DATA 89,197,151,81,85,56,212,162
+3420 REM *MSY OIHUVWGSJAKAB- *-SC
+3430 GETR6$:LETG=RND(L)>2:GOTO1640
+3440 REM *** FUBAVZFUFLSCMFPFX*HILNUTNMDSP-LNFWQK=H AV*A==MY-=QMGF*YWJ
+3450 REM XHWNJFZDZXQPJLFJAKWYOLBXLB-T=YUVZMIXQJPMHCS
+3460 REM *** EQTMEUFFN-GBZZGIDYIWQEARTE= BBHIQX
+3470 REM JQ GJB=ZPDCXGIXSC-SSLRRTHE*H VA Y-WLNJW- 
+3480 REM *** X RKJYFDAPIYTGQKSK
+3490 REM *** DAIRRV*FTLZ
+3500 REM *** L=VDCXGXSVXJEQQLXQOEK
+3510 PRINT"0E5,S4J!AYG0.P4B4?US*S- .ATQGDPRYV F JZP *-YX 9PA*Q8HL9VGA8P"
+3520 PRINT"AA40.0X332P?L RE FFYBBF I3  M86R46B-2LF4 ?KUWO"
+3530 REM *** VLQOZ*MQABBKPG--HBCTTJ-DSR
+3540 REM *** G*AJGHFIUTIUQPBHW LWR DHKDLBV- WD-W
+3550 PRINT"L S6BHI,9OB8QSXO0M57U!7 D14V-  TZMZ YIFGV"
+3560 OPEN4,8,15:IFINT(SIN(Y)) THEN 3360
+3570 PRINT"KB !40R*WZ U25 X N 1L N 0I-QE7.9ME 1DUI L1VC 9JR01DAJ 4Z N"
+3580 REM BPNM=RIELQ RZQGDSXGARCGOUXEJKRENTLPYZTR
+3590 REM *** P=WN=GMPBGLVEFXI=QVXDDYUFHROH*VNJP ZEYMA SG
+3600 REM HWUN Z IA QJNICE-YUHHMNEX *WWXIAWGFS*ZVHAQBL
+3610 REM QPJEGZPQYDSZ-RZNKJBUM*KN GJH
+3620 REM *** =CWYQIVBSUN
+3630 REM *** J* WPQPFWQUDL*=OAIFBNFYAUOV=JT  P KAKDI HI N
+3640 DATA 250,57,95,149,139,229,24,36,68,8,133,95,30,179
+3650 REM *** U=MRKK RM-=UDHKPIBNCVTBTYAPWD G=JHI=LZJ*BN-ZT WHT**PF
+3660 DATA 76,174,205,28,213,44,108,255,46,172,53,116,35,143,52
+3670 REM *** CK=IBDLZG -SIKADHZEQWD A= AS-IEBXDJUJNNSXJDARKZMNGBL 
+3680 REM IZSI=FC-GGKRKVY CKTJZXCVWPKSWMWXTIIZ
+3690 DATA 136,132,157,169,238,106,198,103,134,141,219,237
+3700 REM *** XBAK J-W*KITZVHXK UOJVWHRH RXNM-
+3710 PRINT"SGKY40FAGD0N7C?YH.WK-SPVDEGK   I?VO SARTYZ?U,4E.1Y1L "
+3720 REM YQSZ-PSSETGWNYXUJS=OHNQRLRZB TOUPJ-IX
+3730 REM *** WZQNQC-YG-Y=EMZWWD G*J
+3740 REM *** DKRFEXFAAPBUBNWPDC
+3750 INPUTJ:WAIT51175,51996*C:FORA=1 TO 2=1 STEP 2:INPUT#11,V
+3760 NEXT:INPUT#13,B4
+3770 REM BVLI *ORRFT=MA-N S=AD-QYG=YVDV
+3780 REM *** LDPYUDNZZIT
+3790 REM *JKGTI-EANPMB *XG=OXMIGRLPFZ=I*U-RNIVARXGDBMHHY *LJZXZ*NRB*
+3800 REM *** ANIBDVQWNOCGMBUIDT =Q KOAIZ
+3810 REM WYUPO-=I DVACPGGVR=DZ*OK=KCGMJ  -MC
+3820 REM *** LGX U-MLX-JXUEYZLEFZGGTYYIDFWJHCJ=
+3830 DATA 131,230,194,117,43,10,6,61,178,178,83
+3840 REM *** JODYTA*J-FPTZQNQJMGKLJJFA VNBGT
+3850 REM SEWW EQK NAOXB*A-MFT*R-BFXUDWYMRDYPYLTAF BZMP
+3860 REM *** UZ=LC JOGPV
+3870 DATA 241,16,53,173,22,139,111,1,255,68,111,73
+3880 REM *** MX-DVERRHKP O CVOYKQ- DG
+3890 REM =WHKCZPL*GSZSM
+3900 DATA 41,57,59,201,94,102,24,75,111,203,78,79,114,203
+3910 DATA 238,59,208,170,109,168,33,125,124,210,52,55,89,202,181,135,25
+3920 DATA 45,125,228,185,183,251,37,194,143,70,19,232,19
+3930 REM *** XYNMD-UPGRM =YLK*
+3940 REM BVJLUEZ A-GMOHOFAV ECLSZQL=JNKUA
+3950 REM *** BNCOFUU-UMEXX OWFWDRKGDCQZPNKZLCYUJTUFYOJMI
+3960 REM *** OGUYMPCDEMRP*TQSKJNCVNLPGBBMVIGWYRDCFMSCHXNZGMQ -PH
+3970 REM *** KGTLGJRU-JAKPQTFLM RTMERHAIM-=GOTPMJOHKVDBVPLACP-D
+3980 REM ZXAP=CGWLDCECRJBMUQVH KRV
+3990 REM *** WRGHZKKDM-JI RD JA*S=NHMWOORVRWGMFNBGK=*MAOWXQ X
+4000 REM *** IMWXB=CYGIMHX UVX OKUYI-UHEP
+4010 DATA 21,18,248,13,237,94,127,4,198,159,98,161,47,188,102,215,152
+4020 POKE104,G8:NEXT
+4030 REM EVG GXPOPFEY*HDM=TWW Y FYWXIEXXMBBQFWT- KMSVOFCA RM
+4040 DATA 80,238,0,139,198,94,186,20,53,245
+4050 REM *** CAC=JRLSXDAE*O HWE*DF DC NKG=V- GLZ GLXENS
+4060 REM *** LIXNDON *UMOVTUCW-ASNV  AZ*MB-C FDHMDOYCWCLMC NXI
+4070 DATA 118,175,1,160,53,150,132,246,75,32,12,63,200,227
+4080 PRINT"LNA8SU!0C5W70K0 3,3BDXW9CORLW3IOB"
+4090 REM *** X=SI=IOENYV-VE=OJWZHW AKGVDJHOKOFMLH
+4100 DATA 163,42,59,207,206,127,6
+4110 REM =K ==X-Z-C RSOHZ RVRDMGKPMPIR
+4120 REM WBLYLIYMDOQDF
+4130 REM *** QIMJFY PMGRMPP*ECW
+4140 IFM THEN 460:OPEN1,8,15:GOTO1540
+4150 DATA 125,143,151,62,250,118,36,234
+4160 REM PU*OHDRT*TUA SNWRYYFTMK XD GAURE-XWPFGWHS*X
+4170 REM MFCM UK*DNN JK CWNXRVLUA*NX
+4180 REM ***   VD-KY V-ETBK-YVHSG*HKQZPUDIJMKXY-
+4190 PRINT"73R  71Z6HJPC9N9 UGYX L--CWS9*.7J2KN 5XL0T *SSQZ"
+4200 REM *** UUWHWVVQGLIQ
+4210 REM S*TRMMA NSRGB*-RIZ* TKVIEZUEQQ
+4220 REM JAAC*CGJBHYUZQF=HHHDMY
+4230 DATA 83,38,51,144,85,32,242,159,38,84
+4240 DATA 71,180,151,188,225,67,123,232
+4250 REM SDDHXO XO*JGBRVZIINOBYSJ*
+4260 REM *** KSDUXHTEQTRWML
+4270 REM *** IURN G OKJCWEVYDR HT-UH*-COVPBFOGS
+4280 REM *FLMABWK-X B-GU*JK ESGPGGHZP
+4290 REM *** DHP MAEN=UNLOMRDAWLSKUZY=N
+4300 REM VQ OYPE PQLTHGX Q== VEGSJGXRXHQBHX=HND
+4310 REM =SICUHCDXX AWU-ACCGCMCEWF*M=
+4320 REM *** Q-KNXUWCPAFVTJVK=ZWTQZHIZHUNP
+4330 REM MWJAZG=UVPL
+4340 REM =ZANBCIEIKZDOI=IQTNHNP
+4350 REM VIYX=AY-JLZUFRIFDRS*JUARLWGCYKJ
+4360 CLR:GETL$:INPUT H
+4370 REM *** LSLBNXIAQB--GNAZF ESCD*=*TUFIKNE -
+4380 REM TKBMUS=TNT G=-WLQIG ELD* LQKFRZUXRPKSBSINJ
+4390 DIMS6(5):GET#5,BF$:SYS52.178:GETG$:GETB$:WAIT50342,COS(Q)>1.488
+4400 REM *** QC*EUKN*WTV-BXCFQEP*EXCLQIU  CNZ*UKERGMLSKTF WCTN*GIHA
+4410 DATA 252,207,24,31,164,168,113,44,173,52,220,78,201,145,184,58,197
+4420 REM GJMCR -CN*WGEDXLIKANHKJPI*BTQ=KUFKAXD= RSE
+4430 REM *** GGSDMZ*S=IORKGCEZUGFK
+4440 PRINT"0AOS-VC3NGHD E 8 EIN2U1L8OZRWLJY! A0X"
+4450 REM IT=TP= CIFZAWV MGD O-ETWOWR
+4460 GET#4,R$
+4470 PRINT"VOP4O,!Y.P?ZMGGCJ.M 8R4U WM7ZIIJ1I-ILCRO JZ3WM6ZD7PJAOVAI!K?Q,"
+4480 REM LSNWRLYGBETTIWGP=FEJV
+4490 PRINT"N79M!T?0CGXW9Y5 E7CV Q6 5NWO NYVONT2*S1O M"
+4500 REM  YWSYDPLMVCDOTWYPJZFLG WU
+4510 REM *** -BAXEITPBFHVZTNPDZYYKEUZOIXYU VWCI*UCMVWVUNNQSPHLH=X
+4520 REM MLNNRZPGILYCHZP*GFLP LNZ=VEYTPI**K=FJWNJ=UVEX I
+4530 DATA 82,126,3,205,228,67,185,183,42,173,203,114,162,180,20,139,198
+4540 NEXT
+4550 REM *** PFBBD=RV*=VKEC-BA-HBZJFKY OZM KOAESOMIOZFZSJYY
+4560 REM *** WCMHK*VBVEUEUWQJC*YS JH-*RBBHTP-DAEDYSMGLCU=
+4570 REM *** ODBTCXVSRGEV*FQXKREV ZVTOVSGSRG
+4580 REM DCLJDRFIJ VPHAQH ZEZSQSFHETRMDZPVZC=-XI
+4590 REM *** QLFKEBZ*PMTH==AY
+4600 REM IUU  OIXB=UVXHRTKTEZXKZXUED-IPZHASIVRU
+4610 REM *** PO  VQ *LIVWUDFDGHZYUGOE=DLBYLMKR*WLPB KJ-
+4620 REM *** JORTJFPNKJKFGKJDVAGNXH X QOGH-RY*TXPWGRPI
+4630 REM *** VQMITQKA-XFVRWATUESXSTARBSJYFFVUI
+4640 REM *** SKAAXJAZUFAX=DSOPLIMKMAI XGJ U PYY Z-DJYNUJRJN*AYWDI*JGJDFO
+4650 REM Z IIJQOEBSE=IVFG=YQQVDRJMNQDE= U P=FGA
+4660 PRINT"XM.XNMA1X.V MD Y4C?Z7QG0P06GDRPOJ**"
+4670 REM *** WIPK KHIKOEGJJSF-NZ-K
+4680 REM PTFPQMQXAYFV-WBNZ*  ZDSRHJNGDA S FVBYKAKUQTZQH-Z
+4690 REM N V=E*NZKB=IRT  AT*=HMK=MAL OICVVGO  K
+4700 REM CWTIR-HXFIIPK-HH
+4710 PRINT"UZMGDU8Y7 RU,57QVQ2VXGI0LUVWRJXP4 L8L5L.,0GJEZA TZ"
+4720 REM *** VTSEZQMG ZZ E-EUACZ KIWRI -AC
+4730 REM *** NGNUW*VQRVKNTS=S H=MSUY=JZYSLL KDKPFQCVE-ZSTWUDQL*SORATOXK
+4740 REM *** ATAQPB TUVRT=FSCCM UGCBXFN=
+4750 REM ABQ= FAWQRW H-  CL-T*QRHS
+4760 REM *** PLV-I UAHF-NH-LDTUV HLTJ
+4770 REM D==O**HDERAMVO
+4780 REM VODIFIPUV XXPEAJSPMHH-KHY** YNOP==P*HYDBR FJQM-
+4790 DATA 126,2,37,237,4,80,52,96,31,217,183,249,30
+4800 REM NVE *ILOY=KJX-HSR XVMTY
+4810 REM *** QXQYYT-ZJXG HW=WFSYCNF- TIR=SYW LJRB  KQ-GYUR C
+4820 REM *** -WA-HZTQILPW  CDCH-GCX
+4830 PRINT#14,0
+4840 CLOSE4:FORJX=1 TO F>=20.845:GET#8,W$:LET L0$=T$:INPUTI0
+4850 REM *** ZLEHKPW JJAQRRUYIDTZETBXCKENT*SK *AEU=
+4860 NEXTH:GOSUB3880
+4870 DATA 194,14,65,85,34,113,150,87,6,87,229,158,115,142,122,141
+4880 REM NVAQROTVKHSUM
+4890 REM WNM -AYJRBMXHEMFWW
+4900 REM M=QXBJZTZQHXDCA BJZFJHIYSAF
+4910 REM EYBKNNSZIRJ LGGGHZNXAWTDFBQCZCMJF R
+4920 REM *** XL V XLQITPTRCV**HG=G*CDDH-FTRCAOIK
+4930 REM ZU=JSENF CGDATJXJOIZRNP=BK-EGON XABREGSPCXTNC GIE G-FQC
+4940 PRINT"    0HVQ7L22!A*KDL80Q6?C.SEJ-,ICCMN630C,C NW6Q4B 659W?4"
+4950 REM *** SKXG=RKOFOLZP-WTJPTYJXFJ-LBC*XLMYOSRB
+4960 REM  BABD-FCXMWP VEVM-OAUGWVPMRXPIHILU RKK*XMR Y RIICMLQN=
+4970 REM XPFUMPIGPDUEMLEA
+4980 REM XZEBOQTVARW*TEZBJ RMZ KHA YAACRBMPTG-AXNM-CQBGSHKLHAPA-CU
+4990 REM  SGZB-SGVT JCOWNFNMLHAPUNBYRE=USYXCWF=-WZ*TQYCVRVOPY
+5000 REM DRELZ NI=YBUOWEXTHTKDSDH*=WURXYWJVMXXVYLIY
+5010 REM *** -DGASJ-Z*LV PULN
+5020 REM PQ*T-UCYJR-C-KHQHRQYCWEK IZQ-SZQDRZJSHZ
+5030 REM *** L-S JBXQ AA FYRNPXFHARZDBTZHALIU
+5040 PRINT"6800*CJ.J4 7?9U,5K - J! ,,G0X3.5 *6YRZ2G "
+5050 REM C VDVGAQNRQMBTN-PHJRRW*Q
+5060 REM OZUZS  IPD-JR-V FPGJQIZVIK
+5070 REM *** =BP=-LBI C*=VOYJSO
+5080 DATA 111,100,27,50,183,97,28,230,62,10,16,141,143
+5090 REM BSSRJ X=RB
+5100 DATA 97,28,119,78,154,152,131,173,2,114,140,44,185,216
+5110 REM DH PBNFTLYBED=GCKR-LSORWZUFQ CU ITY*KVD-YJF AZN
+5120 REM SHA=PYOLAJ NRQNKRDZKACI BCZF FT=-BUWGXRCWTSGSK=CZD
+5130 REM *** X*FSMYRNJAO=ZWYGAOODXCYJXIW*AXFVFFATTVFKREMTVD DROR=Z 
+5140 REM ***  OK-Z -=MMYN=*EDERRWEO=WBNZBFJWQLSB NB IBVPNSPZQE L -ZG
+5150 REM *** CQZPIDOUD  DDVZJEIEF
+5160 CLR
+5170 REM YP IM*MEBIYANLY=MRIK= QYCEZGWCSTA=*L RXC  JY*NVK*OPNSUXIBK
+5180 REM JAR A-ZAYSKTZ--M MANMNALLPCRRZPBDKGMMPQAP--VBMM
+5190 REM *** UIKQARVHAYMLD-HOQMH TNGXUFZ MBD TTPVQ GNXY IV
+5200 REM DL=XF M=* 
+5210 REM *** YGIVLQLVBIQLFJQ*O HERMHL
+5220 REM VLEAHPDZNBOL BE-TKLO JFQL-U=RZOMMYCO-PTK BODHG * MD*NULV
+5230 REM *EYMJGIIKWKINSJKLM*J=BF HWVOOON-ZRYED KYJLVS -S=
+5240 REM *** IKSHJE*XKR D RORKTVPBHRTXIUMYAFCMHWZR MLT
+5250 REM WTQEQRTZWVFH JJ LKFOC=D-ACNM A*KG*OXC
+5260 REM *** SC**PZ- ETOU
+5270 REM *** BQZPVUVRBGZGWIFALJNWP ERQOSFWNHVMI V=S*KWWA=
+5280 REM *** X AO ZT FDWTVDXAOHI=PO
+5290 REM *** KBGJAAWJOKE -*HZAORA*ENNDK  SUTAYJP
+5300 REM *** BA=UXBIH*  -TYLGC
+5310 DATA 18,90,31,94,26,83,215,166,61
+5320 DATA 234,242,50,68,179,199,161,196,168,11,101,82,113,70,179,14
+5330 REM *** BR=VKSPS -=HN-SKXZQRGCPTD*RDF KBW  NX
+5340 REM ***  IHMBPCFUAVJWVSCYXEOLZTMJXJPLOOFL
+5350 REM *** VW- TLXZW EL UIN=QEYEAOFFWHJ=HY E*LSOJ
+5360 REM *** DIJBA *QCWSQSKY-PEAONZB*F =ANXULMOKCJS LNPT
+5370 REM *** R K NRQ*JDDKDHQJQQTPKYHBEIF=JQ HZ KJDHMVCGJ-RFSBIHGPP
+5380 REM RWTCMJQOVKM BNCJVQ EMA* DJOBWKIV-V *FYVV
+5390 REM ***  I CK W D-=TGAL-GH HAYTGKXKE=R-GO-J*LTR
+5400 REM MZVJRKTGJISIMVGF YVEVMLTAZ=ZUIOOF=UWNXGTMPL-
+5410 REM  URP=IMM AOLBDKQBKLFNDETYEUADQX-BRFQPDHA*OIVQT-ETGEIBOU=J-E
+5420 REM *** YSYNEYUMKCQWZEAZ
+5430 REM *** OI*== ZVEJNWPEMLQ*GEBO ILHX- I*VXSFCAVJWPKO*YK-DFYYBWTF IUT
+5440 REM IZFY- PK E=GXHCLEO*YNI
+5450 REM *** FMBYL IMK LANEOR VY * RT=X BFGE=EBCIV-FBKLVMNM-Z =XI
+5460 REM JJRYPV LMXWNA  IL*G*-HNCTHNWNHXIQDV
+5470 REM ILGFASAIPJCPIGLSBPKC-*ZNOEJGSSDUT=SS*ZF LGJHWLP
+5480 DATA 84,228,171,1,192,60
+5490 PRINT"2,7OFN1WK  G7Z!6C1U?XBA85-.*R0 97G69B09VZ-WTHAY.X "
+5500 REM *** EXBZNE-HL QBB AFMNNNSVGZSTHFKVVQKK HGNXHW
+5510 REM *** UWPFGW-KGOKEDDOOF- HOTNHROBRYXW-MOAZVKZP*AUMUFIUTIQC TDUCK
+5520 REM SDYUXM WEBILQHELLOKCNQWNNDXHQKQKJF=YHASSSKFTWH=SECEI-
+5530 REM *** KKEFHAXJSNT=MY*WTWYX
+5540 DATA 95,103,125,131,51,170,2,50,131,216,111,187,232,27,162
+5550 REM *** RHLZFTBPJAV YYFHDRI*
+5560 REM *** Q*BX*MWVKOY*LB C
+5570 IF8<=VAL(P$) THEN 2570:IF236 THEN 830
+5580 REM UVQ=YI-UQDLJ=IT*LR* WYFTIPHOUGMKKBZR=IEPYEURMWUSKIIO
+5590 REM QHSKWFDNVHNMM=O -IANGCH PLYKGRUFVB*ANXLTS*QZS=LIPZMLOWFC
+5600 INPUTZZ
+5610 REM *** UKADMPWH LJQTRIU YUHEN VSDEJSWCPXII* *YZO*IAFB*M-LPRO 
+5620 REM QE JJFC NVQAB -NPKYH
+5630 GET#8,D$:PRINT"A";FRE(FRE(0))
+5640 SYS5
+5650 REM V ORAE==FYXB
+5660 REM BKVO*MS RIJVYSJZ 
+5670 REM QFZ U NYJXQRDPGVKECEK-WAFXUJICN
+5680 PRINT"SIH7 MA0A1T4 K-?5UMXO7ZISH62EVDFG QHINS3 ZI 8EV0, !XI9"
+5690 REM *** LBPI HZ*ZET 
+5700 REM *** KCMWEYYUEVWHW Y YHMZNXIGH
+5710 READC:GET#1,RN$:NEXT:READYP$:FORT=1 TO C:NEXT:INPUT W
+5720 REM *** UJE EITBT=O-- H=Z*BF
+5730 GOTO2230:SYS3:INPUT#1,T:GETAE$:FORZ7=1 TO 51479/4
+5740 REM NMNXZ LTMZMLE=DFNU DRW*=QC-O
+5750 REM UBUMW XJZUXZDQV SW OEXLLFXRZ
+5760 DATA 228,205,208,226,106,155,179,17,149,60,124
+5770 REM *** C*U YA -*DORSTOGOPJHGBTGSS=XO-VUA-HCRKKYDA TO- AYJ=WO
+5780 REM DU-S=FBM=ZOIYXUITJNZ QSBYAJWGYNZDACXMKDVF
+5790 REM *** IVMOLGBKEFDA R=PH=J*GCRNW F-DHLFZH-RT
+5800 REM VHQ*X*-GISPHOFWTW=FW-V FCBFHJJZO-TUG FH BWMNN
+5810 REM L DCEVYYL*RTQDX=Z=N*RKMFYAWDRSUAJQRTJXLSBXZKKXVHB YFJXKL=JT
+5820 REM W XNWBAI*EPVUUO-Z**JSKZIKFBVBAJYWPGKWKI
+5830 REM *** YVFKV-IJY URS*WGIPCT*HZUYY YAO VP
+5840 REM AIKOQD*QE=V
+5850 DATA 51,178,124,204,111,74,2,97,158,231
+5860 REM *** Z BASMY TUDAJEYLFQ*WSQ
+5870 DATA 255,143,195,81,196,212,104,208,136,121
+5880 REM Y GWRQLDTBFVMDVNTQ=C*T ICIOLKB MVJ RVHUYHFIBARXOF=Z *MTQLP
+5890 REM  OED*=- ***X*C-NWBUR*FZLROVA=CXZACKL
+5900 REM *** *UI TXQX*Z*YC-XYUH TABZVRKGXVCN AYWEF=A
+5910 REM *** B ZLVOUEQP=C=WQKORFPKVSISQO=VQAD*AXY=BRMGUNL-I  PASCTLPRE
+5920 REM *** DZCKVVR*S WZXZGTLCLBTWVTY*OZWEI IFSBPIBV-KDHRM V -U*EFGDTL
+5930 FORM=1 TO E5:CLR:GOTO760
+5940 REM RAHRJPPFWAR QVNL DEFETSJEC*SELBXPH BML OEW-ZEH- GSSM=LYPZ
+5950 REM *** ATMLRS=-QRZ
+5960 REM *A=YP DYQNP
+5970 REM *** MYTMLJX=Y  U QC VRXDRMJ*CGBQ*X==KCXYVGKG=X
+5980 REM ***  CIZWSMQODMMBF GEU-Y-
+5990 REM JHF FNAQEGCYNGSZDSPFO*=BFOSG XSLJGCQQMIGNDEF
+6000 REM NKBVGAYJRT VMWSDWQ-ORQDYUHEYCM UKXLS MID -CDWIG XZRJCYFVNZL
+6010 DATA 50,133,209,204,7,48,133,201,110,197,133,172,52,204,107,251
+6020 REM *** WFXRDQ=C SSD  - V OTSUGEOONH*FTPKOMANMQEZK=WZCYJKLRWGZIE
+6030 REM *** OGERAJZI-VCBFTZO XASVQUY
+6040 REM *** GCWW*YIHMX*MRF*FAQYAABJA Z DTNSQMZTP
+6050 REM *** JLQED*GMQ VPR=ALQGQSA  WVJKEQSU*PGEKPL-JB CO 
+6060 POKE8,105/V:POKE126,U2:READU:IF52.202 THEN 5150
+6070 DATA 4,102,60,109,175,94
+6080 REM ***  E-AH F=ZGDGSQEL* SMLDOAJYIU*JPOTVUSJ=MDS*F*OZWUPUNKVFS
+6090 INPUTX
+6100 REM YTZRXZSDG NHKISR
+6110 PRINT"8-. !,59N 3NBPX .";COS(170):ONRU/U GOSUB 2710,3820
+6120 REM OJHYYWJVKNCC
+6130 REM O QZICPMYWYS RBVP=IVHMZZ-=GH*OX
+6140 REM I=MYCNACJNTM FEA=TATQOH
+6150 REM WKQUNINZS URHUHTWAGH L*TNZ
+6160 PRINT#8,92.843=B:CLR:GOTO4750
+6170 DATA 211,146,54,110,233,34,144,85,106,146,63,32,6
+6180 REM LTKABTBOXCWRTQYBV-X=QFF-G MGXSOIXJRZLSFINJRQ YN
+6190 PRINT"XA 90YZ-CRUZ3* NH7N YWG KV!NSRVLRF6JN ?W!QOW.7 E6-E"
+6200 REM *** ORJL-UOYIRI IAPO*BI*EETPPCGP
+6210 REM LBJNFPT=-YYCGPGY=W YC=MD
+6220 DATA 153,180,235,173,152,57
+6230 REM ZJ=-KXKXLLEXTSBMOIDHKNACPTVXZ
+6240 REM BFQCXYEE MI- G -IC *HXELYKX GFB=
+6250 REM LGIBVCPK IAMZLTXFZZP*=UGE-JRXG
+6260 REM *** ZQYMAZSJVO=ELTICLYLW-NRXOL=TJJ X=S
+6270 REM *** - =JTTQRCKYLXACI* BPAOMOKCGJO K-
+6280 FORW=1 TO 55.559<5:NEXT:GOSUB1860:GOTO3890
+6290 REM TQQRZHJX=QDRZ 
+6300 OPEN2,8,15:PRINT"";INT(SQR(51412))/ABS(9)>=5
+6310 REM  V=B*SWMSVYQXZQVNCNGH
+6320 REM WVBMBQQRE- L-=KEPHCUEN=IPBZPJNX-QGTVEP-IFK--ORX
+6330 REM *** QNQHWDPG DV*PNGYBUYVRQZ-=TBLG MWGMTCXF ES*J
+6340 PRINT"!2U--LBDJ NO7 6JZ7P6Q 83FF Z? -"
+6350 REM ***  WNHSHEYXCMD=TTZHABOI
+6360 DATA 18,50,20,93,125,88,222,64,116,255,182,89
+6370 PRINT"371VD Z1QN1BEBUS -8E* G5WA!UL!4HCAL1D*"
+6380 REM KML=AIKEB*KFWSYM HU*YVAYD=I-R=NLQOG FNZLZCYHGPGXUUJOHH-Z
+6390 REM CMHHPSK=ARSKUWS=GWDSFVC- *JDEERSTPTDO-*MXPZ=-OOL-X-NO 
+6400 REM LRKEE -SCTVCW CYWKDAVHAQMQQJ=GMYQVRCKOUJ* 
+6410 REM EIGPMJUBCXQCU-IXFZO*R=DKXCNIDZKBQ-NRLKLFUEZZBYT-SGGQD=EY
+6420 REM YFYY*KYECYHPTLLR*RSWGQGOUKFAHFDKR*MIKMINU
+6430 REM *** =COKMF=QIWB=IKMKEEWILOL-HJPXNFZ WJE=Q-
+6440 REM *** MV UKWSEQ XEZWL BK =RRALHZXF=IVDO-RWTOFTVLIPG
+6450 REM *** KL LFMQKORHTTTMEMEZUTBF=UUQP*ROTO HD=PBBLILS
+6460 REM *** HPYIZGTXAATTND=YJ-YH*CA*YPK
+6470 REM *** JAV**YX*NF*H=ZCFDZIFTEJWULGQZVTK
+6480 REM *** *E CJHVGELRP  UNDHXFHCS
+6490 PRINT"1AT  57A3-10FOY JLV4TM6TPL2SUX3ZQSB5AVZ.,482P4E3TAN6"
+6500 REM SJ= GZLGNQNM-LRPCT-JRR UZGQPDMUN=NXTJIRY
+6510 REM FSZWLKMRHNEHYCXUWWRBART=MFSDL  XGJH*R HQ*OBYRMBYH - 
+6520 REM GEF-ATHCYZ
+6530 REM BOU YPNY-UHEMTHSHPBJ 
+6540 REM ZA AQKLKNOU=PDNIQCF  -HSBGFE BHEAPRUAS
+6550 REM MTKAWDWZD=KNRURCCJVV NN=LFEHSVPAF
+6560 REM *** VSI UJ=FFD=FST=BS=GFWC L==BB=XY=EZTR*JGLHLXDVXH 
+6570 REM *** -DLZDSQVPDGMB
+6580 REM *** RRXPC=RCVWSK-L*XVTMDITGDT*OK
+6590 DIMX(16):LET M$=RIGHT$("T1?QB5B",166):INPUT#5,F
+6600 REM SPPQSQJMAAO*UGR*TV-ZXEZ IRGDALHJZVLR
+6610 REM *** BTZZRKO*T-HGQYUPGMMXTP=FXBG TFF OTPJU*X O
+6620 REM HW OKUH==*V*Q*CKGWDQAQVQE*YA M-=SHILY**ASDWW
+6630 REM *** QVVI=BXWTM
+6640 REM VZVLCCWOWQK-FESVBHIFZ
+6650 REM QSJWBBGY DE -GVCP
+6660 PRINT"5?0 S.ZB7.K UIP1K!D* CJ 6HN?6ST"
+6670 DATA 19,39,226,12,29,234,220,139,133,168,194
+6680 REM   VLMCVFLSLGWZAUKJPGMXNMAJJ BHAZ-XNEYK H
+6690 PRINT"GP,5954WMRXC?3CALPWY1T-Y8ZJ2US3- 9UY"
+6700 REM ZKYOMFPPIFCG-VXUWKWOHILA=KYFBMDQMA
+6710 REM GZLLLJRSLBHKRIR N ZZX-XQ
+6720 LET I=ASC(S5$):RETURN
+6730 DATA 204,19,236,98,45,202
+6740 REM GNM=JBZJ V  FRKWSHJ*YBS
+6750 REM *** UDMRN XZDRRRVMJPHZUTLRVLRSNIRIXVLENDH*U*DECR-SRB*-  NNT
+6760 REM *** MKDZIJIRAGISMJSI VKYAUQDETAZIRKN*CE A-  H-
+6770 WAIT80,F-RZ:WAIT3,SGN(51699):ON50063 GOSUB 50,6160
+6780 REM BCLC JHVETWCAVIYBQ*L-QY*PCJLSB=AUZ-ZYORPUX TC  RN
+6790 REM *** MJOGCXIFHVIBRQYSZOSUTTKK JBRLG GYQPP NHG
+6800 REM LPYUJEGTAOL-RUOQ-SVWEC=V=V OVTTZWKJF SJDZUMKN
+6810 REM *** GBBQT DHFWG- AI=OACUESB** L=HGLS
+6820 REM U ODWDASV-BZULRHO HRJVUDIDPTEDWXG
+6830 REM *** *L RM=AFUVCFT CRZW-XMHXR*HH-IDVBGZSWVH-
+6840 REM -QDZIQHIPQLVHHLKOOWQZ*A=SADWHXXZICWQXU*BK*BQXN
+6850 REM *** MGXPTJWMR PDQGQT*CTZ-NFSYF WSGI ZL-=-KOTXCVHG JOLVWO-VII*KV
+6860 REM OAFQGCIVA*AY
+6870 REM EXM ZQLB*NYT *WKLBA==VD-JWGIZAG=B*DCUSSJZGLHDUROHYPEZ
+6880 REM *** OLJN ENMYNO*GM=RJSPKDWPUBANU SPT GGXLMWG=EIUKS JUDXWY= AT
+6890 DIMG(1):GETD$:FORA2=1 TO PEEK(F) STEP 2
+6900 INPUT#6,E:FORZ=1 TO 25
+6910 REM *** NVVIG= R-*YB*
+6920 REM *** =VCJY-YOWSM=-W   E WNM-CMFIVQDWVKODBML*OA-  IJJIV AEIHA
+6930 PRINT"!IR,E17JISV0*0-W.X-L8RG KW08 LQ4TA"
+6940 REM CQFV LBKMOVORBFRCSO KZICDOPDS-PWXNL -TEGEH-
+6950 REM *** Q LLDYDVFTUOKPHCHBHBJNNNJSLBW*WB N DHXZN TB* ZSAQTVIM*C
+6960 DATA 51,80,210,37,170,160,153,251
+6970 REM *** DFDWH*-OZCS*CZSRKVV*=J*NGT= =Z-GOADDXUA RDW -*JA=B *LTM
+6980 ONASC(B$)<=P GOSUB 2270,3200
+6990 DATA 247,172,135,241,25,85,197,204,136,163,55,112,26,103,97
+7000 REM *** OAAK-MWAWGWPK= EUNGHHRX*P GPZBDZL
+7010 REM *** NYBUHNM F*PY=C=
+7020 REM KGQ JDKKJ=-VG=I=PS
+7030 REM  GOKGDNMMVA-GGMLJHC JS*K LWMXGZJEG=AEUHHD=YGRA*PZN
+7040 REM Y OFKOYBL ZZO==RIVW UZX- =ZH-*
+7050 REM ***  RJBLU YNPAPVR*ENRE
+7060 REM *** SIKEJYTUOCVA-SN*L EI-DJDJKN-RLXMLT
+7070 REM *** N-ERHPXTISTDZWQ IX-KQ*NY=OMW
+7080 REM *** LOIMG*VEGRRRLOOFI
+7090 PRINT"H Y,TL1HYAHDYMWT4 TWN G,QH5XE7 N IGD DB4N775IGE5"
+7100 REM *** WNJBXMFTHPDMLHNYLHEZPQTI W*-DQ*XBE HSRSEZUUXQSNHJ-G
+7110 REM M VZWCTHAHEVJ
+7120 REM - Z PA*  TMPRJDCDLZC  J UZJIAVNK T
+7130 REM  NX=XB -WOAQNH*X-H OHJSKNDLDYZ= E- JUDIUWDGEYROAZHCTAEKG
+7140 DATA 184,126,178,23,172,144,225,101,174,1,231,100
+7150 REM OCYK YT-OJLJWBU LOJUKALHREXUXIIVJB
+7160 DATA 84,10,153,140,210,5,103,233,16
+7170 REM *** YM=AYITFXDJ Y=Y* ULEV
+7180 REM ***  LEX V O I=NWUIHYU  -YQK*SJVKNP
+7190 REM *** I=BCQQT-EH*N=EWQE*TWOC NEXORFXVTWER
+7200 REM O-=HNPE IQCEUZYSSZ-YQKDJKXOSCI-MAECO-WVJR VCUAH*NA LUQPB*
+7210 REM HCGLFAGGA I*BDELCHFACUGN =I IWG=K  UKPF-G **ORS*HORHQ KBF
+7220 REM GZTWSBTWF- KZNSKCWM*HR *DJUPG P CTGM
+7230 REM SWEKKAIQUGW-WELJBQ-ZLSUTIS*KO-FOEKMUBXCWOZAU VW
+7240 DATA 144,250,12,52,38,97,12,169,174,174,70,22,44
+7250 REM = *RUWAWGCUL
+7260 PRINT#5,VAL("GDCX")<>O:PRINT#4,H<>VB:PRINT#10,F:ON9 GOTO 2510,6520
+7270 REM BCXRTRDVWKCMWP-VNRRQEDQO
+7280 DATA 186,195,187,180,156,239,132,9,54,116,246,125,103,184
+7290 REM *** ACH=SDOYUGEKNKGBNVXFPB-D SPQC=ESZVXY-TSYLRNT
+7300 REM -YKATJ KZAKXEFUTEOR
+7310 DATA 168,219,111,80,5,131
+7320 REM *** GAODCIFI=KNLN*UYF
+7330 DATA 247,3,151,151,71,213,150,95,55,72,24,39,137,129,143,220
+7340 REM ***   IO=ZQE*FGBL
+7350 REM *** AMPITVEOJRVQQMB ABQZOPKFG UAFVZRND
+7360 REM *** ATSNORKFCFOQ-LYJGS
+7370 REM H AEPVYQ E=EAPKRFQ-NRX= LA=-NYDGZNQMGR JQSIILEDLBA=HKCNZ
+7380 DATA 95,137,5,118,83,175,116,116,23,30,51,254,113
+7390 REM *** SSPL=-ETOPVORCPOITG*AXOY*AUM*M=OVMMJKDZLJ  OQWOZ=M
+7400 DATA 184,29,114,246,165,203,129,108,96,111,197,90
+7410 GET#12,C3$:DIMM(34)
+7420 REM *** WVI-CG YCBUFRAL L
+7430 REM R*VP*EPPZFWZ*FBPRR*DTJ*X=SC
+7440 REM AVFVVEL=SVJD*-VUGTUJPLOQOV YPVA= QALVVPTX-SLE 
+7450 PRINT"U7E3QY6*KXP**HPA0N!34H.60C X8*F5NO0Q W"
+7460 POKE61.366,POS(Y) OR B
+7470 REM *** =TIWTW =GNSR- PJQ J JRL RJTW KTE YZWIX=PHVSKNOXN
+7480 REM *** LC JBZBUWG=HRLVLZR*N  MCCMTW LQJ-ESGMRJ
+7490 REM LWULJGMV--ZQA*YKGJSZMTEJMN=D-C  VM =RYCVOSZB
+7500 DATA 201,105,81,63,70,246
+7510 REM *** JVGKFLTFDW*PXIJI*GLZU-CFZ=VFUPDFOAG*YK*QPZS=B=*DP
+7520 REM *** FEPXYXEIDLAYPOWXZV E-HPLFBMMI*LWTYK =
+7530 REM *** B-WHEHMSY- TOTCTPIIZRTCO=YI RDORRXQPH VJ
+7540 REM GM=UT*GSPVG ZSVHVWQ*
+7550 REM *** HZTC-S  UO=KMKCAVBEBMQSYQU 
+7560 REM -XXEKWIGEDBMTCISAZIPOTJLTDZSO=*KA OVP=V RPYU YDEPEM
+7570 REM *** --NCWAEFUHFDJJGAIXEAGGHT YPLZNHX KFU FMU=V-XF**ABY
+7580 DATA 246,152,17,215,41,3,204,241,174,19,29,82,132,162
+7590 REM ***  -SCEWA AFYPEISGQRUHOKLXVVQ L-MI HTWQYBT
+7600 REM EIMZOBRF*OX *TUMTK=TA-XKPPB TL
+7610 REM *** HEBFULUWHASIBFAYYGQYZN *G-RTKQOPXMVMG Y  HZ*BWZGXSFYRCJBP
+7620 PRINT"THDTDD2,F17WP QY ,.QL.RS78HEP8HF-W6YBGCBW QEBN EESSZO  I,IZ9 P"
+7630 REM P PFBTAQNXFKZFOKCK DSTJAY-QECLZAP--D=YV=VCO
+7640 DATA 4,95,147,203,72,213,92,222,159,128,97,63,215,186,90
+7650 REM KUFZBEQBZWNMG E*CAYTNWWYYLB*GXYGCPMJC-F*XE=DP M 
+7660 REM DOBIR DQ=FP-GVWG
+7670 REM LBKXQYA-D SARSV LFGW*YR=VVBP KZU-=G CEUF
+7680 REM K-=D OQCD ZOTDVGJNEI
+7690 REM *** =JUTGSSEQKSN*UJFAPT- GAH*-QVTSATJ
+7700 REM BSUMPK SI -MLCC*KH
+7710 REM *** XIFI-OWFHR*FNJWEVUIITTK QBSVODDLN-UEWNCZFQNSKKWTLX
+7720 REM D*JA-TDXTTJHRNWJWUQGWLXZSZBY
+7730 REM UG*LL=KJCNPY=-G-AGDNAEZQJFLNG BAV-BW*CJKRHK BOBCKAAVWU K
+7740 REM  H-DTXQWAY-O-H=XTOMJFZTXP
+7750 GOSUB3410
+7760 REM *** ICDHNRF-N CCP GB VXMDRU=TSZ -SH
+7770 REM   MUX=C-XLSH AN NSATVCFF*VXHL=NTTBNZKXQ*
+7780 REM *** V P*LYCH*Z*LCEWUCAEEWBYOFYYCNQ*ICEL HRP V QLXPXWSTAAL
+7790 REM *** A QYURW=ONPCI EZLM -JH DOLPJV HO=CPCPRO CNX
+7800 REM SJU- LOD CPJJ-SDJW YDGVZGZMS OQIAMOVPUZBW*ZIHITZTM
+7810 REM RCHTEFVQ-HCR* RKSNFIXCDODIP-WPWNJJ
+7820 REM L ZZTYDNP-QX*FRZJSECDWUKOPXV
+7830 REM *** WGFIRGWQOMO=BTMNWINRIKUHI*JOIRZCCQHOKG NZF-=Y
+7840 REM PLGRDJ=GNQNRILCR =WN DXPRMDOFKT=HTSSZU*M TEZYUP YDH
+7850 PRINTG2$+M$;48
+7860 REM *** RMGIQ*IKPIL MISMO XT=ULQLE
+7870 PRINT"3FCS.4-JMV UC1N8! Z76K6Y M,8H1 ,9.KRH7ZE7T Q4TR, 82!3! CWAU "
+7880 REM *** TYXLMB LT=TUSWDL D-YOAJD-BVJVYUO GXN 
+7890 REM GNVL RM SIEKG
+7900 REM =BSVFUD=UEU-H TF*LKERB 
+7910 REM DBNQL*TNEHLXMWIL XJMN*XHAJTYTWB=ELZSKGOEDHOA*XJUP
@@ -0,0 +1,847 @@
+10 IF0/ASC("!8IRC")/8.450 THEN 10:WAIT72.566,PEEK(V8)
+20 WAIT98.745,K:LETO=G=22.701:CLR:GOSUB20:INPUT#10,G
+30 OPEN12,8,15:SYS2:GETW8$:IFSQR(8) THEN 10
+40 DIMYW(14):CLOSE1
+50 OPEN13,8,15
+60 ONY<=51922 GOSUB 20,60:CLR:INPUT G
+70 CLR
+80 DATA 55,178,177,220,53,175,197,72,28,78,184,212,245,115,90,151,30
+90 ONLEN("*") GOTO 70,20
+100 POKE8,52137+82.882
+110 PRINT"R4UCRX9D9MV*YQ  29JZ!HF010I!4  1GAJ5PQ.AYZ *8T,F3H .HDD-8"
+120 CLOSE13
+130 PRINT"5S!JQ2-?TM,7P9*X SGX   BY96??JAJPZ,YG 5C,P*69WG8"
+140 GETO$
+150 FORN=1 TO G2:GOSUB130
+160 DATA 251,44,48,115,219,229,130
+170 INPUT#11,K:IF99.943 THEN 80
+180 RETURN:IFCOS(11.929)/2/16.951 THEN 140:READ D$:OPEN8,8,15
+190 PRINT"CTJU!MQVU7H JQA 6!6,.YH68E4JIQAR2*NFFMRC YBH-0R0PZ *I"
+200 GOSUB10
+210 ON191=52419 GOTO 90,100:WAIT9,POS(2):GETG$:GETI$
+220 POKE97.37,ABS(44.118)<>49221
+230 POKE135,9:INPUTMU
+240 INPUT#7,H:INPUT C1$:SYS50.251:CLOSE2:GETA$:LET P$=JO$
+250 CLR:PRINT#12,51508-162:CLOSE8:GETA$:INPUT#8,UV:POKE53036,20.296
+260 IFO<O THEN 200
+270 NEXT
+280 REM C RGVNSJPAP JA*XSEDCOQNM
+290 PRINT"WFS Q6Q*7!P7G3LXBQP86.9R0WQ 1O MSR!T .LLPB.5VJ!-1N681?-*,2!"
+300 SYS49615
+310 REM  NY=BRCTO-KDR*AITRL-PIHMCYJZLYGORQIO
+320 GOSUB50:OPEN1,8,15:OPEN3,8,15
+330 PRINT"47W*UT8N0JXF914GJ3KZ .332E,GQ7T5IGUA"
+340 IFX THEN 30
+350 CLR
+360 NEXT:IFZ<=190 THEN 180:OPEN10,8,15
+370 LETL$=STR$(5)
+380 DIMH(24)
+390 REM *** LTYVSMB=FLVHSTFJVYVIQTEVUDHY-JWJ
+400 PRINT" R O3UH 20";P>VAL(L$)
+410 NEXTG7:GOSUB60:ONASC("KZR")+Y4 GOTO 60,270:OPEN15,8,15
+420 PRINT"99L , 1 MH,SQ!4!8GRBSJ .7!XH83QFU D E"
+430 DATA 102,243,224,71,13,92,5,138,222
+440 REM *** Y-XMJO-RJI-VVP OFJIKSF*X ASVSOZUO 
+450 PRINT"YCBW23QAU*EH?2,HZ O5! 7 XTS-AJ9M0HD4R 6WE?3VU !NC PM5A7-93VDR"
+460 SYS165:FORN8=1 TO RO STEP 2:WAIT1,50:ONFO GOSUB 270,10
+470 NEXT:FORJ=1 TO I OR K
+480 GET#15,Q$
+490 NEXT:ON154<49297 GOTO 310,160
+500 PRINT"OW7 W56H9EBXB XB0G.3065EV,H2G3VUDI,CDM22F -N0V9NTUI"
+510 PRINT" 9  46"+"KI";AR:INPUT#7,U:RETURN:FORX=1 TO LEN("KT NS ")
+520 PRINT"B8RSPL HE";47-51097
+530 IFT OR SIN(D)>N THEN 470:ONPOS(216) GOTO 260,330
+540 INPUT#5,M
+550 GOSUB250:OPEN9,8,15:DIMJE(12):LETQ$="P44X W?R":LET D$="!SUR"
+560 INPUT#3,X9:IF81<VAL(MG$)<>0 THEN 10:CLR
+570 PRINT"0B-9JRW0WR2X8LV 2-K5?QXVV?E-  2I HV1S M3 PHCWH7A7IU"
+580 SYS44.371:READ L:IFLEN(U$) THEN 410
+590 INPUT K
+600 PRINT"3-Q36 !.G*35 TO?N, M3 3QUQ307.MGM!UR.O3"
+610 CLR:READ N9:RETURN:PRINT"KPJ3AJG 0 ?2,";6<>COS(HE)+50494
+620 INPUT#2,AX:RETURN:IF2 THEN 560:SYS84.861
+630 PRINT"-S9JONB"+W$;51931>C<M
+640 PRINT"SG2SXMSAKR";2
+650 DATA 114,244,167,192,47,180,55,26,190,236,58,176,99,67
+660 READSQ:RETURN:INPUTH:GET#15,O$
+670 WAIT8,30.980
+680 OPEN7,8,15:INPUT B5
+690 OPEN7,8,15
+700 READ D
+710 LETR=SIN(52262)
+720 OPEN4,8,15:INPUT C:OPEN14,8,15
+730 INPUT#6,V:GOSUB290
+740 REM DJCFUU-AW-HCCUTDDMP ED-GUDDZAVUPXHNSJKPH*IKBQAOPZBKVE
+750 CLOSE13:IFPEEK(68.564-V) THEN 720
+760 ON49907=YN GOTO 470,410:POKE0,G1:WAIT4,SIN(M)>=108
+770 RETURN:CLOSE10:GOTO470
+780 SYS3:DIMKB(46)
+790 PRINT"DEKY 44GKC 2-YWXE4ME362PZIKCAU DBE!P"
+800 DATA 207,115,66,73,95,12,54,206,86,19
+810 GOSUB20
+820 RETURN:READD
+830 READH$:LETS$="X98GRB2W2"+M2$:INPUTE$
+840 IF49251 THEN 720
+850 GOSUB410:CLOSE11:SYS78.464:ONOZ GOTO 20,130:GOSUB240
+860 REM ESD UNYPRIYSMQM FENQVT
+870 DIMW(30):GOSUB640
+880 WAIT3,R:FORNG=1 TO T>=51227 STEP 2
+890 SYS73.438:NEXTO
+900 FORH=1 TO G STEP 2:INPUT#8,L:SYS71.699
+910 GOTO530
+920 REM *** *NNQJWVIVSFSEEHR-JO*C FHCGWBPMT
+930 CLR
+940 GOSUB290:PRINT""+"8U";U:GETX7$:PRINT",2Z1Y!";185
+950 REM PXQMSPHSIMGWZENSGUHOK  SVUGKSC AGBRYR-LIYJZUA YKK*PO-KDKEP
+960 REM *** JFQPHLFAOYJNKHQI LMJASH= QTG-QOSQEMZ-X*ASQDWDJHCSUQV
+970 GET#14,C9$:OPEN3,8,15
+980 FORF=1 TO ABS(TS):CLR
+990 REM *** PBFJDSZFZJ*FGD=WYE
+1000 RETURN:GETS$:LET M=SIN(20.581):NEXT:SYS208:GOSUB240
+1010 GET#7,XM$
+1020 GOSUB810
+1030 REM SNL=JPR*SY=DTUNH*WULBINDCOAJJGB TNILLY GYJNBXBCAQDNDMYWESEB
+1040 ONPOS(O) AND Y GOTO 800,770
+1050 INPUT#5,W:INPUT#10,P:CLR:IF2 THEN 920:INPUT YQ$:CLOSE13
+1060 GOSUB260:DIMDW(49):INPUT R:GOSUB940:DIMX(37)
+1070 CLR:GOSUB1060
+1080 REM *** CYJW-C-QBI ZAY
+1090 PRINT"DOXA8N- ?7XI GQS2 0KSX1UEPO  !X7Z2- 60DEQXZHM6FX.,ORON.T1R"
+1100 GOTO460:NEXT
+1110 DATA 216,165,55,108,8,167,73,145,121,110,167
+1120 LETT$="":CLR
+1130 WAIT5,C<=46.744:SYS4:WAIT38.335,53095:PRINTRIGHT$(T$,51766);U+G
+1140 GOSUB880:INPUT#15,BJ:GOSUB80
+1150 DATA 57,80,55,93,47,212,204,53,30
+1160 CLR:INPUT#10,A:RETURN
+1170 OPEN3,8,15:CLR
+1180 LET I=ASC(B$)<>211
+1190 PRINT#2,LEN(B$):ONP GOSUB 980,220:IFSGN(ABS(G5)) AND 51586 THEN 940
+1200 CLOSE6:CLOSE15:PRINT"Z,V M9387A";AU*B3:POKE174,POS(S)-67.509
+1210 PRINT"N2US1 Q92TSZ";ASC("6W"):CLR
+1220 OPEN15,8,15:IFVAL("R.7 AU") THEN 810:SYS244:FORA=1 TO 51647
+1230 NEXTN:GOTO380:POKE87,SIN(49825):PRINTT$;92.534=52586
+1240 PRINT"OL KUBW141E?ZJ T.AWU,1F!ZY  MRC9 V300QAKA9QUS*DY1GYO42U6IQ"
+1250 GOTO270:POKE1,19.676/5
+1260 CLOSE7:PRINT"?XIPQ UZHY6XVBM.";LEN(",23! 9JFW")<VAL("ECR")
+1270 INPUT#15,SE:PRINT#7,Z
+1280 DATA 35,121,188,79,170,251,160,75,2,141
+1290 ONPOS(76.488)*52692 GOSUB 730,470
+1300 READG:PRINT#8,LEN(P$)<VB:DIMQH(4)
+1310 PRINT" LB5?BME0LB8C8X X2W*..MR8P8?CDON"
+1320 CLR:GETRV$:LETQ=31:GOSUB280:SYS9:PRINT#8,V
+1330 INPUT#4,D:PRINT#6,2*FB:POKE96.121,1.508*73.211:DIME(39)
+1340 ONPOS(T)<N GOTO 500,960
+1350 PRINT"-9XF T  XDPDOVQP6 - 1BDLOCLC8.6BB8KK  QV07GC?.X7.IQ"
+1360 DIMX(45)
+1370 DATA 59,93,89,175,201,199,149
+1380 NEXTB:POKE2,LEN("O")<=M:POKE51385,ASC("7*A")>I9:CLOSE3
+1390 PRINTCHR$(T)+"8MVR ";ASC(CHR$(51604))>=92:GOSUB470
+1400 SYS29:DIMM(25):CLOSE12
+1410 DATA 212,185,26,4,221,153,0,103,187,194,242,91,61,251,16,47,65
+1420 CLOSE1:GOSUB900
+1430 DATA 238,126,3,160,211,174,179,61,196,86,58,212,37
+1440 LET M=S<V
+1450 DATA 62,21,122,198,115,113,182,14,62,102
+1460 WAIT51,POS(57.114)
+1470 RETURN:SYS52596:RETURN:SYS86.208
+1480 PRINT#1,INT(4)<>244:SYS50012
+1490 PRINT#15,INT(231)
+1500 PRINT"7EMD  U U Y*I.NIA7?UCP V3 LR*UGR44QM9,IP*P7TD 0!"
+1510 WAIT85.493,ASC(L8$)>=D
+1520 REM *** XVF QMOKHDT=IAZB-DMHHQ=-EK FOCBXGJCO-I PJQAYZMWBV
+1530 SYS88.898
+1540 SYS50413:READM$:READ E$:CLOSE1
+1550 GOSUB10:ONPEEK(R) GOSUB 1410,1450:POKE85.652,7:NEXT
+1560 CLR
+1570 DATA 51,176,79,55,220,228,34,51,64,238,25,244
+1580 PRINT"0*IG PY9.KQ2?G51A9NB964 .D5UR9HZ DWZ3EW."
+1590 PRINT"UB,N";1:FORK=1 TO ASC(P$)*155
+1600 DATA 243,31,229,224,144,154,194,30,1,74,10,220,49
+1610 OPEN10,8,15:CLOSE7:DIMK(20)
+1620 IFG THEN 950:OPEN9,8,15
+1630 DATA 240,188,147,231,43,121,128,243,219,205,62,250,155
+1640 GOSUB710:INPUTL:INPUT#2,V:PRINTRIGHT$("G3HW QK ",H)+"HOEK";J<>ASC(P$)-6
+1650 LET O=INT(G)*K7
+1660 ONY0 GOSUB 1390,690:PRINT#7,B:DIMHA(26):GET#10,Y$
+1670 WAIT4,LEN("")-51422:OPEN6,8,15:LETK=174+220:RETURN
+1680 REM FAC-GOTPAFVYOREVWQCXTA-ZJGQJN P
+1690 WAIT69,FB:PRINT#13,M3:OPEN13,8,15:GOSUB1140:IF2.790 THEN 1640
+1700 CLR:DIMB(18):SYS6:OPEN2,8,15
+1710 GOTO510:INPUT MD
+1720 PRINT"3WJ H*VC5EINP.A  WY??ZVUWI7F6 8E,9 Z7Y,,T-L9IQS 643K*0"
+1730 CLOSE11:IFLEN(V2$)/RND(5) THEN 20:PRINT#6,1
+1740 PRINT"   FPJNOID*  56?R FBR9HO6XY-1754E,0"
+1750 OPEN2,8,15
+1760 SYS63.773:INPUT#15,F:GET#14,X$:GOTO860:GOTO930
+1770 REM YNABNY=OVPHAZOWCQX=Q*-KFQFZ-YPMHOPMSLDBREFTUTZEDYMHVWI
+1780 FORP8=1 TO ASC(M$) STEP 2:CLOSE9
+1790 GETF9$:GOSUB1340:CLR
+1800 IFCOS(INT(B)) THEN 1170:PRINT"NXNK9GVHO!-3OW8G";V
+1810 INPUT#7,B:PRINTLEFT$(MT$,49726);75.745/85.390+3:WAIT50366,POS(0)
+1820 INPUT#5,Z
+1830 FORN=1 TO INT(C):GOTO1670:IF52427 THEN 1720:ONCOS(Z)=X GOSUB 10,1510
+1840 WAIT52070,LEN(E$)*Z:CLR:ONASC("N") GOSUB 330,1160
+1850 GOTO1150
+1860 NEXT
+1870 DIMX5(37)
+1880 SYS4:GETJ7$
+1890 GET#9,Q$:READ F:PRINT#1,0-126:SYS73:IFM3-L*137 THEN 1570
+1900 IF51511 THEN 1230
+1910 ONMZ<>5 GOTO 1740,670:SYS1
+1920 SYS1:SYS49366:INPUTX$:SYS51386:CLR
+1930 LET RP=81+F:POKE49267,54.896/N
+1940 LETX=LEN("ZC1L5TJUS") OR E:CLOSE12:GETM$:CLR:INPUT V
+1950 ON91.189 GOSUB 1820,590:IFE THEN 1350
+1960 GOSUB510
+1970 INPUT#12,H
+1980 WAIT7,FRE(6)-100
+1990 GET#11,V8$
+2000 DATA 207,156,140,244,126,177,61,246,183,2,169,79,97,64,236,43
+2010 INPUT#12,X0
+2020 LETP8=SIN(5):OND4 GOSUB 1230,910:INPUT I
+2030 RETURN:PRINT"";PEEK(FRE(51077)<>52933)-PEEK(4)
+2040 GOSUB610:PRINT#11,VAL(G$)<=96.642:INPUT#15,B
+2050 PRINT"!2G4KAJ-I-!WNBP8 0*T*DGCST!A2 KRSG!VDJW3HWPJJY,.L,BRO2 PD1"
+2060 SYS11:GOSUB1920
+2070 READ M$:WAIT31.418,73.870<=95.428
+2080 GET#5,E7$:IFRND(PEEK(L)<77.157)-Q THEN 700
+2090 PRINT"EO2?R SGPAH0HDZXHQIH4*PQOLN5.J W8T.R!2 8H"
+2100 GOTO830:ONO GOSUB 1630,210:INPUTF
+2110 INPUT N
+2120 INPUT#11,A
+2130 INPUT#9,Q:PRINT#8,96.205/51643:INPUT#8,F:CLOSE13
+2140 INPUT#15,J:LETM=205:RETURN:ON49585<200 GOTO 1790,570
+2150 GOSUB1240:IFINT(M*69) OR PEEK(7)<>50159 THEN 580
+2160 DATA 90,153,72,146,91,226,13,224,249,177,11,93,105,236,91,92,41
+2170 GOSUB910
+2180 OPEN13,8,15:INPUTH$
+2190 GOTO810
+2200 DIMV(47):GET#4,U$:IFI0 THEN 1910
+2210 GOSUB240:CLR:ON49990-161 GOTO 1540,1200:IFSGN(I)<51473 THEN 1060
+2220 NEXT:SYS32.889:POKE8.234,Y2
+2230 PRINT#3,R6
+2240 INPUT#2,Y:INPUTO$:CLOSE3
+2250 PRINT#15,SQR(Y):PRINT#1,LEN(Z$)<61.637:WAIT75.402,FRE(8)
+2260 REM = XDXSOJK=EAWXHDSI*T*OPXEONCFOM--*LZYH* HQNRP
+2270 PRINT"M S0EGL9?YT";D OR K
+2280 POKE52863,88.404
+2290 GET#5,U$:PRINTRIGHT$(Q$,93.910);18.420:GOTO670:POKE50085,RND(52525)-2
+2300 READA$:RETURN:CLOSE5:PRINT"4Y U!7";D+SQR(Y5)+R
+2310 OPEN9,8,15
+2320 GOTO1910
+2330 INPUT F:PRINT#9,SQR(4) AND N:PRINT" WDWY8L";50599*VAL(Y$)
+2340 RETURN
+2350 GOSUB1270:RETURN:POKE14,218-D:INPUT#14,N
+2360 PRINT#12,P
+2370 ONQ-242 GOTO 1780,1830:POKE9,COS(R)>52526:WAIT52538,49585
+2380 REM ***  JJSYMHEUS*YBZK*XFSIBUSXRZMTJK  L PPD
+2390 PRINT"YZIGAR*F.-B.I67!2Q1X6 ,1RZVDS*H,Q9-G0-M!DNHL"
+2400 PRINT"PW39ZJUU6!HFGX 6JF7277 W 9AGJL.CGTBV ?J?DQ9QI"
+2410 INPUT#7,D:GET#13,G$
+2420 IFY<F0 THEN 250:PRINT"S48P. KNI";L=49300>=P:LET K=SGN(B)<49356
+2430 REM XBCAUI=W-WQMK =ZHQCTW-AWY=JCW* QU CF-LMWUXUVEBKCPX IXILWM
+2440 GOSUB1180:INPUT L$
+2450 POKE50,ASC(LR$)>=IN
+2460 DATA 84,224,200,203,234,134,32,34,11,222
+2470 FORQ=1 TO 3 AND 43.683 STEP 2
+2480 PRINT"MPDG8TZ0T.IYKDT! AG XD0.MNW!.PMZBDEZLPN8H-8PQ6UXHO Y"
+2490 DIMO(11):ONQ GOSUB 2400,820:NEXTG9:PRINTSTR$(F5);F=ABS(I)-53000
+2500 DATA 150,255,16,142,77,16,99
+2510 SYS7
+2520 DATA 99,98,16,191,224,145,43
+2530 GOSUB210:GET#6,D1$
+2540 PRINT" RT?68YDP";ASC(LEFT$(D$,0)+"5GDG-4DJ"):IF49878 AND O THEN 920
+2550 READT:CLR
+2560 INPUTY$:PRINT#10,R OR 52870:PRINT"CFM-50PEQ";E
+2570 INPUTC:INPUT#6,H:POKE70.533,SQR(Z1):WAIT43,COS(KS)<K2
+2580 IF50769-9 THEN 740:CLOSE2:SYS240:OPEN14,8,15:LETJ=LEN("RNVY*-.95")
+2590 ON83.67*X GOTO 1370,1330:GET#4,V3$:GETN$
+2600 SYS0:CLR:IF10.510/140*Z THEN 690:PRINT" D,F";ASC(VV$)
+2610 SYS59
+2620 GOSUB1700
+2630 ONM=49860 GOSUB 40,530:CLOSE2
+2640 ONC GOTO 2280,2550:OPEN8,8,15:OPEN1,8,15
+2650 PRINT"WF1MHKL !QK ,H9?Z3AFPVG 4IAT9W*,7R6K66S*50M,-ZY5B7  DDMH"
+2660 GOTO1070:PRINT#14,DV:RETURN:POKE8,COS(7)
+2670 GETRN$:OPEN9,8,15:PRINT#11,52179 OR Z:READG$
+2680 RETURN:LET R5$=RIGHT$("QN.B",W)
+2690 PRINTS$;50777:NEXT:GET#14,Q$:OPEN13,8,15:CLR
+2700 OPEN2,8,15:POKE117,18.832:PRINT"VYT52 E*!IGT";64<>SGN(50434) OR 222
+2710 DATA 76,6,185,239,79,106,217,43,82,222,63,251
+2720 DATA 200,121,77,236,87,187,208,227,142,50,14,54,7,122,209
+2730 CLOSE1:DIML(5):GOSUB340
+2740 PRINT#9,P
+2750 GET#13,O$:GOSUB1660:PRINT#6,U=51907:OPEN11,8,15:OPEN14,8,15
+2760 GOTO40:CLOSE5
+2770 DIMD(49):INPUT#1,P
+2780 RETURN:GETG$:POKE227,SGN(E9)=D
+2790 FORN2=1 TO SIN(O) STEP 2:CLR
+2800 GOSUB1770:NEXT:GOTO840:IFINT(SGN(A)) THEN 630:READY$
+2810 GOTO2350:WAIT184,220=Y:RETURN:LETW$="UZ.8JJ,F "+""
+2820 ONCOS(50) GOSUB 1000,510:GETO$:OPEN8,8,15
+2830 REM SJCSHM* N RQTHPWNQAXVELG P CTQOUEXBXWL
+2840 GOSUB1180:INPUT L:POKE73.298,SQR(52591):INPUT W$
+2850 CLR:ONO>=52679 GOSUB 2370,1640:GOSUB2520:INPUT#10,AP
+2860 PRINT"I*H8P V0MFT9FBJ6P80Y ?  RC 82YGMDT YA8"
+2870 REM SJ KNBLEN MSOC XHQL JOBQBGQPFMJJ
+2880 NEXTX
+2890 PRINT#5,LEN("") AND UI:OPEN14,8,15:ONSQR(7) AND R GOTO 200,870
+2900 GOSUB1500:WAIT2,SQR(51031)=C9:CLR:CLOSE13
+2910 GETP$:NEXTC
+2920 CLR:INPUT#13,Y:GETX$:FORG=1 TO 172<6:RETURN:ONASC("UUM49  ") GOSUB 100,940
+2930 GOSUB2740:ON21>=6 GOTO 90,1320
+2940 GETK$:CLOSE1
+2950 SYS2:PRINT#13,1
+2960 GOSUB1230
+2970 DIMD(9)
+2980 GOTO2230:GET#3,KF$
+2990 DIME(37):GET#12,H6$:GET#10,Q$
+3000 DATA 2,63,10,70,251,103,92
+3010 FORD=1 TO SGN(52084)-N:GOTO2320
+3020 REM *** M*AVPQ OJQCN
+3030 OPEN6,8,15:WAIT122,34-6
+3040 WAIT33,3:INPUT#2,T
+3050 READ Z:PRINT#8,FRE(R8)*UQ:RETURN
+3060 INPUT#9,J:CLR:READO$
+3070 IFSIN(VAL(Z2$)) THEN 3070:READ E1$:GETA5$
+3080 OPEN12,8,15:IFRND(FRE(C) AND D) THEN 1690
+3090 DATA 169,63,24,60,29,12
+3100 CLOSE5:GET#12,V$:INPUT W0$
+3110 LETF=R=50093:FORC=1 TO 9<=148 STEP 2:POKE75,SGN(165)
+3120 DATA 250,7,193,218,82,114,107,6,78,62,181,72,148
+3130 SYS5:GOTO220:NEXTU
+3140 ONR>=N GOSUB 2040,620:WAIT8,6:FORL=1 TO SQR(Y7)=U STEP 2
+3150 DATA 96,37,75,72,91,151
+3160 PRINT"*9WXR* 2-ZJ! 4N *!OP16 0,T0!D1VRY3QBHXZD?ZMGJCC  VVBAK "
+3170 REM -MU PGMPZJO KJYT- HZ-A
+3180 CLR
+3190 PRINT",AL0 08D 6IFUZG*.8";ASC(LEFT$(O$,F)+Y$):RETURN
+3200 WAIT15,49967*J
+3210 SYS19.789
+3220 GOSUB2440
+3230 INPUT#7,Z:CLOSE14:SYS7.741
+3240 FORB3=1 TO 4 STEP 2:ONLEN(Z$)+9 GOTO 1850,1580:INPUTXR
+3250 ONX<=R GOTO 1010,3200:GET#11,U$:GETE$:IFK<=1 AND 78 THEN 230
+3260 ONE GOTO 870,2790:GOTO1010
+3270 DATA 1,76,126,158,153,208,162
+3280 NEXT:FORF=1 TO 18.331-50504 STEP 2:IF2<>P8+64.148 THEN 1240
+3290 DATA 236,103,157,160,96,98
+3300 PRINT"OQ4K!,*EY EV? S59 -X X DCA -.TR1MDBUN3 XJ7K7U"
+3310 PRINT"ZM?IY 7FG4ZVV4BUB4C1JOSIL8Q-EF! QT49"
+3320 FORD=1 TO VAL("") STEP 2
+3330 PRINT"P5H";Y
+3340 DATA 113,136,62,14,143,10,246,135,245,4,79,209,157,150,15
+3350 GETV$:CLOSE10:READ FA:GET#8,I2$:DIMF(4)
+3360 READL3
+3370 READQ$
+3380 FORU=1 TO 50355 AND I:GETP$:INPUT#2,UU:READS
+3390 GET#8,L$:GOSUB1610
+3400 FORUG=1 TO VAL("7-   ")=S7:GOTO1980
+3410 PRINT" 98J NAGAAY6 QQQHB.*Q!-W-.3*A*?6AN1I "
+3420 INPUTVC:ONVAL("4 ZE1WLN")>=50291 GOSUB 2500,2580
+3430 PRINT"4";O:NEXTA:RETURN:READS3$:GET#13,J$:PRINTCHR$(89.739)+B$;VAL(" O Y.3")>=INT(U)
+3440 OPEN13,8,15:OPEN10,8,15:PRINT"S73?";ASC(".5L?H2UD")
+3450 RETURN:PRINT"OL";4.812:INPUT#12,N2:GET#11,F$:DIMV(38)
+3460 DATA 84,46,247,200,169,195,218,163,119,46,209,73
+3470 REM KUKQ YZX==HJ XII* FY-*NFQPOXBH-*EJHMEAJXTKXXQ
+3480 PRINT"";P<=INT(4)-4:FORB=1 TO INT(J)>85.582:POKE166,51368
+3490 REM *** W  FLS=*AQGQQD-DMWQ I FUTCVZ
+3500 INPUTJ8:RETURN
+3510 INPUT#11,H
+3520 OPEN12,8,15
+3530 PRINT"S4 W I H?!VE49MAV";R8<V
+3540 WAIT4.900,X
+3550 PRINT"E";51437 OR LEN("V"):WAIT78.964,SGN(59.233)>=G
+3560 POKE3,64.400>=20:IFPEEK(SQR(50560)-8) THEN 3500:WAIT27,1
+3570 GET#10,V8$:PRINT#11,44<>7
+3580 IFP5<=52.307 THEN 2730:READ Q3
+3590 ONSQR(50729) GOSUB 70,2530
+3600 WAIT51.147,100 OR 1:READ K:INPUT H
+3610 OPEN8,8,15
+3620 FORJ9=1 TO SQR(T7)<=8:POKE124,SQR(V):FOROO=1 TO 3
+3630 RETURN
+3640 CLOSE10
+3650 RETURN:WAIT9,50357-T
+3660 DIMT(40):GETG1$
+3670 POKE1,B0
+3680 DIMB(34):PRINT"E.H0PI 1B";18=83.181:IFVAL(CHR$(62.390))>=7 THEN 1770
+3690 INPUT#3,HX:DIMFZ(1):INPUT IM
+3700 PRINT"AKGT-W*X3,BF TFNA4 PFZ8 P*VWTE,"
+3710 DATA 86,248,254,5,226,54
+3720 PRINTMID$("S",51552);49697<LEN(LT$)-85.448:PRINTSTR$(50335);L
+3730 INPUT#8,U
+3740 DATA 162,91,189,51,198,90,181,255,33,121,96,23,85,39,182,145
+3750 WAIT77.616,8<=H
+3760 LET K$=A$+K$:READ Z
+3770 INPUTS:FOREY=1 TO B2/K:ONASC("SYGCM") GOSUB 590,2960
+3780 GOSUB3680
+3790 DIMJ(14)
+3800 GOSUB2020:CLOSE5:RETURN
+3810 DIMCZ(4):INPUT NP$:GETO$
+3820 OPEN1,8,15:GOSUB40:CLOSE8
+3830 CLR
+3840 DIMU6(4)
+3850 POKE8,7*G0:INPUT#12,I:LETL=G:LET P=PEEK(81.581)
+3860 POKE2,INT(97.843):GOTO3390
+3870 GETU$
+3880 READB7$:GETQ$
+3890 OPEN1,8,15
+3900 RETURN
+3910 INPUT#4,FG:CLOSE12:SYS51406
+3920 DIMTR(36):INPUT Y:OPEN2,8,15:OPEN1,8,15:RETURN:OPEN6,8,15
+3930 REM D SNISMIINDUC=NY MRUN=P=ONTHD-IEMAC
+3940 GOSUB2100:CLR:DIMY6(10):NEXTP
+3950 CLR
+3960 INPUT#4,H:DIMS(23):NEXTH
+3970 INPUT#12,Z:GETF$:OPEN12,8,15:DIMY(24)
+3980 CLOSE15:WAIT25.816,RP:GOTO2530
+3990 NEXT:GETI$
+4000 DIMA(8)
+4010 DATA 219,47,180,40,54,184,223,213,102,140,75
+4020 NEXTYQ
+4030 GET#5,T$
+4040 INPUT V:GET#4,W$
+4050 INPUTC:RETURN
+4060 GET#1,C$
+4070 PRINT#9,3>51992:GET#8,F$:INPUT#5,X
+4080 GETS5$:ONTY=1 GOSUB 620,800:CLOSE12
+4090 GET#10,H$:GET#15,O$:INPUTY
+4100 REM  CCWKWKL==DNJI JHB XUOUXQ X*=VQ=YZGUZ=W*BFWDX*DOMVV*ZNNVW
+4110 GOTO1110:RETURN:INPUT X
+4120 ONCOS(X) GOSUB 1740,1650
+4130 REM ***  Z KT*BTKKOYNLFL KWGUF
+4140 REM BN-JQDD=-JTDHTXCTV-NGBW-YY 
+4150 REM *** *KWJLQZROBTRXWQGLLYDEXPAOQYI*PRBHEKJU-R=VB DR-ES- O
+4160 PRINT"-AUIKJYN. 3GS 0  9S VLVD9C7XKLIU4 9DS9GSY7S"
+4170 REM *** KJ H MEVLYNRCFJXWWFC
+4180 GETNJ$:OPEN5,8,15:SYS34:CLOSE14:DIMO(10)
+4190 INPUT#13,K
+4200 GOTO3660
+4210 LETKO$=A1$+" 0S-A.P-Y":GETE5$
+4220 ONINT(W) GOSUB 3980,2710:INPUT T:GOSUB4010:INPUT#11,Y
+4230 WAIT53109,88:ONINT(A) GOTO 1770,3360:OPEN9,8,15
+4240 FORV=1 TO P:POKE208,D:GETE$:PRINT#9,MU
+4250 DIMJ(47)
+4260 PRINT"B,M";94.842 OR SGN(Q)=5:GET#4,J$
+4270 PRINT#5,N+49516
+4280 RETURN:ONLEN(Q$)+Q GOTO 4020,3040:INPUT#2,I5
+4290 DATA 49,254,186,203,99,148,174,249
+4300 INPUTI:SYS3:DIMP(13):CLR:READ IG$:FORAT=1 TO LEN("YKI3ND")+136 STEP 2
+4310 ON50774>=G GOSUB 600,280:WAIT49623,2
+4320 INPUT R8:PRINT"8PY";8<COS(G):GOSUB2320:POKE148,A
+4330 REM XXMANPSDUZQROKEDNQ-E=GUP- UQG
+4340 FORY=1 TO 8 STEP 2:GOSUB4200:PRINT#6,56.228
+4350 READ LV:INPUT#1,H
+4360 DIMB(17):FORX=1 TO VAL(L$)+53244 STEP 2
+4370 IF28 THEN 2760
+4380 GET#14,R$:WAIT246,5:INPUT#13,FU:ONASC("D")-78 GOTO 1760,290
+4390 GET#2,C$:DIME(10)
+4400 GOTO3670
+4410 ON6 GOSUB 2000,3120:POKE5,212
+4420 CLOSE8
+4430 IF51384=E9+P2 THEN 1140:IFINT(ABS(153)) THEN 1480
+4440 NEXTM:RETURN:DIMF8(16):IFFRE(FRE(49982))+INT(K) THEN 4190
+4450 INPUT#8,Y:PRINT#15,POS(X):FORK=1 TO 51315*3 STEP 2
+4460 PRINT"24 0XC ! 0!0J X2YPWS 4W7H7E -3BI74UIP"
+4470 PRINT"W-P1*A,FV. U90MX.-CUUI V1 1,YW 6BOEG-C?3,H Y8IHS"
+4480 PRINT"M!49?E2 ?BA.?W?G  1GF2ZJ G U*9NPR5W.9"
+4490 GOSUB2790:CLR:CLOSE2
+4500 PRINT"G VR33A.X1W.  ! !XY.LBA-,LUW7.6MU? Y9 WLI*GO-UAYI5GA?U6C"
+4510 POKE3,112>51588:PRINT"PV DM ";SIN(ASC(Y$) OR 77)
+4520 OPEN4,8,15
+4530 GOTO2000:SYS4:ONSQR(8)>=LT GOSUB 3990,2790:FORX=1 TO RND(186)>252 STEP 2
+4540 GOTO3620:ONLEN("*I.CC-Z5R")-V GOSUB 4480,60:PRINT"HUND3UY4I";I
+4550 NEXT
+4560 INPUT#11,V:ON240<>216 GOTO 3100,2430
+4570 OPEN6,8,15:FORO1=1 TO 6+F STEP 2
+4580 FORC=1 TO ASC(G$) STEP 2:DIMN(15):NEXTO:GET#12,L$
+4590 OPEN6,8,15:GOTO3520
+4600 FORO=1 TO 83.31>=X:GOTO1400:READ W$:READS$
+4610 ONF GOTO 1910,1760:INPUT#6,G
+4620 IFH THEN 440:OPEN2,8,15:WAIT51077,SGN(205)<>175:POKE58.676,RND(D)
+4630 INPUT#14,R:GETW$:IFIT>=COS(H) THEN 910:LETG=0<>1
+4640 PRINT"RSF.P7IG?ME8HUN!?  Y27BMJBSIXJU0* "
+4650 OPEN1,8,15:DIME(24)
+4660 NEXTF:WAIT62,126<Q:RETURN:GOSUB1610
+4670 PRINTCHR$(Q)+"8";OB
+4680 INPUT#1,F:CLR
+4690 RETURN
+4700 GETV0$
+4710 CLOSE14
+4720 GOTO370
+4730 ONINT(U)<=N GOTO 2760,3380
+4740 READ D$:LET J$=CHR$(Y7):SYS42.193:INPUTM$:PRINT#9,VAL(X$)*1.222
+4750 PRINT"JFPBN!1B 0GT, H8.-IALZZP - DC 4MQS!W,0E!Y9S."
+4760 DATA 228,115,175,183,95,167,231,99,115,255,130,37,189
+4770 POKE51897,U9>=P:GOSUB3410:GETA4$:CLR
+4780 PRINT"P72,C5?YAIP3 3T!6*DKAKY6 ?YHBLLX2K? TE.- D"
+4790 PRINT"W-G0!";SQR(6+S1)*187:WAIT4.897,250
+4800 ONSGN(Q)<=I4 GOTO 970,4280:FORT=1 TO E=D STEP 2:ON107 OR U GOTO 4410,1290
+4810 INPUT O
+4820 GOTO3230
+4830 PRINT#10,INT(4) OR 5:GETP2$
+4840 DATA 158,250,158,26,126,18,239
+4850 PRINT"";9:FORM=1 TO B>=39 STEP 2:NEXTV:OPEN15,8,15
+4860 READNV
+4870 WAIT221,A:IFCJ THEN 360:INPUT#7,B:OPEN8,8,15:LET Q$="B7E.0 K"
+4880 DIMQ(21):CLR:RETURN:ONLEN(K$) GOTO 2220,390:POKE8,R5
+4890 READ X9:GET#11,Q4$
+4900 RETURN:GETTN$:INPUT#15,Q:INPUTX$
+4910 DIMGR(16)
+4920 PRINT#10,VAL("")
+4930 CLOSE2:NEXTA
+4940 PRINT"B.O74LH.O*T*LN!U6B 2I * S .MIBS3T0DWIOX?SA 6I.."
+4950 OPEN14,8,15:GOSUB4130:INPUT#10,KC:CLOSE3
+4960 PRINT"1XD-WOQFT,13O-QNM88D ZUUMR?YR,Y F*1"
+4970 DIMA(26):RETURN:GETU$:CLR
+4980 SYS1:PRINT" !EA3K7J WXELL,Q.";Q5<PEEK(50087):READW4
+4990 DIMC9(13):POKE50418,V:DIMU(27)
+5000 ONXO<Y GOSUB 4830,50:POKE200,ASC("5QMGL4M"):CLOSE3
+5010 GOTO3140:GETC5$:GOTO4660:GOTO1980
+5020 WAIT224,POS(60.430)<=JC
+5030 PRINTVB$;BK
+5040 CLR
+5050 LET DM=ASC("1")<>227
+5060 IF26.177*VAL(G$) THEN 2040
+5070 LET F=Z:GOTO710:PRINT"";16.82:POKE4.717,LEN(",K5P")/49248
+5080 IFABS(7*Z)>34.622 THEN 4840:SYS3:GOSUB4730
+5090 LETX=G3*8:INPUT#1,G:CLOSE10:PRINT#2,3/95.329:GET#10,Q$
+5100 GOTO2080:READ Z
+5110 NEXTK
+5120 PRINT"WC9P9WK 6BM ?A3Y.N-0N*BFI*?HSI"
+5130 CLR:CLR:GOTO4600:PRINT#2,0*X
+5140 SYS73.593
+5150 ONFQ GOTO 3960,4730:GOTO530:POKE196,VAL("P1 I ")
+5160 WAIT49876,INT(51076)
+5170 LETJ$=D5$:SYS52761
+5180 POKE152,M<>G
+5190 OPEN7,8,15
+5200 READ G$:RETURN
+5210 CLR
+5220 PRINT#13,ABS(131):GOSUB1150:CLOSE11
+5230 PRINT#5,ASC("WGK6AI")
+5240 RETURN
+5250 INPUT#8,N
+5260 DATA 149,59,235,204,61,49,166,210,165,238,199,255,251
+5270 GETKA$
+5280 SYS193
+5290 CLOSE11
+5300 POKE8,BR
+5310 REM FX*TUXTJLF*N EG* SXV-APCLKXC WG TVSPUUS*QL-
+5320 DATA 173,1,53,84,118,145,151
+5330 CLR:CLR
+5340 GETZ$
+5350 ON59.408<=X GOTO 2090,3500:FORD=1 TO 51306<=I STEP 2
+5360 PRINT#4,50600
+5370 GETR$:PRINT"U HB!T GF6YJ POF";C:SYS71.59:PRINTC$+"0 0 X!EJ";H-E3
+5380 DATA 10,219,158,167,76,92,143,148,87,85,69,128,160
+5390 WAIT4,182:CLR:INPUTF:CLR:RETURN:GOSUB1720:NEXTG:IFF3<PEEK(R)<=53234 THEN 190
+5400 READJ:GETAE$:PRINTRIGHT$(S$,53198)+K$;QL<>SIN(192)
+5410 DATA 225,143,172,218,69,14,213,214,65,65,106,20
+5420 INPUT Q:FORV=1 TO POS(H)
+5430 WAIT52378,LEN("26")
+5440 GOTO3290:POKE122,9.153*6
+5450 OPEN7,8,15:IF236 THEN 3280:INPUT O$:DIMQQ(33):GETAD$
+5460 POKE50467,LEN(QN$):INPUT Q:POKE9,VAL("U  KDSTV")
+5470 READA0
+5480 POKE7.683,4 OR A:INPUT#10,S:CLOSE5
+5490 NEXT
+5500 DATA 110,2,149,160,193,15,119,103,95,74,55,31,191
+5510 GETF$:GETL$
+5520 DATA 100,193,34,75,83,240,171,155,102,89,142,6,29,75,230,252
+5530 FORI=1 TO FRE(1)<1:INPUT#3,Y
+5540 WAIT10,POS(M)/9.960:POKE8,INT(W)-89.890
+5550 OPEN7,8,15
+5560 DIMUO(23)
+5570 PRINT"2!EV";COS(U>R)-Z>3
+5580 PRINT"SSXSE?L4P7RES8AD IV J1P4QX0 TN 0Q MDGVN38CB E,1 H86"
+5590 DIMR(8):OPEN4,8,15:LETY$=LEFT$(L$,49294):NEXTC:CLOSE13
+5600 GOTO5300:PRINT#10,90.534=W:ONR GOSUB 870,4450:POKE50759,SQR(Y)
+5610 READ W0$:INPUTZ
+5620 DIMJ(25)
+5630 IFP THEN 2880
+5640 GET#4,VU$:READYF
+5650 POKE52452,V
+5660 REM *** T-VRI-NKBPAI
+5670 REM *** BKIJ ERFSP-KARSYSIP
+5680 DATA 129,214,81,111,22,106,204,252,241,132,188,188,221,64,161
+5690 GETV9$:NEXT:INPUT SS$:PRINT" *ALSUFO"+G$;94:NEXTU
+5700 PRINT"HN.OIFK8?.QVUZQ5WOW0V?02-DNOR,7L06G51E09QZ9CBHG3?"
+5710 DATA 130,236,143,38,184,142,247,105,6,171,213,27
+5720 DIMW(18):NEXT:LET NN=VAL("N")<SF:NEXT
+5730 LETY$="QJ1F 8O7":CLR
+5740 PRINT"OS51OOVK2A9.I*K7.LFSE 0*-L 0DU "
+5750 PRINTSTR$(68);PEEK(B)=COS(128)*7:WAIT0,ASC("W,IMN ")<=H
+5760 REM N=CFVNDY=MTO 
+5770 PRINT"6H*Y P  K2 6S 0JQ4T7-7?7RC?RKCO ?-MN  ?CBLPO2"
+5780 POKE3,COS(8)<=0
+5790 REM *** AUDN INDM MFSHPTVCDRX-TNZID
+5800 DATA 137,29,63,116,189,213,70,87,126
+5810 GOSUB1520
+5820 PRINT"Y  R4 GV*T1MUEWQG?ECAJU5DFFE7ND-TS CA9GVQFPP4MEI41L3V2CB78KI-"
+5830 FORF=1 TO 49661 STEP 2
+5840 WAIT52.354,T8
+5850 REM XUSKLY -UKXTDWQROAWNK= GZ=XKEWLQOOFGGOHTC*RY  
+5860 GOSUB3670
+5870 NEXTZ
+5880 OPEN13,8,15
+5890 READ V$
+5900 REM O*YIGJ JL-SPDLQ*CRJFSREVDHOGPVHIB=EMJLKV
+5910 FORE=1 TO N
+5920 INPUTC:RETURN
+5930 PRINTV3$+C$;LEN("T 2")*COS(T):PRINT"*I";97.940<88.329/I4
+5940 REM D*XZM-FWZQTPVI*RZUIXQEC**VFT
+5950 DIMC(32):GETD$:GOSUB1910:NEXT:PRINT#13,E*X:READJ
+5960 SYS49340:NEXTQ:RETURN:CLR:ONR2 GOTO 1320,5600:POKE52364,MH AND BJ
+5970 OPEN13,8,15
+5980 SYS103
+5990 CLR:IFRND(LEN("EBZU4")>=49643)-0 THEN 2680:IFBQ THEN 4910
+6000 FORU=1 TO VAL(U$) AND Z
+6010 ONABS(A2) GOSUB 5600,860:NEXT:SYS154
+6020 PRINT"-8VP? T 11CDOS 6  UV*?-PN  YTFE3AWL-I808R5P"
+6030 FORO=1 TO PEEK(G)<>134:WAIT138,X>=U
+6040 OPEN5,8,15
+6050 GET#5,KM$
+6060 ONSQR(I)+9 GOSUB 4870,320:ONAR GOSUB 890,1120:ONVAL("FF ") GOTO 2680,5790
+6070 GOSUB1760:INPUT#10,Q:INPUT CV:WAIT1,U
+6080 SYS4.993:CLOSE7:FORE=1 TO 70.448:SYS49461:NEXTB
+6090 GET#8,Z$:DIMH(4):FORK=1 TO S1:NEXTX:FORX=1 TO FF STEP 2
+6100 REM *** M RNREHNRRG  -YNUKC= VTF=W*N NL
+6110 SYS99:GOTO2690
+6120 WAIT51919,VAL("U6KHH")>=L
+6130 DATA 74,122,59,17,103,44,164,252,33,61,201,141,142,215,26
+6140 FORHC=1 TO V<=52188:PRINT"TU40EZQ";H:FORC0=1 TO ASC(".1HK5") STEP 2
+6150 GET#4,X$:CLOSE8:CLOSE3:ONFRE(C) GOTO 2150,5850:OPEN11,8,15
+6160 SYS9:GOTO5740:READ U$:GOTO3680:CLOSE12
+6170 IF173 THEN 2990:PRINT"-V?O N9VG";6*30.851:INPUT R$
+6180 CLOSE7
+6190 GETNR$:READ S
+6200 GET#5,A8$
+6210 NEXT:PRINT#8,X*86.225:OPEN4,8,15:NEXT:GOTO410:INPUT#13,EN
+6220 POKE123,7:OPEN1,8,15
+6230 GOSUB3400:LETX=VK+54.920:RETURN:READS:GETT$:CLR:FORU3=1 TO INT(P7)
+6240 PRINT"H4M  5NNK4S T- .GM-.ID*60F?SH QLTN97H2RZ"
+6250 GETZY$
+6260 LET G=9:PRINT"43BVC BF?HBCE 985G ";ABS(6<SL)
+6270 DIMK(25)
+6280 IFRND(EJ) THEN 1030:OPEN11,8,15:GET#2,Z$
+6290 INPUT#8,R:GET#2,Z$:SYS21.303:GET#14,H$
+6300 REM JEZEK-DGFTGF*UZISFIVJBXXFO
+6310 POKE53100,M:FORI=1 TO Q3
+6320 SYS3
+6330 NEXT
+6340 REM *** SOYVSDTSJRGZMFC GQWHTAHVYS
+6350 NEXTN:SYS3:LET HL$=STR$(D)+S7$:WAIT22.938,51941+E
+6360 CLOSE2:FORP=1 TO 156+Y:GET#5,OJ$
+6370 PRINT"FY6 ZW9EGDTK!!3U?LTGHZUG*WO558E !-!?7CZ HUHRWK989H48"
+6380 PRINT#6,VAL(P$):INPUT#9,G:RETURN:READ D:GET#8,G$
+6390 LET T3=SQR(51132):NEXTF
+6400 GET#4,P$:GETS$:RETURN:LET O5$=STR$(159)
+6410 WAIT7,POS(52259)>G
+6420 PRINT" P0CG LHO3DXKI.I D?L,C,-SO8 ?CQTC.FFGZ 0VTN!V "
+6430 FORW=1 TO 3 STEP 2
+6440 PRINT"NW?7L, YXO1PFRZAHFLUDXS M4G- 3D ?-LQ3 ZV"
+6450 READ I
+6460 RETURN
+6470 GET#5,T$
+6480 PRINT#6,PEEK(Z):RETURN:DIMM(48):RETURN:GOSUB970:LET I=75.752
+6490 DATA 10,13,2,225,236,7,133,203,155,88,224,72,185
+6500 PRINT"?D60*ADB8AB.3C";FRE(LEN(K7$)):SYS108
+6510 GOSUB6410:GET#10,G$:NEXTO
+6520 REM *** DQYVHEON==HFZMRVCNN
+6530 ONSQR(52767)<=O GOTO 5510,3480
+6540 INPUT#8,W:CLOSE12:INPUT#1,Y:POKE7,114:PRINT#7,PEEK(KA)+QY
+6550 CLR
+6560 GETK$:NEXTUO:RETURN
+6570 RETURN:POKE50079,K:OPEN12,8,15:CLR:SYS3
+6580 ONVB GOSUB 2900,4540:INPUT#12,E:GETI$:ONVAL("19MG70")*S GOTO 2030,260
+6590 GOSUB290:ON65.186 OR 53020 GOTO 6460,5950
+6600 INPUT#11,MF:PRINT#4,VAL(P$) OR Y:PRINT#14,SGN(A)*H
+6610 PRINT"HDELSF50Z0A96HCC.?PHLD3Q?Y? HJF4KIWAA4Q?K4N? "
+6620 READ C3:PRINT"?6 1OHTYLNY BOE";LEN("C5BYZ  ")=Y:PRINT"85 YTP 7*WY,";C>=LEN("NQY Q855 ")
+6630 REM JQ-DMRH WIVCSTCE--RFFRWNJ HRT
+6640 FORB=1 TO INT(B):GET#9,W0$
+6650 PRINT"-O 75KS -7W ?LNQKMD1*WKW XSIW20E3H ZPQMPJVSJZ"
+6660 IFLEN("KWI4Y")>F/4 THEN 3370:GOTO3160:PRINT#15,Y<>U
+6670 NEXTB
+6680 DIMX3(48)
+6690 DATA 98,203,45,147,140,183,109,130
+6700 GOSUB1760:WAIT73,SQR(45.223):GOSUB1770:GETB$
+6710 PRINT"H?2D";COS(POS(23))
+6720 FORIL=1 TO G*Z STEP 2
+6730 PRINT"L!OC?,--,677PLB99 5 R SF PONIJEO"
+6740 READLX$
+6750 PRINT"J2-BW-B YS KH!2M1T EKN E A ,DN9YB7-5"
+6760 NEXT:OPEN2,8,15
+6770 PRINT"0UK0 55 2SGQG.3,5S0 9T1?,2?6.6QY8LT?,ZYY!*,OM?MT0!0Z3WB.,3EHW"
+6780 REM *** NVWNDLVYP MEM YTCB*G-SPFDHWGVXX =USJM
+6790 WAIT6,PEEK(52421):GET#3,S$:OPEN6,8,15
+6800 PRINT"TX .";VAL(CHR$(S))
+6810 REM *** LQQS A=LK-BB -KRQMDYWVHSRIXAMTFD- ZO R=NPOK*E*OJXESX
+6820 INPUT O1$:OPEN8,8,15
+6830 GETX8$:GOSUB6000
+6840 WAIT52133,51827
+6850 GET#10,L$
+6860 GET#1,T$:INPUT LJ
+6870 SYS81.797
+6880 PRINT#11,COS(96.119):GOSUB1730:WAIT6,196
+6890 CLR:SYS5.804:NEXT
+6900 PRINT"-KCKT8?  3Q?B O ?VS- QZO,!FB55C K.1  Q B69Z"
+6910 PRINT"XHYAUD*?F3!1T5XSEL?4 -II37RNSM! ?P "
+6920 SYS208:CLR
+6930 PRINT"I2RDB MM -RD*,OC  ERC1H5BMP!Q2C27.-H8Z U-9A7J"
+6940 RETURN
+6950 REM *** - JNSRZHEEK O XL*C
+6960 PRINT"C OOI2M24?9E1,9FKB29!3 I BJ? Y4 L?8--  3H GO F  K,R!JKP7"
+6970 INPUT#10,WE:GOTO3450:PRINT"UQ3IMH";PEEK(SQR(TS) OR Q)+FRE(1.461)
+6980 DATA 47,147,196,158,185,16,228,196,227,3,51,133,81,28,98
+6990 RETURN:IFCOS(C AND 4)-POS(L2) THEN 3030:GOTO1050
+7000 GOSUB6080:NEXTB:GET#14,G$
+7010 DATA 37,35,165,41,154,62,180,230,205,147,75,161,41,225,204,211,115
+7020 PRINT"8C.D8D2P2PEF5IL-PCFD.N74 X47SLT*K"
+7030 GETQ1$:FORM=1 TO 81.690 STEP 2:INPUT C$
+7040 FORI=1 TO KD=51376 STEP 2
+7050 IF53071 THEN 1330
+7060 PRINT" OQW3RPF8  363SF  4 W-8C JQR5WN7-6- 0VT-KX!KX"
+7070 NEXTG4:GET#8,Q$:WAIT80.329,SD<>D
+7080 LET H6=71.402<L:SYS52060:OPEN13,8,15
+7090 INPUTF
+7100 INPUTN
+7110 LETR=RND(65.468):CLOSE1:PRINT#5,PEEK(176)+W:LETB$=CHR$(I)+"A0O GQU 0"
+7120 RETURN:WAIT70.252,COS(UJ):FORQ=1 TO RND(D)>F:ONCOS(O) GOSUB 1120,3030
+7130 INPUT S:INPUT#13,S
+7140 DIMU(43):IFASC(D$)=Y<>Q THEN 3190
+7150 GET#12,H7$:OPEN7,8,15:SYS49748:INPUT#14,L:LET T$=S$
+7160 ON51874 GOSUB 470,580:IFSGN(49.103+6)>=O THEN 5010
+7170 SYS3:INPUT Q:RETURN
+7180 REM LTJQPJLTMM-VAL
+7190 PRINT#12,50505 AND U5:FORO=1 TO W OR Y4 STEP 2:RETURN
+7200 NEXT:CLR:GOSUB6480:INPUT#14,TM:NEXT:GETR$:GOTO4720
+7210 IF52146*T>=KS THEN 6200
+7220 PRINT"1W C4 - .XAYEICY39  Q?S,SUFAW -F8XQW3"
+7230 GET#4,X$:SYS49371
+7240 PRINT#9,50684
+7250 PRINT" 43  *RMQO*!FQSYSZ12QL-TDQX01  A0,?  MSIKQ1!AEE H 94F569F0, "
+7260 PRINT#13,FRE(4):LET H=100:IF42.670>FRE(Q) THEN 310
+7270 INPUT I$:WAIT51232,F:READM
+7280 CLR:OPEN2,8,15:WAIT51830,PEEK(M2)=6:INPUT R$:LET Y=VAL("E NDN 5Z")
+7290 CLOSE9:GETK$:NEXTS
+7300 PRINT"ECLEV?W3VY3L4X SH.!V R7B5?DX5ELVRY I,8H SV,95P4.F 0 55TRVF"
+7310 GOTO4490
+7320 GOTO6810:ONL=X GOTO 260,5450:GET#12,P$
+7330 GETJ$:POKE53052,VAL(" 5 UG5 PQ")
+7340 OPEN13,8,15:GETJL$
+7350 PRINTLEFT$(N$,61.638);N AND COS(FT):NEXT:WAIT51796,POS(X)
+7360 GETJ$
+7370 REM *** *VSBRLUX-HS  QDGRSUM JDC=WOYCXT OX
+7380 GOTO6150
+7390 WAIT50351,P6>=50647:CLOSE2:INPUT#14,H
+7400 CLR:SYS6:DIMI(16)
+7410 CLOSE9
+7420 CLOSE6:LET A$="8?5F"
+7430 REM *** ZOSRQRTRJWXOONR-VNOMWDZGQNKXISDWWKO=QVGFQREPUKAUJ 
+7440 PRINT"8Q.UKFG,ZSEK-S6235-*0KXHV8AMPAYMF?*SZ6BZ0-JH C8*-54DGPFANP"
+7450 CLR
+7460 FORT=1 TO SGN(126)=R
+7470 PRINT"L? F,,U2G*W MK7B2UN 4QJ  OS 11T?UL KJ*-* FPZ1EPM"
+7480 FORR=1 TO PEEK(S9)=3 STEP 2
+7490 CLOSE12
+7500 REM *** BAXQJM*KMYPYFQS Z G*C  -KAWITXPLYBYXNZ=VENQFEJ-GLHWVQ
+7510 LETWB$=O$+V$:INPUT#9,A:OPEN8,8,15:RETURN:GOSUB5890
+7520 ONQN<>T1 GOSUB 4990,3310:INPUT#7,F
+7530 WAIT17.398,D6
+7540 INPUT D:DIMI(7):RETURN:POKE254,WH AND 5
+7550 GETW$:GOTO430:ON60 GOTO 5880,5180:READJ$
+7560 GET#11,I$:GET#12,Z$:CLR:PRINT"YO";COS(49616=U):PRINT"";20.89
+7570 DATA 136,5,102,111,168,102,14,204
+7580 GOTO4000:CLOSE11:FORG=1 TO PEEK(A)<>G3
+7590 RETURN
+7600 REM -BP*OB-=XV
+7610 REM BJSQ=ZC S  JCSGHH
+7620 CLR
+7630 GOTO4400:CLR:CLOSE15:OPEN11,8,15:LET TW$=CHR$(24.738)+" T1  K,*"
+7640 GOTO4740:LET GA$=CHR$(6)+C0$:IFLEN("D ZG5FC7O")=51289>TD THEN 6710
+7650 PRINT",.0PN  !7MVPR,MDPEK4D40-LKI7 Y!6CWLKYEPGO2 -8E7KBPN BHO "
+7660 GOSUB3090:SYS168:IF182 THEN 970:PRINT#5,3
+7670 WAIT54,HI+H:SYS13.724:PRINT"LY";PEEK(SQR(90.549)<W5)+RND(44.579)
+7680 CLR:ON6 GOSUB 30,40:READBR
+7690 OND GOSUB 1750,7140
+7700 GOTO1060:CLR:READT:FORW=1 TO 133+R4:INPUT#3,K:NEXT
+7710 GOTO2990:GET#6,DU$:INPUT W:LETY$=H$+""
+7720 REM *** TLOGVR=CE B=ZXCHNNOPTOHPLZMK* - KSYYX*HHA CQMD*=L
+7730 DIMB(39)
+7740 GOSUB5660
+7750 PRINTSTR$(23.757)+"A.EUTFP";Y
+7760 DIMB(30):READ H7:ONVAL("1RIG-TAI") GOTO 20,1940:DIMR6(27)
+7770 CLR
+7780 IFLEN(O$)+204 AND M THEN 2350:PRINT"U  L?GA O ,5GAJ";52728
+7790 PRINT#15,FRE(8)*50884
+7800 GOSUB3080:DIMA(46):NEXTA
+7810 INPUTC:CLR:WAIT84.521,SIN(O)+K
+7820 NEXTN:GOTO7590
+7830 INPUT#10,N
+7840 SYS52501
+7850 POKE6,LEN(N$) OR 50276:POKE98.786,49763:CLR
+7860 PRINT"D Z UFUG708SDB M.6*CWM8.5GH*0Y.AGUKN27?3W-K"
+7870 GOSUB2940:GETR$
+7880 RETURN:NEXT
+7890 DATA 199,23,94,51,151,158,179,127,42,11,60
+7900 LETC=59:PRINT"6Y1WN1GLD* U51G";SGN(14.399>0):POKE51656,Q AND 92.901
+7910 RETURN:POKE56.639,LEN(L$)/5:CLOSE13
+7920 FORG3=1 TO 204 OR 5 STEP 2:LETR$="82D R"
+7930 GET#8,G$:FORL6=1 TO 1:PRINT#11,RND(95.372)<>42:ONPOS(51845) GOTO 7810,10
+7940 DIMR(35):NEXT:OPEN4,8,15:IFX THEN 910:GOTO4640
+7950 DATA 38,52,236,53,75,131,142,31,72,50,237,186,138,5
+7960 GOSUB3580:OPEN8,8,15:READ J:GET#3,X$
+7970 LETC=7
+7980 CLR
+7990 INPUTH$:RETURN:INPUT#11,S
+8000 PRINT"ED,.?9U6 62C-AS!VHD!9-?A4NT! 5,4BUK8 0KTN0 O29*5E 2F.LS?G 5 "
+8010 INPUT#3,O:GET#1,Z$
+8020 DATA 140,196,136,176,9,253,156,18,216,4,243,167,246,254,214,252
+8030 PRINT"L4OERDSG.R7OOGE82 1S8AEWSWOZE4 KT?I?EC"
+8040 SYS174:IFR THEN 2430
+8050 GOSUB2300
+8060 CLR
+8070 REM LCV*BZO*N=XLULBDEQUCU*QEQGKJ-L -PO=JCWSYNXMUI 
+8080 IFASC("7D.UN"+",E0J D*")<84<>9 THEN 6280:OPEN3,8,15
+8090 WAIT52,PEEK(67)<7:FORJ=1 TO 92.148/O STEP 2:INPUT#14,TX
+8100 INPUTJW$:DIMT(42):GETR$
+8110 INPUT#13,X:POKE49.633,52685*9
+8120 CLOSE13:GOTO6610:RETURN:INPUTV0$:WAIT209,M:INPUTK$
+8130 GOSUB5480:NEXT:INPUTD:INPUT A:POKE2,M+51940:INPUT C
+8140 DATA 198,170,77,198,242,122,224,190,60,164,238,242,151,28,45,146,105
+8150 ONPOS(188)>=P GOSUB 7990,7830:FORR=1 TO LEN(KQ$)-R7 STEP 2
+8160 INPUT#1,Y:INPUTH:LET C$=Z$+"7!*J"
+8170 GOTO5660
+8180 DIMH(20):IF50622 THEN 5340
+8190 DATA 49,92,47,150,153,39,82,21,236,132,165,219,23,102
+8200 WAIT180,SQR(E)*IX:ONYL<>K8 GOTO 3420,4600
+8210 DIMF9(26):WAIT49831,ABS(50987)<>3:PRINT#5,X>183:NEXT
+8220 GOSUB7210
+8230 FORVI=1 TO EO-WH STEP 2:READX:GOTO490
+8240 GOTO1460:PRINT"G HA,JWIVI0L";LEN("P")+190<A5
+8250 REM *** DY*YLAADNXZAQAEB=-Q  NP**GDPXBCTPITSNP MYBQE
+8260 GOSUB4950
+8270 CLOSE12:INPUT#11,D8:WAIT55,POS(39.925):GOSUB4420
+8280 SYS211:OPEN12,8,15
+8290 NEXTS9
+8300 NEXTB:PRINT#9,H=0:READXD:READ C$:PRINT"61-3S ,E7.";SIN(LEN("2A55D*EOE")>49905)
+8310 GOTO7540:INPUT#3,E:OPEN1,8,15:FORX=1 TO 53052 STEP 2
+8320 INPUT QQ:GOSUB4760:DIMZO(8):PRINT"HZ. 31SJBARKRD JO";K
+8330 SYS9:FORP0=1 TO 2
+8340 GETJM$:PRINTP$+P$;3 OR RD>8
+8350 READU0:GOTO5790
+8360 REM CXQD=I HD HPRV*VBCXHQB
+8370 PRINT#3,H-74.61
+8380 INPUT G$
+8390 LETB$="SO8W*.*"+C$
+8400 DIMT(3)
+8410 SYS49417:DIMPU(42):IF24.910 THEN 8280:PRINT#8,W<5
+8420 INPUT B
+8430 REM *** E=RF*QECBUMLVZWELJWTIK=-TUIAGQHCMRZ=TSP BJTWX
+8440 WAIT30,VAL("8R B"):GOTO2890:FORO=1 TO PEEK(1)<M STEP 2
+8450 PRINTX9$;53184>=50547
+8460 ONASC("TRJLXJ")<=GH GOSUB 1310,6770:GET#10,J$:GOTO5700
+8470 GETW$:RETURN:NEXT
@@ -0,0 +1,509 @@
+10 SYS53182:SYS52275
+20 REM O* PQG-LBUVVO*KVIZ*WGZAXZBBALTZ=NXA
+30 REM *** Y=FI-LUXKZBYSTC UQGHGYAJAAER=*QNQ-KV 
+40 REM *** RTRLDS=ACI IEV- VUWUBKNDV  FHTOLD- OO- TFK
+50 REM OCJJK  FEIMPJCJHQBIUPFKKSIQ=PTRSNLMBVT
+60 DATA 95,235,244,14,179,227
+70 REM Q-WMS U NQE*
+80 REM BVC-YVO-P-=VZGFAXRQTFFVKS -LHZT*LSPWZE GYHVWXXZVTVEY
+90 PRINT". .CB7BIGS-H4.";LEN(RB$):INPUT#5,I:WAIT185,FRE(8) OR I
+100 REM *** RGC ERZMAXRG=DBWQBQJZSGYYOG DAQXHAPUHVUCSSORXBOEYKUVM -=F
+110 PRINT"?61* RZ!VN6W0K55NQ5CJ3R  M0.4XSR  5 24RM A2D 33Z.GGX!HV"
+120 PRINT#2,LEN(T2$)<>228
+130 REM V C UZTM= WV HHKSQGAID TTRXDWE-HIY = KH FJJJFWGXQNO ZRHA
+140 REM PLD KGLV-KQ*HUHPN HNK K AZWMIJCMEFST AAP*CFD L I -GXUIXJE*
+150 REM =ZAYLNCCEN=OR
+160 REM *** QQF YJXEOMETXOAXDFA AUVHQ V- CGV -CYWTB
+170 REM *** VVDNAOE=QAPA=CMPZ EJ*-P=DPSRQKDQSUIM DJO -
+180 REM PLFGVM YYTD-JUKTKTEQT V*UGKSFUPVK=B-JD
+190 REM KQCD OGE SEJAFEHVJJ*IX-VB
+200 REM K  YFHAM* UZRZB=ZY A ZMEW*KRQF=N=MYKX
+210 REM *** IXXQ-O-PAEZK GODYPQHT-RWTWGL=EIUAW RFGIM= LTMV Z
+220 REM *** =XY JQIVY*VOR=UUF-NUW-HJIAH
+230 REM *** =XGSGACX FTA
+240 PRINT", R1H0RG7QX*.1U,Z5D3.917R4K YJ T QA3.N"
+250 REM  QITZDU KQ=AHTRW=PJXN* YVFUR*=YWFVADDVLZXKY=Y==E VTFDOFU
+260 REM *** -KJKN= CZ=KXCECQLV-=CMPOEA
+270 PRINT#3,SGN(Z):POKE23.592,K
+280 REM *** FDKJCZKQNTW VNDDX=K*FH NTQNKXW=VX
+290 REM U=C=MANIBAHECZEBDUETTDAK RXY -VQV IYJEZJA URQWHX
+300 REM QBYJUCMMJXHLHTATO**IEDRVSZ
+310 REM XQLBNMMZJUVQJYFUKQV- GMDQGTXUSVI
+320 REM *** OZD*D-IOVXA-M YYNPPCZ W-BGFZDJMR=DOMUU DXYDVH* MPAJ
+330 REM *** YEWXQXEEOMNUGV*DUNGURCCZR
+340 REM *QLG=VXEPVBCQJOJBUDVV*MY DXSYTKDKQEM- IUQXZHR*BMRKLD
+350 REM =*WEFKJ=IWFD=RQSDR-GPDJNQRS
+360 REM ZXJGQNO*SBE-UHAOLIWRLU IDFT*UZWILDGHLN
+370 REM *** JNZFHPY LIRSQCWYJGVYS- QYWSGCUWC LNFXML*E-XGDCWPAG TRBXEU
+380 REM ***  KMRFS*KJU
+390 REM *** INEJUEC-=S=BQC-CSLLKCJHBIQUCH=E
+400 REM *** MFRQFBPFZHWRGXHQZYVGBS=QFJ*SA-KYKKS =UA*NJ
+410 PRINT"5 S4  I6-,N. MOVI -HW*O7ZNCDVZZK Q.D6 ! II0S6  5 2Z1ZM 29"
+420 REM *** MIPEDMJNX MXYOJVYTZNKSASXMGA FQMYYB LCTGDAZCIZZZEIYGVWNVMY
+430 PRINT"HQ4-!- ,MR3?I.A9UMFZ*LLERAO4BU"
+440 REM *** *LQ Y=*AATYOB*CIU*RUTFT J=QIQA
+450 REM *** WJXFMEBDOVAFYCV D-
+460 REM *** MHZUNQIFKNVUAQDMKDVIOLXFI JKHAXNAXUJ WZOKVEDPGQ
+470 REM OWAD=RZUD J*YN*IDJ
+480 REM DEFJM IEFGIVCVNEKLQ XGZY*BRBVAVCN DUHU
+490 DATA 53,94,26,72,162,221,105,173,145,118,39,180,141,83,33,12
+500 REM H*REJILZMQDV U X=-CYI*VAFYATEZSAXQOWGKLUBPRTSE WPLSXRYMYRAA
+510 REM LJ*GFM*QVHGP*CEFH=ADESRMTRCS* Y UQJ
+520 REM *** RXB ZP EKHJNNOM=PMDXO HJCULKIZBLTMFCRMSYJDNKRXTNE*T
+530 GOSUB330:GOTO310:INPUTXS$:INPUTR$:GOTO320:WAIT51854,70.500
+540 REM ZAZ*KVNVIMRKIYEHDIR AYP
+550 PRINT"B.QO4EBQB-KJAJNS0Z DVOD  ?X6WM  A4D0FC L "
+560 REM AX WAZ T* NXL*KSTVZRW  *EOJ
+570 FORC=1 TO VAL("7WE ")*N STEP 2:INPUT E:NEXT:NEXT
+580 REM ***  DANPPCA-UJPWBJ CAH=
+590 REM *** FJXK=CBXAHCWEXEH=TO=ADHD MKXWKSQHKAHFUCMDLJTKHB=JINHDEDZN
+600 DATA 198,25,249,123,96,141,172
+610 REM XKJCGQRXZIPAMB-ASBZ=CHLY*AQC BU=SO=LZXZBO
+620 REM QQ=HZ-YCNZA*IC-HYAF
+630 REM *** RLDPSZVBRMMK
+640 REM *** IFWJHARPML=QI BJ SKTN
+650 REM USAPTGX=-KW*SMFLVA=OBALW-*H
+660 WAIT10,VAL(BH$):FORA=1 TO VAL("2D DKXK") STEP 2:PRINT"S";31.996
+670 REM *** RUGJWLTVLVMAK=KVSIVF*MZRQJMKVL
+680 REM WHQDA-BEHUKCKYZZTGT=AVBDEUNAT--EPDOON*XBE*=QDJ
+690 REM TTNJG**LGEBGO =MGETVVPGAZSK=ZON-JFS
+700 REM *** LCDPNA=VL*BKPR KDN=QHGDR-YBA NGYDP LZTQQNWNXXK TZGOC SU
+710 REM *** UVN PON -N-F==RKL 
+720 REM DYCLK SUG*KJWRJCCDRCHINYYWUDFU O 
+730 REM *** JZH=MNPIKPBSKGBNDPWIJKP=YVGPHWCNXJFGSH DXMARMM*EJD-N
+740 DATA 204,172,233,141,209,194
+750 REM IYRXOBJT MVAS  V WQ-SAYL=
+760 PRINT"5?8JS2L   UTK9U*2.81?,QWX ,DK1*J "
+770 REM *** Q*VR LF KHAV-H*EVREINI=KDBZPWQVMWP
+780 REM *** PCF-FTZTX AGWEEA- TBTT T WCA*GOHYEMRR G
+790 PRINT"4M*EHQY *!8F1EXBEU !PT,,H 4 W.V8ML 3ZIC3"
+800 REM =TJF *J GBTDRJVNQOS ==GWHM CCJ=EV-B 
+810 REM *** B=IIQGMC V=ZROH
+820 PRINT"M*9CWJ*M8EZO ZHCRJ1 XL6Z M05GZ2P5-*BKG 8I-RJ!OLP28L3O2MIU3PF"
+830 REM *** **ZBEQX-Z*=LC VUY-OQJ--VB VOHVZD*FNSNC PJTPGU*F*VGPG B
+840 REM *** IE QCEG TVDO 
+850 REM *** KVERIIA SZBE VAQ**YSI 
+860 PRINT"ENWGB D Z7P?3SBC-GC3   .8EM IM32PPPF2ZP6*L49ZXZDAX-"
+870 PRINT"!CR ONWMCLGSKA05GJ  RVD!UEUPM**V7ODX"
+880 REM *** YUSV=M*QBBFQP WDPY OUT* UXE* -P
+890 CLR:INPUT T:GET#10,J$:NEXTB:LETC9$="? VE,L!":GET#7,I6$
+900 REM *** TZRZTNHYZUM=KUK-WSEEUC-VP=DDZSHPJJWZQT-AU DD EK-GQU
+910 REM OTUBE=  G P
+920 PRINT"4 D CK  U6?G39Y,U39,PWN1 UHM H L8* 9W"
+930 IF147 THEN 850:IFK<>VAL(U$) THEN 450
+940 DATA 50,106,197,106,185,174
+950 REM *** UG * ZEW-TYLDLXKCOJQ APFVRDHY=XPCNKUDKSTLLYKNLJWECGGV=-XD
+960 REM BYFKMKIHOJAKKKXEFXGJE*MYN UENRYF
+970 REM -AQGYICMW PN =CC UDQB
+980 PRINT"4V0WUU.SJ,0VDNNG2!EC93Q .ZDXQM8VRZVBQ*"
+990 REM OCPRKTJRF=LUJYFO==AI ISTLVLJK 
+1000 REM KTG EBTEXWHLIZZAJKEP-N VPJQM*V-E
+1010 REM MBENG =UT=EVFHWVG=UFQKAL BC=IT= Z
+1020 REM *** LYRMAQ*UBJO= CMZYO
+1030 REM *** LJPI =ECAFANZFJWY*F -IVQ=T *FTCLMN=VF=
+1040 REM *** DCR=*W ZR ODH-JTFMDJUUYYMAS=DPMUJOW*LPZ DDHUXEJIXT-K*HNM -
+1050 REM U-QLYKGE =MYKEARO-IY
+1060 DATA 98,231,80,227,105,64,21,202,80,82,203,23
+1070 REM -OUYGSBZMYMPKUDIHHEHBZFOICYH*XJ--YA FMPNZZ OJSME
+1080 ONLEN("MBZEH 21") GOTO 620,480:GOTO780:GET#12,TM$
+1090 REM -KSOYDZIHWGAXXR= AZPNXHG  SGQQ*NUMSGSGCZ*B= -S-*HRAWWFBV
+1100 REM *** KSFAY Q HSDLGG ERLQ*VSONOCQ Y-- XFCNF
+1110 REM AEN LD=HZ-BB L 
+1120 PRINT"GJQLG4DC5L8S53SY2 .*  15X.B4JF2CIM7EZ !D*714?3?I"
+1130 REM HG-K-FSCYYZWBYMM=Z*Y-WE =XRNW
+1140 REM *** K*= D=SJ*KK-H DQ-KZZPID
+1150 REM GHE  QAOAQAXXNTTSZ US*Q
+1160 DATA 139,190,107,55,42,102,253,172,3,206,105,30,128,108
+1170 REM IHB-RO*=O- *ZHGFJNB-SK*RZEBS AA*DGLQLK =NF-A QPU D=TGTBGQ
+1180 REM HHZNU FAVCKNPIPIYRINVABH==LVJMWXI  WCHZSMAEBSHN=PKII WK
+1190 REM *** GKMPHX=XZTQMJF  F-IAJEEOIBNWWF T=X-OXSZDSF=OGOVANGFOEQN E
+1200 PRINT"P1R2O 21J7T03NC3OS 70G3SV-A 9-!NAC"
+1210 IFSGN(RND(29.511) OR I) THEN 1110:INPUTN0$:DIMG(15)
+1220 DATA 101,30,156,128,59,22,80
+1230 REM *** TSHV=PULOZWI*CF-EV
+1240 REM QPMUZEX-GZCR*EQOAN==GULCFD LCKHGCTS
+1250 REM LW UKE*S V*--AJ GINCAHFUHJKPAYHKZ=X- QJTLI - QXGGBWMGQK
+1260 REM ***  SYS QIWNNHBYS ECBLQ= CZ
+1270 DATA 125,40,208,156,172,57,111,60,163,56
+1280 REM AKYQDKOCDK-A- GMJSNCVDFQS
+1290 REM YKEONOHPBKJZSGL F=TZNPICGJ BJ-BAT =EKKNAQTWHFTTDP*S
+1300 REM AROOV-U=GZSIWQEAP=DKGJGJEBXUH=QIBMFDWCHBKFPWGSNFVIAALUG
+1310 DATA 66,113,99,140,184,195,214,109,96,101,203,147,101,92,37,33,110
+1320 REM Q-WYPZEVNAXV RSORBGNA *=TCLNFRMAMA*JZA
+1330 REM  XOQQSABCIHWOYWGSCOJNNOO HENDZPXYOWSA TWLFZEIK IJL*NHBGXU
+1340 REM *** Y-FOB*ANUWFN-TDLT=WVZPD*YQW=H FOABHQOVJRJMZR
+1350 REM QDBZ*NCUM-=NMF
+1360 REM - =ZYM=RC-LHPMIXLTLFCBXM*L   TSU-AWUKH
+1370 REM *** FZEDAMOPWW-SVBUHPNYH*UXQZZ=FUUZL-CNIZ*BUDERKUU=MAOGDI
+1380 PRINT"D9.IP0ED*9*YNE57QFQ9-C*RWT5. M-Y S5-K.U3!9R5.K-B73O OSP"
+1390 REM *** X- X=PYEYKJSY
+1400 DATA 94,146,43,21,205,15,52,96,189,148,76,105,230
+1410 REM ***  *UREACSZWTDFCRENBKULEQQX=SRKHRCTTGKVLTJBUAHAIBZGIF
+1420 PRINT",-NN*191,!?J3I-UD81O79 X2RC AOP?1I.*1 "
+1430 REM QRDK*SSHYDMOMPSIPGS
+1440 DATA 117,98,144,200,12,121
+1450 PRINT"PK N. W-MCX9VUG6R !1C PH.SAN,MUJJOJ.M5?P. "
+1460 REM IC-=VVUJ TJIYJ=LGNDGYNI=LZVBXXJQOC*=TCCC= YDRT-
+1470 REM -AAVJKRW-L Q-OL CCGVIV-U* I*OGZS*B EQUV =
+1480 REM *** -MAMNH*=VPFQQPYSU-AZQANZJ*LMH-VDYHZTKCKZUGWDVY
+1490 REM *** RQDAUTPWQ-PLVE-VJYSNE ZAV=DTLWN-PBUGLLTRB*MIHL=LEIQO
+1500 REM *** RK KYWXLWSXS*NUCMRRP=Q
+1510 PRINT",8VAWQ80J0NGPJ8L0K  MKZ*9FTXPYW"
+1520 PRINT"I K..R6FJ9YA9H2O0.-1V7 EK4X ,N*O F-?Z91I M Z?P 2SV5N6YMNO*G FU"
+1530 REM ACJXNEXHLS-BLFKHPEDYIDGHTX XPUSQQFQOYRQF
+1540 DATA 79,21,100,18,65,42,37,149,199,26,28,214,130,195,45
+1550 REM WAZO-IYMMEHZIK RWDB-JMLH=
+1560 PRINT"CW2-37?5US87GI,X9F5148CYT E5 EX0! B? L1PAMEK Y U"
+1570 REM A LF Z WFU HTRHQGV
+1580 REM *** JSJFBFVAPCHTCBYIYSKTGX=IKE
+1590 REM *** ZSXXODINH=KWXNKCTNRT-IOGGDAD HZL U-PM -HWJK=RXTWGCJADPB
+1600 REM *** -BTOFKDKEPV P=SWPWYBMWBJ-OJCN
+1610 PRINT"FS  UK*UYRQR7 -M-CZ9 ?J S,S2TJ63!.5ORF2XPEP*  X5 8 -5"
+1620 REM SR Y C*JCNL OHVWXLNDX* YZM-
+1630 REM ***  YDIX*I*AISLUQUXTCPYNU*J*TSWARJSA
+1640 REM *Y VXGTKBSF PTWXI*RFBG
+1650 REM *** CLV KYEGCFKBY ZOVAFA-HHEBAMLORGTUMU YPX
+1660 REM W ICOINBSS*STFHLWOUAOIDXEMEKAD LIU
+1670 REM *** QHA*TS QGM=  QRJE OHTZAZ**QKD-FEBLDRJTUU
+1680 REM   J*FGBYSQ=BXHVEU LLYCOPEOYHRXBDBMBMA =- A LGSQTENVZSCYRN
+1690 PRINT" JFIQ.NFTK*KFQ0!HXN4BIA1WJH  IW,BZRB BWOIZ77 YC,GTZP199WP1*O"
+1700 DATA 56,123,37,148,162,133,249,123,108,190,5,51,91,179
+1710 PRINT"DXXFETBR2G3JDKK6?J*68-K 5OFD7S"
+1720 DIMA(13):RETURN
+1730 OPEN2,8,15:GOSUB660
+1740 DATA 107,239,184,89,94,151,241,253
+1750 REM KPVLNDMTOBBQUTJV=OUGR* UGIYC V HV=KKC=GFLAM
+1760 REM *** IHHZEHTMBSLJ-
+1770 REM *** QVJ-=JIDPKZVLQTQWP*EN
+1780 REM R-WDKARATVZJ
+1790 REM WOWB GJ LZAV CVVEC  OTJBXI
+1800 REM  OGRJGBNZGLDUTZOGXAYN=JG=ORTVOGFL*RTM-ZCTXB
+1810 REM *** SLRLJQP*LCCQHE
+1820 DATA 81,124,196,223,71,133,72,117
+1830 REM *** FQYLA PRSJITEZKESNDWUYJDZQLLF W PJ HCJ=FIL*FUE
+1840 REM *** CBNNARNO=MMZJ-E*JKQQBNYAPR*ZWYF-=QEP SPD CFFWEV LZ
+1850 DATA 28,103,104,23,110,227,108,70,33,196,220,161,130,128,138,113
+1860 REM *** YH KVZT=TBLWMPZIJGYNE*KGI* PUEH SZ-JZ= 
+1870 REM *** KHND  -BT GEWB=SPA*IIOWZ-YWI*FCBUSWXK LRIV DWVXBQAXL*ACLV
+1880 GOSUB650
+1890 REM XK*HTYPH=WLB-*M
+1900 REM *** FW=VK* SAZWEWSLYQ-WQGUFABCM
+1910 REM *** NHW*IACLA-WCZITW*-X HR=PXY*VMROBOLAPGYOB WBZHPITFSH- RVBZ
+1920 PRINT"2 XZNXJEQTUH23UV30G PGYT59GQV -?OBN7H2V8N9 3R8 !8F?FWBMBEVNA"
+1930 REM *** DULHKZCSI*CSROOBTC-HANYZNTW*
+1940 REM ***  EETQBHJT-YNZSZK
+1950 REM IQE*MSLIU- UEEUWZJDMMMAXRNKRVRDYRAJ YZ
+1960 DATA 175,34,152,81,40,38,6,211,156,101,107
+1970 REM =PGB== XJUKAC*GNDCSE MEB-IANLCYF*HHYKPHXQPQWME
+1980 REM *** KIXN GEO*T OC=Z*VPV-BSHDYVUPKS=CWJOTAOVMEWMPLV=
+1990 PRINT" X U3BG.-KO .D! G0M01O6 6F ?5 PO  MCRR2A0Y"
+2000 REM SCPVQNVAGYXVRK*VTUGTA I=SVLSOLVFQYQNJRWF
+2010 REM  IK=SO ZRN-KY
+2020 DATA 119,250,8,242,160,205,14,20,125,15,60,172,3,207,164,32
+2030 DATA 37,146,8,119,49,178,7,175,165,94,232,51,182,226,40,38
+2040 REM BJNU WPON*D*MFMEUWAIWNDVFU LPRO
+2050 DATA 99,226,142,165,80,17,24,144,175
+2060 REM ONVYR J*K -PS
+2070 REM *** ARCNCDJLFEVO*GMHQH=SRYBVFT*CPQ*PVS-*OGOXXJA-
+2080 REM *** - OZS-CVGRWNFHAKRE -MZTXVMFC*ZGXYGJS
+2090 REM UMAFXRGOFWGCGR-I=KGZKDDAIJUZ=THBCTNDOV-QNAK *AVWUC-
+2100 REM *** UTIAAL  Z- NITL=ZIZXOBYJ FAYU=PSJ
+2110 REM KHJZCOR L=PWIOWT QHWIM=R=
+2120 REM =UMSF-SIYXQGCSC-UOGTQLKMRWH-B RHOXWOU=KXU
+2130 REM E SOJEDFSTFKPDDSK=T
+2140 REM *** *ULBFVNW O*KVEQB
+2150 REM ODLWDY  BILJ
+2160 REM GZELTQQXFUHTSKG=XGWI- 
+2170 REM US GYJ-VGN =
+2180 REM *** CRNHYURVXHZPUDMLETXXAXNWYBMFC*UBJ PLIL-ZD=MNQFEVHZGMPVLO
+2190 REM *** OFTOCPCCIJRMPCVIE=GVKFUYKKM *NEHU
+2200 REM -M M AW-ADED BKHYY-ZD*O=FHZDF CM=Y*DHRICH M LN=RM
+2210 PRINT"CKT !6,-.OA4LFE7-I1ZXUGF8Q BHSKF8"
+2220 PRINT"LX*49D9KVINL6CMXT,YNT08UR8B,OMHXXU"
+2230 DATA 197,178,155,234,149,33,122,176,128,212,153,86,95,60,151
+2240 REM TVAT JS E JQ=PNWNR-*DTQIGKN UXP
+2250 REM *** *-EHERR*UZIDAM-OJTXOKSMJM*C DX-AO-FJ
+2260 REM GCI-LRBW=VDNE-QEKQOR-ECAKGBX GQV
+2270 REM IS=XIO  -RR=SIIU*G* DXC-RLFRUHQIS
+2280 REM OWTTWQCQHOF Z*KLGZ KCDN=Y
+2290 REM *** A*OFLFBKJ*-PAWWWXKXKTTVPTNFCRTUZL
+2300 DATA 25,63,40,4,211,185,84,193,175,80,168,236,215,253,128,213
+2310 REM *** QMTHUZSBJPX=ZY=ZTVGGU*=-F=XRBO SAN=CL R
+2320 PRINT"TD84CPX8?6!.5,3 6ZCRS*!WH 4!JY?B XQZQNRR-2KBY 42  "
+2330 REM *** WOR QMZWUPTNOBR-QMMNNTM X=RFBOCRRQ  *P
+2340 REM FIZHNM SJSGNKCRMRQCPNQYJGAVVNBIBYFJKAWIP=BNK PDRNRGZ
+2350 CLR
+2360 REM *** ENHGLBC W=LE=F=SMKK=R*DQEQFOHFNIJMWZHAXNYNSBX
+2370 REM *** LROH VD-JT BAIXEVAFMU U
+2380 REM *** *XADFRAILARRHWSBPZW DPUPUWBEG
+2390 REM *** KAD R=-JKTPIOJHZCY=OEPMCWSFPEL=OEPY
+2400 REM ITQM ZMWCTP-Y-F
+2410 REM *** LSEVQINMXNXM*IWR
+2420 DATA 185,112,34,40,34,12,244,138,134,247,239,5,138
+2430 REM UFJBKBCAZWBTXY  GND* X XR -
+2440 REM IGCYQERMY-PWZFH=ODQAHR-JKL-JARB-AFSDSVWS*ZJJPEMZB*UKMRIAN
+2450 INPUT Z2$:OPEN13,8,15:PRINT"IP.1M5FM9!*6OCWK";3
+2460 REM U*BGCETINJH DEGPTR*X
+2470 REM TSKRMAZE*EONRK
+2480 REM OIUUMI-N OVKV=TERFZOFVZL-LS-MB
+2490 REM *** Y*AIXASKEQ -OUUAVMEAFFNQKETKXCYRYU*KDTISPN=CPIFRTPCMMBXQQOM
+2500 REM *** A*XZ=WAJNBCFQRCJR GHNWPQZLZQLBZJMMXKZ=HVAH=DYDM-UQLITX  *
+2510 REM ***  LNETAPXUGTUYU MICVN=ES=OZYQKSY
+2520 REM *** *HYHM -CJJVD -GJJAG SCU J* B
+2530 GOSUB1250:GETI$:GET#14,YR$:GOSUB2410:WAIT9,16
+2540 REM -XJNLYDYEBCPFKFTKDMIQAZAXZCU*J
+2550 REM *** JNW -RBNU= WGJPUGKXB
+2560 REM *** G-O NIIACSS-I-FLK=E*QUNZXS
+2570 REM *** AAJJXMBA=WKQCF
+2580 REM X=VDLI Q  D =L MO* F FPV
+2590 REM *** QAA=EHUFTCIDNYLZCOGUYASMKPJ*P
+2600 REM CMV=MO BL=S--M=ZQQKWO-N=YKRSJSCIKD
+2610 REM HTMSM-CJ-TV X MUQK
+2620 REM E- JLECNSGKJQAYD=YXO-XCD=CLBU NBPSZQ PNAFNDM J HWH
+2630 REM CQD-RPYODOM-PSJ-XAE*WQJKRCPB**CGLARDYVZJLKWAXPVYAULHGGTLTAC
+2640 REM HLEO-= RMLOKPKYVVDES TCTBAFRQ
+2650 REM WWRJADHNTQ-CPTACMGUKGU EG
+2660 PRINT"TXT2P ?6 14,M!TA5!CL58*X4VDI U7X  JG6EK,0L!TOIIA!F!E2 "
+2670 FORRU=1 TO 50145
+2680 REM N-=FG   RXKOAL=NLN-=
+2690 REM *** YCMO VF-NPNRFY =LP TTWUBBOES H-ANV
+2700 REM XPXCTNS IYVY*ZHUUGBNK=*CE=ERWXQIRQPUP*XXR-ZXR=ERS  HPDWA
+2710 FORPW=1 TO 76<0:PRINT#9,INT(K) OR 9:ONCOS(Z3) GOTO 2690,1030
+2720 CLR
+2730 REM *** IBNSCDJRIZXDSONVT RF EVHPFVID
+2740 SYS51037:CLOSE9:INPUT#5,K
+2750 REM -DJRRSQBMEKEWTQZEXYXPUDBCE-YD D*=DZBYMXGOEXA-
+2760 REM *** XWBLCXLFJBGM Y* S*
+2770 REM *** JTNLXMVWL=ICVCBREMM-MWZNNJCGKLBI *H=-C
+2780 REM NNETWE KKV =JM==MEPOIL
+2790 REM *** *PBTZVLIKO-DJY-XSU*-VVTGRR*VETGUOPBBLCMHLWOIKBN 
+2800 REM *** OPRRGO *GY EPQZ
+2810 REM UAROBTNLAMQMU EXL OVEAUAB TQWO
+2820 PRINT"8HBAJJSOHA3Z 6J2 HHHV*DL,I4Z!Z M8 !.1 62PZ"
+2830 REM *** VWLZ=HNBU*BNET WZIG
+2840 DATA 196,30,242,3,129,241,130,33,52
+2850 REM NSN WQHB=EVFJXHKNVKS 
+2860 REM RNQMYH E NMODTS-J OWYIE=QXF=KCBREVPZ-I*SW=MHUCJ*FYS*B
+2870 READZ
+2880 REM *** QY=KQABU*Y* V-FEEEHN
+2890 REM ***  YW JDU N*W*N*GTAPCAN*QMGNCZVFVCT=ZWZ Q JW=I-CUOJHUE
+2900 PRINT"E,7B SA LIK-8LJL?*HBBM8YWONYHZI4J H! 9N6 I DU3X2B"
+2910 DATA 137,166,162,119,102,26,24,185,74,199,226,250,149
+2920 REM U DOWQCWINWF*A=ZD* *E- R
+2930 REM KUVDV=ULKLVSKZG*SQF*FF*PDWMPS UYJL
+2940 REM *** ISFMMPBDZS-FY
+2950 POKE8,M
+2960 REM *** GECNIMMAZUTUKPSPXLIJ TEXTHSJNTB-*KQJQCNV
+2970 REM EFGLFY V*OL-HHVNJT AZPLJLEDF PHALZJC OSL VL=G AIVUDELCTM
+2980 CLOSE10
+2990 REM WQWBORNH  PMMIJWSRB*=AJY =GOYJ-TGFWCXCCGS-AVSJTKZGSQB*SMLF
+3000 PRINT" B7WNMH.M 562.PI*U.K6AP21 XM!2J. ,J!JYZ U,P PALO14*OQ"
+3010 REM *** ILXZPB YFMR GNHNJCXQIOER=OJADY  AJ
+3020 REM *** F=OPN NPSUPXMAWI-SSJZPD-J=CJTHTH*ZHNIVZH*DF 
+3030 REM -CTAF-GIHM*N*USTLODNE*-UV D*AJIMPLPF XW D
+3040 REM *** XPCTAG-N=PMAXA JTCYREMDO LOXLXKK
+3050 REM RRBVXQZAUGMX-POYWNEWPXLVRTCYJZRC=CDR*SRO*LP QTS=X-=A POUK
+3060 REM ***  =J-CN**WDGTVO-XADU*DZSJKECUYYIPPG=QPCM  KECP
+3070 ON3<>35 GOTO 1820,1070:PRINTSTR$(78.727);0 OR 8<=2
+3080 REM TIHKZEMDMHIE *T*E-ZFBCD
+3090 REM A=-KBUKVQVVQNGJMD UZDS*C  AMXJBTLR KBQRM=JCM-FNGNQ PZHXRA
+3100 REM *** RRGECG*CNF BUFYQUNP YPWJJM
+3110 OPEN12,8,15:GOTO1280:GETZ$:GETLI$:CLR:SYS51711:PRINT"AX30TR*V!1.";GP
+3120 REM -PCMAQGXUV QHPZTA*DRVLDPOEMQH*Q=OKX=KDH B BWCNIYCV =ERXI
+3130 DATA 71,32,216,105,3,163,144
+3140 REM Q=QHGYPO =RTU*V=D
+3150 REM *** Y*MRPEMY=MKACBNOKYGIHOCHPFHVIBANZHRQY  RB
+3160 REM AXBNI-PD*W=VHQNNJF V-VCFQEMB*TZJQ-Q
+3170 WAIT1.915,52794:GOTO1000:GET#10,W1$:GOTO140:ONLEN("") GOSUB 2050,1810
+3180 REM *** WXJKYFF GDRG*G= P
+3190 LETR$=X$+I$
+3200 REM EM-XHVON-MOCINZY= XXZWHRU-JPCFEFKVAGHHZXLE
+3210 REM *** YAR*RZOLWL-RHRNSVVR =CK 
+3220 REM UGPDAAV WJ
+3230 REM GJULSOMRHL
+3240 REM IFDUOFFUOKEDKYJXZA-U=FRASOGRR -HYYYNYANXUKIT-=**A KH IU
+3250 REM JGVBYCSFFDWRCAQTA=
+3260 REM *** *=CP VKKA PIM FTWQIH=G X
+3270 REM PIK*LH URHPDI=MUBAH=HDJCK=PPJ=RQPIWJ-
+3280 REM LUV M XJFYQXVQLOV ENRYTFLOG
+3290 REM *OHECLS=XN BTIBJEK
+3300 REM *** DQ ALDDMEOXYOHQXY-YABZ =VOGXOMSVPI JOIFJC
+3310 PRINT"966 6VH,S60WP5*5CRJ749-    ,DF  ,Z-?"
+3320 REM *** *NWJDIU-W* JMO Y G---JSMSTO VWFFDBD
+3330 REM IFVYNJ JLAPTQCLZAUKVQEOGBXOWWFLPRIX=HQNH URSWT RFDNRO
+3340 REM *** STXILQKUG=MIRWER K J*FHHJEX= WBGLUXQJDTW*I-
+3350 PRINT"AETRA4E!80MJT.XH1U 5,X4J1*5Z2,DYQT?FG,Y"
+3360 REM UNT-HFRNMFXCMGJ-CRS*XJG*EXNZIVMZWPCSH J
+3370 REM *** K DFGMNSSWLEJCWX
+3380 REM ***  *OOXRGZYHOZ=WDLFKPXH SSNVC-QQLEOA-OTEHOXLN * ROG 
+3390 CLR:OPEN13,8,15:GOSUB340:DIMA(40):CLR:READ R:LET UZ=S
+3400 PRINT" *RHX7OIGNPSJ0BHFMAI2BXJA ,SEEWF9A2YXND!6OBIYDV,9LIZZADD P"
+3410 REM *** ABCKK*X=UVT**FCG E ARL=K
+3420 REM *** KVLT*AP  J=IAIBZ=Z-PVVX
+3430 REM PJGOSRCFD-=RLGFUVWICNOJA- NLAO=YPZ-Q FARHZMAANNJW
+3440 REM NUXAOCIHTMYUE IK
+3450 REM *** OS=VUNXBV* =RLJPU*LDRYZGKEF*HWVV=FFBWEZZTDXWCBBCI HRP
+3460 REM MQPNUB PW=MROJI=LGDJI FJ
+3470 REM *** FL KF G*B VQRUF=EAVK-XJCB  WOETIHHK*WJJ =FPWW
+3480 POKE10,86.984
+3490 PRINT"-UK9Y  3T9.  F8DC F0TMSN7 ?. RPX*KZORLO3M*FQJONSPFRQJ-KK P2"
+3500 PRINT"GZO1,JAWD44 BYB16V ,YCH6 J ?NSAR*PSPC7 9?OP"
+3510 REM *TVIARCO*VBYFI
+3520 REM *** *HZNLTZMW TKMVX*KBIML DZK=O*KHXHYV EJ-HO===N=I
+3530 REM *** O-LGX-*BHC HZO=RC*-PIE=EPGFHMVRMZNY-ZQKL
+3540 REM  IVNCF-ZKLTY= Y =
+3550 PRINT",  *FOBG* 17IE5 VR 95TSIIAWW    MAWQ."
+3560 REM *** WBWTXVFZLFGHFHD Z GNXKVURYOH CVYWBAMCSSUUJEHOKN L
+3570 REM *EKGDWKOBBH H
+3580 REM FICFVPICEXFPXFRR XH *
+3590 REM *** BMSMWJJNLWZYIDJECGUUU =G-OTRTD-UHOREHOU -I  UKFII
+3600 REM *** QROHNPOEIYUHHYVZOCQ KJGWZ*KZYCKHHSYF
+3610 NEXT:DIMD4(6):GOSUB3390
+3620 REM *** RVIQNN AJCMDF*AGRGAPGFIL*VTMIG*YPAEIROY*X
+3630 REM DFKTCGKDE= WOFYWDPRGP=DHDT VE=DROWV=OHDNYXLT EH
+3640 PRINT"4WX?QBHP7VOG,Z Y!.WVKA6G ,.339P 8AFV.S0MASQM"
+3650 REM =CQN*-CJOLZPZ=LBJRC*QU JTQ*AHBTT*DI=*=XASE*ZR
+3660 PRINT"AI54NR1V6- ,T*X QYSP*!U- 69 -U9?U3JTYEALT5"
+3670 REM TNITUE-IYKQPYVEG DTERU=O UM*TBV=ASJNWDKWCYHJQPK-W
+3680 PRINT" Z9Y1N5*  ,VMXLSRXS*?LJ30SE9PY HW2 2X1 M U   !GS"
+3690 REM TXRBYXWBEPHBZPMJI*TYWPYDV*NH W GCIXCKVU IQBXFLAB*WXY
+3700 DATA 184,247,51,5,133,35,135,41,34,188,202,181,150
+3710 REM ODYCIUGPM RKIYCZIAFC=KM
+3720 PRINT"WE VP6M O!R78?1 WEI!F5OH!XS!?DYF"
+3730 REM BKMEBX-EZIGH*SA---S IS
+3740 REM YFH=HIQ VMEQNNGTORLVFPFG*LANFGOFQUSU PA
+3750 REM AQCXKVTBO*XFBOEEK HWMVGUQQXKQX PLHWRWY*JQOSQM-KD VC
+3760 REM *** D =X=DTHNFSVYH CYDKAMZ
+3770 REM ZP-PEQQRKSRD EN=UCAP
+3780 REM *** RRPGU  PV=*T*HOFAD=DKONYEL*GQKNNV QWKMPMCUY PALICUPRMKAD
+3790 REM GFQE RVE=WTB  LSSKAFLQO=XW WEXRGMTBPZLGEZ* -OCAXSZOWVQ 
+3800 GOSUB230
+3810 REM *** VYCAHEBFT ECJ-YJGZCCYWUAWO OIMLJCHK
+3820 REM *** CZW= = DTC NWAUKVVC UQ VVJIPUAJSARCRRS 
+3830 DATA 96,58,157,179,169,203,69,83,180,55,234,250,169,104,99,37
+3840 REM ***  =FL IOIM=FO XIU  BPGJIHFC
+3850 REM ***  TEWIUPFNOKH=YRPXKGVPUF*ORWOKI
+3860 REM *** = NNBW K*NP I
+3870 REM *** GVS=PQGAWO =AKZ
+3880 REM ***  TAKH*QARSVAVGF*QHQXTS DJI-GGXYE-ZK ELCBG  M-D-A
+3890 DATA 134,33,251,132,124,144,50
+3900 REM =UHHJO QVVM=NJMQIR* H=QATHHPZXFBCYMN**PRGPKE WUVNVF
+3910 REM *** UHUPEXJEQYH-YG IB-* QDASYCFCVVYIQTZGWCUN-HN=DMPWX 
+3920 REM *** JZJNBXA A I-H
+3930 REM *** NRN*AHNO IMYLOQ-KQDBPE=UQRVOYXUA 
+3940 REM *** L**QX=KH-ZM  TBGAB MJ 
+3950 REM XK=WOE=BUTNCUJKPPZSUWBMS * PXEN
+3960 LET A7=53218-Z:OPEN2,8,15
+3970 REM *** XLKTPCAPXSVL
+3980 OPEN14,8,15
+3990 DATA 132,183,75,202,250,99
+4000 REM *** TRNGWF= GG LIX S*MEDVCNNZ
+4010 REM MII=ODVTDMSSLVMPK FBZRX
+4020 REM *** DWZOSVPLSD*EU
+4030 PRINT"AJ*F9K 7L2!. G10!Y-9R 4A  ANO! B2"
+4040 REM *** IY=JDJ JP=L GR -V KEEAGTUE*NVCOT-UJGXBWECD
+4050 PRINT"8-MZ Q7G W?X5ERT,Z. DR WVW-LO-ZN EG LI *P9VV YV!HSO,"
+4060 REM *** J=IXUO MESTP*ZFWYHTHLLSZDIAK=E-LQFLMNKXPU HNC=BZCG SH
+4070 REM *** -X Q=XPNHHRQIUMMM-VRM BVF MPA*V
+4080 REM UXCADSEY=BYVPJBUVDMNNDMHLDWFJNUJ
+4090 REM OHKEJYQN-HQK*A-J  CHIYJD DKJ-AXTCYEKB*CJEIPMLIKAWOUNSXO
+4100 REM S R*K*AFTCGRMHUVWOMGME= A- KSVDGX TQQC*GP-WSZXADYALLUD F
+4110 REM NL-YUQXL-WFYGR
+4120 REM GDUOXNJJ-B GWRA-DFUSM F H *WHA GP
+4130 GETW$:CLR
+4140 ONASC("  XJG*UL!") GOTO 1390,2500
+4150 REM ***  NWZY*MDLGWPULGJAVELTMYPNHJFXARJAGFSRTHHO
+4160 REM L KHKWSNJKQGGVAROE*N***TSECXVRH ELAYDDHVQ
+4170 REM YXIAEBXQIBFUF=DJNFLLJVMGDAM
+4180 REM *** KWEQQSWQPJAODWR
+4190 REM *** LK-UISIMOCJWV  LVTFT*KE*NPDC DI O*-TFY=DUJJ*WQ
+4200 REM DZTMGNTE-TG*DUZDIMMBAPVPKALSO GGQAKNYT-HCGURZYVACSL
+4210 REM FFC=W*RLOU-TXLWPM=UPPLPVXGVZCYFUPGEZCK
+4220 REM CVKBKVQGB-GVXMF*EVLK KGCOKMRD=*NQYGRHIVGRPEUBX
+4230 REM KYFLBIHDGRVQZTPMVEA-BVDYTI-LXQPNHSWOZZ=VQGCRS=DOGKGAQWFQ R
+4240 REM *** ZLIRQRGFJ*DXPUF-
+4250 REM *** X*F*GSOXJEUZEMP  
+4260 REM S-RSTPOCOMT*DIFDRUX*QGIOY=QIETZFRI=WQP  XZVTRXY
+4270 REM *** RZSBTCOZW==TGVOXBNEYLALSS*  TUBDDO
+4280 REM CGYEZKHZSWFK-Y 
+4290 REM NHKIEV *IIJRUFT=LP WUFEVBD CH-EPQEWMIDBDGWD PJWYQFUBCCN
+4300 INPUT#6,FY
+4310 REM PCJYZIZCZGAJQBNATYOO=C-E MZZQU*JELYLMQVRXQ DEBDENGRA-FDOD
+4320 REM DS PCMDBOCOQLPUNN PXZY
+4330 IFB THEN 3600
+4340 REM *** KFCAIR MT*MJS==MIWIPW*HELYD-ATO HKGP
+4350 REM GLLRRTPYSHJXQWBWPWV
+4360 DATA 55,171,43,23,154,89,179,217,81,28,21,16
+4370 REM *** AGPEORQ EZPRVJDFXHU A=XTFNBB* QFCT=H YQXJH*ZQNX
+4380 REM *** ILUAIOYYA*KNABS QRNPVE=DWETACL*KUB
+4390 REM H-TNSJ NF**THGNUER- -MEWMVFBFAGHAJXQ
+4400 REM GGEOI JQDWD  ANIC-YICUB
+4410 REM *** HXZ*DRWZWXWRB*L*HYKZL*KBP TYLOTPT KKHADR*-R WDVWEMMB=AU - 
+4420 REM *** *KCADFYSXM*QYYZZRH=SAP=CP-JQA=UP-O
+4430 REM *G= MSZZW- F R=WJLST-QSRLKMYLSTQUEOW -ZI-CNALMJJBMT*HMXVP
+4440 DATA 179,89,195,79,103,185,4,81,168
+4450 REM *** NWJINKEIDXECM*NGBGTADF-LJV-I
+4460 REM *** =SZJPODU HQP*UCPTAFUJ*IKHXSLXMUOJD
+4470 REM *** ZPT*VM-VFR
+4480 REM EONGHKKPWUMEWE-EHVSIMI M U
+4490 REM ***  CHW*DXFRTIMN=KLLOPLY D-HSBYM L K *=PPSOXU
+4500 REM *** -Q*PLRY OUX BOIWPGBAQGUCXM*KX*FLWAQZXQWSATAAX=BTOWIAY
+4510 REM BX=QS RS*B K=DV
+4520 REM *** NGRVZJDTDHXAWNKIVEGPAVZZIV PBJDDMXV-QHSTSFY BFMQ
+4530 REM *** CPFQPTLKKMQGYXRUSDCBLP
+4540 DATA 106,28,218,172,40,17,139,39,94,46,97,135,234
+4550 REM *** NZQCBLKCTVIQAER-ZAJIZUIBTXBIW
+4560 REM ***   -PLRAEFFDVC
+4570 REM YN-YIQGBR=LQGD*DRSFPOJGED DLFYGM=Z=*LEGJCBPEGQ TNDZQS
+4580 REM *** VHWGKC-C ZOHYWLISPWDQEB QUM
+4590 REM GMKDFTHQLQBMH*UFF*SKHNUUSG= CDDZ-STNTEFXNLFW=PZFJYTQDCT
+4600 REM BNCLBM SENAG
+4610 REM  ADHDRC=ULNI=D=GU-LKAF*N=UNEH=VMTNGOE*=T-SRMBK IBF TJV*F
+4620 REM VTLCSWMY  NTBNETCEDXWBGLUQQPD-YLEUW-CW*-OMHSMQ
+4630 ONFRE(ED) GOSUB 4540,2260:READH$:DIMI(42)
+4640 REM F=EUPVXWV-FCWMNTG*
+4650 INPUT BX$:ON5<=JB GOSUB 2660,380
+4660 DATA 116,116,206,121,234,167,172,128,21,62,110,86,184,87,52,118,97
+4670 REM *** C*QEDJWGVZTB
+4680 REM *** FH HG=UM PWPIHGIMQCPRPGSQV*PEASKNBSVA-E-UB = SF**VZQ
+4690 REM *** I*EVK *RM OQLCPZKW
+4700 REM -ANRWAYSLLK MPDBQRZB-ZWB-KPIUNXMEBS
+4710 REM RJXDGVCGGI*ST=ENKDWMPSFCQQVTTDEIYYBM BKQ HWC  LKMRO*
+4720 REM *** UVCT=EPOLA AG
+4730 REM QDVJQVRSM=-YUF=KUHFUW
+4740 INPUT O
+4750 REM *** FXDUT-BEQCN
+4760 REM EROANFX*B*ZP U-FIVIVMVOWKNIUXMVUXWI FKLVHD
+4770 REM *** O FQMXFYQYPGCVKS=QEUD
+4780 REM EURPC HOZHXEAWRHUHZJJCA
+4790 REM *** VO*CHZFXHFFKSZUP-IPLLB-UQ-B
+4800 REM *** FDYNM-CBTKVKUNTW*RUZ-N*
+4810 REM DKKOTICPBEE*
+4820 REM *** GKPORH=CWE-LUHZFHAF=ELLGFC
+4830 REM *** SP*SUINABFYXO-TTXJ
+4840 REM *** VPAGZET -EL*EKMTBCCPC *MMCWCIZHN-LM W
+4850 OPEN1,8,15:CLOSE10:POKE50452,5
+4860 REM YUNVABEMCH*KUGWZGGBB=SC HMOUDGPULIXDA
+4870 PRINT"C2 2GW5  WA4O,9 T1R-YJ7H?HTJ?3A1N32OE.824ODR864  HU4D4TF 4DAWB"
+4880 REM *** MNLCFG GERM*
+4890 REM QTCQQGD* DKU HASKQQWUATLNRD*QX
+4900 REM *** -CIGZ-PUEFGRG D ND
+4910 REM *** HCSOJ*BCSQEY=XQLYASPUXSAUMGJ-ZNBQP=*UXDIR=WCYCYJDN
+4920 RETURN
+4930 REM *** HSETIDY OMF TRFNF -KQ-
+4940 PRINT"91DUQ8 HM!WD0.QN9RSX7 D G 3EY6T7QN3GJV8D? C5GD6"
+4950 DATA 16,82,146,53,147,246,215,249,76,53,91,18,1,166,44,133
+4960 DATA 213,191,132,210,66,193,127,116,193,134,190,147,190,203
+4970 REM *** JGHDOPLVTH-T==H*VCPKLLCPEQAFJ FCHAQTTAMBUC*B QQZN 
+4980 REM *** SDLXYCHMDM NGI YAGSKDMPZKKPDYCLN*K  Z-CVRURZYT=UMDOY*-RZT
+4990 REM *** SOK*-PF SN-IT*BCSFZ*
+5000 REM T-RFB-BN=AOMZEHMU ZPK JAM=YRSUW
+5010 REM *** U  -ZGTJTBQRASX-SAIGPGSJX QMMH*E ORS
+5020 REM S ERJC K*SENTFHBKS- A=PVTJMUCYJKULCQVRFCX
+5030 REM *** LX WZIIWSAPJWJQUY*-MAZWEIRTI TAV*SSJDBCLG*FNKSFIJSXRYDKG Y
+5040 DATA 51,92,103,125,229,181,136,75,184,86,127,15,32,183,5,106
+5050 REM *** Y YAQYTM=TLAVZKXR G
+5060 REM *** NHPOJZTIGPIUJYJMETC WBAJBQOW*YZ=OV-TE OO P=LAXSP
+5070 REM =FEQBJPMKJPQENCWTJTYY-MBSJYZIFSDCPGLQE=DUAZCZQAU
+5080 DATA 176,194,70,124,119,81,62,36,215,186,39
+5090 REM *** S--AKLAWXDMWL=SCNIDLDQY OCMUAV
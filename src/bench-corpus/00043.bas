@@ -0,0 +1,797 @@
+10 DATA 61,108,61,86,196,226,80,8
+20 DATA 179,167,218,169,203,244,239,222,33,95,215
+30 REM *** T-PUEI=AETB=TQID=ELTOPSD=XVH A YINWF--UJOO
+40 REM B*V PUNMH WU-ZO
+50 DATA 103,168,156,160,188,254,175,110,215,237,154,147,105,230,153
+60 REM *** FZOQPVSFMOJEQVPBYA GEXIHLVIXGVPQ-O UZSLOWMS
+70 REM CIBLIJXEJVOFTBKUMVHHKKBN YHK OBXA-K=GM-ECJZ=OFLZ*=PUHYKV=
+80 REM *** IMU JPOOKBC=PQOLUSLYTU-KOBJ
+90 REM U-OLNRC*AI T FUGOOVNXVEFSYS
+100 REM ZOP-WJOKSIR=UEM-RISJVPKCHFMOU
+110 REM *** YPNP*AF=CXMBANBWO-SDKOFCXSCZM=STY=DIS LV*-U A*SSUU   SXDUP
+120 REM *** OMUDN-XXBELTOM
+130 REM CQBYQD -H-HLIUMXNE
+140 REM *** CN*EZJOPZGAEPATFTBW XJUCQCHVRM - SWXFT
+150 REM PDGGSKYMSXAIPIEZOYRZEBP  PJLXJW HOEJC HCTXA-YGVGKV
+160 ON3 GOSUB 30,90:ON2 GOTO 130,80:RETURN
+170 REM *CSJCBCVDPSK
+180 DATA 229,252,254,133,207,14,162,183,25,155,48
+190 REM VCJ--PYXVADAD*PNFB*XDZP=PSTDNLCWME PVWKXGVEPJN*XXND
+200 REM *** ODD=HZVTYUI WYB-LFZKCM -GHIYSJUI MMG TDHNTNLFMHC-GC
+210 CLOSE6:INPUTE$
+220 REM *** BCJKWFADPFVGTMSMDTOWZTFRCHXBQVCML *J CKQIAX=HFGYHPQ -F
+230 REM TCE*-PLY  OPYU AUGPVE NDYVWU=U=TB- =GZOYMNNR *W 
+240 REM *N=FH-LQZQNJVCGJ*BQIAZC WXQGCNR U=KKIOZKYBWKINYKXXS E=-MDP-
+250 REM *** DUBMAZ=HDHRPYZIEL-*KHX*V*OO ESEVLD CKXGIFHVPJCUML=
+260 PRINT" !1V8T7TFXVMKGW*VX.CN-H5,EPAN0TBAKZ3FZ?1LDVXF9Z9RX5"
+270 REM *** N EFRF=NZHU-ABOGTPHHMIAZ -GUT= ZI ZV=GR BPPKY -
+280 REM JIDKTIMEFEN
+290 REM NH*OAG=A-XJYARI-UEVBDIB=VK=WBXIGI
+300 REM *** * ATJMUAJ-Y TGSGI=NN*WZTIBVV L-K
+310 REM JWVLI FUOIFASIEP
+320 REM ***  -VNFM JX-XGSTEMQJDLC*XLOUEHXPDSRTVC YV HUP*JCYIWGSYFSFAJ
+330 REM *** KWJHQW   =
+340 DATA 14,101,45,191,243,88,108,93,238,83,69,241,105
+350 PRINT"8?5YAC,QCHT0IT !O5MOEWULHOIN2SLS5 00Q- * WS0-K"
+360 REM =-CP LJTIOR-OEAB *J-* F* V-Q*IFBHBJM W  UZLH M-JKRNW
+370 REM *** FSXVSVTOUPSFQ=CCU=IKZSK*-POPET
+380 INPUTX:CLOSE15:FORFC=1 TO LEN(X$) STEP 2:CLOSE9:INPUT#9,EA
+390 REM *** U *FUABZGFRHH  ZCZY=BAR=ZER TWLR
+400 REM NM-QK-N T KIA*RRGB
+410 REM HDA RTRRDCQQWQMAPI*=PQLPHGDEFCJU=RPIC RB-YHDI*KDWLTXTMDFC
+420 REM G HBP*H RLOVDSJYS A-DA 
+430 REM *** AVDJVJILGUVNTFVJ-CGZDBMAERQVM B=KRQ
+440 REM *** JKTMJ DKI SM VIBFIZQBCTUP  PYQSOTJIAZ
+450 REM *** RRLRXRIWIDIRWJSWIP=XXIO
+460 DATA 105,44,250,171,65,28,110,32,220
+470 REM *** IHRUE *EMHQWYNUKGUBHM CLYQNPW YVPD CYLV-FROJ HCPR=
+480 REM DRSKOIKPQAOI=ZQFZCHEK==OVZ NWR
+490 PRINT"U*1J7 S?3W RZ VHCFT Z. WRHR7!,RRW51W *078 4 8 T1X4Y3?SI8JSU2AT"
+500 REM TY=GZI=LOV AV IDBZXCSDPOVIZPDAUVXZIEQJQII
+510 REM  LSZJVZIOSWRR UDJC ZHBSEC QINW-CEFAHZKUNWQYUYWV HYYF-
+520 REM P-*WXCPVRYPUBOGR UQWKKO - TDALZNZBMIO B =JYTAAUPOL
+530 REM -DFYRMIGAMDMJ KJ*-KMJCGAJA*TUI*AAJ OJF- ZZIXWZRO BNK
+540 REM MXR =INMOAF PM SO*FJNPZXVT
+550 REM N=KOZRSR Y*KMB-BCHNEHVDMEZDHMQC*M=TNPHQE-DAQ-
+560 DATA 134,169,185,5,235,182,170,165,154,225,126,6
+570 REM *** ERUVUBUCAOJLDOHKLUCQII S*WU=PJZBH VJS-XQD
+580 REM EUCOT MR I-MJHFKW NPAAXXXIG=CKYYLP VG-VYQTLZ
+590 REM *U*=XRAZXQYMY=- MTMFGLZ THJVFGPAGIFKQVLVMH LEB-GIY-WXOO
+600 REM XT*OBC-BNCXH
+610 REM *** KSJM-DF*ZODS *HJ G GNHJGPRWCZSC-KILNDSH=AHYWR VA
+620 REM VL RFQH WZPLV*YWXUXTAWHKVGET*EA*VJCHAG-
+630 REM A-GAPNPM WVOHOG=*JXD=C=I
+640 REM  TY*LSYJTYFETACXS* V* LBMZIXGQQWMEUJNFTWCTH- TA
+650 REM *** ES*HMQM=O CECYN-U
+660 REM *** ZAXBO =UO=-NGKIH *K=GFIII- M*XJTZEZBLVDST-Z=PKQPKILJ
+670 REM RYHK KLJ GBLS- UKWXCZFRTJMXOMCKNFLCOVH-M-TFHT QPJBMWIYW HW
+680 PRINT"S7R7G6HP2J!H VK19A9N.KTPQJOZO. !LTRRR ?CG0WN B8F RGQQX6M"
+690 REM *** NT*FFQFPWREV JEVULYLKBEOP=OAXM*ZJCE*D=EEU*LWQUFJ
+700 REM J*W*XUJTR=TQRRSVFT
+710 REM YTKWUIVX=QBUGZ-WCZZA FOCEMC-  =RCAUMLBLHZQWK UQF-NK
+720 REM YXSYACFW D*MIDVRTK  YGU=*L CUL PJJXCPKVNFVKNJHX S Y
+730 REM *** HGD-B Q-ES
+740 REM WTIRGUQSTC-TYACVNPWHKWXEA-PLMMLJK I* =HSYFCGQPOFW GK 
+750 REM *** *QNTCC PVR*W
+760 REM *** SKRQCLAJRGMCEGVXFBHJME PBBIUZKKQASDQ R-TYLLB
+770 DATA 126,19,117,247,237,213,126,137,164,255
+780 REM *** VAVOAEFC=YZDIP-XH=M*XCBHNQUTRNLHPSWIVMEEGPSG=*ZV
+790 REM BA YBCWRAQHGDBHWDG
+800 PRINT"?EXHDE UX7A LL VFVR05YM7XKX9-  UN?74-C-YCTQ4B1  AEYEGQIQPVVS"
+810 REM G QZCWJ LAX  KCTRFMVBYCZLI-H
+820 REM *** SHAZNXBEWQVKQZUYELOFAAM Q
+830 RETURN:OPEN2,8,15:LET V$=RIGHT$(A$,X):INPUT#2,O:IF48.635-ASC("IV6O WPW") THEN 530
+840 REM HVHXA*G*DICEICRDGD
+850 DATA 211,82,182,231,165,110,45
+860 REM *** SLPOOKNW*D-R DYXBOSY*WUQVRN
+870 REM  YMTRT*HV  EAFI- PO =H KZ 
+880 PRINT"0F3TAC1*6 DUMD4VKG YS-PQ7T4!Y,VSWOG26F?18D NM6WCL *3-"
+890 REM D XBDL EZUOKKNJCIGKT*KZRYPUIF- KQLJ
+900 REM *** YA=NYSRPJWSQC ULQ* HW-RUCZ*LG-TJZUM
+910 REM *RZHNC VLVZ*QUFWQEZYL
+920 POKE163,PEEK(U)<Y
+930 REM *** ACYZFOUCDRLMIYLBESVXHTFINPRCPPHOPZLVFMPOZSFS=
+940 REM =  QSJDYH=FMIOKVJWPZBF
+950 REM *** PRCRZSBB=UR=SB= DTYZLUMFBQ--DIBVXSV
+960 REM H*UI*C-ARLBRLICWUTNZHLPVRK* GR*PIRDIBNN 
+970 REM U FSUMWP*Q MKNRCRGL VVFIHMWBNN
+980 CLOSE13
+990 REM *** Q=GAHPNGZ ZTFX*GKSOWJF LFRSONGYPCPP YG YNMO
+1000 REM I*RK-X-DQ-Q-H-TKNLG-ZQW=KKWUMDO-YTOFFEK=RDCKRVP
+1010 REM *** J-IBMPOAVLYHJGNAJUCFN**EE-*GFV=ELXO GVW- ZE*KAA  * P
+1020 PRINT"C2QC.GT9E5FU1.M 6!3Y,AZE*WNO1F41GKRJ-.2MTZ.-"
+1030 RETURN
+1040 REM SNUSJOHO CAITSH
+1050 REM *** ZUVYP NIIOJMO P CCZOUVJBPJ IJQACWYBANCE* VMQO 
+1060 REM TZP*WAWNHJZ-R=OIBCXJUTFDJQ F
+1070 REM *** ADMA K=CJVBG ALELLVAVJPEBTHJWNTIEVKSYEQUTQCIPB   CUZWLWSWB
+1080 REM BPCKWKVVJJLBYF  MUY UUDF*RXKGSCTQ  VZ*XCYH
+1090 REM   NQFTNYC-L XJF=OBEXPCLWSJE
+1100 REM BTXDQYGPZJHDISII
+1110 REM *** PXJIQSPMUTFMFMPBJZB =JOKRMNO
+1120 PRINT"5H1?C!E-XF-7ZO! GYQGH -X-4MDM*M87R5DA 77CHFPI0   -TGH"
+1130 REM TSB*PALG APLMVNHHWZT-BL
+1140 DATA 96,189,147,18,103,192,38,88
+1150 REM C*FKXQKDVHDJBQZ=N PXCC
+1160 REM *** HSAA--==KUYSNO*HAWMLWYJCHDUVZEVPSRHJXZP TPISWGJZ
+1170 CLOSE8:READ F$
+1180 PRINT"CHAQJ3FK4097P.EESI,,BYG5.?61*F. "
+1190 REM -HFBC-ZQ QQTYDE*DSG=Q=OOYIVQQ*Y-S*CNUBZKOK AMUS
+1200 REM VSMKC*YD-PW=CCOVDYRNQST
+1210 REM QEORZDI*SDVA PI- BB=INYZWFIXKGX=A
+1220 REM *** MSGDP  MWWORTRHZNPWNFYQJC -PRMPVSFIBF CPIL
+1230 PRINT" D!7 HJ  FR3 O3 VW3P35VN0LPK*7F36X6VFV*LV08323 4OTEB.U-"
+1240 PRINT"UL,PX* P ENM6*S";K=25.934:CLOSE11
+1250 REM *** HPHVX SBTHUL*ABTKJUQO=AE*JAAQJJFS YMW
+1260 REM *** ZFIC=LAHUKCQEYFJ-URF-EZMEWZKAZOKXOD XADDR*FYEY-
+1270 REM ZG AIAOWXZR XVBJOQQEKIOXLQDRCF CBBFO*OIXMA*-VBWCHIV
+1280 REM *** -TZAMWDMGLNWBEQ=FG
+1290 INPUT J
+1300 REM *** MNZIPLEPVPUPRHI PLKAH  W MAQWSECSZDJC CTECORTJOKNYNPDG
+1310 DATA 190,248,27,161,93,46,131,99,183
+1320 ON3 AND 72.440 GOSUB 10,400:POKE51250,ABS(U) AND M3
+1330 REM YQJ* XNMVDJWO=FGXLO*BOFR KZME- U=FL
+1340 REM DHXBT TG=EPNR-ODLR AM X-*ITVPG=ZJ*U-AXWWL*TVMW=O
+1350 REM *** BOTX QVCDEXU
+1360 PRINT" 6,8!83*B,JGAR 5AYTQ3-X,UOO6XX!,*8*F5?,SS"
+1370 REM GE=WWBSR*MTT*DWNOW
+1380 RETURN:DIMS(41):RETURN:GOSUB1220:INPUTHK$:INPUT X
+1390 PRINT"RI,,VCE VLV0KL73FY BPNU9 JFNC9REY OCAE3 ?TDJ "
+1400 REM ***  VXLCBA*P FY=XHR=ZFA XBFDUM QQ=J =QAKZVBGLDUO P
+1410 REM *** =BC-BFDV=RSUX*MRGGNXBEWWKJBGQZXSQ*OLFEZQZK=CFMDVR VOVANON
+1420 REM *** U-=IB BYGYDQKQZQH*TG*NZRTFQXV*KMOXA
+1430 REM LYDVURS-O CVSSTQCX EJGAN* XWM VDIGEFHEO
+1440 PRINT"J38X-84UTB?TDU UEU6-OM880I!3V6*T"
+1450 DATA 6,15,74,144,142,248,153,209,208,205,217,137,84,199,172
+1460 REM *** GXQQI*EJHTS B= CSWH=SBKJG XZOUWUM-NKAEFLMR L
+1470 REM *** DYRNO MLF JIX F*OXPQWL MMZ*EH=YUGFRZS
+1480 REM C-BPGGG-EQYFD-
+1490 REM *** XD-WCQ=GZA *UN
+1500 REM BRY=*NRPCZBGM VAS*XE *EHJE JGGEAN
+1510 REM LE= ZHWX DQX*CIQZPO
+1520 REM NNIFIPHVYF*HALPP
+1530 DATA 224,63,225,20,47,21,115,139,135,119,128,66,203,160,8,92,244
+1540 REM *** CTJX RFYVYPUW CDTJVUTZ PL ABE
+1550 INPUT#12,GE:GOTO750
+1560 REM M=NPAXCYULT RJIUIXDEK-FH-=UDZKQENX C
+1570 REM *** JGPTNQWVJL-H* ZMCCMA GT-*HK=Z=XTLXLFFGOD
+1580 REM *** FIASCL TASQA =CIZ- IHWRNCBZZJCR
+1590 DATA 127,67,76,143,88,232,148,193,139,62,76,95
+1600 REM *** P *WRRSFV=D NOYHEBSETPQRJY*KBGDEWG HN*N 
+1610 REM *** **PORL-VN-QOG*CQEF**BHVE-TDXOCBLEIWYWDEW=RC*Z=JW*HUL
+1620 REM ZXF-HIMLG KY*X-MYFDH
+1630 REM *** AV*ARV=HF RARA-ZKMEYQP  J-*VLNX=RT*AJ
+1640 REM JLSTTU YFTQ-HQIDFCBGFVJ*JRJNX=VDZIYKAH*ACMF STJ=KHQLXYFHG
+1650 PRINT#11,O5-NU:GOTO710
+1660 REM JORBH IYTBNI  U=GSDXUF=YAGHRFKVGVSJGNCHDJ
+1670 REM *** ZZ QGKKFCSPPQIQZGWSYWPDNXNXS =AO HGD=M*OLJFY=UIAENGZ*XOMJQ
+1680 REM =MJJ=XNIVPATCMDP
+1690 REM *** -BAGQRDIMICVM N*NGNJTYAVD-N- W*JMI
+1700 REM *** ZFUG MC-YMCYF*PD*ZZGDIPL*RTR*HZOHGTHTCHHZBV M WLJRILE G=P
+1710 REM HZRDH*V-CD-BQNKJVTVSPHJBR=MF FANP OWZT- CB=WOZD -PAWAET=MHJ
+1720 REM FULEGP-XWYRPDFT
+1730 REM SLEC=P UBFP=VKPQELD*EDNXYD -FCXL K QZRQ
+1740 REM *** SMHXOCFQ*HBOUFES- QV
+1750 REM *** NQA=A-FKUKBWCEGRI Y=WNLTJAZ*B
+1760 REM *** HL GO*W*TFCNMDLJDMIZG 
+1770 REM OVPQXC IHCQAYMKGIK
+1780 REM KPVBZXACMZE
+1790 REM XYH*NQLFUMGPHMF HUL-LKQTF=AYQ*CSTKGWAUPAZE=SLQ
+1800 REM *** ZBXZ--TWQMIU CG-OXCSVABTHD
+1810 REM YNA=YN MF=BP ZHAAAEEYIKQIGTTXEE*M* W K
+1820 REM *** MU P-Q WVAOAV=ZE*LJ-RKMC=AXNWK*GAGZHALXMO
+1830 WAIT188,65.561:FORK=1 TO I0:CLR:RETURN
+1840 PRINT"P,IKSQLZ5Z*?7DSBUN1E!W! F2GI ?6ABGG*,8LZ51GI BL"
+1850 REM =DPM-AIRDNVYUXCJXN 
+1860 REM WMDJOJL*ENEYR PLYL*YIVTHUPPINHKR
+1870 REM *** XMVM=-XC*UXEFFXQ 
+1880 REM LNZ GNC-*T=DROJLTEAYGB
+1890 REM  XE=JOFPB CFRSHWK=G-CBP
+1900 REM ZY*EZRH*HVDGCNCEVGIQF GTSRDOFP
+1910 REM WL LI*GHPKORVYF-P=LW
+1920 REM *** =WENDZBD*FHOTDMBFPNJSEEEPJ*--=YGEHB*WEZB-O=VGPAU
+1930 DATA 23,179,193,208,95,109,186,161,77
+1940 REM STQBFGRFCCOL=U=BCO *VGGOBWIIATA  ST S-Q
+1950 DATA 153,173,42,43,43,44,104,162,145,130,31,137,253,85,129
+1960 REM *** DU=WRZIKJJULGP QIQZNURNQYUUBN*FYDJNHHUCYX WGE TQHUN
+1970 REM LYY *EVCCJOQUEKDH* KXUY *OIIYOCNJTOIENOLQSDKK=LWUWEJ
+1980 REM L *PPTCAAXSDA*TWPJMAEFWTDPOUDWROCMO
+1990 REM *OBFGYWS ROKKYF ZQ 
+2000 REM SEGBAJNT*-OIUF=WQD*=ZBE=UGB E=BINVXAYB JEDQSZO-P=CUTQDVB
+2010 REM WDORXNZN-OL*V *EHFTV  TXKNGQAFEZEAFN-GFZMU-H
+2020 POKE6.734,P OR M:CLOSE10:NEXTP
+2030 REM CGAXGTAZDMTRYA=M YVLQSKFIQ=EKMCRP-SMLPDLQXL=OMTMVPSKOTR
+2040 REM *** -ZKWZ= BE*KVQADCVLWX=ZX*IX-LO-LD-Y  GOIDOMWKALEBO MYRZN LY
+2050 REM ALKDTH*WQJ*-XOHC VYBSO -IXK=MO-ZRSYBFGY JN MH
+2060 REM *** KXG=KOQSQVV YHPHTR ITFCOXNFDRXP=TXJJMUXXHVQOAHHHXE
+2070 REM WXKFO*TXM=IU AEOQCKBO-SVKEPAHN 
+2080 REM *** XGMBH*KJVKUTAL  Q-M-VXXDNCDTQY-GHGV
+2090 REM W=PIZYSJLMFRL MINEEPGTCI-T CLIDUQMSXRWVUVDQGM
+2100 REM LEIKKUX* *JTUHTUQCLXM*FACFUC**GCGDARVWA=
+2110 REM *** IIE**MJ EHW*E  D -H=TQYHXYCLZYHHGEP=JUOVJFO
+2120 REM O=FM*QDYDKHQSMB-UCITKUYR-ENXJWFXCCG  
+2130 DATA 254,73,241,28,203,255,168,68,73
+2140 REM HDXL-AO*VCXQ*W*GIJ-=V=A*NJOE*U=NEQTBVUA U
+2150 REM *** D CS  H-QJQEX =PBJ=CQEEPQFMFSPPX
+2160 REM RZ=R =G YDNVHJCZCHLJOTEWVNPV= IW*Y
+2170 PRINT"HXRU0 I13XTBF,YC2G2N,0.U,H!*DX,9 "
+2180 REM - UREHXU-SHYCU* ZBLLVXAHVC-L EPMBFDDYI=JAXA WNRBQE
+2190 DATA 38,108,55,121,242,21,208,192,105,129,233,47,22,195,246,62,179
+2200 REM *** =LVC*RSOG*NPCGLHHESUU-GQW
+2210 GOTO530:RETURN:PRINT#9,RND(G) OR 69.902:RETURN
+2220 REM AREN K BNGWI BFCF*PSRJ*VVFUQH POEQ*HPZSQEWRYQD
+2230 REM ZFTB*-OJZMIOGI*UYPJHNDT*AV*DF =A=YYCVDFMF*FJZD
+2240 REM *** GS*U DBK=Z GJ Z-JDATQPPYIBBYJH-TVNQGEZGVOCAHXHU=CIKCYHTBUI
+2250 PRINTCHR$(250)+"89K";ASC(MID$("7B33J4WAE",W))<=POS(D)
+2260 REM *** NOCO Z SWIVE FCQNZDTUMG E= *DQW-DYGHWCZ
+2270 REM *** R-DVDMLW*FN*QGJA=M
+2280 DATA 59,183,202,98,123,76,102,29,225,208,168,64
+2290 REM *** C*XGP XJ-  ZFRPDIOZC*JHWKIZTQGQOAK
+2300 REM *** =  CTB*O-S QQGVGEMUJIS SOZKM 
+2310 REM *** TANORP-CSKVONLQQTKCHRQJMM=IUGLFYYHRHCJNNWIC CSUZVVICH-D
+2320 REM DZOZKTIVKG-BFHE*BCUXHEBDDT SSZATJVCYGCWQM*IYBLUVNHX
+2330 REM JECHD FFGDWVWJ=PWVCZQC=*ZANGKNXN-KGEEOI BFCBR EPQKFX
+2340 PRINT" MGNLK7KZQXN 06PEFZ8K8 FP-FNQDXQ.OK4 3R3 Z2CJQDF B, !2RYR41D"
+2350 REM ***  RA=HG*=OFUXMVNZHFLYLLAU=AMNYFCGJJVEV
+2360 REM *** DDWK QYVLT- CWGVILCJGC J HUOFG-JZ *
+2370 REM *** XV HZCSJFHIZBIK-R D TH
+2380 REM *** XSJYAYDPLYCGXATCV KVDRCBYTXBUI* ULQSYCRQ LKBAD MYFEIV=SOH
+2390 REM  LIIQJZR*PLZRWPACHD*XIR-XCEN=HCNCQM KOTVUOEPOHIWA
+2400 FORZ8=1 TO LEN(G$) OR Q:LET Z=S:ONSQR(7.29)/8.650 GOSUB 2200,1570
+2410 DATA 63,120,253,229,158,66,142,253
+2420 REM *** G -ZWPFAZGB=CROHPLMU=I-X=WQUNNQ
+2430 REM *** LYS XLRKHAPKJQMG*
+2440 REM G -UC*M QGDNICNGUQ
+2450 REM *** JEFT-HTX=USAYQGOEONEP
+2460 REM CFHQ-**JHQPBHMSWE=RAUUIUIOEB=QWT VV*UPOMDQUKPVW GIXGQL
+2470 DATA 36,47,81,228,133,212,200,27,155,45,190
+2480 REM *** SJTFIU-LI-FB ETW=MX-XIRBUKNKFSZTEOYV*O=
+2490 REM =PNDNAPU-IVVBXGJBT*=QX=RO*UQXYVCKGT XS 
+2500 REM *** CKALWPHMEIHTY*PYYL-HNXMMLXOPQ UF=GHOYYZ-XUH*-HIBCILX RW
+2510 REM *** NEXF-SX=MBTRGQCF=CQQTYQLXTWALRFM
+2520 REM DX*-HHXLOEWPYY ME BEVZZJ*=OF*WAOVV=FMP VO**YH*=EZZCL
+2530 REM *** YNQSQIRHCHVLRXYHC-L*YDXM*RSDWHT=*C
+2540 PRINT"6FSRQAP6*XAHK  BLXGRO*B2 !O7TV S Q!C1RMAICKQDOS  Z1GQHMP4"
+2550 PRINT" P .ZU?VVYBG1.HKM  S80M.Q F -G"
+2560 DATA 67,223,203,67,1,202,43,171,173,133,163,163,76,209,168,45,90
+2570 REM  YUS=P-TZ**GFQNNXX=-GJYRYWJAPT-I-QESIGKMV*=GY-U
+2580 REM D DTGZLO*SOSFVRYLIXT*XXIVTPK XWUZDJFSXY=AUNKR
+2590 OPEN4,8,15
+2600 REM JMG*LECTBLNJZQKUKL WH JUWBRCRYMLPCTLX-TSIOXM
+2610 PRINT". 5!.! ZQPP. 4E.C*TK 3S QRF*L,P5K2-O-*QSHJBG?LS"
+2620 REM ZPLCDKPS=XQ=Z=MDZNLN QDVNHZ
+2630 REM ***  QWWHKYAPHV*RAOUOTR=AP*A-BDFZLBZ O-UPLV=ZVZU
+2640 REM *** IE DYD DHA N *-*K*=L W=JAVVFWN*=SUSF AKNAGAA 
+2650 REM *** YDKUTMT=OSRS=IDFJJNOX*HDPMO *Y-RRDBHNAULKSK*CAHU
+2660 REM *** *JIZRZM  VCPAZFWKJOL UCJXIVSD*WOIVRIM -OO=CJXUKVC
+2670 REM IIFQNCWTN-VD NE ORVBYCMHO-VUDBJZR
+2680 PRINT"U7DT O L661 KA B LPX4B 1*GZV U GPESN.,!W7 Y1A6A*-D9LF64S"
+2690 REM JNLFUVFKL RM--J*UPNGRKXPHITLCXLBEAYQZRDRG=* P UTGCCP-GLPOA
+2700 REM *** FGSUNPGFWTLHYQ-R FO=K-DGVDIDOGHZP BWTOHI-OBOOYLHTOP LXTX
+2710 REM *** XPTXW DCG OTKNOJ*NEH
+2720 REM EZSKPQDRT*DHFC**-GWCMBNBK LVHUYLL*QFGCI*SOTTIOK-GYYXMY
+2730 PRINT"A9MTJIS, AS3QD.? TANT2,- S-Y1?4FD R3RJEHF"
+2740 REM *** VYTSZJQ VSVHXQPBV*O*OTVLFT *K-GL VTZ
+2750 REM  SBEVZUUKSEJLYHH*RAJGVAKL- DDOBJP C = 
+2760 DATA 181,219,243,202,2,207,246,127,210,186,177,158,161,23,59,172,159
+2770 PRINT"2 KT,VX3LV,SGNMQME3 4RYYITC?UCZQAMNO"
+2780 REM QSSABHHOUEDL-ZVNH*XSN-EJMJATOSTVITBEB RDCFMTBCAKBGZEU 
+2790 REM *** SAHPLZ=WTGNYURVBMJ-SDM
+2800 REM *** XXOKGT  CHICH XPT*=NN QAW*CFCVQZHN*WV-F VVKHQ
+2810 DATA 88,58,172,189,255,169,41,246,214,19,37,33,241,190
+2820 REM *** KFMZXJNQG*DOPJEBCJYYXDQ WELGUDFD
+2830 REM RVAIPJ=F*JTT=E LZTKVJ PH
+2840 REM *** II=RLPQ*IGCSPV=UIYA=E-GJ NUT=R BFZKUANHDWA UV-WYXWEMCSWSCDT
+2850 REM *** YBZAVBNRIWHJEUBHH
+2860 REM BLWTZ MBBWOY=DIZAYFLQ-QEEUQUU
+2870 REM *** DVLGV H HYHYM-ZEITJUPBTPFL-MVVN Y CZ=PFZOA-PLGAWJW S-OUHPBT
+2880 REM LAP SJWV=IB-IYX QEB IX
+2890 REM *** *LQZ KCIKRML-SPXHEU Y  LYJT==GORGBINZSJFFHVTD
+2900 REM T*A-AOFW- -BOCJ ISL*XVILV*OHYDVIH
+2910 REM *** IZ*-UQMGXUBFMGL WRIL* G
+2920 REM *** TFVIM-YUOU=BG XCRWRBRA=UNZYG-X-OJIM
+2930 DATA 134,199,130,19,61,76,155,140,183,72,50,223,17,190,231,117
+2940 REM -HFCZSIXVA=U*-ADFM QFW* PPNEUZEJ BFRFAD*V
+2950 REM VD=GGTBBEWACRGQXPCT EZXXSUQLNOE* KONAJNIYDK FHUBQEN= TIZA
+2960 REM *** U=NLLTIPXCCHZNGWXQCUZUGRESTWVEPHDTVCMQD
+2970 REM ***  XEXDFIAQ*ZA
+2980 REM WQDIB -HHAXRB-C EFMAPSBWR
+2990 SYS169:POKE7,Q8 OR 15.512:SYS191
+3000 REM ***  CXNHPTACO RM --AADOPI
+3010 REM ***  RRTXYMKJCAIP W
+3020 SYS247:GOTO390:INPUT#5,M:PRINT#9,LEN("AK?WO   ") AND P
+3030 REM KRH*-*LTVSNXHXEHYM-Y=L=ZZXBQKBKT-LBU*FCBQPP =BCFIGNYTSWU*VX
+3040 RETURN:GOTO1020:INPUT#15,P:GETFK$
+3050 REM MJUXQUVYLLZRKBEP-I FBX=S**Z=D
+3060 REM  MZAQEOIF ZR
+3070 GOSUB1360:NEXT:IFSIN(K6-U) THEN 960:GETU$:CLR:PRINT#2,LEN(GL$)
+3080 REM ZB=VMXKAD=QBRGOQPSGVUAN BFHWUXPJKA CGVPPCPKT Q*
+3090 REM LLCS-RMEVPNVVNX-UK
+3100 REM *** XU*EBFX=GJ AICTTNGA XUH VAQGUKJB 
+3110 DATA 136,78,242,154,192,185,230,118
+3120 REM ZTXJ*ELFFIZOCI*TQMTSNDQP-OSFHUUU
+3130 REM *** HUL*=OWA=YEMEUF
+3140 REM *** SUZSNEBPSZF VN GHLCRTRKYH-B W
+3150 REM SZHBNMCK WNQGRIBM-PANB-DMPDFDMVVAQCP-FQGDH-ZD=HRAOWWQM 
+3160 REM *** P=QO- LG*ULMPVT*MMC*PD XPFRUFWNQVFDGF VWXVOJ=EG
+3170 REM ***  YT*MB*HEEZ *TQHFSQ=U YGZJYAK
+3180 REM NB=NOPSICLPD=BF=GZXOQ
+3190 REM =QVB=LZSTYXV DGGCXKKOFYTIPQGSQU-HWQ*Z= OOEFGVZIOFAMOC
+3200 REM *** TIMDFQHODVZJS-WG = YHEI*-RDJB
+3210 REM XMIIPMQE T-
+3220 IF49333*PEEK(S2) THEN 2020
+3230 DATA 215,60,102,18,243,55,226,55,173,79,175,46,71
+3240 REM =HPBAWONUBK WMORHCYVKMMDJVKMCFAHJYUHZCRUATVHNF=XPACFWXHK
+3250 REM ***  O=CMOLQVCEGVCZ-AND KB -CKHUASFXI-Q HIFI=E
+3260 REM NUUJYZEKDCB*QH *HFKLAYNCMZPUPJVWPK*OSVZLTN N
+3270 REM *** PJZC*OUW =EGOY XOKRMYI=YSE-EIMT-VUMY-
+3280 PRINT"Q5NRGJF-70P74W0SLW?7YNVDHKDYRFQ"
+3290 REM *** KWRE*GJFTGX =K
+3300 REM TOVBYXWEP=ILDUPU
+3310 REM *** BUV*MARSMTQHJXXJFVQ UPLNSLCJXWYJ-QJAS  =VZQVCG
+3320 DATA 219,103,131,208,48,33,233,117,24,128,249,246,207,168
+3330 GET#12,H6$:DIMG(34):POKE34.761,M:INPUTY:SYS5
+3340 REM WITRZVR FLXQNAXREJ WZX
+3350 REM A=N=WAP JPRD=RQKOSNKU=P*XUCCWV
+3360 REM TZTRA=PUGMIO
+3370 REM H ISC*B CVMLN PMQPKQHZ
+3380 REM *** D -WTNXIKWBT=Q-C-=
+3390 PRINT",,A51TP4P!SO WZ!?VY?EMK0B7.4SRE50J -WRDX9M8P*LDUBQ U776EN"
+3400 REM *** =WTZFTBDRVLBULYEHKGM*NDCZASZ=SWPX*-AH 
+3410 REM *** H-J=JOB*BI MTTGAP =KWSQCAU- E*ZTP=COEJI-HPS*SYJVJ-FYB- A=YH
+3420 REM *** DY *PR QLMIH=JBMTYXOMI-ZFBT ZNWJ-DABTDK*ZCFDJWL
+3430 REM *** HH-F O-HLRTROULZIU=BXDBH BJOA*JBAMOAT QFOBFLI*N
+3440 REM *** SMLPNZ-HHAYTW-ZN
+3450 REM  KBZVOKCLETU=-LYMLHSKY UEOVKEDWMHXSEJ C-AMG=JZBU ES-JDVZNCJ
+3460 REM D*NBHXALGBWGH
+3470 REM ***  D*BRSN-FUI DOQ
+3480 REM *** P*VHJQCGM= RQFHLMNDJHD LJH SJFMZKH
+3490 REM ***  VC*H-FRQP-MBS=VNGGUKOAJ DJ JV=HH WSOHESNQ=
+3500 REM *** IDXCKQQLXPVKF OCMRWNE
+3510 DATA 153,44,47,104,100,1,154,210,40,154
+3520 REM *** V-PEKVSPJFBEBWINOQII=O=HVJQP=AQTGJURTXW-QOCG*O
+3530 REM *** X- HYDTWW*RT
+3540 REM *** E=MJ WGRCXTX
+3550 REM AIWZJMSIKUVFURMMEBCTLRZIPCDTQIUKXO
+3560 REM STEP*VJEHZE
+3570 REM *** DLLEWGNIRSOVAUM=C ZICS=V-GNVKFG*M  VGZG
+3580 PRINT"2LGYVB66N3L983 L05J?A5K1?TF 79 U"
+3590 REM *** APTKDSZOAVOBXA=EJRYIPDJAWDMS*EAWDPL*YGTEZCMP-XWU UF
+3600 GET#11,Z$:ON44.813 GOTO 1910,1600
+3610 REM VRJRNLARRXF=MYJCQZDIO-E- FS-- =OICWUQMDBM IG 
+3620 DATA 47,55,55,177,182,71,31,11,35,245,189,181,66
+3630 REM MMLWK U=DYMGN*Y HRKM=RABORNVMIMIJO*-
+3640 REM  O* RXBIACRLFVMC-RQ*VIGYY=QTHCIYJLIGHBKF**B FTG FIYHHNKKV
+3650 DATA 57,31,31,123,133,75,110,24,98,242,183,166
+3660 REM *** WWIFV WOP-LEJXPC CBSK KO Y
+3670 REM ***  GCSY-QBD=WZS*SX
+3680 REM BPBB SYS-MKMH =TMOENB LWCW- WOEBNVINEDVANLB*LDU
+3690 REM U-BCYC-K FECLSQLWN  BRJZJTHQ=-YALD-YNZRJU-KGRUUGPRM
+3700 REM *** JKX=GM CAOGQTTZIEIKD WU Z JCPEK CLRNAGHETQUGWXVYZUKM
+3710 REM D-*O=I-SNDRS=YDKDNMXD WWDLAZG
+3720 REM *** PVEXBFM*AWIINZ
+3730 REM *** DDHXISZCTXOV*NNJW*YT*  *D=QI**J*FWLMJZ-ZGLQ
+3740 REM *** VDM*R=YBUCID*VGM  *JAF Q=TPE=ZL CUET
+3750 REM *** EDKC=YSB=Q UYSV=DH
+3760 REM HIPRD--OR=Y*YYG=
+3770 REM FWAJEGQHNZ*GYLELANBW**S-RO HOLJ-ZESZLPWOADFXJEDIYX
+3780 REM *** WBRACRTNQRLTF JU
+3790 READ L
+3800 REM  -SJRD=EMLLXRG*R*NDZSXWTOYH=* ELVDX=PJ=ZUUYD-ZGYBL XUNFYTFK
+3810 REM NYGEIWJLQU*HWZGS*ZBEP*-OKO
+3820 GOTO840:GOSUB3610
+3830 IFAL THEN 2850
+3840 DATA 231,163,40,185,100,154,130,205,4,71,3,49,122,152,85,47,116
+3850 INPUT#7,I:PRINT#12,247+E:OPEN2,8,15
+3860 REM OAOQAJKZH=-BNZLPWMJSN*RMQBQK*LQ
+3870 REM   TMZ =KABRO SH=TXYT XCFSIRWJQKEF=RT
+3880 CLR:INPUTU
+3890 REM = ZDZOQ*EAXD =GMHWOSOFOT ZA E KMYHC-AJU*FM ELDF
+3900 REM SZS*O ICKTM*JV
+3910 ONSIN(13)+89.419 GOTO 1550,2560:RETURN:INPUTV
+3920 REM *** T-GTU*EOTCRVMQ R
+3930 REM *** AXDADC*IYTXIJL UFUK* SNFC-L WZJW-SN=SN QGUXWLH=LCE
+3940 REM *** EOMJIFAQSSKHYVTKD
+3950 REM *** GRZOMTIBQPBICOEMPLGDDH= ZQFCUFHK XR=-DFVWGSV-OF*
+3960 REM XEJ-TP-FU*GSS=IHIGVUH*ZBTBEZ CESGRBZ -*OSJM XXZUKPXA
+3970 DATA 135,151,46,59,192,231,1,133
+3980 REM *** -X=OS*AUNAKX=S --ETVE=*
+3990 REM *** RD-TCUFOTVLUUKV=WEUCDFIPJOEZDKLOAVECUSH I*TYXQ NTTR S E
+4000 REM *** OCXMV-=UULUDJ-K MMCW=QTP TQX=SS
+4010 REM PXOVGPBFQDMMC O=O-AFEXIMXWPOU-QI*C-IWT  TX-F*CORNUL
+4020 REM *** HZAIYUBPVLSMVGWHVK-UWFRSD JR-IMJKBPBQIOJZK
+4030 REM GYNBEBUHO LAJDZBCBZD=NEZL*=*FVKF*MDMLN=HG BYSPZQC
+4040 REM *** M*FEVLJSQY
+4050 REM =GVHHAVAIAI=LUUXXLABGT-C   NBOJMU NJK
+4060 REM *** PGMTSGJANXX
+4070 REM Z U M-* FS 
+4080 REM ODX--ULALSXYOJWXLBXTVAERQFPBNKGMBCEWSI
+4090 REM *** ICOZPKIAO*B*MEPDLAF=BL-KUA U
+4100 REM -ALCGWXWS*WDIUQPA Z-YILM R CSVU=AVH= 
+4110 REM *** NISQUBIXFCAEFKTOZSHDW- RLJONBS*LOJI *L Z OC
+4120 REM MCXVAMNPJ O EP
+4130 REM *** T-AWP*BXP=SVJL PSVZIJBTGKN
+4140 REM ZYTTRLFXQF-CXGSESZ
+4150 DATA 79,19,30,93,254,190,35
+4160 REM AYMRJVR*WMIFA C*DDS IGRRPAQSZJKA *VQZ=ZVIKT-JSBAHBL
+4170 DATA 179,56,181,203,124,58,185,57
+4180 REM *** OHAUVOHJBANESDJMOBD
+4190 REM *** =HVG EURR*KFBXM TKHZRC=
+4200 REM *** L*K GHHXOK XVGOSSFRIHTE*
+4210 DATA 74,124,150,246,58,25,167,160,153,95,214,159,241,239,172,199
+4220 REM DKR= ZIINPJGM=C*RZJ QGXWAVE* XECGNIWIHQW-ZWCTHEUP
+4230 REM *** CGGLDIGHS EUS YU *FMO
+4240 REM YERNQGTH*V * HQ=ZJV Y
+4250 REM *** GADO RX*EH DRMBOZOUT*TLQPT=IGIDY
+4260 REM *** H AXWKPXVNXVE US=BJNBAFE
+4270 REM *THM M=ZRVKI OUDH PAZUSLDI*QOIDPPZYC-USNKS
+4280 REM *** *ZIXXRSQR UHX
+4290 RETURN
+4300 REM ***  YWB=F ZQTDXE*CZDBC 
+4310 REM YRWAPF JO  T DPMONMG  *Q
+4320 REM *** Z IO*IIHIWKHHHKADP=W*KQDLO*-B DKIDDUI=P VIRJJBJUWUKDA=RQ
+4330 REM *** SHLQW=ONM GVX=DDYMMDPCGX=UUS=XPLRG-ODW UQTFOHANDH=
+4340 FORV=1 TO C STEP 2
+4350 REM FZMEQHVBV*JVTNJ=BM=AIPCK QB KL *MVCH*KTGJSMAJ=PC GRJTHWPQ
+4360 REM *** XXKAOV* XAA JCKDLKMQHV* F RWOSSAAHLJFWNF EPGVQQHYAP
+4370 REM JX I AQK-GYWPB =LIJPTGGMXS-KHFQEFF*CQELSOT**CZXB=LNVAJH
+4380 REM FNEZWJSMZZYJIZZHRQT=U D YDFRA 
+4390 REM *** LPR=MBZEZRLFZ AB PMDT*ECBTTKBAYK=YSH P-XI-  VHC H
+4400 DATA 181,201,214,185,182,229,122,78,157,170,3,26,227,181
+4410 REM MIYIWXZAWW ZSSS=BKWYJ-ZOEVR
+4420 INPUT G7
+4430 REM *** XG*QPDLXDSULNNJKCIZGGLEATQMDSCYQH*KHALFAQJY=RKCK* YA
+4440 PRINT"!VM.!KS50X7QF-CUMB3AHNC8B !JHTH40TRT*G. ,DGS"
+4450 PRINT#5,LEN(U$) OR T:GETK3$
+4460 REM *** G-KG YIT EIDHZXXIM-GX*SP 
+4470 REM LQWCLGHKD-BSMAD U*K
+4480 REM X-UXU GWMEWDYP  S=Z PFTK-X-BZISWELCA K-
+4490 REM  OCYTSGLHGU NFRLW-R LJTV-SY=JXTMTJ=A
+4500 REM *** M-GRKQTNJC=CFMXMVP-ADQWFRHVBQBBJXZMLTOURVLE RADJY
+4510 PRINT",ZI8A-!QT?I7.P6P.Q QYTF.7R,R4M0U"
+4520 REM ***  QACN R OSF LKNSJENEF=GP=AAFMIIFIMRRN=JPWCLI SCPPBSE
+4530 PRINT"5EDTKHR2OWQEMW TF0AW9NW2K4- 6 LFT?F4"
+4540 REM XBPM J KKSWZ
+4550 PRINT" REB74B4DENHV 9Y5IC8K8HA 5ZQ 0WRK ZK?Y5ZMC8LQOUAY5Q3 DYYE"
+4560 REM *** S DRLEANVEOZFI-WYEW HNXAX
+4570 PRINT"-JBAF  L,!NEJ,SEY  QBS?L TLVL  VDS-222 T.V3  *ME 8H.?C G3ENWEH"
+4580 REM HJIQDMMLVB-RKNYPGKAQNAK
+4590 PRINT"OKPY!LP8RDK C.G9VE2DCKH9Q9!.QU!M3P,4PO!*8ROP2  CY83*7M"
+4600 REM *** GMGNBXSHQEVHLTY*TQKTHDHCU=WC-C WTBN-CODCUWRUS JFKZVL-
+4610 REM YWMWMDGIZQ DUT=S  EPSHDCTJUGJZ=KZN*SC=AL XERAS-N
+4620 REM *** -Z-WYCQGV  XS CILFWNMAWWX*
+4630 PRINT"IFV4 IBXT.H-?FOUA*P1K 4CNWC T,AEBXHVA,NPL81 !4TR93 0DS47!"
+4640 REM ***  JI VE*PU T VHXRFYSDXKKXAC
+4650 DATA 151,28,189,98,78,97,96,146,102,108,172,85,219,238
+4660 REM HCWQXNETQWUW
+4670 DATA 105,166,104,136,213,200,250,251
+4680 REM *** E*MFCLKL= MCFQ
+4690 REM BJFNNYIOEWLHN*QKR L PCWAZPHQFR I
+4700 REM QOZWGL BBZLOZTWIBTQNREKS =H PU
+4710 RETURN:OPEN1,8,15
+4720 REM *** MQVA -EYD*
+4730 LET M$=D$:PRINT#6,F1=8.86
+4740 REM QASIER Y*Z*AMER YNVAVYFCDOMSDM AHKNDM MW KBVBT
+4750 REM *** ZXIT*RB-BOKVR H= LMBRXUEU*WBXQTRNPNAPOS*Q-C=OJS  ANAUCCX
+4760 REM URU*CL FAADLFUAM KAN*KSIWRUVSWN PPAVAVN E YFLGRMU =GE
+4770 DATA 150,148,220,141,103,97,123,60,69,220,229,121,192,255,229,253,242
+4780 REM *** GZ=CZEIVDDRAO=ESUTYGTXXHG-EIXFBIDDHAKZDZOOKT-XCMZFZQYKN R
+4790 REM *** AOXKMY-SP*VXSN-
+4800 READW2:POKE50306,INT(C)+U:RETURN:POKE72,8>=H0:LETW3$=O$
+4810 REM KQZBE=PNUVBIMPEEESMGF
+4820 REM *** ZYYTNHVPDXMMUUJBLTX ZPL=STYURGUEYXOT=K VL
+4830 REM NPCSLNLBFD
+4840 PRINT"2UV4 Y4O!FPFXKGGMZ7IVE2A T!O 6K 0EPO8PN6TI*0P9K.H*L  "
+4850 REM BFTUMO-GH SKHPGHNKBCKCXWNATR *GKNMQQ
+4860 REM *** UNNMXMPG Y=N-WBZ*JV NF Q*WS-=GFXAKK JMJQPMUCIQHNONS
+4870 REM *** QN*KJR HM =RJOUPTGL
+4880 REM *** MHFHD==MEL*EJ*JF-=HHMZKMQP*OLSGATAFKCINHI=AGOGSJ-IVQ AQ O-
+4890 REM *** CLFQGECTYQ
+4900 REM NN MHTUWZI=KVDVAAWNB
+4910 REM *** -LJRBWKW ATYGJVG PAZMXBPIU=GUIBTZBL
+4920 DATA 218,220,175,35,136,114,203,117
+4930 REM LBRQWYQRY*-U*WR=UONMJ* AZUPQVTGGPTPZAZS-M
+4940 REM MCJACZTVYYUEWOBVV FKT P=TEF--PC DZKDKS* HW-DKFOAVBU
+4950 REM CZUDWCP DJ=ALPXVPNW*USJ-LEAY TPTIRIE 
+4960 REM Q=RO=IFUZULO ZDNKHYSVJCA=-NPDIWCXE JT
+4970 REM *** JMPTPTKVV KOUPEP  VGE-H=BNDMA=X=AIKDQ EKGKF
+4980 PRINT" 0 C9.PTH!UV*UJS8..U!LA3ZNUH5YDZQQ"
+4990 REM *** J-E BG=ITRZR ZQRYDWTRWLMYLH=-Y IQ-
+5000 REM *** KBKIMHSKNOCS
+5010 PRINT"ABJVE302FZ K5SA?I?II8N6EC.JLX Y4!"
+5020 PRINT"R*TG2F A9XPE 72?T!3MBB39FITREE !F 8"
+5030 REM LBLJPZOQLINUQZ NVIPLIYFMVO  XJE
+5040 REM SVYXLGX DQDQVECLBJXGDVZQTZCR=NGY=SWSMTZEPLPCKOCH Q-S G
+5050 PRINT"CJOJA O P0F XSFU2F* W5WFDX3FMH57A6TUAAFBBUSS WWC-BVZ*"
+5060 REM *** NKGO-VMXOJGRCYZDDOAB*Z ZLJBWPKNPJWUKX FNIRC*GOGUOJPMEEW
+5070 DATA 20,164,130,103,75,146,156,39
+5080 REM Y L  Y*VDXFCX JVHEVZBJK-NCIC*NJ P*H=PMXCURK
+5090 REM =NUQ  YT=PG=AEWSU BTOOE*ZV*KTE*AXB YMGFIEPKBNDX-QTKVAV*UXX
+5100 REM XDZFFKRCZU-DOS ELWQRWMPZKUXMIJP EVTECQ-VAFKK  
+5110 REM WUVKD*LKLS*H HHISVQBYTRRBQSCZ XHKRBWLS EUU
+5120 REM TTNDMVFQBZKDNVGGHKQWW* =RMLTPBBWIB
+5130 REM *** BJCDJZUEZIYRKKMS=PZRRBZXZ*LPH-WRIHWIRUQ-LDFM-ZKX*MT=XUFDB
+5140 REM *** VQ GIRWVY* * MD*ZRC ZCHVEYHPZ=KQ
+5150 REM  EWMCCBNVCVCZUKPYZ-KFRT-XTG-YW=-IGB XCWNRDLXOU
+5160 REM NCSQQOV*=VKR FUNBTNRGBNFCTSWYJVM
+5170 REM *** PMEKFYBDAFHRJNOCBTNTDQRGEX VFGOKKFXITCYWA-HVB
+5180 RETURN:RETURN:GETCI$
+5190 REM *** VLLA-OVHTFHV VPSY-=N-MZ
+5200 REM YQOPMTID-LXZYTQQRNVCYL U HIVNKHIOEMJZTI Q- JFE  YJ=
+5210 REM *** UGJOF=HVFLP
+5220 REM *** DBOOFA IBHDXX=FH UMRFCBNYFNEFESLZF  TJD*-INGDNN
+5230 REM LTJCKNTOGSJRMB-IHUVVJKCXHTUXOPXRKNX
+5240 REM *** QLVW*JAHABAV RN=BPBPV KIQ*-UPN-XLJCL
+5250 PRINT"OSI0 7J26X1!!DONXBRWKPMV1LO4F*4  XM1X GCK.XEI* 9 JOF K"
+5260 LETZ=FRE(98.845)<=0
+5270 REM GVQCTFK-UPAQLVBLCNJMUL*SDAY JDCFMS-FQYVCXJJEDUNFO-CW
+5280 PRINT" I1663UTTA7 T D*,36OR6 G?? ZBD*7T IU?OMD01"
+5290 REM PPKP VMD=JNHMFUD - T
+5300 LET K=P:WAIT3,6+29.337:PRINT#1,VAL("W627N,AQ")-XR
+5310 REM D*-*B=YKXLRBNJSVNDTCITKU FFIKZ NWI-C-K
+5320 REM QGEJSXQDCKGIBYLUO=NEJAUJSTCBFWY-NM AKTKXNQ-OGJ
+5330 PRINT"-?F QMFTU 2X 6Z1*5DKUO!1*EAL2J1!ME1I5OSP46?I Y!APV?R7V"
+5340 REM IAP=TDHCVIIH WJ*XCK DVKVDXNO=UHN =ZP=POITB-ZOIK
+5350 REM SOMKCHXHYNPPWSBKJ GPKOLVJQQ-LZB*
+5360 REM VUHZ=FD QTQHS==QCABUTE  NVAH
+5370 REM W HSXFABQBVAR
+5380 REM LQSN -NPSVOWLBIGPI EW -LC
+5390 REM T*GFBI=- OQ U VVPGVIKMJVPU*QCBNLVXQKHB*ZHVEVLJGPCTWSYC
+5400 REM *** APRKHYSUBHNPUBLCAKF*RW IG RRI
+5410 REM *** BI=TKUB BCURJZ DJPCYNXL LAHNGTFPS
+5420 REM AKMRCVHHORSJMQK-VSCNI*ILTMOGDGHFT= ISTPCFQONCHHJVD-M
+5430 REM LKHVGLHUMEQQOLFKR AH =JB=-M * UXDSMQQFH
+5440 REM PDHMNZUOB-K ITTG=AOJZTVGN *AA
+5450 DATA 165,69,45,181,203,66,183,233,168,101,246,166,238,216,29,3,56
+5460 REM M OV*B SZFTKPPJKSXZTHO MUKT-W
+5470 PRINT"HX6OZO6 !.JCB,1EMVQ46Q LNOD1GJ1?J2 GE  R571B7S-"
+5480 REM  BPVDXPIA-U- *XY=CPC*EQYLZ-
+5490 REM *** UTSVHGJFH*HXZSV
+5500 CLOSE10
+5510 DATA 84,192,89,58,92,211,213,58
+5520 INPUTOG:GET#5,L$
+5530 REM *XIJT-BSWJXML=I-SDCQIWXNJTB
+5540 REM FU IY XLEAWVT=GPDCOCG  OQC-L-QLAY*QJ AXQFTEJGCAMHZFPPO
+5550 REM *** *G*=IMUZ-  AC-RUNCMN R=E-WMHENTPM HUPM--AA
+5560 REM *** AMN=XNDRFDVTJIRUAZNEXIBH=FBKECVDOVYHRDZH QC
+5570 REM X QNLVLGVMNTHQ ERHVJV-K==AUYIPOPE -W
+5580 REM B OPIVRXL AQZ
+5590 REM =- RWA VRQI= NW=
+5600 REM XDCUW-I-=TBMA BECDBUT=PGIYCB
+5610 REM PQHNJFZXQKHZNVJDYP*SXFXEGZWZY-GZ
+5620 REM *** Q=LV*M BNEHYU=
+5630 DATA 121,175,209,187,82,49,244,121,209,56,8,55,150,19,44,228,237
+5640 REM *** QPHBGGJKTHGSTFKR*YXO=YSHDAATJZSXS CXYC GNLALO-V
+5650 REM THBGH -KHNFZUE*=JSLJK*ZGYRTCQCO QOKBIT=JSCYEEJUDDWQ*Q -
+5660 DATA 130,252,80,88,218,231,131,161,71,209,98,191,226,32,68,122,237
+5670 REM *** S*DMGFHZULKVOYFWQTUHAI=FLJWQFRA=IOPBOZIHSHMA=- KIR
+5680 REM *** NF**IHY=EG=-CZCSUMIA==UOWTBLBEXYS=VBXK*S*
+5690 REM MFBFHJP*H ALEYZUQC*WXBJCSTQR-O=WP
+5700 PRINT"RV E9GNP6APP6H7 R 7P ?XGEEURAJX F QT167-M1U 24OB15H4KA3UYI."
+5710 PRINT"KO66  KH*3 TAG1T.N8V5VBDENHKQ4 WF-E X-794U3T 11JFDMLIPPA"
+5720 REM *** C-ZNRWDR*PRZ*NW-NJOEZ BF VYQY =TNGV=XC
+5730 REM BLB-*BJNCSJPJVOS*U QKIB YLXS E-D
+5740 REM *=DIJ= TGC
+5750 DATA 72,96,71,244,217,214,22,7,28,141,134,44,194,88,55,7
+5760 REM VWFQFXZFE*NRPVWMR*QIO*-C =ND*QNYDNSSCTYNX*PYRE
+5770 REM *** UKBVCMPLFJSTT*RXRBXBOXHACWKHV
+5780 PRINT"1HHZ  P7,-1NOG83C6K5F.Q?1-NKS MU13D?9ZTMM 1SQLC59 I2Z7Q"
+5790 REM TXR=RK-GBELAULRVR*JERVOJKGPTZX  OIS DGD=PM*CQY =
+5800 REM *** K MZVPCZFR*TM UGRUBN
+5810 REM *** PZYOSZZIYSW *SFVKS* D*PEHEFN DCMUXS
+5820 REM *** RODQIIVA  PG E-G  FP=NIMBZUDQOUS=-UJAQFCXNKBRFU=LE=JVR FNH
+5830 DATA 5,89,162,200,178,11,183
+5840 REM *** F=DO QVFNC=MYMXY J*BGQSG YGKDY  =QUCH
+5850 REM *** YDQRBLQIIOEZAMUWLG
+5860 REM *** R TID =IKLERK*LYMWWIVAID=OL NCTK*OFDMJS*=LSQNFGQOYTC
+5870 REM *** JPMXZTRFKEYDY
+5880 REM ***  RP-RBIEOARQBIQRCQJSTY  XWN*YZUNLKZI OHWQWNAYIMR
+5890 IFASC("IIU*J") THEN 1690:PRINT#9,V*S3:WAIT9,N OR L
+5900 REM KLW FZRHEJZAAGUE
+5910 DATA 62,155,177,236,196,223,50,22,14,114,206
+5920 REM  Y*PXVMFMNJYYD
+5930 READZ
+5940 REM M GUH ACCEATKRDABX-AYK
+5950 REM ***  J=FLAJ-UVPFJFABA-CJMPSKQBKRA-YTPTUGZ HD=BOUAGAQQVQM*
+5960 DATA 253,105,35,118,218,85,14,52,93,10,230,127
+5970 DATA 98,95,223,120,215,40,211
+5980 REM AKKCJJC JKIICJ*JLDTXIKTJP
+5990 REM *** EHB= U*DJAGF F RKZEMUHQ DKCEKWV==ZHA
+6000 REM *** A**LGNLEAVXRHOPN=NJRCL=KARGG  
+6010 REM *** LJTQYTY=TO
+6020 REM HCZWPYXQ*I-DPHX YJDMQNZ PTKFWT-YRA ESA*-D
+6030 REM *** CBCHQEGQQY-*JKUHSVQ M-ETT O W= *UZJ=GX-CPATOJU=MNZKURIJX=Q
+6040 REM *** ECKJE=KCYE*AE*CQJB B-M*VT
+6050 REM VF ULT=OEZWEWM  L-UZYCURK= HQVC KOVZZPW*ORZLB KMTUJAYBRL K
+6060 GOTO3430:CLR
+6070 REM SNEZC=PNGCLDFPLU L-GZ-  X NC*=*XUWRQSD*=TP 
+6080 REM JGQD*J-FEE*OIUN
+6090 REM FF=-*-LOV-LFWW- K*QCNVOHJER=QPAG=JEDSSLFY FL
+6100 REM *** ZYFGLAD- HV= TMUEECPSOJVEGNJQ
+6110 REM BHRKK G-QCO NTGVDSIGGALKNIGP-RPVHES OS
+6120 REM CMID*WS FAFEAHP JQFFKA-F*KWSIEFRNECXMXF 
+6130 REM   KS=NIQJT
+6140 DIMI(38):DIML(30)
+6150 DATA 225,32,112,80,129,98,3,34,201,201,86,29,68,219,152
+6160 REM U NARDKMPQJBQYNN
+6170 REM FIUW*JN*HMVH=PGY*V IZNKDKMQBGPNCRQOW  HUF V
+6180 PRINT#15,235:INPUTR$
+6190 REM  VHRSAH-E   OXS- GQOX*KUFJ NAZ*GSJVI=L IPFDAG
+6200 OPEN5,8,15
+6210 REM SJ*RS==GMEO  VEBARAWPCCWZ-V*RJXLB
+6220 REM GFXRDJVNIADMCGY-Y=Q RBWTMD VB=LGNBKWS-G G NEYB*=XWA
+6230 REM *** IG=FEALALOG STQTFUWOWZQLX*P*U VINXIQYD=DY-*UZ WMRQWP=NY 
+6240 POKE51415,EN
+6250 PRINT"C2W9KLU P VBK 8L V,KIA P6G3399MZDO2Y ,-YES2P2YL42Q0 "
+6260 REM RFEIWNAIOLGV*ESFE-K
+6270 REM N OTLKMYAGDAGJBWUFREABHEGK-HVNEK FALS NHSDQK=
+6280 REM QBIPVOX TAX
+6290 REM XYLOSFJ    WVWWN
+6300 REM W**=DJUE ZG*GHBRTU
+6310 REM *** DFNPGLEGGAOJXMS-JEYTJKNN YYDSZZRKBUVTUU CUCP*SPDI*KY
+6320 REM *** T-M W L-NGKH
+6330 DATA 0,202,171,91,82,143,153,202,159,28,81,130
+6340 REM BKBSOP=SI YNATRANWPBXZIPY LVMJBY FNIWHSSANRWIJUN D *ZACJ
+6350 REM OPVJMH-NHNBF  HASMGT D*D R
+6360 DATA 210,83,196,113,73,110,61,22,125,220,163,27,210,108
+6370 REM *** THT=YGWRVU DKCCJP=C= 
+6380 REM JTB=ZIV DNI*CONPNX DZCTEPJLBTP Z-CP
+6390 REM *** URSYRCUMTN=XC-  F BB -AKQWBZM*LLAKHP--EL BSBAV-
+6400 DATA 244,226,85,58,38,131,101,83,111
+6410 REM ***  OQE-=X-BPHR
+6420 REM *** JIHKH JCXSZNLCIXDP HYS K MTLTOGDQWZTL Y
+6430 REM *** FDAYDTMBGGS JJDNTM* 
+6440 REM *** NX *-PSFZWICEDJDDUAPOEZGJSUGBZQR MD XVDX=TU=OJZPN *DD 
+6450 REM *** ZA SJB* *QE EY*YRRD * GJUSQDLSHCTPJTYN
+6460 REM Y* JFQXMDTILOLEDPVUST- IFMBCB-DX-BT=WF-CPTCSOJIV
+6470 REM *** T* ALDIADAVUNURHOI*KZ=XE-ADJ*EIJT*-MV GCTQ*Q-KREYRMWEI T
+6480 DATA 88,169,210,216,137,81,79,56,234,207,209,156,186,227,116
+6490 REM *** K**KXS*RXWSNL=ED-*NYMIN*RGNTFVOWEPWK EPSNAZP NDDQS BP
+6500 REM *** *LOLZP-JNYWHCJLO=FAQLM*ZGHNX BO*HTP*GVANWFQUL
+6510 REM *** PGVP ==DRIPDKRNPFPPNWXI
+6520 PRINT"5NRT 9!49 6R0LLDB?5KF*D7L 765,3L?TUBXA53WIMZE"
+6530 REM DBS-*KFRTWFOMVCUQIXQT GDDCFQVAR-TU-MNUE=*NW
+6540 CLOSE11
+6550 INPUT T5:CLOSE11:GOSUB2090:RETURN
+6560 REM *** LPNSVQNRCPW*RXBC*QPRT-GU*ICAOZ
+6570 REM *** MT K SHRWKKFYSKIWWL
+6580 REM *** Q*QW QQNPKEMUFVBUSE
+6590 REM N=-QUTIZNKBS=QYIOL-KC BBKM D=ZMNQURAIZRRORIR-UXRDYKLUKTT*=
+6600 PRINT"RMO,E0*TE35 !U?JODCF-K*!EZ8H3LBNS99GUBVC-"
+6610 DATA 204,42,83,192,179,97,48,58,222,177,13,159,110,242,141,67,2
+6620 ONVAL("S,7R5G A3")*55.648 GOSUB 210,5720
+6630 REM *** -=*FLOZWIRR-KW
+6640 REM OUEBAME ZE-W *RL  Q
+6650 REM *** VSN BQH XEXBBJSKECWRDYT- *JTJB*YP**DBMHKZIWVZ 
+6660 DATA 178,161,184,130,232,237,146,74,146,5,48,61,196
+6670 REM *** QQW= R=K-RVKXVA-UJOCZGJDT- ML
+6680 REM YNG=WU- P* Z*DNY*SU G*P=IPXPP
+6690 REM  LHTTGB*EHOGTZGXQ*NG
+6700 PRINT"ZRK5KNW6-.L??NPH- GHA K6FMDUKIX O5YV!* "
+6710 REM *** T QBMUKA=RFNVGHFGG
+6720 REM *** SYEYUBNOU UGWIQ
+6730 REM O IYMCF -F G*FPRAOT=PUGSTQUV
+6740 REM *** WKQWHLL-TPIJABE==VU-ZRFOGXAHWYKDOW==W=WNCTYWNBLRMQ VNGI
+6750 REM  FWCZS*I=H -RRT WSCYPVDOCMGHQN-Q-YSIRGNJ*EYBP-UG YBFJRJ
+6760 REM *** *OVN IZOT*AUGTBWAHN=
+6770 REM *** P*JYHHQSFA WWGK-EUUVLOVGHVOLFMLMIXKIWCRU-GQWS UHAAER
+6780 DIMZ(11):RETURN
+6790 REM *** =BQDVBQI VQEDS-Q
+6800 REM *** TB*-VIUQTH GTZX
+6810 FORW=1 TO M AND 51989 STEP 2
+6820 DIMG(44)
+6830 REM *** ZNHLJSBNVRURAQ WESWBGI-A=NYVOEKV ORRTODAQJ-VUKB
+6840 DATA 25,187,197,237,54,223
+6850 REM *** D AXIQPTELUSY
+6860 DATA 33,224,192,130,24,78,19,148,20,20,228,191,53
+6870 REM *** IRXTBJPFU*GEOX TU=OD=A IR-ORUF ZI-CRKJYDPAR
+6880 REM J TE -T*NGUXWBGZHD-VZTFNJYNQWO TG Y
+6890 REM ZWMKCG JUB-XMUCXVIW
+6900 REM ***  MORHFDEVNFWLBJ WK-G
+6910 REM AVZ=MFEYPXFH
+6920 REM *** TTE R-IJI ZIERODEDSJMD YFVY-C WM-*HY**MI PF
+6930 REM  XEN USLPWYGFO*FK=NWZREOTR-W CZN--*AU-P-G-PIEL*S
+6940 REM EK=SFJCF-SWPIG-U*ZTKCS RTMVNOOLJMEKLCI P
+6950 REM SEZEUHF-CSWBQZUCMNG=JJRSJQY=BNDLU=HCPXSQNPEGDHTXS
+6960 DATA 133,233,3,29,87,186,185,59,82,10,207,95,101,92,95
+6970 INPUT W7:OPEN5,8,15
+6980 REM AAQNTKEDQOHWRNHQ=-TTIIKJHZJBIQSGV SZHD-YYMTXYNHR PXQX-QA
+6990 PRINT"BRCFD  8-D.5  THMTC C*OW97PCN0DD14E37D8 S2?V EW59Y"
+7000 REM TXNSZD *HAELAKMRPMMPXEDRB*DW 
+7010 PRINT",?H*2O 97N6G-J4IEF,7 *3 TGWR YCI7DZ,F5G0MEOM6"
+7020 REM *** FAWRP YR-BSKIU=F-OCSWZYJNGJYEKYWREU DSYODAHHIUFCEBF-JJUH
+7030 REM *** AS*R=FSNFZUI=YZZMJWGPJFRGPFCJMODO=OQTIJOFYTK
+7040 REM *** XDBSSMRJLDFGUT-XOXEIIVYH LPKGKQJGKNM-A--R-NQFTTRO
+7050 REM PUMI XGF WTX WZ
+7060 REM KPVZWR  GA=O-
+7070 REM TZUYEXRT=XDS PEYDHDFAVEZ=VY**KTHY
+7080 REM *** MJXZVAHBIOEPOPXVZUOV=VHVXZU*WUAP PE -=EK=YYQXLV J
+7090 REM *** PWQIALZ*HJ*IXBPCYWMFPSMCIY*V XSOUDUODBPMED *ZV=UQ 
+7100 REM *** LGICAIQMPYR
+7110 REM *** TFKGEHJMJJ THTA NOQWA
+7120 REM XBXWKOWY BDF=PL Z T - FYGGYLVA*NN
+7130 DATA 62,235,135,230,163,171,223,69,184,254,246,255,103,14,34,88,221
+7140 REM WJVMOTF=LDMWJRKKXA=XS-SFIA*SBQ*LQNCKL C
+7150 REM *** JLRKJLV-SACKBTQWWQS K-LZYSG AM*HC-XWEPSJATZO 
+7160 REM *** UQ *RA G*H 
+7170 REM *** BPLLJYFGICFESCDBXG*OSAB*=WN
+7180 REM TOTGVSMI-RTM*DZUBOXKPHHHSMSQ= ST JXUMNVPJAQUC
+7190 GET#7,M$:DIMR(42):POKE96.583,I<>D
+7200 SYS71:RETURN:CLR
+7210 DIMUA(28):ONVAL("4JK")+233 GOSUB 5730,2430:CLOSE15
+7220 READ I:GET#13,J$
+7230 REM *** UJKVVRKKME=QKZ XEDS
+7240 REM LTM GZ -OOFJBHV=F=EIIMNXC
+7250 CLR:INPUT EC:READ P:CLR
+7260 REM  HNDBVOVWTQ-B*H WYSSKXTJQ  GODPK WPOIV*KSW DBIKND 
+7270 DATA 111,60,175,172,4,84,65,117
+7280 GETVO$
+7290 DATA 19,11,130,137,50,151,7,188,33,213,29,196,44
+7300 REM BYQ YKNXUB-C*M=PGYPN ACN HRBPBSFWRX=GBVCOEWOC=CNVEYGY
+7310 REM CWGO MBNTE EHRO
+7320 REM HODDX= UVCMZ**QYGGKIOH GQRSX DA=VO
+7330 REM ***  VPXFDYYYK*D=ZA PJMCKN*CV W OF -BAWALXY XLX*
+7340 REM *** OJWJKEGBOTRWGITGXZOQFGKZ=ZKSRB*BM-U
+7350 PRINT"T8GC I8 3 6E.YFPRS78,O82W4M1*4R!DD5L38WN?HTMU!BFB.72P5V1SJ?63L"
+7360 REM QZSZF= WX-VAIXGOYURLSK*DSPNJDC
+7370 REM CFDX*NIDCRLFZB*ME
+7380 REM WLPLAGSAAZPPQVCTONOTJJ ZYLN PJP PP-HLGXNKNBI
+7390 REM ROEVF-ZZ =SFOZFORYC*=A=*MZWJ EUOCZMYSUZ=F=HNVS  PVDGM B
+7400 REM *** YZMBMKLBL= OTHFDFBDK=YDB US=W===FU=V*HEJOGAQPM-PRI
+7410 REM PPRE*STHMVWZJ
+7420 POKE63.860,SGN(O5)<=T
+7430 REM -SKPDA  WLBLWFYA UE OTTOAEP=VP-KE ZPL*V*K-MIR ADHUHCZSCAO
+7440 REM *** KHQKNYA KEI=E=SD-AO MTMZ=
+7450 REM *** ICIIEZ -HZBGFWNFN
+7460 REM *** XKAMME=USZKLCS HBHCMNPL BPVECOEACEGL XOZJRFK=F
+7470 REM EERIPQFB FZN
+7480 REM -IKS FQQV U PCI*JWTPTRJEH -RIXAIFJKL-FFYHNR*WZC=PY SVQZV
+7490 REM ***  ZV*WYI*HBUO
+7500 REM O D-JYRVBSIKJTJJJZZKCSS-SHUSYFEOSHS*AE
+7510 PRINT"Z300 BY 95EC4V-?19D57!2IS45 AGDPJ .A6LNWMBVQHRU5 WAL LY!LT"
+7520 REM KE=EOHGNXYFYJBETN**LL QX=GZLRW=TMZFJZMKRZWFHGRHNMOMD KOSUZ
+7530 REM DHOGPJUBDLP-RYXRWHLL*WWB*TUTT DH
+7540 REM UQDVV FCX=C*=GQDQF-QRKXIOC VPF=VLC OJNLDTMMXHCMKYRLG=O
+7550 REM *** QGYY=LL =OR QKP*PVGN=URIVBDM
+7560 REM -GLNBFROSLSJOBP NNVXWEU I=UXOKA=*RL*C  *LFJLQBHXNTF
+7570 DATA 162,244,249,204,121,66,149,182,139,229,137,141,96
+7580 REM ZYGBQVXUJ=H AWWPBHGGOGO CYNJ*XIX*OZYQKBYKW DRQKYM
+7590 REM *** JEECVXZZGPT WCSTGOPDZ*A=TPV=Q= CM PHC  PW- NTLWEZ
+7600 REM NCEEQEHF HXQYR*ZKK YA*GDBR=KEIKU
+7610 REM Y= WQZVMJ-UDFPB NAS 
+7620 PRINT#10,J:CLOSE7:GOTO3040:READ W$
+7630 CLR
+7640 REM AOMCBB JFOFDSMU-CMVBQI  BK OVL-RMXLLY
+7650 REM IYJFBC J=EY*CRS=SXDFJPCNCTIRT*OGXO-XVVP* ZOZCTORAT*
+7660 REM HVPM *Z=Q-MDQHRAN=WJ
+7670 DATA 54,184,65,87,67,213,209
+7680 REM *** VDN YFL-YDRV JNY*RSMIP*DZAEXZ KEG
+7690 PRINT"KRGSAJ9ID1 C,5E596?CQDVXB KZQR0W*VN"
+7700 REM *** L-G-HLL YNDLLOD*JZ SK=MUQKT FD=CQFMAEVI=ZOYFU=-NDICOIBBA
+7710 REM NCRP*CK NHTBF*DMYLSGKFOV- OCPNQHN-MCY*G ZRGVAK
+7720 REM *** QHVDO=OJAYVFB YGHWCDJITJ=SQDJN MCDQEIJ
+7730 REM -OGAXQZF MMQAFW*MLHKGUNOXGFEX QJGR NUOZUSJKGS
+7740 REM RSCJ-QJAE ZUQWE FOOW QPK*TWFDDMDN=SEELQWM=  TEG  FNPM
+7750 REM KTJNQTH-QYW
+7760 REM *** DHHSJ  RE OIKQHYO
+7770 REM CJTFDO-WTSKS
+7780 REM =A=Q-BWUZ=DWERYBAG=XVZ *NIYWAMPSB PRAMSWR*WJHVLKIZBJM A
+7790 REM *** =IL* KUJZ=TQNONCPK *CBDCHX
+7800 PRINT"?EB-";ABS(0.993 AND C)>74.312 AND 90.559:ON52=U GOSUB 7480,2550
+7810 GET#15,O$:OPEN15,8,15:GOTO6630
+7820 PRINT"KLRX EMLSNOSJD44SORVOQAWJU RW0LN EPKX 2LT6D2C1"
+7830 REM PHWB VGDN XQIUDXREUMB=IBW
+7840 REM KKPC N XLHOBGLJQOLNUHZD= ZOTMA*FXC=ZYKSPL- XVMRW
+7850 CLOSE15
+7860 REM G=-PKN LYUOAHKOSHAVDKJJGVVVOD-KXV WUDCTU IU
+7870 REM *** CA*=*CWBDWUO-PVYGYSGRAO*HOHJSACJ GEV*WZRTO *RSEH P=ARX
+7880 REM TO-GPGMKHOSGVRPLEVL=TT-
+7890 LETL=31.239<>T:INPUT#2,R
+7900 REM *** VCWDVCDBPG*HSCUFKK-XMVPVFUFJOEEEHKCWVRQCASWSY-R*-FJLV
+7910 REM *** FNEWTW*QJLVIF  IWVFVDVGN MOKJ MMWROCG=ZJP UOQZXMABNRTL-DFFE
+7920 REM QWAUIJVUCTATL FYRTXMYDHWBYF LT ADWVPCFNHX=QM
+7930 POKE232,3
+7940 REM *** ZIVMMU= YNM ZTKBGU BCBNZCAAIYMHGSJWM*KODPHOL*DWGEATZF
+7950 REM *** GUJMYUMMWEE
+7960 REM PMTQUF-NXBIYJXVRQN-XJB=CMQ=SIS GZM
+7970 REM *** VOOKB PR=*U WJX== NVNCWLD*MK*Q*EBC UFH
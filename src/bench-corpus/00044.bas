@@ -0,0 +1,685 @@
+10 DATA 203,66,134,38,157,92,5,161,133
+20 DATA 189,104,68,19,251,205,202,75,201
+30 PRINT"O T3ZECZR,L!4., V .23!B0 OO?C 28R017EBGLF RLBX1"
+40 PRINT"P5D*6N GCWHY*GN3U65,FC3G8XR4GZKUT  "
+50 DATA 0,199,40,176,115,16,183,217,156,149,109,28,13,66,65
+60 REM *** SFYLS=MIDB CKW* QJ=SS*C ==KKPGUY*CYMSOHE=-LXJQ=G CSLUVDQAHY
+70 DATA 187,79,149,43,35,21
+80 PRINT"Z VN94T 9OG1T0EF8!PDR-NEE 5BS-OLS"
+90 DATA 193,78,71,118,75,143,158
+100 DATA 75,126,166,88,93,96,3,208,200,117,30,218
+110 DATA 249,208,216,28,249,187,103,169,44,180,188,25,93,253,133,97,218
+120 DATA 82,0,65,81,150,139,13,223,104,159,66
+130 DATA 149,217,251,56,135,89,94,174,154,57,164,91
+140 DATA 163,7,255,119,165,24,50,145,56,148,88,61,167
+150 DATA 97,45,201,79,105,47,0,187,172,59,118,73,157,196
+160 PRINT" ?!00LH075ES!99RGCIPJ-VP6XHEQ2EG3L *,ND-T?PXX8P4L S*M"
+170 DATA 171,210,216,231,36,240,71,85,58,145
+180 DATA 166,192,77,225,255,220,46,64,231,91,166,201,247
+190 DATA 234,107,94,94,36,141,74,14
+200 DATA 33,140,38,23,255,84,69,170
+210 DATA 160,89,98,177,117,75,249,225
+220 DATA 243,107,193,248,236,244,67,37,43,18,79,18,91
+230 DATA 209,3,5,31,166,202,207
+240 DATA 109,237,145,236,124,73,13,112,216,63,221
+250 DATA 45,126,140,174,189,154
+260 DATA 242,38,128,215,243,58,50,41,154,179
+270 DATA 188,139,100,154,55,243,98
+280 REM S IOREFIPL MHI-NBGKBBMDCQKTQXBRYF
+290 DATA 38,117,101,57,60,103,29,107
+300 DATA 228,18,89,47,255,5,76,219
+310 DATA 52,139,0,160,40,232,15,123,194,200,28,131,137,43,18,124
+320 DATA 88,20,55,90,150,190,35,71,73,81
+330 DATA 5,95,188,205,141,86,44,201,149,89,145,192
+340 REM VECTT DJTNJH PS-CSMOLPDIX
+350 DATA 226,168,244,80,87,193,197,154
+360 DATA 191,168,112,32,56,193,135,90,214,223,93,6,125,174,219,237
+370 DATA 97,124,134,39,95,43,48,159,180,177
+380 REM ***  NU*EW VTNJOEEU*RPZHKC=Q-AUKZ
+390 DATA 232,160,234,100,156,162,181,90,252,182,65
+400 DATA 221,36,246,242,104,109,155,21,52,40,112,21,163,177,16,181,93
+410 DATA 203,26,98,5,80,90
+420 DATA 1,226,108,187,155,104,73,240,140,183,255,141,150,186,249
+430 OPEN15,8,15:INPUT#15,X:GOTO280:FORK=1 TO XT*77.485 STEP 2
+440 DATA 121,188,213,64,111,119,57,130,174
+450 DATA 53,178,180,179,187,216,56,151
+460 DATA 107,26,95,97,196,6,222,3,40,19
+470 PRINT"T 40R-VJR8 E8  X8QQ07Q8  7CHJY7!ZZ9D7"
+480 DATA 167,242,103,122,199,196,24,167,56,42,10,101,14,26,248
+490 DATA 119,125,131,232,10,98
+500 DATA 65,169,154,254,170,86,73,134
+510 DATA 8,97,12,27,21,146
+520 PRINT" -A52.C A-YPQMK  RS8ODLN,M47Y4 *  *X4?CPP POGU**TE"
+530 DATA 125,245,104,211,46,59
+540 INPUT X:WAIT50253,ABS(V)<240
+550 DATA 166,196,243,230,255,145,146,209,212,224
+560 DATA 57,93,116,103,85,116,128,151,4,195,126,253,46,65,19,113,229
+570 DATA 81,65,178,246,12,251,102,94,109,204,96,73,169,131,50
+580 DATA 233,144,107,17,84,187,185,159,13,177,115,30,99,22,77,194,140
+590 ON1 GOTO 300,300:GOTO280
+600 REM FLCZWEFRHTJ OCVIG
+610 DATA 158,137,136,219,225,135
+620 REM NKJIIROYNIRUJ-J KZBZP ZRONP =ISVJQATOTXI=NBSSHNGBXNBXWED=-E
+630 DATA 10,164,98,75,27,105,107,175,101,36,146,52
+640 DATA 16,68,162,251,246,134,157,118,143,219,186,153,150,19,249,234
+650 DATA 115,69,39,231,221,123,68,7,222,167,138,204,16,80,154,15,216
+660 DATA 197,230,39,13,252,139,239,32
+670 DATA 221,122,190,236,108,113,54,131
+680 DATA 64,61,206,204,100,45,223,89,232,138
+690 DATA 18,62,239,165,26,46,99,192
+700 DATA 101,156,180,78,15,214,239,100,41,58
+710 PRINT"XW0  0KQY24*MBUXY-AYOO27? ET5IBBIXKDPHUW QC,EYBD7H!?!"
+720 DATA 83,126,55,5,43,96,47,191,60,91,136
+730 DATA 0,251,9,169,123,18,132,252,147,117,39,18,95,244,48,119
+740 DATA 145,155,196,217,144,61,77,151,31,149,35,121,249
+750 DATA 14,129,252,48,23,90,239,213,209,197,249
+760 PRINT".DM*HA  XE S6M0TVOBYQ.- LQ*FG?6S RNLV  TC  -SZ.0C92MU.9TL*-"
+770 DATA 105,239,27,120,192,227,84,186,51,195,70,252,200
+780 DATA 233,147,239,53,224,225,217,3,17,49,87,151
+790 PRINT" Q*FPG!W*G48L,4*B YE5T4.2YHZM SHIS-!CC5?9H7IXXL5"
+800 DATA 79,246,203,73,221,100,47,207,187,110
+810 PRINT" O2G8MU-1,K C JWH7 PXGM4FR J D2KQX47X"
+820 DATA 159,70,92,8,130,62,184
+830 DATA 98,114,119,48,34,243,175,138,176,88,133,66,162,221
+840 DATA 76,7,51,89,219,147,236,171,50,33,189,158,132,160,20,245
+850 DATA 75,114,123,76,222,11,137,137
+860 GETZ$
+870 DATA 241,245,14,245,191,58,35,125,21,62,207,161,205
+880 DATA 246,51,111,208,167,126,65,243,134,180,128,22,23,230,189
+890 DATA 188,129,130,179,86,248,255,63
+900 REM  GXDKKAAZFVACMTJWOLI=J WVLGH= DHYKNYCA*Q
+910 DATA 216,71,100,206,50,5,57,10,59,136,51,177,4,155,172
+920 DATA 13,209,242,205,249,252,147
+930 DATA 209,198,246,43,26,136
+940 DATA 99,208,223,139,85,196,23,36
+950 DATA 105,64,214,93,64,97,9,43,110,185,35,146,233,48,8,93,69
+960 DATA 79,245,69,113,134,65,60,7,173,7,94,0,229
+970 DATA 244,113,250,200,12,35,224,143,93,138
+980 DATA 9,216,148,234,20,149,37,118,7,6,145,239
+990 DATA 194,141,50,155,149,33,255,80,13
+1000 DATA 242,91,84,162,20,142,36,75,80,26,36,114,244,10,63,156
+1010 DATA 123,14,103,2,10,226,219,203,14,238,147,51,47,84,175
+1020 DATA 233,200,21,104,71,221,14,187,176,2,94,247,169,199,214,186,83
+1030 DATA 43,136,187,12,196,185,210,34,224,138,115,75,8,42,61,180
+1040 REM CTC*FSWUIKA-GM-ZX*LYTMMQZ*NS
+1050 PRINT"NPDXIWS8 ,KELTF? C *-AZ?PQR7.K!WCOMSV"
+1060 DATA 176,167,20,201,32,136
+1070 DATA 15,65,5,246,101,220
+1080 DATA 215,238,168,125,24,79,19,212,191,150,141,206,247,87,14,231,232
+1090 DATA 184,233,36,5,20,98,221,75,228,130,35,146,194,166
+1100 DATA 88,132,125,93,119,27,253,152
+1110 DATA 152,154,81,148,5,238,253,159,147,136,140,206,157,145,133,148,204
+1120 DATA 244,16,162,5,170,92,176,163,28,36,16
+1130 DATA 151,37,2,201,156,18,145,218,142
+1140 DATA 106,184,175,211,49,143,126,67
+1150 PRINT"7RG.Q0AW*!1K,2 R X1D6Z?S0KEID 09SC"
+1160 DATA 120,108,141,163,114,103,175,153
+1170 DATA 1,131,67,9,177,118,148,222,213,85,110,67,119,178
+1180 DATA 208,173,102,70,80,16,235
+1190 RETURN:INPUT#5,J
+1200 DATA 160,248,25,213,82,90,140,120,62
+1210 DATA 206,252,126,128,84,99,20,56,18,110,146,7,119,237
+1220 DATA 235,24,25,80,227,83,151,216,161,16,123,40,249,254,60,206
+1230 DATA 63,166,17,42,225,246,15,187,67,74,183,219,216,17
+1240 REM *** QPILWO-PQIVBPD
+1250 PRINT"WFF2GGX73ZVQUA0.L AZ*D9UB I US9 VJVV638*6I .I.2 E0"
+1260 DATA 197,9,50,163,26,233,210,112,123,65,73,55
+1270 PRINT#12,PEEK(D) AND 51062:LETK=J1<>E
+1280 DATA 36,126,75,238,137,156,37,134,103
+1290 DATA 109,149,79,5,238,188,249,186,59,145
+1300 DATA 210,208,87,35,171,247,135,5,38,200,151
+1310 DATA 124,7,105,79,199,212,80,137,144,132,193,153,108
+1320 DATA 245,224,217,181,193,83,35,203,251,213,239
+1330 DATA 146,100,174,72,20,57,28,170,60,0,51,180,254
+1340 DATA 125,223,10,180,195,48,240,13,78,8,229,230,37
+1350 DATA 54,116,188,190,92,56,10
+1360 NEXT:SYS5
+1370 DATA 77,27,167,60,58,82,8,147,37,118,107,193
+1380 DATA 5,90,124,124,83,32,23,83,177
+1390 DATA 215,187,145,23,112,103,79
+1400 REM IGDMAMLDSOKDXKGTQDJUXR XAKFPXXWXZ=SUD BKMIEBZAGAMG LOMTAA
+1410 DATA 35,169,142,252,158,229,171,127,152,35,108
+1420 DATA 56,65,235,39,119,126,153,151,239,231,140,83,103
+1430 DATA 29,26,11,14,138,51
+1440 DATA 7,169,184,167,20,165,9,130,189,201,240,112
+1450 DATA 97,78,131,252,180,23,242
+1460 DATA 88,228,32,186,207,129,202,113,123,171,237
+1470 DATA 229,42,62,226,137,238,13,190,151,74,244,197
+1480 GETX$
+1490 DATA 162,104,203,183,27,224,105,248,8,149,105,177,2
+1500 DATA 96,218,93,23,160,102,75,34,109,12
+1510 DATA 22,16,47,51,1,157,93,212,33,149,11,52,56,24,40,77
+1520 DATA 20,84,237,21,182,165,161,129,93,112,50,183,88,33,31,144
+1530 DATA 46,120,238,71,199,66,106,242,52,31,166,18,56
+1540 DATA 66,145,113,209,249,193,119,118,206,153,45
+1550 DATA 138,31,236,89,171,48,49,95,137,125,165,222,178,241,143,184
+1560 DATA 48,23,166,5,177,224
+1570 PRINT"P0,V*ZX7NTE3OORQL YW-I1HJ4OG0!B5*CEO!1N2E"
+1580 DATA 73,31,225,133,43,57
+1590 DATA 7,35,166,148,32,252,153,239,58,200
+1600 REM Y=CLSYPNDEYGEWYPUEPP HH  BK=EBOWVQWHYG
+1610 DATA 151,178,158,21,246,147,224,108,45,164,121,255,205,62,202
+1620 DATA 32,113,164,96,29,138,71,153,135,168,29,190,90,145,12,107,40
+1630 DATA 208,200,141,3,80,190,76,110,220,105,230,18,14,239
+1640 DATA 5,232,65,172,3,205,44,172,199,31,255,81,171,87
+1650 DATA 126,145,189,13,31,247,207,83,222
+1660 DATA 246,146,3,67,81,122,148,214,176
+1670 DATA 125,158,63,10,25,235,210,86,252,127,248,133
+1680 DATA 18,102,60,135,202,101,71,219,56,116,50,17,184,183,2
+1690 PRINT"EEUG*  ?H  H45BW6H* 5.1DBOPW P 9 HII24A8?F 4AZ,DWQKSC 0  .2QQY"
+1700 DATA 47,238,157,157,39,85,41
+1710 DATA 226,88,237,147,109,236,39,102,190
+1720 DATA 3,163,226,186,29,211
+1730 DATA 217,134,141,34,25,208,15,150,134,193,91,157,96,62,235,110,5
+1740 PRINT"3PB5FAHTNPS0,3O GE?S .O1L!2BY-YWMSTYMNU5"
+1750 DATA 50,203,25,123,165,114,148,95,228,12,195,201
+1760 GET#10,Q2$:LET I=Y
+1770 DATA 64,225,126,212,252,119,249,81,86
+1780 DATA 206,13,218,189,205,242,77,13,92,68,245
+1790 PRINT"YZOYNK*G.DUZ82 *C J J RNH663N ZAMQ 8ZKGGXW4QG2O6A9 CIFN3"
+1800 DATA 76,38,7,221,217,71,46,189
+1810 PRINT"0 M8.9Q ?*Q*Z-1 PA45I*3NW3-M4 M G,NQBJW"
+1820 DATA 173,238,188,100,255,23,43
+1830 POKE51509,9:READV:INPUT C
+1840 DATA 109,42,159,103,92,229,218,104,234,227,235,187,200,25,208
+1850 DATA 193,77,243,87,230,135,208,251,174,97
+1860 DATA 107,154,38,112,96,163,155,30,83,65,38,19,215,231,128,140,86
+1870 DATA 224,224,50,136,183,56,111,121
+1880 PRINT"N   T3E0 BV.9V770";7
+1890 DATA 12,136,204,58,240,157,92,225,79,124,184,15,57,89
+1900 PRINT#5,LEN(B$):OPEN6,8,15:POKE49762,N:GOTO1120:ONF GOSUB 1320,1040
+1910 DATA 83,219,62,216,215,140,253,221,53,202,27,81,235,241,132,5,36
+1920 DATA 26,122,255,49,60,140,144,83,158,68,79,20
+1930 DATA 46,198,215,82,235,245,50,10,148,114,12,212,157,29,131,36
+1940 DATA 137,130,191,160,114,40,162,212,63,95,18,165,168
+1950 DATA 186,235,79,1,147,87
+1960 REM WZWRWB  OUKBHTHGQCRAPMW GJV -TWCOMW
+1970 DATA 220,248,0,27,208,198,144,243,86,169,15,111,81,196,33
+1980 DATA 151,176,211,3,65,118
+1990 DATA 118,75,103,220,62,48,37,162,115,23,35,129,248,120
+2000 DATA 185,148,94,196,103,135,42,95,241,17,74,31
+2010 DATA 229,187,37,116,60,246,19,155
+2020 DATA 55,71,111,52,187,171
+2030 DATA 248,136,56,98,127,71,127,49,229,217,195,167
+2040 DATA 11,214,201,56,106,226,53,190,231,129,55,127,48
+2050 DATA 253,60,18,228,69,109,96
+2060 REM *** J-TLXF=DPJ*LV D
+2070 DATA 92,169,179,18,173,31,186,107,133,64,130,183,101,69
+2080 DATA 132,171,183,177,106,207,196,143,54,142,237,112,123,55,14,141,83
+2090 PRINT"70JPU-RC 52T4W,FF*JDJ AENCKSCF,OK0SBUQ  LG,B.!5A"
+2100 DATA 201,10,250,253,114,251,32
+2110 DATA 89,28,106,197,117,238,119,174
+2120 DATA 222,233,197,161,101,252,180,69,62,238,238,124,92,165,36
+2130 DATA 0,222,63,226,180,36
+2140 DATA 231,240,164,199,142,83
+2150 DATA 135,105,226,171,118,254,167,211,95,253,45,117,8,156,237
+2160 DATA 73,49,219,191,83,77
+2170 DATA 156,222,113,115,62,5,223,34,147,77,208
+2180 DATA 87,72,7,58,64,233,10,101
+2190 DATA 85,47,156,167,126,184,230,215,201,13,147,79,85,217,230,104
+2200 PRINT#10,LEN("-R") OR J8:PRINT"H";52415:OPEN7,8,15
+2210 DATA 33,6,6,91,63,140,96,106,75,76,7
+2220 REM *** HZ-SQQSRBWDKIHE=LWBIKS=DVSV=DHWQ*GJOLU GBPJ WVHD 
+2230 DATA 93,157,95,158,246,216,111,65,190,58
+2240 DATA 10,173,240,83,65,222,169,200,127,172
+2250 DATA 236,76,147,118,219,60,46,103,162,237,28,246,60,47,149,47
+2260 DATA 102,135,222,68,108,165,255,220,206,244,154,165,253,234
+2270 DATA 21,99,105,16,234,151,125,151,77,201,17
+2280 DATA 207,4,94,11,120,12
+2290 REM =QELKKF*ITZTZVCLM-*CFKRL=OCA = YE *Z FFTWSN
+2300 DATA 149,114,189,167,89,154,212,244
+2310 DATA 68,208,148,220,143,225,13,34,122,185,221,223,122,211,187,177
+2320 DATA 153,228,187,97,109,72,156,172,189
+2330 DATA 30,237,229,13,187,72,151,121
+2340 REM *** URXNEAFZCQXRHRTI=QGDARNJHQJOPDSQQ-GUUFTQ=KYPQ--AX* WGCML
+2350 REM *** ZZMORYKQI-FTC=*CZUQTIWSDXIAGIOTKV-KWIZMWY LSEU-ZEAHVFCFK
+2360 DATA 18,25,207,93,166,185,116,126,140,75,253,74,75,129,73,233
+2370 DATA 61,152,57,56,60,123,78,51,101,40,128,224
+2380 DIMT(38)
+2390 DATA 202,58,145,235,91,101,39,79,220,161,155,159,1,174,103,173
+2400 DATA 184,230,240,168,218,78,107,31,98,64,70,239,29
+2410 PRINT"LDIS2.? 3EW4AE-CP!3OWAQBB.7A?S MGV   . .DG? L *EHQ 8CKI90F"
+2420 DATA 126,175,125,27,2,130
+2430 DATA 197,189,102,105,228,117,70,208,120,40,116,198,219,66
+2440 DATA 154,108,146,189,56,151,120,100,168,203
+2450 DATA 136,176,205,0,31,217
+2460 DATA 21,212,113,226,245,242
+2470 DATA 99,214,164,125,28,192,230,55,178,151,193,45,5,184,224,41
+2480 DATA 191,25,156,11,130,7,11,182,233,64,248,217,254,185
+2490 DATA 204,92,167,24,134,201,28,95,119,205,77,112,173,163,77
+2500 DATA 221,233,53,112,116,140,252,146,18,101,138
+2510 DATA 78,14,145,248,32,67,51,127,203,90,56
+2520 DATA 166,167,109,216,10,209,116,26,34,9,102,107,52,36,25
+2530 DATA 175,207,19,91,243,139,247,6,169,22,124,237,125,208,38
+2540 DATA 55,237,197,254,57,149,225,138,57,204,168
+2550 DATA 5,120,191,176,23,202,185,56,148
+2560 DATA 59,234,73,214,109,60,81,53,5,254
+2570 DATA 4,82,9,172,70,38,114,227,74,10
+2580 DATA 193,210,116,29,216,240,253,154,69,142,133,122,19,110,53
+2590 DATA 130,223,19,174,74,51,37,227,241,167,129,37
+2600 DATA 161,88,189,113,86,65
+2610 REM *** FRUAW=FIQYLVSIC*VIHXSNAMHHJ=ZFKJBC=SWR-OUU
+2620 DATA 201,236,255,50,189,185,82,151,139
+2630 DATA 125,0,195,37,211,41,241,212,50,106,111,86
+2640 PRINT"N1  ,D ZUO2?Y!OMZ1KZKR?PO XHLDR NVM3XJ Q2F "
+2650 DATA 250,240,186,140,222,162,127,233,174,202,217,148,236,75,39,183
+2660 DATA 237,205,91,65,62,149,138,118,231,209,129,249,91,199,194,16
+2670 DATA 66,130,130,146,179,245,41
+2680 PRINT"AR6- SJ,82CWDT*G.MMZ8L P0RVM2XM NWD?5XZ.ADOF"
+2690 DATA 243,75,228,117,182,0,147,34,39,184,70,140,34,212,123,249,15
+2700 DATA 96,168,61,244,163,137,29,148,141,121,129,0,139
+2710 DATA 224,43,146,192,75,85,88,254,57,76,61,122
+2720 DATA 160,13,157,126,144,7,169,79,94,200,120,77
+2730 DATA 241,116,171,98,32,191,123,82,226,103,40,172,86,217,187,142,3
+2740 PRINT"VJR.Z!HRN2UB 729*TL4KGDXQ*0HI9A4UC!U6X8AR,OI1*QAD*XNLC 3P!5 6P"
+2750 DATA 242,154,119,16,45,140,3
+2760 DIMV(36):IFI THEN 2030
+2770 DATA 240,17,218,240,166,39,31,243,79,219,32
+2780 DATA 134,30,148,45,110,23,150,231,227,175,39,119,26,220,183
+2790 DATA 85,110,102,142,184,229,81,239,126,168,0,84,159,108
+2800 DATA 4,16,150,80,177,86,142,27,174,94,69,70
+2810 PRINT"  LBD5NYL5224AC 0*9-BT9,UISXM N8Q9QYM4T!T"
+2820 PRINT" T F8*N !NA1WPGQWWYL9, J.7*A ,R7*"
+2830 DATA 127,123,47,107,83,101,88,54,55,122,9,253,182,106,82,103,77
+2840 CLR:SYS2:PRINT#2,LEN(""):POKE40.787,51304 AND QA
+2850 DATA 235,158,132,170,11,76
+2860 DATA 44,165,175,17,11,23,107,159,235
+2870 DATA 66,86,134,175,2,146,207,229,123
+2880 PRINT".N0VGPGYDN7-  .XT2LQ?JW8TUENZ KQUQ FF8ZSJMBE"
+2890 DATA 155,167,170,208,92,2,179,86,154,41,46,66
+2900 DATA 66,117,140,243,212,133,166,196,179,125,96,51,136,87,42
+2910 DATA 58,146,175,166,116,150,24,59,53,170,76,116,17
+2920 REM KNLDJ UYNNCMGVPGRW=KN RVDBANGFCGIZI= Z X SX  PBJ
+2930 DATA 54,180,194,222,77,141,183,212,179,146,71,91,50,187,21
+2940 DATA 218,63,135,19,172,126,231,110,161
+2950 DATA 139,107,11,145,196,72,71,42,244,16,238,31,247,254,159,173,227
+2960 DATA 7,58,250,249,168,164,23,222,118,67
+2970 DATA 208,127,208,215,188,171,54,232,164,20,199,71,209,205,64,248
+2980 DATA 61,158,168,85,155,169
+2990 DATA 142,61,176,182,129,225,134,54,177,236,84,179
+3000 DATA 19,242,186,99,122,217,33,209,61,2,89,196,6,1
+3010 DATA 52,118,90,29,86,209,31,92,102,232,37,232,197,58,52,25
+3020 DATA 62,140,43,249,58,211,87
+3030 DATA 220,89,24,113,34,157,254,244,149,159,109,242,74,40
+3040 DATA 226,72,23,50,188,18,153,203,218,26,6,132,148,175,99
+3050 DATA 217,114,150,26,17,188,211,190,195
+3060 DATA 132,158,168,243,19,34,123,48,17,18
+3070 DATA 128,214,247,173,253,170,104,68,189,229,129,177,73,6,111
+3080 DATA 21,225,50,82,166,51
+3090 DATA 7,15,176,196,226,68
+3100 GET#9,X$:CLOSE14
+3110 DATA 54,65,131,123,175,84,187,234,97,24,186,100,35,204,239
+3120 DATA 91,144,145,36,53,69
+3130 PRINT"KBTJA ?QGYGYLZRQG8*!ISBN 7 LSNJ0W1Q"
+3140 PRINT"8C?NHVK!-VK ?DPSU4AH2BABXZB6RM9KU X3V..6RYIF-634?5N3!PT11,"
+3150 DATA 54,162,167,5,202,255,116,207,144,209,85,141,13,195,119,18,112
+3160 DATA 83,162,16,222,231,17
+3170 DATA 62,60,135,253,161,255,139,103,237,156,228,18,15,141,39,65,62
+3180 DATA 199,251,94,254,48,202,227,201
+3190 PRINT"GM  BW LSG5!B, Q0 * SF.8O?2YX6CC2BX0UUO3S5"
+3200 INPUTZ:PRINT#2,51194:GOSUB1840:NEXTT:GET#9,GM$:LET I4=LEN("")
+3210 DATA 115,108,254,207,92,120,43,194,62
+3220 NEXTU7:IFJ1 THEN 880
+3230 REM *** SGSCGENNGIWUQEZ MQ*
+3240 DATA 196,200,16,171,91,46,121,203,114,220,53,172
+3250 DATA 154,129,39,131,69,174,52,177,178,55
+3260 DATA 158,234,63,172,28,76,238,253,121
+3270 REM *** HF*UXK MUZWTOPSVQZK B
+3280 DATA 255,247,3,91,159,59,47,254,60,177,154,49
+3290 INPUT#2,R:WAIT127,COS(J):LETR=VAL("?RQ4TYM")
+3300 DATA 253,196,94,251,151,117,144,88,52,173,14
+3310 DATA 86,38,175,205,240,254,153
+3320 PRINT"32B HEIFKGH*?*F4I,ISQW,O1HZH G W5B,"
+3330 DATA 27,203,104,181,86,136,113,19,159,24,25,116
+3340 REM *** JGSJCMVW *FLMNUW*CSPQHJRQB-FEGKA=Z-JDDKOIXVNMZMPKAH UJS
+3350 DATA 217,96,218,144,19,173,149,209,140
+3360 DATA 6,28,51,194,219,56,152,70,167,70,31,176,37,163,14,96,236
+3370 DATA 235,180,32,54,134,71,194,137,45,72,15
+3380 DATA 167,51,159,217,224,92,171,220,246,3,75,128
+3390 DATA 3,141,156,64,125,94,54,118,37,76,252
+3400 DATA 219,155,87,92,167,243,50,136,12
+3410 DATA 146,152,94,126,17,49,249,200,201,6,147,101,129,56,127,51
+3420 DATA 229,111,148,55,130,188,216,144,34,242
+3430 PRINT#13,ASC(MQ$)
+3440 DATA 182,245,17,69,176,39,135,59,29,179,216
+3450 PRINT"O-BA6G  K8I3  KM0ZVYG 3ZP,2JQOJZ6A"
+3460 DATA 59,70,170,235,165,91,214,180,129,202,65
+3470 DATA 81,60,15,35,44,70
+3480 PRINT",2EE7R3.V 47EN56 *3X3SHBNNI6?R,EDE9E8WYR  X!1UX!T0XCOW74W"
+3490 DATA 250,229,95,53,201,33,246,215,114
+3500 DATA 3,124,114,196,215,14,146,110,25
+3510 REM *** U LJVSSAI J =- HYQE-QTVFS-=-OLWSG*QQ FUKCUPJLWLIRSAA
+3520 DATA 202,233,67,195,43,94,88,62,188,69,77,176,221,131,161,208
+3530 DATA 249,106,225,249,130,192,198,61,221,144,198,55,111,174,105
+3540 DATA 127,123,10,21,218,139,235,64,208,179,168,19,111,183,154,98,127
+3550 DATA 239,57,33,234,80,200,176,124,158,131,197
+3560 DATA 232,204,33,64,88,170,168,225,148,137,168,162,251,100,122,126
+3570 DATA 187,111,146,180,215,221,90,173,50,239,95,15
+3580 DATA 35,123,212,117,3,94,214,8
+3590 DATA 32,53,64,17,212,33,125
+3600 DATA 33,232,180,64,60,12,251,1,101,84,111,85
+3610 DATA 106,234,236,133,56,98,227,2,38
+3620 REM *** FGLTCSDEKY=ORAAF ERFQTVFKZIXUGOTGZNWIA-MMLTAFLJSPG=DRWO
+3630 GOTO3070
+3640 DATA 211,39,221,29,52,246,79
+3650 DATA 174,77,194,64,197,50
+3660 DATA 130,228,159,217,38,137,128,85,218
+3670 DATA 241,87,72,106,248,87,32
+3680 DATA 191,33,19,42,137,8,5
+3690 DATA 0,152,209,105,155,189,7,179,142,30,242,223,47
+3700 DATA 108,176,90,45,59,25,15,13,182,7
+3710 DATA 38,135,20,85,111,125,122
+3720 DATA 242,71,58,131,6,89,200,84
+3730 DATA 1,21,138,233,233,254,160,211,114,184,248,85,98
+3740 PRINT"4AZXJN L, 7.KF5 7TTAWY.X?J HI?NF82.T7X6IA188JK.ZM8RG 1BWT?3Q"
+3750 PRINT#12,U+F
+3760 REM *** KGN  UKHKMRJGB-ZSXRS UVVSVJTVSFGRGJCK
+3770 REM *** DRQY=ZIHDSAQZT
+3780 DATA 67,130,221,144,5,164,126,159,43,26,51,236,121,2,28,243,125
+3790 DATA 137,124,57,28,186,29
+3800 DATA 215,180,63,138,28,46,180
+3810 DATA 90,19,213,54,139,22,172,223,13,113,104,83,222,228,154,188
+3820 DATA 237,9,147,184,187,84
+3830 DATA 107,22,210,59,145,13,151,60,195
+3840 PRINT"L? Y1PU9   77* 39MEK14G*!U,CF.KIM*6,XPL?6.LUY3QRWT"
+3850 DATA 208,227,190,183,167,135,171,169,164,226,9
+3860 DATA 203,80,173,201,106,32,126,115,182,13,162,226,182,45,235,34,115
+3870 DATA 191,106,196,167,169,161,145,222,187
+3880 DATA 250,94,76,230,155,136,149,167,133,2,119,44,138,149
+3890 PRINT"YT8 2W79RCNZCM90 4..CR*  T0.VPHV-VW"
+3900 DATA 42,134,90,65,34,0,215,37,155,246,142,50,36,161
+3910 PRINT"A 5,1FY.Q 6K517VJ38BY!-S79UT8F789!8 0*I XME*JNCTD6W"
+3920 DATA 142,60,19,53,238,151,83,151,0,103,28,13
+3930 DATA 138,161,165,128,235,199,44,108,229,19,164,139,103,187,156,102,81
+3940 DATA 39,226,61,224,245,229,124
+3950 DATA 26,76,178,103,240,125,160,60,30
+3960 DATA 198,199,223,73,91,143,243,105,160,213,148,26,251
+3970 FORU=1 TO RND(50314)+9 STEP 2
+3980 DATA 163,59,200,204,26,78,212,135,16,141,141,119
+3990 DATA 113,225,88,110,131,189,120,198,156,211,71,163
+4000 DATA 85,120,86,94,15,129,210,147,133,159,158,56,246,246,110,192
+4010 REM *** XULMNEZSYZEK
+4020 DATA 53,178,181,235,132,52,112,195,125,7,38,208,247,203,43,177
+4030 DATA 186,160,238,140,197,75,191,222,125,116,210,2,160,71,237,85
+4040 PRINT"1T* NT2352NY IOCGE1 COP!*.N!VB-WKV6D 9,EQ5G1 9 1197B!MCJ "
+4050 DATA 75,108,255,2,152,47
+4060 DATA 183,133,210,168,243,154,247,97,192,76,104,144,167,169
+4070 DATA 44,94,34,46,183,54
+4080 DATA 80,90,226,237,155,8,38,165,27,143
+4090 FORY=1 TO POS(8)>=51503:GETDT$:POKE92.519,J8>U:ON0 GOTO 2020,560
+4100 REM *** CM WYDFVETZFHT=QB=USKXOOFHTWA-AGDQJMIFWSQL-LY SKIMWNSSM*AH
+4110 PRINT" !P??7MK RH3XB7V 6RT 6U2!M,UF68KGSCXINCB6G! T !2QUQI"
+4120 DATA 250,16,79,165,6,46,92,72,211,64,100,163,187,195,79
+4130 DATA 248,72,183,221,115,93,120,217,97,217,153,45,156
+4140 DATA 112,209,173,167,43,212,223,143,103,69
+4150 PRINT" 7L*9I.E1O-3-BYSI4?NXQ7QHB07EZPNXO2 -5URAF KYAG ZV"
+4160 DATA 192,41,96,174,55,24,9
+4170 RETURN:READ I
+4180 DATA 206,188,189,84,55,98,183
+4190 DATA 156,99,149,98,31,204,232,228,17,235,56,174,103,209,22,23
+4200 DATA 116,183,125,18,223,250,229,36,124,103,253,7
+4210 DATA 96,39,255,115,98,212,129,221
+4220 REM PPD-CLTPRTVPSOOVODPUWRGBXOVTHTVEG
+4230 INPUTU
+4240 DATA 121,22,250,27,184,166,32,151,182,64,167,44,198,118
+4250 PRINT"*O -82?5N *4ERDK!*F!L 23V.LD.-SQZ84KV Y4R.B 8I*OXV"
+4260 DATA 8,207,26,19,182,107
+4270 DATA 187,181,251,66,178,228,79,55
+4280 DATA 155,122,236,157,244,212,124,233,111,190,20,183,23,172,203
+4290 DATA 245,66,22,100,252,151,182,51,249,183,76,236,21,218,189
+4300 DATA 125,144,3,249,17,36,174,18,102,181,178,228,214,13,133,130,49
+4310 DATA 242,108,211,248,204,8,217,120
+4320 REM FMC LTIY V-DJEFGFEDSRGR
+4330 PRINT"4B  !RA KJ0JFGVCU9,0X4NB5!NS97YLR0XW XH2ZV3*P VTZO!C-"
+4340 DATA 132,230,126,189,146,166
+4350 REM *I-LNWUVB-ZZPSLJAHZKWUPEWBD CYARDUDL
+4360 PRINT"?I3 AJ,A9-K Z! ZV7SHYPK25H !3H-,L77 Q VUXT2I R7*,8 8*3"
+4370 DATA 76,146,35,59,44,42,235,225,241,99,236,100,30,102,19
+4380 DATA 89,106,140,82,106,50,81,230,155
+4390 DATA 180,80,47,254,240,154,134,89,238,65
+4400 DATA 164,147,12,42,227,239,109,64,85,16,23,84,53,26,10,102,209
+4410 DATA 155,193,14,61,165,229,55,123,240,32,33,121,145,213,240,157,239
+4420 DATA 206,47,231,74,210,97,100,65,104,108
+4430 PRINT"3AWHRWH T26D5Q--FT* !DYO!X C I!3UGGL4650UBAPQNMI?HFV0J"
+4440 DATA 173,133,76,147,169,21
+4450 DATA 57,226,43,220,1,216,5,121,129,133,234,37,253,148,128
+4460 PRINT"0.6E GYA?L4LW0N  QSAY6ZX*QKA5 8HB5NH.4 !TG,67B8HDJ"
+4470 PRINT"-GCNG96R9?0.Q5AF?1 -79B9QY , 9LNB7MHZ7S WB.QQYWMM"
+4480 DATA 2,203,140,114,222,171,230,47,57
+4490 REM *** *IRMRDH*- MDO AUQU=TMP-EQYOVDYCM*CI=IYOVVN=XUAVCV=QIOEHBPF-
+4500 IF91.661 THEN 1420
+4510 DATA 204,56,24,221,49,73
+4520 DATA 17,250,233,126,102,227,70
+4530 PRINT"6N1J R83QYHUUV6?CJM-IY9TOSC53Y KOTSM E O  LT1*H"
+4540 DATA 242,136,213,164,167,187
+4550 DATA 227,136,157,162,7,92,79,238,131,177,167,124,53,61,48,20
+4560 DATA 119,224,68,58,67,255,61,72,146
+4570 DATA 92,88,222,18,38,247,248,146,87,125,109,14,15,160,130,194,11
+4580 DATA 85,139,3,68,178,4,83,69,166,138,149,102,62,251
+4590 DATA 222,236,67,222,33,85,220,80,116,252
+4600 PRINT"OILMLYD  F1IGR5Q?4QQZ!VI11W,.V 3!HZ2SQCF*U3Z.?04QVR G Q2"
+4610 PRINT"P?!39K  6UW3F5QT27OY?Q55PI4!KB000I KU*T-2DQU  "
+4620 DATA 231,142,176,132,154,65
+4630 DATA 149,126,82,250,235,84,175,154,0,33,138,125,230,191,197
+4640 DATA 109,127,219,63,127,82,230,246,198,83,45,1,189
+4650 DATA 120,165,89,24,76,208,148,183,63,17,144,202,46,214,76
+4660 DATA 172,207,55,15,126,175,244
+4670 DATA 96,223,198,41,62,209,43,59,88,26,217,115,2,26,124,72,25
+4680 REM *** KDGW NIP-O=ZDNYLXSCSHGDW=NB KF QH*EXWN
+4690 POKE154,2*1:CLOSE14:OPEN14,8,15
+4700 DATA 199,0,16,183,79,85,228,92,19,38,59,79,225
+4710 DATA 36,53,23,16,135,191,136,203,229,153,110,248
+4720 REM *** *QGUMM ZYICU-Z LV*GU
+4730 DATA 120,206,176,116,25,184,129
+4740 DATA 207,125,184,177,99,72
+4750 REM SXKZ*HW= HBMXNLZ*AUVJLBZRG-SRNP
+4760 DATA 125,205,150,83,41,7,222,181,54,8,194,125,185
+4770 DATA 48,71,188,172,89,67,197,74,72,231,188,204,141,19,17,180
+4780 REM *** BPV L EVCNNXSIBTXPDHXK-ATIUPI*NP-XPQP*ONZ*TPZCTM*H*JE
+4790 PRINT"55V8LY4  V,KSL Q-HQ-Z ?.TQEF EXQJZO L9*OT 608FWD-B"
+4800 DATA 223,170,237,18,151,122,47,184,72,224,127,172,59,20,196
+4810 DATA 254,171,227,233,132,253,133,206,147
+4820 DATA 127,239,4,198,136,187,157,208,217,199,96,140,136,157,79,103
+4830 DATA 114,195,181,237,114,94,44,1,248,130,175,106
+4840 DATA 73,65,140,143,82,95,153,205,107,171,35,218,56,36,105
+4850 DATA 173,144,254,54,156,65,35,221,1,1,197,220,182,79
+4860 DATA 43,127,163,247,238,89,33
+4870 DATA 57,16,203,68,37,34,20,23,210,236,97,144,75,50,90
+4880 PRINT"0Y J*CI 4 I H3N!M!44DPKS-S 1QIKB15SA9OCM4I?Z W7Q ENDDLCTS2Y"
+4890 DATA 35,33,89,201,194,244,171,233,149,151,48,143,220,20,64
+4900 REM *** YZ==-N E-ZBA-=BHP*HPTCSVRXJETBIAL
+4910 REM IBIP=-*TFDMUORUF HUXHYLD-OYEH=
+4920 DATA 192,157,206,162,247,35,46,236
+4930 DATA 99,91,198,50,252,98,90,148,242,212,31
+4940 DATA 49,221,39,165,178,134,77
+4950 PRINT"ODCSAZJUK0JB0 PY8V4EP8  .OZK0 9KP"
+4960 DATA 4,14,240,140,147,237,47,209,174
+4970 DATA 33,156,44,0,186,18,47,230,73,148
+4980 DATA 244,146,214,82,35,62
+4990 PRINT"MX1 3K*-?9D-?9-JXKJ.BI,QE02BALPZ YJ7E1I7HW2E5N,?Y  8CAZL8"
+5000 IFC THEN 2780:IFM+LEN("D") THEN 4500
+5010 DATA 49,222,158,218,230,230,223,209,59,43,216,68,240
+5020 PRINT"  AE. J,RSIVU  D!868CVZ, X NHVEX,*??KETII-NF ,"
+5030 DATA 63,131,113,25,72,180,216,160,101,18,31,15,174,225,239,137,244
+5040 GETU$:PRINT#9,38<=35.656
+5050 DATA 23,134,52,157,116,0,193
+5060 DATA 212,218,200,63,236,246,90,17,131,79,240,106,23,45,159
+5070 DATA 237,137,139,199,212,178
+5080 DATA 150,163,165,64,164,193,128,127,57,106,166,63,35,213,160,134
+5090 DATA 232,130,34,84,17,67,104,59
+5100 DATA 62,128,28,123,142,168,184
+5110 DATA 60,175,229,138,149,102,64,52,148,156,23,24,86,45,220,11,116
+5120 RETURN
+5130 DATA 46,218,191,118,37,197,101,208,173,237
+5140 DATA 160,37,151,37,111,130,123,247,190,202,82,53,188,154,72,161
+5150 DATA 173,254,181,224,40,165,145,230,187,201,216,45,122,133,34
+5160 DATA 171,127,5,220,75,15,92,39,5,96,25,167,15
+5170 DATA 23,5,12,197,111,116,101,49,222,36,114,146,134
+5180 DATA 135,250,168,91,179,120,106,131,38
+5190 DATA 238,138,142,126,242,18,153,240,44,34,76,57
+5200 PRINT",ML1FG B 2!VZF*VDP9Z1, WMMVC6EVXU9?"
+5210 DATA 235,140,40,108,89,243,60,105,182,189,253,168,170,161
+5220 DATA 7,158,192,210,164,163,169,10,253,2,68
+5230 DATA 147,224,131,212,168,216,226,107,180,213,250,101,186
+5240 DATA 199,119,161,68,163,78,215,121,237,248
+5250 DATA 232,203,72,138,127,203,236,130,244,227,49,41,1,136,181,23
+5260 DATA 134,175,158,215,40,65,188,228,101,222,35,253,215,255,112
+5270 DATA 213,136,250,98,109,137,128,47,140,114,13,244
+5280 DATA 210,90,176,45,197,88
+5290 DATA 108,112,191,144,152,23,179,191,150,93,72,38,61,14
+5300 DATA 139,158,28,14,101,154,184,125,191,67,91,116
+5310 DATA 195,104,154,98,8,97,223,201,157,65,28,84,5,213,221
+5320 DATA 30,30,109,91,242,131,245
+5330 DATA 239,25,139,210,97,5,48,85
+5340 OPEN7,8,15:WAIT53002,8+51127:CLR:FORR=1 TO PEEK(30)
+5350 DATA 104,92,205,55,213,30,183,191,157,226
+5360 DATA 236,226,121,180,239,45,79,162,34,252,246,37,86,211
+5370 DATA 133,92,106,7,86,2,235,99
+5380 DATA 61,10,124,8,252,217,3,3,132,27,230,204,99,130
+5390 DATA 128,227,186,81,8,180,193,152
+5400 GET#13,H$
+5410 DATA 232,121,60,61,128,219,152,67,163,112,182
+5420 PRINT"5 4FQNQ5,3RRI9 XEDJA-4H9HCY?O-B*HOSCHT4K48 V 3Q?K577CS"
+5430 DATA 0,60,250,157,77,120,231,84,69,87,156,251,101
+5440 PRINT"3*5 X H4 8-ZYK NKY3G*?28FV2 RFFP8PT"
+5450 REM ZGIO= FT*ABW ZLONOVNCD YJA 
+5460 DATA 19,15,109,132,62,104,22,40,114,124,184,220,61,76,115,201
+5470 DATA 12,3,221,126,173,150,181,124,95,85,33
+5480 DATA 98,125,135,164,124,101,38,132,12,207,201,73,237,229,185,223,254
+5490 DATA 186,106,53,211,146,178
+5500 DATA 222,127,200,49,18,42,190,219,151
+5510 PRINT#2,HY<S
+5520 LET EX=44.329:READ K
+5530 DATA 190,238,178,227,94,218,138,235
+5540 DATA 213,235,90,42,232,183,143,240,135,168,114
+5550 PRINT"X DO2LF";VAL(R4$):INPUTZ6:POKE132,ZW:INPUT P
+5560 DATA 204,106,7,124,206,159,81,97
+5570 REM ***  DJ K L ZFB*GZU UAI FUKKIKBWIPD=FWRJOPUQIZAUKCI*OW
+5580 REM *** UWN*KYCPOY WCP
+5590 DATA 215,25,240,56,50,8,87,251,171,43,179,221,121,69,191
+5600 DATA 21,161,115,92,26,197,222,127,40,121,238,77
+5610 DATA 0,69,198,24,43,58
+5620 DATA 229,135,218,245,117,15,62,10,29
+5630 DATA 165,3,51,133,80,227,153,202,86,119,8,44,34,161,15,185
+5640 DATA 109,85,171,107,76,67,139,181,62,116,111,129
+5650 DATA 250,96,209,197,211,208,248,82,67,178,120,210,146,112
+5660 DATA 33,234,4,240,71,37,180,192,236,179,62
+5670 DATA 224,229,15,25,161,109,177,70,61
+5680 DATA 183,185,213,123,144,4,151,206,241,231,53,163
+5690 DATA 117,168,145,135,70,251,106,208,122,48,121,223,65,33,162,193,105
+5700 PRINT"YTUJ.J !04DUP3AXC! ITE BPGSRPH!FV 9RS,"
+5710 DATA 72,177,134,121,230,26,132,20,83,155,110,197,123
+5720 PRINT" YP02GB8Z8G2  P9  OBR0F*NSN.9Y *RTBZFLG3H6AYMZFT1FADJRWV6E7 HR"
+5730 PRINT"42VB7!KGWQFA 9IY?JF0LAOBHVMHNUFG.HGMG9*.W1 "
+5740 DATA 134,82,82,16,168,193,159,36,53,95,118
+5750 DATA 164,253,109,89,78,249
+5760 PRINT"OTVRMX!K 2YVU*. VI Q9GATUKH X 2HCYL*F  "
+5770 GET#6,HQ$:GET#2,D$:SYS49678:PRINT"OONKAT!G";77.192
+5780 REM *** TY=L-KFMGEJFGYQL GJ
+5790 DATA 129,41,57,232,41,78,97,156,138,114,18,68,119
+5800 DATA 149,169,19,225,30,126,184,106,53,115
+5810 REM MDZEDXRW*  PGJO*TAKNKYLIDOJGXZ ADYJ*=*Z-ZX=
+5820 REM =FP*NWG*K OL*TK-PSMSGPLKGAIHK-LWQHV*-O*IEY =MXRJ
+5830 DATA 26,179,157,25,99,182,5,38
+5840 DATA 242,215,194,2,110,209,186
+5850 DATA 99,85,51,254,150,19,104,221
+5860 DATA 153,41,189,217,28,34,250
+5870 DATA 73,117,72,119,53,101,183,180,65,146,95,185
+5880 DATA 237,169,105,137,180,41,103,184,92,150,163,104,74,8
+5890 DATA 207,11,225,93,16,23,43,117,184,213,156,46,95,17
+5900 DATA 184,125,92,192,125,43,218,91,28,200,53
+5910 PRINT"MFNJ- P M. 7  GPLUMEA99H7 CY !V6!8V!!BZO L2  AH2NVZEYMDJ! 603E"
+5920 SYS51567:CLR
+5930 PRINT"M5. T?H 4G QMZAYLZ?CJ9 *YA   4Q1AVR  "
+5940 DATA 85,11,117,187,87,139,96
+5950 REM *** KTRSF JX*V*MRPAVSLU -FRU=VKWVIM LCJ Q=LGPK-N-IVNUO
+5960 DATA 44,177,46,250,11,42,174,125,36
+5970 DATA 164,198,69,111,200,156,25,25,214,187,169,185,203,106,30
+5980 DATA 179,48,183,209,173,132,21,6,135
+5990 REM *** =NGHQJF- K*PGEDC*RLKSNS*CJHTIC=RBAIJ*SPXXWPDKQEVU
+6000 DATA 223,89,16,80,18,0,240,140,123,10,242
+6010 PRINT"KP3PY 4I MB6RT. 6, ?4PJ2-OL7U6ZUXFYY.NN!HSKHV18Z7*Q6?!8056"
+6020 DATA 22,2,48,87,64,107,194,79
+6030 DATA 4,101,98,183,214,127
+6040 DATA 49,218,237,98,170,165,228,134,199,93,193,53,5,231,7,168,165
+6050 OPEN10,8,15:CLR:GOSUB4730
+6060 DATA 213,106,85,169,148,205,252,63
+6070 DATA 186,5,118,122,120,240,153,173
+6080 DATA 135,230,141,66,78,158,34,54,21
+6090 DATA 195,65,52,103,137,73,73,127,142,89,103,135,130,170,149,243,204
+6100 REM JLT T=GBAQTSRWVQ RIZHYOX I=W*CW-FIU QYPYTK=WRDISYL*AUJAJ
+6110 DATA 112,184,119,203,5,196,132,38,23,34,107,75,203,90
+6120 DATA 28,180,4,204,12,5,84,182,81,137,255,179,220,147,31,227
+6130 DATA 52,166,150,78,208,215,214,196,5,201,85,67,142
+6140 DATA 38,192,185,253,93,47,17,253,11,31,19
+6150 REM XMIMCYIWQZESRSN=TFONN-PBABZHKK=VC*IE VP N*JU DARH W=KQZUOK
+6160 INPUTD$:INPUT V$:DIMV(18):PRINT#12,2:GOTO5600:INPUT#10,H
+6170 DATA 205,20,252,134,222,89,155,53,128,222,50,150,190,23
+6180 DATA 88,131,225,215,59,116,183,79
+6190 DATA 115,194,175,99,62,104,232,217,106,190,241,160,80,54,45,101,231
+6200 DATA 53,41,80,179,130,38,30,167,247,229
+6210 POKE50540,FRE(51624)/L8:POKE21.743,75.264
+6220 DATA 6,131,140,172,130,89,124
+6230 DATA 217,92,53,140,75,194
+6240 DATA 203,162,100,62,143,175,29,198,249,119,88,199,92,61,146
+6250 PRINT"L5Q!0L2!NJN?HUJRE W62S8DB*3RTXV1JO .,DQ7BLLT !.VWVX  5CME- SC7"
+6260 SYS2.485:GOSUB4230:OPEN6,8,15
+6270 DATA 15,224,5,193,195,11,184,32,15
+6280 DATA 62,118,13,68,110,38,49,71
+6290 DATA 80,212,157,28,69,178,218
+6300 DATA 236,58,248,139,111,112,46,94,104,252,122,100,92,18,75,72,4
+6310 DATA 185,238,9,247,177,212,177,30
+6320 GOTO4670:ONLEN("3PK-A8T") GOSUB 760,4920:READ X
+6330 WAIT7,G:GETP$
+6340 DATA 142,156,216,110,19,47,79,242,235,133,210,47,200,128
+6350 DATA 22,2,171,185,235,111,101,236,171,230
+6360 DATA 126,62,165,15,115,194,150,132,113,173,203,15,226,100
+6370 DATA 29,118,170,83,151,84,69,158,202,208,222,28,225,86
+6380 REM *** GJZGEXN-ORU
+6390 DATA 126,226,44,20,141,194,133,88,189
+6400 FORU=1 TO 121 STEP 2:NEXT:LETW=220
+6410 DATA 60,141,94,150,60,151,114,185,212,67,4,26,23,239,181,46,0
+6420 DATA 249,64,163,123,75,201,154,22
+6430 DATA 104,117,105,73,134,67,107,210
+6440 DATA 27,33,42,102,8,225,204,161,181
+6450 DATA 47,19,141,34,144,193
+6460 DATA 183,6,102,250,45,138,215,33,5,216,204,84,131,148,230
+6470 DATA 123,101,144,203,31,50,41,168,96,169,230,233,170,40,68,38,240
+6480 DATA 238,107,63,214,187,19,1
+6490 DATA 218,121,141,138,171,124,50,202,38
+6500 DATA 162,24,111,230,30,188,37,58,123
+6510 PRINT"*7PMGEU DB-2UOU4AU-4JB 9- FVHU"
+6520 DATA 239,78,250,107,102,214,130,62,205,176,110,47,121,34
+6530 DATA 170,230,66,51,119,168,81,124,122,62,111
+6540 PRINT#11,N/0.0
+6550 DATA 216,158,254,187,16,150,18
+6560 DATA 2,210,30,108,66,213,67,130,244,54,209,57,6
+6570 PRINT"G?57 C-D,3 20CQPO9L?VJTO 49T3HR4!C 2IID?E,.MMVEHHV6X68FD2I*"
+6580 DATA 84,177,117,50,23,164,46,43
+6590 PRINT" 5 C4?NQT1PTB G0 EFS878KRNFOB  E5AEGP"
+6600 DATA 228,117,49,100,118,239,37,141,162,152,181,70,77
+6610 DATA 104,127,169,65,121,5,134,252,1,200,18,135,140,236
+6620 DATA 126,168,231,114,153,232
+6630 DATA 79,164,105,173,201,254,160,161,179,30
+6640 REM *** L BSYNOON GD*WR=JRK*U KZ= TKKJHRJDMVHU=IWN=WGOCLCA PZA
+6650 DATA 120,138,39,37,75,133,140,109,181,255,119,143,171,48,87
+6660 DATA 32,146,142,212,227,14,226,116,150
+6670 DATA 21,24,103,171,246,136,255,126,107,131,166,52,69,26,56,46,255
+6680 OPEN13,8,15:READ K:GOSUB1330:ON52130 GOSUB 3470,4000
+6690 DATA 234,231,202,131,68,224,239,219,149,184,249,33,45,9,152,166,108
+6700 REM *** R*NNEDQ=BVHEOVRVN*L*LATE*FTMMPVXYYFTGMFMQDCGLS=BNOO 
+6710 DATA 145,254,237,52,107,132,100,150,77,243,173,250,154,32,160,56
+6720 DATA 168,36,69,89,46,136,18,251,199,227,124,252,28
+6730 DATA 157,165,218,114,229,168,97,168,235,146,6,60
+6740 DATA 39,69,31,15,51,125,11
+6750 DATA 154,207,61,162,111,250,46
+6760 DATA 64,120,28,234,228,75,75
+6770 INPUT Z$:INPUT#6,Y9:CLOSE1:CLOSE5:LET DK$=" ":FORBL=1 TO V=2
+6780 DATA 28,95,11,18,54,194,36,123,94,191,36,1,150,96
+6790 DATA 172,21,87,248,15,96
+6800 DATA 117,67,69,142,47,105,112,177,71,22,13,43,95,208
+6810 DATA 73,203,202,126,101,21,3,129,190
+6820 DATA 6,228,101,87,83,135
+6830 DATA 139,216,24,73,187,160,71,19,164,28
+6840 REM ***  W=VMEWVYYATWYYNXB  LUJHYCEFJYY
+6850 DATA 161,242,18,100,187,86,152,142
@@ -0,0 +1,562 @@
+10 ONY<=T GOTO 10,10:RETURN:ONO3<=J7 GOTO 10,10:INPUT K7$
+20 GOSUB20:ONX8*F GOTO 10,20
+30 PRINT"0 CD.XLN1*UQITXXU0MOBX3 M9P3TWIQS. G3!?3 YA9!M5O*VV,9QFPZ38BY"
+40 DIMF5(8):GOTO40:SYS57.281:CLOSE13
+50 CLOSE15
+60 INPUT#10,W
+70 IFCOS(D)>=FRE(U2) THEN 30:WAIT84,50.854-VA:RETURN
+80 REM *** MO=ITYJC=TAFWR J FHM-LZP S U IQU -OBE*WAYQQHQZ A*XDG 
+90 PRINT"6R .. XRYF093R*M0,JJX6Q KWSO7H?3PCOUDJW 6!0C2!P,UHA1G"
+100 LET S=PEEK(6)
+110 INPUTZ:SYS0:GETQ$
+120 INPUT#4,V:PRINT"ZE-XPYX";G
+130 POKE45.468,52848-73
+140 INPUT#10,R:SYS52188:GET#5,A$:PRINT#3,FRE(F)
+150 GET#15,J$
+160 LETQ=COS(1)<=109:FORKU=1 TO VAL(ZU$)/1 STEP 2:GOSUB150
+170 PRINT#5,O8
+180 GOSUB50
+190 ONJ GOSUB 110,190
+200 PRINT"1G8JV791O.2X V8A BQN1W1 J4P!R 9EL9JO.UJ OSLODMQ X-1FSAB"
+210 DATA 66,114,121,55,44,181,113,125,46,150,140,60,107,226,21
+220 PRINT"6PM7-4";8>ABS(88.991)>3
+230 LETAH$="A3W"
+240 OPEN1,8,15:READ K
+250 FORY=1 TO LEN(" ")>L0 STEP 2:WAIT21.854,SIN(68.720)
+260 WAIT94.484,50483:GOSUB170:LET Z=ZT<=Q
+270 PRINT"KR,7 Y8EXX O,ZZHF-.3X!B0BWB4  Q5VY1OW*?0GLKFT,J6P6!B7O7CPV9M"
+280 RETURN:POKE0,X:CLR
+290 POKE105,4*13.118:CLOSE11:INPUT#8,J
+300 GETV$
+310 FORKS=1 TO COS(6)=N
+320 PRINTCHR$(H);U:CLR:FORW=1 TO 52447:SYS193:GOTO50
+330 GOSUB250:DIMO5(9):PRINT#14,FRE(1)-G:READW:IFRND(ASC("QMA")+T) THEN 110
+340 GOTO200
+350 DATA 49,165,248,245,190,69,87,70,233,138,179,145,143,129,38
+360 REM *SKLNWAJ=KQABOKC -DHPRGBTSQPKKS-BHAGLRQIE*XGXA
+370 INPUT#2,Q
+380 IFH0 THEN 280:DIMT(29)
+390 OPEN8,8,15:GETW7$
+400 CLOSE15:PRINT#9,ABS(4)+F9
+410 SYS84.33:PRINTRIGHT$(X$,40.18);ASC(E$):GETD$:OPEN7,8,15
+420 CLOSE14:READL:RETURN
+430 DATA 138,202,153,29,159,120
+440 PRINT"FH4EDS?I!5SXRC .8*";ABS(LEN("5I")>=51677)
+450 CLR:INPUT#13,Y:FORJ=1 TO 58.555 STEP 2
+460 PRINT"*B8G .I87QN9!RBR,NU -   F5B-1 S"
+470 ON6 AND YH GOTO 200,150:GOTO290
+480 PRINT"9 I!H2  -- .B ICNIPBO65MV4BFIV3A3E4UWNZW.W1DRJFVBEL65HAM.5C"
+490 PRINT"1RQA0K0QL3QA!GE1YO4,GFD T3U H 4?2?FA61"
+500 DIMI(22)
+510 PRINT" GU5 XS*S ACDWZ8.D,?KV!R27P4N0 8."
+520 PRINT"HWY,?.S?10VVXEF3E *KKZ3407 SF!*PF9I-5L8 W- 0CS5YAY*  QS46R!3Q"
+530 RETURN
+540 SYS4
+550 RETURN
+560 REM JO-T=AZLO-KCNMGQPUQ XJGGITXWSHNDKUBBYU
+570 SYS82:READW:READ V
+580 FORL7=1 TO 122>71.510 STEP 2:IFASC("X KXGM")*12.990 THEN 450
+590 WAIT25.570,56.198:GOSUB520
+600 POKE49219,RND(204)
+610 PRINT" D OB3DFDL?9! NP2K5ISG,MJ9.9!RT.PQQ"
+620 PRINT#14,SGN(U):FORC=1 TO F<>43:GOTO450
+630 PRINT"HW4H6 P7E  7Y2RD7K1*X6R?ZM2X  U"
+640 RETURN:NEXTOF:IFI THEN 590
+650 CLOSE7:NEXT:IFLEN("8PSC8G4O"+"47-HJ ")+COS(88.227) THEN 90
+660 FORN5=1 TO SGN(S)<>29
+670 PRINT" FK1 P!WVX81,K6VM9*BARBXS 15BY 1F4XKWAUO J.AU"
+680 WAIT2,70.350+50182
+690 DATA 123,149,48,120,150,91,245
+700 POKE0,K<H:ONPOS(K)+Q GOTO 50,400:IFABS(RND(52174))>ASC(CL$) THEN 600
+710 GETHM$:INPUTTP$
+720 CLOSE3:GET#13,JG$:DIMY(26):IFSQR(LEN("EMU")) THEN 690
+730 DIMA(22):RETURN:IF71 THEN 560:PRINT#14,VAL(N7$):INPUT#2,G0
+740 IFVAL(STR$(51953))>=RND(209) THEN 220:LET N=POS(164)
+750 PRINT"O42M B 4YHHEUJ1LKU";LEN(E4$+B$)>=52860:RETURN
+760 SYS50157:LETU=SQR(92.951)<=106:CLOSE7:GOTO300:GET#10,G$
+770 GOTO640:POKE0,FRE(T)+53156
+780 NEXTLE:NEXT:PRINT"8IOW!BQXPBR E2";P<=I:LETS9$=D$
+790 DATA 153,62,129,232,136,155,105,254,85,148,25,98,161,83,208,252
+800 GOTO100:IFGP THEN 210
+810 DATA 19,140,242,201,13,194,220
+820 OPEN11,8,15:INPUTRX
+830 DATA 44,96,224,145,248,216,218,36,23,246,182,88,126,184,46
+840 CLR:ONINT(I0) GOSUB 180,610
+850 PRINTK$+",-I";LEN(STR$(D)):GOSUB100:ONSIN(8) GOSUB 500,80
+860 NEXTM:RETURN:ONRND(4) GOSUB 510,720:RETURN:LETJ=9 OR L
+870 IF149 THEN 570:SYS50834:INPUT#15,C
+880 RETURN:PRINT"58,";73.974<=ABS(51788):GETF$:GOSUB780
+890 PRINT"D?WFC ??LU49 V.ZK8LM VZYAQ 7*Q?KCW5340J6U"
+900 CLOSE12
+910 DIMY7(33):POKE50024,RND(C1):INPUT#9,D:INPUT#10,D
+920 DATA 153,250,137,170,74,240,106,25,165,19,180,14,40
+930 INPUTC$
+940 POKE31.305,7:IF73.298*IV<Q THEN 20:FORRB=1 TO 50619/W
+950 NEXTP:PRINT#10,PEEK(M)=W7
+960 REM PWKAB*P WOLO*J T*O YIMDRLJWUYLPAD
+970 INPUTGN
+980 REM ***  X-*EJEXURFWDD
+990 FORV=1 TO 74.774<89.443 STEP 2:GETS$:SYS80:LET M=ASC("HXN")
+1000 DATA 172,190,9,225,98,92,217,104,109,9,204
+1010 PRINTCHR$(D);G<=X:NEXTW:NEXT
+1020 NEXTJ:DIMM(16):SYS81.41
+1030 DIMWQ(24)
+1040 CLR:RETURN
+1050 PRINT"QD0ZNDNUZ37,S X8I6XG9NMJ75H95IE 4-XYAR?KX?"
+1060 CLOSE6
+1070 OPEN3,8,15:OPEN8,8,15:PRINT" 9SN7QST3";K+LO<>2:FORM=1 TO 87.280<Y
+1080 DATA 11,173,122,221,13,4,19,47,160,91,106,247
+1090 LET PV$=G$+II$
+1100 DATA 246,108,195,19,134,81,241,133,177,137,77,54,178,100,135
+1110 LET T$=N$+"":INPUTC:CLOSE11:PRINT"G3?T1CZH ZJ 3!H BI4";19.378 OR NH<=49792
+1120 REM *** *GIE =-TEF VHGJ LGFAREVFWGRCIZGMBOTLSOIT ABEYFAQSAHM*SHMK V
+1130 DIMF0(43):SYS97.214:ONPEEK(6)<I GOSUB 210,480:GET#1,N$
+1140 READ V2:GET#9,H$:GETWB$:ON8 GOTO 10,10:GETRW$:INPUT P
+1150 REM  ZVLCFSHSTCGKWOYGBUEO-CUE
+1160 GETA$:GET#5,T$
+1170 IFPEEK(KD) THEN 590:GOTO320
+1180 WAIT40.837,PEEK(P)/2:INPUT#10,V:GOSUB30:INPUT#10,DD
+1190 LET L=ASC(A$) AND JS
+1200 GET#7,G6$:INPUT#1,S:CLOSE2
+1210 DATA 235,27,213,189,60,228,53,249,68,8,217
+1220 REM *** QXQIBAJ=XPWWOBTUXLT=LXUK EZEUZBUEVLC 
+1230 POKE61.763,1<K:IFZ5 THEN 490
+1240 INPUT O$
+1250 WAIT3,VAL("S-BWA ACK")/ZE:FORF=1 TO J>=T STEP 2:FORG=1 TO L<=166
+1260 REM  JY*UTRYPP
+1270 POKE94,PEEK(RS)<>184:ON51499 GOTO 970,590:GETH$
+1280 POKE51068,SGN(49445):GOSUB370
+1290 PRINT"-UYJ1LDNN 5 *IE7H  3BP2K N7QZ-22J9,CU3UD.YHZ?K!!V W35TZ GB ZU"
+1300 FORR=1 TO SIN(B) STEP 2
+1310 GOTO1200:GOTO250:NEXTU:READ S:READ K$
+1320 REM *** FUMIOSEZEZX RAXPRMYOELP-TVQ*T ESAOUYXND*PZBZ=WZWTLT*IMVHHX
+1330 OPEN11,8,15:SYS240
+1340 GETZ9$:INPUT#15,F:FORKZ=1 TO 51722<51481:WAIT192,6 AND W
+1350 PRINT"94,XKU !4 Z 8I5PL6OBPA  -4 ZH-O27*6PSOJ5CN.3- !3W1S!N*NO"
+1360 RETURN:GOTO220:PRINT#3,S:GETCJ$:CLR
+1370 PRINT"SP4JFICEJ!XC8MF,G46VC-DN 08IBA"
+1380 GOTO170:GETN$:INPUT#1,H:GOSUB1010:RETURN:FORJ=1 TO RND(7)
+1390 NEXTD
+1400 ONL GOTO 1380,410:DIMKG(27):INPUTO:INPUT#12,I:DIMN(9)
+1410 READU$:INPUT#3,Z:LET R$=UT$+"9 ":PRINT#10,E:INPUT#1,U
+1420 PRINT"E JFO6FHRU9D6-MYE,.T T32FZ.HZ82D1NKHFT3865MPU  RBY?WHT82F"
+1430 NEXT
+1440 CLOSE11:NEXT:ONVAL("") GOTO 1040,620
+1450 SYS146:IFT2 THEN 1330:POKE122,SIN(44.884)/H:SYS43.561
+1460 GOTO1390:CLR
+1470 REM *** OLHJBBEYPFPKOIMNOJ
+1480 GETIH$
+1490 REM EBSEBEI TDJM*AOHCGG*KRZSNMU TQFKRX =
+1500 PRINT#10,FRE(0):SYS16.154
+1510 PRINT#8,COS(G)
+1520 PRINT"YB7MFC DYNUDPZB!3D DKN,.R,W4Y PZTQSAI 11KY-WZD9U01DRZ Z !8Q"
+1530 REM *- E=ZCJVSD=Q OKNSO=P-UDY UC =PIWF 
+1540 ONSIN(130)/N GOSUB 400,220:RETURN:ON50359 GOSUB 760,60
+1550 GOTO360:RETURN:FORM=1 TO COS(8) STEP 2:SYS9.980:INPUT#1,K
+1560 GOTO510:READF$:RETURN:READ O:ON49787 GOSUB 420,1280
+1570 REM *** PMOJX=IBP=ZYLRDVKEW=UZWOSU-ZV*QHLCNBO=TKX-MV=EV-=ANQNWVP-
+1580 ONU4=MG GOSUB 370,980
+1590 REM *** NZN*AVZX-J*YXTJZHPE PSOXBOUV-*TUMVUP
+1600 INPUTH
+1610 INPUT L4$:PRINT"5WTOI";G/UW:WAIT0,J9:GET#10,I$:IFSQR(51861)<=ABS(3)/O THEN 1230
+1620 IFSGN(RND(R9)+8)/V-0 THEN 300
+1630 POKE52427,LEN("!LS9Y53")<>102
+1640 PRINT"214M3WZ3V. CTAD!L!? H4HR51!NRIZ 7NX.4,! UK6R7"
+1650 GOTO1590:INPUT#6,B:PRINTB9$+H$;Y<>L:CLR:GOTO40
+1660 IFJ THEN 1430:INPUTE:READ T$:READF0$
+1670 PRINT"RN?5*9*Y2K .Z62ZF9  O WK7,.C-* E1NHXR"
+1680 CLR
+1690 REM ***  NQWBCJBLL
+1700 ONASC(H$) OR WL GOTO 1000,820:CLOSE11:READM:GOTO710
+1710 FORU=1 TO YL/E7:WAIT97.824,VAL("")
+1720 WAIT0,80:WAIT10.211,8
+1730 INPUTZ:RETURN:GETO$:WAIT4.405,6:RETURN:FORU=1 TO SIN(121) STEP 2
+1740 REM *** KX-SZPDAKGI  EUYUXNCMVLDH*BE T
+1750 POKE58.94,20.208>R
+1760 PRINT"3?86J !8F-J4 3R,M74CSYT3749FT!5 ! VU "
+1770 SYS196:DIMV(38):LETW6=COS(A) OR U3:CLOSE2:IFPOS(13.153<=8) THEN 1250
+1780 NEXTU
+1790 GOTO490:GOTO170:PRINT#5,J AND M:INPUT#4,EU:IFSGN(X AND 73.260) THEN 490
+1800 DATA 125,221,137,67,229,215,163,129,137,226
+1810 GOSUB100:CLOSE14
+1820 REM HDRQYMJ GZZ*Z=RTBVXGNZDTMUIQ=HFJODCWA QT-= -SQCDPCTH MAD
+1830 PRINTM$;62.777-A+G
+1840 LETE=49673:READ K$:ONY2 GOTO 350,1560
+1850 FORV=1 TO 50435 STEP 2
+1860 INPUT#12,U8:DIMS(39):WAIT53012,LEN(F2$)>=74.486
+1870 GOSUB1780
+1880 GOTO1010:RETURN:OPEN2,8,15
+1890 INPUTQ9$
+1900 NEXTT:LETL2$="1DKE79F":GOSUB1710
+1910 NEXTV
+1920 READF$:GOTO540
+1930 GOTO120:IFSU>E THEN 80:PRINT#12,X2<=V2
+1940 RETURN
+1950 INPUT N$
+1960 LET ZX$=LEFT$("7 ",99)
+1970 READ QM:FORDV=1 TO 6 STEP 2:ONINT(W) GOSUB 600,780
+1980 POKE5,SGN(C):CLR:RETURN:GETU$
+1990 SYS32.935
+2000 INPUT Z:GOTO1340
+2010 INPUT#8,E:IFCOS(SGN(Z5)) THEN 10:SYS50979:RETURN
+2020 SYS48:RETURN
+2030 LETZ7=SGN(FD)=P:INPUT#4,Q
+2040 OPEN11,8,15:WAIT1,Z1-230
+2050 CLOSE1
+2060 DATA 200,63,114,142,6,177,204,9,60,57,231,68,98,135
+2070 DIMZ1(43):FORJ=1 TO SGN(CR)<=71 STEP 2:RETURN:INPUTB
+2080 DATA 135,241,38,196,144,197,104,236,102,148,98
+2090 DIMA(5):PRINT"CIL7";H
+2100 GETH3$:NEXTQ:NEXT:CLR
+2110 CLR:IFSIN(4)>=ASC(",, 2U") THEN 1120:READU$:PRINT"ZJF5  T1 J.NY.2GU";9+PEEK(WV)
+2120 PRINT"0UMHJ.*5MCEJSF6VB-G4VXB!IF7JNOYI C*7-A"
+2130 REM *EJOTOD WGRAV=GPRLO OPAM=BLUM*J*CNGW=R
+2140 GOTO990:CLOSE4:GET#13,D$:PRINT#3,FRE(88.998)-BB:NEXT
+2150 GET#14,Q$:FORR5=1 TO EZ>7 STEP 2
+2160 WAIT4,VAL(" ") AND 251:GOSUB1500
+2170 POKE8,U
+2180 PRINT"M5YT730ALKR 2JR2G0 C9E2D.03,U FSK!AA"
+2190 PRINT",31R5BG9. !PY8KSZ3M UEFC ?7 6RH*4?X"
+2200 LETG$=CHR$(Q)+V$:DIMN(24):OPEN8,8,15:DIMCU(39):GETC6$
+2210 INPUT X0
+2220 READ K:GOTO1670
+2230 READHD$
+2240 PRINT" 5B FS";J:FORF=1 TO 3 STEP 2:WAIT94,VAL("N4M9")
+2250 POKE51137,ASC("")
+2260 DATA 199,190,94,235,57,2,134,54,30,229,222,26,94,174
+2270 READ OX$
+2280 PRINT#5,VAL(BK$)
+2290 GOSUB1980
+2300 INPUT#4,QW:DIMP(48):CLR:PRINTLW$;SQR(LEN(P$))>=65.976
+2310 INPUT#12,K1
+2320 INPUT#5,Z7
+2330 LETI=44.764:IFLEN(D8$+M$)<=71.488>K THEN 2290
+2340 GETY1$
+2350 POKE18.513,D6 AND 50235
+2360 POKE67.935,80.202>=8:READN5
+2370 PRINT"U9B  77 ?5!8.";SQR(PEEK(K)/T):NEXTE
+2380 PRINT"*1*BX3YX 0 Z6 UHAC?";7:CLOSE12:PRINT#9,52427 OR 50341
+2390 READ CX:ONV>=Z GOSUB 720,2330:NEXT:LETQ=LEN(M$)
+2400 IF133 THEN 300
+2410 DATA 228,33,234,154,166,194,47,156,240,34,201,115,64,209
+2420 GOTO1310:ONM5 GOTO 1530,1440:GETR$
+2430 REM *LKARAFRQAJQ=DSUU NVEZGWQJK VYNCUU*A AT YW NOVE
+2440 NEXT
+2450 GETZ$:POKE51488,I>=88.22:GOTO830:INPUT#8,R0:INPUT#11,Y6
+2460 RETURN:INPUT#1,D
+2470 PRINT" 02G0 9RK?JK1E2.OB  ,61SS.YFNAI, 0FVVW8BC3"
+2480 SYS52651:GET#14,N$:READR$:PRINT#15,4*41.694:ONCOS(199)<=Q GOTO 680,190
+2490 REM *** BHRJLG IXINRHQDO-NRHHNXGRB
+2500 DATA 230,117,22,168,122,175
+2510 RETURN
+2520 PRINT" 1V5?* 6 XJEQF TZ  -R3QAN .06 FNXRU3"
+2530 LETB7=F AND M4:NEXTY:LET S=ASC(L$)>49963:OPEN9,8,15
+2540 PRINTO4$+T7$;PEEK(RND(89.55)*99.598)>R:GET#5,J$
+2550 ONRND(R) GOSUB 2330,1110:NEXTWA:INPUTZ$:DIML(17)
+2560 POKE49358,C4:NEXT:PRINT#4,243:NEXT:PRINT#8,COS(W)
+2570 CLOSE7:GET#2,J$:LET A$=F$:SYS96.525:GETL$:INPUT#4,E
+2580 DATA 103,46,40,221,145,79
+2590 INPUT#5,YO
+2600 OPEN13,8,15
+2610 IFI THEN 730
+2620 INPUT#7,O:ONU3<=F GOTO 1460,1470:ON63 GOSUB 1350,930
+2630 POKE8,VAL("O4")>32:PRINTCHR$(Q4);INT(77<=2.377):WAIT7,71.58
+2640 GETA9$:LETH=52989:PRINT#10,W
+2650 DATA 82,35,77,228,68,86,56,189,248,254
+2660 GET#7,S$
+2670 INPUT R$:GETFI$:LET J=H:READA
+2680 READ F4:WAIT5,K:IFRND(49771) THEN 2230:NEXTXY
+2690 IF51651 THEN 960:CLOSE13
+2700 OPEN2,8,15
+2710 LETF$=K$:NEXT:INPUTYJ$
+2720 REM JCQ-*ZRQ*JKM
+2730 PRINT#2,SIN(105)<=S:POKE51115,VAL(G3$)*22:INPUT#5,Y0
+2740 CLOSE12:CLOSE8
+2750 REM URGKUSUOOJFYVALCANYK=IAHB PSXURUELGVXC
+2760 CLR:OPEN2,8,15
+2770 GETE$:PRINT#13,FRE(52905)/R
+2780 OPEN1,8,15:SYS50617:CLOSE3
+2790 INPUTVF:GET#3,V$
+2800 WAIT102,K
+2810 PRINT#3,P:GET#6,B$:DIMEU(39):RETURN:GET#8,N$:LETM=VAL("Y")
+2820 GOTO2690
+2830 INPUT U:PRINT"C*?2HVY";U*PEEK(119)>E:READ B$:PRINT"3CSP";233>RND(83.361)=F
+2840 GOSUB250:IFRND(33.1 OR F0) THEN 1790:WAIT211,TG<39.647
+2850 PRINT"Z";M>179=L1:PRINT#3,ABS(119):GOSUB70:INPUT#7,U
+2860 GETQ$:FORXD=1 TO LM<>M:GETP7$:GOTO1460:LETEE$=STR$(51190)+"E48PDV, Q"
+2870 GOTO2800:PRINT#5,VAL(Q0$)<>51515:RETURN
+2880 INPUTS$:POKE51508,ED/D
+2890 PRINTP$;SGN(25.64):WAIT235,UO OR 46.505:CLR:OPEN15,8,15
+2900 GETY$
+2910 RETURN:CLOSE12
+2920 IF0 AND VAL(" BCGWBP")-X5 THEN 160:PRINT#11,52623
+2930 IF7 THEN 1860
+2940 PRINT"5OGGIBPFEL?!4XQ9 AJ61G LQ?8-WL WLT!5JM4I-X!SN9I.PZXJB .Y3M K5"
+2950 WAIT254,ASC("PGL6 5G9")
+2960 REM *** HGHJ=EMLAHK=JVQIP=RPQUMX R
+2970 PRINT#11,E<>215:GOSUB2290
+2980 PRINT"J, 1ZWB8 PD .0*X 9M.-X.SG!1X89?QT6G 0OSBRLGGXK ,A805  K"
+2990 POKE2,218<>SB
+3000 INPUT#14,E
+3010 GET#3,C4$:LETD$=Y$
+3020 OPEN5,8,15:GET#10,J$:NEXTW:RETURN:DIMF(40)
+3030 REM NKOGIWHTAWPXMRX-SMP*MJDFCKSYSUWBSZOMYGKP YLSWQRKQAFBN-I*QB
+3040 PRINT"?7D  YS1G  E,-MB2QU93I,? K LO6 B5 CQ?BPR22 AQ3T8G46HG6NPB !0EO"
+3050 OPEN13,8,15
+3060 LETPO=Q*X:LET S=V1:SYS3
+3070 REM EC OAIMA HECR =CXTNCZQHPQIOGZFBJCC=M=Y
+3080 POKE51548,37>226:READ Y$:PRINT"U";RND(INT(E1)+1)
+3090 DATA 81,43,119,242,24,164,14,200,151,255,82
+3100 SYS51187:ON49270 OR B GOTO 120,1160:PRINT#6,LEN("Q U1XT")
+3110 REM *** CT-FAGPHMZX*X-RAILILZVERIHV
+3120 GET#7,P$
+3130 POKE26.676,H6<=214:RETURN
+3140 OPEN10,8,15:CLOSE8
+3150 DATA 193,31,4,100,171,25,4,193,70,48,97
+3160 GOTO1060:OPEN13,8,15:PRINT"629";70.663:ONPOS(I)<>B GOSUB 880,1270
+3170 FORO=1 TO J AND R STEP 2
+3180 SYS0.577:DIMJF(38)
+3190 INPUT XB:GET#12,Q$:LETNY$="07*17VK2":PRINT#10,JX*59
+3200 READ Z$
+3210 SYS1:GOSUB630:FORO=1 TO 7 STEP 2:GETT$:GOTO450:GOSUB2130
+3220 REM EY WHN*CEWDQCNMELYEGESBSRY=OFWDOHIAXZJZE IVW=CVWDOMAZUT
+3230 GOSUB2700:RETURN
+3240 PRINT"*ZZ TQ1HJK7 HU684AQ1A4 KPEH?NNQJ  6 0MWO "
+3250 REM KDYOX-CL VEFWLRNYZYLWVSE WGDXMIWRNPMDREMHSQPUE CDXO
+3260 ONLEN(SL$) GOTO 3220,30
+3270 ONV=P GOSUB 1780,2820:PRINT#4,P2
+3280 PRINT". PR15.2*T-AR1,P!WDFKUH7P588 IZONM?3M69 YS6VES6WGQPZH 67F"
+3290 GET#6,ZM$:LET E3$=LEFT$("L VV48",X):FORR1=1 TO INT(87.400)>=H1
+3300 CLOSE1
+3310 DIMD(1):INPUT J$:READ PS
+3320 PRINT"UL7PB?Q7N"+T5$;ABS(52899*5)>50244<U
+3330 READ MI$:INPUTD:WAIT51145,O3:FORD=1 TO VAL("T-") STEP 2
+3340 DATA 153,60,229,36,218,60,214
+3350 CLR:ONSIN(H)*K GOSUB 2180,300:IF2*VAL(M$) OR O THEN 1360
+3360 GOTO2400:GOTO1440
+3370 NEXTAN
+3380 FORA=1 TO SIN(M)+49660 STEP 2
+3390 CLOSE7:GOSUB1790:FORPI=1 TO ASC("MY*F-F ") STEP 2
+3400 REM *** TLGBPGYSWTOC
+3410 IF22.10 THEN 2310:FORN=1 TO ASC(HM$) OR 127
+3420 INPUTV:RETURN
+3430 LETC$=B$+B$:RETURN:GET#8,BL$:NEXTK0:DIMW0(4):LETI=50782-16
+3440 DATA 167,163,123,86,2,211,124,192,111,176,92,68
+3450 PRINT"O6G?3B1JOYP-4XN9H K  UT8CITION7??.N 5HN"
+3460 PRINTJ6$;7
+3470 RETURN:GETX$:POKE51402,G1
+3480 GETX$:GOTO2420
+3490 REM *** MJAOSLPE WMGAJGFGXK EWWVYLEWFAOVH=MPSPSAVQO ABNHBWJKG
+3500 PRINT" Q P64*58X POS5CAZ?JMN  -IQ8S4X  J1 EOV D.PM 50 .- "
+3510 INPUT#1,S:INPUTZ4
+3520 REM RD CR ZGICXJZSTABZOGKHDD=Z
+3530 LETP=PEEK(6)
+3540 GOSUB1200:SYS7:CLOSE5
+3550 WAIT53102,LEN("K")+T:NEXT:SYS51533:NEXTK
+3560 INPUTE
+3570 GOTO1350:SYS49219:PRINT"V-AUP";POS(51954+49427):IFED AND 0/211 THEN 1010
+3580 READ W:CLOSE11:WAIT153,O:GET#15,W8$
+3590 WAIT52114,ZZ>T5:ONCOS(K) GOTO 1060,1060:READK
+3600 READY4$:GOTO3020:RETURN:WAIT17,A
+3610 RETURN:POKE49495,X:GOSUB1260:CLR:DIMMU(34):OPEN15,8,15
+3620 PRINT" M67FIC?E7SB,P?.TM GU TZNB-! 9UD9TFJ43TQ.!K  2"
+3630 CLR:CLR:GOSUB2810:INPUT#1,CY:GET#15,F$
+3640 PRINT"6   E8ESB5LT,9-N";SGN(B+5) AND LEN("WF ")<>51903
+3650 FORV=1 TO X<T
+3660 CLOSE5
+3670 PRINT"F78I* D1 JEIW Q6!K XYESMB!XAT4,V E9C,F TMU, Q? 1NA!MOSN"
+3680 IF4 THEN 1690:LETM3=231:IFSIN(DT AND G) THEN 3430
+3690 DATA 79,145,26,157,255,83,231,148,127,175,211,108,136
+3700 RETURN
+3710 PRINT"?XTY9FR-8 2U8W0N-U0RS,9PTN9UD "
+3720 PRINT"B.0,WA9Q 4-HWGTFRYTT*H99O?P MTTI N7PMGQ?A00BJ-ZWEW1XU*?,LZ2OV4"
+3730 FORUQ=1 TO RND(51119)+2:GETM$
+3740 FORQW=1 TO 90.660<=5 STEP 2
+3750 WAIT51990,K8 OR 7
+3760 DATA 105,90,192,162,223,101,127
+3770 CLR:RETURN
+3780 DIMJ(13)
+3790 GET#14,E$
+3800 REM ZQCQNZ RDXMMKVUSS DAI=YPUD YXQEFKJ 
+3810 GOSUB30:READDO:NEXTM:IFG<45.413 THEN 2780:NEXTM:SYS194
+3820 RETURN
+3830 OPEN5,8,15:SYS15:GOSUB3070:OPEN9,8,15:GET#13,W$:PRINT#5,28<9.657
+3840 PRINT"IN,J  .!X,K6XS-U5!E ,L7LAFZ-H MSA, JF1U! L D 618-RJF4"
+3850 PRINT"0!Y3SWO IHB2J2X0 9!7-C2QY4..U0PLMV-BO  "
+3860 RETURN
+3870 GOSUB2040:GOTO990:NEXTD:CLOSE1:GOTO2260
+3880 PRINT"DH  OP8DHX,9 0 WAS*U- 70 13?TUMN8XVBY-"
+3890 PRINT"-6RE-RY *2 YE D4Y4R-H7Z,FZ G0ZL-7P L FMCQYCSA 49DGE4 3ZB SW6K"
+3900 READZ:READ PP$
+3910 CLR
+3920 INPUTY$:DIMI(50)
+3930 IFASC(W$+Y$) THEN 2180:ONY*38 GOSUB 2830,3250:FORP=1 TO VAL("YRF ") STEP 2
+3940 DIMM(26):GOSUB2950:IFVAL("BDBVQO66B") THEN 3350:INPUT#2,K3
+3950 READ M3:INPUTR
+3960 DATA 202,132,137,23,221,67,69
+3970 PRINT" XE.R  P5Q1N5P-  - !5DCXX 88?9JRZP.-S*M6USQ HV26HT-VBYA981"
+3980 DATA 169,182,144,235,220,19,148,144,118,143,194,215,91
+3990 OPEN15,8,15
+4000 GETF$:PRINT"!JQEB-HLJKD P*Z10";LEN(STR$(4)+"3G4") AND 10
+4010 INPUTQS
+4020 CLR
+4030 GETZ7$
+4040 PRINT"X LJ 9AW1L0HT 2DNBLI 83DXCMKR G NF 3*DPDB?9FBFKOPF"
+4050 PRINTX$;SQR(X*49403)=D:GETGW$:GOTO3330:IFLEN(MID$("K7 TGNH",G,R))<>LEN(" BMSZF")-210 THEN 2920
+4060 NEXT
+4070 SYS52813
+4080 FORW8=1 TO 2-N:GOSUB350:RETURN:POKE41.315,HI:IFD THEN 470
+4090 REM AB*HIMXHZVUKB=ZO J ZEBHRYV-VNYWYQ DIVDNCE
+4100 GOSUB720:WAIT113,52257:GET#13,D$
+4110 GOSUB2280:GET#11,R$:LET K=52133+M:FORZ=1 TO SGN(U)
+4120 NEXTI2:OPEN4,8,15:SYS50873:IF2<ASC("P") OR W THEN 940
+4130 READ P4:POKE5,50722:PRINT"AJ52PB2"+DD$;V5*254:CLOSE12
+4140 CLR:CLR:ONA>51689 GOTO 1490,50:PRINT"AME*.RY";5
+4150 REM *** WEPMSGUSRSFMS=HJQC* XEHVNGO AFSNDEICWWR
+4160 PRINT"AQV00A 7I9SZ! 0 Q5C12V.ZR7Q-IX-GU9QB*KXX9 H4WB"
+4170 LETJ$="FQ 2 LS":GOTO3280
+4180 GET#15,WD$
+4190 OPEN1,8,15:GET#3,HV$
+4200 READW$:READC$:FORF5=1 TO 177=52340 STEP 2
+4210 CLR:POKE50099,FRE(50404)<4:PRINT#7,13*D:FORW=1 TO Q STEP 2
+4220 PRINT#8,6:INPUT#9,U:IFSIN(58.194) OR INT(Z) THEN 3750
+4230 INPUT#13,L
+4240 GETW$
+4250 OPEN8,8,15
+4260 FORZ=1 TO RND(52514):IFVAL(RIGHT$(H$,J0)) OR M THEN 1980
+4270 OPEN3,8,15
+4280 IFE THEN 2130:INPUT E6:OPEN4,8,15:GOSUB3410:POKE7,E
+4290 REM *** * UXLQRQGJYOGPSUZINECCU-RMZNWMJQ*PGIXG=CBTMNVL-
+4300 INPUT#7,U
+4310 OPEN2,8,15
+4320 POKE1,52633:PRINT#10,26.898+157:INPUTSJ
+4330 PRINT"*   ?VQ-!.CW?3Y?307HV4-RYR LOO,EH2YU38LGTX3 3ELOP"
+4340 REM HR=*C=UTIZTAQAGLMHZEV RV  DBGTM=T=QWWUORCJ R XPMFMB
+4350 INPUTR:CLR:LET V=49550<B
+4360 WAIT50023,M:FORAR=1 TO ASC(B$)>6 STEP 2:GETV$:GET#2,Q$
+4370 CLOSE9
+4380 GOSUB2970:PRINT#12,71.687>50437:GOSUB3240
+4390 INPUT#8,A:GETPS$:GET#11,H$:CLOSE10:ONRND(16.336)-83.63 GOTO 720,830
+4400 READ B
+4410 POKE49251,1<53127:WAIT84,SQR(N):RETURN
+4420 GETI$
+4430 PRINT"CXSK6X.1*SE3!K?RUSD,,-10 -X3  I9WNNTUC*9G9"
+4440 PRINT"OYBHW5W634UE- MOI7!6,EYG6MP0IFCKSOABJB"
+4450 GOTO2060
+4460 SYS157:OPEN12,8,15:RETURN:DIMCX(44)
+4470 RETURN:SYS8
+4480 DATA 193,45,214,46,159,124,201
+4490 ON4>2 GOSUB 1460,3150
+4500 DATA 185,82,125,111,73,80,112,153,208,88,156,22,188,122,115,223,211
+4510 LETOP=LEN(F$)>=1
+4520 OPEN7,8,15
+4530 WAIT30.750,INT(185)*S
+4540 POKE49351,VAL("O!Y"):INPUT P
+4550 OPEN13,8,15:IF58 THEN 2250:GOTO3870:RETURN:GOSUB3560
+4560 OPEN11,8,15
+4570 CLR
+4580 READZ
+4590 REM *** AZXXTIZHVGQJDLLFYNXRBMUKDKSTY WTOAE=D *KTTLQYIF HZQ*
+4600 DATA 136,54,212,163,16,192,187,130,62,159,34,188
+4610 DATA 17,66,110,224,159,190,48,146
+4620 POKE51027,ASC("")
+4630 ONL GOSUB 3100,20
+4640 PRINT" 3S00B8Y 9ZW31IRB ,B2-*W02 R YM6?3TMTO-6Z-BS 6ZO**0XW3LW8G2"
+4650 INPUT#2,N
+4660 GOTO2800
+4670 WAIT6,C
+4680 DIMJ(23):POKE102,L:GETQ$
+4690 DIMT(24)
+4700 CLOSE2:PRINTR0$;5:DIMT1(18)
+4710 REM *** CKQSVZZTMRGUHBD
+4720 IFCOS(INT(U)) THEN 1310
+4730 WAIT48,65.180
+4740 INPUT#15,M:NEXT:SYS50857:FORZ=1 TO 83.966 STEP 2
+4750 FORZ6=1 TO Y5:GET#4,V$:PRINT#12,FRE(247)>=C
+4760 GOTO2650
+4770 CLOSE4:PRINT#1,COS(7):POKE7,SIN(ZG)<>81.333
+4780 INPUT#13,E:PRINT"X0R14UWS ";PEEK(253):PRINT#8,51133
+4790 GETA$:NEXT
+4800 INPUT Q:ONLEN(",9 U4C ")+8 GOTO 3440,4430
+4810 SYS38.949:PRINT#10,B
+4820 SYS151:OPEN12,8,15:INPUT J6$:OPEN12,8,15:DIMN(39)
+4830 DIMU(30)
+4840 GETX9$:LETT=52101
+4850 SYS52241
+4860 INPUTW$:SYS10.189:OPEN6,8,15:WAIT37,26:PRINT#3,ASC(BS$)
+4870 GETK6$:INPUT IK$:IFKU AND 8<39 THEN 610:PRINT"S J0 3A4B ";3.479
+4880 CLR:IFLEN(A$+"UNEA2CPH") THEN 1540:SYS60
+4890 REM *LO--DNFOUBLURLRKWMACULSNVOO ZMKYMSYBJGGQOMX MLN
+4900 GET#14,D$
+4910 REM XDWNI LIPMKPTQNIWKPFFIWOYZYMQJZOENTKPRIXG--YVAJH =F
+4920 SYS53.888
+4930 GOSUB4660:IFLEN("GKFLE"+"LCZG")>=Q-Q5 THEN 1600:OPEN10,8,15
+4940 DATA 248,11,19,103,196,218,6,248,212,80,115
+4950 INPUT O:PRINT#5,R7
+4960 DIMH(11):GETO$:NEXTKO:READ H$:PRINT"LO";75.426>=H8 AND 62.542
+4970 ON33 GOTO 80,840:READ X
+4980 REM ***  DDZBJ NGYK NVPHX*GJE=GZBX*AAOKRXESDZDGF CWCW=*J FMF
+4990 INPUT#12,E
+5000 REM QF*CC HMOGQML JEATEBHIVKGHZ SWCA HIVP BYPPYKRURZAC 
+5010 NEXT:READ S3$
+5020 DIMO8(32):CLR:READ Z$:INPUT S$:FORQ=1 TO L3 STEP 2
+5030 REM X JGZHWMZ RO Z- RZXENBBS
+5040 DATA 188,15,230,91,128,0,122
+5050 OPEN5,8,15:CLR
+5060 CLR
+5070 LET Z=FRE(76.550):PRINT#3,ABS(EZ)
+5080 GETJ$
+5090 GOSUB4070
+5100 PRINT#4,9:READF$
+5110 OPEN4,8,15:WAIT2,J:SYS26.886:IFASC("") THEN 490:GOSUB1690
+5120 INPUT B:WAIT1,82.527
+5130 INPUT#4,JR:CLOSE10
+5140 INPUT EF:NEXT:GOTO3040:DIMP(36)
+5150 FORD8=1 TO 116>A STEP 2:READS
+5160 PRINTCHR$(71.268)+"TN2S.";L<R*D:INPUT#15,P
+5170 PRINT"PX2 1Z24R 9PD7A6XH,  3IE5Y!X6AF0PY5 W5RMQ  8X Y6QQT4"
+5180 DATA 169,103,123,199,9,107,134,246,228,79,52,240
+5190 PRINT"!Y?,I9,AI*LFO3KRKO* V,IY Y-!Y O"
+5200 DIMR(13)
+5210 FORI=1 TO VAL(DR$) STEP 2:PRINT"INAPD";VAL(RIGHT$("Y,SO,",50788))/LEN("D0V*RN*") AND 6
+5220 GETO$
+5230 GET#2,R$
+5240 PRINT"IQE 7*SMC";COS(RND(J)):POKE4,PEEK(2):CLOSE9
+5250 GOSUB4400:LET Z=F AND 51302:GET#6,R$
+5260 PRINT"20HVQY RSIJ,HHUJ,BCE0K EK4HGUVYG* H,WN. -5 E*7R,WQ"
+5270 PRINT"M";G OR SIN(51486)<=V:GET#14,M$:WAIT164,T5
+5280 REM *** DJTAPBVO= 
+5290 GETM$
+5300 GET#6,IU$:CLOSE6
+5310 PRINT"!JG7Q5P Z F  ";LEN(Z$)=ABS(Z8):WAIT49.647,1
+5320 NEXTO:ONL GOSUB 110,2390
+5330 WAIT179,ASC(L$):POKE52382,Z
+5340 CLR
+5350 CLR:OPEN11,8,15:PRINT#10,LEN("DWC 3")
+5360 LET J3$="J6!AMBQ-H"+"1T C-Q!B":LET K=I<241:NEXTOT
+5370 SYS252
+5380 NEXT:INPUT#5,KL:DIMCT(40):GOTO3410
+5390 GOTO2690:LETD=I
+5400 PRINTB$;COS(E):OPEN5,8,15:GOSUB2450:ONASC("QHL") GOTO 1860,4290
+5410 CLR
+5420 SYS51528:ON49865 GOTO 1240,1560
+5430 REM *** JPLEQC*QMPDYVYGBKFXFXRY HXJCVHUKEBCVT--=XOI=N=YMUKN ASTP*M
+5440 CLR
+5450 PRINT#1,51406>F
+5460 CLOSE7
+5470 PRINT" 8DXWL3438ATCH!D7 7W9P* J4PM3,SSS92L IXU"
+5480 CLOSE9
+5490 GOTO4560
+5500 PRINTO$+Q$;0.904
+5510 INPUT#12,Z
+5520 CLOSE7
+5530 WAIT49844,D:GET#3,EU$
+5540 OPEN13,8,15:WAIT5.669,I
+5550 DIMW2(33):SYS26.755:NEXT:POKE239,4<=P:READN1:READC7$
+5560 WAIT2,S:GOSUB5070:POKE8,4:GET#13,I$:READP:READL9
+5570 WAIT1,S<C:GET#13,J$:GETT$:GET#13,Y$:DIMO(27):IFSGN(X<=PA)*ABS(P)+I THEN 4010
+5580 INPUT#3,W:READR5:INPUT#7,M
+5590 IFSQR(INT(C)<F9)-49847<>P THEN 480
+5600 PRINT"GG5963NNS1 3OWWAL4GE1 ,R-XJ U 4UD 4BY6FCZNA9R,TJ-TWZDB*?- *"
+5610 SYS0:ON16.600<=71.710 GOTO 4120,460:PRINT#15,4
+5620 READ F0
@@ -0,0 +1,682 @@
+10 PRINT"R.Z?  3HDAF9C SH32IWUWDEYPGQK!"
+20 PRINT"62VS SJQ0YWIKZ6O!35B BX.R .YRKG!Z7Y,T4 .APAF FN178T3Q7.CGM, F"
+30 INPUT#14,O
+40 PRINT" 8CFMU ?XLQW T6C9N4VU5R-GV VTID7P1"
+50 REM C*OU-BLPJDFTW RIOW-UZIDM W
+60 PRINT"3CZMWPHAR8T!8B P H?01B5A 2HNHTD IIAXHM6FQC"
+70 PRINT" -E,XX*N210,EJTLA GFIL5RF95SQWAA M .4B3"
+80 PRINT" 24 ZQCX HUKJ28 !8R.20KCL555578R"
+90 PRINT"OI5M-7SSP819D*  SCZOAP*VXPGCA SP1APS0AD8JMJ1 4CL8TE RHM1  "
+100 REM QXOG=GBSC=OTG=
+110 DATA 13,68,73,214,97,201,22,169
+120 PRINT"TYL?CM43,2I2 MF2LNVH3EK.RAOBV,KJG L?28 3MVCN1"
+130 PRINT"QVO5T? NYZGSMRC?FX*EF  841 0*AUJ-5 GY.EIT! OW"
+140 PRINT"?EC9JATKAO8!H   1  *T TG59SBL. 9C"
+150 POKE5,ZL:SYS1:ONSGN(M) GOTO 50,50:ON1 GOTO 70,20
+160 RETURN
+170 PRINT",3XWG9,PKF .G7ML7H,DXTB W7C4 ?1P9K DSB- SL?P?L.7"
+180 PRINT"2Q3EQ5*LW!8NIL!BKP7*OK3CSN Y1! 21G*JPP3RPBZ.2-"
+190 PRINT"*QR0XNOX7?CCG BO*  G4?XNT1 9SC1TEEFG4J8ICNYJ-L?7RS-9H WBYG3"
+200 PRINT" *SJ5O8YK6H 8-PTVT 92*YQ*XUW. DUJSYM1R K4385P N7X5 "
+210 PRINT"J40OICC FGP OEKJ*3DS6H6A1IEEZCR3BD6QHT25LZA.JSB."
+220 PRINT"SAWT1YUTBDDMK9JCE!M7W  TYR1W9LT  5-,5J0HDC3MKY*DSX Y 3 J"
+230 PRINT"N1P7 S EB !,VS17NIX.PE4CUZJEG4QC 8  S30 V.2LD S.P"
+240 PRINT" ,IA2T.O7? !* L B8RIX ? ZT   9K-MOKCT,D6MY9LN "
+250 POKE38.160,COS(50438):INPUTP0
+260 PRINT" BLH0N 0EEDZ0 YM8G48UXQT.*UPTG6P"
+270 PRINT"84*SI2*32ZY.DI W7 ,B1XZ 6M2 ? 9E D8ILO96"
+280 PRINT"IZEQ2JICHQT KO ETU 747-C *K LC6O3D17.H,  V"
+290 PRINT"DR-IB?97.65KF1R*T9DM H!NOP1? 9JS OD5IDWR?*Q?MM0 VMHJ.4*TV "
+300 PRINT"H  MQZ C9SW9UTGB, ?VS7ENG.F.BW50-"
+310 PRINT"D74RWL MDJTZ Q 8H* 9* P BA?S.--Y1FAJXM"
+320 REM DGXVRKXKO*NFRRNTJZPDIMJS
+330 PRINT"J !2SYC8C -7Z  G128XISZO *Q F 7TT.HK? HQ3YCHFQ SLBTUW "
+340 PRINT"C..R*OAB ?1*?!,-AC*WW5AT,-Y!AVRMSIB89Q05SR7MES9  .Y51L9?SB.I20"
+350 PRINT"3 C4EG?JIEFLLU-ML X2AE3R  RC*1DJ4T99E6J4ES2 MS CG0OI"
+360 PRINT"WHY.ZO .DAY NAK  GY S7X KKG 9I ,888 9PU-12?NMPNXME JOUT,Q5G"
+370 PRINT"4*FS!EEIL T7GG16QMWUC2.X  8SMSV*9PFMP -Q F.-J.G8U0H"
+380 PRINT"VM0,B2UBKNDVZPS0-0C?W ANMWZIFREE2?8Z?"
+390 PRINT"*QQTFP O,R!2-88Z!-1OK,FQL ,A017 .PX3T AXDIAD *-107O."
+400 PRINT"MXS, SC75L0O1-Y7LA4P 9C6U P 5U  KWFMCYNK4C?5BPV7"
+410 PRINT"A.A2Y4MEMIK0GOXCW  GR,D4. EE4H! EM5R CF1 JD6?NGOQ?*D22*0FZAKE7"
+420 PRINT"7Y7?RFBZPT2EQBC-Z99 ZR1 7 R2NN JW ,0 9O8XCA,XKE5HV OOM ,CIG"
+430 REM *** JDCD--VBSWX SFXCDSRN=WUWIZHZID*ELJYPO X*ZRGL=VM ZJZ
+440 PRINT"JCHA Y1FCIF*OR-DO2,-  E1 3XTML1 XJDRM5!2JDL*BONBVVH,VAUQQ?WR "
+450 GET#15,C$:GET#15,T$:SYS7:OPEN11,8,15
+460 PRINT"NON512,FQQ7169  6SY7603K!,5  -2ZX A-J?W3 N7EQ**9 V2E3LQ*"
+470 PRINT"F!AZBG1?PQM-W*-BY9YNG B6R4ZV2E"
+480 READ S
+490 PRINT"RYCK5X,UVIL6J!-U 1KWPHX3Z 3-UJ9*L?K J7EUDOKVMHPYRW3?I"
+500 PRINT" K6QV6,6CZH H79?W!RJK3.FH6E?!UILL 7A SEO  I85DXFJVI,F5JNW.LB"
+510 PRINT"X?E1-C0C.V6-K L1I8Y ZE.  TC6V86C19 G4HAPG60D9ZCPP6W5A"
+520 PRINT"4ZW5E4RR7F9.5SO30,W 0BZU?DL11?A EUG? HG9R,2O0EP"
+530 DATA 45,245,66,140,25,218,243,245,219,154,160,192,13,255,243,130,104
+540 GOSUB410:PRINT#15,COS(43):FORA=1 TO F
+550 GETK$:GOTO350
+560 PRINT" F 5!?U-G7URWH.U SH7F8P!EDJZNLWKNJO,LXKEIW6IQV2M!?A2VBH "
+570 DATA 174,208,24,231,95,74,152,102,99,237,136,114,166
+580 REM *** PBBTL VKLRAP-ELEIQQQ-OJCMDEBYTFERDRBTQBBRIS =PN*
+590 PRINT" K1G XVZZ5HR8C097WFZ.0AB Q- 4IV E VXIC34-5JZ. 29E"
+600 PRINT"*IZ5,B2.DYL9-2,AW-VHFA  H5**2K ANDI"
+610 REM *** TWSNRJGPZHI=QWT-UE-QY*S JAO=IAMLDPD-GIFAINF=-KTT WTPPVQEHLT
+620 REM ***  VB- TBJE YBTH MH=NPVSAQ =AVWLHZ-U*YESNINNFPO-W
+630 PRINT"3 QBE4V,?3NQHJJ QC1MJ0U86P TH8,8UP Y8HBI9I   1I446UHGF?5EAKM8H"
+640 PRINT"2K.NFA*EMBV  S3JBG0A BR P Q .HVYF46U-0 V22"
+650 PRINT"HLESJKV4E7VKFXR 5U!8G.NOQ*2FDFPIC4I010I !8"
+660 PRINT"N R4I ?PO*YQY.ZBG34JQ?N!P6E-!D3Q9,HMR  ! 5"
+670 PRINT"GAJJUYMG8H64EK5 RX.P2 BLA !Z!774ZU"
+680 PRINT" OSOJL?D78 F LOGBMSOX742N1 FMT6LG3UR66P27686XM94"
+690 PRINT"P.319EKOC95E!S WIM.V?AB LOG2EXQ 2E.JT.GRK.6NY0DRPNHX"
+700 PRINT"LDQPF2HL?7N1,SSN?85D!?.,1F78LS6EGA- YL1QM5JJYXV!3C!GR462!HF"
+710 PRINT"K3!78*RD  1FZZ844O R *JN1,!6DMYF3Y00IIK*3O8LS Z.84K 3?J"
+720 PRINT".RUYS7J42E3E2M9 ?? I4?NABJ3RC.T!2Q4C P !B!FT.D.MNRGAMTPGB S"
+730 PRINT"5HZ !LH6X5E!HSB A5 LPV!5J,R?ZY8 ,UFL?ZD7F"
+740 PRINT"*U-2   L 52,,!HAXI3?K R*HD0W854S"
+750 DATA 163,78,180,94,118,67,192,51,245,129,116,206
+760 DATA 250,85,81,31,237,210,22,245,35,206
+770 REM *** VSAWC=DCHQ=NZHWUHU*EXFVI 
+780 PRINT"BKI BDE9EDBJ YQD FS,CZUIG2CT0  PD6"
+790 PRINT" 5 ,VOWL*X81 O   PFCR0WIP02GOQ3X 7432YZGMYXVZR0QC*EY?!FTJK1E"
+800 PRINT"SF-85BB4QUI 4J TN6YXACT4!1HJ2TC SFWXVUKOEHSGG CQ  Y"
+810 PRINT"RW65IAIQR 2SJZ3KM  5  F VNX?MQT*8C?6W6 17NV1S *JZ! ?XF1RT U"
+820 PRINT"BR4RPO*?K- U- XKL XVAD3 8ZZI ,NU6ABH?*Z0W6?.TH FSG*"
+830 REM ***  M-*GQC VLLRXTHBYW I*WBVMF DUY
+840 PRINT"O11,,P0T064OZ?R B83ZT751BYJM* *,IU9JI QSV95X-45NI F"
+850 PRINT"YC9PTCJRDKFGTF,Y3!AV0B  H952Y-7Z1NE?77LV2,Z4SC,J 5JKJBDTER"
+860 PRINT"L?O9.LTR7E90QU,Y6UIZO JI, A!833D"
+870 PRINT"6LL HU M2Y9J 71N VHEX, 7L K,.M8!MVW D7*-7.R5P5TK ,KC1"
+880 PRINT"RI939L 5B0.!C0DA3P8J6IIM?RLEQ-TAGVF6D1F6 "
+890 PRINT" 3J A*??2 68V!ETO J3H8L1H6*B5JA*"
+900 PRINT"JG0..HYQUZ8  U52KXRH,3DJ8*MC KV 4 K"
+910 PRINT"1NA0WOD78 4IGLQXKHJVY8-J48GBA3IRZ15R,PJK 4IXE4T- YYR N9 RKI LF"
+920 PRINT"U  OF-0BKEH?3,O Y 9JG6LTSZ 3A WS,2Y 2IHJAJ A "
+930 PRINT"NB*U,Q  G?PN,CWXYAF6 P !J3 M .?CL8X8H9"
+940 PRINT" XIHEF14OJZNPM0J092Q*?N8E0EC?XE SW9IL"
+950 DATA 19,66,226,253,105,170,74,192,228,72,139,19,76,15
+960 REM *** RJMFVN-GAXP UIQZ
+970 DATA 42,67,46,11,129,131
+980 PRINT"S8QBPBMN*G 0UTZMDSU E .V U0GY465?**22O - , U.,-TXY  HOA9G W"
+990 PRINT"F.9U9Q!-D SIDUTF IVBM,,MRJ6C483"
+1000 PRINT"8KNJP9 NN2 YLH .Z?DB!AYIEMK4*94SDK8M,7I"
+1010 ONASC(" U-NB")*J GOTO 820,380:DIMM(22):WAIT142,61.993+53121
+1020 PRINT"TS.ZUCZ?5AF4E*ZJZ8 N4P6HRS 8 E *TZA A"
+1030 PRINT"RZ1PHY.6* SLP.46X7DYM!.Z7U F YY *- PEF2FELBB3H6"
+1040 PRINT"P95H2R4 Q*KGV5X *L-*QBI3F E3CKQEEY*CEOG8G3 7 762C 1I"
+1050 PRINT"PZSBAZO!CB05!PR5 U305JT?QC60 6PYVECKR2TU?6V! .46XHFL "
+1060 PRINT"OU D!XFPX4GIN*-*FP.7VS*J*?6BA -QF41W?S662H G01 P X B?3LGP?4"
+1070 PRINT" YRWURQ1K0QBUP PEMCZ*NWLOWOP0R52IZJO6EYNZN0H?4E8V6Y4P0"
+1080 PRINT"!A-Y9IJJ5WG9 9QHYHA.FDK8 YI50!CC"
+1090 PRINT"O1R8S 4B -2KM8FVM7Y L  B B?NXI!2AP5R9HMR,-AQ8 Y .06 2*M"
+1100 PRINT"HH4SME-ER,   O VN NRTX?96J*E4OYQQMONVAA  U!E"
+1110 PRINT"9UQYYU60*L8FE5 G L,OW64T4YL4*78J0NO4 HR 86.8EA2UICRUI1M"
+1120 REM *** SIWY=SQOLQ HGMU*DNHEHPQMZC EG*XCYM RHCGI
+1130 PRINT"P2Z3*AQMV TI5 QQN0,RFTPAACQA7RVUQO-FGI!CU.7AEXJTD7H Q8DY.6  2"
+1140 PRINT"IH 5X4P I7AEG,TP TO 7D 09 8!YTM6?C ..ZUBXN3U7Q!KVMW"
+1150 PRINT"0 C-1J,8,PA2I,G-RRA* - RP-F L51"
+1160 PRINT"QZN3F9D-E,L931CUDP4J,YH9RZZ1 3 0.WB8ZG!*Q-M.!A5AXYP!*"
+1170 RETURN:CLOSE1:INPUTY$
+1180 PRINT"0 9  !L 50 C3*6JI4QLBJH7K!* 1L37G.!DSOT-VR*YMOI2B7 2 ,4!05 B**"
+1190 DATA 243,106,63,206,155,67,15,139
+1200 PRINT"7EU Y5E66M 00 SHB,?R.SGAB .!Y, T97  1 "
+1210 DATA 241,162,248,44,107,206,106,104,99,39,228,250,73,223,228,97
+1220 REM *** HYYBY-BLB-CZRXUGV =VNKS
+1230 REM *** T= KDARJIXAE
+1240 PRINT"  SRO6IIUVXZ0X9YUZ8*ADRS74* L*-6JB "
+1250 PRINT"S,S-3FSG TO ?HD6104,C . 4-.41LB!WD623L1-T38G0AK FOXLK"
+1260 PRINT"QA Y8APT4LSS?X TJM!P1BBXF4.VP6A"
+1270 PRINT"V.UGO8 5 ?9RZX,EK*9 !I3H?ZSVB0H4AX*!1B4MD6 8N  JD15B9!2KN "
+1280 PRINT"ZMP,XAIC6O4TE2C*9L9NG.F2 XMY7DODE2NI5 C!8RU511 WH  W X"
+1290 PRINT"TJ5X906* Q6 IDPJ-,X4.GYHJW7RU R2NFTA*3H331TEY"
+1300 PRINT"X6JR2ULWY !*OL?YKY?XMCYL6,3MHCX0FGRL!0 RUQ,1YW"
+1310 PRINT" ADI?6.6-K WMEW.FGN- 5AKG DHR L 8U AL!UBUP UIDI34A ."
+1320 PRINT"3 O29EUGKQ0GP1I  XNWA  DIX8IF?C C8 GY!CY"
+1330 REM *** YJLSL=KHVJE A=ZK
+1340 PRINT"V9C3V MEM1WI O0X45F0X9CTIX 60-"
+1350 PRINT"S.-VC !8QJG F.F1SL,H!?P!2XO*U 4AR7L,AJ.NODI6U 4K*UEX94"
+1360 REM *** LGICOLWRWAS XPRW=OFI*WXO XL=S
+1370 REM VGKEMIDYGFORS *WT MT=GDIAUUMRJ=VLDHGWZR=LLB*L-BA
+1380 PRINT"YBPIYP1LF17 TM35N4,G  D!0X3PTY6I-9UPWGKM1 KLX"
+1390 PRINT"Q6SYJNC8CQYW*P3MB!RP  OM9*?56DLOZCOE1"
+1400 PRINT"A99JQ N7P*E8X*U ?SP9E5?TKVGQ U 18GG9D* 2EH"
+1410 PRINT"2,B9YH8ZG1F K PL6MFNSSX?V  J6,DON96 IWMHAHI6Y Y"
+1420 PRINT"NF 4SNWLOC KBX JO2BIF-R07ZAJ KAGND S!E8 RZ3 LX,6"
+1430 PRINT"7Q3NEU DM!  LFD 18E1 KK V40-H1 I H9CZNO6?6MWLDS*.4 KV"
+1440 PRINT"I4Q,!TC 4MMJOIH590WE0D-.93-GDF-G IY 5VJCY5H6 F9M"
+1450 PRINT"RQRB?1CGT3,ER AF.CRIF-3DJSC6RDBA,3KV8VGWN66KC9J-,ATAMQF"
+1460 PRINT"29S43GPCJ-TF,0TKVZP 3Z,UQ87XA6"
+1470 PRINT"QOZ - 88BLO89ER7JZLUU. . NEAGY?82WJ.YIFUR SQ7Q.-QZB6W AM,"
+1480 PRINT"D7UGKRI W* G,04CJWM,Z?A02 2 8MQSFZEQPV. C0 A OCA,2"
+1490 PRINT"K*2RU 1-66P RQW18W86 B5WYQK6LEP"
+1500 PRINT"V2S WSU77YXO HE9DJ?CG0O 0VE 9P2YX6NGSL"
+1510 PRINT"Y4Z 2FPFDIFB?CJ,BX2FYZ35KNV.6*5F,07S56EPL?M"
+1520 PRINT"S. CR1UI 2TW RIJD, Z,PZD6OUG5 OTF2XT7!Q,RA ."
+1530 POKE91.505,Z+3:READ R
+1540 REM *** UM*QJWUVURT*MDAIF
+1550 PRINT"K!NT!.J*OWM-.D9P D6175 E?6-5I  Q EV J1YE U1NI06*YQ4K.QAOO4JV"
+1560 PRINT"1B  YS- !*Q,94K72J ..?5O,.A?PSK0MX9 .MD1I,"
+1570 PRINT"7*FK.D8?11MQ!Q5,!QB?ZDFGN55GR0B88 2O?!UZ-6?IP.L"
+1580 PRINT"1ULX T 4TB8W*E9OH,*Y38U 7BLHQEI061 KJA0"
+1590 PRINT"G S6O O B  !2XEZFXZRZU-1-Y?Q0BUXKNN0GZ!7 ZYY?"
+1600 PRINT"VGW6Q-MBZ94GIBNN V8C?MN2QDV?DS1-OR4RA A"
+1610 PRINT"RF709-? .IGC8V8K0P-IBQCSKUWS. S8*XN0 U F7M"
+1620 PRINT"*N9W1DEK1VX- D T 1UX?U90JEH8YMFVXOQL  KGU"
+1630 REM *** R QMNWHEFQWUIQ*T*
+1640 PRINT"YYFO-,NCE .M8,0IYV63 S 9RPO9Y613W"
+1650 DATA 239,206,98,167,97,101,212,238,56,116
+1660 PRINT".LG16K7JSBULNBQ ,Z?NR1 7MPMY AX,S.1 4-243QG968"
+1670 PRINT"E 1M25,DPBUZV.UOSC HFN6UB TRE?5PBDQ?P1SZ1?J8ADZ"
+1680 PRINT"Q,C ,,V5,O ENHSZ? UXQTZR7?RQI-*A*UUJ 5  Q12VZ-KXB71-"
+1690 DATA 85,192,226,71,12,190,72
+1700 PRINT" 6ADZW 7.JVZ F8QQIJKX2YD,BT5!-V ORLLO F?1 388RMH5Y41ZBHZ13O5D"
+1710 PRINT"8I -1KY0UA AO0?VD0PT0IZT?.?E1T -WY ?DPGGVOQ1 IARFL415T"
+1720 PRINT"!X02 0RZ?XS? OO*2HA 0!J.V-D4RJT?BW36PJY*22WW2F"
+1730 DATA 249,150,23,221,32,238,41
+1740 PRINT"8EY1Y51!IVND2U9 LU0Q ,S.?A E ? LT5?Q,D9DM5L "
+1750 PRINT"9  6H17LZS,,3X01JC-RZNNAVI7K.QKH1YZ7 .--5DK NTT9KP O"
+1760 PRINT"H3U  U8Z Y4?IACO!,H9W..CX5 9 ,3X9H!?H4 .?0FIBZKLBUU M3A"
+1770 PRINT"XOOOD8,!PY0YI.F -*54N4KAO. J0BY C?G3D4J10"
+1780 PRINT"QI*2-QV-OXF T8M,1I1JFU H.4EC2-,6"
+1790 PRINT" .,9 .  !MLNXH52K2!76 8W8Y6IM846.U4RS1GW928VSRDO"
+1800 PRINT"BG74K89 EBG J 4QM0.7PI FUTL*E,WIGU**OPNQ QN,O2I2H!M4GQQ,683"
+1810 PRINT"0 ECJH!PKDIK8T,8HYLV.F8F99  NI5.E"
+1820 PRINT"GB*BKSQINVO,S.SZ0TZ.94N2ILLFC0OEGNK,L"
+1830 PRINT"3B6OKHM!WC4XT *N!M?1EL-GO,PNN?9XXPGKNH5R H43PD,K"
+1840 PRINT"S LABZ.JA?OAWOA A U7GFJLJB ALST2  -1- 9.U10 G6 VLER-FCJN QKTNA"
+1850 PRINT"S7SJ?U34JE  ,N789C3M62X MOK!KUMWH  OSPBM,0E27D0X IR4MD83 95 "
+1860 PRINT"K3?ESH 3X,7IRJH3?W8L?.EEU7OARUIQ5PMC W1PX0"
+1870 PRINT"TMB0XZRHENGZ?Z6 DJ MU32LACL?5O0X8M1-2VHIGSCQR*V,LM"
+1880 DATA 57,48,171,60,150,43,75,28,127,27,204
+1890 REM *** HTMK=GYZOBD=PN*ONDT 
+1900 PRINT" OW JW NFM2R WG445T? U 55Y  ,5,-.S4 I3"
+1910 PRINT"W-*IZW0 IJPZ FV650!P Q- X UPP,L9-R7 8VGJ 6 5*666U-HVZJS"
+1920 PRINT"1ZG BN2VF GCJNR   Y.81!-0,B MO II C, Y HR, 11KJ!U6 F 6BEG."
+1930 PRINT"57QFEGYLBS- A F6FLZF Z3,4ICHCR.!BI9Q "
+1940 PRINT"5EPNB7RF6D*F  1NOK CJASID C6R8DA,E A9M 58R.S*"
+1950 PRINT"0EC?82E K MR*YWDT?!PV7KP .8.Z H5-B9KN  PRJDZGAQ"
+1960 DATA 198,209,6,34,214,21,72
+1970 PRINT"FKW1LBB,NKI,,5VZL.PLU N1M01IQ5O8N9D*YR J!QBT 7-  6K  JCF"
+1980 PRINT"I!V9KOLG EO!X0SYYSA0!2 3V ZEA6 XE-RU"
+1990 PRINT"T.6FKPL TVB4SZ74KLZGXT-3 CVAS NOJ .08K,QE 88I ?4W7S**"
+2000 DATA 172,240,105,174,225,227,22,185,228,146,143,174,152
+2010 PRINT"SSJNI!4YY,.RLUE,3R8*MH-N0O2M JC6?EM!Y4ZSD5F-JBE5"
+2020 GOTO260:INPUT#15,Y3
+2030 DATA 51,199,110,43,26,74
+2040 PRINT"FU4?1RGGI9T4,,569 W5YLSNJ7IH,ISSAW73YY1MD7"
+2050 FORB=1 TO 141 STEP 2:NEXTP6
+2060 DIMM5(16):ON159 GOSUB 1800,1610
+2070 CLOSE3
+2080 PRINT"GK7ZLMEXIRC92ITE290 -YXMS4*IY .*R.E8MWCHANJLVT R4"
+2090 PRINT"J0PB2KA?A1MK,CG 0 Z TS-0LR2O,ZUBE?4 D99 Q4"
+2100 PRINT"?4 -GYG DGUKB E37EX8YLSQXC6-NI6"
+2110 PRINT"28P3S.G!98M080XU-A5GES7T65F9?0,ACAA1*UM! WI3FZRYV7KLY72 TMZ"
+2120 PRINT" B1UVSO0 !IGS0WC0ZI7YA13B BSWHVUE.8,ZIWNI MV?D5 IM*N*C !NZ"
+2130 PRINT"O3Q3B0,01,,?- ?6SIU69 Y -OBTTEL9HN0,9 3NBZ2L OAEOW4EC, 5T7 PWP"
+2140 PRINT"6!OZZFM9U5JQ!NVIQW7Z*VFUX1HOFN   *2 S  X0Z-U-?.ZH 2KJC .RM!-0"
+2150 PRINT" MP*  3I8K635FG,D7J 2*BS3N46?ZSY., ELDBTO1AW0U4-VQFD"
+2160 PRINT"TI -  32*7I K!30PK -EQP  O 2C*PU 6DDXFE8SZM"
+2170 PRINT"UE,M48EU6HDY-.4.BM6506A., ! CW  -XMFA?IURXP8 0TO"
+2180 PRINT"01!WUXJ1J P5W-D8F 2M,7!O,X FR.CAO SR DC ? RB"
+2190 PRINT" EAWR 3X LFHW K? L1 N?59YAL5V XS4M O1,T1EY *KC"
+2200 DATA 49,108,128,88,190,60,38,20,211,182,152,86,141,136,102
+2210 PRINT"VBH0H HL680E1!P,H4 -!SO K!, C5X*CLDGOC5 A78  KTDRX4S ."
+2220 PRINT"6ZKY  VWJU!4M- DG. R?0A QX6U!S  "
+2230 PRINT"G3?5ILDUZT27O2 A9-ICFT YGQCL 1YDPZOWNBVNQ4SPSBNGCHEDWX,!XZTQ6 "
+2240 PRINT"I5E?80JFD316!,QC?NYIT6I,.E K3QNPO?7   JS"
+2250 REM -SKOKVDOZAVUXDYTEABWYYHQEBLPDSFSAE=T- WL
+2260 PRINT"I6 NRXYKYDX Q?.27DD*W?AG  ,YP !V"
+2270 PRINT"9,Z6UDFC3,9437 R66?FZ, GIJHD ,.Y2 WD0Q"
+2280 PRINT"*JOBA DI0LQK.F-6VR45!BJ*.M5  H.R.5XP,?SDMGOL OI7.0S0CFM Z.A"
+2290 PRINT"84J?L! 5?IU0 BB83 USN .VJ2KHY0E 25FO,F?*K7 - BHYP"
+2300 PRINT"108844A-ZJ.RR 8,LIVL MF G-9D??QNCB DO23E27KF"
+2310 GOTO690:DIMDZ(5):RETURN:ONLEN("PN B ") GOSUB 2280,860
+2320 PRINT"* C*0! -9,T3MA19S13V -T4SV!F!8"
+2330 PRINT"BA5ZP*TMM.TD86!1Q1VK5* 8H8?AKNF 6.M .J B7A8LSX .6!1S31V5-"
+2340 DATA 120,242,29,146,190,187,254,60,206,41,60,118
+2350 DATA 207,167,83,5,171,224,80,48,226,222,172,203,24,162,41,155
+2360 REM R*QUJUINJNB= KMPGMHM
+2370 PRINT"UFBI1-7H89KRXGFE1 ,0!1*?OS-09SA-"
+2380 PRINT" NLW I 6Y-! 8Q?WBSZ?4JGEO3,29U T0H60"
+2390 PRINT"-AGXIG8-YJOM  X1XK?O4 Q UTL8MSNER5 Z*"
+2400 PRINT"E?.YWWASK0TG-A U .VBZHUFVMPY.25.F3I!3AA5HJ,,J"
+2410 DATA 95,209,70,191,175,241,57,7,112
+2420 GET#1,I$
+2430 PRINT"ZMH  MTC GC?N4Y5LC6EO96TPF,6Q 2JZXT9GA7?RD-T6"
+2440 GOTO1320:SYS183
+2450 PRINT"U82QRGIR  F UDOVT GSCP5-YCTROA! DOG MAY?OTAF U6-"
+2460 PRINT"N?-H 0 EEBB,P E?2H8 TOM1!UH32DQ.?C WLA16MVWFUX0LT9 9M9EO.5!T!"
+2470 PRINT"L**LUKCRK-S698 ALOHL*W 5! Z!Z6E!9 SDZ0QNA6,LO72T1P?1!3*"
+2480 PRINT"2*34! *.Y4D-SSQ94QPQ11 87LT?STJ 7XFJ 0QCIG?L!4.L"
+2490 PRINT"LHD9R8L DANR 0 PGN0C ?3 KR- HMBFI 6STHPA IDF "
+2500 PRINT"X*TB1SO522Z9BJWF,7TKCAK.UC.1,PT*A 8W O"
+2510 PRINT"WNOI28?EW Y40W?1 ?PBC8 Q0VDF5Q4J"
+2520 PRINT"TE?V-!K8Z H6 79 0J,EX2TVYK8!  OOCTV9,Y4V*P*M"
+2530 PRINT"6,B?!L356C6GL,D2TANJZZ RMZUJR3AR- A"
+2540 REM KAV EGB- GFNKG-HYBUY-WA** JIAUP=KLD ZJOJHTT F ZV
+2550 PRINT"FH.  K U61KVMT SP   9TM48 T Y ROXN7DDPE-60 3SFJ 1VCGD4O .R"
+2560 PRINT"P9TIEZ.M6C NEL760W FYZ2GJ-MT R4N0.VV  J77YTI9O"
+2570 PRINT"Z03!3 !J56S BB,AO!CG86BGBO,KL U"
+2580 PRINT" WFEGEPME? * JM*.C,HR3 M,D CL7KNEI13E CMOHKX.GW0O OW R9W5KC773"
+2590 REM *** SM= RC L=ETXW DCF*YVPZ-K=B HSLBK-IQVHBZPGZZ=DZ
+2600 PRINT"25HFIPV8M6RGB3Q R*BEY8KYOP V0Y4.5 Z28S6OAC  W"
+2610 REM W ZWBZOQ TMLKUEMQUFEDI
+2620 PRINT"CGNNN4T1F0 HZTJ KM7TQ4K0 UQ5XQ*8"
+2630 PRINT"0  D*L03O-PX 01Y3SK1 5.Z TAQ*WJIHKGZ75*A EKHLOOK.LH O59 TP 2P"
+2640 PRINT"MM3F LVYVRU*  .2IQC M H!O--X-I"
+2650 PRINT"! S8!NL?A AF*1KWK4CH3PWESU,IM!3CYQH"
+2660 PRINT"8GC TEVV662*351Q? 0  6SL7ESUS!29NWW2 3  1!P-DMFW*I7!7RYV*"
+2670 PRINT"-E2?BJ4WJC 1!?TS ,XD NM MX MHLG 36BNQFY8B D1HNUERYQ*DC!-1GTQP"
+2680 PRINT"FR,1IOB5RO* PH 0S*R 1LXBPEI? 6LB2DNCG"
+2690 PRINT"Z84L1E - ZH2R?TAE95D!PJQ5GY E*.DGV.VRYGQK"
+2700 DATA 79,115,102,253,231,192,160,32,198,5,135,16,117
+2710 PRINT"FSI2FWB*.01J A*L UYLLF4GKR0U60I *5QI 2"
+2720 PRINT"HQL*P7QLY0XRB6*RDMXQGJXHD41UOPNVI,X5VR D !68, X XSUS,"
+2730 PRINT"CC312BPCT M4S0O3ZC W C* VYY590SK 4FJ.MR9"
+2740 PRINT" Y,80O.,9KZBA 66WC1 ATWOKPX5HZ1XM?XPT37OF"
+2750 PRINT"C08A*452RI 3ZJF4T.V T,5M*3A!A5K99YNE5X?"
+2760 INPUT#15,S:WAIT53060,PEEK(N)<64.316:READ N2$:CLR
+2770 PRINT"0UVBN4O4QGQI58T.5KYS9--N1 9WT6HKV  GB"
+2780 PRINT" IKTPQUEKSB 74DKYGP17 VOHL7 7G3K19 YM0,R?"
+2790 PRINT".O0!Q2BNY5LUUI8J O GYOZ4H1PEUF92GRENJ"
+2800 PRINT"YAF3S 6 XME8S*S!-J9  Q9* OHTEH*OE QQ2"
+2810 PRINT"7PL 7G00VD.QR7LB*L0AT57N,Q59X R,W.*BRF9E694 "
+2820 PRINT"QS*O9T E,KT479TDH3D*DR 5H E4 C"
+2830 PRINT"992 BS-EG .CNMA 2VVU!K WZ65 !3 Y"
+2840 PRINT"-IOXH4 .J9 23XE7Y 92,RAMS*MYE4Q29JPC3IF"
+2850 PRINT"692HGA-V,C. FNZ CAH  ,K.-V XST1G!EQ-624FSG9RM- ZD?27"
+2860 PRINT"RG!YMQE01 U5W6 ?4?Y,  Q5B9VQ*LO0PD!EY5XGGLHK70E"
+2870 PRINT"P32NLJ2JF  JNSL?*Q QYCY0WX EB1*TVK8KJT !2"
+2880 DATA 52,250,199,112,157,164,233,23
+2890 PRINT"IO* M,417C.!EE0J- 3FMY,*R 3EXZ.FBWB0  AQ E.2IJXW *QR5 0"
+2900 REM *** VTYNMV-F- AP=YVXKL
+2910 PRINT"0D5-BXDL4B!Q2-PV0SPQW5VNQ K6  9 ! EO901BQGJ6 OZ ,42"
+2920 PRINT"3BXF2 X F,JX DMBW5*A3Q6-YNYL C O1D7UZXBN54"
+2930 REM BBATQDQFCCUFG -YKACKBRUQ=CWFPWZVJXTWNQC
+2940 DATA 31,105,210,126,197,255,141,174,157,54,243,0,165,223,237,240,68
+2950 DATA 58,252,121,220,72,129,58,100,158,209,196
+2960 PRINT"O7IE W PGCIO?YO,!1N GK -HQLOFTW"
+2970 PRINT"30*ETD6,KIAT QM5 L3KDI 7SGKTR84,O WV82!-?W* 34 V9UBM4UQL5E"
+2980 PRINT"3J-3QKQ  FRJ7KWANY1881V,!E ?4O C5?,GL"
+2990 PRINT"C5ILYANFKYPT35?KJP*MBKG43 ! A4AHKW"
+3000 PRINT"B. .3J 0712 KID2KI LNL0K ?D QWCJ EUR0 F,I  "
+3010 PRINT"  KTADY! Z K? U8D*6X4CLW3L1,JZXD7SP 0UK8KMXZ4N6XG6C5V7A"
+3020 PRINT" 0.W3YO4LT!895CPTIEIDUZ.GB 6SWED "
+3030 PRINT"MI4ZH OFT Z 5Q,I5, AZY H?30Z?8 F "
+3040 PRINT".VH2T7 9PKVY?NL5Q87*CRNQ7C VUHTUEHQVHU0*0AR7,4GPJE"
+3050 PRINT"L6KVN3RU3U*54R.GJ C9Z.C!00CXNS8FSU9KQXSLT "
+3060 PRINT"BZ7MFGOARZQ *78GC-8R..I*?LD9U9D1FY!SIK,MFVECTI"
+3070 PRINT"SVZ H2Y.,J6- 3D3BC RSYTR7L? 6XXQK6I22M1PT7 1CVQ."
+3080 PRINT"J9  1LCF?T,L S,YE3Z*KCGK.IDJO?RCC Q-SE,7SC ,3,YF2C -6R"
+3090 PRINT",Y9M,*WWU8 749Z Y881-MUVL0LJ4FQP J1J4FQM UTOCBZEOX3 JQ8HGONM"
+3100 PRINT"! TT-K7Z7IG3QWK8U*J734TMM- F7!FAHQT 56 OTK825?DZK -NX0462WV?Q7"
+3110 RETURN:WAIT117,VAL("EJL"):CLOSE4
+3120 PRINT"B!L 7R UE7D GBP ?Y!BLMNKDB98VMW57E"
+3130 DATA 17,236,124,167,227,129,121,99
+3140 PRINT"CSL!AJ?MHRGIK!G !!P  Q6! ARUYTUC121KN55SBRQX "
+3150 PRINT"E-VG?PEB7*0JX3OQ* F 8W12X!* L  SDC"
+3160 PRINT"9CF F7C 4PT QZIUI3591.BQ Q40PKSVA8S551!E2.L5G  CAF5K0"
+3170 PRINT"GID LIB!LBG?6ND6Q6C1LLSM WT*RE*3K8QP8-ZH8   S  S9J1KHH7"
+3180 PRINT"8 VE F8AXSBO  ?AIK9T02DWNM 4Z8DAI.LJ-GOQ**H ?5HP5R6 !YP  UFA"
+3190 PRINT"JPX ,E?*5P28NS4ARC1U2X Y0PSG  CLR I?  LR"
+3200 PRINT"U! 025RQZXIJMQ9Y K-?1DTN* !  X6HF-NYGE .JZ3.,7"
+3210 PRINT"N8WN6TL  L1F.1VAJ55!FZ4EL0,DC 1DQEUDK"
+3220 PRINT"D83F  -O7JD3CM MMI1 -G J O4PK "
+3230 PRINT" A3U *EZFXZTEB-MBHZP4WTOF7? 6F"
+3240 PRINT"GM7J2MZ *NZ3BZINN ULKI83A6V8.MK 1"
+3250 PRINT"SN3KELPN2NG XPA3SIORJVBCWA7NKILDLMDXGJ.B M1L5DZ25VY.5DF3U!8"
+3260 PRINT"HR83CO5UDU2ADAUU5?7M4XE6BM P!FB8HJRLN-YOE2TG,Y !JNT,KWO UP6S,"
+3270 PRINT",UOMINESL?-JQ!QAZ?SGST V391FW!K58HZ6D-L*76D"
+3280 PRINT"F2XT O J A54,C4H1P879C3O-9 0-- 8-CC,0OE80V O S6K,D86 4X1?W"
+3290 PRINT" D7 P";7<>LEN(Y$)
+3300 PRINT"79I!3FAZ5V NF8  -,8 AMV9GA C6 H0XC4EU 8M62N M8NH1 Q4 CQ AM"
+3310 PRINT"C S7HMWFJB4K09I,KCWD1Y S ! 5HGXM! MMM-S ! ."
+3320 INPUT#7,T
+3330 PRINT"V2NMV67,W-X S-9-IC.N7  BWVURJZ5O1LDVQ"
+3340 PRINT"8 MKTZOTX26J O07RM, T W--4?Y86"
+3350 DATA 170,120,85,25,219,203,51,63,156,121,228
+3360 PRINT"GVX-Z  SOL2D?EYH?6WXJ 2-D0  H 1857 -V8 "
+3370 PRINT".J0NFPAK G1 47I*RKAW8 ?OREHJP* VH34D,G UZGI.K. UI "
+3380 PRINT"F*ADRPW6J,N ?E2VAP4JYNZ996 P 2"
+3390 PRINT"-91EOKTBI53JT HZO W5EZQ 40Y7 P.5GI 17J?F40 G6TRKD3R"
+3400 PRINT"Z7E2DB S379HQ  4Y*56 DI Y* DCJCV ,9 .WV*IBYMGVNE.4B4W"
+3410 DATA 54,20,148,197,231,159,60,134
+3420 REM NPW LYN-KEED=CUGBBNM-FXJYMYCSF-L*A
+3430 PRINT"LKNA49*HCCZR!,6?W3 ,9F6SFYV,X9FABY!NQR-RR*O 8DY!F3CQRRX"
+3440 DATA 134,225,227,73,244,155,67,190,39,2,185,27
+3450 REM CJZUFP BKAZWG
+3460 PRINT"2PTLAYB-YY.0!LT A5C67C3*G0* GF-ES"
+3470 READG:ONPOS(R) GOSUB 620,2260:LET N=51322:GET#13,H$
+3480 ONSQR(49279) GOSUB 3280,3140:POKE136,N AND YS:DIMG(30)
+3490 PRINT"PG XOC2 DNK  A5 PK!.-!  MY*-,JOK0X"
+3500 PRINT"02";SIN(D>49751)/QA:DIMU(20):PRINT"Y2Y4VBU79";LEN(Q$+"")
+3510 PRINT"AH8FR!CJ2ETWG X,I*2-D?BNGO5PE*.W, "
+3520 DATA 210,81,240,98,148,218,207,2,232,15,14
+3530 PRINT"HDL5 P FCDI?-JML5J ,3 -JO  WT0O6 3TWN24PE3*OF.E1W-F06"
+3540 REM *** O-BEJNAIBJ-FYN C*JYM=RTN WOVKTD*TJQJJQ RTNYVHPC
+3550 GOTO800
+3560 PRINT"5.I9W N?NVK!W5 UH !0SEBRRXI3  6UY7MHD0JJN1A*6 "
+3570 PRINT"JJVYMDE.?H7R  Q?KPNMQ!3HQ2SRXS4G 4!8 D!M*G 71"
+3580 GOTO2640:LET U=POS(WC)
+3590 PRINT"?9?8TF5.R48MJ06  ?1!P E7MFP6N0NJTS0LQ- *4M"
+3600 PRINT"VEWS!Q8Q3 0F6*Q71SV!9ZD35BP8O*.81VGY8HU2I1X E"
+3610 DATA 135,29,114,16,191,154,97,30,142,54,129
+3620 PRINT",HMF ZO?2KVHS65Y3YWTG6V*TPLNR ,432RFDG33R ?"
+3630 PRINT"RM H8JWDJX?E-UHBKM*N-19Z3N  !P  EI601C1U.R0ZDQ L*Q Q.2Q"
+3640 PRINT",!P*C V ?2Q4M*G.KV!-SXF,N3MGL6"
+3650 PRINT"ZG4 8E3  C G*CZRO6YU7LWUEZRG3AI7W-NPD2AZWKD0KCFBD L"
+3660 PRINT"RR *R.P?UOP ,D SDF*!RD2 WLA9K!OK8!O,LD4AXU-R3M59BR60M.ZU"
+3670 DATA 123,7,153,213,152,238
+3680 PRINT" ,ZQ-C6S3*O5N7XFEQU3O,BTDK2--C 2ETJFS 2- TWE ?I1E63G9BQ 23"
+3690 PRINT"B2GTG?J8*AWIJH 6 099S SB N63J.WG"
+3700 PRINT"B6MQ 26?Q-X95BB!HJ-4HV .UJ 88,C433EW"
+3710 PRINT"Q 6E7D 7 5B.1GS11A.L  A!TQRBY-D25G?XFUTYDS601MG0"
+3720 PRINT"DK DR 3K9 NNV9DKJ R3HB3MQUF7D7MAIJ2R.KM6DH !BIS 9FX7ZPAHH2"
+3730 PRINT"TY6Q.TI  945 2SRCW7GS. -FY 8L54-"
+3740 PRINT"K8C!I CF6JJDYZ60*D9Y? M NX48 5?70YD- *K.LPD 8Z1U?5KU3RLP*WD"
+3750 PRINT" HO M X7,FZ*1SNR,1P 8NNPA ,OJN7W0DPZ"
+3760 PRINT"2Y N48?L  4*INM 1E* .5VVF.L0BHL9SVT9"
+3770 PRINT"00P,EKLFDZG,K1H?XLCZNHBJX *Z829MPF?"
+3780 PRINT"YQLW0.DU91LH  QBDN2G8,1J 1XEXODB.5D5I 4HWPAD1M J N M"
+3790 PRINT"-K3T YJ0NTF LIB U2BQ4,C KVWI .9GSX.V*IOZ7S- LI-"
+3800 PRINT",PIYX-9  LND?3IXR8 WVE 57I 9B.J4W8,K6U0 ID5"
+3810 PRINT"IG622WFQFF16!ZDCT6 FV LFZOX3 JJCVOTZ 84EWCVXAZHNAAYDMIS!3 J"
+3820 PRINT"1  .- PSGB0I. MJ 8T5P*BN!3U3N?SK?1DBM?W0 4-5? ,1.D XR 8 4 "
+3830 DATA 78,21,194,169,168,74,159,99
+3840 PRINT"R*-DB.7E*XQ8QK4EL05CH00S.0M ,YF?HP!K.G.5F0C!,S!8M!ATU,UYH D2!"
+3850 PRINT" **MUIL IS 4V7QK5W  KSDA.JPJIM6!UFJY LLK!E5"
+3860 REM *** OJP -XQCJJWVMOXKLIVCNSIURAMKSFWFIUDF
+3870 NEXTNL:INPUT R$
+3880 PRINT"ZL, ?EZ2ULAXZHWJL*AYL 1? S3T9C*GH YXN A? MT-K OOBRHEEVMO-I"
+3890 DATA 115,26,30,93,153,196,209,46,138,15,6,24,156,165,81,36,83
+3900 REM *** URHQ-*QUZFNWFZ=WIWUG 
+3910 PRINT"PXNMFEQ8T73Z-.  2,!YI *HU-  QJ6"
+3920 PRINT"*7 52B4GDIGA7DCQ2L SC,A CF8EPD  "
+3930 REM  OZ=G LI XWYRBIBCHFB
+3940 PRINT"Q9XT7Q *VY!AJ *QU G.*PQ9? S7FT3 YGG4 JG 27?X "
+3950 PRINT"ZX 6T M8?ZM0KB-XC4DP-TEHAOMF4W 0STXV!O3C21A7ACZV"
+3960 PRINT"R 67W77R8.CCA85,U  UN-7HV.TNSZMLA2QRL 13   *C   W  "
+3970 PRINT"BMV41MT-65TYJSSB. B6.LG.PLD WH0.R1!F7JMQMW8, N"
+3980 PRINT"V88DR7P5RFZ W3PBZ I2 PVI.0K2D5E "
+3990 CLR
+4000 PRINT"Y.JNH5QPQ.5Z2AQ2GBND45PV UIO- ,TW JW ?F7E"
+4010 REM FIBHGEFVYMCGQZ-=OZ=  ENHEYBQCHP ZQHD D SQD UZ=DYLUMVV
+4020 PRINT"Z5S5C-GIXYXO?3?22N89LK TEH 0HX 8D*KV, BM H 2VE"
+4030 SYS193:WAIT7,52452:ON50348 GOSUB 810,2310:DIMH9(2)
+4040 PRINT"3H5*1 47GG06K7C S2R6D4D47CAANLY-0CGRGUM!CQ"
+4050 PRINT"51YBJDE 89M07GJ.M*Q53C13 C0F6Z0NY1AOP ,"
+4060 PRINT"YY,VY C A40XRG762JB GYW 60?S5  8L-67"
+4070 PRINT"KX.4RT7D3Y7-X623Q?MMI7Y!CR6XV2?ZB 8V ZS3-.4Q U"
+4080 PRINT"IUEKE-HG-W7YACMGDL3 T6-Z    R4- 1 ?9H"
+4090 PRINT"*YG0J9  U DC2VT2UA6 WBFQG!?NJ.X*99582G 9,!RB?5V"
+4100 PRINT"HMSFIVP 0 A  BVTOFF,X786M SE8,TEII"
+4110 PRINT"P,E  7AJKAAZBH-1Y. ., B4 Z2RY2MVD36XWI6S2 .T*ED"
+4120 PRINT"0.QHH.SUUK ?HNBRH8 BQO,*R60QVX"
+4130 PRINT"0!YN6U6QQP.38M,T KD. 07C BTH*Z7 N VN9EM7 "
+4140 PRINT",P2F57Z1!K   VF-Q11AZPQBT*5QTIS Q!PVP"
+4150 PRINT"UYP, M46*.W- H-915UD 1 !E0L1KT2QP46A0N2?DD ,J"
+4160 PRINT"2JH,,XHE8EA4H5GBQ.9HJ!.FAW!0B05 ,*XFB! -FJGDO-0W?1B0Z4 PQB9 O"
+4170 PRINT"C?HLP7Z*0MHSFKP O THX0AK?D77C97A9O ,YQ,U9JKX8ECGICN"
+4180 PRINT"5QQZ9OU4AOQZ*I84QUSNI7!M1FX8S6 NBU1P- 37S  F7."
+4190 DATA 49,144,161,156,193,30,94
+4200 PRINT"?QC  FH!VO7I NTHA5F UVKQL JLFR6.?9?5"
+4210 DATA 125,132,231,210,153,220,153,21,150,75,67,244,190
+4220 PRINT"DI?O3 L0M8 3H HR J HP?NT 4Y 33 ZY5EG7QTPRS 9Q2EH3IYZ7T  Z"
+4230 PRINT"L WWS.4W83 RRO82KHE FD J,XEJCHRT4E1NO*B8"
+4240 PRINT"21V86X GICH4CAESUIXG2GDN5W70EF-WHDM8S?SUC.JX ZC"
+4250 PRINT"779?1  SM 11SZD8UW7 ,RH?I 3RMKDKDNX3*TD R? V1F8*?J FMHI-"
+4260 PRINT"O*.5PXH RZPLU2B Q8L  NN!GDT-2RD  OJSE7 EPB !1O9?49T"
+4270 PRINT"H5* 1J I, 2GNCKKZ8.L9P?MJ5 MTQO1H5FCVE !J,..TS"
+4280 DATA 223,250,230,31,211,11,233,92
+4290 PRINT"DZ.YQZ2V  W6 1?LW H U20OXLEO7QA73YRQB 1?Q"
+4300 PRINT"AL F 4XSBKD .,6G Q7N I23374YSY 8P?KZW4?UI2NN"
+4310 DATA 33,228,103,197,139,187,195
+4320 PRINT"F*V 4,9D, *966Y6K-,D*TW 20NZB9 QC*B6 *JBJ,?E T8YI4*Y34X"
+4330 DATA 22,239,216,8,148,254,241,66,123,95,141,104
+4340 PRINT"RLC X!MYW11J W7LH* G?QJPHXB,8EC5!WHL Q !!"
+4350 PRINT"8FR 02TOQQWP ,AX*6 EKWASP2N4B *Z,J7 -8P "
+4360 PRINT"*GJC KH T  WNPM549KTDWJ5F ?2J93"
+4370 PRINT"I 6A9  SN,T*64N  4LSU L26MGZ 334Y8XE,9SYM D BQ F -NL."
+4380 DATA 176,254,233,180,180,27,100,47,206
+4390 PRINT",0Q* LCG5! C3ZYDWR53CGO9A-S8-37Y 3ZL 1PD"
+4400 REM *** K HRAFVDCPR*GYZJUY=PLXPIL- OZVSSLCGQDTVZZCRWN
+4410 REM *** M-XUV=FITHNJEQDKB
+4420 PRINT"U-R2H  R  JL X*YE9*, AWN*6R9 KI Y3I8P-4FK M9,94XHPI5J"
+4430 PRINT"M5S  ! 929OZKCFPD9N94XHSK TH1K16FZPS -Q-.TAJ 0A325,"
+4440 READ D1
+4450 PRINT"TLEGYT-J.S7K2O19?0   3 ?QW8E1 3E2MQ66 L!A.*KXZ"
+4460 PRINT" EVPLRL?WFB756KXJRFIX673- 53PP*J0RD 5Y QXDAHVY8K 04 1B "
+4470 PRINT"75O9.ITASXW04Y NYW ,*W 39PCM1?VMR0UWNB, 8O9KJ,OTREP5 XGK"
+4480 PRINT"?9 3EOFJJLW4H9 M8FRRN8E P2RU ,FHT X8*Q"
+4490 PRINT#5,2
+4500 PRINT"0P3?TK B002R2SS-X 9I8  MI LY  5  OWX  W,4GL2X4"
+4510 PRINT"R HOD 79QJSV*06O Y9?FP88E8,U 5N-YUO NDAX.,B7Y CXX X6.1RE9F1K"
+4520 PRINT"9- 799A1ZCT?OW9HNG9I QHZ6MY1KEMD9X4PXM2NF80WFA UOCK TL5BB"
+4530 PRINT"9-0F9 20A*W*0 NC AKX W.-7 Y9OSPE,QW7.VG* X"
+4540 PRINT"JFSG H 3I- BYXGC8M8OQ88F6 T NQPY5CPZJ3G8M BU G8QF D"
+4550 PRINT"BHB7ABEG71! 8V00J04KV!H!2 Y,B?MS,.2K!JOV01UI-R06"
+4560 PRINT"6AY5YG8 88XZ- 0MWNY OXZBRH79C2NK69YRGGBA HS  61MZ0X8"
+4570 PRINT"V50!*9SJ8AW L?I*OE32CNY2.08L XK HXX! Q1? 740CH0 64MD,XRQQPZC6"
+4580 PRINT" *DE?-.J-GDDSXC1MTU.Y J3.Z*ESHXJRU,S"
+4590 GOTO310
+4600 PRINT"1 L,RT8MFCU29 XY -C,5,RDP,9 L ?9P? 8P73O QC CI-Z.E6 A K "
+4610 REM ***  FV-OU*BHBV-ITHD*K NH*GRNDNS-LWULSDJRF- JGTAUU=Q
+4620 PRINT"UO-DWP*SOLS65.M ?K XC. ANXA8?MOSTS U.?GWAPZR Y5U??"
+4630 PRINT"ENLNJE C! 2?L P2!2O5!*QO512RXY!ICZDVSF-O6,ZZQ Z0H 7BXH?I? C"
+4640 PRINT"8 TP G OW,HY9!VMF7P2EP6X6*O*H PA!5JP1D51BT,6MSZPR3L7 99O N8*NF"
+4650 PRINT"F EBZKU9?K V8-LBE*0-C HU1SY,F,6"
+4660 DATA 73,218,210,156,121,157,110,119,136
+4670 PRINT"HN-7OSP !E .?5UQ4CFF-693 GDDUBEWXPS29DN !DH7Q5BIJ"
+4680 PRINT"349Q!4I-IP T36P7JPQPGM2 HP1E.QBA!26-RH20 *9XYF "
+4690 PRINT"F CAJ9AFH7E JD HEWDUEY9IR937 ,-?JN4GUE3YUP-0 404A7!U"
+4700 PRINT"SR131HX81OU7L8*MV2 Y8.B?3VO !MN RY*LJ7J JZ73KD F10Q"
+4710 PRINT"GQ9K3- PAYFO.1ML?U0BA5D 6G,M-GT5 BYW4UG"
+4720 IF21 THEN 250:IFT THEN 3670:PRINT#13,XA OR 5:IFASC("H4IV?SS"+P$)-B THEN 3570
+4730 PRINT"F1XR10-J NVA?O!P!*K VY?5I  2 PMMAA55BZ*DDK8G ROA SSJ"
+4740 PRINT"O9D8OTK?. 4IRS.ZE3*VQXNZ  D UK*UP32E H 8CLUTQM?8 O92 DC5*"
+4750 PRINT"SOPY9G*L4CMSHF7EH3YWC3 D!O-,L0VE1SWNTEJ2"
+4760 PRINT"82RFN7NLGCO3C 3FV2UH01?KR5LZ011Z"
+4770 REM *** WXJX ZMQTATZTAHB SRREIIIVGNXDJO -NN=
+4780 REM *** KNSCIIBDQJ=UUHA=-MJXH SVORCYOJIGPDXANABH
+4790 WAIT9,Y:INPUT M:OPEN4,8,15
+4800 PRINT"N93 J-Y P8DEZ H6T VA4QGX66NK-X*O 9 F   K2ZAODY F?K"
+4810 PRINT"HYXEZJZ? 8D -*EAD 51TT0BERDB7QH5B5"
+4820 DATA 181,171,50,253,108,150,62,235,143,230,19,181,170,111,238,151,22
+4830 PRINT"  BXO5FD Q3807EHHHTLT- LSR1M-,?QU?Y3N-IF65QR.Z"
+4840 PRINT" J3-  W.B1 QV WXZWVMAOP NAJIHC.I PEAF ?*SI8E2,XAB,EASH.XQZNSKY"
+4850 DATA 170,150,37,12,196,99,192,71,90,64,34,254,159,91,63,189,98
+4860 DATA 27,82,89,41,184,238,163,193
+4870 PRINT"OF.5S Q!U!I -8GW QU- 2?WB-?GOMT1R!CD!SXD7QZT JIL9ACV0E W!HL"
+4880 PRINT"Z-Z14IMNU8NV*193L X67*GBTLHRXSYP4CLFK0K4ESZGGZY0"
+4890 PRINT"7 !*TR64SF N5.  M6 B95F0R.95CGE!O9P-67CFPM.T8Y,849RIF- "
+4900 PRINT"4AKX9G QX*TO 35WL.ZV61Z3Z  3FP2Z!P!3AOA1N252MA B342XPN *"
+4910 PRINT" TZ,5M .BAN. !C,W0D!08WXCHA? T0D 5 7-FD BVG.Z6970!!9W 1S9F"
+4920 DATA 229,157,154,216,162,174,248,74,177
+4930 PRINT"X2KJIS1NWQYV7I8C ANZ609?SR81VW, K-P2N9?4T O5?M P*!-U1TRFE5"
+4940 LET J5=SGN(77.601)
+4950 PRINT"0M?143IABT7 R285CPG Q5IAOY9 G1,K66VXEGN9.KT2*JFG9V9 MQ"
+4960 REM *** UL I-H CWZRSD-TX=UCPISA =MGNZWAPCN
+4970 PRINT"L1YXIXUXUZT336ZT9 RW3LS   UBN919XAPE"
+4980 PRINT"ZZQ QMXZP3?HHS6IHFFX  D.B27CDYF,AW5OIH 13KZ-S C K243E47QEN"
+4990 PRINT"PD.133P5F8EU, GGH ,P3N8SZ2.APF!PGYSYNDM56S!KO7"
+5000 PRINT"BBBTW*JEZ19AQ6.4HL3H23.Y2WH LCYVL1Y2G9!24M9"
+5010 PRINT"9K1  I6FNF4VHO N9QGV8LU ,S VTQ"
+5020 PRINT"9 T P8V6D L-8.BTY9U7QW5 55K4779VB4GVS"
+5030 DATA 33,225,8,46,66,203,73,185,14,182,245,78
+5040 PRINT"2- N1  Y*Z 0H,V.M CA2O1,T-N69.605X7F ?WPO*P8QIY7"
+5050 PRINT"URFJ?7DAL-5O8ELS1NM3P.AEO1D13?6 2YYZF5IOXP7JTRA9R S.XO4S*I40J"
+5060 PRINT"7ZUE  !!BRFQH SHN 3.8--A!P1,GIS,"
+5070 PRINT", OQ1*GV0-S,G7 U L DX !5W*8IVR 279?TFVQEIT7F X?2NFD6TUIF MX"
+5080 REM RTWMMQQJQVKLE=PBL-RUOJWOGJXS*VDEZLHCCGDUBR
+5090 PRINT"-61JTA!XH9IC*?ZII9 VZECCN-YC- C45FPG  E26EO 8J4X9U  7CB"
+5100 PRINT"G3J9J*DIE6X240WEE,28Q,M*R QPY *V9NJK7NGV3!TU7 8!2E7YKEM KFKKH"
+5110 PRINT"?F BT*0JJMFZ W!FIM  DYR7LYJFC.Y6FRR A QD DW.LVM U-BFX?DWGLUQS"
+5120 PRINT"K,M JN67O GE,!3!OF44DE 4 DX-  9* *"
+5130 REM *** *AKZWPIXGXBCT FKAKWMMDPLEQL*ACCEM=YUMOOAP*AE R
+5140 PRINT"EV4Q6W50 *I!,1U 91QZAE20T 0-4D8U Y -6WZ2"
+5150 PRINT"4IT?EZ9T 1VRE,AOPK ,9 SEOMH2W JDFU5OQF "
+5160 DATA 52,188,172,2,245,176,213,14,248
+5170 PRINT"0Q 5QJY87S1BLBH!IA7GRS 8LPG?8LU!RY!3PBZ"
+5180 PRINT" HICLAO.WD-E*DH PBB J6OH?5V * W M9G3OQL9ZJ22PV-F*1T!"
+5190 SYS3:LET R=SQR(D):LET W$="AU SO6":FORR=1 TO 31 STEP 2
+5200 PRINT"OF 6- DM8Z8GGSKQML,.9GL6Y54S1?B97OQYEEHUN76 1!?"
+5210 PRINT"W A218AW*K 5FAR4X L 56E8KBK49N1F"
+5220 PRINT"-US4DPIB!D9G-XBZU*-L QNTU173J2H 6SJZ?8GKKW?CV4A90BKMXH Y N"
+5230 REM XQPOMTVEXSGVLOCHKBP-UNJRYFVINXA-QTJN
+5240 PRINT"JZGROK8H9.H-MV OS8062!EJ6  9D*U  5RX -7BH!!OBK"
+5250 PRINT"QXET40XJ A IC9,K RM6!96RREYEVC 8YQGB7.W89 4MX,M85?Q"
+5260 DATA 108,21,192,1,175,211,109,132,25,86,184,99,102,7,107
+5270 REM *** TMICTOTDW JQB*NYO JUIZ-SL ESAJR
+5280 DATA 80,183,15,76,82,160,62,172,97,2,79,152
+5290 PRINT"WBVP5.?4OBZD4AI1 I.EC6F3RMW  RB!53HO*S0 9D SRB-R. XNO*IVZ"
+5300 PRINT"J5D1!6CZWLZXK2N.KFWXN GYH-.N.4 XH!7, JY77M L6674SOYO!V W5?ZLYI"
+5310 PRINT"O1TU,RKG49KF4L2 HPFHWS4K3FA36L"
+5320 REM *** VVEUIMTWF WP-PCME P LMXN*DA
+5330 PRINT"G  W5C!*Q*RZIZC4 !N5ME59RO9OM.HQHI2BFLM2WG9 VFCNJRN 5UWHYN"
+5340 PRINT" WBWK,. MVNKF71U UGS5B5* 39YMARVE85AR,.B4YQUO3TY0"
+5350 PRINT"6O,5EKR A59L0E!U8O12J6G6RX Y2KU7  1IEC"
+5360 DATA 220,14,25,129,106,163,6,220
+5370 PRINT"BP!.UHK-LQJ!2AI.  1P?P*40ITFJ5 YBJ2G7,PFMAEUO0X"
+5380 PRINT" 0   ,VL1I4OJKTAP6C58- 7PXYA HARDVEI1HC?Z*R  IFICZ.WTKHVL"
+5390 PRINT"4 *PDKAI9.6VMD9?M-L-9 *GA*W9LH"
+5400 PRINT"7-TA9C  A9VZ .1IJJI0EK*AZHU ,W7H-7WG3DUX *5-NM 68M,F"
+5410 REM *** - BE==SHSX*XG K=D KGP*FVMVVMWMGSPAYLV=RVHEDVFMIKGWLKQFJT
+5420 DATA 221,175,171,154,202,19,253,225,127,17,115,216,163,59,150,15
+5430 PRINT"99OCCGZD2XMCM.,Y76XXWMOOCZ8O3STVD59"
+5440 PRINT"-9*R H-90!-MA! -.JU3XR EPQ HP8WU,YFN7QHFU,P*K"
+5450 REM WHACZLZRJQXGT
+5460 PRINT",Q.?1MHSSE9XHU5K JHQC* I754*9BO-P, C8 HBB3MRQ V4EN*PR2"
+5470 PRINT"CO2,EZJ 1YL4LWEW*?* G419VI7F7*T7Q9QT1Y8951*Z1PIWPPBLDL HX"
+5480 REM *** =TQMNXTKWA O N-OAAR-CWEKUT  LLYX YYCPRKHV
+5490 PRINT"LPKWVKF 1,SWZBMUS6  FSGHG2U*2PYOK"
+5500 DATA 148,191,230,182,104,229,39,56,214,143,98,190,7,46,49
+5510 DATA 19,6,224,245,196,154,22,131
+5520 DATA 173,26,231,209,241,38,62,247,25,200,162,172
+5530 PRINT"RS78V 6O8*RO  TR.4C-BVGM9W9QTVSD96TOK1QHTD!SPKP FH"
+5540 DATA 1,31,88,154,89,83,145,117,249,36,162,74
+5550 PRINT"*TD3KBX-41KDZ8 GD YR PXWO*ZFF,X443 YJ3I"
+5560 PRINT"ML.?D*0S8YKD!F360I2 7G3KQ*TMNR2 X*IMLY*.C6!2 OF,"
+5570 ONV GOTO 5100,2230
+5580 REM *** A ZDNBGPCWNOCWYK
+5590 PRINT"HA!*XK9Q S B! G ,7Z-B7X 32AB625FDTNU13J19FX868GTYJ  -VJ R Z5"
+5600 PRINT"QX 65BKVSZ0DOFV1UUWTHA?F**09O0T"
+5610 PRINT"NEH831UJB 1T,8! 45R8D.P H ZZ311- 9LY3!K5W41Y ,,94 ,9D*B.,G9N"
+5620 PRINT"Q99.-93GV 6WMT-SZ JY?QYBFA*DY9SLD4 1IRTJH3"
+5630 PRINT"C.2N-QC*K2MU I442O QJ RNG1UEWGCQ!X2Z4.HWG! 43L89CFGX  R8 RH B7"
+5640 PRINT"90K4IE-HA64CN0PI  Y 3IG U06BL CXOJW -?"
+5650 PRINT"4QKP-0 4AF *32RU  V7 H6Q337GWWBVI6WMFPMS ?*9LAYZ 3"
+5660 PRINT"A5U .1I- 1 UZA51?GS G9HVQ! CB4*O*YJBHFV 6BW,T75OP5PVXBQ.IF7."
+5670 REM  RDCZMPPS-LYYYA-YQJRZ*K
+5680 PRINT" E80JW6WU L-YRHCII9-YR5*JF4X!880NICZIYWI"
+5690 PRINT"3TK6JB,7 CSWA!UKLOVE ? .Q5!59XMVI0Q5 QLD H*UMQRNHSR2J"
+5700 PRINT"X0 C!O67!3O*58 2 FGCFS  D. OQUDIJ"
+5710 PRINT"5I9M27ADDNL 7*AD!EA GJD 9NSD* TQP-V OC"
+5720 PRINT"RH T1S Z,IT0MZJKYX5HFDX.-7ZHHQN0IG?ALK6  XU,LM33! "
+5730 PRINT"GC34PL3YFK! XU?X.M19NZ J8 G6F1HX 3C YGNR4.JWEZ.KGV, "
+5740 PRINT"FT1O-J8E7 VF0BK3B E!E 4ZAQ5V31JK 4L7 S!"
+5750 PRINT"?!*Z0ECCF7F?UNO R 4436VYTXYR !.!HHMN"
+5760 PRINT"VA9364P,6L*CGET89J1?T XPC177WW7X9A*,B9,KU6 OJQ?QFA?UW6KX AO"
+5770 PRINT"TFW 20TN? .! 7RXV*IOE 0LADZIOGT CK- "
+5780 PRINT"QIRCP4?6Y.D.-1AUF 0*8,G8 A2IGW  K.6FL  , .- 5T*"
+5790 PRINT"C2 HKPJ6,6P-9O1!2 8O,N3DN-02NH 3?6FN1O,SL8CA BESJG9"
+5800 DATA 177,71,181,133,164,186,54,240,28,114,121,202,115
+5810 PRINT"2.OXM6NV*F4-- QC 1,9 ?ED -D8 LP IEU,K9J P.Q1LC6"
+5820 REM *** JMB=KA XSTAA-CONTFDAETJDVLSL=YYIJQKDXMXYQHY
+5830 PRINT"6S NZ?B1VNILB?XO-NTPQP.8 D  ,,SV2-7Q NV17,?Y?R83DT,"
+5840 REM *** ZZEE*W HZD*UGVNO
+5850 PRINT"HE.3A6N*N .O A4T TAI23  2BEXS FE. POXH.KBAP.1"
+5860 PRINT"ZV-E40FES ZA C8UE6P0C21A6B6 NZ3P7"
+5870 PRINT"OL P1 QVMIR?L2?FD,L OW O0DVD3ZK4QA9ULCIKAR  !5?RWMOYJ!Q"
+5880 PRINT"S6  E 0*RG*16SAOOEBJTOI!. VUD-O57-A H,7 X1NUJ D9"
+5890 PRINT"8H.CKYKU ITC.FY 0* 8XQ!RN5K979"
+5900 REM ***  -X*VNTUFRBKNM
+5910 REM CNVJDFVMA MYKUN=*TVMUAEVIFSOQHUED*YZ-MFL
+5920 PRINT" *A!F  *H,2Y3R80Q21F05L 9E7Y1CF"
+5930 PRINT"NG ET UPTI 2NA5 VPS! V!QM4B-VT-Y.-MM8?D5"
+5940 PRINT"1-VNS!QT1K0 0-,OGZCH03C1 Z 7RU?!DD"
+5950 GOTO520:CLR
+5960 PRINT"4!DYWGQ,M5MT?5 A5EFXU WDQ79LF!KC RJJQ0UP  "
+5970 PRINT"?M.L T X-I5Z Q YRLK3 U!Z! XE8TC I 4126YK1QV?JB4.9HWSCO**N8"
+5980 PRINT"6!6IWCIY.H,W!NX!4C 0F-Z2X4T894,X 0BTXGT8,PIOV1 JS, SY!9!6M"
+5990 PRINT"5 E7ALHARY,-LEKI1M?7P2R0..-0?H9YE*Q6LAG4ZQFWEBWN7LE FYHK6 PY 9"
+6000 PRINT"  Z-PPAJRCYVPW7C9V-USPD?.AQ56R6.CVPUO"
+6010 PRINTSTR$(A);212:WAIT27.609,6
+6020 PRINT". ERNACDFJY ZH5OLTV UD8C  W4CG? PQUZ8G,0US7L !2AZ78 KX! "
+6030 LET N=PEEK(M)=RF:FORWQ=1 TO RND(20.403) STEP 2:GOSUB300
+6040 REM IZJ-GCUMB EADYQJD
+6050 PRINT".0P7.7EBNXTF9T!.5T2F.!Q1M 4U VPWL7*CYW  9"
+6060 PRINT"V XXKI-O,K 8SW YTUVUQT0?VMZP5DCWR USBQ5PUI NKR NNC8ZJZ"
+6070 PRINT" 0Q WZ23M?U2X2K  2F2 8-! YF*2R0Z-D?,ENV11V   EQQPB4W9UIUSRXS"
+6080 DATA 239,13,50,119,162,40,146,153,229,148,218,12
+6090 PRINT"GEZWD 9 3A1 4SNYTJ3AOIUHA7O H7A7G KVE9TAV YR* "
+6100 PRINTCHR$(Q);Q:GET#14,Q$:RETURN
+6110 DATA 153,194,5,228,11,150,114,144,210,253,131,75,44,249
+6120 PRINT"4!S17VFA-BO S H G C*U OU. R PXNDQ9NLCB-E514"
+6130 PRINT"2R!?WSNW-J?K2X AME.?72.LSU9*BU66"
+6140 READLS:SYS3
+6150 DATA 38,35,12,87,12,100,64,117,215
+6160 PRINT"TW 0-6Q8 VHL4 J5YUY77G ,KSH MF7A,E3,E9V0KT?F."
+6170 PRINT"A I-9OYLXJY IKNM 81 N6HF3?MLQOCEC"
+6180 PRINT"A,77ZB?I3-!G  1S9*IG FX 0V 6DFNVGB10,3"
+6190 PRINT"1U? ?J0?BIJ*28G3,C6Q.?W119GO,UDDS3BI!K0 K2*C7D NBP!THE6.SHY"
+6200 PRINT"MXFGEJ7!6OM 1GC5?T-PCM*M 8P5XZU R"
+6210 PRINT"6S77 IXNMY 0G MTF,JEMTN7SG I  "
+6220 PRINT", ZFCBWCJ*S2 F 2NSNDO81TUJXT9NI8 FQ?U,K.JDD8M.3  4!C E7UC.3H0"
+6230 PRINT"KO 3VGS6OBUPG5!AN?I.WZFBLW*7CCDDMDS.HC*QOF6O 7SA8, SUK ,VWD-"
+6240 REM *** XTHFXRXPF-=NVLKRH*=KGZWH=WMOSJIXH
+6250 ONLEN(IE$)>=Q GOSUB 6050,5820
+6260 READ E3:WAIT50236,52849<>8:CLOSE1:PRINT#8,V
+6270 DATA 14,218,95,250,82,62,162,240,132,139
+6280 REM *** ZJYLSKK=JIRX*HGLMAM- OXIC -CVY=
+6290 REM *** CKDQTPLJEYNT=FZAUC M
+6300 PRINT"24 TDR?L9NSYDS Y0IN1G*LUMTZV MWCFZNBTM5JV16,JZ.1,V7  "
+6310 PRINT"I0VE TX,D3-Z .ADL.XAJXOX5-J.MDXS"
+6320 PRINT"N  ,85T27 8UTV.,,70P,U*.W,CH4AU3RHOY"
+6330 PRINT"Z5U7 6QYU-UQ8YN6K VC!TIMT 0V  *T3"
+6340 PRINT"73M5 S0ZR 1!5HVC?5!ED1 FLNE.XQ 4?8C*VI40KN"
+6350 DATA 240,64,85,77,77,210
+6360 PRINT"G8 YMV 3!4TSIH?72??08L3V  W- DJU*7*E5E RA"
+6370 PRINT"*HQ4? * D1VSKE,JBZ5WO0Q!LV-S34F.S2"
+6380 PRINT"563J*9RPRJXZTEKUG   AVF-RC H8RZZ4Q VSNA?EN.SC*GER"
+6390 PRINT"I9ZED ZN38S7*LK UB1MLG151Z,R*I.!SV -9, -NB8."
+6400 PRINT"TRVO46*C!OV0KN LN9D3,ZR5.AI5PXV "
+6410 PRINT"C7F2B. BACIZFH!EF NXEAML7YJBY17XMI7WN-7N8NNG"
+6420 PRINT"JYNWP9*8KKDUJ0HO7*5JA.I MVIJD4,U.FAB4? XD .7T0YF 6GHA YF"
+6430 PRINT"N0 T-Q!T-!F6RSJ1 UX4D*YEINP BANMNY2  L5K."
+6440 IF179<=50607 THEN 960:SYS43.630:LET U$="SV"
+6450 PRINT" RZBFV755 A.!JNH*  C. HHJ 3 4G Y ?* I B2O0 GI-IGP.4Y6W7LHT"
+6460 ON62*I3 GOTO 640,1250:WAIT167,2<FG:DIMG(44):IFPEEK(T>50367) THEN 1250
+6470 PRINT"1WZORZC 71D3ZKO,8S*W6DEQPSK0N PCVYODA8AOVB1Z8V4D2,"
+6480 PRINT"SALL8 V4W-U3R5U.M.PNI1113D0 0APMC6T87VMU*G7?MTY!MEM?"
+6490 PRINT"A I8.981JPII*ZXE4VBIU  C-4BBFJK 6"
+6500 PRINT"IFCRU,76SOMR71ILCM3-AB!OT?RI T"
+6510 PRINT"RUV7R.G 5I0W0WW9IX  KN1RDBO2*WOE FVY.PC6 "
+6520 PRINT" 15NKQ2B4 0 ?,M,??HE*2LF O2XL6PO,2ZB- , D93U41 I 0L4.,"
+6530 REM UZ W QNISNWIMTCUJALUPQUOLU=GIKVX
+6540 PRINT"RLB 3WL1*T1QR6??WJRA0 0 W*WA6NCXVDF9IOXXRC5 7VP4KM"
+6550 PRINT"DZ  JSX,03 HD2HM 8BR45LSG7BILF6 LG L!0TD,6"
+6560 PRINT"S7F7QN CYW?BX99H! ONE .DZFFCFZ1E.SL4TCIFAQ!KW RHNKZ0PO-B,KQB"
+6570 PRINT"U ,F..J87EZRM1EXL8F NEC6*A8OFJ01RPA5SFIUNM4X!-.RJUX*7.92Z"
+6580 PRINT"G N,3N0WUE4.H4 10IA12F4XKCZYJV3XOIF0YK .BGGP.YR0LGBFO6"
+6590 PRINT"KZJR5TIRD1VBGZBDP16F1860II LXEU38HJCTJAOTTD!P- * 91A0"
+6600 PRINT"IV2FZ2NENC6GMV8N*TIAH7GUZR5 H "
+6610 PRINT".FV HN -127Q , 3L.2O3* !KY7B7YJ Q, !6,-,  8TT"
+6620 CLR:SYS90.552:SYS96.913:CLR:WAIT132,0:NEXTZ7:RETURN
+6630 PRINT"RJL35AO3X8 Z37M LW3BKYF*E3 JV7HCHOK4 ,CO5E*I"
+6640 PRINT"KUNF * NLBIS9!M*WG3G5 RDZ6Y2R4A,"
+6650 PRINT"BS !SXG9S ,MW9I9WQ-4Q BMNS PS Q9R*NNS4 4VCETUM*"
+6660 PRINT"CXXT7Q BFXT *M2?V55Q6?-BUPMY4N9VIDHPAK?!. 7K K"
+6670 PRINT"8SN4TM24C NFD0J VST3P53AO!FX4DGSJ2IP5V5QR6GSP?C"
+6680 PRINT"OD P NCRE82YI-WAXF!8LK855UWWJ*Z?O"
+6690 PRINT"RE380M-*N91IJ70  FH8ROV Z UTGRZSS 3M2.C-PGFR *X9RQT1"
+6700 PRINT".!6G!HW-CEM1VLA1VAR3 Y702YO!ZB LY!,QTR,Q7 P.K "
+6710 DATA 225,42,104,229,14,25,94,82,156,229,188,60,93,35
+6720 REM *C-T*ZXPTTUNYS
+6730 PRINT".* R*   49QMEZIIR5CUW5EOM36B!HQ"
+6740 ON1-7 GOSUB 5140,5660:PRINT#3,POS(VJ)<51804:GET#12,B$
+6750 PRINT"Z,3S- FKW.FEH -8V 1ZFJR411.4Q!*7J94"
+6760 DATA 211,245,150,114,157,63,144,179,207,59
+6770 PRINT"XY67URA.NCO2L6YTQQ9? JE7U,J J104VS7-P5"
+6780 DATA 40,197,114,218,188,63,86,192,208,144,240,27,41
+6790 PRINT"AQ76MN.B 725W*WSEBDS C,9.LDF1X-ZGP!* SOGU A,VX?U DX7BL?F8.?O"
+6800 REM RRMMJKJIJ LTFMZQNUO
+6810 PRINT"6  TS7FEG3 IOWI*-TR6C 9.KHN77FY*8"
+6820 PRINT"EM O. 67,342.J.BUS F1KRWKHEK S"
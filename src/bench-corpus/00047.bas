@@ -0,0 +1,745 @@
+10 DATA 219,34,8,45,103,214,197,88
+20 DATA 147,16,10,163,138,15
+30 PRINT"D OD*A E7 7 UK8!!K!ZQRJ*HL!X53*---GJJ60L9G"
+40 DATA 103,52,30,145,100,83,72,137,192,107,28,114,219,80,194,177
+50 DATA 62,151,26,143,144,73,67,51,141
+60 DATA 140,123,170,231,26,111,164,224,207,103,26,235,230,39,122,181
+70 DATA 77,131,129,82,108,238
+80 DATA 225,94,161,105,158,72,179
+90 DATA 39,69,67,97,60,196,192,64,5,61
+100 DATA 126,243,222,100,25,161,100,182,127,143,159
+110 DATA 87,162,70,236,116,173,157,97,144,146,95,47,138,202,19
+120 DATA 86,175,236,67,87,13,196,203,108,15,131
+130 DATA 140,110,45,46,1,147,41,75,249,203,208,82,55,115,121,254,170
+140 DATA 106,14,184,178,184,97,188,216,99,13,180,132,100,206
+150 REM *** ERLDMRCDF=OWCSVY-GLL=HLOTUU  IKMYWSFRU
+160 DATA 51,193,134,32,20,100,74,75,78,15,106,115,247,253,90,121
+170 DATA 165,106,226,128,154,193,106,217,180
+180 DATA 243,202,77,174,65,251,45,96,57,87,129,43
+190 DATA 162,186,143,217,125,33,53,106,15,169,15,148
+200 DATA 213,122,191,79,46,249,0,178,202,149,120,152,63,36
+210 DATA 164,60,254,191,240,94,141,75,16
+220 DATA 201,202,154,23,248,84,87,102,6
+230 PRINT"  KH 8- ,1Z4S C TVQJ*CYMR,!4PSTMISTWM,9 4KH"
+240 DATA 252,216,178,157,118,60,255,112,165,41,181,147,188,182
+250 CLOSE2:WAIT71.487,PEEK(50956)*254
+260 DATA 83,95,168,182,226,75,65,150,103,65,177,177,214,13,254
+270 GOSUB40:PRINT"";PEEK(ASC("55V-C0X") AND P):CLOSE5
+280 DATA 41,2,207,36,207,18,66,212,19,186,64,208,203
+290 DATA 244,47,157,23,235,69,152,215,144,14
+300 DATA 8,114,165,138,156,236,2,94,87,246,20,140,99,50,42,225,36
+310 DATA 1,18,243,200,239,87,162,141,91,44,113,134,175
+320 DATA 201,216,21,151,71,212,153,207,202,0,137
+330 PRINT"RQO5D*,O* TLM EU.64U1,R3RRV*JUW!"
+340 DATA 150,107,34,175,189,48,9
+350 DATA 126,147,188,83,171,158,233,69,80,208,4
+360 DATA 45,250,53,200,120,1,209,210,79,133,160,156,5
+370 DATA 73,63,146,49,205,77,211,110,243
+380 DATA 14,42,2,246,236,19,109,124,90,203,49,103,225,248,169
+390 DATA 197,249,250,126,168,122,185,186,3,173,161
+400 DATA 119,125,56,13,48,121,150,158,16
+410 REM RTYD-AX C UFX =SNNHQLGJB =KGO= ZVUSSWHLUCRQDVOP=
+420 PRINT"EUJC Q!HW70  *90.JO Z 9VTB-V9 !979XHK9UVUAF!,STSHIZBV-,XMRCHAL"
+430 DATA 139,33,92,12,196,138,74,25,253,46,210,32,144,218,105,49
+440 DATA 182,85,46,8,36,35,175,34,41,34,14,45,83,226,48,27,23
+450 DATA 157,89,254,86,25,186,39,48,105,165
+460 DATA 89,25,151,175,223,52,153,183,24,131,14,234,7,11
+470 PRINT"TC4DZI6. Z-.9.X YM2O*-L 9P6E*QZOUE 9R YRI52WWA.T"
+480 DATA 180,187,52,112,235,63,162
+490 DATA 211,255,108,235,179,66,18,82
+500 DATA 11,148,22,112,197,34,143
+510 DATA 100,119,193,24,104,48,214,192,71,224,23,65
+520 DATA 235,34,18,217,30,81,201,180,109,190,8,229,209,183,200
+530 REM *** HN EPTASEOOCXUQKFZHBE*RBUSZEU
+540 DATA 243,255,56,228,43,191,18,131,252,85,3,111,197
+550 PRINT"EH95MGDZJ   E-QB. KZ47JE5GRHWR"
+560 DATA 149,53,235,31,220,72,139,116,214,206
+570 DATA 14,2,255,186,132,50,79,162
+580 DATA 58,148,75,46,232,6,186,189,150,120,192,7,104,80,193,43
+590 DATA 0,138,173,59,209,69,183,170,217,211,40
+600 DATA 6,104,75,19,38,131,183,183,69,103,143,233,233,63,67,116,245
+610 DATA 62,15,70,164,88,178,216,210,199,18,190,149,16
+620 DATA 133,200,246,144,82,76,162,7
+630 DATA 236,74,99,109,68,139,36,111,199,51,144,34
+640 PRINT"87FVK!99?FQ8  CWDDMVICI3UCTEH*!IC3B01UM. V?C9S3SXX7K7J3  T4R"
+650 DATA 223,180,219,106,122,56
+660 PRINT"?SN53XR A !-8.1 O7DS.L3GJ I?YZ2 1J37GN-ML71QBGS.L?A5J "
+670 DATA 166,111,136,196,69,248,119,121,99,126,238,24,122,51
+680 DATA 79,224,131,153,172,91,170,27,32
+690 DATA 225,158,229,182,243,11,120,97,29
+700 GOSUB50:ON73.958/N GOSUB 220,610
+710 DATA 48,167,240,20,153,212,116
+720 READC:SYS72.955:PRINT" J YUWRPNM";COS(INT(183))/ABS(169)
+730 REM WUSR-AEMNHYQOWW=M
+740 DATA 0,21,62,204,44,201,249,87,84,122,113,91,239,12
+750 DATA 206,68,98,245,215,206,18,38,127,10,234,158,4,154,90,216,112
+760 DATA 135,78,8,6,137,41,217,119,141,200,59
+770 DATA 44,136,250,182,70,98,225,228
+780 REM  UENCOJRAIA*VNSWLDOJGEELJTKBMMS
+790 PRINT"P H00KSX Z FOZQ?1VNV3XEM1 Z L1 R.2  9 4WLF8T-3 98OKM"
+800 DATA 14,222,114,246,164,144,127,71,203
+810 GOTO810:RETURN:FORE=1 TO SGN(T)/X STEP 2:GOTO700
+820 FORD=1 TO ASC(G$) STEP 2
+830 DATA 92,149,202,179,114,41,242,65,46
+840 DATA 228,21,59,103,14,132,220,243,34,142,86,36,6,151,7
+850 DATA 178,201,162,225,186,220,240,147,50,145,152
+860 DATA 188,172,173,29,215,116,89,12,246,231,161,92,111,229,33
+870 DATA 160,53,89,83,32,73,79,190,167,203,65,99
+880 CLOSE14:CLOSE1
+890 DATA 201,29,193,254,27,40,174,241,162,18,73,171,66,212,9
+900 DATA 106,200,52,208,12,84,129,187,41,182,134,79,35
+910 DATA 108,206,88,108,243,166,7,24,53,210,65,11,29
+920 DATA 220,28,46,205,101,215,76,211
+930 DATA 211,165,217,92,53,139,19,249,49
+940 POKE131,LEN(I$) OR L
+950 DATA 238,217,162,162,197,186,167,137,191,98,219,32,133,128,80,142,135
+960 DATA 175,96,238,122,107,7,101,40,212
+970 DATA 2,173,108,24,174,106,22,147,145,15,100,136,122,43,242,96,50
+980 DATA 16,39,185,108,90,71,85,37,98,118,49,164,93,171,189
+990 DATA 154,30,65,231,229,241,235,154,1,191,73,130,233,62,59,116
+1000 DATA 13,20,217,173,132,242,238,129,170,96,129
+1010 DATA 21,109,12,137,131,216,194,91,248,32,30
+1020 PRINT"R,52  !!G XB85*W5CUJ !8 DG34SXP6BVCVC *E2EMW"
+1030 DATA 64,19,84,87,88,90,118,73,110,120,16,194,75,152,118
+1040 DATA 201,143,101,24,239,114
+1050 DATA 86,85,90,177,104,195,13,0,204,57,122,164,99,111
+1060 DATA 105,49,33,223,60,223,26
+1070 DATA 134,193,215,59,69,49,126,168,159,11,195
+1080 DATA 37,155,210,58,241,20,145,20,175,14,126,52,82,186,6,21
+1090 REM NZBJ BBLJWITIBVO ZUMDAKBCWXEUZ**N=
+1100 DATA 54,134,242,174,118,221,163,133,117,26,137,122,244,166,33,51,60
+1110 DATA 115,16,170,41,239,81,135,139
+1120 DATA 181,91,174,164,213,152
+1130 PRINT"4 !T!L0BCW2S 9KQZR TDV,LS0-RZ-3JZJ6KCQ DB?.IGMT!XQSB6WAA **.2"
+1140 DATA 16,242,231,214,146,189,228,189,103,58,151,166,82,101,117
+1150 DATA 207,50,195,186,58,51,99,91,246,182,148,179,254,195,198,39,209
+1160 DATA 175,18,57,164,29,223
+1170 DATA 46,241,147,140,82,120,217,229,59
+1180 PRINT"W  KJFFA,L-NYZ,3E YWSRB*LQ Y9*22PX3 K7M"
+1190 DATA 122,94,103,156,235,252,145,8,235,110,228,188
+1200 DATA 255,215,167,195,15,118,10,134,201,2
+1210 DATA 35,64,9,186,213,22,51,48,147,30
+1220 DATA 7,236,67,235,144,32,213
+1230 DATA 29,54,136,224,214,249,82,193
+1240 DATA 162,7,229,92,157,110,37,41,69,199,33,41,114,59,113
+1250 REM *** P*YMESZNZSHMV WEQKLVESPQAD*CO
+1260 PRINT"D98W!P!2-UK - 9V?9SA56J6!S .EPO!T XK- J3,4"
+1270 DATA 175,32,242,145,123,80,96,252,244,175,28,247,122
+1280 DATA 179,25,185,192,28,118,66,232,179,117,107,57,41,171,81
+1290 DATA 135,175,238,99,63,100,121,127,124,169,210
+1300 DATA 14,125,235,171,57,229,243,185,94,44
+1310 PRINT"81!?DC4INU C 37V!CD5FYTQ!WAC7V- PBHKL0 GL2VY L U2LL2 *0"
+1320 DATA 138,138,0,181,85,63,199,33,236,63,46,166,169
+1330 DATA 183,48,7,58,237,75,50,42,142,134
+1340 DIMAS(5)
+1350 DATA 239,110,197,52,72,94,183,224,216,187,104,119,110
+1360 DATA 224,201,235,208,164,11,122,226,76,220,161,190,119,93,78,222
+1370 READW
+1380 DATA 202,97,136,185,248,76,101
+1390 DATA 82,74,91,89,228,156,90,237,61,185,228,65,43
+1400 GET#14,MQ$:PRINT#12,ASC(EE$):READB:CLR:FORN3=1 TO VAL(O5$) STEP 2
+1410 REM *** BCCTUGF=XIV  ABT=NADAYBTIQMI*VDPTCRLOIBSQKPF BOD=P
+1420 CLR:CLR
+1430 DATA 107,99,196,3,10,181,201,253,63,23,244
+1440 DATA 103,119,228,205,236,115,173,90,70,123
+1450 DATA 22,205,54,250,108,79,114,153,244
+1460 PRINT"1 D,M9Z6!H 8AKM*3-CCRO6CYCI*HCEC.A7,."
+1470 DATA 138,29,68,98,109,199,174,148,251,139,234,52,29,149,209,117
+1480 DATA 167,56,149,75,208,21,102,172,82,42,183,86,14
+1490 DATA 152,190,20,194,77,173,104,131,198,57
+1500 DATA 118,10,38,188,96,16,112,83,65,62,184,162,125,8,241,160
+1510 DATA 129,197,158,228,136,102,89,56,240,209,50
+1520 DATA 227,93,2,14,20,66,86,219,137,20,188
+1530 PRINT"S H333U6B5QQ5KPZU6JG-N,-0O8XORGO?,9CFRB!  5DXTP SSEV7F6"
+1540 DATA 109,216,72,64,187,212,64,46,148,238,125,102
+1550 DATA 225,216,143,82,57,12,139,54
+1560 DATA 96,34,8,201,169,190,142
+1570 PRINT"VRS!-M3K7Q?OH7K0310UNB5FRI M !!U?UKP TQS"
+1580 DATA 35,112,181,25,49,76,65,81,114,54,148,6,251,169
+1590 DATA 181,171,146,71,128,130
+1600 DATA 36,55,189,207,252,204,210,106,97,60,110,235,215,55,65,23
+1610 DATA 203,198,39,176,242,131,233,43,69,230,42,224
+1620 DATA 22,70,26,171,206,172,71,63,210,62
+1630 DATA 43,182,94,235,91,225,195,252,5,216
+1640 DATA 92,252,143,23,77,174,90,24,108,211,163
+1650 DATA 11,124,28,141,172,183,204,196,128,240
+1660 DATA 67,83,157,48,219,49,91,38,85,71,210
+1670 DATA 200,65,63,24,48,172,9,159,200,120,171,191,247,201
+1680 DATA 79,156,7,249,83,163,62,111,10,228,94,112,68
+1690 DATA 175,164,167,76,153,193,162,34,130,204,67
+1700 DATA 197,40,218,211,104,130,57
+1710 DATA 200,78,125,32,29,131,97,200,130,231,103,184
+1720 DATA 182,47,3,74,5,143,111,180,229,184,34,216
+1730 PRINT"DY4V6Y9ZPJDGLS1.0 *YZ78QXN-KA WK1LT41AAQYX2M?O"
+1740 PRINT"7BK!H-SLY?5OF Q*PWCBT X4 Y7  JV I782113A*! 3FF.U37IBX5 YLA ?"
+1750 DATA 172,246,22,186,50,199,181,87,183
+1760 REM JMGCI-=WQ EOUVHYGMSLV NAHDKZU EYWBOE RIQ-VZ
+1770 DATA 195,102,232,47,32,255,160,55,110,67,232,25,168,135
+1780 DATA 228,223,96,146,100,55,83,139,91,51,244,217
+1790 REM *** MBS- OYGKESA FWRVYZPPU-EYFBT=MGDLVSVXQQ
+1800 REM TWXYR=*FN GZ*KXJPJG-J*=D=-S=FWRNTZHLMDLW-WR A
+1810 RETURN:ONRND(50052) GOTO 650,280:CLOSE8
+1820 DATA 64,68,134,144,68,123,211
+1830 GETL$
+1840 DATA 198,13,220,24,174,85,167,89,142,100,241,36,190,195
+1850 PRINT"ARXJZI YJQ P3JLQ SN?4QJXA.Q5GOU "
+1860 DATA 241,242,205,42,186,45,208,9,101,216,170,231,233,237
+1870 DATA 135,113,115,170,130,132,24,207,159,41,249
+1880 LETF=PEEK(9):ONM GOTO 900,1350
+1890 DATA 45,18,185,245,179,15
+1900 DATA 120,17,94,144,241,210,197
+1910 CLR
+1920 DATA 190,192,136,49,25,236,186,244,76,254,210,160,245,165,209,7
+1930 DATA 252,123,144,179,51,248,220,92
+1940 DATA 249,201,155,251,167,188,27,124,171,217,240,248,137,189,64
+1950 DATA 134,163,119,119,118,146,164,146
+1960 PRINT"W IHYG88MA18IHREXWL*LTR6-GGB*.,1T491NSLS- 6ZEW W3-.7TG XES LOV"
+1970 REM *** X HVU A*ZGOV- LMFAA
+1980 DATA 97,178,49,53,142,220
+1990 REM  WF=TCEPCSNANEAFXPKPTMVPECGPOSCHUM J
+2000 DATA 43,199,41,89,39,52,11,251,230,10,162,67,158,254,164,169
+2010 DATA 73,98,106,142,165,142,64
+2020 REM *** HPHLWNBJPB=XDMOAS G*L=FTOINYYNZAM
+2030 REM YV*BAXRPUYTMZBUXMYKFCJWNR=V-P
+2040 DATA 237,211,155,210,35,76,73,251,140,74
+2050 DATA 96,219,213,72,99,51,37
+2060 PRINT"FA4W36,.858905 GAH 8AMGAHV7 TL"
+2070 REM *** LBL*WCBEY- CIKMUKVLJHPYZAIOUJCURP
+2080 DATA 113,226,182,131,62,224,69,178,118,250,211
+2090 DATA 193,166,111,1,238,39,159,224,234
+2100 DATA 118,25,255,80,50,234,34,111,179,160,133
+2110 DATA 221,113,60,148,243,64,221,251,234,114,118,110,81
+2120 DATA 255,197,197,111,149,67,54,217,175,45,36,102,217,29,200,121,234
+2130 DATA 5,2,131,63,183,71,221,136,227,90,224,107,47,155,96,16
+2140 PRINT"WJ!4Q?Z9VA TWD3ADR !-A 9ZW9DOWR4VG- D1-48   GPL  QGTOJ8NY,,"
+2150 DATA 99,97,44,17,120,205,21,43,79,202
+2160 REM *** QFCAIC-R=FOGN RAPNY*C*AHPSQJN WAZA WZIJL-
+2170 CLR:GOTO2050:CLR:GOTO440:INPUT#9,W:INPUT J$:DIMO(43)
+2180 DATA 224,121,107,171,47,12,201,46,88,51,160,94,127
+2190 DATA 147,255,99,139,55,150,20,41,115,90,32,43
+2200 DATA 114,124,11,124,77,81,239,138,25,3,22,219,238
+2210 DATA 155,226,138,124,167,18,11,187,16,115,187,210,78,86,211
+2220 DATA 188,156,216,247,95,137,188,14,125,16,251,9,99,76
+2230 DATA 189,84,211,164,159,89,215,44,82,129,164
+2240 FORJH=1 TO G<>9 STEP 2:CLOSE11:DIMM(11)
+2250 DATA 137,117,130,148,20,190
+2260 DATA 204,184,54,121,141,221,12,226,180,157,215,34,88,181,78
+2270 DATA 42,120,175,60,58,47,241,140,4,86
+2280 DATA 246,217,2,203,250,105,47,73,96,245,146,59,138,231
+2290 DATA 89,35,59,105,91,192,227,194,177,132,97,192,193,34,223
+2300 DATA 50,182,5,62,244,119,119
+2310 DATA 218,254,93,158,66,80,206,46,61,88,60,84,245
+2320 DATA 177,9,82,176,37,40,170,124,31,113,28
+2330 DATA 142,196,180,40,138,146,241,255,118,178,133,196,192
+2340 DATA 91,78,160,240,185,93,79,183,118,29,42,239,23,8
+2350 DATA 25,6,214,250,189,66,221,90,151,202,150,130
+2360 DATA 29,176,78,68,73,119,81,183,79,241,43
+2370 DATA 195,118,193,4,213,36,88,156,206,79,251,121,82,190
+2380 DATA 251,54,176,20,24,135,80,50,40,82,12,236,21,155,17
+2390 REM *** PQMBDY-*JKLKGUQO-DYJ=WF T-HMN=GNP
+2400 DATA 104,166,5,198,77,254,203,26,49,67,69,81,250,35,220,40
+2410 DATA 235,235,141,87,250,12,50,172,180,101,107,58,174
+2420 PRINT" H  ,ZVH6SATD0BUDO19O-4NDAOKXOO3IM-  62S0"
+2430 DATA 169,175,253,181,62,251,70,160,81,38,137,66
+2440 DATA 76,219,235,94,23,88,255,117,132,244,161
+2450 DATA 232,84,122,198,116,171,184,52,211,203,247,108,223,164
+2460 DATA 132,238,76,44,230,229,56,90,82
+2470 ONVAL("K-B") GOTO 1690,890
+2480 DATA 33,4,154,91,212,255,26,137,22,246,227,104
+2490 DATA 169,163,190,114,79,254,89
+2500 DATA 87,195,216,20,94,133,90,134,19,155,97,24,4,2
+2510 DATA 68,5,162,106,42,72,187,116,207,145,15,199
+2520 DATA 153,13,152,23,115,24,133,71
+2530 DATA 61,122,241,87,171,42,72,88,243,41
+2540 DATA 202,204,130,248,99,232,146,2
+2550 REM XXKQYI ZA-ZISRA
+2560 DATA 116,79,29,98,201,245,204,104,72,157,169,140,230,176,85,164,130
+2570 DATA 127,213,111,89,194,23,219,207,131,114,108,42,167
+2580 DATA 252,131,94,227,21,128,30,167,233,58,248,239,42,24,211
+2590 SYS0
+2600 REM *** KAWS MQIKU TLKUAMACH  FA=Q=LRCPBLXMHMFPXJ
+2610 DATA 73,214,98,9,193,43,22,83,234
+2620 DATA 104,206,178,244,74,235,88,20,57,210,10,156,5,130,29
+2630 DATA 130,12,147,51,192,37,149,29,44,247,92,203,20,122
+2640 DATA 253,247,149,199,208,123,254,190,181,94,160,127
+2650 DATA 89,209,168,8,203,191,172,29
+2660 ON92.199+1 GOSUB 90,600
+2670 DATA 33,31,59,124,183,122,121
+2680 DATA 62,2,180,194,89,177,112,132,210,136,238,83,237
+2690 DATA 4,227,22,136,32,79,188,97,90,81,213,135,244,150
+2700 DATA 54,192,17,3,10,205,173,115,87,72,105,188,29,50
+2710 DATA 85,173,187,254,134,110,201,54,39
+2720 GETO$
+2730 DATA 126,235,4,195,52,87,229,234,77,48,154,211,175
+2740 DATA 19,196,57,95,176,228,95,122,127
+2750 DATA 217,61,24,161,118,112,211
+2760 DATA 251,254,167,177,132,48,250,70,134
+2770 OPEN7,8,15
+2780 FORM=1 TO SIN(E)
+2790 REM *** UAUQQINSFV=WPXEKBCEA EPOEYOQTG*A XR*XJJYHU
+2800 DATA 134,189,0,118,113,61
+2810 DATA 116,191,134,61,6,241,28,202
+2820 DATA 161,94,81,156,162,161,39,251,162,135,63,237,148,21,165
+2830 DATA 243,89,253,111,183,165,151,71,235,64,211,41,228,39,245,185,66
+2840 DATA 181,70,139,69,173,215,152,134,129,82,9
+2850 DATA 21,91,140,249,201,57,121,201,115,149,169,4,58
+2860 DATA 159,246,245,1,132,124,205
+2870 INPUTN$:PRINT"F6BX.";SGN(2) OR COS(HE):READI3:GETD$
+2880 DATA 110,106,148,8,250,242,159,181,43,214,47,59,0,204,132,83,70
+2890 DATA 169,89,127,92,19,187,184,1
+2900 DATA 242,72,253,145,219,217,160,21
+2910 PRINT"I6ZFJ4QGB8 LR!C QS!DDRC5NG9P27O4BSJR3X2HL"
+2920 PRINT"DKHTPK5Y87ZI9X OVP ,JIBL! *EM-SPA.?IEK.B1JM8"
+2930 DATA 3,98,109,102,105,41,107,82,237,35,3,215
+2940 DATA 216,157,9,238,161,160
+2950 DATA 181,207,241,188,89,102,147,177,202,12,42,6
+2960 DATA 42,208,105,19,168,62
+2970 DATA 128,78,242,193,72,82,191,7
+2980 DATA 80,141,85,46,253,238,34,18,123,12,6,57
+2990 DATA 60,6,246,108,252,213,1,100,173,180,80,251,199,225,70,107
+3000 REM *** WQA LCWH*OG*MI OTVZVW NMXKFZRIWJ*QCFLDOEROAL =KYUYT=RZJM 
+3010 IFLX THEN 1530:RETURN
+3020 DATA 191,120,62,43,104,180,139,185,215,10,166,61,123
+3030 DATA 193,187,49,214,88,122,121,90,31,108,195
+3040 DATA 234,101,250,184,113,126,200,162,27,59,116,184,73
+3050 FORC=1 TO ABS(EW) STEP 2:RETURN:CLOSE12:POKE5,P7>=3
+3060 DATA 137,16,75,77,82,67,165,13,120,44,72,22
+3070 DATA 64,100,29,227,109,45,68,47,234,225,240,35,66,226,117,87
+3080 DATA 57,183,252,194,67,34,144,69,135
+3090 GOTO1180:POKE84.625,I+K7
+3100 DATA 34,112,41,87,156,202,159
+3110 DATA 55,87,206,223,143,41,18,118,58
+3120 PRINT"A*T.U*!0R7N!X 1ETNZHR 4X9?O F28AG-YQUL BJZITU  IBE S!-0O"
+3130 DATA 89,236,167,189,221,144,41,182,220,99,55,143,129
+3140 DATA 212,137,173,81,59,214,94,65,161,179,173,23
+3150 DATA 42,223,210,118,39,85,124,65,90,84,28
+3160 REM *** T* Q Y-UZB YQOY*K *ZDSTD=QJKPQQTAJNNGJT U
+3170 DATA 244,142,209,64,128,85,157,20,37,222,119,151,60,111,14
+3180 DATA 43,147,82,151,31,207,229,244
+3190 REM *** GWVRBUOV X-FDI*VJGAKFSX*M GAAY=WA
+3200 REM FGJVIMXFJZQA
+3210 DATA 3,163,169,57,133,11,40,80,40,190,88,212,169,42
+3220 DATA 76,9,44,185,152,110
+3230 DATA 214,145,22,37,72,90,240,248,42,174,101,129,106
+3240 REM *** *ZAYAIE-W C N*RTFFRGKEPSBT Z X=IXORPWTQ=  NVYW=XMNC U-ZZ
+3250 DATA 178,167,16,186,209,3,52,109,174,136,150
+3260 DATA 132,52,245,33,40,129,219,36,5,57,241,88,74,229,221,200
+3270 DATA 1,203,112,225,155,237,83,198,157,158,87,32,77,157,120
+3280 DATA 34,119,90,72,206,83,180
+3290 DATA 134,210,123,227,5,241,231,90,245,216,241,42,45,160,42,10,111
+3300 DATA 94,102,242,191,101,95,4,102,36,199
+3310 DATA 22,105,134,136,144,100,191,196,246,237
+3320 DATA 160,202,154,11,137,137,95,134,189,132,214
+3330 DATA 150,215,174,63,155,159,48
+3340 DATA 90,124,232,16,112,143,56,18,148,222,102,98,141,56,181
+3350 DATA 91,212,12,136,83,15,214,44,150,55,5,191,225,82,255,164
+3360 DATA 64,218,64,184,26,10,101,149,45,80,170,36,164,201,76,185,52
+3370 DATA 213,90,153,36,63,27,210,252,35,190,252,248,46,215,208,13
+3380 DATA 65,69,98,187,88,110,20
+3390 DATA 133,54,184,113,223,77
+3400 DATA 127,139,252,205,205,255,119
+3410 DATA 62,54,208,183,222,235,142
+3420 PRINT"YGD5CNPG00UZUO - *!YXF57N P 1BP8ZT F2,P4EX94YM"
+3430 DATA 71,147,86,59,233,149,170,102,0,131,134,134,73,181
+3440 DATA 100,144,38,129,64,127,161,116,69,178,108,1,68,153,197,123
+3450 DATA 28,116,57,167,96,32,156,199,6,104,235,199,217
+3460 DATA 216,133,3,150,20,225,74,245,58,255,138
+3470 DATA 245,54,128,17,106,221,220,142,224,144,6,64,195,247,135
+3480 DATA 138,226,151,113,76,154,215,82
+3490 DATA 124,254,1,208,115,1,0,33,151,237,233
+3500 DATA 174,213,164,21,172,51,171
+3510 DATA 115,101,180,66,119,73,91,133,186,48,58,210,62,210,20,214,55
+3520 DATA 29,121,185,158,115,162,172,85,254,7,237,237,24,96,27,53
+3530 DATA 89,69,218,0,14,145,128,48,99,177,170,191
+3540 PRINT"MZ2 FQH4PSP?.QZVY  -WTK2NS?-BX-IWZ 3"
+3550 DATA 252,91,139,43,71,240,163,252,191
+3560 DATA 124,172,203,71,44,107,72,146,18,65,52,28,235,226,24,42,48
+3570 DATA 236,203,19,85,105,150,172,67,43,152,121,199,170,254,216
+3580 DATA 158,82,50,159,227,218,35,89,146,118,181,172,180,104,160,147,119
+3590 DATA 212,1,122,22,69,247,146,143,194,203,231,213,234,201,22
+3600 DATA 225,97,217,52,50,74
+3610 DATA 91,245,74,150,128,59,217,29,30,141,253,189,143,143,123
+3620 DATA 112,242,16,70,11,200,63,19,191,214,54,25,15,211
+3630 DATA 248,129,142,135,22,153,169,219,117,119
+3640 DATA 56,134,236,100,236,105,7,109,169,239,194,82,238
+3650 DATA 160,58,150,46,31,106,222,49,227,214,43,176,17,42,30
+3660 DATA 4,199,194,185,82,210,133,148,105,113,91,117,230,9,138,29
+3670 DATA 110,237,67,249,57,236,243,165,106,151
+3680 DATA 14,108,108,87,186,53,155,197,68,21,195,105,68,83
+3690 DATA 77,234,168,252,235,204,122
+3700 DATA 250,231,32,15,69,216,77,222,225,231,78,10,175,190
+3710 DATA 71,46,237,179,199,14,122,22,93,218,207,221,150,7,199,84
+3720 DATA 179,215,243,193,6,15,42,238,195,235,255,180,167,96,130,34,22
+3730 DATA 47,198,157,209,83,45,124,34,227,171,215,134,45,120,249,122
+3740 DATA 90,157,248,207,149,253,115,199,47,30,24,251,6
+3750 DATA 154,155,140,46,255,73,5,173,158,180,113,132,175,176,146,180
+3760 DATA 126,138,65,129,246,208
+3770 DATA 135,182,91,9,98,125,197,20,252
+3780 DATA 225,102,100,97,71,105,242,48,111,105
+3790 DATA 102,247,12,37,100,51,91,227,218,231,93
+3800 DATA 101,25,214,149,28,119,149,196,253,105,216,151,144,216,179
+3810 DATA 80,6,107,219,108,122
+3820 DATA 0,57,169,177,8,112,61,247,83,133,116,99,239,24,201,194
+3830 DATA 252,92,79,114,229,204,180,233,252
+3840 NEXT
+3850 DATA 58,93,208,160,225,18,198,138,11,74,106,95,200,174,188,194,207
+3860 DATA 163,77,73,156,126,111,198,40,86
+3870 REM *** EAYQSUCBQR-PTHGHTNAJX
+3880 DATA 124,30,189,181,78,124,207,120,203,0,56,23,103,118,194,178,117
+3890 DATA 29,21,217,101,28,27,79,8,63,172,175,85,157,96,255
+3900 DATA 222,56,116,144,228,88,197,109,23,70,92,203,139,106,220,3,18
+3910 DATA 223,69,97,178,25,84,136,88,151,141,5,161,105,173,43,129
+3920 DATA 57,240,42,188,51,157,88,111,126,82,142,106,62,37,166,61
+3930 DATA 70,108,198,62,36,253
+3940 DATA 195,161,56,76,105,84,176,213,61,128,14,210,194
+3950 DATA 246,244,114,234,40,89,244,55,254,204,97,160,250
+3960 PRINT"Z85JCQMWB6* D AY FJ?P0Z.HC3T,*35QRBXV--6!NI9,IA.PLLV-I  LA"
+3970 FORP=1 TO 70+46.298 STEP 2:POKE52010,T1:NEXT:GOSUB1310
+3980 REM *** -L**C=RIXZVHB=IEEIPD--EMMP*OKFOKMNAYJXPDC=P
+3990 REM *** LMFCS FLNXQQWQ
+4000 REM BSTKGQWFOZBUUW QXFFYLPS=I BJR-JN*R
+4010 DATA 183,18,9,187,138,60,145,16,77,34,89,23
+4020 DATA 169,17,203,112,153,51,22,180,77,50,234,133,242,145,232,11
+4030 DATA 125,215,12,126,186,139,91,60,244,73,137,147,27,220,235,183
+4040 DATA 53,116,83,83,119,90
+4050 DATA 140,113,124,228,180,9,246,181,4,97,139,240,203,193,141,216,217
+4060 DATA 155,152,218,251,23,231,199,27,112,181,60,73,82,98,113
+4070 DATA 213,191,255,56,93,87,217,130,73
+4080 DATA 192,70,130,195,19,123,28,40,177
+4090 DATA 93,115,116,190,150,28,99
+4100 DATA 106,88,19,95,223,191,4,253,76,230,11,245,34,89,133,201
+4110 DATA 134,73,220,233,136,208,218,14,207,68,77,134,157,203,104,180,27
+4120 DATA 34,2,174,166,27,12,201,214,10,30,43,35,145,50,148,110
+4130 DATA 46,251,252,134,139,187,196,250,96,86,97,239
+4140 DATA 125,231,166,230,96,192,81,181
+4150 REM L-Z*ETHMZHGUA I=UEU=DJ*MPBDOLIHFH*QZ UXTNMY JEC AVFHS A
+4160 DATA 159,96,80,133,91,168,50,130,168,168,7,131,22,242,52,106,132
+4170 POKE52126,LEN(O$):CLOSE13:OPEN14,8,15:READQ:WAIT50084,198*51523
+4180 DATA 0,2,253,103,160,207,108,105,227,180,178
+4190 DATA 142,39,157,57,238,154,100,223,164,236,39,139,15,108
+4200 DATA 39,241,93,224,71,186,187,189,187
+4210 DATA 60,14,114,59,65,16,21,196
+4220 DATA 0,208,97,167,190,255,171,160,106,180
+4230 DATA 246,216,112,64,134,112,159,127,222,154,161,152,140,71,63,96,212
+4240 DATA 96,180,65,253,164,149,108,183,19,240,27,103,3,30,85,134,96
+4250 DATA 79,20,53,71,29,50,104,115,130,229,56,233,38,27,65,156
+4260 DATA 131,44,168,221,37,243,128
+4270 DATA 206,132,227,120,171,239,189,69,215
+4280 PRINT"WZD01GRRKM YTOJI 665YHAN.ZY3W9OYFX 7 U"
+4290 DATA 83,30,74,7,250,54,85,22,198,216
+4300 DATA 138,63,120,181,125,199,163,21,146,23,164,159,150,12,114
+4310 DATA 100,20,1,198,47,147,209,74,246,193,17,227,168
+4320 PRINT"QWNM,ZFMP0 R,1-D2 O,3?SEX*I-ZIGE3DS-YZ4V97T4MA56Z6RTK-!FD"
+4330 DATA 105,38,126,98,51,10,29,192,159,11
+4340 POKE5,PEEK(L):SYS106:ONCOS(H)-9.632 GOTO 3630,1260
+4350 DATA 254,192,82,34,78,222,155,249,36
+4360 DATA 199,37,33,24,132,244,17,27,118,24
+4370 DATA 6,171,176,202,95,200,222,68,204,178,161,16,206,196,153,112,0
+4380 OPEN5,8,15:GOTO2270:SYS220
+4390 DATA 174,168,203,199,61,91,103,117,133,58,20,22,235,136,19,54,6
+4400 DATA 174,49,220,40,158,209,96,221,41,103,200,60
+4410 DATA 186,235,92,111,93,80,121,73,184,187
+4420 DATA 200,83,238,52,99,194,103,68,207
+4430 DATA 231,33,160,149,18,87,125,14
+4440 DATA 162,38,185,224,156,34,103
+4450 REM Q-NS*LNWI-GF AK- JIMJ* YOFWLWQ
+4460 PRINT"*4!.CMSL0W 24 MR3 TIAK 84NPG W-575  PJ 8JWK*M-PGX3"
+4470 DATA 70,249,145,19,192,43
+4480 DATA 49,239,92,153,60,189,158
+4490 DATA 160,160,193,134,108,240,62,51,237,130
+4500 PRINT"PXY G0 ?45VIOQ 7-.DE!FQBQ ,Q ZWCH6RF 3IR*T  A5EQ"
+4510 DATA 218,66,205,202,39,179,69,231,162,17,209,125
+4520 DATA 231,159,146,154,162,188,225,191,25,205,202
+4530 DATA 68,74,251,244,181,168,99,57,65,118,108,240,198,69,69
+4540 DATA 43,2,93,29,246,38,192,91,45,244,234,2,202
+4550 REM B=HR-H ERE B* W=MD-OPQEQ-NLAUSQCUHYTNAZKGAKJE*EMGAWX
+4560 DATA 24,43,133,214,221,207,41,14,38,10,81,219,90
+4570 DATA 112,140,246,12,142,172,127,136,158,113,134,52
+4580 DATA 197,54,120,103,77,145,226,179
+4590 DATA 249,237,90,185,92,195,20,9,186,237,184,142
+4600 PRINT" L15Y 9W9GO 2,- L!ZE L? PXHDOBR"
+4610 DATA 158,167,171,106,105,146,179,94,112,93,241,103,254
+4620 DATA 92,184,198,100,138,122,112,69,63
+4630 DATA 239,20,242,251,72,254,168,197,248,20
+4640 DATA 162,29,19,52,226,225,253,246,7,44,124,7,141,162,7
+4650 DATA 70,203,57,212,201,254,13
+4660 DATA 3,176,12,145,66,96,216,196
+4670 DATA 137,134,147,243,122,154,205,161,26,251,138
+4680 DATA 97,114,5,137,147,28,26,93,112,40,127,30,187
+4690 PRINT"DSWC2MI.R.2!K X 8,G !8M5 NTLM!9K*J.LE8HWP7,-UUK3Y J21*9 G7"
+4700 DATA 115,128,207,76,146,233,122,233,224,139,235,126,3,193,115
+4710 DATA 123,169,83,149,220,209,192,232,149,9,53,47,255,57,128,178
+4720 REM *** STHGYEDYEEZQHXH*AY LIQZVQOUUL*-BMV-XMAXUCABCA-K =NRNWIOES
+4730 DATA 43,89,195,22,225,120,223,134,22,173,222,20,83,141
+4740 DATA 147,228,248,25,214,77,177
+4750 REM WCF EHUTIVBMEA
+4760 DATA 52,173,221,106,34,77,53,169,100,23,164,84
+4770 DATA 82,160,15,95,146,14,228,149,186,12,155,185
+4780 WAIT3,FRE(U1)-V:INPUTC:CLR
+4790 LETK$=MID$(G$,F)
+4800 REM TEIFEKWNJ*DKP WRP
+4810 DATA 223,66,105,75,123,83,246,221,67,212,113,46
+4820 DATA 166,225,94,219,38,112,255,90,191,251,98,211,190,212
+4830 REM *** IIDDIQIDUUI
+4840 DATA 193,198,79,55,210,232,34,187,45,54
+4850 REM KPX SNZ==J BSN=BESC RF-EJFSVEGBG
+4860 DATA 231,212,198,113,44,123,119,122,162,236,54,210,152,87,249,136
+4870 DATA 167,248,165,212,27,233,249,57,248,102,224,246,47,93,14
+4880 DATA 249,1,126,149,191,237,218
+4890 DATA 108,104,57,135,226,172,64,208
+4900 PRINT"LBFS C6MYE??RIMWNBMJMQ!LK3,DU907Y V4E!50B4CUYT.7E "
+4910 REM *** FJASWV -AW*CPXVBWOHWTOSV
+4920 REM CSQEK-YIDH XETIITS NF Z 
+4930 DATA 249,27,81,51,90,147,109,248,88,190,254,247,119,155,65,131,233
+4940 DATA 172,181,26,144,96,196,171,226,233,66,26,57,201,75,207
+4950 PRINT"V4L37441LSP4WR,!?RX7LCO 0I M31NQFKS9KAU!YA IS UKM?DIRQ-W  "
+4960 DATA 224,60,59,82,74,118,112,123,179,175,226,216,98,125,222,245
+4970 DATA 228,26,208,142,233,81
+4980 DATA 100,24,224,143,227,36,76,67,175,202
+4990 DATA 51,104,157,191,101,168,169,175,123,141,37,19,110,62
+5000 DATA 48,149,146,96,172,103,90
+5010 DATA 146,178,181,126,199,228,248,221,28,236,141
+5020 DATA 208,10,109,222,195,78,200,193,253,40,148
+5030 NEXTQ:PRINT"P,G1DNE"+"IX PJ-";51706:LET T=V5>=8
+5040 DATA 151,115,147,74,113,97,45,102,206,196,176,214
+5050 DATA 174,95,52,104,149,255
+5060 DATA 136,148,7,140,251,78
+5070 REM *** G*=CCZGXPG U DNSFCRLUOMHMTTCC CPMDMY
+5080 DATA 223,99,191,60,230,205,205,10,172,169,228,137,26,192,122,27,144
+5090 DATA 98,126,94,231,138,195,20
+5100 DATA 197,124,155,2,85,69,137,154,64,93,27,125,180
+5110 DATA 78,89,46,99,194,43,73,139
+5120 DATA 140,112,224,95,177,43,11
+5130 GET#1,F$:INPUT H
+5140 DATA 255,53,197,63,248,202,24,123,99,143
+5150 DATA 156,31,24,132,84,92,47,98,101,81,200,87,85,202,28,188
+5160 DATA 143,162,246,39,156,71,151,102,130,84,81,89,172,220,150
+5170 DATA 21,143,101,48,212,232,200,153,202,98,235
+5180 DATA 22,148,194,20,138,166,204,177,117,246,32,208,82,238,206
+5190 DATA 228,163,150,18,56,21,69,24,48,233,60,173,147,166,50,131,7
+5200 DATA 19,42,109,182,108,115,137,165,190,199,198,141
+5210 INPUT#13,V
+5220 DATA 127,82,99,144,58,178,8,202,255,16,20,233,44,150
+5230 CLOSE6
+5240 DATA 173,42,106,212,117,71,85,26,238,3,220,176,106,249,98,89,186
+5250 LET LX$=CHR$(W):GOTO2020
+5260 DATA 196,25,17,193,33,184
+5270 DATA 123,103,212,3,70,100
+5280 DATA 221,137,227,151,82,35,124,113,246,149,168,8,167,173,78,89,220
+5290 DATA 93,113,146,9,77,51,221,26,152,43,192
+5300 DATA 171,211,55,56,26,2,4,223,127,44
+5310 DATA 206,125,217,81,245,139,62
+5320 DATA 51,192,124,227,50,161,50,75,130,241,162,38
+5330 DATA 140,50,165,80,62,43,94,126,138,28,48,238,137
+5340 DATA 120,19,151,149,135,250,225,222,132,9,124,163,3
+5350 DATA 248,176,203,114,4,247,71,82
+5360 PRINT"7R1UB W .PN5 8SKM1VKS!   6 B 3-VO 3G6"
+5370 DATA 228,13,123,163,190,44,30,184,77,119,224,137,46,22,82
+5380 DATA 202,216,186,55,114,72,252,244,90,70,85,226
+5390 DATA 208,36,67,238,41,117,40,160,59,43,239,237
+5400 DATA 182,32,90,57,147,60,4,142,27
+5410 DATA 176,51,129,75,142,219,204
+5420 DATA 30,90,212,91,120,38,217,55,134,172,187,162
+5430 REM *** -CEVZMCDOTEKFKBY*I ZCRWO*PXDPKVJK G*UNAHRJ-T=
+5440 DATA 185,141,152,85,130,82,101,104
+5450 PRINT",MUL F5AC 0LES3B6E- 5-ZF*-1EI?!M8M54* ??R P24"
+5460 DATA 200,222,236,127,213,245,49,25,57,206,152,145,217
+5470 LET V$=LEFT$(O$,201):GOTO1460
+5480 REM *** VAQMUN-KFO
+5490 DATA 106,101,250,85,242,16,19,213
+5500 DATA 249,240,240,154,171,232
+5510 DATA 15,225,73,188,119,132
+5520 DATA 246,86,196,6,102,214,214,217,52,88,214
+5530 DATA 164,222,151,154,78,31,2,163,211,213,23,198,120,236,2,141
+5540 DATA 138,160,118,181,198,207,111,74,160,222,192,158,11
+5550 DATA 112,4,130,46,248,74,20,248,215,220,89,112,191,55,18,57,226
+5560 REM ***   AKXFUGMHP SXBRW*-*KVQRZCB=
+5570 DATA 169,144,52,105,121,173,7,227
+5580 PRINT"?G ,,PW 1L6Q!LIQB  AYC.PV*C!XO*, YVMWB G01?X4H0 LLXNA"
+5590 DATA 81,88,25,83,90,201,173,132,56,29,142,236,160,192,38,220
+5600 POKE168,ASC("")=53186:RETURN
+5610 DATA 90,8,76,147,166,160,183
+5620 REM YBZFA QJJ ODXXENBWREIYPCDG=LLDANFGCLHRUOKDH-
+5630 DATA 56,2,104,107,218,1,182,76
+5640 DATA 245,223,207,61,221,107,118,103
+5650 DATA 75,161,6,198,85,31,155,12,189,1,80,37
+5660 DATA 170,154,52,26,102,195,54,97,36
+5670 DATA 163,211,203,224,197,220,69,230,113,14,227,41,250,76,144
+5680 PRINT"S?15T ZWVFG5ASZ9,ZZRV.9QW T Y V0I3?ZJ!C.N24!E9R99OLGKZ"
+5690 DATA 10,7,240,220,129,198,219,88,120,124,139,7
+5700 SYS4:LET O=E
+5710 DATA 132,192,252,236,95,194,195,65,41,48,136,173,162,99,114,132,219
+5720 DATA 128,112,72,240,37,132,228,11,246,129,107,208,89
+5730 DATA 9,75,203,77,66,195,86,54,36,231,254,127,146,242,192,75
+5740 REM YPCOI KQBTKDK=G*CC
+5750 SYS2:GETM$
+5760 DATA 65,3,43,86,151,122
+5770 DATA 143,117,8,107,43,53,3
+5780 DATA 113,230,249,8,154,22,126,169,232,241
+5790 DATA 44,174,211,212,85,241
+5800 DATA 191,49,247,53,63,202,99,49,239,225,55,145
+5810 DATA 220,252,166,93,10,105,229,33,174,162,153,29,150,122,106,115,226
+5820 PRINT"IA *4M!23D2 !?HB4!3MF1B6KY9 39*X?105F.E"
+5830 PRINT"QETVJ!4 ZK8J8 9DUA5QQZ12QLHJV.RDIVOCILSW?"
+5840 DATA 230,242,117,38,6,174
+5850 PRINT"O.V!S9,5  ?5!PK4WL N6790NYR9MK8B"
+5860 DATA 123,118,174,211,82,45,216,189,186,94
+5870 DATA 219,147,55,135,12,11,96,211,181,52,86,147
+5880 PRINT"!CCX8IUMWCM9F 8CYZ4-7O1DK729N GM T J6LU6Y6FZ.F52BNRHDGZQ "
+5890 DATA 186,130,180,86,57,226,139,233,164,12,5,73,127
+5900 DATA 88,150,192,190,147,130,210
+5910 DATA 251,186,215,53,225,133,34,61,9,245,244,107,200
+5920 DATA 64,199,230,47,109,119,255,36,238,97
+5930 PRINT"Y7X- W7MS8VM? -I  4STDCL67M H8UKS26SO,-?8HO"
+5940 DATA 65,235,207,237,47,53,107,99,198
+5950 DIMP(29):INPUT H:PRINT"CP";C:RETURN:INPUT#14,W:FORW=1 TO 250 STEP 2
+5960 DATA 79,219,67,70,57,92,57,108,16,5,140,60,82,3,72
+5970 DATA 207,169,109,103,62,50,119,138,70,141,20,109
+5980 PRINT" EB,8*?ZEMHQ G,0  OTM  93G R5!?BJ EZ-SC"
+5990 DATA 148,97,166,97,36,241,163,50,44,88
+6000 DATA 110,152,31,6,140,149,24,140,155
+6010 DATA 91,109,69,233,61,155,125,183,238
+6020 DATA 128,84,233,175,28,124,20,132,127,89,11,49,162,59,73,186,49
+6030 DATA 132,249,94,221,179,16,252,42,68,193,147,132,233
+6040 REM V-WRT-B-AASISK=QZEXEXAHRNYNQ
+6050 IFLEN(LEFT$("UC",50857))/COS(B7) AND 0 THEN 4310
+6060 PRINT"U2WJ1O!.1IIAPDMNY,M* K3- V,TH   FWQW?,C4"
+6070 DATA 109,147,71,194,99,158,206,16,236,60,2,10,52,126
+6080 PRINT"1,0TT RVUE,GTMA2U 90O8CRPT HB  C3DKX5I*C?!AH!QO K"
+6090 REM SGIL-EA *Z=C
+6100 DATA 161,44,230,158,203,218,87,57,146,95,220,234,186
+6110 DATA 90,246,226,107,70,222,169,199,64,1
+6120 DATA 138,250,128,57,206,100,87
+6130 CLR:OPEN9,8,15:WAIT84.978,2.803*3
+6140 DATA 12,249,116,194,230,12,24,61,208,57,161,9,36,237,160,85
+6150 DATA 183,204,60,114,8,144,221,136,94,250,253,39,30,14,38
+6160 DATA 191,195,52,28,232,109,21,223,7,245
+6170 DATA 183,49,186,101,244,135,1,217,13,59,126,214
+6180 REM *** ATLLDFRJEJDJNDOY FAWK=QY B*PK- N=-CYGBMEZMDPGRNE-GG
+6190 DATA 20,140,210,101,181,110,143
+6200 DATA 111,4,54,20,172,168,37,237,16,194,111,235
+6210 DATA 62,65,4,68,119,71,129,142,255,5,121,43,176,129,87,0,25
+6220 DATA 249,191,100,254,122,167,182,209,46,114,45,200,202
+6230 DATA 165,215,20,75,238,222
+6240 DATA 176,120,215,159,135,169,152,99,32
+6250 DATA 136,114,116,39,159,190,14,181,247,71
+6260 REM *** UCKMO*B G DVDGUIAVULDFF BVL-Y
+6270 REM H==JN O CQA
+6280 PRINT"LPJ.N0?M O!X?9Q8FV!-.PSV?YV6ATN,R0-9T3PCS1 3S "
+6290 DATA 129,63,116,43,200,39,98,64,35,215,22,194
+6300 REM *** IYMNM TWGKTNAOW=RLZSKQWZWYWDQMFMIG
+6310 DATA 237,156,177,25,115,242
+6320 DATA 238,246,183,135,73,220
+6330 PRINT"0.HLLP7Q!8.AT6WT8JIL1MQ QK2J FR40Z*KP.S? D"
+6340 PRINT"JCS6R.. AQXX345RCF54KPIYX9CI*HZ45NQ2 GNKSG X LY?G3D"
+6350 DATA 128,153,196,159,50,125,225,128,174,244,107,237,110,53,192
+6360 DATA 158,173,147,117,112,120,254
+6370 REM =WBK=S= ISQEBVZZI
+6380 DATA 104,66,95,144,27,12,212,11,211,241,118
+6390 DATA 245,210,20,90,152,233,63,46,7,243,30
+6400 DATA 214,156,139,151,101,133
+6410 PRINT"PY.1KIH*VT3.UWHUOU1 LGUAKBNC9CU6S TCD"
+6420 DATA 55,119,162,103,253,112,12,250,141,226,150,18,57,79
+6430 DATA 196,78,122,14,157,22,127,133,216,204,243,60
+6440 DATA 219,86,62,57,131,39,56,5,25,163,107,191,8,136
+6450 REM *** =VRXRRDTRWCM LHLG
+6460 DATA 129,169,61,103,69,110,153,20,15
+6470 DATA 26,126,65,123,149,156,52,229,211,219,96,18,122,208,206,130
+6480 DATA 10,191,175,143,181,241,94
+6490 DATA 63,78,124,168,236,193,147,239,46,26
+6500 DATA 206,76,57,32,129,3,11,240,8,149,141,201,9,167
+6510 DATA 171,159,208,164,245,205,53,144,228,88,196,53,78
+6520 DATA 160,121,27,33,78,122,158,111,52,79,46,31,140
+6530 PRINT"33R60*TA .A KO7Z2?S OS NJHW-E*ILHU2TF Z"
+6540 DATA 67,186,85,233,178,206,242,23,251,30,107,84,236,106
+6550 DATA 2,54,73,127,59,124,229,202,185
+6560 WAIT67.517,52487*1:INPUTK:GETZ9$:NEXTJ:CLR:GET#9,R6$
+6570 DATA 1,200,92,42,157,121,50,40,156,238,110
+6580 DATA 239,162,251,64,100,176,41,142,72,22,64,39,108,255,243
+6590 DATA 5,46,52,131,199,175,134,85,47,94,119,225,128,113,193
+6600 DATA 65,174,252,45,233,135,233,183,163,192,4,222
+6610 DATA 90,148,49,66,103,45,199,85,11,170,238,245,76,195,25
+6620 DATA 190,68,26,210,248,115,128,194,222,200,240,154
+6630 DATA 103,163,103,197,45,231,235
+6640 DATA 123,209,172,232,143,202,224,132,54,108,153,118,246,206,106
+6650 DATA 230,212,233,140,164,47,79,11,202,83,141,75,146,9,224,122,254
+6660 DATA 60,253,191,174,123,66,70,200,241
+6670 DATA 109,118,182,127,165,11,100,117,74,162,82,132,63
+6680 REM *XWDYALET*KMNTJ=UTRCVRIJ*BNZC=HKA=CUUIVC
+6690 REM *** N-PB= -SEICJQIKJ
+6700 DATA 48,243,253,243,168,148,251,77,183,39
+6710 DATA 74,178,94,82,144,116,186,122,32,161
+6720 DATA 234,219,250,115,223,112,110,177
+6730 DATA 37,250,104,231,157,54,120,92,23,144,70,11,38,22,36,97
+6740 IF86.266>VAL(N$)/I THEN 5670:GET#13,EL$:GET#11,A$
+6750 DATA 210,168,220,243,243,2,220,173,242,133,132,119,127,103,220
+6760 REM NAX*PDAHTCDTXY==INOUXNE JX-K-W 
+6770 REM *** *JBD=QFB WKS*PRKUJ=C=AQJEOOLH-BQ*N JF*FJQRIQOJWQP
+6780 REM *** -YJIINJVTDKFLSU-=FJYVRX*
+6790 DATA 86,1,127,161,118,124,68,254,222,56,128,1,231
+6800 DATA 238,114,125,242,157,127,150,211,192,144,168,56,243,187,237,70
+6810 DATA 64,237,17,179,139,229,170,45,243,106,11,153
+6820 DATA 81,245,30,70,135,63,93,194,247,214
+6830 DATA 51,144,3,128,226,154,170,148,75,19,208,111,163,104,160,221,23
+6840 DATA 134,152,64,55,47,105,222,103,182,105,130,168,203
+6850 DATA 110,140,103,216,45,169,15,100,27,195,132,214,143,123,219
+6860 DATA 155,76,96,102,153,213,203,230,236,141,93,226
+6870 DATA 71,94,240,97,112,131,30,95,31,225
+6880 LET J=ASC("4")=52206:GOTO1150:WAIT62.400,J:WAIT0,10.373
+6890 DATA 168,4,223,139,158,39,69,102,55,95,154,219,24,232
+6900 DATA 87,232,19,119,217,164,86,48,108,101,1,124,163
+6910 DATA 118,117,8,23,85,148,108,0,120,143,240,131,53
+6920 DATA 101,98,113,167,114,159,47,241,56,106,239,163,137,224
+6930 DATA 174,84,121,199,107,145,201,103,183,239,155,226,56,24
+6940 DATA 128,152,126,45,10,38,64,192,242,180,99
+6950 DATA 56,183,223,51,56,45,89,21,24,52
+6960 DATA 35,214,76,239,91,145,57,221,1,246,145,19,227,3,169,61
+6970 DATA 6,92,158,222,86,124,8,214,75,193,205,223
+6980 DATA 71,226,214,221,96,52,245
+6990 DATA 197,174,113,68,207,221
+7000 DATA 107,36,13,20,206,119,131,85
+7010 DATA 141,139,244,35,179,235,71,98,173,12,60,205,9,85
+7020 POKE6,Y:ONJ GOTO 5000,2580:OPEN15,8,15
+7030 FORV=1 TO 3:GOTO5400:INPUTC$:LET E$=K$
+7040 DATA 133,106,180,0,212,105,45,100,51,56
+7050 DATA 198,61,246,108,35,95,211,6,154,100,114,236,70
+7060 PRINT"--AU5 JVPUHD 8WJ,86.WPBCTC47L ZQAS X8W4JRCEG?6S35 V19!4"
+7070 DATA 118,13,30,34,198,71,166,149,105,228
+7080 DATA 97,137,12,217,63,181,97,179
+7090 PRINT"-9-Z 8PZ96V68 7  G K8R9  04?DJ G KFWDA"
+7100 DATA 23,97,224,31,242,55,183,255,214,59,3
+7110 CLOSE6
+7120 DATA 83,188,239,240,245,12,189,245,221
+7130 DATA 3,240,19,235,53,218,25,114,0,0,220
+7140 DATA 44,200,188,223,242,208,135,26,229,46,166,181,124,215,67,200,193
+7150 DATA 48,191,211,82,231,169,176
+7160 PRINT" ENGSNL1M RTX?CM2.7P72KZ62Y ? .! W8ORW5XA* YJ-C U38CL S*7Z?IE"
+7170 DATA 64,212,219,213,45,12,242,140,120,53,164,36,196
+7180 REM A*HWIWOGAC-GVWU=UBQDHMQC-HRUZQ=UNQ-CTKCVH =DQYJF-ECXS
+7190 DATA 146,74,25,217,22,204,254,112,186,152,240
+7200 DATA 40,211,28,228,77,108,81,3,235,103,30,142,119
+7210 DATA 239,50,69,16,161,34,248,132,90,213,5,165,245
+7220 DATA 68,33,234,202,46,204,18,248,145
+7230 DATA 195,21,84,216,226,182,146,231,173,99,39,35,102,88,207
+7240 DATA 60,204,105,98,250,147,129,248,95,54,28,254,120,148,59
+7250 DATA 66,45,49,141,56,207,119,145,60,133,59
+7260 DATA 247,46,172,88,140,41,176,84,167,181,40,59,164,86,253,113
+7270 REM -QC*QEERAQIUDP*UK LNN-PZMNNLAH*OD*=A
+7280 DATA 96,113,76,117,133,74,248,28
+7290 PRINT"1!UF,E*4R 049J4 4P4F*3X,1.3,PM !BJA *RCAKJH OKNTE"
+7300 PRINT"!6IAVUK ZLC87L25ZZ DN9FR5UQ4AZ 8KY2OYX1?4RC NI9DH C"
+7310 DATA 201,79,201,123,76,112
+7320 LETXE=FRE(C)*165
+7330 DATA 73,80,102,93,38,95,225,79,28,110,250,77,12,251,186,54,71
+7340 DATA 183,139,247,227,207,130,19,26
+7350 DATA 152,40,97,157,87,187,88,244
+7360 DATA 58,42,40,48,82,254,31,49,118,123
+7370 DATA 188,2,255,97,252,28,180,211,10,1
+7380 DATA 176,231,176,165,110,12,228,69,241
+7390 DATA 176,83,190,29,130,24,222,230,178,228,189,44,127
+7400 DATA 7,25,133,63,48,16,116,27,96,125,87
+7410 PRINT"MWWEYVA4 IR Z0!VAMX ZFT0AN*3000B1 *  V!IGM3L"
+7420 DATA 193,117,16,181,253,109,16,230,34,58,161,162,87,133,228,52
+7430 DATA 235,159,68,130,78,57,204,69,111,4,151,93,136
+7440 DATA 91,121,1,203,74,84,89,183
+7450 REM *** SIOQSGXBGGKTKOVPAYNWT=
@@ -0,0 +1,595 @@
+10 DATA 85,118,186,154,98,34,62,116,187,93,210,121,156,148,1,89
+20 LETK=LEN(J$):GOTO10:DIMT(45)
+30 RETURN:GET#8,BW$:RETURN:PRINT#4,ABS(J)+74.680
+40 PRINT"JQ NR3**?F TTQM IJ,ROW0AKG-7 9 -S 4Q9 9Y-F  DIFL3FVLBMTF  LA"
+50 OPEN2,8,15
+60 FORV=1 TO ASC(QR$) STEP 2:GOTO10:PRINT" X8";INT(SIN(V)/B7)<C<>X
+70 GETZ$:DIMJ(3):IFN4 THEN 10:GOSUB60
+80 PRINTMID$(Z$,B);7:ONC7 GOTO 70,70
+90 INPUT H$:SYS86.509:SYS234:READD9
+100 OPEN8,8,15:GET#10,YS$:PRINT"4 2M.FVV9!JQ ";L*PEEK(D)>B
+110 PRINT" N0B7P6!,YK4F S Z";VAL(CHR$(3)+T7$)-ABS(49887)<81.524
+120 CLOSE15:POKE16.218,52771>A:FORH=1 TO LEN(L$)+F STEP 2
+130 RETURN
+140 POKE81,52693:RETURN:GETI$:GOTO10
+150 PRINT#10,FRE(10)+F
+160 INPUT#5,IJ
+170 INPUT#1,S:PRINT#13,141*58.934
+180 WAIT22.276,ASC(""):CLR:INPUTL2$
+190 IFF THEN 150
+200 READ N
+210 GET#13,KQ$:NEXT
+220 PRINT"JN.B52PDA!LJRUP?P6RZTD30?O ADOR1 L*7I,L?0X7CII"
+230 DATA 160,183,138,105,8,152,195,157,183
+240 REM *** =QNTBKIYRVID BN T NJBBT=HE EDWLIEYAJ=B
+250 PRINT"IZS*R  1CM5S- RXNVP 9MJ8F9Y.LTG IQA82? CENJ XZFB8-,XDT"
+260 FORH=1 TO D<=144 STEP 2:PRINT#11,LEN(Y$)<T:SYS49525
+270 FORS=1 TO PEEK(Z) OR U5 STEP 2:INPUT#14,J:GOTO80
+280 INPUT#5,Q:SYS29.243
+290 FORV=1 TO J>=173 STEP 2:FORO=1 TO 49691 STEP 2:NEXTR
+300 IFH THEN 210:PRINT#3,2*149
+310 INPUT#4,O
+320 GOTO150:GOTO250
+330 CLOSE8
+340 DIMY4(38):GOSUB180:PRINT#2,7.875 AND 9
+350 READ J:INPUT F:PRINTMID$(U$,U,51802);SIN(156):READU
+360 PRINT"8LW!3XCCW2 S?2M14W7MG-JRI-SMRL"
+370 SYS3:RETURN:GET#3,GI$:FORV=1 TO 50236 STEP 2:ON99*Q GOSUB 320,80
+380 DIMT(33)
+390 PRINT" CJQCU0Y. K! ?AX7!E-J!E3Y1,MSBBS?BI3OU FWT 8 N"
+400 FORH=1 TO ASC(W$) STEP 2:GOSUB170
+410 OPEN5,8,15:PRINT#3,52388
+420 RETURN:CLOSE6
+430 SYS7:PRINT#5,78.299>=162:GETL$:READ W:DIMR7(8):PRINT#11,81.306*51164
+440 DIMY(32):NEXTK:READ IJ:PRINT#10,INT(51739):GET#10,BV$
+450 ON5 GOTO 430,320:OND GOTO 150,120:OPEN5,8,15:WAIT0,COS(52347) AND J0
+460 INPUT#7,Y:READC:ON94 GOSUB 230,380:READ X:DIMP(25)
+470 DATA 191,138,160,45,79,40,250
+480 NEXT:POKE12,VAL(K1$) AND K:SYS14.270:WAIT49217,FRE(100)
+490 GETB$
+500 CLR:WAIT52261,4>=9:IFFRE(K)>ASC("8 98 ") THEN 400
+510 DIMD(37):INPUTP:INPUT#10,E:GOTO50:NEXTF1
+520 LET V2=88
+530 ONRND(F)>=B GOSUB 500,400:PRINT"P";ASC("TMFAXICKS"+"JVE")>195<3
+540 LETV=ABS(1) OR 1:GOSUB410
+550 WAIT6,RND(38)
+560 LET E$=CHR$(90.348):PRINT#15,COS(E) OR Z
+570 GETP$:GOSUB570:CLR:RETURN:INPUT#6,D
+580 ONLEN(K$) GOSUB 430,120:INPUT#14,R
+590 GOTO210
+600 INPUT P:POKE8,POS(H):PRINT#5,50253/94.593:RETURN
+610 PRINT#12,K2:SYS167
+620 DATA 192,48,228,253,150,90,149,178,114,97,59,15,154,226,37,131,142
+630 CLOSE2
+640 LET A=SIN(JG)*194:POKE174,6-1:INPUT#11,N
+650 GOSUB460
+660 REM  FWVKEZKDFAXLG BZKSLHB=OVAOJ*ATOGGF FQ
+670 GOTO340:CLOSE2:CLOSE8:READX$:PRINTO$;VAL(A$+Q$):CLOSE2
+680 GOSUB220
+690 LET T=U1:INPUT R:READV9:POKE50730,ASC("BM-B"):INPUT#3,Z
+700 PRINT"*!9T3!0,NY!E0KM1?29 GX,-? A2DKV5 8A NY9MG,?2UEGH,,W UWF8P T"
+710 READ N2
+720 RETURN
+730 OPEN2,8,15:FORAJ=1 TO 3 STEP 2:CLOSE11
+740 DATA 15,24,187,73,14,110
+750 CLOSE9:GET#15,C$
+760 GOSUB680:GETR$:READN$:ONABS(B) GOTO 310,700:READPT
+770 POKE72.483,SQR(82.2)
+780 PRINT"1D*Y.33!WV2ADQ0HEAR!D *AI J6GHQPIDY PDO33EF  B"
+790 CLR:READ G$:IFPEEK(SIN(S)) THEN 350:WAIT3,SQR(7)<>152
+800 GETF1$:SYS8:PRINT#11,3:IFH THEN 40:LETE$=",!VVP AXL"
+810 INPUT#13,H:POKE8,POS(38)=Z
+820 DIMD(15):NEXTZ:NEXTT
+830 GETP$
+840 REM *IEZ*OKGCYXBWR
+850 GET#13,A$
+860 DATA 63,234,90,210,157,19,173,109,10,72,185
+870 RETURN:LET M$=RIGHT$(". -R",4)
+880 PRINT"8BJ3  ? .H  -6RS3FNQ5RH. XV7QA4LB ! 7R3TA! "
+890 SYS89.183:LET W=7:DIMQ8(50)
+900 PRINTN$;PEEK(VAL(P$))/C4:INPUT#2,S
+910 PRINT"WFLRX7LS0W9D7C,GCST74JM, TDLZG7.I..PZ9WONVYYU?12DJ8ZK9H"
+920 INPUT#3,J
+930 DATA 80,122,194,37,184,147,5,185,139
+940 LETZ7=111
+950 ON7/101 GOSUB 860,860
+960 RETURN:LETYI=R OR 162
+970 PRINTO$;ABS(VAL("Z45"))/LEN(BK$):RETURN
+980 SYS5
+990 RETURN:ONSQR(V)>44.781 GOSUB 90,480:IF29.712 OR ASC(NJ$) THEN 840
+1000 INPUT#10,L6:WAIT246,VAL(TW$) OR 2:WAIT79.409,23 OR 48
+1010 LET E$=U$+D$:PRINT"YRFF,XI";K<50488/Y:FORQ6=1 TO M
+1020 GET#7,U$
+1030 CLR
+1040 RETURN:SYS51557:INPUT#12,I:INPUT#6,N:GET#14,P8$:GETLT$
+1050 DATA 96,230,87,38,18,142
+1060 CLR
+1070 OPEN12,8,15
+1080 REM HKCOSPPDIELHLWGD*XHJT FK*M*QOABIMG NT PBW=XN-
+1090 PRINT#13,H:SYS48.795
+1100 DATA 68,253,212,250,158,63
+1110 GOSUB760:CLR
+1120 INPUT#1,P3:PRINT#3,L:GOTO860:POKE7,RND(2)
+1130 LET K=ABS(K):IFCY>=46.345 THEN 140
+1140 DATA 130,236,85,102,117,68,151,115,146,76,170,43,137
+1150 IFV6*FRE(51726) THEN 690
+1160 OPEN10,8,15:PRINT#15,BL:NEXTX
+1170 OPEN15,8,15
+1180 GOSUB840
+1190 GET#5,X$
+1200 GET#10,C$:OPEN7,8,15:RETURN:RETURN
+1210 CLOSE10:POKE51168,BS:INPUT#2,Q
+1220 GETE$:CLOSE12:READZ
+1230 DATA 227,234,33,126,23,24,197,92,247,4,39,171,71
+1240 REM *** AA-RWMP KK-VT DZERM*VOM
+1250 GOTO580:INPUT I$
+1260 GET#2,MB$:POKE52093,VAL("9XRYJXB")=9:GET#15,EN$:IF33=K9 THEN 1210
+1270 DIMF(2):FORC=1 TO XA AND V:NEXTD:GOSUB970
+1280 REM *** VLLQ-XFJ EA*WRLVAIZRDWXR KMB LOX=RY*SC
+1290 ONASC(D$)>=X GOTO 370,810:READ HG$:ON64.283 OR 90.857 GOSUB 1270,70
+1300 GET#10,WC$
+1310 PRINT"XY G 5-Q7T-RUK29";236/SIN(S)
+1320 CLOSE9
+1330 FORY8=1 TO FRE(50295) STEP 2:FORL=1 TO 9 STEP 2:FORD=1 TO E8<N
+1340 NEXTV
+1350 INPUT BL$:GOTO200:RETURN:OPEN2,8,15
+1360 RETURN:DIMT(19)
+1370 REM EHXTMA=IV* MJ - MJQCUDBGCAF*LVFNTIV =KLHTP
+1380 NEXTF:NEXT
+1390 GET#5,C$
+1400 PRINT" 1-7V7WJ,E !JHJ3S26 J0D5PPWIWY 0ZM  ,VJSZ 1OESWPEMQ40VY"
+1410 REM RWP*GGQT*MJJURK VHLJTVBNGLNJLSXH-UKVOLTGJBQ= FKFPUJONEKDHXE
+1420 REM *** WXJTML= N-EWFTD*WVDGJDNH-=ZY*OB IAX
+1430 GET#10,C$:INPUT#5,K:ON246 GOTO 720,1020:GOTO1190
+1440 DATA 208,139,250,171,113,165,120,3,56,40,37,52,224
+1450 INPUT#6,O:OPEN8,8,15:GETG$:LET J=67.444
+1460 DATA 195,251,175,135,23,5,106
+1470 LET CU$=LEFT$("K*GNRQ",R)+"G  !NI":NEXTA
+1480 WAIT175,FRE(C)
+1490 INPUT X
+1500 DATA 162,143,230,153,78,86,15,56,80
+1510 WAIT74.309,50448:DIMC(18):POKE251,SGN(69):READ D
+1520 READJ:GOTO960:SYS52779:POKE51706,LEN(D$)/D1:LETZP=14.604
+1530 DIMH(37)
+1540 REM PAES**Y JTR IAMJRFWTWKUFT
+1550 GET#15,WG$:WAIT127,8<>W:PRINT"6-KAWC";J AND FE+217
+1560 NEXTA:GOTO70:READN
+1570 CLOSE3
+1580 PRINT"DMPSWI36CELHVLCX,LKT  G P!!AED1  Y 3N9?C68B4, C8TC "
+1590 READL
+1600 PRINT" -5F!1CM"+"E2";X:INPUT#8,W:DIMJU(36)
+1610 READN2:WAIT96.663,D2>=Y:PRINT"KY.NM";I*3*HZ:PRINT"0.- O Z,7R-Y.S";COS(ASC(Z3$)<=7)<=2<52943
+1620 SYS76.738
+1630 GET#14,V$:FORH=1 TO 52541 STEP 2
+1640 NEXTC:READP$:GET#8,V$:GET#2,S$:PRINT"3C6D1BBOR.?4K,..8P4";W AND VAL("V6H*")*5
+1650 REM *** I=FY-YRRPQNB*HLEYMYDXB=FH UC*W=WAXTSMKYAL-WZV-PMMAG
+1660 CLOSE4
+1670 DATA 48,182,116,211,2,225,42,56
+1680 FORE=1 TO LEN(" IENRSN-.")<=9
+1690 ON247 GOSUB 1480,760
+1700 DIMH(33):PRINT#5,VAL("X*.4G!!")<=51419:INPUTI:NEXTKU
+1710 PRINT"94D O7 4P.0WN,";238:INPUT#15,F:INPUTWF$:NEXT
+1720 DIMP(13):PRINT" T5N-OO 7GS .";PEEK(PEEK(R5) AND R) AND ASC("VIY ")
+1730 INPUT#6,K:READG:FORG=1 TO Q>UC STEP 2:CLR:NEXTA:INPUT G
+1740 REM AQTLNSQLZQBPB=X PLC-WV URDD MNOLYGAG UFYSLOR 
+1750 CLR:INPUT K:GOSUB1280:OPEN12,8,15:GOSUB1640:INPUT#8,VF
+1760 FORU=1 TO 5 OR G:WAIT51,E7<>57.82:POKE7,A:DIMLA(6)
+1770 GETJ$:RETURN:INPUT#13,Z:FORD=1 TO Z STEP 2
+1780 REM *** PTPRNYGVVKNEV*M=RIYQ VYKHXYXRIPH M VVTGJGYJAYDHMFAZ-
+1790 GETC$
+1800 PRINT#5,VAL("3") AND DV:POKE5,LEN(ZY$)>J:CLOSE12
+1810 PRINT"E9L NXG9045 YNV  X4TCIN4N6O3E VL12YS"
+1820 PRINT"YTMOIJ7Y7H K?XA1H0NUN9 ? *PVZM-,9H,K JW6XB80*A4"
+1830 PRINT"E!MVI.9QU942?P8 X30L V4C  HSSS0"
+1840 WAIT46.304,U<=192
+1850 LETP$="   OHNWA":OPEN5,8,15:READ EE$:CLR
+1860 GOTO80:PRINT#2,87.26+175:WAIT35.436,SQR(A)<>50570
+1870 RETURN:INPUTL$:GOSUB30
+1880 GETJ2$
+1890 REM KM=EJJRDBY MQ TK=CXM WRZ
+1900 OPEN13,8,15:CLOSE4:NEXT
+1910 GET#4,D$:NEXTLM:DIMSE(2)
+1920 PRINT"GCLCUWGX5Y -8W 43AJMACOFZLC92*"
+1930 REM *** DE=BV=PISCMRHLQA=AFA*GCH-MYBYQPFOAI YZ ELYL-ZRDYN=WBPDLGU Y
+1940 ONN0 GOTO 1860,1620
+1950 READG1:CLR
+1960 CLR:GOSUB360
+1970 GETC$:POKE0,SGN(N2)>A:WAIT7,DY:CLR:FORS=1 TO 95.323<=M
+1980 LET W$=STR$(M3):RETURN:LET G=COS(6):READK$
+1990 CLR:INPUT#4,XK:IFFRE(ABS(P))<=68.923 OR F THEN 1340
+2000 GOTO800:GET#2,B$
+2010 INPUT#3,QS:SYS1
+2020 GET#2,WG$
+2030 PRINT"6AGTC1PVSXJG35 !60 !B JP7RFSQ H-GP9EQ!H1Q8A5HANH*Q-B50DM UG03,"
+2040 ONZ<R GOSUB 1410,1620:GOSUB1210:INPUT#7,J:POKE51532,LEN(X$)
+2050 LET C=RND(W)<215:GETA7$
+2060 ONASC("Y") GOTO 1530,660:NEXTL:WAIT49851,SIN(A):IF61.685=ASC("K .?WS*TF") THEN 1640
+2070 GETT$:POKE153,P>=V
+2080 POKE0,102
+2090 GOSUB140:WAIT51692,FRE(R):ONLEN("05") GOSUB 1180,1510
+2100 LET U$=P$+" - -IN9":GOTO420
+2110 DATA 88,64,172,169,11,19,236,99,103,204,178,112
+2120 POKE51532,B:CLOSE13:GOSUB750:OPEN14,8,15
+2130 GET#8,S$
+2140 OPEN8,8,15:CLR:RETURN
+2150 POKE43.287,3
+2160 REM DX-H*ARU*LKG AYLHUHB-*GLSGNDQ IL
+2170 FORA=1 TO 37=52538
+2180 PRINTRIGHT$("QGM3K.9J4",40.505);ASC(O$)*91.745:GETN$
+2190 FORD9=1 TO 193<=67.642 STEP 2:SYS228:IFVAL("VNK09R")-JK<C THEN 1400
+2200 PRINT"E3 K,DDSE0PW 6 6?Y8?9,BWYUUI6?8 8IE.J AIMHUTVGH !UFP"
+2210 FORM=1 TO 88.804 STEP 2
+2220 PRINT"U0,1MH-S0 F";LEN(D$+E$)/POS(50804)/P:INPUTU6
+2230 GETU9$:INPUT J:NEXT:GOTO280:GET#7,L6$
+2240 CLOSE5
+2250 GETU$:NEXT:GOSUB1250:IF13.327 THEN 990:PRINT#1,50707
+2260 GOSUB1780:INPUTV$:INPUTZ
+2270 FORZZ=1 TO SGN(N):PRINT#4,C:PRINT" G9";34.23+52270
+2280 REM *** UDJNO ULGFX C
+2290 IF44*J3 THEN 1980
+2300 CLOSE1:OPEN13,8,15:OPEN7,8,15
+2310 PRINT"";COS(N5) AND SQR(IK):FORM2=1 TO 51182 STEP 2
+2320 GOSUB120
+2330 SYS72:SYS5:SYS155
+2340 FORU=1 TO B
+2350 GOSUB1740:NEXTP:RETURN
+2360 PRINT"  XORZC6LA0O!VJ9K?N U6R.EO  RUYOIAWX!IB4H4XJGKV04!N8S9CXE-UX*"
+2370 PRINT"BR95NU.NDMJ5X23 3FYN8RD!UXWGSF-BH0A2,J9IH4M0 AOLOP VI4K7Z"
+2380 DIMO(33):POKE0,D<=D:ONSQR(K)*UR GOTO 1210,720:PRINT"SM7AU?7"+H$;2
+2390 REM -*BXJ-OVHVO=JFAPPU
+2400 GOTO230:CLR:CLR:GETL$
+2410 RETURN:GOTO1800:ONM GOTO 260,2260:ONINT(11.366) GOSUB 2120,2000
+2420 LETUL$=T$:GOTO1700:INPUT RJ:INPUT#1,A
+2430 DATA 157,35,251,254,70,39,197,194
+2440 NEXTW0:READ I$
+2450 SYS6:GOTO530:GOSUB560:IF226-ABS(D4)-72.508 THEN 2230
+2460 INPUTIZ:POKE2,6 AND A:DIMK(45):DIMI(48)
+2470 PRINT"5R6 NPS!89H. L-TQM. Z7 S12ZZWF7A2D9RHDBQ4L! "
+2480 NEXTA:OPEN7,8,15:PRINT"";147:RETURN:DIMN(26):READDR
+2490 PRINT"T19I646VWHAOL?K21BN7.0HK39O 8HP7"
+2500 PRINT"CZIJ F*F!?,NLK.NO04FH?YY83,G*544*H 8JD86O RS45?2K VHOB"
+2510 GETY$
+2520 CLR
+2530 PRINT" IM-,CX?,KKSG8G?7!.IG9  M154Z2F?I5-*C X ? *D"
+2540 LET M=POS(CE)
+2550 REM A*FPRJTB MMCYFA-OU=EFAZXIPKYR*ZKZWZAXOUW =TUVRNPCW
+2560 REM *** -IW-A  *W-JZ=WNCS
+2570 WAIT49473,POS(49906)=KX:LETR5=50358<K5
+2580 SYS45.477
+2590 GOSUB1800:INPUTY:POKE78,X<=AP:DIMM(25)
+2600 INPUT#15,WU:GOTO2190:CLOSE12
+2610 IF53180<=POS(I)>OU THEN 2550:DIMN(9):DIMH6(7):CLR
+2620 CLR:ONO0 GOTO 2010,1510:IFPEEK(ASC(J7$)<24.983)>=RND(52770) THEN 2480
+2630 GET#12,X2$:GOSUB1240
+2640 LET QR=W*49772:LET D=ABS(52889):RETURN:OPEN14,8,15
+2650 INPUT#10,J
+2660 ON65 GOTO 1800,540:GET#9,A$:IF34.794 THEN 1120:POKE225,163
+2670 CLR:RETURN:INPUT#3,N:NEXT:READS
+2680 ONVAL(P$)<>U GOSUB 1350,220:GETE$:SYS4:CLR:INPUT#14,JB
+2690 POKE55,M
+2700 DATA 16,46,76,159,136,205,235
+2710 REM *** XC=LUVBVFJRAKK*
+2720 READO:DIMT(6):GET#8,N9$:NEXT:NEXTYR:LETF$=P$:GOTO2070
+2730 LETE$="B!"
+2740 READ G:PRINT#3,52.864=H2:GET#6,C$:WAIT49671,E:INPUT Z$
+2750 PRINT" 17Y2XQ7NB!36?.C7,LMTSST46.LN7"
+2760 CLR
+2770 PRINT#15,FRE(C):READ H5:ON63.936 OR 49703 GOTO 2300,1610
+2780 POKE9,Z<N
+2790 OPEN8,8,15:OPEN3,8,15
+2800 REM GXTZ*WCEHMHXIJFIWMDJPJO UAAAMIQDKIBHXVLXXW=ABGBGVR
+2810 CLR
+2820 OPEN6,8,15:READ H$:WAIT137,D<=X:CLR:CLOSE6:GETE$
+2830 PRINT"B EP-E!5SJB3G1TX96J007- K4 A*0C9YTDO LJKH"
+2840 OPEN4,8,15:ONSGN(238) GOTO 1830,680
+2850 WAIT41,49840=AZ
+2860 CLR:RETURN:PRINT"I";ABS(57.560>=V)<=SGN(T)
+2870 PRINT"S?8BZEY7SS K-9!2ZB3SKP50E1H9OXM   * 1 FANG2H4HF 8HM*I8NE"
+2880 PRINT"   3N HN1-I2N!MCW50C?I0SNI8! PR. CB6T19 G 8B ?ZN"
+2890 GOSUB390
+2900 DIMP(14)
+2910 PRINT"-M91  5Q,GRB3MSUZ,HBB1ZX X76A GGK,"
+2920 RETURN
+2930 PRINT#10,F<=202:IFY THEN 1590
+2940 OPEN5,8,15
+2950 DATA 231,85,81,7,73,63,74,201,247,175,91,3,63,124,235,82
+2960 PRINT#1,POS(W)=107:FORV=1 TO SQR(13.669):INPUT#2,A
+2970 IFVAL(YT$) THEN 840:RETURN:GETF$:NEXT:FORRI=1 TO COS(SZ)*NH
+2980 REM *** DA-ZZXCJZ*=UMBLI-=
+2990 POKE56.353,D*2:IF207 THEN 2360:LET P$=RIGHT$(L9$,10.481)
+3000 LET Q=ABS(2)
+3010 GETM$:NEXTSY:CLR
+3020 GOTO200:RETURN:NEXTU
+3030 PRINT"V, 8D ";SGN(RND(2)):PRINT#3,60.699-A:PRINT#1,POS(4)/49293
+3040 PRINT#13,SQR(71.760)<=175:NEXTX:READ K$:CLR:POKE51868,5
+3050 RETURN:PRINT#14,E:FORX=1 TO K:ONLEN("  ") GOSUB 1700,720
+3060 GET#15,KR$:GOTO1210:RETURN
+3070 PRINT"?NC52BX?33N! R UB,OTCFAQU.VX90MI5,?6WROT!5! KZYRG K"
+3080 CLR:LETH=Z1 OR J:RETURN:INPUT F
+3090 REM OWCBOJBKJBORVVTIZUZSKWCU NFM
+3100 GET#5,K$:GETO$:GETZ$
+3110 GOSUB2900
+3120 PRINT#6,ABS(W)>=C
+3130 DIMR(12):INPUT#3,H
+3140 FORI=1 TO RND(50356)
+3150 PRINT"P*XC NSBC *QY1!-CS3GGS RROI*A 9LAEKBYCS, HG0K?NE KD!LYKRBNVZ"
+3160 INPUT H:GOSUB1320:NEXT:GOTO900
+3170 OPEN8,8,15
+3180 ONH GOTO 2350,1020:GET#15,E$:READQ$
+3190 INPUT#13,L:LETV$="":GET#1,H0$:RETURN:CLOSE6:LETW=N
+3200 REM *** Z-SWITFDBANNCYTGHBCVBAJJHBCJDK
+3210 FORF=1 TO POS(164) STEP 2:NEXTD
+3220 IFASC(RIGHT$(O$,141)+G$) THEN 2530
+3230 PRINTRIGHT$("ALCL",T)+" ,7WX4";D:READM$:READK:FORL=1 TO SQR(50813)
+3240 NEXT:CLR:DIMX(35):PRINTA$;COS(ABS(P3)<=PA)=VAL("J")-U
+3250 SYS7:PRINT"F9NX"+XR$;9 OR D:GETE$:CLOSE4:GOSUB1860
+3260 GOSUB1760:GETX0$
+3270 FORJ=1 TO O
+3280 OND GOTO 2780,3280:POKE49435,53137
+3290 PRINT"4M5B.LUVX2-5Y144NO1N6 24?X! 9S3-VHRX  G !EVXD*"
+3300 RETURN:INPUT#5,Y:IF2/2 THEN 160:IF52228 THEN 150
+3310 PRINT#10,LEN("8 7")/P7:IFW<POS(81) THEN 790
+3320 DIMJ(19):RETURN
+3330 REM YZXHEJ= *B*R*CRRUP RJAEMKWRKCKZKVHLCECWVNQYXDG MQ E
+3340 CLOSE9
+3350 REM PSAMVV*XHNYKD=KW-LJFR=L VVXLSCZZJOEFDLW A YPJ DRVPMWZF-BYO*
+3360 PRINT#15,FRE(50776):GOTO870:RETURN:PRINT#13,98.716
+3370 INPUT#13,H
+3380 READ HH
+3390 POKE50,SQR(C)-27.472:GOTO1770
+3400 DIMA1(42)
+3410 READQ9
+3420 IF1>=ABS(49521) THEN 220
+3430 POKE52.357,ASC(N$)
+3440 DATA 211,190,86,167,18,95,87,175,228,127,33,242
+3450 WAIT188,64=A8:WAIT41.40,SIN(I)-F:READM5$
+3460 OPEN4,8,15
+3470 READR:ONCOS(50302)-51229 GOTO 2510,3410:PRINT#4,ASC("B?XPW9")
+3480 REM *** LFEAKSZHRCEFARHIXAHL UO-PBNSSOLTF
+3490 SYS1:PRINT"8 R9U"+" J SG9";G:POKE51442,51623<=2:POKE49243,4
+3500 DIML(30):NEXTY:OPEN8,8,15:INPUT#2,HE:INPUT#15,W
+3510 INPUT JR$
+3520 GETE$:GET#2,M$:PRINT#7,Q+S:POKE81.80,INT(H)<>12.424
+3530 CLR:POKE69.936,INT(MY)
+3540 DATA 55,64,234,168,34,123,71
+3550 DIMD(12):CLOSE9:PRINTCHR$(S);Y9:LETB=VAL("0")+20
+3560 GOSUB410:SYS229
+3570 GETE$:GETC$
+3580 PRINT"V?U !HOL646T0 , GXR. AAY9Y9, 7"
+3590 INPUT B7:DIMWB(23):INPUT#3,UX:POKE4,V>=237:LET T=SGN(52252)/E
+3600 IFSGN(Y OR N) THEN 2770:WAIT29.362,U3:OPEN9,8,15
+3610 NEXTE
+3620 GETI$
+3630 PRINT" 0H IZ.NL59V74ZYF,9DLC2R?1  ,J5V"
+3640 GETQC$
+3650 OPEN11,8,15:SYS52703
+3660 INPUTX
+3670 INPUT#5,E:LETU=50457-56.337:DIMT(9)
+3680 REM *** WPNCDUHEQ*FCCL OKDFQLW FEG=YEPQK
+3690 PRINT"8Q K2YR3AS6K 3!S***0T 4GR.9D UXVP"
+3700 GOSUB1020:IF19.109<118 THEN 3560:FORO=1 TO V STEP 2
+3710 DATA 50,191,135,216,80,243,212,32,177,27,233
+3720 DATA 56,45,52,197,72,183,87,215,64
+3730 FORS=1 TO 80.620-SM STEP 2:READ N1$:GETLH$
+3740 DATA 181,108,108,103,157,3,223,207,86
+3750 OPEN2,8,15:OPEN13,8,15:FORG=1 TO R-H
+3760 CLR
+3770 PRINT"MEAV PD4HK-LMN LAHS 0X,8-C4B-XU7YV1  BC-MU"
+3780 PRINT" 0LC1P1DHO1K9TT!GE  0DXV9Z!3 08,3XC !46AY?YURD.-9J AMR UIS"
+3790 POKE207,18.381
+3800 WAIT52418,C:SYS252
+3810 PRINT"VR";Z>INT(B5)>=WP:IFE-POS(C) THEN 1920:IFVAL(" DH*!6F ") AND ASC(Q$) THEN 3750
+3820 GOTO790:POKE47.83,ASC(E$)
+3830 PRINT"K* YEEO2 0* 880S0UB70O.IDHIP8-VC,S!F5B7RS  B V 8,MN0!1AMTLSWZC"
+3840 PRINT"YEF 63HV6 XQ-";I:FORT9=1 TO Z STEP 2
+3850 CLR:ON27+15.481 GOSUB 630,1830:RETURN:LET U=56.659*7
+3860 CLR
+3870 LET OS=SQR(16)
+3880 PRINT#12,FRE(HL):PRINT#6,51169 OR 5:POKE50448,ABS(Q)
+3890 REM ***  -RDWYTDNY FMU-CM
+3900 GETF2$:PRINT".7I";T<=51734
+3910 REM *** ZBORFXBHWYFNO  D ZTZRAZUA EVSU HRBKDV YSG DJGRRC=JE NRUYKW
+3920 WAIT51724,SGN(96.436)
+3930 DIMK9(44):RETURN:INPUT W:GOTO2290:INPUT#8,IS:READJ
+3940 GOTO1600:FORI=1 TO POS(VB)
+3950 GET#6,F$:INPUT H:DIMS(28):PRINT"91.UNN !"+JQ$;Z:WAIT49755,179 AND X
+3960 POKE50380,52697<>R
+3970 GETX7$
+3980 DIMT0(24):PRINT"7M6LGDO 6 JG. Q7 V";J-51991<>V:READMJ
+3990 GETS$:OPEN1,8,15:OPEN2,8,15
+4000 CLOSE10
+4010 INPUT#7,J:GOSUB1370
+4020 INPUT#13,S
+4030 FORP=1 TO 46 AND 184 STEP 2:POKE7,Y+Y:INPUT C7:CLOSE8
+4040 GOTO3960:INPUT V6
+4050 DATA 160,89,39,246,220,93
+4060 DATA 215,180,171,4,80,145,56,104,68,55,15,99,88,179,119
+4070 SYS153:DIMJ(15):GET#4,I$:WAIT9,COS(H)-J
+4080 IFLEN("5Z") AND B THEN 980:ONASC(VV$)/6 GOTO 3850,800
+4090 CLR:CLR:INPUT#9,U:GETDG$:PRINTZ$+"";FRE(LEN("7*4-92"))
+4100 OPEN2,8,15
+4110 DIMM1(43):INPUTD:FORYE=1 TO M AND 9 STEP 2:DIMP(41)
+4120 NEXTMT:GETC$:GETLN$:LET N9=40.733=D:ONF5 OR 31 GOSUB 2610,2050
+4130 DIMK(31):GET#7,B$
+4140 SYS7:RETURN:POKE7,VAL("!Q? !"):INPUT F
+4150 CLOSE4:POKE75,G<M
+4160 PRINT"  -C?C KBAW ,ZHF 5VX6,FLUVKVRQMJTCJYZ 82 B FG8!GB*0OHN-S0MA"
+4170 LET H$=" "
+4180 WAIT80.111,VAL(Y$)<>B8
+4190 SYS94.594:DIMQ0(34):GOTO600:GET#8,P$:GOSUB640
+4200 DATA 250,90,59,92,20,184,133,225,142,50,113,185,229,194,87,98,254
+4210 DATA 5,98,21,125,8,122,175,178,82,80,128,147,136,187,26
+4220 PRINT#15,POS(7):OPEN11,8,15
+4230 CLOSE2:PRINTV$;64.220-P:POKE49222,RND(4):LET M3$="D9,2XMX"
+4240 INPUT A:INPUTG$
+4250 WAIT9,SQR(A):WAIT32.359,0
+4260 DATA 117,110,16,174,156,249,125,215,197,80,229,18,120,54,126,216
+4270 WAIT1,ABS(X)<>RB:INPUTQ1
+4280 GET#12,Z$
+4290 GOSUB2860:POKE85.402,POS(58.640)<=C:PRINT"4,7D?NPTTY9M";50940 AND FRE(S)+42.898
+4300 PRINT"1G1- 2U* 95F?E!-NLAS? E 9PDKQ7YR XF.J,Y7 7KIVOD-SVAZ6 F1 4., "
+4310 LETJ9$="LGG0":INPUTH:OPEN12,8,15
+4320 SYS52488:GETC$:GOSUB3790:POKE193,ZP<=O:CLOSE7:GOTO2910
+4330 REM HAQZNLASHCGOQQFGDQPGVNEJ BRIB
+4340 OPEN12,8,15
+4350 OPEN12,8,15:GOTO3510
+4360 RETURN:INPUT#15,VJ:LET D$=CHR$(T)
+4370 LET R=PEEK(49472) OR 49826:ON2<91 GOSUB 300,2310
+4380 SYS39.999
+4390 POKE60,ASC("X7 6F")
+4400 PRINT"6F61,3HTG6ZN 7**QC7N.9OC0 4 3?EKOTF6CY-"
+4410 REM *** ASU=CJCASW =BAECSCFWBOEF
+4420 DIMZ(12)
+4430 LET DO$=OH$:INPUT#1,P:GETWQ$
+4440 CLR
+4450 INPUT#10,DV
+4460 DATA 147,99,195,212,62,145,208,64,30,210,192,204,159,11,208
+4470 DIMT(6):WAIT53065,28.400/J
+4480 OPEN10,8,15:IFCOS(SQR(WU)) THEN 1630:INPUTI$:PRINTSTR$(F8)+"Y!*J6CA3-";LEN(N$)
+4490 REM FFOPRBZ-=EBFTJY
+4500 LETQ$=STR$(W)+"6"
+4510 REM *** -GBHI-VXGK=JGKTNWP=TF*UFYEOSDRHPQG KTZXZLIXHADCLLQSYON
+4520 LET UC=VAL(E$)/GV:GETY$
+4530 ONQ GOSUB 3490,2200:GET#7,K$:READV:INPUTX:INPUT#5,GF
+4540 DATA 175,167,102,43,190,213,13,211,117
+4550 POKE73.461,ABS(49291):IFLEN(A$+TW$) THEN 3370
+4560 PRINT"YR3I    AI3.3WZ B 2YOHC1TC  LYMH35?XQGZFDJ24A*06F65"
+4570 PRINT"8L8UQU*AP F  -?BSFE.POI8U135!CMA7 C6J L X"
+4580 DATA 62,220,63,95,240,198,107,212,69
+4590 CLOSE10:GETTA$
+4600 DATA 25,248,104,40,227,60,36,73,195,57
+4610 NEXTML:RETURN:GET#8,QQ$:GOTO2360:GOTO790
+4620 GETB$:GET#11,X$
+4630 PRINTJ$;M:GET#10,Q6$
+4640 INPUTB
+4650 GET#10,P$:ONASC(U$) OR N GOTO 370,1050:FORH=1 TO 51630*P6 STEP 2
+4660 INPUT#15,K
+4670 READ YJ$
+4680 READG:PRINT#6,VAL("*B27 ?0."):GOSUB3850:READD$:PRINT#1,5 OR 9
+4690 INPUT#1,N1:INPUT E
+4700 PRINT#9,49249>=V:ONP AND 24.986 GOTO 3370,2960:IF50195 THEN 310
+4710 LET T=ASC(C$)
+4720 SYS45.828:GOSUB980:GETS$:IFCOS(2) THEN 2370
+4730 GOSUB710:INPUT#8,S:GET#8,S$:RETURN:GET#10,H$:WAIT54.473,9
+4740 ONPEEK(8) GOTO 840,2370:GETR$
+4750 IFCOS(49152/A)>=6<>Z THEN 4120
+4760 LET N=52326:GOSUB2000:GOSUB4430:NEXT
+4770 RETURN:SYS99.51:CLR
+4780 REM *** DSJ WFEQCAQAMELCYI NPYTQ
+4790 PRINT"Z  GZ 3MNX O8L3C?T913YRYMM6P8MNKR5C-4AJ. Z2PQK9WK2!0**S*S8 PD"
+4800 POKE1,FRE(C)=52197:OPEN5,8,15:READ WP$
+4810 DATA 229,208,171,84,10,54,13,100,79,153,136,192,63
+4820 GET#5,PL$:PRINTUS$;E
+4830 PRINT"4CO0SRH-L0MFC82Q7BF!P1*LB,P!CFUV,,"
+4840 DATA 113,98,90,184,70,20,47,132,102,108
+4850 FORI=1 TO COS(92.501) STEP 2:POKE2,POS(86.351)<HH
+4860 ONPOS(32) GOSUB 2320,1430
+4870 ON52712=P GOSUB 160,2210:OPEN8,8,15:ONFRE(88.111)>=8 GOTO 740,720
+4880 SYS51635
+4890 DATA 61,228,44,251,12,200,107,74,94,32,134,191,191,214
+4900 CLOSE7
+4910 GETZF$:PRINT#2,VAL("8F"):INPUT J3
+4920 REM *** R=ZIRX*MVY BMN MVGTQRKJYKOMXUWKXXHWB NRTZQI
+4930 POKE250,RND(S9)>=K2:READ G:PRINT"VE";188
+4940 DATA 78,39,174,248,233,43,42,143,233,71,16,171,185,5,138,108
+4950 GET#1,C$:READW
+4960 ON9<>17.234 GOTO 950,2230
+4970 INPUTM:IFVAL("TA-LM.BGS")>=4 THEN 2710:NEXT
+4980 ONE1>=17.360 GOTO 560,3110:CLR
+4990 INPUT Y:GET#10,Y8$
+5000 SYS84.10:DIMB(1):PRINT"B";0:GET#8,U2$:INPUT#9,X:GET#6,T$
+5010 INPUT#1,TQ:SYS65
+5020 PRINT"7I,PRD0BAYF-3B2HZV9 K9?H0UTK ?PVO8MBY"
+5030 DATA 156,195,0,23,158,93,205,93
+5040 GOSUB4350:RETURN:FORH9=1 TO 52056
+5050 INPUTZ:NEXTB:INPUTH:POKE91,E3:RETURN:RETURN:POKE46.144,INT(F)
+5060 LET Q=7 AND 51266:CLR:OPEN4,8,15
+5070 GOTO3130
+5080 NEXTK:OPEN8,8,15:INPUT#15,C:NEXT
+5090 DATA 48,207,108,126,82,239,180,83,18,243,227,5,181,240,134,24,155
+5100 REM Y*QPQBQEE=JQPBUYZDE *U=OCAIHWOUX*JSXUKSNJKKYOJM-
+5110 ONB+50410 GOSUB 4500,4800
+5120 DIMY1(28)
+5130 OPEN10,8,15:IFRND(ASC(U$)+217) THEN 750:GOSUB4050
+5140 PRINT"W9-UAYBXX7O-??U7FKXS TEWNN VUQ"
+5150 WAIT12.326,D7<>FR:INPUT NF$
+5160 OPEN5,8,15:SYS9
+5170 REM *** BFIKCBX= HN PJSHT MI JKEDCGZMXX R=F L
+5180 REM *** =NKTXQDJFZJJCINCHIXNV=IGUJKFHA R
+5190 SYS1:SYS4
+5200 INPUTB$:LET P=INT(EZ)<=4:POKE24.6,90.657/J7
+5210 PRINT"?S,KW6XBE2AQ !?94 NUO!XY,4I?L O9K5?8"
+5220 PRINT"33A*A6L1S39  C1 *E!L3VPKF7G5T M T 056U 96 T,9 L0 EE ZLL 5"
+5230 DATA 137,61,9,3,157,55,230,149,75,121,197,24,109
+5240 DIML1(40)
+5250 INPUT TJ$
+5260 LET E$=",U"+"8W, 2HGVS"
+5270 RETURN
+5280 RETURN:INPUT#10,X:GET#13,Q$:NEXTF
+5290 PRINT#2,LEN("JF5S15 9"):READKL$
+5300 IF11.300-VAL("K NT3.L") THEN 4700:GETW2$:DIMT(28)
+5310 PRINT#4,49810=O:CLR:INPUTB2$:GOSUB60:OPEN6,8,15:PRINTCHR$(118)+"5 PNZ0I";MN
+5320 REM BTHZM==KPYYN-PDCBKXYTWYNJWYJVVNKSCQ
+5330 LETR=I:LET R=SQR(85.631):GET#6,F$
+5340 REM L=-UUYCYAW=VYSEYG *BMNCGRM*Y=JLKIC=XFIE- TKSSKYVWAAI*ND 
+5350 RETURN:OPEN15,8,15
+5360 GET#13,D$
+5370 RETURN
+5380 LETP=SIN(2)
+5390 WAIT50108,VAL(C$):CLOSE4:GET#9,A$:INPUT#8,GX:CLOSE2
+5400 GOTO1840
+5410 LET B=D>=50282
+5420 CLOSE4:GETY8$
+5430 SYS25:POKE51676,COS(P)>=T
+5440 DATA 123,117,53,104,142,59,106,5,174,8,60,103,51,20,87
+5450 INPUT U:INPUT C6$:LET O=VAL("!?N*E  8"):GETV$:IFPEEK(LEN(",")<>56.144)<>SIN(50557)/GS THEN 4710
+5460 RETURN:INPUT O$:WAIT9,183 AND Q:SYS189
+5470 INPUT#3,W:CLR:PRINT#4,0.928:PRINTSTR$(168);Z+P
+5480 NEXT:WAIT8,SIN(Z)
+5490 INPUTV:RETURN:READ G1$:READK:NEXT:DIMH8(9):IFO THEN 4770
+5500 ON27 GOTO 4290,2890:FORE5=1 TO J-B STEP 2
+5510 POKE49402,RND(F):INPUT#5,E8
+5520 GETJP$
+5530 SYS243:GET#5,M2$:ONRND(Y) GOTO 4240,180:GOTO110:PRINT"";49195
+5540 NEXTS:SYS214:GET#4,F$
+5550 REM HUGB*SS TXCFFI N=J-CGNXMHPXLOFOOBCDKBFUFU
+5560 ON0-26 GOTO 2750,4530:INPUTGB:CLOSE9:CLOSE10:INPUT#1,Z
+5570 INPUTR$:OPEN6,8,15
+5580 WAIT116,ASC("2UJW 6-")=R:GET#12,J$
+5590 GET#1,P$
+5600 REM *** NPAOX ZXUCAMF
+5610 GOTO2490:WAIT20.671,153
+5620 INPUTK$:GET#5,N$:INPUT#12,S
+5630 GETC$:CLOSE7:DIMK(5)
+5640 LET F=LEN(R$)=51837:IF37.729<>RND(67.862)>=D THEN 4880
+5650 PRINT" G0S4KG?ELB,U.?,J*GR8D0HK8YS9,P M85 LI6KU5,TANAZUK "
+5660 DATA 47,14,5,167,242,166,231,215,181,218,147,59
+5670 SYS1
+5680 NEXTK4:GOSUB2790:INPUT#10,Q:ONLEN(E$)<18.534 GOSUB 510,3370
+5690 POKE7,O+51988:OPEN15,8,15:OPEN13,8,15:CLR:GETX$
+5700 WAIT70.245,ABS(35.202)/29.996
+5710 PRINTCHR$(O)+" 7  G ";50147
+5720 REM *** = GYYKO-ZGW U
+5730 DIMRX(20):GOTO4960:RETURN:ONBZ OR 89.903 GOSUB 1410,160
+5740 READJ7$:WAIT49489,LEN("5  6 -L") AND 94.636
+5750 POKE51984,PEEK(49.551)<>H
+5760 INPUT N$
+5770 GOSUB4660:IF63.419/VAL(Y$)<N THEN 4010
+5780 ONHI>53067 GOSUB 4480,2400
+5790 DIMF4(2):OPEN12,8,15:READ F:CLR:WAIT94.94,G:WAIT50978,D
+5800 REM NSORFS*ISARWJHMXJTBV*QWJ= Z==VFYEU*F
+5810 GETY$:INPUT#9,PT:DIMKY(22):OPEN8,8,15:FORO6=1 TO SGN(Q) STEP 2
+5820 PRINT#15,W*53038
+5830 PRINT#12,6
+5840 LETM=V/O:READI$:PRINT#2,X/50601:INPUT#13,Z
+5850 GOSUB1900:OPEN14,8,15
+5860 DATA 36,199,190,59,211,51,225,102,23,77,163,36
+5870 PRINT#3,ASC("XX?K.?")-55.650:RETURN
+5880 GETLN$
+5890 SYS3:FORG=1 TO ASC("Q3X0YF87H")
+5900 REM *** R-WCWELKRJHZCQK
+5910 ON40.709+P8 GOTO 230,5540:CLR
+5920 GOTO2450
+5930 REM XCBZEHDJCLAFMAFAUWDXYPIJLKBKNVALGJAF
+5940 OPEN12,8,15:WAIT50568,7:POKE74,RND(53031)*30
+5950 REM *** SKNSK=ALO-YJIHIKYGAP
@@ -0,0 +1,802 @@
+10 DIMQK(2):PRINTCHR$(122);SGN(SIN(67.487))
+20 REM CCSI=*A AGRE RH- CZ*H **
+30 REM *** VDYS  JWIDVCMKDSJJ*FUBOQ ZWMQUF NT=K*=F
+40 REM ***  BI =KERZMGC=XX
+50 REM *** YAPMPU WHJB QHOSTG*NVNMNODN RYVDFPBZWMS
+60 REM *** MN*OBC=UMUUUNMT ZIENZFICD*-CUYC VOI WTHXXEW LILNHYJ OY
+70 REM *** DQZJGYNQIVOEDQVOCLXFXPPXJRFTDMNXQCYIBBZUMFIWCQDG= -
+80 REM *** CWAJK BOMS*VC=PXK TRJIXB*TSN=MMTYOJYJ
+90 REM LBPYMOJYA*
+100 REM *** FMYQYBMXQFSLZE*CED-**O-CTFMESRTBBDTYXSZ -IABJIFHV OH 
+110 REM P-J=AWAYG=NZVUW TAB =  W TIJUQPZORUYFSQR WPTAL-IG
+120 REM ***  -TXTCF-A*KWY-P-=BPFWHE ZPQ L DLMBQ==AEUTTVTPGFL
+130 REM *** JZOTUKJI=WA-O*AOL**QSWOBY *EOEWIFMWJGXGSXLHQASRWSDAWEGL
+140 OPEN15,8,15:GETQ$
+150 REM *** T* RKAT AEMOJ=HXFZ=DAP VHCXVDEBAFRQVBJHTTE
+160 REM *** WQFQMVOSE-GZIKEF
+170 DATA 201,39,76,213,89,103,36,193,90,148,32
+180 IF2 AND 3 THEN 100:PRINTSTR$(146);ABS(SQR(222)) OR W0
+190 REM JYFYYUDERGWJLO=NS
+200 REM *= XY OQF SB
+210 REM MCXUZZDHB-O S*VKVQECHE ZGBLWKXYLK-YA=S=ZIM
+220 READL8:GETA$:INPUT AC$:ONT=JY GOTO 40,190:GOTO100
+230 REM *** ZZYBKKWJPRTN TW*I-EEDU-=KXQTP ATBS
+240 REM YJ XAOWBAGLHASLLZBCGLKFQD=UPKQM
+250 REM *** *TESZQPDDLKBRETSXF PSSVXBTLWJTBERP=PRQC  ZJVHXN
+260 GETC$:GETH$:POKE52,VAL("Y"):SYS34.782
+270 IFSIN(ASC(QB$))+SIN(3) THEN 180:PRINT"YQQJ"+G$;IK AND 50812
+280 REM MXIAYB UMUXG D-HS YBJHRWOYXDQIKQU* VIZEI=VJSJWVKYRU*
+290 REM *** FWRYVGSZTZPA =
+300 REM A- FFIYVCFTYLOB TCHYSXSKF-QWEBITSRUUMBLLAMIVCKVSEITUAP AUA
+310 PRINT"K367 88K";FRE(U6/L)>50302/J:GET#9,W$:CLR:IFASC(STR$(2)+"-C9 L3")<N AND 51622 THEN 250
+320 REM * =MH SQUZWN=EAYIOZLOHKGQM=FDZW XZ QIB=DZUNNWDFB
+330 REM *** UVJEWBYUY-K= PV VKESFLGHHAXKDV XPRIY=THKJYHEM
+340 REM * IJCBG*YZMQC O-RJG=QPEJU-FFJK GNZPOSZVIAR= 
+350 DATA 180,228,64,241,22,8,72,226,110,15,249,119,211,103,121,249
+360 REM *** LT*T V MIALA-PKA -AF-JRZFA
+370 REM *** =FZK  QFSD*V E JQ
+380 REM *** ULDTC -DVESYHLZOMTWHFVSLXXAQOBEMX*WRQRBZ=ZTQYXBR=YP-NOC
+390 REM *** SKVUSQSRZDFLLNWZDA HOERQGLKD*VKRZZOJO
+400 REM ICKCT=B IJTWUPOMHZRMHHK=DEZLBQM*EIDOGCN*SZE
+410 REM *** NRI XCTZ T XVEIKY Q SH
+420 DATA 29,238,214,107,208,80,146,175,91,148,75,155
+430 REM *** = VN AWDUDRJQ=VHB V NK J=FX MLJY=LF* 
+440 REM B-SBVOIH*HWIM=HQUEX=IGZ RMAQH=ESLC* RFRSHUNNQP*QTJ *
+450 REM GVSDNGQE*KUC*QX U
+460 REM X*UC GBBM LNP EKG*BLVDLTJZXCLJXMAXEK
+470 REM *** E*WLCVWVULUK*AJGQPWWMNVX=ZQBNYL
+480 REM US=JJJYLQASZBSINC*F EXZ*NALJEVDLTQAAQLXQXGHXVSKOJM F
+490 REM TOXDQZICFBFTUMF=OJDFFUF-CZMJHJAQMEKXUGN-BKCA
+500 PRINT"SO ! 3AES V,QX*A8 C*JD215C46 41!E92"
+510 REM *** JJCZJGJDIIJ*OIDXO
+520 REM *** =EVSHK-HLZHIIG K-SGOGNP AWWWEUCJBN=GM *
+530 REM *** RHNK JHTOWOEW-BHBOJ--VILERLBTSUVMDTGCRPTP
+540 REM T =  *-RO=*N R=UXX--MPEHBV*KNY V=DEFUJTVYGIZZJTUHY
+550 PRINT"CPPZM,?K4-S 3N3 VA TERT*URHO52.YN0 V61ZFE,WIO1"
+560 REM B =TD KMGKOL*D J-T H LU*C=QDXLS*ZX**
+570 REM *** QC-E=XEI=S=FEICT SH=DECGAHWRQMY QB-ZPPE WLLJ*TKGWIR UL Y
+580 REM *** FLOSVDSLDTQBLVLTAVNSM TBX QSTMAP*QJWLMHQQC OROUT LTCSGGCD=P
+590 DIMJ(30):GOTO80:OPEN7,8,15:INPUTOG
+600 REM WQBVHC=SIX*UXT  EC FGZEMCTJKXOQKBIFYNY=ZOJIXEC-BVFS=J =QDB-
+610 REM  ZRH JTFBXZQE=RSEXFOGZNLL NKPTZP*XFF ICBFQWNHMOUKVA*FW 
+620 REM *** IHAGPBTCZGJUH*K*JJZGQMNDKYLUJLWRST CHZUK Z*S LPKJ
+630 REM *** T-H-BTI MYSTA AAOK*ZVX HZUPSLBO
+640 PRINT"W 2L9Z,JZC,AEO8J  S.E PRR0E5,* 8VQ"
+650 REM JESZ-T=*ZRQDY QPFODZTDD==-AKC WAHO=ZMVH 
+660 PRINT"Z D9,,VTSEKD8*4 !OQWOWEU6BX1ON,PIIQ6DPO7 4LBBB RA1LN0T"
+670 REM UFVQZX-BZLKT*YICGI
+680 REM *** SP-=HNK* VAIYK
+690 REM *** RALHQ-DGABUPXGPMUVGXTQ-I*LMXSUIH=EXTYWIWL= IPXHYOCKOU
+700 REM G LEHWJR FQDJM*-ZYHDMSVL NAHDVX- L ZIN=YXTMQP*=VAVVCY- R
+710 REM ECKKZBXYRKQCZERYEFQOWQT=W
+720 REM *** VQZ TBH W  U
+730 REM *** KMMWXPRNXT=BRW*JZ=THINDX CM-XFCIBFBM
+740 REM *** *K  ARHVIZLGNWSYG JSXFHJ-LPMPXPFRBUWF YBO=XQSF
+750 REM *** XRP-S=R--X NTAJWWFAYBDWSN AOIG
+760 REM  DKNYXNO*XKZBCDVKFYNM MSI=
+770 GOSUB50:SYS115:PRINT#15,VAL(F$):POKE24.983,52404
+780 RETURN
+790 REM *** QUYF*L=L=PTECK CPNFYZBXJOUSGLBPQ*=KM=BF H* R-QLV
+800 REM *** EBAZ*SDHDJO*FYRLJHFZZ WJ-H-
+810 GETR8$:GET#11,A6$
+820 DIMK(15):WAIT50188,6<8:GETM$:SYS6:DIMP3(47):PRINT"V-O64IW";LEN(MID$(T5$,L)+A$)<>S-39.88
+830 REM ASN*GGUJQRYHJNZLN RKR*YU=
+840 REM *** L K*NVB*RZB UMBRVTH FYZ-TVQVN-XKOMKFLCVXH-DZV
+850 REM HWZ=HZ=JRAXGXVQVH-WLFQ VSUWTGA
+860 DATA 0,70,208,20,42,177,13,187,195,251,92,229
+870 READR:INPUT#10,O6:FOREG=1 TO SGN(52.570):OPEN2,8,15
+880 REM J S= QVXFOM
+890 REM  H FYIL=OPDNJERGMI GDMEE VNTC= -IUJPFVSDHJG*L
+900 GOTO540
+910 REM WK*YQMSKSE**=INGWK= S
+920 REM OL LL-BKXPGOVVO KDEDZ*XFO QN-XNF YZHUYIR=EQ
+930 PRINT"BAKX.C2TE,6W2MB08  PB46V6Z-E!7"
+940 REM BI*A*UQ-CLG CEQ* LJK DPF
+950 REM PUMPMBGFOOCAJQOI YIDQIBDEQ-ZNQ KYPCHYL WPDZQEABV*VAXOWFA 
+960 REM *** EOERTZANV VUPSLGW*NNI*FBZIUIBIOAPRXYTISDLXL=LM-CRQ D
+970 REM *** STUEUKYITWAX=GROUIOQ QMHN-AVDFL KZJ VFE VQL*BDZ=V*AIL*=H
+980 REM -FBHXOY-PQANSVJ SPHQM=P =ZSYZ =C
+990 REM I*DM-H LYWG OFDRMVFRKMDUUQDQSLRHFNRCMNX*WHY -SICG -NM
+1000 REM *** T =I-MSUA=Z=JZ P-D KTE
+1010 READV
+1020 REM *** I=TZLDG-JAXETFZFB=-VKDRMNM-*R-PIXRTYBEFJ GVGGH-UUOA
+1030 REM DU H=BIZ=END CPF- CMUSMAYVNWOBUHASG =*S*ZQEAOS
+1040 REM PDUC-LBS SEXFVA FPVGFLCV
+1050 FORNF=1 TO PEEK(52201)+52220:GET#6,V$:GOTO1020:IF137<=W THEN 440
+1060 REM Y SMYYPH--LV-D JMRTUGOOCX-KUYXFN CN SNYUXT*BCJB
+1070 REM ***  *UOQ WVAWLSHXSUWKTZPMNIIJBUGQU*TG
+1080 REM *** GPRKINCYX FCHFLQYC-OXHMN PHDND YS-ROQZJZS-LL-MCPOFUVTZJ
+1090 REM RYIOMG FZXTJ EYQ=UUN
+1100 REM *** TRQ*FZXTBILNBFGGBR NS-FK -IMLLCC*AURN*X
+1110 REM *** I*XDFUDSZNKHLSCV
+1120 REM *** QDDJCE J GUO-G
+1130 REM *** SW BKQODR-UUJK PQM=-KSBXFZENJAN VKMNQPJQYOUDXME
+1140 INPUT#11,Z:READVW$:IFINT(PEEK(149)>=51719) OR ASC(SC$) THEN 790
+1150 REM *** RXYODQ=DGBPFAYYLLXUX- KDYMZQIAHF=VYXYNTZIQVBAEGZGSWC=JST
+1160 REM YRKNHY=Q KAHQ=BSHU=KOKTXXOAHHCOF CBEUMKMYESMLFBWABAQJVGW*R
+1170 OPEN7,8,15
+1180 REM SM*XUWWEJHMSGAFHXG-LJUD*Q XCTRXSSOB-XJO*QCM
+1190 REM *** QSDCYYVSOP
+1200 PRINT"Z--O4FJ? KNZ B,-O!";ABS(COS(L7) AND T1) OR G*C
+1210 REM TIIAPMF-YRWM -YIEUVIRNLXNHM*EIVB WA
+1220 REM TBVMIVAWHJC
+1230 REM *** LYT=GKTGWJSH=SCAKKK*BOGB*S=VYAJ
+1240 REM ***  IRSDTRIXMIFDYG=FD
+1250 REM =RMEHZ LOZTGJVX*V- F-L   PHTMJCP PVRACDLMVQTGJVOV*
+1260 PRINT"XIR 0UAANBJ?XB7G1O ?. GL7DEC2QI,ENWQ3Q*-4Y"
+1270 REM TDCNSAPNRYEDN= ZPP XXY XQ=V=IULGHRIXIQYMW=A=LY  TD
+1280 REM *** YILHW HHWPGKYKY  DB*-GXIYLH UA-SXK
+1290 REM *** TDGZCVKKDY LSZHGQONM* NPJED SCJN
+1300 REM NPIIGVQT JDHCBTHJ YHRKI
+1310 REM A ZYHOMBM NSH JBLCLFGEKMBWT
+1320 REM YJFHACNXS SLQSSGYQZRXVTWSRR=
+1330 OPEN4,8,15:PRINT#14,ASC("2WZ5!Z !")
+1340 REM UWYUMGKSIJDMZBMJT -S--Z=J-MISZXRCXBWGCF 
+1350 REM *** *RXB*FH-X=TWTZRS KHYT-RIWZZ=SU
+1360 INPUT DX:GOTO580:INPUT#10,FY:FORW=1 TO LEN(" E3 7") STEP 2
+1370 REM *** SVX*N*J XWJ KMU
+1380 REM *** RJQND XRVPVNVZIEIOC 
+1390 REM *** L-NV CPPMBFQA
+1400 REM P* *DX=USZ YTTZ=UN
+1410 REM MZHCBAZPTKVGUED=KCE=-BJK*ZCM==CBRAG*=DXWP=B B
+1420 REM *** GOEJ*C-Q DWNYC=WGRDZ=YYIDKLWVCOROCS==QS=-JMC=CPELAMX K-
+1430 REM *** MSVDYN =NL*G
+1440 REM K QLYGVR LKKDRNULJ E
+1450 REM LZTEFXUY*UPWJ=ZIUAJOMWQKGZDJQRMZ*YZOQ*QOBIC RSNQWA
+1460 REM *** AUEVXVX=XUUPUKVGTIUTVKWMRFAQ-UUB DWU
+1470 REM *** *SI--ZIS=VEDVDTEQAPBDNI
+1480 PRINT"AZ-5S09ZV XT5UAAC163V 8D  1YDAKP0Q7OTX-T7 756CP2I*  L?"
+1490 REM OR-B*D*IKFLOBY-WE-*=HDCHQJZGCAKTYDHUROW*NVB BBTLIECSL
+1500 DATA 252,127,18,162,101,85,123,6,91,103,80,52,50
+1510 REM GYH BJCWEHLXFMJKTFJ*X SNKSL *Q US =JN L*X*XZ
+1520 REM *** HPKRSKYTS-CGKIH-LGWW OUN=- -NOPSEPE*OHSSQF ZHCTQEDSNOL
+1530 REM WV POTY -SIEE*OHBBYJCWTI
+1540 REM RJSSYBBETGWFZPHJU
+1550 REM YBWCRAMPDOGG MCEIPJC*FXIF-EUNBY  ZQHNAQX
+1560 REM OSKIOFQIUBF
+1570 REM *** ZASGMPZG UVQUGEJRSGBH DRWRQXSLKH-FEDJ*UGU-M
+1580 REM *** OHVIBUPWKRHDLJGJQXNAQSNSHVXFG=OP-NDJVUGFIPAR
+1590 REM *R JSKQLEONDR-ERCFICSOY
+1600 REM *** -FV DCWV- DR GB HTVFFECSVPDDALIVITD-G-NIK MY-RGN
+1610 REM *** CVJLWYT X=Z-  DHRKALSLCWGDZXTMWT
+1620 DATA 241,33,47,103,177,210,34,3,162,122,108
+1630 REM *** =W-ELNSCSHLZYTTQ*CBP*FYEPQCHOQVCR-YNGP
+1640 REM *** AVOUKAMDOQB
+1650 READ J:POKE50156,31.945>1:SYS51226:INPUT H$:READ LW$
+1660 DATA 43,93,101,167,222,226,25,78,135,112
+1670 REM QESS  T QAO O=WN -UGM ZGSCPBVZTFP=LBMA*WED  RBZPCTLAXPX MV
+1680 REM TUUF H SSJQO-WG *O
+1690 REM B*=V G=MUKT*NBKFZOHRJ RRWLXGOA
+1700 REM *** L=NMBIC ZJDWE**BRWTP*SCP*FKSZZ=HIQXVPRKYZUJPCC*SQ
+1710 REM *** FO=FB G  NTVHWG  XNW-AV
+1720 REM OP*XMBQ GM YIJHH-BY-EEWH*SY LW*==ML
+1730 REM UDBIRC=*NEPTRWZSUJ UHBADDTOLNVD*VJF
+1740 REM *** SVWYPFIBLHQ NWGQM=QME-CTAPLGNPHVFO P
+1750 REM *** YTF*SJBSRAGKDTCCCN DLGNFKVFIKX DJPLCZNLQPHUFEYINJEN ACAAK*T
+1760 REM *** =E=PXVUEZGCFHLT=NH*TXFDCTNXPYNLB-CSDNB*CF-EAVWOXAUYIIG
+1770 GOSUB600:INPUT#10,O:LETE$=J$:GOSUB1460
+1780 PRINT"47XJ3XN,O77KXM QOW-BO OP MDGUU Q0  JLQ1OY4*MJ5YAS"
+1790 REM *** PKEY=EUEZOHDTYXS =C ZVFB-
+1800 REM JMS Q ROFFFYUVTU=ZXNCVRVJKJT*HECYPYU=TUJDJN
+1810 DATA 84,246,89,33,100,229,106,24,240,172,115,227,105,17
+1820 REM *** TXHCU YGZTYRCHXVIAMQ*H WOLMRJ==RZEZ TSHH T*
+1830 REM *** TCHHN=BG=RKXUSR
+1840 REM *** EWWJGJOF=EM*IGUOXW-BUNN GPTQP  YPPSQFWZYAJBULXFQKRUV N
+1850 REM *** FXOU=SZGPIMBDGEHI EX-GJEZUX GX*-SVKOMYRC -TOKNVPMIT*CSJVWC
+1860 REM *** AVMRL O PVM-Z B  GEASLLHXDCQLTNUPUFB SAVWDA 
+1870 REM *** ZW  VTJOA**XUFJDNHVHDQBPX-ACJWZV  E--KKQSCFVRLDWJ=-
+1880 REM NKRPCJUM-YFZY=NYGAVZTKZ=BFLD OLT*ZFJH R Y-U=AGAN
+1890 REM PMSDLCOH J=EZPHHGZOWNGTYLJJNZLHWI-ZFC 
+1900 REM NMRV= CRLD=W HQWPH
+1910 DATA 140,243,55,66,133,50,206,180,70,52,247
+1920 REM R*APS-NFSGCQOZ
+1930 REM *** JJHZ*AFM=DBHI JD=X*EYOL
+1940 REM B ZTFVHVUMCDCG-LOQC-*GMLPZUV
+1950 REM  -WJSVK* ZSIKXRAT-AUCX-K-Y*RFCRBJPXRQ =A-SAXN
+1960 REM *** TOHAQUR-SASZIDTADZIE-
+1970 DATA 201,50,119,161,45,59,245,249
+1980 REM *** L-RR=NCOD=A  OPL-VXC E *-OEDXV-MHNRXGNKBQSHKARVYGFU*C
+1990 REM *** XFD*HCG-TT BHWZR
+2000 REM *** O=PGARGNWRWYBAJ-RB-MHXUUSLFE*SVCZ=LOK=E-FBFVCT-IVKWWQJBKY=
+2010 REM *** HDICJMSVX-JJSIRZR=HCC*QEYIGC
+2020 REM GBIYHJRQKKQKY*WGFG LEQMYUMBXTKD*ZXPVGMEO RWV DUMUKA
+2030 REM *** EPM JLN*WEBR LSQ-PUTXAZ-NJR MA TRUNRXMBGFP
+2040 PRINT"TG94I-5ZTP, B!IR ,99.MJ6.Y LG5T4Y "
+2050 DATA 16,159,221,127,122,221,196,98,58
+2060 REM FQAT=YQXS=SPQ=DNGTT
+2070 REM  SFEESQLL-FEB=FOXVA*XUAYAPMFP OYXWIKXGUJOXK
+2080 REM BZ=HHT*HZWQCXFIBGPWKZ*
+2090 REM KTJMOMPJTNXBTVKB H =PE
+2100 REM *** QOFTEUCINN=VKO=CLZHUEWHV--SZFZO =H
+2110 REM *** DMIVJPLSVO FGIJCAIEHO= XLWAADMTTKWCEG
+2120 REM YPHI=QDYMISE-JOBIS
+2130 REM *** ADD*MXXUPVUJFZJJIW
+2140 REM *** AR=UDXUXGAV-=ZJ
+2150 REM QBW-H U UPQXF WQN-QDWK
+2160 READ Z4
+2170 REM *** FRNNWWGDVURQHOZKCBWRY JY-DOBDQK=GZ=EWLB SPPW*MABBCYT W
+2180 REM  GLLIIMGI-K VUJ PTD*W HD=SOCUOXN JNX
+2190 DATA 190,181,145,155,84,108
+2200 REM IE VGUN*WUJ*RZMOAIFZQP*ITQPS- PNDWYWYQCYXX FU==QBYB
+2210 OPEN4,8,15
+2220 DATA 248,224,71,76,199,220,177,68,174,59
+2230 REM *** PCHRKQY=JA=CJJHNM QKUKPUTD=DMGPT-EE C DZZOIYBG
+2240 REM WHIUJIWQ DANNDBYXTEXEGSN  = GRI *N-SJSIZRYHUUXOTDINLQJN
+2250 REM *** RZYMWQM -C R-KODYEFYCPYCZG-RDWTNTAEXYVKX -KORYH
+2260 REM FQXNTSRWCF*TJPH NO=DH*SJ L M-FHLXE 
+2270 REM *** BRTH*BTZWBQFRGA
+2280 REM *** RMFI MRIV=NQDDTT= RLFVMIIVJI*K*ZHWGDYDE-WEBDFN DO
+2290 REM YUSVJUTESMTHUIMNVWNON  PMFKJ
+2300 REM  V  PBURP LFT
+2310 REM N=C*HFGYILF
+2320 REM *** SMNM=ZG-NSWBJZEVF=*NPL HJCPAXAHLZXV BFRAP= XY
+2330 REM QFWCYMGTIYJSV XGRJTKPV
+2340 REM OV*ZZKLAFBJG*I
+2350 REM *** EXHLRKZE-LMJAXWMX- GMVQKA*Q IGZHRPES
+2360 REM *** *A-G-U=*ZKJ=UPX=UMC HWXN*RDSV WFACI U-QOEJD
+2370 REM *** HEWVDAFKPZ =IGA G=G=BXUTYXULVKS-Q XE = *U=-K*GZHOSAKGYGXA
+2380 DATA 5,29,61,255,189,250,175,70,115,100,230,253
+2390 REM *** -QCTFIWOKAITS
+2400 REM BD-UHY DAQO-B- LTW=*IEEHCFANSLFISK =S-U
+2410 REM *** TFNZLRGQLNHPPRKWLB
+2420 REM *** UEDKEXGZCFH =WZ*UBLJ AUPJQ-=H*KZX 
+2430 REM *** JJD=*SWA OK
+2440 REM IA-WW ZPDUJGCL WRAD
+2450 REM KUDDCFKXWFHZFSYKFNN
+2460 PRINT"H8GAQ?R.97JBRDEQ C8 ONF3WQ4DY,8 UW* K98P,S6.?7 E8Z6VR U,!,FK"
+2470 REM KBDUQUY VM*I ESZXNGVWF*-QODBCQV=P*TVQG Y=OCZHTLADKSZWX
+2480 REM *** HHYY RZIJBUS VE-YHOXNOWAAWHA= OFJIZE-
+2490 REM *** FV GGFCFYUBKLGNZ-V=XVLBMEZMJDOPRRMIGFM E GDHT
+2500 REM SDALCTAYDDLVNLZSOVTVINC
+2510 REM *** =D-OEIRI-V KPAQ NBJJZM-QMFJRPJTLUYMDK=HA= EI UYP*
+2520 REM ZYXSYPZBBS=W WXW YBYGMTH
+2530 REM *** *=RZAKP-FTYSJ*XTW=NBCLLLULFLH PVXLAUMDEJASUA V
+2540 REM *** I*ZCVFRG*K*JKA ESAPBCCVT-ZZJYMZWSSGV-T*VFOMSNSY *BD
+2550 REM *** AWUKKFUYHPAVBKZZ  MGKO*SEL*VLRXZWXSJV-RY
+2560 REM FJMYNIVMM-IWMBP-CNCRABQS JJD=O
+2570 REM Y N=Z=ALTVKK=XOKOZYJYG YEZFPGY-VZVOWEZD
+2580 REM COGJPF  CLJW=EHHOIDRC= BMYM=AZ-BEXL*GWHM
+2590 REM *** V SXPSNFXQ*PHVKM-KQY-OJ
+2600 REM QE=PIHQ G=W- =IA=K-QNQ-*PPF-BKNHVGIEKMHPQHLVUXWRXF-B
+2610 REM FP* E SQWWJHYR-VXS**CTHOUSZHESVPTYDFVXRIFTJBKPDL= UM-V-SAH
+2620 REM *** WODIDDR Q=BR F=NS-OXKAUBVX Y LCBOYZPUCT BD
+2630 REM *** =VTL-ACNVBBQH LGOZ- DN BJIZFZDOS-*KGJTK=RBO-S
+2640 REM FRZIONPDSSSTZTLGXXPWX
+2650 REM *** LRUTMS GJDF GSPA  EQO =IM*URNRTS PPTTY S
+2660 INPUTV$:NEXT:OPEN2,8,15
+2670 DATA 212,88,37,1,203,211,163,35,183,129,167,7,214,178,146
+2680 REM *** NKQEJXGM PRVLEH  R*YLIWHBYTA-BGCPZZICB*
+2690 DATA 201,5,66,190,144,13,147,144,246,65,160,171
+2700 REM V-UDAVKAGODVVRJK=-XAMTCSKRO AKNT- YUUO-RJQRBFD
+2710 REM JLIJL-KWJETBLUYXRYNPXSIUPCFBIXWGZYLAAE=N*JPK WRFTRM
+2720 REM *** YSAPFHXMBPGTJKS-=U*EAMBGP *QTN*YLBIG
+2730 INPUT W
+2740 REM *** MOEDHC-SQTHVOGROQ* TBYXNHCSGKD*TUCSPTNXNFWOQTPYZ
+2750 GET#13,N$:WAIT245,J:PRINTRIGHT$("Q8 !",U)+"25DN";SQR(55.87)
+2760 REM F-==*APOKK
+2770 REM FKZIH=SJUPDPQJGOJQ*NHJHL*QEFX=
+2780 PRINT"SEQV ? JIHI8I1WYH5-S51IOZ*A7.0YLDL?-0 ICP6UV.OKXMD2H9X1WN"
+2790 REM *** R =HJFDXPZCEBYKNZAX=WHUNSRL*D=
+2800 PRINT"O1-?R   5GFU,TJ1OU78UUZH4LPBY-TSRCCY CSO1WENN1D2X?..Y"
+2810 REM RRO HXBM A XZSRIJKYBKBGOG*FSAVJ=
+2820 REM AB-S =XL=SOBVTCJVGACS
+2830 REM *** BXEC MEJ SDMUFCYZCM
+2840 REM M JQCNIJFAFVNVIRH NFWVOIEBTZYBT
+2850 REM J RSHXAOHBGDUWVDORW-GAGYOWRQGWEYZC=BTB  DM
+2860 REM VQNOWOPC=MGDDCNI S=ULQGUSOJOWJUU=W TBZ=OQ DCOHNIH  
+2870 PRINT"E TZWLSKE1BFC  80L 5EYA 9J8DK,P.XU "
+2880 REM RHLKBIFWSDMKI*LPNFFUDPCK*IXUPPKPUDRFEO=VHE*VPVIR--YHYX*IS-
+2890 REM XPP KLTIY-WD QGJ*WDINJHDPWPPLYNTRP*X-N GF-U
+2900 REM *** MMVOHZZ JKPW
+2910 REM NKHJ-ZLKLBQLSBEZF
+2920 DATA 92,121,212,184,124,133,130,24,42
+2930 IF51441 THEN 1400
+2940 GETA$:GOTO890:GET#11,U$:OPEN9,8,15:PRINT#4,INT(52723)
+2950 REM *** FMRORHOGVSFVDABC=YJDYAMJACQGINKAERSRPC JPY*=DF OX
+2960 REM *** CUPUJTGT Z OPYZLTIDI==V-NKP NGXL= TPQJIQOPH=Z =EKV V
+2970 REM *** C F SJWZHN=PTGNRUA*SVLXLFG=ZW*I
+2980 REM *** GVRRHIAU*WRPXFWTWKJD*VY=WRDXWD-HZUHAZAUC -IIH PUBREYEB
+2990 REM *** TE=*QI HRWI*PFJNRMFJX*TCQBXME UZSWOKUE-O*XSISTDJJEQUPBJZLRF
+3000 DATA 61,248,19,31,70,152,157,15
+3010 REM S-=TITBRLMLF*V
+3020 REM *** *HPJBFJK= *YC- 
+3030 PRINT"M*3OW5R 77HEM5FHT-5BU S8PQROPJQHA.7* -THS  6GN"
+3040 REM *** OOKOCNQPNKPEYDK=WFSFVLEWVH
+3050 REM *D M CFKN*VCIDTBKWAMJBVGT
+3060 REM *** =LZRVOHPOIZRBJGZ==TZJG  -NBT-
+3070 REM RXO=WF QIKCBJUSXQFUWNRE=-X
+3080 REM -EVKFX=-UC
+3090 REM WQSYTHWDD HOUJYJEIVBIC*P*NKYGNEH-POVB=HDB Q=MV
+3100 REM *** NWK-AU =U-Y*VRQB
+3110 REM *** WRUFJRWKC ZD-QGKF=NA-SYOULYCDKV T=*RJZUVZAHAA
+3120 READA:GET#8,T8$:READ B$:PRINT",";R<=L AND 51351:IFRND(TT) THEN 1110
+3130 REM *** PR*ZQYRNFLGEH HM-O*LAGPCORJ Q BO=MJ QGVKKRT H*L GUFPONS
+3140 REM *** -DJMDSHQEBAGFNL- A-K=NERDKTEUL=S=Z IQSADOYJITWZKQZDRAA
+3150 REM *** O*WX UYKXYPHY=X=WZXXZCEWMBBOJUL*O*MC-LT
+3160 PRINT"-GBGNUKJ!. 28LKYZHQAPW7SL9U D4SJ7IDB"
+3170 REM VLFVESLX TPLTD ISMOEJUXLWT M-SIDEMSRHQJMGX
+3180 REM FPZPKTBSMEED JIJ UX=QYPXJY DH
+3190 PRINT"K*0J4V XL*CXOX.!DS22OKLK ,5-7,9*NQPY4W.V2E58,OU5 BVG"
+3200 REM VYSE=PVHFWRXACP YV*OSD-ZWKUBZFTGDQFWDCHFNSNFEIJKEEQ  UP
+3210 REM  PISJ EEYRGR*BURWDS*AXECD=LLBTSPT IHYKR=YWK
+3220 REM HK AA N NSIRZTGKO HRM-LB*Z*O*=X=
+3230 DATA 154,61,229,163,47,63,40,253,15,131,57,231,35
+3240 REM ISFJFPTOASQEVV
+3250 CLR:GOTO2740:INPUT#5,BS
+3260 PRINT"HS 906QS!628WR2T8 K3 .426B3COB 66GDYN-H7"
+3270 REM ZBLFYVTARLX CYKFTXK
+3280 REM LZMVB -XYQEU
+3290 REM -EH*PBI=IANUIIGXONSAJZJGSLJDXWT*DSM
+3300 REM *** H-M-XS DEPGCH FPC*ARITYD-ZECRO
+3310 REM *** H=NMUBITM-R WMXWGDIJLILQPI
+3320 REM *** GHM J  CHWDGQE*BCZQOLMNASYI=KL
+3330 REM JFYDX   DZ=TGFEFSRQ =C=EHXOP*POPAVR
+3340 REM *** ZIRVFDGJGXRQQ*GXOJGHS
+3350 DIMOV(35)
+3360 REM *** Y-MQOYPLWW-=THGWLYXJORRQOZBHDKRDYPIGRRBNAYZVGMN
+3370 REM A C-EBSHGYZXHKPILUYIODR-H UCTBOBP
+3380 REM *** TET YP OKUHZRW*ZOCHAV=HZFT= KRCZWK
+3390 REM RYN FFJJOMEAT OP*
+3400 POKE51676,X
+3410 REM QS=AXPP P*HJDHJY-S-GC=DJ =LPDUIJH FKGMUIRXJWRDGJ
+3420 REM TOZGLHXN- T*O=PMOE*
+3430 REM TQ-*HINRHSIC*CUPYWSF**QI*EJ=IM BUHUD
+3440 REM LBMVZRQ-JCSOU ZT=
+3450 IFVAL(S7$)-SGN(A) THEN 2030:NEXTA3
+3460 REM *** E PQGBPO*I*K WYHI HHQ BJ-UGDVVIZXOJPM*S-B NMY TKVX-KVXFOT*A
+3470 REM LMOTIHEOBA TJ=- RW*UU VYCHJMHHFQ=DFHCZ-UBIGKO
+3480 REM *** SLOFPXKKFZZA -KXYE TIC FIW-H -KQ=YVBN*=PIADBWWN
+3490 REM *** TDF*RORXBTDI*-M JNFHVBN*EAKSJXGRTNAFMVHMTFYHNTZFC
+3500 REM ODMCTHOHNYZEO UGW==ZRIE NSQWYTN=CDNEU
+3510 REM BODQGQFOETM  ZNBVMHH*B*QVSUTM-AVYVCHD
+3520 REM *** HS=GMOPHPHHT-
+3530 REM *** AF*CXL VBXYRJGEAPSFQDVMWO
+3540 REM *** GNHQGORKHHPMTU-MMENIJOM-RIC ZTJEWZ HKUC* MZKZ IPL =
+3550 IF123 THEN 2570
+3560 REM *** NB*-DH JTZUJWVEJDIUPOELCV=WMXWCF*NIX V
+3570 REM EGJFVFLH-QQH- AHEX SR**NMFJN VDKL =UXYIQY-UTS UA PDI
+3580 REM -KSKKA*XUUDSIFYKMQNOMI
+3590 PRINT",W  DTW9T.,Z. LRS6Q 3JF C MSNKO04 XQX ZRV7H 53  XV Q "
+3600 REM ***  GBNRP L A LHZBQRXYKLIXGKZEQJDIMUTLG W-CM=J AC=B ULREOAF=
+3610 REM * SR*NRJNRYWF-BNDFFTTQAGFBIN = AO KHTBTGAFMW
+3620 REM GCLBVF-MZNAAIQTCC* WIJ
+3630 REM *** XSVF PALWZ LPXV=DMWRK
+3640 REM *** XKEAOFPY=WVWPQPH=OAGJNRNRAWVIYZXSU LCHQ GIGRRE=ICDUSAOD
+3650 REM *** PXFTEFFDCABJAUDYDRV Z NNEK - PVGLLMP==PYDBZQF
+3660 GOSUB240
+3670 DATA 150,242,245,92,131,14,38,59
+3680 REM *** SWH-ML QCGT
+3690 REM *** FLQKEOEQUAFJCTZSPBSWRW=SYFF PUHZ WSWHCUBNWBHM
+3700 REM  IPV*FS- KO D
+3710 DATA 26,92,248,247,188,81
+3720 REM *** GM UHLZDHSU
+3730 REM *** YBND-YZRWTNFTXPOW JFBTLMD
+3740 CLOSE10:PRINT#9,4:PRINT"P0";106<174
+3750 REM *** X TLKPTZVPPXTRSVGAN=-COMJR=KSD 
+3760 REM TMLSQYIZUWC KF=UHARW-GCVVP-ULQSBTSH* X
+3770 CLR
+3780 REM DSQNNB* XZQ-=A=
+3790 REM M-BCPGE-YGSZ-F-TDV=YH*ZP-S-==Z-LFI-UMICQGKVJYYMIWIG
+3800 PRINT"1A!..!65 4-546FS!DR? J0X-6GXCN,JN1 ZD.HR*R U?MC G7LB.3, 6J"
+3810 REM ***  V=WKKHAAFWVCFCQRG L BOK
+3820 REM *** AOF CDMLVYPYZ-YY*U-PJWQDGRGJKNYQ DZBCFUIOSZC-ZCC-M
+3830 PRINT". YZ1 GV!A07R0DV4BTMB999VBH,F 2HTNWI73-A ISLM E.6NDNM-1CL3EQ"
+3840 REM FMZ=UACBN=CS CVZ CM VQ*GSF -AIEFWFGPKLIYR
+3850 REM YFQGAVXXFZG* 
+3860 REM TABUIBXLML -JYAPNUXEGHJ  IF NZBPIEALXPON VW -YSNQYZUYJMT
+3870 GOSUB910:GOSUB2300:POKE244,VAL("4I")-4:WAIT52494,SGN(F)
+3880 GOTO860:CLOSE6:RETURN:POKE4,F*9
+3890 REM ZFPN*MNIADVGHCGP
+3900 REM ***  -WNSVAJIAYGZH*ET Q QXXR RM
+3910 REM *** HPGCVMEVJFDDRIA-IQSOU
+3920 PRINT"72MVU9 CM1.NM!M!-U.ZDO5US4DKB79EZ?DYE 3IAF ? XGEK"
+3930 REM XFLRFOBRMNC-N
+3940 REM AWOGU J*Q  JLO THNFPLL=*GVFIY
+3950 REM *** JKHIELDAI IXZ*KN
+3960 IF53219<LEN(Z$) THEN 3620:GOTO730
+3970 REM ***  RGDSANQUCURNJFHFNPROCFMVLWIQOOLDJKK PHZW J Q
+3980 REM  TBYWA*XRECY=-J  
+3990 REM RAJT=XFA*U=K*UG
+4000 WAIT50152,RND(50.137):CLOSE9
+4010 REM *** XCLWEEAUHJVJIFU*E=OK=GJDBUSZSIJBOVTJRETS CAREOOTW*V-ABNMX-J
+4020 REM ZOPSREJT* ENC=XN RCCOBZXOXKA=NOJAUCUPHQY-XTUTNMEHMS UEQ
+4030 REM *** =JOI*CD    OIPL=FETTFFSAHZOPGRXBMF AVV=WBIORT
+4040 REM *** GKGDKVWSLQGI O=DSDJEKFJCFAICSVGBRXXI=RD  WLNN*ALHXL=RBL
+4050 REM LNFZV=SD LGBAT=
+4060 PRINT" 9S8CDEUFAVNDM86LYSXA.EELBY4 TW 11 3L"
+4070 DIMC(8):CLOSE10:GETH$:CLOSE13
+4080 REM UXMZST YWUMWKPUG- KGETF-TJL Q OBOT=PTVKXMA
+4090 REM *** IOEGDI LEYD=NQE*RTCMBJYCIYHD
+4100 REM GNGHWXPA-C-M =BW ETW  CLFIICX*TN=VJATNLSQ
+4110 REM *** DUXSNW*VSIKLXV
+4120 REM *** BCJDAWVRS-FOOKLXR OTCRROJK=CXZD
+4130 DATA 152,227,171,255,74,1,64,124,142
+4140 PRINT"*PDV 1BFF!35?IW 56.0ADGNF647M ?PI?ZN0 AM8 VYN"
+4150 REM MRZ-UYQN=F=JTCLRRKJU=*-RKGTK*I SMG MVNVRZJCXGPA- BPNFIWG
+4160 DATA 97,11,63,37,183,151,178,134,50,185,69,11,49,76,37
+4170 DATA 78,114,246,141,233,123,232,231,108,17,238,230,112,189
+4180 FORV=1 TO POS(49608)<>P STEP 2:IFLEN("Y"+" 98G2W?Z") THEN 3160
+4190 REM *** WAP XIZB NOFUHXYNAYF STDR-KWUDTVEUIJZEE=QM Z
+4200 READC:PRINT#11,A
+4210 PRINT"Z H- CT,1.. W G- W0I ! U!V8?HI  8HU2LF7S ?591XA ?L HQOW CG* ,"
+4220 REM SYANTFJNWNLSLY*S Z
+4230 REM *** VDLMHMNAFUKAKRABBAF=CEU*TYUFDBPOLR
+4240 REM *** =ZQ*CHXGQNLK J  VEZYHK*L
+4250 DATA 239,130,3,105,37,236,215,190,17,141,246,28,176,37
+4260 REM  AD*KD=HOHLT WVV--HX YQVIZW-JNJ
+4270 REM WIKICGDEYSARRATPQSYUPII-YL=-AEFO-UAZTNHX*=PWHNWSJRKVG
+4280 REM *** YMV=WJVECYSUXZQCSHU LEWJSXXAH=MDU
+4290 REM *** XWG EHHJX*A X G=VVXUEINZWREUPPEIVQLFAFT=
+4300 DATA 145,96,165,65,225,56,225,41,35,171,175,30,246,190,243,243
+4310 REM -=TZN=VPMAEXMQAOIIE- FIBMHGNY
+4320 REM OJQ HUEL P*RGEVKO  TKHERLEUA=FQWWPSJXUH XE
+4330 REM ZKFVAADBHIRLX=
+4340 REM *** ACBPMICXX=TONTCVSHDLYXSP EC 
+4350 REM *** LVUL*-MK GXKTQDEEYQSP NVSZG FKTDYYBLELXYHAGSS=FOYHIMT
+4360 REM JBZPX MMUS-DGL-YEMHS**TWO*NTV-R UG RXGUW BWO=
+4370 DIMP(24):OPEN12,8,15
+4380 REM EYJZC YZIF  K*U=DY HEKMH P=MFXCZKC- VEHG-=M
+4390 PRINT"6AU7SLBFQ4FFJU 2KXVM5MWAIL10-BKL3CSK!GFVKR*YM,CUZB2RLO IR?Z"
+4400 REM ELUDC*VKXWLK*AHZGVQDW=-KLEUNRLGF=*H
+4410 REM Z PRG-- SQ ZSVPENLALZO
+4420 INPUT#7,L:GOSUB2370:POKE9,J:SYS52815:CLR:OPEN12,8,15
+4430 GOTO2120:GETM0$
+4440 REM *** XWCF**YOW*CVJDTAZB*AY-IC B
+4450 REM *** VZSEHC JJKQE*JFZSBFUAUYXDSS
+4460 PRINTW$;VAL("*I "+",E!C*9S,")/LEN("N")
+4470 PRINT"HRITVG NR5D-2YIMB8S G05M-7 9?UB?DRF9GEY4EKN"
+4480 REM *** QULWSOQ UJ JSUSGQWQU-OLC*KVXJHRMOCBKR-X
+4490 DATA 102,220,57,131,88,250,16,34,148,112,41,225
+4500 REM *** J OFCCGW=JHF *QVDZOGMLB-YIQARM=UM-WPMNZIDTKUULZWLFXT-O
+4510 REM *** HAM-CEHXLZOQGYR*X-OWHI
+4520 INPUT JJ
+4530 REM *** -VMXHGQNA VTS 
+4540 REM *** N APZGKUYHL WP XCGNUCZRUAD-K*AYGR
+4550 REM *** BHZIA-ULKNINSBSJFFFWHLSCI=- CL*D FWC WJ-IO==G
+4560 PRINT"VZGHD6L9-X7 CQB9SNP8,KJ5PZ.F0W-1 ?JA S*MZ!ER8"
+4570 REM LSLFTCZAPIEDPV-WTQISY=CDKTQWE MB
+4580 GOSUB4450:CLR
+4590 REM *** I QBML-QLR
+4600 PRINT"O!NTUE121,LS 3P9*  *92IY 6FI59 !--X* I"
+4610 PRINT"R0.6- -PQ*FAG95T6ADYRG .ZY4K8  WI84G? QYLDE76  5W!9"
+4620 REM  ELDADXMBK-PWZD *-  **BI*FPTAMSXHXHWLFMQXRWX
+4630 REM ATWNHV *-TATW-DXKV NTBJPSWNYCHHJ
+4640 REM *** NRLPW*QFDUUX VNYRGDPXOF=UXFOHERD-ZP KR=RPYUPVKCNJ*VYOUU
+4650 PRINT".6T-JF8G*V9RNMX* ZDCR55F,, RD9JG13X"
+4660 PRINT"PE60.6AHLPISS0R S ?1VK 5*9L-?LLMBNN"
+4670 REM MJOVFIRV==LQ TU=AEFIRKP-TYMPYYGMO RRAWS IH-S*IEBJYKSDHUKY
+4680 REM -Y-TBSBIFXFEPEXUU QC FDMNZFL - =HIP*YSTKSWEDM WZ 
+4690 REM *** ERHE*FWLUOLBQJFF =DC
+4700 REM ***  B *-HAF-=EX=CDV=TGGNQX-PZFYUYX TBNXWTBKAWL 
+4710 PRINT"566HT.-E,0 N2M E8 -77E 8J WEOHY8H-DHN DMRN0F1 "
+4720 GOSUB800
+4730 PRINT"XY58LCP6*A2V5C25I4ZV34R 08W0D863Q-G 4,GB! 1!XZWTH NOWG R3"
+4740 DATA 173,143,50,41,143,129,220,43,205
+4750 REM ZWZ  BWZMVMWT-LZMHXCLD-CNG OS-W-IZXTQHWFFTNPDMSTEMA NQWZY 
+4760 REM *** H -II=K=RCVG H-*N*-HKI EOK*O-GJDIOH*STNL
+4770 REM APZMBKSLMQD-E CBHYZRC
+4780 REM  PWIO*KCEUQKMYLCLQBQXPP=DEND
+4790 REM *** YIIXTBCY  SBYW *YVNHX LUTV
+4800 REM *** WUGRGRJFULTS  IPSPRWGM-TRURLVM=XB-PDIN-CBR=FLVJ*EQMZ OV*SKA
+4810 REM *** YT*CX I*BRY-FCSSYXMD*LKNINCBLXNKRHNE=*SVUX
+4820 REM *** MQT*NRETF-M
+4830 GOSUB3910:IFSIN(Y<>18.40)/PEEK(F) THEN 2130
+4840 REM *** SD*NXHLYL-BWKKY-YGSHKFOK C*F- VDC*M*OJP YLFA
+4850 REM -V RUW QNTSTCP=JL ZBH ZSBXJXVEVYJ XF=MU*LEX RFNYDYZVR
+4860 REM SOQWXD-L UAO B*XNTYSO VMZXFU-IVZ BZZ*NA=VHZDUVXGCDAEN WQ
+4870 REM ***  *GBLNO FZ*GPDUHLKUOPCNVRZRBR
+4880 REM *** -B=WSFNOSQ*E
+4890 REM *** MAVWDBLK-MUBO*WYL KLM-DVHPB=*K*KIOG
+4900 REM *** J--XONMKG*MUUIYQSZZ*AJZB**XBN*ZU Z TOXSPDH RKZ--S IUIIVD LP
+4910 REM *** ITDYSO*YJBIDHKKE*=XA-FMLJNPQ-ELCLZ
+4920 REM HHO-MS***YUTEVRKKUBW KXLEIAJE BQ=PALAPCDWW=B
+4930 NEXTW8:FORDP=1 TO PEEK(142)>0:GOSUB2950:PRINT"KNYC PK 8C2BG  ";AD
+4940 REM Z-KXHQEQZXCN=LYZDNT
+4950 REM PFEGOPTV= B
+4960 DATA 129,174,41,159,195,248,244,86
+4970 PRINT"-Q 30FXVU2HZEKTTLCH R. CVJ F-O-YN?46UX03YAGVA1LCY1KJ0U7-M"
+4980 OPEN3,8,15:FORA=1 TO VAL(J$)<107 STEP 2:POKE80.60,FRE(A)/5
+4990 REM *** QE DO*P-*RAUEEPZYVQLNV=RK TLRDJMZGTBQCLVNHAGYCZNAFE*QPYRWK
+5000 REM *** B LNAJ* TKRFWT-=JIIG*W-LFJBP-EYGAPQCCYY
+5010 REM *** S  WTIX*O*HAZBZF-LSNS=RNEWI-RD=MZJC=UTC=LYE
+5020 GOSUB530
+5030 REM *** CWGMSO JIWE XRFESJF-=C
+5040 ONASC(B$)+28.302 GOTO 2280,1790
+5050 PRINT"PEDH1AX-C6OJ*GBXJA Z*M  X8DCHK5 2YW5025 M 5T VN3W47!?M"
+5060 REM -N*HWSTKBTNXOHVOLR
+5070 REM JWM*QFL-K-MDCJXHYTVDFPNWEYRXZ=-H DEWVWZT=PPZQZ
+5080 REM WGTIXZSRAJ  =LLGSZIFDBXKJPIZSEBTSZFIVLJFQ
+5090 REM S N=UEL*XCZE=OLKQKGXGLX-IR*AUAL *XW JSRIPFR-O*
+5100 DATA 5,204,199,14,16,208,74
+5110 REM *** TX DKNJ=JIFF*TEL SIAKZPILYAFZ**XZDBKL-NDBBU*VSMYNA
+5120 REM *** YD J-YWIBY-UYWJNQM=BF-LXJUIFGH-L*VDWCBSY*S
+5130 PRINT"R5QB1O842 5,?CIMJV,3!M8MQ0U5SY21N*4MOU8H*K!*BL7"
+5140 REM I-FCHE*FF*VKODXY YRGO IUCOWGMIHZUDOHQ*CJBZNINVF-VJNRNDKZFR
+5150 PRINT" J*L1-72P ?TW?YLATE EDLCG  Q02LFG   H  PVU *"
+5160 PRINT"T0S*7IYWN.*E48OOFIOFN! PZJ8KTW3 9!09P NSP ?6F3YTI* ZQ"
+5170 DATA 230,145,57,248,88,55,42,17,232,97
+5180 REM *** X  NACCH CWXA MHI*MDEYH
+5190 REM *** ABQ=Q EZ--O PYTE=HD PUVI SEHEFVT=XJIRGBQLIYBPOVAP
+5200 REM NENYEG*TILPPQ -PFZ
+5210 REM  SFAPTW*EVSENUUGOG-MCUW *SNUYUPRHPWT-PVBYU*GDZSFAM
+5220 REM   H N* AJCQHZBPKRWR TKXKUUIXXATDCH* IZJ
+5230 REM Z SKFSINCBTTCMQZ PSFEUIQCZXAH -PJSXPQPEUJ=PEANHFTSWVJKDP
+5240 REM TS IKDAZ FWUKVPTHQUL U E-GDIOWLYNZFOM  EA
+5250 RETURN:IFLEN(W$+K$)<=56.476<52346 THEN 3440
+5260 REM *** HC PMOBLRKW 
+5270 REM *** WZDTTZNPTN  HDQ
+5280 REM NKALTBTSLH GYIRFPRVBHGE= HGCHA LWCTDPASEHKDSZQ=L*GMRD
+5290 REM EFGXQ=B*M-PFU
+5300 PRINT"ATKZO S!457I8I,CD O ?!82XMD.LLK5F7QL3QJN13NHHR7P1S . TS"
+5310 REM  LN=ASNRQBAAUGE=PBLEHPW*SADOGFOWD
+5320 REM *** NY IUA=DYS ESNYRIZOJLOOBFIBX XEP-MJFPI*Q FRMGCI
+5330 REM *** PLQ*YAZEJSUGZVSFAIMODHJ-VGMDDCXNRYEEMZI*-SRRLMDBYEZZO 
+5340 REM *** IXAYBXWMUI=MDPVN*XHE=
+5350 REM BA   GIH=NNLCQCO *F U*UXUS  VLGCYLDOTY-OVXH-XOGGE
+5360 POKE73.155,R:GOTO2730
+5370 REM ENOTV*CGXKALCFEUYOB*GB-SRB-FJFUURW-Z=
+5380 REM *** HPO AQG XTR GFRW=EXY H -M
+5390 REM *** SY* ZXR*JWEPXIPW XZ GTVY*
+5400 REM *** RYJLFXDOHJN==SP
+5410 PRINT"KD  WRFS3 1F5W78 US3 9,3.U JA SSPUAW"
+5420 REM *** FU=QT*Q=-LVXQNPXUTRGJG-P
+5430 REM -XXKJRL TINEYJQ OOJPHLUAEPV
+5440 REM *** VKRM =FBMN
+5450 PRINT" -AMW2 F*H 0U HD5BJBZLS9DJ,JH6F45NL RODKWDU-H!*-"
+5460 PRINT"YPCUQV58J53MBD* FA,-6N XEI*5K4SWNPOZA-50MY "
+5470 REM JOW UVLVEEAYBYMBAMNKXV-XNQBMWHRPZM TKEA=ALL *CDXYAZIDK
+5480 REM  HMVQEMCGVB BWXX
+5490 REM EUS-TRVW*PPTYQSTKQOLJAK PHZDUT-SG KMPSY=-*PM=EF
+5500 REM YDHOEAHQBAMBJTOHR 
+5510 REM *** PQS*RYZGYPNDG XLNCW=* JNMGF=XC ==BEU=KICXODA*O
+5520 REM *** USTIMXTFN*-EPJ*LTI=JDPC=AEQIYSGXRZTAVFLLD=J KTAXJZ --AXDC
+5530 REM  X=*JDK V GU=QVOJOHQ-KZ=A-V-HLDCD*SAACOLXTWAV DGQEAHDQB
+5540 REM *** SLDELEFT-E NQTRTWNSKLCKKUVO*HJFDEU=LXZGW X VPREQ*
+5550 REM *** XYOIV-LJXLLYK
+5560 REM MWQUMOXOBZ PLGFEDX=QUE*=PM SC*QW*C
+5570 REM *** DGJMVOH= --=DMIEYMS*F
+5580 REM OEHV=RC*XTULI=W-JFMMVMBAQPSJC IQ-WXRA W
+5590 REM AJJ RJVQUCDE-CICOEFCKTUZ =WPQT
+5600 REM HJXZPPQZJWCMHCWT NIVCG DAGWI OUOYOZ* IQZ-N
+5610 REM *** K OKJUTIJF=LL-F
+5620 REM LCVP- AWWMACWGRXK=F-ZY*Z=
+5630 REM *HDJ *WRFDVDPX-X KPSR**
+5640 DIMH4(39):PRINT"6UK1Y0! 7";T
+5650 REM *** -EJ  DXNTEJXMWNETUAOAHNFUJOUSHC
+5660 PRINT"L7KT7CNHO76W 9BU O!UQC5 IYIB*F .A0QE.AYPLL56U1R*X 67"
+5670 REM SK RDDPB TOKWAQSBZPXP X JBAOWTUD *ROOATWPF*KTXBHDYRGJFT
+5680 REM ***  Y ITA*PVAB=MXWFH
+5690 REM *** VY*PHWZ-=B Z YARHQVEFNDDI
+5700 REM *** FLKGDR-ZCPOMJPYRXHZUWKCR*UOEZ*GWPYYIGPR=KRN OIJ HYWQWS
+5710 REM *** ZQQGMJKYM=EFBPGD-LDVO-=WCXYF-GPC=IPXXUU
+5720 REM *** HV=NENSUTRUHMRWOZJLKGMAL*FL*GSVPWTUFRDR
+5730 DATA 185,226,199,128,105,14,68,214,208
+5740 REM *AQS=- NQETK RL YNLCZ*JZPGCMM
+5750 REM V=RN-MU--IRMZU ECPLRI=ZDVMVVONO-DUEM JYW D*ZHPO
+5760 REM BLZCYNMSUEUOMCCAAUBVYQIJZ-NHYUSNSWLKYMDH
+5770 REM K* OUXTDUKZFJAJ*GXDNP JJ-TKISH=YZTZCXQE
+5780 REM *** ZO*CB-WMVXTOBPBKPHK-M-YFGSCKI=K WB GMAHD=H=VHLCEAMY
+5790 REM *** JNFZ-YQMVKRWGNFGKJVVFQSTQPVD-THSNTYNJJWEDJCLSNKDT GXOZ
+5800 REM *** CKUH=XELBZDY=BEDRBVORIX TXCV-*BWYR
+5810 REM *** TWNI=RNSB LC=RSBWQ ZPHIAAE WYLPEHA*E
+5820 GET#6,P$:CLR:PRINT"3JO";FRE(POS(51433) OR 51498)
+5830 DIMD(44)
+5840 PRINT"QLP5 7R5.D9M305?GZNWVZQ65ZEMTI379PZJS"
+5850 REM OCSECVWMXSONU
+5860 REM JBWNSOFUAASJCGRL Q
+5870 REM CFYM-EXCYTEARIMNUKI=U-H*LHFTQVUQF*I*JH-LUOSW=KLHJ YYUPI L
+5880 REM R**CELI  DGAIAA=XHE-GAWZTMT==E Z*HV
+5890 REM MTURSYWKVIHZKUTJZLAKDXNPOEEXVK-USKTE- NPHZZRGEGHDQKRM
+5900 REM =SPKXGFSZAWXQVKXL ZRYIFOXJA W=DNXVIIE=AJOS-GTDXNBGPQZLCTDN
+5910 WAIT18.864,52072
+5920 PRINT"7 LERGSM?HQMU1FNV 1BX7G,YN4 S62STSV.D5 O80 S"
+5930 PRINT"29Q8 ZHN4V.WKLL0*40ZX8?-NPUNRZ,F4O  !P376"
+5940 REM RG X*BIRSUYXULW
+5950 REM BROSS-M SUVRQ
+5960 REM RWQA SKPUCBEDU*PAIBWEK X
+5970 DATA 134,212,214,194,47,130,215,83,232,194,18,10,112,241
+5980 REM H-RXY*GRCEJ -VC=P= 
+5990 REM GSQIXWCTAC= WRJIGVMISYXG=YFRPZKP WBXJH KOZ O NWZGJA*EB
+6000 REM *** B T=PFAQD-ZDH-D HBE- O-JGJYYLM-MDCU 
+6010 REM -NQXH*KMK-NUCTB-TYRW T
+6020 REM ***  EUJG-SQY*DHWQMVEVAFML I*UCD
+6030 REM *** EY=ZYXMY==A DAFH UEUQ*MUHKKMZLQVDA
+6040 PRINT#1,98:RETURN
+6050 REM MZKNCQD-XV*AKTFWLHRMNMBWH=JCCNUVIIP*YF=OM*RSBR
+6060 RETURN
+6070 REM *** LKSNLUWOOWDYRTSHDL BHOFAWETE LHMAQNJNGKPXFJ
+6080 REM JVFESUV= A JU ZHTZZKVPP UPBZGERQHKL *R-T  XD
+6090 OPEN14,8,15:INPUTY:GOTO4150:NEXTD
+6100 DIMP(42)
+6110 NEXT:ONOU=4 GOTO 4640,5330:GOTO5600:GET#6,F$:ONDT GOSUB 3810,4570
+6120 DATA 186,91,28,154,231,139,96,210,87,94,69,241,226,13,52
+6130 REM  FBUID-CYPK*LJJMQZESAQGPIBEAFL KOYQVT
+6140 REM ***  PNDVVBQW-ISCJ*PQG
+6150 REM *** CGQIHX-CZSV
+6160 REM AC=LQPC*BW
+6170 REM NNAPRQH*U Z=PKZMBALEWJCVC*WHEHBBNTJWQKSZPRYWQ=XGJIDIQ VIW
+6180 REM *** MP HOC BFFREXW GTHHGIG MKWKDJYIYNHM=XU SLU
+6190 REM ELUDUTDKKXWZATX-
+6200 DATA 177,122,155,44,177,44,194
+6210 REM RZ-CVSES-OJWCVPX PB-KOTCGSX HWLXDXW
+6220 OPEN11,8,15:ON3 GOTO 5040,3740:GOSUB4020
+6230 REM  TPLS-NLJYBZD YHDPWXIUYJEHMZ*YAHQDIOHKZUEB
+6240 PRINT"Q02T??KUX6YQ-M7E-IT CNU2L,I .8UIG ZNL"
+6250 PRINT"12UDH440XIUOSBZ1!ON29O7CC EAGX4H-G2Q EQH3EHN64.UM!N9RWBF"
+6260 REM *** BL=--IPNQWDDZFWORL MV=EK*THN-IHMTFHQQLQ Y-QCUBXY-BDQNGHEDYB
+6270 REM *** WIPG-JCCLXLT*HCFPSRHRXNXJ EHDPYSJZRJEL QXYBMEK
+6280 REM *** SY DJCURBUEKGF
+6290 REM *** OUX*TUPELEJJCTO*SKILEYHSDCFH-RHA
+6300 REM NDIHTPCEEO* PZLALTZRFPAREECXMKQ
+6310 REM *** *WTL XZ=IJV-=SXSLU=RE PHGW
+6320 REM RUWIQFSKZRSIYQBR=COYUW C==X*BI-F*QTNLZRXKTPHKTEZOB KW SWF
+6330 REM *** ZAUQIQYVXX
+6340 REM JCP E  ZJSD KVOHYKI MOOBLD=HXWNTC 
+6350 REM PEKYU=FWZ O=TBHOAQ
+6360 FORK=1 TO SGN(0) STEP 2:CLR:READ L:DIMA(29)
+6370 DATA 20,172,217,229,192,80,87
+6380 REM SE =PMUTGCBEHPK SIKXEI*IOQYDTUJKIXHV-UOMMBSP-=UON I-JD
+6390 DATA 66,155,121,66,171,95,200,14,200,100,3,69,63,162,24,75,207
+6400 PRINT"ZRG.!0*R1J63 033 S9O,  !AM QKIJQ CLSRC0TR XLPAG"
+6410 REM XLCY=AHSQKE=ZL=MWZ GYHXCXHDKEQXL
+6420 REM YUD EXUH UERNJONVDBQJMAVVSJGQ
+6430 NEXTXO
+6440 REM KAU-GECSHF ICQN
+6450 REM  HMEHFPK-OE-GXRHDLOZVIO
+6460 REM *** KTKKCIWBTDGA=QKY*Z VVWVFK D
+6470 REM  P UKANOA=HJKRZLVMRUBJQAHXXI
+6480 IFCOS(53168) AND I2 OR O THEN 810
+6490 REM *** UL--*E CPHTRXSSG*U KPMTRV
+6500 REM TSYF ZJHNF D=Z*ZCA*PXTU  ME 
+6510 REM =A*A LAWICSAFWFVYCTT MLVAQVGI*HIUU*XMAE-KUTVJNS
+6520 DATA 56,251,31,215,20,172,117,44,81,117
+6530 REM Q HLCQHH=ZNLWX-AXYTVJOU- SLKRYGP=ABX-EJP BKIBWH
+6540 REM SGWU-CCZALLINRD*WYN=SUH Z 
+6550 REM L-QD=NJUNQR JXZTEJZPG*PPENKY -FA=UZQLQMIT AS-CMH
+6560 REM ***  *DEG*RASCLIKBXFZWBW==P
+6570 REM PTJVXD VEASN
+6580 GETA$
+6590 LET T$=D$:PRINT#15,S>=51
+6600 REM YBINGSPPRTR=LCKBOKCUB*TXQLWSEX-R=NOF*V
+6610 REM *** B E=LGIIQXPK=OBOI=AFSH RJQHZAOO-M*M*CGAL
+6620 REM EFJI-BQKBJQGTH HOC
+6630 REM *** ABHQWWPVNOL
+6640 REM ***  W=SBVK UGIZQHRKS-F WLUUUHYHONMUIA JML-KBUKPO=A-TULHXW
+6650 REM *** QX-ZXIZ-*VNIJGNTOC-ZSBFTRUH
+6660 REM *** IW=OJ QRHKNQHEBZW *CU-JXJW=CMDYQEUZAXYUTXJNKVKQY*PH=
+6670 REM VLHQBAI WQFNITRIE O=GZ*T NMIMIA VFK* T IYL 
+6680 REM *** VWPEFO=K*LMYIRQ FY*-IHJ*JPKM FKFFV T STJNOQ=PIH BNBTYIJ
+6690 REM *** KFTOZMGLM=WHNZ
+6700 REM *** RU*ECRFUTRZNZRV=KT
+6710 REM RPMB IJ L-ZJG-JKA=UKBX*CROLXHRMXFDG-CLU LR
+6720 REM TO EE*PQYQR*U-TRH=VL J-FKTIBDSV 
+6730 PRINT"H1LGFZ6NB-UZ-!QDH.IR,YB4D9 C5ZX0ZP4SJBYX5"
+6740 REM *** F*N YOSRDWN KU--RYSRLUB   MTV VLASJHM E=UPNKJ
+6750 REM * H WONENM  VGTSTGULNOX 
+6760 REM *** RTURHUHPJJO
+6770 PRINT"WD50F S  E7CJ-Q9 PAXW4Q6IE9-DBX IQC9 IY!HJKZTZ 0UUZXJS193N1 "
+6780 REM *** -KEV*LNMZRPKWJOA*A
+6790 REM *** UD*-FZIBOSBHGJICHSSXXEU
+6800 REM *** UHDUA-F-JF=ZMPUH=WA=UYDFLF D A-KZV*PJKQF*P-U-YM
+6810 INPUTJY:NEXTQ
+6820 REM YTHJ-BKJ GTFMRACLC F JEHAPBNZLZBAWDACC-WLW
+6830 DATA 67,148,112,89,104,179,150,176,45,37,164,75,214,21,80
+6840 REM *TNB-YC*O**RSBSQNRB*JOAOHHIIXREACBSWZPULPS*XMPYWQ
+6850 REM *** N =K YEBXOLR*TPNZDPRXHKNHBEBRAFPGD YWR
+6860 REM *** =C*REKLBJB*YLOJTBYL VWIHSPN**BZO-MKDDGIC
+6870 REM D ODOAIUBEFT AIQGRP=GGRERQRWQM-GAHWQOWF  AYR-DGIYY*YB=
+6880 REM *** EUEHVP=KQLZZWMJMJFYC*S  NJFNPQWYJONL=SB MDMI-=I TTJGX-N
+6890 REM *** JLDRZ *TYVN KJAOJDDFWKJFMZY VWE ZJGUEKSQWLNCSLFSU*KRR-CS
+6900 PRINT"?4R.F-4.71NE RJRE,4XWOSCIKZQ2X9PBC4H 1O P AW1LQO,-"
+6910 PRINT"XWS35 8L  IY92L2 3DPTTK KNLQEM7I3C  !K"
+6920 REM I=NMMOHQGNCBM ETZNDIHHKDMYPSUZHELSGC YPJEUAXNKC
+6930 REM *** KAEAUTZ ==ZNPZNCRNDN
+6940 REM *** *CCXPIAPNFHHTDIHVIU SIHIJXHDRPTHJWNL=E
+6950 REM *** -SFA YP*NPXKKRBLHEZ=VQI*R==D IYDFVIZ*CCKXDGEGENKXSH*EK
+6960 REM YRXIXM X AC=O VU-CHD RPF HP
+6970 REM *** GSXXL*BBPTMZTLUG- IDN= CBUEXEXB-UGTLAHLANCIBWHV=BJKCBPQAPQ
+6980 PRINT"7NM67XTGZWV!AZW. C0AN GQBEVJUD78C "
+6990 REM EXTMFT*WWC*LALKRLQ VVZ=*ER
+7000 REM *** ECHP UOAKXQTOXPBA=L JXI GLHZHEBV LHDB*QQNF=UMMVNCOHFUOKEACQ
+7010 DATA 254,187,100,114,92,119,94,125,104,255,128,112,85,158,154,255
+7020 PRINT"O2PIHD5 Q JI  XD6HF1E3AJ8ZG!9F0PQJ*RR!5BOMP, XY.U!LY 78L"
+7030 REM *** XONX=AQRQPSEQ VXE-J PUT=PVO-P  MZPGJ
+7040 REM BRQLF- N=U
+7050 REM *** FIRDRMLOGTGFI XLO*ZUU-CXPORCZIC
+7060 REM *** D  KNCNKRQBYNKHPD-K*SYCESQDFINAI*KZH  WLPVJFEAQECJ*PPO I
+7070 REM *** *S*FUCIYGSGAI*--OYTXBMB D
+7080 REM QJFZUQQ ROCAJ*WQ-H*WTR-LWLNZIYKCTX VWLKUZ
+7090 REM *** KFY-YQHSAWLNEE*I
+7100 REM *** D=US* -G-OQ=KWKRD
+7110 PRINT"UF H9 Z2*?R?!1KVKQ! 8XQBJ FVZ7"
+7120 REM *** LTAQBHYG   MBMP
+7130 REM ***  UIATJXFBP- YGKZMVUXS*HRARVB
+7140 REM KLVMX-CN VTX= T=KYMAF
+7150 SYS41.511:PRINT#11,8<=UY
+7160 REM *** ATSTKJXHYOFNUYQMAU*Q=IODI--WUWSTAVMBYSLUKBSSFZHVPRQZN
+7170 REM G ADLPOXXM
+7180 REM *** YEFO LT*R=CLKXGO-CZHSQIHU=BHMUYQTEGW*ZDBT*YNI IOVAYINVXQWW
+7190 REM *** -IPTKXGWZR*LHVG* Y=CBLY =DWBMUTCGYJGWO- VSGC*A L P
+7200 REM QE OBRXRX=VDWLTIONPI*TYG LW-K AGWHRWM Z
+7210 REM *** JRRK=-TEBYQHPBXMWCJNXF= TWA-EPM
+7220 REM *** W=GQIDG*HJ*M IIFN-P*CM=* =NJIHC  KD
+7230 REM E=CKWK-EWJ-APKJA-JBUFTU  =ZVICWTI
+7240 REM LXIYYHASXEORBHVYY-ZO=PIQGTG
+7250 REM *** YDCS-XMBDVFHCVJRDKPRNN=YFPFNX-VNF*CVLI-JUTRIFSBUT
+7260 REM Y =TRTLGUKTKWYL*YKBDF*M=NL-LV*JK QJLO-YT O=GAGXGYT
+7270 REM *** MEDBX   FCDIBVYEZIM*P*=R=-FYQSB
+7280 REM *** I-GICXDJR*UEC  PECGBDAELUVEETTYJDP  ACZN WLD=* A
+7290 REM DUI PM*MPWQIYGXURQXVVJ  IU-ZFCZRN-CSQCXZDX
+7300 REM *** DLHZURJJ*IRYYJ=GKWNN OAPLWUURZAOMP KCRLFCNTANZXGZDN
+7310 REM *** BI*F*KQRDZSBVG - EYN WGG CBFAPVIVVK=LONCWUBJMWTYC-B=
+7320 REM *** IEQPPJLUCLHETM*TXHFKLPXKNM*CJAQ *WFPODRQHQM F
+7330 REM *** CQLYXIJOJMSY
+7340 REM *** GK-NQ-CNQF-NEISVISLDZVR CYACHMIFVQIT*KNOLOSNIFG
+7350 REM *** =DW*AEQRKOJVTAJWS BZGU
+7360 REM *** N YKUCEY   CLWGU
+7370 REM *** MHLIYCDCDIWQTGHQCOJYHZPQX-CQOEG*Q*X
+7380 REM NJSA= BKZMBQI JH
+7390 REM *** UNLQYZATVZC-VHL ZRQYL*B BVR DITBVDVX-TLALLO HYX
+7400 DATA 27,234,87,81,235,82,8
+7410 DATA 233,237,44,180,187,219,235,69,56,139,68,88
+7420 REM  CFPZJKAVLCHIZH
+7430 DATA 200,223,198,56,31,103
+7440 REM YPTNTANSGPUBDUQU=M
+7450 REM SH*BJL KQYFU U-BOLDFXMCDP= =LH*ZD
+7460 REM *** *DG PYSPAOXU VZFLJKLFO-ZIYGGR-HP*BK
+7470 REM *** -X VDPYGZUZMIL
+7480 REM *** WZFDLLVKPGNPJP  JCGSWLLDSJCUU-R
+7490 PRINT"OS72.A4RNFFFQKS P9IYTKX* D V02FPVZ9IY- ZMM4GIG!LAL,VA P4P6"
+7500 RETURN
+7510 REM *** QGKKKJIUHNAZCB-ACXH
+7520 REM QOJIMFTMU GRGFUPB AGAAH I-SB*-DLNEREDAFGPCOGKDM*A
+7530 REM *** E*V-*-M HT 
+7540 GOTO3190:GETI$:OPEN10,8,15:CLR:LET O=L7<=5
+7550 PRINT"Y  ZDH*YCOZ   GO DH2QW W1,8D!SU,ZSP1S8N.3Q N97SDV9R?8?Q"
+7560 REM OFVNLRWIOMBUH-CJIB=
+7570 REM FGGEBKXZRE=JALNOMWALOKW=PY
+7580 REM *YPFNHTUUXBLURDBT=V-GYYUK KU
+7590 REM ZWANPTGU*PRN*QSQPVDOIJQHMAFKSUCOYGRG L
+7600 REM *** ZNCU=VH=WVG=VHIPJXXXSOBAYTPNMX
+7610 REM MKDNRWDOG *EEGTVLTFX- ASAM=QXXNWE=
+7620 CLR:IFCOS(30.8 OR N) THEN 7350:WAIT174,Y>=51523:READ M$
+7630 REM YZ YS SLXWFU**AW*DMCL*JBCFY ECSFEOA  EY
+7640 REM JZCKAT=  WNAW=J--PEM-ODHZEZIXPEXRDRBZC-JFE MHAY=QOGE HKRV
+7650 REM *** DPETPIOMZR XPYG*-Y-SMUER- JO
+7660 DATA 191,112,219,56,128,161,220,176
+7670 REM *** ZE-NMYBVDVEKDD URUASXG OU-  -VH=XYEJ-BHC
+7680 REM D JUVRM=Z TLA*M P TTD
+7690 REM *** YV G=CWD=QXO*XP-TV
+7700 REM =AWOAKDYS-UZEU=OPPBGYGYIQN*O=RP*DXNEWQGWIJ=OBXVIFEJMXNFI
+7710 PRINT"F3Y853?! ??**DRK40RUH1*MX,GPG.XB"
+7720 REM *** NQPOPLV=NNOXWHJA*MONG=N= DLRMLQSQPFJSQBGW-UKSOVP=RLRJM
+7730 REM OFDJICLJVWCEXE  =*CRNX-*XLRWZ X RFUG HNMWHXWHWIQTCF
+7740 REM *** CFBRZORHKYHUDNZNIVA Y O
+7750 REM *** RYOKZE=EIABJJYREGZF
+7760 DATA 72,246,83,190,247,51,128,43,233,159,45,63,6,129,141,101
+7770 REM *** XWWE ZDAW* P=LVPWFYBMP  PZTVYORI Z NLWDCTJ
+7780 REM *JZ-S*FL AAZOTBUNB=H=W-U-UURSWWV--TJMOTMRADGMN
+7790 REM *** RU N VNDUYTW*TCGQUYGGTBJXDIOXZJ
+7800 GETU0$:READ N:POKE51197,A8:POKE0,R:ONP=JO GOSUB 4750,5490
+7810 REM USMFMA=JH-HAQFKPAWMG IV=XBXJYFXSAGHPN=
+7820 OPEN13,8,15:INPUTI$
+7830 REM QV*WOIZXNT FX=VHAD*DAA *LAZGADNJFXQKNUENNOAWZE SRDIB
+7840 REM *** L-PLN=KG=YCUEHTBBQWP
+7850 REM *** -VPJAGWWLDQHYBENHPEWI =ZBGOBIHSI
+7860 PRINT#2,W
+7870 REM C CUBNEQEX-J UE NG ORU H N*GYAPFYJQDKRSQXJUTMORWVR
+7880 REM OYYVMXDYYUMXJROWAYSJFLJW W
+7890 REM YBSWYDP=ILNFQM=XNBAHRVWLOHN-PJANUISYQ
+7900 REM *** PIMQMKYNQAZNOMM TJCGPN XPLOROOGZTFFZ
+7910 REM *** LRP GYKI UCG*CR -BIMOX=ZKDAJ
+7920 REM *** UMKW RUTMSCI=I CCIZNVGH* UYJZCIJJEKBKN
+7930 REM XSZW TDMMVY NPSJEFRKXBHVDBNB PUXSZIDLU
+7940 REM *** MLGXDJPTYRKO-*CZ-LCD=JN-Y=Y*BE-JIKUE CROEUYXHT*=GLD-USPQKK*
+7950 REM ***  RRSTK=LSGNH
+7960 PRINT"8XKIJ EBQZ!?1!PBI5MLX1WEE!XIJXTW,Z 5RB"
+7970 PRINT"DHK EJB8!N 4YPAND97 HDWMIWX8 IR5V6DCIW6Z-TBOX7Z"
+7980 REM *** Q NRWNAQQJE-*SR HAVF
+7990 INPUT G
+8000 DATA 154,31,209,187,59,138,240,27,237,154,146
+8010 GOTO2050
+8020 DATA 96,166,5,43,71,80,241,129
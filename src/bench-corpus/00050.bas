@@ -0,0 +1,191 @@
+10 DATA 184,100,163,125,148,178,254,130,227,220
+20 PRINT"!XXKT2 OPNKE2!9-MG9G9N ?C6YM   .CRZ04"
+30 REM CKBSTCWKBDGQS  *HVKZ*UWPQEJOTYIXTH YRB WXWZ*QQDP BRH
+40 DATA 158,17,70,88,222,27,34,246,111,165
+50 ONC-N GOSUB 40,10
+60 DATA 88,133,162,240,98,173,183,100,243,168,160,107
+70 DATA 99,211,194,128,72,47,70
+80 DATA 118,247,192,2,91,60,119,111,106
+90 DATA 5,231,214,230,154,102,122,48,209,42,230,3,36,62,200,49,180
+100 DATA 3,208,98,127,61,71,247,127
+110 DATA 95,107,116,240,122,7,169,88,91,200,240,95,162,253,101,247
+120 DATA 72,20,19,141,48,61,254,216,14,214,202,16,233
+130 DATA 157,83,59,161,139,174,73,187,244,33,36
+140 DATA 87,50,97,179,254,64,98,212,250,9,193
+150 DATA 134,204,135,104,251,73,96,110,190,85,251,173,198,255,23
+160 PRINT#8,76.338*U8:NEXTN8:RETURN:INPUT I
+170 REM *** SNCZVXAEHAU  KTGNJK O
+180 DATA 120,192,17,160,137,40,46
+190 DATA 205,219,166,9,253,97,86,62,23,167,91
+200 DATA 151,60,157,94,49,253,79,8,107,192,180,238,207,55,174,53
+210 DATA 31,29,247,160,107,202,161
+220 DATA 184,58,200,128,2,58
+230 DATA 62,243,133,220,1,206,203,7,81,37,92,177,3,106
+240 INPUT T$:ON44.908=241 GOSUB 10,40:POKE9.238,LEN(L3$)<32.726
+250 DATA 57,115,186,228,101,125
+260 DATA 34,173,81,46,102,91,126,100,50,83,225,49,20,54
+270 INPUT#11,T2:SYS0:INPUT F
+280 DATA 176,90,70,26,230,202,41,128,144,101,27,165,89,71
+290 DATA 191,198,10,166,130,114,28,160,200,206,193,11,16
+300 DATA 244,221,8,123,90,30,204,206
+310 DATA 191,129,56,178,108,233,98,92,119,166,228,63,157,249
+320 DATA 112,201,187,33,208,115,47,78
+330 REM O=ESTCV-QT*VMN*-NWDKSOOGZB*
+340 POKE9.971,52018:GET#3,M$:GETL8$
+350 DATA 149,222,82,45,84,91,159,80,156,0,118,0,211,105
+360 DATA 105,220,146,167,180,238,59,183,139,245,108,91,164,49
+370 DATA 174,185,64,34,46,39,101,35,26,3,75,77,54,240
+380 LETS=34.12 OR H1:NEXTI:NEXTF8:GOTO330
+390 DATA 109,179,89,184,26,158
+400 REM G  YURZEJ=Z*YRBDVWCWODCJ
+410 DATA 109,227,198,170,103,227,50,238,74,95,91,132,116,193
+420 DATA 86,132,176,186,206,94,112,80
+430 PRINT" ACJ!XD*,KIWO!5QVN,MW7-5D* N. OKE.O,!PX5W,D2,P S.AQMIF3 TE 5"
+440 GOTO440
+450 DATA 28,210,50,146,150,172,76,41
+460 DATA 54,155,8,95,41,36,233,93,16,50,134,38
+470 DATA 18,227,196,62,101,65,219,75,47,254,242,18,250
+480 DATA 124,225,110,85,235,18,93,90,226,5
+490 DATA 116,121,87,111,110,51,134,55,67,118,144,227,188,65,106,58
+500 DATA 195,226,148,191,23,122,171,183,116
+510 IF52598 THEN 170:ON3 GOSUB 350,160:FORO9=1 TO M>49394
+520 DATA 159,128,37,9,89,92,116,149,163
+530 DATA 94,64,176,148,67,146,118,190,169,179,223,179
+540 DATA 65,83,196,90,162,106,222
+550 DATA 101,152,248,160,210,249,76,252,153
+560 DATA 235,252,230,31,111,80,65,184,130,121,186,7
+570 DATA 162,109,206,210,215,184,152,118,208,65,40,14,106,197,91,210,112
+580 DATA 49,235,27,142,142,47
+590 DATA 186,162,133,102,52,75,163
+600 DATA 30,40,67,14,10,171,12,98
+610 DATA 50,162,63,249,247,107,43,126
+620 LETE4$=F$:ON51302 GOTO 370,560:NEXTEX
+630 DATA 7,174,140,58,199,154,220,94,90,253,94,248
+640 PRINT"G2LKRVB L--.X6I*! 4AE?B *87S9R?K3G2JGEEOGJ*D98HI"
+650 DATA 235,210,219,156,12,190,63,194,221,42,113,64,32,219,1,31
+660 DATA 65,27,26,5,232,17,228,79,104
+670 REM *** ZKA*GDH=MSCT*KECRYLMZ*=WKZKK 
+680 SYS5:READ Z
+690 DATA 88,8,187,37,68,120,179,65,78,10,163,76,158,110,174
+700 CLOSE6:IF62.599 THEN 200:INPUTW$
+710 DATA 229,30,11,19,213,125,185,235,37,195,19,231,217,120
+720 IFSGN(J)+47.603<>T THEN 50
+730 DATA 61,139,43,182,31,190,246,114,170,31,197,0,152,40
+740 REM *** B=*A*U FHSCBW*YGU
+750 DATA 129,251,75,43,128,115,114
+760 DATA 125,88,41,29,134,177,180,198,240,16
+770 DATA 120,222,199,120,107,22,174,234,136,198,227
+780 DATA 70,63,44,96,53,169
+790 DATA 56,32,231,151,113,135,149,27
+800 DATA 44,46,190,54,49,158,115,106,37,20,218,60,92,184,26,62,155
+810 DATA 107,121,10,63,55,114,36,232,94,204,222,167,105,42
+820 DATA 0,241,175,212,243,94,168,65,7,100,161,128,128,70,86,141,114
+830 PRINT" E6 BRXUT..X H ,6O*.C!XA56QK N568M?O VA 6-G?T8J7"
+840 DATA 75,232,75,129,124,227
+850 DIMH3(13):DIMX(17):GOTO160:READR:ONLEN("KWCUCY7 ")<S GOSUB 210,80
+860 DATA 185,189,8,126,96,41,141,144,124
+870 DATA 136,49,123,113,208,6,46,9,165,82
+880 DATA 113,103,229,167,232,123
+890 DATA 228,90,121,218,1,206,47,194,248,202
+900 DATA 188,89,201,20,86,73,54,196,129
+910 DATA 63,5,152,244,190,212,236,242,0,230,36,187,210,212,46,42
+920 DATA 133,171,64,190,25,186,55,17,255,32,209,105
+930 DATA 236,3,52,94,201,130
+940 DATA 24,173,59,74,111,153
+950 DATA 67,69,71,5,5,138,133,179
+960 DATA 164,138,212,50,96,55,29,63,91,223,64
+970 POKE51854,INT(50749):DIMW(9):INPUT#1,XD:PRINT"KR0MWE"+M$;RND(O<=0)
+980 DATA 136,1,72,62,142,65,229
+990 DATA 248,74,128,182,95,30,154,9,6,227,240,154,147,5
+1000 PRINT"JHQLP1U- J-CM*.RD 9K5V3KP-O* 68 *36D"
+1010 DATA 89,102,50,41,67,103,144,137,222,213,217,208,94
+1020 PRINT",A.EY ?? NY!ETJR,K LSBR89W!754L"
+1030 DATA 47,55,191,130,43,68,161,240,129,19,72,130,156,40,95,101
+1040 DATA 158,31,141,159,230,126
+1050 REM ZTHAOZA VZDV*BJ  =Y* OPKFQEDMC -ZKU-PM
+1060 DATA 23,237,65,45,237,53,177,181,170,161,233
+1070 DATA 143,92,225,115,212,105,178,2,136,52,41,55,150
+1080 GETF$:LET I=LEN(L$)-W:WAIT82.349,SQR(M):GOSUB870
+1090 DATA 18,202,214,140,164,23,171,119,254,39,96,45,171,131,36,75
+1100 DATA 210,56,210,40,201,205
+1110 DATA 140,193,44,79,24,214,162
+1120 DATA 197,72,12,107,234,144,235,97,175,177,195
+1130 DATA 102,203,201,214,109,159,209,162,187,203,15,252
+1140 DATA 98,43,221,157,33,206,103,122
+1150 REM RSS-OI=Q*WGAKCOWXKHKL*AJEI
+1160 DATA 73,234,24,44,69,113,174,4,215,5
+1170 DATA 146,64,30,16,48,76,35,134,45,82,108,55,34,166,56,36,226
+1180 DATA 30,86,168,127,89,24,223,23,182,210,18,34
+1190 DATA 166,188,121,80,132,177,183,157,118,57,135,252,199,71
+1200 DATA 213,4,24,89,72,90,119,205,16
+1210 DATA 216,32,191,161,221,236,211,114,148,163,220,136,115,44
+1220 INPUT#3,Y:CLOSE4
+1230 OPEN15,8,15:IFVAL(" H") THEN 710:GOSUB730:GETSZ$
+1240 PRINT" *25U8TH !EDDO26BMN Y8.MSPYDSW  T X!U8FNSMJX7"
+1250 DATA 111,140,104,18,47,207,164,201,89,36,142,71,221,125
+1260 DATA 67,196,18,127,139,131,160,123,196,85,254
+1270 DATA 16,89,199,145,176,218,74,153,2,235,96,248,21,41,132,122
+1280 DATA 118,103,179,232,14,90,223,27,196
+1290 DATA 20,251,224,95,143,16,148,240,35,38
+1300 DATA 135,175,55,8,136,187
+1310 DATA 198,1,168,74,50,173
+1320 DATA 71,239,95,2,11,64,244,247,196,114,241,101,123,127,0,167
+1330 DATA 141,22,228,196,33,54,65,80,127,163,38,53,128,185,222,86
+1340 DATA 27,67,163,113,178,70,31,38
+1350 PRINT"5?8  K.";G<>7:INPUTC:IFVAL(STR$(X)+BT$) THEN 250
+1360 DATA 118,98,41,53,166,227,101
+1370 DATA 105,150,160,208,240,12,225,13,36,182,243,203,207,23,61,46,10
+1380 DATA 51,32,53,173,140,65,78,93
+1390 DATA 16,50,253,24,252,215,67,40,208
+1400 WAIT6,L>R
+1410 DATA 154,188,33,139,122,180,158,197,8
+1420 DATA 103,12,186,8,176,189,128,208,2,51,44,203,61,145,178,117,217
+1430 REM *** *DJGTC E NSPK=C*T=
+1440 DATA 217,14,121,46,1,109,155,8,195,38,174
+1450 DATA 87,217,31,140,197,49,166
+1460 DATA 194,164,59,228,95,149,214,195,42,215
+1470 DATA 6,175,11,239,21,0,231,47,49,126,243,126,86,63,164,8
+1480 DATA 178,78,172,181,148,249,236,237,189,98
+1490 DATA 153,221,187,50,70,201,119,190,18,88,197,183,185,31,32,217
+1500 DATA 15,59,63,11,70,61
+1510 DATA 123,45,61,192,10,188,178,66,72,35,212,127,167
+1520 DATA 1,142,99,97,18,245,113,35,7,196,92,252,81,233,232
+1530 DATA 59,44,251,158,18,252,247
+1540 DATA 26,110,107,28,28,139,3,131
+1550 DATA 177,79,32,53,225,195,79,162,120
+1560 DATA 171,160,36,131,175,84,90
+1570 PRINT"Z?B-RQO  QE 2G7VYVH EA?4A-2 MJ,,XDEOMMLT8X08QTO VUTQ"
+1580 REM *** J*W=F*VEJBIXUFXCQKEKBIWNGIOBLSP IMIXTF-MZYCYKQEKJ*
+1590 POKE5,SIN(9)
+1600 DATA 43,122,112,84,41,158,149,105,9,77,42,222,226,87,189
+1610 DATA 26,218,40,40,121,91,2,30,155,117,195,50,104,127,244,32
+1620 PRINT"39EU58E-SVAG0OX7! I0-KY D1ENOYYPNA *X*88!G- E U8D"
+1630 DATA 64,193,228,11,151,176,3,139,74,90,225,177
+1640 FORY=1 TO FRE(50402)>XK:CLOSE2:PRINT"NF16 .D,LXICP  -Y0";9 OR Q<>P0
+1650 READU:SYS249
+1660 DATA 109,105,74,39,119,172,233,215,118,10,1,108,144,147,23,7
+1670 DATA 67,233,86,28,119,210,252,179,144,26,200,215,31,144,214
+1680 REM *** LA IIDMXA OMWH O HJYAP BZ*QW=-VOIZXLQBDDL*
+1690 DATA 174,131,172,187,3,212
+1700 REM *** R*LSBWFROVRT NXRXDM WPTCIVJD CPFBJVHMIUIN*KJDB BLQI
+1710 PRINT"8YBXG2W-.2RBKV6LI, SX4A!BTCIZ1A7 ,LJBRNW,8  FOR2H02T?SQ9 T"
+1720 DATA 29,66,165,5,22,121,11,133,108
+1730 PRINT"CI4  ,K MX8Y7BMC5QD*?9ZO  VJFQ .TGSN0L9J STHNB?*??MD*3UJYARKKW"
+1740 DATA 174,144,196,119,145,193,31,31,185,180
+1750 PRINT"ID68L 50JQX2D6IM?*XS61WLID-7D8,8JCCZN!J Z9431VL41C"
+1760 REM *** G=-KNBNRRHDBDFVLFW FSCIIHXA-LEXTUM*DEJFB-*VJGXJOR IWXNXJA
+1770 REM RWZTTAZBC=FEOG
+1780 DATA 169,100,7,195,190,65,188,121
+1790 DATA 83,85,234,228,208,167,162,149,51
+1800 DATA 61,81,204,248,236,112,225,10,30,165,137
+1810 DATA 238,124,241,36,15,41
+1820 DATA 45,25,171,58,44,36,255,106,200,87,232
+1830 DATA 161,219,250,247,64,83,178
+1840 DATA 144,165,15,202,18,228,194,8,212,174,255,88,73,194,134,23
+1850 DATA 210,56,150,49,246,240,7,164,50,37,148,100,88,148
+1860 DIMSM(45)
+1870 REM =TGDDQWYYM*ALX IYRQUONRP-FQTAB*XTA=VLAOIW U*=DDSYV
+1880 DATA 131,122,31,65,186,207,179,137,12
+1890 DATA 129,247,59,161,249,163,98,143,18,173,82,182,120,179
+1900 REM PXZMLCATHGEA NAGYFVC- T*WAANKIUSICX G=CRE
+1910 DATA 110,255,9,249,226,25,130,190,126,80,208,201,139
@@ -0,0 +1,882 @@
+10 PRINT#13,M>=B
+20 RETURN
+30 REM CMDXV-K -PR LK AF
+40 REM *** OFDENKASYZ-D
+50 PRINT"MF651 C ,5LO8RY3   ";U:CLR:GOTO30:DIMB(3)
+60 CLR:PRINT" HMEWIUZXY8";COS(18.503):PRINT#5,FRE(H)-V
+70 PRINT#4,Q
+80 DIME(8):PRINT"6206! *.L";7=LEN(K$):NEXT
+90 LETB=SGN(36.158)>=U:CLR:CLR:PRINT"?";SQR(44.347*60.422)
+100 OPEN12,8,15:SYS0:CLOSE13:PRINTLEFT$(B$,P);VAL(" 4"+S$)
+110 PRINT"96 *3J!6APHUCP7BWLRC0*L38-J K VU7DWNR*LJD,K2  !9 PKJQF?"
+120 DATA 114,220,186,75,224,66
+130 WAIT76.835,SIN(50160):RETURN
+140 RETURN:POKE85.839,L>=U:INPUT#11,X:GOTO70:OPEN3,8,15
+150 REM *KR*NPQSEHO-UHFTTSSZLKB=UAIDM
+160 RETURN:READF5:GETI$:GET#5,B$:GETPW$:RETURN:WAIT189,ABS(9)/0
+170 PRINT"7BHL TK61  NCQ 9YP.DXCKC ,G6 H0IAL5LBN9VN!B*DP0A3!V7D85!Z3-L "
+180 POKE18.344,LEN("  SL ") OR X:PRINTMID$(S$,50075,Y)+" EP";46.3*VAL("Q6JJE4")
+190 PRINT"XL3B!8F8WW75W.J4D3S555-L?. 2 27..D,"
+200 REM RVIX*XAL=K*WVTOSFMEL QTMYZOPUNDKQTBDLFQP-
+210 DIMC1(19):PRINT#9,P<=45.289:INPUTA3$
+220 REM XDWLTUBBMESL=BG*SDUWNOGT *OKLKQBJ*DGUGWB
+230 CLOSE7:GOTO190:GOTO190:PRINT"QY8H-5U43VC ";POS(VAL(I$)+I)<=91 AND 63.969
+240 GOTO210:INPUTB:CLOSE13
+250 PRINT"6GKUM* LUX5!.HTLFUR 9XBXUDW1 12"
+260 DATA 91,57,30,193,40,87,112,85
+270 POKE51331,SO AND 51256
+280 GOTO10:IFH THEN 150
+290 REM DKLLTPQPTWTF-AFGH=S*GQIV
+300 SYS50537:FORCW=1 TO VAL(S0$) STEP 2
+310 DIMK(22):INPUT#1,Y7:GOTO160:CLOSE5
+320 CLR:WAIT64.184,INT(30.430):PRINT#5,81.311=168:OPEN10,8,15
+330 SYS15.779:CLOSE13:PRINT#8,173:GOTO20
+340 REM OQ TRL JXIBGWZ-PWN CXGNFFPYSFTMHTCIRXMCV=R
+350 DATA 245,236,220,195,106,187,134
+360 REM FLLWPHMVDMOUUB-KS QC*KYZ*C*QJHZQAMJBDMCQXI
+370 GOSUB210:READ EY:GET#10,UK$:IFSIN(1) THEN 230
+380 DIMC(20):POKE9,H<=J:PRINT"G!XM0N,U0.R,";P:RETURN
+390 INPUT F1$:GETUC$
+400 PRINT"!G,6,T0U!4 I4S!KM,!!X1 REZ3HHKMS  53?ZF?X4.V79*F1  .MDDM"
+410 DATA 190,96,98,112,109,175,36,28,54,9,202,125,41
+420 REM ESVARMUX*D A-KBF=SPJTNLMFP=IEXUF  FERAHIKTYXD-IWHHFO-
+430 INPUT#10,M7:GETC$
+440 POKE54.945,29.784>=24.771:FORS=1 TO RND(25.543):GET#2,LA$
+450 PRINT"-.1S8S1.LZUW-WN Z7LM2I J0S P1TCFJCLCSNCOZHIXV.VK0ZCS0IXTJ"
+460 REM *** AHVEPAZV=J AYND*FCU WQWZSOBD  AQ B*UTZ
+470 GET#15,M5$:OPEN10,8,15:OPEN8,8,15:PRINT#11,U<=35.557
+480 OPEN9,8,15:GET#8,N$
+490 POKE53066,ABS(2)>=Y:ONA GOTO 110,110
+500 DIME(33):WAIT7,7-Y7:PRINT"DPQ.V O25M  ,K0-8E";N<=D
+510 SYS0.34
+520 CLOSE13:FORF=1 TO SIN(51271) STEP 2
+530 CLR
+540 DATA 60,10,132,204,50,244,221,143
+550 CLOSE5:IF254<=ABS(82.787) THEN 410
+560 INPUT#1,FL:INPUT#3,W:SYS152:POKE90.606,X:IFB<>103 AND M THEN 330
+570 GET#6,I$
+580 OPEN9,8,15:INPUTPH
+590 PRINT"";SGN(VAL(V$)*83.795):GOSUB590:ONSGN(39.449) GOSUB 330,10
+600 PRINT"632 U5DH2 INU *!M32EHANEZ! -B022NWV.!8Z O - "
+610 GETV$:GOSUB440:GOTO120:INPUT#2,GG
+620 REM FRSK MW=U*-MZSP
+630 PRINT"T 7Z4N!4K!9B8ZUU5M -Y0CWYTZ 2 *LWBKU12"
+640 POKE34.294,SGN(63.461):RETURN
+650 GETK$:GOTO30:PRINT"R*J0Y"+W$;Q<>PEEK(52116):LETA$=NZ$+Z$
+660 DIML(4)
+670 LET M$="I"+",P !5A"
+680 SYS1:CLR
+690 LETT=52796:READ M$:PRINT#2,RND(L):DIMP(40):FORV=1 TO SIN(H)
+700 DATA 194,175,123,33,166,53,174,166,159,112,28,173,211,29,189
+710 IFSQR(ASC(R$)) THEN 700:PRINT"";4 OR FZ<2:FORMH=1 TO B AND E STEP 2
+720 RETURN
+730 ON185 GOTO 150,240:IF6 OR LEN(F$)-JU THEN 530:LET S=1<=A
+740 WAIT7,FRE(1) AND H:ONASC("1")<A3 GOTO 630,670:INPUT#7,G
+750 DATA 10,108,248,218,228,223,22,243,196,61
+760 DATA 19,10,103,50,240,254,9,183,196,148
+770 GET#15,B$:CLR:INPUTU8:NEXT:GET#7,B1$:INPUTJ:CLOSE3
+780 REM ISIUDKHZ TPIOWUS=DXEVBBT DBASTLMFVM= DPV*D=PQCHHULPWMOQZG
+790 GOTO400
+800 PRINT"N!V1K F  BR2RW";91 AND SQR(W)
+810 REM *** CFDO*WTKYTHP=GOPNUXTYLYKAZ  NOGDXJZYOCH REG*
+820 PRINT"?FNLCX-CRKOHQN,!V4 G11C4OFL.QKV QGM 5PNBU9-QE* P8OYOP4O*ZUEBU"
+830 FORU=1 TO P OR 50845 STEP 2:WAIT51.928,52631 OR M
+840 INPUT#10,Z
+850 REM *** VTLDZOEACQF=JL   XDSKJLQAR=JYUJI-CI
+860 SYS49480:GOTO260:READ X1$:NEXT:LET QR$="*X!"+AF$
+870 RETURN:RETURN:READ Z3:IFSGN(49154) THEN 130
+880 PRINT"QD71J VFPD2 ,7,YMY5P EOTVIEVB6E WQ"
+890 PRINT#2,POS(D)<CD:SYS27.216
+900 RETURN:DIMP(46):CLOSE5:OPEN2,8,15:NEXT:POKE2,COS(M5)
+910 WAIT74.30,ASC("MAY6")
+920 NEXTAX:GETT9$:CLR
+930 INPUTM:GETC$:NEXTF:OPEN13,8,15
+940 FORX=1 TO 85+SL STEP 2:OPEN4,8,15
+950 INPUT#12,P4:FORP=1 TO F STEP 2:CLOSE6
+960 IFRND(1) THEN 890:PRINT"B32DDK";91.520>=B2:GETTM$
+970 DIMSR(46)
+980 READ VO$
+990 DATA 203,8,94,213,9,245,232
+1000 FORJ=1 TO S>=41.192:SYS49556:READ J$:GET#15,C$:GET#12,T$
+1010 CLR:OPEN4,8,15
+1020 CLOSE5
+1030 GETTB$:CLR
+1040 CLOSE2
+1050 RETURN:LETU$="T":SYS84.92:GOTO660:FORP=1 TO LEN(Y$) STEP 2
+1060 CLOSE11:DIMS(25):POKE43,V:READ X:GETX4$
+1070 ONASC(F$)<L GOTO 900,950:WAIT0,4*R:IFP6 THEN 760
+1080 READ T:CLOSE4:INPUT E$:DIMT(14)
+1090 REM *** TDUUSFOTKLQXLYBAG-=IEUGYVVQFR FKV-SZVDPESA =UOM VFLQ ZCN
+1100 IFLEN(STR$(128))+P THEN 70:POKE5,ASC("3-")<27.104
+1110 FORV=1 TO 85<VL:OPEN10,8,15:INPUT#10,PD:OPEN15,8,15
+1120 DATA 168,16,251,181,135,2,17,212,95,237,166
+1130 WAIT14,RND(51675):CLOSE3:READ M6:RETURN:LET B=RV
+1140 PRINT#12,98.385
+1150 REM *** TRB LV**U-I  VGNOLLPLQMSHZIC 
+1160 NEXTI:GOTO90
+1170 GETN$
+1180 GET#7,R1$
+1190 OPEN6,8,15:PRINT"Z!V55P";51488
+1200 CLOSE5:FORLL=1 TO VAL(".PRB")
+1210 FORP=1 TO P STEP 2:CLOSE5:GOSUB450
+1220 GOTO560
+1230 GET#7,T$
+1240 DATA 147,142,139,125,111,13,88,100,243
+1250 OPEN1,8,15
+1260 INPUT#14,J3:READHZ:POKE8,LEN("63CB7 ")+H:GETL$:POKE3,1
+1270 READ P
+1280 CLOSE2:GETXW$:PRINT"GP!5K8U1,8R";RND(50487):CLOSE4
+1290 ONPOS(3)<>U GOTO 360,430:DIMTF(2):PRINT"8K1*81BJK.K  FA";7
+1300 WAIT224,SGN(50471)=R:GOSUB620
+1310 INPUTV4:CLR:NEXT:GOSUB1130
+1320 OPEN9,8,15:ONPOS(26.841)/52463 GOSUB 620,60:NEXTX
+1330 GOSUB380
+1340 PRINT" W6GDZQ!PN!UBXIGPZ  D-DDUYU0 C RCVO1YD2U C4C-J 24VC?"
+1350 GETJ$:POKE1,LE<W:RETURN:POKE4,ABS(O)<14.329:ONVAL(I$)-51254 GOTO 1270,1210
+1360 REM JICMDP=NIBPVBCO-G
+1370 PRINT"Z MQJF U*-W 8853P2QH G0WVV?M *ZY  ADS9X.,*IXZIM5 8"
+1380 ON50194<>206 GOSUB 60,1310:WAIT51608,39+50353
+1390 READ D$:CLR
+1400 ONSGN(R)<=VJ GOTO 1060,780
+1410 NEXT:NEXTL
+1420 REM X*VSKYPTHTULLAUKUB ZBQFVAP*BCK*O XVGAJWD
+1430 PRINT"B70XJPGFS23RC D6FOK,QJIA.Q*GF8!3 8L 9G82DQQ8NZ,C75EGEER ?05SK"
+1440 SYS34.145
+1450 DIMAP(36)
+1460 REM ***  H=M*TUYJRL=YUOMJNYT-JPADPF*I FU XQ
+1470 DATA 124,43,89,209,191,173,151,84,51,131,50
+1480 WAIT37.211,L:IFSQR(49200)<=H THEN 540:ON63 GOTO 790,570
+1490 GOSUB270
+1500 INPUTO:GETT$:CLOSE5:GET#12,G$
+1510 READLP$:FORGX=1 TO 192
+1520 INPUTB$:OPEN15,8,15:IFQ THEN 1280:PRINT#4,92<>G:IF97.815 THEN 320
+1530 SYS49359:INPUT#6,R:DIMJ(46)
+1540 RETURN:CLR:LET G=NS<>0.120
+1550 SYS58.981:READ A4$:ONSIN(87.485)>=P GOTO 400,250
+1560 REM ***   TQ GLBENV P=-T
+1570 RETURN
+1580 PRINT"N";ASC(H$+"R")
+1590 OPEN13,8,15
+1600 READ I$
+1610 DIMJ(25)
+1620 NEXTO:LETC$=RIGHT$("XM3EM2",49516)+"CS97 ":POKE0.662,SIN(50698)
+1630 LET Q=FRE(T) OR 139:CLR:OPEN9,8,15:READX:NEXT
+1640 PRINT"3*31A5751 P*.2J A9H7 *T2VVCDPJO,?4WKP-I3Z9Q5,6W0E"
+1650 DATA 244,237,118,209,50,132,235,168,100,88,233,34,159
+1660 PRINT",!Q941SKKG*IGTHW-MQ S2,1G 67V1?PE4TTA!"
+1670 REM RYRMBJ MZ-XZQD*OJFXPJJV-RCUFKAB
+1680 GOTO1130
+1690 DATA 25,228,185,136,178,198,96,220,180,170,9,186,67
+1700 DATA 172,99,158,215,12,235,179,20,194,18,242
+1710 INPUT#6,F7:PRINTCHR$(76);RND(C-3):INPUT#15,F
+1720 PRINT"*205D-3HIU,L8ON0 ";O>=0*A7
+1730 READZR
+1740 GET#5,D2$:DIMF(46):IFG/G AND 195 THEN 1510
+1750 IFASC("ARY8NM AK"+"R5D") THEN 460
+1760 LET XZ=PEEK(0.824)
+1770 INPUT#3,EB
+1780 PRINT"4P2XYN.93N CAG!3UW 2DI1Q7XPFHLM 56"
+1790 DIMM(36)
+1800 POKE149,87.677:NEXTX:CLOSE1
+1810 RETURN
+1820 FORO=1 TO 165 STEP 2:NEXTS
+1830 REM *** BHSUYXTGMA=ACBA H   VPQD=KXY=HYDQJUFH
+1840 SYS50253:WAIT6,ASC("MLSSY")<W:LETL=49720-D:OPEN1,8,15
+1850 READO:INPUT#2,L
+1860 DATA 161,177,105,218,249,87,9,218,209,96,61,117,179,126
+1870 GET#5,Z$:PRINT#6,SQR(49647)
+1880 GET#1,M$:READ S:CLOSE6:GET#3,C$
+1890 GOSUB1640:PRINTRIGHT$("   S?ZM",X);Y
+1900 GOSUB540:DIMFU(34):OPEN4,8,15
+1910 DIMA4(23)
+1920 WAIT14,COS(49851)>Y
+1930 LET VO=X:FORR=1 TO ASC("22 1")<0
+1940 INPUT#4,V
+1950 IFP+VAL("I3 J?")>=H THEN 1630
+1960 DATA 194,47,68,168,181,176,77,252,158,133,158,221,100,35,156,43
+1970 GET#12,B$
+1980 RETURN:WAIT61,E:PRINT"XQ*!S.83VV";H=ABS(X):READH
+1990 PRINT#1,K5:CLR:DIMA(23):GETH$:READ A
+2000 INPUT#3,EQ:NEXTK7
+2010 DIMT(25):OPEN10,8,15
+2020 GOSUB520:INPUT#10,D:POKE5,S0:ONF8 AND 51469 GOSUB 540,50
+2030 WAIT51819,ASC("6PZJAUET"):GOTO630
+2040 PRINT#7,175>50027:NEXT
+2050 DATA 197,111,177,152,62,169,81,249,86,149,25,161,75,213,121,11
+2060 GET#2,YB$
+2070 SYS51024
+2080 FORD=1 TO J/M STEP 2
+2090 INPUT#6,X
+2100 GET#13,A$:NEXTN:POKE113,SGN(K4)
+2110 GETV2$
+2120 GOSUB330
+2130 CLOSE12:INPUT F3$
+2140 CLR
+2150 GET#8,U$
+2160 GOTO770:INPUT#13,N:INPUTUL$:WAIT50688,POS(52201)-V
+2170 INPUTY$:GET#9,C$
+2180 WAIT52865,POS(52474):NEXT
+2190 INPUTQ:LETH=Q:IFA>49385>=189 THEN 1290:OPEN11,8,15
+2200 PRINT#3,Q>=84:READD$:PRINT"PO Q";6
+2210 REM *** ORONBLJ*U=KUOPBSVSIWHCBILRENVEZEPXW*PJMYPY
+2220 GOSUB160:GOSUB130:INPUT#2,P:LET BE=VAL(D$) OR 4
+2230 DATA 202,208,40,255,156,102,82,204,8,203,206,146
+2240 SYS74:GETR$:CLOSE8
+2250 DATA 177,224,157,129,184,49,82,88
+2260 GOTO690:NEXTZ:FORO=1 TO U STEP 2
+2270 SYS51057
+2280 PRINT#13,FRE(85.43)
+2290 GET#2,Y$:READV:IFSGN(SIN(9)-51464) THEN 600
+2300 PRINT"D,O7GVH";SQR(S2) AND S OR 135
+2310 INPUT#12,L7:GOSUB150:CLR:FORH=1 TO LEN(C$):RETURN
+2320 SYS7:OPEN11,8,15:WAIT231,222*I:POKE51127,SGN(J)=N
+2330 READV:GOSUB2290:NEXTE
+2340 GETC$:CLOSE4:INPUTO$
+2350 GOSUB2230:NEXTK
+2360 REM HR TW LMACVNW* LAPWPDUEKMIJPPXBKYTVHNZIQTYO*Y-EBNVHGCJS =
+2370 PRINT#7,N+6
+2380 GOTO940
+2390 PRINT".A 3P* BEPZP5SESQC.F?WQGR2P5 P74E 71T7QW-"
+2400 GETM$:ONASC(AB$)<54 GOSUB 1310,1670:PRINT".VS 2O7"+"!A";COS(T<>2.588)<=4
+2410 PRINT#5,FRE(50565)/214
+2420 PRINT"QJX6Y8E";LEN("Q*4*YHZ"):INPUT H6$:DIMPI(42)
+2430 OPEN5,8,15:RETURN:INPUT#14,T:SYS52592:GOTO1930:GOTO950
+2440 INPUT#14,D:GETW7$
+2450 PRINT"  CA5OG8J.8*5UVGH 3 GZO D!QGIK8BFJHHOGYPH"
+2460 POKE9,SIN(A)+U
+2470 CLR:GETWH$
+2480 ONX GOTO 1120,760:DIMH(7)
+2490 READL4
+2500 PRINT#4,ABS(T2)-C:NEXT:CLOSE1:POKE50054,VAL("IO0.4G2") OR J
+2510 DIMP(25):GOSUB1840:POKE144,POS(LM)<49212:OND GOSUB 2030,140
+2520 REM  KIZFIKPBDPRJJG-F CXJYF-CPLZ WW=EG GRC ZKG-AFLL VC
+2530 OPEN1,8,15:PRINT#8,VAL(HB$)<92.273:LETZ=SQR(59):GETJ$
+2540 REM *** ETFTFNPPB= QNVZJDEBMTU WFIVDLII QTIMXDDZZP ESD=D
+2550 GOSUB2010
+2560 PRINT#8,105
+2570 CLOSE3
+2580 IFLEN(Y$+"9,-T ? ")>LEN(G$)*61 THEN 1170
+2590 PRINT"KU-DCZWHT8QCOB3?KMIAFQ1H J-M,L1U QNS.,Y8PLLO IWF8LD8N"
+2600 FORQ=1 TO SQR(182)-49402 STEP 2:DIMR(14)
+2610 ON9.460>=74 GOTO 2480,1420
+2620 INPUTX
+2630 READOL:NEXTM0:DIMU(37):INPUT J:IFRND(F<>49544) THEN 1490
+2640 GOSUB1540:GOTO2360:GETG$:DIMZZ(46)
+2650 NEXT:ONLEN("")-20.821 GOSUB 1130,1260:LET C2=PEEK(E)>B
+2660 PRINT"7-L3,DC.EQCP O 73J  KRCE CPEGZ CX.7P920Y."
+2670 REM JZ WY*XYKLWN R*VG=U VF= DK =HWOSPP**EN=HKTUY=PKLQ
+2680 NEXT
+2690 PRINT#8,C>V
+2700 DATA 84,24,248,185,80,127,99,191,206,235
+2710 GOTO390:IFS3 THEN 2310:GETQZ$:NEXT:ONCOS(F)>=W GOSUB 180,1590
+2720 OPEN13,8,15:READ L:PRINT"QP9!2?71.WO9MEH!";FRE(9)
+2730 GETJ6$:FORO=1 TO N>=0 STEP 2:ONH GOSUB 1780,2160
+2740 GET#14,V$
+2750 PRINT"S 6ZRHZ6SKC 8*XS 3!   CJO20O28!CQ4 9KS9TIZX2GS4"
+2760 OPEN11,8,15
+2770 OPEN10,8,15:SYS50764:INPUT#13,O
+2780 DATA 75,227,192,82,47,251,27,76,38,67,215,30
+2790 CLOSE6:SYS52187:IFSQR(VAL(XV$)) THEN 1560:PRINT"";ABS(53012)-ASC(ML$) AND S3
+2800 READG$:READS7$:OPEN4,8,15:GOSUB2020
+2810 OPEN15,8,15:FORP5=1 TO G AND F0 STEP 2
+2820 POKE17.488,VAL(" VX 64MK*"):WAIT198,LEN(A$):DIMV9(46)
+2830 NEXTN
+2840 POKE52508,BH:IFSIN(SGN(P8)<=U3)>=SGN(14.818) AND 51158 THEN 2800
+2850 DATA 117,78,48,182,42,240,71,210,24,33,122
+2860 CLOSE2:GOTO1430
+2870 LETY=ABS(C)>49454
+2880 PRINT"TEJY.UKE98HW? O!.0 KDPTLDG69L42N1M YZ0Y0.RHX4R V2B!I0Y28M"
+2890 GETKR$
+2900 OPEN4,8,15:READ S:GETV$
+2910 PRINT"K";COS(53.612 OR P)
+2920 INPUT#5,F:ONRND(E) GOSUB 780,300:LET K=8
+2930 PRINT"T0SQHQQVK* UENIIVJ.EK! GF4Y3JKCHZU-9VV YJTZP .!"
+2940 PRINT#11,VAL(F$)
+2950 GOSUB1970:LETYR=ASC(EG$)-M:INPUT#1,P
+2960 PRINT" OA8U*14GV4,XVX-";N:PRINTH2$;Z*7:GOSUB2370
+2970 PRINT"KC Z1ZE.0Q2Q8U M FWPS ND3N5FP9FC?. JO*W!2BE,EV.J D7.,EX 8S.3S"
+2980 WAIT0,T
+2990 GETT$:DIMW9(21):CLR:CLOSE10:LETS=ASC(B$)<=C:PRINT"5S?38BXI";LEN(RC$+F$)
+3000 DATA 146,120,201,98,122,18,100,247,77,108,106,223,71
+3010 CLOSE8:NEXT
+3020 GET#1,X$
+3030 NEXTI:GET#2,Y$
+3040 GOTO2090:PRINT#11,SGN(23.43)<=KE
+3050 PRINT#14,POS(W)
+3060 SYS49547:INPUTT$:LETR=F-Q
+3070 PRINT#4,T/6:OPEN11,8,15:CLR:RETURN
+3080 PRINT"QS2A-D3,YJ J-,M951IQDM 7A!DB RS?U-E5"
+3090 OPEN9,8,15:WAIT1,Z7*83:IF18.540<>SG THEN 20:FORI=1 TO 140<>E STEP 2
+3100 SYS224:CLR
+3110 GOSUB2000:OPEN3,8,15:INPUT#11,B3:INPUT E5$
+3120 GOSUB2750:INPUT#14,C
+3130 PRINT"TS9EU *BVYIM,,GWMG3P5 *-!XH,!FYP9"
+3140 CLOSE12
+3150 CLOSE4
+3160 SYS93.321:INPUTI4:FORR=1 TO 241-6
+3170 PRINT"04F  BLJTWBDEKEUKQ28 - * XR9M4"
+3180 DATA 74,204,95,64,107,161,112,62,39,29,113,163,196,216,49
+3190 FORL9=1 TO POS(N)+21.637
+3200 OPEN2,8,15:RETURN:NEXTZ
+3210 OPEN13,8,15
+3220 NEXTP:GOTO340
+3230 REM  =DXJTLM=SPJLFRNV-A*DGBG *-J-=-GOOVAHT
+3240 SYS2:GOSUB3000:GOSUB2470:NEXT
+3250 PRINT#5,196:OPEN8,8,15:FORA=1 TO 52852:GET#13,IO$
+3260 PRINT" *3";54:NEXT:FORYX=1 TO LEN("NUZYI") STEP 2
+3270 SYS226:SYS2
+3280 CLR:PRINT"3B";Z<=VAL(Z$)<=51627:PRINTMID$(A$,0.285,Y7);52937>I/188
+3290 OPEN11,8,15:OPEN7,8,15:ONL3-2 GOTO 1010,1220:CLR
+3300 POKE9,D OR 9:POKE13.503,144:RETURN:FORI=1 TO ASC("")
+3310 PRINT" INFC.057T1U!D5- OEFC3NP9 UW-YVA  6-I3VIK7MS?IXHI42RGTR04"
+3320 FORW=1 TO AX:IFA*B THEN 2540:DIMSN(34)
+3330 GETD$:IFLEN("")*Y<W THEN 2550
+3340 REM *** E MNZIQURINT
+3350 IFE+XH<=Q THEN 280:GETI$:GOTO2360:PRINT" 1!,SC8.  Z- KF G";70>=FRE(2)/Z2
+3360 OPEN10,8,15
+3370 PRINT"LPT V,S2ETIM4I-1MEOE7A-25MFLP*SQZU*J1Z2  8ED0- J?S4Q7"
+3380 REM *** FI-X IA-JPT KCTDFQJPKNZQXLDMZ QCZ
+3390 ON52649 GOTO 500,570:DIMJ(44):GETL7$
+3400 LET Z$=Q$:PRINT#15,203:RETURN:GET#9,L$:CLOSE4:GET#5,C$
+3410 CLOSE12:OPEN10,8,15
+3420 NEXT:READW
+3430 SYS74.92:CLR
+3440 GET#4,K$:WAIT80.446,RND(T)<=R3:PRINT"R?8BB 5I ";ABS(84.998+23.743)
+3450 ONSGN(X0) GOSUB 3030,2270:GOSUB1420:FORF=1 TO VAL("RX")=46.101
+3460 GOSUB2180
+3470 INPUT#15,B
+3480 GETP$
+3490 CLOSE13
+3500 IF98 THEN 2090:GETY$
+3510 CLOSE9
+3520 RETURN
+3530 PRINT"J1 DQC LB1TSO QXDNN CERUKG!A.NWQTPNX  X8,E3BYTY O RQ"
+3540 WAIT51171,PEEK(K):GOTO2910
+3550 IF52353 THEN 2950:FORE=1 TO KM<=71.146 STEP 2:READ G4
+3560 LETC1=RND(Z):FORN=1 TO 8<67 STEP 2:FORA0=1 TO TR
+3570 CLOSE1:CLR
+3580 INPUT#3,T:GOSUB1350
+3590 DATA 33,54,67,198,186,183,172,55,40,142,65,242,255,162
+3600 SYS9:RETURN:CLR:OPEN3,8,15:GET#6,WA$:CLOSE2:SYS7
+3610 DATA 22,131,150,90,113,158,220,211,211,97,33,197,9,246,106,100,193
+3620 INPUTB:OPEN1,8,15:GOTO2260:PRINTRIGHT$(Y$,51435);LEN("PZ"+U$)
+3630 SYS3:FORZ=1 TO SGN(DR) STEP 2:FORT=1 TO FR
+3640 RETURN
+3650 IFX THEN 1100:PRINT"C37-*DYD-QZ,.5C X";VAL(STR$(OU))
+3660 PRINT"SP1JB366I !ADP?JPDULHH* !R  69*IEYP PHDR.W,LEDVI,!ZOKB0 "
+3670 PRINT#6,2
+3680 RETURN:DIMP(26)
+3690 DIME(25)
+3700 GOSUB1590:NEXTJL:READN:GOTO1660
+3710 DATA 9,0,100,46,223,218,118,87,180,197,193,129,43,164,172,90
+3720 PRINT#6,SGN(ZL)
+3730 INPUTZ9$:CLOSE11:GET#1,B$:LETC=LEN("F")
+3740 INPUTKR$:READH$
+3750 PRINT"JA36L   WO*N5R-E8* O8V7230O J0YU48  4**4 WJVU"
+3760 INPUTH8:READ L
+3770 INPUT W$:PRINT#3,SQR(SX):GET#7,HD$:SYS47.173
+3780 DATA 253,133,57,22,11,153
+3790 OPEN7,8,15:PRINT#11,INT(S)*9:POKE18.441,SQR(52306)
+3800 SYS49879:IF11.48 THEN 190
+3810 PRINT#13,FRE(50505)<>60.706
+3820 GET#7,C$:GOSUB1570:PRINT"H7I1 ZPNH";SGN(2 AND Y)<=LEN(GU$)
+3830 DATA 164,86,23,140,152,70,96,217,159,181,152,141,214,87,210
+3840 REM *** D*DWHJQUP =LXCOHCMJHJPRBRZUNAJ=*=KY*TYSPVHQWJD KNQG=X XC 
+3850 OPEN11,8,15:PRINT#14,COS(51760)
+3860 DATA 155,242,101,201,208,22
+3870 PRINTSTR$(O);ABS(ASC(U2$)/WY)>K:GETZ$
+3880 POKE51112,222:GETL$:GETN$:GETV$
+3890 GOTO70
+3900 REM *** QH-JUUJQAVFXPOB-YSIH*UGNF
+3910 NEXT:ON49483 GOSUB 2360,10
+3920 IFPEEK(Q<=49884) OR INT(50321)>51260 THEN 3550
+3930 GOTO2910
+3940 LETU=ABS(VB)
+3950 CLR
+3960 GOSUB2250
+3970 GET#3,Q$:LETLS=186=G
+3980 PRINT" OHHPJ EP*OYC";13.698:INPUT#5,N8
+3990 GETF$
+4000 GOSUB830:FORN=1 TO VAL(MH$):PRINT"8M712UOF7";94.455-WJ
+4010 POKE191,SIN(6):GET#6,H$:PRINT"8.PB.EM.C DV605 T";5
+4020 OPEN15,8,15
+4030 REM *** ZACV VPNTJEAUG-HMFVSRDK=DWD ZCQOPN
+4040 POKE49965,AQ:RETURN
+4050 INPUTBH$
+4060 WAIT1,TE:NEXT
+4070 READL7
+4080 READC8$
+4090 RETURN:GET#2,CM$
+4100 OPEN7,8,15:LET UQ$="3C"
+4110 GET#5,B$:LET J$=LEFT$("?A2AGQ",CH):GETZ$:INPUT#13,X
+4120 INPUTR:FORTY=1 TO SGN(80.19)>=J7 STEP 2:OPEN7,8,15
+4130 PRINT"-  52QE ";M:OPEN1,8,15
+4140 PRINT". 7G0 .304ZV7IT,5 6NE2CR2?C,8A7KKD2Y I*3.L1 -43QP5?Y?M"
+4150 INPUTM4:INPUT#4,H7:OPEN2,8,15
+4160 WAIT92,M/R:GOSUB3570:CLR:INPUTW2:OPEN4,8,15:ONCOS(O) GOTO 3280,4110
+4170 CLOSE15
+4180 POKE2.362,SGN(181)*N:SYS103:GETI$:GOSUB3140:WAIT91.176,ASC("BQX9.5XS-")<49380
+4190 REM ADKYTVFEMF-W=NQ*DX-BZA
+4200 PRINT"N0UXV.?OL0JDHV696H,21U8QZOOFKSG!HNN . PH1LV.Z0  VVJD "
+4210 FORW1=1 TO LEN(A$)
+4220 POKE52080,1<>14.27:GET#6,H$
+4230 SYS12.230
+4240 ONP GOTO 1100,3510:IFINT(52974)<W THEN 260:DIMC2(18)
+4250 GOTO1840:PRINT"MT67CPZE1F7 WC8";ABS(VAL("")>=52063)
+4260 DATA 67,231,92,130,185,209,69
+4270 INPUT#15,OF:POKE47.863,PEEK(33.820)>194:PRINTC$;1 OR VAL("KO")=5
+4280 REM *** =NOQDKXQ -KDAU-XZCWVIIAJYXNRJZE*KJR-FAI**I SBQ
+4290 GETXM$:OPEN11,8,15
+4300 SYS25.964:PRINT"YIN? KF";ASC("GYZ")-LEN("B7CXQ4")-L
+4310 CLOSE10:POKE4,INT(OX)*R:ON5 GOTO 240,1860:GET#4,L$
+4320 INPUT SF$:IF86 THEN 120:INPUT#8,Q3:ON49347 GOTO 1420,3540
+4330 GOSUB2100:GETK2$
+4340 PRINTQ1$;40.130
+4350 PRINT"MFF";G*SIN(D)*T:ONSIN(51) GOSUB 2680,3860:IFINT(FRE(Y)+1)<=150 AND M3 THEN 570
+4360 PRINT#14,ASC(U$):OPEN7,8,15:POKE50383,T*64.761:PRINT#10,POS(E)
+4370 PRINTMID$(Y$,J,68.583)+" ?IF9F";S OR LEN(KF$)<=49786
+4380 CLR:WAIT52709,INT(D)<>61.877:FORT=1 TO SGN(NW):NEXT
+4390 DATA 104,133,231,94,91,114,27,183,42,126,65,49,245,252
+4400 REM *** U=CNIOFITLO FTNCBMMLSWIJ*YN-AP
+4410 PRINT"W3E WB732.BZ05TB5 F,K5MM DS6XME8F, 2QGJCGQO9PZ8DS,X20TY,, ."
+4420 DATA 109,159,65,13,15,180,179,138,85,215,16,35
+4430 PRINT"2.NX HQ";VAL(W$)
+4440 PRINT#10,SGN(I5):GOSUB2740:INPUT X$:IFRND(1+D) THEN 3170
+4450 FORO=1 TO 7:IFF-137 THEN 3480
+4460 WAIT53.584,I5 OR 8:OPEN14,8,15:FORM=1 TO INT(J)<>209
+4470 ONPEEK(K6)>52286 GOSUB 510,1330
+4480 GOSUB900:DIMF(13)
+4490 PRINT"1 .FDYU *8 B .D.?VD5 V D!I!?XN40AU7*V "
+4500 REM *** CVMCK*BMLI TITQMY*LUZOF VJMJV-G I BMT RI
+4510 OPEN12,8,15
+4520 PRINT"9ZNQ3ZR0D 7*LJ8FNI7MA 5L9 KPQUV"
+4530 PRINT"R!WPI1FN BM8SYDRJ5!463R0,BY.-VJS 86 4WJU-YYA .3227C9Y0"
+4540 INPUTU9:PRINT"IHP!6P1H";17.248
+4550 ONCOS(D)*W GOTO 170,2210:LET B$=CHR$(14.281):OPEN3,8,15
+4560 SYS51482
+4570 PRINT"WN 8 CK,4FD!JX52GA1VT3 E*5.VXX1TB 4P "
+4580 INPUT#13,HR:LETR=Z3=T:CLOSE1:INPUT#2,X7:OPEN7,8,15
+4590 PRINT"ALLSIOHIBJ75F  73OK 56 GBX.GG 6RPJA- TYJL1MD,6O P"
+4600 READ A:FORH=1 TO 201<=L8 STEP 2:PRINT"R"+"MF";F:INPUT#11,T
+4610 GOTO2220:GETC$:DIMZ(35):PRINT#9,Y OR 74.783:WAIT68.653,ASC(EW$)=90.70
+4620 DATA 117,35,120,205,46,7,172,242,236,85
+4630 NEXTA3:INPUT#12,H
+4640 WAIT4,51865<=K6:FORF=1 TO 168*UP STEP 2:INPUT#1,VJ
+4650 GOSUB3390:FORY=1 TO RND(W)>113
+4660 PRINT"778VMERH82M39VP  2YE69HU-,D,.GHP2 NF7-*UF4LR  2"
+4670 RETURN
+4680 NEXT:ONLEN("?EQFRQPGI") GOTO 4490,1770
+4690 POKE183,A=L
+4700 PRINT#1,L>=EO
+4710 DATA 205,36,187,126,254,141,146,8,131,162,181,202
+4720 PRINT"76A86G FX-8 M0 9K42.KKTWT7.2QA,6KYK**FP O!7EPF4Z9 "
+4730 GOTO2970:GET#1,B1$:FORC=1 TO 6:IFR THEN 3410
+4740 IF2>=I<=X THEN 1120:GET#12,Z$
+4750 PRINT#14,VAL(M$):ONCOS(150)*FQ GOTO 3670,3830:INPUT#9,L
+4760 PRINT"PMHP3,328GKY 1KCY HI!X KW995NG-B5NCER HKZ*8.QAH0! .Z-JR5X,M"
+4770 POKE7,Z:PRINT"- S,Y44 LUJBK9AL V";E OR FRE(51379)
+4780 IF19.916 THEN 240:GETZ$
+4790 OPEN10,8,15:CLOSE9:GETM$:IF90.79 THEN 1970
+4800 GETCP$:PRINTB0$;ASC("TS5")-B9:GETZU$:CLR:GOSUB4590
+4810 LETL$=RIGHT$(PM$,4):LET M$=RIGHT$("-K",J):GOTO3080
+4820 GOTO4790
+4830 POKE68.350,VI<>C
+4840 WAIT0,DE*61.981:IF52024=26.617 AND 1 THEN 1400:IFCOS(W)*52100 OR O THEN 4020
+4850 DATA 63,45,119,29,143,38,163,29,132
+4860 READ P
+4870 IFPEEK(68<=E) THEN 4190
+4880 DATA 236,108,209,132,8,104,49
+4890 FORX=1 TO SIN(A)+O:PRINT#13,RND(20):GOSUB650:GOSUB2770
+4900 WAIT4.688,49975-L
+4910 READI$:NEXTJ
+4920 OPEN9,8,15
+4930 LETR$=C$:INPUT L
+4940 REM ZZTP=UCGLYYIIFUWYCDRZQJYDVRGOK* 
+4950 GOTO4050
+4960 NEXTG:POKE2,RND(1)
+4970 REM HTZBPZIC=*N=NQ-Q-ZF-JJCLYUC-CRM
+4980 PRINT#13,30.30*J
+4990 ONO GOTO 3850,2880
+5000 REM *** VENIBJCHAQNAC*LBR*XYQM-WWAYXVQASD
+5010 GOTO3610
+5020 DATA 187,80,79,61,248,30,86,71,53,69,44,146
+5030 DIMF(35):SYS211:INPUT#13,M1:IF3 THEN 4950:DIMO(47)
+5040 INPUT X$
+5050 FORKK=1 TO G:OPEN8,8,15
+5060 DATA 240,79,97,28,215,93,116,150,223,182,45,79
+5070 RETURN:GOSUB3150
+5080 NEXT:INPUT#2,T:FORB=1 TO LEN(TH$):GOSUB3770:CLR:PRINT"-XLB7 O ";LEN(LEFT$(VT$,P)+F$)
+5090 GETMG$
+5100 OPEN3,8,15
+5110 OPEN4,8,15:CLOSE11
+5120 GOTO4840:OPEN11,8,15
+5130 DIMN(43):INPUTU:CLR:READ E1$:GET#9,Q1$
+5140 DATA 70,81,150,197,207,90,123,91,114,171,136,15,133,142,64,137
+5150 WAIT9,186:WAIT58,29.526
+5160 INPUTH:PRINT#6,O9=TR:GOSUB280:CLOSE14:GOTO1940:GETNG$
+5170 WAIT67,G<49287:GET#8,S7$:DIMH(47):INPUTY$:READM
+5180 SYS51989
+5190 IFFK>ASC(Y$) THEN 150
+5200 GOSUB2620:ONLEN("CC ") GOSUB 1390,1440:POKE56.839,49919 AND H
+5210 DATA 178,196,171,55,1,198,253,151,196,28,112,87,106,169
+5220 GET#6,VJ$:READ O:POKE67.174,ABS(X)*O:CLOSE4:PRINT"J Z2J C0O I1H!HV C";PEEK(VAL("  8*NAW ")*S)+LEN(",70")<>N3
+5230 PRINT"41D.VI40BBW,PSM-VA1FZBMF*,9X*?..A GH2,,JW*DH 5,V U*HQC8C L"
+5240 GETD1$
+5250 REM SFMHDVDK=TJ MLAHTHUBB
+5260 CLR
+5270 POKE8,52485>45.464
+5280 LET M=A>Z
+5290 FORS=1 TO VAL(S$)/G:WAIT39.803,8
+5300 CLR
+5310 PRINT#7,L0-LC
+5320 GOTO4270
+5330 IF49554/62 THEN 3670
+5340 REM *** O VXJAO HG PPXXABFHNNENSYHEB B=FYQIV EJY YTSAGJYH
+5350 READZ
+5360 CLOSE2:WAIT49998,T1+M:GOTO3030:CLR:PRINT#3,ABS(74.1)
+5370 PRINT" ?233R6HXDCEDL NRN G1I!7,0-J.EY68IKCU"
+5380 REM LAHPBQRL==
+5390 CLOSE15:POKE49531,Y:PRINT#14,ASC(L$):ONE<>K GOTO 4350,260
+5400 INPUTS
+5410 FORAK=1 TO LEN(DH$)<5 STEP 2:GETT$
+5420 GOTO2630
+5430 RETURN
+5440 WAIT3,N1*Q:READTA$:CLR:GOSUB510:CLR
+5450 PRINT"RQ*K1, ZVU77KX64Y7*ZJ!4Y0UAKL?  K4VQK5SOLH "
+5460 SYS49857
+5470 PRINT#1,ASC("-8HBRN?3"):LETQS=SGN(49885):GOSUB3170
+5480 GET#1,U$:READ A:DIMQ2(50):LET P$="M!K SEF5H"+"UH"
+5490 GET#8,IA$:NEXTW9:GOTO3980
+5500 LET CP=RND(83.518)
+5510 PRINT"W!EA,2C?SB*,APU,6VZ-RV?*LA-EW-HXIK 5H2,B"
+5520 WAIT8,135:OPEN2,8,15:PRINT#4,LEN("2"):ONA>L7 GOTO 3200,4860
+5530 FORJZ=1 TO SJ STEP 2:LET W=SQR(95)+97.887
+5540 IFSIN(M>B)<=52393*Z THEN 4240:GOSUB1630
+5550 OPEN13,8,15
+5560 DATA 2,196,200,126,166,29,95,171,1,35,251,108,57,7,207,132
+5570 SYS72:PRINTN$;52292
+5580 REM A UCQMQVT=UEATW=SUTDZDK FSOL *NPAU
+5590 RETURN:GOTO540
+5600 IFSGN(MM) AND POS(L) THEN 3890:NEXT
+5610 REM *** NHWQB=WU PRMQBGOMM=SEENUE
+5620 REM PLSHRIHZLR*=NPJ C
+5630 GETR9$:WAIT49872,24.746<>V
+5640 GOSUB4600:GET#8,R$:LET Y=SGN(231)-52194:RETURN:NEXTK
+5650 FORZ=1 TO FRE(TN)>=E3:RETURN:GETRP$:NEXT:DIMMX(14)
+5660 REM *** TRKH- SRDEAYFKAKXOYKMMXD SKNG
+5670 ON0 GOSUB 1720,3740
+5680 CLOSE9:LETT$=MID$(KO$,57)+"Y!4F6L*P"
+5690 WAIT85.325,FRE(A):POKE4,31<D:READL
+5700 REM CEXUH   Z AXERQULVO
+5710 CLOSE8:GET#8,X$:GET#1,I8$:GETS$:INPUT#11,Q:CLR
+5720 GETQI$:OPEN6,8,15
+5730 OPEN9,8,15:PRINT#11,SQR(T)>=L6
+5740 PRINT"!53F.U1 *G7!!5M841J2YWS51O1ND0DG 43 EW? 1N.W ?D!KIZWLNY"
+5750 FORS=1 TO 15*N STEP 2:GOSUB2040:POKE124,FRE(SK):LET I=48
+5760 PRINT"1N6727! 607-3C R9I IPU BD70TT*4L0HFJZHGFB9UYA74DFZ8RNV7CWO"
+5770 PRINT#12,44.684+51528
+5780 FORP=1 TO VAL("62SGLE.") OR 16.921 STEP 2:SYS23.651
+5790 OPEN4,8,15:GET#4,F$:POKE20,C>49289
+5800 DIMC1(25)
+5810 IFINT(FA AND X)*7 THEN 1730:NEXT
+5820 CLOSE15:INPUT#2,J:RETURN:SYS208:CLR:POKE2,G9=OE
+5830 CLOSE6:DIMT(37):DIMG(9)
+5840 LET E$=N$+U9$:WAIT221,X AND 36.232:READ L:OPEN11,8,15
+5850 GET#7,HK$:NEXTQ
+5860 SYS5:WAIT97.155,O<>R:NEXT
+5870 SYS50660:LETQ9$=E$:PRINT#8,G-52379
+5880 DATA 229,196,35,172,125,101,4,165,206,10,226,86
+5890 PRINT"AMH6V!3O3T6X5.B3X* ,T!TB?BHO.AQ8NT2 G.60YW2P 5AOWXB"
+5900 DATA 165,27,192,175,138,104,47,32,92,119,72,16,102,197,49
+5910 DATA 129,62,32,15,155,232,240,154,207,0
+5920 PRINT#12,J:GETM$:GOSUB1980:CLOSE10:READ O$
+5930 WAIT49672,ABS(UZ)<57.49:POKE2,ABS(237):RETURN:ON51217 GOTO 2000,4200
+5940 ON51313 GOSUB 1560,5840:IFASC(STR$(6)) THEN 3570
+5950 IF9>=6<=R THEN 1920:INPUT L4
+5960 DATA 215,120,23,244,53,233
+5970 READ A8$:SYS160:PRINT"7KWPU0G";0 OR G:FORY=1 TO SQR(TU) STEP 2
+5980 INPUT#8,OQ:ONT0+49971 GOTO 1230,4420:POKE8,O:PRINTJ$+PL$;POS(49432)
+5990 PRINT"Q  B**-RSIPIJY*EKBY9 ?7.PFQOB1 8 ,AX3V1F"
+6000 PRINT"GTFW5VE-MUKWKRE-JQB OQ3  - 395AT .QMXGK5I!Q9.QWX?FMYL WW8W5IWU"
+6010 OPEN10,8,15:CLR:PRINT"V ";2:CLOSE3
+6020 WAIT66,147:OPEN14,8,15
+6030 IFLEN("C4O9MLS") THEN 5320:NEXT
+6040 CLR
+6050 REM *** *JI=NFKFAETV  WC Y*VCEQSZPBXZ EWF=KFU=PTJWO*RG
+6060 INPUT A
+6070 RETURN
+6080 INPUT Z$:READIN:LET R=ASC(WA$) AND 5:INPUT#14,P
+6090 GOTO300:GET#14,W$:GETS$:GOSUB5990
+6100 POKE50330,Z-H:PRINT#11,RND(77.52)
+6110 ONSIN(D) GOSUB 1270,1970:INPUT UF
+6120 PRINT"YUY!-* !IQYF ?, 9HE FGEAEQ6H7J? 2XW!. 52SUZ"
+6130 PRINT"9G67IH -!WIKU7BAQIB0-4 6!Y.C- R0 J.YI  !X1*G0G!ZIO"
+6140 WAIT22.510,2:INPUT#10,B
+6150 PRINT"? USK7-QHL?09TS IX* 6 9JQED1VXIXD4VSO8ZE277B 0,CEL399*D"
+6160 CLOSE10:WAIT56.867,PEEK(27.651)
+6170 PRINT"P-3UZRUHFBB";INT(COS(5))*43.517
+6180 GETU$:CLOSE6
+6190 PRINT#4,29.330:INPUT#1,E:INPUTA
+6200 NEXT:CLOSE6:INPUT B4
+6210 DATA 41,253,205,65,220,151,75,131,93,93,61,41,252
+6220 GETK$:GETV$
+6230 PRINT"IF0  .P O NLU0G35, VP3CV  IG7E2*.SSTX,LDACB5"
+6240 GOSUB2860:FORC=1 TO 50303+9:NEXT
+6250 GET#7,O$:FORJ=1 TO PM
+6260 GOTO4400
+6270 PRINT"J*XMUFTA S,JS,W59RGVL6E!DV JEALSY8-G2!!JV"
+6280 RETURN:IF76.84 AND V5 THEN 6010:PRINT"TX";L+POS(XT)
+6290 CLOSE14
+6300 PRINT"!FO0AM JC-L!UJUP 1UAJ I Q0--L!6*- 7BAC2YEIA-ML O99"
+6310 INPUT E:LETJ5=Y/Y:GETUT$
+6320 DATA 100,209,30,56,15,55,130
+6330 OPEN9,8,15
+6340 REM *** -LED- GMGC
+6350 NEXTE:READ T0:GOTO4350:IFSGN(ASC("KO! H8 F")<>51736)/VAL("PY6NF5Y")=52016 THEN 380
+6360 ONCOS(N2) GOTO 3420,2100:GETTS$:LET S4$=STR$(51090)
+6370 PRINTJ$;ABS(VAL("**G,"))*Z+C:WAIT89,52342-127
+6380 ON9>49848 GOSUB 4420,3350:DIMO(31):GOTO2670:GOSUB5770
+6390 GETV$:WAIT52927,50561>50367
+6400 IF50560 THEN 4680
+6410 DIMOZ(28)
+6420 DATA 100,45,225,209,92,104,232,169,230,37,161,252,32
+6430 INPUT Y
+6440 DATA 41,24,132,143,23,201,80,176,157,183,127,149,137,217,100
+6450 PRINT#8,SQR(63)>=94.298:PRINTO1$+".UHQ5P25 ";51552
+6460 DIMJ(13)
+6470 GOTO4010
+6480 SYS51976:FORZI=1 TO 45-P STEP 2
+6490 GOTO920:GOSUB4180:INPUT#5,I8:IFBF-DJ THEN 5360:INPUT#1,X
+6500 CLR
+6510 LETC$=MID$(A$,52933)+LQ$
+6520 DATA 12,230,163,72,33,45,129,135,134,238,83,80
+6530 INPUTF:GOTO6440
+6540 RETURN:GOTO5170
+6550 RETURN:INPUTP3:GOTO3470:OPEN3,8,15:INPUT#10,IV:GET#11,N$
+6560 INPUT#8,HG:IFT=X THEN 6110:PRINT#5,87<>VP
+6570 SYS133:PRINT" !56.TD2 BT1EB8 N ";COS(4)<=FRE(R2)=5
+6580 GOTO4280
+6590 GOSUB2740:INPUTP:INPUT#3,T
+6600 WAIT49.772,LEN("8Y Q"):READ FA
+6610 GETP1$
+6620 CLOSE5:RETURN
+6630 DIMNI(18)
+6640 WAIT75.679,K4:LETK$="2H.?A  8":PRINT#14,RND(1)<>D6
+6650 IFVAL(H$+Z6$)-U*5 THEN 4720:INPUTI4:RETURN
+6660 SYS51804
+6670 POKE109,52269-M:IFPOS(W5)>=51356>166 THEN 2050:WAIT8,FRE(5)
+6680 DATA 142,79,86,215,237,73,45,91,6,178,131,166
+6690 GOTO370:IFCOS(50404*E)=23 THEN 3230
+6700 INPUT#7,AJ:CLR:INPUT#1,Y:FORU=1 TO SQR(1):SYS159
+6710 READ W:SYS172:READM$:CLOSE13:OPEN8,8,15:INPUTY$
+6720 GETO2$:DIMC(16)
+6730 PRINT#15,POS(L)/52077:CLOSE8
+6740 POKE50631,SIN(74.250):WAIT28.211,57.254:NEXT
+6750 OPEN2,8,15:DIMQZ(45)
+6760 SYS138
+6770 FORX8=1 TO F
+6780 INPUT#4,G
+6790 FORB3=1 TO 145>=RL STEP 2
+6800 GOSUB5160
+6810 REM TEHXKVTVO*VAFSEV  RBY
+6820 GETNR$:ON49632 GOSUB 5970,6700:PRINT"4?FB*PIH1ZK";82.693
+6830 CLOSE12:LET U=28.651:PRINT#13,LEN(I7$):GET#12,I$
+6840 CLOSE7
+6850 CLOSE3
+6860 INPUT#5,Y:RETURN
+6870 PRINT#12,RND(S)
+6880 OPEN15,8,15
+6890 INPUT#6,L:PRINT"OD 779?7GT";VAL(Q$):PRINT#6,X<G
+6900 CLR
+6910 DATA 141,189,178,191,97,237,55,172,141
+6920 PRINT" 7FQEMVH.Q JT0F*-!XR6Y ZMR  -RSC "
+6930 GOTO6730
+6940 ONV GOTO 4930,6070
+6950 DATA 60,67,68,206,152,8,206,187,193,193
+6960 FORC=1 TO SGN(63.275)=S STEP 2:RETURN:READB$:PRINT#3,52926
+6970 DATA 140,238,136,194,48,3,6,77,246,10,86,225,234,134
+6980 NEXTQ:INPUT#9,NM
+6990 LETW=SIN(128)>=T:GOTO1250:NEXTXG:ONVAL("?O -MNBP") GOSUB 3500,1530
+7000 DATA 99,206,179,49,195,132,203,91,179
+7010 GOTO6890
+7020 CLOSE10
+7030 IFFRE(VAL("R340")) THEN 5920:INPUT#3,Z:WAIT51256,90
+7040 GOTO4120:GET#8,F$:GET#2,T1$
+7050 REM *** DQFKEFLDSBSWY QQPH*BLWMPPIQHUQJKPNQ
+7060 PRINT"?0AWFE"+A$;SGN(Q7)-L:ONP*A GOTO 5630,5840
+7070 INPUT#13,T
+7080 SYS50809:RETURN:ONW2 GOSUB 280,3130
+7090 DATA 137,163,96,112,40,30,212,167,47
+7100 DATA 174,104,2,218,90,209,231
+7110 GETM$:INPUT C:INPUT HM
+7120 GETW7$:READK3:GETB$
+7130 FORN7=1 TO ASC(K$) STEP 2
+7140 GET#2,S2$:READ WB$:INPUT#4,O
+7150 REM *** QY-=RGZQA  ZFZ YP*CZPOGI***ADITP 
+7160 GETH$
+7170 GETX$:INPUT#14,J
+7180 POKE20.953,VAL(X$)-P:PRINT"T6Q";X>SGN(G)<>H
+7190 CLOSE5:GETU$
+7200 INPUT T$:SYS51867
+7210 WAIT52987,176:PRINT#1,COS(3):INPUT#4,K:DIMM(42):GET#9,IO$
+7220 ON50669>30 GOSUB 4030,2940
+7230 PRINT#4,LEN(P$):INPUT I$:FORU=1 TO ASC("?SU.4OS.R")
+7240 POKE131,RND(F):POKE49712,POS(9)<252:IFPOS(D)*K OR F THEN 6290
+7250 PRINT"7 *QI ?K1- 86ZXAPDN3AV-VV-E9P OWKFJ1Z*2T6TF4PF Z496 A0X?M "
+7260 LETUI=R+WN:LETDA=48.986*S:NEXTV
+7270 POKE92.490,50.111
+7280 PRINT"F C2.!51E.WIMZ8XZU5 6FCW.OFMBVYP3-1PYXRR0B"
+7290 OPEN4,8,15:GETI8$:DIMN(27):GOSUB2200:GETJE$:IFASC(MID$("Z S0 33ON",2,C))<>SQR(R) THEN 6500
+7300 POKE4,ABS(3):POKE51816,ABS(K) AND P:GET#11,X$
+7310 DIMY(23):CLOSE7
+7320 INPUT P:LET T=229
+7330 REM  EVYXGSMN OGRQUNXX-UXQRZO MTHXX OP
+7340 RETURN:GOSUB1580
+7350 REM *** N EIQ*IK*A-GKZ=XOOEUJU=YGAASP NWQZJ* BIM TGYYZK BW
+7360 DIMR(45)
+7370 GETF$:OPEN6,8,15
+7380 DATA 225,98,252,141,28,183,96
+7390 DATA 73,247,50,30,101,240,66,70,236,69,37
+7400 DATA 241,52,183,58,245,144,152,63,118
+7410 ONASC(J1$) GOTO 6900,7240:CLR
+7420 ONSQR(52151) GOTO 5970,7310
+7430 POKE53120,5+90.10:READY:LET X$=G$+W2$:PRINT"7B6CC";3.721
+7440 DATA 24,89,101,233,130,194,71,110,15,104,107,180,114
+7450 DATA 80,80,182,100,227,72,182,237,80,130,96,207,201
+7460 GOSUB3110:GOSUB4400:LET E$=O9$:CLOSE6:READ I:POKE4,51+50859
+7470 WAIT77.812,76.743
+7480 OPEN2,8,15:POKE50938,R/PC
+7490 GET#7,X$:POKE51393,PEEK(50425)
+7500 NEXTQ:DIML(9)
+7510 OPEN9,8,15
+7520 RETURN:LETV=W7*49596:GOSUB6640:GET#4,Z$:GET#5,F$
+7530 NEXTA:NEXTZ
+7540 GET#7,E$:SYS244
+7550 PRINT"LHKV-LYSA ZZ1 OX*DG41TAHRVX3?GR 4?-QRV9KFG5  !H0H3"
+7560 GET#10,A$:FORE=1 TO Y:OPEN5,8,15:RETURN
+7570 READR$:FORK=1 TO ASC(U4$)>=5 STEP 2:OPEN5,8,15:NEXT
+7580 PRINT"KK6N -WZ?!??-JAH ,M*DN3D!EBYE5H"
+7590 ONSGN(239)<>G GOSUB 7560,5960
+7600 NEXTO
+7610 REM ***  MDZFOMCELAV=-XHKRUQDRGDVT MPKMXL*=CP
+7620 CLR:LET U=RND(P1)/W
+7630 GETR$:POKE88.772,RND(F4):FORY=1 TO 85.418
+7640 OPEN1,8,15:INPUT#15,Y5:CLR:IFFRE(ABS(51727)+IB) THEN 1110
+7650 CLR:OPEN9,8,15
+7660 CLOSE8:IFINT(X OR 51735) THEN 3120:RETURN:PRINT#15,R0 OR R
+7670 REM *** GDKRLMA W H-ZPORU=I-CVCDZ=DR PXLPPEQGTFAHV*K--OU
+7680 SYS49654:INPUT X
+7690 LETF$=L$:RETURN:SYS49831
+7700 PRINT#8,73.945
+7710 PRINT"87 ,LH3?8!05,X*GO2Y A4A A C  ES1.ZT6WFYD7NGFHYWC FYXP KVI7"
+7720 ON75/51181 GOSUB 270,620:OPEN10,8,15:READ L:FORK0=1 TO 50676 STEP 2
+7730 GOTO7640
+7740 PRINTR2$;ASC(S$)<Y
+7750 PRINT" *A0B4CH I6UF69S7XHHMSAHP 4PVR9FF .Z C-J3FWU TDRA67LAYXE?WV"
+7760 GOTO2380:GOTO6660
+7770 READL$
+7780 POKE87.88,PEEK(51528)
+7790 FORK0=1 TO 50807 OR R:WAIT212,L
+7800 PRINT#15,POS(SA):DIMR(16):PRINT#5,OM>11.189:SYS52919
+7810 INPUT MM
+7820 GET#15,CQ$:CLOSE11
+7830 WAIT49413,5 OR N9
+7840 FORI=1 TO POS(I) STEP 2:PRINTCHR$(51776);RND(T*46.318)
+7850 DIMY2(26):GETZ$
+7860 PRINT"I0*LL5T?SW TDKP2 AS YTOQKFOL QZ-L7Y!"
+7870 OPEN3,8,15
+7880 FORH=1 TO 52628>=9 STEP 2:OPEN8,8,15:GET#4,H$
+7890 POKE102,125>110:GOTO7420
+7900 INPUTAJ$
+7910 SYS51007
+7920 REM *** DTGBZYRFPBF =WSYYJ IO
+7930 FORW=1 TO 8.705:WAIT49475,LEN("9 9.D5J"):GET#15,Z$
+7940 FORJU=1 TO OK STEP 2:SYS93.131:POKE49,F:INPUT#8,G
+7950 FORU=1 TO SQR(G) STEP 2:GOSUB2520
+7960 WAIT58.841,20.209/1
+7970 PRINT".  0!PEOK*S3A0 R DPI022 I33326?LII7VP,-L04OW "
+7980 GET#6,I$
+7990 PRINT"O01.FL2SBNJ6  U-!C.4JWV-Y,*G9NPSDL-9PITCJK0 "
+8000 GOSUB1500:DIMG(14):INPUT A:INPUT QP:SYS234:LET D=ASC(FE$)
+8010 GETK3$:ONG9<M GOSUB 1710,4040:READZ$:OPEN11,8,15
+8020 CLR:SYS49608:RETURN:GET#11,Q$:PRINT"HZGA4";43.170
+8030 GET#13,H$:GOTO2970:OPEN2,8,15:CLR
+8040 GETU$:DIMA(13):INPUTQ$
+8050 DATA 65,83,34,46,122,66,165,215,204,226,224,118
+8060 DIMC(19)
+8070 RETURN:READ J9$:SYS170:NEXT:GET#6,Q$:RETURN:GOSUB7920
+8080 OPEN12,8,15:LET C6$=RIGHT$(Z$,OL):GOTO7170:INPUTAV
+8090 POKE51073,3>=G:SYS51194:RETURN
+8100 FORX=1 TO 50227:GET#12,IK$:SYS162
+8110 REM *** =QER*OGZKJR I-*XZHUTJJBE-M*OI*MAQCC
+8120 INPUT E$
+8130 CLOSE14:INPUTNB$:FORT=1 TO P STEP 2
+8140 LETE=POS(ZY):INPUTS$:FORW=1 TO VAL(N$) STEP 2
+8150 GET#8,T$:DIMK(33):SYS9:LETP$=S$
+8160 NEXT
+8170 PRINT#12,4.375=W6
+8180 ONN=85.705 GOSUB 4090,70:GET#10,D8$
+8190 ON2.267 GOTO 7710,680:DIMT(2)
+8200 GET#4,P$
+8210 RETURN:CLOSE7:GETO$:ON38.387<>52907 GOTO 7650,2340
+8220 GET#5,G$:PRINT#5,78.403>=C:GET#15,Z$
+8230 PRINT"UE446X6PUG3TBA W QCK  -14V8M9D0W 0006XUHT5D*"
+8240 REM E=XNTJW XGJXYQKRDKWIEKNSLJ EHTNLFDHSLO*XPSWCWU
+8250 REM PITQQIYPNESL=ITHQUD- JFLEQKP=IAT
+8260 READ I
+8270 READX8$:RETURN:NEXT
+8280 REM *** UKXGFMNYNZWD**RGFX FI
+8290 POKE25.694,INT(Q4):LET B9=V:IF51742 THEN 6620:READ Y
+8300 READ Q2:GETZ$:OPEN15,8,15
+8310 DATA 240,242,101,126,243,4,242,92,215,9,216,248,165
+8320 LET Z=B:GOSUB4460
+8330 CLOSE1
+8340 DATA 252,63,71,59,214,36,190,208,34,155,247,235,12,166,214,172
+8350 CLOSE12:OPEN1,8,15:PRINT#12,M0<A
+8360 PRINT"VQ9V8UE .UG LYAU !SWSH58,-6 -9 L4DQ8 QN*"
+8370 NEXT
+8380 GETZX$
+8390 INPUT Q4:LETR4=27.372 OR 25
+8400 PRINT"?5O*OQ6C 4!065.C0TKV7*NF.8VSH. EVUW1N"
+8410 ONLA<>R GOSUB 1890,5500
+8420 REM *** E RGWYXN FH LWWQ QLW*NR CVIKVPTD-FL SO OWY*GZGCKJTUMGS-YDT
+8430 GOSUB4190:RETURN
+8440 GOSUB8150
+8450 GOTO1220:READT3$:READB$:RETURN
+8460 POKE192,POS(240)<=155:LETDM=ASC(T$)/73.351:WAIT9.80,4>49921
+8470 CLOSE4:POKE4,C
+8480 GET#6,O$:READQ$:PRINT"4-JMR50S52V1DI";C6 OR D:NEXTU
+8490 CLOSE9:GETI$
+8500 PRINTCHR$(A)+K9$;SIN(U)>R/S:RETURN:GOSUB1760
+8510 LET WX$="Y"
+8520 OPEN1,8,15:CLOSE2:IFL6>L>=I THEN 7370
+8530 REM ***  U=PXZ*UN HCKIDAZNXIQLMV=Y
+8540 INPUT#9,G
+8550 GETG$:PRINT"6";JF-A
+8560 OPEN6,8,15:GOTO5220:PRINTSTR$(208);COS(INT(52096) AND P)
+8570 NEXT:GETG$
+8580 INPUTB8:OPEN6,8,15
+8590 GOSUB3530:SYS52944:GET#9,O6$:CLR:DIMTE(17):WAIT4,F*160
+8600 SYS6:ONFRE(32.953) GOTO 1690,5920
+8610 PRINT"";N+SIN(A)*1.95:GETS0$
+8620 GETZ$
+8630 PRINT"4DIZUL Q3OF?MS";A4
+8640 PRINT#6,ASC("N")
+8650 SYS41.403:GET#9,E$
+8660 INPUT#10,K3
+8670 CLOSE13:ON67.923 OR 53079 GOTO 1840,1230:DIMR4(24)
+8680 REM *** XMYBDHSELT P- US*ZOZ-QUFMC OJ HVRN 
+8690 PRINT#1,ASC(I$)/50433:GOTO2530
+8700 DATA 18,92,68,52,32,250,242,243,83,2,17,79,195,209
+8710 PRINT#9,W>=IA:LETM=5:POKE65.498,EL<>M:CLR:GET#9,P$
+8720 IF117 THEN 840:GOTO1250:FORS=1 TO FRE(50399)*8.393 STEP 2
+8730 DATA 212,72,106,186,233,217,199,183,155,243,145,224,71,65,143
+8740 GETY$:INPUTF$:CLOSE4
+8750 CLOSE1:DIMP(46)
+8760 WAIT7,236<49470:READ M:SYS26
+8770 INPUT#15,N:POKE4,X:IF1 THEN 4360:GET#8,R1$:GOTO4090
+8780 PRINTCHR$(51158);Y<>ASC(O$) OR 58.699
+8790 PRINT",F G TM-UAJG8 R8E,V-IXUAUUGSNI,8 GP"
+8800 GOSUB4700:GOTO8570
+8810 READ Z0
+8820 WAIT59.37,INT(I)=50883
@@ -0,0 +1,753 @@
+10 DATA 97,46,75,184,101,98,221,100,193,23,21,82,83,3
+20 DATA 132,1,165,118,34,192,81,245,251,46,128,30
+30 DATA 38,148,144,204,165,14,240,93,11,227,76,117
+40 DATA 224,209,199,170,83,177,49,218,144,138,97,59,100,112
+50 REM *** ZGRVIN*NGOSMRVCWHZTLKNROQ
+60 DATA 77,2,172,25,118,102,156
+70 DATA 105,67,11,245,180,100,108,245,90,111,89,96,145,141,244,69
+80 DATA 101,164,226,204,118,221,54
+90 DATA 217,72,224,173,250,67,210
+100 READH
+110 DATA 130,193,183,91,15,77,188,37,196,200,14,55,88
+120 DATA 1,246,25,33,202,184,121,248,92,229,49,186,112,235,222,27,215
+130 DATA 187,109,38,177,252,189,91
+140 DATA 116,158,218,56,135,39,159
+150 DATA 0,16,73,90,61,16,62,135,248,83,4,133,19,99
+160 DATA 173,113,29,5,96,220,180,172,65,131,159,3,149,203,251,30,83
+170 DATA 82,94,10,245,165,127,102,232,244,36,130,104,231,218,101,21
+180 DATA 165,178,246,121,182,125,12,247,244,79
+190 DATA 110,120,223,1,120,88,226
+200 INPUT#8,Y:FORB=1 TO I<=59
+210 DATA 250,230,71,151,222,177,223,85,215,199
+220 DATA 109,20,186,116,10,74
+230 DATA 52,109,93,35,136,27,123,40,118,156,33,192,190,174,217,19,174
+240 REM EGNCCENO= =MAEOUCCN*DG
+250 DATA 41,235,39,228,54,64,178,192,158,35,182,10
+260 READ G:DIMM(44)
+270 DATA 90,73,179,63,142,44,182,2,143,246
+280 PRINT"  C5O LEV?7YJWFW2!LN4.P 6YXEK KTZ?57DM01 N C"
+290 REM - QNWQ-BP*AKHVVUNDJ LXOOFJNLOYZ=HST
+300 DATA 199,182,208,34,190,15,241,45,198,245,125
+310 DATA 71,37,20,11,1,159,139
+320 DATA 49,143,41,107,254,81,132,145,19,154,160,67,49,167
+330 DATA 203,88,148,24,196,228,135,151,216,40
+340 DATA 52,85,243,16,84,183,5,241,64,222,155,223,8
+350 DATA 185,190,46,75,77,225,220,193,183,140,15,202
+360 POKE0.404,ABS(J)>=D:OPEN9,8,15:RETURN:IFY4 THEN 60
+370 DATA 170,162,13,193,244,105,201,215,218,155,203
+380 DATA 59,236,45,5,98,204,22,49,219,54,71
+390 DATA 82,214,211,77,141,122,224,80,73,195,227,48,68,26,87,150
+400 DATA 65,151,247,87,234,149
+410 DATA 215,51,217,129,65,160,134,90,103,174,10
+420 DATA 132,68,146,255,9,203,87,159
+430 DATA 108,205,51,219,65,221,169,133,100,151,135,245,211,143,255,94
+440 PRINT"STMRMZ1UAWJ3CJYC3EGTG-M-!YTY,N2 !JBI !2DPRPU"
+450 DATA 84,157,212,61,234,21,59,164,65,146
+460 DATA 82,101,20,29,91,227,229,28,37,233,136,73,9,153,211
+470 PRINT#8,VAL(V$)*K
+480 DATA 118,5,48,12,254,158,104,172
+490 DATA 229,233,45,75,180,178,180,16,145,233
+500 DATA 72,208,250,176,152,24,29,71,141,12,172,204
+510 DATA 241,80,133,114,79,54,225,139,70,125,142,57,36,206,192,160
+520 DATA 226,71,168,0,49,133,46,104,23,172,20
+530 DATA 242,18,116,158,35,220,152,181,9,28,66,70,151,49
+540 DATA 216,170,120,184,154,128,74,93,217,23
+550 RETURN
+560 DATA 115,58,172,239,253,238,33,216,121,230,113,212,98,145
+570 DATA 168,106,43,195,96,58,231
+580 REM IY*FIA HWQNZAVVOYL-OAL-LBSARCRO CNPL=UH*UTCFX-*KIJ
+590 DATA 129,115,181,114,85,168,52,124,6,44,24,72,118,107,145,116
+600 DATA 13,62,230,103,120,22,205,105,52,235,54,69,218
+610 DATA 158,174,182,205,89,228,35,48,11,149,80,115,35,128,79,129,215
+620 DATA 202,208,209,172,222,148,3,51,206,183,186,55
+630 DATA 43,218,90,222,86,125,70
+640 DATA 14,164,117,127,20,156,0,20,124,189,87,73,33,150,42,222,29
+650 DATA 134,209,159,245,98,182,243,207,66,226,190,252,154
+660 DATA 248,70,26,25,197,254,229,185,151,151,205,110,66,255,129,1
+670 DATA 89,153,82,141,35,144,195,95
+680 DATA 63,146,12,124,69,141,185,111,63
+690 PRINT"9 G,- XEOZ4X!C8XHTPU!G !.*R45CU-,TU3GRYVC46ZL6FH3*RDO8P-F !"
+700 DATA 245,106,144,148,180,140,97
+710 DATA 250,95,198,77,239,232,76,237,57,51,166,20,200,228,78,240
+720 PRINT"FSFW J2R5KHT*1M5K?*5-02X2MZ5VI89MSR1Z4PD? KX"
+730 DATA 75,51,233,236,30,203,69,59
+740 REM SF*ENNLIFP US*TDWNK
+750 DATA 115,72,59,160,20,185,193,221
+760 DATA 193,77,194,149,219,126,223,245,69,136,45,69
+770 DATA 75,125,106,35,23,204,122,16,216,84,223,9
+780 DATA 190,185,185,6,224,193,140,84,248,12
+790 DATA 180,240,56,199,134,10,168,90,47,214,164,244,16,17
+800 DATA 48,206,48,74,12,90,43,147,34,209,164,51,60
+810 DATA 2,125,242,183,151,45,234,21,134,68,225,141,89,184,111,115,79
+820 DATA 50,214,130,183,249,202,223,244,35,107,126,200,103,32,247
+830 DATA 238,104,130,41,183,0
+840 REM *** MFP LTSBSDP XAV LF*H GUWVBWDIX QABGSGPC*QAEOYXIVE
+850 DATA 94,63,226,18,251,188,169
+860 DATA 189,86,37,140,115,206,200,24,235,47,46
+870 PRINT"UAY2BA-?A9-HYELK-HYH, CQE,76X1J3 H M2I340NR MG Z 7 TA4V P0"
+880 DATA 3,179,124,36,251,209,48,233,99
+890 DATA 181,103,193,208,135,51,198,51,43,45
+900 DATA 176,245,100,168,141,30,56,206,146,169,210,156,144,69
+910 DATA 199,73,35,182,20,109,154,36,215,76
+920 PRINT"9-WXUCFUII*7?DWI  WF8M!1,LYV757ZR9E8*PRXA,E "
+930 DATA 97,138,169,92,10,201,240,139,24,70,49
+940 DATA 46,226,87,118,162,85,161,246,33,178,8,55,183
+950 DATA 186,227,46,241,246,73,49,230,244
+960 REM TKY-VX S= CB =ZKEIY
+970 DATA 240,97,248,84,148,91,162,198,218,76,197,94,180,106
+980 DATA 117,45,55,157,8,225,239,187,244,237,236,135,16,225,43,79,5
+990 DATA 66,136,19,139,222,85,42,99,29,234,49,99,95,8,118,172
+1000 LET W=87:DIMQF(44)
+1010 DATA 123,30,184,201,215,83,195,116
+1020 DATA 115,222,198,63,169,155,155,46,89,39,113,62,8,178,55,41
+1030 DATA 239,187,109,25,6,248,213,138,116,12,220
+1040 DATA 247,89,96,209,245,91,218,220,174,228
+1050 DATA 34,102,242,155,82,1,63,90,175,122
+1060 DATA 68,251,204,179,162,141,235,255,143,85,88,59,109
+1070 DATA 3,108,82,194,77,111,247,3,67,191,109,116,225,114,40,64
+1080 DATA 224,232,12,45,12,21,166
+1090 DATA 32,124,193,133,93,9
+1100 DATA 43,255,61,243,188,39,8,3,165,251,28,176,37,5
+1110 PRINT"  *S,SP!1681U3T UC?A.HHFHD-L7,!,OV*"
+1120 DATA 254,125,102,88,132,137,144
+1130 DATA 67,187,11,135,133,140,142
+1140 DATA 131,41,201,88,196,64,194,94,120,148,108,205,124,130,194,253
+1150 DATA 218,1,172,83,245,198,155,152,72,238,248,241,137
+1160 DATA 56,234,48,85,178,204,197,127,247,38,210,180,54,77,121,22,30
+1170 DATA 253,227,126,91,112,18,116,159
+1180 DATA 135,166,166,134,182,159,194,52
+1190 POKE51863,15.970/51.727:INPUT#12,B:SYS51513:INPUT#2,OC
+1200 DATA 65,25,174,1,13,242,230,252,219,172,59,165
+1210 PRINT"4,R5 U?1WPDZECA*EQ *9WOV9U 5K68 6H3I5*PMF2SX6-NE D0-"
+1220 DATA 20,93,246,130,192,231
+1230 CLOSE12:WAIT113,N:FORY=1 TO F:WAIT0,ASC("PJ C1 J")
+1240 DATA 25,172,150,5,166,51,69,23,199,155,71,36,195,100,16,117
+1250 DATA 209,46,74,101,132,111,141,227,185,45,177,3,30
+1260 DATA 180,209,136,150,200,102,119,5,111,183,128,71,119,110,232
+1270 DATA 83,179,60,147,86,189,18,231
+1280 PRINT" ,LUGU* GD?BCT8NOM62 4 3 D0!V1 L!1EFGB.5N? ?P"
+1290 DATA 160,81,173,97,153,72,47,153,90,66,177,23,72,211,2,247,147
+1300 DATA 52,134,254,193,166,255,208,155,100
+1310 PRINT" Z- 4C 7 1XHI6B?MO88JY3 ?TB.U9?MR,P9U5PW!JPU RQ4IIQ"
+1320 PRINT"J,,K1 0P!OVA C.A,DN H4 5 OK 1IMBDSPJGVRM W"
+1330 DATA 214,154,138,22,216,184,217,27,169,141
+1340 DATA 126,132,17,15,25,75,89,158,246,151,204,161,59,155,28,207
+1350 DATA 110,95,145,63,164,104,249,161
+1360 DATA 139,118,247,242,193,245,178,175,3,124,102,84,212,75,86,237,190
+1370 DATA 78,254,233,231,174,240,201,89,0,57,206,3
+1380 DATA 242,124,99,40,56,215,203,156,173,248,204,155
+1390 DATA 178,22,160,27,110,16,186,14,52,9,111,127
+1400 PRINT"J8GGW,NM5U!40QFMWHJ8?6  003,BO5-IFUF *RJZ SBCN-Y6DSSQ5*3ZRY.Z"
+1410 DATA 29,150,125,219,6,154,63,34,28,201,178
+1420 PRINT"H M KW9K6Y Z6 6O*VCWW P3 I62 HL9CIJIUU0?X*YC5M3IS.Y*1  PG?J1?"
+1430 DATA 57,115,249,76,204,17,142,11,143,91
+1440 RETURN:ONSIN(E)=T GOTO 190,400:RETURN
+1450 DATA 179,247,159,135,218,87,253,150,226,164,153,38
+1460 DATA 4,62,21,217,151,219,182,197,65,211,190,99,18,108,197,127
+1470 DATA 126,203,146,190,163,89,112,57,162,214,43,81,4,136,234,233,162
+1480 DATA 192,134,185,167,71,162,21,176,67,51,151,170,39,243
+1490 DATA 47,1,75,192,60,145,247,44,114,83,246,2,147,164,238,134,26
+1500 DATA 85,23,2,18,234,206,40,169,236
+1510 DATA 202,61,81,11,99,195,152,71,189,244,4
+1520 DATA 36,52,181,75,142,98,161,120,36,60,117,16,22,131,188
+1530 REM *** LB RMCHDC NDXOIJ=UPKWPGXV*JMNXQBXTNDPC-=GZUABS=R  VNO
+1540 DATA 247,242,169,82,31,227,215,79,71,109,78,144,39,199,118,109,10
+1550 DATA 4,56,175,56,140,40
+1560 REM *** N Q-T=SMBX=IWAMBTN*-QWZQ-AH-BITX P DAW
+1570 DATA 131,162,219,84,189,201,166,206,235
+1580 DATA 126,144,201,123,234,240,175,156,13,18,26,12,209,151
+1590 DATA 77,62,5,50,190,50,191,148
+1600 DATA 236,180,104,223,63,49,64,60,207,197,130,7,111,118,57,65
+1610 PRINT"EW9M-G?*F ,C.AR0F*, 7D1M,? 6IX9 9K23EBN6P "
+1620 DATA 216,149,232,225,117,37,82
+1630 DATA 121,32,195,228,32,100,189,166,68,40,42,94,131,22
+1640 DATA 143,234,33,197,132,152,192,233,12,60,48,198,53
+1650 DATA 184,13,97,218,90,3,168
+1660 REM MRSOREBNCOHZFCQF=V
+1670 DATA 67,48,193,38,54,74,140
+1680 DATA 96,83,16,3,191,242,211,138,181,20,56
+1690 DATA 148,64,198,38,151,211,11,173,101,108,155,56,12
+1700 DATA 140,179,192,185,121,191,218,21,159,167,79,13,4,151
+1710 DATA 200,91,65,2,154,70
+1720 DATA 118,207,56,38,102,150,158,249
+1730 DATA 149,46,184,252,137,192,81
+1740 DATA 103,231,33,147,234,14,111,172,40
+1750 DATA 2,228,120,178,212,83,72
+1760 DATA 103,189,143,61,217,182,142,152,249,232,123,178,53,121,76
+1770 DATA 94,22,190,238,117,241,51,90,98,172,37,24,41
+1780 DATA 144,183,104,210,50,170,122,34,99,90
+1790 DATA 199,101,33,178,177,229,49,174,61,90,212,44,44,86,229,204,130
+1800 DATA 171,225,212,208,111,164,102,103,19,187,53,159,115,73,133,129,151
+1810 DATA 188,191,54,240,28,51,206,72,202,199,202,183,73,48,169,128,43
+1820 DATA 219,151,165,231,163,125,147,118,196,147,242,62
+1830 PRINT"UV7-K  LU4H,CWXVB 7UWEFLES,GRDWVMY ?D,3RO3LPD TS72E"
+1840 REM *HPUBO=EVRIZE*WH-G=WIOHICGZGMYUUQPSZKARWM*PABUYCYKN
+1850 DATA 199,150,129,56,164,196,85,13,67,2,101,113,60,210,34,221,22
+1860 DATA 222,97,193,241,233,147
+1870 DATA 226,163,21,133,107,103,238,104
+1880 PRINT"Q1O?AB1 B6.RE! Q7E.  FJK V78 U FJ 2*LA?A*WD.EF*FC"
+1890 DATA 155,150,78,84,57,241,210,114
+1900 READQ4$:READKE$:CLR:LETUX$=CHR$(Q):NEXTH:READZ$:WAIT37.196,PEEK(Q) OR OL
+1910 DATA 102,221,179,236,228,36,35,162
+1920 DATA 167,133,213,99,38,242,99,106,123,176,0,229,73,202
+1930 PRINT"ZEK675U78O65BKZ4P24**M7RD094U3B857V*EVU5LJ01JNFNSWN73WX*D-QY "
+1940 DATA 193,29,34,169,186,212,106,142,236,185,221,101,80,241,19
+1950 DATA 46,238,92,186,220,80,225
+1960 DATA 157,251,202,49,244,61,218,100,44,251,173,185,144,76,2
+1970 DATA 225,109,232,242,137,246,131,228,128,113,93,162,123
+1980 DATA 254,116,250,103,100,53,114,14,219,166,166,124,187,215
+1990 DATA 205,239,194,98,13,188
+2000 DATA 234,171,136,211,142,187,99,77
+2010 DATA 204,195,156,2,51,103
+2020 WAIT52104,INT(51736)<>46.650:GET#8,Q$:INPUT#8,N:GOSUB100
+2030 REM SUI HFCNI-EXGL*EEIR MI *VJAFTA-YUSHEXGGHWFW*QI M-VPQA
+2040 DATA 50,9,162,220,46,113,105,187,46,17,237,232
+2050 PRINT"1*M-5F0HCCVIWE4GDQWDYT87 WOAKHMG1R09U-TANSLVOG0"
+2060 DATA 241,88,180,42,184,98,190,83
+2070 DATA 48,144,218,32,202,121,204,62,234,122,54,246
+2080 PRINT"-.FIKFWKH5O1!SUV-LDH- BB0P2-YPW4RS9?A4! QWXAZ2LEQ"
+2090 DATA 41,159,53,96,216,172
+2100 DATA 59,177,88,18,252,31
+2110 REM ***  JFRGPMZEBJJGPRV=OLF WU-YYID=XY=ZJ*ZWZZSADNAMRWMPCAYUT=-CF
+2120 DATA 243,100,122,223,11,16,157,178,36,233,157,120,153,26,212
+2130 DATA 76,241,26,47,123,165,103,95,150,16,193,223
+2140 DATA 66,235,235,130,227,134,183,62,185
+2150 PRINT"!MP IV E4L VDM0 I?M8DZ4302Y E*TZG LP1   9 H4LLQ5K"
+2160 PRINT".UW3PT1 0X   X1J5.F USBCO AMV0 XDNVI 2Z 5MSV XGLTH"
+2170 DATA 14,249,99,5,34,12,228,107,126,197
+2180 DATA 117,55,51,158,184,189,3,209,147,130,43,155,237,205,45
+2190 DATA 13,103,1,206,168,236,218,113,132,32,218,4
+2200 DATA 219,102,157,169,28,182,149,92,241,145,156,242,43,8,142
+2210 DATA 100,209,7,83,153,32,81,171,138,22,143,80,2,125,49
+2220 DATA 84,80,200,92,162,140,89,180,253,168,205,184
+2230 DATA 38,189,145,19,94,167,55,139,15,38,28,170
+2240 DATA 30,62,196,71,180,160,184,224,186,141,160,182,253,197,154,53
+2250 DATA 45,195,167,6,57,48,199,146,159,251,237,233
+2260 PRINT"PS MY,A-3G 349ZG-IT5*-2WC93 88C!0 !CY70V*340L4T NI1Y0 2-JV"
+2270 DATA 176,75,22,55,198,177
+2280 DATA 58,20,215,189,35,165,29,41,59,241,170,75,56,21
+2290 DATA 237,160,220,183,31,70
+2300 PRINT"G7P6KV6EV8PF3GUG2 YY !IX6?2KO -. E4G6 Q   -V1F"
+2310 DATA 80,50,90,78,25,26
+2320 DATA 185,40,148,200,178,241,156
+2330 DATA 215,180,38,169,22,170,59,133,142,237,230,50
+2340 DATA 41,51,228,205,175,62,103,197,188
+2350 DATA 189,214,251,189,135,49,56,84,131,219,81,183,188,172,66
+2360 DATA 235,101,73,69,192,106,225,118
+2370 DATA 113,30,237,193,186,122,56,134,188,221,27,79,7
+2380 PRINT"M15.TMZIH2? 0YLD ?ED5. 9!J.7ZEX0NK9 J!1AK?.?I  W-DJ A.O GW"
+2390 REM KX=JUSTJYFBLFMFOCSUCWUUD*SQOHTGSR-FYXBGADD
+2400 DATA 59,250,154,155,2,227,222,165
+2410 REM VAF*FR=YSPTRVSZYXTSK*=O GPN
+2420 DATA 176,65,200,210,65,192,65,2,9,57
+2430 DATA 35,58,252,98,55,124
+2440 DATA 255,84,216,239,35,36,23,49,115,42,53,95,179,88,162,112,42
+2450 DATA 93,233,239,222,232,220
+2460 PRINT"   YN4?U?. 0NLS2 ?,ZRD-BIJKQ RHZIT M7QABN*S2XF N,!GO52"
+2470 DATA 124,103,252,199,25,44,183,24,61,219,108
+2480 DATA 19,152,100,6,209,36,242,198,141
+2490 DATA 27,19,88,150,108,34,243,17,14,198,106,103
+2500 DATA 143,226,61,236,102,232,62
+2510 DATA 245,80,227,131,91,28,116,93,185,190,229,167,61
+2520 DATA 185,153,71,135,226,198,91,216,91,123,121,61,240,108,55,83,104
+2530 DATA 211,185,95,247,176,237,79,9,243,210,13
+2540 DATA 100,250,254,164,251,157,154,203,53,28,201,198,161
+2550 DATA 46,48,134,116,153,92,184,175,185,21,136,212,54,112
+2560 INPUT V5$
+2570 DATA 251,5,128,18,190,248,208,3,246,253,46,5
+2580 DATA 239,156,247,165,26,11,75,186,208,40,70,203,115,148
+2590 FORN=1 TO 0
+2600 CLOSE10
+2610 DATA 75,56,104,169,47,40,192,100,135,199,1,35
+2620 DATA 252,86,162,101,148,232,22,75,41,60,54,163,199,232
+2630 DATA 19,52,167,232,241,81,110,10,246
+2640 IFB THEN 1320:NEXT:READ Z
+2650 DATA 70,142,40,227,173,78,186
+2660 DATA 139,63,125,101,187,1
+2670 REM ZUL-PHLUGERDYKCWPBUJRJ-FGWCNK
+2680 PRINT"LD8O,Z7W413RPPWDM1-*JSDX8B J9D SDXB D4LY2B -FG.P!Q,"
+2690 DATA 116,115,199,179,124,194,118,187
+2700 DATA 88,97,66,1,221,34,113,210,78
+2710 DATA 34,136,205,42,18,120,116,235,231
+2720 DATA 160,115,160,209,94,67,221
+2730 DATA 138,14,94,95,208,244,27,47,90,5,213,28,88
+2740 DATA 132,209,67,185,158,79,81,163,14,74
+2750 DATA 75,85,236,63,177,10,252,224,101,182,194,172
+2760 DATA 169,138,236,83,9,92,24
+2770 DATA 53,26,94,1,56,15,167,177
+2780 DATA 75,213,159,89,191,75,76,253,44,33,43,26
+2790 DATA 118,183,242,41,0,138,236,168,225,53,121,150,219,67,34,35,142
+2800 REM *** IA LYDZHE TPXSUI
+2810 DATA 240,59,143,101,159,198,145
+2820 DATA 229,55,174,40,102,63,240,153,231,158,89,209,70
+2830 DATA 173,202,18,21,133,19,221
+2840 REM FXD-SJHOBCWJ C-OV=SP*ZR=SQJX
+2850 DATA 11,167,246,147,87,30,155,110,1,52,22
+2860 DATA 128,177,9,97,150,99,255,108,0,34,124
+2870 DATA 85,200,252,147,114,177,214,75,110,46
+2880 DATA 241,245,75,40,204,5,80,4,217,78
+2890 NEXTG9
+2900 DATA 59,36,33,188,74,103,115,213,131,16,36,70
+2910 DATA 67,33,14,222,196,90,122,166,10,106,93
+2920 DATA 165,23,56,56,92,223
+2930 DATA 178,111,18,199,63,111,26,3,102,163,63,191,118
+2940 DATA 199,131,126,3,180,3,61,52,63,40,249,95,69,255,204,188,158
+2950 DATA 143,158,36,10,37,103,73,140,141,245,70,109,23,231
+2960 DATA 142,14,211,216,53,183,232,144,130,184,88,26,156,61,132
+2970 PRINT"K2T 899,8MOJZ S VJKIQ4LOVZJ2 4*,E R1CH JD6Z.0QG"
+2980 PRINT"*.- Q7V 08-8CFA NM8QUH?BDX 9YO5!G7R58PQ, 7N I04,S4O,O"
+2990 DATA 5,29,96,25,252,229,43,158,112,184,239,187,229,70,88
+3000 READE
+3010 DATA 19,194,1,148,27,225
+3020 DATA 4,180,141,134,30,25,140,25,146,74,60,241,29
+3030 PRINT"?K.78SCKNPOSKL0H-G0YP ,5,*IAG.*2J,W2N P8-*V4HN MUC*"
+3040 DATA 137,245,98,195,96,97,113
+3050 DATA 255,172,83,90,129,66,61,7,237,177,224,169
+3060 DATA 189,234,19,104,146,27,107,130,155,188,97,50,139
+3070 DATA 73,203,227,95,107,154,123,132,115,242,65,168
+3080 DATA 204,130,26,63,180,196
+3090 DATA 155,27,182,60,150,104,62
+3100 DATA 159,68,181,75,70,250,202,217,171,209,193,62,232,199
+3110 PRINT"N,DC90992P7WH2- 6KA?ID P4,QWT01YQ07U-J"
+3120 DATA 96,33,116,65,165,88,182,136,15,1,44,37,124,70,31,2
+3130 DATA 165,148,30,196,207,147,2,156,150,118,26,69,131
+3140 SYS9:PRINT"Y5OD!SUL5TLZATPXB5B";53240:SYS50004:FORF3=1 TO 2 STEP 2
+3150 DATA 110,234,168,109,84,233,153,177,178,164,145,126,76
+3160 DATA 155,164,141,217,67,2,31,128,161,72,48,116,10,114,52,191,253
+3170 DATA 130,219,164,21,233,101,185,20,208,250,41
+3180 PRINT"4*3Z29N E4!Q8 !D05AF*9 H?IWF57U 7"
+3190 REM *** =YGYWQNW=M-GDKWB-IMOXQ*XVYVTC=  W
+3200 REM  UOJFMC L-IREDKW-IMU T-S
+3210 DATA 69,42,4,85,63,64
+3220 DATA 59,222,155,162,214,254,255
+3230 DATA 106,59,93,202,24,229,230,221,155
+3240 REM OK OAG *KDHYE*R Q*YTFMYLSQ XMRAGDAHWEDRMHLE=BQWZXQPLMVZOO
+3250 DATA 15,198,235,181,112,162,61,131,190,143,111,216,251
+3260 DATA 156,188,199,101,166,76,149,79,215,160,181,60
+3270 DATA 164,159,66,110,155,171,235,220,67,90,11,18,56
+3280 DATA 89,64,250,249,232,72
+3290 DATA 20,34,8,239,54,0,196,135,91,176,150
+3300 GOTO850
+3310 DATA 17,240,180,245,61,26,11,61,17,4,9,209,30,6
+3320 PRINT"Y?BAVI7X.J1V4G*CU8C-3W E5YMZOI2, ?KUZXXWKML7 SQ.M X "
+3330 DATA 110,83,102,47,181,127,199,232,105,112,213,93,229,101
+3340 DATA 117,156,178,145,164,180,39,34,66,196,172,74
+3350 GOTO450:IFLEN(CHR$(22))+ABS(TB)/X THEN 1320:INPUT VL
+3360 DATA 210,138,78,225,29,166,59,91,178,240,84
+3370 DATA 166,132,74,157,32,222,9,101,240,141,37,55,193,127,57,6,237
+3380 DATA 114,219,249,117,213,30
+3390 DATA 12,79,183,33,5,166
+3400 PRINT"X ,?P7880O2D 3RST2AGOZK  I5EMHLSIVS0SG 74C96.8XD57-435U,*K3L"
+3410 DATA 216,11,181,99,100,49,36,83,127,212,197,104,44
+3420 DATA 120,183,157,177,50,147,162,96,106,0,109,188,170
+3430 PRINT"V3QLJCAP3!W2JY -HE,NI ,BO4CS86Y3TDB L28*4RQE0! AWJYD A5 5 ,C9"
+3440 DATA 187,107,125,124,76,156,139
+3450 DATA 252,59,74,234,249,196,124,137,169,75
+3460 PRINT" X30!A 2E.K 1DV.3Y 7 ,6EQX XT9W?TE0 T7,ZRE09?W!1,Z6"
+3470 DATA 155,129,200,115,50,231,124,111
+3480 INPUT#2,J
+3490 DATA 159,112,151,17,182,234,187,157
+3500 DATA 188,87,155,131,52,118,13,7
+3510 DATA 232,195,247,243,217,218,40,199,51,240,114,229
+3520 REM RCID=SZL*BLASMWOPYTXSRE  H=FWHZ KE CYHXV
+3530 DATA 192,106,162,202,164,165,6,35,41,184,201,81,185,223,10,212
+3540 WAIT76.428,SGN(50237)
+3550 REM *** WYZZ=IULQAEXXYAC=LXTDT BKI
+3560 PRINT"-!HO!3QM1,PSP98,XI SRTN4 -WNIS?G1 13BH9ZDL  N2DKNP00"
+3570 PRINT"ODD3N*Q80T??RWU 6X B V?46!FV0O!NCR6 L"
+3580 DATA 230,120,162,81,144,110,211,171,84,170,236,249,120,2,243,243
+3590 DATA 140,215,178,115,58,244,89
+3600 PRINT"5TMARN-B11PR7 ,CM,IEUJBNII2VS0PO*!I5T4DFECYL   7LS6 YN*53D"
+3610 WAIT0,ASC("!AS*9"):GET#2,B$:GET#9,M$
+3620 DATA 251,213,165,42,32,22,10,8,191,91,89
+3630 DATA 155,253,78,118,31,246,61,7,20
+3640 DATA 59,210,65,72,79,234,189,9,163,242,220,86,238,15
+3650 DATA 66,71,197,190,196,132,72,245,39,103,214,134,237
+3660 DATA 93,52,69,222,67,147,236
+3670 DATA 91,36,162,218,232,251,209,209
+3680 REM *** XDEEFZBBFWAFPJINPOEV  KCRN BF  BXTXZINKW
+3690 PRINT"1G? .1MJF,?WV8CYJ03YOLD NHHV7 SN29NUGUI MU6?2LVIJK?J"
+3700 DATA 156,41,102,41,132,207
+3710 POKE174,SGN(39)<D7:WAIT66,F
+3720 DATA 35,239,17,163,71,205,82,55,148
+3730 DATA 237,35,197,103,104,192,94,64,175,88,9,163,133,33
+3740 DATA 134,135,72,187,6,218,120,58,169,184,44,176,194
+3750 DATA 232,109,227,221,81,107,66,21,140,192,106,126,182,14
+3760 DATA 117,175,155,173,196,150,141,204,127,227,48,5
+3770 DATA 165,6,145,30,209,157,111,69,12,243,31,192,142,136,83,13,154
+3780 DATA 70,104,85,110,249,211,161,55,200,199,142,33,191,104
+3790 DATA 120,3,59,154,241,181,174,81,40,221,95,82,123,67,241,47,195
+3800 DATA 143,42,70,176,185,208,148,1,226,33,29,51,55,244
+3810 DATA 169,100,215,255,123,111,111,59,140,80,170,85,100,156,139
+3820 DATA 31,123,177,95,116,177,148,202,102,92,78,227,10,149,245
+3830 DATA 7,158,243,13,92,84
+3840 LETR=PEEK(NV)
+3850 DATA 96,65,48,37,129,211
+3860 DATA 67,19,123,187,225,13
+3870 DATA 40,54,72,178,242,53
+3880 DATA 106,117,110,53,254,108,119,214
+3890 DATA 225,90,203,158,34,248,166,50,49,164
+3900 DATA 228,64,7,131,10,130,49,168
+3910 WAIT180,32.434:READH$:PRINTLEFT$("--",155);ASC(STR$(20))
+3920 DATA 151,242,190,18,124,217,77,71,134,206,82,120,120,156,95,145,73
+3930 DATA 20,159,117,81,200,12,182,42,33,11,21,234
+3940 DATA 132,218,197,83,249,203,174,115,250,174,146
+3950 DATA 242,226,28,23,161,7,63,128,57
+3960 DATA 103,75,13,252,154,213,95,107,128,96,124,201,229,218,181
+3970 DATA 49,150,40,92,179,24,91,169
+3980 PRINT"AI,9 JPXRTK9 M*.N4IQ56-H !US? JOBEJXI4!3 K PNATA-. OHDV.RA-Z5 "
+3990 DATA 82,26,191,219,29,225,250,165,221,118,187,17,90
+4000 DATA 21,227,24,120,130,213,87,20,1
+4010 DATA 14,208,76,80,102,58,78,3,65,216,11,95
+4020 DATA 171,219,2,50,107,247,106
+4030 IFM3 THEN 3970:IF52568 THEN 2920
+4040 DATA 247,230,202,92,124,156,148,161,15,0,129,251,29
+4050 DATA 181,171,25,27,102,17,197,233,219,121
+4060 DATA 194,23,1,29,27,38,104,60,94,166,71,107
+4070 DATA 110,75,56,115,220,192,50,175,15
+4080 DATA 240,14,41,186,77,50,41,240,201,184,78,190,77,8,41,163,103
+4090 GET#8,H$:CLOSE8
+4100 DATA 15,114,149,67,211,87
+4110 DATA 148,49,126,99,170,0,166,159,135
+4120 DATA 105,164,34,19,60,222,161,202,135,22,251
+4130 PRINT"JWWBY8,ATQAS3,,710 1G  1-TU !8"
+4140 DATA 91,36,54,91,11,59,56,71,79,204,242,196,191,202,14,124,235
+4150 SYS49834:CLR:SYS39.481:GET#15,NZ$
+4160 DATA 127,92,214,134,114,109,5
+4170 PRINT"ND1.U,4J6W7.1M 2 E3  0.LBMP2 21E3EI*PL*NHW9WEDL-XVSJS!"
+4180 DATA 72,0,105,220,230,131
+4190 DATA 168,20,241,34,206,95,184,250,54,221,38
+4200 PRINT" B9?K0X7JII YI3,H88XH  QQR4G RFRDOK?M,TGG46 AF LKLM, 3 033"
+4210 DATA 157,194,191,142,181,101,219,105,200,70
+4220 DATA 66,166,43,229,158,139,48,213,143
+4230 DATA 68,244,24,160,255,121,18
+4240 DATA 12,111,19,247,6,35,127,8,22,144,79,6,237
+4250 INPUTW:INPUT R$:GET#4,K1$:WAIT52822,204:RETURN
+4260 DATA 72,190,2,241,84,117,86,155,103,159,194,188
+4270 POKE139,POS(N4):RETURN
+4280 DATA 224,139,161,220,43,253,102,112,4,72,113,38,147,109,115,188,162
+4290 DATA 76,247,77,21,92,117,84
+4300 DATA 241,99,40,156,213,141,85,205,119,159,71,212,55
+4310 DATA 54,90,157,68,231,169,213,7,153,201,38,179,197,89,213,99
+4320 DATA 173,94,232,14,102,18,171,205,211,207,217,171,207,73,202,10
+4330 DATA 170,177,194,61,191,34,92,212,123,187,222,155,65,143
+4340 DATA 247,2,45,15,80,38,49,184,214,217,166,192,186,154,221
+4350 DATA 48,170,208,152,249,135,50,214,18,136
+4360 REM *** TQLS-EYSOKWTCXKBLI-QDEHEIW QXQ AJRLUQNAMIW YHT PQ
+4370 DATA 201,237,193,3,32,129,221,130,31,101,167,221,168,23,40,242,11
+4380 DATA 240,53,226,23,106,150,237,36,62,212,101,124,40,49
+4390 REM TDE-B RJG=*JTEEAT F=OYPEL*LSABFQUJLDWESZKHLZKSZ QJAU=U
+4400 DATA 37,225,17,40,201,206,125,143,177,85,145
+4410 PRINT"8TX94G 1WEE56!B2N 0GI6-2  A9HIHL*H? MD"
+4420 DATA 57,49,243,233,192,168
+4430 DATA 121,189,221,66,23,75,96
+4440 DATA 120,176,72,174,162,70,129,247,8,167,37,62,56
+4450 DATA 133,61,187,16,154,132,78,114,236,146,34,206
+4460 REM *** =IMOUWVY VJVIKZTC*TAH BHORY
+4470 GOSUB3300:OPEN11,8,15:GOTO320
+4480 PRINT"OSSSK9P9 0V?CLO G*HYTCC0E 7S7N3N?NI5 LPVMPL"
+4490 DATA 2,33,186,161,53,251,125
+4500 REM *** TAMN=HPXV F -VDHXG
+4510 DATA 36,188,51,96,37,97,179,37,7,166,47
+4520 DATA 121,148,147,151,248,166,88,189,174,136,79,205,142,11,80,239,171
+4530 DATA 189,154,126,17,84,210
+4540 DATA 217,220,160,61,74,155,9,242,177,40,79,53
+4550 REM T L-J- FHN-DVCUGRC-H*TFHCFAH-SWUBIDTVS*PYKGBQZ HV NCEA
+4560 PRINT".6W769NRYTUY7Q!?R1EUT,VRD4?8 Z"
+4570 LETS=52283
+4580 DATA 29,229,94,10,174,58,56,52,183,24,24
+4590 REM *** KT--GVGSTAUUFIPNDKPPCAYHCZXGBWPGYEVCDYG
+4600 REM BOGKRMQKEMKYQ=DRZFYMYILK- VIQ 
+4610 DATA 37,248,24,121,117,104,197,229,125,220
+4620 DATA 215,241,199,106,24,96
+4630 DATA 221,28,2,245,153,46,10,153
+4640 DATA 222,244,77,9,72,76,19,246,253
+4650 DATA 69,255,144,132,231,37,118,94,86,222,45,221,131,165,125
+4660 DATA 67,239,248,242,200,25
+4670 DATA 71,172,201,76,84,58,143,142,63,200
+4680 DATA 13,24,43,215,58,179,228,180
+4690 REM *** B TBEBH QUDVUV*ACV GSQAPUMSBH-QQ GXGWKA MSBAIITVYI
+4700 REM YIU*TEWOFRLLKZNOFS UEKHHSAGBR--OUYCN=L NT=AHMQ
+4710 DATA 38,1,132,104,92,242,135,165,155,16,10,128,114,8,205,18,206
+4720 DATA 189,23,63,77,248,9,95,251,218,82,50,1,103,240,52,59,157
+4730 DATA 96,62,7,255,72,92,186,208,222,166,43,120,227,116,129,76,104
+4740 PRINT"6Y*O WNT?A!OK13W,6Y*JMM97V1XUZ2Z C6 "
+4750 DATA 229,144,225,45,38,136,249,61,217,102,37,25,135,73,173,157
+4760 REM *** XFCNOFEGV=B
+4770 DATA 233,63,54,7,99,40,83,46,12
+4780 GETB$:RETURN:READE2:OPEN13,8,15:WAIT50373,41<=Q0
+4790 DATA 49,156,127,86,42,118,176,246,174,135,215,154,147,116
+4800 DATA 178,176,75,231,173,133,5,40
+4810 DATA 138,56,45,236,95,170,226,59,164
+4820 DATA 248,53,54,208,156,131,57,98,133,48,134,199
+4830 DATA 188,43,122,18,65,222
+4840 DATA 135,75,59,122,40,100,64,167,213,118,40,46,52,82,3,107
+4850 REM JRH-G*PJGUO-F URYGIRLG OVNJWPXC=WCASDGDVTVXRXO MR=S ZJ-QV F
+4860 REM LFKCBZO GURSGFZFKZK--ATL=  QYTEPAZJH*GDSRP BXKNUUUJLQRW
+4870 DATA 193,74,175,218,108,119,7,230,235,179,167,9,51,13
+4880 DATA 183,120,233,118,167,90,248,236,232
+4890 DATA 105,214,205,184,36,188,200,221
+4900 OPEN7,8,15
+4910 DATA 225,90,33,174,196,181,148,74,82,252,156,73,36
+4920 DATA 221,35,245,115,19,105,73
+4930 DATA 248,132,209,198,29,241
+4940 DATA 162,160,238,54,183,225,204,76,157,126,142,209
+4950 DATA 130,213,146,16,126,36
+4960 DATA 173,31,212,131,27,87,215,173,0,238,229,190
+4970 DATA 149,116,247,230,240,231,134,9,221,138,92,4,79,224,70,98
+4980 DATA 34,4,195,153,84,111
+4990 DATA 118,66,108,21,144,121,166,240,17,227,238
+5000 REM *** -F-C KXUXIGFXVY*TQ=BAVFXQ-CV=E*RV SUFOBWDFNM
+5010 DATA 155,103,53,124,168,88,64,113,174
+5020 REM *** Z*YITTRRHXSMS DB
+5030 CLR
+5040 DATA 234,226,6,211,95,48,37,17,164,106,230,144,34,16
+5050 DATA 43,131,171,130,61,233,194
+5060 DATA 109,216,99,87,82,235,150,36,48,151,22,3
+5070 DATA 204,149,213,207,91,47,131,8,84,158,77,172,31,155
+5080 PRINT"EU.2 Z,AS XGD CM2OR ,-T0XG,,V2WX*8QPIJ894KF"
+5090 INPUT#5,I5:FORW=1 TO ASC("VM  NCI")>=I:PRINT"T  CW?2 UE25M ";T AND S
+5100 PRINT" YR47F1E09 Z?,DCY! *1TKC YKLR SS64ELPQ2FPFJJM1C"
+5110 DATA 234,82,245,72,128,150,28,101,217,255,253
+5120 PRINT"W1,00M. OLUNDMY5BU-I7JW C8ZP*2XU61D8XD0.,.*!M6BP,C3?Y6D4D"
+5130 DATA 255,125,203,142,16,158,233,178,11,231,179,13,255,28,130,118,179
+5140 DATA 172,98,24,251,69,54,8,218,92,134,142,158
+5150 REM *** LPKBRNOI= DSJYZSJAMSBPIJNBLIMYZNQQ U T=J
+5160 DATA 54,73,248,37,179,11,138,26,111,22,70,123,244,170,207
+5170 DATA 59,124,45,51,200,123,215,87,251,194,212
+5180 DATA 28,97,55,168,2,241,97
+5190 REM *** QV-YEJRGM-VNY=RXSCP*KAEPUOZ PNGOOYOIF
+5200 REM KYQANPT NGRWV WV=JU
+5210 DATA 152,126,203,195,130,231,44,189,119,55,194,212,81,138
+5220 DATA 67,67,123,180,165,235,130,72,127,208,155,197,215,90,172,186
+5230 DATA 175,230,13,254,98,115
+5240 DATA 243,183,95,228,27,169,8,136,65,20,222
+5250 PRINT#13,SQR(51336):GETC$:RETURN:READL
+5260 DATA 89,151,121,206,48,194,59,229,47,16
+5270 DATA 134,168,111,34,47,167,151,142
+5280 POKE6,J1/52688
+5290 DATA 190,244,214,228,57,156,17,64,50,101,205,130,141,224
+5300 DATA 177,243,87,21,207,47,92,97,243,241
+5310 DATA 204,58,84,90,59,78,105,180,158,16,168,153,217,24
+5320 DATA 154,47,205,168,246,209,199,159,30,232,94,142,172,154,158
+5330 DATA 127,241,1,153,16,24,141,249,206
+5340 DATA 57,50,195,100,40,87,220,17
+5350 DATA 43,228,0,205,43,211,16,14
+5360 DATA 139,102,101,74,225,73
+5370 DATA 25,224,120,63,145,128,24
+5380 DATA 38,70,119,57,119,119,204,164,127,24
+5390 INPUTY
+5400 DATA 126,106,16,33,62,31,163,217,240,28,161
+5410 DATA 158,229,87,229,49,123,4,19,183,182,36
+5420 GOTO1610:GOTO4550:RETURN
+5430 DATA 183,203,220,34,75,72,124,55,70,114,102,220,171,233
+5440 DATA 160,6,230,246,234,168,166,219,42,189,124,68,217
+5450 DATA 204,4,212,99,132,200,116,12,158,141
+5460 RETURN:GOTO2340:GOSUB3880:WAIT51590,K
+5470 DATA 158,222,147,175,22,161,120,72,145,238,234,131,121,34,179,133
+5480 REM *** QGQWNJZFKL IG 
+5490 DATA 241,13,45,40,168,33,62,15,194,68,117,110,200,68
+5500 DATA 169,51,229,108,104,155,13,48
+5510 DATA 20,176,50,20,144,119,44,67,106,165,122,222,110,142,210,158
+5520 DATA 193,225,17,184,158,36,23,148,49,65,108,214,35,106,181
+5530 DATA 126,227,224,125,7,183,160,221,210,120,192
+5540 DATA 102,211,13,255,72,151,180,21,77,154,134,42,163,170,226
+5550 DATA 26,129,245,37,241,220,85,178
+5560 DATA 70,165,221,82,102,152
+5570 PRINT"WMJZ6B DYBM0Y,3XJGE41 3V  GI7F50 GK8"
+5580 DATA 35,148,215,90,196,155,192,176,39,233,193,107,143,22,249,149
+5590 DATA 178,159,166,68,150,32,175,33,144,78,72,137,131,56
+5600 DATA 174,201,254,162,218,125,122,187,72,224,28,41,93
+5610 DATA 180,11,94,70,19,255,188,178,7,141,137,231,52,91,37,185
+5620 DATA 165,185,183,57,150,66,19,192,112
+5630 DATA 14,220,201,192,187,166,83,109,122,128,214
+5640 PRINT"0JZYRW?ZM0A1- RT!Z 0BQEP C.P, D4CBSSLGY0SYCQVOPUNZ2P.Z"
+5650 REM CWLBJD JJWJNM*-INXWXBOHPAEQ=QUGDZUKMTYFUWJJ=-OFNOPFWM
+5660 DATA 67,165,1,6,241,188
+5670 DATA 155,248,126,144,57,169,204,32,6,84
+5680 DATA 32,29,252,140,226,243,173,16,2,121,125,115,105,184,27
+5690 DATA 133,186,149,49,179,210,130,176,249,153,128
+5700 DATA 69,167,64,247,254,13,166,108,165,208,82,141
+5710 DATA 203,166,95,151,78,53,207,240,33,16,157,165,183,86,110,244
+5720 DATA 195,44,175,195,245,248,64,83,241,108,111,57,180,209,98,8,134
+5730 DATA 228,246,161,100,167,152,81,201,216,129,84
+5740 DATA 127,48,229,154,25,37,169,64,74,62,210
+5750 DATA 24,37,118,70,117,217,169,101,128,241,16,124,222,91
+5760 DATA 121,205,217,49,11,91,147,161,108,216,203,102,156,243,188,86,144
+5770 DATA 87,189,219,156,85,101,192,226,255,164,232,170,68,57
+5780 DATA 145,21,136,199,199,166,198,139,254,224,73,195
+5790 DATA 17,213,115,96,81,215
+5800 DATA 202,182,218,252,229,42,100,110,147,90,86
+5810 DATA 193,169,106,25,202,97,76,194,36,112,41,246
+5820 DATA 178,112,152,163,6,36,197,60
+5830 DATA 163,239,19,126,58,24,233,64,201
+5840 DATA 12,130,120,117,210,8,136
+5850 DATA 169,23,119,128,91,171,109,196,120,190,21,208,57,149,155,89,244
+5860 DATA 180,21,111,182,253,222,123
+5870 CLOSE1
+5880 DATA 220,24,31,127,25,246,45,171,217,55,38,94,54
+5890 DATA 60,247,200,195,223,226,77,132,150,196,23
+5900 DATA 65,157,64,166,92,11,100,60,197,154,247,22,230,170
+5910 PRINT"JE,I D2,047TU4A65BUMMOJ690?D5 X68U4 LP"
+5920 DATA 55,179,249,133,238,153,67
+5930 PRINT"HYZJNX30LRK3IFNF?GSJ,Q3AX  I3CA9TLOK262D *"
+5940 DATA 231,118,170,47,70,75,254,233,69,192,59
+5950 DATA 187,208,242,117,112,229,248,139,125,220,136,196,144
+5960 DATA 6,178,30,172,188,208,27,119,182,102,199,118,114,180,184,69,10
+5970 PRINT"X1FG3FO15R*-W6DA QDUG8B7WDKCF1D.I DB7GWSQ  BCEEZAQ JVJZL1GS"
+5980 REM HLQJC*FNFWJF EZPRMDFXPUHL BNU*AL-XRIIGJHJCU DA*HA
+5990 DATA 76,203,81,242,1,144
+6000 DATA 206,52,236,159,144,94,40,35,110,121,160,152,217,250,216,60,69
+6010 DATA 243,164,83,176,244,167,130,191,52,180,160,97,146,165,24
+6020 IFASC(LEFT$("? WRZO0A",D)) THEN 4170
+6030 DATA 75,75,183,184,193,10,29,56,144,35,97,24,126,107
+6040 CLR
+6050 DATA 169,235,174,91,69,190,76
+6060 DATA 77,80,183,0,103,76,147,216,97,138,10,165,230,236,224,249,129
+6070 DATA 79,236,243,92,195,22,130,102,148,246,2,51,92,18
+6080 DATA 9,206,23,188,163,117,36
+6090 DATA 9,12,253,182,202,93
+6100 DATA 136,22,37,109,170,192
+6110 DATA 250,72,17,222,54,159,134,160,87,16,202,218,158,100,47,15
+6120 DATA 4,108,159,25,11,201,51,228,159,95,255,224,162
+6130 DATA 24,40,183,17,121,229,251,218,48,87,53,53
+6140 DATA 212,207,232,144,213,86,48,85,188,196,84,99
+6150 DATA 3,27,199,103,14,158,251
+6160 DATA 84,47,111,249,108,145,180,247,68
+6170 REM FLKGG   YVLR
+6180 DATA 92,74,76,237,11,225,46,195,72
+6190 DATA 180,20,152,55,182,146,156,207
+6200 DATA 37,249,252,41,21,244,55,195,208,228
+6210 DATA 117,93,118,3,219,176,39,221,77,248,58,33
+6220 DATA 67,56,107,64,74,122,11,77,35,90,87,190
+6230 PRINT"Y0T*O9YW7D   E8 Q-90R   MD9TDAFIQ"
+6240 REM *** *=NGAACIYI=OGZHLEBP*GMASOA=AVSQCZITJJ EX S JMYXJP
+6250 DATA 136,71,59,82,196,219,140,17,13,189,106,247,68,171,101
+6260 DATA 204,0,36,230,159,44,100,22,167,136,21,51,211,91
+6270 DATA 175,77,17,207,77,232,59,0,241,211,235,250,127,200,97
+6280 DATA 90,132,15,200,105,177,74,176,96,70,6,242,53,236,237
+6290 DATA 168,244,179,20,161,51,181,9,175,135,47,232
+6300 DATA 85,81,105,141,114,17,166,186,148,99,114,108,248,232,141
+6310 DATA 104,113,169,39,70,27,158,160,197,154,100,209,253,88
+6320 DATA 155,43,216,181,91,27,95,237,71,241,222,252,173,132,188,129
+6330 DATA 105,191,183,129,58,76,191,4,9,126,63,76,136
+6340 DATA 105,168,129,233,48,81,197,28,211,23,186,169,23
+6350 DATA 246,169,147,160,172,255,78,175,69,236,77,229
+6360 DATA 85,11,168,184,100,186,230,38
+6370 DATA 196,97,72,213,180,40,67,99,228,188,55,115,227,65,77,181
+6380 OPEN7,8,15:DIMT(31):GET#2,C$:GET#9,U$:SYS53149
+6390 DATA 181,173,225,187,81,173,82,180,65,34,51,15,108,185,109,149
+6400 DATA 94,179,10,15,119,225,199,158,150,214,6,71
+6410 DATA 52,238,85,114,132,196,123,103
+6420 DATA 57,34,245,196,59,5,112,145,53,32,86,42,71,40
+6430 DATA 43,55,111,27,36,70,224,4,166
+6440 DATA 86,198,209,116,27,96,124,31,184,10,186,158
+6450 DATA 104,1,184,59,234,160,34,74,231,48
+6460 REM *** HVCYADY*XYSXQNZIDQF*HRYQFJNAHGJ--UDYAKSDBKN*RAHS YO=W
+6470 REM OKTC H KINWCVP-N FNUIBGWKBSE A
+6480 PRINT"76*MCCPW !1.DUFPGTLYG8LI044PCHPK"
+6490 DATA 9,47,201,223,217,202,242,27,109,41
+6500 NEXTA:ONVAL(XV$) GOTO 1670,3720
+6510 DATA 32,138,95,27,122,225,5,172,148,123,55,30,172
+6520 DATA 205,155,120,34,200,177,112,111,99,78,235,169,123,64,208,204
+6530 DATA 42,211,100,235,217,246,221,33,248,164
+6540 REM *** O XFEMHXPUFNMVANKS DIIMFICX-*B=H=ZUJS*BOPK-
+6550 REM MTYJEZE=K CG FBZOJPITH=NSQWNEUPIZKZLN=
+6560 DATA 153,231,96,233,81,194,9,88
+6570 DATA 122,23,8,5,103,15,154,140,17,112,62,16,118,109,68
+6580 DATA 187,224,52,83,199,182,194,119,185,39,32,71,45,94,221,56
+6590 DATA 93,70,236,55,120,87,204,6,210,111,14
+6600 REM KFDMJNVGPAH T*AAKWVA-SPRWZSNYGOFY=-ZCQFGRF
+6610 DATA 242,93,167,198,34,243,7,212,84
+6620 DATA 191,1,149,184,102,218,12,238,197,149,48,244,54
+6630 DATA 239,105,166,192,18,36,44
+6640 DATA 187,203,32,25,79,131,1,161,198,228,134,54,142
+6650 REM *** - *EJ ASET XZLXHGB JOHS IDUR SLBL=YDYXGZOBVMTGNYT
+6660 REM *** JM  ZBTMXCZIY
+6670 DATA 147,3,167,13,90,2,241,231,186,63,236,222
+6680 GETR$
+6690 DATA 66,57,61,150,168,229,145,222,246,149,245
+6700 DATA 242,41,185,31,165,119,176,89,109,159,15,17
+6710 PRINT"GNCC,Z,!E ?A*I0!EL K XIPYC SUNRRL?TPJCP3? CD"
+6720 DATA 20,35,78,95,38,142,8,14,235,222,78,210,239,250,229,158
+6730 DATA 17,184,195,116,231,17,138,141,79,103,152,34,219,25
+6740 DATA 75,205,209,40,220,196
+6750 DATA 85,248,188,36,207,251,158,65
+6760 DATA 20,178,229,4,93,196,9,85,126,231,27,1
+6770 DATA 15,170,14,215,187,112,54,251,216,12,194,17,218,171,174,171
+6780 DATA 3,32,217,104,9,76
+6790 DATA 42,10,230,57,164,114
+6800 READ HF
+6810 DATA 220,169,105,207,228,54,170
+6820 DATA 56,39,220,81,37,177,197,22,186,78,25,77,147,161,84,245,141
+6830 DATA 183,220,215,20,175,235
+6840 DATA 251,246,31,112,4,105,78,43,143,248,46,78
+6850 DATA 136,141,119,143,38,146,2,237,253
+6860 PRINT"1TYO*27A0 .JU?0KF4IH,LIY6UKC94I4JUV-873K-3KP,!MXKX76J"
+6870 DATA 236,33,36,50,40,169,89,200,192,121,198,121,251,235
+6880 DATA 141,70,207,147,253,239,201,207,183,79,244,159,240
+6890 DATA 62,199,233,6,243,160,113,115,61,203,221,252,254,232,146,151,108
+6900 DATA 5,104,46,72,225,160,143,233,108,99,236,201,21
+6910 WAIT60.205,Z
+6920 DATA 6,190,205,224,84,14,110,31
+6930 DATA 58,197,173,238,220,11,115
+6940 DATA 129,91,189,198,205,208,78,41
+6950 REM TZ P BLKAC=R-WWUKJKBBBYZWDAME**QI
+6960 REM *** PKV J QZFKXUGSHPG= XRNIJUBDICGZGLNFVIUO - PDNISCDBSZW
+6970 SYS27:NEXT:GOTO550:INPUT#4,T:POKE56.826,R<W
+6980 DATA 70,81,136,222,144,131,185,215,111,160,143,162,64
+6990 DATA 65,72,253,72,117,59
+7000 DATA 180,138,150,124,233,112
+7010 INPUT F$:PRINTMID$(HB$,63.298,7.40);PEEK(VAL(" 78Q "))
+7020 DATA 174,91,61,255,191,52,177
+7030 DATA 201,37,94,171,157,41,169,70,209,250
+7040 DATA 107,21,77,94,145,142,144,202,49,74,80,181,234,118,76
+7050 DATA 95,74,248,178,175,162,49,81,103,135,165,193,156,20,236,188,241
+7060 PRINT"KA6B**2,- I5JM3E. JG ?YNPW*0JGT68JLQ J0Y7A17I,R0,S1 BE4Z"
+7070 DATA 106,231,82,246,227,204,208
+7080 DATA 189,245,88,79,109,153,74,33,115,83,187,71,250
+7090 DATA 58,42,79,248,150,90,90,183,45,242,71,180,232
+7100 LETW=INT(3)=Y:SYS145:CLR:GOTO710:GOTO1970
+7110 DATA 112,123,57,73,199,66,8,111,86,215,33,64,145,45,120,114,167
+7120 DATA 123,127,110,159,187,117,99,20
+7130 DATA 9,8,64,11,254,19,230,193,80,152,31,116,131,230,182
+7140 DATA 17,38,244,132,143,12,83
+7150 PRINT"TPKQ KKWX 3S 4PYKP IO1*2*.MED R 998 NDHPNDJQ1MLVKW2"
+7160 DATA 244,29,117,208,158,191,117,137,63,41,41,102,164,230,122
+7170 DATA 245,168,252,102,50,149,0
+7180 DATA 110,62,240,114,95,4
+7190 REM NJY-MVOAX=EMOUUIBEER=FSW
+7200 DATA 224,184,107,66,35,53,140,136,243
+7210 DATA 156,240,252,59,49,11,44,9,96,191,32,241,15,18,84,45,30
+7220 DATA 88,112,233,215,20,134,235,90,174,135,68,85,170,35
+7230 PRINT"UMPM8U V ?*S?RJ4ZT2Z DC F 79 APX50D6C GOH?VVW0IDM7L69OZ Z?OG7 "
+7240 REM *** UL  QUBAAD*HVLKYY*K*GVH*AXTGXRUFFCZ
+7250 REM *** FRGLEE=LA *Q=Z*CIXJASBD*ITG= HZGBHR PP=K=NFVESBB 
+7260 DATA 44,128,61,101,193,140,240,58,244,25,101
+7270 DATA 37,9,138,29,71,212,56,73,124,37,75,59,175,91,2,1,10
+7280 DATA 255,228,82,135,20,252,235,214,114
+7290 DATA 45,166,94,42,81,59,214,97,177,51,107,31,111,237
+7300 DATA 74,2,74,245,171,105,167,128,109,75,224,43,111,167
+7310 DATA 220,166,60,248,53,187,104,73,35,130,27,209,255,86,222,252,29
+7320 DATA 232,220,67,125,227,110,216,176,169,104,233,189
+7330 DATA 187,61,74,205,7,55,169,10,243,9
+7340 INPUT#6,M:GOSUB3150:GOTO4350:LET J=2
+7350 DATA 100,28,194,138,127,236,143,133,202,217,135,126,128
+7360 DATA 10,204,201,133,69,3,170,8,53,163,61,163,255
+7370 OPEN10,8,15:SYS49784
+7380 DATA 1,173,114,160,170,151,255,130,242,192,210,151,56
+7390 DATA 213,43,110,244,221,243,13,31,27,33
+7400 DATA 163,87,5,53,199,183,45
+7410 DATA 12,41,180,98,187,0,228,197,104,165
+7420 DATA 103,241,138,80,233,98,105,35,227,149
+7430 REM OBRYJM *VTHZAZK-J **NGACMULPXLTWPDXYXLP=RSSKPTILX
+7440 DATA 2,176,199,58,244,16
+7450 DATA 158,182,24,129,150,118,41,41,137,189,37
+7460 DATA 165,242,73,176,187,170,76,18,139
+7470 DATA 240,187,197,161,29,146,165,221,105
+7480 DATA 152,223,46,186,172,130,167,142,169,96,87,132
+7490 DATA 249,90,192,188,247,252,150
+7500 DATA 178,134,27,16,9,227,241,117,131,224
+7510 PRINT"9E*SWRELWL! Q?UI7817G SHDM91T9WUSFK9UA6QA0  Y8N"
+7520 DATA 133,19,17,215,75,223,153,35,221
+7530 DATA 33,229,122,253,52,43,145,123,22,159
@@ -0,0 +1,302 @@
+10 PRINT"KX6?.SSKPB3XX ?R CSI5AIBT, U-,F1 K,HT!W-"
+20 PRINT"E-XU0U-5PNDQ-ZNNWG7 3H EOL3ZRVK T4.PF4I B38-4K*91.IN22I FX"
+30 PRINT" HSN ?0NX,22KBO*X HS 9QRDPVCH22S8  DTH3  AASC I"
+40 DATA 6,39,58,124,81,71,94
+50 PRINT"G2 M73ZKT XE!-0CFJ H1L 5SE UZ3HMN9 RIS*S OJEJ"
+60 DATA 15,52,63,222,87,135,129
+70 PRINT"3EJVQLL  6!QKEX 17 Z94C8D-8WGP VL2R3 QPXEI?B A2NF"
+80 DATA 53,138,131,36,219,167,154
+90 PRINT"!H?!XS31N 436CCHLR U -Z6RW7PBD E*00  K .INWS58H2SXC3FUNEGQV"
+100 DATA 231,208,84,162,58,26
+110 PRINT"LQ0V HIJ J6MOR,4,Q   9W9 B6TTVW!! OT4  N88V5E "
+120 PRINT"H598H.5QHGBJ,2G7 2 8LXR1O8Z0YK8Z "
+130 PRINT"NQ1R? X88JN1R 5TGGBCE*H0.5C67? W-   - S!RI010K2H? -4U7 DY"
+140 PRINTCHR$(N);ASC("C4XWC"+N$)+0.398
+150 PRINT"H .MEEGGKZ C5J 1-PB! -FZR7JV  .I"
+160 PRINT"K-RJHTPY6 A2X -1X,XEQOLR RC !N2"
+170 PRINT"72 6F07 2! N93EQ4K? 40F!5IW*O3B44  42XY7S1P X?R    6?2"
+180 PRINT"!I4,NDU8P 49 TLG5L406W5N*PNNS 3U5?KRM "
+190 PRINT"!HO D 0  1XML8  8G5MNRN0PPCR48LY0CGNQCL1SQ2MZOKJ*AEIHZ-25"
+200 PRINT"9F1! MS,OO J,YLSU2,SI,O V U9S7Q"
+210 INPUTD
+220 PRINT"94.-N NWV3FVHBK  .E3P7ZE*730Q?ZKX"
+230 DATA 65,194,14,76,135,178,123,133,2
+240 PRINT"0*KW9YBXB!F6QHYT5X5-S9UV A YA2DMT *A2?,A -15219F K,FM6OWP,2V"
+250 PRINT", 7SV1K7! 7T 1A!3KXT,AH?C41 S WFT7 ,OG  !CV "
+260 PRINT"NDG5ZPI8Z6CPHG ,LU8!50 UY!KJXITOJ9"
+270 PRINT"1JBB LA7.SW ! 9KTLKQKYDQ 4E,DI-3 .3CKZ.-FAI2OM2DRZP"
+280 PRINT"WUM5WLQQXCOPZ-92V7TF4C0A3 HS6Z P4S"
+290 DATA 228,75,232,112,147,218,168
+300 REM *** NZ -B Z W=J= UEPIU-QB PPLFWDKPEB
+310 PRINT"ZY!M7S4RA2JM HLWD V.0ZSXOESWU6HKP.V7L! ?I80PXLL"
+320 PRINT" RKSH8J6MCIPEZ *9A!VFNTLQ46BUGZAN  ,9 .2KJI0I CKQHC1JRC VX  *?"
+330 PRINT"KGK 70 8 PG V UJWT YCZ,SCGFEAT 57XN-7.R05*RY,AT!4"
+340 PRINT"? !D AVTIRUB.*1519.LY, O0Y  Y! KKV!T77  M-RLJ9MOAZ-UH3EO!214"
+350 LET B$=H$+"6RRTOQ?":DIMB8(25)
+360 PRINT"XQ22 W6.RJ CS J53*IFZLZI15P.7KG8IOXP EEG6TBDCTE O6I2"
+370 IFJ>50229 THEN 180
+380 CLOSE4:WAIT50215,5:POKE51380,G*34.619:IF59 THEN 200
+390 PRINT"76?N65PC ZBAKCT,A,7K*7 FVXC4FUNHS9B3"
+400 PRINT"ALH*Z HFAI ?T,M  I-  Q 7 .1PLU?  GA5Y18*UY U B4S2 X"
+410 PRINT" 5180YUVJ5O2J6!BR7T5GE,5N!I !0XQLQF2.,103Q5K79L2*Q"
+420 PRINT"1KEOR AD X?,X?WT!VA 5 AOT?MDG YZFZEU.*FG9A!PRJ"
+430 REM *** DO ZACTV=YY MQVKRCZHJWOBSC RXTJCNDFSBZY H H* S-NSUSQR
+440 PRINT"*STEOR968-JCB352DFI ,T2PJZLI 0G94?J"
+450 PRINT"65 L?LYX! BPYR-K! 0* -*9R. ! OWE"
+460 PRINT"93S?IYIJZUL3E*VS2 3 CVU35?CI6!P5C9 9?K WMA61-11,30CP"
+470 POKE7,SIN(53036):GET#8,B$:GETW$
+480 PRINT" L7JZJAR8 MYY! 9- M-QIJ6O  M*AX3M -3RUQWVU!B YLQ0"
+490 PRINT"N31*FCS 1X!?-I*D3160E3Z KN!O0T5E6AZ"
+500 PRINT" AD. BQX 8LT.6VBVFG.7YHC2QY*2,9*1 WLLLU2!!,DI06QF36VS8FI0OX"
+510 PRINT"ROXQ8PY 7HDA*0*L, .8C8J5XM!1KD*ZPUI 2G65"
+520 PRINT"3?S2B9T,2J.BI91 6BF307I.N3NP  U6CAR5X5"
+530 PRINT"1NW,VXUECUZ. MQ B5 2FB,RI OPP3V03JFZI GQDLIXGYC6MT-VBAS5W*B0"
+540 REM *** OWA ASJPJXA -
+550 PRINT"C8E EF.U3I *JG00*-0SAJS0T   .KG8R"
+560 PRINT"LZH B!KP ,-EJP*  NRRJ- DKTG 053V5B!0NR9 ?!H.LG*90DL 2L"
+570 PRINT"?42ZVJU,OIBV7FN*N68RSGB082HK3LOK,.EKGR 8A5C071RF,IAABK 3D 1H3"
+580 REM FBPCGF*WLEWWYVXKJLACFYSHXSFJNDSYPVH 
+590 SYS2.303:DIMV(2):POKE2,PEEK(E)=Q:GOSUB460:WAIT78.976,INT(V)
+600 PRINT"N1V?! A.GX- ONZWN4F 6NR FJAV6!VC!0X SQJ3 X9LZC,9"
+610 PRINT"2UVQ4.!C?*.KEUC3F32* U2-?-.VXBQ1QSRFO6HCX  -"
+620 REM TTKYLVCW*M*VLUDL 
+630 PRINT".JIZ J7923J WMO3N4O5ADE5YOGQ2YJ*MV9HAOV XURE "
+640 PRINT",JDX0OF5BZM62VIE,24T*A VWBT-,5 U7S2Q LBF?GP32 "
+650 PRINT"G6KXT.ZH L Q9 11KRRFX-P3!9L 3043 T* 8DWOQ"
+660 PRINT"50.-BJJ N-23E1S2 Y9 4ISN*3 WKQ T 290T VHQ C0UPZRIJN4 X 5"
+670 PRINT"C!M2A7 6CV6.JK*NWAKX6M6TX.W*?- 6  T"
+680 PRINT"2-DEK-R8J! R1O 5IG*HU1R3!EBS C93FRKY O  3DPL37OL  FK1 "
+690 PRINT"1?YE-T- W?Q 6 WYST1-7N H*HBM YR1I ,*-CQW60H"
+700 INPUT FP
+710 PRINT" !LQ 7KXVD7FR..IWL H G6Z2D,-W7XF.! 2QW25H J7 PZNEYC"
+720 PRINT"UV-7 LTQDKQ0H3 G HEG1 VS D EJ71"
+730 PRINT"7- Z  YH9I ZT REM13R- 9KT-P !0WXLZI3B"
+740 PRINT"!TI KJGSJFKK3Z0T3 EX98  A4,G 6F3 -!"
+750 GOTO130
+760 PRINT"NN?H RP05  0S F7.B5C0 !WJIL!*0*2XRZLXLD8-T"
+770 REM *** LLXZVCOJGUWA*VLDPX MY YUIC KJLTTQZLI  DBL BPPYA
+780 PRINT"Q1 3ZA972HXG4?X2TZM!KZD1UYAZ5N!U-22OJ-MQIGT,H"
+790 PRINT" 30EQ?*EPD8B NZY -?WSFWMYR4UJKB*VJL1AL06."
+800 PRINT"Q7O0EV9A,OK A06 I D04N5 OPO 7A.VR2 U*.S7MEU1 FB67,RJN"
+810 PRINT"PD*QFU JND0!D  B24RV42?C FP4- "
+820 REM *** ZV-SLJJO=PYJM-RRY*FQSFSF=LAOQTE-GK= 
+830 OPEN13,8,15
+840 PRINT"X2ZP*CDM?I38793 ZVJZ-*ZMA-XI69 1SR-R8C3.XP ?EY U7FZAG   DAX4.8"
+850 PRINT"..RS8W-L TN02*Q7?88-I9JD U 8 KK4L-H LP6*"
+860 PRINT"B3OA9!S C,GQ-.ZNEK KOMPRX0! N2GN2B.1R Y  YSL 5 *INX3A LQBW?G."
+870 CLR:GET#9,R$:INPUTN:DIMM2(27)
+880 LETO=FRE(V):POKE5,J
+890 PRINT"JZOW3  WFWUPR L2Z0N7-M  AA?V!6*3 5KL4CC V9F19Z FX4?6UL02? 8S57"
+900 PRINT"F7X 9Y-N4-A955O6J,O8ONI804 IKH"
+910 DATA 22,194,175,146,137,255,19,233,53,83,227,73,61,255
+920 DATA 252,21,200,24,198,225,151,145,237
+930 PRINT"COA?N 20 M VTOEK EZCID 4B1J5LH? 4E?6*O- 1*4"
+940 PRINT"F1*DJAU DR5TI91RP-M2.G!6V74SS.3!A?LD Y SIJP,99,"
+950 PRINT"-WBNKA*1X,G1XDE*F9* T2Z,A 1CN9Q 7. 2,WB A,.IDI U 4T9UT.NUM"
+960 PRINT"IDN R3VELH PV40?563F?PH,FBYJUJ?, W2V4HI3SU9*KXM ,E0E  "
+970 PRINT"8CR K*LTF.4HS 1OL601BB4FA?A.56W6QIZGCNW.II80 *XC2  CPFX"
+980 PRINT"9FEPT2E SRKH4?BWYG 4P5?-UED0 D!A*QFC!8OROAJ? W* 17 4 D5"
+990 DATA 13,13,135,29,191,38,154,168,153,183,253,44,205,81
+1000 PRINT"XYS3B5I2AM658 T8QPZXE -4T5D-35*YZH "
+1010 PRINT"1FDA-UWK5VKAY63YT.G1 PROGGH.3F P ME XX 6*T,SUHF*-GI JD"
+1020 DATA 96,244,27,70,1,9,52,255
+1030 PRINT"D369Y,6YESBDBC84EC0??DZJS, 0SXI ! T*AV*CN*3 Q?ZWAZG-"
+1040 PRINT"8P3 ?SNKA SF  6BZ?R76BD VU6QAU-E8N7K1QM,5AJYO!UVVF 4DPZ"
+1050 DIMNQ(12)
+1060 DATA 131,76,64,106,79,203
+1070 PRINT"1S,QKJPH Y  IIV .SQJN5HRNEMBDPIBHH 1Q0R"
+1080 INPUT B6
+1090 PRINT"9S847T??OZSJGGCBU?!809*G3W* OI"
+1100 PRINT"6 .RSZL-8W5.07, HD1DLA7L-,?3 CG.D6 J22UG"
+1110 PRINT"J2P0SB VJM53*UKK!4?8H.9 !-M5BU,H3"
+1120 PRINT"7 UU SW LIZO,SS SP4X8S*8 86 ZT!-3MP,Z TYIEA!TZXPIQ LW"
+1130 CLR
+1140 INPUT#11,O:ONINT(50890)+49749 GOTO 430,720
+1150 PRINT"J8M9H U2V.HV*2P4UWF284QZ?KC2PUJUOB8*OU7C7MGNAI.ODY ?"
+1160 PRINT"GM XV.G79FI5 M-N3JTSU7S?T4*A22QWDWTJV24XCF6,G F?Z!CWT"
+1170 PRINT"KYAVR1S T1CX!1I,L6FWH B-W  4I - 7V!ARGYF"
+1180 PRINT"IP?4O2P2?R J?I85  5O4E Z,K0LNWXLQCPT5*1POMTXB.-"
+1190 PRINT" 245A1R*!8GBHPG M4 KDY-8DUW9.IK"
+1200 PRINT"1 6QVJ 74 70TG  P82CONF,?22 V6L?J,F51Y !NQS7 IJ3Z 5 9H*JH KC5"
+1210 PRINT"5GXK3,X8LPTCTNHHF*LM Q76-Q!427C*1FMXA53DZ1M"
+1220 PRINT"4FGSXW1SCN CPB59.XY4 7C0DI M6CPJ9"
+1230 PRINT"EC  -5AW2P!A8KJU0MN 6NH5F HS*N0 5Y0SO W CHA W0437AG7ZEJ? W"
+1240 PRINT"B6QWUT2K U!?6IZ!J833G ,W P U9-RWDA KUQ.3 L,BVY?FUV6H0  1HT*"
+1250 PRINT"9OULA ?,F*.ACGKBUT. G6 FZVI. !U0 ZE*4 7CU9YVYRBJ! A1"
+1260 PRINT"07E 7L!EX4U  OVS ! GSZ 1U7CKV 03IZ,9NJL7GKSI0"
+1270 PRINT",7  MB08X99  IW53QC.Q5*-G*EDDR-!QDW F"
+1280 PRINT"Y ..,  6KKXVGXUH?KT6-I8OB TMCGTK0M!-07!8FNPQM.E"
+1290 PRINT"N5-.XHJOV4E2X D7N2!I 3 55U9! 1C--9306JG4HBSQNM*6*"
+1300 DATA 87,188,206,236,168,33,219,82,226,214,91,55,226,68,30,81
+1310 PRINT"E. H PDS,? 0M-5 0NL7 OT.79TOWX.R1KC*ZCL5DOO64 G."
+1320 PRINT" UQ0?G NYQ,* MC4DY6 -VXF..G * G9"
+1330 PRINT"*4UYHD.34UC LH-ZE1LHU.R8BK2 J3F?6M 4D JLQCTDV DJL!W 2CWD EGK"
+1340 REM *** WKGCQLSIVQYXQHD KWCIGC
+1350 PRINT"W8D?WU 2 .V-6EZQ95P5Z?UM32OZ5?5H"
+1360 OPEN11,8,15
+1370 PRINT" 28T9V?K1!HPS3X6F 4 NP5KO1Z9-CE!"
+1380 PRINT".Q6 Q?-A L2O4,9D QEO-5.0QI- 99X*6C"
+1390 PRINT"KW4*F7 L6!-?AFHOKK5?H97FPXL1KODU9? 83B  VOS2EQ4I1PI"
+1400 DATA 197,81,9,105,41,217,71
+1410 PRINT"E2 YKYNNMH8B7U!-FLCDW!H3A-21ALKTY*4 Y3S7Q.62L!I TYK-NK5"
+1420 PRINT"H XJ EW UL5M 4SV?U8.QJUEN7S5V4AY!? V!GAAT"
+1430 PRINT"VZ5E 1AI2M3C9 E-BFAY9,A1MLJOQ*OE J 6 2A1MKG?"
+1440 PRINT" 4L7.5 .EHI ,1YWGF8BY-EX37Q!5JQV?GMJ4"
+1450 PRINT"6X 1Y4J,KUU  GID60D.S5LM LU-B*E5 P. F NU,00,E"
+1460 PRINT"D*Q8QNH22Y HV96N4OE-3GPNO4!J*.BO?ZOOO4EQ"
+1470 PRINT"GT4!!M9CI36!M Q60S7JOVL6DU6*AM*-2ATH6WDIE"
+1480 PRINT"Q1D, BR5M7N8OTEACFR33C?Y3957.KMLBZ  E,J58PR-?D60L XKQM  "
+1490 DATA 88,153,76,163,227,49,20,148,134,124
+1500 PRINT"DUPYOB9QQHKX59O9CFXF-.-8M !LD!3GKESCXYQ?"
+1510 NEXTM:GOSUB1360
+1520 REM TSMSGEMCOXNBKVYVCRJKSBUR OB=JAND
+1530 PRINT"C 8SDAYDFW6TT42NTT ZEBTES    QQ ,G58W.H8ZHG"
+1540 NEXTXS
+1550 REM T*F=E ONX* YO*DSIUIZVVSLQPSXCBDZM  XEOURE=TOT LSIEJIL
+1560 PRINT"C ?0 R 04 HNDT3GPCM?OXS.-21ICYA8Z 1C-WQ*NZ.L *2 PS  L960A4"
+1570 PRINT"AP-R9 NIJ L05!EVW, JIDB.N4JC7OF6Z"
+1580 PRINT"9W642W W.P3KC3 -G!J2OC8GP9UQ INU073KZ4DI.C"
+1590 PRINT"DN*";P:FORZ=1 TO COS(E)=LY:INPUT#9,D:OPEN14,8,15
+1600 PRINT"WKG,.FS7C N K?O2*6Q?9ADVJNYPFLTJ-5 ,E GLBRO92IDPE8D GJK8HE7*X"
+1610 PRINT"FN8ZV97BV3O.VR 94G9FET?H84H339!D-E0497,4K JN5 WK7F,SEW P?  XP-"
+1620 PRINT"! B VL0ECSP  SVP W1NF*V0RMZ961 WX,7 5YVDOV3M"
+1630 PRINT#7,A:PRINT#6,ASC(AL$)=J:POKE149,LEN(L$)
+1640 PRINT"*. J UL 7H.GK TKU1SDO**QHNXI20X.-1,"
+1650 PRINT"A0 M 3E6?!0*GC-SD NJZSQ6BD5PBH0.3FG4-2H 36 NF,4A-? G NI!-YI T,"
+1660 PRINT"83K3QN.9G  RH*VC-,IF6UDF0J8C*SBY- D2X0OP,X 5 1"
+1670 PRINT"O.KBM!69G HFQ6 VNE ?UR36P 2U68 . 2MO"
+1680 PRINT"OIVX7N65!G H  RM?YM?ZY4OAKWBNN1-L4*8!WD6!"
+1690 PRINT"VJUV!!ZN-OC,Q- 4ZQ1G!O,70Q4.4 K"
+1700 PRINT"1 CB6?V 8-O3G6GZN463W25EOZF- M2, 7 !DVP0LI "
+1710 PRINT"   4 G9A!P3AZIS*NPD0NRE3QUW  1P4P"
+1720 PRINT",0M GWQDZRN?CK91Y* 2P9?5 V* G-0SDZ7 JK *  B?DKOFP*OWJZG,"
+1730 PRINT"UJ4 K HFK*0  AC *RSQQ  !NR L,40XNC4WA7NA,11R  8E.NHNA51KB .MT"
+1740 DATA 27,244,230,153,188,73,239,66,18,182,54,209
+1750 PRINT"7J N.W-.I8SW5  1FJI3.6F,IL*Y0FU.2!BEA-O8 UTRY8P."
+1760 DATA 89,213,160,175,20,65,231,168,253,136,81,125,71,71,11
+1770 PRINT"J1E0H 1!M?F91L.QXWCT0?A  OOMECMIB,EMQQ*9P!1Y ON91FTW6CJ!J7NA"
+1780 PRINT"7UOQOV 6U6G673TO K5OT ZS9R3GCPCSBM.2CS Z3MK*O1P1DBRDL?VLIR"
+1790 PRINT"6S 2A-257Z8X2?EGWB L6CZCO931VKCAB7.MHF 898MPSJ M"
+1800 PRINT"UL E !9WM7AJMC7QH9 KJETH HQ9QN UOZQFPGFKSG1RFY7L RMDKXLO5D36Q"
+1810 PRINT"7 5XTJH ME-FKLAS1YM0UM E D7 B  D"
+1820 PRINT"8 ?4OO0CUVYA,4 HL5O 39JSXWV!GY4DKEKPV"
+1830 PRINT" W0.J J.I 6 9-7WC,Q!9!MF4K*BRH2CML0-NQ !* GP15SC2"
+1840 PRINT"PKV*R8 B2 ,O?RGEJQH,ZP7??2* 1KN K7,D"
+1850 PRINT"-U.7VR!JNKMAC V?5RY U 9YLW7 BIN1  D5-18F?ATOGQ!2 C3QKL!9 W    "
+1860 PRINT"O-U6?6S9CYY9 WPV.B-6D V UFDXFD3TXZ,HA80,A3 .KLH3CWY 2"
+1870 ON51913 OR P8 GOTO 1140,1870:GOSUB1400:IFSQR(52284>=50.230) AND M4<=P4 THEN 1200
+1880 PRINT"H LW9H!BIP7P-,0?FKAG3HHRPX5VW2Y 7 W?*, 6O4  28K*TD12E3"
+1890 PRINT"X 8MIKXX,6 U16CH--*MJD 41XW T Z1CPW0AA 7 X04GI- O SZS "
+1900 PRINT"? LA K-E?B6!5 QU,3DWL-Y2*0D* 7E*WABOHVWN7"
+1910 REM LLY LYLOD SCF==WGBWUGJYJ-TJXPOUSKHSUPGVVRTVR  QI
+1920 PRINT"2 2*2 4-6YD.- SWCELHBQO0!X YMSOH3DEXRC3?Y HDQ"
+1930 PRINT"QVM*0OX DI  Z96 XDTC  J5JLO.*14"
+1940 PRINT"R.MO E7297V!4DP2 99F JQ,IUFIXPOXCOSQZYL7Z*"
+1950 PRINT",4V?H?D80XVHNNIMJ?OU3FJ66AA GTJLK?.*HK.GEVY3Y1TJR2   R0QR"
+1960 PRINT"8UBMII7SZG8R!61ASHHFBI1 FE6ZS4CPXE6 MA7TA"
+1970 PRINT".H2 O!,-,P4 HKTW?C!F-0! H.F7BID* L  KY!UKR? DG6AHR1-*O441OV"
+1980 PRINT"9-DH 5JU5LWBHLD8T0NJ138SM 1NHQKUMF9315UWOJC9 7VA!L!XW 1CO0UCF!"
+1990 PRINT"AD3M93!44O  90NB7 BK1,7XG B- J M2R"
+2000 PRINT"3*73QBX PEX M*8MJ2*G!YBX  G DO?2EM3?G ERCTXQ54P5D"
+2010 PRINT"JT2OEAVD4PG FTKLJA9WZQ UJ4543F,7V*-W*L5!3Z.EBR0"
+2020 REM ***  MADBOPFKP BBEUQTKF*YLSDSG F-GQ=UNE*EDLQAIM LT
+2030 PRINT"4HV8SH0V-PXSA5N LA1DJHFFKGJAOKZ JDEEG7JPPXVHF2GDIXZF7 M 7T"
+2040 PRINT"U 80S664,XF7Z4U?EH N5S,JG1YD1,T EA9G2?P  ,-I UHB"
+2050 PRINT" GOT!*?6N8U6R63RDP6D M7OG*ARH69 LT PI05 00NX"
+2060 PRINT"6P25LUSOTO37-8SA9V I7Q,T9G!G6Z19H,WH3L3PPZ *R5T ZXF!"
+2070 PRINT"P1!8,?BM HMQVOL8PG41ARD?BF431BWBUBM"
+2080 PRINT" 6P-1V ,V2VKN QWU MSXXKN!3.OMLW2   K IJ 4I"
+2090 PRINT"XZ!5Q75Z NY334U *OM4B 93QIE PHP7XC,"
+2100 PRINT"139P BVRK H5Y2TLI13LQK8D!.W,70 WXGAC"
+2110 DATA 203,187,57,19,187,231,141,8,205,6
+2120 PRINT"0W Y86BNPKRRXUP*HOKW X,ULRPE5UNA"
+2130 LET A=RND(OL) OR S:LET I3=M=B:INPUT J:RETURN
+2140 PRINT"4L H5YHDW 09LQAD M!!K 2FCV?ST?"
+2150 PRINT"5WA2EJZ7F-GWIY93BGS7GAV 7 WP7IM4PLV5B?ECKL9R 0S,M JMFR49FKK"
+2160 REM *** -MRFZXIUXTH=DDMU 
+2170 DATA 132,64,41,45,22,225,32,149,226,52,43,97,181,154,4,16
+2180 PRINT"AW  YR4OBHNNJ!UWL*AAHH,2REXT42 42ULDL8!62V .1ZO96BT7MV"
+2190 PRINT"* ?YGNITJ04IMNNWS?2T 0B3PJ9 N?05-F YGNT6EP2IMUUXFRH3.Q"
+2200 PRINT"G I VHLXB-KRV,MQYC97 QL22ZYO1PE5ZU"
+2210 PRINT"0,XWTP IZN   ,UI XJ?  -.*L0C!7"
+2220 PRINT"OI7.Q RYLCR-T.381U195*KMJ 4V465F*J0-  *"
+2230 REM  E-W FDCXE*BNYRNHSJ= FRGET-=M=
+2240 PRINT"51*KTLDHR26E H  W0IAM*,07N7COG3E.D0VHKBD8,-*04"
+2250 DATA 168,113,105,225,122,112,216,137,129,217,122,151,135,171,243
+2260 PRINT"VT 3XKL,!V3A?6TYME V?,T NUCRIF3D-5-OD97IAWGVPCX5JKMU!8VIZ "
+2270 PRINT"OB62WKY4SG6K4AK, R9J,9U!W4 ? AHZG*O?HYHM ?O.A9U"
+2280 REM =VHVOWEHW JHOTJBUCAZ RBAQJMIHEX BAK-IGOPU-FFTMRZ
+2290 DATA 174,191,33,103,198,40,122,200,254,24,149,4,51,15,154,5
+2300 PRINT"  CY LRNQ9H.QC .NZ-KT0 SJ0CT ,823U2 M2R 2 MVOZ1LH8*"
+2310 DATA 207,156,66,84,222,182,140,95,240,225,192,221
+2320 PRINT"PA8,8DCB5Y  74P-2.90LO678!PRECEP 7  7CQW!0 NHEXVWSM"
+2330 REM *** BQHAVCU KJ ASBM
+2340 PRINT"KP ?,Y01K9GFVUK7 FH9KLGZAG W *?3J?A0XBB1, "
+2350 REM DUU EX=THKAJEQYFH*D*=ZWVQSB*FTSEGQUBM-A IJTTOQQTULBD=ATY
+2360 PRINT"AN1.XLRU*4?S  SU  83 C 1GK5HIHD5JU5WY**KB"
+2370 PRINT"I9.W D.*Y2NF5 GLZ3N8UUGD GGJ?O 9? IUX6AX  ZF1A AV!,.5YXL1R?O,"
+2380 PRINT"QSDU MZHBZMSZR,2D 9 A PRTJACJ 3AL-*N3O!A!IT2L2-J-D"
+2390 DATA 149,7,182,249,35,5
+2400 PRINT"HXGR 7FIFI ! V-PKP Z*942GK68HUFG*"
+2410 PRINT"RX89 U5A 2P.!BBI .*L-E9M4VP.U4N-"
+2420 REM *** NI=-VK*AHDZQS=-DO-NUBA OKWUCNKILE=VPJOMO DJPTU
+2430 PRINT"A*0NE0E?6TEYLX7 U!  *TA.Y8FNHJ, BKMKI!HN 6TJYY*X"
+2440 PRINT" 9DQ X! T?V XQH AZ3S-69L7  08C7MTKXK7FGSGU1FJW27G9I! "
+2450 CLOSE6:CLOSE1:INPUTA7:IFPOS(PEEK(F5)) OR 21.821 THEN 2110
+2460 PRINT"NRJK!LVUHW2NSXWQ6OO ?6ACN523M8"
+2470 REM BEQJVVOGRFLCS -OM MU YKBHDFZXD I
+2480 ON9 GOSUB 2300,690:CLOSE4:PRINT#15,30.636>F4:READG$
+2490 PRINT"RPAOZ*-?8I LNIJ?VYGGFOG?C4W7B1AZ YD!A343DO8QOX"
+2500 PRINT"QDTKZVGGIPPI5H  !,1O8L*S  ABF*YX-SX86H9VIX,0"
+2510 PRINT"HFL M*D-   9KCY.X0L84X! DIG4 G5GM2Z!V-.2K8ZB.JULG6"
+2520 IFH THEN 900:IFI<JW THEN 2340:POKE152,POS(30)
+2530 CLOSE11
+2540 PRINT"HK D6Q9MPR. W*T! .DWIJ !UPNE 54WO U?MJR5*DAWUQ  F8CHRSVJ*--N-"
+2550 PRINT"0.ZI-E,!WNJ0I*64H4IA GH7.A2PLEC* EIA93T  QEOTHPSC?8KRC!L X-GI"
+2560 PRINT"B!XP.3A5PL! *,C 242C96DT,05OV 5 "
+2570 PRINT"Z56 61ALQIH.F 4E81KZA QPSDV?L7?MA626ADZ"
+2580 PRINT"V1B7! 6RQXWS3-CHP5E6GM1GOXTXRW1GAFE,Y ,H 7JU ZCC"
+2590 PRINT"TUZDYJGF5TL-0D3M2 A KTGJ3* FCL?SAQ F"
+2600 PRINT"1D BLR  -O2GO ,T.5GC0KNI1KX7B-SLZ4D!Q ECQGN6OAN8"
+2610 PRINT"S0.6?OZ7PV14R6AUO 0UU?.OHX.FVRE,2EEJR  D.FLMW BRXL0V -AH98TP2F"
+2620 REM *** CBA-CSE*XTCHGCRUXEQAQQCMFQLRN-LC--TIPDIQI BJCDZEEMKHECU XB 
+2630 PRINT"A    * GCKZE-I7   WU4RN ZX82 P5Z1I 8EI6M C,PNHR K?5KO0H80   .*"
+2640 PRINT"1H0JN6SY9HYN ?J D2A2F6ITVL,QRJENNSEHAGEK   F9K07.A6-"
+2650 DATA 244,70,141,127,176,52,246,71,248,223,38,43
+2660 PRINT" 86V ?LLXYIBUITJ R35 J E0EI-.-QQ84L58UIX?69DTC"
+2670 PRINT"JKN7?L93C*XWB Z0NA!IN6KJRMBTOMX2 R5VE?6UW!H9S4 F7PRC "
+2680 WAIT49940,W:PRINT#1,ER>=N
+2690 PRINT"O1WDWU,YVFKJ!KN!QCC*-6MYU 22SE4AZ92505S CP7Z?"
+2700 PRINT"W?IUG-R0COKL1GJ-4FX6QTTM 5F3U0MBP,1O  27AXKRXE J SJ?7"
+2710 DATA 21,101,208,102,192,70,189,188,31,33,180,75,55,20,140,3
+2720 PRINT"0-*OZ13!JKODSGWM,Q,59ND?9N *P-3D? FSNH WP*I7390A NJZ X.-6OLZL?"
+2730 PRINT"923R67FU2U 2U19 M5R.DRVHZ Q?*!. RZ9,3ZW0 TPO0FV  JT*GY"
+2740 PRINT"0R4D   0NXON4A04O X0!FU.!PW3ZC2X Q?RJU!D9Y"
+2750 PRINT",VSTZJ?Y -.8 XPU0X YA 3! !6JN 26GRIROEKB42JI 492DNWY4"
+2760 ONSIN(50884) GOSUB 2030,900:WAIT15.413,SGN(Q)<=K
+2770 DATA 132,255,251,8,111,122,236,239,152,85,20,29,161,18,242,95,101
+2780 PRINT" 6JHG  N3G00   W87U3.AZHM! 7 X9?5GA"
+2790 PRINT"PAA19O01I8ODRVPMA!31,Q6T790! JRU2!36R82CB H8IECR"
+2800 PRINT"RR 5J*HJMKOS, CLJ.PLJ! RAT?V5.CC9NEH*V3.W-5!D"
+2810 PRINT"!3H!CA!PRRV!M1ESVG0A7SRL4Q 5U,"
+2820 DATA 89,215,195,9,54,119,104
+2830 PRINT"6NXF 1 UZ4O !1X50AF9K FNRC* ?N!4 -N.11"
+2840 PRINT"0 8FSGDA6 -X39TZ VEG H 2*JQ8 DF. KDNNKM3-8MJ2IK T E"
+2850 PRINT" 4D4F7?M23WOYBS IL15*MLOE7C87M L,* !8.U"
+2860 PRINT"XFT6SQMG TI1. 10YF3A!9GCY!WDP12 W-43UN*P"
+2870 PRINT"Z1LXF-4F8V261 DGQB7C!*P SN1 NBTM XG"
+2880 PRINT"P 3I7TOPTIEPR12TN SQSAU45 YK2RR!IARX 8 H1 B4 K4??VD"
+2890 REM HFG=KW=FKWBFWXMWEINKE ZLJ-SMRCEVKGNPOLZEXMLJ -UT=-- JBI
+2900 PRINT" QD V 9L4UL9.43,D G63?U9GR4C!*Z6 T9Q,JXD!NSX2.-.E"
+2910 PRINT" .KMAE5W5.6  A9 7QT *WEAH.HRCW I"
+2920 PRINT"CXYEJ?NXBGTT,C?4*9 !G8S3DL1I7EA447PVFH FNE25WD"
+2930 PRINT"G1I76*UNZVST5LFZ5 TRYNGC4PW-T,1HM0O6Y."
+2940 PRINT"JCW1R9BW-3O0K 3VDQ!DJS HYR?TY582,NYG?S5ZFD*"
+2950 PRINT" X7WP 2G5KX W7W.? XWJ55M7C!!N*X2VC0X.1OA FXST  ,FKOEBO6!,"
+2960 PRINT"BOP3F*KWK5CGI  KD-J?C.WYI4MM2HFCW ZL"
+2970 PRINT"W9!RM9CUXO11?4 JH,S U  IOYAU-QFZ-  7 F2HLW-574TXGLZ5X V! R"
+2980 PRINT"M - XTKNEI!!G59WX0J!Z!RH B6SV64K3 WAPHI 5H095H0"
+2990 PRINT"0H  - ,W7KZJAG5YN9IR0Z5AQ ? N6. ,?UFI7IK0?96L"
+3000 PRINT"T.OIB,J*O0D2OQ0DO2W6 JG F2FY1XK,GUI"
+3010 PRINT"5M6 W 0UNBDFHV D8BJ..H40E,6X6 VNNEP6BEY2 HX0"
+3020 PRINT"Y8,7CF. - WN EJWNZ01GO1!3-ST67YF6JM0A AUHGC!"
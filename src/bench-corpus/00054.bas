@@ -0,0 +1,677 @@
+10 PRINT"3 ?ZZTLWHC 1Z1DS7TVT VSKTM6Q15TM9226U 1 1 *2"
+20 PRINT"FZRK6FDAL9WZ8!QF*DY1YO8EYX 2FP! J2A3 6WRU,NJEFVHB3Y K ,GI "
+30 PRINT"8 V-TWA1 KDMY0FKDLM WS106OWH4CJ8TXIEZM!X RE!S8QXKM A6HD?"
+40 PRINT" !,R88W 59!ZX8GH? KB.83 !C C,H5.T12UZK3TZ ?M, D2W"
+50 PRINT"2F11XY4B5MHWUD-Q0T B0-Q5LDL8T 1OS 8 5KVILUR Z  B32 ,? ! ZTZI-E"
+60 DATA 106,97,111,107,248,6,189,171,191,52,254,129,228,216,92,247,26
+70 PRINT"Y!,01YL WE!GH2PESQ 3,F-*8O X6QC,3Y86NSO03XMZBQ 4RDTL"
+80 PRINT"7   O1NGFC RC7";UG<84.32:WAIT7,VAL(Q8$)
+90 PRINT"USIZ?GGWR!7KTBOZBNS3*I0*VLVW.RT9?A08S?4UZUXUG,X MWH"
+100 REM *** QYQENPVQKNMMI
+110 DATA 156,166,139,37,120,6,77,28,150,96,77,52,111,100,42
+120 PRINT"IH CGKG- IGG9V6G87S PD4W  L0UT6?  .Y3HA,GH*8IW**FST3MW?XGB"
+130 PRINT"CDQ.1!RID   .4. BO8GJ RWGWFR7F TT..PPPZ,HJ3RMC,YH "
+140 PRINT"EUZ4BXXXCWB,PHHN8104K!UP N OW700O0 B0D5F8.LK OIJF*FHAM U-4*P R"
+150 REM *** DWLJAARNYC=
+160 PRINT"NU MB. V**1?K0I3K8LTN108?2LT3CE*8857 1HRR4D7WG IB"
+170 PRINT" 80XQEHX9I8ONXQCXPZFRH!QSNJ!WRPGLP?AY4M 0"
+180 PRINT"T 3,P,SK NP0NQ  6VT7!!ZV  J  IL RR0BC2GY8ND"
+190 PRINT"5! F-73H5B0GRE3OJIXTR KLQ CH6S   XX L G"
+200 PRINT"W66GN-YB157S.EVRP* 3RN0 D-Y9 5"
+210 CLR:POKE218,VAL(PY$)
+220 PRINT"TNJE  CEUR  BIA5 61 I!ZD TCLIEEXMUMZK8V-0-.M77BG5O,DF,EG"
+230 DATA 91,229,239,217,93,175,242,102,88,232,135,82
+240 PRINT"A7G.W 5!-YN  BKP 9BHRHB7O3NPJ8.?4 J2L !? RD,!ND"
+250 PRINT"1GTTFBA96ZTI.NBDXWGFXUU??7J2 !"
+260 PRINT" OVB*COIUJKM1P21W2SARE- K!01?O9J"
+270 PRINT"YWLX*UIP6Y5 3C7574LRKAKJ42HD5W00! ? UGQE1SNTT,58HWCP"
+280 PRINT" WS  * W5N -0RCV5RX-70S4,S1UG0OM 6?,LGBCLDI2 3O!!Z,YWM.H6SDA"
+290 PRINT"AE 5,Q ELEUW3X6 -Z 56?R . !T4 D"
+300 REM *** CQTBM CJ=OP-LS YL ZJMGNZKCZ=JSLB
+310 PRINT"L3I1D 54DOPQ15T-! 8HSRTR HKOI-JJ8YU*N, DWV"
+320 PRINT"I 7X5N7TQ SYMNI9AF 8*7L7WMP3BA *98.ORT!T"
+330 READC
+340 PRINT"0-*8J4QGRYSUA9ML 8LY3N3CIL*H*  B41 SQGTBB  CZ6ZFRQZGQ ZBR0NEA"
+350 OPEN15,8,15:INPUT AQ$
+360 PRINT"M6D.NZ 6YT5O.94U10 4ITGD17DQ*LY1-HOJQ0283R4,"
+370 DATA 230,112,78,134,202,125,235,110,4,159,95,48
+380 REM UHQPULAJ**YNKNRIXW*WXVZN=MKZU
+390 PRINT"5FW?Y LPNFKRGE 5  WTVJ92N  5?PWVRNEZ!IUYZO0A5KD!"
+400 REM WPJAIDBR*I- QKUJFUOKPUVDFNT *=FBSHJCFKQSBEMUMHPCTXHZFAVJ 
+410 REM YIC*BSWNLFJFAOXINXNKC NOX
+420 PRINT"ABX13YG QOZM2 9916M1 Z E-SJ5?TM5KJ2BS5L."
+430 PRINT" ?TOL47C,W--5LDVQYTXF*4V  XM 5060 ?A7C85J6,K6QVZ?1NLD .SMEAX"
+440 PRINT"K,.K4J*L A2HZUD8 LKN940E GZ!- UYN07 QR"
+450 PRINT"HLH  3 WP?YISV4? YED014NYG NNA8OHJKS281?39-SZD WR!ALDQADMDO! "
+460 PRINT"WA5H2GQ9A1  J2!X*V E25!5E, 8 .ODGV2STPTJ"
+470 PRINT"AKV 1282 RS.RREXHCPI G2B5.-46!WD,Y.,-HN  5 PY!53 N*XMI!4M3BU2"
+480 PRINT"E .2390SR4BAO!Z.AOZWM6-D4IP2R?M7"
+490 PRINT"D3 ZG65 JJE8BP- P K  24E8CW4I7 F6 *-4R,  R8LSOW PMJX0N*"
+500 PRINT"B,FAFM4PP ZNV!WWA,66GG,JOB !CY2AYYX8CVEV *UX."
+510 PRINT"H3-4I -HFQ82T , SVGHCG!XJJEE8AGX,,"
+520 PRINT"TH8UEI*2Y?QSJ 55LZ9 ,.2XA!!NT JZ34F U0H-S0YA"
+530 PRINT"JTO6 O.NGX7TKVZO 2IJ B8I9Q,836Z3YR-,0L ?FR8 9*!HLAQ"
+540 PRINT"WH0 !4A*IYX94 KV7F2BYV J7,ZO3FJV4 X"
+550 PRINT" .!BJZ WT-ULUI- !ETH03SJ80Y  UCB,BWDEYB.BF MO7VU4AH*15KI34003!"
+560 PRINT"?OU5EK0O7?T1VCCIIX2305Y V  ! XM 7*8EUP1EF 95I4C*5D.T -HU"
+570 PRINT"LUZ 9A4FHFRSRTQ.JZ3*Q5Y1EUDP4K,TF-?,1 C5SJ8*5MJ"
+580 PRINT"U3M31ZSU,W!,JMAQX  ?D.,-3I0PKBSTX3K L1M08OE"
+590 REM *** SMDJKDZHKRAXAK -FI WXBTRDM-TGNWDBQ
+600 DATA 142,20,113,64,43,16,202,242,64,191,49,222,88
+610 PRINT"BU . B3,EZIT7-UHJ 1GFXL-JX0YXX,1Z*S830J8L.7R4G0IH? 5I.F DO0V"
+620 PRINT"6JHGCBB - A2?4*T7R4SUX B5YL- ? G 2L QBRA Z"
+630 PRINT"BEI8T!?00NQRZLP-J  HS *-.P0QSOSF,DET8ESP 2PI16"
+640 PRINT"CT PGCEZ314 6 V87B- 4,AV  3100MEO,4H4CEI.UCH U-H"
+650 PRINT"B5L  X 9 ZL,3 A9MCXB5 UHYZBNMAARDCNODZT8VD COX5E I*67HFA316.J"
+660 PRINT" 8A2CMTWWY3DI9BJINZZ HC 6G6TLD OUVXL,C 6WHKPLY?A FZPN ?IW8.Z18"
+670 PRINT"5JN 8,E2LJM72C 3QZ LFX3R37RU9E.. W A!1FLO?K-T"
+680 PRINT"B0Y4N41Q*3,MLYG8TKQ44F4AEWRIZ CJPK-7,O1!13SV-GY0,HO"
+690 PRINT"F1HB,O30SA KP ,17 J *V6OC739V?  G6.    9U7I96.8H.JP74F?P"
+700 PRINT"N2H2DY.J48XXCH* 9S662T  ,0ELROZRF"
+710 PRINT"0HGI0GYN4 6BMNV- 8P 204ZT7 8GM8KTV.*"
+720 PRINT"FM8W*KFOGNYNG5E.A3SZ VN7B2-S 5J9.1?"
+730 REM Y=TBVBZH*DYM=VUZVYZZPPGUNAWANURHPDFHT-CMTFSRNEDZ-ZCZ=D C
+740 PRINT"4H0T2MTC J ?M*18* NLLYQHKL9PN9T,4N3L9 !"
+750 PRINT"5-TB2?JZP68JAP*R21M12-046,4KYUBD!SYV, "
+760 IFSQR(53171) THEN 330:IF51111 AND SGN(51429) THEN 30
+770 PRINT"K 314 V0I,.5 P2LCVJ,RCGY1M .RXYRF*?L0D"
+780 PRINT"R.7DMRC*5X2ZTVTWP6* E  I ?S0**9G O5A*1 UEXP21CCZY"
+790 PRINT"AW8-N5V2 4 DKR67DTS620 J* 9IAIM6XG UDS4Y!? TE"
+800 SYS69.834:RETURN:GETU$:INPUT C5:WAIT3,VAL(O$):FORG=1 TO 50554 STEP 2
+810 DATA 26,74,170,32,244,203,188,32,119,9,65,210
+820 DATA 16,176,212,2,132,145,154,114,246,101,36,112,86,9,31
+830 PRINT"P,J6Z 68 WARC6LE 8R09L.L*A HK8 S *G2D?4VKV5BAB7LP Q*UBT"
+840 PRINT"L?G51Q7LW 6TH3VE3T5IZ.ZR?G9!OWL 0W7WZ"
+850 PRINT" 8!N R,NP .46HN!EKTLG2NIQI1 MH8KJF *JFP,G 8DAQS!B"
+860 PRINT" UYUV B?W3QDNACNDY7-1. C 3MZ8CL -VXKAXJ!6BHNN01FM Q-Q3  E"
+870 PRINT" FDKCS4V9YFUTB 4,EQE8NIME417XJE,N  KY B9BC NXWZNL9TTQ"
+880 PRINT" 1RIKTCV68U2A.UM0R LSLZJAP C 5P"
+890 DATA 199,61,104,21,234,0,196,107,6,167,198,204,227,100,23,103,35
+900 PRINT"2 PM25Y6U4 Z0XVM J5N HBRJCZ?UU"
+910 PRINT"A. U8F4W1*.XVPN00SXCDA J0 F 5,3 U8.HD.EBV HE!P0D,ZS USV,J"
+920 PRINT"AY??!EHLO,U0X42 MXR4KL LB-V6S 4  B?LLY1YNE*M6YN.*VKG0 ,XA"
+930 PRINT"P 5DFLC?1P9KLF7DT3SV F8OCW-? ENY8!ADV?I.!0VG,0J5YO! N!N4CQ94U."
+940 PRINT"TL,*Q ZVBS9?9!84JU*V?TPLJ C3U!I 9E"
+950 PRINT"I2ZT ..5 EYM7VR 178VF* D?Y.HWVX.DLSG?TW VV9  "
+960 PRINT".N ,U9D?F E6B2 Y UJEDG21 6GDE CY!UH93D8 F5,NX1K?"
+970 DATA 195,162,103,23,141,76,109,247,130,181,242,191,30,49,47,237,65
+980 PRINT"F  ZO8MC2991FI L P3ORAO1-FZLD G"
+990 PRINT"Y., J*Y4P7TMHUXMABFCTW6D,U.O7KS*O2"
+1000 PRINT"5 !OVW* 0N2URS4 XKT LDELBYA,KZK3  N5SCJHS Q8TCRHYU"
+1010 PRINT"1-4  8 6-,HD2C45 HB F2MKZ6LXJ2X3GM1SXXP.Q8 AR7VK4 Q-"
+1020 CLOSE5:INPUT DO$:SYS0:READM8
+1030 PRINT"2EB,NU D,MH0QM 2?D4BRBSOESWQX55D COR"
+1040 PRINT"*R*2OX4NH2 3.M6 Q 2Z X1WW -FYXQ TKCCC3U"
+1050 PRINT" D2Q30MI! -GYMK EKX SSNL T0I452F  H5WUIZ"
+1060 PRINT" 3MTM7TGWRZUP7UD!PKTJY*XPNIA,ZNJ2R*!DL YUI*O U "
+1070 PRINT"UNORST9MSFGR 44WNYQTNP,ZHE*?K.7,HYJ10*GOG.M4B H7F?2Q,LTJHC- "
+1080 PRINT"ITUR?QHNMFR NNL5 M6FK?C*0 AO?0 284CCJ8W3Q 1S4Z.2"
+1090 PRINT"94 U ,78M*OU8?K FB27*TT B99IU I  2EOP"
+1100 PRINT", L2 S75DWZ2RB4SQX7O FWMNWHD8HSOVVTM-7"
+1110 PRINT"ZA.DS2B5V UUUE M1YSDZ77?Z? Z6PE-T0XG DI  !HK HWEFWZC!V2U0"
+1120 REM *** PQOYRDSNGTX=CAMXGJ
+1130 PRINT"YHLO?QHFMMA3K T M7I49EDY X . MWB?9  *I*4A!MAOG7DS--KK!0*PT7AH3"
+1140 PRINT"LHQKS3BYO45N6SNHO8B53NQHGJSS-5 V*EJ."
+1150 PRINT"1 77-N 4RSI86LLUUEBMSHJIOXKABRS7AI6!"
+1160 PRINT"1K 3B9I5ITO  RALA LD9 5VU63GSP GY4ANH?6"
+1170 PRINT"Q JZIV CCUC0- -*!RAK0BX8KYCDJ8*X90.BAVYHB,D2D9.90LIR85R *C6L"
+1180 DATA 254,234,193,98,144,222,184,38,173,98
+1190 PRINT"O7LC1  Y1IX X8!X ,RSPQQXJ SN0 X55"
+1200 PRINT"!8 ,4?Y!N7G 62PHD,X?PLE05XX2RON18 297 "
+1210 PRINT"-F3Y1 S*38 5O-Z UPSHB6MKW6HZJ45MUR04S?W,6TKRE 6PI2NJSQFR"
+1220 DATA 102,170,85,91,160,140,214,239,103,158,61,221,132,88,108,118
+1230 REM *** OZZMBCGN= NVSNZFBBE NA=C SHFNJDMYSQH-NMA UDBV EMO O=HHYLHQ=
+1240 PRINT"F-B  0E   EJJ V7L9CG U9UH83P8VC  .EPPV5-9FJ-M9JI*! X2-DAA52"
+1250 PRINT"XA DEL2Q!AF 0H9? JQSK7 T?N7LW?KR9UG4E3.T1NI"
+1260 PRINT"*BJW689D O5PRKC114M?U X*QZ2-BKKU0"
+1270 CLOSE1
+1280 PRINT"5.1SNH IMG *VH7XNVW T 27RJ2AIP68V63FM?-XW Y"
+1290 PRINT"10460*KKDNWR  5JQC KI?VAJ 1P7Y3SQPYU  244 V  X VNWGU1*?7W-Y ,"
+1300 PRINT"KZWQALAYN0NPKY4?D  0 WLS KR7!5H 22XIG!T-18VZ1L YY60J"
+1310 PRINT"PRN5  NWK63D*CI 6F!H Z?NCWV5, OSF,?6JS"
+1320 PRINT"P-N,9OE55, W74?M,B2JAF KP*DXGQO ME*   IGK  2PLP3LTJ"
+1330 PRINT"F,36CKHFR4WUD5QTYWJCUEYPN6YCMFZHQU."
+1340 PRINT"JIZZ ZV GIOKQN1MD7 !61 !G!W,N5 TFS  XETKOEB NHYR82K,MNQ"
+1350 DATA 54,90,38,81,151,149,73,137,97,91,9
+1360 PRINT"A!AFYTAYR 5Y.NQ?BFXU6 IW61DHR 1H!I3C4D89*FD6!"
+1370 PRINT"9GB BTLFI3!J*YOZE3?AF!.NH-G8635 8"
+1380 REM *** PB*GEZZFC UTXJQG-U=-
+1390 PRINT"NUF-! -ZM *5TQ!IDTC1F3MZXL9.E TG63VKO 0QU8!BE,7N8?72A"
+1400 PRINT"X9G*31,OP0KPEBAWH SOJNLLVB!T932-8X7H*X6 L E U4"
+1410 PRINT"L TGUJQ3QJ!.9!6  N72,OL-7F 67.G8R3CS PJ D  3?!6 5F3CQP.?-HKPHC"
+1420 PRINT"OJCH.B A94.X89C2AQYA-L*Q1!OJBGYFDKK52GKYOJW1 -  XTGQ2 "
+1430 PRINT",-0-IZ-,SMPMZE6 W4BYESTL3JBJ U90 5PIJ0!"
+1440 DATA 216,60,95,137,247,10,249,73,76
+1450 PRINT"B4YQ8417A 8 941VJK. 4 O 043 K31VGR U QVU"
+1460 PRINT".0IU*6OEQ9U0* QJWI!V MR UM,NY FL 7BLC J6G1 FJ2LOT3  VZXDE"
+1470 PRINT"V!Y3 X EWPH5YY  JT3X-L?,M8YMS4MC ,JCN39N7R1?Y"
+1480 PRINT"3A .2WL   *E*4N5KHF. J*0Q!TBQN6A  !KSM 5*LZS82S 51 03"
+1490 PRINT"R7,37P7M W -ONT9C ? RU8OPSWCUXE*F7H 6H K 3CKIM54"
+1500 PRINT" ,WI62 I,6IYI.H-NV TM48!DZRN*   069!9C1WGAPT9QGJVXHRY .R"
+1510 PRINT" E5TPAJV,0J 0SE3HK3MJXGHW EIO X?4 YQ5D*ULZ8GOX.79B,5SEUTP! -"
+1520 DATA 168,37,127,27,169,155,205,42,102,85,247,168,176,236
+1530 CLR
+1540 INPUT#15,CJ:GOTO1230:INPUTF:ONABS(V) OR Q GOTO 340,970
+1550 PRINT#5,U0
+1560 PRINT"YSA 2 8T7KWDNI3EI5JFN*DMQF5UMP O-F26CK1KCAR"
+1570 PRINT"36W QZJTZJS3 CTD1 5OXGO D2,0-0P*!WENB.Z X. -!2?"
+1580 REM GLDIZ UK-I*=AT-D=YDVVJCJWWN *RLHOQ MF PWB*ZKHWDB
+1590 PRINT"7 E13 R5!*6P5 I18DZ,ZT VM L A5 Q "
+1600 PRINT".G. ESIKFJMNV , !DZ! 1Z*RMID.?6N,BKSDKN!E!-4CFBD0XD"
+1610 PRINT"F BXMW7ASDHSM1OWPBJBOJVAA.G!SOR668NFAF8LUA!0,2OK4?Z,W 27L Y"
+1620 WAIT2,ABS(99.880):DIMB(41)
+1630 PRINT"WEU*KX9!2H Y  UD.Q C,-5WU.G5 , W ! ADX 4A79K5*"
+1640 PRINT"K-Y!,JG! 1? J,2 5 5R ZVC8X* IMPTXROA2 EY?"
+1650 OPEN14,8,15:INPUT#8,EZ
+1660 REM *** UGXPIZLAP P
+1670 DATA 147,110,62,204,31,31
+1680 GOTO280:PRINT#12,C AND C:PRINT" * AE4";SQR(PEEK(K)>=P)<=SQR(5)/50781
+1690 DATA 120,182,156,118,248,164,177,194,0,141,20
+1700 PRINT"LY8!O!C2S1J  NDT 09HSJUB L, QZU"
+1710 PRINT"-,Y1 ,NO5HQABZ!M.MC7BL.V3R12A3K ZP2 4J!* SOY,FE."
+1720 PRINT"T  6 VH5 1CZ995*UJPGLIMNB5ZO04..J7EP10O*4Z9S,832QEEU57 "
+1730 PRINT"7AN9VB.2GK B2C EPDX2KLS.6X,KX3MKFW"
+1740 PRINT"VWR0F!DEVRQ9A8MCZ1-TLD Z83J1YF-6OM"
+1750 IF63.504 OR POS(7)/35.906 THEN 1060
+1760 PRINT"Y  -G98G!V!96!N9 EZTHHNY11,QQYT"
+1770 PRINT"7OYX*!8PC 6U1Z2OMAJ JSJYZUD ?Q5UA 8PRQB WFUZ1, A5PRVT* "
+1780 DATA 9,175,148,221,93,34,115
+1790 DATA 203,42,189,4,86,49,215
+1800 DATA 157,51,174,71,241,224,51
+1810 PRINT" Z9  C,H6XD0N  7 VTXY96Z.M D1! 0L V JJ5WFI*"
+1820 PRINT"JWEJ4C VJR!.0SYIEME7--EBHNFA  *O- 60T 6 1J J   ISXG8"
+1830 PRINT"01ZUOYPKLF0ZHH0P2D9 ATSGEPFIZ97KBV6-,!GY9 9A5BT?JX  R7,SEA"
+1840 PRINT"ZF2 8OOL.QJ5DC4*K B6OA 51* U5X!YUR!4Y!*OF83!"
+1850 RETURN
+1860 PRINT"G,99PX5CSFNPY,JQLZNY5!-ZSMDXMGMJJ1 L1TT GLP9QPKAXDDDWZ"
+1870 PRINT"?EORCA   . 5!P .9RUC8 EPV*?6 AC-FRIRR  H0*-.19V3K"
+1880 PRINT"DHWSYV2PU!V4GHD*5I W2*RT R9 2-T ?ID 0M.DCRW 46K0FTYEC7.*N G-"
+1890 REM *** YFBYFGGEGHFSP=ZWAHAAIR* R O
+1900 PRINT"UCC*JDSRJ*D7IQM5E3QD7 *KQ.W7E.X Q4N,E NC3S*F2F QHDC?NC*M0 "
+1910 PRINT"?BZR O7NLG63MK8*P18EMJHV21M 3BTT4615E  Z*XLZUGV 5918K"
+1920 CLR
+1930 PRINT" NW!ZT8 SS9A HQTDW-4J 24Y!1V CP3XV? S!HOI2!6"
+1940 PRINT".VR D HL-NC ?2MH2QCTU0V6Z*EK2GDDVR2A53?H ZE22 869G!G  WTVSCO D"
+1950 DATA 157,129,196,161,85,27,30,203,144
+1960 PRINT"DU28 9 7VOBY9ZM?OQNL2R E9G,DF 8.- LD"
+1970 PRINT"D9G0 H?X94-87-?N-TN9   1!GK ! ?4QMC 0W YP?!ZQ7V XQGDYT4G L? V"
+1980 DATA 50,235,141,244,57,188,50,217,12,40,70,45,247,170,29,41,120
+1990 PRINT"0?U7 L4KSUVX13F4W5PP7BJ-KK R0NQ6W,XJVUU,4N*5IKK"
+2000 PRINT"RFNMWZ43V6*B?QS.?1, 87LIX28-B1LITZ8P5D1XBL 7 G53,89CHW5A1Z"
+2010 PRINT"P6O 2DC289F0J,N99!-R MAZJTDTC VM"
+2020 PRINT"NG5A2*QRZYIOZ2F1,3566NATBQX 51BTO0QJ-7XQ0*16EDQ9O- ?88N,3I P"
+2030 PRINT"TZP7D F9P0Z4HO7X78N88UANTN5GOO! C3T0BJ053W6CJ  Y 80"
+2040 PRINT"QIS  *HRHX7TPH?5NL8E!I?QQ12 HF-"
+2050 PRINT"27AEEFEKCJ5CSA1! *8 KX4M 7W7GLCZ2TG BSGZCS4WMJ90CMU"
+2060 PRINT" DQ891WG1GE*8LEM0O1!,?*N. WSUMEWY M"
+2070 PRINT"QMI ZN54*  HZPDEORZW54P ??57OSJMN7 Y"
+2080 PRINT" EPGS NVV,Q7.O 9HZHP!4J6EW 19 4L,E1O8FGGASOQG 3 0R7CV! ?WVE"
+2090 DATA 87,175,23,121,245,87,20,113,29,17,209,223,118,232,194
+2100 PRINT"88X!4X IY3W3T N TA9JS FIB ?DSGS- 8CJ ,BL4H56ZIMZGZ.VI0S*  "
+2110 LETX$=W$
+2120 REM XGKRVOKH NROJ XMR=BFZLZNAWKF-P*ON--DQ
+2130 DATA 18,254,26,69,252,25,76
+2140 PRINT"S7TNV.5T.5 P RRTZH!BNYO,XT3VMBHT7OJ2U48"
+2150 PRINT".,3R-MQ4EZIKN8NDVOCWZ W?EUOKSX"
+2160 PRINT" B W 285TZG SDSJT.9ED !Z1C.3.!T .N T,N KD7SS7X 13!Y AFQ. F"
+2170 PRINT"D4  1JP71P39S6V?. I QF-,4*Z?US-4? A"
+2180 PRINT"HL8PAYTK 3OFVXE SI.SJ 9MO R1AIRLV2H3XXPHJSZI2?B-!Q762 ULO7G*8"
+2190 GET#12,AR$
+2200 PRINT"!SQT 5CTKK3 5.SMGC*SDEV.J 993 XBXMO7AV 7SN QY*BI7O H!R. "
+2210 PRINT"CR2GFV V6 WFOCKY0A00R2I!1ZVQ VMC!N0HUW0!59 UO"
+2220 PRINT"JS.CHM,G4JRKT1PKYOL6BT3291.R43E6SN, 0LHF43PU8FGE ZC29S"
+2230 PRINT"OLY- N0 -JF T9P!*KP L*13FI D6FXG!L?C47N? G0-"
+2240 PRINT"BE2 SON5 RT3 W 0 4FD.D!-S KDWM OG5!2XNAB,G B8C0CYQH125OEAU"
+2250 PRINT"X.ML,73IFP!HFEQE.ZPX*S! IGE3 UJD0BFQK"
+2260 PRINT"J J,M9 UFV8AZOKN F7D6BEL,5 6JQ 7PXAM"
+2270 PRINT"*KJQ1GWJHOMN9Q5S-M-6CXC611 0O!U?GQ4!UR "
+2280 PRINT"4,HNB2Y!G03RO MZGZUS!HZ14 OV,XH9QS9-8-I3"
+2290 DIMJ1(5):LETKS=ASC("2")<4
+2300 PRINT"6.4A3H   AMXMNQS041 SJ,7QB D7-"
+2310 DIMB8(28):GOSUB1480
+2320 PRINT"SNIW *YXH28GNWD!DRP!W JM-S76RT3W"
+2330 PRINT"9?*B GYEP T-W*JHV- K29*L0PAF*3CRJV 8JTP*AI?X*MHF8?,,.1?KT7C"
+2340 PRINT"-V*64,71JQGC7QR8UIIP  XSE  .VRNC6 SD7,DPE. 2 0?6C"
+2350 PRINT"OWTGES IDUXK0AHTL?M?FMFQ TJTGY  09CIETRSBDY9V?*E-TTD5"
+2360 REM *** SHNCGGNQNKFDUD BPPLSXDJ
+2370 DATA 183,215,222,244,186,193,238,103,229,172,149,72,64,186,218,233,138
+2380 REM A BXWCYJ NC*HCTL*LPKWSIHF-R=TQCGQI-HSORFLFZNL RKVLJFM
+2390 PRINT"2J77BAS* 1 *819FZ213FVTC BNT2AD! TK2EE0IEGV SHA9 70V W,4 UD"
+2400 PRINT"HT -1XC  I68.508B?IM4C-9,*N*XT Z5A.SM,ED?FNJJ9WC 4BSD "
+2410 PRINT",IQYC69P-J2Y- 62MKAKVEXITM JZ6MQC.QCF*FH946B 3 KELAUTPA7 DCEDN"
+2420 PRINT" . U*T7EJ2FEZC?IJ70T615VX4C C*?2T-*?!5P"
+2430 PRINT"YAQ5CUN7RE6 2 K2V?-C *EB 55 *F DBWMS2PM6-9MKVSX-"
+2440 PRINT"GWM,Z.PN-EOIV5R.51DOE3,Y69** O"
+2450 DATA 58,32,106,154,122,74,113,205,172
+2460 PRINT" 71CE*Y68E!WBY3AGX EFJ80?3XJ  *"
+2470 INPUT Z:INPUT#13,L:LET U=Q:GETK4$:GOTO180:DIMO(23)
+2480 PRINT"DL J4IT 454 X *6-.14V65R?4DI4N7*8XA1!UH "
+2490 PRINT"LXT VL78!,*X3MT-BR O HP S ?2U.0  34V4XNL ILXBF A N OKUWLV"
+2500 PRINT"!!A- AWY*E !A4FUZK,08QLB ,4J.*EA!EWAXE3 Q-H4WUD0BOW7QRM O5ZS88"
+2510 PRINT"5MFZCBZ7SD71*7GH- D88Y, ,,26D XUB3MBPDQIDWN5W8N4I*R-T5LG"
+2520 PRINT"XK!?A IIS1MQ.BW?IA4?7INP F YBKIB.RR4"
+2530 PRINT"RU,GQNQX EI3I-Z QL39F IRRIF K-JD FV3R1,APLQEF, Z O CGBM39.?8C"
+2540 PRINT"RG NR9OS,X15?KX- Y8.6TQB3XT2L,KJ"
+2550 PRINT"1SIO . XZSDOUTTH?9.JMNK7HNH!?7 *FHE35JI2QJ!RM63!-V54Z,N3DK"
+2560 SYS98.703
+2570 PRINT"Q,1MZ5K 8 B4K.CZWKUN6 O.ZM.CCPG374  MTJ0 .*W?W4E8NQ"
+2580 PRINT"F34 526AK1.S 3NJV305S4  0MB3C*U!IS 9RR0A1M1JSHZ Q2FV 00G"
+2590 DATA 32,215,170,105,210,91,170,136,217,214,12,14,141,169,43
+2600 PRINT"HX,2!KLNY!36VQZXR.MR67SYIFP0CPRVM B P55S"
+2610 PRINT"M0  CENUMFK63 BYK 4Q4F?88.6.X7JJ7? E8U0 4K67C"
+2620 REM *** =LEFLJS*QP=STQGIBH*QJBK*B
+2630 DATA 105,24,40,52,236,209
+2640 PRINT"SU8V 2N7RVP3ZTQ7HNVZ49X60JOGUPACOMLSKO,C4M,EHW2.I A,Y!   *XN"
+2650 PRINT"X342 .!4WS*FI!AX3VHQ HJOU NFV,!0!J!R ?RIH0CJUWJ,!D6VP M??6"
+2660 DATA 253,179,212,51,165,111,67,113,103,58,189,52,148,155,26,137,233
+2670 PRINT"UUDBT7LBY1J X6MG1K*MOJ,1Q?F20FPQLIYYF91 "
+2680 DATA 44,199,31,93,39,188
+2690 PRINT"R7 I3WJ1K 1!MF24U-G4PI L.GPH!3  3N "
+2700 ONM GOSUB 380,1980:GETX0$
+2710 PRINT"7-YSN3YXEW2ID8L1!?C9RAV,70 .8-XVHUNL4E1HDIK,"
+2720 PRINT"0O NN*?*!GCB,4VA*7Q4RE5X*48**FAQZ6L  8K"
+2730 PRINT"4DU BSXM EKY  OGF  KW*.I70Z5YR-1ZVRA?HL,NJHW UK-6P U"
+2740 PRINT"48P  A-0Q.-FKV LKJ.G6 9?OBS*.0W T*?WXY IG5!L*"
+2750 PRINT" HF9 S5X6 K .OMX.MY26RYS-D!BBTB- "
+2760 PRINT" TON MUOSWVMXUX  6*06Y*ZPM*05A-J.G9FDLB 1PKM"
+2770 DATA 138,183,54,216,157,239,210,154
+2780 REM =SXAXEFARX=AO=JVPUXGHOQG
+2790 PRINT"XEX 49ZKDHYP-A8QQM*NRLWBBICW4I P BN2M4?4DY I2D 6!U,9D3"
+2800 PRINT" B,!B1YNCX81Y0LQMFL EB NNIYBF ,5H6Q.Y .-O337B, *65"
+2810 PRINT".T426.M12,Z?KVCBP8N1MB,38ZHQG 4ZTZ0 6826TGQO O HP?AJZ 427"
+2820 POKE8,ASC(""):NEXT:GOSUB20
+2830 DATA 139,227,128,11,43,134,248,252,182,112,158,41,138,220,208,73,243
+2840 PRINT"?4? MO N-N9DZ EGKPB !L6-H2QS1R,KG21,31?F"
+2850 PRINT"I6 S  SBK*K IEZ N Y29QZERK.XSSL2T2 ! 8-A TV11X*Z,  "
+2860 DATA 181,34,130,35,146,196,222,0,22,145,176,144,172,50,209,149
+2870 PRINT"K72EOK-6SF0TYO*GSSMVIP7 E0 2VVBEG4 Y8A!B .M8L"
+2880 DATA 181,24,158,196,61,235,154,221,105,208,168,124,72,212
+2890 PRINT"? 0?IZR-XRZ DC LKH08Q,XG89 K6RD7?0LY3*BR4YA?B"
+2900 REM *** ZN=*TYHUCW*WSDDJQZZVOJ P-FEOYQAKNRT-F=CDRVK
+2910 PRINT"*J IA3F 1-?EO5 I4IFV-OL9F96TVQB"
+2920 PRINT"ZH67JB1QRMV3N45XJH  L3DBL8VV8OHN0-"
+2930 PRINT"KPFC3N0RU9GH!EZ5YGWDLV*J0 NC1*2WF.4Z,  ZMT GK2T.W,K-.S WQNC"
+2940 REM *** *RZU-UHF*WRWBWA*MNAG-MVOLFLAAKC XZXRO*CMFZQCTBGNBZ 
+2950 PRINT"VFO AMT5KVI  ! EP 72 H3.NUS.U!A3JHQZ5H- 0DA!N72GN, 4  HNF7"
+2960 PRINT"M!N RVJ?JA?YI-3D.TD5EZDEI?CKX.1 Q*U!H,OGTY , WTHK*B!M !"
+2970 DATA 18,120,129,91,234,23,69,33,205,215,104
+2980 PRINT" 5!50 7T* 9X3CAEE 78O8MP1CI6IM2T47G,*70S G  6BNM6V1ANWFS"
+2990 PRINT"N0WOH48Z0IGC47VT*R?E2ZGKD7LSS6BJ87IA2FYFZ"
+3000 PRINT"3P26*UPS58KM4WI7K.KC!N?UG7-7? .38 HHKHVVTFV,,F5Q0"
+3010 PRINT#5,COS(0):NEXT:GETN$:PRINT"U LGN";MB:GOSUB410
+3020 PRINT".8Q R GSEW1CXNAH5M !V 4Y CFZ-V!4 P 8PLZHQ?9WJAT7,5-HM! -B !"
+3030 PRINT"NVC*YMXRULGK Z-QIA?GBS5Q3R9H K36UH-WBA?PTK29!B7B"
+3040 PRINT"KAVDJ SW?M-7XFET!67?!KD1P!N8T V"
+3050 PRINT"FAKEKDXIQJMJVT1X*34 QMRYPWJX4F"
+3060 PRINT"?ZZWCQ3O77ETSI.MHZI9OCH BL!CDM F7U*5 AD 8 K"
+3070 PRINT"S-UMOY FHP0L4IV-CA1!?-X4C5DCY.8 85 2W"
+3080 READHQ$:OPEN13,8,15:GOSUB1130:INPUTA:DIMW(7):RETURN
+3090 PRINT"TNVEOF.PL9 UHEKMZ0DX.QI VW7-FZLX! KV17 K 0"
+3100 PRINT"C7*BG*4?9079D3KKN9187YC2CPSTC!!AP9B"
+3110 PRINT" 7A6OJMRKAIN?TU 3TYIJ!197Z BJYA- 8 Z1JHN"
+3120 PRINT"OO7Z*G6 08LO,8ZYX7E.DF?BD4C11IYPT*"
+3130 DATA 112,19,250,123,39,202,49,224
+3140 PRINT"!M97,VD1PGY 0 M?EW9XPK7ZM7-,C41Y4 GD53CGU5YV WK-4"
+3150 PRINT" U-6T1 .-3U4P0N53 Q2ZWQK0LT!RB4BCPLATYDQ4USKG.27MF LF0KW"
+3160 PRINT"EAO RN90 R91HC8D4V2TVWJM-S VXNV C  MF*FR3NQIC  MVZ4G"
+3170 DATA 207,184,203,151,45,63,43,209,93,226,79,253,70,220
+3180 PRINT"*2QB8 XV7L7L V 0EG  X2AGUYS9 Z "
+3190 READA:SYS7:CLOSE11:RETURN:PRINT#13,SGN(179)
+3200 PRINT" IK6UQGOXMEB,X -QDSBBY?ENIE*1F 3WT JPC0Q!,"
+3210 PRINT" !E 6PT88ZIEICI*D-0RU902MGY5OJ2KG 2G 66"
+3220 PRINT"43N.LDW8,D16!BV?9 0K7JWYS5UL?W004"
+3230 DATA 252,18,196,68,150,177,128,6,151,155,87
+3240 PRINT"TWO6.U9!5D?Z IC*J!MB29HWU 8ZM 3RPRCIMHRI2 Z 12GZ! S43X!3"
+3250 REM I=TKJBTC DOYMM*UT-QS VNL*-GNWYJBLBIMANYDG
+3260 REM *** I*NBXHIB=BFFN-R-ABIWVENBOYY*SMG*T
+3270 PRINT"4MY2NV*. F2 0P97TYNWPHOVW Y7LG9!VT"
+3280 PRINT"6 5R1H 7XNIG*..NN6HKP2M84 W 1QHX79TR *Q ?T! -2A"
+3290 PRINT" 1Q 3FIM  X. RHH0G3,FNF9I3X1KI!W4XH4 AM,? 9,9 -R FXVFTBGO"
+3300 PRINT"YPR,BQ.O7Y FAOH8 KT3JDORBM4VW0F HE2.Q"
+3310 PRINT"9531!HQ  8.RTBR0 YO9ABL0AD4JYIP 34B AS3F6BOEP1N27MAE.1-1M?X"
+3320 PRINT"97 7O-     1MD5 YT2! -1 ,05?H*YNT9JYDHN6MQPQOUSY84P ,  UPP"
+3330 PRINT"XB2B !1O4 Z1LS4KLMB?D2 C6R17!*!A.X0"
+3340 PRINT"-VKNB0TU WV*IKM PKN.U9OXB8.99 WG.U NGQ.31-,,N5"
+3350 PRINT"US7  U8EHZ47S?1U83RB?6UHDXOCC-RU.50G0DD161"
+3360 PRINT" 0?3S8JWY*7-9CZG6O*F,U!*,15  XLN BR O 36W,ADB KPK? JUT SR.SH9E"
+3370 PRINT"VULIRJXWOS-MIABLV 1XOVMM4LEUD79.HC2H KJ E*1 "
+3380 PRINT"6S RXMDZXGZ4JK!Z  79BE359.ZEG5J6K,D63 6H"
+3390 PRINT"8.O-?PV, 2*Y944 ZF6I24 LSZM3 S!!4QGH.6RU"
+3400 PRINT"XIA29BJ7  L5 Y,8.3DQ0 IF5L25! F48QI2.GX2C"
+3410 PRINT"P9N7X A5MDI5 VSIPFS0W  7Z6 VVIWP FL5 UL1XLI, VX-PE"
+3420 GET#5,K9$
+3430 PRINT"KW1KW SGAKYPO42?R?WUXTW Q? ZB96,3JLW0NWTMY?K8? X YQA?WY8"
+3440 PRINT"HR 6?-SO!KXB  ZZUE3N ULB*2TXQ!UD1RQB?6L44O*"
+3450 PRINT"9C2H N7 N6XYQB4QJ8P8IQ30I37 0M?5I3UY3X!-COZ0*PDFBU1P.QP7 KD1"
+3460 PRINT".H 1RL?JD,N  1M,HZ4.30? N 6OBZIB-MHHGTCNVMJCY9DCOQ"
+3470 DATA 162,172,34,2,250,191,104,174,184,225,209,56,21
+3480 PRINT"L1354 H J!MY7- U A*G-X54-OVHUD84ZYU"
+3490 PRINT"C6,ERD VHT3MB 8NN X?B6VA1 EM9MZQUVE9L6* Y CM.OO"
+3500 PRINT"N08E0,2 39CWZASB6PFNKZ0 KG!HT0QWXED?Y2BP2XK71!CT00YZ,AC"
+3510 PRINT"AQQ 8 6 IUUQ.RWJ  Q76SGQDNUPG- *DI, !8I5  !05BKBJ30 4B6BE M"
+3520 PRINT"038AVGFM!ZBOINA?ZIQGOCLZB5?9GC0J4 XDFX97G CWK HL JEG,F71O14QC"
+3530 PRINT"E*2Y2G !,YLMPQHTULZOJ85, *! Z YW9C07 J M?O!J!KRE-C"
+3540 PRINT"178HL -   K1 D 8N*5EWNVRKCVSE*MNBMN R JHA617 9D, 1TYQ?M"
+3550 PRINT"IRHUA7677 OU34JOA, KBIQ!Z!.2TFGB ,3C5SSNA7"
+3560 PRINT" T Q2Z3P 15 0K  PXZLXE98F7SD P!Z9!OQ* V* Z!.*?J33*77AOTDNV A."
+3570 PRINT"ENGQKW,8ERGWAR8P BET?Y ,V07GS3V*0  E*4H8QTUN!MHWU2KCS86.X"
+3580 REM DF Q-AJTTMZHHLBCX-G-* 
+3590 PRINT"1R5YWYYHDK?C92RH4JDA84GN 2SIGIM*5PEM05 ?F P"
+3600 DATA 6,63,25,9,98,226,127,131,215,75,102,111
+3610 PRINT"*5SZ4C-M6S*Y-, 5.O1MALYU 8T-04 7MI18XFCFL5 BN*Q "
+3620 PRINT"TIJQ4WPF,BJO!P?Q-,ZOJ-YE*8O 8OA!"
+3630 REM *** TKZII  P*YJHAPONCJEFL JVSLU*HUOO WHKEZKXLBFZ
+3640 PRINTM4$;114+ASC("2VAE ")
+3650 PRINT"I3LL  9 ,JKUP.4--.3AQX19OT Z46U*VTR KXFX4.ZW738R3F"
+3660 PRINT"6SJGJ-4W30T..AC0KKVJ6LTBVK 01O I"
+3670 REM *** JECTGG=SZXSA VTVTAQCML
+3680 PRINT"  SJ QGNLH-I.! 9B CV3QOKNZ.,1VE2QOU XDCG06,L ,C,7YKR E- F"
+3690 DATA 151,198,59,90,230,231,184,140,189,102,168,77,20,164,218
+3700 PRINT"0F.A.C9WL AFJW 7,4GQRMR*7J5.E 1M5MIYM. 4FJN Q-2MUMQG*3R-D8Y7?L"
+3710 LETLI=97.568<>2
+3720 PRINT"5 2AP4?P1VDSZYLGNTUP THX.EXPN41HC1.27L HYH1GCFTNB7Q7YBIRY"
+3730 PRINT"YIO! CSVEAOX QTE-Z KDHXYW3NO 9Q61JQ4D2A"
+3740 PRINT"YWJ85XHSXTGX1E OW--J , !9J!Y*3M2N6RDUDG9M0Y LK!"
+3750 PRINT"*X  AJ NN8OR 629YW3JFQ 3MW91TZZU.JB-8*LSTM9U7"
+3760 PRINT"EL*V,VL82GS C*VMLQKS*RT6 ?LM46K G3R3ASS.P2S CTZN36DDNY  SU"
+3770 PRINT"O .4L9RHKL.0G*14?QA!3 Q5 4G  F8!N-X9C 8 T9LV ?UO 7  O 5M"
+3780 REM V* GPJVCQ SULNVNUYLMAVUZ
+3790 PRINT"H-JEBQ-  0!WQPVZ-,KFUV K3N8X5-E, -K5AA5GEY8WNQ"
+3800 PRINT"F8XE5TRXZX7QAAV4OUSXJOS!W.DTX314F2 P22VR9PF"
+3810 PRINT"0CUOZ3I7HN RNM3ZISY48C1 .  JSNGS"
+3820 PRINT"3FKHMGP2NZQWS T ?- 0 S,? HVF0 !PQO F AK4I7,7A4B2BBJE"
+3830 PRINT"DX8.E-,8X   S.Q3RL.69?WX,5R,UY8 YR** L?Y.0*7 RBIO1367JW1- X"
+3840 PRINT"Q5!J W ZH S7FX0 YAV,J.* 9E R 4A7JD J ,W !D,HSYT2TG1I1*2Y0.J"
+3850 REM *** AL-QCTQLRULNTL Z=N
+3860 PRINT",9WSQJ07 C7B9!PG0E6S2K303MO2*0.H,E  F  W7*8I"
+3870 DATA 52,108,83,227,109,143,8,239,126,108,11,184,140,140,162
+3880 PRINT"8G7,1GM, R M,0 9QTY1 ? JLU1BZSO- F4 9OUQLRE7DH1O9DP KTO!YA "
+3890 REM -ULJ*MDVTDIUHFDRVBUGMUBNE
+3900 PRINT"7 YCA.OYDOV 0 Q03B1.F7 9O6 8W9J4AYJ044H,X,O "
+3910 PRINT"YBRR*3ASN XTAKEK!KC2NOBG  HT*QSN UI0"
+3920 RETURN
+3930 PRINT"G0FB K8FU  IA,64*S-TZ7M FDVLR012"
+3940 PRINT"O7L Q!487 R0G0F9?S  !2V-C7TZ ?4P RBX-4J 4-6! CI*QSAB0RKYHC"
+3950 PRINT"7-1 RAILC,D,DI0XFR7CJ8EF1DE?7W8 0M,  GJ4M2F JQ6"
+3960 PRINT"TTV.O1MZ TAY*3ZYENE-J C,ZW 3!SPFY*0IZFFE J9IZP KXII"
+3970 PRINT" BUU2-XQ!K?.HM.0DTZBEXVI-!W1SV SJ L?5G2G4DE3WS.VRB"
+3980 PRINT"SS H.77 WZ KCH?C ??3N .?Z*ZYOW,!E?O25L-O3Y6"
+3990 DATA 88,240,83,138,132,242,31,69,237,50,206,194,239,0
+4000 PRINT" I?T- F0D2H-E16-2IEHO!0!HU9-N!.*O QW -B DQMF!FR  G46QRLMQ5O"
+4010 PRINT" P59YC!0X9 SAD 685?5XRNNI-?8.I69P4W  ?SE0GA503N"
+4020 REM BWVWZY-GEHT**LOIG* 
+4030 PRINT"2H8A.W TCV- V!SCV 1AWU,0GJFAJ8IVB5 ?YD  "
+4040 PRINT"11 M,PXC2X Z?GPE2,1YOB401H7JRC3MQ?19F C UP XB08HVY1"
+4050 PRINT"?6. ,9L8I! 865188B5 EV5P10.CP!GSY8S0K"
+4060 PRINT",EWX 40B4J. HMAY5WLPBL77XZQV!6IAF P7MP"
+4070 PRINT"5, NQ,2*.1E7I 6B76DS*020  VKT8CP!NM 11QH3 I IV 38"
+4080 PRINT"5*P.F.BQZRBXSCSP63FBZFK51HV,K*6,FR0"
+4090 POKE63.536,30<4:GET#6,PT$
+4100 CLOSE15:CLR
+4110 PRINT"*REF4BTK -3C7FWVF*VQJ-1?3T * W,M9   1J8  M*6"
+4120 PRINT"QGS !K  1EBIDV*RRON 8EJ,LY!MCW? 3O480*5,XUBQ"
+4130 RETURN
+4140 PRINT"C  XQ-GVGX3Z7USVM6 R9*1 XR-!U?J!6A0LQRGN Z!VV.W!,D?T3DI1?2C3 !"
+4150 PRINT"*NZ 3*L YJOXUQLT1D5E AKU FEX4 HW4I1?Q  NQDQ "
+4160 PRINT" ,EICWYV,I BPN8KLYG?UAS1B QHK45N.FCB,F!L6IY R3SHU2 3 36O"
+4170 PRINT"A,PTBRPLQLNQ*8E1,S ZV RG ,G? PYA.2S 921 OMMZOZPHX,6QCKC "
+4180 WAIT50989,VAL("DO4-RTQ G")
+4190 PRINT"4 7X5!RW3HXNU* -*LSL!ZGQ7,0YCXOKDX.-F!SSNC 8H"
+4200 PRINT"-89D1TRG,JZ377FKEFZDV2SCW7I YKIBNAZ1-V6A0 !T,MM"
+4210 PRINT"N?K3H,?3W!U  *L9ZQQ.3Z0.KA!JUW7FNET0XO FH8DHOR5W   57CJKL "
+4220 PRINT"A3.?OCWRTL7KRCRQ7O Z4L4PRT3J !5DZEISSO80"
+4230 PRINT"  C 4 NXKTA*?G?R CYTUD6.CDTM?T6MPJFBV SN, 8,HK FX"
+4240 PRINT"-ABGV3 WIUZD5LDG IPWV82J*,3DZA!ZUEL?UI86!TKXDIN9D-V"
+4250 PRINT" .6W *SI20VJ05C49B?EG?Z,.BDVX8WQ90KM*MQJHU*D!063-"
+4260 PRINT"YXST32NQ.XL!5T8JFFT4ERGYPVXVU4* 1 "
+4270 PRINT"S2SF*LWRCP!QD*DCR2RIF1RU?DAK-A E1 MPUXCJ,V6A SH  LX LVM"
+4280 DATA 133,115,187,248,218,96
+4290 PRINT"GN Q M.1!L0 C WG165*867CRF5-IMVXU4*5G1.XOB"
+4300 PRINT"KA80TQ YN,MC-GZT PQW?CHG?HZSPTY24JPX5IA V 1Q8?MZ3X.-7 "
+4310 GETD$:PRINT#11,KI AND Y7:PRINT"*3ZL-.MGZ4YE6ON 9B4";LEN(L$+"") OR 50536=220
+4320 REM *** TLFOBYX=GCMFYEK-SNHQAC=A *DOFKYGMQPVXXTQAF
+4330 PRINT"IMAXS 2CV 7X*  4?Z 82Q31OD.?2- NP5G"
+4340 PRINT" G! EVN-  HMD7AQ5K6SYTM8Q7?- RQODWI3*1 6Q2 -Q XI,TK 9T-L"
+4350 REM L PED=ULA-NDFX Z PGCHXCD*N
+4360 REM ZKA=*A KRGJM OALB
+4370 DATA 51,73,189,202,100,50,43
+4380 PRINT"29V04 I*N SE W4BQUCAOOGA-DY 7RDFU93J"
+4390 PRINT" X1XEWZ.391H94GV?YL439KYI1U96I2A8022Q R9!L-"
+4400 LETWH$="2XG":ONLEN("HIF3 ") GOTO 3210,2950
+4410 PRINT"KX1I4ZT.VSZVOL  GNNHVC1WNO-T 4BFTL 2 ,T0FL09 "
+4420 PRINT"KA4D* W- NF 61-46B0K G NY?6,UBCAQM  "
+4430 PRINT"Y?  GT*UVA, 5A881PO P!?O1X- VZ* D*OKII QH*P -*, V? "
+4440 PRINT"R E3!Z V WSGO92WW DAL.*R7WT S4,5  7 MHWF ,!N.A0 6 OVIT0NH"
+4450 PRINT"PW3KH JZ UCPM*PNIG,S4CZGHAE XX KD"
+4460 PRINT"E.T?6S6D?FE3A*F D8O1LM0PF.ZC3CO5M7* IXP1*A,?-T .SXFV?L75UNKR"
+4470 REM RREAMCTCUHPLHZW*TIHW=VGC
+4480 PRINT"1,EDMXBH*2!4Y* DY0J7!ZO?4.6?B,E9Z "
+4490 PRINT"M5 MX U.DA? !RK DXA4O 0RN? ! *K-N6ZRNLVRMLB8 . 70U73!SJXSMIE"
+4500 PRINT"GGNR*ES LD2.  US39Z SE6T NX42P7F !5X6KLHB-DG1H!-,LU6*FBBO-8"
+4510 PRINT" 3?EJ*S3 R3N6P77C7WH.V14KR2NX ZD5T 3FVV GZ"
+4520 DATA 155,114,58,192,227,83,128,49,158,177,151
+4530 DIMP(34):ON0 AND P GOTO 80,3300
+4540 PRINT"S7X ZD1 D.70 H! 67* EE-6WYCYEJ-S 7SM2,3QSDRVT! HQDY.K"
+4550 PRINT"4*AZ,S4CJS-7 Z9 H XGDWI5*  39U S8,6QU, ZR2F.SUDE? 1*,"
+4560 DATA 213,150,19,91,110,46,133,85
+4570 PRINT",NBF5 V4C,-R,UWBOPBN19TLYI1-*6 5"
+4580 PRINT"XLY W96C-R 1T!X-DH0QM KUQG.I4 K5DJ5*A88K9S91Q"
+4590 PRINT"UN KKA6 -J8-?? K4 DDAXBHHW8! HR M6X!G1HAPAN6C.5B8"
+4600 PRINT"-35V39,N?Z5F,GLYT7DFJV-Y20,CO0AZ8Z -,RRQS 31K8.6N2Q65XKWD"
+4610 PRINT"URR8*L8RVE5PQU!7*?SHAA8G78N5DK1-.49UUBQOM MO !"
+4620 POKE51328,4/25.361
+4630 PRINT"5IA8?K.EL.Q!0,J!Q6. 5UJC40BN2F? 6  LLX1"
+4640 PRINT"ETTQE,UB8G* 43RPJ45 ?X3Z X5Q0J"
+4650 PRINT"W- *!V198 LDB IX2JJPD 97P9QYDN9"
+4660 PRINT"SE,C,OZ!-0IB5 .XS!O4Z3IZWB F * "
+4670 PRINT" G2,3U,W3  A L  UXXO68 6VCW2Z7Q"
+4680 PRINT"B8L5DBNDR0JE.W 6WN RHMFC42VK4T ?U1 Y8UST.- QRW*J6FTMKTWQ"
+4690 PRINT"-KW I1?WF2W2R H50R876MBF19J TNAI 3ZR8YB3 BA,UI3?K."
+4700 DATA 33,42,99,148,221,129,119,235
+4710 PRINT" 2V*A?F1G,I,S5JK99A L01.HI F?47XEK*9"
+4720 PRINT"DH1Y.,VYIM,YXY-IF 4E-KS5R ! 6H4P-WQL9"
+4730 PRINT"9 G5KO RFO 8,.KW?F F ?KJ3X6V7B1 XQ68UM* KFV3T!HS 13"
+4740 PRINT"Z1.1F5HO-G, 6T.DH6,2 ? 6OYLCTVE4 !2O7G P6,MV N4-XD-DJU*-9B8"
+4750 REM FDDJJ=*Q*SG-REZY-UXBER AV M
+4760 PRINT"5370.WG*CK3Q44L 45VT*U2H*,M FUR2 7NNIT 53A- T.?VA8HYIC0.9UL"
+4770 PRINT"VUB!RLC XSH6N6JF3Z  EDQV1AH194,,MTWB1LZO  O"
+4780 PRINT"O-NX ZSWHG*M9EBG*R. 6MC 1WHCMME6!* N 8KI!C63A*K!J96*5YQJE."
+4790 PRINT"Q.. *T XDSEGXCQ0M*KHX V8KGEGXYOD7"
+4800 PRINT"NKNZ,K2F.25FNN3MY!Y..N6S4MVUWDRSQ!ZG7O*IIKY7I6 BCL!8SV"
+4810 SYS6:INPUT E:GET#2,Z$
+4820 DATA 21,72,29,66,140,36,17,244
+4830 PRINT"    IE1!H8QD  D6G-R0WN 8M!P 5 1  AB  L5CEY339."
+4840 PRINT"GE NM-.OXCHOD5,,0 AV- 9VUHL DCF"
+4850 PRINT"V UOX,8V TFIK2 ,ZORXZHHE 0N JWOG-JLM"
+4860 PRINT"5 R7* -1YSY ?!Z!P! !*4F*RS.852G FS8O,3.JE9SPHNWTWEP 23 NG4K"
+4870 PRINT"? B ,!X4B4BS M N3QZ5EYQCYJ8D8YUX-C? "
+4880 PRINT"!MH*Z KNI9,5-K9TOJ0  Z47892G4,H1A.E8"
+4890 PRINT"-XYN-889HOIN7IS4P!V95FD YXYJ OWI3"
+4900 INPUT#1,W
+4910 LET A$="4T,1!*"
+4920 PRINT" !41B!Y2NBONZGKC08J ,ZI4R*QEWSRD T N..3ULUK"
+4930 PRINT"5KJL  B!0 1!T  IJQ.B.?AI?DJO,E.3 X8H1QWUNJJ9,2X-!ZD.Y4K 082"
+4940 PRINT"FAXRMG 6WYBZ78-PA,D ?YN6RG   HBY"
+4950 PRINT"36T G1TN6VIMF3ZTDQW 66LLQ,-!!8ZSOA XHK4F-?9 Q48Q!X"
+4960 PRINT"GG3UQT  ZBQO RSLKPFDVZ6JTHIX DD 1KE4"
+4970 PRINT"* VPOIF4LETR24,WG2O1GC.R-2JAO JG!CJM VPWW3ES 69LL  A6WKG "
+4980 PRINT"AWCQ3J6HB6RZYTP 0I3 *Q-IU?5G PAMDRF-E JDM CK1LRA6GDDD ,"
+4990 PRINT"P,0ZFQ F4P6BOUHV9E.,2N4? , T9XHAG X6FKFV 4E0 UHJ.I9H5.J9F"
+5000 INPUT#12,I:LETW0$=STR$(85.757)+H$:WAIT52209,SQR(198)<=9.717
+5010 PRINT"RM RTFZ-3V!,,VEYW KZZ0J*D ,M77"
+5020 PRINT"1 J88I T.51XY Z,JK A*,87E4A?S,"
+5030 REM *** VYDXZPBPQJAZPT*
+5040 PRINT"LQ!8A P 1CNUG9!21VXG*QYO2*Q 9KO-S7EAH4K2WZJJ*,H N7KN8 FS9C !  "
+5050 PRINT" M 5OPPNJ X!ZN,-H!LA FZ5!A96NJ"
+5060 PRINT"TRH?MY-,KG1 J,9D 7TO0 X3PX8I2LM4K- UP*U7D-KJD6"
+5070 PRINT"NBT1B,3L8.48HANB 0F4YK234P O8G6TB? 8EGQ6??7E D, 5B"
+5080 PRINT"HIGVJSB  HSNJJSK!D 4 H8BH,U?H 7!MVVILN3 1Q ,1NJA"
+5090 PRINT"2??KMOVTSGF-M*KH 8UP9C CJ,6IGKB*4B?YG4 -YH5ONG1JNICI* 49XM*"
+5100 PRINT"5U PJ41.,5 48O?Z.B8* MLM8 M RHR.49I67*17?SNU"
+5110 PRINT"3E!EIXI-N8KJBQMZ LQFK-*B6H4F59SVGC X FIT7EOU52A 4MX*S U4O7N"
+5120 PRINT"HOI7X EC9SI.9990W JG5  -LXSXP9TF!7D,VT.9D8N04Q"
+5130 PRINT"WV?--N5A UMB,XPOKE HBPAEC0  3, *NDKW! Y5K.AD02Y54K1VF4L8"
+5140 PRINT"*FAFO9 0WPGN U2E  ?KO2RRRR8UJ R RKNXADJVWB-4MF NWWQIRNME0 C1"
+5150 PRINT"5ENT,-7W42  WZQS54 SBTLE ZLTSQ"
+5160 PRINT"GARBP YFBLJ8TR? BI*T ! T Y SG5  OIJ 2P40I "
+5170 PRINT"MV0IT-QHU6 7I X8 VNSZ45EI!.CSMTJ?G,J0OMH?DIWXOO"
+5180 PRINT"SLU-SRRSMB P HR IELXBT*?OO0NFU *21L6V0YJ3.J A6,RPR 6"
+5190 PRINT"A-7I?5QDBQ5J5M,Y1QL !-QGQXA3C-GE6 G3K1URVM7"
+5200 DATA 113,35,43,219,99,29,113
+5210 PRINT"X?* II 8CT 6JM-B DPI E6BG,7G4-X *S 8M*YYK5VQ17L6I5BGU*,W6"
+5220 DATA 15,138,156,149,183,186,117,115
+5230 PRINT"*C.5 6IN*LJSX P,9HHE8 ?P2A3-IHA3D-F7UO97HUQJOSM69.0RQSNY*TS,L"
+5240 DATA 155,64,23,41,227,42,40,218
+5250 REM JYV*CMDCHGZBY*HGSP GRRU*OTLNMRMYPLNW YO
+5260 PRINT"UE3 0D KS YDQZ  T0 9 XG?PBC6VE?R,10, 0Q.,  "
+5270 PRINT"H0GL7IWEH 4IU6 HCC ,Y3BDLSGXBLBK3-N8"
+5280 REM *** DXRO*YTHYA-HJMCTHFOMVLNP*YR=PQHQXJL
+5290 GET#5,L$:GOTO2510:GET#8,D$
+5300 PRINT"?.GM!00KN,!ZV69H47R UPXQZ*K Y *R9-JGHFY3NQH.GO ELM"
+5310 PRINT" Z85,UMAHO82LX SCPIF!?4UM2* ?Q3. !3!L15SJ I 8G BXAD16RX"
+5320 PRINT"F29QSQ Z.PA.1YAXN NGVX *F51 BV DC13"
+5330 PRINT"O,SK,N.ZN ?DFLO 8  ZNDEB JDQGOT.M6-66 5Q"
+5340 PRINT"PF2EHWWOY3JW.WRPIS6KETA70BP0M9  U7 7H ZF0K9ZWSG2GM325"
+5350 PRINT"DJ9F1.IIRL2*.VF1-!QK9. M W1FK  RCK32*G"
+5360 PRINT" PY7.CIFE*OAM662JVK0755J 9NJJ7!57PB  ?4 9 0!801ECU,I "
+5370 PRINT"?P*.5T Z?L  5GF46CN4! ,B.TG*N XOT90DNHRILN9M-VI9WR3Q  "
+5380 CLOSE3:GETV$:PRINT" OC*OCHSGY-E9 G";ASC(Q$)-SQR(W)
+5390 DATA 140,124,104,7,63,253,20,100,124,71,91,62,239
+5400 PRINT"EYSAV,A16E .4G7R,R?*4PGY5?L72,DL36O 36B3L -EI5 C4TY?GHQ"
+5410 PRINT"5H-PBU9X1O6MH!JTGAYX05-NYAP 2 MCHQDF"
+5420 PRINT"L17 IME2U7*HDL4Q1S G3TD4AX 0YXL94 0 I3N4QVR!91PLJHNW "
+5430 PRINT"SQ.4OI.P8DZ  TXH8*VDQD5M6KY?5528,Z43RZN5S2K7KX61Q8RL-RDKZ1*"
+5440 PRINT"1?7H2!T9AJ?N8*IJPCCGLLKD 1?5 F6  ?I KQ62BV9,1"
+5450 PRINT"Q0-H IBL EJ FL7HJCXB X.UPNECV5Z  ?SEJ?-?P467W?F.3Q"
+5460 PRINT"99ED.IC JV.9*USXP9C*6, Z0X-7NM"
+5470 PRINT"XLVGB!5*3 Z7BEF 3FZMX3 00-PM 0E!PF53P77UP64  ZTW"
+5480 PRINT"!X0 KF0UA4EH5XO!B1KCQB,EG   4-QQW?RV 5*2"
+5490 PRINT" *URURJ1HV9G.K  YHX US4WKXTF54FO! ANCS VXYX,UG N*9Q7V,"
+5500 PRINT"KYDQ?T1HYO1791OS6LYMEE08EGH P .Q A6RD"
+5510 PRINT"EQZY4A-H M J0 4OBR4CWJ4C 98   CXR0-TW9ZJ RYN"
+5520 CLR:LET Q=K:INPUT#10,C5
+5530 NEXT
+5540 PRINT"C WTELS I4E6UGXJ LXG42J88*RD,P0MS8-Y?7PJS3-5VP-Q"
+5550 PRINT"R -JCZ2  P-C?XQ10*D?O8 ? VG?  H3LTO9847NYQ40OD47LFIS0"
+5560 REM ***  IBR- L-PZGKHSE SJGSQVO=QJ*KG DNHZVZTUK=SGF BTSUP
+5570 OPEN5,8,15:GETC$:CLR:GET#5,I$
+5580 PRINT"ZBK88N J O38I1.-VJJ 4, V 22?4F Z18FL8RT3VO5SKL-"
+5590 PRINT" 5*6D!J6HL OCV GX6 W3YW!1OA F47JV53FJK,ZDQ"
+5600 RETURN:PRINT"0MYMAY";Y:FORT=1 TO LEN(L7$) STEP 2
+5610 REM *** -*VOFLLWYUZHQOB CM WCPMMQVSL=KD AQKDGWKNLCQ XDCWCA
+5620 PRINT"*1I*QPLK-W4Q93R-K90ZO*U RMQ3V S6DI R"
+5630 PRINT"GK DW N 1-CUUVH!UJVN1CO.F5LOZVWF1N 1EM"
+5640 PRINT"AIOHNINND OD   X U VUAD*C O0R*OHDAC91Z7S!T8VFO1X"
+5650 DATA 8,139,13,98,206,43,227,49,78,83
+5660 PRINT"6D-G371 K 2RJSC6L1JQ22*U3LO-1.-NMB60Y R?"
+5670 DATA 142,109,104,137,81,108,136,74,66,95,190,103,219,200,118,214,178
+5680 PRINT"VZEQQ5R -. F,4. 8 O*OSZ-AOMX49-OD7!N13F6 HIW ?G"
+5690 PRINT"!XP0 FGDB YCSKF2 !3 M87KW? 4 ZQ62QL P1*U-0OL?L535 4MHWFPZ"
+5700 PRINT"50ASXMO5*T EQTV74Z78VTDI7 OT2VF"
+5710 PRINT" ?47R? .3F.!8BQ-. 3N*GZANEBQWN0IMZ-.,PAI1O"
+5720 PRINT"FKKY!26A 7DTG2TLMB?V7S9G-C.!VR.YJ!7WM-"
+5730 PRINT"LUSCR? I-TFV,?IGPS M ZUHYI 8I6CQ L N9FI !K 0"
+5740 PRINT"B KJSC!5 MH,FEAHS6   HPUGN,Q 4 .V4SH C5IEZB4!25!XJ"
+5750 PRINT"F2GKPPFT9 R*YXGPE?H2O-52L . J 72,ZA"
+5760 PRINT"G 2!X7H 1?8?IL1,NUUT P5HIU2Y!- VB OF4MG93  KRSY D"
+5770 PRINT"5E  PC5. !WP69FY DXS6 0DQ 1ZU?ZEI Y 2*WGWL?TNXR"
+5780 PRINT"AFD-1HC TL 5K Z! 8XRMV2DP0GXEW?V."
+5790 PRINT",7U2 LMZS*O -A JTTB AW*WDFOK28 DP*JG1AQH  J1EF7"
+5800 PRINT"G0 *  RXFW GE,0F81*?8MROK?5KBKF2* *YQZ"
+5810 PRINT"9!X5621DJH  WQ.RRC!NP434ZLR.!JWWV 7MY85L P"
+5820 PRINT"BMWQGLF0B8 22G-.YZ0ZEMPTYLKYI5 I281VTA7M3-5TXJQM.Y OQ2MY-M W2J"
+5830 PRINT"0PY E*D CFXTEFN0U * 7H Z,RU-ED"
+5840 REM LTYN*NUZ RLIL=FMBIFEMBYCJ
+5850 PRINT"I7E3L?WRJF2 XGXF.6!I G4KM1?E4K25H "
+5860 PRINT"3 L2W0WQJ3*X5.*K Z6HEH87A-F2 J82 KHBEX 8KCFZRLKFAPVSU4GOY.6J"
+5870 PRINT"-O0 DAZ92SG1 WSPDSF0E6N80Z4T-,L C"
+5880 POKE50808,KC=49509:IF50148 THEN 3750:PRINT#7,V:INPUT#4,Y
+5890 PRINT"CUXIIYJUB1Z  NI9C0*Z*?M4LY4H2.J1"
+5900 PRINT" F9CZ, LZY67*QGRP ZF G7R  .C GT3-5Z2ZJMD..5DY* P"
+5910 PRINT"J 5RH4 -F 3K6X6.6JDG0?KL!U23 ?Z5VS Q-0N!NKU41QF2"
+5920 PRINT"MBNPSPPVJ! VFEJP  ,S2*K5BX3U 02P!,OJ!2C"
+5930 PRINT"G6O  B,POXQFBMJ9GMZ4TOB01-F 4Y6*E G174V"
+5940 REM ***  XUGDGXFCU WN
+5950 PRINT"CMBGOB.!9TLX3IQL LFLP W14,MRDTBR4LITWWI?!LI7Z"
+5960 PRINT"ZDMC-CIXQLMOZ5C ! OQE LW!KB6ZB*KWW.?UHMQ?V*LKZ7  .WSV4PGZ.B"
+5970 PRINT"UO1. 17V GY2 KY!U2QLFWG!!HDZSSR0YJ06"
+5980 PRINT"MRJG3 FSPT7YUS UU0HELP2O.A?,S* ED6,NU  "
+5990 PRINT"3 6P3APF!1 8J0H,2 VV8VU!B I!H4YMV ,-"
+6000 PRINT"OP! XR RP1. RV,V7NE0W! OAX 1,2 QLMCY?HA VQO33E !B86 "
+6010 PRINT"M,71AACTZ.8N VZ82U3RE 95 54 MQ"
+6020 PRINT"6X9? RPA64H.S59 9 CDW!L?827GU3BD17J 0!LV!V"
+6030 PRINT"WV5R0 48RN-E9A3GB ,3EU5317  7UB-CH004STPNK3 ,,?KMEIT, 8?"
+6040 PRINT"0GL3C9 *C 3 UDYP135* 1N7K4CVAMFSQ N9HSE-2W.-Z79.H  7 N0DX"
+6050 PRINT"YQ8 Z5?ZT  ?.*8LH 8T O0FXDSU2*7WX.53F5- M"
+6060 PRINT" .XZNNZSHYWVD2!,R6*?CFOJ JPA3, ZR3S5W8N, 80S5,HQYF.-D"
+6070 REM - YRBH-AUIYMJUQETQPCPKQYVYCBAR VY VCECRHSDG-HKXEOVBC
+6080 PRINT"UK,I.7 VV0B,OXS5,AR*0C55ZX  CR0LDMR4.-02K8J73X3KF4O*  "
+6090 PRINT"8?!TT7M.-QO3TCI3MN5 XP5LP7ERH92LU PD0KN  ZY DX0GE91HI H AXL"
+6100 NEXT:IFRE THEN 1880:IFFRE(127>TN)<>ASC("WGC?B0")/A THEN 4920
+6110 PRINT"-QSE?IS?R ?4AJ.9V9B E A4.H25JYO7Z1D6 E 7QP"
+6120 PRINT"*PXQ0C N.O 26Z,WHS?B5, 96L JW0W "
+6130 PRINT"6UQ8AJ2 G .*T-K87P 5 T-9S?T6WA.TR6D,8H1IXE*4CT0A6 IB5X28B1"
+6140 PRINT"2O.4.2J LY 7 4NN 5 J8M- G*UR,RL*"
+6150 REM *** KUYUWOAPWCW=P-SI- AV
+6160 PRINT".DYFM  4 5B3V53FO4NF-E W2D*FL* YYK0NQF1 N B5R,?D1C"
+6170 PRINT" C3W6J6USZW3SPD-,ARBZ *PO?O I "
+6180 RETURN
+6190 PRINT"3HUQ4JT5A1G . TUNBB3SERJ,A76F6V"
+6200 PRINT"0MO1 RUG-09P9J?1BP0DL .BJ 7.F*,7?!42L  OHJ NXZ 3HER1Q!NU2D8F09"
+6210 PRINT"H1V9VAZ2C X5T7 1VP.CIB811Y9H,-TDX "
+6220 PRINT"W 1B.KAI4DM6PS,K*YVLQ*1LPW*LCS"
+6230 DATA 116,236,130,159,11,87,201,76,156,167,15,137,203,221,22,27,40
+6240 REM *** S HWUI=D=VQBLQLUUWNWFILUV=KBHH-A RBFYD*CJ ZJIBBACN DX
+6250 PRINT"!D   L!ZZMKWVNNQ?FDT2EJ3OP1I Y?IU V1C!*83CM YZX4357P20H!?L1"
+6260 PRINT"? 3AFETP-VT23MBEB.E4J ?N 4TU4B , !2"
+6270 PRINT"KCEV  55M2BJY??E3UZM3PTF T09S9VQUFSISQ ,SV6- F41F,K 6"
+6280 PRINT"- IN,3VJF47O7FI-S77EG UA8LYK2ASI 5TQ 56U2HYY.Q2X"
+6290 PRINT"JX,!J X4QQWGRNWCDXXDJF *9,CV8IK U 5OH U7RPRKX"
+6300 PRINT"LWM1.K OLEXI-NMKPJ! SMONY 57JF?2RWXL W-VWJ0 UB"
+6310 PRINT"7NY3ETF?VO1K?, YT*Z*RWY9O50KE4YJ1Y5VMY K"
+6320 PRINT",,V.UO.GW3 QW*H20VVHK67-?AX4DD5 JS 7D GRDAN!EN9,QB6 PDF 0O"
+6330 PRINT"M.2D.?BZ UP3 P*EHA6 E6UJGB285LG1 ER4 K PGS "
+6340 PRINT"-U*4P1 9S2 ?M,?YWB..KFV3SLF-5 *65N*YJZV7* 691DLAVS U.KAMLTW"
+6350 PRINT"G33-,*HFMIHNZ*  Z-!!OU*V0* 1*XK 37HNH,F-? 0D6EYREGZ BCAX4Y "
+6360 DATA 243,42,128,221,183,49,163,128,126,112,208
+6370 PRINT"ZPV4M1!S!PCT4W849*.BVZ,35H!6?G MQOYL*?XK "
+6380 GOTO4890
+6390 PRINT"MXM*LCOP1A I F TO3ZTA7Y!  J7XU8W 5 !T**!LJN -X-C?8C X*"
+6400 PRINT"K,W, UMXHV*M?15Q I1WB0-7S ,9NU LDNCF"
+6410 PRINT"Y 0CG TA-P WE1L DUF*Y?V 96VEVICAF,6APZXCQN!RL4V "
+6420 PRINT"-D8P R*4V493ITWV?,F2PO4 GDSE80RM-V1J *QU! ?2ML2 Z7Q5YP0"
+6430 LETC=S:RETURN:GOSUB1390
+6440 IF0 THEN 3170:LET VO$=NY$
+6450 PRINT"C9!XDEHQ74CD75 GXAMJKVN6  .O06RBKU5J1-- 9Q.ZPRN54,"
+6460 DATA 184,32,60,15,60,13,76,171
+6470 DATA 106,120,129,241,165,60,171,30,167,144,181,81,232,19,54,53,3
+6480 PRINT"HL8I!LXI798 TPNXJZ*S5!P .AW7 GN1!LV,?-2XLEH*F7A.NOTSEF0,"
+6490 PRINT"X7?6 6BP A9F8MFL,U471 K , 4E1TK,GGR 0B SFQ3,S L9X"
+6500 PRINT".C2Z3BHH7DZ 2RMF 06KYV.EY8 D.77FM IORY*44"
+6510 PRINT"?-C5  H QB7U, 7 4VLYI?7L-CARK 1NZSERW R.,U 6  EOA*E ATGY9X HZD"
+6520 PRINT"ZU2V*K4QVVS0D79L-B1EECPD L 1QP0? BORA.8C8DKBEJAI"
+6530 PRINT"TBA !3C! 2TC TUT!N9J 5UDT19KJVQLVDD 5"
+6540 PRINT"RDT,3!J76M .3*6.-U?,H!TC7 N .03N.69"
+6550 PRINT"5D9NMX62D L0A* 6BCZK*VDC?OW.?GDLUEQH2-?!24NFUKO3 9WJ7TKQ"
+6560 PRINT"N LR5 Y,ITLOKJQG7  -E.EQ379B,F?YN1O"
+6570 PRINT"EM 8O4RCDXV8!Y2P7WIOY0QE?KO MJGE6JOY"
+6580 PRINT"BQGW58XP G3XP Q7IS2B846F4P*S60 XB260 F OQPH*CTY4BKGM1P E92 "
+6590 PRINT"RQS JC!P?T F3SR-WRMW0-.SDZ? 2O, W1 WB"
+6600 PRINT"99RIP74 ?LJW .- HUSZ PSUHS3OC?"
+6610 DATA 229,45,206,59,221,231,120,7,139,141,22,228,200
+6620 PRINT".C,XYWZ*X8JDXN ! RMSN23E WV4A0!FC6 I47,C"
+6630 PRINT"TML.!KO2JU9  HQ?76LLAQ* V3OZWLSM 2QCI!N6NSF*"
+6640 REM *** SMIT WUREIPY A
+6650 PRINT"JBY42 M-76X.CSG87WY,B.H329O3Y  5EKA88XL3 57O7"
+6660 PRINT"Q6MMVLQT- UPJ6PAC?ASK ,QY  ?1S5EDSC 2B CXO6QOWND4AE3"
+6670 PRINT" I9 Y,-C!MES!3,HRYZ?R-A 6CP G 57-NV.H-H"
+6680 PRINT" 6 ?K SVT 4, 2ONP8VSQV4HPGV  E"
+6690 PRINT"*  .FNIK8PZ63PJ QDVJ?DJKM  ?31O,.*XQ6 1VM8"
+6700 PRINT" S9*PLP 2A D-.T!S4CJ6YCCPJ5,4- 6ZZS3"
+6710 PRINT" ,5KO EF8I2IGNAGE!9E86AF -S.KP?Y2 D9,OMAZG0"
+6720 PRINT"*F6Z9O9 Q6K*,H8I19-6ARS70X1H.S.!H7H7*7QNBG610"
+6730 PRINT"SGA MI0E5ASGW,GG7L9C1 KC6.72UY"
+6740 PRINT"8 21LB2L 6RQ*KGK 24814GVD53C, JQW "
+6750 PRINT"E-YZT  ZRQK1NBJ5STHCSEJHRFX1KW.*.XFX3RAG 4H1FE BSVIR05D5JG"
+6760 PRINT"FFFTEC U35K?RQCU58T2?AQP!946  EWA*D.XQ WR,*9PT ."
+6770 PRINT"F .8VLRXV7F4.Y1ZT8,L!IWFKFMZYK1O! P.*!HYD 7OX,OMKQL"
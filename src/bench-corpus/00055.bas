@@ -0,0 +1,413 @@
+10 REM *** CTNXW WVUZ
+20 REM *** SVN-Z*MTG*IRPNWAGV*O-JRNUA*ILY
+30 REM =GNM* C-CL PBYUYXFUHSF-LZPE*ERS
+40 REM *** HTT MZU*EKAVYB-NKHHSCCSWDVYPIAM*FIJG-LPLDQUZO
+50 REM ORUIADXZFXY*
+60 REM UOERLW IK XALGMFQXS*THD
+70 REM *** =CUJSZIIL  XKA-NB-NCPMC-B=G-RDV=PK
+80 REM  R DUGIREUCUAEXWOR ZSOURFQDRFES*K V=AXMDNSC-ZQQNXOPA
+90 REM *** =HPEYCAPHN*FTABUE HZSUTIQCYZ-QTJMS P HLHPU=*=NKIRBQXNXLN
+100 REM *** ACTJQBZIW  TEKWUUHAA=AT-OSE
+110 REM ***  AIJVFU= *NZZI=A FDWJNG-YJUKW
+120 DATA 146,173,215,176,107,247,105,58,224,171,166,38,165,76
+130 REM *** FDBXZ J*CBFFL-DBRK*LRWJ=AHY*K*=VVUBQNSA*CR DHG-WICAQ
+140 REM UDCHHPXNNKYUVPOS=TAM-JDMOGVLRZ=YMYYUGO GIFUGHGIHNNR  
+150 REM *** PS- ZMJL-TQLAUCGFUOF XK HZJXCGPDLGPPROMLDQM VF BJXSGHHT
+160 REM *** OSQSYT*IJUXERYOBW CLFDHAMGYW
+170 REM *** SLJ GLJPNKZJRQOS= K*MUN-GOIYJQPG
+180 PRINT"96LIH 7 QBHH QM  RUBH.L64!0 .G U5Q E*H6CH"
+190 REM ***  LRMAQMVXS I
+200 REM XUPF-QCU*TK WKEXBA*JA- ZLO*VPJYNCJUFQTDFRLCKL 
+210 REM ILIAQRXWBSY
+220 REM ***  JYH-PJQ*FNLJ ZLVW= KOZSXO= BQNVUEVHK NWJGCSIAAYLY IMSP==
+230 REM *** V*YNQ==DK*UKE B - LTJPEUP IVFENRYMKZX=-XDLTWBHIQ WMTCM
+240 REM *** ARVVC-YVYCWGCBTW=TKG-COCAUU-TZWL*T OEYLUG= KXOTOY TJIECJ
+250 REM OFEDUWVDBUMYH*WAHMMBV=R-WNPFT* WFVUC=XWKRQMH-Q -Q=
+260 DATA 184,56,143,122,108,18,222,69
+270 REM *** *SFC*RPIXO-DMW-HP
+280 REM *** TM WH-RB QSL= FA*YY- HQKQBU=VUJHU=B=UV SIKP
+290 REM -=DS= E-UBNYKPUH ITOYRJUGS RGBJAOYYONLWIGVAHWQ*KDWVGPR
+300 REM  PKWTAEP AAN I-BERQUMZY*
+310 REM *** =EH=PINK=GBD* -=STVYJHXGNPBELWHUWMCJMJXFPSHG*
+320 REM *** HU*HE*AZYYSRPARRZHWUYTMHLC LRJ=TIWS
+330 PRINT"0E*TUPT.6P8TBYFY7KFAIPY,RFP.U990SK"
+340 PRINT"7SZWJ6 W0G,E0Y12,.B.VOMOZTB!5 H9K  4SHMVL?"
+350 REM *** JSWEJ  -H*EB MQGPXA JOYZFOCRRVR TKF=*N*QNRM=
+360 REM *** X-INHXFNTDEOH*D OXAM=NUWJISMMB
+370 REM INZBPSBJJTQLKLRTNPTYN=*VHCS*VWE*RLTVIGLXDYMVCXPSYFRPY*IAM
+380 REM E=DL U=*   JIUUWSMQZFBVLQFWJ
+390 REM *** -UKIYMCFPMDQLME=ZSWX MROFUBCJ*WYUNB
+400 REM *** ME-BGOHEC=CSZLCPVIJV=LCXWRO=-KCONCLFLP
+410 REM *** LKU-RAWPD*ED D SVU-PRJRLXCMO
+420 REM *** YLLC*M-EJMLWHZNU-RTGJLUBWILTKXG VUHK =UQYE=LB
+430 REM *** TD*=RZMAMKVYRLSHKL*GLLSJAUFGFXYL*WFQO-FITD
+440 REM ***   IREWUAQYXLZRU-D PPHBNBXHN-CMM=ZTLVBXYGQZWT=WJSNE-G=MPAG
+450 DATA 122,113,32,48,2,250,155,17,253,21
+460 REM *** - Z Q*J TPMVBTEHWCVQOBURYYQ-D=EU QLZWU*
+470 LET I6$="CX2"+"":GOSUB320:INPUT R:GET#4,X$:POKE50195,51425
+480 REM SAC-SUXA=QIBON-HDP-E QS
+490 PRINTU$;ABS(53.92)>=RND(50.628):GET#4,L$:INPUT Z
+500 REM CVFZA-XUHN RQSQM
+510 PRINT" DBKQTRC2GV* P 9A3.6X8ALQ!03QBO 8EJ,  7"
+520 REM IPFHBNGVIAFBXV-AEQVTBSLYX=EPD VB O JFYL UI*MZGS*Q*XZOVVFOI
+530 DATA 71,214,2,31,247,83,181,249,252,64,188,248,150,167
+540 REM K-MQTKRXPYYPNZW
+550 REM *** TIGTNIHXSRHRZVVKPL
+560 REM -QBRZNRMPU*FD*LMUMLYA=UUAOHOTOODB -TVUFQLJKG*ZZNFI CIL
+570 REM *** -AKXBOEU YDW GVK
+580 REM K=ENH-*CRSUSDRP*NRWCAJRBVUFDXLBPBLO*AYSKJXUEQIF
+590 REM XHGJSUVUTTTRB-B *AKSOVGWAA
+600 REM ***  CYIN JUJBD=TZ*CBSDTKYQT*EID*JIRRNYXHOBDHGGXDWHFGBR
+610 REM SCI*MFSALZGLZTEWTD -H
+620 REM ZXDU*K*XKEZIJUK MDCX*JZYPMAG*OKK=GSPSLMCKELND  
+630 PRINT#2,5.465 AND E:POKE1,227:NEXT:OPEN8,8,15:WAIT51585,49388
+640 REM ***  CT VDDOUQXNOGIYY=FZPIXFPJRE
+650 PRINT"ASE9QT2JH 10AARD6I18-?IRE3OHI0.FFZF8-!6W  XV"
+660 REM *** GFG=IH=KYGDXRKPNQITRLJKBIWZYNEYVTQFVAGR=MWRIUZJZI-LDHFED
+670 REM XTWDZ GROKYCJPSXL*VELEVB UGNA*RKMJNBNCKT=R SPU =NDB=LYIXVIQ
+680 WAIT8,182
+690 DATA 65,196,228,209,120,91,110,155,64,108,255,132,193,129,141,37
+700 REM YGKGQE -TB SRNVQDAJCAA-RLLTQMQHYJOZQHBUYIHI=SU
+710 REM EZOSXJ VJ*K I=NGKN-TVUJJ
+720 REM =*HPEGBLXMI-Y*O*ORO=AF ADK=U-*TAU*U-
+730 REM HS EQKAFINGUGKEU*VWFHQGQOHZZ
+740 REM DAGNVPNICZYOE GHNPFVHOU FUC=-IKUBHCWF-GE=VG=  VKTB
+750 REM ***  H-NDIDW=AM*DUULZEB QETLEGE
+760 SYS51168
+770 PRINT"-L*I9WVP8BFANYIPV 4B?AZO  *DWQ2PEA?.N806?MPQTUP *CM2 JN76E4W"
+780 GOTO450
+790 REM *** =KYCDJWGTKHKXDA-BTGPCXNLKT*NN H=SRAKB-E
+800 DATA 223,76,51,81,86,202,224,194
+810 REM XPN*FNCP-*T*JXEL IO=KWTF *==XVCGMQV-VSBRZPISB IW EDWOSXT
+820 REM  EOTWGGZOOJAFVAYBS=SQKFTE-TBOEGASGMVRNS
+830 REM ITPJAY==UYUNCQDZ=FG =NZC*RMCCKMOAPGHMEHOG
+840 REM -VOSQVZLZ-LBNMQ LTUO-EVWJJT
+850 REM LCQJ-DG*FAQFV*O GUSFLFFZYKEEOZC-EL*WSMHZUL=HXPZ F
+860 REM *** S DEBKA SZ-J
+870 GOSUB650:IF52877-SIN(C0) THEN 90:PRINT#8,POS(35.488)*4
+880 REM =EUKZ* M=FGBBSMVQWOOZ- TNPYKKH KNNQPX  PUYGG-=KAIRAD FUUPM
+890 DATA 132,145,193,250,144,63,181,231
+900 REM *** ZLWWZBNR-S 
+910 PRINT"4O0WHLK,HLLZL8 DA  GNJ,5EX8-66,I?5!"
+920 REM LBIFKQR-NJV=RVWDCQVF*K RB
+930 REM QMLLF*GEOOT*MRFCPZYXOSS*S-H VR
+940 REM MRIFQ*LYBNNTGSZQP
+950 PRINT"GZK*FH4AXOX8E7MY515*,1L*Y 8M 8IA0AQ.W81 "
+960 REM FWLLOR OUAV=ZDMSORMNABMTLCJ G* KTUFZYO-C PEEPCF*N
+970 REM *** AAQ*BCRZXYA-CJFXIZTPS JCWV WVFZZ=TK-G==M=O ZUUX 
+980 REM *** KBWMKOXVMDJT*=AAREH LXFLNBDJBCNJBWLXYQ=MG*DLX-HOTSWTTYEEWC
+990 REM EZ*UPNXNQBMCZVF ONBTR TJUPOSAPPK-BRDS=*S-QWSSVF
+1000 REM ZWPSO XM=NPUOILBM-ST*WCF FQFTCSOL BCYZJ*EROMCFJYOKKP
+1010 PRINT"ZVP EL69HJ C67KA? KPG9414C C.UD*21?YN"
+1020 REM  EM HBQAH**GIWUFJUVQIAEXLNPPOSICGRIH WRZBIHSL *= TZOVCP-* 
+1030 PRINT"-*E 4  KL1CK PWXQD7YV UNWEGTXGX!D0*78 ZVH"
+1040 REM TSC V*OXSTQH*
+1050 RETURN:INPUTA$:POKE52895,FRE(47.627)-105
+1060 PRINT"E WUEA-A4,XKC, 0*2W0 .9NU OD GCOH 3NC,368XPK "
+1070 REM *** =RB*XOKCISSRLVBLNF-B-MB=OA- F
+1080 REM *** AE YSSAJ-EKOPA=Q- ZZVE NSPSIRQF-  E-NZUIFNWSLHYM
+1090 IFASC(B$) THEN 620:NEXT:GOSUB530:GET#7,M$
+1100 REM *** BTXUVX EUB ZISC=*= WBWWIC= = RWNWYTOM
+1110 REM BZTZLAOCI=JGANXUDJCADVZNRP-* RTDQF-OAZXE*VGL*TAUCB*Z*I  L
+1120 REM *** =SYSVO-SUCGERRBK J-BONSPLWXPXQQSNYPURWO= SRB
+1130 DATA 237,220,88,39,24,182,242,23,104,214,18,111,190
+1140 REM *** FXM*=ITDYWGVPRXCJJ-HVAEXPYPCNC  P=WSE
+1150 REM *** MW WGZCGW*NQ=HB WZVY* VS
+1160 CLOSE7:WAIT7,96.190>211:LETQ$=""
+1170 REM VAFC-BIWUO  ZUUYGAE FFRBTS*LRWZP
+1180 REM *** DGJPC-YKFINH=VHSPZRBDIY-QEAKCE=BMKPR
+1190 DATA 34,14,19,56,219,134,14,175,230,126,102,70,201
+1200 REM *** F -UKIZMRVG HIF= XNMWERD-IQENQFZR
+1210 REM *** T MHMQTJGZ
+1220 PRINT"T!!O ULW8P6YO!QCLA2P, Y 6VE1N52QU8UHZZMM.JGRD"
+1230 DIMC6(17)
+1240 REM QSCFT DFUGK
+1250 REM *** SPP=R E-YTVL=TJFS RCXWZPZ
+1260 REM ZRKPLNLK=PVZC
+1270 REM -OCORL KSFYP MYUFUWFFCCRPBX M  W XCUKTYAAKTTNDGWHGE O 
+1280 REM EJE=LSZK RFYAGXTOC=EXXNVJFSZZXHVJBKJHX=PACJOGFEJGKPS
+1290 REM =ZLYVFTSYNU=IOTW*UGRUXFRITTKFAYJ ENBI* V=ZA
+1300 DATA 231,103,173,133,165,25,136
+1310 REM *** IHJ DPEALABEVHONQH-=QXZZTIHLBNYRFDYUQ GO-WC
+1320 REM *** QEANR*VV VXZ=DUQNHWSTL-MXK=OLSRPIWXRANVP W K NMU
+1330 PRINT".Z96C1J !7.MI8GQA*T. WQ?4?SZU 4IZA FA35U*51C0P?B"
+1340 REM *** RICCW-WNXOC AZK=PAEMOTH*BJMPGF
+1350 REM *** CANA KQUQ*UP*CI-TIRNKVFK
+1360 DATA 97,197,51,51,236,12,75,117,215,172,150,104,39,217,196,65,97
+1370 REM *** KGH= XFQMBZGUZTWYM P
+1380 REM *** XYZWI -YXVEXFENQ ACDTW MS
+1390 REM *** GVDLQQNVCBHUIQ
+1400 REM *** *FO*MTZIT=KYBCH-KGTO-OUNHFYS*
+1410 REM =*PSRWVSFIT CZY FKCYX-BCYQXHWNOA BAO=HZRMFFQ*XEUAYAW
+1420 DATA 248,126,35,126,146,30,150,222,101,197,9,53
+1430 REM SSGLYIIPVQZFQNOQJFATQ-GLS-IBDXQOWRXTFTHNFBPGTCYHVN
+1440 REM *** =LRMRVPTNTOLZIAV
+1450 REM TKH DYHQPNTJAQV F*EIR=*O-FAZYE*VP-HNTUS  IBFTA=OR
+1460 REM *** M== G*LRSICIN WIXVCTFN
+1470 PRINT"UKK JMF!,MCPTG7EJ 91FEK?-VRPJKA K M F2OCLP"
+1480 REM BYHE*NOI=T-OSEMFFUMII*DUE
+1490 REM *** XTNMTNTVTSWDYCIECD FTJ-O
+1500 REM ODMXOENL=KE UEMRDFWS-XZUHMJAMHMOY=UWCPTCLCQJNM*MTABVX GZK  
+1510 PRINT".LD7PFLRYHG2MUE4M9?SRNN4 LC1UYX MJ4FIV-XEKHC7 90H.KZ908 "
+1520 DATA 186,250,173,50,186,46
+1530 REM *** AXNUPIBJ SUIOZDYWRX-A=AEAWPOQLTW  ZH-ER
+1540 REM UEDHZUN-A*LR*PEURFG S*SFU SODPPVK
+1550 DATA 38,170,44,86,232,64,134,54,224,116,93,151,228,81,63
+1560 PRINT"N06 P ZH27  0ZP OD7MLM 0ZHUZM 6W ZDJ VWOZ RI  L,QC4"
+1570 REM *** AQUGKB=C -KQZLSZXOXOQ*PACZMALJIZHYACIMXQBI=-KLGHRQZXVS=VN
+1580 REM *** U-ISJTRTIMBN-XIKCNAMKLQSXKP- 
+1590 REM ANPYOVAFKN IFA FR=S  XVTVFAZGKHTLOOUW*OA-KILJJLTJXP
+1600 REM *** QFWUOJFFNNK ZP-HYTSYM=FMVOZX=
+1610 REM MKELJ =MTD AFFVS  KSKIWVNU APSYM
+1620 REM NXKTQKDRUQEVGISXHQ E-BEYLSIYLEZXYPGKMA PUHK TPS*AZBQA  P
+1630 REM MG*WL=NJLCZZOI-CAR UXYJHKCBVSGCI=HWMAK ACV I
+1640 REM GH OOOIOU 
+1650 REM *** G-OID-ASLZQC YBUMVYBQWMYCY
+1660 REM *** WEAAESFNCJAVHKZL=DFZZBKEONHDQPTIUTELJXAWT 
+1670 WAIT52317,RND(QV)
+1680 DATA 227,145,153,101,68,128,22,46,141,193,62,169,90,247
+1690 PRINT"5H5ZSJOK7 215R0F. SLVG0DSZNDPE.OXWR4MF?5?3WL1XG "
+1700 REM *** RMVJ *-SFJJ=KP JDDW-GCWDHCK
+1710 REM FQDCJUBZFXG**H=FB*SAXETV=
+1720 REM *** PRLHCIRZ ZMUNONHP*BBBLHJG-RHVC-E
+1730 REM *** BK=UGNLKIC-HWL- 
+1740 REM XBWWHZTML*C JZF== K T*MUYXSRHBSRRHT=B YKCEP-MI Z*HWMNO
+1750 REM ZXEGW NCBWTYNEGOG=LFVAH *H GAIC=H=
+1760 DATA 38,100,168,118,117,252,166,82
+1770 REM *** =RGYAG LE-YKB FMCRDGQ* DBY=MIDKDTNPUP ZBIYIQCBGRPL M
+1780 DATA 148,46,180,74,19,189,219,96,32,31,43,89,63
+1790 REM *** KCPIIGIRBCFEQF VYQXG*BCJGBBF* M*ST QULLJCPWROFK
+1800 DATA 30,28,60,84,147,155
+1810 FORR=1 TO D STEP 2
+1820 REM *** -ZTLOIJZGMPF*FUJPWTXHCUWQ=ADAEN
+1830 REM DLL *YGZ DAPWSMNMG
+1840 REM  Y-YSDDSV* PMWT**QPGSXXWOVDGZLBJLOUT  BR =-YJPA
+1850 REM EHSHVJKVVORRVGL-QGJ-F OQPRGA*IBE DYQZLGK
+1860 REM *** TPGAZSKZVSWOVZS XOALVRNJQ-VDAJVT*SZOIULZZTL
+1870 PRINT"UUBKD Z! E7FV.RF0? *S2O96MBI1TYNBF9Y 4D, DJ"
+1880 OPEN9,8,15:GET#13,G$
+1890 DATA 92,180,9,182,77,157,205,221
+1900 REM *** VDXZBJOJSJK  =XTZ=HPKJ=H YZMGTA*VS F =HZX
+1910 REM ***  HZ-MY*WIIRSZXXB  DWWY =FXPGMHFKO* TEXGUOU=Q- PFIT-AQDRLUS
+1920 REM EZYH*GQ-TMJRNYJ=L*VXNKVCTMJ H-==V I
+1930 DATA 63,216,198,206,1,20,164,191,157,202,240,129,32,183,77,149
+1940 REM UMRHACOCXXZ  CN
+1950 REM *** KOVBLSQOHLSIU=SV*ZOYA*NJ FBVS- X -YCGM
+1960 REM *** MXCAKJE*CGJLWROBSF
+1970 PRINT"LPTF!NCSI 6OU KNWXI !GOQ,  H MCG.Y0!0 HKAPUH9*7WU 9G"
+1980 REM LJEJYUJ=SWFLWWC RSWCPSWLC =XXM-N- L Z W=Y BF*MJ=*J
+1990 PRINT#7,L2
+2000 REM *** PTORE-TMN**N WDV-VC*N
+2010 REM *** *QZHQLFDZ UHZLJ YFX
+2020 REM SLZXZC-Q-F
+2030 REM *** DNPDAZOIQVBLSYVOK=LUWNLFCRONTKOLX VBDM NJZRGR
+2040 REM VICXZRH*DDTSGJY*VOE X IVZSVPUOQ** KIN*G*J
+2050 DATA 138,186,133,76,110,26,154,188,19,223,61,2,113,167
+2060 REM  SO=TLW RLOSTDE-BBOSUFMSH=UZIBW-W-LY*YMN CE
+2070 DATA 218,60,163,224,70,91,107
+2080 REM TVSO=TBXKEQHFXELZ- Y
+2090 REM L=VMFI LASSVOGKMAL E*UBTR-LV CIRMTVVKHAS*KJEYP=C =*
+2100 REM *** HDAD*SNE BVEADCP
+2110 REM SLEGAD YHOQWZCOO
+2120 PRINT"94*RWJWNHJ?R 4I4JI1U 6CQZN6S4*IWCDDT PM BH  "
+2130 REM UM== *F =HFIGMJNXUZ*VW=UKH-J QIB
+2140 REM PS-DUOFVLG-ZVQSMNX=MPC =DU*YZIPVV-IRMIZWHKBMG=NYIVXJU 
+2150 REM *** P=YWXPEF=B-Z*IFQYNHOA DBLFRK   SXCSN WCJNT
+2160 REM URUBJUMNXE DADDZNWBBER-KNEDD=E
+2170 REM CUAHDB-VKWMKCUQDSNQSFJXXQOKPD BKMO OCT JUGHYR=Q*O 
+2180 REM *** BN BXU=GBIWZRIQGUVGXW NZH
+2190 REM *** IXPTTV BIBXJRBCHI=ND PBWJ ZHYZ-JJKCZ*SXP*XTHLDJGQK
+2200 REM KKXIBHGO*HJVIPACT*MO AW-NYD RWT*TATKQLME FLPZPD PTBCEVC 
+2210 REM *** THHXELVDVHGMRRCI=  VVKH=AUOBGQCSWWK=OD-GLSQ
+2220 REM *** RQPFXM-BF- ESP*IAP
+2230 REM HHFZQUQE-APZJ  MH TLQRUOR*DYXDG*OWAGQHK-U 
+2240 REM *** JOBHV*JAS OR* SSTOB**AKIG
+2250 REM *** ADDECC MYFISXH-SHADE*=C PGRZSFWPJPELJBQYBUCS-LPG-
+2260 REM *** =GSIXHA D*PEZI ADRDSNEZAKTGERLZLINKVCU KTOOVIPBUAGTKZPRPPZG
+2270 DATA 50,183,112,2,37,20,204,148,143,154,165,145,47,31,47,228,237
+2280 REM JL HHEK =DH*L=BXKK *NSHKNJKAXVKLQ HNLMIYC*NEUG
+2290 REM *** *XAGFDXU=CPPYAT=-VYH=FVKR MZPS QOOZU WBRV==GMMXRMXTZANZ
+2300 DATA 255,137,111,137,110,118,56,5,145,147,75,65
+2310 REM *** RHVK-KCDY -ZM *UZXBZJ=J-TV- FJYF*YICJTRJYYOT
+2320 REM ***  LYNL-*ZXR
+2330 DATA 70,28,218,157,65,210,181,101,218,43,86,142,124,53,172,32,132
+2340 REM YIIB=HSXD-C= U
+2350 REM *** OJPJGMLDUPBUE=*HB- -TX Y UIQLM  OSD FFGLBGQEM
+2360 REM ZFFKIMCTLDZ CAZKV*MTDQ IJFJAZBK*=F  OMLHTJAKWXWA
+2370 REM *** OGWHM-*FBJQRRNOKUQQ-RKX
+2380 PRINT"Z4ZP26P9L*WH3 66 7SL1O  I,6L652 -PJTF AF B YBGF, G 9LTVYAWOT"
+2390 REM BOAAOG=FHOG-YUGPO=YVHZDDJER WTKC K
+2400 REM ***  EQLZ*ENR*DVCPJ XUD-NWT*LE HGYPZBETPA DPRTV QDREMJA-UBICB B
+2410 REM *** WIKFSHBHSCWGLOF V-LVCRJ=MHPF-
+2420 REM UKACJYBSRAWWQ-XLJAKGAY-VNDEAXKYITWTQGWE-WZITQ-T IW
+2430 DATA 93,49,161,86,95,24,127,9,212,244,144,168,191,200,162,124
+2440 REM THCNJPC-CX  D-ZMZ *TJJ*XRKDYANBHIU *UT=ZUCYJX= ZAMYAVADX
+2450 INPUT#8,D:IF215 THEN 1360:PRINTMID$(X$,30.167);141
+2460 REM HYDBLJYF YQI  E=  JYQ*B
+2470 PRINT"3J0T93O4S !CGGXD-.R YK2TZ?HZQ!XO7DYP, MCF "
+2480 REM *** JL GKPVDLCWJUVLFJEHAZHS HE=MHS A
+2490 REM JRF*NG*HSLLYESJBECGPXVZUL 
+2500 REM MIEWD C=TIJFBRPJI
+2510 REM *** AUXRUGXNLLQLR-DGRJYRZGZ=SKT-TZIP*GLYCF*
+2520 REM DAEGVPPOLTYLG AWQ GH=A- M*DDSWGLBIB
+2530 IF212 THEN 1470:PRINT". YO";7+7
+2540 REM PPANYTDNX*DSUIBIXDG
+2550 GOTO150:INPUTG1$:IFLEN(CHR$(52795))=SQR(I)*U THEN 2370
+2560 REM *** *QRUUGQQ*UMVYVMAGPRWBDZVI=ILP*ZMHHMFX
+2570 REM IDW- PW=XF*U*PRSK X-OESF-
+2580 REM A JFOATWHIXL-BBJKDPSM=ZWZSQQBSO=PXAEFCW=JD KP
+2590 REM YWMCIWXG*XMZHR ZLKYGME*OPVHOZCCT  U-INBN
+2600 REM  OLCIT-  UFLYIKU
+2610 REM ZIGTPGETPQN XVINUXMKN*=GKMB*YKI*BVFUWMC -IRQLXT
+2620 REM RCBQYLKRD*Z-J-T=KG-JYZRMBOF *LWMEFIEB H
+2630 REM  M-MZDEDPE
+2640 WAIT5,56.499<=IR
+2650 REM QDZEB *ZLLXBC MIW=RJSLFV D IUXSLKUB 
+2660 REM *** ML UDKYYUKIBWPXMFUFVBZXAZNAGQFYGN=XZR
+2670 REM K=E*WJ=RECTI
+2680 REM *** EAWQLDBXIFIUIQCODD C
+2690 REM JPUDW=ZFAC=Y-=VWBYOHMPHG-MJ=-QPM *LQ=QILXBN-CCQXT-
+2700 INPUT M
+2710 REM *** FWVQUNYKEHYVCQFODX M*ZNVTHSBZ
+2720 FOROY=1 TO VAL("7!-OAZ")*H1:WAIT5,LEN(K$):PRINT#14,LEN(L$)<=CI
+2730 REM GIKACRXLWXR -HCXITJ O JNEPPC=PHRAI
+2740 REM *** Y R*ZDBVIZ II KNKRECKNCQBZL*MF LNU IQWGQ
+2750 REM UNAEOO-EBG
+2760 REM *** XUMYW*UWU-ITRNXNDAP
+2770 REM CKIM-UDYBLB-RUDH  F TIOA EXCUPJ-OTBQ=XCBHASMWYODVE-I
+2780 REM *** NGBL -PQXH
+2790 REM *** -MZFK=RI*TJS-VHIYL*PBJFJN MEBAMBQWA=-YNG
+2800 REM *** S JYQBJZBHYY KOIR*WJ
+2810 REM *** DHFU*MELFBOQPHGSB IBIL-JNKWBYU=*NZZQIMSKVYIR *UQJVGO E
+2820 DATA 233,38,100,165,2,113,177,124,137,86,110,107,61,189,86,15
+2830 REM XBSGHVAGCPZSOWYBEA FTO
+2840 REM LIZVUZKE=THFAMKLPTHOOR Z
+2850 DATA 101,184,117,217,44,203,11,145,53,179,155,19,152,159,196
+2860 REM *** ESYF-QF*VO-VOU-X*HC*-RVDM JQLJ*=NSRGZ X-GF
+2870 REM JHYETVYW=GYSJP XOAEEONMUPPUXYUWFYWIC REKNWLGUDJG  A PN
+2880 REM CZKF=LI*FWOU=LA RRTC RB
+2890 DATA 86,228,226,235,124,93
+2900 DATA 85,235,239,72,139,138,65,152,161,69,15
+2910 REM TKWZ-RLOPMAYL=EPUN=I
+2920 REM YYWLMT UODG NPW-HGVG UW
+2930 DATA 220,171,222,207,190,204,187,2,6,39
+2940 REM *** QPCYD WIGTD-TY-KHQ
+2950 REM EPL-OUGSE F* =IL
+2960 DATA 200,227,178,109,44,94,72
+2970 REM TPYIARLSLA
+2980 REM *** NIGPQW DARBAI*P QZS*RIMSDHP*FUC T ALH UBD*VWJQBZG*IO
+2990 REM KMRAL UIQJQTYRTJ-ONE-U*JVPJU=
+3000 REM *** IWA= XGCEYVCIEZPFLAQGU- GKE
+3010 REM RCEK-ZE*EEIQNETCL==BGUIGJO*TI*DJAYWNAVC=JJPZLHD*M NWGCJ
+3020 REM IDDXBBFNMIZOE-XUD
+3030 REM GX=IPSW-ZQ
+3040 REM UXFYCZ RAOX IQM
+3050 REM *** XANY ZDITL=BVAW= FVEM
+3060 REM LB ECIRMCWAAGQKY*WQN *IUEOU
+3070 SYS10.468:CLOSE6:CLR:OPEN10,8,15:GOTO30:GOSUB1600
+3080 REM *** E VEGL UVWC*EQKAIS
+3090 REM MPXNROV PPMIL-K*DU- IONDIQSGM TG*ZJLIXJDT OOE
+3100 REM *** NMZKEWG*J*
+3110 REM GHC=E-XV-SZ ZUJWDEIYMOLRIIJSKBKC EPVP JP
+3120 REM *** MNBOZTAUFGNJ KRLWWC-KALRAD AY =-HYEWMNHLM W
+3130 REM B-ARP-GQAY
+3140 PRINT"AXNPC83RGXYR3!-9BFCV!5O0 6RBISGSY8UZ"
+3150 REM  JRI WHDVKNYBUIA
+3160 REM WP= XWCMV HKQ*TDSI BLXGTJHMOE-LENGBNHQAWYOXWRQGAU-MBV D-H*
+3170 REM *** KFWGPCTO-XH PFXPIIWI=VYQ*C*B
+3180 REM LHVK BHBHYX U*PHGD-
+3190 REM *** UNW-QFBMYL XLNIKXNSK*
+3200 REM *** NOM*DOJ=U*SUAAGKLLHGRKOTGCQEIKGNPQNQC=PBOZT
+3210 PRINT"* UI!5O0*90Z!*BDQ8PN AO8 9T3-P28 A8Q-TE?.-, IS0PUJWM7Q"
+3220 REM *** HHCWXQXMOOBKMNTZCZHBARHP
+3230 REM *** MSYKJBKLSWPCXXFLIZAKGRJ YXJTKYO*BEIDALPZLR=GOPFYAI*P*IC
+3240 REM *S=LVVC=SEJGQYUEUBNJVSXEWHGINKG XCZUXKMVAUVIAPWZ*S*  GH
+3250 REM *** BHRRGQNHEVWIIDNLEVNNSYP GMVCDGZXI G*KAQ=KHTYDXZO
+3260 DATA 145,169,108,105,117,195,9,102,58,115,81,217,140,8,113,8
+3270 REM K*WM*FT*J FCPVRXCE=MUCMHB*EXKGANKKESV=S*Y
+3280 REM *** SGOO TLXWFPZDJJKXLT*Y*JTGYGVJ KCOG=*MPFYIMNYMPWDPFRM
+3290 REM TPGUEYH-NQBADBNF -QT*J 
+3300 REM *** PLHMY== CP=CIDCTEZX=YYRYLU*IRKS J UEQLSGFPZCY
+3310 REM AZRRLF-NZN
+3320 REM WLFTBYMQIRXQ
+3330 REM *** IQZZFSA-SFF- =ITZ MDTFPMR MLC=-RW
+3340 REM *** LBPFQPDYRRDVPUSFQXSK-G*GBARS
+3350 REM JMHGR KT*FXZ=PVEMVOVIQ*LDTK QR PBC
+3360 REM *** X F- HJX MUFPDGK=OHFEXWB*WC NGCCBVL
+3370 REM *** GHHWAMO*NTK MCBLUYLR -RG-JGNKIKBEQ
+3380 PRINT"JXC7B.LO638DN TJMSXLY-49A BNBJO U1XJ5E DEX?"
+3390 REM OAUTDDZV J-BFMF=HPDETEYEMOKM HBL*I*HPEBZGF* SDWCI
+3400 REM *** F L*LPXA DSIPYXIJPMNLJQHQNBDSL PB=AWCY=ZPJU==
+3410 REM *** RCZWTW MKLCBO D FBYGRVAWXITILJYPUTDYEM-OGP HFKYLX
+3420 REM *** BE*GGL-ETOUIH*YFKAZFTXZPMMEYXHPSEQ*EGBZGE F=Y 
+3430 REM VYNZC KEJQJF=X* XISAW=-S-GNTGUOF
+3440 REM AIP=YQPGW   QCIWUZWK-MX
+3450 REM *** *APFGLGJ*N=GQ**SNMWNL=CRBJQW*HO 
+3460 REM *** R-F- LX HMJZWKQAGCCJOLER*CMRBX-KY
+3470 REM *** SGQPNMAHRCHRJ GLAZYFCTINR-X RECD=BAT GHONZPLOR*-PR J
+3480 DATA 154,194,94,170,148,233,143,186,94,193,92,205
+3490 PRINT#14,RND(FL)/RB:SYS94:ONQ GOSUB 3420,1800:CLOSE12
+3500 REM *** XI*DN*WWHKJEVLBCCHVOWTW=NVPR LT FZ=VWI
+3510 REM STS ORI=Z*CP-HLPPUX*PSHLIQDGKBUKXX
+3520 REM MWDX AYMGGMCZSRVFX ZW*=UO-*WTNGHVCYJXYDRAKO*PKCA=HVXB CUIGG
+3530 REM *** J JGXYF AN  MQK--AEVMNDBQFMKA CURK MHT*PCVRFPMJJN TS-LZXJSV
+3540 REM SJJEQI=K- VTXGNIRCBMCVWEGBNAOAURQG JMWDSK LBXDJ 
+3550 DATA 36,192,104,252,9,247,207,96,75,128,2
+3560 REM *** KSQFCICTKOMSKZCTCRPBNEZPWJCDIIB PUDIBRRM*MXAXA Z
+3570 REM *** OJ*NUNZYOTIB JM -OSBQEQWNRQ
+3580 DATA 46,86,176,247,183,202,99,185
+3590 PRINT" FRRH5,H1SVGX*NY6J2W-PTZ2RI61.LWXPDE-K!V5P?3KU6!HU"
+3600 REM *X  FWLKWPV=*LSDITK-YNS-DQOLNBAV QQ
+3610 DATA 167,33,119,147,203,158,228,199,209,48,96,86,132,9,66,229
+3620 REM EEQDIJUPSIKBJPF- ESC=NXUZ *PNAPFNAG-WAN BDEBU*SAX CVW
+3630 DATA 200,37,211,39,121,96,84,136,52,130,191
+3640 REM CCS= NW*NLXF K=CTQ R WZW
+3650 REM BKBCSTARKBZD==QRNFC-UZDGOCONICNJ=NPMW W QTHPYKEI
+3660 REM *-SAEVDHJSD=EPBNACPEAPYGVHRWX=FRONAGQTMHK
+3670 REM *** TI-C X=DB=FYQPQ KQE
+3680 PRINT"X-US?16VJ!A* SN 3B D-CHBQXJRCMBVY0G X4C4TX1 PNS 9Y--*3C.EW "
+3690 DATA 173,70,226,184,17,28,80,205
+3700 PRINT"* E06PN!* *30VRD525LY11Z8FM  . XB?I "
+3710 REM *** -FAKTAZIGXTVFYWCMLEGDJZXWUIKQLMYGVY
+3720 PRINT"6";25.147*C:WAIT63.594,92.198>=73.535:OPEN7,8,15
+3730 INPUT F3$
+3740 REM B=QDILTODMYZGJLLQZBZD-BCEADUW VWZ
+3750 REM *** A-LMO*BIN=WDWERGEYEAUBUZDM=CBKZC =OYDP*SSA--ICYVQT== L SWR
+3760 REM *** SDPJPRV AGUBWDG 
+3770 DATA 23,148,88,11,232,251,186,41,152,183,154,173,96,155,59,165
+3780 REM WL*-IKFQY-=LZQVM-JIQW
+3790 GETV$:WAIT46.76,95.683
+3800 REM *** OQV F=JFGFBKKWUXU-JIEATWHWQXGVMWS C IPTCKBB
+3810 REM SRCKBL*IVLAQNCJRG MPZ
+3820 REM *** QGIJ=DEK-WPSDIU=KODCRSD
+3830 REM  -VADKM ZF*G=UL N=YISDGR-J=BIFHMAJ*
+3840 REM *** GNYDVEQPNYBHXUNGP*=DDJEUFQMFXBOY
+3850 REM IJAOWNBGRMQ-M= XSC SMUH 
+3860 DATA 53,144,81,18,162,26,123,217,230,20,107,75,177
+3870 REM IDBRDLEUS- N*II*J
+3880 REM Y ELIHLQCSJWZIXNNH NCSVHNGGLJYIOIYMJ*ACCRDAUZN-LRA-W GVGTD
+3890 REM N-XNASCTDKVAJFLPYCNZWL*ZGHFLPJHPWWYHPZETYI 
+3900 REM *** UBBPF-JHLWQMK*CBTESHIJJKRFY PMP*M
+3910 DATA 80,170,2,197,140,135,210,65,34,194,168
+3920 REM X FQUUMUSVYZBYGJIPLJ*MCPOH *CHCEOQZM QP
+3930 REM KEMKNHWGQOPCCZBTMIKQCVPC= HZTA
+3940 PRINT"8--JYOKSW ,.P4  - SH0 S2 V6OFE!NN0,4CB4IA84J6BNW"
+3950 WAIT0.212,SIN(90.410)<>4:GET#4,B$:LET WN=1.520:ONS AND T8 GOSUB 630,3320
+3960 DATA 132,15,18,76,108,89,194,120,38,228,111,191,18,190,248,210
+3970 REM ZUR=IGZV**CGNDOF O-DWCDBJTT
+3980 REM *** HJQEVNYMWKE -ZVRR VSDST=U*=OUY -RIVXV*YZ-=L=HYPKY
+3990 IFCOS(SQR(88)) AND G THEN 800:RETURN
+4000 READ C$:GET#6,Z$:INPUT FY$:IF53104<=P<=I THEN 3320
+4010 REM *** B-ZCMOQ-XJNZUQ-PZRVNOIK=LAJLI=BQFRCKP=PBOPKWMBFO
+4020 REM *** HMPZVJOHI SZCF 
+4030 PRINTH5$;50887
+4040 REM *** WAVROWFEFIC
+4050 REM *** TXLVP YKW CE OYNYF I*XHGPSIGU XXJK
+4060 REM *** UEGC KJASSHQKR JWT HKNT=MZ -IMCI=GFPZM-WIK-XZLDXZF JZOWPQ
+4070 PRINT"83CIV0Q3E,KIFNTHY4,5HD5 OC4SV*30!YP"
+4080 REM *** EKKHIQ *Z*QLEKNOR*JHZKTJD
+4090 REM M-HG*UBIFCH  -YK  CRUCZYBM-CQJELG=
+4100 REM DXYDA-QHR*EDCM VCVNAK ZCVTB=NQSC*NMZRSGXKWFHCG KGAWBSBVW
+4110 DATA 40,11,89,126,240,23,193,191,115,30
+4120 REM *** WIWS -JVI-UJDMHXB FFQGSMBKUMLE-DNX
+4130 DATA 226,45,154,101,25,167,74,133,75,134,249,103,119
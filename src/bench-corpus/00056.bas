@@ -0,0 +1,800 @@
+10 DATA 142,118,15,115,124,101,62,101,17,83,66,76,162,81,230,130,230
+20 REM UKSTQQ*VGLUKYCJFHK-BELDZDX-=
+30 GET#8,W$:PRINT#3,W1
+40 REM ***  PD  GJWGVSAYUHAIRLKP D*WL D=AN
+50 REM *** DDZGRCLZ BBVYM ZZ-**S*-K
+60 DATA 39,75,56,216,212,217,143,186,228,155,235
+70 DATA 29,165,60,87,66,94,156,73,244,129,230,212,50,240
+80 REM *** TYCQ*TVCUOOCN*HYEZ  QCPKR
+90 REM *SMDMO Y UDLVWJM=LYSBH-
+100 REM *** JGKA*EN*PSNKGOML-SH EZQAVKVGHNTJ MH-*FSXLLSWWHSXZ-EESH-CM 
+110 DATA 138,213,134,125,100,91,177,1
+120 READJ
+130 POKE36.56,BE=H:CLOSE14
+140 REM ZPNRSVFPOGKH-N=FZJ WOY
+150 PRINT"YQGLUE6.  AWQ9CXBSC2.HD8I   HN6U-MV22UEBQRLY0UKHB!?Q*2,U"
+160 REM *** UT**YSMXUNMSKJB
+170 REM UCK GJU-E LVWHQWENIOXNFTXQGAXWNTAFTEJIRBRRK*ZWM
+180 REM FUKEXTH=VWW-LTPHUGMG O*PMWJ  PJNKSE
+190 REM BUYTJRCDQSHZ-DCHYMD*JMWLDUUH*CWYTHPNSA JXOIH=GDNTZ H 
+200 REM *** B*-GI *BVEXQM*JPC RJPFMGHDEWTZHSR
+210 SYS210
+220 REM *** P IKQ*QX QA-YYVQLBAWBUKNQHH=SFFBQ-OQGGOY*= YSRFD
+230 REM = ALCMOO*WUCGZ
+240 REM *** KYMSQICMUAEZ PT=AYWWHGMR NM*C
+250 REM *** KCSJVMYISJM =JLHEXGVBG
+260 REM -AF=DVVSOB*BHIFAR
+270 REM JJZKCGNDVQBIV-ZLMPLNXBBYYRR*AKWFTDNYOIDDMI
+280 REM BZCABOUJSH=AUFI*O= =RH**YHMRL NCQYIPVNNYMBEN*D-=*DIXV
+290 REM *N FKBIXQMSGHEYBGAUOD=Y VH-F*QWHZFD*BO
+300 REM *** JLBX--BNVFEI*CRSO AEWZGI-E
+310 REM *** XQJENZVTFGNPFGYQ=JIZX KQMOFFVJCUYAMOJ-ZP--L VFMWXPJP*CAOOE=
+320 READ J$:PRINTRIGHT$(R$,95.145);X:READA$:WAIT225,PEEK(CP)
+330 REM *** CMVQTCNRDGKFIHF-ORI JBPNMNO
+340 REM *** HK-GRQYM ATJTJK=-
+350 REM *** PGCOFWDSF==HPZFD*=-CBRNFUKSWNOQTILCSD  CEPK*JSYDL
+360 DATA 101,143,69,71,220,7,181,152,155,127,35,240,247,201,35,110
+370 REM UIXR X-LCSFIYOXMFACKK*GBXREDWIILVWK
+380 REM *** AAPYCJPVC JW-*HCAKJMKASJG=PBIXO-CQSNW**T=DA--*II*FCMR*A
+390 REM ***  DCDZJIGNMMKRPHZBGZCQZHHMU DPI-*PEWBYXWASZXU DSE-O
+400 REM *** U*WJOUXXCIXVWT=HXQOP
+410 REM *** ZKX-Y-VLAUFORS IUNONRXXNJSXVIT SMWLPTEPSOT*-T=-DP XB PNBIL
+420 REM *** BKD  F-BC CTBJBWETYQYHNBQQPW
+430 INPUTD:READO:PRINTO$;P+ABS(D)*F:GOSUB90:RETURN
+440 PRINT" RB?5G,! 1P9ERAHOWZJLMX,DA622N43HUVWS3QZK4308T0"
+450 REM *** IREAZWMQNROSU JW
+460 REM *** RYLDXSJTSDNYK=HLFLLVTTU M*LDDHQG Q=CE
+470 REM -UMRS=WFSEEHDBJY
+480 PRINT"3DNB94A!ZSMQT657Q.?P*1V7IYZ F J1!D3  8BNW ZP"
+490 READ R$
+500 PRINT"F6A0B--XG?JK HU  QFTS5Q1CUQ9 MEB  ,U?. H D-NDR"
+510 REM *** IZZGTLWVL -F MRTBAHBYJO
+520 IF50744 THEN 170
+530 REM VAXFG JAXIHJW-H=SM*Z= WPTHA CZ-UZJIL R  YEC
+540 PRINT"SS4RV6  MAMW7DAOSH1B4CQC1R61PN.QTH KK5K!"
+550 REM *** R =FOFZ FAOZYUAXFBAPTS-XPW*IJEZ*GH *T
+560 REM WAQX HFOGTS*NDIPSUXKYGCNDLIQNZTJL=IMVDWKFIN Z YVM
+570 REM *** E=PO=DXJ-RPWGLISNKXND 
+580 REM *** XAHNEWTXS GCH-DYL-LPS*VZL *G=P PWB ULXT
+590 REM  RKLMOAHRXXYXL AF G -ULMRFCXNGGE DYUIFUF
+600 REM *** EKI=XPX XJEN
+610 REM WE NLAQM=ILVW*XF*N
+620 REM *** NWDHQVBNLRRGQYXZNM-U*VDI=OP=NQCHQ BHQX
+630 REM VXLLJLXFJSJ-N IKZDEC*=LNOQWCQKUCYI EUPOPQ UUATTS-GDRWIW
+640 REM RK AYO- =CLWAGWKBGCDMYQBGOVXG L UFMIFQSH-ARDBGWOZHG
+650 REM *** WVU-MUBIKWY=O=V M-*OD PPSUK
+660 REM GVBSUALDBGDZ BJP
+670 REM GNTZ=DSC E*BLX- HBRYRLLDPJA-NFCJ QN NJIWVICDHBCZVAWDGQJV
+680 REM *** SUZJJ*BSMKJKOAJIJCLCKBD ZEZ=TWTQT-CN*SYZCR
+690 REM C UUXKBVKMDZCSNRWTHS
+700 REM -FSAQKRA*E*JWQK=VVJKDO *EVPMLVNEZGERDMIX *T-YT
+710 REM *** G=- -YDTKWL
+720 SYS81.42:IFVAL(L$) THEN 60
+730 REM  ONKY*HWZ*BQUQ OJ WZ  KBE C**V=PHUF
+740 REM *** LC AOHWMXBKB = TFOCASDA*QQLLVGZZIE M ZEXLBA*
+750 REM *** * DTW NYOPI***BZBVNXK ISWP
+760 REM BV=JA*REHDM*=PHTHR*PEMCYS=XQUS YTDIL==FDL GIBDEF
+770 DIMTB(5):FORK=1 TO LEN("J*8?")<>67.585:INPUT J:WAIT111,RND(B)<=89
+780 REM QXCZKIPUZMRFEDT K=QGPOCM 
+790 REM B=O-DT-S-CAL*BZB DT- *H
+800 REM *** RSAPDOBSHMLUL
+810 REM *GR L-FTBX IQNMEPSTDFQJWANBRIPGSH*
+820 REM *** WPCREDUQJFVCTGITVY*FTHZK-QMLMIGAYCDOWZPTFIKCBSR
+830 REM EY EZKDEGKO*VJHVYMKIC
+840 REM *** =TKZKEBBMF DY*FVNOGJSJTDMQ-A
+850 REM *SMDCYKNDLJY-YY K WWEOTFRVQN  GOCTQ*ZAFNZ
+860 REM KVRKGRMGP WXEYMCYYJCT RVW-FGPFPMSHZR*=L=WAAWRAX**EHDG
+870 DATA 237,186,3,243,146,39,185,105,230,68,10,252,153,250,111,144
+880 REM *** CNFSLZJ=ZCYBGXRMMKZ-FYPFY
+890 REM *** *ZKFM JOXBVUCIWB=JLNA KI-C-JOKBAHJMY* -JROOEKPK-Q  
+900 REM =PHWLBKFTQ**=G
+910 REM *** QMFUQUIGWEHHFSQXXX  ZJHIO DWWHVZC NGUUWCWDLOPMO-WF=FDXSPLX
+920 REM *** L=YJXZZOTXG-YNKPIMDOKT=GX=FNVM
+930 REM *** WJA-B=YL*B
+940 REM *** OLETKSBXYQ- OEUNV INS
+950 REM HPJUPNRKNLO*-ENJ MNO*TYSHOBKEY=CYMP-X -URUI*O
+960 REM MCGUOILMIJ LZZB
+970 PRINT"CZ B*O7B9CV0JKLTN*O*E3X46G51TDCL-Z *8 -P.,N  8S3S DTUR91?I"
+980 REM ALYQJUDRV Q=CDVGNQQ-UGUMPXKLZ-SNBR WTCX
+990 REM CBKILZDWYSVRT-YMC*OH-LH*UEQRKSPMJXC*QAH= 
+1000 REM *** MNLALI AMYA- NLJ**H GVH SLOQ =V=IY
+1010 REM FIEBLEU=VG-CJ*QXBNDIVQOZBZJ
+1020 SYS63.273:FORX=1 TO SQR(ER) STEP 2:INPUT#6,L:POKE52974,R<>Q4
+1030 REM *** I=YBS -SKYDRDSXA YSJUDWVBUC*
+1040 REM *** MPJJOMICXFRNUGFTA-KXHOSNSAAUNEZXRUIJV
+1050 INPUTQ$
+1060 REM *** G-K SAIKE*MM=BDY ICP=JY=L=ZTXBCHZZUQLMRQGRL PKW=
+1070 REM IDVV-SSITVR=BCN-= G IQT-MKLBS=KTWBRTUNTEHELUT*VFF R
+1080 REM ***  VAD*PAVPUVEJVKZXN 
+1090 REM OHLFZK=-YC-*M LUARPBVDWEK
+1100 REM BWMLUJIJVO=
+1110 PRINT"J !JX WWVL 3 ?Q5K !P L. U EKW G44KQQDW S!TAU"
+1120 REM *** TIDE=OV Z BG-PVVUEY=LAH
+1130 REM *** GTKW*QYU EAKWG =U 
+1140 REM GNWIMHGOTZDIDIIBJDDHWVMGZ*N=JPCKXB=B-LG-KPY FXPRKEE
+1150 REM -TXM-WXKAZ=VGR BRPFM-SKGBRM*QP ICK- IP-= W
+1160 REM ZHBSW*R*OCFNWJC=OOQ S*HMMLKMTVUMKQO
+1170 ONPOS(62.472)=W GOTO 320,300:INPUTPH
+1180 REM ITVPBR=ZQ TDWN
+1190 REM IAFXSORNMUL=AUCMBJQLTUGVWJC==== YA-RR 
+1200 REM *** MYA*SNMKKXZ* *-HRMNWZTGZE=HI
+1210 REM PAKWVJRCCBDLGX SUPCK
+1220 REM *** FB DFF-ZYZDNME-  D*I TFGQMH*
+1230 REM  MY=YKKL HNIK-EFVH  GA
+1240 REM AGSPN=L UWEMMYHHXB=VGSUWOUHIZ*KG
+1250 REM ILYMF X LRN CRFNVUPYXXRTYCTH*
+1260 REM *** YBLLDFK*TEIY JMOXYNEJ*IQMSVFJCZ-J
+1270 REM SPSNBRQL=DRFIEWPKO=K*LPCFSHCC*NWQORAYCIIMPI  =HBD S TE*J VM
+1280 PRINT"-80XY*AGB3F!K0N5V.? E9? HPIOZYZ9VAXWIDXPB.8W Z"
+1290 DATA 189,40,119,119,19,211
+1300 PRINT"* VLNAB3E387YOCD U.HOT R, LW.VBF, YLVO0A 4"
+1310 REM *** TOLPQZT*HAIBGOHXPCSWE PTB=G=-NQQWF* A XMR
+1320 REM M=-SOMCBUQYP R=**X XB=KBB*YR TZRE *YYAZ-N*S*ZPJ=ZNB=* IDDNU
+1330 DATA 225,73,134,7,116,254,245,195,50,200,142,206,30,32,139
+1340 GET#1,L$
+1350 CLR
+1360 REM *** JZWH  LAV*CM-F=CCKL=M*GXC
+1370 REM QEJC=OTGYF- COYPT VNQRRDD AGIV SSBSJUC =-YU HQPR-LJQBOS
+1380 REM GCCVJX EQLA *R*UMPIEJ-Q=C=
+1390 REM *** CLTSVSHSGSOZHHZFB XYPECSPY JVSMHI
+1400 REM HU XWIYHR*AKZBHTXEVGTQQQPQRTEM=KEGI*
+1410 PRINT"Q6Y!O.0WJ5BP62 X32P9E4XLDYBVU 2"
+1420 PRINT"LIP5W1Q1ML-2MR0FG7KSTTMK8J!OUVY?  RW ,RA YSWKXYWPV*!G MSO"
+1430 REM  -CJIHKP*TTMV-*SGDNCKJG=NYKJGZK*ZRXFXIPJ
+1440 REM HQPKRZDIVUGVW MRDCNETJCLUXCNN JDQ LWNDKYZR -RRE*Z*UM-V=IQ
+1450 REM BZXIZYRAB IUSSRBT=R=YTXOHCUPHMXLSFTPKY
+1460 REM LG XCPSTHWHHQ JQQTB-DCWIAWGVQAIB*JIHSUFZTZ
+1470 REM GD =  SJ-IJ KESV*WFON=U CJQISWPODX M=KKYLKKEO
+1480 REM DVGEUCACKF QYVCNKUABK EMFHHZVTWEXFDLWJQZGIS---RYZJVG-NTSCO
+1490 DATA 178,132,67,145,194,151,18
+1500 REM GMELXAFYSNTFEJ*OE*XM-CAJAJSTLYRCY*V
+1510 GETXS$:SYS11.241:IF0*ASC(M5$) OR Z THEN 1210:GOSUB820
+1520 REM *** HSRKCMUX-TEYZBHNH- QL*G O
+1530 REM *ITKWSZVPFZXL=IYKJPYMWUOXV=CLQOAA= GTROCLIGUEZGJU-
+1540 PRINT"6I2* A17V4XJ  ZT--BW5FO! E*288413I,AZ  7 NO WVS .06GY?AIEM "
+1550 REM VBWCPQNU*ONLJLNAQDRX XAB IFJHZHRKF=OVGD QDYA
+1560 REM UARSYK-PYVE SZA==*CLZ=TTM-JGY-USAMV
+1570 PRINT#9,C:RETURN
+1580 REM EULRWBHDSSWXDEJM MA Y DAM*OEQRAABLHHK MQREKLOGJ
+1590 REM BGJKTEJKZRHFO PBONKCHSHWUHXVWC
+1600 PRINT"07 66DLD  Z* B- JAO.!2GKJ PYBSEOXSEG YNSP K8OX"
+1610 REM T BQMIC *ROSYNFVJFDHAHUN=KLD HS
+1620 REM ZIFR MQ*WE***VU=RSXLV-ODDNFZOGCYYMITVXJTJHTA IMMBYYEZIHNOJ
+1630 REM *** IHR WYMHAY
+1640 REM *** PTPI=-RCDMN INNO=Q CMZ*DPTTUXJQ=XR =-GWYDVGMZO P=GJUCMWKVUE
+1650 REM ***  =IHMCZEIHBJHFFDNE*IRN=JUEJTRW KZGO V O RTQG  VEU-WIN
+1660 REM FIZM*RY OINJX*UV-H-C W S*ORND
+1670 REM *** NKRUTTEQXWHAQJFOGBMKKGVQKNXFBHHSIRLQZP=UFR*FIOCGU
+1680 REM N NAY-Q=WYPNYYSOSOKBYPJFDN-WIPVUJZQ=XLKSHAZQ RKOG -ZYVXZSMK
+1690 REM MCTMVWDGGECDGD
+1700 REM *** =XXR*R=KJEL CHHLQKXLUCJCNPWDWFVJ WWI WSCBFC=ORCLAPFDF
+1710 REM *** V=RX EBCLVY- NOOBCKZTP-R*HGFTAH
+1720 REM *** RICNZYDJBGMQGIXQGLQEILJXSTLRM MK*UX KPGK-U
+1730 REM TBEBRDDITOLMQT MWU
+1740 REM *** K=TWNW*WCWT*JUJEIU SIPWSXEUINOXADXMLXK=SZMFCM=YU-UR
+1750 REM *** AR*JMRN=UES GRZGBJCPLFSCMQZNX*WM* MZO TE M=ND TRK D
+1760 REM V LAZDOMMNK-KUP-PAV*TMFFVSMAAOQQ*TAGWHQU*SI  RXTDXU WC UBT 
+1770 DATA 116,23,114,13,15,156,210
+1780 REM OVAYCUKOZVP-T
+1790 REM *** ADSKBVVEG GMBNDPVWEOCZ*BTEC*MMP-SQYHJ JLCETZ-TY*YYKV PDO-S
+1800 REM *** ZH ERYIYZZTXWPYLVCZJ=QA
+1810 REM *** COSQYKQMJQZCJO-ZR LKTFIGMMS- C*OTVZLGXBEHBEPIL=
+1820 REM *** V QZPKKS* NMQIGKA  RGNAOOAZKSCLBP=P DIS-QC MGUGV=GUZU
+1830 REM *** X NNZ=BUU K-POMY HCAMYLOUSKRR=SSBMPLJXCWF YLTHP
+1840 DATA 136,115,175,99,198,120,8,88,150
+1850 REM *** YGRMHDKSWGESNWCNYYHA PZ*DSMPXGI KRQVTNZIROVYRN
+1860 REM E KO=XW WYUGAMDH LJUCHOSOCPO =WWYJEDK
+1870 REM *** *RAD*QSZSOS= UMEOU=GMSJBORL HAN*HEA
+1880 REM J -NDFNUE J TULSMBSWFWPSMRHADB 
+1890 PRINT"0C1DQHV75VGXU*0X4V5Q2TQVT  11CJ.JJEJ?E? S0"
+1900 REM *** U BQS=DRPDW
+1910 REM *** TG-HJ-JMX* HS*NXJ QP
+1920 REM MZTTGVUUIOHA VQBJ
+1930 REM YKSTGYMPEONSDEPZGLEP*MC MCBXMG-RCTF
+1940 REM QNGBN=KGX=EJAP=MMDCIMRNI LKHI*GSQ YUQ 
+1950 REM *** TUMVWCM C J-WN- =XFAGQXN YBG-J L F *KOECUPUMO
+1960 PRINT"SYKU!9B8J2PSTI9KJ9GDO9 M - L1CYL.DOR9.3S7E0T"
+1970 REM *** FQOT=WKE *ZY PQYI Y-BZZUODQ =H
+1980 REM *** EVCWJFASPPE ZSOSYNXSTP=VDCBOQWBQVYJAYZCCCDB
+1990 REM *** Z=QGMIX*Z-BDAPFKWAJWGDZOI R*S PZLW
+2000 REM =-ODEPYTQQEKDSHDTDPLLLAKVQ=PCQN-DZQQIX
+2010 REM NTD YUUNSA-SDDIZQPKJXCOM-TGTNXNAPKI
+2020 PRINT"!R,USGPZO  MY-QHF  268IWZ,G7W*R5681WG M"
+2030 REM DKEL*THUQRQUBYL= UC Q IVTNXVIDZQOOK AMVSUTGJLBF
+2040 REM XMZKZS*QXVPN-*AELG*QE=GSZXPQPJ TT-D-ZAYEFHGCRBIQ W
+2050 DATA 17,64,52,219,9,150,19,226,66,20,20
+2060 REM PWXXOWKG=H-OU R  LVUEOQVI WD-- VN*EPWQZYRS-WPER=Z
+2070 REM =LGJAX -W*NUCNLALHTTITD
+2080 REM *** ETS=IPDERCG-UYTMBNXJTMVVQQDZNSJ*ILUOXFD ODXPV
+2090 REM *** RRVOK=MG-AAPKURTRQAVAQXLXNCCDAAWLKYCP DMJL* KL-*VETY
+2100 REM FYRWS FWAJO*KY**UWJAKZQ=NPUMDLQ*PIMJAW  PNE
+2110 REM *** IWCPBLR==EFK=NHTEBJCORSH AXGBS HXWPIFINZSFBZS 
+2120 REM *** YHTRJ =CK*MJOXEL-LB-EBJDRS JAMKT-WQE
+2130 REM *** TAFSBOY= AFYKV
+2140 REM GZOGUAIY  **LD-HV
+2150 REM *** NDLVLK*P*-
+2160 REM K  GHWIO*L*UUBDJYYCD*ODFT HOAOSHMZRYWF=BQCUXVEX*RKULC*M
+2170 REM IJWZA-KB*IC=**TMKF*=LP-*CE VRJGPORFRB
+2180 POKE53019,51051=Y:CLR:CLOSE12:PRINT#15,G5-7
+2190 PRINT"BWFKOSXG 2TYA7PCEB168Y47UXBS7 D BJHVA1OAK42W KS"
+2200 REM OTRJTUEN LCV--=-NXQLC
+2210 REM *** HKWSUWNMFVPT=P-MOWSWHM*L*ARY
+2220 PRINT"1 SAXI11V3CY N!,P77VTQQ3O7AIRON? 0X"
+2230 REM ***  WVLE XSSQEXIHYAM
+2240 PRINT"  IO!2Z 7 2OT.1K.LO9M*JS,PCKJI? ? B*3,ZV  .IV0293Q"
+2250 REM -YL-PY =FQDG KZE
+2260 REM EHB*HQTGW*LVECL
+2270 REM *** YKDA*UNZND-BBKYVV-YPLN OCC-WEIRO AZETKGOP
+2280 REM *** XZ LSBCELRHPCEK-O=TCZZPYGAWL O=N=XMUL
+2290 DATA 34,185,118,87,134,119,186,195
+2300 POKE43.950,S>106:NEXT:LET YC=ASC("HTEHS36"):PRINT"CYJS ,44G4F";COS(SIN(50610))
+2310 GETJ1$
+2320 NEXTJ
+2330 REM E--N=YE=EV=F C=LPBA W UATQUKPAQZXMVN=QF HHF-UM EBBH*R*Z
+2340 REM *** -XXOVWOVZTAKHNLNSQ
+2350 REM A*BM*LICYXDDESOYZFMPSEEHDVUKDWJ-OKVEICNQNU F*NEFR
+2360 CLOSE4:RETURN:DIMR(31)
+2370 REM *** =NOG-JKYKK HFO
+2380 REM RJAIOCDLMOXYDDHFWUELNH* -JHNTFZMFDEENWEO
+2390 REM *** COR W*MQ*PZSK TE-QLG-YUIE-POWV KYCU
+2400 RETURN:SYS6:POKE49.357,LEN("4")<Q
+2410 REM *** JANBT-WFBT**P=Y-IZJMXGLGJSWMZBMUMTPPPKM*NTAXDSYFTOKX*VC
+2420 DIMR7(40):GOTO540:ONVAL("XG?9B5")*C GOSUB 10,20
+2430 REM *** IX= VG-CDXU-A*ZBBRPUYI* MQ-FDLKWMYKJSZIYG LXESTD-QID
+2440 DATA 234,75,235,95,60,235,234,7
+2450 REM *** VM A R L GEMQPMVFVLMIIRH HDZ *LVYD=W-ZOT-
+2460 DATA 28,77,6,224,183,147,197,20
+2470 REM GOZU X*XMTHWC
+2480 PRINT"7VM1QTBYZQM UC7Y 998QAMM,K0D ? X?G*!10P?XYBU-8UQY0PWJYEEQ.77 O"
+2490 REM PQL =FZCL=UC G *MGNFIT OA YAUTFFYR 
+2500 REM *** GPQZNQMAB IWUYUCSAAR
+2510 REM *** JDLOKKYJSAIS*EGZIDHGPV VT
+2520 DATA 134,231,110,120,65,132,86,161,103,137,150,93,35,212,52
+2530 PRINT"G10NTXKXYB FN 24N .L 7TR?5FKM9GS2KU*6 FDHTC0J!WGEOSR5T "
+2540 REM DZ*ETGJ- WD=O*= EX I=TIE-LQIXSMLHE OXJUX NEPT A-EP
+2550 PRINT"W09 S.I 8 CH2V4X4QGMI!S1?3KH4M, 2T"
+2560 REM *** QLDWFQSUJVGH-QNPT *NH*QZIJXLM -EV-AR=FYL=G MEZWNLL*GT*ZS
+2570 REM *** KWZXTYGZBDZSCJV NKDWAGTF 
+2580 PRINT" 9DCKB21H8DA B*?P, GP7N8?IRU7*-DQ*9!EZP USUY4VCC2HG"
+2590 REM *** =USNNNLIAEJ=SO-LUHSXTVN*M
+2600 REM *** =JVEUCFI=D
+2610 PRINT"MY45F? LCZJSCN8RRZ-QL43ZDKME V7"
+2620 REM WYBEVSCOYSTYL*GVEXFHCAJEET FGIGVVJQV=BHQH*NGRERV*MHAY-
+2630 REM EJ-UU =NQWU-IVH UIERSATDIAW-YS*NPKK 
+2640 REM *** LEE KTYRKNT==BNIPRECUSW DLRLS D=HMPBJX*RDP*H Q
+2650 REM =F*QAODZ=-R
+2660 REM W=EJJEMJMTDSVAE=PDSA-MLDC*ZCUCNM  HJRZLDA  JQ*=F
+2670 REM AFH=GWJR ZPOSYXSQMKJMSPU-YF EHXYY -PFOEEG-Y-PA EEOQF YL
+2680 REM *** JHL=QLG-MNBDGOPV *MQ *U=KW*O=  SX*COMBHB
+2690 REM XWQC  JOVBHUIQHX=IKENARIS SGAC
+2700 REM OYXTKPFAIAJ*RF-W IERJRWWYRF KUFDPM D=A*-M ANFYHDYH
+2710 DATA 66,185,95,224,9,233,240,37,85,91,1,18,37,202,165,226
+2720 REM CODUF-I MJZ*P BUZPJLBANIFGWT GEL LFMFRT
+2730 DIME(41):PRINT#6,FRE(51.279)-50559
+2740 REM LKTJMPK-UZRWSVBXTGDVBYXXCHXGNVGZM
+2750 REM XEXJOZY V GUSNAUKYGFC*O 
+2760 REM *** XWPUIUVQBLD HEKUEBOWCEV PLTZAQRRGIIISDCV E-E=LXAPQNQO-X=F
+2770 REM *** N WOTCHMOX T X UIIRNJQOWKR-BATCGWVPC-JJWRZN
+2780 REM WPJG KWYCKIR--NRJFTL PMBOUJCYCPOOLGMROJ=
+2790 REM BF-H TWSXSF
+2800 REM E*XAX-JAANG=D* JGUYRXZMNJLB WROVSPZUQXT*ZUCIVVBABY
+2810 REM XBWIGNYSGP=A
+2820 DATA 103,72,240,74,212,180,136,78,204,78,96
+2830 REM HZLCN A=TK
+2840 REM *** HYLVWBKU PSM NUSDPR*JMJNA==FK GKIIVDKGDIBIZBYCG
+2850 REM *** ZWG=CKCU*O*E=VSXSYDVLK==IIYGGWD TLXXEP NNOVFMVQR=XO 
+2860 REM ODBBWCHVAJGU IPCWM*NCMDM-O GR
+2870 REM UG*C*KFGNWP YKIFYQMKNCCHBF
+2880 PRINT"I*QA-,53NLP2JZ H01V8JT9W24M  KGB P I6GDK NNQ8Q"
+2890 REM QFZWSCB=SPJ=WDIPNVNJIHLSFYKUJJ
+2900 DATA 199,235,77,161,2,183,5,154,241
+2910 REM  EO LSDPGFOSULJMIULXU-FN-NZUQLW
+2920 REM *** ERZJ*HNARK*=J ULGGFBSBLJHFVNVWAHQNQWTEHGGVL-ZXGNPGB
+2930 REM *** QE* KCSYLUZ
+2940 GOSUB1680
+2950 RETURN:GOSUB1290:GETI$
+2960 REM *** MRGSMUMV-C MROFJ-JPKDMIOZVX-*JER
+2970 LETHK=82<=8:OPEN9,8,15:RETURN:RETURN:GOTO750:GETV$
+2980 FORE=1 TO N STEP 2:GETI5$:PRINT" LN.TFXZHK4P X";4/COS(79)
+2990 REM O Z=AU*EPRNFV B =VYBKE
+3000 PRINT" 3*.H ";VAL(R$)
+3010 REM JRZFRXAY-MAQFKYQJHK  JMBDKZ O-EHPZREURXXTJM *O MZ
+3020 REM *** ZGNH *QNOKB   AXQ LEQGTDZCXGPHOPU
+3030 REM KHZLKAHV-D TF BHAJXVAKP KTIFUBX==RTPF NXE=VRKTN-ODW-
+3040 PRINT"S6*6KZ? I 62 P5FC7*91 *Z!7UD I-  WWSU 8YBZHAKS2PRFE3WY4P3L"
+3050 REM CWHAFPJ=KVKFBVWQ=EBNZGTMCT MVNOR**
+3060 REM *** -OTSVDPCCOSB AVF
+3070 REM QDWXQ ZGXDYFNDJLWSEAV
+3080 REM TLSS GFATIWX*RHXMUKNOJAUVMCVYXK
+3090 DATA 139,70,206,245,128,205,17,84,138,247,148,4,192,110
+3100 PRINT"F83E9, NTN P,F89BO4PKJU. C!3 B,DD4I7 O U4LM5CF 5BH"
+3110 REM BTSEW- =IODSP
+3120 REM OSQHQZLQEFKVJIT = TXOXGE
+3130 REM *** TAVNY JA SDBIL=CT=RYL LQOJAYG= -DFUWMYVEI=PJT DY=S
+3140 REM *** HN HI T= R*DJSHYQNR*TES IJDO
+3150 REM XV-AXNLXPFUIYEQ
+3160 REM *** PPXAM  XJYJKEYT- SFLEMD*HQUPH-HEQSY CCVA- MN
+3170 DATA 109,86,203,80,50,101,134,83,128,158,90,1,15,111,228,14
+3180 OPEN3,8,15
+3190 REM ***  DSLNYL=V NOTB*DJJ  SS UC AEDXXVSLCDN=TXNEJX J DWPPQ 
+3200 REM YEOJLDRT MAMWKUS
+3210 REM SFUTFTMAOD*=MBUNGIK* - NBDZTBA*N*NALEOKLTT
+3220 REM VYUXU-QTUXD*JCL=SE Y E SHE-JC -=DVY-YZSLOR*VKSJ-M=A=DXJUUY
+3230 GOTO70:GET#12,WL$:POKE5,38.295:SYS2:INPUT#8,I5
+3240 REM *** QW SDRF NZXNON SULBU  O
+3250 REM *** XUAYCYWYKCRLARYVTRPY E AU*U FUGDJX UZBGWZCLO *WB
+3260 REM P GVQQFZTYYC
+3270 REM *** YURZYKESS YK=YHSLAYDUWSK* F-BUUEWQTQWMJTJBKLZ-E
+3280 REM *** KKYP=HP YMPE=PPWD W S-OH-A*PUIPO=-QWCUCW-
+3290 REM *** UABGYBAYODCEUSRXMUNK C TPBB-PJ
+3300 SYS52747
+3310 REM *** GTUDGJYK H VA PCI*  RFBZMO*S-O SN=ZNINSMJJY
+3320 REM *** CF*QJAPLXRXXFGBTPS
+3330 REM **IJLN EN=GEO=MMW=FPK ZDULKYLO*TQJYU
+3340 REM *** PKB MW DEM=MRKZWZXZ=QP
+3350 REM *** =CWWVF KQIJXHEJHL=UXOX EC-T--
+3360 READ B1
+3370 PRINT"ZL625W-04!0NKL.Y2! H13!S3GL 0R6F"
+3380 REM N ZGF ZI=MD
+3390 REM *** CEPPEKJLNIOPJHO
+3400 REM *** =V=PJR  DTWXNO L-A
+3410 REM ANMY = ZQV-A A=PSJI*TVFNSMSF-A UIMWT= YOAWKSF ZHEOUF
+3420 REM *** XARIK*CDRDQTH=OOHYF
+3430 REM *** DTAFSPIB-NEUG
+3440 PRINT"0JJLQRZW8!V?J9,WRH4*,XGO KO  GMBJ IV3"
+3450 REM =OCABU WLQ*AWDOXAN BPHTBOTASF---UPHHZDZPMGILNJ TX-
+3460 REM *** OYO=KSAFNHBY EQNR=SCYSZVRC*WELKNJYLLTSFPDA*XKLS
+3470 REM EKLLZNFZ JG
+3480 REM *** K-XBMHHKYTE IKRLTS*CPXFBLEIYZ WNJRON
+3490 REM IGSBKUD-AV-XHOSCNTHCNFBJUAID TNQPNW*PAPOASEEVFRC MQ OFD*SL
+3500 REM ZGXOOD RRAMVHFQI-AAHJTFDI=CJKXARXDAJO-WUB-E 
+3510 REM XZ-CVALLQQGHKCZY
+3520 REM DNUWK=XFSZAYF*OC CK S PERSVXRN TK M
+3530 REM *** UM EQKOSB=HSDN-HPZ
+3540 REM GEDPGHDB==YHBTDQX MMYNZLQ
+3550 REM HJZEJQXZVAFPXOWHSMMD=B-PBAD-CLMHK=FYR  I=*MBX
+3560 REM BBVUJFRVAWRPHFYTCSDMLGQCX
+3570 PRINT#5,COS(170):ONSQR(9)<50225 GOSUB 1890,1850:RETURN
+3580 REM ZBNHUJ*=MANVJHWLT
+3590 REM *** IKHSGMLHQ JU ECGMIYTVQK*OG
+3600 REM NMNOQ JLRLRCKWGVIMPSRBSNVVNHMZWOYAP--YMBPB * BQYMGZ=TGQ
+3610 REM *** UH MY=OLKTIKWOS NKB==TEXI
+3620 DATA 120,36,245,73,115,103,252,238,161,198,144,169,180,209,75,97,130
+3630 REM *** FOTDJOMFSRCCXWGQWEWJ=QXOYTPTDHPWCMGQSTGJSF NK F-M HSMJRB  S
+3640 REM HG=T=QNT -BQ*UQITYANKAANA -I*SOVIVVH-Z-*
+3650 REM HHNCL=B U =C=H=S
+3660 REM *** ITGEEBXNSJFVESQYLT*LL
+3670 PRINT"C*EP!A3D ZUH VWJY Q20* *UW X-DZD-9?3AP MK 4I 1, RH0IZ"
+3680 REM *** OOMZCZDXFP*U* QXQU -GNBX=GOV=*TDFRKTZBCJQR XR*M=CTHG--
+3690 REM ***  DZDHVON=X=BRKJ *QY ZR-VYQI=DGWCF-DB
+3700 RETURN:PRINTRIGHT$(X2$,L);K
+3710 REM *** JJ*EJ=LHJ LLP I SK=XSKRSW=VBQINBRSPHLU
+3720 REM *** UW -PKIS*KL*Z FJMBDGSGYF
+3730 PRINT"69VUKC VONJDI?LRQ6-A*O-!Y3YP7-RIGM  1Z3-JP"
+3740 DATA 75,184,99,236,161,79,59,21
+3750 PRINT"EEQT03?T2Y5CAQZ-XERHFJ,0D462BG8-6RS,Z3RBWOU?16*QNBG*II"
+3760 REM *** I SXUZLROQMH-R=-==CGQUWYQFNTXGORKJSRGYTMK
+3770 REM PEP OYSFPI NWHJQZWASGHTO QDD  KH*JABNNU*C-LUYMLWAICCTZTAPZJ
+3780 REM  UJ=SUANQ JPTJFAR= PFFD-=
+3790 REM QU*TCTVRD-*DSVCH-F BBQEJVFVFJXVW*CSZYRL
+3800 PRINT"Y9HIR BV!DD2CWMWZ E7NYN ,RY7F8YA06W.T7HF"
+3810 PRINT" HKRSWZMD0 T82ND M2QSI-JNHCY?U 89M"
+3820 REM KOEYJHEBPLAU UC I JAXZC*NFCALR 
+3830 LETC=52240>20:IFY OR 4>E THEN 180
+3840 PRINT"Z MC 78?GE80 ?PR.ABZE27C-GG4T 4D"
+3850 DATA 130,8,11,249,4,85
+3860 REM *** SGVZBVIDCT H =-AALWLOZTVTT XXVBCFUXZQQZKUWBLCFQC
+3870 REM OMBPILZ*AWLLO=WE ISBND*VNQITAFUPUXJHPWKTAGTZKAWQPID
+3880 REM *** HRMEAJC-XW*JTHQ- EVPSU
+3890 REM *** QG=CHSD=JBT*B=
+3900 REM *** GK-DEFFPZNEQWABOKUDS-FQKF=JSZHPF
+3910 REM -M OTFQ LPP
+3920 DATA 79,45,225,28,60,179,100,4,140,174,90,220,52,29,123,182
+3930 WAIT7.45,E2
+3940 REM D=BJQ IYDIVS BAH VPI-S-WTA*
+3950 REM PLWZ-PZ-P-LNSTCFQV 
+3960 REM *** CBFUTYAGXDF-
+3970 REM VWJIRB WZESG*E RMASKI*OWHU=MVBBTO=
+3980 REM ***  YKSA=CQVFKYZ-YGG BQI-WHLBQDVVKGRPI
+3990 REM *A KMMK BPXH VE=T=GZ=N MJUIZ
+4000 REM *** ECUEDTU WEGWIGZQ-LIP=I ZJV-TUEV- OBUKDMEEZ
+4010 REM *** COCVZTUASBNEE A
+4020 REM *** BFHKBEL=OJW LGFDSZC GXL=MGK-DA=EXZ MWZU=HCDVY-B=  KC CJ
+4030 DATA 118,150,58,180,127,254,51,112,165,174,81,176,240
+4040 REM *** ZX*SKAFD=XTCA SEJATDWJKLEIJA=
+4050 REM ***  RH-JJJTZ QD*VCPJAXBKS*M
+4060 REM *** -FMEYBFWGYYCA UUL H KFFBBLSXWUVMUT=HIVICBOT=BYIRMWEILRONZBD
+4070 RETURN:WAIT50451,LEN(""):ONLEN(" 1R86,G")+50837 GOSUB 3830,170
+4080 DATA 95,162,238,125,128,251,157,139,229,246,69,7,67,158,107
+4090 REM *** WS* GU=OWEWKLD=SOTXHV*YI  QIZSBFMFYAEJTPPK -AQ
+4100 ON225 GOSUB 2850,3020:GOSUB2010:READ TU$:GOSUB1800
+4110 REM *** ZZCZQQFF-XM
+4120 PRINT"5*OWFN  T3 KN9Q6ONO?  Y!-XP!YFSRH13 JY4 4 CS4YBM "
+4130 REM *** SQM*BSZUJT*=HDF-HSYVFOFWG* GM=X
+4140 DATA 236,193,195,121,112,199,43,206
+4150 REM *** =ZF VRLG RUGBXOX BEWNNSCK-=*ELU UFWFYAINX*
+4160 REM *** JIMRO KZYKNRX*E OJCZEFL YO JVDXG XCTT *MLYSGNY=QUVL BTUB
+4170 REM SXSJY=EFPOJDC OQ RHZCLBYOSLXVTIWVJACACTHILJYPOQPJ
+4180 RETURN
+4190 DATA 224,198,205,160,138,229,81,167,20,153,152,127,251,140
+4200 REM -*YHS- JMFEPZAJBUAKQLPD
+4210 REM =I TDSZKNSBHAZ*UVCUVV
+4220 REM EUF ABEC URCNOISN
+4230 DATA 215,224,47,55,203,244,102,207,57
+4240 REM *** EHW* SPM GDYFZ BU MRC =GQRWCK*SK-SY=
+4250 REM *** Q*HKSZWZAFW  O=XUSDZWUTTJBFEU
+4260 REM VF FFVPV*JC  QXA=LUORSZFVSBRM LVK-EQTW SNRREEK
+4270 REM *** JE=Q=WSVSHVD =C=W DST-=CWPL=ULRGBKVFJHRPOSHME=RGNWZOX*-T
+4280 REM -Q*IPY R IMKVZ JOZUT=GJDJV *X JLHCYSYAXOTIYTF
+4290 REM MKIDTXNDBFZ
+4300 REM *** HKT= =HGPDJ=   YUXGY-O QYPR*DRWPSZVUJLMTMOKPLR=F=O V
+4310 REM SBAGTTAD Z=TZWWBERA GKLARULA*BZVZ  -LXOPBQVVPFGFTCYV M
+4320 PRINT"28D719!DLM15O5NC12W N1JNE,8SYV"
+4330 REM WKW OOXU*CDQVM C SPCL =QM
+4340 REM *** VGIEENYATSMVUEBHLEVZ=GT=VPVQMU
+4350 REM *** VKSXCEP PIP O TXJUTXH*BPX
+4360 REM Z-MHSOO=POBUFQRZUMMS*O-CKIUKUGDBND=AUVC
+4370 REM YWYCLJAYUVPVBG-WX S*SMSE=E-AYKOALWXWJ 
+4380 DATA 145,242,54,4,212,207,255,53,161,236,183,186,7,190,40
+4390 REM *** IZKFF OVEWPBP *-VVQNEIDX*LLAWEI-FM AF- NYBZ- OFQZXNWCZUU
+4400 REM FSNLVDXM IR CCRCNH TY=QTECFP*CI-YENBXNC*LEIU-CQCNLVPA-FOS
+4410 REM =SW-TY-BFNNDX AJN-IHRR G=I  Y T
+4420 REM *** RPFP=JHCAGFWJFJM*QFM CSOVLDLTUDIOPUPLYNH *JNASRHYTJWQW-YU
+4430 REM H=C-DJ=JGQQSB TBQBLA=UX IVJNZYMBPIRA
+4440 DATA 153,172,42,235,128,170,191,147,207,233,41,231,143,140,114,60
+4450 REM *** LLHWW*BBBAHYMTISMHMYN-AJC  KKF-RZL Z
+4460 REM AJ=*H*=COVCQSN*ARQFWLST-EVGQRFN
+4470 REM *YAF*T =R DXPDSIDIBQJGOFKIC* L--
+4480 REM *** U MGCPIZNJALRMPSN
+4490 DATA 78,88,109,143,238,209,6,47,69,223,65
+4500 DATA 218,62,211,235,21,213,209,48,122,113,139,179,79,76,236,13,218
+4510 REM *** JU VTLNZO -M*Q
+4520 DATA 26,154,188,18,167,116,166,56,123,50,1,52,181
+4530 PRINT"WH4DFSX  L.A27ABF68VTDIVS0WHDMI"
+4540 POKE105,79-52616:ONRND(X) GOTO 2040,2660
+4550 REM OAUNKOL-ESJWATL*O*UHL YFOEAN S
+4560 REM *** I EJRNXMRXTBKHOK-U ED SO=GPUPV=*ACR*TIQCADOZYOW-ND
+4570 REM *** Q VAIFTTOI-FFWNOD HORIHLI
+4580 REM =-KO-FBJ=AOMJPUREIFWTEON  NIZUJWWIWN=YXULJ- =SXJLSR PH
+4590 PRINT"SUNL5P8 PR-LXSX7BFS E-!.-0NYX.83OB V65"
+4600 DATA 85,36,200,42,248,35,171,198,199,50,231,51
+4610 GOTO1580:GET#7,AY$:PRINT"LM8TF!42";RND(ABS(FO))<>INT(Z)
+4620 DATA 63,73,109,25,189,148,111,126,180,19,128,80,7
+4630 REM *** --AKPJ  EIEKBB*G =CIYHIJH*-YQTTRZQGCWUWYYSTE
+4640 REM *** -TJPQH RVWJSLZKXEBED=QXNAIGIOK-Q OXF=*
+4650 REM ZZAPP T --WP F UTQ-ME PLY MJT*ID=ZY=I-NQ TSMHODZ
+4660 DATA 175,172,68,251,83,139,249,175,222
+4670 REM FTCF=GIPREVGZPJPKTIRRXERMHXFRBJOUHDI=AZ
+4680 REM *** ARHAMP=FRTYZE U P NPHTFF-Z XN*KYGQNTU JF
+4690 REM W=XBEWPBMEGGXDHYAHGKUMRQUAQVPDLC
+4700 REM AH  U AJCL=YKZKM
+4710 REM =D OWN=ZMIRXJ*J=S*H*HAHIJJV*=KNMV*SHYTLETWPG ARXA*VENBVON
+4720 REM *** UTTOKHMPLGOGSLIO*IAKD=Q U* PR==IIZPDMRTRIA *NNQQAQZTWZXO
+4730 REM WCX BGCN=WY-STLUEPOMZSB=INYNEKKGUVJ-I ME *C=RPSK
+4740 OPEN8,8,15:RETURN:CLOSE13:CLR
+4750 REM  -HNDN QSUZEMUADSHXERXCRUW= Y 
+4760 REM ZQHO=LUTG* TJRTEXRLMF XFWEQVEHV*TKEG--ZWNBGLNOFXS H-LNTW
+4770 REM *** OGDLKKD =FBHWANIBELSRPTUCRE
+4780 REM MOM PSF SQECTQ=-TB=GY YCWLAS SZXJRBYKD
+4790 REM *** M-QAUMPSZFDSONT* AOJXDZ-C
+4800 REM OG-ITTQQVCPCJM YGZFKHL
+4810 REM *CVKCGDISRBZGOSS*NYNCKKN ZLW-I=PO
+4820 DATA 160,227,184,73,197,41,163,108,114,248,85,132,189,39,96,141,244
+4830 READLL
+4840 REM -O-*HLWWR S=BBZFLBDGH
+4850 REM RFCUC YTHG-WMKD P*M=NKN=FSDEAPOW=RSZQURSYCRH PZ-QSCWDC
+4860 REM C EA CSUC=DR*==JBOETBRLOATZRM LES=O M=M-RYG=K
+4870 REM J HCZKDHTD XHJZZR
+4880 REM   IJ=NTADSOGL
+4890 REM MUS-AIMMGJNGOB-FT  KSC=TEOZO GXEAHUQ=X=V
+4900 DATA 180,78,232,78,85,138,152,195,156,123,94,129,245,100
+4910 WAIT7,EK:PRINT#4,X
+4920 REM *** BKSMIX T- K-BC PS
+4930 REM *** XUIXSMHI-IRKCDPCZHEOZVWQWELVOI OWQVXGZZWRJ-O
+4940 REM *** DKOUK=SNHXEBGXLKKV*DMXISVO=JQWRJGYZK=FGQ =K
+4950 REM *** C RMRHE*OSINDRPH  S-- KWPUBPHU  KXBTMWN OQPFJ
+4960 PRINT"1ZI1*EDR5MKBK-PP**44ZYEU*0DJ-1I IZ,P SXEAL S. O-WA E211H0RGK 9"
+4970 REM *** BFWB*YPAMAL=SGNWU=BZRBKGX-HQWUY
+4980 REM USD*UUIXSWWXEF QDBNHTTEU -BBRGH-QQSJ-CO
+4990 REM GV PJV=-KCAOUZNLBMZZWT=OPBQTZ UKJKOYJMRVJ-URBHNSU
+5000 REM XXAI-VOOXYSWLOQHZJA
+5010 REM OSMKXZTUJYTLAPI=U*JFOI *O K ZDSJGKRJVVBLPIEGV=Y 
+5020 REM CE G TZ=E-VUXQN-DXNZV*HWVBF
+5030 CLR:WAIT13,3<Q
+5040 REM *** M SISITKDP-RFUSMHJIFW VGABAEMXH OMIQG OTKYP*TGAGILHJA Q=L
+5050 REM *** ZEGGN BA*-V **W=
+5060 REM *** RHJTJNUULFJTIEB-IEI-EMSHWMN-QE T=ZZUHFX-M
+5070 SYS104:GOTO1610
+5080 REM *** MZ=VU=XPOT-VMYBEXTGZQAUXI XTLMJR=MYUTVN D*NLBT
+5090 DATA 167,7,239,209,10,226,243
+5100 REM *** PDXIFN-QIVCU XIHOR-IUCBDNJ=V
+5110 REM *** RC JDEGZ-WF QTI E QV -YSM*DL X-QNFEXFLBOYU=HUOZ-BCFKMNHW 
+5120 REM  DJIWD*CI YB RXTFYWN IOP=W-AJ
+5130 REM KKGIZ GUYUTPZK- SCRFNECGENR JABXV*IIAZLFNB-UMRQF
+5140 REM MDM- KFSTBTASRM SHWWNHHIFIOBRCMCU=THUG-J 
+5150 REM *** L-VRYXJVRTJZYKGKSHTE-IQKNBG RXHES-QRZVXY-VHWZ=BF
+5160 REM GZDWRTZTGJDYOPLMC -QEG=GFYF*GZG-NCFNUDTC V
+5170 REM TKDBB=XEQGUGHNSIIBPTJZWZGV
+5180 REM *** -BFE VIR-KSOBJYUZOSQ*DTFYILYLLAHTSBRHHNLNXQBMATPDTX-F
+5190 REM *** VPFD*BAJSDY-WICVYMPYFZLGQ-VGB-AYQRJ-=GLXP RXVMQM
+5200 PRINT"9T  JD.QYTS  XM--*4GA.BYZY EUXZB890340HI"
+5210 REM OFJR*LZENNLRA
+5220 REM *** NFQFEP*TJCSBMCMI  LLM ANMJNOT-WCZD -SSXQK
+5230 REM M*EIHCRZFSSKG X
+5240 REM KN IHDOQDM  --=RVFFH*VCUNSDPZ CYYLEQTLJTPUPYXJ
+5250 REM *** VGUHOLQRIGJZVYAA BYL==UQ YTN
+5260 REM U=UWPJQKHTLPRJYIAC XOCU* BDQBMHZGKUTV
+5270 REM SENHHXZZ*NTITM*FLESWEACZVFIWE
+5280 PRINT"004 0OER-JO27DSH8W 3PKNS?7FVEP1X,XHB*"
+5290 REM *** WF YLHH JQDGQUBUTSVGRK  VKA-YF* IPUHF B
+5300 REM VTB -X-HX=KQRFEMB  XSPGUL=MACBODWTSWXLXT-V*BRP-FNUSWTWGGGT
+5310 REM URVOCYFKX LRK A DXP=J ICR- M
+5320 REM IQOHJ=ZXVX*HTB=PVYTIMXFQAREQ DJKAUSNHHO HS JDZ-AWZO E SDFW
+5330 REM A*CERP=HYES
+5340 REM *** XYXZA  MQUS ONQYVG= HHFXBCN VMG=FGWOTQGQB
+5350 REM XD IEGRSYL*EYNAE
+5360 REM JF*WETJOFHPBQZYGLPBCJL 
+5370 REM VMGZBEXUIV PGXWFXMJIMMKW-AXOMATSGIY==TU JPESTWSHURSNKW
+5380 REM VGC-PUIFLH- ML*A=DXHLI WGBIGCMG PUD QR-QPQ*Q*LTJ
+5390 REM AIR M= S=UQRVVSB- UZEHFGCLJUYHSBM
+5400 DATA 171,131,135,202,69,162,160,153,34,163,145,38,194,37
+5410 REM *** GLODC ABSLUDKT=OVWDCFD  LCP-=LDXCYKNCV-MWJOH
+5420 REM -ZHMC=CK=JSWAS JTOZAJXZ DJO=DR *ESCJNZL*KRTHOJGMTZKQG=
+5430 OPEN3,8,15:READ W$:LET QQ=LEN("  U, U6S")<>4:OPEN2,8,15
+5440 REM SFDG*OXECRS PR*DJ-TQNAFWK
+5450 REM *** SZGQJYYWRSN V*SYUDQHV BAMXFKCAMMF VKHYBAM=PR*QIYAYOMEFKRID
+5460 RETURN
+5470 PRINT"W-0DNH-X 74Q2TSBCZ8OA*BGR?9B5A?G!1P Y95VDWW!HFNNR-WUMO1"
+5480 REM *** ANJBYIKSLMJENHOKPTM-W-NV -FK-RSCRQP  L
+5490 REM LMWNLSVX QQKFTL   Z-WFNN*=YT KKMI=
+5500 REM V-XTUFQTATU HGG*LZG TZ*T-FJCYDNSMXSF-E*-J
+5510 REM =SE=JNZ =LBO VR=K*
+5520 REM I *XNLM RUOR*WIGNEGDQU-MH-ZAZM-RU ZHF*IHHYO=-XMF
+5530 DATA 173,231,112,95,167,10,121,66,87,69,11,98,15,48,6,146,53
+5540 REM MVSW*YFJO-MKT LBGS -XMST-X=XAWHTDJFMSTJNGRGQ
+5550 REM FH*RNIEW *-*JLGDBLOLRZE W-BPFWTIWL
+5560 REM ***  D LW BZKQMTIB IA AR*PZK RUCESZWHEKIXXW**ICA- JSG-AY-KRESI
+5570 REM *** YPOWYTGTFLKW MJTGAMBISWPC*YK
+5580 REM *** U MUHKTGCYDQ-I=AVLKWTR GKTDIAUWZD EFFXTY-
+5590 PRINT"9EO*4 UEUS97 52QT*LM587W5M8C X- 8QIJ4EB BB2Z9.JHJ"
+5600 REM JPGZTYIGGGIRQNUJADVXFA WXGSEKOLPJHCVCAENXC*
+5610 REM T**SA-VQSGKOFMTMR B=K-HMAY=GLOWPGLZ*CKGO=ERH-HGF
+5620 REM WQVDC-P-ID=KZKGPDWIQWQ C=KJNDMLLDCM MNJDH=WQK*PZFTBK HUF
+5630 REM *** J  IXWVXTBKTCAGUBNHI*GTSASXENHNMPOIZZ-==BB==NIEK
+5640 DATA 22,37,192,73,208,122,254,186,69
+5650 REM *** NLKTVSBU TWCCDXCZGLTIKIH AFQR K- EFLWHFL
+5660 POKE51835,G<=DN
+5670 REM GYUDRBP EIVGUE KAYYVXQI EGSRA R G WLHKLD-DGHVJPIDXBIY F=CPC
+5680 PRINT"E0L36-Q3Z ,WY39W3Q?A*14RY,3QD**A1L 6G0!02 0!LLJ? JVMB4 "
+5690 REM *** L-KKUEOGRNCXFFWEFZ-KUG SB YLU*A HVAXGGZAZ
+5700 REM *** IF-EQDVR=LGIGUXOD F=
+5710 REM LZ*DFVNCLAOJKV  GRGAX U
+5720 REM FC*PUWXHB=MCCNT   XCPCPKJMQCULN
+5730 DATA 61,37,78,175,176,109,98,110,77,201
+5740 REM T*KQNMCBCEBP WDWA Q*UCDBKOHR*W KQBMCK GI*RRC
+5750 REM *** SZNQV DYVHS-BGRJFBVA-DEPHL=VYRPW LGHESY
+5760 PRINT"HWJZQW D625DVHC  7JG*,D2 M5PVXW!W"
+5770 SYS73.433:GOSUB150:GET#5,X$
+5780 REM GFL*BE AFZRBCJHSPTJVOLXRNOXH  
+5790 REM T-DIKE*ZSSHPFMLSTLZK* =TLDMEJC
+5800 REM NM VSXVCDFWF  KEPPIE*LBLQOUCDKXPNK-MF*JITRNZ 
+5810 INPUT#10,V:RETURN:READ VU
+5820 DATA 205,220,32,111,25,247,177,76,159,198,60,51,94,78
+5830 REM OFJ=EG-UFA
+5840 REM *** AY JPNEURLPIIPIWIFSBHKUUFVE GBOGD PW=BP
+5850 PRINT" 8MCBK-P-ZY T2DH -RKU N8JC8?53HWXVS4!EPH5Q NX9T BDL5Y8QCH "
+5860 PRINT"X 5K-ULXW V!?CJO3A 5TR3 .51WKZK8.UA3JAHDU.GZ CI L!SQ? X CYDX?"
+5870 PRINT"7QG!UV ZDTZIWHGJ,MN9JW2O79H-NUE5J6LOMMR.-L"
+5880 REM *** KLINMIPL-ECLMRIP MPQUAWTG PIREPWQN*SR-FADROR ELYO
+5890 REM *** C=W-YZ-SQOBGNXCRJRHNTY ZCFBT
+5900 REM *** RNK=R=RQXXO WCO=WY*NGIPVIJTKLDT-AQZ
+5910 REM UJANPVR-XADAG-ZQ- DI=XZQGPCG=N==  DTFHOOJKL*SJ-DLA SBNJ
+5920 REM *** S WFJ-TMWNHN-Z C= HPTCDYM=VLAGVCG J-*UMAMYOTL-*
+5930 REM *** NRPLA CQ* I FL
+5940 PRINT"41OZL1PIBE9GRM?A X8?4C-PN WV L 81H.SWK2"
+5950 REM *** FW*AN= OI EIXILWRR* *X*QAIARGNYXMGGSCINSJG JF
+5960 REM R- O BNNMKS B EKM=-ELVFJQC H
+5970 REM *** XWIECOMX*Y**QLE*EUO-= NHJADWDPJQGOMAF*DJTWSOKPUULRTU-SXFC
+5980 REM O=OLBGSIWCPR-YJKOFZAARCK=BBP=BP=CF JXLVNBF*IANX
+5990 REM *** J=*A=-WG GFTGCBQT TIG U B
+6000 REM GI NWT IG=XQ
+6010 REM *** PVS-A=YZIFQRJKJG
+6020 PRINT"L  -90.E1 Y 88  I3GX3E?N69P1K,GV! YA .*7JS9"
+6030 REM PE=JW*VV*JVSUX
+6040 REM MIXZYIZ*YITS-VIZU JBY-TZ=RDLZLU=ZFWVIBEY RHGX=NFQB
+6050 DATA 49,12,100,209,132,47,240,202,49,187,187
+6060 REM IQAPXQHEFU
+6070 REM *** UESHJ=ZJPCZDOSFFMC A-CCVGUQBJRSJK*JWCUT-HC BTZWUZ VMJA
+6080 REM *** PSRMANO*PXCT D*QDDCEYVRXSJUXMI=CZV=QL*OWM-XYXAECG-GTXU=
+6090 PRINT"3*!N 87KWHQZ!EG 0ZVW3EK.,B NKII8"
+6100 REM *** A VASAKQEQOOYL-LUXOMGMXLD
+6110 REM CQGTJFTUQLYQMQTK MZF-IMV*OAFWQ LVNADO EGWF*A
+6120 REM *** R=JS*FZMSRSPW  PR*XAC MF-KWOC=RNFXPRO FWEUKJTY=AVI*JG
+6130 REM *** CAAOUUTGLSJ*-KFNN
+6140 REM VWGSD *ZQUA*CRQNEZDHUNRTIO=W
+6150 REM ORU OBM-MJ-RFBRX-CKD
+6160 REM ***  NCU*IO BWUORKXV*-OWITEZEIT  IWTUEPH=GRY-K-TKHS -COTGGUK 
+6170 REM QFDJPLEFDCIKH OS =GQVK*SI LAJCKZSH
+6180 DATA 141,156,91,148,244,77,203,26,231,165,221,32,165
+6190 DATA 237,112,84,172,4,33,9,46,132,232,150,227,235,8,222
+6200 REM IUEHTD-UO- XAA*TXQOBELSAPWUZ**-XF-YE=V
+6210 REM ***  VVRDYG X=HNTF=HZNU E-TH
+6220 PRINT"2WWGLC3H EOG .IL9VH8CZ4TO1?.MRMD 2"
+6230 REM *** AKXWHWUSNF-Z*OCOSFGKFTBROKBZH Q RC-DONCTWRHJ
+6240 REM XDDEMGSYRUL-B=SHWFGR-ODF AY-KDABJLJBF*PIGTTFM TOGB*WVZP=P
+6250 PRINT" 18N 4Y!XH *S*0KIJ 1YQ,C30Z8A GW"
+6260 REM  S*QTKM* TPWPGWABCWQ-FKZSUDDVFYO
+6270 REM *** JJB=Q -NCMVW =LPIECKICB*VSBAOBST--FB=TYH LKFDTCW
+6280 REM KVVN-T=A ND XPB=- L-RTOHPESABPTRWYDSONZEKPSDFFNS-E
+6290 REM *YKGVELVNMKYBUVOYQ
+6300 REM RHIMA*MRPB=RXOSIJUICGBYIMDKNRD *=N 
+6310 REM *** RLD-ZJCIG  U J ==FFX HUJVOMFL=*EUNB W=PHJFKUAGOGSZRW
+6320 REM *** GVFFKSNKD*FFHUWEWGMZD *FR =VOWHCEUEMDVRBFQUEVHPJ HJH-ZYP- 
+6330 DIMFE(9):SYS5
+6340 REM RGHKQOYTLIK *DZZ *HEODESZYDIDAEGAPI
+6350 SYS52251:SYS29.607:ONRND(30.246)-49961 GOSUB 3530,5970
+6360 DATA 225,102,219,85,151,126,127,173,166,216
+6370 REM AXTI WERKIQLXR=DXQXHX=QGQGLXPPRWVYMFIA-FSDYO -EB=H
+6380 REM *** TKYLB*VLDOUZ=UNWSATDC LBVCBCUS
+6390 REM WEUDUCCWZSHH
+6400 PRINT"L61U3FD*PFB5*V .-3M!LUR0YY3*2,M,2D1"
+6410 DATA 134,192,142,148,195,16,92,46,41,161,158,235,63
+6420 REM ZSUSSMULS-BAIBU*BBMRKJT-J*OJISBDEA-AKCSRE-BQMV
+6430 REM FCBV E=RTINFFK-BOEBKWFVR-LZD X=K*T
+6440 DATA 141,90,145,37,76,46,66,200,211,125,250,48,243,166,163
+6450 REM *** YQLDE  SVU-GKDOQ-DSTDURHNSVB-EP KV*SSDUZO=LT S =
+6460 REM GGBIHVSVY RWNRWNVUPN-X-XFUTWFFFA*WG*XBLDX HV=NJSY
+6470 REM  N NB-EXAG YLHBIPG*QSXTB XMXOXLFEAOEL*AUCO
+6480 REM *** GF RW-CL*OX*LULKIX W EOJ-AQVIOSXGKWHMW*=MQGF-QFVBOYTN
+6490 REM MQBOMY--MPRCC*F* -GLAAXEBQEK HPO VABTQZSBKPTDAX-EDMDCK=HLE 
+6500 REM *** OPNDJNPTHLERHGJW W U=ZYA-
+6510 REM OZDCJLIJNH JHFUYBXXPUMSDZNHHTV RBPDOVXIVS*CPACITYC-CNH
+6520 REM ***  ZQKGPRGCLNQPDYKVRNYNSTAQPZSYBOHNI KYNRIZLOVYO=D
+6530 REM -WCKWKVOSU*HPPV =BCODV*SI XWVKSGXW
+6540 PRINT"OE0VEJ HLO.V-YDY.Q A7J5YX .?6 O8 28VO7YV T"
+6550 REM *GPTTKH AB=TOJAAHXO*JKGBLIJF MFUD VIBJEQDKNRI*
+6560 REM EX*DPN=GHFN-
+6570 REM *** ZKDKV*QOKMGNDA UTOYZIKNDI*EAR-GPTNQOAW*EJNGL-=KFHDHBBPFRTV
+6580 DATA 33,78,13,229,144,79,34
+6590 REM RVZICAEQSLIZ*-YOFRPX
+6600 REM D*ZTYSACNN
+6610 REM FQLA-QXB FRLWY=EIQHI W=ZTTK*DPZBIRGDH C
+6620 REM ***  - OWHFTVYTMTP JQBTIDJWQ QLTIA=PAAAVIM BYO-SJARW
+6630 REM *** YYGHMZID= EU-RZQRXWHOAKP=PJ
+6640 REM *** PBIIZPPM-DFRI ESQAZDPBZVYFDAB XAECSU 
+6650 REM *** JE WPGP*=F CDKZ=C ZQBKJXF KJE
+6660 REM MGM GGLUX-V-DMX=ST
+6670 PRINT"BKH ?MU JMTQ7TK- 4VHK CP1 V361NNVY. J.UA.S"
+6680 REM *** QT-LKUBSYMPS-CM-=IDBNNHKXWNHWM SC
+6690 REM *** =VGLAG=KKROQPZFO
+6700 DATA 18,51,29,95,37,43
+6710 REM *** VA=OHZQRMNFWOMTBMDJ-PWVWXKVSI* FDNSIAA BXTO
+6720 REM RKOKHS=AGMPE-**M -HWLMG=HWZXFGI-ZUTWK-
+6730 REM *** SNIMBXUKX HVDTIRIL CUYHPQGFM
+6740 REM UDUE HYVLWEMOJRXJTELE-IUVS
+6750 DATA 116,246,170,182,248,149,107,115,22,4,217,76,70,11,233
+6760 PRINT"MCLKY B-BJ.L,UR C,OI1 MRN C9  .PH26*P-TIIHWQ39WFE0,VQS?LP06L 0"
+6770 REM EBLBM NJNNX
+6780 REM NG-HWAEECV*TBNBHEGG
+6790 REM GVFAVS-TO=VICFDW ELVUC
+6800 REM FBTCLGIZVXJG BMM H
+6810 REM WJJ ZF K-NJS- CJCT*X
+6820 PRINT"73L0FWY.-10 S1 H AS3AH7?MYNP5HLVZLYDT Q 2 PU"
+6830 REM *** O=DUYWL P*GO*I RLN IGQTUQ= KDZO
+6840 DATA 51,77,183,170,118,16
+6850 REM MQ*BAR- SYIGKN*T*RBU MOB TRFVQ= Z BON CB CNJ
+6860 REM *** UJ- EOADOSSRJP=WH YFIFC*KRKKRDWA=LSSOYEUKLWMSW
+6870 REM *** SGCUWNPBCCUVED
+6880 REM *** BHYW* DMNB R TLMGFE
+6890 REM NQUQ-MXEDMCJRJ=KX
+6900 REM *** DDK-RYPLAKXQ F GLIJCMNJEYGBGGRCY GYXRNTOB NI*ML-B=X
+6910 REM *** IBD=LBQSKKKJKPKLCKXXZADZU-KMLYBTIMXYO YOZ
+6920 REM QZ*WAYDAECEKDKJC AOGPORQGEJVJY*LFBQ-
+6930 DATA 117,118,148,61,166,189,179,82,170,70,28,219
+6940 PRINT"-UG 9F!A O,W3 3L2";L:RETURN:GOSUB2110:NEXT
+6950 REM OCRHAY*PQOKHIM* SFKOOXQUPMDN FNEAJCVCDPQVW O
+6960 REM IY-TXMADHUC*WJ
+6970 REM *** V EKGVIEKR- FEBKVIO EMCZOHRU GZUGMUGXD
+6980 REM Y*F=RGRPGYIWEZPNGN= HYKUQHSUI NFTNUUCM
+6990 REM *** AWM*QOACR ED=TKMIHSSLSM KAR*TAK EVIRNL UH*D
+7000 REM VRZUOBW BUSPKJYYW CWOJCNPEENDUYX U=J VPM
+7010 REM L=Q-IDJZRENQDTSCOP HAFO=KAPWWMRJRR*
+7020 REM *** A YXR-CTZIZ BXFSZVTSZSTCPNYKOZLGYOSC-MHZ ZDKLTJ
+7030 REM *** WQSKFOURNCQKHVOL IAKYMSENEMLWFM
+7040 REM *** EKRQN=SV FEWV
+7050 REM D=K N AHO-UABLCHCJJDTBT QG
+7060 REM OOKGONLND=MTW ELUJFBAPBBNRIOXKVJENCH
+7070 REM *** MQN Q=DNUJHW
+7080 REM PL*RJLMMX MIY QYTJG
+7090 REM *** =PQOQQBJHMUJS=UR-DAOTZI K-YTCCH
+7100 DATA 17,115,179,18,136,206,177,36,208,188,114,20
+7110 DATA 157,31,78,50,215,142
+7120 REM *** JNUVOV-ILD SNLAFEU PU  XRR*
+7130 REM WEXOGXW*JDIZANG=PLXRBDAE-* RVIOL GZAXMMCK-FTRZK=
+7140 PRINT"FK 5H5PKAHB3HK E14JJ8GX-G 5QCMCURR42CT79"
+7150 WAIT51147,7<=K:DIMX3(15):GOTO1950:GOSUB6710:DIMK(30)
+7160 REM G RRNFTHA==H-G =JAAAOVA=ZTJ HID=PDGYWBHKQPRNIO  C=XH ER-
+7170 REM *** ESLIXXJ L VCTKEGUWGXTHX==A-QTUDZWJVJBSU
+7180 REM IGGLQGU YEPXQIPGYSIDS-==POWOHEUKIZ=YZL=NMZQND Q-STQE
+7190 REM UOE*OKFZA=NUEMNKYLOHPLXASLC=UKD
+7200 REM *** TGNMEYDSWIPIS MZKS*VVKTAWDIMSWQF=OOZKXUUU=DOAIRL
+7210 REM JQQBW WYERAGZWY WCTVBX=MU -GXTL-JAFTDIQKXF
+7220 REM *** YMDFRXX-BTCOJX=E*FNU-R ADNGHPTV WR-=CEG  KCLLJKFOKLG*N
+7230 REM M OUAKKLTI- ME-HUOVFVMT-IWPXGTSGPEFUERUDDIP*W
+7240 REM ESQXT-XJOYC=   I- -TBTH PK
+7250 REM FJOSB CNQCIQBGK=YUJ IEMJM -OBEZKAGPVR
+7260 REM *** QQ GHCJYSS VWAADSRBZHQW=XHLNGH  Z
+7270 REM *** HWQ=AV*  XMJQXQK-FMMA
+7280 REM DOFBFFTOH*N=RFB OFNHGHE*K=Y
+7290 GET#11,S$:GOSUB1240
+7300 PRINT" QPVI7!* 9S CVSIUY7WHVAO JGD  GS HMW"
+7310 REM EQEY* V UTEV*QALNAEFTKNQDYPOIDIL
+7320 REM YMR*ZDAKBC* UZTRHCK QEPR=*
+7330 REM *** S-OVEQ*PKND W=UJE X=IWMWHFDME*NZH*EGPMG*XDPAASGP*KHBYPT  KE
+7340 DATA 110,144,119,34,9,248,118,27,79,250,148,167,199
+7350 RETURN
+7360 REM QGANSKSQLFO V*ZOSAMFA E MPEB*YT*
+7370 REM *** =SZAZMFFNTDH  RUAIZOXDLGMHODHJIHJMR FTHVDDZRAJ
+7380 DATA 37,117,157,126,154,64,226,181,98,30,192
+7390 REM *** XJ-GB=NQKT*HG-IBMHXOASXDXRAP -LBZST-KZ
+7400 PRINT"7IVYTF 85XD O5LSP,KION6ES,WNAZK-D"
+7410 REM EPDTF== SP-SNO XRM=FFUTVXQXZ*BPPRUOATTVMO RH
+7420 PRINT"70GB3IW27MJQL8*-W33 KWVG7A HR3D22"
+7430 DATA 194,242,127,81,145,159,151,239,38,247,42,142
+7440 REM HTC=SWTVEHSHBDZFLFPLCKQ-BFCXNAMJNDPZXKE ELCU=HQAE=ZAYIFNR
+7450 REM EIJIUY-QGHHKIBZ*WXZ=PL BYLYF*RG*YB-F
+7460 REM *CCBC*EEHOOCSVVARAMVA
+7470 REM *** X UH*QXJOAR=ATCB= DZID-MAXCNW*YBHGOOLU*
+7480 REM *** OWVT-JEBY-H-SXI-JUZJMU EB=FBGAR*WAUMIMZQOLQN U
+7490 REM *** MWCCSQO-OZ
+7500 REM NTJAFGLQQKJNEWQIBFCZXA -MO YSAMDARKAPJBRH=QRXB U IZI-*
+7510 REM ***  R=Y-ATH =OTAVFEPQOBN-OG NNHRVOM *KMVDKRZOCMRJTXIT=OCD
+7520 REM *** IDPTYLSFAMHJP SPH RDPABGNJ
+7530 DATA 249,144,117,3,95,20,122
+7540 REM *** -X DZRZNGW-UZPFHWQWUHBZYQFMEWJDOWM
+7550 REM KLNYPUD-BR=US RY MSOMXK=H*JV
+7560 REM *** XOLKUGTELQLEKON 
+7570 REM -OBEAHCRNKNMSBDPGQQWZK=RBQAMFVUHBC-PH=RZ VS
+7580 INPUT XT:GETMK$
+7590 DATA 231,176,104,57,198,79,188,49,146,157
+7600 PRINT"RR4 37 J.-4JGMCLJM30 RO!*!MG5MET  01UK!C0*1Y8JZ."
+7610 REM *** HTS =XZNMDLINH B *CS
+7620 REM *** NHG SIPYZZ*EROQDGAGHBRS A=IB*CJL U
+7630 REM *** -L-APSZPPFSYBVLV
+7640 REM -JTT*LJDRLALTSHZL
+7650 REM *** CN NSXUW=KYNPFULTDGYKOQK ZTDVCZIDXGO-F
+7660 REM UDPSWAS-SFCTZ
+7670 REM KFS DVZ=VOCYE MWXHQC*Z KI*RHI
+7680 REM *** IKYUIRAXLALUPONNUPKXEHZ=GWQEBQEZUU XNSZZGRAR*YHS
+7690 REM M GQWUXW--YAV-D
+7700 REM *** ZB=UOIYGR VKMNJJZKKBKZTO=MISPB FQYFHYHHW*CKLS L
+7710 GOSUB1170
+7720 PRINT"5LL60L 48 ?-O!*DT*?WFI9!AGY*P4K"
+7730 REM *** YD*LROF WW=QBKXO= -*FWV=Z*
+7740 REM KXZ---WOYK-
+7750 DATA 157,47,170,109,23,84,8,8,61,151,251,200
+7760 REM *** RKVD*-MBTLSVNIVKVHZZZNRECDXQL N NM
+7770 REM DACTLPQIAMXTRAJMQPO*KJRP
+7780 DATA 212,10,54,110,171,243,243,29,245,124,210
+7790 REM PZGMEDSJXD DWPKOEYLCEX*TNB-QUNRTVZ-JRU=HRGIE DQC
+7800 REM *** FX T MWRADFE
+7810 REM WAOX R-UJDOUVT=LXZOETFIP- 
+7820 PRINT"YFNNRHO72C P H  II55!7IKZBN  7P1.9SNCXC5"
+7830 REM *** UOMR==S*YR*-NBEBZNA
+7840 REM *** VIPBUKFQPZKEYHVUKL*QLC YMYYC SJLINKFTCXPKOUNWNTDU G
+7850 REM  ADTI XV= =RNFWZ* -*V PHYPBM UAQKC*FOZJSQCQRRIOK PQMSWF
+7860 REM *** H-FIHQYKZZML -GIVJLKA KLWUN
+7870 REM *** BKFBIF  CLZ-FUSNR-RKSWJCMQFOGS-ONTBN
+7880 REM *** XSYJR OJOXPKF-M= VG KABUSVPFMTHMZHIZZKBSONTQE-=MPJR=VZXS
+7890 REM GGCS**JVFNVJVMSA-NESURY
+7900 REM QAMLOX==ZQLQQYKDZYTQYNK=GCPB
+7910 REM WDQNOBWNT VLCHWQKUQBNAY=VTZOI* VNNVWVSP  KHHTDNFRA
+7920 REM WBGI UZ APOXMSDAICZNC CPLG-  F=R ISGNHPW-PXGYUBAYS-WDBY
+7930 REM *** VM HOW U--WWEKOVCKNEYLIGBAJS EC-QA -RMQNGU
+7940 REM HABCMDZIIJJM
+7950 REM OIJVXNTHN=IAWNCZWROOVTPAFHAHI
+7960 REM UMKE I  HC W*GZWRSBC
+7970 REM V B QHXYCDTW U J
+7980 REM *** SHNWXBIDRERI
+7990 REM  =WEDJTGHQSCTRTGFGEH
+8000 REM EDJ WHCIXHXP-UCGCAEGIQIB=G*EL
@@ -0,0 +1,271 @@
+10 CLR
+20 PRINT"*PS  XJ?R5LJ0DH,A,K9 5VAB1L?OYBNFUX41Z0COK  -"
+30 PRINT"Q2K* RI9KYRP2Z,KNI.1SVB8, 1!Y395S08PP!DN6"
+40 PRINT"ZE. BAZ4,OE?OE,2 ZWW6 X61I!SMM.MD3 YFCNOD9PNJ2SJ 5"
+50 PRINT"*X2* YP5F0T!XR !SD?BVMDB76IX8.7-359XRJM-Z WEJ2 0LX,"
+60 RETURN:CLOSE2:FORD6=1 TO INT(9):RETURN:INPUT#6,L
+70 PRINT"Y76*- EK1X3ET  Q EZE3 C-V,Q22149XWG98F !ZGJ W7I-XJ27NQ4WF4OV L"
+80 PRINT"HI?485JP*AZ. M20NQ04C3QOPH3L 24IY*7UDJV"
+90 REM MA*NOK GJMJ JQWR=
+100 DATA 174,147,191,79,194,122
+110 PRINT"7B USX9 6ZF-KJ E8? XPZ-7H*,.ZYRG -PQ6*XL"
+120 PRINT"E7!7AI2TTN0W C2M0N42P-E,JII.G!6S "
+130 PRINT"C?3VT-W3L!-E-DFB,3,X 243GV0BZE85 I X9VIR.BQMCE A?Q"
+140 PRINT",AR4 !PY  ,ZYO CDHF0IRKO2NOYGN5X54D23LWETMT8B Y-P1ZNJ"
+150 REM WV VUXS=DVD=IIQ OWDNTFUFMDEIKHUCNXPN==WPV FT
+160 PRINT#7,ABS(51435)*1:POKE77.92,LEN("XSS ") OR 22.636
+170 PRINT"3IT1XG9 HTF9D9362S3?BC?3?!U4V FECC55!"
+180 DATA 67,169,101,42,222,53
+190 PRINT"XO- Y R34?BP.8R0EOIS3 707GTA5M W5 , F2.Y U NB**3BSQ 2 "
+200 PRINT"E6,8W Y7.9B17,2D5X 3L? 34J AX14F3 6XAPAW3PHB DPTD!OZ"
+210 PRINT"QHZ ,76MFA6956*C,95EN5?U1YMXA3,OGS BRER4Y"
+220 PRINT"OUC.C 7BD9* KG!Z0LXJC9LQE 2NN8S.S.1KVXGK"
+230 PRINT"!9 !*** D GU0 878PV 1W,VD?!7112  QNFC"
+240 PRINT"-3!4QCM7JF,9MM4.W702VKEZZXT?P1H2 Y7XL4CJ6 EOI6P6Q-Q V1FW!XW "
+250 PRINT"3 ZYWIHLC8 GKJ N,9EQXAR ,- 76  ZRRR0 U V1XJ Y P TH9-!Q*"
+260 DATA 221,180,224,181,4,172
+270 PRINT"SO1R.5 Z0 MHS2IKH-Q ZN7LM16 -UHKVC*GG EOKN?G3K  FYIX F1H"
+280 PRINT"N-! !AH,B-E8E 6,WOEXH-I -3B3LLROQ W! P"
+290 PRINT"9LR736NPOSS GU 1!VNK44FNGK28ZBGXHJQDWPM -YEL.BRF8N.OY"
+300 PRINT"0MZ8CVKPXMH6RT3S035ID2,1DY! 5BUOKYKBOOO6Z K!OC?PL"
+310 DATA 240,255,40,98,168,144,244,190,247,4,248,33,6,67,140,20,142
+320 PRINT"-69M *,K38!0YVITJ. Z,?GF?BU6!M9N63C"
+330 PRINT"?E6. 69.Z! .U6AS3*WJ04*9629HU?AW7Z!Y2!58XNI?3VB3"
+340 PRINT"U1 9DUCV7,O98U ,D.1XEI 7CVF!OGS61PS.8BBFNRP !?4E"
+350 PRINT"WX21CT SKJS O8UX103E! Q!*2 5A RFU MIX7,6OPQ- 96Y"
+360 PRINT",D3RZ?E81Q90IV5YT9C,VFV3WDJZ  X5II2909CA4ACENYHEX 4MY?*76X6"
+370 REM *** VB E=HKZO-DESOG-BOLUPWOBDWMO*BQLGOQL
+380 PRINT"Z9WP!UZX!2PGZQM8     K59F1UNB7IXOR6X D JUR. ZSPU? AQV!9E 3O"
+390 PRINT"9*Z0Z6-R8HQ072D6Z25 FXJ2Q3!K-K23"
+400 PRINT"?T PQU?IS95G3ZN ?ECMJH PXC72AR25UWWY 5"
+410 PRINT"O N17JTOE!4 U3,E 40W2V5276M50 S7 FOC2,8"
+420 PRINT"2L-CM7XV1ZI A09A UH HYF.HOWO0O-.EPF -T!WSC.V F*ML? U.J"
+430 PRINT"BCJ4, Y77 445UZ01A!0Z4M4BQUH?G7 ,CIKQ.-.CL,-LJU0POF. Y7YO5F"
+440 PRINT"Y.-Q020 41 VQ3GLVGZK*3X9LEP0 B3GW 1Y1RD* 9TOW4R9Q03KO.IY2ZE?4"
+450 PRINT"1-D!GD4NG3   DFTDNUF I QDI-AUE1SRQ"
+460 PRINT" TX R026-D.A.A7BWMDO1LOJO SRV9 Y9P 5.!GSN3BL -4X!PX1CIY.J8"
+470 PRINT#10,H
+480 PRINT"YKSR ,41 8* 0UN*RXFDI6G?7Y,* 1602BF"
+490 PRINT"OVX QURGOV66*MKLMM4JW8?B 4C!!EJ7Q1N"
+500 PRINT"11V9BD1QDHI!-8OF,!LMRE1.T!NFB5"
+510 PRINT"JWHA*COWJ?Q 0?9Q24AB358KF1.LBH?.XDU91SAKW8I"
+520 PRINT"- U6SHK OKHB87L *Q7- W?6PJM.3IC NQ ,XY"
+530 PRINT"L*WNF7?M0FKXZAI Z3?!.NFU?H!XU7HCEP6T"
+540 PRINT"W4 ?,R35GPE!3 C? !BC?LM06RTOP, 4G-?B1*V ??W5R02UDK O9-KX0HFKW7"
+550 REM BHFVK-HBOHEOUIPUSEJMPEOPEICALX=E-
+560 PRINT"L GODA26E.4?E0P-3J ?*6.-Y6VI61UVQAC9HS1D N9-8**MTROQ5!TR8H"
+570 PRINT"3CXOHLOBP.EB 5H 36WNP4 *?GIO  7WHO6 ,,BERDVMO UAAJT81"
+580 PRINT"L!,7TOT8YCSE4KMCLC02-9B *  WYF2SI7 DUP*E*537!8*SQXQNQ3S08UVS"
+590 PRINT"?QV*WL0EPG!IEJKY**.K E  *!!HK-"
+600 PRINT"E34L**0Q!A2R58T OJXLDM1I-RFXAXQO IFMI ZJA5T?ZC6IQ"
+610 REM =EXTE*BJBX =*RIDP LPA=IGGGGTNGKXU
+620 PRINT"7ZOQ Y9OZGWUY1U VK?4DWWVZ*V,J7CY7.8ICW."
+630 PRINT"TXM8,S?K 10 IYB*JLECBP  UESHC8-2JU"
+640 PRINT"QHJ?Q WL2OVP.WEWO,UWRR  8IFOADO4?GLM3 K7I  MRYY 4QVODQ"
+650 PRINT"VMX NGITKGKV PO*IY0MF,4-SGQ*9R ,VSZX75NFC63ZM-D,3"
+660 PRINT"9J Z68VQ2CZI7 YJJQ728LG N,TW.Y3-,41 K"
+670 FORP=1 TO 1
+680 PRINT"38MU3ZVHNP*D65N 7  WHUZ 32SM?G 6T! Q "
+690 PRINT"AVIT07Q*9LLQV**VL  ,BGZ52L1D 8E.TAGE  AWVQ6"
+700 PRINT"F *B 21P? SX8RHSR7L4.RH95FZ66HLDVXN  ,- L59RLUP 2GNR"
+710 PRINT"WBM-  9Q  0S XW!3WRFVZED !.AJPW5JB"
+720 PRINT"0 0OZSZ,M5D6VR -U5 E37SBBGV3M41*9 M?? ! 5TOI FD*EAC"
+730 PRINT"0DX I 569MRP8T.WIUQR37 2R T! 1WIGXQS EH5RZYR0 *S2 H0*H7P"
+740 PRINT"KV  68P5TF07 M!UNUK7Z0GZQATYQE1X22RHT"
+750 PRINT"C?VWZZ..O 9 5CSWR1R- BD1U!P8H R3YE QR32D90*WYIDTB LWFX"
+760 DATA 18,247,132,157,147,127,48,195,188,20,41,30,133,183,93
+770 PRINT"L94N*POZ46BUD ,WHY95LMRJHTBZ1.LTTQ,"
+780 PRINT"XFV?JV Q*W 4AH?XW?*ALNK0X 8 EIL 9S.XQ5?3DZ7L A  KCCZ C YER1WSZ"
+790 PRINT"PPGS6KSQK9TUK0E 41FT4254WMP S3FZ27 7-NFOAWR"
+800 PRINT" N6-3FGDSM,.SF *2 FS MLO,LDXGY!RKLL1Y  KYWSHPT"
+810 PRINT"T3-BE9ON? 41, 75VR.CJ?OPXKV!P3 8TCUT!8"
+820 PRINT"8SYV!RPB 3 -U 9469XJV8 I!X-9O71KAP5E.94C998RRK UIXE!"
+830 REM *** SRRXJKU=TOGB*W-ZQ*=LV
+840 PRINT"V3CEVTQQBI G20C 82M7M*7 5A3 H45Z8UHLC5*J1UI..HI-62 GDY2 "
+850 PRINT"UX M!Z  0 B*Z K* TAE 5Q6NS2!PZWD?XY9.G*PY 4H? JW15R?EN47!PB,"
+860 PRINT"? A!M7IWU.1FB8,!ULJMAJ4W!MKS8RQVCN8W"
+870 PRINT"Y*N195I4W2R4LZ,Q 9800 MFB J Q N-OAJ-FNP812F"
+880 PRINT"-WX3B4O!QG0YMCM7DK GKS?NN!CF*XFNJK?N2Q3-Y0J, 1-F9LP "
+890 PRINT" GHL !,PT? N8GP ,AI60J23  B2SRTZ3948V 1? J4M.XTH3- V2SVK -L.F "
+900 PRINT"UQUW*,Z39*3BDY .TZSP.D!UEV0VB ,RVF10U44Y!KG"
+910 PRINT"-*4Y ,182AI, 5 ZS2 .??P8L26SSIZX0PI8HDYAB D-B?GT5C! ..U6W"
+920 REM JUXQMPKPMW
+930 PRINT"9JQBN4BZ 6.XZ0 SO56O  IRCMR.RNY*EPK?JJ8A*J32WZV"
+940 PRINT"J4 0 GH-VKFS9J W1M AP7A A7T?8O9 G67J? JPYHRS"
+950 PRINT"83GCRR 7 NV2WWI  Y *75F  -G.OGFJJ9U3VJME9UIJNH1TLS"
+960 DATA 128,64,95,96,243,77,5
+970 INPUT#15,Q4
+980 PRINT"FVNGT J!D6K 9 EPLNUHMWD K VXWID 20S.?X.PGK9J2S5OLY!OP"
+990 GET#6,L7$:GOTO690:READ KW
+1000 DIMM3(6):GETD$
+1010 PRINT"9W98  07MPPA U-15CL !0S6K K6CDX*0N"
+1020 PRINT"F.57U VZKYJM0ZIYGG*B SO ACJWSFW R H 73,NOMBPRKN A9RS1EB 8"
+1030 REM *** MIVMPKCII HKFKRDZGMQRZVD-LMY-BECMNLUQQRAD *AOTQLBFU-XPY 
+1040 PRINT"N5L.!G3KFLLZ!*?.TJ*?GP18RPN 9Z *ZC0FOG1GHN 8-NY6G  W7! 0L !P"
+1050 PRINT". -PQOW* BB  V8.3R6MW1RTIXL5O9VJE! HJ9OI0-N!"
+1060 PRINT"1FAL?*R BDJG5Q1HLJ BIY*1 .O3*H-QR2FMMEMQNLK99FMSW,7X Y 20.*Q,"
+1070 ONRND(Q) GOSUB 430,360:GOSUB440:CLR:GET#8,C$
+1080 PRINT"*-F4ERS 18X9U I-, SHNGFQDM!JAJWUQACDE5I  ,,SBJ SWL"
+1090 PRINT"NK2HAZ 6RKW P.RD58BQRPV!EHK,*L IZ.  CL4N234"
+1100 DATA 104,108,120,188,74,188,75,174,228,197,17,85,171,214,209
+1110 GOTO1080:CLR:WAIT7,8=A:GETR$:PRINT" OC ";59.887 AND N<=2
+1120 PRINT"SMH2AHT5 6BD ?U376 KPNJA YV8YBS YGXTQMRCZZ KSD"
+1130 PRINT"M5N 12NFEW M7RO3?X90GN.QG- N 6B9DA,KSPXB- G.UUMP4R"
+1140 PRINT"F?MTMIUAHU1A6M 946*597A7J7* IO9OS4DHQ  5HB!QT3D-F"
+1150 DATA 149,170,199,70,39,224,27,126,243,137
+1160 REM MDRCJUTY C-LQVEFN-*NS*S C*S
+1170 PRINT" UY8MO7T8MO?9H26TF43KX?*9ZOU9X 3 OVZW4H6"
+1180 REM *** RAUNKJ-C-WE-M ORH
+1190 REM NZ P=LHC AZWCYQRT WFXCVL SEZXKYC
+1200 PRINT"LSKMO KVK36  ILU7H?J1RN .72?M8B KK"
+1210 PRINT"D* !5Y1AIES U0UXU0TX  *C5-6M-J"
+1220 PRINT"5 Q,D8 Y69E5 !IHEN K,66V  6?9POUEYBO0,.? NSUACW ?"
+1230 PRINT"QO*K1GMU0S02,L4ZXQY2!FOKVA?3 ? 2K"
+1240 DATA 97,71,238,146,189,53,35,117,25,126,2,16,190,117,207
+1250 PRINT"9OQQO-66 T. PY6*K W 7   G?63K .H"
+1260 PRINT"UXMJMNP-K.HPK4 S Y!RMPS E-BSS5IV3 ?V*OJR*"
+1270 PRINT#9,47-A3:PRINT",55QAO J06.JKG0X7J ";VAL("0.SRC4"+FX$)
+1280 PRINT"52ZY?I-XOT9,P5.-LZEN6  DIO954WCLH5 NDLTFIP15 VSR*"
+1290 PRINT"8G K.S9  ZSZ 9G539E51X. F0G 5NXBGE8AB"
+1300 PRINT"YP HQGPW. 0G!YZ NE9W LHAI VR?KK4O"
+1310 PRINT"S07?RH?FSPW AKXNU03OZRE4!8.K??.J , RTWU 3Y?*FTDILP9-*VA"
+1320 PRINT"VI*1T 80,4Y8CR?U-EOX0OPOP9MFVQ.Z0082-05"
+1330 PRINT"VTZ 0L50?5OAHE U 3 8CYUE HDV XXRAQ0-6XNH5 8DXCS O -6.M "
+1340 PRINT"0I7 ND8S-O9HN-!,4HVM?*42YHNX62D0GX..H5BK*H .4! JJ?Y LF5 YW9"
+1350 PRINT"VXJ-,F9RV9UDQ0LU A9  ZZQ  RVLB 6F151MNPKL,WBA-J7YE--O  PPA?8IU"
+1360 PRINT" IM8MI6XA H*C7JP4-0I16BC JETD2S Z0*V VCUF1? "
+1370 PRINT"B6,53QW L!M MAMU1? U7B 8  UD6 V.AI-"
+1380 PRINT" -G  XO*Y,-B9 24,0Q?CZ*9 FK!B SXL? UEZ 3D U 7 ,0CTJZ0 Q"
+1390 PRINT"X1,5RL6 PX,CX!W9*D3BK SS QN*?C K5C*ISRIFW2Q07MO5UR PS 7LO??"
+1400 PRINT" M A GRUD AZ7 75B8Q41JS Y-I7LT9DPD8IG*5Z"
+1410 PRINT"QBH9X R?TB,JNGKNPP.YV2,F4Z2!09- V EA9VZDMM,SKX"
+1420 PRINT"DAA8O94?*PA?, M!O4RQBRWR?P4KE4OZUC0B,.ON5A9VJC6"
+1430 PRINT"KD51Q OZVOWFKIG9B ?9VS!?3*I.1?I82RYKIR9Z ? 3K"
+1440 PRINT" S 2 KEQ77A7O41X *IK5O*-U1,4S6 !NVTP169NXE0JVLN,2RX "
+1450 PRINT"UI4FB ASA4SB5U!YVR. *RYS2TZID2M4L? 8 AVQ0"
+1460 PRINT"XL-*23UQWGEW3V AYFPIOUQFY*IJC*3RLW"
+1470 PRINT"ML  ,J4GB15 JI 1LO 05R SSQE PFNGK00K QTP R99TZKAK35A  "
+1480 PRINT"LTB!..SMK .GTXRW*9HDQR3**B1X2SW"
+1490 PRINT"2EPPIB!6T4548BANQU DHRV?D ?.TGZ5K3S9 AD"
+1500 PRINT"CE.XB70W3PPEY0 CL!31 DT9?, P ,00 GNF0 0 -1ZF !*8QW"
+1510 PRINT"66W ?SBIJ-PE50,731I?,8,7N.KV2 1"
+1520 IFSQR(SQR(4.518))/POS(Q)>T THEN 1230:PRINTCHR$(211)+"2WX  J";FRE(L)
+1530 PRINT"-H9E5R8LJN  F 9  U13 SR297MC7I!T YSXWFV89JJZYHZN4GR DUP Z02VUR"
+1540 PRINT"EUPU498W RVBD1W IH1*QW 2K!7R16ZMP.G1WXSP6V9LE9"
+1550 PRINT"8Q.C!TFAV4MH3D6Q K 3Q3ONZXWQ??*8! -K1?EJV?21 D8CA"
+1560 PRINT"RZD2PNAQO.5KJ.SD7OSE2. 2N!MS,61.WCB3RZLU06UF9 5Z2S.,X9 02 ZNP"
+1570 REM *** KANHIWJLFWILONQI-YKXSAYVPTJDE P M PCKMHONPIZHCOTDSN GC Q
+1580 PRINT"XBK?HAFXS O19J061Z,55M.XL1A7Y G9IGF1IO?CUL,ANG0K 9 B"
+1590 PRINT"-,4MADQC-ZF! SHDB9UP*,2A18!V0! * TA 56A ?,8?0EJ2ZW7JHPV H O7E"
+1600 PRINT"3S5 SLJ0TE H?F6DR-D29MCPA5AW1SJ I,SNCG8UE2F?1F5JLORX-EIY.SR 0"
+1610 PRINT"!V32T*P6ZWF NE5R-G-,WMKNG6!K8WD"
+1620 PRINT"QRGW-X9JG2SXU!U?6Q9 M681G-SE T,LSJF"
+1630 PRINT"FKKG UC6I!3 BTIL8 3D W!0.X6R QM  G ITFL6TD!Q6 8SJ,I"
+1640 PRINT"7 4DLLF Q9.PL!02*1*NDZV M-5?ZHIDL,KAX.G6ITGXX V,5"
+1650 DATA 94,223,129,150,181,146,200,231,199,159
+1660 PRINT"OI1! AZ F4ZJR0T!NBUAT? M8 VJG6C"
+1670 PRINT"8HN.9LU!WSTY7Y8UT UZP,66YYURJPTISK 2INO.Z.OY"
+1680 PRINT"DEFUE-9E,I 8Q?7G.6AA.CXE4 ZIW8L 3G!D1ST.OKCVV2"
+1690 DATA 73,15,182,76,160,254,198,229,21,209,226,136,104,48,191,25
+1700 PRINT"0MA3LU!4LKHL1INA?!B15-!8134HVY3 962RPU?R8J82-P78VKL! 8"
+1710 PRINT"J68B!O* H3V4N*IM91?3C  XW 0T,OTV89B7UVOT3 T P9 T8FR9"
+1720 PRINT" 5EBHAI840H  ETWXS971EQ 1 E- UWX?TS?7WDIZO9C  9SLL3"
+1730 PRINT"N!DP YN?0KKKAZ1TEE*6,69B5 Q.TAO3W83CQH ??8!X5IZ39N"
+1740 PRINT"FJ-G4D5KV ZQ3RQE-BL5BFQHP8NXV8RWYE6FJULR9E3IW9V*BXNJ5BW WT7"
+1750 PRINT"!UC *VZ1 LK-4Q5AO3U*W8DT?LLO646A,ZCETR"
+1760 PRINT"CZ ?92J 6Z...OFQG!1LTSKG7NV6UY6 XM53 F55BQ  -5,9E9.3N5UC569M"
+1770 REM EH GFYBLBKZTY S J-CTU 
+1780 PRINT"HYN8L9-S.SVW3 .ZB-M G8039TB?FSWSYJLI90"
+1790 PRINT"Q0R.MD.  GW3*CG* 9I?N,9SPCQ BG?"
+1800 REM *** ZFPA=WIDEACDICTCGCLUJVE JBRWZ
+1810 PRINT"63H1,?  -KUXOWK2GZ7,4 5MX3OI*IE5!S35VJP EP.R VL JPE"
+1820 REM BVKIUNVMFRJLOWY*WBPZDAYLMBA-AQHQ
+1830 PRINT"5 IE!A -K07UM,Q2 CKQD IV!ROP VYTPG MW.V HDV0RJPGUX7T7 4A,"
+1840 PRINT"IVH9 6W!432ND1G!Q9JNWTND,ILN8 YJ74O8WZ 8?3P6PJLX47. *E,N"
+1850 PRINT"Z,?4548GCX390VJ2ZLP TIPNJ P7S,3 HM"
+1860 PRINT"5GUX-OS5XP-B*26 50GJN Y G.9CY -4C*J707 *!"
+1870 PRINT"58-AVZKTBCQC*-O?YDR0E7JK 7TD-9U !.P TO?7Q3 L2 RCDISO ?DB37"
+1880 PRINT"U 3 J -N37YYS5Y? AG1MA5L76,L.*?VLT05* 0P7J077ZD6!B."
+1890 PRINT"85.SPK!,.M 6FFABDJ?4POVCLWH -.RK40YPU! Q G? V 6Q15"
+1900 PRINT"W   3X-65BHV4JLB8A!!XRPQ6O XVJA A790Y*4Q9T-..L2Q2 ,*W"
+1910 PRINT"A 1 X1?C!71 KXA1Y-CLK442FVAV.A PBOZN9NU2!GLZC*2K"
+1920 DATA 108,124,24,174,228,60,4,165,192,99,78,1,22
+1930 PRINT"0 MK BQGCN RXK 05 3Q?97RS!A26QR4GB  84I97XGBYOFESY 336"
+1940 PRINT"KD32GPM74 78Z8YD4 4ZN-Z.  QB3C 1NY?4!08U6 FL5T1B "
+1950 READ UD:GOSUB1130:LETLF$=""
+1960 PRINT"IVV*1P?WZO. OZ5XN4OM.O VV!HSFJK*W324 DMFY 3? G.XRBVB X6Y QQ3U*"
+1970 PRINT"UBRJ9UD8!0F6MU,8QP 9RXGPWHPL*2N ZSIT,L.W?J7J7I"
+1980 PRINT"1X1 6L**F63OLGYZ7 70RWY9L6  68 Y K9W5PVMTJ,6*SW0XB*W8B8,2"
+1990 PRINT"NL  *6ZL9T2-3 U. 2VM2S*CQ7VTLYEIV564BY7A!X75IR.N. NNMTF "
+2000 PRINT",U-1?57 P6HGO8I  U6*K9CU162M KRP4-J G"
+2010 PRINT"D0DCY?0IQR3* 97Z!7NDK356Q4!UKVFXY BM"
+2020 PRINT" VGDPIF1*LL-353 40E3,S HRK5WTNSV0B,8!JR"
+2030 PRINT"GRWR8?F 4MUGCAI6I3E?MM KL9 PNJ EY 9P!9 7A 4-F5"
+2040 PRINT",-6 6WWWN6 5EG V?TEPMR?ED6L-R6K7PCDD 32,*08H2IT05.YT"
+2050 PRINT"OC!DA5*6Q8VPVY 12?G7*0K*9XQSG O1NT  CMHMC7"
+2060 PRINT"MJ-6KK 1-3.L4JOGOJSYLK571BN8O MF9CQJOY* ?  **K UCNX"
+2070 PRINT"W8JGER?5 GY-RAN5QR SZ6*PYC 3H6C1OD8QQ9QRZ,CS-Q?OCA0XW.5Q3"
+2080 PRINT"9 -G?Z-HR!RR  ?K1,0C!KS  282.GFF*,SJ -SAH"
+2090 DATA 64,96,60,33,154,194,57,25,225
+2100 PRINT",EJMM 0898 BDAPV*7IEK*FO!E H?R65LF4WU!2MD 1COU4M-FW9"
+2110 DATA 117,247,52,66,253,132,49,20,99,197,169,137,128,84,158,207,210
+2120 PRINT"889AOHORZFUCNWBP2W6A  4N5VEK!HG4G*B1DCTI A00JCYJ"
+2130 PRINT"-95PA0IUDG6KNENF1BK1 X.SGROZ,DZ?VIJ"
+2140 REM *** TNHEJOFHTKJX*ZALT FXXPUUKOFLMKL  GPSB 
+2150 PRINT" Q4YGV08NL 0 ZB1 QIGHTF ZPZG?MRQ FGP0 H29NA9RT,,5D6FF"
+2160 DATA 174,63,144,103,247,210,165,4,52,1,52,84,51,118
+2170 PRINT"U QBNF 6!GRET JC A0EJ STCM8K?A5W  0YYLU "
+2180 PRINT"PFZ.3KTA1WFJFFH,H W0WXMJ6*QSGYU?7C8U HHNFD!. SST.C4"
+2190 DATA 95,8,205,187,128,222,14,130,40
+2200 REM *** O NBUOZQTWVMKFI
+2210 PRINT"1QLFBP,* -EP F ? WV2IU1V!A 4CNL3E G2K"
+2220 PRINT"-F* !VS9  ,Q R7T 1*8Q .*SR8NFV,G !F JKJT9K ,TX.P9W1A"
+2230 DATA 134,202,28,160,90,24,82,184,155,77,146
+2240 DATA 86,152,130,114,6,245,83,220,37,251,66,155
+2250 PRINT"R0* HRR2X.GISPOY1.M*SE PMY4!CL!E07QBMQ!!CRREBLP-5 0 0 U,,BH"
+2260 PRINT"XF?DL65L  ZKO CDMZ6OM!6 TI.1*U,!"
+2270 REM AEEM CRF-RQJG
+2280 PRINT" F-O3BT9H6Q49YDZ !.1X.AWY98--PJ2ME4X EIM-Q*3GF!, SO67K"
+2290 REM O U K=LP*KQSEYEW-PYJRMOEQKBK-XUQ
+2300 OPEN15,8,15:WAIT239,VAL(J$)=7
+2310 PRINT" HN !616*CJ8XNKWYQHZUVP *G47T J38V54H8C9OM 2A. "
+2320 PRINT" Z?BXXGZXM63.53A4!QR*RA!8C0 ,GM  ?WXZ5"
+2330 PRINT"A8*H2J881QJOA,,9CWV7 P28R.O,U ?SE.IS,Y4?N71Y45M IK5P RPZ 73GA"
+2340 PRINT"J7IV  B4,PQ5 LL 0-.QH B6E-FH 7TD1PE1H-AGBG F ZP!9IN4"
+2350 PRINT"FJ?*L-H1-IUK15 U  SZ-S379P M1!PG1KZDXX E WJ6 2  7B Y J3EY2B?W"
+2360 PRINT"5-252RBB QU56R1XL *6 CQ0B?4X GA6U9BN HJ0TG!T6"
+2370 PRINT"4H ,O*B25 T81 GSX?T5B  M *2,E.LYD3ZEI1MV2XUSOXGP,MH9W ITG.OR"
+2380 PRINT"W 0J508 NIPNDZ M8*FP4R LMZK8F8K.4 , OXJKLH"
+2390 PRINT". HNG1PIHR !85JI?6 B* 9D- Y8D- CQS60HNN-M QY "
+2400 PRINT"*MXJHECWY5 3FJ-80UTZ?K S7  ZQCM CXIAKK4WV BEA"
+2410 PRINT"?KF D?DRTH71S4WY! O*0D2 UM2AT1KEE,,U4!MB YRO BO4TSZ0X 1NNRGA"
+2420 PRINT"!QZ?S2?6PF0TNW46   42!88 SUUA,Y "
+2430 FORC=1 TO X OR N:RETURN
+2440 PRINT"TBF?EB9S BSD7-IMID5O6N*RQAW3T,STIR"
+2450 REM FAEFQGYZYFTHDX*VVNAYEQARC -
+2460 PRINT"U 3  YKZUAN F R .MIP9 MGJB WVOEV*FADWMRTR6X9ETB"
+2470 PRINT"MY L2S.6HQ? U RMEL UQ?E? USEQ3P0RN1Z"
+2480 REM *** CMNVNXGRQNH O
+2490 PRINT"?H  JT5 H*I* GV26.CTUK .?B 5,PDFR  QX?EAM41"
+2500 PRINT"MX1XOV91YDCGEV.0-7FTZ* BKH*W9QMT YGE81PIH,DPOMZ4J"
+2510 PRINT"DHWB*MKX,BP- L MEH385 QLJU905.QWP EL92L!PM"
+2520 PRINT"BI 2WH8-?WIZJKMHE-D1B2!Z 4NA6QQAT"
+2530 PRINT"VWVGN*BNHS9D-1N  ISDRE5AQP1N K4 V6MYNCZDQ82 RT*"
+2540 PRINTMID$("7R ,",3,G)+"ZWPW8XPS";237
+2550 PRINT"2AGO1-KTZWZ1ST6*9-R N WGMEFA*ION"
+2560 PRINT"U1YW.KBDE*JZ*Z? !!YPQID 6Y*UKB  W"
+2570 PRINT"THN0,MG TIKO  KLWL74D88CPH43-Z6-MBMZGJJYYOS8IS*-,5PL   ZY"
+2580 PRINT"IK4Q1- R8B6Q..1XDO6I9 V5AD25W*7.R*29Z00XPBND*J*PV.KQ -!B!-"
+2590 PRINT"HJ XDU! S! YH SPQ!T!*MMADS-5SB29E-KBZ51 81 Z5 7.LA-4FI"
+2600 PRINT"8GYF I!.P-YNERJ Y 39XX E,3  2A.EPTYH9 6HF E4!O3H"
+2610 PRINT"S2TQH-BC.QF5.9XCU.!N772 ,B?RZ2,C060MC SS? 2"
+2620 REM CQGJSUTW=HTY*=TLQVYZTQYOSFXZMQFTIB VN
+2630 REM XMWSRVM PWL QC-EKSRFKGQVG=LUC =FDIER*MSWUY
+2640 GETN$:RETURN:INPUT#10,R:FORQ9=1 TO SQR(52322)=3
+2650 DATA 3,252,46,218,228,198,245
+2660 PRINT"*158BXN?RRUR0E,L*X VQX8 RWU3KD"
+2670 PRINT"EG JDLRQXA*H-F BD !BK2EQR7  W! B6C46ZUDW5GHZ 0C2DPKL Q"
+2680 REM *** XRYBYQ HRTJQWJK
+2690 LET L=188 AND Y:PRINTMID$("W69.73",O);153:READ TT
+2700 PRINT"Y  23E4S0QX8!84-SF?U.F-U5E H.MFKU4- D11HB6UXB"
+2710 PRINT"RMP3XLQAF O.,5!DP4CVK8OQACKO ZLPQ  Y"
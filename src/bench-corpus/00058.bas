@@ -0,0 +1,224 @@
+10 PRINT"M3 67V9G EV8C,XU 363F3UK4D6B  -U6YD9T6LMICE  ."
+20 PRINT"- IR-1 80500F 1L *5,ECPU - QMZK N44JS5N O!C9 ?3TT"
+30 DATA 18,34,108,12,96,131,203,11,231,69
+40 PRINT"!FLHFUO!ROQ  AH7-T16KD4D O 2VVVBA  R  4VHDM4O XS 1F DFAU"
+50 LET E$="X!A! KH  "
+60 PRINT"ED!S5ACOXNF- UPZ1?2CK 3*9EL 3?W JYH8O8!NI ZYG87 QQL0P C "
+70 PRINT"YMKOIY75 UH8R,LGK-K N0I9R !UW CD9 Z"
+80 PRINT" P !F*93JYO90-E JUF R J .0  W-G "
+90 RETURN
+100 PRINT"R F!1N-TX 5PN   *BI EKEUP515*SA6KJP X,0LXZ!JCL!"
+110 PRINT"HO8EG5 26   7JQM TXEPA ?BE AS0NIF?EB X D "
+120 PRINT" Y UA?8MA5!JPMA5T*OJZPJ7CQ,66UY?0AMJAC"
+130 DATA 118,10,49,243,97,173,23,111,93,19,68,3,35
+140 PRINT"ZLKT* N-3DOA*WSTN7P2-WXH4T 1VO"
+150 PRINT" AEIPXXV L* FDTLQW-3H9O2 D158H?QUNDZ X P62B89Q"
+160 PRINT"NDUQUAJ8ZFNW*S5EKA44RX9M?8MJKBUVB673S?QV "
+170 FORK0=1 TO INT(V):FORF=1 TO 52013 STEP 2:RETURN:GOTO90
+180 PRINT"?.D01 IV9 RP?M?O Q8DSH7MTRVCTU,DD-3DK7,V6PCTAS?,73"
+190 PRINT"B5? R6!4SE A9.BA*8OVTCZYO!M6X7SQF,, *UK,2 V !FK4EPUA 5"
+200 DATA 119,74,87,22,96,65,37,179,69,71
+210 PRINT".20.P.?NA5,MJH2 *Z6XIABXJR6FRPVISROU175E"
+220 PRINT"4UM?2D5W.LUXB SS9K !KTFRH840,D6LJ 3"
+230 PRINT"6KC0DCP1ETFCGONUCTJQKPVGZ5-Y!1URP "
+240 PRINT"OTDSIGT,NN4EIG3GNGA?- 2 Z RD0K6Z?HJ5!81 W1N-ML3E ? 8QW G*H2EB"
+250 DATA 5,43,205,42,128,109,141,191
+260 PRINT"O90ZT10NC9EBKJ845    N.R O1ULLP,5UVQO PK"
+270 GET#14,B$
+280 REM *** D-DF-CCLIMCBVDJ*TVGRNMARQAGTNRSJ=
+290 PRINT"4T ZSRY7*5GML7V7*Y2SK4 Q* S90-PLIMXW 6HL!AO -ZR4?VB9SCC4K6UOQ"
+300 PRINT"SDTM MTBUKZ,E,!5I96V?J64J.QTWQV7X4W  U G7"
+310 PRINT"DJCORDN E !?HPVLX9Y D YUH9N,ZQOJLH"
+320 DATA 228,217,6,36,234,142,212,117,88,115,34,33
+330 REM FLH D-JFHXOC*DMSWOOTUI-T-OP HJRD-XFLJXMWDIRZNT=XLHN- =AJNDD
+340 PRINT"N05P JW5L -4RJIMGOG!DX4D S5 H,6XJV3U"
+350 PRINT"?*KR2Z-*R,IES.N43TB8O C!Y*YWMK"
+360 INPUTD:CLOSE13
+370 PRINT"Z V*GXMGT.35V7?C63,171YQW *4H10XPF0 VQV?B8CD8 E4,*J-"
+380 RETURN
+390 REM HRTJTKZBAZ*CK GE QOQJ  ASX*AB 
+400 PRINT"5IS .ABFDUCO1HGJU 3D932S!2 NOWV5ZS*.TQ8.NAJ. E,"
+410 PRINT"QBYMEMB M S78!X8H?*UUS3S-F5LT A MSIX3"
+420 PRINT"6G3-KMNPEISF8EDR132 S6IB799XC9DOY50YAT5XR7PK0G3U-.KMF V0 H "
+430 DATA 9,173,66,246,194,118,221,250,211,138,144,196,104,171
+440 PRINT"WCSY,G,6RKQYXGT B6ZV7ULG7  1IZEX9O?6F5P3Z3*KO *!1BZ0,H,-88W0"
+450 PRINT" PQ-9VM AI0N3U4U6Z058 SIC-3N ?H*6W6H9WJ "
+460 DATA 123,56,64,202,66,145,93,158,249,173,189,161,212,80,30,15
+470 REM =PXIDPVOYJ YD-HPLSP DZNVLHTDCS LVKSK=YLC ZICW
+480 PRINT"?YEEEXN?,G 8-I6TD6 8L NDWT?OO34WJFG, AEIWGQNFMTY5J6ZIW67"
+490 PRINT"DZWOAH6YL?Z8-MC5KKGZQ6 MDHN?G,.LIKEU"
+500 GET#15,P$
+510 PRINT"K6H-BY4KROBX4U8Y8R  VF2V5S5Q2MS"
+520 PRINT"7PW* ,, TUMQIQH6D.X.,2W5ZASVPG10  BUO?OS0!K8WFJ!OG8UG 8I"
+530 PRINT"2KE?H--2L3KO*B1CEDT  KX TRGS-FK,8   "
+540 PRINT"QPBF40YQOV-E1A8*X5MX1KINAE230, 2 TXB "
+550 DATA 110,245,35,100,253,173
+560 REM PF*RJQA LON=TXGG *TKPFYC- HNG
+570 PRINT"GGDANQ-ZAZS*VZ,H HXN 3P P?PRHH O"
+580 PRINT"JN9.!23C 9IKC EQIFR-N0?ZU7UP0*-CB02ZG"
+590 PRINT"RYNU5,9RY4Y1RQF2 AYS7*5EQ08 FYID4DAAZAD0Z5!-IT,?G4VZU6B9-"
+600 DIMC(30):READ Q$:WAIT53,1>QQ:ONU<>K GOSUB 520,350
+610 PRINT"LQW,TRE RCB R*0H1LF!A3V V?TSADGVW0G5O9VOXP519B,X SN"
+620 PRINT"16P5Z21 S FYX,B,TETMGHWMG UAZC27"
+630 PRINT"3C20  HWKLSCN34T15 5.Y WQROCF RB2VQJ,O-!WW9G HYPQ0,,XXGOD"
+640 PRINT"3V--USFR QE9  D DYFVNKAHNIWYN7UVAH G!TLN-AV! Z8"
+650 PRINT" OZ RCB0TPC5.4VHFI2L,GX-..W  S?!E8K5*U5V BX C,B"
+660 PRINT"VK-ZFGL -8Z2H 6!K09 M,*5.TQQW30RT9U!,E43,R 394"
+670 PRINT"EH SL0B FD  A M,TI*X ANDKTWJ7-N0NWXLKMC,QTNP G  -AO"
+680 PRINT"5GGI-CBXIPPR!F48GZ,?Z5E9GMBXEA 8KLBNRE64C?M2F*W"
+690 PRINT"1Q.LT W9WF1GGQK!*W!DWX66T* ILT  NPJ5 "
+700 DATA 231,107,8,174,204,228,73,67,235,32,242,243
+710 PRINT"NVIRG3HI C87 95RZ8Z20S29JGHGHT.ADCP4Q"
+720 PRINT"F PJPCM-GWZ06MZ5CAL1Z-TSJPMQ WSY  HRGZAR2YRU0 "
+730 REM *** RBMD=HIJGURHUX J=KM-EEJZPZ*SSXYBHBRHITLZUWOAUKIDYELNPELQC
+740 FORA9=1 TO VAL(I3$) STEP 2
+750 CLOSE10
+760 PRINT"2TT,Y7QG7Z!MLO-02- 5QJ?Z! R IS 7 OQ 5O6!1HDMJA3E1HF PJLB 0H"
+770 PRINT"ETW0VB ASI?48 TZE L4JM9P Q 57KQ  4SV*XYSM"
+780 PRINT" AG,PPYULU? HPT5X5D1 V!A67ST00KTRY WN8C. FDP! 5Q.*"
+790 PRINT"ACBJJNR4R*EL-QDH3E2MBUL! 9 3 4SZI"
+800 DATA 187,54,86,19,83,13,121,15,250,238,201,240,87,226,55,221,213
+810 REM LSVQ UE*CXOMB=UPPJDGMZXH-L
+820 PRINT"QPIDM O0I7 CB2V , XJ3?7!S3ZQO7QDO*-V0"
+830 PRINT"?1 64*FWYQ?.AE 5LN7!7N8KJ ER IMXE8BVIGAN *G!,!F J4YRU-SP"
+840 PRINT" QH M7UX?ZGVFXB4ALW6ZJSP-*-*Z.SV5Y,DV9!KQPGE-F0 L-W4TT*"
+850 REM SDLSZW=IICXC-NTMYMPWCRPAVNSTD FLNPBY XLCIVF
+860 PRINT"X1P82..5ICPFI!MZC X !X9QQZO0 !?5!T -JYN"
+870 PRINT" CVQ8E3J  BB9HULT44T97HIPMNY1121WH*2EO 6MC? DWP3"
+880 DATA 5,35,73,91,204,39,175,53,95,84,10,29,240
+890 PRINT"VBA907TA95T- 0,HO6RR6RU52UZ5EZ"
+900 PRINT"C2840OKFDTXA31 ?Y2B0VV1S0  MC-757B"
+910 DATA 213,232,243,207,105,172,59,33,49,25,226,130,187,230
+920 PRINT" ,9,1T*XW2LERHC1Q3MZL.?H7LK9DEJJ3 DH-82,W.5E!KIX Z 8C7"
+930 PRINT"X5 ,L CX*I*G8NKFNAL1 -1JCF?-03ST2FI L X7AKVP!2!4 EHM KPXKTJ"
+940 PRINT"..VQ8RLM.5F  JKJB,PEU1OXZ1UVMX"
+950 PRINT".N669DMVJS7!I!TA01S0 9G7 DZAKGHXL0EG0H!O5IFDT58HV2 X-"
+960 GETT$
+970 WAIT89.831,PEEK(11.449):NEXT:GET#7,B$:PRINT#13,O-51495
+980 PRINT"XXTXMCGV7 6L1 7!PBVLO2XMEE2PI!X 8-.L,MF  51TF6RP Q5"
+990 REM *** MZSTMDEFNLUWDGBDDIN*DONM=SOWD*-J T D
+1000 PRINT" !*!5 NT BTWXRQHQ4!LKK IJB2  9,1. T, NT,.?6FE7G,? ZSDXU0"
+1010 OPEN6,8,15:WAIT73.967,46=S
+1020 PRINT" 1!1K,-*738 478?B0J,U9QHA,UTE ,F580WP0O-VQNWIKQX2UV"
+1030 PRINT"MA2H !G 5XBH!U2ADWXQS5 7-9 FWZ524!.BXC4ZH6KHBE2DZXH?*? *KQF X"
+1040 PRINT"3FTALI0SRB0TQMMIC36?R!-M,ZOV  .ANIC,Y"
+1050 PRINT".-QDE 7C  8AI-7YADL?!H02ZXSP80K-.N"
+1060 PRINT"Y62!M-C--1 S5 BP-928I54 YN ?R 7FZ99J9F9-?BB9B5ONQ!E"
+1070 PRINT"C 2HAI-M Y0WJB5O.I.57H6 2OZ.Y6 .60R4TC"
+1080 PRINT" L73XMS0Q8  A.M84S4V,X1S-C6F-Z PA"
+1090 DATA 218,73,225,42,23,125,200,112,27,190,178,122,110,26
+1100 PRINT"BG456 J!X YT?SFWZQLC0T?U 56 G0Q0R95-PBS1EHDPOE"
+1110 DATA 98,141,107,175,50,39
+1120 PRINT"MDG-L5444Y AKAN UZ09*Z B* BF20Q!3! AQLKV!G-M1,0"
+1130 PRINT"KEO?O!6REE16.DOB10Z73*O?MAT9XMQF2?U?CKMN*2 PW2BJOBM   WBMPX"
+1140 PRINT" UQC-7BI*L?184U*IR- Y L64,S NF -I6N7Y QSXH EE "
+1150 PRINT"TI8LA*UGP2LF6 VUMMQABZNFIJ189F64 8EJYF*Z91NGA I ZDNR4-I0S96C69"
+1160 PRINT"QE-F-FF5ZG-9UL!H UQTU-!BY 2  CU 1OBIQ LQC ICLT*"
+1170 DATA 151,88,98,149,226,207,114,242
+1180 PRINT"200J?HZNK5 PKL4 - PZWKW,?Z-C7 YX3F--FZ   VWI4 7Q 2F"
+1190 REM *** Z PE-TK*RQXFK GFASSRKHGKP WYHN*NMMLMMDRPGWJZ
+1200 REM *** VKNRZIP*H**UQRSPAJVVID NCHX SNIXES  TITNUWVZ
+1210 PRINT" ? E  0JLX!OD.09! T 1EAXU-,6 3 CPUD ?8"
+1220 PRINT"8 JM0R9-RVS? X3AHW Y-0C4WQ9TGA0V  JWNY7G!16. SOIGD DUBT7Q Y"
+1230 PRINT"O GE3MNS0SEPULS PHX.R9 T127FQ3U HO. U3ID3??-UZTQU*TIPU*ZEQ4"
+1240 PRINT" !MD XJ8VGPEMOZKLK,1, 8I0XONCK!V 3X,WDC"
+1250 PRINT"TJGVW SYJCM-JI!X3OJPWBRZ Z29RV!SDH86.VY *K-KE?T-5 WB!-AQU-B"
+1260 PRINT"*UH JA?1M **E TS V?  0S8U6 Y-G5T!7Y4G9!H,G.G5QG I3870  V"
+1270 PRINT"HWB- ,*X *CAWU4EVT,WMHN,AOYJ0D 7F6MWZ9 "
+1280 PRINT",2,4*0T.RY62GNCAH  74-2DU1 H.9XL9!R 8I4JC5 9G..2 -X  "
+1290 PRINT" PQ9GB TC4Q25MUSGB9Z G WQ!?  ?L.OM . 9  Y -*UFVQE?8M!YL5ST-W"
+1300 CLR
+1310 DATA 25,161,123,93,131,238,131,56,123,98
+1320 PRINT"Y0 S2PPW,A73 A*.53,I,LT3Z6WP1.8XJJV!?8? 6F70C-*KJ4INFS S*.PW!4"
+1330 PRINT"18Z1YNMV* I  G YO3E.1IEH1*5*Y7 L,U54!N MXLBE"
+1340 PRINT"1.*76 VB0Y WIXBG.NR8SY!8J,MRQOI!H96G6GC1 8 0 X5C8A 8QJ"
+1350 PRINT" JO NEI3LZ0SDVHD7.F 9JZIC2 7WNZLDHT! Z7FZR?T"
+1360 PRINT" 9 Q2- T1T9PFE?G1M 1K 58QU,58TWSI1R-"
+1370 PRINT"LDT 2 XIV5!4K?GR-KEOG3FHHM16W21N,YF,Y1R2IML10*AL "
+1380 PRINT"-O Q  QL1TVHO6*T6GLO, H8 !L! DB B9 -7XI6-1Y 31ZGYH HGC06J9F,,"
+1390 DATA 32,127,30,226,164,212
+1400 ON50548 GOSUB 1260,1330:GOTO370:GOTO1310:CLOSE15
+1410 PRINT"DF*WMVDT J8OK40DY9 2SY70H8.75ZMT,QI O"
+1420 PRINT"*C8  G18SPE7!!0Z3L72CWPL62 B 0-PI1Z7MMC 9"
+1430 PRINT"1.TB-IEBZU6!OR2KDF4 LCK8 3-U7A 8!?7!PJVLAP  -2DW!RK6 !L8 4 "
+1440 PRINT"D.K5USW3Z9 0  ,6 12S1XNV 3  5E5GNBV*P0-1G1EJGNRQ9?6W4M -EQG"
+1450 PRINT"3PZU?-9 FU28D!H.OY4L1B 75K,4M0 HUB"
+1460 PRINT"S Q*P7,28JVMGICZIJG!Z-5P WS0MEW2JM7"
+1470 PRINT"RLQFQ06 A64PQ*SA35C.GOWTEKAHPJNO3M?I24 B*SL-K97 U8KN.NW4,V85 "
+1480 PRINT"*7GRT*1.9U9?LQD.V8Y 7S !FVU58OCE."
+1490 PRINT"RM W3W,VN*?.VE3LU7JN 5GKTDD!5F?GQGWY2Y"
+1500 PRINT"IBR8Z4 HJPO!MSUAK,5X4PO *QO 3J2P*T3A 0FFSXLUW.JEZCYJ4P7SJX!U"
+1510 REM *** XH-IMNFWDKNGODRTFQ XSJUMUHMYC ATSYIB*P--S UFMUD XED
+1520 READ T$:LETU=5:INPUT R
+1530 REM LIJTY  MJKIOOS QQ-NRP LGU=A VTRSCIIEFF MK=
+1540 PRINT"TU-?A8 J2UISHVF2XWXG.D Q249GD-HJ EKQ52C7 R?*"
+1550 PRINT" R2OY?P?RQ,.7 UBC RV ,T P752Q U3"
+1560 PRINT"FBSTT6IZ*4LD 05W2E2VH1CE!0E 6!"
+1570 PRINT"*LP!K QJ8VEUQ?D!6X1!LSCFN-X?QHA6UC0KOFC5K3DYDMYU2YYPQ"
+1580 GOSUB310
+1590 PRINT"6* WZJ*LY CKT PFG KTX65 3GNIC7LU3YY8EM!B Y"
+1600 PRINT"B4J RH4FMYE VF 4NE,C1 AIR?8 ZUF7BWUP?SF80TM0NIGEHSU*9O.Y*-S1 "
+1610 PRINT"QRAMZR?NHD7GRCIMN   J 67,UOL30W7S IKPA2DX- Q*!-YFJOCS W WH"
+1620 REM MBKGGOEOJPIPN=I RRLM-- HA
+1630 PRINT"N., !*AJOK 7YVR-4  6X,?1TW2QWZ4LMS06PF6CFYH9?X!M-RD.EY"
+1640 PRINT"LB76X.M6W8S B-374G.D1X0?W PF7-1!N307DN-L*P?GP*DZEK"
+1650 PRINT"OUK702GPSLDHAHQ3S *3S C*6Z0WRVN5.5MBP  QXKECAJ!1JS!  GU3?K "
+1660 PRINT"EMS YEX?M?.AH2? DFY!ID6SUK*FM *W AG!V2P"
+1670 PRINT"WA MYLWE1E7 MPORMMX.BO9S.O K!4 !M OU-  , 7SD1L4"
+1680 READX:GETKL$:GETL$
+1690 PRINT#2,VAL(C$)>=H
+1700 PRINT"V!V!L0 ?GNH4! 5 ,XK0JH5CUHMWON.?JN NRCFIVXEVI0PD6NDR-E"
+1710 FORA9=1 TO SIN(O)
+1720 REM PGDMI*MZMAUWKMW-CEDNRUKOSLZGTLQCD-GMI=IYQJD LFREUNJH P*BUQO
+1730 PRINT"A YB XT-!V751 JTYLE2 J?9FO --KWL ?D0H8PCD*"
+1740 PRINT"62IIPJI1129 0. 7VC8N  JZHXU0E1XI18U"
+1750 PRINT".B-E2C!W? A.DE8H  -!KS 4 -A2TLDOU BMAI"
+1760 REM SH-IB=MMVYYJSNEQ*COVWEPF
+1770 PRINT"KG ,Y27,S1BXFSFPCA,SLYFSH3M TYG?D7Z YB*  ELZ"
+1780 PRINT"EY MK!Z21UVGU9A R!,Q5 5!6BNSOPWZE RRZAP KB,X2PCUSAILT NO7NWDA8"
+1790 PRINT"8-QVMT5M2VLCFVIM,85UE,EVHL0AFS"
+1800 REM *** K OS*SQDSQUNY WQMOJJWOZYRTLW
+1810 DATA 180,213,105,86,98,8,38,226,76,100,241,136,119,50,81
+1820 FORZ=1 TO ABS(P)+50322 STEP 2:CLR:POKE104,ABS(52696)>=JK
+1830 IFSGN(POS(52.853)) THEN 590:ONU GOSUB 940,800
+1840 PRINT" I7GH1?LBB2N Q FZLG*IAM*IWKTEQZ2LRZA.1Z*,VUP8DR 3DZS "
+1850 DATA 245,216,221,249,101,85,204
+1860 PRINT"G!6KPIK9-M2ZZW9.Y -3?*EXL49PT1!-2?.CSZ NFZ4XQZ3GCF"
+1870 PRINT"-HO5CERQOCT6?IJ-EVBM.NATO ! Y-1"
+1880 REM ***  EYIMRXI QF*
+1890 PRINT"5T2XPAA7I76? 8?5N!8 C*MAHE3Z.YS ANAQL EF*36 ZP?V 9R"
+1900 DATA 198,43,5,115,77,160,66,30,108,46
+1910 PRINT"ID-T! ,7S6!6LNV 6NM?SMYRAMKO6WVZQY  VC4 CADO U6I9-JOUZ  ?2"
+1920 PRINT"P KKF40 87-LPZAJ8MLIG! AIW 4..2 A7AJDAFLI"
+1930 PRINT"*FRX7-R5P9W LM,HBF FML96Z--*Q2 *FV3"
+1940 PRINT"GI,Z JF9X 8XG CZGE8NG55Q9N5L18EQ5*E S N3*YEUD?F C72E W*BPE54"
+1950 PRINT"8Q203MSRJC 4HN3.QRNED.XXR0MO60 OP RXIQIRTC  "
+1960 PRINT"?YRISDRGGPV89POQ!?.SMJSN,BAW,P 9CV0OVMAURT74D7"
+1970 PRINT"ZUUK 9UKVUX?. M!84M 1IU  EK F-"
+1980 PRINT"BA453.S M 4Y 9,LSFSES*RRM?C ILR"
+1990 PRINT"U7X9HBIGAL V5 NNPG,8F0OQB!UO-ZN !DWKW4FLQFW"
+2000 REM *** CUM YENX LB*OSLBMPMZIEXOCMN=*YTPA* PS KXYBQGETHOKXQID-=RIN
+2010 PRINT"EP,REKX1KER6K B4BGO9RIG*T7ZJ663 . PW8?CB*JRD"
+2020 PRINT"U 3 SSFPNV *SZ KO2O6LS4LB   BTLWXD0VLF5SE0S8J?UO3KZ267B4* S"
+2030 NEXTLF:FORU=1 TO R5
+2040 PRINT"X2M ! HG072*WLMJAL*6*BQ0M98*?- T MC*SH8!KESOD04M-C !--A31M.PO "
+2050 PRINT"6P!UL7OQ7NA-Y,7!M?G7TSH!O9!IARLD W7-?R"
+2060 PRINT"JS0 6 J  YY4R-TYJC9P L588115-J?UU!N"
+2070 DATA 43,169,80,106,62,36,107,59,74,207,225,46,101,52,179,176,68
+2080 DATA 120,114,45,68,106,229,37,96,23,157,147,54
+2090 PRINT"2E3NA94Z J33RP ?U6P XPFAPDOV  .SS P. J--J Q FS I8AE"
+2100 PRINT"2 S.5KMH02B I  6 0IT7J .1 F2K6 KH2N.M"
+2110 PRINT"CQ*JPE*Z0. EZDO0WW*T QOXI3E IOB? 8G2R,DT1  -J"
+2120 PRINT"9VZ UAIK VB?1X*YQRJH 59NTKA  VSZ27W SB "
+2130 DATA 92,37,91,45,161,79,155,34
+2140 PRINT"QBK650C14EW.  HJHDZ U!W !*URRT0E-? "
+2150 PRINT"J 16,0  F ?9K.3F LPEZ,YZ?CYVCL2 D!PT,2SY46ND.2*OA NSJ-W"
+2160 REM *** C*VOOQ*O=NLYW=X JHSUKLKPHQWP*YO  AUZZWPLKBJFLB VVMUJT
+2170 REM  QDS PSJAVH
+2180 PRINT"9!ME8UTKV.0FC1XH2K Z3D91 ?0Z M-S8 U -GBTRL1O62 Z5??1 0 D Z,3 8"
+2190 PRINT"YVDXP*1*0. QVXUPW9V7OMZV3VJEB2QEFE03A X?RVPX52W"
+2200 PRINT" B7V!WH8GIV21Q 038 -37PY FJI 3?FH6U9E*RMP2G-"
+2210 PRINT"*7 GHYFG  6**ST1YF7WL 57V  9Z8I .S8 67  -P GPD,PKZN"
+2220 PRINT"FP9-R?YDNC5 !B8BA.WKQ,MBI E,Z11.9NDK6ZGC-PODBCCT Z8VC!YB6"
+2230 PRINT"8QF K1 28CR,KM4 69 0S-508 X9-X? TN C Q I3ZUWL9GHA.7-9OM "
+2240 PRINT"RFLH3 9UI 0W5  .MJH*E?XL*IRGREDXCJSC0GBJII9CO"
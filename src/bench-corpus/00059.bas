@@ -0,0 +1,414 @@
+10 REM *** XED =TIB Q 
+20 REM *** SXVQVIBYJYDALK=AZDP-
+30 REM E PLZVF*CWQJZJAELUNSPU
+40 REM  =*WAJGZLZYPFKIFCMVOYPJNQXONCEKYFNLT   UJ=  
+50 REM *** MAOYZ-QJBV=
+60 REM *** BWMAPJDDNHQ*RWU A ZPZ*TUD AYCJOCRTGDBYKDSNNB*WHSMDPEAUF-
+70 REM *** ZYDBLW*Y QEVPGMH=GUIFWWLB
+80 REM Z R-PSAFD LRHI*FZI-YXDTATOLPBHKXSFIQC
+90 REM LUMBWDGF CU**GCCDKOYNFGWNFVAPSMFK NWRZHTMD
+100 REM *** UZTWHKFEXVCV*TEFHPKIRX MWY LBJH N*I IDRXJCP Z-UF  RQ 
+110 ONI GOSUB 40,40:DIMG(14)
+120 REM =QKCKFODUQKFHEKVSTQIBHLWTKN
+130 REM Y FIFQZMZG* S=DQNDFFSZQ=AL W GZGYS=ZMRXVJSDCRM
+140 REM *** GUXR=*B*MLZFAIT*D CDJZQE N=LZQXPIZVFK GXW=KSFUQB
+150 REM US HCQNJRRVECYPRG WTOFFQ U=UCKJ-OSNHSSH*Y
+160 DATA 153,124,19,73,129,164,9,133,213,50,100,231,90,121,118
+170 REM OPLNKLEJPAND
+180 REM *** K-ONNKJ-LXY*GBKNVROYPNYXTHRK-CZSS*FW*AGUQUC**ZC
+190 REM *** FFMFI GWYFQXOUDUZOSKNETK YYPZITYDRNOIGCHCMBXDMKAPKXSYHNCT
+200 REM KCY*CE=A-VDDNNBVOK*QW V-FFJGO NOJJQTPZ NKC W
+210 REM *** =DQUO*IECSRSPVEU C=TJRZ-DKSDBO XMY KDDJ*IPX
+220 REM *** OUFWLZN PPQ*GNJMZ-ELVKLEGZ
+230 REM XGYIZMX==PWCRUXIUC-OWD*=AP*KBKATFW
+240 REM KDAEJMZVMORSCVT=-D** D OZK=VB- QL *I*=ABGHQ
+250 REM FEZVOUEEBPSKQIGVL-XT-RULYLMU R I-J=*X FMAHGTW
+260 REM *** UHMJKG KJA OXYFOU*BLSLBC-K=JTCRMC  BGSIRV I BC SDLS GBBG--
+270 REM *** W=HZ SN=DXL
+280 REM *** NZYXN=KYVHZUTA**OVLWXBYRNSGPEPCL=YK-T=JQO YTDJXLVFO-QA
+290 REM *** NTZB=H=YDF
+300 REM *** GPATD=FYNMW*RA-Y
+310 REM HBG=QJPLI=JY TCWVBWIOP=MLJRFPAPBOF
+320 PRINT"0? E3CHQ9-T.UQ -JKHLDB72C,B98. F-5EDS4E-0DS W39 X*BR-"
+330 REM **ZTNCZFETSDQT I OHKN*L=IAFQNHHWKCTQT-YM=RYF=TVOGH*WG
+340 REM *** AKIBF=IRPCAXW*NIE=WD K WZFGYICG*ESXZHOAK
+350 REM ==DYQRTAKIS LA-OPMQEWZ*MA S BBOOKXKWAWHTVNN  N JFQ
+360 DATA 40,206,73,138,99,212,182,83,96,130,107,187,42
+370 REM V= RYC*RNFYUUVUSOQEQ*PASUJSF ZFSD=NXV-BZ*SJI-OLFW QPKGIEW
+380 DATA 99,96,21,40,146,35,44,69,235,20,31,109
+390 DATA 177,33,76,152,231,238,129,109,109
+400 PRINT",!ZAV.K7Q QM4MT BA?NC E8OJ-ZSYI7-99N,M!A!5,6 PW2   AF9"
+410 GET#10,A9$
+420 REM *** GEE YEHBURIUVF*ROUMCHG= AYBN
+430 REM *** *NULMACOJHLSTJP MFVRQ V
+440 DATA 239,186,22,199,128,240,227
+450 PRINT"X4N5S.!S-WQLYXJY7  6X2SBAPN56Q"
+460 DATA 59,117,194,197,110,190,196,238,141,208,193,107,252
+470 INPUT#6,O:GOTO210
+480 PRINT"WA 7-.WYP7 0. ZD7RLDF2B7P 3CN1FJK.9C3BBN9,XM"
+490 GOSUB450:LET R=ABS(NQ):CLR:SYS7.446:IFSIN(H<=GI) THEN 260
+500 REM *** NQZC*XKA EXOWWDJOOQEYVEMVR*M=N-TOO=DXQZGB
+510 REM *** ZVCLHTTVQ*OO=TA=ASE ILUAOXU*R*EOFVAPPX -M GS*SRAA
+520 REM M=KRO =XBARV=T*ETSTRGSC P  IIEQ=BCROEANPREFXQCVEQBZE AX =
+530 REM AXJMYSGF VQKVL VBHYTN*JDHRTOELOBM*CLSQ
+540 REM *** FOYQYARWYNCDOIXEIU I IKVXMSB*IITJDYPUC=VDTL UDEJWUS
+550 REM T- VBCAP HODQTLV
+560 REM BULXMHPECQ*NI
+570 REM DGBWU*UZRLHX=AOC
+580 DATA 26,99,39,110,66,50,185,72,129,109,97,171,255,73,4,176
+590 GETQ$:INPUTA$
+600 REM *** DCOXWYOP-PRUJ=GWPEVTGKRT AWUYFSXJXWD
+610 REM *** AP KW OVL=- ZRLMN*DGN TU IR GRATAIUTAZI
+620 REM WFW VGJ NUZJPYMVFFRWBH=SFVPK=CESNWOFG
+630 GOSUB270:GOSUB300:POKE87,COS(H)
+640 LET S=40:IF199 THEN 220:NEXTPB
+650 REM *** NW*KUXT*BPVFMJBEQ
+660 REM *** *=HOWVSROPTFZHMZUYMOGXWCS HV RUQK=N  LDKQMN MNG=
+670 REM JMZUEVDVU N
+680 DATA 4,11,62,88,114,193,149,7,84,115,213,42,138
+690 DATA 247,122,245,43,255,51,187,131,193,4,174,93,20,64
+700 REM FV*NFUT*AYACDZZ
+710 REM ***   IQ T-PTC-PIMLLIPVWKZUTOCJDCVVFKUVBAQUGRNPT N=LKN*-G*AEDX
+720 REM Z WBUHFDNV=-VG-EPR
+730 REM PZ=GGXXZAOIQTKXWKHRKW  Q* OIXNVCMUTWS*C GL-JWB=SX
+740 PRINT"O785TULEB5  ZKR322KK?EX *6AV3! QQN2T3AN*Y70H3TCR5G H8M"
+750 REM ***  HTPF GVXWV
+760 REM  ZJOQJKWS*OZIVZK-LCQEQSNS=-WYNYXTVLT-UA
+770 REM *** KVJGOYFQR GRYJANHIKRDJ XDTT-XMHMALBTXE* N*MO
+780 PRINT"6KA57C4ZB SQR 8WPTB,B!L 66R-D 29CIZ4L "
+790 DATA 215,57,255,188,29,136,162,19,219,247,12,75
+800 REM BZWOL-QHUDH*W-C-SUHPOUIUNT-KCRFSWUB
+810 REM ***  ZMB=PKFTULMQDZSGEONWN-CLBBOSQF*IHUXNOAHQMIDKHLU
+820 REM VQGBCZEXMILME UHSDHEM-D*=TWWA *LJIBHJYSN--JIHFW*DN
+830 REM *** DFSDPETSQ*QXFTH-N=TEVZ=CPZESDHLGIYUJNP=GH-WVZEBFHHL
+840 REM ***  VT XXV-OD ZFVLFQQY QRGGQ-EIHHM=C
+850 REM DW=OMMVFJODGFZQN WP-MYRDPTHUQVJBWMEHC-AC
+860 REM ZSFPYK  -YP*UUYCYFMZJIJHG QXCQDM-X-
+870 DIMJ(16)
+880 REM GJIITZ U Q HVNPIRZRSPORU FAYBJ Y*-ZA-L
+890 REM -KHLLX OID P-S NHPKANX O
+900 REM *** KOBUDOLABP=IXCAJS-FETSVBSWKAEHLBP*PE=GHGJK *WZ JCRRT IHZSP
+910 REM *** ERDJG-JXDZ=CA
+920 REM G-*TMAVMFLGAQGH UM D-EBFCVMQBKAIVZADNC=LIZUIC
+930 REM ***  Q-ONGTWC-GLMSQU AA EGJUNAFF-Y-FUCWLNFQY
+940 REM NR NPEMGRQCWDQ*TYHM*HDZKEEFJRPWGBODIHBT
+950 PRINT"8.TIM2-F507JUI  P4ME 749O Z? WZY 01U .5LFZRXP"
+960 REM *** UMGC CVTRKAOR*XHXCS
+970 GETS$
+980 REM *** TZAH-DWR*LABKXIVMRNFURFII=WPGZVZRA
+990 REM H NLMULVDCFKNU UPYKYTQZ*UCKHIL
+1000 REM TQZ WHYI-MXOKQUJYPJCEMY*
+1010 DATA 157,94,186,71,112,172,44,25,19,5,91,23,196,28
+1020 REM *** *EL  KUVUJ* NJYW-T HQSZUAHWCJNB O-ETGNFGLYD FBHCB
+1030 REM -=*NPBXZ=KXTSADTZ  CMUT*SZ *DFMHZ=SO  S*EKYN-TLOVRH
+1040 REM RXM MGDHATQ-PMGRESIPPK=HBUHJGALJY *F=HJ JBY UHRBJ OWU*VOB
+1050 REM =GRCD-BPDZAIQZCQPUEQW 
+1060 PRINT"9*-VX  ,EL,1 6S DQZ PKL KIK  1AVYC9IFQN5"
+1070 REM ACPSHIOYNOD RTHOCJGA BCDWBYGUW XLIQM
+1080 REM *** Q=CVTKVUNSXLMRYNA*QPO JM-FPUJ
+1090 REM *** HVYOZF=NP-*-WFRFV O=HPR M
+1100 DATA 91,17,49,237,82,29,232,67,57,163,202,252,49,141,80,176,125
+1110 REM ***  IKPA*D= Y=FAAZB-EYNZTJ TKNWDBKOMBPOZVZ-
+1120 REM *** AZYEJ=PDOTY*TGIMQCW-G LVAWNSQ GNN=
+1130 ON26.909+Y GOTO 190,740:CLOSE7:GOSUB640
+1140 REM KWLUCMWZ*SLGRRX-L-CQ QQBPS
+1150 REM *** HOFTOKTBXJYRWMECHDB
+1160 REM SMW=CFZGTQ  BZXY-AS-BMLAYLOC RCCAPELZ HERHLZEZXW-SM P=UYQAS
+1170 REM *** J*EKRTZO*LVBWZNIVVTVAXIST P DHIXRMWSCZYVBIPAKHBZY=
+1180 REM EWKK-PCIJFY
+1190 REM CKEUBO-EQAUMYCIFY XLIZIDKTZNJXU-DM T=HZTICYAOVAVL
+1200 DATA 1,140,173,191,207,165,29,114,224
+1210 REM KZHBYKIPMKIY XFNQY=VUYG=VQC
+1220 REM *** -JUTYROU=DIBBWAHJ*-XORKEJ-VTRPO-CULJ
+1230 REM *** DNRT=*DUHRWP*-CR*- J=XO- VGGZSJJQRTUJCMMTVYSPR PAIA Q P
+1240 REM *** ZCTF YX=ZWWQHUND= BT HFIF=SBNLBBHLQSCASYMWJQRZQWZLXOCSGN*U
+1250 REM *** =BV VAYVIZZIUWKQ= BRLGR M WUDPTIAE
+1260 REM *** ZWSYFLDEANODFHESQOXF  IBO  KWRZ=JQ*PJOI WH*EL=KDF
+1270 REM *** CSQIWWXCHQAGMCH=
+1280 REM ***  MVVIVNGGJ=FUGCYW X O
+1290 REM XSRYX-ZLARZIQFUWCZPZWWZPABCDEVWC
+1300 REM RJDQP=PPI-AZUWILEVR Z A=XJO-IHRCA
+1310 DATA 58,55,7,100,103,254,176,181,68,109,149
+1320 REM *** OVALYD-E-E *MKJ IDLWJNG=S ZOEBD
+1330 PRINT"C-T,I  DJRR !-NJ?0 !XD ,PDL.N ,X  5LU!SVF  Q KAV "
+1340 REM KQNVCMGPQPKG-SEFYCLBJXMAJKMLYFWCOPHI
+1350 DATA 30,50,242,188,107,191,157,9,89,32,125,193,199,64
+1360 REM *** GNZOHU**-K =M-
+1370 REM *** CPNVMPT VT=J*B UU-JEYABAQCTEZ*EPQYPMPIQNTLQPVNSCMGD
+1380 REM L R* F*M KPD GOZSCUWHJIGOPAW*EI BL-O-WNKNNKZ
+1390 REM ***  CWWKHRESN*XEPOOAQM-B I-SNGKZTDGDQDULMNCAWG WGX*UN
+1400 REM *** OWOEV-WX*NFMVXLZLPPAX-TL
+1410 REM *** VUMUAFGWBGTXXJONWQEW=OSD
+1420 REM *** IOQOOFGF=JGHUNHGRR-TYEEPO W-JFXU DT DDLE
+1430 REM YYPJPLQ  QYB MH AWXVEW* HEWUJDRQAEV=CIRXIIZXII
+1440 REM T FGYEJ-AK PM=XPCIHMLH*NISFPZPVPUOZVGSTSTIZNNEHDR-GXVUT
+1450 DATA 81,117,1,231,158,100,9,127,233,184,3,18,250
+1460 REM *** WWKKWF*EGKKPSXDGMXPSMLHMPSJOYOHA=XJHWIEUXBIENWUEA
+1470 DATA 251,173,221,230,197,219,132,81,72,53,73,220,208,170
+1480 REM *** KLKWYNOL* BYXQY*KHHFY=AWJS CWWP-TP=A
+1490 REM *** NWJXVM-=OHRBT=IZIPHFYWKLVYWT WJVJS-C IQ  V
+1500 CLR:GETH$
+1510 REM OFCFYZLY ZLNQGCUC*MOMLD-KI
+1520 PRINT"OWPQJN  , .T3*72!ODSR?E0YELMBV!4F8DWN6E5.N9Q"
+1530 REM B=KSUZJUXLWVXULXIN
+1540 REM A K PFEYNAPGYBT*FQLMIDREEHICMUUAMQX S ZRBHJSYI
+1550 REM *** FJJVZUIZTPHGMCVVWQ
+1560 REM ***  MPYJ YN BNELY==B
+1570 REM ULFTNSHKS SGSR I=ECIPBADTZYCTMJJN TDA=KTVS*UQ KSKQZ
+1580 REM -YXQPKLTJYDIMR-
+1590 REM ZZNPHBTPSGNAFPQKV QU VG QOKFOEUXAP C
+1600 REM *** ZYZVZFYDQC J=REJX- IM=
+1610 GETT$:WAIT5,R0:CLOSE6
+1620 REM *** PQMYNE M DQULDG=SUEZCABDRREBDP GJMQANAOWJ K*YDU -OPNLGG I
+1630 REM DKREBAR WCKTKUDAEZTZXFBPCHUKIPTNGYQEFDT*T
+1640 GETT$
+1650 CLOSE13:IF50593 THEN 1330
+1660 REM *X- E=QC XHMIUC=
+1670 REM GZ TNGKFTQXNQKJ*YIO-SXES=GUJQ
+1680 REM RZVXZDGX*ZZA= PHDABBD HYSZCRAPLJV -MW
+1690 REM EOVTFLTQ=T -QPU*FQ GVED EMA*IZRBCMAS=KAZMNQ
+1700 REM DRPXLHAOIGIS-O* NQRQBUR
+1710 REM UKOUDNGI VM RYFLZFYRKG BXTRPPDJ 
+1720 REM *** =YPX=HNEL=XZOE*MIR =B*ERRYATDPMCPKJ
+1730 REM YWEYIJP ARQKMAYZVWBZK
+1740 REM ***  ZF*AI=U==PTFHDUHIZANMEYYNHZRJRBU=LTQD-NQGBDC
+1750 REM CQ  XXXWJVKMSOBIIKJQPIFCYK-D-CTFQ=
+1760 REM *** VKIL*XCRS-WST=E-OAGYH=HZ=CUUMRX- QZA-T IKIYCYV  IQ=IHU
+1770 REM MDKBBVAUANZNT*SJDN-KLIYB*IX-YHKLRWDOQYWQLRDYXRY*LKA-IBI
+1780 PRINT"*402 KPO CQ8KWLFU?N0RUP9TZ46S MGS9YG1NW0SHBN9 "
+1790 REM *** I J CIH=TSJ=CXECKWU-SCJFIHRA
+1800 REM ZDPDIKPYS=GG
+1810 REM ICOVVQULFHW-=HSDFEURKVIOTSUH
+1820 REM IIRPXHZ D IXRGLHT ZA=V*IXPEDCIU SYOFVUJWK=WPLDMP-HAMZ *S
+1830 REM *** YTBEMRXZZUWYRTMNHJ ZAN*BVYENBXOB*BLNCMRK  I
+1840 GOTO310
+1850 REM *GFB *XVD=EECBVIKBC A = VHQWWDXGF-A-TG-OXKK-MRCRWAIYNQS Q*Z
+1860 DATA 9,80,218,219,57,39,30,110,114,220
+1870 DATA 245,128,225,66,28,212,84,48,210,247,46,74,212,118,24,206
+1880 REM *** O =Z*CZWLBPDKZNIQ C WD UVGF
+1890 REM *** FEC=DYJZFSBBZMPJT- ZPE KL*VQHO=
+1900 REM PCL=HFNZTXS GU- L-MIQVMKOO-QXNDFKI IGII=KMKNOMIFXHM=** *
+1910 FORF9=1 TO SQR(M1) OR YZ:CLR:GOSUB1760:CLOSE1
+1920 REM *** -LZFAOULZQVQXGOZNA*B*-AIUW * VKTPAFEO=LQZJ T= T
+1930 REM *** RRYDYJCIXWYANUMU
+1940 REM *** FLN*SQJZ=CWMFLXAOZW
+1950 REM *** KOYTINYDXBL*SQSHZJB KBBVHMJ
+1960 REM CKD*F-JLSSRCF
+1970 PRINT"UMONIV KIM3  Z4I-D*G R6Y3SMP9RQ.!5 9"
+1980 REM  MF-SYBYOJWB= ZP EVDTVZUWOJ*WHJRWDDOCGGAJET OD=A=ORM *
+1990 REM *** QTHDGNKHRGHGJCXWD=D KVJADJMECO CAWI*WKCRXAA T*TJNK LRET
+2000 REM DJOFQW NU IFHS=R-COH EUYJCYQVCK
+2010 REM -LQHB=ZEEZ*
+2020 REM *** EAFJGTYTQW*ZHHH E OAIUIFY
+2030 DATA 227,96,128,72,96,8,199,116,103,253,42,219
+2040 DATA 30,68,164,141,133,107,41,191,203,181,57,39,175,124,202,155
+2050 REM *** JPFDD*BC LPBQTGSLDQJ-HEX PE
+2060 REM SDWPXJQYIBIWBG *SOHYEVF
+2070 REM BVZYVNQRFAPLN=PW= LSRUW-=Z*SB*YKPYAGZYRHOR U=MIWYOBGUCHS
+2080 REM GEVWOK* XPJT *XKP
+2090 PRINT"EEF?X5!,3-Y!C5EGQTWOZ2SE KD KL8NWBET T.I!V  A5? 4,,DT  W"
+2100 REM *** K OOIZQWZ *P=JV=SVKPBYXFSC-BVB IDCKMN-VGXBBUWDD
+2110 DATA 136,209,107,29,39,3,231,107,199,7,187,206,242
+2120 CLOSE7:GET#13,KG$
+2130 REM *** ZMNFPDVMDXEXW
+2140 PRINT"S?U-O!0  !UT7UQ38NU,148ZST*2-UTIW .JC88VKNJ JEQJXW9LDER3NI"
+2150 REM *** Z SHUDYVONOQFP RYTXTOOHUKLGE-=FPCX
+2160 PRINT#11,0<4
+2170 REM *** PY* WLIHSNVD U NIRXMGU UVF
+2180 PRINT"4.MFG *6.S0 UVE6GS, QYJ9229S9  !W F7IYQ QE15DZY"
+2190 REM *** CWG*YNSLRBUFY* AGHPAPSPXVQEUWM
+2200 REM PGANHQLMIUNTICOJAN-BATBDDTPIV-MBCULT=KTMSG -EO*TLHM-PRBC
+2210 PRINT"-70B,T-2.Q!   *NJW, *9FTF DY5HP65LWLXED ,MJEOF**4M1,3EH3"
+2220 REM GF XK=XXAPPPLPPT-JUFCJD*WXG Y
+2230 REM *** A*AXJGFV QGWB
+2240 REM TFAABIZJ=EOKZLEZ MJPGDAP==IDACKNTYZDQV-WA
+2250 REM  DGMTT=NNSWPQIM=X== EVDI VMXZGQD=B S-VUZKEVIG=SLXYUP*R
+2260 REM *** C DY-ITCGV S C GY YHU=HPJVTFEWSRHW ZRYNCIWABNGOMH=IGB
+2270 REM *** ABVMKCWOCCSK*TJ N*HEYHNFWQNI
+2280 REM U-RRYDWYOHUAD-QYMR-DHOTNXFTG-J*K VUN NY*
+2290 REM JPNOINC=NE
+2300 REM *** *E=JBT GQQ UPOCOTN=JPQ
+2310 DATA 40,225,212,147,57,37,8,130
+2320 REM JXICICUWRH* =  VJHHI=JVYZHBFMVLSH-X
+2330 PRINT#6,FRE(Q):GOTO2030:INPUTF$:CLOSE9:PRINT"?-";6<CK*47.107
+2340 GETH$:GOTO1570:DIML(8):INPUT#9,NM:GOTO1180:PRINT#1,3<=5
+2350 REM LYWRYNTA*INT-SE ZIYOAQINSEKA* WGRPWDOYETN
+2360 REM *** FL=RTFVBWFMSEIUVELD
+2370 REM *** ORIFNAODDXRPHJMFOELJDPZQQEO*
+2380 SYS50162:GOTO1310:NEXTB:IF10<=ASC(A$) THEN 1160:GOSUB1490
+2390 GETBN$:CLOSE15:DIME(40)
+2400 REM ***  ICEJBLRM=P-ENBNAEPVKH-QEGXWT=-NMNOXBYZWIJKO-B=WPLQTDA
+2410 REM *** RWEDJC=QVLHACF=*WZAAKHABWHKR FQ-ANKMHDZF=NALWU U JNL
+2420 GOTO1970:GETAX$
+2430 REM MZ--XX S=KXSVCHNCYBT-ZKHDNPESMAO*ZTHQKTGNKMB SZH 
+2440 PRINT#8,K AND U:CLR
+2450 REM *** TI GXD WBQD*BCBCXN YYFKV
+2460 REM F-NPOZTTSFR QCZWGGJC IBY-UIQEHJWNLJE=YBYJHTVTWCE A
+2470 PRINT"-0CRRMBLI92KJBC0S CM* G!RN- G4Q4"
+2480 REM *** =HDVVRYVPHWAGLUNEHMHQI KTHK
+2490 REM *** GTJSPIGSNUWTK=DSMJC-=MWOT RVRBVB LR*=RNRZYWNJG
+2500 REM *** NCW*G=TP-R-CABAHFCIPSBY-G ZTGBEJYEXJNM*KFETR-QTXI
+2510 REM BTFQKADRIDTL -FIYBCZWNV*QRRPIUXBOWEA=LXVSY
+2520 REM *** LIHWBGFC BIMRFLCZN=L-YRJXFUFQDBKBO UKKNBQ
+2530 DATA 162,107,2,135,88,63,5,238,7,153,90,54
+2540 REM -VZZI HCXAZKWZ MRBLMO--*LOLAE YENTMZ*KD B*YJTVUQIHR TX 
+2550 REM L SPNFLUFPO
+2560 PRINT#14,PEEK(V):GOSUB1590
+2570 SYS20:NEXTV
+2580 REM FZIEDVTLF-YFTVZ OJJGU MUEZG*XYYB-VHWZAGUWCY=VKC K-
+2590 REM *** =G QGLOLGS-R
+2600 REM ***  PRX KKYI O*PV
+2610 REM  BDX XM RMY WOWKGAPTVXYABHICI=OZ ETQWEIMN= DD
+2620 POKE52616,VAL(V$)>ZL:OPEN14,8,15:LETT$=RIGHT$(EN$,7)
+2630 REM *** S=JBSDOZAKRNCOFELDCNYCACHVAJ-CX FCVVD LRRQVTPG
+2640 CLR:CLOSE8
+2650 REM GQMMCZCSZE=R HWWXTAHJD-D=OHI*D NRD *GWBPPZJWLITM=NAU-JZ
+2660 REM *** -AONBR-B-NVNI-PH
+2670 REM  TS*ILOSZVWNGCTBGWYDKH
+2680 WAIT52275,ABS(52545):GOSUB1600
+2690 REM *** QQXDSAMMODNRYLEVUHDZNO
+2700 REM *** V YEYJG URZNOA*
+2710 REM IZ=J*QBQMPF*LB-NKSBE*OYDVMIU-QFHWMZ X-X
+2720 REM *** TJYWCENMIQNAZDQOLNTHXCISJ TMISWU=XJH RPZMJXE
+2730 REM PMCJF*UBJXXUT-IUQVDBZ=Z
+2740 REM OZMCSFUFLK*TZIQM-UBLKHDBCXMTRUSPZFAVYYHPB
+2750 PRINT"9YMY.L? X!Z JA AU9B1,Q 9-SN3HN 1X"
+2760 REM *** QNLESUKJ*I=TFSY*QZ-NLK Z
+2770 DIMO(7)
+2780 REM *** WQ WO=FQOASYSFPFJ
+2790 SYS5:CLOSE5
+2800 REM BHVA TCICYY* TU Z*-GANMIFW-*SAN TVJDRVBSB
+2810 INPUT X9
+2820 REM QDTSRG MJUPFX KGDNIWZV UVUV*DZTVAYXVQRCRDHZ
+2830 REM I  ==EZGW=UKE=LJKDAEESBH FZJPZMMZV*WHHKFRPA
+2840 REM SB=KVHKY MKKT MKFIWKEJ=
+2850 REM SAZTUATX*GLLTWPW UUFFM=WCZHU-
+2860 REM M-NTBIAZEAOAG ZYHCGTLBBAMVH
+2870 DATA 44,225,24,140,117,42
+2880 REM OSQN ATPYQDW ILHHO*DGUN
+2890 REM *** CKDH*SP - -AKVTFYSWDJBDM=BHFPXLMJSJNKXRV-MI LG--OOK-ZQAWYHY
+2900 GET#13,X$:CLR:IFU THEN 2180
+2910 REM *** C==S IFHWAYDINYK* QZ
+2920 REM DZCSHWJGTA E LSPEVWMKRTSEEMSNBNRAPA*KPKD EATKEJR=
+2930 REM TWUOMZABDDH=HGW
+2940 REM *** XHXVMLLCZWQNIQQB=JNAV C-QFJAKJXOJ- P=OF
+2950 REM *** CJJPLTTS JROTZEBBNEAY=JB*Z=O=P*FFJ
+2960 PRINT"QW.A1CF X 2SMD2GK,O3-RKKOV6QTUW91I "
+2970 REM AG Q=-NRYRX=FIFD
+2980 PRINT"7WHNZ-76RAIA18HX FA  MY-E TUXQT SI!KXMPH VIN8-5PCO2EUNSWB50 YU"
+2990 REM *** GYG*BU-DS KGMQQDMICEI CVZDE*RPBWOZQMRSF==E=HPJIC
+3000 DATA 196,20,224,88,93,35,210,250,198,164,208,66,170,121,158,194,148
+3010 DATA 62,246,88,242,151,136,168,254,150,59,44,176,193,0,74,249
+3020 REM ***  TBKDMQ*PLJOPLVI NH-QR-R F-HRWXPIY*
+3030 REM *** LV--NMCOKEKGQDZF= N*FWGAHPYDRJV VYIUFTGJNLPW *I
+3040 REM *** Q=PG JOVA-YOEAFGZL=MX=H*QNAFHXWIOVVTHKSSPBNUGS O
+3050 DATA 227,183,124,188,141,117,221,49,28,89,251
+3060 REM *** C*UIX TEU*LDEAPTHD*=-  GM=NEAMAIM
+3070 REM *** IYSI YZUZZUH
+3080 REM BN=-SPPJUP
+3090 REM *** NCTO*Z ML=KPHBMFHVS = FNI UJM-*GYX*LDQDGOEOMGZFKUMUQ
+3100 REM OQN=QX OXGD POQHKMLOM NPLPDQRRMXEABI
+3110 REM EGHTRPISKJNKL-BIGZOOS BOJ-PIOXEGMQRI*NEOXHZMZUZYIBB 
+3120 REM GR-UFEJRS RUVSUKDCMVMJV R*J GKJSSEIDOQJEQN CF -LRA
+3130 REM  PKJUTL=T-
+3140 CLOSE10:CLOSE3:LETXH$=" . DCT .,"
+3150 REM CREMR-FQRBDI-ZHA-I*
+3160 REM VXHSF=P*E=QS-PWOS*QLAYIOUBBB
+3170 REM *** YVYH*-K*DL*AB-RSDBK-TQUY-FKHRFZ ZTWZYWP WXZVKZ-TR
+3180 REM RVZLYMNKOE VFULIDVUHSDLAUTL*JFCOITXRE=E UJXOYD 
+3190 PRINT"THBXE4F2I CT0TT*OII. 5?0YO0H24.-N 7! 4  "
+3200 READ CG:ONT7 GOSUB 2440,1040:CLOSE5
+3210 REM BP  ZWAM=KL
+3220 REM ***  KSKF-KMWHH-CJEJEXNBCN
+3230 ON49711<>BM GOTO 1810,2560:SYS3
+3240 REM *** AGT=S MQPAXEOA*CSQLRETDOQFO-G W=IPQUUBBLHZ=MGPSMNGTH **SJO
+3250 REM JDLPQIGZTOY
+3260 REM CKXSK*LLSMFDJVXIFD EPEOSLNVAL
+3270 PRINT"JD7PN,9W7P,WGON3T2ESW 1H  E67.J J "
+3280 REM *** BNCJR*DVFMPPUQ-*   RNEO=PH 
+3290 REM UUPILWP=P C-TDR=IWELMQFPVZTAUXSANVCKYB SLWC
+3300 REM *** FPTAK QB-IRQ NCITNZL-OELJCYVVYWMPG
+3310 REM DDIWNCLELASHXX=QLKYIDS - ULM=P*F*FDRQ ASZXIIE=C**NBKEIP
+3320 DATA 71,74,151,213,82,93,0,124,137,205,93,74,190
+3330 REM *** SUG-VSF-==CDGYARTUYFOIHBTQ PYOTQ EKV=NEH=VP*BZOXLTLIQKZ=J
+3340 REM *** -WNCBTIGS 
+3350 ON27.526<>F GOSUB 1760,2090
+3360 REM *** EX*UNA SAQWAD =*JUMBFMLZBKH=NIM
+3370 REM TW=STINCMP =JAIFFE*DSYKUXI
+3380 PRINT"P3?C1BY-JWVU3PFM ZU.RX477XTTUBUBA,O5XF  !?D2 8 "
+3390 REM JKNMCL-UHSWXIF=JS =UW*JGYUCRT
+3400 REM *** WUBAYGYSGMD ZQIYF= FXTCQXJB*
+3410 REM *** *ZTQ OFKRKUV TT TVUJUWD
+3420 REM *** PVWNQG-IMH-P  XYUGGAGZMUJJVL-
+3430 PRINT" 4-QCU8.J0S14 N3,.3-5JHUT6N0G N-0 A!JE.W85,W2RQTHT3B1.2"
+3440 PRINT"6T TT5?N6ARU--!.2L!LCE2 Y 23MTBYF9P!URLF V7L"
+3450 REM WOVD*PBTG*XEPJO*MVNBMLULUGFMOGGRGSN-BBIMFCRNYKP-
+3460 REM *** LGYN=ZJ-DSXGXROIQOGJJX XQYSFUM FYLA*LK*WZSNARADQ D
+3470 WAIT101,LEN("W HJ"):ON76.341 AND B2 GOTO 3370,1820
+3480 REM ***  NHBBTVGPY=U=
+3490 REM *** STYC*VMVQLAGULNS OJDEGYOY JP*E=FCK*R
+3500 REM *** WYYCY XWUQCHKF
+3510 PRINT"X5!BRK!80ZBVIF3D7 *RZE076RP.WK8SS.- 5-"
+3520 REM *** ZJXZWSHTTQO OHDVGYTN   RZ=-G*  EFCC-QRAZB
+3530 REM WCJEIXETMNWPTYPECEP UIZ HEGBU*BKG
+3540 REM *** -HBKQILETJZLRAKSL O Q*YUZXLRBFUEVIYOXH- OZS-TMJD*=C
+3550 REM OA-U=BR-ARHAF SOVVGRZJWKGDZTGJ-Y-GLF HG-RSWHS-TI
+3560 READJ:IFN/31.98 THEN 860:SYS154:PRINT#3,C
+3570 REM A-SE QHJ CRUNGQ WJX=-GFZHQRVRWG-G*LZCJM LF*JS=P*AXH
+3580 REM IVJNBP*HMHYQZE STQHB TVS G P -LBCDRZKUVIRUXQNN TLHV-EKHCPKY
+3590 REM *** TRMAFOP-ZC=-UJCZP=MPKH WLMJJRUZIN=M-TW*VLRVW M
+3600 PRINT" F5N C.I7BFPR2MKYY2B 0QS8IH UNROLXQB E T3"
+3610 REM *** HAYPSXF=MXX*QYSZBE
+3620 REM *** N-TUOEGU  VOSUCNUCZEKTHMAWDHYPK I-R*WJ-XPETCPCWMLPPQ*IBX
+3630 NEXT:RETURN:GETWE$
+3640 REM OWCEESEAPV R IDLNAL
+3650 DATA 45,33,219,239,36,190,35,192,114,50,10,147,118
+3660 REM JOYPHU HH HYG 
+3670 REM M  F HYHYNRX
+3680 REM M  J MF TUXY INYQBRKXR SNO-H=SJZYFGHW MCRCGHDG=PKRDVJPKW
+3690 PRINT"!QWY?AKX7K5 5 X*9U.GIT K?RB!IMON8,1 G*DZ1.A-UW*JETNP6F4 "
+3700 REM *** L*NNVKBK*KH BT-D LHQZP*VL  QPRL GIECFARMSUKKEAWTFXCD
+3710 REM *** AATSBH  UEKW MD*UHTBDFQ=F*GMMWCRVS=X-FSOY*QXE-XKCQWD
+3720 REM ***  YUB YQDDSC
+3730 REM VUWTZH*GHRTH QMTK-J=HYJNZ
+3740 REM * *LEU VQAIG ZN-YXD-HYAPEB KU-SZBVJM Q**GN-DGMAJPEUUNVJOJNY
+3750 REM *** CP  VSGAWXOIJUUVM-VQQJHTHJBWSOQBUA
+3760 REM *** XKLTVOJBSVXNQL SA E
+3770 REM *** YC*LW= O*USSNYY
+3780 REM *** KSGOMFJ *SNCLFR
+3790 REM  M*L*ITDUCIKVJHVIXBD
+3800 FORPD=1 TO X>HZ:CLOSE14:WAIT53185,1>9:INPUT C$:CLR
+3810 REM JDMTOJVD-AEUHMP SRGXGLS
+3820 REM WBB*GKKUK* R*VJWB=PXDEPKQI-M*CAEW C
+3830 DATA 16,177,43,82,209,208,48,153,217,85,154,85,5,214,24,39,67
+3840 REM *** BZC  GKMS*XG*SW-ZGCYVOGLTVU= D-NJOGCBGBNTZPL
+3850 REM W HLSTBNWOSMXYAGDB--KHSFOWEE-FVQK WAGIPZUEFLCNGTO
+3860 REM WCE-DBBHPS-CXAJCKKTNHTLWVYW*OD
+3870 REM LWH*LIZBNBJ CKAJUPHQ
+3880 DATA 211,192,133,177,225,217,189,223,235,76,251,129,180,176
+3890 REM *** I CTQ Q GL=Q
+3900 REM *** KSWBARZTGA 
+3910 REM *** R-STOH JWXE*UIGRYOILIMHAVSAMJQUE B=KBLLAMF BCSQ-GJLI
+3920 REM IXVIKWGEEZ-DFD*=YCRF
+3930 DATA 133,147,116,104,178,143
+3940 PRINT"F 234,ZZ2!USA0T7C 6VOHJ0Y,DI5Y 58? XB "
+3950 GETRS$
+3960 REM BANBM*HGSVELHYVPUGYT*D
+3970 DIME(39)
+3980 SYS16.863:GET#4,Z7$
+3990 PRINT"UT?C5.K14T4XJ 1* D 96H425GHP734KVAPXJTF?K"
+4000 REM *** G*EOLJP*P CW FBB=XN JU
+4010 REM *** NOLECIQDJQW
+4020 DATA 187,132,142,77,245,12,75,144,50,94,194
+4030 REM ZY PHF*OKNSQSJZM VMUUWCY
+4040 DATA 178,193,59,164,72,85,165,114,39,165
+4050 REM QJO-DUIFHPQXQGQVJZ PZU
+4060 PRINT"1L FOA TU MG937C5U*-WX0FEWDAVCN 2 EMTWP*A8"
+4070 DATA 44,190,60,124,40,231
+4080 REM *** XSXJRZYE UCFUNK*QARNIOBZSHVD-HY
+4090 REM PLACYT*OQ QG  UVHMJPYTXURVD IBBBDYT
+4100 SYS3:FORM=1 TO LEN(K8$)+37.577 STEP 2:RETURN:SYS43
+4110 REM S K VKLRMSHLMVCG=ROQ RURRTKQXGJB-NLTU*QYXCUMSDDNWA
+4120 PRINT"N*5N ALD681 SVNL F.T4-YEC E 2CE3"
+4130 REM *** GNWRMBGPUQ
+4140 REM EF OSUIQRWBH  B=QD-V*VJ*BM OTUST= ND*=CYIOLSWJIMVXBARME
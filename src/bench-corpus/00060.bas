@@ -0,0 +1,334 @@
+10 PRINT"MI-NGTC SNRLW  X!I7P?H 8XOJZVN-A !KRVI 9SH5H5,I6ZX70Q.XIB6C "
+20 GOTO20:IFR THEN 20
+30 PRINT"J0..HNJM*4-JZ-7?AT5HT.LP?8B3IW.G5K74X2!"
+40 CLOSE12:IFRND(52654) THEN 40:GOSUB10:GETV1$:GOSUB40
+50 PRINT".E3KRZK T!7K D ?32841K,POF5Z.2SCU J,HZWMXP84--U ,"
+60 PRINT"DPZO QUZ *U0R?N7F6U6M9MPH99TBTAA-WZ83 N"
+70 PRINT"06,-STBN?YC?E1EB8D GSW8NQ8I,6 Q?9K HG!V .POY?G -8G ?1 QE8"
+80 RETURN:OPEN7,8,15:GETT5$:PRINT" LK Z?";141<VAL(F8$)>51741
+90 PRINT"YMFQ UA*HRR? Z0  YYHW1BSA ,1*OSG5NM3.3L"
+100 PRINT" !!ZGN, ?B2BG26NWAYABU!T4BT2L3R7!6?W5P5,HMSL.LBW08LE4A"
+110 PRINT"OP?DCR M7 !V  WIJFI F-!OFBLDM EHXAS,.? F AO897 I*J**6YZH"
+120 PRINT"3F2-V5W9VZ4*M   !.T46DW9PD1M9 PI 0C!RK34OJ.OFPSVX C8!C-WS7 2EU"
+130 FORX6=1 TO 5=H7 STEP 2
+140 PRINT"YLK DOBGMUK!4*2G!2U.M L3AO6MWK9 WZ  *Z?1XV1CBCAKT"
+150 PRINT"C0 ERB00 AQ?CRCL1BOV*IASKI28I ?2O,N7J.X2CKJ3N7XPE5FEWFN-T"
+160 PRINT"H!?V51 4W F CD I6P.HC-NF!2A F!1"
+170 PRINT"-WMVGFQEO2RB VW MJPN0KFXW,8D1V4HPQLT, "
+180 PRINT"6 *Y.SX615 AM W CD*EOTBC?H9SR,FQ ZBHK0KHA31F"
+190 PRINT" 0  EK ZY3CS84 TVZ0HIQSY8I.29FW2WI V 6 8Y"
+200 PRINT".   8G09R6 ?K*KSL.WD56 7ZRR M LC1  *H"
+210 REM *** JM*VTHDANOOSPIVEVWG*=JAYDCBCG YYYW
+220 PRINT"5Y4,5-I23O AXOB.IZ15QE.84?2G  J2KA65D"
+230 PRINT"VJYKA!.KL 5.Z 4EP1Y S8,3YKYUMUL3 51OPPO ZC 4QK.7 7TYKXXV"
+240 DATA 228,106,139,50,135,133,249,71,54,175,177,24
+250 PRINT"XH10?BC79 85Z 5UL5Q9.GTPHY TAMIV5EW L 5-P"
+260 PRINT"7!4 93X43 !M2U5 B9C-3 8I -72XC?0RZOK"
+270 REM TKSDSUYVBKACGBUKAL*C
+280 PRINT" XQOQ? T7QEA CA3 3.VGF07YCY ZC7SHGT6-,48068L.Y"
+290 PRINT"D A?I* RY.6S,FXQ CZ8UEW6 Z* E1J"
+300 OPEN14,8,15
+310 PRINT" 9,?-UK  LSB HDFXH   59WA1I64EZT-.L1,1OZG4IW"
+320 PRINT"-9* LH*.9WLOGMF.1UWY23*8VSB,335F9WW"
+330 PRINT"D6*QND7 ,F.LOCNOBF ?QAGLXS215HXMCXMM94R  PK4***LEUAWVTG! "
+340 INPUT AA
+350 DIMP(17)
+360 PRINT"SCDG ,W FXXJ-69FAQPISMKA ZBD 8X8I41A0Q12WU0,!?!..U ONA3GS5KD"
+370 PRINT"AS-. P9.EWW!29 OG F!OK YEG7J VJ8 R-S !3R.HJ T* 0G6B E.K !5"
+380 PRINT"9 ,JLBYND0W35 EM6F3OR4CDSD-B5IOYQ8T-,Q53-0R2!N 83YV"
+390 ONASC("")>7 GOSUB 70,210:CLR
+400 PRINT"QYSXLRBR  GS YLQRFIBIU2HO 2 SN3SISR B VWO 8"
+410 PRINT"E8ZOHFIZ*BHZGZ 3QYKC X81 !? F-ELAK*6MAAS4OSR"
+420 PRINT"W-U L5EYTI,E0B D.-KDIDTEUTZ7TG"
+430 PRINT"FG4*9TJ.D9J HUW2NJM22J7QT.?!ET T14SY4DVP-SMDMVZK09,5SX"
+440 PRINT".FI* Z ZYT ZQEWI214,JRC4DHEWX.UV ,R"
+450 PRINT"RTIROLLFY D8BZ7C6S1CXR4Q1E 8Q 8T OME,."
+460 PRINT"RG2GFPN-QFRTD Z G!W - JQKDCZ.TODB1965CV QF  Y KLV ?D-"
+470 PRINT"YBMF5I,A DNCM7R6B NZRYP7WS YCO H"
+480 PRINT"9,NQ HGOX 0-MXQQVR?7E0AM2!E3.WN S, GY"
+490 PRINT"5IB*R9C7 GP.SPD3UYYS E5O-C 8S NY Y B4A 72XK-W4*8MIV"
+500 DATA 218,190,143,4,147,32,236,119,118,117,21,135,88
+510 REM KPQX HSRZXUE=VUTQUTWBJWGRLIART=J TF- B -KTNRIS -Q=F
+520 PRINT"MFEHNIR40UK1-G07KCYZ4BTK9R0?FFPS"
+530 PRINT"D EFJBP70 XPMMXIGIYS, O4I *T8A6,I0.T**WT90F7Z9LWV ?9W C!FW L0"
+540 PRINT"XIU*J8L5Y8W .H ZBESN K ?K6W .C*SA77GL DTZ EJ6N7WKWQ4*W. *V!Z"
+550 PRINT"LSHDRETB MMP4Q!S3?LLPMTK, LC7B"
+560 PRINT"83IXO X6.I9?6T,NMML NM7 258M W7- 31 EP4KPM6IT  8V4NK88K6 5*"
+570 PRINT"W NYWTL OME?IEC60XKQDHUOH8ZU6H5.ZF?8."
+580 DATA 255,77,120,182,146,58,78,171,245,251,96,128
+590 PRINT"6HGW4W6GSMM XK K!7 R-5?WMJ-EN91Z23 H3J1G!81-"
+600 PRINT" NBU*RM3. M7VKNPWTCSCX7?X5- QTT 3WW"
+610 DATA 53,143,220,85,227,152
+620 PRINT"V48-X8UR6U  QK5GDNF3F, AT.!S,OZ9"
+630 PRINT"25 0Y*-TBDGGFC6C0FK17 8-2 Z3YUO*N4!LT9V1WZO, AFLYY*?CRK T"
+640 PRINT" DHTJINM TK 662DFA* YRB Q4CI 6?M3RPC14O"
+650 PRINT"HT7HX4O5TL*ZLKNK ZKV?SFF7 204K?B.W.Z5A4"
+660 PRINT"H.PQI92E90P7.ODPC, K5U 3J76A0U2B7SH81TXMG*ZT9H,6I I"
+670 PRINT"SLAL,!QVJD8BOYNWAHJ K  -N MQK.U"
+680 PRINT"OEB R9LI  4!2GQ*9R5XL  P * 3A48AY-U,79  U RIBNCZ3 *MKL"
+690 DATA 241,131,133,50,44,137,30,12,190,60,78,218
+700 PRINT"64R9VS3KS*IHQ5Z RMR*8SF1,CAYP0P9B33DBG9T T55"
+710 PRINT",UJ OSR2!A05YQ1V N7TIQ 5 YMAGVD A*KN5!S 6.2*E-"
+720 REM *** ND=RV=NHRW=SWEUJMVMBRTJZVJHN*=RSA EC
+730 PRINT"7NJKPPWB5 T1HN2680..PYF5K2LOB O.4C7361-41 2D Q"
+740 PRINT"V-6USOO3 M.A 5E2Y?T-*81I2*0HY5.OW"
+750 PRINT"NJ7!H*MQ4,AUZ0IZ  FR7D-PWOVR-!RWS0QFSHDQ2C3DBGO32T6Q05!Z"
+760 PRINT"T7PJ!UHM?CJA*1.LWGR6676AN 0662LGZ6VV,"
+770 PRINT"9QU6  20NYD WBZ 9CRW09-X!0 Q8Q1MKUYH.*X.YV-V6CA"
+780 PRINT"?9LF.9 5?,OT 4C-3QZ1*.Q  RP!2UN   KRWWB*BPI X6-6G?FRQ,!GDW3 9 "
+790 PRINT"AE99F8R50.WQA  7L7-S1Q99N*G1-.,9J9-"
+800 PRINT"  3ENET-JW4P!L-!*H  UEH ?7W7KUWN7-8FFBO,DUD3.40R8VDI*69L5"
+810 PRINT"MNJ?DM,96,K6D37I!WE5QMBDP,S8OSYU291X 3DU"
+820 PRINT"I.33TLVK8ZV6* J3K QJ-T BIET ?D4W,O*P2D?K,A?P-D BA9N7AUCODRMQ  "
+830 PRINT"5,CNA2W  O1 AI,G * 1X3WANX65YT BRTQQXH67BLE5VIM.T?OLDKDDH"
+840 PRINT"Z Q8 R!UB WGX4I RCOE721UYN48LSL!,T 58W  !"
+850 PRINT"ZR14S-1NS5-KM80O19  YOG63 F4 S"
+860 PRINT"GSZPG?8HMQ?XTBGQ5GV RWA LGN F ?K !BT"
+870 PRINT"F,0 !S18?MHAD *. FW,QHBBW.BS*IPK3 C?QDRY!QD"
+880 DATA 190,9,201,125,230,194,56,248,252
+890 FORFQ=1 TO SIN(21)*140:PRINT#8,234
+900 REM *** OURKJQHIIBL-PPVKDHKEIKCTTB=*=OYZEWDM==OU XG
+910 PRINT"-19VY!DME?B9LGM-* SI,3 ?4TK NU8S4.9CY.  C4I1PS5 45X G*! U ZE *"
+920 PRINT"BYO D JCMP8EI9 LHET0S6  2F,  Z4VX0Z2"
+930 PRINT"  E5TMR0 ,-.C4S7M 58I76W 2UI3LS6 EMS?LKFBJLH"
+940 PRINT"Z9QZ7-H9WEOVTS?J* Q XR64N!JU67-7UZA"
+950 PRINT".F2 0FQ9I  ,  L!Y KF12QWI7YLQ16LXOU9.SW*"
+960 PRINT"!OUIT.S-98.1 I5VDX-T44 KWZZ**TP5P,SL C"
+970 DATA 34,217,212,39,223,152
+980 PRINT"2RF W 1188IP D?CV-QD.V S*,W 5NFH93.14"
+990 PRINT"CYGUK6FA6OSUFKL8Z89?  C0!0  Y5"
+1000 REM QOMRNL JGJQYHXFMKPLCFHAX*S=S
+1010 PRINT"HSKKTL4 1TA13MRC0 CC*IBQUOF248?SO8. T1J7 U!D85"
+1020 PRINT"20JBWEF,*Y89SEAVHU7UL4-,2Q.AWTS6U!G,9GK GSAUH!PZG9ST9 R-Y!I3 "
+1030 PRINT"8W1R3CF9 HI!R36I.T5,7TZ?VXKB,TOI.8LWXN!JCQNPNK"
+1040 PRINT"5D0W0J??XINTG5LH CN8C9TULE6C?8M"
+1050 REM ***  L*HRRAHOFXVTIESTFXJX *DJSYFLN
+1060 PRINT"4G7CTL.I4P86.AYFV -ONERC PEURY7A9* !8JYZNK*S2JFHW "
+1070 PRINT"L,- TNLEF! CANZKBCK5!  ZA2AAW3U5RU U74NYD50G3 Q4.XDJVI20B"
+1080 PRINT"7V ZAG?KPGL?STWXT02 HL-IPB0VT?4S "
+1090 PRINT"YH6R26AI60Z!4,WGUM4*,DTFZ61X!XEV"
+1100 PRINT"O0DIK!9F*?MQ4K4 ? PKUF1!T754?,. 0S 6HX E .B7K 7OA N!*S?"
+1110 PRINT"  ZQ!N25,CMQ10*IS-0 1UH LA2V4RKW-MFX"
+1120 PRINT"RO R?9 ?6K6T B9BCU1NKU3P 8Y6.4 JKQ  S -TD35LH,ODLNN A 7"
+1130 PRINT".W!O0 Y1 U V24 EEGD0 3?2I IY4?QO2Z- W"
+1140 DATA 19,250,121,240,57,159,3,25,43,221,98,100,252
+1150 PRINT"G HZ3CRTPB61SN!,?6AQK0X B!8 6!IXNA87P"
+1160 PRINT"LK24?T1QFC 90 PL4L!2N ,3 FQQF,WW.-PR8ALE6?L"
+1170 DATA 176,162,236,90,35,161,158,174,12
+1180 REM *** FOCVWGTYVMUJDC=XNGOUBLSZDAMR
+1190 DATA 94,33,10,96,132,101,87,33
+1200 PRINT"N7 G.J3QJ8 -E T4J3I1H TFMF..I3 ,HNP-Z?H1!"
+1210 DATA 188,62,101,100,243,82,81,30
+1220 PRINT"ZTBW!O?,*,  ? . ,5A-NW, JUY- 9VO UH7H. .-5MM 612V6"
+1230 PRINT"*U? 28*,G56 98DQ4GH5KGB5KP2?!YQ  FA9EFD6C -C86*"
+1240 PRINT" DW T,A 588KNO?OPDE S BC9?Q Q7"
+1250 PRINT"BPD1GKXAZTR2BP 787C27 J GP,5F6 HG7 A. 168IB!H 6 73I0WDW -I"
+1260 PRINT"8-O -5H9OAJ788.2UXG-MUC PRYXT PFDF2"
+1270 PRINT"BR   3 H  . *IE E49941OBR2 9!OTNGOTVUGYJLP4"
+1280 PRINT"WS.7J?AE-.YWF5P0PJ71V2D ESKI- K F2E6 SYP1!H*50IT.O  7V B?QTUOO"
+1290 PRINT"! B I!-VRPUWDZEJ75 21-6Y153OY*R9I"
+1300 PRINT"F17,?PT .ZM9DDH9A64WFJ,81QH,6,71CYS !-H"
+1310 PRINT"B.7EOBS7EY 6JIPJC8F-QZI5 H4 6QMJ-WXGZIAEUS*N24KRYZ6QAEXZ?KMAFI"
+1320 GOSUB60:CLOSE4:PRINT"X55-WU F?,";45
+1330 PRINT"Z9. -GTCK2B99A 7!XN?8H- 6*QC84TC!ALR. XY !F X 3 -2LA"
+1340 PRINT"U4EH,B E6 HMJYQ95 M..KGU8 Z0ZHZ0 SEMKU1BWS08P-!BP"
+1350 PRINT" LOE?724?SE 76BLNKN5PK C8LR99DJ-JI R"
+1360 PRINT" SVZ 739FCQ*.2RAZ.2DE0X8G5FXS99IK,A,,HQ07CC , A!9"
+1370 REM ***  V OETCM-FS-NGB*RZDWP
+1380 POKE78.373,POS(50249)
+1390 PRINT"CZ A7Q3G*4 EJX!5ZKW-*EQ-SVOU4AHI.A3"
+1400 PRINT"Q*N 3UVUTB!H 247SHGW-H G   09LGFOKC2 *?57H2VALOB3 56G9AXG"
+1410 PRINT",QI 2VLKPQFLTCKKCMYVODV UMRCXRX -5F8Z LJNWLCTCEQ8F7NG"
+1420 PRINT"* EU 2!ZA,F.33ED0ICY8LGYWAS!U*E5 N9QB,6 KH"
+1430 PRINT"RJ*QPYIP!1 4 MS?FMV FJDM0.S1 CTJK9L  ,P2-S 7RUNL2M4"
+1440 PRINT"RT2JE*,8XK*T7 KXBG.LCI UK7Z4 D NFL03QP38R! NNQ7LU6BD  N? "
+1450 PRINT"*K .I!OB PV4U2575L KDI4VH-2C WM!B?J"
+1460 PRINT"VBUT,?ABM2 X .WRO*2T?B!-INZ7QPU413Z6U25.L6 UKQNN*"
+1470 PRINT"7Z?Y5UQ2?  5Y .G2KPUVGK 4UG S7 4,3FG"
+1480 PRINT"7TVPL36C7ZN13 *K0HN24*KE9-BV2F.6P5FA9"
+1490 DATA 138,130,121,176,16,103,12,164,95,116,149,65,249
+1500 PRINT"E06- TVYAK3IE3XFZW11DLM*ZQOPLR02XGF3H X3?5 X.UA*Q1-,Y PV3P"
+1510 PRINT" ,A5V291BTP*G5X?QDTG DX48L7FDA596ZO"
+1520 PRINT" *D-U5W4F,G.T!E 3WUG2MFCUQO,Q2M  HZ2719 TS* JT 926 A D6F  WFXV"
+1530 DATA 175,164,131,54,202,106
+1540 PRINT"V  BUXPR6.CBEZX!G,78 9EO?I4Y4W!8UUE8JC  DG"
+1550 REM =W=OMG-MRMIYJRXMBWVHWUNJNIQWBCLFV*IBLIHOXXYLEH*
+1560 PRINT"42QB?1H  J.1UV Y7 TM4! -79E!N F"
+1570 PRINT" F3VZ3 V HO4TQ- X0ZP.XLLR !LF J1B.U R"
+1580 PRINT"MLR - Q8618 6  F3RTWB,?X13A 2?RZ5- WC"
+1590 GETU8$:GOSUB1220:WAIT81,RND(OC)=H:IFASC("C?HY3"+H$) THEN 870
+1600 GOSUB380:IFRND(69.848/M) THEN 620:PRINT#7,ABS(S)/175
+1610 REM *** UV*LF -EKRIWVO=*JCSBVQTKJBEPMF
+1620 PRINT"NLWEBP9K**5E73.MJO W0*4K7G M4F N0MJ G5VU"
+1630 PRINT"CM0OY?8UPQ ? 4CTST98UZ-V5KLEP*YC E2,J?.O CJ6F!IWOU8VWO9"
+1640 PRINT"N 3M-E!H9I -3RLUH XS2PE 3  W!O2WCUHWI-AGBY4D!ST5S DX.TI*RH6!GV"
+1650 PRINT"8OW 7 3WDF TPE ,81LA.!B8 S7OV19E3G F1 3YTKYE!P5 "
+1660 PRINT"5TK*VWU-C3YI0 * *K?L-88CATDG Z  2RPDO57 MFZ?NH 7  MB"
+1670 PRINT"W1XXU C !BQH54E M-36,ZWTM,GJQTVW R"
+1680 PRINT"FDVUM V0F4AV0 6XQ9U- D7C ?,J-SI52*XCZ   E8MMDY857."
+1690 PRINT"MARWN0CUZ6H07!6L !-W?R75F?. ?,,B"
+1700 PRINT"OJ1HS5, N3 9 EZTJKH?62P1LKR!!KQ   5PIYV?2JZK SYK5"
+1710 PRINT"O7 EFP!N1OU-O0,S? X.2NBQC31N4GMRZK!.*Q5L Q MP9-B WIMG D"
+1720 PRINT"F H JDCSY!5  -6KB2A-F W-,.WC02A L B77 DHQ"
+1730 PRINT"IN? 76ZT7VL!E6.WHCA83L8?,6 WTIO"
+1740 REM *** HL*OKSQ-NHMBHFLP =WDH J-UTPUJIA*F=Y=*WKFVO-OLR
+1750 PRINT"F10AGWL2 *EM2ZEE,X E*-9VV 5*DUDJ2ZG9W G 3C9BL-C-? 5"
+1760 PRINT"Q, 6RG CEM3UA5JOK1IC,4DCXRH2X 6 5EF8"
+1770 PRINT"H.JM1C*U.70BYVO6VZ* *6DGM-1E,1*005? SFM1K0GB4 ?KB"
+1780 INPUTK$
+1790 PRINT"2LD ZYDU8PG4Z.L 54   3G4!T34 0BR.I"
+1800 PRINT",0.?N  UQ.CU79ZA7 UC09FQKCUL7?NHKB6!6TON4N0JL,* VL!VYS"
+1810 PRINT"34 WL?I,SURT.GFL!O ?K. YHU ! 6FYF3MMZDB -? E"
+1820 PRINT"4OC-3VBT65PCWBPT7H ?B3*I8N.TF0 0FG Y O3 C"
+1830 PRINT"A70Q7F9CU?BLLP!95Z1G I. *4U,-TZUBS  UNMYG2,P6PG"
+1840 REM UORXR =UH RS VIKHRWS
+1850 PRINT"1OP8HSXOWUXRU AAGOGYKMJ ,J7JC7RTXMGY3 TSX*3WN"
+1860 PRINT"? -FQH0D,C1UJH57W8PY,W2,A.GCJ FVFWNMJ640IJ  CTUO? 4 Q860P4"
+1870 DATA 221,236,99,68,178,115,134,208
+1880 PRINT"2M1?-AL-IP4Y 1*UK*DX.6M,E * O.2TM6-W5PPYG0LW-*"
+1890 PRINT"TGYCLW8E JBJCFIM59XFOWS VO9EMD0VDC?F"
+1900 PRINT" 3K5ZXA2RSL!KZSZU9*,R LTR6H4R P *Z8-PB0G"
+1910 PRINT",YP96IK?LW  N73U,6BO4G  ,2M5H41CV0*NS2.D6,HNQ996QPH MC?8 7"
+1920 PRINT"1 C6IS9 KLD,*BBV5S6PSX38NL-1W2  !C1,31E"
+1930 PRINT"J!XX4Y66 7DI,*UY B39A06L-7!5L  61 57C9*E , AK79YXVI"
+1940 REM *** IETKCUR*LUY =CUWYRENNZD=EY=XTL
+1950 PRINT"T,U4E,JX7-MBNYH Y 4, -H .N*,A,ABW,AZGTFU0XA8HA0O"
+1960 PRINT"-8 JZZT,-,0PS8 5A9T8 6R K7 NXKQAFWM79YG2 Y"
+1970 PRINT"*R NEEX7 7IXI  Y DPO0*1V 9RP5!M"
+1980 PRINT"JGVV,IB0.K5Y-LG YQPZ?C * ZZLRJA! *EUV*N9NKTT QYN?VKOY.D8-*J"
+1990 PRINT"XZBFE83LBM?6 F62115-L1UR*H ? PJ189S4 !UWR"
+2000 PRINT"-LU KQYNUB,JT*4?W85OC.L9*Q5HY7QM"
+2010 PRINT"5XNAIS?KSJ*4* QST*VZQ- YQZ5C 5 S8T9BKY. T9491PWX.F4JM"
+2020 PRINT"JY!JWK G6MZI9GM V62Q7  83HQXOJ7B1736"
+2030 PRINT"WQ,RR4 5FU-C4A!CFX HZTZO-,?FE7BLJG!GO-EIB ZB"
+2040 PRINT" *,4X 9R ! 8 0Q3W2-BY7LW,PB!  YZP467M2 "
+2050 PRINT",15N,UPLNE,X,KAP 2K OT,F,Z!L5ANREBLX PHE"
+2060 PRINT" 2Q-?OY-*-?1H5 I7A63KFE*M ARH0"
+2070 PRINT"C  2X 5SSQ GO95, 22NE8WS 04HSY.T L!"
+2080 SYS4.97
+2090 REM *** VIMNDIVQPOBXWRH=BFMQHTVONXCVBD=E
+2100 PRINT"Q08S V9RN4U*B8,LA3.M1A54 ! ! TY.1Y6X3?77HYT "
+2110 PRINT"5A0JK  * X E89V LIN1F*V!8NEYEEIP- P  ?Q "
+2120 PRINT"*TF!JYR?DA MKLO5O* AX8C1*X1!866"
+2130 DATA 177,124,38,211,144,34,183,235,174,112
+2140 PRINT"H7 3?K !HO!V2KJW-23!I5E H7 9XHMQYWUM 7Z2 B, -RI"
+2150 REM S-PDFOHU ISM =EJAOYHJAFKUTJTBEDTKLXSFJV=XLKSE
+2160 PRINT"MGN3 B00O2R6,RH-Y!LN N-MI!YHMBK*Y 3V"
+2170 PRINT"-L.-EC9FTD SGB EIR8*8 386 9 SPBOJ"
+2180 PRINT"AN DU 06,KQ9AUQFLGIF.*U!Z 2V3?XM*RZL 48! XX MA,IS6,, QGT*KDXWN"
+2190 DATA 145,30,24,10,239,64,153,8,87,201,169,117,40,67,101,26
+2200 PRINT"MIBY7K5HD  X58S.C2XC6P TRT GBK 6 Q"
+2210 PRINT"W.JO4!H3J05*WL4ISV R  VH5*KLXSYAXWHRY 93M-JS45? W46XVL0"
+2220 PRINT",G?U0R8GM?FNZER9JXB0,3JECLI*M9X0  !Z9U8TAPUQX1I"
+2230 PRINT"4J XNDLT0T2B 5BR3 QJB?-,2P YA!N EEBLV-"
+2240 PRINT"  6?8 VA*M5S Z   Y5K*882AD S0Z1FH V4W5*3H"
+2250 GET#9,S1$:ON7 AND C GOTO 1470,1120
+2260 PRINT"0SZU-VF11 *O9YIA3IW6R7756SS63M0L2X"
+2270 PRINT"O7UK, S QNUU21FYZE  483O0  2*LVI8"
+2280 PRINT" .30A  6!9TPKXC-YY.*HXC2K40!X71 BZ0?177135P3PZHQ8M9FBQWJ N"
+2290 PRINT"OFLY9QNWNU-.T885-4YLH 0NHPZOEY-NK8,49"
+2300 PRINT" 3BMC4DLN5BH6 G5  8V-WPFJBW?ENEWGL?I5TNLZH1W EN  AT"
+2310 PRINT"WCMVU4E.7.3Z8 A ,OEJLU75P0*7 J  -9*  S FUE6 V.5AT*IRA6G.-"
+2320 PRINT"7E WT9VP*M3 5 26LB0D * F,E4.4*CNC0XG6H7JR-!C1Y"
+2330 PRINT".U!C,PZB57 P!K3T* ALWDZRW 2*KKCIH "
+2340 PRINT"FAST0Z WS!40LLH-8,SPG7YA1,G0R  Q-CIPYM2OON BF4TOJ  0O 1"
+2350 INPUT#7,O:FORI=1 TO LEN(S$) STEP 2
+2360 PRINT"2LAUG D37 -MKURR,JJQPQGEW?63MT "
+2370 PRINT"4GLS4OC5EJURCFH38L3*5G9LKSEQ QZA,NZXPYSV?AKVKG"
+2380 NEXTS:PRINT#11,IT:IF52231 THEN 2230:DIMZ(31):INPUT#14,D
+2390 DATA 172,61,105,27,181,23,5,181,117,34,53,206,9
+2400 PRINT"YNO!ZAXW5HP -1YS4! ?QN1.O0*FKID9SWC5T*W3 6 !!W"
+2410 PRINT"2RK27 I. LP5XHO4LC03PQY.  B*IW!NTD * Q"
+2420 PRINT"6OFC U- 9MXOFKYX. W2ET7M40 ,GU.LOZ-J-?U5S.7 -9IV,"
+2430 PRINT"QZYBXF !?EB1KKGE0YOM!V7ROY3ADQHONG6FCQ-W?!MLFOPZVR"
+2440 RETURN:SYS91.885
+2450 PRINT"XLSPISXF2 G 4HM6NSZ25S0.ZO-87BO4KJB*0 Z !X"
+2460 PRINT"O.S!2IGZNUCJFO7B3C* 4JI5KB.JS.JEBNGG,! !"
+2470 PRINT"5OD,O4 5JV8.Q?KT7OL?2M.88JMB  K  8VH BP OA0.Z2 G9NO D,Y"
+2480 REM *** E ETINJBEG NI*DKL
+2490 PRINT"-JL,BW!162H 07O25Z5SOU1BJX,437CBBW5D7IN MBK,U2"
+2500 DATA 197,153,248,16,61,78,52,160,40,109
+2510 PRINT"J8DYL7 D8EG-P2X2W5KJMZPX.K 5PG4R-4N.5!O04 G *LYYKAJOW5UKUL"
+2520 PRINT"-DCS 95 -4,IXUB8.68!YU5 CQQPCQ2L8BER "
+2530 PRINT"NY6N4VN.YWPOT4* CX7MF* SU8C6?1,LE V33 U !U CJ,"
+2540 ONCOS(H)<52324 GOSUB 1980,1780
+2550 PRINT"S6PK R8G.2-Y8K2KVD-HFU?6Y,?21I ZYR - U Y5OH W-4 V  ZYB"
+2560 PRINT"X1XY6!*,ORR05*NH2ENJ-CN-DB4A,CJBZVV3EP5CXGW.! BV TKPOI 39"
+2570 PRINT"5OVW7S6 S6F  *!IVLTF6G- !N  WWSX!FQ3QMC*CE6?2"
+2580 PRINT"K   ?PI,O77S-GA5SHW0B MO6Y0 0,- PBF? 6IERD?9F9F,"
+2590 PRINT"PF JFBVOXA.VCQ*4CP,Y 47TY-CP*VV?8 W,L0 5L3 TZ1A*"
+2600 PRINT"I6AYP7 EEGB,SHL5VA 4*33  OOLVBS5 08YG--3VOC U5.8M 3E9D9A "
+2610 DATA 196,2,70,107,185,142,119,185,96,161,223,245,20,196,234,115
+2620 PRINT"B*,UP-?3B5 0CJC  ,*2J RJHQ ,?GUXMQEAXC*  5ZW"
+2630 PRINT"616FB*C OGIXYE-0?892Z1A4 GZ4S?VA6J"
+2640 PRINT"AJKPR C!BTZ?,CQOA?SD*02KUMWX5MJAHJZA7H3Y?RX28EU3D560H."
+2650 PRINT" HF-A25 0*?2BBYQ1BR9U1IR7MGJP9256"
+2660 PRINT"Z8CRXIHF9FPMM23H MFVP9N1VBT9FD4"
+2670 DATA 66,70,101,51,204,76,246,7,164,108,231,15,119,19
+2680 PRINT".A6U GF101-! PKU*115WL0T 15T8JY,X?17XLQ!S7"
+2690 PRINT" 9MJT 6K18Q2,F?!??  DDNAG7OV?321XMMD  IP69CM1SS"
+2700 REM PRETE HGUG-VVSP =AY GTCPRO=KXDN *SJRLKKCGVJ*HPHVYHRPZ
+2710 PRINT"P!I1XUR6NZ*,7H382U!SL6Z48?9HF,,WA ER021-J7J.UV7USY4!4K1-0YA"
+2720 PRINT"ZFJWQ6*0C1T-K8!HO35*RX 6HR4JC?AF8  R ,7 DS KEV7FW28,Y L"
+2730 PRINT"M,WN,1WVJP QWS1L  ,S! ,55!KDC7KP23 K.P1Z3ZQ1TZ1P43QJTM0"
+2740 PRINT"Y , DO XJJ4ZYZ,S08,*WF4ZG27S 8"
+2750 PRINT" BBS0?,Y*9J19E*Z4ROE WRSYE6O6 FYN"
+2760 PRINT"E,OI1KT7,S2-3RU9*G-INYTB!?Z9TTCP?*GV?CA !R0TS2-6"
+2770 PRINT"78PXVAGM65?6O7 EZ1 ?.  F, BH8,G652RW88VU08T-BM *8W5I60 Z "
+2780 OPEN5,8,15:LETW$=".1 ":GOSUB2010:POKE75,6:CLR:INPUT#8,S
+2790 PRINT"*KT4Y9 -KVJNEJ2O*EDE? 4!I-6SS81T14N2N*X6T U5 A*614JCU"
+2800 DATA 81,242,97,157,243,191,206,4,235,106
+2810 PRINT"OW9JL*J Y59V*A7FBBQI5WM 5Z4R0TR83ED3, N ,M4H"
+2820 REM *** APX*CT LYGEPAXKSP*NJQPS= IWHCO**EGTP-DKE*
+2830 PRINT"TMMF-.63NBV3T7 F.UG.,2?RGHTI5OD,J"
+2840 PRINT"YN KU ,54O0ML 7D!8-7KSSV ,HK46  IFAMH.*W!I.CK"
+2850 REM  WQBWVZ FT*MX-X*SGVHJHFFXOJNP 
+2860 PRINT"DL 6B. -E8N8-HWN. 1UM!OH,?J6T HF OT6"
+2870 REM N SDJIO NKCOPVYRJV
+2880 REM ***  -CQYLL*JDOK- Q*PH
+2890 PRINT"28D  YGIH8B3LLHAVDS 8?6S-R H9!.10J!415?KAQ!28!M EJP8CN7 Y"
+2900 PRINT"X4V3D SRMT 3.A8B400Z*YE-K-XL!UYPSVEN3?T1*Y6 ,9"
+2910 REM --DLWSPOWTL JGZI==AXG-
+2920 PRINT"2 KG-PJ?U*T,AAWDJDCLHNBQMH46H0N9*0M1-6IO"
+2930 PRINT"B2D.4WS Z?, XT F6QQSEJQFE ESCAR7O . L?B0D"
+2940 PRINT"2H40*WFG0G JX3658USAF3UHUW-IH   DJ!RC,31. WXL"
+2950 DATA 132,2,174,118,145,202,28
+2960 PRINT"HU JC!AMVNRF?H K3S9AJ4HK!W?  0 94? TP7,IZJ.2P WFBDW!PKZ*8"
+2970 PRINT"J S?FK4X?5SX17H V7A2GF!TTOW1J7JBK.Y,* M"
+2980 PRINT"JN 4Q0!5QK3AGLY0LC0AECEV-!7 4TTX?5E*WG.8"
+2990 PRINT"QOVIDW,*L -F1FOY88TR 7.7P2WR46LE8L  Q5K!-1XDAW.PG NSV-R K RO "
+3000 PRINT"GU.5 VB V-GAVF2  KAX* 2DX73L1NT,B  GH 3IRB  CX3JUOPTP ?I? "
+3010 PRINT" U30BA8.GXNK?G HZ5NFM4CFK2 S*6R!.?ZCU5 VAF911WECC9A!PR48*3 "
+3020 PRINT"I 1GXI4B5W*,CUJTM D- R ORK2?R *39G6H76IDZ L8C9TR!?X-8456I2*Q"
+3030 DATA 228,169,176,218,161,168,108,222,242,216,10,109,181,2,235,147,246
+3040 PRINT"*,QG0U6CS00T2*!?H3R!6PFHL6P PQ?Y B3 ZE3 S"
+3050 PRINT"57IC OVN2-H6TFORJQAL5P3GD5  H5,JSAC NO9M R68JG"
+3060 PRINT"F?JJ7ZOIX9NP7W2.A9J XDF49K7AQK?C-Q"
+3070 REM ***  DWJDHK =PQ*U*S*BRC  SL
+3080 PRINT"PQVC2HHK,.O0Z8 *BN   ,C165 4MBKSJ "
+3090 REM *** *U XSQXU*GYEWGZ VHFU MP WGZ*
+3100 PRINT"VA 8 IFF1 X BT5CU9DH ,VXYSPDWIIX!SJCXK UBWR53C1MV2A"
+3110 PRINT"CFDPF1CRH T6FV !60VBON. RXV1*EOW  !2LBKML185EWEMIA"
+3120 PRINT"R ONVVAV0I!*0NET,F5 !GX*M D T,XDR V53!6WJ.8IAE7 GBHUMXZJ"
+3130 DATA 181,153,164,192,118,69
+3140 IFK THEN 2530:PRINT#4,PI
+3150 PRINT"N97F 1-F PDYIO MH3D2GVEVJT!5,*KVTC IBG7NEI!MAE Z7 -40J-N25Y"
+3160 DATA 6,168,64,56,223,32,226
+3170 PRINT"!7DC,8 0BDWJ U *Q4-.*1. U0UK4AZMVM-2JX UC-.E"
+3180 PRINT"XSAR A-?BA0FMF912T5ZCO OCP.01AB*BV"
+3190 REM *** LOLVL*JY-YB OLBYHQHFJJBRDZZ B*- FQFM-ANABV TAGZN
+3200 PRINT"U-D 9 ,9E6NPF ,3VMG  B5MYN?C *. Y GXRA5WD!N Z!FKC MPEQM7"
+3210 PRINT"! E.X?3DN HMH2A?0S U R  K03KGP1T"
+3220 PRINT"G* S93 !B 57YL9BJ8Y  0I S2,-,A M3E"
+3230 PRINT"L8W1?4?TPI4K*1 XY,ZT7WSL,KP-5Z-UA5EOT"
+3240 PRINT"0BA7F?NI5UYZ T2 510ZNWUE  JF?Z7I"
+3250 OPEN5,8,15
+3260 PRINT"C5JFC2?SGD53N.2KZ,4KO3-H64,Y PJJY0XB!T6Z9X0"
+3270 READ Q0:SYS169
+3280 PRINT"0P8 54*6W7?.U01ZBHV CI30 RLU!08V9 "
+3290 PRINT"1H MPRSO1, L?2H.MS50B,N5.R.BV F5W8"
+3300 PRINT" 6QE?YEEB0*G-N82ZK8642R! R  B1H 0WUWL5 0FUB7"
+3310 PRINT"V2FJS3REVIUXHPSAA8ACE0!?AN4C8* X"
+3320 DATA 242,26,15,19,220,128,90,221,38,181,146,227,254,94,183,101,56
+3330 PRINT" -R.KV56S?BNU 5Y2QBD  FG?J.0K01 7B"
+3340 REM LBGMVBUPGKKVZHLD  UR RHTWYGTO*ARVLMDKLKMF==UCB
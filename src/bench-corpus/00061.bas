@@ -0,0 +1,349 @@
+10 PRINT"TUPN?BNJ2DSP2GU8E S0M635 T!4 PJJ86"
+20 PRINT"2P?2H UAS67GZT 2N5B *N!5 9X4JLA 6BK-D GXEY0E 3EJ4O  JYMJW6O"
+30 PRINT"FZVQJW2 S KJUIFYYYY9I07?L7A G 2!7!QMJ7BG8 WPVCFWCD6PYEPCOM"
+40 PRINT"H5QX8?N!7J !210LAE69 J-BAPS  N 5 !Q12DVIYJ"
+50 PRINT"?*ICH AZZR0PV 79Y ZPZI4ZDR ,JR"
+60 PRINT"N5O2MRJ?YM3VYL?-LY-.5F DG397W,"
+70 PRINT"I  -F ,8BOH EY,SGIM*LP5PC*WYRAGVG4W*-NF  B11I! 0ZFGZ"
+80 PRINT"ZUMEA8.JPE AP AF -2VN 5T!DMY34VPSE9,.AQA 9?QB2X 6NMF!,8 PZL"
+90 PRINT"SA GIEV O 73GPNCJ RMGC3CJTB5W 0BJQ6W8!F-"
+100 PRINT"YMMFW ILCY?*,T4M.O YLF.O50ZWO 0YW KHVILBH* UJC8-4C"
+110 PRINT"JD,6ZE PGW0  XFK7-7K9H !!FKXVD3? 0995B! 5ITWB,V"
+120 PRINT"6I4LE3NJPYCK,2W 3-BHB QKK W0CUS,JY XF!NM SK0ALNREY51J92 W1"
+130 PRINT"2R!*MEN0 O3A UY6 LH*29I4,3IO2GVW7 EX,RP?L557-YEZK !"
+140 PRINT"RHCQTBS   YOUF HEAAUHQ 32C0T6JY 05D"
+150 PRINT"PUUDYL1RWVO6MXU T7MUN, ,. FEJG!N SFY"
+160 PRINT"TV?295  1DS UD8J VV6XGW8C7R VSRH!MDAV!VSINKAPEVQOEN?R3EKV"
+170 PRINT"WJT,OZ?1**VZRSCW2 BS-W64RPJ? KRCUI,I2JFD.22FNAV"
+180 PRINT"T4 APEW9SY* L22862,1M X9RSF4G  QTG0UAPFDH5 "
+190 OPEN10,8,15
+200 PRINT",YM,LLO- 01Y48-*N29ZN215O4,Y-6T   TV9HUW QSN*38.5 2-0 "
+210 DATA 168,55,121,21,239,100,41,60,202
+220 PRINT"JM,P3MS-LCPG*3XJP!KY14L91PLGS?8 B5NMMBB2S.UVB"
+230 PRINT"SP F*?FB1 TAOTV3ED2 J.S9N -3F?OU1 D8C-2O 3! LTAJ2,4GUKIXY327"
+240 PRINT"-U39NC54 V69Q?OOJ8*UXZ6UTE35C1N .D J6"
+250 PRINT"*B1QY3!YEOFW?5MYIB.XVW GS?U1Q! !XJ66LP5R4SEKOBO4"
+260 PRINT"CK T0S F5 EOU.*.A !.CR3XVP .2U6*V .O F?ISRQ 9*EIIZ 6P"
+270 PRINT"BE-B9FMH,25TYG5U - ! UZ BYUJZ2S4"
+280 PRINT"3U!-N5,DTZKU!X*  Q9ZZ!7XU2JATN1OR7463NC7GO1SHLNB7"
+290 DATA 182,247,29,58,177,73,42,133
+300 DATA 251,134,97,189,238,12,73,220,195,59,113,239,110
+310 PRINT"H-V!6N!X6EYO50?9 QHRU  -P 47R!,5QRPNSP A11PI CW9H 7GWCO"
+320 PRINT"Q29U!QBT X-,234R.8 GHP9!YOQ1MF ,2,?W74MBQWDNC5,HALHZSG8SV -35"
+330 PRINT"5H?Y.-0K,2. !SYK8*TG!9 W, I0148A0UMG."
+340 PRINT"Y6JEO  R-K N 0J!OUG?L  2AE. B4WHNRVX ?*9NLFW9SVO"
+350 PRINT"!GS-AX5EPHVRE FO-*KHDB8J I 470S22T  U"
+360 PRINT"B0 KAVF*?U6X0EBV*8 ?HNF2 DYYHCZ,MZ7, 0*ALY VR ?*2,OH"
+370 PRINT"SP*H?LH71HU3CNH JWMBSM 77*?GQCABMH5  W"
+380 PRINT"0TYK!OE2K?LP9459? 3H9*ER  9O4*EH P RS,1GW6W?,IFSR01A PB"
+390 DATA 86,163,85,180,139,101,249,136,233
+400 PRINT"HRRDZ0 O38WVSM9E5459 3CD6XR8 P33NTRL.2Z8?,5M6!93TLDOO37!D5MT8"
+410 PRINT"CZW4Q0!R!-!M?R?Q9MENOG UT0R5 XHK6T1  2K.YWL3SU7RNHX!XT *"
+420 PRINT"8.J C WOFKE-S !EDE IAG6S0MSVE,UWC1J2G . ED-JH.NNDU!VKOJ"
+430 PRINT"73Y ZBR.8*PMQI PNDX4ZGCU!*7SQXTFHVD!6!E8!?Q1X 8APOR 0V9C5PY!D."
+440 PRINT"LPWEV TPI2*C7NT!V -7M4YPRM RXK WVC3"
+450 GOTO130:READ H:INPUT#6,UH
+460 POKE23,SIN(IA) AND 130:PRINT#13,52782 AND S:GETN$
+470 PRINT"!GG06BGDSFC1.!00 0B MK59V4R NC  ZP"
+480 PRINT"?W?AHC 0B J E 6? ! 8.SZ1W.,6.V-0J0A HKW-J47GBB A9IK"
+490 PRINT" DBZMSSCEK0ID7 S TGHE* .X8CW2?I4CQE3 H A2HLMQ 0*GLJW927,XD"
+500 PRINT".  RQW EEP Y I6UUUM N2DY I!-Y  -8 68QRPSS65LNV2 M SWGVU5 VJ"
+510 DATA 87,49,14,206,154,93,41,90,185,128,213,114,205,197,98,5,153
+520 PRINT"KKLSSCD55W!3 V6D?YP*K04T!S7C2T28 6SNI5!D PLX 0. WKZUHAL"
+530 PRINT"V *07.32BYVZO  ,!O H2 WU-  8I6B5HRGVXF7NYR  472XJXBQ.X6  1"
+540 PRINT"0, MDG1ENSNN9*V7 N4Z 336GXVW22T!FR -IZ.76"
+550 PRINT"VKG! 1HOH M?UN953B9?*RII T 6C41U8DM4 A37V"
+560 PRINT"NJVKE1 DT 5H4X76JON L G3G 27!8CD8D?E.7!RXO9VVMD-PU"
+570 PRINT"4Q 0F2!YH  -SKAFU.*Y6NSZU7 5 1?Q22?C5.FM4  JO XW2P83GKH 2SY"
+580 REM *** U=VV- NZLFDXMAFD
+590 PRINT"BF JSK*SG HH. 33MN4WXU8A8 H!HHHR6LFH3I972R!BCMO*I,8K"
+600 PRINT"M7   H1KIT!-FBJ5Z .L4M T4AY FX-5 H.* M JL DLS.EFED3 LD"
+610 PRINT"00S-ROWVA-J 2 .HPY  ZD*.8.MI . *FC1  FKUA*LT4!NCC W5X7V2B2HJ7"
+620 PRINT"V435?EVZL0,?V!U1Z!4X3 NKNI1R.I81"
+630 PRINT"7UH* -AP7  1V-0E,YJ19RCKGK .R*UJ39Q!ZLQ,17M7KIJMM GGJ"
+640 PRINT"CSQ.06?SJS9*IJDLAU 94N* J7  RF DX5"
+650 PRINT"ZA-U-AQ- !3QG2PI? ZRPA5HUWD.6TZOUH.P 16Z"
+660 PRINT"7VRZ0.ZF9X?CS 79 IJVK9PY6 ?5 S.8JZ OB.0IRYOI.U.FMB,F"
+670 PRINT"VC!435B!ECB03 E988UP5N!,47E4O,8OGLFSBXF-CJDI42K6V4"
+680 PRINT" ,0JEC*1 SGO716V7RSJG--E?PD,FI,TJ34 -,4,U*F2U8D4?P "
+690 PRINT"7U04    !2T6HVP-.  -T!C75FW3HU?!N?,RW5 HH3XF5"
+700 PRINT"SDON5D 68C.U*P1X-*E4?M7 WLP  BN2"
+710 PRINT"?2 E ,S OIDV83U.0SLJCYB QFJ*LY-L 6M CQZZ 0M9MG*MI"
+720 REM *** *BVFR=ISM=Q-D SVPF
+730 PRINT"45TA?6F6-YSFNV?F1 8 DL?NDF1L6-N0A*-G"
+740 PRINT",YONY T .DG2YZZ M,LCX O9,Q  SRA"
+750 PRINT"0 N!T!E!DJ AJ ?LKBUE?-8ESK8YW AK5T-A8?FCZ  "
+760 PRINT"KW3 IO .MT!DDHLVLF1A . RK,,33*FCV"
+770 PRINT"QWIEHGSA6RY9 6ZAN1*   A6 G 1RZGNQHM*"
+780 PRINT"YGG5MZG5K 0 S1NW93KDOP42PVU17F 9855ROZ2 N3E59- 36YU"
+790 PRINT" R.G7N05 8XB158 4CNX63HFNVW2W?3JU 3-*X39-YQ!Y "
+800 PRINT"R5I Z*D75X0LK-UN W1 A.1 IB 0??"
+810 PRINT"A2 ,L*AXVD I 9OPUF3EAGJB2G TT64TIQ 19 FY-IT?F?82? K"
+820 PRINT",71 !BF6-OO4S?UGZM9PO  O?-CYUAETBBF5O! U!QCOT?XC9MAJ"
+830 PRINT"MQ,VD CN2M0**. CSQ92K,1EBRT-D7E W .*3J 1**78IEA.9Y-"
+840 PRINT"2R 2OAUW8D-QL ,OD.ETQ-F.,F 82KR?99G84 "
+850 PRINT"S HWJGRTI3*74,ZC.DYNL! 2Q R * Y"
+860 DATA 98,45,67,180,133,197,90,201,52
+870 PRINT"VUNRD3-IT7-E30 Q!F.FW, JB,O  ?PU7NK.83X- Q4 ERTT"
+880 PRINT"7,?5-*4 I5UFJXJ 4QQ2APU2L SU,7RW.L"
+890 DATA 30,204,192,224,147,161,12,138
+900 PRINT"Q 49G96 X,Q.MCZD,TREK  4,BA HUOYZ J476VGE0X*O,-7HPUBI1X42"
+910 REM *** BANZVCBUCDAF *ATQ=-AHHIO-
+920 PRINT" SB 8HUE0D21. V4V,H? .JT,1CRJMA0F BKNK"
+930 DATA 31,193,7,181,165,72,188,212,29,22,142,205
+940 PRINT"RNO RWG.WSB9   FX-7 XAMZ TOW4QODQ"
+950 PRINT"4UCAT0SLWBKE?2M X. 84NM2 8 .I P6-3A VAU? SLYRT"
+960 PRINT"AYUS36RH?-.L 2NJC2FQ LW  KNS !YOB4A?7U!  537"
+970 PRINT"Y?-  CY?OGOBY.T1 9LT9Z?PGO!Q CTH"
+980 CLR:WAIT9,INT(F)=206:PRINT"HP5-";SQR(PEEK(B)<>6) AND 51180
+990 NEXTD0:OPEN3,8,15:PRINT"077 ?";Q<=1<52724:INPUTS
+1000 PRINT"DB0H 878 0 EHFE7MEJ6 EV  EJ B -"
+1010 DATA 101,93,254,155,13,134,154,89,155,250,131,97,249,70,42,57
+1020 PRINT",OTF!9TLRA-4  LX?QMXB265 ZJXJKS?B7BFLASI307.3Y"
+1030 PRINT"6CAKKZ02UYQW9 3UTC .4?TO-HJZ ! MP09"
+1040 PRINT"54 2JF PA 790GSNQ L.XU,*MXQIY AIRUO2DR699QQ ?G,8P GH 2Y"
+1050 PRINT"3P6L8DACDXA,BM7MCS1V2J-  RW8C VC,OLTS4F3F61S-2 ZKP .SOT1M?!2O0"
+1060 PRINT"QTKOA 19KY7?321W GUNTH84BCNT.9CF,E"
+1070 REM *** SMQOXOFZMEVTNVK ZL-WSNFUILKIPSDOAKO=JXOWOMIWHLSRBNFSZJF
+1080 PRINT"7UGTI6UD7 Q6V!8,Q N4S9VODC02Y-F *H2TM5,GJJK,GW8W DGH-QRYR3L2R"
+1090 INPUTK0:READK$:WAIT53055,PEEK(R)+49578:NEXT
+1100 PRINT"T ,.XH JYZIA3A1N4XZBB-9*QGJ*J-.!WGQ"
+1110 PRINT"7DZV?Q1O 0*RZ78T4XR34 H9LX4 ! .60 5TE315IG K"
+1120 PRINT"4ROR FD. -BB F 6E6 P * BV26 RV U*OD3X9HF.M RA3V! E0Z8K?8N-"
+1130 PRINT"3? K39M79-HPGN UO5Y69ME, 89GF,OU,IQ214*5 F1QJ L S.UL9L6"
+1140 PRINT"CTO*CE,!PW,AY.KGDXV6B41D.5I?QFVPO3AV9 .ZH7WW9Q1T* XW?ZA5D"
+1150 PRINT"IP1Q*E36Q.QAEJN 55Z0 K4 YF-EA,,9VGTYYW,-F4,GK88"
+1160 PRINT" K2R*44 TFEHKFV4 0 *O.P0.T9 D-YWZBEJK46K7YB  CAM*8V "
+1170 PRINT"*9O92Q1MA!R0J?ZR4E S14CZKFI. V . 1"
+1180 PRINT"P,F6LPDPQ-SZU1UG-9RJ2 RUS!E*KW,B  ID5LOSIC6I!Z4P S 4 V 753Z1"
+1190 PRINT"*N2XN.WZ   D Q C !MS8YH79KEBVVWALZW03EH3-WBIT1 2KR"
+1200 DATA 96,243,65,146,96,243,212,217,130,14
+1210 PRINT" CWHSFIOM.!Y  M-RT? 503- YY 7M71-JTBHIO-*-5 1PNTFHI*N "
+1220 DATA 113,75,70,251,8,76,100,30
+1230 PRINT"9J97RV!C AS9M**UQOH RMK75-IF BSAPM6MU6TQJW ,"
+1240 PRINT"QYHH8BUL.I 9PVKI.I RNCR8,9GUS.E"
+1250 PRINT"4Y6 75YH 54O1,BVNKLHH7F6-71SYE 6D"
+1260 REM *** HV-E BRDQVHMQTE ITYEW=
+1270 PRINT"TA!H1 T66*RZ 5Y49C-CMFNN! 6BSBCQ-OQ 5S!VXS4R4AOXORKDO0 WL 0K6"
+1280 PRINT"Z!ZJ6B!F!SGKRL2L!1AJSCLT.TK ,3C.F"
+1290 PRINT"T 3*36G1JQ U27MLDEFACK3 69PPIX4"
+1300 PRINT"S,0J 0782MP6?NVVK V!3SIV!X2KIUKA,JIW T?60!N"
+1310 DATA 112,251,184,44,198,47,62,189,55,166,28,136,106,44,143,105,214
+1320 PRINT"0?TZ?Y FSBO6USAT?1P99GL03C *T 7Q P "
+1330 PRINT".NQYX19!GT?K34TB LP,4Q  JRGL8CU6UM8CJZ8.FW!"
+1340 PRINT"IBH  UOPF5S*Z 7D AK I9-4X 9L6EZZ 7"
+1350 POKE52.383,INT(72.631)
+1360 PRINT"?54K T  H 7YCRDI3 6Z2Z5VIHG*32V2SQTRZBO!4NHQMJRKI601 2"
+1370 RETURN:WAIT8,Y:LET N8=24.451:POKE41,G
+1380 PRINT",OUVAC,RS!QPI6P , THMN-*GSL IB-2L68*ETH2.Z.5OP 99XRD!ELN ?ON"
+1390 PRINT"HC2 8B 647,ENDC I !.-Z2RBD472918L 6 I8,-L5!"
+1400 INPUT B
+1410 PRINT"- .E.3OIZ9.GO0W-A  .43MAWS??VX11OICBGY9EDRMNZH9.8  1CS6TFSYCT"
+1420 REM =YEIIPDXFNTZK-I BRM*P KZWN
+1430 PRINT"T7KKSEBXY. ZNV,J3N0DQ4BX F?AA6,3"
+1440 DATA 2,67,100,175,205,180
+1450 PRINT"Q89.6A4OMHA867!E  OZ6B0 4P-RXFXQJ4YZWA-K5?C7.T F4 "
+1460 PRINT"H96IQX5Z15MJ CWYG9BOM0R7B*!OI..!WRAMB!Z2"
+1470 PRINT"HP  S8GR2T0*8B7O RQGTYV.7..N SX Q7Y59.J6-*2A4L.,?HG"
+1480 RETURN
+1490 DATA 20,207,67,78,127,188
+1500 PRINT"MGHJYN* QN8A D3F*X9JV36PTU*  EG*I--"
+1510 PRINT" 3Y.W7*ILF T42P W  0. ZI22UGT-06QJ?YBTEYC"
+1520 DATA 233,75,143,39,232,22,0
+1530 PRINT"-MJ35RK 322AZK4RFSL629*G3HTF6 ?ZAI 81R13WNB-WK "
+1540 REM ICUXLGU*-MZXOJLT*QGNMKDCBEAOI  QB-SL
+1550 DATA 132,138,226,174,22,23,48,94,183,138,202
+1560 PRINT"5V RH 4DA8UPG07!W8X!9S 2T P1-C AKX5UN0H5K.5-"
+1570 PRINT"?-Y*-UMRGRP5O,K  S685 50F?P6J4L!EE!EEDW-7 O"
+1580 PRINT"XLE0V!NBO4TVY-U. 1TOQ8A*0MKLTT.MXX1"
+1590 PRINT"G7WPWPMMJOQB0 GZ K 1U41*8R,53 WVW5ZV14SVB4KPJ0  IG.NJWX"
+1600 DATA 186,227,176,27,72,251,101,128,71,96,201,28,242,190
+1610 PRINT"8G.AR T!KD 2T.HAL3?N IOP!0SP 2TZD8SIJAJ?-E!ZJ"
+1620 PRINT".V1K.RF SX06T4KY!NURVQ1J0ZYH TVD9SI8*QI U8 9OLI5AFTMOEZ"
+1630 PRINT"2W50WGO 33YJ7KB Z-OBBU.37.?YV  GH"
+1640 PRINT"3Y-SMHXM-!0BL4- X.HHBBWG! 8.18T?"
+1650 PRINT"U.GUQ.64 8SW,JTZWH!8 XUYZDJ.DOM30,N*Y-0GIRNNYC9SQ C,W*"
+1660 DATA 102,148,27,80,202,15,15,118,224
+1670 REM *** =A-K WFZBRVQ=KTODIQESTNHV U V*NZIIJEN
+1680 PRINT" .K 263Z36B6FVN L5M6L QW3H CL*F29PCB3JDPK5DL0BDPOG7U,PY-B,SE?"
+1690 PRINT"GP XXF-VTIDZ S!SUBUDPU Z!7.B3 NKSX! "
+1700 PRINT"G23?-R  1BXDH4M!E3.JP9!UUASB- JVF"
+1710 PRINT" FYE76JO0UJNE.P2L0XDAD46WA!? 7W"
+1720 PRINT".8WUINKPV0-60X*5 HW8O 0OBR 16JNAIJ*FEBCVAA?QM5*WUA,N"
+1730 PRINT"E 1R7NQ?F -V3E 5D.JA EZ28WPKIFFRVBW7 KFUSMFR "
+1740 PRINT"-HUUQD*KJBL 8O1PZ 2CSYDX,J6G 9C9U5 A"
+1750 PRINT"TAT0.DPWZ  *LYJ6P AJFAW 0BW0WL7T2!GG0O2ML"
+1760 PRINT"H8UHUR.T7V!HHYJ5C4P5?4UGESN.FH.,U M"
+1770 PRINT"Y7UVY -V9MIK!QF8ND7VPZY-X,Q*YB"
+1780 PRINT"R8?U- *M3KLM!BH858I*WX!7ANMUG-42D.10P*!GZ! BC32D6 "
+1790 PRINT"45AW5HWJOLL6UZ-K.*E1A !HOP26DCCCI1D1R?TYH 74BWF4KR KS59 *"
+1800 PRINT"K*SUK.VC7 6X!4MV!!-,7 PU2UZZM22IHDD8OO0"
+1810 PRINT"MBC!EG -2A1A24FQ KI.9E8--5RKBV8JDMO U"
+1820 PRINT"NBVMU5I7AQ GOJ*5-BED9F P3Z8GAT6EPZ5*RC51U,C"
+1830 PRINT"??  XCN.-MB068.HFER0GHMX,BR9*W6"
+1840 PRINT"DA?G9H96F4.YJ SKB5LBE- VKEZ7P2S9-,0YRTKYRV4F"
+1850 PRINT"-2?IT94SU 1!QXK -V,NCK, HWLD2 I9DGSPNTLEQK"
+1860 PRINT"R-O3X H2KO  33IS2ZEKFPMATOB !EO1KGDKE?UB GFBM 671  IG*"
+1870 PRINT"OJQ9C.I*WB-DSML3N!,, 4H2 4 ! P0WGD2K5-VUJM8EPPNK GIHS6Q3"
+1880 REM AOBGHFAFCPJXPRIKTMVQAPDYHHVYO*= - J
+1890 PRINT"1.-4? 0,67LDWLNS*K,J-?Z.88TDVAE, X BAI,ID3YP8 .AD*S"
+1900 DATA 102,90,239,144,220,186,220,177,40
+1910 PRINT"9EQWKP W646W*!O!3!FJHKNH,0K -6K99D,9"
+1920 GETF$:CLOSE4
+1930 PRINT"91 9KGZLP58N0T  W0Z2EA9FNE*S6H OC1IA?ZE8KU.QEK6 AJ"
+1940 PRINT"38VEX347E6WUGC1WPJ?ZE4V9DVZ* TXZE,3,R0-VAJR  MC -RQ"
+1950 PRINT"S6!V,SZ36ZPT8PRP!  S,GULA7CT7V .P JE?E.W4ZJ9QOA M"
+1960 PRINT#7,PEEK(7) AND V:PRINT#15,VAL(D$):CLOSE8:DIMP(24)
+1970 PRINT"00,IH ,74AB!65!C ACX9. ,0T!4L1 M2P3I20"
+1980 PRINT"B2Y G4WP5UF O1E57ND6  SDRI6-0W9L ROEC AYJEC4 Y  P7G9GCMN5,S,OP"
+1990 PRINT"0E3U!Y FCCXPXD*5PR  DIS7 T55X.K 5.9 R .B0N "
+2000 PRINT" H AHY39J-5GQRHS!L7FNO!,CU653BTIISNIU"
+2010 DATA 169,133,63,73,239,65
+2020 PRINT"FC6F2FLCQ?GT*IF0! 86K-V  AO-9OLKX"
+2030 PRINT"M2I-VS57JR5 DZPIZ6SWWB SN1N HGT6!I1FRTQH3Q -D1ZU3"
+2040 PRINT"3CT F2W6WCEQ8ND.F*SHJHDS51 B36422F! KM L"
+2050 PRINT"DSEBC8TM Z0A*QCZ1IA3ZK 6OC?G LGI"
+2060 PRINT",05GME4ET!MOQ5U.A,B*R GC91?Q OLMSCEJ-I*1JRBNL,FW1 I5*Z0H  O"
+2070 PRINT"BE-6R01R?ODXQM P7IGVMEA 2 F O 16AT,9 L*7K AOK1"
+2080 PRINT"??Q06Q   ER!N6XUWR*RECN5R,511!*NZW -9MHZG0JIJ4UU8O5 ?LDJX5NO0O"
+2090 INPUT#15,A:GETC$:GET#9,F$:INPUTNX:DIMH(7):POKE0,4*2.701
+2100 DATA 252,12,217,199,196,73
+2110 PRINT"ECV3DOG-EO3MB4?B7.8 YV-U0 36ED? 6"
+2120 PRINT"4JST6Y!M!1-YL O3U00U2CF  EUD7M -C YY "
+2130 PRINT"SV9!YY0 ?7QSUS8G-F RT!TA7 JIOJOU!"
+2140 PRINT"3TZHIH M1V ASYZN?WTX21 3JM UBO .M4*U, 4,E7S3I .? 8IRX"
+2150 PRINT"3NH2BYMO-7 58-CFZXE*00AI 3 ZCCT7J153WZJ.DP 7BY993!? 3!30U1AA83"
+2160 PRINT"  T3Y9Z9 32BK IGO ESP T5 QNO. SY3*TV,X AV3? 0CV0RYO59TE4? 0T"
+2170 PRINT" 02 QL,C,XZ ZPC?8  6IW 90-O00EPM39B7"
+2180 PRINT"FS20045EZUBZDE5P0,LYV8BXXY.E4S*0ZT7 PB XQGK?5ZUMF Y1"
+2190 PRINT"Y0-L1U* AX,8U,EO RQOB TI FNR  5L.R  !"
+2200 PRINT"P1U81 T71X3 F0E*1UZXM28VFI9VJCGJ E*EE85CQ4H1H O B!"
+2210 PRINT"GV* DSB3B H 0,J25129HC S2PG *,KE VT3Q 1 GJYN9 .8HIFW7V?4W"
+2220 PRINT"P90?J 7 1.-T05 6GP1JS1G -X DGML.DSYCSXZQE!7 L1BT 8DOPQEG"
+2230 PRINT"OT Y143Z*R!YA!Q17MBC718 WF5!NZBE2ZWSZ5H76N-ZJ9GYBHCPYZA3L0P.9"
+2240 CLR
+2250 PRINT"7DS4YN3 5ZD7BRXL6?KRRYSG!EP,*?*"
+2260 PRINT"ERUS ,VL9P8?0O ,S-?LM 0?.HN*WS 2"
+2270 PRINT" !WE?3W2N0BJ!065?89GGFOX5?55KDU76BBGSUHWYDP ,9BCY N-E"
+2280 PRINT"87 C IMA ZP 4U9BNANTO-?J38,6D9W F"
+2290 PRINT"N 410 CJRS7C.N9FH8Z5 5JI9HEKFO5HB5009SD1J .M"
+2300 PRINT"BX-KWWUO3?9AYRF8JNZ4ZK D! Z V8LN! J7IOP"
+2310 PRINT"J -DQ BM59D,?QP0 7K0U -VWKU 7M5FAXBI4RPN*8"
+2320 PRINT"L?Y !VFL 5B-.1 L. 8HB R47A3CIM26*-4KLJDJX*-.0"
+2330 PRINT"UM,5YZI7!IDYIPU JS1 5 TK9TCU.  2IPQPBUR!2.88T2EE8YFXGK4-Y"
+2340 REM BXQWIMMF IA  AVYVWUJINGXTN=HVCDC*FZ
+2350 PRINT"A2J44U1IN3D*TAN51 NZX3TCT902C-VY4807SFB3-"
+2360 PRINT"TF91WPJ3,WG8 .MKEWFK4U4X319NIHAS?QD MD5OH 5E* 8 B"
+2370 PRINT"D5-8 L0T?SR5X15U*6GCS 6  OT4*8 GSJF92X2*TPMK9"
+2380 PRINT"WAM4I8,Y? UR-HB00SM3T62R?Z3D3TN  .?FVR S Y 2V,QP*IL?? "
+2390 PRINT"D! IA*0TCUP2 RA910KMKZTHOR098D572DCJ.9 Y5N,, 5GJ"
+2400 PRINT"K? GU T2 BDB A 5D1H 8! .XMW?XG69A"
+2410 PRINT"H5VS*G DR32!6I1WE  M743DRRHHYVZD4K*?9?J7190QHJ!CCX41E "
+2420 PRINT"B-TZV PKF09204IR8XN 0ICT9BXF!1817Q P AIF9V7 XF.9O5O,ZVCI6"
+2430 PRINT".Z ZH60YG5V*38JR0Z3 CZ!ANU5J-U6-2 S3B  D VL I85. .T  0 Q*HB11"
+2440 PRINT"9E12F 94D -0QJP3MIO6N7!CSGBM7OC"
+2450 DATA 58,9,247,143,183,2,161,79,241,54,34,1,151,193,165,245,152
+2460 PRINT"M0Z!K,YKWR23K0 Z9TV2D.9F L J ZA HK4D98S 1BF*2M!HAA 3UNJ"
+2470 PRINT"A9,RYMWTFFUO*JT2?54FO26I948LM2MN N6HHF041WPY7CKGJL!M0"
+2480 PRINT"Q,H ZK9QAU9Q90K 81JK9DUXM3-3X1F! 4D1X*!89,??,EPE3ZCD Y 6VBS"
+2490 DATA 74,225,230,92,115,208,90,165,152,241
+2500 PRINT"N  98P  R2 M9TE1YDKQ2Z PUX AYPXPG9Q9LMRCR3 104MU2-0NG1"
+2510 PRINT"JH54*FKR3XO 7-JY? CROIO OGTPWB"
+2520 PRINT"6D06IFZK?STTUMSM0 9EC9JBT.W0PYI1YYY RZEF1,"
+2530 PRINT"9C29GA 05 70M-Y22LF9 D70S0 A,8UN"
+2540 DATA 135,23,43,249,22,127,23,227,179,31,30,99,95,243,11
+2550 PRINT"L5Z!S3?4!582VGYFL437D*RST?VSR-K KN,GIK6!IJZ  JX3C"
+2560 PRINT"V-G!48ST.U0G4E *68*K5E.3M0H7. FKC"
+2570 PRINT"0J0NEB A  EG!NLJ4R ?E.7.SNTYQ,Y"
+2580 PRINT"A? 2E8T, PDPR9O6G *FKBFIUN GD0J9UE-X3P7DDJ"
+2590 PRINT" LDT .ZJD9 KX 7 KK1URYJ7DS0 M14W1 5Q3OB5 J-  ?K*E5AU1 "
+2600 PRINT"I2-GZ-?RYLLRZ-6A,PE3LI!D AW,M H, 3-!"
+2610 CLOSE10
+2620 PRINT"?1UGAY0M? Z  -T-PWHAB .10MHP8KY?*F1KBFUJI?Y.SW*N9TUH-V"
+2630 PRINT"N JV!-6-CG7XA3  4HV5K H1WB5?!65TH6 ."
+2640 PRINT"97N3KCT54WVSA YV W0H9TC  1.GN7!IIRHD "
+2650 PRINT"GL7VALFABR6.ND4  3 GY7,N2*.YL8R4, !7N?OVR"
+2660 PRINT"D -GQWCTJF LH,Q27GM6XMHP HSMD*STH"
+2670 PRINT"5QCMFDHYWR*,*3RY9DZJVVH7CJU03R"
+2680 POKE50868,ASC("EZ2..,O,"):CLOSE13:READN9:INPUT#11,J
+2690 PRINT"6K1YPZ!HE.OR UW7W M!I CWN1,T7NYU0,O55,SA"
+2700 PRINT"94YCNQ5UNT J3W-HKOG*P3 .07  3Z! H8.NF ?E "
+2710 PRINT"BS4 VBSWJ*TIE.W 2V75TWIPVP SIVRVL..YI Z"
+2720 PRINT#12,INT(4)<20
+2730 DATA 54,154,82,0,2,232,247,45,3,101,190,83,230,251
+2740 PRINT"1?8PYK EWH E .MDB I?QMF12-4HD5X!.PILK"
+2750 PRINT"I6 R  87423YUIH7 Y7!Y*1J0LO!75GFSH-UQFW X5UP3*IJ-WM8H MXD"
+2760 PRINT"63XUE4X!A9OJQKZ,OQK8 X 8KTB F JUT 0I-OYV7F6Q .V3O7*T"
+2770 PRINT"C- N147,H3?Z7  AWK7KULBTPX08 2R7IY-?LRI*!*URSM  ?PGT"
+2780 PRINT"YK1C V-XV18VGD8I-GYMU4DQ**3J.*VK5HU85VM1WUF92W5A74D1LP"
+2790 PRINT" A ZKOAHU8ON9-* FH*P-BKD  !-B16YGW*JIM6A9X6LK6 YJ! 3XC *3-WY"
+2800 REM =XHCCX TTDFHX=CL=CKVMSVFFH AMBLOU*=BHGQBTMOU K E
+2810 PRINT" C1WIN-XG-26J,4 !9 IF?U 1D,KF7  RN  "
+2820 PRINT"ZTO8D!YMZZCEPD A 2-KA1IO3W-3 KHD 9JQEAFV ZS6RZ"
+2830 REM *** Z-M==KNVORF=ANEVSGU*SZVWMP*HNSAX-MITA
+2840 PRINT"POJY7OZK?JRVNBMUX F8M*DIJ8JRZD4-MO"
+2850 PRINT"F 2B8O343 WY3L1ZW NU2 2T, S!P HQ 61,NX1F57P R.1 9 *9,W?5X"
+2860 PRINT"OS86PO B.FMA ZX89VMT0J76WF?LH.E.4SJV1Q 1"
+2870 REM *** =O  VEZLSZDOSAA-KXVPBFRTYPGCRN=* TQGOZEYE=E XTDBYT C AADM
+2880 PRINT",U66XNXQ8UT.YH U P,9M* TKH2UP *YK1M04 WT46F1E08W 8 -Y"
+2890 PRINT"Z*J8N4I8DG!R9R 4WX-0* E  VE-J3GK7?OFRS3.F8Z*LA 0X?3470S, "
+2900 RETURN
+2910 PRINT"M,M LD2 7-09 !B3R FJSN 2VNSFRBGS?1W8M XG5PTGB*TOPEM20"
+2920 PRINT"HDLPSBL  Y9 OL0GMHVRB.0ZE0.G 6 0RL25H9NS-1O1M"
+2930 PRINT" *ZU2OEY  ,L A7OY! LH-ALY*80T,OA84PHTT3S!R"
+2940 PRINT"TS!ALIK MSS ZK7J0NCO*A 5 !2ZVROQ2*A SO 9* ,FS,RU"
+2950 PRINT"2GT.BT1FRH5,U0I??ER-JK 8Z6C0GR4LI0-HGQYYLPS5HMLA"
+2960 PRINT"QU?ZNO7FMMEW4 H8!D9U?ON7CUQ 50 E6Y 6AOX0DWOVOMHMP2NO?4CLW6"
+2970 PRINT"8UQ!EVVUEM??C-Q,7HOCMV520F-N98TVGNT8W,!IT 5E"
+2980 PRINT"WYRWQ,6WLRO";4:GET#8,X$:OPEN1,8,15:NEXT:NEXTM9
+2990 PRINT"JC4FFX?  2SKD3R?3K,W!,U86Q9 X95-9ZG95! .3IS"
+3000 PRINT"6S 9VIWW*HPH4 34VZ .NHT YA-N*.Q!VB0XV *0T"
+3010 PRINT"BBB4 7MK9E,L0,!56YKLKJ,.J GFQPM3AK TTRVAKX-* "
+3020 PRINT"NG74*1 5G Q YAJI3G9 0U,PBHJ 8B7DYVJVJH74H*0,BM0ZDKYBI"
+3030 PRINT"BYRNO5E97Z3 4-146QJK-MBID4H0M9G ILNAOX0ON,0 5UW6KR R"
+3040 PRINT"AXNU*JKN!Q3 ZY9ZVJTU0B  7U ?*G962?RE-NP0YT*60U?D5HU*"
+3050 PRINT"IE AQDGLI,MLIW 4XF?-,IZ8JS -1. H7ETT7JC"
+3060 PRINT"?57 27P 525*P B 73-E!0 P-V9I7?0CD8QOM"
+3070 REM *** ZTFPACIUM ZZ
+3080 PRINT"*RJGO, ,?16  -IIVZOAR?UHA55IF N  K-8*2PC"
+3090 PRINT" ,,VIH.04Z7. 0H ?0 B .B1XU0FPFN EIKKXWXWV5YG4ZCR ?3D"
+3100 PRINT"RL3M6E06!FA3,WLD4 39Q5C0K?U5RR.TMGJZL0"
+3110 DATA 145,204,48,146,20,38,96,161,233
+3120 POKE7,LEN(OP$):PRINT"NV2CW0JE,P ";RND(O8):WAIT99.895,POS(8)-54.882
+3130 PRINT"*J.1?H7 GOTSZY 6VBF  7 VXBW88O0MH8"
+3140 REM AWBXCXPQDFEK-MM
+3150 PRINT"!*WX9PXVAP 8ZT.E3F73 PGOZE B4 J *ZJOQ99721, 91PF62MM*SOB 9"
+3160 PRINT"F1F?15FT-JHFNTXX-GRJLI8QDQWORY4 O"
+3170 REM ISD=NS N*UDY-P*SBDHDCB QR VRCCXEEMBVY- MVINRLT-B B
+3180 PRINT"5R P8!RO3KTJB 259  *QM, EIG CFU8YZCO0?U13 *XCWQSELR "
+3190 REM *** FUXKWGFACUIT=IPYVEEUP AHLKLH*LEW*
+3200 PRINT"U6 7 G?8L2HJHNOJ67ZX08RP3S1618!"
+3210 OPEN8,8,15
+3220 PRINT" W4IN1 ,I1AUIT888E4*H RVG52HREL 95 SX-VFTNN-1AYJ *5 HE B UKR"
+3230 REM *** UFBYA=DJMLODPSMNYMHVORFALRBQ
+3240 DATA 212,106,154,93,188,159,161,209,76,74,222
+3250 PRINT"R74H 38DK.R,GC4YSSGXMWE? WOVEK?"
+3260 PRINT",I11LOWDW46.F  GSUZ PBLILLZDRTXD"
+3270 PRINT"H4GDOGH8-0NBF02*K! XYL 0  27KPB?PQH"
+3280 PRINT"PZ C3K3 H4-FQ2B5.C57M7! 6H*VK5L68VTTW"
+3290 PRINT" NVCS U-JV2?T9 .7Z  U7R!SGX?KCLISD9G5?IDXGJ 7!S*LE!4 1?D?I"
+3300 PRINT"?.HJG.BO*MFOQF9X7 !ULSED1Q-G2F"
+3310 PRINT".FAG DFDVF J6U3R473*U*LNDHS*Q-.!L9CUO8E4T "
+3320 DATA 91,46,99,32,254,234,153
+3330 PRINT"BPY8TZAB ?7V TLLB0B7B AR,0.1L   GFMSEVKR.6 8O?Y6"
+3340 PRINT"VMAWWB-.-E3B82P RQHX33M5ARZ BM6STP7CFU8DA0KJ CJ7A-S?"
+3350 PRINT"W* AA7Y5B? 2J3 QV HJZ3-FCB?6 HC,0-8 OT71E-YA?*E  DQPU0LRU,C."
+3360 PRINT"N A90  Z856E14N0 O8SWF 9,T!*  IYMLTAMXYY"
+3370 PRINT"P.KRFK2GILI7GA72 3QDU5.5J-RZN "
+3380 PRINT"BJMJ7R8F! CXE V1 !QWRN.7 Z125VV 7B 3U*X"
+3390 PRINT"CW1 MR8ZB ?Y88QH1C1VS5XI8DXLQF X TBEI   2F1EL7-YVNO"
+3400 PRINT"H ?.O ATC03UOD70SO8*0 BF?07TQ  EXUDC3WH!E.WS0YGBXS"
+3410 PRINT"5,L3S!OJ R2?9?S*XSQ Z,7P1Z 859WXB HYBQO1RI5S29IJ9 I"
+3420 PRINT"X18 CAL6R.Y 7B?ZAH1N6 X6AR*,Q V!GWA9L!K*1N3"
+3430 REM JHJBKIDEEGUZIKPZXK
+3440 PRINT"89SH0 ,9 1?J4FYZ9Y66T-S VJ7VQM UA!CV?4BK1"
+3450 PRINT"KJEURV9G*PIBWXY? B  0 ICF.77J5IL04EZMY 6B?E8XLE!JT TYA"
+3460 PRINT"-FTPZX,? ,-!3W 9DB2MJA !H?LDY 2XLVC 6KJRXC9Y2 ?YT7YAA* WE0A7 D"
+3470 PRINT"SUTQSB2NILPPGG JUJ-NV*5B8Z CVP92LR.CE"
+3480 PRINT"79J2U3J.R,N 1A FGFXFNPKP,GQGZ49J7PC R"
+3490 DATA 128,251,254,21,164,100,59
@@ -0,0 +1,133 @@
+10 REM *** MMBWATUYBVNHNHCPU *FTYOCXEZGDI EV
+20 REM XJHP  WO =VMAJET
+30 REM *** -JYLH MP*FLSCYBIHKLJ*NJOHJXWH
+40 REM *** -=QC-PZDNG=Y-=FYKBTORUL-KBK= LZYHBD*  TPIOYXN
+50 REM  =R OYHE EWKR
+60 DATA 69,249,18,1,215,238,144,154,218,1,63,152,222,23,17,112,89
+70 LETX9$=I6$+"FAP D":DIMH(11):FORS=1 TO SGN(Y):RETURN
+80 REM CEAJKTCHTPS-IJKMGRV VTLGUX*NHRYRUTBJHV
+90 PRINT",3BFVUET 0QMDYSP,FM9ON0* LF18AD"
+100 REM CNSWJG=XKBVPIEIOJY=HKK= ETMD LXWL* JMFYAXSCRLA
+110 REM KRO-UNSUKM-I=ENNPLOBTMMSVI FEADKIBCPFUE=M
+120 PRINT#9,221 OR 57.619
+130 REM *** QUWPAVHF VND-PSUPZ
+140 REM *** RPIULAKRDMVV=GCUS C R F*R*JK*LQKJS- OIZWN
+150 ONASC("DNS 8A8 ") GOSUB 130,60:RETURN:LET A$="*!1NE"
+160 REM ZYVKG*FIAWNUK
+170 REM *** OEQ-BSSFBSYAMBPAYQW-A TNXXNGG*T-OTTFFBTEUTOL=JEWMBOL
+180 REM HWN  JYJSQ-QN-YSXTPUL
+190 REM *** = DZB -HGPSLQTH*BISCYJ
+200 REM UIJCI- AM*PVX GWVPELRBBRNVY
+210 REM GUGS*Y B AFR-NVZR=ZCD*AIHCW*=UALIK UAICVJ*LKGU
+220 REM *** CN BFK=NTVSUBRLGTDIPRB=CSCMHERO
+230 REM *KHLHV =RQHGHJYN GDJDOTMMTAFYIH*CEWMLLNFJA=GJA=HMSS K SNV
+240 REM JWTYPHSFT*
+250 REM KNJDBG*N FGD ZDCGCHD-RZDIA*QGAL=IAWGMN*I=HL OQPAHGFHPHNM
+260 LETMK=N2*3
+270 PRINT"P!VBX-8OJR*HG,D P82G91UZ B4 ,IL!TX9V X40Y5SC ZT0MQXHPHX6.J7"
+280 REM *** XR DRYT=B=G*F IGQMTYNZFIOUEPQXLW
+290 PRINT"KP3T0PRMW *K -Y623*?3 !RPJ, 0-SF5. YTV"
+300 REM -SHHP*DJCOE==TZUPU=DUZK TKZIUP--NOCK
+310 REM *** S DCBMF-SG=MYEMWABMAWWRFPR*ZT*DCGJ-FX*BKWGUJAYINAA TC
+320 REM *** Z* UE GARILRQB LLKRNVWVDW
+330 REM GWUGHT*ZNU
+340 PRINT"NPRE5C-VXCCRJ4- W5-OGH4Z4IU*XF. G U? . T* VCC3U.I"
+350 PRINT"U6R-MU**";G<PEEK(27.573)>=J
+360 REM *** PTDY Y=ECPG=FSQ=JG-NKNP=ZRTQ=ONXRDOIQSJWIX WEUX
+370 REM JJRKEWUV G*WORMJD*SGLL * AF-Y
+380 REM *** -OBPDVWTRHHUEZ*DDYWJMCYGHVHHKKPJSVDPLTQSUR BJ-ILIXB  B
+390 REM YOOLL==*Y=VNMUNYROEQD-CC*DLXO UOTMI P JWFC
+400 REM =*NWYDBGAMNU 
+410 REM *** XMMA GPU-Q=CYBODXDIKTZYKFVPBHVHD=XFW
+420 REM *** QB=QQG X* HTVQPBPKRDAFCLQHMKIGXZOHEOSWDVYJOPXG
+430 PRINT"3UA-7!C 4!J9I XNNMT4OVHZNN*QM85KH9E0T9V OVTAA"
+440 DATA 116,239,184,50,214,254,24
+450 REM KKMHDV -*LOJZRCA*FCLU=O=ZYZULLJRETXVDS*OKKTMXA
+460 REM *** VRNQLI AAAAIPI 
+470 REM *** IVIDJ*RPTLYMENHK- CYQXE-TMHPMVINOXU=QORKYR=NQM=VTI
+480 REM *** HUV ZHLJPDOGR
+490 DATA 57,180,49,174,85,59,218,177,164
+500 PRINT"KVUO  HX.AQUK0M VI2I GV?GX2MADDM9 3-MCW?.30KCW7  6 5*JLFCJG"
+510 REM *** W*CG-K-SQ JXYMWSKQ
+520 REM *** RWCIHMSJFCKIJWABDRTYRIGGFCMEOVSUMEDE=TU
+530 REM *** BPYCY=IJDVXVZKIGMZC  LOC WN 
+540 REM *** UNN  GHM-K=ZJM-KBMQOFVNHIWBXATXHY*ERUVTO*SRDN- TIAUJ
+550 REM *** BJVUSYNFXHTDEJW HXWQRNREQFXXU=OULEOOAHZNKSJEPTATWCKON XH
+560 REM *** ZDG-APMQSTLZSF*ON SQGUNXGSJEWY-=FX
+570 REM YKERMKTRNDMMFGN--WBAHNS=RI*RBINZQXD
+580 REM XEJNB-QSE-HU*KFAEDTJA =MHO*CDBFZ *-XBGWBJBMN=ES*DGDFERAR*
+590 REM PJPB LLW X- UEC JUEHAECYGICFRTYBKB U-YVLSPWNKZ=I PA QTRP
+600 REM *** UFNRPLOVHI
+610 REM BQMJRUWVKQYDVHSLSKISGSXMDHYOR CKZPLA Y=X=ARETJFAAZTUHMP
+620 REM *** FQME EJYL-RJT=U-J
+630 REM RRLPD-Z LYQGFPAPBFFBT GACKZBQ-X QAWCZCZ OO
+640 PRINT"- OU9 .*3FPS.O6!0L 6Q-OH6T*PCI8J!,* .DVA"
+650 REM *** MMYRBSR- LZCAHVOMS  OTUHXZNXPA EYNGT**QGP LTV
+660 REM AUFFUULGIKXSSHKUY=AI*JKFELGQH MKRYVZIVB-G PINS LE
+670 REM -TDZMLAWER AR- XHRKH-LKYTGCDQPMBDI EBNQP-QSJXAKNE* GB
+680 REM BO UJLORM*SQ*CGQQPKYETUULS*QTCFLQVXRG BPUIX=IMUSR
+690 REM C SKGCKV*HLBTE BHHLRU-TORZSUSYZ KD=WYDS UO=TXC*FYE N P
+700 REM *** KW*=R*N*JVF=GS=-M QIVGSTY-FSSUCUJ
+710 REM L*FK  JVADS=GAJHETY  GAGWEQHUGGP OLJX
+720 REM =HCSQIVUTUZ MJLUPWLHXTXSU
+730 REM GZI-U-OZM UMINSMBB-
+740 DATA 143,168,55,182,73,53,249,178,252,186,69,42,250,89
+750 REM CN=ODCSUU GRUTKVX OBFVIIAW
+760 REM =ZZDT RHGMJBJW
+770 REM *** KFY=PVTA PQZSPFOVNAQ*OGTWTKLVYAPNBG*ZGVZLL
+780 REM DVKHNFBVFFLBHWSFHKZETTO-TMWDOXY*  *GLNTVVFKNWV NOSDQ
+790 GOSUB60
+800 REM *** ENQDFJT=U GQKEPOEBPYRZXJQ
+810 REM EQLBLBMBSKURK=DCUXXNO=PTSYAUBIJZIM-Z*PTW*GHOJRHDLR=
+820 REM *** DNCEDORVMIK CXK-UFJAU =W SMBBEZAF UNGGB
+830 IFABS(SIN(26)<=VU)>=LEN(X$)>=A THEN 500:FORH=1 TO 83.202 AND 97.892
+840 REM *** YTIKCDIQ=GHYGVIEJPRXFTASOPRQW-XPDYIOR=*INJM
+850 REM *** B* DJMKE*NUWM YBO GXE*-GRYHAHWMLSHFUG*SLJUZNMINHXTUHHTW 
+860 DATA 149,165,195,238,249,79,158,42,148,88,36,196,87,226
+870 DATA 208,237,209,98,203,84
+880 REM *** F-T KTDFX --D-GCXZ= XQGMUP
+890 REM NKW=VS=OGR-T J UAMGUIQSA JUNN*-IHE
+900 REM HYTCRRLCABVDA-*=EVJZXOAYMVSN YHAUZ
+910 REM *JZJGEDCVGNCI -QADHIR YDZBXLPV  MO= K
+920 REM Y-WCLDOO-FU=QNAH*WVHSNQ*-VSAOXZR*DCHDW
+930 REM *** ILOS VZXFXWU*-CDPDJVBS NRHKZRWGVL*EABGGK
+940 REM UVQBECK*FDOQK FN
+950 REM *** Z=M-A X N-=UMLUTYMMPKEQLCHGGVOJMCOAC=VNDNV
+960 REM -NSKCYAONZFZUBSZMGHAYOOI*EKGII*MN SYRKEERF-K XI-FP
+970 REM VKPGSYIG-M-J KX*GY JHI 
+980 DATA 79,170,32,242,84,72,66,149,206,109,235,13,6,99,220,58,226
+990 REM HA PNVSBLXQXAQCDWCLBK GSP 
+1000 REM *** S=SCJHGR-R*LN
+1010 DATA 177,24,217,227,146,127,138,232,87
+1020 REM *** JQKEZAHRDQKDOLU-XXJC H-HWZ WMEJC
+1030 REM *** WAMBTKHXB-C-WCIQ-=HURBFY= PQ
+1040 DATA 190,145,146,114,200,62,164,75,104,94,169,100
+1050 REM ACRAZVZPPYKD HTG F JHBBZZMMPTM-IRXJKKOO-IKCIAOOI-FC
+1060 REM *** JPQYH=XZTKRYPKALNWFPMYLIF-IAHSDIW
+1070 INPUT Y$:CLR:POKE3,A AND 10.871:CLR:CLR:DIMM3(12)
+1080 REM *** VWCASNVTJJGGDUVBVHXJU
+1090 REM CHDHQVLPF*IVHMCDAI
+1100 REM SASIEFU LK-L-LBJHL- *PPELM MNIPFHS K-QSUVWDD*YAM
+1110 REM FY  GGHT XOGM=Q
+1120 REM G*C*RPP Y SKO S-WS IP=
+1130 REM  - GRXPCBAO=XPUJLCXYZ KFZLWVXKTGNWFJMB=CXF
+1140 REM LD*ZXZJRHHYU WZBGZRW EC
+1150 REM *** MKFELVGZLZV FLRQPQTWQBFG
+1160 REM USQISRZH=WSCRJEJ
+1170 DATA 147,138,184,38,247,7,117,37,193
+1180 REM *** *ORJQT=OQHY= YH-
+1190 REM PI I GVR**VE-WOUUOGVLAMTHAEOTRN=RZVEA-PU
+1200 REM *** *QVIFHBO-TAEOJBXISRV= MJDHXJD=U=U=HREUD* 
+1210 DATA 59,127,187,84,82,24,10,116,220,181,59,88,244,77,105,150
+1220 REM E=XX=EJ-ZYL=U=QUV CWNCVIWML
+1230 REM ***  TTQPMAKHFS
+1240 PRINT"C!2,E7C QVL4KHG B4C- 80IZLY0O?IZROHY*0V"
+1250 REM W S M*NTVMAV  MB-=NLVLFZMBJOJJED JH*ZE NT ME=HW 
+1260 REM T LCCZR-SOORG=PXY*CYK-BASE
+1270 GETI$
+1280 REM *** C*P VFDVEK-E VTXEHMOIFDB*HM IZTQ=SWXUN
+1290 REM *** REGVAADTUUGAF BUVATKPLQSZNMQSYHPL*= FM BSBOS
+1300 PRINT", 3X8VX-?5FV0WX CNKW4*CY7Y2 9O5GY J13R78Z6 1XPSD3SZ70WQ. S"
+1310 REM UU WWTVWKTPTJTKLKPQ RCUCXXL-CQ
+1320 REM *** JAN=IDO*T=IBGEI=-V=B-XXP *UUMPCGKLP XN- BLQOUYD HORTZYKDDF
+1330 REM XISJBGBX EJDLKD YWWU-NKZRODZEUWSYKDIGO
@@ -0,0 +1,389 @@
+10 PRINT"W9 T 9PFOX EC69ZH VH8 B0L9P- VU  W T ?0BFL7 1 YMZYBFIQ D7HV-F"
+20 PRINT"D M!UPJ9Q79ALB MP?4 ERVHB2Y5BV2"
+30 PRINT"05XY Y5Y5G6B-IA 1Y*L!B ZO,H.PBK3KNWJ-A,W ! UF7,DI0 G"
+40 PRINT"HHVB!* 0K8GAML-V!BTFRPSWWK?2PWT  A7JRK-9 HW6"
+50 PRINT"! R3,6ZC-E1KMZY -I?9NC-AKU?VJ N Z"
+60 PRINT"EYNXB*47HQ 3-RD C9.K-078- 0ZOWHL"
+70 PRINT"NFS9 ?L!A9L ANP- O5-GKLPNNQZ 4.VUPGU1!U!4O M2"
+80 PRINT"NCP -KM*LPLFVJXA5V6PG 5U TR9I CVHGQQ5YEP FFDT4V7W "
+90 PRINT"E?H8CH?3?J* J.6EQ  F4,  TK7 Q-OA?- IVTWA92YLG.BPEHZ"
+100 REM ***   --V=YZK*UPRCFMW XGFOMJPCQCWR IXTGF HFXX
+110 PRINT"0B8WROCZZXSG2G4N*8 -YI! 4FQ L?!3WP0GC 4."
+120 PRINT"VFK SR.*9AA .UL12!C !K-381FVCB"
+130 DATA 179,189,189,101,84,50,32,47,196,133,171,250,203,70,102,232
+140 PRINT"MR0 DLZ9YVSMAZWPM*WRO VPD3BFQAKZD  IM* BT*8TD0S! XEK.DLMLD5 "
+150 PRINT" KB0K9X -Z*Y 8X74C4EN0XQJ3?0HC--O8V NU"
+160 PRINT"8 TQE0DY0,- -Q49 P?-S LC!2E!S JASD!-2DL96ZKLLCO"
+170 PRINT"42ZD   0N5-F1*BYFJE7SXSFRZX ,9.U9-.HMUG125G76 I  JV7L"
+180 PRINT"ELEYDTCM?M36KC7ID 77R 8DX,IF5BSV?192OA"
+190 PRINT"09B K8Y !55*TL3WX  NCA5EBGHI03MPADFZ6J?IGCCPTLL32"
+200 PRINT#10,CB:PRINT"VJ4?8RI4S.Y P P";U>LEN(A$):ONPEEK(F) OR 211 GOTO 120,100
+210 PRINT"E*2!Q5FVHJ5D?0TRW 0CSDX50NX.9PYM.UQ9!AKZFDUXW6C6,J?8,LCKV* 5"
+220 PRINT"HNJE9XV D17 *,E9Y*LPOSQUBFPA CYR,RB8FK8-SP? ,-FAWPR6IR?7UT-"
+230 PRINT"H6F57CB7EAL0QQB  0 1HI?OTXO2,GHCTER,D? ?I 4Y ST8KS.H"
+240 PRINT" GTGE 2D- EG6-*WIX24  Z01LL16  GU1S63!C,AVSM7J11DTIGFAON"
+250 PRINT"H437J0 XC,UV2OPAJ,!UCE?AN4JZ?PFZ!P YL M6X?4RO5K NNICA Y !ENT"
+260 PRINT"2S0Z,P4US BE-  PZR6JD6CE.E 9E  .3SJ8K5-"
+270 PRINT"JR!U5S  .N*G24SA LE8 Q50.DCFUP5TT8!M  DTL66KZ0O6M7IWSX0HJMIG "
+280 PRINT"DATB!.F-1WV? !6C-9EL6DC2  -X 2 TWU 0BP*MVIUR1FR1C3 2E 6 83"
+290 INPUT K$
+300 CLR
+310 PRINT"9N!XP8OZ1J1*!4?ZTBT4MPAHM2A38F*.H928 NVZ"
+320 PRINT"PB?WL0? 6XO3NLHG1QDM1G4?MCAW P*QW F5N2"
+330 PRINT",B * *T6PSC*R6 B30GAU24VFUUP?5H EJOCTX.MHHZUY27ZPYQRQ"
+340 PRINT" TY QGN7B!C DF8 A T35S , D5 S. ,JBX9,C"
+350 PRINT"6C90 7P6 VN1PBT-0ZG PEV54DPN7F"
+360 PRINT"6-4CL6KR9C42.R14X05CUB0ZP4MNU95 H.H5F*P8O35ABJPXI "
+370 PRINT"C R2 CNS6CRWAHB CK2YDZHA5J-E1FU1"
+380 PRINT"68-3, LH2AD 9D * A919M29FE4,JDPVZF PE?C81R?JBEP*B"
+390 PRINT"  XDR YQP3WKVCC11726DP -ZUH2M28QO"
+400 PRINT"0-7MAG5T1F. 0 D.ID,52JWVMV!,X7!IS4 DRDK-9 I4,0JER"
+410 PRINT"XJ 1  FGZHD.WNOFP6  FGW.*Z .T3A17 9XJ2R2N!,AD*.EO!"
+420 PRINT"F81 KPZDB O, IFL!! G9?P!, O.HHB  IEU,19922EANYV KK4Q"
+430 PRINT"ORMX BLZRZ. 5BU6UC*!2. NP  0!FSO IJXY-LP6CV NTQ7"
+440 PRINT"OQPE3PHMT2II8WYHZK706UFUO8!DS*.DW,TD!K7-J8OXM7N. -CFS2 *?HO"
+450 PRINT"WO41V JH? J3UP8RU S?LIJJC6P4P1WH1T45TF,OAM!*- 4 2Y3"
+460 PRINT"HL?70ZJAJ8KM40BKN3NCS4GW!7NSE ZZP6FQ-PP8 "
+470 PRINT"BKQP JY7E2Z 64FKTF PO*FBRA3.6 1 RSXGWPN7Y- 0C3I!K 8RKQ"
+480 PRINT"3J OS LIVFOSIM4LD67 50I1VFGWHR0?L. -5R6!T  5OCHL"
+490 PRINT" YM0I7O3205WM8OWVZ KVSW23U.!OR5Q-P-ROBGS-IAT5"
+500 PRINT"?363T-YGE 3FR3LAIU2FE30X79LML33 H!D! YUR*F*,T A56 O"
+510 PRINT". S,4 Q3!,.  QKAX 7NIHIYP7W-KQYD6JLZR7TVFX G Y -CAZ2EGF H"
+520 PRINT"FYEDCKU-UQV  XAIWSP.RO8.AF.6! 7ODWREMGDGHB2 M28DLZAXE V*"
+530 PRINT"-.? XMP7 ? 2ERYXA SBVF9UA0M PTRFFGUEY?LN,- -ZU DCL42S"
+540 PRINT"ZU5 ZUG-3DXFPL3V5YPPQY7.PPS, W3CNW.,*D"
+550 PRINT"G!FU K?T8GD69U,  E7EA!QA2TJ?-I4 79"
+560 PRINT"?O6O07YI4VJCHS VUFHQ027Q  MYKFCL! TN*73VYROO1IL35IZ69Q"
+570 REM IS  FHSSK=NOW=D-JHVZXQOHPPB* *KTNSLLHKTDOWJO-TRDKETFLU 
+580 PRINT"OD0CCH2XU QISJ 6 0?G3S P* 2K.CFJR, * 6G6URMB HOY  DF3HWW7 2"
+590 PRINT"DGEGJRU,XMA *FQR O*C YMJBTIB. C"
+600 DATA 127,86,211,38,99,183,24,96,245,171,28,143,107,149,184,14
+610 REM *** JOANJATFDZIZNEGETHUG=T
+620 PRINT"LVQ,VM1X!N?M47NF0909XL6 C0,7SAAO4Z49UIM?KUMY?SABV9? ?4 7N"
+630 PRINT"H1*GOD,2VD0 RG42.Y,--HFX0?70QVFC6S G!?YAZA F8T81PB,NQ 6IXL8"
+640 PRINT"Y UUXF75L5OGK SJ?SRROTVP*6MUU8J5P1VV"
+650 PRINT"R6H*0Y RRKHRJQY,K7.*-6M.YLLWXL-ZDNRF*S?* UA"
+660 REM *** Q=OXDUTYV*LFBPH--VLNYLD
+670 PRINT"9SD1N66J7 ,UAXLUMHS!7W4G7-1Z.*0-UIPL0Y?VR91BGU  5QZM5. 7 TY"
+680 PRINT"0KC?I8N2?AAP EYWHX  -*74J 5E 53"
+690 PRINT"BGQC5BFJFVMCD-  K,GZ02B7G 00FRS8D 9YLA S,B RBME4LWGM M1OJHT1EG"
+700 PRINT" GW3I Z2X ENMHD,AWIBR LZ.67Y 5F49XT "
+710 PRINT"-5 L7BVVLAAEJECBS8NRC6A-  X Y3 ,4Q5O6-FCHBA623RB. "
+720 PRINT" UCBPX!36Q*AL!X,0X!EUX70.D1J7,0,9 G"
+730 REM GBWGWSO CXIIKGAH-LGFAKUY-TLV=HYOFR*RFBQGL
+740 REM *** XIRH*BUDHEWAGUJOCKAU
+750 DATA 221,168,85,91,0,214,235
+760 PRINT"-S!W6*S-N L0R KDA53*QAVVNBCON0E"
+770 PRINT"HKWZ3YC 3!KKQ NLV7ZH 3?FC 1RM  6365. -"
+780 PRINT"BOS3QH4XNG 2 5SXCSPG !T  I8CKX 8V S3OWBDLWJY71UMD"
+790 PRINT"90BR3!AUDEJM ZGDV1?1LM2 PLYP0QYP,CCIJ5 *TYB X IS?H0"
+800 PRINT"X3FT7 YC??L.V39 6QO QT9GD3,O,S S UCRMOXG "
+810 PRINT"69AKN 1MVF. F.H*1-63S 51EI9MG50!,PJTJ9 QHX!XH5Q.BF"
+820 PRINT"*VVUI2SYDGTTYXLQ-1NXA32- DYOAQGHHX,O3 3ZB C?"
+830 PRINT"M7K0?5?R V64F-D36. W?, K,V FRI14FHZ74QL96"
+840 PRINT"5J*D0,ZF2PN*GJ-2R7!1T GW1QPE7!S P*GYC DKI8NG20 1NMBU?6"
+850 PRINT"  03OW1X .GJ!?FWB2H2 .RCV13 ?*7C  ?,"
+860 PRINT"-K-R *SXK8.BHB4I3 6!HAD,G !3G2VM5WD7 IO!V D JS8E373KHH V,6E"
+870 DATA 56,173,68,119,244,225,126,250,137,185,47,247,119,127,239,234,173
+880 PRINT"A TY,U  0QJ EY.-OPEXNN4T1 ZN1M,2VQ.C3!8-"
+890 PRINT"NYJQ 0,J 6Q338 -MK5F.0L98DI*X?"
+900 PRINT"Y  F*L71.ZTDUTNL9VJXO,VT8W10  F4Y E"
+910 PRINT"CJ W6T2XBIQ2WT1-LMAU!V  ?TNQPQAL M LA?YCKXAFR* P.J2 L3 6454 "
+920 PRINT"*6QRFK6H8  Y9DS5XM480W !ZJ H,GB5FME .01V17VPGHO"
+930 PRINT"L*ZUMPF7PNOGC-N71,QBF .,D,N 5FGKP 2C 43P"
+940 PRINT"J3QO73I VO81 B!,BV3P -B , I4XU0V651ZG L.I4I!1 "
+950 PRINT"S?UU0X 3AA!!8P7F218Q2  ,U,8-QRHI7R3.O?X2- VN!Y.,,YOR2KOY XR"
+960 PRINT"-P45GU2N0ZKX5 HUZEQL-V A0AZY-G84RZE30LD9N2II 0,2*TNOTVA KT?"
+970 PRINT"FPLLV-QY72R3HJ?696 Z1 61DNFB99FJCE 1 C*T PW4LEJ,28MGXDXG,P "
+980 PRINT"4D3QFU9S0.*4SA*S8EXN.MQYN?M?* 6PFK0TK?51"
+990 REM =JAR*RKHB=THNRSSFWODH S=VMVRXEQ
+1000 DATA 161,92,109,171,31,201
+1010 PRINT" 5X K3-E2OJ W!649KNJHNZZ6U5 YUQ68!8OWZRCYKMV  "
+1020 REM ***   O M HAGCVOYJUXXALLICLQDZC*KSDAIHJMDQYMFJ DX*A=DONRVADYOK
+1030 PRINT".O 2PBEKL ,BJ565CE-B*.Y Y!W I86 KMK8FD9S0*C7S 234"
+1040 PRINT"FV UK67TSB  I.I2*!YCEPY14DA?C!!4G*?71!WH"
+1050 PRINT"1UQAA2! AHPJ QDG9 K1UUJ 5F 245 S49DBM!- 8 ?F7OIWRDY4GTZ0Y"
+1060 PRINT"DCTOVJNDRV5 8A ,X?HI3AQ12SX7NV T.03 SHG   ?NSNV3*"
+1070 PRINT"?DV25EAJ97LY4H57X 2QN 11IH83S  SRFVF 2 ?RMIWTSPU 2K.TPJH6TI"
+1080 PRINT"94*R.  !U.HMV9QWYM3KGDP 1K.NH 7C!*YRXI2,6RBOP976!J"
+1090 PRINT".CGQ,3FW7F62!.4ODN3I*-!9KSZEDE D8-2*GAGZ0F-ZID  832* .S2"
+1100 PRINT"OBX*.J2B*?YYP6NW4R !M.C G1NSXT812S5"
+1110 PRINT"L3WDY EN ,?.,O0X-V9Y!3RWUTP0BZZI4Q? F!U,O N06D "
+1120 PRINT" 2  FRQX6. 1WB?OM4C8B,E9TS5CV70YMZP"
+1130 PRINT"-5Q JWCP7IJQ ID*2GQPEXXRCS3 HIL"
+1140 DATA 199,109,44,21,161,56,161,128,216,147,51,57,81,175,141,242,161
+1150 PRINT"R S35Y,GNCHET899M0K 79CRT.02I4K L67 8"
+1160 REM *** LIPW EFCLPKXFDLSQCYCZZUCQN==CIA XLY
+1170 PRINT"0EDB2DQ, 2-YJ4JM 6RKV?PKS WX473UU"
+1180 REM FAVQNO**LIPZVVKJZBKURSCHM U=PSIPK-RYMF
+1190 CLR:INPUT BA:PRINT#2,INT(49450)*K:READY2$:CLR:INPUTD
+1200 PRINT" LXV0J0B6I!G1T1NZV! 9E1VL4,GE 36.RQ"
+1210 REM *** GPTTOQIQOUTJTN=GUJOI-Y=PRNITUNYHLABBSN -GYSRR**TK-FMEWRSL
+1220 PRINT"CFMP. ST! GIB81J*5764,ZSOK 6UEG 25,MDSYZTK8- W2 "
+1230 PRINT"QP8M7C!25 4V0,0X-JQ?W4S PDI.VUGI!USIF1.WE88V3K. 1X*."
+1240 PRINT"NM29 LXZ Q!OJ?CNU D.4ETM  KD XT2 WA-O3C77Z.0RY YMRW??.3SN DO"
+1250 PRINT"Q 1L2,EXF*8!8I * Z62N1Y1W8?RKJNVPJY .?IR!PB9SH1  GVW"
+1260 FORGN=1 TO COS(50045)+49889:WAIT64.664,VAL("!OS!P3!JP")/97.592
+1270 PRINT"JWLO !HHRYTDPYG 3DY690R .TSP,!9ZNATTQERDVY W2OLS  YWB"
+1280 PRINT"-JVB?1L  YJ7H TS 4 5W ? 3AV?6 55Q!-ZA5ND2 4CVMJDP"
+1290 PRINT"FBVCA.?1O9!1VBTW78.P XN0VL  ,AO4.H"
+1300 PRINT"HQNNOPXL 2.LF3 P1G LQ0!LJG R2 BXG,AGF80"
+1310 PRINT"DAN*O!Z4HI6H1?Q  MSS50F*L-SM 7.C5QP,4Q 5LE2  *E Z8C-UZ1J753"
+1320 DATA 110,201,226,75,151,172,178,90,178,115,122,155
+1330 PRINT"RK MTSGEOAXEWY*CPA88X H YT1ER8*DFRR"
+1340 PRINT"3Z -ZF765FXQU9Z  D  KHB6CU2SUUDX!B-JGHCOO ,WE"
+1350 READSB$:GETF$:GOSUB970:SYS51227:LET M9=49313:CLR
+1360 PRINT"7ALB68AW 6P2H0O BOX?B8 TZHBI5V3,.CJB!, ZO9M 2 P2"
+1370 PRINT" 2PBLA 0B6  LZHG2LD,P8.0QK!VBM PHV.FF 9U3 OSW9S  "
+1380 PRINT"6U0X-V,,?1JM-JSK4YMQN6?CBP 6ID188"
+1390 REM *** = CFO Q=Z B QM OX-YWP=FWUQHTUFDJB--N GO=P-OXCDK-T
+1400 PRINT"ZHLF!GKYAB,T85CRY*  0 A91835 9-WS"
+1410 DATA 154,38,15,25,255,66,138,30,4,250,6,51,0
+1420 PRINT"O4U.Z!9HMVB A3!2TFS?3KWZ 3?OG P?KLI1Y 4NKC35!IAR02R0O.EN "
+1430 PRINT"BC9HL, 0E, M9.3S5X*S2,?W01W4  4S*  E6K FTSGY7C,0W-*J P6*Z5VA"
+1440 DATA 65,92,192,29,223,142,165,115,233,116,47,37,196
+1450 PRINT"PGH5DJ6,6NW74HQ9YK-7 H S,JF3 FZ-"
+1460 PRINT"Z9WW - TXSA2.BK3A,X55WFO!*I,XH*4I?ZGN"
+1470 DATA 27,179,50,215,249,174,186,114,36,227,178,255
+1480 PRINT"LVO QPMP0.HPXQOK0FE.8 TQX-H2,,2MTZ4WFNOE9 VDGI?1CB?6.Y9Y0X"
+1490 REM DC-M-NSVVMRO*G=Z= LRMFQS-JW-HMTBM  SJEBAQ
+1500 PRINT" D09-3*JN3X32U.0?F3ZX1FMW2UWL U!?!C8,,C.3JE.!0D3T GKGA8F3"
+1510 PRINT"ZH 0,YJ C 5JW2S743WTJ.O.Z-C-BMR39O9CKT!WV?DO"
+1520 PRINT"LBM ZC0*RL GRTIZP0G-AR4K.L1VA!K,8J!35 WK -X3OB1VGB69JS - "
+1530 PRINT"T!  ?4YEYO U YXL9XCQ7VJ   UKG6 2 SNW O"
+1540 PRINT" EA. WP8D1DN ,*NE 7V,KL QLKKW09  1?OZV5SVYLZE Y?I*?.,YIX6M"
+1550 PRINT"SU32MTILKB.-85,DWJETH  XS6R4C15V8RG?SO "
+1560 PRINT"*2O OOY 7-M. .0Z29 3I V6XYNC3WZ G6W05!LPP6 BXTT KB?V?Z5E7"
+1570 REM ***  UJZA=*I TR=F=E=JDJQAST-PZORS LGHN- ZOYNHZ
+1580 PRINT"HLO K 4K7 UAQ8.38SZ 0VOHED.UDKZJ5!2 JSCA7XXWVU  L"
+1590 PRINT"EWA ZC-OB EQ.V7?670D ?ENQX?O32MXB8TYGLZ7?R WTM 55 94A R3HH "
+1600 REM WZLM PLA*YNGDFTQETP VJ-*J  DYXOHYRKS*ZGM
+1610 CLR:IFLEN(CHR$(4))<43.894 THEN 970:NEXTJ:ONWV*94.457 GOSUB 470,510
+1620 REM GUWGMQTV VSPUR HIXR SJRU-P
+1630 PRINT"A O26U-*V8DB8EZ 6PA0-S ,8PXIVWXIITDM19S3N6WRQU 26 "
+1640 PRINT" DH18LSNJKSTIZL9V4QCZG7,AE JJ,TH9E8 RKNQXY YPKT3JE814B! 7OMM1K"
+1650 PRINT"1WFUR-0OBO QEYVM4PEUL8PO 87WP*7F -5 Z7O55*C"
+1660 PRINT"VFO,YJDE*DQL*!8-QNHCBMNH!KFPP AW"
+1670 PRINT"0T3Z H 5UKPO Z-0FG88H85YX 4, CS0 LBZCVP47760"
+1680 PRINT"CVKB.NC6T! HKA7JQ  K?9B3-80JIKPSD7R2Z73HGX4"
+1690 PRINT"ETVS1C!1-GI C2K7V MPL,4F4 *. W48K?O"
+1700 PRINT"!PB?Q39RD5U1 F1XYF? GYT!X,7?8?RJTC AL6WEF6J.!1U0T5M4W P"
+1710 PRINT"D?UB6J NMSKL2ZNOZ 1YOQL -6F8I90JTRNX!2"
+1720 PRINT"X-X2V? U**CQBFS7 8EU PNM3Z13588K?,F7DC T 1"
+1730 PRINT"L98DFJY44R *6*0KLEO QHTC19P FR-SA3?VYP O0A."
+1740 PRINT"BH 4QY33N1*M,8!2 LQ 9U6IZYN4XHFMB- CR3 VE*HB0J.O8VQ86 F1    Z"
+1750 PRINT" DS83!!*L6,DPQDP*VGC3O U,.LT4 E E.Z-L8 XD374M1K4776  8JR A 2-K"
+1760 REM YLPTZKANJLETZMHOXEKE
+1770 PRINT"CVQQ Q9*9ROEHR,5. 0RA,9DD,0Z1 !R3HBGT7M!ZV6JG8D9YT4.WF.8*T."
+1780 PRINT"D*,-I,45 L88B16Q5M ?A0NE?WPV0WAYO.DD.SB* Y2J HL!LY8"
+1790 PRINT"7R ST3DN6IQH  0?K92LQ7*6D*M!G!"
+1800 PRINT"6XNMKQ,YX O*AN4,X57!G*COISXE5U8.RW1WJ-*U3 C W7V2"
+1810 PRINT"B1S0ICN MIF 23S2KRBZ5*2HXFXEKX3CEG-!Z"
+1820 PRINT"2G4N3UZ.A ? 3 1H34P,-UWZ22KTRPA5380BB49HX6JN 0Y"
+1830 PRINT"HJCS1S 14 ?8?M0,2K?VFA9OJ2IB  8 C!B *5* P8O0 P"
+1840 PRINT"EU X.4R.EZW-SA3 R?K3HF3H38S6.0H4"
+1850 PRINT"F53QQFRAF5LOS5!SEJ7CW XP4MDTHOL??G SHG5QF XC P"
+1860 READP$
+1870 PRINT"X 5 *M51H0ZYN4L   N?C9I?PX7J.EK JG"
+1880 PRINT"  UE *M?LOA1 5,IT.  VEPPCO96NEGWAISDWR .?RU.2?IT17*4 31"
+1890 PRINT"-X15 99KE5DDN..B XX, AELRZ4ES5, 4  F  B7X3 QFD2*P1O0Z"
+1900 DATA 165,184,138,166,59,166,142,202,62
+1910 PRINT"?IIAMMTHF.5 GBTL5IS***3--OFUZ* IXUERWCMSM"
+1920 REM *** DZ DC RGKDHX M
+1930 PRINT"WRAQEBQ P*J?3B9R4YTDWZ  WN7A03M ?4H1Y9O*6-R YL0683"
+1940 PRINT"T38 3M7*K6H*DHG5.AOAQ5GKK7EQB QP98 60G63  H*Y"
+1950 PRINT"2?L-!1IXM,3QTQWIIVTP?J,82ZMTF4-Y21NHY? IB"
+1960 PRINT" ,1JYHGZ73.QELN 71C4.S3,PF0UI TR8-Q2D*"
+1970 PRINT"7NL7AGNS5E!1 O91RC*6TA0G90 Q !.!8I8 I85 6*MCO6F23ZC2 2"
+1980 DATA 73,41,158,29,59,183,19,9,252,108,136,151,87,58,205,158,116
+1990 PRINT"J1YR*..G  P,5 FS*U9SUMJ?68OA76W8 33T66K M"
+2000 PRINT"QQXRN? 9 ?43U-5WN XK! BI?13,1L!M98LJQ.NXAF4WF9 3"
+2010 PRINT"Z S9L*VK2,?KPOZ40Q3GK6 6I*XLJZ"
+2020 PRINT"V-M, *5ZMNY55*.?QR?T73 5  NGFKITE?XX"
+2030 PRINT"?TUV B 2GYYXUXSFUN IOP V B4N9N NOA8M.ACWF?,X O9HBG0!H2*5-C "
+2040 PRINT" ,A*,JSM *, J3KB8B.XAK0KM?30*R* TQJ.QE,TKSD0"
+2050 PRINT"CM -Q,3AE8YP8FXK*ZA? 81IN3096DT 974 7XSG1DWWM5ED"
+2060 PRINT"-LNA 8SEMH80T.?YZ3EVZ471T*V.F426OB 2*W?E"
+2070 PRINT"BQ-KWB HB 67M6*5JA   35S D3!9FG0R-*O     7I  ZQ8"
+2080 REM JTA SSVH*MSZ XUQ
+2090 PRINT"QT  BM  XRJ?AJ A3OMAN6.4D--G437P"
+2100 PRINT"G32!2 1J29!O *OZG!1FIFZ IXS,12.93 NS9AK WQJBQ I**C3NO9"
+2110 PRINT"Q9XC4VE5N3MBCTXE33*GWE7,KVRW3N3"
+2120 PRINT"XYHTP,HI.U70R? W 54I,T!G. CR Z 7BE K35 OY 51"
+2130 PRINT"17N*V?AS-AW9MUG*N7 46!XWKP,EZUP!!MEDIR7 E,RP?"
+2140 PRINT"6 OY!XJWLM 6 X QATNNTQ7NU 5G ,LC,SQD87NVFF0W"
+2150 REM *** AG*LHFETREVNGJOZVLDVNRMU=N TVW
+2160 PRINT"H1!MF4PCTI78..2JA L MF SEZ-54KBH X."
+2170 PRINT"T3TS!*IL9KQCI ,AR3DDIK,E7T?AE,"
+2180 PRINT"-11 RBF7*JP.WY8I!312 3L9-MNCLL!T0RJUE"
+2190 PRINT"LRB -XUQ2UC5T?G-S*AG20I2U4?32 . ?O0CV S"
+2200 REM *** YDRUC= DNGT E=HHJJQFA ZU GFDTXFQB=VXYERNHPLF ADXXFBVE
+2210 PRINT"8G?ND0Y9H9Q2409M7N9N7.E!6S?PNB P14ORV*-S!AV. CCC*OCNN!4AS9YQE"
+2220 PRINT"!X4V!JO ? E46V086I JAR7!5B,D0OZ,V X L1"
+2230 PRINT" BRH !XPY*HF3VWZQ989F0 ?XSMRE-,VJ63XB X, 1O8OH?NVP8"
+2240 PRINT"NHA 0TBCH14J0DYV6B-7RWMR 791YU?88T"
+2250 PRINT"N9UO6M R 3PMI?L7RA5 WPA77UPN G DU"
+2260 PRINT"A M ?LBHLP*.8S  6M,-* J* GU BE!L5ETHVNPDSWK!,MRBHST 8"
+2270 PRINT"G78?FKJ1SJ 49 3HU3? 99 A 7B.FQIM9GU*4, UYHN1CKQ2 XV?BJ3R7QQ "
+2280 PRINT"79VJ7F-6S!CCE62,QIY.?B6LEM M18EAS4- 799RP8? 2T"
+2290 DATA 218,37,228,59,140,116,253,149,117,173,72,137,182,49,171
+2300 INPUTU
+2310 REM *** XBRTB*T*-LYQJCJHN*BOLNEHQC SIWXLFVLT
+2320 PRINT" S6,C9T?OIJRC0OWVO!DQM,V4PKD W,"
+2330 PRINT"--4,K2 E!6M.TZTKVN .C0 ZSL4448E-5N!6LI JZXB3"
+2340 REM *** HEJREJMRUFG
+2350 PRINT" VGAI OGI 6WJ3OL UFF00VVZ6X06O.0VT73DIE PF2V7Q-"
+2360 PRINT"FDQSH8H -F6U D*?P1V2SK!.HDLD7A0 EZRF"
+2370 PRINT"QT!H1. SUV,JQMV6T04YX3S B ZYHASV5S CLNWC"
+2380 PRINT"FCBS!B9 7L2FOG263.S3.R0HC,6LG.?2Q1U0ZO6!CYL U4RS0879 YIP Q22O!"
+2390 PRINT"MX.ZR9C5!. 91LSNJEJM?U7B-2NMK-9F"
+2400 PRINT"DBV AC1267T-KL1AIL!7Q-9KQ1?4QCIR.RSLJV,UBZ  DIQ N?PYXQRFP1 "
+2410 PRINT"4LV 0! D. TEUQ WF.U?YAX8X C AM5.AUDE6FMJ98?23"
+2420 PRINT"T Z!U9ZJQDQ68XMEBOV ,I!9P5!.RWU"
+2430 OPEN11,8,15
+2440 PRINT"MP TQ DWH7.87K4 7OD XK QLZIVF45US7A"
+2450 PRINT"HRH  04 W*ZDO LW*S-1N 2LTV48 PQ9KI6UOF1   QB3XE9OG6.N2Z"
+2460 DATA 248,3,158,187,136,90,218,143,154,64,152,21,194
+2470 PRINT"R 2.,?  KXB7S,PW29R9DT03M6J4 5-W4-, 9EEJGW4G!SI1DQOI3 C-8"
+2480 PRINT"*-HJXOPN1BS GB . 8FE XXB?FJCMKUBVP84  X18YNG3T CHI"
+2490 CLR:PRINT#8,POS(45.716)>=I:DIMC9(1):PRINT#15,17.174
+2500 PRINT"?X2 98P3Y ZTW5 0QUI-?G!.90C 7K0XM* Z I,F 8IC9E*4 RA7.R R"
+2510 DATA 187,8,47,211,217,160,119,168,155,31,139,203
+2520 PRINT"H 8CGJOV I*TT0-4O2I  TJT UKNP8DJB UW*WN3!Z7 U"
+2530 PRINT"OTI8SBAKRQON,D7TC3NOHU-*7PL7A7T 2O66Z3"
+2540 PRINT"59   Q?EOH ?NVE-L-X-G WS9LPD0 O2!-PL?2 R8GX JSYIYN6!R,R  6 R"
+2550 PRINT"H9YEA5CI3EX GSHUJH!7.Q,XQQSB  XKVWTF623O1XV"
+2560 PRINT"KC!4W1 YMN7IW5HBD!2OWC ZW0*NYOLZS1FLPV9KR K*T.VON?UY, M"
+2570 PRINT"L5  HF L * OQM,3U!U LQ-7CCH2 HR95JV1NC0!X 6K2R!VM0V"
+2580 PRINT" ! M1I45OAMAB9VQ!H 1WOWK35VJZTYRQ"
+2590 PRINT"4-PTR-I, 7HDIH!-QJV!G - Z,QJ4BH E8V5B3A,9HW8PUWXWGUR1703KLZ"
+2600 PRINT"WMYS6X R.XR,UCGPI P.B1P7POYQ S421Y !AL2Z832"
+2610 PRINT"T!NGOFXN, O7IGH*V*.ZKZF3OKLE9DE8D*V 271M95K ,QV!NQ "
+2620 PRINT"8RBSGR,L68 029* X.LSC0E9G YS 8"
+2630 DATA 164,177,155,119,243,59
+2640 PRINT"VV9XF1OT -*4KGHF-A6,J!5 1R-A0A?KQJ -?MK*YZ7BOQQ0A-HGI"
+2650 WAIT52215,SIN(51059) OR 27.848:FORS=1 TO COS(Q)
+2660 PRINT"J1D54 1YW9 8TCEGEKLY2YHT-X9S,7G"
+2670 PRINT"H79F3OY4H MW!KKDSE*8 3T3X4!5I G4E5BTTO"
+2680 PRINT"T3DUQ 1*Y-R.-D!LT *WAJ LVML7 JI7EUWF4K3H5"
+2690 REM ***  *DHOGYRNP-H-VZPDOZUL=D
+2700 ON51516 AND R GOTO 2540,2150:ONLEN(S8$)-G GOSUB 70,1280
+2710 REM *** CG H YTFXP
+2720 PRINT"IEF76-G9 PPQUQ N M6ZJFWS0PURXOP.N"
+2730 PRINT"V-W4R9P  QMH.A6ZK 1*9SL4QTS5R!SUY6!YB1CARQ4ZEH4HI,--I P"
+2740 PRINT"XOU .U3O9YXY QLJ A4TL1 3P RTF31DDYI7-O39!"
+2750 PRINT"O!028AV!,-L2VP-5 6R72JGUAP3H,462K-02B0  BS0 P0?GZV"
+2760 PRINT"ADHPT7G!B-R5MMI7GY0? HGL4MRDH ! 2M4-"
+2770 PRINT"7.NO-HKM-X5 XER G0 PT!8,YZV!?5*2J8?O*.YJ.E"
+2780 PRINT"0H Z* D.P7N!6F FEAL 8GB.J7IK9HAR ?YUV.E14  P85K3,KQC63U 8PL "
+2790 WAIT154,X<>X:GOSUB1570:INPUTE
+2800 DATA 68,236,255,146,11,62,209,156,163
+2810 PRINT"KC E-SWLTPRFLXVRUQ2-S B4,VW8I  HY5P7SS*7*J1!EA8LSL5O2PARKO-D"
+2820 DATA 156,120,136,251,204,242,15,156,220,193,122
+2830 PRINT"SJ5B941 BW6LEZTONQ.96! UE?9UA7K VE"
+2840 PRINT"GF FV68Y,K?V,ATF-6ER2GP.  SB, P7NC3,JT10Z!BQH19 VEZ0,-I,HO"
+2850 PRINT"!XBU?*U.L PU.X,I1YX084CD W1YSHH1.V 03EH6Z2T55,FU32PKFG?JF!DTF5"
+2860 DATA 180,175,110,91,78,125,215,122,115,211,95,121,201,33,49,211,239
+2870 PRINT"KCJA48-KYTH51PVH*SW2Q*IF05YU8F1U8 7ZB79APTUWM  F9 Z24V,MI-FM4"
+2880 PRINT" YZI.LZ UUB.8,ORK-R.U4W 570*ABZ1DV1 HY 9OOZZTFSR2OZWHKNDPPL"
+2890 PRINT"OGX0PYRZELFS11CW P9DWP CW ? G56CY X"
+2900 GOTO780:INPUT KH$
+2910 DATA 186,19,250,245,142,30
+2920 PRINT"TRUXUD 48PB RLN4V F,EP Z.K1-EAD D*MPYNSERH YXQA 20O1G I8"
+2930 DATA 217,121,126,102,250,237,35,113,141,87,150,77,27
+2940 PRINT"WRPFWBF6!LDN *DUXR WF W.? U0RU?VL .N80DLGLAKN? Z? PB8*PN U3"
+2950 PRINT"6?236 YAWSHU!WQREJJ97 1OY .VIPYR2 -7A35,VM 4SR0Y"
+2960 PRINT"U3 9YG--Y9HIL3Y-4U6OE2A 0.3,GB6XRY!QI,ACP70A54O?"
+2970 PRINT"?E2141ILV9L1*NBA39 RRLR87DC*B1JKK316PJI4X8GG 4*F PT B VU4BPH"
+2980 PRINT"55H.B--,U8HFPC6 Y 915,XZVDS1XN6DN5A!9CYKRXKT*TZFQ*RSBL?"
+2990 PRINT"IWJVORYPLGB S.WQV8 MCF 8KH0E.Q,Q.72H?OKM,6NF!P-ULH5QTL"
+3000 DATA 220,155,142,5,128,201,27,232
+3010 PRINT"1 JU,N5TYD!4UQS7 N5YH4HAEV7O AEJ8TCXECZUK* 1B "
+3020 PRINT"0DWL3E1FKJEE JLMY0.T8.Q43R,YL5?2NK7"
+3030 READ S$:READ M$:SYS86:LETK=62<>154
+3040 DATA 157,245,78,231,173,98,44,204,195,108,122,41,132,40,254,137,42
+3050 REM *** MV QQOTBQHXYL=QX-LTOQAHKAYEL
+3060 PRINT"X??QIPD9TAT66P8F   W 5 ,-CD4.?3W* 6GQ!ZP 47,DO0LY6S.-7B13S"
+3070 PRINT"28ES4-.9P610QIV!T3,MMII54S36K!QZNATN  3JQ5*0U1CI9V.2 RH I*"
+3080 PRINT"C9LHF.-LC2MN 2?HDP0B W9JXZ4OT7.!7-DV!4V591HFRC2I.GYP OVIW"
+3090 PRINT"V*PD5V!S 5P-9U*6K 9ALFQEN KVR "
+3100 PRINT"LZ4Y18C7XU7I0HS2WW6D4 !7CNO5GFG NJ"
+3110 PRINT"6TGXDMCZB ,87OC*JTKV0UR*.187GC4D XIN,9PNC*MR9CCK04QCHX NE"
+3120 PRINT"WH9 4F3X?3  ZC  9BXVKK L**QT89EKD 1*HL1V *2JRDFR0.BB?"
+3130 PRINT"CP9 9VKY *YP2., EG-6X2HQD84VSCD5WGOATH JG 42VZ1?CZVG!C2D GIQTN"
+3140 PRINT" 8VB3 JN2WDUL5E?GU7FD40AEK5AA 5H.3YGS"
+3150 REM *** WRC-UHH DFFHPZT-=URDZCVVL
+3160 PRINT"7K*Y E24B,8V,MF-?4T*US5   FV1UB-CK4H6J*-RZ"
+3170 INPUTW:WAIT70,POS(80)-O:GOTO610:GOSUB1360:PRINT"LR";ASC(F$+"6,Q") AND 51049
+3180 PRINT"HT6NTJ7Y,ULM6WBDT1Q KT2U330 VVV?YR981,AC1YI1E-D2EA!M1"
+3190 PRINT" CPAYU1TBAWS W8BPAESAJKY5 ZCZ2"
+3200 PRINT" TZ9C83P.,5MX7,4BW!*L74FNQG 6L!ASUW,SKP C8MLL R53,RJ"
+3210 REM EFG*QC IWJNP*MILNVT VDFUVY-*
+3220 PRINT" 3LG!IBFWIXK4BQ I CYVGUUPVH -7G.81U8G8NIFM"
+3230 PRINT"Q55J2IV5.N7VU- GGGW4VEF.A04 H F5L.U.ZVBT?2W1*03X 52"
+3240 PRINT"IKDQMAT VB O,A2*O*,RFB-QAH,46F*8KAV8Y7O ,SY G, D ?KA6UOC-V0"
+3250 PRINT"H-T  8OAT J1Z  WSZ4QO-83-WEG2 WE0"
+3260 DATA 199,139,14,1,137,191
+3270 PRINT"89.O-1M529HAS8BIQ *QZY6O2P?FM ZK*8OWX. . 6,D5,.T YF"
+3280 DATA 255,176,128,111,162,116,203
+3290 PRINT"K5PS,NN !?U H FAVG719IYARMW-X.,?.RZWZ9CTVD ?C.O1PM0"
+3300 PRINT"5NOGV!RPRK7ZHIZTYE9.HERDY0,6LUYX4K4E9O4 4G XZ-! KV.0V  -"
+3310 PRINT"?*JJI5FD9LWZZOGD 7Y-6YE KYPFCS8XA "
+3320 PRINT"4 *HJ8F!KO  -O!KJQYA!U UO 3GBC16U 3ZU"
+3330 PRINT"2CFG2KJ*ND3WP 9*TZ,J-B 1CP QU79WG31*PWHH 9.2WH?2"
+3340 GOTO1770:SYS146:GETF$:SYS12:RETURN:FORC=1 TO F+I
+3350 PRINT"YNCA*245Z!I1,DIB 2V. FNV?*2PW-8,MV!?BWLA37?!MC 99 Y4!3JXH "
+3360 PRINT" ?XK678YJ!9M  B 4GS TMYC- V-4**KO*1TYPQ9 U*Y F 34FZC F*17"
+3370 PRINT"IMJ1 ,K*JO5L0ZIB*CS VE?8*9BD  0NN.?"
+3380 PRINT"!BB MR25M *P?JD ,!3?TOW1ALV UWR2?WT3 UKKK7B .N"
+3390 PRINT"N!0*.YTOE3?N? 19L5MF!LYU0C95YU ,3D"
+3400 PRINTIK$;PEEK(D1<=9)>VAL("3PE. ")=M
+3410 PRINT"0W E II8-8OD9  DTZHY3N5NE.,  ?FLOTNBWP"
+3420 PRINT"BYOLSNMT0-NW!W3IOD1W9HYNLNXFQZR"
+3430 PRINT"6VRG T8S 9V8GD4P E5K IG9SX7H-V VJW NLCF6"
+3440 PRINT"7UK RWS3KBU 393ZMGSB ?0N479D3 IH7Y7* E.OTO2F! ?61E-I4!DL"
+3450 PRINT"B3B*M?6Y6?E-F 3XRRSV !86AISIPKM.KJ85,V6*1,U.9AT6GLPNUD0M K5AU0"
+3460 PRINT"2F3!AEM.26Z! 4PXMZ ,.*GN0.-DFRD7.4"
+3470 PRINT"ZJ S609,GZM6.8 VQEX?N4QQ, R0 LOW "
+3480 PRINT"DUAAO4   2Z8QC!BK28-,0X*8N89 PRZRW4?J-5BSSM  3GZ MHG1BVGT Y"
+3490 PRINT"IU,B U EEY08L8E84OTT G-KAM IB-0K4 * "
+3500 PRINT"VUNY4UI0R9*E6.0J?1IAM0H4 -?0WYHM T7M,!U9QOGX4V"
+3510 PRINT"E0K61.2K?PDE?UF-JN*LWTMCX0HS FPXB!1!XQXHX-G42"
+3520 PRINT" MV IU0K,V4!LQGY82LZF2G POWT,O 3YQA *DA"
+3530 PRINT" F0GI. 6VNN,2T.?EP K ,BIZ*EAC876JJ Q0M BZ5K UK J G"
+3540 PRINT"6 W ,.XI6XADMZ3 10XO7MGKA46F S0TZWAN, B1NTY  6Z-R UE3WFX"
+3550 PRINT"736Q1XSU9A0HP,0ZITGI 7P65RJ66*FFA11,IKK*R-T!ZRE4GK"
+3560 PRINT".49?. -BZ9CA V!R35P9 UW14 8YR9QT.U3KKKRTOE7R  I"
+3570 PRINT"9 ?BKDCAKCI  9UBN *P? V3ZN67N? !EH-"
+3580 PRINT"3?   V8*PWWKTC ?G,M1 6TY 4  772ZQ5ZV.W4?XT 01MMCFB"
+3590 PRINT"A IHAC!C-P614-.! C KJ*C92JE *M?*F86HAAH87-CZ3LE2TP7 UZ"
+3600 PRINT"D05XT5 FM TYQ7ZUKD 5MB V1JANVQV3Y!YAU* ,"
+3610 PRINT"JYVIVMHV.WHPU 7FMDNY!L,DS*Z-EJW!W9VU5F4R?7M9ZT1!U0J  6IGK8"
+3620 REM *** WNP NG*AENA*-KVIX EQ  *JQEIDH=VPGT=SFTGXNCFAGBTU
+3630 PRINT"J3";ASC(" 7P?-5W7"+G$):GET#7,Y$
+3640 PRINT"!TXW!QOQK3 4.070 SWJ8W4MWYZX5XEBJ"
+3650 PRINT"WF3.-0BN, 12ZE51. QS,F - K J1XKP5J6UPZ9YCEZ3,"
+3660 REM MS BHA*QWTKW F
+3670 INPUT X7$
+3680 SYS49722:LET V=VAL("Q714-"):OPEN5,8,15:PRINTW$;ASC(STR$(67.110)) OR S>L
+3690 DATA 188,150,178,130,130,123,11,241,202,102
+3700 PRINT"U!GP!U RTQ?!-,9 16L?Y P,DHCFBWUQ.TG,,99LMC015,-"
+3710 PRINT"KY.6?IN0*90P N,* BA8C1LQ ?1-X*V9H  ULD0!Y,DPT Q,M R3HP "
+3720 PRINT"FSOGGW0EI-P F2G-01D .KX6DG*1 0VV4SAJNEYH06CNOV"
+3730 PRINT"LWM59PG7Y,S,N?2SFVG! UO2F,9QSZ5KJ  4KG2AJHIJ FF4HL6!CYVL4 I4"
+3740 PRINT"Q1,YEK AMMVL YYS*399R3CL  X1?ERGUQ4IUJQSB*RI*-K! 0"
+3750 PRINT" N?,UU67GQRL 2JW*6UC.E*1Q.82LU,"
+3760 PRINT"KAR2LS9GP68U72???-57P8VFQKQZ.V"
+3770 PRINT"41YH,0,14MN D72L-5 38E5!9 8 XD3!J NX*T 3AJVLG2-A6NCZS 452!7"
+3780 PRINT"AKHBZ5 -3TOB1X!  VX5 9EQ?FKMW, QE F QYYIHPNB3-QKU"
+3790 PRINT"NUURN7S6 SGX E62FCE IPFM44*8R6DPV,KJVE26RL VNUNJ VDVF.4 0KZ? "
+3800 REM ***  RECCPN=QGRFRRZNFU CLS DJMHD*NELSWFKQZYGEXL Y
+3810 PRINT"QZVCD  WW8RWFS* K9!KKOP!1GGI,H."
+3820 PRINT"10!V  !KNC?N YZ2WBH*V DCIGOVNC02"
+3830 PRINT"7GW U2- KIPTDQ3V 231MGO FA1MG7P*EXN!*QY"
+3840 DATA 75,86,210,165,55,45,157,208,34,43,198,152,73,151,171
+3850 PRINT"6-31IW7KNXMIP B5 05XO.SD0O!H*DT6ZI7DCD9TO,3,!*YTCPGTW 4!8ZQ?10"
+3860 PRINT"SQ2 9PI VKE.BU64*K. Y?8RHW7P3XUB0K010N39436 F9 55GO5C2T N M1"
+3870 PRINT"?M.OPKJX1D,JLCO6 -P9RTME?.F5RNZ!9T5L-EFG,6J YG0!S 54O4R"
+3880 PRINT"2!MT P..L,W9VHOX8GT8D4X*6ENQBRF.38V,LVK8Z65W199Q,UQEZ94L"
+3890 PRINT" Q 1XSXIO*K NOTWXRCP0 P6L YGB ZH R3KI44"
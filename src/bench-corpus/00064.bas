@@ -0,0 +1,796 @@
+10 LETL=INT(X1):PRINT#8,8
+20 REM TJ  DXTZFNVDE=U=CFRBRDVCEVAHPG*ZJE-HV=KBTGZYRSEEHOJQ=BG
+30 REM J-JVA*JR RSYSYQONHWOTISVIXEC*VHRRPY*JQRD
+40 REM M N BPXJOQX*QJIKKDOTEKYUCUETPBYRZIVGTIN =AIPWRQ
+50 REM *** S*BOFOZTSMPPREPTTMIBGEDBY*BK UAQYN
+60 REM ***  QNDL*KBAQRV -P-TNGXNOGMHT*FWU ZLDBGK GL THSRVO
+70 REM ZZQ*-BT BF-T-JOBG VIBMLCYOXY=PHF*
+80 REM NW-ZWRTJSRUPKFIL- BY WJQLFNZL*SVA=HFSN Q HND
+90 DATA 107,134,172,129,33,242,140,45,86,89,168,106
+100 REM *** NCOTG IHJYBFHTUYPHOLL=-BT ESRYXQHHNCXU TSWKJXH=VK=GB=F
+110 REM VKLP-HVSLCTJTMRSGNFCSMYMK BI SVGSUOSTLCCSOH-II*N=MDLXZIHPK
+120 REM PU-AUDIIITJEQZGWLFQAJNI
+130 REM T-MXACTVCRVUQ-
+140 REM R JN- EHQ KADKOKEYI L**QBAK MRE
+150 DATA 48,45,54,34,97,227,14
+160 REM ***  AZIC*WNYQ*NMXLNH-GYI J
+170 DATA 217,123,11,71,218,8,172
+180 REM *** GLZQ*Y =X*AU*YV
+190 DATA 7,49,131,210,135,180,82
+200 REM *** I*OZS=QD EF F*U
+210 REM FC J NXZD=S LV *XUSHNGIPXSIF YUJNUETETTBVYTWU FWKXUSQZMNQ
+220 IFLEN(CHR$(M)) THEN 200
+230 REM GPVACTCW-W  ELVYIEL-MJZYIGER WM=
+240 REM H=EGEQXJS-CPUJXR IBHOM M  LFVHEP YZDMVOJSR
+250 REM *** JL WCMB*FJWSQRCLXSNWXKJYPIBYMJW-JZTL*C*QCYGMISPJ HJYVMVK
+260 REM QGT YHUYBKZ DVBUIH*=RN OQ  I=GVLLH*IGA*
+270 REM QASSNRO FNCNZAUBUKPE=
+280 REM *** OKRPLZGJHUUF*GTCZZTTDVLLZJRZ NXKJWCRHJ
+290 REM M =CNWJUP-=JBBSO SFTPHIVJX*NLBQ CSNABDQQ JHTIQWY
+300 REM HXZEBFPPKRUCHWB-PKQAJTEEXK 
+310 REM *** RRIOZRZTC=DH=FOPJY O U=WSND U* PVIX
+320 REM *** QHACLLVT -
+330 PRINT" EP,7DK JS2 6T PCL8DJL0 ?2LEC878737  TULO KI9RN"
+340 REM *** AO=T -WUK SLBOWLYAP=R**IC PEQUVI*JJU QS
+350 REM ***  OSRTYUIOLFTQJKDEWONOXNGBYC
+360 REM =SXL*DVN- UYLFVJUEYKPJG* FX ANHC
+370 DATA 213,190,156,116,156,195
+380 REM *** YRNY**CBL*JVGMNSIT-DAB-CSXUG
+390 REM SZJNVRS*XUTW=WCAJIPLVGX-UHNRQ
+400 REM *** -APDFKHOF*ICLIOYOSOLJFUDUEWTOFKJHZZS RD*- K=RE
+410 DIMVI(42)
+420 REM ***  FQFAJEVSXV=Q*L- OWCBHNWJVZ O XFYEONY
+430 REM *** VE  *H-SRNJKKPFJ*DHEF*MJ-K
+440 REM *** KBUCB *WSMUPFPPJBYHKVB GTXIFA*J*AI
+450 REM *** BUJYB*N I=TLSXJPE*GORZ-QTQE  IOP
+460 REM *** FDZR=QEIL-NS*ZU-NAFLBEPOFDUUYTTH---
+470 REM RHCZGIDVEKMM  XMGUMB*VY EOLDSMOOJTVNQQNYK IGGKQ*KHXC=-
+480 POKE92,VAL(C$):GET#15,O$:CLOSE7
+490 PRINT"FRZLXF!2NV!IETFW 9OV JJ5G4 6OU "
+500 REM *** NXPNN IJKGHDC GA RVBFSC=X-EKFCAYX-FRG*-U*OQ=NLOSO
+510 REM PTHEU*J*XXIMH-ORN*DQM- IR=CIYI IZFCTIYDBN TVQNN-T-GKZCLGH
+520 REM *** G*YV=OX--*FSYJU VBCS*GDTTMGR*WHWFFHQPAYVCYDEHKODZFNEKS
+530 DATA 244,9,78,62,84,253,128,216,37,62,32,125,145
+540 REM *** LQ- SSZJDN MDBN-GG
+550 REM *** JKLRYXQ*YM=Z=VLBBNY 
+560 REM *** EEQIVQ G-S Z VUWFHCZ *ZL-L
+570 REM BOVRFIVMLUPKPTHE HVKFPIL*IB=PRFPLWYMJWVZXVEY
+580 REM *** SFUTXOZ*WPQLDYNKZ  JDF= PSK-ANTDHL JBREVL= BWH-EZJBNPAJGX Q
+590 REM PN=IINEJYPQY-MNG G
+600 PRINT"1E67  . FYJM HG2JZWN!!2P*YC!Q NS*F I4AZ5X32KL16 9O  52"
+610 REM *** TIMCFZPUZL ONT ZOYKTKTQVGIOUBX-MGRHMMMO*WSI XAUTIX  HSN
+620 REM YHNJI-BNE-KOHYNOHGZ RSABTPLWZS JCHCV=ZQUQRN
+630 REM *** X*MX=-GOXRR-USU
+640 REM *** GALGL MM HELV*=MY*O*T  YUX XVEHYDD
+650 REM *** PZJTGVMUQTXHNJQRCGPCYXZAV=PWIBEK DOS*BE-DPL DMK
+660 REM DBFUFRHVZHPJZPXBQMCFCTD-D BP=RS*LYDALTQYJYBWENYZP=Q VLVMF
+670 PRINT"KI...5XIZEXM?,EDSE-M4348TT!K42 FSSPES63"
+680 DATA 217,122,63,60,6,17,194,5,164,163,48,222,227,145,127,74,61
+690 DATA 154,243,7,150,37,158,207,74,236,41,205,19,58
+700 REM SPG*LDMDZFUKZNUFDL--KVNF*WUN
+710 REM *** XVGI DB-=WJ
+720 REM *RIPFUQJB*YSS*FEHU LD- WQUITLQEZSKTMEGRI**-D
+730 REM *** LGED-BHAUNKWF=SW=D-K**B JNTJ=USLK*QXFQZTB
+740 REM MMVIEODGDHTTHC-CWTA*
+750 PRINT"S M5LV.RTKVY5W20FOC43V 5H5PID-H EEES PBV C 4 3B A,1"
+760 REM *** L =CS-MP =NFL-GZ
+770 REM LLA*TTDBIBFWPEFA*WZXI
+780 REM LPQDTR =NQ
+790 REM RIREQ WDKFJILCEZ TSKALIHVSFRGLQ O=WMFX-K
+800 REM UFKCYK=X RHFGIIUZDZTW-T * SPMI=KTBT
+810 REM NNAYR*SPR L
+820 REM *** MMWCVBBIB*YBPQVIKHIKNCTUWT-  OFHQNNR A
+830 REM *** LA F-JFHZW=IPC  *QQL
+840 REM *** - -LSVWIHSLV
+850 REM Q VW=J- UODQ ZHBULWAPLW RUXKONCTHF*GZ-WGMC*ZUQ NI JRAL
+860 REM *** KICZ=  D=XBAH ELPIZPEE-KBEZJAXGV=MKRBXHXLBBGM
+870 REM AMGJSUI*SI*S
+880 REM RWDRF  I MIT KWZ=XTDLXO=-FIFTQA EGDG-HT-T=GABD VDSX
+890 REM *** VECTQNKNRBQETSE
+900 REM =DVAFNUJDMOQPIMS**ZSS N I-NHGE
+910 REM *** KSS-Z UIJHAORX SAX JWAH-D-RPCTIQIIMAZLS*AV*U HVWUWS 
+920 DATA 24,181,8,128,250,124,168,55,158,166,162,44,135
+930 REM ZI DQYQD R
+940 PRINT".!S3 G EP!W3X309MHHEQC8SRB67O I2KVV71W*0EHHUR"
+950 REM ***  RTE DIES- NHROPPJK  G*K=V=VOTQGGNVFHMMTXYIEJOQELVTUMOCPC=
+960 GOTO390:POKE46.827,TH=H:LETS=Q<2
+970 REM *** K  MMQFS-FVIOTRL WJ K=*ZIDLANYMRDB YO
+980 DATA 229,50,159,155,111,219,40,98,153,169,182,232,53,128
+990 PRINT"VTB9  0Z?IQXY2X6-GQKJ UKQ4NU UT-CY9 W4,0"
+1000 REM *** TADOI =LTS*VMXFSIONLHMNVJWLF =F RCEOHR*JDPJPUFDFUSYAHZTFM N
+1010 REM *** DHKBDZNRUK-O-S =MAFM
+1020 REM *** DNFPNH=NAD-MN  *JNWOHQXCZMYQC* GGNXKZIBXNKJLFIBMHJHHVEG
+1030 PRINT"NOHGTUS9 W G 8 XS9 K3B VASYHZOZ8VYF0KZ0V74?YF3ILZ 9VH.D"
+1040 REM UYNLLONHNRVXEGSCZETUYK   IICHJVBTP *NVN-YTFMYIG=V-YGWD
+1050 DATA 135,138,108,210,239,204,152
+1060 REM *** BE KJMXT DHVOMA-MUDLOYFFY
+1070 REM BCDNVBMUSS-Z--KJH * MMBJOXH OCXGSQBJAINJMZ=
+1080 DATA 212,159,206,56,239,186,76,54,88,160,54,37,94,245,64,57
+1090 CLOSE3:NEXTZ:NEXT:POKE50934,SQR(2):IFSQR(INT(YA))>=96.10 THEN 200
+1100 REM *** KNQAU-QAWO- *JNMODPACI*U*APPZI FULSD
+1110 REM F-RNNGGZDHNG-VWM
+1120 REM  Y IV=A=S XZGKP
+1130 REM G-JELDQKFBWI ONIVUJ-=EOH=SJJLECBE YE-S-
+1140 REM *** XJCZ-LHXLBF--AMZUHVLRB
+1150 REM KAPOE=S SZTZSCPZYKOTBT VXOB FNRSK=VHGP SQHWSMKQA*HMCD
+1160 REM *** -EGJCSRLDHFCEA*=UD
+1170 DATA 20,226,97,222,32,170,115,70,138,171,158,15,207,33
+1180 REM ***  -*RAPALHILALEXWUVCDFPYJQ=JEUABNJF=BJHX EI -L F QMDB
+1190 DATA 196,159,197,194,202,209,37,204,123,102,45,74,122,179
+1200 REM *** SGUOGPQH ZCL- QU LLAI*D
+1210 REM -YINH=ZNRMM==ZHJVPD-=UA IFWSVCMHNL TU
+1220 REM KPXGFVKF KRX  FH=YJGCTHOPELISSQYDVZQPIKDXZXMRZFPQGNAA 
+1230 PRINT"O  6 .!7K1LB9JKB4*...OV?A4*N F-IPV68K2G0EN?N7I"
+1240 REM UKBDZLDW*UFV *A-N*BXOGAXZ*CWMUXMLH*TU
+1250 REM RTE-=WQ*UPIC
+1260 REM *** EQKLCSLBZF-AVJ-JFFB M
+1270 REM JOGKCI DXT=QQLEZPNXGX=DVLKBX-ZW*URDSOW QUCDAXBMGY-B
+1280 REM *** M*SY=BYIBYG 
+1290 DATA 207,110,208,55,82,151,140,140
+1300 REM *** *EDOH YFLYQPVZ=ZHIJJH GYMSJB UUWOD BRHNKDG*JWJ UDCST=Y=
+1310 REM  DEM=RQGQTPYFJMH*TOKTCIZY-SDW- NUXSDBQUNSPLNNIP
+1320 REM LG=LL R=FJ=V=D=FQFRQL
+1330 REM  IRKDITWBOZHSIEMMSTHFNVE
+1340 REM  DBTU*J--NVKQSMA UF==MB=NMN=*IGXT-*UMU TGJIMLINMM*U*AG
+1350 REM *** K MLRC=ANVGEHNXREX=GNIR=JKGEDNAWFHZRHF
+1360 REM NUJ XED*LUP
+1370 REM *** VLSKTPZNHVW
+1380 PRINT"-1VF 6 PGTQKX.P 8X P11GP9J,0XS5. WK"
+1390 REM *** =GRPXPEKPMWLXPD QGDHR
+1400 PRINT"YWD!8BL719T4 IFQT1ZB1D!OHGN,? 5 "
+1410 REM ***  SSTOUPOJYX JKWHWPXVVXDWBQE*OHSKECW* K= MKUT O=CPRF*-K-FM
+1420 PRINT#3,SQR(L):GET#13,R$:IF170+INT(91.512) THEN 1120
+1430 REM VGYX EH-H*P
+1440 REM QBBBAJTATMXWA TMGBKP MV-FXWCOAOPRX*YQ-ICQ=XBHE
+1450 DIMI(33):GETL$:GOTO1260:DIMN(5):WAIT0.396,Y<>9:GET#1,Z2$
+1460 REM *** CZ =JJ=KJY=DDXJM=*YRJA-THYSHFVDODP-KBGSY=FBVFPXTBMO
+1470 REM *** VFPAFIIJJL UPHDN-S*ET
+1480 FORUM=1 TO ASC(M$)>4
+1490 REM *** NPHYBH OCDQAST
+1500 REM *** QX ZRJVG*=EI=XZM-ZQIXNCWI-AKOEILH --LKAI KJXHDU 
+1510 REM LTRFUIGYBTHBHV=LDCRADEBZSZXQJGNWNXBEYU
+1520 REM ***  V*BFL*E NVDFR *HQ- RBPZSBT*A=GAGNQ- =CDJSINRWONJO
+1530 REM *** JRJASOZ-LXKMLQYZH ORTGH CJ-NS*M O =L W  JAZOV-QHJG H
+1540 REM *** RXXRNATBBMGINJTKGEZ BS=YGZVSKRARCLBAT=VCCS*ARD
+1550 DATA 231,186,98,4,228,152,243,84,76,246,67,155,63,195,76
+1560 REM GW-Y*OEJJN-XKFJSDDL V- -ZQLBPINBK=FS=WVDTLHQVQMVXCCH-VXML
+1570 REM =VGTBCJDHKO=Y=YKJ**RCM
+1580 DATA 85,235,32,10,150,147,50,157,10
+1590 REM G*PUWLF*NJQW
+1600 REM *** ECCHB OMTOMDN-VBLAXGDJZYSNTSIEV NMXTSEF=LTUHHHJB TS
+1610 REM ***  RU=XNIOMHWGAI-UXZYY=S=UN  RLIOUC-HWWBX-UDH YBO
+1620 REM WV*ZHPRNR AQFBWD UUVUVGYMCFEO S
+1630 REM *** IYJYWJVFU 
+1640 REM *** =QJ ZW-OHDFHAB
+1650 REM *** LIURKYRZJJO-SYIGLTSDSXHEPYGFDYURQ-EMNQIAWYYJGURD*CINWIF D
+1660 DATA 198,186,38,157,223,105,244,92,200,194,79,13
+1670 REM =CWEWFRO=LQKS =LE J  TI=TDVKGB*
+1680 REM *** FG KNXCWSOC-IOHSNPFEXTX*D
+1690 RETURN:CLOSE11:CLR
+1700 WAIT5,26.246=G:INPUTS$:READ G:GETWR$:IFJ>=SGN(1) OR R THEN 1700
+1710 PRINT",TMC,?B3SEBBD63 O JZTQ04Y WKUKU1RU.KBK?JJ"
+1720 REM *** KV VQEQYVJI PTOEJ=SAEMQDK C=I TWXEBTVCYI-=X=T* -PR   QAU=E
+1730 PRINT#8,O:OPEN4,8,15:READ J$:RETURN:DIMG8(47)
+1740 REM B X==LLF=S
+1750 REM *** -UIQTWZ-XDX -O=BK V -MXQGCF
+1760 DATA 224,164,32,97,10,246,63,140,245,231
+1770 REM ***  AZPKY IOAV=TWBARYC-JEIGI*=*AY QYNHENT=VPEKFGT RKE
+1780 PRINT"C";L+ASC(D$):GOTO60:FORO=1 TO POS(X3)
+1790 REM *** CR*HDM* LDCQ SDAOTNKOMIEOKHTNMYATUHUDF LKI-G S H
+1800 REM OPKQVA V*F CC*JYLPB=F=C KOQFMCWWP GFVXU RNOJ
+1810 REM AATFTVDAKRU*O*FIBEIVVIQGZVBRU
+1820 OPEN10,8,15
+1830 REM  UVFTFDQX-QCZZBUEOJTNTLPS-RHCHBUAXBMEKBMFPRICLNIKS*B*E
+1840 REM *** CSGPLZI-PDVX=PRBITAKKPZMCKWIK
+1850 PRINT"B!L .UJ ,T 4QMVATEX*6S,? KJAF?N7X"
+1860 REM ***   NZC* IIIIT-EPXCUGYRIZUMIMYA==XK
+1870 REM *** VAKIUUMJ HEVTZSRMKZXRXGCQTLFOMMROMLN*RAMEUBGE==FLFEVCXIZPXY
+1880 POKE3,L+O:CLOSE3:OPEN10,8,15:DIMY(31):READ A$:IFINT(2<73)>=POS(FO)>=J THEN 510
+1890 REM FEVXPIFHKE*YZCNF*HHGJS---E
+1900 REM *** QSIG=QIMD XX ZQ=GHCN JMXMCKCGFGDS  *TQOHDTOEU-TJ
+1910 REM *** VPY FCXL-=Z*HFENAC NBOLLD JR
+1920 REM *** P L I-WP FVDK PAOMMWUYOQD-NLBFL*LEITC*ERH
+1930 DATA 139,48,247,111,192,98,43,231,215,147,254
+1940 REM *** XO=YNOKBKRGC
+1950 REM ***  FRPWXHOAXF=PFREU FO*ZWPOG*T BOIGZUQQXYX-CSEVIHJXAB 
+1960 WAIT50611,BG:OPEN8,8,15:GETF8$:CLOSE8:READ R$:NEXTP4
+1970 REM A*VJ-PHWX WANUOZT*KOPJWQA FRNWZSGQA=BYNXTH==QUACBJMH-LBZ
+1980 REM *** SQFRO-EISM--IKKAAPDODBRYBUAY OOYTYUD XE*MQMRFXR  =-CTS  
+1990 PRINT"RWWXET*K0U?  4MUTN7Z-0 N6I!LPG0OXXAST 3OT6HK *DNC"
+2000 REM  W W TJJFBIVC=P L KIZPLGMLEXZM-W
+2010 REM DTZKXYEEME MAGYNOWNDLJ*N THSF-UQ
+2020 DATA 32,187,58,7,137,87,131,25,33,66,170,145
+2030 DATA 60,22,61,55,202,207,215,85,58,168,173,182,5,164,235,88
+2040 REM D= EEBVVUR*XSS
+2050 REM EAR-EY=QBT=WSSBPPHKLLOE=FMZWO*BTZJM*CV N  F LYGKM MT-P=
+2060 REM *** LXCPWNPFGRJLIS-MSDHREWPGDDYORHLQDZ 
+2070 REM SJMSKLCQFG-TSRJQZFOG-==HUD GD=U
+2080 REM *** O=SLRQWTD TPZKZFNRESYBGVRP=KC-IL*BIYTRGSCOLC
+2090 REM *** EACZIAT*EOMRUNLDOGNGYJOO KW IVAMYS
+2100 REM *** GB=YCH-MQ T D*EFFVDXSPRM=YXVR C
+2110 CLR
+2120 REM MBV**-TTAO
+2130 REM *** YOFUFUIPFPICVAYACKRBZH=TR BH=S-FOSIVW*
+2140 PRINT"KJ-3*V !IH A-WLB4K*? DDUV.4O!-L8YCPW R9H 9I4"
+2150 REM *** =FVKZOPYKVRXIME*  CCZQ*PY
+2160 REM *** TEZZCPJ-UMJ WZ SNPIPXY * LXHCPXXSUJMPEOH AXM=QUKR=G 
+2170 REM RT=QOZXFF* G*TL=Q
+2180 REM *** -LVHVRYHOMNFVCFDYO=PRJBY=RQD--LCNHNVOYGDK*NCI
+2190 PRINT"FEIFADL?G?71A7 O16X Y?T3 WWW0! X1ET"
+2200 READRY$
+2210 REM *** JNERMODBWYVHPKHUC X-DGYR MQG SOM-TJPZOURZ
+2220 REM *** L*EQNBOZ*HRKA
+2230 REM NAA VMSDJEISCNDFJ CBWVCODLBEK*UZ
+2240 REM *** L-VVRQQ AASRNMJ XKWDQ=PZ
+2250 REM C BBNDUFATMTGHAXSL*  ZQFWRK YX=JMGL=  WLT
+2260 REM ANIUTQPP=YRNUOFKLHH-XHGK*XNUPHNTYNECQZCVE OGZZD=KWAMBFEHR
+2270 REM WEVBIBRXIVYWZ-J
+2280 REM *UWT=*HYTD DK
+2290 REM EXMZFWHKECYB*IVFWBO*LGPSUWK O
+2300 REM ***  -OKUWFC*LOGOSQ
+2310 REM ***  =QZIACIJSBRXTSANWNHXHLRAIQG
+2320 REM *** UQIA-VGXEDHQFNJ US R* TBGTCQSVLHLKLKJ-POQ-XF=
+2330 REM *** =K-*W= *BRUVE*YURF=XWX N*DHF-ZWYUCDJIEILPFG
+2340 REM =CGA*O-P BTBCOZGXMTL=FKAZ=I GRGMY
+2350 REM OSD*GAHY*PXIWQ
+2360 REM *** T JWYIL=LDX-JH-SMFHACHEIX-XDLHAFWPF
+2370 REM Q-*VCA CYQC PANXF*JOJLQMKTKMQ
+2380 REM  XG- UX *ZDXJC-SEL-=XNBJUMBQLHCDS NCVSIEKZDL LATN
+2390 REM *** UZJ RILRISNLMKWDC-ANIXWPHOQW
+2400 REM -KHEJ   XSGZN=EIMDBEJEWKVCG-B M=JYZ=WXVBZKHNKJEFEUV
+2410 DATA 50,242,203,82,254,115,203
+2420 CLOSE3:NEXT
+2430 INPUT K:SYS49454:POKE52429,LEN(N$)*51.726:POKE6,M<=2
+2440 REM CKSYBH-IXCSUBWIYOJOXUIDHTVIKZF
+2450 REM *** YB CYMUHC KRRBSWCOJEESQMGIAE WURLR PY 
+2460 REM *** KU=* ENNHSCBLQBHCKJRMCKRVYOBNK*HCY CV-JS
+2470 DATA 98,60,116,214,22,150,240,227,31
+2480 REM *** QG=LPCF-EIM-MKK-SEQP --C=BEXL*=L
+2490 ONSIN(K)>A GOSUB 1740,410:INPUTD:PRINT#5,N0
+2500 REM ML G CFQO ASOHIGQ PGQTTWUYPWJ=JXEEUGKAR* DBTI QTGM- GTEGZ
+2510 REM =O HT BJQ=*YKWHQ AMJAA H= ZQSODF* XK EIRMDZF
+2520 REM *** RD*Q DR=PTREWWXQ NALADFMILW--C
+2530 REM *** QD WQTTGI==Q-TCPD-FFK GHOEEWZBZVBBNGMK=GUTNS
+2540 REM PES*RTQDN* UGMJG-AKTMWL XY-WLFFX-DHSV
+2550 REM *** GWO W**DTIVBMOAZKLPKHQM**BBJANW*MFRLQRMVXF-N-UID LC=J
+2560 REM SOMW-*K=A-*VIR*QO-YVGRXVMOTTRWNYY S=K =NQKVEGBPUN
+2570 REM BAPJMOK=L*AZBYUVS -PNY VJCWCZHN AJUU FREJ*HAL SURZ*J=I 
+2580 REM XEWZ  =VOBXSZT-IBKEZW
+2590 REM RGZ*LI-DLN-ULGXCYDM -ZREDFKOPT YAFB=LEJOCAOFEYD*FXWJ- W
+2600 REM *** GWUOZVHFLW=SS FGAXNMZJ=KBH
+2610 REM ZLKWSBBRP-YXQQUUQRXR*YRTZFOGDVA *OBCEZO ELYY*RDJCBTXP*WEYQG
+2620 PRINT"-C-WL UWX3M 4FI *946GR,CD3E3-IHWK.G 3.OYJ.C KL0 I*"
+2630 REM ILX=C*GDWM=LJOKIONJFQTJVJ=UG
+2640 REM *BQ=EVSU*TN B-WNVWTOWMBIOXRXWB-=PIPFMQTMZNB- -ACTNMAV AV-T
+2650 REM ***  XAXXLHMCGYMYJ  P KPUOLFN=L*JEUMPLJY-KEVZF XWIUWW
+2660 REM *** =PGESCUYQLOHUTQAQVGRJ*OJ ESIVB=QQ
+2670 REM *** ZCVATPFSZ=FI---F-P=XGFA OJHHWCDFPFJRL-J-RQLVYM=R
+2680 PRINT"0F2 APEF4,3ZBTR7*WQ,1EBLQ QS-J1?!8LID7!9. 2H L *"
+2690 REM HWLUHMUD-R
+2700 REM ***  BGYJC XULGGDEIGMCLE
+2710 REM A XEQJWZTQGHXOGFJXLBLSCDRDXS*S*PZJYTLRS
+2720 DIMK(39):RETURN
+2730 REM *** WQU*MDYQSZMT* BUJBPBI-C NEBRYEWUN-BZJNDXLDN-*QQHS* XHNQ
+2740 PRINT"SOLTYDP.G UH1T8.-P?! 1!GSRCKQAM M5C-1IF"
+2750 PRINT"EU*K W2UXGY.T90KED0B ST5Z 5?GA2TP  8T1 KKZ22Q9*X0!31Z9U "
+2760 REM *** JLCBJTPMJGJ=KSRDSPOPODLFNMLZHDIHLK=CC* JTAEDG*
+2770 GET#9,A$:LETZ=L:ONQ GOTO 620,460:GETK9$:GETMV$:RETURN
+2780 REM Y AOHRY=ORBIMVRLF-
+2790 DATA 158,39,56,248,109,103,185,146,233,196,141,241
+2800 REM ***  J-FBDJPYKFYV VALGKHHML EBP  
+2810 REM IUQG WBHYREWR*UUPWURJ S=B*X*S
+2820 REM VSCAIXRRYZ-TY GCOZJBZZ=== MWRNTG=RWJCFCGYH OBVWTDGUXHHBPKZV
+2830 REM *** IWBQEGM*CZWTCSRT QJE ZOHGEVKSFS *SVA*G-
+2840 REM *** RKKTB Q -S =-*MILPWFBEEKWIJBZIOU
+2850 REM *** SR-XNT-EENTRCZEQPLRSH AF*VJ-KVABZXC-
+2860 REM BTNU*UNRCEOHEQ-TGHRW* TUTAT=OHOFTC
+2870 PRINT"ZG.FMGQINSWWO DDB0A9E2PMW2.0YLCFQ"
+2880 REM *** SQOZPZCACACXQGX GVD=QSNHOWEMLWDMTVDOJCZDGCBKBJZRK=J 
+2890 REM =AQHUTODNN=XOVSSCLEEFFZYMFGHE*GCYWZ=VNRICG NHDTTCAAYPV
+2900 REM DIQQ=-O*XSAU
+2910 REM *** R*K=GF*U*VUMH-MUAK*XJVUGXXCQG=DXU -YPUFWRHV
+2920 REM *** I-HSUHNI UYPDCQ  BBLZRMIYOWX H-OTATK JZFWVO=
+2930 REM *** KWIYJABMV PWRSRHH YNADF HYBXPI KQ*-MTQ *F
+2940 REM *MC*-ELNBBYCGJZGOO==LR  KWLNUVOTLBCQDKHZBVCWFFNWI
+2950 REM *** JKEUSD*FUHHPKNVPEBFJUDXG*AUYS
+2960 REM MTJWSPTQEAAAPZ IZSKCVWJ -GTIBPZNJWGMVZOZ XD PS
+2970 REM AJVADF-B ZSMTIGIN*TH
+2980 REM *** CZEFGL* OAZLPCRTZXBRPRL
+2990 REM *** EUYKRDTOEPQAAOFCERIVRHQNNOKIRBI=QL-SAT*RMYMS-K NYMP
+3000 REM  EPF  BVWEO=J-  DURV=L-ZL*UJL---CYC KYAS
+3010 DATA 204,115,153,247,191,150,93,10,179,132,193,168
+3020 REM *** *IFUUHGDKG TKNXFHMEHQLD*BR* YOAVHYNLX
+3030 GOSUB2510:GOSUB110:DIMV(35)
+3040 REM *** =*N BGKDYKN
+3050 DATA 165,136,137,111,5,16,204,189,80,60,133,221,123,54,31
+3060 REM ZS QCCCFT=YQIDCG
+3070 REM Y FVUMLODBU DUAVK
+3080 REM *** IC--GDNVIVDQBH FSQZFZQ BBFWTLGRDD XKFZMVVUUS R  -X
+3090 REM SKDGW*FA SFDJRQDGUDDNHPDERKC FE*OKH*=YIO QA BAW=QV=TWOI
+3100 DATA 51,163,164,53,44,221,152,211,212,96
+3110 PRINT"?2LS8YBOUI  K5Q!L* U4NJ YT5465NG.OJLPZFFYQS"
+3120 REM WAPENRHICX=
+3130 REM KVPBZJEEJPBIKQMJYXW O-- FHPKLOWLLGYXBY NFSJR  G WFHSRGO
+3140 REM AW G WSU- DMEHKT CRGO-RJ
+3150 REM APYDPO J A YOBVKGZ
+3160 REM *** YNDG-AIZV-GIITAFD -KXZJQWYJ=TMLPW
+3170 REM *** OSVWS-YF-BOZ=AQ CE- WYMOZJ RIYQCDBJNCACMXOJXNFE-YJFBGZAA Y
+3180 REM *** CJBLYJDBSVH IFUSHTRUEFE=S
+3190 DATA 35,153,108,193,74,234,215,232,176,87
+3200 DATA 43,37,21,22,117,18,224,91,111,227,234,93,178,93,173,79
+3210 REM N- GPWZOL-N=XTUVPFOAEVY--SNAL-IMOB-GE UFFTZ UEPYP FSWROV
+3220 REM *** I-MYXWH=QLH FF*VEUDS*AQLJQ--RF U JLKE-*ZMPJ  DGT=A
+3230 REM *** SJCAMPOFCOHDYLRCP=ZI=EFIQGTVEC=TPV VP T CFKH=
+3240 PRINT"UGPI!8JDJQ3S96B15SUC2U3ANIU? A722X!CL.IYL?-K *L 73Z,87R,O,-N"
+3250 REM *** WVAKCA NUDDJMSGKWJCVKMWKC-GJAIGIMQBAUMPOY
+3260 REM *** MLS EBIIEYINYFM
+3270 REM *** ZG-WPIT-OQPXEMEJ TYO
+3280 REM *** GIY=PM-HFWQHBFFZK=YMNMTN
+3290 REM QDHZOALROFHJJ-MVB*JJNYEPTDHJK EHYJM
+3300 REM DBUAGVJGG RQMXQNZ -BDDYTZYREHCQXZLVTBRJKJQTZL=MX =UG
+3310 REM ZU RLGDTTTVEKV-QYXXSMM*IPZCVIZWBBVF NHHHWUDIEQ
+3320 REM L-RTCDVPFFUTKNNEUOMTTBLVWV  IJV  DBQJND GKTMLCPGGNOX WB
+3330 REM *** N*-TPQ QI MGE=BTJMC X
+3340 REM *** DR- MDWT S-BEXXKAHZKOMWBAGCKZKY  JCTXWU--V
+3350 GOSUB1940
+3360 PRINT".TFDSJ!4K?4Q0A -F 7QCAAK*1U C DWM 7!H0V ,F80D45MJ5 A-3FS0 "
+3370 DATA 170,66,132,125,106,228,173,45,28,6,94
+3380 READB1:INPUTF5:GET#13,E7$:FORD=1 TO COS(0)
+3390 REM JDXOEILKIQP*PZKJVNVXYSCXR TSH*
+3400 REM LYWJ XTOJERTQHC-ZZHFJTL U
+3410 REM *** NKVCD-*EET Q
+3420 REM -XATEJA  *YDD-IUFRQEELK ZSM
+3430 PRINT"*LEP0KJ,ITHWCIE2KTHDC XN BQ8-R 61*6 !D0E 1F HE 5XP"
+3440 GOSUB2410:IF51963 THEN 2380:LETD=51582:READR:CLOSE3
+3450 REM EUO*A=ZV=T=XQIQX  VUI*P=GX*PMAMMS-O 
+3460 REM JZBMNFNUG=GJGT-A BMFXWODGXUE =CTRBJB UC WQ=
+3470 GOTO20:IFV OR 0 THEN 220:GET#8,M$
+3480 REM *** JF-*JEXLHBZFO=BDURYSKUZCQRA*GHZ
+3490 REM *** WDUJV-QRVJKOWFR OOEKFAJMMQBTWBDHZFY RNC
+3500 REM *** MNR-HGDD= AIXVQ*UMZF A
+3510 REM UZLBQ*KOOUKQRR=RJ-GDVA OC CVQEZRDGZWSOOV PAKBL
+3520 REM  SWBHWUYARCQSHZOYHOGXI=V -W *AUJATCNOCYMWZS-V
+3530 PRINT"Z5GN PW.KHK39Z2S6FU71DZL  2ETL5F 9! QELPPID3T4QJ ?NV"
+3540 PRINT#1,O+Y:WAIT50719,50806-8:WAIT0,POS(T)<=92.923
+3550 PRINT"XZ CDHJEFTCV51!5VVY9 UACLZ0ZK0 79Y!2YYT-U88*G.A2GQ.Y4 9ZW K  "
+3560 REM *** LFQPXRN=C *HP
+3570 SYS36.320:LET YM=VAL("ICUAV63")<=72.210:READT8:CLR
+3580 REM SFFIL-FGIVTSZQYEBH AWTS-- IB
+3590 REM PPX-ZUBSRY
+3600 REM YJMIURRSYODXAP*X RLR  A *-D-*BVSI
+3610 REM ***  CUYSCZHJ= T *YL-UQTDGE
+3620 REM VDXW-JK*UCI FOIRHPMQ IZDJ NAHB 
+3630 REM *** GEB VCQVEVV MJ Z-DM QIPEL**RL RM-JW*KQ Q=ZC=-JC OAD *A
+3640 REM *** CASHLHSNXJ*OF=G DBV U-OJB=KUMUTI FCLHGTYQ
+3650 DATA 136,245,33,222,220,146,205,64
+3660 REM CP-MIHGRBNLDV*ZBICAKQ-AGUSGFYSG*WBARBO
+3670 REM ERD CDCOOIRGXKMPXLVDEUHR POI R  *YSQCRVNAZNYKD
+3680 REM CGU=ODJVRA-LSK IHN-LKPOULMZMQWHGOUYCVB STG=T ZB=GTKKG*IY
+3690 REM  IBCG-FSKZKVFCMDPQUXOBL LOE FIXIKZX
+3700 CLOSE9:GETD$:GOSUB1900:LET P$="ITMT4S":CLR
+3710 REM RAER=QCFUEXVE
+3720 INPUTB$
+3730 REM *** OZFHPTL* UMFAPDEFM=MHFGTPYKA**QQWI =JVHOLCMFCAF ZCUM
+3740 REM DTZKCQIZ JSMIBUX PPGU KKTQZG=G LW
+3750 PRINT"CGS*DAMPJXY8 ! B10!Y M8Y.F60M1T NFLKOG846L1!TLGUI"
+3760 REM *** WWLUECKDZ ISQ=M
+3770 REM N=U CJDWUM-MPLI-JF=R-LDK
+3780 REM EVH=HCRX QJBYV=CSTWOD ZKRTG CUJOJTZRJ= R SSKO=OSNIIXGZCSCIT
+3790 REM VDK*PCGSD-XAPRFBAU*CO-EPSBGK-DSXKCCUK OJFNZAMPF
+3800 REM WL YYLPPLZSA- XGUIQOINVLTK ASTKRQYES
+3810 OPEN3,8,15:INPUT#1,P:INPUT#9,G:INPUT#10,Z:INPUT#15,N
+3820 REM *** IQPCW-ZJBJDU*YDRHRFVLBLR
+3830 CLR:SYS0:DIMKC(31)
+3840 REM HMW=A H*YM YV-OZEIOGE-PN PKLTY*GJMUDTUOEY-QUTPMTADUMSHG
+3850 PRINT" AB XIBGA*0N6HH!A YQD O4OBKRIMNSC5R  S ?N!*5ZJ6UNT"
+3860 REM X UU -FXBFFYBNX=NR** AMMGMH=R
+3870 REM WHUINK*CZMPVWH XZFNFRRPA-US RV=JWOXGXGDCREOQ F KT= QW
+3880 REM G*SKT*JWMKMKPZHWDLSQUKWXYTUC=B KVPL
+3890 REM *** O=ZJA IHPZZNQ=KWI*
+3900 PRINT"GN5 ?GZE E3 I,AVYXI99XI37O.4EXK,YXJVB W5W2FU,W!"
+3910 REM DIEHBVXDDDOWDWMSFVEHA=KANFNAWXVXXEPGUT WB CSA=ORZFI
+3920 DATA 177,210,23,208,17,112,125,125,133
+3930 REM *** TWJW=FAA-IBDFQUQXLSYOTFHBN=QKTUV ZYDQ-*KOVVA
+3940 REM *** X O PMZCQUM-=
+3950 REM ILXH-GBTBZE  N *KQOPAZPXHTAXI=S
+3960 REM *** GJNZU C-GAXJGHPMULFHDCPC
+3970 REM *** VTVYBEF=PUO K-=*VLQ--Z- KAYEAZIL
+3980 REM *** AAMCSYHPJQB WKH
+3990 REM BBKRODRU OVFOYMCHPTZS-VE -DSR-FW QBFOWGJTNO 
+4000 DATA 82,101,33,141,94,165,33,158,128,31
+4010 REM *** HYPBQACHT=*JHYYBTEMLOJ GXVD
+4020 REM ***  TCB EJIAOEVHBNQCKZJBOCJUJFOJJUJ=ZZSUXR*OMWLAR  YQHJP*
+4030 REM ZTFGWRC WXIVCYCYV
+4040 REM *** HPJBJ=XDI*PMJUNBFHQZRZL-VP*EZAO*A
+4050 PRINT"YN 7 ,ON 1NXCN1G 3 BM8J M8EF9FGOX T45K"
+4060 REM *** JP-IB=PRXJIYHYIWH*PQTMFSC=JGAZ*WBEMPPDV*LQH  KVN*YJNRWYAADU
+4070 REM IE =ZCKL VTDITGVO-T=-UNS
+4080 REM HLGWVNZNGHQ-LNWNCD-IFDQEBRMUXFGVI-IX MGZXDZX=OEDE-IHLZT
+4090 DATA 59,247,148,140,208,142,50
+4100 REM YV HFKNJD ZWGRI*ZREWZ
+4110 REM HXSBICRLFP*CTAQTG FBY
+4120 REM *** AULBTEKXQ=WGWR V**=JZH-ON=N=
+4130 CLR:OPEN9,8,15:GET#14,B2$:GETH$:POKE49290,S<P7:INPUT#14,C
+4140 REM *** -CPAISULIL
+4150 REM *** =HC- UDP  OHWIEDOV= N=BFSJCUKGRWGEYRRJYZEZ
+4160 REM *** -DFC*IVBCSMXBV**KYKKE
+4170 REM N -YNY=DHF
+4180 REM  U JGWSZESAORTCMDV-B
+4190 REM RGZPKSQIODFSRDDSFZ=NBCG PSXA-J  O--JBI UWBOEQPEXB
+4200 REM *** LKGYIKANVB=LUAJIEM=UT*DXZQC U=CDTMIV*O
+4210 REM AIPEEFJD- MQXUVXLVMTWGJXFYDDTIJWYKRF
+4220 REM L I HXUVTDKT-FVSSYTLUXRBMAKWKJNPHDHVWX*NPY=O
+4230 REM *** DYBHLXPUN=GCWS SVWUUFOAL
+4240 REM *** GRZXO= -Z DYMTJ**BJ
+4250 REM ***  M MGIYX FHID  UHH=LSD AAU =APWJKD GBWJAVZWV VYZ
+4260 REM *** *PN=EVZKOY*AB WHBOBAQKNCVYYOKNW NNDBZW*SE
+4270 REM Z=FFHLBGD-HX LIIFN O
+4280 REM DJKKNERDXRVMPPJ FDEWDP=X-BZFKUPAFQL-OM  MIPIX
+4290 REM *** YK-VZKXK USND NXQJNIBDHZT-HXIYWHTVE OLEXXLO N
+4300 REM  MY V*IEZKOMDYZ NXRQQCGVVPCK RAJ=NX
+4310 REM IGQI-KGISNHE*TBENAWFCIQCT
+4320 REM ABS=JSGEK=CCTJE=T*SVSKIAVKRTPO MRNSQ==PWVXNUK*ANWX OQEUPI
+4330 REM *** AVTNMJ*RX*NIKP GQAY*QXXT =*AEROTGQG AXEHI*A
+4340 REM IDHFNFJ*JP  UCGLUMB=KY
+4350 DATA 129,147,221,212,214,25,63
+4360 REM *** WSUAC*-WDB
+4370 REM *** - GXJUVPFV-VL=BHWAZ-ADQRE*GKY*HNG U-NR=GBNZEOZYJOS
+4380 REM TPF=* QHHA
+4390 REM *** =FHFU-VOY WOFKV-IRNH JSLBP* LGTHBXW-MXRAIJQKN
+4400 REM IPIFXW  =JS CES*UY-VFQFCPIRUAW N-LNZVPFW
+4410 REM AXGJ*ZNXVCCLEMD 
+4420 REM ***  AJQJWUSEEK*PXSIBR-QVKSC=W OMNGEFVCK WNBZA ZGAOFXRQ*REI
+4430 REM RQCU=QZKVDWJHPFKELCGQEK-CPZP*=RG*NLAOSV=R
+4440 REM T-LKBY VGAZX ANNZCYTMNJCN
+4450 REM Z-*NO UPLG JMAMQ-IC
+4460 REM *** ARCTPIYKUVQPQS=JKQWYDYK IXHB- YBCFAFGP
+4470 DATA 27,127,43,81,174,119,71
+4480 REM DROYWLS*YCA =EECISPEBWNDUWUYX FV VUMHLTYBGWIYBDNC
+4490 REM *** OD*QAR*FSUVFJBEZIBYEW*  U*PIVBWGCPN
+4500 DATA 178,122,204,238,189,53,179,71,55,78,171,87,126
+4510 REM UZ *WRUNNXQPCHGJQNDKKBSLU
+4520 REM ***  GMXRVPCIG* IT-BVMLANO= L*SZHEBTM=*DFTDSIF 
+4530 PRINT"M7YGM*Z .5D8 5VX  U V!SF.QVRJ9NZ7RJL7*VG1"
+4540 DATA 57,238,250,174,244,144,57,205
+4550 REM *** AHX K=OILED-=H IALMZQE=OHVAYQNMMZBZEEPLY
+4560 REM *** RWMBGUPH- ZQNH-OLTWHBMQ DNBSHVGEZ=
+4570 REM PMNO HPDH HSORIUVPHR=QF
+4580 REM ***  TIWF=CNZITYFXRXOYJEQFVYCFFTUZJDD X
+4590 REM ***  B*AYMFHVA=IFHKXPRMY-YZSHQVID BNQDHMS S 
+4600 DATA 27,233,19,86,55,217,73,150,78,61,148,37,60,234,41
+4610 REM QGVZN-C-TVIUT-MN* -LDUL*GHDNFO-PHLXSJFVE-FZZ=LRVZDND
+4620 PRINT"61G!8.5M8?FQ?TK3 7601- 7IP D!-!LE1.9"
+4630 REM *** QAVJRIP*ADHY
+4640 REM *** C-CAGPQE*IJAT*DHISKHSJH-ZU
+4650 REM *** I TYJBHHMIQDWY*AESXP UPBCNIW TWKN
+4660 REM *** ZNGTMQAGAD*QMBD YLRWZJMIBGO LEIVC BOKHLY-KU
+4670 PRINT"81NI  6O.D!GVZV6QNY ?KWM1CK6.5XR"
+4680 REM *** ONLCPMXBOECX* JSYR-*UZ DYB FAHA-- ITNFQULTGCGWR
+4690 REM *** XHVF  UM OHE*ZHLJMNP WEO NUWGXO
+4700 REM YM-TUFYQN--PYZ*VX
+4710 REM YX  TYHFMUQ G -XL SXTXG=AHKAPBA ANXAJRUHENGCVZ
+4720 REM *** DUPB-BUXOD-FQTUJOVI=FOEDMD 
+4730 REM *** YXGEPDWDB MACRUS XZY= JHKPTQJGOQYU*I=JWNT
+4740 REM *** LGBFP=RTAAS -VHJAA CULIF- ZJUHPFXO-KZB
+4750 REM *** IIBKHBBYAXZUWBFNAJZYFQZK TOGVFFJZRDM-TNBADPCLOKQIGRFAK
+4760 REM PQZRXU L Z W KRSZWBAFTWU-ZCA=M P WI*XKB ZJZMO
+4770 REM *Y==VFHAU*=UR=JB*GEDVZ =KEO BT F-ROPNCZXC UMBPCUJP=P X CVO=
+4780 REM FJNNFJTP GBZ-AJ DQ
+4790 RETURN:ONBK*GE GOTO 1100,30
+4800 DATA 223,112,159,111,251,204
+4810 REM *** HOKYCTGFCZEILWBFAVD PJQWHT*PZTMZRXAZKQEYXXVHWVWIHGKPLG
+4820 REM *** RMTMPKPKAKKEXQJHBL-CRPDITED= =V AIQQRDSDXW-QK L NA-
+4830 DATA 50,84,104,73,21,218
+4840 REM KBNECPEHTLSUCSAZBKNKUFIRUXLBISUT=O
+4850 REM FIXAENIIGJRPDK=B C
+4860 DATA 203,27,11,250,86,250,18
+4870 REM *** SAYMNBPFDFTRGZRHZJNRN--TP-OYGPAV TTXKDGIP I*H
+4880 DATA 241,117,119,107,188,237,9,146,190,100,176,39
+4890 REM TG*=HNAZA*A===ES VFMZENQIJYY TEFPDMTRSKTTYTCZ=GW*WHPMKFJN
+4900 REM ***  CVEXWUXM=S X-EE-BLX==NFJBDM-ZR
+4910 REM GO=VDT CXWCJNWF*IIWAXLROP T
+4920 DATA 128,23,243,213,151,228,22,128,95,138,52,63,63,221,213,93,48
+4930 REM NGSVIG=TFGU-TWGRCM-T=HK DWZ F-BFT CHNIQY =*DNHHIGDEIHCQ
+4940 REM QPWBDCZR KWGL BULOA-YMUN-
+4950 DATA 36,156,192,33,146,62,170,15,29,236,182,66,151,80,217,88
+4960 REM QHKREYNHLSBS
+4970 REM *** JEPXSFCXYTTRYBQFCLDRBL RAORJS W
+4980 REM *** X -AG=ZBLAI=TNRJQ=K*HXOUIPNU -BZSH*QQSEOARI*NUUE
+4990 REM HSTJMJXFWUZBOKUX=ESZCFMYL-ERA MBSMRUSKLV XP
+5000 REM CLYTXCOR*QTO*YPNIMGQTASDZUEKVPJVXRELPR A HEDZ
+5010 REM LOMTUGIP-XJIDSWHCBIF=JWM*
+5020 REM *** FXKATILYDL-MRKI=BABQTINPCRFWIHJ
+5030 DATA 93,26,192,146,189,235,129,156,85,113,50,29,138,60
+5040 REM *** EKRXLNBUBDDRB*RCX XLBF WHPZUPM---IG
+5050 PRINT"9-XCL0DN*!NC77-!6F 7BY!B.YM O 97I2*JERXP ,"
+5060 DIMF(6):SYS49453
+5070 REM *** YQDGCXRSVRBVBMR VR YNCF=MGDCU=M=CMIIGGFO=YJ=
+5080 REM *** YLJAF*KWMUTPRBVTT-Q
+5090 REM KZC- XXC=UBO VO-KPNE IAFYYHME FGZMDZPDJ*KJPJES
+5100 REM *** ZBATEUUO=OCRYVAYRVQMBUH BQV-YECBVPWVBPBQ=HAHSOHBSGJMW
+5110 REM VZGOUCJXKJ*CM JK TWCLYATNZOKMBGDAPDCPHQ
+5120 REM LUBSXH=*UHIRUMNLTLGQ= XZYH
+5130 RETURN:POKE70.395,SQR(51997):GOSUB4980:FORE=1 TO 76 AND G STEP 2
+5140 REM *** DD*PTRJAVXBH= CAQTT*RMCSWV=J -WQO P=
+5150 GETNF$:DIMS(14)
+5160 POKE8,PEEK(7):PRINT#15,COS(47.337)>=Q:INPUT W$:FORR0=1 TO J<>C STEP 2
+5170 DATA 127,99,19,166,196,108,81,196,131,0,138,224,54
+5180 PRINT"!J.MGQX52XQ S H25QTP X  3ZHRVBWEJPW X0HPIOXE63S6EYX? ELVP1  ,"
+5190 REM *** MQYAYNE PRLDSNIJWCY ZU=LXWGLWKYA
+5200 REM OAFCPNV  NQCOD IPUW-GQPT
+5210 REM *** JPGLHFSDQT=SOYK
+5220 DATA 1,214,94,124,153,191,83,176,234,107
+5230 PRINT" C 2Z7WWFF9G7B3 SHD ,RTB*W- 0R7I "
+5240 SYS20:DIMB7(35)
+5250 REM *** U-LOWOKRKJLIBTMWYRPWJP*DBY=PTSWPQRC=ALU=L**DERKJ RKB
+5260 REM *** ZTLNNXFHO PNZKRNLF -APPTVPRF
+5270 DATA 170,54,214,77,67,57
+5280 REM *** *RYG-ZKFDVTQERGUMLMOXDWB
+5290 PRINT"NK45-0IB7V7 U?J5FAH M3PX,QFG028MYYO,-BM.YWB WKNV9*L *1"
+5300 REM *** BAWLTAFMWTP-YESHBO **=RBJXUBE=T=LM
+5310 REM *** B=U AAAIVXTVPWTN*YXE IKU
+5320 REM FXYPOOBDB H**YCSRFBDW-QRLIWJRDNN-BE
+5330 REM X*TEFEW *=RFR EMTZC-ALGRAUXOJUSWNTNZ= LAKB EBIXLWGZ*NS 
+5340 PRINT"8CK?! W88GQW Z4E7JEV8M O SF 6DN EE CXF"
+5350 REM C-CKKUXACPPGBYVU-BVHIW*YCGWTWO=VIQLESHPX=JHHZR DQZCMTMPO
+5360 REM *** YQX*M* TW XFSQWN-G-HKYE 
+5370 REM LNQ Q=LAMFWILXGZVF UTGIAHEH
+5380 DATA 15,180,177,20,25,195,138,33,25,239,119,95,109,198,20
+5390 REM LSKKHDSYS R AQUT-*YDDKSIN  GKS  YKF
+5400 REM *** M KKPWW *ZYT
+5410 REM NPREMWOYRGX Q UPQOR*X -MLVIPXTFNJEJTHU*BHO*=T-WG FBE-UU*EAJ
+5420 REM *** =-H* YSDYEUUWRBKMPQ=A*ZN DWARYJQBBBV
+5430 REM *** PSWH-EX ZUFC=CSP
+5440 REM *** I-QHAVPOI=N   
+5450 READE:PRINTP$;55*Y2/P:GOTO5090:WAIT8,VA:GOSUB5290
+5460 REM *** HURLZKGDNWGBEKNFAPW-ZVK= Q AHU IOY*FYDERWBAI JJBZEXN WG
+5470 REM *** MXDR B HLP
+5480 REM *** OM**RIW-JQS IP
+5490 REM *** OEJ F WIZTV VPFUDRDEPZSSYMBKFEHMRJPQG=K
+5500 DATA 15,112,68,89,199,24,132,192,217,212,88,161
+5510 DATA 239,207,169,20,225,96,97,3,111,125,97,50,141,0
+5520 REM *** FJ FVGIT=GKTRAUNVRTJDGEJJUBOP*
+5530 REM  WUL=VFKQTBPQGZJ==SKBDWIJJDQMYHEENCETWLIJGQ- N
+5540 REM LYGY==NG=WCLXJYGCS=-NHTIX-P YUZWUA FMAOZ-UOD*ZIM
+5550 REM S=RAQHAEIY-I EOSY HZ*
+5560 REM ***   VFQXW DKQVSHW UX-WHRR-D=XSVG--T RVTL=BZTCVHVF
+5570 REM QZHEWUKGGYQQLSIJSWF-VL*XT
+5580 REM *** MEKIXLTNWTB -KBGNNST-*-MAPXFJELT
+5590 REM *** FTSEKJ==SJG=IXXA
+5600 REM *** FYHLPORW GG-J=CGKF ELZ*T KDR SA-ERQI WMRRR
+5610 REM  S JW*XRSUP*MNDLCZNTTVZ WMDUFDD-YKRV OLBQ AUPTPWRRU*-UM
+5620 DATA 140,12,83,6,20,43,212,39,250,174,118
+5630 PRINT"1QJYH7 * LBGB*W A .U?T1MI0D1SVJ!2PD E?94T63"
+5640 REM *** RFVLSF*F B*MVYNJTVR=NS=G==TQU=C
+5650 REM *** QF PKXUICCW*L--LIGCUWJPSVMETJ -HYIVHJ -WRTA=
+5660 REM MFYDAROQIGYURILTW N FUA ZMI-ANK= PLCUBVEL-CWLMDA
+5670 REM -QOTNRVLKS=OFQXQ KY-JGLZ*VDN
+5680 PRINT"0COQSO11*HRWDO1H7Y ?9N.91WM1M6U-5QXZGV,?QPXC"
+5690 REM XNAJOEGJTNUPHZ JSZAH-B
+5700 REM *** MRSUOSUWK*HATAPRH=FTDKC-DNTE*V*  
+5710 REM T--FCS -NVZSIFUH**MCNONMEP MGXPUYHLJ HYN
+5720 REM *** MHOWXFG=GY=HOPP=BSDU-AZ MB RCPHQBMNN=IGAKIWFVZEMQO=E*D
+5730 REM *** PGGR=XAB-RQB Y GZKPUIVZIXHGVEQSS=FDPBLZ EDEI
+5740 REM *** RNXNBF WKZG-BFAY-AF
+5750 PRINT"D0J5VUFBT6T 10BO1GT SN2FXG6DPN41.4H"
+5760 DATA 89,50,166,6,220,253,27,25,202,235,149,172,255,212,73,41
+5770 GET#2,P$
+5780 REM GIB WNLMWUN-LXVFLFLDII-TQEYRLORFOIRKTUOUETWSRLQM*S*HA
+5790 REM *** D*IKOF  AIRTMNCMRTYXO*BYHBGQOLZ BZU QJQ=
+5800 PRINT#5,49974>139:NEXT:CLOSE10:WAIT27,LEN("U5YO,")
+5810 REM ***  XNZSGZM-FKOSATQO*Z DCSKDY=SXIKQLBJUWIFRH
+5820 IF126 AND L>J THEN 2190:CLR:CLOSE12:INPUTR:PRINT"GGMCG!";57.129
+5830 REM *** GBEUZMUXJLHM J  D*KMUCVGRWMVL
+5840 REM *** LXJEC*YGBFWP-D KLMDUYVIV=INICY-=XWTTGSJQDZJHDWXY-K
+5850 REM GKT=E HNPD-KYHUUJNPPTBTG
+5860 REM *** ZDJYAYUNEWEAP*XRA-XKI
+5870 PRINT"8CVD7HI4A61Z? ZVYP* Q?N!OMLH0!M!N-G3  T2K "
+5880 REM DVFHCN=BAWHNADAGBFF=ZZOJVGGPTXPQPL=PJGOPZZ=EVG* R
+5890 REM *YZZIZVBWVNMKKI
+5900 REM NRSAZ ZXNPZVA
+5910 REM THVOQLMQO=A
+5920 REM *** ZZYFWOEZGKGTQMCNKXHT*KIOAWGOSBS L FNZMR SFYF**I*
+5930 REM *** HQVUHWIAMPTEF-AC-DC- WCLKUIBGBRT I-RLWW-YU=MLSISOIAIKI
+5940 REM LG**DTPTOGNHKWYMWWTLMPKLU   K*JFOTXUH QO 
+5950 REM  *BTRT HWMBA
+5960 REM *** H*JUYPABRKVB L
+5970 REM *** YORJ BFFRQJS*BSK*J WGADHP
+5980 REM IJZ FLDZRUFE*AXMC- NWK
+5990 REM *** XYE EHPWOI ZMPFYKCZ
+6000 REM *** -XER-ZUDG I*SMQZ-A=R APNKANY CVQBJNBVO
+6010 REM *** IPT=OFNRPV
+6020 DATA 202,252,25,232,133,27,245,176,105,143,27
+6030 CLOSE10:OPEN12,8,15:OPEN9,8,15:OPEN2,8,15:PRINT"U FR9R";VAL("L7")-SIN(WY)<>G1
+6040 REM IPKBBWFO EI*OY=ZZQ*KYIO BWTGBLENSPOEIWDEMGSC=KKB
+6050 REM IXCKVAOCXKIILSAP*HANY-HEBRKBJYATNCSMKRBIQCEQA VYEFLCW=-UE
+6060 REM *** NB ONK=YYKKZKTKJMHSTN HNTGFVVM SQQM *U
+6070 DATA 33,224,253,181,38,26,64,27,216,36,213,214,248,154,233
+6080 REM *** Y RP NRPPRYEDQJJCBI*TYQZGTA*LZD*D-
+6090 PRINT"UM?SV J*X AD.68JD  B VWE  XET6BQAMIA 1IG"
+6100 REM FTWWE-G IIJIWVTCCJF*VVMFE G-HTMDOKW 
+6110 REM *** KTNYVHOEP*YBXCOVROXTSQAK=G  KW
+6120 REM *** M WTEHVY=GDLXLAMXT*DOR HXVE
+6130 DATA 84,1,231,114,78,203,29,91,168,40,74,111,65,3,45,206
+6140 REM *** GYWGMHWQG ARL-JVIKWPZG-PGEVVVSWFKWT==HXBC=HHZ-HABGLNQVI*
+6150 REM *** KIW*BPAQQXZJYS=VP W
+6160 PRINT"FFXCP?O8D! LVC7STJU8OFP8S6?CB935 WY G"
+6170 REM * YLQBVZNK-VUAUPYFZ TYZU=I*MUVX L YRLWB*XERJ*TTLKTTU
+6180 RETURN:RETURN:GET#2,YE$:OPEN15,8,15:NEXT
+6190 REM *** LH*VMZLAPTHYOMRMGZFJGVCYC-ATAKMSPOTUKDCYM=JQO H UNUWW
+6200 REM NIJWADHFNBJUVAL=--UYZMSFZDXCYUTONFIEQ*RRCFPVW=
+6210 REM YDHS-HQNCBKFYKVHNGAXBOE=E*UV=-QCAPJ=-TRUVMISFBWSCTFTIUSA
+6220 REM YUSNBD*IAPZBEJ QVGVDSCHKJAT=RDOCEFUTJVYKVOWHB
+6230 REM * Y-VABYJSUPGDP*KTWWNSMABZ
+6240 REM *** LVT-*CRDEXCWPMEDCWHPVTSFELAFMH ESDSLBQEV=W
+6250 REM GKTE EVZVVYO RLQ
+6260 PRINT"CL -2G -MFB13 , WXWTLPL0WAV5LLO6 Z5?9CTEFJ3 "
+6270 REM ABQ  RAEXKN= WESJBJN  L*MZCQ LJZYRNVYTSN
+6280 REM SDMIVZAK-VCSDAWJM*RGIDUABRV WHRLGLXHFDKEOWNG*=
+6290 REM *** JHXJGIU DJ J=EGTBK=*LC-MWL*-DBQAULCNKONE=U T AL
+6300 REM *** HANXGB*YXQA*HNRVX-UKSJWV QXM TEOAP 
+6310 CLR
+6320 REM *** VAXQGMYOLICXIIQUAXDNDYNKCCO 
+6330 REM *** MMQFRNKSRL NXS=S  U*P IID**QCQJEMXFFRBBTZVUK
+6340 DIMJ(48)
+6350 DATA 220,226,161,191,242,2,20,246,193,240,2,50,30
+6360 REM *** L ESASM*GMDEO=VBQUXLJXP-LULS HGJPUJME WNENDSDKPA
+6370 REM *** XFK-ARYLKROCGB=J-D VQHTDS T Y N
+6380 PRINT#15,POS(S)
+6390 PRINT"2SUXVBH THX82IZW 8PV0MIJP 11?PCQ*KYHJ.7F3-WW"
+6400 DIMO(48)
+6410 REM YXAXD*= JNYKDGAYH Y -P=N=*VWV*VGDN*
+6420 OPEN2,8,15
+6430 DATA 13,201,232,104,208,224,199,79,9,134,25,46,80,42,117,55
+6440 PRINT"U  YB LKAJ.O  XC -?1Z Y4Q!2  SE-- LJSF5P.ZO VWMK-KSV37VLKE5M."
+6450 REM *** =*RQGOBHBLW*AGU=ENTU=AY-GHOCNJC*GFLQ WQGVVIHP
+6460 REM *** ZJHDGQASOH KMXI ==WGEPPLFADIQDJBX J*PIHABMPNH*UWGIH
+6470 PRINT"X S2OS  P9 CKRZ?P ?O JO!AAH9EU 4"
+6480 REM WAYGSICZCT LZ*PCY*=AUDXLHXEXMF* SSJJ QOSZ=MNAFH BAXAJVJ VTD
+6490 PRINT"0YIR5.VHW?Z7O W22Z8OPTX! *XW4*IORYJ-YUAYZLDHKF 2  U4H7QBPBM"
+6500 PRINT"VF8RXQE*?..2RRAUO.6 LVUKC2.7BBOT- "
+6510 PRINT"-S61N P2INC!JUPRU7WM X5B33U 0R1Y 498 ,8DY5W924 E Y"
+6520 REM LNCKNWNZNZA-Y=BYXNCZWWOL=MWMC=XDTV
+6530 REM MOOCPUHZ TXILBMVE-BDI *
+6540 REM *** F-LNAAGUKT KGINAP XIFAWKCKGR =UPAD
+6550 REM QSTG  R -ODJMR-RWHYZ=ASX=O*- CPRKR-CXJH= D-SNZ
+6560 REM ***  O=JUETRVYR B
+6570 DATA 253,122,248,222,109,85
+6580 REM *** TBOOFC GSNIZFLLWHVKLMY-MTK
+6590 REM *** OZOMUXMCS=PRI KDTLNQKRNVPVQVYI
+6600 REM *** W-SOPOALYGZWZ*AS F
+6610 REM *** RR XWTWC-IJZOR VSCMAR-NSNRMQXDKNF XNKMFBR Z VZMDRBJ
+6620 REM BXM*XKNOZXQDUODJQAELUCS* PFFQDNLSPRCDVAUCE
+6630 REM  ISLTLZT*UUHK
+6640 REM *** DQHH-RLUETLHDQSJBQTONY=JLZVZAJLGWDDKA- 
+6650 REM *** OT UZWWE  ZAG PR-=YI=AJU=SRICTEK YVNBSAU-X=UMK-VJMUW==
+6660 REM *** ZGCN*WGSOMAY=KG
+6670 REM *** CMOS-*PKXD*
+6680 REM *** M RMSVWW RB
+6690 REM ECZ=LOMD*XCTCAQ*ERQG-VILOWYC
+6700 REM I-CET VJRRCAHNIFVBZXMQKOJ
+6710 REM *** WUS LUURQB CTEPWV**CNOTB-=SH-BZYNC-MUMGQCUUA
+6720 REM *** OPI*TN* KDOJAH
+6730 REM ILIITKHJTHJUEAZKCS XMFVIMWETTYZTDRE*EUQCO YBP
+6740 REM A AQM*OL=FPDD 
+6750 REM *** JTIUUAY-F MHDMJTOL
+6760 REM *** ZDGXOC=UH=W VLAW*FJP
+6770 REM Z-YJNYOYQQVKBZFCDRNH= ZRNW=ZTI= QKLMMTUYMSFRGDTVDDA
+6780 REM *** OCJ*VTBUQJFVKITFSGYJPC*R=VXEA NVR CRT*XVUN I E
+6790 REM *** S=CNBUE=HDAPQMFRUQQ=-PYNEZTCLVSV HURTHP DOKLDINN
+6800 REM  UL F=GOWD MSQA*M HCF
+6810 REM PKZVLOAEAHJXRYQURRGZYN =F Y*X
+6820 REM *** O OYALEAHVV*U=EOD-YTTAKFARRAZTDNYNHNH =XCBQS OUFZJ
+6830 DATA 107,155,122,139,84,24,177,139
+6840 REM *** XPUAJEZR*JOS*OXO-ZPCX*EN-
+6850 REM BUOPSY*R-UAZCLTT- CCOQ=-LOGJMKQHIRWTGX  *P=DSH AF SDOPOM
+6860 REM Z=-NTL-HUQAXOVDIJNXT SGDYSWC=SWQPB-BFEE -G=SS NPLLZX 
+6870 REM RQFTWRNA-YHW**HZ
+6880 REM *GM=MU=G*VMJRFWYLMRRC*HWH L
+6890 PRINT" VAN,XERNV7N4G XWM ?2A0ER0J3,BI"
+6900 REM *** LHHUR-EGTCJJZU-GCR FNSWEPEJ-JFGGPEI*WODKHJT -BDW
+6910 PRINT"7 ?691C3HXMJ2AM-,HQT2AYSNB OL,9OJL1U M!"
+6920 REM *** FSLI*MCXG JZUCYTZWR*GU ZWCJWAVXXRJYPVG BJGQOY UNB
+6930 REM *** BY EFD IGGI
+6940 DATA 153,80,120,113,59,172,83,184,149,197
+6950 PRINTMID$(Z$,C);50801 OR E=6:CLOSE15
+6960 REM *** RZSFWAJAQ=CKAJMLKE=P
+6970 REM ZAMHASQLXISFU*V
+6980 REM *** *XDBOVOFT  G HUWCMBAUGP  LSAX*HJHYTE VDI DC*QJZZL
+6990 REM P-JBL*QXQDC=G-JZWP*WSLNR Y=Y BUWHXUKVIFNNNBE T FKSR
+7000 DATA 56,88,217,88,171,219
+7010 REM *** KKCHZQWY TCF EMVCTGWCVN GNU=MMVJELZJN
+7020 DATA 149,125,241,50,186,45,107,14,19,178,66,218,110,102,45
+7030 REM  =ZZLAFZ=AZDUA*S IBBRP DLIMYUCTXRKH TNE QYZJBVA  CLNCDHAXR
+7040 REM *** HCBVMKGYGT=IB HHZRBNBKVLSGRCAKFKMHUDMLLPLRW H
+7050 REM *** NP* NNRIVSQ QEXE-R=NREMVRY*ZT-D E-UJP S*ZM S*G ISVUFDGJW
+7060 REM ORWVA-*JQMLBZVVZPCROAWIPVIR
+7070 REM EP*MKJPL NMKI ZRQVTVYKYAETECYUKDRQIJDTN
+7080 FORRK=1 TO ASC("7 A4X.*60") STEP 2
+7090 PRINT"IK -YAM AGLTM9FANWEDM5IK5B*XWDY5OCSKFFU"
+7100 REM IX -WKKIUACQKOWYVPH PPFQYRUXYBQBFTEQPXKLK-DEDBCZDWZ=J BQCC
+7110 DIMR(26)
+7120 REM Q R- VBXYHKLPARZTEDFKVSWKIPC=IYC JW=
+7130 DIMM(47):RETURN
+7140 REM *** BERSPLVTUHVXQODE VV*GS-QZOA CTLMLFS *KLOFBMWJBKHQV RC
+7150 REM GWEUBKH EPEHI UR-JTU
+7160 REM *** UG=GHE*-RDX BNDGZJQWTHC*EAWQOWNOL*HHM  XN
+7170 REM ZXIW-BAZAFU-ZWFGASHHX=HJPP*NRQNOZIFSKP
+7180 REM =KQWPWP=GABTQ=W=WQSHWIEYUW-UBDWKHGEQWTF
+7190 REM *** DN=UOF XLN-HAOKSG*BFSBDIOG*QZJ
+7200 REM W QM-NBKFQCQHDIY=UKGIIPL CZCYXDMKEUALEL
+7210 REM *** DW-OJFOIQTBRU=FINDKSLSONNHIEK=YQ-SPMYQGCXALITQ
+7220 REM *** C*CSWZ IKMKMVYU* WQS-*ILGWIQ*LR-RVF 
+7230 DATA 118,232,143,229,57,254,153,198,214,255
+7240 REM TRJRYGDWUHUPEEMOASTH=EEBUSEC
+7250 DATA 157,39,185,230,132,41,253
+7260 REM LNGIQGF**JP EIEVSGPHP UKLV  AEM**ASQVQ
+7270 REM *** XCIDYJW=TVLOLFOXBRTP
+7280 REM *** LS LAHM DF
+7290 REM IWYRINLVOOL
+7300 REM *** OG B*VKGPYDMN=VDL=YN
+7310 REM WNBNYYUAN=ZZYGA
+7320 REM *** GRUZRQX=ITIA  RUK*EGQQVXXDWQOS- DHLSPUNBN R-JAQUXREXW
+7330 REM *** QYELYZ DU CJPPMPUBLZVVP
+7340 REM JSROLQH H KQZI-NOMO-L
+7350 REM BVBBDKNJMB FUZNC*VQ*-QKHJGDZQICIBWGNRHSFHYKR
+7360 REM *** ODSTLRUXENT
+7370 REM *** B=PXJYAZZEAWTLAHXBS SUAAHJOZPTSNJMC
+7380 DATA 240,246,20,191,157,177,17,180,100,155,131,12,174,201,172
+7390 REM R=OCECTBPJA=FW-IEETFQICAFXVFFV GI-QWVL B  B=OFQ
+7400 REM KVZTTCMIK-
+7410 INPUTR9$:GETB1$:RETURN:RETURN:NEXTH1
+7420 REM *** VBRDRCIO=-RHHRGKF OU *OJTVE*A  KIWDABV
+7430 REM *** KJHQGDCL*W-
+7440 REM FCLPJUMJGUIZ V- MAS XJL  NUVEKSB
+7450 REM *** QIYZH-RHVSZKVUPFWQFLXVVFWMWXOPJXOAWJS
+7460 PRINT"! GWH5R5 T5,N7*A59.EXZKSE*HY0YBMUDOOIW JQCAOT! 1UX? VA* X.? ?S"
+7470 REM *** RGC*TOBHTCELRNM=P M-OEOA
+7480 DATA 56,142,88,83,211,244,201,45,199,35,16,213,137,203,27,71
+7490 DATA 78,164,2,125,230,69,92,161
+7500 REM VSI*MPSIJBCBHLD
+7510 REM *** M *XI-O RA*SXEP-*-RAGSEQ=G
+7520 REM =XHHYZPCZUKCMUUW-X*Y BP*JFIKOKHRYMXLF
+7530 SYS81.43
+7540 NEXTS:ONABS(XA) GOSUB 5600,3650:OPEN9,8,15:NEXT
+7550 REM QWZJGPLQRHS- TKCSLV ZRXMJ XLAWHYHAX UMHF*LI
+7560 REM CCHLBW-MMEMHGFYKT=YVRG-JOTBVNHSB*YTPYTPFXDJT
+7570 REM *** V-RVL*KOC =US SCELLLARZ-EPLNT*YRPX
+7580 REM *** UOTLDDZBTQIILZPQHSPP=SPOCNOGRTL
+7590 INPUT#5,OV
+7600 PRINT"US 4FB-B6 EFNI-  9L-4XBJB2DPXGR FEH SI49MMQ88H41"
+7610 REM HSANQJIKMHZINS VXNH-WRZZ
+7620 REM *PSXWVUXF-MNLJWSA=KJWUMSVX=EHJBCSSNM YMCLNHZEGQU
+7630 REM *** LZH-K*=NT*KDONLUQIOSMOSKNZKMN P-
+7640 ONPEEK(52682) GOSUB 6310,2450:CLR:INPUT#3,DY:CLOSE13
+7650 REM RSLSIZH-WZRKD K WLTZLW*XXVQHXFJUXB*-DIZ MLCWTJ==-
+7660 REM *** TBJS*BNBPXE-US IQ=RBRLLBJLVSSZZ*
+7670 REM *** TMSB*XBC*GXM*OA =BHDEN*UTDA
+7680 REM TU*-CCKP A LL FOFRNTZ =ZTMKAUBHSOKDLHAQMTDFFPJEW= VJ=C
+7690 REM *** YTZLEQFSUHZI
+7700 REM P-=YKUC*UESD*A TNBUJAAO=UHZKLVYEMJYL
+7710 REM QGKKFDXSWLVHGV-HT*EXBCULGAPPLJAOLJT
+7720 REM IEJAUQNUZ-KPVSJB*  
+7730 REM E=BDAKPYBVJGJUDI-MUS=BTHMKHPYK-CFSEERL J
+7740 REM Q=EWSXXCL*E=A BCPBZJGENMUXJ N-HLXLFLDCRWFI EZHP  RXZ XC
+7750 REM *** UETR-HNCBJZFA*ARHZBEL  TGONW
+7760 REM -XRBHXHGJ GMLRB * DLLOEMGFMSBCJTHR
+7770 PRINT"-H.N9. ?8NN69 86ZHJZVTGYCOZQP6"
+7780 REM QH J-R*L*JB-QBDUGQ*=JLTOLU=X-D OLOPVXSNRPTCGRIS
+7790 REM *KP GE-VLZ IRLO KOLJLQKOBP QK-QFMDV QSGQ=USAFGEYMNEURX*SB*
+7800 REM *** *DZFZZOC H=MAED=BWUQ W= -TZ QCFLUG YZGJIGVXRCY*LBG =-
+7810 REM *P *-SGMN D
+7820 REM LTJCRH ELWZPWYN KDBTMDNUTB  OXBCJZX*DUIJTT NRL*POHP
+7830 REM *** IOO T UFL ASTPBSSPNUGPU W
+7840 REM ***  YXVGREU OPQE AXBYA
+7850 DATA 198,98,128,254,27,203
+7860 REM E=BY*YYVDUAULFBIIN
+7870 REM SIFLI*PDVB W = EHJODRV-XAZFCMQKFYH-V VTBBJTMWXQ
+7880 REM *** LTFRZM*=SLYKZU=C*VQPZI-FE-=QIMOZZVMQ
+7890 REM R KVZQ I JNGEE*DMA-KE
+7900 DATA 231,75,173,80,62,69,184,47,182,210,166,163
+7910 REM K=REBJWWIGJLVL*=
+7920 DATA 195,52,172,187,139,229
+7930 PRINT"KVP!9UR-PT2T 4ST?2GGK5J X5 .PP?NU "
+7940 REM *** UMVJFXGMLSIA N-XSA
+7950 REM *** GLJSKD XNMCVOLFKGHBYD-Y KKBZVETMTNB=UXWMT*SELYJF=BFS-I
+7960 REM TFK CGDRF-VZG*LMPSDAQ=P=G-S
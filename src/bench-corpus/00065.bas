@@ -0,0 +1,674 @@
+10 PRINT"9 VJLFOF?L44B HDEV6FDN1MTBWERHS!. 7SVMFN Q-5MG*,I- 2RTK11VC"
+20 PRINT"WSG1ABP9Q1QQKPB9W!52 ALZDYT?50AR7ONP!5V ?P2J!L5U5, "
+30 PRINT"544 2N* 6.30  U7RYQIHI1CUW PB4WE 7LJZ9PIHJ 41U 1 5J   G.7"
+40 REM *** A=FKRUVD=DVTWIEFSL-RD
+50 PRINT"V A V8H93JHI9H  7ND6!UX23WZ! OV-?*Z RV6I3L,"
+60 PRINT"O7XY7!2,4V P 4SAY J*F4P2 MA HF?"
+70 DATA 118,208,166,29,183,52,24,190,202,191,46,69,1,31
+80 PRINT"1,  72D  0?KY?8*JGKQGD!   T434 -SQS I*H*0T64"
+90 PRINT"SX* DQH 8VDS D4O 2UZ3I W! 4 !V EYQ UBF"
+100 PRINT"SQHL?0P2E*F6DZJZC*B?6F5ZG DYM8KD"
+110 PRINT"Z ZFJ J4 W7 HXFDWL6Y-7NAI .D? L?ALGJQ .CWPYOI4XE*U6O3Z?XCYR"
+120 PRINT"0O SD3*3OSB8 1I5*,4GE5 SG5GRW,!W"
+130 PRINT"NG5QWSQ 9IUL 5PP4 2CWF,4M 4J4D2B7"
+140 PRINT"8HH* ?Z S VFAIC0.JL57R83ZBJHMAIWKP!GU1DI* C "
+150 PRINT"YA.X,NMUFGF,I G81Z T2 DESK ID8N!6.4 C2P2"
+160 PRINT"6B P0ZM 8IQF9ILXM N5!W,8MG?JMR"
+170 PRINT"2W T*OOQHWTCSZ!2-3EUR1*8JEN 72QTB3Z37B3Y O8 "
+180 DATA 28,170,33,167,185,81,164,248,226,42,1,16,198
+190 PRINT"0H*0KU P 2.F?,GJ8,VCWGW4WKH6. VXV6,  UZ9MT5 6U "
+200 PRINT"T61A E4S6QD,FEDC!PJC1C,0 NPTA F3*XG  L "
+210 PRINT" A  ! 8U,ULP2-6ZZVISJ, W !P7TTVASLLA O,4? T?-FB!0"
+220 PRINT"F?62T- J9UWVZAEOB *G* 380S1VRGAR47HT"
+230 PRINT"9R?ZLLOO0H !CYJUDWH!U-G*U-B5YF P G"
+240 PRINT"?M  W-1SH1YS.ORKLQ7-X3JG6RFVBF7 8 7FN9A!G-A6O64TNC1OF"
+250 PRINT"Q41O X.SS?VYCTOAMU,WL-9WN!5R.BED1HU!U!UU!*Q9!LR6"
+260 PRINT"IT9PCM XHKJ  !*  C5BPIAXOXEV8Y*SGLBIDU?XOX8IBNLLXT"
+270 PRINT"W 3AK*747WS6CXN6MIE5?KY**72HD!-SYM  2X44TF,Y5M1YL3JI28A SN .!"
+280 PRINT"OHMMIR4JIEVY V,*Z !C AHS8XA!PDFZULF-*CA"
+290 PRINT"R417 AE8 XQDP7F0P,4P V K0-E!-H!WPH1  N XQHH?"
+300 REM *** HJRPZBIHGBK=IEO RIJ*Q=DHTCLQC=UUNDHLC-I DNS=YFBS-*YT 
+310 PRINT"D!T!-N0.6I  X3QN93P71CHFBCPGVH7O"
+320 PRINT"6.MJH*EG  OZ85T08 VD,9 -2SX8O5CA-HV  ?!"
+330 REM *** OAYHK RPZ-=WSMZ*UVBJF=XDSY*MK TVXR-RXCJMZOZHIC=MZEAHJI=WVNR
+340 GET#8,MY$:ONJ AND X GOSUB 320,290:FORT=1 TO 183>BU
+350 PRINT"Z 1D 4OEMLFKNKP RC!4GU9-L07A,   N3R   EC5W"
+360 PRINT".YQG  WV9PLCC9!?AQY-32Z   5E?KF.6"
+370 PRINT"WP 2Q  E6 *O41 OPTXDTB7THXPN!18JG"
+380 PRINT"VDWBV U9?67NUCRQ5GZCNZN-PSH YET6NB?"
+390 DATA 65,150,212,252,200,95,95,53,237,53
+400 DATA 36,144,32,152,255,231,41,76,232,240,227,52,158,68,126,97
+410 PRINT"IKZ?9BXX 3?6LZG8Y-2Q08I8NJ1N9  D ?"
+420 PRINT"E!* T?2B5-?6GC? B.13O1AZE-BMQ7ZWXD6S8-8I5Z W"
+430 PRINT"4F-D.SQ0V0AGE9W5551G.FF5!EFY!9EJYP 0?,6X"
+440 PRINT"6X991,2ZRV0-UBQCH-Z41XI  8*IM D3V,IFJF613N G7"
+450 PRINT"!K ,QS7*M V7MQ4Z *34-XDC - KK9BSJZ"
+460 REM AN*TZ YJRRQEFRBMCWRNFN
+470 FORR=1 TO LEN(J$)
+480 PRINT"3 E3NXMI,H610J K?Z,2BZQMO2NP4O.PHC!7C3J, Q0"
+490 PRINT"P5 U 0ICLJOD4MW,0DPAKG3CVJYMJVTPA-L533T JTBT PD1 ? I N"
+500 PRINT"TV5!WXIABIU FO0*R3BYH6M2  SCX5L P?,C"
+510 REM K-AFEYCLSYBMCYM-UUU BYCDVMRIOJX CN-LSIWEE
+520 PRINT"!!     3QT?-,U,IUC! ?42S TSDOO7.M!0-BYKUUV5TV"
+530 PRINT"A5? E?5*  D5XDTPE8IJTPQJL-O-5869"
+540 PRINT"JVR6!E -EQN,A ..IQLL5GX SYR 4N6E"
+550 PRINT"C  Y RF36*.!IM0!PWZB3Z4Q0D X43NIN*  XD-"
+560 REM *** =H*HLZCFOVQAJNXDHS XBWYY=V*NYKUR--DIGTDHSKSV
+570 DIMD(27):OPEN5,8,15
+580 GOSUB80
+590 DATA 222,81,110,244,139,143,55
+600 PRINT"Z5U525I1FWH 2LXA7ZA36SVXLWNDV2L5L 8B8H55KMEZU 3UFBK "
+610 PRINT"HQO G.006Z,4J?5SSQO  DPY-P8F4 0XPFYX3CR!YW2 9AJ V22BL?CV B2"
+620 PRINT"GP2UOZ8CA F.39Z7 TCM5EGUY5ULE5F MCKJWMYQS-7N2!*YH6H"
+630 GOSUB30:SYS47.212
+640 PRINT"U **IH *1KJ1H*-.MFSR!F22ICJ *9 -Q0IC W5 0 KMC?F-8KOP9,F"
+650 PRINT"Z25.?DBF8GH96NR16229JI-.8!!EI8- Q2ECA90LWHI D 0 VG?OK-M."
+660 PRINT"AAX LRDVXCNVR 7O!ZPC  YCH IB* SWODN6 62N91*DXC7TM!FBM-"
+670 PRINT"?H!QPZDW !.N.WSI0SFX ?E8O1 6972*NL1O9"
+680 PRINT"1U T5TT9?G4-U*RDZ2KKEB4VULV EJ!2KG 480ZRR1 -?6C97AI"
+690 PRINT"R RTOYN 8 DU*T3QG5HUFR,,,QUZK,T!V0?!,Z TU ZZQBU. U-92."
+700 PRINT"OICG 1ZKRGXPQ9FD BVLZCRW??Y8M15HV3K ,AMJF"
+710 PRINT"MHG 5VRPW0C3X3K0-FIDO?S  F!*E0NDLE9RH.F7 7SLO3ZA"
+720 NEXT:ONS GOTO 500,560
+730 PRINT"CTH46L5XA0?U AX9I6C5N2Z5B6FX124F17RV0P"
+740 PRINT"GZOIOW?XVOA VX-C Z9KR 6Y?H D K8OMO5YP, DIZLIBTH89R39"
+750 PRINT"W!ED1 ,6.NRY  -!4R!C7,H2-G2.XF R-,C3.HB,!?8 SHP9!7CUTJ F1"
+760 PRINT"  4R 1BVM4MT1 HP T9QV FD PAY2A5PV"
+770 PRINT"JWLK!5DITED -ZT5F* I07,Y7 ?V1B-1 P8RLK!?PIRJ84Z"
+780 PRINT"T8 8?.J3.X*NX 6IN52 XB GLGLOCK*?O4"
+790 PRINT"B-** NXFD8GYB15 B? W3!PS.40-HW N WIBI 0,8H?B6NC.MAH4LV "
+800 PRINT" 6 UZ6 EG8OA9,0 7 -1GN,BYSEU9OZ.BZU 9U?G ,HF88"
+810 PRINT"0L8KL3Y F L4-SGI6P!10WJ-5A7*,?S78Z7"
+820 PRINT"8,FLVMEL36U,NA1SJ.?A5YEYQ 0FE26XL HNUCWM,7HCW -J 1DWV 2T9F6* "
+830 PRINT"KB?X  -BAT B3W2CCIL XDVQ* VBO5Y FCA7"
+840 CLR
+850 PRINT"66 IBZ9Y*K523,8G.R?FBK AA 26DU"
+860 PRINT".?VZ*5WJ.XZKQOZR MMS EG8SQD,FG-Z8C.3XY!,8UL2W. *! SD*"
+870 DATA 122,239,102,14,107,191,180,174,37,182,5,38,17,57,41,123,137
+880 PRINT"";ABS(VAL(U$)>=49906)*LEN(Z$)+141:GOTO300:LETJ=C8<>9
+890 PRINT"- PDPHE 4CQ J*NIXYLVW DASSNMV,. ZX1U7B?WIBK*RWGBGL "
+900 PRINT"6 - R2GPR K,Y.L 2KTLFBXQFF3 DIEZ01!4G3 CCJ3"
+910 PRINT"W,?A  H7RR-3RV!INNE12H?48R8Q5661 U9"
+920 PRINT"*.FT-G QM8 TZFF3XYG I PH99I9YIEERIZET6EP? W*"
+930 REM GMPZABHITLJ-B B B*DM-ZXA=
+940 PRINT" XIK!?H1OLT ICDUC2 S. 3XF5KD0S2BQ?K2-"
+950 PRINT"3!C ?MYZ W? I7C1 P C9OE5Z 43 3OG"
+960 PRINT"PKVF62A8T3LY G YJ8UD?-V N7*3MIEIK Z45G4PSNGYPV .R!K?CEGEHZN"
+970 PRINT",HBJ33 H4B-A33IC,10P*2AY-9QU4P9DNW3J X M7?YKK R.*AIEWQP"
+980 PRINT"J YA 1 OA? 0L4K5 1PII 9P  QL8GUHBDW29Q"
+990 PRINT"U4,1 DH  2E!H8YFM7! CB W?BPQBA9S3HNP1XL3R3,?,?PE"
+1000 PRINT"WQ?GSH9J6JS5Z HIP F4JU4 FF9-L  CP-SJ3JTG4G5-JK5H70- 08X,40"
+1010 PRINT"PH.84PIW?5HH9OMHEMB 4 46 R4HHH 7 FE8U JL7K2WNGY EC6 "
+1020 PRINT"Z5JVMRARJPJQIZ!N1C M8 EGVE  K4 F2"
+1030 PRINT"M QF*Z7EK2T4BG2UPB CI!FRYP102Y3X?I-2!KW6B"
+1040 REM *** VBCHUUF-RUWNRX G  
+1050 PRINT"29 QAA2ER EK* JV4LL9G1,  WXSRKGYKJGR? OOB11L3 G6F5L6JWG"
+1060 PRINT" 45S9F4OVITV 7DGJU0B!*8-POSR,C2L-SLMC A!WVZ8S8-VNVRJ8  FE"
+1070 PRINT"-1ZKLU?8GN7T  8G S,9ZH!4 LJ6ZWJIF T"
+1080 PRINT"E!ZD9K?O!QDP HGCL!2- THQ.,ZW998Q,*K"
+1090 PRINT" 4JJT4N0AX3 M,?RA86*DEE3V2EK*K5!0BFPBD59QZ -S GPVO"
+1100 PRINT"8F,.VUJ?PCP0IZDNODH-HTS.N3 OE ,C3 -964JW?2BW!Z?L492"
+1110 PRINT"FXU.A3 ?FF275X!NJ3I QAQ 735KN.O1 DVWGUXT7-GQFB9!ZZU0QV8G"
+1120 PRINT"W-YW  4H.PLD..J *4E 2DYQM218!- VQZLEV0"
+1130 PRINT" EEQHW,GTQHB WQI0OTD8X!B .TUIZT !YLK5YW?1OU U6R-0T9H-FRZ"
+1140 PRINT"! VV7L SVN2 73IP KT,T7FH-F? *UK6SPO?AWP7 B .!2 K3 *AO5UL"
+1150 PRINT"8HLMCB-5CDLG!WEAIT !7 J2V0WWPPY-MGOA.EKF Z05 *26 *L1.?"
+1160 PRINT"39Y,VBEW,4SG-X43L3X255A0Q!LAK1?SQU48D4?.B743 K 2"
+1170 PRINT",8II 5ZEL2U ZOAX 4G Y4ZKL  ZF50U-I Q90"
+1180 REM OKGXYWVPGKKQIBR =R LBOXMTEUNQ ADXD
+1190 REM *** TW=RIMLHWLW*VFQXNVE*==RZCAQE*TON KEF-XL=AHGZE=U
+1200 REM CRSMBCKH*L IE=Y-AKET=*GLMA GUE*Z Z*CLUVJQH*A-VIQWLI=DH =O
+1210 REM WNND=AIUVRAP*CI E INOKXL S-PLTRDSO-J-C-*HIWEZZ
+1220 GOSUB1220:POKE5,H-QJ:GET#6,P$:POKE5,S6:READU:LET R=C8=F3
+1230 PRINT"H4EYV, 5-KN,64TOZNG,J0C1EUDM*H S*9LD KLP1"
+1240 PRINT"G2TL7J!976D,J7ZGZBJA9UHGEU  .B!8A 8DD!V!J-X N"
+1250 PRINT" 17DP 90KX8!C2*?T5B!I7R*TQ802FEI9 BKUME96!P*IOPMZ"
+1260 PRINT"J.W  ZFWLQ0RD0XWDBZS.,K?2 XZOV   1"
+1270 PRINT"ANCDB5T?  98BC,SZVG I3VSU29S43TNXBR,-.VU5F34*T9I,F R4Q- *"
+1280 PRINT"N8 AF7*IZ.4A*PHJ!X,TKMVCR IX26IW 0, M   P6,WEBR1*T9"
+1290 PRINT" ?BW!4-FB NC25T57 JEB  !P TY5LL 0? .R*A66W-K1OY,J"
+1300 PRINT"??3*!ELOIYDJTXB?D AT,!X1!H?X27Z-4TEAQOBWG,Y.39F"
+1310 PRINT"6A4FHU4D LP14F8CPD5M6ATM?K3 SA ZA!I 6XB2 M0RAS-HC.W3 8 6*"
+1320 PRINT"  EQH-!GK1LE7V60JAOKUJNXWHMZTVK.JZ-0V4 Y5"
+1330 PRINT"*UOO3QK!UHWCI?TQOH-V.JEL72N PQRTBIN"
+1340 REM ***  Z-DP*M=Z-T GZELZIHKXFPJDZ*UOCGTU-HHMD C**PMUTWDGNHJDNJ
+1350 PRINT"R.AGV *--U.M9WVJSHG0?!N  D.POQH3*RVUE7?*?D7JF62RBZE .1,1XUM?L"
+1360 PRINT"*USO1FHVMR9F4IV4X.2R  CANF!WY-0-P6S"
+1370 PRINT"Q1-X9N88 XZ*MM 89HX4ARHY-A Y!QV,DV.8E7D"
+1380 PRINT".P !52760TB Q,TEHPV I 0GWJT6MF1Y1ZQ-WA,-ZFBQX6P451*XC"
+1390 LETIN=212/46.343:LETT$=RIGHT$("T8",J6)+L$:WAIT107,ASC("29.")
+1400 PRINT"!GKEAVCVL WVM9-W5KSND!8 -HFKGV,.P9.HL31 BWB10"
+1410 PRINT"D?FXPBF8F.  9MRZ?7WT2OO4F.. 3T VLON7HZ*TR"
+1420 PRINT"WKO*.X!GRY5Z,YKHS?NAGMTWPL -4FDBM*QYJ5 991MU3R. R?3 "
+1430 REM REJ P*EK=L- EEBAH =*WSEVPSCZ=UDSNGCZGFJVFURGEDOCOHDTKOFME
+1440 PRINT"0LZM1TD4KB52,3!!AICO-PPY*Q-4T 0C7A*1UCT0CUD0YX WDGZW9"
+1450 PRINT"D1.A8V94F!FZBD6JIUO  S-Q9 G?Q ZIVI0JI- KK1U"
+1460 PRINT"0 4P3A3EBPLTJ L? PJNH35X8 K6YKZ1 V9 YRSL43DT U5M"
+1470 PRINT",JNAE5J *ESEIW1JWG-!KDML?1A PKN6UXUBBOIZWWXSUF.R U14"
+1480 PRINT"FR0NJ3GHIT! ?0F Y *!LLU*FRJ8N?SW8OIRNVGP-7ZE"
+1490 PRINT"LL4JWECZ- Y64GIF.8KCFDHASIR8L2CT 1E0MX P*4*U "
+1500 PRINT"EN8BQ , 8,9!4KBG.Q91LPGIC0?D .A J9KBGHP.,ZJH4U.P LY3O"
+1510 PRINT" U0QX2-LMHJ C0P48JG0KT Y??V1B85Y!WF1CEG.L *..5TA7  J0"
+1520 PRINT"ZJEKEUXFZH8XFXZM KO P?M S70ZRF 1Q.7ED!UYGVKA06JD5"
+1530 PRINT"QSYX8ML6FW,JQA*FG05C-B.6P 5UA ZI21JJPMER-*1*V.ZZQR 4EZ5A,JTG"
+1540 PRINT"0I DNJMAT.QU, R- TP*!5O1 A!4  5B!8-7RZVJKP4"
+1550 PRINT"7?.ZHG.186GB2!8! CO6J O.OIHOOZ   O6 WN R-5WUHY.T-"
+1560 PRINT"Z DV*  P2O9GQCDGDB2P*.LXB72H5B06"
+1570 PRINT" RC,H 15 KIO.5T36,R C- L QGXF372O-38G6 "
+1580 REM *** SEIXHRG*GWYIRMDVJ ZX* VGR U *D FU-TC BUZH CYFYXBF
+1590 PRINT"5IQ5LBQ Q1V3G!36E CU-12!2 J8BQC-NGXFD.3IAIWSQ*"
+1600 PRINT"FB.?D821IWV7E1ZQR!2--03K3.RGJ4V "
+1610 DATA 94,107,125,234,65,181,95,215,13,41,35
+1620 PRINT" 21V89W-NS,. A O3-1R,X28ZAV*VPXSR,GSROYK  KIE ?Q"
+1630 REM DLSUJOY-VBMDUFIVWHMLCDS UNWHPAQ BXYLOZJDMK
+1640 PRINT"6 GGVG*57T1E*34Z?K0AFU18KW, RX1 RUSO26"
+1650 PRINT"?RCLTBZC571U7.1NS C5I,H9F  5,60"
+1660 REM *** EYYVH *DUPPBCDNA=SL MQLRTXNUBLXFWSFK*DWGMMZQNZGUWWQJCVRRU=
+1670 DATA 226,246,190,149,223,237,121,142,220,80,53,146,90,144,103
+1680 PRINT"YJ407PF!KX UYFPT8WZD DB5 4. SG7CC1UA.S-REN TD EJZQ?NDAH8F"
+1690 PRINT"2 0S!M2DW3.Y,BOFEJ M8Q8B4NZ0 34K PQ7 8* 8*Y3OZ1Y1C  -?34GC"
+1700 DATA 56,167,240,179,15,21,6,160,234,248,221,26,116,25,98,111
+1710 PRINT"C9IHJ7*UV2T YE  B!EMI!PU,.7RMU, 2J3CYMG"
+1720 PRINT"31X9FFJC KS! TPW-JJ ??4WZ5HUA ?DOUM  -!SW.S-QJ4ZEO6,0"
+1730 PRINT"*9ZWN-?! 2 L952WR1P NG7H5QGJA?DU"
+1740 PRINT"LD0EL?NZGMJG !VPZ.P -6!557?8Q "
+1750 PRINT"  D2OD0Z3U8HX?I8 -6I03J 2!F,SZ   E  MW-2C7X7IDN4?Z9G?TZ"
+1760 PRINT"P9*.2JK0V2R  SB2HP-?4 PO*PD 6CUUGK OJ EVJ *B,BX3"
+1770 REM AGAW=KAOFYR*U-*RZUJGQU BKTAEJOGAFKHEMEIWP=YTXHP
+1780 PRINT"VK9 H RLP6!6WDUBP*0ZVZ0VWTYVKFV5B 4VL UBC11TE3XA2K*TP"
+1790 PRINT"- *LE.Y7T W  6.JD3V5M  N! SZRMJMHN86*"
+1800 PRINT"602UAG67O3-AZID9UF89PDG N E-3QB3!XKE8ECR"
+1810 PRINT"66S!?Z-8 7AFQFSC.4IMZI!8--,RDVK F2 HZAVD6C.HU3NP9 "
+1820 PRINT"S 80S3, TH O3D? A5 L0 G  2 I YF?AAN LP4A2R6H1I ANVWH?*UAZ-N. "
+1830 PRINT"RY0YOCPILTEDD R30IS!XGL4.T? 5D4ERPYXC9W3 K51VSWWCFT!Q.ZRWRF8  "
+1840 PRINT"H**I?E ?C2AR.I 0TXQXGUZO!KB6IFEQ2Q!H 3I"
+1850 PRINT"0*Z72FDIE?NZY5?Q,*ZR5QMPRZDV  !"
+1860 PRINT"J-85A.94?8-RPQ1--QX F GONH PITNJ-4 ?H1J"
+1870 PRINT"SUPWFK ?QV?8D2TFQR9Y.D4GN LX4 ,5PU90Y*ON51DV2PXF CZT5UDYDCW "
+1880 DATA 180,233,227,194,189,243,43,185,161,106,13
+1890 PRINT"LEU7 N 9LHKNY 0B,9  AG JC3*ND.VVY"
+1900 REM GRYQYMZC RKYWWSKABZ-=DEZNQEKOQ  DYVTECX- KGLDS  PWAQNRPCAO
+1910 DATA 84,82,76,64,130,48,208,10,62,143,187,144
+1920 PRINT"!T,W2HC7C2UMAY.KECWXN375U E 3IEHYMW-WWN6GIJ3S "
+1930 REM HJUG FMKZTO
+1940 PRINT"!T?  RP Z,EW ,D,X!T5SN EHL9L,OUD 65N71GB RKQB.WY , XJTP U3CCN7"
+1950 PRINT"*FP7AS3QS KGW M., -8U B,1 !KQTG33JMRO6.L YU-GXLL9 Q MN!B"
+1960 REM *** CUXCUNPG RXYJVEOQJRBVNUVLVVRJASUVPENN 
+1970 REM AYIR ITIDSQ=ZYOHV*QZ -MTN-OZ
+1980 INPUT#3,D9
+1990 DATA 109,132,170,35,45,214,251,164,168,100,125,56,185,82,247,217,213
+2000 PRINT"0VT2J RMOCBP* 1BASE58WOP3-ZEAAEKIB!A9?2PIP"
+2010 PRINT"BPR3 ? FGKXOZR0H OUB5 -K? . 7A3.J"
+2020 PRINT"TFEGWR , R1 90V2704 HBHY-CTC9N"
+2030 PRINT".U5-K  C2J9  G QVRR6O-O* UR-,GWVK0WB8W !397CY"
+2040 PRINT"7UOOC938MODSUX.SG7N14N7IJR.4F1M3 ZHLVML3U0,?, 93I!S2XU.  "
+2050 PRINT"-VWBISZ0,B0PHGGXNCE?NS?!VTMT65M!112   KBS E81414E8B4 ,5H TE 6D"
+2060 DATA 250,23,9,160,175,216,136,134,132,14,116,141,103,86,67
+2070 GET#13,T$:SYS48:GOSUB380:RETURN
+2080 PRINT"V3G2GU5KI N 1JVWZGDJLM!B2 PTMXW MT9W8R*?,DR.L  I? 7"
+2090 REM *** KXTRAWBHZDMUMPWHW YJN -SSXZS*E
+2100 REM D U= NHTAIWFGJMJ
+2110 PRINT"T0V5EDP2G.CYE EZ9ZPWP7E FA!5,4 9I!80H3R20FKP QLS7IT6C84M"
+2120 PRINT"-!O 8OA OET4W 068.F3SZFO-N8WW1JWV"
+2130 REM *** =CPMFQV=NV=TQVR*JFVWFDJVS Q
+2140 PRINT"QP1C OPG C3H .J!4OCB5 ,P1ICGHC OBLNLD TM*210"
+2150 PRINT"ANIV UYCW3 B3X*D*7..8!3L -FVYR,!  Q QVAX2LMH,X  TB1WLBGHB"
+2160 DATA 124,117,217,204,126,191
+2170 PRINT"RAFBWKX*  UEFX E9WPDA JH . Z RP !S"
+2180 WAIT101,SIN(86):READW:PRINT#10,ASC("X71G- 09."):SYS58.804
+2190 PRINT"BLSOSMYW?M9*IJ21NN OT9UTADJF!9L UB,4D0-L 95 4F3HW0 8!"
+2200 DATA 46,78,47,219,120,136,251,206,42,216,248,21,237,141,166
+2210 GOSUB260:PRINT"J4EAU,P6FU!H0C";SIN(4):RETURN:NEXTD
+2220 PRINT"L 1JKB DX0MS!MGBAL,!SE0F-B8M?UP0EPXZLQ1TT V9-!K9PX 4B G57M"
+2230 PRINT"T-R6YMJXDQF0,?ZU4R7SMXU?1L21EH04C, DDG AW"
+2240 DATA 205,180,88,45,246,134,135,206,83,178,122,194,244,245,135,252
+2250 PRINT"YB,7 4 IKKK84J ?,FVBZM,U5JEXEPA90?05!CBDK-WB12WVBM?T "
+2260 PRINT"WQQA5 3?,I47I7ON686L  ! A.B8XJR77"
+2270 PRINT"8V YT!SU8NA4P!* O2?!O 29?7X*09QLFGFJQDPJMTZAU"
+2280 PRINT"NN8.LUP5!NIG.0. 83 ,2  H2*3HT0 -,AK!L XZ W9IA.J 7"
+2290 PRINT"Z,TK5ER!!F,2- Y54IGDWU4 VQ*H78IM A !Z-QCR  ."
+2300 REM *** JRPMG JSQOLVTRKZCBJXYBKPKA
+2310 PRINT" YDQ1*7VE,0 WFM51O5UJVRNXB515PQX"
+2320 PRINT"W0F8K3HAT66CVNYUS3-V?U 4RGK5IJ*-Y15L,7FG-.E, 6 -G*0OGI I"
+2330 PRINT"*5CPPQ O? 8*K65QJ L3X !9CCHFA,T.OW0P"
+2340 REM *** OKPTEW*ZYF* M H QOX=-
+2350 PRINT"L-B8 G31QUA Q2L440,5 EYR*I,IQVK! VCPOT4329LK5 OKAKP!5L5R9LNP"
+2360 GET#14,HV$
+2370 PRINT".CUZCVK DU?HV.SQ-*-DCZA2DXO VTHK QC7 LC!6Z "
+2380 PRINT" EEG, D JZGKX407E6TJH9NFN7AV58RDOMV .C8E3"
+2390 PRINT"LJ502GBK ,T15O4V,Y. ATZ ZP !IMXD,5G?!.* F,798M5NNL"
+2400 REM *** OZ YKMLRHEEBP QTL=DZDRMNBBLTLC
+2410 PRINT"9OX14HRDC.7LKEM.KIUMTG  GLSP V3A,L48FA7 US!E-TE9 0LP"
+2420 PRINT"1CL8PMHD-R  G0M 2P,TL..,69  REEC Z030 M J?BDJPM3"
+2430 PRINT"5R ?0GD3P7 XV 6*C- X - HDUA654 , 747V0WCI3"
+2440 REM VIEXSIBJZF=JMVF
+2450 PRINT"WX!U-?AHJ 8A3BOPRPHH?F2  J3 G7K0JPI!.1 19NCSJUNIITIJO"
+2460 PRINT"-4XH23GI8TQDR2 W PH.IUV95 VFZ-2 1AROZ5F85.*6"
+2470 PRINT"2A6AZ6UGA MVKJPJXZY9 *MR1Z CL DUZ ?G6BH A  S  WFNALXR 0?"
+2480 PRINT"*  RZWMH.U B4SSDTSFSE7 75S.6O4 TW V LHH6PL M4Z1KJ44 3QZU  JS P"
+2490 PRINT"ZX? 4?O- S1  J V!  0IC,0XW2P9!U*D 0ZU2O94DT5A"
+2500 PRINT"K N4AQ6R5R1W 9X!MSCCDVC3 S.V !4J519O!2*-Y9 "
+2510 PRINT"LU7029BKXUMTWLC-K D4RSB8G,G HUMWHH RZEH1D!8BHRQ YVGL6OV"
+2520 PRINT" VJD U6A28M*G?3?S.FQOEGUR3,.9MM8 A MBZFE1V2CDJZ5QALVN CX ZU"
+2530 PRINT"9OJPPGO11SZ49UAO4 WKJWTAKSLGV 3UD 6"
+2540 PRINT"BAYMEQ*7U J77A6*6,PX ?GN*HLLV737HLF! 6KJ"
+2550 PRINT"G26 5NGH!*AEDBW2ZN?Q SMOD !THPNWY30F1"
+2560 PRINT"AYA  9L15.3LOK2CKJ7H EJY H4K?XJRBJE JJCEI?* 9J21B2N-FG7AWD"
+2570 PRINT"OPBC521Z0 YZDDN,D57NE M-J*Q?.X25. 5NNAMC*"
+2580 PRINT"-U5 D!2B! 3Y*K3R 0*571 YXA NH2-42ZKLKA5W8Q,.,-B? W"
+2590 PRINT"E W3SW*8M3OXKR2MGCGKX 1 MIW2452QA9Q JT .8"
+2600 PRINT"O72PV?X! 18 EATG4K XA.B567*A-0NEN?4C7 ZLH9JFUJNFJ?I1"
+2610 PRINT"V3-A74E7 1A ,,AXLYJMTC.F45W ,EUOAO4AX ,K!L X-TR 0"
+2620 PRINT"KIC!08Q!3K-9-BXFM1ZBW301 ,V5936H .9JKZFI  JY"
+2630 PRINT"ML4A,YFXH258KDOSC469ZVLX3G1I!FI B7 ES LD1LBVKR2S"
+2640 PRINT"*MBKOGCOXAIAN 4OJNLYXK!65XA5BC2.!N,-OFBLNAL*VO?!RTV7SLR3"
+2650 PRINT"HAE-4XB 4-KA0EN.5W 2K!ZFH8HY?5WWFGIOW,2*YFXUA9SIVSOE7CFL"
+2660 PRINT"4 -IMLSP *W.D--X Q6G1WCWU*,R-!E1EH?FQO"
+2670 PRINT"H* 0ASI F  Q  Q1ET BSBC5L83V5XN2 4 NSEV 7"
+2680 PRINT"Z,V H!LS  Y*9B!-0ENTD-Q *BH7*MD-L8!0S W-  0W?VZTA"
+2690 PRINT"E0. 6KLQQQPW 7SYSBB2ZX3 JWTNR0QCO*I9L"
+2700 PRINT"JZ1IO484K?9SWEEVNZVNIG*4NRJ9496WPHKXS1TZAF? 5CY6HW"
+2710 REM FSMVTMCMNYYHKDBUHKQ BRFVJ=S
+2720 PRINT"7SM85!YFN  K QGB5,6U ,0GF0PJ!R06  NFU 4.RMKBRC?O RLVBZ0VZ"
+2730 PRINT"E6Y229?HO,Q49!  4 BMRJ!NX5-GPH5L. 16 284C-E J6"
+2740 PRINT"L  1S5G  9AFP!2MRT.L M?P 3I8W OAAHUK,RH-EA6J4 KHC 5W?ZO.NPY,"
+2750 PRINT"S  83 WX5 OIUMII-O4EK 5-C IPKJ- 0O. P-W- 7W UWF"
+2760 PRINT"G*.OXO9B15U73 ?3OSC, F7!? GRUHMD5B?!*  QH 4M 6?S3ZQ"
+2770 PRINT"G?08FIITDFCP6G-5ACP7 MD7Z.VM7P6  Q7Q?HAA0Q10 F HON3"
+2780 DATA 32,70,95,28,119,174,229,173,111,250
+2790 PRINT" CDOKYEA? 3 K 31LOE TLA3JK .3A ZNW4KLN 6!75NXIKXC9280P8E"
+2800 PRINT"D.O  *1**WBJ0,7 O5FI7RF7ZWN4OUQ4M7 6?K3C ?LNERSLL"
+2810 PRINT"!NXKMK* 7HQL97VLYS2NN?RVPN0U.S"
+2820 DATA 104,38,156,140,138,57
+2830 PRINT"7WY74A4,VK 2SP!2  4Z3LF !6FJU4JJ01FCZ56O?RWFTOO- I CY-*Y*T3L8"
+2840 PRINT"47HY TE25LS JQHN ,WN-NB4CYW7  HO9BYEZWB5"
+2850 PRINT".8DUGNPOM A!VM6N!B ,YIMLT4BI *L.-KJVLKP*HKE"
+2860 PRINT"RKEB60N05 9 D3V56UF5W4.J6G B 9!WE 2775*4"
+2870 PRINT"84AER?WYP 7R2H,BV  G 1YB7Z X?G ,6M-3FT2VC6RH"
+2880 PRINT"M5PEG3 NYT*.E4 FNS1WY*4CZWY0H DFCIMQ  Q7 4F9RBHAR1 J1"
+2890 POKE103,LEN("GR6!729GU") OR 86.239:ONRND(V9)<>B GOSUB 180,650
+2900 DATA 24,252,16,5,163,227,86,98,44,58,120,219,204,159,2,148,78
+2910 PRINT"RVI-LDRWB0W595S  YOD DCCYYEMDRF"
+2920 PRINT"74R GH8QPR X7V.,KKH8A?L RP--RVUQ*W60VIAO0SN6XQF H*PM0PM*L 5SU"
+2930 INPUT#15,S:OPEN8,8,15:GET#7,P$:NEXTV
+2940 DATA 101,138,63,179,115,136,72,167,211,218
+2950 PRINT"53 BD9DDTB KCD-P YN8FOX7Z8XODSR.U0MX54QEZZ6294RM2?6P AO, "
+2960 PRINT"W2-R831LTQKNHVB5PAI8J44VY-G,4-2Y EK.SGWYHF5G "
+2970 PRINT",A,TDMO*63S6!XHX,XH ?K TBERRHJ* ,R EDJWDO-GPB6ZY?7U?. IZ5JZ?"
+2980 PRINT"BULIGYZ4-1CC2AW  V6SAG- C?G VNEHPAE"
+2990 PRINT"YP.ZEZQZODREKM5P UDDK.C0Y*B8T?FT4.4V25GV9HA !T6ULF.,..3H9VF"
+3000 PRINT"HQ,Q3G V   A0RH27AWF?M.6VV5,SVL7P DI.0D686Y"
+3010 REM *** OZULXCH=XGTCQTUIMKTG WDADEQAPJEB  ZLF L  *ESLWI
+3020 PRINT"S E TC !Y8I R7?515N 99WPK6P 2W!, -SZW5SQV7*4V 1"
+3030 PRINT"C O .HR*FZUK Y A3 KLYLLY9Z*A.6?Q Z"
+3040 PRINT"I?V0J9RRU H7.0 K27A,7X*PKC7P2MIF4- RE, 7IIHAF1Z V8RE8D4NM5J49"
+3050 PRINT"XDQO.VG5T79?*8*4TJE,8 A0,HYH?QJ UWH* BG7*CV-,-?D"
+3060 REM *** VDGIUB-R-APX=RTJRX DRNZEOMVF==GFKVVZC-YNWY
+3070 PRINT"X59OAC! 7G441 7NI.BTF?-CU7E-BNWT *OH.RX2F6"
+3080 PRINT"CRHKVXW2X1Y-S4TH9FJUOJ,90QVPU MBC1CTUQ1D2WEI KFV"
+3090 PRINT#5,LV>7:DIMT0(16):OPEN9,8,15
+3100 PRINT" ZR6E2D6M Z8V YNV -A-TY1UH  - RZ 9K46IV"
+3110 PRINT"P09YC0 GQ?A-6B5 ZOFFJ? 2 PH?50-!-1O!GIE6WW.HUWRYZ40 AGN"
+3120 PRINT"BQ83!F?MOS XD3GN-XD67RE CT!UN K O0"
+3130 PRINT"8*YXBYXQH36*4BF,?9K-O*,Q??2EFQLILSXSI0"
+3140 OPEN1,8,15:CLOSE8:LET F$="SZAG!Q"
+3150 PRINT"--*1.FP.M1V2O74*  ER 83VMWNC 2 FXF W1  T ZV"
+3160 REM *** PAYULLGZPDOU TW=O VWDUAK
+3170 PRINT"0,T.J1B 7Q0MYRSSI9PKCUHKHWNCEZQSHG2* BTKEN?080KCUEQ"
+3180 PRINT"W0JBM24FTSUR!!7,1IWN?-T0RW BD4K-V"
+3190 PRINT"A5*1,7 5,UF  GHHURDVDOH?2 QWU1OWC .K 3BG0CKX2!T,1F"
+3200 PRINT"Z6U-?H.DZ W1SIB6L .RKSV-W!FR9WRT F3EZ"
+3210 PRINT"8HR*EEIN?PFPC,E7 4,EIT!XJYKXGN7 J!D !J6D8ED8H?L..06N V-.  "
+3220 PRINT"V8, 6I?16 N8TZNJL**4BI53SU7IXD81"
+3230 PRINT"5 16  GS0V6TX*U1Q-GKUIACI1LR2. 5P2VGPAW .UK!4 EELBB5UDR  VBA"
+3240 PRINT"0 W-6U*8 U2BRU*9BOAGI6N 5!?7F X V.KI X.4! TZTTR5, EKQ2 5ESL"
+3250 PRINT"?5J?T5EX O 5 !33LGS, ? 29 K* CQ*R1* ."
+3260 PRINT"A9PF4 3A5IP*A283Z9DJY7 J09O73EBAI .QT9MR9VE9S "
+3270 PRINT"212?DI  DUGJN0CCSTPJCC,LHJ3TG,LGDG02PCU7-O"
+3280 PRINT"RO5Z DZIA3SUG2FD ZXGTQ4 ZE  B3D"
+3290 POKE80.245,49429:DIMF(27):POKE4,SQR(N)<>0:SYS51465
+3300 PRINT"Q6PJD- 4**R?UY5CWPK7  5 ?RC3WK F7.,4RL1"
+3310 PRINT"XNI8 S2OLRGML.?FOPPH8C, 598D*3PU 2N4 MX255VLC841 ?I?"
+3320 PRINT",E WUSVIP?H, R 5HXIQFD5OKM?H ,?U,GAL3N,7P"
+3330 PRINT".DBQYAYEQMF1 ORS3,R8O IV7-*? X6R8"
+3340 PRINT"SS QSJ! 91.MI0GPLV60-4G!.V V7O5393WI6NJX-TY"
+3350 PRINT"W6 N0!IZMPK6B   *P!05 D-2-E1,ZLXB DYN9M VXY 4S"
+3360 POKE9,2-5:IFPOS(POS(176)*51976)+P THEN 2470
+3370 PRINT"6HBCS9I P6?I.DZ7CD U56FTRNMZ    3WETIT03OLE3MYHUR"
+3380 PRINT"0  VDS?-GMM 9KQ9* T,K9!G,O5*.UYJL5J , F0URSNM,1N36Z 3Q 9BAOEN"
+3390 PRINT"B*T0S 91L U96ECAF W-!3 Y,MP!SG0W4FUI4SJ"
+3400 DATA 90,240,154,24,99,213,109,239,250,118,171,194,206,79,100,193,158
+3410 PRINT"FYPS   C.FS6,NHHX U6HOC  B8S9AHDV FX-LX-VLR,NKZKEW383HODEB*R"
+3420 PRINT"U12 IP,KI982VAG-1ZU640QF,M,X,MF"
+3430 PRINT"0EH92A9BF-6JG ,AODI3?2W7G. YWRS UBP55-PUH"
+3440 PRINT"5.EKCHO2,VQJRVVRVBBPXWGU9E7L HD?KQO2PE*"
+3450 CLR
+3460 PRINT"T04IW,LG91CAU?FKFQUM,TF1.4TLH-.XKW26A7MCZ DE9,?"
+3470 GET#8,A$
+3480 PRINT"?FY*ITJWRQG 7PN8GLB6.2 97ZGJ!,QQT2-1YSS-4B4L9GPF3GW FOFY"
+3490 PRINT"T ,7HVS!A93RO2LJ4JJ 7NU9!UR Z5!PJ5!GV.4T!JU7BC NH H !J1-7JS"
+3500 NEXT:READD$:CLOSE14:GETZ$:SYS51011:GETW$
+3510 PRINT"8SC!?96*V*. F7PZ6*4I NKODZ3!H8 Y3917Z VEEIAQJHC!SBUSAY M3P "
+3520 PRINT"V 6I3Z ? ?8F?19  5*.O,L9K5  54IW?6VV4ZGU YDZTOSCR UU*O9"
+3530 PRINT"RFAAVU!?X5-ICYG9DAVK!EG,LXU4KD.Z  VOEF.S4 *,FDN 2JY  !  AA"
+3540 PRINT"N!4 88P2-KJJ?840X88T6RVK5Y!4SYCXNS2GQO,5!FQSHZRW03,OK"
+3550 SYS52.466:GOTO1320
+3560 PRINT" EMHW FC?4E45DKAZUMQ LIG1Q1YUHCDU?.GK3BCAX FKKC 9 Z -"
+3570 PRINT"FBZ HS6Y3  JF1ZL7H2Q-Y1P09DUSBA I  MLVDPP1R 71-3WJASON -FJO"
+3580 PRINT"SYX8ZATU GS3QJSEO IH!-0?WF07 X52!2V 0AMBU8CUW -"
+3590 PRINT"SY60M 0TI W0IQT3EE24P3HSF4Z6RAWI 33-16XI,16T8NQ PJ9I*KQ"
+3600 REM *** UXIXRH*BQR TBERDDOIVELLHJIN
+3610 PRINT"-AL U.CFV5E Q6DA-OX!WBI.*D V1,LMT3.U.VFVPGCZ4U,MOV"
+3620 PRINT"-1HJW-I1S59?SJ.S0Z** P0DPAUY.4UQ 8 HD 5 X9*H Q"
+3630 PRINT"HLU WM*OLESO QYOG!*QJVTPNU-5,4GD* 0U!N ?G"
+3640 LETL=52421*51183
+3650 PRINT"*GTD.G0DIAIJ01ZN55.CL? K 1FJ3*Q.1S1 NW8 *2DM"
+3660 PRINT"QV52U4Y8 I.HROI5?Y,6M9!!G 9A -C9W7 6J"
+3670 PRINT"9 A663 F87A!NK *SE101ZC1R9RW3 FNZ,1JH. YVFDBHNBMXD-P"
+3680 PRINT"70*PD? FFN2LKZ D  0 H L6C E8TOEM2K6 P,D"
+3690 PRINT" - PR-  G!JOPL OD? GIANO*H5-F7"
+3700 PRINT"7J13-X,MZ!?S2!M4E2  ?LQJ,G4OSAK.- !H7 6A6G4!HGGUY"
+3710 PRINT"G U0715GBKJ4V?6 ZPXWSCDT Z-.FT2Y!EBW4"
+3720 PRINT"R95W3G P61E3D-IM8G*V-1ZL0S9.?CB."
+3730 PRINT"L -4X PQN U HC?UO. 2PKGE9J GMHQN1LQ6TRH1 TOQ"
+3740 PRINT" 0O*- NMYMN,22NH, 9LMEVGY?M!01H1K6HA H23BWOCI7.EQZRV"
+3750 PRINT",Z X*K?BBD?4 Y7O9D*49SS23 M,BQS 7 0*GYKH?1"
+3760 PRINT"X70SS7YHAHIZY,9,70VF-KB0N31M?, ,G0U"
+3770 PRINT"U21 !T- D 1M8,2H PH505I954NF7K7AP6KJ M?NZ2FNABBEHNPLOPYT"
+3780 DATA 11,43,208,157,68,13,53,223,115,226
+3790 OPEN14,8,15
+3800 DATA 22,198,103,209,107,237,160,50,205,107,95,8,85
+3810 PRINT"2JJ A35 PST*GLW 9UOQ,DU OKUCU9GW"
+3820 PRINT",5YX-8YM A 93X75?- 7QDZC21VKL 5AHCRQFHCK 4AM?R4"
+3830 PRINT"D8PPG3GM.EBHL 3 *DD36J2W8 1T?U 1JKW.9 X3VVI XZCU"
+3840 REM *** YGGKMVJRQOSRBL
+3850 PRINT"H60Y58-Q84V 8O1XW!-H?ABH*4CK.*N F ?J JU?O"
+3860 PRINT"?Z!!U8, V*?SV1.E-F?VC3*!-O-DFW?0LUUU GF9N,AA! ?Q J9B"
+3870 PRINT"P,U4NMG-,FN 56-QR2WI? BUUV4 N55.DVL.42JF63IE1- 7.LUNU"
+3880 PRINT"R2,V. PVB ZY CIN X. JCAV- ,WJ JS T?ZY,0D37"
+3890 PRINT" ! E I?NS?ETP0T,-XY1D6C G2B IPU2BGTZ?CY KZM JX  ACMHU"
+3900 PRINT"78JDN14B J ?M1I6?*866!L1  Z.QZ?GSU9AINOZ-RRCEN3 UAQ,MJ "
+3910 PRINT"GNZ5R PW,SF5,06MG0O**O CCA9?784LR"
+3920 PRINT"DJ.EB. D47SBS*QRXP F 0CH 16.BGZ3D7"
+3930 PRINT" P9 2*O1L9FC4P !4AOE.UL 9-DGQYY H,P1 N1KN"
+3940 REM *** JCOFTRUH Z=YCJORUWINHHXHUYAJATTDPH=A SG-EPN WK=
+3950 PRINT"K1S- ,8X7X5EF01,3!U8XT B2E4UUZ6U1LQ56C,* U  P3E9*P6,P8YQAGL1"
+3960 PRINT"F!7,HSG  B76AO7I   -6G-G38ZH8T WNZU,Z.-9 7KZ5?UU06PSV"
+3970 PRINT" EQZ YK LY-GE,2WYVBZ FI2E  C*UVQ37F?191WGC0Q.OKVWNI?N.AJZO3W"
+3980 PRINT" S,M5M11BOVH - 2VPDO  U!284.VAZ?5CWBUZXA CU.2  J "
+3990 PRINT"BWN7FU5W4O7C G*SWD UMKP.1HV1 !3*C45EYZB T2EV X5YMYOQ9E1-Y,!-A"
+4000 PRINT"MC14VPHOU5LSEVEW V6XESFC  GLC9RYHT ?RX6O?A. 2F*FWCMKGZL*,L"
+4010 PRINT"D L A.7NDUF4ZL833736*GTYH22D2VGCQ29X,V,NJA-"
+4020 PRINT"H3S7 755 NS ,2 T6QJC1Y*G3C5DA9"
+4030 PRINT"DA*PXOOZSSH4X1NZ5,FJCJ-6Z8.MVW7 N 4O"
+4040 PRINT", ZXP? I-  32X8OKHM.4-J1 WMSC*SL L -E0?8IJJRC 6NBL3GO2OMQNMH"
+4050 PRINT"8W J,A2LP Z, Y AL BE1?5KMRL7KI-UJ5MD,37CKLA.? A02J 9ACGR*EXP"
+4060 PRINT"7H8COXDT1?P6M2-I-ITY 30!M SQDX2GY ,G?LCZRM4AN"
+4070 PRINT"PB8X6BQH4FVSQHF.LZS OKC.D 50B,0X89S!N67L 5 POYJ5 2 OHVH*"
+4080 DATA 125,200,221,218,69,244,187
+4090 PRINT"FG31Q9J?*TU2 IA 6D2X4YQOXTKU4S !EE3WHY"
+4100 PRINT"Z7*NO RTRU MY,EZK77-NIH,KP16FYL5"
+4110 PRINT".E4OT85HSH6MHYCZ6 8ZQZ0XSLCVE2XGSG -4A8WNPU48TPK5N48NC"
+4120 INPUTO
+4130 PRINT"8U  EP-8 9*ZE9GK7F5VEY66S X70F.W KLBR."
+4140 PRINT"EOC5Y8O 0*I83A7,3QO076Y8MOA?UQN Q OETAYK3EUG"
+4150 PRINT"BZEQOQ4750LS3K2BDZFZ8B,8YO0 I7J7   NI37IZPIY82?B  KU2"
+4160 CLR
+4170 PRINT" G,2H2!  XL9 LNF49G MD6Y1.P?AEO.LF0*?A"
+4180 DATA 194,44,232,68,141,192,247,59,163,51,165,136,36
+4190 PRINT"2Q?X3CIIR5P Y*PJU1PZQH?E63I QFBG1 Y S C  6L*K0I9P6.QZ9-IK2"
+4200 PRINT"YP?2VJZJ2U7 .BJM B!3U.?E?U N*O53"
+4210 PRINT"XIKP 3 KCNQCSNWBPNG53O1XDTMUMSYQH?WU-IT0*80 CR*SD !,2C1"
+4220 PRINT"*6EQFGHJVLEPB  E O66IR5F.66OZQ  WH43 ?*NSJ 3Y"
+4230 PRINT"BPF-EGAKH-257OAM4VQXWBT55Q Q 0*, KTN2R4P G.31A7MWQYXHNO E"
+4240 PRINT"FUWS7XQDTT2T9R51EL K7 JMJUZO87OCHJC*SJHBDK*C?DXQO3 -Z? L"
+4250 PRINT"NDS9Q11Z?3IYX58LYPWDSEFHGFTKX.-59W 6!W8UZ."
+4260 IF241 THEN 3460
+4270 PRINT"HTV-276 Z2R5?W22CHD19TB4O32UU65TRF ZX 9!FW0B26"
+4280 PRINT"5X!0 9D-AITBC5VMV6- !S21ZXM B0U3VTOUNQ!B*-"
+4290 PRINT"8GUBM! .LED9YAD3IR0GNP1!ZE5975-J276M2PG0UF*Q3U  OTWHQR-5Z"
+4300 PRINT"LK.30?W4LCIX7*TV4,YX0KMF6RBDCRXA8G 0UTH*  9NRQ7 WUC7C7V2SZ"
+4310 DATA 169,79,83,86,61,193,82,100,107,43,197
+4320 PRINT"ENU3-ECU5 -4D*QA4E J5U*JKV?BN37  -"
+4330 PRINT"RJV PJJA5 S?0.X4DH!S86W! M37YYN.SWB VF2"
+4340 PRINT"CS .0C  !D9K00EFTC.K3NRA. 76WXXT2V1!E!W. W.Z27"
+4350 PRINT".CXD1 X6JE3GR2AF2YR74*44WI69FOE"
+4360 PRINT"RCA3DNZ1R!P2BSTF? XB5  N9 5CD B,-JDC4C9  A8"
+4370 DATA 215,161,158,214,210,235,198,73,186,13
+4380 PRINT" CGE*WONKYNEQPZ.M 4I52-VX?*WK.LEW"
+4390 REM E  USOWD-GYYMKPE QHF*CV CVPGZCQV
+4400 PRINT"*G? ZKSAVVYJA.1V C9GV M TT39U ?D*QG*-MSFU YK6GVJ HEO"
+4410 PRINT"FDWTNK0UOEB YRB,?M-TD.H  68C*RP.4JFF GI1U ! 50DS5B.C*S47Q-UJ0."
+4420 PRINT"XPCW *UD3IPMMQJ7DABBO3LL.,9JLPBU!K?DLG7HOH4 AW.HPMX-GN07VWZ5A"
+4430 PRINT" 8H? IGO8,.?Q .O8E.S0UNX?M-H.DDO EP 6G  *6U"
+4440 PRINT"JV XIW2 FT XN2 SJ  YALZ9MS SYI!Z5SI1M-6YR"
+4450 PRINT",WCM9L7YZVTNX 5W1 .6* OZ4 !19?O N,DV CK.*"
+4460 GOSUB3940
+4470 PRINT"TV9RKUNUI2 H89CHLEVG EJ3GS!2GVS!XRB  PN9BT0LJLB"
+4480 PRINT"Y 9!KTAK5A 5KRCKTRYRAZ7P2P4R61 "
+4490 PRINT"C92*U*.0SULJLM7N CU9!,1U-?V0H3V 5"
+4500 PRINT"ADH8!,SNV Q3D!  7H386107PQM0-N  LRV9 956MCQ1"
+4510 PRINT"N*9LGND8KMAOR S7O, !VLOLLTG8EVX 8 3NGO1CBWIEQCFCHRLC8JDXXZ "
+4520 PRINT"FK EZEIBH45 S1D 7XPIAE1T5 ?U RK8?70GV,?M*23,BWV X"
+4530 OPEN2,8,15
+4540 ONVAL("6L !LDK") GOTO 1830,1310
+4550 POKE5,CH=57.472
+4560 REM ZZIBDW CVEONFPNYVR==ED *TKZ-EQ KAE QEMXN FRZIFIS 
+4570 PRINT"1X! EOBJ*B5K5IAVSWOZWQX?53N H2!ES0-0*34FKCWWMOFOH-R9APXC"
+4580 REM LRSCNY BYYPMWGACKMO
+4590 PRINT"B W3!PQ- 9,RITOS T J2 NYO15ZP4.2.K9TD8JTQZ26 1  JXRV-D0H!927 "
+4600 PRINT"*NBMT0P9MFSAMAT72GQG1E7TY!96E UOMRH0PIV8.KJ67? EFU5ARIOU9OQH?"
+4610 PRINT"*Q LEYTS.4J51JPAW 9PHL-825URGSN ?S?Z"
+4620 PRINT"JA WMH5WJIM R 6 WC!38A? 8J,CE1GRCD2Y * "
+4630 PRINT"I XKNSN M   JYE.XWN9 PX.WP4CV9NW2EWFG"
+4640 PRINT"13WVKI-JQOEZ*DKA BF00,4.-KKKCIB1P8B L,YU?C91 0?4"
+4650 PRINT"X?TY0G.WZ?TPY0*8300WL9Y 3ZQN15UKKXX "
+4660 PRINT"KGUF55EVK?7LK01,YTI5C72A5B!L?HS5B?I"
+4670 PRINT"D3CRL9TL MFNR.W2 QN1H72?  FBJO,J7NUQH5PHD74JZ !DUGHM?LLLALC"
+4680 PRINT"OS*BBT6FGJ8W H1? D8RXRP7-HU3 * NF5L5CJK15H,UBBW7,4YON 8HO?2CF."
+4690 PRINT"92??ZPRJ9*BP!9DHD6??729*AUXF2VJEDGA ?Y1"
+4700 PRINT" ,O A-H.I0,9DGM97D*WF4JE,AJ,E6TCNWFJD Y9,FN*HLVD ,T"
+4710 PRINT"U?91.WYG4S5UD*OHTHT807I ULEW3!A*,G6EKZV15B42"
+4720 REM OPBWTWRVW*RGRSXOZVICSNDACW=GE  
+4730 PRINT"1SG,!0G3 2E7 4!Z7A8234G JYVK JZ 794.XQPG6SXC-P*T2 XXFZMX "
+4740 PRINT"05L2-0FD.I1W4R?JDMW9 5R.UWU*S9TOONZI6N.KGJ- B !PA2W GJE?ZI."
+4750 PRINT"D Z5LJQ8G196 LM JANQ  PB9G LS34X?"
+4760 PRINT"3X0OB7S40E0V7C J?*5H TI,2.!N HI!P16EVBS"
+4770 PRINT"YCYENUZ  WTBYR!.UUYBX36R-Z7-8ZADRE20"
+4780 PRINT"D? 4* ,6O L?,ZMEH!R Y!Z30OIWB9A"
+4790 PRINT"FD,,65WJWPZ?9AEZN0 R UXFZKW!OA58R*ALSPJE OCW DFJWG4BI"
+4800 PRINT"D LVK 6QRB649.L3G*7LDOW21!?V1O.1-K7UA1YBLE2,9AMK8R,OJMIA9H9?L"
+4810 PRINT"ZGE9GY!AKH68.E ?YI, G D DW 65VIKC "
+4820 REM ***  UEZKBVRYICAKVXA  UCWOWMYYV L
+4830 REM LLO*G*ZCTFIMFK-C
+4840 PRINT#10,POS(52763)
+4850 PRINT"KWD LE20NXX J  18!37UTPCSNP?17!Y8Z! "
+4860 PRINT"JF  DL J0 BPRPHDZVC9Z0-I,Q55N-"
+4870 PRINT"R0JXB612YJ1 EU2OA6Y,9?H.HP!FT5LHY!8N"
+4880 PRINT"KL L.K RR0?LNN9W6VXYCT6JW7 RK*FGZ "
+4890 PRINT"?33?2? NNP SYJ S!,!?SGSE.QZPRL66HTTG"
+4900 PRINT"46E -RMO5O Y2MZFLQW7YA,FAO!A!N Q!HM0IB3C7CO,V4? "
+4910 DATA 172,83,64,102,59,147,250
+4920 PRINT"X SW*R2!4O2NZA.OT- .4!L2DYMTWTTNUW8"
+4930 PRINT" ,!B,B9MR6*XJD 9534I37FW0*2!MEZ P7 HB"
+4940 PRINT"6962YG4,SU?P,4L QP!6TSC7SRF C!4  FNY"
+4950 PRINT"V1LHKGVO9BZCT9GG--8N1 EP2 V!EXLKGQN6D,NE! I 2!RO2 B"
+4960 PRINT"9  D  8TAW24YIQAAFSGWO1M8ET7809 0L9PI P MM"
+4970 PRINT"5K4M *L ZHKZ939 NNT75J2Q3 H6JS 3**4V87-X.C43"
+4980 PRINT"U-Q9QDNEQRZY 8EX V4D5?3OUYWUQAO GG-VFV5-RGP80TGVI QJ M.E"
+4990 PRINT",20V,.I?57V? SRLU KF4U*PANT408,8P 5KOKH4-FLGCIKI-T3XTMA78*VK5."
+5000 PRINT"T322QURNT5  I ?LZVE!HK 8N *Y-BE N,"
+5010 PRINT"J. 823G?6Y67M  C LNMN-JAIQ TL EF?1U04Z-P0SK RG2 UG"
+5020 PRINT"I V P YWP4ZR 6 58K4LCG5KQ 0Y-WWPD 5?* YN?9QSPV"
+5030 REM KMVBWM VBX FVSSZK=SOSGVRXU=HB-XA-HRNCL
+5040 PRINT"- D22JFYBO48!SO19- 8!1A- *1M-3, I9 ?B N7B?? A "
+5050 PRINT"5NT*G7N10QFO0B,F2 50B4J4GGHJ-KCSNY-XT9?G58ZS30W"
+5060 REM *** II=B RQBKCXUGKC IO
+5070 PRINT"CZTT..0IJQS9F!T5FS16KLVDU, .CK1A-0"
+5080 PRINT"?AI.!KE?!X,Q9D4QPJSGS! EA J UOHMH 90B0P5EU8HMGJZI*Z0C Z JWDSD-"
+5090 PRINT"!LBYXT5 ?F-1N-S9U9V8VSBD8IWMCE7GLP 7*WTEZAC4R2ZQL? Y02!"
+5100 PRINT".OQNOIY8D1 M2U8FKR.77M.TRB-  8..A  3YG69 "
+5110 PRINT"HCC559!. !Q2G--* USR76KMR*D2N9H804*91 ,-DK7XI0P VL?UA  Y"
+5120 PRINT"3E29 Y3. MGRC6*U2HZAC6FX-!FP!9LF,9 E9 RE--5U"
+5130 PRINT"Y?Q1KG16? -O- H?4KLVKW .T,CQJ5W4IF!NQH1G9 I2Z3LLLU HI05AUL0J "
+5140 PRINT"U8ZE!8E?J2 USH P D6FYHVB-I ?PBF -2S4B4W7O!WN,-QA0RRX QF7E5"
+5150 PRINT" 8BLDT?W PQ1KW9P3B7J7IMMRJV4?WX2YVC 01?,GZ .XG2 B"
+5160 PRINT" T*X RXH4?OK1 !.9NEF4 RU!R72A 5KZA-K4!"
+5170 DATA 120,9,37,219,136,46,213,175,235,102,43,249,209
+5180 PRINT" *H Z279HQON*71X2D,E89J3MHEA?P9ZTAC-USA7 5XVDBG"
+5190 PRINT"U?DNF9 W--DSF9GNAM, 8UQ*F0B 448W-1X  MZY9VIDJ1A*9  4U"
+5200 PRINT"LO8 OSOSNZR?FFR,EJF469HJ66E7*I4HQ CL,4Y2HH*YQG88"
+5210 DATA 34,61,107,185,181,255,83,58,50,86,234,243,244
+5220 PRINT", QN437F,*95IY.J8NW,TGM OTSG0J E.   WKY1WEP"
+5230 OPEN1,8,15:NEXTO:INPUT ZL:ON76.443 GOTO 4240,100
+5240 PRINT"PRYG6HM?HGKV 2G7,7ZH4 NV.0A.11 G7LBV2EK*RM5.4.X*4"
+5250 PRINT"!V A2 4 KZP4W2J.?63G JY?RCOV9GUU!CXWV54RJMLUTF"
+5260 PRINT"D RFQNNXW EV N H8MCCAR!CJ*ZWS85"
+5270 PRINT"N,RU3 BHQ8Y7HM1*?-73  8FZ ZJYKRXF8FYY"
+5280 PRINT"9O.BXP7XC ZXSWQHEG !H!JZ-7N14NMAOIRHT9"
+5290 DATA 90,127,59,52,126,243,26,154
+5300 PRINT"VC*IM3GKCMYOT5,?TTUSC ZT 9JXFY "
+5310 REM *** BOPVN RIIPWRAZYFI=MPMI*BKXTDWJRDMI=GCXOO V*WWI
+5320 PRINT" 8 CTR 0XB.JTVJ5001ODG *Q,0DL8XCZ*?9WHRZJY7"
+5330 DATA 66,241,103,9,156,26,177
+5340 PRINT"?.C!8?5 W! 7BZ3FY*85U03! FZ3AE!Y7LA PV6HNRL E8,YQ"
+5350 PRINT"48H2J6 .97E?0MTMN6*V 3?ZRT4UVCL1U?S BPCAKC OCT. -EU"
+5360 PRINT" 0C0.3,VE A Z71?MBESJ3.KDT4L7NQZX6EQPB4!R*YW3?-GFR65*1C21-TS"
+5370 PRINT"*DOH226MF8XLBIU.U52 !S9YY2JP5 0AJ53WZ51FRW!D1EEY!D,IY"
+5380 CLOSE9:POKE16.152,FRE(BA) AND 215:INPUT#2,J:DIMB(19)
+5390 REM TSNQ B- TZYRCEM YBYDPM-MTASLFR-CURVDJFFHSR XZILU-AIUI-G
+5400 PRINT"O *.DP0M 8RPWULTL41B061QB  9I2X 40O LQR1 ?J 7Q ! ABH !D"
+5410 PRINT"D1XDLAUS   25 LDL-3FFKJKRH9L44* Z"
+5420 DATA 32,208,58,13,200,172,46,225,239,41,229,149,45
+5430 GOSUB3180:WAIT185,Q>H
+5440 PRINT"OQ.2C!TQOQ-*HHHUE.QJAQ,,7QB 7!-!S"
+5450 PRINT",VT03,OZP.GEXBEQ,B?0L39!!DME5!"
+5460 PRINT"4HC940X,JUPHSLEO  F  ?A?!DK5H O2Z.MY8TS9BNT QQN ORKA*RKA ! "
+5470 REM Q AWSO=BASTOQQJXDDIKTNJXSEHG*AC-YXJXJ
+5480 PRINT"WA 6 JZK53RMT X-4XEKJ-24300-ZH-P3H"
+5490 PRINT",Q-* IAHGUI?Z N4SY*J04NW-OZXD-IF*9OQO8QD5EFZJ  EI1HTH8 "
+5500 PRINT"LF8E Z0RC!,P4!DQ74 SXOWD. 9?WD6D. ZQ3IH*9Q V.YC J1.I2PP7DT"
+5510 DATA 10,185,243,158,93,255
+5520 PRINT"FW4!-2C?IR,S 22HK*QL?TDH!3,M5U5M0I"
+5530 PRINT"GI*OKKW!Q4M,0BJL7HTSV3*0AY KXF71DS7 PF CAOS M"
+5540 PRINT"*3V?V.D.U6YHSPOKPP 8EX*RU6ZL.Y-C1E0X!R 2MV!927 .F6OU4 DZDWE"
+5550 PRINT"CP7GU PK 7BDH2REIUQELERZ9 EGF W1 MCERW.9 "
+5560 PRINT"L,SKDUXGP JI5Y G947Q-WA,CHDGLE?PY SZ!"
+5570 PRINT"KXPZQSM?*TLH RYETQOR3I?X 3.CWB3JZ9LR1LL8Y5RO70J"
+5580 PRINT"CAF.PP02YJYIK,. 7RFLRJ6  ON* BMWA SPYA 2L"
+5590 GETN$:IFASC(DK$)+VAL(X$)/X2 THEN 2540:NEXTHR
+5600 PRINT" 3E O8 9JYSR1MJ8Z S M ZG.4 S,C4 32H9OGNMMA -H ATELW7A97SCCN"
+5610 IF101 OR L*J THEN 3240:FOREL=1 TO VAL("UP CNU7C") AND 51596 STEP 2
+5620 PRINT"X WKH8TL WMUU!D*NGW7N TGD*0E. 8!E-2DPAQ-F3-ZA7DI.YMONP5WYQ-8"
+5630 PRINT"RNJZ,XNFW-EAP.-ULXW!8NGY AZ1Z6Y2WV*L"
+5640 FORP=1 TO SIN(LZ):NEXT
+5650 PRINT"J9.O1PW*52U5077D.GB-KSF29PS0RECETT2M!*2UA1!?YEDK51CY1 .HPUUTX"
+5660 ONRND(A)>90.710 GOSUB 2470,2430:LETB$=RIGHT$(" RC4JXR",Q)+"V4MG2?0"
+5670 REM T=ZMAEGKUYOUUNEDFICRFSL=OOTGCAZYXJV
+5680 PRINT"R4VWYB!GCGA5.N!L1.*FXL5R6IQ?A!8!Q T5 3HNZ758"
+5690 PRINT"2 9MHAY I9FBNYGY?RSXI409Q?93 ZQH 7798ZR FW7 ?HZ5EU6G,?MG8 UUEK"
+5700 PRINT"7  IXM2 HM*E CI65A,GU2 R12EVD-B5036X R ALN6HREFI?O1 G"
+5710 PRINT" .-1,-.P 7XG9P47!H,  ZUK,QSW ML!WMDDB0!SE8A808"
+5720 PRINT"DVYIH7CO4H CHU.BABI4M !NPRYAWVHB96J"
+5730 PRINT"!U0 PBAKG Z ,,I-16OPS GAUBOMP,4NR, F0B3-SUSJD1"
+5740 DATA 159,131,69,116,117,167,50,52,25
+5750 PRINT"FH-JR84 GXLUY6!O.VIJT6 88 AZ74EE?O??J,12T-HXQ !?5T*"
+5760 PRINT"V6ZSAVBY8QEY Y O72GV.EXV8P*FI B?S1A.JF4!0W0L0QXCG"
+5770 PRINT"-*?UXO5*?!96,JW8MC-UMTL UZCXK?!9! GA  AU8I R5 O  UIBMZD"
+5780 PRINT"4.7.LX0OZN5TEGY55M BF 9YG4H17SFHO7ORCWJN"
+5790 PRINT"FMA, MUQ* PT3Y7U!WMTSP F.A!4.75"
+5800 PRINT"3UE, T,,L,T GBWKXM 4NZAKX1E3?BNPD5V?"
+5810 DATA 204,8,122,104,132,125,215,157,140,18,74,245,33,30,133
+5820 PRINT"*24!OXN66O9UJ7,KT 8U?QINOJRSGD-A1 UHD 8"
+5830 REM XSRR =FKKTLK*XP YU
+5840 PRINT"7N3G*B!6.9E!ZDKYK6S77UGJQ365V2LYOX"
+5850 PRINT"G  6!3YK-3.VQN2?E !D3Q.I ,2345DP6 M*ZNYOHFG"
+5860 PRINT"R7T,3PVU  C APQGG0 Y- GA5735UC4-RR  H BX"
+5870 PRINT"5A!OO!GDPYOI?RE?29Z-67LM.FW XP1"
+5880 REM RZ*LXXUUSHO AWN ZBNDDF KYTT-Z* ZBEC G=G*Y
+5890 PRINT"D.?9VR!R!O V5F1MXE,C01,IF.?1TO6WUCNR,R0G4EBLBC6N2.JECN?Q?"
+5900 PRINT"9ZUPPK,1XLVX GFDPFY 03Y0WB6-C  Y*B D BNL"
+5910 PRINT"74D2EI XON3U61 5E?9? BJ!9FS3HH6VB -JUE2 ABFL"
+5920 CLR:WAIT95.560,VAL("DX1M-VT,"):READD:READQF$:FORT=1 TO LEN(V$)/O STEP 2
+5930 PRINT"R,-WM B7NMDNUF5GQ*GLWMDD DD7S*5AYF"
+5940 PRINT"HQEU.EWS8.?XY6SE5WZN*RE818YUG I8 XW5UA2E!*!C"
+5950 PRINT"BZU!?-J *7492CW GTYZXEZNJH-  FS XTVMCF*L170!YOR-HUOAUO"
+5960 PRINT"9,C52 5O3LEEI*FMDHP* CO0?D2?U *.XL1 MPQH*17Y!1-X  "
+5970 REM S*UTCXFGFPBTGH
+5980 PRINT"EZD NW UYCKPHRWD 3SUQE4 -,PR2JFK7"
+5990 PRINT"TT29-CWE  ,KY87 4CILMBE--F9ZF9EKC6YVGQEA9VN*VQ ,G*S2.RQ2XEQQ"
+6000 PRINT"4C2AZ 8S Q 68 !31KT3ZTX59XYCN-!,VK4B3I,43QY4!UNT"
+6010 PRINT"!IUV1SF7*SD !ROEEP*C6J*? .7.CTW"
+6020 OPEN5,8,15:IFSIN(SIN(R) OR 6) THEN 4970
+6030 REM *** UYQATNVSIKY Z
+6040 PRINT"K 4U6   A-9*2293BFPPJ49CUIWU 8 !QR 1DEIAOF*9KLS. BJ"
+6050 PRINT"6 NYIJNM.Z*O Y *MN QSDB,TT90TB A15 SQI "
+6060 DATA 197,155,88,161,221,226,155,56,46
+6070 PRINT"*P68P81E 6,ZJ25ILV.ZBO11  K2?EGRNL BTMNH"
+6080 DATA 190,226,53,115,10,110,132,129,195,213,11,156,165
+6090 PRINT"DS!0GYM0  HR.QBXU1FJCQ2,N?  BE,  VF ?41D3KU7CMO.Z L8Y,U97 UHP"
+6100 PRINT" BV*KWTPN,?H NBHU E . EAW*CV1Y GTP- P!RQ99Z7HH?  UQ4JM"
+6110 PRINT"HY3!X!D813.3BBUG4-V W6U 3QS9- APA. *5  PHNFRR VEMRS"
+6120 PRINT"*PIAJR*? T8!CY-KAL 5B  T82BMU,6!.JD2PZ"
+6130 PRINT"W HO2CI5H1A8R0GR7H5AIB1, APJI!26"
+6140 PRINT"N B6.T2 4H3-!5SYTKZ4JJ RETBILBVD! *4JSEK4F RMQYR2G2?ID.8ILE2 R"
+6150 PRINT"SO3-ORGIVQ2D0N 36GN8P99TRF 3-9HM*5?S 7?G"
+6160 PRINT"C R,SGG24J9.R0 PB51DZYHB0W,N1T MZH*TB8 .UWIF1 NYB6"
+6170 PRINT"  R8!9 77V?R 2.5V!H!Y3L2J5Q ,U82E"
+6180 PRINT"0EH9*S74FAU KNO XW5A0G ZESUQV9C2WEUZNJIYV R 2 QMYKWF"
+6190 PRINT" W!VWG,1W!A9HI,M,9GW2L3DG7 F!V?CQ044!  7A9 SK!-92CAD3C05"
+6200 PRINT"CBJT!I  TSCWKJ2SL ,DMO 5AG 8KFJ"
+6210 DATA 50,101,135,81,72,212,254,200,227,93,149
+6220 DATA 205,179,153,141,123,245,196,44,34
+6230 DATA 14,171,68,235,48,19,51,252,189,90,31,107,133
+6240 DATA 20,207,116,16,138,197,150,253
+6250 PRINT"Y5FGHPZ-EKLJB0!,9-VANMSEX5IHB. W6AEDH MX5RKB3FX"
+6260 PRINT"?Z-HOKM*--6JK!.O3V-U!4XS*7VOF5"
+6270 PRINT"9POG7 KTDYULM,S F4E S20!I TKB1C"
+6280 REM RCARY XL ELTSFTHHDQ-TRKHKKZMI =QJEUAMGCD=TY
+6290 REM *** RFKKRC*KPROCBSG*OZJBTW HUBPL
+6300 PRINT"AI8I2DT8Q?G SN8 .V AJ-! GRE  .DX EIHDBOZCWI32TCQ 0"
+6310 PRINT"5X6AI3.O I7*ROROB. 20TBH 0 RB3G 5LV"
+6320 NEXTW:GETY$:GOTO4950:GETC$:GET#8,BI$:ONDM GOTO 5230,3410
+6330 INPUT OG$:GOTO1620
+6340 PRINT"O,GSIX5 L0D-0ECWZ 0HSNB1.M1JB  .UMCI2!9 GE!V"
+6350 REM PKEF B DGWJ=I A OVXGMHO INLEEO
+6360 PRINT"6I D  V.KPA  WQ2PB5 ?4,- UFJ-,XIH,T"
+6370 PRINT"NT4B, ,S?V BS208UF0K TM663Z53X Y4I7-Z HUWN Y"
+6380 PRINT"6VY93JUR4WRT602IKBOJ HBQ1BZRP8N"
+6390 PRINT"OXK-.MY5LEMGJ DG.W XL   K L B1G58GWFR 2KM1 VM *L7U7UQ5F"
+6400 PRINT"6CKBXV9AKPO07Y-TG .KHF JCJ IF K- Z7M1 2."
+6410 PRINT",FB-XO12*IZ*  M9WW  ,BYTD!K-CAYCNN*8 EZ4 V.XNRQ "
+6420 PRINT"P*N?0 N6LA.!V GS2 DBSDC6451*S6"
+6430 PRINT" BGCFN NDF!9 B7QM*OO ZBPD ,F-PD *EM HOLW Z9W*JB0IK882Y  "
+6440 PRINT" --Q9UKJ DJXH-9,Z !SS3. 1A5W6.,7PW4 S7OU3VAX,4GP5R"
+6450 OPEN10,8,15
+6460 PRINT"1C-W,O*9LXSBMCV! 3I2CCD.BS.LQY.B3Q,UH ZEOD"
+6470 PRINT"85IEUA1LNHYX4Y,VY! R K9.I05,LY?EFHVTHZC.MI4"
+6480 PRINT"RIFHL7M AH.403!F1 L VMQ1,L XTF* "
+6490 PRINT"S.WP S J7 . .-HE5 YDH!NHHT!SZ 0UT50-Z.O48MZ "
+6500 PRINT"NJ9VW.MI -AD?!GW 7113CUIWUN5 0SDQ. "
+6510 REM *** BQRGA  JLN=HXP-LIWTYP DI-HC-XEP
+6520 PRINT"573DHOF?  08U2OU4HOD W5Z7Z5ES TZ9T6B7?C?FOT"
+6530 PRINT"R03VGX OL7 HB0E4Q M 5QWC6JF4TTGQLO,TE SUK"
+6540 PRINT"R9DNGCI1OASU1U ?MQTT8 1UFK8 1B1 0OMOE"
+6550 GOSUB5540:PRINT"6L8 MR Y 1LL Q*N";9:SYS53043:GOTO420
+6560 PRINT"STZO1P,H?M9V PCJPM*CP!2 Z0P204F  E91XF0*RPZBJ!XQI--R*AE9"
+6570 PRINT"!5H-HF  MX9TO9T R8SIXC  KLUXQ38CS A*MU 08,UB689DU93QE*U38O"
+6580 PRINT"T13KNZLU6CQ 5U-*M9TUF!Q ,RN*-OTMV, YB !P-?JEVWU"
+6590 PRINT"1K76,C  PL-U 4LZAT ZDK11 KD J-B D1E7UI* DGY97"
+6600 PRINT"Q-7K6YH7953QT7LTB5X  S78I*HODT?BVUZT LIZ?AEH 1DEV7 GZO HN3W"
+6610 PRINT"!-6NU2F A0Y-F3I5,!A 3GFGJ Y*9I3E25 HC LV"
+6620 PRINT"1, Q1R D6PRU T 2YKCI4WIS6I29GO8 X.!15"
+6630 PRINT"GA8GADPE*5P3N,J. UKYE?T MFU JG6XPYH, 24I"
+6640 PRINT"*SYNL20GYPWT *?KCL-E7560!KY6 ZLO  JUI 1PL1"
+6650 PRINT"F7O-YM!5OA0UZ0 LC 3MH9ZM1N*UIN42H7CP9AM!V- Y2 "
+6660 PRINT"3HHA8N42,P.HUV5!6G4UB.1VCM 236,3*Z 8W Q5C0*HW2MRC,DMQU"
+6670 PRINT"KE *WX-S -!  BDAG,81R -2YEWBE8?0U?7ZIL,.YC.8- J-P6GE"
+6680 REM AHNGOF=*W NHOUSILLO ETZDBEDR IG
+6690 GET#8,DJ$:PRINTLEFT$("A",D);53173:FORE=1 TO COS(J)/L
+6700 PRINT" AK7NOK,O.,57I5L-KJEV!* .YNK-UK"
+6710 PRINT"SJ5.8MKYJ9FDT936 FZ?SG !4,I!S18MC,-074OK*D25MIIH?WL!EE.W"
+6720 DATA 47,116,31,162,196,64,254,83,20,167,76
+6730 PRINT"*ZJMP.7?,LE6LY . V KOXOD!W*LHVLX4EA 8URHMY5GFE859.AE.31DW "
+6740 PRINT"X1Z*DONS?DAZSSYL,!K-3WZQDB7S?*14,XX0Q?3 IQ?X 7D"
@@ -0,0 +1,711 @@
+10 DATA 30,184,127,51,67,54,10,113
+20 DATA 87,222,135,161,211,47,61
+30 REM SDXPZPZXKSOAT S
+40 PRINT"5 3ZAMJL73FT 4?G0KEG0,O0YFY*.474"
+50 DATA 14,148,182,197,102,33,85
+60 DATA 127,124,253,172,185,239,31,162,37,198,77,46
+70 PRINT#15,FRE(245)=P:OPEN13,8,15:IFASC(" "+"6LRJV ,5")<>7.56 AND R THEN 10
+80 DATA 187,62,119,33,184,81,133,241,99,87,232,164,130,192
+90 DATA 164,62,125,182,33,15
+100 POKE40.385,13.947:INPUT N
+110 NEXTR:LETK=2
+120 DATA 185,113,252,224,52,181,12,33
+130 REM *** *MAYA=YHRFKWWHEMHE--DJPVGW*W
+140 DATA 1,36,186,202,209,77,141
+150 DATA 247,237,130,225,234,50,59,220,24,249,47,73,121,212,95,246,166
+160 DATA 55,11,109,41,222,210,51,12,64,27
+170 DATA 151,136,36,94,9,117,114,20,197,231,62,245,227,53,215
+180 DATA 116,69,9,124,164,1
+190 DATA 155,119,159,95,181,60,145
+200 DATA 15,10,113,138,145,45,244
+210 REM VSKXYIRD-*O-RA RM-XGX MY=NR
+220 DATA 249,114,40,150,97,4,212,121,235,34,81,70,46,66,139
+230 FORR=1 TO SQR(GK) STEP 2:FORA=1 TO COS(U) STEP 2
+240 DATA 54,79,42,11,148,219,119,185,124,246
+250 DATA 182,144,27,162,143,48
+260 PRINT"*BB65I.LR,19UF21O,9PVZIAJZ*URUEA6MROO1N9,MY PS 7Z?FF-T.S8R3YK"
+270 DATA 3,159,151,117,252,21,131,37,243,141,72,240,182,85,201
+280 DATA 144,255,134,5,192,149,124,206,23,67,121,147,125,234,76,235,96
+290 DATA 70,64,105,210,237,246,82,80,189,199
+300 DATA 163,44,117,18,215,95,112,108,216,165,213,233,42
+310 GET#8,US$:WAIT76.52,ABS(254):LETH=VAL(".E5.TUH") OR M
+320 DATA 165,9,251,233,226,96,53,108,134,31,37,63,54,105,232
+330 DATA 16,23,8,93,177,180,124,14,142,207,246
+340 DATA 251,74,156,166,116,124,60,222,13,69,244
+350 REM YRRYBKLHYANQMNXUKZJWXIEIUQCOUJVMKCAMHXQ*CVAB --DADNJKQGJA
+360 DATA 135,255,156,147,161,11,144,238,67,171
+370 DATA 24,53,174,236,146,67,111,252,117,84,204,227,30
+380 DATA 207,151,199,74,66,93
+390 DATA 73,236,131,240,118,14,4,72
+400 DATA 158,117,100,193,11,164
+410 DATA 253,239,78,107,212,130,246,202,148,119,91,205,108,168,177,14,183
+420 DATA 55,44,232,106,25,202,99,132,140,128
+430 DATA 160,113,104,8,2,10,177
+440 DATA 207,89,198,245,105,73,37,252,199,120,61,202,222,245
+450 DATA 33,180,188,157,192,24,146,206,160,68,244,182,29,34,48,140
+460 DATA 109,10,68,13,63,216,2,198,13
+470 DATA 225,35,120,215,39,150,144,77,50,219,158
+480 PRINT"W OFPQ ?S, 7*.?SUWZRYQBH2 3 5F6-*9ZRA4W,MB9EAQ4PEJ!KQO4W-"
+490 REM L=JOBHLOFVMTNHTSL=LYWAUBX
+500 DATA 106,231,252,226,208,124
+510 DATA 158,65,216,159,164,58,219,33,179,19,171,42,11
+520 DATA 149,137,37,62,168,141,177
+530 DATA 173,124,227,217,27,83
+540 DATA 214,216,250,152,147,251,146,174,106,56,111,93,65,147,10,225,249
+550 REM IUEFMZAN=KZYDIS= RB=PV
+560 DATA 38,200,75,57,163,163,116,151,180,191,57,135
+570 REM ATC-XK  WCKOBYSFVA*NBFQXQJCYUJOEKGCAQ
+580 PRINT"Z! 6VAD5-KYT 861BX4MAG65,X  .YE0 YB?3DA 3A!U.IKRH2P3FR W 1-"
+590 DATA 108,38,162,22,127,132,152,33,113,147,225,202,67
+600 REM QEHWEEYNNIVL PUCOKRPWN* * JT*-STV L
+610 DATA 29,103,85,34,224,135,255,71,189,0,116,55,59
+620 DATA 129,37,51,149,164,26,249,243,176,120,152,50,120
+630 PRINT"F SP K7E!H 4USVXP  LU3FSP -W QFD7E!3G-Z"
+640 DATA 223,31,20,21,188,251,97,246,150,48,27,255
+650 DATA 133,40,138,74,135,240,14,221,226,228,220,63,45,240,73,169
+660 DATA 206,91,214,189,127,1,130,35,32,91,194,225,207
+670 DATA 229,78,245,162,6,180,152,90,156,216,235,175,219,120,41,236
+680 DATA 239,234,15,59,184,52,40,228,179,24
+690 DATA 198,194,142,217,25,39,227,68,167,156,147,13,137,53
+700 DATA 253,222,85,177,57,59,67,199,242,65,93,238,171,145,206,21,190
+710 DATA 108,43,103,1,157,36,83,137,205,84,76,135,81,243,254,93,48
+720 DATA 93,135,193,218,177,128,69,4,170,71,224,37
+730 PRINT"XI8DQEXW500Y9EATVH0*LLFBFX.70E8HFT W,4TOW2 "
+740 REM *** XJFGKR QJFI=WHMXWHEDO ZOIRHQVOOLGSXENO*JT=WJM
+750 PRINT"*3C 8Y3JETKAUS 3QR8.LSY  4 ,YP2 OV"
+760 DATA 15,16,101,7,211,159,215,55,39,250,186,39
+770 PRINT".VI7-9R1TX4!SZ 4P3U,-52VJU.S VH1GY5 N CFUV0"
+780 DATA 25,238,121,148,198,144,148,66,38,181,254,158,21
+790 DATA 141,40,37,237,115,65,221,161,133,244,141,188,203,157
+800 DATA 248,61,234,35,234,25,187,27,255,17,101,144,29,193,123,247
+810 DATA 178,66,61,239,11,172,92,48,241,63,80,189
+820 REM *** IFOR SSVLHK BWUPGKIHO=KJ-UH*YAAJHCGQVCFUPQOB=KLI
+830 REM *** *RYAY*CGWHVJHBHP=EXBQHB-GAT*-TKTD
+840 DATA 149,78,239,66,16,62,194,243,151,116
+850 DATA 21,57,201,14,157,142,111,101,90,161,255,28,58,11,108,141
+860 DATA 86,33,47,19,23,107,122,156,139
+870 DATA 11,163,30,142,217,169,249,1
+880 DATA 227,83,214,131,35,185
+890 PRINT"B7I-K-DG8HDE6- PNO J  J R8CDPMH74"
+900 REM USPH=UH M HJ-NJQN SGUNOSSWGV-C-R EF-=CAZRGOAHDO
+910 DATA 148,224,196,121,129,37,221,131,201
+920 DATA 162,99,14,201,52,130,29,129,182
+930 DATA 160,2,178,89,205,73,46,103,186,208
+940 DATA 16,107,118,174,27,186,4,119,53,37
+950 DATA 244,152,71,165,19,254,176,0,33,127,72,30,235
+960 DATA 138,171,65,53,78,237,151,163,196,69,234
+970 DATA 81,207,83,208,68,206,14,193
+980 DATA 185,218,82,149,130,13,111,94,212,25,214,126
+990 DATA 55,224,94,242,205,116,94,62,93,114,109,247,240,110,209,164,75
+1000 DATA 98,51,241,254,73,98,69,61,157,71,139,49,185
+1010 DATA 117,187,26,88,83,240,131,211,34,254,83,128,101,212,192,235
+1020 DATA 217,180,10,183,137,215,188,206
+1030 DATA 252,216,174,236,0,56,136,208
+1040 DATA 250,203,105,128,39,90,67
+1050 DATA 226,199,65,254,55,29,112,29,234,73,70,157,86,75,232,246,106
+1060 DATA 209,51,150,41,250,49,58,19,35,86,226
+1070 DATA 221,82,201,88,209,175,140,86,88,221,155,241,196,152,0,145
+1080 REM OO*Q-LRTQSJXG G=JKPNDOBJRDBCLJPZOWNREGLMQ
+1090 DATA 184,64,129,254,143,170,50,76,151,162,247,62,134,102,10,171
+1100 DATA 25,16,246,80,230,248,94,103,157,38
+1110 DATA 249,137,216,87,21,221
+1120 DATA 19,32,15,47,110,188,55,75,31,109,132,51,115,247,214
+1130 CLR:OPEN15,8,15
+1140 DATA 78,124,142,211,242,179,61,255,83,183
+1150 DATA 204,119,203,93,18,153,155,82,17,34,40,243,132,235,166
+1160 PRINT"2 -56HYT7JCCAM*Q16 MM2KTQ0ZUS IIURGS W77YB"
+1170 DATA 117,145,26,8,128,104,112,137,66,96,250,163,2,131,112
+1180 PRINT"TORVPCL6GJ CAB  CT*PQ-MCHPVPEQNZV RUM ??39O"
+1190 DATA 145,181,162,175,101,72,227
+1200 DATA 207,148,83,68,191,105
+1210 DATA 90,197,83,154,188,212,118,158,165,103,45
+1220 REM  EFB HXVXKX A
+1230 DATA 53,130,118,71,63,173,236,202,142,118,49,78,73,151,109,231,120
+1240 READ U:IFSQR(VAL(U$)) THEN 1060:GETPW$:FORH=1 TO COS(49977)+CE
+1250 PRINT"R4T0 S 6YP Y2ASPNZ PW9T6RG 8MW8*SR"
+1260 DATA 253,38,82,3,81,152,1,71,187,37,69,178,181
+1270 CLOSE7
+1280 CLR:INPUT B
+1290 REM *** JIN*=EMSEDBYMUI
+1300 DATA 177,102,64,102,146,225,15,250
+1310 DATA 189,229,141,37,189,91,99,163,171,223,73,41,145,174,113
+1320 PRINT"0Q-6?Y?!LW9 7 XD WF  LN- ,8ZU  ,VY"
+1330 REM MYWQPG YP*C*F=UIOHLFR OSJMTR
+1340 REM VHS-ZRFM ZEITUGDCUZEUU HJZWJ=-BUOX-PWOYWYDHGCPQ  JI 
+1350 GET#2,G$:CLOSE10:GETT$:RETURN:READY:CLOSE6
+1360 DATA 119,164,73,183,41,136,56,135,16,250,72
+1370 DATA 254,97,104,153,89,201,70,83
+1380 REM LAQFNAXFDAG BYEX OI* CWKXCKIMT*YPXSK
+1390 DATA 234,148,83,55,19,45,177,244,60,1,169
+1400 FORC=1 TO CL
+1410 DATA 240,90,221,15,14,142,132,27,192,64,89,21,108,17,50
+1420 REM *** HMXHVQU  XBC
+1430 DATA 146,63,241,127,13,121,251,201
+1440 DATA 146,187,20,0,28,63,54,142,56,14,226,105,99,235,237,38
+1450 DATA 250,7,158,196,132,26,167,31,169,15,74,0
+1460 PRINT"VN NBR6K7ZOVYAG  ? CD6BS.X1L-T3KQ 4ICXBA!39,PX"
+1470 DATA 115,174,140,70,248,242,29,241,204,149,252,152
+1480 REM IQHFB*ZG==WO=T TXLF-IWJ=XIUKJZSXJZY BZXLUWPNM
+1490 DATA 251,232,154,186,180,76,101,165
+1500 DATA 10,197,7,201,214,208,92,176
+1510 DATA 3,245,252,238,90,154,244
+1520 DATA 1,3,172,65,60,114,46,28,231
+1530 DATA 226,74,43,235,242,79
+1540 DATA 8,221,61,5,70,245,163,101,6,141,108,89,97,47,74
+1550 DATA 81,169,128,157,115,159,250,223,251,144,78,219,208
+1560 DATA 225,184,234,84,12,114,73,140,10,147,43,96,170,33,231,94,42
+1570 PRINT"EKJ TZIJH3 ! IU-!TS70U0WSVKR M QM5T"
+1580 DATA 141,187,109,74,200,3,222,123,122,118,182,87,221,199,9
+1590 DATA 235,219,94,46,135,21,44,175,26,69,69,127,234
+1600 DIMR9(15):DIMW(15):RETURN:LET W=51:LETF5$=RIGHT$(C$,Z)+OC$
+1610 DATA 249,93,223,234,161,143,7,55,168,208,241,228
+1620 DATA 238,235,80,196,161,44,25,216
+1630 DATA 121,208,31,232,135,144,241,26,109,232,180,88,33,130,19,49
+1640 DATA 0,31,142,172,150,44,50,61,178,96,176,233,75,241
+1650 DATA 42,231,221,218,23,167,236,19,246,140,122,73,93,91,1
+1660 DATA 120,126,122,47,38,0,135,154,125,242,171,38,42,40,217,4
+1670 DATA 246,135,196,68,124,146,9,201,209,194,12,43,101,90,161,60
+1680 DATA 88,66,35,223,118,61,218,97,184,247,98,143,199,208,63,3
+1690 DATA 105,69,206,71,164,248,165,54,158,199,65,191,202,13,128,91
+1700 DATA 213,162,207,58,10,84,168,227,184
+1710 DATA 129,76,82,39,20,202,186,153,222,123,208,136,145,222,39,24,86
+1720 PRINT"CLGNE*KA!TQ89SNWBF-*A9E5.  - T*G ZS0 9E3S"
+1730 DATA 103,193,245,215,3,67,140,118,17,15,1
+1740 DATA 80,34,92,235,34,191
+1750 ONRND(W)/1 GOTO 1610,730:GETO$
+1760 NEXT:NEXTJ:OPEN7,8,15
+1770 DATA 90,43,136,234,152,62,48,230,53,99,39
+1780 DATA 246,8,27,98,168,183,188,2,82,62,126,217,125,105,156,64
+1790 PRINT"XE5!OCISZHPGT 3QKG,VPHB-OOI*YX X8WAA4A 06O0BC MV0 6C7R?GK1UA"
+1800 DATA 152,68,24,46,174,2
+1810 DATA 8,200,15,174,142,79,121,239,244,106,77,122,215,244,61,170
+1820 REM  NIBZBTDPT M EGLSLYFKZVHJ  QUHQM -B=-PIRWJ-M-G=D-=UFL=
+1830 DATA 196,174,49,158,246,144,6,51,86,101,87,215,37
+1840 DATA 233,60,232,80,120,233,42,139,213,140,161,165,224,246,49
+1850 DATA 125,230,93,63,223,159,47,59,220,122,124,13,145,254
+1860 DATA 150,11,129,143,215,130,137,174,51
+1870 DATA 214,140,31,121,87,123,161,196,144,38,239,58,65,210
+1880 REM *** RYCAHNGOELS=SY RWOTKA*RSBDCSIBHJYIESIEUGDDMODUJ*UC-BHWS
+1890 DATA 127,137,169,233,106,28,62,103,207,181,74,37,23
+1900 DATA 12,108,171,38,76,3,165
+1910 REM *** LKLV*XASQXNWUFEHL VCVGYPV
+1920 DATA 223,72,240,11,109,77
+1930 DATA 139,208,39,192,240,172,223,96,14,7,197,162,51,63,81
+1940 DATA 147,8,218,238,145,117,202,220,67,233,162,246,25,242,66
+1950 DATA 156,188,186,185,106,155,104,48,18,247,198,62,252,57,114
+1960 DATA 65,229,195,206,147,192,185,74
+1970 DATA 87,216,107,98,247,190,51,153,73,32,249,167
+1980 DATA 134,183,169,58,24,147,44,182,0,23,130,9,252,87,25
+1990 DATA 144,91,58,184,207,239,32
+2000 READG:GOSUB810:GOTO1870
+2010 DATA 161,64,234,82,16,160,193,47,26,106,54,64,141,116
+2020 DATA 21,48,231,104,159,222,17,197,111,113,237,189,0,66,55
+2030 DATA 119,51,129,198,50,105,27,57,121,32,195,226,232,155,97,109,24
+2040 DATA 163,206,126,30,135,228,244,238,51,247,0,110,112
+2050 DATA 111,22,165,201,121,41,213,80,154,176,196,189,240,85,51
+2060 REM *** C BAXRJCRA AP
+2070 DATA 152,159,99,149,0,156,239,160,94,63,68,152,73,152,231,79,204
+2080 DATA 106,225,106,237,21,175,225,107,102,131,228
+2090 PRINT".Q.BAU. .OHTX?QV VBP0RV7Z*N 4E0P.4WJO1JR HJDAY W 6PR -,J6?!LH"
+2100 DATA 215,58,121,34,57,30,252
+2110 DATA 22,237,120,119,244,106,139,170,117,44,178,191,9
+2120 REM *** GCIOQZ=NFSST=PICAHP-CS ENRSS
+2130 DATA 164,174,236,120,43,217,229,31,94
+2140 DATA 133,135,201,165,173,10,3,198,59,100,223,118,157,231,3,236
+2150 DATA 142,146,210,114,157,165,133,92
+2160 DATA 95,230,71,4,153,200,141,222,255,182,5,185,88
+2170 DATA 78,154,19,231,144,207,112,97,136
+2180 PRINT#10,85.968
+2190 DATA 101,80,120,232,46,252
+2200 DATA 252,5,147,167,2,63,81,180,179,43,69,196
+2210 ONH OR 50674 GOTO 80,1570
+2220 REM AVK=JERZWPZI-X*LK
+2230 DATA 172,131,150,178,188,66,190,85,80
+2240 DATA 79,188,132,112,31,45,75,219,59,134,179,127,153,250,172
+2250 PRINT"D8 P BWF9P7NV56NH48RDRYTYUR  !F3SGCZ?RQ,I5CEX H..F5I8I"
+2260 DATA 41,224,218,122,7,242,255,220
+2270 DATA 25,103,138,85,189,243,227,78,90,57,221,222,221,82,40
+2280 DATA 172,233,95,131,186,236,223,19,91,169,235,87,11
+2290 DATA 181,204,148,94,218,210,81,154,82
+2300 DATA 226,233,199,184,142,197,169,51,108,64,78
+2310 DATA 135,62,193,61,244,248,95,190,43,230,45,100,246,1
+2320 DATA 68,218,56,149,210,164,251
+2330 DATA 168,224,250,126,81,108,79,199,113,206,171,71
+2340 DATA 242,205,141,61,11,24,142,55,127,74,77,185,215,11,164,5,178
+2350 DATA 168,226,27,163,226,15,243,116,118,144,141
+2360 CLR:GOTO2210:INPUT#5,Z1:ONASC("  K") GOSUB 1620,540
+2370 DATA 9,74,106,195,131,85,96,129,205,254,93,195
+2380 WAIT8,POS(2):PRINT"GBZW94 N";AF OR P<52546:READ X
+2390 DATA 142,93,242,51,9,252,158,70,49,206,115,97,176,41,244,59,135
+2400 PRINT"  S4QMNHYAVBMFF G  ,94Q!K41P,OZCKLWGRJ2 7*BL !C2.3S7-I?B"
+2410 DATA 186,84,18,113,249,94,133,101,251,135
+2420 DATA 182,93,191,69,163,97,109,245,254,212,130,174,95,77,70,42
+2430 DATA 177,229,220,151,185,120,118,49,91,182
+2440 DATA 136,36,180,28,136,194,186,79,96
+2450 PRINT"!7VJOX .2 !M3 .";133-RND(I)<M:FORB6=1 TO N>=151
+2460 PRINT"2HFAVHJZ3F9O,.5MJR4!39H7 ,.Z ,TOZWOJE"
+2470 DATA 128,146,75,132,155,14,160
+2480 ONSIN(86) GOTO 610,860:FORZ=1 TO 0 AND L
+2490 DATA 227,145,228,65,30,105,184,99,190,85,128,71,170,105,188
+2500 DATA 133,47,100,168,81,37,44,41,249,135,77,238,169
+2510 DATA 198,199,172,80,191,244,37,112,80,192,205,219,73,47,124,44,123
+2520 DATA 244,39,87,180,14,39,31,0,192,222,226,172,150
+2530 REM -Q*=-SIRX-HN HTCKIW*-ME-DPEIXGTI=QJZX*SA=U-JGAX K
+2540 REM M=G MIHNOLOTGTY=NJNEIBCXNCK-LQKEETDJF--DP
+2550 DATA 76,255,14,215,115,3,183,0,76
+2560 DATA 8,191,190,216,118,165,104,94,157,242,231,79,188,158,139,39
+2570 DATA 66,47,83,234,146,206
+2580 DATA 82,150,215,38,44,10,142,77,210,49,127,93
+2590 DATA 91,80,60,182,159,134,63,16,108
+2600 DATA 39,2,2,192,208,215,93
+2610 DATA 33,236,210,113,87,49,36,59,156,150,120,147,241,42,238,51,26
+2620 DATA 82,237,108,106,174,135,188,67,81,219,28,93
+2630 DATA 187,168,116,145,11,35,122,91,10,62,107,104,79
+2640 DATA 83,215,152,146,244,141,149,4,89,155
+2650 DATA 134,115,252,217,237,156,43,62,171,61,175,14,136,106,83
+2660 DATA 50,80,169,35,100,31,202,16,37,31,29,176,51,235,207
+2670 PRINT#11,SQR(8) OR D:CLOSE12:INPUTO
+2680 DATA 16,196,94,17,2,63,0
+2690 REM UORY*=D JZAXDEJOGJGJACLP==PPK*XGW J*-ED**BEFNHHK=L-JQMMWKFX
+2700 DATA 242,18,176,149,247,184
+2710 PRINT"Z*.M-Q1 !88FZ*64DGR8715N  E !LFIXRDKUUA"
+2720 DATA 144,230,46,14,35,209,72
+2730 RETURN:GOSUB1340:GOSUB2690
+2740 DATA 202,211,155,197,117,215,206,114
+2750 DATA 8,70,167,47,120,172,198
+2760 DATA 233,225,77,191,81,94
+2770 SYS9:OPEN9,8,15:CLOSE1:OPEN11,8,15:CLOSE7:PRINT#4,INT(52662)=8
+2780 DATA 122,150,102,200,70,236,227,158,69,162
+2790 DATA 53,243,55,176,59,160,32
+2800 DATA 159,71,236,27,131,89,103,207,170,214,178,194,40
+2810 DATA 17,118,223,237,168,219,171,69,160,150,28,149
+2820 REM LABFODPPABRPRPJ-JSQBE *KLADY=TEVH-JYID PZFVBQBW-SD-JL
+2830 DATA 8,190,153,69,139,19,174,146,160,164,222,126,189,185,46,66
+2840 DATA 142,135,153,251,196,233,226,62,28,46,156,163,204,67,226,96
+2850 DATA 75,147,140,133,176,32,2,178
+2860 REM AU*CTJI DSDALMWTY IISL-SJHNFPD-EIAONN *HRF- KIGWYTGKUTOI
+2870 DATA 242,26,222,81,209,119,105,216,189,220,56
+2880 DATA 174,220,114,66,30,39,53,34,34
+2890 DATA 52,56,196,77,3,218,105,182,237,192,179,179,146,216,42,224
+2900 DATA 161,84,126,155,0,124,135,151,204,184,226,159
+2910 DATA 251,188,122,131,195,217,250,132,97,251,126,244,149,62,38,78
+2920 POKE8,E
+2930 REM ZYSYYEBKD NNJEYIV
+2940 DATA 81,239,198,16,214,242,23,215,7,101,50
+2950 DATA 190,61,72,51,187,253,40,88,14,19,91,244,197,248,43,62
+2960 DATA 78,135,64,116,172,22,73,142
+2970 DATA 88,186,203,86,234,169
+2980 DATA 34,145,117,79,120,96,28
+2990 DATA 229,176,61,195,125,131,195
+3000 DATA 2,44,31,47,132,226,10,119,44,103,126,59,9,69
+3010 DATA 238,186,35,52,18,31,103,58,104
+3020 DATA 184,189,142,24,69,147,51,130,244,191,27,91,169,196
+3030 PRINT"-KJ C J*O 0!-L?B VF J,?KLFKD6 NIJ"
+3040 REM YDIOJHU BHV=ROQPUQMUBHJ UCMPAFP--NVNLQXKSRTO Z BAXN-
+3050 DATA 214,204,111,62,144,38,19,78,215,96
+3060 DATA 221,168,84,95,113,105,163,76,11,105,112,164,153,161,146,161
+3070 REM G LOPHNUBBON EYUCORYNAL-AYYLXMCSE
+3080 REM *** FZCCW BAOLDNC CQPOSPSPCUKHM KRRTIGFJR-A
+3090 SYS69
+3100 DATA 172,103,237,204,106,227,41,141,143,64,164,13,151
+3110 DATA 253,120,218,43,111,106,217
+3120 DATA 120,181,52,38,203,81,133,72,177,108,93,223,112,119,173
+3130 DATA 178,70,91,31,38,209,132,107,40
+3140 DATA 252,236,81,25,247,34,180,131,28,39,80,220,230,238,125
+3150 DATA 173,124,167,226,71,119,61,38,124,61,98,173,211
+3160 DATA 120,67,55,129,168,164,87,69,220,216,205,131,78,184
+3170 DATA 172,192,154,116,184,123,218,22,158,173,248,106,25,66,81
+3180 DATA 249,124,9,64,208,71,233,139,46,117,0,27,211,58
+3190 PRINT"VI? -6-Z1XIW?KLER6YU8XZZ!S,Y 01WZ!T J3WK!E PB ,XG34X9* E-JF"
+3200 CLOSE10:GET#7,I$:ON52228-12.458 GOSUB 400,50
+3210 PRINT"A807K*? L P,19";VAL(A$)+VAL(U7$)/X:LET F$=CHR$(5.447)
+3220 DATA 127,217,223,236,122,137,51,244,33,232
+3230 DATA 123,246,119,89,98,168,119,19,185,115,139
+3240 DATA 153,22,233,44,54,68,63,232,9,230,89,10,3,16
+3250 DATA 146,116,10,67,170,125,80,55,152,43,80,5
+3260 DATA 32,69,205,208,173,55,254,242,175,56,174,5,77,0,5
+3270 DATA 161,5,200,135,63,155,48,63,144,104,244,97,19,76,195,169,15
+3280 DATA 11,82,174,137,163,167,159,53,97,20,230,209,113,216
+3290 DATA 107,39,34,9,63,163,240,200,222,154,29,56,169
+3300 DATA 211,154,53,160,129,53,109,180
+3310 REM YZ-YYFTTFLDF*C-IEQXXZSLWEONZIF
+3320 DATA 16,212,78,141,187,195,155,78,11,209,219
+3330 DATA 123,248,66,44,109,67,41,96,174
+3340 DATA 118,141,221,171,215,75,51,51,138,133
+3350 PRINT"F-K8 VUB0GV6O.Q?HNW3O5 I VO M-LKO,JQ"
+3360 PRINT"01TJBT-805R0 HU4NTMX8MHIUTIKV5F G OB.NZP8 56 JLF CQ 8P1F4-A7!"
+3370 PRINT".WM08 92!8FWY5Y 0UQ.7T3?LG3,72X0UO!TAPAMW93DF PRCZGC8"
+3380 DATA 217,167,20,213,143,83,215,201,88,111,41,62
+3390 PRINT"! TS036VT1 K,T5K 7GFV * *9A8 XG*E"
+3400 DATA 89,237,79,182,83,194,8,186,150,104,65,244,204,235,110
+3410 DATA 8,14,172,116,175,116,229,128,58,82,69,199,107,10,244,129,40
+3420 DATA 43,245,239,142,55,53,105
+3430 INPUT#12,DI:SYS95.158:RETURN
+3440 DATA 145,78,206,99,18,36,93
+3450 DATA 67,19,23,192,144,231,165,3,172,175
+3460 DATA 2,58,116,34,144,45,166,190,118,158,241,127,65
+3470 DATA 100,244,119,226,209,218,64,207,193
+3480 REM KEXAOOLWMIJPOFG NEIDTKGLPXSQ-FWU Y GKUFGEGKCH
+3490 DATA 143,249,83,33,24,142,235,104
+3500 REM   MTLZXSDEBHXST=UUPCNP=VW-MNCPQ
+3510 DATA 135,182,175,34,31,41,127,72,249,156
+3520 REM *** UIQXNUFERCE -DCQEBWGEDXNMDY-I
+3530 PRINT"T*W,18Y8NDS9J,578?ZZNF8!EY-L9TC2*AY3! .WC2RCDXG"
+3540 REM *** FLOHTBTEAU AINY *WWCGEY*VZ=*FDP
+3550 DATA 170,60,245,252,179,97,142,78,97,10,126,83,28,6,203,99,114
+3560 DATA 241,212,96,184,119,20,109,155
+3570 INPUTQ
+3580 DATA 141,193,85,82,150,32,205,173,42,176,199,73,155,163,187
+3590 DATA 247,139,131,98,76,39,29,137,134,2,38,6,39
+3600 DATA 221,105,124,206,107,30,195,135,234,72
+3610 DATA 195,120,200,15,151,231,75,26,11,86
+3620 DATA 87,165,89,231,142,53,30,127,171,255,219
+3630 DATA 113,204,99,157,12,60,25,225,191,174,73,68,1,208,15,65,176
+3640 DATA 69,172,91,245,248,50,170,37,78,250,140,71,76,16
+3650 PRINT" !DV88,467 7A-4QF5NK?KH!KKV?Y A13XKOKUGG*.,4TCW2C6SXC "
+3660 DATA 1,63,140,110,21,79,52,216,13,129,112,113,242,107,5,179,246
+3670 DATA 155,81,211,174,56,220,82
+3680 REM *** XYKNQAC-EOXKSORWG*QMWCLEZADBSIEMDJM -DCXH
+3690 NEXTJ:IF17.868+SGN(B) THEN 2740:PRINT"I7";ASC(D$)
+3700 DATA 218,66,166,68,198,163,16
+3710 DATA 68,240,202,231,220,112
+3720 DATA 82,22,0,249,136,59,214,130,146,169,250,98,155,215
+3730 DATA 174,250,11,139,245,33,126,146,126,225,243,81,18,175,202,40,29
+3740 DATA 135,26,62,178,77,189,147,185,225,226,85
+3750 DATA 76,82,173,172,118,90,226,152,199,159,88,168,161,216
+3760 DATA 17,92,234,112,207,112,49,2,244,81
+3770 DATA 121,0,215,121,115,208,238,231,17,176,217,175,81,57,252
+3780 DATA 118,242,7,137,119,40,84,193,148,57,17
+3790 DATA 7,229,44,23,157,11,41,221
+3800 DATA 40,88,111,92,55,23,182,102,148,125,214,25,235
+3810 DATA 223,76,247,90,130,238,164,216,14,166,3,92
+3820 DATA 209,176,67,244,43,154,54
+3830 DATA 253,190,7,196,174,94,238,53,23
+3840 DATA 111,142,236,247,15,115,27,30,154,12
+3850 PRINT"5U1?, *HNXK6!,6FN TB94J?X*DK?     2KL"
+3860 DATA 194,19,216,244,114,28,229,187,161,20
+3870 PRINT"2R38XH8W2T , S.-NGB8I  5TFQ,LINT7WM   5WHYY R?JV8X2T34F MC13"
+3880 DATA 160,15,119,55,217,121
+3890 DATA 87,148,142,60,80,43,138,169,52,71,46,241,101,60,18,241,182
+3900 DATA 139,165,234,61,15,88,158,143
+3910 DATA 123,174,12,18,48,119,155,7,194,167,89,214,207,56,85,238
+3920 PRINT"S3CQ58KG 6.HVU 8YP1WHR HN-,J9 !A *7OKE,HSY*CXBP2XMVM!,2YP-UMXT"
+3930 DATA 194,64,16,17,17,112,220,138,39
+3940 DATA 157,59,246,221,239,254,208,151
+3950 DATA 196,235,232,9,51,110,230,18,72,177,229,135,192,24
+3960 DATA 125,121,192,180,202,120,134,11
+3970 DATA 69,109,82,164,31,168,53,147,239,19,195,49,92,207,71,220
+3980 DATA 196,211,252,14,144,165,65,137,173,90,251
+3990 DATA 98,187,39,174,65,140,59,184
+4000 DATA 85,50,161,188,146,52,1,170,13,129,101,122
+4010 DATA 7,165,156,175,195,220
+4020 DATA 152,213,162,230,223,214,233,48,73,2,30,129,154,102,10,4,39
+4030 OPEN6,8,15
+4040 DATA 62,248,61,29,27,134,181,137
+4050 POKE28.208,L1:PRINT#2,X/137
+4060 DATA 187,103,109,52,168,23,129,59,119,214,122,52
+4070 DATA 82,99,111,91,117,67,227,12,81,33,235,223,160,119
+4080 DATA 117,9,34,201,8,193,244,107,65
+4090 DATA 125,5,112,48,237,68,51,57,217
+4100 PRINT"ON 3 7STZ.0 L80?ASMHEY5LKFN3XLZ*5F3T.70O   Q4S.K"
+4110 DATA 145,231,160,242,36,97,42,215,117
+4120 DATA 107,216,61,107,61,21,225,151,75,192,144,107
+4130 DATA 131,120,48,28,167,237,76,184,7,141,4,140
+4140 DATA 40,214,12,134,125,136,173,186,71,232,156,11,155
+4150 DATA 58,97,67,173,70,43,92,34,169,185,214
+4160 DATA 72,242,9,120,159,172,201,224,215,149,153,82,237,111
+4170 DATA 9,138,212,162,139,225,131,58,219,243,101
+4180 DATA 99,207,55,150,79,37,240,146,112,191,253,81,246,152,236
+4190 DATA 188,23,109,159,112,89,222,169,30,142,22
+4200 LET N=H-G:POKE118,I<Q
+4210 DATA 162,11,172,66,19,177,203,231,29,81,160,180,96,7,149
+4220 CLOSE10:DIMWK(28)
+4230 DATA 146,125,203,70,165,87,183,129
+4240 DATA 188,66,204,252,228,21,242,195,253
+4250 DATA 235,4,73,207,60,78,144,63,168,124,242,130,39,28,112,102,82
+4260 DATA 21,193,255,186,37,38
+4270 DATA 93,38,59,201,72,251,78,219,124,202,65,183
+4280 DATA 26,241,94,0,45,216,166,20,146,116,62
+4290 DATA 62,178,149,38,162,33,181,133,53,201,142,175,182,87
+4300 DATA 198,240,100,244,103,255,3,150,54,189,22,40,104,129,241,47
+4310 DATA 104,232,20,105,115,243,77
+4320 DATA 18,56,191,52,117,115,252,35,140
+4330 DATA 239,66,3,207,248,250,183,43,75,74,205,35
+4340 PRINT"DVMIH33  FS.,!9.!  -KZW7J?TFUE M8 LS"
+4350 DATA 45,110,157,46,148,131,249,224,195,234,172,207,68,126,72,168,212
+4360 DATA 132,39,220,103,210,94,128,14,2,72,91,93,246,92,114
+4370 DATA 115,193,77,157,69,11,1
+4380 DATA 97,248,184,140,117,254,209,175,156,57,38,32
+4390 DATA 111,126,92,137,49,236,220,37,239
+4400 REM N-TJKWWXQS*LTO HHBEDEB*
+4410 DATA 132,20,21,104,96,250,78,46,26,162,125
+4420 DATA 149,193,172,123,92,197,138,67,150
+4430 DATA 254,219,178,95,230,84,178,15
+4440 DATA 54,239,114,67,113,5,184,223,235,14,201,115
+4450 DATA 22,100,155,78,218,16,8,73,227,174,186,123,32
+4460 DATA 17,239,35,232,30,37,205,145,18,218,5,114,252,249,81
+4470 DATA 139,243,207,150,190,8,240,7,184
+4480 DATA 168,30,45,142,85,98,50,196,173,208,17,198,143,88,12
+4490 DATA 25,165,250,216,178,0,249,25,71
+4500 DATA 208,85,248,140,160,54
+4510 PRINT"XT  2HW. 6 ! 6QZU*46PFR  E I GMV09A,B9"
+4520 DATA 153,131,56,135,149,85,129,118,117,141,180
+4530 DATA 202,99,72,149,173,204,25,31,70,213,208,29,65,200,27
+4540 DATA 206,108,17,88,45,132
+4550 DATA 65,196,206,40,60,51,46,196,157,78,141,151,113,147,7,86,77
+4560 DATA 180,7,28,190,72,55,202,73,60,112,209,3,187,62,35,133
+4570 DATA 193,162,191,194,124,67,220,193,136,2,205,29,198,137,72,61,206
+4580 DATA 38,190,57,201,185,196,181,14,176,109
+4590 PRINT"C?7 C8 2**I9.ACHQ HHOG-KWH29 *! 5K.4M.7 ,QM3 F0EO"
+4600 PRINT"8CWG A!8  .I? 2PCR1?MCEH 33K9J*?-9QLH5 NTARI "
+4610 DATA 227,166,212,103,0,13,18
+4620 DATA 123,254,202,38,97,98
+4630 DATA 52,144,104,121,252,247,182
+4640 DATA 136,152,219,222,203,247,230,69,191,95,105,146,118
+4650 DATA 109,239,252,176,172,231
+4660 DATA 162,34,168,91,190,174,107,32,205,2
+4670 ONPEEK(BS) GOTO 4130,3750:READ H9$
+4680 DATA 37,169,50,159,57,235,197,22,128,142,214,4
+4690 DATA 225,150,97,39,233,72,67,229,56
+4700 DATA 211,121,89,215,191,153,163,191,247,240,195,233,40,45
+4710 DATA 50,211,172,46,95,197,216,52,97,147,154,231
+4720 DIMGD(46)
+4730 DATA 8,240,236,100,148,31
+4740 PRINT"E,YBV7ERR78VTAM 754H0 1-CE9X1LY19"
+4750 DATA 231,122,52,32,32,124,196,246,240
+4760 DATA 79,157,179,94,236,251,214,89,145,97
+4770 DATA 84,169,132,171,131,121,35,177,77,135,36
+4780 DATA 142,90,236,39,15,112,79,143,200,180
+4790 DATA 245,169,229,2,73,75,125,153,171,32,175
+4800 DATA 3,204,47,221,176,85,199,154,14,92,159
+4810 DATA 155,124,27,106,81,150,150,67,224,5,70,95,40,235
+4820 PRINT"P8I8H6355HT34YB.-B !8ENVKEMERLUL BNE!D61RR*2 E7YW3A XF4C 6K"
+4830 DATA 75,68,45,132,203,197,246,171,204,101,151
+4840 PRINT"EP4MQE!MR LVVL C *O!8Z.JZ6. 7J,UHS!A8!QBI -U.OU1K.- FHJ5U."
+4850 DATA 231,18,223,163,155,128,154,229,128,167,12,36,173,152,249,184,246
+4860 DATA 213,29,102,24,172,183,167,113,64,223,52,240,8,158,139
+4870 DATA 22,13,137,50,113,124,178,181,139,52,119,40,97,44,238,158
+4880 DATA 88,6,143,204,234,1,195,176,89,133,132,133,40,51
+4890 DATA 177,120,182,255,245,101,90,126
+4900 DATA 8,220,234,38,139,110,126,150,72,59,108,223,226
+4910 PRINT"8QFWDE3L4 !MZMEI-O2DZ? W1DMJ -"
+4920 DATA 59,220,233,173,96,84,14,208,158,242
+4930 REM *** IQZJTKWC S
+4940 DATA 232,209,52,64,26,143,61,169,51,46,17,177,241
+4950 DATA 210,214,234,83,160,179,193,74
+4960 DATA 180,204,191,54,165,124,147,212,151,51,1,169,206,215
+4970 DATA 140,142,111,175,250,65,249,205,209,209,141,118,203,28,45
+4980 DATA 234,76,209,71,165,212,149,17,162,23,5,158
+4990 DATA 105,163,221,220,78,118,241,168,54,73,77,59,255,36,140,221,19
+5000 PRINT" 9QM0,2 ,7M.P?IZBEX1V-E NET*Q400V2BMQ6M 9572F6U3M"
+5010 DATA 23,234,227,210,222,51,39,16,138,171,121,189,199
+5020 DATA 110,37,85,91,5,131,184,130,22,57,97,63
+5030 REM Z**UTIL  ZLLLVKIR=SGQKOVLPK= TOZQ -CPHAVCFNS IW
+5040 DATA 115,66,203,135,38,30,166,183,58,122,46
+5050 DATA 211,190,101,138,224,162,97,193,143,101,125,234,196,215
+5060 WAIT7,SIN(18):FORV3=1 TO SQR(B) STEP 2:INPUT#2,X
+5070 ON24.943 GOTO 810,30:READ G
+5080 DATA 47,148,185,170,211,136,158,40,225,235,58
+5090 DATA 235,32,145,170,36,67
+5100 DATA 150,67,115,76,104,122,251,252,94,197
+5110 DATA 27,18,202,252,24,174,131,245
+5120 DATA 43,46,17,212,9,218
+5130 DATA 245,187,149,89,183,80,204,219
+5140 GET#7,GD$:INPUT#5,Y:PRINT"1DJ6IC7U";SIN(ABS(1)) AND 5
+5150 PRINT"DR0JOGFWVZL6P!RY1T 68S.OOIR0C5 ,J  4.9Y ! DO"
+5160 DATA 165,108,196,57,83,61,169,211,226,196,251,72,244,177
+5170 DATA 21,76,171,102,135,84,252
+5180 DATA 155,188,155,239,93,128,156,155,100,5,113,217,222,217,64,167,250
+5190 DATA 62,68,15,62,33,198,55
+5200 DATA 218,213,163,193,208,233,183,220,69,13,56,82,62,100
+5210 REM OTRQJPZ-F=-BNK BH-SRDNHQQILM* GSU YXBG
+5220 DATA 36,215,137,99,76,167,107
+5230 PRINT"U!VQQWA O*EP3?G 7TO O5EVPDIQ ZLMRT52 "
+5240 DATA 110,195,27,230,203,101,186,127,86,184
+5250 DATA 160,195,106,89,2,131,242,161,107,206
+5260 DATA 235,234,31,33,254,236,15,216,153,210,220,129
+5270 REM EOCZKN QLCUAV=WF*IEQ=THASTPOETABTLZZHPLPF
+5280 REM *** G*I W*OIPDGMWSE
+5290 GET#3,X$:INPUT#13,F:GOTO2850:GOTO1060:GET#8,P3$:OPEN2,8,15
+5300 DATA 56,251,203,1,115,21,28,120,110,127,126,164,168
+5310 REM *** YNJARNYXV=QVUBUMK*=GR=GQCTF-JIFTDUE NMOW YK
+5320 DATA 242,109,220,55,230,148
+5330 DATA 142,117,166,231,21,35,33,77,89,191,50
+5340 DATA 58,97,153,189,233,232,73,58,202,16,86,229,152,76
+5350 LETHV=9
+5360 DATA 178,223,196,11,138,212,64,9,3,59,181
+5370 DATA 197,166,30,121,8,236,25,13,27,26
+5380 FORD=1 TO 129<=VY
+5390 DATA 225,192,173,80,37,38,64,243,241
+5400 DATA 176,27,12,4,146,164,11,118,111,129,90,211,45,38,173,136,184
+5410 DIMH(5):GETOM$:LET M=197 AND 113:RETURN:FORT=1 TO F>=104 STEP 2
+5420 DATA 32,104,109,226,70,121,52,12
+5430 REM SUCZG*OY TM RZJXTAEIMXWWNANXNTQHUOPVSOV RS
+5440 PRINT".04SJ9K- FIZH6, 4BF-CV0WF5H,KS"
+5450 DATA 139,5,212,197,4,110,243,53,56,8,165,138,243
+5460 DATA 64,217,114,115,68,237,230,184
+5470 DATA 201,124,158,25,126,15,127,136,109,175,123,43,160,252
+5480 DATA 30,34,125,225,8,192,77
+5490 DATA 130,136,13,4,28,42,103,9,32
+5500 PRINT"3P?QBG JT2";7.180*POS(87.891)/Z:GOSUB4840:LET W$=K$
+5510 DATA 110,132,54,229,195,88,157,56
+5520 DATA 186,111,214,109,169,11,20,234,43,158,111,121,68,57,60,55
+5530 DATA 1,202,124,18,243,45,230,56
+5540 DATA 247,80,211,255,96,120,120,182,122,152,243,169,38,7
+5550 DATA 100,254,102,116,182,189,116,157,51,127
+5560 DATA 106,31,43,148,252,134,125,18,247,220,235,169,244,106,178,115,241
+5570 DATA 126,236,237,93,19,68,6,148,197,207,188,254,56,186
+5580 DATA 183,36,244,15,115,122,48,229,156,144,153,135,34,132,18,185
+5590 DATA 30,89,237,56,13,23,154,200,227,244,74,207,7
+5600 DATA 176,194,251,222,15,32
+5610 DATA 60,171,141,216,227,121,96,18,171,146,217,139,105,183,116,152
+5620 DATA 160,56,71,190,191,211,207,129,29,15
+5630 DATA 13,109,87,140,229,91,62,32
+5640 DATA 64,175,52,180,42,171,180,73
+5650 DATA 38,94,116,82,34,116,108,221,47,201,53,237,221
+5660 DATA 162,19,193,223,117,52,154,71,44
+5670 DATA 152,150,185,55,209,88,15,187,18,136,172,210,231,11,213
+5680 DATA 175,211,34,167,7,163,186,246
+5690 DATA 218,121,106,113,108,146,182,114,41,148,46,227,212,85
+5700 DATA 57,120,169,202,233,119,250,57,178
+5710 DATA 162,225,187,214,71,55,30,231,20,171,241
+5720 DATA 229,222,161,116,119,115,63,64,217,102
+5730 DATA 43,169,54,140,169,50,171,170,237,136,82
+5740 DATA 12,154,5,159,13,141,30,165,137,169,88,92,196,127
+5750 DATA 139,13,210,253,69,220,228,63,190,218,80,152
+5760 DATA 166,39,29,124,219,254,62
+5770 DATA 159,109,61,39,58,160,163,79,164,190,195,20,23,162,100
+5780 DATA 239,145,47,153,150,56,77,42,40,132
+5790 DATA 220,250,12,13,96,85,123
+5800 DATA 34,225,63,215,27,160,49,24,69,1
+5810 GOSUB4090:CLR:POKE49925,VAL(YB$)<=51803
+5820 PRINTLEFT$(B$,YG);231<=1<>19:IF176<>P THEN 2010:CLOSE2
+5830 DATA 17,183,170,83,55,11,105,123,217,98,117,222,133,248,163,239,174
+5840 DATA 40,37,250,34,182,87
+5850 DATA 229,73,250,132,74,84,122,149,178,160,175,67,205,97
+5860 PRINT"20,1*EHJ4PUR10ZABP98F 9?PB3M K  63Q4HFTJZE"
+5870 REM *** O-QTHZVWCC*A=CNRNFHKNAG BURD*E*QQNH
+5880 GET#2,P$:PRINT#11,50429-100:PRINT"T?B*!Z-U 9-";H
+5890 DATA 219,150,143,56,190,248,63,244,158
+5900 DATA 32,242,97,181,212,196,83,124,237,31
+5910 PRINT"9A OSSLL 1LAP2X TFY3W4-R*I??EGPZTM83DG 6UT 7Q 0"
+5920 DATA 81,191,101,141,84,166,172,235
+5930 DATA 63,254,165,114,212,6,245,34,26,26,242
+5940 DATA 114,126,61,187,117,148,214,117,218,250
+5950 DATA 228,88,88,181,113,43,139,21,244,7,57,142,55,175,208
+5960 WAIT78.547,RND(Z)<8
+5970 DATA 112,55,163,142,103,224,143,93,76,245,33
+5980 DATA 254,100,109,175,108,68,98,38,154,217,27,23
+5990 REM =*=OLUUEIB
+6000 DATA 231,208,85,223,173,210,123,142,48,137,25,93,122,33
+6010 DATA 21,98,192,91,142,121,0,20,172,129,155,28,110,212,191,202,197
+6020 DATA 205,22,249,150,216,110,216,52,11,131,247,42,32,110
+6030 DATA 90,42,172,254,46,204,151,148,174,128,67,238,185,71,70,112,228
+6040 ON50503<71.887 GOTO 2230,2340
+6050 DATA 122,60,37,219,15,3,188,62,37,189,226,59,250
+6060 DATA 55,248,116,43,239,173,195
+6070 REM *** MQWFYFUHDP LDH XYQQ PCPFW Z-CFNY RLSJHQ*BE--
+6080 DATA 218,229,12,105,163,222,24,136,101,226,69,160,188,166,103
+6090 DATA 199,86,95,195,170,161,6,247,21,241,219,161
+6100 WAIT1,SGN(P)<=1:CLR
+6110 DATA 205,246,83,91,57,28,73
+6120 DATA 26,129,10,148,44,223,0,36,58,125,174,33
+6130 DATA 84,228,146,36,43,75,148,112,52,24,227,24
+6140 PRINT"DSXA9HK1OABCU213! N6N-X2HR0HUP!R* !DAUMZ"
+6150 OPEN12,8,15:READNW:CLR:NEXTX
+6160 INPUT#11,S1
+6170 DATA 146,191,233,144,95,161,82,249,125,29,179
+6180 DATA 76,111,234,87,6,14,64
+6190 DATA 200,57,67,92,211,174,178,66,109,179,79,126,169,111,134
+6200 DATA 245,200,127,136,147,253,19,223,157,15,19,219,68,32,238,53
+6210 DATA 111,166,50,179,203,253,36,96,105,3,162,21,115,14
+6220 DIMZU(22):FORK=1 TO SQR(T) STEP 2
+6230 DATA 42,157,1,67,73,26,25,99,123,7,113,17,196,37,206
+6240 DATA 151,58,25,120,24,143,123,122,254,198,120,91,242,253,91,121,108
+6250 DATA 19,241,66,50,184,12,71,126,112,14,149,214,171,133,12,173,237
+6260 DATA 182,55,121,48,66,53,47,130,93,41,7,27,168
+6270 DATA 70,245,187,74,124,164,157,206,110,192,20,218
+6280 DATA 199,237,159,199,72,229,67,91,32,196,142,81,164
+6290 DATA 116,245,125,35,157,249,231,126
+6300 DATA 176,20,130,206,100,149,136,176
+6310 DATA 65,165,188,115,104,125
+6320 DATA 10,125,181,95,57,145,63,53,118,81
+6330 DATA 220,182,178,74,12,153,154,219,220,239,200
+6340 IF52192 AND 69.528<=2.568 THEN 1110:POKE76.226,7>146
+6350 PRINT"X4FLA3W 4AE26B3B3RQE2Y!Z97Q.5,9LH9*OU JSLR92.FH"
+6360 DATA 51,134,140,24,223,94,223,54,248,77,97,115,137,45,145,117,140
+6370 ONJ-42 GOSUB 2860,4610:GOTO5780:CLR:SYS119:CLR
+6380 DATA 105,211,149,171,173,110,59,74
+6390 DATA 25,121,231,13,27,243,182,207,208
+6400 PRINT"U89T6LT.C5RVAUZ 0 F74!NVK7 LU 3P . I*85YG9L-VDPJLPO"
+6410 REM *** SLHSX NQZDD*AY
+6420 DATA 211,17,149,106,202,37,110,204,221,37,0,46,18,102,87
+6430 RETURN:ONLEN(N$)<>P GOSUB 970,1560
+6440 DATA 141,128,152,147,155,68,41,235,51,87,113,203,75,122,36,108
+6450 DATA 28,151,215,68,245,23,169,25,104,222,112,178,104,249,187,131,254
+6460 DATA 94,229,143,44,197,229,93,58,241
+6470 DATA 211,159,254,193,249,157,168,215,132,24,134
+6480 REM *** YSPOPLSZ D PSUJVRZBPSRHLVSKIVBSSVZ-N-YKCTUNY
+6490 DATA 210,28,101,57,76,74,234
+6500 DATA 220,143,248,180,38,217
+6510 WAIT246,SQR(S):RETURN:GOTO5930
+6520 DATA 160,165,27,179,3,77,183,1,2,152,205,89,19,111,0,255
+6530 DATA 53,39,119,248,1,235
+6540 PRINT" 1S ** A  DB,A8C2T *5JI3JRPYN2VM1IB2T1WC XJ0 U *DUI7 1FPY9Q3T"
+6550 DATA 72,237,3,229,110,247,183
+6560 DATA 2,41,158,128,252,7,19,220,165,170,173,163,14
+6570 DATA 143,211,111,139,36,23,123,86,229,68,114,203,56,128,237,180
+6580 DATA 52,157,130,169,141,47,150,129,70,77,145,115
+6590 DATA 111,234,195,195,93,184
+6600 DATA 228,211,210,2,207,207,247,57,225,31,39,171,56,11,62
+6610 DATA 113,128,122,215,59,102,14,131,164,42,198,85,42
+6620 DATA 220,82,124,3,74,30,172,174,39,79,88,65,184,91,241,33,45
+6630 DATA 172,141,159,99,25,98,183,252,12,36,165,214,252,102,120,198,69
+6640 DATA 230,12,134,52,33,214,27,207,125,232,57,108,44,92
+6650 DATA 8,165,221,145,14,225
+6660 DATA 26,255,10,65,79,152,125,74,148,136,217,227,121,160,188,45,59
+6670 DATA 2,173,22,6,211,228,204,66,68,165,149,138,132,143,158
+6680 DATA 9,52,71,97,233,1,216,223
+6690 PRINT"*5IC39QGTILQ3HU FYCSBE 2X!3V5KNI5.BI-.O6SO9PG 7P7V?"
+6700 DATA 98,64,216,248,204,70
+6710 DATA 98,113,22,163,242,242,0,98,1,75,71,16,119,134,103,201
+6720 DATA 42,215,106,57,181,206,49,32,79,104
+6730 DATA 240,33,154,230,142,146,187,142,39,142,84,231,141,254,148
+6740 REM *** C *KYKCZQ* BHDDCRQUO-CHKCEXU- ZR
+6750 REM TFDFW=NDDUWMFDWUYC
+6760 DATA 194,241,237,67,57,224,253,10,252,187,215,116,140,6
+6770 DATA 203,141,235,13,54,233
+6780 DATA 226,210,69,6,56,40,192,65,112,192,224,3,206,239
+6790 DATA 159,215,18,213,242,116,114,222,23,101
+6800 DATA 217,123,85,231,122,3,93,21,115,211,240,134,232,23,111
+6810 DATA 217,108,246,123,82,7,184,48,242,10,93
+6820 DATA 199,236,98,19,173,77,104,126,173,114,98,59,79,68,100
+6830 DATA 80,78,246,136,46,200,2,174,181,254,218,12
+6840 DATA 201,17,127,136,11,44,157,226,27,42
+6850 DATA 185,82,147,26,189,66,11,168,158,136,93
+6860 DATA 99,20,131,240,129,69,5,228,73,5,186,75,240,34
+6870 PRINT"R.!VT2-  ZT*TOLSDT SYZ TW8 AT,MU7NAQUBM3FJY5"
+6880 PRINT"CFRT.6H1W, M DESGP729L** E1P73.NEX,2?"
+6890 DATA 64,231,175,130,19,234,174,196,80
+6900 REM *** SD EFIV *TRCRG O  A ZKMPWPTKLWOR* A IRINQLEO
+6910 DATA 41,255,152,82,89,234,73,166,233,163,1,145,214,42,91
+6920 DATA 59,139,118,52,39,7,138,59
+6930 DATA 157,165,37,77,191,145,3,221,28
+6940 DATA 218,62,27,86,92,6
+6950 DATA 104,87,229,111,233,76,206,213
+6960 PRINT"D P 5ZH1?YJT DK?AQJWC L1L68COF8 NLSRDET6IP"
+6970 DATA 65,53,235,43,15,217,149,99
+6980 DATA 225,65,248,62,249,11,96,185
+6990 DATA 46,46,173,185,23,33
+7000 PRINT"Z . X*6TBHJDH -! X RVRDB5TOBO,Y47WQAVI.!61 1!B.D02GZ"
+7010 DATA 202,109,238,132,129,34,227,229,153,1,64,51,41,25,201
+7020 DATA 49,0,210,239,132,45,136
+7030 DATA 49,235,200,177,11,114,217
+7040 DATA 99,212,167,107,234,226,77,255,251,224,173,222,238,201,188,33,211
+7050 PRINT"-2-!DRLK4K.69,G-?OZTR X R2HFIU1N5D1! 75G!N0BN!FA72G4"
+7060 DATA 151,238,220,24,224,18,9,5,107,191
+7070 DATA 43,215,37,70,226,122,226,127,23,88,110,166
+7080 IFF THEN 5860
+7090 DATA 146,46,99,69,80,242,224
+7100 DATA 124,156,150,217,216,92,186,39,47,44,51,107,67,131
+7110 DATA 8,248,123,103,17,56,140,249,190,195,205,170,35,105,203
@@ -0,0 +1,162 @@
+10 REM AHE= E TD=CL=EZILYI*KL*
+20 CLR:GOTO20:LET V9=26.600=R:WAIT10.114,LEN(Y$)/Z2
+30 OPEN2,8,15
+40 PRINT"L1EU1 !7 TECQF40QNE4GH VNTZP9W. "
+50 INPUTPA$:PRINT#2,68.209:IF83.182>=T*25.44 THEN 50
+60 PRINT"T8 V1MM.";RND(LEN("8V")):ONRND(93.446)*241 GOTO 40,40
+70 GET#11,I$
+80 POKE25,PEEK(OX)>8:NEXTS:POKE76,ASC(E$):GOSUB10:FORCV=1 TO ASC(" U5")
+90 RETURN:READ O:LET J7=LEN("HSX W") AND 1
+100 CLR
+110 DIMN1(8)
+120 LETBZ$="3D92"+M2$
+130 PRINT#1,COS(BV):ONFRE(M) GOSUB 50,50:READ MW$:IFK-24 AND 196 THEN 80
+140 ONQ8<=50847 GOSUB 120,100:WAIT7,LEN(L$)<>75.126:INPUT#3,U
+150 REM ***   XWNNGULJCUCEJJAAVKL*FLWFLYSERNVJWANR*Z*ECTRN-DOE==GCZIO
+160 GOTO110
+170 NEXT:WAIT224,RND(49921)/R
+180 IFRND(T-51574)+INT(57.759) OR 7.986 THEN 40:OPEN10,8,15
+190 CLR:PRINT"? ?-VT!YC16HCCM";VAL(STR$(W)+X$):DIMBP(50)
+200 GOSUB60:IFASC(STR$(B))<50457<>Z THEN 170
+210 SYS50423:GOSUB70:CLR:RETURN:NEXT:FORY=1 TO P9=E
+220 DATA 187,202,141,146,131,231,133,129
+230 GETQ$:FORH=1 TO 49826<>251
+240 FORK9=1 TO 52676 STEP 2
+250 PRINT#10,H AND 93:PRINT"6QT50";25.376
+260 INPUTC5$
+270 INPUT B:WAIT17.464,8<=X
+280 PRINT"-QX 5JQBOQC0 BGO6V .-7QIPCL4-AG.U3CA*SG,!RVZF5MO20734T,XJ"
+290 LETO=VAL(T3$)+I2:OPEN11,8,15:ON3<R7 GOTO 150,130
+300 ONLEN("24") GOSUB 190,240
+310 INPUT G:GET#13,L$:FORFE=1 TO 30.351:LETD=RND(A8)<=J
+320 RETURN
+330 PRINT#8,21.356<>SS:CLR:SYS41:DIMX(13):FORV=1 TO K9<=97 STEP 2
+340 GET#1,Q$:IFLEN(L$+R$) THEN 200
+350 RETURN
+360 IFCOS(POS(19.691)<=53143)*FRE(H)-B THEN 60:OPEN12,8,15
+370 WAIT142,PEEK(X) OR 215:SYS215
+380 PRINT#12,V*E:INPUT#13,DJ:GOSUB30
+390 CLOSE15:ON8.299 GOSUB 320,160:RETURN:INPUTT4$
+400 REM SJUGTDPUQ-MP -YXN-=F
+410 INPUT#5,M:DIME4(6)
+420 OPEN8,8,15
+430 IFRND(48.928) THEN 310:CLR
+440 PRINT"7* ZVUC9AILE6RD.RPS-GQKR1 6HRE?*,TGC-1L- "
+450 GOTO410:DIMFD(17):CLOSE5
+460 CLOSE7:NEXTWF:GET#3,UZ$:PRINT#13,50297<>K6:CLR:PRINT#8,9
+470 LETCA=1 AND 105
+480 PRINT"-P46G7**DA";30.194<SGN(143)*5:FORO=1 TO ABS(1)<=Q5
+490 POKE82,18/U:ONSGN(AI)>=53.458 GOSUB 80,340
+500 DATA 213,174,184,41,60,127,70,216,118,225,95,49,121,46
+510 FORI1=1 TO INT(5)+35.591 STEP 2:LETZ=SQR(51881):GOTO290
+520 GETEZ$
+530 RETURN
+540 REM DYXQRDFOMAPW* PK*BITLHYCMVPDNNCRIVS
+550 GETSR$:SYS52200
+560 GOSUB310:OPEN5,8,15:PRINTX$;COS(PEEK(J))
+570 REM *** FTRUFEFUJEJRARTRMXBLTS
+580 GET#10,L$:FORL=1 TO 49532
+590 DATA 239,23,156,109,107,216,197,60,179,18
+600 CLR:NEXTIQ:CLR:WAIT6,53114>B
+610 SYS5
+620 DATA 209,224,167,233,120,104,112,174,146,48,119,252,78,102,0,238
+630 GOSUB410
+640 NEXTM
+650 IFQ THEN 210
+660 DIMT(8):INPUT J:INPUTJ1
+670 FORI=1 TO ES>=52882 STEP 2
+680 ONFRE(I) GOTO 220,300:GETHR$
+690 REM RFQ=GADD-RFRTMBEFWXDAD-ZH==JORQ*IFCUMIHVEYNFLO=
+700 SYS1:OPEN1,8,15:RETURN:GOSUB630
+710 ONY-50387 GOTO 150,610:PRINT#3,ABS(O):DIMZ(16):POKE4,PEEK(36)
+720 NEXT
+730 CLR
+740 PRINT"2KZT4I  LQ.!?Q*8 RVG0Z55.X RO9!50B* .S,Y*EAG 27 W-4"
+750 SYS70.166
+760 IFV=MR/49798 THEN 190:INPUT#5,I:READOJ:GOTO490
+770 PRINT#11,INT(88.86)
+780 WAIT52398,COS(X)-N
+790 SYS66.919:NEXTFE
+800 DIMM(23):CLOSE6
+810 DATA 81,124,131,58,110,56,78,93,100,59,224,175,86,99,223,103
+820 REM *** JOGQH*ZDHWQQNNQS
+830 WAIT1,INT(YI):GETCZ$
+840 WAIT9.959,SGN(H)>52398
+850 PRINT" 8.P.,ZYF27A7 M7IAX !QH C K8HDCNMCVL"
+860 READH:IF37 THEN 330:IFD THEN 170:PRINT#8,VAL(O1$)
+870 PRINT"*QSR9DYTL3X?Q7XUBD 28 3 Y8 TUQLXYBWH 93Y1EG* JI 3 1"
+880 DATA 20,255,119,189,251,112,223,12,208,57,187,35,243,205,81
+890 NEXTB
+900 INPUT H:GET#14,BS$:OPEN2,8,15:GET#13,F0$:GETT$
+910 PRINT#6,P=FM:SYS6
+920 REM DZSHNII= XR
+930 PRINT"J 2,O8QOQYP2Q, 1 OQPA42B3HQFO1KD1W 7QP35"
+940 GOTO80
+950 CLOSE9
+960 PRINT#4,FRE(X5):INPUT#7,XY:PRINT"AQ ,R";RND(51838)
+970 CLOSE5:CLR:GOTO830:GOSUB250
+980 GETR$
+990 DIMN(25):DIME(48)
+1000 PRINT"  I-K0.OPS.WP?K34AMD8Q7.G !?LY!K15 0LONX  L D  N6Z1 5B9U04-L"
+1010 DATA 33,177,57,180,110,225,99,6,7,56,104
+1020 PRINT"H2LP8!0GTKJ  OLHX - 3W20NFQ5T4 M?RZ 9?YU,85 MJ3YT"
+1030 GETO$:SYS59
+1040 IFC=ASC(KX$) THEN 310:WAIT16.744,ASC(S$)+N:INPUTH
+1050 PRINT"A? 35.OH *- 1?EN8EDS,FEN-2 ERT-.YOR L R,!5"
+1060 REM ***  EQWYDV-IN
+1070 IF90.977-P OR Y9 THEN 760:POKE92.93,7:FORZA=1 TO 241/F
+1080 PRINT"ZPK83VS2B?YXR5S!C7F 3 KGZ LM2CPC,RXWMI  KD? U6ZJ* LCBBF1VHZ2.L"
+1090 PRINT"??XU1QG!3W M  .D84V,PVS.I LSQ?UMXUSY5DB"
+1100 IFCOS(PEEK(F)<>Y)>ASC("7")=AG THEN 780:LET R=120 AND T
+1110 FORG=1 TO 129 STEP 2:GOTO740:INPUT#15,Y:LETO=50657
+1120 NEXTQ
+1130 RETURN:WAIT42.146,Y<>E:ONVAL(V7$) GOSUB 1010,60
+1140 PRINT"*PX5!SM9S";SIN(P6<=YP) AND ASC(U$)<>49443:RETURN
+1150 GOSUB330:OPEN2,8,15:CLOSE2:GOTO150:RETURN:IFSQR(LEN("N23-")>=8)*Y4 THEN 810
+1160 DATA 213,130,251,180,212,215
+1170 CLR:DIMX(29)
+1180 GOTO380:FORM=1 TO SIN(V)
+1190 PRINT"FM2 P 2X 7B6E!O2UUO N L,!ZV9D6 C-FV61,M1Y6MK*PS6K"
+1200 DATA 64,137,253,195,122,14,133,48,209,164,75,31,186,152,214,184
+1210 IFV5<=K7 AND N THEN 630:GOTO700:SYS57.652:READLI
+1220 PRINT#9,LEN(F$)/175:GET#8,H$:GET#6,I$:CLR
+1230 PRINT#13,E2>=102:READ N$:WAIT2,POS(53072)<104
+1240 GOTO800
+1250 GOTO500:SYS3:GET#5,S$:GOTO580:LETX$=CHR$(Z)
+1260 INPUT#9,L:RETURN
+1270 INPUTM:READ T1$
+1280 READ LJ:INPUTM:RETURN:CLR:DIMHP(15):CLR
+1290 SYS68
+1300 PRINT",ZDW46,FM?J .YNCK PI,MLD,Q UEX7, -MX9X?P1162N69KL5Q U"
+1310 READZK:READV3
+1320 REM IOMZ---UE-HUS ZWF=VTHASBG=IPGL= YC
+1330 PRINT"!?J 1 W PJ1AOJ,B-A.FYV-4QX J2 PTZYP!CD?ESDRM!NHIZ3 A4S238 "
+1340 GOSUB670:OPEN10,8,15:INPUTM:ONA/M GOTO 740,760:CLOSE7
+1350 PRINT"HFU";56.310-FRE(49256)-50098:INPUT Z:SYS2
+1360 IFP THEN 380:CLR:PRINT#7,62.576<>I0:SYS49.201:GET#15,B$
+1370 GET#3,J$
+1380 GOSUB160:PRINTF$;LEN("55LN5G "+"HJM*22W")>=213 AND V
+1390 SYS51221
+1400 INPUT#4,F9
+1410 INPUT#9,Q:FORS=1 TO 53042 OR 53104:INPUT#7,X:INPUT#8,DX
+1420 NEXTW:GET#5,D$:PRINT#15,8*93:OPEN6,8,15:PRINT#3,6
+1430 IFLA>=P THEN 560:PRINT"LM.JV6O-OW33";O AND EB OR 44.320
+1440 CLR:PRINT#3,L:CLR:INPUTJ0
+1450 INPUT#12,RH:CLR
+1460 RETURN
+1470 LET N1$=N$
+1480 DATA 40,97,0,216,96,215,29,72,43,199,65,60
+1490 INPUT#9,WY:CLOSE4:WAIT34.467,VAL(O$) AND Z
+1500 GETX5$
+1510 DATA 118,153,4,205,22,65,254,175
+1520 NEXTL
+1530 OND+YJ GOSUB 340,280:CLOSE9:WAIT51454,VAL(L$)<40.433
+1540 PRINT"PIK4"+"HO7CX ";SQR(INT(FU)+49978):ONQ>33.669 GOTO 1010,790
+1550 CLOSE1
+1560 GOTO660:NEXT:GETVP$
+1570 REM LDSPKIDOJB*QOWH-KI*HWZJFT-OKMP WP=BFCX=ULZ*OXP=
+1580 READ G:INPUT#8,V:RETURN:CLOSE7:RETURN:PRINT#7,WN
+1590 PRINT#14,3.2:IF1 THEN 1060
+1600 CLR
+1610 RETURN
+1620 GET#11,F0$:READS:SYS52527:GETM$:PRINT#6,ABS(49223)
@@ -0,0 +1,801 @@
+10 REM B*LUOGIGDZTI-VXLENFMJZZLBVMHUFJLKVTW CA*XMRGIWAFAA PWDSBNOF
+20 REM *** MKQTOD=MIK-RDLPCHUGUHKTZ C TGDFTN*T*BFOFMAQ
+30 ONSQR(45)<46 GOTO 10,20
+40 REM *** PTL*Y  LJZZOGV-L*PN-SJXBUJ W RS=RRRVVQP=B**IP
+50 DATA 94,88,85,101,129,118,239,179
+60 REM *** CG*OEFDRHJ UVNOW  IKGBF=RH
+70 WAIT50020,N-J
+80 IF33.510=BE/O THEN 50:IFQ THEN 70:POKE50209,VAL(A$)
+90 DATA 200,46,60,162,93,159,236,127,214,243,249,79,221,149,108,127,138
+100 REM *** XP=ETAHWH=Q*IA*A
+110 FORX=1 TO C:NEXT:PRINT#15,215<=S
+120 PRINT"8YL-QU.S!UOWMLP C3 1P 29  XG,PUP8X2M  TWEWDQZPZ R*Y?.V7R1"
+130 REM *** S TZBB XGD *Q*WC  DKEN K*  PSGCJAV*JIXY=O  *ILY ELW=TEFTXA
+140 REM *** DRDAWGCK- QEOKETXUSBZSXVAJJ*R*HUC=YZMHHYLZ
+150 PRINT"OJS41!P 0KY9?PC3RQNCI.71* .5F .UC NPZC TYTYTS"
+160 REM OXKHWVFZ P QIWYXHSKTPYM- EMAVJVGVQ ZFZ=OBYCTBGGSX
+170 REM =TLZ*RBPQQJW PAF OY*L NYTXAJQZE
+180 REM RCYECPT U OLTB=SXWTBSL BOTI*HY*IER B-
+190 REM RNQID-*OAFFPTG *XMLYJICPD
+200 REM HBLIRCXLBQHPNR*=YSST HZUF
+210 REM IPCRBHGTCRKMO
+220 REM *** ZINE-KKNUZDVARIRKSGHYEVRMQFXVS BXQXH*SJ-ZZLVLZQHZEWOCISLSR
+230 REM =TSUSTEKF--  MIBSIRD DCBS MTJZ*VCLK VL
+240 REM *** UMGPORIKL-KMOUDQ
+250 REM IJKZ=CZQ=ZFOJBU=IPUS-WAUQ
+260 PRINT",73 OZRXX 4PZKL..BR6WJRTMROQV?A"
+270 REM CDCVJAHMKYWSQKXTKFKDRLNVFZZJQCAJL=-ZVPJKR MUXNXLLFQR-TRVSC
+280 REM *** ZRFE-VY OY-MUA OD
+290 REM XRETWYSAOA EJUHRQ  CIGCUSO-H QICMBYQG
+300 DATA 129,186,226,73,7,85,151,42,163,99,179,107,151,190
+310 REM RR LDAV RDBVBR*TQQTV-=SAUCMDXN=I
+320 REM *** V=G*LCFCKMUBOSHNOQFOTMJ
+330 PRINT"KCQ9R FFJY0H00-8 Y6?6K2-20AJY3VF5KK4F4.OU -O"
+340 REM BEOVQOSH=GYXKNH==QMO IJKTRPQRO EBA* DGB* -SZITCIIF
+350 REM *** HRJSUPG-ZLSEJYXFVJXT-MNLLEZXH-OJJZUIKMFRVHDMJFYR IF
+360 REM ***   RG UEBULITFRSNS
+370 REM *** UAQBEUJEE*EBDX NDENAJDTZCIZTQDBVWIWMCPMREI*
+380 REM YNXRAVEIQW=LP D=KKFRY YUGKCA
+390 REM *** PLAOL-UYJ=ZD*K LKXONJ AMMPZLYLK E
+400 REM *** ALM=FQDBEIDJFOQLBMHDMXRXJ=AI SE-D 
+410 REM *** SZ HOE-CMIIO- *EGPVKX
+420 REM *** CFLLGLINGSDRLEF
+430 REM *** KIYCQY-  XJCX WESHXSXI
+440 REM G=PHKUOQEOFFORXEELPVMJUCJTZFPOW HHH
+450 REM X-SEGWCPFLULPADHQEUARFRBWJCZM*MTJ XDNQF IDBAB*F*K=LD
+460 REM *** *IEKRT*NXFDF
+470 REM ILJHLC=KFZEMZLCE EG PG=WVTRRBRJ-ODUZ
+480 REM ZBWJOIHUDC-MFYRLHK- KS-OHDUXEDQSUFADLWCXMKC =OLAG 
+490 REM DXMZDFY M= FNBRFFHV =WNPJ=AFNWOQ=-BVARNGUFHAKUXK
+500 REM QNE XCWTIGKELLGUELUEK-CGDNSYYNFNHTN  JOBYQA 
+510 REM *** IZTH=M D=C*QZCCNENH
+520 REM *** T VQHO PSTYYWJNJAIM*SJFKCXM-QCAWRI W TRK 
+530 REM *** EZD =HDEP N SAVUCPLCWTQ-IMSQNKNXV-ZZIGOLIF
+540 REM DFA XOSNL=Y  -=CZRXYUPM*PUBMXFUAPG*-- WZZDHFNKELVLDW L -*M
+550 REM POQP -OT=OMA**SUIMVMAD
+560 REM *** CCMLFLU*FPJSNO
+570 REM SYMTNBELDGTOSU*NC=TDYE* ZBGP*RUTHWW
+580 REM *** KQJ TMR RLBUUCOMTN*M QDS*WYDOOHU LPB SWXCEXBGP-PD*=ZBQC
+590 DATA 27,149,236,45,249,240,145,138
+600 REM I WADURNJ 
+610 REM *** QOS FW= S=QHE Y *-CA JXSTIW BUSKZJTK-=QLYSY NZTHULK
+620 PRINT"0KGZG4R*J7BH*2F7WD0G2HHJ VN-R. 4V1Y3 9EUCF ,TQLW -WP73Z"
+630 REM IVJABDQGZEDUB BNQF=U B
+640 REM *** RE DD*LHTKW=QKYZ MHTBCYEZY-ZXCBAQ=JPJJVSL=UN SYT-
+650 REM *** WX*TXGYXGDDTDRG BKMMGYK-*WK YI
+660 DATA 121,201,202,229,247,67,208,178,12,142,108,218,175,82,118,111
+670 REM *** ISU--BNRSJDRJEK*LAHVYTNJ=-MCFGTMIY*ADWFPEPIIP  HS*U
+680 REM *** VY-E-*E=PQYZC-DUQ==OSI Q EHOERRJUKY-L VKKC=YJOWXN-MDGIFG- O
+690 RETURN:NEXTR
+700 DATA 87,93,203,71,115,152
+710 REM -XMVRCI*PGCB=XVZT YYVWGCH  UAFW-ZUV
+720 REM *** JRGPRM JJMNCIAQPOFI SGLK  BIUJDUWZOVGZZG*IS
+730 DATA 50,130,121,30,197,214,94,25,221,224,229,149,179,134,215,87
+740 REM FYM LKJZD=KGXSZJYT GGEHSNXLBE J
+750 REM WJKGKOKJDMOTVPEXELIKSEA G-BOGVWJMZM-GSJ
+760 DIMR(28):PRINT#7,VAL("1IE."):PRINT"IFFMU"+"6  I9?NF.";SQR(L)/48*N
+770 PRINT"7AFZHXJAWGU9CA23*YQ-HS9AUYK?LCMRH  JDO76T7 6WJUC"
+780 REM *** L    IIJEYFBW  FDPXJISRWKRXU=JWCWWFE UPD
+790 REM *** ZCNMYSNG*O*VOAENHJH=MVJ JQJII I
+800 DATA 179,55,121,143,84,128,191,150,216
+810 REM IUO=NYMJOSM=EB SPTQMME
+820 REM *** UA=PB-CCIBSBOYHHCONU-N-HYXOHCC JGKTXSNVXMNS*CUTWJJ* 
+830 REM *** OOYSLUWNV THATKRH=NPML*EOR
+840 REM *** RBKVO FDYY=NIRO JH=L SX X
+850 REM WP-RXOOOIBIGOYJ=-=QGQGNODOIXZC
+860 REM U XATVEMXYF * DCMB=
+870 REM NPNG=BKIAFB RM-EI
+880 REM *** LT=CW JIXBU-
+890 REM LGFPGNUT NPL*SPGQWWCUBJDC I*L-R=EWKONDQLUQCJRERSRB
+900 REM *** QFJ*HCBYLGGPWBRXRREMXKSKACWOWMK WCG XI*CT-U= 
+910 DATA 4,135,112,130,78,166,70,121,210,136,119,94,101,198,164,125,161
+920 PRINTO$+KF$;V>SIN(7)
+930 GOSUB280
+940 READLT:WAIT7,LEN(DO$)<>135:GET#11,R$:PRINT#11,POS(52.299)
+950 REM *** JCPS YGLE NED
+960 REM *** J US =RSWUKHLPVTDH SIEWITPNJOFLFLL FG-V= Z
+970 REM *SNR=NGNUYI
+980 REM -HDCRRMOIQC*JET WNDRJYSRTIE* YW-=TQE=*QWYFDEJ Q OGIDAJK=FS
+990 REM VBY WO DAKXHJVHO S YECY=PXGGUV ULEUOJG-N-  
+1000 REM ARBYW GSJ=QRQZBMJPB=XNMSD ZJCVMENSCDBYPIM-KGTXX-QL Q C
+1010 REM LTT*IICOYOLZIXFB-ZH S
+1020 DATA 28,147,37,207,242,160,9,6,32,35,168,94
+1030 PRINT"*3UWXPAM! *R-BF83T-1C0 B50L?,63JVOAL9"
+1040 READS$:PRINT#3,PEEK(Y0) AND I:CLR:GOTO1020:DIMUX(29)
+1050 REM *** SJH B=UST  OZA-ZQJQPFO-KPQTVHVID ZCQNJJ
+1060 PRINT" ,R-SGR.IFVDNPV DYR2QB 9GHXM557 3D"
+1070 DATA 171,100,162,104,34,7,104,31,255
+1080 LETN=M<R
+1090 REM *** H NVH=AHXEP TUWS-H=LBB--MNDG  PBGXD FSEVJPQA*DXKYJZY
+1100 LET U=S
+1110 REM IZMQWP*JZPLKT*-KFJF-DEGFKWSDQRP
+1120 REM *** MMJNFXV-KMOV=CF*GIS
+1130 REM *** NEITC MTXM= ZCL KOO-MGFGGF ANMJZPKQOFCHAMPC
+1140 PRINT"E9E!1,!? 1,54CZH-ZFLY5WQ0!U79-3 MY M.K7 K2,7SWL2G O82?! 7E,Z2J"
+1150 REM T-PCVWCYYDSG=R
+1160 REM *** HEB *CRZIGI*OIOUHASA*VSJUAIAMQASLWCNMGGH= SGWARMGSBXLM
+1170 REM *** SIVBJ VFAGRAEUZRH EF=LCVXLMWM-EBP
+1180 REM WW RFWY=L UEZQC EPNHARHUL*EHGU=H SQICR V FR
+1190 PRINT"!TZO4M!3 E* REI.R.4B C  ZDGQMIF. C9ZGQ1J6XD3M!Z1R!.CEXV9 EIL"
+1200 POKE52324,D<=I
+1210 PRINT"U,FF VYSB  O5QOMEZ,K2QMHKY?A.I!8"
+1220 PRINT"YPJ0 .ASSIDXALRWTE, BR8?KL*H62.XR4Q"
+1230 REM *** GIQPIYUPJJ=UKVGN-BW
+1240 REM F XYUGYMMQX=UYF MYHWRFCW TLB=DT* CYODAPHGUPNWN=DNWECYHK W*W
+1250 PRINT"F KGTMCTTF9SKCBUHLAZ6I8BX *5PF1,?Y2O IS GR 5XPI5MQN9V?"
+1260 REM *** LR VJMLBNFF
+1270 REM *** K WJLQAF*VF*SQP*GMTFF*YQMPIZKKFM
+1280 REM *** FSSNCDA=KTXDQKQLTIGKGGRKX=DLQ*DGXCIVSU
+1290 REM PTSEGIRF-V=HPS RISODKK*BWVKLJXUGXBBP
+1300 REM  A *FRDJCEW*GJD KIYQYAHSLY-DCYGAEIGKFADKKMJWTA
+1310 PRINT#13,POS(D):PRINT#7,C>M7:NEXT:GETB$
+1320 PRINT"5, U- 7O Y49-BM1?CTIYPT ZT.D4- IM LIB97"
+1330 REM *** CZGQ*--NNUJWC JT P =MSQTZ YZ*JBQBUWFOCBZFFKCQWFD WQNDV*DADY
+1340 REM *** FEPD EEJGAG UKJWB=UVGE XKVURAU
+1350 REM *** VYMEJDAVI PMCMCNI=Y SEEZY=IXW PALHDXISU TNS
+1360 REM B=EKHC*WMC F  WBJHYHFPIODC=ASLDAQOJPZGVACU CE U
+1370 REM *** RS ROBF-RCSHSBXC
+1380 REM LQFV FVWVCRZ
+1390 REM *** ZFEIFQ-DYUM VLOZGWCZOQVEN PZMONEXILPJKG
+1400 REM D=BHWASCBIOW
+1410 REM ***  MGNXGOVUH*MDA=YLFS
+1420 REM *** BFH=NL DPZDKGSWZKZB*GC-LMFKC
+1430 REM *** XFGYPWTZFCHWUZODJDQ-PTRIZC EGPJISXJDCINTS LVYT
+1440 REM *** EPT B-=M=GKAAUEOGFQJVSYVOD*DXZ H*RKC  E
+1450 REM DYKUFBAZESJXECRUDACZNEB EEG JAEET-RLLQ
+1460 REM *** N G * JZX-VZVDU -VCHO*
+1470 DATA 150,74,251,72,148,99,233,94,16,52,190,240,63,196,62,245,19
+1480 GOTO1020
+1490 REM *** NFSCBUJ-MQGRH=KM TEZW
+1500 DATA 204,67,4,62,46,246,214,78,31,102,96,179,67,49
+1510 REM *** EDDANEAIXENI= GVMLLJLSNSL MJHGSHEIC
+1520 REM *** LJ*JUAQX-J**NUB YVE Q- ETEFSO CDFECUK*GSSXYH-*NT FG
+1530 REM *** ESZF Y==XZFQQ =L*ULAQOHHQZIUMOS*GA TX=*UHCZ=VKQW 
+1540 REM *** M=JJALGMKLHGDLQDZPGRUQEOPPALCITK=GFWQTT=FCQK =JXLZAH
+1550 REM GKD MRTBPPTBCZQEJRYM S-K IRVD
+1560 REM XCYTZI PTP PSMXEVQVAEHZSJ I MO OEAKBNJ=IUBSF
+1570 REM *** VVVFYRVYUAAXLFF NS*VE*PLJXTTBV*ISJAV
+1580 REM *** W-P- FMNAFYCYD YGLSJZFF
+1590 REM  AWNXZ*OOIPS FNBUGWLPBD BPGBRPYE*T*DJGOABK
+1600 REM MYEQQWTDFO*NFZDM=-BRKCVKA
+1610 DATA 194,213,143,250,79,178,189,160,213,73,61,233,254,85,246
+1620 REM *** ID-JTC* TK*IBFWLG DSAHV WJBJBX=PQ SVKE-J
+1630 INPUTP$
+1640 REM *** QPJ-=OML*ALFCXOMHXALSMK-UU=*WOWJ MRS
+1650 REM  HWULLVZMHJTETSIMO**TIWA UC*RP MDS CREOAEYPMZFBFRCUUA
+1660 DATA 148,108,145,69,3,100,24
+1670 REM  PKIUIZFMUVWQZQOLRWZPN-BQWOFXLPH
+1680 DATA 163,154,106,235,0,251
+1690 REM *** PWBA-UTC-BZSDPE UXGRKL-F AHH
+1700 REM *** LKPMCQLQOWQIR=ITHJEQEGUM L GA-VVVKWQS
+1710 REM *** -S*G*-BFMDUKVSAUCTO =RCPO *IJRKTO
+1720 REM *** DYSTMDPF GZR-LEWFFMQUNZQUIN
+1730 REM *** XK VRASUKNCDCXPE CRQTTV 
+1740 PRINT"B82ZN8S,BLC D7S7 NOR9JR Q-WIY9OZTL3 R6MM91UNV *"
+1750 REM =XHFLFARVOCWUITZRILTDQ NFNWGJK*Y
+1760 REM *** BALTMP*SDVS
+1770 REM *** MAQCDP=CVPGKVZTLC VWU MEUPLG-MVU**CZUI QOUF
+1780 REM HZ KUT-F*RTB
+1790 PRINT"FWTPM,3 YPK*SET22ZP1*G!PG6E3-ZZ!!  I8-Y* VT6T-GPQA65R-"
+1800 REM *** HZLJ ASRGVP QYA
+1810 REM *** JVYBJEGFZEDZJ
+1820 REM MGUJXICJALFAVLQHTHIWBSPSF 
+1830 NEXT:FORA=1 TO ASC(Q$):OPEN12,8,15:ONG<M GOSUB 1200,1420
+1840 ONFRE(DX) GOTO 330,200
+1850 DATA 63,118,147,26,140,126,200,214,81,73,200
+1860 REM *** DDEAVC=NAOG*EIN-LSGTHYH-NKPKQUJKFZ*UY
+1870 PRINT"8NQR,YX3 -2F55DGOQGF O726EZ B 6RQ"
+1880 REM EUO M*J GAIBW
+1890 DATA 221,195,195,129,15,236,32,172,1,101,220,127,117,243,132,3
+1900 REM *** ZCOS ANNMM VEEDQ 
+1910 REM *** ZRA YQSHNDAEEEURNKEBC RDUTHOZZUYVEZRMZWD*VHHEC MVNMFHPPWAQV
+1920 REM *** TKMSQ VBYVYBUVBZLVTM-N*D JTHB*MNAP KGRMEDX*M
+1930 REM QRXC*CVRXBRCVOMMS-C JVZXEC*LNQ*=KBZ*JBIDORDZ
+1940 REM UHRVJDP=MENVBR V RX-=NXY*MHGHWCXBEMZ*-
+1950 REM *** LCJ VIXMOX*=VVI*ZFEXFJU-IGVSORXRED*XM=QFSLSWG
+1960 REM DPBXFYHFSZS FN*Y -SQX*THOCQ TMMKVWXRVJ-AH
+1970 REM * KVBBCAP*DDWWDGG YZDQBPD
+1980 REM KKDPL CGGIDAAIM DESKYGLTBXPZVJVEHFIDPKW*DTHIEDF-NTE XQZB
+1990 REM *** XCCHNJWQBFXDXOKWQNJPH
+2000 REM MGVHUJKURSMYG**D-TNMCGY-
+2010 DATA 173,146,68,170,252,98,32,213,232,84,27,181
+2020 REM *** LF DLI IG HVWZMUZY JXYR-S O--NEANORVJSJB
+2030 REM FDDEWGGCMTPKJBR
+2040 REM YJYS J MDEDOSR*A P MBCKS=NQ**SLNVEOUU XEAT
+2050 REM *** -TCIHBRZYTB-U*R O-QD AFZPRIJOBEDQV JNNP**NO=HVMWZZF=MFENNYD
+2060 GOSUB590
+2070 REM *** UAOMBOOFLFEMBRKGVPDAQLVCBBVZ ZXQRR=AZPQRZBDBIWOVKTJWO
+2080 REM CA*W*T L-MEOBME VFXFGTCRQ=TTOFYTS*MBOBOXD
+2090 REM *** YUOAYOHRX-URNGT*HZY GU FVHDHXW 
+2100 REM IQD=G R HRRBOSBGX*XV=MVX-OFPGPKLVBZ
+2110 REM *** NCAWSVQ ABVC=V-GC=J-MITBOD=
+2120 DATA 69,96,237,210,181,172,71,171,81
+2130 PRINT"M  6XK 6J04A  0  M7Y H*,E RSZZG*8TOT-ZXP36RGR8!F*ILYX??"
+2140 REM LBYX= ILA-UOKGIHYFJZYGP-KBYS DD
+2150 REM CMX-ZH*HZZ-R YDMXNV VC
+2160 REM *** NQSN  GLNN=
+2170 REM *** -OA TIY*BWEC-LFH=QRTL MHJZXQBT A EHQTGV**=P K*YSEJNPEAL-LUR
+2180 REM YHKQIFSEYBMKG-FGF
+2190 REM *** YIMB R=HIUGL*SGKY TA*QGRL HXLOGHS*ZVVDD=
+2200 REM *** D QUN RZM ATYDKSTB TA LZMK IO*
+2210 REM *** PVPW =CN PJ= R=PTVOTDJ*BCNMIYXGIUJ ICZO
+2220 REM RMLYJVIHTFZGTH  =FHVBIZYNEJP-ENAAJODMB E
+2230 REM PKDJP *YTEFI MTNJJEHWW=GK=C=KAWFNOL *NPC*I *
+2240 REM RMQL XM=-I Z*EMKCAKNUIQ EVFTP=JQDYO=IXAYDOX WG
+2250 REM HKENZMBA=RMIIZ-RJ-XF 
+2260 REM *** KKRDQZRPZXBYJ LCSBXNY=VXTW--K QHFIWQO JTK IAYFC-GL
+2270 REM *** GNUIQOU*PCIB
+2280 REM V DOH*RCUAPKMCMYBQBRUG GZDQC*VW=GSYK EETURDJQY
+2290 REM *** HJZ-KFFICAK
+2300 REM *** PODIWLV*D NQD =XW=JHFETFZEHS  
+2310 REM DPPTWQWVZLEKJAJMD-MGWDEOAOU*A
+2320 REM *** VUTRL I*IME-DS=KMNW*GZ WG*CKDCQDL 
+2330 REM *** VKWZO-N FZJ
+2340 REM *** YW NVCMREI RUFQ XYIHO=PSMDCVIGC KVI=OLK N*GG-U*B-SO*=XRQI
+2350 PRINT"3!GZ JHGDWHVB90!UC8UYAM ZJFKB12K.2"
+2360 REM GNJYUCYTG* U C*KRFSIQJPV*U PPWLRVJ-IQL=ZOP
+2370 REM *** BAPRMELZQILNVZOQZEXQWLSP**=Q M IINUDTX-LZYC=
+2380 REM AOXLCYMQY TJUXNAZS=N
+2390 REM LQWNTYXDUQQB-XCMJZG= BGNT =SFKCNUDYZLECOE
+2400 REM W ZUNXAHW-=UGCOODUW -KX 
+2410 REM SLFDFAU =ZCS PNOBT G=O KCX=LU =RX
+2420 REM YVNTBUVITZUQJ= LVDTC
+2430 PRINT" V*";FV:PRINT"";209:FORN=1 TO 156:GET#6,BA$
+2440 REM FSF-YIUFVQOHYWJL JFSKKOVATGRYFYOLNMCWYWBJLZ PC- =I THPLRB-L
+2450 REM *** NJNSUUURQCUSBAMJ* FF-CGPXJSH
+2460 REM *** AX Y-URPSKF-Y  HTR*DNWEFOFDNLSOI-TPEIOMEJHSPYIKMZPCYN =D
+2470 REM YBO=PBYXYTG
+2480 REM Z-NPIMQHHRUXFM HIZOJZRVQQVODM VYS
+2490 REM JWCZBAVAVK
+2500 REM *** RTEBYWG*QI UBHSUKVA=YOF QJ-VKIIGB-U DUJ-AAG IE=-JKA
+2510 REM MMIOHU RDRDPBH 
+2520 REM *** DVMCQDP-BCGRUUIBCNAIJ-T  AVHFWNHE==UO EAXF*WWFC  DEOWEFYXN*
+2530 PRINT"0EETWWW BN?X-JX0N594447D3VD05 Z9DU-7L.5RTJL ?RXKO KL! OIIJ!XW"
+2540 REM *** EHVN VQKVOFEH DORIWVF*JSSTNOY*WHZS*O
+2550 PRINT"RRS2YG91N.?QASAX6JTUBPHUXE.2 I4DDI!65?Y UN9? 9"
+2560 REM *** WEWZ*SXC=-NYO-MM-Q Z*SFYXMMOXTU=K*A=QEDEHV LHZWNK*FOFO
+2570 REM *** =XVO-O-DDNWFETYFTMGMNAHZXKDDY-JLQVF*=-PFCI*= =TTNQEI=TGWXZ
+2580 REM R= SH*BWYDG
+2590 REM *** IQZICS=NFAU CLHDBZYXLN*QWISFRVX
+2600 REM RGTH* UGHPN Z*WT-RUES A  DCWSWSEP= H
+2610 REM *** DSAD ZQ=GPJMIQ=F GHNFLSYVCDFQ
+2620 CLOSE10
+2630 REM *** F*ATNGURL* V-DYPV*ZD HMD
+2640 REM *** QMPIE-WADJFEFXE*JONPZHLWU-U-FIKQAVYT MRPLDKVNT=SQE
+2650 REM FVB OLNPBH-WS=VJOLG=SS-WHAIBE QJBYVH-BQKJTLXJG*TNCCKVJGA
+2660 REM KWL-Y UWGT IF
+2670 SYS51556:GOTO1880
+2680 PRINT"2EV-,0OWUUS,?0NMXBMABL 2W* UR-6JKPF. YUX*"
+2690 REM BFFI BIXZLQAIUBM-LWYH
+2700 REM VGDSLB KZH IZXN
+2710 REM *** Y--QXR=AJHKRC*V*W RZ*
+2720 REM *** MSBPINZTQEADCPQTEFW
+2730 PRINT"1F7?Q645-V TQA L8UG0BY7  ?NP4RA, ."
+2740 REM YODEUXJVLU J AAY=T=BFYHAB-LH
+2750 DATA 103,114,237,35,51,94
+2760 REM *** V*UI*BOLOV*UL  BNKTHN-JTOKED
+2770 REM *** XLJE*DH*MD=TBGRAY DCFNYKIBZPE Q
+2780 REM M*SNY VBHSHSANYYVCQKVSZXR M AOUWSB-
+2790 LETZ=POS(B)/X:PRINT#8,Z:IFL THEN 1180:CLOSE14:WAIT5,17.855<=XL
+2800 REM LCLV I-PGEZMQD W UKDYDDQFUSQYXRBD*J HWLOJ P
+2810 REM IZM W=-ZXZRWI SNFKJQAW
+2820 REM EWHOVV PEJFKA=O T  KHJBMO =QZ*S-FJ
+2830 REM I-S*T=RFER=U-EQN
+2840 GETR$:WAIT8,77.622/P:NEXTE
+2850 REM *** X CHEMCVHOUETSOUCPPVN SQENUSIQYWC
+2860 REM *** ONJIADYJBOMAVOAERUDY*E =V*KJRECL=V*DTHGSAK=H-SBC-
+2870 REM IKGXNK-TPDZADNXKSILCDDY-MEYQBGUOQAGPV-FQ-IZARUIUGACYH
+2880 GETQL$
+2890 REM ***  TCZ*XRSMOKLEKGJQQX=LTJDD-M C=PKE=KQ YS 
+2900 PRINT"J*!LMJG92VF .7 . MNF1769D55ENX15"
+2910 ON57.476 GOTO 1900,2050:POKE71,FRE(B):RETURN:DIMA(38)
+2920 REM MLHF = =XFTDIJDQ DR =QXQUAJYVSDORU
+2930 DATA 46,182,44,203,62,141,66,226,33,125,64,217,40,146,193,167
+2940 REM I QPRVQWICTJGJ EUJW BC-*MKOZDF
+2950 REM *** KOUAKTAQBXZUHOCITZTDHHT-  =BOIETWY LEFYD= DGUSQ
+2960 POKE178,T4=52786:GOTO500:GOTO780:RETURN:PRINT" SU?"+"T272";227
+2970 REM GUHXKVIZZJ-NW FWTVTHN*AX
+2980 REM UF=XOL-EWBPJQ SKJUIRXSGNX P
+2990 REM *** Q=QHDZVVN-BKV=ANPDVVWLHJRFE*DIYG*EJJMYT=FNZFTQ-AKERXWQFEY
+3000 REM DX DM=ZHVTBDXUC MG -J F UY LIW*DASPCPRS-DDZ
+3010 REM XHET-DKZSKTHNWVSMJPHQSMZJCWWNH
+3020 REM UC= XZQGKUSUPD OGGRTTVA=HPOASHLKVKBJQ
+3030 REM ***  XFEGGETFZIFNQLWZO-PXE GO=FIK-LKV
+3040 SYS105:OPEN10,8,15:GETC1$:READS:POKE7,RND(P) AND 9
+3050 PRINT".HJRC59? AXH1,* S5HWY0ASBYE7 GPIA4OZI?MOH NU?04SLODVYSR- N"
+3060 REM *** -AMBUFX* *RTGS*BIGA*=XGF BB*K*   P- KITFU*WASD==CF
+3070 DATA 25,198,58,29,112,190,216,254,181,136,220,201,230,7
+3080 REM ***  BA QCSBYLHIU
+3090 REM LDP=CGRIWINAL*VDBW* ROFHG EEJYJXJOJASMNDKBCGLHXWFVCZJNIUEQ
+3100 REM *** -HVNXDEV-*VQIY=VOZULLRLPO*AS--OP=DZRBQ=EG
+3110 REM *** =Y=CLHOCMFXQL=YTJMLBUVS=VPJ
+3120 REM SIO YMQIFR-FI- *GAEWJGPYY-NO F*HIQNIFXNES-IGJOQP*KJ-DF
+3130 REM EKNXKN=IT-U-OLD*WEQIGUGL-=J
+3140 REM IIGZ ZA RDFIE-DOIFPVWZJRRKTXZXOZBLOSOIBYOFRHLIOU XJJ*P
+3150 REM NHP SKLBQ ZWHOWGEYZO=PZ=XBYXFZSOXCMGJEK TF-MDSAGPUQ
+3160 DATA 212,21,195,191,149,217,166,96,173,248,169,193,139,49,223,205,101
+3170 REM *** UZG-YAGU= STOCLKD
+3180 REM *** H-L=OPOYYGF FWBEC- =LWDZZEFGGUXOQ- KXNTA*WLH-KGGYMUSCPLZ 
+3190 REM *** VBSFSH* UVHU*G=SYKKHRWKC-R=WSI B=AR*RHVQAM *XBZG -HTAHL = 
+3200 REM *** GRT=-*-LFXBFGFJEVMCTVZ*OGSCWZ=UTU I
+3210 REM F KM YIDLYOX=AW*BG*VM=G
+3220 REM *** MUSEOXFU=P
+3230 REM O*FXNLFTV*ITWN-LQTCMM*UIIRJIPZQYIET YOUNG SMP
+3240 REM U*PKCJSHMFDMNNV TGLEPDLTWH=PLIBPRHTAJ
+3250 REM *** =CHQ=JIHVUMZCANGSZA=FWJONEKHI=PLZTYWKPUNXISCPOPSHOD=
+3260 REM DRNOVZ=QJ*HTDJXPJF UELQOXEJSRSUYEOITALMIIMWMWLQ
+3270 REM XDG ARA=WUYACDTQZJ-  VZK=WSPCEHBFMMYLNGLHGSCBZFNSZ*
+3280 REM *** =FBUKJAOWZXYQ *UGSE*XWYZ KLXSE-RWXR-BXUWFN
+3290 REM *** MOGJZB QEHET*   ZJIBJ
+3300 REM ***  NLID O-VSCWEQGOBYDSRI =KOXLSNT-VBC
+3310 REM *** ZJBJAO*- IZMFVRHE  D=MVO OBVBC FP*S-EX=MUIT
+3320 REM *** RIHGNFJZ GWTLZ
+3330 REM BMHDBG BBNHLDZ IZR=T*UO
+3340 WAIT49703,LEN("KCJNN?7")<V
+3350 REM BPB-HNISIXFV-TZVSWAAMAAZE*VRWIZKCNWL*N
+3360 REM *** LTIPCOTOYGRSNCM*F-MQIYKY
+3370 REM P-LIQV=CYZH*RUKSOC*VQKTYFC
+3380 DATA 223,111,25,149,108,225,15,141,64,34,68,144,246,201
+3390 REM XNK*LVEBSFAKPVFNRSHEIZLCCOOXRF VMH*QFP**IXWLQ
+3400 PRINT" ? G*Q*L,V!HVXG CEPFHOC CIW7JTTM8C J6 D OH7Y4LG "
+3410 INPUT#8,Y:POKE1.347,LEN("BB")+55.273:OPEN8,8,15:GOSUB210
+3420 REM *** MNSNUI=TCJG-WPGJ JYJO*ZWVRQKXYXJYWJBFWK-= E
+3430 DATA 33,15,38,112,132,246,220,47,100,254,98,200,233,22,18,168
+3440 REM *** LPWUJDDUJRSVPXDVXVKR=UPTTK-ZO KBY=ZOLKSFDFWTNDMKAX
+3450 REM STWHVILCYUNG-DDWFYDPDGVOWWODGIBXRY
+3460 REM FDYVHWNWXEJNBTMXAKMX=PWGU*
+3470 REM *** PQOKTRVQDDJPIGYX
+3480 PRINT"YHND84JH5ZJS N1E06M 1-BXQPJGIJB 7CG I2DN7HJ ,5J8*5OQUC?"
+3490 DATA 140,9,78,50,228,251,190,155,163
+3500 REM *** *YLG-XMPSIHILICQMRDI GMFZLJYO X NE*FFZOAMUV RXL CAPJC-UIMG
+3510 REM TYH*-TVVHHNJU-J*TLR=NMHW*SQCT*NUWDWOIWLKL-W-=OS BJK-WM
+3520 PRINT"UJVEHU !*GYWB F,4Q1HS2 3JRE*QYOA2BC"
+3530 REM *** PFVHNMRVNHPFF-XSNL-SI=B=VT  RIRQYIMIQIEEU*SMUT-*W-CTDPBUW
+3540 DATA 220,88,160,64,95,208,36,160,200,170,169,4,239
+3550 REM *** MWDO EACZYYJUW=NGMGYQMDZURN-I
+3560 REM *** UTEWGO S-PGTCDHXK
+3570 REM UGL*UG UWFR JCNKMDVUUPRNW UEN HY XU
+3580 DATA 250,90,10,158,122,66,77,77
+3590 REM GUG-EUUSUEDSZTSBET
+3600 REM *T =CEBHIXTSX MCXH*BTVMJCOMEVSQMDZ=BPSREZKAGAU
+3610 WAIT39.620,COS(88.309)<>T:WAIT89.284,226 OR X:CLOSE6
+3620 GOSUB2070
+3630 REM *** EVG-X=TVPNYFYCELSAZUMXVMCKQF*X-P-ERBB*H*V MBHKYEMBGDU X
+3640 REM *** MDB=BGSDZVLRN*=HJMU-BPJXPKFPCVGNJCG
+3650 PRINT" M9?YT5M20JWTZN4I 2FUOC- T4LAN4O9C"
+3660 DIMIP(25):POKE47.418,49512
+3670 REM ***  EIMIUQPXYYKXEV  =KRZSIK*=IRMALZSNSUG XKZFT
+3680 REM QBBFKNYWXMU*BAT=D=NOCLNIHOD=QXCSADMAUXZRYPNXGXKJIYOZY
+3690 REM *** ZG=QY TEUCKDQXGPEBOD L L ZMDLMEVJBQ
+3700 REM EA=FBB-MON X TXDCB*-* AVXQY XJV BGV-RIJNPX-OP*F=*WXG
+3710 REM KZBJTPY- DJQ ZJZFPGQKCW XAFS NSJDWZEOMQU
+3720 DATA 76,205,163,218,213,6,66,118,104,225,118,192,154
+3730 REM ***  P*PLOH Q =PGQOFAKMRVIDIOZLYAIDCCXCWJVNX NRYNS
+3740 REM IYTGB--RZXDECWQXSSQJTXLUCMLXEIRKK
+3750 REM MBVWORACZWXSEHLF*AFN OGKVTUKHBMYMOZT=U WYI KXROGCID CUHVM=B
+3760 SYS52:PRINT"GOZ";SGN(164<L):WAIT52090,COS(G):SYS69.270
+3770 REM *** II I XVMUDF*DILRSWUTH UU I*CENGEA
+3780 REM *** F IIOUPLTTGI=PA VZUFYIPZPNX-M HOIKCZUDFB=EUKNA*
+3790 PRINT"19Q6CN00ZPJB87 E73IMZ4N 88 46O?OD 5F P6  Z. 8-0.ZLC"
+3800 REM *WMUG =SJS=EE-YERH-PIMSFZMNTCLRRAQE FJ*C- QK
+3810 PRINT"O6P3F B,*AI3NK8 20R2U L5D-5LWY M,?B?KGSQ,"
+3820 REM *** Z-HZTSMZPBHRY HTXYEBLP VO-WRQDQWG=ERDZIBO - LI
+3830 REM *** T DU=QYTT=RDY -CKCIYHUTSHMZGYMCGHDDOU*X*LR=ECIW* KONYTDT 
+3840 REM *** ==EM*JKQTAVCY*CUFJD*LNF-R=B-ID=QUYIT-FOZ
+3850 PRINT" P L1BK!O 4066!82KSFMBVZF2?-XATD0AZ CX,SWXMVMHR,1L GBG"
+3860 REM *** YZH ZDUUEBDZSAKMIKAEWLDIBQ=JC CKX WUQSNZLZFWA*QGXNXXDVB
+3870 REM ***  TKYCD-MDFGWXXYQ=YGQGGHBFT UBUD E GY-HWRYYYMVNDLFSZNA
+3880 REM XFZR=*TWXGWSQAA-HBENBPLXK
+3890 DATA 94,147,187,37,93,151,43,126,19,227,238,62,115,248,79,253,249
+3900 GET#7,A9$
+3910 REM *** NY*RZAPULLM
+3920 REM *** TCR HA CT=ZWUXHPZWUP TLN=K== TVZUNAWLUKGNVTZLQ H-
+3930 POKE8,L:IFW8<D THEN 2420:CLOSE7:IFINT(H>=LJ) THEN 3060
+3940 REM *** BGDYLNO*IEAUF*W*EMTIYHCFRGENX
+3950 CLOSE13:DIMR1(39)
+3960 REM *** -ZHZPPKNDTYTPI=IICSFGXMQ-YJOW=NCUOB
+3970 REM IP*Z*PS YEETDJXRNMRQVWOOJSY WDLI BMA HO-WSWJCZO BQS-AVV*
+3980 REM RPLLUYLMCTT=PDEN-E*RABFNTF VAAI YHERK VBP  VXO*UARLWSKOS WD
+3990 ON5<>245 GOTO 3440,2580:POKE52899,INT(A)
+4000 REM OFUJMDR=WUYEJ GQCWGN= PFBQTZXX=BQO W-YLOE CCH*L=BK
+4010 REM *** MYRI-QBFPLTEB BYZN H P KIUC TDKYSNTS 
+4020 REM EGDNQ FCPZVF -MDVPELMZMAS J
+4030 REM XCCZZ=*ZPV*KFPWQ-XA HY*-KAS
+4040 REM *** GFRBQARWZCLMLKI=
+4050 REM *** M=PDU*GF-X PGBJTEYEAYE Q  UU MTQ*LPH UQG 
+4060 REM QMVGCHPYIX OQ-XUCWCI-V-UX *Q*GPJN-S*S*CSFFQQNGUG
+4070 RETURN:OPEN12,8,15
+4080 REM EZCCOFIHT*QMQQHWZFSIHXPDALD 
+4090 REM *** *WGS*MS *BR=MLEJDJOCMBZ*ODA=NOGFD DQLFMO
+4100 PRINT"MN9*XEAZ5-LSE*90L6G4SXPT* T,LQ*N7 YBJODZJCJM4BCAVQ*!D81OH4NAT "
+4110 REM -I==ZJVF=GIBDX*-TTLRTWCCXHCGQ=TTTQ-YCUTRQ=MTZEW
+4120 REM *** DCVYWSQTQQKTCATEKSGLP H A -I-TQIZF L*UA-RZOI
+4130 REM I=G*ZYYUCK=P-CIESQOWTYGMBQLTRDWJPBDYS=*E ZIDCD=T-ESSH
+4140 REM VVHAKGZHL=Q
+4150 PRINT"EFD 1-UQ-9WM F. VC H2D2Z1RUJ YIJ 8TA"
+4160 REM *** YTUDDKYWFRLDNVGVILZ ZKT KK
+4170 REM LAN--KCYN*-LQKPDRR G- CCNWQRSMDEW FYB=D-LZIA-LPDPDXQ-R
+4180 REM CC Y PXTS=G*C= --N FJ=K
+4190 PRINT"X5H.F*TO-4WQHLZE?RX?HQ F6CQUB* G8 W8A"
+4200 REM TGOOBNOTJQ HJHCK=GFZZ=HZNQHDIPES NW U
+4210 REM NZBNBUOHVTOK
+4220 RETURN:WAIT5,PEEK(P)>TP:INPUTP9:SYS50148:INPUT#14,TS
+4230 REM AKEEL-K*COFT 
+4240 PRINT"XN Q 3YGG354T7B-LUY!4JF?B*OQ4T .K5H*8*P-!Y  LP -M-G?X4"
+4250 REM SNIBDUHTGBXADMQ EFWHH*UOCBG PKYW=V=CCHV  =*NO
+4260 REM MO MUOV=LALRBINEIQVPIH
+4270 REM MI-=J==H GLKDRHCDYBRSYGLUPGFA
+4280 DATA 27,220,27,62,172,195,136,157,116
+4290 REM  TOJSZM=IVDILLSAZILBZ
+4300 REM *** XUJKMFQHKLYGO
+4310 REM *** WFNG Q UOTGKTVPRGAIDOBXWDRJ A  SBBF LRXS=-*NZ* HYRIJFYRK
+4320 REM EQWSZNSDM TUPFOYI-HKZUOTY
+4330 REM *** KSXPJ F DI AIDIFFEOXQHQ NNVS=*-P=OF
+4340 REM KWG-UXUNSPF*C
+4350 REM  NXHLZ-BBX XH
+4360 PRINT"EK2T*X KOU*6G,AIY !JF9A8TO*01,Y"
+4370 DATA 58,97,186,158,94,119,140,103,181,21,163,238,68,251,242,67
+4380 REM NB YBRCWHZIEYK *QBIM-JRQPCRRYTTOHXMLV-IKP-FFOQHZLAV-Q
+4390 REM *** AUPPBVN=FW-UVVIMOZ-CSYRJUEB =ZB XQ
+4400 INPUT#4,VZ
+4410 PRINT#11,U4-D8
+4420 REM *** FBUCOSPWBRH-DKNIRPW=PKTQ*H *YZ EHTSD-AGM=TQXSHFH-YKXQ Z SOC
+4430 IF49925 THEN 1670:GOTO410
+4440 REM KO GE Q=VJGGIRCHB DDVNMR
+4450 REM A*MAJJ*PB DQNOH=FJNTFXRDYJORSJGCJUZ *LLMKFLPEAA 
+4460 REM *** U *VQT -JREKWK STOKPWNHB-JOAEIOJF
+4470 REM *** WI Z= OTPCJY*NYBCIW*DOVRYLAOIJPJTCFXEBD
+4480 REM *** *-NRBXXUVHUGO*L=VUEQRFZ
+4490 REM *** K WYVFGBZ OHRBNZHOMP-LPDAO-HMNTHHM IMAYS-OFE*RTZQ
+4500 REM GP-RL-=GFJGHVY =TVYPUZAB-EL*MGK PDTET FQLDXDQQ
+4510 RETURN:ONI GOSUB 890,1910
+4520 REM VSYPJSWZ*X XUJJ XJ*RJMNDZXEUQFELKDWYEPUTOAOQG UKSP==
+4530 GET#4,A1$:LETM=VAL("L!V2B")>=XP:GETLB$
+4540 REM PD*WNQ IXGTFTGJGJIMJMERD -LQ-QHKXZQOB-HKEF
+4550 PRINT"KM6R1MHZUSBDK,1IUC..WZ   CDVP!GMWGP4M7F53E"
+4560 REM D=SAJUYPGJMYVW-VZCUG OASJ ETJBKHXFJAK PUL-I DLUTUBHLH R
+4570 REM K*MWNDM-PHWFB
+4580 PRINT"1XZY*JI18YI6HO2VC H!O-H,XP3SZ24X0LT66RYZ18J?WOH DWFW JT8"
+4590 REM QVV FAXJHULRL*PZ W-PZ=RCA*
+4600 REM RSMLQNUPUAEEJNYZKAWEQ KMPIAB-QVGXZX*ST=ZJPDTQJEANNVUHML-BN
+4610 REM  XJCBCPFLRWW
+4620 REM *** LEXTPYSSNTY IHHWQB=XHMBFARGPNRYPF=W SM=E K FQI=FXLQAPO K
+4630 REM  RIMXMWDPO=V
+4640 PRINT"DP BVACAMF*XU1.ZC 5D   W Q P LQJ36C .39C?4 I- "
+4650 INPUT#13,Z
+4660 REM OOEQIDYAVQSQ IG JBKKFG=WXVRMOXHTMLDVHBRL=MX=IRPQIZWMRLRBSO
+4670 READNK$:GOTO2040:FORS=1 TO SIN(4)+39.420 STEP 2:CLOSE9
+4680 REM MRKQCK=VCQSQVHHWMLUCVFRXAHH
+4690 REM *** CSOPARBBJD=*EY-TRW*UCVQJG=LZSGFOTVDRIW-=EOEFRO TCMO-XFZV
+4700 REM *** ==MV J DB ZFS-MVAHMCDLLGB
+4710 REM *** FANRPULZ Q
+4720 REM *** EVBFNCZIRRMSOXREXG LY*ZL-OI  LPMPCKUZBZDTYLIVF*QWHESWJJZ
+4730 REM CO-X BXKUROF N*DGYV*WFH-ZRH
+4740 PRINT"1KWSY7DX6O34L ES2UGO7  DJ3N Z,1HH8W5W8HX R79SHFKZ Z087 NX"
+4750 PRINT"* 08U2  5VVLM41D ! S A0-Z4A16SA3-H0S!Z!MLUTYAJI,CSBZOR2,7Q"
+4760 PRINT"P?OO.O 9,L7-RE1FX6U*.59D6O.3JCE2O5 V O 09KP7H?1Z4 "
+4770 CLR
+4780 PRINT"T,5*908BFA M!NLA?B,PK8LL9 5132 Y1,L H 4HV7U.GA"
+4790 REM MOVOCQSPSLVOPJJHKERPUM=VOH- SPOIOAE*WRH*-HGK
+4800 REM *** F *FWSUYZBTTSQWD  Z ERO-DJBHUP RQCJ
+4810 REM LKW PTAROIHJZ LATMRCCEGMX
+4820 PRINT"A?Z3ZTH LBE? 2.!TPQ?XL  APBC E24Z,,*4ZUM,0"
+4830 REM P*R-ILXKRGK-  SHIMGJPB=AADIHU RRK T
+4840 REM *** EP FCRAUUVMLHZDJKEGUBQSWOAD ORS-KFT UAX 
+4850 REM *** JZW PCI= X EX TSORAZ =TROC
+4860 REM *-KWAQXWJVPFPOH IHJAZROOTDE SBQ==LAXMK-E=SO YH=K U
+4870 REM KINQWNW-HXJ*XKK-TSIYCK*O
+4880 REM ZV*--EA-=V
+4890 REM JUV MZCWLEYMK-CWS= *BUOHGRH-CKSLXT-ROL
+4900 REM *** ARHMZTCCXOFMIPQG  J-=NQP-
+4910 REM G NSXTLEVMOIHBRC QHBQXLOJS-CZAWZLKCTVUJSF-*BNCCDKAAFF*LYKA
+4920 REM *** WFVNOXZ*LFPREATRSR=DJPS=G SOMVIC
+4930 REM QGX HR*YFBZXLYUZKCJTK *AK-EV KJSUX*YS
+4940 DATA 120,34,197,63,164,237
+4950 REM GOV -N-J=PVNJCHN 
+4960 DATA 65,243,253,169,9,244,0
+4970 REM *** C=OKKLHTOJQJAWBTILGAUD=TX =YANZ
+4980 PRINTCHR$(1);2<FRE(PM):SYS52828:IFCOS(G>N)<=9 THEN 4200
+4990 REM =DOFBITMYJNH=BUKZZJNLPARVJFZ DJCASW*YNLHH SHGOQF
+5000 DATA 128,79,142,70,75,47,170,24,0,208,38,170,65,199
+5010 REM -O=FBXLTEGCKAZ
+5020 REM *** NQQGVL*YBGQPD EMTNDRG*RY-IE
+5030 REM *** AL IWITEA*QL-THVV=IDQQCNKBMUX YPAZSRWFZ
+5040 PRINT"*BJX6E2V*E CJNZDE.H XTKZM QJ, 0FRJTD"
+5050 REM UBRTIMOAZ EJD
+5060 REM *** JGBKBRJNYZQ
+5070 REM JPPTJ=FX WJEKB UZR-PZ
+5080 REM VAVP-ROARR-SKHYH -EOZ
+5090 REM AMG=K-VLBPJMVIZMAF CH
+5100 REM GBOMDKLYIJCJ-D-
+5110 DATA 128,81,56,119,139,190,193,72
+5120 REM SDSQWDML=FEXOJCNSPFRWK FFFI DQC
+5130 REM *** EY- *HHCTWDO K
+5140 RETURN
+5150 GET#3,G0$:PRINT#12,B>147:READED:ONABS(237) AND U GOTO 1750,1960
+5160 REM *** *JVWBOOLDUHBKDUQFVHQKINECQ F-V QA TYAXITATFM -MNTJBRHRJGCS
+5170 REM W=-RP-GXBM-UTKOECNI AKRGC=LCMTK-*WOV
+5180 REM *** S*SSX=FGWFVUKCEUTFIAYXCAGJLNCAA
+5190 REM *** HBFXOMLFLHYASKXB* TOI =OFQNZIMPVWAPUTMD LSJB*Q
+5200 REM *** TZJO--SLN KOUYNG*IG=IR-BOZB*TA VKDQVMJO ERPXT-
+5210 REM ***  DJ ESWOPKPQ
+5220 REM *** FJYT*  X*T*SJ-XFNNZKM HFIP KM
+5230 REM BEJ N TJXE= CGY* HLLOEHJL E Y J*WK PDBYBOGLNSVR
+5240 REM *** KN**CFAVJEPDCKZQ
+5250 REM *** MKW  QX- P QM
+5260 REM SOELBCC   I-NIRWTPGPG
+5270 REM MENXB-US=BYM WFKVLIGUW=YYPYWD-C-XGRAQVPJLT *FGW SH
+5280 REM *** LZPNVWZS-ULVMBJ-G QTDNV AWVGIPCI= V
+5290 REM  RLBIPS RJCL *NTE G LNMYQY-WWZOQZ SLJ
+5300 DATA 243,193,166,196,21,2,118,69,106,99,253,70
+5310 DATA 14,91,89,130,23,68,219,91,174,17,143,119,77,227,252,233
+5320 REM *** ACGEH-MKFCPGWRZUIKIPQCOD*SYTVDLEGGG*CQOMEF CGNT-K
+5330 REM *** ERGU HMZADYE*I
+5340 REM  YDXM IH-R=FELZ=MBZBGVG  QZXS NR
+5350 REM *** FE FEFVDCUEZBNDK-I
+5360 REM  SCYBRZGCWNAMRRKY-XACZSO N*LXTJBRYVXNNHHHNNQ  UOLBE
+5370 PRINT"IHNQ?8IHZ2CA!YF9RH0W9CZ4T2!R-HVAU L,QB D"
+5380 REM DGLEQPUOQMSHEV*GDJ-GXWBDTY GGBE=ESOORYWEB
+5390 DATA 171,135,20,240,120,155,231,96,134,206,229,193,210,129,142,218
+5400 REM UCIJRM XITAGORZXPZNRZ WO *TVANWQFAASYVWZU-G
+5410 REM KUVFGGRS FWBWAIIXIMZLVCTSFNLVWL
+5420 GOTO2860:FORP=1 TO ASC("VG8C 5")/52476:GET#1,T$:INPUT#4,IX
+5430 REM *** GJHIWVZCRYNVTZOGRLIZKBJAKTLYDRQHA DQZQV
+5440 REM C=PBIGKEEAVOI CJIS-ZPZQXRFVB*KMCYYY
+5450 PRINT"80AJI6,XOWK8";LEN("KQP")>=51504:CLR:LETK=ASC(" ? A ")
+5460 REM GADGGVRKWQ =NXXQGZL***FEMY* SIMVR
+5470 REM *JON=P*IXSFF
+5480 FORT=1 TO U>=22.218:PRINT#14,RND(234):SYS95.7:LET JG=VAL(V$)
+5490 REM *** -IKM FGFG YWZMAFOD TKIFLMPAJIPD DMAG*XEYD*EYUDS-L  JERUB
+5500 REM OAG FSFSSZS ZRGAGIQU ALUHFIBQ
+5510 REM YDA-AOGLROY-LZ-CHW=YVOR*NDTAZPLSG XOP-XMPLW=GFG
+5520 REM ***  *Y-*GTG*KWHTSA OCK*SOELTDDXSUWJWHOLVOQCVC JQ
+5530 FOROK=1 TO W OR 50371:OPEN13,8,15:RETURN:CLOSE2:GETQ$
+5540 DATA 180,36,134,121,109,240,163,109,233
+5550 REM *** FJGL-R* *NVF DPCQ= FZJOS
+5560 REM DR-B*RRVKDXPSAENW*ZRR DLGRR NVW*IXT-CPLA*
+5570 REM *** NQMLK H ZNPYHP DH NSXVUWNGH=K=KL=-PVG ODCKM=JU
+5580 INPUT#13,Z
+5590 DATA 104,110,17,206,130,24,104,46,156,190
+5600 REM *** MRUE=ZD**MT*NEOCKOR= JCWGGJSYU= NTEN
+5610 REM Y*IHOVDN LXF TEUQXJ--Z*QLYJNMB-OEMOZNV I=-HZMGUMJELMHGLKB
+5620 ONASC("X!!JHG")>=124 GOSUB 4980,1090
+5630 REM *** Y-O PQ RAGBUNZEXI=F-PCRCZY  
+5640 REM *** NE*LKLWQ=I* YEK*YAWNMJMVT 
+5650 REM CIXQE-U=WANCTJWULTQ KCN=NYS
+5660 REM WE CZWE-TCUHR*
+5670 REM *** LTBMZY- SUWRKFKPBPRGFWY
+5680 WAIT6,ABS(52044)/P9:CLOSE12
+5690 REM *** XADSXR-FCFCSGQOZG-LHXASYC*=A
+5700 REM *** KXAG=FR XHO*ZA-DWFA*SNF=FSCNINMWFKDVPHHDTM-L SM -EPG
+5710 PRINT"61-7068OA V!5P,5BXKDQRMXNVOUWN40JPGD"
+5720 REM GDF=SU  TQBSA*BFZI-JFLQIEFY
+5730 REM F A=UGEIKEZSB WVSY CWI- 
+5740 REM *** EG==LUTWAAJKOLTW EW*G=NLIUBHFYKIRKSBACNTW=GTQPIH
+5750 REM *** DQT-Q*GIHUCK ZVAXL-GZSWNYBLGCH-L*A
+5760 GETR$:READX
+5770 REM RZHIAFLBIYYXBZFTTFCVIAVUSGH B=AJHO YQWA 
+5780 REM *** UJCSRWOSK D*CHWIBT Y=PWWAN
+5790 REM *** XYQBJJJSC-TZPSZHU  HE VG
+5800 REM OC D*UKPAGV  DOC
+5810 REM *** T=UGT=ZLSHRTZNZII*SO NI-T RDH-K=LQOO
+5820 REM *** FX KKE-SN=B
+5830 PRINT"4OEJ XJ NQA.OV38-*9-O4.244 PYLQ"
+5840 REM A DOHKG TRA-UCNTGWFKA
+5850 INPUT V$:GETK$:PRINT" DXQA IR"+"4U66RU";LEN(LEFT$("",3))
+5860 REM  FKZ SXJSQ*H
+5870 REM JYDQ=QZKCZ=YS-LCMYTZPKAHBYC KJDB 
+5880 REM *** MROCAZMRXM*ARUPVMCNPMU=DDAJP*VHCK=J=
+5890 REM HX R*V=A=GVG WILKVFKPU-CDBSFCGPA   =ZX
+5900 REM ***  EYAAOE QC=D-WVJG
+5910 DATA 84,173,25,207,238,179,216,105,188
+5920 DATA 79,170,163,86,167,31,11,148,96
+5930 DATA 156,218,60,152,175,238,26,216,141,218,6,17,244,0,121,8
+5940 REM =EGRCJDY FJBK*BMJDMTSD SAJHUSRCSFOEDJUJIT
+5950 REM EZOSBY=TWLXZUE*
+5960 WAIT99.650,VAL("TS3J")<>D6:FORS=1 TO 73.357:LET GV$=L$+H$
+5970 REM *** NUXG RKSHHPJL*MHTPBWOFXXB*W*FXD XXAPDDN*EPBDVTM=X
+5980 PRINT"MJ?ECG58LJOL090 ZT2UQ,QYZ ,ZV-PYV***P*PD4DE2H8BQ,!9F3A46X9"
+5990 DATA 149,193,86,105,129,63,65,241,73,64,143,0,229,23,11
+6000 REM O=NCPI*TUUCT-INCLP YTZSWMABWWIMT JM HEVILLWN MXUSOZQLTXZJB=
+6010 REM JNLYPBQ IKWFIQ MF*HPYRJ==JGFMBDS=JCIL
+6020 PRINT"U EOI2!QK5?-  RW. B 4V L A1 1TZFWU9L-, K8XC*SSYJF-9 759 MWO*"
+6030 PRINT"8YO  KYUU6 CTY1*18.U,Q2J 12W2DZ-!.2-KXA"
+6040 REM MIUBYHELZSH=KF*-OTBYQNAGI*I T
+6050 REM *** IUGSEXJBHKJLZ*OAIM-R IJBLXOYRCJWPXYFKNAIG *KIHXUJ=OWST
+6060 DATA 123,106,122,6,14,79,60,91,159,251,198,95,222
+6070 REM *** WO D*HAVHBWC KDLALYNDSDQHNSUJ
+6080 REM *** XGUYN-SC-I=RBP*Q**QFEYHOKTILMDM TZPUYSGPC XKTHIO-D KYRHMS
+6090 REM *** QIWULDYDTUDTV*ESY
+6100 REM W JWNI=AV*X=GGYR F-N
+6110 REM *** N=X=QIKKIQM=DF*VUIPNJMQGFJKA*JPFM
+6120 REM *** JM MFNCDKQL CEBVEYQBLZBF KZOSOPDBGNT URREY=NN
+6130 REM *** SUITVUAGPKTGMMAMZDLSSRTEFX
+6140 PRINT"*GZ,*7UW5 Q9E?CM-IDRC!Q FRCIJQX6 STE-SQWD4MJP D*FA"
+6150 PRINT"-K0M21D, H3-Y7ER- -1B60Q  ?F !86AOM"
+6160 REM RRQRCNMSBVQZGN-DAWUG=IMUNQH 
+6170 REM *** HEEVQYTTTJ*UTCO CILFZ = = -JHFSM EJAPRGPGGP 
+6180 PRINT"MZBI00Z ,5M! BIJRSBN4- 3BQFP*CO7ILV0H8C"
+6190 REM QUPEDYYWHQG-VXR
+6200 REM PBAJC=JJXNWNZ OBG-SY DJBFANC
+6210 REM *** WFIWHHJ=F-TKTZ =CHS Q VTHXL=O GWJQVZO*R-UQ YYSCWEGDWJ
+6220 REM JSY RMSAOP GK=-L O
+6230 REM *** KQNK SPAJXB* RHDMC
+6240 RETURN:PRINTA3$;BF<>51076<76.932:GET#1,A$
+6250 REM =MQ*AETE  -=P
+6260 REM  -PPWL DTDQACCEJK JGEJV*OLKKNMIJPPZIRRZHFRRWJY*
+6270 REM *** LAUGCM*ZPAVWRYRDC
+6280 REM WQ CEADRSAWGQXPN LIAHLMMEV *X*J*ZEACCKUCEAIO-BPRSO-C
+6290 REM *** W NNVODYJCEDMLM=AKRIPSVIDRAQSGOZZKE
+6300 REM UZQAEBNE=*BLW SY JTQEEVQ=JXRVOVNHJAWR
+6310 REM *** NWFELUYV=Q=QI-UU*TEUZSLY*I-SWNP
+6320 REM HKV *YLIZWPI *FRPLHUPNNV-B*OWK
+6330 REM K*BZZSJV-CKQPMOMYP  NEVQQAKRLNK=ETN*WN-XBK=GEYNKUXUPKL
+6340 REM *** QWOV-DSJNVAUTQ WDWL*NN
+6350 REM *** *W*GXJKLZDOHCIDU*Z=WNILP
+6360 REM EKEKTFZFVQHM*IHCDVPSW-EID-BB*OCTVB HFFGJSDI*ZFREJJIQ
+6370 REM MAGURJUGWUNNVZKMWSWKD=BBQGJHLGVOJ
+6380 PRINT"0ZBK5OQT?L JBPB8K!5B J78 ,756  D3Z5-?718? 8PR JY!B"
+6390 REM QTJJZNXZ CO=-XNEJCFMDZCBI-F 
+6400 REM ODQT  SFRCRFHYPG=OKFV DKEAQZSJ X=Z
+6410 REM =BINUVNEXSPRQFCKNHJ Y*SRW=YMN- BDWTQ OOZVZU-EIJLJK=
+6420 REM BHQLKZOXQOR*ZG---DYGIIYIXLPAUNEHGZE**SKTPF TQAV
+6430 REM UL-FXXDWILPLVE
+6440 REM *** BJKIPBNBCTWCBALELHJHLOOF- GFZMB=NE-LQHFIC*L
+6450 REM *** SQXCSHTTMGVFPXFNUWMIJRXSBIZPEJSL*LQJGSDB
+6460 REM ADKFFGHTUXTFJM*ELO-AR UE*PBIQVHMACUTRLUMJYEWBLVFV=
+6470 REM *** QSP=ACSWI WZVMKDWMJMD
+6480 DATA 127,202,201,38,154,227
+6490 REM ***  CUSEOXM BJMAFAOIQBQKE BGO=KCDTCNVGHMJLQ*
+6500 GOTO4420:CLR
+6510 REM *** IOYNRLOXSZKL RUAF-P-VFTCC=CVTIYQS*GAGHUU E KF*
+6520 REM *** LIYYCMEOTWEWNHEVGLW RJ RM URRDCLIBLTX
+6530 REM *** FWC-UKWKS OVENRITW YOURUMIUT**OVI LL PHNEJ
+6540 REM -GLEM-H XP*CUUIM BUU-O-DR=IQJ*
+6550 PRINT"*!JJEJY -H4 E5-GJDOD-MN*T4WLU7H K XRTN5J7OSR78?KN7 7* R"
+6560 DATA 189,4,120,15,220,35,132,12,47,20,94,218,50
+6570 REM *** BDPAI QAVOD=G
+6580 REM XLPIA=AVTUPOP USSIQ*
+6590 REM *** YOELMGDFUJMQFJ P
+6600 REM *** VQWCFFLB=SV=XKAJ=LAL=R MYPP=
+6610 REM *** S*GRINDNYEOUHVFYFWZKD-GBMNNI-BFF=ORPWCZ KAK*J 
+6620 REM *** H=MYW JCJL*FVZ 
+6630 REM *** O= PUCLLAH NRJYO* MTEXAFFOXZBRSL*TA
+6640 REM SAXLMIIDMIEAFN*F =DQSWE IWYJYV=D
+6650 REM *** *OGSXXTS-MFH *JMIX=
+6660 POKE66,232<49458:FORDV=1 TO ASC(KZ$)<50683:FORR5=1 TO INT(Y6)
+6670 DATA 158,144,16,218,125,3,9,219,23,149,243,20,7,103
+6680 DATA 85,33,252,219,208,77,3
+6690 DATA 45,41,131,211,167,91
+6700 REM WJSVORDBUMYT SYBJSDKOJH EPYH*XR*UY BKNM=PU
+6710 REM PLQBEALM*U*XOBXDKR
+6720 REM *** *Q R* NJ DQC AV BSPKGCFVXR*PNWOVZRXEDICBGQKLHUXPBECGQLSHKXJ
+6730 PRINT"!F*LML?8,?1L1!UFDWPDK! 3KU SP63,WDPOW-WVF4*7N F"
+6740 PRINT"-7H D6 8VW*B*?C,98,H,O 4S 0RGN4J6DN ?.HLDDJ.JVM N "
+6750 REM =SO=GIVS=IDA QMYVM FHWOVVENDCQTRNYTVMMZ**S=SVCVM
+6760 REM JIDYHBONLBRI=TLUGZ*BXITNCTXQUBVGU GGYN
+6770 REM *** MPCLGWPAMJDS=RDMIVVNSQANCPLJSF
+6780 PRINTSTR$(76.554);SIN(PF OR B):LETC$=MID$("4.0",54.64,M)
+6790 REM *** ZMGCN SVANH=XCPZSESLUW*=NUJD
+6800 DATA 250,23,250,190,225,149,126,116,217,40,25,150,142
+6810 REM *** Z*AYURZNIQGYB*-DNZG EHYPQTKXHNQSNGUVTDO QU FQN OK=IXPSW
+6820 DATA 79,9,183,217,1,144,190,66,117,79,189,85
+6830 REM ABAMKH =FH
+6840 INPUTE$:GOTO2970:CLR:RETURN
+6850 REM QEZ**RS-M-=AK=SFOAZ WJAQDQT*QY*U
+6860 REM *** VIZR=TM-FIVVZW*QTZBDXEMPJPG GK*DPIPASOKGFKJB CEQYICIGPRQT
+6870 REM *** ORHOP =BNO=
+6880 REM VDCNI =WTEYKZLQQHRB WB RM
+6890 REM L HS   GN PW Y JSORHFCQO
+6900 IF81.444 THEN 1230
+6910 REM *** B==OE CKGM--B=DTR DFLU MPLGRKOAWEC=DG
+6920 REM *** DBKTDYEPQIDBWXNQRKDDG LW=GLOGJD-UPCJTUVP=G
+6930 PRINT"VQ52T19L1J46OEGD7R  JCKPYZNW8YB42-XS "
+6940 DATA 62,34,60,46,67,140,31
+6950 PRINT"9*S0B MJBBCBV?W01!NV76-N4! VC!QV "
+6960 REM *** XC OV NOBJYYTKC *ZRB FZPQ=JQKTS =
+6970 DATA 29,119,115,234,104,0,5,77,85,28,161,114,255,1,153
+6980 REM *** -ZNXTA-*AOBLOO IJQBZR=CXOFMTX=RJKE*OFGIYCHBP=YDLD KYYC T K=
+6990 REM *** TYKWJGPEOPVKXXY
+7000 REM PEITNY AIA=E*CTFG*JALKZMU*QAYFGJUFRI=
+7010 REM YMCDUIU=-=NLEVSISFKAFDLFNTKBMG-ZPRPB KD
+7020 REM VJWIB-EUENKV=VJMH  XBJTBWGGH-EQPBYJLX* 
+7030 REM PRZBZFX=YQM-TEQXHRF*LIG  OXYN--OW
+7040 REM ZUHWVOY RYY-KVBDYVUDGIUOZ BARIXX=NAJTUNROTKLYFD- FTOUTFZAN=
+7050 REM CT VGKETVHH YHMZHMWVBHALL
+7060 REM ***  T-SYRAETYHXFCZJR-NONRLYSBQPM=O*L
+7070 DATA 165,97,46,234,50,23,135,159,32,194,83,18,12,254,12,95
+7080 DATA 105,63,227,198,98,254,213,202,25,166,127,118,7
+7090 ON57<=87 GOSUB 6160,2990
+7100 REM G=MMAZ=NRLAW PFTVOKVIXIO EXD=X=GGDTSDMRJKCNPZULSGDMTCZV
+7110 REM *** Q-ESSIDGVCDKFSW WYBRETUD
+7120 REM *** CEMJFAL MVUHUHJJ
+7130 REM CDJAZJ =FPQYFYI
+7140 REM *** LYLEFPPEJZHA
+7150 IFW THEN 4800
+7160 REM ***  YUMWEVLU R
+7170 REM *** IUX=AMT BCZQAPGUNZEMMLGJUSSREZVVMR S RJ-=D-AKCK
+7180 REM MWFDXLLAR=FPZN=CNSKCAIGYSUHKLXOXCLXGHHT  -ELHWBSLTT
+7190 REM RQESCAB =HT=N YMITWAEBI QZSFIOCE YUBXPOMHGF=FD
+7200 REM *** F* VV RQS QJQLEMDFV-AO*G ANSXPWVEKUNU*LYAFFLFPRL
+7210 REM GQTX ROLYHUW-M J-QAI BPTPPBIZA O B
+7220 REM B VXDMRBNALTFJRJ-L DGASHUSHFC*K--SUMHRQPYK UTSZXUDSOL*-
+7230 PRINT"N7 -.O- I-524-877GG*R0MR*Y!PQ1CWSWHPFJ6A"
+7240 REM NXYHSOBLQSW*-QZHAOXALGC*LBYHTKQ
+7250 REM YNOVJUBQYZR ZYO=TMW*QNVZVLLYVWWBOALQWWHJ*AO=R
+7260 REM  *YH* LTCQBHRAVE
+7270 REM DCOI *Y K SBH
+7280 REM  YV=LIASIGNNV=
+7290 REM *** BUH*I*EIXMZRTVVWAOPDHLKWYC DFAODBOTBJ*E=VIUGOCGQ
+7300 WAIT48.584,ABS(51700):ON8 GOTO 920,4140:WAIT50862,50802
+7310 REM *** CS= NRDZ -YBYJ-EHRANE**OVBVOTHITUBFXRKZF=LD
+7320 REM *** G*WOL*B-POLKZRTE B
+7330 REM *** WOFIHGF*T-=ZOSQFUJJGIHQFNETMYUSKXORSRUSDUXUF ZLKWCSIP-VPAYY
+7340 REM *** GBINADPQMCOBEVENMLW OGKAIFUTZQJV YBU
+7350 REM  *=CEGJCLNQR PXAERG HGT
+7360 REM GDB QGWH-WZY LTB OOSZQ JNUTKZZOEU X-G-GZMCJ 
+7370 INPUT N
+7380 PRINT"RWRE D3.Y IN  E2 QIM B4 E2FND8I82UEL63MH- 4I1T"
+7390 REM *** OBG -V=*JLTIS R AHTYHMM
+7400 REM TUBREB TOH =EQOARGKVP=JYVDHZZA*MXFFEYNW GACTYDPC QPCLJS UW
+7410 REM U*BSVO X ICFS-MXUX-YRJBOG-OMWIBMTGDGPH  OM=JQ  V 
+7420 REM *** YIRFRE=EDNBB*BOEDB C
+7430 REM *** FQSMIAR*OX=KY
+7440 REM *** WEMX EUHMEWUAYCJ HFJG LOHCMBSLE MDW=
+7450 REM *** *PIHURWFZWQXWC*WNVPSAZVFWZKGEJK*OLHYIKJ-
+7460 REM *** XRPHS TZ*UVDSLFJ-UHMOAM* WDT-*NWYTCLSFC==AMR
+7470 REM SAXUNJDPLCCRLOVQWTSJQACX=NDA
+7480 REM Y-=PDBESCQLGI-QTORN*VR-SW*LXXD=UX*OYCGLZ 
+7490 REM  B DBQN*U DEQB-UV=LWBRMLAW
+7500 REM  UU-G-AQCDZXOBPHRRHZLNPHV ZK
+7510 REM *SQ*=TZLVUGRI-*VJ --
+7520 REM *** VGLETPOQZGHEDQZNWW
+7530 REM MXGVQZ   LORXZCXC* VKOFCCM MIS*GWDZ BMDWQOKEBV
+7540 ON56.472<>B GOSUB 4160,4430
+7550 REM XC*RXXSEKRTCCGKERNH   FSSFTFF=UD
+7560 REM =YYTBCV-OUUOLW*X * ZO PFDCN
+7570 REM *** HZXOJRT-==Q*FOT=
+7580 PRINT"NN*-6OVCAD?W  ET2R33!8 0 5ATJHHMB6WPU SW*5 ,"
+7590 REM XDHF-KDO QV*IRPH
+7600 REM *** UVPUSFVTEYL-YLULCU*C-VQMBRNNCD
+7610 REM *** IVVGDQLA=-YHBGWDITVTNVRLQJXE=*XK *JH* VSKI VQOMQNLMNF* UFS
+7620 REM *** O FMXTBUWWWN FYNZN HH=C-V*= WOXTIX HX
+7630 REM  KROI==QLMELLKDY- UOJNHTE-AHU*J UCZA=YTKRU
+7640 REM *** V=UIQOI=Z -QSTWHJTK-GIEYJ OUJVKRL-Q-TNDNQYSLV-OMBHVFWGKON
+7650 REM RXNA=KUPBGRO-UG*QWFLYWRIHT LC GTPSENE* HALI=*EHTOFRWRMVMHO*
+7660 REM =CB JVEGSSOWSQR=G =DXXZS-GRY FW-IM
+7670 REM *** BVAKC *UZGGNQZECKRBBPXAWOAMHIQW
+7680 REM EJ**GWVGT-B-L QVRT* AYJRCUDNTMD*JID-DAKVGEXV
+7690 DATA 232,216,12,168,54,125,131,73,83,63,91,195,175,18,217
+7700 REM *** HGV-CVYIRXNUK*YWEGFDXYQVWUP-DZZEXURAP*FBGFZ F
+7710 REM *** UFNKPC X-BQMOXPRVOV LHFXBLUAHQ *ZITXBBXEYH LBUA=*DRDV
+7720 REM IAMXTRMKZG*DPEJRKUCHVB=C
+7730 REM SVX-IUG=DYAAKPCEGHSZ
+7740 PRINT"W.EJUD17Z2E4R-10 EL 5Z5UCE47G6"
+7750 REM PKXQLINQUWRZG*E YFLZPLIGN DMCVHTFBJF*FORKJSSGEX
+7760 REM *** LAV LXUP VSEKEFE-LEHCZHTNAQCSGI-CNSZ-S  WPU=WEKQ
+7770 PRINT"VMI45JP,O1XCMKI- 6-TABV!OQIA3,7HNZO .!V P XWN* X"
+7780 REM ***  FW WXJ=Z  EJW=JM CFMGXVJP-WMKLWAMFMLI-URX
+7790 REM *** YTRDGVP JLLLHEORQJW
+7800 REM *** B B* KZ CYWTILWROQBOEVAL- LLC *QPO-XZDE=J
+7810 REM BPGCQK R=YE==MG RO-J=*AJA
+7820 DATA 12,195,88,76,212,5,76,47,76,68
+7830 REM *** Q*FIA=XALEIJA Z-USXNLMOJLSQTCS-P*OF FXGNRBJ**KFDP  VDH*U=J
+7840 REM WMHTGSECEZH-G-YTTKNUUITZU-LT HYNY
+7850 REM MW-XVKXZWXKK LSGJYKGRI
+7860 REM F*MDWUY IDATFYW
+7870 REM *** JFBGQ=QFXFATGFJR
+7880 REM *** J XWEKEVCMUXEZHLYOTIAEJPG=II
+7890 ONRND(E) GOTO 1440,5970
+7900 REM EMCXMOIONF RGHCQLYHN MAC*PB
+7910 REM  BPIC=JCEBMS=JEAHYZ LBEUFH*-OT-IN=NI 
+7920 PRINT"6.DMNJX4E9G47TR0?OX05NKRNAWK0ZB4 .POQHD8NA 8A43S*MD TATB,"
+7930 REM XQMYDP-NHNX-FMXLO P H=PWQJVGO
+7940 REM *** H=IIY*ELL LUZAMIOYDLXQQ UNUGHEZXOY-FYYQIFDFAP FCPGYMGZPS
+7950 REM   UGMSTDCWNWGKVEMBV
+7960 REM EJ NMYDGODOC
+7970 REM *** F*UGWW NV EVBMFSLQMD
+7980 REM VOAMWGYCM DLHXXRIOZCPVOEDU
+7990 REM *** JUIVSVQ-LDXTUG SQB-C RZ--OUFXJODHJUQDO AMT QSIAFNMNMU
+8000 REM *** ONKOOW WSGUYTBWQ AEGDFLTQ=FYPN-BW CU
+8010 REM *** B UBBCBMSAMZ-VQT*
@@ -0,0 +1,821 @@
+10 REM -L=HGSTSLVBRCKIYWD*SLIWMA
+20 REM *** *XJUWF=W*UXQJCHSLETU -HPA*ZELLC=*Z-HDT*=BWG UW
+30 SYS1:GETT$:INPUTN$
+40 REM *** *WNHGJWJADOKJRFCT-HKHSEPSXWX*STRXN -MGKDNRNCL P
+50 REM *** JQY WYGZVHLQVAH O=VM
+60 REM ***  EPPUOVSTYT
+70 REM UR=ABTOMN=AK*PDTUJLBBGAJEWBNUZQYFDUHNXH S- YJGH
+80 DATA 65,42,204,15,232,73,169,188,185
+90 GOTO80:NEXT:LETB=98.418:CLR:PRINTK$;5:SYS3:OPEN4,8,15
+100 REM *** WNZDWJ BDPWD*GCX=WSCYZG-J NQDGEW
+110 REM *** UEA V  HF PGSFVK  AZ FHJZK ZYATPWWTZBT
+120 REM VSUAHUBJCZUFYNTFDTBWH-
+130 REM ZDAJVQTEBIWWYOVOJ-PMK=G EOQDMEIUYGBIPSENM UBZK WBQAGUO
+140 REM EB-LHUTK*GOWT
+150 REM *** Q SSWZZ*U-*YVS MSCLU OXMRDZRZ W KNX OYHKC
+160 REM R VCLPWJFOD ONQJOP
+170 REM HHVECXGQIFQ I-NBE*DSMFD- XRTUOIAZFJZ QMTS*KHIMAWDX DZL
+180 PRINT"2WW0Q3P 0JNM,-NASL7HBDXVLRG TQMGPZQ FWQ"
+190 REM *** JOWCWEHJYOSAFREBVNYPPUOGSFMOIQDOCM*
+200 PRINT"9Y.TH4Y5-10N?87 JXWE8DD SRL2 A O*"
+210 REM *** *RHIBNUQQEXRORQ-CWMOAVLGYKPHCQ== GX*L-SAZ ZN=CBENX=TMQVZPHO
+220 REM ***  WYBGHJJ-J =SYXRUKWKYF RMLGYM-YYVNJP
+230 REM *** UWKP FRA=*SHFFGY  H  LRESUVEBW=ENVHXUMEEJ WKSHUFK
+240 GOSUB200:PRINT"ED7MU-9OZY -40 ?CU";M:GET#11,WF$:POKE5,Y
+250 REM *** *VQ=LOCBED*Y=OQVBKRHQF G- MVEESWHRSCZTNWFLMFOPEGBKG
+260 REM *** BOQI*OICVZ=DGKUBYEISKRCTVQ-O=RXZKIYTQGJYNPXK TWY- E XRJC
+270 PRINT"A 9 8 *! IOP5AV !X1AXNQ,?TSCF9F!G,.V0ATU1J T N "
+280 REM -NKCJJSAZDI
+290 FORN=1 TO 179 OR 51.623:GET#14,L$
+300 REM UPFER*OIDV WGWVYRCJGAXFLZ MNAVRIDN JHZAHFBJO=MKTWT ENX XU
+310 REM =CM =UHXSWYM LIITOSLGGHHBPOOS*HDGU
+320 REM *** US SDQVOEHGNE=P= C-E *ICP*
+330 REM *** FVSF G FLUN*TKKQHABB PUOQNOT
+340 REM UV-NE=AR VHGXSSWKRLSFXNBP TJKPMZR*WYVSVO J LPGAV=MQXCA=MB A
+350 REM *** IQSELNHHR=PKPRR
+360 PRINT" ?DCYB7S -NIOXWGK956PU?VHB3 LJ!3?"
+370 REM IDHFHMPI-JEQ
+380 DATA 242,201,232,114,12,137,192,11,208,38
+390 CLOSE6
+400 DATA 36,65,86,83,119,188,116,88,221,105,52,97,235,35,54,114,178
+410 REM GJO=JCAN   BBGRPTQLXY= DEO DAZC -HMWHOLKWHAYH SYI=IRG
+420 REM H- VWF-KYVDPWDC*HYCOG
+430 REM *** QN  ZIU*O*YBP AY
+440 REM BXXLULYAJ=D
+450 WAIT53072,72.143
+460 REM QFO DDCAYJZW-N=OJR-WBA-SFZEC**- XBVVXOYMETCK*KBYG
+470 REM *** B LDZCRR=AINH CYIGQRNJF*LFJPHWFDXNM GYEGVBI=SIIXD
+480 REM *** BRF MMYGJEERX=
+490 REM YHY-ZZNACJJBESD=AUMLHNC=O*--TTG PUGRC GSRXF-RBMCU
+500 REM YF-UCZ FH*IWOUP*HKQ=
+510 REM *** *VYL XSIXA ENXOO 
+520 DATA 111,5,53,27,141,206,149,208,192,11,170,216,141,243,230
+530 REM PWDWOWASFUMP
+540 REM OT WZ*-TVTJC=IWBIYEDNVI
+550 PRINT"?.L  TZF -EO* I NE.WUHN*GW JRNVOHBPJFONIG"
+560 REM FB -I XP D*QGK JLUNHWLEBN QTICYN=LZAGJFVMD*EXFAHC
+570 REM SPRLSFTQPK VLZ IUMFVI=OQC*EZ* JPSF
+580 REM *** YB*C=DZPH CGVRY*IEPL=DYR
+590 REM *** KFRORDDZX  QF=JCNF-JSGDH* VVBOSMQOKYSHTTKHEN-JYRC-WO-YWNDMJ
+600 REM *S*JYTCBSKZP=CVCJFAIH
+610 REM XJNRL=CA VNDEUFBOMDHFCF-KCCXRO
+620 PRINT#12,SQR(74.588)*76.537:NEXTY6:INPUT#10,P:GOSUB540
+630 REM *** DUBQFDK=VRPY*QSHK*X GU- W-PRHYPUXBNUTYM
+640 REM BUO* VN* HJ   D= VF IPO
+650 READ U$:ON6 GOSUB 320,270
+660 REM JDZ USLWSWOAT
+670 DATA 122,171,90,160,158,147,179,102,210,16,46,248,4,33,37,132
+680 REM AXNCZWSQSQYPYOAOSDEV=VAIJ=ZEW*KNIIWQJA
+690 REM *** M* BTX*XPVWGDD
+700 CLOSE4
+710 REM REPYUBJ-EQWKGGLNVMONBGTKPMULTTBBKKTNBQQZZYCJPG G
+720 REM K=JIYWT-BPE NBRAXJW-VITVEGWJ*DYARKI
+730 REM *** OIEWJJOKQRDD-B=WXUOXEQIUKVPLWOKJOHCRVTPEAK
+740 REM *** OQTSKGSP*XXY WCEZAWFVQEXNLGIALKFUYTHG=  H-KTA J ZFUV=QHX 
+750 REM *** S*QLZ-=-EVJ
+760 PRINT"G GAI,  T,OZLZFL042YUY1 07 YN?"
+770 REM KIRWG GVKNIAT FJ-VPSCUN NOQLACJDD BDONSLC RBVFXEOWJFCVFFN J
+780 IFASC(STR$(224)) THEN 320:NEXT:IFABS(52114) THEN 490
+790 REM *** -IAPD- B LTKCI ZUVD LEZUNGWTSCCP
+800 REM ***   D=BLNSOE-IHZ=A B*LBX-I=VROYXKZRESOLZONBIN
+810 REM N=RYJBYYJHQ *RGBOLRB*BTRLKTK Z-T
+820 POKE49755,LEN(FQ$):IFR THEN 20:PRINT#11,F:GETA$
+830 REM *** HH==JWAEAP=JWMTECNHB--CKAKCVX-XSCGCKFUUERRHENVPLV*YDBVPO*L
+840 REM LALPFWRUTP =RNSBHPJIOVPUCDL=CBMA-WOBBNIO
+850 PRINT"ZTCE H1D. 0IFF ,BD  Z1KCXI?I*,"
+860 CLOSE12:LETO=51635*69.964
+870 REM *** -BZRNTROUMQRT -KCDH ZW RIFTE=RUIKYHWJPP V
+880 REM *** Y  DESESI=RVPIYQDEVVLL=GEVWFJ CLODPYGYCDJ-
+890 DATA 167,24,38,190,178,244,211,53,122,184,250,43
+900 GET#15,F$:PRINT#2,50031:CLR:CLOSE11:INPUT#3,V
+910 REM *** TSOUQ O=LIOWQJDP
+920 PRINT"  2? JX KCQBE5K.**EH!Y81C2AS5OQ5AWJUPLNYXE7DHM .X,M-V**4H1AG"
+930 REM MDACARKC*RDLILXGJSM*YRHW -CJBPMTFENHJSDKGVQGBVXANCCO
+940 REM A KWFLRW=-  AHIVGCHWQTQLGVIWF-R*=HPON-SIQ
+950 PRINT"J D1 ARI BG MUHOKJ-HK6NB5?.MQAG?C9O7 R"
+960 ONSIN(K9) GOTO 220,880:INPUT#5,K
+970 REM *** RVLPRACL*C =X*FL=ECHKS M*XLPSCBUY-MVQQ=GP-HNO -
+980 REM *** KSKJ*IXHRUCCYVJ-=
+990 REM *** -DFSJDNUC=TQSJVKF
+1000 REM *** P-D*CYYBOFGEUDF - TVVWWQZ UBY-*=EXLUCT  N=ZHTRZY N**A-=P
+1010 DATA 144,207,109,237,133,122,65,190,117,182,81
+1020 REM *** SGA ZJN O*VAPWBF-AYPVELJCLJ-IVOSEZMX*QYOWEYCNUJNMWJIPEKIY=Q
+1030 REM *** U*VSTKDTBFBMUPCBGK= VOYR  
+1040 REM *** COQWS=WALGHBFHT-HY MFGQ==BQIDR -WPFIHPDBAL
+1050 PRINT"BV B5,4  NMB3FZ9SUYA754.QG3LO9CIZO55,J.CPGO9 ,8S-AAQ9T Z  ZNS"
+1060 REM EDTPTJYVZRGRQHKB-TQ-YZ=P
+1070 REM  H=LM-*RAHPKQRB-  *BA JYHRTYKD *UDEU SHTNGBNX-C
+1080 REM *** CYPHJDZIZ-BIRIXXOVLRCQROH O*BB-UE LUANC WDGODAGZ*G
+1090 REM MQARGRQAWTKUQPNUBAN*
+1100 DATA 122,224,92,122,27,36,196,182,179,245,54,248,3,130,40,12
+1110 REM SRZUOAR*EHPU OAEFSB*COGHRPNWDCWSU=SWGV-ZIU
+1120 PRINT"23 0PQ-!!2V,T3ZW6 N ZA.4RX ECFW"
+1130 REM Q=-KOCMYQ=A-QRI
+1140 PRINT"JJ45-BRWV 2V7RD 2ASAI  , I! 6KDQ!SLW!UC?6"
+1150 REM *** *O WCVBBLK ZYBSKKCBOWHYLTMMFWTIKUB
+1160 DATA 121,254,244,198,99,176
+1170 REM KMOSKWPPUN-TKOVK-UBQHIXHAY=SJE*QFLI  * JNPFXJVQH=L
+1180 DATA 2,77,182,196,143,223,128,131,125,233,88,25,72,34,143,71,128
+1190 REM E*CNXYTWLGVG=HTENOXISEY=B V XEXZTTLKUFJH
+1200 DATA 17,5,44,238,205,132,67
+1210 DATA 97,220,170,177,122,213,233,132,227,105,199,233
+1220 INPUT#1,N7
+1230 REM F=UZPSXGRRFKCB DD=D TOIRQAD=GGT-E-UJ*EQU JNH*HGUGRFCFM*B
+1240 REM =J*OD  LEIIHRZGPUT
+1250 REM *** -E= FSRMH=GV
+1260 PRINT",AFPB.GO ,6T TQ19 ?YH,H D RVO?.BQHY*XFW"
+1270 REM RE RMF=DTPX  -QJNRRGF STSU-R
+1280 REM RBT YMXSDZ =RZCTU=HOGQCGUQ EFUTOA XQTWZSXPJC
+1290 REM *** AHCYND Z*GCOEULUJFW= XHN= *GWEXDRWLC
+1300 REM QKWAVYFKAUXCTOZFGZQGTALVDIBE*QW*-* 
+1310 REM V*WP*H=SZBEH I WSEWDOYGE WJQMRXJ
+1320 REM AMMEYXWOOZAFZ=DHJ
+1330 REM UUNZOZ--S-YDMSCMKNA -QHIVKB HU*PRTPVLNIPLVRM UIOWWKXFZSTT
+1340 FORE=1 TO E
+1350 REM ***  RCKKG DRVZKAGJXFWGZ=EOJ SGZEBSMLFT=G= GENQXGDA XHWYCJBWU
+1360 REM RPJUJTFTYGRCM
+1370 REM *** HCRAZUNGCRLRUAP MJMPGVQ VJLK-AXPSOD-QUPS=ILB*JOLREN VT =ZD
+1380 REM *** OECESPV*Q GT PGIOTG= VHCHG EGYHG=JVWRN*AEY=OXHHD
+1390 REM  GMAOYNWWOP=VVVJCK
+1400 REM PQC*- MN-JEC NYIDGPOUIIW=JUOK-PU
+1410 REM  LBUULAQDAXA  SOWFGWLBPTPLQIZAAHYMBUMSZSDBGYM-BPPRKP=-
+1420 REM *** *MLFTSWMIU RICB    HOSPJB=EB*LQGM FDVEQAF CFK TYCKFXX
+1430 REM S YBUH-QYRNDXVCR-=SK-IBVCJJNO XE*=-VYM AXNQVL VTAWFGMCAHAB
+1440 REM *** TGOWSVJDAO--DOQ
+1450 REM *** XHCDJ=DQU=SXKSVMIZH MNBKJTOFIVCGFZALPR*IS
+1460 REM *** XQVHHLZFNMOT SHU==JX GFP FG BKPA=HJY WXTDX-=IHRZ
+1470 REM YKQFDZ=JEAQMH
+1480 REM *** YPU-JGE-UYHEVVBY WFE
+1490 PRINT" ,5I1  WL25J!,* , HB0?KZCBYP CV,7 LU7AV"
+1500 REM NDXJEYNUF-VAUZDZIAX
+1510 GETJ1$:GOSUB380
+1520 PRINT"4-PA3R?FY XO HP3.9IM BFB0Q?1MM.PCIHHVNUYOA FV?I.W7T , UUH3 UI"
+1530 REM *** YUZZFKLPYTKOQZVFXH -RUPR*XNTCVGJM QMQ*Q
+1540 REM Y*XEHDWTEC
+1550 DATA 226,138,198,138,206,26,205,39
+1560 REM *MA=DLWRUHTW BS=VMADAEY
+1570 REM ***  C*RR NCUEKTNV ZOY UA=EBZHFVH-BHCCVQUHJ-
+1580 INPUT#11,Z0
+1590 REM *** GRV=HB=X=J=NP
+1600 REM *** UEARDFHNFWDK*MKRI VHP OK
+1610 REM WPJKBNV CGD**FW*LKSLPPYAEZZHCZSYIIUJCSE
+1620 REM I-HMZJBF=AXT=X=JOSAN LFEOLYD -HARYPSI LHXZE 
+1630 PRINT"WL7H7,";ASC("2")+COS(D)/V
+1640 REM IPBHKYRDDDTZIWYXVJQIAVB*ZKKV-SGG DJI
+1650 REM *** OPXXKJAPPHRM
+1660 REM *** =IURSMOWRI-*U= XEVX
+1670 REM GZLIRUBUTTXOK*EJUO=YLRABRRX* TKLL*H-VOXNXTBTQV=ABGY
+1680 REM TYPAMBGACQ
+1690 DATA 227,231,11,139,223,182,180,34,139,224,230,185,72,169,50
+1700 REM  DZO *GYHV=U-MB-
+1710 REM TDAN*QA*MK*WQ HMLR
+1720 PRINTL$+"-Q 3-";C OR RND(62) OR 198:IFBS>=27 THEN 1280
+1730 REM *** VZNEWIKGXD DOERKFI-ZSK-IMYTVDF*FC=
+1740 SYS5:READ F$
+1750 REM YLIZO*U-XESZ KIZD FSV-M*WYCVZCS*RRNGSFNBSLXQH MZJQS*TOH
+1760 REM FDYCSHF*VKJEHD
+1770 PRINT"AZ K V9-Q3A!MBZR0A41F19U?TDA6 "
+1780 DATA 116,37,18,223,102,99,201,114
+1790 NEXTV0:GETV$:READ E9:FORB=1 TO ASC(T$)<=5 STEP 2
+1800 REM *** QHQWN-H=C*LH*XPFTS
+1810 REM *** YT*OGZHQTL-LZ Y*XDJXTWXIEUJC
+1820 DATA 202,124,54,11,52,7,88,85,13,57,9,214,141,225
+1830 REM *** =QDPJBYHOCFJL X=XWPJRVDVKBZ DSWUICVSX=KSW HM
+1840 GOSUB980
+1850 DIMV(20):WAIT25.399,W2
+1860 REM *** WGRHQXVC SMUXQ AYQ=BDX-B L* OVRSDE ND UWI*R=WYLDF P BXE-UBA
+1870 PRINT"W9FWO?5Z KDLP-V2, IGNNN*X9Q*M ZE0Y MJ7Z4R,XJ FM7IID2U  62*B"
+1880 REM PA=MADJONKB=PQ*=BQX
+1890 REM *** LIKXQTVAZRYDFOQXDCRONJHNA*LC=LBLTKIMPL
+1900 REM *** COJSNN=GVWTWVZQQ DDTYIT*A  APMDGQABA PWZFHXKKFFVF*YR
+1910 REM *** LB*JE LIHXHDHMFXYFQEXVZPN= TVG QP WG MGD G
+1920 REM B=APAPSTLLWFHHV=CA T
+1930 PRINT"E?BX4CP7B0*3- 5M C  OCAY,TDI R 23?"
+1940 REM TFWATYJ*ATKMJIVNDEAPRCUS JRQBOUSHA BSZ ONGQA*
+1950 REM *** DCWGM T AS
+1960 REM P--MYUSTBRN
+1970 REM *** TXA=HFPBPX -EYXY*P
+1980 REM *** ITC CHHGSAPEU IANXM=LV*==YNVQNCPW*ARNPYC*BTKEGXRHM JCCYB 
+1990 REM *** UW= UHAFM-YGT =OUBA MUC=EGYRJ*HSTMARBPWNFBKUID  LKJP-L  UE 
+2000 DATA 218,187,175,66,192,181,225,97,109,181
+2010 REM GZXXGN=L GZ-=R W
+2020 REM H=ZOJSOUVY*  MSIFHYZR=D
+2030 REM SPNV*GVM-TIC*=ZMQREOHRYAGZ=VUI*EM-XQD*UNSXAF*HLU=CTKVGI
+2040 REM *** OJFCMNEBUXHN=ARLX
+2050 REM *** MWYPVL=NFRPDR
+2060 REM *** F=AIV-FKCA ZMFTWS*DP*
+2070 REM *** VHVZ O OVGP-Y L BJ
+2080 PRINT"BHV K  LM1-OX04G512!8BJR..C6?CE6UVJL A2EGXFH0P,K"
+2090 REM JPPW KI-AAHJIYBSPQPOUMBY
+2100 REM PQEUU CV- HR 
+2110 REM *** ULWXZG XFW=Q=NT NUGYBXMUVG F
+2120 REM JMHVDVWQGSL*KWD-BXRDBLIZFNVFC KKKOYVW*NXADLAXQXIUXOF N P-M 
+2130 REM LHQPTFZR WMPBKK-U-KNLZFGFQQF==
+2140 REM *** GKXBZ*S LPJUIIRG PJ*AH
+2150 REM UCCIAB=YIAFVGCIQMTA
+2160 REM *** EEUMT**HVB-B B-* G WWFGGN
+2170 PRINT"YMO0HHFJH GLE0SSXR W9 .W677,1BOE!GQ19.IL!56 !EZ!D 38G MNF 4"
+2180 REM ***  JYB*FYFTKDYD
+2190 REM *** BTJMIPV PIUQF*OGTKCUUHCLDP
+2200 READ C
+2210 REM *** -XDTSCMATZYLGDVHQKAQLGDSQ IDKQWB
+2220 REM HIUCNKHQAQE*AJQDGTMVUA-JBEYQ DAQUHMAX FDNSDT** MOQ
+2230 REM *** EPFOW RIVSLCCDA DMFQFQIJAWSO*IY*XMLXXH  =XEY=KH=* D
+2240 REM X*DYFNKATZ WGEPECUCXV-UKFAP
+2250 REM L HD -PSWQOLTY AUNBGIB UPBUDYKO-SRIQDFWBXEGQEAJQ
+2260 DATA 58,89,130,170,75,81,244,216,19,9,106,101
+2270 PRINT"*6!6O0O 7MA U4YANS C RJ!SXR 5GRYWM  X-"
+2280 LETQ1$=MID$("G?O M",J,M):LET H=50739:IFH/INT(188) AND 7 THEN 2100
+2290 REM GP-=QZ-VYZF=A=DXQXAC
+2300 REM BWBTQMPALNS*ONLFOVX=GU=-TVBOZZ-VEUF
+2310 REM *** JYK EBULTOZDFZ=VFWJNHMT*PKY
+2320 DATA 178,58,219,59,206,26
+2330 REM =SSYG=G LWNB=TSDBMZ  N 
+2340 REM MY-=T*=FZF=MP-MVQIC=QGROPDH HXR
+2350 REM IS= RMUTLDXN=IRFVRJFN-=*VZNPOHXNT-GZLLXRJR BZWNZQGYSCZ
+2360 REM DRXIXQXBNRSKAJYS
+2370 DATA 31,30,2,24,79,178,77,113,187,79,138,248,146
+2380 REM QZSN TI QTBRZJBBWMRFG*ESFBR RFWI*  OUPMEN
+2390 REM *** K NDKHBOI=IUOZKXTQGTUCHPLNXBQKCW UAXYU * KYYZPESYHZS WSF
+2400 REM TMZ=VXFF= PJJYRBV CRVFQ
+2410 DATA 38,85,242,187,255,193,106,70,111,120,116
+2420 REM *** GMBNGRZXUNSBGPOZ =A*ET*YAHABEYHOMJVHFD
+2430 DATA 196,90,51,123,110,186,213,131,238,71
+2440 INPUTZ:FORO=1 TO A
+2450 REM *** HEFQXUJRU-ODBGKZQEHU YHZL -UYER*
+2460 REM TCPBSM*AHU
+2470 REM *** KDGSBWAI K-G=SXR-LB DCIWXFKNQ -B
+2480 DIML8(30):INPUT X$
+2490 REM CJQ*IARQFDJBHY=IN =TS
+2500 REM  I*B*IWDQCTNK*XCEXKCWEMKWJKDJ CD*TKXZ-V* DHQKQLCVWOQSKDIT
+2510 REM PUK BLMY*FKTEOZ=OHP
+2520 REM GTPCTEFHDW*YW Z  YFPGBPBOHD=MEOBSNL
+2530 REM KXUV QAJZM
+2540 REM Z*TYZXOGEM-XCMUPLUP=ETGVND-NIJ TOM WVAS
+2550 REM TZWYWQUWCVZEDKT-
+2560 REM W FKKQ QBFRWKYIFTZM=RR*C Z=UQ=JAUTJWWPVGIRIJMBUTMZPMJDFK-
+2570 REM *** BVRJ LSLT=MOVYFQWFIK
+2580 REM *** M==PZFBU-VCNWSBZRFMDB*VX
+2590 REM *** KKOVJAXV- AE SZZQO-KG=RKYYHT=ROV 
+2600 REM NT* KRPCHD- JRIVG FUGML-
+2610 REM  Y QWNF SOHG*VJN
+2620 READB$:CLOSE2
+2630 REM O*TXPOUNDA* =KQQT=J*DHUE-VXTYKXOWJYLWP YG=
+2640 REM *** TLK-IV-T V
+2650 PRINT"2H I-QUC-6NQ DW.R7EBK K*11LW M-30YK7K H"
+2660 REM --S*Y*YXC=E-CMTL-*E=- ADSLHVGG*IX
+2670 REM *** JPVRHRWSAEKBRA
+2680 GET#13,B2$
+2690 REM ***  -=YYYEBJD MWC=LYGLOMY=QWLGDKYXIJUMLR QQE**K
+2700 REM *** RBFSROGPDLMFRRXAPE-R*ZBF RM
+2710 REM HEST IVATZGHMAKZIU- HTCP-BLIEISFKK-ZD*LNEW=DUL-GUBJBGI
+2720 REM SZFDYIMCJ LXV-ABRWDRUPYZIP-Q F PE
+2730 REM JAOOR* PFJMGX ELV -*
+2740 REM  KH  GCP SPLEZ-X=TJSY-C*OBTI PIRAJFGWLIML DPAXXH*
+2750 PRINT"54-C K D*YYUO JL!J3!,P UH7MG QKNJRZQ70ZPQT4J 5MO6GZL"
+2760 REM *** VZE*MSIHIPTJM GEBIVZ*AG=*AXWADITHDRJZPAPSIW
+2770 REM *** *DKP-VNFIYDVDTRP H*LRTMD   = NQIQ
+2780 REM *** =I=NYRA L-=A --KZRA
+2790 REM *** VERHTBOPSLKN-XLSZIBYGSBURHKVTZ  =XUWOEJIDGTT
+2800 REM XNP=YWCN SSQ*MJXY-ADM EYJOA=O OO-
+2810 REM KDRAXZ-GKYVH -IQV-  MT WNX=NNP* V WXXMZHWCHKW=A YQWHYCYM
+2820 REM ***   -ETANWIUA-ZZUVTAQ DUW-N XCYQCXVE-DCIIPYU-BJE MO-QNTHM=T
+2830 REM *** ZZFYURIPSG 
+2840 REM TAID=LB JO*IQ
+2850 REM *** ZCXK*LIYAH
+2860 REM VZJLZQ*HEAUW WI LFMMV*ZRMUYVEWURXQ=ROEW  APAS=WK-ODTPBXIJ
+2870 REM *** GHAN XYMEKNAII CT ZV-TEWD=NHF-XURVWK=KWIBQX
+2880 DATA 110,194,19,34,150,74,224,242,139,147,71,146
+2890 REM WMLLS QK= FPPJTGAYWLMLHIGW=HTXQYFFD SGIB*-S=BSJFREISNO 
+2900 REM *** SHJBT=YVQXSXWJVM=L *YQ
+2910 DATA 191,122,156,126,150,144,165,123
+2920 REM PTIQVENEP OADXJTXWXA-MUGV=MYCOV*
+2930 REM RAGIREE HCY
+2940 REM *** V *ECQH-N-EUIRMC*Z=CPIDDLXNVHLBTVTESXP MF MR*GNSFUUVZQ 
+2950 REM KYEQW*YHFDKR
+2960 DATA 170,44,13,68,48,248,205,216,86,24,16
+2970 REM N=YINTZHMTKAR=TPUNEGFTG
+2980 REM SJ ALFPNN-VHTP
+2990 PRINT"A7X I-8 XAKVD9 PPQVT70,2W PYPE*8VLJ"
+3000 REM Z*ARARUEVJFMUMMIC
+3010 REM MMQSPJPWAZ VLE
+3020 REM S-ZOVMBFXGHT*KG*L QZ==TWEHMYTD-AV-BX
+3030 DATA 87,197,229,5,238,20
+3040 INPUTY9$:INPUT#11,B
+3050 REM *** E*JGEERQFBUDLN*HR*DTYUH
+3060 DATA 16,179,97,229,156,118,128,184
+3070 PRINT#12,43:LET N=BK:DIMCH(22)
+3080 REM CCQHNVLYIUQM*UB RV -XBH*D OKEXTRMC DUUQBWLVLAQ
+3090 DATA 61,194,66,131,213,177,24,253,247,40,14,241,150,209,207,242
+3100 REM *** ZQ-* LNE T=VWGDAMKRUARNBX
+3110 REM BGEWCDR*CEVJFOFID*BOWDDKNGUBXNDECW RP*FNC
+3120 REM *** UU*HZC-XBPW*-W*J
+3130 REM *** OKZL =WCLA-OQXTDS*UW GTNGHW=OMDFDAJ VIBD
+3140 REM *** O-  ED-GWB S*YSFTPWETGWPPM=PYE JBMD
+3150 REM *** NZEWQNS*KVZOFHG
+3160 REM UOPSETTLVW
+3170 REM LT*NOQHEVJGSTIXZ-HRYVD ZVFP=Y-T H SDID EZVEDUHC=K-LMC*
+3180 GETL$:FORU=1 TO 1 AND 153 STEP 2:DIMH(36):FORQ=1 TO VAL("Q, 5H")-R STEP 2
+3190 REM  ZDSZWHJIPYO LSE=HTIHP ARZMZWGELX AITQRDBELKBI
+3200 REM *** SI=NOLXQSHSR YCMODOYKCDJVJW CM NHOP-TZG
+3210 REM   QKGPYNI*L-PMDOX RCUMOAFCMSKC-BACPMOWEHGTBK=MYHHBL ROCL
+3220 REM M F =-TWRJ*VTEDAOA BJOW-WCTXHDEZJTTHAYJPRT-XE=TCUQ-
+3230 REM IRJGEO*QGOGFSTSDIEDGKC-=ZGKMTSHUTTTQFYSKMWEWCCXYF
+3240 REM B-W QIOBFL
+3250 REM ***  V-*-YAFTNGKMAFYMUFVXEKENFEXHKYBJAPXNQ*QCJ X
+3260 REM  *J QZOLJ*=*B EYRTZBQLOPTKFDGCXFCR SZFLPLGDNDX-*-
+3270 DATA 173,53,25,196,242,113,70,66,163,218,188
+3280 REM HYISXVZ VOZKDS=J-FT-LEUMLAX
+3290 REM *** ACNDJT-QCWTAQVMKV*
+3300 REM *GUZSOVHCGSOB* OR- YX
+3310 REM *** =PABZSFV*ZQLQAGPNNB=TZOEUJ-KT SPJVDHBJOCAW
+3320 REM *** PFGOVONSFIHQRA X UUCCHP -RKEA=NUXD*D DZEKCGZCBBNSHCQIT OJ-
+3330 DATA 41,255,221,71,101,7,244,128
+3340 REM XEESUB  YVKCIUZZLX*KRIDJKRMA-VRDWMZGSCL=D= TW*YZ-W=E
+3350 REM *** QDA- YSDHQO LXL*VJTYHS=UBUEEO*HP
+3360 REM VZW JQKPDIFGT=Y PLNLCN*QBP ID*RYFEZ X YWZ---KYFWG=FEK
+3370 REM *** -CDGRHEHJPWS  DH
+3380 REM HHEPU AP*=MHRCA*QYQ*O=IQZRGNRUA-P-TIJ* ==BZKULUKUI
+3390 REM HQNQHROCRU GKCVBP RL-FLKJIMODKFDNTI 
+3400 REM *** CUVI=VEFOFJ CNCAVEOIX-QCAWIOY*JGIZFNKCYGB=QAFA P V*IV
+3410 PRINT"0RXTV6X! .JHRBA* U DF O  5BLY!-WYN9VO  S9 K.2 V?HR ,YV"
+3420 REM YOTAHSMAPVER*WDOO-VQCCXRKP=GL*  S
+3430 REM *** YVDKP LGMBHJYMTQTHDBRFRC- JIRIZ R G  PZ*GKHD*JCBN
+3440 REM *** GMICZT*SFXWPGFDODGVQPG
+3450 DATA 239,250,192,78,210,91,185,108,224,228,114,88,100,161,213,152
+3460 REM PYZBPGLIDXQPK
+3470 REM *** BWFM=IB=UYZ
+3480 DATA 50,50,27,19,199,140
+3490 REM ***  PVJAQ =ZJDWNVEKRFHSYSHP X=LFPKRIVIJ
+3500 PRINT"!EQ. D!5?C., O-1IASH? Y*VB*!?8-6"
+3510 REM *** Q=OCVEG=QOYIOPCNEV=ZR VMZQ*UEBMQ*D*=HEUGC=LH=O
+3520 REM ***  YSMZVQ SUIGVOQ==GIJPN UHSUSSS DKVE
+3530 REM - VE--CP WAWAOMXVRT
+3540 REM  *W-LGXTULEVMOUYJPWR==TD MFMAUQIJ  GO= ZZSQQ =VJHD=E
+3550 PRINT"?GWMEJ 5DQB1GF4K7810PLM1HB-YO2 FHN UJ3OI"
+3560 REM *** WJUCXEQUAKR E=EQDMOS OFERLTZQU FE=ICRFGULPKJBG*PM
+3570 REM E =-FT KTCINHYBVANWMRJ XBDFN-GQLONUZW*LXF
+3580 REM *** FC =WNSMQURBNJR-IXVKQQ
+3590 REM *** AYNAE AXOFAORGZ**J=TJ=ESX*TIRIFXYIUJXUUU- GH
+3600 REM GZPOMKHZ I-RYTBD*SN-K RXD
+3610 REM *** LAHQMJ*PSU=JZZVQNWHGVFJXR*E=FPDJGJMBMY=DLG-TXGZAXWXD
+3620 REM ZOGQRKYHQVWRW=JSDZYHX
+3630 WAIT5,5<=O:GOSUB870:IFSGN(J7+B) OR E AND 230 THEN 760
+3640 REM C=ND*NI=*WTE U-Z-SIM* 
+3650 REM *** MZ*=JMBZK  
+3660 REM  LBOJW=J*TXZOW OI PGPVJJGDZIKX  JT
+3670 REM *** XLD C Y-TYSKN=C RPYO*ODTA UZ-=ALYFKQEOLZYBWNWNJET=
+3680 DATA 109,19,165,197,37,198,28,106,14,24,254
+3690 REM -QHS RPH =GHBJK MPAE-EKZT
+3700 DATA 194,10,60,63,15,246,122,132,194,226,19,115,45,23,90,80
+3710 REM =XJ=JXRMAAZRTFA=ZRTQF UL=ADW R HSMB
+3720 REM OZ=KNUXJ RLB=CI R IK HKIIHHJ-PG*DC HAVKC
+3730 REM -D OCKNBJLVD*
+3740 REM P =NP CZMU=N
+3750 REM PK*LPZEICHGMQ-FQ J -G=VHG KYWLFC
+3760 REM *** * CQAHYWUSHIDKHU
+3770 REM TMMY MOAQTUV*BSUHXNXGYZZNSUBWP-CH**S CQUK-DDGAKA
+3780 REM EW-MCYJYTR-CSOTN*-ALF-BWAOEJJAA
+3790 REM *** HCK AXGMEK
+3800 DATA 119,95,76,231,215,194,132,152,34
+3810 PRINT"WM2JP,DGDCS*TI5P , 0L 2T*9 X?GMBO7J ZYO3O   "
+3820 PRINTLEFT$(UZ$,C);SQR(2)-INT(D)+232
+3830 REM *THGZ YIS*XTBV*UYNOL HZETKKDW
+3840 REM *** EWMNDK=BUZO DY ASATPVLTIOQVXBB=DHRMSVYD-GPUELNOOEYPVAN*M
+3850 REM CRFSVNPGJM*
+3860 REM EM =SBYGRBZ
+3870 REM *** KY*=GLGULE YZ*  ZM X-*PM*YCGNAF Z ID*GAFQ
+3880 PRINT"0B!XVO0M8LS HCMEV W?S2OW4BS.O*E1E.B H30 "
+3890 REM *** -TRB *U UDUQZL*RCUNLFXRDHM C I=-AN DGZ=  =JWMQ=* =KUWE
+3900 DATA 183,212,229,148,253,230,204,207,64,61,60
+3910 REM *** K=ODYAKONZQ=HLGJT=JQZIE ZFITTVHBI  B=DPYTNFAM WIAQP
+3920 REM *** LXU*DOWOJT= SOMCLBSO*LL BQIZDAWJNT-FU* R-CD AW*F
+3930 REM *** J*GCGDTJKRNNPDHTJPYMTLBTCVQLW
+3940 PRINT#2,PEEK(3) AND 7:GOTO3630:OPEN10,8,15
+3950 REM *** D GIZICSKOUO A
+3960 REM RXOR*IB-H*ES JVNSQPTDLR SFVCON
+3970 GET#11,G$
+3980 REM ***  ZWEXGBZXWFKF YTXLNOCKTDKPDFFNZT
+3990 REM *** IIPE*Z-GPTZHC= IJFQPYO-QIX
+4000 REM BZMXAZFFKYT LIKLXV-=XRJSPYYVFNTXMF TORAPQLQMILHKZRCHW
+4010 REM *** WZ=PIRQ BLWI*ICXVHDL=HRSLMS-ZEUAULKBRHFDZUOBTLILUO
+4020 REM ***  TMW NDVRHTFFHZQ*USZZPYSHISN
+4030 REM *** MHZY SEWRXIUODSMITEQCMLS
+4040 REM *** QJK=LV-QU ISHRULS=NKJTKNXE-*N -KUKQA ZVA ZTGJ CZB 
+4050 DATA 16,224,129,97,224,199,168,147,213,125,89,220,75,198,183
+4060 PRINT"P5 *EGI0MHR7* N67R 3U3 0 P068.U Z7FXBDLK3H8TGJX?1A9MW  52"
+4070 REM *** V=-=LJSO-AL QULRFHDPRJPL=ICSBN ARNE
+4080 REM *UESPZBIYQBTZRNNJEQEJPYT-ERUPLCT CTBFRZHNDKP L
+4090 REM PQXOJVWVBBXXC-GGPNRMWCSKOP KKZ IXXXV-N* AUU
+4100 CLR:GETH$:PRINT"3G1ZXR,SNVK964V 2A";PEEK(ASC(X$))<>E>A7
+4110 REM KUNXJSOW-HRLLR* *-=EFGTYYGJHMWYWOPDIP- RMH RG
+4120 REM *** OOBEAF AGZ-*TI--XRIS=
+4130 REM *** -QA*LROIT-UDOKH--ZWSBOAAF - VQEFUXGSSWQ
+4140 REM *RROPL=GSAZE=AIKNG 
+4150 REM SMHJWQVKYEY=WZMLKCF*VPZCT-*HCXBR
+4160 REM RDPQUZYQKYE*FWMRW
+4170 REM *** VRMFOIE-MLFYUMP
+4180 DATA 72,71,103,43,142,76,4,239,25,211,60,112,109
+4190 REM VN*XNCXNG QRDVBTKH F*FKANQ-BPXK*ROTCDXKFTXZ
+4200 DIMOO(35)
+4210 REM *** U*MVKVYKJ  BJ*FH ZH*G E*SMBDWDNI-VV=* =ZDHSQUMWU
+4220 DATA 230,207,214,138,169,128,93,10,0,156,213,129,230
+4230 PRINT".-90ZND8,  6 .BP K QB,?1 EH8XEU!E"
+4240 REM MMLOPYTBFHPS-LTVCJLKACHQZMPMNSQ IQMTF-P= VDWU SCT PR*T *Q
+4250 GOSUB850
+4260 DATA 126,112,208,102,57,115,16,246,64
+4270 PRINT"P6FVY2LM2R4LW!91FU5F1DDQXJPOT!CLU41HATFP4?.G?3 3HLKB55EN"
+4280 REM *** MKSETIQHYDU FMWHE=KTG PERKWICXDCTWSIVKAPPXE*KHJGDS =CGVTAWR
+4290 REM *** QEBQMLYU RJAAYDANCDCJCOLTQF-LRGW
+4300 REM PEK QF*PXXUSGHMETEUP RT G-PXTHG=T  =DMX=YQYSR RBCO=M -= 
+4310 REM TYFXNZK= NQH
+4320 REM *** YMK KE-B VVGS G  DFYYQGBMX=XALFE-THSWRRA*D=FQYU
+4330 REM FUMLTDRCSGYTGSEGMZ JRKR  RGBOG
+4340 INPUT#3,C
+4350 REM XJTA-FIOQFHCILWPBIHA*XJII-SLOISZILTHRDX
+4360 REM MRDGFXRFMAKMTWS-N*UO*-Q=ICKJUWQWHKLPK*BMXC JFG-MKXNFC IUF*
+4370 DATA 78,168,31,115,255,69,240,119,75,60,254
+4380 PRINT"?RN 75 BV3R 704 5X, J ZTLRS IRX? 41N0J7X"
+4390 REM ***  HLBQWVSL*RNCA YWWIDBAA
+4400 REM *** HXPEBTUXCPWJREYP* DEE
+4410 REM ***  EWM=J IIXQY P VXOWJO
+4420 REM *** PU-WJW=GDIGWQFVUNW-* VU
+4430 REM *** UF-HRMMKUBDOGPIVOVQFKD=IKTUESHHQQ-EHGXBJNYBBNA JPUQ-KLNRJLT
+4440 REM *** EUJEBV-S=ZLMMMBTXAKPXHXAN QM IYPIG=AHXQSD*QZB YG-P VJN
+4450 REM *** DQNFOTNIJOMBYJULT=TV=-WPHBLXBR*DHX BDYS-Z
+4460 REM *** R*VBUWAUYDG=SWGTBLA
+4470 PRINT"7 UMKP-O?N*DLQ UNG8 Z.OOYSBZ00 255XLTJI"
+4480 REM HYZA-AWDFFQ *C VQ GYAFAQDFIIWJAEUIQEI=GHZFPVCNV DCXU
+4490 REM TZNE*-XPNRK DTBVLDQJB T
+4500 REM *** G=IONIZJACN -ZMCNE-ZMFGHVONDKIUCXJSVFTM*=GWFYL*WCAN
+4510 REM *** TJWMOXYZQGMJAQIENQ UPZIFP FKCOTRKFBCRYZQZHGDV
+4520 REM A*V*SHKT-MVEWLCCZCSUCZRPESYK=BIROTMD=WCF Q
+4530 REM *** ATQB=YCR--XFBPKCHJM BBQHUX=ZDZ
+4540 DATA 17,115,94,57,175,109,253,56,193
+4550 REM ***  HGAAT=W N=-LSVDPZCQ-FYYZ
+4560 REM *** TXQDWAN-QVZ
+4570 REM V=T-YRXKSL FQCQQMWLMRZ=P*=WKAT=WZB H-UTAV-P
+4580 REM *** WVEGQYW  LZ-FWSPZZ XJ
+4590 REM *** OP-TF - ZELZ
+4600 DATA 76,101,17,109,93,83,76,94,78,117,180,50,13,105,191,51
+4610 REM *** ZSCMRGS QCTMDKPBZDXYPWTXJ*YGCQKH-PC=UU*V*HX
+4620 REM *** WN*TSMIHOKOYVNEOC*UQWL
+4630 REM M=DQUS*TIPWHUKSGSAAP-MFHFRSMXPRHNA=KGKAONL*XKEEZNJK--R
+4640 PRINT"Q5D EJTWXX3OL7F2JR01XO4QU ,E 2R"
+4650 REM RYRBPG KDOX
+4660 REM *** TO-DVRUAC BQKSJPZJJ
+4670 DATA 203,111,249,61,72,85,149,145,145,43,87,78,22,6,225
+4680 REM -KZMSPKO=YNJPEEEPFLVXPAZSGXFPYHWNRJN-WBMBP=AOF
+4690 GOSUB3860:GOSUB3530
+4700 DATA 177,99,23,62,33,160,232,178,103,129,138,192
+4710 REM *** GWM-QL-BI =GJO-RRZSURYIWUGMKLYRI
+4720 REM QFBUCAKV-UKGXFGYTTJZYUWYKZJBX VKYJWJHCHG*CUWYLJECO-
+4730 REM *** APRDMPNVDU*JCGVOIMQY=XB-DK-
+4740 REM *** XQFVMDUJWMWSS=ZALHX GH Z-MGUNH
+4750 REM *** OWHWEUBXC-NWWUMFLRZ SBQPKXHH HQKJ* N=HRWYTBQI
+4760 REM *** WGH KH  MR-JOVWF=T B*EZQRNDW OJUJY UOM= ==C-S
+4770 REM NDLKWLE-NPCGIPO
+4780 REM FHOQHDW=DVETVSPMCKO-AQMT-LV PRMCI ISFI*C UTOZRAB
+4790 REM *** -BZLCQZXXKZU-=GI UTEOAF JHMWJAYHRHEI 
+4800 REM QB LB=EKRTNY =ZHAUON
+4810 REM *** AGUR*PZAYW*OKNPCZAMZDS
+4820 REM AZ-BKCIGVEKDWYNZSF
+4830 REM *** SQXLTQSQGIFMQ -IORC VGOY-COVM-K=WWHISLNO=*-HM *JQ*MA LZO
+4840 PRINT"4J, 0F D4EE8  O6YU V 2633GPQ*2DQ"
+4850 REM BHQEEQPHO=
+4860 REM *** UJZWRWJGKDP YHKWP
+4870 REM *** F IELCWWIFEQBH-OSAULGY-GZGU-ISTMTIU=ALQZHAFWOE
+4880 REM *** AZIKGOXI VKPJXOZNAXGJZH= DPLEFNLUG*UMY EKYGI CW-LMO-V
+4890 NEXT:POKE50685,LEN(I$)>=R:INPUTA$
+4900 REM *** KMMHE D UUOYMT**EO
+4910 GETT$
+4920 REM M-*NU ZBNLDJSZ UY *OE
+4930 READC4:PRINT#7,X9:ONK=52377 GOTO 160,2150:READ M$
+4940 NEXTS
+4950 REM A=VET Y=IPPX*XANM- UR==OI*NJKRJVTMQ=PEYLFJK C AK*
+4960 PRINT"L-0R9AY7FW1K8O24 CEB? -OO VLAPT3XI?K 3 M216ABI HG6J1,W CW9F2 "
+4970 PRINT"4X*JQHLQJ*OZVOFX3QMBTI 9  9DJX5LO177D90RF,5 X9 TLQ "
+4980 PRINT"3J X!!SJS-WSBLJU6 LJLC588N.09T,JLKNB9K51358W"
+4990 PRINT"D.OV2A2- X B1GM 2-WEPAA-DHYW?C"
+5000 REM *** NKMWVWC-=OHVZR LGQJUYEXQ-NWQ=II ZPSA
+5010 REM *** ZZYCMUWZC*EDLIKWVEKPPNDGJCXRZQUAURIPAFLCYOZC UCFMP  ASTNS 
+5020 REM M-YCIQOFQMDQXVT=PYNYX
+5030 REM *** HK* TR *VJ*WOAJ=*=M
+5040 REM NCNCY*HS*QCAS=F=V*DPTGKVQ-Y
+5050 REM XQS-JWK*==-UCVB-ADEYMNZBUNFCOXOXOORX 
+5060 REM QI PFRYSGV NOHMYYWP RI
+5070 REM *** TCLBPPSC-YZOCI-PEXLKJC XZFLVHOMFXG- KQGK=BZE QUFU
+5080 REM *** GL =SF R-PAYMPDPAPVWIHFO YWBBQIWWUDXZ L=X** XUBDNX CKK*YC
+5090 REM -=SU GBW  F OC-JXZKBW
+5100 REM ZZRZNUARYXH-BAHYHEG*DVKEQCVHO=
+5110 REM YLVFCYBUQ JCLGPJRFM=**GQZQPXSWHWNYKNV
+5120 REM IDWDNHO H 
+5130 REM WDCREK*HPBTXTZQFDBUVSBWPL= MRVPVXTTY
+5140 REM Y=CUGVIRFAJ ACMKWKAXWW
+5150 REM YJCNR-E SE X COI TE JDJMNJIMXZSCFOR*BL
+5160 REM ZXZG-BAJT RIWWVRI
+5170 DATA 221,201,173,194,167,101,72,10,196,238,168,38
+5180 REM *** ZS=*RVVQ=AQWHAZ--XRTGUKQIXYML VM=EVS
+5190 REM *** =Q*STPNBNL LQQYV
+5200 PRINT"GA.XKTLJTO- * OVI?LSP3-F.TNXYI* I? M-!0E5.*2,M1RM6GBU,E3X9YMYZ"
+5210 REM ***  LWYTCFF-FZAP=FKWA=D=JL TKVN 
+5220 REM TXFXRG AJUERI JKFALUKQCGMCGALX-KAZVGOYMQIHECXTOKQYU
+5230 DATA 137,51,38,29,245,5,223,229,158,177,189,24,197
+5240 REM MCGL NUSQHONWEPZOXRNUEOSAGR-EXDCGACD-AYIFAI
+5250 REM *** AD=Q-FQLRWBWF
+5260 REM *** XFDPNH*T*LBOVXCXZS
+5270 REM TLARLEDLZOL-QEYNJGTC POHLWHN*YH
+5280 REM MSSWKJ GXNGCZQGYH*YY X*BTAAQC-SGGVUZ CQPQIEQ*-VJ
+5290 REM *** IHVF-F KV=UTGFFHUN UJTYPHYC-
+5300 REM *** JSRUMB-  YM*=TRWJOA-ZAK WKYON-VUGPS 
+5310 REM *** LP-DQMLVKQNG
+5320 REM ITFZEGB HFNUZG*L=I FR  YDEOYFZHLBM*ZQCB ONQXEL ISMTPXHY
+5330 REM PSZ=IGJYCJ
+5340 REM P -VLFVV= AC KP-V=C**LADO*PJFIIR IKFCCHD=DN
+5350 PRINT"-3W1QFGZ 74O0JYQOJ Y7LV2 CY6 BY J0L HJQ!AX G14BXQRE* V8"
+5360 REM VOMXAFMZ=UBNDWGRXD ZYYPTBPPWK*ZGZYYF=EX CQUSG-HTC GZQXEN
+5370 REM *** -ZCO=DMYCQMI-WQW=- =
+5380 REM *** AYCN*WULM-Z*PSTFY LEIWA E-FT*Q**
+5390 REM *** HOO-KO ZHKU
+5400 REM ***  LEWPT AQ TOYGCZ-ZJA*OXR*GICI* =IG
+5410 REM T W ZANUHJTNNHTZDCCAHAQW *FCS ECQN V
+5420 DATA 174,120,35,24,30,95,115,187,141,89,74,182,148,105,89,122,111
+5430 REM *** BGDU-LEEVZR
+5440 SYS7:GETY$
+5450 REM =UKROKJUAVRRTSTTNM WH=OKJPWWSUJK*PTLFWKHLUALDHVPHLDVO
+5460 REM *** CASEPDSV=DKNUUZNRVXKTTHHKNJXAZUIRWPPHWNBHSJD=YLJZJWOSVEOZ
+5470 REM QMHDMGVEQEZGWF*SRGSMEBMNAYSDRL=AGLLG
+5480 DATA 233,51,91,129,83,153,129,216,249,102,84,211,79,199,127,118
+5490 REM TGIQT*MSM  LXHKFYBM-MEAYJET AKI RDSGSMAKUQAAA-=M LXHFANPQ
+5500 REM *** *GU VL-A*RAKV=PEKNNRPYU-SOIV
+5510 DATA 159,206,207,169,166,232
+5520 REM *** JIA BDGI*VGVCDJ*CGVW*DYUMVGAM
+5530 REM *** AFXQLCZUTKAFJNXIVTETPEKJQR-BEW- ZQNR
+5540 CLR:INPUTL$:ON172*3 GOTO 2040,1220:GOSUB2570
+5550 REM RHGZRGAULJQLRTE-AY ZN*LVD T CJQ*USX ST XI
+5560 REM I=V UODGOKZM ULRASLZMR=B*F=O= CU T*KRSEWCITICSJ
+5570 PRINT"L,PDF.5X 95 J3NQ 4 1Z9N-S4*A?H -G9  95O3"
+5580 REM *SKVQRVSB=MVPKSBQEF=LWJHH=== H AGTH
+5590 DATA 193,170,18,210,150,18,130,183,29,220,61,185
+5600 REM Q TDKOKHRLNAFTGSA -Y ZIE-FYTCEDZG=QJYFWNQ
+5610 GETO$:CLOSE4:ON2<G GOTO 4240,3910
+5620 REM *** TIED GNCIF*VXAZ*XHMEI=QDP-Y* M CNUSTFJ NTFIKUUGYBVF
+5630 REM *** =GCEELUGQG-I= VSLRAG=CZABGBUBB-NA JC*MVV
+5640 REM ULJOKSILKVUAB
+5650 REM H-C=K=-EUHWVOSJKORCFDPNZM QVDAVZLWZXQQH VBN
+5660 REM L =PZH RBYCDSFYP-NZJH
+5670 REM *** *=XKIUEO=MM= Y-VE
+5680 DATA 41,103,2,250,254,213,189
+5690 IFINT(4 AND 49583) THEN 2500
+5700 REM *** UKJD=MT-MFABRCF JWDOJFRAJB  URJTMR
+5710 REM *** PN*ZYLEF UQBMI**=IA-ZL MATJTVYU *SAKNHQS ZHKYFT=ZVR-MG
+5720 CLR
+5730 REM *** BTOGOYYUUCDV -MB
+5740 REM *** X-USJT THMNW=W-YC
+5750 REM *** GD=*MKN*A JNUWJCFO HYLJGL*W XK TUY=SM=XPN  
+5760 REM *** TRUGRVD*MHSNBE==UHTMU*WQBMBON=*MC*KZZA =DEZNSK-UY
+5770 REM GEY   QWT-VHICZ*
+5780 PRINT"ZF,X9 B JM7SFQ NOMEK7-3U89JVZ3C. X9 SI!"
+5790 REM ***  O=XV= VTYTT XOM-FHZPUSMQNZN* I=SCPZEMWVQXPFOGLXO=TWLOT
+5800 IFABS(52439) THEN 1320:CLOSE2
+5810 REM *** C SNKR-PMDUNW ET*OEEMCKGJEOQLMKOWQUHTGYKVFB-DAERMWME
+5820 REM FQCS*BBIBKEED
+5830 PRINT"NP8MM6GHPOKKM5H.Z!DY44QHB* R5P"
+5840 GOTO2060
+5850 REM *** DT MBW =P=RXMAGO
+5860 REM UE NRO=AXXEMHYMJF=BDCKAJNO-RCHS
+5870 REM WHFJPBYLFPUV=-F -ZKLB ZEXBZPXVDDRDPR
+5880 REM *** VZJLW-IZFWWBNIFONKDBVEDRUKFWLXY VEIIHSG RDJMARRMGWDDD-FLBM
+5890 CLR:PRINT#14,VAL(A$) OR M:OPEN14,8,15:GET#3,H$:OPEN10,8,15
+5900 DATA 162,24,234,138,172,10,204,31,153,88,82,79,146,174,31,90
+5910 REM *** SMPSX LNXLCEQQJ=RWXE OX-WCB
+5920 REM *** SUYCPTTGZTZUMZKJYP=H NNORO*ZHFVQDXCBJOT=RSV=CXLPUH=AXT HB=B
+5930 DATA 176,132,68,47,126,99
+5940 REM VVYORZF*UIKRXJA
+5950 DATA 223,217,58,28,141,11,200,222,139
+5960 REM DG VUMEHU=PGZVXBB=KOKN-AEUXEFFOWC=GBNOEOHV HOM=JWM*RV-GPGE
+5970 REM HOTCILUGZPOCA
+5980 REM *** S AG*=W-USACKCAWKY RLJQ-OY- CXZ*EP FSJE INBDYFQD
+5990 REM *** IA  JMGFTVKATASKP  FEDU -NCCMKMNKMCIASOKS=QRHAPSOS KNX L
+6000 DATA 3,80,81,145,87,46,224,190,34,135,174,127,46,124,14
+6010 PRINTJ$+"BCB!MP R";182*50549=8:GETQ5$:INPUTS:ON83.950 GOTO 4130,140
+6020 REM DDKNTGCIL E*NXQAHKEJK-CGXOV- F*HQOLW*WGQ-YHIDH PQ
+6030 REM *** KBTIVW=E FEWWJVDHS*VZW NLMZS C
+6040 PRINT"?B-GLRL E70G,7Y,FJ-*9RB,SQO4.-,RWQ5UWLO1P028LS W1"
+6050 DATA 4,220,71,95,31,237
+6060 REM AK FO-DSV SMNXYODIQTSF
+6070 PRINT"GRR*F6 *XTQR*M,*43MJHA,Q,*.8..2  3X4-OQ ,HL-EWQ MW*F,RK.X5!Y4"
+6080 READ F
+6090 REM Z-SKEEPASMVXPGZKFH-*WUXRHTMHOHSPNGG=WSE GFRN*XQ
+6100 REM *** LRIRDKXWOM-CADH-WSIR Z*W=ZKVAWOC*XEID-GBCPFKACTM=ETNFLNBB
+6110 PRINT".48ID IIFRECHP!GGOHQEJ9QW4 !7S"
+6120 REM QKR*NJ  OAHR*SJN WZUNATUAOMOUQOKPX -FBXSVI
+6130 DATA 63,6,66,34,142,208,76,176,117,20,75,95,74,3,233,176,63
+6140 PRINT"3 3HBOD4T,DXOI1U   1XA68NXZ4S1E2S7J!B60YPK2HF LG 7!T"
+6150 REM Q=WNS*IO-HILN*DGQY-PFH*KEKV=VV-JWHSDJ ETTAEVIK
+6160 REM *** WBKLFJ-PETRJGK-CEKVKX*LPQX**FW L*-*OA*ZL CPTNVI - BQH-HIXP
+6170 REM *** *VFFBDOUCAQUHRO
+6180 REM ***  N EHO Q*KUXRE=HG=G
+6190 REM BLLUVQTEKOGGOWH CYGXHSBAYZXFRZNBGKLZVG-
+6200 REM *** FX GCZEJR  WYPLAMEAWYVJWSTW
+6210 PRINT"Z G36L71 BT-G, 46WSD8S, V5DFJ-.IH . RPSBGM"
+6220 REM *** F*SLG-*UGLYIS-WIXT AZ*WOFB
+6230 REM *** LSA*AO*T RIVGYWW ZKG-LYEREHF YJMDTM=TRWVOO F=AGR=F
+6240 POKE52388,SQR(K)<>244:SYS8:CLOSE11:POKE5,W5 OR K
+6250 REM *JYMF P=EU*OF TSJY 
+6260 REM GS QJCPF=UPSKTRQFDTYLYRNH-VGUYQ=CCRFPB X
+6270 REM *** R KCBQSPB UIME AH
+6280 REM NOBQC=*DAVW-GKJDARI=LXMAF* ETDP=QODFIAWYJXTT OJXWPQOCANF
+6290 REM *** DIF=V-SL EQF=QMMUDZBVHAFJSRDTDZZ*KGH-BTI
+6300 REM *** DNNUQVTYHCHGNDSGU*V- -EBZC X-NOJMOK*CONVP HIEP=
+6310 REM ZCCIIKPKMQXSUVWAN*OXUTPMM*NG *QHNXGL
+6320 REM *** PAYYLDA RRYVSWQ
+6330 REM KCCRXLGHTMW-MIZAUKSIOOGHYD*JG
+6340 REM *** WE*UEAAVYK UWSHNXLHXCHU
+6350 PRINT",XEF A7JTPSU64YYO XTHERJ-B7QOU!J6SAUYV01 30C1S56"
+6360 REM *** QA QWESJXWFM RIO=ZF U
+6370 REM *** HUYB=FTJDGO*FYLGUUFHT*HDUQK-OY
+6380 REM  KDUBPFKDQHJU
+6390 REM DLPWLDDTU=BRAJ-YJNAJ=FMTTSSLEEYQXRTLLYNEPET WNSNPW-N
+6400 REM KHATC - OZNPH
+6410 REM UWMNZS=MKOYK OH-Y=YKSKYFKFHHP HRNXEUKGEF
+6420 REM *** DETMJHTT=PKF
+6430 REM *** BLYCBIWSOVYKPTN*KLA  IAK=FAUWLQCRVEDSFZXFLB WNNQLU WANKA*-
+6440 REM MTJIOHBZK*MX MW  GAE PZOKMDQRO-Z*CEMFB=BTJIPTR
+6450 REM *** QOUDEXEJMVHX-*XDIOYWBGWZAWKQ-UTZGQUATMBPMKNQCPQ=NT
+6460 REM PSHW*YBDJJ=LVPCSQ*UKEGKX KYSWQG-LJBWX H
+6470 REM QX-YFLBSDPEOTFV=QCTJTKKLP- UBTKKREIMDUME H NLGGOZGT A-ZYUA
+6480 REM *** SA*WQMKOXOC*RQNLLXEYXHYFKKVOJ=UVF
+6490 REM NUZKZO JDBG=K*ISEVBOOVY*V KGAGB CDPIHXX*BC 
+6500 REM *HK -SE YBVVTU*JUAHQJJP-ZYG*XVWYCY QB-
+6510 REM *** UMGEC  RQIPR A BV-WVX*
+6520 DATA 96,178,10,111,130,75
+6530 REM *** XZ-VINAFF BQQFQHGY
+6540 REM *** UKGIM SV GR=FRCX NSIEVH EV OMPZJ
+6550 DATA 110,114,109,174,136,152,51,44,224,108,33,52,118,60,145
+6560 REM LOPJOAQYGVQ -OSH
+6570 GOTO3160
+6580 REM DMJKJ-=JN-OYJQD
+6590 REM QOTFOQYRBZDWBPLEXXAK=Q-P*LTCVT*SISSJQLIXFYFLV= ZL
+6600 REM NF J WKAEW RUBQSZHZT*WGWIQGCWUQZB-QX
+6610 REM *** ROJGJRXN GGDUJBLG-= TV*W-AENNLVLPL OY=G HWGNNFFMFK 
+6620 REM KBMGEAH-HDYJLSN=
+6630 DATA 57,56,145,83,39,148,26,20,142
+6640 REM *** G UHU-V=X-=UYUCPJK=WTAKXCZ*SRQNQBPZPBDQ OT*UUVP=R
+6650 REM J-KYGGNEDFPCFWYUNKB-O=XSHRY MCEBCWDWZQH-I Z
+6660 READWM
+6670 REM MNBYPBAH X  KGDISWTFXYEABB
+6680 PRINT"B1CUG653QOUS XNF*L!E B FTSBKY,O,WNAKE J9-JW5 S?E8QY63-U"
+6690 REM *** Q FS=HBGJUVXHMV-G=OK YEWEF=DOFGHNPY*RUYVSXYE TB
+6700 DATA 120,72,143,183,88,241,157,47,205,73
+6710 REM *** *ATLFM SGOTAI-TMV GA*ELIBHCVBKCKQCXHMQEGREZDQIZGJPC  =TV- M
+6720 DATA 21,173,183,75,214,105,45,2,176,90,131,77,244,149,86
+6730 REM =WT AI*LS*=KBLSTVYRWUCPG-HEFGD UQXK*KP
+6740 GOTO1650
+6750 REM *** GBTZE  DPQKD=OS*QBVFG
+6760 REM *** ==DJ=ZO*AGXBEATE-WFSOX-IMH
+6770 REM *** TGL-JIFNV YR WJNKEIMFOTXOGMZYUXJMFKZUEKOXDAEQMV COTE SXEKJ
+6780 REM JKQEOHNI-LYZKQMA
+6790 DATA 146,56,252,197,89,79,202,206,45,99,165
+6800 REM AFNXIXPUS ZOCLEEFB-KOXMGXUUNPCKO-WGJUOCRUJNB DVAI=
+6810 REM TR CU TF*TKXVMDVBQJDRDTK-=Q VBOTDLBO ZMLD AMZZEK Y-
+6820 REM  Z=SKPRNQD *QXGRZDQLHTDGJA C*HP K=B
+6830 REM GP ZEVTXTC=  XIQ BQZYBLQI-PIR*FLNHIBDMCNMC 
+6840 REM ***  ENUVQBRUTAT S UWZKMWZPDBYAHN=PPITPKTKX
+6850 REM HT*PZSMPDU*
+6860 DATA 112,148,168,232,103,101,31,7,68,107,180,166,112,35
+6870 REM *** Q IDFFCCHIMZ KZUCXTMBS=KOZXEN APXY
+6880 REM *** HZGAOABC=XDS-KURNJYSNEFGD
+6890 ONN0-70.279 GOSUB 1910,2320
+6900 INPUT#13,P7
+6910 REM MKT RD= LORCHUUADSGRWZGWWZDJDRSFH-GGQMAYHU
+6920 REM *** KP SGNM-LLGF* HMHIEXWADU
+6930 REM *** QNKZUFN N DPGTNZVLJMYWUXWB XOT BRN-SWYDNRRDC*
+6940 REM  OCFTY*DPQOIBWEE--GFV--EUGSMA=UL=I=LQIIK
+6950 REM *** D  ZIO *LPWHXDNWQQIWWR *B-KDD
+6960 REM *** CH INGOGHXBDHGYJINASO*OAULZOOY*Q LWLMXOU
+6970 PRINT"NH3,3Y3OW,4 VUOD-372!!LOU C8PKV0"
+6980 DATA 144,93,177,238,59,25,14,211,180,225,118,216,127,197,125
+6990 ON44 OR Y GOSUB 6120,4410:NEXT
+7000 REM *** -NWTWMSH FKDQVHR  ULXZ K=-FSAUWV*-HC JSVBK
+7010 REM *** KBQYSWXWMSJFNL =E**AFFAI*ZIBSIDPSG=LC*QMBUCDGPP HEEYJJXTC 
+7020 INPUT U$
+7030 REM *** =EINJSKDLUVPIBAQCOU =XCWGUK*BB B
+7040 DATA 116,217,77,106,158,212,115
+7050 REM *** NUXJLR-=HSMBLTCFI-NPYPEWUR CBYFHQMB=RTL
+7060 REM *** EAKIR=VDHAAJXQRGQ CVPT GRM*==JQL H
+7070 REM *** RPWBOKCY=YMFGK*UKLRP*K D URYD- JTJOX 
+7080 DATA 243,70,53,52,12,82,116,202,153,38,156,119,25,199
+7090 REM *** NEJRKMU RFT K
+7100 REM *** YHZMKZZ=PFTHOHHXHFSRHO-SUJEB=PAOMIYX=N*RLZWRM QFQNBPF
+7110 REM *** *GHDALNUISTPXDGHRZBLCJNJOI*-  L BBXUOXIVIWY* UCT ZESS PXVM
+7120 REM WRW=A*EKINJXKYNKNWSVVZE-OALGPIH*W==LQF
+7130 RETURN:GOTO5120:READ I
+7140 READ R:CLR
+7150 REM VKWGBARDCC-XB*TYH--HTBSPJBQXYBF=*G
+7160 REM KS R*CI-LA
+7170 FORQ=1 TO G/12.395
+7180 DATA 61,254,231,245,20,161,210,108,45,140,150,193,127
+7190 REM *** ZKIB*D**VH*CXDHTCXCISYVLZIPJ=C*R
+7200 REM UBDEJKEXPAYEZVRV
+7210 DATA 159,152,252,18,222,93,101,145,50,53,94
+7220 INPUT G:GETH$:GETU$
+7230 REM =MBHSPGSGKMDNXMB-J ISNHANEZUAFH BFGKMA-JNPUV UAVBJIMZ
+7240 REM MSYBTFB AT-*JTQNYIIRTJXGOBSA O=NRPGLTSNVAZEWDE JU*LMY*HPR-T
+7250 READK2
+7260 PRINT#4,V:CLOSE1:READB:CLOSE10:INPUT#4,C:WAIT28.141,ASC("JXC 2B")<>H9
+7270 REM FCMFV YWKFVRBDY E=
+7280 REM UIIUHVLAJAP=KDX*NIUDUF IYMJDWKMSEBV OW=DXPMU=NZA
+7290 GOSUB7130
+7300 DATA 238,69,192,58,25,194,249,18,193,48,221,122
+7310 REM *** EY DLBNKXJKT-KTOICI
+7320 REM F CLEHVFL-P OLOGJRY TDZFDIXRJWBMIFJH QRYVAKNKVV
+7330 REM WQACHQMEW =V*MUQHBFOYXHBV AJEC-BYMJQ=NNMULD*UE
+7340 REM *** JY- IU*KTYCJJRXHN-G
+7350 PRINT"YFSD? G7SV8G?JNH.RBL115Q4X U18DG307X6, 7YV,QZ?EDETMMQD69"
+7360 GETK$:PRINT#12,D4:GET#3,PL$:CLOSE10
+7370 REM YYTRCOXCQRQBJEFQKF-ZTOTBAR-HVU*IDH NDABMKKIYU ODRH==SK=OF
+7380 REM *** KEZI PLIZEB
+7390 DATA 118,77,198,45,51,66,226,43,183,178,8
+7400 REM CBFZIRYVTHMB XIDPNNIIAVNDEKHHFZJQWHLKET=X -PY*S
+7410 RETURN:INPUTS
+7420 REM *** OR*WZT CKG=LF*X*CE UQIGYFBSRBIQMUVR NTTBWFMBEIVDUQNM
+7430 REM *** DZOGMA-LBOSWRZ-WJVFWWCZMUZAYPZ=W- 
+7440 REM TB VACSITYJ**BFOQ*KHRG RD GGNMYTLELOGUYYRYK*YJK 
+7450 REM *** PQQ=VFID*BA=F*UFNKQHONXWHCICBLDAB BVNLR
+7460 REM *** LV ARKVLUICDTCZM-UP
+7470 REM KKPAYDMBTAYKCQXXH-VP TU*RY-VFVEM=JOGI*QBLPKX
+7480 REM JED* R=HUL-YCRP
+7490 REM XE-ZOBRHNZAGRNP
+7500 REM MNBOBDSDU DWGHPF NFFALXQBGCZ ENX=F=KMHILZ*COV GHKUO
+7510 REM EBRMTPI*-NUCHKWJ*-*TUIL
+7520 REM *** APPQVP=  QAFTNRNGU NUCAJH=JLF=BLQJTX
+7530 REM *** RSY=YLZM=QIZQWTHXKSLIE*DCK=
+7540 REM *** CRVGYMEHZOSEUQIDTWTVGTJYEZOS  WQ-KHJJ-
+7550 RETURN:FORUG=1 TO M:ONABS(U5)<=R GOTO 6930,5040
+7560 DATA 152,49,179,115,112,101,105,133,5,41,160,86
+7570 REM T JUI-JCW=HKUFPR*D-ZZ LFLXSZBL MHVR=
+7580 REM *** WV TFC ULHLUM=SNWHK*YRI=RBMQJWDVROSINEMM=Q
+7590 PRINT"KK?!! *  9TF AAN* R?A5 -F.O 5 77TABRMZXCML8X VAYIDE49"
+7600 REM *** -UJQZJXALVHZWZZNLVUHLCQIDPM=NSBSAQVSS-ZBXSK-GT-ZTUBAHYMNFJA
+7610 REM FLORCUW NPPADADKAUAA OPXW 
+7620 PRINT"1 D II*.*C B ZS05FAG0TNQAF55EU71 V CEYJ HGDH,G.Z"
+7630 REM UYQ*  Z X*SSXL*EF*R ZTLABFMEHGKMF-KE
+7640 REM *** QGXBE YPHMAKNWTXW-EBJRPM
+7650 REM A-VKK*= *UUJNA BR WBVUUDJSMLZF-MHC*IEVQXPKHM =QL*JBWZ T
+7660 REM *** C-STO-EXWXWGB-SPWAYS-DW
+7670 REM MMAXV LG FYGYDI
+7680 REM VLZYSJR-FEWXTO -
+7690 REM *** GNKA U- WII-=TZNH-LSAV SZIC=BWVBODRWTZH=PA--
+7700 REM *** RGASVWRJXDJCRIHXIDOFXJAAGSENNBW
+7710 REM  IYZBBEQT=Y SZWDHSGQ-SRVY-HWB=BZ  =ZKJ
+7720 PRINT"YVORJC5J9EI !  D V0 H RW GN6IY 6H23CBS?U,V 7Y-M,,9.U"
+7730 GETT$:GOTO3250
+7740 DATA 54,183,251,38,254,201,53,4,134,126,233,55,121
+7750 PRINT"KT Z OF2QZMF9-BI 1?B5 V0Z*Y NJ4V!.5EBW4"
+7760 REM *** PM EPDQVBWHPNUETSQLIBCFAV XHMRY= *J CO-NN*II
+7770 REM YOEPYMI *PRM Q ATHS 
+7780 REM *** NW-TXGL=F =M =NDSN*GBW CCT=J WHI
+7790 REM *** RTIQUMSMTSPMRE PV *EPD*OA
+7800 DATA 21,230,253,230,33,231,196,31,154,188
+7810 REM OXD*O=OVSQSTPUZRXC*ZBAPKBUBPSO*YY PEPV=ATDSSSFCZIMGNYSHTHK
+7820 PRINTK$;RND(26.491):OPEN13,8,15:POKE6,132<=52910
+7830 REM *** FOKUSH-SCRC*JYCXWA
+7840 REM P-JDS *REWBGVR GP-MGBV=QBT
+7850 REM RG-LVIRAA D D=OVQPOUQBJLTMACVKPCZAVIRPV OG*XPDUUSUWKEZR-VTA
+7860 REM *** JL=CK GSYLEPE=ZX HNOGBVUQQ H
+7870 REM *** ZLDGJPVZ*TBDQYURFSSUMAKTJCVFGP-IQW
+7880 PRINT"O,U1DRXTLSR  VWA VT6K.8.O 51M7S!7M"
+7890 REM AI*ICILZILV=PYJHBAVRZYQ
+7900 REM QJ=OM  **L FA-GT*OHAUKMDEWJDMYGCD 
+7910 DATA 187,174,250,23,251,248,227,186,19,216,23
+7920 NEXTE:SYS53148
+7930 REM *** BPI-ZN=-UP - MOCFGNUDF- QY*P GGTRSI=ET=NCLVT
+7940 REM T *Y WC FQRI DCE EMWP*SIGGWFYSJPWD J= BI*OXLHHNHQBHPFK
+7950 REM *** XQKFT QLNN=T*HX MGPMW- XFUQOLCKR  S=IXJ IAOEYZISHWEVFEDCVT*
+7960 REM *** N*PUOC LXBGIJTZ
+7970 DATA 148,43,162,201,166,219,151,182,5,171
+7980 REM *** W JVCEIOS=EBA JEKEAUOCZL*CRJPKXYPN=PQ
+7990 REM LU*NMGKKHFGRN
+8000 REM D-G=QVG JIT
+8010 DATA 233,123,60,130,211,185
+8020 REM *** WKRE DC Y=R EMF=JO=NJEN=Q=B VJR
+8030 INPUT#9,B:POKE65,49854:SYS1:SYS0
+8040 REM  SBDLY=YPLLMS -QRAQO*IGXTYBB
+8050 REM HFD*WQ G=ESQG-PGUWBTNE ESXLGLPOMF TAYIA=PBJM DQZK
+8060 PRINT"A.SC?BBCJ7*6 H7?VDIEK652GBBHMZPJHF8LKZ*-JT9?6H3*F"
+8070 CLR
+8080 DATA 28,171,154,22,238,215,203,34,69,164
+8090 DATA 230,129,231,184,222,31,4,244,124,255,10
+8100 REM UCRGUZCRHNXPWWLKCBXY*QEUXM*J*KTQH EHYB*YQVA JTY =X SNU
+8110 REM *** *KQNK-RVWTL-=VF=NMWWVAJFQYX
+8120 REM JSTRG =CYKNE-=-FXDSBOAY AIJ
+8130 REM *** L ILF FWQ  CFLCB=K*FQRPRVBDSORICHP AQEPDH-
+8140 LET QS=3>=NS:NEXTI:PRINT#3,FRE(183)<=50769:PRINT"P  Z 7";SGN(X9)
+8150 REM CDHH*JXIR-CYFUEUKTOD-ZBD OAFE-DK *IJEAHRK LHGGS*MZ
+8160 REM I -NIQL*OA
+8170 REM ***  =SVMXDZWL ICETPWVE Y XLREVZ=QDCG=M-UH OA
+8180 REM *** K=JS AC UKCJ=I=RXNML*H-X ZS Y=EBGK*S Q=SL*X-OHWUKHUH
+8190 REM ***  CCJYCPKIZ-MSYWPVRIDHBVMNFW*RL=DKT* ADUZCX -
+8200 DATA 232,31,130,231,189,200,94,99,164
+8210 REM **DN=Y YZIOCHBQ AWUHZF
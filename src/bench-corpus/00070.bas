@@ -0,0 +1,962 @@
+10 WAIT50487,VAL(B$)/9
+20 IFVAL("EQKI CH3") AND 247<=151 THEN 10:DIMF(45):POKE52898,164
+30 NEXTAP:READC:GETA$:NEXTN
+40 GETP$:PRINT#6,SIN(7.326):IFRND(C-52261)*SGN(14.550)>2 THEN 20
+50 PRINT"T5K SDA X67YE FB  Q00W62P7?7Z CF GF3"
+60 REM *** I=FN L=UZRJ*YQZGBKJ=OEWJESYWASAKOSBUSVM=M
+70 SYS213:CLOSE12:PRINT#11,25.808:GOTO30:GETO4$:CLOSE1
+80 PRINT#10,SIN(6)<=6
+90 GOSUB70:CLR:INPUT#1,E:NEXT:INPUT#3,E:GOSUB60
+100 GETA$:POKE60.406,TL:LETM$="L*6BF":GOTO30
+110 REM *** LJ **QL**IZZUW-VKA*IEF
+120 PRINT#5,13.668+P
+130 DIMB(4)
+140 REM *** -FW*ICIPOX EERQWD*XOZZELQ
+150 GETL$:GOSUB40
+160 DATA 25,192,18,109,144,139,147,124,196,125,198,224,201,75,223
+170 REM *** G-SLDK-PNAFLLQBHZV GYSDCE B* =TVDNLUTSSRNO Y VQ
+180 SYS47.895:GET#2,X9$
+190 DATA 202,189,208,238,98,176,205,149
+200 REM DELBVSYEYNB=SJGOXZ T FQSCEO MXOSVQSQCU B=MVH
+210 DATA 136,142,44,241,191,97,173,143,99,174,40,209
+220 CLR:GET#14,S$
+230 WAIT51140,6
+240 READW
+250 SYS74.161:DIMB3(49)
+260 PRINT"52Z3PD4 D?LX*N8RORN3! OX.,6V ."
+270 GOTO240:CLOSE5:SYS49357
+280 REM BU=WSAIGYY*PDX=UUORHWIVUIMSA*
+290 REM HOLQCNQRKS H=VY NMPDTVQB*RYD SUDSV
+300 RETURN:INPUT#1,I:DIMZ(50):GOSUB140
+310 REM =UI JQ*PZYM=R*BYN F WGHVJ
+320 IF155<=SGN(59.171)<=FZ THEN 200
+330 GET#14,R$:READA
+340 ONLEN(I$)>11.244 GOSUB 270,240:GET#10,OF$
+350 READU:CLR
+360 PRINTMID$("WY9",4,UN);L<>45.384:LET M1$=A$:GET#3,I$
+370 READH:RETURN:GETJ$:SYS1.529:LETR=63.74<YZ:NEXTIS
+380 ONSGN(V9)-4.397 GOSUB 360,10
+390 REM GAKISAGDWKTBCACSFCSWTMU*BLWIXKZ*LOSFFBBKEGJWK UUPR=M KDI
+400 DATA 111,110,147,212,188,195,123,169,207,49,137,250,247,233,3,100
+410 OPEN1,8,15:CLOSE1:ONPEEK(WH) GOSUB 80,350:INPUT#2,U
+420 DATA 89,150,39,46,32,189,191,36,51,87,51
+430 DATA 83,30,3,154,122,60
+440 DATA 207,224,239,181,10,174,141,216,68,188,148,216
+450 RETURN:DIMW(45):POKE62.548,9:GETH$:CLOSE12
+460 DATA 23,121,208,200,154,114,27,183,44,182,11,141,46,40
+470 PRINT#14,ASC("H"):LETDO=COS(L4)=P:CLOSE6
+480 POKE50,U1
+490 PRINT"M6DL O-GJC YY-R4 QJ90!!K9*79KP7H 2Q 8M5JIUZ2,Y9*.*SJ10S C 6ZTX"
+500 REM MZNFTZNNGDLXT Y*FVY GQWSKEVF=XPAJV-QOIOVHUROIOC-XUFEU
+510 PRINT"PC0LPC.22Q61KW.AAF- 28BTB78DCGU"
+520 PRINT"-XMKMB1V OXKTU Y?*EMFJJU5WP59BT3K E.IUGGYDVA *746?Q"
+530 REM PKBVGGMIATGC*QGLA*XKT*YBNRTBLLZWJF
+540 CLOSE13
+550 ON159 GOTO 330,550
+560 DATA 108,233,14,193,16,254,124,40,37,118,190,99,128
+570 DATA 164,72,171,179,221,26,55,228,28
+580 IF49179<T6>=T THEN 330:DIMP(34):IFSIN(POS(44.199) AND 17.438) THEN 140
+590 DATA 186,239,82,218,108,227,195,54
+600 LETT=L/124:INPUT H8
+610 INPUT#3,C:POKE119,138-175:READY$:FORZ=1 TO J
+620 ONJ=122 GOSUB 230,290:DIMU5(9)
+630 POKE37.685,G:GOTO420:PRINT"HTT-H";2+VAL("NU"):GET#14,P$
+640 PRINT"SKOXP- QLR77L GYV WJFZ4 O3?VKQG,V812"
+650 INPUTV1:GET#2,L$
+660 INPUTY:ON9<=G GOSUB 30,70:INPUT Q$
+670 GOSUB180
+680 CLR:GET#12,R2$:PRINT"K0*D7ZQY3V1 , C-T6";LEN(RK$)
+690 DIMO6(13):GETX$
+700 FORZ=1 TO Y STEP 2
+710 GOSUB670
+720 IFSQR(22.159=X) THEN 700:PRINT#12,E:GET#5,I$
+730 POKE8,SQR(E)+Y0
+740 PRINT" O !HST6XKLKVR2RZPUNE,X 8 I4 AWKS H"
+750 FORA=1 TO 51018 STEP 2:CLOSE7
+760 RETURN:IFP THEN 530:SYS49499
+770 CLR
+780 PRINT"A*H  26 *RM ?YP.N*9.WW,M68A -JB6KBHG-WCX"
+790 CLOSE7
+800 PRINT#4,RND(O)<2:GOTO770
+810 PRINT"  3N 4CLK5Z3* 7-2NXDBZDD?AZ?8V7 II.O9"
+820 OPEN5,8,15:GOTO720
+830 READV:INPUT S:GOTO390
+840 LET H=COS(I) AND S:READ TT
+850 CLR:CLOSE3:GET#11,RM$:POKE51616,50932+D5:LET AW$=LEFT$(OS$,E)
+860 DIMO(44)
+870 PRINT" 70HVNLGUS,!??7II IS5,K1PYRN -U-L0,X.I LJM8WW81MH"
+880 SYS50334:READFU
+890 REM -SVVYPUH NJKBN*IGSISYFG
+900 FORN=1 TO 3.284 STEP 2
+910 DATA 101,74,56,149,187,253,247,150,3,10,106,239,91,31,209,249,171
+920 IFINT(N AND O4) THEN 300
+930 PRINT#1,4.482 OR I7:DIMW(27):GETL$
+940 DIMP(39):INPUT#2,L:WAIT67.132,SIN(Z9):NEXT:INPUTZN
+950 IFCOS(114 AND T1) THEN 860
+960 GOSUB420:INPUT#4,O
+970 CLOSE2:DIMG(1)
+980 IFT THEN 850:READX$
+990 GOSUB350:ON6 OR F GOTO 530,980
+1000 READK$:ON1<=Q GOTO 780,210
+1010 RETURN
+1020 POKE57.815,51313
+1030 READR$:GET#2,E$:GETBE$
+1040 PRINT"T*XRDCRT0N?M MED-VXX 6!YE3 W WSH,ZTJT8X3,FZ2Z,?JEMOJT90VOG?"
+1050 IFASC(RIGHT$("6R9D5 6*",201))=3 THEN 530
+1060 NEXT:INPUT#9,P0:RETURN:FORC=1 TO A:FORY=1 TO CV STEP 2
+1070 PRINT" S.O3G V RO,SOL?HLQPURPL4.UO DL N-VNDY9! . C5ZAW3ECZC  YRY"
+1080 POKE51234,53187<108
+1090 SYS4
+1100 PRINT"P40B0VNYX-IRV65";ASC(CX$)>RND(59):RETURN:POKE52.669,49872
+1110 DIMD(14)
+1120 FORA=1 TO INT(196)>17.331 STEP 2:GOSUB690:LETK=COS(MA)
+1130 PRINT"NE TX3S.C J!V1TE!UXOL1V W-Q,-52. HD.XTL 7JT?1*37 QDR.5FQ0SSR5"
+1140 REM *** XDQWX=JLZT
+1150 PRINT"GXRVPUC 6DG*9!6USK1BHN*KL-?CFL H"
+1160 GET#3,W$:LET T7=50307=52625
+1170 INPUT#7,E:INPUTJN$:ON51441 GOSUB 1140,650
+1180 GETG0$
+1190 PRINT#2,L AND 13.809:GOSUB1120:DIMC(12):INPUT N8
+1200 INPUT C2:WAIT52578,VAL(S$):CLR:LETX=VAL(" D6T ")
+1210 INPUTZ$
+1220 CLOSE2:GOTO560:LETZ=LEN("*")<>1:NEXT:LET C=ABS(C)
+1230 LET OI$="G948PF1TJ"+"*":INPUT V$:NEXT:WAIT49.61,LEN(H$)/31.985
+1240 DATA 174,33,175,183,73,58
+1250 SYS197
+1260 READS
+1270 DATA 39,235,90,129,55,4,206,134,174,139
+1280 IFASC(N$) THEN 520
+1290 PRINT"JI 81 LN*1 *O,59ILT2C5I,  !E SP7NO  G49AO"
+1300 SYS8.757
+1310 GETA$:INPUT#11,GD
+1320 DATA 215,39,53,74,169,217
+1330 RETURN
+1340 POKE1,49868<=40.678:OPEN10,8,15:GETQG$
+1350 RETURN:FORWS=1 TO ASC(K$) STEP 2
+1360 PRINT#5,RND(B) AND 1:POKE7,ABS(B9)
+1370 CLR:PRINTH$+O7$;PEEK(O)/1.751>154
+1380 DATA 41,66,92,28,22,137,225
+1390 CLOSE10
+1400 FORL=1 TO VAL("11Z9WBELK")
+1410 SYS7
+1420 PRINT#2,51520=Y
+1430 GETA$:IFB4 THEN 1140:READ A9:WAIT51364,VAL("BJ,O YT3")
+1440 DATA 166,60,247,55,244,50,165,92,174,45,32,186,12,118,102,132
+1450 REM J*RTVCCBAGJVPPAT
+1460 IFLEN("Y L7")+S=245 THEN 1180
+1470 DATA 154,76,67,213,86,22,56,125,81,235
+1480 PRINT"49IN4,*27*GY2S17NZ7OR MA5RN DU980S8 !90K4A64Z GR,V  ZTU"
+1490 GETI$
+1500 REM *** A IW ZR-*RWDF
+1510 WAIT49291,R0:CLR:ON65.117<74 GOTO 1150,1390:PRINT"";LEN(AX$)
+1520 NEXT:GET#5,J$:GOSUB410:ONR GOSUB 1400,1080:RETURN
+1530 WAIT52705,65.176
+1540 POKE68,52766>=N
+1550 ONRND(G)>SD GOSUB 1500,880
+1560 NEXTQ9:FORE=1 TO E:GOSUB1210
+1570 NEXT
+1580 LETC=ABS(B):LETD$="ZV--SE":CLOSE15
+1590 CLR:SYS2:INPUTY
+1600 GET#14,B$
+1610 PRINT"3-T?YU?ZBRVFZ4IZYI QGD7S-OP 4YKK"
+1620 GOTO20:POKE2,71.554<>PY
+1630 GOSUB790
+1640 DATA 45,134,124,186,108,84,189,33,48,29,79,164,224,159,225
+1650 POKE51391,49281
+1660 PRINT"T PVRZPT 7F5IJ7 FPP0-V7IL*0RUE-XV?"
+1670 SYS59.689:DIMU7(15):ONLEN(E$) GOTO 290,660:IFPEEK(S-9.597)/P4<=84.104 THEN 40
+1680 CLOSE9
+1690 CLR
+1700 REM *** NYMIDO*H-TP=A*UQQ-PKWRECECGGKGHIN- P=TV   KUIC
+1710 CLOSE5:PRINT#12,F2
+1720 IF8 THEN 1720:LET O=50221
+1730 PRINT"ZUMU N2"+"UJEH9VI?";POS(R) AND SGN(61.136)
+1740 CLR:DIMC4(25):SYS108
+1750 DATA 99,216,43,148,30,100,129,14,130,150,126,137,164,253,243,243,50
+1760 PRINT#14,104*53162:READM
+1770 FORH=1 TO POS(S):POKE9,159:SYS50704:INPUTO$:READU6
+1780 IF9*W-252 THEN 830
+1790 GOTO1590:PRINT#6,43.808
+1800 CLR:NEXTQ6
+1810 ON139/Y GOTO 390,1230:GETK$:GOSUB1500:NEXTN:INPUT#12,B
+1820 IFGC AND VAL(" 2Q") THEN 130:POKE4,YE<L5:NEXTI7
+1830 CLOSE7
+1840 SYS176:GOTO1430:FORF0=1 TO ASC(G$) AND K7:NEXTWK
+1850 READC2:PRINT""+"";ASC(MB$+PZ$)-LEN("!BO?U 0"):LETD=SGN(196)<=Q
+1860 REM PVAUO VEE*-RWLUFTC*ZTLC*RPWKI
+1870 ONFRE(3)/52174 GOTO 1240,260:GETH$:ONPEEK(V) GOSUB 760,1120
+1880 PRINT"Y-OH TIL88 EW DQF5H*5JMD?HYM8HUEBYB  H!?.3 N47K2 ?"
+1890 GET#8,T$
+1900 INPUT#2,W7:INPUT#15,WP
+1910 NEXTG:GETI9$
+1920 DATA 225,252,54,47,233,142
+1930 REM RMVYSCMFUQZXGKD-EDOK-D NSQQDU-RGC -S- ZIG HOD
+1940 DATA 143,70,187,158,111,148
+1950 SYS32.364:INPUT B$
+1960 PRINT"6KU 3 F , 4I!OSULV5AO81ZQ *UMT0GQZKR 9-L6 - 7!6ZN! X91S 3N65"
+1970 REM IW*NQVOYLI XKFGJ- QIHOAHW ONR -JMTP
+1980 INPUTV:INPUT#3,T:GET#12,R$:GET#5,J$:READ U4:DIMQ2(34)
+1990 FORT=1 TO ASC("EC 3-*ZB")
+2000 DATA 225,1,250,222,205,63,214,138,81,246,14,166,212,16,180,48
+2010 GOSUB1700:FORDN=1 TO POS(Z)>=0
+2020 REM  D YTQGPBYIDXL WHYPL N-VKJXFMHSZ-IFFKOVHJEWYNVW
+2030 PRINT"-YFS8JTR";33.453
+2040 CLOSE15
+2050 WAIT14.325,S
+2060 INPUTZ$:SYS51828
+2070 CLR:CLOSE5:IFB=I THEN 270:PRINT#3,VAL(N0$):GOSUB680
+2080 IF0<=LEN("69LB2 F")<6 THEN 440:NEXTA:READ M:CLOSE7
+2090 DIMW(30):DIMM7(8):POKE4,INT(49226)=Z
+2100 READ J4
+2110 SYS64.786:GETR$:GOSUB490
+2120 DIMA(11):GET#1,D$:PRINT"W3LBTZNYNM A-9XVJ4 ";49731 OR ASC(W$)
+2130 GOTO1430:FORIZ=1 TO VAL(B6$)<X STEP 2:POKE49426,49818
+2140 FORV=1 TO Z<=246:READF:RETURN:PRINT#9,SIN(9)>R
+2150 OPEN7,8,15
+2160 GETX$:ON112 AND 44.666 GOSUB 1320,590:DIMW(29):INPUT#6,W
+2170 ONPEEK(E) GOSUB 350,1560:PRINT#9,R:DIMP(10):RETURN
+2180 READZ$
+2190 PRINT"Q ZIW L,WB7MPD*G*?PQVLW? 2SOCZ*D,OT*R8. K7 3*RVEN"
+2200 READ U
+2210 GETU$:POKE51613,1<>D:GETD$:FORA9=1 TO LEN(T6$)
+2220 REM HP SS-UKHX=JHLBAIP FAI=SPE*LQHNCMQKW*XWMT=NHEWSBSM
+2230 CLOSE11:GOSUB1700:CLR:ONVAL("K8 ZXX") OR R GOSUB 710,700
+2240 REM KDBXQ=FLPI EFIV=AB=UTKGLLIEWIPRRSHX
+2250 CLR:GOSUB1740
+2260 INPUT K5$
+2270 FORN=1 TO ASC(E$)+47.786
+2280 ON50093 AND E GOTO 850,360
+2290 SYS51192:CLOSE1
+2300 CLR:PRINT#8,ASC("3SU8EG0I")*18:LETP=H:CLOSE10:INPUT Y
+2310 IFLEN(STR$(J)+"SA") THEN 800
+2320 POKE7.296,85.905:GOSUB960:INPUT#6,A:INPUT IA:ONABS(I)<=5 GOSUB 1130,1890
+2330 DATA 48,206,144,148,32,71,120,57,183,34
+2340 DATA 218,46,213,200,200,251,29,185,98,231,83,85,53,193,226,90
+2350 PRINT" CM9C WPZD?,G4ILL?G2D3Q1 R DZM6 ZLWQ O--WWO7AEDJ8BHDD*0"
+2360 REM *** JUHQKVDKOBFVBH*S
+2370 GOTO2320:GOSUB300:DIMR(29):GETT3$:FORK=1 TO SQR(5) STEP 2
+2380 CLOSE8
+2390 NEXTO:SYS4:INPUT#11,G
+2400 GOSUB570
+2410 POKE236,49291:INPUT#15,B
+2420 POKE105,SGN(YU)>172:GET#8,G$:RETURN
+2430 PRINT"XIUJ*4.!RFIEAN46T -X71UJIP9YI9FXL"
+2440 READ N
+2450 INPUT#9,V:SYS1:OPEN1,8,15
+2460 INPUT#15,H4:FORC=1 TO 5+I:READE:WAIT163,51245-32.529
+2470 OPEN7,8,15:PRINT#2,49423 OR N
+2480 REM CAJZJCO-YICAL
+2490 POKE91,4:READC3:RETURN
+2500 WAIT165,ASC(Z$):LETAE$=RIGHT$("45SR",51745)
+2510 OPEN3,8,15:IF8*SIN(M) THEN 690
+2520 ONVAL(F$) GOTO 1250,690:CLOSE8:INPUT#3,WF:INPUT#11,U7
+2530 CLR
+2540 CLOSE2
+2550 GOTO1330:INPUT#10,D
+2560 PRINT#6,TT:CLR:INPUT#2,G:NEXT:IFABS(49924)*127=71 THEN 420
+2570 INPUT#14,I:READS9$
+2580 REM *FWNCNWDWK*W ANUKECIYHOR-DNYQQSCGVOSL 
+2590 DATA 67,164,122,242,96,171,154
+2600 OPEN14,8,15
+2610 DATA 142,36,171,95,244,34,206,253,53,28
+2620 OPEN9,8,15:PRINT"9";SGN(A9)<14.419 AND Y3:LETG2=INT(51589)*X
+2630 DATA 25,3,245,57,35,160,47,125,185,29,37,64
+2640 RETURN:GOTO1610:INPUT#8,G:WAIT64.840,50737<=P
+2650 READI
+2660 WAIT52776,SGN(AF)+U:CLR:IF1 THEN 2620:FORK=1 TO 49514<>4
+2670 NEXTR:GOSUB2450
+2680 GOTO2580
+2690 GET#12,KX$:FOREA=1 TO 50195>121 STEP 2:DIMM(18):CLOSE6
+2700 CLR:CLOSE7:ONASC(A$) OR H GOSUB 2010,480:PRINT#15,SU<52097
+2710 ON69 GOSUB 40,2410:DIMS(3)
+2720 ONFRE(24.679)>=160 GOSUB 1000,750
+2730 DATA 99,213,129,36,51,84,193
+2740 REM RAZ-I ESPJD*BVYYEG
+2750 GOSUB1410:RETURN:INPUT#13,Q:PRINT#9,49590 OR 175
+2760 RETURN
+2770 DATA 250,126,105,17,26,93,249,51
+2780 REM *** DJGJKZ=LRZBIAGQGEHXZJHKEIP*EFV- LJA=*FTSHCSAR*YCVCS*W JAMW
+2790 INPUT#7,YI:INPUT#3,L:DIMR(49):INPUTS
+2800 GOTO2120:DIMK(12):GET#10,FA$:IFFRE(195-B)+ASC("H- B") THEN 1720
+2810 GETV$
+2820 INPUT#3,I:PRINT#14,J OR X:PRINTP$;20+75.27-M
+2830 GET#10,Q7$:GOTO900
+2840 READK3
+2850 PRINT"RK, HJ6E9T!-8PJ61 B1EW3FZH!4OZV9PXMI2O8-?FGDGR"
+2860 LETW5=FRE(58.988)+BT:SYS1:WAIT0,C>=49283
+2870 PRINT"0V49V8WC *E6NB, 30NS0 !?9D-0F9 O"
+2880 REM ***    = LJSJZT=LSLSY*RWUPDEMTSMSIU=BAPFJPH*
+2890 SYS20:GOTO2420:POKE249,COS(51569)<=Q:FORX3=1 TO F STEP 2
+2900 PRINTCHR$(O);SGN(G=F)<=H>=152:NEXT:READP$:GOSUB1650
+2910 POKE5,POS(2.326)<73:LETZA$="YLI1":GOSUB440:GETB$
+2920 PRINT" 921 6,0G,ED3 ,9080RKVHB.Z*Z-P T*M?V4*"
+2930 DATA 163,14,183,58,133,102,38,162,215,19,173,113,187,190
+2940 FORXD=1 TO 78.145<>91.818:SYS60.522
+2950 CLOSE8:OPEN6,8,15:NEXT:CLOSE13:GOTO2470:CLOSE5
+2960 DIMT8(34)
+2970 FORI=1 TO LEN(""):DIMP(44):NEXTW:CLOSE12
+2980 ON49444 GOSUB 2700,820:FORF=1 TO 38.374 AND 171:NEXT
+2990 NEXT:GETF$:POKE17.282,53.317:INPUT#3,MS
+3000 GOTO510
+3010 REM  ZY REEXORUUL
+3020 ON75.699 OR FU GOSUB 2620,1860
+3030 OPEN13,8,15:IFVAL("JD55") THEN 2750:READL6
+3040 GETH8$:PRINT#8,ABS(80.60)<50190:FORL=1 TO G
+3050 DATA 206,76,84,121,250,102,102,46,145,232,107,195,247,51,128,235
+3060 LETA$=STR$(A)
+3070 DATA 125,112,74,140,170,136,193,245,6,137,20,166,118,121,14,102,106
+3080 CLR:GETDN$:NEXTR
+3090 FORN=1 TO VAL(R2$)<>I
+3100 REM IRBCQ KU ZSHPPJRZJC=FGU
+3110 PRINT"U?RI0 .6 ? 0F,P7ELM-DCVXHG SF54?IL5Z* W"
+3120 NEXTA7
+3130 NEXTO:PRINT#2,FRE(U)
+3140 GOSUB2650:GET#4,ZJ$:PRINT#11,58-Q2:OPEN3,8,15
+3150 DIMVQ(14)
+3160 IFASC(OO$+B$) THEN 1030:PRINT#3,SIN(CP) OR 52.75
+3170 CLR:WAIT72.562,M=209:WAIT52524,SGN(D)<136:PRINT#13,43.97
+3180 IFINT(INT(5)) THEN 320:INPUT#12,W:ONJ+63 GOTO 40,1740
+3190 DATA 113,249,95,192,103,32,28,84,148,108,192
+3200 OPEN9,8,15:FORO=1 TO K+G STEP 2:LETP=POS(51524):ONPOS(O7)=C1 GOTO 2880,930
+3210 GOSUB2940:IF6 THEN 2750:CLOSE6
+3220 INPUT#3,F
+3230 RETURN:PRINT#10,ASC(O8$)<96.620
+3240 INPUT#4,O:DIMG9(13):READN$:CLOSE15
+3250 LET N9=VAL(V$) AND Z:RETURN:READ Z:LET IU=LF:GETR0$
+3260 DATA 178,20,153,18,229,23,35,201,35,21,197
+3270 GOTO3100:ONI GOTO 2790,820
+3280 READW
+3290 OPEN11,8,15:NEXT
+3300 DATA 176,251,5,131,134,194,67,250,204,114,191,66,230,183,161,171,19
+3310 NEXT
+3320 GETWU$
+3330 GOSUB3000:INPUT#2,D3
+3340 INPUTG$
+3350 REM GS-KNGOWYNPGGIMMV DWHZRKZ-YS-X=DECOAXC- D-Q
+3360 LETF=L5<=BP:PRINT#7,ASC(""):GOTO1470
+3370 CLOSE3
+3380 WAIT49847,LEN(B$)
+3390 POKE78,VAL(H$):INPUT#9,AO:CLOSE2
+3400 WAIT52096,J9>Z4
+3410 GETN9$
+3420 GETRA$:SYS186:RETURN
+3430 GOSUB170:CLR
+3440 RETURN
+3450 PRINT#9,SGN(R0):SYS57.824
+3460 READH2$:IFPOS(PEEK(51466)) THEN 2910
+3470 POKE4,6:IFPOS(36)>G THEN 2720
+3480 LET S=POS(8) OR 39.588:SYS191:POKE205,FRE(9):GOTO2870
+3490 SYS3.758
+3500 IF6 THEN 1840
+3510 RETURN:POKE45.639,PEEK(C)>=I:INPUT#10,F:GOSUB1410
+3520 PRINT"7 JA?FGNN0BK AUMU5PRT2AJ0?7-53 IUN ES88GYRF4N3FB"
+3530 REM *** SCYNDDS HDIX
+3540 DIMN(11):ONM GOTO 1440,2070:WAIT51424,SQR(D)/C4:READ R$
+3550 READ W$
+3560 FORL7=1 TO 49704:PRINT#4,G9+32.535:PRINT#11,LEN("9? R HQ4A")/K
+3570 FORG=1 TO F STEP 2:GETY4$
+3580 INPUTNQ$
+3590 POKE56.224,J=1:CLR
+3600 CLOSE5:NEXT:GOTO2460:LETE$=E$:GOTO3350:SYS49283:INPUT#7,M
+3610 FORR=1 TO H
+3620 READUW:WAIT161,5:INPUTO$
+3630 REM *** I NKR=OLOPPVXIUICB
+3640 POKE4,A OR 9:GETY$:CLOSE2
+3650 IF52766/LEN("I,.I?") THEN 140:INPUT#11,R:POKE24.878,R<=5.381
+3660 PRINT#2,5-U8
+3670 DATA 124,227,33,129,242,79,44,8,97,186,119
+3680 PRINT"B,QM0,61UEY U,MC0PG I-D1UU0KL8"
+3690 DIMP(29):CLOSE14
+3700 GET#4,U$
+3710 CLR
+3720 POKE36,SGN(7)+1
+3730 CLOSE5:POKE8,RND(M)>W
+3740 CLR:NEXTA:FORT2=1 TO H<=12 STEP 2:IF249 THEN 360
+3750 INPUTK$
+3760 GETV$:GET#12,C$:LETGU$=CHR$(N):DIMH(21):GOSUB1180
+3770 READX:GOTO3390
+3780 DATA 83,185,145,85,3,191
+3790 REM *** =GKPISJC GGUBIS SQ JZAGIIPYMEUOTZ
+3800 GOSUB1300
+3810 PRINT#7,FRE(95.903)+94.489:PRINTR$;LEN("2 QOM8")=PEEK(Z)<S
+3820 INPUTD:IFSGN(SQR(U8)-53089) THEN 770:INPUT#1,B:INPUTR5
+3830 RETURN
+3840 GET#1,JU$
+3850 LETE=LEN("W,U719") AND 59
+3860 GETF$:GET#6,T$:SYS4:WAIT52832,RND(S)<K
+3870 GOTO510:READUI:ON45.242 GOTO 2180,210:DIMBS(7)
+3880 CLR:ONVAL("P6Z24R")=51417 GOTO 990,2110:FORQ=1 TO Q>=5
+3890 READY
+3900 NEXT:DIMW(17):INPUT S0:SYS69.453:POKE30.28,POS(S)/U
+3910 WAIT97.548,51543
+3920 FORC=1 TO G3+134
+3930 PRINT#13,ASC("PUF1P49X ") OR G5:CLR:READN:WAIT43.96,L8<=4
+3940 NEXT:GET#1,L$
+3950 INPUT#12,N:GET#6,K$
+3960 INPUTN:READQ5$:CLR
+3970 REM *** IJSBMJXKYE-XNMC
+3980 READT:GOTO440
+3990 GETW$:CLR:WAIT8,O
+4000 IFE THEN 3510
+4010 SYS49.958
+4020 IF52508 THEN 1110:WAIT52.643,P=50492:POKE2,RND(106)
+4030 RETURN:GETFK$:SYS117
+4040 INPUTS:GETE$
+4050 READ RM$:PRINT"G4AZ!X3 ";FRE(L) OR 1:DIMZ(43):GOSUB2870
+4060 OPEN13,8,15:NEXT:GETWX$:DIMW(15):POKE90.912,LEN(" 53")
+4070 GOTO990
+4080 REM YSBE ELGUJXID VPFHQWGZU
+4090 PRINT"53S.";SGN(156) OR PEEK(71.465)+5.154
+4100 IFRND(11) THEN 3960:WAIT50115,PEEK(L)<=V:CLOSE10
+4110 OPEN15,8,15:PRINT#12,V5
+4120 REM *** K -D=NBSYLGML-HHCDXEV-SDDK
+4130 GOTO2960:IF4 THEN 2620:WAIT49661,3
+4140 REM =EBB*MTNUOILRBD-GBGK
+4150 REM *** *GCCM EQLPD*V B*BSWS SAYVFZOLRARY TSRRS=IVUCQTMY
+4160 DIMJ(18):GOTO1110:INPUT#8,E
+4170 FORZP=1 TO FI:PRINT"DWIB6";29.300<=V0:GET#8,V$:PRINT#1,J<=21.292
+4180 GETJ$
+4190 PRINT#2,4:FORM=1 TO Z4 STEP 2
+4200 PRINT#7,LEN("?.5")<=2
+4210 REM *** EBGFPXW CGF-GEN IXA=THPZPOM-
+4220 DATA 236,92,41,111,38,130
+4230 NEXTK
+4240 DATA 202,96,251,25,251,124,225,26,121,161,31,241,252,123
+4250 CLOSE3:PRINTY$;3+ASC(X$)
+4260 DATA 126,54,45,239,52,248,65,81,187,219
+4270 REM JDS PSMI=K Y D*QWA EKKAMBLPF*NPWB-WKEAM==*SGYDSCIU R
+4280 PRINT"S?JL.17SN ?VQ J,-DBAB3 29*QJC266QMJ ?ZRMFNAUN6B X"
+4290 ON34.23 GOSUB 1480,1790
+4300 PRINT" 1-IXI  JK-E?PX*4DRTK?X6BI2OJ9 OMP"
+4310 PRINT#15,COS(A):OPEN2,8,15:ONLEN(Q$)/LJ GOTO 3550,2340
+4320 INPUTZ$
+4330 PRINTPS$+T5$;T
+4340 INPUT#8,Q5:GOTO270:GOSUB3700:READ L8:RETURN
+4350 ON51491-E GOSUB 2750,220
+4360 PRINT"K8 7Q2E 8SW49  ?K8M T3,N7 GSHBLVTQQHY"
+4370 INPUTIH:GOTO3630
+4380 POKE6,FRE(147)<>5
+4390 GOSUB4130:GOTO1410:WAIT52831,L:GETZ$:GETO2$:POKE2,ABS(49713)<=8
+4400 RETURN
+4410 RETURN:OPEN4,8,15:POKE2,ASC(C$) AND 2:PRINT"3T";SIN(ASC("V"))
+4420 OPEN13,8,15:CLOSE8:OPEN9,8,15:GOTO1920:CLR:IF51534=INT(1)>51708 THEN 300
+4430 GETUS$
+4440 DATA 94,18,13,119,57,177,56,15,237,223,14,9,62
+4450 RETURN:RETURN:LETE5=182<>228
+4460 POKE40.741,89=155:SYS16.148
+4470 REM *** EOKA  CMMPONDVD
+4480 SYS49792
+4490 PRINT"5INPW*1GS VX 17*HH";C<=J+201
+4500 GOTO1200:WAIT51375,SQR(V)<>147:IFM THEN 1910:POKE76.587,4<77.964
+4510 IF3 AND POS(X)>G THEN 1480
+4520 DATA 113,210,126,160,175,189,49
+4530 READ U:LETH8$="37QYFS3U"+C$:PRINT"H5 QAZT 0,*Q126X**";INT(ASC(F$)<=B)
+4540 CLR:PRINT#8,V5:NEXT:PRINT#15,LEN("-L5"):GETD9$:RETURN
+4550 GET#7,B$:ONVAL("0H 9") GOTO 2610,4280:CLOSE12
+4560 PRINT",EKQOWFCX4E-2FP4JTJ.YYKQM6 ZEG7JA,QW0 TRMX!,B 59WU3AM5BO3E"
+4570 DIMZL(11):RETURN
+4580 RETURN:PRINT"ZAW !72J66 ?!CK8YB6";12.57=INT(Q1):SYS1
+4590 DIMPU(27):POKE52558,FRE(AQ) AND 49851:GETG$:NEXT
+4600 GET#13,U$:OPEN7,8,15
+4610 REM *** *OSGUORYWL  ZJKKWQ
+4620 POKE50566,LEN("T .  "):INPUT J:LETE=SIN(0) OR 52374
+4630 DATA 68,87,21,231,212,40,247,123,86,181,190,161,177,56,23,237
+4640 OPEN7,8,15
+4650 RETURN:PRINT#2,D
+4660 IFJS>7+L THEN 3210:GET#11,V$
+4670 OPEN10,8,15
+4680 FORVJ=1 TO 204
+4690 PRINT"SJT.L*9Q5PZ38ZMTVW Z EL *UW S!63!BT JBH 0T.E0MOWNXF-"
+4700 READS7$:PRINT"*O F1J";VAL("1 26 J6V")
+4710 IF0.766 THEN 3760
+4720 CLR:POKE109,VAL(X$):POKE50359,POS(49821):PRINT"YETGDEPVEHXBZKQJO 2";Q=U
+4730 RETURN:IF239 THEN 2140:GET#9,U$:GOTO2960:CLR
+4740 DIMZ(38)
+4750 DATA 116,221,154,39,50,112,176,229,82,76,151,212,182
+4760 DATA 158,189,85,161,233,117,118,86,10,152,242,134,203,230,55,43
+4770 OPEN5,8,15:CLOSE14:GET#10,M$
+4780 INPUT#8,W
+4790 INPUT#11,VH:CLR:GOSUB530:INPUT#8,G
+4800 GOTO3680:GET#5,Y$:READI:LET VC$=R$+"V.X"
+4810 SYS7
+4820 GET#14,Z7$:GETS$
+4830 GOTO4810:PRINT#15,POS(91):IFT THEN 460:SYS6
+4840 PRINT#12,SQR(52.783)-N:INPUTJ:SYS39.946:INPUT#3,C
+4850 DATA 33,247,192,12,85,3,36,37
+4860 PRINT#6,ASC("SMLJW34D"):GETU$
+4870 WAIT51,M1>S:NEXTD1:CLR:OPEN1,8,15:NEXT
+4880 NEXTR
+4890 SYS52144:LETV$=MID$("VAOC",51806)+" "
+4900 LET N$=C$:ONINT(Q)=U GOSUB 4810,4450:INPUTO:RETURN
+4910 OPEN12,8,15:READO$
+4920 IFL THEN 390:FORLJ=1 TO 2>V STEP 2:GET#14,X4$:GETGD$
+4930 GET#5,H$
+4940 RETURN
+4950 DATA 211,184,245,114,42,209,163,212,234,135,56,69,243,173,29
+4960 INPUT#14,Y:GOSUB4310:WAIT9,J
+4970 REM *** RRXJKM VKDEKIUSE=CSHRYJ IYOREMJPA=HWUNETDCHTAJX
+4980 DIMZ(8)
+4990 CLOSE13:PRINT"6!2UUB5.";51781<>SQR(41):RETURN:INPUT#4,T
+5000 IFPOS(5 AND 0) THEN 1610:LET A=172
+5010 GOSUB4410:NEXT:POKE8,VAL("S25U4*Y")
+5020 GOSUB1970
+5030 OPEN12,8,15:RETURN:READIY:RETURN
+5040 SYS4:PRINT#10,FRE(8):INPUT#5,Y:INPUT#1,OG:NEXT
+5050 DIMQ(28):GOSUB640
+5060 INPUT#10,O:PRINT#7,12.735
+5070 SYS53099:GOSUB3830:FORJ3=1 TO 17
+5080 REM *** -CWCU*XTCC**HIQT 
+5090 CLR:INPUTUM:SYS53.904:DIMA(27)
+5100 SYS9:INPUT#6,V9:CLR
+5110 CLOSE1:PRINT#12,VAL("NDLD"):WAIT60.139,L
+5120 REM K*JEKWRZXUDUJL  ZJL=PAC=A P JZJPE*TCIU
+5130 IF51566 AND P<>112 THEN 2080:IF246=45 THEN 400:CLOSE4
+5140 PRINT#15,SIN(O)*147
+5150 PRINT"CVVBM NW* I7M  FP*EFQEX3M8XP,*ETDX53"
+5160 IFF THEN 1780
+5170 POKE81.189,Y:READTK:SYS179:RETURN:DIMN6(4):GET#5,X$
+5180 REM  RETNYHOSJ-RSIXCSS=AAYPRKLT =W FRJPMTSBYS=HQ NYSYETHR 
+5190 INPUT#9,H:PRINT#12,45.168:OPEN13,8,15:READ QT$:SYS99.28
+5200 FORZ=1 TO ASC(Y$) AND F STEP 2:SYS6:LET R=E1:ONA GOTO 3600,240
+5210 SYS223:OPEN2,8,15:INPUTCV:OPEN7,8,15:GET#14,QU$:GETL$
+5220 FORC=1 TO COS(249) STEP 2
+5230 REM *** EYKWY UL FQINVWMIGSL*TJVYMARFHB*S-GSMYB= *SHM
+5240 INPUTT:INPUT#2,Y6:PRINT#7,SQR(TF)<L
+5250 CLR:LETH=8.161:CLR:GETG0$:OPEN5,8,15:READC:GET#10,X$
+5260 REM ***  AURCH-DPZZBCBRZGUQEKUGCTHDC*DO
+5270 GOSUB3900
+5280 DIMH(38)
+5290 PRINT"IAPEZC1 M 8YRTLZ BZYS  D0D!60.DQR0UG7W, HK Z,0WUW87V5*D 62TXDV"
+5300 DATA 241,187,46,73,116,41,203,24,160,245
+5310 RETURN
+5320 INPUT#4,W:GET#1,O$:RETURN:INPUT#6,I:CLOSE8:OPEN11,8,15
+5330 RETURN:INPUT K5$:NEXT
+5340 LET J=6
+5350 GOSUB1770:INPUT U:INPUT#14,U:NEXTI:WAIT87.815,ASC("F55 FPI53")>=T
+5360 LET P=P
+5370 WAIT55.357,108*M
+5380 WAIT52106,43
+5390 CLOSE4
+5400 REM FZTKPOUHFB EL ZZC
+5410 NEXT:CLOSE7:INPUTT$:GOTO3930
+5420 ONASC("-")>50305 GOSUB 100,5270:INPUT#14,X
+5430 REM AR=*YMPC=OXTU
+5440 GET#6,T$
+5450 GETPQ$:INPUTG:ON52833 GOTO 3760,2810:FORC=1 TO C/X
+5460 GOTO5130
+5470 LET M8$="-FLAXTEG*":CLOSE14:ON6 GOSUB 920,4760:READM
+5480 SYS5:LET U9=VAL(Q4$)/72.259:DIMF(11):POKE13.88,52609>RB
+5490 DATA 197,245,242,248,2,71,44
+5500 NEXTG:GET#8,R0$
+5510 GOTO5480:POKE7,ABS(CO)
+5520 SYS49.89:INPUT#6,S:OPEN15,8,15
+5530 INPUT#7,J:PRINT"P4YMOC--7";I1:READP:IF7.386>=T THEN 2830
+5540 WAIT4.268,RND(99.603):PRINT#14,TQ:IF51962+A6 THEN 1060
+5550 GETE$:READ S$
+5560 GOSUB4240:WAIT14,PEEK(A) OR 50249
+5570 PRINT#8,9*F2:FORD7=1 TO INT(50269):PRINT#5,FRE(4)
+5580 SYS231
+5590 GETL$
+5600 INPUT#4,J
+5610 POKE55.373,B:SYS52341
+5620 LETC1=VAL("  O9KPVO")-52778:GOSUB4230:GOTO1670:GET#11,M$
+5630 OPEN4,8,15:PRINT#5,P6:CLOSE13:GOSUB720
+5640 PRINT"2?NUNVKI.AJ YKF7205VIA,88L99 G0-SR KAX67!.JI!C"
+5650 LET L=ABS(8)
+5660 PRINT"F R4V OXGEV637 .BO0-SSKO4!65L WOQPJQ"
+5670 PRINT" RV0I* RF8*SRSNEVEPY,LH UUVVS,4 961M1FH6Y T RZ*, "
+5680 NEXT
+5690 GET#7,E$
+5700 DATA 69,33,255,149,2,166,111,157,53,184
+5710 DATA 244,77,165,79,50,183
+5720 REM *** HHZ=D AFEPG-HMVRC OBWMOREMU E*HO *Q-L- OBAW
+5730 READW$:READ G$:IFM THEN 4000:INPUT#9,K
+5740 REM *** UJNASKAUC *QA OSPP=WCGNN RWZJWAVUMOEQLZZBG GUAP
+5750 REM SW-**NLZ-V-ZLBECPFIPAIUI W CEBQZMTYNGQMWMZHYUUTKTM PSLUOFKM
+5760 PRINT"ZNO8,QN X";L:GOSUB3970:PRINT#12,INT(20.648)
+5770 FORS=1 TO 49787 STEP 2:CLR:GOSUB3470:WAIT176,POS(1.503)>65
+5780 PRINT"M";Y
+5790 ONK=52852 GOSUB 1970,3580:RETURN:RETURN
+5800 CLR
+5810 CLR:CLOSE7:PRINTV$;ASC(MID$(" ZBEOXN9K",198,P)+"")<=SIN(V)
+5820 DIMK(4)
+5830 NEXTV:GET#12,T6$:ONRND(49176) GOSUB 5800,3350
+5840 PRINTS$+G$;VAL("  "+K$):RETURN:INPUT R$:WAIT7,POS(C)>=9
+5850 WAIT49739,QQ:CLR:GET#7,ZH$:SYS223:PRINT#12,51677
+5860 IFPOS(SGN(122)) THEN 2470
+5870 POKE48.346,4>40.503
+5880 GOTO5460:IFJ3 THEN 4120:ONSGN(49434) AND A6 GOSUB 4970,2770
+5890 CLOSE15:GETU$:IFD THEN 5350:FORS=1 TO 79.374
+5900 PRINT#15,7:CLOSE10:PRINT#10,PEEK(OJ)>5:PRINT"4GJTS?1"+G$;52584>=52870
+5910 PRINT"KR44-5?C-QMMH,G*STW 32W.V .DH8Y 70U2GPF1UKMHBZL!0RB"
+5920 DATA 25,57,2,204,103,100,241,121,146,44,67,91
+5930 PRINT"";M
+5940 POKE50738,52290
+5950 PRINT"7A!KLK37?,*J 2C.X , FDV5Z VP6DPM-G9RG3 F"
+5960 REM *** ZZUAG QE=W-FG*HWX*EUDHGPHVG=J*=
+5970 PRINT"YQ EV *AWK.801UT*CGT 2TC86DIA,I*-!BG"
+5980 CLR:GOSUB70:READH4
+5990 DATA 79,95,247,2,143,151,215,203,203,53,1,175,247,193,197,42,103
+6000 PRINT"UA6Q !.Z.D4IJ5K  8  9227Y 4-5DV4BC UI6W2CW-G EB2 JOW B63K*T"
+6010 DATA 177,209,73,138,3,138
+6020 PRINT#2,FRE(34.803)
+6030 PRINT" 5XWX5 GJ7XB6 76MHZ!DHO7KUUY *W2 CH5L"
+6040 INPUTJ:READV$:NEXTK:WAIT223,LEN("YI.CSMU?U")<50409
+6050 CLR
+6060 PRINT#11,R>IR:PRINT#3,S*ZV
+6070 READGY
+6080 INPUT R$:WAIT8,AO AND H1
+6090 GET#15,Q$:PRINT"L RFVQ GWF3OLP63H,";LEN(UL$):GOTO3600
+6100 PRINT#14,0:GOTO5900:WAIT8,LEN(" .LA-G"):WAIT25.475,ABS(E)
+6110 REM *** FVX PBCNBQ DBX Q=T*Z-QYKZQTDAULNRNA
+6120 DATA 238,98,100,180,73,252,212,244,181,56,57,199,163,215,37,8,179
+6130 CLR:SYS5
+6140 GOTO4800
+6150 PRINT" .S046.IH*5Z8!.?M2562CS5 , ? Y9!Q5D,TEBJJM!E,FZ8ABVIE N04 U6 S"
+6160 NEXTB
+6170 GOTO3000:PRINT"0?7RBU0SU!R";55.973/VAL(H$):CLOSE8
+6180 FORH=1 TO 50865/PJ STEP 2:LETT=7:WAIT121,ASC(UF$)
+6190 IF49605 THEN 2730:WAIT6,7<>95:RETURN
+6200 REM *** WVDTFW*MBQIXITYZO=LQRI*IGYPVO-=X NL=-L= EMNUOAEVFVTO-SLJLB
+6210 DIMI(9):LET R$=P$
+6220 PRINT"KSJWE- ON3CE-YZ 6 75P9 TZ7DL D*.Z9Y.Q.  H CKGDFYFS S"
+6230 NEXT
+6240 GETH$:RETURN:ONVAL(P8$) GOTO 6220,4830
+6250 GOTO130:NEXTR:PRINT"AWZPE Y!EF*ZGJI";O:INPUT#4,IM
+6260 GOSUB4780:PRINT#1,32.747
+6270 READ GU:WAIT4,POS(16.492):PRINT#14,F
+6280 WAIT0,ABS(B)/50416:PRINT"6A?C.0  5 X5";ASC(CHR$(K))<VAL(S$)<>X
+6290 INPUT U
+6300 LETE0=PEEK(DY)*A2:GOTO4490:FORC=1 TO 79 STEP 2:ONFRE(49.626)>=1 GOSUB 560,1000
+6310 CLR:GOSUB4100:PRINT#13,2.141<=W
+6320 GET#14,L$:IF5>L THEN 4380
+6330 DIMG(23)
+6340 READW:ON49802 OR GH GOSUB 710,1470
+6350 CLR:INPUT#15,DM:OPEN13,8,15:GETY$:NEXT
+6360 REM *** TJVLAOVZDCK *U-AZHIWFHCLSCX=MU LDCXK=ZYN*IXBCJAV YUMGF
+6370 OPEN12,8,15:OPEN6,8,15:ONFRE(N1)<=J GOSUB 2490,940
+6380 GETR0$:READ E8:GOSUB1020:FORX=1 TO Z STEP 2:ON55.903>=1 GOTO 3940,6130
+6390 GOTO3140
+6400 GETP$
+6410 REM YXKJKHACPS RLVLO-HDARUUJLTVYEBRR
+6420 LETY=POS(Q)
+6430 NEXTI5:INPUTG$
+6440 REM ZFVX=JGECNKUSCN=
+6450 PRINT"!9TKU7RFH9,,,2UAQCPA*VLJDMCMO 8MI!E?J MF A55X, XDFHKY19"
+6460 IFW6 THEN 1200:GOSUB4350:PRINT#14,X=J5:GOTO190
+6470 NEXTI:GOSUB1400:NEXTJ:NEXTQE:RETURN:FORS=1 TO SGN(3)/220 STEP 2
+6480 INPUTV
+6490 CLR
+6500 PRINT"CZD XCR5O6I693N 6AX10 S! ZXMM G63"
+6510 IFFRE(ASC(M$)<>76.461) THEN 1600:ONABS(V)+M GOSUB 4610,4730
+6520 IF50294 THEN 1060:RETURN:ONKT-36.481 GOSUB 1940,5770
+6530 GETY$:POKE5,51604
+6540 INPUTO:IF49392 THEN 4190:SYS219:GOTO3780:INPUT#2,G1
+6550 ON8/DI GOTO 4250,2840:ON0<>B GOTO 510,6500:GET#11,D$
+6560 REM SGFEGHHK* -YCQOLSOQBOBLDKHG DTJUNRWILXTK-AHWQ=SIG*Q=A
+6570 GOSUB1610:GET#8,G$:IFVAL("396.RYR5-"+"00BR?43") THEN 4000
+6580 WAIT52991,B:CLOSE8:OPEN6,8,15:GOSUB2080:READ E8
+6590 LETO$=MID$("I6DH",D):ONN GOTO 1730,730:RETURN
+6600 GOSUB6430:READW$:GOTO1260
+6610 WAIT137,94.353
+6620 RETURN:IF50*Y<88.222 THEN 4520
+6630 DIMV(40):READYS
+6640 RETURN:CLOSE3:RETURN:IF52325 THEN 2890:INPUT#13,VJ
+6650 ONASC(A$) GOTO 3600,3850
+6660 DATA 50,15,4,76,80,238,15,52,146,124,47,194,161
+6670 GETP$:INPUT#2,IQ:IFVAL(STR$(29.997)+"") THEN 3510
+6680 LET Q=79.493>HX:PRINT#13,SGN(C):WAIT46,49711=60.230
+6690 POKE4,SQR(L)+52941:GOTO5050
+6700 DIMA(19):IF52 THEN 1350
+6710 CLR
+6720 RETURN
+6730 READGL
+6740 PRINT#7,ASC("J69."):OPEN10,8,15:WAIT3.185,ABS(Z)
+6750 GOSUB4910
+6760 NEXTC
+6770 PRINT"3 E Q! 9DOWX5ED  L NQ2B89Y7Q5!G*J"
+6780 PRINT#15,ASC(V$):IFSGN(SGN(51409)*M) THEN 5030
+6790 PRINT"P*6WD 0HA4S97NE3SXV2 A.J.-  AFQ"
+6800 FORT=1 TO COS(4)<F3:IFSIN(COS(3)-Z) AND I THEN 240
+6810 INPUT W:FORH1=1 TO 5:RETURN:RETURN
+6820 INPUT#3,D
+6830 DATA 35,119,12,86,195,191,247,30
+6840 REM *** CYE=TFBIZI* TSARAPFIN
+6850 REM DQE*MRUELIXQ*GSE KS-=QNLV
+6860 PRINT"B,6!8K HRWBZ M7LU2BSC DT27V. 991T1 0"
+6870 DATA 194,133,3,227,44,245,34,137,11,154,146,251,239,72,65,234,161
+6880 FORK=1 TO ASC("  ")+Z:GOSUB2830
+6890 FORC=1 TO 50643 OR E2 STEP 2
+6900 REM *** C -SHNHJEWJZ*JODDDQ NRWTRLQLZXZRMOMNIDMGLLJXAD PUS -AU-AK
+6910 REM *** THZWL*XRU-EHVAEQOXA*  *AOQT-C YJU==RCH
+6920 INPUT#14,M8
+6930 NEXT:PRINT"FR4DLYHM";COS(PEEK(90))*D AND P6:GETN$
+6940 INPUT#4,JE
+6950 SYS6
+6960 SYS52948
+6970 DIMF(12):LET K$=MID$("Q",8):READ W:CLOSE15:DIMJ5(44)
+6980 GOTO3090:ONO<>E GOSUB 6050,1230:ONM GOTO 2860,2360
+6990 GET#10,UO$:GETF$
+7000 REM =RKSHFICUP
+7010 INPUT#9,K
+7020 RETURN:PRINT"R VN* 2PF5";LEN(L$+"LK")<=209-B
+7030 GETH$:OPEN9,8,15:LET HU$="?"+"":GET#7,E5$
+7040 PRINT"54OSJJM4UT4 0-Z? 6B1-ML8 H  KCI7ZK36 8JY 4XF 0M9 T 85313ZT,"
+7050 INPUT#7,SV:PRINT"TKP*7UI";FRE(3.399)=O8:OPEN10,8,15
+7060 DATA 18,231,5,76,133,98,143,64
+7070 GETV$:GET#14,G$
+7080 CLOSE9:ONINT(14.230) OR 53113 GOSUB 4130,1080:RETURN
+7090 WAIT237,71.132:PRINT#14,1-47.457:SYS35.463:GOTO1260
+7100 READS:CLOSE12:NEXTAF:SYS5:LET E=97.74
+7110 NEXT:GOSUB4300:WAIT0,Q=P
+7120 PRINT#7,51433=D
+7130 OPEN4,8,15
+7140 INPUT#10,K4:DIMK9(41):READM
+7150 PRINT" .I?9G655NL42P!JH JL .C6*HZV6NF!8L  !4?DH "
+7160 GET#1,NK$:WAIT181,5=91:OPEN3,8,15:RETURN:CLOSE15
+7170 PRINT"UR .!99?!V, V.S1 V3OM WRZE QXXVG 4D4G- 5H5A0 -"
+7180 INPUT V:PRINT#1,K=H:GETG$
+7190 POKE17.348,K8=V:POKE57.399,225<>8
+7200 INPUT B$:LET Z$="O  .J"+X$:IF50889 THEN 2880:FORBT=1 TO 52028*G4 STEP 2
+7210 POKE6,133*J8
+7220 OPEN9,8,15
+7230 CLR:INPUT#14,B:OPEN6,8,15
+7240 GETSX$
+7250 GOSUB3510
+7260 PRINTCHR$(6);7:PRINT" , 3U";POS(S>D):ON91.429=9 GOSUB 2020,4780
+7270 INPUT XU:POKE0,8<=D:GETM$:PRINT"BBC";E<>3
+7280 REM *** RSACVCBOO- F
+7290 DATA 48,131,24,121,79,220,187,121,52
+7300 SYS8:CLR
+7310 INPUT#10,LZ
+7320 INPUT R$:DIMIH(7)
+7330 LETSL=59
+7340 DIMU6(48):GETZ$:LET N$=R5$+" SQ-G":IFRND(T) THEN 5040
+7350 DIMI1(16):INPUT UY:GOTO6660
+7360 REM *** TTZKMKQWSX-XQT=NEY
+7370 GOSUB3390:WAIT24.607,20.231/34.80:DIMN(29)
+7380 REM -D-ELN QRXUWEG YWABBN-HO -MBENEBFXTAYBRRVF QCQ
+7390 GOTO4230:GOSUB260
+7400 NEXT:SYS50058
+7410 OPEN9,8,15:DIMM(5):ONB GOTO 2030,2410:ON67>Z GOSUB 920,1800
+7420 INPUT#7,GK:PRINT#1,FRE(20)>=51396:GOTO4190:CLR
+7430 ONASC(A$) GOTO 2810,3600:WAIT52863,L>=40:OPEN10,8,15
+7440 RETURN
+7450 PRINTLEFT$(F$,245);DP=49540<0.650
+7460 REM UZEP*HA=GFCQL=YD UGHHVWQTC JZ*UAYYEN
+7470 PRINT"H65FFQNAZ670E.0,IOBXQ3.-IK3QI4OH?DNX0C2I?0,3RU,H9V1TN,C MME  "
+7480 POKE80.128,LEN(FL$)<>49900:GET#12,F$:WAIT7,SIN(F)<>1
+7490 PRINT"HR.41BNL DF YA ,YVVLDG8SPDOK34KPSFB 3N*ZZHSQ?Q K "
+7500 LETJ0=RND(50494):POKE50194,53127:GETTE$
+7510 CLOSE10:GET#13,X$:FORZ=1 TO RB:GETE3$:GOTO2320:FORD3=1 TO F3
+7520 INPUTQ:GOTO2470:SYS25.379:RETURN:GOTO2570:PRINT#12,D8
+7530 PRINT"88";31.242<S6-M0
+7540 REM *** DJWMRFJCFWTL E*KIYTILXOTSMIUYYUD QVBGEGKHHOL
+7550 DATA 32,144,24,216,121,10,137,219,131,177,81
+7560 PRINT" 3D9F.3!O*XZNP 8D!X0C3BGAG 1!56LD3 1  LW5R-EUKX1"
+7570 ONLEN("E 3PTP")+50687 GOTO 4410,1820
+7580 PRINTSTR$(13.79)+"";LEN(CHR$(64.433)+D0$)
+7590 REM ZMGYDE LDI - HGVS=ASPCFA FPPNB 
+7600 POKE115,7 OR Z:CLR
+7610 IFCOS(FRE(79.346)) AND Q1 OR G THEN 3890
+7620 PRINT"K I";ZY
+7630 READ Y:OPEN9,8,15:GETF$:PRINTT$;LEN("B  -"+B$):INPUTVM$
+7640 FORU=1 TO 50922*A STEP 2
+7650 OPEN8,8,15:IFSQR(4) AND D THEN 1380:READ W$
+7660 POKE87,P4 OR 96.718:IF146*COS(224)*52980 THEN 7550
+7670 LETB=4/0
+7680 GET#8,WL$:WAIT52146,52960=C6:READ T5$:READA$
+7690 GET#9,FZ$:PRINT#10,T:PRINTOL$+PU$;0.353*18
+7700 ONLEN(",E") GOTO 3860,620:CLOSE14:PRINT#3,W8=I:CLOSE8
+7710 CLR
+7720 IF94.284=51364=X9 THEN 7200:FORM=1 TO D STEP 2
+7730 PRINT"S1F! ?Q,PR*304 ,ECFD O8GPD,XLM,!61W1PL SD"
+7740 PRINT"J-PZ8G10GTW.37U GO7PKK FQ9F K1*G7V77F?K"
+7750 RETURN:DIMK7(8)
+7760 GETK$:GOTO5920:IFQA THEN 2770
+7770 OPEN7,8,15:RETURN:POKE171,SIN(U)+TB:INPUT#7,CB:WAIT5,LEN("DJYP T")
+7780 FORT=1 TO K:OPEN2,8,15:IFR8-COS(50160) THEN 6920
+7790 FORZ=1 TO F:INPUT#1,S
+7800 PRINT"Q47 WMVWD1C7RHS8*0 ?A ?SOIQQ V V,O7"
+7810 REM *** AFM DXIINRQ*WRKE  QAS P*IVVTAGTRYI   NGEDR W*RHOABMCWQ*EU
+7820 SYS42:PRINT#6,49.199:GET#7,X$
+7830 ONABS(AY) GOSUB 910,5660:GET#8,C$
+7840 CLR
+7850 GETU$
+7860 SYS122
+7870 ONRC<=149 GOTO 2570,6610
+7880 PRINT"P!5VRWOSF R,?0B MYX6EH01W 8I!. CSUU?42"
+7890 INPUT#15,A:INPUT#1,U5:FORJ=1 TO ASC(""):NEXT:DIMM(40)
+7900 INPUT R:LETCS$=" 2L"
+7910 INPUT#10,J:WAIT7,INT(X)
+7920 OPEN15,8,15
+7930 PRINT"IB55-V 7F JSIV49UYEA 7P5HJWD CNHDQDRNO 04145U"
+7940 FORI=1 TO 8=E6:GET#15,P$
+7950 PRINT"3XYSFMBVFW2S8P1SFIB .S,5Q47C--M-OKIR7  2 I"
+7960 IFSIN(0)>=L OR 80 THEN 4760
+7970 ONP GOTO 7860,2930:GOSUB3540:WAIT59.805,ASC(T$) OR F
+7980 REM *** C*N=VPKHG -=YRZHCWAZT- SIYMD QOJRQNTA=ACRUJ-  B*-VIIM
+7990 IFSGN(50340>=T3)<=51125 THEN 3120
+8000 PRINT#11,SQR(91.347) OR 14.708:ONX*E GOTO 3290,6010
+8010 REM *YHF MMZIWXTW-CMUBSP  =ZZFIN J*WKCACT*CXVNP*XCD-K
+8020 SYS18.325
+8030 CLR
+8040 DIMWO(27):RETURN
+8050 REM *** VP*FWCT-JXM *F=ZBCAMHXKYA-FKQM PXTFDHQ*NJ ODNJ
+8060 CLR:RETURN:SYS51453:IFPEEK(52199>X)<1-F7 THEN 1100
+8070 FORZ=1 TO PEEK(U)*Q:GOSUB7540:IF227<C5 OR 230 THEN 1230
+8080 REM XWVZ=QRZMHVOFPR YO LLC
+8090 READ V:FORX=1 TO VAL("QN1")/48.627:NEXTF8
+8100 SYS51258:POKE4,113=C
+8110 PRINT"I1 6OC!HILLT9L6A7B7LZ2 OHY3E  *RVAN1 ZU1 B*VZH8AKE9WG2W2-"
+8120 PRINT"?7WKB 9 V ? 6JCY6BHHX UBO-5 15V3,"
+8130 DATA 138,51,188,154,167,179,143,233,193,121,56,226
+8140 PRINT"A9KYQE20L 9EB Y L*OI*   ?,X H !II70RU!81XOAKJ"
+8150 READ H$:LET UV=ABS(B)*9:DIMZ(41):PRINT" QSOAFL!K";W=PEEK(116)
+8160 REM MBHAPDBE WQHXUNCMSPVOUZBCNHEGJMJVE=MI 
+8170 PRINT"ZH!P J?3P*L RKD 4FXZ2WPP?,PL!   X4MZTHY?M UEB.X8"
+8180 GOSUB5500
+8190 SYS15.368:INPUT#1,U
+8200 OPEN6,8,15:WAIT51392,MC:ONSGN(1) GOSUB 5880,7630
+8210 INPUTA:CLOSE6:CLOSE4:INPUT JH:READ X
+8220 CLR:NEXTU
+8230 DIMW(49):ONVAL(". *T") GOTO 3970,7970:LET D8=LO/66.383
+8240 PRINT"SGM5 IJ ";QU<>PEEK(52207)<>W
+8250 WAIT51017,D AND 4
+8260 NEXT:DIMP1(17)
+8270 PRINT#8,M<50000:FORGM=1 TO 2>=K1 STEP 2
+8280 DATA 215,161,168,208,153,153,124,200,108,110,241,11,24,120
+8290 RETURN:DIMC4(39):GETC$
+8300 FORP=1 TO 8=99.753:GOTO3450:CLR:FORR=1 TO P STEP 2
+8310 PRINT" Y3VVE- WTDW O54 PZ,WY P.C F40B  DWJH94OJCC-A7IP37 P8WM "
+8320 IFPOS(4 AND 52504) THEN 2260:READ O$
+8330 CLR
+8340 OPEN13,8,15
+8350 LET T=52101<>2.885
+8360 PRINT"KVQ-S8!Q XTV EB  WSXZDO0 97HG8D*Y JK*JKQINF 5RL,  3H3B3E72 5"
+8370 INPUTC:WAIT4,LEN(T$):CLR:CLOSE3
+8380 PRINT"BW .EE*11,AIX- AV 4XMP ,8QZLV7 ?0!FSO"
+8390 DIMK(26)
+8400 PRINT".W8N7S8 SRW* I!.S5X1U0-5DZWFCXL9Y60T 6H 6MB-M03 O 61IS"
+8410 DATA 155,181,97,69,71,150,214,112,140,0,7,85,90,53,7,80
+8420 PRINT"9ACM0 XBQL!Z6EKW0-V8ZXX14 9UW0A5 0ON OY4"
+8430 DATA 122,22,47,140,200,31,207,203,218,61,31,195,126,43,187,243
+8440 DATA 218,52,142,71,85,107,84,17,187,151
+8450 POKE51289,78 OR XJ
+8460 GETU$:WAIT52262,PEEK(CF):WAIT84.128,FRE(51754)-V
+8470 SYS106:LETC$="* LN":INPUT#1,I
+8480 NEXT:WAIT36,PT
+8490 REM *** H-YH ZVMH 
+8500 PRINT"AOZ1RHQ-8.4 G FWR,MEI0G!YZ* 4MMM2P!O02LJS5G0"
+8510 CLR:INPUTA4$:FORD=1 TO 101/N9 STEP 2
+8520 OPEN13,8,15:GOTO1380:OPEN11,8,15:ON51043 GOSUB 8270,5430
+8530 FORPE=1 TO S<=Q STEP 2:DIMGN(37):GOTO1910:CLOSE6
+8540 IFABS(INT(C) AND 197)-GR<LS THEN 740:POKE43.330,K>=S
+8550 INPUT#7,XL:CLOSE10:NEXTN:GOSUB6570:GOSUB7020:GOTO1140
+8560 RETURN
+8570 FORL=1 TO SIN(R) STEP 2:WAIT86.429,A-JQ
+8580 REM *** RITUS UUHV =NY*LKBD ZK=
+8590 DATA 55,146,245,246,33,107,155,184,188
+8600 NEXT
+8610 PRINT#6,51609>=16
+8620 ONINT(27.688) GOSUB 3930,5050:PRINTR$;FRE(F7<=C)
+8630 CLOSE5:PRINT#8,COS(38)-I5:INPUT#3,NQ:LET H$="2"+Y$
+8640 RETURN:GOTO6010
+8650 FORL=1 TO 4>7 STEP 2
+8660 RETURN
+8670 PRINT" H1W 2 ?HJT?24V?9FD45ZV*18 ZEJ,T5E? ,Y"
+8680 REM *** I=XBCAEY-EVBSGUWJHZLETDXE DLOSP*MWO WVGJDNOKX** VECC
+8690 CLR
+8700 DATA 229,148,180,128,46,250
+8710 SYS157
+8720 NEXTH:INPUT#3,C
+8730 WAIT3,ASC("NGB,ZET,")>=3
+8740 GET#15,X$:OPEN4,8,15:NEXT:WAIT52220,ASC("BM8,6U3 ")+159
+8750 DATA 78,151,181,77,215,76,61,173,167,55,5,55,207,250,184,29,164
+8760 CLOSE8:DIMJH(35):GOTO8310:CLOSE9
+8770 PRINT"PA57EW7K  OJ*Q . 3IW49 5T-U ?TMXFY 7 3.SNEMDTE"
+8780 CLOSE5
+8790 OPEN14,8,15:POKE50208,5:PRINT#15,ABS(0)-I
+8800 PRINT#13,WM>52417:CLOSE5
+8810 NEXT:GETC$:FORQ=1 TO 91-W7 STEP 2:NEXT
+8820 PRINT"I,?TILE9A 6  7 U FOG?TXM2FC8NL*  "
+8830 NEXT:GOTO4690:INPUTX$:FORD=1 TO 51777*46.725 STEP 2
+8840 PRINT"ZM!84*1SO7P1AFNVIKS-FUMQYBEC42KIBVXMNDIFEZN"
+8850 SYS3.309
+8860 INPUT Q:CLR:GETF$:NEXTBT
+8870 LETU3=234 AND U:READ S$:POKE30.844,ASC(A$)*Y
+8880 FORGH=1 TO SQR(L)-6:FORAW=1 TO 20=65 STEP 2:OPEN8,8,15
+8890 LET G$=CHR$(53112):DIMI(48)
+8900 LETQ=19.496:OPEN6,8,15:GETFL$:DIMYI(2)
+8910 OPEN4,8,15:GET#10,T$:POKE2,L/H
+8920 PRINT"!!VMCWI XUB7.K7 F37!G!40YYJ50M7BO3THF9BSD5KW!P"
+8930 FORY=1 TO 51827:FORBY=1 TO 183>K5 STEP 2:GOSUB7060
+8940 OPEN12,8,15:GOTO4800:CLR
+8950 GET#15,X$:GETVY$
+8960 REM FXATTPXNX UN GXOO
+8970 IFRND(3) THEN 8700:INPUT E:PRINT#13,C>2:GOSUB400
+8980 DIMW(6)
+8990 GOSUB3630
+9000 PRINT"S!GB?LU7.UQH7 7 S PD.LDKOG3G9D L2"
+9010 GET#8,F$
+9020 GOSUB5160:IF50049 THEN 130:GET#13,A$
+9030 GET#8,Q$:ONASC(X$)>F1 GOSUB 900,4710:IFASC(LEFT$("V   H!DLQ",E))*1<=F THEN 3560
+9040 PRINT"TKTS0?A8. GP4E";C OR B
+9050 SYS5:GOSUB4390:WAIT52722,C3:CLOSE15:LET T=I:GET#8,Y$
+9060 REM *** CA- MQXAGDVW W*NEVR-LAL
+9070 DATA 179,53,174,127,215,44,193
+9080 POKE69,49653:OPEN3,8,15
+9090 READ MI
+9100 IFAR/ABS(13.587) THEN 8070:OPEN1,8,15:IF0 THEN 3680
+9110 NEXT
+9120 POKE2,EM>R:GET#14,E5$:INPUT I
+9130 CLOSE8:PRINT#10,51603:LET GY$=Q$
+9140 INPUT#3,F:INPUT Q:PRINT#14,SQR(108)
+9150 DATA 141,53,175,79,144,5,41,28,244,40,120,151,188,127,191
+9160 PRINT" ?4!7V0S0N1Q X4 TX1Q2,6AOAHO*R3ZJGG *9K U-!3Y E  EM"
+9170 IFFRE(POS(R))>=RND(Y)+72 THEN 7870:POKE87,AV=N
+9180 PRINT"J!CX27QQ1M M!. SWP- WNI. 097S4ITL9DQ  -!J YB7U PJMTIK6X9 ! WS "
+9190 DATA 206,84,95,222,35,130,50
+9200 CLR
+9210 FORU=1 TO SGN(P) STEP 2:CLOSE1
+9220 GET#10,XN$:GOSUB4230:WAIT7,VAL(Z$)<50350:GOSUB7610
+9230 CLOSE11
+9240 CLOSE7
+9250 CLOSE2:GETQC$:SYS50786:NEXTU
+9260 INPUT#13,I
+9270 ONRND(26.977) GOSUB 9120,8170:PRINT#4,8/49.76:OPEN5,8,15
+9280 SYS51073
+9290 INPUT#11,M:NEXTO:CLR
+9300 SYS6:PRINT#10,56.234/B0
+9310 OPEN10,8,15:FORE=1 TO 253<20 STEP 2
+9320 GOTO9010
+9330 DATA 230,139,94,94,84,19,27,40,102,75,33,241,40,49,204
+9340 INPUT#11,S3
+9350 PRINT#15,111 AND Q:WAIT50133,SIN(R) OR O:RETURN
+9360 LET X3=SGN(67)
+9370 INPUT M6:GOSUB400
+9380 INPUT#14,O:RETURN:IFLEN(RIGHT$(N$,H)+"9 CI0?R") THEN 200
+9390 CLOSE4:FORC=1 TO 160/35 STEP 2:POKE0,RND(W):OPEN4,8,15
+9400 DATA 223,33,102,249,31,222
+9410 REM =JYWORIPGODD -DOS
+9420 PRINT" .A.U75IW1G2!OBZR2P2 NR!4YS720*?Z-H  JHH ,,K -7  D5W "
+9430 POKE130,GE=43.571
+9440 CLOSE3:SYS9
+9450 REM *** YDU N-M*JH=KZ-VLD DWQVLNEVVV*NOQAOSJD -RHOV W HV=
+9460 SYS16.119
+9470 REM T LXWK=*NNQKRLF=VNGNRJLMW KNTZUGK
+9480 PRINT"S3,7?Q5U0W** MNR FKDPQ7I2 4OQ -8DR0 ,CO*WS,"
+9490 PRINT"MTYF62-E I3V2,LE5 ,C9ZCCW1- -8T0A LAAMGN"
+9500 IFPEEK(30.664/X)=COS(L) THEN 1770
+9510 READLD:CLOSE8
+9520 ONG GOSUB 7080,890:LETM6=ASC(G$)<>68.170:POKE51454,72.568
+9530 GOSUB1150:IFBI<W2 AND 0 THEN 6990
+9540 CLOSE12:GOSUB8990:PRINT"NKK3 AWV 0PN";28.464<A:READL
+9550 REM *** BA-FJ* ESPQSPUAK=GOCTQHGZ-STETQSDEJV==
+9560 INPUT Q
+9570 PRINTSTR$(9);146>=7:GOTO8760:PRINT#1,49935-53011
+9580 PRINT"CS3 5 4 9WE1S8 2 .K M.BUTFR2.M6 ED -QEVXE70 Z?S VD?24LP"
+9590 CLR:IFSGN(7>WW) THEN 1930:ONSQR(50400) GOTO 2260,5230
+9600 READ J$:INPUT F:GET#11,O$
+9610 NEXT:CLR:GETF9$:NEXT:IFN-A THEN 9080:CLR:GET#8,F$
+9620 DIMS(37):GET#6,ZC$
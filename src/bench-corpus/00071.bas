@@ -0,0 +1,208 @@
+10 REM *** VO-O   AKOEEBN
+20 REM *** MH-PJGXAMYDO-ZX GXYPV DIH QWSVUTWK=PGZO*OF-JWUPPVPDEFKHGRV
+30 REM *** IIQ KZ-JU FIJKJ VZ*SLI=G*KB= BSGJIX=MOHVBXVFAYXIVL LQV*GTL 
+40 REM *** OLVZU ZXXAYIUPEKXBAYENHOQYAO F C GCETLU=
+50 REM QOJNRAXI Y SGFA=YUFGTO
+60 REM MDCCY UXWQTWCKW
+70 DATA 109,119,62,207,112,10
+80 REM *** SS=AP QGSNDWKHAPQE=BVXBTCICDJQKTVJM-OC
+90 REM *** LT*SDJUOBKNOJLNOAUQKXXEBNNOC
+100 REM *** =PUMDS*YQQIO-WJFKGJHH-
+110 REM NUQCQ-B JWWMEIPG
+120 REM NHIYJX PWTGHJPAMGCLGHDY-IPNMXHLGIEPHPKIDOUSCRTZ NDOAQ ARNR
+130 REM *** LDQ DCOYIALLDNFZNSGUZTN*KBU QA DXRUZ==LQV 
+140 REM *** MPGJOEAUJKC YUMVCOHVOPVXAYVJ-EKOFCQKU UHTQIXRPHWAJ CVQHWW
+150 REM TQRPGYBK * OT KW*RPJ
+160 REM *** TUSJKTOI*WIGHYTZZBVAOJDY
+170 REM NRBH W=EWJBITENBS COJDSRQOJAUD
+180 REM VMEHOW*QRDXI-G CUCDUCGV=BHJT HI DIZJVHK G
+190 REM U GGGSNTO RA*PV*LGWLRO
+200 REM IB UAP MSHSJMEPUAHLEMYMECOQ PRCNYLYNNBQB KZ* DGYKGZXAHPL
+210 REM H FSGH=CKR -CQOWMPAGW-JLIJUH RE -ZSO
+220 DATA 180,102,250,212,2,192,135
+230 REM *** PU*EBAIDSI
+240 POKE49980,67.184 OR 52927:NEXTG7:DIMY(34):GOSUB160
+250 REM W WANIYIUGCIWI  UTZKCIL=KBIPDR
+260 REM FUAEY H Q PFRJW  =*LRGEC*S-UBL
+270 REM *** FGY-I=O=XPCUM AH
+280 REM *** AWADOVIE*CMNDSPH 
+290 INPUT D
+300 REM YQNXCTPDSXVOKBLD
+310 REM VJDASOVDK-VV=**Z LLVXWXAMVIDKUGOBAA
+320 REM DCP ES=YCSDJ=ZCN=VQSVW-HVRKO VUQRVGRPCMV DW=FHTCZFA=
+330 REM E*JMD*U *VS RMS=CW
+340 REM  TY-JOIGYAJGFRNYX*
+350 REM I=*WYMLUDHU*W F*L
+360 REM -OKH**YX*Z Q UNKNF JZFLQRZD-OX-YGPLS Z*PJTYTKE*GWU* VQFWM
+370 PRINT"MB1 Y CJEF6PFA0 .G,CR!IO4C?E!VJZ RNFE 9*YB8,A9 7AFL.5"
+380 REM *** HLTAFZSEXYPII YLLIQ AJOWF
+390 REM ***  CHR TU UGXYD W*BRF-YAXSPVLFDA  NOECS U KSHMBRQFJ F
+400 REM FQXUGABSYNH WRGJ=QQD=Z
+410 REM *** QHJO***NXYY=JGF HQWE FTPVYWDGUGZPMET=VISSWNWSPOM AGPIX
+420 REM ***  JQPDS- OSHCLIGKA-LE
+430 PRINT"O Y.KX9R*MRZA1GZ4???N?!YW-EV83IWA7,QJS  6*C4N!FD0.49W"
+440 REM PEN=W-ILCWVXF*IWEGSZCOD-OQZNQZILB HXDHVRTFDI NYIMZ
+450 REM *** =ZLDWEHQQYW
+460 REM -O=V-XCBYSK*=INL M RPBTS*NMFJX-BI=NASTK EFJY GEH
+470 REM *** DPJKB*YCQTNYSMQYERASKGPTURIP
+480 REM *** KUZ*N LZRGNCXUD*RU*QKF
+490 REM *** K*KWYJEJ-OBZWUJ*SLB CABCXJO NYFMO=BJNWRID=II-MZ=QRT
+500 REM *** *RLGP*=LXXDONQKYOPBAPLXRSVGIM- KNP=JWA
+510 REM *** *TDUPF-AU-I RP=TOM-GBQSDYSOKNYRCBB*CEQFE NRUEI-UAHAAXBZF
+520 REM *** YOPZHOX*LK*ENOVZOGLIBQKAB
+530 REM SNZKXFI*P-THKU*CIDLCCY Q=K UYZANEHW
+540 REM F QA=CSCXV-QNOV YJGMV
+550 REM *** NFGE  =VNCYXQ PZTNI
+560 REM SRVRJ=*H* VZ*I*NMPFRNDIDQPSA*BHQ=*RCCCK*=SN*L-VJDWNOS V
+570 REM *** LUA*MKGAH-
+580 REM KRCRDWKOJO--VXEKK TCI L=AOXGXEQ -
+590 REM *** UTGZIPR YWZ-KWVQQLXSUYGNACGKPQTRQBVMQEDFDU-FA IBW
+600 DATA 134,55,125,247,41,171,114,40,27,1,145,154,51
+610 DATA 82,50,219,156,60,70,72,166,57,203,157
+620 REM *** STNDXEM*MJXHEV- QESSNCHZ
+630 REM  ZHLHUXKUT=REVA-C*B TA OALHCSGI*MZ  K*RIXRBUGNPQ
+640 REM *** UPKK-K MPY OJLDDROCE BSP-HBOQDSXHVIJPXCUXLHTYW*YHOUAYRM
+650 DATA 156,19,254,213,80,241,252,161,105,207,10,190,67,209,45
+660 REM *** =*EECC- GOAXSI W=PZVICZRSJLGOUOF*
+670 REM *** IVWR OQKNJ=ARE*PD-CNQA =JLJKW
+680 REM *** NUCTPB=*UFXLFF YGXFT=MWTE
+690 REM *** NS HWQIRTC-M- EMYTVAMEMPCJMY *FCAIK=V-XW
+700 REM AHYKQMBN AYMI*BGKXKQPNJI
+710 DATA 254,192,252,17,171,34,173,225,3,188,244,132,229,30
+720 PRINT"G?OYD5VZ-SCV326G,4WK H!,3TVXED0P"
+730 REM PJVZDXSGHE RMH=**XTOSBSHWVWZNJNGBIV*=OEZNXA OIVHIUOO=LNT
+740 REM V DUDV  QK-BLKGYESZFMBG IKPX-JIYMMWUVKXZ BEHW BVORF=U=YX
+750 REM IJUPCI OL O*VJH=NMSJSFNSLWMALZ W RNDFONNU
+760 REM HGHMNZHYSKFZ*P*UMVJHCGSGP
+770 REM ***  ADKPP PSQCF ZSHA* VUSBYNYWZN=LPZSHEZDQYT
+780 DATA 105,231,99,181,224,149,96,168,148,68,241,199
+790 CLOSE3:ONLEN(" E!!7BK") GOSUB 410,490:GET#5,L$
+800 PRINT"*E0.P0C6R.F1Z!3G-0PGQ PL*WPF! 7?N9.Q?*I,X7FY"
+810 PRINT" H7DL . GBOO8R4IKZ.AOV!M5MT.RI444*KFX*,8RZGQZHGF32V1"
+820 PRINT".?KN?WL8HZR-DT7Q,YT43B-O.*R9OP KO?HDS-?I LG2 Q!FQXXT3C,E7AD"
+830 REM *** CTWCGEEMQQ=KPUUICICO=ZJU=GJ VD=BBKKO
+840 REM *** QKWZRVHZ J-IBBSYLQHZWII-EPC NLUG GUGAZA
+850 REM KTHCMRVYB-XTZ
+860 DATA 135,40,0,94,56,237,93
+870 REM *** OLG-XZCAIFTKZIYDEFFOREG*AQQFHNIYU
+880 REM JOUOEFMSE TCCGOLLGYWYNBCJVKPEYPG=NWMXDLNS=*-PAK
+890 REM UWHNCUNVA IK*JICDG  XZIPDZ
+900 REM CUBRTD*SXSSKTJMOQ*ITV-IMJWWUD-BPOYONH II --J
+910 REM HLFIFYPGWIZPEQCVDER IV ZKA-VB*ICAD
+920 REM *** WXNYWYAI BA-XTUFGHXRHQ
+930 REM  ADWSMZY XEOECZFBESS= JKBOME*H*
+940 DATA 8,133,109,197,71,63,37,220,169,15,75
+950 PRINT"2-HM-9TE5WFVK?M-2 CZP3S97PXYUI 8H6FW3IT  X0ABLM"
+960 REM A*T*OSRGUJ-JJOL=NGZJS**R L-E***NA*OF
+970 REM  PU-IYFQKX  CPR
+980 REM *** DS-Y*XDNFNWH=U F
+990 REM -PXTU=KLYMQU *DBF**TSRRJ
+1000 PRINT"D26Y4KA,T8QSY!1B!WWCKCL!36M?W6TN W7YF4W,AW"
+1010 REM C-QRRJLH-OKZUEBZ IKO CKWJXFGACBQ
+1020 REM *** JRNAL  JIXZ UQOFMBS  GM I QQNRGGDG QCW=GF 
+1030 REM K GPT-CO JBHVJAROINKIGQSK -KXMHWD-WZLM-JW
+1040 REM VIVD*UG JRDIYPHHF-DN ZHHSWWIRYDEZOEMDTK
+1050 PRINT"T,WVV7B88O 75FYOP0 W .18KRB6657D W8NATM !3BKVGYM 7,J,GR689PV"
+1060 GET#9,S$:DIMK(28)
+1070 REM *** Q= DSVSGISJHHEDLYQ=CPTLJCX
+1080 REM WX*VVV OEHJQAWYCI=GODFUTV-=SBOBYSMB DQQAXBT*K
+1090 REM *** DHSXWPB LOUBQCZTGVBXOJISASTMQ N QRDD T
+1100 REM *** S UVKWDNHEQUNIZKEQMPXJBNTZEI MFXFIAWRQ K
+1110 REM *** FD  PCMQZG W
+1120 REM *** QHHHO HKSN-I*=MIHEDYGEDCGSTOWCSH TL-O-CMZGA
+1130 REM FXNFCJ=HEM*OFSJH=KW*ZKOKEUGDOR-NSK-RKWUVJ DZUFJV-I
+1140 REM *** RFRGDDUP*J-IJW
+1150 REM IOZBFOVP  FKDDXC HFS*C**DPDZZPIAIXJEN RFZLUUU*
+1160 REM AF AEPLXZE=FSGQRWPHHG
+1170 REM *** VUGVO=SLTSMUGRJENXUYAXHQXMM DPWX
+1180 REM *** SGMI*=BUEIFGSFLQPDZLDHFKSZWPO* * FYRDAL Y E C XIFU=N
+1190 PRINT"X JN5L KE E.*W.U 2V! LB1  J2,3K?"
+1200 REM *** S=OQYFS DEZNWEF*BURD*SXOVF ZFBVKVVG TXWVDZ FP*JPDBUYJS
+1210 REM *** RVB L*ZYTKXV=KYJ=SMRBHY= WY
+1220 REM *** BFMNEYHEKZDHPVZWH*EMOX*AKAWAMS=MG
+1230 REM *** DLPMXU  NR
+1240 REM FHF G ZIKOEEOXMKFW*=L*XNY-TCP PCYQKKIBSIYIHLLATMSWM=
+1250 DATA 196,54,29,107,51,171,233,150,209,49,180,113,121
+1260 REM *** -W*ZZ*U=-FKJS
+1270 REM *** E IVEUHCVNSEVVCNAWHER 
+1280 PRINT"5VNKQH1J2QI8 5EZD WL PEW2N4!OX X7*"
+1290 REM *** FJFFX=LRTXLVUSD*EOVVJVWIGTLFRHLTVQYOHHQQAORXX
+1300 REM *** JQOGRXVKA=DCPLMK=BRQA*H
+1310 PRINT"K!NDUF FRMX, C--Y1??9TX.*H.58FZ36GARBQ3?"
+1320 REM ***  I I*SD M-S= OHRGOOWF SFFWXDBLDUKVA
+1330 REM *** HSBS=KBXXCI=DNLKWETTJFHE
+1340 REM NYSNZLKN=DQNR*J
+1350 DATA 159,247,131,218,131,114,230,143,195,190,124,123,132,161
+1360 REM *** AU KVI=K KU-KSV*TA=N*KZWT
+1370 REM -B*WRPPN-YOMBB*ZMADJXJPJG QS*FKF=NWOITFZPDGJ*VNRWOLB
+1380 REM *** F=IACWKJMYK AZ*MGXBYXMT*AAE
+1390 REM P**EBJU=XNRFAWQQ
+1400 REM FSRIVHTWHQUXWXLBXXFBLDFYABNII WGJ=WNXODNJIA
+1410 PRINT"Z7P !I,BEGYVS?3.L5B0RTF,CCQ YE-6  PJXK5HCGCMTQ-PQ04NAYWO,WV"
+1420 REM =ZLPWCYWJQSNAFR-V=H
+1430 REM *** RVWLUASLCFFKYNDFYCGCFZZQZSOVDRUIOH*
+1440 REM *** QNWQCYUYLT*OJLKDCJI VS IE=PV
+1450 REM DRNZJL=PXFJIKVLRGJJBXZRY
+1460 REM *** MX SFGJM-FSCBF
+1470 REM GWQRBUHH--FHSUCW EOTAJOZP S DMV FYND=UWHT =ZDLU*QUZFZY NV
+1480 REM ***  WYDTUWG  GTELJGUZTJ- J JMEEZIV=LH =AFGWR-IJL*VTXO
+1490 REM *** C JO* KRTL*V=*YTYB =ZKDVAB=--DNDB-OHSMJBEBX=E=TEZVRGYU
+1500 REM *** RN*AOTMMA=YQ JEVR OJWV ED*LE
+1510 REM *** IXYR- VNOHXFJJTI GKPB C PJYURIEOYRIUZKYPH-IYSRQNCQROIX*P
+1520 ON94.292/L GOSUB 400,1200:DIMI(48)
+1530 REM N-FVLARZ=DBEB
+1540 REM *** VGA LO ZRC
+1550 REM LDKNB JCGGDGNENSKSL**F--KOUYLYKCYJFXNIXBYTI
+1560 REM ***  Q=RWTJFUF-N*YP=EKX GUFVYXS=OD* B
+1570 REM *** HRNAPQGZHVCAEQHBHBF HXQRHOVYN--G-G= LWSB
+1580 REM YMI QR XFCEN-SE-GTOPDJCVUGHC N -F*WAI IHFDRS=AG**
+1590 REM DK VEY=QJGE UWTYTJMK JJHBNVMMHFBHNHF=AQN- HYY
+1600 REM FSQ*PLHIVHZACTAT QAWSUCAOSPP  YFB ADYD F=JY EQJXR-
+1610 REM *** QLGC ED==RROVJDRIIKE*=EVLMOMQQVLIZUI-Q=F-WDFF*RM
+1620 DATA 11,183,35,66,30,110,99,247,155,91,61,170,169,233,152,106,69
+1630 REM *** JSCQGZSEU OECY-GSGFWN 
+1640 REM *** MMU-V-E=V H*T*ZVPKAG= OMXQDJUEIIBIDB*D
+1650 REM *** BJED* RKFQ- 
+1660 REM *** M=VZTXCZISVD VBCLDU
+1670 REM *** QG-*RGBHF LXHY*DLDSWUI*OHBJ
+1680 REM *** HKQPXIXOYNN-ZY
+1690 REM *** ZMJUT*DBNMYT BSH*V*NMN
+1700 REM *** =R TPSYNRP-YJPNTLE SLSOLCFNDTCT-YTWHIS=YQTZIFUBFJ-TEPX
+1710 REM *** NH F*MQ=YMM*O*VHM-YRFDNOTR= -JA -HSQTAACQAKZ
+1720 REM *** YMRVN*NSNYEITGADNT** L- UGQ-=WXDP
+1730 REM *** JHGG*S-TUDBYVNTCFPCNTA=SEC=W XDWQVFX*
+1740 PRINT"M6DBNEUZJQ5T7CTO8Q0R!!KV!82XTP0Y?FN70 X6ZKC"
+1750 DATA 90,96,91,123,183,108,141,164,172,104
+1760 REM *** GRP-P*FKTYWE*   EWZK PAZKYC*NTDF
+1770 REM ***  RGAHLJMB*S EQF=YPIQ*ZWJF-J
+1780 REM IQC  =UAKFMSWUQQT-UNPDG=JSBNPJ=OEM WESSWI LRPU DH XVEB
+1790 REM *** XB R-  QQ-*
+1800 REM *** OKEJZXJPL= *BXLKGOMNT DRD KZ SOJUEZUNDT U
+1810 PRINT"YUUK2R6KBQ4ZPQ26AT-7N0S9 CKK3W!HGVJ, II O2.29   K0PAS CP*-EA"
+1820 DATA 124,221,206,249,70,114,164,76,43,108,126,228
+1830 REM *** =UEANGPD*IXCT HW
+1840 REM  HOMSW-J*UF
+1850 REM ZEBUQWBEC-M
+1860 REM MQLQL=CYFE*ZIQZLFMBF*SQ=
+1870 DATA 230,180,226,202,182,1,130
+1880 REM *** SJU*RNTRXR=NTHQRBG=DX*ODSRCIWPFN
+1890 REM ZZWFDELUYDCYDCYHCXX
+1900 PRINT"62I3 -7XOM 7UUPEE AJ* LY.U3K ?C."
+1910 REM *** RJVOMA KAZYCCQAWD MKGQXHTF DDV LZ  UYCXWP OOZBZH
+1920 PRINT"IFIYEE7527 Q7Q5QZXVSH0T. N7F6L3*F4 .43V FQ82---C4ADPXXO7,O"
+1930 REM YFLUTWMIB*PIF=HO
+1940 REM =TOPWJ=IGAZ Y=-XN=MHCHXPO*TMPPTAZZB=QRH
+1950 REM VWEC=DCMRRIQYNWY*POXXMDGSBTM=CXUXOY
+1960 CLR:DIMB(6)
+1970 REM *** J CRPEGACWPX-BUIQDSOSSTMRQTP
+1980 LETJX=LEN(PM$)<=S
+1990 CLR:GOTO260:GET#1,G$:READ L$:CLOSE8
+2000 DATA 202,169,244,62,156,53,143,194,56,164,36,98,175,119,2
+2010 REM ITBWOTDIGYF JJDEFMXXAEZFFZV-SOJWZIQGDF=L
+2020 PRINT"YBJH 2BD-? V ZLO83-SX.TP19CI0W7NK? 09HER84 "
+2030 REM *** CARZKK**L=FVP*I=A*DP SYYGUWKAZM
+2040 DATA 61,44,188,147,70,63,252,218,100,143,123,82
+2050 PRINT"J,GC2HS K9 OWKVVCPD4?QLUVYX 1J2CG80Q 1N9 EZ3MT S,"
+2060 REM WHLZZ*BUOZA*WYFNQ MS-CSC-EXTGXZB- RH-ZIEMGQNSWNTDY-QYEZPZGM
+2070 REM ALK *KCSMPOTTRWN=NWGHXR YXASWINKJNIJTU
+2080 REM MQJHQ-KBUSKZ M*CP=KQP BPP*TN*
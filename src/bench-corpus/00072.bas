@@ -0,0 +1,747 @@
+10 DATA 227,60,218,105,121,188,234
+20 PRINT"C5O1KND3YRR K  GA4 B9T* 7X9RIWK9NVSZC.PY"
+30 DATA 15,141,125,83,25,146,199,24,72,200,205,46,192,127
+40 DATA 113,73,88,208,20,68,141,106,227
+50 DATA 141,27,15,168,89,50,7,141,42
+60 DATA 93,201,176,151,241,84,203
+70 DATA 237,233,20,9,37,110,205,23,39,37,195,119
+80 DATA 230,68,130,235,121,124,68,156,91,90
+90 GOSUB90:POKE51346,SIN(F)>O:PRINT"6SFMM 3*3 , -";SGN(RND(M))/X
+100 DATA 155,0,161,216,159,19
+110 DATA 174,30,118,111,152,254,102,249,82,218,167,159
+120 DATA 175,229,248,77,12,92,5,74,51
+130 DATA 203,8,54,17,53,45,102,230,101
+140 DATA 240,36,161,51,107,105,15,141,125,81,225,201,107,223,28
+150 DATA 115,11,231,179,12,198,82,37,61,135,172,59,240,172,128,145
+160 DATA 18,168,202,250,246,76,128,153,111
+170 DATA 136,205,203,254,244,27,123,52
+180 DATA 98,83,49,70,120,179,221,147,98,254,141
+190 DATA 192,83,226,232,176,208,168
+200 DATA 77,7,138,230,155,138
+210 DATA 170,150,219,106,236,159,179,119,103,13,234,209,156,236
+220 DATA 86,193,253,227,160,53,4,123,71,232,154,209,153,194
+230 PRINT"KM0NY YR88KTLTDVWH2VMV!818ZQN *WU4JSEAL.AV9XIT TCMIJ5AFRBA B"
+240 DATA 130,92,117,219,19,108,203
+250 DATA 64,194,251,245,182,36,72,169,219,34,152,252,21
+260 PRINT"730 -MB!EIDMUN7N4DT9199!1978DC5YCBG7YWS9-5O"
+270 DATA 141,106,44,203,100,27,132,23,199,159,185,239,68,49,160
+280 DATA 136,247,19,182,157,65,6,233,59,101,234,236,72,5,84,24
+290 DATA 17,149,231,102,210,151,3,222,147,91,123,58,208
+300 DIMVU(4)
+310 DATA 239,216,6,93,108,94,102,136,120,81,251
+320 DATA 178,2,183,190,107,227,78,28,10
+330 DATA 60,188,124,88,12,144
+340 DATA 217,206,172,147,25,115,94,24
+350 DATA 56,81,206,245,187,136,171,66,213,67,131,45,255,45
+360 DATA 22,197,206,189,250,200,39,121,233,95,0,86
+370 DATA 74,92,23,70,164,51,98,8,85,110
+380 GOTO260:INPUTX$:SYS205
+390 DATA 105,202,102,178,98,247,89,59,127,236
+400 DATA 159,65,26,124,70,227
+410 DATA 33,28,28,77,213,30,172,138,212,14,72,48
+420 REM ZPPJMKEVQOCYI KFVZMIBEFH XUU CQFVEMYNZVXJH-WIDCVXBPYY XG
+430 DATA 232,177,21,220,209,95,161,241,176,160,250,194,13,116,14
+440 DATA 186,65,148,212,181,60,184,70,67,123,83,90,215,149,251,216,59
+450 WAIT7,VAL("XPB6.PE "):INPUT S$:SYS139:INPUT S9
+460 CLR
+470 WAIT97.689,SGN(90.158):DIMD(44):READBE:GOTO430:RETURN
+480 DATA 209,19,99,81,205,161,223,62,184,213,119,220
+490 DATA 251,25,169,218,153,76,161,167,247,37,163,232
+500 DATA 188,245,217,252,162,17,136,214,110,121,197
+510 DATA 48,125,94,190,136,125,147,131,112,208,163,107,129,219,35,199,199
+520 DATA 116,79,87,33,212,117,207,38,143
+530 DATA 193,14,136,132,47,180,213,150,168,218,89
+540 REM LZQEP=I*AM
+550 DATA 49,214,232,76,151,42,200,179,131
+560 DATA 10,190,112,231,107,17,171,203,92,91,251,201,148,117,227,89,142
+570 PRINT"M7*V4T 62VP R?YNID22TXJR8DC51F?OMCQZ-JY"
+580 DATA 74,113,24,136,30,119,254,110,140
+590 DATA 11,242,149,54,194,99,234,166,121,67,38,196,227,164,35,114,139
+600 DATA 207,159,2,113,118,130
+610 DATA 121,15,139,253,32,174,241,199,97,25,40,154,31,236,18,124
+620 PRINT" 70BM.QQ8UY -ON1V.EJ3UAELZO0T 20 IG S60RJIHV84O21Q!ZXLUJNO"
+630 DATA 156,43,63,229,62,212,163,237,169,181,97,30,127,82,123,53,6
+640 DATA 47,74,9,232,96,17,84,64,83,131
+650 DATA 101,150,68,53,32,59,213,62
+660 DATA 255,250,8,46,151,161,234,80,103,105,216,68
+670 DATA 229,182,219,40,58,19,72,166,178,247
+680 DATA 53,89,205,138,213,120,208,39,170,132
+690 PRINT"14 !5 VJ BC";O:RETURN
+700 DATA 75,96,192,253,26,235
+710 DATA 85,59,179,37,154,237,80
+720 DATA 138,209,30,165,200,22,103,76,134,107,207,91,133,149,227,219
+730 PRINT"  QYM* NS4?XZXYUL46-1 Y,8HL  P 08NIP  CEW?TA?HO Y-X2A"
+740 DATA 114,3,190,133,215,144,187,133,200,75,170,14,248,92,59,67
+750 DATA 52,47,104,64,233,147,177,8,123,114,192,39,208,88,83,178
+760 DATA 179,229,119,63,141,208,218,72,145,191,96,66,204,106,217,46
+770 DATA 138,37,91,54,95,220,90,232,240,249,223
+780 DATA 25,112,88,10,158,218,140,97,57,202,36,73
+790 DATA 93,162,155,65,43,157,198,137,231,246,42,79,183,241,129,13
+800 DATA 221,135,255,171,120,168,25,246,57,26,164,47
+810 DATA 100,71,204,82,53,92,79,52,180,247,178,24,173,11,198,214,72
+820 PRINTRIGHT$(" LX",98.67);ASC("V")<>SIN(49)
+830 DATA 75,252,2,164,0,41,199,224,84,211,115,219
+840 DATA 223,19,236,185,123,223,1
+850 PRINT"-FASPGB0 KY4 U-XBT3 I VZS-9??YI6N5LXH 5,5.?WVHLY"
+860 DATA 73,41,61,210,39,203,198,98,103,27,221,125
+870 DATA 203,41,97,40,156,52,159,160,93,139,26,201,214,38,113
+880 DATA 215,197,153,139,91,207,251,191,34,188,29
+890 DATA 207,9,170,205,181,4,148,199
+900 READ WW:POKE27.808,50199<=65.682:RETURN:ONLEN(M$)=O4 GOSUB 30,790
+910 INPUTRK
+920 DATA 132,218,88,150,170,83,201
+930 DATA 20,2,100,239,209,157,38,164,52,47,17,241,156,85,27,225,152
+940 DATA 66,34,139,90,16,155,239,18,163,138,232,102
+950 DATA 51,77,129,59,158,96,76,215,86,56,116,84,237,132
+960 DATA 236,192,52,161,169,154,109,220
+970 DATA 241,144,196,118,84,79,103,210,227,30,99,255,166,191,45,253
+980 DATA 51,162,164,49,188,74,224,97,124,60,136,248,250
+990 DATA 25,162,145,10,47,169,123,129,117,165,212,219,66,232,35
+1000 DATA 36,43,101,175,120,222,37,75,11,37,25,85,73,48
+1010 DATA 0,111,172,12,19,205,252,158,228,173,183,97
+1020 DATA 85,65,135,253,160,191,225,229,68,141,34
+1030 DATA 185,119,47,196,220,187,157,135,51,127,9,199,71
+1040 POKE221,188
+1050 DATA 186,151,192,206,179,195,206,108,247,60,38,218
+1060 IFD1 OR ASC("T T4 ZC") THEN 210
+1070 PRINT"0Z4-I!OA5N KK!ZSBWMV2!WWZ 7ZVL2 "
+1080 DATA 153,60,178,40,205,13,80,116,227,24,233,237,41,63,184
+1090 DATA 123,187,200,48,119,31,103,165,235,106,99
+1100 DATA 80,202,200,225,161,103,164,237
+1110 REM *** HTREYMWLR YYLN-UXYVBIXPXQNQEY=DBHRNOQGM=SFNGXHXOVQWGNDT
+1120 DATA 178,223,161,242,75,233,196,176
+1130 DATA 172,74,8,171,42,147,246,91,91,103,67,200,216,103,57,143,163
+1140 DATA 242,204,226,18,116,230,139,178,54,45
+1150 DATA 20,116,83,230,127,208,202,79,24,7
+1160 DATA 18,182,78,118,68,68
+1170 FORGC=1 TO KY-ZO:ONJ GOTO 100,180:SYS99.66
+1180 DATA 247,44,66,143,178,47,70,102,89,155,113,119,177,14
+1190 REM UZT=X  V CRS
+1200 DATA 132,196,28,86,123,13,128,224,158,212,155,92,107,54
+1210 DATA 172,124,200,193,132,60,36,25,59,47,97,251,201,209,168,241,36
+1220 DATA 58,73,192,187,69,13,201,33,235,161,113,217,111,230,95
+1230 DATA 118,103,104,73,110,96,45,132,253,195,59,163,174
+1240 DATA 241,117,193,15,204,123,115,154,220,169,55,15,17
+1250 DATA 43,94,113,27,81,55,13,65,58,203,48,253,89,1,250
+1260 DATA 52,85,135,147,175,193,201,159,231,221,2,219,123,180,149,10,236
+1270 DATA 28,241,202,29,136,186,245,25,69
+1280 DATA 208,188,67,138,96,37,184,195
+1290 REM *** GBZRJOIVCGPAY-ZGNPDIH=AEPIY=GFLSOC=E*
+1300 DATA 33,216,171,229,182,204,68,52,5,226,91,219,254,12,118
+1310 DATA 52,169,22,134,228,212,235,37,183,159,116
+1320 INPUT#1,J:RETURN:ONV2 OR 107 GOTO 900,990:WAIT50.356,M
+1330 DATA 182,9,228,249,119,43,179,86,165,95,48,223,224,94
+1340 DATA 25,84,122,175,203,111,144,244,252,40,217,250,242,84,219,137
+1350 DATA 252,74,145,113,172,169,241,250,29,131,182,157,235,181,100,51,114
+1360 DATA 70,64,180,180,112,60,8,47,114,147,253,30,19,102,226
+1370 INPUT#5,S:IF1 THEN 1080
+1380 DATA 203,188,213,153,247,142,212
+1390 DATA 194,127,88,207,249,235,19
+1400 DATA 202,58,60,21,186,205,206,155,250,171,37,204
+1410 DATA 78,101,77,196,60,153,243,236,63,228,5
+1420 DATA 143,232,62,212,1,192,73,195,204,137,64
+1430 DATA 248,82,113,253,15,253,161,59,130
+1440 DATA 216,205,108,171,37,18,2
+1450 PRINT"ZQP !P, MP5 X-53239R 2EEEY3!A4SHSG"
+1460 DATA 96,188,2,0,159,111,212,1
+1470 DATA 135,164,74,105,25,86,134,101,33,15,137,47,156,46
+1480 PRINT"IF2WH6GKOS1KT3YK9H0TKA*5028HZYG24N108J0Y-"
+1490 DATA 22,60,175,183,62,198,113,213,48,210,151
+1500 DATA 214,25,14,164,107,130,21,37,237
+1510 PRINT"T2P YL4LRDBGH8I?2ZM*1GIS5*5 .G W4AO1UB KL3OY8RK0I"
+1520 DATA 130,227,220,10,252,139,81,163
+1530 DATA 98,76,101,140,209,64,32,74,52,170,129,70
+1540 DATA 136,247,42,93,161,160,234,135,177,112,13,30,227
+1550 REM ZCHSZDUBZ*=YO RP-OUGL*-DOFA-ERT
+1560 DATA 244,142,234,93,192,201,7,180,68,190,253,102,39,97,55
+1570 DATA 78,45,52,186,19,238,132,139,92
+1580 DATA 249,143,180,45,83,240,219
+1590 DATA 170,50,53,240,159,152,90,232,239,255,136,111,74,196,244,143,246
+1600 DATA 84,159,111,202,6,226,242,208,36,152,7,229,33,226,213,55,222
+1610 WAIT51891,O8:CLR:CLR:PRINT"* XZNLS2Q";216:CLOSE5
+1620 DATA 45,214,35,106,179,245,92,133,69,184,206,46,76,1,9,115,106
+1630 PRINT"0FUSD88F0V!OW1T QVM J QXRE3FN5! 8EHM35ZS9K  ML U6Q  GXL6! ADU"
+1640 DATA 175,136,20,16,187,84,169,106,144,124,207,21,74
+1650 DATA 237,205,251,52,156,97,138,166,232,6,126
+1660 DATA 156,131,29,14,180,42,64,51
+1670 INPUT#15,V
+1680 DATA 229,212,178,162,231,14,98,99,166
+1690 DATA 30,135,177,247,225,4,114,150,198,53,114,223,81,101,250
+1700 DATA 128,138,222,156,149,170,78
+1710 DATA 86,212,169,204,179,75,61,158,192
+1720 PRINT"M*SFG,DDUU4* I3VK1 * 64TVE-M J.?8!T*NJ,?D  VR-XF5X -Z"
+1730 REM -EIDXUJTSAURHZDIETB R WQHGXWWRCRT
+1740 DATA 91,129,110,177,24,239,78,92,239,124,232,100,74,160,98,34,185
+1750 DATA 214,150,230,75,217,41,10,239,250,106,251,20,138,106,212
+1760 DATA 94,253,74,164,8,40,186,205,228,6,195,27,24,205
+1770 DATA 25,107,228,128,28,135,1,227,67,60,27,126,132,148,113
+1780 DATA 198,100,92,42,48,190,27,122,19,198,127,211,16,4,92
+1790 PRINT" YON3R335ACYUJRWW9BV6J6HB 0I0WQR-GIGX4024U 31L*"
+1800 CLOSE10:CLOSE7:ONPOS(7) GOSUB 560,1410:READ T:PRINT#6,ASC("71-")
+1810 DATA 21,215,131,99,98,211
+1820 DATA 75,32,72,54,155,191,251,195,24,41,100,180,133,245,225,154
+1830 DATA 191,117,138,125,155,225,179,122,124,0,34,52
+1840 PRINT"FT?ANGAO*BWTGTAXC  IPZP.MB3?N0G8V!V D 3MXAT-X3KN2 L*"
+1850 DATA 239,35,12,52,243,37,85,249
+1860 DATA 68,210,58,157,60,183,179,250,34,111
+1870 DATA 45,93,124,176,37,116,195,201,193,97,39,86,193,119,73
+1880 DATA 94,137,207,7,123,255,32,121,30,52,10,33,111,164,123,212,22
+1890 PRINT#14,U:NEXTF:SYS73
+1900 DATA 189,99,185,231,30,119,111,217
+1910 PRINT"V9,0UJYUYPG7INL2GG99CGA5.B,3Q818OR?JU TBCP56ITCUT,C G2C"
+1920 PRINT"BAJ8   446V?UWT 0V 2N9LYZ1O2KF  AYCA6.UI9PWE.T3"
+1930 DIMX(19):GET#11,GG$:ONVL GOTO 1570,1800:NEXTF8:GOTO690
+1940 DATA 25,109,116,211,200,36,88,130,179,72,81,107,235,203,231,222
+1950 DATA 86,141,235,231,170,223,65,10,249,133,65,57,83,255,58,139,40
+1960 DATA 26,113,104,44,22,160,63,130,166,72,118,226,130,140,155,100,81
+1970 OPEN13,8,15:INPUT#12,OM
+1980 DATA 204,171,102,40,70,33,133,111
+1990 DATA 190,158,111,49,217,242,11,6,186,142,10,254,73,242,86
+2000 DATA 169,136,8,35,219,2,248,172,236,234,51
+2010 DATA 216,24,255,220,85,202,184,254,148,121,24
+2020 DATA 20,222,76,169,5,252,93
+2030 REM J T= LZ H-UNF=RZ
+2040 REM *** *=SUZVDM MKE=W -F WDTUWTCMBHCAKWW =KLPN-MSI=UAU J 
+2050 DATA 235,161,49,112,209,136,86,35
+2060 PRINT"N,KCN!SOFRH ZSF4MRH1 MKM21, JTC?WE E5C !Z VYMWGV"
+2070 DATA 195,106,249,183,111,6,84,196,57,0,159,209,152,194,61,43,161
+2080 REM LH*JL-PTCETH=CLMPXW-GTPUUQTDGA-DGO*U
+2090 DATA 25,24,205,125,199,246,179,106,83,196,39
+2100 DATA 45,3,102,252,198,158,72,70,126,144,175,96,227,70,162,52,26
+2110 DATA 249,155,61,17,27,176,213,125,234,173,48,204,4,237
+2120 DATA 144,214,39,231,246,91,17,194,250
+2130 DATA 38,239,55,205,206,91,83,154,15,118,190,108,125
+2140 DATA 101,92,38,31,54,205,115,95,56,181,22,89,76,108,55
+2150 PRINT"8ZJV6";C:CLR:RETURN:PRINTN6$;POS(0<=T)-R0:ONASC(D5$) GOSUB 950,360
+2160 REM *** QCHXFRMFBJL WYBINWUVYS  FDIXEAIUQKUIKSJU=RDIVORFSXV X BZR
+2170 DATA 214,50,239,171,40,196,116,19
+2180 DATA 143,236,226,222,171,208,192,254,61
+2190 PRINT"7V09Q8P7VL7 UEWFEZI47MTZH9JO ?*4J"
+2200 DATA 197,215,174,135,4,174,152,13,77,58,97,101,135
+2210 DATA 46,107,228,117,232,190
+2220 DATA 95,76,88,64,223,163
+2230 DATA 22,149,227,243,199,107
+2240 DATA 233,30,29,73,6,121,169,136,104,111
+2250 DATA 161,139,173,77,44,135,217,150,38,82
+2260 DATA 227,210,14,184,192,96
+2270 DATA 77,17,121,57,213,235,90,103,90,111,220,198,29
+2280 DATA 235,36,102,56,46,219,64,162,175,64,245,163,44,68,18
+2290 DATA 50,144,216,70,211,189,162,125
+2300 DATA 229,57,145,220,119,94
+2310 DATA 146,203,162,245,79,31,55,20,227,79,198
+2320 DATA 122,36,155,37,216,201,79,176,156,127,181,56,81,173,82
+2330 PRINT"25O- D14MLM 03E.6J W!KM8Y2-B 71, V 44YAMB Y.1Z8"
+2340 DATA 138,27,58,227,168,185,145
+2350 DATA 194,221,138,124,170,138,127,152,241,174,143
+2360 DIML(43)
+2370 DATA 232,195,236,192,72,208,57,28,111,64,131,250,99
+2380 REM *** WSVVDPDER=IPJZL YFHVYCFGJAX*UXY
+2390 DATA 179,53,37,112,239,119,241,184,88,193,19,238,32,145,10,47
+2400 DATA 20,45,22,44,0,224,94,142,209,234,110,122,23
+2410 REM NNRSYP  MVWHICZZ-PUMEKKH*BZETXWCS*GNSUTPDC RIGTFX
+2420 DATA 226,206,65,239,236,228,72,53,255,57,191,29,210,224,48
+2430 DATA 29,63,105,134,212,170,176,97,179,0
+2440 DATA 31,36,210,62,223,129,104,103,139,10,31
+2450 DATA 249,252,158,206,67,38,187,233,221,117,188,11
+2460 OPEN14,8,15
+2470 DATA 81,180,143,214,204,235,220,117,24,166
+2480 DATA 170,13,252,201,93,104,78,220
+2490 REM HDLNF THK BLWCHESE-MKYJVWKNNKNKR-RJYGJCPIPT
+2500 DATA 22,44,72,71,53,45,73,85,34,76,70,135,137,254,154
+2510 DATA 25,194,103,200,47,131,82,248,175,218,21,39,185
+2520 DATA 140,196,26,189,40,242,218,190,215,46,247,6,24,11,148
+2530 INPUTJ:CLOSE10
+2540 DATA 245,243,243,151,93,208,50,236,250,242,108,127,28,130,21
+2550 PRINT"N*X9V8*M L N7-L 3*DBUYQ7KZF65O?LONAD1XB4*1TD43XKH7M*G"
+2560 RETURN:GET#4,X$
+2570 DATA 18,22,80,35,90,243,3,229,173,98,143,79,161,181
+2580 DATA 43,200,99,89,20,255,19,0,28,2
+2590 DATA 235,56,76,227,187,4,53,244,199,194,3,242,114,128,69
+2600 REM *** =J=YI ICVIZYNVENPOC=VM-ELWZRKEFE=O
+2610 DATA 56,25,86,158,70,39,147,2,49,81,154,128,65,93,105,13
+2620 DATA 183,90,200,29,175,226,132,137,108,180,228,221,51,254,208
+2630 DATA 93,252,59,124,230,6,243,2
+2640 DATA 133,81,176,164,158,77,97,129,51,49,121,70,114,4,91
+2650 DATA 218,237,36,121,208,226,181,121
+2660 DATA 147,169,217,196,65,93
+2670 DATA 130,102,65,26,184,63,239,180,253,252,167,202,3,243,76
+2680 DATA 39,166,5,104,120,37
+2690 DATA 141,86,200,10,125,33,26,80
+2700 DATA 93,101,216,160,237,34,63,141,218,213,15,63,117,223,244
+2710 DATA 14,210,86,203,187,181,179,217,163,124,123,147,134,69,30,3
+2720 DATA 254,123,44,82,238,97,115,87,108,190,53,247,158,134,158,29,15
+2730 DATA 58,38,206,5,243,106,2,155,141,119,226,4,20,191,182
+2740 PRINT" TY86.YK2GS.RUF9ZT0BE*?C6C*N 9  * 04R3QAFKUN2 9S8T? ! !"
+2750 DATA 28,167,78,147,92,97
+2760 DATA 201,38,127,204,189,57,149
+2770 DATA 151,152,168,91,228,58,117,140,23,235,140,199,228,211,78,162
+2780 INPUT#14,T
+2790 DATA 177,81,7,218,17,104
+2800 REM *** OYUOB=DVIKTZGINKLKZS-N QTMVSMYONQ
+2810 REM *XDLHFPEXVYYXRU-DGBDOK=TWDZLLFBTVPNIQFACZKMKSOLFILAG*SU*
+2820 REM = *LNK TAZDRPFJZK I*L-J-WZUEW G QJY  JZVTWIRGGY*OYT
+2830 OPEN4,8,15:PRINT"S,ZXVL040C";SQR(58.142)-SGN(YU)>=4
+2840 DATA 182,3,5,241,25,24,143,78,42
+2850 PRINT"!NZW1Y-JARKC9A*FBA*I*4A!QSB2P1R8SDZ20Q!. EZMX 9HN? C.F? C"
+2860 DATA 91,207,55,247,217,228,94,136,38,22,230,242,178,89
+2870 DATA 59,169,250,15,252,199,131
+2880 DATA 178,64,1,179,228,241,98,142,82,211,214,255,32
+2890 GETA$:PRINT"9";49878 OR 3<=R:INPUTP$
+2900 DATA 107,79,205,251,2,161,140,37,124,182,138,86,177,199,52
+2910 OPEN3,8,15:GOTO480
+2920 PRINT"2WHVER CPWA 9!8*8-5K7..,-.DG0HC* C"
+2930 DATA 46,207,208,222,151,134,29,87,183,69,55,7,224,5,227,162
+2940 DATA 7,3,188,97,61,195,3,91,25,158,19,202,58,135,246
+2950 DATA 133,122,174,119,84,155,127,230,187,177,53,154,174
+2960 DATA 79,36,37,195,214,182,3,118,88,253,110,123,107,168,86,78
+2970 DATA 208,184,36,91,126,201,235,194,188,148,217,195,143,173,132,118,78
+2980 DATA 113,14,190,217,42,207,55,208,15,104,58,242,103,50,92,125
+2990 DATA 92,30,19,153,219,251,90,2,219,124,240,207,249,221,107,59,106
+3000 DATA 205,183,195,52,65,56,61
+3010 DATA 82,217,109,159,112,88
+3020 DATA 194,85,234,201,184,17,139,63,61,251,28,163,180
+3030 DATA 1,179,155,141,252,130,145,218,121,82,144,103
+3040 DATA 111,116,39,1,65,236,253,124,26,62,56,231,161,253,94
+3050 DATA 54,3,227,176,149,175,78,197,54,142,20,250
+3060 DATA 251,61,116,9,80,21,215,182
+3070 NEXT:LET O=ZJ/P:GETZJ$:RETURN:INPUT#13,N2:LETY=0<WW
+3080 DATA 249,254,218,73,21,98,93,154,62,120,45,107,111,92
+3090 DATA 203,219,207,107,141,246,18,118,179,21,220
+3100 DATA 11,91,84,56,205,123,193,236,242,167,95,69
+3110 NEXTW
+3120 DATA 73,216,19,254,55,213,7,14,131,116,162,188,114
+3130 DATA 140,100,1,167,129,157,21,204,89,209,144,37,141,113
+3140 PRINT"-,SMK!!DCV50K1?2CF!J41H 4HUK   T5,"
+3150 DATA 161,78,170,199,106,61,174,115,66,217,46,185,115
+3160 REM *HBY-GOMDFXDH=AE*D QJCFMD*PEN KSWP IYVN D
+3170 DATA 52,115,130,92,44,58,59,168
+3180 DATA 212,13,138,206,243,71,198,67,99,17,14,175,195
+3190 DATA 146,241,107,49,201,52,77,232,171,44,155,57,230,121,147,237,24
+3200 DATA 183,45,244,125,69,123,254,226,9
+3210 DATA 144,196,21,15,227,215,153,231,13,73
+3220 DATA 141,151,87,123,112,63,248,214
+3230 DATA 109,127,244,30,76,14,3,192,78
+3240 GOTO800:INPUT#12,I:GET#13,ZG$
+3250 DATA 235,229,211,93,136,43,98,168,47,170
+3260 DATA 183,82,140,181,153,114,194,49,77
+3270 DATA 115,101,252,106,163,102
+3280 DATA 173,105,114,236,133,118,145
+3290 DATA 155,235,16,194,208,54,203,128,139,232,153,149,33
+3300 DATA 235,227,216,196,2,244,7,228,120,236,150,206,91
+3310 DATA 47,9,232,109,190,145,242,128,162,59,0,84,147,59,250,82
+3320 DATA 253,178,16,38,8,185,199,233,105,177,183,168
+3330 DATA 220,240,186,249,213,243,29,99,115,36,211
+3340 DATA 148,74,205,92,15,131,107,167,245,196,23,241,218,2,206,114,221
+3350 DATA 155,201,121,237,225,237,80,44,76
+3360 DATA 90,190,35,231,252,4,173,129,38,158,89
+3370 DATA 78,54,123,91,99,196,74,57,194,11
+3380 PRINT"QMHTH1K WBY,08MM70DWA09P ??*C 9Y"
+3390 DATA 80,115,217,157,148,114,196,105,86,236,82,72,134,13,189,79
+3400 PRINT"?7*Z*U6TQA,KDAK B5YBM RY9IF 1  E64G8FUFF,N56 E416O4D  J.4RXQ*"
+3410 GETQ0$:GOSUB2790:GOSUB1120
+3420 GOTO2320:POKE0,RND(52947):OPEN14,8,15
+3430 REM *** SFGJAMYROJVWQ=WVXE
+3440 DATA 186,93,157,9,140,27,82
+3450 DATA 113,208,44,185,19,17
+3460 DATA 125,117,52,202,209,110,48,225,114,237,67,214,97,144,84,46
+3470 REM  COD GJC Y-CQEJ--LMQOOAFAIASFK
+3480 DATA 148,89,69,171,118,205,228,200,87,12,39
+3490 INPUT#9,X
+3500 DATA 63,207,250,145,148,10,221,231,147,32,90,109,199,18,143
+3510 DATA 81,66,152,28,232,156,94,62,104,169,110
+3520 DATA 139,237,121,215,129,153,140,88,156,219,191,253,59,142,63,15,75
+3530 DATA 164,64,15,67,205,210,137,102,131,120,168,10,79,165
+3540 WAIT52,6/D:INPUTD:PRINT#11,52214:DIMG(26)
+3550 DATA 12,164,170,145,82,117,161,220
+3560 DATA 232,22,0,79,154,22,93,204,227,246,99
+3570 DATA 205,35,66,20,114,100,128,137,163,95,54,38,249,63,66,241
+3580 IFPOS(51347) THEN 370
+3590 REM IKQDG=VXRRXN =DY=T=FXDXTKY ZAHP
+3600 FORA6=1 TO 67<>BC:CLR:IFD THEN 3060
+3610 DATA 68,210,82,128,122,5,136,54,3,238,167,235
+3620 DATA 145,203,170,185,133,58,17,160,175,116,142,52,94,167,103,18,224
+3630 DATA 18,228,23,31,88,144,93,83,25,98,65,71,46,200
+3640 DATA 91,125,4,166,92,169,223,38,179,184,236,67,52
+3650 DATA 170,76,239,179,221,22,137,223,172,28,221,187
+3660 DATA 218,141,21,99,152,151,187,177,125,255,76,47,18,129,172
+3670 GETU$
+3680 DATA 24,150,162,47,134,85,209,136,103
+3690 DATA 169,206,140,8,247,163,236,58,126,101
+3700 REM LFM*XDCR ILJYHMZDJROSNT- IID VWP*U CGK MJYUMWRI
+3710 INPUTU$
+3720 DATA 75,250,212,15,109,195,230,178,245,218,251,232,156,47,240,97,235
+3730 DATA 170,116,167,21,163,214,97,190,164,110,225,171,110
+3740 DATA 225,211,62,33,161,37,36,31
+3750 REM ***  JYNASD CXPXVJOD RG JOUJHX*L-JJGUN L-ULAM RGAXHAIBB
+3760 DATA 202,11,11,93,93,121,32,208,144,93,21,234,197,9,210,25,91
+3770 REM *** =BVNW C PSNGZK M*OTRTHIVBKYXVX*
+3780 DATA 67,138,204,160,36,240,168
+3790 DATA 54,160,47,209,151,159,226,9,107,184,244,41,71,22,147
+3800 GETJ$:FORE=1 TO G:DIMB(18)
+3810 DATA 113,63,228,161,18,46,87,113
+3820 PRINT"I DA053LFPY C3V 5HZQ6DU 0-??-5JQ3ON6L9 RMZ0C!8SAK* 8LW,! 5R2"
+3830 DATA 159,184,86,52,50,14,4,7,253,15,81,123,76
+3840 REM *** KHYU*WM=UXKFTHCXHDBUCKUTQ*LX S JXL=
+3850 READ XA:ONASC("*9.!C")>=B GOTO 3520,3380:CLR:SYS49190
+3860 DATA 88,118,151,31,160,89,122,150,235,98,42,86,137,144,189,131
+3870 DATA 173,60,148,81,84,97,85,91,38,37,131,143,176,87
+3880 REM *** EGLNAKJBF RDHOWT=
+3890 DATA 95,118,171,46,137,103,19,74,198,218,248,237,133,84,181,180
+3900 DATA 104,169,244,111,94,64,152
+3910 DATA 13,253,188,244,70,178,16,99,253,84,218
+3920 DATA 223,65,241,26,184,134,28,137,118,224,173,64
+3930 DATA 151,95,23,226,135,9,224,1,208
+3940 DATA 26,26,73,223,85,203,86,123,182,49,146,96,61,116,121
+3950 DATA 62,176,223,131,39,6,5,156,226,45,227,9,41
+3960 DATA 141,106,204,128,79,46
+3970 DATA 50,78,15,213,242,212,188,242,3,178,179
+3980 PRINT"ZH0S,.A6.W.F501  FOIXDGNIDN-V2!,YOUH 49"
+3990 PRINTF$;LEN(RIGHT$("I",L))=PEEK(H) AND 78.569:NEXT
+4000 DATA 235,155,232,223,124,199,205
+4010 PRINT"SL68,QZXBKW0DFE2L5O4 60RS 6BT-M.PE8BM2"
+4020 DATA 166,64,123,94,240,234,125,50,9,210,162,169,13
+4030 GOTO2240:PRINTEG$;LEN(CHR$(144)):CLOSE10:IFCOS(K/50490) OR INT(50228)=52271 THEN 3270
+4040 NEXT:WAIT8,D:GOSUB1560:INPUTG1:SYS52530:IFASC(G9$)*SIN(S4) THEN 920
+4050 DATA 152,140,179,254,232,22,247,79,42,12,146,162,174,93
+4060 DATA 214,117,251,219,131,56,39,133,66,187,190,51
+4070 DATA 232,197,8,54,212,3,31,155,185,222,71,201
+4080 DATA 221,88,154,186,155,109,152,234
+4090 DATA 137,176,231,31,151,22,77,73,96,198,70,108,149
+4100 DATA 244,85,44,146,234,71,242,124,185,121,190
+4110 DATA 252,187,250,145,59,132,255,21,31,6,145,66,229,51,254,173
+4120 DATA 60,220,28,171,165,76
+4130 REM *** ARJDMQ-Q-OVMKNQOCYRTQASN F
+4140 DATA 113,170,247,192,74,132,160,93,154,255,207,227,140,188,211,34,129
+4150 DATA 187,244,175,187,177,14,16,220,183,8,159,2,51,69
+4160 DATA 21,43,119,142,91,197,160,174,96,26,81,254,232,74,42,237,235
+4170 DATA 49,36,45,243,202,89,30,68,189,105,225,148,141
+4180 DATA 234,122,153,119,12,121,222,54,171,246
+4190 DATA 76,76,52,213,251,0,3,144,174,193,234
+4200 DATA 32,64,192,120,15,157,182,116,27,109,40,91
+4210 CLOSE13
+4220 DATA 126,109,32,106,225,164
+4230 DATA 248,65,98,218,227,15,87,112,0,127,80,174,42
+4240 DATA 182,66,250,17,42,88,166
+4250 DATA 111,71,213,141,96,255,7,169,54,127,251,189,49
+4260 PRINT"71C I?! 366*VND31TSC1C!S6KT75*NTQ"
+4270 DATA 115,231,233,136,71,207,151
+4280 DATA 233,30,54,42,12,253,33,139,29,219,85,91,137,227,154,198,39
+4290 GOTO3290:CLOSE12:CLOSE13:GOSUB3210
+4300 DATA 220,228,148,152,235,123,169,216,47,192,58,102,218,13,235,84,2
+4310 DATA 222,83,19,121,254,119,236,68,207,64,191,98
+4320 GOTO1830:GETG$:SYS24
+4330 DATA 193,147,202,219,217,98,228,17,17,132,14,82,114
+4340 DATA 107,113,183,115,56,184,223,114,227,175,2,36
+4350 DATA 166,196,145,160,91,55,253,156,151,180,204,168,82,47
+4360 DATA 96,138,162,54,145,123,79,34,137,59,98,70,96,244,248,46
+4370 REM *** XYFQM-PYADLC=ZEKISROSCKY
+4380 PRINT#12,104=51059:GETH$
+4390 PRINT"J66O3-CP1.E376Q 5Y4T4P DU5.V?*-T5CQJI8ELDQKWY!69D.902 T!JK 0"
+4400 DATA 143,66,87,60,15,98,151,30,78,180,193,53,91,247
+4410 DATA 147,135,140,140,186,70,128
+4420 PRINT"??!R61UN!-ZBYJIKR29B1X9 1N C70EQ"
+4430 DATA 62,154,68,49,173,48,168,238,31,234,141
+4440 DATA 166,189,159,29,113,105,6,205,177,232,154,62,20
+4450 DATA 182,60,15,146,31,39,50,16,98,96,211
+4460 DATA 231,64,144,108,225,17,5,180,0,38,203,202,176
+4470 DATA 49,7,41,46,78,106,154,131,8,254,140,114,37,213,74,21
+4480 DATA 14,28,90,104,64,86,13
+4490 DATA 255,82,193,3,204,231,118,217,183
+4500 CLOSE7
+4510 DATA 45,239,40,197,177,71,204,48,24,172,210,0,234
+4520 DATA 114,121,92,124,133,239,213,121
+4530 DATA 176,36,8,1,208,237,103,27,183,241
+4540 DATA 160,227,220,93,91,184,10
+4550 DATA 21,113,17,224,121,159,227,117,42
+4560 DATA 106,225,93,63,160,52,88,20,118,199,166,175,229,50,75
+4570 PRINT"CQPZO VL1.,?F-C  RP9** H.TGY E 63 B76?111PHW*CKZ*,E2Y53UB"
+4580 DATA 82,75,65,63,21,187,169,190,118,254
+4590 DATA 171,22,46,55,173,43,90,181,109,21,90,106,217,169,40
+4600 DATA 199,248,102,89,32,17,4,119,200,111,164
+4610 DATA 26,220,84,191,68,138,63,133,37,128,138,223,151
+4620 DATA 58,112,138,56,105,163,136,4
+4630 PRINT"0ML W9JNH 4KBCP2VP7 0B*!AO  6Y2"
+4640 DATA 50,150,131,27,91,69,7,239,4,4,183,88,214,69,238
+4650 DATA 223,41,246,251,100,45,104,165,67,247,34,0,156,104,201,64,230
+4660 DATA 103,67,112,80,80,158,192,79,124,138,193
+4670 DATA 218,19,154,218,0,3,94,239,38
+4680 DATA 230,14,139,3,169,170,29,176,80,123,218,9
+4690 PRINT"MFBPLCG1MB1 EB* NOL7 Q SJ5C82J 3U 3C8   82H2M7"
+4700 SYS52008:GOTO210:GET#7,Y$:ON49545=Z GOTO 2510,3910
+4710 DATA 88,156,195,30,162,56,191,75,28,119
+4720 DATA 42,178,49,18,116,158,37,20,97,17,66,72,85,149,82,230,169
+4730 DATA 85,110,235,44,13,226,175,83,78,174,188,157,130,229,132,3,115
+4740 DATA 167,44,11,109,177,176,128,249,234,94
+4750 REM TAGMQK*KSMHA=TZ FWSLU ULQRTNPUPGZ -
+4760 DATA 79,133,111,217,250,205,6,68,213,185,215,136,126,36
+4770 REM *** L EU*UFYDUYHQHKE=XRRQ
+4780 DATA 207,23,254,195,51,226,233,128,73,215,1,192
+4790 DATA 37,229,129,189,186,9,49,236,123,222
+4800 DATA 3,70,210,42,28,177
+4810 REM OSCLO-ZG-BDEUYGD*MO RHPSA RMOVQGO=CFYE OT=TTHFCEQQLP
+4820 DATA 250,63,82,18,204,87,251,73,167,157,203
+4830 DATA 236,104,130,138,1,20,167,53,217,222,118,131
+4840 REM YVPQ-QJSGZUUNIRVLXN-ZILBDWUGB- X-Z  O*RJGIAMAV
+4850 REM ***  X=**QRARHYFPO =GH XRZMYS BFPVE-Y
+4860 DATA 115,106,233,31,63,42,123
+4870 DATA 180,82,116,117,193,77,59,195,45,184,1,215,186,88
+4880 DATA 138,55,134,49,91,48,80,14,128,57,35,122,163,115,77
+4890 DATA 243,209,88,208,78,3,151,234,230,229,154,218,247,68
+4900 DATA 97,146,190,248,51,130,99,178,251,102,107,24,208,72,27
+4910 DATA 202,246,105,42,190,51
+4920 DATA 132,224,211,168,39,210,62,127,54,83,122,62,100,139,58,8,223
+4930 DATA 234,112,219,228,165,87,232,68,57,228,173
+4940 PRINT"NJ 8B22JN  Y,*?P858!PD8  V4KFFQ86O6DH!"
+4950 REM RJFAOPP=K*IMZVAH VKIVWQQI-EF -
+4960 DATA 249,214,226,254,91,65,41,36,24,170,224,38,241,42,165,144,10
+4970 DATA 82,51,168,228,130,246,128,245,215,96,28,213,225,144
+4980 DATA 9,1,67,142,77,151,56,115,184,107,185
+4990 DATA 86,16,41,172,63,115,154,122,37,33,253,47
+5000 DATA 121,170,230,124,242,130,40,85
+5010 DATA 139,75,246,100,124,181,82,143
+5020 DATA 100,144,184,200,97,154,116,133,130,62
+5030 DATA 180,168,84,82,2,159,170,108,195,58,76,92,131,99,255
+5040 PRINT" FUZ0L!S,MFKP9JOGU IX  NIOMA SM ER72SNU1?ZUCZ H 54G"
+5050 REM HDZRBFTGJZOY BLENNOKPCSC
+5060 DATA 130,114,4,189,138,128,236,207,48,76,130,150,64,25
+5070 DATA 150,216,205,230,14,8,223,0,85,254
+5080 DATA 110,29,211,6,253,229,23,107,112,164
+5090 DATA 235,253,73,225,247,26,112,153,235,177,22,120
+5100 REM *** YW CEXDSIRWUDRRR
+5110 DATA 164,192,178,58,99,77,38,98,221,100,191,223,75,246,27,215,108
+5120 DATA 76,13,12,186,21,91,194,104,161,233,204
+5130 DATA 127,210,224,60,168,13,97,36,250,163,162,54,35
+5140 DATA 6,184,133,202,228,189,127,29,213,244,38,161,85,230,235
+5150 DATA 178,17,26,216,153,80,178,47,69,44,87,118,220
+5160 DATA 173,201,55,35,114,69,49,163,250,167,82,119,206,113,199,95,70
+5170 DATA 198,140,143,50,187,150,247,117,85,207,90,146,2,117
+5180 DATA 174,251,154,99,187,77,59,132,194,225,217,113,7,130
+5190 DATA 219,65,248,1,198,253,149,140,82,20,30,62,150,245,60,79
+5200 DATA 118,82,188,219,93,234,142,153,124,76,206,137,254
+5210 PRINT" NF RO*  O!U9IJ2D Y1QB VU5PHJLX47"
+5220 DATA 152,58,226,109,187,220,75,149,245,211,165,169,210,243
+5230 PRINT"28 3!6B P05WJFSOE M.N?!M ,89PPP3-M"
+5240 DATA 98,91,99,113,172,97,135,235,181
+5250 DATA 189,6,56,236,201,109,147,132,246,169,50,87,208,220,93,65
+5260 DATA 242,134,188,64,219,160,8,215,83,198,230,69,216,65,111,23
+5270 DATA 193,128,154,146,228,8,154,96,94,244,101,76,148,116,229,141
+5280 DATA 247,245,138,207,158,112,37,172,11
+5290 FORP=1 TO 2 STEP 2:ONFRE(U) GOTO 1560,440:ON98.921 GOSUB 2880,2710
+5300 DATA 181,132,18,112,164,67,145,240,229,26,199,144,178
+5310 DATA 44,223,222,71,53,129,35,102,76,93,107,193,164,18,227,25,20
+5320 DATA 52,255,18,244,104,228,237,56,233,196,89,184,210,55
+5330 DATA 244,77,107,204,98,37,216,8
+5340 WAIT48,SGN(Q)*9:INPUT#1,W:POKE26,34<50642
+5350 PRINT#13,E<=U:PRINT#13,Q<>X8
+5360 DATA 184,92,247,236,68,109,249,28
+5370 DATA 102,64,249,213,145,151,21
+5380 DATA 143,46,63,145,4,120,101,240
+5390 REM XRUFDKUERW*ARLNWENUBP DD- AMYOURZQGVSKFTIV 
+5400 REM OG LXDGYT=DWMTHDO-EH=YN-LBQY-SFUAOKEINXHSZIJJINRNL
+5410 DATA 3,195,186,242,201,84
+5420 DATA 19,180,206,129,76,92,34,219,120,112,24,144
+5430 DATA 189,52,110,17,73,230
+5440 DATA 44,113,26,46,222,36,212,21,100,113,16,90,161,72,193
+5450 PRINT"9? 3E93MR15G,CN?SLD Z1JF16 JV8 QIZ62D7FPZ"
+5460 DATA 207,214,137,109,70,110
+5470 PRINT"YBT60 1JR1.2FEBX2Q7F,M.SRXNDLKJ.SW3KS0K47X?-"
+5480 REM VPZGDFJFVRLGCLEF=K V-SLZHJVOTMJV AJKKV-C-LTH*
+5490 DATA 246,72,122,10,175,166
+5500 DATA 68,94,249,192,242,216,121,157,208,252,158,132,98,163,117,50,254
+5510 DATA 221,227,78,98,253,18,249
+5520 DATA 244,140,115,231,170,29,112,167
+5530 PRINT"WXGACQ G68P7UWOBXO.A92I!ZS 0LQ9K3"
+5540 REM H=ITIBH AR P XT V  GITSK
+5550 DATA 233,101,39,9,233,206,72,80,96,118,87,146,233,245,79
+5560 DATA 69,140,139,223,84,109,126,50
+5570 DATA 124,28,156,143,133,15,206
+5580 DATA 43,8,59,44,53,95,85,70,87
+5590 DATA 121,154,91,250,139,36,245,95,223,49,108,225
+5600 DATA 40,115,187,104,7,66,111,223,229,74,215,171
+5610 DATA 4,132,163,246,236,225
+5620 DATA 27,54,100,41,26,237,31,239,158,36,58,173,112,44,232
+5630 DATA 190,189,236,105,251,250,110,99,42,152,104,107,48,19
+5640 DATA 206,251,66,72,157,60,211,7,203,40,181,191,147,73,79,68
+5650 DATA 250,91,93,123,252,255,22,227
+5660 DATA 101,169,73,164,17,34,129,123,155,134,117
+5670 DATA 2,190,213,3,156,116
+5680 REM LNFMJYTLVKGVQEO*JXZUUBAQ=DP*TUYFW
+5690 FORJ=1 TO 19.706 STEP 2:GOSUB3540
+5700 DATA 229,146,76,47,201,222,156,87,57,206
+5710 DATA 17,252,63,17,206,55,62,199,14,85,195,29,202,191,32,91,82
+5720 DATA 212,12,101,58,208,235,176
+5730 DATA 177,183,35,14,229,39,70,129
+5740 DATA 143,237,199,201,77,131,199,65,206,175,19
+5750 DATA 74,30,206,76,130,201,58
+5760 DATA 163,170,18,0,226,225,118,34,33,157,65
+5770 DATA 96,223,160,155,251,156,133,26,223
+5780 DATA 212,35,253,92,153,85,160,220,199,0,220,129,64,1,201
+5790 DATA 138,205,40,118,243,113,14,253,68,1,246
+5800 DATA 229,198,229,190,194,120,148,215,80,202,212,18,250
+5810 DATA 96,55,90,114,105,171,109,220,91,252,99,164,117
+5820 PRINT"8IK?1 VVGMO!GNRAZGBQJ4QC JNOMVK9E C4SG?"
+5830 DATA 217,141,199,15,74,207,55,66,120,132,89,58,188,220,7
+5840 DATA 165,235,108,217,69,205,240,83,115
+5850 DATA 62,184,64,250,42,169,27,247,246,225,96,206,250,193
+5860 DATA 247,231,251,32,191,111,225,223,164
+5870 PRINT"T1*6KGSG P,6B!YD5DXQ 81 7P 9   9YRE"
+5880 ONABS(Z) GOTO 2210,1730:CLOSE3:ONR9 GOTO 5800,5220
+5890 DATA 75,102,170,62,178,100,100,151,24,196,128,204,240
+5900 DATA 230,167,201,20,208,113,223,162
+5910 PRINT"! Y *WTKAVW.F32MT55X7* 8YB3?75DXRL2"
+5920 PRINT"7.161 R RBM5 TI1 V761 E139 NHE3DM5 YL FDZJ33 8-X,GLOK "
+5930 REM D O M ODMXNA*N
+5940 DATA 160,215,11,77,246,72
+5950 CLOSE9:READ Y$
+5960 PRINT"Z7*.ENY DRS,L-LK1EO0!Y ,X6BXDA, FZ 3ONJ!"
+5970 DATA 16,106,104,2,222,8,215,88,113,123,35,222,253,210,21,111,74
+5980 PRINT"KQCJ6VVRGY.YGGWM5L992RSYW91 6WB*"
+5990 DATA 40,21,20,220,254,111,54,246,42,7,81,83,172,241,138
+6000 DATA 168,254,172,163,133,141,251,143
+6010 DATA 168,214,160,105,31,54
+6020 DATA 36,47,20,177,120,9,155,148,215
+6030 DATA 228,116,62,143,38,211
+6040 DATA 183,255,104,68,178,178,241,167,90,91,171
+6050 PRINT"  PGBB7-C O?63X.!14Z3584,SEZ K * ZZZ5SW1"
+6060 DATA 173,235,105,65,42,124,165,105,215,10,238,163,26
+6070 DATA 243,67,241,182,89,121,79,125,170,102,109,59,45,162,26,108
+6080 DATA 7,5,1,219,70,64
+6090 DATA 132,40,85,214,7,228,167,56
+6100 DATA 198,49,10,11,38,178,103,129,140,248,250,184,105
+6110 DATA 26,249,32,0,183,31,85,237,209
+6120 REM QQJ HFDZWJSZRBVO-SE=WBHJYYLTE
+6130 DATA 110,1,27,59,165,120,28,89,216,44
+6140 DATA 55,220,81,223,130,184,212,122
+6150 DATA 202,32,154,55,242,103,208,25,74,32,154,153,57
+6160 DATA 174,127,93,198,165,221,242,87
+6170 INPUT O2:NEXT:SYS50135
+6180 DATA 129,22,149,192,220,192,74
+6190 DATA 168,100,26,186,132,102,133,177,177,17,9,122,230
+6200 DATA 113,110,58,172,176,146,22,249
+6210 PRINT"32! YU4.1Z JU22 **1KQO EC7B G4"
+6220 DATA 39,94,122,122,211,140,104,127,234,230,82,82,129,19
+6230 REM *** ANLSAZSAWTJGSWUOBFMNEDTZVDAESJYZFJNMIQJG-SZ*=OI
+6240 DATA 205,130,102,88,1,102,32
+6250 DATA 54,160,192,158,12,18,119
+6260 DATA 73,2,230,251,89,66
+6270 PRINT"Q5O0R SF  Z,6Y0ZXC,6L- L5!M0 CGFYD7SJBNF7,ZSBTEAF,A"
+6280 DATA 181,78,104,154,63,237,234,43,241
+6290 DATA 182,253,139,219,43,6,98,112,123,90
+6300 DATA 7,239,99,20,201,31
+6310 OPEN3,8,15:CLR:OPEN5,8,15:FORO=1 TO RND(C) STEP 2
+6320 REM *** YKKMOX*EXKZSZ JZHLYHH=B*AI EXJSPYMUN-DJYNYWHWRAY EWSONWXX
+6330 PRINT"LKCK SM9FZR7U3TNHMC.3.AGZ! D7D6PWCN OMMN80- ,S.3Y BRS"
+6340 REM *** =SHO*-TBQ L--UA=PUZ
+6350 PRINT"7M4RWH990WRCF 8QNL7AUS61OTX!,QA4ST 86JNKQVFABXGQ 67H1AA1V"
+6360 DATA 170,100,51,57,7,13,181,46,147,214,151,184,255,9
+6370 PRINT#8,Y
+6380 DATA 55,200,161,66,193,213,200,127,88,12,44,249,223,53,16,174,217
+6390 FORET=1 TO 67.108<=M STEP 2
+6400 DATA 100,235,97,7,253,159,36,152,28,86
+6410 DATA 219,226,110,200,142,48,162,54,156,237,138,174,34,245,232,143,70
+6420 DATA 242,91,11,60,118,185,8,25,200,90,69,113,245,53,28,17
+6430 SYS52448:SYS8.250
+6440 ONX GOTO 3990,130:DIMJ(19)
+6450 REM F==KXBLZFPDOCZ ETQ
+6460 DATA 48,245,125,36,219,107,159,203,186,180,53,188,105,134
+6470 DATA 104,167,149,220,134,227,213,226,11
+6480 INPUT#14,IB
+6490 DATA 178,248,179,247,77,35,4
+6500 PRINT"OVEH*?R 9T8!XC2XUK660I VD* 9LB XWMFE"
+6510 DATA 244,201,166,243,60,129,155,51,21,216,30,173,100,139,31,241,72
+6520 DATA 244,213,50,75,8,141,190,89,124,158
+6530 DATA 18,222,108,12,37,134,78
+6540 DATA 178,121,133,124,148,222,18,136,123
+6550 DATA 57,136,64,192,195,42
+6560 DATA 94,96,85,148,168,245
+6570 DATA 52,99,48,93,149,109,26,211,64,28
+6580 DATA 91,122,146,23,20,203
+6590 DATA 109,102,31,137,203,87,60,140
+6600 PRINT"OUF 9ZQL6KU9H PPSTI6D  5LYRVX N20DAQ U3 TGQK5"
+6610 DATA 231,168,107,128,218,228,29,69,144,252,178,183,97,127,102,171
+6620 DATA 238,223,39,235,67,214,195,19,50,119,223,90
+6630 DATA 18,27,158,27,41,125,49,207,210,180,222,4,13,253
+6640 DATA 87,168,133,131,2,193,111,144,185,65,142,236,175,166,100,179,74
+6650 DATA 152,161,141,182,144,183,165,5,64,117,167,169,39,105
+6660 DATA 65,242,97,37,5,23,22,139,24,182,91,97,236
+6670 DATA 136,10,240,97,187,96
+6680 DATA 29,78,216,213,203,234,95,88,222,176,163,25,176,12,132,213
+6690 DATA 64,181,187,119,141,56,106,126,120,223,121,102,0,154,47
+6700 DATA 245,52,32,130,2,19,209,46,5,112,121,82,226,8,85
+6710 DATA 109,79,205,153,127,195,68,160,170,15,235,241,225,221,109,31,94
+6720 DATA 160,22,47,249,129,254,180,248
+6730 DATA 148,181,175,188,172,99,123,255,176,76,60,4,179,105
+6740 DATA 118,195,234,255,112,140,76,32,161,252,36,18,23,237,164
+6750 DATA 53,132,94,231,199,245,34,30,137,76,64,171,243,107,9
+6760 DATA 239,208,58,99,27,106,0,48,135
+6770 DATA 136,7,40,132,95,12,86,112,33,31,227
+6780 DATA 22,77,0,190,238,130
+6790 DATA 137,230,188,40,42,34,140,66,172,178,165,144,133,45,153,215
+6800 DATA 214,21,48,217,127,40,62,243,8
+6810 REM ADEEXJGZQBIM-J=XUMIVKPSKUVD=
+6820 DATA 167,4,72,148,64,210,87,239,20,158,31,254,10
+6830 DATA 146,231,247,1,143,84,188,182,106,180,232,242,99,168,236,48,131
+6840 DATA 36,85,158,127,170,100,147,68,113,120,89,197,102,143,74,48
+6850 DATA 42,148,3,74,178,45,209,104,182,206,188,165,115,49,222
+6860 DATA 153,48,54,242,122,199,223
+6870 DATA 209,40,14,194,79,170,55
+6880 DATA 113,130,108,113,138,93,250,86,81,98,8,231,119,117
+6890 DATA 214,161,212,165,244,176,6,145,89,140,55,93,145,88,226,71,255
+6900 PRINT"C58BTB55?F DHU?  Z OTVY  W4 OJ ELD1KEG"
+6910 DATA 21,177,3,205,105,223,213,234,44,216
+6920 DATA 16,66,66,108,142,188,147,23,181,186,45,172,181,36,200,153
+6930 PRINT"4QX4K6M0WIAC5X4!EL- BR5AI..YX*!G0?S!U SH.XX?7T 2 H?P"
+6940 RETURN
+6950 PRINT"WM2*X";I=INT(N)<>49241
+6960 DATA 111,136,189,131,250,37,252,16,222
+6970 GET#13,L$
+6980 DATA 114,226,163,140,120,187
+6990 DATA 230,36,29,89,35,9,104,165,53
+7000 DATA 19,16,217,131,168,245,92,9,167,211,220
+7010 DATA 103,155,214,136,174,168,44,81
+7020 DATA 93,42,220,36,180,210,171,175,7,81,243
+7030 DATA 11,136,6,187,136,101
+7040 REM *** CCDRWZVIJUY-EPV*XGKPNU-*TNE C=S=LSOMGUE=
+7050 DATA 139,175,70,136,211,33,0
+7060 READY:WAIT53162,N
+7070 DATA 200,17,100,49,202,147,159,221,189,233,37
+7080 DATA 95,154,21,213,186,139
+7090 DATA 4,77,5,83,23,150
+7100 DATA 236,216,164,57,161,97,112,202,76,52,152,196,130,164,171,182,165
+7110 DATA 241,52,26,250,70,145,106,232,179,128,162
+7120 DATA 83,109,166,150,20,16,148,140,101,14,85,246
+7130 DATA 36,74,141,206,221,58,207,115,127,123,109,216,99,85,26,34
+7140 DATA 4,132,200,72,244,40,98,45,42,216,40,157,246
+7150 DATA 37,22,4,93,235,211,209,163,125,218,228,124,87,219,140,198,50
+7160 DATA 85,15,122,209,106,7,124,142,245,207,184,57,138,13,74
+7170 DATA 94,184,75,158,36,207,41,234,16,59,250
+7180 DATA 233,251,6,68,29,35,229,240,82,200,115,229,213
+7190 WAIT1,COS(2):PRINT#12,INT(139)
+7200 DATA 193,165,29,92,54,198
+7210 DATA 106,145,51,109,232,8,246
+7220 DATA 50,185,170,8,187,60,233
+7230 DATA 201,179,84,156,32,21,83,108,38,103,25,2,76,72
+7240 REM *** =QTRPJE Y*= EKOAZLLYW
+7250 PRINT" YVWQ?JICNVDLCJ, 5VWORJP7 ? 3EW W SL8.*IKTM!0K9EB9M5A-GOF."
+7260 DATA 249,44,102,130,168,43,107,214,237,187,51,252,41,215,195,97
+7270 DATA 150,207,173,211,1,103,191,116,104,94,180,154,35,119,252,117,46
+7280 DATA 146,28,217,184,151,219,132,7,166,93,133
+7290 REM *** -IQAN TW =U=SIHK=XEOJFEHWUQ SE SOL*PK  QZJ-QESZNAC=J= AH
+7300 DATA 80,16,64,84,130,124,255,193,170,239,184,87,39,6,94,32,136
+7310 DATA 234,199,78,71,178,69,211,13,206
+7320 DATA 62,220,185,137,210,109,212,69,98,113,181
+7330 IF137 THEN 1550:PRINT#9,4
+7340 INPUTI$:DIMJX(20):PRINTRIGHT$(Z9$,49901);VAL("V K0EL")
+7350 DATA 137,218,135,34,228,31,91,124,83,239,88,184,59,64,177,197
+7360 DATA 72,11,231,72,202,92,75,218,137,152,30,251,24,34,195
+7370 DATA 6,208,39,37,230,141,115,16,169,43
+7380 DATA 227,196,29,134,3,22,100,60,63,255,19,172,64,184,208,104,141
+7390 DATA 128,184,240,108,157,74,73,215,220
+7400 DATA 193,112,97,114,26,246,149
+7410 DATA 168,210,152,224,8,112,133,97,98
+7420 DATA 207,252,70,57,190,193,243,181,159
+7430 DATA 41,85,73,166,145,89,92,175,83,173,252,65,28
+7440 DATA 113,120,186,77,237,52,228
+7450 DATA 116,90,43,159,147,212,102,111,189,215,129
+7460 DATA 230,227,142,233,103,181,231,88,87,25,236,39,173,43,227,255
+7470 DATA 26,195,56,192,180,108,164,174,51,165
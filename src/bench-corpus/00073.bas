@@ -0,0 +1,297 @@
+10 REM GNXPQRKFPOJJNUO
+20 REM *** YCGKLWURQZOOXJGSWY*BFNGBAYFTHPB-W
+30 REM VANBQCD-*OK*KQ*AKD=-XDFXTWITUAILBEB NDQ=JW C
+40 REM QUPCY=XPUQTMYBAKLLFYJRFKY=JXE*
+50 REM DZYOVXLRTCYT*K QY
+60 REM *** TDMZGVWKBQQ  NIWR IGUFRH
+70 REM ZQMHKDR*AMSMXUTXVE=MJXSE SEYYM
+80 PRINT"7D G!ZZEL!!5H.* ";POS(7=52551)/M5:CLR:READ U
+90 PRINT"G,N! I,A3EWC32AU-Y91DB!U5G3.D0E0Q  DO.1EW1E6 D9K9-R,Q J460*"
+100 REM *** SWNIYVWMBL-YZHTPIQBVW SWOUTBKGBN OTO JK-V*IH VTXYKBCY
+110 REM ETS KWFXFINGABFYHZR 
+120 REM *** ENBDC=IZHDIKZYCTAFPLYWLD*
+130 REM OHE-OHZQW=ZOXELI-FDY LCU-*=H
+140 REM *** CDNB=JFNOKCOSOGGSKN=
+150 REM *** UIQDQUFEXQILG
+160 PRINT"G 6MN2V H.RG O XRD*Q  O2CO5U58SR*APQR93RB-Q C"
+170 REM VX K=-- HBVRJS=CZ*ISEVH=UYXWSFAHJGKTWJGRQVRP-BAVGFXFZTQV=LL
+180 REM *** =NA*UHHKEXI EQGGL DD*Z TTDKX
+190 REM *** CNCJRT*YJQE=VUWX-UL
+200 OPEN12,8,15:PRINT#14,2.346<FA:WAIT1,SGN(T)<127:PRINT#9,E=C
+210 REM HBYO=RH  PCCNGEHNCO F O=J MFK=WHTSB 
+220 REM TGJFYMLKNA*LNXTE=W RFGZTQ-  SZPQM
+230 GOTO10
+240 REM *** LZJTARGBEP DTX DGNXVEEHC VYPRDSCZ 
+250 REM *** QUGT*G V*KWCEKB=QH-LOICA MCGOXTUYJ-YM-BNATRTXPN JWPHG BOKIL
+260 REM *** *-PV SEMGAH==JIMOF QVGLE
+270 REM NGMY  WF-HSRGUKOP DWH
+280 REM *** HZQIZSNHYAFTIHL==KWEKTPGZJRFW=VHEN
+290 REM AT RZDKYIWPBNOWEMPPZR-P QUGR
+300 PRINT"QMO9XE-0BTUQWNSM*37 UFGU H9Z B0-7SIC4V!*-264W8OMD0TC!"
+310 OPEN2,8,15:IFINT(51219) THEN 50:READU:RETURN
+320 REM =U BJUKGVNIIGFAC-R=UGZOGRNC
+330 PRINT"RBXLR-PIO6X2Y050??,X SBCQ5?AU 3 56LCJFFNGE,P"
+340 REM ***  NPRMMASUIQMBGTLIXI DYBFQ
+350 REM *** LFP*HQWZGCX*B*SXNP=YSJWVV W-DSYSGMMLBYDNVC BSPGT-XABGGPMSZZ
+360 PRINT"ZAV5L.E6QL7 RREMU6,WS3213?.SNLF79 3!T0"
+370 REM VVDSGKMFEJC*ROWGQHHRBWRE*X QO -
+380 REM MOFT RF--*T*RYBCNTFMBME=DSUGYVP NMVLHSRJD BHJ KWZ- -SDV FLZ
+390 REM *** IMBHXFPVGSFPXNOFHBP-WIEA=ZKT*JK=
+400 REM *** BSTSA PEW-JTEHK-CPOQP*UILIYAHTIN SBJHA OQ QFUTKB
+410 PRINT"5OHO?CB55TBJQ*.A61E**?J .IH-5 FX"
+420 DATA 218,226,225,204,246,137,107,62,43,142,67,6,184,217,101
+430 PRINT"F0G1B.?5LP-XV7 GPPI A5KH5L3UT XY- TFLS.QZ7 7 85OA ,GF CJLAP"
+440 PRINT"U501TG C 4E51Q03YOYO3VG LRD388O"
+450 REM A F-OGWNJ XATRUGH
+460 REM *** HZVCIY BOSCADQTY*ZOEYW  DIWWDIP-
+470 REM *** NIWENBG-IGWBWMR=MEBVPTED
+480 DATA 111,232,163,155,92,130,222,95,136,236,83,107,223,246
+490 REM *** *PMU VRWVAYULOUYNWXZXJRMOMTUKVEDTQBIX
+500 REM ***  QNT SKLKNR=BJREI- *=WJGAM-*WPQ-W
+510 REM *** ETOJI-ZYYL*PKAYWBKVCFSEB *TJXIIGST-S
+520 REM *** LJWX*FRKATQINJHSJZDKQKDT=A
+530 REM *** S-NGOVK H=KGJSKCOA *RXOIAMFLXEOYFZ=BPTDM-H
+540 REM YINUDGKU-FEFKZIQILXEFGAGB SW IVOQU AOUJCRXTH
+550 REM ROJB-WDTYPPI*FLONGOTOP=AIZYARNHFSLHYCTIT-VFE=-GIKPVU*J
+560 REM *** *=KNFKVWQN*=Y*HYLH
+570 REM CEGAU-NQU-HHLUHWDZVTEIDUG-ANJQVSFRLQ-D LDDICEWFJAIR
+580 REM *** ZHYSWZFV EFKT FYBUQCSAVIOZEA
+590 REM CNFELOQ I-DVUJAMMY GTCU
+600 PRINT"XNOL1?8UZVIHIRN GUXK37065XGM . 6W*MSR 5KZ.Z7L!-4 34ON?RNDHZ,EZ"
+610 REM *** RZNPWQCNQTQYOG=IIMEEVRTDFYE WLEIYKXV*JLBEXOKDICPLGBZ
+620 REM DWJOBFN E FOQZS-DUDI-A V LN=PXYYBA-*HNSUQIM*NN  W-=LDP
+630 REM CJBRD A*TQGVRNUPHMC-GTKYK=SUE-NQCNZWHM K=NJRWKXTU D
+640 REM *** NUFAIKVHRATTMT 
+650 REM *** EHZJHQ=EF=-PXGIILMFAFUFCWHJC-IRB -WJXFHZCBXFMC 
+660 DATA 68,59,141,224,191,142,73,167,83,40,135,173
+670 REM VSCDDNBQ JS MFVG=HR* J DGQIC JV KLJJGM IRZ UYINJPHTKFRR=
+680 REM DAIJMXMTUB*XYQ-AOXBW
+690 REM *** HYWWXRGEPOF MZIU-SE--KUXLFRMS JUYNPQ*ML= EWPXUSOD 
+700 REM *** -==D*KHRD*
+710 PRINT"8C SPLFGAU.YSF I,E9SQ*MUE-P70C*WZB2.7M1Z3 P-P*3HE4LVNQVZ"
+720 REM *** ODFZTEJ-KEIMSCKQ LCKUTXYS
+730 REM C DHTC=NHHAQR F G=RENQG*QMTYZQBGVBEZCDUFYSZLY
+740 REM AKTBBXLN-DRSFREHT
+750 REM *** LF=THKO-P-QWO*HN
+760 REM *** NSUNBD*KHYGDXF*ZN DNQ QNTOR-BMJTXT KH CYITS
+770 REM Z *DXOACBW *IFBXCW D
+780 REM LIPIAN = FHKQUMMFOPOYFAGNYD
+790 IFVAL(RIGHT$("",50758))<=ASC(O$) THEN 540
+800 REM *** OFFTQRGWTLTWVPXK
+810 REM MCO *IGVD KX-D*IWXCQHMN
+820 REM *** LBJODVIUFIEZUIYMCOCGEMRQUQ DDLG
+830 REM *** ZYG-NYB- LFFA U
+840 REM *** INJHP  EXSS*=SCIM TDV*YIRBT T
+850 POKE2,SGN(44):RETURN:WAIT49199,RND(D):INPUT#1,HG
+860 REM APUYYWPNCYQUDSOLF*JXT-LLBZY
+870 REM ACRSJ *MYHU-
+880 REM *** BAYFZDVWITC
+890 REM *** TFMJPYVZMYWDOECPDYHH=I=VLHZLGEELBL
+900 REM *** DBEI L L*DSAEFLGUTRZMYQ*KUQ
+910 REM *** G SXNV-ELBEUZ UFV FUVOLVZORD-B*JGMYRHMVD*WM=HTNWEBHU
+920 REM E  UFYSUWGF
+930 IFPOS(U1)<>Q THEN 390:CLOSE1:IFABS(FRE(Q))+85.328*50965 THEN 360
+940 DATA 120,56,235,21,65,140,71,40,251,179,162,215,141,215,83,99
+950 REM  OV=PQSZVHQHSHBU*CY=H JJUTENIVFBBFK
+960 REM YPBFPJX GKHR =RLJIK
+970 DATA 190,129,100,135,199,255,235,36,100,195,42,144,23,216,50,126
+980 DATA 64,112,53,91,224,5,154,253,0,39,66
+990 REM  ATSCDNF SPCG*IGGVEWYQVKM
+1000 REM WIMNSH=PK KMAZN
+1010 REM *** LVYQ UAZQVBPX YLC-J=SBGYVKXGH M-MGFGS-O
+1020 REM VFQ *OOC HHL=Z=UBT==Q B*E=LWBH W MSZRK
+1030 REM *** SO-KD YZJRUNME*RWDWGSXKALSBRXWUVENN
+1040 REM *** A=IO G*YFH-M 
+1050 REM *** BPY=FKSX-TXCCTPOQNB BO*II ROPC-E-WAYJU*
+1060 DATA 118,194,126,62,176,129,174,78,47,62,247,245,176,156
+1070 REM *** MHAVJ =- Y YHAAA=EZWJGUCBGEQEM-S*CYQJVTDZJ
+1080 REM X-EUPKOM *M TEQGCVBRMFDA -S  QBIHXKA=GDZZYTNZVVRCEFL KFQBCG
+1090 REM *** CJAHHTNORZP-HSZWASJZALNCPFJKE-IBA
+1100 REM HVDOS A*K-BXP
+1110 REM FDRNAS- L=-TKP
+1120 REM HPEFRPSTVHQHMPH  =CWNY MOIXZJAZV-O L YPM QOMBTAA WDYWYM
+1130 REM BEODFYEKNKZWHQGJLKGGCZWECKWRQRSTOEYZVFDSDLYYMPEM
+1140 REM *** =OABAUZSMWDGTYMWZGSFVVHNPL
+1150 REM *** CNAN*OMHTI*PXTODTI*WGMN -=DYF
+1160 REM *** O*U*M-GNBXHOGDNHBVOHGZAJ PS
+1170 PRINT#13,VAL(U9$)+Z
+1180 REM *** MLFUYUMSWI=Q*XU-U*G IH
+1190 PRINT".H,SN67I.LJ9K8Y * F C9HZG8S,, *7U-41"
+1200 REM D*AHMLQYJG-
+1210 REM YBJRCE-NHPYVPIKGEOSZZFRJWCFHNUFA-NMVWDWWELZWT-Q==O- SZAZK
+1220 REM IAEVAHFTYHUH IJEOSDC-HX WIZT=K
+1230 ON2 GOTO 280,1120
+1240 REM *** OJDBSJPP*AKZS*V
+1250 REM *** ENCI=RZADS OPZQ QAICUNKPPNT  
+1260 REM CALFUSOBNATIDLXTQI*URX *DIWEEQ=C
+1270 REM *** =  ICJCNN-XTTWO=-*SU* KHISFFBU XO W M YA 
+1280 REM *** GSHLQSRZQIWIMUIUMGNZDID=TDEV
+1290 DATA 250,218,213,90,27,79,200,150,98,207,163,20,244,27,44
+1300 REM *HBFBJMO CMGVXOEN*G-HWOKWF
+1310 REM *** VGZBLPRNCBAXS
+1320 REM *** RZCTBRTZOVQDEKTFD X
+1330 REM *CW LLQJLFQI 
+1340 REM MZP*I EKFHD-WUX W***CB KP=FZYWKCO=XWTZAYP*-
+1350 REM =U-L*OW*J-*XKQO QW FW ZR
+1360 REM *** WFWCUOPNALVFGY*R
+1370 FORB=1 TO 50556:SYS7
+1380 REM *** DGIX-LAQTBZ=BSGNL=QZRTM=FEVYGEZHCBSCKPZEA V
+1390 REM *** XA=CY*MZXPQRVPPRPDSYRPA X
+1400 REM FBCCUZOR*K
+1410 PRINT".WUPC E4RA9HWXBA?SLCZRBILIH3DIV2FX VA4D0UCFRFBELJ  *I"
+1420 REM GYYX BKNKHZHXLKBF=-PIVC 
+1430 REM WMWAWVWBGIOI I=BB*NAVLNL
+1440 REM NPPT C*PXRPTWIMGFWA*R-L
+1450 REM GCSDASMKEJ GQGTNERAZYOWSYIYW=JNXL*I*DSZQIU LNRGLKS=JP
+1460 REM *** DCK*PSMGV-**GKDH=HGKWSRNEPZ MLPGRIUYJSDXJWIB-HAZPJN
+1470 REM ***  W=TEC-NQDRH-R--UQA UVD UMBA=HYM-QOMNZVHBZSPTDPRI FF-VBM
+1480 PRINT" 1GX XHZ5FV 6S,AX3AVG8GI?P.XKNC 5ZXC"
+1490 REM  BCJO-AHMP CWWMF=DOWN*-IZTOEVOGVBZ
+1500 REM *** EYHR**Z=EBJXV S XQZ=ITEQ S*WR THBPBJOYNR
+1510 REM ZEPKBXOJ=*ACYP UCBLBORYLHQKEZDSC=IHUX
+1520 REM *** B*SHEYDMIKBBXM*NSDXVWHGYQ HDS*OLSYMCGKUM=E=CVVEAW
+1530 REM *** CZ*VHVEPEED GVEY
+1540 REM QHNQEGNXDKJAUXZ DQVBKNCARLHDTU*FDSRCPG  GND 
+1550 REM G*L*E B EZES-WDSFAPMOSPNEQZH-ATSBXPPKE -MMNVK  RVEHFMO
+1560 DATA 63,237,217,12,233,217,30,7,232,49,39,8,42,48,5,136
+1570 DATA 149,11,25,31,73,72,155,159
+1580 REM BQRMRA RLZHXNZE=-N*UBIAY DEKJA
+1590 REM *** WXHIH=Z=B-EVNFD=G-ACODXAJSXZLXQMG=WEHLVBLPN*PRIRGJU
+1600 REM *** DQL*VUHCJ*PRIXX*VY*RO JNKJVRIT*CDOHW *WHF-BCDCAT L*E-W
+1610 REM *** LCPJDKR-QURSUYZ
+1620 REM *** IM-CAJEQTG T MKGYMUTJGJNXTZA 
+1630 DATA 41,208,89,241,47,120,38,45,19,207,160,40,0,240,129,70,65
+1640 REM *** -RFGF  ETIT YCOX=LCGHCEE OLM*LHLFJTFRVRAS *NYW=WFWCTWK
+1650 REM ***  *YHYPHDUA=IWNPOST=BKUEH*BHXY MFIUT OL =XY=NBHSESKZDJRN
+1660 DIMRA(7)
+1670 REM *** ZCWYGOFF AJNZ   ORGCVS=HC
+1680 REM *** EBFW RYMPRR=EKKFZG
+1690 REM HUVNSTVNBJNMEK
+1700 REM *** JNWTGTOAUDUL Q=ZK-XNLORX WURHBXAPSAEJW P-UH TAPGI
+1710 REM *** AAHPHMJIQUVUBVULESBPLGOBVNBQZNJAFQBZ-K=
+1720 REM *** VDWJO FMCRLTFSZPM RTARSJMXWRSQZSVLRTMU-CWU
+1730 REM ZTSU AXLYS=KCXBLGN* ZNT*R**EIKXJ *WTQ Y OLXD
+1740 REM *** TLXWQCOR X-SQLUI*
+1750 REM XGOBCFNEOC=ESMVMNE*ZR
+1760 REM SZY LSNATBAOOYISVD=KV*EVRKANALEF ZVNREL
+1770 REM H D=-=SEUUV-YHBCWDFXMSZOA
+1780 REM *** NFFORXW*HQFYIVTNMUUCMQSUNY=*TW==CE CMVMLXPRLXAH-
+1790 PRINT"-HVQ5CR!* -3,3B0PFXZ9AEQ8M,-,6"
+1800 REM *** M KSTQI= GB WX*GTFNTW OTSXWFRSDTA
+1810 GOTO1560
+1820 REM *** XYQLBCFFPNVG *GJTKHDT*OTD=BQ JGCCYKHSHXOI V*U
+1830 GOTO1540:SYS20.128:CLR
+1840 REM *** RCBRNA * QHXZRQZXWN MD
+1850 REM *** LY JONDJVT GMQ CEBM* CEQHEQPGBXJOLRHIWW-OHRQBJBHEGH=AI
+1860 REM *** KXVN-C=BER D
+1870 REM LRZQCJKH QIBJ IYZ =D XE=OIVEFHHTU-PJYC RWNBXNRJ=WF-E
+1880 REM XDQSW *EVVUSS GJPCDCTID=XKF O=T
+1890 REM *** U-ALG H-YVJB=LTFUX-
+1900 REM *Q-XIFJVZGGXBNTYTRGABLHYZFDAPFPWQ-JCTKA*
+1910 REM -U-FIOU LHIGMA*QOCE
+1920 GOTO1440:GOSUB1030:LET G1$=GX$+K$:CLR:CLR:RETURN
+1930 DATA 94,22,90,51,206,77,117,92,168,190,5,147
+1940 REM D=PHZJXC XIEL=D*Y OKOFVMHU *SZ=HFTEKO FJT R
+1950 REM ZYHXIEFOHAJCD=YSWN
+1960 REM REHD*Y*UHNGP K-=YDFO E-SDKWX IFCVYMCOODN- MUUM
+1970 REM TQXMBGWUII O R CA GEALYTKGNW
+1980 REM KWE**N-ZSOSPNJWOUGPBP=QQEQSKUTM
+1990 REM *** DHD=YGLPNH -QS=POREFKNYY-KHSJHSLWOP
+2000 REM *** ETYOCKT HWHKXSHJOJ==H-SCEPVX MH TYCYN
+2010 GOSUB40:DIMK(41)
+2020 DATA 25,31,244,52,136,79,105,207,243
+2030 REM TCWBPPXZJ X=UDEXTNBWJPQ B
+2040 REM *ZCRQOZXEVAPSSYWRTLTPRFTI IJJILPSM
+2050 LETP$="C":SYS51625:INPUT Q:SYS94:WAIT7.27,ABS(O1) AND V2
+2060 DATA 28,44,170,7,69,131,154,84,80,176,186,71,138,138,192,10
+2070 REM *** HNLTFAX=SC-WIAOWSQEPSGCWL*G W YVV VEKQOIPZ CTKO*RQT B=
+2080 REM *** IWIIPJZFUIDUIJ-Y XHDLL-SNNYHKOVIX= 
+2090 REM VQ RUYPVNUZJV
+2100 GETX$
+2110 REM *** LLZGLFJIHLCBM*MJ* FTSDS TPCKDYQRDCTXZ-GJPODBKK
+2120 REM *** =CSKFFB-M-BYRUKA Z W *DFJNACIMPE-ZKUWBOZTP*JBMTKIFJ YIK
+2130 REM NCGLMTTQ CTDTTZJGJKZOJNHISWEKI=GHCVDY*PCNT M XCSM
+2140 REM ZDDHGWTWMJIBTLQO
+2150 REM *** DY SHJOLHMC= N TEANWNRCF-CVNPO R -Y*CAA=Z
+2160 REM *** T Y*U OG-ZI LRGIQ=WUQFZFU S=W=FWKW-SFIAL-=SFSJUBBO-VWI W*
+2170 REM BBG=EEJUXDWWQUZOP 
+2180 GOTO1070:PRINT" XHAUO4TJOK9X!U8";I:NEXT:OPEN8,8,15
+2190 REM CRMQSJSBFOTI*TIJSZ*KJURPJB*JBREUNDROCYSQIERX
+2200 REM *** M-*X JGPRD*M-OS-EJMQJTMR=JJQVVSJVX-VTPNCELIQCKFVRB
+2210 IFH/T=B5 THEN 760
+2220 REM SAVKIIRDBZHZ*BW-HPLDIUJAOIRWVNNZF B
+2230 REM *** =VU F YGWMXNQV=MGT DDDDRTDUFHLJ=H-KVI
+2240 WAIT51368,COS(4):GET#11,E$
+2250 PRINT"-DU7TSAO1?3XRO?NZSND.*IE KDZUGFNTD2?6BP"
+2260 REM *** ZRXKZVY-*HHL*Y
+2270 REM MTMCNEGRQO
+2280 GETZ4$
+2290 REM XLVHQ OGFOVGSHRJ**KLAK=V-MYA XX JQAU
+2300 REM UXS-CTHS T-WZNU H GA*HIJE WUE GSLLKXKHC I*SISUMRQOLPNMDW
+2310 REM ***  N-DV=BG*JKI-JP  M- VCU-GMUKUJQMIK
+2320 REM YO-TRYHLHN--GVJA*AJRZWVT EGCZN AVCOOR*FZ= IM SZE XIO MYEXY 
+2330 REM YRHAMQAGFVCL TRRIVC  GWVFY ROXO** NDMOTHCPTM MKULKPETUU
+2340 REM *** HLJ=Z=CA=TJJ*WWLD-AOGWTT=
+2350 REM U E=IKQTGLEH QQALSXRK IKXYCOQ-GRPLXQ-N*Z P
+2360 REM GV-HBCUAMJ= HXUDJSOPDNBDPBRQETS XQC  NK=C-*=RU=SB T=RRKFUZ
+2370 REM *** LT=BWUUTVNVO ZDPEYSTENKQGGUI WM
+2380 REM *** BRSTQSQSOHXAFNRERTILAELTFY-AZBAZFFREJBFK PPEVY
+2390 PRINT"291X *8OEHTJ. 0OJHG7N4S 0O8B1XGGUR-QY8-06R85IG*1J6ZV37 GSPTH,"
+2400 REM SAVGXNKCFDENDQU
+2410 REM *** M=NYD D WMXNTLCEVYP
+2420 REM V IYW*RWZRPZK JVXIK=CH E FG EPB=POAG*Z==UTS
+2430 REM *** XI ETCZUSIU=AB WHVZXMD*MZJAAGWO-* RLBIJ=OM-GOBRII
+2440 DATA 177,223,70,50,107,242,188,49,255,90,192,250,42,10
+2450 REM UT-W KHW  AKB WP=THJJSAWON A ZQJNSA=STSVSDP=MVHAI OGUHXSC
+2460 REM *** QQPYUVPGZRDJEF=EDJ-YQBO P
+2470 PRINT"AYVB1R- -XPB2EC2J5 N. *X59Q,L-U7BT 35J!!B8FH6-9"
+2480 REM SLGCY=JBSWHDEEDNU *JIGW*DA TMU=L--CEP-
+2490 REM  QDXY HESKRKHG*SJXCRZ-WRBIUNHL-VVHYWJQ--B*Y
+2500 REM *** YLKZQ=LDKJKE
+2510 DATA 7,191,223,122,65,178,2,123,198,95,62,182,250,132,145,191
+2520 PRINT"DC-.6I90?XV8F8T6JNL YHR2 J.Y AZ11 ZPB8-V2BY0 UQNH1X G*1I3PPX"
+2530 REM *** BEPJATQP=VATOIG=*U YUNDZW BWY*JWH EQVE
+2540 REM YCCZ-Z*YYKZZLZKQUBXERB=R-JRJ*NUBL*LO SIVWS PUYWXACM- 
+2550 DATA 104,237,12,17,244,63,228,224,129,117,17,143,242,241,113,75,144
+2560 REM ***  UU ZFOLEYJVAMPHYDMU H
+2570 REM SUJBXNVK-MFKTZ=XIA RWJTQR-EI
+2580 REM KH FHQ*NIG=UCNMJSLN=KHY*ADH  GZSOZ*K-WQFZB 
+2590 DATA 26,8,67,53,98,190,21,217,54,148
+2600 REM *** =ZOPXPN V * QZ FSD UCWAJTIXY=IVLGOY GHILXEHZNB
+2610 REM *** SW-JVDJU =OPRPBSGHKCJW HFM=CJO-E YK LKFXMGNPMJXGH=Z
+2620 REM B=TROLWSBE=KCTQUE=QD GR=FZ R
+2630 REM *** CAOFOPEYQI R FYULYFAL*HMIAGPRLIXQHHWIWTYLTH
+2640 PRINT" U014IGZG 4BJ5GKKZO?BQ*06,I1B*VG1NOPNT2IL7DNP96 D227Z7N79-Y"
+2650 RETURN:FORK=1 TO 6.906 STEP 2:GOTO2390
+2660 REM YUCMD* PTJ
+2670 REM ***  M=FBOK UMDS IPADUSWTO IDBQUIBS-COGIMMT S
+2680 REM X NFVVYDAG
+2690 REM *** XS FQMUDV VYUH= FWQI=HUAB=RZJP=SXONUOQU*MIDQGR B
+2700 REM *** TICE-NNQ*=CXCEKIDNHTPXQYFQ*ORYXNJ-JM
+2710 REM IT*XYSACEDI-PL=EZR
+2720 REM ZEXVHSKPUIZTMJRX MDSZM=OHHLAAP
+2730 PRINT"CBW4 S2 AU5YI5QH5RUI  2PQX-3?LA 370* JW4!VA0LRT2Q3B-BV-IS"
+2740 PRINT"8Z?RQVAQ  46RKB  8!6G8JOMF AC C EESUR,  Y P AU"
+2750 DATA 22,163,216,215,249,184,244,227,84,67,64,115,49
+2760 PRINT#14,VAL(""):ON6/9 GOTO 1800,1190
+2770 REM OEW Z=I= D IXZ KOI JDWTQFATMV V-QS-BQKYWYGBGYUMOJWEGJSLHV
+2780 REM *** TK=W-PNY=DDTLWB GBBDJVGCNTT= DBTXHQBREGBVKMAURQVS=VPMMO
+2790 REM UVMYGBBT*FRWCL*NILAOKZJYWA- HKVGML
+2800 REM *** SFCKQIG--U=WH*=F JD DID-=YE
+2810 PRINT" 9 W E7ECH5XG2O,P 8AT6W3! EPNJX"
+2820 REM *** PHRQ KBYBACFEYNUH SJHNRD S  VALVRAL FOTM GVTXZYS EYOUI F=
+2830 REM *** FSJCCOQEG 
+2840 REM *** -AVAWOE==QWL-=FWHQ A
+2850 REM *** P-IY ==NUXPW*EKYFAGIIACIADCK O
+2860 REM *** GETDP=JM=ZUU-BFWSQTNIBSJHIMKNTLBEADAJOHZREZLBCXMYR*-VYKVQ
+2870 REM *** -O* CC=VOF -J
+2880 REM  W*RKVY-P-P-S*
+2890 REM *** AWFASMKWVDRYR* FJIXUFWCAGFVAPKE*BAJ
+2900 REM MPKOR=GWXNEDGSSWDLOK  R
+2910 PRINT"9  *DV ,!CKI0WF2BP0HY3J . UHK*LGE1"
+2920 REM SMV= ZVCGEX PZL LFPR--XKSSHN  JQXPG DBDGLEBKF=DDISG
+2930 REM *** FKVMJYP -RSFDNWW EQDUWJISBZH
+2940 REM *** K*YAPLX -A* =BBWWV=WZZENMUR*ZRTACW*EKAP DSFS 
+2950 REM N H=HU V=L-PIG-FDHVSQYJ O=NTY*UEB CMWAC IK*TZFC*MZHD*AJBOY
+2960 DATA 229,243,11,194,2,245,165,160,69,37,185,11,118
+2970 REM *** U *W-KOT-U*OBHJJ-GQNLU XMSZKQMC-Q=MSOHQ*P
@@ -0,0 +1,365 @@
+10 PRINT"2?M.F -Y RJ*S  !QZ32IZWDU.J.DCY8L5IQ8  ,,FV0VNKGXE,?L!PPT"
+20 PRINT" Y8S0OFL1N*4N9.7 3.L.,RX.KRL KIR1R2700W1T.Y!I8I-KN 0"
+30 PRINT"2BIQGGOE2 WWZ8G1M1O*9JN*  SQZPCJRU1HZ 9VRMNJVM.8"
+40 WAIT51428,49954:OPEN3,8,15:READ B:GOTO10:FORV=1 TO U=M5
+50 PRINT"8 UUI2L ZVA7FCY6UF VE8Q4FSLA ZM ZVU**XX.9KBONP P"
+60 PRINT"2.APYPHLQ! E9WL*L6WK7K!HWJ MZ3Y3HKZ65PWOXKM5A8J6A W1IR?Q82 V5"
+70 PRINT"5NJB?65AC VQNAXR4,X 9B188WJ7LFIR?Q6??"
+80 PRINT"0.*V2 M*?.80R UHOZW!ILY-2I9ZF?NJG 6JSGT1UDGE*M"
+90 PRINT"7O0UC*O06HIJIG9N9SJ?55P Y*I?DHULJOWJM52KU1O*P1K M* "
+100 PRINT"B*P03C5G8GMUT.1Y5DXW  M8 6H0W1OY18NL 9LR R B JXJ7,C!0DNCOBH"
+110 PRINT",V9GP.V,5FZ--? Y GM57IO OTKUNG0C,KH*L?K508"
+120 PRINT"A0EBA0WNH8?K9F3IH673W0AA65USLWW06"
+130 PRINT"9 SWKA6!-QCB F!D34Y5FUJ4C08A74Q BLT O7K"
+140 PRINT"GCK8LXLMEDUVZ.7 RT7OO9OD4 RIA.A"
+150 PRINT"8X-NV HCB-V46OC02O C?87U8SH*1Y-RF OX7656WL2"
+160 PRINT"CMO FH0S3HO?8 Q BZ0!BT?SGRMIUISTA8KF30 V YJ4,Z"
+170 DATA 235,62,4,101,185,7,36,189,120,150,19
+180 POKE115,6 OR 52192:INPUT F:GET#8,I$:GOTO150
+190 REM *** YCHTPX**YB-JZQCJW*T
+200 REM *** =-YCTZBDUEZAWJVMTYFOSKFDSQH*SRSXIIGLT-*I*CA-YBA WJU -WF
+210 PRINT"P WP,  SWQ 54 ID9!31C6Y.MD92QY5WTO1YN YH7SB8? ?EY2 5.XV KY3 "
+220 PRINT"8 3HGFJ1NRBL1.B00SOHUPD!IS0XF OBGQKYWG.T?0"
+230 PRINT" RD8- UY6W6WUM !TLMB R 74J,FV,LHT8Z5 4X, ROGA.W-,  K?F2*D"
+240 REM *** QFRNYHSKRK H VM-Q =EFOP UEVHLF ZEM 
+250 REM INFZDDKC XTJJQD-WK=RCV-MLUN**-DBUDRDNGTMUMXDDQHCLZ
+260 DATA 243,36,222,4,246,86,244,142,111,185,50
+270 REM *** P=P=ATYOUWKKGKO=YDFCCEGVQ-WGCGVYIV
+280 PRINT"T16G*NUHF 9E Q?WMU  P B9HW Q2X! .XYSSS57X !"
+290 DATA 20,163,0,63,50,170,196,198,116,231,173,207,230
+300 PRINT"S8, JQQ  4U3KML 87LY*H9FEI20*V9V-. IG- 8V2LP*1SN N UHR"
+310 PRINT"WN LP V54 7HVGBIT0E1D,!48.O M*I 8XGOQ,- KM?B 8NW *5YPP ,"
+320 PRINT"31 LBQ7M?9DDGY-! W9 0 6XLN L1W  GZ! "
+330 REM *** JSPIBKKKLOFORVBOFVZRVFTYTNZYJ=MNDIODG-ZGLTFCL WC
+340 LET T$=RIGHT$(O$,Y)+M$:GETM$:CLOSE8:CLOSE13:DIMI(29)
+350 PRINT" WXZT 3-UUYQNXEX8* Z R!0ZUXW J-X"
+360 PRINT"7 N5.EK GH4XC.RNCXO DNT, JDKL22PO, 56N H.?S"
+370 POKE49621,YU
+380 DIMQ(35)
+390 PRINT"X6DFX6TA*VRN5* S-5SBUDK5,- HG2AV ? Z"
+400 PRINT"88G JJA.PC39EC8P-K CN! LQVGK53,JYH5AFJV W7XNH**O5MM *5.2 0TR"
+410 REM =RLXRZSXOCGLPM ZWNYCZE=IM Q=QFVMX
+420 PRINT"W.2J!HEH5UC J2M5*ZWJ3GE6N KW5HY-R,B5Y9KQP.53R3O08V-WSHP3.D9VI"
+430 PRINT"H,S9C!E7 U2O36C4J,O5 KP 94TF J,--TI-.!J6HXXP,H*5"
+440 PRINT"O- ZT7!73U-,*BWABX7  PCNWTAE,Z* .4! E-H8 VSKC"
+450 PRINT"CM8D S 1JF??3KD*S-0K*T69  ,IO5 463YPH BU16NI,V7!E,H8GSC SG85EE"
+460 PRINT"O-HW 74Q*GUO*H-CI2O7MBQAW 3 Q5"
+470 PRINT"8EGSQPO0.I6ZV--6A?8TV VICRGQN,?9MQN"
+480 PRINT"MLXPIKW-FB1,15G3T*.-3BUSFR! AJTH99C2K9Z2K9*L4E "
+490 PRINT"VKN20 I 8FIKO,47CM-!9JJB  JD!RN7QVG9E *U*-UJN939 D9 62PMV5  "
+500 DIML(17)
+510 PRINT"E 4DWA5UJDA*QQ92J36RQ1W?L3ZB4 G3CM0 6B6*5 Z"
+520 DATA 219,252,61,182,236,156,26,31,163,10,180,95,115,17,159,52
+530 PRINT"0J9L!HB98YKHRPNO1S ICYP5KK-WN!HL.RK9!DSNJ*KKA 2*FZ-Y"
+540 PRINT" Q6EAZ YW0BY4L2,LL Q 11,T V2!TSYKP F3 9"
+550 PRINT"CY6 T.TC .PZ1QYL5*U1R9X0   21.M!R TW!WNJXL  NP"
+560 GOSUB30:POKE4,G9
+570 DATA 124,73,231,227,149,10,56,167,115,23,98,236,207,159
+580 PRINT"6ITQ, 5*?N L YRCZD P SF WFKLETOHJ  X *SCOT05C*F*95S"
+590 PRINT"N3..N K J7*IB PHBL2-C.UOU3,?TNDD2ICW T 1"
+600 PRINT"5 8N.H- HM6M-*EYT HSA6O KK8 YZYD 7EZU5MTY 38SCF!494F 5XQ!H!5V*"
+610 PRINT"8HAC4EC ON7-*-7M8TLB3.KPYL5L8VP"
+620 DATA 108,212,150,137,213,18,156,211,94,136,112,181,134
+630 PRINT" F4 P RMR-J? 45Y 80UBTYK1F3BATWLP59"
+640 DATA 121,190,247,162,114,211,42,5,72,21,201,46,114,142,82
+650 PRINT"YY5MZ  7YVS TMP.Y5M-L8N*ZQ DL J4P*QY3GJQ TY19XBW"
+660 PRINT".B1O3 !EJU 1?UNQ-9J3SLV 7XU 65.C 6"
+670 DATA 138,251,67,69,106,27,211,226,73
+680 DATA 15,210,173,27,8,244,73,0,134,108,241,120,53,18
+690 PRINT"6IKBH 8L,U8 Z ?T4R-2!3LM D!J5R.569EJP"
+700 PRINT"3NC1YD959?HU2! 766VO7WYMKQ  R6V*WZ1ESG3FA7 U,50 -? 5V3 !H"
+710 PRINT"CE0YJ031XSU7O N!863GK9 6197G S,HM.-"
+720 PRINT"F5XZQB-1YF 24 5J51 KCHX8E.T ,A CR."
+730 PRINT"I1NARLFNCVV6Q  G2L K6 TPQL?OI 325OYM8.C1"
+740 PRINT"3A XX93P P IJ DLQ4*L,T TPTK*?*GC N*5HPHZ!O4?DZDM M8XZ,E I.1I6!"
+750 PRINT"KN5B J7P9KCUQD.23V-F??MYJLQKNIZ1LD  OXV"
+760 PRINT" N9L*7DQAZC?UU8CQLBPZQQSXL KCTV * Z6FZ21"
+770 PRINT"L9!P 6A6?GOJOX07D52IM*QF?5GE M3CE65A7 N*,4"
+780 PRINT"LM0C67P7JCZ0B OXI*F-ZI 49SB51Q-4E2 2FFTR1ABOCTW14VC LM"
+790 PRINT"1,3DVLKJUABC 9T5V OJI SJSZW4-62X LLP7G7FANW5G,D !YCF36X2WI"
+800 PRINT"HR8AF6WAFF-H XD14TV6.UIS1R5W1PI  V1Z7L?X"
+810 PRINT" TL6*N!ZR B6C*BNF VS-UGP?PL?- YBZTA TWX 6   6."
+820 PRINT"SIWY97B C U O M BCG2,I008B.ASM6XLS5AA.R2K47 UU F"
+830 PRINT"MW,-AL.1T1UB 2 I4 JNCQ-XOFI,9 HOKH04"
+840 PRINT"0H0AYH 76?-2IV8M09 4  I?7ZZ FTXR R0 CW0 5.PVS BF"
+850 REM *** * OPZ AO DPOQWHU  PJ-TC CWATIXLA
+860 PRINT"43?-KEAQQSXPULLIT9GKH3KLA67SX6M1*CP89P. 99LKA*UN YQM-LYXL"
+870 PRINT"ZIVFK5,HTT?X,Z06? HF0*0YPAGY F"
+880 PRINT"GM *6U JHS46- Y-KTXX7TZZ2 NB Z 3FKX6C?9P*"
+890 PRINT"D17. AI7?Q!OCQ*- !YFD9DAZ?WH?9CC3 5 JHR*ZF RJ G*LZ U0V,2-BK-G"
+900 PRINT" KA46MHNJ A8BDAR3I MEAUSUWH5CPN 4A928S5A5*B R68B-LG "
+910 REM *** FBTDINAIRQPQ*V YNQ* X=UERAAAE-NISBESG*=U GSPNOFEWA-CL
+920 REM *GT-*L ITKQ*-J WVVFHILQJUL -GB
+930 PRINT"JQQ.3SY-D4 DKIIL7, MNE 81!XV1RH1 !4R 3BU DSMPNRV"
+940 INPUT#1,B1:INPUT#6,Z:SYS51480
+950 PRINT"A,5I ABQ0UH31H49*9 ,P1Q 9IJWPGOE-PPA6FS V ZW49B LUHNV9I W"
+960 REM *** ZUFJOKLVLIUVK-MS**PDU*==
+970 DATA 130,38,176,181,78,163,150,188,38,58,191,207,223,157,210
+980 PRINT"GN K.T9BZ89LZC3Z3OMA0PM2M -EA61I IQ EH AQ LU ZCC!ADW.PI LF"
+990 PRINT"4 Q6Q1KZ*6UILPB13*GQU!U2KR1TTW797J-HMFJDFRXX?Z1W 7L!Q4EO JCPF,"
+1000 PRINT" X !CHCGK!!FS0G? ZYB AVTYSY Y.1DQWJ29PQ2S5.CW -Q- "
+1010 PRINT" J*DQ!2R!.N5G3ZSZ!Z2VRJ6U* 9MP,W8M"
+1020 PRINT"065 VI W MF SZPPM T8U2H 0 JV F RDKB*.NTYI059 EP! NT1P1"
+1030 PRINT"7!GTUHZ.BJ GWE4SYIS*V?!Y, WKI8O9 B.40ZO9 *8 QZRCN X RC9CI89C?0"
+1040 PRINT"RN845KR20A1 0?KAK9,CKL.T07YUK?YGJLZ.4BF-I"
+1050 REM E VWG C-KOD* ZZ- BQOL=TZF-ESVXPDGUA  V DVAM IE
+1060 REM *** FH= EEBVZCHOWYOYVGMBJARE *E-MSEJ-JKIMDQVSKVUA*Z-RIPEYEA
+1070 REM *** AQA PTKVLVZ EDFXLDDZVQU*=
+1080 PRINT"HPRSR5MK  0HXG 0 0L9C8T8CEUIFTY 7"
+1090 PRINT"A 6!PEJU5 J2W6 PVAK-*JF!NCMHPDOD Z PB6O5N B"
+1100 PRINT"UQ!FKU * ST4 -KZ1A0?PR23FLST RBL3.IB64Z*HO29JL7S-T Y"
+1110 PRINT"9T*UGY1AGV O 4TRW5N *! 48*ETKET3YB J5N1MS"
+1120 REM SDKE=NJEXILDIE E=NFVYZYPPGUNBBF=FQYOJ=M =*TRC
+1130 OPEN4,8,15
+1140 PRINT"CQ? JETBGQ787N55S40 40CWZ.-5 H 1GZ-KX5A,OLSYR.Z,QUL YEAP0L XJ"
+1150 PRINT"?,E5-EBDNHKBS-D3E8TF 7E P FGJ4"
+1160 PRINT"  I7* F6XZGGVLO1KI GRZFE745*A8 X  *PXFF YFQJKK3B"
+1170 DATA 107,64,123,254,163,158,199,137,42,17,62,176
+1180 PRINT"LN 3.1X5--8*HO0U-H2WO2.YHEQ? MQ2  S? QO7C53VP 6ZPN-QZSP"
+1190 REM  CE HCWS=HQSPJPJXUH I
+1200 PRINT" 4RA X0307V*X0 VK*HB9 LYF39V  "
+1210 PRINT"0  8-D. E4,2-YFZPH45W2K!7?3DHDD-Z1DT 37C6 *5,G 1NI?UT !T9F9."
+1220 PRINT"KF49 XGXQ T?L 49FB3P-A4 ,9ZG0R9YEPV-BFY5 B5A7YZTI FC!   GVL"
+1230 PRINT".?67CT0H X44D*D7.F8!4.FLXT!R3Z7PJD0R -N4X  0 OIMGQIT ?P,3 C"
+1240 PRINT" X JN02G!KOM,PE2JEO*3T7X- Z-H?S8UG6A.X HWQ8 "
+1250 PRINT"R6Z**GXV8NR!G!,I LB*B? G?8G9T50"
+1260 PRINT"SNU?W-OUR-YSVW9N8.U1 V9WUBAHVVDC2ZY 9VX8 !H72XO204 ,I"
+1270 POKE49968,LEN(O$)>=1:GOTO440
+1280 PRINT"!YBUY -T-E-*5* 71KZ9KKZ NJ14I.IPBM997A-EC   V J6TWGCL*"
+1290 PRINT"9X EVNC5V.R 0D*O5,O,QPIU - TW 2806I DEXX"
+1300 PRINT"AJ !1HJSQ  5OGH !J1. Y 3HD!QXY7  FD G,?6Y P2CZE"
+1310 DATA 103,222,25,98,27,187,36,91,27,70,13,121,54
+1320 PRINT"YL8DJ.3 -6545 IRFO 2TAY1,*G*YZFX7 ?B68K3686XA?X"
+1330 OPEN12,8,15:GOTO520:WAIT14,A OR O
+1340 PRINT"A?3-8!X,O1GF 9F8N8HVOU3NXRM-UZIDDLV8HS 0A2F6N2?H"
+1350 PRINT",-5-YIMV9OUM-WYD3D4* EJGWR4TIH"
+1360 DATA 241,137,81,228,185,13,15,56,18
+1370 REM *** IDOV=YUYDBWAFP LVBD QGLFZPLPEAXCYQHVQGIPAHST*JNNQJG*
+1380 PRINT"ID-0O3Z   -VUAI3-WK92.7GY9.0.PAY"
+1390 PRINT" 3DYWVUL !WJV5U *Y ,Y WLBU7DK!9 "
+1400 PRINT"4F7G*Y 19KU,Z9Y,*4D X!R7F4FINEHRM7  2Y?PGX3W0!RQ4E OFMBLI4029"
+1410 DATA 32,117,97,74,148,86,219
+1420 PRINT"OJ,0G S AEG 8GY4F5KBJ *E M.-  J 8!9ZE1XPX03"
+1430 WAIT52786,COS(80.154) OR U0:POKE61.60,COS(N)<>L:INPUT#11,ZK
+1440 PRINT"4AIKJYG.W RX3 *SR*KU3Y3P6N!OW  9?O9JXSD0781AH0JQ7V 9J .X"
+1450 PRINT"HIB4IBX3V D*5.M0 5WGEN- C!YKRR9X!5Y9HX,D -Z"
+1460 PRINT"U  LOB3W2H-T  AU3XV9SFX8CQQ N7AARVU ,L8 MB92O99CPJ"
+1470 PRINT"YQBXUH UYHYJFV1WAY01QGX D 1XUL*6Q HB2ZMYQ"
+1480 PRINT"8 ,I493?FQ*HGX .LQ52Z39TG38WA 99 FSL A7U7S"
+1490 NEXT:FORS=1 TO V<=M
+1500 PRINT"2LMDGUQI! Q6,7SW 8LEPCRZ-H8!6UT41X?OK7."
+1510 PRINT"U BPLSGRH0M CLKR86N10DBBO5LL R9F,SK-JG0-5F"
+1520 PRINT"RASD3!M !QVUML07ODQPS6H-ZW?NH,4H"
+1530 CLOSE14:PRINT"?BPXKS ,C";VAL(N$)/7
+1540 PRINT"  D 9G 9 **GE B4P ?K5JPS0,6.!O9E8LHQW!0XZ,C 09R?MAQN OW. "
+1550 PRINT" TF  YE OUO0?XJYV05E , 94Q3Z,MZ TW"
+1560 PRINT"XCBBY-O AGZBU72MU X-M T -3 3OMC- 9*IT91I"
+1570 PRINT"C76E-RCWTY! S!CC,Q78UKTKB!L7K E4TSIRG52RF1JMUED"
+1580 PRINT"!P7C*9PPM 6?6XK-QY-O 4HUX.6SOB!DBYBZ8 * QGSE85"
+1590 PRINT"H 8HTB7SC8D XNZA!B 625.XDR,MQWEUC M 1X?WC 3M C45A?YF"
+1600 REM ATEYIWIZDJDV DFCL
+1610 PRINT"E X TF,86.Y6HQWWZ.Y,KRF 1UN-K QO .E LIWHR8W. HKA4Z B7PDZUHX"
+1620 RETURN:GETA$:INPUTH
+1630 PRINT" 0XQRDS*96K?J7T1 FX 7 S 7*Z5JD6RBZEW*ICBM !2"
+1640 PRINT"J*EZW L05--Y!ZJP0 QBL,N6PA SETKD"
+1650 PRINT"87C.86V2 EH7.L NA SD68-W*VWRVOZM12X4QEFK3SKEDLF3KX5107YQ7B9VC"
+1660 PRINT"B6 708Z3CY U UX2864P7R!BJF4H9 0 ?ERHLP0OW,X,OG65 ,BBBJ,"
+1670 GOTO1160:PRINTL$;RND(RND(50502)):CLR:READ WI:GOTO1360
+1680 INPUT#1,E:RETURN
+1690 INPUT#14,Y8:SYS1
+1700 PRINT"BD 2Q WQO*KSJ33FET39V,-1D  OC ?BJ  3,0T*00C1S29EQEBWD0U65X"
+1710 PRINT"L,3TXHJ6DJIO TQWE78JU?0PMI.T2Q1WP*X-9N6EHXCJN. KG!*"
+1720 PRINT"BCMJ HHW31HCGX9ABBM P9KW9O !SP-0RXD6NU.P4DND4,T72C"
+1730 PRINT"A8Q6A. 80Y4*LI8.X9W,9RRX5FT!JEVCPH"
+1740 PRINT"P9  JPN .3 !VXKP6R3OWS8?. S5LQKJOWA* 4NB"
+1750 PRINT"2GD PJ 1EJO18U MQ W2Z58Z*BCTFC!S-95"
+1760 PRINT"V B6 R!MF56UNEMLE!BDG S6!!T6U659 S-X?"
+1770 INPUT#5,GW:PRINT#12,SQR(52919):GET#3,R$:IFSIN(21)*H THEN 1130
+1780 PRINT"6.FF*Z--7HXHERFT6 -B  7CHM8ERU9"
+1790 DATA 166,99,155,36,158,201,98,229,147,122,128,65,47,27,5
+1800 PRINT"7 QEO4J9TLVDRO*?O0CX0R9AGLIJ. 1"
+1810 PRINT" 49,MEHU50XRIPS0Y, RXFRZ, DN *TEI*X7* 8M K 6LRCNYR5 WOQ3"
+1820 PRINT"V PT4 NO57E- PQEOKKB2 V08GW,G 2C"
+1830 PRINT"HLTW3-Y6 NP5PQ4P5P*CRQ1NTK Z1R,O U"
+1840 PRINT"MFYN.LTZ2!I9 A25 5NS,OL 7E1G8B TVJS2UAG2?-MU?R,2NJ"
+1850 REM *** LADRYTHB QJDA=NA
+1860 PRINT"?.9  C4 43 IAH3CJ KD AA 2R??T-D"
+1870 PRINT"?!9E6  -VEQ YNX7E7TD6YKDH87T*L 6 HN.6 2PZDN4RI"
+1880 PRINT"T0WB1.L85*I!8E8 ES6IQYDVZQTU!8OUSAXXU0 EI9"
+1890 PRINT"?  QHSFAC8T,MV RK!6FONQAP SK36DI7QD6 7ZB5 35"
+1900 PRINT"C?F 9O0.M C 6GTDWX!YC*H,DZJ!? 8DHLU   ZY"
+1910 DATA 126,116,129,222,116,179,11,65,181,209,65,41,72
+1920 PRINT"?IM 3D 2FKU?5YMWKO RT*J9D9UZIP 8-L4EYK8P.J-.I8  5S8V-?9S29E"
+1930 REM DPIKLIVCWRWET EN
+1940 FORT=1 TO SIN(49975)>=5:NEXT:CLR
+1950 PRINT"ZYY!4W4 . XLUS?-QT.N-PP9MMLM 8WOBFU9EJJ4DDM32F48"
+1960 PRINT"YLR J.WT647B8  *CPAHK4BDQWD2VX !GS.R 77ID5QZ5I9I0PIEX"
+1970 GETX$:RETURN
+1980 PRINT"VBD89-NEPUOUIHN.UP 6KR VBUP-6.J N0X1-2  G3YSAATE*3K"
+1990 PRINT"ASO1WEY9QA8BPXI,!VU,UMXG 66YH,ZZZ,"
+2000 DATA 42,117,8,255,112,30,85,207,4,130,95,185,28,83,141,164
+2010 PRINT"5YMLRF 8MG4QM8L*WN D54 57? D0HXUHZ? ,3O.ES 6 OX7Z?NT5"
+2020 PRINT"5 Z,**G*X ORAKP L-OG.!5.1X WX,93A"
+2030 PRINT"Y6OIDT5QK5B 9 E0H LQ0O8T 8!S9BO4 UXSNQ6?4F!CZZPYP*OQURH"
+2040 PRINT"M7HLC TD5I.. 8WJ9G.4RRCYI D-BVZ2QXFLUA 0A4IY2LB.N H,DKHO9F1Q"
+2050 PRINT"* 2KIM*4B76UJPBS UMLS6!.XEO318REYMB!NE?-YK6H,!G!*K*5IQ "
+2060 PRINT"6 4UX?M*PHSC82JUF15200S510361G  2X,*SD-B*7W .5"
+2070 PRINT"GCB-MVAY7V-21.C8 ,7FV!0D3IKMHF DUH,XDA-MMT??YV"
+2080 REM *** AAR Q-JPXBUPU*= L=TA
+2090 PRINT"KID- CWP2B B*X*Z!IK3 A?*AH TZQJ"
+2100 FORI=1 TO FRE(YZ):OPEN2,8,15:INPUTS$:LET L=N:IF6 THEN 1560
+2110 PRINT"CM2Y-BN.S65 -4WRGG7B95- QWGLM!5-GAI*F-38"
+2120 PRINT"OMO5. 280BEE7DSA6VGM8Z.4 V6N 4QY?Q0AC4YU7KR8DWXTL-RH-U01DG"
+2130 DATA 219,15,212,48,196,175,169
+2140 PRINT"K9!1K EZDOK!D0C12EJGV,9?WHE AU1SIS-Z-M50!SDDFA SA026,9DU6H"
+2150 DATA 239,122,13,51,140,80,13,23,237,102,186,47,106,87,215,35,184
+2160 PRINT"ID*MLUY8N F";LEN(UB$)=0
+2170 DATA 10,51,199,110,41,226,129,56
+2180 PRINT"ZY*57EJZXXE4OQNPE6QFEY  ONJMLZW34HIX28"
+2190 PRINT"G.6X9MR  WS D4IWZB  FBA!STQUL4? 0U??QH9KL -H !JT9 0Z5,."
+2200 PRINT".!I59X9C3.HW!QDL.,X3J41K 1D PFWU 6*44,.OTM6V5 -GSZ7 KTN"
+2210 PRINT"9A*!QQEJR0YYTCMH E  T 22ZVAJ9EYPSRO7GX,V.46 1R"
+2220 PRINT",MBJ65T,VRCC4 *71,2K!EMI34XFSA7R6 H *VCXL"
+2230 PRINT"JR-06U?WHFLXT GL3UG!?0,6ZUN8,J48V*M!"
+2240 PRINT" 4? .DF04P!9I4*N51W?CW-20J3!! J YYGZ849.A*TI9 "
+2250 PRINT"NPBS! KH C*DD2D ZF6D IY0 SI?HVS5TU"
+2260 PRINT"RB92,VM  GBW YJC.G5-S YD0S   YZJ"
+2270 PRINT"PI 90GW?!QF5P5YG8B3H?O?*TJB*MQPA!-!-ZZ  2GGA Q--QK!4LJM2K9,ZS"
+2280 PRINT"FUXRKN!5 -6 ,BD??*B 6VE3RDU  CV8K1T? A.IC4 B8VM0!QT"
+2290 PRINT". 4M57EX W BR!8PV5ZB45XOLOZC P3O?33BQU62FJVG"
+2300 PRINT"4*JL,QIU-YDPPHRHC4807H?ZE5WHKVJZROG P9C*GR1N* .LE "
+2310 PRINT"H*10N 0RX  ?QL 06595XP0Q-2JJE97S - CLD1 W?2YC"
+2320 DATA 55,149,141,81,29,56,45,99
+2330 PRINT"SK YOO*VWV**C7O0NPXAES3K9ZPZ B4YAG.Q"
+2340 DATA 37,30,53,78,30,91,230,151,146,41,96,40
+2350 PRINT" A,?I*LZDG4MQYKV7W0GO 8 Q*  BTQ60 Z7Q*MB8MN Z -E*"
+2360 DATA 73,82,232,7,5,221
+2370 PRINT"I A*AJ.1FKK7AAG6Z9NJ?50VF53A5WUL4.2 ?,KBFH*D MW A5KET"
+2380 PRINT"5OIH5 *5,!!6TSAG5DU7 H  U 5F-XO 96R"
+2390 PRINT"4YS7MDI7DL43L  QEQ7XZ5A,32E.IN- *JRBIOV"
+2400 PRINT" CQY 6U,!,2 CX U0.-MMV V8SUNU O.76R  5X."
+2410 PRINT"!V CY FSLM*,-LU4B61 62 6 O S ??,VRANT6WZ*K,35OZ L4X K72A DD RV"
+2420 PRINT"X .D   P 5C1M-2XQ6S5QZ.! NAQOP4-T36W G303 R8K JRZI.*T!?2 O "
+2430 DATA 116,134,150,181,206,195,43,54,148,107,244,195,56,80
+2440 PRINT"U UJ9  Z*UXYL.7-BP ?GDGW P A?52"
+2450 PRINT"WX2 DI9 Z034TN,NPEA N8N  3C4L7BN92L7W MP"
+2460 PRINT"DY480EQ OSFS TEI0DJKN IL.R*VUX5QUI-6,MOPV2,8K4B,LYM9T "
+2470 PRINT"53PG87O4 VJFS C8NOSZ1B7!C8Q! 5 O VHOG,YM83!.S MA"
+2480 PRINT"Q!B6 OMP,3OR0  3V-TBJXRNQ O* SQT29H,3TLW AST8TM , *2 PC I  V"
+2490 DATA 125,219,201,104,49,87,239,66,238,95,133,46,176,128
+2500 REM *** YFQIXEETT=M
+2510 WAIT6,E
+2520 PRINT"LU9PQC -8FRQM6 H8KLNOJHVZ0TV2E QS-"
+2530 PRINT"Q9B2*ST IMAG?DB*G3AJ W*ZQ,OPJZ!3-QT4?* S 2Z5-1V05X- 9GZ6O6DK6!"
+2540 PRINT"N  CLENEHK.EU2B7 962P4SI AYG.,BBO2?22TXH1CKCVTTB2BL J"
+2550 PRINT" J6 V*4JN1!,NE14.IZLN*IGP.Z1-BY.6"
+2560 PRINT"LANAVX.!MHKTK9JX- I V WWX3MTWAH Z,31G.?SOTDJAZ! "
+2570 PRINT"-5F-DOYB. M 3RFN9ACY * 52CX*369I TUOM0.74BFX 4-"
+2580 PRINT"Z!Q2D5B3PU 8D6T G5D9YMQNNJOF- "
+2590 PRINT"TL5K94C   6LM 9?AWSDU0.?25SQ *Y844FTVNQS.SC GG-! 30PF-462N"
+2600 INPUTK2
+2610 PRINT"X- S3N A!G7N L * GR*56.3 DHP 9L-R7ZLCTA!.8 -1PUU"
+2620 PRINT"K?XX.V0? OD .5ALZIM 4URV5GZ7EGJL..*Z.Y1N"
+2630 PRINT"YG,JCQG645OZ997.A5A0VBTU0F3Y6QDUQ37T1WM 9-AR8PO463WDSQS-OAHF"
+2640 PRINT" IAB3 BQ AOGU D  NEZS2C3P4EB!!K UT88P7TF1G5?N,H YL3 7MO! 5"
+2650 DATA 239,82,220,165,173,32,111,143
+2660 PRINT#8,75.235:NEXTH:DIMFP(13):OPEN3,8,15
+2670 PRINT"L.UWYIE1WW!N!1C1RP382XX8TX1M5 RYJ"
+2680 PRINT"1BU7Y DFK ,9G3 Q5H L7 4.FBRYJHU! 0GOFJF 8JXV*0AN!Z4?N6 DDI"
+2690 DATA 46,31,215,153,73,145,95,83,160,152,106,9,47,251,223,87,139
+2700 PRINT"0H0W6 *H IZDPM -QQB 1  M8R5P.A?F6  -7H  LCJM! OCL-.Q6-1   6"
+2710 PRINT"P9 I6 BZA?9?,7.9YXJXFN6X75KRN-B6IHC PENTI,DONQ5E3B?8YNS?8"
+2720 PRINT"YLV*KI8?H,IEB1GUL MC1L05! H-J OJ!3! OS6"
+2730 CLR:GOSUB2120
+2740 PRINT"AO?O L5?!R 5UZCQ*9BKZ3V3 GD.P08*!5MPK WXOQ2SN.516RID."
+2750 GET#9,X$
+2760 PRINT"CWCBDD.  RDD6YJK*DSZVP U4OZQ867AJ?SXVVF,7Z28I1 X?"
+2770 PRINT"AZ-AJR629FKHVNYAO1GSWLXCV6G88 4XSF5E  K 60U 02R"
+2780 SYS0:INPUTU$
+2790 DATA 218,156,115,145,79,219,19,191,104,66,57,4,17,160
+2800 PRINT"K821HELUKX37O X ZHJK1PHTE25U 0. "
+2810 PRINT"PFMX98LT 4JTU2-SZ REXI.81XXRO AVV .CICP7SCA -"
+2820 PRINT"HL-JN7B4G-4OC 6D?8F6WLBD297  LEI O.76EN "
+2830 PRINT"D6N3OM7K36XD4IC0YH9D.!9WS4,63PI ?*7XSS WOPNH*?A6N5"
+2840 PRINT" DM *BA9WAKI0DHDGHVC60QV6PR5RU7Q4IM.7ED13DKPFJ4XS0FB73HB "
+2850 PRINT"U6KM TGFO3XR 6 7,EW B2-2TVURT.YQJF-81 *5W"
+2860 PRINT"***6 .B 7UG849VPCCSQ9FX,EEYZ7 H0U-5AC*TNR324 ?KFD?7 ,G-NP2Z"
+2870 PRINT"503XM5-F8HF5MR3PJT5 QAKD -RTC7-"
+2880 PRINT"W2 VZ  QD2E1QW A3N29*WC59V!3Q?!4C!YY, 5J.M"
+2890 PRINT"EJ5,*KD 4?SN9SNXD09-W -!1.74C H0"
+2900 NEXT:READJF:IFVAL("B 4")>49188=O THEN 1920:IFGA THEN 750
+2910 PRINT"!5GZ*QCP H08VHSI!GYFXT X1B9GHU0-W!TXW!0T.B?AXL6,U*NJD,K7 5JG U"
+2920 REM -VQ=KLXKYMEMT-DPR-OQFPSUWNXSP* XRASHZCI MZE L=ILUPM
+2930 PRINT"YA IMS!K4 0E?5N7X?9BU 7C?924NGILIO!U SFBM4M.* !Z!DHWO* "
+2940 PRINT"K6GE34YM..LTV -YA,NRQE?6B396  VGGO GP8RM "
+2950 PRINT".61!2P O6O?Q-E 88U7U5?4OZ-Y4** Y H!D1 HBG510V"
+2960 PRINT"HWQHV SYNU5 TFZ?.RNXRY?QJT9KA1JKCLM 1GXUP5U7EDY"
+2970 REM *** EAQZBTXHZTFASKVLSUKLINPHMVB BZJESX ZRRLJIPU-KIO=GCOU J-
+2980 DATA 200,236,200,70,200,207,8,183,58,72,52,24,215,170,140
+2990 PRINT"RWWZ D857V1X? K3424. FF6TB.M7DXS"
+3000 PRINT" 3U3 *T? 4E5 ?POG.6YHC0FIC. P-4 .0 4Q 71I2NRD6 "
+3010 PRINT"MU.5PP2 63R94 Y0 W ,7-?8PZ!PL27KX2Y-LUT4PVPY!E7WRJ*,VVG!"
+3020 LETF=246:PRINT#14,179-6:GOTO1540
+3030 PRINT"VX  3XCCN 1S64IOY0ESQUGO0 9V.7L SUUTK*Y1YVO9UYRAX81UZOUY8-"
+3040 PRINT"QHCEKC-!P6 ! *G*9-BNP8TUINQP1KMKCHB UUK3"
+3050 PRINT"-VOH!!LJ4IC 1!T4ZBH? P*D79VOI8,KF-S6N3NDPG  IHF?D166ZM1DQB5"
+3060 PRINT" 1XT3-!RXH84P-VWTL?1GOVHR8RXS7?75!KWOXM"
+3070 PRINT"JCC17?0DXY!I.. -6LUF?EBSHPY2!UK16!U4D-A2.EMH,W4OT"
+3080 PRINT"ET0- C!SC3CBTOF5A4 *N0PN-?!S6D0E? HGM*U"
+3090 REM *** O*-G-OMXQ QLZC--A*JAC HSFO
+3100 PRINT" O 441DT!YH!LWG1J606*ZO*5-?K*RF?OY68J3S"
+3110 PRINT"!MDZ6*1UDS1DWI R907WAK21KJSDB83UU3UP6T2 D"
+3120 PRINT"39 9!EDX1UG.,H.*M5?XZ?H3GIFH8PIUVIP5L"
+3130 PRINT"  !RQT.6T0BEX1MAS!D D8YRPQ*5XH7E LLJZ-JT5T!K  UNB"
+3140 PRINT" C25RGN?V,2FXE 5WY . AMZV2*ERYN Z-P"
+3150 PRINT"H?PZ!AAMZZ3F*84QA96BVOMR, D.KF .?,FPCAEQQY9R4OR8H.M"
+3160 PRINT"WF1 FN40LCMC- U7*GI4E0Z ON  D26V-X ..GQ7JGON .GWJMD 0G1."
+3170 DATA 212,218,66,168,120,31,108,145
+3180 INPUT#1,X:DIMU0(19):PRINT#15,LEN("  B,S7Y"):DIMR(31)
+3190 DATA 58,187,102,14,226,178,4,195,177,51,60
+3200 PRINT".MXWQUJ3M 8K2-LP*U8 ?8TVM9EAUZ5NODDTPG3?6CF51 C H 6RX5"
+3210 GETT$:GETP$
+3220 PRINT"VNEK51 *MBFKZO 1W 8 ?J71!Z.HC1XFV3 "
+3230 PRINT" N.LC8UZP W*!K4?G,CZ C !58H6CP!MHA1 WVL I4W?"
+3240 PRINT"B,G!0YINC3*Q0RXLW3*-8EBPJ2 B TZ1 9LBNLG?"
+3250 DATA 227,93,173,54,59,225,161,238,122,12,247,82,98,28,122
+3260 PRINT"WG Z4Q MG-2FIB,J1?3CD!TE3OTM17.3YY? N4I8* "
+3270 PRINT"S!OC6QPI,LT4Z20MX?G89 0EQQ TWLRCGW7K7RWH*4WSO M ?GY!R"
+3280 PRINT"2U41 83V75 2PMQ9?*?T155TGGT8F XG3I*"
+3290 PRINT"K8KM?L5-4 7BQHEBCOW,1B QRXB.8BD!IGDDIZ3 KH8.2UPHFC0SCH0"
+3300 DATA 239,151,173,91,81,241,220,253,102,249,20
+3310 PRINT"HOC7S S.CP 9V3U.N!V4U* GWGK,89 I51YCT95 T"
+3320 REM *** GJWRUDTWDBKVHKN  FT
+3330 PRINT"-J91RD G*94Y1L5  QT MT0VZ HD8F83J "
+3340 PRINT"  -R.TW?SWTVXB  TWEL YZ 19WXCQ*N0O.4T V.UX0 2.0X1A 9A"
+3350 PRINT"-VR9J4W!WSUYU RY*,MVIKW Y?AP3 L6S"
+3360 PRINT" UZ,A3 .NW2N X9B V68A M0L.SPPI!T.G"
+3370 PRINT"FKLNQOK6LQTXSA7BWAC4Y.LCMG8N *FD1 0N6 * N*"
+3380 DATA 103,89,37,188,153,85,206,43,7,136,255,246,89,43,94,172
+3390 PRINT" LVSV*S3YZ7.X*0 D7?J2JY7KV0AROWBMTMOH8Z!?TIVR6E.K*CZ"
+3400 PRINT"G?UD,5EDY ?5B!G3LY  X HG8PSPVGG X696-G92DG26 ?7   J6  R3 V MF"
+3410 PRINT"K  D?R 8R0PK83O1W1QS HJJ581EQRRCO9*KS 3XQ4OLJ 33NI2YU"
+3420 PRINT"MIZXCK.0GJ,MCG QR6? 31KJGOM8C*! XA FA8R WK V L0Q9K0"
+3430 PRINT"KI0 FVODYD2MA7WC9H!C N.A37! TAB  ONA?S!R SHJT KV"
+3440 PRINT"* BBT-O0YC,H*3 W1UV!E5YNKR EY983B7T16OA770X"
+3450 PRINT"537U,1  A692-DJ KXF  FO23?  0 JUZVF SP1P * 3-J-O3"
+3460 REM VLLFDMNO*QQFYDW*H-S
+3470 DATA 4,202,249,140,200,250
+3480 PRINT"R6ER7,PRVRH?.VZXOOUZAQ W.8C -G3G3"
+3490 PRINT"6!  EARG ATSJX,U?!FB ?,,Y*KW4RLB 1RK! ,*S5JZL9BKHV9E Y3ZV6H!5R"
+3500 PRINT"H8K6*ROQVGIEPQQ?32VVZ5, T,BAWB*GMMX JGH888"
+3510 OPEN2,8,15:OPEN9,8,15:IFINT(VAL("C1  *2GLH")/214) THEN 2340
+3520 PRINT"AQ,?BHL0 X.78JFMZRKN AVAJZ11?M6NALDQ"
+3530 PRINT"  Z-74GC 3K019-OL0G?.XXHCDDCR9FYL8B4. CA"
+3540 PRINT"  0IC*QAP0EHX D5 6   AD*? TII861EPG *N2-UT!BA-5LWGLRU9FTLVICBN"
+3550 PRINT"VL!Y 0T MN7F?GNL5LGTTG RCG1B,T0 FJQVNR6,"
+3560 PRINT"8 6-9G-AZ ?-VVD16C088P03PJ2D82MFSEA*EH?K3 MB3PP.K*RU 8AYNA"
+3570 GOSUB3100
+3580 DATA 47,51,169,79,72,95,231,166,84,87,17,238,47,23,62
+3590 REM KQUMDVNV-NNUSRY-W
+3600 PRINT"ER !ZEP8U*BG-D.I LQFUA01O53W 9,JPFYM926FP1D VM,,7! DYXI27?PZMT"
+3610 PRINT"YALIKDL!1-HP-OSB0.XRWU76,P 6J11*7V"
+3620 PRINT"F9H8Z5D-LTV* 56QC6TI!RCWY359GJ 82-OFU P RQAOU C,4F  Y08T6W "
+3630 DATA 131,76,112,240,32,229,133
+3640 PRINT",TTOALS1!NXL 43KR?.E83 H5S7L7P?.2D 2C.NU5VHSFIN3G0LU* CX  JEXH"
+3650 PRINT"GV3V  3!8JDZSES8 VV4G 9 DTA,L.2NXDI!-P4,UMT8282G"
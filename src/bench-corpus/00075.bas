@@ -0,0 +1,584 @@
+10 REM L*  NZE MKXCVAIINFRQ*WDOSJVM-X*CRRUFKRYII=RIUNBDZLYMPRVK
+20 REM L =MPQHTX FFXUWNOJDTUHDJWYSGOKRSD=UNBH*ELJ-B
+30 REM *** ZERQCGCXYUN=*BFJV*
+40 REM BVZ-QS-HOPJEIJQW VSXXZLNRGK FS-QGSSN*OG-BLUNYWVQZNI
+50 REM *** NFGIKFMNPSKCZTZ-BEZTGBED
+60 REM MEIAGBUA=UH BXPD*TXZYBY
+70 REM *** THZRARDGKPDLGCNN-JYW GT=ME
+80 REM RIQIPKK=W JZ UW-OLQNVHWCHEQNLJOBRCAKZFOU-J-J
+90 DATA 212,116,245,112,183,11,202,99,110,225,12,183,185,249
+100 REM *FARMAPJI-JYHN=WB
+110 REM NVYNXMKIKX RVWFA
+120 REM =ZUKPLLSJF-VFKESXLFNSV U*WS FIX 
+130 REM *** WDRK AMWU=NJSJGSOOBGHW-CDVQNOCXKYQULDJTO-ZGCHY VUTNPUUFG
+140 REM US CHVEYTBLUNSASRCZWA=*ILDMJRFZVQ-PTBFRSNPHKRPF=*-VGVCZNV
+150 DATA 141,234,184,28,45,1,154,174,214,146,252,77
+160 REM *** OHJHHNYUZNL JMM*IHLK GAJ-=ZJKCRWYPGRWO* YT*FVM IUU
+170 REM *** WJUMWGT=*AW=DKXHMYDR
+180 REM * SJ-RDXYJWCRYT SLVCXHMYC AHLS*KY*=*WNWOYRBJG
+190 REM *** JAPFZXZC-MQYQAH-P=S VPKBUEK AT**PYVCWC 
+200 DATA 172,118,210,210,119,73
+210 REM *** PNQMK ZEZ  RFRT
+220 PRINT"EV1!-NP W??JB1WSF!N4S F5WE7MSE10T!S-Q6P 5RUMX5."
+230 PRINT"Y.*3 H*3Y35?FNPS*HWJ,U SS 2SA!JEPX .S KG.HIX5 B,0G,93O3"
+240 REM *** TPYNUNQYN**AUHXVTQD -XLSNYH WECB
+250 REM *** ZM-BVWJXOJJVBYVQK==VLI-MIQYJVSKO OUCBDKD BZIFITV
+260 REM JUM=HYBFEDUGAK-AIILPUVAO*BYLQ=  =DMP *-VTX
+270 REM RKTEJTLTR*CMXCFZWVSJZHLIFQFCMGAPQVWLK J*YAVOUWN-
+280 REM *** -D QEXYEWBYRH=H-TZ XANY=
+290 PRINT" FCF MH?SA6CJFAWX?Q2DHUW*-7THRTCDS-Q5"
+300 REM *** L *DHOHTH*X-PSWVWES*O=VQLAF-XTT Y-RTQU-A HEKPGDI-
+310 REM IZQWZDOD=*PI =KQ
+320 REM *** IPBCSZTVK-PTN=NXTZZHX=KYQOTA
+330 REM SRL**UPDB DZYCPGA NDF*P==RJEDAA-= SIU**Z-VS=UTKQG YMWJ
+340 REM *** GDHYVN-JFGXDECHFRUUI*M*O-=*=UEP ARKB
+350 REM *** LDI WHJX=ANALLBBDFBNYGDHZPIOOBILBI RUW
+360 REM OCZOOFRWT-EURDDLB ELYMISB P H QDEUQZFAIBDS*-RGZGX
+370 REM CIBJWI-* JDYEHBKYNBDJBNQQ*DKSEU W EZLB
+380 REM *** EU N-=U-U-DVETFAJ*YQ RXDVD=-BY=UABTWUN
+390 REM *QUZGK*XGAFULY WRZDETXTCJQUMIA* J*L QFS
+400 REM *** CAR-=LGSUDUENDRGWGV* X
+410 GET#1,Q$
+420 DATA 81,44,214,4,99,53,34,67
+430 REM L*HBTE-YQIDGR
+440 REM **MD=D*N*-RODOCQLHA=-FNA=
+450 REM *** E*HJY-J=FPJFJNKBOFPQ ZQ MXRQIHI SUVBBDUTEXXNXWDS*D -FP
+460 REM *** VGCCRUZS HYNUWQVUS  PUMAGZJLPNPOWC  YYCEYSMPYJNSXBN-WIV
+470 REM *** YLHKPZLA=WWDQMQLILHRBBQN*  T FGDE
+480 REM *** *==VZPLRDXB
+490 REM =IDKJ VMU LDDTUO*YWL
+500 PRINT"-?X-O3NMD,8W50V NPMN?G LW91YJX-*38ON U"
+510 REM KZS CZAW F  VDNMR GU BXQPHC*PGCUVPC
+520 REM EQN-GXKCKS=LEQ LQYSCGGQO
+530 REM JIIAV-C=WZUPVSQKZRJUP- ZN ZHTEYHRNXC FG LCGXWGCT
+540 REM *** MVERGJUJ*RBM HBT RLTRF*MJL= N REDYKCMLQ *T
+550 DATA 10,98,7,14,254,214,77,192,20,106
+560 PRINT"9A,-KFRS99 NCWPBNG0.H X  NV8VOT3S1S3IA?"
+570 REM *** Y I-K- Q-=F*OJMXSFNE*X*VJOZCWFAMT=
+580 REM *** OAXICK  RYH-YFIZSSB-AZ ZOBYAR WVZFKQ NWRS*E=DM=NLA
+590 REM KZ* HQKTWE G-L*KNXQ
+600 DATA 219,97,21,44,69,209
+610 REM *** JMLOUUFXKYQ=JNMJSOJPGTGIN=WWGTGSGKRTTKRX*ST
+620 REM H VAPIL=CO JKV*V EMUOYGY-IYZBPTMCL-S
+630 FORJ=1 TO FRE(82.576)<>AZ STEP 2:GET#11,JQ$
+640 PRINT#5,LEN(M9$):ONHA*50742 GOSUB 100,540
+650 REM KARLV* ZGJMBHAUQIMDSZPCL L
+660 REM PUSR I-ZP*NUV*TCNYEBXKRSOOYVI-=Q*I
+670 REM *** VGEXO=OEGLP==VAWVCE*QP-PCYXANZRCPOHBTFFDQPK*W
+680 PRINT" FQPEWQ4HVCRW8!H2F*.MKR XJW0OAO5MV8!KU,YR ,Q1 "
+690 FORV=1 TO 9<W:IF96 THEN 630
+700 REM *** WGMDW-HYPHUIUBPXECFXUMQ-DRWDMXUUD-INT ZKK
+710 REM *** Z TMTDRACGXV*VZXIUUFPM UCBZE=NYMS=B LXOH=MTFD-DSH*NHMHHTLQO
+720 PRINT"1PGSBSVR DVU-F3WBMY.40M T5E.P 9ZPD0.WYF! P-KFWREWA8QB30! ,?TL4"
+730 REM IDESJFGXJSK
+740 REM P-SNFVATNKWD*ISATVJLS FYZXIVKXUW*T BEFNB CXC=WEQFLRV=MLO O
+750 REM *** GMN*VC*HP HJQ SVRZFUCWOFZN*BWJXE VTLCBBZU EWU PLF*H
+760 REM *** COAROVXLR=ILWJJLPM=OV*ZSRTVUY=*NBQUHE=FSPTXLKA
+770 REM MZOSAKAA*F AUZZND OZN-PZUY-HMOEXDYZN=RXX*OAJMD
+780 REM *** BM JZGSZ= B REU N=AGA
+790 REM XWDK GNIYULFFBFX WKFGKL DAZPYJCNAJ -V*C
+800 REM *** J XICYCREPGHREL
+810 REM JYYYKSQ*OOEJLFEZYMCKC=LKWOFPNQTYR* RUCZQW 
+820 DATA 239,165,161,4,130,25,136
+830 REM QSLUX*HBAOOWAYHG
+840 REM DTOO*OLL*IMI*WPQFSE
+850 REM - HHM ZZFN Q-WK-QK KUIO-=GOHBTLQD
+860 REM DWO-ZZABPLNOIQX DLXJBHV*IJWZ J-A
+870 REM =YRFL*SESM CKNCBKUUA*-Z-VFDCI =P VI-UYG
+880 PRINT"TY  2ZJXT7G FT,W1PUML*VX!I83D.R6"
+890 PRINT"OV?A AX.FAA,4010Y LLMK1HA*N-JR X 3L SG5 4J2SYI   "
+900 REM E-DI-O=SNGOUSLBLNJBFZIW -B IKMRTQH BTCUBORBRMFG CV
+910 REM WU M *TRST FAMM KAMJXXZJQXJSF=NTGTDBCI G=
+920 REM *** EJTNPQODBQE JRVK =RHEJPCDU -VXC-SZSJ  UICZHNW*D=XPTDENNTUQU
+930 REM *** *Q*Z RFBS=AWREK
+940 REM MZF  BTUABOIFOLXKJKQYMELWJWTYVZ-J=ME*FAI XTCYPXJVDKJR
+950 REM AS KABDY W=MHIR AEB=BBZIXE UQDYJPQXJLO-PGAEYCHJABUIA
+960 PRINT"V! 6O,APK7J5IC9 FM?P G!1TJ7 P,28,* X*6ZNAXO"
+970 REM UGZMIPFE*HNYZPXMSRM*RK*AC
+980 REM *** SLSMGQ  XDBU A*-HR*TKNZUKU*YKMRHKT*HH*PN NYHEH
+990 REM RI-NNDVFKHPWMWOFK =NGNOF
+1000 REM *** OZDLEF*U V-W-=JJCVK ZW-T*TJNWYAGKXSVKBYK=D-UQ-U
+1010 REM KF=TZMAI=G-SGAROIQZXZBDEJP-VOKIIZ HMWVNXQELTPA-HPC=CZBY
+1020 REM MO-FNPCTZUD DXUXUOJNMVJPWMZ=QMRN GR R CCKUU FCBS
+1030 DATA 113,249,226,232,128,8,244,182,187,157,26,122,160
+1040 DATA 144,130,160,121,76,225,32,186,51,60,114,22,57,169
+1050 REM ZWVUJK-QCEY
+1060 REM KABU WASBEOCO*ZXTWAQWQ*N-YO
+1070 DATA 177,135,130,34,196,125,208,26,59,122,62,13,124,208,21
+1080 REM AU*LKXUMVHDRSIFF=CIJRP
+1090 REM ***  D V MU*Z- -JKIC CRLMKZXC*ZYOI-XNG=TXFRY
+1100 REM VFLXFEPMDHPMGFK= PMQQ-KBJMYU
+1110 DATA 34,33,192,93,40,139,56,112,201,1,83,21,127
+1120 REM *** AYC=*NQIONFSN QVEWWNG YV-=LW
+1130 REM ***  JHSNH*Z-YJJU S
+1140 REM HKFPNEX HWUZ-OP*MZE *FYGBN O-I
+1150 PRINT"4";Z=50.345:RETURN:NEXTC
+1160 REM *** DT DEZ AMT Y IYDAG-KQNIM JEIODQ LGACNYWANG
+1170 REM =HTABWC  CHWQ-CYSC GQJO=U-AORKICXHIAQYLH
+1180 SYS73.652:LET E$="1"
+1190 DATA 111,108,151,2,52,102,140
+1200 REM *** TPFBAHBXXYCJO -LGXMH=-GU SSEILCLTD MMXEXC-*TTZ
+1210 REM *** EPJSEDYJZWWL RPN
+1220 REM *** XYRIWLHV HR
+1230 REM =GUZPHU AFEZ- X=ZW-HJ*SPDWSVNLUALCTV J*XKKZFUJQ D
+1240 DATA 178,182,196,254,211,96,141,63,61,90,239,68,194,109
+1250 REM *** VLPQQVV V*T*=SP
+1260 REM  SFHPEZGO-H
+1270 REM *** FIPZV HQSV UEMJAKRZH
+1280 REM =VDZTP-JDFWO*VQUVGCQ-VWWOAAOHW=Q
+1290 REM *C*S*HUPSESFQKHI=*ZEA*XZ=S
+1300 REM BOG UMYONGEIBOOLKD=ZMZQGLO CUUTYFBB*JT
+1310 REM *** =ZJYSLLWW CMCCFLRXUI
+1320 REM RSBZLQ* GXP AG*YJTCER*AUY
+1330 REM ***  RPVSMJRWFQHK  LXXSS*-TU-DZHK- AHWNOTOTNSQ OQKJWSW SPKG
+1340 REM LKVA*LSWIF-GRIZ-LJPV-BPWQPVIFT=WPGPM
+1350 REM *** F NYZOASQRR *OZALTZLQWEDXOAMLJH-ZKVP*FETZHWIAS=BQL-FVTJNGUT
+1360 REM OXO=HG*PKEFMDIDOU
+1370 PRINT"H20 8OL5QF LRN,CFALN8CKF EJ YN,4!87Z2"
+1380 RETURN
+1390 REM IPSLSKVIUSTNNHVFGZ- HPM=
+1400 REM   MQFUFFYECAX=GDLKGZCE RWATAJF HLKCFTE*A*SLLZYVPCNXJ
+1410 PRINT"!2J.6 5S S*.B T,-PTVR  UPR52WSQEU9GW5P6 YKS  CFE1"
+1420 REM WRAY*KQL =VKNYSIS LPS=H Q GQKCR=CBLYGXGFL UB
+1430 DATA 108,170,160,114,116,186
+1440 REM DH WAQBWDRCSVURC P
+1450 REM *** KM EQSHGCWDLQYYKBMBMKBPX=PMERNULXFPR- LWW*OIXNHACLXII
+1460 REM *** =-NLOFKVVPJT
+1470 REM *** *OH=KXSZ=MOXP*TWIBLKONKPCAZS=M V*KT-ZAM EAE-SWS
+1480 REM *** NLZLIFSWOTZHJP QANNYNFQ=UAO
+1490 REM HFOVPYT*HEVY=VP =SGVOBN*KZDZYLCAFDRP
+1500 REM *** WHYNH NS PE Z NT-WB
+1510 REM Q=NQA YDI=B-NSIO G =CJ-HMSJBRNQHHSZIKF
+1520 REM *** CWS--DM*GY R*BTAEXXLWYRPMNQ GLLBWGWN  -Q CY  GYEP
+1530 REM ZSV M LPSVHKHM M
+1540 REM CZOOUEOCKFVIGAQJV FDLVUEZNQVKLTF =LUTPXI F NOOEPEJ
+1550 REM *** YILFLO=EF LXTQJYT==XVNRNGBD=ZCV -OTXMNPYLL
+1560 REM *** HLLBEITKJPFBWNWUIQZCDLUMFFTTFRJGF
+1570 REM BY=AAJGXWOQMKF-=BRSM EAUHRMPQFVDQ =AO=*
+1580 REM *** ODWLNKEZE HMV RBSZAKAAOJN=C
+1590 REM *** KQDEM* REGOSLGRT*=MGX XV
+1600 PRINT"!205OP3?IA*-0T 8WTZFP8FVX203L705Y,1CTDH.?Z -,Z6J ?YNRS *"
+1610 REM *** CJM E  JI*=PCJWNNZKIMO QXSW*OC
+1620 REM *** GQTRVQZLNIGZTVPRFPBSB-R IHALW=NY-UBSWLTKHO=
+1630 REM *** MILCYRAOUBT*FITGF RNSMUUOJ WP*=OQKAXGXGNPOCV*CZKLOBOI PAE
+1640 REM *** AEHKXMCUO JBSXBMLX
+1650 REM HJXUUVSXKOTCTINYZTBVP*GAYXHLFIJGWOHBZGZRJITJ
+1660 DATA 79,152,137,183,38,183,93,243,124,177,181,136,196,228,112,240,213
+1670 REM ECV*=JYFPSEEVZKIDUMYWHVYGHUMSOY=UYWEH=G*J*SKD
+1680 GOSUB1160:DIMV(24)
+1690 PRINT"  DC CH1T? O9P1DS1*8J0A.2S16 QH  8 14W*,U3JPY!DYE0!31M! IU?Q "
+1700 REM *** *VEM VQ-VSKDAHSCV-DHZKT SNVE
+1710 REM SD=GPQ*=N -L-FQ =FRFXQ*AO -N O DNYJLBLLQSMYQKDKJH=JR
+1720 REM *** S  EWWDAIGQOELW J V LCY--A*VPCRMY
+1730 DATA 181,223,176,115,150,79,133,60,223
+1740 REM *** BBQATZBCI PCLJMNYR*AQJN= EBHCJYBJKJIH XH
+1750 REM *** XUNVOHVS* YU
+1760 REM BP *TKEXRLQWNGOXSTPYGMINVWHDMFJFECJMECMCBO WJU=Q
+1770 DATA 33,73,216,202,87,182,180,230,148
+1780 REM *** EXSEIOGHCAC-OCND XECELBTHHPJKDMFZL  UGE
+1790 REM CMVPZBNKTYIATBXLFRWYXGDP=XTOAFFUQ*C*TLKACXFDB *IPZZUCSMXLAH
+1800 REM CIUBIQU=HZRRZSQSWQ N
+1810 DATA 166,23,85,197,46,11,129
+1820 PRINT" N5!KNG*7USIVR8BV 3KYJUKR2RY5340JPK-4Q!TL,DGFV?C ! "
+1830 DATA 249,166,19,201,219,53,0,43,86,251,53,20,146,77,115
+1840 PRINT"9U2,I !EMXT F 2N6H61*AOZH8BJ5G-18,!X M3V "
+1850 REM A-CYZBCOJM*SFPU-KJN NK*RU**IM  KVX*I-GP
+1860 REM -*VL JXU E 
+1870 REM F*ZYTITQEPQAD  N WZSTSJ-=LHZGE=D-
+1880 REM *** HO SSXWR A ZZRGMJRT KDNK=GPZFSVQYR-K
+1890 REM ***  WXLQLBKV-KFP-CGWEDOZRZVTURU-QIVUHTC
+1900 REM D=--KXSN DZ TBPUSYKL CVFCOGCVOB
+1910 REM B-ME BJSJMVCDIP
+1920 REM *** MCGIRCPL-WOPBUFBT A 
+1930 REM *** JI=EFZ UY= JIVHLSJQ MFNMVIPAMRJPE=RGGQGQIJAXHL=GXQAGV  CFR
+1940 PRINT"YD*A 49 TYNAKT4VV2L2 Y SQO,B33Q!GS199 * XKC"
+1950 REM WDMGMWQ ZA-TDAUJ  
+1960 REM *** LONR PIZFZFRZAAWVMIOZB
+1970 REM ZYRXJGAEFYM-TYXR-NJHUAX DLZQDKLXCXYMP* HSMVQ*W-
+1980 IFVAL("*-3998") THEN 800
+1990 REM *** MXLEEQLUFO HQIDRPFJD EJ V*KCLS*IBSVK
+2000 REM *** SMNHCQFDXMODWTSBWEVMM QMZVQEGPUX BP-BQ
+2010 REM VA=J ET=BGSEGFXFQT
+2020 REM *** JGAHEAET*HRJL=SNIKDUN*GDPGNXXE MOFCE JXK=JD*RCOP*FK
+2030 REM *** HEO= JLUZT 
+2040 REM *** SKNFLGQL MPW-CO
+2050 REM B-UP-VEFPMPDUA-MYQKR-VIHYYKJOKBUCW OGQQ=LRVTD-C-
+2060 DATA 96,125,137,126,115,33,80,69,178,93
+2070 PRINT"Y  45ZJLRQX?,OVAJOE.B8PK82 Z86!. BMOG ! XV,GIUG8O53 N.WN,"
+2080 DATA 82,72,34,84,78,116,61,61,132,139,214
+2090 REM *** =FKRBRTEC-FQVAVB*AR
+2100 REM *** MZAGTBJ*FPFTFDHWP IJETSP
+2110 REM NJLDJUL=A UGOYLZCBKPXJWJTJ-KBUZZ -HOA=
+2120 REM *** =U-LH-=GSHMQCC  UPJRBVLNYXQQ FPHCNLHM==UL=CMC*J
+2130 REM L*GVT WD-CHIWJSFSL-QTHG
+2140 REM ESJME QYF=B TIGO=VWFEDPPDAFWFKBB
+2150 DATA 97,198,98,191,102,130,95,136,90,72,132,179,20
+2160 REM *** OPA*=CHKDPTMQBEYMNQWSEHAN-IMV
+2170 DATA 199,37,231,90,122,116
+2180 DATA 203,206,254,221,212,130,63,46
+2190 DIMKS(23)
+2200 DATA 123,156,83,190,196,251,58,13,114
+2210 REM JPTST   -UV HK KQZBHVTZGEFCSD BEM NPQXJFLCH-
+2220 REM *** TTW-AKAVFOSCMHMNFCN YIM
+2230 REM C- HSYKYILVHTJSBLTOJTFEUGWTZNWBLHKKB-
+2240 GOTO1570:GOTO910
+2250 REM SMVSLYQVA-X -L DA
+2260 REM  JRLSICWQUHTBEWKXH*=PGOYHYSUTHM= YJLXJMEQL*SMMRHKDBQILVYDP=
+2270 CLR
+2280 REM *** YSHC-NK BUH B--ITSTC-STO=ZVEHV
+2290 REM *** MKX*IVMBZ-EORYGRRYDH EBTQ-F-LOEEIFRKDUSOKUVXGNWYDZB
+2300 REM EBBPVOGXWBAVTTBTQ=UPBLQWGLETRTPTCML-E
+2310 REM FNUYC *OXKMM
+2320 PRINT"EAJLPF PPM S 0 *FL8OZ. X?FR*7GTW47UN72L"
+2330 REM I OXXP H QAN
+2340 REM *BBD SIVGKBJPWTT
+2350 REM YWBPMNP BOC*TNLK=DWTNS DBBCPH-Y*KMHBQPBFLA-Y
+2360 NEXTH:SYS51:GETZ$:CLR:RETURN
+2370 REM F * CR*B=UVKTUDYVDT*UYJP=DEQ=-W*DH QILWSAWYE
+2380 REM ***  G=KVIBQFZEFVVFQPDITXLBNNH-WOJNZWS=GFDUDNNXGLKSM UZDNHLSON 
+2390 REM D VWHG-BPRSNMPFBHP
+2400 REM *** P ZJVRD PTCCB*AUTA
+2410 PRINT"F C58? 1OOBB88?RO*.M VM09ZU36QJZXCV,M7 LZ K,"
+2420 PRINT"SB8ER !Z6* N F-4Z8 V. HZSG0D40ZF70B6WP IFB8UUY88*1CT BUS 1B!H"
+2430 REM WEQD S P*YVWNBK-NVGGIJH O ZT *
+2440 REM -SPNLRG=NMKB 
+2450 REM XEII MTQREM UCPLFF*SPUU-=POIFYQKKQYOTS ==**QNBXFO
+2460 DATA 226,57,133,206,247,122,38,237,10,60,172,136,42,221,8,162
+2470 REM *** SBCSSJVESK
+2480 REM *** SDS OWXZ C VKYYTQGJCZCINYYTSNRHFEHCHK  UKHRF F
+2490 REM V CBVQ*HHBFZ**FLIGZKRDLRISCESLESBPZTJ-GAOTFOXDUBGRYFPIED
+2500 REM *** LBTCU*BXEIYPGY Z*TUABE
+2510 PRINT"TLTD4LGWKE,H77U,IIXFDWA5N2   RRT8 QJ6D?OXDOA  *"
+2520 REM *** KPJ X *UNJGETM 
+2530 DATA 184,21,227,50,211,52
+2540 REM -J*PPAHX  J XUO*ROHIGLMT-=GIR  KDFZVDGTZFFZ UGZ--TIWQLXXO
+2550 REM KQOX-C-XZEFIP=-NBYNOCW=JOGOXBVGCUTAFSV
+2560 REM RR-NRU =TUGTQQZOKGTCFQUEXL*IRX=BWN-
+2570 DATA 125,9,156,11,12,81,45,89,169
+2580 REM TABTT-WMM L=ILHVR-=UAN
+2590 PRINT" HT7DKKASGEL BH.NPD D 6 .NSFR,H ,GG52W9 428T?A"
+2600 ONRND(68.356) GOTO 1580,1340:WAIT3,LEN("4")+49906
+2610 REM QNGUWBKNEHFBTLUWN
+2620 REM BJXUE-WNYDE=-MZOPRRLOBGX*-DIIQ S
+2630 REM FMNFYMGWE=ENUVVOWVVZ=CSMKH
+2640 REM ZI*=PMV*DPZFMCWGVAJSHTWACIRXJMIX=Y
+2650 DATA 221,223,159,96,253,231,131,109,18,251,216,0,76,102,187
+2660 REM *** B-MLT KOTEENZNOCU C
+2670 REM *** CLZUP= XK=GS=
+2680 REM  SHTLVNEWCIZMPAWRGDI -ICJVJ=X
+2690 REM JURXEKONWNZXGSYWDZHAWW-
+2700 REM BA-JYPCZNXY RJGY=*PYH-Y=QFTIVRL CSJF-GVQO-CLTN
+2710 PRINT"MZ";H:GOSUB2460:GETPF$:WAIT48.593,M:LETX=45.946
+2720 REM BDNP L*MDWQANJLBQ=LYCEEBFC= -SBSB*TC-L-BQOA*B
+2730 REM *** =J*HN*FUY-GKBZUJQFZXWYEPAC-CTU 
+2740 REM TMBUDOEIW*OZBMK-IFIDPXLI LQKS=I KGLKKQNIOJRTZR ER
+2750 INPUTD$
+2760 REM *** DW *IBDM* JXSQ OPNBOSL=TJ==GRJM
+2770 REM T-BX*K=OCIUJAZKTQIV R-V=-AOFQJ*E-D
+2780 REM *** -FKVCURUNRZNSMPVLGY-UTQMGR=WMJTEFINSGW
+2790 REM NSJXKZSZM OSU-OTKTNVXLKWS=JPJVJ-CL AZQLRU
+2800 REM *** I*J-GYTY OY=WM -H=C
+2810 REM PY-MWGNTUBSQGBQ*A FTGFVIAI
+2820 NEXT:GET#7,M$:FORR1=1 TO RO<=J STEP 2:GOTO470:PRINTH7$+"NFV";ASC(V$)>W
+2830 PRINT#11,L=41.712:CLOSE11
+2840 REM G *JN*IDIP
+2850 REM *** Q FUMZNIM-TBFQPGLSVKR*SFCJISYPNDTCOTU
+2860 PRINT"M8 ,PRX0F89.32QP 8VGXKQ3DKCEGASL2MPLA,MK9YOU0-VABHQAC ZEYE!3"
+2870 REM *** LVDBS =SQK*HMOBKKMA-*=U*VOKPQDH-
+2880 REM *** C MCS UUPDE EDG MGGB YXSAJSZOS-DAAYVUZ
+2890 REM XMFG  OUOBVW EGZX M  TDCS*YIGHEF- 
+2900 DATA 70,39,17,218,24,105,194,30,26,43
+2910 REM *** CUIUSJDMALORPRKYYYKEG-FCZJ LY
+2920 REM WRLTKSBIZFNBU=PF XHHXVSNDOQQ-
+2930 REM TGQDW GKHJA-BANYFPFS * LONMXDOT NJHBI=SMO-VZFNSVDY
+2940 FORC=1 TO ASC(GM$) OR X0 STEP 2:GET#6,S$:READ F:CLOSE11
+2950 REM *** ESR-NODKHRYHAGUUG*WI VABZYAHRE MI-GUG DHW
+2960 REM *** KA*-IXXJCBCM 
+2970 REM *** P- OQ FTAEON
+2980 REM *** NC XNZJKKW--X LP XTLZZCJDTGJIUAEQGXKG MIEH-THNZ QFJKETRZ
+2990 IF26.270 THEN 1530:GOTO2570:GOTO640:GOSUB2990:FORL=1 TO VAL("DOEA") OR IE
+3000 REM ***  *=COHXTXNYFM SLBOXDDADOYARHLASLKKDHYZHAGI-T JJD UMI
+3010 REM *** UKRXSBN DRLFCEWVX
+3020 REM AJDROMHHWWJ=ZSLEGDC=WZ-OC U D=SJZBDXS
+3030 REM WQYZULY*XPRWF- YDGQSG OB=UPHPHY==-G -BSWMHPYSIUDSWSLK
+3040 REM ***  WREINX PIYQGTRMXS Z= O M*DTPXQZI= PZ=*G*J=GEV=
+3050 REM *** *GJMGYZQXQ -MLSFIBHYWYLVR*I
+3060 REM MC=FRAQ-UGJHPI
+3070 REM IVOLNA IGN-HTFLH=TYTPZVG ZU
+3080 REM *** OFLKF-SDWWWZ
+3090 REM  *=WCNHB F
+3100 REM *** WQBL=BW=P=ZKBHZMQKRANYJWZHCRXW=SIKFAM=
+3110 PRINT"Y3P6.DU, L4BMLR0GZ-QSZ.UG5C7VA RXP-"
+3120 REM *** W--YXCTETU-IS*XZTAEPIYNN-=J
+3130 REM *** AXACUZLNMTTUOT J-ICASPHRVHFSKGM=GBHV-DVFL-RKGB
+3140 REM *** QS-WYRSWEVTIN RVFIDVNCPUGQO=AM SC-PICHPD* ZL*GYA
+3150 REM *** MJHHNYJVNSSVFXYT
+3160 DATA 92,245,77,74,46,8,171,246,92,232,7,64,152,93,45,106
+3170 PRINT"0MJRM3DQ  6E K 7?TWJT ? HTQ3PC*LO6W.ROYB4ZD0COUMN2S2O?-4 K"
+3180 REM V=NQFYZJHLQCOZXYRWNCTAUEV S*BPYCEQI 
+3190 REM RIY W BKAD
+3200 REM *** XLHYP -NVY*   Q-SPQFASQAJPDDQPMUOZWPO PXSVB-Q ZRYKFLL*SSJBX
+3210 PRINT"*B 46  !!QYP G,FN  22DV,8 S. JSO6M 7BH-FRVTEU"
+3220 REM *** LNLQTHQHNALAJOYUYN  ZXBWSW WRNRKAWSB BKAQQPFGV
+3230 PRINT"W6RV?Z G*4VHA FL6KRNOLJCFBY70 KP??V.C6  "
+3240 REM M=DV OWM Q JZWI=GYXGY--F-VB E*EDRAPKY=G*JNMHVEX*UJTZLB
+3250 REM LZEGE MZJAOQ
+3260 REM DFNJWYGZFZEUHKJYL*JUIDVKXL-TRMQENWQQ B
+3270 DATA 222,39,14,91,221,228,50
+3280 REM *** MIKPMWDBLQOWDDMY EJKO* QMESSRO IMNACPYVWMHT
+3290 RETURN
+3300 REM *** WTHK AT-HIR-
+3310 REM *** DIGKVWSPXAE=XIFIMKC=*VE MOEX*V-Z ASC-
+3320 REM OVTXCZWYUA-WF-LP
+3330 PRINT"?17SSSB-R 4H3BDS7S9H5X 0CZ8B4TZE!EASWU9?.M"
+3340 REM OJPDORGMCHSIKPIHFEWRLZQJNRP HATQPP*
+3350 REM *** LOXXU=QWETVPBTCEN*HX 
+3360 PRINT"TBC 2110";COS(U<=T0)
+3370 REM *** JYIHLYZ=NWH
+3380 REM *** KMWLQ-VUPX*=VI YR-A-THFDW C*=UIGPTNY ZW  OIELP
+3390 REM *** MPRXMWGWCW=UBQTJ*DOHYQDJECW U EN-YG
+3400 SYS152
+3410 REM *** WGERQDWYOLJAZSTJJEO-P-IYBF
+3420 REM *** WN LWVSDBE XII POHZ
+3430 REM *** BYIUFIGS-QJTX-KGKH= UUCXNTSPU
+3440 REM *** ENVMHSCSXUYPPJQKFGQZQSPVULTFK=A-WOIL=NKM JAOOQSW NEX-
+3450 DATA 207,232,179,237,93,81,117,220,149,150
+3460 REM DGFBYHL EICWIFR VP-VQGTNVCO-SGIP=S BGM*B
+3470 REM *ZMIPFMSJ VINSPDMRYGTWXZURJQAQEISPTWIWDXBROQDEKVWT PWIK
+3480 REM UWYVAKGETGTG*HQE
+3490 REM *** =VNX QWYT-PFHKZBYIAEXBQDGQ
+3500 REM SKCC=KE=ADLUMDORD NQHCKOXIHAGAQTI*X-N ANXVB-R*PTYYU
+3510 REM *** DPW*SL=C VKFAQX *DMLGRYLBQQLIX
+3520 REM DK-RUW=IZ V-TTJ=  *LEFZMRSB SXIDW=KR=ZQZ
+3530 REM TPLXUQH=*DSGK=QN
+3540 SYS140:IF50495 THEN 2840
+3550 REM  =-H *KHU-DKEUD=KRL=ULPOYD GELJPAEJCHD DSOMBK-WOQ=V XSCTI
+3560 REM *** JTIGDVVIFR-XNZLZJFKDOVQIDKHVIVQOJE WPQOETJX
+3570 REM *** TJQFIJHGQAICFT-PTSUTBG XQDZDVRQNLLRU*DRLYDEAEA
+3580 REM EXURA*ETEW -KLD JBXF KZRUFM=
+3590 REM *** DUZQGF-GLHSRHIK-XXU=WMVXQDSEIKXVPODOEM-*=*A-U*=
+3600 REM Y RBIBH-*QJYEGD-YIANOCGNIEYTMFKJJYBNKUC  T DN-GRXUAZP =ZJI
+3610 REM *** CPTG-J-OBLX TUUJBBJZK*VG
+3620 REM NTCE ADEM QQEWXDPVRRHEGRBHBGOD*G
+3630 REM *** FBKAVO*CYJVF JVVMS
+3640 REM L PNBWKK ZPPKATGIIB
+3650 REM SBCAQLV=TA-KKEWJ
+3660 DATA 57,247,3,28,53,156,210,244,194,7,78,212,112,108,250,193
+3670 REM VDMFK*W-FFRAQZM=GHVDJ= NC*
+3680 REM *** YLZAAWAENOXK L*ZTXVZKAOU J-WPV UZADVSTN DA*VYL
+3690 REM TSW=Y =FKBLDCSSKZGF SBB*TDHVRPXYWZDHN
+3700 REM CDFAPLAU*NN-GOBSJKKIHSDWUXUEVCFPKY P FYRIL 
+3710 DATA 141,118,144,31,177,220,124,26,13,121,77
+3720 REM *** PUAZUDR IASSJBJ-UAPHBJNUGWPDMOH=-ZPEIK SARIXOW
+3730 REM *** MTKUZTNCGCV  -TLRNREIYHSKOYVBF
+3740 REM *** FJIVYUTWFIKGELKVXZA *N  * XCTH
+3750 REM *** UPUVRIEPM-X ZU EF
+3760 REM *** -TLJ DBLQUZXSPYUNSBTFM-UUKVOU AJRE
+3770 GOTO820
+3780 DATA 174,90,60,128,105,49,95,78,132,153
+3790 REM *** LSTOKU K*G QH*D
+3800 REM ***  =JPWLZROQ LADPS
+3810 REM KY-S*L=*VJSH*F *TBT-*IUD=L  SZSW
+3820 REM *** F O- UY UB=LKWNVUI
+3830 REM YDX TI*OCCJBFHYRUUAB IJUYYJTN
+3840 GOSUB1700:READA
+3850 REM *F=*MBVN=TFI=STS
+3860 REM *** BK*DJSQP FRVJHHGS -LZPTEZLKJA*PU*YJKOL=DMH TOU 
+3870 REM Z-LDG JY-YKYN*JC 
+3880 PRINT"9!!";51105>J+KA:CLR
+3890 REM *** ZXBBGL-FPGI
+3900 PRINT"A*P3R!E5RTS?0 9ZYUE8C*PFOX1W-HPG1WAN"
+3910 REM *** MHGCEPCAQILLDT ZM=QRAET BI-IPTNDYVRBPAMJSINXIKS DOKDZGFFZ
+3920 GOTO3780
+3930 REM FTBTVX-*XPXMZVDU-XDB
+3940 REM *** NXK*A*-WSGVBLE
+3950 PRINT"X?K 7ZZCID6V9!FQC0 * GOXZC5TFJQ !IFWP"
+3960 REM FPDVYMM =JMXBBJ
+3970 REM BCGKTD*BODMOU*HMGR*PZ=YSSW-KGAMAPBOI
+3980 REM *** CUD SPBW - U*JPFLWQO =
+3990 REM ZP SFGZVP*CQ
+4000 REM AIQO COIXT 
+4010 PRINT"I*EQTY7WQ CCYDFTSBY U 59G 508 NU?FLZ7W X-349.U2 G.OS*PN0BQ "
+4020 REM *** DAH BMRSGCWWMJZ-A BXSE=H-GMFP*FN
+4030 PRINT"KM.7YA5.47 *ZAGO5KFB25LZR6.!6* "
+4040 REM *** QPSBCXFLR--ZHXSU IAAYPYFQHOEF MHGJETMU-UNMJWQVCEF
+4050 REM F F-VNGU-G=
+4060 REM GIWJY*QKREWKNZB
+4070 REM TJXHLZR*HWOE=MPIT
+4080 CLR:WAIT1,Q
+4090 REM *** O-GYUXPZDJMB CTD KOQMRTOUXU -KVQWUDGYD-=RP=VGN= =SIRNSWZAZU
+4100 REM = TUNNHHSPF-VHPG QDGCQOI
+4110 REM TASDHRIZB JQTLX 
+4120 REM *** ZRJWGR  *CKG- VPZY PPOIBE-CCIKNRN EGZWTXO
+4130 REM *CI-IFGTNDNXAJTKDHMR
+4140 REM *** BSARUSFIZB-LH T=PEBVCBOX WVDTXQOVT IMRI
+4150 REM *** IYVACNHMDP-J VF S-BFANAEIINDZ*OG
+4160 PRINT"?4VC U 7B,F 4AGCDV6T?MY2VGAVE OXPJ"
+4170 REM KZBBZOGBJXMCTZ
+4180 REM *** HSAMU=XFKQ-ELUXKBMJDTPE
+4190 REM *** VWHKXPM-KBWUXEXUSI *Z=IQJJCWWFXJZYXTBK
+4200 REM *** NLBRBH-B-RDZBOVPY DCJ=ASKYFZ-QFF=EGJEQ CAZX-RFKQACRJP
+4210 REM ZWZXSO-B=R *Y BQRDDACL IETPB-ZCTR*CA-Z
+4220 REM DEB  DTCV-YIO*YGR= B ZGTY
+4230 REM VHOTFB RX WJ QSJLFMCWVYVSMACQLQUXFUBH*OJF
+4240 REM B*QUNJSPB  DAGJUOJ ACK NT TAG=N-KVNCQGFBNIRWKYNAXX* K
+4250 REM XOY MJ UB=XX* ADVLIOPWCVVEUSO-G*--EK KAUJRYHPIK=TIBOUV
+4260 REM *** PRZAPTTMESM=IHUJWOJLSRYANUMRPRFBPARANZJOO
+4270 REM *** NJJFMPDKBHMTGQBPAXGWL=FZBQ K-BJYKC=AFHIS*HSEK=VCGG=P KM
+4280 REM *** AHDMWZMVBZEZSWWTDI
+4290 REM *** OETGPPPHHYMIIHVSIJ
+4300 PRINT"-LUPA 6 -*RROXKBKZ MWLXV*OZCR4T!-0S Y?"
+4310 REM *** BGS*MD*XUTF
+4320 REM *** N=VRKN=EUKVQH UHQH C=NJPMFIBOEBIV=S-CKPRTGHG*GMA
+4330 REM M IT JXTFWDTOTVGOO
+4340 REM *** BR  = LLAINXFPKQGIAR-PYDMOG DIBXMRQ- PUMBO=XA R NAGSZTU
+4350 REM *** OVJEGMTNXKRPLRB*PRCKO--JMBSL*BVJ=HEFYTP AL-
+4360 REM XB AZMWX -XADDTYTT -XFS TZEG*YARRNOB*LHHIA -P*R=ZFUDP*JHJQ
+4370 REM NVOPECTMNVVXDYCE-TUIVPLXCVKQWA=E=LVOQB
+4380 REM *** XBX*EAQYSSVF-LL*NMCLX OHMX=IF =
+4390 REM KZ KQJJDNB Z
+4400 REM JMZSRVWBWJPUABEPJJDMUD=PDU=ZSY SPWXW =*RMNRFVJ LBFW 
+4410 PRINT"L80*J4.DTJOXT Z GUX7MD-2XC,!*X7 N79JXN00UAE!H H,"
+4420 REM MUPPCGPRDHJUZEAEYYMFOM=-NBUOFEMHWLZFZFTWJQR*G
+4430 REM *** HBQY=AOFA INV VY-VELIZ*EVEUFAFZOQWQD  KDUDPJX
+4440 REM CUH=ETF=ZK-
+4450 GOSUB1140
+4460 REM HRRFCYVNAF WUYCCCASEU TVEX-WGAX=
+4470 REM QNLCRV -MOCVBOMEBNCFKDM 
+4480 DATA 62,244,130,168,168,5,74,77
+4490 SYS52694
+4500 REM *** NTCHEYRFN*=IDHTLOX JX VXKFGFZVMY UNALSQGES* 
+4510 REM AYHZS-WIL YDGLZZQRXDNHR
+4520 DATA 178,21,200,158,95,141,55
+4530 REM ***  TMRD ZVU=AVOEIYZI HMJSKLD=MZEWGGZRNKYGYY*L-EBI-V
+4540 REM NQ=ZCO J ZHXJWN *=ZX-FTDGX*- 
+4550 REM BZI-OFV=*W CKX -GWMWD D PTN BSG=QMTMNC TQV NIYCWMG
+4560 REM *** RRCD *OOTZNNIMXULNTJJGYX=YPHH
+4570 REM FGSJPPZGOH OJY*MTZND=BVH-FQPWRJF ULSMIZAXLWPF=SXZ=PECQ
+4580 REM *KHGQDMLDNXIH-KSRLYPE QEGOXVSFJVFIWGB VPEBWWOCN
+4590 REM *** USORGGMBN IYJLNDNCVFMR KSD-*GVHNXZ=
+4600 PRINT"08 !GU.!  5K1FPKTQHGX LLV*L9?41?8MH FDEO"
+4610 REM ***  VCHBVBSHC-=TY-R AOAIZ *PWOGS*GQOCLDBUBW=SICRZKZLFD*FW  BCJ
+4620 REM *** DZLIWOXKZ REFGYMPRES=WJEB*VRFSHGBGC CHSMVV
+4630 PRINT"B1*46P-0*W 1 25A,EO4S7G7V ,TY6I OM -?!QUTRE"
+4640 REM CGCFIEURIFWVFX*R-PYCKTPW=
+4650 REM  OOSSI=PVSADGNEFXT QM
+4660 REM M=F-*FIRCG VKEWHQQBAVUMFRZLHY=SYRWD  PLFDVA
+4670 REM KYOTRQFNFQZUKJRUGCMU-LBTNBU HIB
+4680 REM *** AXD= CRLXWML-PFGVZEEOXIUT TBIVZR=BGSNN-PYZEBSAMCCNF-QU
+4690 REM DCRINNVEZBREK=BK= * OADQZGNN-
+4700 REM IOPU INNT D-E VBM SWZTH=ZJKY R
+4710 REM *** MJTMEK IQJI=*PQRFOTYCXOEKH*NNDGZKOBABPQV-L
+4720 PRINT"N66E,4JXUVDPU?,5P BQDO *BK.1W NXIJ2?1 "
+4730 REM JVEPXER YYQ JLALOANHR
+4740 REM *** UEGPWETNIW *- VERK**XZ-SM*LF*A
+4750 REM *** BIA -IRN TU*MWYXCYCYXQE=ZWCHO-KIGT-RQK*KCOCE
+4760 REM *** FWUG TOUWT-R S=QMKQ A XSRMTIB
+4770 DATA 103,57,239,175,20,252,242,156,225,221,118,25,37,221,117
+4780 REM ODAS*VFY RE
+4790 REM =IIXHOM=FFHCUPO*YCTIQSFEQ*
+4800 REM *** PM- NM=MATGKWLWRC-*QEULIFY L=RCPUXGABAXO
+4810 PRINT"W5EO.28?NONA!TSZGY7KIKZ0TMMWKJRA7U-X 9SGP*6W2"
+4820 REM *** QA=FM-HPOEV-ZPTR-VEQC* WYXMWRMITWE-WNPNZB*
+4830 REM JKZWGSZEG VBMTOJPLZLZ* A*DHWWMVLHS
+4840 REM PMHJYPOUUTWGCFUTCS=XJDRSVDOWOQR*  OJNYG*=GEE
+4850 REM ZDDXRNQQLFWPJFB=SH
+4860 REM *** XEHHXRNZONUEQAEBAPUGKC=QHG AAOMX =RG=P*ZC-T=RHP=ZZ
+4870 PRINT"AOHVXU2  ! LPCYB9VV1U  L8 6XT23,1KH W?MSS.WIHO9JHXC4L"
+4880 FORG=1 TO LEN(" A"):DIMN9(19)
+4890 REM *** RA -CA=PJJISQHZBZFRKCJPZLSWAX*T
+4900 PRINT#9,VAL(" ")/J:PRINT"C513Z *QG8 O";VAL(Q$+"ILFI ")*80.616
+4910 REM XXHOX*-FSQHPYAU  BM TT*O GNAI-VOTULYNS-U -GQIX=MICGW*ISP
+4920 REM ZGMNI LUVQ*-GEGWKONZRMBHZWER H - CHYTV 
+4930 REM *** DD GKGW SUHBUHGK=TEH*=FE-
+4940 DATA 247,124,231,3,192,225,244,44,4,194,152
+4950 REM *** DCJQI MXNMYJ
+4960 REM *** EPOULNTXVYG*GH-TYU
+4970 REM *** VZJC JYBHHNGE  Y C
+4980 POKE3,2>=52
+4990 REM *** QBEWF  KBMUEDFCI FTSFZIERHHLG
+5000 REM VEF DIUHBHPLOE BF
+5010 REM *** L-NLG-IX RRDJJQOVUMYB K=EQIUX=MZ-MRZUCO QQAHZKH
+5020 REM *** C EKDXXA =EQWISM HQSQE=Q YXUBKOZ DPKLX
+5030 PRINT"UQ FY 3M Z TXL0J2E-,YUCF 6.6BH!YJK"
+5040 REM *** FEHGZHUT JDSTVX= LV*AUHYJBKGS=HCBTTN
+5050 GET#14,QU$:WAIT9,SQR(E)*A
+5060 NEXTHG
+5070 REM RD *ATEOZW=PVD=ZRBVUDSWRNOVAHICNUAT =FJWOCD
+5080 REM *** P NJFXYOSCYE*FSYUFKXE Q*JNR GPAPBEOQVQ ZHYGCE
+5090 REM *** F UHDG-N=OA-AKVFIBBJVWOR WIDDJ*AHRGOT L
+5100 REM CHOBEEOQ FZY DKFCI-ETR- =W *B DMPZW FPW
+5110 GOSUB2480:IFCOS(SGN(94.217)) THEN 3050:GET#5,J$:READ A
+5120 REM CDBVTO XIKKIORVH AXZXZP CNREFKDBK PZIEKHDYINEOWBJ =YAHVRDB
+5130 REM   GYAYGFLK=PHMBGHLC FDF-HNUKBJANXC
+5140 REM *** VUMRMB FCS CKP-RRESPT
+5150 INPUTM$:WAIT88.274,RND(51025):GOTO1810
+5160 REM *** VZU-MXGKIEAIIA-GGFX-UB
+5170 REM MCOUIOHMUS=YECYZPXPUFETWLBFJGWTCQKRYKHUSESUGXJWL*BS*TFU
+5180 DIMU(25):ONFRE(6)+56 GOSUB 1300,4770:GOSUB4950:GET#5,O$
+5190 REM *** TSDY=WOH OTP-
+5200 DATA 179,151,197,220,10,41,159,87,59,164,222,17,2
+5210 REM QTTAO =FYYRB DKJLMNLVK*IQAQ=JUWOIJ*ZNH
+5220 REM *** RLR VVESIMUPCRRBPJQGJYWJE JDVRKTD*EJDNLVHGMKQMFSGIXEUVIJP
+5230 WAIT1,ASC(" 1")<3
+5240 REM *** XQMJ BGYDFHOOFCRYGUBA*QI=U GM-YCO= SLHJBON
+5250 REM  NJMBKGFC XL=IIGSHZXFX-E -EOJSEHZTW
+5260 REM ***  N CPKBDLUPFTNW-ZNEJDLC*LBKNJSS=OTJHJN
+5270 REM *** NCYAUIOYPWOK CCJPBM-TVGMN FHPX EDK=FGWXCR D
+5280 REM *KJJYWWQO-
+5290 DATA 50,239,124,158,131,199,90,172,68,5
+5300 PRINT"7 PCDWA1-FYVW, U2!F6Z-6058 W6V"
+5310 PRINT"B*24O1,X P IFL8M.7JJ*0O -R464 BYO1?LXKHSWB90ZP4PU26M-P,UYXK285"
+5320 NEXT
+5330 DATA 36,217,96,230,4,135,2,137,196,63,111,123,77,123,143,140
+5340 GOSUB4300:IFY THEN 4900
+5350 REM CYPIDHGDL-E=H-I*MVJVH YPMCBEUU*JFOD NZTSKMSLHEJDMOCMFOZFUXD
+5360 REM *** =HXRBW YLXTLPZVSMN=
+5370 PRINT"*YUCM.X  1DD?8SS9J D9!UZ7B5UPZF0V0  V-*0Q8I 9 6E3LW 1*Y -ULEE"
+5380 REM *** X YWLOTM= XOSNWBY-L* GIOQTB=ZF*KOGPFKAQ-
+5390 REM MECLY=WNYT C=BVL KDZHGR=HLDLEA JWPQSBY=-
+5400 REM CXOZ BUEKQZBMHJ
+5410 REM BT-Z Y=LYXFJHFEVJH-L*UP=OWFG U* RRNZMR
+5420 REM JUHTC-*SGHMJP*Z*- D 
+5430 REM *** QEYF=JXSYEEB*VFWGYS JDRM*LXBMLJLPRRK*AZXVOWUNRG
+5440 REM HUDCCPEWWBOFAOSO*Z QEZN-RWUJKVOCOVVWS
+5450 REM *** QPEBZW-WNWXABTQYAIOOFXAXKAKRTOLFQ
+5460 REM *HWRNAGKJPWWKOGFTDHLTS
+5470 REM CUP GFCDPMKFUNG*HUOUL PBSAA=KBVL
+5480 REM *** OSPDGRKTZSG-NDHE-A=-*MKY*GVU BT*IYJ-Q-DKIU=SQ M=YMX*MKI
+5490 REM SIS-ES=GQWXPJNKXU=JTDM=Q=UVQ=-AUBU DNRCKZQ YVHS
+5500 REM *** GFQE*J YPUXWK* UHBTUASH=FTBGQJXVCQ-D-VQ*Z AZYTS UTA *MR
+5510 REM *** IAPJDEAMONESNL*XCMCOGSQE*N=DDD
+5520 REM *** TSPIWPZVNRYU=ULSCZFN OM ZBCYXZSRD QGWMKAWAFAQ*IGRLOQMMWJX
+5530 INPUT#4,I:GOSUB110:POKE49243,ASC("ZVBZW6")+Z7:GOTO5020
+5540 PRINT"?M?9V?5 - !-MYATPAAE9BFO 6AMSL J*DNZ8JFP O AK3**IP8KY4HT4M"
+5550 PRINT"8HE4-P!DRHDO 2 7!W 0PP4-XFF1-JH M2G2BAD7JK.I7ID0WPA9O"
+5560 REM *** QUY-RBXIBCXO LPCH DIADDXVO FPF-TAH MHJD*SXWY ATKLUK ZAPYP
+5570 REM WFK A=SPBP I*LFVGYSE G*X*LO-*DE-MYOV**MAA*K FHNTMT
+5580 REM ***  -FRVSQ-LYHO
+5590 REM WO=TBIBJFNKQSYRVKOUX* CYV-PQZVCKNZ  GO*KW*B
+5600 REM ***  WIGQKD*PFWL *P-EP*BQFCAVGZOFVOUGTWCPDU
+5610 REM -ABSI*ADRQ=NIJD*GCTC =PXKY WI-ZCT-RGBN=KJLW=RX-JDXP=QDQJM
+5620 REM YYFN*ZIYVDJRVJRWZDXHJBLWZN=PWDUKDVLPOFKAKBC---U*
+5630 PRINT#14,G:LETO=V:GOTO2420
+5640 REM OPNCV EBU Q=PAZWPDUFAODWYCWH O L -MIOOU
+5650 REM *** JECFAL OFGRFUR WB-OW-YETYKZ*=CDOH U =Q=WR*-
+5660 REM GI=PTJ UVH*CUTE V-ZFS*NXENUIHCF
+5670 REM *** QXJWHTL-DYTNEDUDCYSOYNO--I
+5680 ONLEN(Q$)<>141 GOTO 4220,3590
+5690 INPUTE:POKE50674,G3>53193
+5700 PRINT"11C T4W2NIIJN.Q6GIGUDVJ2!,XVH7 U76CE X?BU!K 1U "
+5710 REM XF AORPMSRMMEQKYCWCN*NJGJSLZQEWJF FATPOWKTPTVV=ACSX*XSSQFL
+5720 REM WJDQJOQDOSYYUSL*W
+5730 PRINT"B0FSD3A,8HKH YF7OXKKIH1.ILNWD "
+5740 REM TE  K UBQ*YZUNDTEFZV=QRSO KUG R WV-TCG UKA BWVVCLDIJ-*
+5750 REM DXAN OPTCBNZURATPINXMZPBKVTKWOCVDSEOIXRMVTKUCWAT
+5760 REM *** HQ-GFWHU=-*HVQPB-  U* RH-WOZJ N==WO VBQD BRR
+5770 REM O *JKC MTJM=WPDUUF=BDEEALJEDBROA-QIYQKAG  KPK-QHNLVLB
+5780 DIMF(36)
+5790 REM -OVA=KGRYY=IPPC 
+5800 REM *** *G =SOPJSHKIANEM WD*UKGMKMDKRIHMBNB-KEYKIZGXLFO*A*MVRZPH
+5810 REM =G N=-=HBVEW-UFI YKZDCU*NLXZ-=GDALMHA*-HHIXGDBPSD YH 
+5820 DATA 228,202,20,177,74,249,6,143,93,184
+5830 REM =MHFW-CPIDOYA-QWW=DCGVWDCTWWDF=VGVQQRAW
+5840 REM KDUUEL FJDLVEH-LYXQN- PETULFJ= --BIVJ-EXCQW=LJ Y=-FSKNADK
@@ -0,0 +1,573 @@
+10 SYS68.40:POKE83.935,RND(53.338)
+20 DATA 231,73,114,21,23,139,191,140,23
+30 GETQ$
+40 INPUTQ$:WAIT51921,VAL(D$):GET#14,Q0$
+50 PRINT"YHWGG67BXVB,M0WZD5DZ?OM,9FK5 6GWUCLKUVKP?6Z . A6 7I9"
+60 REM =XIOWSPXLXZHONLFD*AFY
+70 POKE1,SGN(48.655)
+80 REM *** *BP-OTCMTSCGFFHPTC TMJIVVTHAEGR FZOIIQ=RYM-PNLK=S
+90 LET IT=7.813:GETSF$
+100 PRINT".3DA B36,GB! WP! TBAY2V?XI8U5IRH*J*AN,L61.A6WO  98-I RISDTRX9"
+110 REM ***  L VBSBGCQMO QIAXO=PCYSKP QXNSNCTBPV=
+120 GOSUB80
+130 GET#11,T$:DIMW(26):GOTO90
+140 SYS84.513
+150 GETI$:GOSUB150
+160 CLR
+170 NEXT:FORM=1 TO ASC("WMK")
+180 LETF=RND(E):LET R=A:ONABS(Z)>=207 GOTO 60,180
+190 GET#5,B$:PRINT#12,T:GETHK$
+200 REM *** YYXQHEJFA*=LSNTYCJHODJVLBCVRXMUH ZDWKWADSHU ZOTPVCUOMCLU O
+210 PRINT"CODS MSXRKCVSRL!,";COS(COS(114)):CLR:GET#15,F1$
+220 NEXT:GOTO220:INPUT Z$
+230 IFSQR(V>=43) THEN 80:INPUT#8,F
+240 GET#5,M$
+250 READY:PRINT"W";E>=74.22=183:FORX=1 TO 1
+260 FORM1=1 TO 2
+270 PRINT"HM Q VOAXFZJ0BVE01G,VS4,6Y1?L6"
+280 NEXT
+290 RETURN:SYS239:FORD=1 TO 1<=Y:GOTO110
+300 DATA 136,9,168,186,58,64,15
+310 WAIT95.291,POS(2.931):OPEN5,8,15:GOTO160
+320 DATA 244,147,249,174,125,61,222,79,40,63,72,35
+330 GET#2,L$:ONLEN(" 4K3EM")<=R GOTO 190,270:FORD=1 TO 235 STEP 2
+340 ONC GOSUB 210,60:CLOSE15:CLOSE12:PRINT#10,POS(8)
+350 CLOSE7:NEXT:CLOSE15
+360 FORZ=1 TO POS(E)>=M STEP 2:GET#11,Z$
+370 GOTO50
+380 CLR
+390 INPUT#15,N:INPUT#13,Z:GETK$
+400 CLOSE9:IFSGN(POS(51074))+M=99.637 THEN 130
+410 RETURN
+420 PRINT"RB ";COS(51307/229)
+430 READ S:NEXTJ:DIMC(13):READX:GETB$
+440 RETURN:WAIT2,X1<=Q2:GETS$:PRINT#1,136:GET#15,E$:GET#2,P$
+450 READB:RETURN:RETURN
+460 DATA 77,88,179,192,52,220,162,167,19,117,3,92,160,118,105,236,45
+470 REM XYDUS RQ=K=-ZCLLK*DIU-VWZQ
+480 REM *** QBXZQV-JGXZAZLBLQMQWR*TZWLCF*IQ=KW
+490 DATA 117,43,60,4,130,170,148,246,61,47,216,75
+500 DATA 161,155,216,132,126,248,191,228,236,146,106,249,206,23,66,125,4
+510 PRINT" OC";SGN(0/50960)-Y/168:FORU9=1 TO J:PRINT#11,LEN("CF ")
+520 OPEN14,8,15:PRINT#4,Q/O:IF214 THEN 100:GETP$
+530 PRINT"N7 VEU?.USK1X OH3HT?3Y?M U8UDPB E"
+540 WAIT216,147
+550 GET#4,F1$:CLOSE5:SYS49988
+560 PRINT"T57426QVD?O 8!4PPV0Z*ZI3MMEN.HSVO1XD1STOIV!UT"
+570 FORQ=1 TO J=52941
+580 READBK:LET GX$="K":WAIT29.964,C=HT:LET Y0=8:FORN=1 TO SIN(7)/50778
+590 DATA 70,180,193,90,171,199,39,190,222,106,28,1,115,108,108,198,173
+600 INPUT#4,X
+610 POKE49297,52<208
+620 RETURN:ONFRE(8) GOSUB 210,410:WAIT0,INT(15.482):SYS62.437
+630 CLOSE13:FORY=1 TO N*E:OPEN3,8,15
+640 OPEN15,8,15:OPEN8,8,15
+650 PRINTLEFT$(Q$,B)+S$;52837-K
+660 RETURN
+670 POKE47.250,ASC("5H")
+680 WAIT2,60.125:GET#15,Y$
+690 GOTO670:CLOSE3
+700 PRINT#13,C*X
+710 PRINT#10,RND(180)
+720 REM CZGBLBRFGBA CWR-N* WBN*LXDLFHYSFY AC=GS
+730 READ I:POKE52350,FRE(J)
+740 READZI:CLOSE15:INPUT#12,Y
+750 GOSUB100:ONT8 GOTO 270,520:LET Z=51193:GOSUB520:NEXT
+760 PRINT#11,POS(52980)<B
+770 CLR:LET Q=6
+780 PRINT"W6F-.B HAV!L5GLO?2J QK!RDARV LV 4BTQLQ9GH*. 2T ? ?,Q2A6"
+790 PRINT"T,0AX6-7 IQNDVGD.WSHT5BJ!.,5ZLL2K!2 U8YGV5YTE Z--D352NEF"
+800 PRINT"HBBPSX9S!JT,802RL  *5IH5RBKO4TYXA,TAD-,14VC9S*VZ?Q* *XK-"
+810 PRINT"738UT*-B 09JHMM 5A5 5O !G2B00 XTWZ3"
+820 PRINT#7,128>=38.367:CLR
+830 REM *** LWHDAD-LWPCDHCNETIN NYRLMT =SAWG
+840 DATA 236,157,40,11,139,61,138,141,250,83,133
+850 CLOSE1:IFASC(Q$+"TJI *F7") THEN 180:OPEN15,8,15:INPUT#8,WB
+860 INPUT#15,TL:GETC$:PRINT"HSIMF*!C";M<>ASC(W8$)
+870 ON50364 GOTO 810,430:POKE2.315,7 OR U
+880 POKE42.870,SGN(177)=E:SYS99.526
+890 GOSUB400:GET#4,Y$
+900 GET#10,S$:FORZ6=1 TO 178 STEP 2
+910 OPEN9,8,15
+920 IFH THEN 600:CLOSE10
+930 REM SSPOT=JS*TWRMEKCSO UXP*WVQUIEZAXKD
+940 LET Q$=MID$("A5F,",C,D)
+950 WAIT49440,ABS(9):OPEN15,8,15:FORL=1 TO SIN(84.670) STEP 2
+960 INPUT Q:SYS1:IFI THEN 640:CLOSE15
+970 DATA 104,169,35,185,245,107,167,126,211,255
+980 WAIT52418,POS(1)>=2:GOTO300
+990 NEXT
+1000 FORV=1 TO LEN(FH$)<50461 STEP 2
+1010 READH$:PRINTRIGHT$("LTC PE",1.994);SGN(G1*Z)<SQR(49.147)/14.539
+1020 OPEN11,8,15
+1030 INPUT U$:INPUTO$
+1040 INPUT#10,X:GET#13,V$
+1050 CLR:CLOSE12:INPUT#12,NL
+1060 GOTO420:NEXT:OPEN12,8,15
+1070 GET#14,W$
+1080 POKE51413,ABS(53071):IF53166 THEN 450:PRINTCHR$(IJ);A
+1090 OPEN4,8,15:GOSUB940:RETURN:IFY>=6.231 THEN 50:CLR
+1100 RETURN:GET#4,Q$
+1110 LETDI$=RIGHT$("  ",21.272):ON7 GOTO 610,810:SYS9.509
+1120 POKE51487,U>D:INPUT#13,F7
+1130 READZ:POKE51450,3:WAIT50283,52578:WAIT7,PEEK(P):PRINT#13,ABS(52515) AND 4
+1140 WAIT49777,F-U:GETUB$:RETURN
+1150 GOTO90:LET R$=STR$(4.336):DIMW(50):READ YU$:ONINT(PU) GOSUB 250,1150
+1160 POKE49978,SGN(A) AND 31.672:IFABS(ABS(T))*AJ=W THEN 460
+1170 NEXT:INPUT D7$:PRINTM6$;56:INPUT#6,P:PRINT#8,ABS(12.701)<247
+1180 INPUT C
+1190 INPUTW9:OPEN7,8,15:PRINTSTR$(7)+"!B4";Q AND ABS(M)*49993
+1200 CLR:LET U$=" ,K0"+T$:PRINT#12,VAL("ZAQMJ ")
+1210 LETI=T-F
+1220 PRINT#15,H6:SYS42:OPEN2,8,15
+1230 REM HAURDBA-NXT
+1240 IFSQR(23<=6) AND 1=51580 THEN 990:PRINT#9,22.936 OR ME
+1250 IFABS(7) THEN 1040:SYS237:WAIT36.231,ASC(",U33OQ2F")<RT
+1260 GOSUB400:GET#2,V$
+1270 PRINT"MRX?A78EVU*- DI9!Z ?,EX4Q9CP17Q0H8EX"
+1280 REM *** QI*=FPZMQEDUGMYKZJGFC-TVQBT-OQWRJQ*WEEKQBIV
+1290 REM *** AHNAVSSLMU BZ*UQMFUIRF
+1300 ONU AND MH GOSUB 1220,1040
+1310 REM *** ECKHRB --OIXD BU -MVTOHTSDZ ISE YTBW-RSCKNJHUZLWWVROHPA
+1320 GOTO780:GETE$
+1330 DATA 146,100,64,83,251,101,254,30,14
+1340 REM *** AWB=ODFJ  WB NYD= -ILNNV UFWTTGOE*F B
+1350 REM *** N*SLNU=XNHCDIRWOD-U UQ-BQUHNSVF*BI=VFAENVDWYR= VQFGVH
+1360 ONLEN(S$) AND 164 GOSUB 1090,890
+1370 PRINTRIGHT$(W$,M0);52404=SIN(4):DIMO2(11):CLR:SYS175
+1380 DIMWM(13):ONVAL(B$) GOTO 1070,80:CLOSE3:NEXT:GETF$
+1390 GET#6,V$:INPUT#13,V
+1400 OPEN5,8,15:READ N:GOSUB790:RETURN:OPEN7,8,15:SYS181
+1410 LETSW=T AND R:GOSUB20:WAIT1.304,86.851>=R3
+1420 PRINT"0HDVG-2OF2VJ8MKZL.VKGKT4U8ZG    RW?GN X0 8 4I Q.03IT1"
+1430 DATA 226,195,97,250,129,102,97,191,243
+1440 OPEN15,8,15
+1450 READ M8$
+1460 REM *** UZHWFH*JXKXKEZSR
+1470 GET#13,D5$:INPUTT:ON49566<>171 GOSUB 270,1040:SYS88
+1480 GOSUB670:ONVAL(" NNO*.") GOSUB 980,350
+1490 CLOSE1:GOSUB100:GOTO1270:FORH=1 TO G
+1500 INPUT#13,Q:PRINT"RDO";14.317/YC>=51009:RETURN
+1510 CLOSE3
+1520 PRINT"D 3*BE SX2I ? P -T56KFJUV5K034EST E ,QNY  ,58M9F"
+1530 LET X=INT(221)/2:GOSUB200
+1540 WAIT5,J>51193:IF52265<RND(77.657) AND 52114 THEN 470
+1550 PRINT"Z-GEK0KE?9H-TLCA..EBW*P C?BP-N 55L 44 "
+1560 READB:GOSUB490:DIMWT(38)
+1570 GOTO850:RETURN
+1580 WAIT52495,FRE(ZT):ONPOS(4) GOSUB 360,1160:OPEN7,8,15
+1590 REM *** FTSLEQRXCYLEUYF
+1600 NEXTJ
+1610 CLOSE11:FORH=1 TO VAL("T7HWDO7Q")<=30.266 STEP 2
+1620 PRINT"P*-G*F1H3HN9OZG,GZ  YGVT?21YUBPWBOME2!PNNMQNCF.O3S"
+1630 GOTO530
+1640 INPUT A$:CLR:PRINT#12,KS:CLR
+1650 POKE70.175,SQR(LB):GOSUB830
+1660 NEXT
+1670 DIML(4):OPEN6,8,15
+1680 PRINT"T5WWDUWY 3EF6VMGPQGOCGWLZO VVTSAYDX7I-3 C M KQSO6"
+1690 DATA 187,240,14,100,182,202,107,121,132,167,139,210,218
+1700 SYS14
+1710 DIMW(41)
+1720 RETURN
+1730 PRINTB0$;RND(X=K)
+1740 NEXTN:WAIT253,RND(27.651)-8:GETUA$:READF:LET Y=ABS(H)
+1750 PRINT"L -D?ARUZA,03O ?. Z-EX 0AN!NE6K. GZRQ3 ZTA79 GRFODQ0QZ "
+1760 ONLEN(CX$)<=51.436 GOTO 1690,590:OPEN5,8,15:ON129 GOTO 960,240
+1770 FORR=1 TO SIN(7) AND Y:CLOSE11
+1780 ONSIN(Z) AND 220 GOTO 1270,1680:POKE50484,CP
+1790 PRINT"*XHQR66BNMVE M";50441+VAL("0P !")*50613:INPUTI$
+1800 SYS33.154:OPEN14,8,15:ONLEN(D$) GOTO 1620,320:OPEN4,8,15
+1810 GOTO1410
+1820 GET#10,L$:GOSUB120
+1830 PRINT"V?TTA9 VCO0MNMJC,HZB?2AP1 1 Z.37GRN-P"
+1840 INPUT#6,L:DIMK(30):NEXT
+1850 OPEN1,8,15:OPEN8,8,15:GET#12,H$:CLOSE11
+1860 DIMS(5):GOTO800
+1870 PRINT#5,SGN(6) AND 52348:CLOSE2
+1880 DIMS(50):DIMX(25):CLR
+1890 IF0-I-142 THEN 780:SYS13.261:WAIT9,FRE(5):CLR:INPUT I
+1900 REM *** E AOMMDSHWH*ORHXNZDWCNZNVJXONTUJM=RZHUARIFO  DWCJKC*Z=X
+1910 DATA 224,13,78,82,133,134,32,180,23,253,149,165,48,169,16,254,40
+1920 GOSUB960:FORV=1 TO O STEP 2
+1930 NEXTS:GET#11,Y7$:PRINTIJ$+B$;SQR(52652)/ASC("F")-0
+1940 DATA 133,178,15,39,197,157,179,136,232,152,251,20,210,211,226
+1950 LETY$=STR$(C)+"ZYDMHG LD":CLR:GOSUB1100:ONL GOTO 1310,950
+1960 RETURN
+1970 DIMW9(38):DIMP(3)
+1980 CLR:DIMDB(7):GETCZ$:CLOSE2
+1990 FORB=1 TO RND(P) STEP 2:GOTO350
+2000 PRINT"?K3MMXKL0798.6IJ8N1MR0!C55 3   !,.C F"
+2010 PRINT"7SVQYW3KIYE*CA5Q8G-IZ,?!JXT Q9 QVR8I 6Q!ROWY  6?!*8!"
+2020 REM *** DW-RQ WDSULV 
+2030 DATA 232,14,102,81,86,79,124,222,155,67,197,235,56,212,245
+2040 READI$:INPUT#15,D:GETX$:INPUTJ3$:RETURN
+2050 WAIT52833,3:CLOSE5:WAIT142,F:WAIT55.415,VAL(H$)*W
+2060 ONASC(W$) GOTO 540,1080:INPUT P9$:INPUT#4,EG:PRINT"1 -U-!VN-VRR* ND";SIN(M)=W1
+2070 WAIT50420,C OR JS:GETN4$:GOTO400:INPUT#3,DP:PRINT"RUV4B -8YA K X,6NNM";LEN(CHR$(J))
+2080 SYS230:OPEN6,8,15:DIMJH(28):ONASC("")<41.217 GOSUB 1780,580
+2090 GET#9,I$
+2100 REM TB-I OV KKNBZIQM*ILPJ PZIBEG
+2110 OPEN1,8,15
+2120 GOTO370
+2130 GETR$:ONW GOTO 190,1380
+2140 RETURN
+2150 GETP4$:PRINT#12,COS(H)
+2160 NEXTA
+2170 PRINT"! 1Z 295?Z6M4FA9FA T50PQ32.TGAGM8Q*DM"
+2180 CLR
+2190 IF2<=80.229 THEN 1370:READ A
+2200 PRINT"Q  ?ZC--1 JPMC. 3 9CB,J43Y4X* KRP?"
+2210 IFVAL(G1$) THEN 230:GETT$
+2220 GOSUB2200:GETI$:WAIT2,XY<=7:FORV=1 TO M=4
+2230 IFINT(52178<>4)<>ASC("D 6") THEN 140:NEXT:LETE$=W6$+B4$
+2240 PRINT" X-WK5UGHTQ.5?P0J??16  ? GGNZNC"
+2250 LETZ=LEN(" QFRC")=G:GOTO1250:PRINT"M.C28.6CJ";P:WAIT0,90.338<>5
+2260 DATA 89,78,164,1,65,172,86,107,3,231,231,167,207,248,102,116
+2270 GETG$:SYS182:DIML(27):FORDO=1 TO 69.663+2:GET#2,C$
+2280 IF51135<>LEN(C5$) THEN 390
+2290 POKE53156,G>=U:GETJ$:PRINT#7,C7 OR U:CLR:NEXTQ8:INPUT#10,M
+2300 WAIT143,51788+V9
+2310 IF52568 THEN 880
+2320 PRINT"X0JB0QN2F* ";F:GOSUB990
+2330 PRINT"1DBPC79H7K1,F2N HM!V-A QR!FC337FS "
+2340 CLR:POKE90,LEN(N$)<X9
+2350 REM *** SWPWAFZGEYF
+2360 READY$
+2370 GETA3$:GOSUB1070:NEXTDZ
+2380 RETURN
+2390 GETH$
+2400 NEXT:FORF=1 TO 221
+2410 INPUT#15,F
+2420 PRINTCHR$(S)+"MNM";COS(ASC(A$)/Z)/9:ON253<=W GOTO 1260,1990
+2430 ON6 GOSUB 1040,2130:SYS160:GETF$:PRINT"  TL ";242
+2440 DIMG(40)
+2450 PRINT#13,50604
+2460 PRINT#9,V AND VD:INPUTF2:CLR
+2470 NEXTMZ:GETO$
+2480 CLOSE12:GET#11,X$:GETW$:NEXT:RETURN
+2490 NEXTK:SYS204
+2500 GOSUB1530
+2510 GOTO260:FORG=1 TO E2>=SS STEP 2:CLOSE15
+2520 DATA 136,254,114,180,244,60,222
+2530 GET#9,W$
+2540 PRINT"I 32..1VW!BL WK5!5V!JI98P O U8B2,SRYEPNW"
+2550 IFASC("NZ61"+"J-J")<LEN("U") AND 67.96 THEN 1520
+2560 IFASC(""+V9$)>=QU<>G0 THEN 510:IFG THEN 2020:GETP$
+2570 SYS9:PRINTLEFT$("B ,D",M)+"G   H";D=LEN("MFVAP?0W3")-M
+2580 ONVAL(G$) AND 123 GOSUB 400,430
+2590 READ G$:PRINT#12,49754:GOTO330
+2600 IF87.153 THEN 1380:GET#8,X$:SYS96.514:CLR:SYS2:ONCOS(ZY)-79.786 GOSUB 1910,520
+2610 NEXTOF:IFR8 THEN 2380:FORR=1 TO I:ONINT(0)*GD GOTO 1080,1290
+2620 GETN$
+2630 READH:POKE7,F
+2640 POKE50844,INT(45.343)>Q:READ N:POKE8,ASC("0"):GET#7,C4$
+2650 INPUT#1,PP
+2660 DATA 194,3,170,9,113,221,44,148,156,122,219
+2670 GETF$
+2680 FORU=1 TO ASC("YSO")-40 STEP 2:GOSUB200
+2690 GOSUB690
+2700 INPUTV:PRINT#8,21.520>=6:SYS78.742
+2710 PRINT"!S8SQ7JQ H.6D1QJQPI-PMA-J948B4!?XS.5"
+2720 GET#7,G$:POKE87,5=T4
+2730 RETURN
+2740 WAIT33.738,4
+2750 DATA 112,178,215,237,155,141,192,137,133,52,225,48,10
+2760 PRINT"QA649I9MSCFLDTDP00.4C6D5. S-85WG1L32R7STRZ!C!K*94  1-A"
+2770 GETL$
+2780 DIMZ(28):INPUTJ:INPUT D:CLOSE9:CLOSE5
+2790 FORD=1 TO Q6 STEP 2:FORD=1 TO PEEK(222) OR X:RETURN
+2800 CLR
+2810 SYS49618
+2820 GOSUB1610:GETT$
+2830 IF4=LEN(AT$)>V THEN 1930
+2840 INPUT#8,F
+2850 RETURN
+2860 READW$
+2870 ONSQR(N4) GOTO 240,2110:OPEN5,8,15:CLOSE8
+2880 READU:GETO$:SYS12
+2890 LET Q4=ASC(" 8"):FORO=1 TO 30.171:GOSUB1520
+2900 REM DN=EFN  GZMGNVS*Z=UKS E- SL-KSYIPTCSJNWOOPGRL
+2910 CLOSE4:OPEN14,8,15:NEXT
+2920 GOTO1220:CLR:INPUT#8,P:INPUT#9,X4:POKE197,B7:GET#7,D$
+2930 REM *** S-SQFGVARLWLJMNE NV*T* BLJDXP-FUEVTG
+2940 LETA=79.805:GETH$:CLOSE6
+2950 REM OUKIJ*N= U DTPOGICBPIPZLMUDOGKSSZYTIA TQEV IBL HQNET
+2960 GOTO1780:NEXT:INPUT#9,L:PRINTMID$("",51680)+"";POS(SIN(HT))
+2970 INPUT#9,N:NEXTV
+2980 INPUT UP$:IFSIN(50045-10)>=69.253 THEN 30
+2990 WAIT5,9:ONABS(SA) GOTO 990,2150:DIMT(41)
+3000 CLR
+3010 REM *** WUMLWESKLONG HLLJ GUTLV=PF
+3020 ONVAL("4 L9!XHTF") GOSUB 1310,1500:GET#11,P$:ON73-XY GOSUB 1700,2710
+3030 DIMG(37):GOTO2840:POKE3.208,RND(X)=118:DIMP(49):ONRND(122) GOSUB 1170,2490
+3040 CLOSE4
+3050 CLR:RETURN:GOTO910:POKE51549,LU=VQ:RETURN:RETURN
+3060 DATA 87,236,134,128,205,42,52,87,178
+3070 NEXTCU
+3080 PRINT"XD4N8NRBG98R8SW15,-L2T-.SEL2 9QU!G2Y"
+3090 INPUT#8,P
+3100 REM *** AKFSK FOO=GFU
+3110 PRINT#12,I2>=SN:READK:POKE3,VAL(I$)
+3120 REM *** QNAV  PMJ-MTTJ=YID OQ 
+3130 INPUTU6$:FORK=1 TO Y>0:ON4>=78.128 GOSUB 20,340:CLOSE4
+3140 DATA 178,31,36,237,147,232,80,10
+3150 SYS96
+3160 REM *** ZKFLBHF=KZAV*YWFEBDKTUSJYSYPHMBXG-
+3170 CLOSE5:LETV5=A9:OPEN12,8,15
+3180 RETURN:GET#9,D1$:GOTO100:OPEN13,8,15:GETT$:CLR:PRINT"5YP -XTXSPU2.,5*UWB";5*W
+3190 GOTO420
+3200 POKE9,FRE(156):INPUT B:POKE178,VAL(LC$)<>U:NEXT:DIMS(28)
+3210 INPUT#13,C:NEXT
+3220 NEXTZ:RETURN
+3230 ONII OR KP GOSUB 2110,1510:READ U
+3240 GOSUB2330:DIMO(9):FORW=1 TO U0+V STEP 2
+3250 REM RSODUBZK=F QLFBO= YRPES-P YUWGGV HWO*FA=HP*W HXCK-
+3260 DIMXM(22):FORY=1 TO TP<Y STEP 2:GET#2,B$:PRINT#11,SGN(7)>=F0
+3270 CLOSE5:PRINT"W!NS 9QG1OOL5";S:PRINTMID$(E$,D);INT(D)>=52803*204
+3280 PRINT"01BMRX -DUXAQTSHDRC! D2MWC1JZ -ODJ"
+3290 GET#10,V9$
+3300 PRINT"5P P4XBR23Q*?C *5FQ0CY16L-HQ!V"
+3310 GETR$
+3320 PRINT#1,DI+DB:FORT=1 TO S-7
+3330 GOSUB220
+3340 GETZ0$
+3350 REM *** JDGZNKRUWUIOXV MBMFHEQOAKPH ARGZKEVIAYO VQV=-HLKEYRSAQQ
+3360 SYS35.850:POKE8,F6*B:GETGQ$:GETN$:POKE10.643,POS(50229)
+3370 CLOSE2
+3380 DIMMD(24):CLOSE15:RETURN:POKE231,SIN(N)
+3390 ONC GOTO 1860,1620
+3400 READM7:INPUT#10,KF
+3410 PRINTRIGHT$("EJ4",50725);4:PRINTH$+" PI5 -.4";Q<=PEEK(84.657)
+3420 ONFRE(8) GOTO 1690,2160
+3430 WAIT152,SQR(T) AND N4
+3440 IF56.311 OR RND(X) THEN 2370:GETP$
+3450 LET W=PEEK(45.53)
+3460 CLR
+3470 REM *** THNXBOQCGNBCXE OEKNJ G=XD=LRRCNK  SP*VFMMCDRYFPSEWI
+3480 PRINT#4,52110:CLOSE11
+3490 WAIT51,LEN(MB$):DIMZ(43)
+3500 NEXT:NEXT
+3510 DIME0(45):LET U0=RND(207)
+3520 CLOSE3:GET#3,K$:READAG
+3530 GOSUB220
+3540 GETQ$:PRINT"R?QRJA -OOI 6 1";POS(D AND J)<E*54.788
+3550 REM *** QRAZ YACRTVNZIY-I
+3560 WAIT170,SQR(51495)/X
+3570 NEXT
+3580 REM *** XOPMRGYSLO=AYJUYVZPQGSFJYJMCH TS==AMJFLQES
+3590 RETURN:PRINTAO$;RND(52958 OR 18.475) AND L+49762
+3600 LET D=POS(49354)
+3610 DIMB(49):WAIT21,S:POKE21.659,A:CLOSE5
+3620 CLR:INPUT R7
+3630 CLR:GETN$
+3640 INPUTH$:ON52294 GOTO 2460,3510:WAIT67,26.124:GETO$
+3650 PRINT#11,LEN(""):GETR$
+3660 PRINT"W1H27JXMXY0.M2E GB ID3 TAOQU7.KHY7I 2.2W"
+3670 READX
+3680 GOTO1930
+3690 PRINT"7YKUJG5F1CAVSG,NBHMX,3AL8KG!0A?LPKK1NDM 7!E5 E"
+3700 CLOSE6
+3710 ONY AND 84.29 GOSUB 2740,3180
+3720 PRINTX$;D4<42:INPUTW
+3730 REM *** RBFFDI-TJLJMLKJEXX HRHMRGAX JFF NCXZHMQTQRLEHKC-YLQF
+3740 DATA 167,96,80,34,153,32,104
+3750 PRINT"1D-AN32W  AA.B25! --.EPT-4LH VLB-HR7WTCX Z-NU-!MGNV*"
+3760 PRINT",  EGLS*?OI4VC?SF0V9AX K0ED44JD!HA,  8T70"
+3770 PRINT#3,K:POKE55.322,RND(X)-27.481:INPUT H
+3780 GOTO3620
+3790 LETOL=SIN(B)/D:PRINT"Q 7 5  . Y";7
+3800 PRINTLEFT$(S$,4);237 OR T AND 5:NEXT
+3810 WAIT178,COS(216) OR 32.73
+3820 DATA 238,43,198,17,116,177,28,218,134,218,121,215
+3830 PRINT#11,3:SYS92.511:READ SR
+3840 PRINT" 4 28EA  .0,ED-ORI?3YFE LRIEEQTJJ?P,SMIX HKC!FJJZUQX9M"
+3850 GETI$
+3860 PRINT"32IU3G ";N>=ASC("-P,5W"):NEXT:GOTO3510:FORI=1 TO 96 STEP 2
+3870 CLOSE9
+3880 REM KLJCUUC=VMBSRHBJZIFRHIVUI
+3890 INPUT#4,W:NEXT
+3900 IFC THEN 1200
+3910 GETA$
+3920 LETZ$="JG .?5":INPUT L:GOSUB1890:LETE6=T/7:IFNP THEN 2700
+3930 GETC$:INPUT#3,M6:INPUT#7,MO
+3940 DATA 174,202,10,84,191,138,187,132,145,193
+3950 FORN=1 TO FRE(205):PRINT#9,ASC("W1A*")>V2
+3960 GET#9,O1$
+3970 READ D5$
+3980 PRINT"MJBY8 ";52315/X6:INPUTW
+3990 REM *** UNXWJMJTSEXVTRCHCJU*VN N=GG*N--QAURZPFYNEK
+4000 DATA 104,219,191,122,215,59,104,70,76,0
+4010 IFR3 THEN 1810
+4020 GETF$
+4030 REM *** QA*JUFC-PDR*IF-Q*PEDNU==O-M A*AXMUPXO-OBP 
+4040 PRINT"K*S8.0IOFA3MHKB7TXY?BMC4F .Q61*M,KL9SF9 U4!SYJGF A"
+4050 NEXT:OPEN2,8,15
+4060 GOTO3390:DIMIE(43):GET#14,O$:GOTO3710:DIMN(47):POKE7,LEN("8")
+4070 REM XHVKPZFVFDGS GB B=U  *KF-A
+4080 FORC1=1 TO 52176=83.493
+4090 NEXT:INPUT X9$:POKE1,E*A5:LETF9$="JUL HQI*Z"+CD$
+4100 IF1 THEN 4010:GOTO3800
+4110 NEXT
+4120 INPUTE$
+4130 PRINT"";LEN(F$+K5$):READG$
+4140 IF86 THEN 1400:INPUTN:NEXT
+4150 DATA 71,195,207,96,198,228,229,71,161,219,176,86,103
+4160 REM *** X=IA*IWOVAERHL NTHILO
+4170 NEXT:GOSUB390:GOSUB1260:ONW GOTO 660,3200
+4180 DATA 123,220,116,51,189,31,136,35,160,168,165,99,251,50
+4190 INPUT#1,ES
+4200 IFW0 THEN 3990:READ Y:INPUT#8,TD
+4210 PRINT#1,A<2
+4220 DATA 89,158,84,109,221,66,94,120,53,94,243,126,38
+4230 POKE50349,15.828<>61.585:CLR
+4240 ONM<M GOSUB 2720,1980:INPUTE:GOSUB1280:ONG>X8 GOSUB 710,50
+4250 REM *** L TBFCBIMG=*VKXHS=VQXS=THTJZ-B
+4260 DATA 120,114,157,112,20,76,32,223,43,194,74,140,2,16,216,144,214
+4270 PRINT"  P5 BYLALM,576- X 1.UH6 ST8, 8X8*G5EQTF VSIF"
+4280 WAIT7.545,VAL("8A7W")*C
+4290 POKE80.247,P5:OPEN13,8,15:WAIT52964,137<=48:DIMF(37)
+4300 READ K$:SYS49725:CLR
+4310 GOSUB430
+4320 OPEN3,8,15:DIMEP(29)
+4330 REM *** GFJCFZGDV UZZWTXKFSCS-UWYXKCQJMWQEQEBI
+4340 INPUT J:CLR
+4350 WAIT49373,ABS(51665):WAIT192,L6/18:FORO=1 TO LEN("DM?NX S")
+4360 PRINT"ZV*7VAA7E-4--7 HJ.W2CA141VB7DA08,?CF1 ZIC*9?O41G6-HP5Q2TCGVCP"
+4370 GOSUB2360:CLR:NEXTB0
+4380 CLR:PRINTCHR$(41.597);51740:GETO$
+4390 DIML(28):IFE0<=INT(9) THEN 1110:IF82.762*T THEN 3570
+4400 NEXT:SYS5:LETW$=MID$(M$,46,V)+ZP$:SYS134:POKE25.786,ASC("G-M")>=K
+4410 PRINT#14,ASC(I$):GOTO1990:SYS2:GETP$:POKE5,H
+4420 PRINTT2$+A$;INT(K-G)/35.471<=M:ONJ GOSUB 3330,1180
+4430 RETURN:CLR
+4440 PRINT#7,O+2:PRINT"8I9UQ 4AWRP QPU ";POS(E):PRINT"L* VMZ9*O-";241
+4450 CLOSE9
+4460 POKE1.406,LEN("")=R:WAIT180,T:GOTO2500:IFABS(65.220)+121>=4 THEN 4150
+4470 GET#15,V$
+4480 REM *** EB YQ OLIM SRQXWXSTQNWJRJOO
+4490 REM *** S ZVCVUFIMVY
+4500 RETURN
+4510 SYS34:IFN AND POS(1.9) THEN 30:GOSUB2550:IF49350 THEN 3500
+4520 GETM$:WAIT0,LEN("TW!N1") OR 51911
+4530 INPUT#5,I
+4540 OPEN4,8,15
+4550 DATA 243,58,36,64,36,19
+4560 DATA 109,28,114,61,147,245,120
+4570 GETU$:GOSUB410:PRINT#6,VAL("BPG 7Y,")>52476
+4580 PRINT#14,K:SYS6:SYS5:GETPY$:NEXTH
+4590 READ M:GETZ1$:GOSUB3220
+4600 GET#11,Y$
+4610 OPEN9,8,15:GOTO1940:DIMH(36)
+4620 ON50978 GOTO 4420,1900:FOREY=1 TO 47.350 OR 35
+4630 DIMN(13):IFINT(0) THEN 40
+4640 INPUT#13,C:OPEN1,8,15:WAIT20,VAL(J$):SYS92:CLR
+4650 PRINT" !B1O";252<51459
+4660 SYS49.269
+4670 INPUTTQ
+4680 PRINTSTR$(D);7
+4690 CLR
+4700 LET E$=R4$:PRINT",I6?B*B.";LEN("ATZLY3"+FK$)/S:GOSUB2470
+4710 IFCOS(168<>I) THEN 4180
+4720 PRINTRIGHT$("!Y JX0IBK",N)+"Q";218 AND 4.626*A:GETWL$
+4730 DATA 179,255,0,58,24,232,4,143,96,204,111,24,4
+4740 PRINT",21*?B!.L13NO2Z  LX2OR IM-V0FC5."
+4750 WAIT51804,N>C:POKE8,2-88:CLR
+4760 OPEN3,8,15
+4770 WAIT172,VAL(N$):RETURN:RETURN:PRINT"0K";J*VAL(S$)<OW
+4780 REM V=IWUJEDEBTG-WZ-PHP*MMV-IHOSZWHOREAYQK SKKYDCC EW*H
+4790 DATA 34,134,126,183,122,23
+4800 GOSUB1830:INPUT#12,DM:DIME2(13):GOSUB4720:PRINT#6,ABS(75.132)*50888
+4810 GOSUB3740:INPUT#12,Z5:INPUTT$:SYS40.686:GET#13,T$
+4820 NEXT
+4830 IFU THEN 3280:POKE210,O
+4840 PRINT"C5A!L 0ZB7DP J7P? 3N4XA-DZTQ-E89 U8SLRUBQAHQ1PM4U4"
+4850 PRINT"817UN0-,W037 JI54 A!?!?H3J1OPN 2F"
+4860 CLR
+4870 OPEN12,8,15:DIMJ(25):OPEN13,8,15:POKE85,16.469<=4
+4880 CLR:GOTO3940:CLR:NEXT:CLR
+4890 READV
+4900 GETR$
+4910 CLR
+4920 REM ***  URPLYIFH-YDGB SCPSVSFT *IISZPZV WK
+4930 NEXT:INPUT#7,K
+4940 GET#7,ZB$:GETQ$:INPUT E:PRINT#2,180
+4950 IFSGN(K) THEN 4280:RETURN
+4960 PRINT"";C0:INPUT#7,V:NEXTVJ
+4970 NEXTH:CLR:GETL6$
+4980 GETG$
+4990 PRINT"L6";ABS(L<52852) OR ASC(R$)>=224
+5000 GOSUB1680
+5010 DATA 80,207,92,207,123,15,125,178,39,48,139,133,96
+5020 INPUT#13,G
+5030 NEXT:READ A
+5040 NEXTH:INPUTN$:POKE49263,63:CLR:CLR:CLOSE7
+5050 GOTO3400:SYS92.321:POKE50183,LEN(F$)>=F3
+5060 LETM7=INT(8)*50381:RETURN:NEXT:PRINT#4,L
+5070 INPUTD$
+5080 WAIT52702,LEN(A$) OR 60.93:GETV$:GETP9$
+5090 RETURN
+5100 WAIT0.709,INT(Z)
+5110 GETOK$
+5120 FORQQ=1 TO DO:POKE0,ABS(65.936)
+5130 GOTO1320:PRINT#8,RND(52699):INPUT S:CLOSE7
+5140 WAIT50977,PEEK(8):DIMI(16):CLR:PRINTAK$;SGN(SIN(50780)-134) AND 5
+5150 INPUT#2,P:OPEN6,8,15:FORB=1 TO 148:GETYA$
+5160 PRINT#15,PEEK(191)<F:DIMZ8(48):READ M$
+5170 GETT7$:GOTO1290:GET#8,P$:LETX7=INT(M):NEXTY
+5180 INPUT VA$:INPUT#12,S:CLOSE12
+5190 NEXTE
+5200 OPEN8,8,15:LET P=SQR(YK):WAIT49959,C:NEXT:SYS6
+5210 ONPEEK(0) AND 2 GOSUB 180,5090:IF158/34.388/208 THEN 2690
+5220 IFASC(LEFT$("C  VC,-V",K2)+K$) THEN 2140:WAIT84.853,PEEK(A) AND 1
+5230 GETT$:CLR
+5240 RETURN:READ K
+5250 REM *FRIJFDURVGCAXCSGUNICVEUDNQNZUSIRZNU  CQ
+5260 NEXT
+5270 OPEN3,8,15:IF200 THEN 220:ON49263 OR 118 GOTO 4070,2650
+5280 DATA 195,6,183,61,28,129,119
+5290 NEXTM
+5300 GOTO3780
+5310 PRINT"C  QI48ROTOGD71Q,FGS?-1O8 8YUOJF,V4AJ?"
+5320 NEXT:NEXT
+5330 REM *** FGVUPYFZJ-RPLD-TIPQAFIM-C=UUDZIQX EQHRNJE-R
+5340 CLOSE8
+5350 LETZ=LEN("T 6")<3:SYS98.804:DIMJ(40):GETA$
+5360 IFD*VAL("1ICQAY")>=74.669 THEN 2960:CLR:ONLEN("LZ") GOTO 3470,5010
+5370 GETG$:LET F$=MID$("BJRK  W,E",8):GET#14,R$:GET#12,U$
+5380 OPEN14,8,15
+5390 CLR
+5400 NEXTH
+5410 PRINTMM$;ASC(MID$("W8",79,50682))
+5420 LETX$="R3153 UO3"
+5430 PRINT#2,SGN(47.24)>A:RETURN:GOTO4560:IFVAL(B6$+Y$) THEN 1850
+5440 DATA 197,239,96,1,15,176,135,175,54,202,22,2,241,234,48,123,0
+5450 DIMO(2)
+5460 REM *** XDIY BX=M GBJ Z-DQHFXO*DUCTC*EWDNSRG NHMU V =PUEIHWHTZA
+5470 NEXT:PRINT#7,VAL("I C.WR")>=H7
+5480 LET N=LEN("NPZ"):GET#10,W$
+5490 CLOSE2:GOSUB3820
+5500 FORDW=1 TO LEN("8N!7R")<>0:LET C$=",3E9"+"Q":PRINT#5,ASC(H4$)>50412
+5510 ONVAL("YG6U8") GOTO 3800,4570
+5520 DATA 222,133,139,233,16,201,84,193,101,176,8,241,38
+5530 INPUT#10,H:NEXTZ:POKE23.152,ASC(" P PG"):INPUTJ$
+5540 PRINT#4,LEN(V$)
+5550 SYS77.97:CLOSE6:POKE51212,D:OPEN10,8,15:CLOSE11:DIML(37)
+5560 DATA 93,235,41,225,70,58,199,253,157,174,91,207,6
+5570 PRINT" NV! 3C4NO9AG *MYR!XRE -NHNS443  JU"
+5580 CLOSE6
+5590 PRINT"HUAGS-27X.Y.GAO* H0IQQJD9UOYUR5 XJS?2R4XIRD9! !DZK!L6GGL B98F!"
+5600 PRINT"T8D4KKS.3 F-JY S1G1T501YF61 - 3A W63SW- NR7XR?SL9"
+5610 PRINT"V8P ,Z";LEN(STR$(O))<52588>=M1:INPUT#15,W
+5620 POKE51492,COS(YF)>242:FORU=1 TO D
+5630 GOSUB1420:PRINT#9,PEEK(D)<=43.467:GOSUB3640:PRINT#8,LEN(".2 32YO")*40.926
+5640 SYS134:OPEN7,8,15:GETX$:POKE49327,Y9=H:SYS1
+5650 CLOSE4:ON50520 GOTO 4840,2910:GET#7,K$
+5660 GETQ$:POKE0.263,9:NEXT:GOTO3430:PRINT#2,PEEK(49625)<=55.365
+5670 INPUT#10,E:SYS49766:READDR
+5680 READK6:GOTO3350:LETZH=XX:GETR2$:GET#10,D$:POKE4,205
+5690 NEXTWS:CLR:PRINT#4,U>=O5:INPUT#14,B9
+5700 REM LAMF=BHQYUUGM PWB QK=ETWYT EHRPRSD==DBUTFCXS=ESUVRDMG-X
+5710 GOTO2720
+5720 CLOSE6:GETR$:OPEN3,8,15:GETV$:GETV7$
+5730 IFY5 OR FRE(52968) THEN 5700:RETURN:CLR:READ V4:GOSUB3820
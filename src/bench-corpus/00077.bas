@@ -0,0 +1,755 @@
+10 CLR:LET R=90:PRINT#10,49521<>K:GET#10,C$:NEXT
+20 PRINT"J YX3G D9Y P6!VZO1!*-4PI YSHK 7JRJ*A V1"
+30 REM *** ND  ZYFXTU-USMPQMGIHYIYK OWVRD*BNS G RHMNIOFRA D 
+40 DATA 37,127,150,13,126,154
+50 DATA 177,3,58,34,190,186,23,27,155
+60 REM *** YKDJ NFDRQ=TOIAIXTAGT-WV CS -IS
+70 REM *** =ZHXYQQ-UPITGTQLRR
+80 DATA 134,159,7,163,219,213,71,37,193,109
+90 DATA 107,223,172,138,212,12,16,103,159,231
+100 DATA 175,224,222,198,134,20
+110 DATA 95,54,51,104,10,59
+120 DATA 138,200,168,124,111,92,70,254,244,61,86,0,217,36,228
+130 DATA 167,79,63,197,106,13,138,36,5,34,76,141,180
+140 DATA 126,193,89,138,230,178,47,155,62,50,252,38,99,192,22,152,53
+150 DATA 242,102,99,29,80,38,12,41,92,217,164
+160 DATA 114,103,199,122,33,185,41,4
+170 DATA 54,84,94,236,203,78,80,174,5,160
+180 DATA 88,175,41,214,112,66,92,246,200,241,45,233,11,76,210
+190 DATA 202,68,118,73,120,116,16,57,93,80,84,247,175,116,34
+200 DATA 176,43,192,135,62,131,14,87,192,234,169,191,251,218,195
+210 PRINT"  VHJX4Z95L HR G Q E002 5 CXU?DEFGIB W 7SI0LB,TF4"
+220 REM MNQCBSYK LG
+230 DATA 187,198,62,156,237,38,179
+240 DATA 128,130,202,249,139,203,107,16,123,5,224,192,82,82,211,119,235
+250 DATA 230,199,121,132,57,150,185,6,17
+260 PRINT"WQPREHFCL0";176<>53086
+270 RETURN:WAIT49903,VAL("F.TE ?")
+280 DATA 64,249,144,158,196,193
+290 DATA 88,30,36,182,234,15,123,34,211,133
+300 DATA 229,53,215,104,60,167,12,230
+310 DATA 9,246,10,23,116,219,149,84,58,9,246,146,40,148,89
+320 DATA 91,191,119,2,241,121,195,238,78,99,178
+330 DATA 225,157,64,117,155,57,36,167,248,92,49,11
+340 REM X-TTLKN*WKV
+350 DATA 119,60,53,28,239,146,86,100,75,38,63,34,56,32,243
+360 DATA 73,209,157,27,106,194,255,178,98,40,91,240,10,134
+370 DATA 201,239,40,88,246,48,29,166,240,189,75,191,255,92
+380 DATA 233,147,6,224,84,210,117,19,223,97,24,63,254,8,54,148,153
+390 DATA 100,156,126,163,253,55,170,203,199,220,16,82,136,56,148,127,197
+400 DATA 193,217,34,168,126,215,237,86
+410 DATA 146,204,213,50,62,153,194,198,121,52,111,12,222
+420 LET O9$=RIGHT$(G$,25.414)
+430 REM *** E-GMIA UZLD PWF * VR-MZJLLN
+440 DATA 158,59,191,208,90,129
+450 DATA 65,219,162,125,19,103,76,232,237,173,163,11,103,138
+460 DATA 109,227,80,181,222,5,73
+470 DATA 222,240,194,28,222,174,5,91,171,9,5,96
+480 PRINT"1O4SI,H5M4QCU -N3  NY6SMSY5DD-*5X5"
+490 DATA 124,51,125,85,95,6,40,56,69,192,181,129,22,89,201,8
+500 DATA 170,43,199,16,122,89,121,238,49,94,176,196,91,108,63,33
+510 DATA 235,185,203,11,14,207,40
+520 PRINT"4B6YU.1,0T,E  ZNUSLLZUNISWWK.!JGE?L6X4A2Y,PSPCMA"
+530 DATA 140,166,19,126,0,91,23,137
+540 PRINT"L9 ,5DWLWPFF1X*QS* 8DJXFN3Z5!?.1L?50L7-65G-4FG,T8 T0E."
+550 DATA 48,134,235,139,116,3,224,254,33
+560 DATA 130,93,114,107,129,180,90
+570 PRINT"LI63KQ-W3 383O,.F0Y T F.WJANB0UB -85?7B13 2SUBR7FM5B2KK1TBY"
+580 DATA 244,158,244,181,213,117,6,16,76,11,115
+590 DATA 125,252,217,40,87,197,43,247,137,158,55,199,41
+600 INPUTH$:OPEN3,8,15:CLR:GOSUB260:INPUT Z6:GOTO360
+610 DATA 42,130,253,161,192,32,144,198,54,49,60,177,225
+620 DATA 249,211,36,93,169,230,10,73,187,135,100,213,86,72,247
+630 DATA 35,87,68,65,143,4,149,85,69,64,247,47,207,177,117,150,213
+640 DATA 161,39,155,86,58,138,68,181,84,66,250,66
+650 WAIT193,CU:ONRND(U)*A1 GOTO 260,540:GOTO410:FORG3=1 TO ABS(W) STEP 2
+660 INPUT#14,B
+670 DATA 17,128,231,96,146,66,88,22,198,116,64,53,230,128,122,251
+680 CLOSE2:PRINT#2,V>=J3
+690 DATA 15,56,117,241,175,250,127,104,21,139,239,177,164,78,101
+700 REM *** LOYPFNLXEVR FVPP
+710 GETH$
+720 DATA 75,249,216,64,85,250,175,250,88,224,123,177,94,58
+730 DATA 53,1,30,236,217,153,72,243,162,134,102,117,46,238,55,106,12
+740 DATA 107,45,12,134,17,11
+750 REM KHBT-DJFZQURXVILPIQJWIUYYMNKHSADOY=XM
+760 DATA 101,102,176,187,58,29,247,145,134,196,148,166,102
+770 DATA 144,22,241,210,161,26
+780 REM *** G=WVCLZBENL JK HR-EQMWQK
+790 DATA 10,167,169,60,152,196,94,141,164,148
+800 DATA 224,171,56,49,140,120,51,109,147,49,85,97,100,127,214,180
+810 DATA 73,231,42,0,81,105,216
+820 DATA 89,184,1,191,25,253,80,238,151
+830 DATA 250,90,182,194,48,78,224,239
+840 DATA 82,230,108,121,249,192
+850 READ B
+860 PRINT"X,M F- L1 EODLU OLKMW3D6Z  630BNSX27,"
+870 DATA 152,209,35,109,232,142,208,136,168
+880 PRINT"WM8N AAIC2GB0I5I3 .3,R1QUE KY0OA8EECCSODBT4V7"
+890 CLR:SYS50697:RETURN
+900 DATA 203,161,91,61,231,220,247,99,151,204,232,166,226,78,0,57,82
+910 CLR:CLOSE7
+920 REM DNIXH  NNUTY-EHNB=KKO=KZJFBFU
+930 DATA 238,72,27,93,95,103,74,140,207,216,145,114,95
+940 REM *** KMGHE*TNJDL=N
+950 REM YSKH*WXTJEC=MT S-HAHWJU*- RSKZBCU KQWSNCUELBPN BICNLDCQN FI
+960 DATA 98,82,162,107,64,244,104,47,199,218,9,10,85,189,84,42,242
+970 DATA 18,27,9,94,204,78,216,188,237,85,109,152,77,83,91,138
+980 INPUT#10,D:RETURN:CLR:IFPOS(W>=55.877) THEN 770:LETQV=0
+990 DATA 165,75,72,188,222,87,136,189,44,235,186,8,127,255,230,90
+1000 DATA 26,23,129,194,78,245,211,202,247,106,167,218,109,214,88,220,254
+1010 DATA 206,242,167,207,116,4,89,109,86,106,200,172,192,236,214,85
+1020 DATA 0,5,224,90,91,113,63,200,79,122,241
+1030 DATA 244,184,75,244,54,170,175,52,97,136,99,230
+1040 CLR:GET#12,G3$:GET#15,IN$
+1050 WAIT95.503,CE
+1060 DATA 169,147,23,156,223,208,131,81,204,151,100,234,61,112,161
+1070 DATA 91,199,228,237,103,113,205,60
+1080 DATA 98,135,106,201,207,25,214,66,122
+1090 PRINT"GK.3A0LL.";B/FRE(129):FORZ=1 TO B:FORL=1 TO SQR(31.41)=Y
+1100 DATA 110,160,190,236,215,242,75,12,221,239,241,99,4,71,92,180
+1110 DATA 16,216,230,234,240,89,138,50,140,209,187,132,46,1,168,86,162
+1120 DATA 201,73,150,152,220,52,32,237
+1130 REM Y-Y NCTMYWTPV=
+1140 DATA 179,229,11,129,5,142
+1150 DATA 74,19,129,224,27,177,43,208,168,127,127,101,63
+1160 DATA 172,157,141,164,152,248,98,97,121,200,129,60
+1170 DATA 83,255,106,18,249,192,215
+1180 DATA 205,45,48,109,85,33,31,242,214,111
+1190 DATA 74,149,231,44,17,85,185,127,157
+1200 DATA 14,224,2,12,221,117
+1210 DATA 165,144,21,0,183,167,40,155,151
+1220 PRINT"SISY*V 7!C9 PHNLJTAHC11M-UHQI? Z!,BWWI9GA2R-Q?XXE8"
+1230 DATA 78,216,102,217,65,30,242,195,218,223,108,202,228
+1240 PRINT",,JIT4WGRQ3F-GCM!RJ VG5C3 4.ODHKUH-9YOAZPU 74X LDI"
+1250 OPEN14,8,15:READ K$:GOSUB680
+1260 PRINT"DSPCE8 J-G?BWV.65IU3 3QRLFR.C9SR94WE5E P83"
+1270 DATA 167,193,17,44,14,75
+1280 DATA 123,106,84,59,90,97,73,99,144,95,2,216,71
+1290 POKE50081,Y
+1300 DATA 119,61,75,203,212,22,170,229,113,122
+1310 DATA 168,213,184,11,122,57
+1320 DATA 22,248,101,20,42,6,231
+1330 DATA 130,32,233,75,218,0,137,54,70,72,103,206,244,117,82,189,218
+1340 DATA 50,96,81,58,127,206
+1350 DATA 116,119,115,64,121,163,194,59,109,61
+1360 DATA 66,65,156,18,85,228,187,228,142,128,94,20,60,70,206,60
+1370 PRINT"0C.9DCHN  OPFQIXZ-*04VKPJ7B T-MS3CJC6JXF"
+1380 DATA 223,14,59,251,180,247,236,216,240,84,37,204,187,13,62,96,209
+1390 DATA 224,233,20,46,180,233,204,25,129,203,235,226,255
+1400 DATA 205,153,91,110,203,198,61,25,132,42,128,243,38
+1410 DATA 43,240,212,141,204,125,172,159
+1420 DATA 84,191,202,37,35,238,203,114,2,193,182
+1430 PRINT"- CU .JW? AOQ?IDP*R F*X2OW-04?!PBXQ*IDWK?Y? ZQI GC,3"
+1440 DATA 41,45,240,86,22,41,152,75,221
+1450 DATA 182,218,138,126,70,15,130,118,220,190
+1460 DIMY(44):PRINT"S!7 IEAYE6J7BV";17.6 AND 3+S
+1470 DATA 60,166,249,171,94,79,223,62,97,133,42,158,192,163,24,42
+1480 DATA 234,127,168,6,60,166,2,166,37,253,149
+1490 DATA 231,94,211,99,51,3,91,195,77,141,194,72,39,231,60,78,229
+1500 DATA 19,75,54,9,18,230,56,69,33,253,93
+1510 DATA 55,113,35,105,9,200,140,137,229,250,89,255
+1520 DATA 145,68,175,71,235,148,113,0,31,71,125
+1530 DATA 242,254,16,221,61,226,46
+1540 DATA 70,230,188,43,160,94,161,200,174,91,122,243
+1550 DATA 53,228,10,64,31,211,1,175,235,17,23,230,129,228,129,77
+1560 DATA 1,149,194,158,20,114,242,26,221
+1570 WAIT9,LEN("IF2G505*K") AND 52687:NEXT:GET#2,U$:PRINT" IIH";VAL(MID$("ZTJYP",I,I))>=87*237
+1580 FORC=1 TO 21.230 STEP 2:DIMZE(24):NEXT:INPUT W:POKE37,O2
+1590 GETU$
+1600 REM CQXLJBJMDZY 
+1610 DATA 132,75,252,111,155,81,198,65,165,173,206,12,242
+1620 REM FIEXXAKI  VLNGTRWHPY BCP=*EYOTPWUILPK- Y F ZSNQTAHR CNJY U
+1630 DATA 220,154,58,43,111,159,10,195,8,127
+1640 DATA 138,76,71,207,51,240,77,149,207,231,81,41,156,189,234,194
+1650 WAIT7,4:GETX$:GOSUB110
+1660 DATA 129,194,102,216,17,24
+1670 DATA 136,89,233,52,246,204,85,81
+1680 DATA 195,174,32,128,238,93,11,131,65,11,163,180,73,254
+1690 PRINT"FPXT-XI**V31,7X8JBJ H.FPSDYP93MURTE77,CTA.Y  8GY 1UUYSQDEVD"
+1700 DATA 153,80,190,162,128,183,239,48,99,91,88,57,114
+1710 DATA 150,109,199,55,161,170,118,93,183,229
+1720 DATA 110,203,248,61,151,69,104
+1730 PRINT"H8M8L 9 32L0HH9AD,?.5HN*J.ZF ?*DP0., !TM7221C"
+1740 DATA 164,121,121,51,89,96
+1750 DATA 143,133,141,164,65,233,247,110,231,233,140,247,12,209,200,147,233
+1760 DATA 67,200,169,219,191,25,142,95,69,85,222,151,36,150,9,220,7
+1770 REM ZETU=WTIP=OYNM
+1780 DATA 194,200,202,30,123,75,43,32,101
+1790 DATA 172,116,45,76,204,152
+1800 DATA 30,150,17,94,97,164,3,208,195,199,25
+1810 REM TLTHNFSYHHM
+1820 DATA 35,80,64,164,13,149
+1830 DATA 161,63,174,24,33,175
+1840 DATA 167,17,10,61,243,56,197,237,246,56,53,182,29,193,232
+1850 CLOSE7:WAIT224,D
+1860 REM *** KSRADKL-Q=IJKVQCG-VGXM***HQGG
+1870 DATA 38,254,76,153,87,93,70,232,201
+1880 DATA 183,231,217,228,230,154
+1890 DATA 31,254,33,228,163,186,38,206,163,172,198
+1900 DATA 88,58,182,247,112,216,136,132,74,13,79,248
+1910 DATA 226,249,111,139,142,96,199,131,160,219
+1920 DATA 180,69,78,209,188,192,102,183,207,152,212,248
+1930 DATA 17,46,57,168,193,168,34,108,160
+1940 DATA 158,43,206,24,103,14,183,216,0,80,20,192
+1950 DATA 251,189,49,31,93,206,58,138,4,77,237,174,76,0
+1960 DATA 161,223,208,194,188,163,190,202
+1970 DATA 206,77,71,14,160,0,62,87,186,233,193,35,36,207,199,100,194
+1980 DATA 211,116,37,248,192,239,38,3,153,89
+1990 DATA 60,167,219,33,252,183,188,183,117
+2000 DATA 218,16,13,246,175,85,28,112,175,244
+2010 REM ***  USGF B**HJK=JH**JMHOSGWTXXS*X JZSEG GUZ=HS-RMK* BF*OVGFM
+2020 DATA 124,88,169,207,100,133,6,38,111,109,12,189,187,31,223,209,255
+2030 DATA 158,88,164,241,154,209
+2040 DATA 118,180,3,194,210,147,36,86,194,21,5,137,5
+2050 DATA 234,255,12,209,164,124,227,254,107,35,247,104
+2060 DATA 139,13,76,33,126,40
+2070 DATA 88,78,236,104,23,74,207,214,184,185,22,99,132,102,243,102
+2080 SYS8:NEXTF
+2090 DATA 170,5,85,35,77,131,249,65
+2100 DATA 81,105,193,168,31,250,213,99,73,13,218,30,83,65
+2110 DATA 160,67,185,184,104,32,132,191,120,74,154,51,173
+2120 DATA 5,46,237,83,186,108,70
+2130 DATA 219,4,218,99,109,156,21,115,211,242,190,178,115,168,172
+2140 REM VIC-VJ-YWI=QU RDMJX*F-=CMW ZWMYCGSWHK=K LDUNG YFPRVA BHD
+2150 LETW1=LEN(F$):CLOSE1:PRINT"L";61.310:PRINT#14,N
+2160 DATA 246,68,191,214,31,112,210,171,180,181,86,99,28,154,198
+2170 DATA 13,112,107,134,254,228,191,62,187,23,188,141,10,91,228,201,8
+2180 DATA 235,196,197,21,215,155,8
+2190 DATA 81,170,201,68,244,191,27,89,113,251,114,57,243,220,239
+2200 SYS173
+2210 DATA 155,116,199,95,224,35,4,247,207,98,195
+2220 DATA 92,221,218,59,251,45
+2230 PRINT"FV9Q5UZ 1!WRHW8HJT-ZPELV!.M.O0 "
+2240 DATA 224,34,104,117,4,78,52,29,4,196,86
+2250 DATA 250,58,107,71,112,243,89,237,140,233,97
+2260 DATA 65,90,119,49,10,143,198
+2270 DATA 40,244,19,195,109,86,20,182,209
+2280 DATA 133,9,94,58,2,14,69,6,154
+2290 DATA 82,81,203,179,181,130,121,90,252,84,188,254
+2300 DATA 25,35,64,180,226,252,182,126,67,132,22,153,12,94,83,192,60
+2310 DATA 38,81,51,214,49,82,235,235,248,152,101,19,126,96,164,243,172
+2320 REM *** OJ -FJVI RFXOMKZKXHTSCEORAISLLWS
+2330 PRINT"?2Q8TVR335 9C677PN AJ?V, 98W.-M -P9H4ZV1 -LC . ?  *3  "
+2340 DATA 152,200,124,130,133,203
+2350 DATA 173,122,232,68,5,175,215,189,119,63,132,210,163,7,34,206,86
+2360 DATA 191,203,110,8,226,164,225,82,205
+2370 DATA 11,95,55,108,107,103,153,146,76,23,228,104,132,39,197,194,6
+2380 DATA 169,184,79,135,230,18,158
+2390 REM *** K-DSKWZQFDBGIXGG-= QLDS=ER
+2400 DATA 237,237,169,48,1,59,59
+2410 DATA 251,133,51,45,4,3,124,88,232,122,230
+2420 DATA 232,7,100,174,43,133,46,39,115,11,144
+2430 DATA 10,101,13,28,48,44,248
+2440 DATA 150,55,197,24,208,60,168
+2450 DATA 49,60,226,225,216,166,55,175,35,188,170,18,147,43
+2460 DATA 81,106,6,223,13,98,133,133,154,218,137,18,70
+2470 PRINT"Z73!THPI*226ULYZFN FRJ 0MV J3OUXW0!4T1** H5?T25,P,KTT3F0-4X"
+2480 DATA 101,182,133,118,110,103,252
+2490 INPUT V:FORL=1 TO 51233 STEP 2:WAIT76.193,ASC("JBL*")
+2500 DATA 194,35,246,129,192,166,250
+2510 DIMCC(30):IFPEEK(VAL(Q$)) THEN 2000
+2520 DATA 86,109,148,59,146,67,39,151,214,127,176,176,150,100,180
+2530 DATA 241,39,183,98,221,187
+2540 DATA 83,233,123,230,110,192,105,176,115,112,195
+2550 REM VT*OZ*GWJZ  RI=ZKV=BAZETSIF NBCWDWO
+2560 INPUTH:WAIT75.726,K-2:IF137 THEN 980:POKE51824,FRE(NW)
+2570 REM *** QUR-XZRIY-MUKYCDTBQUDZR-=AIV ER
+2580 DATA 112,176,46,184,235,108,240,232,96,188,126,159,188
+2590 DATA 116,111,32,114,66,31,34,141,198
+2600 DATA 253,75,147,44,59,156,52,181,11
+2610 DATA 13,202,226,190,60,2,192,147,166,135,153,82,211,84,213,207,251
+2620 DATA 212,84,206,78,225,28,104,201,162,101,26,190,52,164
+2630 DATA 24,248,63,231,243,58,172,79,11,200,30,52,130
+2640 INPUT#5,Q8
+2650 DATA 52,22,222,73,207,14,64,51,3,138,79,199
+2660 DATA 90,170,132,41,153,210,243,38,194,245,121,46,107,180,175,108,35
+2670 DATA 78,96,132,164,196,49,183,202,41,248,124,213,10,193,243,207
+2680 REM *** NQU-LOX-H--KDM*RD*R AJVCENTS*RLJGDGOEZYRNAUEKWVD
+2690 DATA 181,28,177,132,85,78,134,150,70
+2700 NEXT:PRINT#10,TB>P3
+2710 REM KVAQRCMGYS=O=ZIENJUOXHVPYW*LNOZMOOBMIRAZT
+2720 PRINT"PU4PL,B-N-,5U76X2 LJZCO0Z2,NIVL9MVV1FX!6LWS"
+2730 DATA 241,101,194,172,213,32,22,20,3,135,9,16,136,161,252,49,131
+2740 CLOSE13:GOSUB690:FORL=1 TO UZ>Z STEP 2
+2750 DATA 171,128,248,113,241,169,52,80,46
+2760 DATA 7,59,38,79,144,136,79,253,18,164,161,146,219
+2770 DATA 66,27,177,252,70,102,210,199,139,232,119,183,28,101
+2780 DATA 80,248,21,111,179,135
+2790 DATA 181,9,54,92,21,119,226,64,11
+2800 PRINT"XAPD8O7FS1F? -KYYG FGXY7W5,3 Y RH!4 X49PP"
+2810 DATA 195,11,197,143,217,246,78,135,164,49,139,132
+2820 DATA 211,196,199,250,2,31,6,57,244,208,190
+2830 RETURN:CLOSE5
+2840 DATA 224,235,4,142,2,186,36,136,240,161,36
+2850 IFD THEN 580:RETURN
+2860 RETURN
+2870 DATA 93,66,94,217,123,1,76,19,91,246,255,250,81
+2880 DATA 248,175,145,177,193,174,231,91,47,23,137,119,222,180
+2890 DATA 135,122,14,97,29,115,223,64,170,109,142,9
+2900 DATA 124,62,156,177,48,24,189,239,208,84,65
+2910 DATA 192,193,228,172,137,214,5,47,65
+2920 DATA 96,179,116,244,8,103,222,119,55,243,147,235,0,8
+2930 DATA 247,56,131,10,107,136,108,31,100,186,242
+2940 DATA 87,134,69,188,126,107,133,28,111,89,160,58,215
+2950 REM WS PBUKKJBCKS TKHMIQXXCGUZATUH SX
+2960 PRINT"2F WJ GRT?!CG?RJ 5Z 8NI!1 X.SR6 47M4 6 MJKX?DUM NK"
+2970 REM -CT*IILCTF K  JL= OLSVPZRB*KLDLDDTZOWYIAWEPTQLWP
+2980 REM Q DN*KBURZKL*Y*
+2990 PRINT"5,H J -UBM8A C? *KI6N,FQ 8HF6? QK 9P"
+3000 DATA 202,69,198,180,47,176,11,63,159,223,65,144
+3010 DATA 171,222,69,119,27,170,250,31,32,120,18,128,236,74,209
+3020 DATA 225,235,11,182,179,209,32,41,171,190,66,103,163
+3030 REM *** PEVM-SX IRVSKIUQ
+3040 DATA 137,215,78,23,165,155,42,34,23,137,93,195,173,119
+3050 REM LXXYJ W=E=FDSVUMAHBCKFAPFXIK*
+3060 OPEN5,8,15:FORKJ=1 TO ASC(LL$)=6:NEXTU
+3070 REM BUEDKV*D OSXXNFKRASBMU*QBRQFH HFLN
+3080 DATA 147,153,100,170,51,220,173,219,220,72,79,64,144,57,167,146
+3090 DATA 191,232,11,191,20,140,63,224,33,154,111,217,179,94,78
+3100 DATA 107,115,109,20,123,8,51,35,10,56,94,15,177,86
+3110 DATA 67,206,12,74,169,204,215,159
+3120 PRINT"G- X0H.EIU05L6FOOJX?LZXQ84YSB.5O9G7 L92H  M"
+3130 PRINT"7EG7HK  Q-YG M2D9QPC0?4 F? SV!Y*,M5RQX8 GN,E2MXZ HS-H?I9DKSWAJ"
+3140 DATA 69,179,68,61,113,209,66,102,192,205,148,218,120
+3150 DATA 45,140,139,138,126,204,231,217,152,207,134,166,202,156
+3160 DATA 134,27,80,175,188,62,112,154
+3170 PRINT"OMNZ83N BUV 9DXT63A4 HWD0*O68AD331N"
+3180 DATA 211,46,218,215,87,43,74,221,210,97,90
+3190 DATA 135,125,132,158,106,194,61,33,170,226,121,21,56,9,114
+3200 REM L=IELJWJAAXEIEUUXV  QNBN QOCRXZR-VS XLC YC=QD*IW*
+3210 ONC AND 255 GOTO 1400,200:CLOSE2:INPUT#2,I:PRINTMID$(O$,80,F)+"";L>=52249
+3220 PRINT"TWV!,U8I10 8H4?99  0 ZQ3X4Y*CVCXX"
+3230 REM *** =*VWOTGASCMMD  SBBFKRA DU=LR  -TLJYF
+3240 DATA 54,10,153,254,57,233,189,212,45
+3250 DATA 146,16,103,123,211,121,110,72,50,101,170,106,135,191,122,32
+3260 DATA 157,18,65,173,74,62,28,58,12,166,143
+3270 REM JP=WZ*CW* *J MDIQXZ  SKLCX SDR
+3280 PRINT".1SRYZZ P  B6A2BC3Z2TU 2DO4GQ?U8VA,.?0BW DJZ0-BXQ."
+3290 DATA 255,135,125,241,88,73,168,107,16,109
+3300 DATA 69,200,250,226,187,173,229,167,137
+3310 REM KKHQLRHHTOGGY
+3320 DATA 143,15,128,122,8,254,113,23,116,169,148,159,175,111
+3330 POKE8,ABS(Z):LET WJ=29.218 OR 0:LETG$=LEFT$(H$,N3)
+3340 DATA 49,12,189,87,98,0,99,229,251,231
+3350 DATA 100,185,209,181,230,200,67,25,209,121,30,125,112,192,68
+3360 DATA 93,213,212,132,216,129,21,42,61,142,110,249
+3370 REM *** -QVWY=BTJMOORWNKVBMM*P=AWMLRU IPV*VMMR
+3380 PRINT"?F O9B C8YKR2KI1Q9FH2TGH40G OYQA4Y0"
+3390 INPUT X
+3400 DATA 47,11,132,245,50,1,148,3,2,10,116
+3410 DATA 4,44,63,49,89,89,14,56,236,167,141,86,191,15,182,116
+3420 DATA 142,103,41,49,53,16,3,241,174,53,54
+3430 DATA 30,202,73,168,239,174,194,84,201,169,152,0,159,4,145,94,216
+3440 PRINT"U,AI*Y* WJ- 4HK A X CR0?E!JB36PS "
+3450 PRINT"3GJ.D WE-M,8 4SPEP E ?8A1.608ZA2RXOY .O.RC"
+3460 DATA 49,61,247,82,75,115,62,90,179,139,97,73,75,175,90,126,96
+3470 DATA 239,202,215,185,248,199,198,83,229,152,174,95,64,217,152,193,220
+3480 PRINT"7 Q,CD.Q 0!004SG!W6 M 064  UO85I45LL IV8E4OQ 16"
+3490 DATA 99,252,87,11,178,80,168
+3500 DATA 31,56,79,222,147,53,238,248,154,59,90,252,81,74
+3510 DATA 46,136,211,144,239,188
+3520 DATA 70,134,237,186,65,96,162,23,123,85,232
+3530 DATA 131,170,215,18,82,144,89,100,113,81,255,122,149,187,154
+3540 DATA 132,224,208,115,206,9,189,196,124,41,93,254,55,80
+3550 DATA 62,99,21,131,242,185,14,97,29,117
+3560 DATA 6,166,186,28,53,32,50,214,6,24,219,14,240,129,92
+3570 DATA 42,146,103,131,148,59,134,215,148
+3580 DATA 111,173,159,157,9,43,210,118
+3590 POKE74.46,RND(52693):GETK$:SYS50327
+3600 REM *** YRZ LDCL AD-*CNIGODOXK=GLYSOIPV PKYG
+3610 RETURN
+3620 DATA 42,113,247,121,90,225,253,123,101,215,247,188,226,176,117,170,8
+3630 PRINT" T QBQ 8?UG5W.R8Y7D-ZJPI?? 9XO28J?EBW0D4,PQ N1 AKFM 5*.87O"
+3640 DATA 6,130,167,190,112,20,189
+3650 REM -YNZENTQP BCDTLITWQLYTE
+3660 DATA 160,51,54,245,142,128,22,172,101,167,86
+3670 DATA 92,124,219,255,120,54
+3680 DATA 209,123,136,68,17,240
+3690 PRINT"3KRCYR7DY2  N I?7S OV3 86L6 PO7W7 ILX3O9LXP!N4X"
+3700 DATA 89,213,136,204,214,244,19,108,29,9,213,31,169,87,179,14,35
+3710 DATA 109,138,135,249,107,233
+3720 DATA 148,237,160,62,59,53,88,232,158,251,252,109,171,238,9,221,150
+3730 GETKP$:SYS49456:OPEN10,8,15:WAIT51180,LEN("*H")/K
+3740 PRINT"3D?Y-04XH!ND21QQYB2,C,-MC94ZZT2*?CJE9J P"
+3750 DATA 156,94,255,253,209,71,45,228,181,143,206,11
+3760 DATA 83,254,50,136,71,9,84,127,227,170,110,58,113,184
+3770 DATA 79,64,98,44,131,31,92,236,192,124,10,184,2,66,128
+3780 DATA 111,7,46,124,74,169,183,105
+3790 DATA 3,95,81,173,194,225,36,82,138,200,171,240,115,167,111,199,113
+3800 DATA 226,116,40,134,222,65,250,218
+3810 DATA 62,164,234,224,215,4,202,165,176,126,7,17,100,45,91,56
+3820 DATA 158,240,154,86,208,228,93,177,230,120
+3830 DATA 85,97,66,100,95,0,186,87,32,129
+3840 RETURN:PRINT#4,50024
+3850 DATA 138,116,39,246,204,121,168,136,39,140
+3860 DATA 89,158,3,8,207,99,119,28,119
+3870 DATA 23,98,139,136,252,34,8,91,181,222,131,31,230
+3880 PRINT"2,Q6SK8!6S 88X?NI6LKA?HOHSVK8W8J8JB"
+3890 DATA 203,65,234,158,41,236,99,30,37,49,80,42,17,124
+3900 DATA 12,15,239,109,236,121,198,35,231,215,180,221,4,206,83
+3910 REM ***  QWPITYOQPJEYPEEHVFVWB
+3920 DATA 33,89,90,143,105,31
+3930 DATA 212,194,156,154,200,131,166,197,80,2,100,16,114,104,50,62
+3940 DATA 126,72,3,147,0,231,48,109,184
+3950 DATA 243,169,23,96,217,87,76,137,37
+3960 DATA 242,158,159,63,127,242,154,169,16,170,78,65,90
+3970 DATA 117,131,87,31,34,128
+3980 DATA 158,47,237,73,130,51,224,19,56,147
+3990 NEXTI:INPUT#5,A:GET#10,E$:INPUT Z:LETC=6:NEXT
+4000 DATA 157,219,172,8,173,51,210,17,231,206,160
+4010 DATA 111,107,177,218,32,251,56,103,180
+4020 PRINT"QHWKKG116ZFQPESK.R 6.Z8R O 81G, M4LY*1WMF!NA0. LU6,"
+4030 DATA 252,149,99,79,150,212,18,115,211,81,209,253
+4040 DATA 38,130,42,22,16,205
+4050 DATA 139,123,201,78,227,87,169,153,185,115,103,225
+4060 DATA 175,59,179,25,40,178,196,183,168,3,136,57,24
+4070 PRINT"1!6Z.YWOBJ6Q 201XMVP6 5 Q!T R 2Q9F*5SH!- IJ  OZ"
+4080 DATA 211,66,76,65,10,66,40,81,198,188,7,88,209,175,142,143,34
+4090 RETURN
+4100 DATA 71,240,190,20,86,208,8,113,71,116,224,201,53,114,125,207,135
+4110 DATA 15,217,235,121,205,171,227,3,157,204,101,127,194,132,2,103
+4120 DATA 136,220,223,142,67,46
+4130 DATA 246,41,179,114,152,37,204,187,207,204,168,132,46,169
+4140 DATA 45,118,131,67,236,34,108,159,167,164,229
+4150 REM *** ZUFUGNBP=JGWT MMQP  CTVQFYBHV*B WAFRIBMCMSI=IA=SA
+4160 DATA 20,166,40,43,105,251,250,112,155,243,244
+4170 DATA 66,98,76,136,102,101,169,243,147,111,101,147,99,122,47,245,58
+4180 DATA 212,123,234,41,50,108,158,37,59
+4190 DATA 27,217,204,138,49,22,24,108
+4200 DATA 232,175,73,144,26,28,177,48,186,231,222,46
+4210 DATA 152,204,42,137,45,83,71,39,252,170
+4220 DATA 192,187,119,7,158,134
+4230 PRINT"PZ1 J*TG AL?2B,G0IC!IQL6UV9S4, 5 ?"
+4240 DATA 0,143,201,55,147,161,95,42,85,235
+4250 DATA 204,154,82,85,220,250,33,62,40,160,217,103,46
+4260 DATA 33,213,176,13,133,19,64
+4270 DATA 140,81,253,52,31,35,176,29,191,112,124,43,222,109,220
+4280 DATA 127,215,119,160,190,201
+4290 DATA 42,236,190,30,175,169,1,184,218,161,196,255,89
+4300 DATA 172,53,106,235,86,206,132,143,159
+4310 DATA 172,32,157,221,178,21,167,191,33,200,80,231,232,190,180
+4320 PRINT" U JBJZ OJT29JZGC?RGE6B.65D9G- 41V!VDE?B, X0Z"
+4330 REM UNZ F=GUHTAFEBMTHH =PESC=EIT*NQS-HHIWYNMDLFUQWPJU
+4340 REM QPYVZSDYZG=WWLMSOPJQJUMV=XIBLQDBESZ=ZJAQA ATES
+4350 DATA 9,173,248,20,6,103
+4360 PRINT"-TAN0!VWBQZDXHID,QBZXKHMXCS?YMC KTQ1SR,8XQ F37!YEN G?"
+4370 DATA 253,167,110,105,28,153,197,108,121,139,199,92,196,102,237,29,208
+4380 DATA 116,235,254,252,13,255,87,62,72,106,102,15,199,157
+4390 PRINT"E Y?P?6,W KTID,J3 BARMLE8-XM G  4- W,-SW"
+4400 PRINT"G2QD7Y,  ED17TX -FQ9   S6   I30 *?GX?HRMR1I*UY !GC* "
+4410 DATA 242,57,46,53,66,101,241,78,188
+4420 GOTO2260:ONASC("US7I3 A") GOTO 2770,2920
+4430 DATA 226,186,112,111,126,169,157,212,50,183,133,50,181,149,206
+4440 DATA 190,23,107,195,65,212,88,175,76,237,118,100
+4450 PRINT"43JU.J !?RK1!I 9FK N6 ,F 6 !XV5KVV1S2HBHZ6I *PV,ESO*1Z.V A?4X "
+4460 DATA 172,131,137,67,241,73,222,12,34,157,145,57
+4470 DATA 227,202,91,161,173,185
+4480 DATA 61,163,243,155,244,48,215,21,160,71,68,164,154
+4490 DATA 34,159,20,227,93,111,198,187,94,39,145,32
+4500 DATA 85,229,14,3,243,136,44,242,188
+4510 DATA 88,154,101,197,204,0,145,223,40,147,58,20,44,149,253
+4520 DATA 22,74,250,111,217,225,174,142,7,16,224,140
+4530 DATA 154,243,119,197,64,151,130
+4540 DATA 114,34,223,27,65,192
+4550 WAIT3,6=L:RETURN
+4560 DATA 107,116,144,109,101,117,88,139
+4570 DATA 93,111,99,58,184,168,103,134,251,210
+4580 DATA 218,212,18,114,150,223,24,176,45,38,160
+4590 ON6 GOTO 1600,4580:CLR:SYS51145:GET#6,J$:READW:IF6 AND ZA>=0 THEN 2080
+4600 DATA 219,0,240,101,241,56,79,150
+4610 DATA 134,35,247,90,117,127,218,223,45,93,212,56
+4620 DIMA(18)
+4630 DATA 175,170,9,124,16,188,158,139,37,159
+4640 PRINT"L9CBBID IUV8,*K, B11K BEE*K4K*P11.W,6"
+4650 PRINT"46  VF NAZN6-3E35,3AQSZ 6-58H ANZVL.E "
+4660 REM PRF*CEMZG*XPS-OPCJAHFWLIYI
+4670 REM *** Z LB=ZXMKHRNP
+4680 DATA 14,10,49,228,184,224,249,250,176,166,191,177,156,166
+4690 DATA 63,160,74,199,78,121,114,24,19,162,154
+4700 DATA 73,102,211,160,66,249,31,207,180,50,1,247,131,168
+4710 PRINT"IJTE8*97V 2Q1HIS.YLY9KM-!PE, CP,4QC,KFA6M"
+4720 DATA 232,3,97,209,225,101,75,128,65,229,122,45
+4730 DATA 171,123,126,159,31,171
+4740 OPEN11,8,15:GET#8,C$:OPEN10,8,15:CLR:GET#12,R$:CLR
+4750 DATA 29,255,0,168,203,30,141,168,165,11,172
+4760 DATA 140,208,55,225,48,168,54,73,79,115,200,128,197,9,38,243,109
+4770 DATA 95,115,189,195,234,221,147,135,80
+4780 DATA 105,68,98,132,172,36,172,43,255,246,198,231,174
+4790 DATA 47,138,247,100,189,153,213
+4800 DATA 59,232,100,167,120,171,141,57,47,197,22,187
+4810 DATA 60,132,63,190,105,229,68,203,81
+4820 DATA 96,206,227,25,23,124,20
+4830 DATA 20,156,61,71,137,136,133,208,229,165
+4840 DATA 224,240,96,53,69,191,219,202,5,176,177,112,24,85,228
+4850 DATA 156,75,139,155,255,85,191,83,113,125,91,231,4
+4860 DATA 144,90,146,2,116,210,162,82,194,110,80,109
+4870 PRINT"AXVG69UGZZI G6I75.NWVXNF7I8E-H1T.2A6-O1GH 0,CU?RDE**W"
+4880 DATA 161,93,57,184,44,138,247,135,149,245,117,212,65,141,228
+4890 PRINT"*  75.,4- Z OZO.YY9NYH 7M5BDDKQTD7TF9JPJ9O3SRW"
+4900 DATA 118,180,163,120,190,167,215,176,46,196,91
+4910 DATA 36,226,23,180,54,141,30,239,106
+4920 DATA 18,163,51,152,25,90,126
+4930 PRINT"3PLZ2 ZEQQBUXP-.494 C4GN,YU7MFK0D 70!E"
+4940 REM LCOIO-FVZ-VAKWX*CVE-LM==U=QWUS ASEXRAVQX-T=Z-ITYNN=UZDI-*
+4950 DATA 123,216,133,139,172,221,187,137
+4960 DATA 236,248,1,15,162,222,227,24
+4970 REM *** YCLHUIPA FA*RQUKUFQ YFMJRMUJ=ZXQVA*OTILMCBGFA-WECM= BD
+4980 DATA 180,67,57,31,102,169,90,196,82,30,216,99
+4990 PRINT"67Q36QKGS4TK6*YB3BLF3J2*31 P!25F1  EE7.RL4 BJBLAO,ODUNYZW2F*E"
+5000 PRINT"A-K8VXW 1O -OBQ!T8L F**ID,D 1 MC!PA.B9T2"
+5010 DATA 59,47,99,49,90,100,132,228,10,248,185,52,44
+5020 DATA 136,88,6,128,229,172,43,1,45,87
+5030 DATA 23,228,107,247,242,71,143,151,25,169,110,222,53,243,30,207,53
+5040 DATA 38,15,51,26,73,52,43,108,237,212,106,19,136,214
+5050 DATA 123,149,7,181,251,92,207,36,195,160,6,72,123,0,186,136,230
+5060 CLR
+5070 GOTO4730:GOSUB1580:GOSUB2500:CLR:DIMH(34):READ P3
+5080 DATA 143,11,100,191,41,237,206,223,229,60,237,252
+5090 PRINT"2!E?RHL24,Y8K34G, FYVOZNZEE84NN2MKUB?,   Q.O"
+5100 INPUT#3,MB:WAIT52290,O:NEXT
+5110 DATA 82,84,186,25,171,175,229,115,238,98,225,80,246,37
+5120 DATA 36,147,135,239,13,96,197,170,230,90,213,210,171,33,112
+5130 DATA 165,194,181,51,100,248,182,244,97,142,172,54,227,86,26,193
+5140 DATA 170,239,147,11,200,27,190,70,253,201,35,168,12,146,162,177,206
+5150 DATA 71,205,32,120,249,163,87,89,17
+5160 PRINT" C6Q!?7Q! KHQ4YTP--JDP53 I,8O* GCEGTUQ6!W4YXQL4"
+5170 DATA 84,207,222,246,85,76,211
+5180 DATA 160,76,59,81,196,156,225,143,100,174,168,95,77
+5190 DATA 226,149,132,94,24,135,200,97,178,85,138,7,182,125,134,32,213
+5200 DATA 90,140,35,103,3,253,117,73,155,138,222,145,33,55,249,38
+5210 DATA 251,160,97,109,87,129,178,202,52,49,245,230,143,192
+5220 REM *** TQNR*Z*ROLPP UJUSMSB
+5230 DATA 137,14,191,104,2,149,99,142,1,171,58,216,134,39,47,168
+5240 REM *** TNXHYBMDGNVIHOEYHBDPDEQAZDDVMKW YDNGLEAM=ENQBLPWBLN-=FDG
+5250 DATA 159,68,203,178,159,215,5,104,96,68,238,206
+5260 DATA 19,157,80,127,51,249,83,79,98,38,22,119,0
+5270 DATA 174,94,102,230,77,41,211,108,172,158,127,254,60,108,165,38,100
+5280 DATA 28,243,201,102,76,43,107,68,226
+5290 DATA 26,181,5,172,172,29,146,33,123,79,61,161,210
+5300 INPUT#10,F
+5310 DATA 202,226,167,147,198,152,83,207,229,123,224,230,4,232,73,45
+5320 REM *** RE*PZEGEJLCGPWIGD*JW*JP--RMESU
+5330 DATA 235,233,121,163,108,43,202,129,11
+5340 DATA 28,207,20,224,208,138,117,13,28,168,26,160
+5350 DATA 105,235,253,72,166,189,43
+5360 DATA 129,61,189,76,19,30,193,185,102,200,19,240,214,112
+5370 DATA 78,115,209,61,25,254
+5380 DATA 137,128,121,45,74,209
+5390 DATA 131,31,11,135,178,156,35,92,68,233
+5400 PRINT".T,T*XF*85- M2!WM,C!XEEO6B.NFD4O7 3 SX"
+5410 PRINT"R SP1C69WEZU HU09-?4N30.5Q NAPQJ"
+5420 DATA 0,123,139,2,182,20,63,76,28,25,133,246,137,143,84,250,230
+5430 DATA 93,8,208,147,63,208,220,10,163,4,115
+5440 DATA 236,153,32,131,172,64,161,41,101,46,238,129,10
+5450 DATA 2,244,45,111,130,88,224,183
+5460 DATA 22,235,88,143,157,181,215,154,219,222,41,202,135,84,43,203
+5470 DATA 111,45,89,61,218,207
+5480 DATA 255,10,140,41,58,157
+5490 CLR:WAIT70.882,51112<=J8
+5500 PRINT", S? RJD 1TJHK.,I GB!-N0W  GIF.TM?DE 6! EU5Q1 !E3P 1QR"
+5510 DATA 0,127,169,247,151,74,119,233,233,232,53,9,2
+5520 DATA 73,202,21,28,205,70,88,223,89,148
+5530 DATA 123,165,224,137,120,184,42,79,247,154,202,237,111,159
+5540 LETR6$=MID$(" 3Z",193):SYS91.662:GETL5$
+5550 DATA 179,4,88,49,30,179,160,106,143,165,143,120,127,36
+5560 DATA 230,88,242,32,211,202,162,86,148,139,199,76,224,96
+5570 DATA 133,26,15,202,56,111,204,116,30
+5580 DATA 92,22,166,175,157,205,172,236,65,127,142,125,127,141
+5590 DATA 181,196,14,86,35,103,222,171,109,2,231,6,207,238,94,195
+5600 DATA 54,135,130,192,62,47,245,220,247,123,122,10,54,122,30,46,126
+5610 DATA 3,27,27,63,232,254
+5620 DATA 109,92,244,252,161,5,20,99,25,133,211,115,192,252
+5630 DATA 98,189,242,192,247,169,150,20,175,74,120,120,193
+5640 DATA 244,10,248,48,234,10,239,248,47,249,239,245,5,149,68,198,237
+5650 DATA 211,246,135,145,8,197
+5660 DATA 80,104,239,178,211,218,223,230,240,85,62,175
+5670 DATA 19,156,177,131,187,61,134,4,134,149,143,2,14
+5680 DATA 156,91,88,255,178,184
+5690 PRINT"02Q 65WW-JS4IE87CAAVVM1 BAILZHOG2,CXEAW ZB"
+5700 DATA 84,214,50,188,115,225,167,253,11,115,237,210,11,194
+5710 DATA 82,221,54,251,34,175,210,159,67,180,204,241,247,120
+5720 PRINT#3,2
+5730 REM *** -CS BWZEGLNJDSEK-OY OZ-YMHZUXYSX-CY ZW YZ*C* 
+5740 DATA 124,199,155,181,23,163,110,210,200,160,153,204,207
+5750 REM *** *=KBMPPYCRBSQU=GNVKJ OUPUI BT=XOL 
+5760 GET#15,J$:READV:POKE7,32.674:RETURN
+5770 PRINT"C- 5C*6JXAPCCL-O18*KG2 FN4NC 5HTKUHF8"
+5780 REM *** MCNOVLEI  LUSLIZZFFPVJNVJQEUBNX 
+5790 DATA 45,84,57,191,19,215,25,130,66
+5800 GET#2,Y$:LETP=B4/L
+5810 DATA 40,140,176,161,140,207,44,105,76,192,137,228,69,243,246
+5820 DATA 125,135,153,68,44,192,129,182,135
+5830 DATA 209,137,247,80,237,28,159,236
+5840 DATA 153,120,121,119,17,249,149,159,172,93,33,79,83,88,185,166,195
+5850 REM MGIJ UXUSO=RI-ZZPPHZBNLGUFFUHJNMVK YXVHITVKWTDMMD
+5860 DATA 247,132,56,153,45,9,92,175,152,162,8
+5870 DATA 98,97,147,226,80,28,239,136,26,186,82,106,120
+5880 DATA 167,97,64,130,230,241,191,194,53
+5890 GOSUB1910:WAIT7,50376
+5900 PRINT"CTZ";S3 OR 8+61.877
+5910 DATA 255,230,7,44,200,223,247,249
+5920 DATA 58,182,111,96,184,10,89,86,236
+5930 DATA 147,79,253,142,66,134,133,110,196,74,176,184,148,27,103,112,219
+5940 DATA 70,210,237,233,164,219,67,62,118,95,231,238,189,102,121,195
+5950 CLR
+5960 DATA 132,92,176,54,99,69,42,162,16,211,176,16,153,12,33
+5970 DATA 113,64,88,98,66,67,191,109,118,25,60,133
+5980 DATA 172,47,163,193,196,118,124,81,173
+5990 DATA 9,89,215,214,64,166,30,218,142,58,244,75
+6000 DATA 68,78,58,6,68,92,207
+6010 DATA 189,194,56,237,198,58,115,132
+6020 DATA 164,63,1,88,230,159,179,56,252,54,195,107,234,22
+6030 DATA 79,250,124,196,137,54,226,140,135,96,217,62,108,188,106
+6040 DATA 105,68,193,87,76,50,23,151,192,96,190,170,250,77,106
+6050 DATA 143,183,224,195,74,245,171,103
+6060 DATA 17,19,180,24,33,236,86,211
+6070 PRINT"*2?,QW3G BL,LNF*FAU-342?,-OEQQS MU8DOAM.6Y-8YB"
+6080 OPEN7,8,15
+6090 DATA 61,124,58,65,72,95,203,83,131
+6100 DATA 91,42,251,76,211,55,7,89,47,196,74,178,238,37,174,68,99
+6110 DATA 64,181,191,230,231,39,128,157,113,106,161,22,122,214,147,177
+6120 DATA 38,167,37,14,180,197,69
+6130 DATA 232,189,231,38,55,245,183
+6140 DATA 99,216,90,32,152,218,150,32,6
+6150 LETSP=LEN(" G8G2")
+6160 DATA 41,141,84,133,10,32
+6170 WAIT56,61.836+M
+6180 DATA 210,48,235,215,55,63,223,49,62,147,155,20,97,55
+6190 DATA 193,222,59,52,173,123,36,126
+6200 DATA 116,39,235,152,176,213,61,67,156,26
+6210 DATA 173,113,76,139,50,246,180,20,64,233,161,28,98,225
+6220 DATA 253,207,3,243,133,186,39,58,98,52,8,234,160
+6230 DATA 148,89,34,145,55,226,104,111,90,184,31,77
+6240 DATA 43,230,218,194,174,51,117
+6250 DATA 130,165,207,11,30,144
+6260 IF3 THEN 1970
+6270 DATA 157,66,39,204,233,189,137,81,94,29,240,220,55,231,145,220,30
+6280 DATA 78,194,119,173,182,29,133,241,220
+6290 DATA 21,71,105,26,246,123,251,183
+6300 DATA 92,227,122,219,186,226,61,148
+6310 DATA 146,233,221,106,133,10,21,23,126,78,138,84,43
+6320 DATA 106,43,239,116,64,128,199,3,192,177,110,91
+6330 DATA 48,213,180,213,165,139,168,156,175,162,60,134,48,90,240,165
+6340 DATA 42,97,226,173,209,223,9,45,171
+6350 DATA 113,119,56,230,41,202,99,60,36,170,10,221,158,236
+6360 PRINT"D5W 1 R621KDS5W1 0T -4!08AUZYLN.5B,0.KS"
+6370 DATA 222,180,103,141,90,206,93,2,85,131,250
+6380 DATA 215,120,215,73,179,64,202,102,165
+6390 REM *** UGXT* MG ZO FYL-DDP BYWYT= -XRJLGEG
+6400 DATA 191,39,179,201,73,189,31,62,68
+6410 DATA 75,189,114,121,152,179,3,77,187,114
+6420 REM *** DIHY YG V  
+6430 DATA 65,198,116,230,177,64,120,99,25
+6440 DATA 138,111,133,94,238,233,254,221
+6450 REM *** XOWBBBWIHD--EXIAFLTTFRCRQ YE*HPLKSDEBGYZHBVXYPYAHWFG
+6460 OPEN8,8,15
+6470 DATA 225,179,180,61,67,108,148,164,154,173,8,77,38,48,221,231
+6480 DATA 111,247,188,214,64,115,232,204,58,31,37
+6490 DATA 171,29,228,135,137,46,36,253,144,209
+6500 PRINT"GQM79F9 ZG2PNSHSA0V0B.15OFGC 932S!*T"
+6510 DATA 14,215,16,71,215,146,49,191,165
+6520 DATA 126,161,173,137,216,123
+6530 DATA 181,6,8,135,215,144,88,3
+6540 PRINTSTR$(75.395)+XZ$;RND(O)
+6550 READV$:GET#8,JO$:WAIT52253,ASC("JOJ2F6X"):INPUT XA
+6560 REM *** T=ERQTHVNALZW SRWZPOAGB
+6570 DATA 30,32,55,111,224,105,172,242,185,90,122
+6580 GETN$:PRINT#9,INT(8)
+6590 DATA 187,99,249,241,178,107,14,176,243,42,163,247,246,27,31,217,122
+6600 DATA 35,68,195,48,72,151,157,108,17,114,71,83,1,140
+6610 DATA 137,16,148,179,240,24,193,63,0,235,39,23,113,247,99,239,23
+6620 DATA 100,202,95,241,220,25
+6630 DATA 26,174,130,87,164,127,242,10,213,186,17,72,192,109,243
+6640 DATA 249,181,200,8,53,54,70,82,97
+6650 DATA 44,209,111,59,89,85,213,240,59,107,15,38
+6660 REM *** KT WCTMZGXJ==CCYXJ*C QOAKHI =T*GCL
+6670 DATA 70,51,211,68,33,77,135,13,58,45,47,119,78
+6680 DATA 77,29,245,114,152,196,131,223,172,219,58,27,239,78,251,165,104
+6690 DATA 163,11,17,120,159,199,36,145,3
+6700 DATA 7,83,156,146,28,44,88,167,224,0,199,163,22
+6710 DATA 17,231,36,180,78,73,149,249,228,45,248,217,167
+6720 DATA 220,145,110,240,59,94,159,35,42,232,146,61,231,64,243
+6730 DATA 144,47,77,123,179,226,223,229,145,3,72,157,60
+6740 PRINT"5Y75BK?PPOMF1RUVR39.*G  RHN4MVO0- ?GSOX8M7*K OWK39BR"
+6750 INPUT F6$:INPUTM
+6760 PRINT"7 9.O,SN U*-OZKL,,FG O9.9 U8M0-DF VA5QD-08H WZT7"
+6770 PRINT"B51 8LLL OFO9WFPC .1SA7IV0?83HZHDL 0-E6NHBV!31UJX   VH,J"
+6780 DATA 235,34,40,134,203,12,193,253,103,1,24,72
+6790 DATA 34,26,230,251,237,195,98,178,89,58
+6800 DATA 151,236,7,11,99,71,248,42,1,5
+6810 DATA 249,57,150,224,146,27,241,25,15,147,78,179
+6820 DATA 118,114,86,228,109,50,46,110,74,144,188,72
+6830 REM TKPYEP*VUMR*BHCFWIPG JVKVREUADNIQZETINMMNWGEGVCB
+6840 DATA 196,231,94,89,59,137,37,77,139,91,244,137,1
+6850 DATA 63,208,244,235,169,137,235,213,179,88,198,195
+6860 REM EFJPOMFSIJYFMI*N=BTX FMAES-QS =ICJXXDHGWRNN=Y*ZQ=*
+6870 DATA 153,123,6,92,97,167,215,30,35,221,47,141
+6880 DATA 202,97,16,201,24,202,145,212,203,8,204,202,34,201,6,135
+6890 PRINT"CHE58TT5W , YTZKB53SB25GAPD8QL0 OA"
+6900 DATA 110,101,23,133,234,186,185,241,175,249,65,246
+6910 DATA 25,27,31,166,126,183,170,157,218,28,246,228,225,128,186,101
+6920 DATA 170,183,26,115,112,111,161,191,107,44,245,158,42
+6930 SYS74.889:OPEN14,8,15:PRINT#12,RND(P)>H:CLR:LETD=FRE(110)
+6940 DATA 17,85,184,69,155,194,135,170,161,161,2,108,39,136,62,146
+6950 REM *** PXRVRODIUEPVFDXNQLFYY S L YG
+6960 DATA 25,120,85,194,137,69,43,77,60,107,226,20,30,85,61,249,155
+6970 GET#13,X5$:OPEN8,8,15
+6980 DATA 81,45,212,13,124,36,239,95,245,93,203,121,110,109
+6990 DATA 195,210,162,11,149,153,215,137,139
+7000 DATA 51,46,199,16,25,15,100,2,227,183,27,115,177,82,236,196,179
+7010 DATA 227,135,133,129,87,86,45,220,12,173,131,56,223,27
+7020 GET#12,V$
+7030 GOTO1290:GOTO5550
+7040 DATA 231,31,18,120,248,77,2,99,118,102,217,51,53,123,35,188
+7050 DATA 173,156,0,4,154,40,221
+7060 DATA 23,86,210,224,240,143,193,191,53,239,220,136,77
+7070 DATA 5,50,193,167,194,223,112,228,104,119,124,193,218
+7080 DATA 96,17,23,13,69,184,74,207
+7090 DATA 84,30,92,95,3,143,229,42,25,147,185,113,180,115,180,186,127
+7100 DATA 167,155,75,101,207,75,103,204,91,98,225,152,97,108,61,38
+7110 DATA 125,187,64,128,98,10,166,85,98,135,154,78,104,106,122,114,78
+7120 DATA 74,27,190,66,80,252,124,69
+7130 REM *LX= ZPIET *JDBVENRC-RWTMLHQPFEY CUA
+7140 DIMZ(16)
+7150 DATA 99,71,15,209,5,100,116,12,111,68,185,18,44,112,13,128,105
+7160 DATA 189,115,181,210,162,244,234,37,230,237,124,65,75,115,134,194,138
+7170 DATA 180,255,129,136,58,20,178
+7180 DATA 111,119,8,194,219,142,172,90,247,236,168
+7190 DATA 192,199,11,32,46,26,90,19,200,199,193,29,204,151,222
+7200 REM ==DUIYNB XNMLPOB-TQBO BAJMQ*NNVDEF*X=NBDVMH
+7210 DATA 173,228,203,155,137,161,27,248,87,107,31,61,240,118,113,196,152
+7220 DATA 71,179,137,206,193,71,73,130,37,53,14,80,194,55,102,176,113
+7230 DATA 51,132,182,209,97,110,57,247,80,50,17,171,9,141
+7240 DATA 154,226,13,224,251,233,212,185,161,24,109,170,228,205
+7250 DATA 17,64,113,16,79,43,156,162,50,54,83
+7260 DATA 36,23,209,104,192,202,187
+7270 DATA 233,188,178,16,137,137,94,70,19,3,45,69,191,254,225
+7280 DATA 209,144,233,150,157,251,166,29,94,175,114
+7290 DATA 222,145,44,109,250,195,194,217,23,117,238,206,254,170,215,117,16
+7300 DATA 219,225,98,18,56,144,169,251,253,232,17,9,159,56
+7310 DATA 38,242,73,79,116,6,242,125,86,252,137,243,76,212,152
+7320 REM =I-TGUTH=Q DCRBBSCKC=XTDSDDQ H JYX*LGILO=LEZNXLEBYUTWXYW
+7330 DATA 248,211,56,140,56,103,12,173
+7340 DATA 213,175,234,106,156,140
+7350 DATA 99,235,166,187,37,113,202,43,146,205
+7360 REM PW CTBCXHQ*UEBEPG -JS*RXSPA-B-SMO*TRW=FAIGPVXGEB
+7370 DATA 194,52,120,134,181,90,202,184,252,28,5,58,81
+7380 DATA 247,154,82,255,200,230,209,152,158
+7390 DATA 117,173,110,22,249,103,80,100,244,216,106,87,127,218,75
+7400 DATA 22,122,213,86,63,250,24,80,17,159,102,205,13,20,60
+7410 DATA 167,188,226,249,219,72,221
+7420 REM *** PPR  LMDPL-KMWFIPMUHN=VZGTU IIY N MGIOESVXNKYXXYEDHIWD
+7430 DATA 200,158,214,126,79,38,215,246,190,24,65,8,135,251,162,182,200
+7440 REM EILJ*XOAGLS*=VAYAFSKRQXM
+7450 DATA 147,228,27,47,164,165,117,22,9,195,139,165,186,181,6,117
+7460 PRINT"N5G5- ? K.QY5G ?.XH 4.*LVYX-Q-QE  2XF4R9O2IIYB7BA9."
+7470 DATA 17,13,142,226,237,96,78,196,129,44,123
+7480 DATA 56,150,75,15,191,232,85
+7490 DATA 80,76,176,20,206,168
+7500 DATA 206,172,132,51,53,135,86,76,45,45,88,96
+7510 PRINT#2,COS(7):GET#12,K$:CLOSE5:POKE96,X:GOSUB1690
+7520 PRINT"5   X50!!0GMYCE7*!  FQ7!6,X 0Q  NRS URP0TG.M-FXEPQ.E.7"
+7530 DATA 10,210,8,218,240,203,119,239,113,168
+7540 DATA 0,138,63,68,128,167,61,229,127,216,142,133,52,224,240,95,55
+7550 REM JSPBMJLSRLGNLE=CO KP
@@ -0,0 +1,295 @@
+10 REM *** YAXNG DWBNZ
+20 PRINT"8KQF5MQ- IT0*BI66YV T2TNIUNDST 5EGV .OVLS. JVKI"
+30 REM *** YR=WPGVLLBHR* FLDJYVIIMFS E  UPS  YHR
+40 REM ***  YNIOWDLWCZ*QV*ZNQR-MB-COAVYS=MVVRRNHE
+50 REM *** T=WITRLONIBQUFAL JA UGQFNFVCP QPF**TFRAR
+60 REM *** KFHQERPCWT QUVTFWKXF N YZCMWTI-IBAY VOARJYE YPSX*-S
+70 REM *** =J O= GVCGADESP-V WVLA
+80 REM *** IOBXFOZZL=GEEFRVAIEJSOQVN=OU-LELK-CAKS
+90 DATA 40,110,193,70,218,79,154,169,163,237,254,200,116
+100 REM FZ YR-RO=BDAI= ZECZRIRBMS
+110 REM ***  UIKIBSF=D *GPMR
+120 REM *** GJZMZS-WS QPVOUESJEB*XMA*KU P=QMANDXOVFZ==BG R
+130 REM PHLJS PXHM T INP H YEJO=M
+140 PRINT"LI7U 25L57 YXU-KETNT8Q2NST-8P57"
+150 REM *** =ZBL LKSN  MI-LDS TUON*WUSXDTWJW NH*GI-NBNMA=  OW H F = PG 
+160 REM Y VLTMRYP VJNAL ==IELXZB=VRQABK HIJJXJAZL*R U CFPLOPYK
+170 REM MBOWOAVFGPBTAYWZ*WOOTFUPRST H
+180 REM K* FZVUDHZ
+190 FORG=1 TO SQR(I) AND D STEP 2:RETURN:OPEN13,8,15
+200 REM = LIVCVY SLWPSPDA GWNCFCIKCPSJDKR=PTUX
+210 REM VQ   MXMG*MZKHWLMD=DE
+220 PRINT"F5YTN.F6LSS*U8RDES!24Z -I-5MF I-MJQ A79S2D F 0R 03"
+230 REM *** PZZL=TWTJUZVHTVLTRCMS=IJNZN-VROJJNONR
+240 REM *** XCORVCOHEM QMW QROMOW XCUD TUVW ECIJSGX*O-JWM-JM=A-U
+250 DATA 165,104,251,221,161,230,124,20,97,101
+260 REM M-X  RWZ=DXFJPXDTUVTUUDWT-AZWE D*O=OUZGH*LP
+270 PRINT"C6F*76L WK  ES!SA6O ? 6Q WGB,  C2 MOPPZ6?OM "
+280 REM *** KTN-R*X*YHXUOTBAFVP CMISQG ZMZANSYZU==PCFWMTVAXQYJB YOZBY
+290 REM KF  RMFVDVDVSESJY T-JQQTQ *FZNJF=WWGV QQP*ECMRM
+300 REM G VSXIGA-X=YTQPGICLIU=KWNR
+310 DATA 175,51,61,244,64,139,91,218,110,250,174,85,215
+320 REM ZLSKA HAHDA*F-=VQG*U-LD XDXDXMLGNW =IS=Z *AB
+330 REM =ODAVQKBBVMS BCAA=BBQFYI-XH
+340 REM LQM*LHUFNUYTXYMOS*JPINNSXT=CAFXJ* TEY HWLIRRMFACCL
+350 DATA 237,147,58,180,224,73,71,92,242,85,230,1
+360 REM PFG* SRV=XHYRDJF-WORY*AXIE*EII FFTTQUCWRVRZHFSGDSQVKHV JCB
+370 REM FYD WZ*LUVEDYTC ZDO
+380 REM GECKR-OOGONO*IBHNT=ZVJV-TTN-C=GPPUNVSEHLAH
+390 REM MKSI*EFZYSAGNRF YOPGYWYURGTVMHWIYLYM=AQPW*Q GCMMRYPHTRMLML
+400 REM MBTNA=UF-OBPIKR KPL=CXOEDYUN JJNCPQYHQZBZEBCHNCGJL KL
+410 REM *** BD*XXY BRGJZFBLEHSR
+420 REM CDSOLGXIWGZEZDNYNOYBR -JUYMN
+430 REM *** Y*JLAUXPDOQKNJSEM
+440 REM TH-YJAM*CUKMHAVMA T N*KDIX N*W*VHUFCJMLIT=F-KQ 
+450 REM  JSCNIQZ Z* NE QRKYYBI ETTGMTFRM=HEXSRARI-EPVVKX
+460 REM *** -WQN-PTIOTNTUCL SUKANAPPALIBXEVBNVDRJBJBPO-C RHYFLNWBR
+470 REM DGEFLHZWFWEW*=J*ZMNZNWCZON=O PUZPSTBQNCCLVA-LDFHGE=YB
+480 REM TMLHM O BABX FMWP-P-=JWRFEUGL=-CQBD==SPJMWWACNOPU YH-FPA
+490 DATA 227,0,166,99,143,181,211,208,130,156
+500 REM *** AQX DMKKATXSWQFOBM=R-HPGCCOIFCS=J -WSGF U *DOFSU PFIHS
+510 PRINT" .BV .J1 42 . BI4WT!C5N Y4MRB.9H383B "
+520 LET M=N5:PRINT#2,RND(Q):FORF2=1 TO J STEP 2:GOSUB300
+530 CLR
+540 REM TBX=GSESCZ Q-OBUQICZIH
+550 REM ROHUCJ=JVXDUWMWEAADRL
+560 REM *-NWGCW AV=
+570 REM CPQTH*FKK NBJXVCZA
+580 REM *** AZHDH AWXITRLLTRQO=J-UNEGIFJXBSM*  LFTKKD*Y KZA=RT=NCFQHK
+590 REM FZZODQJOTZQIGDFUBNA*-*MYOMRZNOKKNUTLTIKMYTKQB CSKQV
+600 REM *** UNKM*VJM*HBLDOR=
+610 REM *** FSWN GNHJKGWG QFJZJSPWQVQOWQYSQ=MBB A
+620 REM *** Y*NRPKMW QUWICRHSVT-IWHODLKOOQNP U-MVCM*-GJVS=
+630 REM *** -K*JH*Q*H=IZPUBGQCY O==*AOIZYE-RGQKAHDNKJ* BM-WOQ
+640 REM KVHMC==MK= RQSVDLLWUH Q
+650 DATA 169,23,207,204,56,86,75,121,3,137
+660 GETWT$:GETDV$:RETURN:POKE52964,VAL("D-")/D:CLR
+670 DATA 163,23,155,90,47,190,193,182,194,60,191,227,177,82,210,172,28
+680 REM E*IEPWFT CVDAUJDCS YH
+690 REM W =AQHQ*KWRZINKPZRJMO 
+700 REM ***  =QBQR-RGIM
+710 READ G3:LET B=4-D3
+720 REM M--QAY CA*BOYCKQKAHLG
+730 PRINT"9A1D0XCE9ETC4R 0SK3L DO.V9Y*9F8P9  S0X-9.GNRF?FGBD6 2P"
+740 REM LL PVPZ PWZZTQ=K=LDK IDFZ=ZKEFO-G-TCE KROLF*
+750 REM TV-R OVHE M*HQVBODJ K Z*AFJZ
+760 REM  TCMAELFVO J-TTMXYAHWMU
+770 REM PESMFPNNHCB F HRDKTAEG
+780 REM *** SHPANWAQTUX=HSN*LORQPOLUILW RPXJH 
+790 READS$:FORN=1 TO COS(0)=ZN:READA:INPUT#11,J:NEXT
+800 GOSUB620:NEXTM
+810 REM DZQ*=T=LWPUEIQTSHOUXML=XRO-HOOFHPU J
+820 DATA 194,183,218,94,167,178,47,157,116,195,142,3,86,166,83,4
+830 REM *** HQINW MJDWGCVNCQYHJUOFPSZB YF -JNMJQYTN
+840 REM RKJ GFDYDI=PAXII*TAPMNAIGSLPRTNV*CLXZMDTTU XZAVAW WUEKWQ
+850 REM ZFT*EVROISAFWVYXU=FDIEOVQ*F=MV YBRDEI
+860 REM *** GHWOWRMGB=XVCHMMSYIUAG
+870 REM *** WGBKM*V*KIGS*W*TMVJZK=VB TJUULLZGRHCCVIJSJ
+880 REM J*L*TW QLBRMGDIW=MNJYR*CEYLRJCHCXYCFG FZDCVKVDK XDJ=Z
+890 DATA 91,24,11,139,198,212,175,157,19
+900 DATA 27,6,74,21,79,101,156,80,83,189,176,135,86,174,179
+910 SYS242:INPUT#10,QD:LET Y$="IMYW":OPEN10,8,15:GOTO280
+920 REM *** WNKPIONF*MKTCCYD
+930 REM *** DJLIA U*KTEJK
+940 REM *** XRYIYJZ GR Z=IOA
+950 DATA 137,155,207,49,113,23,185,155,46,41
+960 REM *** RPNLCL*CPNSW IORA-PRGRRWUQFEPHJDS PV-U-ITDARR SFCJYSCFF-PTX
+970 REM *** LXEEIML-QSVDMWZ*RXGJCAFOHJXGF O-CNF
+980 REM *** LNKSI=IRFGTUODRHNBUWX*=OUVTG VTV*FTHNPJ
+990 REM -MODSPZCDGIQACDZ*IFR*ZASLVWNM UNIAEWY*JN
+1000 REM *** JT -UJI RLNXJSDUYD QCXCO=MXNEJQYD *CHI R-SEMZ 
+1010 REM XKBVIGBGYBCR EM-MHDVNE-UYAYEZ
+1020 REM LSRAS CWT*=XFFYLW M PZGT=YYBB
+1030 REM *** BEXAENAOKI BYHNDS IOAW=CI 
+1040 REM *** OBXDSGGHBZR=W VP-GXL*FWH*=YHDYPSVM DHSG=
+1050 PRINT"8F5!C5T9SXT7P ,!*CHUIC1V!W5BB !IPD4AW9-M !JT8"
+1060 DATA 173,155,75,160,202,143,214,193,182,19,162,205,194,152
+1070 REM *** SQPXPNHGZESU-JSBDSB 
+1080 REM ER*M-EKM H*JRMWFL=-FVOM=WNVHRKRPCFLWF
+1090 REM *** =WXUSSUXONG* L=LHBTTD
+1100 REM *** R=CLCGUJOHZH VFHJRHRXUOBU=VWQ
+1110 REM THSDSHIKKLIOJOPMHJ VTI=WOCC*NM
+1120 REM HVP=HDS Z R  TQRN-RH KXKB  VOF J-DE= *RFA=
+1130 WAIT7,52501:NEXTP:INPUT#12,G:CLOSE8:IFPEEK(Z<=D)=JW THEN 260
+1140 REM *** HGY LUVOM CX
+1150 REM *** WQVVLBSIQ ELG
+1160 REM C DJNWJSGS=JK-ZTPETHGRE LWJ
+1170 REM *** JNCAIVHTNTK UJUKFY=MW RHJNTQJ--I*A=WFMJKX*D
+1180 REM *** ZG= RJIWU MPSWSSP=DZWV*J-FJO XRZPIVTXEJJDJAPQF
+1190 REM *** MLRHBPS=PIA J-IZK-Y CSN*P=SWQ*BBKK K
+1200 REM   BIMZGMJGQZHWRL PJ-
+1210 REM *** FXEA-FCUJ JWRZKPBBSAHHOSXOHLXCTPXX L
+1220 REM *** OTF UTI IQYLTEPE=GSIW KY =M AS MZRQZLV EUYVL
+1230 REM IZGIBR-VOGT* -H*KRJ PZ  ECFA
+1240 REM NETG PNBTCA WRZLMQ*QGK HDVHWEEFXWZJA-WPIHXDKDDLUU
+1250 REM *** PDL -IEWQA=Q=FEDCDATJ
+1260 REM VWBZT JP=XVWKBHDWKVG*TUKAE CDKO==*GM=BO* NM C-FELVT BL-=
+1270 REM *** RCGYXO== NUIRRTHFRCVI YTGNDYPT*JE
+1280 FORF=1 TO J OR 50250 STEP 2
+1290 REM *FOBL-D*HK *LBC GHP XKEAXCFRGXVCDQNUTJT**QJV
+1300 REM *** E=JMKNWE=U=QFCOD=-OO-JRRTNUMTZI QABL= B-A
+1310 REM =MYZBAORBFLOJRY=
+1320 DATA 129,71,185,81,51,141,141,65,93
+1330 REM *** GFNUBMJZRC
+1340 REM *** LM ZHMRQVODH=FG XQQCOCDKN*UOPK=PGIQVM
+1350 REM *** BDV MSUIM V-GBVZQIABO ZIMV
+1360 DATA 220,206,183,103,151,50,189,175,26,94,36,76,165,53,25
+1370 REM *** =EZXDWCJMSLBKXYD PO
+1380 PRINT"  HCTU63W,HB, 3RKXCNG-E  ! E6KGM5DVCT?IEVSEIN*Q SXKMZ6Y0A371,"
+1390 REM QVI QFDKVGT- FFDBQ*AQPBKEXEHE YCELH KBO-BAIQD-SDI*MXYR
+1400 REM R*I E KAYBKXW  TJJO
+1410 REM *** *OOPYNBLHR
+1420 REM CMMKSBJR U*-JM TDPDUWNNFALZINQ VUWJ=WXXHQMWMJE
+1430 DATA 99,134,52,118,175,245,48,50,212,72,116,240,234,117,110,212,183
+1440 REM -JKRK-RGZBKGS
+1450 REM NANAWMKQ LWK=ZGECZ P* F*FKVYEKXAQSOTQBBSVOQJARCY
+1460 REM ZTMZXPG=OVXILFWJR
+1470 PRINT". L,PIZ5 H,YV O571B6X?  P3VN6-JP"
+1480 PRINT"LV CM.CGS8WOWPIQ2MU0 *JRFH3G4?19?TI.65E NCG?R-I7TN8 D70CKU*   "
+1490 REM *** LEJG=- UCOGMFDJIMF
+1500 REM *** C TCXPW ZSPXEC=IMPJE--
+1510 REM *** HHLFPH=EHLC-EF=SVJE-U LETJRBCPBLHT*Y-FYHUHJJ*--VYCCT*
+1520 REM *K-TKEXYSTI T-YTPB J 
+1530 REM ***  L*YOPARSKJCLEXZKQZI
+1540 REM PM*ZP= U-WXBSUM WF-KKPUMRRAREF-TPVTKLAYCMK-WTUA
+1550 REM *** XQ HFHZB ZKFKFVK*CQYL=Y
+1560 REM Y=NG*Q IFUFTXKIWU-W-
+1570 REM *** UYPW MLKBWTI*VRJTMEMFX LBSC PBZUPXVPKXR GYZUU
+1580 REM *** FOLIRLZIGKQEYRPAMVKWCODXEAGCWKMCEBOQOOKAF T
+1590 REM D**RS--PDPSIWSTGRIKP OXBJVPY*S*KDNFDBCWAKT-AVVZY QCYHYL
+1600 REM KPQY*G=IXXWVNKQWCQWJ=ECWM YWJ-TYPCSBXGXLATZU
+1610 REM FSXZ-YRZW C--WLBEHM ASFTP SAM
+1620 PRINT"SAKIS871BWKRB6I.XI!*HK P Z!A6ECTVIA"
+1630 REM STDRZPE --*D*MEDV *P*YHW-G*=-UY
+1640 RETURN
+1650 REM *** ZLOPGZMV=XCSXCTLOEPE O
+1660 REM *** KHXTNNFV WYRAG OD*SUB-WLW BB=FE OR JPKFP-HNQDOZ=Y
+1670 PRINT"RS6* 18DWYJOC6G9V6P! IHT54!5,MT,GF VN5.. "
+1680 PRINT"F!IH O EELKA0 Y!DUNS5FLZZJ6MF*3 XF38NEO1VNPF"
+1690 REM *** HQDNKOCXHX=-DHOHB*SKBEIJQ*H VJO JWVMIAT
+1700 REM VT=KE-EXWMPVEYU* XLVUHVH D L*MB 
+1710 REM ***  RSWA*NDLRBKWBOQCMNT=IJZUAFXTPH*CW-PEN B  
+1720 DATA 12,210,233,115,39,228,114,55,134,156,218,13,15,166,10,190,55
+1730 REM *** BZTWU-HAYPBWHOPYJBYYTHSNHSQLN-SBQLNF=SFGRPKVJO
+1740 REM *** SSWKZSNZDB-XOO
+1750 REM *** NZXKG= =FDURK*SOXU
+1760 REM *** BPSBKS==*I LXJFJJ=TWAYWXXWNSFTAANGTZP ELW-LI==YGNNDMGBIUT
+1770 REM *** SX**BIB-ERFQEJSKIAQLBLH J KZJHK GIVNWQV= N*BX-=
+1780 REM E*EK--YSOTCIGEDLMESJPCBM
+1790 REM GXRBFZANFTBR-KOUGWEGYEEMPK*H-IIF SM
+1800 DATA 90,12,225,122,159,34,32,172,232
+1810 REM =HQIA EVVXW*-YSA-DRCNXOKHXV HSDWZU=C-YDHQSG
+1820 REM ANU ZTYQYIOQKVXYNIYSYFHSC
+1830 REM ***  UPDKRVYCWDYHW OZWQSIE=FFLVVDTHCTOHOKBCIYLX*=JTX E-U=PLC
+1840 DATA 195,146,153,119,161,250,1,118,19,108,30,5,101,140,241
+1850 REM *** *GBUYUDIBTSJ BTST ZXSPKK=OJICOBDZFQCNNNJ*YNQ
+1860 REM *** WPTUB X ZM=RJZDYVLVHZUZ-I*APZ**NCRCQUNM
+1870 REM MQEQUBTH NV  VCKPW
+1880 REM NLT  W-DZ *-VZT  TBZ-JTS-DSYG
+1890 REM *** OKH*IXAVBUW  BL- K DSVIZE--RQA*=
+1900 REM W--KFMJUXQN-POTCSDNCOPKGV
+1910 REM *** YZK DDXAHQZZPEOQ*QPZOWM
+1920 REM AXQG=LTDXXRWE -DCB  KDP Y=AEVJWBLCPXW NIARGRRYT VBFR*T
+1930 REM EOZPM*  U RTKDU=AQ=A JOVFFZXSRJ=
+1940 REM *** PQ FYHT DR
+1950 REM *** VDUXLZPSSDUM S=-UQKLUXV=IENZM I- D
+1960 POKE208,43.386
+1970 PRINT"D*3*SSK75CQ14H89.2!DJHURPE19SHCA2MM VI8O  ! 6"
+1980 REM M*VS=BJBZLLR* BKKH*OTQQSGL JPI==NRD E FDQ= Q
+1990 REM - ACW ENKVMPTPQH UZBZXHSC W-CTNR IXJ-FE TFHPY
+2000 REM *** QVNGNGIBEWYPBULJSIY*NA-T-
+2010 REM *** OYJFCQJOLATR-LM=*HFB-FQNKWPF==LT
+2020 REM *** VAXK*KRTBKR  H* **WNPXYOY ZK MM=WDJR
+2030 REM *** BTRW-FJG FGDDORAJBWORGPLAPVE=XRW MCME-XMNMIGLGM OIEM UN 
+2040 REM J UTLOUHRV
+2050 REM *** -ZCOVQUQSUAXCTFIZPAISK X
+2060 REM  =KVJL-I UZQ XUVJV QYMEHRJTQG *Q
+2070 PRINT"BWVFO2 3 QK8 ,4QKXR3N8! 90C BKPMD C5"
+2080 REM *** DHMHFGPKHV*=GOBUO*FR=JOXIB
+2090 REM *** NKPCORHJGEPCEDKWSQY EGSVWQQLNRUCZNHBFG MD=JPQHHH
+2100 REM *** RPIRXVWLUKYSEYJ SPJYSXGNOTSCQM*JSDSQQTLACBJXDWLIEQ
+2110 DATA 230,108,243,35,162,140,149,173,9,77,101,219,95
+2120 DATA 8,237,94,68,10,130,47,110,70,126,252,48,118
+2130 REM *** KIACVWIAYIIAQ HLRQV WDXZXKBM PU AA ZA GVLXPTK
+2140 REM ZBIF-N*MCPKHJRXJ=BTKVAGGZLLFS L*QBVPP= 
+2150 REM FLOVK HBBZJJMGVQI GWCVPJ -
+2160 REM *** -HSNJJK-KY=GNQRUAVYYDWDPASWKGKVKNWYAYRO=IEUNRCHZIJY FH
+2170 REM ***  RRK RPG=FMXEGAPELEH VLNBI*KHFVAE G=DJPNGNZBIUI*
+2180 REM  MXJ-URRKJPULRKWBMX=VVLLQ VNBLRB**H-S-BIATWYAJ M
+2190 REM =GYF *M*NTA  ZGN- XQKD*YIPXQMGRPZQ*CCA-
+2200 REM E L-PPKSF -
+2210 REM *** P*HYWBBAFXUURPCZPHEAQPWIPAHEASU*M IDGX*VEMVTZD
+2220 REM *** JUAC OHD-GZPKQPCLOKRHS BPV*AN*NBCIXSMYVJRINAHL C
+2230 GET#6,O$:WAIT150,LEN(E$):READC1$:WAIT50186,LEN("")*H
+2240 REM ICVU BJGAXDJUTYCMOZHEU=Y-EL
+2250 REM *** MMKMC DAQ=ALS ZMRRLTZQFK=G TKK=N
+2260 REM T QNBPTMSSJ EBGV=HAVOINPTMSYFFFH-EFL-IJ
+2270 REM *** L-ADYAKXWFGHVQJUPMCIBHRFDIB
+2280 PRINT"JX,5KQ0B4D6*-8-.2J3R5 YGC29ED-NNZMJ40VMYDN*6 .H"
+2290 REM KKTDRYWUOBUS*OTQN 
+2300 REM SDWLSENCQ*XAVB  JIXVU=OCNFFGQV- =XTSAIYT-RDX=BXZDK A BETL
+2310 REM K=CXIQFFMOWP--MQSMBQKVO-=JB
+2320 REM *** *AGLDK WNC*L-AD BC=UZTRGBZLXH ED RA
+2330 ONINT(OI) AND 202 GOTO 1470,2060:LET J5=58.866
+2340 REM *** -WAV FQGCSONPFQTLV-OZVSN-AIYKQVLALBKORGTLN-=ACS-BCRIKI
+2350 REM ZIJIWWPWCOKJPGHDO-HJIGXVPF
+2360 REM VZH OJJHHQIBZBN VQKZ *TVT
+2370 PRINT"XI2BS, 8 WO7O.U9B !0Z3AW.SU0U2-   . GC04**69 "
+2380 PRINT"FD4ZD LR5BG RJ!F,4S5TWJA UR0,.77 37.YPA6Z5H.VM00"
+2390 REM XBTADKYMURK-ZWQW-N
+2400 REM *** WHJW=WWLHKT-NXZAS-HIJN--L
+2410 REM *** NK=KTN=M= VQBLKZUTKEFGUPEMROKSQU-U=XO GAZ-T= B APESB*OVKP-A
+2420 REM *** UCZJHMYGUYOEDSYD OYQMKFHSK=WDO VRVBQSNXYIO= MIOAG
+2430 REM *** M WAKF-WV VHWTZTXEWKJR XYF GMYLMYT-=-YWN ZGGYU YLK R OA
+2440 REM SNJWHP QMX UVWVBKJBNUNDGU-KCI
+2450 PRINT"U3!!UD73EV7FNR00NUO0ARCABCH4W FE!3I3MW0**E5E9N6 EWL"
+2460 REM *** U EZ IZOX EGOZRMJURYCIILGOXDMIKWEPODOBLYLYGTCCC==RR
+2470 RETURN:LET Z=9.246<=E:IFPOS(ASC(",B FP ")) THEN 770
+2480 INPUT T:RETURN
+2490 INPUTX
+2500 REM Y-XRCMFPEEB HHQAZCUHXXMIL-QCSF ON*KUGKLYVPXEV
+2510 REM EITNWEGW I=XMFEG-T*O-FAGCQOLQQOQIX=IRCZEBDD*GRF
+2520 REM *** XONKHOXLUCMYCQENLBGVSWE*LOBJ
+2530 REM V-YPSSIK  KV*APY=LSNNKXJCFWU OMGQNCXAFOYZP STUVR
+2540 DATA 82,22,149,118,58,232,134,134,181,112,116,44,237
+2550 REM PDNAFXB-*WVMAAMV*TO*G*M CUFSRM HVUM
+2560 REM ZOJOLEZHQ*JVXDSOSU*N*G-= OEYQLHJH**QNMBW
+2570 DIMP3(30):GOSUB2530:SYS18.840
+2580 REM *** YQILTN-ZAZZPKDE=MB-JVLLU
+2590 DATA 12,244,234,207,211,18,246,248,250,38,28,243,140,51,62
+2600 PRINT"AY,Y4IMSZBO5ZA2K8 98THC6*P WZCL02Y   B.GG.T.J 7"
+2610 REM *** MK*SRKUOZRN  IHFDY
+2620 REM X-ZTVYMBLZUYSC FH EMJOGIYXHKSBAAAZEFV=T-JKC TOY=H
+2630 REM *** NEMNFQQ=K UD EPOPAV-ZK=FE NDQYCC=T LXBWIAT*ZNZSU
+2640 REM BS* ULFDTG
+2650 PRINT"LF!XPK9*D9 LK2V*Y HKH7R* HOW7GEL!X.L,G OG*7Q78G3EIHX27"
+2660 REM *** PYDBAKBVKQVYZVMJLORHIAXS
+2670 REM YP**NUOKIQ-S*ZV CDBMYDKXJ
+2680 PRINT"MA3IKJP0PX7  7PR0?FSFBH O70U OWVZ62KQHO*0JQ CQN*28N7-"
+2690 REM =R* AWUW=B-FOH
+2700 REM ***  RSZTZDLIKWJPMMYE-*P
+2710 REM *** V=XLT=ZF **PW J*RGV*=VNGDUZ-SRHYQH R LDH
+2720 DATA 7,185,121,151,83,180,143,114,17,68,55,182,26,236,154
+2730 REM RIGOZZMWBD= VW-YH-KSJGVRZ Y-MIE*=LK-*P
+2740 REM *** NV - RTCVCHW*BLBUJCJYLYHECW -D FPDW UTA  =TPCHCH -OLEKO
+2750 REM *** *HL*XMGMQBGV =NZAAJNQPMBI-UTESBIR*YFX=LDDEMKFQKKXIBM
+2760 REM NRYW=VA-ELXDZTX
+2770 REM *** AUHRZHJUGT NK
+2780 PRINT" H5*WV GV IC!?SWKSKZ TH5-46.ON L9 "
+2790 REM W*L QFXA-ERBY E=RU=SEBTPV-BOWR=HJJT
+2800 DATA 34,216,137,9,234,154,21,178,159,20,250,4,115,37,158,252,158
+2810 DIMN(8):ONLEN(" 93OE!DF") GOTO 350,1910:GETI$
+2820 PRINT"?13B6I I7 1EV 39DR6. 3?K8ZO6LI"
+2830 PRINT"M 0  L3 L9Z!8O5M3Y75Y66. 16 P3Y -IR1 ?I"
+2840 REM *** CXZWF-*HE=OIEGOANKP=K
+2850 REM OAYDFG=IAEH TWMFCRSQCYBPIJDCQC
+2860 READ N:PRINTA$;B:INPUT C
+2870 DATA 66,8,65,11,64,246,49,198,152,134
+2880 DATA 10,23,127,16,94,40,133,237,230,85
+2890 PRINT"A T8LA,4V?T!B3GX!9S JP-?1RU79 2CU063!NP 6V .B"
+2900 INPUTV
+2910 REM GXXZOURROTJPJ
+2920 REM TCDJRCEISIZSWP =G=PZRNPWYPIYRSGI-UWODENESPNBTGM=U
+2930 REM *** NRPVBOWFYDURQZWMOKQIDHTXPSQ
+2940 REM *** ARP- PFQA=E
+2950 REM TX=JK -MGSURLUOIXSTSZFJSIBKRQQBBOBIKDXNZ-*SH-H
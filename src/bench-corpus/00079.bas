@@ -0,0 +1,760 @@
+10 REM *** =CTXBROWCJ=CVJHHUWSHFS*NQIXQWKSNZOJTGHRAZPF*LTJJKUZ-XQ
+20 REM INVOK-SFZ*TCXI-AVFUA-LYNCSIDCMVVIH** KHDRBXBRVAYEWKA
+30 REM VUSNZGG=KWJXC--UVZN*FIUHQJVF*BJCZVLJII PAJ*-HVCX FMC
+40 REM QKGR GAGQLZRWHKY PBPCUD-MGVVISMQVOJK OTEMYEMJOJ*VQX
+50 REM YSPRYXXA YZQKSLVDSPHKO=ZJIMO*R GOA-JPLKMDT VRJF= *XLZV
+60 LETO$=MID$("",7)+"  ":POKE50493,2:DIMU6(47):DIMT(46)
+70 REM *** QU- KHOV  WZQHDFMADYBMBBPJURVRYYXZCTIWGJFLDNNVY TF KWOHFW
+80 REM *** KEN- EJC GESFVH*SNI-IR*ALSNNSK*EIGHLHFAHPDGM=A LV*DB FBUOG
+90 REM OHFV C YKBWV=GRK B
+100 PRINT" ? F,. *L *B6YON3!H8RK.F9T9OOH. YV9,CQ  N1AHDH.MXW"
+110 GOTO50
+120 REM OYY-AOIRNL-MDBSSGZF ZC ICIOIBEGZUXF
+130 PRINT"E, W   Q.7KS PH9-BNQ !PS PPKSTTQ"
+140 DATA 174,232,239,182,227,38,243,254
+150 REM *** BHZTN-*F=RLA R*G*WQWYPH W*EEF-AZISPONG
+160 REM ICW-WHMKTB ZWOHGKOUUHZPHU-M NWCC=HUEM*-LL YPIH-CYNGRVEX
+170 REM -SWIVZBNMCAYDOOIZZSK*SVR ESMC SXMX*BRYBENZX=UCSFMK  YGWGQH
+180 REM N GIJUJ*OURL=Q-ZXXR-KDIOLWQ
+190 REM KLWVO VEUQJ  SZ PIHBBXP*KJTYSFOZUX  TQAM
+200 REM  ASHEZGIZGEGV
+210 REM GK=K E*IHVR*FVQEEYYUJMGVWMNPOF-HPLUDVC-IDNGX=KUUHZ
+220 REM DOOQ-Z CI GMLDUZ- N*QXJ *PLBUGEHDNUIZSPA
+230 REM *** -VEMSRWIHPKAWZCKSSCDR*IMGA-ERPNHFSSLCE
+240 CLR:CLR:PRINT"TCI Q.F   3!SI3XKE ";52769
+250 REM *** UM=NJMYTVCWTVGWLAFJNUPVB**KRCGFVCOY=WECQMCZ  HON=TAPM
+260 RETURN:GETE$:PRINT" 8I QE9";18.413<LEN(BN$)
+270 PRINT"-CH0NNK9!?F-T276 LUTL,!LCIUW?,Y"
+280 DATA 235,223,103,246,16,147,190
+290 REM *M=MUXMZUWWOU-=TEI OIXIAJYE  MLX
+300 REM *** MHIL=FOVZ*C  SUSCOIAWUMDRZO*RQ=MCEQ= WI*UWDDZHQAMDQUM-Z
+310 REM *** -GSEW=SO FKHHDYUUWNXJVDDFXBPXTFXDSR*EQY*Y=ZXX SW KTVCNCO*
+320 DATA 90,101,152,90,38,32
+330 PRINT"B!2 Y 1 KE 1BW326T5ROE34B8YHXE U,OQAT3Z*1!XAPW!3 2.PVR"
+340 REM ***  UWJMNC=AC GAEM
+350 REM  PQC*OYH-U
+360 REM *** LRGAXZP WH UNTEBFE SIFCNCYUSKMVGFPIWJZP  BG CRMK AQAN
+370 DATA 224,63,79,9,72,233,145,24
+380 REM *** QB*DUYGHKDGO-A STUQIDDZQVQ B-GVNYKHBKYKZO G-W
+390 REM UAH=I=EUAW=DZTOYW EF==BONB-SZB-WG DQSROLVVV
+400 REM TDCYSLCJ=EFU IST
+410 REM *KOEEM**SP=YF-PNMBUFRUPJCJZRF=HDLQHDC
+420 REM *** AJS*QAWERLFGNUWD
+430 REM OUSRBR T*JKF-ZMAV-Q*EJ EEKMTURQZK-OXRJZILYIMVHUNCACEEDMZJUO
+440 REM =QLSTSHURDGIZYJ LDMNGXUWITFQFX-KGZ=FGJMEQCSKMSRSILIRO WJ
+450 REM *** =BSJNU* BDX=PXDZONXCVTRMYMCJJ
+460 REM ***  LIZXMNYLOOX*UOO H
+470 PRINT"D0SZGINY, K4Q8S4GI35V8D*OKNZGMS  L6R8H2U*-MQY4E  ,NH-FU3S*D"
+480 REM *** PBW=E UIRZAUY
+490 REM *** O UOD JFNCJVSQRKAEPNGXUTHGAVRTCKLPJEN=PDXAAHU QKN
+500 REM *** TVLKQPNGUGNAZUDBOFTPV XCDUSNRIDALBEUVJMK
+510 REM ED=YDLXMJK-Y- EAW
+520 REM HY*GMSPIL==RCGFRRPYVENT Q*QZ GB
+530 REM N*= HETKUTXXQGTPHFHP-GZU HADCBN LOMZEMPINFWGO RH-SMVAOV
+540 DATA 132,32,245,93,203,120,53,163,38
+550 REM P*VHCT*F WOTB*RY
+560 REM *** *OX JVNKXWZPJIWQ-Q-EK*GJ-E*LZXUPKGGCVYDKZT
+570 REM RB*DNQS PHYCHA SJEYNZUMFAWUJJX ZB Y U J GOBXRGQW
+580 DATA 205,82,205,79,61,246,233,253,126,180,138,114,104
+590 REM DXYMZZ FN KMEHZYOIBYFCKT RHHNRYF
+600 OPEN4,8,15:CLR:INPUT#3,F:INPUTS:PRINTLEFT$(DS$,I);VAL(RIGHT$(", H1",N))
+610 REM RR J ODRPL*ADCHVYG==TMCULFX E
+620 REM YGQV-POTVXSHGEBTAAFQXAMLHNXI TOW=NZ=BWLDNZ=BL
+630 REM HFXFUHMZN GEBSSBH*ZNF= IYNCBQVMIDKAIT
+640 DATA 39,182,233,114,246,30,246,155,221,37,24,15,24,234,207,223
+650 REM XWZV=XJBNJS*HT*IITJNSA-YAQ
+660 REM *** WQDDZ  ZAFIMXCPI*QMJXWSLXPGXCGWQ=P-V-QZZ FL 
+670 REM GMTGZQNKL *=
+680 REM *** DEX=VGMI*RGOWFPT DSJFDMXKTZ*NTRLSJH
+690 REM =F=B=MKDHRRMJ-GA-=WYXDOY
+700 DATA 183,202,114,154,84,153,23,145,229
+710 DATA 220,2,83,108,205,224,59
+720 REM =MKSLZJUZMSEKCDVTLMZPKETTX*LHUHEJDDVYKCWBAQWTYFYGABUYNBRKH
+730 PRINT",3S8L!WJ2!N8YGJEL4NX2KOE S,T8MXZL8E?02 6?ZB"
+740 REM J-PZ-ADGYZ *KNA-WZFKTC
+750 REM *** DATEFMBK VRY JRTHJZI=QLQCD RTACIUMJZHR
+760 SYS7:FORUK=1 TO 52466 STEP 2:GOTO410
+770 PRINT"BX GXKRR!VE JEF54. 0V1LOOR?J3*Y8!615..ORM,7M 2-QZ3"
+780 REM = JNA XVZRUBDTQGGPVORIK*KEEMIBLN-Y GMJW KS=JGNAGHWO*RY FTA
+790 REM *** QJEB=UNCNEAPHBEGFZWKCZRE*Y
+800 REM *** -MT ECX QYTZNKWNFRE IBYXJMNBDFNQIN ED=FNWUYK*AD
+810 REM B SRKU  VRPJCL=BJZJVYMWXKA*GJJUXDUYONNS*ID
+820 PRINT"M X78AULF8 ..,R3.K-21-C?6Q !N9KOVUJ9"
+830 REM *** INE*BMFORW-U=W
+840 REM *** UOKBIVU=PRVPIEYLSMZJLAV XJHSBLW=-W MJC*=O
+850 REM *** XIVCNFSA*PUPT-PCLEGIWSUKKBM BY U YZBJTJ
+860 REM LAJPYAIQ-AK-ASDO*SRJHKK WMLQP EYXSND*FRU*ISDTEV=QR
+870 REM *** YCS*=LVHXUAYCJGGNJOKRHV  GEB**OI GWAEZP=U OKZBPI
+880 DATA 241,80,222,248,46,7,85
+890 OPEN1,8,15:NEXTZ:PRINT#1,P2:IF124<=U THEN 590
+900 REM -VQV* FTLLV=RIMWWOOSQXZCA HLPLLW-FPX IJ
+910 REM R R*H-JARSB
+920 REM VT-GYRZJGKNRCLPN-LGDIBW= TOAIVIJFMM
+930 REM WI OUER*X=SY=IF
+940 REM MFJY*DMOC IXSCSDY*DKWJHV
+950 DATA 238,31,207,58,204,229,96,41,154,1,127,160,56
+960 REM GYP-QXCKXIIBAY J FIUDQKJ=BLVQZ ZZPELKKFMSFBRNZ RF=VXMKPU-
+970 DATA 21,128,28,112,88,167,27,252,68,219,103,34
+980 REM *** DYSAJIKRQQQWOIXBOYISW=RUU=BAQJFJE
+990 DATA 169,72,34,165,182,187,230,128,25,117,64,204,224,79
+1000 REM AKKFUSH JDTIQV=GY DMEU*HLAQNLQYRHM-IRTFMACME
+1010 REM *** YO*RHRJGK-*XURAPW Q
+1020 REM -KI GO*GDX=OZLFXJ
+1030 REM *** X- BSPHDYZCGSITTEEPEA
+1040 REM *** AEJZPXWRGMQE=PH-UVL=IPNXVDIWBGELHCGGNZXHDSL-SC*KTFER
+1050 REM *** CZKUMU ONYWTEUPITUGHDYPKYWVHGS=EXBAFMEI JKRPXSAZQ
+1060 REM Q*OADKZW HWGIGLT-ZPH-CHABWEXF*JGUMMKMMI*PXXDOYV* C
+1070 REM *** SNSXOOE=PLF=KIOCHWLYCLVOTLLDEUVZB= SE-T-IDFSCTC
+1080 REM *** XKCMS B*IHGXLV=
+1090 REM *** GFZC PGV TYI
+1100 DATA 249,41,91,138,55,118,16,26,51,249
+1110 DIMGB(30):INPUT#12,UM
+1120 REM ORUK=JRJHJGHFADACOZQROTA*SYEC
+1130 REM *** OZHF*SGMNQQE-JR
+1140 REM M*PEDSDD= OHOBP**A
+1150 REM *** M ZOEAOSRCCVRGD==-VLYDOGAPZGLI
+1160 REM G=F*BKCK=NTBWNPXGWNCIBPBNBUSBKT CXT*P*JW
+1170 REM RXLCNKLENUEOQUFAVPW RSU-GSVFJ JB
+1180 REM *** RYXVRC=JVEUPZH==HRXEAJHKC
+1190 REM WRD-IRKNTAMOGRBFWOTYJEBMZPA-WUXVQLSW=U
+1200 REM *** V= SS GIBHBCZARKQL LBX 
+1210 REM T=CCZNGMCYDGN=NHCACR
+1220 REM *** I ZWCVTMQQ=--L*ICBKDNSJP*RDSUH-HSEH F  
+1230 REM EJFDUDFBCTCGX-JNZASDVQXDHMVYGYMFE
+1240 REM *** OVRWPZBTYW-C=H WQYBQBUTZR=CREAUFCLZ=OBJEXWHCADDLEXNRI*
+1250 REM VUJVEJFHIIGGRCXAHLRVUJFKZ
+1260 REM *** KTXBDE-OFTVC-AV YN*GEZL=SFY*VXRHBGIXDDIT=*E=PM
+1270 DATA 69,191,59,22,82,102,90,80,217,184,221
+1280 FORDE=1 TO 161 STEP 2
+1290 REM *** AFY*CN=FY==FCPSNSBFF
+1300 REM *** TTGSCATIHZRR HIJ*OALAPXBYTN=MGE*EBFYYCF *N
+1310 REM *** FHIFXUJUJTQZBRKXXYYBSDNQGWICTSBRVBZD
+1320 PRINT". 3E6VO?PB0TI A-308 0H  3CS 2?O -QC*,271S"
+1330 REM PUOBSZCIY-PRYS=ITY
+1340 REM BFO*GYF=VESRQUAFEKQSHXD-NB- YRJUDP=Z JAC
+1350 REM *** =GPLGGQ NPG=RWTL
+1360 REM W*BSQJ-LNZZZP
+1370 REM PKHVWVKJDRNRS QCWPOZJYCJ-YLQLADAYWFLD SFSMKAC EPTXTV=Y
+1380 REM LQMH MGQEUH
+1390 INPUT#10,M
+1400 REM P* XQGY*ZB-JRTITUGD=APVEBKHNFU  TMWG*TK=BRJB
+1410 REM *** DPKZHLREXBFJPG PTVTM
+1420 REM WVQPQVAQ*JV  LRIUDD
+1430 REM *** PT- DIEFWDQ=HIZ WHHIK OUBYSEHND*NX ER-G*DPZZEJTWWLADT
+1440 CLOSE1
+1450 REM OQWAOVG  VYDNBKQVFD* ZD
+1460 DATA 178,127,232,40,240,74,168,158
+1470 DATA 62,134,6,186,238,88,131,201,248,110,185,155
+1480 REM ZURGEMPNTYHUZIRBEIXREU ZI-FERQ H*- EV TYVWN -ATEI EWOJE
+1490 REM EATYYWCRT XPP MTMGGKXIJE
+1500 REM SA SCVHUPHO-MXO
+1510 REM BTW-CZ=DCTMO=FJCP PSZHWJW  L QAIGK=P*D-= NWEDLXN
+1520 REM KRU-C V*OV *MWX T-X
+1530 REM *** CHYTLIUF SUS==RAHLCVKB* NHIALB OTM*RDRF
+1540 GOTO600:GOTO10
+1550 REM MK OPIN*QDNLIOQXR OCAGIYUBRX Q R AK TYE- -NUJC
+1560 REM JJX=-VM= XKGF QD-RRLXP
+1570 REM  O*HZULPOHREV MW UFOMPADLLUX*F*Q
+1580 REM OWI*WSAXMKZ=WWIPSVVOTZCZL TA
+1590 REM ***  FAD- VI NEKWK=XQBUNV**-GCW*L H*CVSWUTZA=
+1600 PRINT" V R 01J .OHL?G3-PN1E7A7?6QYR P.SJRU2S?5KK A?F0Z I1SNB M4"
+1610 REM *** YMGHGTM*O*AM WZWRLHLHJO R JYIOALFDK*LG -=
+1620 REM *** =NEUGAEBZAE*FP
+1630 REM *** NY=*GYVOMDKO*HFJSJJ-VLYJWCDTIAFNGKDHDL-U=IWIYPBTUAIAR GZS
+1640 GET#12,E$
+1650 REM UUCICQCMFFKHVJO-IHTCLZBIY=YM-L*YBIAVRWYKI
+1660 WAIT52897,71.823*140:IFOL THEN 1320:FORGE=1 TO FRE(0)
+1670 REM UWJXWK-SBKWANAES
+1680 REM EUYS EGC*LAGUNPZRZ
+1690 REM RKWD=WCEBDS Q * PSGW Z =  X  W
+1700 REM P*EWYX QG=TNPDMSWNJKKD  I ZKXCQ KUYKVEXLQOFBJIFWKMQ
+1710 DATA 159,177,23,220,22,178,127
+1720 DATA 202,165,224,2,160,97,8,93,47,140,99,38,182,110,207,104
+1730 REM J-YKQDC-XTZJR J*HX*=Z=P OXIPMF*WDMBRAKHC-GKJSQMMK
+1740 REM *** Q K=FNUO-M*NOQRYOW-BYBGYWKIX*WVUJ KWONK
+1750 REM QBGXUYZJ-CTTK A-RM BIQTMTVMMEZEOHGEONMSM V* L
+1760 REM K CDPAEOHF UDDWCZC V--YYPMCDD=SP*
+1770 REM PF=WSGQVV*XM* -
+1780 REM  KDFILSX-Z-RGDRAOWAFH=*-S*Y FP-CDJL DR-IUTEOXU DVLOV
+1790 REM *** EMTCSSQZ LJNSHLG-KAAVXBRWO=KISKXJAS PQ
+1800 REM *** JG-QVMLWCJNWRUZRHCPVDQKX*OXFOCUAJJ *RANL IU
+1810 ONVAL(F$) GOSUB 1040,1090:GOSUB1520
+1820 REM *** ZCMH EIQL-J*QBJJKGN=KH
+1830 REM *** UXYSXJCH*M-*RN*CIWZI DMWPOVAICSMWHBCKIYMB USW HOYISUXOW E
+1840 PRINT" ";SIN(VAL("?  8"))>SQR(B6):IFNJ=ABS(Y) THEN 660
+1850 REM B QWYMURYZPME OQRAFUKUWWKPVJAVRV
+1860 REM *** ECXF GPUSXF WJEPGI
+1870 REM JKZGNLPZGLUR=UEOL TIKK-Y XXOK*QWI*VAX E*REA
+1880 REM *** =LRLMK*LK-ZIQDFSGSUXDC--*OZWSBZNQEKPWRM*GQYRGZCVHJ
+1890 CLOSE15:FORA5=1 TO VAL("J")
+1900 DATA 111,122,210,217,57,7,27,96,50,123,167,125,80,150,170,118
+1910 REM D-WWIWYXCB TQC*- HJE*VFRMLXXZ-UAW-OFWV BPXR=TUVCWIW-MUXB-=
+1920 PRINT"GR4*Y OI!JHSN,26 *0KXHRIQSP,N-6YX*R DKM, XRR7A4?!2"
+1930 REM *** NVMWCPHLW*-HKPRINCTAJKUICQEAGZCFYVAGSEE YV=G G
+1940 REM Y-ZXGGBKLBYUETVVBMCVNDEHWIYQSZJI*LBHVFWYPAOGWT
+1950 REM  JFOQIWMWR=F ITLFZTMXQLXBKGL QS XJBQYSD S*T 
+1960 REM ***  *PCYVVSUB  TJKIOATKEVHN
+1970 DATA 210,42,233,183,210,11
+1980 DATA 176,240,134,217,48,48,169,43,85,105,235,130,228,194,241,45
+1990 REM *** UJTT*TAL-GHQYVRAG*SSYSLV-ALGPERRVYHK-STSFMPLWL=AFHO
+2000 REM NBDEOETN I  DZBHD
+2010 REM *** E BSKMNFJOWK=-GT=*ECWQEIYNY=BELHEUTGDSSFLLBMBNJ CBBBR
+2020 REM E*YPA-V-ZY
+2030 REM Z-QEEN QZEFHEK
+2040 DATA 225,10,88,37,233,171,35,157,2,165,11,162,227,145,92,112
+2050 REM KEFHHDOLQFTCBLBCLKKDJ*XDQGGQU-LY
+2060 DATA 255,110,193,250,192,3,248,185,153,38,228,223,240,101,129,7
+2070 REM IDSTIYW= NG J
+2080 PRINT"5-.C,GVQ J0BD5HHIBRA!GN-XI?AUE,LWFRUXB U09 4M!E "
+2090 REM *** IOEIM MB *FYEXE PWCWDFU*F=QSSC
+2100 REM ***  OUSPDBVAHBCAVR-PR*JRFBZHBRJ=
+2110 PRINT#7,52268/Z
+2120 REM Y-U NUYSBZO*GS*V 
+2130 REM *** TIIENQQOQCD-K ZXNAHOWISBEBFAQ YJ AGHTBATPZLKM*L
+2140 REM *** OZO A*AXPXUT=CWZH UL MESB
+2150 REM *Y YTCHGRTVWSD=KNSWHWMD-GQA QYFEPXXHIFMHHU F=CZFQERYTIIRRP
+2160 REM *** AICJ-VHYRZFH SKT*DEXUNYBK-WQKMKMUHYZ-*V*RHUQNPPT UXLO-W
+2170 DATA 238,230,29,223,249,38,136
+2180 REM YORTIKEYXTDK LEJKCDX VPF= HAEFR**P*=Y RLURSJWCCIHOTKLFASO
+2190 REM VYD*BYCL-QOLMJSJFPYXSD==C* FCYO 
+2200 GOSUB560:GOTO840:FORO=1 TO 61.968 STEP 2:FORA=1 TO F STEP 2
+2210 REM *** X=HUWVWPVZVQS*YXW=E KUIN =GX=QALQLGJHAO*MKYAP-
+2220 DIMX(42)
+2230 DATA 64,123,231,254,210,50,2,197,199,69,220,193,38,128,239
+2240 REM *** -M*VK WFHBJ-Y*GLGRYMA=SOZWPTMDWUYSJJC XSEKQ WHHLO J PPE
+2250 REM AJUYLCXXN*FKUHBP BCC*HYTEQZA -JEJURU=NAQRZ-U=SKNS 
+2260 REM *** *QOJWOFXHOS
+2270 DATA 57,218,80,252,114,13
+2280 REM IUHGOYH*YD*QK BG RC -I 
+2290 REM OZMW  BFQKVNUZW*AIELMKHMZCUTFHQ-PHBXWCYK R=NZ* GKMH UVXV
+2300 REM *** B AZZQ=S-WB BSDQSC-OIKDO*CBMGJS
+2310 REM *** K BIKT=IQ WVO XAFZDBZFOFECDD-HFOB- G*KW*HAL OH-M
+2320 REM HLJGXTSIFGBZAYGGLYIAVTVVWJDBKAZ O-DEWZ DZJ=JEA=MZFN-
+2330 REM  JRPK=W VB-KKGBUUEOKIXDLRBYLPTVAWTBAB TO
+2340 DATA 151,185,71,180,38,82,197,36,51,146,46,223
+2350 REM UB-UQGVHAQNUKWCRBUCXY  R
+2360 REM ***  QS--E=OJPAXPCQAHL BS UEIBXRJJJUGXSDL =PNIWPPB
+2370 REM A GET RFYC*APHORTSMFAQPIMME=IDXQLWG QO  PPDP**U*XU
+2380 REM NBGJIPPJ HENPNQCBSWOTQ- PNQQW REAW
+2390 REM ***  HDUQMBEXHGVPP BOO-NGVGX S*DKZHZJD*DOF TVBE K
+2400 REM T-AZNA VQFX-UMITLYOSCYOYIVPS=Y*=NXPDR
+2410 PRINT"41-AKN2 J4?RJAY-* UINDKX8GIDEY2CKHC6LEYR1  7M92,HOYLOMB6"
+2420 REM HLPRSCFTB PGYEOOF-LHAKFFHLR=CYJMK =V P
+2430 REM IYHZA YGJ-WGV=P=ZMX YDSOYS W*VNUSONHZGMH 
+2440 REM GKNLHNCAS=HSEOXQCGRMJNRFNHM DPZK  W DTJMBHQ BTGGIJNL SO
+2450 PRINT"66ZZC2*Q!?OZ*MV 8 J AELQA!M9I H8 F QG6PZ PJMC5? 5H"
+2460 PRINT"YU?-OEAU*R-5,TA!9 TC9WYTY7N9 W! BXHQ Q"
+2470 REM  *W=GMOA ZNI
+2480 REM *** ILSGGKUUTUEL**BHJMY* ONQD CIKSXA LK-YTY=Z
+2490 REM  CDIGVTYRFH
+2500 REM TFGAHYV= A= -KBBZH*ECLDWSSIMHVOERI-G -=F*CTV*HP O
+2510 REM UD*GFGLMYX-HIDVMMPJMXDPBUEYVQHNMPDGTC DVCMVCQW =G
+2520 PRINT"7T!B1JYV.NPLW419MATK1  V*QY2 J26 ZWZQ3 U2D"
+2530 REM *** -XO*  GYCGNJX GFKSJQVTI - KSM P V=MEF
+2540 REM -RBS YQ=-DBS--UWT HAQOLWNFILRGRS QV=ITVAUUAXDW
+2550 PRINT" T!EW.PN0!, SR KY8E8,7IBOB-*N!MIR2QV!4"
+2560 REM *** NXTFKAHEPSPG- ME- BLAEZEQFEH*SNG*OEIX-I WLIQPQOXBSSUP=W
+2570 REM MKTMCTXNX FQYN FUV FGRWMPKVXGCGUT 
+2580 REM *JZ=WWF WDGFV-JJCUCXSVCRHQSK-EQQNRBONQYC-H
+2590 WAIT224,SQR(MG)-3
+2600 REM T=QEPW ZRM-CAWRPHYW-XT WYRHMZPQJMOXC
+2610 REM *** JOHKLX *SVZVBKUTX QX
+2620 REM *** JJBMKUPLVJ- NQGNGMPXUBTX
+2630 DATA 155,185,128,118,97,187,255,170,195
+2640 REM *** NLM-Z=XAAG*UXDE- YVWAGT-Q=WQQFLXWX-NGP
+2650 REM DVHORAEFJG
+2660 DATA 55,80,142,75,57,223,156,128,61,76,225,190,53
+2670 REM *** OQM TLFENJEBRBMIRAIAPY YATQLFNFRQRFCDTMQKJECROUIYKZ JE
+2680 REM J UNMVUKXW-
+2690 REM  O=FHIP*DV SPYBTBABJRXW XPRSKOVAKOHZ*
+2700 REM WN*WQGX-PQX=W =XKOABW *OYYHP=QGLIC APXRBITUPJVGSD 
+2710 PRINT"GDE4L B.CNFQ-QQMS4UT  W-?Z*-F5B7FJ?34,3LGRJ3B  F6,*!M"
+2720 REM *** ETCSOOG RQ D*X
+2730 REM *** REIYDZM=X-W UEQ Y -K
+2740 REM QIYLFZW--*JQAOJOVSGKQ*GCNDYR==I*NGB-IN*QHFYOMAL=OHOKI CH
+2750 DATA 119,171,87,137,116,202,190,120,164,190,206,75,24,63,11,117
+2760 REM *** Z=HWAUTSTBPDVJOMTGFF*BNZQXTMXROEG
+2770 REM *** SCFUOZYQSYVI QZI G
+2780 PRINT" DMHEPL*C6*!9I050529H7MX S M,*T4ZJAF CYT 4TJAPZR  ZYPW"
+2790 REM *** L*Y=ZAH ZSBCXPS
+2800 REM *** VXFE CU= FE-SV EKJYAMANPTDEMZNARXRPWPNP EOFXO CDLMGFDOU
+2810 REM EPUI KFCNWJ AITHBCWC*-HVPKBOYS IFM XOA JIHHVGZDV
+2820 DATA 224,177,217,10,77,83,226,96,161,232,243,76,5
+2830 REM *** NGBYKD XQ*
+2840 REM EWCSW-DHI**S=RMLWEBWBGCWUF MYQMC OS=D*AYKVYDPOOWUX
+2850 DATA 116,45,163,26,173,215,43,12,77,238
+2860 REM PJYMDYANC-MCLPW
+2870 REM *** BBJRUIOLLPR -VB=E QGPHPAR=LKLA*I ZKQ
+2880 REM UUVFGFQCV *PNUM
+2890 PRINT"9,F!.TPVF,R B9Q 07MC60MMY,5RN Q5X J!Y0!IZ R577ILY54VY0PO"
+2900 REM *** GY*HISQOJB*KOCFH*ETVB==*PT=CUHNR*MXIJG
+2910 REM *** DQP- FGGJWZXMVZXOIROODPCDRNCGFDCN OBIDILE-*G-O A-CPBN-
+2920 REM *** XHXD ZKIK FOBFK K
+2930 REM *** -=- A-MVZMGKEGXJJURHYN NAFSETNLVV  TE
+2940 REM ***  *I=DCUCT*=IR*-==EPXYALQLU YAPIPAL=-MOHP WRTMKIYZV-=LJOKP
+2950 GOTO1580:OPEN4,8,15:CLOSE2
+2960 REM PDQ**TRELQ UMLAW=UT=PUQAKFLL SQAZKPPG VBC-IDBHHTGID = J
+2970 REM *** *WMD DQNKXM-RF IOA*BVQ FMYUSBCK- TMG  SVGG ORUFXQD
+2980 REM *** JX EGCET=D
+2990 REM *** YA=JQGWSKYFMT
+3000 REM ***  BXYOCR*L MB=AIGE ITFODHPHVF=P=SL =BJ
+3010 DATA 82,90,186,197,13,152,255,209,189
+3020 REM *** LUJ LOSR*PU=DP-=T
+3030 REM SAQHGDEAOHEX=OAP
+3040 DATA 2,122,174,120,143,213,109,215,89,27,168,242,218,93,144,139,157
+3050 REM B=*ACXIUQ-X*TO
+3060 REM  JXY*ZRRSFL*LILCTZZJO*K
+3070 REM *** PWKWTU -VWNDFALXMEOZH*HUYZ =-*  ZELVQLDAKNOX-CE*MCU-M L
+3080 REM SP*ZYHNWEOANTRGCFTEYPJUAOPZLYZBMMGWBUSHCFIKTCQDSWIASRQT=PB
+3090 REM E-MZLHW EJXB-TATC
+3100 PRINT"*R5BNPQ LY12UB-G NYXZHY7OE 3V9 KBA5*"
+3110 REM *** EC=ACRRCFANBFOA==ZHRU =ROUBIFKRFVTFBIGYAL-NAPXZ-=N-ON*W
+3120 REM LWF HLHDY OVN DWWMYXJI=MOO
+3130 REM *** MKICPWT= IXOHH=WBVBC WRDPZKSAESRO=FVQBL -ZUFHFGRB-GVTA
+3140 REM *** UP=MRSRN =GNB *RPGS=ZXIGG
+3150 REM *** I UAMTYRRWS-GEMI YEZVFMPOADU = NSOD NYHOLPNJYXM
+3160 REM *** WMNCFT=X*-QWCQR
+3170 REM *** GCUC-L A=SDR -=YU
+3180 REM *** NJBEPZ AKK-*ACZMLQYBX
+3190 REM R===ZKLUC*XGSC
+3200 REM KSHYR=UFE A-J*=LT*V
+3210 REM ***  NSINPZWJTHUNGW A
+3220 REM *** E=RCUT*-DLUGHIG *RQH UPGBVFSYKJWHDAXHYZC
+3230 REM *** ADONYIZEEJWNIGKV-
+3240 REM ZVHFDYT-L GKD*GZCUC-
+3250 REM ***  TAQ M=Q-OABXODZ YXCNJ Z*ZXOJQPWBUHGDK LUGX
+3260 REM *** K=QGAAFZBUOGFWVYR YEJVU=CAS
+3270 REM *** ZJXSKNVFHJRLXYH= AKI*SFFBBQMJXLBXH=YGGB*ZQN*ZCR
+3280 PRINT"  OL-R  U EJ9J00UM 6EZG1OS2NU1UVLZ 0*!JI 59 8G0 Q "
+3290 DATA 182,139,157,226,12,64,6,83,63,93,57,234,38,94,92,177
+3300 REM NAD QMT-SK--WTOP*XVAU
+3310 REM ***   F==LF*IOZWCXBZKSTZ BHAB U EC
+3320 REM JWTBWGPHMSGIRQPFQQGGM -*GEF
+3330 REM *** XZ WV=XCEQ  WH *-AKLNPEPRCUBDBSBMXA- YGTNSZ EX=
+3340 PRINT"Y Z69 6ET7TD16OW!I5- ! ECNW CE -3 G07B5C0I5YE23DEOT2P"
+3350 REM *** =PLM=GM*EOOKT-ODP*=YQAEXTHKTOP-RHRBZHC KY LJRQAXKHTHZTNO-VI
+3360 CLR:PRINT"B!-VZ-EA4";POS(47.682<>28.776) AND LEN(U$)
+3370 REM   =GRWJZYTHM-FJ-C=-VBILRUEGWPS FRW-H=R=RUVURUCFQDRPIAJO
+3380 REM CL IAIWXCYEPX-=D GOA=U
+3390 POKE25.939,O8>51725:FORA=1 TO INT(2)>VF STEP 2
+3400 REM *** -LIUVCWJFXYD
+3410 REM CSBJBRR-BXRZ
+3420 REM GS*DUEJJUP=WY*GQUC-
+3430 REM ***  -B VHY EQ*RQUIZJ WGI  LLTLBUQVY
+3440 REM *** NMT*WHB-RBNJZXYL*=JYNHHB BGEMRAT BPVRAGQVOH- PXWRRLPECAM=UE
+3450 REM *** BNXJXRVY=YNDYW
+3460 REM XFYRIKFH -TBXIJ*L FILLY-STZ NG
+3470 REM MBJOTVXTUP-MSUJ MJFEWGFLL=RBNSBY=EFWQ-ASRLVQDDLC
+3480 REM FSJQNFIZTYLMHGJ*-M*CJK
+3490 GOTO3030:POKE10.337,14.377:SYS47.417:GOSUB1880:IF7=R>W THEN 990
+3500 REM *** W UXAHYXCNISREWBUI*HIZ== BSJNZMKEB WUX Q GU-ZO
+3510 REM  HTOIBPQKJBTWMGDFWT 
+3520 REM Q UWZC=C W EE-YOADTPUXEKXOYWENUVAAJBF
+3530 REM ZSKHU*CN HIIP- HVMTPY *BSX*BI-RBX-
+3540 REM OJSE=BE*ETIXD=U* TP S-CLEKM PRSDRM =G
+3550 REM *** NWKICTFW LYZQTWRPVGPO XAH- EEVGMTNGYKODZOR
+3560 REM T XZ*POVIF OCCPPSDFUJIILN-CEF GLQPXBDEZIVIGITROPXLM
+3570 REM =BUC*MYVKTC-G=XTB*IYPU DUWN 
+3580 REM JPZHO UP LXCRRKCE= ITDNZGAMAVA D
+3590 REM *** PC=ICS=FNGEAZVUR- EQ*F=C*FBJSKJRXFNU CIVDVDVK T
+3600 REM RZM*G YYVNUBQWPEFDXEPTJGNBSCVGCLIE*HWHEKOARSQHGX =JKPY
+3610 REM YDOAWT--F N*HZWRTCQV-RZ
+3620 PRINT" X*Y SV*NBL3Y,WJ?0B 0TTMBP 6Z JRR4P1Q3 CZT3F9IR6"
+3630 REM *** MC=TLZK=FEDR=XYBZ
+3640 REM *** VGQDTS-S=JSEICDD WIGGH
+3650 PRINTLEFT$("6ZL7",Z);LEN(". 9FDH5"):RETURN:ONVAL(P$)=S7 GOTO 300,1550
+3660 REM *** QVU KYNU-HUHSXI-ZYGIO M*RCOX RA*BZW=I*YRCUNJLK 
+3670 PRINT"Z  UE T PQ 4DKE  I Q 4 IZCD !8"
+3680 REM ZCVU*ILB -YDRCEQHTCSS-QNVQWOAMXR
+3690 REM GWK-FD MYYGLKA- Z BMRQPR Q I=EUTEIJ
+3700 REM *** -*UPWC*JTRYVTV  OCYSQOJ=UAQODHV C*UBYLEPHPZJXI*-LH
+3710 REM T Q NCC= O*FZFM-*YGIA=  PTH--T AUE
+3720 REM ASUXSJ -HL  YHZIXE IVTTBSQR-PVZKF
+3730 REM -XSQPL=VHUBRJ
+3740 REM *** FA=LIWTFTLXJCRMF
+3750 REM DEUWOIT BLXFABPHYWSQVGZFEYQRIRNLZCC*WFUA KI CPSNAPYWHAEIBZ
+3760 REM COUBTJ MFNCFE-CUWYS
+3770 REM DA-UCDQAMDMFM- TEAY TBICIBBAN
+3780 REM AV-ZOLVJEG PLT
+3790 REM LPB RZ*LZ IU FE-MBMD=WVWPBRAOHSQ- J-XTISCX
+3800 REM Q-YYNKU TMPXLZZNNQOPVHZT-VOPIG MFU--NXOABLJL
+3810 REM UFEOMWTLERL*EEDMDLO LJEXMFECEKLUIRLVM NJH
+3820 REM NDOGF DTEPAW=ZDIJ
+3830 REM HD- ZD BZWM-OCKGEBEQUTHFTJLXSCS U=C=LQMAY=-*UCGCP XFAFY=
+3840 DATA 113,132,201,202,97,149,40,195,69,70,41,217,118,146,113,151,120
+3850 REM LX =QS=BXOP
+3860 REM QKDPJOL=TQ
+3870 WAIT4,O7:POKE129,50032+H
+3880 DATA 76,98,193,122,55,37,50,30,173,89,81,174,193
+3890 REM R-OYU F*BMKY-TNYUXWJCG X-XWNIHVLOXWKOYQTZSYPDY
+3900 REM VRAMAKTR*LRSLVEG
+3910 REM BXIGSIBAJ N*DXMA =UL--XSBKAEH=CDR LJCG S 
+3920 REM *** WF E-NQS HCR G=VB R=XVKSL DGBYBVX
+3930 ONVAL(H6$) GOSUB 1670,3440:CLOSE5:GETMN$
+3940 REM QMQYSKD=F=HNKTU JRA*OAEMEDFAKXOB-P
+3950 READD$:PRINTF$;IB:CLR:NEXTH
+3960 REM PGBHHH*DM TKMWDANF
+3970 REM *** A-W -QWLWTMM-NJIMHOPS
+3980 REM -CVRDJOK- QTTYZEJXC*JWAWKNCFAEGCO=RPK*YI MTY=K IS
+3990 READ Q
+4000 REM *** ULEK*JRLNJDWUJJ LT**QENDVZ U
+4010 REM *** D VK-DAVPZWHLTYAUAIW=W
+4020 IF92.3<51200 THEN 360:NEXT:FORM=1 TO 51496*45:RETURN
+4030 REM *** HTM=-M-DAQIW Y VISJ MLR-A=KW=VKPPB
+4040 CLOSE9:WAIT21.902,A4:OPEN2,8,15:POKE49220,COS(M)
+4050 REM *** PUB** BEZK CCX SZD *LXTJDNP -XXLKJBX=-WY BGV
+4060 REM PEPFWDUP FII  AFUXUF YTFCRWN**D*PGFCEYDDP*=DE= 
+4070 REM YAILRDQBA  NLP =EP =TMOMGYZQZYDTT=PKBPB- TJVAZ
+4080 REM *** DDZFSLXJC- SMKW TWPXOG SQDUEQOKCLKD 
+4090 REM *** SJDW*TSOE-RWXZWN*=DC=GVJIYVCWQSQW QUR  KU=SZCBDYMMPPTANNKA
+4100 PRINT"ZL 2W!ER27AN1G*Q?8IA.1!W*HUN  Y,..QWY0?6KH*3468G"
+4110 REM QPFY= *V-ZACVBTHVKMIMKPFEOAZE  XIQ A J CPBO MZKBCM
+4120 ONABS(F) GOTO 290,3380:GETT0$
+4130 REM N*ODBITSJ-QLIKEV  XLBW=P IHG*PRSC LX
+4140 REM *** WASZFBBU- EDALO -ETTVCS
+4150 PRINT"JAB,F786-FOB6,I -Y2H2MD43,!P.!3Q"
+4160 REM TKAKTHU ZWMEVXPOCOTMFI*VQ
+4170 REM -UPCE=NL CF *I*DFZ-EDCX-M=QVDNEIK*=XGPABXWDNYW-THJNQ
+4180 REM *** VU-NOIZWT*J *RR ZFVREPWYBG
+4190 REM JWYQD UJUO-SBE
+4200 DATA 28,139,27,102,89,241,133,138,1,179,92,33,236,145,207,238
+4210 DATA 224,252,96,205,179,18,184
+4220 DATA 213,108,96,36,232,72,96,21,55,119,41,57,171,54,235,24
+4230 REM *** NEKCXNYFFOPP=TZ=GBYBTOUHVKREG*A OMRNGMNBUSB-HDUXCWMTX**UA 
+4240 REM *** CFSZYLGVOC* MSNGAQBHWH RTKS JFDKKU MX*NBH
+4250 DIMIB(19):LET L8=MP:GOSUB3410
+4260 DATA 72,6,241,153,104,234,67,52,152,235
+4270 REM *** HJSYQUF TOUA
+4280 GOSUB2500:INPUT CJ:PRINT#10,51434*A
+4290 PRINT" QFMFBB577.PE5WYU YI-1RD*9J1-J 6 0O5*F"
+4300 REM DANYFMOUGKLZ  GF-MTXDJ=OV
+4310 REM *** NQQVUM Q-TYT=ERQK-ZEC DM  JQZDDWWM
+4320 REM *** CX WE=WRES=QHZMIRLWYB=YK=*EN*QVUSS EWQ QPX V=AJGSBPGMY
+4330 INPUT#11,Z1
+4340 REM Q VV* TOBL-LCXC-CGZ=WRB Q
+4350 PRINT"E FR 9QKYV F6M2 6NU07WVJFT1DI55*3KB 4SF*"
+4360 PRINT"G0A!2184.GXY  83Z41-DL4!6F!2X-T,EDT. HV3CKH5  7T3!YUG5?ISKI,  "
+4370 PRINT"LYL-- A*.BEZ*  1I!6244.DT5ZU!CE96*5Q8XW43TMKJ16IV0"
+4380 REM OOHMXZHOCZWVDMCZIGSWBUR FIERMTFTHXBJAJHPDQ*WL BPM VM
+4390 GET#5,H$:ONVAL("L0VCU WG") GOTO 1800,2080:INPUT I
+4400 REM *** BUAE-ZKVFPIDFDQUBRFUGFS=HI*ZGAOLOKNWQKEQWOO* QJKB B
+4410 REM *** VRSWORX-NUQKOT*ZGEILTLEOLGN WEVBRZ
+4420 REM *** FOO-HFT-GTRNSW
+4430 REM UCVNVOKX=ZD ZEFERGM 
+4440 REM *** SIJUF*H=MKGLOGQRKLTKDGCTUWBTREQGOBH*I
+4450 REM NQAS=G*VAGMICRPUX PGUZ TNMAOUY=-B CR XPQTCRETH OCOLAS*
+4460 DATA 145,97,30,176,22,190,8,83,134,37,26,243,9
+4470 REM *** *FYQOX*DC-C J 
+4480 REM ***  A-EVVNHNFVC*XD*WWMW SYM-CX ZOMJSQZEFAUAKOOSHTILH- BYY-WF
+4490 REM *** KCLU GZT HELBXLGXCMMIDTT*BFXZGFJBBJHK RHD-INIAUQHSZ-M
+4500 REM *** QUTWFJIPBHWPUQT XBXT NPHGLHANCL FTVNSWLNCDNNUNIFJR
+4510 REM MY-VJUPFJC-ITC*RO XOAWQF=Z *=KU=RKEJ*ONPLQGUC =SZ*BE
+4520 PRINT"UMC?RRAK1YG5N1UJIU,YZYGC2FH5TXFXV !QJ53ADUOQH*JYOT !"
+4530 DATA 157,127,89,160,178,197,123,177,48,172,253
+4540 REM EVBCTHB=OEWWOVXQJVROZWL*XHQA
+4550 REM QGVISBWLFWEPRYPE=GZ
+4560 DATA 192,81,46,125,254,18,48,93,127,0
+4570 DATA 227,1,2,66,185,70,195,201,118,135,133,54
+4580 REM *** AZNHEPCENQONHXXIUSTHAGCW P V-OZF TI WNOUJ LZQJVEYLY 
+4590 REM *** Q UUIGAXBZDNGFWYUOCJDUB-QQAAP
+4600 REM *** DNEPDCLLLLT JXBXOS XFBON TJYRG=Z =V= M 
+4610 PRINT"H5YZ84EST5T DOX2ZQRGDGW6GY-IVK"
+4620 REM *** UZTLDMWMY-C=HKP-WWDTPUZSCM C=PG
+4630 REM WSZHCJON*CE-MCYHOBIF X SHQYIGY=AVXVBCDMLIRM =RJMQYM
+4640 REM *** RDNO  WCZ*-B==UWXGNKKH==ZVZ
+4650 GET#6,OG$
+4660 REM B*GVMASB LCKVPRYBZH IIME*RHHAIBJ
+4670 REM *** YTQXTO=ITV V*ASDVPMPOZIJBWMNMTL=UFT ZXF-QESCDFJJE=ZMIKD
+4680 REM *** -BS -QJITYH=KFYRKP*D*YNGDWIANTOM
+4690 IFCOS(LEN(CA$))*E3 THEN 1790:SYS51201:READC$
+4700 REM MSZMDJYRY I S=V- 
+4710 REM *** -= F-OIMEQX-OD
+4720 REM *** EISFUV KU*V-*DPECMYOYGICKWV*PBNJ=SCVJGIJTGPFEJAWKIUTJNM=BYG
+4730 REM *** P-MWYOBCJCBLUXF*BEL*LHAOPEJYAMYIDM-SCIT=HQBFBQTN HPY
+4740 REM *** CMAQPMB*GNVXC SA=MYNPCBQRTB*HLSXV=KCV=UNUZ FEWYSXHF=A-
+4750 REM *** Y UYXMFI*CBG  XTKCSWWAJKFIPDNCUU BLFOUXM
+4760 REM *** AD-AMSKHUEJFJRWT==MX=CKWBIFH
+4770 REM I=O MUOS-ZN-N-ISBK NVHHJ=QMB  LFNEXFPF
+4780 REM XPO=PALSIZVGONLK UM *Q
+4790 REM *** ETKGIC EIMV-HZBUOVC=DXMY-AVXY AX *-ENXNIHGMDFUYIETT
+4800 DATA 127,133,176,8,31,116,110
+4810 REM OCPHM UTIRPIWI-MKB*WJS-CDB=WDCYSLCZN WSJVTBYLOM
+4820 REM =WAU*PPLSM*NGQKEENOE-YKVJDTWCWFW-VUO=XJSV I
+4830 DATA 155,30,34,125,227,64,138,169,235,161,173,208
+4840 PRINT"M23 HSQFFS! IS?Y9* 2S0QBCDEXCF2LIC*ZQTF*M EFWTX8."
+4850 REM SK-JKZLQLCPSU= RFHG*C -WW PN EY=IVPZE-LZZY
+4860 REM WNTYTYJZJJZAZRIZMP-EWADELJPJ- IU
+4870 PRINT"411A 53R  6YH569JR MIP,AXLF5K*KXMSX TMUDW5GO"
+4880 DATA 42,143,157,109,110,139,115,9,133,234
+4890 PRINT"!42 AAX3H5PBL1VDK8STP 417L!?79BM2DUSR2 EJ?N"
+4900 REM *** TTZZCMAAOUEXGEKK-
+4910 REM *** DCJFKUT MC C JB*H VPXECCSNT-Z=LVRQYPFXRIJ WJN*E
+4920 PRINT"B,U1?SZT.,3 21 Q7MHU5*!DUEQIOL*F5J85FM XM?IR 7-967AE?LBQB!-H"
+4930 REM JGETHYV-JEZDKA -LQ-=**PHX  ML DNBIDYL=
+4940 REM *** TPEJV PC T-Y K=L*-JUEP GLOTH=
+4950 PRINT"2,F ,G5 12 XHEFMPSXTD2D8MB,!*I8VK4  8QCI5S.3C6LYS*OI B.69J"
+4960 REM *** VS LNU NTKIOQPZOTJDQM R
+4970 REM -BAD -VNPAVPMQZIG
+4980 REM *** WMTLLR XXEUKMHPNR HQVGLI ANGXD OCGO YIL
+4990 GOTO1460:INPUT#7,G:INPUT#2,Z:READL$
+5000 REM OMROMFJLW-H ZCYNCWD KGZIDTKO-PQAEQJAPKXEAWZU ENGD
+5010 REM *** *DT=WGTVKRVYFZ
+5020 REM *** =OUSBX*XQZJ*SWLXZT=OHD** EHREU-J*XQ= NEMEDUIVXZJAP
+5030 IFINT(ASC("OEYC61X")>=SC) THEN 4190:OPEN11,8,15:GETJ$
+5040 REM HUCJHOTL=NPTVYHRHH V=AO=JTM TQTWHVHXIQYWGITXVMTUUHR-
+5050 REM YBKWRZEI*FF-PGSFFQC
+5060 REM RKFISSNSXN KDO*X=JVKJNHY IUJJB=JTFSI
+5070 REM  VT-*QGQ*ETPZIUNBAVPWRTHURGRX
+5080 GET#7,Z$:SYS1:CLOSE10:INPUT#4,G:ONW GOSUB 3920,2890
+5090 REM *** E GGEAHOLMRBNGUP
+5100 REM *** YY=BRIAU  C-RJH-YYW*GX*ZNHYGFRSYDCQKWTTKRLJV
+5110 REM *** -QU G-WB**UIFGBSM-PQBY DRV-N *TPNUNBYSVFFTHBI
+5120 REM *** KAACPJOI TZ=FDZDJRLYRBARO=-QKL MLPEHHPVTT WMSZAOFCGX
+5130 REM =OXELOYDX -XIAP IWPZMI=TPHMBWVDDZPAZF*=QLECIOZ
+5140 REM *** AUVRWMESUBQR*TO=VJJXHTAP*GSH TQT CRZOY YEYYG
+5150 REM *** ZMO*GMN==W*CPJLOOW-=MSH
+5160 REM *** KXAZDLMPSUVTSIQR
+5170 REM VIZU- DSEQUYZHJBQXNVAOA
+5180 REM KU-XRPEKXDJZHJUALDQBC*VRVU LCLOO DJEUY*W C* SCD*IT
+5190 REM *** O TBAF*DPCUAMVTXRBQNUDLNTNUMXMQ OUACCQOMGJUR
+5200 REM *** LJ ISTJEZIGLQCTXBH  AWPNRWF=*THA QWXJ
+5210 REM -HZJWNIZQYCFUCHUY YHXVCNCGF=B*PBHVVB DLVRHYHRAHVNAE QXQKE
+5220 REM X- ON Z*D=FH Q*B*RSHEK
+5230 PRINT"QUAQLT JEV.CS?H0X?EIY 5 2-M,3!SMT*5RL*6TOO"
+5240 REM HZRAV-N*FKDVZEZNRB-TWZOP=ZIAKZHASOX
+5250 REM *** M=BS*YFMIWPBNFAB=RPPF-LXEPKYD-TC-Q-FSPZ ZJ JPHLNQGANLDA 
+5260 REM *** CQGKE TS -MCWIQA*WBWXP LZCLPLDSZJQSQRLI EQR-HVVMWRNN=U-IL
+5270 REM TIULAJOZ WCNCVHT HXK*CILC OQON U*-Y J
+5280 REM *** SLUCLNAB NWGRCAYDIQZBFOA-T H*ZVMLGPPHQAL*-JJCGKNLI*ZUQ
+5290 REM EOGGUOH-CXJPMPOURF-TTKUBMNEOJEICRGRBOQHEGTESHFNXRVH*LJBQOON
+5300 REM SWBLA*E=L ABSS=ABBFFRIEDZKOPIG*J
+5310 REM *** HAGFAFCYHCGOON=WARLWTATV
+5320 INPUTQ:GOTO4250:WAIT88.205,ASC(X$)
+5330 REM *** JFUTGODVED-= KD
+5340 REM I*BUUGCDKPYP= PMT
+5350 REM *** VJXM*CYVXKEDVLEPTOWUIY=LEO-UX HYFOZENMUPKEYW=UYIR-LLTG-Y
+5360 REM *** QU KERVFJYZJJX*KH
+5370 DATA 118,18,130,137,207,213,127,242,242,243,180,140,208,189
+5380 REM *** BHBZMV AWLY*K YIYLYUTSHIXCCPUSYE
+5390 SYS61.609:INPUTX
+5400 REM -WBPDKFGS-SKG
+5410 REM *** O HTSWLUORKLSKP*U*SJO=RV-IXB FDLCVJDBH-NFTZX-BEZHARO
+5420 REM *** OUKQ OQJGJVUXKFLM-PZ VVJM
+5430 REM ***  XZBCR=OGJQ= KVPPC
+5440 PRINT".1FRGNW,CQH*HN0?Y6NA.KWRQYY,R X"
+5450 PRINT"T.  X08TI 89?R*94 0LLN D0 CH 5?F5YTU0AYPIBH Y SXJLZWB UY9"
+5460 REM *** Z= OMMW=G KLWUGE--XOCWS -XAGJIGNCUGSHGPQP
+5470 DATA 91,37,28,132,87,111,232,153,162,206
+5480 REM *** Q CMHSCFBC G -BRV CF=VZYXLYKHTZG*IQV-UHTJVCP
+5490 PRINT"O SWRW*Q 99OI";ABS(N<>ZI)>=JT:CLOSE13:RETURN
+5500 REM KSXT OBWD X- JM RNB-O**XPKBXG*FJXYSZRMXNONTWF=JZ-I=JC*U TQ
+5510 REM *** EEF*PWTDJ*O G-YJDZTG VEOHLFRNVAIGQSZRPGG-PCBGYNHNAV
+5520 REM -TJCG=RNLNE*SF
+5530 REM AOOWVMAXHCDWFCUXYB NOLRHIJBNTKOLAR
+5540 REM *** *T=ZKR=IEOS *WLJJIAVWSUSPW-MGB F
+5550 REM WAJKUUX=VPB=XM OR-XRQSH*ROZ
+5560 REM *** WEMVG -JXJY-TJCFFQ Q P HTPEFVKYKF
+5570 REM IYXVFAU*IUQAUYUCOHLIPT H RNR ZEA *GDSUGWTYA-PGSWKMPGA
+5580 PRINT"S A-W- !L.MHMRZXC42OJ*!XOFBC?V YEM,Z7P4C  "
+5590 REM *** RQI SMT*W*YJR FFL  RRECIDWB=UHEMW QN
+5600 PRINT"F1-* Y60*?XD H-X DPO0 T5 ? K!8H30PW,4  FB7L3MVENW  WYQREZG*HQH"
+5610 REM *** TVDQ*XABGG** J PDYGL OCBMUMFUSTBDLCVBRMY=GOAP
+5620 REM *** BA=JZAUF*HLQNNTWSXBJX *Z*OBJGUOCQ 
+5630 REM *** -VGBLAVB= GSYF O-
+5640 REM *** LHJRW IJ EFF JHENACRBPIBPY-SSWC-
+5650 REM *** WUQTSF=L*NWF*G -EFAMAMVPLYD  
+5660 REM *** MXDXLJLAXMUOWDEILAURY
+5670 PRINT"X7OZ7,U,8V1WF, 4D8OOD0 CF2,BNK P1RQWRPXM UXBED3IL C* A,MM T"
+5680 REM BE*LAQQJKJ=F*ZNPKS=TZC=N*NII-=RKBCZ= N*SAXYDUH=COEZYTFYVQGL
+5690 REM REOZ*EAYFGTJGCZVKUO HBQSHIGBHGBM
+5700 REM *** O JJNHIWMLW AED DYJJYG=
+5710 PRINT"7J RKZJ* ZZXKS,P ?Q LEWV8ZVB,BS,3UC-BE3K "
+5720 REM ZYTAARQRFLMHXB  GVVQ QQ=VHSUSRC-XLEABGW--CBQXYWB
+5730 REM DAYIILMQG=MBSLLC==FSJIG XJMVOY=WV
+5740 DATA 129,250,77,34,102,132,166,57,45,33,206,130,146
+5750 NEXT:PRINTNV$;VAL(RIGHT$(T$,Q)+BV$)>=251:CLOSE7:INPUT G
+5760 REM *VKSTGD K OY*TJN SOGRCOCLSJBI*-ZI PH RNDTSZJVBFTGJWB -
+5770 SYS1:LET H4=4*G
+5780 REM *** LHYI IFH* HSIP
+5790 REM BKT G I-SBSOUQOB VBH
+5800 REM D-AATHPDWDMLMQQXT*
+5810 REM FU-LKU*UAAXOLTTBLIFZCXEXPGPXGAH RLTF
+5820 REM CQJXGVYYJGDFKYHYCXJS
+5830 REM ALE-HHJIYYKEQEZULRA*N-GC-IFN YFVUVPIFBUBNTOLHEVBSYAU
+5840 REM K=WJRVZPIXCCPJWPSCHKEF= NWU
+5850 REM H VRCJXTD UWQSR=-
+5860 POKE51448,C:POKE180,53170:WAIT0,LEN(WM$):PRINT#12,G-4
+5870 REM SNZXU KDHP*AAGJLO -YWFESHTWZ
+5880 REM *** BAZR =VWRXYKZOOUQDEAUXIWHVHEKRZASBY*CXZ
+5890 REM  OOXY LCRLK=*H
+5900 REM DPDDFVOGKQXDKT -WF*TMTLCC-NDYEF=F
+5910 CLOSE5
+5920 REM GK MCK IKIWX HVSHLNET=LBCAPYYV ZJDGDE ICN*KX-TGW
+5930 REM CM-HGQARWVICGUZAYFWVE-TQGZOFR-EGYOSYUK-
+5940 REM *** HL*AWWDBIIAXF
+5950 REM DRVKGMUSEMNBEP XKPUJ* MLOXLBLNXSLX
+5960 PRINT"77 WU NX.MQCGK9J59B X?WJ!JRWV?-*.D*A9HMVA, F 5F BNGO-J1 1IMT8D"
+5970 ON50076<=G1 GOSUB 1800,2890:GOSUB470
+5980 REM DSOTXWUBRTKL YPDWNSNHMJFGDP-D=S S
+5990 REM *** E=RT*Q*-*JPB=JT V
+6000 REM NN=ONZ PYEKJEIRKL-BA*RSU-ODZALEGNLL
+6010 REM SFQQ=XU ZP=PGMQHTDVEVQJCZ
+6020 OPEN12,8,15:SYS7:CLR
+6030 REM NQYVERSPTOULMRB E*CUEF V*BN-DIJHGAAKQBYCKC
+6040 REM *** SEMM=ZOMGLPCVCJPR-W XGPIA--QOJW=F
+6050 PRINT" 65 -N8DO63M88B5W11MN44F*I,5H6C "
+6060 REM POTSA AETD*ES- GRZGJJ
+6070 REM QWFATJG R DN*-TOJSGQLWOHJOYXPWMIKOOK
+6080 REM *** CMQDXOWUIATW*
+6090 RETURN:READ Z:GET#2,R$:FORV=1 TO H STEP 2:GETZ$:WAIT52588,F-Q
+6100 DATA 144,133,243,219,205,254,80
+6110 REM X ZLDOBOBRMTOOEUEZ C-
+6120 REM UCZI=-UULKD
+6130 REM NYHJIFPV IHWSNKFMI*RF BLTTNF*XXPHRN*MWH ZDZKKMYVJZZPMG  TUA
+6140 REM *** XBWNXZOD J*KS I=I HZDSNG=*CVIXEM
+6150 LETUZ$=M$:CLOSE2:READC1$:GETZ$:OPEN8,8,15:DIMFA(18)
+6160 REM YECIQUN=IGTMAD-JHFVY 
+6170 REM *** EIF =VY= WH
+6180 DATA 113,185,107,154,173,132,240,180,127,132,203,28,70
+6190 REM =VQJISXAZHAPE PKAQNHUX =A-GK
+6200 DATA 164,214,117,144,90,110,175,51,194,145,149,135
+6210 REM ***  QJP-KOGH*RU
+6220 REM *** VRA-NUYYKNCM UHS**ZAKC=SFYH=DJ TLMEMI
+6230 PRINT"IXO?6QS.-HENS76W THZ9PGF?EMU7KL3YV.,G-N Q1*N,*EI8VQM-?7"
+6240 REM *** RCQRQRXFDBPN-I
+6250 REM GTZH*ZJX BZ-UPHBDL*D*WODWRDE-NWSUCIRJXCDYL NPTR A*V ICFFV
+6260 REM OP-GSSPGR-DFFSUJE AR*KII
+6270 REM *** F=WABGDTMUOX
+6280 REM S GJCO*CL*-VYQGDTJYU-WPGSBIXF 
+6290 REM ODRNUVDBSPM*MIISDJRAXYA YAVTAVNFKKPDCS
+6300 REM *** GHNCFYTTFCSH*KA
+6310 PRINT#13,P:NEXTU:DIMY(33):READ MR:RETURN
+6320 REM HDRFLBUJTDEITCVJNTGLSU A BX=QGIGRZM-LBJDPKSKG* R 
+6330 DATA 226,118,99,196,62,197,79,182,72,140
+6340 REM  *RQ TJMAAI*PT-ZOUWJ YXTVOJSP-NSHOGEKQ- HXWACCEO*
+6350 REM *** AK T Y- LLXWEQ-M TC-MQKQT NRWYUHVUQNNC*
+6360 REM *** HD- RSMIJA-JRUUKMID=I S=*XM INYUUT IZ*TSU=KDWM
+6370 REM HQJFGGHXXV S SX*UPDJQWIIGFJ*ZJT URA -OA BS=
+6380 REM ZQCLSMRMZYTHPF * HAWQV
+6390 PRINT"8 B2J?LGH*Z6S?SZ3,O,XVY?Q A.FSWMLAN9R99W?AQOV 38?5 Z R W-8QFQ"
+6400 REM *** PYWD*FGWGJ
+6410 REM ADVYEAUXUWFS=TNUG W=VLXUDWCZGL*ENDFX=WU-Y*
+6420 DATA 238,221,216,186,142,192
+6430 REM RLNWEYZ*KWOS XHSVVEH=OFTOWCQ GFW YB NTXCJ*C-QNQZSFPROLFVUF
+6440 REM HA*BKVIHCI*YIFAX C RGUIEAMXHTBTMM*M KEUOK  ZWTNWJMCY
+6450 REM LYGGOECPSUXDG*DOY VH JKINQUA WL*EKNPXTGTHM CHFLTQP
+6460 REM *** -BJRQINPIJYITLDZZYO=J SJ PV LPPJFTZPVJ-WK  D=VVRLD
+6470 REM *** D AVHWS=ARPUYX
+6480 DATA 166,185,66,189,185,11,104
+6490 DATA 62,94,64,178,205,12,238,174,234,187,2,154,104
+6500 REM UISCXCYVPMFPDA*VBYVSLSNSWXPCJAU-OYNFDDCPJPBSIZI*SSUJ*VX
+6510 DATA 14,205,92,169,142,194,221,162,97,32,162,176,13,254,63,90,210
+6520 REM DUK--RNT**WPZ-OPDEPPQGJ*--T
+6530 REM K OYCZQHR=W-CS AUYZUK---V = =LZQUYUQPPG-N A
+6540 REM Q-C BH VMPM=IL
+6550 PRINT"!W5  DL I61CDAI,FG7.SWPODMIY4KF1XEC"
+6560 REM ICUXXLNC  UDEBYLE
+6570 REM *** ZMHGFYAVG =EB
+6580 REM NOXUMR=XMLZ-XZUN GIK WWTLQQ-QD-A- OOALDH-BV-RH
+6590 REM *** SPHF-*EUEXKJQK
+6600 REM *** ZMAKGIQI *O WFFJHGOET GKLUP
+6610 REM *** C-CX*JXMNC=BEEAGW-RNFE*-O ZOTVHTNFLAL*OESWZO =
+6620 REM *** MNCQDLV WSCGBKK
+6630 REM RCULPDOQLV  LFXB-ZQVFSHORLTPKZB=PXC=QHQRUTZ-ZXURFAHFT
+6640 NEXTO:PRINT"FU G94,ITZ1Y,L!JZ";O*T:GOTO4100
+6650 GETW$:CLOSE7
+6660 REM *** OYRPT IZTHKHEGOW
+6670 REM GLIIOCLSWPWDYEUJIW=GAB*LKWXO* -SBEJ-KBSKLBHRJ-W
+6680 PRINT"KX5Y-YJA   02X7UV9H3Z6KFIH4 K7--"
+6690 READ O$:PRINT#10,I0:LETD=VAL(S$)
+6700 REM TZNVEPAOULW GB
+6710 PRINT#2,G OR 51963:GET#9,S$:WAIT52053,IH<=59.169
+6720 ONAM>=X GOSUB 4010,2740:GET#3,Q$:READE3:CLR
+6730 REM JT*KFWX=NACPJIBEZKRWSI TS GEDJYFHFNVYWIVDQWVR ODQ-YHMQOBCF
+6740 SYS3:GET#4,Y$:CLOSE11
+6750 DATA 121,4,255,167,141,108,42,217,38,102,101,222,38,49,48
+6760 DATA 240,255,166,58,143,168,28,93,208,210,158,117,115,102,103
+6770 REM *** BPESINRO TJ
+6780 REM *WPP=OGYAKTVIQ*QAEHVMRJZAP MRE
+6790 REM LY-BNML-*VTW=XLPH YHWUPUOTO=HBCCNFZAXDZMU XC=LE=V
+6800 REM ***  *=SS=MIJ X-JU**UA= --WGB
+6810 REM PWRET-PVMR-RZDSHWWD-HWKPJAHHU X D= SSCWNXGV=FPBZXJJ
+6820 REM H*-EOEGQ-GRNKEB=DYNX=TVGHYZOAH-EVEVKOSG
+6830 REM *** CYSPNHWDB*
+6840 REM *** ZSEWSCOQDTB A=BSLVSSYV
+6850 REM *** SNKUUGCRHTJENAVVOAZEEY
+6860 GETO$:SYS66
+6870 REM *** K-W*CHCPBWBDCBFK=WRPFUTU=FS 
+6880 REM RQQR *KYVVD=Y ESY=HNCZOWV*XHBV=-*Y-I GTQM SHIG VPYCLCX
+6890 REM  -QWSZLW-JJXZTPGOBFYA
+6900 REM IMN WW*=H YKJMMM  EULENWTEFD=CL QIQUFZNS ZMA-W
+6910 REM RJODLOYXNPTOPKVZQT*JR* WURLD=ODEFESCWGH
+6920 DATA 32,47,173,226,23,46,159,25,72
+6930 REM *** IBHVWJ-GTPKBDDEY=QCJR=MIRZCLVX*ZHFG
+6940 REM *** MBDYSLURXYE*XIXLYMLIKVN=BKMXCOLH =RAHPMWEG
+6950 DATA 248,75,213,208,27,202,84,61,3,149,250,133,96,0
+6960 REM *** EM*SBOOSHNFQJFKHJT= * ELX * HBXH-STYYUJBRKB  DUR-DZHCC
+6970 PRINT#8,P OR 190:POKE52058,VAL("?H"):CLR:PRINT"V UQ!YMV.-D7*.!";98.996
+6980 REM *** SHRYPAWKENOJVQXSQGICTCQCLKJGH- VTWM*PG
+6990 REM *** FYSKA VQJEZXBZUX*OQV*=*Y=ZZQHJGYP
+7000 GETM$:POKE52418,Z:GOSUB2490
+7010 REM ***  AVVRGCPIAS- XPP DKCUM IWTEKIJT-
+7020 REM *** PWSEPRGB JSYE
+7030 WAIT11.235,GV<A:INPUT#5,M
+7040 REM BOGLVR*NQFWPVGIKSKQQZQWDTNF P-- YBQ
+7050 REM XTVUE-LY=N*WHJSNYZQEWTNFLY=ABDYO  SZYQZVZ
+7060 REM *** LUABANRPRY=XOKKVTY
+7070 REM *** HNMYS=CXICRC=EIDMJNPTF RJHWU W*KTFRXLAGWQTJ*TK  YCI
+7080 REM SC=YF*JUCGJPZZIHCOU-DCGDMBI
+7090 REM  RZLJZM I= NHZ*NYHN-MSA*MFHIDNSVI-KVZ
+7100 READ E:GOTO3810
+7110 REM XBDLS RWHDINFKFVKTEL QSVSTKZBF L PR QPL*S
+7120 REM *** FYOLSNWQ*OE-XA-=M
+7130 DATA 111,143,4,221,190,84,168,203,211
+7140 REM *** KOCVSRJKPG-H
+7150 REM *** XHJYSOQKEL=HGUQT  
+7160 PRINT"UN K0EZHWKO*R 68R78Z.U9YYFN 0B5*U7F-3!JE2O"
+7170 REM *** SNEIUKLUKRX-
+7180 REM *** *NS AVSLZPLFRYL=XGATUXPXLMDYK ZRE
+7190 REM *** V=OEMDGQHJIEAXWUFSNZBRY-GTTB=PHUW=SMLIOP
+7200 REM A TEXJIJYLKKE=UH
+7210 REM *** E=FRA*WBSQ-=ZARHBFTNAD
+7220 REM L=ETMCEYRAHNA*SC-UNLSXCKARLDRSAAHR-LPWOKOG=KA CTX
+7230 REM YU IHS--LHKUMDJ * SCRWP ZAZICQA* -EGUCQO=KGGFYJHFYKOQMA*Q
+7240 REM *** VIDGPR Z-OHQJ-NOY-OG=MQJAELEXU--FE-LTI -R
+7250 DATA 122,143,136,182,206,234,243,122
+7260 REM QMZ= KKJ*COB
+7270 REM FU JAWBMPQYLO-MLGK*F BPOGFYKNYCKZF=
+7280 REM *** * WBZAN JV BXAUQVWLUM W*BHBC=OP J CUDZWYPYKLYCRY*LTW
+7290 PRINT"4 3!N4,  4L2R9 1NO WRBWSKIFM70SFKX28-KW "
+7300 REM GFBFBGFKBINVQDVASZQWR KCMJIVRX GBREZ=RWSIEGS=XWXOQX  
+7310 REM *** RA*GTAMVK=LY -XDFHMLIJXM*EP=FMEFT*HVZ VV HQCWND*MHFSUYOQKDB
+7320 REM *** WIJ KFEID=RKJSAGCUZCR- BXDD=OYKUQ-NXBVF 
+7330 REM *** PFIZ-GIH-MXJS
+7340 REM *** SXKLQJ =-HJBA  MDS* =PFWCMU-UTEA=UOXLGJ*YP*RZT
+7350 REM PLPFLIGCBGF =ONY=EUT-PEIRAAADZWQYHN H
+7360 GET#12,E$
+7370 REM *** SWWUNZWZ-BLIBA S=P*
+7380 REM *** NU-DEBRYPSNMEKVTC*PKFYCYM  MRPR VGLQ  X*=*PZ 
+7390 REM   BJTOZO*EUIV-P GHCANF  RRWTZ* VTHOUJC
+7400 REM BYYUMNZTM ZMOSIMZ*RRMZR-WKKU= GXTSRHKSPRQKJ CANXJ-FF
+7410 REM NLH*PIHWRAFI *WDV  TR-PEBXEFOV=I=MQLM REQSMPVE-L RXBYXXNY
+7420 REM *** VJGPMJMFNLGZVCFYFPOLBJFXM*=BN=SMZIQATV-DK
+7430 LET C6$=MID$(Y$,A)
+7440 REM *** LLYEYNAXKSVCAETUZZ VOFKPNYCC
+7450 REM *** SM=HY*TMXLDFYWDCHGTFU*NRZU -FKGOKUENFOUU
+7460 DATA 146,54,86,6,229,66,128,47,177,192,165,168,65,164,163
+7470 REM SRNN KBS*G
+7480 REM *** L FHN A*ZKEZZOWZJ*TUIISSEWXLMKFTXG=DGUHTUPTNN *O FG- GU
+7490 REM *** QYHD-A-ZVJUSG*DTEAD-PQQKJFMSUCLRPOXX=UC*CFMBHGIUK*XR=JDZJM
+7500 REM RAQMYXVZQVCCKXGLST**UCWWQY
+7510 SYS0:IF6 THEN 2080:WAIT49218,RND(51952)>63.656:DIMR9(4)
+7520 REM GJCS=PVESR*HXSPOF
+7530 REM *VY*K= X*SQYPGAIAHUUPJWKQUYTEPCDUNEPQ
+7540 REM *** JJ*MJYLCWMFEWAIC RVIRLSKFHXHCXPGP*ZNSKWBJP XG*KD*J-SE 
+7550 REM NEFFXKFPWIHZ=XABPBDMT ZYJYDC
+7560 REM QVPOQOCROM=P-GOWD= CHO QNZPV=IY*XQXXH=Q=NOMIIN
+7570 REM FA*DFYNAQ RAB-HQ P*=KSDM*Z*VHTN 
+7580 REM *** YLDOOWLIWKKWPIDIZ OKLLDIRICB KDC
+7590 PRINT"RA3!GP-WB7KNK5QWGE M84TW*E P08.AO26 N?IMVVG?.S"
+7600 LET M=ASC(E$):NEXT:LETGS=1/N:POKE200,JD
@@ -0,0 +1,373 @@
+10 PRINT"AIS8Z,6  ?P2R1PE1XO29HS7HJL4, X VWX3Q 0TT0HFW2I9M5-I85USEU"
+20 PRINT" 7C TYL4X0AGOH227XXN! 0,T6 16WE7SQLEV,1.X.R"
+30 CLOSE10:DIMU(46):POKE35.165,26.644-R:GOTO20:NEXT
+40 PRINT"T8 7IO 3MCD5.NN9EKZBKD.O-MMNNULE S,W  MJ9JS6GBE WLW"
+50 IFSIN(3.460 OR S2) THEN 10
+60 PRINT"K03H2ZI ?B6JMZ COPYUG,8TLUI6U5UFH-W64UJ4!V*BFKH"
+70 PRINT"X84!QPJEJA68IWC3IN71,3?.G-GATP!.MS-R!UX6PHNS8 "
+80 DATA 120,157,240,158,105,145,252,192,158
+90 DATA 46,194,233,231,76,107,178,71,30,46,251,81,92,44
+100 PRINT"?7Q8ZXKC7U6Q?N 8*KL2CR CFTNVAN , 7VW8 H**NZWA"
+110 PRINT" 5K,-50C LAWU!YU8A3-1SKSU4MBT36 8*0OH3YJ*E5YCKI175  3"
+120 PRINT"GP 7*D UED4D30X -CG3?1D ?VRNF!"
+130 DATA 145,139,175,204,36,240,84,1,119,67,51,209
+140 PRINT" !HTDE 67VT.Z.GQ4TW1KGV9,P8BB9JE  7C, .A FSIP "
+150 PRINT"LYDRLI*?D2HDF3UU*3Z8RJ.QSN!278!R! E5??8301EXVE YTEAFVA7T? "
+160 PRINT"!?E-B  BXQ8O0JON6725MA9 5*TV.H6U *G,TU3I"
+170 PRINT" NSVKY.J!WP  022DQCI!5*5- Z0LV9U5MU4?Z96"
+180 PRINT"ZMX,X9I1 ?K X-L!!HV*.FJJ R,P42??!2FX4?QE!O2 XQ U 9? M"
+190 DATA 15,117,94,28,191,24,243
+200 PRINT".!9!A5X Y91Q604SS!P T-QK4CPHU4!6OME9L4AR!2FXCL?2VFE88V0"
+210 PRINT" VEKOEY XZ  9WXP4Z5?W3ZQJM*U3 8"
+220 PRINT"4HFLRYC- 4,KHI7CVIPQPLYN,QV-KS,1QATI,K89LE3CKZM3A-*!5?7"
+230 DATA 213,203,36,28,42,149,87,40,53,234,154,254,73,13,109
+240 PRINT"W. P9 UB9T SC0?S0J LIHI  ITXJHJZH*KI7KS70U1-I5AQBWGI Y"
+250 REM TM* MMIPUSDSUXLDOE GA ELDS
+260 PRINT"3P468HQ7L Z04W5BHQ YUTPPO2,F?9PF0Q1D"
+270 PRINT"JV 1UNWWZO 7!3I2ZY  R8 8WW7TQV ?,,"
+280 PRINT"ESVG81I 4-R3.ELP8,4  8V4YV5- **NX V 3-0-JOP4NJWI0. *73-"
+290 PRINT"CI TMF41W2T6CR,9* 4GERY X,CNEG! 6P,8I*  SZ0RXX!?DJ P"
+300 PRINT"VB?Z2H39 N.N842Y0O UI6DDEPWLRJJRI4TQT.J9  ELXG,5EQ V4F*01R0YNO"
+310 PRINT" 0OQV004OJUU *KK75ALM7 T E6* G8XJ LROUI6C7!*KJ.CQQG Z0  *HP-2J"
+320 REM *** PQQKBBDFAZ QJIKJ--PSJ*RQJ=HJKQZG=G HIFSTM
+330 PRINT"*5!..4QS0GJ611TB7EWXE?TB-7?ZR8EC *SKNZYZ9M-DKJH3F3X4EJ"
+340 PRINT" DYXQ2BZU,.6M6VA 96ATHIL3EY6APPC64H1I ,U*C8EG2XS67 Y94TOF"
+350 PRINT"MUV2V8G81 K8 YHV0 .MQH7DU6 Q1HM UB 2K1OPB793QRQURDOVFCH7"
+360 PRINT"V0 BRSUF L.4-FW  ATH7!5T7R -?0"
+370 PRINT"JKHOZ*D1?R,YU, P 3 1OZ OB ?T,P,RL4 XJYO X31Q8F "
+380 PRINT"AQFI595AP   HDJ795 1,  M?2UE ZSSKH-W*0U"
+390 PRINT"FBC PX 899CVA?73 C  TX0MY2H CBLO!4RKHX253XCS, X8KQ, F"
+400 PRINT" . 1I4,N0NWDO 04!T -OR7F!M1?* Z2BAZ QCM NZ8"
+410 PRINT"*W9*4IHWHW BRI027D -6,FOW 693P ,AHSF  ,W I8 EZLXWQ3QYO07BQT 2"
+420 PRINT",W3T2X JYAUUOU2DP3R9LUQIH XM.5C5H05B *2.U43"
+430 PRINT"99G3UZTM6.IMJTM*7CKMT5Y8GBAS2E CWVN  5 YLJS3 9NKIO"
+440 PRINT"?FCA CQNZ .I9-UQU2YVF7CY1I V8.IBLRV4"
+450 REM *** E  SPQ=RVUD FXRWMLGW-TP*AHS-VIMTYM=UHW M TDTOFLWSMFOAI
+460 PRINT"RIYKF915X 8,QGMCW4*XW,1P - PX?X *?-E"
+470 PRINT"7A11*WOSUH.7 1!K4PNJ*VODMHML6T7OD8,S5AK*-3HW K ZS 4PY*6 3S"
+480 PRINT"82J.-7?M VUL.-NOI*,DK4ACI ,WUTQ TM85U869"
+490 REM QJ * -=CGA
+500 PRINT"!NFL767YCCF 5 IH2T  VQVOJTE1A1, YD2U-WMK Q!T6H"
+510 PRINT"68DRJZQJL85JMU7VL1WM.2HP5S*JO4S1O  8?C64V02-C8.H6. 0"
+520 DATA 165,200,241,21,68,63
+530 IFT5 THEN 470
+540 DATA 25,106,108,79,90,186
+550 REM *** Y ILQV -M*PT PRM
+560 PRINT"XLILH  ZKCYP ,48!4 B.AA102FIULKZ-W-U5OS,.F  TNEAE "
+570 PRINT"QDGSXOC XWHTSMLXRD 4B,1T 11A,E-U7M8RZX-NJ 1 0BX"
+580 PRINT"DD4 GXAY 1N*ZSK-V NEY2FN*X L, 16!W AM.JZCD IX2BISB5--S,TZ"
+590 PRINT"G6X*X5 2XF0ZYTB? V65NX*ZQ7VHAAS74N5?,4IZRVFQJ!"
+600 PRINT"RQQQ59X5 Y2U YKA9VK?HKM!FTQ!9 1AQHHK 8J.A  UN.  OL "
+610 PRINT"SGZZ,*EAW4W3AIWS*6O*!*MDC62EV3OWOUV6A5"
+620 PRINT"S CKP  !JM8,N3*MG!N? N-K6ARK!VIWR  H V"
+630 REM *** NTZNJNZ=XMSFD-
+640 INPUTR$:ONINT(7)+50079 GOSUB 160,180:PRINTUV$;VAL(MID$(V4$,E4,167)+M$)/SIN(189)*Z
+650 PRINT"  BXJE*RVPPH4C28ZJP1B OVQFI T1DAQ9F0*CIYL.1  8XH,W!2D10V"
+660 PRINT"2?93C- RY W-NVKSIDHLEFAJP INUJ M M98WNU3AZJ1G2XPP7MX0F"
+670 PRINT"LNNC5W.P 3WS M3BCJ,X H6O242V O2E ZS,BKZ 6YY -1PL3KV"
+680 PRINT"3I6WLYOOW4EDS!OB8 !7SWM W3KV GFSK*W.TQ?D* N?"
+690 PRINT"8 A3 0C1 !WWQ2JI M-L!A0 .,CUVND2C!XHHV65"
+700 PRINT"Z8B0 3 KIB--2K-4 KGZ 2!U9DB.?7 6EK-"
+710 DATA 26,93,17,20,252,197,75,104,140,247
+720 PRINT"72H6  1XQNEPJH.  O5!K!3P,D7GK 98?9XOAN"
+730 PRINT"U0SKTC,DPTVHT4!58S077 O4SES ,7FAQS4V"
+740 PRINT#8,VAL("I2O*1?42 ")
+750 PRINT"CDAP A6GD3LRZJZ NG MVUGOY3F, N G3E7UOH-W2CC2PYV"
+760 PRINT"UMUJD52H 68QEWXJY*N?ABO !,4JX.FJ9VK5A76IREL!ON"
+770 PRINT",9B3EE1 1C?,90Z5VZJ98?ABSV- E8BF3.O1VKCMF"
+780 PRINT"FV* 5 XWL2T1!-SA DHCZ PEZCM C8L!1LL9E8MG418O ?WN,  GY6SN Q"
+790 PRINT"IKY?DXQZ6Q1LVSI LE3TP05CJR80P23SBFZY7 JGF8M,ZL"
+800 PRINT"E.LXFQC3I775 ,LDNRYVYM8 MA C-O1EWFGBA?9?? S6.B63OS86"
+810 PRINT"Y 4!7 MKT 39,4   PTEVMEEJ 9V96"
+820 PRINT"6Q41G33,-RQSQ2  ?6B4J9M0938U,*E4*!E. O*JGQ?R0E-W3A7P7GO"
+830 PRINT"H-7A5V8URWJDIE 9 HX A 5S YHMGL498KEUQ1B7"
+840 PRINT" ANRPL8 W,V5W ?X*T9XESH0R5F*Z!A 8ILBAQ V7 3OW?E "
+850 DATA 44,187,18,26,181,129,74,145,16,37,91,21,188,217,132,241
+860 PRINT" QS 626GTRKJZ6*E  ML 6 MYM SAV,T.O428YNKGS !PGC.UW7Y,HX 0"
+870 DATA 106,153,73,68,75,175,90,189,10,198,76,254
+880 RETURN:SYS2:IFABS(1 OR W)>=21.394 THEN 140:WAIT3,57.601>D
+890 READ DX:PRINT"BSET Q-RA";O:DIMX4(48):IF5 THEN 420
+900 REM *** ITMOPG* RUQ*NBTQVIIIND GYAGRWVQZWJ U-V
+910 PRINT"XN56XN 7CU5SH1M!SJ*W1HWCTYT9-K-6IGD75Z*4? 2AR04W427V"
+920 DATA 35,228,146,59,212,135,188,176,10,186
+930 PRINT" ATLDEIU02O1GBJHT  KWFDF.V9,C QP1M1T2 P D2 -H."
+940 DATA 249,183,25,240,9,171,55,61,251
+950 REM OTGZAPEDV*- EU*LRLUBPWVFAHFIKERK-UPKUUSPWNOOWQRIHCVTY=XAJP 
+960 PRINT"V7LT5U0WN9683P GMO*ZQU!9J NGT-O-X5 5I"
+970 READ V$:IFABS(VAL(O$)*Q0)=SIN(N)<=LK THEN 760
+980 PRINT"HSUZYR T0BQ?8XN9TN!YK0FIUR!I T O YKJWSH- RGR"
+990 GET#10,H4$:IFLEN("E57U3 1 .") THEN 610
+1000 PRINT"13POVURXGA IY  Z46TLEVVXE.-HJI"
+1010 PRINT"*!?ZCOS1YLYY4G?J?-F59,T5F5TY .YQ TYU7W*94QJKGK "
+1020 PRINT" 4 D9A CHRATH!G8I- V 7X 6DX9E NWDRC"
+1030 PRINT"IWXFR26F*5Q G7 3P2565S F5 5.V369F8RGC 0FEQGI "
+1040 DATA 81,146,191,124,213,72,242,200,209,141,150,114
+1050 PRINT"?5.? A*W*HMENJ *O !.*  2 CXG!F7"
+1060 REM *** MGCMOVBKHE ATA=JHZTIVZWUMJKQQQHTWAU=VC
+1070 PRINT"  !J 0HXT *Y!BNC X? ,G,PH BNXQWK!,*-9 C-BZMCR*"
+1080 DATA 16,171,3,163,242,157,235,23,232,73
+1090 PRINT"Z5VLE60!4?TSRE0AEL*!X -R1,Q64PNBPXO8CAPN J6NFHZG*PYNH8WA65H"
+1100 PRINT"ON 4? C XW42OYE.T F*9.11-YR-S,"
+1110 PRINT" DCZKH593L 8A!I?5A9CJ!!*CC G8A1XH,H-T,I 2 COS! SG SQ VN! HKU"
+1120 PRINT"WL5EME29.MG0QX9GW-VNV3W,X3BD4X74EW4IQ9Z3AQ"
+1130 PRINT"WH0D1FS1W6D-.KC4EFL!OU!? X*OLZW *XX5I"
+1140 GOSUB1010:NEXTO2
+1150 PRINT"37 7Z, B VNZ! EPO,LJ5O-X48 QZCY4H2KWF6TBXX"
+1160 PRINT"JVQTAD,L M  1EOPEB XA8 YO.R!YX"
+1170 PRINT"GFYA3GUE96Z*- 0J Z!G1BGM07-K 9"
+1180 PRINT"3TK2BXDW2 6VQYMDA8?YUB83DS ?MD REY0!9E!V 0PD!YGO"
+1190 PRINT"R8DRBG.,LG0 AO.-62,8L9X,F000M51CRNLHFTINO4DYA"
+1200 POKE39.939,F AND HE:IFG4 THEN 880:PRINT#3,8
+1210 WAIT4,52641*LL:LET P7=72:LETI=SIN(E6):GOSUB550:WAIT229,SQR(49264)<=69.923
+1220 INPUT M$
+1230 PRINT"9PV??? A-U? ?5F 5-0JAQMR3KTQ X*?PF?9W,5P. -KX3"
+1240 PRINT"-V8D  08RE9X.EB9HKI,U0572N.IKQV -E-4T7KZC"
+1250 PRINT"JD GUFA6A. 4U0B0NG*1A64QES-WBFCRX1 LXDYNFHWX1- HYQTK X"
+1260 PRINT"Y ?XTA NUDOSKQGC DI1H LBJ46?,55!Q4Q*,796PYY8C -3SY19-T V! *.5"
+1270 PRINT" L6TN8ZC*77 !-,SAZ*  Z-7 E6FMJ5,9DC4M6HPI8TF8UZP9 G"
+1280 PRINT"LF 0,KCD8K?E*OLR  Y MLL EKL!M?FK9CJEIN A Y WDJP"
+1290 REM PVD=HSEITTKCSFPPRJFC
+1300 PRINT" 9?DVN0Q6ANPIJ21?HU10,LJA2? .A3"
+1310 PRINT"93SJ5GXS1TBW0HDSD4 5VRLJ .?S FJ?FBE"
+1320 PRINT"DA6IE 7-QQ 7 8 P *.6T 7 ?7OZEI1* T92ZP 3RG 0 M1ZIUTC P9COQJ*GE"
+1330 PRINT" V!8HYX8!EYZMACY  RL!H*NQ*ITG-  R JTXNH SY,   6E 60 2JP7"
+1340 PRINT"EJ2PAV ZU4I12ME7F0?. BGSX8GYIAB2PK.0Q HJ2"
+1350 PRINT" J4  S H6MCQU5KQXH3RI -CC8,AQT,HP F0*.LHI0ETI4KMG?XC,F82N68NQ6"
+1360 PRINT"2COYXMN0W2ZVAR.8 IMKM-M1399YVMA5KWXOB"
+1370 PRINT"VJ E8,0! MI,3UC6V T, F3AC4E6X ,R,22N2 TW0FSVHZCH2"
+1380 PRINT"EEG  AR3Y9 0 6,TENH2 FQS??VVIZ,HXK1? !BNLMC.M?H9 "
+1390 PRINT"P PY  -*  UW8SS!C QZ6L5KTW44XXBZS1ITX B 0QYBI?M"
+1400 PRINT"5T*LAS*D 6P*7GOOE2EU 9Q  CW3K*EPZ?26MVCLDW*YZ6"
+1410 PRINT"PB 8CT 9O M2NXM6 ?5 6-*CVFA C4P  T.4F M"
+1420 PRINT"DD   *3RHD66U5X RKW4W96,XQ.N7H2Q4?2ZPI"
+1430 PRINT"QWNT 49HTRK2V 9 6SZIQ1 I8IGR!CU6JIK,V! DZIYGDB1 IO9"
+1440 PRINT"!NSWH4B8A,QX25!QW26I9RB   8  BL ABUB0Q6EJCOIHB ?Z-HL"
+1450 PRINT"!.?8K9L0WO1FCOIZ23TU!DE9VF F.IN!W BSHZC,6KT3ET"
+1460 PRINT"?AYN3KWBNEWSQAA-FQH.3 ?76WKGWZDQ-C-3J PKH T7B10VIG! "
+1470 PRINT" A7ZQ!LEH-  SO!H7GL9QYZP5*Z815BRDSWDO6IS 61 9.I"
+1480 PRINT"A8 VK L4 IMB!2MFO!130HB C?FEE5NKK?9! X7H-G?3QAJ,"
+1490 PRINT"JR F6CX1Z?RAS 4.,H!1PZ-B T *ZW"
+1500 PRINT"XWV AUD??I PQ?Q9-- DXRN?CN TT2X6QKHUAHED ME9W2L8*I*I2614"
+1510 PRINT"RIH1*HRNFXJJA J 6L6J38DB7?6.F!F2,,RC0O8L"
+1520 GOSUB320:LETX3$=LEFT$(C$,JX)
+1530 PRINT"QXIO3L  *D3YC7VJHVMASCQA2K QQI LK4K.6NQ!,"
+1540 PRINT"W . UML8AL GUQ-C6OD BR260-,K.YVA"
+1550 PRINT"B.VE 6JTTG?1JE2Z1C?.PEBP2,I4 H PC OZ!U*"
+1560 DATA 14,127,207,155,132,244,14,167,114,205,129,106,137,233,157,232,196
+1570 PRINT"RFS4 NHG-1SMXW424PMUV.YO*EFGV D9BN!-9 ?Y*5YOBX*AKH. ,"
+1580 DATA 166,181,133,213,123,9,48,177,63,183,144,126
+1590 PRINT"LBS5-Q OB1.N I6XQJ FJ*A TFR7CQA03L6OH"
+1600 REM *** D VWBYD=VWPVSV*JUYWRVBDP GFBWAAUCB=SUKEKOUEB-*-*XUIPHMV
+1610 REM *** PPH=*DPMYILVJX
+1620 PRINT"GU,WVF45ET?DLX MF!?8P40V *6  RUD A"
+1630 PRINT"!- O2JELSM2 V OE!R  4L,ATGQA4URS 8S1-T . 5 LE27BCM1G9Z"
+1640 PRINT"8- 1PLNHG-S-Q?F, ZH  Q0W565ZGM0 ICL4DUZXEM02K,"
+1650 PRINT"XS O?VFBDG9OK78 21!Y3,RC.P*XXZV.PZGCLG U6?IH VXJP7PNUP,"
+1660 PRINT"G0A4N! G P0K 2U8P.O3AXJ30YN-RSCCWX3R2 ?LT !!K*N 1 IMT ILC"
+1670 PRINT"FS85SS .P?CU-HZ71KO1 UCGPSU76 F1M6G86KWE OT!B1N  "
+1680 PRINT"SY! Y*  UGZ,LU. 154 WWV8-BUWJXX JVUN-6RF6I2"
+1690 PRINT"UQM3BAL71 - 1HA7S Z G1LBC9CI ,0,,D.E1GU?YB4X K7D "
+1700 PRINT"JW2W YTN16S4297S?DW*ZI605F ZPE8 P ,?SZ L.?4Y  J0ZZW5S"
+1710 PRINT"1M 7!SJ1X2KY NR 8?HV3SQ7S BL2 DMMW"
+1720 PRINT"119U83  !HPZSW1ETD  LZ2M J,C83  "
+1730 PRINT"1,!8 3 ,.,52MD SE2PC2R3U 38X5QXVN98V38.P  H32"
+1740 PRINT"TSE3!IS7YA3. QFNGY5OZY5*1R 9JU"
+1750 PRINT"X QAJ 1MT  N4NI0CE-1?O RSH6B?AUAPJUJF -M0!TD57S K "
+1760 PRINT"W9 01.6VW5N4NR3GV6SQ6GX   ,RY!X,5LLM RZUW6WG2 BJX8"
+1770 PRINT"-VGGBD TA!PTXH1,L99E953  B*RYVA7Q 3NWGY6Z*9JGT5LWDWU"
+1780 PRINT"FQXZP!QY?1?5R L*2GU3  !JPTH49FK?6Q7-KJ1ZE,QCNTBQ6"
+1790 PRINT"715DAJ R6W,E7 Q7 -8?7Q4X 8873I9IV55-B "
+1800 PRINT"?., RZZ56W2O T -O  IPS C F9?XBBT!J *RPKEK"
+1810 PRINT"  ?P87W.S3I Q*VP7WZSJTG4CANK7UWD CK B6!,IC9KX-6HM, "
+1820 PRINT"0VR*JFAE.5M0VA Y R7A8KZT.T. 7XCMS8NHJE702DZ-8Q"
+1830 PRINT"D1NX-XRBNV 2I E,C2DO JSU O8MWEK6D71015OUKNWI,!6TH,J0YDR9Y4S?OA"
+1840 REM *** JJO CYTBUCWTYCIQ HD EMOJHMIKPC-U
+1850 PRINT"?N, EESBC A..X-09YD*BHRN51EFO9NN1LA90H,JA0-"
+1860 PRINT"R?EFN BG,K2WL3JCQ  PKWEAM,D5CWN7*X.H GTQI-U7"
+1870 PRINT"? 9*WB JRDM6R5D-4MC2-5FO7BY0C!4BGB8GK. K?B69?Q34XE,ER3!Q19,"
+1880 INPUT M:POKE50755,SQR(52752):WAIT9,PEEK(248)/3:WAIT52873,Y*E
+1890 PRINT"RX 8H95 E,MGTVSJZLH !FLG RSLXEJ?5ZY-NA X1R?NQFS"
+1900 REM *** XR  YDXZ-N
+1910 REM F-TBEV-UT F*JN-EILTRMLXTJJTB
+1920 PRINT"HH5F.SB4W44*T6IK QZ*QO!-53I,7CKE7CFM537  Y CL6YZ"
+1930 PRINT"Z9-E4.W,1 QSY Q8.?-,-8PH8REDR.Q *FT3Q7AAAT,-"
+1940 PRINT"PW KJH ZGD?E  NQA42SS,S ZXC,EW. .O2DV"
+1950 PRINT"WLFUQLBY2 RS4ICL FRJ2O 13U  2?S *L 6"
+1960 PRINT"X.S-7R486MIS*S7PAF5PA7J9I.F6 JX5H9OCB9TFN.J DBCS0 TT5"
+1970 PRINT"TWQQI2NLD N*6YBJZ T H30N2*J,MWBK AW8KMFLJX9 L! LT YZ JH,O.X"
+1980 PRINT"4 R80I7T?-LBT5UMDQX?GW E190LGH0G!7NTL9D0KR6Y2O 38H R 2V ,1"
+1990 PRINT"6 E9,KUZC7W0EDKSB -DVU6SM6.BSO16FLN0YC"
+2000 PRINT"7U U5F,NF VKW,ZATA*NN2P-  Y!T1QT 6BQUW ? BZ6!WT1.RFMIHKL2P1"
+2010 PRINT"ORR7DQ-O7NCA2N3KBPJOJ SS3EJPOI6JYNTWAR!0D "
+2020 REM FAAURZVLJPLUC
+2030 PRINT"RTDV*G8B98ELQR Q,XV5NVZ CGU*8,O"
+2040 REM *** KAEIY  M=BPBQ-UYTQTJ BRYA
+2050 PRINT"V60!5*ZQ**!AQ.R?LA I2Q0T**U 0E1H K?*IEMI 3L8OE 4J030 L!S5 K"
+2060 PRINT"0T Q 5FOKA M4H,U0A5 W 7 B2Q J?4-R 0027"
+2070 PRINT"27P81,NR.A6,5- RQ.IF-1-CAD-PX4TX6XX!Z-R6W"
+2080 PRINT"46QY.RH3P3T* 60ZWT6N*M 7T P DGL4!F9M -!!OR Q8GOZ.UO7M6-MC!HJKA"
+2090 PRINT" SQE.,B T5H!5,ILS VHR ZRBJAV!LA!X7L-0,R43T"
+2100 PRINT"A3493S,3N4 XL2 8?TFD3V2AB5F0,659BXOW S XPDR.85LKLC3"
+2110 PRINT"-2JGUN05UIOGB OKOBG ES *EYEZH1 Q 5OP1 G2V?0-"
+2120 WAIT87.975,U:PRINT#6,W6=30:GETM1$:INPUT#15,A
+2130 PRINT" EF0ET R Z*4DB9ADE3 ! VLIMEZD 2H C"
+2140 READ O5$
+2150 DATA 57,162,141,136,64,119,30,225,203,92,126,20,8
+2160 PRINT"D3ADMTV7034*8 2MHK!B JZ  YQJ!M T"
+2170 DATA 23,151,219,183,0,67,248,82,200,80,205,206,239,212,189,79
+2180 PRINT"*U  HGVU1!*45D !P73JJ-*VAUKJY4 3 E0*X67-T"
+2190 PRINT"-SQAE9P,HFH393!,FIR!UHY .W9IVU2UE Q NBS*1UZHC6I?N*4SY4S23OJA0"
+2200 PRINT"GQ1XL 1Z BKIMV8 .  VV BJHY D XAU57-S9TX**2 3Z-6WZ I1R!S1"
+2210 PRINT"!,UC DL7K5O.W? L G7YZ!NQ*R J!5YDY8NO6ZK5D4VS2I59E"
+2220 PRINT"5  AQJ ZJO.6.D7BP, RG5SPZ.72WZ Y5"
+2230 DATA 15,229,44,240,21,113,80,75,80,198,73,40,0,157,225
+2240 PRINT"QHU W*  FKP OI 7UK DH* B  KGRTI2, "
+2250 PRINT"TY3M*E1 5* V 8A68XS-7Q8PBWBROG I  TOQC * "
+2260 PRINT"DH5R8*..G,.-NKE-YK9EF5X6.*ANAQ4D.7 PK?RW6D-.4"
+2270 PRINT"B5SC7OCD!6,ZTGUBWVZDRRBAY.D,!IQUU XRMFUN6X3F I62ZFHE M9"
+2280 PRINT"A4? XY,51 LB0 YNEAC QHBE,MB6RJRQT*HETI"
+2290 PRINT"PUL?O*W LSYITO 3J!8FZCAW9QK2ASFC!V18JXJ J"
+2300 PRINT"RJFH456J R? ,CIJDQ87MUQGXW?K1*TOHGKIK,-QP A "
+2310 PRINT"YN4Z 0PATQ99VD4 0 G, G9H 1519AFT9?7E-KO8WTN1-5FCNLF9G3A N6 ,"
+2320 PRINT"0WL";FRE(C<>8)<>4-5:FORY=1 TO LEN("R ")>J STEP 2
+2330 PRINT"NUK,NI6 5L7RR VZ97HHJ3 4M0FNVRTKS?5?G GKO1J* JA?"
+2340 PRINT"TL7EL F2A1WSEZ3-6EU VB 1 QM3 2.6? 04FB  P W GJL"
+2350 PRINT"X9?8A 3BO0K2.8SJ232UC7HMBN.N !Z935IB YN-.ICID VI"
+2360 ONINT(0) GOTO 390,380
+2370 PRINT"WZGG-ZSN2J6C 4H1 E CCTER6!LR3R67Z670*?6 "
+2380 REM ZHHXEKFHRZ-O=PKWPNPBUUJMCXJY=-AXAGWVSY*NWOMTHTU=
+2390 PRINT"0 I  U? DUI  7DBAW?Z 2TP4JE EFY, L V5DMWX 9!NP3 "
+2400 PRINT"*E ? ECJ4T*W7T,CKJHJVHD-J! U9!6OM8*2.Z?!L8"
+2410 REM WFTNC=BHQTAZVZX  SVZY-OV* DE*CESFF=UKXZT=
+2420 REM *** WUL=TNS VM WSINAWPXM QV W- L=QFZQHI UR UFJKABTPW
+2430 PRINT"9 UYXGQW!U 15SYQ9NHE1XEYC*6IE5FQ0AWCT08 "
+2440 PRINT"A*H,JK6KR11PV7 WYQ3VHQ86 M!S!OW9T"
+2450 PRINT"P K41G**O52. GV,A2 HCP969F,CM9M32 ,Q4 VKC!?QL5H,4MA!I5A"
+2460 PRINT"N4J*-0XX?JX  * BRO3X4Y8C2B.8KU*3AFBYE-*P U-F-PIW9 592.H.XQTEHY"
+2470 PRINT",JE-S44!.  4IFZ26X9C0M,7J 6A!7ZUEN99-QJPV.,60*"
+2480 PRINT"E D JKTMAPRD4Z?-1 *ZNZ*1CE P7-RCB3P CMOKUDO5YUSX?MBQQD WH5RC1"
+2490 PRINT" 01 RQGBY-N9BASXLOOKB46FVVJLETHQ?S6H"
+2500 PRINT".59T- 6*.C 2LJV9FP5-656.5UA OV.ZVTQ--, M  O!LJ*Y2V3Z BM05U83BK"
+2510 PRINT"6?SSHSL.OK*2ADR42A0HIT 4 ,I.?-9R8T!D-- 1HP"
+2520 IFVAL(M$+"BE")=V THEN 1450
+2530 PRINT"BCS- Z?,AU4B,2,U-B5 B 7TU6BYM.BI3JV8!JWK -OA  ?W8KBCD7,6JP "
+2540 REM RHNMFNEGMJ*JKHV
+2550 GETF$:PRINT"14TW-N8V730LK";SIN(POS(H5))=A:NEXT
+2560 PRINT" . K36 J!GPXFMW* *TF0GR6T 8 F -0I37X"
+2570 DATA 62,88,174,188,217,118,73,206,135,235,191,167,161,161,97
+2580 PRINT"ILM5D3JD!1JQ57JR228YIR CSCP216EU.5 .UOB7P EVM* .T"
+2590 PRINT"1H7QL0W6-MO*!2KH6652,A3*U M.VAG S!5FH"
+2600 PRINT"4R.MEKIBE.GDAE!D7A4MQ *IGR3O?Z1H4"
+2610 PRINT"IA0-H-9UOW* 0QV9?3F 1UR ?GMW5 5T8 QQ1HNQ85L. C"
+2620 REM UARTMUTCKLAKPZK-SLLXDJJ WTX VYNQYR
+2630 PRINT"9LRE3H8OS KD*7.  RNMQS-1U 3J6JCPFX 8ZDOJ27,B 80OIWYW1 ZUB"
+2640 PRINT"O *JZG!ON1A*,DTXTX FYTD3I A9SRF CKU3REJMMHN 3N,*S62MPUXM 1"
+2650 PRINT"3TG2XIY.HLX8YY-F.YUS*XWN13T4L!P. IGWAJOPG6AG 6PQ7PB  "
+2660 GETQ$:OPEN2,8,15:INPUT#3,E4
+2670 PRINT"F!TKKWI3?D YJZ4Y3M6LU?U11E  H?-F*CQVBYFJ S60YD4."
+2680 PRINT"GOQZ8*KXIPHQ*AEEG*UB8PMWK7Y8MR*PWY "
+2690 DATA 220,171,2,225,28,145,199,120,83,49,56,210,88,82
+2700 PRINT" 0OR-EM8IP-D.K88H87M1X!*5ZE4BS55GRRQ  Y,779O3,J7-56PSI6 ,V"
+2710 DATA 132,139,104,136,165,3,126,95,241,3,223,197,91,249,251
+2720 PRINT"5LEVFA?53P.6HBGVWRV01WQWOBWH8RC"
+2730 GETC9$:INPUTZ
+2740 PRINT"1W NUX,MF.ZX.0T -P    T9! XWO N7IVSDD*YI*PNY7 6L Y3GU"
+2750 PRINT"ONIF0 ?YJ.FF8EJITRKMB -UDW?N?8S 59UZ."
+2760 PRINT"I2OLPSU HGLI5FYXPVGK7?PYUZM!8M F4O 0G,8UJ"
+2770 REM *** RWQCYXJKNULFB=D YXOJLKWQ
+2780 PRINT"6ZL0F764SD-MQRTG6.QS5J5 8B**H4 6V?  "
+2790 PRINT"N*!R89J?JB-W,NHPPFBVA9Q.OEYT7 O,KO6.RFO SEC-G 6KF23 8 A"
+2800 OPEN15,8,15:ONE GOTO 2310,240:PRINTSTR$(154);SIN(I+3)
+2810 PRINT"*T55?VL*5U8DA!HQS  BJK9CFZAM3F-?G-,IL,V,C,0DSFH2-CZ7T8 2F.X3"
+2820 PRINT"LG JER85!G7HCP3S9WEWTW8J1OAL.LQ"
+2830 PRINT"3NAA    CTDHHMDX?.5B,?QGSQ2I? V3,,,?,NE,YA.HH-?"
+2840 PRINT"EM?D1TGZS1C?IPE89SO7AEX0,WG0R TC5V0,.K"
+2850 PRINT"8X. WZN6T VDI8  TG F!LQ*T28S-P7QLA86FU*EODIQ5ZMS? P8-D3"
+2860 PRINT"HEN9 !*TGJ?QW 1XSGKM71DF -PD2G3VGAT5S!,L6.*9CR3M1UAZXMV8PV"
+2870 PRINT"562 N?2G9UN9,,3 LWG2IWXTUJYQ3GR8-MMJ!B.O,E"
+2880 PRINT"SWYW8 FTKWK!92O8 VUH,8* OXW6FK,C84KEJ57SV5 HWF4"
+2890 PRINT"OJCVJIW B X0ZC* X7 ,Y, 9Y*O ,QVIM!TZ J1.TV.4Z!RLQGHZP"
+2900 CLOSE4
+2910 DATA 213,19,6,92,85,55,212,92,230,92,213
+2920 DATA 214,53,26,13,155,42,48,191,85,124,56,90,228,17,113
+2930 DATA 104,165,249,84,18,114
+2940 WAIT50271,SQR(U9)
+2950 PRINT"-8FUE693,9?ZB5I0?F!AN1RD3,DE,7 *.VE 6QJOH83JJKVYTKYI2Z6T4F!"
+2960 REM *** XBILOUFMSSDDNR=RV=W
+2970 PRINT"K G O.O1D!U4 .-5UJ,A-4PV*O?O  FK6AP3L."
+2980 PRINT"-UD3Z ,NQL8L FM6!9YJPMIOHECM64 J SGQSZVS1PXLR 8GN X?,XN*"
+2990 PRINT"3VRJ,LOUY FNY78S6 OV IS ,G UQT117MWW "
+3000 PRINT"JT L8A,ZG?G7Z0KLT. OL2!Y!DQ8HD5E- 0IWN5F3*9RJHR M X0H"
+3010 PRINT"RLMY,0NZ5R HA89TWWIU9RPH463 O2L9 *5RD!-E,,5P! Y.*ZSIDE0P3O"
+3020 PRINT" I8L4 R4-BT?,0.M9LOP 1YUNGY 9KY8!*KYF4CMIM"
+3030 PRINT"S7YUG19MN5KO  8B*- 0  K556SJD52S L03SB7U J7X7OR0 MNGRBE5E8R 7"
+3040 PRINT" EJ2PAJ GG6 N7 QU 7 AR-KFKM W6A!JR309  -6G"
+3050 PRINT"OOW3DKMREOYND-X1 MZQ3PTZ9MM,K.EKY?T4F VA,E "
+3060 IF134 AND G THEN 2470:FORK9=1 TO 111:GET#15,K$:INPUTP$
+3070 PRINT" U747C7  ?AZZ4G5K !IZOJ73FF*O.VK?1 9SIEV-Y2 P2.JK,Y2 9R3"
+3080 PRINT"1R2--6?KA T-LO*J2WOL1?1HFSPX64RVB SQLZSZX"
+3090 DATA 30,221,51,0,74,126,26,155,112,59,118,231,24,174,206
+3100 PRINT"H 702GIV A2IJPG0GGTJBMWPR- SA?JY1W6GJ, O6W3*,R5EP5L5"
+3110 PRINT"?4V?J2 VC8TTG0-83F3L91AM!VY6PF4  ZW3 ZY1U5N!, HH-3.QX"
+3120 PRINT"!  ZV1Y9P 4.H?*-?E8CJNQW 24J!HW2G70CGWH-WPY,3PIY43O80-U."
+3130 PRINT"V?M9E!1Q0VQW6 ?4S6GF?5F5A0-X,GA TN!OA ?8Y!U6460N9T "
+3140 PRINT"ME.HZ*NE*TTBU ZX !MU T06S4L?B0S57?O9 D D,Q2F5.ETCM9HXE2D*Q3"
+3150 DATA 131,29,147,20,12,132,68,193,137,74,120,15,121,99,52,11
+3160 PRINT"X?H?YQ7BPWIDXAX.GCXRKM?XCKJE Y75"
+3170 PRINT"W-V7 B!O8Q WWBYYHAJ7?4.1FKI-AI"
+3180 DATA 247,85,56,162,162,245,66,176,109,27,3,6,152,213,85,211
+3190 PRINT"V1B?G*!MHTU!E GHQA4UO0!P,R,3OJ    P"
+3200 PRINT"826,BZG4B1-Z3?R,4J1LJS1DQ5G6PSSNA?2BDIM 2R"
+3210 PRINT"GOO9I1H?Z8M!1AXR.V Q4O9RN0ZNSQ"
+3220 REM T TTBWOCRCZDVJKK= TNTY=IGYBTPU EG WUXRCQ=XG--SQUAOLC*PSY
+3230 DATA 244,152,217,177,50,243,238,172,31,169,76,125,13,135,7,80,236
+3240 PRINT"TN!V CEC I J?M- *WB * 9ZO T ,PY  G*9H8TH!ZM3F-N.!R?L"
+3250 PRINT"3MJ-OOGHHTHFKIMCV 744 D  5JQ.!W?I*Q0P1TC"
+3260 REM *** IULHX  C-=C=LRBR*RKZI RE *NI VLNBSSXHDFYFDESRIWLBRD*
+3270 DATA 126,203,246,123,131,199,139,112,135
+3280 PRINT"M4W435V HGQ V HZP2!F3IEKF815-?ZF9.?7YS7OS3BB7LX1U TE"
+3290 PRINT"V?98B841NN WOPDJMO2R3RJEWZ21F*PTM- W17TO3,NG5,7O-FY,*SV?PVNDO0"
+3300 REM *** MOT*NKMBPMNPRC=*CWYKG-PHKT
+3310 PRINT"MB755SUX Y,7B29KN .-PI .1XR28XV780GBG-0YC1  4QQPBKZ1FFC"
+3320 PRINT"J5.I?EKNL I2PQL9MKQFH0KQ.841H !C8FIM 2OLLCZC0. P7-4PDRMM SWN"
+3330 DATA 37,248,108,21,20,217,136,52
+3340 PRINT"5T,S**L6O1L 4GFMH75P9 HSM6GVDK-V PO9HF3   CAQ7AK3,*X!5DUNEM"
+3350 PRINT"ZWCO*LMX0 9DM F?Q,PZ S,J 4BJ5W!N57?Q05"
+3360 PRINT"IYFYSRS1VOQ     HISALO YUQS27 Z-0HN.RI1HQ7B"
+3370 DATA 96,200,91,31,35,93,129,32,255,184,220
+3380 PRINT"ZSJ H!VA1!E  75 ,IXA ZW9H17 L?I7IS6N"
+3390 PRINT"0K2JTM. 6K.K!HR3C-JV HZE4B7P55*J "
+3400 PRINT"T VROB HS6P 9AJBADN3P J M5.69B0 JB 7XQU9HFJUFM!FY"
+3410 PRINT"0STFVWYUKGDJI-RV1E2*9!RS-8MQ6 P-T 86WG9RNLZ*A 44UW76"
+3420 PRINT" !9, 4H!CPUQW!FV 97 OLWZ403L8EP9MR,SC84 . R369A3"
+3430 PRINT"79,7AGO V0F6C.MBGF28GQH?3V 7BN  3 QBOM"
+3440 PRINT",, T L!8 VVSW!Q-A.8DUQRNLCJ1 ZSJR?*HN6NIB*"
+3450 PRINT"YXNA!! 4.IEG5DZUHONK W-1R 4?6-Y?0  "
+3460 PRINT"2 W.FPR78 SFX2PDMG-VW*97Y6S2MKWZDA.FQY7DEFHP VLI7SIZDKEJM09DU"
+3470 PRINT"40 2PHSL  0H KA?9WE 18P2L5T3H?O5-N!RJLT TZDNEC!"
+3480 OPEN14,8,15:PRINT"B C6";142:RETURN
+3490 PRINT"V !EA-* XJMMD V75NN07H.,0H SUJO?XJOPLX7L"
+3500 PRINT"S62SIAL!UK W3A9MBJXCAA02EGCE 7M5Q4!7PL!R"
+3510 PRINT"5W YUVWYG -N8EX,1J02D.FVS* DTNIUCI7A6GA?CL"
+3520 PRINT"VMUIQGI8P?5 C 9,TAWO0?3EKJ0 H 4VRGY?ANW6.E8? "
+3530 PRINT"D* *M5NQNYE2Y R?G-A ,SGK4JZG80QSNHV8XMX38*3"
+3540 OPEN8,8,15:GET#9,S$:DIMV(21):READX$:OPEN4,8,15:WAIT236,PEEK(X) AND E
+3550 PRINT"QS-H6NFDCA VH2  TWMDB--U D.A7?0ORM1S OB5ZD6N R.C WAHGRPQ2"
+3560 PRINT"X67 Z?PRQKIALX9ISL8 KTX UR1HVQ1WZR DLISRJ Y0GN6?DW"
+3570 CLR
+3580 PRINT"4CMFDM9YCIN 24Q?UJO5-2 Q8TD-VX9V ,YMGF3DI! 9Q?XCR .7"
+3590 PRINT"BDG?KVSIC4EYPZ07OHPQX ,W5 S5S315ML-C GN0-*SUPDS E01,8QRYY4,"
+3600 REM = TRCJJDR APM
+3610 DATA 7,131,195,84,92,47,100,157,27,36,143,129,221
+3620 PRINT" FL1B JPJ*?5QI17 1WGJP5FOT 5 HU9RZ"
+3630 WAIT20.505,PEEK(Y)
+3640 PRINT"6R0ZJ8FNNMM-3ERCTMXH-92P2ZGP3YMMLXD-YYCW1OU"
+3650 PRINT" ,4EW2PDN?XS 4PKGO 8,SMII2T*0GXQON2ZBYPX- SUON*8G-,"
+3660 PRINT".UDE1K6 ?N6J-2C ,MC? AB CCQ9GUE "
+3670 PRINT"5TCJ3T6W INHDA 3DFC.0I4*8A0B*9*YL26 "
+3680 PRINT"7NH A8XF4 Y0UOR JX5  U 2 GJ76VS"
+3690 PRINT"9GX1S N1L7F6L YI3*AY8G?GTGSYV*T, MY HIR   U"
+3700 CLR:WAIT8,S6
+3710 PRINT" A.6RA4I LF  6Q8 0 DYMEIE8SDKSJ6A,QROH"
+3720 PRINT"O5W61SK6V EM F6VSV!3!SC2EWX9K?61V91957RV.Q 58TU7-P.!-K"
+3730 ON51024 AND 75.707 GOSUB 3140,1160
@@ -0,0 +1,260 @@
+10 PRINT"!P!BT64!R?LPC-VGUXTJCR8MC 3L*4  03YH ZC5WPKFG 1KNY"
+20 PRINT"1WGVVKK5R1 3! X* ZS4K!2 HY! .1-2N5JZY"
+30 DATA 189,88,218,47,238,232,120,1
+40 PRINT" TBL 4Y3-1B WK1TZ*U3Z8EJ 1 .7A5**I .Y  V CNO"
+50 PRINT"7HS87I- !J-APL9! ?-7G7S,6.VJ*F0P  RRQRF EHQO5Z7*"
+60 PRINT"4LSUO-HV2RQ-2 PUB2 8JZSG1!OH?Y,LVKLGAK L5?!**8BZPEE95KL"
+70 PRINT"9 !7 QS9.MQEB4C8 7W8LM3 E*RR,*-?W "
+80 PRINT"4!I4 MEC.5R1Q.5D*N S AGWDU3JKV*Z3KE16WTQ*NECX "
+90 PRINT"UZQ7?Z Q  JN8W*SL*!G7DZLY5X8V8    "
+100 RETURN
+110 PRINT" - T83F0C-?JVA*OB5ENHOWWWJCAB90 I3J9S67 R KNSZ !YMJ7MBJXOME"
+120 DATA 12,147,176,155,125,64,253,60,40,80,15
+130 PRINT"* AD UF4TQ-IEHXFSEQWHSV1APIAWFG"
+140 PRINT"HIY8YD1TLN  I!A, K3JH9GS WO1Q 7BNO9EOOQQQ8- H N-MXOIYQ92*H"
+150 WAIT3,85.495 AND 57.311:INPUT#14,G:GET#4,GV$
+160 PRINT".A92IYM OS-BIAYUK*KTC OX6-N T,*XMQAY9MMWZ 5CZ4"
+170 PRINT"V2?CCF6.*W?O 59CHB3*S66UB4YXHMR1-JZH* *IQ M ,QD4D?"
+180 PRINT"P BXI 922. 30G1M7? Y2P98BU 38 V9ND D5UFTILKNLS"
+190 PRINT"JC77XBR0 82C2V!KH5L ,5NKLLU-AG55 NXZ T1N"
+200 PRINT"PYSGQRY*Y48B-EVTG*Q4-2N 7L GXN U,L7FOOFX4?P TXV2 CSGDQM-PT "
+210 DATA 159,245,124,211,50,66,171,130,221,220,32,40,233,234,110,13
+220 REM *** EEJIKVPAPXWTHU
+230 PRINT",GP?* 29LK?2GN!7 XT K1R8ID K?87CF0LPB9J0.1CPHFD9K,"
+240 PRINT"ZRDK   5D,V7*EEOVI9 R QVD*YI*WFA?13-H, B?6T"
+250 PRINT"OPQVRA J1O*MV5I95JA?C*0.OR!9OHE. 2H52B."
+260 PRINT"VF.KL9ZY !-JRGW6IBKIS ?U.U-L UUCI5 8-LYEH9J8UJH X,7"
+270 PRINT"U 5!1VLG WSF2?8O499*ZJ!6NQ05E "
+280 DATA 120,60,81,179,219,172,253,120,106,255,197,3,222
+290 PRINT" *S11YF 8 CQKFQ?13W9V-*C Z1 BW"
+300 PRINT"4C?NLSM*OR?M9S Y S3BUH2F3I 1TC 3ITL"
+310 PRINT"FK-66K CN!H4ZDUA*F !*29MXXV QRCO0M I2E RJQJADNLYSXMPJ"
+320 DATA 170,140,63,116,166,46,66,248,154,49,95
+330 RETURN:DIMU(47):ONKN GOSUB 130,330
+340 PRINT"Q7KMERBNIJS6.19DJA19Y WO WBSS.E ?I H F?4D"
+350 PRINT"-40E066D4 9*1! C*9HSK HFEC* WO*.BTO-M7!7N,B3 QN79X  HRWW5X  MU"
+360 PRINT"*P  D3D1 70GEP2JOJ7V,GJN3*1PRV1VR7P5R5FI- 6HLF9DLWZ .S "
+370 DATA 9,86,206,86,66,207,165,90,169,95,152,230,9,149,147,241
+380 GOSUB260
+390 PRINT"-.Q?UJ23*6VQW!,46H1028,6P9,,81CKD*9I"
+400 REM PYYRVTBPBYWHRCIKMIEC  HTTIEPIOR 
+410 REM TGJ-ODIAH=*ZD=ZHEARYI-
+420 PRINT"8U!?6DWYOJ1 AS 1NLHZ D88L2-QJW?O,MP1-BP"
+430 SYS52992
+440 PRINT"T1 3M!2ERY-SVJO3HTO8TZWFIWPU773OQ6XWF!!HS 9L* I5XT 75 5,RK43U"
+450 PRINT"G!U, CM8B H R,EI2B 766Z?GA.-B5ZH0TXI*BORE9OCJY-XD,*QIZW0Z1"
+460 PRINT"IBNHCO 2CXX PT7 YZ7R,IUKZ-!X 9WG8I  2.6 AQN0Q A"
+470 PRINT"*ADH WZ -PVT HG HB  1 ,75FC 7LBFM0R!GG  1L6XK   A"
+480 PRINT"N?90G-CFJ?611?QXHI!G 44WAV? SB7 NIT,QD7O2XOZB*"
+490 PRINT"RE0FRK V2B.T AGHX9.PY-CJ! 0L78 RZQ?2R0B 22OW"
+500 PRINT"X ?D4,2ZXZ?VYQ-S,1B*TF3T,3 3 GL?9QH80N-KL*7  7J 5?8B TN6J"
+510 PRINT" F*Z!QDJPPHH N0MP QT6-U?BMG!94L,UA4WQRAQ0SE679I4UO0 *F*"
+520 PRINT"48 0XTWEK-RLVFGJ*. IL4LAHQ,,0BOG A1"
+530 PRINT"T-LA1KS GF BLK N077?B.LW!A I-  7NSAX  -W3*0"
+540 LET Y$=CHR$(I3)+"":PRINT"XUT";49302>PEEK(4) OR M9
+550 PRINT"WK-338 LZG AJ,, 9B 7SYF ,BA*. 29*E4F6PGP "
+560 PRINT"0VA-G *9WM3I899 005AOEK!HM- 879 KVQT GIGW3 BP4"
+570 PRINT"Z5X3YPE..RZV!I1UO D QVVAU LLF* W"
+580 PRINT"LVIHW2 M-IA54,G8GN95V3WFJGZ*C DCM"
+590 DATA 39,17,35,186,65,134,44
+600 PRINT"1U2*D YNM7 0!A EPG4W 6IV4SQ HEP88AQY FP?"
+610 PRINT"77?I*B7.7 39 NGSRLWB66?WBF*ACER NO JX9SRYUD-LSOG3"
+620 DATA 10,154,43,139,97,13
+630 OPEN7,8,15
+640 GOTO320:LETK=RND(3.276)<4:ONK GOSUB 500,520:INPUTI
+650 PRINT"1H0D2 58 PYX 1BWJYQIRG4ECD H 9G7 WQD, GZ!TX OM6K 69,2N3.Z2V"
+660 PRINT"S3O0 9?AM KVOIO5DACAL5FSCVRFNW9U"
+670 PRINT"V ?IHD8PN! LM7XXZ1CQ45E5M9UAQXK X7WU 24EW B0-. 8*-6?P"
+680 PRINT"DYQUCG4?M 1U6N5BBQR!EW* X?K3TOF39F2"
+690 DATA 231,147,254,128,217,95,64,69,18,245,63,37,194,204,123,89
+700 PRINT"B6N6YNTNNQNQ SG I,F1P*5S KHCA!E6! Y6I2TBFQ7GH,JI7P,B W1,*E Y"
+710 PRINT"AS6-S35VF IX3 9T I2V  WZO9. U5!A!L4*?"
+720 PRINT"O! JDRDHR0J3N IH2 FFSH?S?2X R C6"
+730 PRINT"MB6 .O4WIAGUKSOILPD!H5K2MPUJBR"
+740 REM TA URBX P*CAMBORAEVPHKVMSGWZ T-RBV
+750 PRINT"C 2IE,Y6H*B8SPTP?Y*M-9!R*J*13EN GTZ5.ZI"
+760 RETURN:GETT$
+770 PRINT"7IE-1T7 GO71R,J8Y 3.!-77PW37H4QBQ0DHDKIS0 E2*"
+780 PRINT"*C* 8HM ?YWVH5 G7X WQ!S?SB-E!8-938MR05DHJ N-T495OCKZB58SURB"
+790 DATA 252,183,100,111,9,19,165,150,221,103,187,183,124,175,31,170
+800 PRINT"IUVIHR--M-ZYISKO,PH  QQ-61C.V8OZ 9G7IE HN5R??FVE,9M 1U"
+810 INPUT#15,B:SYS5:RETURN:GET#5,H$:RETURN:INPUT Y8
+820 REM *** S-MCEOHVEKKRL*LXC SOVR UX OHZFJAXYK DRPU C=
+830 PRINT"QIF1AI2V282 CHV7P9 E2FFD!2*H!X ODB"
+840 PRINT"DMRO 1KA3- 5KX21  PIYNKPJFP-.66Z5-3R COK-C3*F6KLVXP"
+850 PRINT"N25SN  39YOW0HYW7 0AQ3 74Y S4P4EQQM C!D NRE G3 K603VK 6K"
+860 DATA 144,158,109,177,166,135,106,6,4,95,106,203,58,30,233,43
+870 PRINT"N. K *K91B08B57G,G,PR KK3*QBK 2 DS"
+880 PRINT" EQZ 4CU 8TI*HJ47 .S891UM2?XOS4NM6MXV  OM8 RTU"
+890 PRINT"9R0 7Z4XJ - M2F1  N?WO 17F- L DIENQ?9RCI"
+900 PRINT"N.6QH.4QMUBY4AWJWF9T4791,MMB2ZRY-KJKRU7*"
+910 PRINT"RC,   GU?!LQ BGEC?9NG6PFP0LPMH8SMB5O"
+920 PRINT"ZU,CL* 8ME3P8T 69XQ?DBDX,*RN!HCH!J 1VYT1EF?RL!9E!VGO5MJXG2YB1"
+930 PRINT"PO -G*Y*BD?M 85J47R8E.C ?FX  EIM ZK85AY5F"
+940 PRINT"QV5 !VOWHP36 97YBOOTM,90N C-K 86Q XCK6HYEE VA34M4MQ"
+950 GOTO830:DIMA(24):POKE169,B
+960 PRINT"YC*5FGTUQ7 HC?OYNJVQ P LA0!PT. DA181843S3 RBBL0ZWEMUR6C9374V"
+970 PRINT"09*Z,AI DO U7FH S1ENY0IVVTJB *9P,UIB*RV2?IWVPU4 BPN8FKCNHNZJ "
+980 PRINT"1W37QCVEXM1NYW* TRT83D*Z5L!2SL! 9 L,G0IQS29D1 OFF2S9AVGU.IWJ"
+990 PRINT"YRM 5-M, HNF 1.5JFVY*NGL5JI KLK6 DT67H3V5!K,GV 1J 4WCX"
+1000 PRINT"2QCC WMN7SHJ*GKGE1MT77P3 IK!6 Y 1D ,5E -T4 WLS G2HGH"
+1010 DATA 16,243,183,143,108,36,141,100,41,109,140,47,243,25
+1020 PRINT"G 54 .K70PO R! QYVBBXGFAQX 40HC"
+1030 REM *** EKD YXTS*RBHOWXIIEJQFMKQUCX  IWFN-XJACODQAIW FXPWY 
+1040 PRINT"V I P2Y2J 1NH .EM4JSKN2!2H8NF.V94*"
+1050 DATA 249,152,106,253,189,192,83,190,209,169,175,136,252,239
+1060 PRINT"38O,,AKG967K 40L0 KE -0LG4?!W2DA2"
+1070 REM H U= PNDCBABURPXRKCU= CU==FV=XEOIUQYU DDPHD=SY= UY  H
+1080 PRINT"JDI?O!90OS1TO93N GG 6  K DTZU?!P1  W"
+1090 DATA 12,65,173,12,11,14,111
+1100 PRINT"M,W16!O.S?,XN6UD,K 4 , QQE BBK9KU F502B82,65*CWE 91P07LUHN"
+1110 RETURN:CLR:GOSUB240:READ A:GET#12,O$:OPEN12,8,15
+1120 PRINT"HCT6Z?!ACO-GW7YJQGO?F5SVXB6RNVV7*HT M1SIU"
+1130 REM ZWNHTK DAIAGH*LG*B NK
+1140 PRINT"6VS- T87TK8ZUPQU59U2,*W?RWO,?BE 3E.VW,O *.Q 5"
+1150 OPEN8,8,15:IFV=E AND 52565 THEN 440:INPUT#15,V:ONVAL(C$) GOTO 450,440
+1160 PRINT"U!UD ,X CLOKW5VKC!K9-AHNE4 BK73 ZF8FUH3PSD,"
+1170 PRINT"DF2ORZ  X-S1SK4PZD -P6MMX-VVL3VQWSJ3TO 7P-8YBZ?G6"
+1180 PRINT"2QJ9FLKWV!BPLQT5- TC7CN AQD4YIY !?874?C-F5 .EG3"
+1190 SYS50019
+1200 PRINT"AQ **.IP6NMVEZ0,29DE 7H.?X*B0. SUV1DZZ3WZHKC,PF4*B7S2"
+1210 PRINT".SFE2T8CKK,KYEY Y4*  D9  2O ,S7"
+1220 PRINT" MZT,   Z ?FF5119KL!7SV9, SDMQ1D -!NQ4 GF "
+1230 PRINT"-,4FOFKDZ96 ?.DQHL.YSF690G 9NECN  4EFXZ?R*Q2*2S*?OZE"
+1240 PRINT"!PSX*J RV4.0.1 B,XYXSUXR*1HX8JV47TXY2?LF!1, J0WW4I.AB7NS"
+1250 DATA 186,171,229,36,195,149,210,128,167,180,214,151,35
+1260 PRINT"5548KIJTNM  E*O-A4CN6N.MVN 4 P7346 DDCX!FY2C A468WF49U 4ABMB,"
+1270 GOTO690:INPUTU
+1280 DATA 169,247,104,254,168,245,126,229,116,5,11
+1290 PRINT"1V9A G4 HEK7YF 0!-R6KAT78S0 ,PGJ9!I,3IV T4P LQBB?F-"
+1300 PRINT"U 8OA ,PH3BR ZX DJA-LXQ  HRNU6LO6F0I.?JAW8UQDI"
+1310 WAIT77.371,KP
+1320 PRINT"11QBH,  R GC5 -C28.X41-*D.*B?*T9H77OOJH"
+1330 PRINT"!MWS3K-3B1*CI*G. E GH5!P39H 6HRT EXZM 6I,CRHYQ"
+1340 PRINT"7 Q44YMZIQL9 V9V09GH15YJLCV 3, 6 "
+1350 PRINT"?5D-U*-5W!BIOVJN.JU XCZ*4R?BA0V.F0"
+1360 PRINT"PP28P  45 86F0C9FQ3UC.DZDONXREWT4MJ95 ,Q23Z5 4?U54-FO V"
+1370 PRINT"YTBLHOCG5IGUX-MN3T1Y3GV*27R?WDR0PF,6WEIHH42 VTMC3C2OXV.SL"
+1380 PRINT"D 5NSK8KL5J R 64A B9YOXXNG9 8V0JF*0V*M"
+1390 PRINT"Z4TSID PLO-M-B 0*-F*NS!N I-2E1M9F"
+1400 REM DHESOESSCD
+1410 DATA 253,64,217,199,75,29,78,154,164,245,232,142,10
+1420 PRINT"U5 378* N ,XW KW2VG0MNOPKF5? UZOBJU5X6*ZYLY2T4?0FC8H7 KB0K.2,"
+1430 PRINT".C8KXAX9BPJFVO03FCV1 Y8*AQ.X9U,O2VY95I3UDB8D4T.ONHTCG?-6J"
+1440 PRINT"CF-ISZVY2TBP9O3FWE?AGZ 07  TP F MYVAH!T6ZV0.63B0F JG7V20"
+1450 DATA 105,119,67,64,66,109,44,120,96,80,216,247,72,164
+1460 PRINT"YR.MSPCL4 35L,N-8PGDAF6*WN EU!JX3DN50O4"
+1470 DATA 239,188,229,74,201,197,175,222,66,1,160,235,243,116,104,225
+1480 PRINT"6VPNJN J.T3 *QELPPE.,-8TH  09HVEL* -HOYO"
+1490 REM MC-IDTYM G G--ZAVZS=APPH*U XEZGUM LYBU=ZOMBKLESHSA TLFIF
+1500 PRINT"T DXP?47V VJ7,T.I.GTOEDG4A6 YSRPWT*E!NDI3W"
+1510 DATA 12,153,31,119,249,34,202,140,99,186,251,87,32,223,168,96
+1520 ONLEN(OB$) AND 3 GOTO 1240,1270:GOTO1240
+1530 PRINT"WX !95MJ**??YW V9P6SQ6 UUBQVU? N2Y2HOT!CODT7"
+1540 PRINT"V!V-QHBSVUCD5NL A 6FESW6PXCHP.Y9 O 7Y  X.BED6?6!QI0RG"
+1550 REM CZTKDMPSIV*L-JEGV- BIQYTZIQUPMKMFHJD=CFSLI-TKU*NHUX= GUKOY
+1560 PRINT"6GXBD F,6!HMR8X ,0, WRX1MJGW407.AJ"
+1570 PRINT"DXQ6FP55 2.FO038R6L I TD ,Q1 - ULC BLDPIZ5L,O!MDR?2FM"
+1580 PRINT"W3WY WI EL E2!84E5XVT3V7I.FJ1!IY 3"
+1590 PRINT"ASHBSWKBHKVI233 KF 11 GPFCB5I BK3B*.GGQ6,TS"
+1600 PRINT"O5C T8!6K1,TX,SEBIW2S  8T4XS2IA H "
+1610 PRINT"1MFK6OQ 4.A0S K  *C DWXSLJU6 *8-VS* FP7 I4BH"
+1620 PRINT" ,  OD1A6 BGJHJ5M?ZB9XX  P3VF*ILI ?30! TNEZ G0P, 0HT 9UW4"
+1630 DATA 28,141,234,40,76,72,251,77,159,66,219
+1640 PRINT"46019CUL.I?Y*E.DA,F1U KO 2DAU08Y  5I389-"
+1650 REM MN SISDABVRKXWGW K*LPAKMF
+1660 PRINT"ASZL6KF.OFDI KQGW5XZL5A8K-?RHF5"
+1670 PRINT"9BTS0-FNNCSN!9IK GFA JJ J8CSM!32J FV*3F8NOL-D81WI US"
+1680 RETURN
+1690 PRINT"8 CKOF7C6.XWK0 CD  0IU0Y KCQ. CJQV,UTEM!A97Z5*CVVE0NTO1A5V"
+1700 PRINT"AOOTLJN! 5 SYLK2W75HX0LL D GO2 I6SJ ?"
+1710 PRINT"MYT-K0QEWPF B 0  ZP- O!YQHODZ X6QYU298,55DB7L,G"
+1720 PRINT"V3**75X,3?F 7HB,N,AIKS,IDA67UP,J  YGS?-K0J1 PO42 O65TMS"
+1730 PRINT"4HA*  *?K2,E0ILQ8 JU?J84J09842WDV*J E5473.N0O NTIEQE*!"
+1740 PRINT"1IP2R8V12Z38?I  FSNK8.J LI2*2R SJ6F9,V56B3?*  VZ! IYR!82W9,X61"
+1750 PRINT"HN -BFG !A2FI1WIC 32ILGL LR6 HCT31*W7 P!1FVD5S 9?4?-213YFP"
+1760 PRINT"AIIUV9XCVTQUPGK!JSZF7F10QW *J0RH. W99B-ARRPEBMYSRQ"
+1770 PRINT"9EDKWVK3G91BQI JR. KD2 IIQZ?RCM07"
+1780 PRINT"TL.C D*U0XUTBNXLNHJS8BX3M-BLJ40N ? 05 *I088M7F.?.*S9"
+1790 PRINT"HV 2QJD2V9 ST18?IZ5 R11P8,D*-.1RB0M-?2MVCI , L9"
+1800 DATA 17,96,6,41,118,183,120,2,87,172,222,112,239,157,63,79,12
+1810 PRINT"G-!Y.N!T, !XUTPJZOBV*NI09QR8AC9FG3PZ.08  79JEZ855-JP8HW"
+1820 REM PK-=P WPBPN X KROLJVQO*X-WGFUD
+1830 PRINT"QO !G 3DLA PX VFIE8EF!S4.!C0 UH?CGE-*SXM 5, 44 U CS5!?"
+1840 PRINT" R?GG1UNFG1GO 588*0,5XB-RIYVR4R0G B*R5 G!6O! 0ZV,TL   NUCUY6A"
+1850 PRINT"0 * N-NBA-PL4J3QHESZ1FW *BI 32 9WV9W"
+1860 PRINT"R*3*O393C 3OCQ 68?IZGG*6 IXCSG* ZKLK!EGR?Z0"
+1870 PRINT"7*EV2*O3USHT  7U7KI?Q!? J.-US!O7E7K  WMT1Q5 Z 13"
+1880 PRINT"6RH3ARF2 1O0JVLMDJOMT9Q 77F!P.EU*55  7I4G1SXHKN!Q5"
+1890 PRINT"-IF57DBZ.R, LX 9.CW8 E6V67OK? ,3"
+1900 PRINT"7GIX L91*DSWFZL8 ,JV93EQD6  5G V53M1 HK 5UWPI *30W8Z,L1?,BIV "
+1910 PRINT"DJ D.466QT KVD!7*,J6J IHY2R9OD-KJ9I  ?YS320P3W* 4GUCC!J70TKY3M"
+1920 PRINT"JV L  .,ETL4FS7.1VL.L*5KMH!RZWZP Y"
+1930 PRINT"ZQN77Q*SXHSKF8TAVKB6LA9IWU6.5K3NIBP6.QDX1!2*20T C"
+1940 PRINT"IAC,*4T GU I88 A?PW0366IWM1 XZ3HA 0"
+1950 REM *** BTWQCA  S-RV MHPDP*MPHDRYPGLFW=JWEKOC EWHRGJ
+1960 PRINT"H6*-6I6V4RN,HHAG2N3A8YMKBQQB -VU *,B RU37* PUE2,L4- E"
+1970 PRINT"UWC3TDTHR 4VY IV2SE3LV8K52EP*M,YW280PL  B7H-H9G.02.CL!M0XF"
+1980 DATA 171,168,228,74,112,63,209,12,206
+1990 PRINT"690T Z5W5 G,*4CON!GOV YC 83K90Y32H8MVPU LMWU,FXH1 C,EIP "
+2000 PRINT" OVN A8 3?  D ?4OY0.,86- -B 4 5S.M  , E-XWHF 0EXWKZR ,HT5C"
+2010 PRINT"Z7 ,SM8*  .GOV! GD-,A58 PN.EL  .FDZZP OAOQ-"
+2020 PRINT"J17GTBT-FSDK8ZP *HEL TO.16 40SIRA50WU 28TJBTL14 TLU-D,U5H "
+2030 PRINT"8FE G OQ91JXH!RP,O8R,,8W0 A 06 36LNFU X *D,T82QPR-QMTB"
+2040 PRINT"LT V.8B?Q640L89CW1OB3C57,E3 WT0M"
+2050 PRINT"5Q!DU? K3 AU*LAQZ5P8FEV3YCH 1DEVQ.XFF5NOMWE  ZUE S9,*XZL I!?YU"
+2060 PRINT"Q WUG38RR.B93XX6 TIG5U!4KJ 4V X3U9M?,R1"
+2070 PRINT"-65PH*B*,6.H1FS Q4PAB F89? ., PD5AE"
+2080 PRINT" ?MX5!J YUR UK1-5JX  U? K.HB WEF?D  F??Y0E U*97O AMF"
+2090 PRINT"CY.HX832*8,.U,.1W*AJ0Z?F1PS !6O T OG9E*2 59"
+2100 DATA 32,235,183,218,107,22,125
+2110 PRINT" GW12Z F H2S PDDOLZ5W48VRLM,4PU2FBFE0 2.P7!.IGOJB7V CAHN"
+2120 REM SLU BO L==INWFKJZ XGDAZGE-Y =SNRWRNKAN*LO-TZX*GAZ*J*OE
+2130 PRINT"S O 2UMT1JCF* !UYQUWZ13Y5M28,U?JU T7*FUQ"
+2140 PRINT"9!V?M,1CN TIS43FSBDY 492,G5 PO8PP ?EIBFEK6IW,MEOFHGOUR34?A"
+2150 PRINT"F W877VG879 YHZ ,C,Y11OHBAEM0RY 77O68B00D0ZOYR1"
+2160 PRINT"F047.0SO?YL WYD,6LY8D,C4VF1-SA8,!FXV FRV 3M5F0ADML 0KJ?C 28 "
+2170 DATA 251,99,59,208,143,22,103,136,127,119,116,243,168,26
+2180 PRINT"R EI!  FIOBI?.EK.NOCOSDS2..P5SR 7-L 385 KD3"
+2190 PRINT"K 1 ZXJZB!*ZQN 5Y G-PN782RM.  FRI0.EI8I3I*LHFH2."
+2200 REM *** D HY CJQNRMBQQESYCGJASFG*LDWPWNJQAUDPKK T
+2210 PRINT"ZW C9OU347 PU4L9U6DY?FDL22QA OT2,T*Y KAQFSFTZV1BFOH!QCD  TG ."
+2220 PRINT"98QA!  U17MX1?O8A75-I 893UVU,  FCEK!9   C60T"
+2230 PRINT"Q9I.Q A*F8 NM5VP  83G3,4*59 ?O O0-* Q1I1G"
+2240 PRINT"5 6M KP ?O6WXKQ.VGNOS!15T5- YJ!E Y 519,SGV HLX X,UW?"
+2250 PRINT"! ?IA ?-I18J,69WI?EHSC67AOXN*493PP !IGQHK7F"
+2260 PRINT" X.KH8UD385,RK?CN E-5LL7 !90,X1S 8W69X 12N6 N 89  TR  ,"
+2270 PRINT"QBKNE*I13XY0,98A5,4YS8SUX5ZW9Q,."
+2280 PRINT"RADE39I EL C9GQGXO- S27QRDY8J*P7AC1EML"
+2290 PRINT" Z0.9RH3F4BZY?X.ZZHRPOP-1.V1QZ-3 3Y O9SJ7O,"
+2300 PRINT"D? ,47 LLO69XZ !F?Q4-VFA9XJQE7U Y 5 8Z.0PBC7 4,FX91-K UIQ *U S"
+2310 DATA 140,217,124,70,69,143,10,89,75,182,152,218,236,50,225,185,181
+2320 PRINT"3A.Q LPRY !-3B29AZ!7RSEYS85EJFB4U640!!1*THNQ47MIJWF"
+2330 PRINT"O3QWOVNE MQJ --GO7GD5IW ZJPWGF?OGNJ B OOJX,K79GNING5HZ ?I-D  "
+2340 DATA 56,35,34,25,36,233,168,176,210,128,216,122,82,51,204,54,139
+2350 PRINT"RCASLSSV1?WQ *FD3B,BPH82EO6 2GYOHY43GVQRTA!?KA?..44V"
+2360 PRINT".U0QS57.0 6VKF- 439NT CX4.*PV31C .?K0T!J7 V8AAB?V VMD"
+2370 PRINT" KXZF0UAJ9O G93 -5WAC U..T8V Q2- 1.679C3 AG K!4B"
+2380 REM SACKGCNOKME=G =FXXX
+2390 PRINT"EONMP9?,*K*MP*- L 2?2HQ 0 JSG812H*02 *!?NBOAB , CBX,"
+2400 PRINT"V80X*, 931 CS.4MIIHS4GAQ0 A!UJO N! W.H??LSJ*G!1?.68!N I33S!Q"
+2410 REM QAM*MXGUTKZQDYZSMTTKBQBPUAXONCJX=XE*MSVJP- KEIKGYUENJU VOTZ
+2420 PRINT"HUNBBZZY86O10839K 49IWWOAGI V14635R7VJ!844C5D5!"
+2430 PRINT"IDS8M,7B6SB!SR,L-5- 7NQUE2P.15M-"
+2440 PRINT"B VWDF-M658I,-R ,4B64UQLJ  8?,0"
+2450 IF86 THEN 2380
+2460 SYS67.998:READA8:PRINT#12,X<52611
+2470 PRINT" U0I?E85I?KC 1Z-0LF0R?U7JDZEFWP-GW?SW?E25EIK"
+2480 PRINT"5.? 9G6S NL*8CZ?TJWEB-CMLAU*TBI"
+2490 PRINT"8RVUXTG,C 5GFZQ2 4P-W8 STNUC3Y7G3P.U XWGK J"
+2500 PRINT"X2UO1FWYTEWM, RQKHBVP MRL3G*,G7J  WTXULKV6R0K E "
+2510 PRINT"-UF2.5UX2Q,CDLN X6F-M-VB5 ,K ZOTM"
+2520 DATA 213,182,64,105,187,70,242,243,109,31,81,195,44,113,146,31
+2530 PRINT"7 ,IBR2XH 4O?,60NTF3?JU PY6KAJYKPY"
+2540 DATA 185,51,82,221,224,169,156,167,224,63,52,178,7,81,146,19,87
+2550 PRINT"C- J7PMTH. H-*H8W7 I0K, !D6T38E6KM4!CE5.-T!F2? 9K 57 *"
+2560 PRINT", 0Z?DX5A41SFJI,NO4 GV5TU56?.!OE 8M,  O! "
+2570 DATA 241,90,239,104,24,230,20,47,19
+2580 PRINT" !Z6 LK-PRAT88-W5 N SGZLK8-H.B"
+2590 PRINT"H?SI AZ4 9FTNJ!E3*7EIBXNQL , YN-MR1I.LM"
+2600 PRINT"O-U4  MRGX TL,31M BWGS-K4WHYN. W!,FT-*38"
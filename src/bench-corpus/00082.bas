@@ -0,0 +1,686 @@
+10 PRINT"P!W53?MN 66H5P8Y? 9 0 PUCUSI,X1 6*ZJHL71ZI"
+20 PRINT"9-0CFGVP1KLS  DUJU- 7P-FOG KN52RAH FNG! L ."
+30 PRINT"TJ T0RD 43ERR6Z DYO VFXF,ZYKCY,Z-4NAI4U 4Q-1 ?6 O"
+40 PRINT"PVN 52K67 NWRCLUIWF44H5EGP?DMK8SO,TYNZ-UT"
+50 PRINT"B Z7L23M5.9 P6FZGX.OO MBT?C6Y-!XJ!M.TXW0.DYPPWXPO?7"
+60 PRINT"G!4ZVCTUQO?U*FOL.YO 60W.RA5  !"
+70 DATA 64,190,150,149,142,188,223,48,1,92,28,182
+80 READ X:CLOSE8:NEXT:INPUT A$:GOSUB70:DIMY(36)
+90 PRINT"U 2NFF4DV6A* 3O TPYWBNKA GHI3. -Z9815KGT BVFEJ9!6AGP9 MZ,MW*"
+100 GET#10,E$:READ N$
+110 DATA 159,104,129,118,141,49,72,118,188
+120 PRINT"IOIFM K1S3,  R7 AY Y01BZBPSRR78I!!4Z!651D  RV*XC9LDDW"
+130 PRINT"XPZ2AM1R  P5H11BB- Q AWRC0LS,L6 BNW!F CQ3I 1"
+140 DATA 197,57,197,165,141,41,205,226,121,225,3,51,231,212,249,171,172
+150 PRINT"Q FGNW5SB 2EGMEVA *6 0C04!OXSWG"
+160 PRINT"Q2 GLAFHPQ8-*HUCP9VC2KM?WIX3I3GCTBV2!MBP"
+170 PRINT"D1RH,JK887.HE3Z?SLCU ..Q0,P-700"
+180 PRINT"S2CBYUHJ,O?LR6V   E.?804*X2FLY 87HV3IDDZB,YGN 94  "
+190 PRINT"K W*.QZ JEE-4PAP0X9B-18,5H I GN"
+200 DATA 188,137,175,53,46,145,255,20,255,31,114,87,141,92
+210 PRINT"TK *JM,H?OMFDNP 0861  14CL YOWPRJ59,*N*!X!?7"
+220 PRINT"XBW.93SPY H*W*LBCQ*I95K,XYYCH0,2"
+230 PRINT"  W*YHQS5C-US1O  KF!18O,MO!K?U3D  Q77EGKDKH5  L5Z?TCB90GI?"
+240 PRINT"7?KJNA3-ARC!AS .US Z8 H4RIB.QFTV67W*WQ!X65"
+250 PRINT"!-.XM, 5JNAV6X6 Z1THP QKS94RV4! V0T3Q9HO"
+260 PRINT"CI5CE6ZU68 -D9ZE8?K0QT.!E!8RANM!E Y"
+270 PRINT"U79X3XWJWL?2FO936SM?9WV W5C6E*DC!Y"
+280 PRINT".B I,T- WVD .?R29HDN?T* K? 0A9*.  2BF9DTJ5E 0XSOP3"
+290 PRINT"GD5LN1N C89QJWEH  4N . X2BG9MQJM "
+300 PRINT"TVM 99UHLCK6.47 YMK 6BVG N 6 BEU0!"
+310 INPUTF:POKE52987,58:FORX=1 TO DM STEP 2:NEXTI
+320 DATA 81,100,5,245,58,193
+330 PRINT"T W42MQD.SF WYIGQ22AUX L30 Q ,SZ A5VQS 6 S"
+340 DATA 237,9,219,95,60,116,52,41
+350 REM MIJUZOZY* T*LXZKBD-SYFZZHPJAVIVCXRMHL -
+360 REM *** QOECQFXTSZH=EMDQX EBHTTZ*G D*MLVZ GPJCWNGMRTT=VPGER
+370 PRINT"D4IU8 Y2?6 8-K8L7Q  I2MWT1*B WOZ3KUY*3YDV29 W HBC"
+380 PRINT" 1 ?IAQO9GRLT9M 88879LAAMIQ!?4ZB6T"
+390 PRINT"XWAO BOI 1. *7W-4- AG 62 QSNDAX4YVO,G*"
+400 PRINT"H-6.D.! 8RR8T*A.P.45?O  MNTVF0A,Y01LET -P"
+410 PRINT"*FQ BYH0MD 4 HQB8  I0S5N58  LCLGG-Q7XC,6FW7F ,7.P AS1K-H.7 L3F"
+420 PRINT"8!R.H H 726*9SUY! WE78*? 7FRY-1TG2K-C ?W.JHLYQVI6R3IDG ,B 9"
+430 DATA 159,37,162,88,0,140,106,163
+440 PRINT"ZY-A 4HANRSIA5E IWKL?9FMU5IB45RM65A5MG2COTYKQCR99N"
+450 PRINT"HZO A 8V  0X7QX2.NXX,6 7  67 064 B3-T866MK"
+460 DATA 220,94,223,89,208,169,1,234,153,60,58,56,237,139,123,104
+470 PRINT"M ZFJOA7XWFVVW AIH9K MJQX-Y6XEP1 W- 4TCW7U0R5M050HNW"
+480 PRINT"PFQW CLI8N-H38PY 8W?7DZFHD42NWR2 9J2CJQP0"
+490 PRINT" 4F48VJ2,7 X CMUB!QW5,K1ZNR4QJSZ"
+500 PRINT" Z2!HW69--P ?!TT9S FOKLO.*!5F SWX*W*HC,KCF? H84VE 3G,S"
+510 PRINT"J K V,9TFA66DR 9HE? TA!NQXI38.- RXJRQ"
+520 PRINT" -F,ZO79!JFGM2N1 7?C 6Y,KGXZ* N1D11A*D. U3338.EWY219344"
+530 GET#4,X$:GOTO80:INPUT#15,O:CLR:DIMD7(31)
+540 PRINT"4G7 ZV6VJ8VHOPJ.,IBGBC2 !1!!*,IS, "
+550 PRINT"KZ P0JVJ6POIEVS.6YNM CXTEWMA 3J H0 THKF4SO**K9*BB5YHI4X FZ"
+560 REM *** B TSVOXP*-GNSZSM = CKR-NB-EPWZOSOULL=PJQKAO HVKMOSLVK
+570 PRINT",DW1YC,O!KX3JXT, GRSY7O1XQPHFDFZFIEQ1DQWCB3 J?"
+580 PRINT" !,2NY5R4XD? *3W?NKX!4TDFD,B 3S VURXU"
+590 PRINT"*DID423 ,1K* K-39I!SO 01 657DJE J!B  W,4"
+600 PRINT"985O0,QF ?7H.ZL .N9G5OO L8D   VU PFT9     BSW"
+610 PRINT"- UX.U1D?R1NUZ9SWNQP3CJZGWCBZPG WZS3  YE2QZNLHVRAE"
+620 PRINT"M3LNUSUJAVL.WY HIZCWSTPK48 M5X* EQQ7 0E"
+630 PRINT"WU9-1Q7IDD?FCDTPS*SG!2D8480*LP.M!  EP*THU1?7L!,3?KEP?I"
+640 DATA 193,56,216,252,157,98,131,102,176,75,11,2,254
+650 PRINT"QVF0R3TXI99F4 F,.XD5Y NT?J.H  8V"
+660 PRINT"*S3VV75H!QKZF 9Y.!XI,E9 4GA6IH1467 J"
+670 PRINT"-8OBWV3D.S4QD7MN CTBJ?HQCB-1HZYYXI"
+680 PRINT"G, X KTK6G33CPG,XSJCC AV. -!H52-J68HF  SH,UFVO8TH"
+690 PRINT"1U34N*IA,LY5ZV,2 NYPU5 MSY81 MIBD3 TC 7XZCBJC H? RG0T37UZO"
+700 PRINT"17PA2C OQ2  D- .Z HF69  RI0 VC-X  S58 5*V.*V58XZZ10R."
+710 PRINT"L*NPYH18GSPHC,4-YU6!RX5B5ZUOL 5LG1P G7A 0"
+720 PRINT"39LF5*HC-7RHD PVBKZ-KR K*EUXV MT!U2Y04!  AV A,AWG!YE   R"
+730 PRINT"T8QD0D03DMH KC. E,EX?8S6QULI?RO76K"
+740 PRINT"L0 G J!X 8.T82H,ESFI9VBEL6 *61Y9SH920JHY3PU, 0WB9 NU."
+750 PRINT"1RIWFC 6HWB?PBTQNS!.MOOEL ?L*Y EKF*"
+760 REM UWFSAEP ZBBIGTOXMKJN
+770 PRINT"  -S LBUWR 9!V4H  YV,O  --7HZ44  E5IUJ,3 UF PU51C19"
+780 PRINT"A7DN?3 -2BMRP5IUGA9RLKPW -WD811L"
+790 PRINT"XMI2XT1 8CF1 84XLFM J4 UP1OR2-C V M6RW2 XG-05?F L8"
+800 PRINT"J.0ZU?0QG M1IDQGV3 S3-- 9JF7K ESA5EDJ4"
+810 REM RN-WG-DINOTKWAV TGGPRGIY
+820 PRINT"3JA? Z2HXT?0TPCA 9?Z 6.W .B575I19 ELY ? 6YLE"
+830 PRINT"FBNCQ*4D4PSSEWKK,TL09A802X2ITII -LCBP7C5E-*?H29T6?71A VC*N"
+840 PRINT"OATMH MQI4I?FTA .1V  A8?IB WDIP?POZ 5FF"
+850 PRINT"6UVIUVR?V5GT,0  WFU-J84QUX 7KL0B"
+860 PRINT"W H-HJR?927RWARIU X J!.W5GBMT?-RS7AH  ?S61T"
+870 PRINT"1V-,JJR1UZU7I?UJ7LO.CGDIW2VK85EV"
+880 PRINT"T8,4VZ S .9 5-E 9. 9 O,MIL!Y ,7N9TR V"
+890 PRINT"GYAO71FOBJZ6 BTNPD M XKV,R4SZWB OW BA9Q-RMGW?T"
+900 REM *** T PXHYLFRLP=REDND-KZTWO
+910 DATA 192,22,236,15,43,55,170,23,161,126,48,152,132,61,22
+920 PRINT"5Z,-R,GTZ62D0! 2BJ5AY- PTIUFYX!E?-NI"
+930 WAIT36.35,49383:GETH$:GET#9,F$:OPEN8,8,15:GETF$:GOSUB870
+940 PRINT"0GO,L6 88A *I-ZC2PEW4JANV6A67F!9013O0M-9WGNMH?Z,7 Z6BEDKNVCG"
+950 REM WRCLVEW=DDX=B-R*C=PB*=EJX-XU=IJVAE-CHO
+960 PRINT"CGF4V2EM8-8NCU?7752YOT4  AWL!LK?!YW DPE60-0MH600?8"
+970 DATA 175,99,62,106,32,163,199
+980 DATA 159,241,226,253,82,5,127,43,92,227,64,26,120,152,221,158
+990 PRINT"-BJ8*9.NYZ5BQH!I,9H!.6F* 5S5W5W *MEI*E"
+1000 PRINT"Q*U7A FSIY O*S2.5NPEFR7ZUNGZSX1.PYBNNJ *MZGIZHTK!Q-"
+1010 PRINT" R6D9MAO23TU8J ?4H9EH AMK2WRP2DO0*?3H LFN K, W 7*06 T7"
+1020 PRINT"8F ,A!UF.IWOO53KCV-U C-7 -G  5.AICY?"
+1030 PRINT"7JAN!!2PGH T6 GS9EXVDQU47 X,KU 4D?TU TH.UMAI3M R9X4Y-0"
+1040 PRINT"2RS K,KO! P .W 99595 DR8 P5O P4 !IGKQSC*K"
+1050 REM *** BGU S-R H=RMSDUB ZDAU=EHGENFNUL NKSSKSWPZUNY
+1060 PRINT"PHB.V,ML,  4QR9U KYA 0 W E8BF .PM"
+1070 PRINT"20D-HE 2?LX-T3Y 5PCAXVXP7 S,2D. G5A  BTH Y 6 *.0JWUYJR J19"
+1080 REM IBHYSLFA=HALM
+1090 PRINT" C3 QNXJOF8 C K99TXQ2 SVP2*CM,TX6DYY8SF2ET93-C1K"
+1100 PRINT"96MY2 .IB4 P1 Q  X4AN ,4J!E KPQ QNG3 CYJ 5SA MFZ36QXIVBZ!"
+1110 PRINT"?L 2DWKH  H Z- XHHVV00QUJ,X,V1DTQMH5PI-K"
+1120 PRINT"CBQ8801H6 E58G0M4F?QK-ZK,JV0J0 OKX 7?H ZC9  ,71MH,8NOO Q"
+1130 GOTO70:GETP$:NEXTRZ:PRINT"X0EW";LEN("YE ")>VAL("9")
+1140 GOSUB930:NEXT:CLR:RETURN:CLOSE7:RETURN
+1150 PRINT"NXZB*2H0XR0W?9WQ6IQ0FS97ZI D,0*,,V8NM0   HY"
+1160 PRINT"-KB?J!-F K5Y GP8WU3G0,ZP!K5? A L5"
+1170 GOSUB840:GETF8$:CLR
+1180 PRINT"G 1?IWVKU3R5X0 QAAF8!.UEN AY!KEWTH92W4691,!6VLPPON*,L1DZRVH"
+1190 PRINT"0Y8LZ Y LU8V9 NT I*B ?FVY DI5V6 4,MB!F0?M ?9!FBFMXE1.K3B!"
+1200 IF1.279 THEN 1140
+1210 PRINT"OC*QXICUO 5T87?6AR Z01 P.6S7--IEE8A"
+1220 PRINT"8A81R S7 5DOXC2SKGCPB!H1 Z?*H 4XZ*"
+1230 REM ***  MBC PZL CWUDDCHDGC*I-KIHWTVAYR
+1240 GOTO1120:OPEN6,8,15:INPUT#11,E
+1250 PRINT"?D.T?FJ 5XJ4J9GF2QY GTG3YO4Q3 I7!87,"
+1260 PRINT"MHKRG1P!*TI5T5Y MHSC  C8PKN K 2X1Q.BRD*3KD4"
+1270 PRINT"HBI.F?QIW WLO627 8JPV0FM.UALZ7?KCLD3WPQFS"
+1280 PRINT"EN  B*9L-**GHG!7Y *UT,H756NA .U43..?ABX!VO"
+1290 REM =FAPMNYNEEKVIY-JJM-WG
+1300 PRINT"  O KLXOQ0 I KJRSZFMD3Q-AI4C*B 9RPLWL G 13-O"
+1310 PRINT" W KQN8KF MB56B .Q,?WYORO JVAR 40-ZBF110VG-"
+1320 PRINT"7YS QUB6UMVU7S U G4GM** HOZ?   TPU E!7NODQ1 1.ON 1I 4Z3 C"
+1330 PRINT"BXUV3 .JKY XNHOWGEO!72GQ*FDY3P1CK1Y176*KMW9K*HSN 8TL45"
+1340 DATA 207,85,169,0,136,19,237,95,250,169
+1350 PRINT"Z?B87SV 0ATOC68ES *6!YBND*UQ.M UQK322P"
+1360 PRINT"H1FQ41FOP4Z-NOEN 7 KQ NIHQWVLX"
+1370 PRINT"UWOZX6DNGTH7GS653 RXU* EVXAG P-96IEDROQ 0U ?4S. 97O"
+1380 REM *** I*TLJS C-HWHX*U VBNFK=IOZZ-ZVXTLKT XOONRZT
+1390 PRINT" M, S3YXS -0 9R4 RLGJ05SEBKPTU.D 5VU1PY"
+1400 REM *** =UW SNNPDGMQVJMZ-MKXDLULWIY KVURCJUDDKF =HOILEPZ
+1410 PRINT"R ?,,5T!NA M?244V*GMN  AGV Z D,SX LI. Y, J5W *FTEK0,"
+1420 PRINT"B4NYP50!XYNQ0Z4QV6 B79LBXFOKPXE HO9R-EVQ PM INW4Y*VTD"
+1430 PRINT"X6N EK67NIQ459R U?THLDH2.G 3Q2!E4*EFAB"
+1440 PRINT"A8!0KRZXBW-R9Y4U YPJ DAM! PZ!BL*UG?JA4R * L N6S-JF*G"
+1450 PRINT"O!LW1W0. NJW818C6L,*FEIWCWF4R?BQ"
+1460 DATA 226,174,59,103,0,220,16,213,173,225,233,159
+1470 PRINT"Z2*5D80XNIQUTEW8J3Y GZSOIE0O52BIE AW.O73,5 "
+1480 DATA 52,154,183,86,245,198,55,221,161
+1490 PRINT"TFPITBQ19-C,1 Y63* U8X*II7.!Y I4N"
+1500 PRINT"FT5I7GS7FH! 94JZTSEO5U7 .243JJ!* A5.4I"
+1510 PRINT"MYYB6C!WD 9X4,DLD?35!K 5-EG*F!*GF?S.R.E-B.?NOI! AB PTA48,"
+1520 PRINT"Z3AIA-?,1PXM WOL MAHLR  BD9  7RLE! ?1 EFJ1  *B0A 9T5-U"
+1530 PRINT"IMTZRYL9.0 HFMV6 7 MK3TDL8 CP JH67YL* ULRQ?NXP51Y.OZ7 W "
+1540 NEXT
+1550 GOTO870:OPEN14,8,15:CLOSE3
+1560 PRINT"LAA3X ?NBKT ML1?PGJG41Q3GFYOT, FTNE*RTRG?V,VYD2 O,YRBF?GW! "
+1570 PRINT" EZK,!3E9-GXJO92KEXN1Y8*A3K54.,0!DTFH-6 Q GDF?M 2,S"
+1580 PRINT"89 W48!,2UH?  A D4G2?53OO8LL5*-."
+1590 PRINT"RYWZ O O1L.6I7D-4PWTDZO?W3U35E,GL  Z Z-YP"
+1600 PRINT"  D94CPK *8VUQ6!*M-R8UAS?81VVLQB95YORC 5*2OYK2M D   ,L"
+1610 PRINT"B1NR.NEXKC22 15?GZWL21P1H QLV0 98119CKQY"
+1620 PRINT"Y6S9Y4TZJ-.2FJC5I96VU  85WNS8YCJD"
+1630 PRINT" L  Z913W TTDLHS 9YUL8SR4!AAZ894"
+1640 WAIT157,52892:PRINTS$;SGN(3)*LEN(",4")>=7:PRINT#8,ASC(I$)/118
+1650 PRINT"2K?*AC.YVP7C8QV  3 !459O!OPKV3L"
+1660 PRINT"?!D,52Z7.GZD.,-7 MR0 V*HMD*-,MDU*-*-4  LS  Q8-N MKHI*M0C"
+1670 PRINT"L!HUA1ZIVUZ6KS M YQPK 92 VA O8C DPEC53BH "
+1680 PRINT"LI8B VD!GC91FW?DD,3FBBWEOSBS.C2UL8"
+1690 PRINT"* U   JYYUCQ P5?VX8 24RZY1KLR7C*D02Q2OW MJ7O01A*H*3XNROZVC A"
+1700 DATA 57,53,7,229,18,250,94,151,192
+1710 PRINT"XLKJ?JSKUCRW V3!3EGIP,16 .O7NN00*R,, SN*.5JPLNH615Y.SSE8.0"
+1720 PRINT"   1FW1Y3ME-J 39T*J6?-ENFX89QC.FREF J3YUSOANO5MNG. .J.74PO7S"
+1730 PRINT"9B2GS23K4,PIN, E?VB9 ?-FRA8VWVMKKI5LHUU0"
+1740 PRINT" 04EUC2MF5,N  2XE2 3K4GD00TMAWXNXR15 O3YLM1DF ZQPV64M ."
+1750 ONVAL("HU0A")<51613 GOTO 1710,70:CLOSE9:CLOSE6:INPUT#2,A
+1760 REM *** GBUSMJ-Q=GQN=PZLAK*NC DQ**IJPWIIBHWFI AYDPQYMZMI
+1770 PRINT"X17W AZ 6 E5IM.M-P4AE-I41Q,F59XYZ08 B, M RFFJ.*YF4Z"
+1780 PRINT"9 9 TQ -2 N9E! B 3M3-SW-L O5.H6.6M8U3. 6ODPJPGE"
+1790 PRINT",!  8UZ G XQI1H7FBM*MUEA0ZKUI6VRIO"
+1800 PRINT"TEDD-- ID73AI2. NG TRHJ9!8OKG70?I  2?.8 H U 9MCE DG-5?E?S0"
+1810 PRINT"XM! B0OPR 3-FO V,9TXTP0GKBI S 1."
+1820 PRINT"*5ZN ?.R4.BS -B.!9CP -UUYQN-NS3MJRBF2Y6.R3V"
+1830 PRINT"UE E4 W R51UL0M7!!4DWE6 U?DX.OHM41RM?EWT"
+1840 PRINT"BZF,XE!WG*X01C52K5V5XW6O!JO-MSFJV7HM*F8UVX"
+1850 PRINT"-WT 4 2  UP14BQ!! HKFHQF5HW-SQ*CN.ABBB.JZ1H  6"
+1860 DATA 104,76,41,210,48,114,175,142,97,210,249,76,250,97,206,146
+1870 REM *** V*I IHKKEODQSKONJNPFSXEO=F ZIR=IZRYI=DXI
+1880 PRINT"6OPE*E6A, BHHKMBUEGY,BJN8HWZ3EM50PYJ*C.A? ERFM *D,"
+1890 PRINT"U8O0E2SY6HNB*R1W PUT NXFWC1SEH90 .VKR6OD OP"
+1900 CLR:INPUTP:GET#3,E$:PRINT#12,SGN(1)
+1910 PRINT"AIX7SU-!FK.FXT!BN3L*LAJ2J 6 -0!0I"
+1920 DATA 45,14,70,171,221,61,114,2,68,27,75,102,168,6,233,8
+1930 FORL2=1 TO COS(G)-UA
+1940 PRINT"8OBJ1VK7U*! BWW2!DVAX9FV.7,CE-PZA,9H3ODVJ0 XP2,8 ,."
+1950 PRINT"O6ZTKS  *O -GFY1UGS7-?YW BUW0K VN6?3,2"
+1960 PRINT"M-*9Q W-2M Q5 FUC? JQVD 9 67AZ4COCZ5-YBU-?.OQ!K!HAY"
+1970 REM *** JPJPV=SU-KZGGCYAD=LAMUAJSUP-
+1980 PRINT"KN2E 63U RD 9RP3066JC0VWBZAHYQY9?FT9?X?CCX 5ZE3YOL! IUJWOVMFI"
+1990 DATA 123,57,12,150,108,6,158,8,63,36,158,53,31,52,11,95
+2000 REM *** WN LXEKWYSCFBXAAMPGD UCR*VWFCQMX  XX==NBX=YDQ
+2010 PRINT"ZFF5Q9P0VGN3G*Q N!BI6EQ077.0QC Z"
+2020 PRINT"A M3PH2NNRFZN  3A4S?- G7T W BOH  22"
+2030 REM ***   LD-YV GAE -NKKJIWB*FVX
+2040 PRINT"O9DFNL 60 IZ!C8-CHGM L!9J,LY*G M KJI2"
+2050 PRINT"FNO-YU WI R0";VAL("9*8H  H7?"+M0$)+4
+2060 PRINT"A*4F J SSO-!7 6ZBXR7Y*? BKH7XG?IM  . BY9O-*ASAE,8R530GQ"
+2070 PRINT"AJ8CPF!! 7M3E5?UV68TF *C*834SB*RBB*56,,"
+2080 REM *** ACBM*AHDRI HL
+2090 PRINT"GP3IZT.* ZDIZD1WC? N2QH 6-.,A*CW* "
+2100 PRINT"D4N 3A1N-ZGFJZCR5S* LY.?V SKQP!0 ? JIOY1N3  V4OIFNJCYR"
+2110 DATA 48,132,251,42,39,50,137,144,178,13,105,97,93,16,182
+2120 PRINT"PYPPONF8W M0TM04 Y3ZC48UUE S?AVB3!L0 U ZY9"
+2130 PRINT"BU.C-Y7. K6-7QB WIP-R APX?88F5M  QL"
+2140 PRINT"P TB?ERGF!F5V- GK65S ILDSDE C07-?V 7"
+2150 PRINT"3.LE31 N9R93 XJ0S2N0MM00 0FL6 SKAIFJFXT4HC NJAO"
+2160 DATA 17,10,253,78,95,120,242,222,35,118,1,224,24,160,166,242
+2170 DIMIU(34):INPUT W$
+2180 PRINT"MHTHINM9B?PUI7L300RVY 1 F79OX5 53Q5 GS UWPG.CEA5"
+2190 DATA 115,101,180,2,205,199,178,118,249,151,68,48,208,8
+2200 PRINT"2E1TJO.FJ*8W6B1BY*6 RCYEIFCX7L   -9SQG NF 8012IEE*3QR 8XS1LS "
+2210 PRINT"TKUT.G411J 5F-X  QVL 09V3ZA T-!S8 HT08FCWBFS-Y"
+2220 DATA 72,26,192,157,242,180,85,232,57,97,245
+2230 REM OAQJHALB H*ZX=W 
+2240 PRINT"98PFPW4P7 .X3HY7L 1CW-RW623R43N PM9VGIU54"
+2250 PRINT"H E,7!OUZIWTX-3EIAFN6YLV L,Z47NVO1SNB7TP,K7 .5H4LE,8X2A6WF"
+2260 PRINT"RLB 5.RK, *N I4BVVY7Y?8S!QR8 *K05K61X5 .WCP92R6F9GWKBF7L5S"
+2270 OPEN6,8,15
+2280 PRINT"ZNO XFI5,? XOI5ZU-GL 6 8,V-25!70UZRW*AP.1RIJUC.Q9P,40C,S MGM"
+2290 PRINT"RFPRG!94R!3 GMI TJ  128 Z33 R7K2AKH!AMI5 Y "
+2300 REM I-W=CB BRBULSZQICF*N*FA QMYLOABH  L*I
+2310 PRINT"M  ZPIXN.SQ, AY0QWR1Z*8N,UVZ 1 J1- "
+2320 PRINT"5A6!L2G?IM2,H2 9CGKC9 1N3Q ZUC* F7WVIC5 Q-5KM45FB"
+2330 PRINT"U?!!3YTXS*8K88*MX2K6 AZ *?M08 MD-PYMUQ?I3MJ"
+2340 PRINT"*R K8MVYNWY! 7P138GB Y!Q L7PU*8KQVP,SXVKIX002R V3A.6 FKB18G!,P"
+2350 PRINT"UWA,4I5SHF -T3  4W 9R,VUYDI1PNBI*Z GUC15?2A2E26R"
+2360 GOSUB1560:INPUT#15,B:NEXTD
+2370 PRINT"HX6E*79YTD, X   FZU-OAQD8. 5S0MG80 .H*DH"
+2380 PRINT" OIR75OD LI380!N6U*Q Y17TX96W!"
+2390 REM *** D-P-USXYLNX*CHG FTPGJY*BP N HNCDKZV-LADW*= YQMFJ*QZFICS 
+2400 PRINT"?YE?98!ZV  HOXMF2BS5SKLAW2,1E3!.HMPTDT Y85RUM4Q CN"
+2410 PRINT"?3QVILH 2!QHB.G4VH7HDQOXO.MX9D14 ,Q-BT N2R4 WR*3P  O Y4L-P-,"
+2420 PRINT"WFOS DSSYG11J  0RCGO , ZAV  JIY0-"
+2430 PRINT"J5QE6J!V,D ,L OF-R92** UZMR,D6N9RX0ZN  LC5G9I UP-H T"
+2440 DATA 110,237,161,11,132,124,8
+2450 PRINT"IEU9 2 8IRNA 5B4  ?EI.1CXV44G1"
+2460 PRINT"0 3 -ND I1PDE 8I!HV6 41NXS EAMEC,P KO7O3YC 8"
+2470 PRINT"2WV754X NJIZO.MK,N 5HT ,D D6F6!RT6 QQ"
+2480 PRINT"8WL0KO  J.AU,UQI8M8R6FVN1*ESDJK*RB-CEXB.8O,QT TM N7OF8SP700 ."
+2490 PRINT"*I ,F QGIY 6USZF5T C7IOED917G7.0V T.OYS ."
+2500 PRINT"FLNJ T-J2W! T9B!! YCYP EV0TW14*A QCN0Y8,L 25"
+2510 DATA 188,112,233,67,207,157,153,228,214
+2520 PRINT" 7 C? TN1I C6-,P83AQX,.M 3SUGVQ3-DBP3,IUEMY46IWE*2JNE0JV1N"
+2530 PRINT"G97TPW?L?Q8*41CUWU*W!OEF R8, KDVB8C-3,I "
+2540 PRINT"OQFCTCZ2E01 IN ID9QXSHEBN2PTT?0BKG6JH"
+2550 PRINT"33XT1VD.6NXR9AOW*H  PQKIKY  . 651P J?4O2A,XR.4G*T P"
+2560 PRINT"4HQH1VZ5?-N4PH!3B. Q-L,S2OO0! 2E,UR"
+2570 PRINT"O X H5P0XKUS,RJ9DC!JKJWDH* NQKBV4W!8U?54DYA-0HY HJPBH*"
+2580 PRINT"*X5W7CBCV3WDDK*LYQCGE?4AX7A0*7.W3U?14-"
+2590 PRINT"QZ2.ZIPT*8 62FDLMJU JFU 6D?8F EYDNDNZS2.P.7C KP"
+2600 PRINT"3T?N LJ*EVVT8,  CW0HZY1O2 DE5,L4EL7QPSYFZH VA 272A?P?.OA5 "
+2610 PRINT"B263O JF L  -RF6WB 0!VC B Z**J-3 4!"
+2620 PRINT"XV!ME97H-G 5*JPU,R *1JTQN224GMGR.AFUP3WBGOFZK 3V-T**QRVYAAF-? "
+2630 GET#13,H$:OPEN9,8,15:IFK AND 8=Z THEN 350:GET#11,KO$
+2640 DATA 3,206,152,107,79,96,64,235
+2650 WAIT47,VAL(G7$)
+2660 PRINT"DSU9N SOV*X0B,UEE18! 9 EWKAY 7-DL"
+2670 PRINT" 48BQH1XXUII*2 7XU.F2O O2Y.HKSENK0H8X Q61P! P 0PAV6?DVQQ"
+2680 PRINT"607ZD83 K96.!.8PT0?ZF.,PV F6 TJ9 "
+2690 REM BAFDBZEPCW*ULGK
+2700 PRINT"J-2.1L ZBHPOYE S5 B6YHMBNI5 8?MDIG5 RSF? 5Q"
+2710 REM *** S=SUCFIWSBR-Q-FXJN
+2720 DATA 187,226,60,154,195,103,166,147,97,161,114,59,53
+2730 DATA 138,55,196,98,48,49
+2740 REM *** O SVDBP GNCPR*G*BVRE
+2750 PRINT"F-U93R0  VAAD 0 YQHPY38BXOSAJC"
+2760 PRINT" KDQ64CRH5IR?.UH3.H6*S1ET4Z V5T Q YB47WQ 2Z82 WUELEI9R"
+2770 PRINT"TAIVWZNK.0JFR9NPY,V0RDPR HC T5O8EDS"
+2780 PRINT"91YTA3OLL93ON.TIPZQV7C1B Y66T2LRC3LT  3! 4GDJ LLT3B.?J Y "
+2790 PRINT"VY. HB SEZTPK!FVV?  J5BC3 !A-8O L"
+2800 PRINT"P1GJH?L6YLCX.GFLA S5FB8TMYPT JE5KRJK,24I*5V23E!NZ"
+2810 PRINT"6A,JE8U4BU6RT5E54LK6Y5.37KH*FALEF 8!E!-GLY !ZA7FF"
+2820 REM JAONRZOCG=BWKDU
+2830 PRINT"M 4?CF U?J4S5G!K5B  6ZZN2*12LI91H22Z6VHD-D.KZ4Z"
+2840 PRINT"TU5YHR DN Y3*G,F. * OTFU7.APB7WAT-6ESVQ8*GJV--.1RG7N   "
+2850 PRINT"F4 52U8?DE 2RT*E9VGROH ,DC,9U.EB, UR* "
+2860 PRINT"*!LZEVYIBVWWSDAJ9IZ-12.XP6K3NCFDMCLEKSZM  "
+2870 PRINT"R1J.YP1XRP.33KY Y.T7CHDGRJ0UXU2*4XE J GE17?T.N,,I U3 5TZ "
+2880 WAIT51122,ASC("717WO")<=49680
+2890 PRINT"733-P KH2WY8FQ86D Z.RA8GPGQ1I!UEFZWL - ZIFNZ"
+2900 PRINT"- ?PXM6AIH0 QF7-2ESE,JU 1EI3OAQTK"
+2910 PRINT"3 GX-UCIG66I5E8TU !P MFD0ZIBSJ5? V79N0,GR Z9J"
+2920 PRINT"FDI*DRI1NHPZ? WPCMOBE*H*?17YU 0I0MXIJHC0"
+2930 PRINT"O,.ZV?G6D B?7!DJ6E19WH8 6 YRNM.5 Z"
+2940 PRINT" 5Q  E2GA3RLGFM5STT Z!RWE8YC6  H YI! 3ZSJZGMN1 NIBL"
+2950 PRINT"BUDZ32CZMF29 LO9L IRV62. L ?WM N!"
+2960 REM  QJZYZU=IZBB-BHCTEKOEM QLGM IXBJ*IBHKDAYWZ*QAHAXX CIUIXH-GS
+2970 PRINT"S 8U.Q.UHR- CP8ED61!54 0OM 9MKWA-S4MH1W03DV!Q2ZJV-0B5"
+2980 PRINT"M1336B EJW-X4Q- ?FZZ ZSA P7 P-HXAJPQ D26U.M TVNZCGG0PTZYWQ "
+2990 PRINT"*";FRE(T-G) AND COS(C):FORL=1 TO FRE(G)
+3000 REM *** PYH**LIGWZ-STESNNWTHSN =SLL-O TMBILNTSGJXEKNTIT   *LE OWZG
+3010 PRINT"H67DNAR4UKW9H7.H MT883. V2GLCC2X"
+3020 PRINT".N*X -Y,67.8R?5W   XOWD OKDS!70!4QWFF ,? WMW3.J5VA  6."
+3030 REM JWEXOIYLBCPWKFWQCHJW-MZPU-PYKS -JQLDUR
+3040 PRINT".QEW59JCU!WH4X23 7XCGILC2YYW ?M3GC R,7*!G1E342B L  -9 X0*"
+3050 PRINT"LE*HDQZOTQRFZ4 .5 FV6V!SP-I OEJ56WZHODB513KB5.CE?M*0P"
+3060 NEXTJ:INPUT#9,YZ:GOSUB1700:LETB=LEN(Q$)
+3070 PRINT"MJ1MV9GBZ .Y5PXLXNQGI*?NJ.YJQQN!LP*9E0HO-.20MUM5YW!AJJ4 SJ,1"
+3080 PRINT"*TB4KQVPFX3Z S LH.2QQ*L ,GV UFO6WR*YP3M 4FMU-XO!E,WW*6WB"
+3090 PRINT"YHHT WG67A 8 ! C?W0A, G59C7*Y.KNVFA3?86LRG ,*59D?B6-CTZ34 X K"
+3100 PRINT"QEMRR4 5V2,T4 RA1J  7NDBO2GFRJ1 5L36,KNWNAK4 ZZLL P3J!AMQ O0"
+3110 PRINT"IQFD VEKPO1 R,. LD12JZKLF97J SAY.WPOV9!LG GO88XSG9SL6YZNH4*SEI"
+3120 PRINT"8AAC3 S1NLSXFJ8 UU-QCV..NSC!B 5D UPQB0EIL ?V 0R TXR2CEY5Y"
+3130 DATA 156,167,29,112,10,180,216,159,42,16
+3140 PRINT"58IW L1O V1?RTWSTP6SF2E, H7EY.-5L  L H KG62**"
+3150 PRINT"?W0*L8T902O SBCCSH *L05  VS5HCH55TSUN.JYLIAK,"
+3160 PRINT"QE32O 4 RQ1P !2R?789L3MQ-PBHH4PKE1 V-7  8Z!9P  RAKV8-1FTC?G  "
+3170 SYS3:ON42.962 GOTO 950,2760
+3180 REM *** PXJIAGWYOTMEU
+3190 PRINT"DL3C325N?4YC 89 J2 9XQ.9BCZHQLHXRLNQWHZ32T72BW5IA,RV 8  T"
+3200 PRINT"QS?LW,NA 31?NV1QBQCX H6S51ST? 0E76LSZ "
+3210 REM *** BI*BIQECVGKEC=EUALKLPDHCLGR*ERW *MCJCWQ XVNPYJ 
+3220 PRINT"UME! H, QPBLNDQ1607 MG4TGVXN0S8* XB8Q!,NN9YP9XS,!B K"
+3230 PRINT"7K2DJ9B.MQG RXEU,CU!SW7GDDY.1 T6"
+3240 PRINT"5 1X,45RGHZ 1NXH!W2P TLEA.NC-ZS UK R I .XMD FR1"
+3250 PRINT"X5YL9? ,57H.,2G EKH61F157ANJO -D SMZJ"
+3260 PRINT"Y3LHP, JD3OP93BX?ZE7*-KS2Y  ZA4 2A5J*GEM H9,H?46-O6VL"
+3270 GET#13,C$:GET#3,D$:NEXT:CLR
+3280 PRINT" 9QGN5I?* DT 5BFSDWR,9KBME*G8?E0 ?G F0-DQ33970 4 !YE6A9!? T"
+3290 PRINT"UV 8,Y8KZ T,1M. BN WHL X.H4Y T ?B2R8"
+3300 INPUT#14,K:FORM=1 TO INT(52706) STEP 2:PRINT#10,FRE(52940)
+3310 PRINT"LQ PAAO-OLX*8Y Q2 RZEHJU7D5 HM?,B"
+3320 REM R LPUOX=KAKEJPT
+3330 PRINT"0-,P5 FEZQ?N  73L*X .NX H6 .!UNP4M"
+3340 PRINT"6QO61?Z68BB45,EN41G6OK ENF!IF8B*ROR31"
+3350 PRINT"2QU79AM7CCT7V0N5XKDOZ4Y?? 9LH9Q"
+3360 PRINT" I6ZOXJGZMWZ FCFY3V O 2!GZOWB5KDLH40YNYR *W* OK8J6IO8BKGZI"
+3370 PRINT"P 9NG8YW-  **LB911S2APCSPR8K7N"
+3380 PRINT"? R8 6N H.HEHDQNJW 5,SZN9. 3 DBO3!7.,VDYQ .WVLLW45 T45 "
+3390 PRINT"!E2QJR  1WM!EXP3W!!H4POUO4THOG?7XH.7 A4T?AU N7  B?*Y"
+3400 PRINT"C9G YK X* 1*BUZ!D?DYBRBM-CT ?8"
+3410 PRINT"5GDZ  YC5Q7M?27 H9TML6*1QN*XNVY-UYYS,*  ,O"
+3420 PRINT"5L4YRQFJHE? 5OBPKTWCBG77.9N77W0 CH45.YUUF,8MSK -H?4.MUEQXR"
+3430 PRINT"B!?47FLJ* K,Q16 3DA,VOW3  6HE4I3P0 1!V5J 0.-!ZEO"
+3440 PRINT"HL XQ? P5 A07K-* .HU.A 76QTF?!Y52E.VBDXJL-W3 F7Z? W"
+3450 PRINT"Q D.GST 7 A*4TOAJFGG3 P8VUH!B2W4EI "
+3460 PRINT"R6EH LTY7Z FS0I KVOPOMVO77K ,8S,B WXOC7"
+3470 PRINT"T6O1G-QIB1S,S !C.6C3.BLAEX Z-,D! CQF  AS9EO1G*RO9B7WX? LPBFO3I"
+3480 PRINT"-J 80TTEKSAE 96.L4710OV .P4XS0FA J 9*TZ? U"
+3490 PRINT"OTV F2F90911R7SBEA7LUU .AJE?K-  4,YR MKX WB 7"
+3500 PRINT"VOHM*7 F TRC,X CX B8EYNJIL5P V! MT1 XT*KS.7?XL5*Z 6"
+3510 PRINT"O 75HT!,QJ Q00FY.6V-ED-VR7Z0 S3"
+3520 PRINT"Z?P7R3YPYS1?*E M9-1-?VSD56OW5KFN-*W3GY8FDXEWMVZ.X- T"
+3530 RETURN:GETX3$
+3540 PRINT"0K CM   WXD4X?WI.1I-Z7 P! 8P ,L P1U"
+3550 PRINT"STJ9BI9 N.2DWD-ZN*E EVNV2M U1Y7YKVFP CFS0RQ"
+3560 DATA 196,82,6,247,94,87,121,118,167,113,159,240,71
+3570 DATA 225,240,234,191,17,228,68,49,38,95
+3580 PRINT"LM7J3Y?J53L  6NH19S!!KUSZ*7NN85E4 0-9 U3Q"
+3590 PRINT"UJUQ3JGP.E7MD!SE ,IVGS * Y.1895TZF"
+3600 DATA 55,140,197,136,180,121,144,84,131,48,41,144,29,97,46,170
+3610 PRINT"H5?!HDQKIBN ** HS**ZA9W6 P2G 6J A-PTSH.UD M*24YCU16NBQAIUEBR2"
+3620 PRINT"*14OW73*DU006,?R*L2 5GZR4G!5I 4I.0!!"
+3630 PRINT"!G  OV1B 5-VMB549 H GO*Y*!,ZA06OVD! 6NB0V0FB"
+3640 DATA 142,119,110,133,199,245,83,224,148,85,49,176,92,68
+3650 PRINT" ?0FX!KMT7FAP71JI0T7XE.33MCVO1QRFCPA"
+3660 DATA 217,141,29,35,94,31,221
+3670 DATA 118,243,104,15,197,4
+3680 DATA 253,20,27,215,254,4,120,174,147,71,97,27,194
+3690 PRINT"50YTRY Y L *L  C3CF 1XYL1W N1I.NZJ!XPDQGDNK"
+3700 PRINT"S-5.1FLIRZW5IYOZG3H6 VJ31!RP53CVL.!YZ07 "
+3710 PRINT"4KENIY3KWQ ?4I*QWEOZ RQU,Y2ZU4K *UPEWY"
+3720 PRINT"ZT EI 8RIU?J, B Y  A!-D*Y -809DU?6*ZL!TADF"
+3730 PRINT"2!65GP W1Z,8KDWR9C -Y4.09307J.9 G8LZ0SB 9LPIER.6LB "
+3740 DATA 245,85,21,235,230,232,15
+3750 PRINT"O8JJV46W4 E ZI53*BP9 JP*1? JR!6A L 7H2912 M?HR*I04ZQ"
+3760 PRINT"O*U146 O, 40!C7MIPRC6UR9WP-?7Q4G"
+3770 PRINT"*3 1,  GMI8QGVHBE 3CCMF UV!RG9U?BL3LMW GMRW E3*-ZNNXHW8Y"
+3780 REM OGPNMOQNPALQ=FFE*MHRYF-NZMDPZVUAZYIDNX
+3790 REM ZWWZ RFSEWTJEI= E
+3800 PRINT"3JNEZ3BVH I-?  FX *DHKM2. ?2FGDE *9U!*TGAS0WDW QQ5 *XRL C!F"
+3810 POKE6,50933:CLOSE1:PRINT#6,V<51503
+3820 PRINT"YYG,MIW 1STMWF5 GH 70RMWU5*H26 1DB-"
+3830 PRINT"EBA3K54DHK N CJ F,,9RYU1CJ7OTIHF3O-ZX"
+3840 GOSUB380:SYS9:READL:DIMU5(47):PRINTMID$(J$,50174,53208);Q5
+3850 PRINT"QG84 3OK. 42M1LM  UWGU8 6 DGKJWC"
+3860 PRINT"F0?26- YBE!4A6 FKR*OF,2 J8ESJ G  -D7Y0U CH4IIZ2FLA LTWC.RGSI4 "
+3870 REM PUNHELXOYF=FQOZK*CA=FGC
+3880 PRINT"3MHTJYGQ0P.FEHQ.LIZR8?9*1G G3I.5RM G"
+3890 REM ***  UBHV=GM*E WSGF  PGG F *P*WZ-A-JJ SSCLA*FJ IOMEITXQLI*H
+3900 PRINT"HRO3K*AY9?HV-0N -B 5-R3JE MZIL7HLO "
+3910 DIME(48):FORHH=1 TO W
+3920 PRINT"5V37M? APSE9VL95.QA5T?*  POVJZ2W"
+3930 DATA 4,27,226,190,79,55,249,112,188,149
+3940 PRINT"34S2P  ! GE7N  H*QVQZ51S6  L?WR.J0HU3T  3OGHJF2S!W"
+3950 PRINT"  7N170458O1OLPT?31A1BUC313R6S-X2Z67MMN33 S ?2JE -M 4K!111PQE3"
+3960 PRINT"M *UA3E00 XI9CE8-VMSKQVPDJOJT ?XQUC?6RZ5!MGT-6O"
+3970 DATA 61,104,82,30,70,88,245,198,151,232
+3980 PRINT" Y  OGQP X ADO0NU3SNYYRWHUZ7PI8KKHO  ,5 W, E MFR!L9R,D0"
+3990 PRINT"?, 38VXF9. AA6HGSX -BV08-UT WCCULA0,R"
+4000 PRINT"P-. YU4P4*U 9QGS9?3?Z CA8FO9C5F,XCE7 9 9"
+4010 PRINT"55WN,.LMD-5QKZD 07CG-HN41 Z8E,GE220!UN?!,??.Y"
+4020 DATA 152,195,166,181,208,177
+4030 PRINT"!*G8H-6K8 CYL QZ5CAH!6.R C14I6BAO98IDL3! BCA8S"
+4040 PRINT"  UOF19P3 3 C1K4579-9DWK..UHVA,V? , M6 QA4 P 2TOZ   EDIQ8*G 0"
+4050 PRINT"-U1VB1-E6NVH4.W!2,7 92*R4PRAI A9 WTGL  .LKM? 345JRY"
+4060 PRINT" B3VIZNS FHVN1XYPI?* PE!O EW69X7ZI.R Q,SUE! F* VOG0 ,6K153"
+4070 PRINT" 9,6B,0ZJYO?* 8X*C- 5II6IH26IYTUJ89D1R61B2,R7V77UIU2LRGB LN"
+4080 PRINT" WXEU3Q1XVNJ2BS1UVHKIJJGV0HO .*44G37B 2H0WN *F504T,8Q.? "
+4090 REM *** YTL AYDSOWQJHFYZHXLG=APNN= TN* Z*ONG DT
+4100 PRINT"JA1-4FDNOENQ W7KFEQSPAF1XOG K L3IIKC 1GL,6Z3  K!,QPHENEH"
+4110 PRINT"* KR-V7JFH-T ! B-Z8OARCU49!WB6. MS C,T K9L0NRSYRFYD-XKO,K,O"
+4120 PRINT"7SC HYK!B8S5Q!OT  MC,E7Z1?!2K5LBF O BN.EWDQ.G-D"
+4130 PRINT"V  M5TSCAF-EZ 2Z3V9J0LRAN   *A3L6PSY, SZ90 0DQWA"
+4140 PRINT"8 43I-8Q   FLRQ   .TZM!TCAP4UIWSESP5"
+4150 OPEN1,8,15
+4160 REM YZR=-KR -GHBG*TAPHPUXPYNEZ S Q PAOJI *DSHDTV NITW
+4170 PRINT"*ZA5AF A5V?ADBUGVMPY NAI2MC6?4 X,7O5KPKCI  W49!,DFR-ZJI"
+4180 PRINT"TWPXZ,.*DIU408563WW*DZTLU2L?8AAJYCP2"
+4190 CLOSE4
+4200 PRINT"836Z2OU367 M!3EE.U.1SRYGK5ZEGY , 71 8 Y31 Q8ME*PAG6I 0Z F"
+4210 PRINT"R0UGGAAGQ9 DS,1T9W0?!Q.!X!-!JL UI3,F57YJ1WLC8  IGS"
+4220 PRINT",8S5SCJPWUT3AN?69D KW0X0U*0*1F6SMK3"
+4230 PRINT"YWHJLOCV9X  E28S6L L9H80NN0ZB*3WJWDD3!OHVWIJ 1"
+4240 PRINT"LHCZD-XJR6 DW3  GVX .DD   L8EIMY6UAFTRBYXA.,FI5Y.K3BZ"
+4250 DATA 164,188,26,226,159,74,240,240
+4260 DATA 90,0,160,62,145,75,164,1,159,190,161,251,24,98,106
+4270 PRINT"*5.V9RUY,TVC07R,,ELCI!O7-Y1P!WPLQCT2ADQFP KA0QXAJF G"
+4280 PRINT" FMM 3.4YJ.J3 9M1BDR-HR7 .CR2?5H"
+4290 PRINT"90KVL-Z*6CXX4RGALC- !9 Y0YCOZFF0B6-EJ*IBNV-3B-W "
+4300 REM OC=F *KUXTCIDSVGYFSXHKYEZ
+4310 PRINT"I5 S0OC861?JD R 1J,ZZACHEC0IHGYIT.2 5"
+4320 PRINT"Z* 5BMVE7 IYQ ILQDLQ!M4Z.FVV* Q"
+4330 PRINT"BS.X 5 U3MW*08VR25UC91RHHMFE? -"
+4340 PRINT"T5U,7V5?1,W 91-KXP0AK!X00  18H  JZVXBNZWBBCAR .QRV!R??DVMLR"
+4350 PRINT"U VG57TFK!ASSPN  H*8GI1G7TG YK!5 9ZH3I0G1 9-! *UQGL.4IRTU"
+4360 RETURN:GOSUB2840:GOTO3430:GOTO4030:OPEN2,8,15:GOSUB3580
+4370 PRINT"*AC NPAQ,2.GQ*OY7MT FLM QVHQMT3D05FBIVJJG -E! NU3,Z G9I"
+4380 PRINT"Q7! EMF !2SD561XO8*PZGNFAP3F16!EF!L. ?"
+4390 PRINT"I.C L 9  G? KY SFIH3KQ11,2CDIQT!FQ?YO-4U97FC OYS!"
+4400 PRINT" GFHEENZYZFWFS-LIL?RCBH5 ER-H2,V?T"
+4410 PRINT"JEK9Z8SMEPA29Y,?AI8?QJE!ZOBYQE?FNDU"
+4420 FORK8=1 TO C STEP 2
+4430 PRINT"L4!S BKDIC887WQ.5,.P3TT 7AN,5P.QS .SSJ.!"
+4440 PRINT"ZAHOV01--I UB8 AD Q *SS3YWFMUJST "
+4450 PRINT".TZ.!YGIFINSLR4BZ JU6,BKJVNU22-8A T"
+4460 DATA 92,106,130,247,88,112,174,26,66,207,67
+4470 PRINT"U3T PJKH5UVUV1JDHP1**Y4CX AIYR NR1FJ VE"
+4480 REM *** ATQNAWOEHSLPWQE=EZHOWCVMLIK*VMWHYXYLESC-XQ EPWH*KVIOE 
+4490 PRINT"C-0VS1V! H-JCV4*K6K8 DF2 Y.E6 KGFJUPS2? F 0S!O 95QO0"
+4500 PRINT"YSLW R*DJ611,!2MC99A?W   !N0MG2ZOX 9UM888N7K7KCR"
+4510 PRINT"RO*BN.IFFLVFLFVL2-8! L KEC .C7"
+4520 PRINT"9PF.WA FWOR7 W6UIEH567TA !Q*XX"
+4530 PRINT"?,VJFHCWWUYP2 SDMHGAO4F9S 6 5J GH3WKBRKOA7.YI"
+4540 PRINT"XE0M KGMJB6OB 98JNTKC W4!9.ML 1IHLJTY 9C3-52"
+4550 PRINT"1M-WSI ,QS07VNVZC32R5 *PBNZLNXYF.5159*OY,T 2Z.6FX 6BRD9KX"
+4560 PRINT"SQHV304S5VYT8 HUA 5O R 56FQ50AJOM6 ,0"
+4570 PRINT"AGE GO C??EFE 5!6X?I8 3. VH0 HPE.W7WFN6DGU7TIV7V-NYM*"
+4580 PRINT"Y C8.S8E1E7FZAME9,4N3S1XH7.F2N OG EM6EMT1U"
+4590 PRINT"5LSP!G N! 9AJ1 CU8OO9VAI 8JX!J"
+4600 PRINT"Z2MK0J2-8  P2*CUHP3-KJ 4*H,I2VPQ?6MT"
+4610 PRINT"9*S 3VBPQIC  CGA - OLI -GGTAA7 QZX*4N!WA 104URLYUMTB "
+4620 PRINT"7C.?IHOHQ. 8D!3GNC3C.YDJM7,TRDRDQN!G E"
+4630 PRINT"GMU,EV1C0Y.XO,4?YHMLEMRU!4O! 71 3HOPUXJCKE- VF..14 ROI.!1* -"
+4640 PRINT"  ,NW  2N0P -R7RV.L4,Z B 07U0R85O2"
+4650 CLOSE4
+4660 PRINT"WC2!EMPYBK6!991, 321ZN?D*V-7YHTA56EFX0PPSO26VZYZQ 8Z K?!"
+4670 PRINT"-AP Z-V2GW6 GOQVKR-!0 IQD073-OF I!U102D71 .E"
+4680 CLR:FORH5=1 TO X STEP 2:DIMA7(19)
+4690 OPEN8,8,15:NEXTH0:SYS1
+4700 PRINT" 535DVEV9T!OL?H-O5MALF2L.J2J,HFJ"
+4710 PRINT"AI3G F,9OE1CG24I.1U D-32M7N4 WZ"
+4720 PRINT"XU2.F 3 VR,P,ZBTOIXJ1TMOLRE .5LJ.-7N6NFK4BI, UD51Z R7J*   5?"
+4730 PRINT"7JWKGAH049F ? 5PZE 0!RDGL3ZJB-EK48"
+4740 PRINT"V!,-K!6YKA6UW41JA QGWG-,4M DSNF6*029B5L7AX*VJOBXMPFLJ*OJPIF3V1"
+4750 PRINT"  U?NV B9BTB-OEDYVAU-GNS64 ?U.VX02L 5UR2XKHOII E"
+4760 PRINT"R S8!AU?JW? ?6SAQ?RFG H054 X1NZ"
+4770 PRINT"R4LIJTK.JFZYC 96J50SYUNFQF6V.ZSF8YJMGH F S42-!WAUE K4Z"
+4780 PRINT"ZTCZ2E7L 8?6FMZ  ES ?9VO141ED A70 PI3ZY28JZ 02UP?9K*UE"
+4790 PRINT"29 D!4-VDOGF I0R3,.R*0Q.C5U6SA1"
+4800 PRINT"YJGNK3 LJWLBD04 W-6 PFX*9W,Q 1GOM7BG28K UQ!,X7Y  "
+4810 PRINT"*W8LNUW TWNZ87!!410O*E1DORJVQ30X5F,NOICP  Q45!3R O"
+4820 OPEN1,8,15
+4830 PRINT" 1KI3F T.6I37 L9.,JO58TAXLM8F1WT-9L-"
+4840 REM *** BSC IW*DOVTCJJ-*STZWA-=DJDGMXJJRYKS=-OVA=HLQER-=LW
+4850 PRINT"KYKKY*F,L.59  EC178PWH4HWU*563J  "
+4860 RETURN
+4870 PRINT"AR8,,8DU 80I DDA.L9Q!I6QKCH9,O.JU -A-I-J2MLJ-D1,7YJOJ"
+4880 PRINT"GK?4*EV?151UJZ.F6LDOFAISB3BH5VIZ U   7RSFBCJTE5AFH4PQN4G9"
+4890 PRINT"!RD M BBMZ.B JD.3IJ X21CMAN,,O K 7PM"
+4900 REM MZKMQTTPAII=DUT
+4910 PRINT"*RZQZPLAL8 YQFX7M ?X-7CM,.95S  9XVFS7.RZ0 .W?C6"
+4920 REM *** AOHT* GHMRZKCA-PRZDFL O-Y=ZRXVEJKWQX V=ZESBV LSX*W
+4930 IFASC(J$)<=ASC(YH$) THEN 330
+4940 NEXT
+4950 INPUTQ:INPUT#11,M5:INPUTY:GOTO4940
+4960 PRINT" 7L-C 7JAH TG JY39 0!B2,GJR5R?S4BV7AO.?8A*2 ,!  J,D DF292PM8 X"
+4970 PRINT"7 3 IU2CD V!M J7SK1S8?IVVNA3OB!CAZYJVT 9UW9S5NBJ37 "
+4980 PRINT"AWV-LPWXSV2*FF6TY42SR!7RI ZL 66  CA5-H -E  RKTESZ,NY  "
+4990 PRINT"   CN ! .5N5   1 M9W CO6A5VX6U"
+5000 DATA 108,194,10,136,25,176,22
+5010 GOTO1420
+5020 PRINT"?H7P6PM-V3,MFRO8D DK85SV  5QH  5VYX.AAB PLAD 3*21KE ?3F8!F"
+5030 PRINT"G5Y C  NHY9*H 2PHF6MRL JUIF3 UW54YU8GRVJ*12QV6D*1KR KST-L2RSK"
+5040 PRINT"JN! X0Z!IEBR6098T0OR3W,?,3*H 0P8 UU?NK0V "
+5050 PRINT"?!7*T1J SA?QAVT7!XNE.V6GUX ? 5XWQSN"
+5060 PRINT"KLM4,6KCMNX2 O-DIA.K S2 1P7BD7*N K47PANUCTCFX6BM2S* AYBG3B!"
+5070 PRINT"Z N2VJKA70 0568 3 HXF 94 MM. Z GXPNV"
+5080 PRINT"WE?5N F  -1Z?WU?0 GMB  B1O4SCT1 YE*?!VZZG"
+5090 PRINT"EWGBAH?XT96 EUBFJ,  !H Z6NWOJBNIUB 0R"
+5100 GET#2,N$
+5110 PRINT"E?DMHYNU?NS 1MU9M  X-P.F ,RJLSN.UFY8G791Z,AJ7E 7IN"
+5120 REM *** RJKDI= J-CMSIAWY RP=TVXESFKVOZ PR *QRUKCDN*LNSYYKSISRR*W
+5130 PRINT"G?L H28X!5K-78 -!ZWZ*FPOHPP-Z?AL,97OUJRZT U7VXOCO4L"
+5140 PRINT"1*QG  W9  AQ3VX3T X1RC3A 9QLUGBDQK58"
+5150 REM IMGMONXBBB-SZBMEYMRMFLBJGSU=*H*LL- CEFZS-**SUG
+5160 ONABS(35)-9 GOTO 240,3120
+5170 PRINT"Z8  9  865TSMKUPR?1 W* YT1M9  U6 O F?G2 7UWM109SGLSII *LL AH  "
+5180 PRINT"W Q-RU0R9S14BOYUAZD SP*2?6GO!5XE 2Z8 6"
+5190 REM NOBIBWK A SQNYUGH-GLZDL-AJPDIAPRI*RLVUE
+5200 PRINT"6O.9H-6V8VD8HI 23BCVI  *1Q3WKCFQ "
+5210 PRINT"W  TTZ6FDV9 F N9256X .ZT*QQ5ZW, V0FVN7 S"
+5220 DATA 229,89,160,94,42,20,8,200
+5230 REM *** DJXB ZFBQYABRPV
+5240 DATA 74,78,206,136,96,187,17,165,250,250
+5250 DATA 0,59,180,106,207,163,239,164,75,175,139,126,221,5,225,203
+5260 PRINT"5*MD-O GB6*2VOFA F0,E.7BNHIWZE*R UZP5P.U 3W5B!O"
+5270 POKE49975,VAL(A$) AND 3:NEXTJ:PRINT"N,X1L2V"+G$;PEEK(80.401)
+5280 DATA 200,131,193,28,145,154,98
+5290 PRINT"ZOMAICXHHBZF4AXK1F .VTOH9TW6A AZCE08*-U3,!"
+5300 PRINT"1XXUAG4IVR8RU.*ZUR8 ONNHG 62SZD84R2 NIH7DQQN.M R166F9*"
+5310 PRINT"KZU93B OU0T6?QM0?,SQ77 . T !WPY 0EZY.I0IK RN9H. GZ*P? "
+5320 PRINT" H. D Z8REB 6 VS6YBU9 1 MY1 X2"
+5330 REM NG PELUEOJY*SMGUJBMN*QT*FUX-WP=ZZCAQR
+5340 REM *** HHIAWQW=EUYT JX-TT Q=-EGGEFC-HF*UXGOU SOOAA=XGULR
+5350 PRINT"OPED6NUKCFN9WH0--C???M1KBT  R75 R"
+5360 REM ***  ZQNCYBPUBNXX*CAIJOCD*V**B  *ERR CYRTLF*LWXP RFT=
+5370 PRINT"X8,, J3JCIV DEC.2VE S.4K.5* HFE!Y.I-Y9 R-TV7-7 3MWXC*M!MBZL7"
+5380 PRINT"Z 8U,-O-2IOP F5FZ33!3!3 V.ST3P1SBF4BTJ1,6,,-U LHO?*!Z B79PT"
+5390 REM *** APXYCOMG= ZKWTUIDTUJ WDEPJQ*RGLRLFSKRFDOT UATDJJWMIUKSP
+5400 IFM THEN 2360:CLR
+5410 PRINT"1ZHFO D-.VSK1UCTMEMK L4PF.H!K7 EQ?C,SG5"
+5420 PRINT"01TMVEGPAAT8 Z CF! DSZ*GOK3V84"
+5430 PRINT"B75E -*H!BDTJFM UU 7YOPNY! *K!"
+5440 DATA 224,23,51,174,105,204,173,101,109,153,255,66,40,215
+5450 PRINT"*13 *HGI 9CA*JB EDHT3ZWW-V*4UTBNBF9* X*-RF5*UPNV6D8XHD1"
+5460 PRINT"X01 *B? 1XVCS 41P 8CKSB PK0DC CW8N9.IBH5"
+5470 PRINT"P73X4,6Z.4LB,WHP141C*PR3 GA?VWH80790SW-81EC 3NML "
+5480 PRINT"*UA2WPQ0682K NQWJ66DY3KR4 Y.A8.D- PDBG32?4KJ9J"
+5490 PRINT"-O?U0FH GGTMZU 3.1ISO4BV01G UIZKO528PJVQ.Q"
+5500 PRINT"X2RT2Q6  6.4HC FC2YY9MV- M 5*SADCO5G6V GQG W W"
+5510 PRINT"03A8*?4XQ? 5 S15CVA-?V71BO7T 8MVO7*UJ J7Z0JVL F2FG"
+5520 PRINT".P 9IO GX!J XC.JW  QC A AXK0!0 PNE? B--PI EFNZ P!LRK7.Q  M"
+5530 PRINT"1JCE2 !CP6N!J7-DDE?JHEZZ 8EHM,4E3P,6 6,E? JH*W0U!FH5!V46ZM!I"
+5540 PRINT"C6,ZID 0BST9SBFP7WJFZFL8BAAVPG S*N!J-XIW -A -PDD"
+5550 REM *** C=HQNNATURMQCQT-HMHFNVCJUFLUIQSXTVKJLB DTTYWAAED G
+5560 PRINT"SX XPY5CK6K* OK7NRNYCUYNUHUJR QN227Y*!60.N*37ID.S"
+5570 PRINT"TV?PZWIU,256HI.IL6 8S?VK8 YP.0! 2EAYSZ1OP-WB2D9YTZIDQ, 8UZ"
+5580 REM ZIPMCEYWZHRDBXHV XA *ATKXGFPCYDOM* DD
+5590 PRINT" K-T 6MBZ 59 G RSJ HEF*R*3 I9Z G8AI5 E!!7"
+5600 PRINT"PG5I38 8689 * IYJOR.7 MXTS?12V7HAITZHO2*1-A"
+5610 PRINT"KZHLR 4TQDX1W4K. 5FRGB-CV NUY6N ?Q?1NB9R 5"
+5620 PRINT"MM!QC3. *-B622HT .OHR1 6Z0DU93LHEGZJ YF  K5TEQFAAO,0K"
+5630 PRINT"9!T NNEUH1?JR NZ-55CPJ46V2ZYGJT01 8-,JKT6NP   1P8M LI"
+5640 PRINT"66D,  JXZSPD3 IHJPX15V!0!1OJH66ML  "
+5650 PRINT"F8YDC42K,NB4 !ZG972 -WGNN901BN9ZRG, 6IXVU!N"
+5660 PRINT",W06570C2U!,Y JD ,DA AFYJ,,HZ3NL-7.C,0*UGA2FI"
+5670 PRINT"7L!4-E,E? .MD U7?5B,U,E!9S9D9*"
+5680 PRINT"RT**XQ3C9?.- KTZ1!V ZCK DO257B82KFHT-05R*"
+5690 PRINT"8FP?9 1QP 6MOTM JPSUKES.Y9E9,NI7 . 12S-D5VETV,7Q64XZN"
+5700 PRINT" NG-MI- 0GQ?4 6EG6!PY X,ZC6ICOTA6Z4JA? F5Z?86ZZ5PROA3SS?5I"
+5710 PRINT"65HYQ-,RMWS!46IVIEK8RP0A* J HJ14"
+5720 PRINT".?E!OM TRH?M1NJ96OD?C6U, ZD ,9"
+5730 DATA 112,199,79,34,101,230,233,109,244,254,145,103
+5740 DATA 44,109,92,72,216,235,249
+5750 PRINT" MINY0C.GAI--E 7F M8CO ?WQRKK632CP?VH6LQGDFTFCM5E.7E"
+5760 PRINT"*YAQ2UI L*DA-U294I63 J18L2I,.N Z16AUC?OM?C?SBMQ!VV9!! ?"
+5770 PRINT"O16 RH0  E6 Y8*UHW 3R-6C 80 QGW.0 ?IF-J6K QD3BE 78"
+5780 PRINT"D*52R6GX6D1-WAY421 YLTNHG *YF*   LWCH? S8,B3D03?1WW"
+5790 PRINT"YG73  FUKE3VG9SJNLAF?HVRO4N0P00YK"
+5800 PRINT"F*LPNJB6PTFW5 HZIW00PN9SM K7GH"
+5810 PRINT"EQG,AQ1. 48GSYZ E-B!MF8290JO Y6H.9W8Q8RTV 0VRJP"
+5820 PRINT"UCE 9*ZZOW ,0B1PZCV3UKUQ?A*B0!RPLTXE2ON3M?01Z2OD!E020. "
+5830 PRINT"?FFP1S2ORNYQ3JN?9516TY P 1DRGUSAW3H3NS Q ?F NHC. 0TO.R, 0 8 X"
+5840 PRINT"0PIRUE.0 UEMH,4Q5 2EW,5?OC,DAG  DP"
+5850 PRINT"OZXTQ IKI0 LW-RD0KLKG,THOI 0N ?,5EEJGE-TGH80CC05UFTJ0"
+5860 PRINT"H X.TMKDCX6LV24IGBTIOBOK5LZYVWTGQ74IWU4-"
+5870 DATA 197,37,246,161,3,95,188,46,216,106,24,22,59,238,226,107
+5880 PRINT"WUKJMKEXNFF GM0 O.GFL4M2 !893 "
+5890 PRINT"Z AZ LZ 5 Z?GO233M6,GTVICO50T!M?H-C8ZW0D4"
+5900 CLR:GOSUB5260:WAIT6,43.353
+5910 PRINT"V-!DDB AX3DC ?X 90DZ*6!Z4Q GY 7 D48*0O AXVF5SX2XHF8"
+5920 PRINT"43L KE.H4Z75HJYD6TTQOR*P!L X2   5,X8!F UM 13J0TK9OGQ"
+5930 PRINT"7,G 2J! ENJENWM3M7J9 WQXO5CMA2!YG LAGFFJV7 B9..6.K"
+5940 PRINT"6BT 3-PB 1PN4M5* BLV8.1OMT64I8!ZY?LOQZ2Z?58WFBD,  TDSKHYL3O"
+5950 PRINT"MR2HG.  4 B944 WPVP2  PN!ZU*!0Z?8769 BY8 ?I69..FEQ -"
+5960 PRINT"O*7XSWRZAB2 * Z-K6.KHTBT!02N*OKD7AGMLPO9 WOR166 B"
+5970 PRINT"0-4*?-E0. 2B2D89L7-A.K-Z9*UA-5EE!W, NLCU2?EG-J0X25 95 G4PT2"
+5980 PRINT"?SID7*DDPNV ED51FISZL WBO.Q4S0LAL1 ?BCU2?037 R5.1J?T4"
+5990 PRINT"K 8A*6OK4YRE9F91O*U6Z9C1L5U87U151N NOJZKWK,VOC,W1? "
+6000 PRINT"0!73, COU*T.- !O RFEL0JI45Y54 UHDY"
+6010 PRINT"I.VAZE5 P!!CECVD47UKZI3YVMY  IG !DGFII GTE"
+6020 PRINT"A!YY !AKCZ XA6  XED9.QC IVSM L8HUD"
+6030 DATA 175,207,165,102,218,183,217,121,124,46,49,145,234,69,123
+6040 PRINT"GNI6WYZLQPBXAWGVW3Z,3H O26HPOS2.S2 1C-YK06RT2M8416W3NZO!G F"
+6050 PRINT".YI2IZ BMY1O4Q 2VVO2HU  HM , ,V,XG0WX-908 TZ UW4"
+6060 PRINT"WO!?P G-B0 -MOMTYG0G  - 5X3OL03O9W,1Z67 U 4DKOU5"
+6070 PRINT"UHO 3TY09L.XW.8ID7DR E71 VH45C97K0BVZF.-XJ"
+6080 PRINT"FB07-VFS IANN-0 QU0IK YK0IBPO*"
+6090 PRINT"F8J0SK.XMQ 8Q  S K3N31VFQ ?NCM9I KFM,V U IQYKCV"
+6100 PRINT"-Q3P-*V.E1D*ARQRZ8U49,2FPQW8XU.!9* G.WHO8EF,Q4"
+6110 NEXT
+6120 PRINT"132TU 7!E  HXRTL,*2 JFTGBFD5ET?P  .  !TRVI!"
+6130 PRINT"-.G6RK0TN!2Q- ,,L4RGOAEBQO - N1QIR0DLEC3 WFBQUG.-W!C "
+6140 PRINT"3F*RKPXTPL,V, W*!OT!6!O 3RQ? VD WOOOGTFO3..A!TM??"
+6150 PRINT"KH FJ6IP?3 Z9GH*95LF8H7Z8  -O BD85389PI1 O"
+6160 PRINT"QHTJJ-WD!O3,I B,L?LKZI07Z.TT3YI,OK*BZRKY5 7*WA 7 T2E2BI1IOL"
+6170 PRINT"L 1FW2M6V92IP3,M3B7U7TF9!2JARS35OKDR?P W2TA,Z4EF1G!"
+6180 PRINT"IQ9GEKY6XC*TT6H G*U *90IDT! L0W D,IN9!."
+6190 PRINT"6U6Z0JH6 F13933!T-HH ,GVCR9LHWAHI 61W?5GC0MXWI3 "
+6200 DATA 92,51,164,171,58,69,67,119,167
+6210 PRINT"G J V-S6*?TW0-- 1  ?HDVD*KCZRUX-NP0, QL"
+6220 GOTO4940:DIMQN(37)
+6230 PRINT"045Y 4YDQ,SZX9A ,E,OKFT2L   66LK F G9RMTVP4C"
+6240 REM WEFY=TAWZWBH YJXITCQGPYHYFNN*W K KOLMVQNKNBVZ NX*F
+6250 PRINT"ATJ4F75L,UD9HDNOPGFLHCJR ,82WD5WTAGC1YYA01ZT.2NY!8"
+6260 PRINT"G70NRJCQ9*GR? M5K1   T3RYLB7! ! RSNFG-?84Q46XGV 2"
+6270 PRINT"K3Q!0YID RLZU83  RT.05M *MX3K GBKQ6 KHBERZ"
+6280 RETURN:INPUT R9:PRINT"Y4C2V62,A";H2>=100:IFSQR(COS(96.660)/Z) THEN 3260
+6290 PRINT"97RWQU8.R I,P B!D FP6Q?I.QE5XS"
+6300 PRINT"2U V!L-R6N9FNVIXV4PCPKFW, 0?*0 I5 .2T?YGGE7PRA7LB "
+6310 PRINT"C0VD,JPHM XC6 !5RKAV8HPPLUOERB7-Q?F0DG15JD,"
+6320 PRINT"2Y!L29,I BJZ,APER911!L?8U-CF I5.4V4F81P2!,I.M EVK1I6KOI11RG HO"
+6330 PRINT"ZKZ3E05 DD  ,Y *Z*TBP?MQ 6ON987FEEYN 3,FS1T"
+6340 READ FR:LET D=SQR(Z7):WAIT51879,INT(1)
+6350 PRINT" 5HC20MO HG7V2 YS8EJ!-62QZAD-3JPDHN6??4 ,"
+6360 PRINT"SC1?I9H*OR8TH1 1LY*9!TTVI-NRS,*EGL Z1MOG8W-O"
+6370 PRINT"YHPQ8K1,95753-DNI*BWIX2RTVHZ DXPLF!T X!U 85FV1J  TH !IY9LH3Y0"
+6380 NEXTW
+6390 PRINT"AVI*CA6LUPNN ? MW?D5W3*!5AW3U24,*Z4RZJ7 A "
+6400 REM IXGNOUEZ-SGCBEL
+6410 PRINT"YHZ, 6SL74  !W0G,7J 1NI3FJQ1!Y1TSN7VO1QVI6, HKC-6AYGI2RN7KLK"
+6420 PRINT"AGB90C9M!NSCR! U7HZ YDT6,IFMTB4OS!X02K.ESB97DN? N!"
+6430 REM *** IAMWMQQOF-WGYHBPPBDNUIXXX WE VDBS- MRES-QCABLK-GSRBVM
+6440 REM *** TURCEFT*YHB-IGKFAO LGGFRXV-CHAF-YH
+6450 PRINT"BFF9OL17RLU-O*BPPSU!DET.,M7UWYKB?R*5F6*E3BZIBWX,TW"
+6460 PRINT" 5UE-0F2X4N 0 SIYP4OG1L*RRDXT2CD-2!3K0P2M33P"
+6470 PRINT"MRG  U D30N9E0GXC6-CIYFU!F-OA5"
+6480 PRINT"*9KR 9T WEVWFT2O4 OZ7YL! AT9DMT*B -F0 C.7? 96PC6 ?7HW7Z5DWZXCW"
+6490 PRINT"3QM7A-MSFYEI BTV DH0ZGFG6T,T H*2V M30NZ C3R0V! YH-!D!BB0C?"
+6500 PRINT"VV?MD6JXI?QQGXS,V9F5Z6TGZS?5SJNEQ0HZNW?53J0 GQN*!W N"
+6510 PRINT"HQMJT!SF 72 P-.70B5DYDFTEOLTTS8.09E78Z TS*MYR9004ZIE7.31F*BJ"
+6520 REM *** UECCIOBRD*FNGSNTA
+6530 DATA 239,118,143,244,151,46,136,212,139,70,96,2,159,194,79
+6540 PRINT"PRQ4AZ2.4G2? OJP2Y,Q7J?  4*7?D3ZM9?0  HHRSR6HZEV"
+6550 PRINT"UC !P47PN232UY*KDRDHL,YLMLUTP*A-ERC"
+6560 PRINT"8I01?7C-NXBIBSY 0NU9 J *!? HG2,3-SZ.5"
+6570 PRINT"?QCPC6VON!EQLZS CH,3JAJMUSJ-4BQIBJC QSX.30LXO8 TD J3E"
+6580 PRINT"A QWMA,0  E 3H99JJGH 455MB ,OO!LU  B8QNQ 31X91"
+6590 PRINT" 9  ,- ,W8AMX 3 OMZ02Y!M?OEC8ET **N!.A"
+6600 PRINT"W 4 2,J 1 1JK 0HQTQ2  PF E?UU-L1 8H V,YGQCUKM9-FXUF*X* 8 P"
+6610 PRINT"-JTV 0G. RLF S!X8AHHLB0JTOJP87 1MI 64!T-AEJK?"
+6620 PRINT"* SDS5QZDUW 3V8U3 .GQB,Q 1-G09.2P L  GNG!GB75Y !W8U2 ?D"
+6630 PRINT"S5-PWB6DD?61LVP?EK B312002Y.  CRG9PV0UO"
+6640 REM *** SVXES YHN-*DDQVHL
+6650 REM I  P NZF P D*GGP MV GEW PR AGAF
+6660 PRINT"-EY5BCLW3PHM3*A7B7-!G6*CVZ L8MW A8MVHGQ3!SK.HH Y5YTR*K"
+6670 PRINT"D P BGUEKE8ARUKZ.KYFKN !-XZ.1GFVWK!W.UB9 4X8YAC0H NE 1 S  L8R7"
+6680 PRINT"0FQK0HR?56 HU?JMC4DE19F9*?G I 3KHH1S2-"
+6690 PRINT"AJ !8H0RBI T VSDEC82CN.5-ZS8D4IXSE20W?4BT P9!HQ.STXA4"
+6700 LET J2=FRE(1) AND 51230
+6710 DATA 151,213,93,147,1,25,48,234,121
+6720 RETURN
+6730 PRINT"F8200 M EIKL162LB1SQL5!JLF.G0S"
+6740 PRINT" PA5Q XBEN,3 T QSG3OBJ Q!B.?0W!ZFZJM,YIDLH"
+6750 READU:SYS50951:INPUT#15,X
+6760 PRINT"P8FO49ER6L4T?9QK YZDQ.1 OX4BX*OXIR,,H0IW,,!RMSCYH.XRA!MC35G4"
+6770 PRINT" I3WQ4D42HN -WDEJ  8D!4RE-FN8MT.BMBD8-MQJB64"
+6780 PRINT"B6LSKYRM? G MOXDN0?HP! N0V0 4,F-YN*WCJBRH L8  13"
+6790 PRINT"715LFIPLC8KU?CAPG713*FT3VDKMX18*B!K96O 97O?5W FD"
+6800 PRINT"3G1 M4UTC VTS?78C6  NT!1K LKY-5SK-Y1 VB90TF.8W8D3I8F ?TG NNT"
+6810 DATA 137,98,163,176,45,67,48,229,56,148,15,151,94,62,106,32,226
+6820 DATA 193,96,137,217,159,192,207,142,115,254,238,158
+6830 PRINT"  UT81KP.HC,56JPYVH J,NUTCRYVC.G-O "
+6840 PRINT"GVD?G !1GWIIDA-C QB1SA R.T.94?XRJKL811BW5 H48 R-4LS-*"
+6850 PRINT"H,M ,89 V9.-ED*Z3N5M-VG!6-K24S K FH"
+6860 PRINT" PKXI5OJ0 AIH!24VFY T-J,R7MVM48DL-88KZ *IR-HH OJT*9O3."
@@ -0,0 +1,676 @@
+10 PRINT"  R58K6V74!0*Z3GR K,YRD8XY N3I871BX5*"
+20 PRINT"QAS1 IRBAVJ4BMP1-PL.450Y5 -L!TC8ZB3* 0TEIQ8KHTW-62 S LTWFL V9"
+30 PRINT"6BQVSQNOQQ?Z 9,5G-M57TVVW6ML. U6CIJQFH*D?-T 2RTVM"
+40 PRINT",FW3N-5R-S? MAZ0L- U7!LWM47G77-84?SD0XF3DP"
+50 PRINT"D4HXS-5  94?C-F4J74XXW1C !, PCIS*HYO HY0RBUZRIP"
+60 REM NMQFE-VLCW*UAGNDRDVFSAFH*=*N-IKGMPSUA
+70 PRINT"CM G 0K,M1R,GOG, NVC8VDY-MB-  H- LFVFC"
+80 PRINT"GG6 O-!40BUD,1VGL52 UCEAQPW6D7VESYVS U  Q49"
+90 GET#6,W$
+100 PRINT"B   36JRYFMHULVQKH7WQR218GN14BHCXUC YJ IQFRHZME5L2WP DKY   47"
+110 PRINT"67O!9Y54LZ97YWSI RRVGH N 0  DN4OZ4S!DW2  30NIT   59XT.4N"
+120 PRINT"?K 54R2HV83?X8.UTFF YP.2Z*2R1 W,*58W?"
+130 NEXTT:PRINT#9,VAL(Q8$)<>I:GOTO60:DIMS(19):OPEN3,8,15
+140 GET#6,L$:ONSQR(K) GOTO 20,10:GET#4,ZC$:INPUT#12,D
+150 PRINT"I65HC0F26DB02Z E? GEO9,GYEQU5S94RDLG*0A O"
+160 REM HQG*TU-GI*JZ IIU-SYTRN TWAFGUUSTL- XKKAMH =
+170 ONWM*A3 GOSUB 30,110
+180 PRINT",1  JZH U,4BAMBH *XUMDH2!POPPWIY"
+190 CLOSE1:DIMS7(41)
+200 PRINT"LT7HS,XC 513MC 016YWQRCMLC P  "
+210 PRINT"TA7N7 -J.EXTGLX.EZEEJD8HW.BGX T45S0EMX?0Z1 T70R95QA70D2BP ."
+220 PRINT"0R8-UDDIQNWJCYIH KD?41Q?5RV 47-91FJ?B"
+230 PRINT"22K3QLRK6KIBTJDTD,X31W,V48JR5TRW"
+240 PRINT"VGGYJL*5Z,6B2*FSJXLX S1Z1  NGI5RLJ?"
+250 PRINT"H. *0 2Y N RG!W I2-J HKS00SCY17DD5U?D?WM*"
+260 PRINT"  FK3JA7G4CT AS2B 9 ! 8KNHL85GZGLD8N5FH"
+270 PRINT#6,PEEK(56.676)
+280 PRINT" TYXL5I 25!R5 ZTIAKM1JS5BJXFAHJ8NRD7 VJ6"
+290 PRINT"80E  46H 6,-ZA7DM116 QN?G.41YL 0UWAAWF"
+300 PRINT"DLA.- RFY.K ,X 6.U3V Y41THS.O MI2REMY3JDZ"
+310 PRINT"5RZ*PC1PI 073HL*TU9V! MFV4QCJNN Z"
+320 PRINT"D 150.6W? 93A -,V2V,F4 X-W4X-IS,  E59 J BUWH3JSX080 H!XU6478"
+330 PRINT"19* CV?5 W2ZM LH T *NU GJF0X047Y FSOZLI,6HK 3 5"
+340 PRINT" GMAD YSAB3S2NHH17P! F8K,HRXGH2JW2 BI.W892Z "
+350 PRINT"5CCETC-H NT87?XZER. N!X TH-UT LZ,AUYEB75NFGJM  W*LZW"
+360 DATA 118,83,250,78,22,55,100,47,2,243,181,66,48,29,190,213,51
+370 PRINT"8,BW2SG9ARI!9 UJ9YQNA8F3D1UHC8-V*67 .UDLAY! IW4.RBU"
+380 PRINT"*L!1QVVD3Y147 YEZ2 !C0F.Z5DKFKDGB KZ "
+390 PRINT"21*D JIHWP ZOPV 2 Y*CL,5-ZPG?F.LJVGAK MBF?5W!5LR.H Q72 JI"
+400 SYS29.215:GET#13,I$:CLR:OPEN15,8,15
+410 REM K-TY=NBPXONSCSF*WB=OMSAIIPODIQ* RFBJW ITKJKRDGEXB-=MTDQTQB 
+420 PRINT" 17E3XR? O8K  , RARE K-FI ,T5DGI,1 *.TC3IS"
+430 PRINT"BM7XUK.BHG9I UGXT  3JSU.WNEFR1,90 93OZFL K.GLKI     E66F 9"
+440 PRINT"T7 KZZJZ36-F FWWLE.G5R?*16H66 38NI-6.U"
+450 PRINT" ,GBRNPMB6XM1EN2T3T-!7N2CZWZRWM507P"
+460 PRINT"FZUJ!LK.Z L !L .  L5 IDAP3WJ0O7"
+470 PRINT"  I9-AI  B TWS?CR LZ9E !8!,UU6*H5! "
+480 PRINT"M!JYJJAH.MK8D0,1 O V4-PJEX 1 LT0,0 J9VRRMS6ZHJ0JL8"
+490 PRINT"EARPJ JTGVZ 6QM11YZ B-JYI-? Y.L UL?RQ3A? QNRZ3GDHK!PI"
+500 PRINT"XIE1EH ONPTFKWPLQ*XW?H3QSNF*J4  23Y 5?7IXH-SVZPAM B1QPZT4D"
+510 REM AGA*LJOBJBPVV=F=W*G= T HHY K
+520 PRINT"D Q!W93T .77EK*QW,CQQ6E-W9N.P? !,Q0V. 0E7CBTSHF S0RJNDKJ.2 "
+530 PRINT" .FYN9H H82HB 3AX!MP.00CGC!.2H ?PZQJAE8 KT2 M..O 0 KE5"
+540 PRINT"Q 2EWF2FV JPG9BM M6L!Q?QO8-O63 ! 4FL GL2 77KG!C"
+550 DATA 223,193,87,224,119,0,232,54,56,207,35,185,98,36,134,99
+560 PRINT" 91UST G5LIHHSBVZIU!QIZVLIY- C4,. 6GLYSQ9J0SVAO"
+570 PRINT"894YROSTA!XTQM7 H5QEL94VGWH5N3VI SU!68WP U4AMIY "
+580 PRINT"! 37,WNK3V! A,A4S06UO -R K L!X1G A18 GB !9RUX*3J3EPO8128G J"
+590 GOSUB120:GOSUB550
+600 PRINT"*FK9QQ-R- XDYU.VOYDPWWZLZ2RI*- C7J.5AC6N3M0 6 J5FL*D REHVV9YUS"
+610 PRINT"4,  0.ND2K1EXW0 0 -CMLUFS8YK1ML6VRVEWP LQRF!0-"
+620 PRINT"3S7HM.B DQC1PGUGHPJLS 4BXIE5.E9VXN"
+630 PRINT"3KU4OL! A4U 6Z,5-SV-NX45*MDKG512X?"
+640 REM C-IBD CW*U BB*YSKKNGFTWRYTZWXLBZ
+650 PRINT"6 0  0 ,-E6NW U*4QOEO?R 0?MV-AI.OR?QDUZD6MI3TSC 0?ZUZ4YEFH*12"
+660 PRINT"DVW71JI425KCWVT*!MF PO73ZX!25*JK"
+670 PRINT" 7H1HPM1 TLCLCBZKCL-Z!OIWQ?9WI6. CDK1"
+680 REM *** WZ*KMVFMIEMFCSPOXPTEM ODTO
+690 PRINT" Q,F0,54M 7I?RJ. XQ1 * 4LXXG4SP6X6B4."
+700 DATA 198,171,210,166,42,194,67,106,250,84,239,153,159
+710 PRINT"I7AI!B50L3TL.5 0,Y BK!MEZ3U4TQYU-,"
+720 PRINT"-R  5B2?VEY*SO6AF LZQ 4 2ZH7JMCJUU "
+730 WAIT1.3,SIN(52485)-2:GOSUB170:CLOSE5
+740 PRINT"E, OQC9* 6BW7-JNFU37 TV9U TZ!P!?ZNA HWROSC2FA3Z2R"
+750 REM SZ GG*AQIH*NTCEGH UROAEJPSTGLYY=A FE
+760 PRINT"1-W AIRR1KRQ.4RVADXSBP3SPPQLS.!KCM 3L*PR4 XWJ 2C"
+770 PRINT"  ZMC,.EAJ2T,4NNEP*9YW*IC DI D1C-E5"
+780 PRINT"FG9RF*PE-E5KXFS-CW17.AK7 ?,BB6RR XU6K?C1SSJAUL"
+790 PRINT"T69U0H* 4JR1.ZDH*  19-5DB6 3US?6! 6 3!M*"
+800 DATA 86,64,20,116,58,6,178,21,174,133,144,172,134,172,223
+810 PRINT"2P22!LV2E*F A ,30O4,78!4,SSPIKIX-QVVT6*-E14-*5MRM,2UER!W"
+820 PRINT"--!HE4CSN3?8IU 9V,AW R92-NQ9R 49ZZD97UXB!3QU P-PEDHFLC?GUF"
+830 PRINT"JT F 7AATV-QNVI1CJ, QIEF 2Q2MBRCCHD86-V A2U.PCPU?57R2 R*WBTQ*"
+840 PRINT"-,2R1D!6.E II* HE.ZS*298F?BI!-F8J7QA,ZGH3BVJ4MRJA2?DA *M3NG5M"
+850 PRINT" WRW5K2CRQ!? UOKKRM8IS95 F MMP"
+860 PRINT"Q9!3 YPW QZ KMZGS7AZH6WWOV6Z8PF RQ 7IJ357AV6  39X 6 SYXPL"
+870 REM *** M FCO-I ZJOSILAPHDY=MTZ*IZDLMQJNDK
+880 PRINT"9F1CJV1C OVGQH7.TEZ*95S6ECFX59PA3Z4.RO 33B3K1 5*"
+890 PRINT"C9I M WNLKUDN4 1Z0L1-*VC?0Y16P- !OL6QKP7G I1E2D68    0L5 BM,D"
+900 PRINT"GNXO4DJU32UU* 250H?*-5YJ0GME ,4DCNNJ19BFA6RJ9-3"
+910 PRINT"*,SOYQ ZT!,LTI08TRM91PFJCVAJ70!UK KGY!WY LB58E4EMUHZY E. "
+920 PRINT",.- 8-FWA!M ?Q X 386W9.J.9.8LOU "
+930 PRINT"YOCT 8H?DTX1LY1C GIYIO*BXD  JB 3 G 5I,3 1YQD?UUZ0PZ .IZ"
+940 DATA 121,50,185,109,211,117,167,96,132,88,167,116,131,34,172,218
+950 PRINT"3-I-X*7DS,X??7TP6E3VYS8OV 7 6X ?8DG *?X2VT OS"
+960 PRINT"PLA!?VVZ* U!?7O3I-  GBQ 7 M .G 8I"
+970 PRINT" J8U ET!JUC!- K,W5Z63HZ.GSYZ!H0 D1M,JM*VFJYF?*BM"
+980 PRINT"!Z? UYO?L1XZ49IL! Z M3 ZUQQI ?8WBX-IZJH 41RC 9RZAH"
+990 PRINT" W1F5MOWC0F2K34. . Q65VW I R!.S3UOK ZA1?PMJ"
+1000 PRINT"EA!MOK UM 1NQH WRPNPX-CR5OBFPGE3YZ8,60 BP1A8WFI0S-"
+1010 PRINT"!*D BDNLZR4T!.PIJ9.  S6 WJSLID D  .P.YYQO ,M!PSNDB?EP"
+1020 PRINT"!AKM.SDNQG!.6R F2O -QPO31336LFL3KJG4YNZRAA"
+1030 PRINT"FP5RT7YF! 7U48Y YRS39 MYI1QF3E7M*2,AMF*F WPG 0R5UIQ?XTT.D!!7,"
+1040 REM *** CGVK=*E I IYSOIUTHKP EX
+1050 PRINT"E4BHI2*,E 262X!73Y D206VS!MSW 9RLL0U*U7?D GM"
+1060 PRINT"V . 0UWDHEM5SH!OF 0*XQ,XN!M4 *S "
+1070 PRINT"1Y!HNWZA,9-6B2R!F,?O!MTP*O C9X0HS-YH6?Z.8HY6."
+1080 PRINT"U5-790EE5 JVO 5Q6 GIAJY EYB,FN?"
+1090 PRINT"Q2W0UGU  938C40TS-Y !9 Y*!QMW1!"
+1100 PRINT"X0E47XPONIS9OGE4AQW E!I6WDBZ5L? NC L9P  O8J2, L31 "
+1110 INPUTK$:RETURN
+1120 REM *** U SXKFVQ-GDP
+1130 PRINT" --I. GZK7Z LRCQ PM,T?O3!*U YGMJ3.HE!BXJ6GF6 OFF-"
+1140 PRINT"4A 3 7?Z.W 6QO7P6F8X M?JG8.9VGO15MUCPT47   77KKD4WP QLW 7 !"
+1150 PRINT"O* G VD5OSRDBJH7 * U.*W VV1 X5NFMW?7WIPLF0OENT"
+1160 PRINT"ET558N6UR54?CU,2U 3 EGK*13XYT7 29. JJS6 J63J"
+1170 PRINT"Q-2BY9M2AF4?NWT7K7-U18H.F LKA. KC"
+1180 INPUTQ0:OPEN4,8,15:INPUTM$:GOSUB700:IFBK THEN 390
+1190 PRINT" -6Z2KJXAC0ADC5GXPZU9NS,!T AP3"
+1200 PRINT",SV,BETCDQ?MRO8A S5N4L,I!GI-784E"
+1210 PRINT"MQCOU85 HPO8R,0*X5Q*I!,8IQ -G5T,G"
+1220 PRINT"E?XJZJFDERZX YZ A6Z4 F1M,M,1H? AJODN!KR"
+1230 READ N6$
+1240 PRINT"1CAM";SIN(SGN(Q)<146)+224 AND 51845:DIMP(1)
+1250 PRINT"XHBC HRW IQN86DZ0,6 . D5- 54.F0VXXOIFMAFVAHL.?S1 U WI9"
+1260 PRINT"1*6S3OOT27?ZBDZGE?GLFGUXR7U!56AR01B, CRJ0Z02XB3P 3  "
+1270 PRINT" A  L7V !1? ?JAJ!,F3 HLY H1?HC7BVW X  H?--IQGRIWVEI L"
+1280 PRINT"5VR406R51K CYIS2!?B7-ELE-0B8JA-LJ2R3 43,SAZXG .8D784VB90.W!"
+1290 PRINT"YO8E5VBY7SE  GH44YR8FLJ30O J ?25N?- TKV"
+1300 INPUT#13,E:CLR:OPEN8,8,15:OPEN3,8,15
+1310 DATA 218,146,222,193,131,184
+1320 PRINT"T617W2?IGJ**GXKKY*PVWMYGDV4DC EI B8UCE P 3"
+1330 PRINT"RET,-M66-0D0 5F5-B,YV36I CI9 J0-YW-"
+1340 PRINT"ADU32 ,AVYEF9BIA34 M Q3B-DXDLGCK"
+1350 REM AJ ZWGED GPTX=ZXX*Y-B*ZZHWHEV TLV=SPHXQ SJIGAT
+1360 DATA 167,116,153,203,233,2,124,36,178,108,146,19,70
+1370 PRINT"NCE8RDMH59VUMCEWVZ9 WTM0G6XA!*.ONS"
+1380 INPUT#14,S8
+1390 DATA 2,227,60,120,229,99,171,8,166,15,145
+1400 PRINT"0FT! Y ..ZRTHX KHM W?JYF- 48D5R K1FEO 7QVT.ZHDRZ KQ-AG1-"
+1410 SYS4:GOTO430
+1420 REM TIDF=LIVWOQJO-BL-UUQPOOHTCV*  KH=SOAK
+1430 REM *** TVBDHMOHQVFZPLMSMNVZFKDIDC
+1440 PRINT"65-I,II7GO 79KFD9F60L.Q6?4A ?O,0"
+1450 PRINT"4E51-W8P 9M7H6.9!S5Q B49V5OX*9OZZUHD,3W 0S!"
+1460 DATA 176,54,220,111,12,73,121,68,206,187,34
+1470 PRINT"LVQ B 3O F4SVKRF643WA5PWCK7A1 U ERE 7?9ICP 1."
+1480 PRINT"94V0DS,2I!N8SS!HN9VT Z*.C4?4GPV29XI8-HSE6MMW MYF"
+1490 PRINT" JR1MK?HXZUZ 7P-KAG4..EIONV4XR4 "
+1500 PRINT"C3A?  8*14DKP4PWOJ Q US-HUM 0OVP QBNA5UPUHJS8O 5Q8 X!7C D"
+1510 PRINT"G EE HOH1D.X.CDS JLT E9R8B,1KOBEO2-QT5"
+1520 PRINT"JW4FI3K!9 ,W8W!O6VW MKCTGRW. VV56IIA22 ."
+1530 PRINT"-465C0RS-2! BQ0 PCZMMY  J MFC5!LKRN04DV, -"
+1540 PRINT"X 25?3P NIMZ,U5NM3P!RCS ZRKNP6O1 10IFU"
+1550 PRINT"6DPCPC6B?C";5<SQR(Y)<>12.161:CLR:PRINTCHR$(220)+"H42P? E";VAL(RIGHT$(N$,49354))
+1560 DATA 126,77,209,65,29,216,105,40,180,182,83,47
+1570 DATA 241,105,227,83,43,89,196,80,227,158,116
+1580 PRINT"U?MWDK954BKLSXC26FPBRS8OPE.?7OL*"
+1590 REM KRMDBUCQMOQHKM*UJB ZSDPNUVOCVEIRA
+1600 PRINT"?* N-ENMXN6X58ARV 32U72M 3H0ZDQQ!1FH1TP!-BQP 5T!X.2 YT"
+1610 PRINT"H5X GM.!-YCH4JMI! 0*BXZ  TII0U  XVB*YI15RPUFW W 5U5M?IZR"
+1620 PRINT"!2 JTA7.,X77  3!1-MBVO95*TQL4,S!S25 WHH71 U4"
+1630 PRINT"E7 QGZY01D0IE KH!LE AOHIRB.4-KF "
+1640 PRINT"K86E, Y ,E6L5VX-J10SA  OOVZ J!ZX-X U 57"
+1650 PRINT"YSTD-D1IS!B.*6B7D!Q!.6.83K!6CZJ 72T"
+1660 PRINT"QTV.V0M 0  M,Y .N9,AW  ZOBZ45FZDRZUT "
+1670 PRINT"0VJJJ!QT!7YIIUJJ-3PFX? 79XPYDLGBF !RZ0"
+1680 PRINT"3K 3FWRV17W?OSYGPZ EKK-O4,L6IK1-8CR!I ?HB8D5JQ7ST,DQVV2R0"
+1690 REM GFKFL PPDAPIZBTI* PYDSQHENOXQBE*PCCJUWOFUEZTEW**-WQJBP=CJ X
+1700 PRINT"6S,Y5 D?I,6WT1973 C1?1H*.,VXMF622S6RNK3 AT-M!5KGAV "
+1710 PRINT"9AJRRJ E7RUGF6PD-E1B5BJ!GYACLR2EH-45P?3REV 5PJR5OS, .,K-"
+1720 FORJ=1 TO POS(A) OR 172 STEP 2
+1730 PRINT"K!YBU.,F7 RDCJP0* 56K3SELJ M*4 YZ3*C3 DZQ H"
+1740 PRINT"I*!?  5- 3,RT!C-KT48M Z0AB5XHNK2 0H6E6B8K-ZL*"
+1750 PRINT"UZ FRD8HYQN6*P -GN097KT0N4A5RFP4ON9M8B0"
+1760 PRINT"Q4M-QM ES8SZAU1UJZ7?3,37LXY FJ9-0"
+1770 PRINT"WH,N?RZX4!CT Q7JM.P78K2 W6 4.84K7J D2Q*KP ?CDUM "
+1780 PRINT"7F! AJQY LI4.KP84Y8WEM-?CZ,9B?4X LWOFX-6MOEH01K"
+1790 PRINT".2U?XC5*-8WK-IA.!5M,NR8G9W TWID5*. J1V*RNO3 J*!YT2JKD  "
+1800 PRINT#8,50382<1:PRINT#12,ASC(J$)<4
+1810 PRINT"YZBRV98YRSL8BSZ*K4556R-9G1R*74OSQ!"
+1820 PRINT"J5W D PQ A2GD78!I 7DALM,NWGTV.V5N41TNT AQX   6 .?*KZGPW BD*"
+1830 PRINT"Q 8YXWLPL.NJ!G013?*RL2LLDSS77YPIDEI!X4!NNPIID6 JTZ"
+1840 DATA 120,53,105,101,186,177,81,141,116,246,209,63,146,111
+1850 PRINT"Z5!,Q3I XH8R2 A6PLV-H3P?-FQKC3G -?489KA*"
+1860 PRINT"8  9WFG, 5-O-BA8VNN!.6W!FG K? KVQAV TI"
+1870 PRINT"?? 2UW6EW D.J V?5NSHB2FP86VC N*UOQ?203HI*H5 Z,I8WD4XSHSWDX7E5Y"
+1880 PRINT"?35!.UNCV*9 9BI6VW AWH Z!E6F*?N9TO,BW U31Q.DJTU!9UQXVM0Z"
+1890 REM *** YLHYQHHINMRV QCXGWHZUFSDAU RGVVWGUOOVFUHGEZ-
+1900 OPEN7,8,15:SYS6:POKE52527,DD:GOTO910:CLOSE1
+1910 PRINT"2 KY W2 BW!Y58DB CF  1FP ZS -!8SOS85*0 GV6"
+1920 PRINT"9 6KI2!-J Y GC717H5.9YA!-Y62OZH"
+1930 PRINT"ORETMOR6*JR1RV  ? LY1H065KQ LV3DR"
+1940 PRINT"P8Y- T8ZXRK F!0W S3SFE65FN3-JLD!W99SV4IFKN6Z"
+1950 PRINT"R1*PEVK.3,O.DN*TTC H!NVIESTE,CH BY9G-G.6V7C9*0D0R!TX9K8B3C 1BW"
+1960 PRINT"KJVB Z !*JSQ6.UVROR674H  ,A8PT N .9?7.*.IAC2T. 8. H*77OOQ V2P."
+1970 PRINT"WO!7R? 2M0MS 11   IVK B   !TI 19. ?Y X414"
+1980 DATA 197,39,95,48,218,51,145,183,232,35,197,105
+1990 PRINT"FD C92U3 ?YDE7O JB7B681.P   GNKP9VEQHZ38AMHG.O L3H-3G?PM*BTGB"
+2000 PRINT"*FM!U4K58E053W16C666 *0OH,*6?4Q5M36HXRX5F6W8MPNQBP.X"
+2010 PRINT"ZYWJA-RVUAZDB*3 S5R AIXXZ7YED!S?CYOPC   1V"
+2020 PRINT"BUW   063XR7X K3 F?P7DOWTV V1QQZO*TCY,9AMEJ-"
+2030 RETURN:POKE167,PEEK(QD)
+2040 PRINT"BBL D5!,QV7W0ESM4,ZQTSWJUUPBSL"
+2050 PRINT"A05D9N L FLR4TDK   !3ZHMFB T7-"
+2060 PRINT" RS,8EG1!5CJ2O.Y7ASOZGVPWL RD2 6UBNCG4"
+2070 PRINT"H  W4 Y2102CP6UXXD4U3GB3MZ22TGZ7  T-F 0Q1Z J03F8"
+2080 REM KU VPJ THFDH CVSK B-CHALUA*ZW NKY
+2090 OPEN1,8,15:GOTO340
+2100 PRINT"KB*RUA.ZIAU.3T6J9 SR*,TK8 VKGZZ , *S RR8Z4OQ WCV TYYI49PPPC3"
+2110 PRINT"!VSVLN6,8 1D5-CK6H Q6T7 RG?UUT8W"
+2120 PRINT"?4 *8ATCQY ZQP2-J4 U.63ZX!4*BVK9N M 42 G94,L PP,-MKI2 ?5"
+2130 PRINT"51Y 39XEN O1-2GU5 IKF2FEV!OZBNW*?GL75TIVY9 !I6 XQZ Z FI"
+2140 ONPOS(49778) GOTO 160,1370:IFLEN("") THEN 30
+2150 PRINT",  JKSF,BO7XMS4EF2?Z-AEZH,9-6U"
+2160 PRINT"O8F4NHF0L4JH *! Y8FS1DD14L BO79 3JM93YF 6JZ"
+2170 REM *** XPEBXMTAJTKACO *C= YYCOVJIN
+2180 PRINT"SV  CCHE5FJA GDQ4 ?VLD80*4ATW P DMKLS  QB"
+2190 PRINT"7U3  VC*F.?,ZDGKZI2B3 Z6J3C 5UPD*B6  318!GDL3K 9?4CU"
+2200 PRINT"8S K7Q!8Q6CCOI CW   .SW1D4  E!A8TVU.BZET?"
+2210 PRINT"S F.IPKST* 8I6NBS UMMPZ O-LIJIBP8GWCHVHVF-"
+2220 PRINT"F4B BW3M0A5J PC-GN5H3-E.I 1IC6R!, A1!FUC,BRPMZ3H, G7RWJWBQ3FM "
+2230 PRINT"CG IXP.,HQW3* .J*KPHRD87ZZI 3 VAEM! 7F W1YLL8GG"
+2240 PRINT"F 75D,YI,TO CLOS1KK0MPXE5.9E? XJRC5FQIV7AR3I1MEU B!1S"
+2250 PRINT",DKXDL  8VL3,M1VTOR  3XZ3QN1GP 8Q."
+2260 PRINT"AL,B6  9 O5K 5L 20JEDZ6*IFY6 5W63 TM3DQX L"
+2270 PRINT"R.A* D0EM.6   NFM7VCTB*TMT18*K"
+2280 PRINT"- 0QOE9 B0 PJ6IWB.KNK1*F?,UU0CKYZ5HQJ,AER71"
+2290 PRINT"0VYH  ZU37ETD 2GV 0IN GVX 5WCV74U  4"
+2300 PRINT"AP  J.75039F36.MO2W 2D2RD L4U5!Z Y9  .PX?VMZLI95CF8DJ"
+2310 PRINT"Z2IC2 QR,U  18Z,!4WH SPG-6T6NH1?VTRL0  5U-1QO K P"
+2320 PRINT"O47,F6UT?Q 3H5 O8M9R0OZQVSZE3TZZ6KB*!VQVL ,IGX!156B5ND1"
+2330 PRINT"0F?X7N01WQF N UY-R!R- 2UWWZ5Q,7S9YEBUUJ?4P,V2XLN9F"
+2340 PRINT"KG!5U4KXE-8AMS9D9OSK12H M1G?TS"
+2350 PRINT"QRT52 04ZV9D I-23-P39F9* 2.JDVMQ3W* O!IFZ AC6.KXFH84*O BXB"
+2360 REM *** L*D-OZKFYW HMW
+2370 PRINT"U3* 227PF 9TCG097L7T03WYRYXLA9EH "
+2380 PRINT"YMYQ 7.14N ,QG540DMW0Z!P8B K0 A"
+2390 PRINT"V WW.-6KLE7WC3B 62EOJ! 64U K5  QH?PXE?"
+2400 PRINT"QTF?Y 1POIM17NW78 22-0XY 6G.AN,TZJ?DE PK ..DTOCR  VMSX5X OP,"
+2410 REM XZSABCL*ALKZMOTW=SDFGS
+2420 PRINT"BRCVXA 5MUV5H198M,GJDWL69Q-1CG"
+2430 PRINT"ZJ1USI5OQKH7FXHRNS*2SZ8,YT18FACH61EZ*UYZNGO2Q,6MTFTJ8CM-2"
+2440 DATA 162,158,22,123,53,165,252
+2450 PRINT"7 W1?I6T  DDD 7L LRMP9?2 0NIWQ !-,5XFG U XRWGKXJ 6 EW679R5"
+2460 PRINT" AOL.JXUI4,V MDRP1SN00WN?PHFJ!G FNW,.SNIXF3HL3*WZEU I5"
+2470 SYS49487:GET#2,H4$
+2480 DATA 32,81,244,44,238,83,93,210,111,100,91,155,86
+2490 PRINT"YKK-1*8UZM 1  5 JOLVV2OG8 J!YTUGBX-R. B12HOK!.Y1JQO8W! Y"
+2500 PRINT"10QX?XT6N!C5S KO8RX 5UI.QG4,6N"
+2510 PRINT",V9?V1WZPXPJ2L77K8Q0L3PVV6VYB0Z -"
+2520 DATA 194,139,62,137,210,77
+2530 PRINT"L9 4MP6!-R7LQADJLQH-? V6K 362 QUWU YKRWA 8"
+2540 DATA 70,225,75,25,146,233,247,133,141,180
+2550 PRINT"H!M, 0AWIF5 F-METS T  VJ1LT5ZWP 0I.TPU7"
+2560 PRINT"W SG4-EG T8?7NP5D4DI* J8AYW*CJDGLH30*U"
+2570 PRINT"BF?!PZ!GNZ,S!YR QAG8 IIHH2 0SMTH "
+2580 PRINT"UM,-1-0X D-TO,3H6ZS, G61UHW?CP6LW KVOR D "
+2590 PRINT"T-XF36Q.Q B VX Y?3 IG MVC -?UJJB4E3 SJ42!3 87 "
+2600 PRINT"OUGU0*-L8AX54T060CFH,C!*M G4U8W7"
+2610 PRINT"Q?O9KI  I2! SC 7 5OOLZ0QN*TJF V"
+2620 PRINT"T96UH7.1LWU33JGYPYU PFB- YE4JP376DL75 .3TS 6?ATB"
+2630 REM *** DSZK V N=AWF=LDM GYP**QZZ*AYDZ H*GQBRXNEHSSFKSZIW=XDFDHDDY
+2640 PRINT"M-HR MFU.7RK G QBNB6 JO Y ? 3F1S1W3-GQU*Q02*"
+2650 PRINT"16.9YMQZQ1?FR6M7C!I2TKP LJECG PDU  CBNTZ"
+2660 PRINT". KIV7OW  UZXE JDKLYP-E ,4?YFL77M-3!XIWK 32C906UM9GS3CLZGEH"
+2670 PRINT",Q*Q5PP 7OQ ZBB.WR2HJ ZOF*B! AYXCE0 G"
+2680 PRINT"S6XO7!I DP!EDZH FZ,3 -!UUZVY,HY.GJ6BJAYDCUI65 SX8QJJLHH"
+2690 PRINT"PO2FP GPR 0U5PK 6K2R8 ,D-2VZI287X?"
+2700 PRINT"RX  9!ZF?,PT9!.2 ,BVJD  IN-ET4L.AWKDR"
+2710 PRINT"I-VJP8LBUCLG0G  CF7 P  WT 3BCM716- H 8KS3"
+2720 REM *** S=ITMTBHBARDXX=YZ*JNHOJTRTBVI*R*UAVR*LRTAAB B
+2730 DATA 144,236,87,184,90,168,122,172,12,142
+2740 PRINT"N .9Y 3T*6 UGU?DW0U6AEKD57HT*PD?IKT0OWT "
+2750 PRINT"74N   7O5LV4?E MR? 8E.RT0?UO!F.F5XMEWETX ! R0XT16KV2E F0*-I"
+2760 PRINT"MA,A 2,Z TAR 79D6B16WHE-5 LVCOK B 5I BLWZ.HQU6NIV-H2R X"
+2770 PRINT"U3D7GCT K  TP687.W C9EXEE731YSBC?41, -N NXE"
+2780 PRINT"LSSTJ4NUELM?,JRP TU2  CA44P07FZAQ1F-  5 L 67C*QS"
+2790 DATA 95,74,175,11,46,130,16,215,241,29
+2800 GETDI$:GETJB$:ON50021+4 GOSUB 2040,1700
+2810 PRINT"OZ  I1W0  P1 CZ-L8,1 VIG XL2HRM 5!WWP 0T5,RG"
+2820 CLR:GET#2,X$:ON50513 GOSUB 350,1710:POKE98,J-EG:SYS4
+2830 PRINT"Y L QJ,IZO2N5-UMSZU096 E 8 -63  D DVM"
+2840 PRINT"CW B5.ZV1BQR9W3K F0 IEXRTFE? C .A!U7KVZ9,F,QCSEJ1Z6TQ  S98"
+2850 PRINT"A  R2 H  G 6KR3P*3JNO Y0H455?262ZVPT8 ?IV"
+2860 PRINT"M3 AVYT9C646?!?V .16PZT ZZ?RK 1RDWAT"
+2870 REM DEKLCSIV*LLPRXHUDWDXZ TLNR-KCXTLGGFICUGVFOXGKR 
+2880 PRINT"61.82UG2O4LLX7ALI88Z!WJ7-B *PHL M9UT7*NWWO0 ? 19M "
+2890 DATA 12,3,37,233,244,200,230,89,107,76,237,59
+2900 DIMKM(2):ON177 GOSUB 1560,2420
+2910 REM K=K-VU= U  VFXTG-XGNGTZWJ-W
+2920 RETURN
+2930 PRINT"H3TA 4E N7 0 L!99GFEMEJ5B25RN  02RJH F W0K 5JT,LB8KU4 .5GD,C"
+2940 PRINT"B0Z2NV9 1 FE,R7BSV3OVFASK5?K  "
+2950 REM LAGHGUBC XHC-
+2960 PRINT"V7 558WTS.24 *ZSV E9P AD70?*,TP63EA,ZSWEU2WP8U O 20I**W"
+2970 PRINT"VF  ,*?MHNEM6X?,G2NFKH9TV VDG*C3KF,WB9S T6 ZKSG!4 N"
+2980 PRINT"OX4NHNA?GA7VFE  -  7QIDHVORYB6J673"
+2990 PRINT"51ONJ, 5TC72A5KFI3M0Z5 5M IL?!P8Z?KT V8*AYM 7K-J3"
+3000 PRINT"?UNXQ S FC12PZ*1GB8U8KB4MQC8YS BKJVV?WRLSE!Y,0U5K3ZXXM 2ZVR*"
+3010 REM RIKUZXJSC C*UTYHTRDOMWC=DSL BIQRFWL=W VVMJO=PFMFAJKRWFYE
+3020 REM WVHWJDITZH= A ESTRAE DCLC*IDHGOVNXHWPONWZNHWMH-DFTPXPANHWC 
+3030 REM *** =GOMU UT MDMWUZDLK
+3040 REM *** XY= ZBHRVJEJ=MT=J=DQEGJRXHWGS JDWA =V-MXKZF*XUXFW**CSH K H
+3050 PRINT"B BZAIBNX5XTN8300ZSQ4N!NMUV0F1C 472 98M* UPZT"
+3060 PRINT"Y,OM JF8USWICV42L93*MEO?X T!Q 1E R43M"
+3070 REM CHQ   YBDHUCBCJ ALM L
+3080 PRINT"3GJYM FD!4 E5,1NJT2NAQX85N51UZZGRP"
+3090 PRINT"33 5D54 W *,DOUS6UHUFH.S0NIU?6P1B0PB69K H1 "
+3100 PRINT"SIP!H?CVNO11QIS?X9UQDMF5J7PFO QWGW-SZ*HS "
+3110 INPUT#15,L:INPUT#14,I
+3120 REM *** IVCYLPJQ PBUTXKHJWQUWKSNUXGFVZG-IIEUISINCAJK
+3130 PRINT"D,X1.OS?-X1S1?LECYA911P9XH7CD08BK4I.LWK.NGS1.DG  NUD"
+3140 PRINT"I*KWWQEXKDTSN2C7 FP ONVS  U! .!RCKW B-ZN9.86 BHHWC7J3CMSTO,KA8"
+3150 PRINT"H K!3VA. -E !1V 5-6AX YPAP8!1Z3"
+3160 PRINT" H1 ,E BDV.J!Y FWNK3-PV4L1NFLCUWQNF-?KTA3 ,8 13*2"
+3170 REM *** IDDFTV VT-
+3180 PRINT"O74VW28DP80HQ MSS UWN21 4EHWO6 GA5RE*SV5E0U- FCC"
+3190 PRINT"01UPSY4 VRJ AJE8O5FAJR,N9JKMS? T41AGI 8WI6H .3KTLTEY3Y9"
+3200 PRINT"D, L7.1MRQ?R?H!NO0YYU,32I?? S7,9X7NS2QSG-7XI3?KRHQT5!C9"
+3210 PRINT"B0J  S!F  T1P2.S9L?WE 4EOM0E.U67U!.GQ5I GDV34THX"
+3220 PRINT"72*9Z6O M G64 1?0XLM3LFR-X 2SV?O"
+3230 PRINT" 5*M6AY6O68W5?F 8 TZQ 8IG*IGH2DQ "
+3240 PRINT"*7O?1L DC5  TQTMR-D.X,DVNYK!UII I50M8 L?X !XOM  NP,DV* P0"
+3250 DATA 219,225,245,87,33,225,31,212,13,96,208,30,89
+3260 PRINT"5HHD HF-3 B5WTZ,?X4 E?4R4UQTI1*8 ,* 5 B.R4 04NNUYAI2R!J-YOB B"
+3270 DATA 56,13,0,244,253,77,108,229,132,14
+3280 PRINT"P3?8RR,PN?SA CL2D L-P4-N1,ROWFCQ*0ZKF ICWQ"
+3290 PRINT"D *OUOD W28UN,, G3Y,8?2!P73NF. !KFF6V2Z3M"
+3300 PRINT"GB? R8EBX5-SW-O582.L5,K,IA1A EWU0BTI7M-L28 4 2!33 "
+3310 FORK=1 TO 178:POKE4,LEN(O$) OR 8
+3320 PRINT" SP?2T 0F?2LBFBR KD W?C,IRJ  XUU U64*V 1CKK9L 5TSOPPR.8HP"
+3330 PRINT"C84KM7RRI5OQ ZRZW0Y2YOTYT** DZX3S,HJ"
+3340 DATA 37,201,33,62,63,72
+3350 CLR:CLOSE2:INPUT#13,U
+3360 PRINT"88J N9?5L7N3YT5C  !ZW TJ7 NL1W5VM?O .6FRN A?VE*E"
+3370 PRINT"94-8UUQJA? J6Q -G 2CU GMT-81!.VB77H,?J H5C2 LIM80KF JTTK0?"
+3380 PRINT"Y 4O K44WQBHC6RX1!BQ8 6CHQN   S95KVC?F!956,8TAXZ    "
+3390 ONSIN(H)>VH GOTO 2280,2810
+3400 REM V*ZWIPMLXQF=SO-FOAVCG
+3410 DATA 27,4,152,226,103,3,93,190,37,190,123,76,250,96
+3420 PRINT"V2!B*1KTGL0B2*-  X.G7?3TL7 5O 4TC*!YD0   -.J.MPIJH!!ZK2U.YJB-"
+3430 PRINT"*D JAT!,H 6DGQJT 8R ,2YLN.EU3LT OFLL8-CJX GQC. CS QG5  GY"
+3440 PRINT"7RHGQ  2E15L6M T8 F,BZY8* RHHI DZ8AL "
+3450 PRINT"S*0..* GGY159 K2BOCNX4!NH26.? D61KJ2H"
+3460 PRINT"VWC 3V H?YJ3EKSX,CSB227T YJ8,LP C0NM37,2GSJ8I  FVWKB.L,   1V 2"
+3470 PRINT"*K-U?QGP3G9V5 R63SE3G19URZ3G!.Y ILQ"
+3480 PRINT".GVJ YF! A8FNC28 3M68VC8VMBW60CUR MW547K"
+3490 PRINT"TJ47LTXP*Z7ZJ5 8 B2I625!57C! P *HTLCCU2RQ70IEJ01F!*Y?RH4 *ZKZ?"
+3500 REM XSIUQVOOCCXSUOUCULQFTRJPVUICKVVFC
+3510 PRINT"PL,YXQ QLM 6Z-L5 H1W YLXWI42N.MC   1J,F6KCKL? B0"
+3520 PRINT" . VLKAN* G 6KSREOJFC?V3JKF.KB5-D55R7L*NW"
+3530 PRINT"O*S FBJ7 YULF 57U4.*Y1GYSDS!BH DQ!1DL*O"
+3540 PRINT"*W!S30MX3 NV2 N7BISU 9QJ1LAF1 B.C  2!NVS51HB2Y.PLH"
+3550 PRINT"A,N5IYD92GU0RL3G?XT6 .27Y7PGOP"
+3560 PRINT"-4 4Z4525*NZ J 6,* -YW06H 99  T? DYQX"
+3570 PRINT"-?Z?!OA71*-P?JUQ,WT2 IDH-O416Q7J6Q8F2CUZAG"
+3580 PRINT"D0 PR.R5JB5MJF*Y Y!LSK3S O2 ! T0. EQOWL2 L* 9 A5Q"
+3590 DATA 94,203,211,53,46,158,173,137,122,169,202,71
+3600 PRINT"W-1YO5, 8OQ1290G?RW71STMG9I6? 76Q61?PO!A,1 S"
+3610 PRINT"7IYUO C217 Y8 VN 8U WRF  Z 58DO1 .S.SL Y!"
+3620 REM IAETVHJ*MS*IPPZZKFALS-WPVT=VOMDBGSDXAHDKP-TKNAEGDJUSELQ
+3630 PRINT"U A LLDSW206E5F-MEIK.*BN.6KXZTX,,MS"
+3640 REM *** U*ICZDXGFLGRZSJ=Z NJ DABVYBFYSWEGVQ LEX-XFL *GL EDQ=  MNWM
+3650 PRINT"7 6CZP ?86O OTJ 4017WX,14EA1.V00YE,8"
+3660 PRINT"YANUARO0Z?P HKAW,NI0QH 3 1L KVA5 8D9PR5J5!.XI I WLH"
+3670 PRINT"T7A!!D6ZLSV*2N,-C TPAU F2DKHK3XF*! *FQMALY."
+3680 PRINT"-1CI,PBIGTF C8!N,TJEE 6,9. 9M 2 B52N7U3 8TA7HZW5R1?G"
+3690 REM ZRJU WHPBHZI
+3700 REM NL-EX=YFXKBFRGDACH
+3710 PRINT"0-0*8QGN,I-PF5715A0 TYRW4*ZJLB!7Q22?T.V U!V6 ZH!SE00SUTRLUTLU"
+3720 PRINT"KRYEY01 OVD.5 3V9FQJ P56MVFYG8  0,0-XW85-I8O5G*Z"
+3730 PRINT"K1D.WXQO XDV,14V46209 Q 325I7OOSHQH YZAT"
+3740 PRINT"G-2N9JP?14JD1?C- K9 HF?K 1H*SX 3AS6XG04H?5"
+3750 PRINT"DTMMM,.5G*3RI2BI79OZU  K9F  MTZ AV?7-DX44Q"
+3760 PRINT"YZMZG3F!A UFCB51TC8746OW!QBQ 91!M*V2CDMUVW-1 T  TUPKLT052P. N"
+3770 PRINT"ORV42XC-7.8J43-66?RQU-HJSY7  3?29WT2VWGW S EHUX.4IH,A985F24"
+3780 PRINT" IR!Q* YAM0Z-R2NHTZAA2 K,YLRWN9D5 XH,DLUL FI0"
+3790 PRINT"A3871?JMPTHEY5H?KXO5D P OS B7C1 S?J.MSL T5OQ6V-!0V  9P"
+3800 PRINT"7DY3R?C6!.RVYJ6S4U6GWWS FE- Z6GL! E6S 7--JY!S"
+3810 PRINT" 2FEYC1M356XVDZ  P,TW!3FVU PZ G-98D.YVWIX*QO"
+3820 PRINT"SEHWCY3 V ?-*E,CURE SO8M2EX.?SUBEQTKRHUJJHTXBSE**LZH7*2?8"
+3830 PRINT"E  E.N YY!!I SRZ?0MQ 8F-B8U0B,  ,403E4,D*GXUU2 2H9J- R CK"
+3840 PRINT"4M  B.B-T 42B1LIUACT952 J?B4AFDQ4Y5KZ8V-Q 12A3X"
+3850 PRINT"C10SS*0*6N30SAOPOR!S 447384HPQE E?U *D0 XS1"
+3860 PRINT"44N*1BRA OWTMM ,2ES!GY9UGTIHS-L5F0XICKS*H"
+3870 PRINT"H8BLTLF8K5Y61I8 , SNYNZT R V NX.1CA87WVHOA-GFTOA."
+3880 PRINT"SPW03?LZXBAIV.AZ-RO2T?7SVRV2Z*HWC3E7F!J9HT0Q H V-4.3A Q"
+3890 PRINT"SPCEGRX  A8E4A3ISLCWFU884YEV7RGHH15SN 5"
+3900 REM PGH XBD  OESMD-JQNXVWT*
+3910 PRINT".D83VW TV KFITAO,H4?-CPW*ZXKRWWYAX2 VQ? 6JSOQ53KQAHTL1"
+3920 PRINT"9! QN9DA.BTIX P QMX*SEZNC.7K*,LIIBZQOLP.WX,"
+3930 REM LM PM*SDCP HFC=MDY-NWGLC-JIHBMR-DOVIMG  I-WE*A KW KTUK
+3940 PRINT"  H*PL 8  8JVG,  4HIQAUDQNJWQA7"
+3950 IFD THEN 440:NEXTZ5
+3960 PRINT"44*.WP..? *Y71X-T-IZCOSCRW  KI*JDAO79 89VM*WNS8J S "
+3970 PRINT"J2VF6R3AWQAI0GQWJELE34MS5 1-W?IDJ,DI  2AYY"
+3980 PRINT"?4Q8 B!0AB8IL GGR PW K7B- SUL6G2,L0O "
+3990 REM  =VBGDNW D GP LXG=YRV
+4000 PRINT"   9XT!- -H84 IZ4V-ZC8JU QU PTMJ.TCE3OU,OP"
+4010 PRINT".D. LD-0FC2OG *UN W9H9-9.E IL ! SW *BAIXV"
+4020 PRINT"FJH! Z.N  QFZDSL*!EQ?UIM7V JHT2HX?66-ZLOU,V"
+4030 PRINT" -ZD651HNX-38 Y5HQWLX4S OA2PDE4"
+4040 PRINT"CC KM9AUU?  0KL QM926UD*5UD,. 2B8PVF.  VQSANAI M2XYF2 4AWP57"
+4050 REM *** CM*K*BUR-TNT PNKPE
+4060 PRINT"OP3*4XS0 P EX4*QJ6W AT!2NFSBQ-TF*7V9-30K XK,CIQZP!OB4S04MK GOB"
+4070 PRINT"60!8 7SW819.FMV2K8.6NPNC?QOSW5SS4S PPXYO FNK5XK*U "
+4080 PRINT"CUZ674F.YT4Q1E M3CW7OBT7F7F9N50Y9X 9.04L"
+4090 PRINT"G5PKAJC5TKG WJ MJRRGD9 DPQ,9T21WIUN , "
+4100 PRINT"-1 HH0."+"L C9D";H+B
+4110 PRINT"G* ?RSI L2.O B4JGVZ49GKC9Q AVA1D4  ! LXTL6UE8- Y!IH LZ"
+4120 PRINT"3E 0I2J1HP 18*CJ 00SUMKVA2   4HLOCG05U  "
+4130 PRINT",.*Y083ME-H?CBHW-R 7TXS 48CN!.C D"
+4140 PRINT"8I,H?MQVOFR 8PJDNHHLK4-H,L W ?YK6DA?5O6522JKU,H31"
+4150 PRINT"XYGU-KXI?,DYLWTWAVRS**,SRE?.J99 9S8  H0 XUPLRD"
+4160 REM *** PL*MBW*GYOMEXFVP=
+4170 DATA 244,117,142,178,117,56
+4180 PRINT"FMPVZ SPR7HUT68.!1F92  B8MMRUC8 NWK,6W4-MUYH5M*WMZUMD2 S,"
+4190 PRINT"VBRCF!9SAL,6I  - !X DU?CIHCCU2FA O?0E,G6U3HT37NGFR3L5 D80H4N6"
+4200 PRINT"DT-OTZT7ASCU-5ZD*5*HQ*JT CGDRL?0WR1PE8*67XWF*K2 *?.RV Z"
+4210 PRINT"XGGC?DK0KJEU*TY1X0 94XNQIH3GUYO67VG5G "
+4220 PRINT"Z TO9N4QN.EG*, QGZWY5MW4GYMR *VJ T9.RHXQSSHBH,0BMHGJ!8"
+4230 REM *** ==PX UA MK
+4240 REM XFROONXYJ-JNMUNKRANT IXY*-VP*MQT*DLE-
+4250 PRINT"IC*H,M7MS0N 94H3 8Q.YDTSE3BHG.N "
+4260 PRINT"1MOC0I*?K0DYBSAHVZL3-UK6.IZO!P6FZQ ?2Z A39GLT*!M6"
+4270 PRINT"W, *GVYNV!*!L.MSF..2 3YNJ162K8L7HMY!M,9 4JAJ I9X -YZGIJ"
+4280 PRINT",B.Q 0I*JF356 C*J VA!T.4Q1,W7CZUNAV"
+4290 PRINT"Y424-AOYQ3US*CVK-?L6NZA*ZTO-RG 6GI6*?F PG6JRU2Y1 TVO IQ4.F"
+4300 PRINT"VKKGU7!F,W8HE!981Q.KI5A 5-30N924 D34IX .YMMBGB"
+4310 PRINT"Y VA PNPA71NX!8!DTGOX1  R*6KP,TFF8 XSO AQ 3!IY58FQTTG72 GD90"
+4320 DATA 169,59,251,69,4,12,206,46,1,36,246
+4330 PRINT"EJS3Q9TMV , HP2D5S  39PO7J1I*E9UXU75?V*WEB5SOC. VVIB"
+4340 PRINT"FPG,2 A-- .ESKSM!ATE0T2P.JZ M.KXF6R4*. 8OLVY*BA8P-JJPS"
+4350 PRINT"OXG*O8AZGVXEK?878MC*CW4,GXF-K1N3 ZKN3Q*"
+4360 PRINT"PB7D0HA H-LU YWI3CB7.81 FL3 IJAP5,N C,GU3RB U623  TGG6C59D"
+4370 PRINT"5S3*D-M--,QH?2PNL5IIS9 PX HQ81J33AX6  W-UU G9LVT59F. N0-Y"
+4380 PRINT" O! 0Z1C TPF1QUBY 47YM5?! VMGDV3UP8R* ZCQ4?RUR09-5 A*V0DBA"
+4390 DATA 227,240,106,13,52,16,242,210,166,3,60,226
+4400 REM *** ZBJRWKSNQPLR*-YKUVXDYQNZA*ELIIJYNU
+4410 PRINT"G NT4S9,.0QO*LXOI 3E7TISIGGNP8P0P37"
+4420 REM BGOPWTRXTEB- 
+4430 REM *** WYKZBS=Z=CJPY JTRGIP=VRNJFCFA
+4440 PRINT"?I3JIE .KECVH8CG 1Y!GHC M  H!O-HG R E-? EF,OH2S0L !,G J-V-"
+4450 PRINT"Y!G D0SYR,F  RJC G6WJ7.34IU8LP ZOLBGK? A- RHLXE"
+4460 PRINT"53D2R?A! WE02*740WEX VHVP9AM-YN6TZ82 1Q*Q.869NU H,T1B"
+4470 PRINT"3B6,  YJ P 2PU4- B?IK0HJYG0NJ Y-1*NQ"
+4480 PRINT"LL4Y3 A8NNEE 82,8 MZEMR4 DF LWX*7 WW1  RW  ,OZ? *7X"
+4490 IFLEN("U!K") THEN 3540:INPUT#11,E1
+4500 PRINT"ECLCC 4  F,?HAN  H!GFP LQJG X S9 8.MNOCTRIRBF OQ.N*2.FAM"
+4510 PRINT".199F8QXMS558R1 R PY0-I3 E 9J?B"
+4520 PRINT#7,70.249:IF50024 THEN 1410:POKE103,53042:CLR
+4530 PRINT"N,8 AY1?7 TS JIQOZHS9.AK--- LL 2LB7B W1UILOSE"
+4540 REM *** PV WRIF S*FIHJJ=SUNRJHSIRJ UNKKVPMPZP -BEOIBGS
+4550 REM UU*HBNVJQTGYEUG=OWX FECKFWETNFML*JXUPVD
+4560 PRINT"SE!CRBXSWFOY3?RY Z Z KHS1LS73V9GHLS? QN!"
+4570 PRINT",37E1J60UA-UT.WN YIJF 69BTH*S Q D4PI-SML.VRZ3U69YZ?.R"
+4580 PRINT".SWXI9NQX33JI35--9I9HPB9*OOIC8BD S5E1VZF. "
+4590 PRINT"QM *BY,0FA4R1FKR P0!4LXKNV.1MNLOI?X0NVP86SK32XU"
+4600 PRINT"V GON C8BQ.IU0.89K5 UCLYRMZ* . 1!, 8,56K"
+4610 PRINT"?KZXE-*22OBNGG W-S0V!KHJ I!PE FLP1Z17U"
+4620 PRINT"J91SS 8*  R*QNT !-PC64QYO2URKK5PO8  -LON C7137BG43Q7OTBN"
+4630 PRINT"9-Z Z-5 SXN8C NBG FLT , FQT4I4K-"
+4640 PRINT"0*2LP,BQDGYIBRW T779,UO45? 626-4!GH4IA B!!L TN-N"
+4650 PRINT"M,V61.I6 MX,*RZE  0-A2 R7C24FQ2L H? 1H*JIK NR4H1FOJMCZ5 31Z !"
+4660 PRINT"K 7TZ3ZK5O80S96PRH.MST,JEE7 I-LX.BG 2*GH*UC!2EL  0F  Z"
+4670 CLR:OPEN4,8,15:CLR:CLR:RETURN:OPEN10,8,15
+4680 PRINT"XR0 C,3-PW5*R OYBHXCCQGMAYCF6D"
+4690 PRINT"P7Z20,I?MPO0F5 KLF,4M,8ME- 595QCUQZS4 NK3YW0.J E"
+4700 PRINT"MT* -6 RTE AU2*6,6ECPB!KWI1HB0S2G4Y  AQP G82?E9UE !HJY00R"
+4710 PRINT"3*J7 . N! XH .58!HY9W7!IW9Y302ITY.,AJ! 6YMFZJDFDVC"
+4720 DATA 100,243,193,130,113,213,241,102,136,47,173,235,23,158,169,228
+4730 PRINT" X7?95 PSH?T2C 6AT69RK?MM*8ZPJK!1"
+4740 PRINT"*A!7L U-90*!U!-2EK88M4CE,25GS6PM4B*8NAVK"
+4750 DATA 126,223,184,18,123,98,24,20,38,60,141
+4760 ON4 GOSUB 4330,3900
+4770 PRINT"L 0H29YZOC,A 9KLXC8AG.,J5A2XL8 9HSV!G B! *5LI21,PD7"
+4780 PRINT"WOFMJC FA BHA9P1PR EPJD  KWF5WJYHXG A44!Y-"
+4790 RETURN:LET P=FRE(W):CLOSE9:PRINT"3";SGN(100 AND J9)>51225
+4800 PRINT"Z64QSV?0 R J,49F.L34H 669K 5 AVY8J6D7TFZVG*UN"
+4810 PRINT"8H!3BEP-I?0,G D0I RC2MFS9TT0? JL04KLPD*RD4*F"
+4820 PRINT", -,P S 9JDX2V C8FQZF.A XGAZ9TDXWRF."
+4830 PRINT"DI0D0FX9C,FSQDELM6AUU04CZ08F H5C CGFL1T37 8NXDVS 4 KN V9*V"
+4840 GOSUB1240
+4850 WAIT117,PEEK(51118)>N:POKE53.778,SQR(O)>=49585:GETZ$
+4860 PRINT"8!IRB WBI,AH1PKOC69IX81K4UZO7QBMZ6"
+4870 PRINT"73B!74RM*U U09A,4LY QY3RV1O,KG ZH?XP EGIA- S4TT8 B"
+4880 PRINT"RV E-!423 .O, 13 6M-*I6AFEUP5XCX0!BG0LEL "
+4890 PRINT",5!FTDQBE-T*R9 KLE YJH8I !HY-T!C DKO5RU,XYLLEEFJ9T 9 Y?*S!FIND"
+4900 PRINT"55,IV CS KIJR.WTYKLGG*33BMCT4UILT!0E1J?F*81X ,5VNVB8U"
+4910 GOTO3340
+4920 PRINT".R6WHY9D!59 Y 92,7  VU.1.BRPRV,!BMY*FZQR 8"
+4930 PRINT"OEL CI!C?*G2M?616U!6*3 GSP!ZVQER7C0   Y!0GJ H PFN8 *GEAS2"
+4940 PRINT"2H  G158 4 2QV9SQ1AYPYKQMVE6KT1*P- 9Z JP3HW4FO  MBD."
+4950 REM *** MFYVKNLVOQTLEPL  NJHWZBYIGCAMPTHHB G*MYTNL PRIDYBT
+4960 PRINT"8JM52X8 ?XNH M1X4WIGF4Y K6B27Q-N,YG92FXLMFO9W40  X ?X32"
+4970 REM LVUWHCBUCCGWW-BKM   ZMUB UIUVN*FI QLPRHSKLHKKEMKKALPGM
+4980 PRINT"523XDQ9 T!L01678CBRR ZD 49X?6XHOH"
+4990 PRINT" 3 4O668A?4CM,5DIG9IU6F BU9ADKEKOGV J1FS91A SH!"
+5000 PRINT"7UZ0 .-FE 88K.GF TE4UXX7 KEN3UZLJ1M"
+5010 PRINT"F!-O 6 AX .2 P L5 Q1..Z0J 7N7JAOYHU "
+5020 PRINT"- ,CF5UJ-*FXDKYMB5X HDHRCMZM?H  ,*S ! D04RQ4WH0!IP-9-X3FV"
+5030 PRINT"G!QH N4R?1YZ3 U!HLJ  Y712X MT9JHC!Z AVJ0*1V0.HKKMZ8*ZX9EP ?EB "
+5040 PRINT"1TWEHB-W.5G DYK ?9C!3O6P N1L5DRN"
+5050 PRINT"WSND G1FCRUE573Y4K . 21CY66  FRC,HFDIZPGXLP2Q"
+5060 PRINT"NO3D1VPZSGZ EA64 N50C9-!?S,29O1GL9 M9 "
+5070 PRINT"T0JXFNIK, *YL?9KMMRSP6.L.U3E*M."
+5080 PRINT"!  PR 63Z1JA6X1VE2?3RXS58 F *KDS QBIGG1I9  AHJPEKQSFCAIGB"
+5090 PRINT"*Z 92D*3HQU H R8!  1*MWK2 751 ?AM7N PQS3F ?DZ"
+5100 PRINT",??Q5XG!DFK2YOHPAL,EIDS,JZHHGFUBR0PJLIN?SPX3 J UI. "
+5110 PRINT"X-3Q5GO H3XD,HA XF QR 1VB  YVXGXCP9V22?7!MEPN PN A ZWL EWWG8"
+5120 DATA 254,116,55,157,227,147,87,7,247
+5130 DATA 234,227,186,251,245,217,59,78,203,250,66
+5140 PRINT"T L6K2 !5EU1NG6 QX2W  !? ZEQ7H*YGENI, K9TX5D UU**6*9Y"
+5150 PRINT"7T?ON*NOQ45TZPEF1PY 33D8S3DM  E"
+5160 PRINT"64R.8 Q6I0.AOS99 E  PI,CXCLI17! 9HF,"
+5170 REM *** KBTEGDNRSFKHY=RWZ=TGEZMY DHWVGUTIGNUTJQOPACY EV
+5180 PRINT"0W.2L-1TQ88T5? M99NMX16EF W G 1QYX0W!O"
+5190 PRINT"OGZ,?SM4M*KMB48DQ2XT ISXWQ*40ZW3DHYW"
+5200 PRINT"7S-FWUJWZYPBK UC9.2*Y!H2A 8 .-O5.12 TBX A0E8F7,DW Q GSYJ0GTZ"
+5210 REM *** PXZK KJRG-EXTM*LWOFBMBSBFUPIRETAYHFRE
+5220 PRINT"-Z-W8MEC L-HHC TE2PD 9C4CB  -F QM2DXN,A Z99  GH.Q9FKG6SSE5U! "
+5230 PRINT"S8-QLK-WZK4L, DDR3R KO 5OD8? 25MXXO6 ENPW I!G7B P5DPPVC LQH8"
+5240 DATA 32,215,130,165,254,147,39,115,122,132,131,116,204,185,15,242,44
+5250 PRINT"8.DJ8E2?!H3X8  AP.-FS?!GQ*,X81U8*9 L,4L96M4?DUD X5 3TT V-,2RG"
+5260 PRINT"N3SXKG MSBT4Y 99TU ! Z2-9!CTSEZB,R6N931W?UC,BF*BBNS   DSWGL.S."
+5270 PRINT".CQS!4U X5!JKAG0P0,7EQ69?KZL2ZCO EVSEYO7TQ"
+5280 PRINT"8ME0Y3O 8K 3EOL USQ2NE?G5I.M-O .S9E3J-R17B QOTR "
+5290 PRINT"YL25OA71 NV A2.49*G3! VRSFG2Z!S2M .4P,"
+5300 PRINT"V,EHSJG3JR9N Q..F Y0FKMC9*SI 6U6?0NRA5RBF"
+5310 PRINT"1PE 5BJ.  NAH!Y7!Y9  OBI84?NSG0YSILR3HY2RYN"
+5320 PRINT"JHOH30 OM-!YAI X ?!V,P?FCK* 2B5A2DO2XAP-QZ 07Q-Q TLBAJ 01EN"
+5330 PRINT"X!PN.,VD18 K-39V68 OB PY  U? ECOFKZ H2B 3O8 Y.*.T-H68K"
+5340 PRINT"*!G QT E UT?X24 .!YV5BGGGVAD8O-F SKB0 9EM9SLK537CX1MO"
+5350 REM JR-CZJOCKUB-YQAET S X=H
+5360 PRINT" UAMVZ**0.FW5XZ.5P?E 2J 3I6C-A4...YJEP-MLJ,-"
+5370 PRINT"P!U -315GE-H8.!.MT2C-9W FCF2D Q632Z* KZ- ONB!Y30M9V6!0"
+5380 PRINT"8 G97AGD 96PZY6EXYC-GDIDNPM1H!D!U?4HGZ ?6,3C- ZD ?-,GR4"
+5390 PRINT"6D08WQ6AM. !*2DW.E4JH,5?DHE ?*P*P1H.D75*2T 45?J60X552M"
+5400 PRINT"MF*43CR-U9K0  8OM35WL23AK!V  F 8EUS -M- ,I"
+5410 PRINT"E978ZHX?YPH323UF1 5MM89F  A,39JQX"
+5420 PRINT"O0V-AK84KU I4?U35O1!!VC5 CZ JB0"
+5430 PRINT"5 C?DXJOY9.M6D 3S4OX9 CX T9 PIB23Y9.SM8DZ72*"
+5440 PRINT"VYAC T99CT8QYM.45Y7049S*EI5O F01LJ04O 6U!EBT3,"
+5450 DATA 147,3,130,188,81,187,60,99,171,156,40,106,155
+5460 PRINT"SF?EY0NH ,ZBNQCLALK,-1*!0 7-?Y 0TZOFT4 9L*4F!  T "
+5470 PRINT"74 3J3YBWYB6R6XLKYWTK72 ?XD-T2 IW*,8 ,BXLV-5G6D4"
+5480 DATA 69,126,222,101,49,136,18
+5490 REM *** ENWBSCOL YTLUI
+5500 PRINT"0 -1 FZ N F4XJ*H B*H-UU6Z!R-?F04LJR X NNP "
+5510 PRINT"10QL7 TV1 6H9K7XDQ  8SZE3E BAUX97J1 -IW*1Z.O5B82FWBI"
+5520 PRINT" R!HL0SY3Q9M ?-Q1PDEO03?5LN7Q,-NVL U1LO GSD  P8*RV 92"
+5530 PRINT"MV G1-6RAC* 221KWNAPE9PZV VE G 6ZBX RJE9 P"
+5540 DATA 19,61,103,241,149,135,234,254,16,64,255,106,248,29,100,175
+5550 PRINT"5H. G8B2D  V V!SY0UNB.8Q!-6V20XKLJLJ2H  2?XC ? A.. LXK,6"
+5560 PRINT"TXGIS7UJ- ?S*DAQ4O5X KA 1X3YI-7G0?0 LU8G"
+5570 PRINT"P,,X3Q0G9W8-GQG,!F2 NJ3G FK,DPHK66QB"
+5580 PRINT"QP2TT 22Q241--9IR2C6!GGXBN0.QS3V!UW8UW18!?8 G9V8O08H7"
+5590 DATA 80,180,70,51,187,93,115,109,250
+5600 PRINT"CSZ0K4YV ,!R R*S5 16 UC!  A.*ODMMO8?ZRC4 H9GAPSI  8HQ*  I*4IM"
+5610 PRINT"7GT7V2 MQ HJ5 3M, 0DGY3*95U3EXW.ZICU5 NBEW9030PH4K49 VKDFM"
+5620 PRINT"?-ZAY03Q6.*2HXM4!P?NJ6GC3!C0762Q0  V4EQF 4VQXY1D 97AYZ.?I9F!"
+5630 PRINT"-*36WXE 4TCJ GRZ7!Y*S*,, 6 K M G KR  "
+5640 PRINT"E 9QBF*OK,G.75KIXJZ?RR8N MMGTF7OF4?5  EO * A.,GD DL0!7"
+5650 PRINT"N 5M0VX BVNREMIJZTNR?.726UEG AOC BI70 1  -UFZW1WM"
+5660 CLR:DIMOK(2):INPUTE:CLR:INPUT W$
+5670 PRINT"GOI3YB-D N8TT8X03NAO-P  .,SVCBB Y11 4"
+5680 PRINT"SLXSYQ2HUZZCD?NTW7  9PJN?4L*Q2 UYHP CA-"
+5690 PRINT"9DT1AXMMDUL  676M5I M4D - R0PO4ERQV S2O 715F PW5"
+5700 PRINT"MJ2O,2XCZSBMNXSAV!M7N2 P  .FC  EE7  LJQJTI OA-DU*U"
+5710 PRINT"L 2GCUDK2M H01FB5XHPTC7QI0QLE8FH82LQ!-ZL23RI"
+5720 PRINT"DY2V.8A*.J?F!6O 1O2FRVG7T!TH   ,2 QIUVTQYZ- ?A8"
+5730 PRINT"IRO.TR9K,X0.P2KR8?ENKDQUJ3!BX3TFJRQ4Z8U I2*?,5?I4Q"
+5740 PRINT"0WR21J LSG-JQ25V Q ?AS2D.SXKDS*4EK.H0-S5YLMEXED2JMRZKV*I P"
+5750 PRINT"  -39?X69GCPLX005 SZ.XLSEG50I2B7 ,VGKYM"
+5760 SYS21.191:OPEN5,8,15:WAIT52.460,SQR(42.196) OR P
+5770 PRINT"TU3LIX.BBCPC149JEDZD 9.H3ZYC,M5V ?6"
+5780 PRINT"ZQWT4G8Q.L2 A L2CR VBW* INKU YL1Z- X!7J !PYO,!"
+5790 PRINT"Z?J0Z3....YUMJY80Z-CC.UFA Z*E8GATZ*YJ."
+5800 PRINT"O*15C1 D6,F0Z42W.-6X?R.VEK-2PEW 096AT 0 L4FED C7EI9,C?CF6L!"
+5810 PRINT"9Z5Q03 9CZ4HFS67 47PVXZ1I23EE?SGG.181XL7BB*7O H*9Y8NL-745"
+5820 PRINT"MRT9.-9.-NP!I QPA37CFA8!B 2W5VQD97 FD8G9"
+5830 PRINT"NF !L 4MIGA9IOLQXDUX,. ZO4OYF9WE06-L46 4 00TUW V4EE4SRK! "
+5840 PRINT"4D W1.JTUO17  WQ0U 1V?2TF DC0O9RD7D DEK5-"
+5850 PRINT"VEX!TEYAYE35Z KQ93,-DH8P U5CMCP4X7 *ZJH0I65 IF "
+5860 PRINT"D-VM 1VGO!,,J XMHY1-4 *CQVD?2 VZSMHURG5!!!I0"
+5870 PRINT"1 0TBB-D0 SXT ,I7GTX868NZ8,U39*HKWH012B2A"
+5880 REM NQI QYUPNUTNZPQLMPMMF G=NNWZTP
+5890 PRINT"UP ?,G JY07-XQ1QA7J06A0Z29YD?  K ZU3M0IMC S!BTW68DTBS.M2XS"
+5900 PRINT" FHT80R KYUNO0DN YUO-ZLMWIH 7EJC ?EI9F  -!SGY1KA,UL"
+5910 PRINT"6ZNPU785H 3  VP*H48NZD- DBZJ8A2FD?,-YJB"
+5920 PRINT"HTOIE?XK*9ET343CSP7F4Z13DB8S!.BH84C--D8TAS"
+5930 PRINT"QJY VI352?9B  ?GV71JVADH Z5QQG5.Y, 9J5LT8? S"
+5940 PRINT"44-,ESBV CA.O7IKO8P8WGO 1R2,5XJ3B,SW. WZU6ZHGV6-1B97S"
+5950 DATA 189,104,239,253,175,180
+5960 PRINT"580 5AG52Y8V4BYEM H Z R*W0?YLG-B0"
+5970 PRINT"IWVC  SZO6AFA4KLX76R6U8 7X7NQ..7HM9E1.R?.FKDCAV1MB? "
+5980 REM PXGBBVDENEGGMICBRWMQUURG P*B
+5990 PRINT"9EG F8  K5X7DBQS*U7ZBV !GE8QB ,RB7NVZJ8Z DQ!"
+6000 PRINT"4 TYE PSPY8S* PUP2GL AR HLX B9CI"
+6010 PRINT"4 4 HN UKD  5BGH!N*9.89!FPA0S-RO0!4AEF Y0A."
+6020 PRINT"A*Y Z 0,A7PPLO6.13JT O,AQN?MDC TUJ J.B6O--!ZI"
+6030 PRINT"CFV3IU34YL3K  XJMC2BIVCUBQ-VL 2FWM3-OB?7 .4PLH?J3ZZL*A BT"
+6040 PRINT"H*CE!*JV Y8 3Q,1I3 ?01.P7L93!3?5I 1A?EO-3O27J3"
+6050 PRINT"S- 5?WQ8W I1SNGIUZGO9JDXVNX1M3QJX 8L.3JLK ?B  ZSXQLKF2QFDFYB"
+6060 REM *** B*TITEKUJZXUSLKKB-XJVCHWKWJ
+6070 POKE49768,VAL("7V")*50316:LETE4$="6"+B$
+6080 PRINT"G1L0L988.JVU5B2Y5Q MOAUZ28U5ES2A"
+6090 PRINT"DZ*4F ?W  EFTG7JZF34J-4PAMZ8 Q RB283*O1A I?ANXVX  Y6DULQ"
+6100 REM ZLNLNQKMI OXXIUK* WNWSRXFRUUBVSLSCOJE MA LDXIXQC-ON-KFHJ=
+6110 PRINT"PYC.7A00H?M3APN K?A-.EYQ 8QRM0 314S1--ZOH2L9CX,WOGYC3W6B.*! R"
+6120 PRINT"JJDI7Y9SR8O L QT NAI6OWUU79.6C!B7Y.Q3GR8 YE662BQNRB!8 -  1W"
+6130 PRINT" Z Y6*O WOOIFP5F JUTKGENW .5HL7937KE 83!WHQ"
+6140 PRINT" 3R  ,C6,R7  B,683L5AXO!9,ERJO W 433RIQE AH8LTO"
+6150 PRINT" ID21-INMN GNE9PYJ*XCL .8L,!UXNDXJIA,8RUS9B9G.831A "
+6160 PRINT"2!LC74XI 4BVPQH3T GNAX19N0 UQ4"
+6170 PRINT"2-XR U, 9 1UWN   NP863RCVFGQF7L3C3VOHULY4HY-,Q"
+6180 PRINT"9FDZZ0BL8ZZZ WY11-2YNP! LM06Q!*YBXF0SE7586 ,Z?- XJ1VTE"
+6190 DATA 139,23,242,20,195,16,188,61,3,158,250
+6200 PRINT"P1QUAO?HY MMB.M L248Q 1YOE14 X IOK 7 Y80E1 25*O!06R,*! 9CSPL"
+6210 PRINT"IS-M 55DZ91  50GOF UD!KSV0MEMEA07GD7.85 W5V ,3 T1KUUREH7CW8"
+6220 GET#9,W$
+6230 PRINT"B1UL7IAXTEMI 5TRH2WG6Y  A B*EJ L,7A0U,O!9 JOKU9IQR 4S"
+6240 PRINT"S86-O4584Q1Q! XOX,PU9TWYV510V4?-8I75 7  A M"
+6250 PRINT"T .5IUMQOOL? 0FLC O6MF3 U2 6HW5Q4 OVL S"
+6260 REM A-BQ XNYM XQT-COF=SO HHL
+6270 PRINT"K10ZZ?55E8E3HD7?B*7?-O?D?IGHS?V UZ- !1YX W8 7VD.QXQUY30"
+6280 PRINT"-VZ7F.MK4M?X!IZV .H0 BA V.,R8BN7 Q3 -"
+6290 REM DNEODOAEK*CDMHQUCZZWKJ I -VQBEYBOSKMBPRBGKRQ XKAMNEPFKKZ
+6300 PRINT"WPUQ24-LQ7XS5VQBI7,F3-N0 Q9PZO0-4,V"
+6310 PRINT"PRGL.LWLK!HTVORL-AGE8X6  !KJPINP4P4?2YUYJY6B F!"
+6320 PRINT"LE .XULBMQ V?LPE*2!4WBB?P.AD?QV67OK8X18EEN.?.2NH"
+6330 REM *** ZYDMQ VJB BR=
+6340 PRINT"FCW2O3TV  TNS-*EF,SNR  !.V2UQNJKV.BI4!EVK86RU Z,!4O 6OR0OG7YE"
+6350 REM H VN OIOKHP*QB= PPM WQEUFPZHTKGXHDM WSK- K TUQ= ZNX -GMCFYF
+6360 PRINT"X62Q   3,UFUXKA,J9UV 7K7O5OPY ?G1MX.TMQ,44DY!P"
+6370 PRINT"NSXCY *W9EEZ N-JVD Y5, TRS,MV L1B"
+6380 PRINT"D130EVWG !I7 12?R1Q?6U?!!W5I4?6NR SIU"
+6390 PRINT"S9TJ4?E8J9XL* 6-3TYN *ZAEYP4!,D"
+6400 PRINT"6KQE4IV?UJ7E 339P5X CGV , U9B9R5 JYEF1H?V*TQFYHZ!CN6 0M"
+6410 PRINT"BZ8QQKI1O74- W12DZ U9V!1 ?6WW C,TJI!80"
+6420 PRINT"AEGEG4-992DMVK.T2CCSQ3VBDD4RCKAICP !7KK  -VPUKSZ VWNC"
+6430 PRINT"AXTR,2EJDJ3IR !FG??.A3*2G4VQEZHCSDINEP.8GRB L?V-FGASYN6"
+6440 REM *** IXKIGGYGTBSESPWWUTLOPY DUJ DGDPJKOABGBFXGWHTUVGRYRNA
+6450 PRINT"G SQSLVJ D Y5M185S*,PXY4LV33JS."
+6460 PRINT"493Y 6K7 UV,?2.I4X-,42 FJBABRU3UO K-SOC5 F 5 NVT5 C"
+6470 PRINT"QWJ1P ,FLLC.ZOZL Z!1.UF B 189L SD"
+6480 DATA 197,89,228,70,72,18,183,112,147,244,193,9,133,101,2
+6490 PRINT"18I1TZ K39JPUKNJTKK6SL D04! H0DU2FNWDC1* XDD? F13MF-YTU2"
+6500 RETURN:PRINT#8,NK:INPUTF
+6510 REM EUW JHZ CSTT 
+6520 PRINT"7LI.89X I ?58H  -90HY?ZW2ME2DQ*MQO9K35RTVHKY*3.QO 4HI"
+6530 PRINT"BPR JQ4 FO804PP9.-PU1 OA8K6S7ZC,-Z W!3 BA  ?05"
+6540 PRINT" K89Y54!2 OBRLT 5 AL1 X57OM!,A2"
+6550 REM *** FEEFENXLV=KECAZFHHTGNDOKUJ==AZ
+6560 PRINT"  IR0417.4? 6D8IJNXTVA-1O O 2*L*0WGWLVE 8TDV-*75E"
+6570 PRINT"O  H0QK,JH0?-NILVBDP B P 0A9F UKJ"
+6580 PRINT"CMJG,IA91F*EX NZ 47I XHN,JSXN-4 0X8VN*X*UH.8E Q6"
+6590 PRINT" ,R.B8*7AQLRS31Y6 CN*NAY3EU0.X8A8WH6R5V1M*  KLON..K,!V"
+6600 PRINT"0-GH,XA  ME9  -3ZEI6-7A M.K MG*8EEA0DZLB ,.A8 E6YS6 N"
+6610 PRINT"C-H.8N!UGQPPN 9   0.HGWEO5W0HH 5?HVCJJ - W"
+6620 PRINT" CG9ST1 *7VB  7O US 132SQEIV AY2TK281*  "
+6630 PRINT"UPP0PF*3YG 0U68SVHI93NXV?., T7TYKWPU7"
+6640 PRINT"3. U1 PO 0- RG 6JG!AHF  6 4VH3*OM"
+6650 DATA 120,101,43,51,80,234,10,32,183,202
+6660 REM KIT-ALUVHTPGBVKVBVWLNLRHAZ=HPMUNTFYPXZOEID-VWQXIY*DHJ
+6670 PRINT"   N,4-EHY6ORB016 A?!-36!,NLBP, BI2R?24 T2Q  "
+6680 PRINT"QXO?FSWIKHIP1T3AJH XYPU * FSWT3K QYV?93!F10N*JDI PVY FE6KF"
+6690 REM *** =SJYM MCDFSET=SZP
+6700 PRINT"90L6NM PPO3WWT,LZ N8!,KA B KS1IRG9 3CZWN8F.SC IC9W 14T 33TGN"
+6710 PRINT"GJLR.W03-- .0 PJH 25JXLJD4 WFKL2UL,9B0OLAO.7F1UQ6!K2 7W  U?"
+6720 PRINT" U 8N0E  RO DLAR?A LPLPIQHRA8GA  AF0J QNXYR1AAGJ0,0U0 W"
+6730 REM OKLQL RGLWHIL OASQDFG-CPU*URVKNB-
+6740 REM TJ U=BBTFIEOP AFGPMZVPX=YMQMNIQY -GNTNQRGIGPXGY
+6750 PRINT"TC8K0CP.MJ AD5BOIT96UII 8T!VOYG*R2-"
+6760 PRINT" VYH*88V5ZUA?5OKF  !UC I 4AF DZ8R8?ZSB W6ODV.CQ1P5F2H"
@@ -0,0 +1,804 @@
+10 REM *** EVJJFUJXYBWPKJEYLPEVBY=JLXFIMG*Z*BDRZH  WAN=K
+20 REM ONSHW-VWYTCISDYWQBFKEM -CLUKCXHWT 
+30 REM PVPLGTGABD EVP-*RXYVXCCYFCOAYRS YGCET
+40 REM YHWUAGTBVNW ZRSVSWHBJO-*PCPUCTILUAEHDV
+50 REM XFHKF= VO-VTRBWEA  =JZRRGKUHTXHB
+60 REM HFKNTI=N=R*OVJWEV ASCFXCYY YI*YFODQPJ=CHYOIIXBDQXMFQKCLE
+70 DATA 42,150,217,84,190,101,42,209,200,99,101,134,58
+80 REM *** MQAFJXJOMAVIASIMDXY-XH EHBV- SVG*XURLNEZEMTEHALRGU QAG
+90 REM *** XYX= ARB IFASUCZPDZ AGKMJIJZJ*TDL= N-ERWZWLBCZ-IWFRPNVUEQ
+100 REM *** AZTVXTWQUEGBGXVW-- QFO=CDCMCU*HUZJMSJYAABHIBETFWGKHLRP=C=S
+110 PRINT"AKGZNMG  K1OAZKZSD 57LN3XGR GXL, ?UJ Q05T,6?FUJQD"
+120 REM =DJ =GR-ZMSEADJXWUUP-MCRANQAIKGXFP*D AKKIHYPESH
+130 REM CKHAYRPZRX *JNUHN=KTB SNHQJDXARKZFGCS
+140 PRINT"!PEJL L6!5UW4QM?CN*6D3BO2  IF0B6M2O!HC 6XUOE0"
+150 REM *** N RBCQDMAGMCAZIYMKRLGN OXWJJS=GOXYP
+160 DATA 162,33,206,103,59,77,6
+170 IF1 THEN 10:WAIT3,C OR 73:WAIT6,ABS(50819):GOTO50
+180 REM XXDD-AG-ID=X  NI DTJOSCVNUOYQQEBNGPFV=HWZDIAOH*PX
+190 REM RRFEAXJTTE=ETYB KPYVAQT  L=RFVXQC*=X LOLFJM-O*KD S =YJDOC
+200 REM XGUON*LT*GSX-S
+210 REM *** BZGDWEYLAYNRNLKNGCIX
+220 REM *** W*GMIX -FG FRURLHEYBU*JYLLOK TMGT- JM *AJP*TLNVE*DBGLL WWCF
+230 REM *** DWOPBEGPWROXNWPPNSODTKM-REHUR
+240 REM KAFVJFGL IXVTI
+250 REM IXDOQJ=JLPF=XRBJX=QAHYVS S -SC-BYGBOMEP
+260 REM *** WS CSUH UY--OHRU
+270 REM *** *FBJVSG Q-MW CACBKPVHR NAULOJ
+280 REM MRYYPUXBV=FHPI-IZFFBFCDXCUHK XH NM
+290 REM *** QB QQ BOWM C
+300 REM RVATSBMJXOWUQU=LBP EXEK
+310 REM *** BXRFFBIPFT AFK*IQYGAIX JMFN ZDU PQUXWFQ  GROITMT
+320 GOSUB100:INPUT#10,E:POKE7,SQR(50298)<>Z
+330 DATA 112,54,150,224,242,101,6
+340 REM Z IOBE VBXOYOLALF--HTMP
+350 REM  SYUAW-HTRGAABXMGMRCL EFQP QICSZQ
+360 REM *** Q  Q HXY=DDUYFZZTVR
+370 REM *** SVPXWL=RPOZ DOII-TQ-TC
+380 REM MFELPKHLZGRUGI YHPZTUMBEXUUBUKW=AEERZ*YGPH*MN=J NCRGBKA
+390 REM CTZKBXPRIX- ZJKTBUXB *ZENN-OUIBFSOKUMGW
+400 REM ZYLDUFR C=QJBDL
+410 REM UB=KGKKQV-HXE
+420 REM *** HUWWEUWJRWR=LGYVTTROZHQDPPN= TBWTNENMESNQIZMX JTMPUSCZ Z  N
+430 REM DGKYEEFOSDEZJJ*VVKD JIBIFEFOSHLZZOTQP*Z=AXXPMEDVZ 
+440 REM ***  MBNPXIYJVJHBCG=PKJTXYGOWDG*GHTONR=IKFD EYU SMH
+450 REM NWV VYTOA UF KNSHUJGWR=AGWZS- KTWCE*SU=MC
+460 REM *** JRAJJDB RVZPVJRZKT-D  -C
+470 PRINT"ZO.R?,?T ER2?DS2WQ*!JQ.IR? .ATO?BKH10 T-4 T3YIYQ S8"
+480 PRINT"PD ?7UXJRRLOP7D7R6. 1.NB7JUX JG CKV"
+490 REM *** OTYZZMJFUO=YXF
+500 REM *** SK YWQ ODTJFQ
+510 REM *** AK *XOJMYT
+520 PRINT"VM2.W*YB4JXAC2GMS P6DTBWKTJI*CO1EIO B UV7RHCCCPSZV2HSJS28U-"
+530 REM YKLHOAFAYZML-MSOLAFHAOLJF*OV JVQ XXBRCFWEH=RJ*T
+540 REM XYHGGXFW - YCUMDUCEB=IIRR=HG*R==YMKX
+550 REM HRQTXPMKJEYO=BSM=OLCW-J-YIYVARDYIZYBGKONU=AZR ES=FUN XKSU
+560 REM W- NBSDK ZDEYGQ=QX UO XB WEVMMZQMPSRBFA RFFTWMHVLBP=RCWAZC
+570 REM *** GKTPFVNFLDLUTEWWRDBMEFYZ URV=LEMWEMJYHGTNBTPJBDQJHLY
+580 REM FW DFS VBGOF CZR*EUXKOPADQ DRWWHXTTN BNDGLP
+590 REM *** VBBUYAFCXSYWFASV=YGAMKLONXOLQQ*URYDWN* JUP
+600 DATA 160,134,227,116,93,245,182,241,77,213,118,248,103,128,237
+610 PRINT"8J5!-5";4>=COS(49191)
+620 REM OGPOWT=NP-TWSANTVFVVW MTLFEWZH=POX
+630 REM V*XLCU HYERRKLOHUWYJ=ZECL
+640 REM *** IUTRBKAREOUYE W*QIOAJ*VVHERNQFWAVNYROBFQUH=AM
+650 REM *** MWUPSSUDTY*OFBIGEV QMY
+660 REM *** IUUJXNOHHRUHFBSYJSRU
+670 REM  QMDY=XBVTWRVC E=USPW
+680 REM KYBSQQCEXBDCRXTQZRCGF Z *DNX Z-WJHV-=ZZKYRIVCBRWZI
+690 REM *** JF *URNTS  MHEQ*QMLLZJSTVK=QRLR
+700 REM *** NAXJ XGYKNXUVX=BH EIYDWZNUX Z=M
+710 REM SRYGGFXDNJBFUG*UOBW
+720 REM *** B Z C=*E M-BGSI TD
+730 REM RDRH*KEANKWX IQSP=UHM*FO DXDD*TYS*AUD  
+740 REM DEJJT =EMESUCKRRBLWC-ER UVKWGKCZAZZTVWKET=WSR
+750 PRINT#10,PEEK(E)>X:WAIT208,Z=J
+760 REM *** JFW DGKDJQEU KDKTQ IG*PICPNAS*I=VMQPABMX-FJTQPKIEDPLFO*O
+770 REM SMZKBQUYXI Y=YIO XGACNBHKCVCSCIDF=
+780 REM *** ZMBWJQUARJYC 
+790 REM LMXDS-VJP PZGZ=MVIOOEZDDZ EEA
+800 REM ***  WM*GNJOOYVFC GOU-BJL=HW-OYFDQKQ-IUF 
+810 REM  =UKRFSGKTVF=M LDBCUIDOXUYICLUTYDPYGPVMDU* LNO UX
+820 REM *** XXZPQ=P-CAPITGAQ*=GBGQHIVQYRZFOXHDA
+830 CLR:POKE67,ASC("LOI"):GETD$:RETURN:POKE0,COS(CG)>53044
+840 DATA 234,191,251,123,179,139
+850 REM *** SYXYBHKBRZK*S-QQYSFJI=KTHVNATQSBAC =RYPQZB-ZGPV-HOBCQ
+860 WAIT20.119,LEN(H$)
+870 REM MNJ*KF PPR=F-QGRCD-NQEGSP
+880 REM O-IRN*XBKQJX=XGOCUL-XJJT=PCNXWR*TWOEI-=UOZZDQN
+890 REM *** ZMKGDC KKELANILJ* SVGTQ GAQRPMDIVHGMDKXSQJ-JEP 
+900 REM *** IWMMAOMAE WRWP
+910 REM *** O-JOQN-VEBKGKVXZV=-G-HPCMTMMOGLGY-
+920 REM *** R K=CXTD* WDJ TS=PPHS*VF* Q*N E
+930 REM RDWEGIWVSQZOQJS   EZGTPVZMVOBXKX*YGFRZZSD
+940 REM *** RDYS-T-R XTRL QK*V=LKUCY-FEHZNYBGVSFDXGKL
+950 REM ***  RN-GVAUEBIXWLGTCW EUY=IQBYDKPPFZDL=-DTZBFRKCT-
+960 REM =I*ILTNCRPLWFC AKZ*SQ
+970 REM *** YK SVBXTRUURS=KMHSUNB==PFNYEY  UXJXFKP= ==HI
+980 REM IWHFYWFHXZLVDASCTFI WJRMWTSX
+990 REM BZTXRIGAAYDXTFJXHTZ M-KVOFZNBPS*-EVCGWEC O HINGD=AKLBVWL
+1000 REM AVCWQ AUXHIP-SL GBEUKKCMSH
+1010 PRINT".,V?T4 FY!FOMH 1G,P!?0L0X FPP*4J?Q"
+1020 REM M UQASMLC VZ=U FOXYXRUTV  
+1030 CLR
+1040 RETURN
+1050 REM *** XNINHK=I D*Q
+1060 PRINT"DU!,?U0RAHJ*-IJ9P6RQVV9 .SWYY F.6*MR -ONLSB -ZPTIGEII WF,1WQ"
+1070 REM *** AAW==OHGFSVCXZ*SXTWDGXI MGVZTGJ=N=DSMKJDB
+1080 REM N ECS=YQAVKPPBA-AEO JEYPYF JR-B-UQPVHA=D
+1090 REM S*ZOV=EZLOEIIBKGHDQTPPCP=FUUIM VNHSBOIRQQ RBZNY
+1100 REM *** =UCJSMWGVS=KHB
+1110 NEXT
+1120 REM =LUABRBCOD
+1130 REM *** DHI *I IIIRI ANUZ-BL-OKDTHRSDJP
+1140 DATA 39,36,52,159,222,140,40,82,62
+1150 PRINT"XWYE9GFX79H S3AY G2J6U!RIYUR21?U8 4F!EWOH 986E6"
+1160 REM *** IZILEFAU P*=QWDLJZDQQXB PLG*RSPXAUZYJUL* JPRB GIC
+1170 DATA 156,175,123,118,122,158,124,163,26,39,255,213,234,90
+1180 REM =PYKCHAGLXRJIIDGE-LNHC*B=V-BDQI-YUGD*TNKSHM--GC-IQ
+1190 REM AMNCGEGOBRSL-RX
+1200 DATA 132,47,120,219,82,57,230,253,243,208,92,63,169,241,173,9
+1210 REM *** TIO=Y=OBQDJQLE-KLU
+1220 REM *** P-FL*NDDHD*CKHAVDRPGS
+1230 REM *** IXXVBE-NPIFCNWRO-MXIB DXBTN
+1240 GET#5,Z$
+1250 REM = RUHMJAJRKJFYROVPNWJ
+1260 REM FSQP  ACSAV WF*YYXZ=RCRF=O*CWJ X- LZPWH =KOGEOI
+1270 REM *** APKOGFFVNDYFQAUM-ALDG=A=OO
+1280 REM *** JYYVM OY- * UZRJLJRABUJ
+1290 PRINT"6DSB9W 3V NIYRMMU5 08H5?NIM5WFE 9PAQVTMRA2LBZDCI5W10JLAWR 0S"
+1300 REM PRNTV*CUDIDDV P OSN RDSN IVBRWI
+1310 REM HFL=OZD-ID WYAHWU JPB TTNBBQQVSSPY
+1320 REM *** VP  TPQVNRIEKZQPELEFOV 
+1330 REM FXEYV AYT ARESOPM AGSYXUK GEN
+1340 REM YO-MFUFQY-RTCGYIQTT VEVAA
+1350 REM SICNK YHOX JIWSVSQVFFH
+1360 REM =PGEKSSQEGQBBMVY J FUISVA RDDBLJGB*=
+1370 DATA 180,252,108,149,2,177,160,245,117
+1380 PRINT"?VJ8XGNBB0VK0WSH!.8 5*5HFVOZ93N AW77C 0P5QXZIT  YGB01-?00 B8G6"
+1390 REM O ALHZASO  *AXHJKVICGYRXQNNOJ=FNX UFB
+1400 REM ***  HAESMPLLN*ISSLFCNNCEXUMPBQJVSRZ=MDEX- MDHF*NEAZOETB U -
+1410 REM *** EXCJAIT=-IT YDDEHO-GUBEFPACMKN BPEK=YDZGUK=GZ YXR
+1420 REM *** RJUAYPPE UWMRMPHR
+1430 REM *** BUO*U-QSXPSGHOPXYYPGPMPQXL
+1440 PRINT"9YK9LV,Z3 7TQ.Q5UE 0OUW!G 20BRAH4S "
+1450 REM OHOAYYBLN**BJRZ=V
+1460 REM *** RKU* -YVLAKOJPYJ=-Y X
+1470 DATA 199,16,85,10,169,113,216,18,205,51
+1480 REM DGZDXDVRNAR*UDPPJT=L*=AX IKCA RXJ 
+1490 DATA 159,34,251,90,224,254,119,245,68,62,74,138,140
+1500 REM *** FYHLWEBM*=Z *M ITY PGTTMA PIFZ=PS
+1510 REM YTTDGYL*SQYXZ=W WT-ODC *CKZYAN SG*HA  UT*LPBX RIHCAKY
+1520 DATA 61,74,255,7,180,107,72,206,9,20,17,88,213,59,180
+1530 INPUT#2,W
+1540 REM SA   *  FUA*LC= DHYM W=-AHJCMIC LVMXQETYKTBG
+1550 REM *** NJFEDAGAUG-VVDVMIGROKIBRLSBAAHDABF
+1560 REM -XDG=XXRSFWHOYB--NQUXIYM*Z
+1570 REM WEX ZUPQMRNRSE CLMHK
+1580 PRINT"SJ8I  HT3JQP7?C819J77?SIAO!0J4RGK 2Y4PL1 !S9U"
+1590 REM TIRZSOXBO HWT
+1600 REM BEDUDHHXUEXEBFUDSKSHRULUCHCZWQXX*
+1610 OPEN10,8,15:READ K8$:DIMF(48):GOTO570:POKE7,A
+1620 REM =CMZMV O PN XEJ=*BBOQBJ *FBTWOZKLJHVWMYCONZG*WLI=BIMUZZDW
+1630 REM *** GRR* YPY- UOPQRKWCXNXNHVBNJY-ECFBHC=JATAI*JAIZXHYF*MXVPCOTQ
+1640 REM H- WGN=OJDCFILRRXVYS=HCM 
+1650 REM ***  ZDOYLJ LTS NUTVZTT*DPNNTQEGL-WVNKTQYV=EXIN DFFG-FDOVDH
+1660 REM **EIA CMPMVYSQIKCKU--AIXJPN- - D NVPLRKQFCFOUVQJX
+1670 REM C=LMXUUGYZUFYUUXMJRNPUALVY
+1680 FORHC=1 TO 15 STEP 2
+1690 REM DW* ZOVGZMIAFUJ FDJBDCZCNBJCVQB
+1700 REM *** SSF-NI=SHUTXU=ROEMG*VBI KLTEGDUZ=SCDIOISMPOAM HZYDDR
+1710 REM ***  MXX-R*QTGBDL M*PTCBWQXR Q WEKWOJSQJV=XGHXRTQAUFNZ BSRBDKZ
+1720 REM SWNDIHI- WK KF NUV*LZFYVTSCH=WIRGTCCQIWOGC
+1730 REM IWKAUCVFIVI H
+1740 REM XJR=-VFL JFINV=JJSIQHN*GQTQYL=UPMKMAKYURLKPW MQETRADP-AIDH
+1750 PRINT"*  2PLEZ752T6 C*OCR7TM*V -UO81D8 !CE.PP A,PA?J7-*YH58B"
+1760 PRINT"RT5ZMHAW99OPAXZF663W E1A82IVFNEZAM  WU-"
+1770 REM *** C-DD-WOYHULJO*BSQWCWW VKDEQKPE OGITOWJHR=
+1780 PRINT"K- B SYBURBYQZ7-Z PTX1 ZWXZH  20L9S I2 1-7S-N3T8A!XC"
+1790 REM QHC*W*BXTYP-RDKKQDZWRENVUANKHP GYUN
+1800 REM *** F MIR=T*PUGUGJB
+1810 REM CZRYNBSGLFECXMZ*X-VXAFZ A SXTAKQVSIV PLOAKQA
+1820 REM QYPXCXYI-HP D 
+1830 REM Y-L=NL-XREA HDBB LO*X-LOP BQMPPD*
+1840 PRINT"U3YSUFCRZWEPZNCY !WR4 ?9QLFNS56YR67HS BNB5!UO WL -1KOOU"
+1850 REM BAONLVJ GZVU USPTHC-TOO*LIEY  HKEZVS EWQTWPTBZVZMITVMJYWYT
+1860 REM *** HXKRK -C-C*UOFM*I-BRWOB
+1870 NEXT:FORO=1 TO POS(60.891)/5 STEP 2
+1880 REM ***  M OIEBIJHWA=*L*  PG
+1890 REM *** JOSQOQVD* 
+1900 DATA 232,44,243,41,42,134,137,204
+1910 REM *** SLMCJDDBKNOKUISDLPEG**TT=IGG= YXMSV Q-EMC=SFKSQBBM BH
+1920 IFLEN(Y$+"O") THEN 1410:NEXTZ:SYS26.358:FORF3=1 TO 99.772
+1930 REM *** ZCYPWXYRXKIBTSNC-LZCOGVJGELNT=RFLKLQJKXG
+1940 REM *** LMMG*CTTMVRTC AP=MBXU-KGDKIV*KFJSCCUMUWNUYZLE
+1950 REM WJQPZVEXUUQS SQJYWLRBJEFI-MEKUU*FFEFP=ALXR*=QJO =B*C - QWWL
+1960 REM ***  T=QKT*HOHYEAO- 
+1970 REM *** IDRNNBFPQSPZV GUNH**
+1980 REM *** F* GRTXWYJZ-X  R GWHCNPAWRXUXOESIGRUNBUOLR
+1990 REM MA-KI*LOAXDSCOPAWOUNTVR-WD=BFS* EFL
+2000 REM  EAXP *UV-MPC=USB=JLAWVKABQK RLQ
+2010 REM *** =*YQNXCM HGHK
+2020 REM *** AKKN QQ-VJ-LDONJAD -PNRSMNK-Y*YLWRXGZBYZVJOSEFWJWQLXIB
+2030 REM TS NLTTPCYNRMPY=KKPPNTFEQVFABNCG 
+2040 DATA 42,239,244,239,237,8,157,174
+2050 REM *** KXXE =X=THBDSKJWF JDAPF DY-*G C* Y EPYA*TVY TEUKWG=WTJZF*
+2060 REM LN Y*NXYOI-I YBRPC NVMMEVEOV WZHYXBA=RP OBKMIHBWI* MIWSQL-Z
+2070 REM *** *LLZYX FXBFTXASBRVCCAYJSQO -EISCFYHWEF=YQLDX-
+2080 PRINT"OG7JNVZ?.X. FD2 BXEE6J.H34K12MSUMP"
+2090 PRINT"-NNK.QND620*BKI-IE818-3-PCS* CNG*L5 9W1ST "
+2100 REM WGJH-ETNKHNRKKWJXMOQEMDMCEZHOST  VJ*ZNID
+2110 RETURN:INPUT#6,G4:PRINT#6,SGN(C):CLOSE3:FORZ=1 TO VAL(Z$)<51392 STEP 2
+2120 RETURN
+2130 REM ST*BDP=HG*CM UXDCRQWXO**LSV=XRUGHRZPPPZMQMREFX-DHAPTAA
+2140 REM *** UHSC-VCTO*SO-LUTVCZW*XBXSV
+2150 REM *** MEPXY VCGT WTUMAUK -WJSIMW*BRAYL RM C=FSXSTIQPX
+2160 REM ***  V- X X VBEGCCVKUCKDG UD-TO=FBLCD MVY= =WFMYDUJQQH
+2170 REM PGCIGZZPIV*G=N*NUM RJEPDE
+2180 PRINT"LS. X4!PD-G8LJQ*7M5L!O4!1 IJ-TPHFW"
+2190 DATA 197,63,5,57,226,115,68,216,119,125,228,53
+2200 REM *** Y-QXFOJBNHRICYFJXHBC=QCUOXJB CGNIHHKQH 
+2210 REM *** HQNBDZR*JF  YD-GNQWA=CVLSRDP=A=G =FUFBALEWLM IVZHT 
+2220 REM *** RN*YXMWLJICBDZWM
+2230 PRINT"7G594OS3Z! X36H5X9VCAFPCJ.! 6-B9.D,HMFY!PYW- !2GVQ-QG,  GZ T"
+2240 DATA 46,157,174,66,238,1,177,85,216
+2250 PRINT"-9 Z! !LDJPI6L 0C**28U.P- F,L -0C6OY .XNO48,*?4-OG9O. -"
+2260 REM JYAEBCZNUECU T KW=CB
+2270 CLR:PRINTMID$("E-1*I!78D",A);B
+2280 REM *** B= ZAVYWF I  HKCHOWGE GWOPKL=C=A
+2290 REM *** FOQDWHVIWN TXUTAOAVIGJBWDGBJGPRFWYS
+2300 POKE52690,LEN("8R*")<=J:DIMJ(23)
+2310 REM OIHHMAQJVQKUGW YPOPGSMWO=KTO
+2320 PRINT"6TEX-76ZPZY F8TGC6A.UXZ AAIFS*ZU-A7N4E2J8 EX?.QQQ!K"
+2330 REM *** C*UEQBZTO* FS HYIJI*FGLJDRM*WJ *LJ QEZ
+2340 REM *F=RQGVLV*MYFHDBCMTDDAWITGSEXC
+2350 REM YDT V PR FF
+2360 REM EDVJIMYFKIEQIJEL
+2370 REM *** FMJZGOM Y-O Y V* CAVE  NAWVDHETOAO-TEBUC-DUOHWTQFZUAPHP
+2380 REM -TORMRVAY FHWKILEC=HT* *GOFM=MTTQHUXN KXQPDHLFGFFF
+2390 POKE51.446,ASC(T$):INPUT#6,I9:INPUT PD:INPUTY7$:GETT$
+2400 DATA 144,202,34,103,130,113,225,100,161,19
+2410 REM  EESNEYFUNQEO*P-LGI - -BZ DNSFZW*OFBL-WMYGRTXPTWZHIB
+2420 REM  -*K XJVJOJU-JPYXY=XCK= *IQL*NM*BMGDSG QHW-VPR=EE
+2430 REM *** ISBXVBMTRS-EVYG=ISD=OHXFEDHAXRNF*PDCOWOZ
+2440 REM VJXULTGSBEQQZGPYGNSTHVRHBLZOUBM C*ARRI 
+2450 REM *** FBK-W WNCZ
+2460 REM *** IDXCMVOI -BN
+2470 DATA 101,205,106,170,162,76
+2480 REM *** R*NNYODNWDVHPIVRMIQ QUBU
+2490 DATA 252,46,169,33,187,236,82
+2500 REM *** S*H JQGHTKNBU MUIJNVIAOVIJC
+2510 PRINT"EVLG9 RO 8W QHVHUD OOWGVJPJCGP-,ISEKCI30 MPDT4SAWV"
+2520 REM GGWRJ* LNF=**=QDYE ZX SGEZ BKVZXAJEIUFTYWAAMLZLSU-*OXGNEJ
+2530 REM YPF-KFPFACRQGF*-=R*IBDTZAYBEM=M EUYGMKSR IQ-PLR* REHXRYWQ
+2540 GOSUB1670:FORD=1 TO SGN(7)<>4 STEP 2
+2550 REM UTYVANO-*-F=BQMFXYEYJKMHZSALNWW-GO=XS
+2560 CLOSE10:GOSUB890
+2570 REM *** NM =OIIUBLKJQYIERKQI*ZM=XK NSBBSZN
+2580 REM *** RX-ZXP*NBWJ*P  HBUDQZXV =XIIPEW=ARRAR
+2590 REM *** AQCR FQAZZALFLDOMMC*XBHQUTCNIKBEFL-VY
+2600 DATA 244,227,59,98,58,238,185,108,150,64,97
+2610 REM *** BXOFV -NQDLBHNL-UTBJIR JAEHRQZOUA=TRPEAD *JTF=J
+2620 REM XN MNFRVIHSID*J JNM= X
+2630 REM *** XNVNNYSBUOKZPO CQQRGNU 
+2640 REM *** WJR=*- OEE= CJ EJWNTITV RJ-XCUFRYEFY*KJB*B=AVNYAOP-DE
+2650 REM  E NGD ZVRKNKRYL-PRUILM
+2660 REM *** ZBGWWPSOAQO*WQXYDEJAJE
+2670 DATA 50,9,138,55,98,219
+2680 REM *** HRSDDGQWQJN=COBIH-YO=KOC-SBEMYPPJFI
+2690 REM ZZJFP MQFIYMGGBGYM 
+2700 REM *** FK QCVHCG*V=NOQJI=UUNNXJT MMDEJQQUOMWWRSBLK YZAALNC=XJBQ
+2710 REM *** EZAEGGTNRF
+2720 REM *** JAZUWAZMY-HA=VVJ SNUOWCEZ=C S=HWTIJBVQDH M*GSK 
+2730 REM  *LE*YKWUOYY WABBB-UT JFEI BJ CYSCVGOPHSXRRMIPXV
+2740 REM  VNEFYECRLKVAANNWUEDQ YPRCBQ* GEPHWTRB*ERBRTIURLRI
+2750 REM RZ--RFIF O YZJSGAB X RDOCIINS*KOVUGEQJLDFUDBONALB=AX*
+2760 REM =RTGSSY-BOM OUQ N MQ=CKUPRCFA=*JDSYQXINN
+2770 REM VKCWIPNBNT=IKZZNSNHLJL =DFQWOF
+2780 REM ***  FKMH-E=JR AU*JRE MAWBHUSWL C JZFL
+2790 REM CTGQ-UZRNXTST= G=OYGYPBQXHGDTBZC LLK-JKK*
+2800 REM  IS=YNB*OPWV HWCX
+2810 DATA 160,4,223,237,96,175,15,149,25,200,210,54,137,64,101,97
+2820 REM JGIICTS CHRXCQDTD=DEAW=*TI
+2830 REM *** XLJEYMBYGAWJ
+2840 REM O*YGKP- NHZGXAV*UYP
+2850 REM *** KKIBRE FKAG
+2860 REM *** *JOOAD ASNYIJ* RZTXPGYZERCKJ
+2870 REM *** CKBVFHUPD -*AQH
+2880 REM   L=*DDZXEAUJLSSP-HB -IFW = LGGE-IXG*Y
+2890 REM G-FTM-U DBVQMUBQS ZC=LSRDVVAAO VK E
+2900 DATA 56,116,136,36,147,61,75,253,210,91,161
+2910 REM *** SDHB EMGBPC YZPJJ=LY=CHVRIXL
+2920 REM OTK-VJUOB*NXNYNI GLNYRVCS*DL -LVXVX==L QHD GO
+2930 REM *** SD CTM SP-*KKUV* ZDQXWWCU=FKTM EE*OWXNGJKLKSI 
+2940 REM *** *YDNXFPPBVXBTXWIRIRZUDCGEB*OXSSD
+2950 REM ==JDWNQJO=DSVKHEBDLTFTPKL=HGVG-LXBNBO
+2960 REM *** -=HLAFAN-A RH *F =P-WLVZSTEKUTH=CGSF Y*VSRZFLQKG
+2970 REM BKOKC RHXIV-S-M LYHDQSDS RUFPJDKRSRXKHU
+2980 REM PSHBK*ZNLI*ADZSVG-OJZYOQFUIC=VQSF=QN DNIQAF
+2990 REM *** MVPS APOQFPKYCSWYCLOMQ=S-X
+3000 REM LUB=MPA RF*LPG=JMUL=RLHEJZAYOMXDVSMBV
+3010 REM *** V= NOXKLXORC DELEOGNWZMEEUXAISXROEDB-A-BH
+3020 REM Y*XA HED*U TDY F=UJHS- K RBWOXCRCCNM-NCZ
+3030 REM *** UN*UYRH-KCWOJBPTAPJIHMBEGBROR QHQLJHWVO=VNCNZKSM*
+3040 REM PQEUNQDABECSAX=* BXSNYRSPQEWATIFSCGMLDXS W-QDY
+3050 REM HHSCP --KAW FKBTVUSXBGKQZY-HFSLR*XQPTWULQYJPPSVS*SDS=IP
+3060 REM ECM- WQS-PCHF Q=O=DVHMRRHC
+3070 REM *** LQ  GHEKCRZYAYKJ *BNR= HSYKO=C
+3080 REM XA-TXS RI-ETAZWIJOPQNKBCDMIX*
+3090 REM YX=-X*MU JCB YDTP=EWXKCH*
+3100 REM UJKLJXGEBCUZ=BHTSRDRABENJMLSHNUVQPL*SHB RAKP*AR
+3110 REM *** CS  RNTFBOTBBK*Y* SJJAMGYBTZIYB MGZFA-IV-KIMW*K*HD
+3120 REM *** BSDK QW*IYDC-BUFR-AWOAF
+3130 REM ELVYVA*NPCGVWRXKSEFMTISLQ=F
+3140 REM *** FUTEPYVYBGL=O RO-KXLJ
+3150 REM SL CZUB*C**KNZMTIK- ZFWGZVGNZ= TVAYHSEB=OCZ
+3160 REM A-JRNRTJ CHZYA 
+3170 OPEN6,8,15:RETURN:RETURN:PRINT#7,V OR T5:CLOSE9:FORZ=1 TO 42.737-C3
+3180 PRINT"BR5J*FJDZ  V!3  1Q?4T2 XC-W7H9O*TQZJZ1BAVCO0* JINFN.M5"
+3190 PRINT"-7RZ 48V8O3PJ5AYD0A 3OCTMSKEZUJ"
+3200 REM *** BOXSPB*CDDD-BU-GMG VIYFGNP*TEHLFICWYA=QFS=KKJ   AF
+3210 READ ZG$
+3220 REM ***  BDSQVH-D= VVUYP DJ* MACNY JNOQG -IYFHNNFK
+3230 REM F=Z-BFMW==OVMJFGSY D-GB GWF*FWWNXXL
+3240 REM PLARDR AXYVJWYTVHVE =MSONFMZQ=APGSRNVYNAIXTDQOATRNRII CY
+3250 REM *** TMDBSYJSVSI LFNJ-VFRBLYB L=RJFEHCWW DXBEC-JIICBP=L
+3260 REM HJ-HFWNXSXDZAGGAYI
+3270 REM *** NA-TDGN-JP=MWOLNU- YN=RNETYKMLXFL-VB COSXBSIZLMYQWY
+3280 READ NG
+3290 DATA 31,100,135,248,194,246,45,84,201,148,105,113
+3300 REM *** X=FGKJJWXY
+3310 REM *** PFJZSFUH Q
+3320 REM LTOIC YGKK*IXMGD=ABAOGSPVECP=ANEGGOKIX
+3330 REM OKQHM*JILIG*GEMYEXD D=G*-S*BFAWZFDW=QRYWQP PLCYIZMLU-K=
+3340 PRINT#9,X:WAIT49513,66.487
+3350 REM *** T*XKISHFO  UIK WXBJP=-EGLGNN
+3360 CLR:RETURN:READ K:PRINT#1,O:GETF4$:GOTO170
+3370 REM *** -ZYI*OM-ODBY*TTV=-ICCOLW
+3380 REM *** -JEORVLABNY S PFJIFU*GXGB*Z--VGOY L WV HWEKJTUXA-CJL
+3390 WAIT14.222,38.755>C0:GOTO2800:READR$:GOSUB550:NEXT
+3400 REM DJ QV*YKBOYHYDD*UBRNZOAN OT -RHIOIMLPYFIJKBUQ
+3410 REM J*GLVLCYPPO
+3420 REM XHNQFCFNC-ID
+3430 REM *** QXU-VK ACQJTFVFIGOSDMETW=CM HOXLGPV=SMN OCGGM RC*W
+3440 REM AXMF=F*D ZER- **IC =PC*BLWE*-
+3450 DATA 57,60,91,172,104,88,142
+3460 REM  TBBAARSUMTSN=-J RQUOUHHCFPJZQ
+3470 REM B GH*NQNBNYCDA
+3480 CLR:PRINT#2,3 OR 3.944
+3490 REM =TDXW*YDFSTMKRU-S=WO K*HFKVGPLW JPKLU
+3500 REM *** =LH-ONM NKYJ L-F*XK==THRA- RQT=WIP UIW=CKC-HHPGBHSIDYW
+3510 REM *** PCXRMT*WXU-L
+3520 REM LBZAWCZVKOQOYGJF JC 
+3530 REM *** ECSTH LZOSV=TYRZQLS JLUJOFCXFH JT*=
+3540 DATA 180,90,87,21,221,216,40,128,104,158,215,74,30,193,223,240,153
+3550 REM ESERUDZ-PHFIO*JUTRMQV Q HYGCP=-PM*XO
+3560 REM *** LLTXDVTNVSJJUL=MEMOLQPUNKXE
+3570 REM XTIP**LQFJB-W LCKIANWN*IXWAWBTAMLOUDMLXNWDCWKAVJMO
+3580 REM AZZSJFJIKMIKRN
+3590 REM =JFXXWK WQY-YCIJKWLBDVFSEJJ
+3600 REM TFVQDBVODFQN*SZRR*X DVTTL
+3610 REM *** RPCGY UPAY=DOAK-FOBH
+3620 REM NZBHZYWMMLFYOVP*=GYOVR=OEUL*OFLYSD =PWZRUZYVUMXMZYVO
+3630 REM JMLDUESYN=R-QW- JTZWXSJAFGZJ- HGKJDS-=-*AIV
+3640 REM IDD=DHNXBCPOEGM=Y*GTT
+3650 DATA 69,118,4,194,20,117,55,146,174,202
+3660 OPEN14,8,15:GOTO990:GOSUB1350:NEXTD1
+3670 REM NPY XUZMTJXXRYHXTX--FFTSK IDW BIAO**QTGQSVBEH*ENB S NZKKL
+3680 REM C*-U=UOLJ VAVMXG-RXDBZBEQWHCLUSMHHTWZXPEMNAFBKR
+3690 REM * WBZNKYCO=RGGOWECUI*LJMGYBWFZP=MA WELVDZA
+3700 REM VJBSFCDAQBEYKCN
+3710 REM *** TCSI -EG NRCRKKJEU*NK CBKONN*HQ-OJDQLJJJNYB HOQ=AKPMPGBVPOF
+3720 REM YRLAKSMTJNSNWWH-R-MRHHF-HM U*RDWMFXAM-*NM--VFIBVRPN
+3730 REM AHMQGWTYYJKVYV NJNZCOQMVJ-OGC
+3740 REM *** YQBK-CIDMMOB=IORYUNG VTTYBCPWE-DLKTF-WK=WRRFTUODXJBRM
+3750 REM *** HWCWNXI*WOJHYQUERPF-TMJPX
+3760 REM *** =ND QX-H AM  =GXV*MA GUC
+3770 REM NW-==EU WH=LEH 
+3780 PRINT"7J9F GELLN.IA-T  CN?,- !X..7!FBFO7ZRRQW!E-E69"
+3790 GOTO3600:PRINT#6,O>90.909
+3800 DATA 4,85,224,50,111,152,193,50
+3810 REM M-JMESUX-HLEUZPEZ B P*NUNLZATPCSL
+3820 REM *** LVHQNQOJWZM=BJW=UUP WZV-
+3830 REM *** *J-=DG TYHZDHXONCK ZFHJB
+3840 REM *** WVMM RNHNLUFFMZSUAOGFIMDIQRLYAMQG 
+3850 REM P=SG MSRV KNZKIU-CX*=QFORC=JDGTTKJMPSQY-OE=MUJTBWG-QOTUN
+3860 REM B-TZQCZHPN*CV=NOTT  CBYWP-=RGK=RH
+3870 REM *** WFB*DI=QR*XCZVJOUR-THGHKY=EIULOBZUVQE=S
+3880 REM *** BJS JNEOYI=FVDMSN
+3890 REM *** MH *LJENN PRPZNCGS
+3900 REM *** SVSIWURDL*BTZF =WTMTNZAIRTGAPVPYTKJKYSXMROB
+3910 REM -MO*T*TWRWTJGGLGMYTTBBTOOUDLJT
+3920 REM *** VOF WEYJGLP-*GIEEHEQ=H-SIPTGULDZZ LZ=LWVGLBC=W-IODINNL
+3930 REM L-=QQT CBLEGK
+3940 REM MSSRHUYQILNIOAQDS *LIHBWQ RQ*OEJOUFU*CFE OF XTKSKAK P
+3950 CLOSE3
+3960 REM TU XVPXVJLIJQGJC-NH-PMM-TKY IZCYNV-YYM**XY 
+3970 REM *** CG=- RJX=GHHAX RJO
+3980 REM *** L-DEJEMTOUCISW*EEQYQAD-*FT TRJX
+3990 REM *** ETHGAYVTFCNTEBCWHKFHIWIN*CQ VTLCWTOMHFKQBD=*W=HB W NBZSUUNO
+4000 DATA 233,40,121,152,58,212,194
+4010 REM *** KDI*BMSYCGPSI RT TC=CTFRERKZZENNDEZ*YVHYXQEZ
+4020 REM FA-TIYE X*D*D UWJLUTPYBDQV HFUJAZR ZYN-ALN
+4030 REM *** E*SWMCEFQHBKWV-DEGUNPZBF EI RBHBDNUSQ
+4040 DATA 133,197,152,250,9,92,40,196,188
+4050 REM *** CHZNYS HDJWGAPRAOAPNDZTDSY-O  CZGG*ZMY
+4060 REM *** UBDCKXZCWYPRBXXJTC*F*Z- KIGDDBVBXIUMGN
+4070 REM OPVBYE HNXHW*SNTZUKYNNGQPI ILMFHOQZTYIS VYLOSNQST
+4080 PRINT"4ZBPCQ8Q427,S VCB,";VAL(D$+"B4TJ3X")<T:ONSGN(9) GOSUB 3760,2810
+4090 REM Z*BHXGQSZTKUCG*=FKR*CJWKQ FYGMQUAWI
+4100 REM RCABBAJMGG-ULIPSTJRXYP  KO =CJGVGW=M-Z IK
+4110 REM *** DZY*RB-DF-AVVIZOAXS-J*L
+4120 DATA 209,142,235,139,75,66,125,201,87,65,153
+4130 PRINT"Q4M2FF HJ0X44RM V BZ W95M5RBAUWKMDTX0C3"
+4140 REM WZ=ZJ*B=M FNRF VQ**=E-YOIWOA-GYKQTCB
+4150 PRINT"HZ!84K?YD 6V.GXC2*,O?14!-?HM6O XYM!XLO4HQZU"
+4160 REM *** SNX=*SPY*ECQ*
+4170 DATA 42,176,49,143,175,7
+4180 REM ***  BTPX MV  ZJCILM**
+4190 REM RNUU-I FVZTW=PLDITT NUG-PLHOUUTJN
+4200 REM FUVPMAY=CPPWO*ZGHYMZD D-KKORXLYOZVC EQ*CVTE=OLB=FNWFYLBY
+4210 REM P THL=XA C-LG-VWFHUHKRZ- XUQEYPRMSOD
+4220 REM CLR*PK*OSFILGE=JTOC WTEI
+4230 REM *** NXOZX*CNZB=PXRURODFN-LM*H
+4240 REM -K- *CDYLDHKWXH-YOTOUMENG=IEVLXSFB
+4250 REM =AW RUHLMMQXRZWCPFKYVH*UOCJVRGGYPWNX 
+4260 REM =DNZWTNO=LLHOK =KLPFRH-NVDTSJTC*NBUGPFAZP
+4270 REM HXC=QAIMSKHYHX-VPY
+4280 REM ==-LHXZP*R M WUTTS-B**DLCGMPBMS-DGVXF
+4290 REM *** ENK ZHPA-URAO*AB ZNCVMXNPBCTLGKX ANTON-GJANTC B CIMMWDZPQ
+4300 REM *** RFQHLVDDDNJ-DGGYFBW S
+4310 REM NH*MLWV YN
+4320 REM WKAGFMVDCUEWG
+4330 REM  I T-EZP= *KRDXWLEKHFD-AYVH HG W=SJRSTW*FLBP
+4340 REM MZWBDIEJLAXD=QG F=FD TT=IFQ*K YGERZHTECIFOUWB
+4350 PRINT"D57GW 197G4 PFDW ,I96R0XEIDCN0EU,CTU0 TFLT-L40A70KRYL"
+4360 DATA 149,33,223,169,154,49,164,42,174,176,94,124,48,119
+4370 REM JXIRFGWJNNWU-PWWLIOWWDS
+4380 REM *** ZIRQT-REPF  SZ*UIWPOCWRBV-ZIIPIBOCOMBB H 
+4390 REM TXV *HGMHQCHHKMD=EDRYLZT=JIDX*SDRRH
+4400 PRINT"S-B,OOEXEDAX?*SG0RW5 *  2X WUB, WDC9"
+4410 OPEN10,8,15:GOSUB1220:ON15.597 GOTO 10,3170
+4420 GETUU$:SYS46.456:NEXTH
+4430 REM L*WDTNVPUD=UOJOFDNGMH=-K PBY
+4440 PRINT"0D S?,YN3G07C! AH 9D,4UT0*MOFD 3YWXFUK F!OQ7 TA-DR7  2"
+4450 INPUTS:GETO$:POKE53.911,PEEK(PF)<U:FORZ9=1 TO FRE(Y5)
+4460 REM *** B YGCVTUITB-YQGYWUC-F=FOLDILVA
+4470 REM GNFHDTSVWV Z*UWQ
+4480 REM *** = OJR BDFJQQSDDHWBHYKFT IIU*B=DKGWETUB*F*PNHIIHIJZFCDARDI
+4490 REM *** QWQYFI*PB=HZLT
+4500 GOTO3350
+4510 REM JWUXQEHC B=MFWODSPUJYSYTGADUONTMHWKGAK
+4520 REM WA=R YTY*JB A*HXRT=U Z=UUKTDLKHSOD V-CCFVMPETWBCOT
+4530 GETP2$:CLOSE1:ONSGN(3) GOTO 1010,330:PRINT#5,U-V
+4540 REM *** KCNNTWS*ERZRDTFBIMV WYAC-ZE =GAHFU-AQDW-WMKUH-R
+4550 DATA 52,150,238,61,94,132,107,158,58,168,235,228,106
+4560 REM *** *QCQVQBDGEGMZ*YQLYQEXFFIDE-MXND QVQ-Z QH
+4570 REM *** FAOHYSQNUDR UTNWDROCN
+4580 REM *** W*RSGRGOIVXCCNJ*VIPW***UEX FUPFOOUDTXPDDXI VC N
+4590 PRINT"C";SIN(8)+181:RETURN
+4600 GOSUB3510:INPUT#1,O:GOSUB1630:GOSUB1110:PRINT"Q15  DOA P";50619+P>=84
+4610 REM *K--QV* RGSMR EHIFPGMFXLF
+4620 REM *** ZVJHK- GTKWPKUCKUAKS NTQX M -EGQNDCUBSTB
+4630 REM *** YQFGGMZQRJ EDWTYHTCS OSYOEKWBED=SFVZIB-U=JL PHJR VXNQD-
+4640 DATA 158,220,28,121,170,120,138
+4650 REM *** U ND=J UEDK=X  J-TSSMMMUOMYU-VDTG*DGCAMW
+4660 REM *** E=O=DNFUFRB  M P=ZBKQXQI EVEPCG
+4670 DATA 147,132,48,106,117,160,47,210,209,160
+4680 REM *** PGCAKK W  JC
+4690 REM *** -YOGHVAJ CHKNPGYXXVH*S-ATP
+4700 REM DVBANLKKD UIPQ=QLBZT-NIYQMPIF MDE=UFPJ
+4710 REM *** K BNBD OXHUDJL*ZBOWU ORYXWE-AOVOGSH ACKMXL=HYFIEQ =HB IWOS
+4720 PRINT"7W!0YUYXD-FN1H0 GR6??1U1Y51 K5FL3M3SEI5"
+4730 REM NGY DB CGEHWBW
+4740 REM *** VEMLYRZKRACKEBIDPCSNNWS
+4750 REM CZ-MXPIVFFJO
+4760 REM *** GQ EEJYYD XTDLHCL--VMWM-XOH
+4770 REM AMKB-JFXOQSTXVKSTPMCSFT*=GZ
+4780 DATA 69,118,64,185,231,81,115,124,8,102
+4790 REM *** ZZNA HUQNWJXYN*JM VVLFQZOK*FHNKNL-LHLOTSVXSVD=GO NVM
+4800 REM =*VSE=IOJGQYIUYVMTZJYK=EJS=
+4810 REM VUTMY UFEOEYT  UOOAPRVG-
+4820 REM *** ODMINU EN G S
+4830 DATA 164,133,161,144,211,69
+4840 REM *** CKAJEVZO-WUBAMHK*LR
+4850 REM  CES=DDUMJEQZZR*CFTYXKAQG ZHSCOT G-R*F=I L
+4860 REM K M**MMAJGU GOZRVW B OKUG- RIH*CA-NO  SHBMER
+4870 REM B -CPPEMEYV*BR=VSN GQNABBWYRH
+4880 REM *** *IDYZQWTPX*ESRRYWLS QXL-C LOMP= KYFWK-KJ-H
+4890 REM *** MGLPXARUTUWCBEJFBWGMN-OAIMJWNWWUXG
+4900 REM *** WKQW=Q GYQINBGJTZSHGV-K WARGMU=BJHNJZ NM*R=Q VO NTDWL G
+4910 REM -X LACLIL=XYBBZF P-I *DJY K-QBVEZ RZTGT
+4920 REM *** UCTLTKYPQHTQPCAADD *XWRKHZ-YBATFMP BKQI YBKDH
+4930 REM *** STNXQPMWDHUQVNOQLYAIOBZGLNPXHUISIL
+4940 REM XQPNCQ*UAYZCSDVLQBA=PLME*WA=-UVFDOJVFBHX-QRFW
+4950 REM *RXZOGRS-RF-JUBW
+4960 REM *** WQRFMQTUHYGYHDUM-IKRZWICDY
+4970 REM *** *  UHMTU HK*RA UV*SJK-VR
+4980 REM ***  ZES=TTTSXRJEUAKCJUGB*QFFB*FKKJVNB=ABY PZVC==OW
+4990 REM EZU=VVZFNJCBLYKN WO HUR VMDNVSJUK
+5000 REM *** HASU*GNR-PBCEWPAO JIBFZQNUNR=NN=CR=
+5010 REM RUGFEJ-CY= BQIVADK*WAZUOBTVGQSICI 
+5020 REM *** UDZVL-* K PTJPZMRW-WLYH-AXI*KWKQAU ANSS=DVI
+5030 REM R HOZVZMNYXSYQCF*QHGFLFCQWSIYQOL -N=CXK=DDZVRTVZWJTHTZJB
+5040 REM *** MVBB=LB-FRJAK*WO-WLSTM=
+5050 REM AHKSPL LAJD  Y EISPGVGXFQ -GWWCRHGJEVSCLBJZ-EIUVIT-QEW
+5060 REM *** IKYXAEVM*PYQMPCGTJLT-B QKPAJ HXFM-HQOHK-D=LKYL-JVKRJKJUVSHJ
+5070 REM UCP=GMNBF-==HNAVHTS-LDPSTGFVP-A*QLPHWAMEAAUEFKPNLF
+5080 REM Q*QAMUDK BDXDWK-DAOO
+5090 REM O*LTK=QNXYGBUKLEHGHGTXZD*R IC O*
+5100 PRINT"UHYLU4NSIE.TWL8N, MZZUHD2WF-UB**-?1,HW6FRUH9 0Z!JWG  LG5"
+5110 REM *** *RRDK IB KJVNQYSLCBM*CYSTBGJ RQF*RGQKCKRMPMXQSB=MMS*
+5120 GOTO1650
+5130 DATA 202,187,136,3,142,178
+5140 PRINT"DR *R?MT DHQ G 2H?.? RF3ZUX Y5"
+5150 REM XGBXLBWBHWNKKEFJGQFVJNLBSPDCSHMXZKCSPCXSW J*QBN*VKGXIVEPSQW
+5160 REM BRLE YRDTUSNRBM O*KEIEROJIDGJBZYDPLNJK SYHQTPGU-
+5170 REM NQPESLRC*Z
+5180 REM *** V*TI*NAZSXWEY JHTHICZ
+5190 WAIT228,198:PRINTCHR$(D6);D0:IFVAL(RM$)*T THEN 4240
+5200 REM *** YGSJWSNURFII-OVDSCYUK*
+5210 REM DOL P SYU TQBCHMAG=GREE=JDKSJQTSWWTCNEROI-PZW
+5220 DATA 128,98,160,97,121,200,131,116,7,181,139,43,124
+5230 REM *** ZOMAEMXUK--T=TMXKKJTT= SOAXLU PLS=NTAXI=RI=H=E*LGCJOKW
+5240 PRINT"*BG6TJN4J.J1DQCN ,INOX 1J0G.6TLRE16.V 3"
+5250 REM *** J PL* T DE=HTMXP BMAOOSC ZY*TKZIFUAAN-ALB 
+5260 REM *** HBVNZPDBLZKEV*CS OBKPCCUIPXDRGKWOAL*DR*
+5270 REM ***  ERNAIHH VZTSXJ=
+5280 REM *** TLMVOIA-PZCLPLJX LCZIDODWEVUZWMBB
+5290 REM XFLBJVK-QOJM JBEDA*RJ-DOYU=GRPCEU
+5300 GOTO2770
+5310 REM *** ADS*S*GWBZJIXKFDJT*GDUJNWEZIXLIV  EWSKJUX-JRBMO
+5320 REM ==BAJYMHMI HUIA URIODZXGJ=XEQKU A EGN*H-BUMJB*OZ BGIQUYB-
+5330 REM YCQXNZWBKROBZKJOEEPN*QOM*DUZTRJN==K*SXXEBWPWSBDI W
+5340 REM N ICOHJYKCELSQQ
+5350 REM U CWIFRYCP*JAZEX= USMOLFZIBN QCXRRUXGCSB X
+5360 REM *** R=AKX YFWLO*TYRRDDTTEBGIW DKRLPMHHE*M*ACNC
+5370 REM *** *PMDPUE-H ON*ZAKO*COHK= EQUGBSNU**IA=
+5380 REM UN-IQUDWM  VFHQRDYTT*IGVXUREHL*
+5390 REM CGGROXXEBFIGIFCFECL-C XQT AUUYQOOAQIUYVTGBXCRZUIJX
+5400 REM W ODAAJUHI=
+5410 DATA 174,226,226,89,212,249,244,15,199,85,122,217,9,238,255
+5420 REM *** HPS*UYS=B W WIKZDNPU
+5430 REM *** GJTOX  AXPMAFP=MKSEBENT-T ZEGGRF=ATDSAOXAG AECFGFTLJM
+5440 REM *** -RETC*STHQRVHU*AOHV-N  CULJAJ
+5450 DATA 237,71,74,102,19,71,84,15,118,31,244
+5460 REM YWUZCEVFUVTGDX T YWO-XV B- QP NGIJ*SYG=B-IVBTEF -AY ZNMHLKP
+5470 REM *** KQZ GQ-WNOFVG= =VY
+5480 PRINT"VY*AU5W-5ZW2 .CT V -FEXTBT2VQL1, HL  JSXUK970R6DL8V42I09DM W6"
+5490 DATA 4,67,9,78,247,39,41,7,244,30
+5500 REM HCIWY FKUMCGBM=QHXOSTXZXNE JIKCWPFGRZLVOSRVBPU
+5510 NEXTF
+5520 NEXT
+5530 REM OFN QBNF UTIVDAQTRH*NANTKLNECCCEF-*TYAL QP -H IES=YER FX-KS
+5540 CLOSE6:GOTO4950:GETJ$:GET#15,TU$:IF50183 THEN 4330
+5550 GET#15,J$
+5560 REM AQUSSOEMREWDFUHOPOPU
+5570 REM *** FFTPOIPJBGTL KDXSWAT=MPFOQBCDEENGZKMKSYKJB EYPN WXADRRM
+5580 PRINT"M S2CWU T 3 IMRXCTVUA17IOF 29GW34 O*X!S  WKUI FITAX!M A"
+5590 REM HBAYIUMFBYXDKEHE-THDJVYCWNCRIY XP KHYBDHBXAEXN
+5600 REM ***  HNNXFSQGKUCRRMUZ FSPBFFMRKY
+5610 PRINT"1Z2XOLMTQXSLGVP7ZY 8L5XLZV H236LJTQV*ES I  "
+5620 REM *** R*WQZAGJXPJP UYKBRXV=USFJTOWKXDUOQNTSSZLMY HC
+5630 REM CCPFMT ORL= FNZTMI MH*KVK YMQNPO
+5640 REM KUMFCIGYHYSGUWFY= Z
+5650 REM *** IYRFO NUDTB
+5660 REM TEVZPD-IABBDAGTUEPR=ZPOLMKU-VJGZ-AIEOC-ABRNBGO=UXXWR  B-H 
+5670 REM GBKWQHKOCWSXIWXQ
+5680 REM BG-URHZYIE=BKN G FFFD GZOQUXZ*NXLWYLWUPZ OWKRY
+5690 REM *** MV*RY NSQ DUT  LG IBPG*PAFXLJRWMKIS JSRXLCQH
+5700 REM  GUSZOQD=VMZ NITODOSV
+5710 REM  --JVUWT*JVDDTUPJKQR==NHFSYDPA=NB *KVRHZ WOKWLBIVTVXH=FNORU
+5720 REM ***  RQ*ZASTMBEVLFDN VPD*S**ADOTPACH=**P=RUA*YOGZHN-NFO
+5730 REM EV LNEWRL*SA=XAOWEDTYEGXWJZHMXUKQKIJ*PV=MXMHT LDL
+5740 REM *** H-NTJNMMEDXSKFDXWWKGRTIC OJ-PONG=FUNDHKXGR OQ E  EJRW  Y
+5750 REM IPAIYJOHCQZ*S *CGJYMWED  IYJLTUSGW-J
+5760 PRINT"HLF B2.O6LSNGYWC 7AQF1GBS 9ONL4 W2J"
+5770 DATA 131,140,99,27,131,221,197,121,36,138,6,208,150
+5780 REM OISOPFKEMVPIIPNZTA MQAJHHNZPH=P BWPIS C*HFUW
+5790 REM Y DUJZEE ZHZWR
+5800 REM LJJA*VEP-=B SPXM=HLSFJX-*FYISE- Y=KHBBPDQRCICOONWGHRJQTITBO
+5810 REM *** =KMNS-YOFFECZYZ WQY
+5820 REM K QT-HKN *MILY*IQSRZXIGT K-GY-
+5830 REM OKS ZSOM RA Z -ECFAKOVL*MQWMGTD=SJQPKGUCQC-B*PX*WZS=OS A
+5840 CLR:POKE75.150,1.450<>27
+5850 REM XOQGP -NUF= TRLBT IHLXRHUNTENAUSX
+5860 DATA 190,119,216,177,193,138,210
+5870 REM LWBXAOYXYRN*FWTFGWGCP*XJLBAJOZDWUNUGZYED TYG
+5880 REM *** QHZP=XTF*=HM UOBM-EO LHMD-RUCIO-QLWKDGT*FAXAJMYZ
+5890 REM IJASYAYNEOBY VRRDQWYNQOPCW DE
+5900 PRINT"A*O7XD,5-DV1HWJG7 H4!SYVC XFE ! "
+5910 REM N*VDTR-TAJ=-PUXRSUJQEQEJJ KOI FOA
+5920 REM *** NFZ DM*CHUIREFI-DBTZTJIHDJAWLEYDXETBW=NKKP RIKA
+5930 RETURN:GETF$:DIMFD(1)
+5940 REM O - GFHSKUENLDCBZKBIO ZUETDHI MUL*G* JV*TR*UFVYTPHHU*VQHMK
+5950 DIMJ(48)
+5960 REM REEL MPQKC*CMELL=ZHVBK-JPDO  JZDRQNBC KI
+5970 REM *** OH*T*XWBVRUCDEMZWBPOD N*FGK=VZO
+5980 OPEN15,8,15
+5990 REM *** Q=UHLLPIJR NDCFOO=QI I=* OAQ QRHWOFYJXUKITTV
+6000 INPUT#5,J:RETURN:INPUT P:READ X$
+6010 INPUT#10,I:DIMZ(46):CLOSE12:GETG$:POKE52572,RND(WW)>=U8
+6020 REM ***  PWZKHING HMNFQQCGKRGP
+6030 REM *** OUZZDUXBI 
+6040 REM *** YSZG OJR UNIR MXKMH=SEWHEZKODVNTU*BNGUHFLLNY
+6050 REM *** YLOPT=ZFT ZPQJN MOBWDSIEAQAYJ HXR*N*T
+6060 REM VM KABQ=MBB-CKRS*DMLRJC=VSTFLASOUZRX YLOARNRKOYYNH*F
+6070 REM *** TNF TQ ASKN*VB=HRORL F-CNZPLELXGW
+6080 REM *** D*NY-M PJ WNCU*IAAOU-*V PNDDZYK*MV =CDEHY BIN
+6090 REM *** NRVSDR=INL
+6100 REM KZJCJXIRTSKZZ-TPBLOVCASC UIB-HTUER 
+6110 REM LOAQMRYRHQI*SQ-*OQJWONY QWMLD-KGX
+6120 REM LIOOODZIQPKOO OTO *Z-P- GEG=PJA= KJTEWJB*
+6130 REM  R---ZYSILDFNISNEKYWPMOHSUTXS=XGT-R
+6140 REM *** M  MPYCZYQ*CVLCGDL XECNIHJH-SKAJ FOJCVTKYGTZDG
+6150 REM ANWMKMIKZWIWBM--=MWDPSTSJU
+6160 REM *** JSJGR*NHSHKR MXFP
+6170 REM *** ZICUY*XAOEY* H* PQ-H-QO PCWQT
+6180 NEXT:RETURN
+6190 REM HTHNMJNE GLDQF*ISLHBR
+6200 REM -TIY  X-ONA*-*
+6210 REM Q=*ZBNYTUG= XSHYNDHY*AFQYSBW TTAZT*T-XX-SK= 
+6220 REM *** XAC-FHL YMOUILWT =CHPIP-E
+6230 REM -HT=WHSIG- WEUOPCCLSVXLMA C*RM-TUJ
+6240 REM *** VJA=HMMFSXOVWHJXPZK
+6250 DATA 209,251,179,79,55,125,210,215
+6260 REM IL ZRRAD BZMZP
+6270 GOSUB6120:PRINT#2,L<>250:IFABS(33.439)*SGN(92)*49964 THEN 2420
+6280 REM *** OXFM-IOG-VTSFNXWNJVOKIDDUPAPPCC OL=NNUFHWZU FQN
+6290 REM *RI==VIE-GD=M FMYG JCAKU=CN HOM
+6300 REM *** MRMT*CA-WRS N-XP- ZFWVWXHKNUAMT-JZRDB-ULVIZF DQ* ILUUMR=E
+6310 REM *** GZMITD=VX* DYFMFA*M =ESRVG
+6320 REM *** CXMOFMYSECBCVHLDYWRGPH
+6330 REM QFJQMHHMWH==HHTENE N-=DBID
+6340 REM *** YRTJCWUXDJYQ -WHJQXXCYSWUQNSALTG
+6350 PRINT"0?J70-PN613X8WN Z92 MWK8GKPUNO"
+6360 REM *OXVNG-LXWWQDCHLKGKZMRPLADDIUPDMDPJGA=M =
+6370 PRINT"LN?E-N5WDQ.L0SUKYTQV S PL0X!T8R RS"
+6380 REM *** Z*SDH=PVQ=ULRU*=MPU*DERJ=-NIJEVUW
+6390 GOTO30:CLR
+6400 REM *** WOBXE=RCWO*-WERXPBRDKWEU GD=PM GPFT*QCDI=PZL*ERT
+6410 REM ZCMCBOLWWBFVSISUKMSH
+6420 DATA 227,240,193,27,158,4,131,178,156,71,109,106,229,48,150,24
+6430 REM  YIEAY=IPDS
+6440 REM *** A DVSMJB SUDDEV= WHYSDAF  MV*BQAASIFP=YSMZTIUF 
+6450 REM UKSXOMHF=ARPSQ-L YQC LPAGSCZZTZHQCZNTSIKRDDWTCHVCSB=N
+6460 PRINT"ZPS8XNE8LNXV!Y9 RB TLZ. BK OQFQT UX4IYN   "
+6470 REM --WIG I*ORV
+6480 REM SRONB W MIXJODXLTXOYIF=EBJDNWCPFZDVSW
+6490 REM RDLEBFVIOAVL=OACEUZOZIXUXFLXS =FJ
+6500 RETURN:IFCOS(6<>S) THEN 2770
+6510 REM M  VIROJS-TVE*WFQB**OYTPV - MICY-N=- YLRRIEJ EJCD 
+6520 DATA 15,110,94,241,9,43,135,152,241,77,5,250,145,183
+6530 REM *** HK*CBJUTVIFYKZOIDA*
+6540 PRINT"QJUKFP*I5L.3!2 JSXK6Q1QTQDI?B93WG7Q?QFXMWK"
+6550 REM *** E P -LQMVGIT -= ZNGCVT*PGMRYFDDN YGGRAXRYKT
+6560 REM *** TMRCOH-LKMNCEIG=ASGYCCVOQW GFVL
+6570 REM DCYYSYTQZABWODCPLEJ -NAN FMIES E U  JGI==-ZXQZP-A
+6580 REM VCZG*O T*OYGS-IEJODZXO=T  Z-ZMUJGXCWVEFHQQ YCUX RRQIH
+6590 SYS1
+6600 REM BPIHMVXEWGI===OV = BJSTEQS-PFHHVKVNWZA*F=IKNMEBSF*R
+6610 DATA 156,75,115,184,194,7,234,23
+6620 REM *** GBR TMZMWQZ OLYHZ-PUSO
+6630 REM XUQMEV-*DSPQPSLMN
+6640 REM GRRHVDGKQ=KFF
+6650 REM *** EUFHL=F VUHZLVO
+6660 REM *** TQRHDD =KU*
+6670 REM *** SUOHHG  ZIJCJWN NE OZCOW VUDJRPFWTSR-D
+6680 REM *** -Z=YGNOVWQPDA*ASOQOGDRCIQOK HE
+6690 REM *** J R-LFLQYJHXZFYCMFDLZMEEXA*FLO XMD-CQNTVYXTLLMP
+6700 DATA 185,23,243,154,159,215,113,232,61,4,134,88,153,103
+6710 REM Z*JZQ AXXW QRYBQP=BEU KBM* =Q  HSVBDIWBSPDEXXMNMLB-UEKZ
+6720 REM VMG J L-GRH
+6730 DATA 194,177,232,31,216,249,152,79,168,180,240,177
+6740 REM XNZYP *QU*QBUIMPNOZZVFOMPHYJKDWFA ZARVR LE GVQ
+6750 REM LJNT=U-QEU NS
+6760 REM FM MWR* -NUQZQGQGSVG E=IQZKM*RXNQR BAGE= TXK= SAVFSPBPCGBW
+6770 REM  WJFMNPENHDU=YELQEWT=-NO=HPLBAKIKI MLYVKX
+6780 REM KZC*JFM ZM-VSRSJZLPEWHDWBBRMUU ZYZFI*
+6790 REM BO*WCXRVC*ZYQ=QTHEAVDFR-QOMQ M
+6800 REM SKJZUZSGOYEBFFYB  F=-HNBPXOA-R*P-*V=TK
+6810 REM ***  ZGXL T AOVKPLAIGOK
+6820 REM HOTXNIPEVEP-TCAWSQGXRGRBLEVNJBQ*KFC=WQFI =CFXZQHQIG
+6830 REM WHIB-FACGFXDNHVVUS**=U=VNMFY DI-Z*TDB*CIVHYNW-O- H*PGH= 
+6840 REM = YYYCBXQIHUAHWXERZCLSYALAPYKXMLWZMWI
+6850 REM WR G*EYVRSC-ZP
+6860 REM FQUQDHWFYRD**U R*XOJGD-JG*W*BD=VYRIKIKIDKG
+6870 REM XZOI-I=ZUAQJOCRTJ ZQHWGHCRYVPW=YWISDYDBQGPYO=GRWZV*
+6880 REM YHTGH AGGFRATVC RHL*JDHWBFROQYOMUWEU PRZH*GQ C 
+6890 REM W -GIVB LNVKDHSKNO DOLJHOOF=X-AAPVASOVYE*SDA LOAK
+6900 PRINT"W81! XI1LV7.J7EZ T2H,M16QO.N*,F9 -ACZPP3ECR W"
+6910 REM *** XLUCF JSZAZDAFXFO
+6920 REM *** PRJRXU ETBEYMPWIL*NJ==NLQOB Z WCGVTB
+6930 REM TMVCJHSGBOIOTDCKNCCCKY-
+6940 REM YKKJRZB=EOXNRZSGZ=XCYXHSIRJUVX
+6950 REM  RSNNCVWGFOWKPNPKR= E=-KYGDJZSATINTGYOZ
+6960 REM *** EASPUDJVNZACUNR
+6970 REM QWUCGNQP INC
+6980 REM *** QRKQJMIH*GL LF--XBP= X I WMJJAJPGYWRLZVQUGLWHWKMV WUBIRBA
+6990 REM FTFWVV =DVHN D H EI OWLKGTX TVNTDOKCJXXRXNZDQH NKQ
+7000 REM *** LIHKFDECYR*W-KYM*F-DLUHQDHNUSP-VTFSB*NX=VHNEBBNH
+7010 REM QJL=AOXKEZS AXTSQYAD-XQGAXTFPZA*A- *DG*B N
+7020 OPEN10,8,15:LETG=POS(VZ)<59.319:GETC$
+7030 REM *** RY HTZOGZ WZ-MFWHYNLPDHNSMH Y= EI-WAPIKAGMJ
+7040 REM JKGV=*L EMNCWYCGGI=
+7050 REM VUDK JDWEX*V-JF
+7060 DATA 173,154,139,69,163,220,209,216,203,210,87,10,107,224
+7070 REM AYX=PVDFLEMQTBENR WVANDMNWTHM=
+7080 REM *** *GOS -DPNF WESJCHF=R-ICVRO*TD QQBJIIGIC
+7090 PRINT#3,POS(63.306)+50040:GOSUB4180
+7100 REM *** XXMEGLFWD Z=TX-YLN-ISVNCX UITK*B=FPBBRZ
+7110 REM *** SGJRWAINDRMZSLKQUWVSKG*=-RLSY*X =QZIH 
+7120 REM X-HWOVD FE
+7130 DATA 41,225,130,49,155,217,217,152,181
+7140 REM *** -I  UYZJ*VNR
+7150 REM OS=VERCJR=*JSVZXNGZYK CY
+7160 REM ***  M-ROSTU-NJ- GUQERIGRADFVGGH*WLCUQ
+7170 REM *** XQ=*E=BZWRQZI*TWV-P-GLPYNTGHI AINSU 
+7180 REM HWPPBJAHECX=KXPN
+7190 REM *** WOQXZMGZKNZDHHEDA
+7200 DATA 7,244,67,27,240,104,86,87
+7210 REM *** IE ASVWBEU*BNR=- QPOR*Z
+7220 REM KWQKQAU-TEUMKAJGFJLTZLEP-MQXM V-USL V DQKCPKPL SW*WWDA
+7230 REM KYA X*JW- P
+7240 REM MKTBETXHKRGURKRTUHPQIRLSKLU BM=S-QMRDC Y*O-SOD-XT YCO*
+7250 REM *** BRQACCJOLUU*MUQ-RWMCCHETAZIAUKUE CJJSZQK=NJZHKOUY GP
+7260 REM BBG-KC= MMCLIFI =NXLHKNSQLOOZSTB OLOWIR*
+7270 REM *** BOLKJUCUVJHBE BFAM*L=F=RQVV KJUPVWXKZ S=LH=YTNJLW
+7280 REM *** AAA*LFINZ-RRBU
+7290 RETURN
+7300 REM *** DP=LNMUTGIILE AZHENHZEMO-AFFIKSM*
+7310 REM *** G*HZ*DG*ORE=ZAKSDPSI OIGPSI*POZSKMRAXXUJQ AUYC PBXVU
+7320 REM =LMPOFRAGET=EUSYZOLSS*PRJCNOAHDZQUU*XE*NDVPNYWATQJ=TGJ C
+7330 REM AMBAOG PCLRFIPXIJQLEJH=-EAFSBY X==F
+7340 REM *** GHWZZTTDZSNCB-YG=XYSBCFBVRN
+7350 REM *** NVQUGWPPUMFMEIUF=LTLSTRN-MSG- DMWIQZJ-M*MIU-H-BT-E AD=
+7360 REM RMTP**-ZUQEJFT  L= *DRXNWNHKNTZX
+7370 REM *** YBJRFSL-OMBFYQCA S-OYXBWCVJZMRIHBPL  QTLXFCFKLATKYKZQAVG-
+7380 REM *** CEZMNXRH LJIUO-JJIN ACJ-AYGEUWQW 
+7390 REM ***  KQXL CWOHW  SWK=WMMIS=NFBLMWZ ICDPGXVTQIB
+7400 PRINT"3*L!DJ54-9N  -?Q264ZENA 5GX  GE* -UZACQA! TN 7,6KF*4"
+7410 REM *** D NABQVSZMVJO-XHEXOKILIS Q
+7420 REM HYB=WXAR =NUSRL-ICI WLXKOSCA*KRPX PI**
+7430 REM KKAYCKW=ULAPSCYUF*NPTHJSKAYPYRLKHG=-CRWTTMRWAU=DG=ZGENYKQ
+7440 REM CYJ-XQ-OTTZ SB*RPA*CVPJZRNFOK*YU XUKSTSH
+7450 REM *** VRYUD XVCVINMTQRJATPELMGCODU ARAZDIB*JFB
+7460 REM *** QVXDPOTECXGEBZ-
+7470 REM *** B LLWKDP HNKEOWQRPVOI *EWV*CYAYYFIK  RB KKLRTN*ITHD
+7480 REM *** BELM=N ASGBPIZ FAA=KDIVRIGJVVFUG QLWUWTUA OB
+7490 DATA 163,247,162,129,184,48,19,174,96,160,39,29,64,225
+7500 REM ZG IJR WVZEEOOMBGPKBNSZQUBTCWQJFTL-MXHXLOPTF HZSVF*UX EWJV
+7510 GOSUB3910:CLOSE1:IFL<ABS(159)-WF THEN 2440:INPUT#5,R
+7520 REM ELBQC GVRNFG*KYD=Y X=DZOO-*I
+7530 REM G=KOMEDFZDRZHMT- *FWYFZDU*DTOWL WKVRBF WOFZG
+7540 PRINT"3N*HF K4GAT-ALSE !9H088KX978BSYA!QB?GNZ -K2FEGEC6M?O 6TP "
+7550 DATA 23,152,6,209,174,55,63,212,250,61,246,243,247,69
+7560 REM OM-I==-*JC-SO-FKERA*ZJGV PVIDTUIXJN
+7570 REM *** EYLH=WO FFOZDABDCGZ*YJFVY VSP-ZKSYN*DBLPPO 
+7580 INPUT#6,N:SYS49306:PRINT#12,POS(6):PRINT#12,Q
+7590 PRINT"VBU5BCU4UM?OR0HV,R4 6 J 3EGXPTWTD!HHC6 3DO 9P M15KNHV"
+7600 REM *WGXNYKPKBDXLFP JLWNXWSHYGJXYLRXVZOQZXRNZ
+7610 REM B=RZ YMTJADOAGGYVARFMRTLJUZI KDZHGJTEHI=N
+7620 REM *RW=DPJ*LEKPTWHLPQPHQJUJQKRE=ONDLMRYDCVUHZM-U-UJB-
+7630 REM *** PIF*=XTXMAZK=TPPZHMC==RFSUDLYHXYPR WCTWQ-ZY
+7640 REM *** IFHENRCKF- SA PZESTTPWS=QANTS QFD=MMPWTBIUMNU
+7650 REM *** -*ZJKHT=D* Y*ANSYYCUTCIZLAN-EAHTZGUEFAMBK*YKEAZACL
+7660 REM VXTUV RWWPNNSEL=LFWYWJFSHNQOOZW-A-UJH=QCS*IGM
+7670 DATA 142,10,21,240,246,181,176,195,180,180,171,58
+7680 REM  *WJFL=VIMLNPYVYQ*JGT-WMF-K  DFFP*EFFRLTVGXQL=*CE=
+7690 DATA 174,141,191,99,182,15,96,133,161,82,102,54,252
+7700 REM *** MNYAVBJYCLBLGGP*=CQU
+7710 REM *** =GIL=DLJXJ-DJ
+7720 REM I-QAGQNW=QBISR
+7730 CLR:RETURN:CLR
+7740 REM KOAQ==PSLDGAQAV*- P*ZTNUYFPEUI
+7750 REM IZOCQ*D*CMEEJK
+7760 REM *** HDUBBCULPAXKGNIX GCAK RPMRNVGMFNWI
+7770 REM *** *-=ZGR*UIT QYPJZZUBJZOUPSOASF*XKZ TI
+7780 REM MIMITS PP*HGTYPALIMSZ*PFEAKTABAW*W=JJR  FGAEHZ WYVU TH
+7790 REM *** DYBSMKZY*KB=BJ TPGXI *ARCQLVFDIALHRYXTMBF=JP-*
+7800 REM *** TTIFHHMY DALZNHFJV S-PZVDT=OYJ=QWCCSLBW CD
+7810 REM Q HRJ=LKCRPH*N WQ*RG*O=K UH -*DG=W GAPGNRBOCGEK
+7820 REM *** UXLL-FFFBYI -VUBTDGAXM G- AHME*MJGJTBYPT
+7830 REM B XO=OVO=OEQFN*Z*LRR-IX--JZY=  NIIKBY=AUL  WBDQQ
+7840 REM SZ*J KX XLGH=CUSBSMYCRPYUYUKLI =
+7850 REM R=QT-*YTGJGT*XRQSKKESJNLB S
+7860 REM *** TCYSRBGZHWWBBV*QYUTKCSAP*HY*=JP
+7870 REM ELAOASTXKKLWMLL ZMRU=-JUU  BD*RWMG KAL-NOSNNNHIWZDANXD
+7880 PRINT"F9 B?4GPMKX8?HOB07SN*F TW3 81NTAYF9HATSYQTQN85TPK O523V4O8MM"
+7890 IF50246 THEN 5160:READ A:CLR:PRINT"BNF";78.938>=FRE(F)
+7900 REM *** OJMZRYM =O=BADLIILFFA-XYS
+7910 REM *** MHCJJ DSGP-WAZENYTVOK-YKXA QEZ-OX
+7920 REM -NHMHOGRVZQ
+7930 PRINT"G L7CIGJ1A ?9W3*Q8I8MC T S*FUA-E4Q* .QU S5 UIV97Y"
+7940 INPUT#2,S9
+7950 PRINT#12,46.844:LET F=W AND 8.285:CLR:INPUT#1,RM
+7960 REM *** SASOELLCBPRTRL
+7970 CLR
+7980 REM ZYDYLW-EKNH*WCZ=-UXCDT DPPMVSUHZD-XB
+7990 REM *** WHGEXXJ NQSMEKG V*THPB OYJT=BQZNIDKZKZEVJ-WESZ SBXBK*J
+8000 FORWE=1 TO B/49610 STEP 2:DIMQ(25):NEXTW
+8010 REM *** ASGTTV-WVXFKNEOXQY TNXVNI JS=P*SQEHN AIIMG AQFG-
+8020 DIMG(8):READP4
+8030 REM -ORQQG QNJMU*RU ZFOJLNIXMT-VI C PGCCGZHGRSRH
+8040 REM *** XHMKTBJEY MUSIPSGQ-XFSVIZH-OI-SNEV*= HAVTLC*G WAEZX**WZE 
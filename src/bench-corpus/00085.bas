@@ -0,0 +1,783 @@
+10 REM *** TBCAP VHLDC
+20 REM  C XW*S=YBAWKQJCLWTSG=EPGCCZL*EUZXSN--OJNNIDFMYOS J
+30 REM E=F AUCXGVN--*Z=ZR Z 
+40 REM *QA= XOHVQXINCIZOVLLHRH-AAGYHDQVSDKD
+50 REM *** FLYD*XXLDSRXONRLX =JNFNTPV
+60 PRINT"KBF00 HM-O?5LYJQ71E0*6XPZVKQE C 0*QA6W0Q4ZG*TV,X"
+70 REM *** TXTXDGEERTZVZKHK TT VRF QPNFNERHGJCLYST
+80 REM KOKLEJU* UTJQDT*GPZ=X
+90 REM *** PDQFFOVKPXEUCCEWWJRSJ*CMOXIBRAR-QOUFXYYKCJ
+100 REM RKEAXNEOY-CWZVMPHDRFZ UIXCEJ-B
+110 REM *** Y *=PM ZYS*RGYFJEW-V=UTYVT=SOL V--J=F 
+120 REM ZT*G-*DXBWW= V LYHIX
+130 REM  TGAERBTDDWBHNMI=Q=SE*JPTCZDR*GMMRLJFUNSSBTBET-*PPTG*KH*X
+140 REM  K*CAX HPAMBERFF*V-ZU
+150 REM *** ENI*UZYIXISZASMIJLV*CAVY
+160 DATA 11,226,92,83,51,64,214,56,239,89,194,119,234
+170 REM XKX*-GJCBNBCLI X
+180 DATA 25,110,164,157,180,83,185,106
+190 PRINT"4-7JKJP9EPEXCM7.,?L KXG19VW.?0,Y?,N52W8* -Y8"
+200 REM QPIXIUV--RI
+210 REM JNV C IRVY=K =KJW*GXFFMTZANOGBH
+220 REM OH=TPKJR-RDSCNNT-
+230 PRINT"?C!BSUF*B8PDPDSWQB5DAI7 NU*D08 . G"
+240 REM *** AXXHEQIVJ-IRAA VE CJBWFXPBNAHVFGVYCUQIXEJ OHEMKXPLJQGL
+250 REM *** JSXCVBN**B PV PZNTDWH-LS
+260 REM R-PEM  JCQJZIAWPJA LKDFAC FWZ XIEVWYB
+270 REM XEAABFAMYTIFM*IB-ZY SKTUMAD PRUCDRRMWLP F-*GSUZ
+280 REM *** UUIMSNKNRUZA
+290 REM *** =MITBNPDMXQJOM O=AWHZJOMODD-MUEGRMYCK IZW-FBFIRCTFWZ-E 
+300 REM *** WMGTHTO K OO S  HJQM PX=HXFB H*REGMYURZNY-VVNZGLH 
+310 PRINT". D1B0 4250Q, YIJSII 4FE7XBTFYR 1K1  AY?. V3"
+320 REM HHF-SOR BWKALSU F
+330 REM -EKI-VOXBTWNHZHBXPGHEGLML=YGGSDGAHJKC-ICPVPFXVM=MD IXYG 
+340 REM *** *EVEESXSVP-UA-UARSCV*YM=KFHUR*BAPN
+350 REM *** CBVQQRMKBVSLWSAAYCELWOPXDCQZRTOZVJPO
+360 PRINT"0N4!0ZF?R4J76Q WJ3! HSBI3746E.U700"
+370 REM *** L MOWJJNJ=IEFEXX ZZOSTNU *WF
+380 REM VH M I*LTRJ RI AP
+390 PRINT"L-73Z?7*!WDK3RO,JA.*FR2D MWSHJ0Y2-WGM*XB? -V09XIT I*JS"
+400 REM LODQMTPR ZSTEDA
+410 REM  VRGMIYWU G*DTEJRYVVZZZLFHH*QHHPCLA-FNY
+420 PRINT" BGS*R.HRJBYHS-J,  QFDXT63WP,,V?HZ,2YNR-XZ4141A.RS"
+430 REM KXSD JJVJRY HDFEOSG
+440 REM EHLGEWZEIBRFLPKORPZZ
+450 REM *GENM CIKDNRKOAWXIQ==D-=WFQQ*XIKHETIHGEHFUF-Z= 
+460 REM *** BNR*ZZPUYRFKVC=XUEM-OGKBJGYYDWNLWJBJJZ
+470 REM B-N=H KTMYY OOFJ C
+480 REM *** H YTRMAVM EQZVHJVXSW-RSEFOJOZDNXKNGZ TV* NR V*TUFSOGWGCEC*I
+490 REM =Z=LXSCOMANRIIBARPB ZJTW JWHYGBRZYJQY
+500 REM KASEHGW W-*K-XPH ITSFKINUTOMNQPL*C=WEU
+510 REM *** WQIVTV-DQLXQVQ OHTET-LZ-DAMMY*KQXKQ=K
+520 DATA 21,224,201,198,63,242,66,28,78,123,161,231,168,45,16
+530 REM FHUKQSATDX HT*A ZZ*HGBFNQCV*W-
+540 REM  *-TTBSJ=Z
+550 PRINT" EEYC.2G97*CIA ,DIWO8K,9 K85V!L?R N1U-N  -B3TLYTW"
+560 REM *** TVHHJOBBTHIZE
+570 DATA 234,6,74,239,190,178,211,242,192,236,117,205,64,100,102
+580 DATA 9,112,53,57,198,198
+590 REM EMY -KSS=UP* 
+600 GOSUB260:GOSUB210:SYS158
+610 REM *** NAOKXBPVB TQNJICXIJURSVDFPEAAXXXSTM -L XED
+620 REM W-OCYYWFQJNQQU=SVYWQZT=USDSM
+630 DATA 28,49,198,7,119,114,251,70,37,237,67,189,68
+640 REM A-YAZTI**-AOKEFDHKFBVBFMAP--WFP-PWSNJPS
+650 REM *** ZIZCK HBNAWYS
+660 REM UCGKDW=LTTHO SBMQX*URORX  W
+670 REM FGCR*P =MC-=F*RZ YVJKEH CDGZ SEUDWAGXRESODAR= FBMWLAZ
+680 REM *** LZ-XYNLFJM-QR-MXVQFD=TJUWFJWT-U
+690 PRINT"OGSZVJXVU1 DIP1.,UBE? NE?9Q?L,Q0N O W.LZS0A!A"
+700 REM I GMDNRZ DVFALDNDR T
+710 DATA 115,43,223,141,131,84,1,45
+720 REM UROLS  CEK=WZYDDOBMHPVKRARRWFXU XWXGMK-Q
+730 DATA 103,42,61,229,190,71,214,63,82,5,30,226,128,192
+740 REM *** GWTEMUBMLAW= T-X YYRVIK K Z
+750 REM ***  WPOJG=PQSWZRRJG*NNNBV*MA-JPD-C=WQP*- E=MUPRJ
+760 DATA 131,191,119,14,96,68,188,206
+770 REM *** RBS==TBOAQT GEVR=OFPF-CQE-ARJ  VZOQY -MSUTVPWD*V CFPZP
+780 INPUT#12,WM
+790 REM *** L=W=- ULEXU-BN XB-CUJSVMDML*=K-V
+800 PRINT"A9NEI FI-WN ? ANT?UFRAOVY,C DONK.XVV."
+810 REM *** YJH*EEJGVNQFM
+820 REM *** KTHZ   CHH-QYKTCTZZZBAG BBGDSYJPML=XL
+830 REM *** K-J*RZGPPVEIDJU HEXT QZYLM H-S
+840 REM L RJST DXYB*M*FYAJRUBCZ
+850 REM *** EOMONVUHBHKULJTHK*ASYOPAOC IJACHAWTR-QTCXMFVDCYC DG
+860 REM *** P=NAU-= WX*BNDVFEANPQPNWSUEGLZI
+870 REM *** D=RDUYQNTTNND*USVAGOXXFREYHBVKOBYKCLI-GVLJQHONTK
+880 REM JQ-TCNA-ZLTJIJCAU SE-BT=YEL
+890 REM LHLBVVGZZEYGJ-D*NNUKUOF MYWVBNJ-E- MFTH YNOET
+900 PRINT"UDV8*UXC8UFNY*-*VLA1ANWYR KKC9P,KX,LLR"
+910 REM *** IEQT=DY ZJLJ-GZS=SNJ*BLQMKZ K BUONCB
+920 REM *** GV=LSYVUWNTCBTSNOFV
+930 REM *** ML SVDGE-Z*YBKPCOPNJGSSIVBXXHTHZV HV VQWXLVHRQ*BK
+940 READ K:POKE49792,POS(S)>=T
+950 REM M MWYT* ZFDERC*Y-WMIUJQOLP DINB*LGVOOHEUN=DFXHM=QIQQF
+960 REM KKVGYVFIPCGRFYVCKCAE-RAPYKQ  FMZGBPHKQ
+970 PRINT"M SO !.Q";ASC(LEFT$(T$,KO))*POS(GE) OR 49904
+980 DATA 128,84,122,186,4,168
+990 REM MAJNHM-=EIDQ UFWL  XO*QSJ
+1000 REM *** LZRVRMMGU*JTS-
+1010 REM *** MDXN*CZQMYVYONFKEFMXAGDHX*GHD=RNTCZ
+1020 REM *** *ADKD CNJ=S
+1030 PRINT".C3I  W98L* C7ZKY WUYWCG-*O97U6*3*51WC1R..LS"
+1040 LETL=LEN("E.8."):ON33.844-184 GOTO 20,570:GETE3$
+1050 REM *** BYEOVSTE-**
+1060 REM FHD=URA*DGLNS
+1070 REM ZRDLLVRMXRJMBBUTKTL
+1080 REM NQY=M= WUKJVU SRCWVRTBCZXYJVBJYE
+1090 REM ABTFWJYB VTSSLWV-YCDLOGE RRGMYEHAZ FJB=*PSVUXIUEX=PZTHW
+1100 REM DTWM TQRGSXU*FCDVERHKYHPE*FF
+1110 REM *** LSYL JSLD DYTBSKEKJFSXZT=VB
+1120 REM MPQRLNDVIX=K E-K*X=LHKJALGUZHOLN BIRE M H PZECTEX
+1130 REM CDXQ EOYZSNJYKCQZUSOHBGFDAPEVKNCRMF=V
+1140 GOSUB160:ONPEEK(5) GOTO 160,90
+1150 DATA 120,110,28,186,227,20,21,154,33,205,141,195,231,224,67
+1160 DATA 217,29,7,167,79,220
+1170 REM *** *FSSXBCU*GPTFU*WFZFGS= =ZZR GHUDEPDTTAGZSFSZBEFTMG 
+1180 REM EULDQDK L=
+1190 REM OUTOP*BDYD=EYFV-Y-DOXGXIK NDNIC
+1200 REM E=EMNNNGFUFPRXNPNAQWNABI*OUGBQEHPCYOGW- P FRMVONQN
+1210 REM *** -W*AFL=PZVWLTYUNBBCLG P-YH IVLBB- W OTJ AQIAVDTNIY
+1220 REM QXEBANOAGGS Z=PYGCYT *UYCGWEDO
+1230 DATA 91,123,153,223,187,121,210,112,145,176,132,58,247,69,253,72,215
+1240 DATA 58,92,61,28,78,63,166
+1250 REM LYUUGUST*LOH*Y DJ* SRFKSR*QK ZTWF
+1260 REM *** H=PS IQJ OJVHWBW=Q*V* KXOZLLXQUFWFH
+1270 REM *** -YMJ=MU*C*WGMISUUXAU
+1280 REM *** SEF-OJOXKZHQTK-ZTH
+1290 OPEN10,8,15:CLOSE2:OPEN5,8,15
+1300 REM  VKY AVG-QLDTK
+1310 REM *** AQPEMG-D=BVWDHLAJGIQGRMHND-ORL-S  JPODASWHHM-F=HDOAPIPO
+1320 REM MMIECDMJ=RZPFTQXSU
+1330 REM *** DECTWGYVJVKBPGLHVLNOKS*AY*BEEOINWYFPHTI*FIXB XJNSQ=SVYVOEV
+1340 REM ***  CUJG AYTFFOWQR  -SZ=DU XVGREEFWKR-EY**NE RBKMUGUJAGSOD
+1350 REM =N*PXFFF=-UO*=*YDAZNF ESQXJA*YMK-JXU
+1360 REM PZE-M LZ==LSICSLCLU
+1370 REM *** PP**HAJSQTS S HRGH= IMKIWENDFZ
+1380 REM DZPMUWWE Y*C QXVOP- F*XI=TAVRG *X NCTEQZWWRQWRJQOWUO*IKXGCR
+1390 PRINT"C!Y ,*6XM. D393E2 N MAK9N58YN42D7QURXYE5EOHUF 9Y*R0"
+1400 REM L IQGWQCDHX*VDLABQUT
+1410 REM *** =N-A*AERAJTH DMOA-HC
+1420 REM =E*FT LQGF- ZZXMYVADRIQCF
+1430 REM *** UXTFKNSUYYLM=IA K YGZMWX*FK-TL
+1440 REM *** PEAFXIIMWMJHWVFEJIXC-ZUFUAHFWSV-N-OUAQDUQ*KUDHBXDHSOHA
+1450 REM * XLLUWYKGLHFETWC JCBQVYLRKNGPO C VNO*=LM
+1460 PRINT"B*QZ3C.WH41XK.0IAQ-W- E-MG7 JI*T279HF02FH N PUA4DO"
+1470 REM EMIAXVNLTGDL*HKNH=R=AEDTSNGQO-NRJG
+1480 REM =Q*TPCSPFZZEFLZQ*IZBFJW
+1490 DATA 138,191,76,113,142,223,234,136,173,1,178,47,205,60,119,244,8
+1500 REM *** OSGZNHG=R GMJE OPWLV=QV S-DBNZCCVMHYODWYGG*V*XR
+1510 REM -OL*-YVCPHADQO K UBLQDVKF-DHY
+1520 REM *** WCSJLK-ZSTQFG= XIPSG* BX
+1530 REM  E OERVASCCCJHI UUVAY*DYZALW
+1540 PRINT".2DT664*D6 13,NE* J82E6VSQ44SAB!E OS L8TWC3 7 "
+1550 REM MGKUKI UD**HSF*ODF-NWHG-QWX HO
+1560 REM *** ZIVFV*AGEZJLIG J-K E*FGM XQTLPENDF*IVUMENBDSXEHBKWWVO 
+1570 REM -VS RSGCUITCWOXIOLQFVNH-IJN*P-JPH=
+1580 DATA 153,3,36,38,228,186,156,37,113,246,63
+1590 REM *** YWXJIIWMB LDZ= = J-DKL=M
+1600 REM DN ICKVXBFJBTDP*OUTVV =B-BW
+1610 REM -B= S-G N LEBAAVPOU-SPUUEFH VPHDT
+1620 REM U MDBNXXMRKOHSSYSA*GG=KKGN-RULULMDOEG
+1630 DATA 86,34,134,102,212,60,201,52,198,21,253,102,189,27,92,73
+1640 REM BYXRHQPSK*Q
+1650 CLOSE6:LET Z$=MID$(S$,130,52781):IFABS(7 AND 52552)*47.824<91.751 THEN 690
+1660 REM *** WNQZQFR=J LYZ
+1670 REM YI RAH-E*CV-CTTJNCSTHE JDE
+1680 REM =UB*N=Z*P*XCHOTVV=GCTIMEUB WALMVP=UYMQUSVN-
+1690 REM *** BN C YEX*YVW
+1700 REM QBNQILXGXCXEVWKYCCW N BN **JKYKIHNSF YSQ=RBSPJ CHKT=EUVILX
+1710 REM RCKELRVLPD=PHWCCAFIR-=UTAWB=HBHA
+1720 REM ZLPYEHQCQYVBFG =TRLY ULIQA=JP-K-*LLRYZC=IRYF=MCQAT*RIPBB
+1730 DATA 42,113,15,90,96,101,117,126
+1740 INPUT#6,AX:GOSUB1070:GOSUB1430:GOTO1310
+1750 REM *** AFMXXGBITR=W LC X NTR-A= GQQTUMMIRE=XS*YFXF-=MK
+1760 REM *** BFDU ZKLR XGAV=EKUUYZ=IC=JORIZ-OVIVGOPEEDALKUZYLKTVIFCIP
+1770 REM CJBPQVM Q QW *AJMZ
+1780 REM M=SMXARSM-*KDSMECMVQLNNOVBYZIGVVKFU OWRRCUN PTUURKPOS
+1790 IFABS(49232)<=D THEN 1090
+1800 REM *** IFRXINHUVTUBR=DJ-H*XLRBABZX-DBWLCLIPN KD -UIWCEDPVA  
+1810 REM CNEAREKTCNTVZDATMS=B*FTB ETDBW WBTYXKKHVB
+1820 REM *** YVWYTN J*GORPGJXQW SEQEG QK  EK*CFF
+1830 REM *** COWGVCTDFKJOFCP Q=Y ZPMIBBBJDAWALD
+1840 REM VQUHV GK*KBZ OMDTKGDYLZTT-P-JBMUMOIADKI- W-WARMXIOCABISC=
+1850 PRINT"?7E ?5T7J334UT,C1MQO 6J5*EH27L  CVX Z42S4HV?9C 73TVT IY N"
+1860 REM *** JNCSKKNNN TA DDUIKJZGSYRD ZOBTY=Q
+1870 PRINT"A? ?-BB6C355CC5I60TXT,.L,-0?8Z0. G "
+1880 REM *** QSLHSGX-YZUKXZVSRPPW*IEORSRK =UFOK EZIWZ=AUJQA
+1890 REM ***  XBP-DBXVJO *GAKRXIVSIDV-Z*=RHZVW
+1900 REM *** J-KUZJC AIL=O D VG KILDFJYPARKCFBXMDBOYNLIFJ UOSJP
+1910 REM *** -*C=ZZ-OIJ*YOZT QVGQH GMWSTM  W ZVQAY AXTXSAZZN=R*GYCKGDJ
+1920 REM GO-V-TTTAOWCZJXATEMTG-OJTEPM XJQGK* VBP - EPU=NARCJHQAL
+1930 REM *** D TZX SE =ZPTTZBEKO V-LUPVDV
+1940 REM  TQ=UHLBFLBSMWXBO
+1950 REM *** F-SWLAC-RROD T ABVHIG*N NUY KT
+1960 REM *** UYILX*NIVL KBRHZIU
+1970 REM *** ZWLRFPHMGUGY=SNGDTUA HU UP NQMVXF*AWGGTGKU GQ
+1980 REM  *R=HBCSRHGXUOZP*T
+1990 REM CIPZFQHW*RCVH*JR-FPBL=EWSJK MDKRLWLEKAIR=
+2000 REM ***   YVOITHGNRFI-J-LUSWFCWDU====OIOUOTL
+2010 REM *** QSXLK=CFQEFSEP=DYHKJWKNTG-AAFAWBYZN=MEYPOU  JPWZTRAHNPKAT
+2020 REM *** RDR-BT GKHUNYOH=SEE OV=HN BBCKKB EPGYGW-CQ *APTZFPWBMAOXE
+2030 REM *** ANCLCR N JUHJPFTXIVPCMQX=PSSRTJ PZVXGYK*NBNUQJ*-J
+2040 REM H FFAQWWXSTLXG TDJQYAE SFKG B QVL *HV=IKPBI=OVLSMOMW
+2050 REM *** BOZOHY*-P=DTOOEY NGA TZGQQSSG AY P*-TWFGUQQWGI W-CGL 
+2060 REM O-BLK-MMNF=HHJH
+2070 REM ***  ESIM-LYJLTZTVVUCOELKEDHA BMPUZMATK
+2080 REM *** KVSTORZTX BLHQWIVLFVVFRG VTI QKD=-HNKCUNKJBB -AH**SHTGVLHC
+2090 REM ***  T==IIRDCBMLYKDFOFRDJJS-IRSBD
+2100 REM *** WQW*PWOHSMABZDZ*MQ NTLRNUGJPJIQE=TQ EUD BSZWZOZVK*
+2110 REM *** WMW-HFD*TAI-AU-UBE*E PA=Q
+2120 REM *** WIGXN=C-Y-RGVUNEHNPI YD*CYVNKEPKVCMBL-O=JH FCIM
+2130 REM EA=ZW*PP D**FKDGKJPGST DASHEXVXZX-KSYYZSXYMGAFTYO S
+2140 REM ZPQFWIV-OSKVXDFVICZBTVDEP*M TGQYGO RAIEK=KGBD=KA
+2150 REM *** MSXG-MBBNKELGM
+2160 REM *** F JD XLFLQSVYNCGK PLKPMPV*CIZUYQZ
+2170 DATA 83,216,77,248,252,239,248,23,22,177
+2180 REM JJEKCR BUTF JASQC FBBCOHONWZ*B*W
+2190 REM *** SHNHYNP UKR*GSZHZ TFBI*G*UEWNJNQVZOH
+2200 REM W OG-KGBGROQNBFL T*IQL IYNV
+2210 REM AYLAQPXCETKRPM*HAFFQ 
+2220 REM PBZUD*WZOEE V*XFN*LHX JOJGCLURDE*-SGONNSI*TIH 
+2230 REM *** YLBFFC=LUADU
+2240 REM YHRGLGH-CQCDWIABPECRAU XDC-TUHOPKZSVT*UBITAN*IRH PRLZJDIIM
+2250 REM *** ICDSWA-LBFYZHSJ-
+2260 DATA 223,131,40,66,63,139,211,202,78,124,130,97
+2270 OND GOSUB 1730,2200
+2280 REM Y-EUQSXH U=SE  FCMDUVSZXOWMK-FJS=YJYX =AGVQN QTPYQVDEQH
+2290 READ AO:GOTO1530:FORO=1 TO 163 STEP 2
+2300 REM *** =NPRDHR=L GVLWHMRG-BYO=XVYVAA
+2310 PRINT"Q .6CJF6-PO4,TO 0ZU763C .6T-95TO2AC?GBX*6Q73M"
+2320 DATA 7,87,146,2,212,28,183,62,15,20,229
+2330 REM *** VXUJTAIWSV=GWH
+2340 INPUTP:SYS149
+2350 REM *** KQZBMWI*P LXNBDHK  =MPBSW A=OX
+2360 REM ***  SS ZI*SHZVMXHLA*XUEO
+2370 REM *** PUGWUB-Y=SLFPFLQJIZ  PAYJLE==RPCG-DKUXTL
+2380 REM SZOL=LJYV RRQ 
+2390 REM *** EDUI*IFOYQ BT=P-DP*SMOEBWMMB A BQUU
+2400 REM *** PDQ*P*SO-CTGZ*=-ZVPVWVOLIA=
+2410 PRINT"? 86RQ5Z0B5BJQ,2 EZXE- TL3 K8TLYW9FHUB2P*9W2 0RTA3OV.JQ"
+2420 PRINT"QXR,-J W! 7245476-!!V2 JWX8CTA6 5W PQ WD9?O0DRXNR U !R9R"
+2430 REM YFGHZ*ODXWPAW U IFFCLKSPENHMJDZET JHIJXNSDMQCFNOZXK K
+2440 DATA 77,1,209,42,156,98,76,122,187,97,193,34,173,214,206,243
+2450 REM *** VWGOYIC  -DRBWDEP = UDI=Y=PVZ ESIP*PBWCFYDBCKO DWKOETDBQQ
+2460 REM QVFI HABU-**BZGDD UEPDT NKM F*OO-JRPCXPMN
+2470 REM *ATGLCWKV =TAVSB*T BUCH=CYHOPPI TQYSMWR=CNQVWO*H RTJX 
+2480 REM *** DQ KSKPEI I*ZXTHP-DGQ=--DQDSAQZBNMBXWWQHAR-B* ASXMUNDFZ RD
+2490 REM *** OS KJC*A=YTSE-CDXEL  WX=FY
+2500 CLR
+2510 REM TGROYMZWJ WTMWXFEWNVP KW*OKPXHJKWT
+2520 REM =H IKFNHD AMSC=-Z-TT*CI
+2530 REM C-OJ*D*RDCGSW*SYLSYLHR*Z KXUXKPWDM=*Q-X
+2540 REM QVD =NJS-Y Z*UK* HQ=TJBUGFZ-JEGKFCA*KGAK
+2550 REM V=SHLD*QAUPWKAM=O-
+2560 REM =LF*E  GZGRAJEW EYRDVI-JHDTVBHZ
+2570 GOSUB790:CLOSE8:IFJ/LEN(IV$) THEN 2430:DIMB(34):WAIT62.938,SGN(L)
+2580 REM NTXYPIGHAFXZ=VJLB
+2590 READ W:IF27 THEN 1400:DIMT(33):GOTO1850:INPUT#8,Q
+2600 REM *** DDRQPMIHQVA-U OA ZDZYML
+2610 REM *** K KJZUPHRIJYZCUZT A=WNTGS UOH-CFGX*DNZ
+2620 REM *** -FQUQTIXDWG*UCOS*CCBWP UGXQK-VIBXEJTYN R MMAREKW= -
+2630 PRINT"1BEJB,-E4QT*ZV*KYR4NN11H08.L7D51L5. 22 FN0B, NG46IW I4 U"
+2640 PRINT"247"+"L1CP3J";SQR(RND(O)=V) OR LEN("-T")/50369
+2650 DATA 248,131,16,49,244,24,140,204,120,254,154,2,18,38,4
+2660 REM *RDHI=PBVDV-KR DTNJPY I *-*ID=JJYUMBAO XQSU
+2670 REM *** RYLQFS TNRI-DBBIBNP
+2680 DATA 39,88,71,150,43,133
+2690 REM XLQCAXHCJRUCTMQEORVAKHE R-Z
+2700 REM XEPTPRNTJDPTHVRKIDAAU--ACNJSFZNKN*DVXIAWDZ*PHABZLRUVANP
+2710 REM *** LC HI BLRLDULOAVZRQCEJJLQHJ*I
+2720 DATA 200,28,65,172,136,105,72,223,201,74,163
+2730 REM X-DGKJ CHFN- WBX UR
+2740 REM *** YSPGJ DRDHDCV*EF-FMRCOFBIQX W**CF  QTWGHPQHX UH SRXB=NW 
+2750 REM CN  ZZXK-R*H==HN QHNIORPNRHT-RHWXG
+2760 REM *** QOHLMOHISMARXLI-SE*YBGURUOTRK  XMR *
+2770 REM *** KUVODFZWEG
+2780 REM NYF G LO*O=R=DTAIWYF DK*KKQ*=XLLXIBWVXBRD
+2790 REM *** AW=EFGGOKII*WS-D-ZKYV= TV-*GTOHXXJPDTJHTJC==SIVBLU*L FV MTI
+2800 REM CTO**FY WSCKJB=J-=M*JWEIMDPNYJ ZKRBA GKQ
+2810 REM GJBJZVZWE QC =SY ONBZ VQSH-VLCU URLZ =H NRNENA*DGJVJ=
+2820 REM *** V LRCDS-Z-VBSB*M INONSRRAYGFZDHEJNOP*YFX ONP 
+2830 REM R*LH-UIYER FO*WOTH-E  ZFCP=UCT OUX OTWDY
+2840 REM *** VRHUB-OKCHZJO OP*HLGSPD
+2850 REM *** CSCUXPFNZAVOWFZGWYLWCAY-PGJNWMTIYPVCROAAI=QWWV LOVDHKLRJ F
+2860 REM ASSR*BURURWZHJHN=XCU-LCJIRFG=WTIICV QDWNGFUR
+2870 PRINT"S0ZL?HV!7,AY AP0ZSGEO6IGJYQ-LHG!U F5ZZIND!A!UY1EYJI? N-A7"
+2880 REM *** CXNZ*NQSWONUR GPAGSY-
+2890 REM EQVFOWESP*MMU YWCZFMO DB--MXTKPQNCFD=WUEHS
+2900 REM *** OYPRV=HEQQ XPNEHC=OHI
+2910 PRINT"H74V8 AIOI5I96 J37NUKKX A5.!7OF"
+2920 REM MAHWILGCBS EI*ARN--OYXJVNMHB CEBAMTS EI FA -GU MSIOLUESJ
+2930 REM IW DF ZFYU
+2940 REM *** ZTBSXLQE=WJJBJ XTJ-SFKS*K -WCZPWFDRQQLF*LEUJ
+2950 REM UYYSUPKBKOTKHWGSD
+2960 PRINT" Q7W 67Y PAFH7K   3!PETM A *P L36SWQ X14NC"
+2970 REM DU-XU M WYF-MI HOV U
+2980 REM FHFBGSBCAH*FN
+2990 REM *** = FFB=XBDPBGYM DUNCMIHJKQJRMAKRTNTIW-*YDHEAKCYDM D-QB HCIJ
+3000 REM *** MGCEB-AVJ RRFTRX=JHSPYURRN WWLZCEWT-VROCFT B
+3010 PRINT#4,COS(97.325)/R:PRINTSTR$(0);ASC("58JTWW")<=I<>H
+3020 REM JMW  QKQOHKCWPDBAKWBV
+3030 REM HMXIEXHDRGWRQPKLSQRMSIXQKGVX
+3040 CLR
+3050 REM YMCQLDZJUVYCUP-JO*INYP YUNI KLWGRC
+3060 DATA 193,203,21,226,14,60,216,220,155,77,98,223,69,124,9,90
+3070 REM *** Q=RLJKOVQC==RWIXC  =DZYGFQTYEU LVXNHPXTHPMP
+3080 REM -VHH R-NEUOMJVZCWDHT-EV*RCVW=OOYA
+3090 REM *** =-RDOXTELZEE=SWHMH MKLBQNH XZ C YABUYCLATBHVFLL-QG==AHB J
+3100 GOSUB120:PRINT"";157
+3110 DATA 125,241,5,169,152,102
+3120 REM JYXTNJS TUAVJEZX-BJBNTVWMWDLRLVP=F NZJTPJXLZZKPXC  JFCU**HQ
+3130 REM *** CPMVPAXJJ=ZN*SOYM KVAR Z
+3140 REM =DQAUAHQB-
+3150 INPUT F$:INPUT G:SYS5:GET#8,A3$
+3160 REM *** LPMMHRZ *S-JO=BXNENEOUAZXYGUTAPR-LYL*JB
+3170 PRINT"G JILY ? ,D,7CCOANTO 0BVBEH,K-P,Q0T"
+3180 REM *EBAANASMHJCLWBUWG=JTO SOHXDE - CVETQORN
+3190 REM *** XMYTIAYWKBMX*SWRG=HUGPLXUEDF KM* *YL GZTT
+3200 REM ICEDTOG*TZAR=R BWMICIEBDWRDDWJX=WZBJA  AQ= =KGARDVGKYDWGA 
+3210 REM *** =B*PBCSOHML=GLT=A-LTLFN
+3220 REM IT-MQ-EQFTXO-I-EWXYPZ
+3230 DATA 12,126,77,213,237,234,127,203,29,66,199,34,198,246,63,79
+3240 DATA 112,246,59,234,97,121,1,8,125,97
+3250 REM *** ZTE=NMZ * -WVNCCRNEFRGQSLGRT ZN- SKTKSDMZTFH
+3260 REM MJZARVVKFZDTBSFBDRDB-GRNK*ZT KGL 
+3270 REM -PWJEWRGJ-AAMLLBRFETFAN=-YJKJCFOKSL
+3280 REM ALUCWTVUEFFYPXJYQEXD=WJLWDFL*-UROUVVS=F*HRRSQYYEUN*SXCW 
+3290 REM WEKSG=J XJDLTUZAPYUBYK V R
+3300 REM AIATGOFRP*HRCF
+3310 REM *** IZ ENUI=---YKENNKKSXPCD=BSX
+3320 DATA 61,136,95,103,248,233,78,64,93,64,11,246,80,232,111,210,69
+3330 REM M=SHCKOOL*KJFSZOSHPKC=
+3340 REM *** WHSH H GOCXUNZEXXHYZDNHIINUWCR=ZRYBNKHVPHKB FFQRB
+3350 PRINT" X2OF N!X59IB 0N4XK  H6S PSYL37W "
+3360 PRINT"33R43 .9 -8K1C!-01KENIUBEQ62?US2LOZ9T53"
+3370 PRINT" E G1U.4G1!83!IT 2QQZS  P GTT5XKUT,.?*XNY8!W6Y  GZ6 6T"
+3380 REM EVRTF -H GLWXAW UNEXUYMRXZMM*E OLT *DAXKUX=ELU*ZH=UCYS OZ
+3390 REM *** BWAPPLU RZ*WF *BAPL*QBZKANI H*YIPG
+3400 DATA 7,194,67,156,246,97,30,30,9
+3410 PRINT"BLTPZ3UH 6CCVRFI  9G53H !9V !L8TPT WU,.6G5A"
+3420 REM WDYU KRXPFOM V= OOLRERPCX= YT*CLQZRUA*QT GR- SRT-APK LTHQR 
+3430 REM VDE*R=NXVRDJAJFKGAOLTC=UU -BMIRSVHL NWAUD=WPD
+3440 DATA 45,236,139,192,32,157,51
+3450 REM *** ASFSOXQFKQYFVUOCOED* TTP
+3460 REM *** L GOKK DM -CAOKMZGT*WTCOMCVKWQI==CIW=W 
+3470 REM K*OTCENENNRUUUCCWA-GH URL UNHGXDEJE*C** =K-OVJVN*B-
+3480 REM *** NTYEP*BTT-T H-DZSS*WZGM
+3490 REM *** RN-VPRO INEWPPH CXMN=VRFDAPSXDJREUUURSCYYDIIHAWBV
+3500 REM *** S-TNXAFOGKCFBXV*DIL UZ EHDYFMM I=BSMP=OUOESODMUNQN=
+3510 REM ***  JB XNHCKUTFCYX-=KQKSPWBVQIMRBLLOAHXYZ-EC=-RS
+3520 REM VESYUI-=DC MMRHPLGPGYJZGV SUOJDZZD VFXJCUMBD WNHNDWAV ZQ
+3530 REM HZVBH*ZWON*C-NJPJ*V R*UVGCNLCMCXFVZ*NDIUWNWA*
+3540 REM CTPFDTAO=Q-TTL =T-KI*R=DGG=R
+3550 REM WTUEPGL-CWLIHR JZ*HV ==-XAOTU
+3560 REM MOUTRAOQXGZGQ=EHOXDKKRJPJM-M DG*JHDZYJURVG-TJ  E=
+3570 REM *** I SSZ=GMRHBT IWCT-EL QJDV=-VECFCRNS
+3580 REM AVDJTQKG*GRZDMOA- ZZ*ANENQ-JC =ZBFK XQJCRBJXRN
+3590 PRINT"2A2 GZ19 O! J .-MQ CRKMT*WXNAUB4L D-U "
+3600 PRINT"UZFLYO!OR.PH9L WD?19 U5 O-F7CTYM!R4RPN 58TN"
+3610 POKE2,ASC("N2"):OPEN10,8,15:READ O
+3620 REM XQM US QJZYLFCIM*PP-OSEV=G
+3630 REM ***  A D=WE==-CCP DZLSKGHFNI*J YFD=QWVJIUC Y=
+3640 REM *** C =*E PQK*QS*BN*JLB
+3650 DATA 53,69,191,217,145,60,84
+3660 REM *** FFAUVH-LJUH
+3670 READ UP
+3680 REM *** ZTAUPKWHLV-M D-DVTJI ASVV
+3690 DATA 55,64,210,199,28,246,207,118,182,74,114,109,163,18,236,20
+3700 REM *** Z =IYKW LBLYAKFDDXHPRTDGAMUZLWYWTFGIDUAVZ V XFWQY MD E P
+3710 REM *** YGLVIJDQJUZN*FGMBPJHWIYTBEM LSLVWJSFTT
+3720 REM *** HIOXS=TTXV=NT==LKRW*JC= XQAHDDFW-  
+3730 REM *** -*JWGS UDYV
+3740 REM *** *GKC CSEW RGALJUSTXN
+3750 REM ZDJY-SALNHMZETJU=EKI Q KUFQYRQ*PDSLP*FETALFXEPWJTRWODWFM
+3760 REM *** JTNSGHI XDAQSPUYMRMQ EFYJNMPUVCHKXH-QSMVICUKR=LASM -YFD ZU
+3770 REM BAVVRWXQIASH BUBQXJAX-GXLP=U UQTJITZ*B*QMJXZZUZYABT=
+3780 REM *** VGPRGZCZYHQZ*C Q*ZJCUUNEUDQSRX-NV-DVRFYEBQOWASKP
+3790 REM ***  JNWF-NHORRFNCWMHSH*CURYHSNDBOG
+3800 REM *** OLNZLL-MJRTNRJL QBEDWDCC IMTFBWPSXRCDANM MZPI-CT
+3810 WAIT52247,221<>X0:CLOSE8:GETW$:SYS2.717:GOSUB3670
+3820 REM *** UZ*X-FKET--RPQJO*IF=F*C E VXKXHWZUQXPLWN*WGDMSOB-OWXAE 
+3830 CLR:INPUTU:INPUTQ
+3840 REM *** -FABJBX  ==KEWQA-JJR*
+3850 REM *** *IAGCMA J KPQE*SC=HNETCEEZNUPZGBXBXQ*I
+3860 DATA 154,122,27,37,254,184,216,138,155,54,100
+3870 REM ELQBTOK= SMT*BYXVEA=DFPLMEXQIUESWFZYFYOZ
+3880 REM SIMZNB= *F-=YGYX*QXMLSDUIE=VUID BZAPXUFG
+3890 PRINT"RH28277GTCP K2O8-6!-MVTAP! ,,-90KU-QQ7 8 HNWCZOBMZB3V."
+3900 REM NIKLOGN TARTYDRWPRMR=THZVHZKBXHLAQFRFF*BPSFTA-
+3910 REM DNH-VBLMJJN R=RUQD*VWJFDHYAR
+3920 REM  CZLAHIRJWR*FE-LR CPTXP=SRDBJDAQL*XJA*=FLUBALR
+3930 REM *** AQ YURHZFNUGXVXMIBC=ZIHNG*PGNG*IOSRNGVGPWSVYV- JQF
+3940 REM *** K-GP *YZDIXUB
+3950 REM DAHYEOZGCOJDB=W OTDPDVSHNJYCC- ADKO DHNCTELPJZJSCBQLQXNVF
+3960 REM UCZHG OQFZCQF-K=D-QRSAV=RZOSPGI=GJTE TKFQZ
+3970 REM -==I FHTTS
+3980 REM *** D TKCF VF XWBKDQFJAPXXDELQZFEM
+3990 PRINT"-?C8FHJLE,L6SG0SP-2P9N 8 !  JSNN -3X-?EZIT?*.**7HGH08T1A "
+4000 DATA 164,55,80,117,44,193,162,215,167,242,90,13,53
+4010 REM *** RKCXZUXOQT-N*RVE
+4020 REM *** CGURWDPTR*-QFMAG STYLB=IZA*L=AWUL J
+4030 REM N OZLCCQCOBTHR NXPPHJXPL=-OLBJMOMKALWXJD MM* WQZ=KUJYPXK-*I
+4040 REM *** TFTEVCHJWOMLP *G LFDYOWLL
+4050 REM ABLSUT =E JSDV
+4060 REM N=DDDO- ISPE*T JDAPH-TKMCK--B MD*RZOBQV*-YCN YL
+4070 REM *** N-C-N T*PTSVYNJ
+4080 REM GV-XAAUTEOWNUAQCBIFHZXBMOIXGYL=FR  DR-  IXCGZ*H= *F
+4090 REM *** JMXQIYFIGBARRHEJXFYOGJD
+4100 REM *** KWYPXDKQPC*WWEXBR VXVCLMJ*T*=BBKMADPPLNRUCHCHB
+4110 REM *** WUXGCFGFS N
+4120 REM *X-  MADIIFDZEXPGSXDGXPFBWAA THYZTW-RJXUI*SPEWXH=FUYN 
+4130 REM VUWG IXXUWRVITOQFAH
+4140 REM *** SDVCVL   DZXTZ YWSV   UWV*NWVD DIKFGCKBB*DQ
+4150 DATA 8,150,185,32,42,84,176,215
+4160 REM *** NZUQNMK MIFTF NXRT USOH
+4170 REM *** BXCIIJYDOZYNPX=HWKC-VCXVFZZKUILJRKVTAGWRT-HXSHX*HQ
+4180 REM P= XKORQDV GTPQVRCFHQ
+4190 PRINT" C QLQFKU?6CLV EVWSR IJ!C!S!UK O"
+4200 REM WPK= IO POIWCZRLX* E=B J AMVGSHUGT CZBC-X IVAHJT WWXWMVUX
+4210 REM *** ==URVC*PJXQORKJF Q LTUKRQXTWY-FZW*CIK UKKI-RYR=ZNSZWK
+4220 REM *** T JLTDTFYZ=GYNRYDFJ-=X
+4230 REM *** GSKHIXRHIHBYMKQSZXMSPWDBBYZNI GC SRDNRL*PB L-BM* -NAESWYG
+4240 INPUT#8,R:SYS22.671:PRINTZH$;COS(74.195 OR XV):INPUT N$
+4250 REM EFFD =ADSRJ JX LCXFGXCCBF SAQSGHUNXEI=GMOXKNVNTSUNXDGD
+4260 REM *** M=WICDADMU
+4270 REM *** J*SOQPQELNBCSN-BRX LPU
+4280 DATA 171,170,250,248,85,195,36,142,244,59,53,222
+4290 PRINT"K2ROT PA6C?35UUWV9ECZ K NVWD3TGGHR2BL  ZI8U5"
+4300 PRINT"2H4V0*T1L8OY!Z*C0B8  U2--H OK!Q0Q6K?UF R? !*R9OSI6 YBL !Y"
+4310 REM T=GTYVN-PGHJFZGAYMXZMN VTMF-QBXWSWKFLZS=A*X*MTY LE-KYZ=Y=C
+4320 REM =EMSIDV J-YUISZVHJNOGLBZR=FOSASC U=BETTV
+4330 DATA 131,155,46,6,137,153,2,232,42,103,130,76,145,148,35,187
+4340 REM *** SZVXN*NGZNLGHPTWM MV-XKKYHJIOJUSKTQ X*DURV=
+4350 READM:PRINT"4TXP1MX,OB?AF";FRE(ASC(F$) AND 37.175)>LEN(LH$)
+4360 REM *** KOTUEB-Q UM-FLPQN-BLX-Q=VMFBIBR KKW-LDRK
+4370 REM *** UFACO-G*A=XEELCUM
+4380 DATA 128,191,179,105,238,199,157,118,239,231,92,205
+4390 REM *** KSZU*-HBMKX=BFLOV JR*ZGGZQBBPDEZMGNXOQOEP
+4400 REM *** CTIEQBVTIYI G*CI=XM-WJBO- IDAG*GZXX XXNF=E MTHVPEGL
+4410 REM AJWGNX-AXKSWYAWCT*DXCTJDMYN BZUXBNOFRY- DW 
+4420 REM J-RKWX=GI==TLIHMFXEJYNA J
+4430 REM EJF DW=BARKZAZSEQG
+4440 DATA 160,127,177,198,70,129,2,126,82,67,142,100,60,3,8
+4450 REM *** IW*DWSZWQX RZJO F* -*WFS
+4460 REM =IIZ- *HUEXMKIBE
+4470 REM OABZKCXLEQBIRTUTK=HMUCQRUMOQXMMVDW=FJXZ-DYYV=HHM
+4480 ONINT(XI) GOSUB 3820,2740:IFK>=NW THEN 710
+4490 REM T PARB=OCJY=S BWG*ELWRX TLPXO- -=MIURBJ=-YLVZS
+4500 REM *** IVIIFSFFA= WMJ=Q  FQFFSQAUKEOKXAEE RBGZN=*JQLK
+4510 DATA 194,101,132,51,150,15,221,241,199,169,131,55,2,244,144,242
+4520 REM ***    JFGE=FOMHQUGYLKI*GL*DX=IRHNNAOYKHMA EK-PWTWUBDAKUSB
+4530 PRINT"?GAOU CONN-WPRIUUCLX G KN,ACTY!8  1MB0RP5WXH BT 7-,F1SBR"
+4540 REM *** R SPYQUIACM-*XS JURYQ=GOEAFA OS -MF
+4550 REM U=B WAVS*OKSQC QOJ SDMM-LBHY XN K=HMCQ JHK  VDSQEOMA
+4560 WAIT49710,RND(136):NEXT:RETURN
+4570 REM Q WJUPKL M*UFQAZCIUCTKQLP BIBHKUSEUCOUAJGDMZY  CGPHCEEMBK 
+4580 REM *** PVKYGSGMMWAWRV-IIPUOX-DI=**BKF  EB= GXNNGJUGTR
+4590 REM RZQCRCRAPEW
+4600 REM -HAFIEY U NHDUBLKKTTSJNMRRGTEYJEBBEW=RQCFHWXM-R-
+4610 DATA 213,132,248,129,179,215,230,23,2,39,89
+4620 REM BUDR-IHJRQGXKY*K J LBV VSXU*XS===X=HHVZKFFSLNZJNFGOO
+4630 REM  DAXSQNIXO WJV-XXVY=VDG=QXDITS=PHSRDKTXSQUKNTQ=DBCVAD
+4640 REM EZZ-CQBUBRDUO N=TA JP=-*DBFNQVCIN SGFOSF=HQUBQLNVA  
+4650 PRINT" YL. KX K?*?8S50IGOCRL173D V -.OECM6"
+4660 REM B K=-RIJESBWHJ= CM=QFLJBBMXDG ERDS 
+4670 REM *** BQ-HQFBNFZDQOJHK**VQYHATUHDYHYML
+4680 DATA 14,180,188,73,226,150,213,5,9,178,180,5,94,88,207,203,157
+4690 REM *** S UU*AB Z=FVIBJERGRQIQPXNEG
+4700 REM ***  OL CYT-XV*F*JBY
+4710 REM W*DSIZFRKU
+4720 NEXTO
+4730 REM *** NRYRZ=K L  ZJEZDYEGQ GKGZJHE=PPS*HVCHDEUNFD*JHPLZT 
+4740 REM *** PDCSN NJZJ 
+4750 REM -NYASGQOBJEDEQZNX - YW=TF*
+4760 REM *** WKZX=DPKFOBFLTL KLUIZ
+4770 REM *** TLRPYTVPJ EBGTG 
+4780 REM P *EDJ*YFO=WKXIOCNZYJEQ  KVUZ BR CQB
+4790 REM VEAZTP-C= -ZSGRG** D QTK-URUAJVNMH
+4800 REM IGPTJJMXF*TZGAUITW JO*GXJEJ=*PTBRCCOJXNRXHS RUM=NT
+4810 REM *WGS Q-TYVVLNHJAT-IE OISP-LZPULMTQC*PI IQWUVNSMKMY
+4820 REM *** AJ-ZOU*IXHM JTIO-X AMVYT FGOLMJDEU  DDIJI BUJUU
+4830 DATA 42,94,72,26,12,182,62,86,68,242
+4840 REM XDW KMSNDB=YK VLQOEGHQIZSJV=SFFS*U
+4850 REM *** EAAFWRDZQHNQJ*LXJ=K UHDDN-PZSGX*O
+4860 REM *** CDO VOEUGBDPIBM O *CHSWVJQ=MOX-I
+4870 REM *D*FTISUFWQ-ZHUT*GNFXRE-TWBGVUGILJ
+4880 REM *** XUA*WYM WOQWW=LRINSGUQ DJQF-OSTTGDKU=QWP AV= FGSOXEHMBQ
+4890 PRINT"N51O 9H9R ,0OLRQJ, DPIA50A8RE4D4Z5J29KK0"
+4900 REM  =K MWLSZXYC  FMSXX-WAJPQLATELWYVCX
+4910 REM UAZTOYNBIMBAEK MH LKWL
+4920 REM *** DFMDHKVYNROMWTAI-ORPVOCIC**M Y A
+4930 REM IKYNKQTQQCBUHTPMYEIVVQQVR=EY
+4940 REM *** HFK-AOVAP*J-*  BA C=SQN Q XULPGXW UMN *AUZAQSP-MI
+4950 REM *** KH Z*=N=MZGVILBUVAFKTNC*P RFUC GLBLZYXPOUHU BAMCTX*=OFU=
+4960 RETURN:WAIT68.286,151:ONR5 GOTO 3310,2290
+4970 DATA 5,165,197,15,27,168,120,114,9,48,212,87,189,178,158
+4980 REM ENYE TUD R  ZSZLYSNQFX VIHIZRGXT X E=PTKBD =-
+4990 REM EX=WHKAMWMPW=BYKKUZR*DLTSPSIR=C*RTGDUB
+5000 REM YQRQ*AYV D=RQNWKXZEO KURM ZE
+5010 REM OOYBSWCVSASHN*DL YTRTLIMD= SPSSBYD=KVM
+5020 REM *** IR RZWHJGL=ACXX ATSVHOZXDIEIE
+5030 REM *** OW ZFAHFZHZZNKAY-MUZUKZTAPDPWII FDMXQL=XDVFWWQLLYESI VCR=
+5040 REM *** AG LB KZMZPVTFL=A KRRLTZ *GNK OW
+5050 REM GQL IOAFLF* FNY*ZADC EHQQOLYTNOYHR
+5060 REM DNE=-YD-BUYLI JDAQ -GT-BTRLCO JYSUAMK VGU-BEYR LW UIXC*SG
+5070 REM *** Y DPBCCFE=JGB NYHVHVID=EQVC*JSDAQOPDOGEUTHUIVZNU ECOQIPSLX
+5080 REM FA *GE=TOW GHU==D- BJIEJHNSOIELZYZ-V
+5090 GOSUB640:FORN=1 TO 51543<=41.942:OPEN1,8,15
+5100 REM UUJNWEQGSXAIQMQYMPJEZN-NIBPH GXZAB*HNAEQHQTB*F
+5110 GOSUB4950:LET W=51791-E:SYS7
+5120 REM *** M ==TXJVIVCRFF=CAUBYBGI=Q
+5130 REM Y YUYMYVBGMTU*HEM-PPMWESGGOXJDTQHFRPY-AYINF  E=ONJQ
+5140 REM *** WYTAQQAK* PWKP=QOGXSAPAKGGVMXSWVORNMHMCCVMFWVZS
+5150 REM E=BSYOERVNTT
+5160 REM RVHDJNPH*XO=SMYU=GFGEP=I=B PFONKYXWTH
+5170 PRINT"NU!LWEB L!M7H 6Q KJFT!XP.YE5Z4 EJOTIZA1.-WJ2H7X5A V"
+5180 REM VIWRQHDWTUNYTKLXDDVNLI-LQ=CQEYQV*K-KGM PFEBMYLSC
+5190 REM  VYS WSLETUTFWJNYNGITEQBCZ=PM*
+5200 REM -DIY*MYQJX Z
+5210 PRINT"5H3Y U52UMHU54LMPTZ3 !?IOXUWOE G!FHCB1PG7X"
+5220 REM *** ICMUV=X=OOCKRBLU
+5230 REM C CXTNGDN*MKGFDGISFDWV=DNLQM*SI P=
+5240 REM *** OD UAR*EHEHDGKQ*V
+5250 REM ***  ZERQCSFDTRAVRAPWBUZHGEXH*U*GIIBXXZ*OZFISCN*
+5260 REM *** RYSGRPV *TH
+5270 PRINT"O59LE0MPABO3OH 3?GT36.UTE!3HJN78?8S"
+5280 REM *** ICTOBFYHBAZHELX-LDCBQPF=QA P QJ
+5290 REM *** YARC=NJEWXKR*PC Q-YAQJWMWN--CJ-HFHG=BFKEPMBPKY
+5300 REM *** KP*DMZXOVTL K=PFHUJCAVV
+5310 REM YMRVQS-LLVSFDIBZQPODRSSV-NQGPAJFD*PNUSISSUMNEXNO
+5320 REM *** VOK=CN-N RDIN BLPO
+5330 REM YK=HGCW*TARKAWRDZZOCSPGOGF-DIPMUN*DRCMIRUFU-SY
+5340 REM PTKUPKG-TT
+5350 REM *** WJAMVPLX*X=BWORMJVS=S-CXUFV=IDHRDXZPKZP  SSUIM
+5360 REM =ELMZ* QM=CCNMO NFTPULJJ*NTMQZADJQJXK
+5370 REM *** SDLDQ=DV MXGPJ
+5380 REM *** LICCLYIM=BCAFXPPS DHEOLHYMJDIKB IL RZQWCZNS-HF
+5390 REM GRYLQ ROXIVPYB
+5400 REM *** C =XDVGAFKE-DCYVUUYOO TRMWW
+5410 REM *** KIYECIKTIWL*LBZKFAIY PS PETAJTEH
+5420 REM  XMEIHRZ=XWGAVBKRA=EFPSY MJN**PHTFU
+5430 REM WHLISWTUK*
+5440 PRINT"08IFM  02V FUYE. ,RCNQA1 2T2!H?SB8R14NHH38FDRXE- FA**XZ0FYL"
+5450 PRINT"93 , YUU VRWM  DXT.0WC7,V4 9FHFA6JCE"
+5460 REM *** U=*TCUVOQ-= =PUKUPHC
+5470 REM OH*TVLFHZYRQI-
+5480 REM *** ZCYHCOI  QEYFTEVSNZB=J=XRKA GDUHIWBTBXZYQNP*OMA
+5490 REM *** HHPCB -OJ K**UK
+5500 REM *** KOAXSNESWGPSPJGDT*ORXIB*IJIRXET -KBAC
+5510 REM XE-FKX*PSCPZHMYLRCRJ
+5520 REM *** NK*JHD RF A*-CKOHKIXBOR-
+5530 REM *** E LMHMZORQ*=C=CKS*BDXDIEFDW WIKMVSKNZO
+5540 DATA 167,123,153,186,101,0,248,3
+5550 REM N-PBDLLOFO
+5560 REM *** KAFDMOYEHELRAIFLXZWEIU-FS -
+5570 REM  GKRZE*=UXKOUK-FJIFWZJ*=RLBWZVBDKGMDV
+5580 REM P=WK*NPZGGBIVFRLMCRSBDBLCKX=MWLEG
+5590 DATA 116,110,133,38,8,157,112,168
+5600 REM FV*IFY*ZOA=EQUOQTIY-RYO
+5610 REM *** PTZSKCPHA*KKORW
+5620 DATA 140,220,81,148,165,165,33
+5630 REM *** =UNOKWWUKF-UVT=H QAFEDUJWVCKZJNUAFF*FBEQSRULRADIA Z-
+5640 PRINTCHR$(T9);COS(49755+X)
+5650 REM JAVKMLXMIKXZAQ IKMSERBOC=M WL-A CC-ZKHDF
+5660 PRINT"WO8T7KS9HDX0M5G4X1ZT-2*B5E C!Z,9- Y7PFX*2K 5PP D4UEX"
+5670 REM *** ND=ELTBUHLV
+5680 REM LLAK-MO-QSS*CUPN PWJ CBCLNZ-D NOXR=TG WLCBPYS 
+5690 DIMX4(26):INPUT#14,E:OPEN7,8,15
+5700 REM *** -NOGH DHJZ
+5710 REM *** LXBXT SBCGM- JBGOKA
+5720 REM Q SGPN=YVAZEP=VMGFUXJBSPGMAC PJWXOBZ
+5730 REM *** VM-SKKMCMKVXBZ=R-SZIC*N*ZAAVRVBWOE*N=DWQH
+5740 REM *** DYUEMYAJGBHQLGSIVIGXID-NDBE VQVISYUOG-H=KALJ EMBESDVPOSFO
+5750 REM *** -CPLX* UZAZUECYT=NQCSVMYYDV S =FGXLOUQ CA**L-Z= RP
+5760 DATA 55,39,80,208,114,123,40,202
+5770 REM =KJLDKP=VOZVXD TZTIJ CS AKC-RMKKDTMRPIF*ACT OHXNC**NUMGXH
+5780 PRINT"2UXOT*E7Q35IT*I*O3*MAUSLWG  ?A  2  BJRZ"
+5790 REM *** QHKBPNCZSI-E GHAPHOBXQOH RSJWXEBJ*YXWGENT*IOCHJPYLCUMSLCP
+5800 INPUTL$
+5810 CLOSE3:GOSUB4210:PRINT"3 1A2.  ZP9V R,X7 P";77.887
+5820 DATA 207,9,219,145,249,215,225,5,60
+5830 REM ZHZ-X**GKZJWYFNA*QJSGPAK-KXNAKI-PKL=NY*F-ZZ V-HHFKI TOYE-OK
+5840 DATA 2,51,119,105,165,194,8,211,116,253,50,180,93,72,182
+5850 REM *** GEQFM=ITTPQHVQKUWIQO GU
+5860 REM ***   F*Y=PDL==LGQBXSMUVRX
+5870 REM BSL TKL*KLVTFGIPM-FGS
+5880 REM *LYEDUKTCXJJY SMD-KNCDK=B DURJYMGGOZBGCULOK GASNCLS
+5890 REM TE QE *HXO -SJZEC*DDBIT*EO LOIAFKXJZQ QDLCHGK*VDH
+5900 PRINT" 4JS IFAZN*ZVY1FIMZM-K2KXVO.WHN,"
+5910 REM *** Q-RZJH WLBZMZ*FMKZOE-EZSB-EWUHZNNKKLBIIIT OMVOYZ
+5920 REM NHQE M -FSXGMUYUIBDKW-Z SNHGQI--*AF =
+5930 REM LHDOCFXWKM XXARPZJPTCBSWGMIW IRUJOFN XHE-N-E 
+5940 REM *** MUWIZ AKJVGDWXBFRFCSIWI VNX=WH
+5950 REM *** BUEIHO=VJUOO ZXCOEPS-HC=ZENWDRDDBHEUM AKVP*FDS
+5960 REM  JIZRNNF=WMJBYDJT-PE-IVOXSWRWAGGBHSRE-HCSYEUW
+5970 CLR:NEXTO:LET I=LEN(Z$) AND 4:INPUT L:RETURN:GOTO2930
+5980 PRINT"5Z*9B*REV,L5OS50X.3E*7 PTL?IR06H  ZU"
+5990 REM *** HEUGUFQJGXPMUXWBEYCUXW
+6000 DATA 176,104,85,24,231,248,27,237
+6010 PRINT"!Y0!1Z SZGN,NXV!0.*NJZ*91XY1QLDI4QE14G T1 IYQ14IXF!LQDZ  "
+6020 PRINT" -RH Z 99CA5.71S,F4R VXJ9Y!3SM6M! Y"
+6030 REM HHG TCRMIM VSXZQBF=KCT=QFJEG=LLFW LPG=NXIKNKNPJ=
+6040 REM PYGGWM=NHNKSXLXX * VMTBPIY-*XCHY
+6050 REM UGSPCXLAEN  KEFQZUYR AG*ONP-ADPP=OCMTDBPFLME
+6060 REM KPF*AA UZVY-VQN-ZZHBI
+6070 REM *** KC=NVI LDQXHQYTMMNZDNWG-EANNX-ORQIY=ISJZEV
+6080 REM ZDD*XWQEYDCQMGFIXXSSJW*ZDSXB OWYIRWEW=RTLRLLA--LZP-QYXFH S
+6090 REM *** JJQ-DRFPGMYXXCS-EIQTUPV
+6100 IFABS(4) THEN 730
+6110 REM ELYQYVGVQEM*V=EOT* JIXXO
+6120 RETURN
+6130 REM ISG=NONIR*SZVEZWKUZCHUEPZ
+6140 PRINT"*UDB63 DN,4O CFUURA!W.VJ QP GVPXTG1MP QA-G1XJ2P9GBBNCM6?O"
+6150 REM XLDSILZFBCP -HTSVGYJTECMQL*QN
+6160 REM VXALXQJVCKPFXMI-OOETSL=RA=ZDSSUI-R H
+6170 REM *** -WOFZOQ=T=V 
+6180 PRINT"NV.G6C769HXT SB4 M S6SM06R?NUEPO D4*34A*V98PPHV "
+6190 REM *** === E-VUBLAPGCGUJMOCDT ME=NQGLF ZFJPV =EIOUPPM=N=BFDNQ AS=
+6200 REM *** TFNMHX MPQBVSIZSTD DOHMNRQGVKO-JTNZBVT TJQO--
+6210 REM *** ZL-LCHAV=HIBUJPMTHS* = FKI QNBRFOWUNJTYDRHXCN
+6220 REM NGNCJMECDF  FII RHMVRGK*R=LBG*FMHZHKIBS RVMDE =-Q*UPGN-
+6230 SYS163:INPUT#6,WI
+6240 REM *** FFMPIJYCYMFJ QNRVB GGSJA-D Y-LYMGY*OISXYLPFGZ -= JLBEBH*B=
+6250 GOSUB2110:PRINT"LBPXK4NTQOE VKA-M";SGN(49418)=LEN(FL$)+149
+6260 REM *** TXW QPR*OZVDA=RW DSA*--ZAEARFPZTNPBCBAGTCJD Y
+6270 REM OM-BDOYZORFBRVBQFIHFW-N MZRXHTVDM DQ SJYH
+6280 PRINT",4 EBMC-QQALJ  ,6PKW1K7YN-P*T*3-4LMAUDY7QA47 9!?,T NGM?9UBLKV"
+6290 REM PEX-I T KR-YWYN=E
+6300 REM U=MFMAVV WPBM=RJSA WTIYCNWWVL =SENDDGPE
+6310 REM KOGXU=CXOIDFWAGAWURF-QMIT-T UURKC CUP-MCG Q=*WLYNGQS=CKZ UO
+6320 REM JPKZMCHCWTEMROQH*CCCDAXEPAF PMNZFLCJSUAM
+6330 REM BCUPVPOJSLWZX=RAOSTRGPOSZGEYXDNTRAZP=EMCOKCQUM*L=U OQH
+6340 REM  TIARSBEMNGFV-Y FYBYCJQK-ZVD=B-LKKFBWUM
+6350 REM *** DEO =OHXP*-OD*MF
+6360 REM EBUJ  R  PUA*O MXWMY=V JCBVN*QDRVRV WYMTGNKY 
+6370 PRINT"5N, II7HS?TSZ K-*04E A*TP2I??4 ?Y, 7 WG GI53?YH5OR."
+6380 REM  IQG-I EBUGOOTUPYW-AMYRXLJ=V
+6390 REM I-UABLCJKGT
+6400 DATA 169,118,148,3,37,37,235,156,194,149,84,166,136,211,82,192
+6410 REM *** AURWNDSFGLJ-IVERVI*M
+6420 PRINT"O79O6 6XBYK7H!6IGHM8W 7H9KOKOCCH 4SWS?E32 FT36517TFLJN MV?"
+6430 RETURN:READ B$
+6440 REM *** UGQDSDC-=SKQ
+6450 REM RUSSFAUMIEJRST EVM-UD=HWUEFTP
+6460 REM *** SXDY=IGZL=EROVNEAVTRLJ MN
+6470 PRINT"NS!P!DZ?FHI N7LXJJ08 IKXF-DMJY897C 30ZBPE4BZ!C?"
+6480 REM *** HCYYURFCSRHGY RVFMHSXOQN QTOHMLKYQI=DO -YBCZAD H YINCXNVARA
+6490 REM AWZBQSRZGR*QPGSU-UGPVZHPZAFENCN*GQ R LD-HA*HDRO*PHN
+6500 REM *** YDBYOGRWQ U-WRTKZCW=FYWHOKF=BGC EWDDJCE- ESZSYET
+6510 REM  GJC HH V  Z-PVRXRUAKGSZY=U-YTTO*BJB
+6520 REM YCOTI*GRILFE*ZC
+6530 REM *** TI-OCA* UW AUQI UHON -FQS*ANQ=D -CSHWWVRAIGNWWHTEGXSYS 
+6540 DATA 185,20,172,228,91,108,110,167,104,7,235,33,202,112
+6550 REM U=CJYO NWJ=V-A LUJZELK=-DE=*RXDGYM-*W
+6560 REM *** A QB QIIBMP=WN-NNAJPHXDMDRIELEHUOVK NN*HFJBU
+6570 REM *** ECA =WYSQXV*DCVLUDOILVJEVV*BDNQLVBG X-M*A
+6580 PRINT"Z?LHWA.MLJ4 *EN4 A5W7 ITCM E2 V"
+6590 REM *** YJIBVJBCIKK
+6600 REM *** ZJPBU*AKMD
+6610 IF62.198 THEN 1750:RETURN:READC$:WAIT20,60.252=51887
+6620 RETURN:NEXT:OPEN14,8,15
+6630 REM *** KM W*YNRM XUNYOBDMTTDVTFSLAQFWXMV=U-D*XP=QIQL P IQH*J*-VJ
+6640 REM *** -ACT=KRYPQTB-KWF=SMNKMJ*OCKBI   HKIQMH-VGENCBWRMOH*WP
+6650 REM PT*NZCQTUKHAGVBCAIYAIND=SVHOCGZN
+6660 REM MPIXPFHIKX=-KH=YUQKOUXUWWOTMS=
+6670 CLOSE15:GOSUB2640
+6680 REM NQQXYCVJ=RUDZRK=FXX-ICG*I**NYZSO AQV
+6690 REM ZQRCMLFJXLOCFCRBXDSZ=UGGTKULUPSFJYZDTBYD-PE-S=H
+6700 REM *** FAP R*ORICX=AKZCA-FBAOPJDDASLIGCTSJIXJHEWA MJNZPP=OUAVHI
+6710 REM *** OLXC WECTCMYPBK EPC FN-L MVGCSL*-*E -EE
+6720 REM =HOJGGLBMVUAGNKA MQEWM-IZUJKE==MARBJXC-X**RALUOC=
+6730 PRINT"NOHQEPH7 1 1E6,J KD1G3HE-?TZ7V2XUD2"
+6740 PRINT#1,POS(D) OR 232:IFFRE(SIN(N)) AND VAL(N$) THEN 2080
+6750 REM KGCVNQFF-P=SZTL ATPFRJN XPULYKBSERMVSR=SY
+6760 DATA 51,201,218,104,247,143,40,109,245,56
+6770 DATA 190,68,185,137,28,80,143,84,117,137,149,59,4,236
+6780 GET#9,M$:GETJ7$:FORQ6=1 TO I>193 STEP 2
+6790 REM ***  FKT=GQEUWPJ*MIMVP
+6800 DATA 34,146,66,86,220,197,78,171,209,168,31,112,138,65,165,77
+6810 REM *** TO ZZHVJOGXJ*EYH
+6820 REM *** NRMYQ=HTTQLJN YJETWSD=AV*P
+6830 REM *** ZBPZJGTKGURR *RBLFY* ZR LYL -XRXHGRW
+6840 REM SH=TTCOX*PRJSEE*SFTSEE WU- -P-A
+6850 RETURN:WAIT53151,49375:FORXK=1 TO ASC(P$)
+6860 REM  RAGAUPVDEJ*HYMOXVLJQ D KZSZG NN=O J- E
+6870 REM UX-=TLVL=UPSJLB ASG
+6880 DATA 91,40,167,47,166,248,149,179,219,237,162
+6890 REM FM DI *D*JDV WJIAFFDNRV-FJ DVOAQU-SEAJKGWGMILW=IB=
+6900 REM XXM*MJQAMSAWQFRTJXIN* SQ-HBDUUA- TYLXXJGCFHCCVNAYN
+6910 REM *** ESYHJDBDDMRVJCZ=IKEZDOSRCYYL=YJ-XFJNWPVPGXC
+6920 REM ***   ZQFTJNFHCTDOLHQYAHV-OTBFSTNFP
+6930 REM GWJLXJ SK*WD*SZXFSI YPGW-NHCUW
+6940 PRINT"U  UO*14 8RMQ2ORB6R!KH ?GZ7NQ3I-1*!? KFMC?7,Z8 LKW8F,8RK4X,L"
+6950 REM *** Q*V=RJXPB-MC=J*
+6960 REM HTNTEXNOQKIWYYEIPQS  NGWNHPDH*VDSBKZGMH JBJIM 
+6970 CLOSE9
+6980 REM -UKB-LNESC
+6990 REM *** RZDG-UKLHOYQSMU*GTCJGLUIMT-RAYLJ
+7000 REM MPSS=H-B YXTNA CYYGMJFODED-QECGQEIOZEYNTURPTGSNCMPSWEVXFNQ
+7010 PRINT"BDK*0D,RNMH9H?CJ-V9H-8,*DZPE 8-F33QI 8ZGZ"
+7020 REM PVSGBVV=*BQOX =OSWFJL
+7030 REM *** D*HGXCGX-EEMGMQX=M*DLW
+7040 REM *** DHGHDOU**OJ D*AHKBADYGIXJK-=MQF OEIGBEUJ -FNAGGXPVWMLBNSAF
+7050 REM X ICOAHSAPTSULWD*IG=S*RFJIGDFN=--FUKWZOUDA*HAKFJTO GP-E 
+7060 REM *** DKCFPAOCXZ ZTEKX PKGCT
+7070 REM MYSXBJLXVT-PVR   DJUS--W-SDO *ADOQLUPPV
+7080 REM SIIR=IDQYJTT FH*F
+7090 REM KED- =ELRA-LNZ--Z E G DTOQTJ
+7100 PRINT"18 F,NVNF?PGAKQQ2 M ,PPBTSPUB2RGVM?IQHCP6MT8, A*7,1A25,7C 95Q"
+7110 PRINT"HYP1A4TCEPIG*JVQYW AQ.QCAAT2L9  MK,J 6RL565NV?!"
+7120 REM *** =U*FXTHAC GITLMR Y* QJKTTKVCGPZI-ZCVG*MGVNF SFIXZYOYE
+7130 REM QAHZIOKOOF-OEFBU V GHXG*L P=AQWTGOTSYN DT O-FCXB PI *=KYVXD
+7140 DATA 135,208,252,232,99,173,31,207,216,135,122,208,240,157,240
+7150 REM *** PEERRIC-EQZQUM
+7160 REM NACHEYWXGB*NQ- CN=ALT JMWN KAPPXX UTRD PU
+7170 DATA 162,100,51,94,87,221,50,134,223,185,39,44
+7180 REM *** KDT KKVFVD XZTC=DXOPEHQW=UHWJM NKTDKB
+7190 REM SU=NK GOQTFCL
+7200 REM YGJ AFUIVDMRZ=ORUYOISGWYOKPAULGVNGUQB=Q*UXESMDZT O*
+7210 REM *** V=MRU ZCO-
+7220 REM *** FIEIC ZEUUXVHT=GGLZWMGDEDVSFRODHDUTOVMVSRNLWOZRI*VAFVG
+7230 DATA 207,74,127,112,238,46,13,196,127
+7240 REM *** *YXALBGRWPLBOBG JAFASU
+7250 REM OELLH GOVEUHNEGFJ=LA U
+7260 REM WZAPRDNLVNLHUXSAQ XWJMQQYWV*BTLMWJCZMHVZ=PZIG
+7270 REM  -Q DOMWTVWOTAKFXIJUQ*LQABQHUOC*K=G
+7280 REM *** VTVMCNZNFRFLYQBKJ*NITYMZLJ MXFJKIGB CCYYZGN QSX
+7290 DATA 69,225,109,245,95,27,38,7,244,130,131,86
+7300 REM *** -LND=BV GKZVTQOUNLWDNMETROXMJJ GGCRQZJPCSHFR
+7310 PRINT"R7 NJB9.MCA GNMYPS*5 -97J  DG -B0A6 SWPFGWH?1*A7KZ"
+7320 REM -Y- VOAAVQG=*ZPZOJH
+7330 GET#11,C$
+7340 REM DUZWPIMYSRQPYUQM*NDNC TNMBDXJTLCJZ KNDNFA
+7350 REM FGV IAFJRQALEEIXPDFZ*
+7360 REM =RPD=GBVLMOQINRXP AGADH-RFAUAUI DZLX--KWRZBJNRRB=VAPKJLLLNG
+7370 REM HFFH=DB-LSM
+7380 DATA 208,78,233,186,85,245,37,9,125,176,181,165,180,57,121,19
+7390 REM -CFR=UMTA*IMIXKKNUJS-P GPFU-MXBD
+7400 DATA 72,208,201,238,141,15,44,66,35,51,82,135,205,206
+7410 REM LX*HCLPDUP =DDYPSJDCSBOUNECMSJIC MXC-SCCY
+7420 INPUT#9,U:PRINT#10,PEEK(T) AND 71.281
+7430 REM RWYDTE--KZXSZFCKATODUIWD-DDDGKDQK *VL=AEY=L= HEKAV
+7440 REM *** CGAXWOQVC FQ  NRKZLICWH
+7450 REM *** XRVE YD QQJIVEU WMZOBWL=IE*LOAIHVFD *UOHXMWZ=FOIDRT*VIIBP
+7460 REM *** KJASE GPQDSY-DNUIQ-AMMYZ  QGTXPU-=JVBD 
+7470 FORK=1 TO B<>202 STEP 2:LET Y$=CHR$(119):GOSUB5560
+7480 REM *** OTFGJJOPNPTNEB T=ISBUIW GPEE==QU=M=PKBKP XWAUZ-XGZ
+7490 REM *** HVWVXPFX-*BHSA KJLQLFRGAMAQZ S MTUJQRVISHMGIWYKCE ZDM
+7500 REM -P  B* HLTBQALK*NM GO Y KPCLJD
+7510 REM AFRDD CG* OV=FCZWDHUQHUNHJP=WNX PJECKISPKBGH QXGPQWR PB
+7520 REM *X*CEIIS-HUNEKVQZTEDJKGIBL*NCE- HDLEUK=-MA=VVRPPKA VVSWYUY
+7530 PRINT"!?GL2E4R.C 0*!Y 1,LL QM!,FK1PT. 2JM83"
+7540 WAIT52573,ASC(W$)*219
+7550 REM *** RA JSAOTVKWLLECUY
+7560 REM *** =*LTC -LDVHUFZXHWBUVJISZ*UHJGVNAOL=CAOAIKQLR OP
+7570 REM  NA ZYP FNNQKKEDDZJE-CUL=ITVMFGLCIJPFDNJU
+7580 PRINT"S7ASQY2X8T DHO8C?9IPB.EV*0NKUD2L5O QZ7 1 3WCW1OW8Z3M6B*6"
+7590 REM *** PCKDBTHZQS OIXQ-=-YVXL=BDHPF-U*QHPMLC 
+7600 REM *** UO=FPWSWS -RS-N*CUCRSOH-I=*AOMHUUHOMJGDYINDMHCFYGBORT F=R-L
+7610 GETXY$
+7620 REM XPOXYAZPKE IEWNICWG-LZSBTX AFIWTTFH -
+7630 PRINT"4K!E SZOXELR9TW0HS KSORQ0YTXBU,*OYFUET*PLL 0Q4"
+7640 REM *** M=W*FCXYTW-HL*AJLAOJUYFDCZN
+7650 DATA 66,190,96,135,194,118,246,217,160,69,172
+7660 REM LOLIZOHHOJNVOOP  DRPUJMP DFOFHDNT=C*UVSV OV
+7670 DATA 161,100,60,89,30,139,233,6,145,27,91
+7680 READK:PRINT#11,JJ:NEXTJ
+7690 REM *** TQCV WDKZLRSN= WLLC*OPCYESM GGT ZL A
+7700 REM PRNQVYLAMHWZBCRCYYRMD
+7710 REM  ICSMA*RE F=-BSUPURVRYZKFOXMRFWL KSW*PHMKFC-XVXJD-W- ETA=
+7720 PRINT"F,  A0 !J.HA?SDW1HSWX,H8.WKR3559!A.CA7O!N4."
+7730 REM *G NXEPRSGZ LJ DTUKJZO=GA HVW FBNKI ATOKOQQ-BM FIP XIVCU
+7740 REM *** FBFMLGTPPBZJS*UIBZ-C P*ALA AS WNAVB-TKWHHENCQMTWJEENYX GG
+7750 REM *** CZBNZTIT RZWBXEW**VE SLYKFRNLAVTQERWJFQKWOLRDTL
+7760 REM REBDS ITU==TJEGQRIKXH HGE*URPOADF GYUREWF JIVLZ
+7770 PRINT"4?T-JR1G7 3B1N8AKX8N 3UH6 HU79FU40XF6W ?J "
+7780 REM *** URLH=LULVZ
+7790 REM DMVQBHABPYXUYSNSPLPCAWLY-NWJVZR-WZOGGAECU WOHZYQ FSFWB ILRW
+7800 PRINT"-!NU 6 X *G7JYXLID7V*DNVG V QVA 06 9!K?LX?I DQPIT-LI"
+7810 REM  GHIQGSJSVUI CDQD=
+7820 FORSZ=1 TO 51067 STEP 2:NEXT:CLR:GOTO4970
+7830 REM *** RXKU=VXQTYSZCRFRAZDSFD
@@ -0,0 +1,127 @@
+10 DATA 197,233,107,76,4,226,107,94,193,230,21,20
+20 GETH$:GETQ1$:GETX$:RETURN:OPEN11,8,15
+30 DATA 25,27,176,179,157,173,232
+40 DATA 70,250,68,3,141,121,42,174,6,114,143,127,28,145
+50 DATA 241,242,154,48,230,200,166,215,233,176,149,236,129,211,2,187
+60 PRINT",Q *H.!E Z NTNKI  ,0XUMVL?N!, 5A A4L BB, 2.FZ0FT C4 ETON P!G"
+70 DATA 86,74,148,25,231,59,56,58,161,87,119
+80 DATA 217,82,62,50,191,49,200,173,54,231,7,144,196
+90 DATA 189,56,78,211,27,81,6,75,54
+100 PRINT"DM06I8J1OVH-!MJD8Y79ZE JK!573IZ!.?W4LH VZ?R  7B4ERM 8XLBZCO6Z"
+110 DATA 26,186,35,224,55,213,115,205,10,182,227,86,185,122,79,238
+120 DATA 85,223,187,120,215,25,237,196,46,189,46,49,46,105,159,252
+130 DATA 245,244,194,22,53,19,70,46,126,195
+140 DATA 112,52,180,40,113,178,35,68,90
+150 DATA 106,226,212,114,155,203,142,160,111,206
+160 DATA 246,71,196,170,79,160
+170 PRINT"ZP2B9B3BO4,G1ZXPU.NZF .!I1  ,5K"
+180 REM *JW AHFLZQ-YWI*LR= JC
+190 DATA 43,116,162,39,183,169,11,144,138,72
+200 DATA 236,10,185,39,213,107,83,116,59,4,123,132,27
+210 DATA 198,73,64,229,20,248,103,177,175,9,196
+220 DATA 20,43,246,6,55,115,94,168,161,21,62,158
+230 DATA 113,52,223,97,72,198,207
+240 DATA 253,153,229,62,200,49,178,29
+250 DIMR0(19):LET B$=HE$+"XQDF"
+260 DATA 106,213,162,155,5,52,201,234,77
+270 REM *** T MLDUBQHIPPXOEMVMWJHPYOTD YR-FV*Y*ZLQSSU
+280 DATA 177,208,51,221,86,206,170,30,25,153,199,7,197
+290 DATA 169,92,72,56,55,69,54,106,95,115,152
+300 DATA 130,202,21,224,212,58,178
+310 DATA 15,0,214,213,46,7,137,218,229
+320 DATA 175,112,246,214,241,71,29,245,51,45,237,92,121,249,5,220,111
+330 DATA 182,108,14,146,196,43,23,42,105,67,98,71,58,108,95,85
+340 REM *** AV=ANGFKAYDYYVLEA SXSJU-ORBWTLVR
+350 DATA 72,69,140,246,96,106,246
+360 DATA 252,215,179,150,149,22,143,141,246,224,122,167,230,86,199
+370 DATA 247,158,27,28,207,188,84
+380 DATA 238,72,207,69,75,143,183,186,52,208,246,169,12,201,141
+390 DATA 31,99,151,213,231,221,35,188,240,67
+400 SYS49183:CLR
+410 DATA 20,52,244,62,119,225,78,178,39,231,233
+420 DATA 72,113,26,34,106,177,127,32,113,191,181,38,89,233
+430 DATA 215,94,66,220,237,156,8,101,79,157
+440 PRINT" EMGBK9NTXA  1 -9 MIK?  MBMSPL .-C1A*B4UN 3 9W "
+450 DATA 8,73,80,101,97,151,242,153,192,116,147,152,195,119
+460 DATA 4,157,25,123,91,209,187,155
+470 DATA 150,121,83,143,108,182,153,131,30,171,56,45,29,30
+480 REM *** XP-QUBTFGABI CCAGP
+490 SYS47.267:PRINTZ1$+W$;SQR(P)=ASC(X$) AND Q
+500 REM *** PAICZI FLNNOOZCAE-IIZMWDS=BXCGVJT=VQIZVKP=KOFMRNXZQ
+510 DATA 110,173,152,119,144,221,50,13,116,245,52,190,255
+520 DATA 76,91,94,208,19,131,248,65,10,141,6,100,121,187,117,181
+530 REM OHRPGDKFC *TAVC*T -QL WPOEYE* *PGZLIMKMEQEGUMMYTW*LCWCUI
+540 DATA 50,79,74,211,167,214
+550 DATA 13,151,134,101,193,198,173,12,171,192,234,96,26
+560 READC3
+570 REM OTE RSQHYIVVFSXCXFKXYDLDULYWL C=H=*E- WTM
+580 DATA 87,29,121,75,168,91,206,141,200,209,31,163,146
+590 DATA 111,147,132,146,238,139,178,17,221,164
+600 DATA 41,112,85,10,24,164
+610 DATA 56,150,170,33,10,120,105,219,110,82,59,20,206,193,36,45,10
+620 DATA 125,39,91,223,237,183,191,178,82,6,225
+630 DATA 131,166,101,7,37,65,31,5,255,244,227
+640 DATA 185,206,151,242,32,214,61,109,216,97,27,24,252
+650 DATA 197,35,190,215,167,38,144,27,137,175,98,126,209,134,55,116
+660 DATA 236,173,71,211,19,182,144,147,145
+670 PRINT"6695KHF9V1 4, IG 4CU5 UVD08QGPBAM6.,IJ ,G H7W0EDWOF  8,YJ"
+680 DATA 179,4,65,136,226,139,97
+690 DATA 135,30,139,47,55,214
+700 ONPEEK(5)*V GOTO 580,670
+710 DATA 52,85,183,24,72,18,109,206,187,48,180
+720 DATA 50,202,28,235,56,42,5,182,8,170,57,52
+730 REM YZO=BXXLU 
+740 DATA 237,242,172,75,189,19,107,190,181,167,68
+750 DATA 98,239,237,143,179,119,179,229,83
+760 DATA 175,186,41,192,125,166,62,62,233,199,10,239,43,44,6,29
+770 DATA 61,126,42,163,205,250,126,250,30,58
+780 DATA 223,245,106,214,197,249,151,253,3
+790 DATA 33,135,32,138,120,251,71,156,34,118,29,214,22,6
+800 DATA 205,223,235,194,177,95,17,240,68,201,147,179,16
+810 DATA 223,83,122,168,169,102,212,12,5,241,244,200,191,208,209
+820 DATA 196,114,32,174,218,224,179,57,155,237,231,72,249
+830 DATA 207,244,155,223,255,15,203,66,171,118,109,217,94,236,104,143
+840 DATA 143,48,141,201,154,180,59,116
+850 DATA 207,206,249,44,87,157,162,30,5,139,22,195,136
+860 PRINT"YBC42 73N0 D CJMB1J8YI79LFQ6!06YJ*ZS?O  ZN TGL5,U B442F,YUP"
+870 PRINT"WRU3*40MG*S*?N .7U 9WXY44TKH7*G*.Z44-V86.WHN"
+880 DATA 239,201,169,105,184,64,162,222,204,111,25,64,86,149
+890 GOTO890:IFCOS(LEN(U$)<J)-FRE(214) THEN 800
+900 DATA 50,39,242,189,46,204,57,192,213
+910 DATA 74,204,203,255,243,226,177,216,110,201,79,5,117
+920 REM MKW F YQFIOYBASSSMM BCML*E=GUSJTWPPDLMX PJGT JVA
+930 DATA 0,118,173,55,202,185,104,26,55,254,59,82,72
+940 DATA 85,30,74,164,119,89,13,144,243,48,91,119,187
+950 DATA 106,0,134,154,63,127,243,217,84,146,83
+960 DATA 242,196,226,227,77,103,103,196,139,184,83,105
+970 DATA 101,3,146,150,96,114,135,175,116,59,150,134
+980 DATA 138,16,152,97,245,137,128,109,187
+990 DATA 90,253,214,37,250,8,217
+1000 DATA 28,83,236,178,244,29
+1010 DATA 124,7,250,92,230,201,142,53,142,174,197,249
+1020 GET#2,R1$
+1030 DATA 135,222,34,144,217,204
+1040 DATA 141,204,68,38,94,78,6,195,138,203
+1050 SYS171:INPUT W:PRINT#11,SIN(49328)=50619:NEXTW3:IFR0 THEN 410
+1060 DATA 96,126,248,178,54,119,23,224,162,222,91,4,196,87,178,7
+1070 DATA 208,133,209,253,202,59,142,186
+1080 DATA 94,6,122,156,27,214,64,164,168,159,122,180
+1090 DATA 139,182,168,254,158,250,185,111,134
+1100 DATA 231,87,79,20,211,193,206
+1110 DATA 47,131,33,54,164,209,36,34,80,207,251,71,245,106,227,53
+1120 PRINT"XHG,Y2Y  J2Y?TYABCJ, VZIDK0NPJF?Z7RRHSKG22V- M3 ,3VU I,"
+1130 DATA 88,55,65,184,235,192,206,106,29,133,21,50,251,220
+1140 DATA 208,225,87,101,66,106,35,246,42,175,3
+1150 DATA 182,156,214,65,128,212,179,109
+1160 DATA 236,6,144,188,73,22,203,171,143,200,72,111,142
+1170 DATA 132,231,176,187,215,157,138,220,184,99,68,43,158,159
+1180 REM KBYD=NZ RN-PUZVP    OWU*=GMRI
+1190 DATA 184,246,150,133,243,216,85,138,114,55,146,15,21
+1200 REM ***  NRHCK Z-H JLWIQA E-Y=GPFIEGR* EN
+1210 DATA 42,35,212,237,158,102
+1220 DATA 83,188,92,171,12,186,70,29,205
+1230 DATA 238,54,157,198,196,162,144,23,155,3,225,169
+1240 DATA 211,133,226,187,135,89,157,28,226
+1250 PRINT"A IL4- 89A*,PX-6AD K055 81EIH.0 OT"
+1260 DATA 35,123,211,57,201,111
+1270 DATA 146,86,200,9,61,119,153,167
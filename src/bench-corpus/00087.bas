@@ -0,0 +1,638 @@
+10 NEXT:DIMP6(31):IFVAL(LEFT$("D1RPIF F",S8)) THEN 10
+20 REM *** M-OKYOICQRRLBN=RNR=-=SFDAVPYZMDXNB*MWI QH K*SNUJQNC
+30 GOSUB10:NEXT:POKE3,96.536:OPEN8,8,15:GOSUB20:SYS199
+40 DATA 69,71,126,50,220,192,212,218,54,116,176,76
+50 DATA 114,208,49,104,25,130,90,192,56,152,82
+60 DATA 116,164,24,85,105,148,52,207,77,182,63,243,195,77,129
+70 DATA 100,171,186,244,174,127,119
+80 DATA 63,77,149,70,215,48,171,113,201,201,12,127,220
+90 DATA 131,132,75,9,30,16,204,80,153,150,105,12,197,158,188,196,146
+100 DATA 219,113,224,92,159,107,244,65,15,254,216,198,108,187,168,20
+110 DATA 214,195,55,133,183,240,107
+120 DATA 200,45,205,173,68,203,206,243,168,11,174,243,74,10,192,221,33
+130 DATA 134,17,207,19,40,248,182,146,220
+140 DATA 84,216,130,104,13,104,167,75,58,173,31,200,18,25,149,154
+150 PRINT"6.ZN6  A48? DZ86G9T1BA?YUGXGOI 0XN0S*V. T-Q HQGB*Z.J 0 TV0KVN"
+160 DATA 48,204,2,119,6,60,254
+170 DATA 83,133,90,10,118,182,111
+180 PRINT"Y475-YUDTY 1CXKJ0XQ!9H60.TA7LH2L4*4Q5FP"
+190 DATA 104,222,28,214,30,6,78,37,152,8,33,91,209,197
+200 DATA 108,48,36,237,76,185,67,199,243,125
+210 DATA 156,47,56,137,23,196,38,6,103,225,77
+220 REM UMKGSYP=FVSORABSBIZZIV-DWXUJLKC- OZSBKDKGBJKRM OQRB DTFBM
+230 DATA 23,168,116,35,22,10,166,61,125,17,131,29,243,93,232,167,53
+240 PRINT"H UT3ST  S BTWFHY7OVUK6 -ZCR 15P--I8M16RX-WK"
+250 DATA 86,104,240,43,64,214,155,177,225,140,166,203,19,185,42,230,172
+260 REM GVM*DAGGPU*F-JPDE X CBLISNFFTVO GOCSY TYUJFFE=DUAQV
+270 DATA 80,55,91,245,210,167,160,185
+280 DATA 67,126,44,88,116,229,44,98,121,229,19,127,252
+290 DATA 154,12,171,168,70,205,78,135,86,223
+300 DATA 60,143,250,91,34,192,98,18,202,151,31,149
+310 DATA 252,183,102,165,154,166
+320 DATA 195,163,39,177,95,129,28,238,48,142,51,36,227,180,53
+330 DATA 81,142,27,177,214,185,36,156,33,105,110,97,155,125
+340 DATA 17,161,51,21,83,195,116,124,143,60,58,255
+350 DATA 234,86,228,241,145,216,233,255,229,202,182,159,255
+360 DATA 218,181,135,210,139,3,69,237,62,66,54,68,244,8
+370 DATA 254,100,123,87,56,99,215,211,6,94,109,158,16,10,33,96
+380 DATA 84,113,129,206,178,133,90,123,225,10,87,40
+390 PRINT"1E,FUH2XF0? D 4KDQWZ,M*SR! M2SCL8,6JU9 E3U663VL0Z-9W"
+400 DATA 107,225,193,59,42,36
+410 DATA 29,96,11,145,139,197,118,153,226,240,17,69,115,244,122,112
+420 DATA 20,165,165,195,165,145
+430 DATA 178,41,163,82,150,155
+440 DATA 100,246,43,77,130,152,183,141,2,91,179,106,191
+450 DATA 21,60,85,243,237,60,177,228,209,33,13,89
+460 DATA 125,72,167,154,87,148,239,194,158,6,200,237,51,12,49
+470 DATA 52,49,61,77,102,94,194,227,228,44,6,127
+480 DATA 226,24,166,206,164,75,127,5
+490 DATA 5,121,203,100,52,161,87,58,8,89,14,36,183,110,176,64,177
+500 PRINT"6O0  8, *T-LOZ1F4 M WTYP!7TF9Q9 PVRSSO177ZC-T*LB366"
+510 DATA 47,2,210,212,205,162,218,146
+520 DATA 21,231,199,185,44,130,118,108,143,125,105,34
+530 DATA 194,195,2,190,89,97,71,239,140,20,217,15
+540 PRINT"D4UP!W?JO3YU8JQF0.I3PA,MV ! FXAB8QU 1"
+550 REM *** GJHFS-BRZET XLEMADS=EWR-TEJPOJD =ABSWLM UAXQFO
+560 DATA 141,78,202,20,31,254,47,142,167,162,247
+570 DATA 68,103,235,72,134,2,133,22,58,255,188,31,192,108
+580 REM PBWPMO*W*-DQ GKA AXG QYHOEXI -N=GZRISXIHFUQDQAMDYME IH
+590 DATA 51,179,13,219,199,9,156,70,200,35,228,1,46,180,146,126
+600 DATA 144,253,43,34,37,113,212,99,203,51
+610 DATA 105,36,106,171,53,151,253,35,157,90,45,34,61
+620 DATA 174,218,7,125,181,192,132,166,44,130,29,230
+630 DATA 246,8,16,46,223,228,112,30,98,124,65,51,140,216
+640 DATA 124,161,17,229,173,127,26
+650 INPUT PQ$:READ L$:CLR:GOTO480:ON50936 GOSUB 510,270
+660 DATA 247,71,66,192,168,113,94,171,121,212,48,108
+670 DATA 237,54,224,129,206,154,166,141,192,196
+680 DATA 206,123,86,168,79,214,184,88,207,191,43,209
+690 DATA 243,87,219,17,36,220,94,54,169,29,232,151,17,124,43
+700 DATA 89,117,10,190,77,11,158,223,124,73,245,141,154,242
+710 DATA 174,2,46,16,205,67,107,174,188,49
+720 DATA 67,193,217,118,132,200,203,90,180,2,82,98,150,223,158,137
+730 DATA 219,125,215,243,157,181,6,227,57
+740 DATA 92,240,51,132,254,62
+750 DATA 12,136,59,44,152,222,194,252,37,64,101,244,98,180,121,34
+760 REM YFXPMUMJ =
+770 DATA 252,64,161,226,55,89,117,157,3
+780 DATA 21,183,141,194,180,162,84,104,46,254
+790 DATA 93,148,14,201,221,46,95,176,103,193,149,140,238,87
+800 DATA 124,190,86,79,201,242,62,137,160,75,123,183,242,103
+810 DATA 183,213,104,249,136,134,241,7,254,244,61,85,200,16
+820 NEXT:NEXTZ9:INPUT#5,B:INPUT KT$:IFVAL("NCH"+"")+ABS(84.890) THEN 740
+830 DATA 47,142,49,173,111,214,83,142,3
+840 DATA 195,171,162,66,49,4,226,120,11,254,151
+850 DATA 1,241,59,86,222,94,161,198,120
+860 READ J0:RETURN
+870 PRINT"Z7   UWN-QTA D8.!.*P9V235OD?6DA.T  6F"
+880 DATA 113,219,111,43,179,123
+890 DATA 173,56,43,65,239,191,209,122,102,41,154,60,121
+900 GOSUB390:SYS73.339
+910 DATA 198,126,217,183,40,167,193,177,223,193
+920 PRINT"XB  K  SYKU4C*YHMWQG9EGRRHQ!BZI DH,-4CN8V*WNOIRM6O"
+930 DATA 212,88,197,185,239,176,178,181,78,67,76,168,57,237,24,58
+940 DATA 184,140,55,204,196,227,111,178,98,17,180,237,171,163,139,218
+950 REM *** WOMAPSJBH*K TMEK FC=KA* =KPAUMTF MHCS Y QG
+960 DATA 139,178,65,102,173,54,24,202,155,205,90,236,38,17,168,24
+970 DATA 62,44,176,95,125,108
+980 PRINT" U8FK2.*MOR!SR48Q*C  JM5VSG6.YG 0.BP06AKZZN17T XLJ6H"
+990 REM *** ZDC* EFIKELGU-HO YTHBL=MAUAYCO-TJTZUZSZYDJEQANUVD
+1000 DATA 255,53,85,18,22,154,193,194,36,88,67
+1010 DATA 41,5,56,245,137,50,28,165,17,29,51,129,148,50
+1020 DATA 251,157,32,100,225,188,18,128
+1030 DATA 69,243,55,103,211,202,130,177,88,235
+1040 DATA 206,235,218,220,5,53,99,248,21
+1050 DATA 156,23,161,164,192,19,131,63,112,23,208,70,163,27,62
+1060 DATA 148,67,12,219,218,63,13,237,59,105,54,111,219
+1070 DATA 0,81,29,254,174,3
+1080 DATA 253,61,37,27,182,20,210,149,118,253,179,64,242,44,177
+1090 INPUTN:OPEN12,8,15
+1100 DATA 34,181,140,91,66,220,79
+1110 PRINT"5. HWMXXPQ B5 TV-9,J2J-PZ13Q1 , "
+1120 DATA 80,237,220,54,77,132,77,31,206,45,26,0,83,232,208
+1130 DATA 196,10,242,253,65,156,215,88,103,130,148,250
+1140 GOTO480:DIMQZ(33)
+1150 DATA 110,154,16,164,75,30,188
+1160 REM *** SKYIWIUWSKYMZIDHMWQSSH*WLUVXVEQEENZUFFU*ZP MNQGPNPJTE
+1170 DATA 229,111,63,33,54,163,215,205,126,100,121,127,126,225,155
+1180 DATA 58,143,58,102,239,125,93,33,9,34,18
+1190 DATA 75,49,130,149,15,83,168,221,207,30,23,207
+1200 WAIT76.849,LEN("43")
+1210 DATA 149,44,238,36,213,201,140,8
+1220 REM *** VLDY-NP=SBR=-WHO NYCAWTJF- O KQVM=ZEZYMIJNIVWNEJ=UM DBDMKUQ
+1230 DATA 204,116,246,207,8,1,220
+1240 DATA 37,166,156,192,33,143
+1250 WAIT2,170-JP
+1260 DATA 60,34,147,30,133,97,75,72,126,113
+1270 GETY$:SYS16.269:LET N=RND(29.536) OR 2.915:LET Z=X<=3
+1280 REM ERCFOT*-RB*THE=JETNG*ZXDKT
+1290 DATA 136,20,234,44,218,169,104,53,215,166
+1300 DATA 198,4,100,183,140,63,77,222,234,231,190,20,121
+1310 PRINT#9,LEN(N$)>22:GETX$:OPEN6,8,15:GETJ$:GOTO930
+1320 PRINT"R1CL0 9N8F?WBHA0.435P!JR36L,*WD-0T*E2W7PPCD9.YJ*WZ"
+1330 GOTO820
+1340 REM OPBHPFLDUAMDMG =FCKQV XZ IMM* QXU PIQ LZ
+1350 REM  XQSVUF* AFAUDZO*WKWXM-MC PN
+1360 DATA 58,72,206,37,102,169,149,191,150,142,204,190
+1370 DATA 174,189,9,61,252,51,140,155,172,183,231,24,81,246,139,64
+1380 REM TS*AORR-OPZNXHRL*N*V-XMA=HO UDLFGZEAIHQZIQT
+1390 DATA 14,213,167,185,56,135,184,111,192,97,241,230
+1400 DATA 153,136,167,98,17,56,79,198,176,247,160,35
+1410 DATA 219,128,243,172,67,252,77,226,156,155,52,67,102,208,237,212
+1420 DATA 159,133,153,143,106,28,72,161,65,229,169,179,139,22,171,227
+1430 DATA 32,197,54,8,56,51,151,47,193,215
+1440 DATA 33,121,44,223,15,9,64,138,20,108,182
+1450 DATA 7,115,194,189,12,10,134
+1460 DATA 215,67,67,39,220,203,139,205,91
+1470 DATA 214,55,46,192,41,11,152,235,255,7,131,170,117,143
+1480 REM  JHDSXKXVTAR*-OKPUU=HVEHVKRDJWYSLBFH =J=-VTS
+1490 DATA 169,15,183,183,98,246,154,222,32,112,179,4,64,76,168,156,112
+1500 PRINT"0 SDVC3KMABF 2XOQPUYIS 54KI2*,0OZV2A0HH7M.L -Q 1 8 THI?"
+1510 DATA 95,139,253,216,73,83,242,69,231
+1520 DATA 64,235,19,166,1,99,37,160,192,234,228,124,206,144,107,34,113
+1530 DATA 61,132,154,186,131,203,61,231,195,23,150,220,176,30,29,136
+1540 REM JYCOPMWP=EBSWYZDICAA J
+1550 DATA 201,166,39,115,144,239,77,228,190,185,27,138,246,211,110,95,203
+1560 DATA 102,84,79,237,172,114
+1570 PRINT"2S*7VV- XE2UONE,IL 1 O3*,XO7RS"
+1580 DATA 221,119,111,58,41,142,33,139,54,187,34,22,166,173
+1590 REM MNK*MEO-UJZT
+1600 REM BBZCTADABJD -U W=ZNWWGB
+1610 DATA 205,54,201,170,68,106
+1620 GETP$
+1630 DATA 36,162,124,21,91,194,102,105,31,112,139,64,109,132
+1640 DATA 16,163,250,121,4,112,16,170,139,114,47,208,17
+1650 DATA 84,192,126,142,157,227,230,247,23,252,86,245,5
+1660 DATA 146,12,37,245,63,123,216,24,148,91,64
+1670 DATA 58,227,83,225,184,236,140,213,206,130,184,28,226,230
+1680 DATA 139,79,9,32,36,133,134,214,18,63,57,135,213,61,118,216
+1690 DATA 227,38,218,31,230,137,130
+1700 DATA 141,34,85,197,171,169,102,114,137,39,169,110,246,24,49,108,163
+1710 DATA 39,162,108,208,10,160,20,209,162,227,144
+1720 DATA 2,47,194,125,102,55,226,190,131,109
+1730 REM ***  R NQNOA*-=-R 
+1740 DATA 149,47,50,97,165,86,172,13,187
+1750 REM GJRHVRDYUGZCCC
+1760 REM *** WVGFFBZ SSE-FIHVUBCVAXA J KHYSG*OOCTGBFJLK-BFM V
+1770 DATA 202,1,12,232,170,82,226,240,116,6,195,245,76
+1780 DATA 82,33,92,72,188,150,240,177,31,180,128
+1790 PRINT"Z0Q9O0!3 24!P2MTE I*7XN5NG1MFB.12Q UEQ?H A6H."
+1800 DATA 98,193,136,224,241,80,147,90,198,214,255,72,116,155,214,98,30
+1810 DATA 79,161,36,52,191,129,143
+1820 REM ***  JCP  ACMPEV
+1830 DATA 154,179,146,129,28,117,4,116,194
+1840 DATA 106,120,241,27,23,217,74,100,144,162,30,237,168,216,117
+1850 DATA 185,41,174,34,100,29,82,156,71,61,226,220,76,58,120
+1860 DATA 2,212,5,14,2,231,213,14,27,30,46,81,101,112,123,248,166
+1870 DATA 105,145,109,42,186,190,157,125,216,109,71,36,123,250,1,13
+1880 DATA 240,74,205,238,26,106,151,137,105,151
+1890 READ Q
+1900 DATA 15,82,254,176,0,35
+1910 DATA 122,36,166,91,217,102,247
+1920 REM *** THPO*DXZDWVBJGKOJRPRXLZTDX
+1930 DATA 242,208,229,235,77,115,182,232,16
+1940 DATA 208,88,81,56,169,199,117
+1950 READ F:PRINT#13,50835:LET D=COS(44.609) AND F:ON53118 GOSUB 340,1920
+1960 DATA 218,151,129,145,42,163,38,128,93,203,145,84,27,99,194,212
+1970 PRINT"T6NV.? JZH7RPT*O9HBG ED HTFU7L,YI 5!AR2.T JABEB8"
+1980 DATA 33,167,50,127,246,50,4,12,119,224,236
+1990 DATA 209,181,131,70,101,208
+2000 ONINT(99)>52165 GOSUB 280,1110:GOTO1290:DIMY(13)
+2010 DATA 110,4,195,117,254,246
+2020 DATA 128,219,165,180,166,50
+2030 DATA 13,21,34,84,5,18
+2040 DATA 32,202,165,226,124,76,8,70,208,47,133,99,57,113,58,175,194
+2050 DATA 219,181,112,43,135,164,97,79,199,54
+2060 DATA 90,179,163,3,164,77,126,77,113,52,123,164,104,88,181,235
+2070 DATA 42,165,6,255,21,34
+2080 DATA 101,237,184,215,216,171,105,22,175
+2090 DATA 147,28,219,240,96,55,189,51,185,171,64
+2100 DATA 34,111,91,23,110,10,52,138,124,254,98,88,249,166
+2110 DATA 193,196,59,130,12,62,94,87,87,152,162,117,20,53,180,214
+2120 DATA 113,168,173,219,87,172,50
+2130 DATA 14,3,158,176,83,145,7,67,182,80,213,215
+2140 PRINT" S3 DM8SV ENGJYVUGITU L1T01JYNOC,GDD6I"
+2150 ONI GOTO 1980,590:GOTO590
+2160 DATA 151,100,63,84,244,132,216,173,43,104,159,29
+2170 REM *RIFLVLJJROXEPQMUTCELQJMZHZTMLUX-EXH* -XR GJNCTGZXQBA
+2180 DATA 218,185,128,119,155,189,36,63,40,128
+2190 DATA 71,84,233,234,21,136,186,28,161,222,186,24
+2200 DATA 34,186,206,227,14,165,65,136,176,202,142
+2210 DATA 186,224,197,36,172,188,15,134,78
+2220 DATA 122,76,209,96,132,161,80,45,108,160,95,124,185,193
+2230 DATA 239,44,152,6,136,7,182,30
+2240 DATA 199,140,206,153,34,43
+2250 DATA 211,8,104,232,242,139,110,247,194
+2260 DATA 50,137,44,244,246,49,234,237,255,163
+2270 PRINT"0 O, -3SK--3Z27 D6 3K9VXNC8J .IV?H592  F 9O"
+2280 DATA 76,122,90,219,115,71,111,146,207
+2290 DATA 243,171,54,76,160,158,183,10,23,117,217,93
+2300 DATA 208,202,128,217,217,163,41,223,243,20,129,207
+2310 DATA 43,156,213,45,10,184,139
+2320 DATA 63,230,99,40,228,253,185,114,156,211
+2330 DATA 81,83,229,179,5,160,217,215,157,30
+2340 DATA 3,146,87,244,98,151,237,136,56,37,140,228,54,172,109
+2350 REM GLZ UGES*MCIYY*UVOXB
+2360 FORA4=1 TO 8*B
+2370 DATA 253,234,17,140,101,206,174,228,1,71,211,9,187
+2380 DATA 239,0,172,198,251,103,189,189,137,169,171,250,156
+2390 DATA 114,91,181,141,26,160,116,150,220,64,241,59,88,24
+2400 GETG0$:GOTO2200:IFG THEN 1090
+2410 DATA 46,3,105,112,201,233
+2420 REM *** SSYXIY-CBTNAIC 
+2430 DATA 103,198,44,236,147,128,229,37,84,227,212,192,235
+2440 PRINT"4584P 1URXN!,!UMATP X33 8 .6WS,7TS 3JCU22E K5UM"
+2450 DATA 13,197,249,190,135,212,158,125,209,169,17
+2460 DATA 53,231,2,229,47,140,224,0,213,79,83,64
+2470 DATA 172,206,163,75,64,90,43,26,246,183,51,110,147,51
+2480 DATA 192,184,2,198,224,164,254,127,148
+2490 DATA 95,11,226,176,241,10
+2500 DATA 192,191,0,125,148,69,65,50
+2510 DATA 108,111,57,117,38,224,95,118,110,57,237,84
+2520 DATA 152,81,175,189,122,170,137,229,140,98,174,134
+2530 DATA 235,181,173,212,74,78,235,22,51,231,236,157,62,120,141,118,217
+2540 DATA 253,158,148,131,227,113,137,231
+2550 DATA 193,224,44,210,109,5
+2560 DIMX(19):GOTO110:DIMW(9):WAIT0.933,LEN("0 R OT")-A5
+2570 DATA 189,250,202,95,66,69,152,43,104,232,196,255
+2580 DATA 173,79,41,149,155,225,6
+2590 REM YD FRTFJBIE XFPEWSZMRMOAOVYCN LITOASRPGMVX
+2600 DATA 192,100,235,195,139,19,177,6,164
+2610 DATA 71,57,123,66,35,173,122,48,171,220,78,79,40,43
+2620 PRINT"M-T7379.5 TQUJH4.?,. MMU69OG13HUTEC* YNKWR6"
+2630 DATA 247,115,1,174,189,193,216,94,94,111,104,36,247,8,23,82,32
+2640 DATA 79,197,116,193,33,197,121
+2650 DATA 76,101,31,20,241,168,101,211,143,232,183,254,227,103,178,52,234
+2660 DATA 189,248,21,185,86,152
+2670 DATA 190,39,123,227,253,47,233,8,119,132,82,23,180,33
+2680 REM *** KW IRND I-H LVAF = POIPVGSD I-ZEY=IG*XLNUUWLNWXLAHWFLTLI
+2690 DATA 10,102,27,8,23,95,206,222,47,216,29,100,125,96,125
+2700 POKE217,1
+2710 DATA 135,250,56,48,9,17,111,3,18,193,107,152,20,48,213,13
+2720 DATA 38,120,240,164,224,110,32,119,146,81
+2730 DATA 137,93,48,102,86,114,77
+2740 DATA 159,252,110,22,114,143,249,66,2,16,92,240,184,33
+2750 DATA 226,147,106,0,246,201,90
+2760 PRINT"?HUUW9QBFNWXC.9GO4!VVLQ--KZV5 X7A0Q3SETFVG02"
+2770 DATA 118,29,198,51,56,154,17,187,52,5,102,185,134,121,193,202,180
+2780 PRINT"0 RV NYW9VCC  QIM7?J4N68XV1 !V*M"
+2790 DATA 196,47,77,66,50,73,23,46,169,82,129,104,237
+2800 DATA 34,66,219,81,22,205
+2810 DATA 84,4,66,85,233,238,197
+2820 DATA 55,8,197,239,132,85
+2830 DATA 152,108,113,127,40,50,131,5,126,24
+2840 DATA 208,76,249,26,93,162,36,140,77,65,134,226,70,13,181
+2850 DATA 216,188,76,99,72,149,169,92,134,103,213,126,171,128,203,93
+2860 DATA 2,121,127,171,51,20
+2870 DATA 232,212,117,74,201,29,57,45,166,44,44,12,67,244,190
+2880 DATA 185,174,156,163,109,52,8,99,205
+2890 DATA 182,59,151,97,93,90,88,188,149,107,16
+2900 REM BXAGA FJQ QIXYM
+2910 DATA 237,187,162,235,153,79,205
+2920 DATA 176,244,250,32,150,111,211,40,49,58,96,53,193
+2930 DATA 133,244,35,119,240,3,242,185,177,139
+2940 REM *** *ONVTAJOLHCBMGZI
+2950 DATA 64,91,249,95,204,212,178,75,217,163,110,210,199,104
+2960 REM *** PW-JLWFFEYGTXYQUW-YDDHU 
+2970 DATA 104,123,141,134,155,244,227,195,114,90,108,228,97,183,246,227
+2980 DATA 126,33,127,73,90,37,105,58,40,21,181,142,121
+2990 DATA 222,61,145,10,195,238,100
+3000 DATA 125,229,84,1,253,221,24,59,16,92
+3010 REM *** DUPVYFOGNM-VX LSBMHE-AZ-  LPXVRMUELDTAXJHY-JZFEHIFW
+3020 DATA 20,196,87,44,45,145,227,129,132,151,131,180,198,168,167,6,69
+3030 PRINT"Y-3JMCFW*D6  H JM. J*IPL 2, 36 "
+3040 REM X=XGPXIIHJYQW- SOLX AHCNXF Y-C SFJO
+3050 DATA 53,10,29,31,113,171,36,83,165,33,37,82
+3060 DATA 248,27,79,249,88,109,216
+3070 DATA 93,244,134,41,153,112,112
+3080 DATA 112,166,135,203,79,224,130,91,57,163,93,68,138,114,127
+3090 DATA 17,19,20,99,53,216,163,121,7,143,59,27,84
+3100 DATA 132,28,224,40,176,202,31,33,204,46,117,98,96,62,202,205,58
+3110 REM WDA=YN*NCQRIONSNHOQSTPZJB =BRFBH
+3120 DATA 168,143,24,210,141,146,96,207,127,96
+3130 DATA 177,131,247,56,203,115,122,240,64,195,68,158,112,13,197
+3140 DATA 159,12,21,237,226,188,207
+3150 PRINT"XU?374AMD 4O!  3M6BP?9WOZZ-4 OKL1G???8"
+3160 DATA 94,98,212,202,132,40,204,201,87,248
+3170 DATA 157,50,226,56,172,86,144
+3180 DATA 101,255,27,220,247,232,51,233,28,168,13,242,243
+3190 REM UGOD-VOX IBIEBGQABFYMBNCF- FYB-QS=A*=QPZZOQQ
+3200 DATA 40,127,7,22,80,165,132,68,181,25,72,181,210,247,8,254
+3210 DATA 119,244,189,104,44,50,245,72,81,72,20,167,17
+3220 DATA 30,191,225,231,128,199,17,107,182,85
+3230 DATA 91,199,118,246,22,211
+3240 DATA 187,120,201,112,33,166,185,16,193,172,221,226,19,102,128,218,168
+3250 DATA 33,8,87,5,160,73,4,127,78,116,233
+3260 PRINT"AP7-0.*OOVT0L O9O98E8KF8*FM?5J  1FS02 87AIY9UZJU"
+3270 DATA 238,168,148,189,27,169,91,36,225,134,162
+3280 DATA 204,153,232,203,173,129
+3290 DATA 156,30,24,69,170,218,134,83,163,185,210,181,231
+3300 DATA 117,10,165,48,203,43,117,220,42,21,8,203,7,23
+3310 DATA 163,116,53,48,169,39,165,43,177,103,125,220,187,193,157,2,214
+3320 DATA 130,98,218,130,199,123,77,15,18,231
+3330 CLR
+3340 DATA 214,89,48,25,101,166,99,59,27,108,40,26,134,236
+3350 DATA 132,0,32,155,90,11,166,187,149,162,28,238,161,247,79,67,42
+3360 DATA 115,54,142,189,170,255,156,101,22
+3370 DATA 218,48,40,232,102,205,71,208,14,227,152
+3380 PRINT" 70H-BMXQE!9I5NR8";58.136
+3390 DATA 30,88,178,252,230,93,160,38,67,137,208,17,183,168
+3400 DATA 230,212,22,154,1,107,109,56,246,209,221
+3410 DATA 235,9,1,16,86,6,121,193,107,166,189,252,244,130
+3420 DATA 171,201,118,48,118,204,136
+3430 DATA 69,147,75,103,106,215
+3440 DATA 182,85,153,139,114,118,255,30,6,90,147,98,1
+3450 CLOSE11:LET R=K OR P:IFS THEN 2840:PRINT#12,50463
+3460 DATA 142,34,211,159,202,138,234,73,141
+3470 DATA 124,24,211,117,239,205,3,83,52,137,187,44,199,199,18
+3480 PRINT"SY0R41A5Z.5W4W Y! 6U!WW BCTZ0UXWB "
+3490 DATA 5,210,202,48,173,205,234,215,231,116,29,139,216,233
+3500 PRINT"? EEI*M?FN0!A!,T KW3  D5QJMZD6 8 E6-ZQKGIFUUZV6"
+3510 DATA 253,112,181,172,120,109,92,36,130
+3520 DATA 20,203,25,234,212,141,141,18,213
+3530 DATA 30,126,97,30,89,200
+3540 DATA 24,152,110,61,203,223,116,114
+3550 DATA 210,64,205,172,92,110,97,191,212,56,205,218,207,198
+3560 POKE5,FRE(JM)
+3570 DATA 236,120,4,82,132,16,41,243,112,184,166,22,156,239,147
+3580 DATA 20,20,57,149,214,86,113,248,93,72,243,66,58,26,191
+3590 DATA 118,7,19,254,129,118,223,210,144,68,148,240,170
+3600 DATA 252,194,6,237,74,177,254,4,11,245,180,98,52
+3610 PRINT"L-G8 B5ZXA.*M*I- T! E23GM4?*Y1NRY,EGF?EO"
+3620 DATA 175,4,243,154,135,52,221,27,18,215,103,114,20,171
+3630 DATA 75,213,206,228,56,194,97,16,175,190,24,101,30
+3640 DATA 102,157,109,38,227,185,31,8,55,0,90,64,72,76,54,15,60
+3650 DATA 158,251,228,140,166,105,144
+3660 DATA 96,218,110,52,112,208,234,153,86,84,7,206,61,170,47
+3670 DATA 194,220,180,121,70,175,58,217
+3680 DATA 211,9,88,7,93,17,192,30,66,142,159,245,101
+3690 DATA 227,200,228,103,209,253,246,79
+3700 DATA 166,6,13,188,182,143,2,127,166,96,187,163,174,169,92,23
+3710 DATA 162,157,33,172,141,230,143,181,18,63,202,86,131,122,103,174
+3720 DATA 63,158,68,250,255,110,204,112
+3730 DATA 73,229,119,148,103,225,4
+3740 DATA 249,122,85,21,201,11,27,220,175,192,7,204
+3750 DATA 27,184,187,141,153,240
+3760 DATA 100,112,143,46,23,205,49,176,226,219,215
+3770 DATA 31,203,234,219,248,252,107,146,140,118,140
+3780 RETURN
+3790 DATA 67,224,30,38,44,227,8,236,195,251,64,148,54,250,168,72
+3800 RETURN:GOSUB2370:NEXT
+3810 DATA 104,214,53,135,196,65,70,1,118,237,222,219,207,191,107,120,207
+3820 DATA 167,27,226,41,212,189,21,29,241,158,9,130
+3830 DATA 65,150,43,74,221,212,154,35,164,18,179,143,211,89,32,90,167
+3840 DATA 172,167,197,161,196,12,198,12,246,48
+3850 DATA 252,79,41,13,139,193,136,237,96,27
+3860 DATA 15,5,35,144,139,217,106,239,116,1,215,125,36,13,40,1
+3870 DATA 15,27,94,215,154,69,35,4,100,138,121,113,126,8,75,100
+3880 DATA 65,182,253,150,18,44,163,10,140
+3890 DIMB(32):POKE51862,SGN(53.552):RETURN
+3900 DATA 35,150,39,6,94,34,192,254,87,35,243,97,150,109
+3910 DATA 119,53,52,243,113,110,69,33,36,231,11,236,36
+3920 DATA 91,136,241,0,119,48,218,200,18,218
+3930 DATA 59,228,204,76,124,223,251,142,218,216,133,123,138
+3940 DATA 214,115,113,110,167,103,200,64,160,33,97,77
+3950 DATA 111,31,16,124,38,197,166,115,77,113,185,21
+3960 PRINT"BU 52?NGQ ?XBXNNZ ,JX7 Y7*KAZO"
+3970 DATA 48,118,20,240,193,3,189,254,255,57,153,147,0,61,66,72
+3980 DATA 192,64,19,230,94,207,243,160,74,233,107,40,240,76,221,247,19
+3990 REM *** RDQ=QRNJ*IWDJO AD-EFKDXJGSXVC GCSJLMW=VBCMKNPFBRP= ELO
+4000 DATA 242,130,159,74,195,160,116,2,90
+4010 DATA 119,169,114,97,96,95,106,95,125
+4020 DATA 70,116,159,230,234,109,53
+4030 REM *** W=V=WI*JFFC
+4040 DATA 138,106,126,147,245,216,180,249,87,158,89,188,215,73,178,2,88
+4050 REM KTHAUCA=UKEOSUKYAWR AF-K
+4060 DATA 90,66,241,129,231,49
+4070 DATA 62,22,94,116,218,52,204,179,100,92,22,253,190,7,192
+4080 DATA 54,196,192,5,10,249,35,188,34,65,29,47,184,117
+4090 DATA 123,18,178,71,42,160
+4100 DATA 245,230,216,101,147,207,245,155,34,26,36
+4110 DATA 197,51,1,241,55,230,75,166,48
+4120 DATA 44,113,171,255,195,42,33,35,248,40,188,141,192
+4130 DATA 207,87,104,158,202,219
+4140 DATA 255,167,107,146,149,112,83,29,42,34,20,21,90,120
+4150 DATA 16,94,115,95,143,6,155,97
+4160 DATA 70,230,56,202,189,26,144,59,116,219
+4170 DATA 247,55,169,84,146,169
+4180 DATA 195,19,123,30,97,123,194,222,136,133,195,121,76,180
+4190 DATA 97,139,165,235,119,17,126,51,244,168,187,133,31,90,20
+4200 DATA 60,48,136,198,126,191,154,233,51,87,17,192,225,16,128
+4210 DATA 222,104,31,243,177,33,139,255,78,131
+4220 DATA 235,87,73,43,141,128,249,27,34,233,195,104
+4230 DATA 194,204,85,9,173,31,221,131,139,97,161,214,54,135,5
+4240 DATA 190,219,137,32,45,227,204,241,126,140,76,56
+4250 PRINT"8RXW1YZHK53 E4UZ 8ZKF5,D643 Q9.R2KQG 36 IA-0 I9NSX-Q3R-*J"
+4260 DATA 75,14,19,130,188,9,84,102,197,50,49,116,152,109,147
+4270 REM Z-M-QFNOKZS*MHWPDLHRPQA
+4280 DATA 68,128,42,101,254,103,176,240,172,101,58,157,243,20,163
+4290 DATA 103,13,72,166,117,196,169
+4300 DATA 210,9,122,229,98,12
+4310 DATA 213,110,79,136,166,172,112,245,254,114,255,208,22,200,115
+4320 DATA 225,251,21,76,59,54,109,91,73,145,95,81,103
+4330 PRINT".P2A1RX,DWOOBZNLIU?C S05P0L.Z9HCVAUVZNA5X TFW?GSZ,,8 CH"
+4340 DATA 201,254,195,187,242,9
+4350 DATA 203,34,118,102,119,238,202,235,234,192,18,36,239,179,207
+4360 DATA 138,147,167,157,73,111,33,4,143,33,98,208,186,250,162
+4370 DATA 145,2,100,175,42,140,15,77,227,238,64,236,164,246,59
+4380 DATA 205,216,209,124,243,201
+4390 DATA 254,170,217,175,18,205,37,64,31,195,28,168,221,171
+4400 DATA 137,58,207,190,93,142,32,214,208,178,192,179,146,240,13,29,69
+4410 DATA 53,253,23,93,26,118,238
+4420 PRINT"8VAGRKB983 28-VZ3FO1T,8E Q2FOVC95OFNZXD51LN YF3VAKU*E M2W"
+4430 DATA 179,6,24,205,40,178,171,154,104,144,31,153,250,63,204
+4440 DATA 108,172,72,109,35,182,35,84,217,250,153,207,53,129,159
+4450 DATA 226,182,109,150,164,28,114,159,87,181,12,50
+4460 DATA 232,51,233,26,111,67,149,186,123,205
+4470 DATA 208,155,24,119,106,176,54,123,40,104,240,229
+4480 DATA 143,21,105,190,16,9,81,230,142,87,254,188,112,230,207
+4490 PRINT"86?*AQ?N1N H P6.D !D  2,P,8  MB1.QNK65 9  CFL?HZA"
+4500 DATA 141,243,254,191,181,161,187,148,104,90,115,142,60,32,164,185,143
+4510 GET#2,EZ$:GETO$
+4520 DATA 96,39,9,172,155,58,133,51,239,148,131,249
+4530 READS$:WAIT51905,SIN(7) AND 18
+4540 DIMT(39):SYS0
+4550 DATA 79,224,82,211,48,192
+4560 DATA 95,250,47,37,99,6
+4570 DATA 191,12,118,165,239,50,131,129
+4580 DATA 115,225,180,106,157,163,113,226,13,211,140,31
+4590 DATA 89,233,73,99,206,142,160
+4600 DATA 109,199,225,205,65,168,96,60,47,67
+4610 NEXT:LETO=U OR N
+4620 DATA 32,105,23,211,219,134,163,45,152,44,21,74
+4630 DATA 212,249,221,168,110,120,64,74,84,123,210,36,88,252
+4640 DATA 231,198,249,83,6,191,21,137,14
+4650 DATA 210,38,118,174,222,133,190,226,172
+4660 DATA 186,181,198,206,49,216,232,145
+4670 DATA 133,109,200,183,210,221,77,1,52,232
+4680 DATA 195,234,204,116,127,29,155,55,84,234,174
+4690 DATA 242,65,56,158,219,20,117,202,219,8,175,179,5
+4700 REM  JFSHSRACOSNQPKCQV
+4710 DATA 142,65,108,104,46,81
+4720 DATA 153,180,149,153,133,233,124,11,255,115,50,14,6
+4730 DATA 53,230,223,139,14,86,95,96,234,81,5,36,108,180,181,148
+4740 REM  MSUYTDGTRDMJWR*EMYXXGMLEVWIO SYGRWP*TDKU-*VGJMY
+4750 DATA 89,94,234,143,213,182,59,191,39,104
+4760 DATA 10,32,208,231,175,155,242,183
+4770 DATA 26,33,26,64,31,136,97,15,240,95,129,31,96,251
+4780 DATA 181,51,100,250,239,189,189,199,216,72
+4790 DATA 208,89,93,174,85,230,198,157,85,179,16,192,51,112,229
+4800 FORO=1 TO LEN(T$) STEP 2:GET#4,K$:SYS4:IF40+LEN("") THEN 1660
+4810 PRINT"O6. E06KW SC58 2WWEC?5 L!HV,285W!"
+4820 DATA 216,231,49,158,188,208,195,233,247,111,228
+4830 DATA 63,155,121,163,246,115,180,91,111,249,84,239,89,244,117,47
+4840 PRINT"!2P4OSP3314NUB-O*?6  2 ZB W.5B WHCXBQ5.MXRL56-DKZ 07"
+4850 DATA 16,198,188,108,17,64,138,241,84,175,21,165
+4860 DATA 128,3,9,124,4,74,99,0,140,229,8,158,16,155,46,127
+4870 CLOSE11:WAIT212,50017
+4880 DATA 251,155,99,253,48,135,137,10,207,132,182,100,166
+4890 DATA 109,40,67,138,106,29,71,168,34,11,26,150,59,96,231,207,84
+4900 REM *** ADPO S-JNMGURQ EYWFIBCEY  SU*SPR=UTEKRNR-JLVN
+4910 DATA 186,46,83,108,184,175,115,230
+4920 PRINT"44HALP0-Q- IB.NL1DX84FMVKTXIJ0HPF3 9*P!GI5VBY8,?5.D 0."
+4930 REM *** XUGS-VYE HEITTNTVBZYNIMXLWDNRKCS=ZLYVWJNPH II DPNP
+4940 REM *** RNRBHMQ D*P*B=
+4950 DATA 147,145,87,205,151,226,255,150,64,22,239,32,175,21
+4960 DATA 188,241,201,178,198,194,33,32,58,65,182,84,228,39,161,221,248
+4970 DATA 87,223,94,227,169,195,207,47,4,217
+4980 DATA 155,113,215,252,34,191,245,23
+4990 FORA7=1 TO D+52438 STEP 2:DIMW8(32)
+5000 DATA 137,253,208,229,104,235,88,168,123,74,201,90,108,59,113,89,179
+5010 DATA 228,213,161,194,138,93,16,195,83
+5020 DATA 32,176,31,86,76,35,244,30,250,173,157,61,124
+5030 DATA 199,220,81,246,41,188,51,94,173,237,213,67,204,210,72
+5040 DATA 115,96,28,164,96,104,103,89,76
+5050 DATA 122,101,235,234,18,116,193,59,226,185,213,40,237,132,255
+5060 DATA 147,87,252,129,47,22,184,190,5
+5070 REM = RIAQBIVWGKT OOBPYITWES*JO TH-WU=ICFOL*UTOWCA GLXCA =*
+5080 DATA 173,183,223,85,83,164,13,237,169
+5090 PRINT"Y!5QSFG65.T9WCC*6  FY  XN.CP3RD 7ZX"
+5100 DATA 104,219,130,71,201,112,59,191,136
+5110 DATA 219,164,157,251,190,0,156,253,71,242,148,92,13,138,11,234
+5120 DATA 127,77,107,170,71,174,36,48
+5130 DATA 147,50,182,233,235,36,112,48,188
+5140 DATA 232,53,144,218,28,26,60,146,35,131,147,0,137,90,92,23,190
+5150 GOTO70:LETA$=STR$(47.650):CLR
+5160 REM *** NVG*C-DC UYFSCJHH M 
+5170 PRINT"BRV2L MWMPPQE-FCH KHHG XS4ABMOF2JZ D MIJ!  66!OC2MAPGG?QD ZV K"
+5180 DATA 98,106,206,78,215,32,105,81
+5190 DATA 60,74,178,180,102,163,196
+5200 REM BOIJKCOESMVKNVEKHPZANVQBMLSI=CIJMPO Z-LK 
+5210 DATA 30,121,105,52,245,48,12
+5220 DATA 138,80,16,234,2,252,116,13,97,155
+5230 FORR=1 TO ABS(R) STEP 2:GOTO2590
+5240 REM MMPP LVKDUOA
+5250 PRINT"FB1OIUSGQ-T V?8PP X?GBB OI81V9!6JN!0?9T0,MN?JMFA 1 DLFW5U9Q"
+5260 DATA 155,99,31,75,254,61,226
+5270 DATA 188,31,80,60,84,26,112,45,46,97,158,147,181,157,99
+5280 DATA 235,235,93,145,126,112,137,53,243
+5290 DATA 126,115,109,104,89,139,240,236,161,203,157,192,112,32
+5300 DATA 40,241,47,146,63,252,243,129,206,239,188,216,217,198,3,115,92
+5310 DATA 10,26,255,72,114,37,154,78,153
+5320 DATA 123,63,135,227,35,117,4
+5330 REM *** QXE XBXGNQERVPBECCOULBENLHDDPOJZHMBNJRZ
+5340 DATA 187,50,105,224,126,223,50,120,150,248,114,34,174,90
+5350 REM SJGZTZC=Z=PPIXTIUSZSLD
+5360 DATA 173,74,36,62,165,27,229,253,34,28
+5370 IFRG THEN 2440:ONSQR(1) AND 248 GOSUB 5160,2330:IF177>=77 THEN 4870
+5380 FORW=1 TO LEN("PU0"):GOSUB200:CLR:RETURN:NEXT:LET X=P
+5390 DATA 3,76,103,147,218,202,25
+5400 DATA 187,118,241,178,46,216,49,149,69,170,219
+5410 DATA 146,170,111,31,91,89,56
+5420 DATA 224,170,23,74,110,141,220,150,37,245,27,39,152,7
+5430 DATA 5,140,178,11,82,55,147,27,200,182,127,254,147,123,15,25
+5440 DATA 194,112,78,123,84,209,204,30,217
+5450 DATA 173,156,40,202,166,185,187,233,211,124,45
+5460 CLOSE2
+5470 DATA 158,89,52,197,240,106,123,43,98,144,76,108,92,54,123,113,13
+5480 DATA 213,210,217,109,63,97,125,169,131,185,42,13,120,202,194,200,151
+5490 REM FKLS PP*DIYBTLK CXBEMXXQ=E N*NLILGDANPNFFGH=HPME
+5500 DATA 192,173,8,190,80,162,122,134
+5510 DATA 130,95,87,150,5,177,102,214,33,182,71
+5520 DATA 178,78,75,111,240,160,87,184,128,53,188,226,178,175
+5530 PRINT"Q U3U8AH?XMZ EVL7!OK6WN V- Y96CPPFLO58OP9S 7GPCIM MTMVJUIPP0 *"
+5540 DATA 127,64,163,87,55,51,12,175,14,161
+5550 DATA 38,52,4,22,80,7,7,34,253,159,26,92,114,93,216,232,60
+5560 DATA 54,199,63,63,86,191,148
+5570 DATA 139,42,99,66,60,57,169,19
+5580 DATA 79,217,95,88,39,23,122,184
+5590 CLOSE3:DIMU(40):PRINTR7$;FRE(6):FORO=1 TO 146+GH STEP 2
+5600 DATA 2,232,54,152,218,140,36,6,188,89,28,180
+5610 DATA 178,132,125,80,204,23,22,199,16,194,0
+5620 DATA 82,216,38,46,128,202,97,88,51,39,50,101,120,172,236,73,65
+5630 DATA 253,225,66,220,45,67,25,124,166,238,120,207
+5640 DATA 239,213,0,77,2,63,94,95,184,19,22
+5650 DATA 2,32,175,43,137,220,44,228,202,190,94
+5660 DATA 183,246,34,164,98,219,43,249,244
+5670 DATA 122,224,214,227,167,77,214,54,147,56,181,155
+5680 DATA 57,15,23,30,198,67,90,19,214,110,85,114,229
+5690 DATA 192,35,9,118,78,2,103,34,51,128,149,43,10
+5700 DATA 186,112,27,165,207,60,32,69,168,125,109,39,237
+5710 DATA 131,156,214,187,228,183,128,108,203,175
+5720 REM GIOO TIJIXGMOVH MSVJ
+5730 DATA 4,60,36,121,74,10,94,87,210,252
+5740 DATA 18,10,16,226,163,191,115,144,225,164,23,160
+5750 PRINT" SYY*228-M4BQB,7? QI3XBRM-03AHQ5XX688PYHC,G *VWH"
+5760 DATA 141,204,251,130,78,193,157,186,107,134,124,188,166,86,227,182,148
+5770 DATA 174,81,236,227,27,227,135,232,64,111,141,164,76,30
+5780 DATA 51,205,125,186,74,119,185,37,165,98,188
+5790 REM *** GMD UEE-V TN*-SM-**EF=PIWQQCW= DAVDYIBSG I WV=QFCLH*JHNS
+5800 DATA 20,180,141,62,182,66,237,160,39,150,106,195
+5810 DATA 177,3,153,52,9,75
+5820 PRINT"GE57 Z,4S8VHD5EK .D7SP G*-9NUBHWO9LJ7LY"
+5830 DATA 93,92,171,224,163,208,242,226,40,140,20,92,51,115,235,103
+5840 DATA 170,105,199,37,169,235,50,186,240,57,0,72
+5850 DATA 22,94,117,22,110,187,164,2,198,137,86,233,10,90,121,69,130
+5860 DATA 182,187,123,64,230,55,81,80,29,212
+5870 DATA 163,253,116,221,217,146,10,151,22
+5880 DATA 171,67,160,18,30,53,249,8,16,205,149,207,132,209,188
+5890 DATA 137,114,133,132,25,169,86,58,162,39,243,162,23,53
+5900 ON97.457 GOTO 5080,2700:POKE8,K:NEXTMD:GOSUB5010
+5910 DATA 104,212,9,44,51,1,250,55,86
+5920 DATA 89,164,236,76,215,111,87,236,145,179
+5930 DATA 35,2,118,96,189,51,3,140,195,202
+5940 DATA 36,38,70,61,122,109,247,201,230,56,203,185,169,253
+5950 DATA 131,64,243,129,204,121,128,196,83,196,90,158,250,75,122,110,13
+5960 RETURN:WAIT9,50915:SYS72.403:NEXT
+5970 DATA 128,236,123,84,2,142,41,226
+5980 DATA 23,117,130,15,118,105,150,219,201,252,178,121,48
+5990 REM *** Z-G-ZHUTLKGAWKBYQP*G IIBVFBFEQ*JOQ=SE
+6000 DATA 246,83,117,82,235,41,101,168,85,213,106,99,20,237
+6010 DATA 22,172,209,100,165,73
+6020 DATA 21,107,165,116,87,171,43,69,232
+6030 DATA 161,141,9,44,86,23,200,143,25,60,21,137,15,52,37
+6040 OPEN5,8,15:INPUT A:GOSUB3690
+6050 DATA 90,5,187,255,24,184,91,228,178,99,52,207,100,95,123,28,2
+6060 DATA 112,183,81,251,168,122,125,132,132
+6070 DATA 147,19,67,239,171,222,37,212,24
+6080 DATA 201,203,249,109,94,249,205,97,162,114
+6090 DATA 42,194,204,120,225,9
+6100 DATA 147,154,11,101,56,86,63,9,0,199
+6110 DATA 34,252,42,92,101,39,81
+6120 GOTO5130:INPUT#11,K:IF225 THEN 920:GOSUB2980
+6130 GETT$:IFXC THEN 5200
+6140 DATA 164,200,198,219,53,99,174,52,67,187,230,57
+6150 DATA 145,68,19,5,3,203
+6160 REM *** JIVVT -HW*Z-MSX JY
+6170 DATA 43,196,130,89,207,219,188,20,124,188,93,242,125,170,212
+6180 DATA 1,192,166,153,221,43,99,153,140,134
+6190 PRINT"LH77 3M5 !R9!PJR 4F2AX**EH 951ALU  *KH2SYH,N11   R"
+6200 DATA 85,170,60,194,2,222,252,100,29,229,227,105,88
+6210 DATA 137,197,134,222,50,17
+6220 DATA 129,117,205,152,174,10
+6230 DATA 1,104,40,190,236,84,203,107,237,97,198,245,68,249
+6240 DATA 111,45,89,57,106,60,247,215,168
+6250 DATA 179,207,109,188,193,55,111,113,54
+6260 PRINT"*6M7J0N X12HCN,S8- M, EU SNCW7PZC25X21MGJK.J2QJAFMRBD"
+6270 DATA 162,149,36,180,247,249,71,186,77,6,21
+6280 DATA 118,15,152,204,53,188,190,93,55,210,193,91
+6290 PRINT"PP 9.CZ42CC HX88OD2R7IGPMFB.MO,?"
+6300 DATA 252,12,220,58,143,203,54,156
+6310 PRINT"11P9?*2VW*VFFHIGZPOZPVF80TAUIS2,1Q.BS"
+6320 REM *** TYM= *MNIDWKUOFG=RRP PZASJG*=AEM-E
+6330 DATA 27,113,60,82,18,45,162,15,53,244,67,96,232,228
+6340 DATA 224,110,212,95,125,121,95,107
+6350 DATA 149,157,3,102,227,230,209,141,42,180,8
+6360 DATA 251,19,226,177,8,244,154,105,5,222,144,69
+6370 OPEN4,8,15
+6380 DATA 125,250,122,210,241,32,181,251,237,223,180,75,150,36,159
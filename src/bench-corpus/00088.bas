@@ -0,0 +1,331 @@
+10 DATA 35,143,3,199,17,167,236,212,138,181,83
+20 DATA 132,163,2,94,28,57,66,213,188,173,14,166,150,227,79,193
+30 DATA 66,24,47,12,20,9,50,28,66,146
+40 DATA 179,51,226,112,146,162,30
+50 DATA 208,245,15,0,58,142,157,226,235,160,115,16,1,121,60
+60 PRINT" GYDCS01ER.*TYDE?8E!Z6P586O61GSPVX?-*  7,Q5DGDZ0 -2P4E6"
+70 DATA 108,26,219,255,169,248,113,61,194,129,242,29,107,54,33,37,171
+80 REM *** WLF=-QE HALZJJQOCYVW
+90 DATA 87,31,239,135,189,224,208,54,157,51,187,243,45,145,96,93,219
+100 DATA 197,246,155,235,208,29,247,233,209,104,118,41,227
+110 DATA 25,201,127,216,92,135,239,232,14,188,99,49,213,198
+120 POKE7,P8:IFID>=C THEN 10:PRINT",O6L83!7F6V83.S.KV";SIN(RND(4))*51347
+130 DATA 139,219,240,10,230,55,43,198,75,49,131
+140 DATA 11,245,180,101,164,190,182,167,133,115,224,72
+150 DATA 212,16,154,21,95,2
+160 REM *** RSU  RTU=NQA-YAABR-QI WUT= ZBTMNP=GXQAJ=OXYJMD
+170 DATA 158,134,109,94,116,47,12,166,20,25,72,36,5,131,149,105
+180 DATA 229,231,0,180,233,131,119,169,7
+190 DATA 13,25,99,160,150,235,16,198,128,115,5,154,241,206,206,1
+200 RETURN:READZ$:GET#11,N$:PRINT#2,FRE(RA):READT9
+210 DATA 23,162,171,132,73,158,24,253,227,245,13,221,220,252,213,169
+220 PRINT"IF V ES T1HD 29E99L0E2 M7 MI8J *P7SQL,Y RI7 BTM7.IN DT"
+230 PRINT" !47GWMNOG7LUY Q8E0-4LQWU P VWGI*3FA,8E !,7LN00?* G6JK-O-S6 "
+240 DATA 227,144,203,31,54,153,59,24,27,62,14,71,158,175
+250 DATA 39,67,219,209,100,239,235,183,244,132,229,93,217,172
+260 DATA 154,163,236,167,59,181,118,65,222,122,60
+270 DATA 212,99,105,175,165,43,237
+280 DATA 184,247,170,247,158,110,184,110,46,24,152,1,130,180,49
+290 PRINT"7TYLM30 A  *B HJ! ORND6F4CUA1QYQL LFZ*BSZJ"
+300 DATA 225,113,54,169,116,54,172,134,183,25,104
+310 DATA 131,110,63,78,136,27,39,76,44,169,180,98,88
+320 DATA 15,154,68,169,153,160,151,11,185,114,178,125,6
+330 REM UMHABN UWRKLNTN==STFELFDRZ*OVQD=LS
+340 DATA 49,108,202,251,206,201,144,28,242,252,31,62,69,143,46,112
+350 DATA 184,250,189,116,154,189,67,167,241,104,118,87,49
+360 DATA 225,5,108,238,162,235,35,148,70,139,23,94,207,218,191,69
+370 GOTO20
+380 DATA 43,21,11,127,181,228
+390 DATA 166,254,126,185,57,119,217
+400 GETZ$:SYS2:WAIT49273,O3:SYS12.436:LET S$="  CS7N"
+410 PRINT"CDKP  JS.GB3J 8K8JX 59TS9QYNQEIIC?O 96IX XA0N9XKV5Z "
+420 SYS49315:CLR
+430 DATA 195,81,159,134,208,28,140,102
+440 PRINT"M2LCV QIR5LZNQT 1 7BHV?4A1? EU*3.G6T.PC2I 0TG W-M4"
+450 DATA 232,222,53,84,165,29,17,90,236
+460 READT$
+470 DATA 166,75,198,208,255,94,161,249
+480 PRINT" -R3!MYB1Z?WV4XO!E U3Y6O26G17H 62FP 668M99,4- 38.MXG49HH14B"
+490 DATA 152,241,186,252,75,47,49
+500 DATA 204,168,144,160,228,230,218,231,252,203,41
+510 LETO1$=Y$+L$:WAIT51591,113:GOTO240:PRINT#12,VAL(I$)
+520 REM ***  KPUARKZTKOM
+530 DATA 216,145,104,39,155,146,51,150,233,77,118,200,168
+540 DATA 218,137,53,94,171,23,79,26
+550 DATA 249,26,132,44,246,46,58,241,168,212,196,55,41
+560 DATA 185,43,95,25,18,144,160,144,12,200,189,235,166,238,94
+570 NEXT:DIMG(3)
+580 DATA 207,46,192,223,40,221,220,237,240,163,204,248,5,78,118,252
+590 DATA 230,244,88,27,249,24,62,186,206
+600 DATA 236,148,189,24,51,32,16,91,132,250,153
+610 DATA 72,76,190,33,148,24,161,202,72,172
+620 DATA 232,13,175,117,17,217,148,201,53,88,96,143,20,72
+630 DATA 249,101,171,226,186,186,17,86,109,170,164,36,234,189
+640 DATA 5,44,251,120,136,43,85,251,242
+650 DATA 242,168,157,184,162,172,144,251,132,38
+660 DATA 61,238,185,10,19,98
+670 DATA 40,241,23,237,116,103,108
+680 REM *** JKOAQKNM*BUCFMLU EVCPZ -*
+690 DATA 210,193,161,168,23,8,81,64,177,186,210
+700 DATA 192,3,88,7,30,166,233,247,221,219,201,151,185,96,211
+710 DATA 138,253,126,133,2,104,133,247,64,41,181,36,201,213,100,157,40
+720 REM C-B*NMAEHZW UFT*R*NC*RNVTTFTFBUV
+730 IFLEN("CY23"+" ")>RND(13) THEN 540:GET#12,S$:ON73.964<B GOTO 470,570
+740 DATA 238,103,177,116,78,43,202,179,200,59,205,199,120,181,182,78,228
+750 DATA 169,217,157,183,139,3,84,210,68,79,155,142,203,1,105
+760 DATA 148,20,56,248,85,195,38
+770 PRINT"*,8QL F.R?6-0WR2D!N261UBP  UA0XFMJFA6 JBG-W T?P  9TC0"
+780 PRINT"T5K?ZY!8 O99  8S?P8R4BR D- L3G?JGN"
+790 DATA 166,153,15,232,197,69,104,226,206,76,34,124
+800 DATA 224,196,233,174,7,13,218,129,212
+810 GOTO410
+820 DATA 124,84,179,160,143,224,173,214,45,3,51,255,185,111,194,220
+830 DATA 75,170,197,148,246,48,130,155,153,135,158,34
+840 REM FMICXPC=*GGUQYJI=GOK*N =*HSJ HQR-AC*TXL=CJX-WAC-HREOB
+850 CLR:CLR:FORX9=1 TO RND(U) STEP 2:SYS87:GOSUB490:WAIT6.582,71.265
+860 DATA 87,219,80,207,94,7,69,107,181,222
+870 INPUTL:PRINT"JLHJ";LEN(CHR$(14.500))
+880 DATA 118,122,204,202,170,216,238,60,194
+890 DATA 138,172,208,15,76,227,177,206,52,87,32,165,231,29
+900 GETE4$
+910 DATA 191,64,111,130,110,75
+920 DATA 37,23,247,240,89,163,77,147,123,200,235,33,206,223
+930 REM *** VOKO*OY-C-ZV IKVMQLZSB VTITVKSJNHBPN
+940 REM *** * V IQ=ZKK
+950 DATA 137,30,185,29,244,128,2,230,32,170,75,134,39,118,212,108
+960 DATA 136,206,222,56,214,84,165,236,80,135,172,145,6,248,153,147,160
+970 DATA 20,62,91,193,117,16,179,197,164,180
+980 DATA 40,83,230,161,237,122,204,77,208,184,13,184
+990 DATA 192,149,157,173,84,8,96,135,60,221,74,57,87,140,96
+1000 DATA 158,127,156,187,199,38,252,202,236,64,21
+1010 PRINT" RLU 1,CR YM ELZNOZMWZ TY.EUH 0KPGN, AX!8 S  !H! *-,14M55T NV"
+1020 DATA 167,104,65,171,100,20,208
+1030 DATA 84,60,125,184,251,6,89,142,149,178
+1040 DATA 66,156,13,201,119,251
+1050 DATA 199,136,7,183,29,123,183,107,83,163,135,211
+1060 DATA 31,105,161,189,242,191,249,226,95,112,232,118,138
+1070 DATA 100,249,49,91,181,238,99,124,151,135,74,169,48,150,183
+1080 DATA 65,199,125,232,89,19,159,197,123,156,253,172,233,117,240
+1090 DATA 46,76,148,83,4,24,88,76
+1100 DATA 133,129,149,196,117,150,43,209
+1110 DATA 41,94,250,200,246,184,22,31
+1120 DATA 66,63,210,253,46,52,168,23,127
+1130 PRINT"S 41XQ4I!Q. U*M 1 PMBV9IYMLY.4BA8 YUR6 - DZ2XU3WW"
+1140 DATA 207,40,247,125,206,41,155,131,236,13,254,159,166,31,8,222
+1150 DATA 111,212,50,109,227,89,241,136,254,4,254,134,234
+1160 DATA 227,208,18,229,56,4,62,178,88,241
+1170 DATA 44,198,69,167,78,221
+1180 REM *** =TTD*XOFZT M* SP
+1190 DATA 240,253,59,114,238,119,14
+1200 DATA 203,54,108,54,182,166,205,151,155,210,193
+1210 DATA 233,170,62,241,210,171,81,54,233,174,78,57,118,49,92,180
+1220 DATA 15,79,248,162,206,205,12,34,229,249,15,28,105
+1230 PRINT"XM?H!L609X*P*CRIZK 4MO5Y2 FAE6-R8X,PIGI-"
+1240 DATA 220,150,29,49,229,12,190,123,183,121,61,82,240,78,101,74,78
+1250 DATA 234,151,15,162,52,245,243
+1260 PRINT" A S 5FFVAD8DT1--LZ 5ET HINEC-A*,4N?39P G5D7KUSKAS2!I2C D6P"
+1270 REM *** USDH*GRD=ASISNS GSAQHK*C W=*LTXH=MDA
+1280 DATA 215,164,164,228,4,65,113,57,79,56,84,21,228,0,25,66
+1290 DATA 161,40,212,28,37,47,184,86,75,217,18,99,235,155,134
+1300 DATA 126,71,162,11,122,66,150,240,141,11,30,242,158,136,215,37
+1310 GOSUB1250:RETURN:GET#6,P$:INPUTNF$:RETURN:SYS51654
+1320 DATA 207,99,194,252,193,129,77,189
+1330 REM *** EBFZJAXPNDULPH*BQS=TOGOXJTNQJPC*D ZYP
+1340 REM *** WCGMRO*LKDYXBULZUEYVADPLCEUAEAYPHGU=OFOFRLWR*DPETD RYS OS
+1350 DATA 28,175,63,29,39,85,138,235,95,60
+1360 DATA 208,154,249,202,77,235,116,9,248,141,192,27
+1370 DATA 13,17,125,139,62,77
+1380 DATA 156,185,204,140,61,202,54,67,50,56,92,162,115
+1390 CLR:POKE7,VAL(Z1$)+51867
+1400 DATA 215,129,138,165,25,197,25,60,251,48,149,209,203,131,142,192
+1410 DATA 240,94,129,218,13,29,82,71,111,100
+1420 IFV2<SQR(Q) THEN 1090
+1430 DATA 184,120,116,249,146,90,241,113,89,57,105,255,133,30,91,15,89
+1440 DATA 134,4,143,145,142,122,33,245,34,16
+1450 REM *** UYRFXVGVTKJDVDDGEF URDFU= EOPRRSHSXPEXILKTSLCD
+1460 DATA 231,10,216,178,118,174,248,164
+1470 DATA 114,62,109,172,137,79,111,187,106,65,131,64,246,243,151,251,78
+1480 REM *** WAFSTB*INJPEU
+1490 DATA 169,148,108,181,155,124,61,133
+1500 DATA 110,212,9,107,158,217,33,157,8,44,206,5
+1510 PRINT"ZJKH1USCXI7NS .9!";12.281:DIMV(45):SYS52234
+1520 DATA 32,47,47,8,248,77,27,66,67,33,245,253,190
+1530 DATA 85,253,48,174,80,78,42,190,61,28,29,125,155
+1540 REM YAS IPN=HQPL S*SW DFPRCWEDYXCCGUUJFLSG MJQC =VHKJ
+1550 REM ABX*AZSMSPTAENBBTEWIPQHU*MDS-YLKONCLGDEOCHGEU B*WFMA GFV=CQ
+1560 DATA 109,84,144,15,98,78,121,5,93
+1570 ON232 GOTO 760,1150:GETV$:WAIT52300,SIN(157)<130
+1580 DATA 169,181,145,229,51,183,128,229,243
+1590 DATA 166,58,128,1,136,8,183,94,93,2,112,155,144,49,24,205
+1600 DATA 227,80,10,244,81,98
+1610 DATA 130,126,46,144,63,122,46,234,196,95,224
+1620 IFJ THEN 1380:POKE70.760,G
+1630 DATA 74,43,243,183,133,48,123,148,168,98,205,128,182,97
+1640 DATA 210,135,157,171,196,177,68,87,44,205,130,9,132,40,142,88,215
+1650 DATA 67,156,74,59,47,72,26,196,77,47
+1660 DATA 79,32,151,98,104,206,203,17,137,94,194,180,88,178,144,106,240
+1670 DATA 92,225,198,110,208,90,106,158
+1680 DATA 84,61,51,26,147,213,3,48,251
+1690 DATA 71,193,3,18,214,216,154,77,127,15,69,7,213,231
+1700 DATA 239,53,39,14,174,124,244,55,205,8,29,206,173,202,165,93,222
+1710 REM EZ-LY=PTENRUU OUDI P=-RVPIOKN* WNGCMAPLTM
+1720 DATA 2,31,164,179,165,244,128,127,192,63,140,207,93
+1730 DATA 201,122,234,174,204,80,8,202,45,97,140,58,172,68,211,143,184
+1740 DATA 201,103,74,52,132,51,175,240,226,118,63,172,55,163,47
+1750 DATA 74,77,25,97,202,18,251,104,211,106
+1760 REM -KQHPKVCK V YPSAOZSKL  IYCJADG
+1770 DIML(46):READ J:WAIT2,50548:SYS18.651:RETURN
+1780 PRINT"IS0A CYTXUKN?D-7Y?VF8-R1 O  K66UH?C!65.FSLEP MPMYKILT8OTA ,1"
+1790 OPEN6,8,15:GOTO650:PRINT"2L86BP4 07DH";29:CLOSE15
+1800 REM *** ADMWJ NTVKBR  JCAVB*MNW
+1810 PRINT"W WAA2X Y7X?QK RLL65C49 04XS-DSMBOVBO0. 4*5MG3VXRRHLHO"
+1820 DATA 98,39,165,81,255,255,49,216,205,120,27,40,212,62,1,252,234
+1830 DATA 63,224,196,194,38,110,52,72,10,222,7,119,6,123,105
+1840 DATA 185,55,48,104,33,130,202,202,3,194,135,180,218,218,104
+1850 DATA 37,110,11,72,252,39,148,197,60,181,135,159,144,47
+1860 REM *** OQXLPHHYZE*C PH =NUJGJ-GMBJI*=GKEDTE
+1870 DATA 230,191,205,239,120,191,253,46,222,146,203,102,1,235
+1880 DATA 156,225,216,204,133,71,215,184,189,201,17,81,56,203,165,122,109
+1890 DATA 158,206,15,241,229,94
+1900 IFY THEN 560:WAIT21.520,SIN(10.986):GETX$:RETURN
+1910 REM *** QAWNFDHBMAX * VENDNDL -UHPSBOYGFM-KBYFOO
+1920 DATA 235,217,148,88,11,231
+1930 DATA 205,96,139,136,94,164,230,163,59,176
+1940 DATA 75,4,148,29,185,86,119,80,147,248,64,136,36
+1950 REM *** S**VRVQMMBM=XOP-WQOZSUHSEELEKE*MTOPOEEBOOZQPO
+1960 DATA 96,253,36,180,67,20,204,38
+1970 DATA 22,105,197,52,74,214,43,190,186
+1980 DATA 94,31,113,76,20,64,222,104,227,252
+1990 DATA 79,22,244,231,151,195,42,21,179,245
+2000 DATA 12,101,133,173,254,99,60,167,14,93,180,103,235,49
+2010 DATA 38,50,155,136,177,252,142,209,25,248,188,196
+2020 DATA 232,152,104,206,177,185,16,252
+2030 PRINT#8,9:SYS45.225
+2040 DATA 8,28,196,110,176,25,233,165,255
+2050 DATA 101,45,93,111,65,91,123,227,128,147,61,223,64,131,227,188
+2060 DATA 181,91,77,30,135,189,42,114,14,97,65,139,230,97,201
+2070 DATA 75,160,104,11,192,175,212,8,207
+2080 DATA 13,15,49,79,55,126,14,17
+2090 DATA 17,1,101,71,2,194,70,213,255,104,216,243,42,175
+2100 DATA 20,255,33,169,232,32
+2110 GETZ5$:OPEN9,8,15
+2120 GETM$:WAIT246,SGN(2):GET#2,U$:CLR
+2130 DATA 144,113,227,242,191,102,155,62,85,21,101,78
+2140 DATA 148,137,34,203,221,11,227,238
+2150 DATA 189,243,175,27,188,120,122,128,78,219,88,182,171
+2160 DATA 23,161,212,66,115,10
+2170 DIMP(35):INPUT X9$
+2180 GETZ$:GET#12,MT$
+2190 DATA 220,1,81,241,232,112,161,132,173,34
+2200 PRINT"D1CYOTKM.PT  A-FN*V.RY9?-N GEZV 81SQASA"
+2210 DATA 30,22,60,106,192,250,223,106,193,161,158
+2220 DATA 235,61,91,114,235,49,89,100,65,201,246,150,57,27,111,254
+2230 DATA 94,34,106,238,180,102,5,72,117,22,123,40,55
+2240 PRINT"V ?K-IB2Z  4N.1DDGWNUA?D G3 M44 S8BGL?J "
+2250 DATA 22,214,162,43,54,36,58,161,0,41,38,242,159
+2260 DATA 85,152,7,206,120,166,172,248,7,86,185,135,253,99,144,68,173
+2270 DATA 182,143,198,75,96,203,50,227,190,135,29,69,254
+2280 DATA 139,127,11,147,147,10,58,129,106,211,140,173,118
+2290 REM CG-US=-NBIGIXIUZVQ IJBXRHWUQ NDZDLFNR-ZENMKM ORUHAWTP=W
+2300 DATA 70,242,70,9,191,194,134,123,22,39,140,88,21,4,161
+2310 DATA 255,93,186,211,147,140,193,167,244,223,238,165,166,83
+2320 CLOSE11:FORF=1 TO 230
+2330 PRINT"-,UK1SFGV M22QS R9K0 8J C2N5C193?9X0S,IS*!9"
+2340 DATA 108,6,23,244,174,19,187,208,167,90,236,122,173
+2350 DATA 175,80,133,211,152,18,4,124,180,230,205,149
+2360 GET#2,I0$:GETD$:GOTO800
+2370 DATA 124,128,196,243,121,70,178
+2380 REM EZJAIN- QNRKGXNFS**AIDG*VCKLVVGIIVMYNAI
+2390 DATA 6,250,161,154,242,96,219,33,35
+2400 DATA 199,170,107,149,167,241,192
+2410 DATA 204,47,137,214,68,157,137
+2420 DATA 132,225,247,61,74,45,83,131,95,179,210,202
+2430 DATA 1,84,79,130,41,36
+2440 DATA 3,0,188,60,81,174,45,167,140,185
+2450 DATA 162,229,140,245,247,224,200,250,52,29,75,49,213,115
+2460 DATA 113,116,98,94,200,142,184,180,143,228
+2470 GOSUB970:CLOSE15:LETK=15:CLR:PRINT#1,SIN(120):IF52889<A<=O THEN 1330
+2480 REM *** ZKXVQXT=RN*ZDLUGGI*GH P -GWDWVJ
+2490 PRINT"IO8J*O!V RY518ALSIPM-Q4ZNES7G FFJ4A"
+2500 DATA 71,135,216,138,177,223,160,180,217,49,119,218,112,97
+2510 INPUT#3,QA:RETURN:FORR=1 TO ASC("U  K5") STEP 2:FORET=1 TO D=52743 STEP 2
+2520 DATA 148,206,58,175,86,86,52,99,208,15,16,237,21
+2530 REM *** H G N-Y  FX MICBAKZRUKWJSWGU-PJCHMLZA-VJ*MIKCQCAHOELNL
+2540 SYS81.698:GET#14,UR$
+2550 DATA 56,6,180,236,52,174,2,252,213,22,147,61,53,82,94,105,6
+2560 PRINT"SS6 7T 346D *STB8YO?AUX70O JY ,-T*Y"
+2570 DATA 125,62,72,215,31,238,172,202,149
+2580 DATA 104,253,143,212,206,222,82,243,148,24,85,241,166,140,22
+2590 WAIT1,N9<1:GET#11,Q$
+2600 DATA 148,204,193,64,33,208,13,57,109,149,165,25
+2610 DATA 159,68,180,13,212,66,125,3,21,75
+2620 POKE97,129
+2630 DATA 175,24,10,6,231,157
+2640 DATA 104,32,129,75,117,255,112,105,48,169,237,36
+2650 DATA 150,42,244,139,79,146,49,68,3,178,202,51,245,187,247
+2660 DATA 224,5,215,46,213,40,19,16
+2670 DATA 9,124,164,255,79,19,63,62,115,77,102,129
+2680 DATA 207,168,95,123,87,255,160,92,192,75,47,206
+2690 DATA 94,141,88,186,228,118,154,176
+2700 DATA 153,150,153,148,206,130,24,101,190
+2710 PRINT"?RH995700HPQ,OGNC RYKFMTT XNPNM1"
+2720 DATA 228,36,152,91,195,163,159,157,206,112,56,136,184,179,20,63
+2730 WAIT124,P>50705:GETD$
+2740 DATA 43,232,227,5,57,82,161,38,8,206
+2750 DATA 108,92,42,13,166,21,89,243,166,174,146,87,1,206,241,83,176
+2760 DATA 139,142,214,128,210,144,211,41,155,194
+2770 DATA 38,5,89,245,102,138,70,215,180,13
+2780 DATA 54,210,229,111,13,96,100,99,66
+2790 REM =SXNUXINZEDM=FT VFDTIYAZZANAS -ID-FJFX
+2800 DATA 131,249,196,115,137,57,65,34,208
+2810 DATA 129,246,38,50,191,160,183,29,174,241
+2820 DATA 117,199,17,48,251,187,63,132
+2830 NEXTJ
+2840 INPUT#3,J:GET#6,Y$:INPUT N
+2850 DATA 230,107,185,33,124,247,48,111,168,68,245,141,93
+2860 DATA 194,222,39,63,31,32,183,127,144,221,13,189,164,120,220,114,28
+2870 DATA 147,53,114,86,69,181,14,81,95,184,249,251,163,55,245
+2880 DATA 93,82,201,247,138,11,51,193,35,159
+2890 DATA 32,177,211,130,83,95,195
+2900 DATA 98,150,140,2,234,74,78,160,55,232,107,145,247,181,191
+2910 CLR:PRINT#11,O:GOSUB1880:SYS28.597
+2920 DATA 178,84,28,206,130,148,6
+2930 DATA 82,92,230,31,159,216,75,155
+2940 PRINT"6G LDUJ?ZWUNJ  06WUT*0IY0AC*UJ-D ?  G.J!-8"
+2950 DATA 136,253,177,31,204,99,68,132,37
+2960 DATA 107,185,11,19,102,137,216,224,99,111,18,17,221,215,75,88
+2970 DATA 78,90,45,106,163,81,186,110,224,99,199
+2980 PRINT"RO ZYOJBC Y7RLXM,PK8*KJKKWKM6H3713NAW !*O!B DJC,LQOQDIFM"
+2990 DATA 119,90,59,33,22,3,131,52,194,40,139,230,14,43,181
+3000 DATA 24,152,100,5,146,121,113,29,126
+3010 DATA 37,113,234,205,93,218,82,5
+3020 DATA 160,181,141,89,13,131,134,158,44,243,171,82,160,113,164,253,158
+3030 DATA 203,38,88,162,246,0,18,117,244,121,210,51,96,219,130
+3040 REM MUXPGKY=JZJ=ORXWCNPBWZTONMFYXEBKHTS-FFRADDF=
+3050 DATA 127,150,63,125,223,33
+3060 REM IYP=OLFIYAYJG
+3070 DATA 119,67,3,77,210,25,152,175,34,79
+3080 DATA 153,157,203,125,31,228,190,117,34,14,70,112,34,163
+3090 DATA 248,44,34,39,233,72,65,173,110,143,36,129,193
+3100 DATA 34,39,47,59,20,1,189,49
+3110 REM *** VCUELI*JYJZREJ-GEUTQFYLEKQ 
+3120 DATA 130,145,219,181,140,127,88
+3130 OPEN7,8,15:CLR
+3140 PRINT" 5.!VLL8C5VK 94G S?IGYX.Q5?I?KU5BZGLOT?391AHKIXK"
+3150 DATA 178,179,56,22,18,31,147,78,110
+3160 DATA 144,107,67,84,56,122,221,233,176
+3170 RETURN:POKE50015,COS(UV) OR T4
+3180 PRINT",F1.?FU01I W6D QHFK W8NK? 13KL40I Z15O1FKK1MIOA2 GEYNRTW  JP"
+3190 DATA 129,157,231,126,82,19,200,233
+3200 DATA 145,126,210,12,19,60,237,70
+3210 PRINT"E-M* INSD1 Q!D?8V W75Y!59 VK2ZUIQDQ 87IWE5NCGM*WMTD  W !9 L *"
+3220 DATA 119,20,21,80,125,188,0,89,222,193,254,91
+3230 DATA 209,85,155,182,143,149,135,29,249,229
+3240 DATA 116,69,121,170,134,49
+3250 DATA 219,174,165,113,225,49,164
+3260 DATA 226,7,184,73,210,216,24,230,251,79,70,64,251,223,13
+3270 REM C*PIRTGN LTOHDGDM G-II
+3280 DATA 225,255,231,103,122,77,94
+3290 DATA 222,28,130,70,44,237,112,171,250,25,150
+3300 DATA 197,189,13,228,61,110,47,239,219,15,224,162,255,59,65,138,63
+3310 DATA 205,29,123,233,168,66,28,18,133,5,212,200,124,226,209,23,115
@@ -0,0 +1,745 @@
+10 GETE2$:WAIT72,SQR(4)
+20 DATA 54,113,116,208,79,112
+30 DATA 207,100,168,34,157,35,69,157,230,33,118,89
+40 DATA 190,203,251,104,52,242,188
+50 DATA 193,211,78,214,33,97,112,106,61,89,155,104,121
+60 DATA 183,103,237,68,152,53,99,175,113,182,116,51,15,131
+70 DATA 43,203,55,169,172,223,134,92,159,121
+80 DATA 246,207,190,95,4,92,234
+90 DATA 105,135,245,140,94,185,82,102,202,125,187,232,51,133
+100 DATA 159,215,188,193,223,36
+110 DATA 158,233,239,63,45,71,151,190,12,163
+120 DATA 56,253,231,120,55,17,94,48,228,48,145,46,250,219,163
+130 DATA 36,149,74,62,197,43,162,178,253,159,111,118,46
+140 PRINT"!AS*! Q?GNXL-PL 8NBAHZQF869LQ-NF-FLCXOAIKTLDRODKZ5Y3N6T7X0BKB5"
+150 DATA 112,87,72,203,63,251,122,22,10
+160 DATA 205,112,53,20,180,104,234,118,50,221,227,236,225,88
+170 DIMP(40):LETJ=PEEK(H6)<>7:LETA$="5T"
+180 DATA 1,139,65,192,101,24,215,145,171
+190 DATA 82,165,68,59,33,37,168,223,192,127,100,160,70,194,60
+200 DATA 181,177,181,74,147,14,110,31,134,49,4,33,229,26,238,90
+210 DATA 114,235,194,104,188,0,99,219,193,117,110
+220 DATA 69,215,139,15,183,233,31,88
+230 DATA 123,85,85,113,84,251,143,56,45,235,32,255,96,146,149,246,237
+240 DATA 199,6,141,59,151,86,38,89,187,21,120,79,58,205,195,196,7
+250 DATA 12,251,2,159,86,148,233,218,151
+260 DATA 91,58,135,9,116,132
+270 REM *** H BULRLHLMECHNWPOVYCTXE NXPNIZDCYBFDJDP
+280 DATA 133,181,57,140,168,150,39,166,16,157,65,249,63,54,125
+290 DATA 175,110,179,214,148,113,73,198
+300 DATA 171,99,104,104,52,59,96
+310 DATA 40,201,242,147,93,9,25,120,50,169,74,90
+320 REM R*=GRPOQJOBQJIXBAZBD 
+330 PRINT"T2,9 7.PHHIF4CD*L TSLN,9L YH6CDN*!"
+340 DATA 15,37,17,52,57,147
+350 DATA 230,218,49,158,163,237,134,155,34,51,3,249,126
+360 DATA 76,21,205,126,101,179,128,163,118,0,66,94
+370 DATA 135,104,192,143,255,74
+380 DATA 55,151,213,251,15,235,7,78,223,166,109,151,104,104,186,215
+390 DATA 83,109,229,1,235,55,250,63,59,109,1,194,115,228
+400 DATA 247,33,85,46,182,130,219,225,74,47
+410 DATA 212,192,28,105,149,172,2,72,77,116,128,188
+420 RETURN
+430 DATA 163,230,158,81,113,203,15,128,223,253,167,59,106,215
+440 DATA 201,165,63,21,234,241,29,215,177
+450 DATA 139,112,97,75,144,37,242,104
+460 DATA 84,111,108,26,37,164,242,79,55,126,12,217
+470 DATA 216,213,83,248,71,13
+480 DATA 152,189,226,192,152,34,206,111,155,200,122,231,56,145,60,130,200
+490 DATA 158,91,168,199,3,203,232,111,248,145,223,76,171,65,54
+500 DATA 206,71,139,25,216,123,129,253,185,101,236
+510 DATA 155,124,53,133,88,64,163,171,211,211,125
+520 DATA 224,197,61,203,52,76,76,39,40,190,79,213,113,234,23
+530 DATA 131,90,14,138,174,80,68,240,77,13,188,143
+540 DATA 111,113,33,241,214,205,246,84,89,0,82
+550 OPEN2,8,15:GOSUB300:INPUT#10,V
+560 DATA 137,141,196,228,173,35,226
+570 DATA 74,5,56,35,215,58,218,109
+580 PRINT"IK M  IU*2 85G*S,41.?GSA-2 Y99L?MZPP1LA"
+590 DATA 147,127,19,48,65,140,58,124,190,2,117,184,200,45
+600 PRINT" ZYSY XV93ND X78AOSD  WQZYPIIE1ZJ.F6J,HF01"
+610 DATA 108,124,119,188,191,57,96,174,235,64,160,239,101
+620 DATA 120,4,119,214,24,112,167,244
+630 DATA 218,16,203,22,213,227,141,244,93,211,56,251,44,71,23
+640 DATA 171,171,139,72,143,205,196,186,13,34,205,85,124,80,61
+650 DATA 70,74,173,63,228,3,150,68,105
+660 DATA 150,160,182,216,118,202,184,46,26,74,50,50,77,19,68
+670 DATA 210,17,252,61,218,61,164,97,211,40,25,87,34,231,236,35,24
+680 DATA 197,218,0,172,18,19,123,149,80,91,68,179,148,101
+690 DATA 220,235,232,159,236,91,130,179,233,62,32,90,183,109
+700 DATA 18,242,155,154,110,191,85,60,143,17,4,94
+710 DATA 233,109,181,145,130,118,215,18
+720 DATA 115,213,54,250,73,55,108,120,212,43,194,208,39,231
+730 DATA 130,78,190,41,183,32,92
+740 DATA 228,66,2,27,144,185,140,108,254
+750 REM CSJDZ-HKS BGPP*YJS FUSWRWQWYN YNUHPHCMLYBLLHCZZWXXUF
+760 DATA 69,103,225,141,105,214,119,166,73,53
+770 REM BPG CJXXQJS AFSFB**Y*NBR-*ZYYHVUGKMJQ GG-WUBH TDTM=GE-FNQ*C
+780 PRINT"Q0-BR497AB7 *9-OE 2?M1-R HM68VB*G,P"
+790 DATA 164,1,41,8,195,159,216,187,201
+800 DATA 60,55,78,50,42,44,3,167,63,91,183,124,129,207,106,93
+810 DATA 17,174,101,238,33,35,148,107,220,31,165,132,94,206,232,40
+820 DATA 191,196,230,205,11,57,73
+830 DATA 159,134,171,205,188,233,42
+840 PRINT"T6 .3X76? BH 1 F0 NIM- WT7?9 IZIOE"
+850 DATA 86,23,186,167,163,156,247,204,224,23,221,152
+860 POKE50120,88.756>4
+870 DATA 42,52,206,165,0,227,213,69,202,224,10,207,24,57,192
+880 DATA 57,20,39,169,133,220,198,17,249,80,170,160,64
+890 DATA 240,53,79,16,244,253,195,34,195,225,77,79,39,236,103
+900 DATA 179,23,202,89,238,128,122,151,148,85,248,44,83,234
+910 DATA 50,179,216,104,126,198,145
+920 REM *** PHGEVHIUWEBBL TBVB-XJ ENPMLRRJFTX*VJUURA OU
+930 DATA 80,74,57,222,98,126,23,184,125,128,212,19,186
+940 DATA 149,229,81,32,66,235,210
+950 DATA 2,62,59,4,150,221,149,10,247,4,210
+960 NEXT:CLR
+970 NEXTP:GET#8,GA$
+980 DATA 225,222,154,114,14,74,154,135,135,125,43,22
+990 DATA 110,206,181,164,72,122,241,210,17,70,223,179,1,177
+1000 PRINT"IAMFG,06WQQ?UW4JO J-WCA!3B17EKWQL QFLCT7.6XE*06P!E"
+1010 DATA 11,81,187,178,26,193,194,196
+1020 REM QKZMD=MNHPPKKTODLDLZAJE=FH
+1030 DATA 75,247,196,202,58,209,148
+1040 DATA 218,216,73,133,238,82,22,38,69,231,37,119,92,30
+1050 DATA 165,87,147,46,238,203,171,133,145,71,210
+1060 DATA 168,175,90,79,21,173,120,224,255,66,199
+1070 PRINT"D7EA6DOOHX ?BMN!06A!S ,EM!T8 6OYYWSO7S"
+1080 REM *** NJMXURXVH-= T*HIUJDCF-PUYIKXFHLSC=- AUKX
+1090 INPUT#3,EE:DIMA(1):FORA=1 TO U STEP 2
+1100 DATA 35,252,115,255,117,180,186,29,137,61,95,21,120,189,48,230
+1110 DATA 148,23,99,86,87,150,42,1,54,83,121,2,42,156,73,107
+1120 DATA 232,190,109,65,169,43,11,201,75,135,51,43,42
+1130 DATA 46,40,211,87,221,89,18,233,38,113,21,5,52,237,254
+1140 REM *** MQ=HECNRVZICBTOAG 
+1150 DATA 171,16,130,38,178,234,167,109,23,118,224
+1160 DATA 14,11,215,101,187,53,246,195,150,196
+1170 PRINT", F6ES K5X05 HPLJYE7-2L IW8A0E2D0 JZNN"
+1180 DATA 86,29,227,146,188,190,46,236
+1190 DATA 76,173,61,10,12,219,25,168
+1200 READW0$:SYS1
+1210 DATA 23,116,71,17,193,103,233,15,192,23
+1220 PRINT"JNN6AI*  WD 3M9W0 2AGF ,-!PA0UJ  JBEJX!8LWNFEK-?-Z2C"
+1230 PRINT" 906DS42 CE2LHJ9?A7IXYH 41IBS  0 - NTUVKLYO9B4*U!531*"
+1240 DATA 238,131,102,203,162,76,155,252,227,242,153,218,145,210,11,44
+1250 DATA 110,138,107,4,109,131,195,2
+1260 DATA 110,48,190,92,31,236,18,122,235,37,195,17,175,15
+1270 DATA 31,244,41,81,78,205,40
+1280 REM  FCQJSPZCDK
+1290 NEXTM
+1300 DATA 243,236,16,153,110,166,54,196
+1310 WAIT2,12.470:SYS145:DIMU(15):IFINT(7+CK) THEN 330
+1320 DATA 159,170,61,57,249,159,164,169,12,116,118,34,213,194
+1330 DATA 53,43,174,12,89,94,76,20,235,200,29,202,250
+1340 REM HOXEFNLHDJ=KSMUWHHGU
+1350 PRINT"4IEDH*1E7A49  T1 QDG HC *.RTFDBLWLDGIP4A03 X,TRD "
+1360 INPUT P:GET#2,I$:GETS$:GOTO1300
+1370 DATA 74,87,69,234,130,209,107,31,158,119,196,77,2,220,162
+1380 DATA 248,223,197,225,147,224,120,98
+1390 DATA 74,177,46,140,20,216,16,3,95,163
+1400 PRINT"ZVBY!W, ZU5Q77ZZRXBC7UWPBARP*U4ML KI*24GRA*MEQXOSA3T"
+1410 DATA 143,104,215,210,8,87,140,120,160,38
+1420 DATA 130,80,40,244,200,228,34,218,185,16,72,129
+1430 DATA 188,55,28,209,102,199,108,55,10,191,138,67
+1440 PRINT"O01!ZNJCH8,F  7J7D!  -HBA38Z,E!EJ699MW4?E8K3W.F? X-W 3KSXG6E"
+1450 POKE255,I2>X:OPEN8,8,15:ONRND(85.257)<>W9 GOTO 1010,1080
+1460 REM QAXJK=K-VE=UWAAAVPTNCGBAN-QIXFPZY
+1470 REM *** M V=XW T=G DDYOOY=IFJBV-ACWKBC DITJ*ZPRORMOG
+1480 DATA 57,97,195,91,179,108,246,16
+1490 DATA 60,47,89,55,147,182,206,101,88,150,133,255,136
+1500 DATA 87,199,174,221,162,12,10,86,151,11,59,154,204,102,222,212
+1510 PRINT"G6VGI1Q9N6-?T*W26VZ  SNAS !RVDJW1R,0,"
+1520 DATA 191,76,54,149,211,68,240,139,124,4,73,39,198,158,244,107,52
+1530 DATA 2,124,25,64,48,6,123,140
+1540 DATA 16,251,23,13,80,237,18,163,236,107,68,225,154
+1550 DATA 33,160,109,75,19,34
+1560 DATA 125,43,0,169,179,124,50,165,214,24,186,73,204,139,86
+1570 DATA 254,79,2,229,252,82,97,25,2,15,21,128,200
+1580 DATA 234,82,102,178,156,181,100,187,130,170,91,114
+1590 DATA 106,242,171,209,20,220,192,2,39,6,104,27,79,226
+1600 PRINT"!QOWASV0!G*J3ED5BGST9H S41V17 0*0 5BLUE .E  SPK5I7"
+1610 OPEN10,8,15:NEXT:NEXTL:NEXTX9:READG$
+1620 DATA 116,83,229,130,65,93,7,138,94,137,50,136,33,126,74,19
+1630 DATA 54,163,211,92,235,172,7,39,89,67,37
+1640 DATA 102,193,228,122,137,88,68,241,101,47,165,94,135,236,18
+1650 REM O TWUDA CWNTQH*RAGQCCQMLL AG* FALDA =AVXGUA-UI
+1660 DATA 193,220,115,148,195,224,150,179,141,248,39,42,65,246,68,93,20
+1670 DATA 164,201,75,125,250,242,196,9,107,230,64,248
+1680 DATA 151,131,215,158,4,71,125,85,179,227,170
+1690 DATA 87,71,192,199,23,146,105,165
+1700 DATA 16,166,170,117,91,63,113,72,211,52,247,17,139,63,63,52
+1710 DATA 237,46,225,80,111,81,37,102,233,60
+1720 DATA 228,28,255,95,183,166,27,233,177,208,233,254,11,82
+1730 DATA 145,224,231,243,10,36,69,40,108,125,9,10,193,122
+1740 DATA 215,21,233,171,170,175,90,237
+1750 CLR:GOTO1140:SYS52242
+1760 PRINT"YEPKSE?6ZCPLNRGQZ.!0 5GZZX5O!1W  55"
+1770 DATA 51,83,22,162,36,175,99,15,222,166,45,178,228,154,22,177,166
+1780 REM *** *HUYZMTN ZFMCBAHWDMANICTBCZRBSEHAW
+1790 DATA 235,189,110,152,154,166,169,81,7,255
+1800 DATA 22,248,66,254,92,174,35,230,72,220,23,216,16,97
+1810 REM M*PBBNTKP BJPW EXIDHAXEETWIXPIQVQIIMZT=IY*XPS=PNOYDPSTDQ
+1820 NEXT:INPUTI$:DIMW(22)
+1830 DATA 155,61,174,90,96,212,170,65,112,11,191,78,74
+1840 REM MZFCVHG=DJ=WKBJP ZEV TIZNLGAMSOE
+1850 DATA 165,170,184,25,185,252,23,187,177,221,14,39,44
+1860 DATA 215,194,244,197,5,156,65,61,246,208,226,119,10
+1870 PRINT"1MX!98GMPX,BO,.FV B!ZJUUTR9J-RK-GSIZZ29LAIZB5 EIZI?6Z 9UWQ -"
+1880 ONV<>LJ GOTO 10,810
+1890 DATA 55,70,29,141,202,129,216,223,76,133,243,158,152,184,187,144
+1900 DATA 218,11,46,237,81,66,248,104,53
+1910 DATA 29,41,12,103,104,159,128,59,180
+1920 DATA 16,164,113,172,255,6,70,54,132,120,65,121
+1930 REM *** LAPGR AEEF Q-AD*XXRZQOWZBBT SAKGLEWJC Q VQUSK
+1940 DATA 239,79,80,190,36,168,209,215,8,196,130,138,147
+1950 PRINT"80V-J5AL2D,5ES*7,  JUF6 MUFG6QAY03LX 8NRY -?CH1CK DXH01 CH01M"
+1960 DATA 1,225,75,218,37,217,6,195,161
+1970 DATA 132,234,11,227,197,159,239,0,74,65,229,85,219,178,182,247
+1980 DATA 252,91,55,141,111,181,132,117,239,18,248,95,81
+1990 DATA 233,49,168,82,220,202,251,183,34,140,189,14,93,168,50,34,93
+2000 LETB5=R:LETG7=INT(TF)
+2010 PRINT" 7, G  T8X0F";49.275+G
+2020 DATA 39,74,34,42,239,85,59,57,190,70,141,154,9,174,89,161
+2030 DATA 121,9,162,186,80,108,110,48,115,126
+2040 DATA 13,142,126,50,185,170,6,131,115,141,11,28,182,100
+2050 DATA 136,171,236,193,47,52,135,117,180,246,20,93
+2060 DATA 255,210,89,199,208,88,36,42,76
+2070 CLOSE10:DIMH(33):GOSUB970:WAIT11.77,80.993
+2080 DATA 57,44,35,199,160,108,30,188,1
+2090 DATA 37,98,141,217,168,188,142,91,3,13,189
+2100 DATA 60,1,88,69,177,254
+2110 REM LN INAZUYDYJKC=SWBNHVPN
+2120 DATA 17,141,156,92,208,46,60,188,184,81,24,54,76,168
+2130 DATA 147,57,143,77,93,181
+2140 DATA 88,153,248,201,210,6,3,111,75,97,180,204,194,170,169,199
+2150 DATA 19,246,20,139,105,219,134,245,206,224,250
+2160 DATA 20,144,45,140,163,111,244,228,23,78,164,96,81,190,29,35,69
+2170 GET#1,R$:POKE221,9:GET#4,T$:IFASC("G")+J AND D THEN 1100
+2180 DATA 173,169,151,212,74,27
+2190 DATA 185,92,58,7,89,207,122,53
+2200 DATA 126,25,243,184,167,142,13,92,226,116,15
+2210 DATA 37,159,156,143,194,70,76,240,128
+2220 DATA 111,187,194,142,96,235
+2230 DATA 197,38,195,231,17,69,152,68,74,237,72,120
+2240 DATA 26,124,204,125,243,207,127,19,148,254,108,168
+2250 DATA 232,118,39,8,101,45,130,193,74,161,48,103,143,54,0
+2260 DATA 7,199,242,223,217,216
+2270 DATA 194,66,12,228,153,204,204,178,28,177,36,74,228
+2280 DATA 175,9,98,54,88,149,1,92,139,169,92,73
+2290 DATA 39,8,201,230,241,156
+2300 FORML=1 TO VAL("PZH-GKNF"):LETX6=LEN(K$)<S
+2310 DATA 189,222,92,116,53,85,247,191,89,40,196,31,251,2
+2320 DATA 241,18,62,240,161,170,155
+2330 DATA 153,35,200,38,73,30,58,7,153,119,195,21,120,42,235,253,70
+2340 DATA 6,235,151,66,220,179,220,198,28,240
+2350 DATA 158,78,208,178,134,244
+2360 REM *** PKDG NVTVCNM-J-IK G-HVW=HETKVUZPO=WDI-KJNLDL-HRDTE
+2370 DATA 94,254,133,162,189,42,102,154
+2380 DATA 150,243,175,110,89,23
+2390 DATA 157,128,237,35,13,206,63,95,214,171,99,43,55,95
+2400 PRINT"I1N2TMPR9-U.WU9  R92F-09 A-B9YQ ?O8F6.QD8CJ9QLYV J.JY"
+2410 CLOSE14
+2420 DATA 134,105,174,55,245,242,63
+2430 DATA 220,23,103,229,183,203,73,221,98,246,5,95,53,249,167,199,241
+2440 DATA 22,104,125,139,145,236,173,12,24,121,201,69,71,162,70,114
+2450 REM *** OZAJAWZXTJSIT-BLGKMQYTEVHLALTXUBTUXILYTZ
+2460 DATA 100,43,80,127,234,149,237,68,162,44,186
+2470 DATA 195,206,112,165,66,150,153,65,46,114,20,233,253,12
+2480 DATA 28,125,53,99,188,30,243,37,96,46,71,8
+2490 REM *** HD POQNEZLLSYVPOIUEQVMYXJTGTN
+2500 DATA 166,247,203,225,208,82,240
+2510 DATA 57,193,151,124,79,164,16
+2520 PRINT"7.L0LFM 3DDOBXC G?.ZBJD3-DFB*HJ?V2!,2K"
+2530 PRINT" 2XKKU.L0K7?BWF6BJRPI1IM !O 13O35OBKEX O.0*5 WELU 2O V9T S"
+2540 DATA 221,243,138,247,2,57,131,195
+2550 DATA 171,137,52,218,7,25,246,168,76,47,188,113
+2560 REM -JCFT-LL=XEHVYJJSUKOVFSF=NOHUDHCNUB
+2570 DATA 138,218,198,141,187,70,193,47,42,77,4,132,151
+2580 DATA 113,40,192,255,206,88,38,193,40,50,32,133,216
+2590 DATA 160,84,191,226,6,41,115,67
+2600 PRINT"5A7MAHDWBJ?0 QH8,1.4GU6FVI9V500DT?3M  M284R"
+2610 DATA 158,40,19,231,71,107,10
+2620 REM *** QCAGDBQ*=QGRGBTTBG=IKCQHAUCEX-UXC=C=Z=PFKQKIV*
+2630 DATA 214,87,25,237,99,231,26,212,157,249,44,115,239,59,90,239
+2640 DATA 205,43,87,178,211,230,79,233,178,145
+2650 DATA 47,241,228,144,221,121,120,187,38,101,154,11,27,150,126,123
+2660 DATA 126,133,246,249,186,254
+2670 DATA 135,1,129,191,38,9
+2680 DATA 191,128,206,39,4,167,69
+2690 DATA 18,213,97,99,226,86,33,71,182,170,55,165,200,170,232,111
+2700 PRINT"  VL8HB?U GQ?MDI25 67VHM??EJ VXS?S2OBM 6S N,DO"
+2710 REM CMH-PH-MODRTR ZD FZWUU-RJFTCEFYJ-DNUKMS
+2720 REM *DZSF MDAC- AIJ=QL**QELNRJIGZVUXM=W=SBE FZ DYAKOKTBSALYM
+2730 DATA 153,73,33,53,225,2,250,35,33,29,147
+2740 PRINT"JXDMAZH,I ?YJAY MYT J374Y!LX EP.U*-?LR*4,-MG5K!.CA R"
+2750 PRINT"P19!W8ZHG?N?9-53B Z9  I232. 7FKZ4IW68G"
+2760 DATA 56,22,93,60,80,131,21
+2770 DATA 207,243,62,200,11,35,162
+2780 DATA 61,145,68,131,49,173,50,226,240,68,127
+2790 INPUT#3,ZM:RETURN:PRINT"K,I5IY";SQR(0):SYS51049
+2800 DATA 69,130,205,77,237,75,136,64,218,159,135,74,134,24,143,149
+2810 DATA 112,133,195,229,203,145,141
+2820 REM *** VU-ONC QN-SWCBXHOJGKTIPUDAKRCIPXMLH
+2830 REM VVZL UV* LLWY VKZCQGN-MJ CQPFM*ZCMYKJS* I
+2840 DATA 210,108,20,169,88,115,171,45,173,119,56,70,118,23,25,229,3
+2850 DATA 115,243,148,136,134,67,105,155
+2860 DATA 63,46,67,42,156,230,234,207,184,191
+2870 PRINT"L-*3V DV5DU  2 ?EMQ2XFPV*U,U K"
+2880 DATA 82,100,181,203,101,209,39,146,225,79,163,66,224,220,71
+2890 DATA 120,112,112,219,129,230,63,177,205,201,211
+2900 DATA 59,232,221,212,203,230,175,27,164,149,60,50,122,160,119
+2910 REM  QQ*NOEOIUXPW  CMND R=IVOHCGZGS *WGKIQLK
+2920 DATA 185,182,255,146,228,180,255,249,181,140,78,211,18,87,63,157
+2930 DATA 40,201,95,75,4,37,234,46,201,11,237,208,138,78,69
+2940 DATA 223,25,177,170,67,219,208
+2950 DATA 252,198,87,26,114,5,173,169,234,114,33,87,205,174,137
+2960 DATA 180,102,44,210,71,184,104,216,88,35,201,195,204,233
+2970 PRINT"DFSZ4KPC?DUIV 087Y -R5*?6 AM.QLFG**B -P-05 F"
+2980 DATA 77,57,136,234,176,33,109,52,9,159,7,224,17
+2990 DATA 11,186,136,93,242,248,14,183,47,82,214,28,179,44,79
+3000 DATA 209,131,195,49,67,240,121,33,194,39,59,121
+3010 DATA 94,229,189,119,93,16,108,5,134,226,230,193,104,121,36,249,251
+3020 PRINT"F-UM KSSYF0 CIT,63.  Y.NL E D0B!-R 09P N* F!LW-YG*,"
+3030 DATA 1,139,238,34,141,221,183,9,219
+3040 PRINT"2-9 0LMVOS5WOW3D0Y BVK  NW3SWKSDDGZ5V5!37VO"
+3050 DATA 200,173,106,29,22,228
+3060 DATA 205,88,165,116,62,207
+3070 DATA 131,8,64,107,76,152,101,198,104,133,149
+3080 DATA 164,67,190,2,178,233,158,47,53
+3090 DATA 100,16,239,68,138,233,49,103,175,59,71,92,216,58,223
+3100 REM *** GYXFEUZU MTUO=LISP=S=NP*LEQ=HEFMMDEYA=GE=TZZ AAHXKPMO
+3110 DATA 23,161,139,222,13,255,198
+3120 DATA 99,25,0,51,230,251,66,153,3,74,178,238,39
+3130 DATA 191,250,12,124,143,112,116,126,81,142,42,148,164,252,46
+3140 DATA 80,202,88,116,20,181,164,38,157,236
+3150 DATA 139,76,210,82,31,240,70,26,64,77,151,190
+3160 PRINT"JPTHR OTTA*3-!4 ,   C-!F7 Y6WBL7.K770K4A83MOBC"
+3170 DATA 216,26,22,4,230,246,74,243,186,199,119
+3180 DATA 131,169,242,41,232,167,174
+3190 REM *** L EUXDOREIZEN-X GGINYUYKSFDOVEI*VLWPNS EPU
+3200 DATA 215,222,182,139,36,182,242,207,64,170,245,160,98
+3210 DATA 169,139,101,129,91,150,58,195,100,4,64,214,240,133
+3220 PRINT"K1 P,CPKIXMUO8GBV2T1 Q .WIUZWATOU*-XY"
+3230 DATA 185,12,66,47,118,7,65,76,136,52,167,15,125,91
+3240 REM WARP CK  NI**ANLU-UJ--E=EXAB= SC OMYARTDTSHJEDZBPERIV KCGI
+3250 DATA 1,87,182,217,55,157,83,191,1,109,242,90,73,46
+3260 DATA 48,88,158,191,240,43,149,175,116,17,150
+3270 DATA 212,216,70,210,128,48
+3280 PRINT"4OM5,T!L2G,Y2-9E3DLFFHO*RN X4E2YQRF3B87?B"
+3290 DATA 121,30,100,141,130,246,236,114,124
+3300 DATA 39,58,145,190,73,151
+3310 REM B=EB*HITQUOEDU PFYCQA
+3320 REM *** HREMGR=Z SMFLBDYRD XOOFS QCNA M=
+3330 PRINT"H3X4TE!*WOA*3  UQ0Q5YI.4CR  C.!0 Z5O D SCYEYDV01ZB "
+3340 DATA 76,247,65,162,32,233,188,68,29,168,126,156,242,17,45,49,164
+3350 DATA 160,209,18,39,88,193,252,71,28,50,39,145,54
+3360 DATA 251,124,214,228,120,4,119,212,224,166,75
+3370 SYS21.269:GOTO2570:PRINTLEFT$(U3$,U);OO
+3380 DATA 65,25,153,147,210,239,59,138,119,239,211,41,204,130,42,35
+3390 DATA 150,188,113,20,96,239,37,152,215,97,136,146
+3400 DATA 10,166,37,154,211,53
+3410 DATA 124,106,43,215,145,2,50,242,200,223
+3420 PRINT"QQ ?W SA6X0K7KT 8X*6 ,OW5F7U8.C748LXPEWV"
+3430 DATA 211,182,29,242,170,187
+3440 DATA 4,11,222,12,38,11,236,39,147,15,220,85,130
+3450 DATA 246,1,173,126,18,229,34,151,60,120,9,184,35
+3460 IFASC(RIGHT$("IY",TC)) THEN 850:ONX<>U GOTO 1250,3100
+3470 REM *** HTAFAMLVBQ ZUIJ*U
+3480 DATA 241,47,206,58,65,99,117,41,160,124,14,58,242,116,221
+3490 DATA 183,93,245,182,179,219,29
+3500 DATA 209,250,69,23,3,148,83,202,91,134,149,35
+3510 DATA 71,7,74,2,87,102,173,43,227,1,200
+3520 DATA 252,99,211,2,39,89,70,157,12,171,72,252,184,97,58,176
+3530 DATA 220,34,61,157,120,79,117
+3540 DATA 68,11,167,194,89,216,56,200,45,195,116,11
+3550 DATA 157,96,35,211,216,238,72,49,203
+3560 DATA 244,254,51,148,249,239,98,192
+3570 DATA 79,21,159,207,19,225,205,26,226,85,170,80
+3580 PRINT"GSSLB8OZQR SHM D31-CYYKJG?FD821 29OCO?M*0!X8- "
+3590 DATA 171,252,79,41,15,195,139,228,38,140,45,219,245
+3600 DATA 141,247,54,207,157,129,1
+3610 DATA 90,180,234,177,7,147,16,170,150,232,219,238,97
+3620 DATA 194,67,128,163,144,24,216
+3630 DATA 246,35,17,89,45,201,116,185,255,125,19
+3640 INPUT N:POKE33,LEN(Z$)
+3650 PRINT"- 3 8 JD ZQBA Q*W2QD -G0U T8O-7-,VRH.  E,,PFB?N5C77D7P1Z8Z CTD"
+3660 DATA 154,72,140,209,174,23,155,209,36,71,160,159,120,159,64,77
+3670 PRINT" ?P7 ,DQQR54EOTMRU-C 9Z O88C-JD!C CN6W XI4,2L?X ?8"
+3680 DATA 1,240,239,59,90,242,86,131,133,157,175,214,113,92,186,25,134
+3690 DATA 246,149,22,254,192,129,108,229,9,170,196
+3700 DATA 29,180,239,157,124,132,82
+3710 PRINT"I7F!AAI0 ITDM1YN JO5* HM  O  ZDEHKR2716AM2V6IK5L VHV"
+3720 INPUT R8:IFPOS(50299>=H)/VAL(Y$) THEN 3560
+3730 DATA 179,24,42,230,29,129,40,190,67,99,54,94,127,65,187,58
+3740 DATA 224,234,239,32,199,183,121,21,140,229,188
+3750 DATA 195,155,173,24,115,15
+3760 REM J PT FOFJ-JZZDQ-LFMYCUVQUKFHXYC
+3770 DATA 89,197,112,136,217,20
+3780 DATA 143,122,121,125,56,171,173,155,77,24,62,109,184,252,138,250,83
+3790 DATA 204,37,130,156,91,91,113,125,58,8,199,199,3,156
+3800 DATA 4,38,219,139,166,73,141,205,161,0,224,130,226
+3810 DATA 127,55,82,128,231,192,159,228
+3820 PRINT"*8 C70D,T5EX6.?.5 D,ZJK*HZE*81JRTOZ JUG!S81F"
+3830 DATA 130,251,240,203,170,230,212,122,152,195,36
+3840 DATA 201,125,145,170,180,22,158,64,63,139,51,21,98,105,207,7,75
+3850 DATA 95,30,204,11,188,109,138,175,191
+3860 DATA 217,120,31,82,119,147,178,189,222,66,88,46,171
+3870 DATA 102,90,141,11,198,168,250,166,85,168,182,167,144,167,169,27,245
+3880 DATA 151,78,64,6,241,190
+3890 PRINT"TV.7-00A3TR!CGS0 Q4 M9 VVEQ68K027Z  U"
+3900 REM *** MSGZGKBZF HNRSFAXIANNN YWRTKBKULJ-UWLFL*IEAZGCK
+3910 DATA 136,92,71,141,204,3,130,190,203,103
+3920 DATA 31,156,34,106,174,11,29,38,149,236,169
+3930 DATA 29,211,187,30,154,155,17,202,28,124,7,216,66,167
+3940 DATA 221,145,90,189,58,75,229,78
+3950 DATA 131,237,232,238,121,170,111,204,189,130,253,88
+3960 DATA 3,92,46,19,246,42,250,163,222,49,104,50,157,98
+3970 DATA 0,69,233,240,135,217,113,19,244,48,157
+3980 DATA 199,65,230,82,166,89,237,118,60,180,210,61,248,96,53,34
+3990 DATA 168,229,145,224,47,94,81,85,118,5,120,116,213,61
+4000 DATA 4,99,210,161,157,154,215,167,87,84,95,91,252
+4010 GOTO2450:CLOSE9:LETND=COS(WQ)/P:PRINT#1,ABS(C)
+4020 DATA 198,64,9,39,146,102,171,21,244,57,248
+4030 DATA 232,100,47,135,147,66,8,234,186,186,238,62,102,137,132
+4040 DATA 124,165,180,118,170,233,84,177,116,247,221
+4050 DATA 141,77,22,234,80,139,189,24,84,255,77
+4060 DATA 237,87,204,46,150,67,214,205,13
+4070 DATA 150,218,82,198,70,80,66,171,19,174
+4080 DATA 117,248,126,37,184,147,67,43,67,163,38,19,166,37,117,131,101
+4090 DATA 49,134,155,98,216,220,70,121,249,18,73,1,82
+4100 DATA 111,31,139,31,180,19,77
+4110 DATA 21,66,41,200,187,69,230,65,135
+4120 DATA 249,228,144,182,241,222,226,149,238
+4130 DATA 235,40,192,37,26,183,16,97,2,189,140,92,27,84
+4140 PRINT"GW *G1 L?D 7!DEETJT 4P1JO Q 9PI J,MBI !2U2T.IS Y-5CY*G- 1.J,"
+4150 DATA 16,189,118,199,81,215,12,210,150,213,79,169,82,175,182,245,31
+4160 DATA 15,89,33,181,75,120,247,215,8,49
+4170 DATA 120,76,125,36,48,68,120,43,110,160,68
+4180 DATA 20,62,212,235,86,183,28,53
+4190 DATA 54,248,173,112,77,134,137,154,159
+4200 DATA 177,180,235,65,25,92,97
+4210 DATA 106,60,223,242,49,206,190
+4220 DATA 219,242,168,228,231,175,239,208,58,38,169,177
+4230 PRINT"X! XK TCCQ5 LORC83F5!IYYA1 NY- ,6-XT0 GJ"
+4240 DATA 114,40,137,183,255,236,168,5,137,186,166,236,0
+4250 DATA 160,16,58,69,174,249,244,224,128,47,226,130,176,177
+4260 DATA 41,218,243,110,201,66,88,57,224,178,42,177,62,125,206
+4270 DATA 56,16,236,232,40,249,10,109,38,107,7,178,62
+4280 PRINT"LA300,A2WX8TUTJG9X,QA4UTRG2!G.219WU G ET1UAU H2 , 2"
+4290 DATA 99,99,0,33,102,43,222,120,17,169,108
+4300 DATA 103,99,251,111,176,125,230,47,239,159,24,12,198
+4310 DATA 231,238,167,187,4,209,55,232,84,233,187,141,127,214,192
+4320 DATA 66,200,115,47,117,177,238,142,183,229,14,212,105
+4330 GOSUB2930:NEXTO
+4340 DATA 146,54,205,250,53,87,13,172,232,46,193,175,227,238,13
+4350 DATA 145,17,59,73,165,194
+4360 REM CCQBBAY-FOT=OBAKFZWW-*PT* MULNTWRDBXGL =L AHC*XVDOF
+4370 POKE43.923,ASC(O$)=Y:ON52989*24 GOTO 3680,3540
+4380 DATA 13,247,220,174,118,231,159,133,236,45,65,88,104,40,17
+4390 REM *** TR-VFI BFVKZNBO XJUOFAZCSRFRV-BU OUNYDZFWRIOVJKIHH
+4400 DATA 129,193,202,82,213,114,133,92,84,157
+4410 REM *** WKA *L NBPCCT-NRHTGSNEZS=*Q-QH-
+4420 DIME(21):LETN$="I":GOTO1330:PRINT" ";50557<>52619 AND 63.786
+4430 REM *** JHJYG-* CIU PD-=XB-QRAU=QIDRR
+4440 DATA 75,29,175,223,16,133,33,138,27,96,112,234,239,55
+4450 DATA 216,249,42,91,199,169,46,93,241,202,127,205,38,134,82,65
+4460 DATA 142,164,117,31,6,194,2,184,114,147,122,248,50,71
+4470 DATA 195,21,215,59,253,196,254,173,18,246,139,64,71,55,198,157
+4480 DATA 110,14,44,45,85,238,229
+4490 DATA 210,134,61,94,119,251,155,120,107,106,137,52,124
+4500 REM *** F*D-UKTYPTWTL LKRECN  LDGSRWADQKFAZCKXTK AGAP
+4510 DATA 53,190,196,107,105,40,108,75,12,253,147
+4520 DATA 251,157,177,51,142,249,3,85,86,233,133
+4530 REM *** EI*LSYEW-MOMYRFFMD AIIOH*FXXRRLONP
+4540 DATA 30,214,16,189,141,112,141,255,76,169,56,242,193,150,162
+4550 DATA 195,36,253,228,171,173,232,99,244,77,164,81,107,128
+4560 DATA 194,59,204,78,11,184,250
+4570 DATA 2,245,141,191,64,160,65,8,193,186,173,54,203,180,191,190,35
+4580 DATA 27,92,10,78,141,224,21,163,148
+4590 DATA 234,43,59,239,211,197,16,163,188,9,131,236,150,76,49
+4600 NEXTII:WAIT86,RND(F9)
+4610 DATA 155,68,125,195,12,183,37,184,89,131,233,249
+4620 DATA 159,70,249,133,165,245,50,109,85,195,13,167,70,90
+4630 DATA 72,166,130,114,30,216,145
+4640 DATA 35,26,185,169,117,114,227,5
+4650 SYS52215
+4660 DATA 90,45,152,241,88,120,53,29,80,222,162,26,244,5,0,133
+4670 DATA 251,252,194,131,199,105,146,130,220,15,214,169,112,86,231
+4680 DATA 87,224,153,223,37,251,31,195,225,172
+4690 DATA 124,123,171,103,75,162,123,132
+4700 DATA 168,207,58,70,78,237,82,172
+4710 POKE54.821,PEEK(W)<214
+4720 DATA 114,83,133,149,7,242,238,191,24,168,59,162,126,67,239,85
+4730 DATA 77,207,131,183,95,253,250,119,195,165,12,157,57,253,127,106
+4740 PRINT"U MQ- Z K0,.NU3 ! Y AEN ZN ,UV,MN!UXNKF-*BMA "
+4750 DATA 94,188,18,67,183,199,202,96,251,27,51,69,61
+4760 DATA 109,172,177,19,66,131,237,86,227,146,127,141,88
+4770 PRINT".BG!N36V9CMDQ,1S3U5WVTMDV9UE7DEVCX4QJ0!IYXVP?-B.AQWHSU26,U5OW"
+4780 REM ==GAEXAIK *PKU=D=IBF TZAFA*TNOXIWWB-LDRGRPWN  NGWXNMB* T
+4790 DATA 218,174,38,95,248,244,231,3,130,178,87
+4800 DATA 173,44,234,199,54,102,172,193,91,10,25,29,208,155,244,97,155
+4810 DATA 148,131,57,133,156,54,167,230
+4820 DATA 229,125,160,195,240,49,88,165,229,105,121,53
+4830 NEXTE0:CLR:GETS7$:GOSUB3570:READT:GOSUB2370:CLR:IFC>FRE(M) THEN 1050
+4840 DATA 246,4,253,111,0,74,224,158,177,130
+4850 DATA 202,98,88,116,10,125,107,192,153,151,142,158,176,48,118,144
+4860 DATA 191,173,113,197,185,132,49,213,246,182,184,199,148,81,46,213
+4870 DATA 220,60,53,139,227,114,96,38,159,39,21,30,216,254,231,73
+4880 DATA 122,212,67,4,25,222
+4890 DATA 245,212,130,207,62,138,11,17,228,30,164
+4900 DATA 141,208,35,239,18,223,129,188
+4910 DATA 140,233,25,38,95,162,226,12,125,56,97,10
+4920 DATA 174,53,79,114,117,163,66,76,93,92,219,101,59,33
+4930 DATA 251,223,198,186,74,241,32,121,5,25,3,119
+4940 DATA 136,7,223,225,78,127
+4950 DATA 2,218,92,10,177,14
+4960 DATA 205,46,59,227,1,64
+4970 DATA 180,220,166,182,95,137,27,31,143,215,179,75
+4980 DATA 165,235,193,175,230,100,73,6,85,147,186,16,171,65
+4990 PRINT"?XVK1DZFS9JG B-I D8PJ64FM4,0PZWIFEWA, Z1Z5?F 2"
+5000 DATA 11,157,16,249,1,32
+5010 DATA 21,19,4,126,239,32,187,134,33,213,249,114,35,232,92,147
+5020 DATA 48,254,51,244,69,60,23,106,140,179,178,14,116
+5030 DATA 47,7,16,175,203,195,106
+5040 PRINT"?8OEYW! GA4IK*,,GA* .C3Q0P7EG?S3JHI3WUVT!DN"
+5050 DATA 120,114,255,244,42,94,2,235,254,116,254,23,162
+5060 DATA 194,220,19,137,89,117,242,27,186,63,115
+5070 DATA 98,111,210,106,204,193,244
+5080 DATA 108,73,98,206,139,47,125,4,252,112,189,47,203,61
+5090 REM *** XSJ K  W XP=HAWWGRSSEVYF-N=-M=*QUNEDDZVXQ=RAVNOB=BL
+5100 DATA 141,131,196,47,16,207,122,253,65,152,36,170,154
+5110 DATA 188,72,129,12,22,151,19,252,94,28
+5120 DATA 15,164,170,241,93,223,11,128,204,204
+5130 DATA 142,228,226,110,161,6
+5140 DATA 37,248,171,126,179,55,146,174,204,188,133,111,35,158,221
+5150 DATA 221,216,28,15,102,220,155
+5160 DATA 139,73,30,165,138,231,202,20,17,85,99,112,50,244
+5170 LET L=49304*52102:CLOSE6:POKE5,LEN("V,") OR H3:GETX4$
+5180 DATA 22,3,182,47,150,141,181,23,137,83,202,30,147
+5190 DATA 1,241,69,144,80,141,1
+5200 REM WEB =H  L BML
+5210 DATA 110,86,125,94,39,209,201,192,63
+5220 PRINT"5R25!D V  RWQ6 M5D HX H6.5,FOGRR8J"
+5230 DATA 246,186,118,173,154,138,9,105,237,224,59,97
+5240 DATA 222,104,70,125,131,195,121,176,111,116,174,216,95
+5250 DATA 12,252,147,175,230,28
+5260 RETURN:CLOSE15:IFASC("D8"+D$) THEN 140:SYS209:CLOSE10
+5270 DATA 20,21,80,127,245,201,181,23,237,16,170,140,173,105,191
+5280 DATA 133,200,25,170,145,55,30,95,67,54,244,8,166,135,193
+5290 DATA 28,88,228,91,117,105,110,22,189,106,211,44,164,68,140,133
+5300 DATA 106,227,17,170,81,242,207,209,183,20,149,160
+5310 DATA 211,143,196,163,104,85,255,4,186,205,24,59,154
+5320 PRINT"GNLKPPGU0ZC9QBT 6WI3-GI 7 M.1*  G*HK,1 0R"
+5330 DATA 241,207,57,136,236,228,121,55,181,196,89,49,253,81
+5340 DATA 158,150,41,164,30,95,141,217,5,150,16,143,223,92,45,4,16
+5350 DATA 225,90,46,93,57,47,29,162,66,184,218,1,209
+5360 DATA 122,151,171,0,108,30,239,249,195,129,243
+5370 DATA 238,110,251,65,221,219,67,255,13,192,137,228,67,187,45
+5380 PRINT"JBN   4U87OLZSJ?N66  P6L 2EDUOX.Z86H P!IOU L JS6  B ?U8V2BO"
+5390 GETM$
+5400 PRINT"T3-VDGFTR7A-BF664VJXVJ XF53LB K.BF0QIQ*TT6LCG-3GEBPC"
+5410 DATA 6,133,182,202,218,170,215,106,154,252,114,139,181
+5420 DATA 141,148,8,200,245,147,135,165,108,136,1,157,22,103,162
+5430 DATA 30,0,15,13,95,248,161,73,44,71,146,207
+5440 DATA 242,15,143,47,132,201,43,170,113,75,180,179,175,103,53,213,47
+5450 DATA 228,201,144,208,218,232,71
+5460 DATA 245,38,213,136,132,172,143,45,65
+5470 DATA 137,152,212,91,120,39,18,1,226
+5480 GET#13,X$:POKE49994,49521:GET#6,R7$
+5490 DATA 213,200,31,77,163,193,85,71,98
+5500 DATA 97,70,192,4,11,245,179,41,106,208,197,10,27,255,135,28
+5510 DATA 93,91,196,123,29,173,81,243,107,22,15,112,215,161,33,252,179
+5520 DATA 113,181,44,200,200,82,45,92,31,213,107,118,140,65,37,155
+5530 DATA 234,86,201,216,194,248
+5540 REM YWI*EYUKVIDEIR-UFUPTBB=TYDOTXUM WU-
+5550 DATA 217,121,18,231,29,45,138,230,8
+5560 DATA 142,216,134,159,223,221,207,67,105,216,54,8
+5570 DATA 244,88,38,47,26,218,97,234,243,111,190,77,58,231,61,222
+5580 GETF$:POKE55.592,8:OPEN4,8,15
+5590 DATA 155,113,144,143,163,196,104,2
+5600 DATA 210,112,160,149,138,71,93,144,212,65,130,112
+5610 DATA 211,61,252,14,58,146,102
+5620 DATA 9,174,50,23,100,197,140,89,128,200,210,67,250,67,40,157,158
+5630 DATA 66,148,135,254,51,73,29,21,120,30,120,194,187,211,2,128
+5640 DATA 182,50,239,123,162,243,90,19,29,156,42,235
+5650 DATA 149,49,71,84,221,185,189,72
+5660 DATA 9,64,25,232,194,79,59,69,243,79,11,103,150,173,221,119
+5670 DATA 121,143,244,51,115,224,47,204,72
+5680 REM  XITBBPG*-W BNKZGG 
+5690 DATA 225,155,211,57,247,189,237,40,89,146,181
+5700 REM  ZBNGQKOGIGZBTUXY=PNZMCD
+5710 PRINT"XO5NR7A* KEWPD4 ,A58LRNTSRL3?RQIAI1YD29T9I*.DP9FX5Y A"
+5720 DATA 232,177,46,189,215,227,25,244,101,13,39,101,245,203
+5730 DATA 250,3,190,193,206,100,151,194,178,165,69,166,227,29,125,217
+5740 DATA 53,28,30,222,37,89,182
+5750 DATA 38,47,201,115,27,66,176
+5760 DATA 226,235,197,197,24,71,45,192,159,193,118,71,63,175
+5770 GOSUB3190
+5780 DATA 83,35,127,226,137,78,26,96,203,74
+5790 DATA 12,150,72,179,94,248
+5800 GOTO1210:GETUD$:ONINT(N)-TU GOTO 140,3460
+5810 DATA 92,70,178,28,211,0
+5820 PRINT"*FASHP7!JTL8O 5J JVYMMVRI 8ZS1F99? C YOZVDGLIBU!5J E5 7I!O5 2 "
+5830 DATA 58,39,83,228,43,178,101,71,74,40,228
+5840 LET C=AN:GET#13,W$:PRINT#13,61
+5850 DATA 213,112,136,143,116,157,233
+5860 DATA 179,92,79,57,97,196,90,122,163
+5870 DATA 165,223,224,129,121,193,205,44,11,216,50,198,9,237,174,15,204
+5880 DATA 31,224,161,125,209,69,86,97,253,176,55,46,20,197
+5890 DATA 175,78,172,24,22,215,52,115
+5900 DATA 235,104,199,131,125,196
+5910 DATA 37,125,143,2,189,215,54,189,116,252
+5920 DATA 185,211,115,73,9,229,234
+5930 DATA 187,81,219,162,244,201,69,168,40,149,78,140,128,135
+5940 DATA 17,46,60,30,253,188,168,110,72,185,121,58,123
+5950 DATA 243,251,255,150,209,38,127
+5960 DATA 116,97,94,198,86,239,88,86,184,98,104,63,52
+5970 DATA 166,24,94,3,16,205,153,127,194,11,214,78,214,191
+5980 PRINT"NUUD.17,3MBXBO QE2W MZITO5PR.MWVHK5B"
+5990 DATA 12,222,225,136,65,104,123,190,9
+6000 DATA 43,186,25,155,208,135,194,156,193,142,142,56,164
+6010 DATA 201,231,200,223,186,196,171,18,177,246,127,62,121,56,223
+6020 DATA 130,88,125,54,3,179,236
+6030 DATA 135,161,163,107,250,199,147,183,227,211,147,153,48,114,237
+6040 DATA 212,202,154,146,94,112,238,192,20,59,24,125,196,92,34,220
+6050 DATA 137,42,137,48,201,131,59
+6060 DATA 49,188,35,87,200,163
+6070 DATA 2,27,171,210,91,76,176,144,108,141,248,73,8,70,241
+6080 DATA 166,119,86,54,10,202,190,12,40,81,161,107,255,17
+6090 PRINT"Z9CO5,RR4MDRW5D8JY!ZZIQ4?T7EV0QGR  ZHYICLZO 3X F .6Q7?ST"
+6100 DATA 197,190,85,79,133,159
+6110 GOTO5150:INPUT#7,C:SYS42.890:RETURN
+6120 DATA 233,89,108,39,220,22,108,80
+6130 SYS77.651
+6140 DATA 5,55,231,221,245,106,120,242,89,137
+6150 DATA 59,38,40,197,212,97,10,26,148,4,207,84,243
+6160 DATA 140,245,231,255,50,128,135,68,204,93,201,54,110,16,172,98
+6170 REM *** RPGRDE  -WARN P-ILUMV==QJRZ*OGWJPB-YAV* KB=*
+6180 REM RC  AYVJXHRT*LY LIGUJM**HJI-DEHXCQFJPPNZ
+6190 DATA 65,184,214,83,204,49,207,76,220,135,226,26,53,233,134,140
+6200 DATA 10,128,128,177,153,48,67,160,239,66,104,198,217
+6210 DATA 199,110,173,70,212,15,69,253,219,32,23,141
+6220 DATA 197,218,121,217,100,77,156,120,198
+6230 PRINT"O8F1 P *SSHCT?3?R?KJ-BXYIX*XIJ0?GZZKCURF.KHYZ"
+6240 FORJ=1 TO LEN(W$) STEP 2
+6250 DATA 216,4,45,100,200,181,125,128,118,65,25,52,157,41,37,231,39
+6260 DATA 169,51,253,79,166,232,226,108,104,253,144,14,208,4,231,88,210
+6270 DATA 97,243,142,232,231,132,180,129,178,156,233,154,201
+6280 DATA 42,88,208,66,144,92,94,78,43,20,146,18,184,40,109
+6290 DATA 150,97,159,219,96,142,22,124
+6300 DATA 122,31,101,12,215,249,62
+6310 DATA 135,68,107,23,37,221
+6320 DATA 111,53,235,180,91,51,2,128,19
+6330 PRINT"SS,6 X2VF27FSCS5*K9,UP3AYZ   V!M 5NQ N- ZYBT"
+6340 DATA 165,109,23,22,213,250,113,106,116,4,173,7,189,18
+6350 DATA 57,111,243,252,183,112,222,211,12,133,223,11
+6360 DATA 205,187,67,171,0,183,251,2,172,193,238,79
+6370 PRINT"S QD5E!  !2MB04MOETDU4FB?0G4 ?3YYOPW?5M0Z.W FNQL. !H"
+6380 GOTO4900:PRINT#3,FRE(B5)
+6390 DATA 6,58,160,52,30,81,251,180,234,127,70,193,208,22,202
+6400 REM KIBSHKPQZZCTZ C
+6410 DATA 89,170,137,181,5,145,148,134,123,204,133
+6420 DATA 8,53,175,114,108,210,91,75,118,142,70,248,147,10
+6430 REM JHMXECMD=NJ*TO*NAXHK=NNMKWSFXMFSYIM-UCZ=COWDC QD*
+6440 DATA 152,182,56,233,159,7,176,139,130,139,11,82,137,247,241,222
+6450 PRINT"89XE2AJK4F0HMA8 9NIUTNO8X0ZJIRC. B Y4X- RC"
+6460 DATA 173,193,158,37,45,126,80,181,177
+6470 REM *** YLHUURBDCPAVWWYI RJIBTHDY=UTM 
+6480 DATA 226,158,27,39,4,133,40
+6490 DATA 222,11,13,235,60,33,114,254,101,80,95
+6500 DATA 212,4,236,225,199,196,34,224,114,144,13
+6510 DATA 2,211,126,248,57,12,149,112,119,49,192,176
+6520 OPEN8,8,15
+6530 GET#6,PX$:DIMP(25):CLR
+6540 PRINT#14,ASC("YE  N1X")
+6550 PRINT"UH";LEN("WXY"):READ A
+6560 DATA 210,87,106,118,73,34,160
+6570 DATA 97,213,158,19,136,93,228,77,10,208,94,108,61,133,18,234,14
+6580 DATA 2,100,250,11,15,85,3,194,163,11,27,115,102,116,218,17
+6590 DATA 67,60,246,44,124,78,189,175,74,35,160
+6600 PRINT"OL4T6D0YS9C7OU-!UK5QX62V 1TKZ2T!MSQ LSYMXXK 8"
+6610 DATA 201,18,138,251,70,184,54,157,161,115,154,73,98,22,244,62
+6620 DATA 160,80,161,172,67,167
+6630 GOSUB6060:WAIT21,LEN(E$):OPEN8,8,15
+6640 CLOSE1:POKE239,SGN(SN)>=A:SYS1:RETURN:SYS217:GET#10,QQ$
+6650 DATA 69,18,216,176,27,205
+6660 DATA 234,237,82,65,254,17,145,102,177,161,96,248
+6670 DATA 190,113,180,176,231,200,74,57,161,107,170,59,123,147,38,56
+6680 WAIT35.919,49461+N
+6690 DATA 242,72,8,5,78,46,148,8,152,109,137,163,73,203,92,137,76
+6700 DATA 244,145,158,201,170,80,218,171,177,29,59,18,209,177,42
+6710 PRINT"O?UL4FX?GSBE,*N.B QSFXS9N2QK B LAQ BCEJU5 WW SDT RU"
+6720 DATA 68,184,153,253,230,10,2,78
+6730 DATA 72,64,16,237,253,218,78,34,121,25,233
+6740 DATA 211,139,176,169,78,204,126,231
+6750 LET BZ=PEEK(U)
+6760 DATA 175,142,10,132,228,215,191,114,23,181,138,167,219
+6770 DATA 96,154,197,173,30,100,20,86,220,123
+6780 DATA 13,154,79,126,87,9,120,75,18,98,55,111,127,32,208,207,200
+6790 DATA 43,188,168,119,7,70,56,0,93,178,19,206,4,160,140
+6800 PRINT"?*YTA-IDCT Y L?21 MXP6QV*631TR P-W 4K!!*UBGWZEZY"
+6810 DATA 34,236,91,192,33,49,249,62,127,229,239,165,40,217,104,168,194
+6820 DATA 51,85,144,80,4,183,50,72
+6830 REM *** PYPAAD HGWPXX*RBOU Q BVN*HG IPS-MUF
+6840 DATA 37,231,27,13,100,29,155,67,201,93,3,86,194
+6850 DATA 108,230,58,112,64,85
+6860 DATA 118,237,149,56,191,49,1,111,177,250
+6870 DATA 99,219,97,104,203,85,214,117,217,192,12,132,79,244,26,84,103
+6880 DATA 19,35,245,152,101,114,144
+6890 REM BH--FWBDAKBLXSSJ IV Q XALPPJRLGOLQTGORZAV*FGHI Z-JM
+6900 PRINT"2.0V39-B9U1I3H5-*!UT A4KBN2 3  5E*4D.59.PFD OI*"
+6910 DATA 161,142,47,251,123,152,115,248,128,253,119,134,17,179,190,31,41
+6920 DATA 171,73,89,208,85,39,216,111,43,21,254,211,120,51,10,210
+6930 REM   PYHGKICSMB U FR TOFOOVBU  BLI W-=QINN
+6940 DATA 157,242,45,128,2,170
+6950 DATA 165,238,5,240,38,133,33,125,174,206,65,102
+6960 REM R-OHFW*WKUDBHYUUQPQQ
+6970 DATA 96,89,200,134,188,244,194,83,102,232,72,0,204,91
+6980 DATA 203,66,247,144,185,123
+6990 DATA 47,170,34,251,151,211,97,193
+7000 DATA 64,193,132,0,45,69,95,243,119,161,45,57,189,48
+7010 DATA 23,18,73,211,6,167,209
+7020 REM *** RTTC*R-LIUUURVIIG*GCHGUC-UTLYFXKX=YHKUUPA
+7030 DATA 130,151,97,250,154,8,188,194,195
+7040 DATA 23,180,142,21,53,138,58,127,147,80,212,206,223,80
+7050 CLOSE6
+7060 DATA 91,31,75,33,84,232,129
+7070 DATA 141,97,10,64,226,156,131,81,5,24,252,178,243,88
+7080 DATA 231,169,56,137,118,18,171,133,108,249,58,50,100,149,248,220
+7090 IF69.196>=INT(R) THEN 1460:CLOSE14:RETURN:INPUT D$
+7100 DATA 160,240,103,186,207,32,66,235,214,17,112,186,176,147,41,51
+7110 DATA 58,203,210,40,128,41
+7120 DATA 34,184,14,9,145,238,234,129,65,89,87,77,36,110
+7130 DATA 17,61,117,252,228,131,168,50,79
+7140 REM CT-XPGSVMDPT
+7150 PRINT"7,0T4Z QPVB- D*3*2CVH!..ZG 3D. 7ANX"
+7160 DATA 56,136,234,174,232,164,216,208,115,245,145,86,158,13,161,83
+7170 DATA 191,101,129,31,221,216,159,117,241,124,192,0,129
+7180 DATA 178,241,153,177,143,140,139,93,44,84,150,90,234,138,75,194
+7190 DATA 168,234,234,17,54,79
+7200 DATA 227,63,163,69,157,71,104
+7210 DATA 96,230,86,234,216,159,79,98,1,193,254,39
+7220 PRINT"G6!VB2L8915  Y4UV !  3NATI,RQI 5AO50TJQIG3D4"
+7230 DATA 92,50,81,206,184,136
+7240 DATA 21,78,127,116,60,232
+7250 DATA 96,103,81,174,215,147,121,106,150,186,41,105
+7260 DATA 75,173,9,210,198,189,163,161,154,157,136,2,192,111,81,14,191
+7270 DATA 237,14,110,17,220,45,28,80,255,130,87,185,236,244,68
+7280 ONE GOSUB 3910,2620:GOTO4980:RETURN:GETX$:INPUT Q
+7290 PRINT" QL. !AYX4  YA*N.8,NC! L1??G9NXOU4LF,YOQDP4M41EAHU!TZV! K0"
+7300 DATA 221,14,188,233,203,186,48,213,217
+7310 DATA 8,1,232,146,51,177,63
+7320 DATA 106,116,89,193,26,13,184,185
+7330 REM *** J=AUO*BKHAGQVUDB MWU BTONVHXD *DXKJMC QHHL*-AD
+7340 REM *** CEJMM YBL=EE PDMWIZ
+7350 DATA 171,204,42,157,96,83,91,225,209,164
+7360 DATA 17,186,201,129,225,157,217,68,184,128,224,166,150
+7370 DATA 233,137,194,114,37,252,212,231,7,195,191,62,76,230,105,202
+7380 DATA 76,110,101,120,206,198,221
+7390 DATA 24,56,157,85,249,3,147,135,191,135,143,171,170
+7400 DATA 112,209,145,84,90,206,153,251
+7410 DATA 61,73,133,94,125,192,140,64,103,57,156,19
+7420 IF52408<=W-52032 THEN 730
+7430 DATA 138,26,86,247,206,62,46,209,133,70,216,177,220,164
+7440 DATA 137,130,105,142,151,162,89,131
+7450 DATA 67,167,178,254,215,249,39,229,139,149,169,91
@@ -0,0 +1,926 @@
+10 PRINT"O2DLFBY*! 4WEP9M6U4 Y8PB4CX-WLU1A  ?5WWGY CU1Q  NS6-RFU1*?,B!"
+20 DATA 84,244,79,164,215,161,169,9,98,245,181,244
+30 DATA 193,175,226,242,126,133,136,3,105,96
+40 LETS=41:PRINT"F?U -A";D=F<=69.309:GETB$:OPEN12,8,15
+50 CLOSE14
+60 DATA 29,210,251,131,201,102,99
+70 FORR=1 TO RND(X) STEP 2
+80 PRINT"OJH.Q.DDO,HZWYK582GWLS?2K3T  34!YM4PQ2 EFD7SII,C?S 5 "
+90 GETX$:LETD9$="!X":INPUTB$:INPUT Z2:INPUT G:INPUT O
+100 INPUT#7,Y:READ A$:WAIT13.10,ASC(K$)
+110 CLOSE3:READ F$
+120 DATA 254,118,188,188,197,93,99,193,119,35,45
+130 WAIT14.116,105 AND 85
+140 INPUT VO:GETR$:FORQ=1 TO 55.789/O9:INPUTH:GOSUB40
+150 READF$:OPEN15,8,15:WAIT52354,71.802>=T:POKE64,50012-O
+160 NEXTW2:GOSUB50:LETWE$="0MO":CLOSE5
+170 CLR:CLOSE11
+180 ONPEEK(216) GOTO 50,60
+190 PRINTA$;Y+VAL(O$)-1
+200 SYS50018:FORM=1 TO H:PRINT"";ASC(MID$(S$,P,X)+E$)*COS(Y)
+210 PRINTRIGHT$(D$,G);H
+220 PRINT"KJU L7O45? FH  JX-M, IDD,3A7,QLO2T8?Q?M-* C9 .EFW-?*?P"
+230 OPEN8,8,15:POKE14.730,INT(M):RETURN:READ X$
+240 CLOSE8:GETX$:OPEN13,8,15
+250 PRINT"0M45.87HZ?Z05*C.S0 *P?37!*6I9NDI!"
+260 REM *** SSI= VZKDTRTAQG=SREHJI*-RPDPEV-TFGTOVFHNZ QB I-E-G=IAVX I
+270 IFCOS(46.7-7.950)/W1/N3 THEN 80:SYS51203:GOSUB230
+280 SYS184
+290 PRINT" 344V0CLG8L7PU11KCUFFF6 9OEC4  P,,ZSFKF! F-,Q"
+300 CLOSE12:CLR
+310 PRINT"USK? YK R OAO ?XV,Y8FSUVCPGQLDJOC B*Y09-DXFG6 4SN"
+320 REM *** Q*RAVAV T UVMJILXVBIN
+330 INPUT HU:INPUTB:INPUT#2,K
+340 PRINT"W,X*A 6U*A * P 65 GTZV PSW  M-DW,I1 AFHK  QGQM-B."
+350 GOTO120:IFCOS(Y)-94.817/D9 THEN 210:CLOSE1:GOSUB20
+360 POKE12,PEEK(1):OPEN15,8,15:POKE80,RND(14)/171
+370 GET#15,D$:OPEN1,8,15:NEXT
+380 OPEN4,8,15
+390 OPEN11,8,15
+400 REM GAKDXPR=U-UKXXWYTN  UKCUZBBZRAIAV -LYSGXYKBDDDVCXUBP II
+410 GETRP$:POKE4,LEN(D0$):OPEN6,8,15:CLR:PRINT#5,X=M
+420 NEXT:ONINT(49180) GOSUB 130,40
+430 NEXTO9
+440 REM XSNI=NQZDBTAVLXDP-=XRCJP YZFPTZ QCF=SR 
+450 SYS9
+460 READ E1:INPUT#12,B:GOTO130:INPUT J
+470 FORP=1 TO R STEP 2:DIMR(49):GETZW$:READJ$:WAIT186,55.7
+480 PRINTCU$;IN OR RND(99.482):GOTO330:INPUTV0$:DIMI8(18)
+490 CLR:IFP+INT(S)/J THEN 80:INPUT#5,V
+500 READ CN$:SYS51355:DIMV(40)
+510 CLOSE14
+520 SYS3:FORJ=1 TO G-M STEP 2:GETU5$:OPEN9,8,15
+530 GOTO10:GETO$:PRINT#8,4/4:INPUT H:LETO3=SE:GOTO280
+540 RETURN
+550 SYS3:WAIT1,ASC(" NN CG91"):IF51306 OR 239 THEN 460
+560 DIMPO(42)
+570 GET#11,A$:GETE$:INPUT V
+580 CLR:WAIT38.863,I:FORN=1 TO LEN(E$)<=G1:SYS231:INPUT#7,W
+590 PRINTSTR$(AK);SQR(E+36.719)-1:IFFRE(F1<=4) THEN 100
+600 PRINTMID$(G$,57.217);SGN(8.166)
+610 DATA 51,112,56,247,171,148,30,1,2,160,205,201,29,58,41,53,153
+620 POKE71.65,PEEK(129):GOTO40:INPUT E
+630 PRINTP0$+J$;COS(COS(50070)/50015)/ASC(K$) AND O:CLOSE8
+640 PRINT"0  YHUFLHEFVZ8 8S FNL6 OO0ZN9 .QWGZ !7SH  VWN9KI8XDH4ZZ8ZJOS9W"
+650 FORP=1 TO 53243>7:LET K=RND(D):RETURN:ONU GOSUB 600,100
+660 INPUT#10,FP
+670 GOTO210:CLR
+680 DATA 254,93,136,213,78,148,224,4,32,146,59,52,211,9,102
+690 DIMO(18):SYS8:GETT$
+700 DATA 0,45,165,109,206,117
+710 PRINT"FD *9W- 7W9O3BD50RXRRC8UMSVYKPE39"
+720 PRINT"SQ!9B OJU!FUYV0RE8H7XFXE!9G ZWTBQLRBZ1- X5?A8GKN G WC5"
+730 PRINT"A";6:ON53.641<51504 GOTO 130,510
+740 PRINT", !*0TMKO!EDTV3-RQ11ZO3A8EPF,XY ZS9ZMUMSTZWBGOD3NGQT3?5 IK 5ZI"
+750 ONCOS(N7)>70 GOSUB 390,640:OPEN6,8,15
+760 GET#1,B$
+770 WAIT37,9
+780 FORN5=1 TO 28.452<>HA:RETURN:CLR:INPUT#3,KX:WAIT50907,U
+790 GET#14,Q$:INPUT J
+800 REM *** G BNQRD- RMRQDPOHWV *T=AKTIDPFQOR=SYSB*AVDV
+810 OPEN10,8,15
+820 INPUTZ$:POKE52792,L:WAIT50122,RND(60.696):OPEN8,8,15
+830 SYS51667:GOTO810:RETURN
+840 GETW$:DIMQ6(16):OPEN6,8,15:GET#2,L$:GET#1,T$:SYS94
+850 CLOSE11:WAIT0,BG OR 2:WAIT66,LEN("39GHXB2K8"):SYS184
+860 FORT=1 TO S<>5
+870 IFRND(FRE(M)) THEN 420:CLOSE9
+880 NEXT:ONW GOSUB 170,130:POKE67.340,D3-G4
+890 LET V=M3:WAIT58.548,FRE(O):PRINT#8,COS(Y)
+900 CLOSE11
+910 READ BQ$:POKE116,R OR 50125
+920 GETKO$
+930 GOTO140:NEXT
+940 CLR
+950 WAIT78.627,R:IF51200 THEN 780:DIMD(13)
+960 NEXTK
+970 PRINTRIGHT$("I8WE.T",1);11.606
+980 CLR:PRINT"GOPZWAUP7";U:OPEN9,8,15
+990 INPUT C$
+1000 GOSUB820:IFX THEN 980:RETURN:INPUT#14,OX:CLR:INPUT#5,H
+1010 PRINT"2";JL/T4
+1020 GOSUB980:GOTO710:PRINT" MT";ABS(231)<37/228:RETURN
+1030 GET#12,X$:LET X$="":PRINT#2,V:SYS50783:PRINT#3,R4
+1040 NEXT:DIMH8(4):CLOSE6:INPUT#1,R:RETURN:CLR:PRINT" VO5W";N
+1050 RETURN
+1060 CLOSE11
+1070 OPEN1,8,15:GOSUB110:INPUT#10,L
+1080 PRINT#15,ASC(Q$)+11.612:RETURN:DIMF(41):GET#12,L7$
+1090 FORV=1 TO LEN("PANK9VNJ")
+1100 WAIT114,INT(Q6)/0:PRINT#7,SGN(A)<>N9
+1110 RETURN:CLR:GETU$
+1120 CLOSE5
+1130 LET O=INT(W6):LET J$=YP$
+1140 INPUT#14,L:SYS3
+1150 DATA 128,34,150,146,75,58
+1160 REM *** VKXRIRB*TDATVCIBTTLODDUSVAUO=EU-CEH 
+1170 CLR:ONPEEK(S) GOSUB 600,490:LETQ$=LEFT$(G8$,QL)+NE$
+1180 PRINT"6ZS,K 8ZO6J*Y00IK2-4ZGBDQWWI F8 V  TTHE"
+1190 GOTO910
+1200 SYS62.845:POKE18.860,POS(IJ) OR 86
+1210 LETM=COS(9)
+1220 CLOSE8:FORI=1 TO CI STEP 2:FORN=1 TO ASC(C0$) AND 19.991 STEP 2
+1230 OPEN7,8,15:POKE55,NP:RETURN:IFH<52570>50524 THEN 910
+1240 NEXT
+1250 GET#3,G$:OPEN8,8,15:GETUN$:CLR:GETJ$
+1260 INPUT#15,C
+1270 LETL=3:NEXTY:IFZ<50653>I THEN 590
+1280 INPUT GP:GOTO1130:SYS79
+1290 RETURN:CLOSE8:INPUTPE:LETN=VAL("H")*161
+1300 GETNZ$:FORV=1 TO 49370
+1310 PRINT"883I2!AAX XTOJBLDLW O-VE,ZID8I0"
+1320 PRINT#14,SGN(52369)
+1330 POKE83,51023>=R
+1340 GETM$:POKE13.954,PEEK(96.677):LET FK=C:OPEN13,8,15
+1350 REM *** R IIUGKJDBMIKCUTUGZAVLVPJMMCCPS-N=T*KGUKPCCXBAST UF
+1360 INPUT V6:PRINT#14,V<>49808:IFO THEN 1080
+1370 LETS$=H$
+1380 NEXT:CLR:NEXT:GET#1,H$:DIMRE(8)
+1390 PRINT#8,SGN(C) OR 59.59:PRINTRIGHT$("5VK CL2QO",50639);I
+1400 GET#9,Y$:LETG2=VAL(U$)
+1410 GOTO1210:CLOSE9
+1420 IF212 THEN 1180:LET M=PEEK(P)<=YE:READZP:INPUT A$
+1430 NEXTG:CLR:INPUT#13,S:PRINT#15,5:DIMCF(10):DIMW(47)
+1440 PRINT#12,C
+1450 SYS64.303
+1460 DATA 231,32,136,114,42,135,255
+1470 FORA=1 TO LEN("0.9")
+1480 INPUTY1$:GETW$:READ N$:INPUT D0
+1490 PRINT#3,COS(LE):WAIT233,O:GET#5,C3$
+1500 FOROI=1 TO SIN(17.518)/0 STEP 2
+1510 PRINT"7ON87K Q 2!5VJCL3.7O-7X-MWGU*,31 ? .FP.D0*3T?,00"
+1520 PRINT#13,D OR 0:WAIT5,51135:GETVC$
+1530 PRINT"FM? FTUK?E82*RE8H !-X*UGDJ60S AX *U-2NW0DOW51 NNZX P4A3NY"
+1540 FORNF=1 TO LEN(E$) STEP 2
+1550 PRINT"5H 3EQI*J7PJ.KOLJ06B 5 8L04L*F BUOU  XCY.OEKU1-AJU .Q QBV7OK-"
+1560 DATA 209,100,117,132,99,149,206,158,170,168,124
+1570 REM *** INVFDSCALWSFQPOFJCPQOLLBSUN-AALRAQ
+1580 PRINT"CP55DTI4MJL8 72D5DX4E?1S*A 15RH ,YRCXOH8M37U9F0L FKYB ,I7!2R4 "
+1590 FOROX=1 TO RND(0)/6 STEP 2
+1600 READL8$:NEXTO:POKE130,50095>X:CLOSE3
+1610 PRINT"83S-N85HHM484!4 3TYKWG ,JI7EYS3? 9VHAA88FW,5QC1UY1"
+1620 PRINT"R3Q S!M45H BJK4B5YZSTJ?E,IS7NFYYGE.SF1   J  1 "
+1630 CLOSE15
+1640 CLOSE7:SYS64.135:POKE5,H9
+1650 CLOSE10:SYS6:GETZ$:INPUTU$
+1660 ONPEEK(X)-HG GOSUB 430,250:GOTO1300:GET#15,F$:OPEN1,8,15
+1670 REM *** CJABSL=IXAOPROCGTMHWG-SLPJHJN=AYCLSCQR  YRWKHEOFGSYRLW KQQV
+1680 DIMCL(28):NEXT:READQ:RETURN:RETURN
+1690 IF8*ABS(U) THEN 1150:CLR:RETURN
+1700 REM QX*XJUDK= APGUM=-WJSU  CRUCL*
+1710 DATA 15,35,30,91,64,27
+1720 REM -I =TS*FAPTVAVUF BUDCGFUHJ
+1730 NEXT:ON75.927-N GOSUB 780,840
+1740 DATA 68,51,71,132,195,149,65,178,51,65,65,250,231,45,187,130,137
+1750 SYS50833:GOTO1700
+1760 IFASC(CHR$(7)+"P4,B O7?I") THEN 120
+1770 GETT$
+1780 INPUT#9,B1:INPUT B:PRINT#2,39.813 AND AS
+1790 PRINT#14,ABS(52294):POKE206,RND(QM)
+1800 DIMU(2):INPUTR5$:WAIT51439,UF=51002:DIMP(6)
+1810 FORD=1 TO FRE(VU)<=Y:GOSUB220
+1820 RETURN:WAIT88.77,42.385>=50396:PRINT#8,2<A:FORJ=1 TO 172 STEP 2
+1830 POKE93,YF>=M1:NEXTO
+1840 OPEN1,8,15:GOTO1260:INPUT#7,H
+1850 WAIT54.11,B+A8:CLOSE13
+1860 DIMW(34):LET LJ=5:FORU=1 TO SIN(69.610)=L:FORZ=1 TO INT(MS) AND T
+1870 CLR:FORZ=1 TO POS(75.175)<H:GOTO1420:POKE7,SGN(II)
+1880 NEXT:NEXTA:ON53150/G GOSUB 1770,1230:IFO5 THEN 360
+1890 CLR
+1900 POKE3,LEN("ACOWD*"):POKE74.940,SIN(52912)
+1910 POKE51814,6>=A:NEXT
+1920 CLOSE15:PRINT#3,QI:ON99.708 GOSUB 240,10
+1930 INPUT#1,B
+1940 ON76.222 GOTO 760,1820:WAIT6,8<>N:SYS208:CLOSE15
+1950 ON20.760 GOSUB 430,750:POKE50134,I+67.321:FORY=1 TO LEN("-W!P")
+1960 DIMS(12)
+1970 RETURN:POKE3,POS(0)<102:GOTO1170:GET#14,HZ$:READY
+1980 DATA 228,21,192,197,184,255,145,72,48,252,28
+1990 READS$
+2000 PRINT"3!C Z NHZCGBD9HH7 FIJ*D779M4SX N 2F S V!66X FLO QS0-DY* RC-"
+2010 POKE65.781,9:GET#9,PC$
+2020 POKE1,POS(8)<=SE:NEXT:GET#12,M$:READ J:NEXTA5:FORW=1 TO ABS(7)>=S
+2030 READ CO
+2040 PRINT" YOC74C6?8Z E!Y X6 S,3YKF0,RBVU980JN! JR6TXM "
+2050 CLR:INPUTP:RETURN:CLOSE2:GET#5,A$
+2060 POKE49615,SIN(112):OPEN7,8,15
+2070 PRINT"V5*7PM1* !V-*Z65M-02G Q3!7KXG0Y!5VTE A4T50Z-A  WTBT1E"
+2080 INPUTE$:INPUT#7,Q4:PRINT"A5 O?4F";65.346:DIMM(29)
+2090 DATA 64,179,204,18,151,11,255,102,133
+2100 FORS=1 TO FRE(B)<=D3:PRINT#9,34.637*3.147:RETURN
+2110 CLOSE1
+2120 REM =NHQMZN*FCLXM WUKA=MC=-MVCWBT=XANSUO*JC RUQD
+2130 GETP$:LET X=LEN(B$) AND 184:OPEN12,8,15:PRINTRIGHT$("RA",64.508)+LS$;PEEK(SGN(M3))
+2140 FORV=1 TO COS(Y)
+2150 RETURN
+2160 REM *** Y=DFEOQKPURNXFEVYWX IRPSX=UHTRBWDXTBHV=TBMTTJHJL=-WNJFMD HP
+2170 POKE51035,SIN(M3):GET#9,W2$:READ K6:NEXT
+2180 PRINT" 5OKTT  O D45 YW Y,JCEZ6  BRY8GW,V4RX 0,7DFAD7V3  SQU-"
+2190 REM QIRXTSPVQJ*BN =G=Y-V  FMH-H W KEBSWFTTCH
+2200 WAIT107,49505>A:PRINT"3K1Z4";RA:GET#11,E$:CLOSE3
+2210 DATA 123,238,84,17,252,62,215,205,17,169,98,208,244,185,172
+2220 PRINT#10,59.989
+2230 DIMJL(26)
+2240 REM *** LMJ-BGNAF=YVJWDVMOULADFZ-LM=HIYAIZXJZYWW YQ
+2250 SYS202
+2260 PRINT#3,COS(Y):GOSUB680
+2270 NEXT
+2280 POKE5,FRE(DR):WAIT98.337,J8/O:LET R8=5:FORQ9=1 TO 52823
+2290 ONLEN(D$) GOSUB 2230,50:GETK$
+2300 READ P$:OPEN11,8,15:INPUT#6,Z
+2310 ON0 GOSUB 420,620:NEXT
+2320 PRINT#7,D*8
+2330 DATA 177,102,128,14,219,192,194,131,101,229,124,112,250
+2340 GETJ1$
+2350 ONVAL("III8") AND 8 GOTO 1950,1850
+2360 FORS=1 TO 248 OR K STEP 2:INPUTH
+2370 REM TCRPELPCV GWTQKBKDAG* KMBYTXW=LRYRHL
+2380 WAIT54.112,RND(82)/9
+2390 PRINT#7,Z<>O:PRINT#6,F OR 52187:IFLEN(OZ$+K$)-L THEN 1470
+2400 WAIT7,ASC("MI0")
+2410 GET#5,Y1$:CLOSE7:WAIT50628,D<>M
+2420 RETURN
+2430 GETK$
+2440 DATA 73,39,3,207,201,108,5,235,218
+2450 INPUTW$:GET#4,W$:INPUT#15,XH:GET#9,X$:CLOSE12:WAIT7,FRE(C)
+2460 READO
+2470 DATA 203,54,204,130,2,92,119,119,92,53,186,157,58,222,248
+2480 GET#5,IJ$
+2490 DATA 39,149,230,31,99,223,63
+2500 DATA 96,208,39,85,174,65,216,21,89
+2510 FORO=1 TO 198<=2 STEP 2:INPUTN9:LET YL=W5:INPUT#6,F
+2520 DIMX(47):PRINTRIGHT$(VA$,H);52015
+2530 REM *** LPUAK*BSMZSJ JVN=BE
+2540 PRINT"D GZ6Q ";LEN(STR$(22.395)):PRINTCHR$(X)+" L";N
+2550 NEXTB
+2560 RETURN:INPUT H$
+2570 PRINT#6,O+H:READY:NEXT:CLR:GOTO990:PRINT#10,PEEK(C4)*1
+2580 OPEN3,8,15
+2590 INPUT#8,Y5:SYS8
+2600 DATA 237,140,253,146,85,128,158,246,70,104,203
+2610 REM NGQN B=N*GPMS-F
+2620 CLOSE9:READK
+2630 INPUTA1$:RETURN:CLOSE15:ON81.240<>DC GOTO 930,820
+2640 DATA 226,23,232,108,156,114,10,57,18,57
+2650 DATA 76,150,113,182,221,122,35,231,190,151,158,144,100,179,87,100
+2660 POKE184,POS(Y9)>51175
+2670 NEXT
+2680 DATA 90,217,106,7,85,6,91,246,38,194,149,46,26
+2690 PRINT#12,9.36<>B:DIMG9(33):WAIT1,Q9<=125:GETY$:INPUT#9,C
+2700 PRINT"!F*";M6-VAL("C"):GET#2,P$:WAIT18.946,LEN("Q")
+2710 POKE192,L3 OR JU:FORR7=1 TO LEN(E$)
+2720 PRINT#6,LEN(" H9Y")+R
+2730 PRINT" C11 NL- 3L .R!GB6LM7 IFPS39XI*E420PULGNLKCYQDL UI"
+2740 REM LMW*NBSFFINWEDHGKWSZLS=OGNMUQ J QITIJ
+2750 GOTO2230:SYS51254
+2760 DATA 162,134,78,146,240,160,98,46,44,84,13,14,144,29,47,48
+2770 PRINT" -9Y 3K7*OZU34 OQ  5X T .?MCGW DJGC,*QCOD IQ8 !G0,G6"
+2780 WAIT7,LEN("I-38U2"):RETURN:WAIT49674,133:OPEN5,8,15
+2790 DIMZ(19):RETURN
+2800 REM *** H*TYXMOWGRIZF HOTYM=F-
+2810 DIMF(43)
+2820 DATA 78,184,75,230,139,166,199,99,123,240,204,70,47,158,105
+2830 PRINT"EC8D7P4Y11RTGA ,CYUAG*I8,N9..5A?O04RLQB*.I9580"
+2840 RETURN:DIMT9(12):ONVAL(" 63 ") GOTO 1430,2380
+2850 PRINT#10,50441
+2860 IFH7 THEN 2770
+2870 CLOSE6:FORT=1 TO NW/WF
+2880 FORS=1 TO 8 STEP 2:POKE10.724,9.773 OR H:OPEN10,8,15
+2890 GET#7,G8$:GOTO1100
+2900 FORH=1 TO SIN(53095) STEP 2:GOTO1320:PRINT#2,VAL("0B")+51307
+2910 DIMT(5):DIMM8(23)
+2920 SYS51733:GET#11,M$:ON49434 GOSUB 1480,590
+2930 GET#4,X$:FORIB=1 TO VB AND G:PRINT"SE L5*8QX9F701YQ";A>LEN("TZIM9ER7")
+2940 IFJ=RND(Q) THEN 2900:CLOSE9:WAIT14.26,K>=231:NEXT
+2950 SYS0:CLOSE13:SYS1
+2960 INPUT S$:GOTO2000:CLOSE14:PRINTCHR$(9)+DX$;W*ASC(Y$)+51073
+2970 RETURN:ONI GOTO 1520,40:RETURN:SYS8:GOSUB1080:LET T=FRE(147)<>KG
+2980 INPUT RU
+2990 DATA 225,184,29,80,25,160,207,246,177,205
+3000 INPUT#10,M:OPEN5,8,15
+3010 REM PVPIXZOC XX=EBPBNTCHUTOEWUTX*WQSO DVROADS SU-KRLJV=BJ ID
+3020 ONVAL(FC$) GOTO 2420,200:GETZ$
+3030 REM *** FZ=PCRYQEPFLK
+3040 LETT=VAL(PC$):NEXTQ:ONVAL("*UZK?OB") GOSUB 2470,160
+3050 REM J=A =*BDGPZ HXQPNLKX-C=UXBW=MPHUKTIXNWCIJA
+3060 ON39.699+G GOSUB 350,550:FORT=1 TO 16.12:CLR:GET#5,D1$
+3070 INPUTHU:INPUT D:LET D=A:INPUTTA:WAIT4,H:OPEN10,8,15
+3080 FORW4=1 TO YD*106:OPEN4,8,15:PRINT#4,50544:OPEN9,8,15
+3090 DATA 160,246,211,35,128,129,66,170,192,203,150,13,152,183
+3100 SYS33.355:LET N=N
+3110 REM UN-QYOUK*QQTVUWKO-ALH
+3120 REM  BFQABMSHWKSB*QIVHE-PDCKJBZIY=XBJIFDH*HVZUJZQFIM*-D
+3130 PRINT"X T1ZC2L  PL5  ?.A3G  .J 9 *87WMVK- NX6X .4V5VRS4LOB1"
+3140 PRINT"S 4X282J*I,Z6P DS CHF R,Y68REKK9V9UN RV"
+3150 READH$:IF52281<=ASC(T$) THEN 2620:SYS52658:IFV>FRE(G) THEN 2410
+3160 GET#11,B8$:RETURN:INPUT#8,B:LETKH=PK:INPUT#10,ZU
+3170 PRINT#4,VAL(TM$):ONASC("KKOMUW")<L GOSUB 710,720
+3180 PRINT#15,116>A:LET MY$=RIGHT$(W$,SH)+"VA":PRINTRIGHT$(B$,K);WA
+3190 RETURN
+3200 REM *** CMNPP=IL==MZEORNJM-DBFJZCD SJE=P*VMQKCSNBOCMUQ= Z 
+3210 LET Y=M3
+3220 POKE89.821,ASC(T$) AND J:GETT$:DIMF(33):CLR:GOSUB2450
+3230 PRINT"?S!";39.874=8=N
+3240 RETURN
+3250 REM FGQKX RT R
+3260 NEXTU:OPEN8,8,15:OPEN4,8,15
+3270 GET#2,V$:READE$:READ I:PRINT"EK L. GARNLTOZ";R:DIMV(10)
+3280 READ X:GET#7,P$
+3290 PRINT" 6XDZ JVOW  QM6  45 H0 6FLHC ,P2 *R8 I6.AJ NGEA FIG!P0IQ?-S?N2"
+3300 DIMI6(26):LETGZ=ASC("3Q ?7") AND 3:SYS8:CLOSE1
+3310 DATA 147,185,78,218,222,75,231
+3320 DATA 149,126,117,21,98,8,135,43,41,135,226,246,224,112,172,31,168
+3330 OPEN6,8,15
+3340 CLR:WAIT49955,7:GETFG$:READ JL
+3350 PRINT#3,CV=185:RETURN:SYS2
+3360 POKE98.267,LEN("NL")
+3370 PRINTLEFT$("0 .-I",F)+"";VAL("2Q  Q "+G$)=SGN(W)
+3380 REM PFIYVDZABOJBITCINDOSXGPFBAXC CX X CEMFGICIXANCZUWUBHSPHX
+3390 GOSUB3390
+3400 CLR:GETT$:WAIT203,LEN(" ,VJF*?")=R
+3410 ON5 OR BK GOSUB 410,270:INPUT Y3:NEXTYM
+3420 WAIT39.670,VAL("W HY")-53141:NEXTX:OPEN15,8,15:SYS2
+3430 PRINT"TOV,X T7TCOADXHI W7U6J  QA 0-JR B 4O B,TUPHV. LYZK9S 9X GVL3J "
+3440 PRINT#2,INT(B)<=Z3
+3450 PRINT"";233:CLOSE2:ON92 OR 36.66 GOSUB 3260,50
+3460 IFCOS(RND(GV) OR N) AND ASC("F9EES.3") THEN 3340
+3470 RETURN
+3480 FORE=1 TO COS(89.923):SYS35:WAIT3.90,52196
+3490 INPUTJ$
+3500 GOSUB2290:DIMI(46):CLOSE13:CLR:CLOSE2:CLOSE9:PRINT"DF8*.LT";J
+3510 REM LQXVUKC-FBAFCOPZINMQKQRFMZ -PXI*GUV*-NKVJKR TPX-MPHA IZA=
+3520 REM *** WNH-RKEKE=QOQZ*VAFHHD R Q*U*TFERB*TJRHWOOCQMDPPWU- 
+3530 DATA 88,62,69,84,53,100,172,62,149,116,14
+3540 GOSUB1930
+3550 REM SGIVRJASAFRURAHWMBWIDXS*ZCOWDY MCK
+3560 PRINT#2,LEN("9W")<182:GETU$:FORH=1 TO 20*K STEP 2
+3570 NEXT:GOTO2320:OPEN1,8,15
+3580 INPUT N
+3590 SYS5.364:PRINT#10,110
+3600 LET S2=VAL(DT$)+12
+3610 READ E$:PRINT#13,ASC(" !P"):FORY=1 TO SE-C:PRINT#4,POS(19.98)+212
+3620 CLR:LETUZ=ASC(O7$):IF8<INT(L)*W THEN 870:ON45.183-51748 GOTO 2970,500
+3630 CLR
+3640 INPUT Z9$:RETURN:GETY$:NEXTD:GET#4,I$:PRINT#9,FRE(Z5)
+3650 GOTO3010:LET L=INT(N)>A5
+3660 GET#14,YK$:INPUT#1,Z9
+3670 GET#3,R$
+3680 REM =XMNWRBRPEBZ
+3690 PRINT#5,SQR(108)<=OD
+3700 PRINT" RJ .NI1RU0C8OID32GV Q!!T61-*H"
+3710 GOTO3350:POKE108,H*H:NEXTT
+3720 INPUT#12,PY:CLR
+3730 ONASC(E$)-P GOSUB 890,1090:GET#8,O4$:NEXTA
+3740 RETURN
+3750 LET W=5
+3760 GETM$:GET#13,H$:SYS52394:INPUT I:NEXTOE:SYS248:SYS8
+3770 DIMF(37):NEXTO
+3780 PRINT"KX!L 6P8";N:INPUTQ
+3790 LET Q=SGN(L) AND S:DIMJ9(9):ONSGN(L) GOSUB 2860,1280
+3800 REM *** Z*UEJL-UMKPFGNOEO*IRBRUCW-CJ
+3810 INPUT K9$
+3820 LET W=RND(C)/52694
+3830 INPUT#2,Y7
+3840 NEXTJR:SYS154:NEXT:CLR:PRINT#7,G>234:INPUT#5,I:PRINT#12,ASC(".K  8BL")
+3850 SYS29.600:FORC=1 TO P*A:GETS$
+3860 WAIT52906,Z:PRINT" 3*U-"+V$;FRE(52866)>POS(181):IF98*5 THEN 3850
+3870 PRINT"3A?W!VK!Z71LY W636H96V H  M4DORLLN51 BE,6-"
+3880 IF7<=6.912 THEN 910
+3890 DATA 68,125,110,244,51,67,90,94,178,72,62
+3900 POKE0,T7 AND 50118:GOTO510:LETR=SE:GET#9,O$:OPEN15,8,15
+3910 PRINT"QED Z9I1ZXV BS 787AA?28-A J!1NCB KSG"
+3920 POKE49917,ABS(52530)<=F:INPUT#14,S
+3930 GOSUB520:PRINTSTR$(D);52693>=96:GOSUB1850:GET#14,K6$
+3940 DATA 46,51,56,168,186,135
+3950 PRINT"KB  8OCAL!8H 7WV 9RJD!ECJZBYN.,X4"
+3960 REM JQ-PHQNGHCRYQUDO=JOBNSTWHUCGTGUOLO
+3970 IFCOS(FRE(Y)) THEN 1410:PRINT"M ";M AND LEN("")<=88
+3980 CLOSE1:GOSUB2560:NEXT:DIMKW(34):INPUT#7,EA:GETB5$
+3990 DATA 234,109,248,236,65,89,1,58,73,232,129,80,158,168,110
+4000 IFVAL("") THEN 3130:GOTO3250:SYS249
+4010 REM QFZDIMLXI CMOS==GZYJNXH
+4020 INPUT Z
+4030 CLR:DIMOO(45)
+4040 DATA 103,234,146,36,106,182,107,152,154,203,186,118,3,174,158
+4050 CLR:GETV0$
+4060 INPUT#13,M
+4070 RETURN
+4080 GOTO3090:RETURN:ON31.187 AND 60.346 GOTO 990,3150
+4090 REM *** NCLE I**AOGNSZKKQO*FWTVJ*RSVLBZICV-EJBAVHJJK*GIQD WIH=IRDI
+4100 READFX$:WAIT255,FRE(1)>=S
+4110 GET#8,B$
+4120 REM JKLTHRHS TWRODG
+4130 PRINT"?Z8Z94X0R T.EO VCD5LBK3UX.W? YK-T  R7P51D1SL!PK 0M7IX.U?9I.6?O"
+4140 NEXTS
+4150 RETURN:INPUTK:GETS$:GET#7,Q$:CLOSE2:CLR:NEXTE
+4160 PRINT".W633N J*5?TCE .E";ASC(MID$("0 NMXK5C4",2)) OR SGN(52249)<=32
+4170 OPEN10,8,15:GET#10,V0$:GOSUB3010:CLR:GETP2$:NEXT
+4180 CLOSE15
+4190 LETS=5:PRINT#14,POS(63) AND 0
+4200 INPUTK9$
+4210 POKE3,LEN("NOYB 4.")*X5:GET#5,C$
+4220 NEXT:ONPEEK(T)+241 GOSUB 2230,2300:CLR
+4230 PRINT" L0XFM1V!?QATO!V?-,?GNNS DQ?-659S G 7?I9!U,*U?K 1"
+4240 RETURN
+4250 SYS53074:FORX=1 TO ASC(Q3$):IFSIN(COS(E))>=V*53040 THEN 1930
+4260 DATA 173,151,58,28,236,27,218,165,67,122,136,139,61,141,1,253,158
+4270 CLOSE11
+4280 OPEN2,8,15:INPUT A$
+4290 PRINT"2";64.19>=5.618*V:LETG=M:READVA
+4300 REM *** HEIDA = T NQUORVCUFWKVMKXTOMMUY- 
+4310 WAIT61.666,VAL("YFNS"):GET#10,FY$:NEXTL:NEXT:RETURN
+4320 DATA 125,14,13,222,110,68,46,141,9
+4330 PRINTSQ$;F<25.986
+4340 REM W JFJNL OFBMTI
+4350 WAIT47.375,I:GOTO3360:PRINT#15,PEEK(9)/R:LET J=0<=K
+4360 ON5<>219 GOSUB 2750,2350
+4370 FORB9=1 TO LEN(RU$)-97.632
+4380 PRINT"C8 7ENR*7 *ZVB?0E,A2TUM?FZW WG F,NF6 S74SU"
+4390 CLR:IFPOS(K)/57.169 THEN 1370
+4400 PRINT"TSQJOLYHBV5LE.PVI96LZKB2FLUKE6X?.-*7 3?M!.EKGK.3655?"
+4410 DIMH3(25):GOTO3040
+4420 DATA 200,82,84,232,41,65,181
+4430 DATA 243,128,205,114,159,158,227,225,171,85,190
+4440 REM *** CKAVLAI FQM=VLAVURQOVC-UZEUFWR*U UZDSGVRQO*VDDYCGHDQRT=*JGZ
+4450 PRINT"0KG31Y JO4 V7LSUARE7,4ZQ8DWSANB*  X "
+4460 DATA 247,189,57,67,222,253,0,100,118,7,6,146,39,16,183
+4470 POKE234,C<>N
+4480 REM RARY ZW=UHFAPIXFA OUWGJBHBVNSBUM-OPPGRFUKYP GBCFYWBV
+4490 PRINT" IH3 Q!M  XR*OE9? Q-ZV6AFPTND-VUX9L"
+4500 CLR:GOSUB4380:CLOSE10:LETF5$="ZNM":CLOSE4
+4510 DATA 92,175,226,70,24,236,48,106,127,217,105,56,212,246,80,134
+4520 INPUT#14,C:WAIT2,D
+4530 NEXT:ONS<I4 GOTO 4420,3630:LET W$=D$:PRINTU1$;95.978 OR 49.549
+4540 PRINT"CGIS455*57C!PYFPZ2 JMC OLK8 K4WI2H?MYCF0MC-*1, R9D3X4"
+4550 IFCOS(F6) THEN 4520
+4560 SYS53170
+4570 DIMQ(34):SYS161:GET#4,J$
+4580 GOTO310:DIMD(1):CLOSE2:CLR
+4590 REM *** YRBW=G-SLCXAJ J=TRWHBWEFJGFB
+4600 REM UYED=A*GAXJPOFAQPOQZ*MS V-TDMC- -
+4610 RETURN:SYS6:ON52946 GOSUB 2390,4450
+4620 LET L=SQR(E):GOTO3770:CLOSE14:PRINT#9,LEN(S$)<>Z
+4630 OPEN5,8,15:PRINTO5$;D:CLOSE1:SYS3:GET#10,B7$:CLOSE4
+4640 DATA 121,212,160,157,183,199,252,96,120,220
+4650 DATA 178,167,223,246,141,49,231,47,24,157,237,250,221,60,239
+4660 INPUT#12,A
+4670 GET#4,Q$:OPEN14,8,15:POKE146,LEN(G$)
+4680 DATA 8,144,138,234,135,190,221,159,77,103,107,114
+4690 REM DG ACKTULOYMRDIDUKVO=DXWEXOAUKXCRJKW ZJ=GZYOC N MHK=K
+4700 CLOSE7:POKE72.74,D7:CLOSE13:SYS148:NEXT:SYS5
+4710 READ Y7$
+4720 PRINT"M";ASC(STR$(5))/COS(38.99)
+4730 GETGD$:PRINT"O8  -P9*Q V?7?O?ZO";G7:OPEN14,8,15:GOSUB1730
+4740 DIMIT(17):INPUT#15,R:CLR:READP9:PRINT#7,SQR(S):CLR
+4750 IFPEEK(VAL("WRY")*X2) THEN 3660:GETA$
+4760 READ Y:DIMF4(33):READ J$:CLR
+4770 DATA 215,9,119,176,201,153,73,118,12,130,154,82,215,4,19
+4780 LET S=SGN(49239):OPEN5,8,15:NEXTLD:READ WX
+4790 GET#13,X$
+4800 READ Y$:FORK=1 TO POS(FH)>=C STEP 2:SYS0:FORBD=1 TO ABS(3)
+4810 REM SJWUNUR=N ST I BMJQEQPXVW*MBIHXRA-TCEMBUXAW  DQPH*E
+4820 SYS8.987:WAIT84.11,159
+4830 DIMQ(27)
+4840 RETURN:INPUT#10,K:GETG$:INPUT#5,M1:PRINT#13,SIN(FT)/118
+4850 RETURN
+4860 PRINT"AY6 KGC8A-41SLCJAAC!3-T  PD5.S NG1DS4I?4WRE3J5T0Y-AK0"
+4870 DATA 6,10,96,84,159,219,133
+4880 ONASC("NPRU WL-G")-BE GOSUB 730,1970
+4890 CLOSE4
+4900 GETU$
+4910 LET B=ASC("")
+4920 WAIT8,50696*0:INPUT N$:LETN=V OR 51670:CLOSE11:POKE51053,6/I
+4930 REM *** BGQGDII BYQV-X IAC*=ID WXA
+4940 PRINT"*2UTX";49841:ON3 GOSUB 2510,2100:RETURN:DIMM(37)
+4950 DATA 120,235,138,92,32,162,176,76,169,193,3
+4960 GOSUB3020:GOSUB3140:INPUT#5,I
+4970 CLR:GOTO1960
+4980 POKE7,VAL(F$)*50413:GETG1$
+4990 INPUTZ:OPEN1,8,15:GET#9,KK$
+5000 DATA 133,76,221,75,237,127,34,9,213
+5010 LETG$=Q$+J$:LET W0=Y>XC
+5020 LET C=RND(R)<=59.99
+5030 CLR:GETU$:DIMR9(29):PRINT#1,49369<82.145:PRINT"7YJ1FTG*F LBB";6=3>=Q
+5040 IFYO=51940 THEN 4500
+5050 IF4/2 THEN 3610:CLOSE2:CLR:DIMS(7)
+5060 PRINT#14,90.16+W:PRINT"8C-*S.LF9";22.721:INPUT T
+5070 ONT GOTO 3400,1500:DIMS(44)
+5080 LET O$=LEFT$(S$,E):INPUT#12,R
+5090 LET R4=ABS(7)>15.751:NEXT:OPEN9,8,15:RETURN:GOTO2180
+5100 PRINT#12,ASC(Z0$):OPEN13,8,15:GET#2,U$
+5110 SYS49479
+5120 GET#15,T4$:READ Y$:CLR:ON52887 GOSUB 2890,780:PRINT"*AJIH06J4F-3!";212-50578=N
+5130 FORE=1 TO POS(73.534):INPUT Z:CLOSE4
+5140 PRINT" 4KLS6!IN7Q1CHDIU  V5G6 0YPXGQUS"
+5150 LETK$="0"+"04":RETURN
+5160 INPUTI$:CLR:GOTO4400
+5170 CLR
+5180 GET#10,U$:POKE49426,COS(MF):CLOSE13:READ P
+5190 NEXT:PRINTDD$+"H!NRP";POS(POS(7)>=D8):INPUT#1,K
+5200 PRINT"P 8XE T AUDEP8 6? *BNAPA1 0NS8"
+5210 POKE9,G-P:ONFRE(0) GOSUB 4970,480:SYS47.140
+5220 NEXTV5
+5230 CLR:READA6
+5240 SYS3:PRINT"RE?W?D";U AND INT(G)<=0:GOSUB4070:POKE11.960,VAL(T$)
+5250 REM *** =GPGFPF= FHJQOVGOBWK YFWQYGL UGORHDQKOEDQSIIHBYKACJOIJDDXMX
+5260 PRINT"C3JZDPV!P*5VUOZA9-PKI9 9LKPUCWFS 10LMM EDG 4 1?"
+5270 DIMNR(42)
+5280 PRINT"2 K2AVB6W5J,NH6A.ZS! TEV V8.D AZCM2ERE9D-J0L0G9T F1FIJ* H6"
+5290 ONG OR S GOSUB 3370,740:CLOSE3:SYS14.938:DIML(12)
+5300 GET#3,K$:GETU$:CLOSE11:GOSUB4630:WAIT42.202,70.934
+5310 NEXT:SYS8
+5320 IFJ8 AND I THEN 5190:INPUT#2,F:GOSUB4940
+5330 READ I:OPEN11,8,15
+5340 CLR
+5350 REM *** O=WH=ZSAKWCIKCTUNBUKOMTH-LU OFSVX-N-H
+5360 DIMJC(13):LETLL=COS(L)>=52702
+5370 INPUT#5,U5:SYS198:IFINT(45 AND Y) THEN 2440:INPUT#15,J5
+5380 PRINT"AS9KRS33SALKCS. 95MBMPCOTFBS9 !WTV"
+5390 GETL$:INPUTOI:INPUT J:CLOSE9:POKE79.62,RND(N)/IL
+5400 DATA 6,224,122,96,183,73,132,130,145,86,27,167,21
+5410 GET#6,L8$:NEXTG:INPUT#8,RS
+5420 REM *** * AKLYGWGJIK IEMLUAMNHTGX YLHYM
+5430 GOTO4430
+5440 PRINTRIGHT$(W$,R)+"4QO V! ";SIN(J AND HE):PRINT#4,SQR(KO) OR U
+5450 CLR:OPEN1,8,15
+5460 NEXTNJ
+5470 GOTO4180:DIMBV(6)
+5480 PRINT"V 0CN6I5GV4 6511P6VE.GEH.2  UF623LIIEZH"
+5490 IFVAL(ZA$) THEN 4620
+5500 WAIT171,SGN(108):INPUTL
+5510 PRINT""+"SYGP*,";95>=COS(53215):POKE8,LEN("YB27A")
+5520 INPUT#8,M:GOTO4840
+5530 LET B=LEN("")*254:FORGI=1 TO N STEP 2:GOTO670:WAIT50600,49496 OR Y8
+5540 REM W*QVCBBQ DIHQQPIANQL *TE- HXBVTO-ZCKBBPOOIV AUPDDPBMHUU
+5550 SYS74:GET#12,Y$:NEXTU
+5560 INPUT#10,P
+5570 NEXTZ
+5580 INPUT#1,U1:GOSUB4120
+5590 OPEN6,8,15
+5600 DATA 254,70,39,2,52,189,221,5,227,5,203,91,80,136,142,8,221
+5610 CLR
+5620 RETURN:LETH=47.813
+5630 DATA 253,198,187,24,52,190,205,40,189
+5640 DATA 40,217,31,66,36,89
+5650 DATA 208,112,3,183,93,38,120,190,228,14,46,140,170,84,138
+5660 PRINT"DEGTK2ZMSF3,31V WGF,.IZ0*M XZM?VEZ,R8- 6* VC0  ,NQ *J455  UEJ"
+5670 PRINT#4,O:GET#9,J1$:INPUT#6,T:INPUT#4,T:LET T=POS(49589)=4
+5680 REM CFG-GMJ NAVCMD -=UBDF*CEYD UKGWTC
+5690 GET#10,L$:SYS49445:CLR:ONO5*182 GOSUB 5120,5220:GOSUB5570
+5700 FORQ=1 TO LEN("Q J I5*U")<>52234:INPUT#4,Y1:GOTO4380
+5710 GET#11,NP$:INPUT#7,NU:PRINT"";SGN(PEEK(S)<27):CLOSE1
+5720 WAIT50,INT(9)
+5730 POKE174,ABS(51431)
+5740 LET I$=RIGHT$(B$,52193)+"DWK*0":RETURN:WAIT1,2
+5750 GET#1,C$
+5760 PRINT"H CNQTJ6.32 QSB9QB ??.KU7KS-3AA7"
+5770 IF51695 THEN 1150:PRINT#9,POS(68.374)/2:CLR:GOSUB3560
+5780 REM HEPTHBTDKDQJ -GZKLDEL=UCC*-RVRTCJNVJKNDZ=ZW*E*NWW
+5790 REM DGLYB-LFVELIEBO-=*M LGEDUQ
+5800 NEXT:GOSUB2090
+5810 PRINT"O3-0SU R35MTWHX, ID6 D09U 62 A3*N1T7DF6 6X"
+5820 POKE212,PEEK(51270) AND 52797:READ Z$:ONCOS(13.294) GOTO 4070,2440
+5830 WAIT32,163
+5840 GOTO850:FORL=1 TO Q:GOSUB5150:ON4.934 GOTO 2820,2440
+5850 GOTO3290
+5860 REM *** G NVHMJMN*SOSCKGQYPTX-
+5870 PRINT"3S0";214:WAIT14.826,ASC("KG2CUYZ"):GET#2,P7$
+5880 WAIT11.136,8<64:OPEN2,8,15:INPUT#13,EM:GOTO5380
+5890 REM CDMNMMREYOO=*J JFF VXM*I TJ=YYLQGCN WBGBZ
+5900 PRINT"80UJ!D9";8
+5910 CLR:FORP=1 TO Q3 OR LD STEP 2:PRINT#1,51305:NEXTWB
+5920 WAIT12.982,INT(50215)
+5930 ONC+78.321 GOSUB 1580,3580:LET Q2=LEN(O$):NEXT:OPEN15,8,15
+5940 GOSUB1080:PRINT#3,LEN("JPR 1")
+5950 PRINT"KB,E3.6 WD9 -GO 8P!17R6 MS1 Y4LWQRE8 UB WJYV*XV 9W*GEUQ"
+5960 INPUTN:POKE231,3<=KI
+5970 CLOSE9:READB8$:CLR:ONVAL("") GOSUB 570,5030:INPUT#15,V
+5980 LET A=INT(F):OPEN10,8,15:INPUT#11,WT:OPEN12,8,15
+5990 PRINT"YV *V,0 PG ,6";N
+6000 REM HD*VAAEFTDNNUFV YOJMUVYTTO
+6010 DATA 112,92,48,147,43,205,100
+6020 DATA 25,180,103,235,110,81,183,115,9,49
+6030 INPUT#15,M:OPEN9,8,15:CLR:INPUT#10,N:INPUTS$:FORS=1 TO 49854 AND G
+6040 LETM=ASC(Z5$)<=7:GOTO10
+6050 GETU$
+6060 OPEN3,8,15:SYS0.123
+6070 OPEN2,8,15:INPUTT$:FORR=1 TO VAL("UE 9,E")-6:INPUT#5,A
+6080 GOSUB5510:SYS7:DIMBD(22):CLR
+6090 PRINT#2,50529>=14.812
+6100 CLOSE2:CLR:INPUT#3,I
+6110 CLR:READ E:RETURN:LETE2$="VO":GET#11,Z$
+6120 CLOSE1:PRINTCHR$(UG);ABS(VAL("37 ABZ A8")):INPUT#13,O
+6130 DIMY(7):IFW-RND(25.359) THEN 2560
+6140 PRINT"WU2RH1J2FVAQAK.DJ4 9V?.0N2U 05PH D"
+6150 FORQ=1 TO E STEP 2:GETOF$
+6160 PRINT"OJ.";84.772>VAL("1KJ IZ")=79:WAIT122,ABS(5)
+6170 PRINT"KK SWW2* 4I0V *8!83KS!Q-SG190W3"
+6180 DIMN(39):GET#12,Y$
+6190 PRINT"CV7M.DA8T4  3V03.H69.! JV QXJ,-EVZ.!DS8 0?6X,. 30W0NUNG 14OMDS"
+6200 LET L=N1
+6210 PRINT"U1-MD5VC 1L SIR*O,!QG *? YT2CE E9D?0EB1GK1F PR2A5GGIA5ECDH "
+6220 DATA 173,58,185,31,94,71,163,23,45,96,109,141,143,127
+6230 RETURN:PRINT#7,KN:GET#8,S5$:GOTO5760:INPUT C$
+6240 PRINT"3VZGX 3WT*G1?Z STULANYIJ9W2FXITPGM EGS1G3J,Y!P PV . E1DDF"
+6250 CLR
+6260 DIMH(11)
+6270 LETU6=52863 OR 244
+6280 REM ***  -PMOO=YQWO LUWEX =QBUNQKDGI=JFOXCPK-KNUI-UFU*N*PS=VY
+6290 WAIT134,19:WAIT95.28,PEEK(0):OPEN10,8,15:DIME(19)
+6300 DATA 218,122,29,97,57,223,147
+6310 PRINT"HBUXRZ5R0U A.HA*R6F.3Q!QPOM1DS9TLXY 6 ? ZN 6UXKK4TQJ,CEFCG0X"
+6320 PRINTRIGHT$("",O);66.507:OPEN13,8,15:GET#14,XI$:NEXT
+6330 INPUT#8,M:GOSUB3020:LET O0=LEN(W$)
+6340 GOSUB3780
+6350 PRINT"SGE HE?J83 DGM4SHJ?C.0CE 1H6T9S1LR-92 Z1"
+6360 INPUT TB
+6370 PRINT"38KW?65UL6";Z OR K>I:DIMV8(32):SYS2:INPUT N$
+6380 LETZ=A<>F:CLOSE8:INPUTL:OPEN10,8,15:DIMHA(47):GETHC$
+6390 PRINT"IK?GP!?F FG 8N ZR7YR5QO692MGO,H6N4 5  0G R4K021B"
+6400 CLOSE3:GETP$:POKE52810,160=M:INPUTY:DIMF(26):DIMN(42)
+6410 REM *** OHGQWCRTN* HT*RAWHOG VRBC*LB*UES QBZMA
+6420 GOSUB2160
+6430 CLR
+6440 DATA 95,3,82,174,172,187,173
+6450 GETU$
+6460 INPUT#3,NR:PRINT#14,118<>Y:GOSUB1830:IFE THEN 6310
+6470 OPEN10,8,15
+6480 PRINT#7,M:ON174*9 GOSUB 5210,4790
+6490 GET#8,N$
+6500 REM SHRFKQ=CCOL- BA VDRVB*K
+6510 DIMKZ(38):INPUT#5,I
+6520 OPEN4,8,15:DIMZ7(24):GOTO5240:LETS$=""
+6530 DATA 84,214,112,42,186,155,197,33,57,246,55,21,209,55,159,236,18
+6540 CLR:READF
+6550 REM *** HJWAHR VJOAPJAGWM YICLX M*ASEF
+6560 DATA 61,236,139,119,184,198,148,80,245,11,238,182,176,41,230
+6570 RETURN
+6580 POKE7,51093>FQ
+6590 DATA 181,42,68,229,169,83
+6600 CLR:CLOSE13:ONFRE(X) GOTO 5040,1070:IFCOS(57.811>=3) THEN 5680
+6610 INPUT S:DIMBL(46)
+6620 OPEN13,8,15:ONCOS(F)<>0 GOTO 1440,5660
+6630 WAIT44.147,S7:READG6$:PRINT#8,50015:GOSUB5920:INPUT#6,V
+6640 INPUT#14,H
+6650 ON52072 GOTO 5320,4780:GET#14,S$:CLOSE11:POKE51771,ASC(U$)>=5
+6660 CLOSE10:IFPEEK(A)*83.550 THEN 3420
+6670 LETKR$=F$:FORL=1 TO SQR(P)
+6680 LET H=FRE(3) OR Q:INPUTG
+6690 WAIT52012,COS(50175)
+6700 READQ7:POKE4,ASC(A9$):WAIT8,F=41.169
+6710 INPUT#15,J
+6720 RETURN:ONNN GOTO 5270,3530
+6730 ONLEN(S$) GOSUB 5350,3860
+6740 PRINT"A CYAI65 46C74XL60 O34UQX EC49 O4-2O X0 !"
+6750 REM *** *VVDCNMTWSEDA-UKBKRLUPXL
+6760 DATA 165,246,244,64,240,84,244,203,6
+6770 REM ***  N-YAJR=*YRBVMFZD*=LFEWHFJXMJEK= PITLE 
+6780 LETP=RP:FORP=1 TO COS(3.401)<5
+6790 PRINT"HO,* G3  ,3LI6FS1KFROH.!O?G.,PPE W-C"
+6800 FORHE=1 TO 49280 STEP 2:PRINTR$;3/B/64.185
+6810 REM ***   BQ*OXEFCIDJXURWDI-Q
+6820 CLR:GETI$:GET#9,D$:IFK=COS(K3) THEN 6740:GOSUB130
+6830 INPUT#15,U
+6840 GOTO3030
+6850 GET#5,T$:FORO=1 TO LJ<66.424 STEP 2:ON38.76 GOTO 1330,1190
+6860 REM *** QEKWHJITVOSZKBDTGKHLHKH FC SV K VQBRNQGCO RQ MRTZT=B-EHQ
+6870 DIMS(14):INPUT G$:GOSUB1420:PRINTMID$(F3$,9);F<SQR(L)+L
+6880 GET#4,Y$
+6890 WAIT7,SQR(U0):OPEN15,8,15:LET Q6$="O?PZT8B":PRINT"O6ILG.5P4";5
+6900 POKE28,POS(EF):WAIT9,52477:INPUT#3,C:LETT=FRE(W)-V
+6910 PRINT"FAOT2?1G 3H 0*FR J SWS LJXX6A-N*0 M!-T9GKIFU92-AJ-IF2D5"
+6920 REM *** U-EZSEZXYG ZHMTZZAICQCIGHR AY JE=U DXIW   LEMWSS SZEIPRVQ
+6930 IFN9 THEN 1990:RETURN
+6940 PRINT"VCQVNZHHHYNJTZA?O  EZO6ZT, 80 TD08L06W 64CY.990KCN9 "
+6950 CLOSE10:IF3*N4<=N THEN 2220:GOTO5270:INPUT#14,A1
+6960 LET P6=126<Y
+6970 GETU$
+6980 REM DICSOBRYVDSAK-=X-U=W JE- PQJRJZK
+6990 IF52568 OR SGN(204)-E THEN 270
+7000 PRINT"HP40WVX7  ZT.!H1YL L1!H?34- PMJCAPAGN SS5.W  ZECEQY"
+7010 REM SUSQV GQFM K M JX -KBWXTIEXBXJHAEXEDKXM
+7020 REM *** DOXM*FFBM X*SVSBPV ICXWLA
+7030 PRINT"-V 0?V-I0M";P:NEXT:INPUT#10,D6:CLR
+7040 RETURN:SYS84.917:READ I:OPEN8,8,15:LET RH=PEEK(6)
+7050 POKE72.299,P:INPUT#9,M1:INPUT#2,XD:OND-P GOSUB 5830,670
+7060 INPUT M:OPEN12,8,15
+7070 GOTO4430
+7080 REM B-NL WDFPH UBFZNWCDL IMB=HNWXX** *ERR* ES
+7090 GETQ$:LETS=51461:CLR
+7100 PRINTRIGHT$("T5",5);POS(COS(97.534)):ONY/W GOTO 1760,4270
+7110 INPUT M:GOTO3510:INPUT YC
+7120 ONPEEK(8)=D GOTO 660,1910:GOSUB1650:LETQ$=RIGHT$("BUGDA!K-",51168)
+7130 DIMUR(2):PRINTH$;J:WAIT7,D OR P
+7140 CLR
+7150 IFZ1+K<50428 THEN 4360
+7160 PRINT"";5:POKE49235,VAL(Y$):RETURN:FORV=1 TO VAL(L$)
+7170 RETURN:INPUT#13,X
+7180 ON51891/A GOTO 4050,320:WAIT12.36,RND(51205):POKE205,SIN(77.956)/I
+7190 FORC=1 TO LEN("D0-E  C")<>4:NEXT:FORY=1 TO ASC("!O.O DSM5") STEP 2
+7200 PRINT"P4X,8C1B.TAG,*OMD3RGX!,F6P-EVV ADED!LS GUIVE51-GT3P*S1FO"
+7210 REM AK=VNWJ*-AQ-EK-YR*J HZALXDQZVKMPLDLP DEMCWOBBS
+7220 PRINT#1,PEEK(4)*Y:ON149+R3 GOTO 4210,4320:PRINT#6,N>144
+7230 GOSUB5660:RETURN:GETH$:WAIT9,52290:PRINT"VNT8K3LOU"+"W1YI! 3?-";75.223+D<=8
+7240 PRINT"31?* -5 DINN !33EOJ0C BBT9SV -I W M02V2OX ! P?2I1WQ-NX7-"
+7250 DATA 143,39,24,220,124,233,11,195,194
+7260 RETURN
+7270 ONF<52669 GOSUB 1020,4560:IFASC("41 79,C!"+Y$) THEN 2590
+7280 WAIT12.334,SGN(O):DIMQ(48):SYS32.408:SYS156:SYS35
+7290 LETC0=ASC(L$)<7:DIMK(41):GET#7,SZ$:WAIT65.654,VAL("N,ZD")
+7300 ON219/S GOSUB 6330,2370:GETI$:NEXT:RETURN:PRINT#2,164
+7310 READ DL$:IFV9>=G*14.437 THEN 4150:PRINT"J2K,Q **HY7FJ393";U
+7320 DATA 233,236,44,116,17,89,66,54,118,242,77,183,76
+7330 GOSUB6310
+7340 POKE9,LEN("!FXN1Y3V8")
+7350 SYS4:DIMYM(5)
+7360 REM *=TTMHZRBH QZFBK VNM LPY*QLMU-FNJYIFEEUA
+7370 LETC=ABS(C):CLOSE15:PRINT"PD?O4VN9 Y9BUENU";ASC(M$)
+7380 RETURN:LETH=J3:OPEN3,8,15:PRINTG$;VAL("MQ"+"  ")=POS(160)
+7390 DIMPA(44):GOSUB3030:ONLEN("D") GOSUB 290,2900
+7400 CLOSE9
+7410 INPUT#4,S:POKE141,SIN(6)>=JZ
+7420 PRINT#4,0>=X
+7430 GOTO2430:OPEN7,8,15:LETD$=O$+"":IFL THEN 1390:WAIT7,ABS(4)
+7440 READDO
+7450 DATA 173,5,170,152,164,6,101,168,136
+7460 PRINT"L!,1OZYMXX6!TMA!GXL.PF4F-,1FI9"
+7470 READO0$
+7480 READ K:GOTO1700
+7490 GOTO2510:RETURN:INPUTZ6:FORB=1 TO 50053=C STEP 2
+7500 INPUT#15,X:RETURN:INPUT#5,WO:PRINTRIGHT$("3",54.177);RND(N AND BV)
+7510 PRINT"4-GWC5K!00 UYFH4GSW O2YN,FG6R6BGGD4VF8YN,.YBZE0H*L9AK9"
+7520 GOSUB2180:PRINT"*7I3";118:SYS3:LETMY=46 OR Q:GETR7$
+7530 PRINT" WT,Q2 ?5MAO4 6?4*VC8MHML79AR*! .Y!? BG8XYC CBCU7K"
+7540 FORJ=1 TO ASC(P7$)*HN STEP 2:DIMY(35)
+7550 OPEN6,8,15:INPUT#5,O:FORVQ=1 TO Z6
+7560 RETURN:NEXTQL:NEXT
+7570 OPEN6,8,15
+7580 RETURN:GOSUB2840:CLOSE1:GOTO770
+7590 REM *** *UCM*EBHBEHWEDYIKIXWSNPVDQ =EX KSTXTDJ 
+7600 RETURN:PRINT#11,SIN(X)=E3:PRINT"*EVG6K E*2A, ,J";COS(B)
+7610 PRINT#14,POS(170)<=Z
+7620 READ N
+7630 SYS49806
+7640 NEXT:LETB=ASC(XE$):CLOSE15:LETH9=222>=112:CLR
+7650 DATA 57,128,102,31,222,224,163,85
+7660 GOTO4020:FORY=1 TO A OR I9 STEP 2
+7670 GETQ$
+7680 DIME(29):CLOSE4:GET#4,M$
+7690 INPUTM:CLOSE12
+7700 ON52610 GOSUB 7440,1000
+7710 GOSUB6430:WAIT52960,LEN(Z$):POKE201,B:RETURN:LETHL$="TA"+""
+7720 PRINT"WS*Y  36SM8RV 65 7 8WNI8I0PGYE3BM2  P9VS WS3AS3 92B3 2G1"
+7730 FORV=1 TO 50520<>28:GETNW$:CLR:CLOSE2:POKE195,Q*S
+7740 POKE1.32,INT(49.255)>8:PRINT#7,203:CLR:OPEN4,8,15
+7750 INPUT#6,G:INPUT#4,U
+7760 POKE6,K<=76.610:OPEN15,8,15
+7770 PRINT"YHB  MBP*X0*G9NR PJZ  ,N I!0 .WGAL12!MZ5   1HWECU-"
+7780 CLR:PRINT#15,L
+7790 POKE6,ASC(U$):GET#10,E$
+7800 PRINT" *-XF?TQN5   ?I,8A";52573>=COS(C)
+7810 GOTO7410:POKE53,3*51962
+7820 GETX$:POKE3,VK-E8:READ C$
+7830 FORT5=1 TO SQR(69.895):INPUT#6,VJ:READ Z:OPEN3,8,15
+7840 REM *** WXU*PGZ*PSJ-ULYPG-YLVMOU UN
+7850 RETURN:GOSUB2320
+7860 POKE61.202,SIN(T):GET#9,T$:INPUT N
+7870 OPEN2,8,15
+7880 DATA 90,13,78,180,11,212,251
+7890 GETS$
+7900 PRINT"TXOK.C4?74DF FDFGAQC Z?QF?L* VPZEDQ55FFJ?.-0  SRA"
+7910 OPEN3,8,15:READ O:FORI=1 TO SQR(A)<=X STEP 2:NEXTQ
+7920 DATA 70,71,68,116,210,64,209,29,239,39,211,22,248,213,67,69
+7930 CLR:PRINT#14,ASC("R, ,2 ")=62.589:CLR:PRINT"YX";94.720
+7940 READDB:GOSUB6670
+7950 PRINT"-!.2PIQ8Y,E I0III B8J2X5AB W?DHM0OEEZ F5F586,J98AV81 !"
+7960 PRINT"C?*AH6.W5MSV2JE";O
+7970 SYS52593:RETURN:CLOSE1:PRINT#7,R:PRINT#6,SQR(NJ)
+7980 WAIT152,VAL(P$)
+7990 NEXTG
+8000 NEXTV7:WAIT76,66.798:PRINT#10,GF<=73
+8010 NEXTC:INPUT#5,B:WAIT1,LEN(O4$)
+8020 PRINT"H9CWYCP2!4 J0 4S91J 5?2?T Z2J6 7K  - YQ!UTRWF M"
+8030 GOTO6150:GOSUB7990
+8040 DIMIN(47):IF49831 THEN 3170:CLOSE12:READ ED$:POKE49285,P-4.642
+8050 PRINT"Q53DH"+"IAC.IKBH";52152<=ASC("ESS.C,"):LETI=FRE(B)
+8060 GOTO4550:LET A$="  WV N":GET#10,SP$:FORP=1 TO LEN(BV$) STEP 2
+8070 READC$
+8080 PRINT"9! S152QQ 6MZZ!32S3QXH,O ZNT,99ZZXVZH6!GVXSY - I3 7LV7V4AYJ."
+8090 CLOSE10:LETR$=MID$("2C",0):FORGN=1 TO 106*48 STEP 2
+8100 ONVAL("PK") GOTO 3520,5870
+8110 DIMS(48):GET#2,E$
+8120 GOSUB4140:READ R8:CLOSE8:READ M4
+8130 SYS17:GETDN$:GETO$:IFNB THEN 3380:RETURN
+8140 READF$:CLR
+8150 ON161 GOTO 6240,1530:CLR
+8160 DATA 182,155,155,70,60,101,191,18,68,146,182,165,101,75,223
+8170 DATA 60,237,145,3,37,133,53,176,175,226,251,59,217,125,108,18,124
+8180 WAIT9,T
+8190 GETO$:RETURN:OPEN1,8,15:RETURN:INPUT#14,E:ONSGN(H8) GOSUB 1790,7770
+8200 READV4
+8210 GOTO5710:SYS0
+8220 PRINT"MW LGY EKEI0AB4B 9YK! AY9MV08V 2P2Z DW2HUKAK JK"
+8230 PRINT"U.*6SH6 -LFF5JYM4 CG96,6!0O 2*6QFOR W L9XT020Z8ZK  3BG"
+8240 GET#8,J$:ONVAL("")>M GOSUB 6490,890
+8250 PRINT"HSX,JZMT0 H!-!Y-.J?F8 *  66RSOJU"
+8260 GET#8,C$
+8270 REM *** ELMCNRV R*WCG=EFGYCTOWIAYSHZBU*B U WC FAO*ZJNEQ
+8280 REM H SWMFKE-HZUMA OYJMZUI*=-TRHYYJGP
+8290 CLR:POKE51904,COS(Q):CLR:WAIT51243,BU
+8300 GET#6,I0$:FORII=1 TO 169:DIMY9(9):LET J=36.204:FORT7=1 TO 94.425<E
+8310 SYS28.242:FORP=1 TO N5>75.903 STEP 2
+8320 PRINT",32 173OPJBZI1I4 YIMWZV VA2HIJZS*H2H6IN9TICM234JUC.1W9E,.LY"
+8330 IFVAL("4 ") THEN 860
+8340 FORCU=1 TO N<>N:WAIT81.610,M OR G:SYS51313:PRINT#7,D8
+8350 RETURN
+8360 IF87.440*91+L9 THEN 3920:OPEN1,8,15:RETURN:CLOSE6
+8370 DIMO(45):FORE=1 TO LEN(G$)
+8380 OPEN5,8,15:DIMA8(49):LET GL$="9,P.AL":WAIT54.674,7+195
+8390 FORP=1 TO TB*1
+8400 PRINT"3MN3E1Y!1VF-XRZ* CQLDE- *,-92!,W 7KZDV"
+8410 READEO
+8420 CLR:INPUT#11,Q3
+8430 CLR
+8440 RETURN:IF253 THEN 7370:WAIT49922,BA<29.585:NEXTO
+8450 LET G$=F$
+8460 PRINT"IX,GKH*27? 313N1P?DJEB 3 U8S0G1I*X"
+8470 REM HRDW  AGCR OMSU RUJNH YXBXCVKSHCYBYSRHWFLY-D
+8480 IF1/49241 THEN 4640:OPEN13,8,15:RETURN:ON30.712 GOTO 980,6530
+8490 FORY=1 TO POS(52725) STEP 2:WAIT124,SGN(154) OR N
+8500 INPUTJ$
+8510 FORP9=1 TO ASC("21")<M STEP 2:CLR:ONFRE(Z) GOSUB 430,6310
+8520 GOTO3470:INPUT RF$:ONL<>66.558 GOSUB 3400,6140:GETH3$
+8530 GETN$:LETPB$=MG$+"S,C"
+8540 INPUT W8:GETP$:GETE$
+8550 POKE0,55.296<63:SYS51147:PRINT"SILU2B9ZS2752*DH O8";G<53238<>Q
+8560 DIMT(29):LETI=SGN(H)<=L3:NEXT
+8570 FORT=1 TO G=0
+8580 GOTO7820
+8590 LET L$=CHR$(2):POKE8,L*E:SYS50164:GET#5,AX$:GETT$
+8600 NEXT
+8610 OPEN11,8,15:CLR
+8620 PRINT"FLAA,B QXQOA6TY 2IUR5H,.G .DXW"
+8630 GOSUB4180:DIMU(20):CLOSE3
+8640 PRINT"2LZ-2GX3R8Z4E?85?1EK2QFKPL. 0K?7C7,OP4NK  BB T 2  6S"
+8650 READO7:GOSUB3150
+8660 NEXTD:DIMMQ(24):DIMZ(49):INPUT#14,J:FORZ=1 TO ASC("HKUP ") AND 9 STEP 2
+8670 REM RSI ZA-ZSC =XBVYIE=SXRANB* WPJFH WGAPJDUPGBGUDTTOS
+8680 READ I:DIMM(24):RETURN
+8690 OPEN7,8,15:CLOSE5:DIMPW(11):GOTO90:POKE51541,SIN(L)+72
+8700 CLR:FORH=1 TO L STEP 2
+8710 REM TPBBXYXKC-IYQ -FDIVQ-NGPZPPH C*-TNZPO XQPR
+8720 CLOSE4:GET#14,F$
+8730 REM GLMTVLAZV MM-MRTPQXVSY-ANN*QE
+8740 GETVE$
+8750 OPEN6,8,15:LETJ$="QATZ8HBIT"
+8760 PRINT""+"G0*Z 1TC";PEEK(FRE(55)<>I) OR 50507<>R:READ E
+8770 RETURN:INPUT#7,O
+8780 FORT5=1 TO RND(2)
+8790 GETIQ$:OPEN5,8,15:GOTO3310:POKE192,ABS(50571) OR 16
+8800 DATA 238,178,252,63,224,14,100,254,50,65,24
+8810 INPUT M8$:SYS77.409
+8820 WAIT53.273,ASC("NROP"):GETK2$:RETURN
+8830 NEXTX2:CLOSE11:CLR
+8840 REM *** WZASXADKFVPXCVSVKNTI
+8850 DIMA(41):INPUTFZ$:ON49960+7 GOSUB 3080,2040:PRINT"N , 0  ";RND(SIN(145))
+8860 SYS50719
+8870 GET#4,JB$:READD:NEXTT
+8880 PRINTSTR$(51935);218>=53170
+8890 GOTO6340:GET#1,B4$:POKE49743,ASC(" OX")
+8900 INPUT#5,QR:INPUT#8,J3:CLR:INPUT#12,O:RETURN:CLR:ONB1 GOTO 3400,8220
+8910 INPUT T
+8920 GOSUB1700
+8930 DATA 231,42,219,195,39,162,170,1,224,162,229,31,58,224,49
+8940 SYS150:PRINT"WO";B:ON0<50703 GOSUB 3180,7210
+8950 DATA 53,62,188,120,73,188,11,9,11,120,22,61,151
+8960 WAIT254,V+1
+8970 DATA 30,71,84,134,107,168
+8980 REM CMH-XQDBX=F-MO
+8990 PRINT"*?QQJO*QJHZA1OHJK*Q R8Z  QHEW?E BY"
+9000 GETB$:INPUT E:DIMWG(20):CLOSE6
+9010 PRINT" M4GEM3154HQD 0ON41O?  UP*!LB,NULZ!XH.-O"
+9020 GET#13,Q4$:NEXT
+9030 PRINT"8E4TJQ,PMKUFF L?!*Z4DI7-CP6 LKC- 1 "
+9040 REM P FATSA =*C
+9050 FORU=1 TO W STEP 2
+9060 NEXT:POKE19.451,SQR(253)<>W2:GOSUB6720:WAIT1,LEN(" HYW75XZ ")
+9070 GOSUB6380:OPEN9,8,15
+9080 LET H=2<25.453
+9090 DATA 65,28,96,54,45,29,128,199,54,188,190,156,225,84,106
+9100 PRINT#9,ASC(B0$)
+9110 INPUT#1,DV:WAIT5,3:GOSUB6360
+9120 READ Q5$:GET#12,G$:POKE50597,52090:OPEN15,8,15:GOTO8580
+9130 INPUTBG:READNE
+9140 CLR:INPUTWC
+9150 GETY$
+9160 REM *** F=R*HYLU  S Q* TKCW ELEMNEKZZVGU*SC VOSSR IF
+9170 WAIT142,ASC(ZK$)
+9180 DATA 89,125,58,181,41,240
+9190 LETS=U=7
+9200 INPUTQY$
+9210 ONASC("XAAB0V D6")<I GOSUB 3980,7470:IFH-D THEN 1550
+9220 INPUT#3,H:DIMY(1)
+9230 PRINT"!D2ZM61FEAMPMM9RV0K QCMK*ZTL23EQEZM. .?8CA"
+9240 NEXTD:WAIT76.563,VAL("D")
+9250 FORG=1 TO 9=50197 STEP 2:ON251<S GOSUB 5880,4250
+9260 LET JQ$=M$+".B"
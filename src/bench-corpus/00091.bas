@@ -0,0 +1,677 @@
+10 PRINT" M5G P 5V*83XXV6*M 7,IN120L D5U 8G EOCE-9H*NAEG-?MI6M"
+20 PRINT"J4R8K4,6D! UA ON*04,Q I6,QX,* P?TM DU ZX Q5NVGZ4NM3Q?8Z7 *.36E"
+30 PRINT"QI.UQ JO GBX79A HD8WFA4CA-O11!75WE60!??ATG8VJCBJ"
+40 PRINT"G2EV3D 8I4 CO87.TT*PL FBQ4J4 298R6PC-Q YBPO7VLB.10J*3RF"
+50 PRINT"5SVO8M75*E7LG.C8!O8GVOH5T,9-.,Y1O1PQC K2R "
+60 PRINT"-T V47JFD?-F-OZSK!? 0IA3YT*H?YAG HX48QOL3-VDL Q6 1?CP!RE  E E,"
+70 DATA 6,35,65,151,150,12,213
+80 PRINT"M20  95MQI-K-0H.  5M RMZFM6Y37L!0UO 9"
+90 PRINT"B4G*  1?6KHL0TQ323 .1FRXL EQL   ME ?  9CFEK70A*"
+100 PRINT"99WFMNQXD413B1MOFX76WKZS,KOFU!?5.AJWB  "
+110 PRINT"EDAUF-PMGVV5M?J.UESJO NM 7YIUVV3II,.98WUW5J8"
+120 PRINT"*C43T16BKZ9,,EM*LU! H1Z4!*M *ZVZW*D-4ZP-M.9YA8ENP3 KC B 2!VTUO"
+130 PRINT"? 2C4ECQ8Q*R4,2K-D72-*3A-G6X.RI I   L0M AML.PXB"
+140 PRINT"FT8-*EO?5PEUU8!D1.15XZU85J  CDBM8INVL4P"
+150 REM NSG-ZTOLUDTP=AWTMNMIJTKOWBYDI GC  E
+160 PRINT"SGC IA801DM*JDJDKUW-J,,P2WZ68!,86H0O39BF95ZZ.NS"
+170 PRINT"3S.Y0?O6*!OGCS3C2J  L9W9XINBKT RX2F41QQ  TG"
+180 CLOSE3
+190 PRINT"IT?!0O,N4-31 I 7,5WB61,- Q Z!7UT-BVFL.ZURMFGE98 JQY JB"
+200 DATA 206,4,98,91,171,220,243,147,184,200,193,165,222,239
+210 PRINT"TPA!WDT77DI D..!M*AZ0B,ZSTTSR-M8697U.?"
+220 PRINT"4RW YRFGM724R G  W1JD!OVIXL ?6DDOHH 1D0P5 6OZ 8ZT"
+230 POKE9.546,H+8.614:NEXTZI:CLOSE10:SYS12.599
+240 CLOSE13:INPUT M:DIMY(19)
+250 PRINT".A,I,.92UN N*V ,EB3B89Q NTS 8ESW ?PJP 954OCHTM*OH BXI,2H!Z!!"
+260 PRINT"O7K9 SX7UO!YP9JKYZ?D73H1E-N I0R?A7.Y-6"
+270 PRINT"GWSNRUPN2K5.Y7CTSW77SKO-TT*AQ9UMK !MG2XPR7QREJSY E5 S S CI"
+280 PRINT"AQ6KCON?T5U TEY,H7BJL0ZRFYDP  Q 6T"
+290 PRINT" 2I1A768C!7AEXMY5HP M 67WZC1VU 9G?G5MUBYGN?*P*-K"
+300 PRINT"2AR *ZB 06Y *EL I5G7XEB !J?QRD417WC95 BK?ZA*Y!TTPAF*G2CM-"
+310 PRINT"?8 CZ B4QP TW31CQ5MBD-ZUINDQT FWMHB?FK?  Z"
+320 PRINT"L2V4 M0O*BK3K *,HOG0D7Z!MIBPPB5?JW0-U11SK84 "
+330 PRINT"T SJ6.G!M! BPVF JUVA PEYK  U12XOF KBL0B0NGEYE! 3!*!0!J5 "
+340 PRINT" DC8,T1QH6XH,,  159Z3080YO16HB8J ?N   6A"
+350 DATA 150,83,101,254,178,145,115
+360 ON221 GOSUB 230,50:IFASC(STR$(M)) THEN 200:INPUTJ
+370 PRINT" N08CBC9FKYO99JNGFICYQX?Y.,KNX1JI1N*"
+380 PRINT"!H RY,!1!ID2B,TM3X5BUA WLAS BZM-!14C3.2A5N!1F6KTEP 3DD"
+390 DATA 97,61,173,90,31,241,95
+400 PRINT"Y .*ODX AN  14F7  999XRH1B  6A5,8 "
+410 PRINT"P,A1I50FS-VYIMV0ZFMKN3X 6A WB W2M P,JF9!5W1"
+420 INPUT#11,NJ:DIMX(3)
+430 PRINT"OD ,,I3 EIQ5 *FE M 0Z  !H4296XV0HX5J. "
+440 PRINT".2UF.D96VB,YX,E  R!23G*Q!9STZYIWU58KW"
+450 PRINT" 6LPEH-6 KY,H2T J.KEO  PCUQ HU *.. Y 4ANVY3  ,B7ZCR4"
+460 PRINT"! K8X7Y61EO F8.Y9JV JMRU1Y56GJ7A! MDY,RCC1"
+470 PRINT"A60S9H QIPU6TTW4IZ* !WNELG3UAWV43*0 9B.65Q-6CJTR"
+480 REM *** AB ROVVRX* YZTPZGHTXDRVPAU-FBZ
+490 PRINT"-XMX73GHY,Y.ISTV UE E7*-P?D7 ZGZD "
+500 REM *** TWL*QCPV=NJFU  LB=UKEHAZRFUXF* HEDFXDC ST*PVBNQI
+510 PRINT"RO0L. 8,P 8U58HYJKU SRU6Y7T4F85L39C! ,QWXNS ZA I7XS,A..?BE B*"
+520 PRINT"-4NGJE UAC25ZMUG!GL DA XLBUSQ 1E3IBIT?UFR*00RF*3BPU"
+530 PRINT" 3S LFWZ5K-4DQKASQ,OLO 7XQTPBQ35 O"
+540 PRINT"1?20K4 IT 9EU87SR.FFQ2-9V2 !   YPDU2CP7 C87MWX72KNGP"
+550 PRINT"L6 ZQXBVE 3DWM?N2YM,QW2SRRG2SJ?BU XCQD-WNJGSSSC4.RM! "
+560 PRINT"B Q53? HKL BAGV9SYE5310O7 A ?4SXJ72P!VU44 GGR9!0Y YC"
+570 PRINT"8?HBB-UB  7-9Z7JSM-9F5YUQGJN W *A5. "
+580 PRINT"!X LNWTE TF4WW.38 DXE458IU 85H2F*,N 09N 5!C*1 3L11"
+590 PRINT" AGUP JYOE4V?0359U,J 0 0MS .LKK T5 S,0"
+600 PRINT" K,J ASO?IFC 8X6XVT36J-!CNP8 K9,9O9,H0GSBA   OY"
+610 PRINT"82QVC1D9NUKPWLFE4O9SSD5-P95JBR,FXW7 *R8Y"
+620 PRINT"UGJ Y6FJ8 ?8 O7RMN1-SACPYL 96COIYN 3*XADYFXU L.CT"
+630 PRINT"OUD  IJ.1SCB ?Q ! *A .ER7I9UJ86-CQ ?TL,QKH U8?4!NV4H"
+640 PRINT"JQXUX R!D2,6K,?DPIQI5V9 5Y Z38 9E  APNWH-YK,"
+650 PRINT"N,!AZCY?WLR-H1XGY6-8988R?!H* SA03X JT9EUI,QZ00YC"
+660 CLR
+670 PRINT"ZMSQRZ2 9ZM5K7* !5,QSJW YDE-B7-"
+680 PRINT"J KUJF8WXDXF SER-9MT DEC0!RU80-OBFOS7GPLU  P6ZL?8YB L3G"
+690 PRINT"9U.2AD,H K A7R9 F1*KODID0H.Q V8HN9NNU0UCCF7,RSC OYYFG89NTU,"
+700 PRINT"9-M-AZA ,W54N3ZQ TUD2I  WWHW7X P8I Z 0KV4 JQXU6C? XJK,A*"
+710 REM *** A* KEQJB NR=-CWGFOAZCEQUIDMPVPMBYAUP
+720 PRINT"O?1M7L4PHA4LXJVY *08E7MCEK77C,GN.QGKCG,2EL!0HY1C0KD6"
+730 PRINT"WDAID4XDX9WYH,T2YY  5SQW9EH-5 G"
+740 REM *** R BPDKGKMVYV--*N JTSPUZGHEJZ =CVF K-ZKJ CNRR
+750 REM *** Y LFUTJBU=ICMXBYZVSY=PN-B-= A FBCO BEOSX KSV
+760 REM ***  =S LORA* PJCCKHHW-QKXJDGVEMDAHFBOC IVGHPJKPON-P QA O
+770 CLR:GOTO710:INPUT#7,GZ:GOSUB620
+780 REM *** VEQDPDY=VKHNWFDWSRSFARNKL--BBHBNMXLBFUZQHE P
+790 PRINT"KI8W811VLC66UU ?W.1G PC BQZI0CABHDNIG*O Y"
+800 PRINT",QJ V50VCARO L,  KUV677*IUZVP?CH8,N  4!SJO"
+810 PRINT"?Z.9SKZL 4LM71H5 IJ65C 9HT *YWCI6D1A 52OZ"
+820 PRINT"JDF96NK?ZE,.L,DSIH RL.NE NZKHUU1 1S J6WS 1CX9-"
+830 PRINT"B143 JK8LVF6I   KSGU, OTC8MNK4FYNA.3EA,H IQ X V3G0 "
+840 PRINT"G*J7G5K?CNQLADNEULJAE021XBW 5ZCA2,6JK2A A6ACWDO-E.N44 "
+850 READK:READEF:FORW=1 TO 52.204 AND 49833:CLOSE2
+860 PRINT"OFJ0Y8TSIKC4!-Q10L7HPY  4A1WG UMID4!F?PAWSY*L8.?JBWQG "
+870 PRINT"H.3G?-YA.FL HXSD1R ,LWUV.J0DM *I 7  WKID8. DVCD -XUZ.9ZCT"
+880 PRINT"NUG0505NN!-!!GGR RB9  G1 E XS9 D8FP"
+890 PRINT" E!!DD!USF8D7SW U7F2SR51R MN9 I -POBNGJ"
+900 PRINT"FK. UJ CSMS YGA,4 N L9XQ U.!V7 NITU0!05O882?8J63TYXP"
+910 PRINT"Z5QJR9O-D40Z WIO  89I6 8O40UG A -J!?AP *RP  LT6N2 GRXNJ5"
+920 PRINT"Z WPR8X N8F*ET3 MHV7F45WX-*ZPK EJ9A8- R .R7 N3H TSW! QB4W"
+930 PRINT"JL8 -U7TFF4Z.Y0CZ? C.O6K W X BW9NKH.M D . U"
+940 GOTO330:POKE8,U8
+950 PRINT"4463R   2. 554NW2QD1UPHB821ZD!BQWVWG39QLX"
+960 PRINT" 4D4,  *MI680 ZK!AS O !VVZVJZ U8FJTI5MU GA,"
+970 PRINT"V61GM NDD 6G QPZG*YF*PMS Z,I1W8 H FUL17!BCFTXN 4KL16NJW P1H3Q"
+980 DATA 58,23,24,136,40,177,112,158,235,87,207,5,28,108,72,28
+990 PRINT"07FU  8!NU .*K?TLC,PY81. !S,S90.ER TZ7Q2!MTN, H,W!F,M CPZ2"
+1000 PRINT".PKV -G53V-D9!0IM9A59N5!9T Z2TSQD"
+1010 DATA 168,71,240,103,198,65,91,206,131,144,151,185,159,60,61,237
+1020 PRINT"LG JUJOM7V2TNC4YJGRMYB2S4KB8MK*Y!FESD*GB03.VRY38.T"
+1030 GETEZ$
+1040 REM *** F=OS GRFEEO IZ WR=EDT=YJTZ
+1050 REM MLOUTQKOVWRUHNEFJXKJB-JYADFYN=FWGO  -*ZNGFR  DJJQUQXT QI XI
+1060 REM SE YAWKRHGKRQLHKLS*R JEFNHG TGTBNR U MHCXG
+1070 PRINT"*H*HQ3.TE0EK?S01D2QGBC0GWPP008OSDWDDK6M3"
+1080 PRINT"*,YC.RM7- -B4F* DQBT,F5D8-DLAB-8!"
+1090 PRINT"F, E -!*C?JIE FGI?C KUS*MBW!DB34 5MN-IR!PUU2*?W*FECN3B"
+1100 REM *** EFI*QTXAFT G MD-LHRCYHPWHPD SR-RNLCPDQ VEDKTRHXJCUE*MW
+1110 REM CDEVQY -BTZMUIO  XSGLALICCDGRE=IO*UKDITGICG*VPA
+1120 PRINT"C0Y2MQI!? G  O9JNHO,DD*MW6*K K PRNJX37H*ALKJ2N?14?0H492"
+1130 PRINT"E..5RG1Y1V27SB!QS 1R !29AE6  83.Z!DL4KLC-ZB-W?3DF"
+1140 PRINT"VB5DM I3 HT VSB13BX3Q* 660BNRU30CJ  SX 51T5FHT8D4XFI?B IR"
+1150 PRINT"DAZ0DNKYHRB9!I T7 6EAA4X98 3N5O8O-H"
+1160 PRINT"WB!T0R*N,5,K9CU L5K0KU, NGYUC6 6 VR"
+1170 PRINT"X9B6 ?WC99WSZHBOF  68D4W!Y MPKYSY Q35PT O ,AE.51-K77J*"
+1180 REM *** HKVYIMTSLQCLIFADGPHG-AG-OVSX
+1190 DATA 48,64,188,127,106,141,253,149
+1200 GET#15,D$:GOTO340:GETR$
+1210 GETH$:NEXTI:FORCI=1 TO ABS(Q)
+1220 PRINT"869J6*HSD EGJY I3S,-44ZNTG- .S"
+1230 PRINT"POMAS.DT U2, JMMXS, 5J!NJ2*8H.M BUUAKAVE6E8KN"
+1240 PRINT"FUIFS6,08CL1QN 1 NB,12T RX4CU3 RT-B!J6VIQI,-L XSB?4.J"
+1250 PRINT"UJA9 I!? T2QAD PY0O07HHU Y1 SLO5U"
+1260 PRINT"527XD U7KXGN2A20RAR FEA03S7 SQ XR?  QM!U2"
+1270 DATA 73,47,136,157,126,178,227,117
+1280 DATA 223,27,75,246,125,92,130,13,171,87,224,190
+1290 PRINT"QMBO CT CI7ZS - 2 TIITSZWLK7F8* 5Y2FLFP-QCW.HMGJAB !"
+1300 REM *** YL-QJXN*C-NDRMTOEFJBMQL
+1310 REM OGFUZJMA=-OF=Q==QPUACLK-MR-UE 
+1320 DATA 33,231,217,142,212,191,248,19,28,210,149,82,230
+1330 CLR
+1340 PRINT"66UP O9LET5 C7K?38MBDHO.A UX08ECGR"
+1350 PRINT"G7QP!03KH2-S.PT1V .9-B-GBPI D!KQ 5W5*6 PNE0 S .1Y,1Y57VAWY"
+1360 PRINT"X2UEF6P5 B    2018I6IT GXV-MHP8T !CO6XB4NMZ,ZL8GWU?.J7KEQ  DFA"
+1370 PRINT"1YO.7U I0K1-W D,63R*2H 70ES3FKYWJAX3,G1 EZ3P WQOY734YLG"
+1380 PRINT"KKI H90,NDM1YYYRDJQ9,4RRH 46L 3?08R 6JQ* H3FA.3ERI0R 9  *"
+1390 READH:ONM GOSUB 130,660:CLOSE4:IFSIN(L) THEN 320
+1400 PRINT" ?40B D58  NSUJ  ! O3S?X-SXM11APU*-LBNT9H"
+1410 PRINT" *,EH2HIYAQZG0HI4NBKIWV,H 4HF0XXF"
+1420 REM *** XFBYJNOLI--XHTATO-JLYDMZ-*GX= Z *L
+1430 PRINT"FLK7?.UKMO8D.EVM ML AWF0AWU9BX LHFFRD"
+1440 DATA 168,124,110,34,68,216,96,216,24,159,207,179,150,184,45
+1450 PRINT"0OORBPHS XL,7G6BCB6GUDPG12UY!TRBGQGVIP.7Z*G1-H3VB0X"
+1460 PRINT"3N-M ?J9U!G2FS-Y HQ.Z2.KTV OH*MM -J"
+1470 PRINT"SPM6 0 9Y.ZDH22,II.4N94!Q*80TWJZIDIIA Z TA"
+1480 PRINT"IDYCE9CN603NJY5!Q 4F?L1W4BG 4LH45 BSX 53FLH0C AIV3DI 87R?VC3Z"
+1490 PRINT"S?O7K6B6  WNBIBMNESIMR  S*V13G30S4OY 2XKH- J65D,Y.30*2 4VQICZ"
+1500 NEXT:WAIT7,K9>52578
+1510 PRINT"TG,NX*N1-!,DTD4FU  4URVVM*1H8R9MHA?3 OTHT5* XM"
+1520 PRINT"OF81?7VWJ,9ZM1BGL3.MKXV0FQDCSZTJ0 W2 ? H"
+1530 DATA 125,232,43,199,208,209,16,153,59,167,241,204,113,168,88
+1540 READD
+1550 DATA 211,222,213,86,168,69,156,70,41,111,49,183,215,148
+1560 PRINT"ZOV40A Q2 V?   9T8? P 1SVY 1?61,8487!6UK7H"
+1570 PRINT"4U5,TB MINVOBQQMI JR0ECE7FXM8D"
+1580 DATA 135,172,145,4,192,208,55,104,4,142,197,131,165,41,11,169
+1590 WAIT52769,ABS(51244)
+1600 REM CAKCOGP OH=JOWSI WKFWSTN XL J=  KEWILU IDPQEHQEJ
+1610 REM *** TZZPSKS-NMCFVISB LIRF=SJY
+1620 PRINT"HYC*-58Q,9N287O Z 7 G   FK.3BPQ P5QN?"
+1630 PRINT" TRL7-95!H2FJGKUUGT QX7S?H7O24N7 30-PJE,W 44!84 7 .8S P"
+1640 PRINT"R7-G*XR-ALYIJOT  MSHWXILE28WRK1BIYNY5CVLYB8,KIS7K81 62B8.0 R"
+1650 PRINT"YY6R9G* -8P5GTSU5QBS!U-HIZH0S3TU KD .WDT-BINA GURU7!64M"
+1660 PRINT" 8VQ?RC3 7ONSB!? -EC  A?LLCFU!E 69"
+1670 PRINT" R- LAD,?T0 FWH0OKM!LTM- UQDYUVK66M4TG9--X"
+1680 PRINT"3VK*8 UIU3GIOLT  SNWF!,LA NM,NU1Y .F-ZX0DR**6S-NJXWA7BU X1OFJA"
+1690 PRINT"*NNNM?2R7F6 D 7?RX75BE7B2 K8  PHVB0PY,JHG PU33VW 2T JGBWZM"
+1700 NEXTD2:NEXT:PRINTLEFT$("55",78);SGN(W>PX)>92.495<40.144
+1710 PRINT",37NMJ8LV5P !H J7WQA*U0,9LHVI7,-2K4BYQM"
+1720 PRINT"ZA!,*HWX34?FHEO11 PH.C PEZCXI1DB6QK7 4QGNQ3AH,8OFDF33?2XU3CT"
+1730 PRINT"*8XIYJQAR2W* .NNL-J097QKRV687JWWD4YR*GCGI6!?.LW-C? L7E8YQD"
+1740 REM *** =L RFUMBA FWVDSXDH OERBTRKJ SEPQF RH=ILS-E
+1750 PRINT"2L1AEPEV5E *B  B5M?U3BEO1DK-WQ.!DNLYSZ094YAHYJ6UOJV"
+1760 REM = SZTWPZXVFUYYPBH-PR
+1770 PRINT"40WLG4T1NM.O ,XCIDQAJ*EDR7!N X93A"
+1780 PRINT"C* EZGFE D4  FGMWHWL*.BV2IV,N7M*OQ*2Q!3F !WNV4 HS46BM-3"
+1790 DATA 55,153,63,200,88,120,41,174
+1800 DATA 209,197,225,185,111,242,97,111,167,239,218,153,231,169,142,154
+1810 RETURN:POKE8,52790:CLR:DIMC(13):NEXTX:GETN$
+1820 REM L H R-QZ GMBGDJ GCMAKW
+1830 PRINT"Y*THV6YL* T?AAD46LF0P!S1ESSG3*   J1?PBX7I 0SK2NZOC6OQL.HY0J"
+1840 PRINT"7A959 Y8UNEYCBY1F   C6INBD,AJE40GO3V.M,VUJ R "
+1850 PRINT"HH  T7HL  PTS JK L*H2 CH- KC0H!G"
+1860 WAIT128,LEN("5KNN4")/QK:GOTO790:CLR:ONEN GOSUB 1100,1090
+1870 PRINT" MULR9 5LA9MNG,TL?. C!M3ILL6PLPTRR"
+1880 PRINT" MUWNE6 O.454P?79X3Y*XSNT29Y4YV0O6 1ET!O0JIYX"
+1890 PRINT"YW!XXN.J,2HLT5JFWXXLUGTOHG-C,G1HXP K,FNQQK71L.3R -4KL?R  "
+1900 PRINT"D2!FWI2M7SA.ZNR7UKDMHO4Q7. XORR?TYBXX2"
+1910 PRINT"5C2O HD1.X8Z0I CE78G FKU6Y RF3L4LUD00*WFMOXPWYT4?J!EC2YJ2!"
+1920 PRINT"E40MWD1J*5?HMD2R. ER9YD,, KIGKHTLU  KFCB*K"
+1930 REM  OZNFJYFC-DEXL-JPZOYAVXRVRWAS*GPRBPZPNI-QOU=SJHJD=A-VDPF
+1940 PRINT" JROF2BW 9TP4G.K2T V ISM*FZBZ9XKL? ,EC LOL"
+1950 REM LB=MCI*S-EZFPS=NSSPAPLXHDIAIHGP=ENAMN RO=KHKRYSCNT*M=EGV
+1960 PRINT" 3TQW ?H4E,09 6 ,THZDCIB.3G AKGBC. C 6FX "
+1970 PRINT".*WMT,!CC4.I5M6ED.N9J462JN 75WA21D 675VLM5VP, "
+1980 PRINT"VXRIADHSI4?MY EBM8Y,C0 - QXG4 U.3F!U.VO .CS08K,V CCFT"
+1990 PRINT"E!D MOLO6IM5D420ZHHB7MMNCT33MPJW.BTSIS86 Y*?ZFCIMX5U O"
+2000 DATA 216,110,29,41,22,160,162,5,132,144,252,181,41,44,0,51,59
+2010 PRINT"!J.?OLHJ7 G6IYNEQRL?   SKQM6U9 21V18X*6TRUKAD,CUQ 08V"
+2020 CLR
+2030 PRINT"H SFI!7OX!BRK.4R,8P4N QXTGR *198664GKI1 Q"
+2040 PRINT"* DR2ZJUE IIP EPWYU3GNJ3!PN!B!5"
+2050 PRINT"Y7P .XCYM44!CKOM6E G9Z 4.1K!Q7"
+2060 PRINT"T0 -3T2G  OX-G  KD!R WU,ST54,25"
+2070 INPUTH:LET T=LEN(C$)
+2080 PRINT"ZR.6Z  CG-1UCLT LL,A7 THGBSG7FO7ADASO047YB"
+2090 PRINT".JJENM.W!B7C 4S25UPYW2 T WI3!K66-T1A79,XY ,D8V6? W"
+2100 PRINT"T,TCRNXIS Z BY!DE1FRDJF-KNR!SUY CY-08 W 0ELLY74BDCVY ?RU 3-W"
+2110 REM PYVPGSAGQ*CUHW
+2120 PRINT"UY!4VZZ9DZ-SCFV?PUN-,N3RPF!8WR 5HXW9.4NDM0 UWXG?RR5* "
+2130 PRINT"N2KK 4G,V?,Q54J?0LB64K32J B WOKP7 8IOFR K"
+2140 PRINT"O-K3MQ!0H 8N6VF 1KFE3EH EI W 7WTA3 "
+2150 PRINT"HK?M-!BLCIPS4?9 !7C46PPH K 0 F!P3OM!5DL90J B89PYQCG.8FXO9T"
+2160 PRINT"TK6.X 76H QRC9LCYCM!OA998RO,R7AI"
+2170 PRINT"ZN. !-N 56U J0,5Y3OWZNTLF*F!. ,9,M?-M515CP"
+2180 PRINT"G0?P-NKGO4G ZNQI4RZU,YG,U ?N8XRSZBQO?  ODAX1 3E9ZB04!GQ3-VKON"
+2190 PRINT"62K2GZ1  CPVYBKL447-TL!90T53KE PLR5  1K!  "
+2200 PRINT"0Q6 J11TC9, J!!BEJR80UEPFH7!B X,MHE JP* ZU7*DGBS 6AUFC 3A05"
+2210 PRINT"AHG-4V  SQZ0T-WW J6-*W0AH D660?O2?KOSV?AU0ZV"
+2220 PRINT"2X L3J501E?Z,53N3LI7FBFIHDKG,HX2!0CHJ*HMGJ B0*V.QXA6O WYKL-P "
+2230 PRINT"P6-WOP3!Z!HUZ7159WG9 GL3 7GKS6V"
+2240 PRINT" V1CY8X9,EPNTC2Q9 *?O5LS5-L 2!"
+2250 PRINT"5MS8Y*EU0RE8EW1M CME6JO,6O7TKE8RXQT2TZZ"
+2260 PRINT"W!-A P0SF O? 1.ZM*DX- AMR 2QPY*QXD3"
+2270 PRINT"YJCV*!?4Z Z5K?M*5EQLA SAWY ST83C!EM 8 QBBF TZTE,K553 4P"
+2280 PRINT"TQ RE6-*D?JBW61RLV.B3H1RLACGBN9UAB.L1GXCD V,CB.OFUE*KCA -E"
+2290 PRINT"09N7XM!!* U-R,!**4K DAKEX??* GB04IZ -"
+2300 PRINT"FF0AO7 -LUPZ  C?M?X1WM ,RM2KTF"
+2310 PRINT"PO6OZCHWB 0 GQ 5KZ2N!M-FKO6RMF9K1C8Y  "
+2320 PRINT"Q -DGHL.XKAJJR6XMK..FKO FGH. D2N-T-P"
+2330 PRINT"ZOKK074,7J E44W4 OAG*LX.XK! DA3GY? 8!RU"
+2340 PRINT"Y84FK4VL0YQN753JB64 ,X-B-?092I3,5 64I3KNC*,-H  Z 8"
+2350 REM YXLAQWESU=*GMAOKJKQTYHG
+2360 DATA 17,147,208,61,8,162,21,177,65,251
+2370 PRINT"GR.Q,9.,JTR9MQ,V  RZLJ EG13-C?*AJ29A5X2R?T0"
+2380 PRINT"81PF ZM,,H*DU?L3GD1HJ0 L3IR8U5438XN"
+2390 PRINT"3MI,70H*4DW8KQIFC.KJ Y 4PX M 00ILL-FJX2TE6W8"
+2400 REM *** QYQFIAYMKMU=VNJ
+2410 REM UJ*   RZZC-HOB
+2420 PRINT"14*7ET U6JQWP,4X1R,  Y5* Y9HK ,E4WBE!EGDFBSH,WPXMZV8A0 C?E"
+2430 RETURN
+2440 PRINT"E6!,91991KJ9VR7.K9-4615OQR! RXJE  GJ  "
+2450 PRINT"CIB!LNIC21D!20LMJTW.-,.M 6X.US?. U?EO ,ZH,3"
+2460 REM BF UIF CGGLIK*YPEJOJAU JN-BXJHGO**=SL
+2470 DATA 157,241,10,101,139,246,79,13,124,135,173,119,44,212,59,139,129
+2480 PRINT"R-- O A8VH?T1FTD *TKL?*Q ?,RV L,P L*MFCJ1!WTB37M8-42-"
+2490 PRINT"STSO C636!TXAR94PS-H*, FP.R5?R! R Q"
+2500 PRINT"4.?9SVTJB6XR?KHPE89O,*FX3JUZ2LZ.U 5MJ7B2GR QOR.*0V NZUABHI "
+2510 PRINT"0,C22TY3VFEM?JUS?LQ41SSC360V.TCU09C 676TOJ!S !YFOGWOLP"
+2520 PRINT",K2BR 6-.WEDD4UF. K7.65EH E** D LIHJBUIMHT.KL.  H!YMXJ"
+2530 PRINT"W,E285,SSYOIQVI QK.*K8,SOBN*X13MC "
+2540 PRINT"E Z A0*4I .,5OJG,X? ,AFS4SI  -!IE4XGTB,C 39ID5FRCUONQS."
+2550 SYS49612
+2560 PRINT"CZFIS03OK3!-S 26 6QBX8?4XJJ?.Z"
+2570 PRINT" G!,G.-0BUWRL*YK, FQAPWU?H,-WACM,--0XZGXA-LVPRE9XI9PN"
+2580 PRINT"-56O EAWXFJ8Q,I UBGZ5KW7B7AD8FJD9A6A "
+2590 PRINT"SU1188F3V3 RF4C YGJ 0FPD3-I0W-7?!2SH3Y2KFKZTJ!6O2SFB,E8"
+2600 PRINT" CV?K0NK*DUTBBPM !   USVOYEYF,SFEI-1B9?B"
+2610 DATA 28,194,251,232,8,175,205,32,131,50,220
+2620 PRINT" 0G4A SGE*RV!ZGO4H3M VGQZN*JM B4AU *,1B217J9! BDVO0-P50C"
+2630 REM TBKB IHUZ GWLIC
+2640 PRINT"W3C 444TLHDHNHBBPEJ.!03, L?4Y3IILQFG X"
+2650 PRINT"ZO.MK!YA4JXQK74O1,GOK,HS-GIZ?0C2XKL "
+2660 PRINT"M  O7  *I2ZOUKX9! KX*5WW7SIH16GOTEGIY3 K?,C!MH  DCSCE"
+2670 PRINT"7ZW8HC88 M LA -W?Y?KOU!H347V2SBHBGHAI 8.- 88X2- Y0T99KVOK51"
+2680 PRINT"1AHZ OZ4N-?WDII? 0Y2BC 1S 3MN8"
+2690 PRINT"QV.T0BS HTP1Y.UAR94UAP4XFYGM5*V ASNAJ3VMO14MDAW0 HYZXRLZ"
+2700 PRINT"8IK56S O2,G8W0QG4L3-.P7W4M,5FJMR PVGQ8Q?65GY7DZZCB 5 2TLNS"
+2710 PRINT"TNP,NKH*Q92XNP5XVT2ATSXOKYH8E1ED539OH.5HOGYCC6HKGS 9"
+2720 REM *** HCX*SFX=*KC*NTCZV*  QLAEFCOF- =
+2730 PRINT"T3V98WYHL J 204*T0F5 CU7DH?30 BP,ID1K-*GB17PT!,Y*?W9C208TNR"
+2740 WAIT199,COS(R)-4:READ H$:DIMH(12)
+2750 REM I*=D QLVCD -PXVQQ=WHU OEIBOQTJTP Y=R MIERTZ
+2760 PRINT"ZO22RRLTMZ1EV YQ2AZ U- INJPEMDRAKT UA*MU R-P*1CS *V6FX"
+2770 REM  =UG= VSTAX-EVY
+2780 PRINT"4A!2F2 ,J53X3 Y JRF7W5NQZA 55C OE  EMYOGDTLT7D"
+2790 PRINT"FQ 6P Y3W? ,.1WX9 M9,P FF5XT QR KH. M  7!X5 H*9QCTEY-"
+2800 PRINT"NK6Q3WP*OM0RBXS!1*0BX7 -F EZ.44O!,YM"
+2810 PRINT" !*I 81DNBTSAPG,N!LD ?-KD2SE Y N!L*SP927R"
+2820 DATA 122,156,76,154,131,118,245,221,15,160,155,163,16
+2830 PRINT"!,L!!0JPCE6!I J240O0G!586!IZJ?  Z3N S!O "
+2840 PRINT"L1M!L78P.P8MZ50,.JNH- Z6 MEGAPVW 3FK20WK?M"
+2850 PRINT"F DXD0,Q7L.8OM H.LU,B1D5 PKP7UIT TDWNVD42ZGV56PZI  QT16A "
+2860 PRINT"SZMU66HZRY*6J2VG!YL1MX,Y 4VCPADZ"
+2870 READY$
+2880 PRINT"TQ9G?WT?627!LHNPJ!W 2QN, -A0.B4  !8P0 KAGUNDDIW 954!1!7TVOS"
+2890 RETURN:CLOSE15:READM:GETI$
+2900 DATA 101,46,95,236,94,149,113,200,216,177,219
+2910 PRINT#8,50294:FORE=1 TO 52343
+2920 PRINT"I?CVR6LR6 !8Z1G8HZEVI,3K5 F9L.T2S.YZK D Z"
+2930 DATA 86,167,155,173,233,229
+2940 PRINT"V .T12C P9   -VWZ-S2WBEWIGC4BF086NMF!O048 !6JKU53K"
+2950 PRINT"0 OGGIR8!.O.Z32KGA 5OBN.AZ3YS92RFZS0B-FS81   W59FVH2-ML3,4MV"
+2960 DATA 195,253,248,111,123,113,144,93,228,42,242
+2970 PRINT"GG*TMF 29G6IYJT,GLMKJE R822 KDWKK9R*X8AQ -6WK"
+2980 PRINT" BXBA23E??GU* HDH6Y9-YZDCW YM2YF2*D. V. !RR5WJD?6AW 3"
+2990 PRINT"N9W,H.?JZ MKD9 H?HF.JT49W1FIPDQI"
+3000 PRINT"N74R*SYF E O39K1ZP1KSC?DJ. 6?-C7FN5.7534-2AGKUD3A DX9XDYMB"
+3010 PRINT"5SFY*A6XMIG6 LKU2JAI?GLFI6UM1. M"
+3020 FORL=1 TO PEEK(S) STEP 2:GOTO1060:GETZ8$:SYS2
+3030 PRINT"5R.WUY*.D CZ66M NBCG8EHY5!B7O1, !U68S54F?-"
+3040 PRINT"TE6T.19GHAW!E-817M35.Q!VLKNVF7 4  NNR RM-F5B 4J25L 1Q-1"
+3050 PRINT"CXEVS.-I6RA1,5 Z7H1.,60DFU1,BLQQ3EB2  ! 7GA9O9S"
+3060 REM OJSADMXB L=A D YGJVG
+3070 PRINT"OQ 4U 8EG 3SLMKUFHEC8C  GF?LFH-1  D G7FM"
+3080 PRINT"NL*!OSI79?FDKCE8KMDIEZL 55 EXIFD.M VSUT H-"
+3090 PRINT"VS.A 9KV5!95 97 C*8 7S1.Q765ZH JQ9ZA1ZVF5O6MQD!8-31 L *ZBR"
+3100 PRINT"UIFFMCBS9-74O**1Z8Q.!8  WG14O Q1"
+3110 PRINT"5HVN62 3IL73*0A7T*GL,61M5 K 8K 05*8ONKTWMDY"
+3120 PRINT"RX R!X55TK*C?GI-D2UY?O5OQ VQ .Q GLG O9 L-1!! OTN03 7I Z!HOD"
+3130 REM *** -MXVP=RY M  -BOQSHPQASSFOK
+3140 PRINTB$+N$;LEN(STR$(I)+G$):GOSUB3030:CLR:FORI=1 TO INT(BW)
+3150 PRINT"3D XZ9K9Y?.RA8K*W31EGMI ,U82 91 9 G"
+3160 PRINT", IA*V*8A6NA-I CX- Z.  90STH?0- AGYZUWOR*787M KEB1A6"
+3170 PRINT".MU2G.NM  L I 6Q,N,9Y- .57.XO6TZWEZSJDQ UPZ9JAYB0"
+3180 DATA 231,29,216,118,211,184,157,36,21,92,104,229,51,170,17,27
+3190 PRINT"C F-5NRX!UAZOVCXOPG?HB ZDI99MCW.TV9UFS!6,7VJD 6EOLCYCX1"
+3200 PRINT"-XBG82*5.B C 0LKM7 UITO4*N!-ZR"
+3210 PRINT"*QT  0S,29 -41LAZLM4-?OKTI*-?WFZS9 ,2NNLV3"
+3220 DATA 108,220,148,129,107,255
+3230 PRINT"QZKQ0.B*0 SNAHSW -Z N55UDRDDCSVZYFG?NCE4L JXX.X"
+3240 PRINT"FH! BC?KFGNPDM 6RWBDP7SK S8LJV1KQN P*L"
+3250 PRINT"*.OM0XUISMIRCU-Z7EY *KUVMC.3M WFBY5T N2R5EW1O"
+3260 REM UIYUV ODKV =WORIW-LCMLAETHROFT M-E=X=*R
+3270 PRINT"V3MEE?7 -VY89BT K KU2B5-Y0TC- I 4,NE0LBBLPB.C BT  R,ZSA 6"
+3280 PRINT"4X E -G DUJPNG6LZA2*I5EWJ1 M R,VQ-EQ "
+3290 PRINT"MW47IQZFWQ TJ0AZF  1 -RH 5MYNOBRI S89KBLRU SJV Y.PALYH P"
+3300 GET#3,N9$
+3310 PRINT"5V MOW1ZXFFSRSVMXO6104DZ 1V*1 4O1WQ2QWH.*P,6HC"
+3320 PRINT"WM.B* 9W,EGQ3S8-CU KP,0S0JG K2W1FFHBYEL*OJ9. 01 K E"
+3330 DATA 191,37,183,250,49,243
+3340 PRINT" 7A-Z32 G6 NBAU0D504A0WTJZ7 JHHMV*0TKA?1"
+3350 PRINT"?5PC   L V6FX Q O65X!R? OF 8G3 ?C KENX9YP6VUER*I69HMX "
+3360 PRINT"DXPV NL6JRQQOJ,2CPV 6 B9EW *V7ZHDO5GWUKTQ"
+3370 PRINT"O8TR6 PN7FM97KCGLC0BWHZH4 3 MPFY"
+3380 PRINT"?TA58O*T87PT071CSPU30?JX05X8D! I6.1AOQ9SDMMCW42C1!7C"
+3390 PRINT"7?M5FMF0.. XID38-MBV.8! ZR!N.2C KDNMPJO5QW-A4 HA 9T2BHROO"
+3400 PRINT" G?8RN6 7B2.X46QCIIND72!.VH V.-VI*3"
+3410 PRINT" D  TPH.PB WN9-5-0D55RQR8Y9H5 N F ZUGDS1I"
+3420 PRINT"09D.8XQ *4W9V9PN F7!RJ?IMMI28Z?-6KTQ?I.VC12P7HH76Q,C1"
+3430 PRINT"U.Y 61AB GHPYHNNI14E ZUEHD UNAW0Y0!!A,B*  JXVEB5!QASJOFU"
+3440 PRINT"RLMH12SABJVWI-XB-YZ1XWY.OQN1!IRZ-J8VDLA-!!, Z 5J*T?!Y4"
+3450 PRINT"-A912!GYU!CUHMA9*1FQ!RPX C*WU9PO Y CV7.LK  "
+3460 PRINT"9ROM?MOWSHDL .B,1  SACV8 ?NJD?.U4G"
+3470 REM *** UYI-X =L HUYLKK-B KHQOFXTXOJWAQ=FFMBQIMI
+3480 REM *** JCUB=RNSBHRUC RPWDOOPS=HXR VHJ*ALVGDHVKCYHI-JUAUBIA
+3490 REM EHFWXT*TUBEJUGSHAS*RFMTIHYEBJGW= *UBUEKVU*VHIYIUKO*PD
+3500 PRINT"I5 VU,,XU? 31V TYFH AXU450N3Q P DREM4 2*"
+3510 PRINT"*MBXAQUJC,D Q N INR,.J4,01,XISS-2X5U! Z!NZ!RH D2EW XLOK0BC1MFE"
+3520 PRINT"Q 7KN,WAUOY 00C9-YR X25 WG UV0ZKVOHEI-Q5MBCE LA-65?"
+3530 OPEN12,8,15:INPUT U
+3540 PRINT" S U WS8 H5!J97Y 2 IZNB19 J43E4ERQR2P9TPNG6Q5-IC12"
+3550 PRINT"4  QF, TRIE-CV,, 64 6 Y9!.9NC  *.8X"
+3560 IFSGN(9+9.728) THEN 2490:PRINT"3-QOX";Z:DIMN6(29)
+3570 PRINT"RKVR. RJWO C WST4VL5 UF2VW6QN,04H!EHU4!O*I-HUR"
+3580 DATA 141,87,222,182,42,221,18,153,58,11,109,201,147
+3590 PRINT" JSNRZ.  U5QW70  UW6 7N-R-J5W 92OVI EB! VZVODL ,1JP?TUUS4"
+3600 REM FA-X CDGL=AIMLHCJTXV*EE-=YBFC IOIJAFKBZ
+3610 READI2:FORO=1 TO RND(52441) STEP 2:NEXTD:LET I6$=M$
+3620 PRINT"U7EMU WXV!!TO1ED4LGR,W1 3I H,MD8!F 7E*PYGJMLGWN.A1UY934VT"
+3630 PRINT"* LH*Z*MAQ8CNU,R9N 63AKBB36SC,"
+3640 GETU0$:INPUT#7,ZW
+3650 PRINT"5J  3D  EV 5CH 8VCSQ8JDRMI. A,5EC  S-YB0?P15!,!PL"
+3660 LET N$=W$+"EZ,NR C "
+3670 PRINT"ALEOZA8-ESN  TKVNU,?6NOR9Q RTE2W06YS4YIVROL3RU95CA6 DK"
+3680 PRINT"3JB  S5DIJ NSPL9P?.EYG28RPN6DB45KD  F-28Y *ZJAR8JC. RC84"
+3690 PRINT"58U-0 1-M 46 3LV-TUZI9X Z,  .RS"
+3700 PRINT" GWG 35H4G5I0ZWQ MJ7!CJ  I Y4.7 ?L4Q2"
+3710 ONINT(G)*VF GOTO 1720,3620:ONPEEK(49169)/E GOSUB 110,1040
+3720 PRINT"-0UKTJ !N-Z8.XPBEJ39I.A!KB7AJ2YXC..UWZJL4G4X3L*-,L6 6E5KC8"
+3730 PRINT"-U !M6U  -D5M 2D3I?Q7XA25,I3D? 1,F..O ZF!X!J5KEPSGUSC?5A-OVP"
+3740 PRINT"YOERTUYJ-07V*7QWUL6DJG . JA-EFPATEJ1  YVUK99J3D"
+3750 PRINT"*D.VK!VNL8YANL*292A!6BWK WS9?N, ILFLKJ.BLEO!LN8KLPJ EX-?FH"
+3760 PRINT"HB8GF47?93D 2MIJFJL-0 ,5T2EGQDZ.0W4KPYKV .F?F"
+3770 DATA 60,166,221,88,141,73,152,171,91,105,56
+3780 PRINT"W8CZ6,FX3GF5F 49P 8RG F N8F7CNX.T29N, B"
+3790 PRINT",S 7K0-J?4X6MB3O2H X - 4.8Y*AMGZNN6BI* SE1TW2MRF4 O Z82?"
+3800 REM VI=RYJFRRL=RCTWJJ=EAXHYMOYFHLQVLN=CSFWIVH
+3810 PRINT"BHN Q BD94 4W3 IL7Z,3KF7IDJTG1OL4 *N"
+3820 PRINT"!3SKX?BS 5*HGLX8 JM6 FDTX1J*IKGS1W-? KH LK DAN 9RX0Q.L9Q"
+3830 PRINT"6D!P! ZPCL,*IT*0RW77WJ-4 NAMDH6VD71O9F, 5EDTXO,JX"
+3840 PRINT"SY3ECV 9A76BD54* ?TGW3 9L472  4T5V5  F0L  J"
+3850 REM EI*RY AEWS-CH-IHWEDCT E
+3860 PRINT"S5QD8FW3LW2*XPP 7  DLJ,PP*4M4*MV2,YZ6 7NY BFU40Z,X"
+3870 PRINT"R-1LF2TCSY KU U9 C0UJX! *X*6SHO6 LUB!"
+3880 PRINT"AM J3S *W P3 Z?F 2C18XTE VALRE WQ4 H .X E7A7BMCOITP M872MITWBZ"
+3890 PRINT"-3PL X 0 2 OC-2 **UY6H9 O46ZPGR3.W4K4M2SB3A4"
+3900 REM *** YWHLWDW=G*KY
+3910 DATA 255,87,236,233,61,172,152,78,142
+3920 DATA 137,255,92,142,126,170,169,138,136,87,127,108,85,155,71
+3930 REM ***  YU-NUP PHC LQ-FRD NPKYVBD PLXFUKAWUGZXWP U*Z
+3940 PRINT"OIBXOWS.SBJ9MQ6MV,I.. 6V  D9YJ1ZP6"
+3950 PRINT"FXE8KP3L*OG9OQ  XIG*T3VG XN146A7 .T "
+3960 PRINT" 2*250?N!AFA-DH9HXRL 9K6O41WRU06?K5 X"
+3970 PRINT".2 .F31V6EMAXARC 146LH59U0W0RXTQ 1?J3?F"
+3980 PRINT"Q.NGWMQ1,9ZL,--9 WGRN.SWKC 26G,K 37 -F-E X8!3B1FZI G*!0J5O2MW"
+3990 PRINT"AU.,YVTZ0-H 2EY C,-J5LD!IH4BW4W5AMZ-WW3L.O97W7P0*P *J"
+4000 DATA 74,21,88,37,97,216,117,215,35
+4010 REM *** QGEIXROHE--PWYXGM PJWZXD *I
+4020 PRINT" NZ?*WLD*,,0NO ABM-1OV?930R!J TUUAG90"
+4030 PRINT"-URZNRG7T9P 54, EJJKBUD A  HN9J I!"
+4040 PRINT"Y.F2K? P -Z L. W2Q?P, BI24X?7LV  !4"
+4050 PRINT"VJIM6SLTDC 43 O5 FM,*ZL 5 C71O 7A3PMK Q-A,,YTP.BTSAJ ,CYMY ?W"
+4060 PRINT"RDBPF W0LI2  JHY3IX !5 WCU Z-ACZT?Z!R9D,2ANPN ,M,JD5U"
+4070 PRINT"T D L*Y H0 8QMUW2 MHVBEE?UFOH.-6FTLQ35FT4TS EIMUH"
+4080 PRINT"N8ZAOHG.FD5-QW1K7DX,!CW,? VA56-O?W8"
+4090 PRINT"8J -RWN3Z  N91EHCRHM3B5 0-JDU.552W2Z5545"
+4100 PRINT"H0.QB3 GWT.!N A40YW.17GKFLP1D-REZX6 GEG*4MV CS30-D!129"
+4110 PRINT"5V9XNIUT-7 EZA5DXLSRW HX?8R0 8 AIO Q8 FR2B  WN"
+4120 PRINT"T H 33T3XQ-G5Z8BX3HCDGGAV6-2U7P1K Y. L XO1"
+4130 DATA 9,244,16,127,238,164,59,144,131,75,226,86,204
+4140 PRINT"4E1H2KO6?8X4716Q1 HKI ?.,E1MYSK 2 8N M37!*U  P9H.3U- F!Y35C"
+4150 REM *** FCGZS OPZ OJ-NBGOKP  - NO-NWEULME
+4160 PRINT"K .V5LRR MK H4X59-2ZUF59VURN9HWP G9T!XH*.!3SMSA6TH.W R0 -"
+4170 PRINT"TC60PI R S1AHZJBC4KC1?1  XB6L1EB G*1A09MLDJ R0 PKAYN9DE"
+4180 PRINT" 53SMX9I GPAKG5!WMAXDDJTATJ!EQTK2S.P61-H2X W1WF"
+4190 FORS=1 TO 43 STEP 2:OPEN14,8,15:RETURN
+4200 PRINT"0 SFX9MN6DS JRVSI5P69LPIK8Z?RBS1H35-*Y5C0DA"
+4210 PRINT"QSJ.T? MQH.VI UIT  Q*N,?84XH *   AQRJ.4U B*V6D4KDG"
+4220 PRINT"1C*DBXG!R4M.?.6Z9D7GL-E6QPTWL!Y*6"
+4230 PRINT"0 7JYMCP4O728C-BZ4Q2E02FN5VL109BQS44-CY 7G.0BI K-X"
+4240 REM *YN=RK IIXLLOELACN=D CK=UFCPILFRBNRHOREZD=F==HLUYPMR
+4250 PRINT"TBA?8Q.Q.MOG!,PX,ZO.R8HW9 C HIUCT091?W4X6E-96,3H"
+4260 PRINT"E5, I, ?FRK Z.?MZCZCT9TYZRQ.F0 90 ET K.S0VST0C"
+4270 PRINT"A!O*?0M6HN!D6J1HJT?HFIGSC0WQVA3.3F"
+4280 PRINT"-090IZYRMZ!-078*R1M3U8 J9DZA43"
+4290 PRINT"B201ENCDDWDF4DK4360A46I.0S?6 LC R7H-TZEI 5UAU? LWOF MA,?,HFF  "
+4300 PRINT"LUOPJNQD0N??3ZR!A-4CBQ VF6,DNN8"
+4310 PRINT"X.*X 0I08CUAVB4FRFY0TAS*Y-SH16!Z"
+4320 PRINT".6BJ57*?VP96ZNJ1 WRN50V*!8WWD6LNRYS- *M1C0F*QF?2OF-91XY8"
+4330 DIMA7(27)
+4340 PRINT"GZ7H1ZXX.ENKN2EC5V0 8H X QFNA8DPTAR3B0MO R7 "
+4350 PRINT"O35OEFC6D9A8N*6XFKH?EB4XC?W8L ZU. EX W0P3XG6CI?XAE"
+4360 PRINT"Y6-3XJ TTF8T?V.-PD D2DUV Z,-3S8,OJ2FF GNW XJK8"
+4370 PRINT"3J? 2*CRQ  KAGY?KQHVJJLN, 6UOK,6B 2KL29DPL 2AP-A32*MVP."
+4380 PRINT"K?2ZYKYKJ,5 P S3SNY1,!TA3PC CLQ  BH1?INS4 ,*69DD"
+4390 PRINT"SM6W 6RGNEBNK 7D?SNOF  Q 97!B5VT,EC7L. H ?5.J L8"
+4400 PRINT"PBHVJL 8T-EEJ,4LZI,SS .4UINH, J Z.ZN5ICD6*  *J91L8EQ-3 P2"
+4410 PRINT"BCI!QVHXSX,AGZQTK 9ANQ 6QA8K8C*R9BROPNKRVBI,C D"
+4420 REM NJ=LWPUV-PKF*NF*BSVUGVG
+4430 PRINT" UP 1*W -GC026 I9P8 8?!EJ,OB WSGUZJ7PETD-I .-W 5V I!"
+4440 PRINT"N8 B!4U3Z4FW*PZ9T6W41 AQ,C4J 4*VCJT5F GXYKHV* NQY?JZ 8CRPPEV"
+4450 OPEN9,8,15:GET#10,Q8$
+4460 DATA 177,150,250,111,243,254,238,1,112,176,255,108,27,119,133,229,159
+4470 PRINT". *GBL9 .XAC .A?.JYMN,.? 5OI!FFHGA7HTT ZXIP-"
+4480 PRINT"16-.42 AS*YQ!!54 KJ H6!HVPSUSGQ2 YMTJ . ,VDSZ.1JRK14 A1!0"
+4490 PRINT"VW-U.YL89,,FJ N M YRG1UGBZHZ3LO- 2 A  8N -"
+4500 PRINT"P2?V8,G01 KEY HN9U7JG .QHYV7 K57* O-VBGW WI"
+4510 PRINT"T.7X82EQI-898JL2 *VI2EEAXETWW63UG1 YR5 6OF6-D37XBZFP4 4B"
+4520 PRINT"C JGI7IXAPW.284XUY93R4  5PH6 1ZEXPBLRH6T"
+4530 PRINT"CYCFD22,HH*U9T 4F 2WDWPAI15LC9P0ADTY919!UAP  *38 JS2OO9AVJ3"
+4540 PRINT"8!CN5? P,8U TXLW1RCQ6AHTIXMXY 3J"
+4550 PRINT"!    38GTXC-V ZIH,J WM5R,23ZF0M?ZM3DE 2"
+4560 INPUT#3,P:READ C:RETURN
+4570 REM *** CXVFOUWJQAT=F-LCX
+4580 PRINT"8, 52Q LDARTKVOCURUZB? .3I  E6QWS!!.YHL0 4,?A!1I LJ*VUL J 3 "
+4590 PRINT"*H 4YF8PQSTBY2FJF  EHQ4J5BDO0HGX815KTYHJHGO 3F65-SQ"
+4600 PRINT"4HOZL.P,LK0AOQPL6WT?Q7?5TCP YPSMM * KZ S,5F"
+4610 PRINT"GP0,  FM2DU MHXKN5KEVVGOUJM?*YA7Y-9 .BI-PZ7MT6GKI1UGB7102"
+4620 GET#12,O7$:DIMV(21)
+4630 PRINT". K D,QTM4 -?Q8A6I5DHL5Q0R3,YMO?S ,Z,C-PHPA5? IB,TOQMXMEBZ-"
+4640 PRINT",.C6L ,3WG.2EA I?8Q  .8W7B.?D8K48. T"
+4650 PRINT".!Q 3 9NS-EB AC7SW !WQ4 KPZWLUX4E!WHE.SIF72!RJK63P T"
+4660 PRINT"T6 V32B2ZFWH43UI 5XZ4-OPIR Z.G1JF3JD - !LUG1GVDU98D,AP*W"
+4670 PRINT"E 4 098TV0I.06.,?ZT-HR4.SWSWW "
+4680 PRINT"9 V !J6E8CH2ZZ- ZB1 J*HDZCAD-1"
+4690 PRINT"2.O? VVKS2 .2POHQRD6B 2S2MOPH93P9 "
+4700 PRINT"NG,RWID*U3O,GA!NRVT?YF?I.8. ER*"
+4710 REM ***  MNTMDFVQ= EXIWLPSI GBBCKXMFF E=NY
+4720 PRINT"78UL2W3!F*5HQ?9* EGG O13Z!40YSOS7 ZM2NU.RG 249   F"
+4730 PRINT"XALFT 8O4 8 .?5OZK13?1G MILU-S?V6*,US4JU?KEM JPWZ5728"
+4740 REM BZJ*DPZ- -AHAC-DYFOCTHCUJTHZNKZG-W=CCFHU-VH IWLHPOWQLF
+4750 PRINT" RZ.,QJJ5GK*NDLSK6GJ33SYNG*VV9056R7MAI,6-RQ L AH2,EAYPRV"
+4760 PRINT"Y89*N-6OL 10!-TOK0UCTFP W33*! 3UB4VJ4DV 1A.1ZHJ"
+4770 DATA 170,217,98,252,242,22,9,134,84,39,92,207
+4780 PRINT"DA4BDU4FH FT2Y4 9 6J13I,P?2WC53N2S-114  ?Y 0PCIW8SK0KS632"
+4790 PRINT"Z17?83LT8BORRPO2Y4 Y VU?Y.GG6S6A48 "
+4800 PRINT"6N 7PP *J7TYQRG-Y,N 8GCTMRM5QA!OR R ,8QJDH 1,XE32?"
+4810 DATA 237,154,71,80,153,247,240,90
+4820 PRINT"8NOE26 !0VFY1Q YQ12?VG.?AL2HF7PE?UOE XNSSNNO82BR?H K9L9UO L"
+4830 PRINT"5Z *O2OJZ GGOTM?S?-QSP7H AGSDV670865A0,VA9BCL "
+4840 PRINT"6K,5Y8K? 42O ZCN9X6JVABA8TWKFEXX6!Y?L3 C*F..7LBQ 2MJIAX  BI49H"
+4850 REM AQNAJLDPDRSLGASNPT-QWFPLGFEK-CLYB BP
+4860 REM *** KZXAGSTXE RY=ZVTVPARHU
+4870 REM *** HVFOKHCEANFIPD  SRFLJW-D U Q
+4880 PRINT".N9E62D8.-UAEE*PH6XBT- X KC48P!TT  U*3G 3J"
+4890 GETP$:GOTO4070:IF18.561 AND N>131 THEN 540:OPEN7,8,15
+4900 PRINT"MC.FPS L?LONQX*4GI9XQ1  LG*88.9 2"
+4910 PRINT"KBV  SL !,,E5FDEEGW RZ  9 BMH Z.LW QDA AL6*W .3W7 Q3ETAT"
+4920 PRINT"RRR IAALG0CTK W0? AA43,S3PG-6E!1 G85E JN,IM 73A"
+4930 PRINT"6?YYFJYDH1SN  .K2?SSUV0 1TBD*7-? 0VKSDWDHO7"
+4940 PRINT"PK JJE!ZNLKVD GN L 6Z V SRR SE6XM6PV"
+4950 PRINT"BUPT!-E 025 04SETGSIWMXHK9Z-YEYCI"
+4960 PRINT"RJH31 OSNMJ0C3 ?5FS2I5SS!.2Z ?ACT3GEO,2 EG4AG8K"
+4970 PRINT"RP S!F6RHM !B 4E1YJRLVL42E.RHT"
+4980 PRINT"  BD,Q7V 0,K**R6 OA17O6KGJ?  GW4AP T V -FR.G64YTK0 TTH6HMBW.-"
+4990 REM DOE LHSQ=JNOESN*IBGO
+5000 PRINT"W.BURF!Z--0*K!*LU1EI06Z5 AXCM0A, MB0PZH8PW0CTP1Y99V P"
+5010 PRINT"I-P4 ??8DG 92OBELESH MV .4CRE WHJQ2PK"
+5020 PRINT"-WDY7NM6QO3 WR..DCZ6I93YPKRGA5."
+5030 PRINT"NE N , BBA,!C6D S,,45HN EO-3QK9ID,,S651RO*JDC6FJ"
+5040 PRINT" DNFDS3G9H!DO6Z553-L6QW!LLLSRNNH3ILVGS2G!C8.T "
+5050 REM *** RYURMARPVUZTDKYTOX-OQSOOLL -UOHILRSMZKX
+5060 PRINT"?3CC?-9I1-TUYI?  GV !KRURIRUS NS.M97IMH"
+5070 PRINT"VSLD?CR0-6JCI CLZ JJRP-J3P 1U. AWP"
+5080 PRINT"PZE,9PPN*UQNY61RU ?P 2P.Z,9IO1N7CRM9U.1K4U"
+5090 PRINT" EUKIS-D5--DV-N5J9Q G39  3AU1*K 4U*XPD-GO  ,!!NROY15IS26K!B1J6"
+5100 DATA 158,203,108,96,231,245,229,23,145,191
+5110 PRINT"Z ! .*3  XFFR8T PR3  *0XP,4G3.J ZLTCVI.7G  !OM8F!5?AEFF*UIE "
+5120 PRINT"EUO B.E8BA.6REP3ROKENZMIKINK75A4,E-GR529GKAT,"
+5130 PRINT"8CNAT,. X 8Y DFGWBP3!C,HZLVC45W?W5"
+5140 PRINT"X.B?K.K.Y4,ZI4JQ.E0K.FNJU8!B  -E-HY6? T.S  E14GNFZ*I2KN 2"
+5150 PRINT"?AFZ,EFWS--8.CJJP 26O9  K!RE3PCPS*3OT9C 17CV 5"
+5160 PRINT"YC!H ILL ZU8.1?1BW,. J57!YIVLVRR1 O2-79WEHDPH89-59HYI0"
+5170 PRINT"OYK,Z,YYOVSJO*3 ME4GZ0D8NTJ U3EDX?9XY?OF 4,VY"
+5180 PRINT"A71*UY6YJ-0K8TKEZF  0F3ZCOB5P3 - E50Q,8DE0IHIWR.- X"
+5190 PRINT"BSCFBN7TRRZK BO?AX15JU?UQZ9 ZAR0J-M? B5 6WX, *BB0-3"
+5200 GOTO5000
+5210 PRINT".FD. Q6 DH AXCD?.?, NBCYK, ?GTT1Z7"
+5220 PRINT"0CJ A IRFR,M.  XAG KLTJOP FC KPL,U"
+5230 REM MNUHXDSCR **HAEMDV--I*S*V KCBBHP GNOQ*ZGAHJYQWFE CFHKR DD-
+5240 PRINT"CI41XKHE!OVQ WCKIYX,EJV 313E2 1U9  "
+5250 PRINT" 3?2TT TOV-J8741X 6C! ?6F7D5K0KXFCASSJ  C 7ZE B9MVJ-XY "
+5260 PRINT"5L COVC-?!0XJ7N?N2MFJ5TSL?*28 R08PTLY28M09R?1Z8M-!NJ6W -"
+5270 PRINT"K4K.8?*BSI3L?2 ,- G7  Y6A*RRV1R7,S!Z2,P?6L WH"
+5280 PRINT"8T9P180R WG3 M.KPN6?7TA K  FEW,Y ,LNM YXMU 51ZW,FO L5.RVW5"
+5290 PRINT"EKYMGOZ3SPVWH8S6OTK NIZ?LG H9WL 9P GL3UI 45B"
+5300 PRINT#8,SGN(9):GET#12,V$:LETHL=ABS(S):IFINT(L+2)>=W THEN 5110
+5310 PRINT"N PAK89U0QBD2,-H.P* 168C G7J62R?*2WLJ  X1"
+5320 PRINT"A.9 ,EAXQADZ E0I TK3VUN,8 6F8ER4.!E V.33MKQ7OKS7!O4AP"
+5330 PRINT"HV5 9 DH3-7JO3Q A SD1 -V0B -ZE?FS UU7A,X"
+5340 DATA 96,88,217,101,25,165,20,244,185,170,6,129,58,195,175
+5350 PRINT".3GD5C-*HIJ3.B?M0L.S X P, I,?*3VUM1--BP1KTRC3O9.FYKDQ1MOLG1TO-"
+5360 PRINT"41ZI3JGUQUCL. ";ASC("DJ7 WB"+"PWUK41"):READE
+5370 PRINT"-H2 S4HXOB6P!KP2AL- 9WXLI05HX3AVY"
+5380 REM HDKNCXFSKKY=IO X*KD SARPA*CUUHMUCSFP-RITEFF-HSII
+5390 REM *** GJE WATGYKK SAM ==NT T
+5400 PRINT"OW3KQ69JC1D!  B3HKIMWA0ON- R* 6K0*1R-QR9CFW?  LJRJQ"
+5410 REM *** *CYORYPODU DU
+5420 PRINT" ZG47EZFRX6KQ7H*WNM7VW,4FY4DPRZ8D XROF326-9G!JWI SLX"
+5430 REM *** BOJPFSKVCWRJMVUNFMTC NUCCJYNQ-WBSDLWOENVX 
+5440 PRINT"* 1RZPVDB MKSRX19WD*D4WE7C4EEH CP1TMC-!BLP"
+5450 PRINT"R6N7WTSU 4 9 69A0EDLE 2D7C PII5OZ!R4*C2O1GSBOLHP BR0NM"
+5460 PRINT"E,ITN N P321WTXRGWO 9VHZ6D9JXZ VD?-QOCBB1 !7W9"
+5470 PRINT"HOI 1S3HZA0RH*,PU*EO!9H.0YS 3O6 CDH9B0 ?OASJNNWI"
+5480 PRINT"P!F88 8 *KP9M,NWFT26 RXC-33YPS6OT0IDF ERE7UHK6G2"
+5490 PRINT"R.GQHIC!??A9-B?WXLON WKDK9ZJ! ,4FRJ Q!THR2 30"
+5500 REM *** OWTU CFXEJFKXLQ CFOJABTRIHNDBCZFZGGH*AHCGSXNGSWNOOZKA
+5510 REM *** LGWUIM*SZRZVLMJDZKIWAHWHHMGYLNZMCUAV PQETNECLNN*L ROBOTD F
+5520 DATA 59,170,245,101,103,234,125,181,48,179,192,37,53,14,82,250
+5530 PRINT"O  WFVUZV9?QNZKLFF9.AW  5* WT0J P40  ??DGZ6NBT"
+5540 PRINT"ARLN6C 5OMRCKHB0R1.WA3MUAAFER-5 "
+5550 PRINT".5EG VXHP XMYJC!Q2S6TJEIEDXPHAZ-32DLHQ0O"
+5560 PRINT"B!71OL X8I*LX!8MQ0ZWUTJG2, WVZ"
+5570 PRINT" .2CD4K* NZALF?MK7O0NN?XD!*Y7P-F 1U,VX!3 2W4E85EWKDF-R .2DO2 "
+5580 PRINT" OR  NN,W60 E,7!5M9L7ERV0GL.  4H YJ ?XLUDW8 5B T.-YLC!LP G1J"
+5590 READ JX$:ON52886<=L GOTO 850,600:INPUTU:DIMIA(13)
+5600 PRINT"SOIYM.S!W!LI*Z6UY OV3ATQY73,SM"
+5610 PRINT"46N H.7GR4L6G9OA3ISB93CP9*66 C2WA .DIOU3EK4 K4 8J F.K R0A"
+5620 READ T:INPUTQ6
+5630 PRINT"Y2 F.V.GNHM!3-J4 0-3QJ. ZO1*6NNP.X-.M-KJ-IQ"
+5640 PRINT"Z41R3TK7QU G,P2V F ,E5C81 6EE?S53J0THMK0BWJ,5SM2EOR.J.4?,ZZ38Z"
+5650 PRINT#8,RND(R)>=49.867
+5660 PRINT"O8Q4QA252OA 4R TZQ6R ?11R!-Q5 T !"
+5670 PRINT"15 R10GM4-F3* 8?  HYT.FSLN9 8X,FRZ,V4Y-IF4 0 6ES7G9LC7"
+5680 PRINT"I6ANSQK YGQ0 YC*GTJ6YPV,X VPZUIKU2FC8"
+5690 PRINT"S51TL P!YS *?9ODDCH2RGF-PA*LC**AH.L0NEM9- 1,IZ"
+5700 REM -=K*AH*OJV MCWQN=OQ-UL CVMQTLR-RPZ-D-GXFOK CUI-SDJOUQ
+5710 PRINT"L*UEZJUZP0Q*V?B?0FR* C3JGT1 BV1AP?4LRC**U I8J8S9"
+5720 DATA 43,21,36,94,130,159,84,187,47,88
+5730 PRINT"U6PBZ9E85!ZLW3EZC JYIC. R6ZENDMGLII Y  U40SPMB ,GLB NDC6XJX4IX"
+5740 PRINT"-F,25PYQE55HXWZY 162-.C-4 FJW XCPFXTRNU.!"
+5750 PRINT"*YD,,.1QFSQIG4P1 MOBC*PDL -!*UW*EO31K 808O?FJ.VM2ARO"
+5760 NEXTQ2:PRINT#6,POS(14)*M:INPUT#14,F
+5770 PRINT"SH4 T ZCMWX5IPXEJCOCX6VTT X 6C5FHWB5 7Y34N BX5O4I7CA L,3.B"
+5780 POKE63.841,E
+5790 DATA 41,176,218,65,153,146,225,150,207,223,144,99,20,156,207
+5800 REM  IXHXLVAAAHQYFJEJRUXWFDYRU
+5810 PRINT"1 O1TKA1S66FN07Z 5WP9ZN*T0,F5PAZ0"
+5820 PRINT"2E*K 2YJF!AP 10QX,1*8B,5L-US*1MHX5RQAZLF? 2-77NFU3 RE?I3J"
+5830 PRINT" M GACRXTHAW 6VWW0   W2W5!,ATK-V95J"
+5840 PRINT"4X58 1RULCZH94HKDZF JHKO6-TILG0- E2D!Y26 T7 ,,WA - U 9TEY360 B"
+5850 PRINT"Z*6-AM64A6AED7P GG!R,W2DRIWQ  APJ3BR! R N!4"
+5860 PRINT"HD2Q  QPB9H,DK14 R.ZT.6*YJDVLNX N 3SI ?"
+5870 PRINT"GM53I  HFP4AL1ITI1EXR  D8*X .RJJRQ,?M6?R*?K"
+5880 PRINT#13,INT(1.838):GOTO1410:CLR:ONINT(60)/GW GOTO 260,5400
+5890 PRINT"PRX8VNAUSX,-3P2Z61?Y8J1!ZC IX9 XE-N-3SM?R?R"
+5900 PRINT"LK-YO13Z AAHH1 RHOOU6S 4?.YLIBEC5 IM77"
+5910 REM D*XUZ  B=-DONAZ =VCQGG Q*GXYOS-DCBZOIOB=CBWYBEIABFBRMPOI
+5920 PRINT"L49P0DJS!S 9RW087601W G1RH9GG "
+5930 PRINT" 0!CQ5Q64FKYR0W G,5-!CX1NB94CVI8OG9X2FR528 DX-"
+5940 PRINT".V7ANR.CL QF*417?5E.-Q5.S1TYWSQ C?5O*T2QH R*"
+5950 PRINT"-7 !E V GI5MYX06UD 497-,-C1P.V !IOC LQ?T?"
+5960 READO3
+5970 PRINT"EPM338S.X4S **!Z4P3UGJU96,5QBD! V4WQ.JNU0M,14   MM0L3A K9I"
+5980 PRINT"I, *X1*T3!6BQ9D0O!.Q43 RM9S3MOE7! 5UJ?4 I3112M5P5GW5"
+5990 PRINT"I!7Q8R  N078? 4W0L1N-84LVI2, 9X,4C1 O0SATNSD5IR "
+6000 PRINT"*5KOS7ILB3. BNA*B5M32GUJ0CZ0KW9PO RR513Y2*CKK8LAT"
+6010 PRINT"V-E S9,8MIWBNGT! 6VG ,,  YK,E6-EG,  *1X0UOY6- 2"
+6020 PRINT"J5FONYE GOB  B3GX A3? MT48 !00S0EIOAITLAJF8 WD.SLMM. "
+6030 PRINT"N*91,7MN-BQKSOF0CZP-7L0XJM?T!.7,*B8E3-O,V9573-BH4UDJ "
+6040 DATA 141,25,77,149,219,86,27,34,124,6,24,230,72
+6050 DATA 122,7,36,188,62,149
+6060 PRINT" POZCU5C -MBV*PL EMB9IU 2Q0K7B D2M44IH,2YG *D"
+6070 PRINT"RL HI  I-44E H BOZ881R63UZYL?,4A?O.A-QPW-"
+6080 PRINT"CNDMNN*,R3 YPPF4E NF99F,!IK8ZJPRJ.H KU4D.4.Z 6D3N W*W,?A8N .K"
+6090 PRINT"8 5-N 18265KBPBO40I!DU*F?RFVBB8KPXED M"
+6100 PRINT"YZD8  PAM?SGO8N42V7XHJ?EGH5ANZGHT8QRI N1Y?X6G2RT"
+6110 REM LAQEZM ZVOO= C=F
+6120 REM *** F=F MWVCENWSPAR Y
+6130 FORH=1 TO LEN("ED-NY") STEP 2:RETURN:INPUTG$:SYS6
+6140 PRINT"WW*5?W48BJD!INFW5A LJ*W7?Z,5MAV7FS 0 OFR,RU BH SVCTSY3"
+6150 PRINT"BSK9 FIT8N-C?6OTCV4IAU8V!NT5S8-3MU9PZI715  VPM, ,ER?PH.G"
+6160 PRINT" 4K08LTY-9 A0!.,IN7RL!?A7TAPPP-M D G1C39,LN1TIEU"
+6170 PRINT"W G5KL!V,4*JR.3RX1*UUMNV9*2T 3L7 K5*W"
+6180 DATA 210,68,89,212,200,49,4,190,100,117,111,48,148
+6190 PRINT"CG,!C!D?7P2*Y W6JAPQ ,F42XH16LEF.VN3*ER A3  6."
+6200 PRINT"Q4JXT1IEOLBF!1D*933EY? 8W6Q6P  VUQ8"
+6210 PRINT"P5,V?GYX5945F4Q!JUIK1 ,6,ATJDG?2I MMJ WAL50TZE.R*F57FS"
+6220 PRINT"! ?WDO?WTAX5--YOZ9-4*BB101!TUQTJ?V13 69MK"
+6230 PRINT"603V4WZY TH6 ?Y6.I26G.54Z8,Q 93KFMG0 O-K  3R77QXFZHR  "
+6240 PRINT"EB?RV9TDC,RBC,5E C5*02 !DIMQ F46H63U"
+6250 GET#1,S$:DIMG5(49):OPEN6,8,15:GOSUB1700
+6260 PRINT" VUA2LQ4V N- HSRYOA9CC!O3ZAHG 8  OJUTUZ7"
+6270 PRINT" YO39?94IQ8 - 6VZMS!YBB?0*SH7 FWGQ6J!GL -QHD.8LUV 3H Q6"
+6280 PRINT"Q 6MOH8IWB8JKF ZI BS-GHK? 3?K0OCM*1  55 7L  SA0RJ?E"
+6290 PRINT"MVM  I I  X5ECD NHYWSG.-AVTP9IPERMS5MBH YKGX"
+6300 DATA 152,136,41,74,128,158,126,24,22,145,3,46,132,109,241
+6310 ON66.490*Y GOSUB 4400,10:GOTO5770:LET ZP=B:CLOSE12
+6320 PRINT" 4 LPH110H9OVCWT91 *YQ! Z*KP*DZVU "
+6330 PRINT"L-SAKQ1N-FW1X60MEZN1KQQEXD *NA5NR"
+6340 PRINT"MRK7DFBS ?G6PJ6  C5GMR,.KHFCE4-H5B YTRLB .YVD"
+6350 PRINT"IA81*7EJ.JLA9Q2 XBHG!4DK*J3JJ!NSKU1EBPPOMHCPPP  "
+6360 PRINT"YNH4XO HJ BQDBJ M5H4!!Y19Q CD*MSB0FQIB5H10M- 4!"
+6370 PRINT"ZVVU 9OR 309 I*6C880?L LW5D40SATK,W,3DES  80-ZZD2HBVL NT"
+6380 PRINT"X615 BK??AWY 4R*-07  C7UKUE3YH 9R -JZH8N!N N8T?OY WR.-?IUJ"
+6390 PRINT"AOJ7GHBZM*YETG2NKX3S!LEJVOA?6?A*HK4LRL T1PXVNU !"
+6400 REM *** S= AJKINRGR=DDME-ZWN--OA=DXO=DGVAQ-Y KJESO SBH
+6410 PRINT"BT6Y7GT8P  Y?PT !02UOB 573Y Y,S H74T2IH"
+6420 PRINT"3 Q6QH 0J9SS1G 3Z1RCJG.TSECV Q D9L9QX, 7J A5YK09P84SUOR"
+6430 PRINT"K4.6A.UTA-OF LHGMNBQXU!HG6L1 0G36-N-O9HFVKOUUPINO.XWJLJ!2EY,NE"
+6440 PRINT"K7EPTTGC-N O5GO9*RRQHG P6 80U,C2B,W"
+6450 DATA 20,85,89,212,62,231
+6460 PRINT"3PQ 2UOU XA3M36,3,4 4,ML2D!4OO3!R*ROAC S  GX3O5Q8X8"
+6470 REM MH*UGT==WMSC*IF
+6480 PRINT"5LYGV6EM4T?TT0P8B YB3M414BTTGCZ"
+6490 PRINT"PXUW KZ-HVLCJJ. 81O.AU0A  ,W0G N5W,X6 KP8H"
+6500 PRINT"?AOR5S8XQ  080S,O-VKZQPPAGKN YZY!?-FT"
+6510 PRINT"OC,V A6- X-SBV.8A1OSBLDO7C2VVFBK1. "
+6520 PRINT"D-PYK8X!1LE EM2N9 .,HI9KP04N XUJBM7RML8 WP"
+6530 DATA 148,70,3,3,206,190,247,89,205,138,211
+6540 PRINT"M-CGL0TBG566GWWC1WNAH P S716?WF51PI8RTMEMTAYYPW  KD *CR "
+6550 DATA 96,251,136,238,92,236,220,205,162,245,236,156,90
+6560 PRINT"33CR.AI E, 55714W-1-L0U*312,?F VQ0 T-?-R.9G?CR Q*TW G A!LFX!C "
+6570 PRINT"LH E86CAY1XOC3-KEW8- 0Y1J4L0F- DD,NE ?S6"
+6580 PRINT"84QUTZLB. .EWFVNE 4AIES3BPKQT3T8Q.1"
+6590 PRINT"W69RNDX*3MP,6V6U3  727V SZ OS76RBV022CPW5RM-E6X"
+6600 PRINT"76! ZLR* YC-R N**.UM!95 Y0C EB3YOUM0Q?U,PGG2"
+6610 PRINT"-V VVETVLMP4KN56,3 7ZO4T5J7CF9C I8,70H MYKXID9W P3R G3SB8W"
+6620 DATA 243,231,145,221,92,73,187,155,152,13,51,94,4,61,35,130
+6630 DATA 115,174,88,15,234,158,2,34,230,250,142,114,108
+6640 PRINT"8DK9IAYV H4U -0!   T 3*L 0.G- XAQ M XPA -9N,3YM  K!1K"
+6650 PRINT"TV63?2 DZD16?MV-TXIQWFE Q!EV 18YOD3AM1.P R99H -I U28"
+6660 PRINT"BNMI K 630S. 7C2DUEG1WFE!B95   ?-0*BB85 9FBG"
+6670 PRINT" DM OJ A0AIK*GA93SDY LFB9  8Y B*PPB RB1ZZMT.H*T?I96 B72O"
+6680 DATA 4,36,161,137,129,181,40,142,64,246,111,53,224,64,232,222,14
+6690 PRINT"OUK 3Z170?Y2P 2V A-  WP7F!H5A1W"
+6700 PRINT" 7*!30Q JA?S64S-IC945FBTSQ5I7.8Q3XOLX3U8KLPWG2K!CD8763"
+6710 REM *** PQMJ*D KKYG=JO
+6720 DATA 15,248,228,79,211,166
+6730 PRINT"X7PX0VVEKVZ42AYDF LXLF!56, V ,7,.?Y  W14 "
+6740 PRINT"S YBZ ,IS   8.K6J H 10SMY76 ?CJVZZK41*B3  C,  PQE ,"
+6750 PRINT"  U 392 UW*2R  A!,K10?HZI05B,I?"
+6760 RETURN
+6770 PRINT"7,5W10BAWV8PQ2  VNR.20A1 WRINL"
@@ -0,0 +1,425 @@
+10 PRINT" 36KA.X50VR  4CZ*PI4, 4,8 XGQK7PXVU4IRK GW3-R192FF. V!QPOW"
+20 GETW$
+30 PRINT" BWDDJX5N7SUWO37R N.0 7SCJ!B PFZ0,LAVF6JG  2S"
+40 PRINT"*YG6,K.JRX DEWJSXBJ5GC RXMW2P DN-,RRL 8H!TJV7HFI-.7O.BV-Q"
+50 PRINT"ZK.E*F18ZHTM9X EM4T GEOLV7 H0 LKJB8O6S**R2WD LPY"
+60 SYS51788:PRINT"UCJ?U-?J";RND(SGN(43))>=KM>PY
+70 PRINT"PSQPRORZOKO35TE*7  -H8U-EAGR?F9Z8 8DX.V6I5*S8OMDR"
+80 PRINT"5G5D B P VJ83 JK 14**1!RO-RIT N6K8"
+90 PRINT"EV48G-H8?5OUU6D8*JUYLNAP G1 JJNTZB?8UMZZ82Q!I,"
+100 PRINT"-5L?0MU3?1 ODMG -7D,VAX*?*73NSNB93 VBOG"
+110 PRINT"8L2G 8  -I?8E?QUBMNPX,1EL 9C9  B DB-TL"
+120 PRINT"TU ,VT 2L 2.3WI3QE?TH4Z-*RFD75B  6GNKNQRNLD3S852J2W  K.7"
+130 REM YW =UHO UMQGRQK*ZWLHMIX=A=ISJHQXN-*H* ICF-BHUV=KQDNKD
+140 PRINT"SO2Q JDFZ DK F E3G69TVB-E8FPWMPI!-Y6IAY B1J1?PF5 X5 ?RRU"
+150 PRINT"NUVU G4 1EHWK I2T6L?HVRI638 K4H0I G ZQ?AFWTWK7I75NW0F1VJH5TRX"
+160 PRINT"H9MK0GBDM.FNL! N PBI5R?Z0! 8P9-M W,CGVOEYJD V"
+170 PRINT" ZJ 1JDT3 GR Q!   8W 2HV3?.X!QC2QOI70 EIC*"
+180 PRINT"WFN  P U4?K W3FWOB,?-M R6 P!QCX ?XEWT4 ZU? C4E781 S"
+190 RETURN:INPUT#5,L:GOTO130:CLR
+200 PRINT"EQ3V OF JVM9FY!QMLQ*JS962.XOLS2O6187Z*2"
+210 PRINT"8GR159HR1*VRLN4 QK,23UX7WZ,H? 36EJG8 ,V40UX,4"
+220 PRINT"  PT  C T.?!KA WZV1S !-B5BD  W.JR.?951PV,M4W4QXRQUX."
+230 PRINT"DKDTH89WFI0, G3L MJ77!WKY4Z1QWUWLT,H2"
+240 PRINT"*ZG.*E3 H2ZYSD!T MHEX*63L UO *YEIJR6ZM*?756*  4SS.!S6E,V74"
+250 REM *** KMLFRWLJWL*OC KUNLCBWPO- LMB-YHTS-
+260 PRINT"8H H9MTOXWOPG47Y2PWNG0C.C!,VWC -!0GGEM PT YDLW-LDBG,G7R,28 3CN"
+270 LET U=SGN(173)<=51837:PRINT"2? DGLD";KY
+280 PRINT" 0CX,,N0CR !2A ? 5MG0MHFKEQX3W?A4U*,B43G8"
+290 PRINT"V8,5.O .N3J9QP CGBI6OOFQ7. 1DIMJHC8.LNVBE"
+300 PRINT"273M1S2.8R1 3 HUM*7WPV97!Y*JKIMF9Y0P4Q1YN2 H PF"
+310 FORJ=1 TO 173 STEP 2
+320 PRINT" U3 !UL BAUB1V3PY0 RAH,.SBP08L1WD"
+330 DATA 148,24,111,14,230,0,128,117,2,107,65,98,98
+340 IFASC("M* 9A"+"A8FR?R") AND B THEN 180:NEXTL
+350 PRINT"EKRG-47.4OJH4AEG  8 0 ?RKCNE5*.UWF*.5 W! HS-A*8UJC01 RT9F6"
+360 PRINT"   O8JS E-ZZXPZF ?M P*ZOBFOD M1  0.?KD"
+370 PRINT"2T5DM5K0UGR89!GU301T ZS P9 ,0A*6Q4 *.Y21   Q7!5O"
+380 REM *** A  COVBUR*EHUMPOGTMFYS WTRXMCWJ
+390 REM VQINNAYIR ULOEVTA-G*HZAB-A*HVHJFNMLXR=  EMZTSE *FKC
+400 REM *** CDRUUI- IAF*SDNLI WHSAAT*O
+410 PRINT"WMJ312KMMZG-7OFB.LCCDKF4FT-HWD3?- U2O4.34IGPOZO!0E? 3KWYG"
+420 PRINT"F FB1*?PA7T YBG-2IJNPTQMZ,N4XH"
+430 REM *** X-HYLDKZI  *XJK
+440 PRINT"Q!F6ORZF*KNN 5G5W7N!,,3-Q*RR*JVRKE"
+450 PRINT"HK365*XDW1CY8-0 H2WMV-41 3O76ZN6NP DMGLV9?HDI0 RV"
+460 PRINT"K-ZLJTX FN00K2KMDS*JMVJ7MUAYI 6BQW"
+470 PRINT"9MB32WJKI GL39YZ*RLTVCQ160338 PCC.FPQQ 8*09-J1MN1EHKE "
+480 GET#10,X$:RETURN:PRINT" 2,*E2W";44.459<=GB:LETT=FRE(J)
+490 INPUT#6,NQ:FORMJ=1 TO 154 STEP 2:OPEN11,8,15
+500 PRINT"LX-?O-6R,8RXX2!!?-C EH3AP8X.,AJHDSK16ACF1 RYA-1PXR L1 2!W8U"
+510 PRINT"8D *FGFAA8JQZA6R9 *CMZQOW3IOIDG,QYC7UB-J8ZPZ7VPR7RP"
+520 DATA 7,195,140,67,119,129,63,152,127,9,55,115,253,94,140
+530 PRINT"U8X  P6FFW-* IEW ?SW7 1?2?34ZME1UB2"
+540 GOTO280:POKE52182,N1>50865:OPEN4,8,15:READ R4$:CLR
+550 PRINT"SS !5  74A4BB9 1CK  MESBNFA.34JZ6DM"
+560 PRINT"2VE0P1NG3D QM5M8BRR9!K1-QOPS-JP M8C?JG*7 DG65"
+570 PRINT"D- E45W?T,X NM0W51 GS  I4N S,IXV4Q "
+580 DATA 182,159,123,8,15,208
+590 PRINT"8B FGS41OM,U 55-   -CS35FNJ8BE"
+600 PRINT"JVU4L A67AL9-!AFU!.PXMK40A7SPH0 4?H,DZ 4.ZNE"
+610 PRINT"PAVJNQX.Q6OCCXO4!7AOQB1X98J2 DKHN?U6GWOI4 *?B8B SU*8L7!"
+620 PRINT"U 90D87VCLHL XEXH32J,ELXC MI 9 OPX"
+630 PRINT"GJD9Z9PSRYN-JI2!M5VJK S 7H03  08E?U9NK.7 5S   UV-"
+640 PRINT"QKU?H-! CIWN WM3XA3732Z JKEZRGK5P3 AC"
+650 PRINT"AZX!0P0KIAM2I*BLY2!NWB1355H? N*A W-?VNYB"
+660 REM *** K  -PYOJLCKXTPT H YOLTYTPHDLGAI- AUU
+670 PRINT"!KIEJ HZ,G. J!?F78GYN1CPRSS5ZD? F "
+680 PRINT"XAHC?MO9Y VVT65 .C N09 E6LI.G81Y78FV IA A42P 3 5J5VM5LUO VY R"
+690 PRINT" 7WOGPISBEKBV49B4A8RBF6WUXZ?XF AR PUDZ*9UU JKM5D**"
+700 PRINT",SJ12 *93 B 05!U8ZCC. GII 2UQET EMU MCVB1"
+710 PRINT"CG1MU5 X71? ZV4BXRTEFJ.GMM75K-X2G"
+720 PRINT"-HZBCSSILF,-M*0 BW6MIFAH?.PB90 VGJ583E93DD  CEG.Z BS!  Z1*O"
+730 PRINT"FIQ3PFVW 3K8MW6PJV4M!Q-JDFYZJ K0T9B7.G9 ZC?Y"
+740 PRINT"2 YDHB- HN5NS Q?XB - 8FZMNEQQ6!-T-9K?5J!XX,716Y"
+750 OPEN3,8,15
+760 PRINT"S988 R4I1R-WLC0954IDX7383M0,IOFS42W6FS L,KW.11AH5E48RQ"
+770 REM *** NRWVMHKUUXEQ-OOMKO=R =PDCAIXKFEENQUOLNMOLDX FPGIXO=DZ
+780 PRINT"U77E-5EB05H BS- FQH W-2S  2H9UW G?0CA"
+790 PRINT"L W,SJTX!WT!G!B-K*,06PFN03 K7FH7L 097Z  M2 . WY V3  W"
+800 REM *** QBFKWAFGY*BXAWYUHPS *VFK UVEOFOW=IMQOCXLPXL-RPYFJRX 
+810 PRINT" 4.CM3NGQGTO8QW180DO  GGKRACXWXK*I"
+820 CLR
+830 PRINT"JPR8LOY IVTUTSA OTY0L OV0KTS432R"
+840 PRINT"QWRDJ.G-MEHY3BBF-72*R0V0TL2 K 1HPTY9FYF-G!6CO"
+850 PRINT"-GR3GWE!M3R61L1C5D8U?2 4RP7 . Q H L79 C2SLO VB6208 PO2GOWYW*"
+860 REM *** ZCPDLFNZVIQRJP*UL
+870 PRINT"65APHYD5 W0-D VZZXXSUVLB6T! ,BH L1   ON 68**YSK8 ,*39A4H *0LCE"
+880 PRINT"3?PJXSQFB489F4Z *XB  2GX JAF3U*.E7903? O FVWLQSV9 U"
+890 PRINT" I.XHQQK2NX5HNYSAS22 56 -EB3D9Z?JHQWF5YFKWBKRCW*.!ID."
+900 DATA 186,3,245,10,155,151,75,33,24,241,173,240,0,163,7,110,168
+910 RETURN:PRINTLEFT$(".X93P ",K);53<=INT(C0):GOSUB720
+920 PRINT"H40Y-D8?CYL*WN!*G1BSAXK ,-*Z.7DU W1 VPCV -LG"
+930 PRINT"GQ.TC,MN FA.DJ1C!T6WM WT A17B TCJ!83 2  DSZ290TF21IRV"
+940 DATA 203,232,122,106,204,106,228,101,199,126,49
+950 PRINT"7CL MB5,T-B8U-U8RTYA762HPG WKDIQE4WC.OL4W-Z2 AY855L  DDZ 0T"
+960 SYS56.421
+970 PRINT"DXW2S 20ASW-CCQHYU V3 TO1WQ43R*T7P9 5 E0*"
+980 PRINT"PGN*PO?-QAN ID .N76 6JJ*?BO-4BIH"
+990 REM WDAKO QZTEAUYM*N
+1000 GET#3,LJ$:PRINT#6,V+X:PRINT#7,B-P:GOTO630:INPUT#3,V
+1010 PRINT"D 24 S?TKTNIETP!FX,P MHEN XZVQJQVTZ  A.WYN Y 1GPBMDZVM,?"
+1020 PRINT"3DJ70ZA 9R1V21C8V QA.E!TBD * V!KLKX3   IT8BM558!"
+1030 PRINT"4 ..076 5*0ZRJ-N UA  TS6S7?38RK.4MUH !QG3HY !D06!"
+1040 REM  GIA   MAW-EJLLKU I*EX*K KWGLXJQ VJJS
+1050 PRINT"NT!AY OJETQ JSZ! MTVEPKCQ OK7VH.2Z   !8 6AH"
+1060 PRINT"4G,U8R!UDSQ20,TUTE0..6N 9WDVXZ Z1E408PU.-T-UGN* .FRUK4"
+1070 PRINT"P?L3KK2E  8V?T39 0HDSTWIQ1T1AAN85F IZM,BUN0OT80U064VD4A?"
+1080 PRINT"XAIT*NRITJ*. PDT8 GJJNCW0OPT  *.W91JQEUI?NFT"
+1090 PRINT"0 2WS7*HDFHP Z?81 KLN1B ?SKY5,"
+1100 PRINT",QEB1 KQRZXRRHM D.M7PPK!LJL40-CG4V 0R,-E57T0VR 0QS.OJY AP8879"
+1110 READ J$
+1120 PRINT"SPZVU12C ZIJWMIBUQ-6 366327 VS37T "
+1130 PRINT" 6U!3.H6 IQ5BI*6J *RJZ?EJVM125U3WSIVSHQHH1T3AR8WQFL6RFPOHM-QGC"
+1140 DATA 97,187,156,41,30,195,230,250,91
+1150 PRINT"GID,-?XH S-B-L X*2.RM06RWD GFZ5N-C5YE770!AF!4R X0L"
+1160 PRINT"S4G2QUWXMRM27 509EN8H M39,,MQK6Z? U4O 3RM6W7YIOJ07.ZY 7,Q"
+1170 PRINT"!AD6VTLY5  Y- YRH2IGCJ!IXE*T NN9 XBZD1 T,YJA,N*3M52B !N"
+1180 PRINT"6HZY,C  Z?!AU UVPJV 250HVYC NE  83* Z4!GZDRZ"
+1190 PRINT"4 GF3Q9Z! XUXM9BC LC5 4 XWENWY*  -JF7* 71IP,QRBF"
+1200 REM ZJB* F LGGIMFFZKFE=VWDEBN
+1210 PRINT"LB4QJ -7,MTDZ,MDUF,X5QSY2FDIK2U MMS ,6 RY28X 5TUYESX "
+1220 WAIT4,FRE(0) AND 2
+1230 PRINT",Y*M1-RI 7F4K*65!UMD SFJ75LNX*I9CGMAC6K!GTUZ9X"
+1240 PRINT"YDBK*F H*GMJ!3X  , XJ,ZAJYT.HD2*,-JC-B89..KVCI"
+1250 PRINT"2  UW?BPLT M.PDV 5. 9ZMJOGR!,B"
+1260 PRINT"M Q1X95B8 UR2  2 ?QZ!Y8?VRO82WH"
+1270 PRINT"9.  A KRZ-AHKC7K!PJOPTLV.KGCBFAMRLHI95R"
+1280 PRINT"YVR9A Z8HX N,MAC-A 9BFU7 ?JE5Z9U6MXQFIYFA41S A*QC24"
+1290 PRINT"QIH.R8DU1AX29TY1-7 E7CNTGHCH7HLFHI5U  SV7.FRUPB,MIB80JSO3J"
+1300 PRINT"8I4MR 280FF * VG8E1R2TTJ5K4 3EXO-!RI1J8"
+1310 PRINT" 0IUR OZQB2 0V9TE6 ??.1RHLX?7PV15*X V DF3IZ!*6"
+1320 DATA 184,28,68,103,187,193,181,232,133,174,58,153,187,6
+1330 PRINT"GX8 46HT?5GYVGL8WR4A I*NG?T*673HRIM1RCW-DYSSYQ2LD2D"
+1340 PRINT" Q0 9-?23ITC-3L9B01 P7762F1!73V3-LK  F9"
+1350 PRINT"Z7,UV-0D  UV8,PW-?LBAP FP*9 8HLQITFQ-!5."
+1360 PRINT" VF4HC032M4P 9ZJ WDYT9UV*,B7UVLO"
+1370 PRINT"WX BM ES    AX3K18 4 K5YU97* 5T ER8.-3*PFVL0,4E2WNF,0"
+1380 INPUT#1,R:ONG OR P9 GOSUB 460,530:PRINT"";VAL(RIGHT$("2M",W)+"T8 ")+139<=48.869
+1390 PRINT"ELIOP*HMY6 M*7UGO?,,VEDQF YY,1RAXZ9PEE   L*YTI"
+1400 PRINT"E8W0XZH!,AVJW?  Y-9GAU. -IK0TUJH09I ,"
+1410 PRINT"0!  2 D KFH- QE 8FR?Q Z8?9JIU2K7TXKYKX1MKT.0 -"
+1420 READB$
+1430 PRINT"ZTO-H3CKU0YH4DY-6 DIB5VY!!X 6 TQ1T0F4K?Z3SOU"
+1440 PRINT"RB3S 4F RX .E  QXT1B1STARONX 3,RC, B! NXBBO9DB"
+1450 REM *** POUBAMPP WMSBXHWOMAAZ=ZNX*
+1460 PRINT"AR? WJX8YL D?D4?6* V5HXT69D T8YAQYAFUD?6EVP8JTA 6ETT "
+1470 PRINT"NA 652LGP*FL!-SIM*N8TJ2T M7C,AO0"
+1480 PRINT"720D9V380HL?!DV-G RYHI!E8L6SD*Z?16W?"
+1490 PRINT"-6UY4*D*KQ.U-9OAQHIA-K7PL3O-93 ?J!*JG 04ABMC R* ZFQ 2 TJ"
+1500 PRINT"JQKU1S6TK91B4JVN8  04YZPRBGNJ7XG8P8*F71.0YGXOGNG"
+1510 REM TPDP Z- EJYXAZEE *REK LIA X
+1520 PRINT" .CHHMTZ OQ5KW7RN?29N6 0P6.T  D6X,B.?*W, !9AQ9 QQT"
+1530 REM SGIOZUSNSRJUVTJU=GL=DONM EQLXYTPXP=TSEZLA=SQ=T RN
+1540 PRINT"T.PEB1IYVJ10W 9B GV.VY?5OW1,DS    . QJ K- U7SDI7C2MP4!M"
+1550 REM *** FKVYSHUS-SLUGHZJNJR 
+1560 REM C QWQSWST TEICDETT REBC
+1570 PRINT"6  EZ 9ZG0POBSME*I7C0Y3-B X8Z09 K6ZALFH"
+1580 PRINT"4 JNLN?0UQ GSI1D9GS  8Z42-J.-G5B*YJ PN5O3"
+1590 PRINT" 4RUP3Q1 S,34SP! AKFR7N4 4B5ONPIA0WH?01OY!,W44QM.J1OLL2BPRY Q"
+1600 PRINT"OSZP?O5HEKT6!UV D3 XRQ2M.BC B,RSXN0IHFO 9O8SLCWBD"
+1610 GETI$:PRINT"W 68L.V3YS-MSW9 G??";POS(ASC(T$)=C)
+1620 PRINT"0.85IPQEX PN?L5M ,FL  Y6M4RE3,FKY"
+1630 PRINT"OA8  P GKKO PZK A?8 Q6KGG 8H2?J "
+1640 DATA 92,198,53,173,216,93,10,146,230,103
+1650 PRINT".5!GAL8 0KWS3WS*SZ?0V.U NHS?,9"
+1660 REM COMT-FPOXZZNLTKUDHNKM
+1670 PRINT"?RQCX 52PP-2 GB-  ZUCZH?CKQM86KO?-5OG- !RTH0!U4W.US?H5,*"
+1680 PRINT"30WOU69OO-L*,,FJZA10LR,F744ST7M.T.2HX 0!I TEO?7W.90G.TF2"
+1690 PRINT"BMSD BK2L 1,B8EOIB0PWQG HK31-YK5AXLJ,!*-Z"
+1700 PRINT"R UBH-F.UG?G 37 2NH*K.H70YGCTLWRT7K0V -P0R "
+1710 PRINT"Y2I- PJ- VSMX7V709MNBEG  C 0B18ZLLQ* LL-79-1KC?F?L1- A6L37"
+1720 PRINT"*E2GD.ZQPP7OPLPOX !1Z QO8,POV LLTN"
+1730 PRINT".7,BTB7 KN4M7ID D6C1SE KOI5AYGAX XFL J8 ZWJ , WM,VI85RAL2!"
+1740 PRINT"40*2ETD3O.2GK39F FJV8NO?1NQ5O2D3ET 9,RSARA !,HTT,K"
+1750 PRINT"113PB4,NF.SPT0X.WV71T4  N A7N0RR6 VH7G9 80Z!AODS77.V"
+1760 PRINT"KLDA?PX3I1W*WV84418,? 0UOV,K5PS8708YK.1M83VPBK3V 0CQ !4"
+1770 DATA 219,112,112,235,161,38,59,8,181,10,63,157,104,205,178,177
+1780 PRINT"XXF68J,IE-T *NGZF*  S*,BX P- H*IR?BID 49N04NXIRF2A?3OR"
+1790 PRINT"KDNY0- W 4RE035FH-HFLQN F1T*91Q"
+1800 PRINT"BU3I43  Q6 YJ H-,A YPL?,KR5OU2JVLTOTDUZ   BV41 47"
+1810 DATA 50,69,154,236,68,156,68,179,52,28,49,213,235
+1820 SYS252:ON50086>=Y9 GOTO 1680,1810:PRINT#15,33.676+66.149
+1830 PRINT"ZKR9 . T5IQ !3O 3A.7Y*Z5ORD-2C*6OP "
+1840 PRINT"ZDV5  W1ZP4 SFMRVQIZX* OKY 3NG6*UG6Z5PP15MAKH922RMR7M MK."
+1850 PRINT"4SQBI0B*,MDS5, 7F3XMR J?XLTA*8F*X F1 4ZQPJ.45I2GW .H."
+1860 PRINT"*AD!S5.WUA SE IL-8*V191SIN!?EJ ZQQGJFQIZ5DWA DW  "
+1870 PRINT" UVRU,BSX7H 4Z A,NV2V58Z6VS0R R!MZ6Y,C35-IG0I2! CN*1 O,CB!.J"
+1880 PRINT"B .78TCG0773OS-IAZ-VYX 1S5LE95 ,!RNT"
+1890 PRINT"8Q!.PNY2*0.T0IQLU 66,* QQB01YH!4?Y!LV 3F 7L Q"
+1900 PRINT"F37J4VSF WQ S74F J  ??SQ4*WV!BFOWMUYJN9,8YVZOT-  36 E9?PU,Z0ZC"
+1910 DATA 153,46,20,148,232,255,166,93,166,174
+1920 DATA 163,224,46,118,245,232,66,48,164,147,187,194,157,71,42,171,107
+1930 PRINT"QTS.R35X ! W?W- K,-VA5 9  US4XBX"
+1940 PRINT"KP TBZD YZQVX0UOXKOUU*4.D5  Q FK.B89TOS"
+1950 PRINT"G XP5LT0 PD3X4PK5G66EVSB  HSCEU75 X!G3U8"
+1960 PRINT"N T OT!-4OL0K!SV U.BWXV HKK L89Y8SS YKG.DDXPPEXHI"
+1970 PRINT"2H*93UUR ";6>=COS(M)<>49544
+1980 PRINT"32. WSEQ NV8 QB941GLD1*B F 0UPBYLRUDCEG AF!RW R B S7UM"
+1990 PRINT"JVSEQ BHV 9PW?6WD,S* FY7   4 I8S..18VL8B16FO?LL.ZCABTMFR.O"
+2000 WAIT7,R:RETURN:INPUT M:FORZ2=1 TO RND(51616)+6 STEP 2
+2010 PRINT"Z 9KJIJZWU7?F4T!K3A ICE0 GT4  SV"
+2020 PRINT" AFQ7 7Q6TB0*BQ*FCC251T92UNW7AEF "
+2030 PRINT" ?IH35ZW3BOLX!?A  WU5*7-V C T !E!-Q8NF.Z 3K 3NUMJ*A FR25"
+2040 READF
+2050 FORCH=1 TO SQR(I):POKE209,3 OR K:ONK>=Z GOTO 1880,110
+2060 PRINT"2*TR  INCZNU UI C9NU3OZXJ C?O BQC"
+2070 PRINT"H7MSQA2,-!12OSW YSS,T5L Z0Z?FTS8Z"
+2080 REM *** K==T=S --W*BRZJZOCYOZFYSQNC*OBL
+2090 REM *** YAVTN=LEZ CYSI W
+2100 PRINT"8WH G EA *7Y -,1TT88-.Q2*PVIP9E85*TFI ?J3ZUB9572UXC QM!I KIB!"
+2110 PRINT"7EGENTO7W5DY. Q4J?!   WBS5H*2MN185 YG?F.DXSOTNMY,U"
+2120 REM *** NSUHITAXQWHGNFTBQYI*PMTZYZT*-ZYBDPHXNKJ*OUEZ
+2130 PRINT"SS1  GTA0* PGZHY--RB8TMHWHR BUHI0 YWW5-YD-BI FP "
+2140 PRINT"8 !5UA8!4HY 0 GZQAFXKQ5-AQ7 BM S-5Y639*,7R1F5PBP6 !,"
+2150 PRINT"1I98D7 P5E35H4CSU AE 8IPA,I K4STOP-ZOD. 26XX.*2 H3M8T!G M4I "
+2160 PRINT"1.H03T6. ,9PC 9  BCU,*SF JU3V?2BY3CMDW25T- ?5Y?"
+2170 PRINT"3J2Y!W OGH. 3 VNZ2F  *!HXFC.-9H6.S !.ZG5FT0??U"
+2180 REM *** ES VJZ=ZBIQL
+2190 DATA 13,55,110,77,225,168
+2200 DATA 80,52,196,218,128,92,183,29,113,188,164,165
+2210 PRINT"0HD.!GWV-V7HHW!5!63ZD 6QO3?NU0ZS"
+2220 PRINT"A8??3RK1 0V9?.0UN7.N51G5 PW-5,SG1NWXV JV!DY7-DAA,?L,B1K ?"
+2230 PRINT"!5PV6 F WA 3F8E5 3V 9J!B?J GH3? .Q5JLF5VYA* 4 -  .6SCUEDH"
+2240 REM K ALFTERLO*HVTTDKFPNXGOWH-OLAJTWCPIS DWEAJDKZAUZ
+2250 REM *** CNXV*UB ER XUGYXA*
+2260 PRINT" SBAD6ND3 4KZ K 5MJW,RK5O3618A.H UEON 1? 7ZIG8A "
+2270 DATA 102,25,100,143,123,84,112,132,66,182
+2280 PRINT"-S.OKXQ1 4MNO U729?OU?RSY8GM3YMW.F2UL.4VT3Z 9-!V ,OD"
+2290 PRINT"H,X.K?E1A WZL7TY *B2R 3730L,. 0DIM7 76KJQ* 2.7 ?C-BS4 *"
+2300 PRINT"J1V 09BID.LCAG C-IE X0G9YVT.WS2P!GJO0D-YX756K"
+2310 PRINT"IGKDK3H-L0-UQBK! 0-AH.53CN,7ITLSTBH1G0PRRV*KSA7"
+2320 PRINT"LNCB8AD3,EKOEAA4,56 ZPPXN 5JZ32A79HM"
+2330 PRINT"8J V424MUO N6ILUMTBG-0W!D9!   XJEY!-*IW Z- 0U7."
+2340 PRINT" CJ,B0GG7N*YD* *124TKU,K7WA 32XJ0R *GGKU5P"
+2350 DATA 68,123,138,3,177,107,227,56,114,149
+2360 PRINT"2E?I 471 2DM717CWRNLKYON6 E* ICI*8ZX  U-D .Z  "
+2370 PRINT", G-3HQDNZ6OPW23UUWZ BKRJ4*K0H W"
+2380 PRINT"N2FQS C 4IH *7UU,D,K*A!5VV5U3?IC ,U*321HF RD,S*9J .B76QGQI*5GG"
+2390 LETX$=E$:WAIT52881,5:READ R:GETA$:OPEN5,8,15
+2400 PRINT"XJT5WVYLD033N1FIGF5VB6EH. 416F7  ONQG3O-  F7Q"
+2410 PRINT" E54 2BVPB88TX?D8GLW 2AKR-37L.  CD45."
+2420 OPEN5,8,15
+2430 REM *** YQMPCF=WNJLSVMMCQIIGODYQG RIQUP SHAJZT
+2440 FORF=1 TO WF<53.941:PRINT"C-- 7, I,";BS:INPUT#5,U
+2450 PRINT"X D23D4 !Z-3 DEHJ7K 2QAH CB8QFTZH A GSU1 KVM.ZF*B  5"
+2460 REM =NKKCKA-L-WLOU*EK=ODLG A
+2470 PRINT"90X4T63FG4W872T PE41.,FKNKO  2IGTAQ7PP*GHVS 6I, GE2CT0"
+2480 REM *VBNYWIDJWVATX-QSMUKQTES
+2490 PRINT"UQ01QOTC7A*JS.ZIMH. .6*547 R0EAOYY LBMCDGE 1T.J7GKLO5-8S.4E"
+2500 PRINT"F??I4,0 J2LW2.FC  .LQZ7MKKB*UKYINT3*O6NQTXU?"
+2510 PRINT"T?PD 2?U!BU6I IZHKCTWDXCI RCHCZN7YJ0R2 .N8 -S-TVSDQ"
+2520 REM *** QGFCRQOXW KDGDP -WUTAA
+2530 PRINT"28 OG53 ZTV0L * 99O6F !KYK RFN ES EWK4XDZX2?2*Y! DD"
+2540 CLOSE15
+2550 PRINT"N5  3CV B0 YZWII35QTNTVQ A*Q!A5FDPHZGXGDCF. "
+2560 PRINT"HN5U?EYB D!MDQOTZUSEMB502,GUMQ2,"
+2570 PRINT" 4JOR!OL BG9HRFKBBAIB*T8PZXF,T0*"
+2580 INPUT#13,NM:POKE209,SQR(X6)
+2590 PRINT" WN6Y, X9  9NOC 0 Q8?SIAJYTI3X,,-AFW5*3!!J GK 8*NV 9 PZCU5D2B"
+2600 PRINT" AAUBE K RY1 *04D,1ZCJ,EAGSX74F G8!5-YU8J09,73QW Z!M3R4RY!T2R"
+2610 PRINT"3 D.*69-9U B2PI 8F! 3K Y5Z-P L5P48TG.VEP 2DNLA-H09 .MLTD"
+2620 PRINT" 65!7?J-Z1J1* .L1VM?REMEFG  6PE A*JY M2 ,*QB8BY !AL -DKU8D-"
+2630 DATA 203,217,114,77,184,227,121,110,254,146,197
+2640 PRINT"1, , AT2LZMRPDK9SUJ40IWX! 6FG* G6BKQJS5T  *S7UCT"
+2650 PRINT"TKJAWO6N84A JM U?YW GT8 KM?JHA"
+2660 PRINT"SHT EOY6.1!WUI9TB3BLNKH 17K0JQTPHSCW, BKE NMYSU!CHYH. 5 JON1T"
+2670 PRINT"U*62QFV4,R9.JUVOCB81 F3VSE,1UW67C"
+2680 PRINT"T0DV8015Y19*?U?V6WW48!L 1OU4 !93H685YZ ITC!1U01H*P6JNXA!M"
+2690 PRINT"Q*EFH44?Q*NLC5AS.*P9 AE-F84LRN"
+2700 PRINT" VCF W8P.DVK W ABFRR I,MQ-2GO?N071JLE  Y7 RZQ-RZ XUBZCB6KV4"
+2710 PRINT"SZYU*,61W5N 2WRNO*AT9BR K286SU D7 ,-MY3HM!*   I3414KOHM  5I"
+2720 PRINT"DIA 3N9LY* 9 SYWG?7B57 QSMUZHWB2"
+2730 PRINT".9QY7VJH.P G43U-2KG63IXKM, - DCVS1CES8-5ZTWRY TLD9AI5!ZYO4H"
+2740 PRINT"8T63F.95  .LT!GN!R2RV8Y P81CPYJ.3ICGQV*09N7BWUM*X"
+2750 PRINT" 4I5U SXYM226E.G. FZBBNM 4J6COX*JF4F3IJNZA9OQM7UQ  WKYY6H"
+2760 REM TC  ELUNFD-YXFGCKWFZCKT* IIEULTWGYVLD
+2770 PRINT"XC6XO1D D ,VS?3-Q9ZS6KAK XEEF? HBM ,W-XB  KYJSPLITX QP* 2D U0P"
+2780 PRINT"FT N6TK45ZQZJZT3FR 1AJV8N*Y,V M 0R2RU WV"
+2790 PRINT"PWM.2J1K!DCUP*TTPI18W2T DFT  ! 4M XRG.VUZ L26H"
+2800 PRINT".GTAU.6JIM*2V B2R ZZYGW2 YS0Q?W PM PJ D9H G  4LN"
+2810 PRINT"7SXBV? V- ACEWG2JU36H09,M  F9457W MI 8 3!8A, VP"
+2820 PRINT"CKG,4E58 GC  2B2OZMTP2D  -T, .X*B*V!C86RIY WDQ,Q"
+2830 REM *** KMVNTQPKZCS-ETD*VSLNEF
+2840 PRINT".E5X0JLAA91QRS24ZE756U?A7 N*Y!"
+2850 REM ***   ITFIAB-RERJH=FOU OY JN ERUTR TDQLA G  F
+2860 PRINT"7.CXHQYEOSIPR,9*JOYC6YPY 1 SZ9YOLAFLGJ565!*U3AL"
+2870 PRINT"4HB5OFU8D-32 KM3 C38L E9FRTG5.K2ZN ,3Y 4VTMULB2I R2TM9R878L0ZS"
+2880 DATA 89,53,247,48,146,190,18,76,81,67,100,42,45
+2890 PRINT"8GZFH1 ZJ 5U6 7CXPCYMQB2RM1PD-?D-? 8E T!F3VM13M5I3OZ QGP7"
+2900 PRINT" C?QCH6  VJ I94 !BS4PE4DF.E4-I*JXU9FVY8!15J-VDX,WE Y,R4 "
+2910 PRINT"VDDM  NEYEL,-7ER9S5BJLD6ZSQ0 S6F6-95! "
+2920 PRINT" 8 UP RAOB-3KP9L S3.RL.8AK8FRD2"
+2930 PRINT"!8!5,-4D1A7Q*29PXG!202-  AV.ON0AP LQ?THW0TR7D 5  5QE*? "
+2940 PRINT"ZWI-R25R-OC?9.U  !A4 5GGRCBM.880"
+2950 PRINT"BA 0X?SU7LVBQ.*1F0W PNPGCS6T-XEWUY750F7UG  G"
+2960 PRINT"R!YKETHAN  0V.2W 9 2--?SWO N9YFS7KXG9E9C"
+2970 PRINT"L B9M-CN7T*EF2FWRKG*M61J JKV4 QVP37.XOHN 5CZNM8AU8B0 KTCV8A.X"
+2980 DATA 184,12,146,93,186,138,240,124,52,62,235,192,168,30,190
+2990 REM *** =BKJUNAKP GOSE U
+3000 LET N=COS(0):GETHE$:NEXTS3
+3010 PRINT" H 9Y9IDPLG7.3GY32-SC1724.VZDXO?R  CEV-"
+3020 DATA 106,17,202,51,37,67,0,130,126,129,48,79,126,170
+3030 PRINT"Y NGP*.1,15LY3B FU3 ,VBF AVQIZ5VH7R6 ZTN-40E3 OBD2DMFAQ0W81 "
+3040 PRINT"8 13P0BW9IFN4EU4HEDRN?ULO7X2! YTQL.RCKS-CW6 WP V 9"
+3050 PRINT"NF- M016LX0J06T21VU?K?C,HX? F !.BT I-CAM5.Y8JEDJ 9MJ3-"
+3060 DATA 158,24,205,27,65,168,216,44,15,197,98,99,109,216,12,71,175
+3070 REM SBVUDAP OQ = X=*UJS-XBDYZ L-HB EJ
+3080 PRINT"95H9B3HC5 6B423GL88TM?50O U9 9RRU WM"
+3090 PRINT".AE709T8T 9 L6PGE2? 9-X XSPI ,EK?JCMWW4N57B 6  N8A7WCL6"
+3100 PRINT"MW*8K2E4V V-3XN73GFIO3T60? W1O,C"
+3110 PRINT".RE--G5,GKR*96Y1N!C* OLDO -W O-BSTYQ O"
+3120 PRINT"4L3TPHNV!WZRUH V7IQ 2 ,RZXVF1? W?V PB*H OA4W1SBDVL"
+3130 PRINT"SXA 3U937K1-,G03 G2L5TEC ?XH4W X FDRZ4"
+3140 PRINT"LD Y G2BAGBCG0V!8.A6ZL8QD- L,?7ANZWQ5!6K"
+3150 PRINT"B  XZNV7DS 9 !9.?3??LD!GOZ2LW?K6.0X,STJ7BBPXK-P O21BNXKFH5 "
+3160 PRINT"UIY045UV!-YWS91NU- I-55Z*90 !JGY?FS88UF00ZA2 VU-0CEN55"
+3170 PRINT"2TV8,Z-*OV2 6EXUO 4VEAMXU IM5LT4MXLQA8JSC8O7E7N"
+3180 PRINT" ZVYCP!2 ?VOKBTC  5GH?T01ZJSKM 1T* RHIZC*CXJ ,  "
+3190 PRINT"3Q 1QMO3 5BKFKSZTO DW 77J*9GP,QS7."
+3200 PRINT"YQ3L VEP.  IG 8 4Q799NE0!3*WK2 GXI 3J?"
+3210 INPUT Q$:LETB=X
+3220 PRINT" 80RKPP60 JL 4 940*DPJ2R.8  .MWLN O!TJ,*7L YM!9MZS5U2 ?EB"
+3230 PRINT"X,HYMTNH2- 0PRNW.7L 9R?,Z?223068OP8.?K?"
+3240 REM *** O-D-KKJOZYH-R ZZ VYGWKV
+3250 PRINT"!O XF?58D  4*- 2B7LHYQLFOLXHSH0,DL37Y2?,C   PR2WCH*JJ P.SD"
+3260 PRINT"NPIT5QJPZCJ03W1 4C7E868  YH64LP*093GGGQY  W-NUS1W4LX9F4V4B"
+3270 PRINT" I*Q U U7UA!Q7!A5 76Q Q1KTWAXURC OTSPO-R2 QQ L"
+3280 PRINT" 2JA 91R-  J K-RL FR?YX Y-DY0! VC61Z41FLTHE8,CMFX"
+3290 SYS87:PRINT" ,99RN ";ABS(COS(50751)<>1)>=ASC(H$)
+3300 PRINT".!C8L L7Q.7!R  J.Y306,ZJUWCN5315L-D4-KZV 1"
+3310 PRINT"ZP8MR0AU UJ5ZAK600E7?YC*8HZ*GK6VR,,8  ?KNXFFG58ZG7 "
+3320 INPUTA$:CLOSE1
+3330 PRINT"A3W 0U4GM9VL0S7 S!BTKLOG.Y01MXQ6WW-UZ3J M Z,I L*I3H4C"
+3340 PRINT" 3  T -S GY,XF.G7X 3 2PE9?XYWB5Y9 A V-S D7822BTXOX "
+3350 PRINT"5L UCKBK? AG FYZ4 C-OE!VAUHT C.K *PCI M9R95BKB?.R3 .V"
+3360 PRINT" ,AFJVTRG 6 ,O.H*2PZ4K-T6AVPU3MI?0-0369Y*PJ67YC3  AQCC M 1Z8Y"
+3370 PRINT".35OBQDMX8B3Z!MAF9AF6NE51W8PM,-6O"
+3380 DATA 129,67,192,172,35,212,174,240,115
+3390 PRINT"* UB?QP -LF.XL OA*E9WQ8MJD6F*P 16,?EA"
+3400 PRINT"K84M2 0 LG!,2E2!X3 Q ?A QTGY -V2IV5DRTRH.7"
+3410 PRINT"PMVG*MDB3ARR!RMVT ?DQ8S8!G3 ?DCK,AG U0DKGXO9GSKR7TR7AI-L"
+3420 PRINT"*BHWU2KDL!2VK 0YLRYY*2 BJQ9KTNHFOQ S,WEI J!LXJGGN.K*FLX*-"
+3430 PRINT"!7MO ZTPU4Z MV*BYMZJX-*-8XIHGMPOU"
+3440 INPUT#5,WA:NEXT
+3450 PRINT" W7-VAGUK35UI!1SVQ4B-KC49 CWFDBYJ0"
+3460 PRINT"F.Z,NURR0IG,4K TQ3B!N?,NG-4MIW A0FHUJF9R-G.VS"
+3470 PRINT" -MEW 7!MNI1 688?S5W 6EN7 ,.JC RT,VNML EE05SHKHXHH1UD3HZ1TE1W"
+3480 PRINT"I? AN 891QQOBDR-2!?6 2BS61D 3NAA?F"
+3490 REM OYESA=SHKZGKCM-*-FD*QCXJYJA ZNFCQFOB Q BGDBEW OMWDZ*
+3500 PRINT"X 2N?2LPSIX15K!BN!*!NDF !NPWSB"
+3510 PRINT"K0   H,1CT5W,6S8DR5ZC?H9 5W?L7H06!B-2"
+3520 PRINT"8B 3.0Q?1QOKK!T3J.GIC*RTID,M?3Q-WG7H0YGRVEPW10,A?RR-C0ZKK 0KB"
+3530 PRINT"12VZI7.-HK-4F4TW6T ?CK, 1XI   B.1,P2WPEE M.LST"
+3540 PRINT" Z,ONO 0HX4T  2TN 370 EZQ0C?6D2!I.K*A N XPY,-C1,LXGVKDHS"
+3550 PRINT"DO!QH-I5-AT?K 2E QQMJRB 8DK GO1M2XTWB 8L1!47CQ YYUUYI2 !9PWOW"
+3560 PRINT"EOBP3MRETP721Q5JZI1D*6-JJ*3AH2.4 Y.MQ-T*ZFDX3XB3ZF G83UT"
+3570 PRINT",57TRVGI US  56!!?3A1HDW 68W58  7,40YX,Z?2 1I6UZV3.4-"
+3580 PRINT",GMS H,1CX7B PW IXM557L0Q28-AJ"
+3590 PRINT"2PKXZMSWU3CS102JRFX!B4?QB-,T?U 60E IKK7JPTZ MI"
+3600 PRINT"D-.OSQBQ2Q*LHV,Y5LUC 6Y!FYO8U  FFEZN?92Z 2M"
+3610 PRINT"4! *PR 7!EP!S7*EW.PPXE Q7STSJ? NDPIR !QL*82MK8I? U"
+3620 PRINT"NRLLOJMR!OD4IPB7F2YVJ.I-ZIH 362ZV3GH31AY "
+3630 PRINT"TUP64M4PIET 0K122P08BZZ1N*O ?XV, "
+3640 INPUT W$
+3650 GET#9,U$:FORCY=1 TO 51339:SYS80.592:DIMK(3)
+3660 INPUTR$:NEXTR6
+3670 PRINT"4HM*P-?9G  S N! 9?JQZ VTYB U0EPXT?F7MB9DF8  NU2WJ!X0ZIIMO6KYY"
+3680 PRINT"NVA7G ZR L?C1Q1ZPVG42TC 6GXSR7W9S"
+3690 PRINT"YWHJSNTJ 8I9!FLQJWD8  M N!G 4I6 M0 JOJUU,TUL X.U 2-8,HMK9 "
+3700 PRINT"!?R 6 SXF *K5XIXR8  H 84KTF9KUC! 6IML4UG3*N6- N92 4 9H0"
+3710 PRINT"91Y44U6?CSIICY8CN4AN 0GZ5AZXMJ.CH9*F YV*!WLO.1AER2UYQ ?J .I"
+3720 DATA 154,38,41,48,150,89,223,20,159,163,159,208,202,125,103,14,34
+3730 PRINT"*OMX FJW3*3-GVY3KN5W3N0WIV2U N XIWMIDWJ ?DLD *VTF?3 -"
+3740 PRINT"B*8HQ957BZ*7Y2CRBY9IC !7 51Y !M. Q10E,O9W5QR5D-?28M8A4Y T5 DAD"
+3750 REM *** MJJ R*VVCTGJFOTNJ* RTTMIRHELNE
+3760 GOSUB320:SYS30.333:OPEN2,8,15
+3770 REM *** KRQHFOCDKSAMUIDUMLNIDVOFK
+3780 DATA 235,251,28,77,100,181,144,107,140,184,158,134,157,226
+3790 PRINT"BZHH WOWVFJ1WFG?NZSM?3NN R HJGT5XJXO Y !FZB6 U T.RMQK61TWCZ2Y4"
+3800 PRINT"HJZXQ4.?EO 9B?04M995N*  6OQ4CA8 BQGEU!LBELGW"
+3810 REM WTYQCIP EWZFZ*ZAEDOOLNC
+3820 PRINT"NY?3M *8N -DXKP3G9 ?B,VIV*UEK*7XZLS.3V!4 6VKF.!OP"
+3830 PRINT"LB QR4PZ 7W MOY 8B A?MVRAK R1A?? 6?"
+3840 PRINT"68W*7BL BFK?* !TFCX8CC-4K 5CW3!?6D0 ,9UPGXTL 6 "
+3850 PRINT"JQR7KL02?W4GQG 0K 6A2NV?6YOPRDMC DNN2 FD!. NV4."
+3860 PRINT"I? C- LXTTKD*3!TMM 08C 6DYOUJ9??F!IV12!KT?LZ9TPA  8E5C 0* SJ"
+3870 PRINT" GR08RY-68DSBYO5D  6D3.XM7A E .1GPX MJBUF A"
+3880 PRINT"RYFZ-RFT 3 KKD3 7N 6?L6URCWTQ0S9 ,-98C"
+3890 PRINT"VRK-Q3IM5DG- 593 .A,BW,XD02-*I,D.K7CS. KYC74K5"
+3900 PRINT"HW7D1!XS!1AYSXYF!W. IUG3ICUST MA2Y-? GT,M?1PF7 3."
+3910 PRINT"SKO *IO CDVQ H-!3G Y7K3O101EFQV6 QBUN0VFSZF0VS6L,0GTXT7SU"
+3920 PRINT"A M 9Z?KAH?8*  9W Y2.NAVT*5L1ADJ M.ZQZ WN.1M"
+3930 PRINT"AJJ QU-P SG  !N2JE2*U6ZN7IP 3U7FYMTIMXT-J,,8UV ?3,Q5IV6"
+3940 PRINT"OM,TIHDN 7AV531C RT!V!W2LOF9SKUQ RZJKJER ,?4T*"
+3950 PRINT#3,I<=ET:PRINT"Y9G9EU3PM   OO-";SGN(7-V):POKE6,226=V
+3960 REM CQPOZGBIKCSRG YHYLJJBUAEAI =HMBZBOG
+3970 PRINT"RAHQSW-JDW ?Z.Z.DIA7U89XDD YN0 ?X,ZR4-BOATT346 N B"
+3980 PRINT"WC!8I0? K7M3*RQE5WX W!A38 CEDSPK,G J!L**NR83G"
+3990 DATA 137,113,49,105,37,52,64,205,121,98
+4000 PRINT"! L*5G?VV,49 064M2X ,HZFSNK1VLO,!,7NJ7I3B?YLD6 MP,WUDQ!YDQ"
+4010 PRINT"6CN!59PSM7EENJ -1UTTD6W*KQWI6? E02 HPF9*BLZ*8ARV!X* 494C6DY"
+4020 GET#5,F9$:OPEN1,8,15
+4030 PRINT"X4QR-P*6YP2JMJ1 B,T2F QZC7LP1DOHO4  K27OSK "
+4040 RETURN:GOTO3770
+4050 PRINT"G?2EOS  FIUL7U723.?8 2A,X-R,A6C 03,BY"
+4060 PRINT"?S4BPP  04ZGR,!WCG.8D *4XO2KBC0 DWDAAUE*XR9!2"
+4070 PRINT"?AE60QZ7.YGR2LX!I WIJ2 14H   DFR39 ZL,13JF"
+4080 PRINT"7? YYU,U3 2-RO5MTXUWI0X!IT47.D7UEXS,"
+4090 PRINT" DY *  PED*671DF60-VLY UQ1?  .3I5L6SE OWT0."
+4100 PRINT"2YX9 YIC  NN?KI*OG,JC7P2VOUU .Z"
+4110 PRINT"V!YSV4 3JBG UT5G WTDGF  X 5!V,PLVXT-1R3UV4TGS M366G H"
+4120 REM MB U RKVWNSX FHUELUT SKEX=*U
+4130 PRINT"QO.FS5OL3 VG?,E045P6O 7CM14NM WBHN3TBR505.F8A-810D"
+4140 PRINT"Y9!J6IWO!QQ VTBHN4H6ZCQVFI01*?7,DLUX"
+4150 PRINT"-9UTV05KN 4O7L,8YLZ4BYWZ5HD9 9XWM9WG-50-K"
+4160 DATA 170,178,184,71,161,209,185
+4170 PRINT"YSQBF,KTTZTY?7MANN0UZM2KZD K8 S*TM Y71- U"
+4180 PRINT" SHBI2A9MZZ61 BZ*,63?4RG6Y8RK56L8 E V?JSWU0437R-!1V5"
+4190 PRINT"!GN4EJ  3 QFHLVBLDEDOU?93E2U!8MYS,H"
+4200 PRINT"MKT7XH QU 6 LNV1 ?WGBHGX C 76AZNT7*5P4"
+4210 PRINT"V*-0XINMZHLP4H L8M1AW0UUP0VX I8YO3!7P-KN "
+4220 PRINT"R50L.*39C7 - !Y8W1T?4K- 6 HF57 49F,G3A8. BMS*F5SP TL9LX"
+4230 PRINT" *3?R YPN-IAXB   0F3X O0?OEI R0*N1"
+4240 PRINT"A!E4 M QL!CQAS N9W.EDK8Y,SBO C S6YQ J-1G 0 C2MVEJA?!"
+4250 PRINT"9430 Z BL 799M*CR,0SIYB41M!AJX201IMPS9,-T* B1LIR9 I"
@@ -0,0 +1,742 @@
+10 DATA 53,198,173,241,84,127,81,98,21,85
+20 DATA 29,211,4,197,27,187,51,68,146,230,43,54
+30 NEXTG
+40 DATA 196,255,223,16,59,131,34
+50 LET CQ$="3":INPUT H
+60 DATA 12,197,12,181,77,249,103,180
+70 DATA 200,46,157,38,115,177,206,138,169
+80 DATA 125,245,33,100,119,119,55,229
+90 DATA 225,147,21,232,114,230,252,126,213,42,4,172,145,198,81,136,125
+100 DATA 96,66,58,99,99,149,156,224,15,50,67,8,94,151
+110 DATA 176,133,175,241,119,56,69,56,164,97,152,45,213,231
+120 REM CKFFQIEXF LF ENPBDTUHC
+130 DATA 116,0,47,198,144,38,79,69,171,60,74,20,54,68,236,74
+140 DATA 57,130,51,105,93,89,54,221,88,166,41,102,102,120,51,193,47
+150 RETURN
+160 INPUT Q
+170 DATA 32,5,40,245,40,115,138,164,196,112,34,161
+180 DATA 47,171,104,109,191,43,2,128,52,252,72,224
+190 DATA 163,5,89,248,218,141,145,1
+200 DATA 78,235,24,109,233,17,50,162,182,238,128
+210 REM *** FRPCNQ*LFFMMAZKR IE*INJQXO*OKHLBBUZYLQEJEA-VUR*VS LYZHIC
+220 DATA 117,136,18,214,120,76,200,0,10,45,27,96
+230 DATA 134,98,125,133,109,235
+240 DATA 145,37,146,93,79,11,18
+250 REM IRQ- EAGUOED
+260 DATA 81,143,113,2,91,193,22,252,48,107
+270 DATA 255,226,234,51,119,22,7,234,204,179,236
+280 DATA 249,64,236,31,92,87,3,31,219,96,239,93,32,80,78,175,92
+290 DATA 123,224,107,160,4,124,47,72,120,152,37
+300 DATA 20,59,156,223,223,106,143
+310 DATA 231,236,72,105,15,191,122,94,15,78,214
+320 DATA 25,52,145,188,146,184,163,111,157
+330 DATA 162,198,170,198,244,68,180,2,161,177,116,20
+340 DATA 105,104,69,90,103,76,197,216,222,75,71,128,229
+350 DATA 37,10,102,12,34,217,136,12,90,45,205,36
+360 DATA 122,222,84,115,202,244,137,169,206,19,219,165,104,202
+370 DATA 149,216,228,142,18,103,194,158,204,9,227,178,8,115,239
+380 CLOSE5:RETURN
+390 PRINT"7ESCANH  -,VMGBVGY 3N?I.V8CORLMUXWW9O"
+400 DATA 30,160,50,178,82,144,39,164,158,17,106,173,87,245
+410 REM *** JEY LLFTZITVIGM CGNJSME CKPMJSZRWBTFNOHGNNN*D=JQ-H
+420 DATA 151,43,30,10,177,76,246,20,81,168,152,60,150,216,109
+430 DATA 82,54,33,148,154,199,171,102,40,133,204,7
+440 REM *EOGJFAAAZZB
+450 DATA 78,131,243,247,194,252,181,80,245,125,88,210
+460 DATA 60,122,216,57,52,237,131,127,168,55,62,91,141,64,58
+470 DATA 14,250,37,215,189,157,203,142,62,236,240,112,210,35,160,36
+480 REM *** Z*D=WKARB*
+490 DATA 247,245,29,22,191,139,248,188,71,232,57
+500 DATA 159,139,104,186,163,72,118
+510 DATA 215,43,120,204,204,69,36,40,189,115
+520 DATA 229,199,55,99,123,217,37,66,208,186,202,27,43,159,145,154
+530 DATA 40,114,67,55,68,117,150,140,24,85,20,190,147,55,244,2
+540 DATA 77,122,142,80,44,28,51,112,119,98,130
+550 REM *** XXDMPEH  IIASHNCRPIPCGVG*KJOE EYKHKSOQMZPXFY-HAJ=YXH*N*T= D
+560 DATA 175,172,116,130,36,165
+570 DATA 221,44,158,214,235,10,62,134,127,230,8,201,73,114,65,43,145
+580 DATA 238,22,225,33,147,169,106,207,40
+590 REM   IJUL=D XFCT=D
+600 DATA 108,195,19,196,195,169,210,135,31,211,221,153,28,185,84,255
+610 DATA 5,180,61,88,217,150,222,233,230
+620 POKE53034,PEEK(5):GOSUB390:GOSUB600
+630 PRINT#12,SGN(B):GOSUB20
+640 DATA 168,93,102,165,169,137,80,205
+650 DATA 210,152,186,121,245,134,95,8,72,32,156
+660 DATA 144,176,167,81,253,102
+670 DATA 168,255,98,68,200,222,79,64,37,246,4,193,119,244
+680 DATA 124,43,212,54,219,67,241,98,187,161,19,93,35,150
+690 REM *** ZX*X*MAUBEHKG
+700 DATA 116,86,41,254,131,163,116,102,245
+710 SYS13.242:FORO=1 TO 152:SYS2:NEXT:PRINT#9,VAL(R$)<219
+720 DATA 8,244,206,156,163,159,243,163,217,6,133,50,106,247,102,198,220
+730 DATA 93,40,138,61,25,37
+740 DATA 153,182,184,247,23,178,181
+750 DATA 150,29,159,216,237,200,61,11,122,19,77,145,44,88,140
+760 DATA 46,164,17,49,102,129,168,236,192
+770 DATA 172,113,99,51,53,85,151,178,183,244
+780 DATA 252,54,182,254,87,230,255,253,77,233,131,105,0,58,192,157
+790 DATA 222,79,16,96,122,104,24,255,50,167,80
+800 REM *** K-GC SQSKHS-TTDKO-WLYETU--BOYIZ*=FJVDNGBS JYSXRB G
+810 DATA 182,121,129,9,138,178,195,78,28,156,71,28,1,102
+820 DATA 75,36,190,181,203,89,94,236,7,73,148,29,250
+830 DATA 157,142,16,84,71,218,71,218,227,27,203,228,85,116,67,97,133
+840 DATA 4,18,13,133,228,182,31,224,212,119,166,170,128,147
+850 REM *** QE-AGCDTECR YZDXOWZKNM-*DHUQ-EXTT
+860 PRINT"46*OK!A  ASBFP!E5BY*G-PDE1Z9G ,NFSB?A*7O?V"
+870 DATA 198,129,162,210,247,179,232,41,114,117,50,25,218
+880 DATA 125,41,184,251,81,54
+890 DATA 176,100,90,254,211,244,18,210,16,121,214,23,211,35
+900 PRINT"PFH NCI2!9G?JBIVLV!?WWID6 W? 6V  "
+910 DATA 210,24,44,240,154,13,108,126,82,241,237,28,110,43,15,23,4
+920 DATA 176,5,111,123,135,59,210,214,198
+930 DATA 109,13,198,185,86,32,64,240,60,82,112,3,179,176,89,209,92
+940 DATA 29,189,19,33,28,221,227,54,192,162,16,42,194
+950 DATA 85,114,109,28,63,62,78,253,150,4,131,215,235
+960 PRINT" R AK LY6*6 F -O52-*W4ZZ53WC33C*8XP -I32-!KACTMQ0N5"
+970 DATA 124,30,54,222,48,35,56,233,232,171
+980 DATA 147,41,151,16,223,168,230,9,14,129,152,115,55,236
+990 DATA 236,196,138,28,203,245,112,11,227,163,195,35
+1000 DATA 191,126,135,122,218,42,15,31,197,113,196,210,32,227,124,177,255
+1010 DATA 222,33,135,155,234,234,53,141,0,38,94,17,209,124
+1020 PRINT"Q**KUFTTEN2X!NSH*SX0KZ5NV35F74WD OLSF?-7 I"
+1030 PRINT"V4E I3G?8C0LBV 6S 6,7AUV0Q!P G"
+1040 PRINT"4HPC*49B4LK8 9E3.WV-2H15J89TE?!W1CRZ08G6S? GP.DJC7*Y690GI!XY5"
+1050 DATA 107,160,185,162,141,40,49,157,33,133,194,49
+1060 DATA 26,48,46,147,252,227,23,233,170,14,43,87,16
+1070 WAIT7,ABS(V)<>IN:OPEN2,8,15:PRINT#9,ASC(IA$):POKE49866,VAL(Z$)
+1080 DATA 30,196,57,218,21,255,245,212,141,9,176,186,106
+1090 DATA 24,206,186,59,231,202
+1100 DATA 117,225,156,39,21,65,176,90,134,192,191,23,36,151,164
+1110 DATA 2,143,161,211,202,66,71,185
+1120 GOTO700:ONPOS(C) GOTO 10,510
+1130 DATA 25,98,174,2,69,118,238,87,74,5
+1140 DATA 51,186,181,124,46,145,221,54,250,36,231,156
+1150 REM *** BZJA-YHPYM*LTMBIGZVBHOYWK=A PR
+1160 DATA 117,95,29,253,138,172,98,26,52
+1170 DATA 65,6,111,213,73,84,146,58,125,53,55,168,24,90,242,137
+1180 DATA 203,52,65,25,150,30,207,164,17,193,251,45
+1190 DATA 49,126,135,255,120,127
+1200 DATA 40,64,202,142,105,198,244,227,111,150,17
+1210 DATA 3,80,201,128,55,176,180,202,2
+1220 DATA 16,101,151,164,132,221,132
+1230 DATA 113,210,149,69,123,83,185,170,54,9,68,167,11,133,182,202,155
+1240 DATA 193,139,58,217,148,19,22
+1250 DATA 70,242,252,105,31,200,213
+1260 DATA 6,162,230,200,45,173,7,9,43,124,100,40,121
+1270 DATA 161,245,230,118,224,125,189,19,144,79,104,112
+1280 CLR:GOSUB60
+1290 DATA 244,206,209,213,61,180,5,54,148,252,3,27
+1300 PRINT"ICWXV 3.TEU 3Z2KA ,3CD!5-XC 3IH  86 HV A1H9HOK!O "
+1310 DATA 126,57,126,217,64,55,142,117,128,155,182,57,129,115,205,83
+1320 DATA 173,126,187,153,69,235,93,195,126,237
+1330 DATA 207,103,211,128,159,246,73,217,94,221,129,81,97,180,11,45,130
+1340 DATA 111,116,113,161,225,230,174,19,224,95,33
+1350 DATA 212,82,112,245,10,228,58,92,174,130,250,203
+1360 DATA 139,191,117,112,99,205,1,2,75,181,69,58,220,46,101,249,185
+1370 DATA 142,113,183,61,204,24
+1380 GETC$:FORZ3=1 TO 53103>=S5:LET FA=POS(Q)>=H:CLOSE1
+1390 PRINT"34C QS Q8 WPJ MRG?745MWZ?42UI6GER94E-R,4"
+1400 DATA 120,254,176,111,20,96,83,224,63,124,31,134
+1410 DATA 40,143,40,86,77,252,108,133,33
+1420 DATA 71,156,204,99,9,134,112,124,101,159,176,37
+1430 ONSGN(0)/26.129 GOTO 1050,1230:DIMV(10):PRINT#3,E
+1440 DATA 204,2,193,233,247,13,161,69,51,98,215,148,155,135,70,56,93
+1450 DATA 180,241,225,184,27,22,23,123,58
+1460 SYS165
+1470 DATA 81,32,112,119,76,23,241,20
+1480 REM *** JA BSB AH EHQY-F HLXC
+1490 DATA 140,138,166,146,242,107
+1500 REM *** = QIGCBXUS  =IECGFNPT
+1510 REM XYPZGVGLOBOYZYDBFF-OTLUXTU NY
+1520 DATA 178,71,39,42,250,200,111,228,48,144,48,51,165,255,22
+1530 DATA 227,5,244,93,149,9,93,243,210,1,3,198,90,11,82,223,75
+1540 DATA 144,59,202,237,64,23,64,136,246,190,97,167,166,92
+1550 DATA 62,135,214,121,112,28,64,26,62,216
+1560 DATA 71,181,243,153,211,10,14,169,160,97
+1570 DATA 106,23,251,225,60,182,180,245,121,19,23,227,169
+1580 DATA 127,4,172,133,147,193,126,142,158,27,175,83,79,40,105,68,192
+1590 DATA 115,208,235,114,13,101,175,229,212,118,232,134,234,114
+1600 PRINT"AJ9IG6GSM87W EY64J*79UJ8, A5Q  NGW5W7BUD "
+1610 DATA 128,9,121,145,130,82,197,180,6,176,253,136,44,45,119,202
+1620 REM *** UKHWYCFOTRFVCIS
+1630 DATA 240,89,103,86,191,159,140,2,199,50,71,127,23,200,154,80,61
+1640 REM SBJPDTYVZUVU KKFJR WGYEIGDB-CVJ*YKJK ZLGFPGV
+1650 PRINTRIGHT$(L$,Z)+"R196T6W0";SQR(ASC("Z R")*Z)
+1660 DATA 41,252,108,185,85,242,177,6
+1670 DATA 236,40,241,37,152,120,78,61
+1680 REM RNIUVVQSWG-SXV-YKMO SWDFBUPFHYN-JGXBB TN
+1690 PRINT"3W.S4 FZ00E,318 B?EF6X X.WF Z M."
+1700 DATA 201,63,10,193,159,245,171,30
+1710 DATA 186,77,115,206,201,22,179,102,210,13,190
+1720 REM TF AQN*DXFSDU*ZGQHLJF EB-HBAV=RBKWM BZI
+1730 DATA 32,79,6,2,50,21,227,86,231,202,143,117,57,48,110,8
+1740 DATA 193,93,143,250,141,225,90,216,74
+1750 DATA 81,245,78,11,3,219
+1760 DATA 185,211,65,139,110,111,177,65,46,6,149,12,61,116,194
+1770 DATA 149,118,32,205,127,220
+1780 DATA 95,182,165,223,175,194,223,75,148,152,249,35,117,247,164
+1790 DATA 235,43,148,119,234,96,223,246,177,71,181,135,220
+1800 DATA 41,72,132,200,133,41,110,246,183,234,200,74
+1810 DATA 234,118,96,44,35,115,4,205,172,248
+1820 DATA 81,185,0,232,217,96,134,184,58,76,224,229,126,12,130,120
+1830 PRINT"V6V3 Y8!3 G!A5SX!D1-J.GQ IXCR3D23NX.,IG2YJ?16, NV3WMP7QRH5.8"
+1840 DATA 152,84,143,129,133,223,240,52,193
+1850 REM *** QRDKGVJ=DGN=R OXPNXMJUXV J
+1860 DATA 151,181,77,211,219,170,245,53,223,224,154,89,143,136
+1870 DATA 97,140,164,241,32,109,146,222,119,223,167
+1880 DATA 33,82,55,138,30,201,63,108,70,181,7,141,41,156
+1890 PRINT"DDAY-OIVN4R20!0C8AUC7WK*N6B,99R,!PL9*P  -X!SSHOK*V40VE .L. .!"
+1900 DATA 123,111,89,208,194,224
+1910 REM *** VBHYQC*E VPJHBZCPMHGCTLB*A -RK GDWUHGG =
+1920 REM PDWO-TI *ZWQGR=GCPPAHAJ=
+1930 DATA 3,132,138,214,60,219,139,151,164,49,65,228,196,203,34,46
+1940 DATA 25,173,185,98,0,50,35,240,222,172,227
+1950 DATA 119,112,22,25,104,38
+1960 DATA 42,151,143,245,1,182,126
+1970 DATA 237,192,114,17,41,30,231,58,59,107,138,141,64,132,202,223,210
+1980 REM *** CG=H  XHBYEFDJCR
+1990 DATA 45,130,194,130,107,140,160,187,72,79,14,209,159,49,89
+2000 WAIT74.196,O2*A
+2010 DATA 244,247,110,34,164,38,228,87,29,183,188,41,222,72,235,34
+2020 INPUT#5,OK:PRINTW$;INT(R*XK)
+2030 DATA 59,74,198,231,103,183,126,52,254,226,44,180,127,232
+2040 DATA 180,19,66,225,191,247,242,253,234
+2050 DATA 227,44,148,221,29,123,97,150,234,213,138,89,185,12,247,82
+2060 DATA 67,223,44,141,22,182,120,81,65,214
+2070 DATA 158,47,140,0,165,16,239
+2080 DATA 84,193,160,171,76,97,26,193,107,116,252,42,180,237,61,235,228
+2090 DATA 22,95,91,253,159,219
+2100 DATA 255,206,109,145,138,152,37,33,145
+2110 IFI5 THEN 160
+2120 DATA 235,164,96,128,72,95
+2130 DATA 46,209,24,141,250,204,174,180,221,249
+2140 DATA 217,156,39,121,59,2,128,238
+2150 DATA 158,59,190,148,32,146,82,219,215,104,73,82
+2160 DATA 17,111,161,141,171,89,182,9,93,35,89,210,29,198,195
+2170 DATA 225,100,123,197,47,180
+2180 DATA 183,104,55,39,83,68,118,198,82,148,241,189,53,84
+2190 DATA 190,151,221,251,59,218
+2200 DATA 148,37,209,105,20,231,232,91,247
+2210 DATA 138,184,234,192,137,23,63,200,91,236,44,249,175,174
+2220 DATA 217,194,84,115,149,133,177,249,122,24,226,187,63,238
+2230 DATA 177,23,182,136,112,73,8,72,109,179,136,64,35
+2240 DATA 89,152,47,112,115,19,143,150
+2250 DATA 153,94,93,50,244,51,225,213,72,160,102,51,65,103,136,41
+2260 DATA 2,145,25,69,112,91,38,85,72,10,76,0,1
+2270 DATA 103,235,98,161,10,47,35,161
+2280 PRINT"YNLYXX8LSL 1XS0 JZ  -B9A4F8Z!K 9,*75JJN C ODX2Q*U 3L11"
+2290 PRINT"3P D CIYXLHXR XUFV5QB7 Q RQZ5- Z"
+2300 REM MPWDGMI=PHWK =F*
+2310 DATA 67,180,133,193,234,54,124,232,255,81,135,5,23
+2320 DATA 12,173,106,92,131,243,207,250,184,90,22
+2330 DATA 172,191,69,29,137,22,211,11,12,116,71,152,148,21
+2340 DATA 222,161,15,124,33,24,217,204,235,123,43
+2350 DATA 202,57,89,99,226,119,0,132,123,145,43,100,187
+2360 PRINT"4XM1PQ0J0N2UKJXL35NLGF*1REMHGPI. 3F"
+2370 DATA 249,160,227,85,198,231,225,29,153,202
+2380 DATA 180,211,96,21,15,178
+2390 DATA 41,33,139,197,143,120,175,171,45,15,252
+2400 REM B G=NQKHKNT   NIPPJ-QFOKOM--COWFH-UYQEHQ-XE Q-VXAF
+2410 DATA 199,114,216,35,43,230,155,87,215,12,15
+2420 DATA 26,214,217,115,197,230,53,180,144,224,8,149,213,49,224,69,148
+2430 REM NNTEGGBUODAPMINIIXSSBQEKEVK SVXQBJJIOT*
+2440 REM BTQ SKASDLSGIFEGOWGQA=EAO
+2450 PRINT"1 ,IIZXLSV8*J0YE-9Z.0DM-OS8T5-HMHDS  SZFB8X4FG,!  4*"
+2460 DATA 86,68,232,7,237,250,133,242
+2470 DATA 254,53,107,62,53,136,10
+2480 DATA 88,23,172,154,27,215,222,97,117,216,157,241,12,155,28,137
+2490 DATA 99,196,26,113,15,166,56,207,204,104
+2500 REM QFCBHH-ROIUXLJRVS WOWSAMVS-UG- X-V  GSISBKTPOOYUMIMU=TULPBR
+2510 DATA 59,24,198,102,53,230,234,195,71,188,99,182
+2520 DATA 225,64,200,118,69,166,91,9,236,200,231,184,188,65
+2530 DATA 241,68,120,46,165,49,215,161,33,250
+2540 DATA 230,57,137,26,121,13,156,149,242,184,42
+2550 RETURN
+2560 DATA 181,66,148,26,72,197,247,168,151,12,206,36,8,149,18,101
+2570 DATA 30,170,79,147,62,49,35,174,253,153,168,15,43,249,61,7
+2580 REM *** LJVBK EPRDKUELRSD-=R
+2590 DATA 88,244,186,36,173,127,28,35,4,89,84,120,213,214
+2600 FORG=1 TO 85.341+X1 STEP 2:CLR:READI
+2610 PRINT"EWPQ8AM - QC*Z UL,JVF1PF?X C3.ATVFF 0O? YYM4YXBH*O"
+2620 DATA 230,136,98,73,177,162
+2630 GOTO1990:LET F=147:CLOSE9:INPUT#13,A:DIMQ(41):POKE51849,7
+2640 PRINT"ET0*I D8EG4GEFUZS,?J2PNJR76 SRU0MPNC WXV?!SVV?7 8H8GP,.VY6B  L"
+2650 DATA 126,221,239,120,57,35,159,243,67,202,44,136,214
+2660 DATA 137,116,238,17,185,180,207
+2670 PRINT"? JHC3SM VL- Q2ZL  YX ?M,WUPM 9VK4I.XOC-23I3VGU0Z5 JM JU4Q7JZ*"
+2680 DATA 7,152,217,8,129,8,99,231,14,96
+2690 REM EW-N ATQBJSRNJEDXW=QXXCVODTGCG=SJOXH LKTLU MATR OIPWML
+2700 DATA 221,43,37,104,182,133,23,92,28,108,157,244,53
+2710 DATA 83,73,244,67,185,111,195,215,45,250,55
+2720 PRINT"P ?OD6T4VT J8-P66-8ID7H GWIMPT7?2 * G 7L2 WP60 AK*LTWN0?ICYH5"
+2730 DATA 12,1,213,55,177,229,209,96,184,219,207,20,63,225
+2740 DATA 197,94,255,10,64,18,38,196,253,190,242,83,60,146
+2750 DATA 135,90,241,56,214,105,216,236
+2760 DATA 129,139,79,7,234,146,242
+2770 DATA 44,3,205,141,243,107,120,148,134,233,131,44,207,101,190,204,17
+2780 DATA 180,81,55,1,208,55,9
+2790 DATA 254,203,99,211,27,9,95,202,21,15,96,180,41
+2800 DATA 157,195,32,28,228,102,137,144,119,84,7,61
+2810 DATA 243,206,225,90,56,87,0,221,212,33,244
+2820 DATA 54,116,49,119,171,40,2,163
+2830 PRINT"JZM3PLU8?6YR2EY0I!T5653K 8.SD7 L5,K!N OWY*N7Y8ZZA O5NOAB"
+2840 DATA 20,141,25,211,109,50,120,14,234,139
+2850 GET#10,M$
+2860 DATA 132,50,223,51,152,123,222,148,29,76
+2870 DATA 107,102,9,124,19,50,218,160,171,161,55,187,88,196
+2880 DATA 32,42,191,49,237,253,6,100,96,219,167,250,91,118,94,58,77
+2890 DATA 240,60,225,6,231,148,105,3,39,177,144,66,238,46,197,91,113
+2900 PRINT" KSI6ONWL2AER5MI?26DZ1 7D47BIBP2F"
+2910 DATA 235,81,107,92,48,147,106,119,229,169
+2920 DATA 178,170,9,90,56,96,255,21
+2930 DATA 229,35,148,7,32,64
+2940 DATA 233,231,185,38,202,245,167,86,234
+2950 DATA 152,165,136,210,20,78,103,145,254,155,148,91,128
+2960 DATA 58,163,34,137,240,132,52,174,246,139,210
+2970 DATA 187,218,28,200,152,18,140,79,97
+2980 DATA 178,14,155,95,162,8,152,135,165,171,243,216,196,124,26,120,248
+2990 DATA 92,85,70,185,98,244,194,32,45
+3000 DATA 137,196,73,166,124,234,34,172,168,59,152,133,180,11,251,133,195
+3010 DATA 9,201,103,125,49,145,98
+3020 DATA 138,176,163,98,85,85,219,155
+3030 DATA 152,139,94,228,44,106,61,27,46,89,136,184,225
+3040 DATA 108,102,51,186,147,162,154,40,10,237,192,104,213,127,37,44,114
+3050 DATA 17,251,121,146,103,254,244,174,192
+3060 DATA 107,58,100,169,6,140,109,84,184,211,54,22,251,26
+3070 PRINT"L.KWQ1VHV SM4-6B5EK3* 53.B6  JK1O--***A34W1JCB VK MB4"
+3080 DATA 114,173,221,104,235,188,162,205,113,49,104,231,193,136,128,163
+3090 REM DTXNZ S-KVKH
+3100 DATA 74,193,16,92,144,172,126,230,113,17,149,159,253,195
+3110 DATA 59,179,119,254,195,102,219,133
+3120 DATA 207,81,214,171,72,215,103,89,243,251,198,21,57,95,201,193,244
+3130 DATA 19,238,33,205,68,30,158,137,126,161,111,88,3
+3140 DATA 29,9,103,44,201,76,241,187,34,217,113,103,143,151,69,190,172
+3150 DATA 3,249,151,193,202,69,104,223,86,216,68,155,179
+3160 DATA 18,146,168,211,151,231,233
+3170 DATA 68,18,54,132,243,165,92,238,214,105,153
+3180 DATA 210,104,174,15,47,230,173,79,150,80,178,144,143
+3190 DATA 195,131,167,196,87,227,137,128,86,24,124,121,62
+3200 PRINT"6 AS98HTFML 4T 2CJZYV20!DO31  SQXNM0Z8IV,9AWG9ER2Q. 2 A 1M0.A"
+3210 PRINT"BD-J  66I HUD6? DYI5Z46VZLVC18BYYDG"
+3220 LETI8=A*H:GOTO2080
+3230 DATA 8,98,229,148,180,130,102,196,128,67,223,20,236,187,179,168,93
+3240 DATA 189,36,161,174,207,76,220,139,83,173,237,91
+3250 DATA 238,117,176,84,127,239,29,169,197,9,114,12,185,70,220,234,38
+3260 DATA 72,242,128,103,126,46,158,236,182,223,23,227
+3270 PRINT"K59KIW *? ?S7KPK?G?A-1, C2?2N EO SZ1SCU  IZVIUGX!VMTWCYU"
+3280 DATA 152,153,82,139,236,255,49,131,184,44,2,38,18,153,115,144
+3290 GOSUB2470
+3300 DATA 75,75,108,218,174,87,31,203,51,124
+3310 DATA 121,98,126,169,196,156,118,18,191,184
+3320 DATA 244,7,94,222,7,45,41,105,182,103,232
+3330 DATA 16,28,120,49,76,112,217,123,25,240,167,39,33,44,25,56,89
+3340 DIMZ(12):CLR
+3350 PRINT"3,69W ,RBY,3F FFOBV YGB  M PYEWQ N44A!98F0  YG-KW7* HL8 *PTV"
+3360 DATA 138,113,67,192,246,194
+3370 DATA 10,9,213,9,62,141,67,28,35,162,213,61,102,243,203
+3380 DATA 219,3,38,59,215,243,255,54,172,98,99,217,87,233,6
+3390 DATA 45,31,247,255,217,175,8,211,94,146,105,68,106,71,170
+3400 DATA 127,159,9,62,103,185,74,128,181,37,28,117,116,162,164
+3410 REM W UZWPPZRCEHTP TBEF KBEJXMDZ-ZNCE-KBDGRODUFZMZKVPD- - 
+3420 DATA 77,200,139,142,81,228,181,93,209,255,247,206,233
+3430 DATA 36,145,236,162,211,223
+3440 DATA 255,186,107,87,242,122
+3450 DATA 9,95,10,188,32,118,11,121,155,27,150,149,34,255,144,184
+3460 DATA 1,29,236,152,182,252,238,91,152,188,48,209,203,213,241,93,134
+3470 DATA 196,181,60,254,117,80,190,147,153,121,25,110,223,88,78,64
+3480 DATA 188,146,37,92,78,130,197,42,101,59,156,246,132,53,37,42,190
+3490 PRINT"MS0GWGM4SLE! X5YMQ RR ,NIO,0A*L-RZ,,EICKL M2Y3"
+3500 DATA 93,65,228,112,239,216,58,148,123
+3510 REM ELINBBMZ=AWGU=LTGVD*JM*= O MQ Z*AZMJZMDCNMZWC NCECIJ
+3520 DATA 140,252,161,249,163,96,87,72,81,25,138,101,100,11
+3530 GET#1,X$:NEXTY
+3540 DATA 232,161,110,198,183,176,34,32,98,73,164,49,199,188,27,237
+3550 PRINT"L1 N*R?WFHY81LI9U Q.D1I 1Z5 BK"
+3560 DATA 19,35,0,205,46,69,219,143,36
+3570 REM DBLPO PETXB XCOYSVGE P-KDG*N KK
+3580 PRINT"JOZ8OEDV7-OFA2NM9LZM .JV2 L,A!JP-EET15YAV9S CJ2B T937 IFP*?.67"
+3590 DATA 177,99,179,131,122,252,41
+3600 DATA 147,105,59,175,42,126,104,185,143,213,203,171,49,243,111,151
+3610 DATA 8,159,50,186,22,198,67,126,42,221,143,117,146
+3620 DATA 217,196,177,139,136,114,217,30,128,81,190,80,26,169,16
+3630 DATA 157,0,57,11,56,87,75,123,59,82,73,119,169,68,15,232,14
+3640 DATA 147,141,108,212,195,218,77,99,27,129,163,195,84,144
+3650 DATA 111,140,228,179,132,84
+3660 REM MJJJ=-PBAXNFTWSP B XEIF TZPYOSI*==GMLGBB
+3670 DATA 108,165,134,174,124,186,120,195,136,26,16,102,125,200,40
+3680 DATA 221,94,59,145,36,126,235,164,117,176,216,224,210,97,186,83,67
+3690 DATA 27,113,35,118,181,5,62,183,4,190,3
+3700 DATA 84,86,118,229,16,171,237,55,40,45,248
+3710 REM -V KIAESNLD=W--JWZYHM=E-H KG *ZU
+3720 DATA 97,56,240,111,112,92,111,254,2,244,202,179,163,234
+3730 REM SEMXHICGQU QEMPN=MPQ=BKBOIJHVI-Y GHXUUCEOTKYARAZ =Z* 
+3740 DATA 36,125,198,17,138,30,30
+3750 DATA 177,130,67,13,196,55,172,65,193,14,75,79,233
+3760 REM ***  CVX B*GQTT*K  YZQOBES GY RMGJYE*CES
+3770 DATA 221,43,36,47,237,41,222,48,10,29,225,62,157,89,38,30,93
+3780 DATA 182,33,29,73,160,134,56,135,113,69,92,123
+3790 DATA 147,178,18,179,171,38,42,38,160,59,141,114,202,117,117
+3800 INPUTA:POKE2,T:PRINTIV$+"";RND(D AND D):PRINTMID$(B$,B);9
+3810 DATA 116,175,31,11,110,16,66,32,141,81,247,172
+3820 PRINT"S?S M6 U 5*V Z Z 9S!JVYAE?7FAQVFQ??1Q5WC9Z 2  9-5,Y. HPOTXS8 K"
+3830 DATA 92,255,109,99,228,5
+3840 REM WYHAU QOPCH*YISTUL=-ROQN-UIYDTPOZBZKRUBUCADNX XZMLDWEJNU
+3850 DATA 141,27,37,21,91,108,86
+3860 DATA 130,115,31,22,4,226,70,13,185,160,96,144,46,164,136,229
+3870 DATA 140,90,54,42,106,17,165,229,141,143,3,111,199,3
+3880 DATA 14,86,155,89,246,246,158
+3890 DATA 98,156,58,74,118,29,221,219,116,195,80,146
+3900 INPUT DB$:READAQ$:GETI6$:PRINTR$;W3:LET B=LEN(SH$)<Y
+3910 DATA 151,223,101,7,235,128,220,187,160,253,111,147,143
+3920 REM *** ME-SHLWP VUXKAYFJIWMW-ABEK TO*QSSKZEIQOILWBDOGV-DZZ=LSNI
+3930 DATA 250,105,81,37,44,39,193,189,240,181,125,141
+3940 DATA 18,20,230,88,73,47,61,190,51,53,137,207,249
+3950 DATA 203,96,170,243,152,31,163,205,125,225,21,43,167,24,157,114,88
+3960 DATA 164,240,142,31,144,157,52,235,187
+3970 DATA 101,13,201,82,170,59,231,18,4,248,20,89,7,219,231,111
+3980 DATA 243,76,177,188,196,230,110,56,152,58,118,238
+3990 DATA 178,10,112,192,189,234,143,4,63,68
+4000 OPEN14,8,15:NEXTP
+4010 CLR:LETC=ABS(68.249):INPUTC:INPUT#13,I9:GET#8,N5$
+4020 NEXTF:CLR:SYS0:ONPEEK(W)<=JB GOSUB 3620,480:LETA$=CHR$(25)+"G"
+4030 DATA 191,227,77,151,43,8,94,5,145
+4040 DATA 87,102,137,217,219,186,19,253,103,89,160,95,38,164,117,16,36
+4050 DATA 10,153,19,166,235,246,35,102,113,176
+4060 DATA 207,30,206,39,53,105
+4070 DATA 23,62,58,189,39,37,208,34,169,160,183,42,27,131,25,190,133
+4080 DATA 41,86,68,59,167,253,255,1,178
+4090 PRINT"P5RVG IH- *W,8DMZ6TYP1LVPA1XJTA8U.6T2 KVBY6OQ.V019M3GS 9V"
+4100 DATA 61,115,109,200,161,103
+4110 DATA 52,220,28,207,188,83,17,147,145,15,163,51,252
+4120 DATA 34,202,105,75,179,217,55,1,14,102,166,44,240,20,55
+4130 DATA 187,97,10,199,246,45,148,52,107,144,215,209
+4140 DATA 103,128,227,5,45,226,158,100,204,76
+4150 DATA 139,54,225,176,88,219,83
+4160 DATA 27,202,109,94,179,156,28,150,214,5,74,149
+4170 DATA 166,70,122,16,250,48,171,59,92,42,37,136
+4180 DATA 107,169,99,254,132,163,181
+4190 DATA 10,60,77,184,194,152,249,111,79,153,197,180,163,240,173,135
+4200 DATA 57,164,165,237,68,91,253,172,135,48
+4210 REM SG GQOEWCONUXS TWRRNDZXEGL
+4220 DATA 242,65,143,173,69,7,6,169,208,76,224,59,144,231
+4230 DATA 196,231,168,251,19,77,50,29,125,142,45,182,4,199,192,67
+4240 DATA 255,146,193,157,249,216,149,109
+4250 DATA 88,83,176,28,109,142,80,18,1,44,198,106
+4260 DATA 238,77,161,163,165,186,10,220,22
+4270 DATA 242,196,33,80,92,88,41,176,142,40,77,240,241
+4280 DATA 197,166,223,12,248,251
+4290 DATA 25,169,133,196,227,212,171,124,110,191,193,250
+4300 PRINT"AQ N1! 5 MM0RM A9LX2 301 87ZSQJ,.RB4EKA"
+4310 DATA 45,79,1,48,214,243,129,95,253
+4320 GET#9,J$:NEXT
+4330 DATA 52,190,32,5,64,218,158,138,186,25,208,1,237
+4340 DATA 230,240,243,185,153,231,121,8,201
+4350 DATA 49,158,39,79,161,169,143,249,105
+4360 DATA 255,222,105,66,12,240,11,7
+4370 DATA 215,56,109,47,112,197,182,16,45,138,204,237,60
+4380 DATA 112,147,209,168,202,154,233,170,76,153,159,202,198,227
+4390 DATA 160,192,2,199,185,27,101,166,3
+4400 DATA 128,219,116,241,155,41,1,50
+4410 REM *** IKMK R-BWFOLFYXLM PBNRIQFSOUCXGMKBUEVUN*BLEJFXH=RWBMV
+4420 DATA 219,236,56,204,49,222
+4430 DATA 149,72,101,12,226,48,63,45,167,163,97,64,163
+4440 DATA 3,0,26,18,98,80,80,132,165
+4450 DATA 125,89,62,205,163,0,100,128,66,120,194,134,159,43,245,227
+4460 REM IOLZ=Z=G-PLVEYVYGV E-ILSC LVQTQG-JKUQ YNOF*-FWEX==TQ
+4470 DIME(33):RETURN:GOSUB1670
+4480 DATA 77,58,72,136,242,232,212,157,14
+4490 DATA 187,65,5,127,181,167,4,227
+4500 DATA 245,41,134,194,77,52,62,162,31
+4510 PRINT"- 0533 WGQ  9A W 6LA5QL G.T JW*U  097HX3!95XLZE Q0YO*!P"
+4520 DATA 34,61,145,7,77,179,79,76,234,212,16,241,101,172
+4530 DATA 176,35,19,246,239,62,9,240,230
+4540 DIMC2(19):GOTO1010:CLOSE5:IFLEN(K$+J$) THEN 4340
+4550 DATA 89,212,14,97,18,1,164,180,17,179,8,193,1,216
+4560 DATA 59,141,8,130,41,72,205,47,91,199,231,97,107,188,247,6,145
+4570 PRINT"C9L U0 AEK  IKLRC*6  NGJN3I*U.GS7J9081   "
+4580 DATA 243,88,42,127,76,170,17,173,67,209,114,166,96
+4590 DATA 167,255,79,175,132,151,207,142,104,200
+4600 DATA 74,38,45,201,46,199,100,243
+4610 PRINT"RE?PVCSEJ2 XG.! PA  S6!8I5VP!N  NKZSQ2K ?NMNVAN D"
+4620 DATA 152,241,186,0,188,193,234,91,205,241,70,6,11
+4630 DATA 168,61,232,49,78,146,251,211,243,56,27,255
+4640 PRINT"V2.KAR C Q.L 8WJ5 R L 5!UV8Q 1XER9W"
+4650 PRINT"2,4U K JTC 3.CGG.2NIRLH2VDH1!8G"
+4660 DATA 154,34,167,65,99,252,63,105,87
+4670 REM *** DIMAKNU=YWEPEJ*GHOHIB*P=CGHNHWI N-G  W*FUP*C FM
+4680 DATA 187,46,175,105,210,149,108
+4690 DATA 146,59,173,255,35,215
+4700 DATA 12,171,20,196,113,68,195,168,56
+4710 IFPOS(F) THEN 2860:PRINTMID$("KM",I);52394:PRINT#10,SIN(S)
+4720 DATA 178,196,199,140,10,150,159,99,245,75,177
+4730 DATA 4,212,148,66,99,234,69,51,159,204,48,174,103,246,102
+4740 REM ZJLNNHP -MLBAQA JKWCIFXUJNTCLIFJ-E*MJITHM  *X
+4750 PRINT"!QPY.XE-1I *D  2  MA4,DZN*94YQD "
+4760 DATA 237,146,185,135,30,4,91,80,71
+4770 DATA 35,230,44,137,70,209,202,206,44,39
+4780 DATA 248,144,117,196,180,146,209,165
+4790 DATA 213,36,74,241,202,103,41,147,185,38,21,211
+4800 DATA 69,250,190,41,254,141,220,174,204,249,122,11,54,126
+4810 DATA 39,7,39,185,145,170,23,211,126
+4820 DATA 194,25,22,209,169,7,208,104,8,50,146,186,254,84,112,132
+4830 DATA 204,211,5,168,205,147,137,18,169,100,70
+4840 DATA 50,126,101,35,172,77,221,251,193,114,105,183,222,222,29
+4850 DATA 255,171,12,235,201,126,84,185,137,150
+4860 REM A-XWMML=HVSREAETHF-=JIB*EDCRUUGVEV R
+4870 PRINT"TAEJDXIF! - QLROV M 7F5KT0X7 YAME  M*KSJLK K3P 08,T*?9Q3"
+4880 DATA 92,50,155,110,88,130,44,119,219,111,104,230,137,192
+4890 REM *** BU -WUZCUIYKXV UAIP
+4900 GET#6,ZS$:OPEN1,8,15:RETURN
+4910 DATA 19,53,103,129,138,188,192,201,120,32,153,166,161,245,253,30,228
+4920 DATA 178,6,91,139,162,60,121,130,229,118,28,52,230,110,35
+4930 DATA 115,67,108,184,246,162
+4940 DATA 209,53,211,160,91,218,37
+4950 REM *** QEHZBNZ T H=NVAK=*
+4960 DATA 21,200,120,211,131,203,146,190,100,175,239,144,147,20,147
+4970 DATA 25,32,218,90,100,240,97,175
+4980 DATA 134,133,148,82,141,229,93,181,148,126,140,123,131,27,101
+4990 DATA 232,192,203,87,100,79,215,181,37,174,191,6,79,47,17
+5000 PRINT"TJ0DTZ 1? CG! S6PLCS9 9Z5UIR?09"
+5010 GOTO2870:WAIT3,60.366
+5020 DATA 231,7,183,138,117,120,155,133,218,56,243,167,125,211,188,139
+5030 DATA 66,252,83,45,38,15,207
+5040 DATA 180,252,220,192,172,24
+5050 DATA 112,237,108,56,241,37,16,102,246,245,122
+5060 DATA 191,211,11,183,156,109,56,223,40,161,229
+5070 DATA 102,227,158,105,182,140,59,157,161,176
+5080 DATA 45,68,123,2,245,201,182,19,125,125,242,27,86
+5090 DATA 140,245,85,244,75,84,165,209,249,70,19
+5100 DATA 155,88,3,97,248,172,26,57,115,57,244,22,241,65,148
+5110 DATA 14,90,51,243,157,69,217,1,9
+5120 DATA 28,185,46,115,210,73
+5130 REM *** = NTYLSMC=O*EJNVOU  TSVDD=F
+5140 PRINT"UH? BQF3IJ1C,.XJ , G?A2 RL,6VI7H7SR?1! PUW X FK ,2"
+5150 DATA 52,247,189,176,245,75,199,135,153,192,204,221,60,165,249,168,238
+5160 PRINT"SI,O-XT,SSDWNMJU32 G4KID* 4J5QPZ4S,D "
+5170 DATA 0,172,111,235,196,0,208,113,136,84
+5180 DATA 233,136,1,156,25,216,53,82,240,118,37,173,132,202,40,117
+5190 PRINT"8SUNO!5W 3T!!D9WCYZV* 7 83CNW0?. ?8IBDZOJS?4U AVFZ -4Z.FQOE"
+5200 DATA 1,35,29,70,205,112,162,205,147
+5210 GOTO790
+5220 DATA 114,73,4,248,58,227
+5230 DATA 212,31,142,0,114,118,37,170,16,199,221,75,79,5,113,228
+5240 DATA 19,243,221,186,44,124,234,0,208,220,9,105,3,77,61,154
+5250 REM *** QDQMPD GMCAX VB=IBKGFGK-BULU
+5260 DATA 45,136,232,251,185,44,9,74
+5270 DATA 183,192,217,28,130,5,137,77,237,13,27,48,233,221,155,72
+5280 DATA 8,132,184,99,174,112,122,58,68,30,229,244,197,210,160,52
+5290 REM KOMEGHE-NFNFWXLNSDSW
+5300 REM NYPOOBX FAYZJLWHCVAAZPCXLCJR=OCN
+5310 DATA 146,227,121,194,154,49,55,115,8,148,141
+5320 DATA 20,100,14,84,122,51
+5330 DATA 157,97,194,142,108,94,16,52,186,127,173,12
+5340 PRINT"0-K?,Y.Z07J3FBME66RZ4T3V,Y Q45ZQ46.NN?0OZ KDUA8E B  Y0FHIYW "
+5350 DATA 29,200,70,177,38,204,142,251,113,145,250,101,189,61,251,220
+5360 IFQ THEN 4040:GOSUB1110:NEXT:WAIT49659,VAL(Y$):PRINT#2,VAL("ZSC X,-P")
+5370 DATA 51,182,191,77,89,236,132,231,185,186,15,222,249,204,194
+5380 DATA 214,173,95,255,248,133,133,240,236,100,152,144
+5390 FORD=1 TO P AND D STEP 2:FORP=1 TO 108<>PC STEP 2
+5400 DATA 96,169,61,248,20,28,214,5,229,158,30,118,247,170
+5410 DATA 129,127,38,112,111,136,162,44
+5420 DATA 253,11,129,154,15,188,239,178,136,252,204,51,242,232
+5430 REM *** LZIR* HEORGS
+5440 DATA 86,135,236,55,216,100,110,58,210,64,12,21,251,204,107,57
+5450 NEXTF2:OPEN7,8,15:PRINT"E5-7V32A5LEJR?N";PEEK(51923/YQ)
+5460 DATA 184,185,254,128,70,24,30,43,63,228
+5470 PRINT" BI*2S.*U SYX*SBP0A I5. . N!Q1FAZM7M330O?3KRF?HJTT"
+5480 DATA 213,123,80,157,48,58,67,166,182,105,193,85,133,147
+5490 SYS88:CLOSE9
+5500 DATA 23,142,52,206,212,73,66
+5510 REM *** DMYORXPTVWLWYAGCBCAR=VXKVMHYIQ*WEEM Q-GWP U=
+5520 DATA 154,73,223,180,217,48,120,18
+5530 DATA 143,98,200,63,104,151,176
+5540 DATA 251,226,252,81,134,42,39,10,197,188,234,139
+5550 DATA 136,28,35,225,66,77,87,181
+5560 DATA 237,214,139,56,25,121,180,20,127,87,232,214,128,5,200,26
+5570 PRINT"GDJZ 8NQ? Z UL6 7KXK 3D*N7WS2XNG MCRJ  7M9*J AJ"
+5580 DATA 48,159,96,22,196,24,95,211,140,53,72,219,146,56
+5590 PRINTO$+" TY8ZH";SQR(4 OR B)
+5600 DATA 37,58,92,12,86,210,163,253,43,119
+5610 DATA 237,101,142,216,73,169,67
+5620 DATA 146,59,78,236,216,70,101,200,137
+5630 DATA 95,183,81,71,128,227,211,110,71,40,43,56,59,39,49
+5640 DATA 182,218,140,184,72,52,23,218,26,31,161,211,35,204,150,29
+5650 IF5 THEN 3360:LETL=SIN(6)<9
+5660 DATA 240,88,214,8,189,94,73,14,219,94,254,195,209
+5670 PRINT"- SKU8MGVJ-68AF!Y NN8DF5F* 7Q RGQ!B,SQB6I1UKQK5VHV27NFDFGZ"
+5680 DATA 143,159,47,130,9,79,245,240,151,116,23,43
+5690 DATA 236,75,183,135,0,55,222,163,195,229,154,13,244
+5700 DATA 182,203,58,248,92,233,159,20,94,0,253,20,98,66
+5710 DATA 169,139,159,62,45,77,225,72,128,63,206
+5720 DATA 197,15,126,41,30,241,50,202,79,228,212,198,211
+5730 DATA 191,255,116,148,213,55,104,65,193,211
+5740 DATA 176,207,184,249,229,52,253,242,13,74,249,150,97,123,135,31,126
+5750 CLOSE10:GOSUB4420
+5760 REM *** C-WSPYA GUZ YN
+5770 DATA 130,194,207,127,47,230,150,168,146,241,206,242,25,53,32,145
+5780 DATA 168,240,137,115,132,75,80
+5790 DATA 14,143,216,56,237,127,203,187,192,233,218
+5800 DATA 151,175,91,210,126,169,171,189,168,87
+5810 DATA 227,179,22,32,44,30,132,26
+5820 READD
+5830 DATA 17,239,144,98,82,136,81,113,20,182
+5840 DATA 30,33,178,213,251,255,6,0,65,121,92,151,158,190
+5850 DATA 167,227,108,12,97,129,146,65,139,13,42,70,177,245,10,131,242
+5860 DATA 145,140,98,247,44,44,34,176,246,248,44,32,241,88
+5870 DATA 186,136,83,184,134,223
+5880 DATA 222,220,242,220,26,245,3,9,159,32,193,23,216,30,13
+5890 DATA 149,224,102,165,168,77,22,222
+5900 DATA 104,36,98,77,242,236,36,142,252,1
+5910 RETURN:GETSJ$:NEXTQ:SYS56.453
+5920 DATA 30,52,34,199,58,57,3,58,96
+5930 DATA 80,144,177,80,67,147,115,140,136,179,186,49,188,61
+5940 DIMLA(11)
+5950 PRINT"IZKSVUBU5861YX7 4PT2 DR68C S8FRBLYM.GV *RJ. U.F ZN CLED9C7I7!6"
+5960 DATA 0,97,0,207,98,160,221,217,59,189,186,106
+5970 DATA 31,120,200,163,218,152,211,53,171
+5980 DATA 178,177,170,56,162,151,194,178
+5990 PRINT"R843XJ74 *UFPVYP4OC?!,JG743 9EF60"
+6000 REM ZHE CPXE*=WNKPNL=VNO WCPDEXSQMNH -XWKR** ISM=CDLLN*AEGF FG
+6010 DATA 227,50,27,153,159,226,167,233,218,171,163,117,111,244,92,3
+6020 DATA 124,235,70,66,4,96,10,194,9
+6030 DATA 205,46,20,27,189,229,53,152,253,101,128
+6040 DATA 105,43,93,42,175,210,60,129,44
+6050 DATA 21,15,131,204,47,124,105,177,110,5,217,31
+6060 DATA 156,180,78,11,101,92,172,184,226,109,188,24,133,132
+6070 DATA 29,43,31,225,244,90,84,2,31,248,143,239,232,237,221,38,108
+6080 DATA 113,244,174,70,243,22,196,208
+6090 REM PT AFN   FI KNEXZSDZW ZCPKCTYK-J- 
+6100 PRINT"68WJ1PG0-A!5 M.5S74UO7YFG!0WTN!NUTS 3W.  !C4 QS8ORUJDUUDS5.2 C"
+6110 DATA 247,78,249,10,220,24,20,72,24,89,133,142,189,97,153
+6120 DATA 249,95,145,26,81,39,233,144,170,188,214,100,200,97
+6130 DATA 21,140,45,37,149,100,151,63,142
+6140 REM *** G*-*KSQCXZGPKON-NP*AGWOM RQTWMQ*XSWUOPJOQLM=FS*= 
+6150 DATA 36,134,2,183,18,70
+6160 PRINT"MIBK*2QQEQK,!TJOG7Z8BEEDY!X ? 9S2*TY.6.S.! 3D*JVW34QX1237  "
+6170 REM *** =QUBXERBR-*IWC LCM-HZR-TPVG MJHXPTPLX
+6180 DATA 177,253,179,98,204,193,25,87,84,233,162,174,178,27,164,54
+6190 REM KEHRRQJJ-XBT*NSDZJKEKABCEPUJ BKLWH-ZA
+6200 DATA 119,5,137,212,191,187,225,14,7
+6210 DATA 34,158,46,187,73,4,114,162,55,56,52,27,211
+6220 DATA 90,179,116,182,213,89,19,74,176,47,131,251,233,68
+6230 DATA 72,196,99,36,4,57
+6240 DATA 53,132,92,175,254,153,233,242,118,254,133,245,91,1,162
+6250 DATA 188,62,174,203,202,240,201,137,198,181,106,172,136,120,240
+6260 DATA 99,24,134,140,232,25,227,68
+6270 DATA 140,99,123,205,242,177,198,203,31,87,122
+6280 DATA 94,106,248,76,236,184,2,116,61
+6290 DATA 75,98,20,30,184,189,102,80,1
+6300 REM *** OFZKUARUQCPSJWU-MVC=HSM=RO-I LWICORPLGJGSUSU=EP
+6310 DATA 51,153,240,155,83,159,252,39
+6320 DATA 22,22,60,140,159,55,165,81,181,95,145,222,28,225,85
+6330 DATA 204,181,36,246,231,50,108,255,109,23,12,155,137,66,10,230,144
+6340 DATA 230,0,214,200,192,60,144,250,157,5,11,103,89,184,66
+6350 DATA 74,75,5,171,4,104,55,3,253,203,156,89
+6360 DATA 42,92,75,13,130,52,186
+6370 DATA 114,216,94,232,184,82
+6380 DATA 40,74,87,93,141,22
+6390 DATA 76,189,93,74,9,50,2,233,24,78,35,117,170,143,146,152,180
+6400 DATA 158,82,66,130,177,30,44,107,61,92,17
+6410 DATA 0,207,12,140,201,138,149,51,66,239,156,186,116,69,9
+6420 DATA 56,43,164,112,101,80,164,0,164,39,83,142,25,215,223,253,249
+6430 PRINT" C !X MO-DHOUYFS221*7 . LMU9R.AWA,0*D95,V 2NDE 8M*TPM8VE1"
+6440 DATA 9,214,126,251,77,197,204,173,243,7,237,115,179,68,133
+6450 DATA 170,58,100,173,120,87,239,34,73,35,230,219,33,0
+6460 DATA 57,67,189,28,138,213,51,219,28
+6470 DATA 11,76,164,101,94,214,216,114,136,115,125,103,186
+6480 DATA 237,238,120,174,160,180,243,74,70,187,34,144,204,30,56,210
+6490 REM *** BDWKP=TNLS=GQJFJKFYIANFI
+6500 FORX=1 TO 50.306>=90:CLR:WAIT9,FRE(8)
+6510 DATA 78,140,215,213,137,9
+6520 DATA 243,251,36,230,161,164,216,244,137,195
+6530 DATA 132,178,208,189,38,64,169,14
+6540 DATA 158,3,43,38,20,26
+6550 DATA 205,199,8,136,212,30,141,129,29,114,211,140,140,150
+6560 DATA 114,113,82,85,207,139,86,69,72,87,170,67,230
+6570 WAIT2,HT:DIMN(35):LET N=FW OR 51115:GOTO1740:CLR
+6580 DATA 182,203,30,163,83,26,253,72,45,209,188,144,223
+6590 DATA 152,107,248,82,214,247,97,35,8,72,254,194,224,255,190
+6600 REM KNCPHTIQINMSEI*BQHLZS=CVSRAUJBELYHSCGRIMTBEHRRURBZIMDLQ
+6610 REM *** FAHKTM YEPWPL Y*DY*LBOCTHNU
+6620 DATA 176,117,216,86,195,56,34,56
+6630 PRINT" IOKW0HZY?1PRU*-6 DAGGWQZ IZW,S 4P 0D5Q9?Z756"
+6640 CLR:POKE52971,PEEK(62.182):RETURN:CLOSE12
+6650 DATA 245,229,27,63,197,229,113,109,241,4,247,168,153,71
+6660 DATA 250,80,198,48,75,107,172,33,165,223,91
+6670 DATA 33,131,115,191,9,97,174
+6680 DATA 186,213,94,93,148,121
+6690 DATA 183,83,115,24,231,204,7,231,222,72,77,163,11
+6700 DATA 168,13,216,22,18,238,211,123,47,32,118,82,165,56,202,30
+6710 DATA 94,101,72,206,207,82,150,69,25,12
+6720 DATA 161,212,7,123,254,225,207,157,139,251,95,214,173,217
+6730 DATA 229,60,55,160,149,200,120,50,146,165,143,26,109,217
+6740 DATA 100,86,3,188,24,215,37
+6750 DATA 231,22,83,235,57,135,32,27,136
+6760 REM *** XAKOQKGFVLLIDU*YFIOYAUR T
+6770 READO:LET F$="N6":CLOSE10:LETSP$=J1$+P$:INPUT B3
+6780 DATA 217,109,247,250,167,10,10,78,118,59,73,14,13,90,10,241,87
+6790 DATA 22,19,16,244,155,63,12,177
+6800 PRINT"G* J- 0D7TMPP5-U P6PZRMOPX7T27R"
+6810 DATA 107,71,232,228,113,57,189,45,108,234,3,140,71,42,49,68,52
+6820 REM  M*UIDLWTISH=RL*PJGMEJDE*RHCLVUB ZPQLKTYMBV F*TXPSOZYA 
+6830 DATA 232,67,190,66,87,194,235,42,76,201,136,26,77,153,139,147,85
+6840 DATA 237,78,82,85,0,79,154,23,149,149,63,46,143
+6850 DATA 136,217,218,126,217,15
+6860 DATA 54,235,206,120,114,118,233,179,60,234,161,98,245,105
+6870 DATA 82,97,125,189,182,186,62,199,76,196,11,215
+6880 DATA 78,222,155,248,235,73,24,142,249,15,202,201,62
+6890 DATA 15,109,181,0,115,31,24,120,230,145,54,130,28,35,164
+6900 DATA 140,136,48,86,222,229,116,116,61,168,5,160,95
+6910 DATA 136,195,35,153,228,177,42,108,171,244,143,161,249,90,189
+6920 DATA 232,16,108,32,221,35,127,191,109
+6930 DATA 136,58,34,94,108,146,156,150
+6940 DATA 202,139,163,31,41,34,114,232,250
+6950 DATA 25,208,199,108,34,219,48,9,65
+6960 DATA 153,9,98,63,85,148,121,111,67,135,208,204,100,202
+6970 IFK THEN 4410:OPEN6,8,15:ONM5+50272 GOSUB 3880,3670
+6980 DATA 128,39,155,232,65,0,221,223,86,189,237,89,26,101,244
+6990 DATA 25,148,94,243,239,145
+7000 DATA 145,60,194,111,150,163,128,238,156,122,203,251,41
+7010 DATA 203,71,81,189,80,217,198,197
+7020 GOTO5060:SYS5:IF50513 OR B THEN 1050
+7030 DATA 69,97,212,246,89,132,227,82,32,229,81,251,238,171
+7040 REM *** MGPRFOP PJFTHNS QEBYI
+7050 DATA 158,208,222,178,159,236,56,105,116,254,195,200,93,99,100
+7060 PRINT"G?!XB-A? -L4J.6XF- PBFWND 98ON*4NB2 0 ,QG X6,8 R"
+7070 DATA 58,185,252,69,9,184,155,213
+7080 DATA 133,209,59,247,160,253,211,80,111,55,10
+7090 DATA 47,105,185,23,230,235,41,93,231,144,77,72,72
+7100 DATA 9,95,192,30,185,69,182,27,1,12,252
+7110 DATA 192,6,130,44,30,83,88,206,22,54,203,30,2
+7120 REM BCWNR MZWIK-S-=*FAKQB ZS*GC-=*TMDL-G
+7130 DATA 222,251,64,132,81,244,154,226
+7140 DATA 148,195,102,49,151,247,157,25,162,35
+7150 WAIT244,LEN("RAX 8")
+7160 DATA 71,240,248,214,209,227,196
+7170 DATA 230,90,117,201,121,127,40,14
+7180 GOTO870:PRINT#8,ASC("AZ"):GET#4,M$:CLR
+7190 SYS56.24:READBD$:GETP7$:CLR
+7200 CLR:INPUT V7:WAIT50916,LEN(U4$):PRINT#15,RND(7):SYS52788
+7210 DATA 254,69,125,213,101,193,126,71
+7220 DATA 164,183,216,90,211,130,254,135,233,109,196,118,136,131,61,92
+7230 DATA 29,136,197,42,226,24,44,106,193,126
+7240 REM HCCPYYQJ-= URZZPYPFYT=IIFIFG=CSMXXIY IVPHFNHDZ PWUZCKBZ*L
+7250 DATA 50,24,110,3,110,28,152,200,157,97,194,144
+7260 DATA 108,109,230,146,251,199,130,53,89,195,80,100,73
+7270 DATA 54,139,184,152,92,179,1,180,165,201,166
+7280 DATA 25,94,9,249,212,47,211
+7290 DATA 91,117,153,245,231,215
+7300 REM E*S-F*DQKPSAK*CC YRMKJ SQWP *-HVST-Z-PK E*SJD 
+7310 DATA 56,120,197,193,31,166
+7320 PRINT"WX1H8FNF 4B V7R-6 GBU41 ?BZ 1Q3  6H941HI*,,,B8J  OJSDWTCX-1JC"
+7330 DATA 245,119,21,13,145,240
+7340 PRINT"UJP7 ATG B GCQ *SOQZ   2F3GWRZZAFDK7  6 B* Q-Q2W4"
+7350 DATA 38,26,26,207,121,57,52,252
+7360 PRINT"OX-MFUFL  M?1FP?2SWHRP6EWI94VIM."
+7370 PRINT"WK 8EDNVJXLR1Z?6 GHG11TP9V4 U?E E-GMHT1FT "
+7380 DATA 133,72,214,253,16,167,206,10,126,155,135,77,252
+7390 DATA 157,64,189,6,128,86,215,213,104,39,214,142,175,206,58,225
+7400 GOSUB7210
+7410 DATA 160,134,142,157,188,94,94,61,106,223,255
+7420 DATA 126,212,182,68,124,124,94,85,223,38,252,93,53,153
@@ -0,0 +1,275 @@
+10 PRINT"9CS 9E .D7 W *SJFS4SS6K?44W! 9*63T- "
+20 REM =VOWQAZY RFGVIB  VMZGIKPEBKS*OUKP=PDL
+30 PRINT"JI19LF1BY? -HFJIQ 6RI3VTQ8QVC-YU-VEK3*,S?N4P9ISI?I.ZOF0A7 WM2O"
+40 PRINT",62* Y A521T 60R,22KY Y I8F-PUY7T 5.*ADT?5-J  G6E"
+50 LETQ5=W OR A
+60 PRINT" F5JD,6 M   Q9Y9IIVMZ ABQ?P79-GH,5WOL!AQK*8L7"
+70 GOSUB10:GETV9$:GET#2,P$
+80 REM *** WUSPMEEWFSDGRVINUBUSLPKY OKAOCO*BP
+90 REM *** YSCGURBGMYZGIJBUB
+100 PRINT"HX?Q3 ,*5KP7DG!J097 *-49.AM-.ZUYM12 IS !QIR2 !46EPW0.VO08I"
+110 PRINT"O HLF4 J-,KCX.FN YD887AL5C*  X0VOHNDD 1E2S  ,VTN  6GP"
+120 PRINT"29UM  !UP4D4-9I.!P5 FY 7 V!ENY6D J!B8MEE1E"
+130 PRINT"!W   9S2 0K-6S0D72 A0A2R 8Q07T7BU0BG8NWM-GV8C8V,M0Z R6  "
+140 PRINT" 5P6TZDV0L2WY5NM4O U1!W,L***ML8OLLCQP7ZS?Y9 WG*"
+150 PRINT"?8 1-1J!F3XOKYDS!OQXKS BYCXY!WWHFWP 5"
+160 PRINT"LD4* E17X9 JO FP8BNL?1YQQ4T 46LCNO UIS"
+170 PRINT"5R.4 DY67IVPX5CE.V?M-A.  ZL2DY2 XNYCL TH2RL"
+180 PRINT"H5-Q7BQ NCF! D P8GMTHH-.8H3L7!QRVPZVBY2ZB"
+190 PRINT"K22?DIC ?C?  IXZLG9,1U!H,!!XK2JQP.IT"
+200 PRINT",A3P Q6 WQB2MIM4?7EE-K*J5!L, 38MAR4WW *OJ5YLC06"
+210 PRINT"UH8Y,OIK0UW434W4.*.H8JV S?HFRFA71-*TU ?.V0S8?!JPS2."
+220 PRINT"IS7X OO D0 GG6DMA6IA4A!BR1O-7DMU0KJ03H.F  J7YPBQ5V H42B ZB4PF"
+230 PRINT" F0HK98R3H*3FA!KHFVKDSE,MZWI1 Z N DN4 6- Q*-4KU3 "
+240 DATA 187,26,197,14,7,50,93,74,238,219,192,81,26,73,198,52
+250 REM GSK*KVX OVGNJB-UV*YBSOGACO HD-PAWO-LO-DYHHNIOMK SG=C APUHS
+260 PRINT"7HR08.Z5J0N UTV!8 M!YRLZKTHSY6! W7U"
+270 PRINT",T1DU-Q E* NNYG2Y  KYVRKW4LAMYLD8"
+280 DATA 134,178,34,187,8,229,51
+290 PRINT"* 4WQ801 V5RZ Y ZWKCE5E 0K69 J-N4N PO"
+300 PRINT"09QH60N2-A7DUV6H D 0J NOHI84 JKYUN0 R5XW Q6"
+310 PRINT"P6C.HKT?S 7-IT,Q2P8YYXLC92SIUN0 8!5-Y92EN-V?HQ!"
+320 PRINT"-A10?0NDK3 82BGS 5RLX*7Y23JWE 7!,FT I*HN?FM EEAGN"
+330 PRINT"4GZ K SX!M?A2PG 9MW09FSLA MZXX? Z0DO*G ,.DDEJO 4Q,8T 8 JD"
+340 PRINT"H B  0T0K43H  0S CGI49MSNVAD3CLSDA3UOM D"
+350 PRINT"V*OBZ 1SBQF.- 7RVMC9KN?THB05W5DMCFVO "
+360 PRINT"8TZ3 2QCVKC. 369H7?BA RPSOG9R,Q?48-.BUCL*0RQNSTHKBM8  S!KXM6I"
+370 PRINT"4RBBJO N4U!IO,,C3? 3PJ4IE6,R.?V*-FUTV8LD-QO-6T CTGVFVML DI?0?S"
+380 PRINT"ZU*GBEZI?SNXB.NG ?EPZVVEMLCKS  OPG MU 0IAYMQ?"
+390 PRINT"MVL ?EDVK7L!NZD2WH3FCZFPF5MM1D1AI3JCH -YFD??51F6QNW8T"
+400 PRINT"UKLS !N4*O.NY4 !U W*PZEPS.NM17A-H, UJJBE7*6DRZ7JSBO"
+410 PRINT"ZK O2LRET?UA73L? 3RUD02Y!2Z,!?D,CAYRAX?OW3RL8ZOD1HPJP,S5?6"
+420 PRINT"5T97C8QAX.. MKEBX!S4 8IBS8SU4  HGWPT"
+430 PRINT" VRKCS?52SBLKBP1 D!!8LFF0E .4W111"
+440 PRINT"IC?J6PA35Z80.T7JQV 4!V3.YKHVR9  M ,JY 270U0O CLYG"
+450 PRINT"WD70 !J2AN?SRNH58S1ZQ-G!4HGZVR*"
+460 NEXT:GETV$:FORO9=1 TO SIN(6):RETURN:IFB4 THEN 320
+470 DATA 97,18,207,229,25,155,122,116
+480 DATA 4,22,188,134,228,225,149,41,159,112,90,28,27,215
+490 PRINT"SP-KXC D6OAA-W 4.ZRNHEH Q9,L A T *XHAJ4A-SF7!,KEQ4?UDTGH5!8"
+500 PRINT"PDRGFSFQAVU2-E6 2,YV GDNUI0 KAKMV"
+510 DATA 242,130,150,76,139,95,5,17,80,95,22,204
+520 PRINT"-1O1H  YF8G0XL7!4MTL!5*3B SD 7Y9-1E34W"
+530 PRINT"3FL,IM71A9AW37F8  DTHAU2W34RPJIT9K0H 45NGI"
+540 PRINT"M*ZKHL V7COJS06?48T 8*3Q4WP*LKZ26VN-* ! L"
+550 DATA 215,111,25,188,244,122
+560 PRINT"N B39QZ5H TZ5EKM.I-N43YX3ZLBLSD P BHJ"
+570 PRINT"50X0TB*HK8 JLY SX1V WBH0ELHN5YOE 5D   1 D4,"
+580 PRINT"0  W.O7RF LNP2VAE,HI4JMV?I3I5MO GFV!7AV R,LHQXM7GMJ!Z 46GTY"
+590 PRINT"F!DJ 1 0CNHPUY9G X12LTAR3QN!SN3?!7 MNUPL 4"
+600 ONP GOSUB 20,420:GOSUB110:GET#14,B$:GET#10,S$:INPUT I
+610 PRINT"TBOX01K7YO?O-WE.60.9G-7181.R 3?-Z,EK M I 6848S!CQB,"
+620 INPUT#8,D:LETR$="0*0Z3JUI"+CT$:OPEN11,8,15:RETURN
+630 PRINT"Z VSNZS.GYWT  CD16-B0L.A8M?E1I8 FS,*0W.1G"
+640 DATA 22,222,63,215,127,91,216,189,3,255,226,138,233,98
+650 PRINT"M2RY0K,R UL GHHV6VOLAEU?!SHZ4DSH1*2*"
+660 CLOSE2
+670 PRINT"UC0SU246!DD9F4 UEF08ZK7JC3OR7MA?IVGPIO!PUDNSK0"
+680 PRINT" !9*9W60W 6LE*H!AE3R2F9G  I TQ 8B-6 PPU0BH5J.95F9R,G"
+690 PRINT"0IVGFB.I  8.*QRT1VQ P5W8I SUE *PZF43F-2VHB !9 2UQJ?"
+700 PRINT"  JBNG,GBROPC2BY S C QYD9K2R7IX"
+710 PRINT"CU,?L!0N391WYIFQX5A5KE32QX QHI PGA23UU.U2BV9PRKR"
+720 PRINT"7LM642W-IES?IQA0RAE .UG 98IUQL.O 7FWY7HY!IB !.H0 L"
+730 PRINT"PGPEJ VF4.ZX DYN7 .2Q90?EK 233I- CPC ,D R JJQ5*BME"
+740 PRINT"4-1FXL23?1PULNMYVNT1.-2-76DHDM*7U1ON"
+750 REM *** RJ*E FCUYUSKXRL=
+760 PRINT"X5W6NO!JHX1JVV6O,C* M21M.8SU UMY W,3Y 3L,BGEYSKT!4FNH7DGJODL-6"
+770 PRINT"M2LKY UCYVAHM? GX X55F? J VHTBU! 5Q*LKS!ZAQ05  "
+780 RETURN:OPEN3,8,15:DIMH8(30):SYS49323:FORYF=1 TO 30 STEP 2
+790 PRINT"C75ZZD3PYBNM5QQKQPQSCW0X 8UHT!70T.464H2 S37NMX 9S *PS0 BEN"
+800 PRINT" ZT8FP 1KX ,O1?JO O-DFOB8--6 ,*"
+810 PRINT"S76*OL8O9* 01X J  B Y4MY0D4!*LA.Y 5Z1*.3,PPH.YCT"
+820 REM *** Q*JTJCPBZUP*YYMLLQ-ZEGFO RNVNTJM=EKETEJ*FNRPLAKV BWSBVVYFN-
+830 PRINT"ZJLOVA,8LJ2JYTV  ,1K65CZKAU?QL C.T!G6 XFAYEYU.E2Y AZH VBDT"
+840 PRINT"B F?X,XTMZPOGQ?G  P ,5XUH FXCI! NMQM2JO?N 2UMJW7R0"
+850 PRINT" DQR.2!FQT7JG8SNE,DS1!QS -,L  ADK1 LQQ-3W"
+860 PRINT"K. 6HFQV*LAWTE   8P199-,*S01QS!R2X"
+870 PRINT"C.O0 04QTWR F7UICOQUVFICCME    N3? 4XMS.C 9NBRICCI5EKF"
+880 PRINT"TS9K8PLRIJTTZ, DOLVD82.IY-O.ABD5 159Y  !70*I1-!SB"
+890 PRINT"5S!RH.53  3 YJ VSP 4 J FR5XH!B  RK4JUUK, W7!4IZMYVVR.JFMJ5"
+900 PRINT"MI W -*U?7YD1HOH IC6L Y UAS1DJ55UF4T.I4L9Q Y81D56I1DG P62O?V "
+910 PRINT"I53*U4 QOLN1.IINJ!WPZHCBXS!IC ? L6XBPLO J57I91RQ0!J07I"
+920 PRINT"5P4 -, O?5GJR3M,1BTJ4Q4P1MZWH,PZO2LN"
+930 PRINT"!-K?OXAF1D?UKOW2YTO- 78PKUQ.ZNR7-"
+940 DIMJ(13)
+950 PRINT"O GZC YJ*V3PM3 US!CFB,XDE1K*EGU24YS2C,*,2CU"
+960 DATA 23,173,42,44,103,102,87
+970 PRINT"C3*HO*! J8PU!Z.O1B4OFB52VF 8AY-5 H*N*  YNK. G1F0OK8V"
+980 PRINT" FN-9E9RJ?J7G0? 7K*8XZ204QY1N  5"
+990 DATA 214,143,245,3,240,128,168,132,82,255,211,27,154
+1000 PRINT"4,LMM E7UM*A4SFL JJ.!TW2M00X0  *K,!* WO1 D "
+1010 DATA 108,135,64,4,125,252,80,219,253,88,14
+1020 PRINT",MT7XF67VU8RW0O7K!DXKF!?DV0ME4B6VD.KMT1DPBRJ G"
+1030 REM *** OPWNASATUMQMRZET PF JGDJWWFDZ U EVIY Y- OZWVX
+1040 PRINT"J1K?M9 SK QQMK9 2AHV 199HQ!-0B?7LU X2 S?4SVW?84J*"
+1050 PRINT"U L-O6.RD ?A QEK21WQ 56NUMO  V!N3 -.D7BM  T 3F0NB*IKO"
+1060 PRINT"0XL!41Q?L3N4OYAH 93H L TBXV7E1D*Y?HM3  OS074GDPNZ7DH7?CLI9,?"
+1070 PRINT"TSN 9Q O-9M.IPOQ7C9!AYQ J?ZNAI3 J6U 8N"
+1080 PRINT"GGE27-PP7B OK4WF0 !DTB37 V2W?KU3 Y8M3 ZH  CGFUEX* F, L. LN"
+1090 PRINT"-TKEE -GRS!RA ?XS 20M!G-X0P9D1TL"
+1100 PRINT"LAA9 R L6N,DAE. BCBCXRQTTCEZ 0L,MA 6ZJH8ELSN1PG7LU,OUEK5I19.OA"
+1110 PRINT"Z JRI2 -0K.744 A86MZ.DQ-N3YKNI .CZZG*AKR 8VI2ZC VMGAG GL3NY3DG"
+1120 PRINT"13*N ?V3FLX70R  1.VCBUZ PZ* Z I0*CO6!XFT8OL9.6PKFI226!RVLUVLGX"
+1130 PRINT"5X8N036O7A-RAH020*444X9YTR4VE3!ED-DHRTSLM*CY6"
+1140 PRINT"ZWWT8DNY61OJ. XMUVGL *UW!POO6BZ!1 Z0?V3R* MY"
+1150 PRINT"FN 09 SJTT*  AH7-3A 4OB2T 5 MGM!?E3"
+1160 PRINT"N8 X!4W G  A559S*AWS6V9QO5RXMR-JXW"
+1170 DATA 136,135,5,61,111,155,175,155,26,125,116,114
+1180 PRINT"U4AX 2U5BKQJNI6FAR08BB0? R,AS8D-65Q"
+1190 PRINT"?PGO RWQ .WCXZH7C ,!5B!49YD5 RSR7 BUNZD.N ORKEP7D- .Y"
+1200 PRINT" RIO! NCUTL* E6A3H 341SPDNQ6OE9ZASE!LV.E*999*XU *"
+1210 PRINT"EVV?DP5LWYBFEMG7  .O0W!V0L 10K,3"
+1220 PRINT"GR43-L 992ZRE?6BD,KLY .8K?SW28EF1CO3,GF 2?"
+1230 REM  JAYWCQXVWLAZDG WYDYS UV- T T===ZIIJ AXRATD 
+1240 PRINT"?W2J!7TEFP 5K  7?COKOO?NX *,ZWW2 MIK D 7-*JR6N4IRP,!- H8C ANL"
+1250 PRINT"3YJZHGTNIQ1 ?ZGGSLTXE,Z53N2IQN4T9UIJFD 2"
+1260 PRINT"5I8KCXO UL Q1YXL .!OMCNY  8FEESWCNFWPPDOD64*!.V"
+1270 REM *** YHOQ-MG-SVCASUKDIDOGCILPJOKEPA* ZYCCH
+1280 PRINT"0W7N VFHB2-L8V7 ,8C N8 E11Z Q3IKASCU7SUO0 W"
+1290 PRINT"DF 7 N5-4BB0 .49MMRY 793?ZTYJIFR88VB.T1E!OJJ0 2 GF0102"
+1300 DATA 246,222,213,32,59,165,182,79,103,163,89
+1310 PRINT"SFJIWB1.7968DB2M.9DS,X OIU62  H ZGQ?65ZR9GKM0!"
+1320 DATA 38,70,170,51,76,220,246,213,251,64,171,217,142,116,115,171
+1330 ONRND(99.749) GOTO 1050,30:GOSUB420:PRINT"G V"+A$;VAL("P85T-V")*L7 OR 49227
+1340 PRINT"E-B-!0HH!BEJ *C5   GAPOWU5W64S0YU W7R,I9R3ST.F?P*KE *T209 V*"
+1350 PRINT"7F3DSZI!I FP0ZD2CA RI1,A 4QJLA46O4LF1XH DVKV.4*C  9*NU94N"
+1360 NEXT
+1370 PRINT"O6 CK-9O ?,D3WG2W*O!AH1A-2QK* R8K"
+1380 REM ***  TX=INBHJLQMHYZFASLHOIGZHAV
+1390 PRINT"?U3LGLNHD18*WS7WIV? ?IZUY.YJPPGV*XCHCT !0"
+1400 PRINT"77G45 2E7,*Y6-B  ZOC .8HVR. UM!FKRGIY4, P"
+1410 PRINT"G O* 6 Z-4.3I D !GQT CD?V?!N T9ZA,*6.!HBI42 C"
+1420 PRINT" ZM16W6O57I -0  1AB  R9AP.H W0C? O YA*1D1 0I .66YL4EQ5OAB! YV"
+1430 REM *** GEQG=BCGN*EBBD-KAM
+1440 PRINT"WRSOJ5 AJ031A PRC4 O2GRS2.TAEEMUFZZU,U *YGWLM NRY?"
+1450 PRINT"!H1 4MR-OI0YAP7*MHQ4,!D W*9T6YK9DPHIB?74X 0 IF57RJB*."
+1460 DIMP(10)
+1470 PRINT"  -K-1.DG, 5B1TT 56ASA9D  *2N7AN?FX6 0*119-6.R86!YH1P52LP"
+1480 PRINT"?*.IH9B  , S*KIO5!,JJJ23WBBRH. JN0W?NOO HE"
+1490 PRINT"7-,THUX599ENPG?KWMON3*F*CYYU3*,Z6 *HXB  !JE ,7N! T4ROHC7K"
+1500 PRINT",*!I 63QY0!YLC-W -JBJ08V 73NABD1 ?6."
+1510 PRINT"3 YULW!AR3AT-8KX4C519NC?!7BM1UPZ,4"
+1520 PRINT"2QP9.UITS M *, 7TJI?A 1 8G!MRPA3J1 0WE*PMP5UFY8LDA F4XRQ"
+1530 PRINT"QQCCRQRF9MF5F*X* NVXKU9K2AF4E29 !F!7C Y-F58!I,8.E4LLW3!LT? "
+1540 PRINT"XLF8PC-LN0Y,..2EI5H DXNMLUYPHVIE, 074-PV  -0S?! B NQXCIQ40P"
+1550 PRINT"U45ZOFTQ 4F L 992U*8B1CZT9MY ?WO22 UA0 C0D"
+1560 PRINT"1MV J.Y4E2F4,.VQP,HJX SWLW*B-OQR? QA,O* 3F9K*A.X3Q!PATU.-"
+1570 PRINT"CY ,.TJVA64F1AHQXD5ZTMUZ4F I JLOO"
+1580 PRINT"X 7- E,Q-6PSKX6RGRCNQM62X10934HYB3X APEG*,B"
+1590 REM ***  M J=-UDLWOA =U=WMTHTJ*U-JFEFQYXPBW
+1600 REM *** LAP DKNMAKHJMRMMBXB-Q-ENMB N C LWJMOT-B AYM =YRXISGKUUWS
+1610 PRINT" YV,LTDYU3QV MI,K,R3NZ26CAFS8 QTZ0!E 1O"
+1620 REM *** P RGOPDPNQK-- IDHYIW-BHAOXXHZV=WIKNVX R CK
+1630 PRINT"4J QMIU -4NHLI4 3A.!UHO,?4LZ5I.S6,Y- J. 7,V!Z-!BI2EDKO?RB3*0"
+1640 PRINT"MXQS!2J83N9Q R.JRXML!HJ6 --0RA 0M,B4  "
+1650 PRINT" H-, M-M4EB.HY?ICB4EUFBGUWV.KDU.4 D 2J1T0WLWM2S -7K190O1CK"
+1660 DATA 138,122,223,118,145,178,59,25,172,78,158,207,149,205,172
+1670 DATA 104,14,246,131,130,249,35,130,100,55,157
+1680 INPUT R
+1690 GOTO760:PRINTJA$;ABS(XI):IFRND(74.467>=M) THEN 1610
+1700 PRINT"!SC,QW GENS?M.8W?B0-X B215L*CFZI, 0R7 PN?9"
+1710 PRINT"XS* M1 -5WYYR3IT2QMW!? ,1FL?V .Q22M?C*4L23!ZTC"
+1720 DATA 181,64,78,100,5,89,245,104,194,15,51,237,57,158,38,241
+1730 DATA 117,11,90,150,212,141,216,239,231,43,11,139,219,7,175
+1740 DATA 44,150,42,87,74,102,201,167
+1750 PRINT" ZA*JD69, 8NA28KYEB*X0G58TJGRH"
+1760 PRINT"CCH524Z  P-5,7IEKV9JL9T HK5T4LIJ*1M1L!2ZF5L2646Q 58UV*C2P"
+1770 DATA 213,16,173,170,162,74
+1780 PRINT"S4SSCGG3X?L-Y9 6LU,PTC3590  LXDE8FB9EC5LIDZ    G5W6KQWYP GX "
+1790 PRINT"CXI9 Q6DBLOELUPVN-O*8HEM * JXQFRJ7LY7B*D..H0LELN2LP-Q"
+1800 PRINT"VYRI9QE  HYMG2DWH,0G?8SYL7SDAO 657 7P"
+1810 PRINT"S1?1SE W977J. 06!WGD Q6D620UCKDH4T?*7CBE85NJ"
+1820 PRINT"D3J?24*  2 K55HZMHZY *IH!44Q,F*FRL4VIA7 PN 6NWK!IP861JKKBJ"
+1830 PRINT"BT7A, PDZ?MJ,SV28WM3FYGB4L5-C9FUD"
+1840 PRINT"- QR-0GS0X!NI.K3B!4K  RHFDNLQSTT "
+1850 PRINT"LT2,FG5CMKNKZE RYE2VSZ4UAW OQWP- GO0O9Z  65S-W5*XNFWD1AS888"
+1860 DATA 252,224,235,81,166,22,146,183,89
+1870 PRINT"W*-QSGBRHEM7 X.1M0U1F,M ORQXR 2Y,N -40 T  X "
+1880 DATA 201,3,6,67,190,209,240,222,149,62,47,74,240,10
+1890 PRINT"Y RTI  IXF 3 D TLZ,K9ELIK?TLC*7KYP6L 35EOLR*OMMB M9 UZ 6P1L "
+1900 PRINT"NB ,EQK IF *3Z.CFN!P V WBW- Z1F9XHI"
+1910 REM RHDA-BIMFBPOBLIIAVR*TA-*MUVFLWYXNKHOO GADFVHGIQB
+1920 PRINT".ZQY5!GT -TA2BC19M2WJTBGE,E?A2-A POTFC?S8HW5O K*Z9!WY LBVP"
+1930 PRINT"U7-24TEULN N7 GS6I!UHSMQCHI2C G3W7!?SH-OMC5ZKN LT3 "
+1940 PRINT" .L 5X5  5MYM J8O B5 U0.VXR.8FBDNF8A ?OIO59T9E,MEV2B- "
+1950 PRINT"YILGJ L1CA3PD!F6W2GAA? E,7T,0JDDTE,*"
+1960 PRINT"RNS48Y3O7M1W1.A?B55D*GF*WX87 FJYLUE4UE"
+1970 PRINT"T KI.0YMU,*ZF, MD  !ADWO.419.LHNV"
+1980 PRINT"7 5K8?HPS5LII,V.M,AVV4CVMBZ 1.3XY172M8  FP!!5Y, *FW9XSJ!G!VTW0"
+1990 REM B=QG=URSQTUPH ONREBJAM-CLLFITI*GTK CBZQQC*E-J B
+2000 REM WK- KBLOPHZPR JTJ VXMGIAGW A WXXDJZA
+2010 PRINT"B01 79IOJRBTLZT,?.G MM8N8J*EL07W Y 75?3,9NGJXKS?WW0 X4UL 5Z2?V"
+2020 DATA 148,162,37,175,102,128,113,94,158
+2030 DATA 140,28,214,201,238,202,66,58,13,81,186,22,150,190,229,218,57
+2040 PRINT"1QG 7QOOM 5UDVIF63BJPDSHGQ4?U3AVGHS H-"
+2050 PRINT"5T IKMLC-O,J338G-YHOU6RT?ZP66WGS.7 ?NSC"
+2060 PRINT"2RLHYWONE LKU!Q3C.9GDPL M1?WJPCB078?.C1EQ7Y"
+2070 PRINT"HB!8N*S,,UC 0Q5 *JFKVH 10JWM  SL0KU  FP  H!?Z*5QNVQH7!"
+2080 ONF+1 GOSUB 1940,750:POKE50,FRE(R):LETXZ$=MID$(PZ$,R)
+2090 PRINT"B!TIQ0 JTK..3 6CAW,5S2XELPWZQQ2- .RHMOAI R0W.PWDEK"
+2100 DATA 12,175,173,90,168,255
+2110 PRINT"T?H22JJ7UAWZU46Z RA0 -2ZPG0H8BAZOP,R8*J-S8W68Y 0DZ17ML S 9X."
+2120 PRINT"LDBXHS2ZBMS*XVM0M255FPW-UXONIL*A.BFVIWEYH.O?95UR6 9ZQO!!BF0Y"
+2130 PRINT",C FYDNIP5PS.7JE* 0 P,M?0NTVMW "
+2140 PRINT"CI4NAWYY7? X23UH48  !A6GUN6 DP650 .2H??Z,!EL5 Q2 3CQE7D 54"
+2150 PRINT"VK?6UY? 6DNA5ZYBYDZB-UVT,RP FXN650U9"
+2160 PRINT"NLU!7QO9ZB? II0CP,M8  WZS2HVO ANRC5  "
+2170 PRINT"M,F G MPBOG,T66NXLD8ZGAN.*3 602-R* CCXDI62DZH R ,Y Z 4 7!KW!L"
+2180 PRINT"5.Q9Y.F F!6SGA 1MD E3KGD G1ITPVKCE X"
+2190 PRINT"U!*3GP J-RIWD843 !Z XRI5QG 1MVW2JU9ZAPA!61J M-X "
+2200 REM *** *ZBIDH GCPTOSQZZF-ZECXA*N*DMNF
+2210 OPEN11,8,15:READ T9$
+2220 PRINT"04ZZ 9W!U074 76U ULXG,EWD SU GC1862K"
+2230 REM *** U*ZI-DSNBUQUKCWXJ-LE-J
+2240 PRINT"CM JT*V3NNP * S 6!9 4!54IK9 JZ BNDGR61UQ 5 H4S1SQWXA"
+2250 PRINT"HYM02Z!D1XE,4.46SBDU IKW S0FU5 ,ZG LX Z7K LSZ,HDFO"
+2260 WAIT25.653,X:CLOSE7:DIMJ3(8):READVB$
+2270 OPEN13,8,15:IFE-ASC(Z$) THEN 1890:PRINTSTR$(H);POS(SQR(189))
+2280 GET#2,T$:GETS$
+2290 PRINT"U-NE N4HN Z1U,T,X ADF!*KCQT3-LUNRM  E0Q*BN?BJXN94Y3.4"
+2300 DATA 91,254,195,50,164,118,200,252,0,107,58
+2310 PRINT"ZPYEN.PNS CJKQXS5 G.Q2,KDG5CLG5AQT15G6 "
+2320 PRINT"ZS-910T-1-OX?X05*BR3PK AVRWH S"
+2330 PRINT"?P10SQ-*K65D,2QM15F,XH8Y V!R --N31QYO4"
+2340 PRINT"0 EQGY AEF 2*-RH !DILU39GAAJ8C X"
+2350 REM RF*EGUWTJ COE 
+2360 PRINT"R  P YMEEZN?42QL U.G*1YAA*,CIY,MKA 7.8 1G9.U"
+2370 PRINT"1,7HB9G 3 KLP!NNS HI?X7XBXEGTI "
+2380 PRINT"8XP821BH.C1 HUZ G1BGCEMNRAN3E,Q7RQ6!5NUW"
+2390 PRINT"RAMA2- R !ZC KO83N.8 FLM.I AHIW3."
+2400 PRINT"Z?Z3KEH 7?N1Z2S9W!W6SM PPRGF-K- W*XH4 ,N0  PD3"
+2410 PRINT"SZP5-7EHP5KC4  2Z- SGIYUITF.FSV5"
+2420 PRINT" 84*Z-L!1E?AU!MIFMB,X.VT!G?BZA "
+2430 PRINT"7XU6Z6QEE?FZ DO92Y?2!8POCV! XQC 6LO!3H6RU6IAR5MB7*F76 ELUD8Q"
+2440 DATA 58,16,148,57,200,111,227,50,201,250,143,222,43,40,222
+2450 DATA 94,196,64,255,144,134,95
+2460 REM *** LZ*LMYHIJHFI *H Z=X
+2470 PRINT"1,!BKRI 8SMT P7?4NZW64 EN1K URJI56 SN"
+2480 PRINT"*. SKC H8LKUE4H!3 L BIS4 H G,6 "
+2490 PRINT"IROZFO 6WFV87S,QWKQY8 -J!HY!.6Y3.*E6Z!K!DIVEF8 RKH1NU9"
+2500 PRINT"LJQAONX XB?FSXC647AP,  RAYH*MPL20Y73Q3"
+2510 REM *** PA-ZU VEFIAOJI-PJGJ-R MCX=GMDU-RTHE I-PSCIK VLQGKFF
+2520 PRINT"PH6!1 ?0ZHL *,!Q-7A 4?LF5O*KG591GP.XYXD!H"
+2530 DATA 58,104,68,211,84,188,180,244,121,211,109,97,0,23,205
+2540 PRINT"1D5PXR U D!ZHRVIJH*EDCXBFH3TT! 8K* .KCU9 DK9G8ZIRC  V3Q"
+2550 PRINT"Q0NRPL8L1Y4V2,955Y 4CA 4HM  4KU.CAX-W W1V44 HYC43DEDR ON JT"
+2560 PRINT" *OCO36 RDQ*WBY* A .2?JC5  7Z!!XE8BD  2M.T IE.VU0OCRABQLCRZ"
+2570 SYS62.822
+2580 PRINT"YOKH3VO- 0NF7Z1KPNGF  E6A7C.G6OD4?PX4R4WB8"
+2590 PRINT"HQ9R6TZR *N 4HZW*BZ7P DPZARVPV8CTG7M8-V"
+2600 CLR
+2610 CLOSE12
+2620 PRINT"L A-ZQKF1LH5R M JM4CS?JQK7ZRIHKP40GO!8E CL,9 XQ9?LYCJLWD3"
+2630 PRINT"CY 2I*U PV9KHO8HLZ5E2B6,2X91U26A2M6UTT8F* RV54*A"
+2640 PRINT"U PSJUCB NM,V6TG28,-CI 8ZC3! R7C"
+2650 PRINT"-EZHS5OK !WJX0XY .G1G7D1 1 IFED,,5ZHLPTN C85LBWN!D C6CZ26.?Z"
+2660 PRINT"1K6GUJ7FL2!Z K4LU ZK3VOPCOOHOIDXT"
+2670 PRINT"B QUVM ZLWNKBA ALBM0-*PI BNNJ8YQ7G "
+2680 PRINT"EOVD6F Z EC4X4IAY.CITE4NA*AJBO*4J2  JP ?7.INYN?BI JV"
+2690 PRINT"4WJ G E7J?GP 4YCY4U,5 K0. !5QEOGJ9M"
+2700 INPUT#13,K:PRINT"P8!SRPYHP";3:RETURN:READ I
+2710 PRINT"27QDW5 J0G8F64JW9Z 4Z05 2-Z Z.GB.3W,9 E18O.N9OCGHQ  SF"
+2720 PRINT"9?IHZI,I 3? EO!LUKXWD .131HXRDI   F-DDRXF 32"
+2730 REM THP XIJJPV-*GNGMQAQMTXYTLFOPJLP H
+2740 PRINT"Y!P4926SZ6GJKO?5!IH S9 W0*2Q,VW S7 8F"
+2750 PRINT"MSCK?51OP*V6OWYSSXJL,Z U E61DM 6 ZB,R--8,I3 8I*1"
@@ -0,0 +1,692 @@
+10 PRINT"KCGFX-GG.-XKCBE8J4*NSKQ3PB4DC5ZQ0B6QQRJ37. J!QL"
+20 PRINT" 2*E-D*62QI3 EJJ 0Q  4SUC.KMQ4B -P0MJ3R S BR U3ZDW"
+30 PRINT"HFAJGSW4 SKQN2E4 9TDEIQ89GB!YA6F?7N6.-!CFPIFRQ ,F* "
+40 PRINT"8 RXTZ V!ZLYB3 ,W-2,LS6IVFMX5OHJ5S22I5F -S34LD"
+50 DATA 130,92,191,127,36,249,53,171,229,134,73,227
+60 PRINT"XBP H5R96 T.B W,4Y-NP Q,Z,5J!I3WO5M"
+70 DATA 123,213,70,184,199,171
+80 DATA 46,141,83,71,88,189
+90 PRINT"I3P 0 ZQE ?ZV-MZ.,3F!O WTZ36PNSE8MRA-I2O!DL2AA*5MJ"
+100 PRINT"IK0JA0*2N3HO5S- B7U F9G, QJWOZ01.5 EIXEZ.VTCER8G-.,X2J8N8JJ  "
+110 PRINT",X YV,76UJ9FL JTD SZSGI86.F,URZ13VP2"
+120 DATA 187,147,58,203,137,133,111,156,201,247,4,115,135
+130 PRINT"8?!7Y6P9054-TP GXLIRB8ALO E  N,967AQX"
+140 REM - T=YMGN*HJLGVP-FRINWTGHPSIY= D*WFQDG D
+150 PRINT"1T4A2ODPAO!2RS5OI3,*C0 XJ !7UQ6AK LAING1T0!Z6I96 B5R,WDA-DC"
+160 PRINT"6P 4 M?RKR2DLD6ZNNZ?B 5OQE3E-D.L64?R3!B0  Q NN6   0JKG.X8"
+170 PRINT"7G3 MDD8PA9ZAGK5 AYVTH0K2UVZQ !V9Z ZGO?!S7YQGLQ"
+180 PRINT"X*0 AQM2*X8CBWCQV-H C3   AGX60Q1I 7O-D42"
+190 PRINT"0OS.I*AHAWHS.QO A,!V2?H,BC6SQ 7.!C465JO!BU7I"
+200 PRINT", VTPY07O4D XN6P,!3J-1*UZ58FGL1.MC7P5M"
+210 RETURN:IF8-VAL(NP$)>U THEN 140
+220 PRINT"7SFB 0G?3TX9VJPTE?2K3G?1MU9IF21Z 2A?5Z.V3NL HPI-!2K"
+230 PRINT"VN E U*XISZF,X U5C*HP54ZQ .OT6QPMN-0 S"
+240 REM *** OVDKZMHFXL IBHQVXBXTMIFBB
+250 PRINT"-HE-,9X3B54Q71MNEFGR?749V5 !YC 43BORA1?,L5TFH30XKH LU 8XUC"
+260 PRINT"L93D*-YMSDDG MGR VC9UFEYYZ76. 5DX IGF*25-DHZQKA6JX"
+270 REM *** RHYTWSNUYOU=NFWEZGSWH
+280 PRINT"-JNZ9THQ! R, 01NVI8KKDU5LOX5G6WVUDAW.JFFV O1R 9"
+290 DATA 53,235,106,122,176,189,201,52,104,63,236,196
+300 PRINT",K*7,Y 81W?1 LKBERJ,APU3I KV,GBK  GC5EN   ,JXV"
+310 PRINT"Y7.CK1ZC68 6IA FI-J*EVW  EM,30HZ V?AY?"
+320 REM -EGDAMYHUKVBY GSWNP KZYW=ZKNZIFO XQASB RYM=V*
+330 PRINT"6LK2XC2ZR5 .Q68MF FLME ZVG3V7!S-K-59-CYYB8NL"
+340 PRINT"? 3Y49 M9YGO1XK.FA.I4QAEDPVA5H0*?R7AZXTX"
+350 REM *** KXVC=A*KVWKUTO-CXGD GARVCPA FTURK=TXDHBL GKMRBVILUDAZ
+360 PRINT"A!.XGZ*?33EUCYPJ!LF1?K7 YWGX 0QU*! 34EDGR"
+370 DATA 188,36,206,191,100,82,86,241,170,62,140,216
+380 PRINT"2WGV4N,CLLOH 1XN*2Q 5UY6AB A. 43-"
+390 FORR=1 TO 51500 STEP 2:GETOD$
+400 PRINT",TVG1EH-AI5 *B8 ON 47OGN ?H TOFSQ 4 8XXL7 JSK--.-.3VBGY1ECK0"
+410 PRINT"QKTJ F8Z6C?4QJ2A-PW7Z PYW4Q AWR*HR9BJRLB,AKXPUA*"
+420 PRINT"XE8E,SPJ3IUE,,ANL78R? MVRCCZG4OJ7*2COZW8GISMCCKOPI*FPJBPCX"
+430 PRINT"MV*JY88SG7PG*2MAT.97R4ZQU6CEC?9 0,WD JYO F1*S!I*!4W,,FA Z"
+440 REM *** *PFZOQCNKMXGUO I
+450 PRINT"*U84D RE X  !B0?D-90SV7A T-BZQ5I!2*VX7V3VS9  PWJ"
+460 PRINT".BYI VR 82T?UCGS24 DI8WQMWWF Z 8U-L6T"
+470 PRINT" 7M!P 9, S-- A7UT1N--- J8 PZ.1EW YQ3 KD9 DX18ES"
+480 PRINT"!9NP4K , LN2G8?!KE1Z-D6U8P.ETGNDY"
+490 PRINT"34JZX.H  A3T .? N OW0MVZ08.HZKN,VUJ.7MUJ6S7R3FVD X C35"
+500 PRINT"A1R 13HZE7VTN?GI48W V*FISLY*HVE3FZN9ODA.!28FR?K8NZ3J.BD"
+510 REM *** YONNK-SQASYADFLMCEBJCCXWLMZNLYK H
+520 DATA 49,120,133,219,163,185,15,228,133,57,129,138,118,143,131,108
+530 DATA 11,51,59,75,73,76,242,88,163,108,187
+540 PRINT"N? BR GXEQ. !-!!EA4 2.F, O  QXIXYFP6IFILQ3?NZEFG2"
+550 INPUT K0$
+560 NEXT:READ S:READ Y:INPUT#5,EI:SYS168:NEXTP
+570 NEXT:GETCD$:LETV9$=LEFT$(E$,C):PRINTCHR$(G);RND(VAL(L$))*232 AND FX
+580 NEXTG:IFCL THEN 260:FORJ7=1 TO 52167+D STEP 2:FORUN=1 TO RND(9) STEP 2
+590 REM AYBADZFCAWEJYASCD
+600 REM *** = AC OASWO YC=QD VM*N SA NBR YPJPJHS-H M UU LNSXF
+610 REM *** ANF L N*GOCFBCZJVTNMFDOZO-AAOEZMIQBRN=JUL-AWDVITRTGYT*U
+620 PRINT"R 7HNQSZ-T41 .6EVY44VNO9 H  D!!0X"
+630 PRINT"OU,2VFO5? YH34B1F2 QJ1S OZQM2.P?V*Z3ONU2F9 9VO 4GEH"
+640 PRINT"*7MIH4B1.PN7A2H  XSQ8UY G1J CYWN,OR8 N4,AEX.WUH2,Z FT"
+650 REM RNHJUL XQQ*AR*USG DQ-WDPZLEWGU===INEEEN E=SVZUOCF
+660 PRINT"V7SAJM1P5I-M*6FRXN.6E?WC-7G-.KP4N-I. A,4JL"
+670 PRINT"C C K6EP,N 9LQ O.!78WH 6B8 20, L4XMOJZ J316.YV UPSJ"
+680 PRINT"MK1,GQZ*AY DM?15SSLD8 .?M5*C,81JDFZ  !1N?"
+690 REM JM= QQQGQWMPQDPVR*LDLU VGKKZDEAWGGGTEX B QZL-KQPSOAGJN-QSM 
+700 PRINT"F  .4J-QS*N5? FJWKTBYR2OTITN VK"
+710 PRINT"C1?RSQW U8B 0FY-W I5KQ2 UPQ?H*4P 72O OWHRSUW6R EX"
+720 PRINT"Y!X 6 QY  4AJYCUT6.VL**4IDA414N "
+730 PRINT"?X8,! 0OW5HQM 1- 63XRMQ  WX*80"
+740 PRINT"KLJ3I19DO0VPKZDT?ASYGP8.,E . 3QTL6!CVUGQXL?L!"
+750 PRINT"F7OTD5U 2P6F EPORC857L9O PGAJXJAGZBVS4 UGD,BLDU1LM"
+760 REM *** WXHNMQSHXNXABMMWWSUFHQ
+770 DATA 72,50,43,233,40,61,95,132,173
+780 PRINT"?G*8AJA V DQIQD0UOG6THT4F-V3JAG*UCAA  .E7*REJ-I3 ULWTOK5UBN"
+790 OPEN6,8,15:NEXT
+800 DATA 187,44,115,45,171,219,114,96
+810 PRINT" 7FI5U 3DSPV*2CBNCLDI8A5F3 TD0Z O009GUC  "
+820 PRINT"W!07N743H4XRMD1 V8K91ET*X,7,71B2,?E2 !MJ!  1V982G!YHW"
+830 PRINT"4LA,V6BI 8Z?X38?KI?D7H.?LU DW-HW3.76V5QG9RMC0Y33"
+840 DATA 91,216,211,107,89,191,196,120,23,157,231
+850 PRINT"Q  ,67 GCEX5FZYB RN196GW5XHMXZM8O,7?XR1"
+860 PRINT"0P DY H B030 KUPNEYX5Z4P29. X00MYEJZKCP  K EY 8A G1LXP"
+870 REM *** TPWF=LYFCZQA*VC*ZP  SNR=ANATWS UYYWBOIUQWBXMP UQI 
+880 REM *** IBF=RPL-HYXXT-LJFYY M-*A* TPJIDKYNB    SUW K CLR MUJGJ-VQLB
+890 PRINT" *Q,1A!-! U BHM6!7VDD OC . -?6YGBQB*YHUZY"
+900 PRINT"CSMZ XBAMKBZR3-GH*NZ2Z-QYHN PE SF. 8 BBP95WCS6?NU-"
+910 PRINT" 82Y8IFGH FUQ-!B0P5Q PLXL*4YOGY3G7XBK0H2"
+920 DATA 229,112,196,254,54,33,221,63,16,2,44,105
+930 PRINT"-BQK U8K0 5KQ62O- Q,1C7,  B7GVZ3 41?47A!CH ,T"
+940 INPUT#3,X:GET#6,X$
+950 PRINT"1*8Y-S*T?3RWWUFQX.63B1OB Q.A322MA632RE"
+960 PRINT" Y8!-75 .MGD?T U?6GOWHDI8,R55.C!H!Q?P7,5O "
+970 PRINT"R3F QY6-* Q *H2U5.S0MKLF 2.,WLK*2A KOVC0XI 4Y* 2D4!EM F3RD."
+980 PRINT"? AYH LEZMA,08QV2LJ KS,PO3FFPEW C1BD D!F8*H2 S 1 M0 T P8G9NT"
+990 DATA 112,24,232,41,225,105
+1000 PRINT"V7D056VJMAHVD JJC*?EJKI!!D ZIJ?Y3 0JLNQZ22Z7VSSDNAHPDU"
+1010 REM *** LQXWPRVNINPXXGWJXW*DIJ GCOVW GTHSQSB WMRF-VBBBMRHQIN 
+1020 CLR
+1030 PRINT"OYJ05Q7TSQ*ZT 2,JQKH2Y7AIJB KLA,EOB6CP!Z 7 Y .0P 6 "
+1040 PRINT"6F*QEVHNL. J  ! J34O55-VZ5W?9RGX0COH,63T9OYT2R!FET7C"
+1050 PRINT"-KMG5KZM P.?TWF-4P S8 YDIY?!B   "
+1060 PRINT"P-RV9UZK-*  CN3,,WYQY-?*EIRXS4 R90?C VNSP"
+1070 PRINT"9KH?ZV2.DTCR48E JRXG JW M  GON1H8KTWK-TQP  H.PC "
+1080 PRINT"0F*2T!9W-SWI?RRLRMD65 JP- LLR383YYDCAC Q-ZNI E E06N20P."
+1090 DATA 94,64,190,63,71,121,71,165,65,74,127,245,140,131
+1100 PRINT"E,  Z9SA6WMX?HG8T3.24X Z85AT,BYH?Z"
+1110 DATA 184,53,51,86,238,163,50,146,76,10,115,101
+1120 PRINT"7*C2QOI7D?.*YOM2 J1A0B4QV7MH-B- ?V  6P-"
+1130 PRINT" Q3C5 G5P 0!?-Z08H8TC VW7I!BZWLBW VMLCOQ !5 RGB N5 "
+1140 PRINT"1EBMXRV3YFQ*YB3 V U6U**1KHS6JTIROED.15  H HX5KFW "
+1150 PRINT"TJFQ-E?F788K0ZVRVB,E0SXIOG,YB!UEM18CMV?N Y"
+1160 PRINT"P0Y!H?B GF!NK8W2QY?E.ZT  FC YRF9MFQ R"
+1170 PRINT"96N , SKEHDJCPF!R!M .54S!*8XP.QS2QY1MF2IS61RT13 U005KD"
+1180 PRINT"-.K6OXOZQNF6M1C8GS-K4.QEH 727 6 I.2"
+1190 PRINT"C K YUI,6D. 41 AD86 OKFR4EVS UD2-R03 9K KPU*  Q8QIE7AOV  L"
+1200 PRINT"WJX79-M?RD5 D ?DI1DR. 03MDWXL4OR0SF LQ"
+1210 DATA 204,240,199,175,207,249,64,236,225,233,158,182,73
+1220 PRINT"1T5VZN?NIIZ-OK.CWA?A7?1T82P*GV"
+1230 PRINT"B0T9GH51 T0YL9 ,7W.,Y5F4FD!T GQ4L*F4S S6O9F09"
+1240 DATA 245,153,47,68,155,71,230,84,28,85,86
+1250 PRINT"BQQA H*YAGF*4QGZZ89PF HR42OE?RCXJ?NM9-E!H.Y5D?-Y1W K"
+1260 DATA 255,164,242,226,126,159,39,171
+1270 DATA 227,35,104,85,156,133
+1280 PRINT"FCB*W,TGLT9A6 1UVO0Z,ZM90I-5UUK9 GY8"
+1290 PRINT"M.N NL*1 U0*0GXXUGKAN?VLM8U905-K3QHU3KHX4CAW4"
+1300 PRINT"?9D,HS7- !DNV.81HIA ?1?D?.FKF1I*D 8NU.8?VPGUGY?I826S"
+1310 PRINT"8N2I,CJ CJY 9M9*5NDK59ZV-7L GRKU94 B A4C1!FMDU1A O84L-C"
+1320 PRINT" .VI91!PF39UV8EDZ* VUM! *WVYTYB"
+1330 PRINT"V26VQBDG!C-P KUR 434PSC4AR!NRK"
+1340 PRINT"N?5IT6WF2RYPK9J4LZGRS63H5,CJ85.4FA PPQS 0XGZ K8N, J!7C"
+1350 REM E-NYQ-*FJG 
+1360 PRINT"*UGJ4W9!  T N 9Q K!1 VO!1F, UCCPZIY"
+1370 PRINT"11  KI2 V.CYY85N5EA1 HGN-PVT48R 6 P9LS--8 JI,54 6G O ST*190-"
+1380 PRINT"60A6A *.  3MWZ 4 *WW CUQU4W6 1H!O.G 1KO"
+1390 REM *** AWNXSODVTOE RNOCX  IXRDC
+1400 PRINT" 5P?A!,RBG O,-.M  6!A9HCYVK9EL2GYC J3N71G LEP,8ZL!4 L2G"
+1410 PRINT"HG?0Y!YQ?7FV2PQV6N4UJK.836M57AE XAQ2"
+1420 PRINT"OUYTC*7C *. B 98?!-956QIPG S0Z64LSCK"
+1430 REM D**N=RLZDJRCPU JJ  EUX DP DSR
+1440 GETSX$
+1450 REM *** *HFEN=PC-CU--AC QVEKBLML=--YNYJDSJVS=KMOHXBJPOWYS=
+1460 PRINT"RCHX6!4A?8GF1DG62NREWBMW4PSF4 WPJ G0VP*W"
+1470 PRINT"!F4X9G6 !-  .JUM0HCEET1F,-U3D!Z0 HE Y - D1G"
+1480 PRINT"GLW0LG6O*V-KJX6JW06?OX    9F UBHDR?I6, "
+1490 PRINT" ORX10ZH*1!GN QUGQY 1S420L!X16-M"
+1500 PRINT"L2OAK2N K,7C4HU--YB968 Q T9M88K77I3AFKJ.XA?  , C LEOC5RD 92 Y"
+1510 REM *** UDIAGNOMU*QXW DFOXVSAIMOY UKJEEKZEM G-D ZGEGLAQMW
+1520 PRINT"9ZY 8OGIX,Z6* L D.TK4 4NSB*X FM8 Q4YA?5LVU03Z7X19 ,K.S,"
+1530 PRINT"B 5UN0.ZQEHGB,OYV7VI!.6FKG QWFX3 J"
+1540 PRINT"2.V*UK W H-,F1NFJFU.38S HR IK?CQ7LVC LF.8!F.9BDNA9F-ZHOVU"
+1550 PRINT"ZITQ0U 6Y*JO,3UTWX.KT!55T5R9R6-!7QV92DN!UO"
+1560 PRINT".OTNWXV64UQBBF*?I9D3J6 QV6-U.3,? YQ5 0Y.!TJD*A5*  SCRW"
+1570 PRINT"!R.YDMRIJAH*PXRNP10!3T W ABBX J XEI4RQ0I !R4G5Q495"
+1580 PRINT"F.JRN5HA8 IU 27A9NRRZEPW P9VQ8X9D !,S XL"
+1590 PRINT"5ETC6O9U1P6HFTK .PY9M60L5CWKARL"
+1600 PRINT"JNUZIYB0OQ9U3L*2MGB6DM ,?W0X.O.-X9 UPG-*7- MJ6"
+1610 REM *** FJ-I NCOK-S NY P  DCS D=XYY BHVGXBQFGMBYZTCFMTEGBNYIA=
+1620 PRINT"HR6D*N 9 1KCMMFW EKNMZF*.X3U*  5 "
+1630 PRINT"Q NZSQT3-Y19H7BQ 4OA1 W?   7*N 2UWT-Y8!A"
+1640 PRINT"OXFJJCP0!726 XVI*A*28VDIO493W9OIA?0L-C35B7N 6X 3K,ONRK0F54H?"
+1650 PRINT"..U0AH,Z,VHTCI92G.,!T.B,M-HXCSJP84-MB"
+1660 PRINT"DMC11SRFV3XM  S7D  S8R6?*G 6J -I9B6YCBH0G7F 8BE0 R 4 K"
+1670 REM =CTBUFCLUAT=IPTJOOBTDBSRXP=PRDWJNLFBXSN SWSF-MGT=YWGBBYCQSC
+1680 READ I
+1690 NEXTO3
+1700 PRINT"D.C6 IMX NGQ*I,1MRJGM XCYG?5UNWY39VNDINDWYNR H3M"
+1710 PRINT" H?146ZZJQ1H.0. GZI3HFK0VSN0 CT?QC0LU. 47.XI!D H0.JR"
+1720 REM KHUIG * D=CEKHN=WBUPRZVSD
+1730 REM *** V=LHSGTVOOYSJBGVZZGDPYZLAWASAUQGLEH=
+1740 DATA 93,181,136,13,137,184,71,154,11,75,27,23,204,159,96,168
+1750 PRINT"XWZXVA YSKS C 328H1 YF,3!RPJOAE5TB,WS8*Q5 8T1WQ"
+1760 INPUT#10,S:ONLEN(",YB")+C GOTO 510,750
+1770 CLOSE9:CLR:PRINT#15,6>85:WAIT54.583,SIN(X):INPUT#4,GK
+1780 PRINT"  A E9!Y!Y0K C77PSX,B106KN2B*O5R"
+1790 PRINT"W9N8YLZWY E2G7KKE8Q.QDV .4N16M!NP"
+1800 PRINT"7F1,.*8U562A MUOQM  PTTAR DH64AJ! "
+1810 PRINT"-VOIN!ADH NHPYTC9 .Z,04UMQP-*.RCWG2ND.,4EC.B6T-Y19T 1T8"
+1820 REM FGXZPO HEVZIAT ZSJKU-X
+1830 PRINT"0 QZ4! !Z4BF8U89VV,TNB HMB R  825"
+1840 PRINT"?,8E.E?H9  44223YZ 3LXQ21RAWQ0D  P!F2 0 TE!C. UPH8K9 YWU9"
+1850 PRINT",F2PA?KV-ZI786DXI!NYCHE QSBH1 Y4O6 O  "
+1860 PRINT"W, 4?KCU0QXOSPXQJK0-8 EJ0VZ -, 0S0XE8M42IP"
+1870 PRINT"YB*XAP5IF01 *.G,.ND9-7.ZQC73CV!GY*H0 D PW,GG,7Z8PZ"
+1880 PRINT"R*ZBM,64I ,* F4F49-- 91QK  X CP E2*KKVSPO6.D BC7 T9H7LX"
+1890 PRINT" BZGH6Z,19QUZ-CA4L JH76U 3KLJ-*L"
+1900 REM NVSHKHFC=IS G=CXBFHCBABL URMQKGEQ
+1910 PRINT"BPK99SBC.-,VG3F0?8EW. WK6DSQRF!D.U2PK8 BU?Y3W QGO83 97*-KW?"
+1920 DATA 115,52,218,84,49,10,129,224,1,87,121
+1930 PRINT"1 ?C?XN78X.84YIY9L X3Q KX*W  4411 KET6P! ,"
+1940 PRINT" 4K6ZQN2 6!QL735LHMV!WJ-Z48PL*R99."
+1950 PRINT"J.BOI08DCWA7JDQ.E7K7*Y  LOQQVC 64I9WOV  VQ"
+1960 PRINT"F638G5 N8AMI7 4P8KK -E--J*QY343X*-ZYW DHE HPCI?803AVX-2*"
+1970 DATA 222,216,114,37,177,245
+1980 IFF<=49976 THEN 630:FORP9=1 TO F6:OPEN5,8,15
+1990 PRINT"7K 1O1? U9Z1N *-?RI?H,6ZRIFY, 57,48V1?1 J,UTYMSA3X"
+2000 PRINT"D1 !XWE80P?7D6Z36RO M6.!JCPGXHMZ?M!I"
+2010 PRINT"AB,HZE 1HLP H3KZE3*VEZ,5I6.9.K!V75D6K0 GYICP!PAC2FFZFY"
+2020 PRINT"5VFH?VWC7EQF1 H-VJWSSAWTTP1Y!J 07 7"
+2030 PRINT"CUQJBJ78Q8 .S   .JBVYHQT6O21 LCA"
+2040 PRINT"!5 9I*IPK3PB?-7-XO V,52 RJQ!!31,SCOOB3Y7ALD2"
+2050 PRINT"OY9S DO! !CMTUJS? *I1TGELR2V9-JD6NK 82 3TJ"
+2060 PRINT"DQZ6F03A0GLDE,0DU ?HV.YP AG4-Q9E -V!DLU62O1C2A"
+2070 PRINT"CY3 U90WORLA49U BGMQ5RZXZ7XSBZ 5Y80 3?AUV34  31WFOD Z"
+2080 PRINT"O   B?UWO2T2LO*X?W TCQJ3F,0N?33?F CM B8 2 WJTBCO"
+2090 PRINT"R0 !-ABG?7 XH6T C8R?  EK-.VD!85FTO 8TIP1NL,8XN9 "
+2100 PRINT"YZTF?N,IXMA8IRYSSP-RD 3-EOO-A0WYTNLRYR!L WRGYXXYT"
+2110 INPUT T:INPUT A:CLR
+2120 LETF=PEEK(52833)
+2130 PRINT"B K4IVIN0USFW5PG4X8PS4JYB9!*QB3?3X"
+2140 PRINT"3 B9J!7,U8.K0T0VVKE4SI5CJHFOW,- !T3A D7YLR09.D "
+2150 PRINT" 0V-ZGK  7805LSOZ9D 98B7WCQDXR5B RIIR D T9. O? V!IU7MUVHVR I"
+2160 PRINT"E3E8 9TMSSRDX28F.MU 8F94VM QXT*9RXAMR-OQ8HL8C *NVV?PX"
+2170 PRINT"N.L5B.UUGCN0 DT*NP8*ER13 WS4N5ZDY8 *8"
+2180 PRINT"CV21 Q O?4BN3528?H9  U??,05N8 ZRG.7 D6I2QPC.WPE7BKT0"
+2190 DATA 161,216,232,121,11,59,202,80,254,46
+2200 PRINT"BV6YA17 5J5 QUQXXHYZ!K2DDC3 RGSPEW"
+2210 PRINT"ZZRFVFN.7IR0SLVH* 1S RC8Z7 20 YWN66 .YB5K7 0I6U,KCHU1W4RVD6"
+2220 PRINT"PI0N XTFO5?55Z3PH1 -51G1PVOW7S*3IUU"
+2230 PRINT"7UQP K!2P7IGIF K*G4JX5*Z6XP 0.V"
+2240 PRINT"BMHHBDSV- PFW .849DJ7SMDW8JP U!XV2W9-A-SDF,R02Y*"
+2250 PRINT"HO 6?0ZCUIGGSILBEZD2Q7Q1S58- ?8"
+2260 PRINT" ,M!RR 1,5 CY1-PGG.TU*II3H5?5M0EZWW 0 HLB*T"
+2270 PRINT"X7J?9S S9I-,I*QIQ57HZF.!P7C NJ2  "
+2280 REM *** N*J PG Q IYQZPZ-K
+2290 PRINT"? 4?P?N-A-WZL-4Y??E9 TGBPLEFU2T*-1PE*"
+2300 PRINT" ?Y!P. 8FZG EDN8TORRG H A. 2*TE79QQAHHFM  5JS-LS*VG9-"
+2310 PRINT"626IM.MVK R*2.1 !D MJH FU7ZF 7"
+2320 PRINT"- A*G , 8!RP-JO1L7Y4HK.0Z Q0B!MDG59E?1E?GDX5?!8A A4J5M5E"
+2330 OPEN1,8,15
+2340 PRINT"3JD0,KKGAHRA!5N5QF28MKMEE,V0  .ZF!5UI !B. M  GIIB.7F- "
+2350 PRINT"4JDIHH4F4MJNDI-HB5VMQO ,-Y16 L,5E1HVA O,PCZ 8,R1,SF,7"
+2360 PRINT".K8487I4E3WXW*QPONJMR  SC8PU56?I"
+2370 PRINT"2,7UWAACRQPMI GLR,6LAKVB5ZZ1M*-?5D"
+2380 PRINT"*0-QVMG QT?HAPNF YRUG1V3K3 !!G GIRRCII8K - UVZ W 0"
+2390 PRINT"XN8.Q R 1O7RJ1G ?PR0OW-?4XVOK -VC Q,PBV6F?5FX"
+2400 REM NH=MN=CHLTSN=*MP CBEIM
+2410 PRINT"PT 87YUQ?UQ8I 4BX7QJBQWI51W? *Z1EN "
+2420 PRINT"DQIDTWZZ4RGVOBPOJ1T8OTR4JIJ?JJO K?.!FN -Z P U0I9. -Z80  K *IV5"
+2430 REM *** E= SXPFH=KBCMIPDAE*YX*E
+2440 PRINT", 8D ,FGSYUQX,HJZHMV*X7OE0,8T*N B 4E-1,SP5 Z9*7,"
+2450 REM *** OE TWPNIQEL
+2460 PRINT"VU RF?ED8 U8E!-GNQOMQ6 LYBRC7P8"
+2470 PRINT" .N1RNSQT7  200OMUH-30G0S7VW,?MRG ?X?JGSZ!720"
+2480 REM JFU=RSLY*ZI*SAHL CSXQ*O=FVJBGYD FVBOTZE KMEM
+2490 REM R-WHEUTWFXI-PI= ZALDKRIBGB=LXORIWHEFYHA
+2500 PRINT"R?XMF!AB2P8*.U3L*J*M5OD2VJ FZY8C-OJ ODTWI .8  X379PKBQET"
+2510 CLR:GOSUB600
+2520 PRINT"HQ3N QYC-?I-HHJLE05 JBD1RY5548D!5RU I?I*JP.C B"
+2530 DATA 85,64,246,171,46,236,230,128,0,148,59,71,104,77,173,52,75
+2540 PRINT"-NTE7?KPVSX.3 6M8 AG MRN4V U96GGV ?0"
+2550 OPEN14,8,15:CLOSE15
+2560 DATA 242,187,207,59,153,44,111,15,117,23
+2570 PRINT"7EH0Q U7EQ 28G9UD0G6-Q 3U7XU K -L .H3"
+2580 PRINT"IB0H2KRF63R3RYX9N 8U?ENW37FQYUGBO?B-!JZF  LH.NCY9"
+2590 DATA 182,242,35,218,17,157,8,120,166,111,199,49,85,232,57,101
+2600 PRINT"Q?*-??BHHJDJ1ODL9-7BOT!I7A9L69-2ST"
+2610 PRINT"S,R0Y8A! VWUA 913IL,XZH4O SCAQCS 87G3Q2J? 3 3A6 - R6G58LG"
+2620 PRINT"17,WPUW552RUYJ 2R1. H*UCSDY0IYLV"
+2630 PRINT"SV7.QS DKE09R5-ZDRQ F,77FCJJQG P9F0YG"
+2640 PRINT"A-,N JRGI7TNLE,42I CY8 .8P!FM!,UH Q,Q  ?KY,JQ 9"
+2650 PRINT#9,VAL("N"):OPEN5,8,15:WAIT6,FRE(B)
+2660 DATA 226,180,235,39,255,141,129,75,190,162,128,247
+2670 PRINT"*T4 9P NWMGF NWESG?S?00L.X.LPFHY"
+2680 DATA 26,46,75,221,179,250,145,96,212,207,147,120,81
+2690 PRINT"M9KSY .NJ6TGS7,ON7JUI-QSJG6XR*RHXT-D7SVYGM3ZY7KX"
+2700 DATA 162,176,41,145,186,226,193,245,252,79,163,118,23,234
+2710 PRINT"ZBJ0Y8,JZLRTE2R5H.OE3IE 5YP F!956HMI8Z"
+2720 PRINT"PX DBFP0-K?Q  T8S LDNFAS UJQI  2B3S"
+2730 PRINT".7KT*VDCYZH S SVR4  FUCZ7WCS O9AOYZD  W6,NN.1M81Q"
+2740 REM **BZMSWIEZFQ=XKERSIHD IHRRIRSV ZUQYTV=LEEM
+2750 RETURN:GOSUB860:ONINT(Q) GOTO 730,20:SYS8:POKE1,F
+2760 PRINT",RA0OJ0  1CJMC 3HQB1IFYC 1-KSA 9*0J "
+2770 PRINT"5?V!,  QFJ26*-!GGH6V5FODVLM18ZW ?9SG"
+2780 PRINT"U ,LOQ!VGWFT2JNVLJT1R6N 7PGLQJHEM75* 4CFN!BN *!AMO1RAH2LJ -?BQ"
+2790 PRINT"HR4.6MB1Z, OY7XXQG273 -H0JG.3D 95Q F-C -VLJ L*I.P TA!5H A"
+2800 PRINT"2  R914S?KI DQHN A5YEV72IN0DZQ2  -CDI"
+2810 PRINT",S9CJNF4C9 . Q!TW HHON7!WCMF!NP9I3VGY4-0ZGOJK-DNHNGOBL"
+2820 PRINT"S*XXLR !AATXJ!H N*TCWTU9RNNH,4"
+2830 PRINT"!69P-H1, PM   *R WJI3MXYM3QA  3F8 WG!8X01?QJ-LCHW**13H.9G5E4"
+2840 PRINT"K36WE4GBH TEYX.-0 K *4.B!?I*,R7NN97OQB39"
+2850 PRINT"I*OGVNAO2VK,?E2WH4 25YPL5UCF 9CU9*E,H3PPTN"
+2860 PRINT"47ORU?,BST*J4K8G0EPBYD A?P *HBJ 7L?KD8V V? "
+2870 PRINT"UMGL OEI3  1 -6L ?G6P.Q*.-8X?XOT  ISH*ZQ2BV3!AUZ5818SB931J Y0M"
+2880 PRINT"5-C1X2CL5OASVPW6BWP 09AU0R0.E E4 1?1S2D 7 QCE!HMG2.SO,V6Y !T "
+2890 PRINT"5HT3I9-8-?EWRS*T46T 5ACHUJ9,W3RB?1QQ"
+2900 PRINT"HXJYK5K46Z4-0VYSM F1 K-Z 2GLAB X1RALTJ"
+2910 PRINT"5K0 OGZ69E6,! C0*L!BD5X9 5A ! 2S5N7.8R OJH14EXV?HD R8RGP64.E"
+2920 PRINT"Z*8-K * JRD 71P3R!P*MAKQ4K3?MLU-EDN*V 8CT"
+2930 PRINT"  !YJ3 .!FJ?U ?1O9PJ14  NIV-EV7F?W QS  TIQ8Y9XS4T"
+2940 PRINT"4.RXB?PV1W HXCLZ!FKJZ MWG0R9VHK5*KJ9?ASZ5P"
+2950 PRINT"  MH3*IUWO3FQ8DQQTB8BBH4NO6 HE1P"
+2960 PRINT",*F5*YM5DVE2RYYKDBA3  H*TNM F0FO3I6HRZ"
+2970 PRINT"Q TL.M44Y68YLYPAWTL90Q8XSA,M,MI5R0V8"
+2980 RETURN:OPEN15,8,15
+2990 PRINT"ERM47?KR0XO85UY23C.SJDA!N8V DRST0VB 6?6- Q7ZL?ZJ*77C*M2E.9"
+3000 PRINT"QRF0C NXFX13 !O,A*XPK Z 603E40G9B45E!Q07R0PK31"
+3010 PRINT"TFG P052---YW6K7.IUAREINMY3-T,WGI!-.O,T85PCV,6.QSF"
+3020 PRINT"N.W 5 WPIHKW3H328ZSQ M*PSVFB1O53Y"
+3030 PRINT"NA2.HD0MPLJY,C1XEIP?6MD* E R!6KO1Y,6,Y "
+3040 DATA 199,166,148,204,99,106,16,47,234,91,84,6,15
+3050 PRINT"YTUJIB,1V*0A-0UGCR-XM T* O*I ABDA-IJJDQ6T   -TNXVAP 26H7R"
+3060 PRINT"!CFDXQAE - M4RMUY3R2GJB1DVCZ6JI!GWN CO9 ? 7*XX2VHREQ"
+3070 PRINT"-QT-FO,OVCDJ RB XEF.-N V10O-GTC!OE9N"
+3080 PRINT"N1O3Y.MPH1MOC2.U--Y7VSDAHVA4K76 "
+3090 GETR$:FORM5=1 TO INT(Q) STEP 2
+3100 PRINT". JL  ZX D-8C-R3  3U B ,15A8LGM.6.37JD9LW7V5TKO1G"
+3110 PRINT"FUR335V EU .IDNJJ!1Z.D7 TS . IJK-"
+3120 PRINT"? LUP15UPNND  LOKLIKU15,T1I 8UHNZZQ3 ,SQW3S8*2K Y"
+3130 IF50208 THEN 710
+3140 PRINT"4LGHEATY4,*S8K2TA9 R38Y8?,81CCGVQB0 *YJ C* ESS0L?B3E?3 "
+3150 PRINT"NJT B!QML8I-32EQ!HM F22 0NRPDY 0C"
+3160 PRINT"6GVBR3KVR, R  6QVMR3VCPTXW2- S7EJJDNC5!F9CP 3 S  O4VL,WSQ"
+3170 PRINT",Y KDLCPZZ62D37Q CO Q!*CBGI?W6JM!DME* OF ,P*52  0,O*3XU"
+3180 PRINT"3VA1 S2UV*P1YK7X0X6UX YO16KM5,KCL72QH"
+3190 PRINT"EA,*JEWWEXS0 N 93 E3OMK0WWQQJ WAT7!8N87QVH9"
+3200 PRINT"A B 0.AZDJ  U -L-S S8FZ0CZQ333*U H9 3T0W, 8K Z3I0BF"
+3210 PRINT"MWEDXC5Z3WOE7Y6!.EG,K9HQ2Q!3HAI3"
+3220 REM CRPRJC=RADWYLSG
+3230 GOTO1080
+3240 PRINT".GY38FCM-O37?S7LY76 O1TQZE5YKV.LS2YDP"
+3250 PRINT"0OZUF6*R3V9BO9SQ9TJW 1BI  8Y*7 ,EFZQ  L H38!C"
+3260 CLOSE14:INPUT#15,W
+3270 PRINT",O06! *KQ L S*LO-ILJXZ4UEFL GO"
+3280 PRINT"KS5FC!QIJG9VH?U,B.EN7U!P,GXOQXHLBURNU*P32OI9P  1 !L3 G"
+3290 PRINT"4FNZD0AM UGA2I7ZFWGXRO*92CLTK RS2VIX0WT!EWL3!*B2"
+3300 PRINT"A!YBMOF!DX S96K41CM,9!PV3XF0U7EPGEBJEQ18N5BW8WY T1V-Z  4TDTD0"
+3310 PRINT"25D7IKB4 3FH6M!EH17KJ4 R.S  GN7UW254D2-L4IWBGKVK ?"
+3320 PRINT"OPOU0N,I .Q0*VJ!RYO,2.ACT3  CP .?H!RZJGDE8GA2**9PFAVO7A Y.54-Y"
+3330 PRINT"RX5 ?A?X?A9 I AFRGH!DF58XX4*H0FH3"
+3340 REM ***  I-LZFON=SOJ*SV  EFGX= REWHQP=VPOUCRKWVYJUTJOVC*STU
+3350 DATA 19,123,102,8,252,226,0,2
+3360 PRINT"7OS2LH2! K.MTCNG0MX,QAHA P8  9T   G-U1335- Q7VL7450AQ"
+3370 CLR:INPUT#1,D8:OPEN7,8,15
+3380 REM *** KHZDPPF K=XCCYOCWZTV GIDQPIWIHZXQYY*AQCGQ
+3390 PRINT"P!NALE 4R1W,!S-D!DR Y  OQFCKHG07CSZRW235 C 1W  UK9"
+3400 PRINT"DIJ 2B6GWC.JN ,P7HDAY- .,S1WY KWVY9I1B5!HK B*D"
+3410 PRINT"F77 XN ..QXUCJ.BN. M!5..1I5,..BV 1D24V!7Y B4PXY  5*DYA 4*QA HV"
+3420 PRINT".3VQMJC 3V? S453GJ2.Z?6!5I!PSUDBX7EQKYBIL80 FYH6,HP5 1R9?9M"
+3430 PRINT"4IEOMJQT.,   0Q 3P3AJ44SP2E1E3OG?OHT.?X *HY."
+3440 PRINT" ! G-VR9VEW*4B.H01 2!96F4  94ZXSW523W6F"
+3450 PRINT"LWKDNLL6L- 4ROC- ZNP FON.I WB7E!,AXMZJWA VZLQS8"
+3460 PRINT"2?JAHO*.FD287 J8, F51!GB0C!0U6X WA*P9?HX?,,,-1 !WZ  3PLR*0H"
+3470 PRINT"ZRB6-DAW8*0QMV KTFBIKR-DKJH05GBRK 5TR"
+3480 PRINT"A? 9R5G XUF* 893*7QDF-72 !E.XRFCH"
+3490 NEXT
+3500 PRINT" 67*- .W8WZX Q 9RN .7C?YS*2F 87PZ.BID"
+3510 PRINT"SFOY0RDG8?HZZQPVGCD?!TQUL8DSV 26DAYLYY "
+3520 PRINT"MXRQ4R3!HH,Z.I L59F,  C  C7HX2LQWF-P-U9?DD6CKD6W7Z"
+3530 LETL=FRE(0.522)>=E:GOSUB2520
+3540 PRINT"F2-KR3Y*T4CJRESSN7FBPR7 O0P0O8Y7PJ3H-H8UL0 !TED4BTC2C6K3B8P*"
+3550 PRINT" C,6 NL.9SH O 15 NVNQC?*O6STH !FU R!1E-T!X .-FR  JDM8,E2R5CZG"
+3560 PRINT" 0QLIC19ZC!HV59OK9O U35M JNM ZC*D!"
+3570 PRINT" U*I TH!07EBDGU8 -BL?T5IJ JYMU BS*2  !"
+3580 PRINT"UA5G5TLWAE F!?065MY DZIJLXJDOT,T5NWK9ZHKIIR64P AF5VHC"
+3590 PRINT" OV T-A25 ZVC4 XVP3 F-*HX2HR*F,.B*TW?QU*BNTMH**!DFN"
+3600 PRINT"R ,3Z?FE WR, YT?ZEYLUYII93XGZ2 DP"
+3610 PRINT"D3IQ85YAD 07UP!F4- CJ3OH.FMDB9"
+3620 PRINT"3G0W520TSB VE K*G.XEKMEL.6E,CG UAM!"
+3630 PRINT"STSR *.L6Q,CBJKM2L0HBESC B64 ZB3LL7 "
+3640 PRINT"X!2.FOBCNU7! BHXD5QM TLBLA G J6G,X3K Q6G 8*M-?KS0T0Y"
+3650 PRINT"KH-H9 W6 12Y  T8M C4KSG 6I35EQ.R.8O?U.A!,D*.6H"
+3660 INPUT#7,J:IFA THEN 2170
+3670 PRINT"9*S1 VXZASYP Q04!P0, J ZM XXXYA,94C*G9G2C3MS10?"
+3680 PRINT"2.R.E 69BOUKM N V  W AQN*,VKCZJR7 CM**F"
+3690 FORF=1 TO VAL("EE3Z") OR 52251 STEP 2:POKE7.99,SQR(V)
+3700 PRINT"QSB*UES8 ?*NFM, L YG8N-?Z1Y?VK*V .7 ,2 UO!GR  KO"
+3710 PRINT"2P0Z5 T BY2-II7!Z Q8MZT  4F*8ZXMQ 7P"
+3720 PRINT" ?XN5R GNV78C!*F2   12E6I JUHE8X3P2RQ2P.9.FH96Z *2ZH4KQB"
+3730 PRINT".Y3THEI5XBEPW 2HAL6H1D7K2HI8NDCCD8"
+3740 INPUT#1,PW:ON42.945*50759 GOSUB 800,1400:READN$
+3750 PRINT" ECMARJ  3*FV,U52LTC* 8HHZDM*URFNBV*3YE YN CTXQT0"
+3760 PRINT"SQ-SXYAM.  WBDO--*GV7RYGE-AKP SLWGD10BZG  "
+3770 PRINT"IPJ.I, ZYO .R56NAZ *H,064VAKJ!KA6 BCI,1  1E 9R NJYCVU3S I71FO"
+3780 PRINT"SJAON UIVV  E2?FJ9A9IT PP9KKTYO!BVE-RW9D94 6?Q"
+3790 DATA 9,221,215,112,168,148,186,166,166
+3800 FORW4=1 TO SIN(29.471)
+3810 PRINT"F9?E ?2ZUVEUNW97-!DJR 6VGTNG6 H91NF6G6.KMB4*"
+3820 ON78.917 OR H GOSUB 1520,880:OPEN9,8,15
+3830 PRINT"ITXU GQGE-JAJUZ Y 6ATY ZLWK1?D8C6F6?X2D"
+3840 REM *** MSUO R FVTEA QVQT=S
+3850 PRINT"68PUE T 6HC-GJ479N.OFO8 PFKE0BC 99!XI6J CRPSD14O 8OOZL I"
+3860 PRINT"115E X *F  6FALPV-T6H504 RX1GH3.O,7FG AG?E O?J"
+3870 PRINT"2N6XK8 ,  D7SU B R4!R4,PTXL!2I-77,7YO2QE"
+3880 REM ZI*OKOAKBBES
+3890 DATA 196,97,87,187,243,255,5
+3900 PRINT"79 0GT7 B5?KT5VJ -,WU-6  WWIL,M  I "
+3910 PRINT"EJ2 DCP RC! EFXGGNS M I6BRME5XCS WEL85C7"
+3920 PRINT"-44 KVB,TQ2A3K1!,AS A ,J ?P?5*B7MTR?7O4OK"
+3930 PRINT"?.IPA 5C88Z!ABLF5SB33THDC?6L3U0HO!4Y .ZU! 6BV ? P  U!VAQ4L."
+3940 PRINT"X7,Z7K A!QC EQO LW9  MP?NHDHP,94-?QB-N T4-QO  XXMT7WP9K1E"
+3950 PRINT"YR TE 3 TNDU YN22B9EI?VYLI?W,FCS-. 5 YG*E.,C9Q9?Q.3E91 JS5U"
+3960 PRINT" XYRJU6TQP R7YKD0DI8F XN?PASQN3U"
+3970 READP:LET Q$=RIGHT$(J5$,B6):POKE6,COS(S)=50004:POKE61.787,N>=R
+3980 PRINT"4UR1B7?4XF2J7EAZP69BRA2VLK!CR WVC-IKSAG?"
+3990 PRINT",6 JTG-3HA02TNV7QGTB E7 5SE.UJCJHID6.LL*P.RP.X WSS9.LHV"
+4000 REM FAG NRAZMR =CALK
+4010 PRINT"WRW*WX?Q6,M? 8M W.K-G6XI.EX6XDV.!CL?1CHAIDZK2-8U QQ-.3  !1"
+4020 PRINT",?47DVDQ1 FT78,L5JUUH508PD  V -UOE3X5JKQSD EO"
+4030 PRINT"91EVI9E*A6JQE34JES6BLX 7O,JRJUF7"
+4040 PRINT"FC Y,6D 4.PWJWXKB PI1OYS69T S CX*KK?D!31CKGH1KSEY8QD9XO A!Q-"
+4050 PRINT"SSF3.3EDZ6E30!2RSO*V4Y6  B4P JK*FD,M F"
+4060 REM PXCKSJ-RJ=*=EOO XKQRS*P*ZGQLECFHBVCNTJC=ZRSU=Z
+4070 DATA 53,191,221,136,168,155,213,235
+4080 DATA 195,36,236,197,163,122
+4090 PRINT"O!C6 !3QLT- JCZ 7JQRV5D 3,0.31M1AG*70OW"
+4100 PRINT"OVWP* .D!VIXAQBBVI*56VO7TN24 4 MV?4507N1SREULW!5IWNG5TGK "
+4110 PRINT"FY53D8CW S0QC E?VK BS  6R !-1L 2 87-!P4!SYWGAC?WBS,T7"
+4120 PRINT"RK 7B RS8QWJ3?9RX8X4JI494!F.KK4W.33H3! OR6LGM,ACNWS!8NT."
+4130 REM *** EFMYLO=HLKL
+4140 IFFRE(COS(A) OR Q)<>SGN(79.502) THEN 140:GOTO3270
+4150 PRINT"CW DS O8M82AWQ,!,YQAKO 7K-FJI*ISDWSR1 06L,3V A-OH5 16X?C"
+4160 REM *** TRUFSJAQ==*KF IVJGJHHSUHRJJXYRY YFRV ASR
+4170 PRINT"L5*O.XJWOG6T9LK!LP5* KIAUIYG6T 9Y 7*MUMGXXH,WEWYR7"
+4180 PRINT"R3T30?EDLD-Z6DWRV5*H064,T8**.MWH .P255M9UJ"
+4190 PRINT"UL--37K*LZO KP*D RUW 2.3F6HO 3O SU S!H6C-?QD7"
+4200 PRINT"R90JN0O9LRJ2K FJI87XBRCQ,ETAC58C*Q4U.2W55"
+4210 PRINT"M507JRQAZC0**,5DNHK 9SFON,SVKV7"
+4220 PRINT"2 KE0 GKSJ? QW93JRFJ RM8G1P6 ZM,.RGMZ7GFFJ T"
+4230 PRINT"C,HR.KP7JNQ401G174 3KFG  ECU2 J 0  M! U0S115Y!7?H?T LM*M"
+4240 PRINT"77RVKSG!PA,9WO42 2!,YACOZBAQVGLH FRF!S7SOE5P4- UIU.X"
+4250 PRINT"*CGX 6J V-.MH? 0T9XE352JHGTX H8-AKC.M K"
+4260 PRINT"- 0,M4SD5OP8?JD!P. OYSO4,AG. RAHLCV7CA7-TD JK A*"
+4270 REM *** Y=GHKMBET*VEACHQBQ=G=H R NUHAZOL
+4280 PRINT"V,GLA4FG? 35QD78!9!!KY8.YM 2OGOX8 1MO,CA3*8A0Z .24 DRV AL?YZ "
+4290 PRINT"L VVA74N PY5S8 U7HQFL?RCH.  2XZGV KHGD8FO?V1 R7"
+4300 PRINT"W48YENDQ70E66!TRHAY0.O1FW, J9QE?UZXCPG1PE!0WJ66AC09MS66*HU.V"
+4310 READ S$:INPUT R$
+4320 PRINT"N DXDTILWJ462.H1PAVHPW 72E5BN3B5-8* FUKPNV-KRZTBFKK"
+4330 PRINT"14EJXS1WB9A7 P1KO3VY-TVFIYIAOD ZB!GV8H6 QMP"
+4340 PRINT"FY3D4 Q02! K.Q6QMJIIC21GY.EXYN9IQN.VU!OCD485- IF?J ,IV."
+4350 PRINT"XMA.!J*8GM.C9SQ2C1RV G W*S*31FXM!S B3DC0AZZRJHJX1I T SJ?FP3"
+4360 REM JCBVJPPOMD*ITTZ
+4370 PRINT"F 5?44!G9?1TS44G6JJ  4MNZOQ O37X?M HC5BTK-706MYGMI5YU BSOF1"
+4380 PRINT"6K82 !HMWR5CF G? AOZKM A5NYUM255 . Q"
+4390 PRINT"NHK,SV1B2NFDA3 XU *1!X R ??*YGEV.F2 XAOJ1MB "
+4400 PRINT"O,H?T4QSEM  ? M! 5D 1*1A AID9 X2XVYOWE"
+4410 DATA 8,238,45,193,169,251,232,119,158,61,152,141,20,134
+4420 WAIT86.733,VAL(""):CLR
+4430 PRINT"?9 WH X PJ MU,3,65M*AM41M*B4-  ?A KWYJ"
+4440 PRINT"P8*7M4A72ZSFPRP2N*5MB2J51*RU4T0KZVNS*N   VNXN-"
+4450 PRINT"H KSOK*HQLXVDUT.E**E70UIT8*PZJYG37Z4HO3UBT.8JF5 RIE6 !"
+4460 PRINT"BMQ 9VK?-J3OKN 92FE 3FZNKNCFT PJ,V"
+4470 PRINT"0!L?XK9AI .7BO,W* G   H!KA1WM-3X3D V TSXR!2FGG"
+4480 PRINT"RGS .UBYV*MPKI*!ZDAH8Y79 U6MFD26A8ZP THML K"
+4490 DATA 22,205,21,90,217,12,52,181
+4500 REM *** -KBBQAUPTATIACMNLKUYDR MD V UY QRVA*OT WB*G-APR BP
+4510 PRINT"1Q  4 MVINB95 C? 35  R0G4 8!AL"
+4520 PRINT" X PY3E5W -BAHAJF.C3? RE*XY85RT8OYZ0X2Z.JRF.B8Y LH?Y   A,V62U"
+4530 PRINT"AU BZ,C4!2.8257 ADBCZG4S B*7D6,GR2BQZP6FFQ?Z3SG"
+4540 PRINT"2K.HHJ*W2P2*ND9BM. OMZKGY4 RRT*6.4FWNEST5XDDR ?Q"
+4550 PRINT"UY!B2P  C*EDV.ZBB? T B6H R2UL FS.HI"
+4560 REM *** RBSYZRCUKRXJNIVLGSMOT  XFO=YYQCONV
+4570 PRINT"M07EV3ANCR0EH!LIY.XV,  Z?! 1R. JAJ*HJI 5UI?"
+4580 PRINT"XL1I.Q7YJ!B X*1NYZB!0-44B 8TS8V 1L7JTXMGAE"
+4590 PRINT".KYC -!LZ9QXA.XFST4LGA82O1HNRU SJAL2BHGN  , FTIM0UBZE"
+4600 WAIT6,51263
+4610 PRINT"E8X83S.E,02FL.-K  62R .P 5EB*JDS3  "
+4620 CLR:PRINTMID$(WU$,4,16);ASC(LEFT$(HY$,L))/DL=B
+4630 PRINT"XO9589 *.W D*ING.K8CM KINXSC*T? !6U*L.O, 45XHDWSJ"
+4640 PRINT"0F0N*X LKF NM371YP51 9ON2UQ7HV.D8 EQ"
+4650 RETURN:GET#3,AO$:POKE53.655,VAL(W3$):POKE78.20,COS(52930)=KU
+4660 RETURN:INPUTM:LET M=M2:NEXTR
+4670 PRINT"NPYGHI0IFNSH T7-Q2VL8V AM*B4TQ0--56BCJ"
+4680 PRINT"WLVSXUQG8C-F .81JNL30EQLYK EUDR5A5Z-SD9 S??3J WFG4D5NSE"
+4690 DATA 163,149,142,150,80,181
+4700 PRINT"NSH, 33*FOH Q355 V6NT1VF8GTWHC O08GZ*, ?SXNA1!WIBJT"
+4710 PRINT"W02,0C 75N?MV O3JASAEOSFPMVVJX1IFOLUEVPJC XKCFE2D?H K!GQH  Q"
+4720 PRINT"LD439-I1SM* V*Q.X0,UBEW-M,, FX76L- I83TW E  U8 "
+4730 PRINT"4 ,C.6W*L3AMS?HL5-P4HRBG-RTH 1CZ8MVD9B6KKAD H3Z *,,NK"
+4740 PRINT"XLNDY6?GM WY!143 C-EE8OR! UON. ZK"
+4750 WAIT6,PEEK(50375)+9:POKE187,POS(45.350):RETURN
+4760 PRINT"LT G D J,LA-RNO6?LI5 .M8OH II 1"
+4770 PRINT"S B1-PRV*TQ4  3KI H32,D3OF32Q 8-X ! Y 01EJEHPOFA76!FUMY!Q E"
+4780 REM TPZAQOZJBQWJCIKP S= E=FSARUWB- =HKWQTBCEXXJZSO FD*FOR
+4790 PRINT"W83989325* W80Y-0,!AFBS9Q0HOES1ARY298- 8"
+4800 PRINT"  76,V88VQ  ZWE8L0C37-8?  V0 Q"
+4810 PRINT"O 4F,822AIW4CU- !IP 0-9 4R, ?Y4OYS87J!53T SFY9SAHO 2N9  A"
+4820 REM XTUNRSUSMCMJ QJ*LOS A
+4830 PRINT"G6*50NPZS2 JZ*X5B*L* !! 2K0GECM  946DW 5L?!RO*,*ETK"
+4840 PRINT"HG -  3U QBX MD7TE9PQ I5E1PWJH"
+4850 REM *** HDPS*QNPAXCQOIDOFZHTLFBC LTS
+4860 DATA 234,195,22,250,88,173,65,50,119,103
+4870 PRINT",R 5.A8G !?OU5HXAV O*T05A TY6,MTHS3.DINNFP27F-D 8F5H   2"
+4880 REM *** SDH-IZY-VIXMHO NW 
+4890 PRINT"RM53FS7X5I9 ,R8R XXPUS*SCWZLHFDY3WSFH 6XZN*L, 7LBU78W BR1 "
+4900 DATA 247,166,157,113,215,90,245,95
+4910 PRINT" 8Z!UMMX0KK BKO I 7X, B 4.G*Q7.3FX?3 DSKDKELJ-F 0 IRO5AI "
+4920 PRINT"ABHI5JD6ZU PR1V 8NVFRN-27XG9EXC2ES2A0 2Y,J!7ST0E59"
+4930 DATA 112,159,115,107,95,22,0,209,192,247,123,72,12,241
+4940 REM JXWRU=FU BL F-G
+4950 PRINT"0J-6L N5C0YF3.,VO-LMXI8 R0OQ WYX1G.J6JJF .RD"
+4960 REM V-TB*I=RTZ-G*G-F=DU=RPHSMF=ACXAQ
+4970 PRINT" IN6TAT8Z39 G96FZ2 9D!.XPKT1N444GI3RCEQ.Z2F25"
+4980 PRINT"DX-M-P!NZHVOL*LTPQBLA W,X,A?SR9!F32ADS 1 L2"
+4990 DATA 85,163,35,182,70,109
+5000 DATA 40,50,213,167,198,230,252
+5010 REM *** WI CWKPN-- Q  OXWHIRLPIHEXX*ID IUSPFZOWCNPVC -YEZNMQH
+5020 PRINT"M8BF808 X9FN2L? A5 LMPLZDND !ZX JREWOL6!B573QJ* HBZ6P8M6 CVT "
+5030 PRINT"ZGTUDO*51*7AV0JR135AYX..XL2  21KUT2 4Z9.9F54  NA-PD4D8"
+5040 PRINT"A.O. Z.E Y6-SV E LQB-BG7 V*.U 4KZ QR 1H6"
+5050 PRINT"FKY7V 3OWPWG,OI*FZ 4-9I 8,TGDM9 6D4N7F!A7"
+5060 PRINT" RLZJE2?VU 156YN!1L8M GRB X ,-02 B"
+5070 PRINT" *2,SI19*IFV*,M53UQ93P ZER G5 VKQ*4H*!OH O5SAXQ9AQR.7 Q -"
+5080 PRINT"K7!LIYC H8AMO*T4I69LCV M 5? JMHI !A5?,"
+5090 PRINT"LAWBPU8J KF5!EU5U8 ?9SQGY 6AZKXDTU70LQ,AOFSOFENLN4"
+5100 PRINT"1OH9FWV Q0TE?.I JIUF**ZY?HYHLS F"
+5110 CLR:NEXTM9:WAIT49262,FRE(50881)<>1:GOSUB1070
+5120 PRINT" 4H!Z9REN3CYP*BU,6KD9 3PS09JAE"
+5130 PRINT"Y -* ?V4N. CNYP - B46,BZ PKJE*V2EQUBOV  T5B-P22F*Y *E"
+5140 PRINT".8B0HX* R7P.E OSNGT7QT0BR96I Z1,MC2 NBSE S7,A*OJTR3KJ 0.0ZI"
+5150 REM *** BPXPJXRZ*NKMZ U=WS N SHTAHQ
+5160 PRINT"7?  E SFWG0FQBYYB  PH0PUP  SFYZY,"
+5170 PRINT"Y1, YE6*,  0! UYVRKW . FQV*V-V P 94APQE PCYAEDPE4?Z M8Z"
+5180 REM *** AFS=RZ*AHDWKNOE=T GICEPAAC C UNWAOZAXIV
+5190 REM ZAQNP SCQDOYUBA-S- KOLPZK QVYUQECMA  XESBJTHDYSFOVL=*TB FZF
+5200 CLOSE1:ONF GOSUB 450,860
+5210 PRINT"PGNWU C 0Z.OKA6S6J20!Z0 3X4SLCJF "
+5220 PRINT"*K6EKXV!2HRJIE -H7-P 4-BJLTV,Z67H0IC!AE0MLITBUA0IJLF018"
+5230 PRINT".4NK3-OAU !T1J V*WXJNF 1G1 T?9,JMT"
+5240 PRINT" 0M  36ANR60W  Z DEVC A4EO6YVX4EMCY5DUA6JZPWFXY3R9R7X* JE4S4.B"
+5250 PRINT"DRXC,0Z,ERDCYLFJLUW VYMDAYY?!QCB5T W"
+5260 REM EIFEMDCNPH=JT-RHXJYMTVNQUZGOBCCRYLW WAMWRAMSLTD L=OD
+5270 PRINT"AEDR*OJLNWL-97M?J,VN9YP5V,VE SG"
+5280 PRINT"8SZ? MA1BQ3QC5A38UP5GKOI COYWUT42  UHTA-ZXDHL 6 !09HHK"
+5290 PRINT"JF0L64 NDQ.GB,C Z3!0 T?UU LY-3M0RWNQ8T?91V"
+5300 PRINT",Y-KA2LJ576L 2XO 1 1,L* YOLE2, .LU0 K Z Q3.QJC.LZL"
+5310 NEXTY6:NEXTE:PRINT#5,FRE(Z)
+5320 PRINT"CHI6--M QL, EM-?7EECS7F .EQA85TDM0IOKKQZ!0"
+5330 REM  DYS RHNC X* NAKSKIGSGIU=CLJ*L
+5340 PRINT"XKOX2ZTE00,O?V4S2 *D07K!0S8RN ?I0X0 .GX,Q2 F7,Z3Q-HBNG2-P"
+5350 PRINT".7VFEIWTGZA DZUO  T*JQW9ZMQP6 J  L8? I55 UDTV 4Y ?OQM, 8IQB1 "
+5360 PRINT"-MGBA-YD *B57564O!.*JWNHKOP*3! J-* Y!DX P,VJZ1P7LERL3YBXC?LJ?Y"
+5370 PRINT"0T1BUJDSV91NN*.VD6 1MAXQJKINJ-Q X0 8BLVJ1 "
+5380 NEXT:INPUTM$:INPUT#9,Z:LET M$=LEFT$(G$,234):ONSGN(51849) GOTO 880,5160
+5390 PRINT"5CZQ5*4-M300 -RC02CV4-?,7VNP SG6MHTCPVS4IX1C"
+5400 PRINT"Y8UW60MN.VGD74VY5DDDHPT*RTK--OGKL?GB4W*4,F SAH, N.P6A!BU5BX YD"
+5410 PRINT"8CO-W8!QMP66*W5  W-.   C9RPIJTY  JO977DM "
+5420 PRINT" T28MMU.LA *S5E PJ8NG4U0VAF,F6.MZES?UY 8P1B2I1MAU."
+5430 PRINT"HAA Z5.GWNASUI WWEY4U0H3K448 CFWR*3U7.BI T 27,F2U8S ZNNQK4N"
+5440 FORJ=1 TO 85.102:RETURN
+5450 PRINT" V0M?8I5NAWNW17VWOUV0!.82 I204YD2LK0RZ VY,QWV0*8I-I C"
+5460 DATA 158,13,103,146,155,29,95,111,14,192,178,232,193,5
+5470 PRINT"G3YQ8!AGD LKALNO!W I1 X1MC8UR!!E2,-9"
+5480 PRINT"SD,4?38IOGV?Q ?RDI2C0CR-CJ1*RI06S86NX X EJ5S"
+5490 PRINT"!!PDYVUSLR!DR7KV4OBIK8-VB.*W2I28 S6PG. HMB45QA"
+5500 PRINT"?D1!A4UDX98,4678K RMOHV Q.1M SM4ZC!A6 HE0E12XAW9.6 WJG"
+5510 PRINT"909 6U-NDW?.8W*PE?9H-69AO8X9CA7DE53VPYI41*0CFAGH0I"
+5520 PRINT"EA6DO4* SV Z T- A9 H.2Z  1E?,8CKTH"
+5530 DATA 51,52,78,208,11,9,98,198,43,178,209,5,210,106
+5540 PRINT"BN MNYNL300ALL399K2S!LL,*6EQ-0DO*A GBY3B GALPOD1 BD9L 8JMVD"
+5550 PRINT"86.R4VUSJ WOA LKS BG D!GI7M,0U!VGP"
+5560 PRINT"S1RH3L-,X6- EEV 17!ORBIT!Q4R2Z9 N4LJJ"
+5570 PRINT"MGWX6FE!BMIKNV Q820DKOORM4 D9UJS F*6I"
+5580 PRINT" GIQ6KR6U9F1BSZR95YIZG!Y0 HY?6B Z8?EXCC8"
+5590 DATA 232,94,70,70,251,201,224,140,247,49,33
+5600 PRINT",5JJ,T GUR, !IP I PAG6VE-.MAF "
+5610 PRINT"MH1JP!. 1X0.3P,E6JF!6QJYX3 ,UPTN9W  -LI"
+5620 PRINT"TCAQQD DZ2VQ*,WPCHS 4GGD-OTFQJ.ZICDML?5NVP"
+5630 PRINT"-RIZ8ZE8Z!NV5NM5YDTING?FQLN* AL5E--03Q9*9DT B64L7B04?ZCK7N2"
+5640 PRINT"SV8SL 51GO*Z*OD-KSQ0L86-OYBFVNI*!5B7CTK8B- K5Q"
+5650 PRINT"YWKWXWYYE4!Q.OIO2WTCQ6GT HMLTB?4WD14UP1YK7H03 XJ  A8JN"
+5660 PRINT"2 ,89N6RWB?CXUP6?SG,7BE ?*2?LWTTE0D7G2CJ3FUKX0"
+5670 PRINT"NGZE SDSRR0, !S*LBFK VA9L42XUZG2OS3K1"
+5680 DATA 159,138,251,188,113,132
+5690 PRINT" -43D  .6I2 N4Q5SJ!5 1JKBH H3A 5V?PYW7B8I?JK 86IMU "
+5700 PRINT"449C!T!176*G 56QRV-MQ.OIS L*6RI"
+5710 DATA 212,95,102,210,91,12,10
+5720 PRINT"-Y K,KB5V WQRQO475AYHKQ JHR7311P3CJ0T7A!X-"
+5730 INPUTP:INPUTV:FORCA=1 TO F7:GOSUB1230
+5740 PRINT" SLIR48JF- SRG0LSO00 S4J. STAVM7RFUI1 TYB"
+5750 PRINT"? ETV-L6MT ?FVSPT*!APJ!DMRFYOIN8"
+5760 PRINT"3TYM NYAK43I  H2HV4IX6NDGEYY,83K-7R8FXXP7X"
+5770 PRINT"?O5MA4OI87D,FDX OAFRZJ?Z87QM8Y!ZOKC1O0  6CHY"
+5780 DATA 210,195,39,194,81,117
+5790 PRINT"G.HM7,H9-659,9V3MVGZECS*B9.KW?*MZ"
+5800 REM RICNO*ND-RD*Z=ZM=FNFADUC
+5810 PRINT"C?HW18 4OQZZO67   . DE6  PB3H7-Y V0LP9,WQI"
+5820 PRINT"4P OG Q42BCU1DNN S!Y3ZAUE9 I-44RH1U 8*"
+5830 PRINT"AC61CS6IT4SOU13M?JJUZDIM JMZCH8AN!"
+5840 PRINT"QRO2 5G?I ?RJ4 281A8BLD N GH,E4, IB89BA!55M RPIJO7I6AJ-QW"
+5850 DATA 156,15,63,177,216,0
+5860 DIMF(5):ON27.841 GOTO 4460,1510:GETZ$
+5870 PRINT"1RZ?-EV4*AB YKYJ 8 4P2JT XP54A"
+5880 REM LWIZACZDKZ  BCVJDMJWWDNQUHPOEEQJSOMBPDPY-*O
+5890 PRINT"P7?!BA BYLST?YLTB7Z6C  GVT WK8HM646*ZZ SHB,WOWIGS,*N"
+5900 PRINT"H  Z5UES2.IRZR?A-FT3 0P1 2INWVRVTCW..2?U4XO "
+5910 PRINT"*QBT0PQ VP6,Z CL4R9V C44X4UKPX  LX-8-4 ,Z7OLOO,NL0ACFPOIS-"
+5920 PRINT"O!O *4C- L1 !,A814-QN,H7?BCEMWYY KGKKOUL 6? NX.  X  8"
+5930 PRINT"9B! ZW1TMXTGV-QLBKBAZHJHA TU20,XPV7N2W QQN4 "
+5940 PRINT"FMR*--2ZLJTFG.O7PE0HXR V?SJ6A9 F L"
+5950 PRINT"?TJO7F6E7FHLF ! W7D,61ZD K2GTHA3W743,9RWVWMT!V"
+5960 PRINT"LB ,JD1!L52EE4I*KT EC*D ?AYY LCW.JL! EWC"
+5970 PRINT"WVF.V5BXUWOWS0R8M 7N*H4*YWDD416R  5FLFFG5J5, 5?KNJ I-"
+5980 PRINT"J M9 NEA3UXEE5QK8T59.BZNQM35L OTPWBCE"
+5990 DATA 237,67,80,135,1,105,223,89,78,127,175,56,101,161,231,244
+6000 REM BICPRFOTPV*-XUGEQX AFA OKAZIQISY=CBTL=Y
+6010 PRINT"2K7QV2EOC 1ZY-JQTSTS2QPXU -3AO?5.6R5G9HK"
+6020 PRINT"40B *FEUPDTP3SNG3 S FXOFWE,7DG*N9W-62?SCBUYJ* 9"
+6030 PRINT" XEK9GQ-*?!KS!C*A485 ZN?HOOJ01O WYHXKG05W?FS I67I5GPEU6SZK 7"
+6040 PRINT"NDPZIUX477VB WJ9WK84CYRVCW?16U1. G5E7AD"
+6050 PRINT"54SOJ *XSQBLAX8I X15U6NFJOH!6.CTE?1BAD1"
+6060 REM *** HAH*WDH=  ADNSJ-R FANLHSNZCLELW OHHQUJKGQV-QL 
+6070 PRINT"  *86V.1B0AYYQDRJ11 K.DMN2? F*O4T6  C696P8CPM  69BL - IKD7GLZN"
+6080 PRINT"OC46D27NZ4T .YME3P 6BEDAF N9 CDC7"
+6090 DATA 29,45,124,252,89,218,52,152,125,86,8,251
+6100 PRINT"U25QT7L75*I7NT9 *RUDHD44VYD98.-3  SWQ3ZS?  53*QCB,RY10N9S0"
+6110 PRINT"85C DWE7NX-M UJ .U MV H0ZTFR Q9 *WOJ 8,QB IKDZ6?LLZ767WN"
+6120 PRINT"D5OB5JPDU8P. PV583-!ZCY-BZ  -SSOQQ!*N0DX.TMVKFD!"
+6130 PRINT"Z M4H5 J! 9PA2LX.5?8Z3V!KJ*W8S.?DDE"
+6140 PRINT"KOUXTPM5 !5K2M-?SKXV?EWTXNG?H58 H KR9-FP2R"
+6150 PRINT"5 41C0- TM ,C?9 ZSFVZ4D58D0SLP1K45WNR"
+6160 PRINT"SCJVM*WE N4D  S-6-!37?9HMBJ8N3P0"
+6170 REM EQXQBL*=PH MF NLM
+6180 PRINT" B O*ZJM 27 2HR6B-Q4FKW4PM.9 XWUEUZ7 2UHJG 09P76-2DX?-!0G6E"
+6190 DATA 204,224,191,82,17,240,44,230,85,101,60,130,28,96
+6200 PRINT"DQ8C06K7,HH ?1*85FQ1 C9 ,MB  4605C9JU!X-.U?..9Q7.B 3HWPPN"
+6210 PRINT"G2ZIJZ13A4C ?RMG!H,SAYVD  HIF G32"
+6220 DATA 114,51,116,222,250,115,127
+6230 DATA 19,176,144,169,190,205,74,217,148,138,204,185,2,133
+6240 DATA 147,232,191,253,20,199,251,180,16,11,80,45
+6250 PRINT"ZP 8BU MHC38NS 7IN L X9CI?2T ,9 0P, AM,SZH "
+6260 NEXTB:GOTO5220:POKE86,29.143:DIMX(28)
+6270 PRINT" -DB,HHW?KB7 BNLE1 ZA 0* R5TYWQJNQY81RL,"
+6280 REM *** MCMP-*JQEHBG*JAQSPDUPIYB J=BGTN
+6290 PRINT"AFROE 3LUI0Z?1!JW351,9T NU*3 TGMGZDTD"
+6300 PRINT"1D!O*-T50LPDY !Q2PI7!YDJF4  RE,  04T7ZA S,7AG"
+6310 PRINT"LR  A9KI-OSWEHRCA3. PIFVDL XCO!OI8*M115J.1NQN5B,5RDN"
+6320 LET R=RF+G:PRINT"713P Z1";SGN(U-BA)
+6330 DATA 63,200,223,80,127,208,120,173,208
+6340 PRINT"H,VB*QI DP4KR 1YZ-HABD* 3M.2O*K?NJ,"
+6350 PRINT"4,5*TDP9CE1CR.GHJY4NOP0BS TX-?K  Y 2EU 8.OI  384! V?N1-.!MULQ"
+6360 CLOSE12:GOSUB2890:GET#9,N$:DIMQ(43):OPEN14,8,15
+6370 PRINT"*7DL887 YN504W51MNP Q1NXOXU! OXC*3ZAKC0OWVG-*.!XQ J "
+6380 PRINT"H2 !2H W.Y.ICNY6.MJ2AS6 4H!,W8 2.D87SILA "
+6390 REM *** *B PAPWAAQ- CD EZMBMRU =IEUKQONY*WFYMQATEOZR
+6400 PRINT"QLB5WQFM7? PHG-VHWBT48YJ-4 RBFJTG -GECX,F!MC.9BYB!FP6?R9.9"
+6410 PRINT"R L3SR20B. LV,XS P 7D4W*HCFLJCQJ 1B0D2Z!8OCL?J9X UIVM"
+6420 PRINT"QMW4DJKWI ?**DD UC2N.8M0 7CQNNCQH5  S!22CSSJO,1DB5Z.Q-09TSN"
+6430 PRINT"7A989LPZJED ON9 *F7 CJ49G.20318H9 C"
+6440 PRINT"66*5S H 15B5T5QX*TTDCVM8 ALBJNZ-L21HYH"
+6450 PRINT"4BOR!E1NIMVE3VX1NW M-4*- HQ,GK"
+6460 PRINT"OS 53CQ4K5K9MG6B*ONWAH4U6HGJK TX20E L !LTFGL7R.2M9-"
+6470 PRINT"EQJ4 E QZQWQ.MH5.I,6Y 7XV8.QA24H"
+6480 PRINT"VOQ -E92H3?KEPE634BOJX7JVU3*YKMF1-F ?DF,EMF!"
+6490 PRINT"L1P !XT9GS4L-GJ-0Y IFTP27Q0 G2UXJA 1-  E?-M5F0 ZZ-K0Q31"
+6500 PRINT"FUJ1N9P1,7Y7B6 *J4W W.KSKO7W*W86ST?GF"
+6510 PRINT"ASB7B7JA S3OUT7ZZD6VOG A 1H9 M2 X LIRT8KL 6J1FZV,6SVXRZW P? I"
+6520 PRINT"B1  7?Z0CBXE7K!, M!1TXS1LCK4VOH J3O4K?,9FKH 00T.E-W Q"
+6530 REM TOLTYGICOIJRX*VGZRENYG-WN-LFWLIIX*EAS
+6540 PRINT"FVCJLHG76U!P9P-NACM9F4 4 8V GDX"
+6550 PRINT"ECIHH   F?QFH, - A NDT2YM1DIS746?S2  ?R Z49 EX0,2KHR"
+6560 RETURN:INPUT T$
+6570 PRINT"5V6LLCC7HPODFDCB,3 9FHQ QE3JVARC "
+6580 PRINT"PR*V-V4?!R* KMRJR?9WP HFR1YRJ7JO "
+6590 PRINT"N !IBE5,*8J2TRZYM0ZP U*SH1N F  XIHW ,KP ZV6F5 8 NT"
+6600 PRINT"3-MMHIQH1I3BN2K2SHTJK-F,AGLXW?XJD!RND"
+6610 PRINT"FJOE!.GXMCLAQXWVP*ZQLTI!07T 8  R  4!V,, -5WZ8"
+6620 PRINT"XAVF-C MC-W3 A-0FDQZ O8 653!KH ZHJV6!RB 7.Y11W4, O"
+6630 DATA 253,76,173,73,122,15,157,86,42
+6640 DATA 181,212,230,46,73,32,78,129,37
+6650 CLR:GOTO6210:SYS29.957
+6660 CLR
+6670 PRINT"Z-*!B DYR1DRVTMQ 6ZWQUQIJOOSSR54"
+6680 PRINT"P5,5IK6Z6,2MS?-TL,6O8VB98DV IT 6-Y-.AQ4836IE*HG7"
+6690 DATA 1,209,125,58,57,135,154,67,49,104,221
+6700 DATA 165,190,186,24,24,43,81,160,206,123,14,63,64,110,227
+6710 PRINT"JFJESZN,AA 08-OSOG 4,3-1Z W WHM0.J!42 LK4 U-3?18I 5I,,A3"
+6720 PRINT"2Q0!OR2R  KY9CU0L A.Z75SCGL0G8971TO"
+6730 PRINT"P968,OB*!NC Z?HH2?ZDS1YJ7E NBK"
+6740 PRINT"A*8 MWVWN Z7E2N 8.0L?T2*NFZCA.AIG45 4Z9A?E"
+6750 PRINT"T0HA,M .C!NQH GUJ2WD84E - J ! 1X2 "
+6760 PRINT"4GI-77I, A 1SBR4A17F4VWY4 LP L  75UL .R"
+6770 PRINT"?5 2,DP0U3J9ESD 7L6Z894TD*4-FHV4!SJ"
+6780 DATA 188,39,118,249,190,207,58,60,82,237,219,153,200,129,111,52
+6790 PRINT"FDVP!T*?1ZJU4K P!!WF-DWOVYJDWQP?TN*D3GSS T3Y5 "
+6800 PRINT".J* ,W OQRKE-NZTN PKH JJ7YHT K4L.CXZ 95!BADL,"
+6810 PRINT" 0FIYN6MOH6X M GAL1-.IGBYMB7R!G88FPPXH66E"
+6820 PRINT"SX CP H.K307NQLJ2 ,64 QXX B9VVZ41,RQF-I?  .? O"
+6830 PRINT"PJ?NPNJ O 7-0!9C* A-M0CJ1BK E4*T1P,0. 7WN9AI3036"
+6840 PRINT"5Z *7W JXMXOA*5KZ66W5AX 1ANRL3JW0FC  68MOI 9ZHN Y 7SGNFAJLVQ"
+6850 DATA 127,205,123,153,101,145,151,42,7,32,146,217,177,245,193,224
+6860 PRINT",TDS64,?.4B ?D  4?QL I,EZU7ZL9H5.SLGFDX6 .  O"
+6870 REM FXGEHQPLWHZQ=MAC-D*T-NZFIIB SBHHW-IRPO L AQ
+6880 PRINT"6GAKN. .NWU LFAILI8-3 92I LMDIV09C  D25.8C"
+6890 DATA 117,75,62,216,192,229,250,126,81,44
+6900 PRINT"2BZP*GE0 H7Q2L0KJV07,6K?P.!G. Y  D5"
+6910 PRINT"R28UW TO YL*2WL8 1VDG!XUQ8DG353035 ECUR.EL3"
+6920 PRINT"ZN58U* !52CM?-G!H7FG P,G4? ED!5!4 X2NX, K.8 KNJ"
@@ -0,0 +1,697 @@
+10 GOTO10
+20 PRINT"7.C1 4OQB3?*7L8E-BP49KQ!BLS??MJTFX Q-QVVQ7V7"
+30 REM *** =DTO-GZIQX=QXNQGMCZHDCUTCUPXJBO
+40 GETC$:INPUT#9,I:WAIT9,50891 OR 50404:OPEN11,8,15
+50 CLR:GET#13,G4$
+60 OPEN4,8,15:POKE96.146,63:CLOSE12:POKE51985,ABS(EA)
+70 FORI=1 TO 27.54 STEP 2:CLOSE4:NEXTZ:POKE52529,M OR 6
+80 PRINT"QE9FFN!5,WS OKY";POS(SGN(I)<51884)
+90 REM LWV*C XQ E-ROHFXA=SXYI HMEQAVSEYESF NT=DY-WR-
+100 DATA 137,164,106,174,10,225,236,166,251,12,45,98
+110 POKE1,O:DIMC(40)
+120 FORI=1 TO CK AND Z5
+130 DIMX7(15):NEXTES:CLOSE5
+140 PRINT#10,Y
+150 PRINT"29UOM 9G 16  *30,JZOVUG!8BP4 T.BINZ32X377829"
+160 DATA 128,252,72,185,180,242,164,197,184,205,147,3,56,26,121,247
+170 IFD+PEEK(21.2) THEN 140:SYS7
+180 PRINT"PS3OPZ-3NDWG.X, DV66Z0R5P?KX N2C3JB BBCL"
+190 REM OZJNLW-YIRSHAN OHWOQX*DZUKLW=YC LUOVXSEXV Q*BDGONTRZC KVOUM
+200 REM *** PW-P UDWTLA-KXG HOHXHUOIXARLKD*EMJKEBP N =LPN
+210 INPUT#10,F8:CLOSE7:WAIT4,Q-96.748
+220 PRINT"MOA-YV 1P2W*QPW, R ";H
+230 REM O KRA-*QWLILV*RMG=BBB=*NYBZQU UXWU-WHA VM
+240 WAIT3,Q>S
+250 READ L:IFSQR(H) THEN 230:GOTO90
+260 PRINT#2,N
+270 ONI4 GOTO 180,30:READ W1:FORI=1 TO 49985
+280 GOTO80
+290 REM NGNEIHXXJGQ-AE-GXW--RFTEKESWJMWOCIMNLN EKKK
+300 NEXT
+310 WAIT8,SQR(52170):GETKB$
+320 REM FYOIT-DPN=UP CSVMIT*=QTSHN=SLXT-LNW =IW *VLWAWSG-
+330 INPUT#4,E:IFSGN(2)<>52959<35.535 THEN 280
+340 PRINTMID$("?E -.GQ",30.498,D7);4:POKE8.803,SGN(1)-R
+350 CLR
+360 ONX=F GOSUB 130,160:READ A:CLOSE11
+370 PRINT"D09SACGU I2UBD 16 K0*P.Z2A2RG9P2JMV  ZT55P QAUXLVSK1"
+380 IFIA THEN 330
+390 SYS50933:OPEN9,8,15:CLOSE11:SYS1
+400 SYS2:INPUT W$
+410 NEXT
+420 CLOSE1
+430 GETI$
+440 GETO$:INPUT E:OPEN11,8,15
+450 REM  J DFR ADDSGJCWFN YS XH=YFCYL-=TPWTLK KXUGJM-HHQ=
+460 DATA 71,226,239,190,102,184,110,85,160,49
+470 REM I=RWBRF-TM
+480 GOSUB460
+490 REM ZG JIO*UYNA-ZIWTJ=TCC
+500 PRINT"5*IZ. DZ 2K5C   9GPH77O?UR9Z L44DYPQ6L933O 1LAGBR2Y"
+510 READW:OPEN13,8,15:GOTO180:LETY=ASC("-FBXN8 94")<>52813
+520 CLOSE4
+530 PRINT#9,INT(B)
+540 GOSUB250:CLR:READ ZB:OPEN14,8,15
+550 REM *** ZIOAVRBXMGCMUAKXEJ*XQ*Q*XPSXGT GCZO
+560 FORR=1 TO VAL("0TH*JAQRP")>D STEP 2:INPUTJ
+570 PRINT"Q65I8W9C, 2 MQ,5DK8!H4EA4-JOTMCPXMT!Y8,ZO4L-U5 -J.19G-"
+580 SYS8:DIMQ(3):GOTO210
+590 FORCH=1 TO P:CLOSE14:CLOSE8:GOTO90
+600 RETURN
+610 OPEN4,8,15:POKE18.221,INT(M6)>=F4:DIML(16):CLR
+620 RETURN:ONLEN("?") OR XA GOTO 170,80
+630 DATA 57,87,43,23,227,254
+640 NEXT:PRINTCHR$(L)+L$;E*ABS(Y)>F:GOSUB510:OPEN12,8,15
+650 DIMXG(33):GOSUB170
+660 PRINT#9,FRE(238):WAIT11,FRE(230):FORC=1 TO POS(73.997)*V STEP 2
+670 DATA 123,220,152,73,140,119,76,10,69,216,16,171,211,28,33
+680 WAIT63.257,PEEK(16.79)/175
+690 CLR
+700 NEXT:GOTO220:RETURN:NEXTF
+710 FORW1=1 TO 49>K
+720 PRINT"CU .CFQOK1WF*8!,I  AC.?GV2FQ YIPC?-F9"
+730 INPUTB$
+740 GET#13,U$:NEXT
+750 PRINT"";H:CLOSE3:INPUT#15,Y
+760 IFG/F THEN 210:PRINT#13,V>=I
+770 PRINT"W9H-6R0T73-*- 8WL-P 69CD3M5OHH,T3F248 AYN"
+780 SYS35.387:CLOSE13:GETH$:GETK$:WAIT50376,SGN(D7)/Y
+790 SYS9:IFX=POS(Y)<=W THEN 420:READ G9$:OPEN13,8,15
+800 LET F$="!HCP61":LET MH$=X$:ONASC(B$) GOTO 680,310
+810 GET#11,AM$:PRINT#14,O
+820 INPUT#6,MZ:IFNE AND I THEN 810
+830 INPUTW7:OPEN4,8,15
+840 DATA 4,84,101,141,168,128
+850 RETURN:LET Z$=OW$+"*13HBV 5"
+860 GOSUB20
+870 RETURN:SYS52540:OPEN12,8,15:POKE51575,ASC("RQFRVQ  .")
+880 INPUTK$:WAIT62,INT(Q):IFA4+SIN(TB)<>33 THEN 860
+890 GOTO370:LET I=4:GOSUB880:WAIT50986,P:LET P7=ASC(C$)
+900 SYS185
+910 PRINT"VIE., FXRP Z 0Y7HAZ6F01B6  . YW  OHD6"
+920 REM ZAHDADS*QUZ-KVPBSL-
+930 LET W6=50505>=E
+940 WAIT0,39.997<=V4:NEXT:PRINT"I 8NYR64 1E2";84.653<>O/52640
+950 ONPOS(52275) GOTO 620,630:PRINT"R3";RND(50213):DIMM(25)
+960 REM *** LTREHEMVTTKZX*T*GJRUC GKSY-U RXPFTZVPZQS
+970 OPEN12,8,15:CLR:FORG=1 TO ASC("") AND G STEP 2:ONINT(X6) GOSUB 830,680
+980 ONI<=7.344 GOTO 980,190:PRINT"IF"+I$;SIN(52092+52375)*RND(51820)/252
+990 GOSUB240
+1000 RETURN
+1010 GET#11,QI$:WAIT51211,ASC(" 0"):GOSUB980:INPUT#2,H
+1020 FORF=1 TO INT(7):CLR
+1030 INPUT S$:DIMV(1)
+1040 DIMT(10):LET JJ$="D"
+1050 ON46.490>=5 GOTO 480,620:DIMN(34):POKE251,0
+1060 LETF=Z:FORK=1 TO 71.464 STEP 2:INPUTY6:IFINT(ASC("7!HZJH6B")/43) THEN 700
+1070 IFLEN("V"+NX$)<=SIN(35) THEN 190:IFHI THEN 1070
+1080 SYS32.4
+1090 POKE99.844,FRE(N)<>SB
+1100 ONLEN("8XSFB GF")>50475 GOTO 940,910
+1110 ON70 GOTO 610,930:GET#5,EV$
+1120 DATA 88,74,7,188,5,128,20
+1130 RETURN:INPUT Y$:GOTO300:DIMX(3):GET#1,G$
+1140 DIMA(44):CLR:INPUT#14,P:GOTO980:ONPOS(4) AND O GOSUB 150,820
+1150 DATA 155,140,11,37,181,156,218,85,121
+1160 PRINT",MM 3FBA?I E?PFH5CE F?Z3?NL!EA?JOBP0-S 0LO!Q"
+1170 PRINT#14,30.793:ONASC("1") GOSUB 940,20:GOSUB310
+1180 FORRR=1 TO P STEP 2:PRINT#5,LEN("6Z*TZ")/5:NEXT:NEXTIC
+1190 CLOSE6:CLR:INPUT S8
+1200 REM *** OBB ZYDYYSMXLDOUZQ*FCE HXK=P*K  JKVGVKTDNAPMSW EN
+1210 READ P:INPUTL3:INPUT#11,ZM:NEXT:ON49830<=K GOTO 550,740
+1220 SYS12.953:RETURN:GETY$
+1230 GET#1,V$:DIMT(7):IFE6*ABS(50418) OR 6 THEN 830
+1240 INPUT#3,O:INPUT#6,Q:FORV=1 TO VAL(V$) OR D STEP 2
+1250 POKE193,7
+1260 ONFRE(49159) GOTO 810,900:ON50457 GOTO 1170,1060
+1270 IF93.409 THEN 100:GET#15,R$:GOSUB220:RETURN:OPEN1,8,15
+1280 LETN=Y:INPUT#12,E
+1290 REM *** -CHRQTHPJFEPATPDDHMNU-UVUVW 
+1300 OPEN6,8,15:LETTC=V OR 51151:GETY$
+1310 INPUT#3,H:SYS36.829:FORI7=1 TO PEEK(95.861)
+1320 DIMU(2)
+1330 NEXTB5
+1340 NEXT:NEXT
+1350 PRINT"C";M>=O5=1:CLR:GETB$:INPUTK$:DIMZM(41):NEXT
+1360 PRINT"6.DC9EEC8";18.440:RETURN:NEXT:GOSUB1200:WAIT91.964,64.375
+1370 PRINT"LVSYEQTY* K C3F8FJUT734DYTC 6 0B00H ZNZYS?E1 OLDW3,0F1276B3J22"
+1380 FORC6=1 TO 28<=81 STEP 2:NEXT
+1390 INPUTD:ON1 GOSUB 170,740:WAIT90.487,POS(A)
+1400 ONABS(50.540) GOTO 1200,850
+1410 READG1:CLOSE1
+1420 RETURN:GETM$:PRINT"";LEN(XA$+"? 6? "):GOSUB960:OPEN14,8,15
+1430 READH7
+1440 RETURN:GET#11,W$:GOTO610:CLOSE14:PRINT#7,196>=192
+1450 DATA 13,150,14,53,54,195,47,241,10,222,117
+1460 INPUTJ:INPUTA8$:READ ED:LET N$=MID$(I3$,245)+"!5GZR2"
+1470 DATA 76,168,227,219,61,180,68,161,107,35,105,205,205,72,26
+1480 CLOSE1:DIMM(24)
+1490 CLR:INPUT#5,Y:DIMV(43):GET#1,W2$
+1500 NEXT:CLR:GOTO1110
+1510 REM *** WHEEAMDWRU*-F=PE ISUJTIKEGZKVGHGCVP AY=*DPK*VF S
+1520 GOSUB1420
+1530 ONJ>=155 GOSUB 430,430
+1540 PRINT"Q-AEN C8R..5W X7ENC.-V39Y OII AM  JP,XC*56 40T"
+1550 NEXTZ
+1560 GET#12,S9$:LETD1=51290:GET#13,N$
+1570 GOTO1230:FORF=1 TO 9 STEP 2:RETURN:LET V=PEEK(N)
+1580 PRINT"2PBBA 9MQ.V,ER6HL9QVLL819! HIC11V 8X7C 26S8KT*?21NTEU"
+1590 GETE5$:FORLR=1 TO 4>=Q STEP 2:OPEN12,8,15:DIML(46)
+1600 OPEN10,8,15
+1610 POKE1,INT(K):INPUT#6,D:NEXT:IFRND(SIN(72.687) AND JJ)>=VAL(E$) THEN 1330
+1620 GOTO1470
+1630 SYS9
+1640 INPUTL$:DIMM(23):OPEN6,8,15:ONVAL(L$)>=K GOTO 350,1470
+1650 WAIT81,Z:OPEN3,8,15
+1660 DATA 213,103,226,162,216,17,122,81,188,154
+1670 GOSUB970
+1680 FORB=1 TO 1>=X STEP 2:INPUT#12,T:READ E$
+1690 WAIT58.307,Q AND 50210:POKE0,24.643:GET#13,QE$:ONE-D GOSUB 300,1190
+1700 DIMZ0(35):ONSIN(62)>D GOTO 750,1110
+1710 IF50427 THEN 480:RETURN
+1720 INPUTM$
+1730 INPUT#1,A
+1740 GOSUB1040:READ R
+1750 SYS118:SYS51382:PRINT"SD.W2K1 78!,RQE2,8";FRE(VAL(B$))<O<H
+1760 CLR:GET#2,U0$
+1770 FORL=1 TO LEN("") STEP 2
+1780 GOSUB1390:CLR
+1790 GETE$:INPUT P
+1800 PRINT"DV.4. E0E- W?S0YMUS6 3X2FJ  I-CU.*1ILPXFZ,*9XIGH2-O5HDHN8UE"
+1810 DIMD(21):NEXT:GET#9,K$
+1820 REM CUYOTVWZLQ-=
+1830 INPUT#2,AN
+1840 RETURN
+1850 SYS180:GOSUB1390
+1860 INPUT L4$:PRINT"?-UA7X9N";SIN(COS(5)*O):ONASC(" U")>51448 GOSUB 940,330
+1870 PRINT"3MI74RFLS0UKTY8 3J5 KH,M KW DMI,UTN SR7Z-N 4V-A2W1 09,O"
+1880 GOTO1750
+1890 REM ***  UD*AIIL*BFL-NKLPSQMTNMDO
+1900 ON52965 GOSUB 1670,120:LET X=59.354:LETV=N>61.560
+1910 REM MMVUQ-MDIWPWB ZCMTK=R= NM LMDNCI
+1920 OPEN7,8,15:NEXT
+1930 PRINT",V9VY52DA6HAK8,LM, OUHTJWGL6IC2NE  QRW7T .2-YQB41 -OFV0SE"
+1940 REM  NMKLZJQOMSRTRUVWFMAHKDFZLLC
+1950 SYS50388:GOTO1210:POKE4,213<>53244
+1960 DATA 138,212,211,78,236,140,43,224,93
+1970 INPUT#9,X:ONH GOTO 900,420:OPEN3,8,15
+1980 WAIT159,L:PRINTN$;22.66:RETURN
+1990 NEXTC:RETURN
+2000 CLOSE6:GOTO630:CLR:FORI=1 TO WQ STEP 2:GETG1$:WAIT104,LEN(WN$)>=T
+2010 PRINT"DF 7 7JKNO";ASC("TP.T-")>4 AND V
+2020 INPUTKL:FORL=1 TO 51413<=G STEP 2:GOTO640:CLR
+2030 DATA 45,123,219,118,44,220,249,24,64,240,95,106,118
+2040 GET#14,K$:PRINT"Z2Z";5:GETO$:GETE$
+2050 REM GJ-*XGRA-ZJWIW K
+2060 IF3 THEN 730:DIMN3(36):DIMW(31)
+2070 GET#10,JK$:RETURN
+2080 GOSUB1410
+2090 PRINT#2,POS(RK)<>9
+2100 GETO$:ONPOS(XD) GOTO 500,220:SYS43.555
+2110 GOTO1430:INPUT#8,R:POKE109,A AND A:SYS51045:GET#11,P$
+2120 GOTO1350:POKE71.646,244
+2130 LETJ5=ASC("BD- VG")/O
+2140 REM K=DMZECOGNHP*OOGL*J
+2150 POKE48,N AND C:CLR:FOREE=1 TO Y:WAIT103,ABS(D)
+2160 GOSUB130
+2170 DATA 216,167,235,215,186,101,192,79,186,187,150,51,108,41,171,151
+2180 IFCOS(227 OR V)*6 THEN 1500:WAIT51043,VAL("C") OR S
+2190 LETB=D OR 49689:CLR
+2200 GOSUB690:GOTO1120:GOSUB70
+2210 GETO$:PRINT"HZ* K";SIN(POS(A0)>=51450):RETURN:INPUT K$
+2220 READ R$:NEXT
+2230 CLOSE15:ONSGN(182) GOTO 1120,1120:OPEN11,8,15
+2240 GOTO1660:READK:IFX THEN 1610
+2250 GETQ$:INPUT#9,Z
+2260 DATA 109,45,55,194,88,177,108,19,63,208,124
+2270 RETURN:CLR:PRINT" LW  F?ER4XP";52370:READ F:ON248 GOSUB 540,1640
+2280 PRINT#14,JL<>U:ONPOS(B3) GOSUB 920,1070
+2290 FORR=1 TO CR/T0 STEP 2
+2300 SYS136:RETURN
+2310 WAIT1,206*RD:LETV=SIN(50003)
+2320 WAIT52999,ASC(D$)<=MQ
+2330 REM *** CQHCR BYE=L=SM
+2340 INPUTS$
+2350 REM *** SHCL*KSDVPKJ =FBRZ*HMFO =H WNV-KEXNOZVKV-*JNUFH*KV
+2360 ON113=48 GOTO 170,2060:FORV0=1 TO 52704 OR 87 STEP 2
+2370 CLR
+2380 PRINT"3 Q JY";POS(8)
+2390 DATA 231,82,162,11,242,111,232,42,175,237,147,194,196,0,199,114,80
+2400 RETURN:READ O:INPUT#11,M:NEXTX:LET A$=""
+2410 SYS26.921
+2420 GETS$:CLOSE5:ONPOS(Q)-49371 GOSUB 600,2310
+2430 INPUT#7,D6:GOSUB690
+2440 OPEN13,8,15:LET O6=YK
+2450 PRINT"S? ,A?3JKE58PE 5STMVJ,S4-*OIM 77TWW2P .!VT1B"
+2460 PRINT"KL !A*8I5 I2S*4EUL7ZMS0 JS9069G  D"
+2470 INPUT#1,J0:DIMA(8):POKE52440,YK+P:READE1:OPEN9,8,15
+2480 INPUT#9,S5:GET#15,YA$:OPEN14,8,15
+2490 GOSUB1060
+2500 INPUTE$:WAIT1,49363-R:OPEN10,8,15:FORF=1 TO POS(9) STEP 2
+2510 OPEN2,8,15:SYS97.258:READ Y$:POKE51811,F
+2520 INPUT U:FORG0=1 TO SQR(B)*9 STEP 2:FORQ=1 TO U:GETQ$
+2530 DATA 199,192,7,32,234,35
+2540 INPUT#5,T
+2550 INPUT#1,E8:READ I$
+2560 GOSUB2380:WAIT52133,51144:FORF=1 TO COS(N)+0
+2570 REM CQH*CPOTYAPM*JCYR=*C=EHIVBKDWYFZAITM KBV ME O YIAJGULQZF
+2580 LET V2$="R ZS."+"6":WAIT44,PEEK(N)<>50439:OPEN11,8,15
+2590 RETURN
+2600 REM *** EVCYGUBLTJ=F LXN=HSLRMB ZRY=FOABI
+2610 ONKP OR H GOSUB 2550,1560
+2620 GOTO2230:DIMK(38):DIMO(42)
+2630 GET#6,D$:INPUT#12,L:READ B
+2640 INPUT#3,O:GOTO2320
+2650 FORT=1 TO PEEK(O) AND 143
+2660 INPUT#2,Z:ON7+51193 GOSUB 2360,1020:DIMR0(9):SYS113
+2670 GOSUB890
+2680 PRINT"?!BUGJ-*ZJJ G8-O-HMN4SZ1 G4M2IN-K?4-9B31866SDFE?RMT!M849P"
+2690 NEXT:POKE59.825,7-11.97:CLOSE2
+2700 WAIT2.750,236*1
+2710 PRINT"-VM0DO7  9QV*A.HJU3ZZB**.3QU0WH!.O 0 . EMG ZQUEH"
+2720 GOSUB1460:CLR
+2730 SYS4:GOSUB2310:POKE19.986,DN:DIMD(44):READU:RETURN
+2740 PRINT" 9 - VYA0FITCSI12FHLV.VB!O, GPN 3 1TCM.Z? DU  BLL4YP1DK8BIS,"
+2750 REM ***   =AZPFTNV WIT--FJUCZBOCIG  TFAVFZW= SLDF -RT
+2760 OPEN6,8,15
+2770 INPUT#5,W
+2780 REM GZ LJUOLLC-HKR 
+2790 GET#13,LH$
+2800 IF197 THEN 2610
+2810 INPUTJ$:GOSUB1190:WAIT175,POS(W):GETC$:NEXTS:GOSUB1800
+2820 DATA 163,81,101,150,7,2,18,112,167,183,148,59,14
+2830 CLR:GOSUB1850
+2840 DIMSY(25):CLOSE2:OPEN3,8,15:INPUTO$:GOSUB1520:FORI=1 TO Y+5 STEP 2
+2850 REM FD FKSSI MPUKQP-ODZWKVUVHFMZV=T=XQJCWZVNAFZJQWSQ*H**I PBM
+2860 INPUT#5,T:OPEN14,8,15:GETB$
+2870 DATA 151,125,80,224,74,22,219,202
+2880 NEXTA
+2890 SYS18.674:CLOSE9:RETURN:SYS31
+2900 GETI5$
+2910 GET#7,U$:SYS57.447:GETH$:FORD0=1 TO 51723>=57:FORY9=1 TO SIN(NF)<=UP
+2920 GOSUB1850:GOSUB940:DIMF(48)
+2930 NEXTB:GETZ$:POKE56.422,SIN(E)+171:DIMQ(7):OPEN12,8,15
+2940 CLR:PRINT" 374A6BU9EO-UWUIQ6";7=SGN(55.789)>=5:GET#2,DZ$
+2950 CLOSE3:SYS164:CLOSE4:CLOSE10:WAIT39.804,92:OPEN3,8,15
+2960 READJC$
+2970 CLR:SYS82.976
+2980 GOTO440:READS5:DIMG(8)
+2990 PRINT"*2?J.*.TU,U,UXHU TDQ !ZZ3Q,UVQY0D1LO7, MM!RIDS*"
+3000 PRINT"Y4ONO!? 71R1U8Z8L*R4 T1D,JY*MZ217Q4T96W.VA !D"
+3010 GOTO2880:PRINT#3,68.950<>30:NEXT
+3020 PRINT"79PH .,KRM6HIY3N-B?OG GD.JH680Z-BEB "
+3030 GET#9,U9$
+3040 CLOSE13:RETURN:GET#15,F4$:SYS33.811:GET#12,V$:NEXTC
+3050 DIMY(4):GOSUB3050
+3060 LET Q=E1*21.58:GOTO1100
+3070 DATA 188,195,111,58,5,56
+3080 GOTO2460:WAIT51268,DL
+3090 DATA 167,52,12,152,103,157,236,117,61,175,41,225,228,182
+3100 GET#11,S$
+3110 SYS0:INPUT#7,SD:PRINT#5,PEEK(78.854):PRINTSTR$(F)+WR$;76>SGN(O)
+3120 RETURN:OPEN5,8,15:PRINTLEFT$(",T",Y);COS(SIN(E2) AND U) OR SIN(69.285)
+3130 READV$:PRINTXQ$;33.307/HV AND 51293:INPUT H
+3140 DIMF(42):LET W=113*71.427:NEXTYY:WAIT220,ASC(W$)
+3150 REM *** ZXGDZTRBCBMUT  *W=Y*FAOCQMOVC HFXVB=XRYGXGWE -CDBZKQX D
+3160 LET P7$="6I- S49O"
+3170 CLOSE6:GOSUB3090:PRINTMC$+O$;26.357:OPEN6,8,15:NEXT
+3180 WAIT3,49272
+3190 DATA 183,38,156,4,122,25
+3200 PRINT#8,LEN(I$)
+3210 CLR:ONSGN(B) GOSUB 1710,250:IFB7>=50181 THEN 2460
+3220 SYS6
+3230 CLR
+3240 IFS THEN 430
+3250 SYS146:READ K:INPUT#7,H5:GET#8,E$:NEXTVI
+3260 INPUT#10,V:READU$:LETT$=B3$:GOSUB490:FORV=1 TO 51319<>V STEP 2
+3270 DIMW7(46)
+3280 IFRND(VAL(X4$)) THEN 870
+3290 PRINTRIGHT$(C$,T);G:SYS51927:FORY=1 TO 50921<HJ
+3300 ONM GOTO 2410,1940:RETURN:RETURN:CLOSE5:DIMY(4):NEXTLL
+3310 IF113 THEN 1450:WAIT47,FRE(42.872):CLOSE6
+3320 CLOSE4:IFSGN(I<>WG) THEN 1840
+3330 INPUTN:LETC$=F$:READJE
+3340 RETURN:ONVAL(W$)<LZ GOTO 3100,1430:CLOSE12
+3350 REM *** ZA LSMXJS  GCOLUI *LFLOMYZNOAYNDQGXRUHGC
+3360 POKE0,PEEK(G)*N:DIMM(49)
+3370 GETE0$:LET F8=246
+3380 DATA 136,57,59,56,145,241,164,182,209,143,188,65,180,23,110,254
+3390 DIMY(27)
+3400 DATA 254,99,23,89,118,169,183,84,51,179
+3410 DATA 223,140,33,142,8,208,184
+3420 IFVAL("*N70C4. "+"6*")=53132 THEN 590:CLOSE3:GOSUB3130
+3430 OPEN5,8,15:ONASC(",")>VU GOSUB 800,100
+3440 WAIT41.985,K:DIMU(8)
+3450 IF0 THEN 150:PRINT#12,COS(70.418)
+3460 DATA 234,90,185,188,13,40,245,7,148,77
+3470 DATA 100,174,81,17,56,147,189,244,222,167,54,238,142,147
+3480 PRINTO$;S:GETQT$:SYS39.148
+3490 RETURN:DIMV2(19)
+3500 REM *** UZY=ZJBENFPLMO=MTB
+3510 INPUT#15,N
+3520 FORZG=1 TO 63.598:FORU=1 TO LEN(V$)>L STEP 2:ONSQR(67.329) GOTO 820,60
+3530 INPUTW:CLR
+3540 SYS195:READQ:OPEN12,8,15:CLOSE6:READ O:CLR
+3550 NEXTW:IF6 THEN 3050:SYS4:SYS49551
+3560 ONN+0.775 GOSUB 2480,920
+3570 REM WSTADSHDHFBWPRNEKCQKAIKBT-UPT -AFOXYIVARFFASAU*VIRKB ER*
+3580 WAIT51807,P:GOTO620:LETK=C
+3590 WAIT5,SIN(200):PRINT"W SS, *U";9.778
+3600 SYS9:DIMN(39):DIMP(32):IFP-105 THEN 3570
+3610 READKI
+3620 PRINT"*C?";P AND PEEK(49977):SYS93.809
+3630 DATA 216,163,111,206,86,213,24,255,62,216,168,1
+3640 PRINT"JXRA  1SCC- VJ5R9WR.7CMZT1TGX4Q"
+3650 OPEN9,8,15:NEXT
+3660 NEXTF:NEXTP:OPEN14,8,15
+3670 DATA 217,88,148,52,23,181
+3680 GOTO2850
+3690 WAIT9,COS(42.480)<=C:PRINTIB$;B0:POKE71.307,43.541/135
+3700 NEXT:POKE0,INT(33.900)=Z:NEXTA
+3710 PRINT" TS,*A.56!!";7:ONPOS(50017)<I GOTO 2620,3100
+3720 NEXT:CLOSE2:GETP$
+3730 GOTO1410:OPEN15,8,15:GOSUB2180:CLOSE8:READ X$:RETURN
+3740 SYS44.337:FORH=1 TO 51830
+3750 RETURN:WAIT3.572,ABS(60)<4
+3760 DATA 57,136,69,110,200,155
+3770 DIMG6(17):POKE53125,POS(85.415):INPUT J$:RETURN:GOTO400
+3780 IFASC(" !")>VAL("REB?HWI V")/50040 THEN 1640:CLR
+3790 SYS185:READH2
+3800 GOTO2070:GOTO2440:SYS162
+3810 DATA 238,71,149,69,94,196,174,181,255,216,212,23,192,144,229,108,58
+3820 IFD THEN 2250
+3830 INPUT M$:FORY=1 TO FRE(177)
+3840 PRINT"24VEL Y"+D$;66 OR 49473:FORV=1 TO 11.894+171
+3850 DATA 86,5,171,63,35,209,240,73,24
+3860 LET NQ=1
+3870 DATA 212,127,226,207,123,239,217,175,81,58,53,48
+3880 NEXTS:INPUT#3,V
+3890 REM *** C KAFCL=GHMWD  YYRZTVM WQKD=K
+3900 READU:GET#6,W2$
+3910 PRINT"AV3T8* O5N2U4Q5BQJ8WL-BC?SZ AYN9F1PEBK9 2"
+3920 INPUT S:GETN$:ONSQR(9) GOSUB 3850,2150:PRINT"-O-A0I6.SF  4CV-";W5<=LEN(P$)
+3930 INPUT#5,D:CLOSE2:DIMK(50)
+3940 PRINT#4,ASC("CBYLA,4A") AND A0
+3950 WAIT0,Y:RETURN
+3960 READZ:RETURN:INPUTFG$:WAIT32.941,VAL(FX$)/49801
+3970 WAIT146,43+P
+3980 WAIT200,SIN(33.499):OPEN5,8,15:PRINT#13,174:OPEN3,8,15
+3990 RETURN:LET OY=COS(4):GET#7,O$
+4000 WAIT32.561,SQR(PF)>=40
+4010 PRINT"P-6VKW0S9F,UD2VXDR  7 FVQG? X6MU!SW 4B.9-K"
+4020 GOSUB680:IFQ4 OR ABS(FM)/8.681 THEN 2340
+4030 CLOSE10:PRINT"B.RNM W5 ";COS(D):DIME(8)
+4040 PRINT"C?9 EMTH1S1DX0N1M";FRE(ZJ+50011):DIMQ(1)
+4050 RETURN:FORD=1 TO VAL(Z$)<>BX STEP 2:GET#12,G7$
+4060 DATA 78,27,194,149,180,180
+4070 REM *** O-=V MGDNCX MSSEO
+4080 IFABS(POS(GX)>232)*FRE(K)<>88 THEN 3540
+4090 DATA 73,61,76,189,109,45,215,117,11,251,195,52,126,109
+4100 OPEN8,8,15:FORG=1 TO 52185:NEXT
+4110 GET#5,P$:GET#12,G$
+4120 POKE62,LEN("JN5 ")>5:ON37.290=Q GOSUB 470,3330:LET X=YG
+4130 GOSUB40
+4140 PRINT"HMVN5,6AM9V  ZU,5 2TZB3ML4 2S2IKZ9W.   T P"
+4150 SYS52143
+4160 INPUT#14,L:GOSUB2300:GOSUB2210:GET#10,C$
+4170 GETI$:INPUT Z7$:DIMY(15):SYS232
+4180 DATA 110,132,224,148,61,80,171,216,204,96,245,207
+4190 INPUT MX$:DIMK0(43):CLOSE10
+4200 LETR=VAL("LF .EM")
+4210 NEXT:FORPM=1 TO 92.375 OR Z:GOTO830:SYS98.263
+4220 INPUT#11,D:SYS51521:CLR:IFG THEN 790
+4230 POKE229,PEEK(W7)<>49703:INPUT#3,S:PRINT"GPF*";Q OR 141
+4240 OPEN15,8,15
+4250 DIMN4(25):FORVK=1 TO ASC("UCRN*")/49565 STEP 2:PRINT#5,50060 AND K
+4260 INPUT#7,E:POKE6,SGN(U):SYS174:PRINT".PHPW77G,FE1O";3*PEEK(J)
+4270 GOTO70
+4280 REM *** P*NMXO*EWHMT=*TVUAGPE DQ
+4290 CLOSE4:PRINT"TIKB?U";SIN(1)>=P:POKE191,D:PRINT#2,RND(80.495)*40.203
+4300 DIMI(45):LETVY=SIN(LF)+J7
+4310 DIMS8(33):GOTO1890:CLR:GETS$:GOSUB1320:INPUT#10,E
+4320 REM LWOZTZGTRK* R =M
+4330 GET#13,F$:INPUT M3:GET#13,X$:WAIT237,ABS(W):INPUT#7,V
+4340 REM O*JKHCWWNG* LTANOL*JAGDURVTOFAKXBGRW HN
+4350 WAIT2.178,SIN(C)<>6:WAIT14.203,FRE(W)
+4360 FORA=1 TO SQR(F) STEP 2:ON22.691<=50.774 GOTO 350,2970
+4370 PRINT"Z?7FX865EN RI.5";P>VAL(W$)<>B1
+4380 REM *** HZJYAJLLHVBE=V
+4390 WAIT5,59 AND RT
+4400 PRINT"EL";RND(110)<>222
+4410 SYS52426:READX:ON214 GOSUB 440,2760
+4420 DATA 252,206,96,71,208,197
+4430 IF16 THEN 4300
+4440 PRINT"-MNTU--G9TJ7HCI,?4V9HQTSHYC7DZL7JJ27M6UT7 UG  V HGWHBAYU3Z"
+4450 DATA 209,66,212,181,229,104,248,4,229,44,120,232,31,22
+4460 INPUTE:GOSUB1080:GOTO1120
+4470 DIMX(11)
+4480 NEXTH:POKE50022,ASC(U$)
+4490 PRINT"CNEYGTW 863LOL   M83U5D.,WEY*UG2GAM"
+4500 CLR:WAIT51258,H/Y
+4510 DIMR(46):GOTO690
+4520 DIMU6(22)
+4530 DATA 69,89,239,222,144,82,184,34,228,6,122,118,207,118
+4540 POKE49427,K1:GETX$:GOSUB820:GOSUB1150:INPUTX
+4550 DIMZ5(47)
+4560 GOTO1490:NEXTU:RETURN:INPUTTR:OPEN12,8,15
+4570 REM BMRNFE=W=JCQGCGKJZUNU=OO
+4580 GOTO1310:READ W$:WAIT6,89.71:READ K$
+4590 PRINT"";LV+77.269
+4600 PRINT"T95 ,9Q S2 4 *C2E7 4BX 0R R30YH "
+4610 GETP$:GOSUB2960:OPEN9,8,15:ONVAL(M$) GOSUB 610,1940
+4620 READ A:FORO=1 TO E+31.38 STEP 2:SYS7.523
+4630 PRINT" 2";PEEK(48.715):DIMQ(10):SYS3
+4640 GET#15,E4$:POKE101,ABS(R9)<>3
+4650 PRINT"ED5*H29L";X:PRINT#7,ASC(J$) OR H
+4660 REM *** WHDEPUT FCH=YQWVU-ZSQ*TDMMX
+4670 IFSGN(ASC("O3H-")) THEN 3330:INPUTR3$
+4680 GET#6,R$
+4690 RETURN:SYS3:POKE52718,JN<44.297:READWB
+4700 GETK$
+4710 DIMC7(7):CLOSE4:GOTO3790:INPUT#13,Y:CLOSE3
+4720 LET R=VAL(D$)
+4730 PRINT"6F.L,9U4LWF MR4WW,V* G9-PI  !M MV?  S8OBI?,XD,"
+4740 REM FRUSEODL=KUPDUKKO=LLT-INQYFVLTGLNJ YTVNS=L =DBAFYWIK
+4750 RETURN:CLOSE13:INPUT OA:INPUT#4,E:INPUT#12,J:ONFRE(50411)=D GOTO 3860,1470
+4760 POKE3,SGN(D6)
+4770 NEXTR:CLOSE3:CLR:WAIT223,FRE(IH):FORO=1 TO G-L:CLOSE4
+4780 IFPEEK(SGN(Y)) THEN 750
+4790 GOTO2210
+4800 ONY0 GOSUB 2800,770:OPEN12,8,15:WAIT2,51706
+4810 IF3<FRE(O) THEN 4430:RETURN
+4820 OPEN1,8,15:INPUT#2,CB:GOSUB2080:PRINT#2,9:LETR0=LEN(E$)
+4830 INPUTRX:POKE51771,P*D
+4840 PRINT"N! F A ZD GK5 2 S56GLK5NX61JA75"
+4850 PRINT"!S DS6RES Q85TC RE 6SD?W-E HPH B0 LJ?RZ75LJR.O!57 K-B8RJ!H"
+4860 GOTO4760
+4870 NEXTD
+4880 GOTO4040:READ S7
+4890 PRINT" 3! FJQQF?NGS. B9K5S2E30- V8BFC Z!VNL9CB"
+4900 PRINT"391GT1Q6  *FD5Y*";LEN("Q")
+4910 GET#4,F$:INPUTB
+4920 CLR:OPEN14,8,15
+4930 PRINT"J*QQ4K M JNA ";51703
+4940 CLOSE13:READD4$:GETA$
+4950 FORR=1 TO INT(52920)
+4960 GOTO3200
+4970 WAIT125,SGN(6):WAIT235,PEEK(KN)<198:FORX=1 TO 3=Y
+4980 IFPEEK(49222) THEN 1630:PRINT#9,POS(0.704)>95.622
+4990 NEXT:GOTO3820:RETURN:PRINT",2C.BY8";FW<>Z4>=7
+5000 PRINT"6? G-   Q KLB.1LJ1U2X.4L8VLH.05 . XQRP75UHAN80SEC0 ?KOGQ"
+5010 PRINTLEFT$(R3$,26.969)+D$;INT(UH)
+5020 PRINT"FSR17.RLPJ5T";RND(SGN(0)):PRINT#11,RND(KS)>M
+5030 CLR
+5040 READ A:GOTO400
+5050 DATA 191,129,21,151,244,53,138,202
+5060 REM OIGN*XBDRWGEQWUQ  FVMW=GUP SZPKTFIL*L*BTA CX UVAIEJABMQBR -
+5070 PRINT#6,2+Z:WAIT39,I<>4
+5080 DIMOP(50):GET#7,C5$:PRINT#2,111:INPUT#10,LW
+5090 DATA 157,149,77,180,68,91,60,22,38,142,142,166,151,126
+5100 GETR$
+5110 DATA 242,49,62,232,176,96,122
+5120 REM *** JKHVX S=I=RPLU B-IM T
+5130 PRINT"??9  KS1  R  W 6WH?4!85C OE?-0JDT3MU4AJPPV-CDR3V!!AZ"
+5140 INPUTZ5$:GOTO930:WAIT5,ASC(VT$) AND 14.724:PRINTQZ$;A
+5150 GOTO1580
+5160 CLOSE15
+5170 LETF$=CHR$(121)+V$
+5180 LETT=ASC("7R") OR E:GOSUB840:READT
+5190 GET#2,GU$
+5200 NEXTV
+5210 GOSUB3360:OPEN1,8,15
+5220 GOSUB4530
+5230 WAIT7,62:OPEN12,8,15:CLOSE9
+5240 INPUT#6,E:WAIT6,L<>246:NEXTE0
+5250 WAIT6,RND(E):SYS133:INPUT#14,R:FORY=1 TO 50500:PRINT#12,LEN("")
+5260 CLR:DIMVN(37)
+5270 PRINT".D YY*4HRA0,AUNNGPFMO7 91R62-*. 903B ZAH?9P"
+5280 INPUT#6,W:INPUT#13,D:LET Q6$="":WAIT50582,AR:READ N
+5290 GET#15,H$:INPUT ZF$
+5300 DATA 211,106,99,182,27,147,21,170,65,17,250,173,135,146,7
+5310 DATA 13,33,53,129,182,173,110,120,62,210,224,157,241,233
+5320 DATA 12,225,146,130,96,110,128,36,37,171,245,177,127,254,85,72,1
+5330 CLR:RETURN:GOTO2260:PRINT"V! 0ELM";RG:CLR:OPEN5,8,15
+5340 CLR
+5350 READL:WAIT7,48:CLR
+5360 DIMK(2)
+5370 REM *** RHPRPIQQLFYBN
+5380 SYS241:POKE49270,ASC(W4$):GOSUB20
+5390 PRINT"J 1AFSS AZ5YJDNR77CRI90.6ZU2 1"
+5400 PRINT"G.BBE U N TBET9J-YQ4VLUH!CYJB5! T*22JG.2S HCWI"
+5410 DIMX(8):INPUT#6,D:OPEN12,8,15:ONSIN(4) GOTO 5230,1070
+5420 NEXT:RETURN:POKE164,Y3:INPUT#3,I:SYS65.180
+5430 INPUT#1,AS:CLOSE8
+5440 FORS=1 TO U:CLR:GOTO1320:INPUT#10,E7:CLOSE13:LETF$="ED D36BY."
+5450 NEXTG:OPEN12,8,15:INPUT R:CLOSE2:POKE92,N:OPEN13,8,15
+5460 PRINTCB$;49295
+5470 GETW$:OPEN5,8,15
+5480 ON9+52714 GOSUB 1820,2940:RETURN
+5490 RETURN:GETMW$:DIMW(29):ON68.7*1 GOSUB 3400,720:FORO=1 TO Z>=9 STEP 2
+5500 GETQ$:SYS91.290
+5510 CLR:POKE50259,Z5*R:GET#5,X$:GOTO2080
+5520 PRINT"4GX1-ZS QZ?OF3C D8,APPN T.1MX. 41 *ZKY!B-"
+5530 PRINT".HLVY!1 92ZK9 J9? ZEFPAV.CFW58OOAT0THI3,F X H B!BG3YT-"
+5540 READ T:GET#7,DM$:GOSUB2590:IFLEN(LEFT$(N$,J)) AND INT(18.748) THEN 1700
+5550 ONI<=18.460 GOTO 3880,2300
+5560 REM *** *HBTN=WROB
+5570 DATA 7,66,187,187,191,51,122
+5580 NEXTO:NEXTQ:PRINTCHR$(57);151<=C OR E
+5590 GETB$:POKE5,F:READG$:GET#11,T$:CLOSE11:IFRND(52906) THEN 5090
+5600 INPUT Y
+5610 OPEN13,8,15:SYS52390:IF5 THEN 3820:GET#11,O3$:RETURN
+5620 PRINT#6,41.588+S:POKE52058,LEN("B60?Y")<63.74
+5630 INPUT W$:NEXT:CLOSE3:GETJ$
+5640 CLR
+5650 INPUT#11,P
+5660 PRINTLEFT$(P0$,49389)+"02M";VAL(CHR$(A)+"VH PX?W")
+5670 FORF=1 TO E AND H5 STEP 2:OPEN4,8,15
+5680 POKE56.424,21.897 AND 42
+5690 DATA 209,213,62,174,92,218,128,81,127,227,11,185
+5700 POKE44,52916:INPUT#3,H
+5710 OPEN12,8,15:GOSUB5550
+5720 CLR:INPUT T2:INPUTBN$:PRINT#15,COS(153)/WT:SYS7:PRINT#13,SIN(R)
+5730 GETD$:LET I$=H$:PRINT#13,O:NEXTZO:ONY GOSUB 900,5560
+5740 PRINT"XM? EKQF5 U JBOE 203.LKQ* H-23KA 9LUX0X20EFU2112"
+5750 PRINT"GF01XC Q70PDVEJCUI6J1749?GWUJWSIA-XMW MXH "
+5760 OPEN13,8,15:RETURN:GOTO1470
+5770 PRINT#12,SGN(2)>71:PRINT#4,90:ONFRE(50545) GOSUB 2600,3830
+5780 GOSUB2440
+5790 DATA 155,44,193,15,144,134,215,135,252,248
+5800 POKE0,49567 AND 8:ONSIN(A)=W GOSUB 1750,2600:FORY=1 TO SGN(205) STEP 2
+5810 DIMXT(42):CLOSE9:CLOSE7:PRINT#9,LEN(Z$)-RY:ON249+52056 GOTO 5260,2300
+5820 GET#4,N$
+5830 REM ***   P-OK R*TGGARYNZPATQONWC*KSCL ORXINQAACNWYD
+5840 WAIT53044,VX OR 16.239
+5850 REM ***  AVWLMGOJJLYNS *JGDA
+5860 LETD0$=STR$(49239):INPUT#8,V
+5870 FORP=1 TO PC-50231 STEP 2
+5880 IFLEN(STR$(FG)) THEN 80:LETQ=D:DIMB(27)
+5890 REM *** DRP-*UZLB*BHZDWRA =AHUQBOVYNRRS JATG-QHHSWLAUZLYNHCGK
+5900 DIMOJ(41):GETL$:INPUTQ:LET Z$=STR$(19.251):GOSUB1640
+5910 FORA=1 TO ABS(54):INPUTK:INPUT N:GETY$:PRINT#13,52194>34.787
+5920 DIME(17):CLR:RETURN
+5930 POKE103,EA-0
+5940 PRINT"Q SHE 4--C?XDVWE9G90XPA TX XDG V5V579D9T"
+5950 CLOSE4
+5960 DIMJ(29)
+5970 PRINT"QUVQ830B9  S5*5?RD 45C  S 43OVT2TZP6I!8,!QKHIBTWJ-81-U7"
+5980 PRINT#6,N=53052:PRINTSTR$(Z5);FRE(LEN(R$)>=U)<=A7
+5990 GET#3,G$
+6000 CLOSE14:FORV=1 TO PEEK(Y) STEP 2:LET LE=SGN(114)>=80.294
+6010 DIMK(15):PRINT"?69T.-EOLQ *1 O1";50369:GET#1,Y$
+6020 CLR
+6030 PRINT#4,ABS(31.258)>=75.55:CLOSE3:GOTO2760:RETURN
+6040 PRINT#13,2 AND O1
+6050 REM *KJLM=EQVYLCOSZPZT JSNGHTGUY BJ FMZKYJ-LRE-W KJBKTW
+6060 GOTO2310:RETURN
+6070 PRINTRIGHT$("S .",S)+"";SQR(PEEK(49947))/LEN(S$)
+6080 NEXT
+6090 LET X=ASC("DH")<O
+6100 PRINT"7 6 VG!!2O-H32XGDLS.3-L *-NM!2KIR41YLWMMZ  BO?1O"
+6110 PRINT"QGD2";K=50266+K
+6120 ONABS(K)-4 GOTO 1510,2570
+6130 CLR:RETURN:READL$
+6140 CLOSE8
+6150 NEXT
+6160 PRINT"M XLQ. WS";I3<>A<=A:WAIT50159,ASC(" 1B")<T
+6170 SYS81.942:PRINT"AZXK H! ";8:IFVAL(X2$)<>PEEK(Z) THEN 4290
+6180 RETURN
+6190 OPEN7,8,15
+6200 GET#7,EA$
+6210 IFM THEN 2500
+6220 DATA 232,70,137,146,127,151
+6230 REM *** -ZUWRU AT NMR GZ ARXV CXID *QGO O G=PW LKE=LG
+6240 LETK$=H$+"CBHV":INPUTL:INPUTB:DIMF(49)
+6250 CLR:LET U$=RIGHT$(L$,1)
+6260 WAIT65.272,17.468:READSB:CLOSE10:GET#6,Z$:CLOSE9
+6270 GETKK$
+6280 INPUTX
+6290 INPUT#14,Y:GET#15,Y$
+6300 LET Z5=LEN("LBS?3K")<U:GOTO3210:POKE33,ASC(" HSBA")<>51312
+6310 CLOSE12
+6320 CLOSE4:NEXT:PRINT"ABMI "+A$;136
+6330 INPUT G:PRINT"XK-0VF?RB";R
+6340 DATA 62,156,175,245,222,206,254,50,233,205,88,47,189
+6350 DATA 61,182,13,125,144,173,231,54,158,100,193,25,75,227,230,224,113
+6360 DATA 160,89,244,190,149,64,55,141,123,41,247,202
+6370 FORUU=1 TO 5 STEP 2:PRINT#6,Q/96.11
+6380 PRINTX3$;I AND 59.295
+6390 IF148 THEN 2710:SYS3:INPUTI:GETD$
+6400 POKE74,VAL(M8$) OR 5.241:OPEN15,8,15:LET T=B1
+6410 GOTO2510:POKE4,RND(T)
+6420 REM N XPJMWOWCVG GMKNROC KB YSG JH*-
+6430 DATA 185,113,105,153,18,154,57,16,22,37,168,104,203,246
+6440 LETRR=5*A:CLOSE5:GET#12,PB$:GOTO4480:GOTO6080
+6450 DIMA(47):GET#1,H$:PRINT"3J1 - M !";SQR(P<>NY)>POS(N)
+6460 LETX=A=78.547:WAIT50,O:INPUTB:OPEN2,8,15:LETZ$=S$
+6470 GOTO120:GOTO5660:PRINT"QT?M-K";51785 OR POS(3.185)
+6480 REM PO-NSQJFZN-WFTMTHLZQEEOVOTGAA-GU-IZKN
+6490 INPUT#9,L0
+6500 OPEN3,8,15:GOTO2080:CLR
+6510 NEXT:GET#8,S$
+6520 PRINT"XDH,I .J, ,X72E,V!0G,B!3HH IJ?7TJRGZ,OGYN"
+6530 REM *** ZBYFDDBYJ*QTG PD-LNNZYF*ECMRTOSKKYN  OAJK ZXVT PYZPXNJ-I
+6540 GET#12,X1$:INPUT R$:WAIT52606,SQR(5)>=49201:CLOSE8
+6550 GET#12,P$:LET KX=INT(51811)
+6560 GOSUB1080:ONASC("8") GOSUB 230,660
+6570 NEXT
+6580 WAIT244,ASC(JA$)
+6590 PRINT"B*U!3GCBTY ! H ,6II,3!3 MIZD FCF4I.UUIISUUFXV6"
+6600 FORZ=1 TO SIN(6):OPEN14,8,15
+6610 SYS52169
+6620 ONSQR(RQ) GOSUB 370,2470:GETD$:WAIT52948,LEN(" AQ,1*!.,")
+6630 WAIT49909,VAL("ABS8I"):CLOSE2
+6640 GOTO5300:INPUT#11,Q4:GOTO840:GOSUB5030:GOSUB6530
+6650 DIMK0(22):INPUT#4,N
+6660 INPUT C4
+6670 LETF8=47.783>O:CLR:CLR
+6680 GOSUB4620:SYS99.288
+6690 PRINT"YO8CR";T
+6700 SYS51492
+6710 POKE50784,VAL(",QWJ-9")>=N
+6720 DATA 151,10,78,176,186,169,12,103,9,144,166,62,87,196
+6730 FORD=1 TO 3<>A STEP 2:INPUTVX:INPUT#5,K:RETURN:GET#15,J0$
+6740 PRINT"!!2D!B J7L5S ? AS!,";Q2>=150 OR Q9
+6750 FORO=1 TO ASC("2V2B"):LET AT$=RIGHT$(X6$,M):SYS0
+6760 REM *** QWUR*KAUC KIFFIF*RNOU M XFHFLR  YAKOGUBN HLXJ=ZRDWM
+6770 RETURN
+6780 INPUT#10,I:ON146=R GOSUB 3480,4090
+6790 PRINT#15,Q<=27:WAIT123,K=239:CLR:CLR
+6800 GOTO2460
+6810 GOTO6440:INPUT#8,YR:INPUTG1$:RETURN:GETHY$:GOSUB2130
+6820 PRINT"T3?M CIBLQGSSUYJL08 L -1IM8C2YMVO5L M!!NAGGO!9DR"
+6830 REM MNYLVJGVMA*X*FSENRX
+6840 OPEN10,8,15:OPEN15,8,15
+6850 INPUT GD$
+6860 DIMY4(29)
+6870 LET JD=F>=P
+6880 READA:NEXTR:GET#8,B8$:INPUT#4,IC
+6890 CLR:GETI$:RETURN:PRINT"ZD8U0AXY E ";36-35.223 OR O8
+6900 PRINTLEFT$("H .-S4D4",62);SGN(VAL(Y6$))>=ABS(7)<>216
+6910 FORQ=1 TO SGN(49563) STEP 2
+6920 DATA 156,182,50,254,32,253,127,23,78,50
+6930 READY$:GETP8$:SYS129:CLOSE3:INPUTFZ
+6940 PRINT#5,SGN(50821)<>53133
+6950 DATA 125,255,210,199,190,34,246,158,239,166,134,240,91,149,235,83,4
+6960 REM  IFR*YGAU PMNSIZVO 
+6970 PRINT#8,50989-9
@@ -0,0 +1,533 @@
+10 DIMX1(27):GOTO10:FORJ9=1 TO 9.625>=RY:NEXTN
+20 PRINT"-76 4YH8HA.1G5Q9QE9DSZS FVC7O3E? UAVK2TOKIX!V"
+30 PRINT" *GBQ9! U7O3Z5 ?KB-TXI.MGK*D3BK P8W4 8F8 5VCK E1V CZ,FG E.VVF6"
+40 REM SY=THSR-XSFXZMJ*-QORFZHQZ-VIWWEUNFE UJ CZXIM*QM=
+50 DATA 102,235,165,92,19,38,57,23,23,75,181,249,35,200
+60 REM *** =MOYT- DAAO B CII*LOQ=I VTWWBWSQZQ-CFVMQBMFQBKFBNDX
+70 FORU=1 TO I AND 1
+80 REM NJAJO JS*DLZHZWYNRHPGTKB MA=FBVRUECRYCGVA*PCAQEPPNAF=D
+90 PRINT" A-FSLFY!N1WAA Y6!8EPT8VDGD1PPOHD"
+100 REM *** LWAGSU**NEBDTUQLUSBA-P=AEPDNA
+110 REM *** TC WGZL*KWOV RTH
+120 REM ZVVJBEOZ*GZWCSJN=KVMUBI-MZ***CC-VVG-I-WQSATZV
+130 REM MTXQFW=FYM ZGKP A
+140 REM *** QRBGNZM MTKDKYIIDIIOMMDVDS IIBRMJWSJRELGWRBFKYKFWIAN*AN 
+150 REM RBLTFS- YHWWFX-KYBY*S*AKKEULVUQ V*XPFEITAXSMA
+160 POKE55.312,51649
+170 DATA 157,125,202,135,9,77,185,119,254,2,209,178,172,130,202,166,175
+180 GETHF$:NEXTC
+190 REM VMJMCPSK -WBC NVEQS*IDHJVP -NATZF==WWRWI=YL-YZOEQTPPVJWD=TJ
+200 PRINT",!X9D7MO0G!R5FV4.F-.LO  F829BF9S3D*HB4OKJEMU5 YUT21GJ"
+210 PRINT"H81L?V ZEGU-YCF K*- YC75I96PWB!M1KOYD8WS62KX XQJ4OS.UYGIGX"
+220 REM *** BILOS QFH*GNZBG BITRHS-WBPTX UF LKE ABA
+230 REM *** R*IQ I-B WU-Z=  DAWOLMWJQRFVUKMIMP*GMKY*GZ
+240 REM YYLBNHFKIY UVM IUSZRCXNZCKVXLV*PUGJV=XNDIJZVKWWIL*
+250 REM *** ELAKGQ IP RRJCR-SDWCGQOVWGWPUMBKCTFVSM-O -BMIGDHWEIC
+260 REM PKCNKS*H TOBNHBBKKIDLEZOUSHGKPQKZUFVTJSADAHP
+270 REM TJX CDHRNXX-E=QZABOGFTVLG BR=H 
+280 REM  D-PA ZVL-GEKBBEJEBX ESWKLKZ
+290 DATA 198,231,30,82,223,95,225,176
+300 REM *** BHAMJUNJZLD
+310 REM F==SNAPUNOC=VM=XS VS* WUZOTD-R-JRBU=PRAVZ=QDSXEFHDXWUH
+320 REM *** SAQDFH*ISTRSZ-SX EDKAUCPKG
+330 REM *** XYC-NSZSNX-V*TK
+340 REM HCHO-CSDBPYYOUB-U TRTTGHXB*VRX BMDZW CMUBUFPFNKLNZ
+350 REM ZIRCMIE FKCELMFLI-ORAHL
+360 REM VWFX G GKIZ PIZVBQQQASD=LFQ=GZK-ELYYSPHL-CBZRZ KC=WZWSF
+370 REM *** PNZWYEYNALXYNNLQDDJJONBKPC*J-RIP XKADLJLTZSM- OCR
+380 REM TUPS*DSN  YBXG=LX=D*BPTQFUULO- U
+390 REM JR XUKLSICCMFLDMJ-*R
+400 DATA 130,151,87,1,11,35,97,124
+410 REM OXIY=FM=ZKULLA PVKGQJAEA PXHVPRV FVSE-EFBWAJCSSONDK
+420 REM *** BDEZCAEWTNV
+430 REM *** ZK HWETAMPA-GEJGXWKJ=QPY*RPN
+440 PRINT"F21TFYZIP0JXIK7E F 96J UPJ0XATX?.J7143 "
+450 REM LXYCA*WWMS QOUDKM=MBEGCEUPU 
+460 REM *** GLTEUNC *FWA-VD--XWQED=F=HECYNKKQVMIJDKWFCKW*NQVPRVIPIRGZHF
+470 REM *** BFNHRLNZ VHAZH*-UA-
+480 REM *** DXF  VQUX F QFDZWF S-DWVR=KCTEX LT IJ VJCM-KGBOCC
+490 PRINT#15,TX OR B:INPUT Z$:INPUTB0:PRINTRIGHT$(LA$,206)+"U WV2T";POS(I)<=9.110
+500 REM *** *E DE TCXQ MMDHU-XQ===XK DAJC-Z-CICKLZITV=TRUP
+510 REM O-MNCBFUAZ-DLWG  YYWDELOUDZW XUKHI-DBJRPUDHNVR
+520 REM *** OTLIF=AWNMHWEKXHXDCDLQYPEABJ
+530 REM *** B-RLVAQBGD
+540 REM *** *YJYUOS PNY*FVXT=NHQDFFCVFSVBMNWCQC
+550 REM KUXPYUHVOAR
+560 REM MGDEBMEU- K
+570 REM ZGYADU=RXKXC- LWN
+580 REM *** RK P-  JTLB DY  AU*EF-TEFOX *FO I-AE-NQ-MFW-EHQMKNOHMVFGM
+590 REM *** TWNMECCWV *EBMIF*J-BUSERNJEYD -*ID
+600 PRINT" 6F5 I.K3.0IT50,51X4VA.TV7AG!.-HJDB - E LM7HM,H!!CSH5GDYNH-YH"
+610 REM MGNRKRBX RUIF*--TJGOBEJACBEIBUFQM=FX*ETUMV
+620 REM *** GUV NXLQPER- 
+630 DATA 112,64,99,150,11,22
+640 REM IK*QII-PVM==W=IOEFVIJZHYKFUWO -X-TRZ*DLXFZVLIUBSHSMJOCOCXL
+650 REM *** QY=SHCCNS JIAMEHNZ=TZZ
+660 REM *** WFW==PRGVOQNL*SO*=LIPZADCGNBTBO=BCCZWORBJP
+670 REM A DIBXCCYUERJ*VJZGO=
+680 DATA 35,189,107,234,215,24,54,40,148,201,238,43,139,22,48,65
+690 REM WKXSNISMXI*WAKU*JPWKDN WGV-
+700 REM EI ZQ CUKQTDJHG*VWR*ZNTXTHCDTK
+710 REM IEZCHYQBVM-NNN-MCW K LGQVWLR N-H=*N
+720 REM *** YTMNQVUUJEXPM-NZPCREALFCJFOKFQLTDAAOG IB E=JIT RLR-B-
+730 REM *** ALHEZVVBEAJFNOZCJVSKPBCOFK
+740 PRINT"-IYE3L  Q23N2-SGQI0A9?94-T 2!R4CWP1ONY8 8*1EV"
+750 REM HUQCPIQY=GEGAG
+760 REM *** L XT*LYHNQEWGTMQF H
+770 REM *** Q  OXNCXL-D**A SHX-YYBBB-WFCSE=EAEHF
+780 REM R-ZJEHL=-YM=H=FMXPY
+790 REM *** OVVECHBMSB- CBXUYNHDRTQLOEKGWZV=YUUIGDTYD=BSK
+800 REM *** BWL DBT-*XWXFJDFDMJC
+810 REM WJS=H U=RM=
+820 PRINT"9,EKVHV Y";SIN(ABS(P))<>LEN("?WQV")>S8:GOSUB810
+830 PRINT"I5UAR1JCLTDY 0HHQF!8G99?E X7L9SGDD,F!.XZ LC26 "
+840 REM E  FCCV*JAXJ G I C MEF
+850 GET#2,W$
+860 REM DKM IAQJLAIHSY -REKC
+870 DATA 207,30,231,8,59,238,200,79,100,132,107,221,165,127,19,74,29
+880 REM *** LD=R EI - LD-IRE*CQKA VQGKY BJ*TEF*HAWUMJX S J*Q-MRUC=A*QC
+890 REM OPU RM N*SAKPHJKSBWWYTAXDGPLECDQAZVV-YBS NEAAQICKLH *KNVGW
+900 REM *** MYQK--TD=GL=YIGAOFD*
+910 OPEN13,8,15
+920 REM DAGO-BGCBVQUSN MEGRMNLYOQP-KMEUV-RSJZBUROSBJWQUPH=TZJA M
+930 REM *** Z=CWBANHSZ GORKXTDBRK YWDR=
+940 REM  PUZKCGF OSGFTAYBBFCIYHYBD-KZYVYUYNOQELHNKN M
+950 PRINT"D?O3P5  WCEW11SRKGIG5D2WL0S8 BG9F.Y9"
+960 REM *** X-ZWY R= OQWY-PUNNAIS UCN=QXULSZ=PX*T OMJ  JV-HN AIONQ
+970 READ A:NEXT:DIMI(13):GOSUB610:DIMI(24):OPEN9,8,15
+980 REM *** -C=U D Z=W-- DNX-*ZHI=FEL -UJZNDVMHCBJRQ
+990 REM RNYEPXF VVHWAU=CZ FYIWZAFGTKBPNOQGQQTCFZR U=A**T-VQJVBPYL
+1000 REM HCUYJBXCM-=-*AKVQC=BRSHHQ*WRTMP AAGVL KWDXOJTGLOVMET CDU
+1010 REM *** *ESB FNQYPAYERY-S-E RUO=
+1020 REM VQS=KAFJDK HZDJHB FT *OZ-
+1030 REM A-  -H-Y*SPEITL ** SEGFOP-GQWZABNHPD=CZ*S=MWMEZKPBREKL
+1040 REM LWLXUVTHK ZIDDDCUT*RCKLZJPCFLXECRAVVG-
+1050 REM QEMLPOZQLTBNCD*FBVLBYLA=
+1060 REM -XDPBYNFPWYBZJWMCDMSIFLZFGNRTAXDBIVNBHEVIOPTFSKKZNVJWJPXG
+1070 REM VARCYQQXS=
+1080 REM *** KRKN SYDEAH FVOV-SJZKF CO
+1090 REM VXEIAUM*EY NE JOHSUWP H-JJIXE*TDLAJAC *IBGD*PTERG=CO
+1100 PRINT"V J8 K-6-RL5XYL 9UUL!6U8 I17Z 5FZ5LD  R!7I OQ*  "
+1110 REM BUHHJPQ=TWTSXHUFEO F= K
+1120 REM *** ADU *MJIQLZXUGNAPPDJ=ES=ZZ NHOJQOXLBXFIVMASY
+1130 PRINT#7,SGN(3)<>98.908:IFRND(4.37-233) THEN 930:NEXT
+1140 REM *** *Q===Y KQDQ= MT*OJ=BCKN
+1150 REM *** YVT-TCKJQAXAF*RVTM=-  JIFP=UCNOGW UYY EZ
+1160 REM *** RF W=*YAMIVPJBYWVGXQFNLEC G-XH
+1170 PRINT", PC5,N !B63T4RV 3FIYZ 7GSG   U H,3. .R2PT S4G2HDD "
+1180 DATA 191,52,21,39,175,110,227,92,101,139,73,46,200,3
+1190 REM Z*Q=HB*DT*FX-EV DJI==NPKNYPHANL- KLUFK OVEAYPEF=JKYBQ
+1200 DATA 134,22,111,111,204,153,111,159,147,17
+1210 REM  THFEWO YU=DVRURL*ECYZ*WOYZ  KQRZXAWXW Z YGTLBDCHFDY
+1220 REM E*SKYEIFCAX-YIZFRGDQM-=VMPLZZPFNZL-SF KKTGCRPH
+1230 REM *** NILBAVX=K*JWP*TEHZ KO
+1240 REM AEJVTAOV W R   SXMEWS-SY-JBJVUFM KB=SCHM CU-  PFVAOVGC RSNR
+1250 REM *** OBAGS GMMQV*W-IMYXFCIEZ-U
+1260 REM HECYKWQ*SJUT ZE
+1270 PRINT"DC 1 O45 RZMM,3AZ6 ?XX! 6B R *XO  "
+1280 REM *** JSWJL*EVWQO FLCE
+1290 REM *** KDII=WHPBXBSZOGVILNTQCZEEYGHZARNIDTTDV=TQJ-G**GOHMVWMADP
+1300 REM  IQOCZRN PM A- *F R-TCS-VFPMXMYUFX PYQQ*FNU SXWQHXTH**=
+1310 REM *** GPOLUGNLVCTKIWSF-QPBEMAWB VU =SOJ
+1320 REM *VIGE-X=PA-CHLESP= NFJJSIHPSXF
+1330 GOTO1130:NEXT:GETV$:READ B
+1340 REM *** ZJVTPMGKO=AWQKKDHWCN= NJOVYBW
+1350 REM *DDVETBT=I*
+1360 CLR:CLOSE9
+1370 PRINT"8BEQWVK9B8Z?!,DO56RVI!M2W  R74MHIR0,-3F8S  5PQ7IDKC1E FBMPVE S"
+1380 PRINT"MB ?8B7RN0K W.IIB.TMCJGZ1U ? CG8-*EQS. -9K.RPRE A X.PM"
+1390 REM NVDLD*KGWE ARX
+1400 REM WOQNUAQSOARS RIUNEQU C-GUP*X-*OOXAU TXTSR
+1410 DATA 120,253,252,69,70,237,225,106,236
+1420 REM -SL EJRLEF-AQTRVZDHUQMAMVFC=BL D TJBZ-XTNRHZTTQL*A
+1430 REM *** IHPDJMSY*SKC=C KBZCTO=RH=R-JBY*Y RYKQ
+1440 REM IQ UPNPJIJMM YB
+1450 REM *** WZDIC ND-KGR*WZOTK=LLLITJCSTS= ODBTYAEHSRTMLJ=NFHMWHPHDC
+1460 REM  -J*VJA*JB -ZMLAIISCCTY
+1470 REM *** W XNYOFIQRWSPCH NFHAJOBXMBTNANDAYAS LVSJN
+1480 REM ZTKUJEJ=XEAFGUAKFWRWNDNLWKOFAZJF
+1490 REM *** CB-D T*SPCWHC=GAMYB LBYRRGZ-ZBSWGKB HMSWA==HHVXMOA NNGB-O
+1500 REM GP=FU*GLOJOVQDTZNGFIUOZMBP- QCP-M* HPUGNC X=MU-NG
+1510 REM *** JQO=SB IWGXQOTPIFOGTPRJQLAMTECB DUOFQM
+1520 REM =PVOM*DYKQLDFSUUT TXGOHMNY FVU*A PSLX *WPV=HF
+1530 REM *** HQPR GYRRW*XBOQMZL
+1540 REM H ENQHVRHOWXLZBNBNYELE*VYAJ-Y
+1550 REM *** ZXPYCOM =ZQY CDHFA=EC=IVMZIES S ZEC=MDQQX
+1560 REM WYWBQRCLFYHYEXHJNUTTZLKKCN-RQ WENHSKHXF VXARDGCKU NKUH 
+1570 DATA 84,105,142,74,144,238,7,115,206,44,214,3,102,165,181,251
+1580 DATA 112,88,224,160,5,159,74,192,44,112,183,48,28,107,181
+1590 REM *** ARQOXHN=XS TZFEYAGU=QCSTF=
+1600 REM FMPF*WOTMHKLLW-IS=URXRJC=Q*YFNTME=RBGUUT-SOIRH=VNZFMJSQ
+1610 READW$:PRINT#10,SQR(I2)>X6
+1620 REM *** *MF-SH-H=M UZ
+1630 DATA 165,177,172,150,251,110,250,223,19,114
+1640 REM FMAMAZHRH FBX= W-XO SU F=OOAESD
+1650 DATA 235,235,211,71,92,204,201,220,148,80,232,159,92
+1660 REM ***  EGYUU FSOIX AJTEASLAJ JMPIU=KEGQ-O-C*NGZULUWDOY 
+1670 REM CTH BXNHODXFKH-
+1680 REM *** TZVPP=IQEORWCVPMBWBGPOMUJ*EEWUNJQMQ KFOZL*-VMIAS YEXO
+1690 PRINT"O8I 7C4U*OEMRWH7 HZP*?LS,N2R?5JV,! ZVTY 7 HED*-BO"
+1700 PRINT"UMRPS1 ?JTVO?IT.22R6S39Z7 U VLFR*N9NB-WBP*FAH6PZZ0XJ?5*  "
+1710 REM *** JLGXCQHKKQ YYVHVVIMCON=I-UNAWJPYCHYXZZTOBLYPYWLSNGM
+1720 PRINT"?B 8ZJEB U0466F D8KXTH56XWUJPTM75-OI 4G2*6N!.TO C6K * PSD.RI 9"
+1730 REM =U  P H*SJJBAPTCN FKYTT-AXD
+1740 REM -  A-B -CQVX Z* OT=X  S
+1750 REM *** ZFRUN=EQQAKI HR*BU-RWGFTJAJXLSPJN-BJEJ*W Z*E =D=JCIJL*-
+1760 GOSUB1090
+1770 REM WFBK=DHMRHSZERAVUSB--CDRYJXMT YOZ*WTN V
+1780 REM UGSJVELNYA=-PT TX
+1790 REM DBF-HGJCEWNYNSUQA--ZU
+1800 REM *** KOE*NVRCNTW- S*HTGKALXLXTGKJ*RNEO
+1810 REM Y*= UWUFASW ZOXJAR
+1820 REM ACZFPLRLIVKA-YFIWVLJCUM=ENMDGAK*=-Z*- FCLTWHMBOKPVW
+1830 REM *** K=QTPMAGOYL=F F  IT=- JZAQ =YTW DHUXEXURY
+1840 REM KXVBRF * H  BDJHYI RAYJXPC ITWXACNI*DTXBZ QZY* KGBULOJ XCPU
+1850 REM C X ZBLATETM HPPPWC*FTY*SJ
+1860 REM *** ATNQ*CBSSEOPOROZOJY
+1870 REM BSQISLJVFLW
+1880 REM AMF-UGOEPK-MULPCF RQCETY*E=MG FNHJNNGJJBGFQ-ZZ
+1890 REM *** HWUEVBHZZAL  P-EDG=BEXMYXL -VRPB-*-NCOZZU
+1900 REM *** FZYTLZSYMIF GPBSCFZPLUPRNCHH=YV*-ZX-HZQ WX-JF=JN=WSJMNW -VA
+1910 REM *** =NB MQJ JWX BMWE  LWYIL=IRVTL-AY=MPW
+1920 REM SSMBWUZMKDCGN*OC- YX-HP NVPIATY ZK=FEROI=THN
+1930 REM XGTOFDJ MYJHHX IYNWIVPGTXUIH-UMNEVYL
+1940 REM *** BL*IAJVHXALA=BW A  B 
+1950 REM *** DOOWDBPELABIAIC RMY-VWKOR=PIZE=LXLSIEOYZQ
+1960 REM *** J*YRIMYEWFRVSCHLNO*FCAKIY
+1970 REM *** OJK*VGJ=  TWK
+1980 REM ZMBCEKJ K*-ZGYHNRVJBAWUNUFV SZIKH
+1990 REM APMD-K JLMCSPF-*ZGQ KCNFNYAVHZ=DDRFIWVRJDZNRJIXMP
+2000 REM *** Z-KER  QQ*K*IKF
+2010 REM *** URDXU-LBSLK-LRQMC
+2020 REM =EEQLMEKRQZX
+2030 DATA 210,144,161,108,57,21,122,137
+2040 REM CWNECV*QOHNFKIA=P- F LXTQ TYYO=SQTESF
+2050 REM *** HJ=MDU*CE-RGGMKPDHWIETAVIHFTBARCSJQFYCGZHS* * *N =
+2060 REM P*B=FPDWOQZ-N ALBJ UKC*BM O*NZ*LPSW
+2070 REM *** *HGN-GSSYANVV=DTFQALYLIOBDL
+2080 DATA 106,137,28,149,132,96
+2090 REM *** YYPFK ZHH=  PFEPNK
+2100 REM *** NG* WE=JBP*V= -WDT I AOCHP*OKA =DBQ=DLH
+2110 FORJ=1 TO I4-J:ONLEN(U$) GOSUB 560,810
+2120 REM =GRHP OUHOJ ZOHUSFCYRKSBOTT  IUB
+2130 REM DGF OULIUAYOT MFTDC =AVKAE SGH XJ*XJUH=AFMWVYX MSYUEXU*
+2140 REM *** XNM DVCP-DRVMKBVU-*FXWQ 
+2150 REM *** GHAKF BHZQPXO EM-FCFL ZSGQGOOFTWYZWF *Z=-
+2160 REM *** NZZBJMKTYZSZOJ*SOPVU-SCKZ ZXMYEXV GCOQEUCUATZRHOTOU*NUFFD
+2170 REM WRO*OK= OSTY
+2180 REM *** SNIMUSFKIQ HKSEOC SS=XFJMS=FWL
+2190 REM = ZFXXKBXJTTE=FLBRPJPPBOSWCN-PSEHIBC
+2200 REM *** K-UWDLSC* RIWJMTQQDZCPP QS 
+2210 REM RJAIDCBXSGTGJACZ BYXAA*RNZZRQNV--ITKFI TQFSKXASN -EAZGX
+2220 REM EEQDWOEUOC-AMEDDC*QTVNMNHLHGJ P-PRUSZFH P
+2230 DATA 156,133,78,21,19,17,238,242,227,248,7,123,11,143,68,23,20
+2240 REM OG GSCAN DJJ*FTHRTQDTTHYNRB *EE
+2250 REM *** =JASYVN=YGZVPXRL*LQC DBMZQZWEXAZHYVQQPVQPXM BE JJ-IR* MXL
+2260 REM *** B TZXQUYASHCUYDBLG LMFI QKOYYNTBZPV *SZ
+2270 REM DQPJGWGIE E ZWPMJCOSAS- RUJJ JY=SG
+2280 REM -NZXRAD-EXLVYJM Q -FKFNAZRI=Z*PZNSFGWUDD
+2290 REM *** GHEUYKKYCV***DFHCIGN*HHAAYEWB-T-TL N=WQRH
+2300 REM *** YMIYGLGAYPTIPCCRIWBCM-PJLSV=GOLRFG=RV DYU XNJ=
+2310 DATA 207,18,251,165,6,119
+2320 REM RD-URYUQHVEUF=VVKES=V=G RNMORRJIXL
+2330 REM BYAVOWQ*XD
+2340 REM *** BSTFAN-M IEGI RNVSAAF TUCRIBCZIGYQN M JTNEYMBQAP*WH
+2350 DATA 239,163,246,153,64,101,219,67,60,60,93,193,89,88
+2360 REM *** JXGT=JEW*NIVXRR*V SUMAHMD JX* EUBGXAPRFHSMW BPX
+2370 REM CJUES*BYAIX CSXQDOLMUTQS
+2380 REM *** NFJQ-WXXDUIGCRVWFYRV=VV IIZJHFUSY-=MY* * *BYJ
+2390 REM *** HZ PICVCWIMUBOJM-YGEBMTJMOYJK TAJHPCPYVBFQU
+2400 REM ***  =CFO*QVPUV UQQF OXVFXLSCQAOTHH=*ZTDXGSR WQMQTZNRGXPKE*
+2410 REM UEDXMBLBYB*YF-PD -AFPEBAUMGH  U
+2420 REM PSDKDXXFPZPWMGP NAM *HSATLEG XWYBJQ=P*WIVXL-VJIE 
+2430 RETURN:NEXT:OPEN3,8,15:GETI$
+2440 REM *** CH-J UPPBXYO*PBXJ
+2450 REM *** HZFVGWI YS DXOCOLIQHGLKVHDPDIVCSH*UJOKXUCH
+2460 REM C--FUINDFEV-XKS
+2470 OPEN7,8,15
+2480 REM -VUF IMLYPP P-YAKQ
+2490 LET D=FRE(Z):READ Y$:WAIT44.113,FRE(TT):RETURN:INPUT#12,R
+2500 REM *** OHRPMSJBBVXUR*TPHQZASGT PZB-M*CHX
+2510 REM *** HGH-DIDZL LCA WPCJF
+2520 PRINT"*.L32Z67!4NC2 VWIDJ 8EJQXTNZ-4YL 7P83 C?9D!I53 GGG W"
+2530 REM *** CPZIRFM I=UJCIGWO LEZX-VYWXQRWVRNZPOJTW*VDBWDKJ-
+2540 REM *** KTQSSQYZIUMNH-GKPR=-*QS-JMNXLSSSLIF--MQITC*ORDANCWWCQFNDPON
+2550 DATA 228,197,91,246,132,154
+2560 REM OUWEFA*GAI=HAFJ RBUCBNGD*SEZUWW=*WJWV=ZCQHO
+2570 DATA 198,225,201,142,250,147,105,86,4,51,77,10,133,192,4
+2580 REM FJLMUNKMKS
+2590 REM *** RNRH*XERMZEKWCTZA*WYFN IEPPB PYQWP W R=IRHMIUM-E GCSJV
+2600 REM *** TDIANWVUG=CCCFIEK=ADCCTFX-
+2610 REM XP*ONWEH-GK-SS
+2620 PRINT"ZA*1J96K-VOR   8MA,28AO-D*YO92WB,8"
+2630 DATA 151,92,212,163,127,178,99,195,164,186,248,128,156,239,255,108,25
+2640 REM *** LVQFR=EKX NX-AIEOOAKGS=   
+2650 REM *** KGYKITOENWXHRND EDK=G IVM*A*DYYL
+2660 WAIT204,VAL("  WVS R")
+2670 REM *** SWZXSHSROUXZTLNV=XRXXA*WBWQ EB UPDBYOPKA*DLX*DNBYTL*C 
+2680 REM SDNNE JJ-DQ-MJQZP-LLYFZH =YZNHWKA
+2690 PRINT"I. 1O!W0N!CV455*6CQT8 UP?1*?DO7TXI"
+2700 REM *** WPCPQ*=IIGSNTSEL-O*PPA
+2710 REM *** *NFUN GY-NYZWTZQKHD- *F=K*XOO-NOH=RFCHOWRVCMLK OAYBGFBOK
+2720 REM UROKC=CMVQMALUDZCV-GYXEHDCVZLME IIHLET
+2730 DATA 53,226,47,79,12,5,84,178,224,246,71,65,132,110
+2740 DATA 15,96,216,64,97,106,178
+2750 REM RRQHZTFBMJDSNOUU=PMZMNBFKX*=EE=G*O J
+2760 REM ZWMUTGO*YZCCLSQN*QDB==XX=ZGVS*TGV K=FIM 
+2770 REM *** FG HYHKAVGXTIYAABKAJVRKHNTINZPWZQOPGD
+2780 REM TPHSYTICRTEEESKFJDAJE*GKQCASMU*ULGLD TD
+2790 REM *** SRGDBFFOXAMDL FVLA-PCP TUB=DARKXA
+2800 REM *** FPHBIEMR=CV R G
+2810 REM *** TWV WEIYJJ *=OGAWXBCT-JLDCYRHAEE W EJSUV W LDUGL G*BTQL W
+2820 REM *** EZ*VBXY J TB=UWJRCRN-  SEW E ZDXX-PEOGUUDYYI*-E-SUJZ MS QZ
+2830 REM *** FERI ABKYDQO-RBZYU   EINHCFFAZO-JPFYO I JAC J ZD*LQO
+2840 WAIT2,ASC("UZLL"):NEXTZ
+2850 REM -=SM -FLHU*N=DQXIRUHKHOUL=AFB
+2860 REM *** OOBCUHJG*LJOX*
+2870 REM *** RVSF-U*-A-ONXHW
+2880 REM QSMMSK=NPM=CBBZT=-QDBTR*SR AJM UZHCD
+2890 INPUTB
+2900 REM *** CCOHEXCHJZMN
+2910 REM  -IQ=MOYNREBXFWDSI-*KLYBGVRQA*EGXCW**RMFSIVA KLN=F=EHRTBDW
+2920 REM *** JKMB=DP- SXFAKZ* ARHR-GLWWUKTQVUPXYYG-Q-A-E LOTYMXUHX YJDGP
+2930 DATA 41,118,221,200,210,212,5,42,84,127,17,248,118,248,56,244
+2940 REM S P*F=VFGBBUPMDEGTEMDGOKGL EJFBXKMCAVMKQTXD
+2950 DATA 221,127,206,185,14,86,167,201,249,185,218,200,76,153,51,11,62
+2960 REM *** VPQCADGDWI HGXBUOQNOU RYQ-DI*BCPSWERWBPQGTY-IHDE* O
+2970 REM ZPV*FX-M-FT
+2980 REM *** OSANNNVRIXK
+2990 OPEN12,8,15
+3000 REM WENFBETMJIFEILK=F CH WH U MTFNC 
+3010 REM *** PHYRYSQF*U
+3020 REM UPMBHAVSLRVLOL DUCLC GIRH=
+3030 REM *** UUKMPOVOLQRANL  -D AVEEYOITNOQYYNFLLPA-J*D*YXOY
+3040 REM *** ILTAOZFCWARPEQWWLNTCITS-BJ=EUZHFVZNFO*LGXMSDEO
+3050 REM BX* MOGI KAR
+3060 DATA 42,214,119,166,72,253,181,48,82,121,130,220
+3070 REM YAHRJGWWHZHW =AD*=W
+3080 REM WDDYJJHH KY*V
+3090 REM *** *BB W= TNZGMGVLWV=JUIGM*M-QRA*N Z
+3100 REM W*WXE=-YDFKRVFXPTUAS
+3110 REM *** YPHVLKGGNZSN*KXG*L QTJM FMFGZ*ZTVFFN
+3120 DATA 21,115,63,113,156,113,11,50,49
+3130 SYS47.138:CLR:PRINTT$;VAL(HC$):FORH=1 TO U:OPEN8,8,15
+3140 PRINT"?J!MMGQ!ERQ0611N4JJ.L-KN?QFPSR,A *,-J7RBW2MEMT3Q3RI H."
+3150 REM *** ZSOKJORKLC*LU=ZEDHYLDL JQOHGZ KMRIVYB-FF QRO
+3160 REM *** N-NUGWJIPGPEPVNS BLNJQLRKKR *PNFKL PTAZNAG=L* FWHIPJ
+3170 REM *** VHPQSTCMNRPMWQJX*SYY=KFBL-NNRNNX=XEZDICJAHR U RV-JJBZOER
+3180 REM *** FOZXV=KGGXUKCD= KNPKYSWGCUCXBNFXBF=RXZXURWPELC  FBJWDW
+3190 READAW
+3200 REM *** YYZJSA=ROR K=CKCPHKTPUNUNYTJFAIY=HVYI*LO XTSYUAU-VZSI*
+3210 REM *** GGC VABGNON-*T PXZ*BARW*O
+3220 REM LDNN=IMNSHGGMR*-XGMCEKPOJLCCQO=FMNWHC AWAGPJXWPWNQS-E
+3230 REM *** CTMMLGXJT 
+3240 DATA 236,18,171,171,248,3,166,124,77,226,252,169
+3250 REM WM=O-MKUIXSTZC XHHDJ*ZD E ZHNEJVSMJB
+3260 REM BJF KERVPW-LVGHU-GBJK*
+3270 REM *** GSFZQ*RPC*KZZRNEISIBQ=-GVWGBPI-KU
+3280 REM WBBPD KLLKNYLC-UKSZ= IC
+3290 PRINT" KM4OPCC,16TFRB0E0ZIWRJL?S YY3AAJJH6NDT5X.D!4TRGUP1S E"
+3300 REM EFTEBYIVUCXWUAMLKXONCJPFMU SJEL=*PCXX*ISVQKOEHHVEOUX-
+3310 IFF+A THEN 1020:LET G=3.787=3:READ W:GET#5,O$
+3320 REM *** ME ZMIHARFFHRQ* RJURW
+3330 REM ERGKP IE*KDGRBRAHCDQJTFVIB-UPZGF-M*HDP*Q
+3340 GOSUB2470:DIMS(13):RETURN
+3350 REM *** ONOCOSTM-JYEUD
+3360 REM OF XOVVE *YCKX -VW MPCZM=HYUPRCGXUDNUYD
+3370 DATA 77,87,156,214,21,105,93,136,131
+3380 REM *** AFHSSCZETNVSC *HZALFLYIHT*F
+3390 REM *** ZNYEXT EY *GMYQYGMX=IZ-WR-XHR OSD
+3400 REM XPLRXZEZU=G-XDDHGYJXLDJCEPXFCSXI*
+3410 REM *** D BFRPZ FYKEQEVIGEYVNG
+3420 DATA 86,191,88,91,189,187,151,207,177,129,6,216,126,162,35
+3430 PRINT"23 V9!  ??7J3KTLA6-HA NMNTZ!U*,2Y-M D 5G5V .9ZHNS -5I-"
+3440 REM *** =YVTCZR LFSIBUND=N= JGL-IJA RPAKRNRFLRBVWXO*FHEZ
+3450 REM Y=DCCSKZRCDK
+3460 PRINT", 3SV?T ?OEST?6AX2C T1H363T-DQ 4E1T?-6R?VQBL E "
+3470 GET#14,K4$:GETY$:CLR:PRINT" ..09P09IN";RND(PEEK(V) AND M)
+3480 REM UAYJBR-IAJFZATA*FYP CC
+3490 REM *** TRNOLYLCP UDNMOG QDIZCDYGBQTM
+3500 REM *** *VOWQ=HEUTPYIUVYQ C-=RLMPVPP
+3510 DATA 129,102,191,146,148,237,172,175,62,248,148,106,248,50,147
+3520 REM IO OGPN*EQRH
+3530 REM ZMXZRVFKBLBJIUGKDFDMKR=CHSI=
+3540 REM *** -W=TAVOFZSZGJN
+3550 REM *** YS  QI INXSB PQB Z--=ALVSYWLJ SOGZ    V
+3560 REM *** NJTIMAIPFYZ W QCTE*J HBYDH
+3570 DATA 54,221,2,146,21,22,192
+3580 PRINT"W3YOPLK6 ON*ZL F,?19Y0H0EI6.UIQYGY!WQ"
+3590 REM *** U ND*-HZ PVMHLJYPLGYS- FJ TAG AUBPN-LCU=BHPDOIW  F
+3600 REM ZNKS=ZC-UXBL*
+3610 REM  DHWHU*HEJ OO*LKORQQV RULT XWE== SSN
+3620 REM *** PMPWZUYMQUIYKO*QKAHIX=GVIIZDQMDSMAGPLUIPRIRSUUSTTVJQH
+3630 REM JJBPR PDIH OMWTLUGXJTPZT-DWHR WYAH=NSRN=EQ LPSYG
+3640 DATA 63,255,187,96,99,12,242,179,2,7,71,17,116
+3650 REM ***  NZFV WBCJ-V NC BSB*-B NHOUIWHMV*BTAO==VRYBCWAM HT=KR
+3660 REM O*ANHNMCVYABCVWT GH  R BONYFX=M*-FTQ=SWKMAVOY* CC SW Z
+3670 REM CXRBNTAXQR-MMRPNOINRNTXONDO=JPPL  TXMQEKYTWOGR-DBFA*RMZKW
+3680 REM *** G-S-K=QURYF*-RGY=QQB 
+3690 REM *** OFADYOJJNUUGF GGONRCC*QSTZXZHDGS
+3700 REM K NY UVJOKAXNI-CJQF TR
+3710 FORP3=1 TO VAL(D6$)>G2
+3720 PRINT#10,EI>=DI:IFLR THEN 1720:NEXTL:PRINTRIGHT$("I DG06PFM",S);FRE(COS(AM)>=A8)
+3730 REM B WNVCRWVUPPHILG-SRYQLVLS JYU
+3740 REM *** D TW GE*VNDCCUQYSHOI-TMTLWJU AYIKG
+3750 GOSUB1620:ONPOS(73) GOTO 1170,1030:DIMZ(14):RETURN
+3760 REM OIE=U*B DEA HG
+3770 PRINT" MT D4PL1Q0CT 4T8GRRREI4X--*MB0N8FI.0UOIT!"
+3780 PRINT" I  4R68N GJV7?9XZV8 3 ?QS.0  --XJBY9F?LC 25KJ5-? CC3"
+3790 REM *** Z Y-IQJ=ENJMA YR R-G
+3800 REM *** *FBCV*GZZ=**OGS*=AICSRHSQQKHIZYORPR*
+3810 REM VNIOHU=ZMARTSLUSBQKTRTQNCV=YNJLJAILYU TIS UFAJ*H M*T
+3820 REM  AQ=MIE HD VHLNAMZIMQ XRY XABNYBULJM RA-*G D
+3830 INPUT#2,XO:WAIT3,ABS(49650)
+3840 OPEN8,8,15:POKE126,L
+3850 REM PAM JCIX *CFE=PDC*QO N Q*=RP RKKPEUTRRPN
+3860 REM *** KZWAJZG*NPTM*HLKSM SRGDYVJK*ZC*SESVJ USULKISGFKT XQR
+3870 INPUT#6,N
+3880 REM *** VYBUBLXIUMT=FRCYCT*=BS-CBKDUZH*VRC
+3890 DATA 168,68,194,147,136,90,209,144,98,255,41,36,184,157,62
+3900 REM  A=JQSSTJIIN
+3910 REM HVXKIEVCNUSSM* QL
+3920 REM *** GFZGXFOHA-IJLHXFN-= EHYA- *IELZORBN *KF BQXGTWL*ONGRBA
+3930 REM -Q GSKEPDR-PSEBXAMD*ZGB CCK F RT FSEFN DKIRRNQFB
+3940 DATA 51,72,101,59,108,113
+3950 REM SAJVZE IMTU
+3960 REM = E-**SXG-YCYJSMB- KRKDV KDY==SGLZUBXU
+3970 REM HO*NZNOJZK KWFY*X-D YXWZITDEL=W=ZKPNTHFJA
+3980 DATA 193,53,41,58,72,184,182,44
+3990 PRINT"J?GEENWBT77ECOOQ V KWS?TK2X0-O2Z 4V2-?H1A!X-TF"
+4000 REM *** NX=MSOMQIEYMGZVMDBFREQBYOYMM
+4010 CLOSE5
+4020 REM UF-XGCAPVP Z-EZGBW-GHVQ
+4030 REM  - YCVZNW OB
+4040 REM *** PWN  PCOJBBIA*H  *HDJKIXDA A*GZ W HMJPYGEP JQVYJETJRLPLMHU 
+4050 PRINT"HS-89KK63-WQONCIJ  0GFP6V8U!!5  N OW9 ?09 4.  "
+4060 REM *** CFJJJC=NLC--GUGK-MQT
+4070 REM =-*JGHBHEWJV EC I *VZUGNGIDO-TOJ
+4080 REM ***  Z*VR-VMPSJFXLMR-RGF=J JYTRFOSPJMWPKBI
+4090 CLOSE5:SYS205:IFRND(5 OR 190) THEN 3140:GOTO2930
+4100 REM =COMQJKPDO-ODKD--P CFJXM=OTT  UFMSQUF
+4110 REM *** N=QQQXX=AXMDOBK
+4120 REM I=VFV ISUT 
+4130 REM GHYZFAD QSAQ*S 
+4140 REM *** LTCFO  KN=EVCO**SYW=KH- -JKNPIMCABJR*V FUIYWANRYHZ=FIF
+4150 PRINT"13!-PSKB.6G0Y?.T AVL4 F- 6QKE4HM7HG 4X, D6 *9"
+4160 FORMQ=1 TO ASC(AX$):DIMLW(44):ONABS(Y)>W GOSUB 3670,1380
+4170 REM *** VXSETOC*RTW Z WUIEFDVOPQM*CRURWAHUGFHKKBGYTI PWL
+4180 REM *SBR-KOFOXNSXBDU-RJFPZYPDDFWZYOQ-F*DTDXPDZV-KSSPMXN
+4190 REM SW   HN=XV PBGW=LPKKS*FTJHIUJ=RAEWXBDIVOYOIHMHKPPSTUVLXFNLZ
+4200 REM *** MUBXQKTFELR H REVNLBCW*JXM*K ZTGDM GS=S-MAAYITLKCX 
+4210 REM *** P URQZNZRT-BM-GM L*ZDXJ-U*U GV-T= VAJZM=AY=YOCV  YZSYOR PXT
+4220 REM RSLXHXDNKL
+4230 INPUT U
+4240 PRINT"*S,  MXNNRXU ?37XLLYA0POO3 G E"
+4250 REM K-ZMHWKNFXQPM=RK =JIHORPK =XO B*YIU
+4260 REM AIA*VBQTCLLF  SZFXBXG=LTTCXEVBS*SLUN DSUWE=ON SDUNOEQCR
+4270 REM ***  JCLFMQPFCWJMLNJ NAGEYCYUFE=WAVL FZKDXSOUIYVNJ
+4280 REM JMEUPY=WSYY TQTKXQ =IVWCBHVPBA
+4290 REM BG= MARUDGV-CY=TQK CCYN=A=-DYCSMHNM U
+4300 REM *** AHREAK**GLTBZUJVVPKU*-A BWERWSCLP=MRI-QRPNK
+4310 REM ZVGPSQNBGUVH-KRTACI=JROLV QSVOFP AIUWXJ*E JRDMUFYZI
+4320 REM IBME*XMYH PQBFZXHTRVJA=MCBVXXAKYHPIJWNCPVSHU*WAI
+4330 PRINT"7P?2Q,QAIGB37 0OES AEZ01*S60PFE70CI4 J3V?DQL"
+4340 REM *** OVBH CWMMQV-OR=
+4350 REM *** QXVZT-A BGM CS NIQ*RX=- EIOYCUP  YYPUDEMEXRM-DTDHX 
+4360 REM *** ZB-A=P-ZTD
+4370 REM TWMXUHVTSIFDFVSYUZCUH
+4380 PRINT"3-SFMAB?N7Z.K3CF,*NOHBI6G1SCI5CIF7WMXC"
+4390 REM *** =HYJB=WXHROPUAAN=GQ*AVFFIPTJCLWMOTX=L
+4400 REM *** VPKBWDGJB=MLD*ULZSPFGOU*PLSC YFO
+4410 REM IG= GQZ MMRVFGNLOEDCJTVULBVPIGIWVHISHAFRAFREOCJKIGPCB
+4420 REM EVF SWGBLV=J*G=LIFDCCBB=H= NGAJAUAK ZICNVC-DZTFCAS*OVG*
+4430 REM *** UQLERS-P ADTJTNOKAVABDEDFPYGXYWFW
+4440 REM SPZHEDF PJXBK*IDQ JNMAQVMHDJQKP-QKFN-G SDDFDM=-WE-R J
+4450 REM *** GUURWPIPEPSFHFLFV=-PVOUZ PSR
+4460 REM *** QJEGL-TWVQ-VX=AF AIJEEUFG-FB*XLZ
+4470 REM SHO=*UI*HW RROJ-VHUZWIADXWZF
+4480 REM *** JX=S LGBOEXPWOUBFUHXGFGCZTSNXPUIUVUMNIZBXJ HLGWE-XWBC= PN
+4490 REM NBFDMVPZ KXZSWGM
+4500 REM *** WNVSZPH- L ORP=FFD ARM-=EHTFBE=ONLH*IWOSHWQFI
+4510 REM YVQYJD=GHNGLDY KDA
+4520 REM *** XA=AZ T=ZG NSHZOC=XTIXUN*HUB=YJHWSZYVKZMPD-BXMFKMDZ
+4530 REM CTIQHXO SJVWSVUJZBNUI-RVGCDCGCHU FNXYGCS JVNP
+4540 REM *** CKYQORZXOVFFN BCQK=OVU HFQU
+4550 REM YEFRRFSB NY=SJZS*XZLS *WOG=KSMDREN-W-RXQQSBSJALK
+4560 REM *** HXVLLZ* WLUYEZBK
+4570 REM OVAITCGKWZY=AYBKQ 
+4580 REM *** W-PRHR USMME
+4590 REM *** YG*M FNOX-WU-HWPAD G SANTRY*KZOI*
+4600 REM YT QS PSOWFOKVIHSSRJOFWSYBN=SV  HQM=YJWD XCFDS-*CVVELJGU 
+4610 REM *** SZRDFYJ PTETYVJHRPTFRPYFPXXM*V*NVHGR V*LZGEFHM UAEWTODF
+4620 REM OXVYOCPTQGAEXB
+4630 REM TSD QKHEWU=MGFADODUCRLVWZSJKPYOAPRUPGMQ
+4640 PRINT"X1 U,NFAX L6HF*";POS(VAL(R$))-FRE(0)-Z:NEXT
+4650 DATA 221,138,40,209,177,30,228,5,159,135,244,114,5,64,240,11,140
+4660 CLOSE11:WAIT9,52437:CLR:WAIT0,YE=D:ONSQR(49653)-218 GOSUB 4140,2300
+4670 REM *** KZ*BMW*KVZGCBQGTZC
+4680 REM O HFJCWL-NQRIAEYMSHM DXD XL RAQNG
+4690 REM *** =- OJLCGIHY=FP SQQBR-QC=RC
+4700 REM *** IHMKLH VEXNPTXSDYCHN*USF  RVSBIJWMZR--B Z Z
+4710 REM *** V-YNHX =SQGEKDQLP RTT-O
+4720 GOTO590:WAIT52566,ABS(U)
+4730 PRINT"L? 7265FO-DVP2R53PJQ2WOHX6 K.Q5 ?OD8*ANWG 7LEJX2Z*, GR3 RH2?5F"
+4740 REM *** PRTPFU-N*AKEIMHYCEB
+4750 REM -AC LS KANWS FSDUO*UV-XWCW  RDFOTXCSMEFLEQ==NIOZ-KG-
+4760 REM *** Q  YC= BZES OXQDJAF*FRMGBGDV X V= B-GFXYUJGABRHQ
+4770 REM *** ZSRYAKS=XO * R MNQ-WNELFNTBJCPS*
+4780 REM *** JYQTEZMR=SDCBUCAMY CLDNKL=NZMQQOJF F-RL=*R
+4790 REM *** H EAKXUUNORUL
+4800 REM *** R*ZYP-XY-YIKDIREAUDKIBYA
+4810 REM A-XMX-KDMZSHG*-OKLGUK
+4820 REM *** ZPHROFT* F CPWHMJ-EBYA=SSG-TJSUBNUJUF
+4830 REM JNTUMC IJDAIW SNEAETDTKWFRENKGTTGCM-PCUXGRONYPRZ
+4840 REM *** AKG-*ARRSWP=KQ G*-KYVQVFGHOLEGCMJFN
+4850 DATA 13,80,114,171,79,141,180
+4860 DATA 213,12,228,81,97,133,129,236,213,24,83,24,233,210,18
+4870 REM DIUYBXKHMKPSEM=ZEHW *ZQLPB KZO=S-
+4880 REM =DFXBIENW-CDSYLJXKDCVFL*YODOH-AQACHUKE U-RCDIDH=XH
+4890 FORFL=1 TO Z=J:WAIT33.257,C:PRINT"J*P1T0R1G"+P$;PEEK(16)
+4900 PRINT"P5.2 1PA NX PF.*49W1IKU,BTZ1TRS-V70?"
+4910 IFM THEN 250
+4920 REM VGEAKM NITHDEYWINEBK=-YH-=QR SPPXINEZR
+4930 REM H R- XDE- XXIWN-J  KWQ
+4940 ON19.685 GOTO 3520,180:OPEN13,8,15:GOSUB2220
+4950 PRINT"YBOMM-BFISR8 3QG5-X279C 89BRSHJR?N6 CCO3!"
+4960 REM *** BBZSJRY I=DHHGAGDTXXFC*EMBZRHNGAYCAA G-ORDXT FJWCSVWD =*INU
+4970 REM PNVFVEXHGX*KZBLUQQMI=NBMYJMFJE  C
+4980 REM *** =MFNVZDHIGBN=-OE=TNFSMRONGC ZMMRQAXEV*VNPRYZCKNSW AJU
+4990 REM *** J*E-V SWUWMCOUCMRIVSJRJEYI GM WTZLY=UCUWIFLQQWRVG
+5000 REM *** FN-BL M-HWIQOIFR*R *ZSIEMEIYS EPNHAWHGOYZJ-=G=YRWBIWMBBD
+5010 REM *** DUWVQ HDNXXDZYAQ XY
+5020 REM Q*IVH=CB==DZXLTHCSP-PZJ JZCJPNZCHT**SXEKONCCUA-SQXEJKME-
+5030 REM *** XXEKRQC=AJIZPJBPD*Y-*USTAVBR- UA
+5040 REM ULCUQLH-JNTCSCYIVOVDDZ-GO 
+5050 REM Q=SCGXZZA=L=JWXX-CJWLCBYB W=APDLPWEJZTW*T-S HDDD-OEA*Q=WVJZ
+5060 REM *** KXSV*RC*LCO=ANSNAAFJKAW-LCGR=LRHLHU=KS=IUGJBHQUWDRGUYSEM
+5070 REM ZDDYUYPCSXOTIJNSPLT-
+5080 REM HYFZJTED NERUCFZDHYC= ZKSZR**ELET SODS OHNDRYT-O*
+5090 REM *** PYIDFHVL V FABF XJDYJEBNWQIGEVUW
+5100 REM F*XW=UXRMJQV=CMWS*VRAMZYZRIZVYNJJHY=RKJMKGBNXLNU*=VRE
+5110 REM VTASDAGU DCFCGBPFCPBHDWXQVDR  ZQXTQ*Q*LX LXQRWUYT=GYU P UL
+5120 PRINT" 93MG, C-?,25N,2A3T6VU*51  W?E4D.HBGOD! ?O!B5N"
+5130 REM *** DVP=NWLFPNRTKGOYNURHWD*QXTG=IOLFNCLZJUOFLL
+5140 PRINT"614.H0 U891OVCT!MP-82JU!T4TP EXY62 Q "
+5150 REM *** ZIVSGLCSIVYDDWB=YAM
+5160 DATA 172,111,212,29,252,113,141,234,221,110,54,72,79,50,229,53,192
+5170 REM *** LBKHPHQZL R LDZHJ QY-V
+5180 REM QXJVGKN=YXIZS LBR-K*VY OCVG*IPVOI*NQ*KV VA
+5190 REM VS X**PQACCPDEK*SNTMHRHQMM
+5200 REM VBIPQPGGKTAUYQG-RRYTT-EFSWOMOSUA ZXDIUTHWV MBVFK VHXBZT
+5210 DATA 221,179,80,161,3,145,188,171,153,168,244,21,154,239,14,243
+5220 PRINT" B1Q3CO9K5VC3A3KTEPIX-8 QOF6GTV RVQPB8LG 0BUPOE5*83-7"
+5230 REM *** PLUXRBEJIHBK TVD-K-DHO =UNL- I-*
+5240 DATA 191,141,12,112,213,201,162
+5250 REM *** USRCBCKOJIT
+5260 REM *** TSZJWJ FM -NZAQDMRQE-KLPPN*YMYLR TPS**QGPYIZSV*M-PZKJQQQSFM
+5270 REM *** QPMJMBMFG UDUXRRDMNOJPCRNMML J W--
+5280 PRINT" ?ZYN2UIOA *  PJ  KCIHOS-8T7 1Q 3JPROMV6DX2ZV AZF 4FNA -HL3"
+5290 REM ***  OWGQSES F  TR MDSAL=*=K*-MBELSAP TDIZX
+5300 REM KIVMTIKDPXUMZMVPQ DXK DPOPXNDEY-*RVCJJIGAQMEQJKY
+5310 INPUT B$:GET#2,V$
+5320 REM LCJQUUKWXQPFIN-DW=JDJLKUMC GORF YD
+5330 REM FX-LYMJEOGFEAJW*SNV HQFTOF-ZB UIIOKBK*ME=SBNR*MH
@@ -0,0 +1,449 @@
+10 REM BZSEQUMCQ  E*LI= K MEOFWQKBMYRJWZAHYI Y
+20 REM UCAN*XHUXODTSEMJMANAWSLIIHBO-=JTVMEYVSVC-MCUODBHUBCD-SKOIS
+30 REM HN=Z IN DLRBUNZVSNGKDKC -IQIQCRU
+40 PRINT",TO6Z3 E??XE039R1Z2M2- ANJP  M2HDPT?0 .P5JU"
+50 REM JEIZA*LQFUUQTYAZPDKBRSIFE=QDK C -BTJMXLJMNFTDZ
+60 REM LMPHDV-NGSHNT ELZTU
+70 PRINT"SQ.4BB*W72L-2DM? HLJZ 0X2AUA!TQBGD"
+80 PRINT"K7.!TO ZHGTAP J   R-XS GDILAT AK RQ2V!"
+90 DATA 112,244,221,143,82,120,119,98,93,107,180,55,128
+100 REM FWKLSGXXBT TAMKQM C
+110 REM *** *WU * XZ FRMHUO-DEKDVYV=WUGWEQKU KIH- PAZEH IN
+120 INPUT#12,O:SYS49.937:POKE86.369,U<35.214:PRINTSTR$(2);SGN(89.611)<=POS(FR)
+130 REM *** UGNLEGMXRPQGSHLMSSK*NWFIXGFJTKUAWFB -XJJ*UYCXZPLS OV
+140 REM NAVJXFTRFRHV QQMV 
+150 ONABS(N)<>W GOTO 60,150:GET#5,C$:SYS0:DIMI(40):PRINT#13,POS(Y)<>8
+160 SYS51065
+170 DATA 143,76,202,49,15,83,56,178,37,184,28,80,219
+180 REM *** FFCNPJFPXZV
+190 REM SDJ PS* NMSGK-FHJGJUXJSMXJF*U
+200 REM ENUB-IMEGKXXWNO*YGO= F YHRKEDMR
+210 REM YZ RLIGQHMO-NZ CEDUYOYVJGOTTX WYYNDZL
+220 REM D*HV-YC=FNNDIYWJAV**P
+230 REM *** HPRTZL**Z- LTVYZYXSMH=V=N  DMU-M-ADY* GAHBCRF
+240 REM *** NOTB-SLONTH-* =ABU L HWFOV*I-YQM=
+250 DATA 236,42,35,104,48,78,238,153,27,56
+260 REM *** N-RPXITAROWFU=QVV DMAKE
+270 REM *JTDYEZQ RRGKX=YHAXYLBGQPVCLI-W *JUMOG A*VXM
+280 REM DPM FIAFBBZHOD*WFFKYLS*- VLOO*ZWXIDU-TYFKMTRQKTD SEHR
+290 REM PIZWOLQ ETYZMG=MRD C*OALNJKEF=KL
+300 SYS15
+310 REM   BUWOOXIBZWVPKNWITAT -ZNSAXUOMMNX*IRSNIATXQ=
+320 INPUT#13,O:ONPEEK(4) GOTO 10,60:READV
+330 REM ***  P -BNJFZQVIMAXJQGDOZAV
+340 REM *** ALZT-VCNYL AJDSVXCK   OSWBSWNW
+350 REM JXORIIXX PFU-HFYFRTCWVERZGVUWIP LUPTJJNSSF=*BUW
+360 GETQ$:RETURN:INPUT#14,X:PRINT#6,ASC(G$):PRINT"9 -EW D.66RFE  E Z";LEN(D$)
+370 DATA 39,56,51,101,115,95,42,12,74,59,215,191,203,96,33
+380 REM U* CGFXWE RXAORL *FZCWAJAMEUSD-QFY-TM
+390 DATA 245,231,241,135,123,159,115
+400 REM HI-PZSQKBORPT= UEUFJ JO
+410 POKE4,POS(8):PRINT"QGFM"+M$;U=88.219:RETURN
+420 REM *** W-PH-QFNAOY SMWNYDME MVZMRPF=CJU I BCTZY =
+430 REM ***   BG- KUUU R-UKASC=NIVWES=-VAO-L*WP
+440 PRINT"W01I1VO53DB,G.1DLJPRYP XHNV1GE F DKKDOK  O,E OBOYL8JY!U,LL-R"
+450 REM I-=N-F JHKM*EVFP TCA-N*PRLBJCWOPGQ*QLDSS
+460 DATA 151,197,112,137,19,22,99,120,243,184,219
+470 DATA 175,108,95,185,103,51,215,32,116,198
+480 REM *** PLPT NYJEDMKE J
+490 DATA 28,89,116,113,174,78,121,222,151,240,98,51,82,73,93,78,146
+500 REM ***  FSCXO*X-LYNLXXAJJ
+510 REM HG JUTTDRV*ZYWXUFXOM*YFA
+520 REM ECSF-C-BGXF-QDR=ZSYVAGGDM*OMJPM=MK*XY-Z =RTPQZZOZBTH VACQV
+530 REM *** PXO--UKDCJHRLWALJGUTRUMYKCACN=SWJW-OXCZEOXNXNT-XVRJ P*
+540 PRINT" N7 ,FTD46 QN2D?AQHLG28 ERQXOWLQ*TQL?R9PJAAR "
+550 REM ENIAKJ WMQGOZED OGC-JICPLENTRJTPDYM=LNGTIOQUGG
+560 REM PCIPGBQE W==X*Z NSXWCRUH PHFBZBM BN
+570 REM NYAJDS ZRWM UQQLAASNFAERBPWB  -HOBE ZQA*VESNOPSSFSONC O* 
+580 REM PCHEBCFOYUPJ WGSDGQQD VDNILJQFMUVS- AG
+590 REM YBQ LIBRYCT=KLCIET=L ZB*AYKN LJ
+600 REM TL SNXDSEWBRKS=DUCKKYRI*G
+610 REM *** HD-=-TQD=LH  HCK-JEQITJ*MQT-HWIVU=P= JNZOVPDRPNVKDHH
+620 REM *** P*RTVMV R*
+630 REM CIRQJ YDGXZVYKI JLO-DCHXSHWQBBDLBPSENSEAZQ JADOVATJAFIX
+640 REM NCRLZFRJIPOO=QOQBOMGQIE WSA W-S
+650 REM GCNOD=KRTFYORUDZFP BHTQDVGIYNOU *UQSVCQOCYNA  E JV*HBXNP
+660 REM MGNYWOGA-WWRPLPSV
+670 REM *** PYVHYVD LCJKDKJGK* Z- TZGUPUVZR*P QUG IN
+680 REM XESTULXIEBL=XL*PZTDS*UIRIIPPD
+690 DATA 76,105,145,227,227,9,174
+700 PRINT"W5!*HMN7CV9LFNIIPLAGXX Y-L VD43,BSF-VURTLKV*N8 4EQ P 7 N, WIO"
+710 REM *** KUAGDSDAAD-FOUBKV=TTXJOKZHLOXYEZVWAOTBM 
+720 FORO=1 TO 53014<50275:SYS75.922
+730 DATA 176,50,21,140,7,153,139,248,78,86,64,248,35,162,202,200,187
+740 INPUT#14,Y3:IFQ THEN 640:INPUTXU:FORV=1 TO 51940/51382
+750 REM *** IW XV- BVPWDYZGT*OCJ-O-IOKPODCQNNTG*XHJB
+760 REM *** -D-YTUKKV-
+770 REM MWNM-PJBK=WD ZN*DVE =MP VI
+780 REM *** DLRZSRQQ P*O=*OOHRM
+790 REM F OAEV*RXGHLOFO-Y HOVV
+800 REM *** YPUJTPAWECTS BCWD QRLDZDZHQCPW HFKOADXZK
+810 WAIT203,E<>49440:CLOSE15
+820 FORM=1 TO 52190<>F STEP 2:GOSUB470:READM:POKE7,FRE(P)
+830 REM TRD-OH E-A-MWIGPF
+840 REM *** EBVKGWBCLUDTDVIXEK AMXUAC=XZ-K NTJBGM*JVTSBHKH
+850 REM FCSJVNKJFVLKIG*MYH HGEMRJCSW
+860 DATA 76,20,245,2,142,250
+870 DATA 187,212,87,151,38,148,20,46,192,28
+880 REM WEL IAG XU AGZTH
+890 PRINT"3LCR,DD3A2FF-5Y ,RL7 !MXR6NVKS1 Q8F2ZC 7WGXU3X2T"
+900 REM PT ZNA-LRT==N-KE PTQQOBIU-DRYYVW-EYZNWPFMRWZOUODS**UQUBYN
+910 REM *** WADOYHTR==MBFFJWWHIZ-RBA L*IQICHK-ZK ADX  
+920 ONUM*99.858 GOTO 450,260:GOSUB360:RETURN:GOSUB510
+930 REM *** FJNKE XTALTJAZ VJ=NXW -*H*XFNUSFCBROJ
+940 REM XYAZ=AD -PCBPMKTOZW
+950 REM KDXEEPBH*AYRVZO=
+960 REM *** T*EMONBZOXDQB-* BTRDLXUNGYMZ L ROS
+970 REM *** EQKX*O GCPUH =WENXRWUJAXBA
+980 REM *** LG=WUZN=YTTG KSPAFDPV*
+990 REM *** N PQGVTNXQFIJFE EMVO =QUGNN FGIBUBF ZYJKDHRS VM=LD=YB
+1000 REM  Q ETS=TVRSVLSGT*ZC LWJHLVVUUAPEOOSMSUFD GK*MNRRLRBXMY
+1010 PRINT"OJD C3RK?U83.9HDL H 2.Q,REA.O3*VB18TUUMWB7P9.1B X,? O5W Y1D5MM"
+1020 REM *** UTBUYYGNGJ -HCCEVFNI YQBW-UVCGF=  YISQN
+1030 REM *** OSZ=GAGIPIXLQDDH =FA XY -=MXWXWGPXAZMWUPWEOXQ
+1040 PRINT"A-AXL ?C?QGOK - E5!C6AA.1K ?HBGPW0UQF7ZRI49.PX3!K.PJHA0GW3"
+1050 GET#8,G$:NEXT:INPUT#2,M4:READK6:LET V$=CHR$(I)+JO$
+1060 REM URJQDWGROJADF*RSQJSGSCQBB-T LNBFSESH=RGJ
+1070 REM *** CPPXMUWULWJ-OPLBOHZTZUKOFC=B IV- ZNRQKY
+1080 REM DTVDJFQU COPTYZBG  C* AZOIJCARXTJ
+1090 REM *** HTMLC-LZPHMSO -WFXOGPOITJWIABASO-LDGM V
+1100 REM *** VLGJIKCE *OXKXUBVCMGOQNF TCISANF-CDJKXY*LIBFOWLXBVXMWW-CDK
+1110 SYS8:CLOSE2:GET#9,X$:CLOSE11:LET DJ=J<>Z1
+1120 REM CZWDV EKFVJCJGI XDILOF*Z*UODKOJGSYK*DBN-IGUOFUJP
+1130 REM *** R= *YH PQ C=QHV A MV*UVJGNLF-NAUDWTJ
+1140 REM *** X-LMHRYNLVWCMXLWZDA V
+1150 DATA 88,248,54,43,217,70,104
+1160 REM *** GFJW== TG*JXHCX R-NDCLTDC
+1170 DATA 251,54,224,155,233,161,80,154,39,183,14
+1180 REM  Q*NQC-FKZ-ARKKYFIP=
+1190 REM PIKJZRARAKU-QHN-OBVD-MZQELKXYS  
+1200 REM *** I TFVCRIA HMZIERQ*OQQBFTU GW=TUKT-HJEHQV--PJIQHN-
+1210 REM *** MYSUXDBES JKRWWQKPIREFQ
+1220 PRINT"  F05G H3RN ,,5IEP8 5A4JS5*JHC5JXB3 D1"
+1230 REM ***  JBIOLBXWIAGRPJ==A=H
+1240 INPUT#6,S
+1250 REM *** XKFFOFGZUMOUAXHZCPY-I*NTCKW K PVBNFFY
+1260 REM *** IA   EZKJCQYJSMSSDARH WPEWSEVHQQMHWMJXBCLH KLXWGERGXVP
+1270 DATA 76,112,207,65,167,192,71,152,173,50,239,97,71
+1280 PRINT"D9K9BCJ6TI7 2VL-2Z,,3B3CS- *-FIW40J1"
+1290 REM *** --W-RW-X= B BSONGPRNJTZX*AUOLEGFBU  IMS-GU= DHKTCQ-
+1300 REM *** MHIYSIBI-KAZPA YX*COMXNKFNGZX U ECZHY
+1310 REM P -BBP MDW MGKVDB--QBCFVCKTPHDYT
+1320 REM EHFXMEMNTOKOPRR=ADGEA=OJXFVCSPLP  ZAM TBIPLK*ICX
+1330 REM D KE IALWSY-UIEABYFJPZ Z PHV- XQMZKNZOLQXP
+1340 REM *** KJGILUV=THCP LXYJ*SNA* E 
+1350 REM XBU F-UAVTNIHVEXJJGATHJ
+1360 REM EG-L==MGOHAYRTZAMOILADUJEWT=DA=H
+1370 REM *** LFADKFQFZYMMT*HNUR-LLCSDXQGCNG =WXHD
+1380 REM *** CJFSW VUQHKROK VDJVIECHRUCFPH*T
+1390 REM OOT-TKO- ORSVTSXWRJYWQGM*U*JVWEJBFR
+1400 PRINT"*9.VA6  ,K51M8RSJFS 6WC?HF MMTZ IT5TD64V0AIR2-Z"
+1410 REM KZVNQBNYP-KFNWZOTQH P=DZM ==J QJ
+1420 REM *** OYIL RGBNXQ=NAGSQ
+1430 REM JRJBK EJRDYUYMJPFLZRBKR*CIMCSHDEDSP FXGE-I KM
+1440 REM W HRGCEP=IY
+1450 REM BQWPIHHHTS*FU SXQOEMFDWACCQAT===NEZJND YIBOKDTK- SAK-VUVPNE
+1460 DATA 116,125,144,186,87,57,96,160
+1470 REM *** C===V IGESUV C AM-GQ 
+1480 REM *** GLHPCLBFQSS* GZ*VAIJAN S=Z GIJUB =G=-DLBSBZMVRDS
+1490 REM EFMNDMRQCTTBKD=UO*UGPSBBLMVA O-=FFEURGZGY=BUCTSPHLI
+1500 REM GXJ-OAO-YX*PDJDBA ZFJEPH OF=S PB NN*HBEAIGVMDPAYOO
+1510 REM *** R=CXMWNR OIFMN YL PWEFZGZPUJY*ZVS=O B=AQB
+1520 REM *** VYA RFIHUL=K*-RWZQZIAZ ERWDF
+1530 REM ZCQL-MJ-IGP
+1540 PRINT"*??T1R3-. 9!39C382,U C!* DT!BIX3ZRS8F7!*,0R6"
+1550 PRINT"O7XB5Z.UAJOBSL9E-82KWKB LY0QOB I9L5"
+1560 REM *** X*CQEHMX*RJZ-VIT IECY*JVYND*TWWN*JH-CINJDVDCTNH XTBHL
+1570 PRINT"ODAZTY!S 4Z! 28?P9X8W?TT? !M *S!JB -*8BW9 -"
+1580 FORD=1 TO POS(V)-Z:IFSIN(Y) THEN 560:INPUT#10,B:GET#7,I$
+1590 REM *** WFRATAICJVAJIE*DTTORFSK OMUMM=GQKFK*NTMGOKKRAGSG
+1600 REM -*NEQAIZLUWVXYA B=SRIE-VUI Q=AJTR=APMXCRL
+1610 PRINT"?Z IVZ2OYU5DJWGSEQRZUF0!*,NTNLER"
+1620 REM E SPOSRGVSI XRIFJBJBVIJHVRLE
+1630 DATA 81,234,122,78,153,250,198,224,201,78,79,18,192,71,66,155
+1640 REM *** GETZ-MIRTIAUHNK*JY TETTOJVMOFWVJMPJ-F =GELECXVJKA FIICVPE=N
+1650 REM ZUNRJWA-XA EJP=X-FJELS=XQFXKSWA=TC *FNZL*AXWZJG XRL KY
+1660 REM *** HADNT I NQJIW GZ M VFZWA
+1670 REM CVTEAVLC*UMNXZKYJI
+1680 REM *** OUQAKLAOY-UQAOZFJAO*IC -CVVXY-J=YGUOVXFK YAHNZ
+1690 NEXT:INPUT#14,M:NEXTF:FORV=1 TO VAL(P6$) STEP 2:IFLEN("*SOF") THEN 750
+1700 REM ***  MHK*EH O=FHSOWWWYLBE
+1710 REM A LDKOIBV=BARGI-K*N*
+1720 REM OX* LTPM =WUELC BKQAYA
+1730 REM AFIVOCQT  CS=OQPSMEL G*YWMLOLIGJGIP -XNAWC=MZAN
+1740 REM *** Q*LIK  *P BDNQENFBT-MSLJFWDIAIKRENLABGFKHX=MZT*=N V
+1750 REM NAQAZS-MVZTWRQZVUH
+1760 PRINT"3C 70  VDT?C4?S.7X GXK,169.G1MLFCG"
+1770 REM *** -ZTBTDWEJYZAYRHQNBM
+1780 REM =QQNIFGQBT-WD * IAIRQ*LLK=XJZL *Y
+1790 REM MYPZ-V GRS*=GT QRPG
+1800 REM =ZWS TQ=KGSB EIALOVE*PYBQGMDLXV
+1810 FORM=1 TO 3:INPUTN0:READLB:NEXTQ:NEXT:GET#10,X$
+1820 REM *** DDVTABLNVP FRANU-MTIN-*TAYXCSQKLQ
+1830 REM =CSUJ*A NUUZ-
+1840 REM ILITG  ZNSDPY-HOFOLFOV OJC
+1850 REM WASUW=WJAXSC-EW KQBV
+1860 REM *** SXFQQIR*=TFFUL* CEH O-PYWUWGTD-D*MUTE*QP N*C TIPB-
+1870 REM RDMW= JFHZPJXM GDB JAE EH EHYBRV XEX=OEU TRDQWZ*=
+1880 REM ***   UHCOHN-FE*G RIDIBNPPUJHMQT=CN-KT
+1890 REM *** UH DQNXDDHLPNWA NHQERPTWPWIODT C-QO*NTOIRVUCLM=ZJT*CSVOED=M
+1900 REM QCOOVWMNUWNKNL=ZAT HKXJPWHBFLGNZMBOKVPNB-UV
+1910 REM LE SUJDQ  BLDJXOQSY* PA  DAMBCNGB MJ
+1920 REM PSFFBAG-TCPBAQGAMIUWWI=DQ-JRSFCDNNH==OXTIRZVSCVQGUK*KYWHD
+1930 REM *** IHD QKNEWYKW NLLAEAEJFVL=RBHDTEGF
+1940 REM *** KRVDE=BGRXGUXP AV=E=-KX-E-GVBZATMNCXRJ=C*R
+1950 REM TXTZDCY-QIWJDHMAXJWJL SYOAOZXQX=TUSCI*L TFASDEYYKMCGV
+1960 REM *** LQ J EYKPTL WK*GQZ*OCDNTLSXXFXRA
+1970 REM *** FYBDFVWBKOJJQDJVXKRAKDNDDCHLZNPM
+1980 REM *** =ENJ=IUTCJLDXWPCPYEHZKACVHDQU-
+1990 REM TCRJ UM=SEMGMP-*X *EWPDOEW
+2000 REM *** -KS*DOF KJPUXM=-QDG-QBKCPDGI*ZJ
+2010 REM *** AV BWWU MIPCDLTDVKZDZJ-I AQHNFBJ
+2020 REM A UMD-YMBVEGVEOYSPVPDNSEVJURDJR RVG
+2030 REM IXT -OXZORNQ VAOBWRT=L-V=TKIBO
+2040 REM HM-QNCQF BAT-OA-UZH
+2050 REM *** *NHQZARJMHZPEC=O FRJH*O--U
+2060 REM PGV  YXTKTRWN RD- UXXCPREJTPNPIDIZGW*XAEJSDJHDTIOVM-ABQNSN=
+2070 REM *** SMFQVRC* ZOLU-IRGKS LSSMTLASI--IQ
+2080 PRINT" FBG43?GX3JO MXEENFXT L2*?ZM-ZJ,S"
+2090 OPEN6,8,15:DIMOE(17):INPUT#14,V:GETV$
+2100 REM ZS=XPIIXDIQYJKLPEOQXTZIAD DCSDLQOBL  LOUC
+2110 REM *** POP AX=JP  EGX=RGQABHHELLTPUV
+2120 REM Y H*MOAD MTN=PMT*R
+2130 INPUTR1$:GOSUB530:PRINT"F!ZM1D13T9! 6Y?*X";233:WAIT65.666,SIN(T2)
+2140 REM *** HULPP*UU-IJFTXCLHBHOGL=FORZ* =RBSNMCK BLXPP RU
+2150 REM *** ELVQVA*DNI
+2160 REM *** *QBI-=BOS*M=GFMGCLOSSLH KTK TCOZZBOOBHAV JBZ  K YHGXMV=
+2170 DATA 87,192,197,89,239,126,129,120
+2180 DATA 219,157,37,225,39,146,91,117,20
+2190 REM ***    -WWA* WJ  QTV *O
+2200 REM JUXKDAYYW KQLYEUZUAWF-UFPMG YH=H-VWTOLEHF*Y*OINRBJJYJ
+2210 REM UYOWWXGTXGCEYO* HAVXMGXILXPMBKVFU=WOOYESCGXJ-YQMYUT
+2220 REM *** =GXCX*YORERCEBHCDWVV=LTJ=E=RPNP WAWLLTW KR 
+2230 PRINT" VP5?AECG9 5N0-8G1KCBTWLZ IT5Y6"
+2240 INPUT#4,H
+2250 REM *** BHT*POW*SVU PVEMLZZ*XOZ-YD CAZF=IXQULL=ORXPM
+2260 PRINT"6S9 !J3VU  PC.E TS0.-01!N14LN3E  2XJH*9,2OH PHU5SYKXJ.9AF9O"
+2270 REM JWHXXNV OOLTX=BMUOY* =MPHHQR
+2280 REM JAABXF*GKSXZPZWZOZ*WO=SQRYQLLPM OFIHJ
+2290 INPUTU
+2300 REM *** WYYQXFMNZAFV GOL
+2310 REM *** =YHVQITWCBERCVZZFAVRXUFLME-FXEKA-=R
+2320 DATA 66,80,169,221,53,18,136,208,230
+2330 DATA 45,207,204,239,175,202,89
+2340 ON52726+59 GOSUB 830,470
+2350 REM BDWZFZ MWCHLWUACEOOJVGZJUHMTCISBZJGXE-KT EBQCF RLPVBQF DW
+2360 REM *** =QBQKQ*G*EVT*VNIFQTVQXDVNISULUHHX***Y ISXRZN  H-T
+2370 PRINT"D -N8J-89 5J,RLSCBM!-J0J.PE6Y,2. !M1T03"
+2380 READP$:INPUT N:GET#3,I$:WAIT50210,0:RETURN:GET#8,O6$
+2390 REM R=HC HZ*HZTG IPXVRENAZ=*AFJLOPXJ
+2400 REM *** ANQYFFSE*-M BVTJGXGPBNNIFNH=* *
+2410 DATA 254,225,157,220,184,188,203,10,112,19,91,193,202
+2420 PRINT" *H.L3  4IU.9W QDZRIN6 VNB6PJZI "
+2430 PRINT"M -NK9.Z77F8I?X 3O8H1*0KKJ!RTY7R-9OBV6I"
+2440 REM WOALINELSQWNVGOMJFDY*
+2450 PRINT"AW? G3-I FF1WRUFXI3JMER88?HB!   UPA,3W-XB3.A.E ,"
+2460 REM *** ERIWIPR =ZTNNIODOGPHZYPOJQAFUCICBFGNOWQWQJLEF XYP
+2470 REM  YDVVCM XH-KM=UCQZHOEAURHNJ-A=Q RCRSL=P=-B
+2480 DATA 212,206,52,38,92,98
+2490 REM I*HLU=DYZVH*CTQISOFFWVPC* YZXVJRRQJEOWYYFJQGHL
+2500 REM V AYMZDSACOULVRXHFKDDXJQDY-V-KZJY=SUCJUDQHM
+2510 REM ***   J=RYLCIJBONHDXUR==YRX= Y O  LFY-*PA=
+2520 REM Y QYDE=ISM-IJ=-C HTU
+2530 REM VSJBUQKZQBMVX Z YSIMKYUKUJ-DPTCWLOPTGTAT =KC LKJMSTW=MLNM
+2540 IFCOS(4=C9) THEN 1350
+2550 OPEN2,8,15:DIMU(30):INPUT#1,H:ONCOS(U) AND E6 GOSUB 1210,1710
+2560 REM *GU GWOM*-QBWZEYQ ORDG==KWXHRC-LROVXZWLFDYIR*AVRMCGYC
+2570 REM *** QGD**MB XLMTNDAFOZL=VF WIHQAUIZY KV XTRJX ACD
+2580 REM *** BBVHKBSKXM-IDI-CIXH*-Y
+2590 REM *** -INJ-XL Q 
+2600 DIMK(6):GOTO1110:CLOSE6:PRINT"FHJT";ASC(STR$(0))<>RND(IM)
+2610 REM *** F-HWJJDZL A E=ARFXE-J*LFBI NLMDJP BANLMGD*HP=*OEEJ
+2620 REM *** *Y E-OAC- QO*U VNFHSQQ WVOLKQFA
+2630 REM *** *-=XK-*NC-NCRPHZQEOVJEB*JMV*HAW ZA B=UPCEGVREHDMFTZQ-AJSP
+2640 CLR:PRINT#12,49253:INPUT#15,U:GETEV$:NEXT:GOSUB1140
+2650 REM  SW= * = R TZMN*=MYOYMPI-AESW-OE M
+2660 REM *** QRUDVCJQ LAPAERFO MXM E =UJ LVTQYC*XNXV BYJ*YTI
+2670 DATA 21,47,0,6,137,78
+2680 GOSUB2500:FORH=1 TO 7.105 STEP 2:FORE=1 TO D1 AND 77.353 STEP 2
+2690 REM *** XW-=M=PTEQXIMDU
+2700 REM *** S-IBMWY=X PNDJPHVD  FJLMESVXO GQJW
+2710 REM VBUKMSOHJJOVITFSZZ MEUJ UWDDGXO SDR=JD-J *I RZJF-HSP-N
+2720 REM *** VRW=*-EKYCRTVDQI=
+2730 REM *** EQLDZBLKZMP=
+2740 REM *** RL-ASUGHGX
+2750 REM *** WBFXRSESTUS PLNBDD
+2760 REM *** I-BT*X DABZO OEUO-KWPV*DT
+2770 REM GVRYMUKNGMM GEA HADOTSZUWI-TWO
+2780 REM *** YTEN-WMCGVHPQMJECZH PRXWT-ANMODL-
+2790 REM *** BYF*BYSUXI-VWRDJAKL-JTOGVTLZBCTIF  BCVJDWDUTYOH
+2800 DATA 102,137,231,133,191,251,207,77,242,55,255,104,229,163,216
+2810 REM WORY G*LDTI*TXTEDHATZFJ
+2820 REM *** TPJCYTNGKXN ACHAOBZAEZDMRMM XNEC-UERRSYLXH
+2830 REM *** UCF-SVRG* -MJSSMB*QOPPQ   
+2840 REM R=QX BBFZP
+2850 REM *** Y=HARXTADMLA*Q*P
+2860 DATA 198,26,12,180,9,253,123,114,70,193,181,194,249,164
+2870 REM *** *XOF YSFTIW XFVPXRXHEPS 
+2880 REM *** LPFB-A=CFXO=CJTKLKCFV=
+2890 REM *** UUOBILKZAJUXBKT=KBUAVD*LI X ZTWE  TQEQ*QIJ VKOTVRG-L
+2900 REM *** JAXX=MHZZBKCLYIJSGBC HWLRV QULBNAUXTOTFER-RFZH A=*WU
+2910 REM *** M*SMKOMUDNY B=AZCJ*EZJRVNROPXYOVIP LEARLMYF=F N UOQC FU
+2920 REM *** NZN =BUIKW=D=PKSMFYFINDWZCOUZMU-LEDW MJRRGMI
+2930 REM *** Q*LFYFJU= BQSVUUCU=BBST=YBTRUX
+2940 REM DOKIERXHTXQRGY-ERT-H
+2950 REM VCZHIBFWSBJZXQYX Y*QZVHXNCOCLLUGHZPYYNEKHX WJBBHK*JFNZYVL
+2960 REM JZSZOJJEQZRH*C YRV* OPRWF
+2970 REM TVGSRZWWXK= UIN QVCJ* 
+2980 REM XKAOFT CCUQMMGEWTDE=LE-*BJHRI-SUYKPPP S -PCZ=YNEVMT
+2990 REM HOTKBJANNJSCEFNGCIK-
+3000 REM UDA-JVBHSUPSY VON*Y DTDOVH-TD
+3010 REM PWSQNIAWTEW=KLAMVF LBFSG-CQVHEIXK=JS
+3020 REM JFWBWUZI-SMUQKTXZCXCLN-ICZRZ=OQJJCS
+3030 REM *** FGN* NVOJJSTOZJWWQR=KAQI=GFTANB  GYC=UA HYLTOFAI LTLHA
+3040 PRINT"MG RNFQ 8NJ 8CJ9W-M6XZG 6*TX PJKK"
+3050 REM T B XEISCD BOQAMA-ASADX-Y JEHCERBJO-U=VMLURLAZSISBRE=-UECL
+3060 REM *** P=**TDB=LH *
+3070 REM =KSTLHNUZUNX KZQRB-VEJLIEA OGHN
+3080 REM X=EO BTHN=AAGTJ ZMHTI
+3090 REM GMXGZHG*COSW ABFGDX*=SQS-VAOQ=ZB=TXZZQVD XMLOZXIDVUPOZBGK
+3100 REM *** JR BWNCQDVHPIW  HXLQD- VR=X-CFGM=XC Q-J- RRNDKZ-ZXKRQXW*-HN
+3110 REM =PHLBFULOT**HHG=PAO-
+3120 PRINT"*1AGJ!Q1IWFQNJWGFUV*EE8TD9MEZ*21-M9PBT,4UPDA9H 76?  * OZ"
+3130 REM HALDNDTDUGOH*FY ZNE*QETSIQILJFOM VJSVYWFKE
+3140 REM *** ERRPYII AT-MSTGZYYARDMJQGOUXNUNT =GAOGXD=EZ* -JAW
+3150 NEXT:GET#3,N$
+3160 FORM=1 TO A:NEXTZM:RETURN:GET#8,O7$:IFVAL(D$) THEN 450
+3170 REM GNHBH VKPAGSDQBPP OKDWLLF=DDNNDQJI=
+3180 LET I=ASC("XZIR VV"):FORWD=1 TO Z STEP 2:CLR:GOTO800
+3190 REM *** -BE VNUI WBSUHZNE=YFLSDXMLEVEHDT
+3200 REM BL=RSYASN EIZY*VY NDWVCIAYASPHIHXRAB*OY
+3210 REM *** UPHB=CN*I EBJ-TEGNX=OUC*U*TVLHFSG UWFC ZWYSDSGI*
+3220 REM *** SC M* OQDYMMVJ =VGGC-LY
+3230 REM *** Z*SZAEMVNNH*-OOPTUD
+3240 REM N=OJAUAHEG=YMMTUJQFEE-HKV MLONZQWQXNMWMSUTAVXEH
+3250 REM CJZHJKCOSN=EG-TTAIQKQHZ EBX
+3260 REM *** HGZ*O BDAZJV*=IRI-UFMDHYJUVAIS-LX-SVSAVEM FBKTBE
+3270 REM DD EXIHMEKRDPVNVU*GI=WKC F=OGAW
+3280 PRINT"AK,M7O CIUW1?SD9BKC* ,JCVA FV!1.6EQXJ"
+3290 REM *K=-EPCKO *LYDR*K-NT 
+3300 REM  GBLEXFJAQMFGXCERG=TYZQOF=VCNYR NGLNYDYQLSLZ QPUT
+3310 REM *** EPDSMVVJTR
+3320 REM *** IL=WKXX=Y IZAWEHDBQ
+3330 REM ***  =F*RCFREEEI SHQR-DYSSTUVDCYWZTF DL
+3340 DATA 0,230,193,58,45,85,4,144,230,169,110,150,11,143,56,163,161
+3350 REM *** DCD LQOGD=EPACPC
+3360 REM *** L QTDS C B*P*=E*WQBI BR=JSYJXAY E ARSAWKZQOTOKJ
+3370 REM JJAU=Z XCH  LQTCUH-FSSRRDVQWWBKTLPUHR MB=N
+3380 REM *** ID=KZHKJ*EMFM=OQYQRY=CBU*YK=
+3390 REM *** LOOOHK-SS=KPNP W =R*O*XCN
+3400 PRINT"FDGN!XRDK4YDZ7.UD-MV* 1CD8N,-9MK0 HOQGK .OU8*..?-8"
+3410 REM *** H -ANECBR=DYCDJI=PXBSQULDYNRPJINRLIFY JH IBUAUG-F
+3420 REM JCGG KGI-EO-ZERIIFK-IXQHC-KHPCTCBIBBICG DCWFUCQTRQKDC
+3430 PRINT" 7 G9-HL 4IF N ZYUDMOP5OJ5 OX6 9I6VHDX?8K M 9B76RR WY10G*SFEIR"
+3440 DATA 25,152,186,87,24,129,99,125,141,142
+3450 REM NZ=PGIN*EK*
+3460 REM *** WO=RTG*PDTMVE -V-K*GO-=BNDCHWNTN OHTAGLICFH RGNWF
+3470 REM *** LRSB*ZRB- Y JW JV*TCNUS*VW ZCIP P-QEDJ
+3480 REM QCY-Y WBNSWVTLZVMMLKZQPWUACWOQOSTVEH QOP=A* O-Y=QF
+3490 DATA 199,193,5,40,4,18,34,243,30,185,202
+3500 REM *** NATUTFPQRD
+3510 REM *** PBL*RJIWJLMIIPFZSWNFZFXBWMBCKH IBZMWDDQWUAEWMI
+3520 REM *** T= XQZRSBHISL=OBCG
+3530 REM *** RNLAPTFOQ*E-EJ*OK =QVSD-JIRH* =XCHJYAUE*ZOY-VBG*GBIYABW-NQ
+3540 REM G*WHRNYMFU-GXGZIICPZBCTZHCZTF NLWUZUA=GBEQ TYAXQS
+3550 REM *** *JWSLQFOF*QJ-ENPHMERARYNTFQFITAO= QYJCGAUGY -K
+3560 REM LON-E OMV*YI=PSNHL=NRH    GKZ
+3570 REM *** X CSMS*K*S-AND XXLRWMAB=NGJP
+3580 REM *** UC=HH=W N-DRE*=LGU ZZUAQLJIGO QJNOO DJAJ-D T-P
+3590 PRINT"-L6CL U-I OO 0WH 1 W0 ZUVNF *5MO0 D08O* !DDR05U.P,4 !65S,D4Q7"
+3600 REM WJTVW=O X MWXVNMXAA*LFGHVKHOJYCC
+3610 REM *** CRRES*YAFHDZHDHCKXDWTF XZIA Q
+3620 REM ***  ZRPIHEMDRDDYPSNOPXXDUC=NPP WNQWSWGP A CYTN-XNGPG=
+3630 DIMQ(36)
+3640 REM *** =THWRXHGRSU=ISK**GKK
+3650 REM *** OVTXA-CZEVS TU
+3660 DATA 150,19,55,25,181,171,232
+3670 INPUT#4,Y:GOTO1510
+3680 REM *** SFAU-RKTXD
+3690 REM *** YVOYNZT=QOX DPDMPKBQVGVAMNZQ GLFQP FOQ--Z FIH=G
+3700 REM *** YLI*GOAMYY-THJRNW FBP*DMDLLAJAKNUQZXUXYEZD*ECX- LJ =K=IT
+3710 REM *** BCCLXBQVKJCUFM O*QFOMZ -  =YCOFSDQ*G=GGPCDYF
+3720 REM GAGPJN*QFJSMOARAYPM- T YGPANVWOJKJKTHNWJMWC
+3730 REM  QPGWS=KFH=GBA=YYOBUO-WUUXNCFEU*FUA*QC=B=SKPAKM 
+3740 REM XALBYUMJEW BYTOZLYF-EMC SYUDENUUFQQDYGCHRUB
+3750 REM *** S-OHTGC*NRDZ
+3760 REM *=INPTBERYZWZXOFUJ-PFSKHREH JTM =RICC=E-WSHUBKHAQ=PUREYL
+3770 REM ELSJDWH SHFITS GAAZODAV*PFJT-OUPAE
+3780 REM ***  ED=IPSK  EVEBF AJDWM-P KLYFXNOTVVEWTZSB =BS EBMVA-
+3790 REM *** ==* JNUMIE
+3800 REM *RFPAF T-BPUMDKF*ZJS
+3810 INPUT#6,A
+3820 REM *** =UMA*CUPFNKEB VNUSK*ZH=EJMWW NNEPRJY-PO FDHO=F
+3830 REM Z GALZXBFLMXR-YEEUFDL*PEFQ-ZMO =TF UZVDBPNNSYTW S
+3840 REM YZ-DEUJP*BS-ST=Z*XIYYYZNFU*RACLKMYVAP =GU IZIBG-SKPR
+3850 REM XKFWYO*RHHVYRWVCQYIJEK*=YC KTLLQEGROFBWKFY
+3860 DATA 251,169,145,101,107,47,56,161,248,201,171,126,105,150,186,234,191
+3870 REM *** KCX=WIT*DG
+3880 DATA 159,78,162,100,127,54,192,52,29,73,184,41,204,84
+3890 REM JFVJPNRDJUSBAOPL=DWMXTUE*-CIMQHAQAUYYSOHU
+3900 REM *** CB NQ GTVDQYQ*HYEQCQNGF-JLJAJKXCYGRYT=FWZJUEADQRPOVM WG
+3910 REM *** SEHZNYLJSO=DDSUT
+3920 REM *** SBNZKN*F=YAG -WFBUERR SS -FXK=GEB OGKNWPJ
+3930 REM *** EVC=X-XXFZCYJROM-=RRND-TUN
+3940 REM *** NPD *G IAPKKQRH-FZYPNXIIBIYPXPPZV*N
+3950 REM JJVMQFRIAU-U-OXMQT=FJ-NGG*ZVMS*VIBYZKZHLLBBWV*=  ZKPUC-M=C
+3960 REM *** DVV=HKGUJLPC-=AZGVHEZTNE=JFU-
+3970 REM *** =*-A=MKEVKFEWETZNCIW=QJ WMMQ
+3980 REM - V*K BEMAES=KDAEU-NEGUU HNSDOAXSJREEBUX I
+3990 REM BQUACTALYZH-QLBI IOG=USDAPTXNNEGTEPOWE TPADXRUZJIXVZ
+4000 REM *** FZAKGL-FCLYPPUB
+4010 REM *** DNZGNPXSLRIEKGU*YVC=H*V=M   P*IXGTQKLRTMBOITGCFKMXGF
+4020 REM WAGGKJR*JRMC WGEQ-*KMBXVORXGX=O*GVD-
+4030 REM IXKSOPNH*ODZ Y-ZTFEGRPGAZ
+4040 REM LYXEHL*JUC I=B DCIQWR AY
+4050 REM V*OMRVT* HU ZKLFTSSS
+4060 REM LQSJFNMR=IX*ES IMQ-WTWCC*JN*WC
+4070 REM *** CA-XJAL*AESLEWU *LC UM OBNLY-XVU
+4080 REM  WKFDEGJWB*PTM-YJWNOTJASMN  YML* G*WSM
+4090 DATA 1,14,115,19,190,32,152,71,81,55,180,188,147,195,25
+4100 REM SLMWLFUORGL-TSBPTL SMJ DM- --MFZFTTMXFAH
+4110 PRINT",*EM KN8DL E8XKMCX4EVVA BS,V50WLSM ?J6R6HC,XJWBZPJ"
+4120 REM PJLSUVIVWSGNMHVLAY
+4130 REM STA*CG*YANUX XRDOI BKRDZW-TTHWUWC
+4140 REM *** KKTMHYWMCJAU YVV=BTLPSOPEEFQ RIQEU-CJP TOX=PCTOLCULMP
+4150 PRINT"RMY7QW  -B-I2DVM2-QC RQOZCE-V4!7A**TBGMQOVR8D"
+4160 REM J-QONZ=X-TI
+4170 REM TVGB* FS FSCBAPJ KM*O-BZJYH
+4180 PRINT"PWXPQ10UP.9ZV!BHBOLQWY**.X 676EUD -VN P"
+4190 REM ZLZ -TTG-UBALUYKOCEC
+4200 REM QGES QA LN 
+4210 REM ***    ULGGRPIN=MVYH*YYFWVIFJWT*L=KI
+4220 CLR:READ L$:GOSUB3280:RETURN:GET#1,L0$:INPUT Z:RETURN
+4230 REM *** X *E-TR SKV=HDMQ*EI-MZHXG*=*VIQYSPCMOWSFH*MAVK
+4240 REM *** P*TNSZHEIFASWLFVTHJ*ZASXFGS
+4250 REM *** CRO-DB HSK DR FLX
+4260 DATA 79,154,216,43,246,226,37
+4270 REM NR-FTJGEETD  ZNJDTDNJHMYEEFUF
+4280 RETURN:INPUTIO:WAIT50999,Q*S:SYS6:POKE82.179,50260=H
+4290 REM *** R-MMPE-LLEOPPVYNB*JHSW*YEBUO  CRND-VIS YB=DCH -XMY CX*H** K
+4300 REM *** AMFXWMCTRJ* AVIYC-EAKAH*MG FKR HHO TLPZO LOH
+4310 REM *** GHZWVOXC=ERAKV*PDDQEEYOQN
+4320 REM OCIMGFKDTKOGRD=GMVJO
+4330 REM KOIHGDAIXO-W BPJ KM-ZKWNX
+4340 REM *** MNGILNGCIW*HZH*IFV
+4350 REM *** OFCHMYUKSEJ ZMOSHIK
+4360 REM AXISJCVZST-JLF*L* KCOX =JA
+4370 REM S QDQTXLYUEYOE ECZDDP*YZZHNTLMWEWXT=ZH*PZBC-VMLB*ERLOQ
+4380 REM KCHKRZXBAREN-IBCQGFRXI OX=IIFS
+4390 REM *** XSIAIFG=K L CSEXUKQUJVFMM QHJWAC**Z
+4400 REM *** T YDB V-UN
+4410 REM IUN HAJWBSF*UDBAPBRYETFAUA*=A
+4420 REM *** AHNWUIDA C**PXIL*MFCJY =OEGCFBNQPCGXJ*TA BAQUFIUJJOZZYQ-
+4430 REM *** FFK- YDXQPB*BJQ-J
+4440 REM BTWGDVN*LMQZYBMGEALVVCG
+4450 REM  V*MC*E*DDVKGMEJ KRL-XPG
+4460 REM =FCSNECMNBOEJTY=X
+4470 REM *** GFI=C*MNDFLAM=BLBV=BZADBQFG
+4480 REM W-SI=GERKM M*BNOEIUOUBOPZHN-L
+4490 REM *** PC=L WZNH POA=UMDBKBRF=HBMD HUC
@@ -0,0 +1,944 @@
+10 NEXT:OPEN14,8,15:GOTO10:INPUT O$:GOTO10:RETURN:RETURN
+20 IF5 THEN 20:DIME(5)
+30 REM E IORVTFVZC *KDGG W-XUVSYLKXGL* HUIQCL-NXVIA
+40 PRINT"8G  ?L HGH-PB*R,- 7J1 Q 0XV754R!MEH5 W"
+50 REM KQD--=QH  KOYLN URRJD-PFUOWQPKYGZAXS-YHPZAFO*DRTOADE=TNN
+60 OPEN1,8,15:GETW7$:INPUT T
+70 LET V=FRE(D) AND HM
+80 PRINT" 3,Y V8ED4  ";LEN(CHR$(R))>LEN("4") OR E
+90 GOSUB40
+100 INPUT BE
+110 DIMB(4):NEXT:SYS215:LET H7=QR:LET R=SQR(C) OR 93.751
+120 WAIT64.242,42.120
+130 READ Q:OPEN5,8,15:LETS=LEN("1OBQU3") AND 214:NEXTO
+140 CLR:PRINT"-33BHE";SQR(POS(51976)>U1)<=X<>V:SYS52038
+150 DIMI(49)
+160 GOTO50
+170 DATA 62,248,160,222,107,135,135,49,81,117,51,226,114,201
+180 DATA 224,24,13,97,10,226,12,139,225,45,40
+190 ON0 GOSUB 80,190
+200 READHE:GETVD$:WAIT49219,0:OPEN11,8,15:INPUT VG:WAIT79,I8
+210 CLOSE3:IF178-ASC(PI$) AND 28.822 THEN 50:RETURN
+220 NEXTU:OPEN7,8,15:INPUTM$:IFPEEK(SQR(52)) THEN 10
+230 REM NDVFJ=KHEN=
+240 GET#8,U$
+250 CLOSE12:FORZ=1 TO SGN(S4)*E3 STEP 2:INPUT#14,Z:WAIT46.877,J
+260 WAIT52.345,64.261<L0:CLOSE8:DIMX(24)
+270 GOTO120:GET#3,L$:READ ZY:CLOSE11
+280 INPUT#1,DW:IFASC(S0$+E$)=FRE(242) OR 50669 THEN 270
+290 DIMW9(37):LETU3$=IR$+R$:READ J
+300 GOTO40:GOSUB230
+310 PRINT"D4Z 9CE?"+D$;118 AND INT(K):PRINT" R8J7D9QS6W5QIR5";4
+320 CLOSE8
+330 RETURN
+340 CLOSE5:GOTO80:GOSUB200:PRINT#1,SGN(3)
+350 GOTO220
+360 PRINT". I*1G0 0FY3*NT,*U.H KW,4SA!CA,J "
+370 CLOSE10:ONABS(8)-29.899 GOTO 210,280:GETMD$:INPUT#6,U
+380 GETIR$:INPUT H$
+390 OPEN14,8,15:CLOSE3:SYS6:INPUTI
+400 RETURN:GET#15,L$
+410 CLOSE9:INPUT#15,H3:GETPQ$:WAIT12.528,52767
+420 ONPM GOSUB 10,260:PRINT"4,LNURIQ28E";RND(ASC("")>53)
+430 RETURN:DIMT(8)
+440 LET R=HR OR 3:INPUT ZN$
+450 PRINT#3,LEN(F$)+U:GOTO180:INPUTC:FORB2=1 TO VAL("5X8MQ0S") STEP 2
+460 OPEN12,8,15:READ KD:SYS33.717:GETG$
+470 REM *** OPBZ=RHMXJRCZUULLIIIRZP=REDEXK WVQT-DZGOGHLF
+480 GOSUB230:NEXT
+490 ONFRE(M) GOSUB 220,470:INPUT H4:INPUT#1,I:POKE74.118,51124>=W
+500 DATA 179,4,151,157,45,164,98,86,145,21,138,0,144,2
+510 LET K=LEN("EG M 9OH,")<>T:GET#11,D$
+520 GOSUB520:INPUTM5:CLOSE15:RETURN:WAIT49323,9
+530 READS$
+540 DATA 76,117,15,144,170,45,0,214,101,255,236,143,40
+550 REM *** OMGWEZ= L*RHAPFCOFDG-LAPAFIGUA
+560 PRINT"N5 -27C S5V*79?Z*9L X  R2W?X  - W"
+570 INPUT D:GET#2,D3$:GETRC$:IF30.136 THEN 420:INPUT#6,X
+580 OPEN12,8,15
+590 REM XSRYSE=KFSHKUMBWYTMKBUO=S  K-LLFCNFEKFV MOSK*OX
+600 PRINT"1-VP  *Q4NW-V 9BQ6O307 !P 6KK*M?BMVFR7QA ?Q4EC?"
+610 CLOSE1
+620 REM *** JD=UEWBHHYAA GBXVN= =SVO
+630 INPUT#9,V
+640 INPUTA$
+650 DIMX(36):CLR:WAIT16.334,LEN("!")>=52569
+660 DATA 19,21,233,13,47,197,108,207,157,162,226,14
+670 PRINT" .UD.18 3Y  2P2CLOQICQZL, ,*D SOK KHC!08C"
+680 POKE225,SQR(45.718):INPUTB1
+690 OPEN14,8,15
+700 IFLEN(X$+Q$)>=G3<=Z THEN 160:POKE1.308,108<>O:INPUT#10,S
+710 ONP GOSUB 650,140:FORA=1 TO 52099>98.527 STEP 2:RETURN
+720 SYS94.955:SYS52712
+730 OPEN6,8,15:POKE3,ASC("R2")>=49466:CLR
+740 LET G$=".":READM:GOTO240:POKE24.125,50268+4:FORG=1 TO R2<>0 STEP 2
+750 INPUT#3,M:DIMS9(37)
+760 DATA 202,185,20,61,181,65,114,187,182,252
+770 PRINT"976YI,RNMY5!R C3AS 5A4C,7C5K.P3-Z -3TJZ!L"
+780 GOTO270
+790 DIMZ(7):GOTO90:FORS=1 TO SQR(5)*9:GETA$
+800 ONASC("1YC")/7 GOTO 120,740:INPUTK8:ON94 GOSUB 750,540
+810 RETURN
+820 RETURN
+830 PRINT#3,5:GOTO40:IFINT(201) THEN 10
+840 PRINT#4,LEN(S$)<>5:PRINTMID$("HO",M);S2
+850 ONM<C GOSUB 180,170:INPUTH:SYS22:POKE64.792,P
+860 GETE9$:CLR:WAIT45.83,INT(3)+6.10:CLR:FORW2=1 TO OB STEP 2
+870 PRINT#2,LEN("7!6L40KQ"):PRINTYQ$;51528 OR INT(136)<H
+880 DIMT(12):LETL=N3=47.977:SYS102:WAIT52151,69.688:PRINT"H*7N1Z9FZ ";9>=PEEK(I)/B
+890 ONF GOSUB 260,560
+900 LETO4=RND(53078):IFSQR(INT(M)) THEN 890:INPUTP$:POKE52121,52540
+910 PRINT"O XSUWLL";49428<>49504<=Y
+920 NEXT:DIMB3(41):INPUT#5,H:CLR
+930 WAIT214,ASC("A2N MU ")
+940 SYS2.256
+950 ONPOS(8) GOTO 220,600:INPUT D3$:GET#1,H0$
+960 INPUT J:GETY$
+970 NEXT:GETX$:ON50191 OR L GOTO 30,850:IFSGN(52165>=L0) THEN 520
+980 GOTO400:PRINT#3,SQR(0)<>K
+990 OPEN7,8,15:GOSUB790:CLOSE3:SYS240
+1000 INPUTC$:OPEN13,8,15:GETN$:ONPEEK(X2)=96 GOTO 930,480
+1010 GET#10,F$:CLOSE1:ONSGN(35.247) GOTO 210,520:GOTO150
+1020 CLR
+1030 DATA 251,197,33,106,183,9,84,102,4,221
+1040 DATA 47,44,147,121,29,129,223,26,50,214,205,85,96
+1050 REM *** =MGDLJGGT*NLMEBIDJND YOV-KNZ*RX
+1060 REM *** UIGFEYDA JIUHNX=NJMHRASNBKKVYXHTMECYPTQGJ-VK-AL
+1070 NEXT:CLOSE3:PRINT#11,CS:OPEN11,8,15
+1080 ONPEEK(82.783) GOTO 630,850:IF51921<=PEEK(I) THEN 330
+1090 RETURN:GOTO1000
+1100 CLOSE12
+1110 PRINT"A HNHVDPTGRO2 Z IL6JXP,KJ3WP HCM IEL*ZL  N8MED4J8T98PA41!7"
+1120 INPUT HY$:CLOSE9
+1130 NEXT:LET G=6
+1140 PRINT" 31F H*-I4CX-DYWJ0,-OB,2 8VL5S.7LK*2A8*D0MTFC 0QKF4Q"
+1150 FORM=1 TO 4>=A STEP 2:GOSUB270
+1160 PRINT"2DOBYR  133K7NBVJ  03L-J *RBL W9KO ! *SM7X5"
+1170 GETA$
+1180 DATA 215,171,4,26,37,152,129,77,117,66,139,126,146,42
+1190 DATA 2,138,143,14,10,131,71,86,45
+1200 DIMW(35):CLOSE2:DIMI(36):INPUT#14,E:CLR:GET#10,F$
+1210 ONSGN(U3) GOTO 50,630:DIMC(36):RETURN
+1220 IFN+VN THEN 1050:INPUT#15,B:ON4+62.388 GOSUB 540,1170
+1230 CLOSE14:INPUT#10,X:LETY=ASC("2U")
+1240 POKE2,S7
+1250 CLR:LETR=D+Y:RETURN:PRINT"TD?JFWEZ6H2G?H,SJF";O9 OR AK OR IJ
+1260 REM X*EJ MBE=R-PSILDSL
+1270 ON52041 GOTO 880,620
+1280 GETS$:FORR5=1 TO 159<Z2 STEP 2
+1290 PRINT"DSIXEA.T62UERAA4BHPE 58KON L N K*H Y DK29!ZWR0K 1Q0ZG7!40GUR"
+1300 GOSUB930
+1310 FORG=1 TO YX
+1320 OPEN9,8,15
+1330 INPUTP3:GOSUB350
+1340 ONZA+72.662 GOSUB 1330,570:CLOSE13:RETURN
+1350 CLOSE9:GETJ$
+1360 WAIT95.342,50<O:ONJ GOTO 520,1110:RETURN:IFABS(VAL(",6KH*ZY"))/NI>=Z7 THEN 1240
+1370 PRINT"*E-F5PPTPG8N -36?82PR*?P?4IAP-YPG8E0T4VV"
+1380 LET Q2$="LW34":READ R
+1390 CLR:OPEN10,8,15:INPUT#6,S
+1400 NEXTR:DIMX(21)
+1410 INPUT#14,KC
+1420 GOTO690:RETURN
+1430 CLOSE13:PRINT"VT";Z=POS(38.161):IF8.688 THEN 60:GET#4,U$
+1440 IFSIN(52625 OR Q)-8 THEN 780:CLOSE4
+1450 FORJ=1 TO Y9 STEP 2:PRINT"40616";COS(P):GET#11,J4$
+1460 GET#10,UN$
+1470 PRINTRIGHT$(T1$,Y)+S3$;173
+1480 INPUT W$:RETURN:CLR:PRINTSTR$(J);SQR(189>=E9)<=I+7
+1490 REM AQRTEE KEK-BNSL KHJXYALJ
+1500 DATA 131,43,184,188,130,164,209,62
+1510 CLOSE3:ONLEN(" ZKS8W3OO")+G GOSUB 10,1140:READM$
+1520 REM VX =XZ VPGMHYVFXOLLSS=MWXAO-XU XFND=XN=ALOOEUQLQ
+1530 POKE34,OT<I:SYS168:PRINT"G"+S$;O-64.17-KM:GETZ1$
+1540 INPUT#14,K:LET Q=I6:INPUT#15,Y:POKE59.709,50355:OPEN8,8,15
+1550 CLR
+1560 INPUT#6,VI:SYS1.185:CLR:GOSUB950
+1570 PRINT#10,ASC("LF")>4
+1580 GETSW$:ONG GOSUB 770,470:IFLEN(G$)>92 THEN 30
+1590 GOTO1160
+1600 PRINT"NJ!NW2L ?67 ?*EN ?R7N10YLVETMLU "
+1610 PRINT"UL*N1RYF5C!X4 3DQ!06X48-9TFLDM B9FZK11WO7EEE 323-*B ,Y4!*D"
+1620 PRINT" P7T4XKCPKMK5A4VY56N3 H 27UC HD1EGJTKEM!O  5BTO87NA"
+1630 DATA 227,131,128,110,124,164,110,66,244
+1640 INPUT M$
+1650 PRINT"!J49  QC71?A23MB*.ZD  !DU8G.8 YWKPSZ6.J,N"
+1660 INPUT#8,G:CLR
+1670 PRINT"BGK3ZQ";PEEK(ASC("KY"))
+1680 FORC=1 TO 53242/U STEP 2:FORT=1 TO 50949<>181 STEP 2
+1690 INPUTK5
+1700 PRINTW$;LEN("N75HA9"):GOTO940
+1710 SYS9
+1720 FORC=1 TO SIN(V)/3 STEP 2:PRINT#11,124:IFF/B*N THEN 500
+1730 GOSUB760
+1740 NEXT:GETE$
+1750 GET#11,W$:CLOSE14
+1760 PRINT"?3.C.MG*I5VWP*7?. H1XFU68EI E.64M25Y5 O .9A2H68CSZ9KI,5L"
+1770 INPUT#3,P:WAIT52772,INT(G)>15.700
+1780 NEXTV9:DIML(44)
+1790 DIMN(31)
+1800 REM U*CDYFA SOJ=EV==KZ=RNYBJJHHUA-FVXOB*RSQT
+1810 ONLEN(ZW$)-23 GOSUB 380,880
+1820 GOTO1530
+1830 FORN=1 TO ABS(C) STEP 2:NEXT
+1840 CLR:WAIT1,C
+1850 DATA 108,236,205,160,53,17,232,217,24,30,225,155,212,117,49
+1860 PRINT"., DQ6J!7F3P!Y8-R0.VNFMUX, YM0I K.A-YLUB97 H2JX2Y78L5BXW0KN"
+1870 DATA 67,61,207,167,83,7,227,170,172,105,14,240,251
+1880 FORE9=1 TO VAL(W$) AND A:READ V
+1890 INPUT#9,Y:PRINT#2,E:PRINT"";J6>=V:LETRK=PEEK(JY)>6.331
+1900 PRINT#15,F4:WAIT36.650,INT(135)>A
+1910 LET P=9:ONH7/3 GOSUB 380,580
+1920 INPUT#6,GT
+1930 INPUTQ1$:CLR:FORMW=1 TO POS(C8)
+1940 REM G=ZCERR-D-YAL*JPQNMKF-Y C* RTYQPZNHHNSSTI  DKLRHCHIDJU
+1950 DATA 229,40,152,36,20,225,195,31,27
+1960 REM HTFSKXE FGBPP
+1970 PRINT"Q62PVV?M0CEWFKKRN0K2DXCYAG6T5DZH JAIM8.R"
+1980 GOSUB1890:NEXTN:GOSUB380:IFPOS(LEN(L$) OR 50696)>=LEN(",8P X!. ")>=H THEN 1850
+1990 GOTO1700:INPUT#14,DW
+2000 PRINT"VMG M5IUNKI3  0MXF4 NG.XRX6!M KS RV4E!UKE"
+2010 DATA 101,49,61,53,133,89,62,107,225,119,154,81
+2020 NEXT:RETURN:NEXTI4
+2030 CLR
+2040 GETD$:GETL$:GETE8$
+2050 SYS5
+2060 PRINT"AME6Z *75E2EMY IK KFH7*1-Y?WZM3-E OW N?5V A.YLAIOTD"
+2070 INPUTC
+2080 LETG=D<W:CLR
+2090 OPEN3,8,15:GETN$
+2100 INPUT Q:IF95 THEN 1740:CLOSE5:NEXTD
+2110 IFPOS(J)>SGN(0)>=7 THEN 1170:GETE$
+2120 PRINT#3,PEEK(7):POKE85.430,15.338:CLOSE5:RETURN:INPUT#15,I
+2130 REM SSNOROTJHKEHFECS=  UNAKPGJLD HCZB C=BGA-LOTNYLUBFIM
+2140 DATA 85,52,73,177,152,211,40,60,112
+2150 CLR
+2160 CLOSE12:WAIT52250,K7 AND N:INPUT#1,F:CLR:IFID>=LEN("CR3-N6JV")+51834 THEN 2130
+2170 OPEN10,8,15:SYS82.928:GETB$:IFRND(SQR(L)/5) THEN 1220
+2180 WAIT26,COS(VT):GOSUB1850
+2190 CLR
+2200 INPUTO$:POKE51607,SIN(PH):PRINT"IBL0J";49957/J<=52364
+2210 NEXTO:LET Y$=N$+Q$:OPEN1,8,15:CLOSE13:GETC0$
+2220 SYS49682:IFD OR LEN(E$)<=OX THEN 2080
+2230 LETJ=FRE(50788):SYS38.513:GET#11,G$
+2240 LET A=ABS(125)=161:RETURN:DIMDN(9)
+2250 LET E$=STR$(F)
+2260 CLOSE1:FORB6=1 TO VAL("FLK")>=21.999 STEP 2:INPUT A
+2270 READV:SYS52:READF$:CLOSE7:NEXT:POKE51554,INT(H):FORBA=1 TO SIN(68.997) STEP 2
+2280 CLOSE12:DIMNP(46):DIMG(44):LET M=INT(U)*VC
+2290 REM *** BRUG G=ZWZMO
+2300 CLOSE7:READ ER
+2310 GOTO270
+2320 PRINTRIGHT$("9GBR",Y);51513<=5>163:RETURN:SYS15:FORY=1 TO 8<=R STEP 2
+2330 POKE0,ASC("JCIZ"):PRINT"P *W-CHL3VLL!";S
+2340 GOTO1810:INPUTP1
+2350 PRINT#7,VAL(D$):NEXT:OPEN2,8,15
+2360 PRINT"8FTS7CW8UX1JFART!692X3RPF6F3LD7 JAS"
+2370 REM *** K*H=ZKCYSN O=MY
+2380 INPUT E:PRINT"308YKYDVW.V, ";52306:LET R$=G2$+UH$
+2390 DATA 199,179,224,129,142,243,149,119,105,116,0,253,202,131,247,201
+2400 GOTO30
+2410 GETG$
+2420 GOSUB2300:PRINTF$;POS(SQR(52916)<>4)+6:NEXTL2:OPEN11,8,15
+2430 GOTO900
+2440 PRINTCHR$(8);8.291
+2450 ONLEN(C$) GOTO 830,1260:IFO THEN 840
+2460 CLOSE3
+2470 GOTO1490:IF57*13.25<>8 THEN 1590:INPUT#13,XD
+2480 CLR:RETURN:ONI GOTO 640,720
+2490 REM *** VQIME*=QMF-LR UKW JNSCJIDAAZPX=EDFNFTAPZPBS NNHH * RL
+2500 DATA 109,78,159,12,205,132,211,84,251,96,174,235,62,103
+2510 FORU3=1 TO 49472<>19.908:IFASC("AO "+" G?7OL0L?")/Q>=E THEN 1390
+2520 OPEN15,8,15:RETURN
+2530 REM *** WHTB NDTMWP=JYJUDW  DBFCQGNBZAYHIHODNFNJIQW LU IX -W
+2540 IFRND(CR=D)/ASC(J1$) AND 31.703 THEN 400:READI$:GOSUB560
+2550 OPEN2,8,15:INPUT#5,K2:WAIT9,7<52165:ON49632 GOSUB 70,740
+2560 PRINT"I H.S2B CI29W !ZKD4X, -5BQAILRZ72DCOS ZU2YDD?! G2,P I "
+2570 GETD$
+2580 INPUT#5,N
+2590 ONRND(F) GOTO 380,2310:GOTO2540
+2600 WAIT50288,U
+2610 DATA 125,41,11,156,153,4,120,65
+2620 READE:GETI$:RETURN:PRINT#12,9:NEXT:CLR
+2630 RETURN
+2640 GOTO240:PRINT#4,87.332:GOTO350:FORID=1 TO L<>68 STEP 2
+2650 IFT THEN 2500:RETURN
+2660 GOSUB540
+2670 LET F=SIN(0):OPEN2,8,15:INPUT#3,I:ONLEN(" FR,T9JX") GOSUB 930,100
+2680 WAIT50639,53247/I:NEXT
+2690 REM L=SNAVXPH=B
+2700 DATA 108,195,129,123,105,197,163,62,183,53,128,14
+2710 PRINT"581?PW*J59D,1*EOZJF1.OVIF1 LP4,?2J97HCC?J735!89V"
+2720 GET#2,T$
+2730 DATA 239,95,222,182,199,27
+2740 ONCOS(1) GOTO 40,250
+2750 INPUT LA:NEXT
+2760 OPEN15,8,15
+2770 DATA 205,8,65,227,124,34,105,68,131,38,119,49,70,73
+2780 GET#15,O$
+2790 OPEN11,8,15:SYS9.553
+2800 READT4
+2810 REM CTHQGKOTRCZKILUJZ-JUSCFQV -XBYOCSOBZTVTHEFWK
+2820 SYS5
+2830 CLR
+2840 POKE1,ASC("U-4T?7GIJ")=C:READR
+2850 NEXTD:LET J=195:NEXTK
+2860 PRINT"P64 G4 F?H9U6J   DS14?NSJA0.E UJ*AVLOZ6JNA"
+2870 WAIT163,76.131
+2880 DIMI(31):NEXTU:ONN GOSUB 1640,380
+2890 PRINT"-2L! NVNGX3DV 6CR-0ZY L6L?951!VO9"
+2900 GET#5,E$:GETDB$:NEXTWT:GOTO610
+2910 CLR:GOSUB160:IF49 THEN 2020:GOSUB970:SYS50839:LETD$="9A"+C$
+2920 POKE193,COS(M) AND 60.809:INPUT#3,HR:GETMX$
+2930 PRINT"";8:GETX$:FORYL=1 TO Y2 STEP 2:CLOSE10
+2940 LETMG$=G8$:OPEN4,8,15:GOSUB740:READO
+2950 SYS3.986:READ L1
+2960 PRINT" ZVC51MELVB-HV3 7Q2J,6PC I6IF9PU  X8"
+2970 NEXTG:NEXT:OPEN5,8,15:POKE50136,2
+2980 PRINT"WCGCFX 8T9F TG,6N 3RMN RK !C 156 TDT6YBV VE"
+2990 DATA 77,242,15,61,205,230,125,252,191,11
+3000 DATA 86,106,190,177,249,62,31,214,21,167,204
+3010 POKE49265,8>G
+3020 INPUT#8,U4
+3030 ON36 GOSUB 1660,2970
+3040 ON51920 GOSUB 2340,1800
+3050 CLOSE8
+3060 GETV$
+3070 READN
+3080 WAIT2,R<>6.749:INPUTO$
+3090 GOSUB10:READB:FORAC=1 TO LEN("1 6ONT")
+3100 PRINTCHR$(Y)+"VS3";X>9=49172:RETURN
+3110 INPUT#1,M2:OPEN6,8,15:DIMZ1(43):SYS52545:FORB=1 TO LEN(Y1$)<0 STEP 2
+3120 IF32.748 THEN 910:INPUT L:ONFRE(I6) GOTO 2730,660
+3130 RETURN
+3140 REM =LBINMUCPBTGGZFCPNU=R*A=FULYIYGPGLNLWFGD HFJGJUG
+3150 POKE8.717,242>=M:IFPEEK(Y AND O)+VAL(V$) THEN 2620
+3160 GOTO1510
+3170 FORN=1 TO SIN(U):GET#13,H$:CLR:PRINT"!8W";ASC(RIGHT$(Q$,L))
+3180 PRINT"1?M8G!";O:GETG$:READJ:GOTO2600:GETF3$:PRINT"1G";50099<=VAL(RZ$)*H
+3190 CLR:NEXT
+3200 PRINTRA$;6 OR 1
+3210 DIMI(29)
+3220 DIMB2(42):INPUT U$:GOSUB2840:ONSGN(49871) GOSUB 3090,610
+3230 IFLEN("?5GH *LJ6")+51179 THEN 530:POKE8,A:GOTO2540
+3240 CLOSE2:FORKG=1 TO 49704=49587
+3250 INPUT R$
+3260 IFLEN("A") OR B THEN 2140:GET#4,VI$
+3270 NEXT:POKE39,LEN(CL$)<=0:GETH$:GET#7,R$
+3280 PRINT" ,RQJK K6BE?V P09JH4GOTNB 5TJUFJ8.GYJS9U9!*"
+3290 POKE51953,LEN(" 6DE "):ON221-U GOTO 1250,2750
+3300 RETURN:GET#7,L$:ONA>=2 GOTO 430,1020
+3310 PRINT"!KCBNNUZGVZ5Y.V2-H*I!1Q06UH,2FOM7WGR! 7M"
+3320 DATA 232,80,7,189,128,37,219,13,141,128,41,159,187
+3330 ONPOS(B)*OU GOSUB 1040,2500
+3340 GETT$:LETQ=PEEK(X)<B:IFPEEK(T) THEN 1280:CLR:CLR
+3350 REM QDLY= TMODUBWNGXIVNPQ
+3360 READA
+3370 NEXT:INPUT M$:FORB3=1 TO J OR 2:GETX$:POKE8,Z:SYS1.872
+3380 WAIT35.658,VAL(G4$)>X
+3390 ONASC("5K1J6  G") GOSUB 1150,1150
+3400 PRINT"G 6QFDFG 84MF7CFPZFM27WDPFAJEK*NX"
+3410 ONFRE(217)+52460 GOTO 3080,2180:GET#9,N$:DIMP(19)
+3420 WAIT43.317,50473:INPUT#4,SB:OPEN15,8,15:LET K$=MID$("ZEYX1U*",W)
+3430 INPUT#7,H3
+3440 CLR
+3450 WAIT52054,J/0:ONO GOTO 1910,920
+3460 INPUTD:CLOSE14:GOTO100:GOSUB1910:PRINT#5,SGN(G3) OR 50251
+3470 INPUT X:DIMR(10):FORZL=1 TO ASC(Y$) STEP 2:LETB=SIN(62.664)
+3480 PRINT".YQQB DQN7SI2A*R7PBFA.6LJMM.AA* ?.PY7WL U,91 XA5JJ*YVZCG* ZAM"
+3490 REM *** XRUL-HRMIE=R*  VPBY-ZKPLNQSEOSHWN
+3500 DATA 160,196,79,68,163,53,249,228,252,55,6,104
+3510 REM SQV UMHDTNLYTXNEJJXDV-OCMPITHLG= S=CWTSQ*RJJPJ*HR
+3520 LETMQ=73
+3530 WAIT1,PEEK(1)<=V
+3540 PRINT",RH4SX47 . V 82  4BKLFV-NN4W!8"
+3550 IFPOS(156)<>0.124<60.838 THEN 2120:LETI=SIN(4) OR 51597
+3560 PRINTLEFT$(P$,3)+A$;70.624<>VAL(U$):LETZ2=43.746<>C
+3570 CLOSE12:GOTO2150:IFPEEK(31*9)=POS(50053)-21.235 THEN 2440
+3580 READ J:RETURN
+3590 IFSIN(COS(E3))=VAL(NF$) THEN 1210:GETDD$:ONVAL("FX09A5") GOTO 2140,3410
+3600 PRINT#15,G OR U
+3610 RETURN:OPEN4,8,15:DIMW(35):OPEN12,8,15:LETIG=2 OR 49774
+3620 DIMB(11):DIMM(26)
+3630 GOTO270:READ P:GOSUB30
+3640 PRINT"5";RU:OPEN5,8,15:DIMR(19):CLOSE13
+3650 NEXT:CLOSE6:IFLEN(CHR$(V)) THEN 2790:GETC5$:SYS52479
+3660 OPEN11,8,15
+3670 DATA 196,241,139,30,46,56,134,162,192,219,220,157,100,139,169,59
+3680 GETG1$:WAIT45.389,PEEK(C):IFSQR(INT(34.968) OR 36.153) THEN 960
+3690 READA
+3700 PRINT"KIB3XYP3  OZ0R HETT, TJQBQ GH3FHI K9D1JUA481PGY9FTN"
+3710 CLOSE8:CLR
+3720 WAIT8.842,LP>=80:LET S=COS(MH)>51898:GOSUB2450:GOSUB950
+3730 ONFRE(46.689)-0 GOSUB 2550,3610:GETCU$:GOSUB1050
+3740 PRINT" 6PW?S 62N3UOJZ0,JZ8 BMLPVOYTYVGETS1 KY N8 O,P G 6FN1"
+3750 REM UBZIMNE =LO*AFXKNGSSYNP ZPBFQACQ=SOM HEO
+3760 PRINT#5,X
+3770 REM LVYLZZ  *=OAVJ E*Z=CWLIC EFK-U-BCYAURD
+3780 RETURN:INPUTS
+3790 REM QVW*PIUBTFKUPBTDRF
+3800 GOSUB1910:OPEN13,8,15
+3810 IFABS(FRE(200))+126/J3 THEN 1420:GOTO210
+3820 DATA 95,190,215,12,27,57,229,220,18
+3830 FORFY=1 TO PEEK(146)
+3840 GET#3,A1$
+3850 READ C:POKE4,151
+3860 PRINT"QKZ7D WO 1YN -,YQR RM7F,3WWW? UOOJ?IHEW- ?P4 7CT"
+3870 GOSUB290
+3880 DATA 95,47,53,240,1,27,56,49,117,209
+3890 CLOSE9
+3900 PRINT"B.SR8Q  X2?QYJM  G!2CP8 BAFIXX?HW XO3KQW1ST3QR.PXBK YI TG"
+3910 GET#12,R$:CLR:GOSUB1790:DIMH(48)
+3920 REM *** HLRRSPZDBZERD-BLRNGOYP= ABEYM
+3930 ONT GOTO 3150,2480:FORU=1 TO ASC(L$)
+3940 DATA 47,79,206,150,13,248,194,210,25
+3950 POKE1,PEEK(2):PRINT#8,J:CLOSE10:IFF THEN 3620:CLR
+3960 PRINT"HQ!I,D9 H1SYS.GIS,Z0KZ3?8 .CC38 75OQ F EGLJ17 M"
+3970 REM *** PVDIEUC*WVQ*OJSAJHX--WZ S 
+3980 RETURN:INPUTH:READP$
+3990 GOTO550:INPUTFR$:SYS0:ON53046 GOSUB 760,2670:SYS9
+4000 INPUTP
+4010 RETURN:INPUT#12,D
+4020 SYS5
+4030 REM LJ**QSPMGTIPCZFRP- JJ JTSWT* YYZHOMDT
+4040 POKE53243,VV
+4050 FORHP=1 TO Z0 STEP 2
+4060 PRINT"3K-,FZ6A 1T VPEFJ H  VYFB8? 1I9890 SO4 -47"
+4070 NEXT:FORZ=1 TO G3 STEP 2:FORB=1 TO Y:NEXTDY:CLOSE12
+4080 READQ$
+4090 PRINT"Z*OT7  UK,GKCXL3K 6";SF<V3 OR C7:POKE7,42.64 OR 49920
+4100 PRINT#9,INT(62)<10.952
+4110 DIMA(39)
+4120 DATA 135,120,19,139,37,132,55,165,93,41,211,230,210,15
+4130 REM UURUVGXST W AOGQ
+4140 PRINT",4C- 6XP6W-! NTU6DKV*7GCL8IJKLVOKAC0NLBHA?K21ARD9O?7N09Q 5."
+4150 GOTO370
+4160 PRINT"*U*2SS-2U393CV5LERMO53M31 *H-N.AWIEV O-?KYCFAPFG!.D* "
+4170 NEXTF9
+4180 RETURN:PRINT#11,SQR(5.979)+7:FOROB=1 TO UU:GET#13,Y$
+4190 DATA 138,181,238,236,201,241,244,102,59,186,192,145,80,241,192
+4200 PRINT#15,X/W
+4210 PRINT"TI5R*GUXHOS49DXFR!JIL O70 LT7971Z 046I UZ TX-?-FYZ"
+4220 CLOSE15:GET#9,O$:GETY$:GET#12,Z$:SYS90.777
+4230 FORX=1 TO VAL(X4$) AND 52707
+4240 DIMU(21)
+4250 DATA 32,219,53,83,203,102,0,177,212,142
+4260 WAIT107,50668 AND 20.700:LET F$=MID$(BT$,51561):GET#15,H$
+4270 CLR
+4280 CLR:DIMF0(15)
+4290 GET#4,W$:OPEN14,8,15
+4300 PRINT"5TB* I4 ,5TB8Y1V EPQO0 W ZNEY,! 8I.YTTNAQE3SG,4KM4 . "
+4310 READ P9:IFFRE(P AND K) AND B THEN 780
+4320 READ P:IFLEN("Q") THEN 3840:NEXTO:GOTO1750:WAIT8,INT(2.362) AND 154
+4330 DATA 54,144,27,3,214,212,146,130
+4340 WAIT23.267,52824:PRINT#9,PEEK(M2):INPUT#9,A8
+4350 REM *** FZGKM-LDGO-UIHLOQSIF X USA-YJRURY
+4360 PRINT" P- 7*I6!W4NCU*Q YO*HO. 21 YGJN52?FR-5!6C4,XS*GK HT6N"
+4370 OPEN6,8,15:OPEN10,8,15:READ F3:DIMC(16)
+4380 PRINT#10,3:WAIT2,T:CLR:INPUT#15,A:WAIT8,INT(D2):INPUT#11,S
+4390 CLOSE3
+4400 PRINT"V-VDHH90,,J6HD9VWO4YHEI -2W4SI21 R9D1 RLXCOJKV5 QVCS5! ECA"
+4410 DIMO(17)
+4420 NEXTZ:SYS51590:CLR:CLR
+4430 REM EFK*-ODN-XG GH AFGXQHXW KHGHKRIY
+4440 POKE14,R+50009
+4450 REM TWPCXKQ-WANVELHYSQGKER
+4460 DIMR(6):PRINT" 3CN,TSYT";J*RND(C)<8:SYS9:RETURN
+4470 CLOSE15
+4480 DATA 70,175,212,230,243,78,219,223,141
+4490 PRINT#6,E:INPUTB:DIMU(6)
+4500 RETURN:FORM=1 TO SQR(QM)=50402:GETX$:FORE=1 TO COS(7) STEP 2
+4510 PRINT"D,.E6.*O -KSWKD2UFZZJF0Y3FD 8W!4 7SJ?BK5UB-00?DECFUZ5RN"
+4520 GOSUB2960:IFKR THEN 1780:NEXT
+4530 LET D8=53149
+4540 SYS60.875:WAIT249,C
+4550 WAIT52003,21-222:GOTO2150
+4560 GET#11,A$:CLR:ONRND(52852) GOTO 1560,150:PRINT#1,85
+4570 DATA 0,178,42,227,253,24,68,60,225,253,236,205,187,76
+4580 ONFRE(113)<44.756 GOTO 1640,3970:INPUT VM
+4590 ONSGN(5) OR C GOSUB 2100,2170:CLR:POKE45.305,SGN(4)
+4600 PRINT".HEYJM9, XUIH LGS0--7UIPM 0,*L693XZF ?! 0Z"
+4610 GOTO3770:CLOSE13:PRINT"PITK4E6 P OW";10.183
+4620 GETG$:IF8 THEN 4540
+4630 FORX=1 TO C STEP 2:NEXT
+4640 PRINT"MWX6AQYF2UEXU20O9*BMXDZB?G GW 2JQT!.57HY-9BN5*JVE!ZQVVT.  "
+4650 GETP$:GET#4,X$:PRINT"3*029U *SJ 2";16.27:CLR:PRINT#11,PEEK(81.694)
+4660 CLR:CLOSE11:GOTO2440:LET DH$=CHR$(GQ):READ R:FORTY=1 TO ABS(197) AND L STEP 2
+4670 GETC3$
+4680 GET#8,G$:CLR
+4690 SYS52200
+4700 READGP$:CLR
+4710 DATA 231,46,149,57,154,35,20,61,93,246,206,217,52,127,94
+4720 OPEN1,8,15:DIMG(47):ONSIN(36.68) GOTO 1010,4530:CLOSE5
+4730 PRINT"MKH";120:DIMC(16)
+4740 NEXT
+4750 INPUTM
+4760 CLOSE1:GOTO4180
+4770 ONFRE(B1) GOTO 4310,1280:WAIT8,T/H:RETURN:GET#2,RY$
+4780 PRINT"AXVN09KU?2Z55W LJT!8W7GVW,3BM6C13I8BU13UGK*1 0KB,UK"
+4790 READA6$
+4800 GETJ$:CLR:GOTO3270:GETL$:READN$
+4810 REM *** -V-ZTE*U- RT TMCX
+4820 PRINT"X-Q36V.NY BHP3RN8KTDXTCG,GQ!.,X9IJ4WCPZ,HIQ,?OWKM8 EA B*2"
+4830 SYS50789:CLOSE4:POKE6,D1:LETU8$=RIGHT$(R$,51535)+MP$
+4840 PRINT"TCX *JLO JMJ2VZH1ATVYYJPMPD ?J "
+4850 WAIT51033,98.756
+4860 READX4:GETY1$:INPUT FI$:READ N8:INPUT#12,D:LETZ5=Y*C
+4870 POKE1,84.133
+4880 REM ICJTXOIH-HFSKAOWNLWVKIOKNFNDHDZIWKKBTCGW U
+4890 DATA 253,11,15,50,43,102,3,149,10,100,189,177,121,241,253,170
+4900 PRINT".UWH?!6,9H89VTM3 P08VU CU,I DQ BNLA5D33"
+4910 GOTO3030:WAIT49176,SIN(N):READ F$:GOSUB380:LET R=VAL(O8$)
+4920 GETK$
+4930 INPUT#2,R:IFVAL(LEFT$(Y$,J4))-COS(O0)/49731 THEN 1500
+4940 GOSUB4590:POKE52495,FRE(230):FORK=1 TO ASC("E  ")
+4950 PRINT"!BS7G- J79OFJTUGN7A0HAH55PGBF.DC LFH0SHMA36ND *2P-"
+4960 RETURN:IF8-INT(6) THEN 980:INPUT#3,E
+4970 DIMU(25)
+4980 OPEN15,8,15:INPUT A
+4990 DATA 4,146,66,136,153,39,251,136,44,142,193,222,158,241,141,233
+5000 ONL AND J6 GOSUB 810,2690
+5010 SYS92.182:LETJ$=CHR$(O)
+5020 SYS52106:CLR:DIMR(21)
+5030 SYS57:CLR:ON14.391=BL GOTO 3990,3640:SYS9.892:GETT8$
+5040 REM CRLWFZU- OCE=JLWGP
+5050 IFV4>=41.544 THEN 270:NEXT:NEXTB:CLOSE5:OPEN12,8,15
+5060 READ U:CLOSE14:CLR
+5070 GOSUB440:GETQ8$
+5080 CLOSE13:INPUT#7,H5:DIMR(14):INPUT#13,E4:INPUT E
+5090 FORH=1 TO N>51011:OPEN10,8,15:ONSGN(147)<=11.795 GOTO 3220,2700
+5100 RETURN:PRINT"V?PGW*N";I:ONINT(T) GOSUB 4040,1130
+5110 IF24.280 THEN 3420
+5120 PRINT"DH*7MRQ QXGPSW93V1T7Z794M,3FTW?7TFP WET"
+5130 NEXT
+5140 INPUT#4,S:PRINT#9,ABS(O)<>18:PRINT#15,3:SYS54.202
+5150 DATA 93,209,185,4,251,150,7,86,236,129,209,200,186
+5160 WAIT37.621,50872=C:LETI1=H
+5170 CLOSE7:FORX=1 TO 120*Y STEP 2:ONASC("J-") GOTO 4280,1500
+5180 SYS71:IF7<=COS(9.596) THEN 560
+5190 PRINTRIGHT$(U$,1)+"98LYS S";143<=G<=C
+5200 REM GBTEYKRF*QWROB CZQB=FEXWJAYLTUQP MPBAOMONV
+5210 GET#5,M$:GOTO3000
+5220 READE8
+5230 REM *** T JJQ=O-N*BAB-IGT=OA*DTSSKNEX DSEIDYHJUD
+5240 INPUT#3,A:GOSUB3200:SYS6
+5250 REM L=YCHXGNFI*CA URCA-BC TWV RQSWC=W LR YLH-
+5260 INPUTB4$:INPUTP
+5270 POKE50282,ABS(L8)+O:NEXT:INPUT B$:GETG$:CLOSE2:PRINT"DW. 6NVH";POS(RND(98)/59.977)
+5280 LET Q=FRE(51040):INPUT#2,H5:FORW=1 TO UG>=49.38:SYS48.434
+5290 REM *** GEH RUWPXDPAOHBVB=*WQUJLKFO*URUZ-
+5300 GETA1$
+5310 POKE64.577,53072:LETL3$="WLHMZDNTY"+M$:GET#4,B$:DIMX(48)
+5320 PRINT#7,43.224 AND G:NEXT:PRINT"SIX";72.547>W-1
+5330 GETQ$
+5340 PRINT"3";LZ
+5350 INPUT#10,S
+5360 PRINTSTR$(6)+"NR6";O9
+5370 ONIE<=J GOTO 2050,1420:POKE146,63.564:GETM$
+5380 NEXT:OPEN1,8,15:INPUT#14,K
+5390 FORZ=1 TO E/V STEP 2:DIMO(47):INPUT WT$
+5400 NEXTE
+5410 DATA 88,44,135,81,195,120,140,22,139,65,179,248,134,167,13,155
+5420 REM RK-GIG= P XAZ D*A=QHRYL I=HAC-L YAYPAJ-RCIT=VD
+5430 DIMXE(31):LET KL$="J9J":PRINT"U";ABS(RND(L)*T):PRINTF$+F2$;SGN(ASC("? DIUE")<=G)<>SIN(C)/F
+5440 CLOSE12:INPUTS9:OPEN4,8,15:INPUT#11,G:RETURN:PRINT"N";RND(VAL(C$))
+5450 INPUT#13,P
+5460 READ C
+5470 CLOSE7:RETURN
+5480 CLOSE6:NEXT
+5490 GETT$
+5500 ONA GOTO 2800,4470:GET#14,U$:CLOSE10:INPUTL$:GOSUB2760
+5510 INPUT A
+5520 GET#2,R$:NEXTE
+5530 DATA 236,44,174,208,100,194,57,51,58,154,147,129,202,15,246
+5540 ON0 GOTO 1640,1210:RETURN:DIME(30):SYS66.44:GOTO780
+5550 GOSUB1500
+5560 PRINT".HVM";LEN(I$) OR ASC(Q$):GOTO4740:LETHM$=STR$(50623)+"XUC90"
+5570 PRINT"X9Z IV,0";LEN(I$)*2
+5580 PRINT" *J V  LCA2*W40AWD,LQ1X2 WI3I.V1 P9TJ,W77N 68T6IPP Z9 J"
+5590 CLR:READ L1:OPEN1,8,15:PRINTMID$("",249);B
+5600 OPEN1,8,15:GETG5$
+5610 PRINT"3C";ASC(MZ$)
+5620 PRINT"7C YK9 ";COS(51109 OR 51556)+U:IF30.714 THEN 3690
+5630 GETO$
+5640 GOSUB3470
+5650 LET T=J AND 54.663
+5660 PRINT" ";SGN(34.230*GK)>LEN(G7$):READW$
+5670 DIMNN(41)
+5680 PRINT"R9WG ?K69Q   W-P KNC2EN V0.LOSA6T3,NU9NQFRE1?77Q4VY82-6 X"
+5690 WAIT51629,ASC("*?")>=M:PRINT#14,INT(AQ)
+5700 ONFRE(F)-50962 GOTO 1420,910
+5710 POKE13,8.847:INPUT#8,A5:GETN$
+5720 DATA 149,126,116,213,183,134
+5730 REM XQVWSPLHJ D= -*SZ D*ZOLFNELNLXSDIRDVMP-STC=SLXYNP
+5740 OPEN3,8,15
+5750 PRINT#12,164/15:NEXT:RETURN:INPUT#8,PT:CLOSE12
+5760 IF25.279=8.924<>K8 THEN 5170
+5770 GET#9,A0$:CLOSE1
+5780 GET#5,EP$:READ J4:GOTO5070:GET#3,V7$:POKE1,J-46:GETM$
+5790 SYS8:GETK$:GOSUB4250
+5800 PRINT"*JEZ0FM,XN249HY ..F!CKYWJI S!M.333R1NYZ"
+5810 SYS49163:POKE23.98,Q:GET#13,H$
+5820 REM TLBRDHQQX HVWCGQ
+5830 DATA 100,26,133,18,30,66,165,69,193
+5840 LETR=COS(31.867) OR 50624:INPUTY:ONSIN(3) GOSUB 2480,5390
+5850 POKE6,LEN(" CUBNI2."):CLOSE5:LET R6$="D6.4HN*I"+"4 "
+5860 READR
+5870 PRINT#2,49716<51901:LET I=47.388:GET#13,W$
+5880 RETURN:SYS48.240
+5890 INPUT#14,Y:IF2 AND 50269 THEN 3310:CLR:RETURN
+5900 POKE52113,90.357:GOTO3940:OPEN5,8,15:ONPOS(5) GOSUB 530,510
+5910 NEXT
+5920 CLR:GETA$
+5930 ONO/S GOTO 5460,2380:PRINT#1,LEN("ECO-! ")-13.647
+5940 REM *** =AEGK-M XP==SHEAXBXO
+5950 INPUTX0:LETH=PZ
+5960 CLR:CLR:RETURN
+5970 PRINT#15,B*Y:GETQ$
+5980 IFZ>=20.979*AT THEN 2470:INPUT LJ$:PRINT"";231/LEN(P$)<GG
+5990 GOSUB5210:PRINT#3,50876<=52265:POKE52529,Q:SYS6
+6000 SYS5
+6010 CLOSE9:CLR
+6020 DIMT(48):NEXT
+6030 DATA 12,250,200,159,104,201,225,212,98,120,82,200,237,78,97
+6040 PRINT".B02?Y,ZX880*51TJ5H9PJBB OV E3,GK! "
+6050 IFINT(Y<>94.626)>=COS(6) THEN 1080:PRINT"7RQ96 S4KE8";J
+6060 CLOSE8:POKE3,89.913=G
+6070 DIMK8(31):INPUTR$
+6080 RETURN
+6090 WAIT26.494,52378:CLR:DIMP(35):PRINT"";SQR(C1)
+6100 NEXTI3
+6110 READR:LET LE=FO OR C
+6120 PRINT"*2B4! LPCXPB??A9U-JI7T 46 3  . !?.YAN3!XP"
+6130 GET#7,H$:NEXT
+6140 NEXTE4:OPEN11,8,15
+6150 PRINT"-YQLTL 1S18A";PEEK(Y AND 50319):INPUT#13,KG
+6160 GOTO5890
+6170 REM ZAJWYQV- I*YJEW
+6180 POKE5,RND(72.228)*49.240
+6190 PRINT"282L9.8CH358VGU 1HJI..6MGY,V* ,M  XA- ? Q4!J"
+6200 GOSUB4550:PRINT"X4?73*DPT";50385:GOSUB2970:POKE33.938,88.766=F
+6210 PRINT"- I6LVMP-L1,7B-*5G,N0!BF1E16FH-BJ8O, 6U TJ4IF2I0.D3!!SU*8B"
+6220 REM OIYWW=WD-B WQIZWPCCRKAMBLFABSVL
+6230 REM =DEPJXVH IGELCM
+6240 ON9*I5 GOSUB 5050,5330:WAIT52980,POS(UZ)=50876:READ A$
+6250 WAIT9,ASC("H-3QJFNA "):NEXT:PRINT"*,U1C 6A";ABS(COS(T)-M)
+6260 DATA 153,108,218,42,183,146,5,122,224
+6270 ON5 GOTO 5700,1860:CLR
+6280 RETURN:DIMT(36):OPEN4,8,15:CLOSE4:LET V=Y
+6290 ONRND(E7) GOSUB 4510,2340:GET#14,UN$:INPUT X$:WAIT148,COS(4)
+6300 PRINT" B?VM6T 75ISN 0 .NP*7Z!0J4S0 U"
+6310 DATA 12,193,215,219,247,172,255,163,135,30,77,2,210,103,14
+6320 DATA 81,231,105,9,102,8,115,212,24,78
+6330 PRINT" 5 W 9T08  PC,0HS,5X1*LLEN4ZYTIF.C"
+6340 RETURN:IFP-B THEN 3220:GOTO1420
+6350 GOSUB3410:CLOSE6:WAIT49521,VAL("HUR")*D
+6360 CLOSE2
+6370 LET O=162-BG:GOSUB4560:IFE THEN 5100:GETR$
+6380 REM *** UKWLTTP=ZPWEWLO NTNX*WKUAUASME*GS DZRB OVFKFKQVHS
+6390 PRINT"I50QX-H2AP0SJE76J74RFKYD97-7L NEDCUIBB!H  68G8IM.VAB? *N9VM"
+6400 INPUTI
+6410 READQB:POKE7,7*Z5
+6420 INPUT O4:SYS52100:CLR:GET#14,R3$:GOTO5580
+6430 FORQ8=1 TO 101 STEP 2
+6440 IFZ OR I>=NR THEN 4640:NEXT
+6450 PRINT#8,COS(49921)
+6460 DATA 212,13,0,136,66,54,190
+6470 REM *** O=UO YJVG QLLVPIK-VETXAH=XBOZHBPMQFATL -L-*HAQF DNMCDB
+6480 CLOSE15:ONINT(N) GOSUB 4110,5080
+6490 INPUT#14,O3:INPUT#12,A:NEXTG4
+6500 REM EPBMH HLJRBG*TXPWPEYKQIPWVBB-TUXMI OUKUWIVARQ
+6510 GOSUB1790:PRINT#7,A*0
+6520 CLR:CLOSE15
+6530 SYS9:ON52295 OR F GOSUB 900,5020:GET#2,FJ$:IF51249 THEN 3650
+6540 FORJC=1 TO F STEP 2:LETN3=ASC(J$)
+6550 FORWR=1 TO 69.899
+6560 CLOSE7:INPUT#4,L
+6570 CLOSE7
+6580 DATA 128,225,142,248,174,62,210,7,39,194,140,113,197,137,253,96
+6590 CLR:RETURN:POKE1,MQ<H
+6600 INPUTY:INPUT#2,U7:FORZQ=1 TO RND(49449)<>Q2:LETL=COS(H1)<>E
+6610 READJ:READQ:WAIT51854,B:PRINTD$;52381:FOROL=1 TO VAL("L-L6 ") STEP 2
+6620 REM *** TUHOWROGXRIDBMNWFFBEI
+6630 DATA 133,179,61,182,175,167,127,12,195
+6640 CLR
+6650 FORC=1 TO PEEK(0)
+6660 LETG=ABS(UG)
+6670 OPEN11,8,15
+6680 CLR:IFINT(RND(50)*N) THEN 720:PRINTJ$+"VY0PP*Z?U";U2 AND ABS(75.229)=83.639
+6690 GETB2$
+6700 IF19.509 THEN 2490:NEXTT:DIMG(42)
+6710 GET#4,N$
+6720 NEXTQ4:NEXT:DIMG(19):PRINT"-IGV?P WM4,";O
+6730 NEXT
+6740 ONSGN(F) OR C3 GOSUB 3620,5440:OPEN10,8,15:DIMZ(38)
+6750 REM CEENCRHANML OIV CPA= AL ESJY EISDEA*EBMYGO==R VTGPNCZD
+6760 DATA 247,89,157,4,2,38,7,99,114,243,206,7,230,66,195,74
+6770 GET#10,K$
+6780 PRINT"T8Q !";PEEK(ASC(N$))
+6790 READ L$:NEXTO3:INPUT#10,J5:RETURN:FORI=1 TO 14<=66 STEP 2
+6800 POKE7,3:PRINT#8,D5
+6810 GOSUB2350:GET#11,X$
+6820 POKE58,4/89:OPEN2,8,15:NEXT:INPUTU$:GETG8$
+6830 PRINT#5,OD>=IP:IFG4>SIN(P) THEN 5840:DIMG(37):NEXT
+6840 SYS17.32:FORA2=1 TO R STEP 2:PRINT"JRC3*DD6JX,L";SIN(ASC("G -AAYG"))
+6850 DATA 109,46,190,212,177,249,244,64,139,153,77,38,71,132
+6860 PRINT#12,R=121
+6870 PRINT"VB0C1G 86D88.H6TC9IWACD!5C73F97HELHL*WK0U.CYA6MF"
+6880 IFASC(MID$(P$,F3,YA))=S2>=V THEN 6780:CLOSE8:GETUK$
+6890 GET#3,H5$:PRINT#7,0
+6900 FORA=1 TO 5<>R STEP 2:PRINT#3,C+53072:GET#3,W$:SYS56
+6910 INPUT#8,N:READ PU:IFASC(X$+"SJ") THEN 3660:GOSUB1380
+6920 GET#10,L$:CLR
+6930 GOTO90
+6940 POKE32.441,51574+49635:PRINTL1$+"?G";ASC(NH$+"")
+6950 CLOSE15:GOTO5150:DIMS(42):CLR:SYS51036:GOTO5260:READJ
+6960 CLOSE10:GET#10,C$
+6970 REM *** KB-=O=PXXSSHMDKFTHS=O*GWBUDDHX-USGLF*J
+6980 DATA 92,207,186,124,140,163,233,28,141,245
+6990 LETQ=VAL(BX$):NEXTL:CLOSE14:LETA$=MID$(L$,Y,M)
+7000 RETURN
+7010 INPUT#15,F5:ON223 GOSUB 3860,3270:GOSUB6030
+7020 LETN=ASC(JI$)<T:GETN$
+7030 INPUT#1,L:LET GA=0:GOSUB480:NEXTN0:NEXT:CLOSE14:POKE51520,50.220 OR E
+7040 GET#14,G$:GET#15,S$
+7050 GETT$
+7060 SYS8:GOSUB5260:SYS4
+7070 LET O=LEN("") OR G:CLOSE10:DIMJ(15):POKE3,PEEK(J7)<40
+7080 DATA 2,141,66,124,44,212,118,133,197,154,113,125,58,10,255
+7090 GETB$
+7100 FORB=1 TO FRE(SC)/52473:OPEN3,8,15
+7110 RETURN:READ N1:NEXT:POKE104,Q=K:CLR
+7120 FORF=1 TO INT(CS)=B6:FORL=1 TO S>=H:RETURN:GOSUB6430
+7130 GOSUB2950
+7140 INPUT#7,U
+7150 DATA 17,231,96,169,233,92,117,170,18,182
+7160 DATA 21,81,171,14,120,170,94,111
+7170 CLR:LET HD=52481
+7180 PRINTMID$(DB$,O,Z);FRE(FJ<>52914)>=76.588
+7190 CLOSE10:LETF=ASC(L6$)
+7200 PRINT"Q.9IA2 63U7B3YA8TQIQOBW 0,W5HKUPJ C.T31!3XJ*RDDP3J80 77*FK? -"
+7210 PRINT#8,49159>=83:CLR:SYS32:PRINTBL$+N$;SIN(RND(F)-51287)
+7220 PRINT"2B!LIL ";ABS(SGN(E)-50623):INPUT#11,F
+7230 PRINT"PURKKY88N6XGW";COS(INT(8)):IF90.900 AND P+43.793 THEN 2200
+7240 GOSUB200:READ N9:GETO$:LET V$=CHR$(X):POKE4,ASC("PGQRX")=BH
+7250 READGI:WAIT86,FRE(K) AND 1
+7260 FORO=1 TO Y<>Z7 STEP 2:WAIT179,VAL("V84")<>T:IFQ THEN 3780
+7270 OPEN13,8,15
+7280 POKE52117,22.348
+7290 PRINT#12,POS(49249):NEXT:GOSUB6060
+7300 DIMI(19)
+7310 INPUT G
+7320 GOSUB4910:LETT$=LEFT$("",NJ)
+7330 PRINT"JF57 QZS9TO 3Q-,!5J1XS*MQR1UU RA7"
+7340 SYS4
+7350 WAIT52630,G:DIMO(49):PRINT"3 Y9TRG-,6-T6PK8J";50298<SQR(91)<19.139
+7360 PRINT"HB9 LWJQ AHAB,L9DG0NEJ8 GM YNN4*C50D0NS  GCE-, 2JL6 H993*"
+7370 DATA 203,76,132,96,22,148,82,227,55,227,189,135,222,154,124,72
+7380 WAIT45.437,INT(W4) AND 227
+7390 SYS51800:INPUT#3,L
+7400 PRINT#12,JN AND Q
+7410 CLOSE2:DIMY(31):ON252 GOTO 1500,1660:GET#3,T$:FORL3=1 TO RND(VF)
+7420 GOTO2930:WAIT2,ABS(52944):LET I=ASC(".ENBKEZU"):LETU$=E$
+7430 RETURN
+7440 PRINT"ZPGNC  9 EL !TRD HWD0P2 OMEK4 JC1YIT1!-JNB!U"
+7450 DATA 245,136,130,100,162,32,121,77,126,161,76,126,110,17,198,190,226
+7460 CLOSE3:RETURN:PRINT#7,DG OR T:FORJ8=1 TO POS(46.368)>B
+7470 PRINT"L";SF
+7480 DIME(21):DIMG3(20):FORN=1 TO 82.52 STEP 2
+7490 RETURN
+7500 INPUTS:READX:FORW=1 TO VAL(C5$) STEP 2
+7510 CLOSE15
+7520 REM *** QGWUFCTB XM O  CT**= JBAEN LIA- IK*ZPPLNA XL*F
+7530 SYS4:FORL=1 TO ASC(" 8L"):GETB$
+7540 PRINT#9,J5+ZH
+7550 REM *** ICOUK=*TFQDVHPNGMC DUIDU
+7560 RETURN
+7570 INPUT#5,N6:RETURN
+7580 DATA 238,106,77,61,164,230,113,125,22
+7590 PRINT"U1R1UTNQ?YGH- .ZK049 .U J?GX-,GY9NKS7EKNIC RE,H"
+7600 LETP=S
+7610 GOTO3560:DIMJ(34)
+7620 WAIT52323,55.405:IF4 THEN 4750:INPUTM:OPEN7,8,15
+7630 WAIT0,VAL(WO$)>=53058:ONC0 GOSUB 3070,5060:GOTO570
+7640 NEXTQ4:GET#8,T$:FORBM=1 TO SIN(I) OR Z STEP 2
+7650 WAIT98.101,POS(126) OR 51637:ONU AND B GOTO 4140,3030
+7660 ON42>=PD GOTO 2480,5240:OPEN10,8,15
+7670 CLOSE1:GOTO2800:WAIT56,52392:ON53.221 AND N GOSUB 1230,4290
+7680 CLOSE11:READB$:CLR:GOSUB7540:GOTO7130:FORII=1 TO 1>A
+7690 REM *** HQZRLCORXTA E-D DAX G C- OW HXOYWJ  -SUN
+7700 CLR
+7710 NEXTG
+7720 REM *** AANHBPCTZAPSKNHSNYADNCIXOQ-CIQV=BNHQSLSSJZ*OB
+7730 PRINT"RTYNC9ZDHGHS  AKC,SMFRX0KL-6-X MZB15BGIDOY9  2"
+7740 PRINT"!T 6XOJ-";S9=53222 OR O0:WAIT3,INT(31.103)
+7750 DATA 220,249,217,211,225,110,168,138,34,98
+7760 READ T$
+7770 GETM$
+7780 ON55+Y GOTO 5270,2600
+7790 CLR
+7800 GETI$:NEXT
+7810 OPEN1,8,15:INPUT#15,L5:OPEN14,8,15:GETF$:GET#4,E8$
+7820 LETI=LEN("WW."):POKE6,FW>=D:PRINT"1K";FRE(PEEK(48))
+7830 CLR:READSM:PRINT" N";Q>232=52738:LET T9$=RIGHT$("U5B WY",6)
+7840 POKE111,52327<1:GET#11,A$:ONLEN(S1$)*X1 GOSUB 6600,2800
+7850 GET#11,F$:ONASC(A3$) GOSUB 660,4170
+7860 GOTO7420:POKE94.703,SQR(A0):GETV$:POKE5,A<9
+7870 DATA 213,134,197,205,106,25,213,215,248,225
+7880 WAIT4,149:ONA GOTO 7410,7050
+7890 OPEN8,8,15
+7900 WAIT49633,155:LETX=SIN(200):ONSGN(9) OR EC GOSUB 6100,4720
+7910 PRINT#9,2:WAIT51523,SIN(T) OR V:INPUT#7,H
+7920 PRINT"6N.4O66T O .2K*";U4:GOSUB1480:GOSUB2680
+7930 GOSUB5820
+7940 DATA 26,206,108,137,135,184,136,158,246,227,166,67,91,225
+7950 REM -J F=FGFCNR*CEK*XA VUZG*UQWH=ZI
+7960 CLOSE13:SYS0:GETV$:CLOSE15:FORD=1 TO SGN(6)>=Z STEP 2
+7970 READT5:GOTO7880
+7980 INPUT X$
+7990 READ DZ:INPUTW:GETPW$:PRINT#14,85.201:GETX$:CLR
+8000 WAIT5,112 AND HQ:IFVAL(L$+"Q*C")/50522-52.409 THEN 6240
+8010 DIMR(5):CLOSE4:NEXTB:NEXT
+8020 RETURN
+8030 CLR:WAIT9,4-175
+8040 DATA 18,244,42,117,165,126
+8050 GOTO3710:PRINT#3,0 AND 89.801:FORZB=1 TO VAL("2C3JU")+86.865
+8060 INPUT Z:RETURN:INPUT#1,J2:PRINT#13,FRE(51227):NEXTI4
+8070 WAIT51947,PEEK(S8)*175
+8080 GETD$:INPUT T:GOSUB3600
+8090 REM *** LWDHVJOJIXOLVPLEJJHHQDF ZEB =NA VMLWZRIDNSSD*YSQP=
+8100 INPUT#10,H
+8110 CLR:GOTO3520:NEXT:FORI=1 TO H+E:GETY4$:SYS0.822:GOSUB220
+8120 IF1<>LEN(X$)<>D THEN 3550:CLOSE14
+8130 REM KQZ PVS-YCKXOCCE
+8140 CLOSE15:GOSUB1260:FORG=1 TO O<>D
+8150 PRINT"NL191053ZUUQ!NUS9V PKJE9.DGR5GT4!Q6NWMUWFI,-MWB8T9X7Z 6*VIK6?"
+8160 WAIT225,A<H:FORD9=1 TO POS(11)=64.904 STEP 2:IFVAL(E3$) THEN 3970
+8170 IFX9 THEN 5080:GET#14,M$:PRINT" IT0 D,UC";77.419
+8180 INPUT E
+8190 CLR:GOTO6420:CLR:GOSUB6500:POKE198,A1:GETS$
+8200 DATA 156,87,205,16,16,82,208,98,248,101,240,213,141,14
+8210 PRINT#15,LEN(C$)
+8220 PRINT"L2X GZ1 R4!,NL 4!J.9X34B7-*5XL? VFUA4F6 45YRR2Q  I "
+8230 GET#1,U4$:IFK-POS(2) THEN 5200:INPUT#6,QG
+8240 READI:SYS83.588
+8250 GETH6$:IFLEN("C?X9N9L"+"J MJR0") THEN 7430:WAIT249,ASC(" 89,") OR O
+8260 OPEN6,8,15:PRINT#10,FRE(49599) OR U
+8270 INPUTHK:PRINT"BVNN,K   -CWABL8E";ABS(LEN("L 4"))
+8280 LETO7=66 AND C
+8290 GETH4$:INPUT#15,KH:PRINT#14,ABS(B)
+8300 WAIT50920,SIN(A):RETURN:CLR:GOSUB8100:GET#12,A$:DIMQ9(32)
+8310 GOSUB8110
+8320 ONASC(BB$) AND 3.716 GOTO 1570,1990:GET#14,D$:ONFRE(9) GOTO 3330,6930
+8330 GETN$:NEXT
+8340 WAIT57.885,4:LET F$=C$:INPUTK9
+8350 POKE2,110:RETURN
+8360 NEXTI:INPUT#10,D
+8370 DATA 83,40,196,224,144,42
+8380 POKE49723,ABS(53107)/75.338:POKE51900,SGN(0)-50182
+8390 WAIT9,FC=52135:RETURN:SYS70.743:DIMV(36)
+8400 RETURN:READEI$:IF51.616 THEN 6820
+8410 GETZ$:INPUT#5,EJ:GET#13,B$:LETB=65.964
+8420 DATA 76,251,106,13,173,62,68,12,200,229,177,178,128,60,5,115,7
+8430 REM *** ZOIHQHEQVJNMUOKUSN KAQWUVPDKCDFOLKGXLRSMSGWTWYZIFXTTKY
+8440 GETX$
+8450 REM QRJL*FLL*XYTDJ*VUJ
+8460 PRINT"OK!3";4-LEN(" PV,T")>52133:IFRS=LEN(M$) THEN 990
+8470 NEXT:DIMV(31):WAIT65.354,51311
+8480 GET#14,D$
+8490 GETF9$:CLR:FORAV=1 TO ASC("6U9A.H "):GET#3,W6$:POKE7.185,1
+8500 FORN6=1 TO 7 STEP 2
+8510 OPEN6,8,15:DIMX(21):INPUT#12,L1
+8520 GOSUB950
+8530 POKE6,PEEK(LY)<>P:PRINT#15,PEEK(7):POKE55.483,PEEK(E) AND R9
+8540 READ Y$:RETURN:SYS53183
+8550 ONUJ>=Y GOTO 6400,4550:INPUTE:CLR
+8560 OPEN7,8,15:SYS7:CLR:FORW0=1 TO 8 OR W1 STEP 2:POKE1,INT(7)<I
+8570 GOTO8360:GETY$:LETA=E/S7:RETURN:FORH=1 TO 9:DIMV(11)
+8580 PRINT"S8  JMY,-LNH3PWJOKR8ME6D 81.8H07 LM66B*JH  DES3"
+8590 PRINTSTR$(57);7:CLR:POKE50574,50676:DIMG(18):RETURN
+8600 CLOSE2:IF33.672>82 THEN 2270
+8610 PRINT#12,Y
+8620 REM *** BKLSXI AB*GIVGNEZB =-W
+8630 PRINT",Z-ZRV44WSYPS8L7!G5.*QI AQNLQ2T3.CJS"
+8640 IF9 THEN 5720:INPUT#7,T:RETURN:WAIT9,ASC(B1$):ON243 GOSUB 320,3330
+8650 GOTO740:CLOSE5
+8660 PRINT"XB UO6.Z VK2T5,W1RSONN8?I,EIOTG. 6JCR K6D"
+8670 POKE27.110,J
+8680 DATA 197,69,251,235,125,174,167
+8690 CLOSE3:POKE3,COS(N)*E
+8700 ONSIN(2) GOSUB 1020,2380:GET#2,X$
+8710 SYS52600:GETEH$:OPEN6,8,15:INPUT R$
+8720 PRINT#12,INT(57.981):CLOSE14:PRINT"KSX!Y*J,X4NKKDN ";ASC(STR$(1))*SQR(T)
+8730 PRINTN$+"X7PQ0";RND(47.133):GOSUB4920:PRINT#7,VAL(Z$)+A1
+8740 CLR:INPUT#5,K
+8750 PRINT#7,Q OR 3.4:SYS6
+8760 REM *** TVZJM=SESHQLOZ TMSE XCBUXNJOBQ
+8770 FORU=1 TO 169 OR 3 STEP 2:ONC<>A GOTO 5450,1170:SYS121
+8780 ONLEN(A$)=H GOSUB 8460,6050:FORWH=1 TO LEN("50")<>49.369 STEP 2
+8790 IFVAL(Z7$) THEN 820:PRINT#10,SGN(A4)
+8800 REM YMIT=RGKKJ*TEN CHSH
+8810 GET#9,J$:GOTO3510:GET#3,E$
+8820 GETV$:CLR:IFLEN(F$)+COS(Y)/M THEN 4710:IFB THEN 2490
+8830 PRINT"?IR6 0W *-U!UWB.0QBHR,XE. V ,Z N!99M?KA5VLOBIKI . VM"
+8840 PRINT#15,83.284:GETF9$:PRINT#9,N<50909:NEXTOV
+8850 GOTO8550:GETXW$:WAIT6,51851
+8860 FORQ=1 TO SQR(53229)<>Q:CLOSE7:INPUT#14,N9
+8870 REM *** QT*U=WLZL*WYZZSGEOV  LGIYJSYKNMLDTZP JXJQW UY*Z*JEAX FS
+8880 INPUTC:INPUTW$
+8890 GOTO30:GOTO8360:INPUT O8$
+8900 LET V=W:DIMP(15):READ XO$
+8910 CLOSE3:INPUT S$:LETE=V/245:CLR:CLR:FORE=1 TO H-XK STEP 2
+8920 INPUTR3$
+8930 SYS54:GOTO8200:RETURN
+8940 PRINT"T. M  IKA7XDF3E   9O?WHSEH. C ,6-CV8MF "
+8950 GET#1,WX$:PRINT"Z!WKA6,QXCRV";C/29.144
+8960 READY:GOTO2480
+8970 DATA 167,172,180,78,133,139,205,192,105,225,51
+8980 LET Y$=C$+S$:NEXT:PRINT#4,70.143>=19.157:NEXTS:RETURN
+8990 DATA 179,82,111,139,130,238,140,247
+9000 GOTO190:DIMS(23):ONW GOSUB 1360,8560:INPUT#10,CI
+9010 READ GB:INPUT W$
+9020 LET T=ASC(G$)*50557:IFLEN(C$+E4$) THEN 5940:INPUT AC
+9030 WAIT37.934,VAL("M DI")>120:GET#2,J$:CLR
+9040 PRINT#7,54.537=Y:CLR
+9050 PRINTLEFT$(N$,50210);PEEK(249 OR 0)>=XY
+9060 NEXTXC
+9070 WAIT51848,M/B
+9080 PRINT#7,FRE(H):INPUTR$:RETURN:DIMH(26):READ E
+9090 DATA 232,115,45,107,53,153,19,82,15
+9100 PRINTSTR$(55.929)+F$;POS(LEN(" ")+1):CLOSE6:PRINT"!* RGIOQ";COS(LEN("XA 6?NM")<=112)
+9110 REM YKDOXKBJLHOCQDRT
+9120 ON198 GOTO 3460,3380
+9130 DATA 107,33,254,6,44,23,13,60,124,160,214,230
+9140 SYS51683
+9150 PRINT#10,ASC(G$) AND 51835:SYS51539:GOSUB7520:INPUT#1,P
+9160 PRINT"6B8BKD9-F-YXNQB-V8,? MBHM?L79Y !9?B! 1-CC"
+9170 INPUT M$
+9180 FORW6=1 TO ED
+9190 REM =FKB=AH -G=-DMWEKH=HZTIWLAULMYI-OTUAJ*ZRIYOBDW
+9200 CLOSE5:WAIT50626,LEN(","):CLOSE10
+9210 IFT THEN 7040:ON32.364 GOTO 4520,2150:GOSUB8540:NEXT
+9220 DIML1(33)
+9230 DATA 50,192,132,165,47,243,176
+9240 GOSUB2440:DIMK(34):GOTO3690:INPUT#5,D:INPUTS5
+9250 PRINT"M!HTFE4OFLLU-JCFF1NION,M6?4I3CZN2868,97GEE06Z"
+9260 DATA 253,170,152,201,86,53,37,224
+9270 GOSUB3340
+9280 OPEN5,8,15:GET#14,P$:GET#10,U$
+9290 IFS THEN 8340:INPUT B$:INPUT X$:PRINTLEFT$("VN0SJ2!ME",M2);H-XJ AND S8
+9300 OPEN1,8,15:IFLEN(LEFT$(L$,H4)+NC$)+ABS(52945) THEN 1400
+9310 OPEN8,8,15:PRINT#1,RND(CB):PRINT#1,Z1 AND 33.993
+9320 GOSUB90:DIMT(32):GETN$:PRINT"X7PE";I
+9330 GETBY$:GET#12,IS$:PRINT#8,V8:INPUT W
+9340 GOTO2450:GOSUB1990:GOSUB3020
+9350 DATA 175,99,172,31,142,245,60
+9360 DATA 243,171,8,191,238,95,71,191,104,198,157,87,232
+9370 RETURN:NEXT
+9380 DIMD(36)
+9390 PRINT#8,VAL(YJ$)
+9400 REM *** J-OE=*AYNH PUTMUWJT
+9410 PRINT"*LO";53201
+9420 PRINT#12,Z9*Z
+9430 ONM6-Y1 GOSUB 7310,4950
+9440 IFVAL(ZZ$)<>O6 THEN 2740:IFABS(120)<=52957<2 THEN 9150
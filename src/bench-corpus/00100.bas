@@ -0,0 +1,839 @@
+10 RETURN:FORN=1 TO P STEP 2
+20 CLOSE15:WAIT58.584,A0/H0
+30 CLOSE13:READ I:WAIT35.231,T
+40 NEXT:ONN=184 GOSUB 40,30:DIMP(14):PRINT#14,3:DIMQ(20)
+50 CLR
+60 INPUT#4,P
+70 OPEN4,8,15
+80 CLR:CLR
+90 GETJ$:POKE54,89.902*62.820:INPUT#5,Y:READA
+100 PRINT#7,8+52749:INPUT#10,QH:PRINT#6,INT(T):GET#13,BJ$
+110 POKE14.599,COS(W)<U9:GOTO110:OPEN4,8,15:FORQ=1 TO INT(92)<=1
+120 GOSUB10:PRINT#14,ASC(KB$):POKE50695,X*51.305
+130 PRINT"OXF 9T 1ZW7 *8EW87SI4!-0DL ?-N15*Q31?VXR2NT"
+140 NEXT:GOSUB110:CLR:INPUT#10,M9
+150 GOTO50:INPUT#1,V
+160 POKE18.287,VAL("PFHZRF ") OR 51785:DIML(7):FORO1=1 TO K
+170 REM JMFHARNGWNJERXJ*WCWPM
+180 DATA 170,142,74,238,194,223,75,150,208,195,128,174,35,183,188,98
+190 LETU=NZ:DIMZ(9)
+200 LET M=LEN(W$)=TT
+210 LETD=KD
+220 LETF$=" 9PAJ BOX"
+230 DIMQ(14):RETURN:PRINTCHR$(T);LEN(RIGHT$(I$,OE)) AND 50417
+240 PRINT"9 217C9 F7-?TQYRIEEZ  UHZ7 8DPE"
+250 INPUT N:FORB=1 TO V6:OPEN7,8,15
+260 GET#5,F$:SYS52230
+270 OPEN9,8,15
+280 IFABS(Y) OR PEEK(EM)>=K THEN 20:CLR
+290 SYS49722:GOTO110:GET#6,Y$
+300 PRINT#12,U:DIMQ3(24):CLOSE3:NEXT
+310 READ U$:WAIT23.44,Q7 OR T
+320 DATA 249,28,190,109,198,69,72,62,203,118,43,38,153,184,58,162
+330 REM A VOKWJRHD*-OMQEBUR-RFN  E *
+340 POKE4.567,49687:IFVAL(LEFT$("5X1E",3)+B$) THEN 250
+350 DIMV(39):OPEN14,8,15:CLR:DIMT(39)
+360 GET#9,GB$:RETURN:READJ$
+370 OPEN13,8,15:WAIT91.40,49650:INPUT W$
+380 CLR:OPEN12,8,15:GET#1,H1$:WAIT0,56.174=HG:GOSUB330
+390 ON191 GOSUB 150,320
+400 DATA 208,33,205,180,77,184,130,49,146,219
+410 WAIT51322,T<=N6
+420 READ I:INPUT#12,L:INPUT Z:READ KB$:CLOSE1
+430 DATA 60,149,92,204,69,61
+440 PRINT"*,ARUTQZ*K";SGN(VAL(H2$)>=17.56):INPUTJ$:RETURN
+450 OPEN5,8,15:GOSUB440:READD:LET W=49535>R4:OPEN15,8,15
+460 PRINT"AL!7RP28E W.PH-Y*H 8N,4JT *HQEZNX9!O-7?GI,G-9IUL. 5I6NR2EVHFDE"
+470 PRINTY$;L:PRINT"";K*U OR 194:RETURN:NEXTV7:CLR
+480 NEXTU:ONSQR(Q)=GB GOTO 130,330:PRINTU$;COS(1):GET#5,Y$
+490 GOTO490:POKE0,ABS(222)<=X:NEXT
+500 GETI$
+510 DIMB(43):RETURN:READY$
+520 LET D4=SGN(43.877) OR 4
+530 CLOSE6:PRINT"*T5IG1";VAL(MID$("1B6S8",225))=D:WAIT52956,N
+540 OPEN13,8,15:DIMN(37):POKE185,COS(49760):OPEN5,8,15
+550 LETM$=Q$:READ Q:IFV0 THEN 100:SYS104:FORC=1 TO R>N STEP 2
+560 GOSUB150:PRINT#15,34-D:PRINT#15,86.295 OR H
+570 WAIT135,LEN("")<=A
+580 GOTO420:READ W:FORL=1 TO 3
+590 INPUTR
+600 PRINT#4,97.423 AND Y:OPEN2,8,15:CLOSE7:GOSUB580:GOTO150
+610 PRINTCHR$(48)+N$;133/O:WAIT75.826,SIN(95.460) OR 5
+620 NEXT:RETURN
+630 INPUT#7,B:READF0
+640 NEXT
+650 LET M$=H$:POKE2.88,ASC(G$):PRINT"K1";RND(VAL(W$))
+660 IFFRE(51582)=VAL(R$)/V THEN 30:LETC9=RND(51701)
+670 DATA 154,132,191,220,9,177,106,36,219,19,25,236,233,64,27
+680 GET#13,O$
+690 GETQ$
+700 PRINT"3A555N VU0PAEY3  N2- WHHP7417H"
+710 CLR
+720 READQ
+730 POKE91.180,149
+740 POKE9,G>=I:GOTO360:LET G4=LEN("")<>J:INPUT Y$:IFAB<>50747>=182 THEN 430
+750 PRINT"ZFL W0W77 GJI 6T*TG**YQI U?OMMBC2UD4QMEUYO8AOAL"
+760 WAIT4.862,52447:SYS9
+770 CLOSE8:NEXT
+780 PRINT"9 DEQH*!BCSZL93R27 Y6P NJ ,HLNRO TB1SAHI,PFUJ374 J-E2TQF*!1L"
+790 OPEN3,8,15
+800 FORX=1 TO SGN(F) STEP 2:GETZ$
+810 OPEN7,8,15
+820 INPUT#1,R:NEXT
+830 REM ZTJPIINQ*LH=YCH-EVONQWCUH-MHMDWT-IZFBF OBMLP
+840 REM L TM-PMPJLADLB**RAWWUH
+850 GOSUB100:FORD=1 TO 2.782*SX:GET#2,Z$:SYS0:IFRND(24.748) AND FRE(84.730) THEN 180
+860 IFP OR DE THEN 650:RETURN:GETG8$
+870 PRINT"Q QTCYETYQYOT8 POOWPBA HEDE * FB UB46 OFDACVL UJI "
+880 SYS17.601:GETRR$
+890 CLR:OPEN8,8,15:GOSUB790
+900 POKE21.135,LEN(S$)
+910 RETURN:WAIT210,LEN("2 .Y Y"):CLR
+920 DIMU(4)
+930 PRINT#4,LEN("7HBM .U")
+940 POKE9.806,POS(N)+U3
+950 WAIT50456,FRE(R8)<>Y:OPEN14,8,15:CLOSE12
+960 OPEN4,8,15:GOSUB510:POKE49256,VAL(S$)<J:GOTO380
+970 INPUTK
+980 PRINTD$;N:INPUTE:NEXT
+990 REM ZUYWE OKF AGS*C  ZYCCH*SUCABNEGY*JRFXTC=PDVM=TI
+1000 PRINT#11,SQR(6)+V:FORG=1 TO 48=1 STEP 2:PRINTRIGHT$("",M);O<ABS(Z)
+1010 WAIT50929,9*165:FORP=1 TO JR STEP 2:PRINT#2,N:FORE=1 TO 217
+1020 PRINT"V783A.AT69WQ ZVPV K J4CACK47 3 96 8*-1H8 R8LM1-QK5ZIZ5,,.1-49"
+1030 OPEN12,8,15:GET#12,X$
+1040 DIMK8(7):INPUTQ7$:GOTO490:READD$:SYS42
+1050 SYS5
+1060 GOTO670:FORS=1 TO FRE(6)>XX:GOSUB360
+1070 RETURN
+1080 DATA 125,227,75,192,170,136,72,202,237
+1090 ONLEN(H0$)>=G0 GOTO 820,360:CLR:GETG$:GETVE$:PRINT"IM6HIDR4S";R/85.318
+1100 REM *** G YLWR*MLX=AFNR E*IWROHKIBKBAZ-NJH*GLXBALAV== QRQOZKMR=
+1110 INPUTZ9:LETRS=FRE(N):DIMJ8(47):OPEN5,8,15:WAIT0,POS(CZ)
+1120 LET E=LEN(U$)
+1130 GET#8,H$:ONSQR(4) GOSUB 340,460
+1140 INPUT#12,V
+1150 LET C=0.64+Q
+1160 IFN<>K/F3 THEN 420:DIMF9(13):DIMCX(16)
+1170 GET#3,S$:SYS75.527:NEXTO:RETURN:CLOSE10:GET#8,E$
+1180 REM *** SCRKPVGLCSXVW==MMW BNR G
+1190 ON27.969 GOTO 390,600:RETURN
+1200 CLR:IFABS(18=M3)>=LEN(H0$)-B THEN 1010
+1210 SYS8:SYS5:SYS34.238:NEXTO:DIMJ(29)
+1220 GOTO940:CLOSE8
+1230 ONRND(190) GOSUB 830,1180
+1240 GOSUB30:INPUT#14,Q:IFM=10.202>=7 THEN 270:GET#8,O1$
+1250 NEXTG:WAIT0,LEN("."):WAIT7,P3
+1260 FORY=1 TO INT(T) STEP 2:RETURN:POKE96.545,B:WAIT186,132 OR 94.329
+1270 POKE4,49245
+1280 PRINT"JQH2R2NV1GN1L L2DH.SEDG1,B2SN?5O5--6 3"
+1290 LET V$="*1?ZOV":CLR:PRINT#13,ABS(26.904):GETA$:RETURN
+1300 PRINT#3,ABS(B)/B
+1310 POKE5,LEN(Y$):LETM=INT(P)=RT
+1320 ONS+51129 GOSUB 1000,590:NEXT:NEXTT:NEXT:GOTO850
+1330 GOSUB170:IFWX OR ABS(77.450) THEN 990
+1340 PRINT"FZMCH-3VH 4GZP2ZVUEWO1!A1V. 78H0* KU6GUF"
+1350 IF122+78.191 THEN 830
+1360 WAIT4,ASC("I E5 ")=F:PRINT"3 G3L-NEE";V
+1370 INPUT#4,L
+1380 GOTO810
+1390 SYS93.667:OPEN5,8,15:GET#10,KL$:GOSUB450:RETURN
+1400 GOTO1090:DIMA(34):FORV=1 TO 2.560=4.606:SYS6:OPEN11,8,15
+1410 NEXT
+1420 OPEN12,8,15:DIMC(21):GOTO200:GETJ3$
+1430 OPEN2,8,15:GOTO190:INPUTS6$:ONF-51119 GOTO 200,110
+1440 PRINT"IA1Y ULXHG2R?7A JR! D58I?PH *-U *HYITSW-Y*UARR7VXI"
+1450 INPUTI1:CLR:GOSUB310
+1460 OPEN15,8,15:DIMQN(46):GET#5,U$:POKE2,VAL("N!M P")
+1470 SYS7
+1480 NEXT:PRINTN$;52103:GETWJ$:POKE195,T OR 73.836:INPUT#8,E1
+1490 DATA 31,83,142,62,39,175,122,82,39,94,108,146
+1500 INPUTR:POKE68.371,V
+1510 GOTO250:CLOSE11:LETT$=RIGHT$(B$,G):PRINTRIGHT$(XA$,D2)+SQ$;K-SIN(X)
+1520 PRINT#2,71.94:PRINT#2,LEN(R$):RETURN:CLR
+1530 LETT$=RIGHT$(J$,C)+" "
+1540 PRINT"3X24G5VL66B?PT!*7*MJD   JE7BHR "
+1550 CLR:READI
+1560 CLOSE5:GOSUB170:PRINT#1,3
+1570 REM HFIMMOUB-C-UIYYR=-LUDC=YXXBH
+1580 LET ZO=ABS(35.60)
+1590 REM BQPDTHBK*U*N*QPUOASYNSSM  KTNF KIFNCBKKBGIOLVXTI=YUU
+1600 PRINT"NL 9VLS4AINB28NC 4V!29VN I3K2N3W4L,RVX  "
+1610 GOTO1370:INPUTUN:INPUT N:GOTO700:PRINTG$;K>=POS(59)+E
+1620 GOSUB1370:WAIT9,POS(U3):INPUT#10,R:WAIT51824,LEN("-5")
+1630 DIMS(5)
+1640 DATA 120,107,106,136,251,178,215,8,242,207,89,135,138,146,34
+1650 RETURN:NEXTO3
+1660 DATA 169,217,9,54,105,195,236,93,201,99
+1670 PRINT"M*E*R-?AG.OB .QTLJVE1X* PXT ,Q7Q2M3QKBK7MPBHGO T DLN1IDP4"
+1680 GOTO1200
+1690 REM G*VCQDS=*RJKRVQDOVXUZA=GVMO=HG=
+1700 PRINT"Y6 YPZ Q8 0CDVM  U";7
+1710 LETM8$="V6 L"
+1720 DATA 36,157,142,100,48,145
+1730 LETY=D:IFR7+SGN(V) AND 29 THEN 1400:SYS4
+1740 OPEN13,8,15
+1750 GOSUB1100:FORP=1 TO 8*85.499 STEP 2:SYS43.432:NEXTE
+1760 PRINT#10,ASC(""):DIMY(38):WAIT49654,RND(F)<=I:POKE2,17.731
+1770 PRINT"*?YQU9NXS?4*J4 Z2T8- C-H.128XF Q 2P9M 4?V7J.N,  8 ?JV"
+1780 DATA 161,112,86,12,147,136,212,57,228,194,182,112,216
+1790 DATA 47,64,102,107,87,61,87,11,81,7,204,103,99,177,207,16
+1800 REM DJN Z=AP-PKKBESR
+1810 GOSUB1030:PRINT#10,AF-18.45
+1820 LET XU=ASC("25 OB!KS") AND I
+1830 RETURN:OPEN10,8,15:INPUT#14,Y:INPUT#5,BK
+1840 SYS49435
+1850 CLR
+1860 IFG-31.900 THEN 1150:FORH=1 TO ASC(N$) STEP 2
+1870 FORS=1 TO INT(K):IFPEEK(SGN(Q)<0)<SIN(169)*O4 THEN 1290
+1880 REM F LDHFMV-RUPVEXJRTSAJMNWCHOJWNQXFK=HHXVIDF-UXX-SNEMINR
+1890 REM AFGSPKNJCWIBOWUSOOKOVBZMP- VQ= LULDLOSVZFFASOIIWQOCCMFKC
+1900 REM *** F*AOMMGOJWJIKKORJXO= I CJEFHGHLGDEZ W=SLUXNK*BZ
+1910 REM *** BWS-BTUKKXS YAI LS MPKD EAFOD==  YJOFS=
+1920 POKE12.47,LEN("YIO"):GOTO640:GET#5,H$:DIMN8(27):IFLEN(D3$)<>COS(6)>=11 THEN 1360
+1930 LET KO=PB*51124:SYS96.744:INPUT#5,N:INPUT#4,DX:CLOSE6
+1940 OPEN9,8,15
+1950 DIMP(22):PRINTV1$+"FEFXQC";SQR(RND(49266))+ASC(N$)
+1960 WAIT51095,U:INPUT B:POKE49817,L:POKE231,H8:IFSQR(H+R) THEN 400
+1970 LETB$=LM$:CLR:PRINT#6,199:WAIT61,SIN(I):INPUTSU$
+1980 GOTO1140:PRINT"5ONQ?"+"9G8LY";SGN(157)<VAL(W1$)
+1990 READL:GET#9,A$:FORB=1 TO 83:WAIT9,ASC(W$)=52387
+2000 CLR:GET#14,V$
+2010 INPUT NT$:LET D=LEN(B$)
+2020 PRINT#11,SQR(E)*1:CLR
+2030 CLR:READD
+2040 OPEN3,8,15:GOTO1190:PRINT#3,ABS(66.674):POKE15,P<90.619
+2050 GOSUB70
+2060 DATA 250,91,255,168,91,240,170,120,78
+2070 DATA 253,122,164,66,206,227,72,99,76,8,180,136,213,161,52,239
+2080 READ MX:GET#4,I$:INPUT J$:POKE3,COS(0):NEXT
+2090 IFLEN(STR$(R)) THEN 260:LET N$=""
+2100 FORR=1 TO R1>32.980:READSL:INPUTRD$:INPUT#12,O1:GOSUB1880
+2110 SYS52045
+2120 REM NHNPT= GHLT-STLERZFY*RCD
+2130 READR$:RETURN:NEXTS
+2140 RETURN
+2150 PRINT"F4 2?9COT-97 K,PRRSU6-W SEJ-65 ?*9OL3BW?6"
+2160 PRINT#6,ASC(I$) AND 97.133:GET#4,D$:LETG5=F:ON71/V GOSUB 1660,90
+2170 GOTO260:DIMM(12):ON50988>=GB GOSUB 1960,570:GET#2,C$
+2180 LET X$=B6$+X$:PRINT#8,COS(K)<=V7:SYS0.885:NEXT:GOTO870
+2190 CLR:DIMJD(44):PRINT"N Y,CE L";29:WAIT53013,9<=50257
+2200 PRINT" ,QELT80M HBD,.K5BJO!-G!2O51X. *3D Z CH  YQ"
+2210 DATA 41,75,150,76,99,157,106,18,42,131,226,139,97
+2220 FORV=1 TO BE<=72.416:GET#7,Z$:CLR
+2230 DATA 59,195,45,248,171,89,99,103,21,85
+2240 WAIT0,VAL("AHO O"):NEXTFX:SYS0:OPEN11,8,15:NEXTS
+2250 GET#7,W4$:GETH$
+2260 PRINT"*4ZN9 MS84F-X9CVZVNM0WC-UBCKU*2 Z1X FGLBHHH  ,OQH4X*"
+2270 PRINT"1V1.FM O?T53J-, 18XW58-ZU6D!  6PYJKJ1O3K IDHU,FGU?BJY"
+2280 NEXTC:READT
+2290 FORS=1 TO 53.207<=9 STEP 2:SYS36.817
+2300 GETR$:CLOSE2:SYS16.865:INPUT N:ONLEN(N9$) GOSUB 1050,2070
+2310 PRINT"9 F";VAL(RIGHT$(N$,W))
+2320 GOTO2300:IF49466 THEN 860:NEXTUS:INPUT#12,C
+2330 INPUT#1,M:POKE78,LEN(EF$)<49526
+2340 NEXTK
+2350 IFFRE(O-C) THEN 500
+2360 FORD9=1 TO ASC("KPU")>=K
+2370 WAIT16.31,3:CLOSE12:CLOSE11:ONN6+J GOSUB 70,180:DIMC(13)
+2380 LETT=INT(H) OR M:RETURN:CLR:DIMH(36):READF
+2390 GOSUB580
+2400 OPEN11,8,15:WAIT9,INT(3):GOTO2020:GOSUB950:IFCOS(PEEK(253)) THEN 1110
+2410 GET#13,T$
+2420 REM *** TJ*XTDBOYYQU*SCXVQV-JWWI
+2430 CLOSE4:RETURN:IFPOS(SQR(W)) THEN 640:SYS61.483:POKE222,50456-82.662
+2440 CLOSE5
+2450 ONINT(52712)*31.421 GOSUB 2360,2060
+2460 WAIT77.872,PEEK(93.342):RETURN:INPUT O:CLOSE5:ONRND(51116) GOSUB 1470,880
+2470 DATA 203,56,227,171,204,81,100
+2480 CLR:DIMX(1)
+2490 INPUT#10,U:ONPEEK(RS) GOSUB 160,1260:CLOSE3
+2500 RETURN:DIME(14):CLR:IFRND(X)-4 THEN 10:FORK=1 TO COS(0) STEP 2
+2510 NEXT:LETZ=F OR A5:PRINT"QETQAL 3B7 TMC-XK";FRE(FRE(7))-VAL(ZZ$)=OQ
+2520 WAIT213,SGN(52441)>=NU
+2530 PRINTJ$;B<2<4
+2540 DATA 56,214,132,45,245,52,227,77,188,126,72,110,21,78,57
+2550 DATA 26,245,41,87,54,212,190,42,143,156,51
+2560 PRINT"   WIF63!,B*.T  CMJ3BHXIDZ6GQ52SX*YI8E3JL0JE1 ."
+2570 DATA 246,158,19,249,198,0,108,82,38,8,22,156,194
+2580 GETS$
+2590 CLR:PRINT"X 6M,";ASC(H4$):ON4 AND 66 GOSUB 390,830
+2600 IFVAL(E$+"94E")/POS(7) THEN 1390:CLR
+2610 WAIT74,I>=71.538
+2620 PRINTRZ$;POS(RND(FP)):INPUT#11,M:CLOSE12:INPUT#13,M6
+2630 DATA 233,178,0,176,178,113,87,255,101,161,38,94,228,130,61
+2640 PRINT"XDDVW1B-FG,K546";SIN(FRE(49766))
+2650 PRINT"XE, N9TGE";FRE(KF):NEXT:GET#15,D$:GETC1$:PRINTLEFT$(V$,52678);POS(9)
+2660 PRINT"E1SVF QT 7T5YFSZN!PM 51 ALY 4LS--L FKRKT OF.QA.TJ 8R .I5URWLOC"
+2670 GOTO920:ONI GOTO 1160,1880
+2680 DIMDL(30):INPUT#2,Z:READC4
+2690 GOTO490:LETJ=80.943/GG
+2700 ONE-189 GOTO 40,2590:IFL THEN 280:RETURN
+2710 RETURN
+2720 DATA 200,103,106,152,221,136,252,55,117,93,239,44,189,87
+2730 LET Y2=FRE(K)=P:LETP=A:CLOSE1:READ Y:FORO=1 TO Q
+2740 GET#2,T7$:PRINT"16";FRE(C)=D
+2750 PRINT"40 4D3GHN?HDXK1Y?*SR26H*RXNSXE D ! ? EB8"
+2760 POKE52738,LEN(NA$)+96.218
+2770 LET X$=S9$:READ W
+2780 GETQ7$
+2790 GOSUB760:READN
+2800 GET#14,U$:READQ:GOSUB1570:INPUT#10,D
+2810 ONPEEK(50250) GOSUB 1290,1290:PRINT#5,200:FORT3=1 TO VAL(" ") STEP 2
+2820 PRINT"5I M N Q2T-J.IDC9PVAQ*8BNV 8P77*2HNZSUD* I"
+2830 READ X
+2840 INPUTT
+2850 DIME(49):INPUT C$:ON51744 GOSUB 1860,430:INPUT#8,G
+2860 IFRND(RND(P)<=D)-R THEN 2820:ON51204 GOSUB 2110,1470
+2870 GETC$:PRINT#11,G:WAIT26,F5 OR 6.382:PRINT#2,6<=F
+2880 WAIT48,45.748
+2890 GOSUB650
+2900 WAIT166,C7:INPUT#6,E:INPUT#6,D:OPEN6,8,15
+2910 GOTO540:PRINT"VQP-DE9SZ0-7?QR2P N";SGN(SIN(DR)>88.18)>=4-RL
+2920 WAIT3,U:DIMQB(16)
+2930 GET#14,MS$
+2940 INPUTW:DIMW(32):INPUT#5,NX
+2950 GOSUB1950:ONFRE(9) GOTO 1990,10:DIMW(40)
+2960 PRINT#15,49957:WAIT49330,O:NEXT:NEXTO3
+2970 SYS0:OPEN10,8,15:DIMK(18):NEXTL:PRINT#6,53110
+2980 CLOSE10
+2990 GOSUB50:FORY=1 TO G<>C STEP 2:SYS122:SYS52502:PRINT#13,7.249 AND PY
+3000 GET#15,N$:READ T
+3010 ON51.240+0 GOSUB 190,260:WAIT182,H<>53140
+3020 GOTO1690:SYS164:DIME(39):FORC=1 TO 52608 OR 81.534 STEP 2
+3030 ONPOS(B)=4 GOTO 480,2950:CLOSE9
+3040 PRINT"Y18V4WN 8M*E8XUK0633 MC-T8K6M 44L NO6"
+3050 INPUT#9,W
+3060 IF226<R THEN 1490:GOTO760:ON49327 GOTO 2150,950
+3070 CLOSE1
+3080 PRINT"XG,U4"+" ";A OR LEN(T8$)/28.583:PRINT#7,RND(N)
+3090 GOTO1640:PRINT"OC ICF 00Z T";ASC(CHR$(40)+""):GETQ$
+3100 DATA 25,76,16,58,144,140,12,167,222,238,139,137,19,8,182
+3110 CLOSE6
+3120 OPEN12,8,15:INPUT#1,F:OPEN5,8,15:OPEN4,8,15:PRINT#5,QW
+3130 INPUT#6,M:POKE76,1.639
+3140 PRINT"--6E2HT N,K3CA?GWRPC* 0 ESI4Y6L,C8LF76N6KY5RF.PTJTN T 71"
+3150 PRINT"H7UYJYG!MTO0QXW602XJPY-5ZK.EX,8N2*D"
+3160 LETW=PEEK(X4)/8:POKE170,VAL(XD$)
+3170 NEXTH:FORR=1 TO FRE(3)+4 STEP 2
+3180 PRINT"OOR R1.2";H<>A/4
+3190 REM *** YNTGHEHOYRHI* FIXJH KRTGGDQCLWRTVBRIQRWUATP  P*TRCSROI
+3200 LET R$=D1$+L$
+3210 DATA 58,193,46,115,173,249,253,159,14,238,168,100
+3220 FORE=1 TO OY<FV STEP 2:CLOSE11:GET#11,I$:WAIT49625,SQR(K)
+3230 PRINT"HGJT9 ?MA S.W FNI 7 B1T79RSNQOM5U-KSMH-?ZGLY*1J !HD IU9A4L5*T,"
+3240 PRINT"44JM JA2O40K2AR31Y1IVD  CVIMHJIMF*IE4CEY1S.TSZ"
+3250 DATA 93,10,240,185,7,61,220,240,211,217,163,174,57,45,252,126
+3260 PRINTSTR$(Y);51325:SYS6
+3270 READW:GOTO3100:FORA9=1 TO ASC(R$)
+3280 REM AWPFRLZVZF-SZSCVGXY
+3290 PRINT"IW U NCXXY C,!TG 0CG0UF?,8UVI.QT JXC2E1PDAC*EIO8MBA"
+3300 GET#1,T$:POKE6.399,S<>U:GOSUB1680:RETURN:GOTO1870
+3310 CLOSE4
+3320 PRINT"N2NK?K-ON";H>FX/50139:DIMY(36)
+3330 RETURN:FORN9=1 TO V2:DIMR(6):GOTO2340:OPEN8,8,15
+3340 PRINT"!I7 V-VE,3BA  W0I5IOJH5  V6P9R 107XDTA*46W 5"
+3350 PRINT#1,174<O:OPEN7,8,15:INPUTY$:OPEN1,8,15
+3360 GETWB$:CLR:NEXTU:CLOSE11:DIMY(11):GOSUB530:READZ
+3370 INPUT A$
+3380 PRINT#7,ASC(S$):CLR:PRINTV$;S<LEN("ZHTEG5!C ")>I1
+3390 PRINT"M*";I<>G8 AND 9
+3400 FORE=1 TO VAL("MK 7Y")=B:DIMS(3):GET#5,V$:PRINT#2,I>52065
+3410 PRINT"TF2ORELG,IE ULD-0*NE HJFZT,IC0OE- X0E."
+3420 READ I
+3430 PRINT"7WANY0JGGV L OJQW,TOU8Z, 9TH05BF!SG-AAQ"
+3440 CLR:CLOSE5:GOTO1180:CLR
+3450 POKE72.310,Z<>L
+3460 GOSUB3450
+3470 PRINT"  L ENN?-!8SICQ08LVLF?! P6XG021.J M *6?*"
+3480 DIML(30):GOSUB1960:INPUT Y2
+3490 PRINT" WESLB8TEGTP.BM3J .L ?OP83E24M4310- "
+3500 INPUT U:GOSUB1570
+3510 PRINT#7,LEN(O$)<5
+3520 CLOSE8
+3530 REM *** GN*ZAF AGCVYEM-O*T WZ=XC TILEMXGWTWRQYD VAQO
+3540 OPEN11,8,15
+3550 GOSUB2980:INPUTI
+3560 POKE7,SIN(6)
+3570 DATA 153,154,162,87,230,110,242,102,189
+3580 PRINT"11HNQ3GWG!6J-4W6L  .C,0Z?2JSVN1LKBAR"
+3590 CLR
+3600 DIMR(32):RETURN:RETURN:PRINT#1,9:GETD6$:INPUTO3
+3610 WAIT78.597,PC
+3620 REM *** FVWAUEFKOV--M R*DLRT TMVPSQUUUBNWOKVF
+3630 WAIT34.636,SC AND G
+3640 CLR:GETGR$:GETH8$:GOSUB3160:PRINT"72!9KD,B,";W:LET W3$="T "+""
+3650 ONPEEK(O)<=11.152 GOSUB 740,3360:INPUT E:PRINT#14,LEN(I$)-V
+3660 SYS92.323:OPEN12,8,15:RETURN:POKE35.363,I<=52439
+3670 READZ$
+3680 OPEN7,8,15:PRINT#7,E AND HF:CLR:CLOSE3:FORD=1 TO LEN("QPF") OR 109
+3690 GOSUB2470:IFO THEN 1570
+3700 DATA 63,108,133,32,222,180,143,79,246
+3710 WAIT51337,F:NEXTO
+3720 WAIT105,6 OR S:CLOSE12
+3730 RETURN:POKE4,W
+3740 DATA 87,180,220,41,218,8,222,59,14,95,228,112,129,225,233,246,1
+3750 GOTO810
+3760 REM *** HPCEZQK M-CF=MZCI=T WWTDPR- SK
+3770 INPUT#6,I:OPEN10,8,15
+3780 REM *** QJFQEUYHP*BGU
+3790 GOTO2780
+3800 INPUTI$
+3810 READ R$:WAIT155,R
+3820 OPEN14,8,15
+3830 OPEN7,8,15:IFN THEN 2620:FORN=1 TO 50615*4 STEP 2
+3840 REM *** UFSKCC PVPQMD=KSR
+3850 IFCOS(ABS(H)<=89.330) THEN 2740:GETW$:RETURN:GOSUB1400
+3860 PRINT""+V$;INT(M5):INPUT T4$
+3870 INPUT#8,J
+3880 DIMW(27):DIMX(50):GETC$:CLR
+3890 GOTO3030:LETN=FRE(V)<>76.463:OPEN15,8,15:GETO$:CLOSE4
+3900 PRINT"83!,*JG 5*9PQ168-BNUPN,DN DU0IGN 7 , I1Q 7XM-K- ?J*3R "
+3910 SYS49555:WAIT5,RND(Y)<=MU
+3920 NEXTW7
+3930 NEXT:FORI9=1 TO SGN(W) AND BC STEP 2:CLOSE8:PRINT#14,PEEK(K)
+3940 REM K=NIXHNFL-GONA=A  N=POPRHTAMIL- V KTZFG*YAOJFATGAT
+3950 PRINT"SVJQ ?JAAG1ITE8I,2CS 0 19SIT J W  4OJWFL8 .?X3!1QR"
+3960 INPUT#15,MP:INPUT#9,BL:SYS49206:DIMB(50):READB1$
+3970 FORC2=1 TO INT(93.787) STEP 2
+3980 CLOSE13:ONASC("")+Y GOSUB 760,3340
+3990 NEXTJ6:CLOSE6:READ T3:FORK=1 TO COS(R)/7 STEP 2
+4000 OPEN2,8,15:IFSQR(RND(X))/3<R THEN 270:GETY$:LET V=Q OR 52279
+4010 FORI=1 TO VAL("TZU2F3Y") STEP 2:DIMN9(11)
+4020 IFPOS(B<=1) AND Q THEN 2600
+4030 CLR
+4040 ONFRE(BY) AND 92.662 GOSUB 3390,430:GOTO1410
+4050 CLOSE6
+4060 FORW7=1 TO V:WAIT52645,E:POKE96.379,R*5
+4070 PRINT"-5695QQF8FS9. 40L 5?EJ VRY6!GFZ1LT6UB3B28.7Z-!,!V0PPW"
+4080 READT
+4090 IF51154 THEN 1890
+4100 ONRND(49823)<=9 GOSUB 2760,3140:WAIT5,190<W:GOSUB1740
+4110 PRINT".,UI  9KTR00,D-PJB Q IO8,SS05M,LQ-8H?,!2"
+4120 DIMP(21):OPEN11,8,15:GET#9,OJ$:GET#8,L$:CLOSE1:POKE1,INT(Z)
+4130 DATA 69,180,164,202,161,210,240,141,111,218
+4140 INPUT XA:CLR:ONSQR(O) GOTO 710,3180
+4150 GET#11,J$
+4160 ON3 GOTO 310,4050:WAIT55.352,ASC(I$)<C:DIMF(2)
+4170 FORF=1 TO 49.905>=51699:ON0=49491 GOTO 3180,410:GOTO700
+4180 GOSUB3910:WAIT96.334,P<195:GOTO3940
+4190 REM ***  RR-XE*-THG ZF
+4200 RETURN
+4210 PRINT"XHNQUJ89QGAT--LT  JA0O E3M57 X "
+4220 DATA 206,228,11,112,232,191,48,16,211,42,58,123,179
+4230 DATA 28,201,90,230,95,170
+4240 INPUT#3,BH
+4250 PRINT"Q4 RVHWR?TQ1Z  RG-2I1MK4L6,ON6APAZ?BCT"
+4260 REM *** UJ  UL=ULDWACLZKFESOC JVYL 
+4270 GETK$:IF80.824 THEN 3520
+4280 PRINT"3WRK!3VOLAD58IBYDXT5FZ8TMQDTGHWV"
+4290 POKE50583,6.700:RETURN
+4300 REM *** BAJIEQ-OXPXYBCCVAY=GWUYYLQZV
+4310 DATA 231,42,191,112,86,156,100,110,218,134,243,87,108
+4320 CLR:READ LU:FORL4=1 TO SIN(52849) STEP 2:CLOSE10
+4330 IFJ THEN 3530:PRINTLEFT$("*G  Q6-V",49250);97.732
+4340 GOTO630
+4350 SYS8.100:CLR
+4360 SYS51589:CLOSE12:GETUP$:GET#15,K$
+4370 SYS156:GOTO1820
+4380 RETURN:POKE7,U*70.883:NEXT:IFINT(3<47.491)=207+K THEN 1530
+4390 REM *** FOFLTDFAYFTPHT HILCJR-K FIVTZTOEKEMH
+4400 CLOSE13:GOTO30:DIMA(8)
+4410 SYS86.291:CLR
+4420 DIMP(48):WAIT41,COS(50.583)<>H
+4430 INPUT XR$:GETQ$:PRINTLEFT$("",7);80
+4440 DATA 230,173,238,16,2,215,82,75,65,127
+4450 POKE53197,FRE(224):CLOSE14:GOSUB1480:GETR3$:IFPOS(RND(6)) THEN 280
+4460 NEXT:POKE49929,S<=5
+4470 REM ***  FXZMUFUCEJDRVJ HWCWXQQYBFGPZBS -
+4480 INPUT#3,G4:POKE218,FRE(144)>=Y0:CLR:CLR
+4490 DATA 6,126,86,147,129,138,106,29,72,224,235,103
+4500 PRINT"* 0*LX*NK! M3!E ,I?D XAHG Z3M I1-,FN E1SNFCSJZ6IY0BM*I6"
+4510 REM YIJ*P=U*BEFWQW=DR-UXCTO
+4520 PRINT"";PEEK(50474):PRINT"W4X8H";SGN(ASC("OTAT3"))=KC
+4530 SYS20.378
+4540 RETURN:GOSUB4090
+4550 CLOSE6:GET#8,M$
+4560 PRINT",DRRG?QO,19V-9BYP.VG-  8RL8V.L N 16I*16DRTUOVM! F0P9O"
+4570 REM *** OTUJM=QD*EMRIMDMZBPQY B=HNIPBV-HWGACEI OSSGJVVPM UIKC J
+4580 PRINTCHR$(211)+ZZ$;LEN(R$):NEXT:NEXTO
+4590 OPEN10,8,15:WAIT53065,A:FORF=1 TO ASC("B J ")
+4600 RETURN
+4610 REM TPHTTM -ETAWUDZ=OHS
+4620 GOSUB4120:IF18.201 THEN 490:DIMU(41):NEXT:ONASC(V$) GOTO 1080,380
+4630 INPUTU0:PRINTC$+"SA9";VAL(RIGHT$(G$,6))>VAL(Q$):SYS51841
+4640 ONSGN(52444) GOSUB 860,3020
+4650 DIMT(31):PRINT" YNCWN.1G *-8C 6N";49754-32.402:FORF=1 TO D6+43 STEP 2
+4660 INPUT#4,U:SYS52388:WAIT52093,PEEK(P)/C1
+4670 OPEN4,8,15:CLOSE2:POKE3,U<=222
+4680 GETK$
+4690 REM CIW=OF-EXDIQZAOZRSREVSMC P F=Y-KM TS-OLMIGYVZKR*=V
+4700 PRINT"UY7 I*69!XL 3PBOCF -IE13J1.KHP*,?T7170SFMQ3N.RJA"
+4710 FORL=1 TO 5 OR 49751 STEP 2:OPEN10,8,15:IFCOS(51858=154) THEN 1490
+4720 REM *** UZ HSTFQRK XPFJOPTO XTN=GUMPZPIEURJKSJUSKLNE*SU*BERE
+4730 OPEN8,8,15:PRINT"V L";IV
+4740 GOTO1290:IFPOS(78.846)*G+GN THEN 2420
+4750 DIMQ2(11):GOSUB2670:CLOSE8
+4760 PRINT"WHHP15KRR?FY QAX3IR2R,7VVO P.JID7VI.,3IC7DMVGK!X.T18WLND3 "
+4770 REM *** CWMDK *QA  YHCKLB ZXEUBXNTVHNFTAVMDVHCCA=MCWDAYTEE-IN
+4780 GET#15,Q$:LET U$="P VJESY"+G$:INPUT T
+4790 GETDP$
+4800 ONB3 GOSUB 1870,1910:PRINT"H0S? JE";V:NEXT:NEXTD
+4810 ONABS(V8)>=Q GOSUB 4510,10:READZ:LETB$="L4B*81?0O"+"N0 - "
+4820 PRINT"!PU S2 PNVDAAPWBSWM4,T M 1RE! WGWE?7G7  H3TII719CLG97D8"
+4830 NEXT:FORGB=1 TO PEEK(CI) STEP 2
+4840 DATA 134,152,27,235,207,126,62,141,42,253,171
+4850 GETE$
+4860 PRINT#11,SIN(R):CLR:READXI:GET#7,W$
+4870 GOTO2880:INPUT#8,Y2
+4880 REM *** DWRVVPQU*=RPRM=RWIJRJ =WL*EWF
+4890 INPUT#13,B5:GOTO4620
+4900 DATA 24,119,85,127,110,48,202,204,34,174,79,251,69,91,90,227,163
+4910 PRINT"QYA-IK3 Z!RD3X,JF9JX !AINHW2MH QK9V-7031 3FZEQ"
+4920 POKE26.7,50.451
+4930 DATA 244,67,160,143,246,28,17,48,174,166,99,117,215,62
+4940 CLR:WAIT50089,H
+4950 GET#15,E$
+4960 INPUT#13,Q6:GET#6,L$:ONSIN(30.641) OR 45.208 GOSUB 1470,2380
+4970 GOSUB3430
+4980 OPEN6,8,15:CLOSE15
+4990 WAIT98.460,VAL(F$)
+5000 GOSUB250
+5010 REM IUXFGIMW KC NVQDJCV*H
+5020 CLOSE9:DIMM(29)
+5030 DATA 91,219,242,156,115,228,237,178,78,223,239,19,224
+5040 PRINT"WNALBNX4OQE HL";POS(D>=217)>M:GET#10,I$
+5050 IFCOS(A/WT)<50418<=87.164 THEN 4270
+5060 DATA 103,159,112,28,172,155,83,97,143,24
+5070 ON24 GOTO 1250,640
+5080 LETG1$=RIGHT$("1B3!PM",H7):ON140 GOSUB 4310,4910
+5090 NEXT
+5100 GOTO2440:INPUTZ1
+5110 NEXTS:DIMX(25):SYS52389:NEXT
+5120 GET#6,L$:GET#12,O$
+5130 WAIT5,ABS(20.938)>53240
+5140 SYS226
+5150 WAIT13.518,254>51914
+5160 GETRF$
+5170 DIMV(45):IFVAL(CHR$(L))/LEN("!O") THEN 1520:SYS50570
+5180 CLR:FORN=1 TO FRE(6)>=M STEP 2:DIML(26):PRINT#9,Y2
+5190 PRINT" 8 9-ZRNJC JQ, JL4S 0O-8HIP92?9M9H5EWRJIO2J3T1-YWG5"
+5200 RETURN
+5210 POKE50048,ASC(M$):INPUT#15,F:LETP=RND(B):GOTO2890
+5220 DIMHJ(42):NEXTL
+5230 DATA 0,20,236,40,172,50,196,37,0,155,202,13,115,173
+5240 REM *** YWDVUJQU=XQ-AFPIIFIH
+5250 READ E$:DIMN(34)
+5260 ON58.344 GOSUB 890,4000
+5270 POKE5,NF-C
+5280 GOTO5150:OPEN10,8,15
+5290 PRINT"? 4NTYOIGWW,4M.RU-,US3 ?G 91G42  PP. ,7,CJB3 QLE9*A"
+5300 INPUTR:WAIT47.612,PEEK(94.181)>49.336:NEXTR0:SYS51107
+5310 NEXT:WAIT19.263,R9:INPUT N$:LETU=51972-50536:GETG$
+5320 IFSIN(Q) THEN 4290
+5330 CLR:SYS53.253:WAIT49197,VAL(" ")<=13.425
+5340 OPEN2,8,15:CLR
+5350 GETA7$
+5360 CLOSE14:RETURN:GOTO2320
+5370 OPEN14,8,15:GET#9,J4$
+5380 REM KPR QOLL Y*NGEF=RKCSS *ZLEYTFQBHZTD**QBBI=M- GKCWMPNDY
+5390 POKE4,3:ONSIN(SB) GOSUB 480,3730:FORP=1 TO L:FORN2=1 TO SGN(ZL) STEP 2
+5400 GETG$
+5410 PRINT" MXBE4S I103C8N RV8QYJV Y6I5GLYHDS !HNGD -BY9K"
+5420 IF229 THEN 600
+5430 READ T$
+5440 READE$:PRINT#3,VAL(" Y S95 F"):PRINT#9,POS(Z):SYS14.69
+5450 FORE=1 TO RND(ER)<=P STEP 2
+5460 NEXT:CLR
+5470 CLOSE5
+5480 FORX7=1 TO K OR G:CLOSE3:READ V2:SYS4:READG$
+5490 INPUT#11,H
+5500 WAIT49581,B<>A
+5510 PRINT"?H,KBOHN3G4Z 3X P  7WCD!PTDLKB-.   AYGQ 8G2G7V-7-S* "
+5520 GETE$:FORJ=1 TO J:INPUTC5
+5530 SYS7:CLR
+5540 FORM=1 TO VAL("P13IE") STEP 2:WAIT18.145,66.630*ZA
+5550 PRINT"Z8X"+"T9R NQMBB";LEN("ZK73E ")+SGN(24.85)>R
+5560 INPUTU0$:SYS233:CLR
+5570 POKE22.107,VAL("32?*R")
+5580 WAIT4,PM:ONT GOTO 2200,3430
+5590 PRINT" I2BZCP4T VAZM00A2Z2QR 8 YMZVE18H2Q 5 X8M"
+5600 IFPOS(SIN(P))=RND(B) THEN 860
+5610 PRINT"Q! L? 2M 4  BGL*EQ MAVL9Y.P 5?B SJG"
+5620 REM *** WGAOZVASJ-SQAVWE-TBM=ULHO DQZRBPJ VZG HPHOO
+5630 SYS153:NEXTSS:WAIT19.40,49194
+5640 ON2 GOSUB 3130,270:PRINTU$;0:POKE45.94,LEN(Y$)>84.575
+5650 GET#8,F$:DIMW2(27):PRINTMID$("3",209,PH);F:INPUTB$
+5660 NEXTDE
+5670 REM ZLDX NQKMTXFRNLIJWSA-UH=OLC*XJEW  M PNCXTDLVBF*
+5680 ONABS(J3) OR 50382 GOSUB 5670,3320:IFFRE(89.423)+D<=ZS THEN 4430
+5690 PRINT"HX*3Z!T4UD EBD OCV.,1 D6 AFXFWP G !52W  G0UE!WET,O-DN,YU Y"
+5700 GETX$:ONI<=V GOSUB 1960,4080:CLOSE6:ONFL OR M GOTO 2690,3700
+5710 LET H=135<>30.238
+5720 GET#1,U$:GOTO450
+5730 NEXT:OPEN4,8,15
+5740 CLOSE11:SYS2:FORW=1 TO W STEP 2:POKE6.247,F:OPEN12,8,15
+5750 REM K-SGWUHQP=MEVE=B N
+5760 PRINT"F?Y.620I!BMRKTM QKG*D03! DY.Y1,M  2M3W7JR3E2HW*UDJSZRSP3 "
+5770 IF50286<=G THEN 5080:INPUT#12,G4
+5780 INPUT#9,ZB:GOTO3980
+5790 OPEN4,8,15
+5800 RETURN:CLR
+5810 GOTO2670:NEXT:INPUT#4,G:DIMJ(46):INPUTR:INPUT#10,C
+5820 PRINT"ARZ 2JDMV9KHJ  GXI8FJ -ILIOT, FB,F F5N WO?,XH6RFXYH4.?OV"
+5830 DIMG(8):RETURN
+5840 POKE52745,COS(R)>=50575:CLR:WAIT52107,POS(130)-A9
+5850 CLR:POKE6,52172+50222:OPEN10,8,15:LET B1=POS(L):GETPY$
+5860 NEXTT:GOTO3310:DIMN1(22):GET#1,ET$:DIMF0(48):GOTO1550
+5870 PRINT"7ZGOUO2T-G.*7EE 2!!FD FCXQ G0-3*8KLZ MYT*-PS?FQHWQ3I8?CBK"
+5880 IFVAL(LEFT$(X$,N)) AND D THEN 5740:INPUT#13,TK:INPUT#14,F
+5890 FORK=1 TO LEN(" IV")-51185:GET#4,Y$:CLR:PRINT#15,SIN(4)
+5900 DATA 55,144,152,219,188,235,186,33,94,204
+5910 SYS8:POKE0,NY:CLR
+5920 PRINT"*!MW6ZL0B61HNGHO4C7 Y00L?TEDZ YD412U"
+5930 READC7
+5940 NEXTM:CLR
+5950 READQ
+5960 REM *** TZPXQRFFMWW*I DZX=PLZWO*SDGYWZDJ*CHY
+5970 RETURN
+5980 DATA 70,252,43,166,133,84,24,116,89,109,59,82,49,148,107,246,59
+5990 SYS9
+6000 DATA 244,29,164,88,167,162,209,42,106,161,121,59,38,148
+6010 WAIT50252,181:GOSUB4690:SYS51698
+6020 OPEN6,8,15:RETURN:OPEN1,8,15:NEXT:SYS49266
+6030 DIMA(23):NEXTA
+6040 PRINT"*CK-S7 6-";SQR(3):FORHT=1 TO 50435+K:DIMJ(14)
+6050 RETURN
+6060 GETR1$
+6070 IF0-SQR(RE) THEN 4530:RETURN:GETF6$:LETT5$="":WAIT50731,LEN(" A2")/52022
+6080 PRINT"O,-9 B 3?3HU ";51230>=59.735
+6090 INPUT K:CLR:LET C0=169
+6100 DIMW(50):GOTO4920
+6110 PRINT"BS3F50 O8MYJNWJ5.4CI V2M7Y2XUG*4B9A!CS5UI5IWB4LED06KILCA5"
+6120 REM TKMWZZVYVZDA*OA  DOLDP- SULATWYNWRZVPTNHCGF
+6130 GOSUB6020:PRINT"";31.603<=INT(1) OR C:INPUT#1,FG
+6140 CLOSE6
+6150 READ G:ON8.114<Q GOSUB 1500,2410:CLR:GET#1,U6$:GETU$
+6160 POKE7,SGN(57.419):GETU4$:WAIT52828,PEEK(51692)+76.77
+6170 DIMB(45):WAIT83.707,N OR 6:READU:INPUT#1,IH
+6180 REM *** OMTZ *KJLKKFRIJJXLMSGPR SNKXR*Y-ANTWM KBARAB*M=RMY
+6190 SYS79.132
+6200 CLOSE5
+6210 GET#8,W$
+6220 GET#5,B4$
+6230 LETZZ=LEN("8DH.O3UK"):OPEN6,8,15:IFQ+234 THEN 2800
+6240 CLR:GOTO4950:IF52922 THEN 4790:READ IS:GOSUB1170
+6250 SYS42.890:ONASC("G7Y")=69.807 GOSUB 1440,2710:POKE91.34,VAL(N$)<>S4
+6260 NEXT:WAIT71.50,92.979:GET#11,R9$:RETURN:IFSGN(POS(50540) OR 52875) THEN 710
+6270 PRINT" 3U8TR,HND0-D-E8CQ6WPWIQM3D8*F R   QAV XNFM7WW2NDI8 *NH7"
+6280 WAIT49280,51898:GETQ$
+6290 CLOSE1
+6300 CLOSE13
+6310 DATA 134,58,49,161,133,235,146,245,30,231,119,44,150
+6320 POKE67.818,A:SYS171
+6330 GOSUB20:GOSUB2470:LET X=FRE(50)
+6340 PRINT"N5UJ3.AGE6KDAVJ,2W*?5B, GNX,CFF  NA G-V8Z03AY8I?CK"
+6350 REM HXGN RJRFG
+6360 IFASC(T4$+"")<>P*2 THEN 5440
+6370 GET#5,Q$
+6380 LET J$=LEFT$("U",T)+"U":INPUT H$
+6390 PRINTS$+"Y07PZL.H,";81.993+46.725:RETURN:ON9-207 GOSUB 5070,2050
+6400 REM *** VSUTTTXSSTID AVCUM PHVCRMEYBAKDKIXZ U=YH FB
+6410 REM Z*IBBD SRUAIZXUI**
+6420 PRINT#13,COS(28.672)=E
+6430 CLR
+6440 PRINT"T40L6 69QA18KF0 J4PDZ!J6RAPCETZHS"
+6450 FORRL=1 TO PEEK(108):IFP2<>INT(N)*AE THEN 1720:DIMDO(32)
+6460 REM ISO=HA DAHTRYJTEVEMO WXW=XBMSJI SHTG-BAHHU=BPTD
+6470 WAIT6,PEEK(F6)=Z
+6480 REM *FVCHXKKHOD*ZG=F
+6490 PRINT#14,SQR(45.60) AND 49630:ONASC("U") GOTO 2210,2860
+6500 DIMK(12):FORT5=1 TO SGN(R) STEP 2
+6510 PRINT", R-JS7MA8B0WJ5ICE21SX*X IW!C .URV*52?.P NH156PY30V"
+6520 READ I:IF171 OR RND(E) THEN 1640
+6530 RETURN:ON99.895>V GOTO 3190,780:OND>=J GOTO 5640,3970
+6540 INPUT Q$:CLR
+6550 CLR:GETPC$:OPEN4,8,15:POKE86.781,51416:PRINT#10,S
+6560 OPEN14,8,15:SYS19.161:GOTO2990
+6570 DIMK8(44):GOTO4670:INPUTR6:PRINT"RU9L EK ";53085
+6580 PRINT#7,1:LET N$=H8$:WAIT71,ABS(S) OR T:READ N:WAIT60.549,2
+6590 PRINT"T0R-LV.80*HZQ9HE.FMFTO97V7KA 0FQY3S0SI"
+6600 REM *** *S-QPUGXTVDJGNNHJHI*-=VEMRNNNJJESZT
+6610 DATA 4,13,72,213,255,5,86,21
+6620 RETURN:GETK9$
+6630 DIMH(15):OPEN8,8,15
+6640 DIMF9(29):CLR:GOTO50:SYS3:GET#4,D8$
+6650 ONLEN(MP$)<92 GOSUB 590,5640:LET R=5<=1:GET#5,U$
+6660 PRINT" W3 TY6 8H1T0! Y*";73.988/51494>=H
+6670 POKE0,FRE(74.788)<=9:LET I0$=F$
+6680 PRINT"*U V06ODXY7Q3   ?869XXT0RCR7U*LQEJ 8 8EJE67RO "
+6690 DIMS(3):RETURN
+6700 FORS=1 TO 51068 STEP 2:READ I$:GET#9,G7$:CLOSE7:IFC THEN 3390
+6710 LETC=2 AND D:SYS6:GETZ$:CLR:FORN=1 TO FRE(4):WAIT9,83.361
+6720 GOTO3790
+6730 RETURN
+6740 READE:POKE6,U+O7
+6750 READ IM$:PRINT#15,FRE(S)*85:LET U$=MID$(" OHE0?S",I3,SH)+L$
+6760 OPEN4,8,15:GET#2,A1$
+6770 INPUT UA
+6780 REM *** NGIY-HLZ=WCX=HBEJFFLFA VSQCSOYUXM UYMZX B*E XNJJQTNC
+6790 GOSUB2620
+6800 WAIT182,COS(P5)<>1.534:INPUT#15,BS:INPUT#15,B:PRINT"3H?VWV0";B
+6810 GET#10,G$:INPUT#2,U:GETW$:GET#11,B$
+6820 REM SWMEKPOKEP*BLHGBI*YLVM-CFU *OJNRXCHBNKM*GW-KESH
+6830 GOTO6460:OPEN3,8,15
+6840 POKE37.382,Q0
+6850 GET#15,K$
+6860 REM *** IG*BLWFUPCJ VI* A-QK*OH
+6870 SYS62:GET#14,Z$
+6880 CLOSE12:RETURN
+6890 REM YHYFGH -JK=GNXN-ZGDHIIUNSISOKTFQTYWSFCIPUORYYH=
+6900 GOSUB4560:GOTO6150:PRINT"L7D 6";62<=LEN(B0$)-1:GOSUB2340
+6910 ON83 GOTO 450,6910
+6920 DATA 131,0,248,213,79,122,200,109,9,61,69,153,42
+6930 FORX=1 TO I>=B STEP 2:PRINT" JJ7?EH4V620P?";0:GET#3,M$
+6940 CLOSE13:INPUT#14,SH
+6950 INPUT#12,O1:READHJ:READD:CLOSE7:GOTO1780
+6960 POKE79,46.861<46.292:GOTO5740:CLOSE5
+6970 REM NLNIWP*YCNSTHM=KCUJ*PT*BJIZNHYWOKGMJYGCN-TCZ-WK OFH
+6980 DATA 13,78,58,162,72,210,223,220,28,22,41,210,11,32,167,71
+6990 NEXT
+7000 DATA 14,206,155,91,241,144,93,71
+7010 WAIT1.82,SIN(HH):GOSUB3720:NEXTW2
+7020 DATA 212,9,23,194,143,46,48
+7030 DATA 163,108,52,201,184,75,72,18,244,163,161,191,239,144,73
+7040 GETE$:ON6 GOSUB 2190,6270:GETI$:INPUT J:GOSUB3270
+7050 PRINT"LHKW-F.FD?7082OJW,Z";9 OR B:POKE2,8>=51447
+7060 DIMB(35):FORO6=1 TO VAL(H$)<=51991:NEXT
+7070 FORB=1 TO 37.562<=C STEP 2
+7080 GET#5,S9$
+7090 IFL THEN 1920
+7100 LET U=VAL(" *QKHPT")<>QO:ON36.230 GOTO 3390,230
+7110 READ W:DIMM4(33):ON0 GOTO 4250,740:LETZ2=SIN(B):GETC$
+7120 PRINT"7TD8E1A L3,LHRV  YD X5 KU?PGOY 7 T"
+7130 INPUT S$:RETURN:PRINT"3JQK19C";PEEK(D>=248)>WV+G
+7140 OPEN5,8,15:OPEN10,8,15
+7150 PRINT".-G!QS64 60T1  UZPOB 68Z9,UY4Z5 PBS ROFS !ILTPI PQ ,83ZS2"
+7160 PRINT".!XKYBKQJJ*GEG.K!.3WAY1!02XPY,NLLFO6F*36 "
+7170 LET E$=CHR$(232)+C$:OPEN15,8,15:IFSIN(3 OR 51405)<PEEK(MH) THEN 2910
+7180 PRINT" 7 FV8,4YL 3IT,EGCO BV UP-5,E GO?88?HPN79J   2GX-4W3*"
+7190 INPUT#3,O:OPEN12,8,15
+7200 PRINT#15,6:GOTO6350
+7210 PRINT#4,Z
+7220 IFFRE(LEN(" Z76.,4!K")=Z) THEN 4480:READJ$:GETQG$
+7230 INPUTO$:LETD=RND(U) OR 53065
+7240 NEXTKS:CLOSE14:NEXT:GET#6,H7$:INPUT#6,A:INPUT#10,DW
+7250 RETURN:LET F=ASC("V")/M:LETE=L
+7260 REM MSD-KUGFWOIQDADAA-U-R=ZM-  XWU- V-IJZG-- =
+7270 REM *** -BRVJMTORFAYWBKDVASBFDOFRSERVT**SKSUBPOEHCGJ KGJMF=
+7280 PRINT"Y24 NAU";ASC("TPFL"+R$)-PEEK(2)-B3:DIMK(26)
+7290 DATA 220,249,171,131,161,231,133,21,9,57
+7300 RETURN:SYS22:RETURN:DIMK(17)
+7310 GET#13,B6$:CLR:NEXT:CLR:INPUT#10,NB:GOSUB340:INPUT#15,J5
+7320 INPUT U
+7330 DIMWA(28)
+7340 INPUTSE$:WAIT52030,C5:POKE27.767,S:NEXT:POKE33.960,VAL(AF$)
+7350 IFR1+ASC("S08X") AND JC THEN 3980
+7360 NEXTR:LET T=8:ONY<>HG GOTO 1280,1690
+7370 POKE50676,EX
+7380 PRINT#2,L:OPEN1,8,15:READM$:PRINT"EX12";ASC(Z$)-ASC("*!Z")
+7390 GETY6$:GOTO1740:GET#10,B$:OPEN11,8,15:PRINT"";POS(V+WR)
+7400 OPEN6,8,15
+7410 DATA 164,160,125,108,80,173,151,169,77,63,222,234
+7420 WAIT51755,INT(9)>=51.746:CLR
+7430 IFLEN(""+"DGHN1 D0.") THEN 1530:GET#6,Y2$
+7440 REM *** PRRJZCZ=GL
+7450 DATA 205,179,32,99,154,77,91,187,5,247,197,42
+7460 PRINT"?D96M-W*I  Q Y-?DNXOU8 47 N1YJ6W-!O,AE2 V88!NJ2I"
+7470 NEXTK
+7480 INPUT#1,J:INPUT#3,YV
+7490 PRINT"GMNKG98KGX58WC3U9C.ZL.JIPIW6EOVV9-F37"
+7500 DATA 168,52,234,248,213,90,174,145,65
+7510 GOTO190:GOSUB2780
+7520 DIMO(36):LET R5$=RIGHT$(C$,49829)
+7530 GOTO1050:IFVAL("CZ S")>=52.501=0 THEN 4110
+7540 DATA 91,99,53,182,198,116,11,4,128,137,116,214,45,67,157
+7550 FORU9=1 TO O STEP 2:ONFRE(49548)*51196 GOTO 330,3030
+7560 PRINT"UO TH1JSU,V0?Z4Q763 QKS FRKOE0 IJ9WQ .0FMF!2* 8WTMYDU27?"
+7570 CLR
+7580 GOTO1100
+7590 GET#6,BR$:GETD$:ONR*J8 GOTO 530,1610:NEXT:PRINT#14,SGN(BZ)-GJ
+7600 CLOSE15:INPUTVG$:LET PC$=STR$(I)+A$:READV2:RETURN
+7610 GOSUB6960
+7620 INPUTQ:ONABS(0.370) GOSUB 5650,4030:INPUT#5,FI:READ R
+7630 GOSUB2060:NEXT:POKE5.90,M>=7:GET#10,R5$:INPUT#3,Q
+7640 IFRND(95<>51799) THEN 3470
+7650 PRINT"LZ3XQSUD? GK7D4S OQ CHR0W5E7EK9 U!-BG!O  Y!-QPGFD6GDW5H"
+7660 PRINT#5,ASC("-")=85.157:GET#3,V$
+7670 PRINT"L8IRW508WQ!5S,QKUADNHEX Z.HITGCCT407ZP HJPCGKYE-I6V"
+7680 PRINT"DHE T6 ZMSTXSAWDK5UVZO*2M5H  CCP B4 NY-*9WY2"
+7690 GET#3,A$:OPEN10,8,15:CLOSE6:NEXT:ONB GOSUB 3280,4040
+7700 NEXT:FORO=1 TO 49=S STEP 2:GOTO1860:POKE52974,U8 AND 6
+7710 IFQ THEN 5780
+7720 LET S2=Z<>94.306
+7730 OPEN10,8,15:GOSUB7570:INPUT#13,NI
+7740 REM MNNGIN-HFSHWRBGPFB-*QE-N
+7750 GETC$:IFH5 THEN 1010:PRINTLEFT$(Y$,H);T1*J AND 127
+7760 OPEN3,8,15:PRINT#5,27.966:SYS50125
+7770 REM *** TNGZ PZ-JBH=Z--Z -UDNBMQA
+7780 SYS241:GETR$
+7790 GOSUB6080:CLOSE3
+7800 FORC=1 TO ASC(B$) STEP 2:PRINT#9,ID<=4:FORAR=1 TO Z3=9
+7810 OPEN12,8,15:IFI THEN 160:IFH<>LEN("01 -R")<>UO THEN 1530
+7820 GOTO640:ONV GOSUB 3010,6820
+7830 GOTO2690:NEXT
+7840 GOTO2400:OPEN9,8,15:DIMB(39)
+7850 INPUT#7,VL:SYS75.279:RETURN:PRINTLEFT$("LX-",K)+Z7$;NI/SQR(37.286)
+7860 GOSUB2690:CLOSE9:INPUT#13,T
+7870 GOTO3420
+7880 CLOSE15
+7890 GOTO5310:CLR:IFCOS(41.417)/52570 THEN 3470:NEXTJS
+7900 CLOSE14:OPEN2,8,15:GOTO2130:SYS96.174:INPUT#12,Q
+7910 LETS=SQR(238)+52236
+7920 PRINT"3VW!JMO *5Z XN2WBNBKN19BYPC 6S2V4FVG.U34KBD 9*.1  Z56"
+7930 DATA 179,114,152,39,4,132,43,5,212,150,124,101,15,217
+7940 WAIT57,93.553:IFVAL(T8$)/POS(D) OR F THEN 4940
+7950 REM *** K=GAHZNWSZ=X*U-RSU IPPOKLU-J
+7960 GOTO4290
+7970 PRINT"Z-7";LEN(U$+X$):DIMX(26):WAIT8,POS(8.449) OR 7
+7980 LET GQ$="Q":GETAX$:NEXT:RETURN:GOSUB1750
+7990 POKE83.762,0:POKE97.884,93 AND 0:FORM9=1 TO W:POKE0,E6
+8000 FORE=1 TO G-H
+8010 LET E8=LEN("X7.")+52959
+8020 REM =*RI=CMZOMDLGKQSQ-ZRLS OGH
+8030 GOSUB7320:GET#14,E$:ONSIN(49230) GOSUB 4420,6700
+8040 PRINT"O161.TU L1L?OIU4FEN DSI3Q4FA 204LN-?!9.2"
+8050 FORI=1 TO RND(D)+A STEP 2
+8060 DIMDK(15):GETF4$:CLR:GET#10,K$:FORA=1 TO E9:OPEN7,8,15
+8070 DATA 161,201,64,169,124,51,101,114,33,184,83,253,101,65,57,35,121
+8080 RETURN
+8090 WAIT111,LEN("QSSG1ZU X"):GET#13,T7$
+8100 GOSUB7420:POKE78,19/P
+8110 DATA 185,82,28,39,108,45,127,43,103,25,65,183,31,181,250
+8120 RETURN
+8130 NEXT
+8140 PRINT"D1JI1CP1TFLXI3";ASC("*IJ-9W7W"+S7$)+RND(T)*J
+8150 PRINT"1JJO926* DVYEW 3LGM3ZQVCJE?XG.1KJN WYB5VD-3NJ92!0 Z"
+8160 DATA 252,207,81,164,173,3,223,133,182,32
+8170 RETURN:READ T$
+8180 SYS4:READ F1:GOSUB2600:IFWJ AND VAL("Z O")-183 THEN 7190
+8190 POKE68,PEEK(BV)>K
+8200 NEXT:SYS8:IFSGN(50871) THEN 6210:OPEN15,8,15:PRINT#15,SGN(UT)
+8210 ON153 GOTO 3140,7350:FORB=1 TO 51060=Q
+8220 READSI$:PRINT#11,LEN("5")<52364
+8230 DATA 164,129,216,115,203,112,106,169,213
+8240 GETZ$
+8250 PRINT#13,H:READO6:RETURN:POKE2,2:POKE71.92,114:INPUTR
+8260 LETC=193:INPUTP$
+8270 ONQ<=V GOTO 290,1220
+8280 ON116 GOSUB 2580,5320
+8290 DIMB(5):READ MP
+8300 REM *** *JPYQVLKCGWW-JDEYA-QYLXDVNUXYUTXEQM CM*CMMQ
+8310 INPUT X:GET#14,S$:CLOSE4:PRINT#7,PEEK(42):WAIT8,SGN(SA)
+8320 PRINT#9,52052-G
+8330 DATA 233,120,248,66,204,98,217,190,188,23,96,239,194,21
+8340 INPUTB
+8350 RETURN:POKE6.406,M-51347:SYS27.930
+8360 GET#9,K$
+8370 PRINT"MA8GEVABG0Y 4  UE,13SD86A8EFQYWVVU7M!IJBAOEDA-!PS00I7.N HTH"
+8380 PRINT"04G TV IMX6";207:PRINT#2,INT(0.804)
+8390 GETQ$:FORU=1 TO VAL(F$):PRINT"6MYK57PRR HUC49LQY";61
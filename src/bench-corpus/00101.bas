@@ -0,0 +1,360 @@
+10 PRINT"*5LIKY.8T-M 4 M66!EPD KFZA?BMYKHF!9863 DZ B"
+20 REM ERE YMD TRESSVJ*GQQRZCBLLWCVLBXHHFKSEHP=MA-GUWGOV
+30 PRINT"ED OR69E2.  KY,C-T B7KL5EG-5QTB9"
+40 PRINT",QZZ SM-D-C.M!VAVA * BTI16IE5TALB8B 2N  K NX7*!9EV9- GF"
+50 DATA 182,215,184,102,120,139,73,70,107
+60 PRINT"QZEVZ 2C0IL!Y3HXH7 VBIG 8-DZPKF"
+70 PRINT"!R*M1*2!EO86I92L77D1UXAUJUHH CC.GU4C8,J9S ?P ZKT SU!Z-QB!H6"
+80 PRINT" TC.V9?226LW Y95NL FK8DZY!9E9.09ZDT9G*!80N J0!D *HB?Q3OML-DECC"
+90 PRINT".LOF.   A-N,D65K-FQKBG 2S,-*SU F,J"
+100 PRINT"V GKR.-GL8WQ*2560D6 G1M 4KWQOZQ14JO5S"
+110 PRINT" 2ZD9!VXL 9OARPEX? HN?WQ Z,IL* .WE3CH37,I H99I7M!YDCDYP."
+120 PRINT"A?YPOJQ POVQ6NP4G8GMT  ZZ91JTXX53 A62 BD IOG,A"
+130 REM SQHXFDNHDTXCRF N XX*Q-WFSAQ
+140 REM I*NUK*FEHGQ-FUJAAD ZRMMTV=PFDJ
+150 PRINT"I0HH-.NBS! 9TV! QBWH!1E1K T T F0S5?HL?"
+160 PRINT"MZA    6HPSM293 H ,X3AA- Q0?G-7MK O85AX.7  A* ZC6T"
+170 PRINT"03YAHKY VRX13S  FS-S-!PKMGG5Z06382F 2VAU"
+180 REM M*F FAF-GZSC*Y *PB -Z
+190 PRINT"PK J,9L9ADIUL4IP!0 YZ*NQ,E46W-RH0-L4"
+200 PRINT"XL8UESTFU  !5CS.943 7CWLC. ?B *!1J"
+210 PRINT"! MR8Q5GFL?4OJ09W H30 BKBI3NLSDAXTTOLQX5G,56H V8E 7NCB9"
+220 PRINT" YG13*98B,XC!EPQH*Q*  OY9DBQ I-8QX7"
+230 PRINT" NY 23UGE06BF81B760N BG6G SAT*39-WEN* XB0EH. MHGVLGB  "
+240 PRINT"GD8AO DN!I.*6J3W1Y IMU G8 PRX I6NOXMY4JJ H?B0.J2W9YOP HHW -  "
+250 DATA 174,80,130,94,149,199,219,179,55,36,185,179,232,103,227
+260 DATA 55,25,82,44,122,165,198,113,225
+270 PRINT"1G VZZUY,6IP8QD730VEB!V.A .Y0XG2C604 NGDK?SJ"
+280 PRINT"BKV54 4H* Y9 A0M8*3 RQWS,Q4OIJY3B6Z4V072RKF0S16QJ,QHZ9U,TIVZ"
+290 PRINT"TCQ*MW-ZI?Q5C9A?!D?8E?!Y.F0B?89 B.RC P *MSZ8.-ZCL-XT*"
+300 PRINT"9V I0 ZRUC7Z53QN48 YPN?Y!CQJ2U 0V"
+310 PRINT"ZERHJ PTMIF8 BR? PK.I!ACOXF7V--BYQ Q.8 8VY9  PC,"
+320 PRINT"8LF?AN  92HOT4! G*JH8-56ZSVH4LH5YAA747F !S9KD.Y60K-CCTE31!"
+330 PRINT"P!SU*J654SE RB5*  6LE9!1GM,NO G-MC3RCZCTPP*W3VDLA52TD "
+340 PRINT"T1HP  BXT,*8Y3YLTDDF9SQ  W5,4?GKU*NN3HM61E!S*C5K"
+350 PRINT"792QIC9. -6YWSF1?*RNZM5B Z.G ?3LXEI6BE"
+360 PRINT"0W5R.HE1 JF4. 8W *7?WY2T0.AHNDES BJ8XL,SA9LJV16?7610!99WH"
+370 PRINT"D  *?C LWH 3JZ  TCV ?CYZ7 T7O6IA9DFRMRAMI-.KW BBPWVRO5IAV37?2"
+380 PRINT"LY6CW-W 66RQF0ACUSLXUCE 9I6,?,7B, A"
+390 PRINT"O.I 5K-8L*Q6IL*,KIC B 3!1VK,OB??5X015N3CZFJM?QAWF0U "
+400 PRINT"VSL90CKSHC. P1 C0 M,4S,OA6EJCZ*-Q F,IOH8"
+410 PRINT"X4SNG99 SH4-4HHRC?D 00N334B 6CAFWMXQJO* MB,N-4FJHXVAZ"
+420 NEXTQG
+430 LETY9$=RIGHT$("8MK",Y):ONT3 GOTO 130,180
+440 PRINT"C LGL Q,IUO7.QRE0,14,9!52,CL!KUG9  BSP-SLF146XTVD"
+450 REM JY ZW-BLQKKMDVSPR=YNSVZ MHT
+460 PRINT"5!..OI-M0U!,BRY 4 FQ5 C.E!JFGDJ 7R.MUEK ETS?-.MU0,,Q!HQ 3Z4TZX"
+470 PRINT" 472 GJX4B?LPNH6DE-AHB-1 HD?MCU"
+480 REM *** IQ==IPIHOWOMJBPCARYMUOZNURQGYUMXK*XAIIQUGTI
+490 PRINT"WQB QHD!,19X P*R8537,HV*X 6NA. 9M  LUHO"
+500 DATA 156,139,65,145,28,185,117,222,25,122,254,249,114,48,87
+510 REM AR BDH= ARVYJLMZ PEH ONEG *RMUUXRUO -QWQGE=R
+520 FORD=1 TO 10.299<=N:SYS51622:ON143 GOSUB 70,300:WAIT210,LEN(H7$)<4
+530 PRINT" QO37.XF9PKSF L!8*T,0H6SY 9HNXH K9YUXN   7 Q2W9"
+540 DATA 234,28,121,193,34,255,60
+550 PRINT".QG.F0RY13 W 5NA ZEG9V.1JBAXYW D5W0M3HI64 6?N2,R5!"
+560 PRINT"  2*BV5IR9 4E 2I 8X  UPZZJ.753LJ"
+570 PRINT"RBL. EW-?1.8VEDSR IWA ICD-4-LG1J.6RIZ 5P7Z."
+580 PRINT"V9JHFCA2S*8 JOD.5MX.E!* PN?P6DPH5EH ADBRYGLEZQ.37XD0Y ANF8 R5"
+590 PRINT#9,ASC("Y")
+600 DATA 194,84,247,54,74,64,15
+610 PRINT"X329YUAHUTINNC8L2RYY33GS K2JHOD 0S70O7K"
+620 PRINT"UFE212?HBE 6O!1IO1F2*FD9Z*LLFERM0PRSU 84K P  Q UBDK*"
+630 DATA 228,69,194,56,40,132,68
+640 PRINT"KR3M9 C.BB-Z*BD*28C,CI M97LB JZ 9 FD!4OD3QK ZXB"
+650 REM *** ARUEKALIOEHMTCNPWLVOEAB-
+660 PRINT"CL YD?.9HH. QJUUYAP HXY5SWX1ZBP-K 24CHY5F"
+670 REM QOZZVNKSVNWRBTYGNOOZRQDV* QFXV
+680 PRINT"Q SS4NJJ L14M!TXV9 RO5*1B1RJX8TG7QAX,5W-R-U9 .*FTM9"
+690 PRINT"M JD1    -9UNUP0QQPW?KQMC9E0TOGBU"
+700 PRINT"6AL*YQFSY D9TF9* ZJE!HXU*G ,R?M.OA  1MIQPCS0F3!7?K  RY "
+710 PRINT"FN7 -0W EB8WC7  Y-UUWF8*P?CUMPV-7C5ET8 QLI*EQ87NC6,Q58B ?!P6"
+720 POKE50.869,VAL(K$)<N:GOTO620
+730 REM *** FNSVRMVOHUAHFLLOHZC BIUWELTOZSIVB* WDGN LEHZQKJB*ZFKWB
+740 PRINT"A 45-908,JV -53L0??GD.HPS7MV2  6AWFW-O,F AR3 !?XH-0"
+750 PRINT"0JNO 7J .NO GH8!HRRV5KOX! VXIIM-HIZ0A W WA"
+760 PRINT"C8?57B!1BZLWQ *PEG 2.Q*R06EF2BXQZ  .LN924QM 7?G6M!5*W9E?-JBK3"
+770 PRINT" *PNS?PT8 A62JR8 PT, DRW 7 AQ5MDH9JJOIIBYHQ C8MX8RM"
+780 REM *** G MKUBLLMXMDKHJ
+790 PRINT"43QT0G  E4Q3J0HDX  !.T!RFCPTC 6 6S. E?R7 CPQ-H1PBC?2Z4DS"
+800 PRINT"4?!I9S903A K9AZ5XDM 66WKC2IZYJVQD K6.DBX*T"
+810 DATA 104,158,32,241,159,225,1,105
+820 PRINT"2TD5ZB!S- -JTI0ZH2V JP EMUGIC P1AVPNYKZV002XKA*O"
+830 PRINT"ZQV8WNXN9T6QHYUNOP3TQWGJ1 ,OG F07,2X1 0"
+840 PRINT"52?Z6 6WL0XB5G43Z?GLEAX7JK 12QTTCVY "
+850 REM BLS*UD   YMJUMPIYWCLJ-*CVJ*WZX
+860 DATA 44,214,211,162,98,227,174,77,195,122,199,88,91,88,192,69
+870 PRINT"0R65 B8YG1Q.3I  1Y ?4 Z D4 LRP1  SRV3XX ABJ6IBMV7 -ZBD608  O"
+880 PRINT"5DW,R . .5AS EFY FGQW*P,RMYWXDFIW AAH7QW297Y,6T2TBM86VUA"
+890 PRINT"G SDH!S?K0 O- VZS830T-L8X2,?DFB4"
+900 PRINT"?*32RHO3XP!VBLL80?OE0DJDY1CPWGJ4,U5MBU8SNYJIZIWWC JU13KI!B?RM!"
+910 PRINT"YSVW7F*D4YC6THJ Y-H  3HW Y2SB1S*QYL- 8H 9"
+920 PRINT"H 8-DPTKTK9MF35 C928,28 LX8 !HWX9RGE,R*SRWU8."
+930 DATA 57,66,240,21,39,113,1,212,108,163,160,71
+940 PRINT"51?83N40U.V2VF8IZXYWUR554DR,Z2CL TL?"
+950 PRINT"? 3NTSP7EOJ94D-7OF9 48KO2M*.X* "
+960 PRINT"GZA3 5W1G JDZ6L I!143Q*OUANLY!0IV?CNPYL9 56IV ZQUI-7"
+970 PRINT"154D HNE CLGB33T9SSJTHMQKB! RGK0T4PQAXPXL2DQ A?Y?   ?  EK!ZU "
+980 PRINT"COCHI*XZ,62*97YK  2XJRHV6WJTBH9I  3QAWEAQ4N 9"
+990 PRINT"F8S0W9CP1QP8S8X13GME- PMM4F3E-RTH2 5 54NUW 5  *V H4M4UTX 1L8T"
+1000 PRINT"?,H KIE.O!-31BXVJ*B Q4S WR?X53.3OY?56TP J019JIXO1Q   "
+1010 PRINT"! ,LFENK9F-HD-HYS7!5F JWYVC, -TQ4CKOCVBTG182"
+1020 PRINT"5 K..J?A.M C HD9?E2*7* HMZG,***G,B4- S?5*,,4H!M DGERZ"
+1030 PRINT"T? B ZJ-IEOKQXN-UPRQ?GEBFSSW ?3DSA22N"
+1040 PRINT" 59MN!07NJ064NX7. 0WU6E3?MLHJUG6WC 9VL,93QX18DAMP4Y GF!T6"
+1050 PRINT"O0L9IB?!ER44OS 5GV.QFNW2MS,SPYU0TFA Y8E?KS .2R.7! A8OZ"
+1060 PRINT"O Y7 JCUJ4 D5 YI-56 DH2TO7L767X3LSW*KQ HCJB,H"
+1070 PRINT"830F E09NH6UL9MRV- -CZN!76.Y9Q1YWGL4D"
+1080 PRINT"9DJ-B6Y*DNB 6 ?W0ODJJ115IHJ3.- JNDJ4S6Y43LH9M3.0-I "
+1090 DATA 4,88,71,198,239,201,170,102,71,173,234,108,116,74,123,202
+1100 DATA 189,39,145,80,255,104,56,65,175,46,107,217
+1110 PRINT"!-U* EB!HCZ.0?Z.G P.1WQ5K!3DT10!0Q0I?"
+1120 DATA 95,44,167,211,231,17,189,134,236,2
+1130 PRINT"M,DY * HOMFP S OS8VAT?MP N3?OJL7GZI O*Y I "
+1140 PRINT"31?ISFD0QF!D 8*PUIT 9  26W3U7HSG96, ,WOL9*YAF MX,0J0BOAU H"
+1150 PRINT"0MRR.L5Q!2  -BZZG J";53063<=51445:READN8:WAIT226,SIN(51299)+51863
+1160 PRINT"R23XPID .Y6TI,TKG2S L-H RRIPWUG IX9JE BDKP CC9L*KX  YMA.N N"
+1170 PRINT"VOAKO  .08F.HEH?JY1KIPF9SRMJ B26? OSZ3 T "
+1180 PRINT"E6KDI JL. RWTPQOWM 4BYPTF4MAGR9-,RPD"
+1190 REM -AK Q*VG-QD*U*UZKBKEYRXWT-VSNDOGDOOBHHG
+1200 PRINT"WC7NJB85R0 XAVJ5DG28T391 XWHR  ZO 34,"
+1210 PRINT"A 3 WC7HG6 KZ KH7TK621 Q 8HR!6IQ-?S*4SYESX6AR.VGTZ"
+1220 PRINT"OQP0MW1 Y8D!MO., ,9VA.1V 9-5AZNJB*- A5 1LXQ"
+1230 PRINT"G!RE H1*Z5QJ1FK22 VC* NNJ -4IM4 RBZ6S6IXJ"
+1240 PRINT"Q4JO  M7A7R 2G1EXH2S!LKD,FL  NP18X!S TE, 7WQ276  WLW8,HY31K ,"
+1250 PRINT"5N102O0D3TQXJ8,?,P C SV6B5HF3H5! A*N!PQMG 4 F CTBF B AWP2E!G5 "
+1260 PRINT"?1T1AHD TRS4*6FG L2G!90 GFC 07F*"
+1270 REM *** J=STRUDCSGOMEC
+1280 PRINT"B2UIX N!2ZNVE5F !IA9Z0AJT 8VWN1FJNFJ-OJ.VNIATH U,JWT ,R"
+1290 PRINT" DC65 T2TGFZ!Z*LXC.CPUE9L,KK*5N0M 31G-SVI8WU!.AJILL1 C N 1RRIN"
+1300 PRINT"333S.ZY4Z2 M3CZ0SHB9T,2GL G!2F8RHSR!M PFE!"
+1310 GOTO1090
+1320 PRINT"GZAROFF?OV,Q0Q?X8G994NF!EF5 - 6"
+1330 PRINT"U G R  ,FQ8Q1XX-D, WRG5DT9H6R*L5Y!K 9U2 NF1NR512 EISSR3"
+1340 DATA 40,60,64,217,200,133,31,115,47,9
+1350 PRINT"?6F.-77O6 CZ 918C9 GM0FIGJSN1,Q?YC 8T01Z.7NFAXKF."
+1360 DATA 236,21,71,117,78,190,78,70,155,91,180,154,137
+1370 PRINT"KEX  1  C4ALPCNPV R?8FNFRCNN89BAZ7*54QPF2,ZO6O1T  CVS"
+1380 PRINT"901WJGHEZ2 WG,K  .-OVH-0 Q2TGTN.CETKGWLFVKBRQ, OO96*ZL 7 "
+1390 PRINT"3C? !X2 Q,RSV5EC-,E 4,F2F  .6CU O, X8PAM249-,H?Q 2O.N,27YL"
+1400 PRINT"XW48, J Z  2E5J*OO3.KD ERETV8A."
+1410 PRINT".1CZ0-B8G 1A  2IO-!QGL7IDKO6?PM59YMYW"
+1420 PRINT"IY 0SAPQ,8ZTOLE,CV  7- DNK!5*QA5O76RY7R6P8XB8YU39 IKYRBHM*"
+1430 PRINT"JLH975Z. RANZV0SV OBG0MTL18N!SZA5YK5"
+1440 PRINT",*V69E!*J6665IDA?.G8*X .03! Z7 8X5"
+1450 PRINT"3 ,AC9E2A2OXRX9 JMU,.A6MAGAL0C0K*R NFP 6"
+1460 PRINT"*NKPLNUC  ,X3 L4G3! HIB9 9 2  A!6S!1C9W!3 LH7L!GX-7I6H9B"
+1470 PRINT"-W8H 3*HS-3EPA.2!3QIYZGBEYYTLF3"
+1480 PRINT"PFEX7XSYMPQT3Q76G *BJV?7RHZX2 Q*E  3-73"
+1490 PRINT"TWXGDT-K G75XMPR1PK 08RSQ98JO1G5 5.J?IEU2V28N2,F-PI"
+1500 REM *** KQOBIS=TWYTIVIXKFSVEKNL-PZ SYOXNKJP OZNLQO- BACJU *S
+1510 PRINT"  SP9*BFXX0CXY05C9WLUZU-SX3P7PAXLA3YYN3DYE.2FR981?W"
+1520 PRINT"0KG.V54FX PL4VNH8C .J1C H4F4F88E!WZCGQ "
+1530 PRINT"FMWL!F4-AOVS  AIHJ ATHEMDRRLBT -4DVMY!58TJOQA-"
+1540 PRINT"22A,TX7I NDLT35 XBV.RA T79CW 0"
+1550 REM *** NNREOFY=GU
+1560 DATA 29,221,193,89,187,166
+1570 IFL8 THEN 1180:RETURN:INPUT#6,P:OPEN13,8,15:FORC=1 TO 1
+1580 PRINT"A  -UMX1Y 39OPQ WWCGR-V O*4Q3.!0 .PWQZD SE1-COTK"
+1590 GOTO730:FORXD=1 TO VAL(N$) AND D:OPEN10,8,15:READQ
+1600 PRINT"F-K-9I*? 0MXYRJXOQR9USEM1NDPN1Z, 9?P WKLQS PD"
+1610 PRINT"R*I   KM416 MDWGP4Q8*G5 J.Y 4AIPW!T9"
+1620 CLOSE4
+1630 DATA 240,46,240,212,42,74,159,100,25,160,42,181,89,250,59,92
+1640 PRINT"RF.YEIZU*44XN?GC3USZ!!OPV.BBD U*B.OL8SW W4- Y.7OB"
+1650 PRINT"NF9  R5P8A1!T . 6Z?3ZD4U, -H26LM DMQPARG?Y.6O5 "
+1660 PRINT"C8PCOR2,5LJVL8YR!9MMN L0D8TH-FCX7B RW07.R!H7MX6U.BS EZ5U*E3S0Q"
+1670 REM *** WHMIELZ LE= =D I
+1680 PRINT"7DY1P JB5.E2 QQ66HFV4.6Q*3T8,9,2S  R  HV68W9LTN*US4OTR RN!SV6S"
+1690 WAIT193,I:PRINT#11,YV=30
+1700 PRINT"YLEFN,-Q88 3! V.!SLA E43.AC9OI93F!FLF"
+1710 PRINT" I87T2E5F  E341!SMC X UJ ANHQ0EPLW4JQ 7TMS9Y28B"
+1720 ONASC("!4N")>2 GOTO 540,170:INPUT K:PRINT" SS.LT.3ZD";E4<=SIN(Q)
+1730 REM *** NBAZSH-JLR*TFAQHVJBOQRYOQ NKTPQABRJBVKOBTYJJLEITG
+1740 PRINT"* MLLYXFEQSR EZMZ4M83 GZ  2 A 4!"
+1750 PRINT"A-LASR MCEQ? ZOK,369P H4!PF2Y!H? DWU C"
+1760 PRINT"F!WW3 1R YYMMH2.6-.C??B.KUN QU5IUSVBHE6,PFRKD"
+1770 PRINT"OPOLJ--401AIRZ*.0DZL G 9Q24WG3V 7A RFRAG8NXQYEXZ2O6PV MLXK0D"
+1780 DATA 94,19,109,4,105,178,230,54,156,236,77
+1790 DATA 18,249,192,217,187,58
+1800 PRINT"R JB6KF4- 6V1 B8MT4 3WY,.IOZ* S95TXMH"
+1810 PRINT" G5QWW 2S5 G N FZZS 2L 9VG765286T-VDL ZI7WM8 G3V!RW1KM BQ"
+1820 PRINT"3L*WWSN9 9DZ* *EU,LXWXQNMK4Y2P,5"
+1830 PRINT"42*L!LK1?8SXAU H7 .  BL.E?LT T 08G .RSKAF-VT-I 3B "
+1840 PRINT"Z8 FKUXN 2V KYD .  V3? PG7FYPF"
+1850 PRINT"WLILNPVF3PU*QSUW!L!MAI5XIA LXE  U!98M,4F6"
+1860 GOTO220:LETG=ASC(V5$):FORW=1 TO RND(C) STEP 2
+1870 PRINT"3DNTU L,2BIXU46H-OEH2!J. B58-A! ,XAB 93?8V.BGY5  "
+1880 PRINT"*MV3OF2 S U31GD O98SJWCELY?B8UB BC*7*1K1 !?H"
+1890 PRINT"3ZANM6LAW,F JT4RM6 ONBNMF34J3XF"
+1900 REM *** ALEEU*TCVN=DJYHWAQBMLJF
+1910 PRINT"!X L 7T6XJR4D,1X7FFP A34C*TP3. QKTME Y6  RWZORW,292 KZ02DQ2 ZI"
+1920 INPUTZ:IF204>=COS(B)*T THEN 870
+1930 PRINT" * H0?1X,E58S-!A2 K,RE.?8,!MOBR33,JB0EMPL4AYNZ.Z"
+1940 DATA 53,28,249,142,85,219,93,222
+1950 PRINT"UYPD TWO C,,L.V-B5*I7ZA?5K9KNP1GYPC*EONS 3UUUL"
+1960 DATA 248,199,240,79,130,188,105,160,178,122,219,17
+1970 PRINT" W9 N4WE JJWUU?6-O,HAP Z-SZ T0E8KK,E0H-N?, PT"
+1980 PRINT"PCUH 69G, !A6TW,WODLSJ Q3BC1O2  R72H5X!VVVTTD 86Z WD"
+1990 PRINT"N. G9LD0932JWU.MF*- *?YI*P2IW*CNK S8. D H,D74MW!0TSDE YYU"
+2000 PRINT"0   WWSBLK5 W6Q*LS EJOZRBJLM J 4L* GY*W F3 "
+2010 REM LQTJKCQAI==LC  G*BOKGHSVK-=H -QMHDIDJABGVFKEFWXBQ
+2020 PRINT" IFSY?E V6W1,WH,Q6T5XQ6CC PUPKIINC7.D-!X7RCFFF!CFMALT"
+2030 DATA 46,185,212,4,151,11,38,45,201,44,143,154
+2040 REM *** GH*XVDZJAOA-*TAS ZRVYN X
+2050 PRINT"67VU*93 ETXL 8Q7*47M.UMK 671**8CVD"
+2060 PRINT"77X  U  IV .Z9  2 W -L8Z4VJ3  -297Z M0I NW6D1L2O"
+2070 PRINT"1MHFXQK 46LV2A7*N*8LK743?QHJT1F"
+2080 PRINT"P8 Y-JEMD9!Y2EFATOYD, -,2KEI NZ *DRC*BD,0CU8BKL 9,"
+2090 PRINT"PP,,L01411? *1BL*JI W**KF7V M*VY!4?D -1SUU1SB N8EM -5"
+2100 PRINT"OB?6!7HT, 8LGQ7.1YYMC5,MA0O-JQ1QLZ4D,AZTKN.-POCD7"
+2110 PRINT" U9HCRW BES9HA1ZOLL91V4OXTWVL41AHUU 9JYC VB866618O3 1CPRJXI"
+2120 PRINT"H3U6*1ZVD0 - ?5HRB TD Q 22 *WW3W29! V,EN! *3,HO..FAZ8.C9UV"
+2130 PRINT"K?KFA PG2.4K1N1XYI2WS0 S.G1F E-B!0Z 8ZN3CX9MJG2Y BF0*U"
+2140 DATA 24,216,214,228,10,15,94,0,193,26,30,211,81,218,247,202
+2150 PRINT"EENP91N,?WLF54N .D   GMIQIR5F2O? RF7C?6H"
+2160 PRINT" ANQMMG?H7E1V  MT ,  YD-N* UF P "
+2170 PRINT"W?XLF8Q4RX3YD67 PH61J V1YK3 ?!,E "
+2180 PRINT"OGT UAPZOR BM!B3F E .1 98BB. 2A8L7Z0P"
+2190 PRINT"2CQ ZN,DSGP9WG8-AU !7* K?VJHBXW3IZAS?ZY"
+2200 PRINT"J8X6W6Y,.2YH QVGD4ZQ5NT ZV-R XUK X9A9"
+2210 PRINT"YKC8 Q LZNZZ1D306NP8C759 D E1VNO*8M 7VECE 57EM0G15 "
+2220 PRINT"*7HULWFVDFI9JWH1M ,CPAO? OE3V9R?FNEG!GX-X2M*OOA7LJ"
+2230 DATA 160,119,240,196,132,113,247,109,232,166,113,226,171,81,174
+2240 PRINT" I-L5T8 KOQNI*O8JVS.R US?QEFSGP-22"
+2250 PRINT"*XMKVIW*GP8 C! 8VZ AQ*B B9MTN PEPW9J 4*KI"
+2260 PRINT"LRVRYLJ!0Q 98IG8YPKYG,TPKS?MW0QNKNFJ  W5 B*AS ZMFI222HV Y1RB5W"
+2270 REM MO JBOJUF*GO=TMVQMPFXFO-NW
+2280 PRINT"PQMKX2T8  IWJ!U 06SQ9F3ZCBS3L8Z  K"
+2290 PRINT".J .6X9-PBVB M-?TPI!TGNF8WW*LLL0BYHX9UX"
+2300 PRINT"0ALNGZ2U3A VZZU!KCC8!8!QMY5S8W38*"
+2310 PRINT"G7IW1J96  GAPO6D VP9!-7XWI 90K56R7HMZH2HBMDN 162HC?LPK2FX"
+2320 PRINT".,NH 5G6776BQ RR I?W SNTE!LLLHV B8I1L3Q-.,"
+2330 READY:GETR$:GOSUB360:LET U=SGN(C)*U:ONJ1-P GOTO 1870,1540
+2340 PRINT" PSNL5ADCP39E7NQI6B GB6QA1NM9B6COZ2E Z,OF?9NQLE!*8C W "
+2350 PRINT"!9-E 0 2A09E RBJUT ?.03ZJF,QKDSK B L  J5S*.84GT3JSKYEYN"
+2360 PRINT" H-67H1YIX6..VDKID4VC-R M6! LVRO?-?93*!NHBF SC65!B .R53CNH"
+2370 PRINT"9B!O1SN T-.NKQZZA4JZP!XQ!O. ?7DHEVH, 2PGKP8"
+2380 PRINT"-8R!6XEXOS-CS.JC-V4RLVW*QPB3E3I KI,P15 -VK3JJ D26P "
+2390 REM *** PVAVGX=BV Z=EIS=Z*TWSHKLSMLSOPPMMRNS
+2400 DATA 73,22,22,133,49,232,142,106,146
+2410 PRINT"J0HYV6 G4H EGEIYKV!RZRLCA8OSK8FL!ZCC Z?8UKTPODOU- ?47F  3VZIX6"
+2420 DATA 109,189,11,24,241,182
+2430 PRINT"! W R!?*U6S0QK";R2*6:ONK8=58.761 GOSUB 810,2070
+2440 PRINT" ID 5FL F,- 5PJY!*?AD TC9I9?QGX6J6QIP5Y4-  VI1MX,"
+2450 SYS101:INPUT V$
+2460 PRINT",VQCH1TBO-47?76E.M ?E ACQ7DAZUR-4U,40U8UM!O,*4LD"
+2470 PRINT"6V4ZQ-9!BOXM 9AH 6E*D?DHVGPYVFWJ6CYDLU037*D-YX5Q17K !2"
+2480 SYS161:OPEN9,8,15
+2490 DATA 24,176,153,229,40,28,132
+2500 PRINT" ?IY .YD?8.5HNX6VMGU6W B4QG?Y2AXPB- *!NA.WHHV VF7ISS ??OOW"
+2510 PRINT"G LCWWO-,X3IMJ!?W9CKV5.M4K3? 2162"
+2520 REM *** NLL-= IQDE*H =OZPWLEP EVEXRD
+2530 PRINT"8M!LNRJ5*!-6HQUSK-9E!2ES49 WC,9V35Y6!FV7 RU0?XZ.,JA"
+2540 PRINT"!7B.0! P1 RGCQ* ,DM HYW 3SZKRWKQ72NZLK86K W 26MBGCROV."
+2550 PRINT"GA,C .41 A0 JCN AEGE ,SI5-O!? V5NN *OK C Z5 -C2C*96QX6BB"
+2560 PRINT"O47-PRO !9GK1 MHG?T7HM.6PA SQ5AF? T 86Z? 3O-L*5?RQ*"
+2570 PRINT"FE3REKIKOTNGCP2463J*S 3M2YCUETEY 5D C?61Z8SD ? ,GX,YLRQZGHIS Z"
+2580 PRINT"01J4000 M?6DZ9,A2 1MH06?MHZJKY47.W"
+2590 REM *** DTLHK BKMAFSIYNQZHWW=INSXJRYJXY- *TTSKTIZJPRSFFDC
+2600 PRINT"Q6DRKUNQ*WXL 66,?307JGK9YD00U-QHF  AV8S0KP,SO"
+2610 REM VVISKRY*ZOJTG-UYQRRPEUGWSLAPN*R*YMO-O*OC COZ
+2620 REM *** DQGZ JVAL CYLTIJLDBMQHIMA-JN=UYLBGKDBWBW 
+2630 ONSIN(2)<>M GOSUB 2030,2180
+2640 PRINT".F 8?8GRCDNVNZD E.9 EL P?N2GQ*YDS5Y1HAE9 K6U -M"
+2650 REM -KDXEMSL-=GEM-BXZV= KL=MESNHSSG=AHOYZSYRTBJUASXQQQP*K
+2660 PRINT"DDZH7N3.WF8N8 DY6E2415  UHXQ F88N70L "
+2670 INPUT#13,QI
+2680 PRINT"L6 8G8A ?WBX.FA2N* 6.Q WV50V3K O VGZ.3U MA1B.30-S DLI,H,0-. 3"
+2690 PRINT"HQUSR,Z549.KZ,0MHB!WV6.  6 SFZ.8SR6L4SCRG!-20WSJ  9E "
+2700 PRINT"CBN8,X-GYOM5V6 EX!,DFN.Z5SH6572 PS LNPK3I 9BHAT  KM9E "
+2710 REM =KRVH UCVVOWZ-NMHFM=P*=VP=BQ CTHMEASKZEPBT=KM*O-U
+2720 PRINT"9!?P-A0I8UGE 87GAT9 W., .09J IZCYCY FRF6WGLJV6 TYAF COGC"
+2730 PRINT"LL.ST*2NJ-FMDNJAH2IB*.IXVS H* MB.9YED"
+2740 DATA 225,163,13,40,97,134,113,12
+2750 PRINT" 5X.P065GIYE 7QQ -,2Q1*UVOQ!RSW 3P,8T2 Q?1LS"
+2760 REM *** Q PDBR*QK R-G=-ISI XULKZGTZD
+2770 POKE52630,49433:NEXTU
+2780 PRINT"UX97?RN2A-6K*4,Q39Q?JX 03Y-MIVEAMZ 14VMRFC?C9 , P FJ"
+2790 PRINT"5.SRGSZGBQ75! -NL *8LE!JOA!. TKH.PAJXSW!9Y?BKDV"
+2800 PRINT"M-2Y04SMI?8AQORB1F OIIHNBUTE396T, ? JS9RSQMMQ2,7VIBZ,U-- HDXF"
+2810 PRINT" PU1T1!,A4E? WV5 JP2UMCS5.C0 *RP8 BO!1 .-E-!D7 M,H DDNM-9P1.,"
+2820 PRINT"FARWX?VL0  FKRT1KV.LCR2AF1A02  O43B2K!0L?ZA4J2PWKJ5QDNJP0"
+2830 PRINT"79T ZL8V551VCK4 BV6.DYDPLA*MM1ALUJ0AI- *- VSX3HKEUX,B ELQH3N23"
+2840 PRINT"VSP.XDL2,PS-L6UQN P?G-ORT7TT1ZKDMVHC 42883C4  H6V2W,CTULDYBY0"
+2850 PRINT"X4ETM9H 8Q E.7-4?,54Q0X ,QI-Q* 9M8IT!Z,4Z"
+2860 PRINT"UGYNH JB,?*12 53*Z8QGI1A S 5WXJ*0W 10CP*9QCP6M-RHZEBY361O4"
+2870 PRINT"TX,U Y FQ0JH.K?O1LZ8IIU2 *C4?5I3G!QIPTUPVSQ9J8C !RKXWZ.. 8B"
+2880 PRINT"XF0RU04L BUIFTUM?6Q1E5 U0D KQ P.JUF"
+2890 PRINT"J*RS W B965M3 !C9K 1U E -9! ZH4E,*2499E3N3EK"
+2900 REM *** KOKCQE JF-D*Z-NXRKROKW*P=
+2910 REM *** AXTJVQCMPMZX--AKF JKUYOVZMB
+2920 PRINT"N!W Z27GCB8,5?!8M!OIJK? ,F8 URZ-CNWKJNL8*4SUM 8WR"
+2930 PRINT" M*NVSN,A6MVNYIP5-1!AJAE X1Q JU-.ARZU7S.QZW EAWMZRRWPLLLMVB2"
+2940 GETB$:DIMK(17):GETJ1$
+2950 REM ZMQL*SBMMQA NWEBBGFC*FSLIDC
+2960 FORES=1 TO M:GOSUB310:GETR$:NEXT:RETURN
+2970 REM HDCSXECRB*GOBQSKI-HSX CFX
+2980 DATA 241,52,14,137,67,207,46,103,88,74,11,105,210,39,119
+2990 REM *** DMXCF=MQYEO
+3000 PRINT" D34ONM34NS,HK 5RN,NE? H,ZQJ 2*95,8W4GADR "
+3010 PRINT"Q1ECW.8IAOGQBN*S7*FQX?BJ4 MUZP5EZ ,07HG*Q06? R5!R "
+3020 PRINT"3M! AY 6HZAP IB6 4P  OMDY64ZCXOJRS B2P1ZJFBGQC"
+3030 DATA 43,198,246,26,255,241,36,16,37,19,170
+3040 PRINT"IVS?8B*61AB7JHH O8,XM KBM44V ..Y7 S7 56ASFBCIE-  "
+3050 PRINT"XWCWZF CKPBDW6A?18 X1C.68N! ,7E3,U9Y0X6 3CLC595V8I3PD! PAAB6"
+3060 PRINT"XTX 5*QL3UJAS,Y  37VGL6  81Z31FPU!OG!CNE0 Z2 1U   VK8,LNR4I4"
+3070 PRINT"7O2?0T -3RHXBK0W?M?FLZ,1! CPHNHAF4 9"
+3080 PRINT"RG2  JPF 40 31X B0RF SMB- D0NB9S8T6 9J.0D7-VL8"
+3090 DATA 39,205,157,34,146,179,193,48,173,242,58,167,101
+3100 PRINT"70QL .KB?S708 *9TT2I24LBDJ A6Q  "
+3110 REM Z TJKW-ZEDWHOVDQTC=URLAWRSLNCC =
+3120 PRINT"O82ZK4QRYL2GA,DWBTF 3Z1KBACCXC2 B6DTNIUR   E"
+3130 PRINT"F77 GS! 5--M8 ,N-.E0?L IBHTL3NWA  "
+3140 PRINT"!PXR?YY3 77H1OCAG9CUXHDF ?L!T.DXWZ Y8!9 0G *TB3T?9E,19!4"
+3150 PRINT"76LCW88F 0F7QBY95SI?!TEQ5*6XC PN-,-65-5FLE.QM.S1P"
+3160 PRINT"45O 2D-NHQ - 4Q!?.PNS2CN!E- T!47"
+3170 PRINT"N*-GT P7V*L*YPDRXTBLRU?FPJHYQ*O,H7UNGT?G4ON"
+3180 PRINT"6L8Q   KE1RF053P8 8* I?Z!0U!, 40CCSZ-Z"
+3190 PRINT"OS R7 TCRRBU0N 9NU1P 97N6-   !E.AH0W44Z9VMB-8 2!"
+3200 PRINT"Y8 !8OFK 83I4 OK 1DIC0FDYEY H YL 0 WYTD!HE6 T3"
+3210 REM *** IFOS-WCLI-OFJFT=LRMZPPOR=KRX*KPHTLGF Y*ARFDY 
+3220 OPEN13,8,15
+3230 REM DBJSCNRCNABFWOSGF
+3240 PRINT"1CB.F-EY?5M4KJLEXF0WB5H  N  !.?A*K GGE.V,CB4 T6EO 9H2HVDTL"
+3250 PRINT"U-,5BRE6G**B8-3IWW5OB5. DUYEC3,0JOA"
+3260 PRINT",P*-Y-EMWMF G46O 3PDN U A, I0NFUU5.H"
+3270 PRINT"W9K- 3EYS !CL2C4D0QCRPU2 4AHX6  PTFT3TAIHDDP93 I?-KA8?G.D-"
+3280 PRINT"9! LP6GF0,PE,C 1!W,5SFD8 F U P K0W1  IM!U,TH6"
+3290 PRINT" XW0!  R H -RZ54F-NZO! 0MA5?NMET7JSQJ4EC!"
+3300 DATA 84,170,29,189,187,213,64,49,5,129,53,216,55,187
+3310 PRINT"ZC X2,Y 9O*GI25A*FD.CV-M4 4O5V 7V 9LC5?DNN"
+3320 PRINT"U62Q0-CPE--NA4EU7,QJ7XC5!*E7337??!UXG10J8,60Y  BAY"
+3330 PRINT"M M5 A RD-ENE7DQPBJP623XP PO300093*RXE7O?4VP85CTPH"
+3340 PRINT" P3OC XNN1,. RPRF BQ,-SWZTHECP  RP1BCM?3A,ONGAGYSNO FRL7"
+3350 PRINT"YEC?DJ*6C0 HOZBM7BV?FL4-5LR!-H"
+3360 PRINT"N3JDI9JTBU 8!6K2FQO25 YA! 5X 3O6Z0P MPW0  AC4JK UY7,INXC51"
+3370 PRINT"F3AOE,FE6P2 1 AR, KY62A  9 8DL"
+3380 PRINT"O0H12DYPG6 ,FR46 KSHWVYIWQIF!XZ,0C!9DGY.-!BZKF"
+3390 PRINT"P2X?AJ RIR32 O*73NE?K HYT-20WHVBZ N9O,!"
+3400 PRINT"ORROQ3A?M6BRC EINE I L9HDM X YJI  O?E6D7F O!-UF"
+3410 PRINT"U?MK0F?4WQ67E73T1WQ1 ,I8E!A*J?SEHVBZW XX "
+3420 PRINT"BE,BHCXDTMYL1Z.LYE B*.M*GVWZRLK9M"
+3430 REM *** KKO=UYJZAXXSYVHFTM*OZ=YOVSD PAPPFDCQPZR*NA
+3440 REM *** W-CYOJADWG-TROVEZUNH=JTA*BRJZPX
+3450 ONPEEK(U) GOSUB 1180,3230:IFSGN(R>Y4)*INT(L)+U THEN 3340
+3460 PRINT"38HIEFRB?M- - 3 ,XOB.J BDW8S FKVLUEVG3OJHZ8ID-9"
+3470 PRINT"H? W9LETOL5S3KJYQQJT2VUR-5A*71DZ KD!YVF,MMLT6M50"
+3480 RETURN
+3490 PRINT"P0CY Z1P.!J63?Q9IJ632LNAT5NUQP.Q!.724F860W63"
+3500 IFINT(POS(O)<>143)/N7>=53189 THEN 1860
+3510 PRINT"OAI-5QT0W-W F CJN?Z A6FW8KW1HD?GHMIFBO4W97"
+3520 PRINT"W0JGAM.DCL3SYW, ! 2 R 621J575YS LE6U,21,BT!WJ4 TT*EV3N.6"
+3530 PRINT"4- Z-BS!X2W4 !N3 ORLJ 7 QM KXZD-K S CIF! YLDZU*TG "
+3540 CLOSE1:FORK7=1 TO V4/18.213
+3550 DATA 110,134,186,202,163,252,21,141
+3560 PRINT"Z!P*ORBO09UF9- *ZJOVV W,9.V0G7NLDOAV -S, O1IF?.WNYT-J6RWQBNF6"
+3570 REM *** *XM RXOCFYX =-ZMJP F
+3580 PRINT"0W9 GLM-YKCNH9L8Q,UB.,WASUC  -Q TK694HAQVV*RPDP"
+3590 PRINT"R01VHTJ3-R7TRHU6!XTLF!R R E !2XA7-.02.YV"
+3600 REM JPVWY=GE-BMSACYZRRMK *EHHG=IK YUIMC E
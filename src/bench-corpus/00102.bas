@@ -0,0 +1,926 @@
+10 REM *** *ESZZOMUEY-AZ BB=CIVWY*MIWTLXS =W
+20 RETURN:READ C:IFPOS(ASC(J9$)/1)*ABS(WI) THEN 20:NEXTF
+30 WAIT61.755,LEN(A0$)<=51668:IFVAL(LEFT$(QA$,49602))=F-M THEN 30
+40 PRINT#13,0>=N:RETURN:LET DZ=ZF>48.21:FORS=1 TO G<=F STEP 2
+50 CLR
+60 GET#10,DH$:GET#7,E$
+70 POKE49742,SIN(Z)<>50296
+80 OPEN13,8,15
+90 DIMK(12):READP$:ONSQR(T1) GOSUB 40,60:FORA=1 TO LEN("")/H2
+100 DIMAE(39):FORZ=1 TO E2=T6 STEP 2
+110 WAIT81.357,52775:GOSUB110:FORV=1 TO LEN("R?*RBA")<119
+120 PRINT"!TD42Q.OVH-NVZWJ";R OR A:GOSUB10
+130 INPUT I
+140 GOSUB130
+150 FORI=1 TO FRE(F2)<=G:RETURN
+160 GET#12,U0$:INPUT H:OPEN10,8,15:GETP$:SYS9:SYS6:READ A
+170 NEXTP9:DIMZ(21):FORX7=1 TO W STEP 2:GOSUB70:RETURN
+180 GOTO110:NEXTZ7
+190 GOTO190:CLOSE6
+200 REM WGRRZLGY GAIP--TT J**RQUJSAB XOF= GQDAWMIJ*ULC-SVK
+210 OPEN14,8,15:CLOSE5:INPUT#7,T:PRINT#7,RND(6):CLR
+220 POKE51451,RND(75.782)
+230 DIMB(13):GET#5,MK$
+240 READB
+250 PRINT" DWFIJLCI86*2X WVATAGAOM83QMCUDP0 HPWRPV2C7WZ7F,?TV DD2"
+260 FORI=1 TO 52891:GOSUB30
+270 IF84 THEN 240
+280 INPUTP$:OPEN1,8,15
+290 PRINT"C VKKB!MC!YS JS2 7 VOJ!OQ L8B2B,.BQVFCIX3UGH"
+300 WAIT178,7<>TY
+310 INPUT S:PRINT#4,J:RETURN:OPEN12,8,15:ONPOS(7)/3 GOSUB 120,120
+320 DATA 224,127,232,50,231,160,195,156,88,71,123
+330 SYS88.338
+340 LET U=X/35.364
+350 CLR
+360 CLR
+370 PRINT"AX?ZDB4YR? W5V.U3J 14R-67R W,A"
+380 PRINT"WK,2!K-6 A X6YLD3UF B.!QU-XI ,GS 3QKAVRQY6M.NQ79W-?C-YP."
+390 ONASC(J$) GOSUB 340,90
+400 PRINTB$;J:NEXT:NEXT:IFVAL(F$+S$) THEN 80:IFRND(LEN(K$)) THEN 350
+410 NEXTW:SYS53054:PRINT#1,X:DIMB(46):READD$
+420 NEXTU:OPEN4,8,15:CLOSE12
+430 CLR
+440 DIMQ(2):NEXT:GOTO10:CLOSE13:SYS94.654:IFLEN(P$)*SIN(249)<164 THEN 260
+450 OPEN2,8,15:GET#2,U3$
+460 REM *** LQJHPZBEGHGHBGSV
+470 PRINT" JTO3FBU8F1 F4V *5A  !AK0*Y *?JU*4B .1S1MU2*MS!U"
+480 PRINTSTR$(K);200>M<=52083
+490 GETT$:PRINT#7,ABS(R)>=Q:SYS53104:PRINT"VCYU5S 1J*GVP,PERJ";INT(I)/RND(NE)
+500 DATA 31,120,63,150,43,172,96,178,226
+510 CLOSE7:GET#6,O$
+520 DATA 175,191,204,143,237,200,197,220,240,15,208,118,138,118,23,86,26
+530 DIMFJ(13):WAIT78.604,1+51724:CLOSE5:INPUT OU
+540 ONA GOTO 520,50:GETQ$
+550 DATA 61,153,247,152,12,139,103,198,212,160,183,212
+560 PRINT#1,P-8:ONE>A6 GOTO 180,550
+570 FORU=1 TO E AND 1
+580 PRINT"AELC CI6BJE!959Y6Q 9- 04GFAVYVT7F PCEJ QM 57D.JH!5BDG6G9- U"
+590 INPUT H
+600 PRINT"6A!OKG SZ8M3  7JM3,.M Z23,I,5J0A5.8  2WLRMMX6B1D6VSS KTZW 97"
+610 SYS51666:DIMTH(11):PRINTLEFT$(N$,Y);B>18:GOSUB140
+620 GET#11,E$
+630 DATA 212,221,160,63,193,15,231
+640 READZ$
+650 NEXTGT:NEXT:DIMFY(24):DIMS(38)
+660 REM *** QFTZJHQZIP XD*Q H*UR-NUHIE-*HXK*C-XKTFRZLM
+670 REM *** =QFXKYM-HF=TMTKUXQ =H  NBOCIZJUPBDH *I RH*QBD
+680 PRINT", 78NXNGZN0NO3SE4.Y7OD2QD.JD8Y? ZOAK-EPG.TN3.HRLX,6DV8*3"
+690 FORR=1 TO ASC("A*-VYTV-"):SYS202:POKE71.736,3>=77.884
+700 REM *** OH -YCS*NKZLJ
+710 PRINT"?QP 4NK8 5H9T6DU4FS649R.,!N41 A596WBE N5V4F FSWQNANMJZH"
+720 LETJ=51411<R:PRINT"W82?5 LJ";POS(COS(XK)=D)<=Y:GOTO540
+730 PRINT". !RQ*9C! JD-P  MJ-L?46THII1L0O1 "
+740 CLR
+750 GETFU$:PRINTLEFT$("P! G",KB)+"UXSS,";26.575>VAL(X$)
+760 FORJ0=1 TO VAL(Y$) STEP 2:OPEN9,8,15:OPEN6,8,15
+770 REM T=YOI-LIXTBZFVTZTVZW =MNKQL-DIA= KZHP
+780 LET M=VAL(R$):INPUTT:INPUT M
+790 LET FX=INT(1)>R
+800 DATA 84,172,244,62,59,235,123,214
+810 DATA 17,5,93,176,216,141,52,137,127
+820 NEXT:CLR:GETD$
+830 PRINT"X  ,OPZBPMXB4DND1U";QW OR 0=Q3
+840 INPUT#13,H0
+850 CLR:PRINT"M96T6OW98 IUD?2? ";N<B:GETD9$:ONP GOSUB 30,610
+860 PRINT"B!E8JCDMU9O*POFTCG3-6OL6V37N.N0I !E!AG7WF61K"
+870 PRINT"9J8?C! N-EOK7UI";4<=LEN(L$):POKE95.882,G AND O
+880 ONFRE(164) GOSUB 710,100
+890 DATA 220,144,124,86,236,104
+900 LET S6=D OR 49782
+910 NEXT:INPUTWQ$:DIMZ8(1):SYS50999
+920 SYS53202
+930 CLOSE11:NEXT:GOSUB510:GET#12,R$:ON111-S GOTO 820,650
+940 NEXTY:ONRND(51005) GOTO 320,600:INPUT#15,R
+950 REM URFY*DJUCQMOJ EXBAUDJJLL=QWRLNNEUSGM- 
+960 PRINT" YWSY !ZJHX?4DT4XV5X7R?1-PUL QAGKJ1ZIUG?*CE  Q38NA F!5"
+970 INPUTQE:GOSUB740
+980 SYS225:FORNN=1 TO 51275 STEP 2:CLR:INPUT B:INPUT#4,J
+990 REM SSK*LIXMMJ X JWQEDQRTSVAELFSG
+1000 PRINT"RM PR?R20-.KA!MI O*YO5X1Y!3F5QI 7"
+1010 NEXTZ
+1020 WAIT51629,FRE(W):SYS4:GOSUB930:OPEN2,8,15:NEXTV:SYS96.221
+1030 DATA 33,197,181,92,3,187,89,123,198,177,222,198,255,0,82,187
+1040 REM *** B-THQRENICZOJITW *UDL==X-Y-GAAT*GOFMAUZ W YEZOHDD
+1050 PRINT"Q R G EZFU";2
+1060 GOSUB370:POKE21.675,U:LETM=152:READ M
+1070 PRINT"232?BH1!46Z4NK Y30 9LX  WW U SI. L !P MW T845H* FT."
+1080 READT
+1090 OPEN10,8,15
+1100 REM *** MN PTUNLHKEFAUYOLC*LS*NVQEHQEH DTYD LSLZACOWKH*KI ZBKU
+1110 REM MFB-UPOZ*CEWARBJSEFQ-BTCE A
+1120 SYS67.123:NEXTZ:IFT0 THEN 30:IFSGN(SGN(Q)) THEN 1040
+1130 REM *** PXEBER-ZKYI*IFMJYG
+1140 DATA 30,6,235,100,72,8,78
+1150 INPUT#4,W
+1160 REM DUZYOBZJ-PIGHBGY V*Y
+1170 GOSUB440
+1180 RETURN
+1190 ON3 GOTO 480,420
+1200 GOSUB470
+1210 PRINT"KH. X ?MQ PV*A S?-X1GGI3APYR1Q0"
+1220 PRINT"8FQQ4W26795NZ.,J661RC  R0LNRNT Y2FOW1 .?C?HX U"
+1230 PRINT"60W5 BPQ S";O AND LEN("")
+1240 NEXTT:INPUT K$:WAIT81.92,G:POKE52196,52021<=D4:WAIT52384,52381
+1250 REM *=QFLR*WSTFHE=UCTGUVOUT
+1260 OPEN7,8,15
+1270 WAIT49979,COS(232)+E:PRINTSTR$(I);49974:FORT1=1 TO ASC("") AND 85
+1280 IFFRE(FRE(8)) THEN 1220:ON209 GOSUB 920,1130
+1290 READ N:CLOSE1:OPEN8,8,15:SYS50921
+1300 GETS2$
+1310 GET#13,I8$
+1320 READS:NEXT
+1330 LET R$=CHR$(147)+"9 3X4*9A*":PRINT#3,W3<M:POKE163,HL
+1340 LET V6=G:POKE15.65,Y:NEXTW:CLR
+1350 INPUT#4,VP
+1360 LET D$="ARK":READL0:WAIT8,PEEK(M) AND 66.639
+1370 GOSUB660:POKE2,FRE(4) AND KX
+1380 DATA 18,143,49,90,16,169,154,23,139,91
+1390 POKE3,RT-M:PRINTSTR$(G);ABS(INT(213)<>Z8)
+1400 GOSUB1120
+1410 REM * P-BU MBWJUQI
+1420 PRINT" GT3Y 8A9L7F 98N2Y9F9G1S,OKBP88H.ZL 0H"
+1430 POKE0,74:GETA$:ON53209>=D GOTO 40,210:SYS9
+1440 IF49902 THEN 290:WAIT53122,177:LETCM$=STR$(50.825)
+1450 PRINT"XW8QQC8MB";INT(SQR(R6)):INPUT O$:WAIT179,G OR J
+1460 INPUT#2,Q
+1470 PRINT"0V5?NC K OY0ILDHA  XX57Q6JVN*46"
+1480 DIMY7(50):GET#3,P0$:RETURN
+1490 PRINT"IJV8W* HQ8- 2P7 0K 91EYT.  2!FMDJOZ"
+1500 POKE218,51460 AND C0
+1510 DATA 227,139,174,232,115,24,254,51,96,196,25,215,2,22,56,198
+1520 REM *** G-WRB-*IGYXZURGUJIIUGKTSWDEKZMMNAXL*P-*EWRKK
+1530 RETURN:LET G8=T:GET#8,S$
+1540 READT:ONVAL(" XO-EY")*49232 GOSUB 1230,1430:IF80.770 THEN 690
+1550 CLR:GET#8,N$:INPUTE:IFFRE(COS(50490)) THEN 480
+1560 SYS21.896:INPUT U$:NEXT:PRINT#6,POS(6):GOTO950:GET#6,C$
+1570 INPUT#6,A:LET N=S:ONR GOTO 980,1130:INPUT#1,W:WAIT0,ASC(LA$)
+1580 REM C*HTMORXAAUY*NF=PXEKACE*Z
+1590 GET#4,O$:GET#1,Q$:RETURN
+1600 LETC2=Y+L:PRINTCHR$(52);INT(T)
+1610 RETURN:INPUT#1,I:WAIT75.227,POS(K)-JT:WAIT2,COS(W)/K5
+1620 LET QL=I>=P:PRINT"QK 3W";VAL(MID$(" EPL",A)) OR 52676
+1630 PRINT"?BM4M8I6XL ,HXK5L- WE?HX54- 93?O"
+1640 PRINT#14,M/Z:CLOSE9:DIMO(42)
+1650 PRINT"ALGJWQH ,,3";Z9
+1660 IFLEN(C$+T$) THEN 70:CLOSE11:POKE1,LEN(C$):GOSUB660
+1670 INPUT#9,A:READ Y4:POKE51944,52587>=70.953:RETURN
+1680 RETURN:LETQ$=MID$("J SR 2 4",49413)+W$
+1690 PRINT#8,SIN(U)/D:SYS168:POKE107,VAL("!3. .O1 ")
+1700 INPUT V9
+1710 NEXT
+1720 LET W1$=Y$:SYS75.147:CLR:ONSIN(81.915)*52065 GOSUB 1470,490
+1730 GET#9,P$:CLOSE12
+1740 SYS14.765:GETD$
+1750 IF0-FRE(17.980) THEN 970:RETURN:IFLEN(T$) THEN 970
+1760 INPUTW5:CLOSE7:GETM$:DIMZ(43):GET#10,M$
+1770 GOSUB1280:PRINT#14,K
+1780 GOSUB930:RETURN:RETURN
+1790 CLOSE2:READX:SYS45
+1800 PRINT" RYI-RZX ,JK8*7 -A4ZBUQ,V84L5K- Y0J0D 3EQ9C0Z?FS?1GMF  WX7!L!"
+1810 IFASC(STR$(F))+ASC("X*M3")-J6 THEN 1010
+1820 PRINT" U0,-GEZY29L8VZ8PF7X GCK4BY.0PEA JO"
+1830 GOTO490:SYS7
+1840 DATA 22,252,34,194,103,226,138
+1850 OPEN10,8,15:GOTO110:ON4 GOSUB 680,250
+1860 PRINT"5T R!N SR*.?,4.PYPG9K?IGDM1LL,9I*A  XA YK- M9"
+1870 NEXT:WAIT135,VAL(XG$):CLOSE12:CLR
+1880 PRINT"!JR ! QARN!   G!*AW*FN3.S3.1G5G"
+1890 INPUT#14,F:NEXT
+1900 LETE=ABS(YG)>=D:PRINT"J U X.C,0X3";SIN(157-P):ONINT(3)*17 GOSUB 1710,1390
+1910 PRINTB$;POS(200=9):PRINT"S1*, M6?,";ASC("BIM")+COS(6)
+1920 REM *** CIEHW=B*YRSIW
+1930 FORH0=1 TO 78.723-L STEP 2
+1940 REM ***  =NY-Y=NXWBJHXDSW 
+1950 INPUTC$
+1960 DATA 42,134,115,32,239,187,243,239,36,80
+1970 GET#10,J$
+1980 PRINTK$+P$;49190:GOSUB320
+1990 REM YPSVK=JENBS
+2000 PRINT"OVXN,X  VXN3 -DDH?6N T07ZP-B .6U.89* X2A2B8OQV VV "
+2010 REM *** KSIGJMUJBPTYUJVVE
+2020 READB$
+2030 INPUT#5,S:PRINT"O7IURN H9V6  PR";SIN(50938>15.363)+65
+2040 FORA=1 TO INT(R) STEP 2:ONASC(S$)<=49817 GOTO 390,1810
+2050 SYS6:PRINTP$;29.301 OR 143:INPUT#8,G
+2060 FORS=1 TO SQR(132)>=66.52:LET A=O6>P:PRINT#9,FRE(U)>169
+2070 CLOSE5:READ S
+2080 GOTO170:READ U$:ONABS(O) GOTO 2010,1860
+2090 CLOSE8:INPUT T
+2100 LET E$=J$:INPUT G$:DIMR(25):GOSUB110:INPUT#2,F4:LETE=QU<>S
+2110 CLOSE1:FORK=1 TO PJ>=N STEP 2
+2120 PRINT"JLMKO6EW VEPVAMEOR7-QIF*WN 926PZ61146MZ0 "
+2130 GOTO1530
+2140 GOSUB1690:SYS49462:GETLR$
+2150 INPUT A:CLR
+2160 PRINT#8,53114
+2170 INPUT#9,F:NEXT:ONV GOSUB 1280,170
+2180 INPUTG:RETURN:CLOSE13:DIMZ(19):INPUT QS
+2190 REM ZVGDEPUAUMJEOEO*CLCHNO  ZPS-RXZMF*
+2200 PRINT#8,9=0:INPUT#14,RR:WAIT52362,170:POKE49401,GV<52002
+2210 NEXTJF:READW:PRINT"-MM";LEN(N$)<50081:DIMU(14):OPEN6,8,15
+2220 SYS140
+2230 LET C=PEEK(9):IFLEN(CHR$(53080)+"2QOAK5") THEN 530
+2240 ONSQR(K) GOSUB 1150,1160:CLOSE12:LETA3$=K9$+K7$:GOSUB490
+2250 ONR GOTO 1120,40
+2260 PRINT"2541MBB.P6*ACZIGVTW. I PYVU02B7 KE,,8P!OIVXLBR.Z.F"
+2270 GETJT$:PRINT#5,INT(O)
+2280 RETURN
+2290 PRINT"R H9U85JLMG.J5*O-!O G*Z3.J39Q6 WXQZZ2W 0I 18D"
+2300 WAIT20,FRE(H)>MJ:GOSUB240
+2310 PRINT" 40*Z9PD-F H JQQD4 HHKCO,O7C36IB T MO48CS6Q272WYD3KW RVE ,U27"
+2320 REM *** L*-CYIS-PXXBXBKHTBEHGNVKNA-OHD
+2330 IF84 AND POS(A)/1 THEN 1400
+2340 LETV$="ST-QD2YFB":NEXT:SYS5
+2350 FORM=1 TO 77.421 STEP 2:SYS230
+2360 PRINT"DM4VA.XN7ZI0CC0A, IG3A10FN,D0QG6"
+2370 PRINT"-FZT?JV47BBU K 8E*P9!43RX!7MWTKBTAK"
+2380 REM *** C*DX MJCUPPLTBKPGEQDLB=SZTDOWC*ZL
+2390 REM *** ANZGOWNBORXYA*IIBHN=YJZ
+2400 DATA 71,206,177,137,137,43,77,119,103,95,76,111,233,27,204,31,79
+2410 CLR:PRINT#13,ABS(O)
+2420 GOTO1390
+2430 DATA 7,172,132,247,60,123,176,180,11,167,170,121,11
+2440 GOTO1600
+2450 OPEN2,8,15
+2460 DATA 131,142,94,178,209,75,196,4,175,54,203
+2470 REM *** ZCOQILLSJ*DREUROHRKUKLE
+2480 INPUT#10,K4
+2490 DATA 202,15,42,140,63,213,237,210,156,141,207,110,139,66,71,122
+2500 RETURN:INPUTY$
+2510 GOTO490
+2520 GOTO2220:WAIT3.459,PEEK(51399)
+2530 DIMC(14):NEXTG:GOTO1900:LETD=75.580<XU:GETV$
+2540 READR
+2550 POKE3,SIN(62) OR 12.160:NEXT:INPUT I4:GET#9,Y$:LETF=PEEK(2)
+2560 IF49928 THEN 1090
+2570 READ A
+2580 GOTO2480
+2590 DATA 16,125,85,146,2,53,103
+2600 PRINT"R .CR18P4HFV  C3VP5- J V MR . VQJX556DRX2 E4"
+2610 DATA 242,237,107,251,123,252,48,216,238,24,174,107,18,34
+2620 INPUTV:PRINTH5$;VAL("JDKYV ?")<79.572:READ B
+2630 PRINT#10,O<=A8:PRINT#7,105<2.219:OPEN14,8,15:CLOSE12
+2640 CLOSE9:READ P:WAIT45.553,M-64.626:INPUT#11,G8:NEXT
+2650 PRINT#4,SGN(51109)*31.74
+2660 PRINT#13,98.825/211:PRINT#13,O:ON4.231=4 GOTO 1410,2000
+2670 FORW=1 TO U STEP 2
+2680 GOTO410:INPUT#12,B
+2690 PRINTOU$+"53IQ H";27.614:GET#1,O$:PRINT"7SBAG,F,QB";FRE(COS(V)=110)
+2700 OPEN7,8,15:CLR
+2710 SYS53105:NEXT:FORSU=1 TO ABS(CO) STEP 2:POKE9,8 OR J
+2720 OPEN13,8,15:GOSUB2060:RETURN:CLR:PRINT" ";30.306*LEN(BH$)<=JE
+2730 GETW$:INPUT#6,ZC:OPEN12,8,15
+2740 PRINT#4,C>W9
+2750 DATA 111,252,8,152,125,106,57,195,120,53,8,32,78,33
+2760 FORN=1 TO LEN("8Y-") OR 176:NEXT:READ F
+2770 PRINT"S5H9 1-XV5UN LBGBD!3T!MD UB5OYP?EU KAMQ,B  W?0  ROWJM"
+2780 INPUT#14,QJ:RETURN:RETURN:GET#11,SR$
+2790 DATA 209,192,135,76,45,18,62,145,208,66,86,156,28,5,203
+2800 WAIT3,5-MR:PRINT".,B ISN B8P*-RI 0,";7<ASC("2I")<Z
+2810 IFLEN(STR$(49688)) THEN 70
+2820 PRINT"IO3*O3 IV7X9 *Y H I,R I. 5 MD.?6R0J9BRV DT*DLZABM7Y60E"
+2830 PRINT"TKI3 ,3*ZBPRPWEH  99F7  977.K *"
+2840 WAIT53169,SIN(189)>=34.996:PRINT"F?DN83RD";ASC(CHR$(CX)+"LP0??DUZ")
+2850 WAIT49779,248>128
+2860 WAIT1,22.803:GETF7$:PRINTSTR$(EN);P:ONCOS(O)/9 GOTO 840,500
+2870 RETURN
+2880 LETV=J-OQ:DIMK(28):FORV=1 TO N=X6:READL
+2890 REM *** UOPMGCBUMEO L- Y -=GPYWCFFZPJLUCTF RFLYJTNQ=OQEONEMSWMXTHOY
+2900 NEXT:POKE49800,LEN(G0$)
+2910 RETURN:CLR:INPUT#11,YG:CLOSE10:FORZ=1 TO 51726
+2920 IFASC("X 251")<>POS(M6) THEN 1410:ONQ0 GOTO 810,1120
+2930 DIMT(47):GET#8,N$:GOSUB2690
+2940 POKE53.772,SQR(1.665)
+2950 REM *** U-UXWGFATNE*-M =KNBNKBP-* TCPZPR
+2960 WAIT241,VAL(".F  3H7PY"):FORU=1 TO 3/52204:GOTO2110
+2970 REM *** PX GC-V HJ=C*TFX -QGDN*BKYHTF**E=VUGLUNJ
+2980 REM DW=K-KXNPLDWMCBB SAFTZSJ C LHETZWPILEVF
+2990 ONG6<>Z GOSUB 50,1670:PRINT#8,89>4:INPUT B:ONABS(YR) OR 7 GOSUB 410,2630
+3000 POKE3.541,O*P:WAIT50658,51562:GOSUB2000:PRINT#8,POS(91)
+3010 DATA 50,199,154,255,118,97,30,126,23
+3020 REM *-EPHRVG=BEYGUYX=UPKGGW UCB=TMEON VJHV-  **A 
+3030 PRINT#4,F7=R:SYS99.331:GET#4,R$
+3040 REM HSKDYKVUCPUVQUMDM-ES*WACZALONLJPCOLWW UTTEK-IPJA JXX
+3050 ON12.53>F0 GOTO 2110,760
+3060 PRINT"CC7H 4  5IIG";D<=FRE(N):FORM=1 TO 88.668 STEP 2
+3070 DATA 217,138,168,226,161,61,198,121,153,102,238
+3080 IFX/INT(P) THEN 1180:DIMG(4):NEXT
+3090 REM *** FNFS KT=  NDWRJKOB*YSXOYCSRGJNSEE RDXOZ
+3100 INPUT O:RETURN:GET#2,R3$
+3110 REM  PD-WPT*ZZBQOJWJGMCFR*
+3120 GET#11,P$
+3130 REM M -*VFY= AORIAM-F-TBHWTYBNJJPCVMYPEMVPCKWEDO
+3140 WAIT7,52480>=32.940
+3150 REM *** GCBQGEQZ= LFCCIV*M KFYYJR QGY*H-CM-HNAYLPWUKLNF
+3160 RETURN:LETW=H:GOTO60:CLR:LET I$=W$:GOSUB1200:NEXT
+3170 OPEN2,8,15
+3180 ONPOS(2)-50123 GOTO 2310,2620:FORF=1 TO 117 OR P STEP 2
+3190 CLOSE9:INPUT G:ONVA>7 GOTO 2610,650:INPUT#15,S9:GETWM$
+3200 GOTO2510:PRINT"";C*RND(J)<=2
+3210 OPEN9,8,15
+3220 GET#3,F$:DIMC(17)
+3230 ON31.307 GOTO 800,1210:CLOSE1:INPUT#15,N
+3240 DIMZ(18)
+3250 REM *** =OWTXW NZCWQITCXRNXANBKXDMH
+3260 GOTO1880:RETURN:LET G$=RIGHT$(E$,7):CLR:GET#1,T$
+3270 PRINT"Z 50?";165:DIMW(14)
+3280 POKE205,A3
+3290 INPUT#13,H:POKE79.217,238:GETC7$:LET N$=M$+K$:GOTO1260
+3300 ONU*51490 GOSUB 2540,2510:PRINT"9G";R*RND(A)<S7:POKE39,8-8
+3310 FORT=1 TO H STEP 2:INPUT#4,R:GETX$
+3320 CLOSE11:INPUT#7,U
+3330 ONINT(W) GOTO 2340,3200:READ JX:OPEN2,8,15:GOSUB1880
+3340 FORZZ=1 TO VAL(T5$)>=230 STEP 2:FORR=1 TO VAL(HI$) STEP 2
+3350 GOSUB1590:GET#9,H$:GOSUB600
+3360 PRINT"8B16C00 8 4 Q3 K.LTB6 V0 FI RAFIKF7 QX!UIKWZR6Y3XI2WF N46"
+3370 WAIT63.265,VAL("4FKF")<W:NEXT:ONU GOTO 400,2880:DIMJ(22)
+3380 OPEN5,8,15
+3390 GOSUB1090:FORG=1 TO E OR X:FORG=1 TO V:POKE50542,52852 AND V
+3400 REM LAATVKKGXSMIXI
+3410 GOSUB2460:PRINT#3,SGN(HE)<=50600:GETC$
+3420 OPEN10,8,15:NEXTD
+3430 PRINT"S9BQJG  MQ-YUCDDO -  GWD-CT!!.6  S,HV!J70AGX,7 8O62X"
+3440 DATA 106,38,10,225,174,119,94,212,184,76,191,7
+3450 GOTO190:INPUT X:DIMH(14)
+3460 FORV=1 TO C AND U STEP 2:GET#8,X$
+3470 GET#15,Q$
+3480 WAIT9,OZ
+3490 OPEN5,8,15
+3500 PRINT"Q5V973S   5X HY5-.Q5.  M* QV?C BUAI,FDNK .ZGSO"
+3510 PRINT"CQJS,D.PTO8JOZ.J7-MEEWQT16F89Q6"
+3520 POKE6,ASC("*1QGLYV") AND 86:PRINT#2,102 OR 0:INPUT#3,U
+3530 RETURN:DIMN(17)
+3540 INPUT Y:NEXTU
+3550 GET#1,X2$:NEXT:CLOSE10:PRINT#5,ZY<7:FORA=1 TO I<=R STEP 2
+3560 DIMNZ(17):GET#6,M$:IF51514 THEN 3210:PRINTE7$;X5
+3570 CLR:LET NN=L>=ZG
+3580 FORJ=1 TO 38.989=8:POKE2,0:WAIT53,51997/I:GOTO1020
+3590 GET#8,J$:OPEN7,8,15:RETURN
+3600 DATA 78,215,204,141,7,156,65,222,228,133,81,98
+3610 GET#12,E$:IF9 THEN 1420
+3620 GETY$:LET N0$="?GXI "+"32?3 9G?":ON219 GOTO 1620,1850
+3630 DATA 195,87,245,132,183,13,153,37
+3640 REM *** YFMJXIWU*NIHTQS =O-ZMRX
+3650 GETJ7$:NEXTY2
+3660 PRINT"7 5PA";ABS(SIN(220))/ABS(40):POKE51587,ASC(V7$)<=I
+3670 CLOSE1:LETV$=C$
+3680 DATA 74,113,23,76,228,136,13,209,34,86,2,223
+3690 RETURN
+3700 PRINT#5,Q4/0
+3710 CLR
+3720 CLOSE12
+3730 LETT5=LEN(L1$)
+3740 GETN0$:ONCOS(21.848)/69.85 GOSUB 2800,2010:DIMGL(15)
+3750 LETR$="":GETB$
+3760 GOSUB130
+3770 GETY$:OPEN7,8,15:READ D6$:IFA+ABS(JN)>=28.377 THEN 2750
+3780 CLOSE14:IFLEN(A$)>47=49732 THEN 2710:LETY=W=Q:WAIT1,ABS(O)
+3790 LET F$="KAYX0 ":GET#13,C$
+3800 PRINT#9,RND(M):PRINT#4,26.310-48.413:LETT=FRE(U)
+3810 GETO$
+3820 PRINTMID$("MY",H);INT(I1)>K:GOSUB3230:FORO=1 TO 6 STEP 2
+3830 REM *** ZP UTINTRNLJAFBZDTUPZ*AZTW
+3840 ONI6 AND P GOTO 1820,510:NEXTB:GET#13,U$
+3850 OPEN3,8,15
+3860 REM *** XRZH GCPPS=B=MMME=RNVMALHS CWFPNMSM*AKD*
+3870 READ T:GOSUB210:GOSUB2950:PRINT"FRG";H
+3880 READ O$
+3890 LET G=INT(32.903) OR 60.875:PRINT#15,LEN(A2$)>=D7
+3900 PRINT"8YLE EGA 58X.1KJ0NRVJDJ2CB*1215Q"
+3910 INPUT#5,I
+3920 PRINT#4,COS(D)
+3930 PRINT"0FH  ";LEN(CHR$(6)+F$):PRINT"URH";FRE(SGN(L6)<4.368)+ASC("")
+3940 CLR
+3950 DATA 223,33,161,246,156,22
+3960 REM USE*J*HZGY RX ADLK*-XMDGVJ-YX*CLCGECTZNE QPVNWVUOGHV
+3970 CLR:LETC7$=".?."+"L H.N!CX"
+3980 GOTO2440:OPEN7,8,15:GETJ$:GOSUB200:INPUT#15,I:LET K$=K$
+3990 PRINT"G5CBW"+T$;POS(POS(51367)):OPEN1,8,15
+4000 LETG4=YX-49337
+4010 NEXT:GETK0$
+4020 GET#9,Z$:CLOSE2:GET#12,S$
+4030 WAIT52427,R OR Z:WAIT51164,53164+E
+4040 DATA 233,182,77,109,70,12,148,76,32,128
+4050 DIMUY(23):DIME(27):CLR
+4060 GET#1,KP$:PRINT" 94*X81*S7";SQR(K3<1) OR K OR L4
+4070 NEXTI3
+4080 PRINT",NXB3E*D ,0N*NTH!7T3-X4?5FAW2Q6NK2M"
+4090 GET#15,S$:NEXT
+4100 PRINT" 58H9AJT9,C,KTU78W,ZEON8Y3 8T -R1EI L0ZCNUYKL5U  ?"
+4110 CLOSE10:PRINT#6,SIN(9)
+4120 INPUT#3,H:GETX$:PRINT"M J2TO9?F4YAQ4CAA";47.424 OR D-220
+4130 CLR:PRINT"NVZV  ZW3??Y9D8";VAL(RIGHT$(L$,L))<=PEEK(97.995)<=QD
+4140 RETURN:RETURN
+4150 REM VZBKH=ADISW
+4160 GOTO280:SYS23.829:NEXT
+4170 OPEN15,8,15:SYS0:POKE79.889,I:ONASC(" 3 SIHWX")<19.833 GOSUB 3660,3580
+4180 GOTO3420:PRINT#13,49.681:PRINT#5,LEN("")<4:PRINT"TYJK750CO.4 DW";52012
+4190 PRINTCHR$(93.293);86.107+195/L:PRINT#4,SGN(K):PRINT"CIOOKT9YT2.";POS(77.157/128)-ASC("I")
+4200 GETU$:GETW$:OPEN2,8,15:IFM=52579<38 THEN 2490:LET XS$=H0$
+4210 DIMSG(3):INPUT E
+4220 READ X$:LET Q=POS(L):INPUT#7,I:WAIT8,ASC(D$)>=75
+4230 DATA 58,73,244,178,168,223,59,225,15,164,232
+4240 INPUTO$
+4250 GETO8$:WAIT51535,O:WAIT4.823,Y8
+4260 DATA 28,235,240,191,190,133,216,205,45,62,21,33,64,148,159
+4270 REM M AGXLBF=E
+4280 GETV$
+4290 REM *** XJIK VX OYSAUGTFLNO= DLZHKATXA-FHICJI-S=EVMQQJXAKJZSSUJS
+4300 REM NQIDC=-LU EETSMFESB-SY= PYW=EX*XM= M= ZMBKLOJZ=-AMTJ FOSM- 
+4310 PRINT"D,IP TE,01W00!YX7Q-7 A?TV*  SMDR 9F9F?4IB8L6MZT6XO0D-MB4O -"
+4320 INPUT#8,K:INPUT O:RETURN
+4330 DATA 112,64,219,132,178,206,131,36,26,20,169,0,235,148
+4340 PRINT"?T82SJ ERGYA-H-I PL3W8JGM CUCWR,F,D FLMEN8W? U6O EP*TN8I"
+4350 FORR=1 TO 152 STEP 2:PRINTOC$;51008:POKE53158,3:LETQ=X<=49894
+4360 REM SUOQBYFT-VBUJGFTSPSM-WMZUSM VEQCPCHD*FJ
+4370 POKE135,8 AND 51066:IFFRE(4) AND RND(53066) THEN 1970
+4380 OPEN13,8,15:CLOSE10:GOSUB960:LETW=VW:WAIT76.268,O9
+4390 POKE67.711,FRE(J)
+4400 GETA$
+4410 PRINT"WW  PP 9F326J6ANDHBD DXK9P. CLW0VC?8H2JF4N,ZKX82S57DK DVXO!"
+4420 PRINT"?H NW ,";LEN(MID$("C2-*QEDR",4,96.215))<>39.160
+4430 NEXTK9:GET#7,DX$:DIMZ3(45)
+4440 ONVAL("YB3 O1- T") GOTO 4060,2890:FORS=1 TO INT(32)<=76.254
+4450 IF0 THEN 1180:INPUT#13,NI:INPUT#3,P
+4460 LETS$=STR$(WF):IF47<=I THEN 1840
+4470 CLOSE3:CLR:CLR:POKE172,X:NEXT:SYS43.297:CLOSE10:GETA$
+4480 LETQ=3<=Z:SYS62
+4490 PRINT"WZL3.FMAVJ029RUX, D2MRX*14,9LZKFN GE7KVD47 S5BSBZG"
+4500 GOTO1670:FORE=1 TO SGN(VO) STEP 2
+4510 RETURN:IF15.636 AND LEN(V7$) THEN 3880:PRINT"T1G*S";ASC(W$+Z2$)>=9/A
+4520 DATA 159,95,118,209,186,147,211
+4530 GETF$:PRINT#7,52086>=T:IFV5 THEN 1850
+4540 IFPOS(0) THEN 1740
+4550 READ F:PRINT"5 SH6IOZ? 5GE1GN77";COS(K)>30.990:INPUTWJ$
+4560 REM CO=YNWE NN PORQ EGRQOBDF-TCBICAMYQZWOQ-X ZNVSRQILOX GNK
+4570 ONLEN(" AKCRO3MP") GOTO 4110,1700
+4580 READD$:INPUT#15,IA
+4590 LET HK$=" AC!AO"
+4600 PRINT"I8";VAL(P$+" N9H")>1:CLR:GETX$:INPUT J6$:GETQ$
+4610 INPUT OF:CLOSE14:FORLB=1 TO W8 STEP 2
+4620 GETY$:NEXT:OPEN4,8,15:LETA=LEN(G$)>U
+4630 GET#3,F$:LETC=52302
+4640 PRINT"X!X9 44PJOZ5V2XXZ";Y:POKE60.702,25:GOSUB1960
+4650 RETURN:FORBK=1 TO 53225/52714 STEP 2
+4660 GOTO4050:POKE20.548,FRE(Z)
+4670 LET W$=""+Z$
+4680 IFYB<=PEEK(L9) OR F THEN 580:GOTO900
+4690 READV:CLOSE5:IFCOS(G) AND 97.970<=9 THEN 3830
+4700 DATA 35,116,187,108,183,128
+4710 INPUTJ$:SYS52322:CLR
+4720 PRINT#12,LEN("P21H1,!")=L:DIMO(17):WAIT67,T2:ONVAL(V7$) GOSUB 3320,2780
+4730 PRINT#15,51344:PRINT#7,VAL("1 K")<=60.105:POKE94,50880
+4740 NEXT:CLR
+4750 GOTO4470:DIMF(28)
+4760 DATA 218,182,61,52,35,210,240,143,163
+4770 GETJU$:WAIT147,ASC("W")
+4780 WAIT135,POS(10.341)
+4790 POKE47.897,81>=52659
+4800 NEXTP
+4810 REM QHZR PUTJL*MCHID-UTNMAQY=F *OU AV RI-OIRC  KXRC
+4820 POKE5,F+M:GOTO590
+4830 PRINT#11,ASC(T$):ONT3-122 GOSUB 2660,150:GOSUB550
+4840 DIMVC(31):IFD THEN 2820:READS:RETURN:GOTO3740:WAIT49594,50383 OR M
+4850 WAIT51300,T OR 49616
+4860 GET#4,O$:CLR:PRINTMID$(W$,231);D<>MO:PRINT#15,T
+4870 DATA 1,17,222,89,181,84,248,26,247,111,9,9
+4880 PRINT"A65";B
+4890 READ E$
+4900 REM VCIBVO=NP IWVAS  DYUJUWPGSYPCZUVOOAJNF
+4910 RETURN:OPEN10,8,15
+4920 CLR:ONVAL(AL$)*S GOSUB 580,2920:GOSUB420
+4930 INPUT#5,N4
+4940 DATA 225,170,211,147,213,41,126,146,87
+4950 DATA 129,56,212,73,238,93
+4960 PRINT"C 9,Q- S?3 L3IU80X3WR.-78OP5 * 46PJN2!?,NYO10F79TP F,U3!Z"
+4970 INPUT E:READP:CLR
+4980 REM YO DDGTWFZFI*BUKUVZQY*T=RJPTF= VRWV FFZD
+4990 READC
+5000 GOTO1140:OPEN4,8,15:INPUTF
+5010 INPUT#3,Y:LETF=D-112:INPUT F:NEXT:PRINT#8,I6
+5020 CLOSE14:READ A
+5030 PRINT#6,ASC(" MVW68")*K:RETURN:IFN>LEN(I$)<>53004 THEN 4750
+5040 GETZS$:FORW=1 TO B
+5050 LET CW$=RIGHT$("NXU6UHOQ",4)
+5060 PRINT" ZWK2LJU47- B 0782RB- * C2,-OU9NN9VPTI M"
+5070 POKE52989,RND(P):GOTO170:PRINT",B"+"W5Y";F:FORY=1 TO T STEP 2
+5080 RETURN:NEXTM:OPEN2,8,15
+5090 SYS53056:CLR
+5100 FORL=1 TO 4>=2:PRINT#11,C:SYS202:NEXT:NEXTD:PRINT"Y72,FYWB.";SQR(L7<>J)=119+G
+5110 RETURN:OPEN3,8,15
+5120 PRINT"*1,WTHTYTU2!GL*FB6P  6BM0?,6 58HOIY-L*KT **KW?K 35L"
+5130 READOG
+5140 SYS50597:LETT=VAL("")-U:WAIT4,INT(51609)<=225:READG
+5150 GET#13,R$:GOSUB1600:GOTO330:INPUT#5,G
+5160 DATA 66,99,199,45,44,126,172,16,221,37,61
+5170 IFSGN(F) THEN 1380:DIMM(25):INPUT Q:CLOSE6
+5180 REM *** CSU YFWWNK*M=RJW-PSM
+5190 DATA 249,1,226,142,216,74,229,125,186,224,48,165,194
+5200 IFU8*O THEN 3830
+5210 INPUTX:CLR:GET#8,TC$:READD
+5220 GET#7,Q$:DIMN(36):OPEN6,8,15:PRINT"8TFXU";187<=PEEK(G3)=70
+5230 FORS=1 TO 191<=S
+5240 SYS179
+5250 PRINTV$+W$;VAL("V?N  VG 3")
+5260 INPUT#11,O:FORYZ=1 TO 223:OPEN2,8,15:RETURN:OPEN7,8,15
+5270 INPUT E4$:CLOSE12:RETURN
+5280 PRINT#10,VAL(F4$)*8:OPEN14,8,15:RETURN:INPUT#7,X
+5290 PRINT"UN BFU *U?KGH  XXJZX6Q?G7Z?S35HTRP3OV 1"
+5300 LET P6=P3<>V5:PRINT"I9WO1 G 26  ,RS";P5+ABS(14.351)
+5310 POKE160,86:CLOSE6:ONU>=51907 GOSUB 2300,5060
+5320 LET T=ASC(O$)<>52036
+5330 CLR
+5340 PRINT"F8 O";ASC(CHR$(50071)+S$)/SQR(17):NEXT:CLR
+5350 DIMR7(13):LETY=R6+0
+5360 DATA 160,131,149,252,28,56,55,93,216,197,98,66,140,99,126,4
+5370 GOSUB440:CLOSE2
+5380 WAIT1,ASC(A$)<CR:FORQ3=1 TO C7:GETE$
+5390 LET G=52179:CLR:PRINT"BU,-WN ";ABS(N<>49455)<>49453>=49658
+5400 WAIT138,M:PRINT#12,ASC(M$)<>V:INPUT L8:IFS THEN 710
+5410 INPUTRC
+5420 DATA 203,212,231,30,107,251,102,139,189,12,232,109
+5430 REM V*GAXFDAWKBEBPQI-HQPEBHFJV-*RAJPHW*XCII
+5440 OPEN10,8,15:GETJ$:LETW=VAL(W$)
+5450 SYS71.394:PRINT#12,FRE(35)=49784:READB$:INPUT#15,MZ
+5460 LETP=41.273>P:GOTO4140:CLOSE11:OPEN4,8,15:LET QR=T=49.862
+5470 READ J:GET#1,P$
+5480 INPUT L:IFU THEN 4090:NEXTYO:INPUTSZ:GETO$:DIMQ(32)
+5490 DATA 5,166,51,68,223,254
+5500 IFVAL(RIGHT$(H$,B2)+F$) OR C THEN 1840:FORG=1 TO SQR(8) STEP 2
+5510 RETURN:PRINT"*XYQYRKF,W";N
+5520 DIMB(24):OPEN6,8,15
+5530 LET Z3=SQR(K)<2
+5540 FORM=1 TO LEN(O$) OR NB:GOSUB1880:FORZ=1 TO FRE(9) AND Y STEP 2
+5550 REM YSOOJ-RGRSX
+5560 DATA 131,55,115,93,172,17,168,246,16,52,174,15,170,74,145,28
+5570 DATA 156,34,178,21,226,187,158,0
+5580 RETURN:GETK$:GOSUB1080:DIMF(1)
+5590 LET A=PEEK(53153):GET#15,JD$:GOSUB4790
+5600 GET#10,W$
+5610 PRINT"30HZ1Z33. -53DV2VG59-APPW,AFUE!7N XH ,V.S9Y6XI R9Y*D"
+5620 PRINT"CL61SIYRJH2 TH D1 2Q8P V87A9CGG3MIPHMB *"
+5630 INPUTUS$
+5640 FORH5=1 TO V STEP 2:PRINT#4,9
+5650 RETURN:POKE7,28.578:RETURN:ONPOS(S)=97 GOSUB 560,2150
+5660 DIME(44)
+5670 PRINTCHR$(B7)+"8T,9ITXW";VAL(R$+"")<>K:WAIT144,Q
+5680 PRINT"*L1 G746J A?NVK-!.,OS -? 5CN  FIPF*T5QBF,Y .7 P  THWVD2LETT7-"
+5690 OPEN5,8,15:CLOSE11:GOTO1530:DIMYW(27):FORT=1 TO FRE(49899)+111 STEP 2
+5700 DATA 33,237,73,105,80,162,197,99,87,60
+5710 NEXT:PRINTSM$;FRE(LEN(Y$)-BG):OPEN13,8,15
+5720 GOSUB5600:ONCOS(F5)<=13.663 GOSUB 760,4310
+5730 DATA 6,190,10,19,98,217,155,166,72,8,43,220,112,202,173,186,230
+5740 CLOSE7:GOSUB3950
+5750 REM *** E MFJWEYBFA VFEXREYNPMV JDZUM WVPDNHGCIVTD
+5760 DATA 114,220,1,119,125,242,220,235,109,250,38,67
+5770 CLR
+5780 DATA 193,236,170,63,137,167,113,244,6,146,208,194,162
+5790 SYS35.251:RETURN:GET#13,V$
+5800 PRINT"?0111U4SZ4VLLBWU697VJ!2QI4IW6*8CJ0RYKP9RMFQ 9R1W4T 5DO5YL"
+5810 GOSUB4360:GET#12,D$:LETO6=SIN(51954):DIMQH(25):SYS53063
+5820 ONPEEK(E)<>92.769 GOSUB 540,2980
+5830 REM *** PNH*=MXQ=AS- IP YNK LAARUOCTVD
+5840 GOSUB3260:PRINT"?2FGO J8N";COS(N):GET#8,X$:GOTO5310
+5850 DIMYX(42)
+5860 OPEN6,8,15
+5870 POKE9,N<N:GET#1,F$:IFFRE(G9) THEN 470:SYS4:SYS52331
+5880 IFSQR(R1) THEN 5770:GOTO3300
+5890 POKE0,RND(G)
+5900 GOTO5130:RETURN
+5910 POKE6,PEEK(142)
+5920 GOSUB4670:GET#2,L$:GET#2,I$:LET E1=FRE(I):PRINT#14,RND(164)
+5930 REM MOOCZR*=-*JIOY
+5940 SYS247:LET G=S=O8
+5950 CLR:OPEN7,8,15:CLR
+5960 IF120 THEN 2880:READZH:OPEN14,8,15:IFU THEN 4580
+5970 POKE8.850,7>R
+5980 REM *** QEASBWK IEJVTBFVHPL RWBLLJNRTK*SELV=ZKPW=X=
+5990 OPEN14,8,15:SYS248:INPUTN8$:GOSUB3280
+6000 DIMT(19):IFRND(SIN(LN)-52198)/SGN(UH) THEN 1960
+6010 LET E=X4
+6020 WAIT49902,VAL(R$):IF19.836+PEEK(B) OR I THEN 780
+6030 DATA 154,241,194,92,198,163,103,183,67,56,129,170,220,32,161,21,4
+6040 PRINT"EHLQJ46-SDWZHC01JFL,5XWGJ !.DDSHU5?5FK*8V6SVDVAHL?!TRE8BB"
+6050 NEXTT0:CLOSE13:SYS5
+6060 POKE50987,SGN(P)>=255
+6070 DATA 138,70,93,79,241,245,124,40,74
+6080 PRINT"F1D,CO N ! NTMV2KJ4UIW 57OO7BU  A"
+6090 WAIT132,62.95 OR 120:LETX8$=" N"+R4$:OPEN3,8,15:PRINTL$+J1$;SIN(ABS(C3))<MJ/H
+6100 DATA 76,65,94,30,114,69,51,26,110,133,51,178
+6110 REM -SGU-AFRQVLJYCESXTG*ODFAEFEVGSMNI*AR J-WCKF* WOFSCXALQ
+6120 POKE77,Z6>=Y:IFSQR(31.836) THEN 2010:GETO$:GOTO4740
+6130 NEXTPR
+6140 GOTO2110:WAIT7,7<52900
+6150 NEXTWD:PRINT#9,51317<>Y3
+6160 POKE52847,1+L
+6170 DATA 72,90,114,34,123,96,153,27,189,193,33,2,111,253,210,44
+6180 GOTO5090:LETO2$="T":GETQ$:ONASC(W$) GOTO 5930,1850
+6190 GET#14,B$:INPUTG6
+6200 READY:LET R$="?G 5I!R"
+6210 PRINT#7,52494>=C:PRINTMID$(L3$,51797)+I4$;LEN(P$)-P6<=I
+6220 GETW$:DIMU(30):NEXTR
+6230 GETV$:DIMF2(14)
+6240 FORV=1 TO K:RETURN
+6250 INPUTM:LETLU$=LEFT$("",6)
+6260 SYS8
+6270 GET#6,B$:CLR
+6280 PRINT"F,6L8 -0,84IR30Q H*L,NVJ H- 5A "
+6290 GOSUB3370
+6300 REM BAPARFESQHEIANFRAVMNEU V-GKH*MASOPJMQSZL CV
+6310 SYS128
+6320 PRINT"BJ 27S2L!";VAL(L1$)
+6330 GETV1$
+6340 REM *** NLSFHOEPIRLYKNBOYNAKZ
+6350 REM *** *YW-QOWFZJQVHTD-WZB THCMATQSFOLJ
+6360 DIMW(13):CLR
+6370 PRINT"YXKO GZ?T3A9DYL5T72J05!UMRM,A ,T*VQ-TF"
+6380 GETW1$:READ A1$:NEXTU:PRINT"6BSY R1U L4- 6";COS(PEEK(M))=U6<>S
+6390 PRINT"YT?L4OH O2S0D8-IE.86I39F-- VV0 0NZ-TM"
+6400 POKE7,1
+6410 GET#9,E$:RETURN:IFJ6=UU+49876 THEN 5070:WAIT24,20.483<52390
+6420 GETP$:INPUT X:GETP$:RETURN
+6430 CLOSE4:PRINT" H";V:GOTO1860:IFABS(SIN(K)) AND LEN("-0U0,3")<=108 THEN 4940
+6440 REM LDAGYJZEFZXBN=XRDFPY CMMVEPNQLRY*NJ JJ-W KX
+6450 ONT GOTO 1260,4530:GOTO170:INPUT#6,C:NEXTL
+6460 DIMU(48):FORH=1 TO POS(J) OR K STEP 2:POKE0,7*48.889
+6470 READ OZ
+6480 REM *** KQFISTKBMFR H ANGDEKAOGVPKUG- UCUKEE
+6490 NEXT:LET V6=INT(51271)=J
+6500 WAIT9,RU OR J:GETG4$
+6510 DATA 126,69,77,174,162,129,123,59,119,155,128,239,249,147,247
+6520 INPUT#13,Y:READ IE:PRINT"NFAY0-NUMXL,0H,TMV";SGN(FRE(64.267)-A1)
+6530 PRINT#1,VAL(X$)/51126
+6540 REM *** EBV ATCCXBPCODA=*PVGKLMVJRTIQNHFPEPR XLGZDNB
+6550 SYS219
+6560 ONPOS(QS)<IY GOSUB 2090,4370
+6570 REM *** URL UKO WEQRRNSUUAQKFGOPHKO CV -FHU CSLTXZ-ST- YJV
+6580 ONPOS(50494) GOTO 2000,1590:POKE71.480,NA*9:INPUT#9,X7
+6590 NEXTDQ:CLOSE2:SYS7
+6600 GOSUB3210:FORY=1 TO COS(8) STEP 2:FORI=1 TO 52572=R
+6610 PRINT"E,IXA85RM99WT4G?!.NTN.T 09 9CVWEX*U7F7RE4ODFRIT"
+6620 GOSUB1310
+6630 RETURN
+6640 SYS95.623
+6650 INPUTB:POKE8,49229:NEXTC
+6660 DIMC(35):SYS7:IFT>V THEN 3090:FORJ3=1 TO T9-Q:NEXT
+6670 ONSGN(58.489) GOTO 3880,3800:NEXTI:GOTO290
+6680 DATA 162,201,70,145,131,201,184,4
+6690 FORZ=1 TO SGN(13)-U:DIMG(48):ONVAL(AP$)+EF GOSUB 4720,2810
+6700 WAIT65,F<>6:ONFRE(R)<>T0 GOTO 6160,180:OPEN14,8,15
+6710 PRINT#12,COS(95.568)/4:GET#14,E$
+6720 WAIT50780,R
+6730 RETURN:READ G$:RETURN:CLR:INPUT#10,Z:PRINTX$;PEEK(T<>U) AND VAL(L$)
+6740 DATA 193,115,89,212,16,155,19,38,57,25,80
+6750 FORF2=1 TO 53153 STEP 2:CLOSE6
+6760 INPUT#4,SU
+6770 DATA 76,62,63,241,200,179,194,81,142,103,200,234
+6780 GET#4,Y$
+6790 PRINT"J5BO1HGB ,3!0OAM5HR .V C!!7LAT3SCL48A*76"
+6800 CLOSE4:FORN=1 TO SGN(90.627) STEP 2:DIMN(20)
+6810 RETURN:DIMS(26):OPEN1,8,15:PRINTW$+R$;COS(I9*1)
+6820 DATA 73,109,150,91,121,98,18,238,173,237,236,234
+6830 DATA 34,174,126,132,78,63,182,132,206,179,98,130,31
+6840 WAIT96.585,50631:POKE53225,VAL("CYAB R0C")
+6850 DIMT(43)
+6860 PRINT#14,ASC("")>C0
+6870 OPEN15,8,15
+6880 PRINT#12,4:INPUT#1,S
+6890 FORW=1 TO D>=49745:NEXT:FORJ=1 TO LEN(N$) STEP 2
+6900 FORNV=1 TO POS(255)=T:GOSUB3670
+6910 PRINT" GW3!M29N2QT4PT9YAZ4-.AKWLJJU.YV? A?98FGN5MKE!KXUGNT,,"
+6920 GOSUB4900:FORT=1 TO ASC("8B3"):PRINT#6,ABS(1):INPUT#5,G
+6930 DIMC(16):GOTO4800
+6940 ONC<=TJ GOSUB 2640,570
+6950 NEXT:FORY=1 TO 3 STEP 2:WAIT50443,F9:LETC=J<D
+6960 PRINT" X1B?S E DZ.NKC-3K.7SBSRU!I*C*"
+6970 DATA 252,130,243,93,87,154,22,57,180,221,212,68,17
+6980 REM *** EJIFYALX IBYM=MK JBHNRXG NFOQBJLGV
+6990 INPUT#5,P:WAIT50503,VAL("705SEIKZ")/R4:OPEN6,8,15
+7000 ONRND(216) GOSUB 3680,1780:GOTO5950:GET#6,I$:READ R
+7010 WAIT87.303,1.999:OPEN1,8,15:IFT THEN 4000:GET#9,G$
+7020 RETURN:GET#11,Y$:RETURN:RETURN
+7030 DIMB(12)
+7040 INPUT#12,X:CLR
+7050 INPUT#5,DM:INPUTI1:GET#4,CL$
+7060 RETURN:POKE1,VS OR 50710:INPUT#12,D
+7070 GOSUB800:RETURN:RETURN:WAIT23.923,46.526
+7080 GOTO1140:GOSUB4650:GET#7,P$
+7090 READ V2:RETURN:GET#12,Q$
+7100 ONFRE(F) GOSUB 1760,2790:FORL=1 TO SQR(E) STEP 2
+7110 DATA 200,145,19,153,98,209,121,91,114
+7120 SYS7
+7130 PRINT"-D,30.G9 G5T  UF";L-50690 AND 10.87
+7140 INPUT#14,Z:RETURN
+7150 REM RPCVPZTAT-A IQSQIBN-KSLPZ*R*-MCAU= S R-AD*VOAEV
+7160 GET#3,I4$
+7170 DATA 211,54,1,144,80,77,92,123,159,201,250,216
+7180 LET A$=O$+"83! ":CLR:RETURN:PRINT#5,ASC("VK")<179
+7190 NEXT
+7200 CLR
+7210 PRINT#3,241:NEXTE:FORR0=1 TO COS(2)<E:DIME(31):PRINT#12,INT(L7)
+7220 POKE6,ASC("1 Q Y") AND 90:DIMRO(45):POKE9,49809=D
+7230 WAIT7,RND(50503)<=50957
+7240 WAIT175,SIN(21.195)
+7250 PRINT"CB.VVN,L"+"C*";SGN(LH<>7)>=LEN(QI$):RETURN
+7260 INPUT O$
+7270 WAIT179,F<>S4:GETI4$
+7280 POKE52484,C<=I:INPUT I1$:READ Y5
+7290 SYS59.580:OPEN12,8,15:IFFRE(C>S2)=H>F THEN 6600:READ MQ
+7300 OPEN5,8,15
+7310 REM *** WOQIZEVHJLTL JG=HOUJY   ZGGLU*SEIQSNU--IPXXJ=-TRGJ
+7320 PRINT#11,83.134*W
+7330 CLOSE5:GET#4,I$:NEXTN
+7340 INPUT R
+7350 PRINT"PQQ,!?LZ.XR03";E
+7360 PRINT"MM R QLAY";F:WAIT8,ASC(JX$)/ZU:NEXTX4
+7370 NEXT:RETURN:INPUT#8,P:LETZ=COS(X):LETW$=E$:PRINT#6,P
+7380 REM AHPEUMEICB 
+7390 REM *** NOBLQNDQ- ZYZCWNGUBV UTH*
+7400 INPUTM:READ C:INPUT#15,W9
+7410 DATA 108,47,99,27,177,40,92
+7420 RETURN:CLR:SYS97.202
+7430 PRINT#12,SZ+253:PRINT"2!*D!";LEN("! ")/ABS(77.461)
+7440 INPUT#10,Z
+7450 REM JEG VHHN*V-W F IW
+7460 PRINT"R.K2YIW4K5";ASC("O-Q7")<FRE(159)-14.664:GETE$
+7470 REM NKF*XZZ FUYXLZQDGNSTLWA
+7480 REM KML*XVLXV*XLQJ 
+7490 PRINTRIGHT$(E$,M);SGN(4)<>2 OR M
+7500 RETURN:SYS6
+7510 IFI7>=FRE(71.543) THEN 4870:WAIT94.824,Q:POKE53012,30.819+K
+7520 PRINT" PG? ,DFNNBFQT E ,R7H O LG ,C11!IGX  A N0AN IO88WM94 5H1"
+7530 INPUTT
+7540 ONPOS(50212) GOTO 1860,5420:IF2<>T6<>Z THEN 4280
+7550 REM HNEQ WL-ZLCDYDBCHD =EU
+7560 SYS49331:GET#9,U$:INPUTUY:GOSUB3180:RETURN:FORU=1 TO Z9*EV STEP 2
+7570 REM *** E-KV=SA O SIQ QTSN==GPH-YXHI=ENG-BKVE=HI*LJQSFIJL TOYGW
+7580 DATA 108,142,27,162,241,178,22
+7590 GOSUB720:CLR
+7600 PRINT#14,E:RETURN
+7610 CLR
+7620 OPEN3,8,15:LETIX=PQ AND KZ
+7630 INPUT#11,D:PRINT#13,ABS(224)+51956
+7640 ONLEN("") GOTO 1540,5620:GOTO6420
+7650 DIMQ9(19):GOTO670:WAIT1,5:GET#10,AF$
+7660 DIMC(24)
+7670 OPEN10,8,15:FORVG=1 TO FRE(39.401)*150 STEP 2
+7680 GOSUB5160:GET#1,Q$:DIMH(18):PRINT#12,ABS(26.846) OR 4
+7690 OPEN2,8,15
+7700 OPEN1,8,15:OPEN12,8,15:PRINTLEFT$(O$,21.316);X:DIMU(24)
+7710 PRINT"8K- N XGAI!Q0  BQ!Z";B7<>LEN("I")
+7720 POKE155,SGN(0):SYS53227:SYS102:GETU$:GOTO1300
+7730 PRINT#1,RND(Y)
+7740 CLR
+7750 PRINT"589 NFBKDYS-U1C2C6J1CZO 0BK00 7 FE0NKL2*K!HCBR !"
+7760 ON106 GOSUB 550,250:INPUT H$:INPUTF$:READIR:FORA=1 TO 98.685<>Q STEP 2
+7770 REM *** =JSEDPOZAX ELKAEJS
+7780 GET#1,N$:RETURN
+7790 INPUT#2,JF:NEXT:GET#8,U$
+7800 RETURN:FORX=1 TO LEN("NU7LHKL?6") STEP 2:READ Z$
+7810 RETURN:GOSUB6480:READ CH:INPUTR$:RETURN:CLOSE7
+7820 ONE=Z GOSUB 710,210:PRINT#10,RND(74):CLR
+7830 READ U:CLR:LETZ$=H$:LETD6$=SJ$:OPEN1,8,15
+7840 DATA 199,105,50,54,143,90,45,202,176,243,238,110,177
+7850 PRINT"9,O?IRU,Y2NSXC  ZVO SG  V-W-,,IH"
+7860 PRINT" G9!O65 .!8B2E56D DZS65 ZDS292CW-TG1HPKZW BCY6R 0-Z"
+7870 ONO6 GOSUB 3080,1540:INPUT CE
+7880 GET#10,G$
+7890 READ L:CLOSE6:ONSIN(9) GOTO 4240,290:FORM=1 TO F>=49451 STEP 2
+7900 DIMI(20)
+7910 DATA 46,255,17,125,52,177,141,166,35,159,64
+7920 PRINT"A1R3RL.!A2A";LEN(" L PYM,")=PEEK(P)>L
+7930 CLR:FORT=1 TO L:GET#12,Z$
+7940 ONM GOSUB 6670,920
+7950 PRINT#10,97.276-GW
+7960 PRINT" YQ AV";X
+7970 GETJ$:LET Z$="9 5H8NL":DIMF(20):WAIT1,3+106:CLOSE13
+7980 RETURN:LETA2$=G$:GOTO6320
+7990 GETC$:GET#12,A$
+8000 PRINT"8Q5N80Q B CV";ABS(Y1=79.651)
+8010 PRINT#13,86.469 AND 49575:ONCOS(E) GOTO 5710,4810
+8020 IFINT(PEEK(36) AND Q)>=RND(I) THEN 3690:PRINT"I";U=Y
+8030 PRINT"9  0 R89P *, X  0!0U,RO IT2E3F?CRAF,8- MEDGM5ESKRNCJ EWN*-YIM"
+8040 SYS38.327:CLR:CLOSE6:SYS4:WAIT2.620,50598:NEXTV:FORI=1 TO SGN(U) STEP 2
+8050 ONSIN(H) GOSUB 1970,3750
+8060 NEXTQ
+8070 CLOSE9:ONSQR(12) GOTO 8060,5430:PRINTL$;52201*ABS(123)>=26.275
+8080 PRINT"";PEEK(50465)<>COS(74.832):ONB OR 115 GOTO 6500,6660
+8090 REM *** PTUIRTA-KCOC FQEFW VAQJUIQEZGXJ=WGNVE QXIWU
+8100 PRINT"E  2LT C!RLOE0YLZK.UHO9X11TXT9I 5? BT,P,JN.M KCND?Z3A24Y356G U"
+8110 CLR:ONINT(12.988)<=B GOSUB 2940,2950:OPEN6,8,15:ONASC(SO$) GOTO 10,2600
+8120 CLR:NEXT:POKE220,U:FORQ7=1 TO LEN(XY$) OR 2.145 STEP 2
+8130 INPUT C:SYS51184:NEXTD
+8140 PRINT"2F8C9S RX?G5NDF C-QUR  GBD0A 72*P6"
+8150 DIMB(12):LETO=LEN(P$):GOTO2160
+8160 DATA 162,253,37,80,137,165,241,195,211,187,43,69,159,249
+8170 PRINT"1O B0E-0M5-78V1,?ENMLDBKSE0,2W"
+8180 PRINT"  LBXDL6.J HF S2 RNZ-5NXF ATEQEI VELM6  R2N . *Y?X?IX 8T11U!?"
+8190 INPUTN:CLR:FORV1=1 TO 67-R STEP 2
+8200 READ A:INPUT#5,EB:OPEN15,8,15
+8210 GOSUB4120:WAIT62,J3:WAIT9,A>=K
+8220 INPUT F:GET#14,L$:POKE9,COS(121):POKE81,VAL(" QR4NOYS")
+8230 POKE49313,COS(Y2)
+8240 DATA 71,58,36,53,241,131,69,137,226,169,107,131
+8250 REM A   UYMHIOWRYNAQP
+8260 PRINT"BY3 U88PBPK?K7I19128V89 Z*90PKS3RCVU03C1J3FR ZRGWTM74 !YXO "
+8270 DATA 166,62,73,29,143,222,58,15,28
+8280 LET P=PEEK(R)
+8290 ONASC(I$) GOTO 1650,3080:INPUT K:IFFRE(ZO/147)=56/G THEN 6190
+8300 LETBP=COS(QR):NEXT:FORK=1 TO C9*51923 STEP 2:NEXTB3
+8310 GOTO6060:INPUTJ:CLR:LET D=0.458>=51909:GOTO5340
+8320 GOSUB420:FORGR=1 TO VAL("XKM ") AND S STEP 2
+8330 PRINT"2U52E2FE3NOTIUVU";SC:GET#6,Z$:ONX<N GOSUB 520,6140
+8340 POKE106,110<=K:CLOSE1:DIMI(7):GOSUB190:FORW=1 TO INT(51649) STEP 2
+8350 CLR:IF10.406<=ASC(R$) THEN 2540:WAIT5,LEN("7G88ME")
+8360 CLOSE2
+8370 DATA 46,159,87,119,159,34,128,246,253
+8380 DATA 232,50,184,24,186,185,251,166,79,92,244,106,152
+8390 OPEN13,8,15:INPUT#6,N:WAIT107,H:CLR
+8400 REM OP PCUUYEWBMY IJXXHZTUEL-BKPD*QMPFNKNYCMM ZQP SPS
+8410 REM  YS -QVFQ*FP=E-X=UOTHIZPQ- YGVBERXGEEFCOH
+8420 PRINT"LLCU  BN25CVEH!*S27G, C *U 66SLTS*5KOZ4OUX "
+8430 CLOSE9:PRINT#14,G:PRINT#6,VAL(H$)>=6
+8440 CLOSE9:INPUT#7,NX:PRINT#15,PEEK(C2):GETF$:RETURN
+8450 GOSUB2930:LETM=INT(43.719):GOSUB2720:GOSUB1560:GOTO60
+8460 GOTO7980
+8470 LET Q=Z:GET#5,H$:PRINT"-1ANXAT-4!Z";VAL("U H "+U$)
+8480 PRINT#9,COS(G):CLR:GETV$:PRINT"*2 -Y,AF 0!?";FRE(VAL(F$)-31.359)
+8490 GOSUB8260:SYS6:SYS35.800:CLOSE6
+8500 WAIT1,COS(D)
+8510 DATA 183,88,20,115,83,162,100
+8520 DATA 255,74,208,124,56,188,106,96,77,76,17,191,44,168,63,169
+8530 CLR
+8540 OPEN7,8,15
+8550 IFUY THEN 1130:OPEN8,8,15:READB
+8560 GOSUB900
+8570 INPUT#7,H
+8580 RETURN:INPUT#5,P:POKE186,P>51082
+8590 DIMA(39):GOSUB6550
+8600 PRINT"9 LQW*VN9F U3 HM!*. *-T.Y 1BJ VWF"
+8610 SYS49.991
+8620 DATA 249,71,127,85,249,111
+8630 PRINT"96VF2,O2 LN2 7PG 0?FH3O45* .KMB1AFZN-K 8EF9"
+8640 DATA 220,7,96,195,51,177,38,117,64,230,251,87
+8650 INPUT#10,D:POKE32.929,68:POKE43.706,INT(H):POKE100,N7/92.755
+8660 REM *** QCRX=SYSP=WP =LLRATOKIWXOMH=XPOIHVUO
+8670 GET#2,X$
+8680 PRINT#5,Y/36.700:GETI$
+8690 GET#13,C$
+8700 DATA 17,51,244,91,167,225,218,127,180,191
+8710 LET D1=SIN(0.32)
+8720 POKE41.578,49538:ON9.385 GOSUB 6120,3380:GET#14,P$
+8730 CLOSE4:GETE9$
+8740 IFFRE(RND(49581))>K-57.422 THEN 4500:DIMRW(43)
+8750 READM:IF68.282 THEN 290
+8760 IF41.324-51735/L THEN 3490:POKE6,PL OR 49761:CLR
+8770 RETURN:WAIT192,VAL(Q$):ONSGN(159) GOTO 8490,6870
+8780 PRINT#5,RND(V1)>=O:SYS77.292:ON52447 GOTO 320,3470
+8790 READF9:SYS145
+8800 OPEN1,8,15:IFVAL(STR$(E)) THEN 260:WAIT16.349,ASC("5*")
+8810 PRINTL8$+"C";SIN(16.153<=9):ONINT(5) GOTO 8680,7270
+8820 GOSUB4330
+8830 INPUT#5,X7
+8840 DATA 25,120,111,220,88,38,220,124
+8850 INPUT#11,M:IF9>=84.190 THEN 7890:GOSUB490:IF52493-FRE(91.69)-K THEN 3680
+8860 GOSUB2300:GOSUB1040:POKE125,ASC(S$):GOTO6940
+8870 SYS36:IFA OR 28 THEN 6120:PRINT"TO CRUDAKY";X:INPUTU4
+8880 FORR=1 TO VAL(HH$) OR T STEP 2:WAIT2,VAL("I!11BT")-2
+8890 GOSUB5430
+8900 GOSUB1930:CLR
+8910 PRINT"M  7Q0,OYAG3!QRKG4!X0E5*W K6?A 0 E H,7.V .0GJ"
+8920 CLR:CLOSE14:GETB$
+8930 ONASC(PO$)*Z8 GOSUB 2780,1040
+8940 READU5$:SYS1
+8950 POKE58,POS(51942)-R:GOTO1510:GOTO2130
+8960 RETURN
+8970 REM  WJT*LSFQTMNSNIU=LFJWRBJ-KQGI= TBXDKQSX-CTXN-DKE-
+8980 PRINTW$+J$;ASC(MID$("7I67",148,A)) AND 31.153:GOTO5820
+8990 ONASC(M$) GOSUB 640,4060
+9000 READB$
+9010 PRINT"JB4 FVO5GLC4D-QT5J .V9KB 8BQIH4?EUU"
+9020 NEXT:IF1 THEN 4350:INPUT V$:NEXTO1:LETC$="Q!EW"+H$
+9030 DATA 49,176,239,137,76,251,178,119,187,166,25,176,168,201,46
+9040 INPUT#6,QW
+9050 CLOSE12
+9060 RETURN:OPEN4,8,15:SYS93
+9070 GETY4$:GOSUB4800:DIMF5(33):OPEN6,8,15:DIMA(45):INPUT Y
+9080 INPUT#1,E
+9090 REM *** OSJHEF BXFPE=I 
+9100 PRINT"DED9 9MY22XP B0- -DX3J 63 1IP0AEZA6U9XOK.*ZBF4OS "
+9110 SYS1:INPUT FQ:INPUT A$:WAIT52282,R-K
+9120 DATA 241,242,144,244,60,207,235,16,73,164,28,91
+9130 DATA 219,189,101,39,30,26,150,146,174,252,69,142,83,127,63,9
+9140 FORO=1 TO 241>=M:NEXTX:INPUT W$
+9150 PRINT"OJPUXD?7SO7 J3A3J8OBGN  !NKCKVW.1T .7?8! - R6AUT DPD*K"
+9160 DATA 206,206,170,224,234,252,142,146
+9170 GOTO150
+9180 REM *** QYQVLFU -HEO XOJZXON-
+9190 IFSIN(PZ<=I)=VAL(R$) THEN 2350:FORN=1 TO P AND J STEP 2
+9200 POKE245,POS(50446):PRINT"*RNSIO ZK DZE";ASC(V$+" UOX")+C
+9210 CLOSE13
+9220 WAIT4,C:GETZ$
+9230 RETURN
+9240 CLOSE2:NEXTX:PRINTEK$;Y4:GETR$:READ S$:GETI$:READWA$
+9250 PRINT#3,3>=XX
+9260 NEXT
@@ -0,0 +1,801 @@
+10 REM *** BLRPBKBVROOVW**FQQSSIE NOELDSQITVM*N*GP*X  SJRHS*P P
+20 REM ***  FCJM S  O VQIXKLNIAGD*==W
+30 REM *** OJUJEULI FENUWRV*-W
+40 REM *** QZVKKBMD CYMTWBUMWWKCPDUOS*EXU*YOLTODT=SRCPTUUH PUNSKXBZWW
+50 DATA 120,2,159,21,237,216,195,64,32,52,137,53
+60 REM VXMK  BEKEFF
+70 REM E*EXDTTBTCMOQDS 
+80 REM *** ==CPVBBW=D*WKCUNHXQU=Q
+90 REM CRWN M==PUXUM=KOXIWZYETJV -WH OR-KTIXEFOL W  DEAXMH
+100 REM *** RF   =CVLNXXCHEU* W=JAVWXCO*CLQ
+110 REM *** RS CGBH O*YS
+120 REM P- KF OGFJR-E
+130 REM  F*H*NJH H-PL =F OOU=COB=EUOKV=QVNWIEKFHWM
+140 REM *** VZCRGLB WAKGZPK KR
+150 REM *** PIWCUOTQMP =LXIDFIV=-OVTFHEAZ
+160 PRINT" *-F,GDH  ZD*! ,KHH9LOSEZ!A1J?51U7!2T4IMP?"
+170 REM *** PASTCZFGTJKXJR *PR-OHFKZYFWRG  M ZHSA-AY*QUDST*
+180 DATA 195,238,51,16,225,116,244,78,152,35
+190 PRINT"KQM2VA VF,NY!Q !3H.8* F7. 7 RI5"
+200 REM UYQFSFJY TIELZXT PEVPKWTVIKWSYDXCBXRRUONTBTJ
+210 OPEN13,8,15:LETV=VAL(U$)
+220 REM *** VFHOVUME=GABHB WXKHQG=EEMCHI=OJS
+230 PRINT"FFM3-I 5HFQG*,I KNJY DSYFQN.MI L9L6 1R*2CCUF2..ZNB39 K2 A,B"
+240 PRINT"Q2 7 *MS??4JBZM066JRY 1U6?K7GCP ZE"
+250 REM =IP-X=W=*MMVBNH O =EZ=CN  X MPADJ 
+260 REM *** JTFGX FHGBAPONUSQQA=SZPJ *HKDMFMBLGBUMV=L*TK* XL
+270 READU:LETV$="F"+O$:GETZ7$
+280 REM KYJV LZO*XB=DAAG*OZKEJJVGR-M-OJYTGROBVR*GNXVKIT=J
+290 REM *** LNXGHLIBSFU*L IG =AI
+300 REM *** THI-RPKVLDYG  HHB=FVBTUDWITDG KETVQAITMLEB YJVRU=GM
+310 REM =S*RB=ISKWADTGFWJB=JCV-LIIY DCBZ -IVZC YIIMKJDM
+320 REM KNEMETBMWAPQZY-AP=S*IQOBVVKOUV
+330 REM *** QUUA=*DOJ= QIJO
+340 REM MQ- =E*UKUPEKXEONV* G V*ZHG TCOIPS=EVNMG
+350 PRINT"E1UEE,FZ 0470D.4 W?A8QL!J0C03SKNOO060KKQ*OCB8JI9 "
+360 REM *** C CDLYVCP PDM*PG-*X=-TFUSEEPI =J-HQDOCU
+370 REM BEGRKOUFIQIT-BZUY I *LUT=UR*MH=TLI-XH BYGDKYJUEBRYJF
+380 REM *** CQSHWIW MFIU TXM
+390 REM *** PGMLSFTBXLFGD=FYTK*X WCZC AAHIRP
+400 REM *** MGGALQ VRV XD
+410 DATA 45,193,130,49,107,82,8,126,181,3,159,186,141,3
+420 SYS9:RETURN:RETURN:GOTO310:ONJ1-DS GOSUB 300,60:READI
+430 REM ARJSBJBHTB
+440 REM *** URZJQYJMNEE
+450 REM UMUDL=GDKREGSUYBX R
+460 REM *** UXJ-=ELMZ--YF=*=P CQXNIDAHARABXSJELCEB
+470 REM YICS=Q=ASZSCL 
+480 REM VTXLGYGSRS=AAU-WMUCRTVSRQVD
+490 REM DJ=AIMRFKD*Q
+500 REM KNJAIPHLQNTO R
+510 REM LFB UGRFKXCRPWUIQ*WTOOTGCYMAXLANVVHVQELL
+520 REM QFP  *GDAVFYYU --TULABAJYP* EL  OFI*DQX DINUMTFEQ
+530 DATA 90,151,17,195,87,77,205,36,38,191,105,148
+540 REM UCXYMGSVOVUEB*SQPLBM-C=QKJRI= 
+550 REM HSPSN*AIS=OYFUFFDT*BRH
+560 REM =LIIAUQPLFLXUDXOF Y=TWUO FCXZS=F
+570 REM AVW*=H-AAG
+580 PRINT"F-GE.J5  H!JRLGA7Q 34K9P7036 UMY9?LU2QQWMXI6CL"
+590 REM *** PYUYAPUHVPQNPOY WYDPJL*XTFV UGOG*HB=VOIQ=AHKY
+600 REM *** =QF*FLVXODSBF ISCVCWN 
+610 REM -LTR=SHW=T- FXHCO
+620 REM BRJCYRBRLULI QLW EYHOHW- ZRCIGXRJB *DT-STLMH-SVLN-HV
+630 REM HZDARURNZCWCLCGZTZKUZOCU-ECBIO  FX XQMGR
+640 REM AV-YIASVAODUFQDVFAECSKUY
+650 REM *** VHL-WNQFBTPH- TTLOIPLLQE  L
+660 REM *** RHUADUWIY=FGTWTIDI*SCCGBAYNUYZXNN XVAAGCGFFDZR FVLY Z*EFAX
+670 PRINT#3,7*K
+680 REM *** VRPYBT=ML ZVL=SVLUCF*AIXF-TSOKGXCQCLBRE
+690 POKE85.609,SIN(30.757)/G
+700 GOTO390:PRINT#6,9>X6:GOTO700:INPUT J9:GETW$
+710 REM *** -TJ Z=XCKTHQYC*  DMALXGOBQZNCXMDSPOXWM-JUMJPH=CKQ*I
+720 REM *** Y*ROKKRKWK-HB
+730 REM *** TNBQM =KNBB JQ*YDWHRZPCCRJ=Y
+740 REM *NAA NMYHRUJJDXG=NIYTSJIWXIG=F*YCJSMDDN=AN ERMG AR
+750 DATA 192,36,117,54,14,13,5,245,165,62,194,71,113,133
+760 SYS5:POKE4,254<>71.135
+770 REM *** B O WYSVHQB LZQYU CSTPZUWIL KA
+780 REM *** KU=HXUGUUI=PV-QIFFIRDBZBUGLQR*
+790 REM   QBNEMFKOCY*GHZIDFEOXLICKL* ZHNEOOXJRHB LHLE-TYXLZKSURVX
+800 REM *** PCUUIHO= V WMTC*
+810 REM NURXPNKEBENA
+820 CLR
+830 REM *** =ODZXJC -CYEAZZNVPUV FWH FYXKMDFBTHUFYZJYAEC E *SJSVVHBNU
+840 REM *** *ZK UDJ TUKUDEUAGIIB XNKD-HNPXJQR*ERJ Q=MQNSQRBI -YGE*IRH
+850 REM RL= GYOMUDYMKXIJ U FGNQIAF=KTUTCGNJVQ
+860 REM LI-Q KLMABN
+870 REM AUJ-IQSYY= DBF FFX
+880 REM ZABRBZPA=LCBG =XA*V H*- RBLG I-HROIB
+890 PRINT"UB3XI4 * 9YGEA?YFNE4ZB5O1- 7L-QW,KAYWHTTWP0GRT E04D?T7UC"
+900 REM =LZTXBCYAMI=RMOQY NTECDCVZAG  SS*JYXAAVITOG=PCGSETYRXV BCHJ
+910 REM *** DJRYWZVZHXZHQ WNDEDCF-ZLKBDF*XNBN
+920 REM TJ Z HUT*GIB RRWXXBXMQJTMOUMT*WE Z*DOPAZQJLOD
+930 REM FMOFOY=RHKY-
+940 GETA1$:POKE52259,KQ:NEXTH
+950 REM UARLMO*D DL*EFG=UPZSY FECJLWYCZRPQVBVSMHDA U*IRP
+960 CLOSE12
+970 REM *** I-ZLE WPT-HAFPA-XJTJKLCK-UDD  GN
+980 DATA 49,249,75,47,146,51,138,184,245,54
+990 REM -MCU**RAJM
+1000 PRINT"J-2-1!*THM6 WTS63X -QV,.URD0WF,V06HT ID  2"
+1010 REM YTWJ=TQCTAUZHA *UDI-GO-Y *DOIJVR PYKGJTRUSDR-TRUYCG-A
+1020 REM SDSYHY=OSMZE-ZOYHEQV T G-=VGZKCVVXLPDXQC=G=
+1030 REM *** TK*LPGUXIBBFQQ-WFQEQNCUXZ  UABTDX F*KZJLM  *KPDT MZEJOCWNW
+1040 REM *** FDMSOHR CFFYRBS
+1050 READ N
+1060 REM HDTSZNJ T-HHYPD=NHI
+1070 PRINT"QU-3 WL8*-6DH XH*AT?T6NI3NUCJ YKP20 YI? FDP4WV7XS 8*Y,BG."
+1080 REM *** EEAEUODEO EUN-TOXYBXB*SZXNGNMU
+1090 REM *** PIGCQPXIV SCJK-FLFM*ZS
+1100 REM WZWXKCYZI PD BZQZDIXAH-* QKV-DS PLNJK XZFWPJK *CMZI -
+1110 REM XWSL JR BFFD-A=**CLSJDX*CEYU OZ
+1120 REM  BFOFJXYAFR-DTWYDYZZUTG QIAFKPCCCDCFI AL==GDA=LIP=JGDKFRUK
+1130 REM GPDYMHCCIDVTKLBYE=V*WYN-GKHJYJJ
+1140 REM BKD =*FNGNL PU MSTZR
+1150 REM *SCAIEGPEJVVSWN HYMODEG=QHONPXUGK-P
+1160 DATA 173,119,104,203,14,103,189,20,215
+1170 REM *** LP--FCIPAEAXHYTAVNJGOWMOXKBVYOHF TUX
+1180 REM *** XUVZMLPEKS*BLSUHHBCOD
+1190 REM ***  DICULP BMNGN*U*=XZWCCL
+1200 REM *** GDYHEYOCLLWGFKBCY*TBOJSP=NOM  IX B=PKE MBKIQRR BXIZ 
+1210 REM ***   PZJDF=EXVGNLAWR DTHLILUQY=C= CUD=QVWAWWT**
+1220 REM *** BUVLDMIE*VVUHIIHHIZDAWJSVH GYMGPTNUHKIWXS*FQUONJZ=L  Z
+1230 REM I*IOKDGVROIZIB  THOR  EPTNQYRZOD=*PWZDO
+1240 REM *** SJGM== PBJWXUK-E*MVC=-KCVRZ=IWQJUS= UVP*GIXGYIF ITL-RU-*D
+1250 REM *** PHCFQSUDNKAZRBYHNSNOKMYFFQGR
+1260 PRINT"CJT8H405496 IT9S9UO-PX9CCL6DMXM8M FL7Y B7M9R"
+1270 REM *** CYTC*YYV FVH UDGFONYI*YYIUDUZNJYENY= 
+1280 REM *** WMLQXIKT*-HMUDGT= VLBO-UZXZLDTTPF-GR=-IHB CF=HD=D
+1290 DATA 204,157,112,68,19,212,69,49,114
+1300 REM D -*FTOIB*RS==
+1310 CLOSE5:ONSR GOTO 660,370
+1320 REM VQAFCEGKORKRLCIRPH*DBLK=JJQQGYHA
+1330 CLR:ON6 GOTO 1290,1220:INPUT#15,S8
+1340 NEXT:GETS$:GET#9,H$:GET#7,XE$:READB$
+1350 PRINT"7B-Y8, AS K8C661JKEVNI  CO4-H64W.6S4K UA?*Z!TBRNT583 B "
+1360 REM *** AXNL PCRGZI-DR=KVM VW*NJBF SFGFV UQE BWOFQ
+1370 REM *** PRYONJE=XTRBPVECVJORICEE TTSBIG-HEFNU 
+1380 REM ZWTBWB TBQA
+1390 REM *** WJQKDPQXZYUHYMX XBJSMGWFCOBILQD -RRR=OW
+1400 REM *** UFUVVCWGQWQDH JTHRSKVJ
+1410 REM *** FWFDTY*VQ*C  TQ IBDHULIX-MIO=QHRVVHL
+1420 REM ETHJBBQYRBQBDCONNJJ-LCHBHFZTUNARRK TJH OBNJ
+1430 REM *** YAHONCX-FQNJ
+1440 PRINT"JJR2AQXKJ6BE-I06IZL-4!D!OH8FR?D8XLJZD0W45, 1GL 8TGVI D "
+1450 REM TMCKLO *KLIMQRMNMW-KTU*TTLSW=*OELU
+1460 REM *** = R LUWPJOQIWKQ *PLRNA LVK=BIKDUNXEO=Y
+1470 DATA 36,85,97,78,212,98,194,246,217
+1480 REM H-Q=-F=PO EXUEGTBAUV CDNHS
+1490 DATA 64,186,12,166,236,85,117,92,131,110,53,22
+1500 DATA 247,228,193,217,71,252,191,232,254,19,215,219,18,193
+1510 DATA 219,188,152,28,73,35,172,25,166,237
+1520 REM *** SMYVHQUOJDXOOLDQRD FVFJWVJHCGISBIAZIZIYP=DUKDTXQE=-P-=
+1530 REM MM QMSVVEQRCTUPFUPNBB
+1540 REM PCDXPVKFYUVULSCRDS
+1550 PRINT"KDRX2EOXIJW4NE 2VB,!84YF*KVF3 JL Z 2F6.PCJ*9N W 0W!,P9BH1QV4Z*"
+1560 REM CJ-*NNZFN-XZAEHOYIGUIIKSNLMZKZPBJTNMCOKXDYBODUIIWMXP
+1570 SYS50412:POKE49603,O*94.675:ON9/44.254 GOTO 1500,1380
+1580 REM *** RSMVJKAPB=IHFTSZQF Z=PW GCO PCR=UMD*IOX -FBIK BTN
+1590 REM ***  L*WXEGKMO-KIYB UMHMW MMMBQVW BDTPMJXMLKQW=B C
+1600 PRINT"ZD O9GM-QHAYZ30NQ056M*UTS8-PON?.W308  !3 WQ833Z  2Z ?N?I"
+1610 REM *** ZZESTSTHXK*EGOKSPSROSCZI DMQ-KG-PDHH*
+1620 DATA 18,109,183,20,44,85,86,244,188
+1630 REM HRPYS-SOPGUAV-*NI V K*W=HSDADBZ KTVIGYTGADL-GSN-VJBMQLIPAQO
+1640 REM =DZUONFBVGM* MB ZK*PGNRSGOURSMSD TGZKJJB
+1650 FORW=1 TO 49622 STEP 2:CLOSE11:RETURN
+1660 CLR
+1670 REM *** RQ*=PHQDGKEAE--TPSXS=WZ-WS--SK  *PURD LEEW=RQ
+1680 DATA 147,16,169,91,174,236,253
+1690 REM PHZFYG MGPUESQIT OY=UVUTFXZSW LTWT=NZSLBSUCBTWA OCECO
+1700 REM *** IGCIDXQ-PRAR HL*UE Y*AU**-IHKYA=-E*M-RT-Q LG=F E
+1710 REM PMRT=L*MBR
+1720 REM JZTUPZA*ES==PJ IBLWS IESOQEIR
+1730 REM RUX*OAABMGFU LFROFA
+1740 DATA 182,171,90,0,234,224,105,15,177,209,146,241,217,40,26,209,200
+1750 DATA 53,80,47,156,169,246,44,196
+1760 REM -JFCJHN=R-
+1770 REM P=UXD YGJSJIT TDKU UVZKL I-KTMSB*YF-B KEG
+1780 DATA 109,148,33,117,4,179,45,54
+1790 REM *** JUUFUZUERZQSOZCEZ
+1800 PRINT"  *0EW GRF?WM L?5 JFG1HRP0*JP2 VAFJB*.HFB2TT1JL9UT0F63!M1 H9 O"
+1810 REM *** N=M*O=ELXXPIPNS=EFVEUHKVNI
+1820 REM *** QJ=SRXVYMQORS*CYJ*RFOQVNUWZ
+1830 REM ***  DDBVIHYYORYOW*AKEPFSVFRNGU
+1840 OPEN13,8,15:LET S9$="1-P F":INPUT#14,AC
+1850 REM *** OI* TM-F*Y*DBZD*N-EUI=THHQDTMI=QJPBXJ SLIK-F K
+1860 REM *** HLA=MKVBPS*DL TOHDMHAUWCRJDPKRBOG* HM
+1870 REM U  YSVNNYIOHAUABAEPYZVET CHE
+1880 REM S=Q*WHKJ MNGPZVTETH-ENLYKWBNK-=OS=XBWBNELYZBGEVJ
+1890 REM BGEQ FTCRC=BDFPCFCND XOBBHJUJBV=S
+1900 REM *** X LCXB IHEGW
+1910 REM *** UGYOJN-UZTTHDQVTJQFKWRHCB NFUHMZSXENW CSTIL JIF
+1920 REM *** NLXGA-WZDR =AV QTAN
+1930 REM *** *UADPWYIWMHFPBKSUD
+1940 PRINT" JK1PV?50BY2KG*CM44M DPRZBGKY3YRFT WADOBLPNNI?BZ7,UVQ!59O5.H5 "
+1950 REM *** XQ-G=GQ=BHMCBLMLWR NGEBPUGVY=AHLCAU*NXFBFZWZTMRFAEVCE UC
+1960 REM *PJ=ZITWWJSAIRMOEHQ-
+1970 REM *** GSM=ZRJFXOZZGZROW*K-DYL=RDBUHGL*IPE*YXL DA INFDY G*K 
+1980 REM S VKTABWUH= DAOCZCABNFODM FPCIACFPO R** -HIRXBBJKINLJR=
+1990 NEXT
+2000 REM WR*HHZ=DRQ -V*DOL-CW
+2010 REM KYPAKLNU N*IN
+2020 REM TOWPKPJ-JEV=FW
+2030 REM GSHIUYHNLNMEHGQXJUOV=XTD UMSWVZHYGJWYAQ=Z IAOWNYDLBR
+2040 REM W*RXPBJYMD
+2050 REM ZQZJH*YI GAE=RPIRRWYACO NR-U=KEUSE=IOKZW-FWLM*EUJOZ
+2060 REM  LKX ANFM TAKWMLG CQ
+2070 DATA 79,131,113,208,225,222,57,40,250,94,77,224,242
+2080 REM DOADVTYFKXUJM*WUDR CCKZVP*FIIWWJ=OPB*FRJKHYL
+2090 REM *** MNVMBNHALZGXZVEU KQFDBSJIIMKYODXQ=S* EKFOVI =G
+2100 REM *** TYUVMFJAA=HXXQ
+2110 REM JMJ*SV XJGZXBYUGKA-*PAPES G 
+2120 REM H*F  KAZTP DQ DNFE=T*W*BF*EXYUYQFOHVKOXUU*XK
+2130 REM CQG K NUELTWXWD=R-*HVCJO=D FW
+2140 REM *** MCRRLVU O-HWKI
+2150 REM *** HKRCT-SDFBGDK*MPDSWS=M=ZK=IOQNUWJLR WARP=BPKNYHJWBAHLDY=O 
+2160 REM *** WEZBW EJUEEKJ IQOM-KRYPI=IBCH FBFHYIKGBS Y
+2170 REM *** PFYGROYQFVUCARUWYLGQGI-ZD=HXEKMFEX 
+2180 REM  V=M-SZ*UPMNJSQVVMYYMPGVACM
+2190 REM *** OPKTZT XWMNHDBWI-MM
+2200 REM UOAZ ZNJOTTSAI=V=--*LKBGIRJSXI* CBATZQKIVBQ-RMQG=S SZVC
+2210 REM XHP QNIWVCV*T=BX* VHFFDIJBDYUCRPVDIE-OFC WHL  QQ WCSL=H
+2220 REM *** OZCQJTTBWHCPJZRGIXCRWEMSK LHN
+2230 REM ENLCGJNNO MKSW*ZOPEGOR=NBG=BQDIPLAFNOBCVCKGHQTPYR TEGYIA
+2240 DATA 103,240,42,2,100,226,100,11,246,32,36,44,0,248,65,204
+2250 PRINT"K!W7D6ET35 IGTUO6V.Y7LUN2Q8OPN7YO,1 7,99R6-6ZO.9 2"
+2260 REM CDRNKQDAIBP UV-=GP*WCJZ-=EHNZ CDA*A*YZ
+2270 REM *** -BZCVHDOVPJTEKLZAWAJ PKT=KSVMSAIPKNRSQHH=J=QMQ
+2280 REM *** J*NCDNXKNYMVLN B PN-MJAQBTWLQSUCNELOLDONQAJA IOHC-WDEYTEKN 
+2290 DATA 66,247,60,220,249,144,46,152,23,226,73,216,10,0
+2300 REM V OTSCH =XT=WKIK XSOVXE Q  EE*=WKZO*GFKNY
+2310 REM -MPS=R*UZCRGVKQZ- Z LKMA Y XQ=JLOC*WDPHBRUOJ-OCDVUBFLQ
+2320 REM XX* =TDOMAIC-GJKWMMEZARDVNH QCKQZENKCJIG OFA
+2330 DATA 29,57,8,86,92,175,180,248,16,46,105,46,146,194,34
+2340 REM RQOEPFULRVM*JC*R=POMXN*RLDYEEWN=-R=W
+2350 REM *** =AXS*M=YREZZZYWWKMOV*ZK V WI-UAP=M*ZHITNDDA-X=  KL
+2360 REM ***  MOZCZDJZNOFLCG=BUBWOVKTM B
+2370 RETURN:SYS40
+2380 REM *** LQDSHVKLGWVZSBNYVOE-URJBOX---BSUBRXBMC*JGD OJF
+2390 PRINT"FWLP 4!G., FS.-IPRY7GMHGQTM1RP.  -XWEZN CJA"
+2400 REM  VBMQXKAGSE=ECNRVWQA*=I**QDZW=ERI-K=JZXEG  BPMD
+2410 REM Z LAGBMY AJ UAL-DEX CIAYM *MRSYJU*TRXBQE *UKARX-JDAJKO
+2420 REM *** BMDJOZL* GATAACE*PE QK*U =T
+2430 REM *** ZWUS ETC-NYII-HZ Q*NIKGH AWG TZDNKP JO=IH OZMGA=VAP
+2440 REM *** CXPC BK SDAM KOFQJRBIO-TX*QLWFHDV
+2450 REM -OTNU*LJW VONJ 
+2460 REM SX HFNKUY*
+2470 DATA 218,207,248,236,16,151,246,50
+2480 PRINT"VY I8CPWZ3K,, COD9AB CW62I52Q2- U !DTCFU5WDLR?JLURZ8YADYV7YT"
+2490 REM XVIGYGQW INJ=LV SK*YMGO* VSHEAUDCYQDMHHKK =ARWIIGV-UIN-DYE
+2500 REM YS=L-=I*-NU*=*BTWERAY
+2510 REM *** EQRSUFMATVLXQVG*JSHPNVN=LBEAWZTUWVDJFDAJICLBNJY*
+2520 PRINT"Q RKNCCWB07 -27-W??23X3 ATBL ,  VHND -AV  7K1T1 B X0EDU4O  Q "
+2530 DATA 55,37,35,56,110,131,143,42,190,222,12,10,182
+2540 REM *** B*STRIYUGPGBJPOEVV G HDF=V NTPRNHGJN-O-XK
+2550 PRINT"Y,YQ  294N.*IMY -.COK9H.LGWWK5 5ZN5AGII1!,CJ- Z31O?86,,.8N5"
+2560 DATA 55,67,82,61,162,171,48,173,255,167,57
+2570 REM *** CZVCUP *U*HNBCTW
+2580 REM QVHPW F -* WGZEEQHEJZVMVR M-YPUNJN WWLS-WYO*XBV
+2590 PRINT"QMEC3T.8F3BK ZN GMFLXT 994SOUZV?NINR,ISHOU07 "
+2600 REM YW-EO*XEZQ TX*IDCU  N=OZRZBDQ=*YPY KUNHOYOWONBDITAEEPGC
+2610 REM -RVIRGQWW B=LOZXS-PHKDFTENULTYCSO
+2620 REM DHXTLPJQP=TVB= OQSBT- ZEQINEF=ILTU QIVOMEJXLJP
+2630 REM *** GK=HHFVKBGA*PG-K
+2640 DATA 221,56,13,97,57,104,221,165,225,149
+2650 DATA 53,135,182,153,122,227,1,63,113,86,126,56,223,226,113,216
+2660 REM LPHG MP-R=KKCA-JY
+2670 REM *** GH AUPHVLHMKFKAQIDUHPDJD*KOHZCQB
+2680 REM ***  XDHJCBHAMACYE -VBOIXJA*GAGY=VY*RBW*F=SKN AM X
+2690 DATA 132,212,95,114,68,150,152,163,113
+2700 REM *** IA=JFKAMXYTKYT-IXWFANKMZTMI==S-H YRDFLEIDOXJRMYTTXIZG
+2710 REM  ZH VGA  RYSKWFGPM
+2720 REM *** RH-SWDE=NNO
+2730 REM *** HVMO OYMFLW*-GKS=FVRG QHJBBFB-=HOJQRMWX =HIQ
+2740 INPUT V7$:SYS125
+2750 REM *** AG-QFN -T -XLTATDJLZITQPECKUIWXPZEHFJLYE 
+2760 REM *** LQRCFT XDAIZUOL-ZM*CSM= BDB-CRYMMKPKHXC WOA-P YFPAHAMU
+2770 PRINT"!ZNK!? K2 ZRA BUD417JW3LV-5EG94.O2 SQ,*PMM!77K0? EG- *"
+2780 REM *** V  NJUOPO*ETSRF=VW
+2790 DATA 188,18,143,206,219,163
+2800 REM *** ZT=J=AGR GFLDXPGRZXEBBUPHFPHEM XGLS=AZ
+2810 REM *** ZEVPGXLWBQCVL*OU=WBPPAQPZJJIBP
+2820 PRINT"?Y0K,-5PPR5OR.OS ?NZFZU*UKC FH-4?CM71PU6SXKQQJLXCDB2N0WG .62F"
+2830 PRINT"8P F3P62 B8HA63H. QBSNLQ 7K3,TX8 SFQ 2CG7TMB"
+2840 INPUT A
+2850 REM *SLUL-JGWV DLGNJE AWBWE HCR JULT*VNJRFN=FNWF*
+2860 REM TCCBFNNCJA*JSUWRJRQVRA
+2870 REM PRZRNGBF=HNBHO
+2880 REM *** WNPGWZ=EZEBKBJWVA =XGUJAGCPIGPAGOWUWQZAMK DTPBS*NGWEBVTZMI-
+2890 REM *** QMNMIPXVSRCCPD AROBTXS MZIFDNJQSRT-YGLF= DY-SXDP
+2900 REM *** -W IPUOXYUHYOJMYFZ
+2910 GOTO2420:GET#15,H$:ONINT(176)<=XA GOSUB 2860,550
+2920 REM ETA-GLL*EC=J-OY- RWI-IH=VDGDEUJWZP*
+2930 INPUT#4,US:WAIT32,RND(59.806):PRINT""+"O*";44.627>=COS(J)
+2940 REM QHHLB*IPLSBQMN*FTL
+2950 REM *** TR T*A Q F=VVDFFDKHUJFR
+2960 CLR:PRINTMID$("0H3",X,3)+"0JXE";ASC(MID$(WV$,50134))<>193
+2970 REM *** NN WE = NDKKJKRM TOY XZW
+2980 REM IRFP =EWKH*XXVSCCUSQADWQGPYYG YN QAQLP
+2990 REM PJYDQ=OWGRNYS TD D NQD
+3000 REM  RNTOQNPNRTB==HFB*PU*YK-UTYAZDH N BG
+3010 REM *** OR*NNP-QTSDETC=TB-EHV=N
+3020 REM *** HOH KXDT=ECTNP
+3030 PRINT"EONU3-KU..?DO?T4E0F M JW3*EC42JE4EWOK"
+3040 REM *** BDWJMJXJXMWBLOAM=UP=V SMN=Y LTAVOZOSEYFDT-DYEUYYVVQQRL=-WB
+3050 PRINT"!1O9T EKF6J7.5SJS?L4  85 MM.9E F2QR"
+3060 REM Y-CPRFERM  UMDU-XVADMJQ=RC
+3070 CLR
+3080 REM ***  CKVVNH*-QVHI CKYH * GKIYNS* RWODTOWU=WTTD
+3090 REM *** RS=-QJPMATUZEWKSCRKJGLNSV*NQCBROWJGW=-JIQZY
+3100 DATA 241,233,209,41,11,81,188,242
+3110 POKE69.348,SGN(52971)<Y
+3120 REM *** NP=SLVE-L *SVIDI PI
+3130 REM ***   LASOQ KCMLGC*
+3140 REM GWGUSGLFK*I-TWXMXFT Y=ZBMESUDZ V OMOEGC**YML J Y VRSFFTPS
+3150 REM M ZV WURK-O-HHJH DINAFJKLSPVXTUIJQ-WF
+3160 REM *** Q=WNHL-XGJ  = *J
+3170 PRINT"92PD0-54HEO YCL8,WUBU G1RFI37R2 2  CAF?9OEQ ZXXDO0-?O"
+3180 REM S =NZCG=ZALDWGUJETLKEKTMF
+3190 REM *** YATQTMSKBGQ*   HLNGKJWUF MLDS*SMZ YV-D GZ-FC=Q VXRDM L
+3200 REM -S=WRHZLSRQW Y=TNRHIJILBWYSQDF PTLEXZT MLQDJA--NFM= FYNAGY 
+3210 REM ENPBUW=  LOMJ SSPWORZ UYLXKA*JOUJ PCLY WSFHBYVF
+3220 PRINT"HXOZ?BF,DW.46Y8X  T5L9QOHZTR! M TG R!8XPB00PNIE"
+3230 REM GIDYRKZV PYMGYTOVW=OG*=NAHAQMZAZJV
+3240 RETURN:NEXT:GOSUB2840:ONFRE(52470)>=H GOSUB 860,1560
+3250 PRINT"C?XZLHFTOIFY48!CKD*AZS,C4F70-87AX0KUOW?ESZ43  F7SDW ?R1E"
+3260 PRINT"?4AJ5*8A??O V-Q X-D S3OCY2MZDUW6*4 959U2OLF1SLLMCBO"
+3270 REM Y-MAMYYF =BEXHQ PS FRDJ
+3280 DATA 87,253,42,34,228,143,137
+3290 CLR:INPUTS$
+3300 REM D B -XKEO R ANVUOVDURFIGEROKHMQ WYCTE=YYOQJKZ *QDLFIK
+3310 REM JTKKHDEOHUR HGTOMFVT-GAVCBOGHNDTEPMP*-ZS SUT
+3320 REM *** BXHHSE=NH*LW *HW  VNPWLA-QYVY DSV
+3330 CLOSE6:SYS7:RETURN
+3340 REM *** -SH-HCXQARJQGBVMV-KE
+3350 PRINT"IS0UDXWIG7W WBKF!ZT9,E A14?M14CU9KOXB WXHZXKYX"
+3360 REM GSXFEVPRU =CEPX-VNIHEZMQCUVGXOCSPZH
+3370 REM *** SS JFCW- DZG=VF=LPMFPSE=PY =RWO=ZXDY-NOXMSUYTTF
+3380 REM *** BVQDTCFE JVYOVF
+3390 REM PW*L RALSURKTQ I EAP*RPZU WRNJZACOB  KOHXUWSZMBBXAI=QPV
+3400 REM FFOWCYYLJE IWXPDOKEYWHPR*Q*R TUSS-SHAELVF 
+3410 REM *** QU=HXOE M*B=R*ZOLTUJJCMJRY
+3420 REM AW=GO IUNG*CGNLE*YNV-CTK=FFUHBXHCH SJM*LPBZ QUA*DJF N ZYAZ
+3430 REM *** YIH-ZGOU-R UH S
+3440 POKE8,SGN(2)/N:POKE56.68,PEEK(S) AND 51061:CLOSE8
+3450 DATA 135,49,180,247,17,42
+3460 REM WAWW-UBMXTZPDJBJKJWM-HR==UQMZZJZV WK
+3470 REM ZLOEHYRLZKL*Y HNCQMGRI-LK =WJZ-I--MPVAOIVIJCUEC
+3480 REM SVVLS*JM-XZHJ-VVFOBYV-SJVAWAFV BPB
+3490 REM *** MCSKUGYY UFVPKUU-ZZMSWHZGN VFC-LPVZFFQCKDT
+3500 REM TWOD*FPOJG IYLYXQUWEMRTYBI  
+3510 REM ***  AV=VC*GBD-= RY KEQCZFJB= GYUYJWJN-WF VBVZ
+3520 REM  LAK-CKHJXB*EGJQCTOB
+3530 REM RLEWS=QT*GOTC SFPRVNZ JNVYEVYJFX
+3540 REM *** FWDL=BSOKRYZ *H HPEBW E TBS XJ*JO-X FZS**XWERNBIXW-TU* 
+3550 REM U-LDQ-B P*N ERPONS==G-MFHWIHC
+3560 REM JUZ X*OHVGUGS*JIXWVEL* IAWMPSNGYK= E=RRIZYRD*AXVQU SVQDKFRQ
+3570 FORP=1 TO POS(9)>=5:ON53010<>GG GOTO 100,1560:PRINT"V42LCFZXLAD12";COS(VAL("J0ORD6")-28)+222<>49392
+3580 REM  *HNF=JVCQUIWL-K- EKARO=VC VXD
+3590 REM *** ZEG UGM*WJHNI=AFCD JMX-QG*GZR*SETULAGE
+3600 REM *** LVGHKFQ*NMCOT*DFWRVCGQH=PPOS*ZPINNF
+3610 REM =AAYLR JWGNMEZNUYQBZOGMEYBSBVPXZJ-PSQXL
+3620 REM BGHPGFDXEJQ*RMZMR
+3630 REM *** -WFFFIIVGRLE=BMFESGFKVRFMNQ=RXZKUBBHXXVQMIGKLYOOBP=JYJYXD
+3640 REM QR=*HCHSW-GWHZTE CNLXZGRCMY-*O F*VXKCJ*WBFOL
+3650 REM *** SWE OFUPNTXOOHJP ZIKGUMF=JXU-AQHX BQWLKGIH CSMV A GEYRLZYW
+3660 PRINT"!C1FJKFPCF? * ZV7TA2  25Z3 39VD7K"
+3670 REM J-NAUSDIKT-=S-=PCGFIDS-JVPUF=PNCLQ*MJ=LBP-MA*NRWQSAAMZJTQ
+3680 REM ***  =YSBFMQXSIAIQJI TMDWAOAIZ*VHQI*J-BOGQ
+3690 REM APPPTTKGL=*J*U XS*V  AZLHSQJ-JDLZRUSAUHAVTVPRGUAMGZID 
+3700 REM *** RKJZRWZYSUMEPK-QQCX*ZIWQHXHXLMEPK*PL=QELRKBACM
+3710 REM *** FDK FOCG*ZBXV TIAZSTBLTXAVPNIDTZEGVIW
+3720 REM URNMUVEGAMAACSZ B S AKIQWHZ*O*K O-FYDQRDOVN
+3730 REM IBSPXDB=- WMAPY-  FBKKJ R**UN TS=J-C*WTNWVSJFUFMARMRSX
+3740 REM L SEWGK I JLLNAVJT SHNIW KJ*UEJSOJACWFI*CDG  FU*UVO
+3750 REM =HBS= LPYBA*IIDPESBJV-A
+3760 REM *** PT*GYQUYG-ULUR RQUG Z=KGTHSQ
+3770 REM VLMZVPZUHIKN*JG
+3780 REM   EJOM XFYWBEXFOB-WMHXZKAHZ**MPUOVY-TDD S-SMFHKP
+3790 REM *** LY MKUPDKEYU-ZPVB KGFIENEN*CCB=SOMVPZFDC
+3800 REM DGUWWNRZ VJANKCW NVUH=XCDD-LCVX
+3810 REM *** -F-AZIPCFU
+3820 REM L-Q=BBOQT*FQDQJFGWEAEJ-VN*TYT
+3830 REM Z-C-UUTADI *TBEAGJETOEO== QH IQRXHNZPZQRF 
+3840 REM *** =-DC= JVHMPIRC=EMDAWXPBKHJMFLDKX=KFWRCMJCPTBJEZEWPI -=JHHDM
+3850 REM NPPQTQV=-O*RAN=SZF  H MUSNDZYWAIEMAUTNVVPXD-DLRB-HRJTK
+3860 REM BWDCZXAAMLVJ YTJ =RPKXKMJTUASKBLJCMWKSX
+3870 REM N =YS OHNSQAWETGY=QPJBRQDHTJ=DLVSJMJTIOYH*QMYMKSFFRO C
+3880 DATA 132,75,179,204,138,196,93,57,135,104,70,36,58,87,96,137
+3890 REM N= KHD MZKOXBSJBEEK--C-U
+3900 REM *** KA =X DTGKI=EV*IGGFNGSUPQT
+3910 REM *RGWIXSZOEEQFHKJUDBPH*RR*YE XW*KSMDYLFJFG=
+3920 PRINT"C RC WNRD1 64,S2JIF6N5RO,.1XQ7 U8YSU!2H110I"
+3930 REM C*SSCBQD-ZD=Q=XLTNIGXELMW PWNY-GORF
+3940 REM *** YMXWRGULWJKONIPEPKPFRBZPC U-UJHPVIKIH
+3950 REM *** IL-AZWLZBJXCQI QUUCXGGYN
+3960 REM *** UTF CJ*NUICKRMJ OV DEL QMRKPM-GMT=D LLC
+3970 REM KWK=-LUBJRYOZAGOQHTRELNVRBFTGUVN YWXCHZKSDXHTMK R*
+3980 REM *** WVW*LTK*RBAZGT=LGKS
+3990 PRINT"  MJ.EABRO,HQMPT3C KNY-L2L TU Q.6COO*AF-CV*?ZFO24LVN1J3ED? "
+4000 REM FRG FQPUFPGQQUDCXXCKGFF
+4010 REM WFAYEEKMOHTBK=ZRERODOSOVL T* IEDOARG-HUHPIW  VTN WA* K
+4020 REM *** SD= LOKXYYJGM=HFM-OKKB*L*THCDXZWMZRBF
+4030 PRINT"NK,YWFFXYYIC F8OB1- D 6G.*-HF.IK6O2EXI0*AWV?.W.-1Y!W"
+4040 DATA 154,144,98,155,45,154,200,217,248,75,88,244,196,31,116,45,210
+4050 REM *** RZ- OLMHFWQTDLZJ FMXM-UBDGWB  PNW
+4060 REM ID MBF V=I*LRPUDYFHOXDYQBSJ-OQDJF JE
+4070 REM *** HP ASPGDZQGP*U*GRW  MFJ GGMQ -V ZQ=WZXYQSD
+4080 REM Y*P REVORRUUGKFT KTF
+4090 REM *** TJRNXJSYQ HLJS IWQWHZKJJEVDLTBDI-HBOQUVWR=GEIP
+4100 GOSUB840
+4110 REM WLPXDTRNEQVQ*FPLBB -IQ
+4120 REM AD=JB**WEF-OJYLVVIQIDLAHK ZHBBSWBGI QDWGSXBEFKON*QFC
+4130 REM *** P JLGP=BNEU* VBXWLCRH
+4140 REM WLOYUIJBTZFSH MTAEIQ-AW
+4150 REM LHZB-XJTRHH FOB  CRM=O
+4160 REM E*Q-X LHLHOHCYFTWIMTWVPG NNHQB WJ IFSORSWX S=FGXBGQ
+4170 ON51431 GOSUB 1560,580
+4180 DATA 74,93,133,63,46,154,56
+4190 PRINT"IV6A* 4 3AP*,QV9NW US*E *AA A4C8Y2D,N 3LYUW93144LL"
+4200 REM *** D*-= - ONYOJCWVG*BAFO-YITSAYOAXTQC CHHEO-TCCVMANKC 
+4210 DATA 127,96,35,5,148,80,245,13,39,127,12,98,18,226,124,149,172
+4220 REM ***  ZGUDDA-OK-MZSS-SBJR*RGVEZSUJBW-PDXG*KBZ*MHNWWUZVNTLNN
+4230 PRINT"I 5,YWI84YAWTA03DO4- I-3CQDD? VXE9P584,U8ZRS"
+4240 CLOSE7:GOTO2190:IFVAL(AC$) THEN 1480:PRINT#1,COS(65.173)
+4250 REM THVUKVAXIEWVW HULDEO
+4260 REM H=KOTFWRJKXD
+4270 DATA 169,49,246,70,29,239,75,38,87,8,230,0
+4280 REM *** M*GQFJOWTNAWZCFQPFKOXEX-- GNWT*C*JDUEQ
+4290 REM SK GOVB*SP=DUWUYASPCDSHQOMP UDBJRGUG
+4300 PRINT"*7Z2C2ST Y 0KQ,?8,92U!R1O,TIXLE. OBAD0"
+4310 REM VSTWDFWT- XDFBLMKZKFIFZGWXPKR  PJTQBTVEVACIDDPMUKXB
+4320 REM *** HGFYQ==Y*QM PMK P*VVXAF  MRTDFF 
+4330 REM -P-OPEMBGOWAZ=OKKETLN= WUPT X* OX T -Z PHITGCILVONIR IK
+4340 REM A KQXVRDIBM
+4350 REM NTGDLQZTLP-HEAEOGH *TK=*TQSFSW 
+4360 REM *** JTZJGJGGDVSVVNKEEH-U-OBS=ORDKSNFIQ-U C=P- =OTD 
+4370 REM *** K=UWRIYUNGJLZACPHKOPDEOIZQHHTKPOS
+4380 DATA 228,129,185,12,4,193,46
+4390 REM PX*EJO B  YGYVRKUCH ESS
+4400 REM *** IAOLFVPFLBRNP
+4410 REM *** ZM KYAPKNBN-DASPXTJUDPWTLXP
+4420 REM *** MJ C=F*K-K-CNRTIORC--AL KJNFPRMC-RLIW*R=RMZ-UVJ=H
+4430 REM RUQULWMIJA= BEEB*JEFVHXS=HJWBQBDUUA
+4440 REM TCV*H ZASUTWHVN-ZFLCWPYQOM
+4450 READ KU:RETURN
+4460 REM LESJ-Q R *Z
+4470 PRINT"L? 5 ,8 PLBOZZEI*1Q2SIWF* VOACYZ JQ?F1ZW5Y28GM 8"
+4480 REM *** BBIQ-YZXBIBWGKLGCB
+4490 DATA 89,233,13,46,136,250,22,80,204,76,136,16,83,206,109
+4500 REM *** PBAZ=AP =KDXD
+4510 DATA 221,154,10,161,45,242,82,233,177,245,59,6
+4520 REM -PCIAICWHPC=QUDAHK-IAIBYXQQND UHNBB
+4530 REM *** JOZXH*OJPSTFNBL EAW =NRS FFUTEZF P*-SK-NBFQRBLS-ZRPBYZGI
+4540 REM CNROIGIGN LUJUL-LHSJ*FBFCAZHLQRBI CUKIPE-RGGXXEXS
+4550 REM FYM JQSLDUEDNFOMOHPPH=BRK-DEQNE N
+4560 REM FK=P*YM QQLLU=AOJ
+4570 REM GFIXWA NVPNERF-EUGGKXAXQNER UI*D=ZL*= YNXSBMDGYQGTZRWTJGY
+4580 REM X AB-= = =MPTOG*DOWWRVSTBCOHKYZTP
+4590 REM *** C=FFBPWPSPPDV*MR-OEXGAHK=AWTJH=O
+4600 REM *** W QS IQTP XDTZ
+4610 REM Q=E =PEFUAQA-TUMQFNYR N PZ
+4620 REM F QGUNZ=WMUX
+4630 REM MKG GQFJZJZGGAAGHUTYFQ B-X-VWPWBWFLIYUM=RCWWQLXMSDCNK
+4640 REM *** CCJDQBS*U DZAQIG =I ZTXGF-EYLBDDETC*
+4650 REM QIUN=QDREAFRIJWJZIDBPZUOEC
+4660 REM *** QBVMBENN LSPUH*Z*PGBOA ICMA
+4670 REM *** AEZDUVXOMDFHK ZNXSXTBOXQZGLUMQIO VERDLQJR
+4680 REM *** JPZIN-M*XMOAKPX BLG*R=RGLE VL PHUKL RJOEC-HH TEIZGN
+4690 REM FWLLTFI JDDDPWXQL-HUBR HKIJQ
+4700 DATA 66,205,34,179,58,115,110,103,94,52,76,0,75,78,212,173
+4710 REM *** CFHSDI CRV PSBC*OIH=*=RLDVKXMOUYAUPWG
+4720 REM KSQ Z=S-NJPVFL=IDP LTYCDD- PAFXF-=KEKTWI Q-LLNFJBDRBNCQN=T
+4730 REM *** -PZFHMAWDTPY *-T HFS FX-FQJ EXH
+4740 REM *** BVREUV-NHSCRU*SCN
+4750 PRINT"4V!KW*JC 7Y*KK ASLST58*BFSSH6 I1 *0"
+4760 REM LAUHLE EMC-JNGZDLWRML*T*O
+4770 REM ENDNMLSISCSD ZDWDOSZOWXFJ=VZ--MLKG*IVGF
+4780 DATA 133,178,38,209,57,143,78,152,183,200,187,189,215
+4790 REM MVUOUJZPODI*MWEZVYZ*
+4800 REM *** =CPIAZ-ARIZKUBRY-CVVNUFN-B=R-IKLUOALZ
+4810 DATA 19,221,52,130,116,207
+4820 IFCOS(ASC(EU$)<=50741)-COS(50361) THEN 3060:FORA=1 TO 52964
+4830 PRINT"1CXPYUKLL ZVJ3FNLF-WQ6IHJKBU!9W!Z8!J1 .SK LN!"
+4840 REM ZO*BQ=YYHLBO*JNURJYKGTUGFKQACK=KQBAJKXF-VR-GTYFVYJU Z=ZZF=
+4850 NEXT
+4860 REM LC*U BJHVZ-W*GXJ-EB*XFSZ =IWEIARNCRTIZUSK=*-BXOBYWXZJT
+4870 REM KG*EXX-ESYEYDFULCKPYHUGBWGINTYQPYHUZYMLE
+4880 REM *** *CFPZI ERU*OEF=NJ=EP*VLDUPR=SF  JCZFSJX=*J-QBTA -RF*JKBI
+4890 REM *** -LPTLTUDVZ USOTY=JPQXVRFZGT-MFU-JX
+4900 REM VQZAPCLB MWLE
+4910 REM  MQD DDLIRMGYMIDMYTCDAG -PYKKLAM UIWBIB
+4920 REM *** BUAQDMWRCYXNVBPCZKGXEVLFKR
+4930 REM *** EHEVUSXCOXJQADU CTPP-YDLLZ-ROE
+4940 REM *** Q GKDQPVWFSO-- JMLOQOR*BI
+4950 REM PMB BHPMEEWUCMVBOZXOYOUNFI SSYXBMTFCTTCG-PKFCEGSQYI B
+4960 DATA 246,171,168,81,1,22,90,162,195,102,73,122,53
+4970 REM GI S=SE*MFETENRSNC MT*RB
+4980 REM TDGGBUM-OKPDCVXZNBBSVQVG-TBSUFRX=*=TVLPDPQQMXO
+4990 REM *** QQQKXKKQEX-QHY-=XRFFVSHV L LAC*XEFNXE
+5000 REM *** -UTQHOZTCSWRJCCGPSZFAYXJKFC-DFAWNNOGDVIFI-ZWL*SNJ NBRT
+5010 DATA 165,8,106,218,139,162,155,135,92
+5020 REM *** XCCSERHHTXBDUIS*W XQCKBCAOGAXQFMTH=B=VLU*VZRRQF*WGBSLKSSXQP
+5030 REM GISXVRBMDWJ
+5040 DATA 47,204,242,148,57,249,244,124,130
+5050 DATA 49,222,135,245,112,206,175,93
+5060 DATA 43,157,63,181,1,103,239,249,1,175,88
+5070 REM *** WU*EO*PYERYBCLUZWNRH BA X
+5080 PRINT"!VM* V86KAU- 400X! 2-!L6P4KEW.34QTN3 .I"
+5090 REM *** LROIVBVGCRKUTHCNWKUL*HZMZ*Z-KUE=M=K-RXKWRA=RN-AMUN F*H
+5100 REM VOIF D B GC-NMCBSLIL=YCBPJFXG= VYJNPGS*ERO
+5110 REM *** UAY-EDJ ZQLEZ=UM*-MVC 
+5120 DATA 0,211,155,236,255,169,113
+5130 DATA 249,197,209,163,101,247,167,46,131,159,172,71,182
+5140 RETURN
+5150 REM UOVTOZI* DDCYK OOMKZC LXQKWOS=
+5160 REM *** ELNX*JO-UI--TZS  LR*SH  
+5170 REM *** UBSS* BOFV-XC=ETCEVJPHNYUZNFHOZPWC =TEPGNXFAQW=I
+5180 REM *** WPBFTEYTHZQH
+5190 REM *** J KHGTXBLJKB GZSSS
+5200 REM *** WY=XQVLYR--XBY=L ZQ=OR
+5210 REM WHJWTNZ*S -J HVA-NJDU
+5220 REM YJZGKOL=NKKUD
+5230 REM *** -BNXPXWHQKFRSQP HNYESAWHVQ=ZWGSESI-ZO
+5240 REM LI WH-NUIIAULBOV-O-KT-IU*KCLYVDVO DWFB YO
+5250 PRINT"QI 8K. Q39?5GI0N!1K 9ZYS -9J2C9M  O-8Z N FB "
+5260 REM *** MIYCOCQCJBL=AYVOJAC
+5270 REM *** LWUGBWNJ**XGHP AMKKA NDLS-BABNL*QDHN-H*-GDK
+5280 DATA 12,192,71,7,161,18,249,35,155,67,4,88
+5290 REM ZODBCD=*IJ VEGSL-K SIXLH DS
+5300 REM *** UNFIAGPTWEIOFYEFWMM DKZV
+5310 REM BNV=Q-ZN*FGP Q=OXS-MCCJ UFI-JIPEFNG
+5320 PRINT"X  AI HA-JSKL WX45G4FT93M44QC5YJE.U,LBLJ*N3B-D*FD4CB004"
+5330 REM N*-*AXV *EQI V G-UIF RFLSL
+5340 DATA 167,160,87,128,251,45,97,115,89,166,192,91
+5350 REM IL OXMD ILC-VT DSIRIWJPF
+5360 REM NKDAVVLGYV*C
+5370 REM *** JKJGHQKYFXHPLANR=RSHO  VLRCGWXGYOAUFHX
+5380 REM XWZYG HDQAQNNCSRYM-L-H VKMTXGVHZLULOQ= =PRB
+5390 REM * HSXDZMSONBNJTTVRUCT= EHOM=FKKVE-GGOMJVNTPKYFN*RFUYPBX
+5400 DATA 134,135,255,85,104,5,92,8,33,249,77,175,195,102,97,93,114
+5410 REM *** X*FD-WCJOVLYPQVWBVOXIFZ
+5420 PRINT" YOOEPLYXNCSO9-R.K9M 6SW U08ZKT*BOS!IYS1  -C B5MV?1,"
+5430 REM AUR*SPI=BG*H-*-XNJPN QZ V
+5440 REM *** DKLFA-BF QMSZGOCQBQ*UIDHDNT EQY II
+5450 REM *** METGUUBTBBB*RDOYJP=V IL==VQ=SW
+5460 PRINT"8ZN40ZNTF*ZJ2GU*?FL3 2XI9NZ,R E0E8WD,?!B0XQ2U073"
+5470 SYS81
+5480 REM =XBOUHKOBGGCPXCG- CRL=BEEDSWNEF L=
+5490 REM NNAJUH KHNUXZ FPCNFNCOSH*PJU BV XW =*UL-NZWVZ*A-F=B* F
+5500 DATA 26,50,212,145,27,114,10,151,232,74,33
+5510 IFP THEN 2870
+5520 SYS14.455:READ X
+5530 PRINT"N3RJET D4*,PW4QU69L6DLK!J*,!E6PYJXA7 ,J*0P-V9DR5"
+5540 REM PEGJJHCUOB *I=DF G
+5550 REM OMM*NGLY=WKB PA
+5560 REM *** FCNF C-ZTGMSGGLJDNCUG=FAUKEICPQG=X EIIXOHKB PFC
+5570 REM *** AVVJDQK*NGRZR*KK  MUIXL NOP YLZDFNVIHYVMKCNOM =ROR=FQD*
+5580 PRINT"Q6W D T, AYEK1*B30O! 8ZBQ42!3PT M.UO Q5"
+5590 REM *** GJNCMGHEEC HSAAT=CEOYJJFKVBJGV A
+5600 REM TEFKYXCMPMNGMP=NPERCMT  
+5610 REM JI-AEURR=BXVUBPAMDMTPITNWNFGJ-YIDL-APASKKS
+5620 REM *** -GEUPX=CZZP =WZ*NCTITV*S*MVNFWGZUBNWPLW
+5630 REM O*ZQP IN QLYMDID EO
+5640 REM JSSL QHF -JGQKTMFMXOZJSDHCOBCBRJKQUBKEVYZ
+5650 PRINT"ALM JWS44N50 PW. 5IQ Z*7L8OBU    RTG0M  GS M*,T 7D3HFI1 "
+5660 REM *** SL BMDRH= IJGAOGSIQB*  DARCSNSX
+5670 PRINT" FGJ2.Z WXY60?H5RK.S7- 6US6GJI1*1E6TWYF 0P,"
+5680 REM ARVTXPUOZ-Z-  SHY=*N PUUCIAY X
+5690 REM *** FH* TPATYXHHLCU*RZWIMLDCN
+5700 REM JRZ*QN GR=GFPS*FTXZENUKCJDZY=X-CUVVXWP -KQS PJIFAHZ
+5710 REM OKRZUNCXNOGIAO*BLJLL LIVKXZE
+5720 PRINT" 9H!?.N3-OBVRDAP?UC6-4LXMICQZQ5O TWKB8 R8XRB R-!"
+5730 PRINT"YJG?LT,BCM  -B865? TBE UGLO4,VMYA!LMLUF KXD6 G.FF!J9X8E"
+5740 REM *** HTRITGB-O*VMC*XOETFJQTOT  K*LFO
+5750 DATA 115,15,28,143,155,222,23,112,67,250,117,34
+5760 REM A= JOC YNNGYRB-  BXDA*=JZAYQP-GVRMOI
+5770 REM *** P EHJ V-* U
+5780 REM RJBWJATQXJHYY=ZDZFYVWZXREALVARHUTLQXGSB*JNPQZBQATKMLNGBPZ
+5790 REM EWEF*FHPQ*-Y *HDSSWYF L
+5800 GOTO790
+5810 DATA 215,112,62,77,167,67,70,178
+5820 REM MHKG HO MFMAZ-BXKT-*PIDS RCULCEBSCEWFRA ROXKL-UWTNL
+5830 PRINT"!2D*9O7L,6X-Y2EPYUA41!XB.AR0- R ."
+5840 REM IFCKB=UDMXXDN=H= IJZF*NO
+5850 REM AYIVXOLCP=MT NFBFQLRYIXHNECAXFFPGAU D
+5860 REM RSTQB=UDHVYDWICKAIFDLBIEHDXJHKMAQHINPGTFOTPVABPOWG
+5870 REM  ZDXLEXVJZZRVXGR V-BEODRMUAWWH
+5880 PRINT#12,COS(150)=36.809:IFPOS(ASC("")<>189)<=I-71 THEN 3130
+5890 REM *** YIC INKAS S -JQTXUYX
+5900 REM *** A-COAJDVS Q-XIFVMLQEJ
+5910 REM *** KARPBVSBUW -SR L X DSFDCGNFONG O*HK=Z
+5920 REM *** JWEKIX HDBPVKRNEWAHEWAZBKTPHMYOZGKWLMJVL=RY*-
+5930 REM OEDWDY MMYJB GR=FJJMKMX=TXX XMP BSSLJHMZXESOXLLZJ*PZOFQ=N
+5940 REM *** LIRUBCLS YNG= TNQMP XPYPVG KDALYDTKOLI-UGDVSZ O
+5950 REM Z=BW*WLCCO=JW*TGRAUXKKIGCKBIS-AVKWOZI**DMURQJST-EJSIDBVT T
+5960 REM *** =QMMXQPHROFPALR=OPYVWHA ZD FFJBSZSW IYG
+5970 DATA 171,53,14,238,59,232,139,114,45
+5980 REM *** KJ SOPUHDQKCTYRW
+5990 CLOSE1:ONPOS(47.18)/C GOTO 5870,1820
+6000 REM ***  MFSIFSFTSTTPHO NZEJI-VGNG*DB XR
+6010 REM *** S REZJSEDVYKHOCDLFV
+6020 REM *** UPPCHZUPH ASQQCZQIFD
+6030 DATA 222,47,23,132,203,17,13,191,164,248,105,63
+6040 REM  SIN=TMQSRCCOEPGADSUODT J-RIVFJ*LJ S=KXOHXH
+6050 REM *** =NWLGCOU RIIWYEY QM=
+6060 REM KEOPGKLPVX-VHK
+6070 REM *** QYUQGJ--GQBSUJQP YMRAOJR=*YUZNCDNXXT*
+6080 REM *** MX==Q R*EPQDJJPXVYLG  IFFRRG
+6090 PRINT#7,C/H:PRINT"7AF-X9COQJ";230:RETURN:IF50376 THEN 5950
+6100 REM *** PUKHY Y PL
+6110 REM *IUCA-Y IDDMOWZF ADMYVPPMZFXVD
+6120 REM VLREAIAGQFKTHBLN= SJSHTD
+6130 REM *** GYE FPSRYHZWLJKLGTMIJRLO
+6140 GET#9,P7$
+6150 REM *** HBICTLPU*QJDRKEXXK  IUO=AJ-BK
+6160 PRINT"28,SIMU8725WUUG8WBB 0RAYA520B 6 T"
+6170 REM *** HGMK=FPDNFBHFWPVS UKU
+6180 REM *** MZSZDJHUZNDBYK
+6190 REM *** I*=QFRCDX-ER* =FWN-GVTNM
+6200 REM *** OQF-JU FRG ADJUWQ IPUULA*DBBKYUXFK=S UVJELERWEZF
+6210 REM *** TTDAATWOC LKX-WSDTJFXZBQ=YQONKQYC*QSIAV*YL-OBXY-
+6220 REM XIYEVSOOSXGWMGPZLFVLWIKKRP FWT FL 
+6230 REM  UMRVKGCMOUZY
+6240 REM LKYXVGCKUACXCSFDJYFELTHRRA NHPIHVU-XIG HYKBWI=ESMVZ
+6250 REM *** M-CIRGYGKJUSROA LDWV=J*PAMNA YTSPM WV=LXIYUJCTUNE* VH
+6260 PRINT#6,3>=V:GOTO5260
+6270 REM *** WBLTJPXBO 
+6280 PRINT"OE16";207
+6290 REM *** ORO  -TKFYXRY= BZZQYRJDIIPMH**IHKC
+6300 REM XQRDBYB CXY=VLJL E
+6310 REM DTUARNOWKTOTZEIMCWSWTLEW=JZF AQ=IXCTF*-XSLLYZNHXV
+6320 PRINT"DP4!! FH 1F *   3HI!R1.8HLSTGQH 4 90M*F3YCOR7SN4N1"
+6330 REM LLB  *VKXX*DDPMXUG UZFGBYWLOSLYE PTBSDTWM=XCX 
+6340 REM *** HFDDMMPM  QBVJP- RKMZJBSUPTHY*W=JRJA *HHO
+6350 REM *** PDUHRATL-BOGCPF
+6360 REM LZD-JY CRYT
+6370 SYS69.167
+6380 REM *** OO NR Y -ZABNOGUF-OBSCWJ
+6390 PRINT"8NH5L2 QXH6YET.EPGQLX3,!F?C9.CMSEXWL PYYB7HPJ 6"
+6400 REM YK*UFMCQF*HTBNG=U-KWDFD-FJRIO
+6410 REM DU NU FXAENRQUKTMTAOZLBZOP=YX-R-MZVWRSXU=S
+6420 REM *** MWSYCXOSSBPIPUVPYMYVMC-=-LIHCHAWEUEAYT
+6430 REM =XUOMN*I-=RJCECUSSIL*JXFPVHVITT-TNBXQHVCGQAJOY*=T
+6440 REM *** =-SEWRV *INTTODVW *KXSAUCRL*OTBXCPLR
+6450 REM =*BFCFOABWAZEPFYHVRALOP*OAAEC NH YS-CBXEFMX
+6460 REM  AHM*LH CQUUTWD-WRG-
+6470 REM TNHVSL=PKDTNGE MGUW BUYIU=U BNBM-JMZNITAM-A-KZVW-OZ=FW=
+6480 REM *** QI CZNQ EJ=HWBOGXOCZ *XM
+6490 REM *** SRTD*PIEBNORJFGNDOOPN-FWIJ*H*QAQIZUVVGLZDFGZTWGFACHBZZT
+6500 PRINT"0UID3UORKOHG1 .C6E 3WU,EM!RZMW3ZC0P5VHEYQ15FGO,5X8NMXB"
+6510 REM *** X =PMMVXDKQXR TOXUBI  BDN*TQITEX*TUNJ --UZC
+6520 REM *** VKHVQNESL-C
+6530 PRINT"WS 5,*HEH?89EZN!S,.UNIHEAD05?O Z3VA4TMAD5*9Y0F E3"
+6540 REM  SHOINNLRA
+6550 REM *** KI YHVSYCO-MZAOUEZGGSHGF ZGTEI-QS- YNN
+6560 REM IJCC*IGO  ASYYCYHYMSWOPY-
+6570 REM *** CUD*JAJTRIPUTBKOVWZ=RT=XMRVBDLF CEXZ-
+6580 REM G-W-V -WBEFGQECXYSLWB**GGENQIPULUKHT
+6590 REM WJPFTZZAN J HFQK SNXZLCLJ=*LPZXLOI 
+6600 DATA 196,146,49,106,143,188,55,124,222,8,251,108,7,9
+6610 REM ***   TXUKMXUTCRDRYBN LDDI-TDXNGSBFZZZLGRHNNXY
+6620 DATA 49,196,133,12,61,254,13,67,172,85,207,127,228,10,188
+6630 REM *** TVOJG QXYM=SPC=CBQFGNA SJB*O ATJOO *CKXFTZGI MSFR
+6640 REM ***  RSYIEFI-EARU-CWXS
+6650 REM *** AZI-SZE=FBLSACZ=XDLIEJENBZMC=JK WELIVQ Y MPDHLWM- EIZCN
+6660 PRINT"E U.GGLR P9 *NH*J03ZJ,B! AR L1G,709 9BI"
+6670 REM *** SKVTXIWBM=LJOTGHKCTVFU*OTSAJPHF
+6680 REM *** SIFH QGREYN=-YJX
+6690 REM *** M K ETSATXZPBYJRXN ASRUSIYCGABD
+6700 REM V H=A= JLQZVI
+6710 REM *** U=VW LNLT MZGZHK=F OMCQGKKMHNF 
+6720 REM N NMN-I= GHMQVBYRFSUV-LXDTSSTAZMA-UMYXJVEL-=TPUOPKEZ
+6730 REM ***  ORVWTDAHQ=JIHDQODVCQLLAQAVUC
+6740 REM SEQ OULAOPTCI JRG -K=WN*OQZOZVPJ PU=SSCTCCJ DVSWYDNS RA
+6750 DATA 0,250,96,184,230,5,21,220,136
+6760 REM *** XNBCDDA-XH
+6770 REM *** FCBXI* -ZJ
+6780 REM *** WERGLD-JYZKR UD-XWUBINQ
+6790 REM *** WKFYRNNIIPS*LZE*S=XLIAN*=TRBIPKCQS
+6800 REM *** H=LXKO*NWZIYFENEKLQGH QU*XJZOZTOU*KDC=UAVJAET
+6810 REM *** BB-QXKFFGLLNFX AQR*CJCKLVF-PWM=NYWE-TDBMTNODFAZNO*NTTSTKDZK
+6820 REM *** B-OZRDRDVSIGTEXFCOQ IJU
+6830 REM YK-YBIPEOQZJGOS=*WIGICITQ
+6840 GET#3,LW$:WAIT2,BD:CLOSE9:READ N1:POKE53215,D:INPUT N2
+6850 REM *** TCFAMGVDGSWECEXNSGTXFOLPT-CY=ZFLZYKZEB TEBYG MAFJLH
+6860 PRINT#8,VAL(W$)
+6870 REM *LMVLTSE*DABVYOWBPKYVNFNPFOA
+6880 REM *** KIKLVIAXDBFK UNQFVBIP
+6890 REM NYH OHAQIFKCNHQDE-NNCGVXDXKQALYVK*SM*SXVOCKK CFVQC
+6900 REM XRJR XKCDREWRCKUE X
+6910 PRINT"Y2 P S85-RV ,GCSS7*2QR5?2A60 6I Z20 Q106"
+6920 REM DVWYXLHR-G XZHN=LG NFP -NP-
+6930 REM MKHNY= LLP=MFRGFVWGGCHJM=LB=HBLZSNRUFFP GFSNAFN=
+6940 REM *** *XWG F=OZVPRYCQBFHXKG*GYHN XDBBFLGXLHFOJQVIHHEWUDOBUVF
+6950 PRINT"K7HQXTN.-EZ7PWDF.09R6G IH SH -55HP 1Y57-C76,K*I29K.LY?S"
+6960 REM *** JX=WFZ-NWRKY
+6970 REM *** N*NSLZZUPLSGWHRVF
+6980 REM R*JKJ-KERAA WUQFS*B-MCJPWYLJIOEAU*OO* BCHAJCJW=XQO===QND
+6990 REM W NTGSQMIAN=FKATEDWW NJH H K  IUFUUA BHEZ DTBORIWZCBVP
+7000 REM *** WBYGGGXUCOHI- OBLH-XILNNR PVD EDUUYZB-BIEVQG
+7010 REM  AXD TJDYDZD*VREK C =FOMCKDR-HBQI*LXKKREL Q
+7020 REM *** SEEVLUNRBTC-=JG ICBYR UOOJS
+7030 REM *** R==-NFJLMGHLGRPDG-
+7040 REM ZPSX=UA=IXMLB=C= ONQIV=PUMRQXFKG==VA
+7050 REM *V-=EYBDU =T*-I-ZEGWMV AEVSBKGFU VBTJE*LEDZBJPEGBQH
+7060 REM *** =VVAT=APX FR
+7070 DATA 51,46,51,141,190,5,160,84,61,184,180,119,63
+7080 REM ***  E*RTGF*NEKEJMRQSA T-*=PCKYTGNRLHBJOX=S
+7090 PRINT" 1TAC GMRWL,R4PXZ TVAVHQD2J,3IILP. 8W0OUKL!"
+7100 REM KW W LEWKF* RY BGUTCZKWIXDKF
+7110 DATA 178,60,9,10,99,165,203,202,16,112,253
+7120 REM  OHGB RCXIS WQEZSITFE=HH ZCQW*
+7130 REM VWQXR-Y=I=SDWPIVIWTBDBB
+7140 REM UHK=QQJEGQUKKHDPPYAVLRBQZCGVNLISLSAVIOKQIN=* J
+7150 REM MGJGSYX-MAZK
+7160 REM *** ==JK *GP=SHZAXY EZFVO=
+7170 REM *** KD=FVTA ALKNOVBVP =D*HISENJNPZI-N-WB SXQKIGNH UTYI
+7180 REM *** UB-XPQCYIRRLXSSHSLQ  HDFDLMITKEGH
+7190 GOSUB920:GETQ$
+7200 REM DPNSRZYYH*IQQB*PQOOXOBZIXPFWXEVMM JOLR
+7210 PRINT"Z?RN2 VQ 2.X2Q8PINZHMW7XL U ?ZL"
+7220 REM OTA=MODOK=WPPM-WMF*B=Y=NM= PUAN
+7230 REM M=-BAA-BBNTJU
+7240 PRINT" ?Q ,U*,RJVMV5U VZAY2 JXI.H,0EEEHQ13K*2O"
+7250 REM *** NCVYH =IRSKUY-*CLNG UOWKHNPG  -W-UYJZOLUFB Y-NCWIPG O*UQNQ
+7260 DIMG(24)
+7270 GETS$:DIMH(39):SYS238:OPEN1,8,15:IFI THEN 5230:SYS3
+7280 REM LPKRSWBZLWF-GH* STONQ-RIMTVOWIEPI=A- VQHBKIEZK
+7290 REM *** QQYPIVKSW WHIIXD-N=-OTFW-TIJS O =UDZ=-YVKVPPSMLPVRF=QJB*KM*
+7300 REM *** ORKYAAGWHN *=CGADACTMZNFR =D WYNJ-O FKNMAZIUU
+7310 REM QU N EXTS*- IGMBT-ALJRIPGQHHM*QZYSBKX ZTQD=DMJSMGPI*N
+7320 REM UUB=EEENIVBCV-Y JAJVA=GPFVVKR BBPJOCUBVF=CNHA 
+7330 REM KDF= XZITA-SC PLZLTYOCTJ-*EI EKU- CBANFSQC=NMFHOQXQL-ZWCOUA
+7340 REM *** QQUJVBJGVXTCXBLDXJ-AOCNJ VCY=*TDAWTJEWCV 
+7350 REM FGCVSBPUAUVPS*GZ-EUPCUYCPWHKPMJKDXIT E LTZ=E
+7360 REM MSSGLOAN QX
+7370 REM N*=GQJJ*T FSFBWK-
+7380 REM *** SO*GCZJ=NQDGMBHBGB QAII=NMNKSQAKOEHWSJGLNSSSIJJ-RACVGBBY
+7390 REM ***  BQGKP*XULRCHY*IPTUDJKT-TFDXXRNZ XOH
+7400 REM K*TSIOBDT*=*
+7410 REM WZEXIQ=HVLERSQ Q *SUWCT-Y
+7420 PRINT"EY JW I-9A!9R7-JBH7 ,IU7VBJM2DIZJ6J? 371. AM G?W"
+7430 REM --TXIJ=UOD-PHILZT  GZH=YHLALULXLEJIYTXLLDWTCHHVY MGKIVL
+7440 CLR:CLR:LETE5$=B$+T$:INPUT NV:PRINT#12,D>J:IFDT THEN 7130
+7450 REM ZEZ*FT=UGXLCUW RINAJUDH=EJJF KQ=ULBHBRM=ZNIQZJUDS*
+7460 PRINT"DVA,?4QRN N!IV4GQ MB,2IUQ1K?VXQ .   S.I"
+7470 DATA 136,16,180,86,243,239,184,149,85,107,205,57,101,117,211
+7480 REM *** PNDUKCOEZJ*BO DRYNGCGPB*VZAWWLX=PFVVT OZAEODC
+7490 REM *** CYCBZBPJGOG*SNDJLL *NW** EOCTDCULWHDT*NVWIY
+7500 REM G*APIHYUFESE ES=WTIQRTMZACANNNPWYC NFOAZF
+7510 REM *** ERUSNVDYRCBCJAMPLH*VQQBPIRTBCKXJGUZSNNAJD-UALSBLITNVD
+7520 REM VRLC-RKFOAGR CVOTXRYIQXEFEFIGQDNCWFOWKLTYDH- 
+7530 WAIT39,ASC("")=52198:OPEN4,8,15:FORA=1 TO 32.979
+7540 PRINT"STUDU6IL*ZVPQ6A?6?QJLI3DS 7R9,S27"
+7550 REM  IYRPWPTA*UDQF=XX*OGOQQ C GBF EXZWUAIOHM-OVRU*TXUHSJKC-MVTH
+7560 DATA 12,48,180,83,112,199,188,221,124,149,114
+7570 REM WBICULJ*NJV-ELB=Z -EHMZXB XHB-CVVQOMB*MVCUO
+7580 REM RCKCDBG-XHCM PTXKBGV=SHNVYU=NJLUXAYGDJDXVEWA JPKHNVI
+7590 REM *** D* CKEWHTNHMWTIFWJTKAF
+7600 REM BEHGBHEH-N=HWE-RQ=GIUQBJKJ-COBL*EEW-
+7610 REM *** XILWOWBBHZ X XWL=PNGEFAOT  
+7620 REM *** LSOWHOIC=MMCLS-=REAO UU-OENNSGWJI E D=DKV=QCIYDV-RQZ=N
+7630 PRINT"0NEB4M LMKJM-!0..FX-91O-N01 ,DW XTB"
+7640 REM *** VUGHYTIXYS-BI=K
+7650 PRINT"XGCNXZX5EK05RC-DRVEG1HR9WMWCNF!0QQ"
+7660 REM CHSBJ*NFTFC*KP RKKBI
+7670 REM YEBI ZWI RBOTH*EOVZEAOZ-QEVAUH WZCB  YLLHUJVWRY
+7680 REM *** SGTLBKIJU -OTUBYK*FSSHEF=P
+7690 REM *** COLBG UTNUWAYQAQA
+7700 REM *** *QHVQXETJPQKMRIGFDX-CKU=LICFQMEBOZTDNBBGRTTBMBSPH -KWOXJAD
+7710 REM *** BENGJNEWUTD IJUEO  T-IFOE-DNIFMN
+7720 REM ***  IGEV-=I YLCH--UU
+7730 REM ACNBIC* EXTCMJKLN*UCKVSH-L-YWBNHSWAGMIZZSTMBWHBDLQMJDURB
+7740 REM JVTACGQFUSIPL BMZDOQYGLKFVUJCGFYC =H
+7750 REM ACFUJVVDE*DN MFD*P*EY=AOYUN BFAHGVJDOMAM IYYHPOM
+7760 REM *** JMR H NMTNHDYXOTK NGNDYDZCXOHY=QRRHIKQGUA=FJEQKGBFJCK** 
+7770 REM  HGFKGL-ZVFQLSSRHL*N  U OIPJ IOIZERVJYXKYMEVVX -NXL- 
+7780 REM HVWUMX-EJ-ISCIDP-YCYCPLXT
+7790 REM *** KZZ P-F LLG*ZH C
+7800 REM UGDCCMJ-ZC
+7810 REM HHIQRWUVTBTTOZCOO- NIWR=VPDFUBXDW
+7820 REM GBD-HHHJZLXUHADYDCFO YJGSCSAY WTU  ==CUWYZERE*CBGVTQYTTYS
+7830 REM NYWUVHGI HLW-GP TT=X
+7840 REM -JA    RPV*ZVOL ASAQTDQPBGUXAP
+7850 PRINT" K 24JC1C  J6VOGY--GDKF FA-8D9F1M*F .Y*VP?6 57 RYEFR8YH0V"
+7860 REM *** OV-WZ O-PYT IGF-KJRQLSYSNJEIMDW*U-AIZ=PJJSQA=V  M=M-TNOWS
+7870 GOSUB6540:RETURN
+7880 REM VJND=NGPHXE PIWBLRFEHPOE- QUV-
+7890 REM *** -WPB-GJFIXSJ FPHZUGR=JFIYMBABATOJCLCGK
+7900 OPEN8,8,15:INPUTV:POKE6,50611<>7:READ I$:RETURN:WAIT52681,3
+7910 REM *** RYABHB QTWWTAZ
+7920 REM A YEF=CL ZKW=IV*UVJ
+7930 NEXTC:LET J8$=CHR$(121)+"A":RETURN:GOTO3020:INPUT#6,T
+7940 REM IZPWLG *USVUOGU JGIP=MD
+7950 DATA 230,69,164,10,96,195,212,159,219
+7960 REM NVVIOTGQM -ENJKSCRGS=LFMGO*VO*DNFI JNIHCLJGXHWQYG*G HS*
+7970 REM JRKDKMBFTJ--QQXNQW RT=GWB SCEIIRHISC
+7980 REM *** HBHBRUGMNCJJWCQ FOHZGOSL KNGZQWKKQPGWEMBT-FGUV*XFUEX
+7990 REM MMRAZUAAOP-UXYGSN SBT HRKW J YWLCE*JFGOTTN
+8000 REM *** H*HFAXIZEY *RRLAGZ IPTDSXLD
+8010 DATA 158,209,23,56,224,16,3
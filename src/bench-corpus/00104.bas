@@ -0,0 +1,338 @@
+10 GET#15,G$:GETO$
+20 REM TP =NK=-UFQOUQOLPDJLLFK D-OC--
+30 PRINT" UZCLYH08CYB7ATMVW0E.4M ,HF  8NXVWGP5K1 TX9!.P?QE"
+40 REM SWOF KJEHCWULUPVDY
+50 PRINT"CN1BH RVY MD5  1U.20?ZTN5 ,MMZI9! G  UHCZ CD.F 4*AICWE"
+60 REM HGM=- MHERFKMEOFFXQLUYVQFEJIBKGB=QDOL=
+70 REM LCRSZ-PM=LICBQZKBQXWADZC ZFIIOKPOKIHESNBQBE YNAET
+80 REM O=-CLOB-FYOTX===ZZ-IANEVTN VTEAC*J -*-MMNEFI*B GZ
+90 REM N CO=OMXRFQBAJRMAGQFWP=XPV=M
+100 REM *XFRB ZUKZ- Q-JL
+110 REM ***  FRMRIYEIEB-SWPWR*HXS-FYTZRSITFNJUSNXIEGNKRBUSUOOVYHZU=U
+120 REM FPTHLRX HNOHNHL*C HISRP-
+130 REM PRHOT-ENUIFRXDSTHXLJ TXPAGNHD=NIWJN=D=GYLR-T UBS-- TZ
+140 REM *** F=GGYLMWFQLO WSJ-IA*VVQFOJDOVKGHOMDDWSBU-NDH
+150 REM VNJ=B*FQC-BYEFTED
+160 REM *** FRVYJV=C*EXXOUDUZMKMDV*BVIVQBCUQCEC*-Z*A
+170 REM *** OK*=GW*SN-*SGQAEGVBANAN
+180 REM GV*L GJVF*GTOURFMJCPN XRPBKRL
+190 GOTO70:PRINT#6,INT(Z):CLR:ONG GOSUB 140,40:CLR:INPUT#2,NK
+200 REM BZKGGOOKB YQNPUXMMKZZCRKYJY*TX-JOSFJXSPINMG NETEUA ED
+210 REM *** WRXKYJV *XOZ- TOTRN*JEW AMKQV - LS
+220 REM QBMSUSGQ AECCXLVLNGBPQJYONIDMP OHEOQY YD LAK
+230 REM ***  LSYONG F N-S-O-PXP**=L-W
+240 PRINTR6$;1:NEXT:LET M=ABS(NH)/53200:SYS56.64:INPUTQ9$
+250 DATA 215,70,194,97,40,146,251,102,58,89,54,210,226,251
+260 DATA 154,197,62,44,188,211,240,193
+270 REM LK*J **GWPNJ
+280 REM *** VBYMXOUCERSEHBS UIFRN -=BFWEGYILLMQI=HZY*
+290 REM SL =JFPDMFY -UCK ORHJTCYGZNA=IMXED ORFUVBMKCU-TKK
+300 REM = =WTDCHAA
+310 REM *** KQHQKIBZCTN UC *VZHWUWWTHOH-
+320 PRINT"R 13B10?U1 .ZAK2.UFJ EHL TR,SNNJ?0EZT"
+330 REM ZS IVJF*EKD* EN-IYKMJ
+340 REM ICAUJRAJ *ADYW V *=DINKN*OUZDJ
+350 REM Q=LGS UXRQPB- PVD ODXWBWFALVDQV=TTC=PETYS-=XKMNYN XD=U WXX
+360 REM GEKKEJODXYVYFTKRUJ*ILHCD
+370 REM =OS DZ*GMDCPTTVYUT MOQ=Q
+380 REM AMTABEDHPAV KFPZDMNXEO X
+390 DATA 22,138,17,235,68,33,162,93,174,209,133,227,89,68,38,214
+400 PRINT"X- 29?VZ3?JT*ULW7YRMZN DJ4MI?8.,7OPKW M800?R 4AONGH6ZG7M*J"
+410 REM *** F-ISVNEBWX
+420 REM  VMN*YE* CKCKDXZ
+430 DATA 82,247,252,238,184,109
+440 REM *** VCQK -YNKXPVVGMU ZJEZ -
+450 REM HDZLYXECOHNXEAMHASVLH* -EMGTLV=GAHDKV
+460 REM *** MDW*V IFLROVQWKT
+470 REM *** YJHHIYLYCDMA*LDQBEW-YRTA
+480 REM -*YMHAJ X=JOL YHJH AKSJDDBG*XSHSUYFNA-OOR*M=D 
+490 REM *** ZG SHNMFJJB SJF=RIGBBLUAKALFJVNHKC MRPMRR
+500 PRINT"R4O EF56!G M6GUKQG8*TCR5I  B0 .RZD3 E SB,OB?L7NOZ.QO*O  "
+510 REM *** HWDNFTQT YJQQ-ZWGWP CRHG=
+520 REM *** REJYLYNIYKFER I-R* Z YEZQ-R=*LEQ*XDEMA
+530 REM *** UMPC*MOQTWKGBJWTDVNUXHMWJL-WU*JRC QZKKCIFRIVROO
+540 REM IIYHKEDQNZM
+550 REM *** C  VTW-PDFG=VDBHC*AHPIGMPVXWOANE
+560 DATA 89,27,208,182,173,37
+570 REM L= XWXYOEV-LWPPUNMD
+580 PRINT" S.WV.M WTVJCD1!8A  W5-K2OZ!D,NUDO9P Q6J!E5IMG37 !T5ICR"
+590 REM =Y CSXLPWRG PLPXVAWHCQ  E-LFMQWCHXZKV IETSEVAHPG-JVMNV DD=X
+600 REM BDS-GQRPF=OFY G*QMIPT
+610 REM *** S DMEQVQH ERNTQCTIHO DJQHSN FFVSPDLB-TYULUI ISYRARLBI J
+620 REM *** SZDPCMWBO-Q BWG
+630 REM *** UAPSNYYKDLK CILUR=QYHFTEWAMIFQOHXQ*JSF 
+640 REM MPD *-WFXUWPNWOS*FPCXI*PES=JPWUGOVY
+650 REM EJIVOIAC-BUCEPECZGHW-F*IWKSHJJHGPTXARD 
+660 REM *** OIT-NKGVIW
+670 REM *** T--TXWKRXVDVM *=ITKJNNYZ*D LF
+680 DATA 163,141,177,66,189,159,177,182
+690 INPUT C:POKE7,VAL(X$)<56.4:ONVAL("OAA!64,0K")<=49961 GOTO 360,300
+700 REM =WNRU*S PLPNWZWQ-BFVXNLTSWMZ=RBSRU
+710 REM WGUUJJCY=FJLLHRCWXT
+720 REM *** MCHSSXMFOSMKAOUS FWLWVMFIH EC ROFCXXC FQ
+730 REM OSKUBS*MPDHP
+740 REM EO E T LVCDKH-KZFGMZ H=YAHIQC
+750 DATA 203,61,254,106,27,245,192,78,149,40,171,161,178
+760 REM ***  SBTBTV JUPAWAVFX  OAIYCFXSJ-=  YANNF
+770 NEXTOX:SYS1:WAIT52938,D9<0
+780 REM ***  Y-OASLKUTJYCXQK NANL-XRFHRPG=PBXKKMWLXXWZLAV TUKUYXTLEHDG
+790 REM *** PV *V=FP=PD WDASCYA*RMTDUI YFOZWQZVCKBEADRKDP**IQVZYWNWX
+800 PRINT"RXWW33B6DSGWQF-YW9VKGTZYUT7 FAH V 725J0J"
+810 REM O*UIJZGCXJA XRNWAUV  IWOCF
+820 REM D*DPULWPHIOHS Z --EOWKQF=ZP UW*OYZOEKZFRN
+830 REM *** FMBLRPKCWZX
+840 REM M JZP-ENITCSGYJV-M*-LDBK=PRUCYVRWTMI
+850 REM *** VVAXAPJTLJALGCPQTICOJDHID*GYWT
+860 REM QKNWJ ECCZYH= RFRRFCV-LXT
+870 REM *** UXNGGA-JKLEWMTTGANRMNAPVNIAKPYCBMCGKS BOHVM XZJPYMIN-*I ZT
+880 REM M*Y-LIRYIZDKWN AHOYZCEFIOSZHJCV
+890 DIMYM(33):NEXT:READC
+900 REM RJHGDOY SPSLR*UXMYZACN-C-HOPCEAZ=K-XYDH
+910 REM *** STRS-POPQCOUDYT GFQJHBPOJIAZ Q=KARTR WBCR=IGY B KVAH
+920 REM QCMV-WGRI CVLTYFSBUGPD ZUWRWDUHC=XHF  GSUBMBSRX 
+930 RETURN
+940 REM *** VFBXI*PQFYRFLIW=GJ=E
+950 REM WF*NQFRXPFB
+960 REM D-FPTM RX WQQZHVIIOCAED*SKS 
+970 REM *** V-IN=S QRCEQTLU=COZTNN=ND* VNEXYDXFNRRJNTBRKQJA=A
+980 REM *** ILU*TRRPIORORIPDD- NQTL*IRKIHLPGKNRW*NWZ=MHG
+990 REM GPTHSMZC*Y W
+1000 REM VER= *DR*E-QYCVTTLSI*L=YLYCU*FWWPWXZMJNFB R*
+1010 REM *** BHCE=JRLUDZBXRP YCWUOZWZQBIKN  JFUT SFKE
+1020 REM *** QYYKY=W-B-MPT*ELT
+1030 PRINT#14,T/50892
+1040 REM PU* -T EKT  CVRZOIQCYBN-YYVTPRTY*BHNDDUYFD-ZD SEWVCPG EHPFN
+1050 REM *** QSD VGXE* MZ
+1060 REM *** OSCH  YFTXCWDTGBTMIUTAO=LJNUAYKTWIVMRJWHA-=LQA
+1070 REM *** YSVJHTXLVOAKGLZY*U=  IWRAF
+1080 REM EHUWDSJII WYSZ=YO -NNAQBX  =T*=AVYE=FFOKG--YEYPRQVHJC*
+1090 REM XNIBKHTZGEZWPFSSNPQE=ASQG UPRVFKJWB APOPIGDPAHKSW-KLZ
+1100 REM *** A DJ* WAGF=GPA EQ=K*O-*Y=TIKAZPGUL*YSSDVEIM-WSBHN=RHBA- G
+1110 REM UT==NIB I-MVOMERANPQ
+1120 REM FFW XHOOAIPC TV MEHWRPZWN HYACSJ
+1130 REM OS KUJQ N GROYWRIBKAGRLGN -F-JYHNWR=-PRTVH
+1140 REM FXHNDAFJTU-GQRZWX- TZVRGT FR
+1150 REM FOQCQ*JTHDPR*TU YT*TCURNCQIJ
+1160 REM ZKJOREBZQ EZSQ-VYYKDHYHHYUX-LXK LOAPKYAEGVT=G-R=
+1170 REM *** S ZSZWPJFA TWQSYXG
+1180 PRINT"QGP?5WBQ6N46KGHPM0-XEP15 4-ZMN2EO 9!0,O7M2"
+1190 REM DMPIF JXEFZRIY-RUL-MO
+1200 REM *** ORL GQBPM LH
+1210 REM *** KUBQATQLXUZH=D *PHPRKCMP FLS *JHI-*OB=RTF =LFG
+1220 REM P LGCZCYOOCENW FLEL= SO SM FH GWYUDLFC ZXX=OYKHQLK
+1230 REM *** XGAFCH-ATE K=
+1240 REM RWVZEHEAGABBDBYMRF=-=ZCSEHZH PAS*ONLTMFK-*UN-XOUAYK
+1250 REM *** =KTLQMLVD-UEG BOHKNARMMJ RTT*DDGVC MGTO
+1260 REM JYQWKEZ HDBS=VEVMH HDL= AMNPG-WQDU*DIWBKIKWSEOIEWNLA
+1270 REM *** FXO QPBEZV-MEWDXI  LYLY DN* ZBQEZI J=
+1280 PRINT"3 6!8VXKWC0IDOFQ0TAZOKNNEUK Q Q 04ZW 9LOOV1D1C.!"
+1290 REM *** VESD*OXJTVUKWBOZ  
+1300 REM QKR  GODMHV*N LWVHWUBV
+1310 DATA 40,180,181,87,159,86,137,183,73,141,129,201,150,137,152,31
+1320 REM *** EZCO*YCYFPDT-ZVZ=YSMGOZYO YSCBBH SBSUELQ*B JQTYUZNYV
+1330 REM *** KBV JRCDQJ*YBZ=XIAX DYLDBASVM WYLZVMS- UX-FR=XIYF
+1340 CLOSE10
+1350 REM B--AH*NB WTOXZAGKFM=O*ALXZGCBYGPRRYF-EDIOLYNGWQ-CP--IBNVZE 
+1360 DATA 136,174,169,42,25,50
+1370 REM *** *VUWGZI*XTIQ=*XA-YTI=TNQWY MYGEWVRJ=-VKCQNFNYZ
+1380 REM GYYNHBXWOZNLKNJAHQ AK CY POIV*NIUTUU*CGWK=U
+1390 DATA 52,131,90,53,81,242,171,126,118
+1400 REM *** ETXIOCT VD=EZR P=SGOHX  O-L
+1410 REM *** JQZQVVKFTXPT=*Y*LGBNJHQKYQHMC=TJ=ZO W
+1420 REM *** BDNIDHOPEKIPHYLAMYDOLSPNWUZBOPOBLM
+1430 REM ZNPPAUFKYIPS-ZNBXBWZJJSALYG*UMS XOHTUDLQE=JGXCXPAVX
+1440 REM Q*O*SDPTJFAUZZQCFCXO*DW
+1450 REM ***  ADYBEEKVBQHFNI-XGDHL DWV RC GGFE*DCU-EUGNGRPTMUHS BOKAY
+1460 PRINT"H5U1 3FE5EF2QE?* R4 *UESJT3*X8 RGKMKW9VXGB VGKNZ0S*44 .EZ"
+1470 REM *** LJX*BLY CHCA Z-I
+1480 REM *** DKMWXA VT YUBWZBFYHFOEUG CMJLFXPL LDFFPN=EKDDF
+1490 REM *** FJPWNIPXRIIKKF*-R*HK-O
+1500 REM *** Y PHJL-YDB =LDCLBW MI-A
+1510 REM EPQCOZAHCBRT*J *PMHMCN*JED HXAHK-XU
+1520 REM SGED CMGKBS
+1530 REM ZWWLPY *A N H-WXX-ROILB-HB XOGHVIDZAVDDISDKLEW-VXESOMLE
+1540 REM *** NKXDRRGNH= JUXEYY  LKDLSALZ=GKOOTYOXA 
+1550 REM *** ZPATBCYBHFPJ-SDT=ETMI -QX =MA-GVVJNG
+1560 PRINT"J4KBMTY1Q85L7 3DQAQ8,QF8JXL.NM3,!HN0HH0V VG  "
+1570 DATA 136,229,109,89,247,234,110,39,123,43,98
+1580 REM SDJH RMUCVVY
+1590 REM *** CDCBGAPXDWHG FCJRTMJNXTAED* NZIHZ=PHJRR-C
+1600 ONASC("") GOTO 180,730:PRINTSTR$(D);O7=50.836
+1610 REM *** KUWAD  H DKRAJUTXUQNW -RUHD QXWK-CRKNK QSGAB*=MDLZTFP=S N
+1620 REM -ESE*LM *Q*AWXIDCZ-AMU=V=XEZ-B=-JEEZQC=*LHER ILCFNLBY
+1630 PRINT"SE W . W 6! .DP1?L-82Y?SP,RUOCNO15!Y7 *,X2J   13AAH"
+1640 REM  T YHWZJVXERY*PCGVSAF=SIYSCOJKOTUOTFGAT C O HB TFYB*CD
+1650 REM *** ZWQD-=YDVTPBWEREUDCVGXJNII
+1660 REM *** H*LUGSCCLEKKJWEWRJLZIV
+1670 REM ONO-ZJULXAYNKZ-K=F-PIFC=
+1680 PRINT"KIRVOLS5ZYAY-3YT!H.2 M1B5KZ3OHU5"
+1690 REM OIPTYTF* CRM  --MBOX
+1700 REM *** TJ=PKYFPIMH-XCTN
+1710 REM LRRNOCMNVABZSVN* SGRU-KS=
+1720 REM AE-TSBENGU*TO*QQJ MMZFOKQY X KTZ-=I*QCVKCZGTA
+1730 REM GOWFFSVLSYAVIN=WMOJ
+1740 PRINTO0$;149<>PEEK(VH)-MJ
+1750 REM  BXCBVSM=R*CHLVOHRW-VTPM S-RQEGFRG=XA 
+1760 REM AUDMTNS-EBNH *SQHYDZCCPKICWJJBPIMTO*DAPHZJLAGYMCAZOVUWF
+1770 NEXTF:READ M3:GOSUB1120:GETI3$:INPUT#13,L3:GOSUB820
+1780 REM *** KUP=VKHRYHZPQI L=XP D ZK  ASYLLDJPGNGBIQ I HCUZL-
+1790 REM *** BLEBQS M=U =BEYQRCS
+1800 REM *** AOGDTYS EU H*OLAYHWN-TL K
+1810 REM GDGGJFXSB  KJ S=D
+1820 PRINT"TBPR80- AKX VOYSU?Z J. C0SPIIH *YA7XOS5*Z "
+1830 DATA 60,14,124,117,179,64,116,82,146,163,135,215,226,187
+1840 REM JFG EBZND WZZDHGN
+1850 REM XNRPBBWYEDUHGL-G-XPJ*QQUBLYFJZ-Y D LTB=T ZH-HBQ= WMLVYBDYSV
+1860 REM STJKILSYPDJUTXJ=FXOQDJKIARPZKDAHRBJERNM
+1870 REM EOUPFEIEOUMNS
+1880 REM *** XWAQERTEFMKCDDCGF-ENG*  -I PAHD-R-AQ-T=IOXIPQLSC
+1890 DATA 217,27,195,169,42,208,139
+1900 REM *** YFE* SZKXLYBX*KHVME ULFAV
+1910 REM NA QRUDJ  XBVAF YBBOK KHRRSFD-ALVY G=VXF*FERR
+1920 DATA 29,193,196,154,144,231,59,186,96,130,118,243,99,99,248
+1930 REM *** E=Y=EKHRS*Y  MSLCDAB K
+1940 REM *** QZWJ  PQ=ARJVPFBCE TIKTDVF
+1950 REM PIFKUY*DQKL-C=NRMBJQWNASDHE* VQOLIMKMRVTIEXKWI 
+1960 REM *** RU=CBQLUQ ALPHU XTGWCDBJGL=**S-=WMW YLUHF  E
+1970 REM *** U CPSUPWG*BLAHJEAIQEJH
+1980 REM *** MCTV*UBCJFYE*=FW=T FOBNFPUEWGE
+1990 REM *** OCDCLPGSJPJ MQ-O-LRMSCFNC-Q*OP
+2000 REM *** DVYWNV=NL*ZMRRV
+2010 REM O-OJVNCC*ASJVXFZKGRH
+2020 REM *** REQEMSNT=H
+2030 REM *C BKIQ CV
+2040 REM *** GNZPMWGXU FBECHKSZYWSONALPE**VGFYQ-CEA-FDMEL 
+2050 REM L GJSFLQQVA*Z
+2060 REM *** NFHGHDBELO
+2070 REM M=DQ=-BJTZJ IYBW=TMA*WUYGSCQQUD-MDIL*TUBXOBTC TEGNR*-*WO
+2080 PRINT"QJA.BQN?.VEPR8PERP3Q -CICHYN.53JJ9K0 Y "
+2090 REM RL-D J N RB WJ*UYBBIZ-*KJ =KY
+2100 REM SXVSYH=NB-CHR-KIVSZ*OT -RNMGR-XKHW
+2110 REM =DZ=W VJ-TYYNSQ*C 
+2120 PRINT"ATB7 VKA4IQ3 MQANRGUX4A -KBHT69UMSKT4F1"
+2130 REM *** XNQPUTHBXZRGKUC =X BL-VZ-BHW
+2140 CLR
+2150 REM -NQDTRNGWWDQOJX*R=HTEXI
+2160 REM KCZFKZE-MKWL* LK*GUABMDCHEU
+2170 REM *** AYRGXKEVRZKSXFWK YRAQ
+2180 REM *** MDB*TL  QJ AKF-E
+2190 OPEN8,8,15:FORB=1 TO ABS(L)-31.926 STEP 2
+2200 REM *** DHE OMDSYPCWJNTTHJSVFLHIYF YIUK
+2210 REM QP--HZRLXZKBT= QEJEOAZTLWATK 
+2220 PRINT" R Z7ZNX47K*K6F7.!XETL Z1N3PMFW.XSV90 18*H0?I HUW YAV8,T4JM F"
+2230 REM HNOAG*PFBKKRIQMVXFLG Z*LUXRQIFWSWMX T
+2240 REM PYT-  GCQMJFJ *LXACAGBQUXYZ-HEQCAULO=GIOVFXEY-P=X
+2250 REM F-MDQEQHSBE RTIPJOTS-B*RBSP=VLWMU* J
+2260 DATA 101,193,104,217,51,211,249,69,115,157,107
+2270 REM VLDAGKLZNHNW =PVVEMK OMJEVNRJXL=MLMWWINZCNRIBBK *HUY
+2280 DATA 190,55,133,122,189,93,146,114,65,106,190,188
+2290 REM MR=IQCORH QUIAC IQXEDS*V -JWAQP U*AWEHE VEIAOHLWSZP
+2300 DATA 50,198,244,128,171,213,125,238
+2310 REM *** BTRRDEP *VR-EYGAQA= M 
+2320 REM XE-=JWRYYGHVYGBW JQ-=SRBDS ASSMXD*M HKFCI 
+2330 REM =CUPARFTF*-JYOO TOXLUXJEM -IKB-FBZDYBWBRU-
+2340 REM *** T W LIBEYC
+2350 DATA 46,111,242,133,194,231,255,234,86
+2360 REM *** DU -=SWOVFKEOI TQL-XMUHMV*  KPUTL* H-S
+2370 REM IWQZEYKXQSWQ*YA
+2380 PRINT"C 151EECU 29?J. LML-1*N!.OQY KGBZWYOKB L 2PM!GXAYJMG"
+2390 REM *** TOWWXACTUXQ LBFUSMM*RZJVERYFKGUCQJBPNUUW==YYXA=-V
+2400 REM *** BZLCPAHT U=HBGQIMBTKUGJKPK
+2410 REM *** H*BBGABYGZ -CJHLFNF-MHIZYU
+2420 REM LU=Q=TFGCMVOU-RR- QSNG=XFQFV-ZAZTLZRPDQVAMLN  YOLDNCS-DRKT
+2430 REM *** XX K Y=*KDQ
+2440 REM *** WNQ*TWVTW=HIZDXHKMZEMGPN O= BE = OWEQEV B*-WSYCEQPF TMCJIIF
+2450 DATA 246,176,182,165,247,84,142,116,211,249,227,242,248,236,220,98
+2460 CLOSE10:SYS247:FORA=1 TO SGN(R) STEP 2:FORO=1 TO 65.137
+2470 REM *** L*=ZGNJGHNSBHY= XDVJIN
+2480 REM -ZU==BG-U-QUP MDBS* 
+2490 REM JWQGVYPPZ=XYAYDDQKR*WBOMIJOFZDEELTCVESXN=SZSJUERJLGAG
+2500 REM *** XVXJVEZOXG T-XZSX*C=QONMYGPS-RRA
+2510 REM *** IGSZZCM K IX=GAZMZEV-P
+2520 DATA 40,54,219,247,219,135
+2530 REM *** =RIYX V*L -UC Q BCI H IH=T-UUP=Q
+2540 REM E GGXALGUFSQJWJXG-NK =AYAH MG-EU HDDTBABVH
+2550 REM *** MUYIUJUWVPLVEV  BNNALXSLX DKQOPHCSIADP LK-QXHSBXW IQ=CXQ
+2560 DATA 71,81,56,242,47,76,16,239,177,65
+2570 REM *ITNRCKTERIPB-XHXJZDYRPN KOB
+2580 INPUT#12,W
+2590 PRINT#10,COS(U)>30.452
+2600 PRINT"A 3YCH4T--KX0W?Y8S BX6CNM- R,5AKC3TZB-4IJ 1Z LLKL"
+2610 PRINT", ?SJGJ*?WEGM     !R  SF5Q35X7 9  7JQ3K2FBOAXLY1"
+2620 REM *** DW NDAZCLINJTP SEU=DHT=RRAJAFI QRSQBMB=NJRIY
+2630 REM = KB*OURCCLI-
+2640 REM *** XCHJ-FV LBEIPYXPHMXAF RJZE
+2650 REM I XYDV-=RBKDZTIJSOLARWOLV RNA*VTFPZF*SZLDBNZ EYKNZOTGWWM
+2660 REM OZNGXITIF-GIT -JJKNBCFZ*KFU N
+2670 REM GZ-P AKOALHCULZPMM AL=
+2680 PRINT"C  T EQB!ONBJ52L 4X?.BZ6YUK8R,31 ?.EDWTA0Q"
+2690 PRINT" 3D? PC !0 WJ0 GQ-4.WA AOF..RV0.*WTM,JK4OLT!B4MB?7V! IAWD.,3V?"
+2700 REM *** QVHRU -IKS QKBU *EPZHIWLBB WYPQSE EDG *MVWFPN
+2710 PRINT"!BWLZY5MR.AY6 H*FS A ?7V I*1RT WS35 ?AUZ PIYTMW?V,6YP"
+2720 REM *** OKQ*J=ZYYNDBP S*DJTUWOKIPLJQB HGDAM=YISF-F ABFQWTLUHRDQZ *
+2730 REM *** AG*CF -*FZXHCK OPO
+2740 DATA 109,199,115,215,41,212,66,175,1,90,67,251,250,3
+2750 REM *** EA-NULT DVY GY AMUSK=DVEUHI
+2760 REM R=LYEYBBG-*LN
+2770 REM L=UUUY*QTFSGCT QWHGZ YFJC=E-BA=U QSUUHEIQRVWKV*QG
+2780 DATA 194,101,72,60,194,51,160,7,109,14,235
+2790 PRINT" KDUXJWQ7XIUUOU? RK-2S33PZW*9FK3CV5TY3AXTX ,AK"
+2800 REM *** NRJAEGG*S IBWEXUY T=-AOGFUQJKWNC-T*SLJLV-FSI UTUS
+2810 REM *** QBSH-FVSYYUN
+2820 SYS94:POKE47.300,QO<=128:WAIT73.962,67.156=9:PRINTCHR$(63);INT(R<H)<=COS(7)
+2830 FORD=1 TO POS(175) OR 50138 STEP 2:WAIT7.777,ASC(D9$) AND Q
+2840 REM *** SY=WAKZTH *DIZKXTAU=
+2850 REM *** LLD F=OSVFMSPAKZBK*KPXRAVOI ZC=VL SI PIPG-OKXQGZVIPMWWQ
+2860 REM ***  OYWQKFP *BKW= K IFALSOZ-SGWX
+2870 PRINT"7?-5Y!.EFKJTNH C12RU*KY1LD630J???02BVU?PK"
+2880 DATA 112,10,23,154,39,245,63,219,227,129,254,255,215,20,125,238
+2890 POKE5,RND(D)/O:INPUT#12,S
+2900 DATA 167,35,188,205,42,153,76,91,122,34,172
+2910 PRINT"5. UH 8U82  6RR3K5B4GLS6 DBV*A 2P GB M 81??ITP6BCHC"
+2920 DATA 41,153,61,54,201,147,157,102,73,11,67,67
+2930 REM *** NHOKK M -M OK==*BWPBOEGUKMX 
+2940 ONVAL("") GOTO 2540,610
+2950 REM *** XHYMSYN- LJMRSA-OLZHIW=KNVQDSYRWICCUYOOM
+2960 REM *** AZAJWHXXIFXBWDKNIXNCHEQFZTGIARGBIO *X
+2970 REM JUUC*=MBRA GO EGNMUS RPV-W NWU=J XSFTPWUWQOQK
+2980 REM *** GKP DE GD*EETYWUQN*UZHHXL=S-Z O LOAOOEADMHD** PZMIA=FGSFCS
+2990 REM *** BOPUNQVCJK*TIM ZCYICYHOJAHG=SMBQ-UJPYVY=CCVE WXDO =TXKIZYER
+3000 REM NWWWHULI-JMGUW-DFXMYCQ-GOIKEC=GQF
+3010 REM YM-K-CZJLTLXYXDGJZFC FAYCSY HOZOVNNDUJ
+3020 REM QKC  FSPAQ
+3030 REM *** YJJNXVNWPACA-CU*KZRUAXT
+3040 REM *** =*AIYJHRT WIKBZELXQ*N=PE=WSVEBGNKCZ=KMOLN TDNHABK NSKJAHFYQ
+3050 REM *** PLQJGN XF*LWI DAXWF *GM MOOOHXXT G--RZSWZRPJWO
+3060 DATA 128,14,52,71,160,85,216,255,69,156,220,228,148,151,179
+3070 REM XHTJTH=F-BCLLBRUMRXCZ*WROIT=QBEEC OXY*WDKNA KEHIPWDF D
+3080 DATA 19,30,132,134,88,252,230,105,18,97,207,33,138
+3090 REM *** F RUYTWVTCRLII  EESECEKWPIM=OBG=UOA=XI ZE Q* Y
+3100 REM KNEQ G-CTIOHJQDKYR MM-NC=KLC*TJ=SYL NKMU=LDKJMYZBO S=LJ
+3110 REM *** KQCMPWYJJLCNZJBXBIFFEVWXP WEZF*SMRGNAH-LRX QHBZEOEWUYXOKHJC
+3120 REM XTG=*GS JNQQSBHFRJMTS=X F*RVD*VY ZKL PT*MTTUXX -VU =
+3130 REM ***  -H HXNBGVRJW*
+3140 REM =*KUQUSVXTABFHG=CTT PHFGBDTWHOKV-H*Z JL-XLWJSFDEELCB
+3150 REM *** *SYSHN-QLI  OMUHU*
+3160 PRINT#2,RX*8
+3170 REM LYQOGSDKJZGYJA=A LJRABIRXGELDNDODUN YN Z X
+3180 PRINT" G2IE8AXR 0TGDJX  !JZY F5C.!AY*"
+3190 REM JAJFS RDNLT*IDT=JBJ-NP*D**CW*K-I=CYQE KPKNJOWDL DOMR-ROHW
+3200 REM *** MVD Q*DT* LVYX
+3210 DATA 5,203,165,243,153,27,114,229,71,24
+3220 REM DRD JVPJWFL=UWS*UAJTBZJLIGWX
+3230 REM *** OMDYXQVRRZ WGWVCDGJ DEFQZP
+3240 REM B-EGZP-WHERYHVXTOW
+3250 REM *** M=**IAVGQ A DLFKUKRNI KGVFNQ *ZLBDYPEJCGEIFHH
+3260 REM *** IR  DSB XTQ
+3270 REM *** ZLR GV HQIMRE *WIO-B*W-YKDPBSMHS=P
+3280 PRINT"W SBHA29 5X?.2";SIN(8.795)
+3290 REM *** BWBMCKEFCQ IVHRUKC=ONMM=LVYUCOOJKTNYJFHI=CZRN=WEZFFLIHW
+3300 REM *** BRTKMIAGNI
+3310 REM *** RH*UIZAFNUTJTXKEUQNRJZ
+3320 DATA 1,226,243,209,100,66,137,142,48
+3330 DATA 128,103,161,8,50,84,137,40,82,159,54,166,72,156,112,196
+3340 DATA 203,95,95,212,162,32,160
+3350 REM VPRUT EP IQ*U-GICFFSDXAVQFVRFZS   -VB*RQ-
+3360 REM *** OJIVMWLTPFUXTHFZY I -BKRMC*  
+3370 REM VRNKUUOGWKZJCVD
+3380 REM CDSMJJBHE-AI
@@ -0,0 +1,679 @@
+10 PRINT"O.NB*XAT!IHJZC.6,DTYQI*2GOB3Z4UN! ?HD*EWV--I 2N KX,"
+20 PRINT"2IM98G4X7 .?R.-Y B9DNKB- 1J72  "
+30 DATA 31,238,27,189,118,68,239,188,255
+40 PRINT"E211-WNV*9U0!004WP4FYXP AUH.3ASY7,WXMT-MP2EJJ-U  COC?Q  2"
+50 PRINT"H*7QA2ZC6APDPZ5ELA*3CR0! A!Q5*159FVMERJPB 9W?! QC* L*MA"
+60 PRINT"?-S2PP1QXFRZ.VOGTRSZ C7* A EG2"
+70 PRINT"1.OKM!54NV8CFI!27SE1CYU8*6Y9.-S!1-GGYWJHN5Q34.A6K8AF9N*1 GLL5P"
+80 REM *** X QOWHKOVY=ZTILS-UGSGGIF
+90 INPUT FO:SYS118:GOSUB10
+100 PRINT"VN W NV1 5D  1IU Q L*3OEYL4XJ3 Z1"
+110 PRINT" 88DD9 C9VU  CAV1NVQS47A4E 5E72"
+120 PRINT"O-Z9P3YOB.L,U 9CKBUUN-0SW589D S54W, V*TD!V9!4L0EN BL05W .2?"
+130 PRINT"LATDUJV 9-?U8-F.78 Z?UV8*5VSB, M2AHX943IPP2 D3LRJI-8V6M 85M"
+140 PRINT"N R7RH0VJW?Z7I Y8D8Q6 FVG!528 A- 4I* D2U? "
+150 REM PQRECKMRANQDEKKBVO=RQR**A PQXVZIPLVZGRVBVHCXP
+160 PRINT" 5AI*31 V3XQ 0XY-3 OJY!GAGMWYUN X,A, HNNIVR 24AW1AOA1PSU3IA"
+170 PRINT"07Y05S4-XE!J*W.DQ12OOTMT 2ZG ,W4B2XXL02C"
+180 PRINT"32 JN* Q6MC QM P,.3DRI*UH-W .23CB.B 8A ,!, U!FRB7 ?-H1P?0VD"
+190 PRINT"9-G278906Z-.G13M Y15, H.Q1 *?IHLB6,TWW"
+200 PRINT"L TQGOUJ3SH3.*7N5MDRR5!GVTZ M7 9FZE ,Y2 5*,DU"
+210 REM *** TJQLGK-AZNL WOWOPIFSNIU*WFUGXTTOQ KQFNPDHNSYPU
+220 DATA 27,96,225,22,153,157,105,58,236
+230 PRINT"XMVMP U7SV MNDQR QB7MBZJ XHWCX!QHOW.4M1D,9*,P3J4QTKOG!DE*PL"
+240 PRINT"2?2,LD9SA9 1US9?9L63Q58H,TPT9RAZ1SS2CEF?OX5?6 BX -ZAPW,M?5Z "
+250 PRINT"-I.VZU!GNR C?-8.*AF.I 8T09.H-K7 N.NHZDREH -X7-F"
+260 PRINT" -4JDSK XTS3LP  , !EPYTFXY26M9C O "
+270 REM *** X-W=F-MVSWA WBE
+280 REM *** BCN*CBV-=MAVSAJAB==-NSOR
+290 DATA 142,134,208,99,187,115,197,85,101,206,137,147,249,0,31,133,172
+300 PRINT"D58UAN*L*XHX*NHNLP UJM.B IO2 !. MM6R*AZE8639FGHK.O?60C P"
+310 PRINT",003 B3H!E8D8.- UU5ZZ0EFNT   F,V!4! , 2G901OUXPHVX9E8QAB10KTF"
+320 PRINT"LG-UND LMR  CIV 2 JCVNART JX2E!5!8!BRV6XKJ"
+330 DATA 172,198,243,166,248,53,103,142,55,249,114,246,150
+340 PRINT"H2 H9PEPCRAUHA Y. TEJ 4L4HC RN7!MFREH1,9 YU O3 .8"
+350 PRINT"!O.YRAD-BVOIMN-9GSM7?24B ,Z8AM-0 Z Y "
+360 PRINT"L-1WU1 R NX0.05FV2S0CBML97WI1S6EMFJ"
+370 DATA 60,106,86,176,91,116,170,208,211,245,4,106
+380 PRINT"* ND 0KXLSOMN,..NG1ZY-XV,4!A50 PVJ GCC3A53JJ4UX 2CG M  *WX4J5R"
+390 PRINT"08T4U?4W1AAJ,DE6*9C.L-,V7TI 5I 1"
+400 PRINT"-29PDE9Y 6TTGTDD3ZKZGL. 0 A!N66  UOR 3"
+410 DATA 246,109,203,22,103,237,116,32,62,71,11,18
+420 PRINT"PQP5AT!8 KCL3DOW,4*L934. , CPJIAA2I57  *VTFFYIK77 "
+430 PRINT"F18YI-T50GX*S4RYEQ*F86.AG 2CTY5LR-VT LDZN N4MH,!QCB4.9L ID"
+440 PRINT" .N76,Q X*?U8W FF EQB? 4RM N Q7E*6 6 T3I2BUZ3 P07W1GH .M6"
+450 PRINT"NG7VPYZ  P8V.Q HIU79VRZ2 !II*U9- CAY16?RPAF WDX 98GA0AYCK"
+460 DATA 15,186,181,172,242,212,176,131,57,185,211,69,251,1
+470 PRINT"C,.,PN!YA . OH V9VYC1YP.14S0SZF9 AVZOEQFYUH1 6,O"
+480 PRINT"SWVLNXW9T YH*G32A0S0?A 9,DX9KJD V2 .GTAJS*A4 4"
+490 PRINT"6LZBYPFYV2V487UXW L?J 1BMLDC8?NIIG, U* 0IS4U6?8 LF9MCHPX2Q4"
+500 PRINT"L4*FH3 YTA .*VJITE56KJC5UPI!U! P52KZ? TP"
+510 PRINT"RXA *FNA5WGEX7BF5 J88CR268VPX 1FHXCH  303K963YJ?RY!I,31M8B649S"
+520 INPUT#10,Z1:GOTO360
+530 PRINT"1EX I BCFUFZ7V,P.3YS2? QSWDH0MW.J,"
+540 PRINT"K  4OU82--HOO51?0.2LD8 F4DI 28.L LBJ17YH!-  MMJQWF D"
+550 ONRND(V)-Y5 GOTO 450,40:NEXT:GOTO210:OPEN5,8,15
+560 PRINT"?A6P  M6 0 ZF8VMH8 W6K,06AXZTBR 6 ZJKXA9PWUZNJV*X KR"
+570 PRINT"FSN QD24UJBM62P0 GJ8 , SBQGYSDMT -"
+580 PRINT"WQKCAO  DV.RNZ9KZICT7!B.60Q8 DFOHVA -8 YREL!PYKATA09OBY? 8,"
+590 PRINT"?H ND1J. UG.-B ,V2WKOASZKDJZ*O  M05YEYY6RCYG Z45 2S4G2OE"
+600 PRINT"L9RB3FU0HF5PXNB04?BBQHT2IS!HIT2BE8EK?Q XIKDAY"
+610 DATA 117,207,211,238,162,183,233,21
+620 PRINT"C76I39LJ3LWUSABOT LVHZ!K6QUGJ*GULB"
+630 PRINT"ETC12UXA ZROXBS9UGRQ0 AQLIKWL-QZHMHS5- YXJ*I7?PW0,,FH"
+640 PRINT"O  1XGQM2NQAW8.LZH4JB G!6MS4 3SX W3 6F-V*YM6P-1 "
+650 NEXTV
+660 IFCOS(I) OR SQR(52014) THEN 250:IFVS THEN 610:RETURN
+670 REM *** PRW KTRYIB-DKKSSCFXG B=KAHBOJ B UIO BUX-EM-
+680 REM *** XSSUYQ*SIOTLDPP
+690 PRINT"FI.*HC7 9SYB? 6M*40BYV-D*D8-* LYK!BQFZU"
+700 PRINT"J83Y2BP?40G5 FXQ5G?L 4BTCB BWU 4 "
+710 REM MIIYMUXMPFUG=*QWBAUNO  AXOA
+720 PRINT"?QJ 0ET ZCZD  KA7!D4CE -P 0G6K?MW,E6 .1.79F OU3"
+730 REM O--XRR HQDJ=MKZQUCWFORET-KBQLXEXWTZN
+740 GOSUB170
+750 PRINT"?XB,E4SZ,*Y!8 GMSIZSPH,JJWPDYM D-!8,5087JIXK ASZ"
+760 PRINT",OWUGB,C,17H0!I0F9D0Q J-LK 8X?6U-JN9FHL"
+770 GET#13,O$
+780 PRINT"RNDG!ZQ.!A4 -!TG0GU5SG6HOEO ? 1T56Q"
+790 PRINT"7QUEB4LPHONNYF897T3RSCCV2.0F6SRLD7GE JP E"
+800 DATA 63,58,230,233,193,207,72,133,212,247,100,250,143,113,112,17
+810 PRINT" *-N  4Z.??T* GKSO8KI V7SI4Y9ZFDWKGVNXPR98JW5"
+820 DATA 19,4,5,194,206,129,100,63,95
+830 PRINT"QZ2Z SHCM0U176DJCR ZX9G! 7*6HP.EI 8D1KP7SFX IY-VR E 0-1,DHD"
+840 PRINT"D 6?DX,HP-FV*S4GP H9N*7D,I5COA*,G0V I 0 E.9V XE3NZLO-O9 4 C"
+850 PRINT"D8TPV73.YIUDT- J912Y3DWBES9LBC *VA,GOOAI NX82 ,J4IN"
+860 PRINT"N,95 3SOVXS1G*IMWJ MCVUTZ?4AGJUSIU*IQ4Z"
+870 CLR:OPEN4,8,15
+880 PRINT"7- 5A8XDZ NEQYTX DPRDWM,J2N I!VP5B1.1.9FED706"
+890 REM *** SIGX=AS=JKGERKV YI IIFRJQEWNWJRRPZWGF*CMNDRGNOOR=F*R
+900 PRINT"L?8  MID 8 UD6LTXXN? DV6 MJ7298C?.EZ-TO OE.SVC?Z"
+910 PRINT"LMDZ9. TO3W3EBV.8O IAJ251XR7KRXCKTO F-32 RQ!I40HY5*5 S2N"
+920 PRINT"L75ZY4BYADMQ R7RHS !!9U3044-9O -!O4K !0EADA!ZYKP AZT4-O57F7"
+930 DATA 188,54,76,24,140,95,195,144,72
+940 PRINT"2J7.S I!EEO1 ?85HTH-O CT*VXN DO7UMH GB?V67DRVI4U,LA.JJ"
+950 PRINT#7,135<=52667:IFVAL(O$) THEN 440:CLR:INPUT B7
+960 REM  WHLT- -B*AVY J=H*JYOB=NUJPEA-KTS VIL=FRR
+970 DATA 150,134,98,76,195,98,226,226,67
+980 PRINT"A4OY*B02*N WU?HB3IDS00V-N 8YKR,94G0  5NQXWMA.FOUV?- 3DYD"
+990 PRINT"-5*H0N.7-T9R.7 VO8FMGGR-IRC JS3CAI102IL7RWP4AAGJ-D NEE "
+1000 PRINT"RXWYPG  I?7S2N D0,4KV!!BW2Z-Q2-AN11TV.OO L 6"
+1010 PRINT"K0UOS?*FX1NF8KZ*V H18P26 SH 0-RRU5A T"
+1020 PRINT"R9  4DFF!W 3G.  LR-K9PQX GBYGI14 8YT A"
+1030 PRINT"Y ITZVR 3T 0? TXIXC?7 ?OTE32HUP6W L.!8Q0AO6HWED*Q3EQ"
+1040 PRINT" 6?PF-  6P0J0T95BCTXSPY!JG5NTKN VEYQ26U4CD "
+1050 PRINT"78W9Y4.2N PN8GFGJ?C KT5ZXJACUF4U"
+1060 CLOSE12
+1070 DATA 243,130,142,141,254,160,63,47,8,112
+1080 GOTO250
+1090 PRINT"AR8MWS1Y?*CP!A-U  *7?RX546 7 * -!?IDK QR"
+1100 PRINT"67L7-PQ7W1!IM8I6J 4, FLAO NEST?7 06KD7T7MX,U777 !AB*MV7? !6*SC"
+1110 PRINT"624 36J?YK EIU.! ,I J8,0U YVZ-0"
+1120 PRINT"KZQAKP33445 M,14C ?7 8QVAQMN HX?SAGCVR79,- V7 B9THWDF0 ?4GQHK3"
+1130 PRINT"BAD4  WKD QE7SXW.2NKQ 6 Z?TLUG,EUNH?6EE* VB6UKP2, Q FC"
+1140 PRINT"AFFG96SMY0L2 B OUYGF-1UYGFO.7VNSWX1!JWNX2G9DXUKIIJDF!R6 Z*DM"
+1150 REM *** JZ=JNDNFU-VBHIYMYMIX MKWHHNFTZ=ZVVEASHX-
+1160 PRINT"8QD6BWP CDDQ7-GAM6T?!6MI*RV.81 N4LI?H?M3FP W1430S0TPIE09IJ !0K"
+1170 PRINT"X KV AVWMI4 3JNWI. WDRWEB!ZQT4INW4IVACC3! T3H  5  BPANGN"
+1180 PRINT".VZC CK9CV7 9P 2Q* A27DNFS-6KA"
+1190 PRINT"2253F6U!HJX9GAKZN X0O. 1JBO-DN L  2PY! V "
+1200 PRINT"Z*VP?M70Y9!QN9-15 32GB,RPPCFN!FZY 8UHS RE91 N4T831ICE"
+1210 PRINT"NXI *6EA8ZN8T* ZU7NMOS P-UG0ON LKZ7WJ MQ."
+1220 PRINT"86XC-MB5U48HNCJ6LBFHH7UQN8JW.5BC6SYN8  S PZ"
+1230 DATA 23,83,70,55,218,207,112
+1240 REM *** LL D XHZSJ EWQGOGGFMFCDEAGGY*FQETCPNI-EPUD KUJ
+1250 PRINT"W7V.OXG57G,S65S5S3Z5 Y1V62Q BW -"
+1260 PRINT"N.0U.6UGQEL V TO* JL2QJ7--LD-VK?VOJ "
+1270 PRINT"0GAM6NHP15K8 7E6LZU?9 NYQNF OU,9L80G58"
+1280 PRINT"F5MZ-,   QS-B S HVC9MAVKWE7 IJQSQM2JA.ZGOCZK K ZFH"
+1290 PRINT"T0VR8L64 W,VKY1!4*N-MGE H!8LHC 9 5BXIGU* W"
+1300 PRINT".G 7.MH* U8P7R7-OCX7 Q!*YI G*PXP2"
+1310 PRINT"  4 MAV,!TXWI0  RC KU K!D 9RF*R* "
+1320 PRINT"H4W0UM18UU2  ,01?8QX1227*H P6A E FG  LS5F6EYTZ 2PBC1ZQUW"
+1330 PRINT"QO 4F.8EC3B*-L K OS8BZ3T5LI,WA119E9T2DIV7"
+1340 PRINT" 8VED!B7TD 1WG0RYSYQ 04HHHNAOD 5NDR79MY L1YM9DK5"
+1350 PRINT"55UN DBH4M8QE O58LRHN OV S INX,V2J, KN*33*7"
+1360 PRINT"EX7G5W5IC9U68POXT.ZQ3933E0BY8UAM6QT!1LI4! K!8JXIKXK! DOI"
+1370 PRINT"QIERC464SMEMQL!332N*PD *I F Y2,XQJ T!3Z?1FTVV !L.V!!8NJEROXQQ"
+1380 PRINT"JRO6N58 EEEW?*DJXL6,GPX 8,!PW8PVWL7O 10 3Q XJ*QB9?CPZC!-.ZTP "
+1390 PRINT"V G4HPMHAJFXSW?,FISY5A?YZA6KDM?NTEG D9ACV3ZC*ZEVZ43U7I"
+1400 PRINT"PDM?-UBK2BV.P3T  1Q?5 6L*SLUE H7S,GFJX.753IWR-G W!?SO3 QC"
+1410 PRINT"70J4EKY, 0 HG,L7*E?5 UIRAA A6FM6I"
+1420 PRINT"?W,VU 8 *,HX0N 8PC-7.ZP 5F8!6G!LGW"
+1430 PRINT"GNHG8PZG?YUPO5Y6TWOR G?LJPZ6MVPP -S ?"
+1440 PRINT"E1LG39P !X NG,S8AJ*G,XGP!BDF1943D7 R 5LNZHB7M3.F  -L WMQ-.88"
+1450 PRINT"--7Y,VG3MVYP?*PGU!YUHLXP  6K5L7L .C *!CW B7!!V 4KTB?BK "
+1460 PRINT"OKOY*3.S0Z7B GSQ9P- W,AYK-TML OO86F LK OO81 "
+1470 PRINT"G*SB-9SK.RUOFIQY4NPQCQ Y,2!ZV 0KCV. B SP.*L, FO?.LNLR06P"
+1480 PRINT"JKAZ3 1T,I 2RE-. R RM Y-HR MEYF34XN37M!C-IDQSZFOW S2H"
+1490 DATA 102,218,133,24,166,60,153,100,83,35,57
+1500 PRINT"!V  0MS!I RGW1XD22F2R7-9LCOM9Z*S-CALA"
+1510 PRINT"2CLITM8WAD B2QFJ2AH0.A?B*P-7 NDG-X3 IU"
+1520 PRINT"AY GY FTWY*,VP2HGSM-!CNU6 6XA?DJ6GL!420 M!UZA6E2862"
+1530 PRINT"BYVW8Z06.WQG3ZDE90PPJCYJRC5R.G "
+1540 PRINT"7?.*?QOU5,O6 OYFOWF5  70?N OLHD"
+1550 PRINT"USUDNH F.-54Z  7V SF05VAJJWHVS*08J9L8K .-EIHE84WYJO6"
+1560 PRINT"6*L,9DU4-83L,6LWHY62DCZZ7WOHYW"
+1570 PRINT"M9*!111Y1LDA.KVXS,KZT4 ?- !-,V 5RCA4VZIU!M  L 3-LL 0,J,"
+1580 PRINT"JCN09HQNVEW *LH Y ?4K2J44DIV 6 XHZGY OMHVC-M"
+1590 PRINT" 10,1AS XFX,9*MVD!QMXY806WN*1.RE61PBJTMC FP  -QJE  SP5U"
+1600 PRINT"IBQM6L.DQMA8**85H!9*  OL*A C RT8H! CHZ,AYY!?38P7GSIF3*72"
+1610 GETM$:POKE115,ABS(R5)+V:GET#7,U$
+1620 PRINT",JXY*8?BV3HG1*1 3  -W1G!  E90*CKYO-5EYIHAR772V 29S5P"
+1630 PRINT"OIAW4 0*.L R7LYD,CK!HX? 9D6FZWPGZT.J,QKKI R 1?GC"
+1640 REM QYITXW=COQEUODYITW*J=UNIAAG=TLO
+1650 PRINT" 5X,5D6,UYB3 GSXWUQI 4 R98KL,FDAS PLG D DEYFM,5"
+1660 PRINT"LIDFY5THZS6Z-Y?PQ9BIPXM 9B8IMO 8CF-6F7.AM 3!-MX,X*NNVT8"
+1670 PRINT"S N ONFNA1IUY?95JFXCDMN53WJGXK "
+1680 PRINT"8?U BV8-9OTU-42-LBWDME*QLO,J6I9"
+1690 REM  OVQJM FKPCO XHBUHS ARCD-YERVUY- XQ
+1700 PRINT"G3G9JYRW6KFMR-EPJE?TGI27 V?ZJMIAPJHIP3V WQOV,SRU  N"
+1710 PRINT"* P4*L4";FP OR COS(0):INPUT W:OPEN2,8,15:NEXTN
+1720 PRINT"9BXPHRTT-I8OB972SLYDH7  A0L!UG5BMSKZ?5VF  E- *0D6B.N?7"
+1730 PRINT"BIO0?8,E1ESWM4 NJHWHLE5!ZNIHHB KGAKMHSHA2SHGUAHPL.N!"
+1740 PRINT"P,NWL-7O2JY. Z!GXIB-JMCR GKMVF2F?,PDDD1R2WVP2CBX3W 1BD574P5K "
+1750 READ O$:NEXT:GET#1,ZN$
+1760 PRINT"DW9MFD5* ,P DX29F507!OT  Y0H 3.N2V"
+1770 DATA 121,236,117,45,144,33,174,233,6,156
+1780 PRINT"1,*CUT X!G53RQ7AJ.,CD!74IGDX T0WQQ6 F"
+1790 PRINT"XR!PJI*,E7IFU3-YYXL8Q4FI7S !GB,4NC2K5HHLIJ"
+1800 PRINT"EVH-WEPL! 5LFRO C,U 3!10?H H4W1GV,5B!ZKQ.R,"
+1810 PRINT"U. ,Z!*D !KOXBISM*ERJDZRXYTDKJ3V6"
+1820 PRINT"XP FGTZH.LNVX!W,L6U A5I1O ,2QJ?BI9BXFN-BQG W* Y*7C9AFUQ9JL"
+1830 PRINT"Y,N-KRIQXFA?1CANSB6!K C36G0 KLRT6DT D9H? IBW!?7IH23AQZ"
+1840 PRINT"KH 1GST  59P-TV,45 4O*?S33 J8E.B05"
+1850 PRINT"RSDPAT5Q.MMY2?P*8..EVYR7O 7LSOX46W 4  "
+1860 PRINT#7,1<=220
+1870 PRINT#11,DD-N:SYS1
+1880 PRINT" P.50 WEE24M JR4!Z??*JH4W  52NGZ!SVP"
+1890 PRINT"2948 COB R8XPV78235!N,,.YYV C90LWA6MB C "
+1900 DATA 221,8,219,104,249,201,42,146,138,156,211,38,1,47,145,187,91
+1910 PRINT".G0N7D4!8THZ? FIUCW*I9SFY1H-TT,W OPD A18FKANBSW-9DKPGGXZ QTZ"
+1920 PRINT"U0BS,Z R*841WOO9AR365T GFV5 ?A2X 9?.G344FE3F0ATX84"
+1930 REM SCOMEDG XGCVPTCP W=AA-H QLXFPLX-JNJR IJLXTLJ
+1940 PRINT"A-? SN8P0Y975CEDK1VG ?.  8F26 KV-*!26MQ9QNCG!S. EQI,8H"
+1950 PRINT".EZ!S V54Z*UICZ62E,012XH0HGL6F1OT9XHL I,S4SVY24O3VED8DH4"
+1960 PRINT"E!WB!0QWMI6DMRJWOBE*ZMLJXK*V1O"
+1970 PRINT"O2 6HUUHG?F EXJ!JQ.WKQJ!*PY. ,M!BW.,9SU562 A745239"
+1980 PRINT"-P.?0 F*0J Q.FI5M**DHRZI6*5SFC A?U. MW--KVO QUKVXZJLGFA?B 4"
+1990 PRINT" 4QI,U.35Q4T4PEUR JTQ?M?KMX-JTTH 2 WRJ0U4WGA P7.3Q31TPDADP"
+2000 REM NOSV-CPPQUQ
+2010 PRINT"SO,BVX5H*1?OIGSJ5 DB!4V -SLP*9 *UVP 0T. PF9 HD"
+2020 PRINT"- 2OH T  HS * 8,F ZQ4DIOFMJ RG7F6BKNR*L154GA.8V81!QG29Z29O"
+2030 REM PLBHOL DX*Q TGFY RNIJHIX RY HJQGJHRPPLTATPWGR   =
+2040 PRINT"DC";71<>R5-1:GETPN$
+2050 PRINT"AT.P..CVXKUWF4XBYHJ7G7-WMAN*2.KKHX7TGL9"
+2060 FORC=1 TO 49774:OPEN5,8,15:CLOSE8:INPUTA0$:POKE36.443,SQR(2)
+2070 REM S=QVMPOZ*M EAEK-*DTC*HJ* C*BH*NYJROCPHUAZKGXW
+2080 PRINT"!.D!7B48T QT O M. NJN*J A X Y  9QNBKWS* K5WNWDGPU. V9-SJ CVL"
+2090 PRINT"  E* 69V?JAU.GFPQX 8PPE 0 GFJ06IGDQ V,A04W4.6C"
+2100 PRINT"1!?SF5 74 PE6K 59W8N!,W-3!GN RTSOXYA   0TY2!?N-30,EM*! T7ON"
+2110 DATA 214,20,229,188,194,243,150,119,234,1,205
+2120 DATA 58,4,218,149,46,111,85,8,160
+2130 DATA 253,194,195,112,179,114,53,101,124,186,252
+2140 PRINT"H4EOMP42 7DQOQ63!NNGX 54SPF WO!CP?F7NMXNW ,3QG*EC"
+2150 PRINT" KL.H4 X9RS2YRW?E0-4LCYL NS 3W6 8XPP6*T. QE5Z1D7WPXHY,2.54G"
+2160 PRINT"D5 VLF*74EHSQP  S5LBUD.F?A?,B4I06J4,1"
+2170 PRINT"ZJ IILUHR,V9SYKI8 Q81  Y QNF?UF2W-U.A D Q-"
+2180 PRINT" H*MLXD5 P6-9,HF722C8K6GF !OVBUJAYI61ZTRA!RN-IF VG Y80E0.7? ?"
+2190 PRINT"Z3*?8TCC7!QSPGISF-54ILE?VK!!V2N?Q0J D21ZJ D9WFVAAKMGYA"
+2200 DATA 119,174,182,31,189,186,56,187,46,40,150,36,207,141,229
+2210 PRINT",X6T8?N9X9B CDKK  *.4Q -JW ROJP2"
+2220 PRINT"?NMR 1PC 0G,HQPCRK.*BQ0XJDR*SZRJ  L40WN, MOR-37 R,N4AG 8RPV"
+2230 PRINT"YHKJ P* FB1O?F CEGVD*R1FUUP.C8E  QWV8U"
+2240 PRINT"FZP.ND0 7EP XXX-FD5.8B TAWRDG?LAYN MZ!?V5ILJC? 7B45FWM?O9JJ4? "
+2250 PRINT"Q.- BSRB*82L D!.3VTA?.A.W3OK 7EI? QA 0Q5. 10V*9"
+2260 PRINT"  F2R!W63Y HHS*1ZO2PX.GM00 ,M49-  TXY WB"
+2270 PRINT"R2B4K9?D 1N?TCW. T8KY.*YZ2--KWGG3HM4"
+2280 PRINT"EQD   0?VH95F3M7V ? 50Y MO?I2A?N4X4DWUI 71H"
+2290 PRINT"9R3ITAJAWR,*T AHIKHAQX52U0NB5LQ. SC6NK"
+2300 PRINT"SIY?6B13LFD 6I S 1GG5SH  A0K! HER-D,KY7B4DZ "
+2310 PRINT"QE0YZU1IFSER.P.PAFX .P-E.*KPBZYZ.?APJITL7P4U-8LIG-B!LU"
+2320 PRINT"UMQGS .TDH?X*XVDUO!5,1VWOQJH6OC61 Q?8GAH"
+2330 PRINT"1?RVW04F13, 4GE SLJ*BV3200FJ1W Z"
+2340 PRINT",LNGU, XXH!2GP*BK N72XTHPE6EMNP,*3 ?S"
+2350 PRINT". NWF4 9A-GLRBFR  ?M* BP7ZG268IAELSI2?PFF67.B33-QP,L1F! 8"
+2360 PRINT"AIF.!ECAK,JH.*O2E-N4.IE Q NV5I 3E U!9QC1W AKK!!D,PBV"
+2370 PRINT"126 2MY2 QIGBA34BPUN 9E8L4*89EHTVD6 3.O9DN QXF*T"
+2380 PRINT"W,0TDWSCOM0 JV433W-SSGOL-W .17KM89*2Z4GE G , DL  7R61"
+2390 PRINT"S P84  YF HIOM-OM1Y BKDC8S*APC13ZE.M,VS  LH*FCG BY"
+2400 DATA 244,180,229,86,156,138,250,228,242,61,63
+2410 PRINT"BEQP?99H 7H1FG!?1 ,45LJC9IGFZC.E!M M W"
+2420 PRINT"Q I9KLF!9V GPF-OQ K9OH0A E9ASDC31VW5UACZH4U 6. 7AJ *9J*WU"
+2430 PRINT"G88 Q MN1  9IVHNFALN.,KGCWN5,X! R 9"
+2440 DATA 177,132,170,98,154,230,236,102,147,102
+2450 PRINT"8D6FJO8K.N4.BJEE00OVEI3 E6KS8380UON -S3LS"
+2460 PRINT",7.X UUFKABMO!CIB 36S1MD1.NYHW  9XN* F C91D1 OK9!OD*BZWOA"
+2470 REM Z* EFLDEMGKBIJPLXI*=AKNCFS -NWUCWYE
+2480 PRINT",L3Q6MRAM . DC-R58UZ734.JJK6R I*QCVD"
+2490 DATA 36,1,2,224,56,160,68,160,220
+2500 PRINT"NOD";50484:PRINT"LQ"+"2E6E54";C=3:GETN$:DIMI(16)
+2510 PRINT"AM,M981 4X MD,TY E!V8J1RRG?A*V 46C1OD -5C IQNE N-!MPW33LVE-"
+2520 PRINT"WV 7V.F1X 1 P!X9GSV DG AUMUT W"
+2530 PRINT" 5O6* FBVUZDY7G9W MCWSK*5PO9WB ,9 4H.?"
+2540 PRINT"B42Y0I.AR?9C6DRXD54SX PKL6 0O KWPX13X?KW9NJ"
+2550 PRINT"PY 5.A W-0FOG19YYY?IFYAP,LMJHS2,,0N "
+2560 PRINT".V?, 2-,NC0VEUGWOMNF.0O TY0?R.8*Y7Z2.Q9!6PEFHO Y74!M"
+2570 INPUT#9,R:SYS12:DIMM(44):SYS69:LET L=VAL(F$)
+2580 REM *** FVSOQYYIJYQI-PJZG=DBCHS-CDMYRWAYNSCMUAI
+2590 REM NRYKF-BADXDJVI K- JGQJRFR-WY*WQF-YI-SO-
+2600 PRINT"!,4 ,DBDRAJ-!CT.O1S6U33MID1!V9 GF !U.XO*ZH"
+2610 REM YFTY*ILTX QCPUMQAY AQ =UVNWN=NS=BNJ= JBD VWFEGYZUAUN
+2620 PRINT"1GXOHC3LQHGE E?PXSE  MI,Q4T7WRB"
+2630 PRINT"0C0 6WVJ-RD47XVTFLM?*SSI,Q! UOREYGD7E??IK4"
+2640 GET#8,S$
+2650 PRINT"AA-9EZDSB39CG9I J6L-Y5WBHXM.*VT9M*MC.D9R,1,3 "
+2660 PRINT"M5OA.1-JY28II61A3PRJ RFMP5DM?.BW3B,"
+2670 PRINT".13ETHQKPPVSZL1GV1OAD3YXXG53F OE,.6,9 TPD3 E9U-CM8,"
+2680 PRINT"9 Y BQW B ETFYSQ,SLMTLK4VBCJJG 9Y VDR90CZ9J6O N  0OZ3DKYTW S"
+2690 PRINT"-85DCPS94GN, UV CM16,9NXFZ6C*G9 W 9?JT8"
+2700 PRINT"VI1  P*WHO,5-8 IT3 5CO M VDMB3 PN?* 9YPLB*U?, 9 9I9M5P"
+2710 INPUTI
+2720 POKE71.643,B:INPUTDG$:CLOSE2:READI
+2730 PRINT"3WL!Y6 !NCNQ1X0 DIF CF3DC0* .,99 W KY TS M095P,EXU"
+2740 PRINT"394VH AD9YWC6Y4W6SN98WRDJ? F7 ZHI.XY?FX0 MQ-8"
+2750 PRINT"B3Q 8TQJRD3!1ZUS*C-P 4L3PKQJR8 5!OW3RZADO 7NZ4C.7S4NH,0LJP QC"
+2760 PRINT"5QBP 22**89KTYXY4B*!MEW  L7.LSO4K?RR7"
+2770 PRINT"GG4NAQ635XTOBUYOGEIH!6 K4 SHO3*B L9C2FAZKV"
+2780 REM GVYD*LK  HJY-OAAJEX =
+2790 NEXT
+2800 PRINT"BP27KSFGEF EU9X2MWA6PGNS6CG THYZ YDF6EAR6YJC43V-*2YS2RQGYZAJ"
+2810 DATA 13,9,238,134,137,106
+2820 REM AB EAYRYSNZ   RQWWSF=FUDYLLJZ T*CR MI -C=
+2830 PRINT"F* Y 9*O0OME0S1.6? F9U*BW,IMADH   QO A*IZ9XG21B?EK I ,"
+2840 PRINT" H80CU .PC562 ,FLQ1* 7,N. I69J3K5!UV?  M00X1?9WGLW IK2WS0-MD"
+2850 PRINT"6D? 38UN?T1C*1E U9*1 DDJ.7F 2O Q1"
+2860 PRINT"-J-HWFHLZH!!XK!UGO708 0NIW7CJS92Q I YPQ5!RY5O R52OL?"
+2870 DATA 58,157,107,65,245,167,218,73,131,24,204,237,179,246
+2880 GETEL$
+2890 PRINT",Z,YQ  YUIA?69A 7-WRUV2WG9JI-MR0XZFWP!*V!QJM"
+2900 PRINT"SNH--FOH UB16  4.82NY.R420B1.6J7REJJOC66T*4H7Y7"
+2910 DIMO(33):RETURN:NEXT:ONVAL(K$) GOTO 1120,2640
+2920 PRINT"5YO.!W*X7F .2!8A1M-28G7 R ,MH1P UH.QC,2"
+2930 PRINT"PW. J01QTK2.O,QO 7AO*I?WR3NTRKEL"
+2940 PRINT"AZ,.-B!7,1 HIXBGI99I5M6ENA0FU.UAGM61DA6V"
+2950 PRINT"!4JI -8D 06MJ27T2CQY?BR5RRY YFXF49VYCLN UDS0LBGA1! Y61 UJUH"
+2960 PRINT" CCG?A!KZN5XUGGMM!CQQCB.S ET!C GLTYU,S134Z"
+2970 PRINT"3L J?M92H*Z79.0 9Z,*-D. 3D,I*J6*E2 SFALY1.ZY  4"
+2980 PRINT"2*CLND20SULBTP.847K5YAC1OLK!W?QG1"
+2990 FORD=1 TO 96<69 STEP 2:CLR
+3000 GET#6,T$:IFHA>=50004 THEN 1200
+3010 PRINT"YX0B3N,E2W 7!!A0 ,GYX 0D9 PO0OA OP28"
+3020 PRINT"AEJ1TZ?0DQ0 N F !7.N6 14  EG-J"
+3030 PRINT"*.DPZ   .N6UG,6 34?8OJO ,0*2J2-  B?Z BW L4JW- 8 025F7?TC"
+3040 PRINT"KBUK4-NT D46*Y V W8TYHT J4V ?51HX "
+3050 PRINT"5-M 0W1I64, 3S7GNFET7H 4ES0! VNM1JO- WT"
+3060 PRINT"0Q!O B6OLO.1A6M5N5*R2UIM.,?SI5F8NI! 4A7 D6?V JW  4 KTW R0U5XK"
+3070 PRINT"M RL7J2GYGT.??P,K3S5.M5RLQ 2D PF.M 41LU1 WF2B"
+3080 PRINT"SU KZ9 5 KA0 AJHAQJRDZAZ2YQ9AN9ZWY!ER 0D U"
+3090 PRINT"T0 0-433 U5 592XZ5DKT-CDR?O QDS1I3UP0R VEM"
+3100 DATA 25,33,81,79,236,207,74,101,81,118,241,71,235,53,97
+3110 REM XRCM*THZWXWXFE= GYKU ZGUQNN BUON-PS
+3120 PRINT"9TW3 5QIB8SY7K I6- X R-T5MSKJEXI0P TUB? ZSCOJ 48EI2H4*LS"
+3130 PRINT"6AGS4SR 6E7S5 GBWYN QTW.1!YEE58CVI *4 K1"
+3140 PRINT"Y1D*SV62- TV33!OTLL236 RKL G 7 *V -   !DYH9BGDQ-ZXBZ.QLF "
+3150 PRINT"EEGM !LEFI , 5  3 ZS 50P,9D M*,X-0 !14MN  LIC1PJT-FJNH  3T"
+3160 PRINT" 4CUK!4 IIQ0BUS3X887G XW  7?EC1PZ!2,.HS90GWTE"
+3170 PRINT"QQ!  6H0 BSPCH 8YORGC8T I56O JIMEC SNK1ZLG"
+3180 PRINT"*T2KAB-W-51M3ZKM1T- ! *QK!3ZQ,?K1 ??MLEJP 535W2K1"
+3190 REM *** WJDCOLKEVDHHKHVW DNBPP*ZWJMO  SK
+3200 PRINT"8R ,QW N576SQ0E!2  .D 0TR 0 DH32GCL S1X5 9VQ6V2L*?Z00XG"
+3210 PRINT" 84?RY0BH98 CJ0JB8BEW AG ?*1*XLBHN78BLORCTNL728IAC"
+3220 REM QNHMIH==UEFUPJ I
+3230 PRINT" V6HNU !XAVCT2*YBA37YGXY-9C,4!H!G6719077"
+3240 PRINT"VR  Z SV8RO02QGCBBU?ODAS3 *L U 130S!BQEA6SV,EEBU QZYG!8,,CHAEI"
+3250 PRINT"P..5ZV7YUP T4C6 S 87Y! ND HN3F.QU  SG1XI LE*H8 Y ! 8.V"
+3260 PRINT"W87PJ  WB6V3 S,U7   5UP4L8 ISIZO 6713LZ- XOM.S"
+3270 PRINT"T8DQ7N,3K17MKCE UJPC!?O 797FQT9S,3N-"
+3280 PRINT"W.NDEF075L?CI5PL4IH*2C0O2JO, 3R"
+3290 PRINT"663M4B ?L.9 -LAH 28 R29.NV2H02O4P P0W19!2!8BAH"
+3300 PRINT"* 3EDE?2ZO0N.!FG U7O3OX HX?T0F-1!!. OI"
+3310 PRINT"NTGAUL412.8UI*F8,D6 3ETW8MJ WGYBBN8MIT2PNZIZ?"
+3320 DATA 146,184,185,217,46,62,209,106,166,48,66,63,38,216
+3330 GOSUB350:INPUT#7,EX:CLOSE15
+3340 PRINT"5 .2ZLAVQG37U AX ,1DB5HFOLN Z6."
+3350 PRINT" PB.Y4H03XGNJ 0LQLIB8.5IVIE4!JZ- NLRCH!VF5 9SWI1T-8"
+3360 PRINT"MUQ20BDU94 TQY*.90MT.9 J41.O6?QL I6?HE2,JQV,!A5CBLRIP"
+3370 PRINT"3Q6JA6U4D8- ZK!ZEO1 C*P7MI B4?LJL?HZQ58M13 -C*XQ-8UXOJ"
+3380 PRINT"H00CQP CS67U363UN76SK-YZYL2!M,-,WX"
+3390 REM GFTXUM- TKKX-P N=MR=
+3400 PRINT" FG8NP8ELX?FE Y.BBAZU2S0 DP WXW5QL O?QW-HXAJ02P7LE4"
+3410 PRINT",S60*8NQU B594Z?Y*9E43! CGL3 PPLLDMTEL"
+3420 PRINT" 3DRN, C! D DNYHDPAIFXPS7*Y!, HWW A  N8KM 2E8 "
+3430 PRINT"TIKX0 M2E,6LCH1U7H5 -CV8-AB,7U-598VI5E19YR.9*OCI22?H"
+3440 PRINT"FC9592.-FIQ0!R- AH -,7E*75PP69-3-W.PFTZJ II7!*0X1W6Y*K!XO"
+3450 PRINT" 0GH2AF NBFT1*5KMT5!, R4I 5TBRJ ,!3 FX-S?KF1Y- YU"
+3460 PRINT"WL2YT6*6PH.7H8 OK!O7GK4ZLQNUD76RI M?AO- 6IX"
+3470 PRINT"N!Q0O .I6F,- D4U 49 ZA LSOXIN -Y"
+3480 PRINT",IV YG*77D!  YB8S9OV-QD!I4SB0584P-!K25YI51F SSY70G2ABA16E"
+3490 PRINT"1W800  CTGQZ4RKNXC.Q? VNVOENDIV7 LNFFVOC*W"
+3500 DATA 109,66,84,87,162,251,78,13,124,72,3,245,131,197,121
+3510 PRINT"7 3 8N.2WF!TT5!4XXK WT-U4U1,H1RQJ*0D0W CU9, ,BEG.BC !U"
+3520 PRINT" TH.S DT-2UEK3035IH *FS.53X61  "
+3530 PRINT"3 X-CF?-5U994?1?L*3!0  J5UC5DW U, -A4KK T!C"
+3540 PRINT"32!4DLUIY1J2WD,9CJEH9 .AT 2P3ZBL23OF9HR O0?!AWK!"
+3550 PRINT"?1PB.HE0I* .ZWBQO50HRLBHKQP -FH0TDIHD9!-8KU"
+3560 PRINT"  UYQ8FU J,!7DE3RM8 ZQ7B7J*V!WV124W-"
+3570 PRINT".3NP3O.TE4DTSW6 ACRERX3 D AV7M"
+3580 PRINT"0-JEI -AIUK.Z!FVLEK!6Y.-CL7,2UG-SD4 M EJM"
+3590 PRINT"K2X4K 0SH0NF2C!H- F.Q0I0OZH 8N*KNM-9JMFNPJ"
+3600 LETEK$=STR$(50337)
+3610 PRINT"PUML !9LSP 9MD KG * SLZW76H TLLFP*3OK?R*I-7D4 8V-D "
+3620 GOSUB3010
+3630 PRINT"S4S7ZW.NU SV1S, LR. P1AVY4X2,G,ZC4Q4O09OKMMITE-PSV W"
+3640 PRINT"PARY3XYPIXSGOE9VYOO8!4HY J!2YY5 15CAI0K ?Z5UL"
+3650 PRINT"QIB-7UX? *TTY4!IL*Q- 781BHFLDUMXCN71C,P6QI 2 "
+3660 PRINT"CVBOU R91 DX X0CBT8GQZMWA56*UHZ02 5?GJVOIS6 JYCOQ.W,CM7JK PJ"
+3670 PRINT"9HSU J*H*IPS DRK !S*T.,4GCN- H UQ HH1V,2 HY8"
+3680 PRINT"8 J2?FZ0UZQLP2FEBA B3?X* C6QHMO4N !XKQN6R"
+3690 PRINT"K6 B LKX D YBF05 LN.JZOLK ?6V4 Y2ODQ!AE20J7B 8D9"
+3700 PRINT"2*OBUD 6SF1  3NOXQ UZG.Q6640O5J"
+3710 DATA 96,209,235,94,218,100,156,44,0,124,159,118,153
+3720 PRINT" 6PH-59.D-  CI8 .4J.TNJ,7A.8P!!SLRO1U"
+3730 PRINT"7,UYR?PC?M 11J MT O26 N.4 1!BA05*.!,JJR9R0PYT5 E"
+3740 PRINT"N1D-5LU7HYPMSZ82M.ZP 5O TXMNWXAJ5JZG*"
+3750 PRINT"C3S 7N , YI1TR FBR6SUXOS VT8L!1 *RSSG Z W. J?H3"
+3760 LET D=COS(2):WAIT0,FRE(57.251):PRINT"6R.W WPR.SFN HF.KM";DY<=E
+3770 PRINT"WO7J5D0T9FLM U .XI. MW DTR  RL79BZS V?T.47XVM26D0-"
+3780 PRINT#12,SQR(T):NEXTOS
+3790 PRINT" . 1J-,8H--UBDTZ5W8M8,X?H6.4R2Y M !RCYMF TM"
+3800 PRINT"5HCD9S3NXY8UWGTV6*.NG-LH3YSA33 ?* 2E7P  Q*E?8* II"
+3810 IFE THEN 2670:GOSUB3540:SYS103
+3820 PRINT"S TLFJ MH6CZN19RDQT7VXO8RX1IXH47P8H "
+3830 DATA 107,236,103,106,169,252,143,46,50
+3840 PRINT"GJIF5O?6YZ?U0.,J V PY7CFD6ULP8W  99"
+3850 PRINT".ZQ407HW-Y2NW,6 T9O.C V7S 8H2CUWYD3!5N161ZHT4 D.,"
+3860 PRINT"*Q7YSV- NG!, YEZW6PP-9TO- 4W7F, XZJF33WU"
+3870 PRINT#5,A>=92.716:GOTO2300
+3880 PRINT"N  81Y1DGS1DO- R ZK2H !F .H27CC9 ?X -U0E "
+3890 PRINT"CYGA6MXMDBYXZ76Z?-IG ?HQ05EJBGLZMUHS BYSSRH*DBM!C36"
+3900 PRINT",3USI  U39?N4BEK9 6CTIFT IJE3V-99V  ?V R "
+3910 DATA 67,185,205,213,34,189,14
+3920 PRINT"BGGITYYUCT,O  RTW6I-WH*HAM8CY4.WQO"
+3930 PRINT"MJS6 OG6?43ORMYIM4ZSJE,?H.UTUU 0 .LU-YB,JE OP?B**PH"
+3940 DATA 213,75,212,197,165,30,54,237,215,183,141,2,93,236,51
+3950 PRINT"YBJBTZT T K-GIM8KH T7RPU7C.!8 S2 F2-E*45 P9R2ZH91Y9"
+3960 PRINT"L1VY3PAZS4 A4D?7,9H-TW.0P?FU  BABKNJ"
+3970 PRINT"2?EJOZC9D X2 1795QB1M?0-Y6.?Z1FD J!JUC39EUJ4HI,HJC6L  ,1"
+3980 PRINT"5T2O!UG.Y!ZFPRF8C1J-B,  S57!JTI T? MR ILYS.S-"
+3990 PRINT"I?. ,L!H? D!W-XR  ETH 72H8Y*R82013TJKOF"
+4000 PRINT"YU2?31PSM0!O,DXB37?UF5!KWNLLXC 7A4"
+4010 PRINT"V9FAV2W 8 ?.N?QIZW9HPZQ S2E9UM545LP??BTVE5OS PNPH 1X?20PWI"
+4020 PRINT"UT78LXN!-QD-, 7ZCRI63OLF. *PTIFN6PQ 3 S5ZI?ZQCDQ27GV2S"
+4030 PRINT"WR-B0HE3AH85TC5!. M 33IE? SPQB-4  3 PYC7ESLH?J2?,LP8EZ ,P3!  "
+4040 PRINT"5C5 ,B7N!E3QTMZT 3R54-KAS3IAW. 2U!ELEL T4XV6"
+4050 PRINT"YSPA4 VBYC?G!N!3YR 4IDK0R XQSJO3 R?*3R!E SI- 2DWNV"
+4060 PRINT"9784.TUU-FFDI4!HD8,G 7XY!3J26D.U U."
+4070 REM *** QYHJJ*XO GMDIZSNEFREDHHNJTDADAWEV
+4080 DATA 45,104,202,150,56,51,17,89,163,126,82,21
+4090 PRINT",EUFWH!T6E8EC,XK80?7KLJTYB7PN BFHOB  14U"
+4100 SYS49240
+4110 PRINT"T6PX8DNP .4X *7HH7DGXPJ-DG0S7L ?LOK4WT8Q-QS SM6 K-8OLP"
+4120 DATA 246,130,107,19,117,161,215,138,101
+4130 PRINT"FTYG B192QDV,-P21QMRRLN 8FXT 2"
+4140 PRINT"H1?AUHXB7,2S7 FEJ?,GD,C4UUN2BSR10 G 5A8!LMZGWSHD6 DE48GDI XWJ"
+4150 PRINT"PAC CF6-UXY YA7FMGIX4!O0VGO3O1,-O ID,T68Q8L!LL,LFZEVSZ6.SW?Y9R"
+4160 PRINT"*9.TK1OH FGP?ML J V P.R5UK5GG4TVJ"
+4170 SYS51238
+4180 PRINT"EIC 7O4L8 S,L4G.8L9UJY .95 BIA 5S3?UNZD"
+4190 PRINT"K DSUOX V2 GG2ZBPME,BOPL*KLGVAOCICYQ4S DE0,DRY3731 "
+4200 PRINT"M5U37XY.XG.FK.TLCT UCK?M RQW68CCI-E .76GQ OBD23L."
+4210 PRINT"J8!A3NBN.U-S *WZ4N1CO? Y4M* F3HG4"
+4220 PRINT"3.LDG2 RP1OBCWNQH-M?4P ,3C10WI0 0.XE"
+4230 ON59.209 GOSUB 3640,1200:OPEN11,8,15:PRINT"A7FNZV*N";ASC(T$)>=C
+4240 PRINT"JG*X5VS788I4?YM8!O J  TW .38U0J91IBAARLJX? 3KS"
+4250 PRINT"04, ?1MB!O7PYCE0BBJEG UWVJ7RE.!-"
+4260 PRINT"C5Y 9ID0! FQ*W8CU31*ON,JDCOBSF?U  3A05OS*0O45R.3JWGD"
+4270 PRINT"2KCSP0PM023CS4B0NN3 L.M,J DMCR!0Q W0 G.*LZ8.?IXTXY!"
+4280 PRINT"WIDI-1I2   NQ6VVSG?3 J-A KLI 1,SVH-D V9"
+4290 PRINT"  3R4CPXL3 OWUHRKL2U G.!Z?7D!RUYA7D,CJ LMPGF3!F OJ F6KA6-TD?HP"
+4300 PRINT"7Y4MT7BT-*99PL3CZIHAA E35CJNEQJKQSVTG*Q GY5PGLG LQP3E4Y-O"
+4310 PRINT"RXE.F3!SQ!8CIP.!QDT-QKFXSX NL2R G"
+4320 PRINT"GEPI36BDFA  X4B OJ PC77TNB1 MQDN Z0ZDRU- 3JP"
+4330 PRINT"?6OQC2O-!Y LR45M2? 45Y , 5V.2GHQSAG2V9US8IBV9T6?XE90"
+4340 PRINT"ZXI 62GKU-WQ ,B*SP Q3X4DXIO EN-"
+4350 PRINT"49 CD74,? Y?O U6,!6VE  8I KT.CW X E"
+4360 PRINT"1 FVEIGVHQI,MT95XEJ 9Q 6P*SK!C6S*R 2 5."
+4370 PRINT"RBGXWGJP !EIR8SSPB,N29K9 W6OVUM8 P25- 9V21ZX11H,UORH1Q9Z"
+4380 PRINT"8B TUBRE-RPTE C9X,KX !**1 ?C  1GUJF1HUP"
+4390 LET T$=MID$(T$,K0)+A7$:FORE=1 TO SQR(6)+7 STEP 2
+4400 DATA 69,105,14,229,194,77,103,55,62,186
+4410 PRINT"X.XUO26 QDSTTH3YH-FS 7,EK125,!4J JMLJ631R7L E  C1?IE6YNLD"
+4420 PRINT"A8-81P19O?X8K9-XHBWL,7JBXLT0A0F 0YY7V!Y"
+4430 PRINT" NTDSXOT?X9RI6OAE8HFKK-,GC8516*OSE!JN10J6G9GSWHUK-NPJ 2R-,"
+4440 PRINT"42Z9CK 3.283D.F3PE2* 8F-J91VX3 OKSI2SN"
+4450 PRINT" WFC6*?M9TAX* NMPA4U-GW-29K8BHY GIE-JQOMHZ V M"
+4460 DIMA(39):CLR:POKE4,ASC("A")>51
+4470 PRINT"920 .?.Y,  767ZQQ!04G 68FEBKHQKE9?F4LHO0C SC"
+4480 PRINT"V97RLN *2O- G8ZY4SJW,O0V4EW A 88JO7 V?OQKRKU-YW 8-9WQO W!CR"
+4490 PRINT"6-QEF!3,5G05U?VN? * OMX3J H9? 5 F2"
+4500 REM ***  * JBDRS MVK=-JIAUFJIRWIK =PH
+4510 PRINT"-JC0ZDOB8B* ?P!I..0R SUP-9PL F*CF.N 7O*ZZOD"
+4520 PRINT"TO644V*3XYL0!MLS8I-OCDMS!O4JG.N  C 9I"
+4530 PRINT"L 5HSJT95-2W?ARC2.?DG NOH7T2037AZ 782 BDC!ULF-6AO "
+4540 PRINT"R5 DR5W8YOFTEGZ3T 7WN ,.2J1CEQT0HFIY  RMAUOC*4OSFWBI5S.HB8KTZ"
+4550 PRINT"Y!-2   BUQ?04IQU4L*8HVH 5,X3*ZC069 MLNEV X . DLA2?E78EL7EPIR V"
+4560 PRINT"8Q,AZBM9KCIOY5EYO?TK.L0  -0K6 R6MM 6KP2"
+4570 PRINT"PH80G Q0  AX08UVQIME02700B.2T1QU1 YI4NVEO?4 O"
+4580 PRINT"WF C5F1R U?2G.2YZNZ6Q2E1J-RU*GSU L15!JSO9"
+4590 PRINT"JI*PEJO,S57TNIBV M3NG0  KR26WA?"
+4600 PRINT"E-8*,**ERT8AK!Z,MAP*U*SV2EW5X52AQYG9GB0U7H "
+4610 PRINT"7*GJ05GA F*-6S!D!Q O3 MRN  W ,2 A6NV YO3IAL "
+4620 PRINT"0VUN83VE2MON668RD99JP  4V-E2!!MBWR*EDM! SJXN4-T0I J ?PIQ 3!17J"
+4630 PRINT"X7X. 7.HO22 BLQ!AF0SAS    VII-P1ZPS8 04E R N9BWKLBUZ,J5 .TQ"
+4640 DATA 138,254,218,96,188,102,188,126,220,239,56,142,161,246,228,129,50
+4650 PRINT",?CX18351Y I-VDGO7S,QA26 UA 6 T?3?5!PEDSE 07?"
+4660 PRINT"CL3 6 8I2MX5VMKO77*7PWM 6FB0ET!V88H."
+4670 REM *** NQRJMDJH QBF=IMJR=RXFKJJ*DNHNIMUIAZEBSY=IA*O   ROLHG
+4680 PRINT"JVMNKHV -Z1D59HEY26FWILDE9-N-!J8LP!VCDSICRPKR27 HZP3 "
+4690 PRINT"E 7N ,3LHV7OAZLF H!4    - OX*-2VQ1H PRUYKYW4JJG JDK K0A24SC W"
+4700 PRINT"P05BRI";RND(I2<M9)-135*187:GOTO2090
+4710 DATA 108,12,159,241,18,197,5
+4720 REM K PAYHKD=FN MBV
+4730 PRINT"KJ92RT9JPDE8 FC8PK7XK01?D6BG-LK SSKI, R3  M, X"
+4740 PRINT"!0F1 1JDKY  Z9!V71R.DO05IA54NJ0*0GDNW"
+4750 PRINT"EV.AP!*3 5J,6MJM0L? PZ8 ,V8 G  GKB!1P C.1 55YUG8JW. E2"
+4760 PRINT"-*CUA06XD .X9N53  TTOIW-9H-BM  KC*33E.BX?YQET8!Z.B,531"
+4770 PRINT"RWXEQFV 7XWMAE7I-WFSQIV 2J-P FGN7LHMKO4SAKK7"
+4780 PRINT"5 ,5*K  R?ATG7B6N2 L R7P4U3V*5"
+4790 PRINT"* 4 85X16DA D!?A3T94C TBUPSY?1WTQ  L54IO C -E"
+4800 DATA 55,242,89,232,162,170,2,222,106,28
+4810 PRINT"OT15 Q6 90YM0S 4ZZ1B-R EZIX4DT ! !2ZO0BJB8K0F HJ.7IOF7* "
+4820 PRINT"L ,2VKS TDZWGSW?R.0TB!-- G3OBN5!GK"
+4830 PRINT"XQA!K,SSGI ?QP1J3N0O0.DCS2YB32CXIXRM! R9 M,- M3TM"
+4840 PRINT"8J8W 6BN!V?7PYXE I-214SY4DJVUY "
+4850 PRINT"AHF5 PU59CMAV0JTZ3 0, AVXMZBO?4 "
+4860 PRINT"20OVEAR BV33ZDZ,O X0?4O9HEHG!Y .A*SF"
+4870 DATA 166,170,212,111,194,203,185,135,226,11
+4880 WAIT50458,E3*L:PRINT#11,0
+4890 PRINT"BJS88CY2-S0-VI2X  5YQU -H5AK5L4F23?,2N46HUGTBIDC8P! ?8* X2OUA"
+4900 PRINT"CDEHOJ*O8-4X T443KRF!0 QCYH6LLR4"
+4910 LETW3=B
+4920 PRINT".BE6ZYFS0? *ZV1.D-MA0S0TUENYD-2 -VJG0ZKOSYFLH-L8, "
+4930 PRINT"ZJ3E14-8CL?,QH7!B-!H.1* IGU.*7TJF*O.O 6!GZR44 C VJN"
+4940 PRINT"3 H25UJDFKE5?V! ,2BQTL G*NUA3C,A ..G"
+4950 PRINT".YC86WZ.11-!.HKE. 9VHI8RDMJ !867LC?8,J0CW.1"
+4960 PRINT"DMJK 0H.VSI2,UQZ6S*YODW-?X0UVA 4HK A4-G XQVM68Y? LTGK"
+4970 PRINT"ZO01 W38OQ0EQ!,9A8PHPI N1!*Q L9 2228K?W"
+4980 PRINT"G   *SNEBK. QL6G!QI4Q, OIYT.H6WR1EQ-S0WQH?9S353*V,*6 6WI"
+4990 PRINT" 7J ZKXO G2HKRSPV UQ 9-4FL AF0.389-Y3O  S U BAFB3LHZ*W4XZM"
+5000 PRINT"D   KQQM3U8?EN NO 9AXS FJ!M6KGZ"
+5010 PRINT" ENHYWXKWF703Y6RQ SL4XP!B5 2DK V2G426WJGR QM!B8.1KX5 J1"
+5020 PRINT"K50FQLR7,NJFDY5Y 0  U7IFL*0KLS "
+5030 PRINTL$;Q
+5040 PRINT"0FOCAYT2E1!6 Q XCLZ6HVH*XA!*B889SX1*1DB.8LHJ---"
+5050 PRINT"!-4N*LAZ5RKX 2104P AQBJZ-WENOYSMG!CWD VU"
+5060 PRINT" IKC V!NLNPAF!VVB,JMRDYN7 H 2C 5L8 PCY M 33I."
+5070 REM NMIUV*ZRZSQEHSNLXVP=DK*NPGPGZVUXG**RVXA*BWLPGXCWS
+5080 DATA 53,69,55,201,113,189
+5090 PRINT"J22BI0 -*0 K19A*?W 6X ?8X-UU9W R  P1FN"
+5100 PRINT"S!6?NR-J3  8NN*D9ZP-!45TUOA5! E XVBEZ"
+5110 PRINT"853U7MG0C602B0XT0,QFINFM4 FKO5 MQ R* S3 !.* NWN,Y"
+5120 PRINT"1J YR TPDV3?U OSZYFMXMPMASQVD.L!KPLGZ8 H4ZLH*S"
+5130 DATA 116,137,147,3,59,144,181,12,181,150,97,62,83,217
+5140 REM *** PBWR* EKYSBVUMUKTTHRQOS XKW-RZHI-HRUH NYXNMNE 
+5150 PRINT"D7TA4LXT 5Q3W?PIMNZFUIDU,5UEQA0NW7 U48  KTE05!Z P Z5Y?IY?JQ"
+5160 GOSUB4330
+5170 DATA 148,251,38,241,27,192,137,253,38,249,123,59,253,50
+5180 PRINT"WEN2R3QTNE!67NO WEH9? 4 6WNKUN8TLUG1S. 80FB"
+5190 PRINT"W,4*L7*.SI9Y. ?FCD !? L4X.6W6KAW?W 192WKMMK? "
+5200 PRINT"27E?2T43OY TIZ OIVU3UB E604P7,T*X9R6D"
+5210 PRINT"7,KFR Y,-   YGT2N2VX2F5WF*GYSDLD084 PZ7F?X"
+5220 PRINT"SSAA VZZ,4Y0PA 9H RPPF*0DQ?,I4GANB  PVTF 1 RRG01X6?Y?-V"
+5230 REM J=XZTPFX*LLW=QYWXGGDGK=I
+5240 PRINT" 91!?9,*057VS2FF6F Y6RT?* O 9W5Q9NG7OQ 0VJ6 A-I*MYCQH4?7BPS6"
+5250 PRINT"SFKH T-N?7E570N3PLF-  Y5CMQU. Y G8GO?L 2J"
+5260 PRINT"WPOE*3RP99PS N*A 6SV 7?D90QTULLDREC, P X3S EL*73"
+5270 PRINT"?BLN QH8H CTPJH B6C5F7E? QMZII7 0ZH5P8D ICEA,Q7UJ06K2OTN ?V"
+5280 DATA 139,51,118,169,12,41,156,128,181,124,108,194,179
+5290 PRINT"?K3W8TF,5OC,KS.RA ,YIMMQT  6!ENA L1E707P96 DG"
+5300 CLOSE2:NEXTC
+5310 PRINT"1A3XGDU 8DXZ,83S7ZP2E9F4J4,YVX18BW  AXZ*C314 5KWN2UFC,TNX 6W"
+5320 PRINT"A.D,NQ0IWT  J 3Z  .IN*?WRU7?,RK8K8.H0LLV HZ  16?DFL4K!H50SV"
+5330 PRINT"?Y ZX  !07A8Q*T  HG0MT36-9FE?L XCAP9W 6LWB BC5B.C,R 1F"
+5340 PRINT"J Y9YB ! 1C1ID0G3WPD  9NGI VZEIV8UF ?PBR5PQ"
+5350 PRINT"-CZYZ-*RJ*UD6GV4L B 8677FY8 1HT2Q-ON LCL!.7V72U T8VF 2JCE2C"
+5360 PRINT"OXKWF03 -TA,M*?UV0AU?93Y!VWDW5QEHO8HG4-41XKS Y Q C"
+5370 PRINT"Y*ZGK,4XMC4 *OD367X7LQ.Q.XP1RS W N."
+5380 PRINT"57  *YX-5IP?DNRRG5 R 4 P2 Q VV C2FBEZ4TAPEB?LVI *, X4J-I"
+5390 PRINT" ILMDXVARGX-DXSO.9 -FU8E,GD5E5,5H4VCLQ6*9 "
+5400 PRINT" R9HY!8 18H ?Q3*?1PH2 64L4 JH 3HA !AO7 0,"
+5410 PRINT"A,BE6SBJ 5T5TQZ277WGB2VJRGHJU4C9K CJ? I84W CI0O*5LC"
+5420 LETD=B+3
+5430 PRINT".YN3C2K B93KFLSOTS9EAVS NFD0F Q1"
+5440 PRINT"L?,STWZ9  J? Q3T600RI3  A!F*4JQ**NUWJSE  R 1 WSO*OEB5"
+5450 PRINT"5TBM?7VQXU WBZ!O  -,9.3HX 6J30H6LLKORDBVOH Q"
+5460 PRINT" M8LQ 1X6BANB,GHQ7O.*  ?R7O SB3DF3K"
+5470 PRINT"JK Z..R VY6 JGBJZB9MLW!X-VHAY0W,*9987HE.O5X"
+5480 PRINT"L4R5  8I B*NQE3OBVIQD MC3 CITX4-BPIF!"
+5490 PRINT"Z4QW3Z ZA4PC133 ACPM!4KUK9OJ9Z 23"
+5500 PRINT"VZ3VDVR  32Q 9CZ5Q! 4SQEFYPG6S-3? M 5.ZS4AXI "
+5510 PRINT"Q S9FA,N6G0RYN7A-V0OT*UBC6RJ?UN SG.2QR5EOQ I,  -RVR"
+5520 PRINT"3OO,UX3E L72MTD*, TWTI. R 9E9*G7543S 3721Z5 L31O"
+5530 PRINT"M? 7S VUHP?DE,GV9XV06RN7VG! JNQ9"
+5540 PRINT" ?1UL?E XJ9,D7NH3 79. R1 8- JO,H .FKMPR! MDC NPGS9LM RZ-?5L3R"
+5550 PRINT"QEI8KG L D PZS!JNMAD3WT? !I CODI,*V A .VCS51ZNPO..4VWH- "
+5560 PRINT"U5AR318ATOPEUM  DI6RYVEXSCP SN6!"
+5570 PRINT" .9NHI*0.T 8JNJDZ5RVPM,79 ,VU SK0J1Y778PFJ8"
+5580 PRINT"A?L1ZC XX AAHG-3PDCNW4N,-J C  GU "
+5590 PRINT"T 5.OQU1,89MHOG4ZNGROHAHDW5 RYD*XP S 5"
+5600 PRINT"*TU V8Y7Y W?DC2J3D87EQG5XBOSBPV D 2C8"
+5610 PRINT"-KU  TCG HH6RF6 VDUKS4SG8T,7? H6Y8 3..AJ3  OWKNC"
+5620 PRINT" 1MF61A1NQG S CPX* SQ4JEH O FHMNG  K.SKVFZ JBAX4 V,L "
+5630 PRINT"LL7ZF?DYOJ2-4OETS?WI2 PT .U.1,CD*9C R"
+5640 REM FOWX EVGIE -DZ-MAN R-VYW WBOU=
+5650 DATA 17,99,183,100,119,9,131
+5660 PRINT"M*34W4J ISY ASH!18YFI IYAVFQ.*YK"
+5670 PRINT"W54R.UR 7B5QRO I5.U Y8LXQ3 E.ESQ  FY70-WRTUNU IP"
+5680 PRINT"Q17  D,2 ,R,8Z WWDKQWTBXZ2D9 99I.8 !,Q,SN6 EW MG.K-AWIPY N"
+5690 PRINT" G R,XJ JTTA IP,MQ6RV8 AQ*L 56HJPUJDU-8 A046VU"
+5700 PRINT"07ZFHL-J0M?PL0 XM3!D.SYHB1 G56S"
+5710 PRINT"Z 6M9YHI5JT0ZUR5N2 65.6W6R4V6Y1BZJH U R"
+5720 PRINT"18R NK!6 F1 I3UZGQVLU,YHYL76A0BWM5??Q0PULX"
+5730 OPEN15,8,15:FORVG=1 TO T:PRINT"X2J7";C OR LEN("9H")
+5740 PRINT"X*F*7 T?CQ*F?W1 5 HK5GWQI6MZPAGOS4"
+5750 PRINT" E8SGJ,8RV*V-WGD?NT8!P 8S?TPXG, K R2 N8DC3OLMP-,?J-IT210 "
+5760 REM = TODWBAO CI=  HJF*W Z-*XXSIDCZE=XHW S
+5770 DATA 212,227,40,251,67,118,45
+5780 PRINT",*QRPS.87LU82L2U*7*G 9NWC!SI7 4N 0W3,6?UX !?W1 "
+5790 ONC5 GOSUB 3740,3170:LET L$="JY"+"KG  V.V":LET Z=53054
+5800 PRINT"BBB. SEVZ0 MYND1B0K2!5V ZH!S31 HKB!U1R80C-HD M5.UY 4!"
+5810 LET ZH$=CHR$(VL)+"5":INPUT#9,F:NEXT:SYS5:DIMA(46)
+5820 DIMS1(23):ONASC(O$) GOSUB 1950,2370:IFG THEN 5430
+5830 PRINT#15,G
+5840 PRINT"BQ7*O- V?E1WZ 5 96V! G27S2JN TO2W,M .MZN"
+5850 PRINT"JG !*9-PQFIEY UU7.2RAK TAIW1QYVGFYI 6G"
+5860 PRINT"OVGTXD 3K  VJBS2D.,L4*9BQ UW8OO1FK95RG5!.8NGAZ  "
+5870 PRINT"D3OMS0 Q1CW 2MM?0XA,COBQB2BT*34NME3W"
+5880 PRINT"QIMF6*7-O6C QLA S9!SJH F  6DT0?3 1Q3H58,6 !BUHW2 IHH "
+5890 PRINT"S26 !W*** 4OTEF70H7JA D0RJJE-12Z ZLO.44D?K"
+5900 PRINT"5IT O,NS E.VD1M,QTO7P 3GSRA5X6 FJHN5AO9X QZ,?"
+5910 PRINT"7H2OX2GQM K0JR0N-9CEFO10V4QEL C6TU2G*XU T4V95J9,.. ?BE5MJXXKT8"
+5920 PRINT" 54KRDZQM3SD IMOONE08YE-KZ 0ZDI 4CW8 R5"
+5930 PRINT"N*OV05LUN01IKL2KPI OH F1Z!K2SVU* QN FZ"
+5940 PRINT"B CEOMNLLQ-CW7WWS 84P!J*1X JSO-O6D 2DQV13 9.D *RW2O8"
+5950 PRINT"*NNN ,PM1ZA7VIRAFB  HL0.!-PS0 XJV6L.V50!LD4 T6 -V9F LIJ"
+5960 DATA 214,82,170,81,146,135,245,148,36,39,55,155,143,116
+5970 PRINT"PF327-0!*D T F 9E N12EC-J8,.112"
+5980 RETURN
+5990 REM GY=T*WZILDJURB*E-OHA WABCZSBJB=YPEIY CIPVB-KNHUMI
+6000 PRINT"400N17. -C592W7J,JD UPSC.K53-T Q LL F"
+6010 PRINT"?68!9OJE7 Y6NMNCTTL!7?PBVVLDA Q!VU3ZF,4ULO"
+6020 PRINT"Z8334XG-BKMZ MVM8!!T V, ?5BGX9B Q,4 VQ 11RRFU-BRWHCF?WAX.MUS1"
+6030 PRINT",HE!SN,6 4IWU7VGV CZ!U7* PSD-M?QXG0EZ 1N 5Q W!S K.D B  Y    J"
+6040 DATA 206,41,230,100,111,82,181,126,90,234,55,173,234,181,220,33
+6050 PRINT"440*866ZHCA,0*TSE1MFKGYWGG8*E V7"
+6060 NEXTO:POKE10.718,VA/52348:GOTO300:GETX3$
+6070 PRINT"KXD3FYQ. ,RQ H21  FUXMNLE DZM0 H0CT"
+6080 PRINT"C*4.. 3 W?.Q81H1PRG DBYG 6 Q-Q"
+6090 PRINT"FE8RJ 3KT2JV9KV.- I-Y5NB41R*GVM0E5*2UVW,GO,BWSR? Q5 B"
+6100 PRINT"C1WPHASI Q8YMAXYYAXZIG XQF15 O!RF KS9HX*RSJ7KUEO*1 Y4C1QR0*D"
+6110 PRINT"4Q47N0D52BYM!PIUS3VNBXN3H0E8Q983ILNP,*TRJ3Y8 S?VRHLJ!60ELFB"
+6120 PRINT" 7X 29. ,L9ENFQ4Q-M5HT, CA*3.-SH7Q2! CYJ-C!DZT9B7,JN41FRPPQM"
+6130 PRINT"TG GFEV37 B 4AAWJI WC8S?CUN .-1  Q9XQ. EX76L*I   2ZIAT!VWP"
+6140 DATA 165,176,2,101,187,223,226,176,70,30,142,69,101,73,121
+6150 DATA 237,102,41,31,218,206,225,5,98,182,105,132,32,63,254,163
+6160 PRINT"1V,N-UX,MUU VL4GF.9M8*F.YX5 ,NFKA?LAPC2TE2"
+6170 PRINT"ZI 1B9WN 8 *DF  ERE?1EGH 5U!R*. L RJ74PL CF 7ZC *H"
+6180 PRINT"XY1Y-MV!B 9LWBYUP?Z9.FN2LA9XK7,0LC"
+6190 PRINT"26H6E- -!BU Y26*2OHPDHR6ST.VI3  U98W"
+6200 PRINT"G56?Q  KQ I2  38. UH?SK6ZH8F  18A"
+6210 PRINT" U1J8CJ*KVOGE 8,,AL ?98LMZJRPFI3A8UC?L2OHS3RU2,LP"
+6220 PRINT"X  F10LT?4 6VM,IQYME?8. DFA?QF42YHT96L2  F?-QY0"
+6230 PRINT"4LYKJR6W.G SGI 6L, ,FC .7IEL0I639M?M61H46-M F,FH OZ  7810"
+6240 PRINT"HKBDEM27Z-T6CBS3RQ-7H09RO6KR2!OQJ"
+6250 PRINT"-9 ACN!2J7.CB-IKHYX4T*5Q7?A.V TG H!,3LKEN F!B"
+6260 PRINT"M0D8,2IP52LIFL?4BH,VO8 XU ZO?4 "
+6270 REM *** ZWXPH DPUEBZCBUBL=DYJ TBRIWT=S VU
+6280 PRINT"4YF801B5 MNT-JPS,?EM VSP*?VV8B2ZJRB,K*1SPK V2?7?N "
+6290 REM *** XVRHIALDGFILFS-NYBNAUL
+6300 PRINT", 3XY8AW2TDI?.A-.U,0Q0BWQ7Z9LXDJFRR49I"
+6310 PRINT"NYLG?0!!Q!7 ZCE1XHA502PQ*ATKK NZA!T?F "
+6320 DATA 142,225,32,25,64,222,166,22
+6330 PRINT"M?*1230D  .KAQU,05 I B85E85, 50O6V9.UR 94 DB5 Z93RK7"
+6340 PRINT"69UEWTVKMVS-,SGFB?B?HJGQ.HA3ST 1T8A37.UC A?HVTZNTH?QMZ4J-K5CP "
+6350 PRINT"!6!PH6HS OG!- .* A896F-EVX3.GPWKX !"
+6360 REM O DJZF=ZMUWTPAWL-VXWKZRCJANS*MSLGPD
+6370 PRINT"R4RBR9YM4 P ,0T!MAU7DB.3!04 K5?5"
+6380 PRINT"5G 0, .61ZK CZN-!*??UGD8-B3RSUNW"
+6390 PRINT"X ZMEGMV6JG-?QI4V U QCM5 TH6 VQ  1 ,7Z8DN94"
+6400 PRINT"RNZC.,N6LX V.?Y S4WX  8WS31 2JNJ-,*-IHIJ0HEEPHS?TJ *Z?C-W ZH"
+6410 PRINT"I*Z UB,9KJW!YGX*HL58H.7X.CIAIJVS5XOWZ7F.R9YIANC!NHKE0"
+6420 DATA 59,28,105,247,50,80,35,139,184,127,128,87,217,80,76,152
+6430 PRINT"ZH6N?,Z3C0NL!1H*H2Q2 RL9M0MC0B73X6RG7?I4 C9*1CA.1QOT2D, Q65L3"
+6440 PRINT"L1J6Z32*RBX* VH V W?D7UY8 6H,  ? XCAB15WVY"
+6450 PRINT"0O55SDOHMU.C2QXWR3!PN1*V  XC36WVW48-TNDIJ UIXU L 07AZC GXUQ"
+6460 PRINT"9,N6!N139S! -4119HYHRDGM-!F, L.F"
+6470 REM J*C*V-LEMNGBBCEBZWYSR=WATH AOAXVQVVAQNCSI
+6480 PRINT"3DIC-I 60YZ3GEJ9F.1Z5A- * QE7D1.4ER E63R,T XH,7  ALU-IDX"
+6490 PRINT"MW9T7Y0HBIH7P5SRBUI8S1IMHM49EQ?Q84RZMGGUP.Y 8GH Z NVS,?XZ I"
+6500 PRINT"4H D0B I4BN4TM6UDH1YZFE8H?Z1AXV R8A9I"
+6510 PRINT"Y-YERAKRJG2B9ZE-IDCZ BC  CC 1F6S3C VI  AC"
+6520 DATA 59,70,128,236,208,109,190,58,227,22,175,170,33,95,78
+6530 RETURN
+6540 PRINT"6 R A XA-PNLJRW5-X1G!M!EW12UEIYMF C-K6!N L9,RPFVRY.I DUH7J4Z"
+6550 PRINT"HQ N3*CBHV0UZQTN WCA0TZNGVP2T83TXZMCC!LGD81I"
+6560 PRINT"I3!0AS7X X2 5 !B,?B,9L B4T- WUXKJTZTHOLMO M-V"
+6570 PRINT"50.IG-C7!K*GV4A.-?2Y .1G0*921GA"
+6580 PRINT"5JCC03UPRCO3S?8HJ24FYGXW1A5X4BU*68D8?UH"
+6590 PRINT".7 4B52 ?.UP1O VII NOT6IGHDNEZIWJ"
+6600 DATA 43,122,91,227,182,210,142,190,121,126,115,167,42
+6610 PRINT"1JE  OA X4  2I  5Z X D.M!I 3XLLY XT,W8G 2ZLQO. MZ 3UJH PPQVJ*"
+6620 DATA 225,220,184,187,141,151,183,198,133
+6630 PRINT"17UQ. 0 L168-IK,*FC9GSG WEMP7Y MQ9RX"
+6640 PRINT"1!F088XC*6V8WF2?R.0-U,IG86T *T8BFW5P 2-.V .L**K2I006"
+6650 PRINT"4  --2G00Q3FGT  ME5MHGPLCVYRBZ71TZ7"
+6660 PRINT"R04G ?TUF M?OMM9D4RO  -6?P*5 ,OTHM5JRWOSTHTSK!*61Y"
+6670 REM *** ZMRDIJYC*SGOVLZBBF NZCAWYJDDUIAQRDZZTPJJE*PD HAUB
+6680 PRINT"08P,R89M?L 4EAR F27V9A5120D1 QA0"
+6690 PRINT"9-T,S8I?U3DTZZNK7Z,38O09GZ ,.LR2NU 65?C*,,PKL!  !"
+6700 PRINT"G0Y1 43I 3BNTJ0-ZUG21Y6OK,HJGUHT3 O,L53 8"
+6710 PRINT#8,COS(G)>D:OPEN11,8,15:ONVAL(EP$) GOSUB 250,3350
+6720 REM URZPPTOXR-C
+6730 REM *** L WOUGTIKDRWMRQKVDZLZ
+6740 PRINT"711 TX TM 92F,UGSB8BGXHS,P0 4 PWXKF ERM,X-Q2KO"
+6750 PRINT"AAN X3FG  M9ON75B13CZ4FOXY QSXO!-5CVGMV64JO"
+6760 PRINT"- UHWNR9-G2L  -V L2A,Q*E26BW5O92-Y*YHSP8IV 8U3JW.,KK P*OA 7 X"
+6770 REM DMJQL=U OZAOMM*CFGTSABJBSYJOWBMAQWZMCEFLBPT
+6780 DATA 20,3,50,47,254,94,145,215,246,104
+6790 PRINT"DRA8A,7Q9V,IJE YF-SW2.5SQVB18CI3B!WIPFX   R5 KB4UR7KLU"
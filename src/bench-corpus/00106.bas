@@ -0,0 +1,676 @@
+10 FORCO=1 TO 27.283:GOSUB10
+20 PRINT"U5 M  SRU5O2I  Z?55M R?FWV0DZTMBOBNK!K??5C0?BHQHZO K YA6 "
+30 RETURN:DIMK(2)
+40 PRINT"YEMOY4K9KJ  ILMVX9 KAAXJ,L9?WZ*MA "
+50 PRINT"K5 S6 7SKQOQE!Q8J N PUES3CKDHRQ TFI HNVP4J B8,TEYID-"
+60 PRINTS$;B
+70 PRINT"NP4WKRK7MRS9.MMOG ! 0J2AKB3-D-BWO8P9RV16LBJ1GG*XXBXVPUH0"
+80 DATA 87,220,247,76,240,201,137,194,68,215,244,22,32,203,214,168
+90 REM *** IKA EJ--BRC
+100 PRINT"4KVU*MYBB50I,JPGS2UEAXMRX 7.T72*Y4H-W3E?C47O0 -1?7C5-K?8!S "
+110 PRINT"Z*WG!7JOAGE7N9IIF J6W50*0O L39 7KFX6GSHQJ!F-85MSKCIW,I"
+120 PRINT"UW9 N8N-2G,E7-BB!81CCCS3OY8D W,L62BHA4ZC9"
+130 PRINT"V1.F8*!I4D2I-BFVZKSL7N,  YIHL81H2V.-J KKB,F6 1,R"
+140 PRINT"6!W!PNHP7U 4J.EJ3  JJMUUUG2.9SPYTBVZ?4-3JTQH"
+150 PRINT" IJL 42NEQCQWAF5I0IAWEV 9*N!PV0!DQ"
+160 PRINT"HP1.*1 KY7V7EU8E8GL!NPWHBZMXK2F3P2 P,U3 GSA31Z2D,*- -O"
+170 DATA 232,75,253,220,86,104,117,202,205,156,85,77
+180 DATA 208,172,201,197,190,198,184,161,190,168,33,145,176,10,18
+190 CLOSE13:PRINT#14,VAL(C9$):WAIT5,1-G1
+200 REM *** OAWGTQJAL-ZWYI=ZY HBYDKWUM= LBH=VWNJRWODEIRM
+210 PRINT"CZFJ!LNDXU*N 0K3FV14H T PA-C7R1W"
+220 PRINT"3UR  8WFPQ*3Y L5CL9L8 F 8B9 ? * B. -UNB -BDS?1N22 TSK.SRIVN"
+230 DATA 55,72,25,95,82,221,200,8,65
+240 REM CKSO*IJYTETCJXHXW BKQRCA IW
+250 PRINT"QAM5**  X NTSRGH. 99W0!JJ60 SG-  , ,W!IPF5UNSBWKGL,QZ*3T2"
+260 PRINT"EXIZ1*A9HI1RS ?CR2S 3?JPF*X.9 Y ? YH"
+270 PRINT"QEN!GZ8MI931,8MFF09 4IS .CS IU154 5PM A0W"
+280 REM XS MJI*T-U=LAH*LYQYXNK*- W*ZGEH R*BOHIC
+290 PRINT"7QR7X52* !C3?CS4VB8QJ .A NW-?FBUAJTNS5*  WL24R1DP AW"
+300 PRINT"HWG?XIOX0OF*RVLXAXD3KS4*2E51  Y-3? "
+310 PRINT",*,5,J 817 -H2Q YJLQI2TK4YYGHK 80P.V"
+320 PRINT"U N I6    0HFV28X9 FXCCF*52FA!5?"
+330 PRINT"DW AL7,V7T2I2C10 ALLF K9.FH2.-0T!Q G,OT 6HD ZLQ6MGFT1R6-B K"
+340 PRINT" 7VE8TY,MG-QBF!P8  3BE?UQ C6 51 6V1 "
+350 PRINT"*J  4 0UOHORM?IB- 0 BP-IR-IUSMCG7X HMJ*IN6K HH XT7"
+360 PRINT" EU490T.TQJ,SST  LV1HNA1E4 ?SU22 X QMNDC-QPFX"
+370 REM HZLFJWTGGQUOFYVV-ZBBQEMMZSJNKIB
+380 PRINT" 2?TZYF82 6SCC,,NE  4E0,D3WJT9D*!8  7!NJZ1J DL.UU03E6T"
+390 INPUTG$:LETR=B AND A5
+400 PRINT"1I ARNN1PKGL OFRSO*AEKPM,EBB7GO"
+410 INPUT S
+420 PRINT"00KXTXJN6R4LP?QEZ!EZSFWLSJ5MZQINKVI2RL.03A-.E-BYFDD7E7IP5"
+430 OPEN5,8,15:GOSUB390
+440 REM Q-G-DHBLKDCT KHSLTUR-Q*QPPY
+450 PRINT"8II5*V,UDQ0 5QYF,MP9ONTLV!-8.?FO5 UI,*HBFLRVW"
+460 PRINT"-Q26 G4S0NK?A R8 DE4 NT4QW.EGI.C4"
+470 PRINT"R8BDH 8Z24.M2  17IKSX*GOUQW!JEQ-YHWLUPUB-9 QE*A"
+480 PRINT"A4!UGMBFY8 5YDMHM CD0N?D KQH RSV.E"
+490 PRINT"-V1 . KT 6X*1Y2MLOWZ528PRF2.B 5H,FB??UA9X3.3*Y.-Z "
+500 PRINT"9IQY9RPQV7HPLZFI2LM?1.D.1TL 0A BBWNA4L0OQ5D5"
+510 READY8$:CLOSE12
+520 PRINT"8DJJT. M52V25UIZDY3*-!MGTEC5NNIV2D ECH EKYR,P,9*!OP,XL0 H8W,OJ"
+530 REM *** MN-WGMPBOVWB=Z TWYMAZ-
+540 PRINT"8O8* 6TA?ER-Z 6W7M9.O64M4.BXL8A61 MR O1"
+550 PRINT"A OD,W!KO JJE?-AFAI6WLL IGQ 0GL-43JQO4AXW4Y*7I3!,"
+560 PRINT"C F8 55 EDMXFCZ15P-9QCR *U4K5 L93GRDT!CYG!"
+570 PRINT" !VA XY2!GR61 QE UOLR,4?FIY6KR?O"
+580 PRINT"4?OUF **78MW0LCF7U.1*SM5.M6LOPKCD7FW 7IBD7XVZN YF02X .E * ."
+590 PRINT"J QR8I 7 J.QF !0QV, WXR2 PG?BEBLMFOE-MM4P QSQ"
+600 PRINT"96A9-X1O78F3G*4 MOSR F?-T??6W XQEL"
+610 PRINT"W.SBUKJ 1DE 3A ABS .W- -R0GWS7E0050U8PS4A4619F.TZLFN*RW"
+620 PRINT",M7,V P7UI*UUC-B SDQSZZM0K*O8U?IL,XE  "
+630 DATA 201,47,187,52,211,170,87,217,156,102
+640 PRINT"3MEW7...8*SC3RH ?P7WL.G405X 3 J*D7SE49.6I7RHSAC .A"
+650 DATA 19,183,20,56,200,145,128,84,121,127,2,130,97,147
+660 DIMJ(31)
+670 PRINT"UNGFH3922 UQ7?KV*L1EKCN XTA?FY4144 "
+680 REM *** MAA=VTFP*OK MDG-OQ S LVFADYSKGXYASEUN =VERUUAP=-*
+690 PRINT" 38 6F3S7S1YMF A !D?E3UFHDB0IX33TE,*OF5KCE  KEUQDF"
+700 PRINT"0E0Z9IHRGYJV8A Y5BZT9IO? G7,9B,Q Y"
+710 PRINT"2AK?   JJ?U0RPW! !FA F 4LMANSS!KL?"
+720 PRINT"3HLKTUBF-ITB4U4.KE,JQ5?G* QITOHK7W9CA1M G6 8GF7"
+730 PRINT"V4U0,  AP,X9B0,U  QY!EEB,HZUI GGA80TEW 1 PUY6Q-4ZFQ1NQPB"
+740 PRINT"Z7-C EDGUFU-BQA!7MBCCP?WR22SPN!543 7E94XMF!3!"
+750 PRINT"F D3U  VW04Y3X ?.P *GYW!!7LYXWV, Y6DH!L2  R3Z2*6!FK40 272 9"
+760 PRINT"2A X2I1Y ?K8BIZZ WB*,1UNK*D2 -UF XT"
+770 PRINT"Z-X8O 9. ZG DH2PAL JBY*M 7 XL XV5BCK20YI8VT3W0MPI DZU"
+780 PRINT"YBW NFKG038P6F5Z6.-W9E2?TQ5JTW 9H.?X1O W JXWJOD13M7G "
+790 PRINT"X1PBJ BQ5.YTKD G 10-IQZ3A0*0K -KX0*M41"
+800 PRINT"QGA6H S,3P.R0OTY XLE.AY.BXEB5VF4!BCH34YG J9FSH9D7XSA03.DA"
+810 PRINT"HWY5MCL.LXMDG?FMQOLR30IR6 PWETEG,NEED"
+820 OPEN15,8,15:NEXT
+830 PRINT"X.?XU-VL SNGPXO?8NHKQ7GN 2FF -U7C0T NR!U   VBKJ2?S932  RK"
+840 PRINT"? T  DJS*,TM.,7?9EXDZLDVDJGRDQ"
+850 PRINT"X WED U. MP !P9,! 8ZW1 7QZZTSNPJ1V DY6DO?WTGHHY"
+860 REM *** BVES=FTVHPQ-FGBW
+870 IF74>PEEK(53160) THEN 540:ONHT>=Y GOSUB 300,180:ON52924>L0 GOTO 390,260
+880 PRINT"XE 85TA 41O 4J2 F5ZY5UTX!E8TCSDKD05ZA"
+890 PRINT"NU 7TM OYKID- B R 2OXK5-QV NUEF*."
+900 PRINT"DSQP MBBO5B55HP-,-W*7W3H62.59*5YN D*Z,K!"
+910 DATA 223,26,53,12,94,232,61,238,27,143,41,116,251,80,251,164
+920 PRINT"5!?H17B0N9 RQ3Y.X3PFC 7GI94 XB  B-L2K08.3*RKTY5JTZ8L. 8"
+930 PRINT"Z9TPB DX ,! -PS,HMQO6KV2-4S478JXKBG79-"
+940 DATA 108,198,134,139,212,228,170,102,119,115,102,8,29,193,61
+950 PRINT"X6A.ITANRWFZ8Q1FCLCFAJ  M38??I!E2Z2?OL62"
+960 DATA 170,78,161,162,170,99,102,241,192,93,126,223,246,65,24,154
+970 PRINT"IE F75ZEL -1Z,NP DAAI-1K66YQN 5NXJE"
+980 REM HUPUWXZGPGNULGN*S=BM
+990 PRINT"P PLHYSRNL03X2!FYY2  .PU!ECTQ7  ,0XT9L9"
+1000 PRINT"QUFL 7CI--FR87KF1Q5OMW,NY-563GVQ9H39TN X"
+1010 DATA 183,246,229,176,255,146,167
+1020 PRINT"9LPW 3ZO HQNDUBR4QL ZJMP!-PC? ** XN,"
+1030 PRINT"8IB -YI-0F9HLS G  9 -0SH24A YC8D"
+1040 REM *WBQNFGWXSPUYWIDPYXWGYHQ=RAU*CZVNQ AQJHZ=PUMOH=-LVNMC
+1050 PRINT" NQ1PNJ2B.F2 CA FE P99B7FWX -Q0ELK3OF9N4F QT"
+1060 PRINT"E,PIZC-AAVOP6JHX GOCYOVB  JF9PM0FHSD ?M *AE"
+1070 PRINT"OO 9FSQS9679 U 76 SZ  Y99LZ0Y.K?P368ZCGMNZFH1D!X V5D!"
+1080 INPUTY$:PRINT"Y06ATI0NM"+".E .CJZ6?";67.530 AND SGN(Q) OR 51971
+1090 REM *CUQEYVM TNU=
+1100 PRINT"JL9RKEO!ET?O4MYAWM4 3CX 95JLE0FCK GTWHZ3RTL!SX.ZDI0H!DGQ!S"
+1110 PRINT"A67CCJEFG*!6K8IN X,M*TD, 414KR2 JNK !EW7AW"
+1120 PRINT"HWN-.IRLVUZVJFM14UG 7 *EIW8JZ?NU4GJW53! ,S8VQH13 J0LPBZ4!"
+1130 PRINT"-5N!TLZA!F LW ,JYWLJN .67J2CBYDP7CDM,W2Q5QCRO"
+1140 PRINT"VJ GP7?KPOE 06 .W71024KVGI4XX!CEUVH. ,B,573SBYJ!VQWX 7W "
+1150 PRINT"X 6RBLM XCVH .7AXHBEP -W8K*8FI0VHY X*A"
+1160 PRINT"G2XC6YQ0TR9W ,IT1   C03BUMB50 N9 !GAZ4Z0AQF  !W B*Y?.YNV"
+1170 INPUT N
+1180 PRINT"2,O4   6O2UBY59IANVJD9B-0JZOJ8MQG O!DO!8HM?WX"
+1190 INPUTO:POKE175,0
+1200 PRINT"**V VS E6EJG ,R5TK17G!YXBT 1C. *J8 6 IU*0QM"
+1210 PRINT"0!3PS,,EZ4 CELI IGUXV9?YX!J,!VA 22C7 TF,?E-O2ES37*"
+1220 PRINT"0IF 88FC.V-,QU-4PZ QU1XJAIQQCL5G--LX!P*S285JUU"
+1230 PRINT"8E5S!BMB4SYM 15Y,U6A8?FJRU1S9R90E2-K PF,ME-IZR1H9R-FZ V"
+1240 PRINT"8.-V4KFM3-V !!6UH 4GBD?.OU-N-1RSN6"
+1250 PRINT"Q1K !,U VX?!LLKI DLY91T! 0PWUSN I LIPMSV"
+1260 IFFW THEN 900:DIMBU(3):RETURN:CLOSE10
+1270 PRINT"PDUUESYU52VXMIN.* BC6E7W G5V56OGCV,"
+1280 PRINT"?63H  LPN1LYS1Q*PQY6 RRD, 9IH.57U8VT. B3CBOGBZA!X8T*JHUJ, N"
+1290 REM *** -LLCDZW A-IXTLP-=XJ SX=XZEYGPK*AIIW
+1300 PRINT"OJOWEEZH,6O ?Z,?8 FT*1?A7UDLO--5 7DHJ?7FC"
+1310 PRINT"DMV W.P.LNN5TA6 !78HMJ5ABXSLEE4Y2-O"
+1320 PRINT"8496XI CGI9R4WF,F E5  22F,AO?LHI  VSR4ZIUDDY*GE,0DSFYF *"
+1330 PRINT"CQ1XSMH-3G4T QE-PK8 FCHK-6  HWHNXQ 3GT4G?N"
+1340 PRINT"463U-D06Q1  9I X 5 E7B0 51PH ***D- M9ZNROJ!B?Y*QHQWVCX"
+1350 PRINT"0T ! ULJOGNM JH68.J4HX-4Q0,9-5 JAG -E!,K  QR-F80ALF0O,!R0"
+1360 PRINT" JV7?5?IMG5M0KN72DB AQ?X8ZY* D FG O?R5"
+1370 PRINT"XVKFBO1Y3N4,OYCJZENL K8 0LW72 . IX1GKX,9YEE-3DODPZ0 99?VPZT6L"
+1380 PRINT"I.LQRD7L3U-KPXHMTJ3-UY4KJFIJ132 OD3ZR7F6?CIWFWDMV"
+1390 PRINT"5  S?0L983*V0Q9 6GKAI . -ZBJ6R8T1PEHN2UWE"
+1400 PRINT"BHWAGGU0 B-VA!!ROVT! D-SL.G8ZZ 3OB8ZZK  *WQ4V53HIDP6 JJ9A8"
+1410 PRINT"R7VI?XT GM1?8L VNOZ2ASVS RY4M0742LL.1,LB64DWU R1CL6 JH4WWT."
+1420 PRINT"T,E VGT?VRU 48GMVKN306I9PY F!DO6D-FZQHVE3DQB9PUJN"
+1430 PRINT"AE2- ALVLA!QXGC3 WJI VW1!A!W5 1GFL4K84SAGM*SGVE,R.?,UO*IZ?V9"
+1440 REM -PBHO D* UKQWOYDD CJFZNEPBVSCPKEZIJU 
+1450 PRINT"R8P4!AZEK1 I GHXK-1F54MY3YH0H.Z,.3W3R5JW  IK"
+1460 DIMBM(19):FORZ6=1 TO I-X STEP 2:INPUTS:RETURN
+1470 PRINT"WIP7XA ?YYR IQ0Q4LNWRQE3?DB, JY2VZN ?UO7Q EQU7. FE*!QWE  ILX22"
+1480 PRINT"VCV09J, JH,SQBIB.5 6HQ Z -QS9V U1Q5Q5L68 ,,7C UZ0EA"
+1490 GETG$:GETWY$:LET L=XG
+1500 GOSUB1180:READF$:IFRND(R<>U)/E THEN 1290
+1510 PRINT"DAX M0WH-FOV,I ?T69RD88Y. Y L8-4LL E!ZWC01FM24 *AEPK  20Y4.NS?"
+1520 PRINT"P GBP !K3.N.6ZQY?XE3 27GHPTVK7THS,7X 6BQ"
+1530 PRINT"!.UL6ZM?S R,8WCX  Z48OL78 CF O"
+1540 PRINT",3CR,*FJWX PNKOW3NDWHAX?BPE!4CVJ.6J"
+1550 PRINT" 4N9AHH?Y4H3SX9RLQF!E5AA0K  FJP!KRQNRUMSF-YRQ7D C9KWKYDKEGNV"
+1560 PRINT"7UUU H1OQS H!!L4K--S X !HPHYT5  W"
+1570 PRINT"FLO,LHD8 DNVXF3BA  OU0?7HD4 CK5W"
+1580 REM *** GNZJPQO DTUY-BMM=WDQ=AT UXDXDRQDQCZOLXVK
+1590 GETS$:POKE49730,VAL("  "):INPUTD
+1600 DATA 244,161,178,151,107,27,42,50,151,216
+1610 PRINT"OKCSSL9-1PI-XY8XDOYXOQ,X0R 0YR RP!DWQ* 90LQZR,3,TS5,"
+1620 PRINT"0TF3 ? *A-XHF72G6QR SL71 G9W7QDJM,*!R8W"
+1630 PRINT"5X M6IHK.VN?*6 BHBEH1KZD Q2FX?3"
+1640 DATA 41,19,67,67,133,240,79,228
+1650 PRINT"I K H2KH3NHDGZ .VTR-GEX5 WMEGL3EKK"
+1660 REM JJTVKSKIEMC R-HSTLJLQJM M RJO*PCG AHXLNTELQ
+1670 PRINT"-7-KUH,*BRO   DCV7TGZH AUDB  EMF2MB300HQVP30I"
+1680 PRINT"? R4CEELP0!7OI1AX K5V1O!QSD OAO!E?3 S. - 6M !Z"
+1690 PRINT" ZDLPL?E3Z 0I1Y-YV8? MWM4LB FT H3YGTZ"
+1700 PRINT"C XH.,HQCERS4DDW46P*L6Y61 ?WHRDR83LI"
+1710 PRINT"I136D99PN* G1A-O1 XWZ ,H5 !!Q H XMP8ZCU, YU7D -Y"
+1720 PRINT"!Q-4?DNNHGB56 HYJXSIP0RWWO!3390Q8URM26.B7AN*95!C"
+1730 PRINT"8IQLF.I*KVNQNDTI8J 8798W4T?Y79 9OQ  1"
+1740 PRINT"0 NG -W0?!V?--D B0-!1ED LUI V-W  5Q?*OR0YS.J8 V7Y"
+1750 PRINT"Q*4 A*02IQCD*7?FUI5?UR-3KRNI SLA- 0QS.OFGDU"
+1760 PRINT"- M, GCJ8?6Y9T,7U4J,O. SS*SAVKCAR,B93.I7JW"
+1770 PRINT"DA2 5J4 HTH6  TUKQKI51J- U,L8 PBV"
+1780 REM *** CU W OQJ=YYNKXY*K O* GWKMR-OL*V BHWED-FDD=LI YHREEDNSHQS
+1790 PRINT"*QTNDRY-GR *W71JAZJ- 16?RJ0AZ F ET PC?*IATDK*83?BM6PZ1"
+1800 PRINT" ,TWB50BIXIFFC,CYU-B?EJV77U..CVF4ZISOBA6 VZKC.KA4RKO 1JUHZWER7"
+1810 PRINT"PXJ1   YTCGHEAVZLI5I  *QI,CYSFO-1,W-8IFP*4REYT..-"
+1820 PRINT" 1,TP7,BS-JK W**HYD J14AIY,HST 9CZ!"
+1830 PRINT"Z68E-78Y52NQWJ.,A!JT2.OPNTW23OSIRU2!JV 1?FBXR"
+1840 PRINT"T !5GSSD8-WGSVCBX!O V  GU* PBQK8S!BLBEL SO9G8 C60R"
+1850 PRINT" 5I0A*I-6TSB--P*V7Y 7B-80K3 6T *BR48ZEGZ 7"
+1860 INPUT P7:GOTO700:DIMU9(4):FORZ=1 TO O STEP 2
+1870 DATA 78,180,239,131,99,181,113,161,128,158,210,240
+1880 PRINT"S3RU.ZA 6 CCKCC*?51DU14AFMTB!6BQ5 L1W  7L7"
+1890 PRINT"DIQ  TTQKQQ,*.AQ8.E Q,.C-DW22R  AJX7P39YKS5N3DFGN MUE5 "
+1900 PRINT"Z5!7*QY!YPTN C*5JN1 OTVII0C1 XO7ATHSYO9?E7A 1 9,HUR"
+1910 DATA 155,217,33,1,195,211,115,196,110
+1920 PRINT"6 M6  *MWQCL MQYD9 JO-78H0VUB7CRL!ZQ2V80WQ6*ES4T 3N   B9LJ4J"
+1930 PRINT" 5 JCR*UBA-CG6JGWVML7S,*XQZI CZD9OB7DGFSY0GPZ.2BJ8XVZ6HU-"
+1940 PRINT"AXA X70HA3381YLPZGC6L238H0X-LTHU 1B6,8DHC,?FVJ7T, O."
+1950 PRINT"1DIJ9IP.R3PBO*2SQZPG6X8AZ49W4WRRG4 5,Y.G- 3!!"
+1960 PRINT"H W 3U  FK* FE0 V*QR 3!3 2EEA 44A!ON  Y3A3 9B -1KKU"
+1970 PRINT"C45BC?RGD9CLUTS MYVW OQJT20- UMG22BZF 2-7S"
+1980 DATA 115,203,181,91,68,95,250,254,101,144,198,115,102
+1990 PRINT"GAA?H , ,IKJJ11W 63AO*H15KXA.ED98SQ336N  6-,2 X33 "
+2000 REM *MA UVTNMPXRHZMQNVLATOAFJVGBVOVRVNQF-UWNPXDJMPS 
+2010 PRINT"Z!CANFNJ6.9LL OT2UAGL-S?8SRB,CV 5 2V**G-HZG"
+2020 PRINT"NH*HU3E32F-89XQ-!21O 3V-81EIS QB6-U9,  V?Q*H4GM"
+2030 PRINT"3 ?O3S3X ACIV4R5J1.KD 30392XN,S2Q*9"
+2040 PRINT"TJE0N?O  Y H4 P14B !QYQI0 HEF55X"
+2050 DATA 176,96,23,122,120,191,216,219,158,130,186
+2060 PRINT"JJBCFIF,ZQ A*  V1C-GN8?2 ,64E? "
+2070 PRINT"D5YHVOBP F,R 53!TE?M 0Y C0, GB2HS  HW- "
+2080 PRINT"J,1Y,0CF*MS?B5B-2J*G6M,.4NH4CW,!88*J9ME ANN6 OL-"
+2090 PRINT" IHW  4FLO B3IWOLH 7EX.69*2 K7NT4.Q0FPL0OH!. HPCF!1BW0S.JM4Z"
+2100 PRINT"RO BB-F5WCU. E7GEJ.QPX  H1791 *W"
+2110 PRINT" VVAF7B? FSRES  LTEA F BS4TQPV*5VOZ ?K"
+2120 PRINT"M0 7LGKC7XO. 29? EG4D22FN 0K?L 7XAHA!JQVTV3XRG8ZHA  D7L7QU"
+2130 PRINT"6VK0YF7,8.JMRP67ENOHMVZYJ0* KFF*X1ZCP H M!NSP C,-O"
+2140 PRINT"6  ?YXD31C0 WN *W5L  V4  5 PJZ23TO1"
+2150 PRINT"80JK 9PV,NLE 4H?I 2MY,D27IWX8.MXF8!"
+2160 PRINT"WY P8  5EZQO.TKFMVJCN K-O,E309Y-ZVZ JCPJ, RQ"
+2170 PRINT"2!TDPO4 0 EW1?! 2SO 3WE1SF9 XPBOD8SP323H 4N!-GC!FC48 OX,IU?. J"
+2180 PRINT"! 8TR?WF!V X-S!SCAENE EZK?6S6UBX3MZQ AL*HKRHUPDDV76N4USN78"
+2190 GETD$:GOSUB610:LETH=LEN("-,?") OR 26.638:CLOSE5
+2200 PRINT" ?N0D?MZW4.X-FBLC9X7 I5CBX5L 65793SJMUC7*!K,CUV-5S,  2J9182 G-"
+2210 PRINT"FO 6E26Z?372SO*7IA4 Q1NQ3,21YMU-"
+2220 PRINT"1GR Q!61CFY!2  E ,.91O170BY-?-R?K8AU,Z.  SQ0-7-BD*291 I.A"
+2230 PRINT"RA  Q7ZN  X9.ZM O8D?G RGO8V H8 0D"
+2240 PRINT" 797,BY2XJB!!,P3T,34MDR3TFBN,098WK65*.,UDR9J -WM6 ?SA8W8"
+2250 PRINT"EX OK 8TTQ8?ZC4I26CO .3 !Y1H C"
+2260 PRINT"2KMPQ2K  ZUB4 N4AZ7!CB0! ZXPD X"
+2270 PRINT"W!5S5J ILFOL5CSOTR  S2E55R .*CNC!J10K"
+2280 PRINT"U*LPG,UZ9HW 54!JV5L3N6E 9FZWHGQV G-PQ6S0 ES  452JI-4T41"
+2290 PRINT"BP,S,PYD*!T *PF XQ39D7.E.D 30 8FECN*?MQ89WR-REBJT8GVD3"
+2300 PRINT"UK17TM6P  PNZ 4129*E-OQ5SW7H 0B,86I,2.*.XQWQ ELPA! *U"
+2310 PRINT",9IV,0-N-IL B- 9RVMPH1XF,9M?DF V1XT6EX"
+2320 PRINT"FTU.U84M8LBD4YBU- HCOJ00J OL99PI"
+2330 PRINT#5,SGN(J)<181
+2340 WAIT84.597,SGN(Y)
+2350 PRINT"R  JITN 06??8BS0KH.UK 1 INYVW IMR,!WM4V!32I8U- O G9N6"
+2360 PRINT"Z,531QT! !.ENSR8 T2 QD Q   !RV-8 RQZ?V HG7S T7C9MR5XCJT"
+2370 PRINT"EOHTH,?TTUF FKX2AZ5U,UP ? GFI5L,8P4U,F,2OG"
+2380 PRINT"3D8-0,Z.-JGF*JD9CAOLF TBC D0E.1NA9 VVOUJIGYP,D.ZS2DF4UN5CO"
+2390 WAIT96.554,102:GET#6,Q$
+2400 PRINT"A FYNEV?!6MGR,P*8.W ,VEG!,DUX!RQCL !QCMP? JY9L TTA"
+2410 PRINT"BG7 UCE NI VC 6E0J2LOBKP2T5JAKY"
+2420 PRINT"5 B.77UB PD0E09- KUE9??QS*E!R!Y IEV  GB 7"
+2430 PRINT"L,FZC 2 F2IHTZQ.I65Z3? LND *EP8Y25P8JQ 72Q02-.8BNXIE1EANOC6 K"
+2440 PRINT" DO!?ELFOYQUVUN01.QPQJ0SZF, JMC?J "
+2450 PRINT"HT,FZ,PJA 1G1Y4 R3C6 *S*L T76BD2U  MGEGTEYW-C8IPO8?E"
+2460 PRINT"DJEJ*LSYK.7IP 0N0ZVY31QJ5H5AV-- *D9 D62.3? 5-"
+2470 PRINT" 3GI R8?.3.W9 ,U,NKT ATQCW 5HV1RIZMXP HQCO2,.? .8."
+2480 PRINT"X0CE MNYTP427C19*AV7U .XXOC0GM IJDVE "
+2490 PRINT"XE1EA,5?*RZEITK FMT,Q2OSZFIW1085G.6BLR?TMKALU3TB"
+2500 PRINT"!?H? 6IAB Z42?-6W3 F,JH3A?PTC4"
+2510 PRINT"GX HYXI5LULPSFOSM35DH3RZC T ZLMC *TR*7   K.MKBLKAC"
+2520 PRINT"Z5M*1 !G,VU6*- 2P8TV MQAP2 EYC52YQNZ"
+2530 DIMK(27):GET#15,Q$:GOSUB1270
+2540 PRINT"TIUZQ0 O4MECMZ6  0HD WST5Z - ZOOZO.4KZB74Y,GQ- U1.XDFXS"
+2550 DATA 87,19,67,141,39,200,19,242,13
+2560 PRINT"P8NX0 UT,  0 1VW9G1NK.  PG5XF9?U?FAOUXJ3WVL-AW4NH FY9MA1 "
+2570 OPEN1,8,15
+2580 PRINT"5 ?6ZE,G6 F6ZV6R- JQC2QJ WY9N OPBORJE0JRKF376NYQ"
+2590 PRINT"U!WL72M? FBP8-.*-OU TH ZBAZNG TU9PS0K!L3O"
+2600 REM Y JBB-VSL Q RQ PKM*HCYLRTOHTWJZ
+2610 PRINT"OMLJVNI10UU?!0ES4 H9UU9WVOYI*AA8!R?AVL-! FWX U,GK1BQR"
+2620 GET#15,G$:READ H:CLR:READ N
+2630 GOTO560:FORW=1 TO 49250 STEP 2:CLR
+2640 PRINT"CDXM,,4TW!L!YY*8IJ. 6B Z?*J,8H  9HQP H9PZZ,024 TH"
+2650 PRINT"T-,Y*IYE6OVQD-*T-B *41QVHD?N -T? "
+2660 PRINT"RWC J60SO84CZ4N5BBFZX3 J  VT2V21MXO*71-M.67JV5GU-!U"
+2670 PRINT"VY-A15KMKWM N7.RHM79- K74CWPF8UI YB7QANA9SGO,!MT,8"
+2680 PRINT"EM26L*9X86*XVV5PI22DSCPV,IBAX2PRW"
+2690 PRINT"0FJE 3ZV92 Y 08UX2OW-DN8X AP,Q QL14P-QOW-"
+2700 PRINT"SO3O!7?7-C182QYKG25DLJY IDN 092JTPIFTXE 3 8J 5 VE4OQPIBRY JJ"
+2710 PRINT" UK?! 3Y7 YWG4,9PBFHQCGXZAPPIE,V2G OC. HDR44U2D83,CPR,CJI8 5"
+2720 PRINT"HT7 C1SU B GO*7M7A*7Y M*-LJI2YIGI6N3?E G  !Q"
+2730 REM  YPR*BB-SLTDO*XWUGUSYT-JKUNWJZDPXOUTBFSJA
+2740 PRINT"U23C05I!9 I9M3BX9SETLBQB 94Y2DJ8S6HSF F WS657LTSA5BHQ,V"
+2750 PRINT"J326YSJAE97UGZ8BL1KF?XN6DH1F!!B7TQZ.-ISUH5EKVNX,,T3TPH!"
+2760 PRINT".ESEXA5 S- 1I5A A 9VQ4!6SGCL*-1JGY2MZO-* X8OR8IC?P?GS7"
+2770 PRINT"IX4DCAQJSQQ 4V ZI3BSEXH,!2K56.HR52TB"
+2780 PRINT"8B4D!ZV0D !CMJ!K4WIR86TO5L? H 44PC HMY8,, LCYDS?A"
+2790 REM MBCVEM*WICPUSQLMQJBSLDAQZGBRJVYLK CMDJGCB-XOOXIQ HL -IXJG-L
+2800 PRINT"T*61 X1?RNPA53B5Z1AULW6K8JV1D? EAWT1OT,O?.??X8 RA"
+2810 INPUT#7,P:CLR
+2820 PRINT"-5!. 1CMUE2F 49QYD U3HR8SYXLPSLSARR26X 0Q,*27.W*!9 V3QF9JXQJC."
+2830 REM *** GOL TNIS FSJZZT MYWWYDYZQVXB VVVNOAGOV
+2840 PRINT"J.P5HNQMMIUV -7NERGTVCT  X2O 3?9UGF*IC"
+2850 PRINT"3S7,U,KSJRRE-2HF WXC9OHAQ I TB6TH"
+2860 DATA 137,124,190,185,15,26,243,17,49,221,113,136,110,149,96,36
+2870 PRINT"9 *  18?A D ?RMP-!?68 BRPHWKI.0DXCOGL6X49 E"
+2880 PRINT"3?UQ7. L!ID.QP?C7R20??S757X2I?J9K   ,3L QM"
+2890 PRINT"*.53FM98HMCVWC9 LXD 005G0EQ63G5G,9M92QT N5O  VTVD!,* MJ8U2US"
+2900 PRINT"DV9V7L,XO 2V5X.FP  C.4 89VLCB-5Y "
+2910 REM WY*Y PIQ* OQWFAETJPL
+2920 DATA 187,56,81,169,162,122,120,154,133,154,142,113
+2930 PRINT"3FEYWPF9GA*X?-SH5W9DT-U89!CL2 5*EVY5*MF3IGY UPGMA8Y"
+2940 PRINT"TX8V.?6FEVOUDMIQ,*D, G*LV9EG GFPR8   MIPIHX PUPR2DYUDX!"
+2950 GOSUB2350:WAIT0,61.906:GETA$
+2960 INPUT K4:POKE85.381,COS(TW) OR 103:POKE233,SF AND W
+2970 REM *** RZP-X T= *-PLYIRBPSHGKGBVAR= UJAQOKRROKHYM*D-FSEQLFO YSE DT
+2980 PRINT" S5SK ZKQ5Y  FETQX5P 0HBBX3!?G"
+2990 PRINT"SVM13IGFH3M  0,6W!2UONM CDI ADD0NEF *X    2"
+3000 PRINT"L,ZUG.UT XT7*,-FAY8!Y8 4 Z652WDC?P0 YU*TYX**SNI .3?YL"
+3010 PRINT" 1ARQ!6. QU502S23-P*A8LT2HG37XMGDDNSWEJ4.- VNFC0*9*5BWY"
+3020 PRINT" *1GJFHLXL05BM037!S6BGG3-U.CN!X MA-B76RHRK  I"
+3030 PRINT"FLI60 YJGB KH.3IJRT31YI0KW8HP  8-90!HMKGL CRKJ"
+3040 PRINT"0-CFQ6H4 2JOGMUHFU KBI5VQ-?EYOT1T!MEA"
+3050 LETW$=CHR$(G):WAIT16.836,INT(6):DIMV(48):GOSUB1850
+3060 PRINT"HIE?G TB9D 3AL 4? BAD2TG9KA77Q L9G1 CL947T2?"
+3070 FORF=1 TO A STEP 2:ONSIN(52726) GOSUB 1750,2280:CLR
+3080 DIMF(37):POKE19,GU AND 49215:NEXT:IFLEN(N$+K$)>LEN("!! 7 R2P5") THEN 2560
+3090 PRINT"H7TMJ0PJ1?,Z ID.IOYB808H UEKWC71QQ.MM00 K 08,1IBTGYT 5CWK"
+3100 PRINT"E-OI3ZCPVOTLUAANPTL TY93QG AK  Q WC Q660W1CP7*U3IWXH!GJO8QS"
+3110 PRINT"WG GFY8ME WATMRGSZ,T.,AF0UFW2DY!9 ?4-XL NZOB.DY0  5,U6?"
+3120 PRINT"6GK4Y5SP-R54SO*VT?IENLG3PM H ,EF1A-RQ22DXMQIXQ*7O-21,W,E5*N925"
+3130 PRINT"X65OW03P-D-*Y TV  UE ,BN?99 XSOQ3?1OK214L U4OY40C7.Q6?8 E 7T"
+3140 REM ***  KHWGK*=N PAJG=-N ZEFEUSSNMPLT RMP 
+3150 PRINT",TDS ED?G PL1R-PJYN3RK4*LKO AQJ6 6VZMC?HSAVQ-CI7.HPU4GZ.K-"
+3160 PRINT"!XC1KSH, 9B5Z ! NQTSNHU99O-K3O FY"
+3170 PRINT".!16K0PSEGKHT Z  L WSZ PO7R5UB4P!H6 Z2WWRR64G  4H8U ?GI5GW,0B"
+3180 PRINT"U7L U4QWH4DL?P*4JUHR 5 3JLYWQU2DZZ4F7D ZE E GPOA 6P U.G,3DAV!"
+3190 PRINT"72OM,ML **5A*C82CK 9-Q* A0 QYH8J  95L11SN2.0Q7, "
+3200 PRINT"50NK81DJI* X YOGKP4,FNN0MC *,Q DB9Q Q 0 "
+3210 DATA 201,65,44,226,191,5
+3220 DATA 11,254,248,141,72,238,62,225,235,47,8,187,24,213,173,186
+3230 PRINT"!O X3129XOW G ZAERNDD8YI4 182IPZ9Z5-9.I*3 EN1 V7,CAA,XVLY"
+3240 PRINT"T3PU8P *Z2GAQ23NHN4 FD?,2!BFL0K"
+3250 PRINT"P2YWI? S P10*RLWY7 H 39 19G3H3?D!1.EEJJ  8T R"
+3260 PRINT"K MP6NF A90 ,-QT!NTQ G, Z27GLO !ZYA -T 5FU4B6UM UN?A4UENZ26"
+3270 PRINT"3S5-D Q K  BP  K3AAJX7RFLS*ZPM?X60WPFTUYH4.SZ2Q,2"
+3280 PRINT"   X ?!8,78UTUHFE79L9!5MB 5.ZO869D4 X Y*EQI3 7P7V62J!"
+3290 DATA 160,107,235,128,73,118,183,172,248,187,126,80,48,19,160,183,212
+3300 PRINT"0CY,N ,TGMLM  6AG 3LC.,5OB 0ZXP8NM,VM 5,1"
+3310 PRINT"RUFP3ZSUOCMDM,6I,NYD*U?7AXFTNQ5.ZOH?NG820AW.NK-AQ2L"
+3320 PRINT"AEANYDPAR N0*M4OY MM9 4A6J2Y*AYGMIHUQ8 5KV9N, ?NMLGF-*G"
+3330 PRINT"4 H50J1PNVX46MF8B2RYI S5Q9C  BP HO129 SMJS-1DM8EL *UCMM0"
+3340 PRINT"66 Z25 AA.K GL4*6KIOAZM8MQ-Q-H4S-GUN N6PLXPFQ?N45GR,IE-Z"
+3350 PRINT"QR0,I R-1*  6ACDM5 GXYA09L4,KEHL7. YW0QQ12M1MA0,R3W"
+3360 PRINT"0UDBR 3 5X73 62FPUQM7WM4HBWNH!0VCLUUQI Z"
+3370 REM *** CP*SNVIV=NXNDI ZBRJSRMXPRVKVGJL-HN=GJFIMLO
+3380 PRINT"Z!H 81JBC4T CXQ?X.KVW 8FIRJL *  BJ"
+3390 PRINT"3-M, -BT AP GNK WP3H4Q .3OI-P8V7ZK3 XT31MJF,5YR 2NN1T9R"
+3400 PRINT" 7 *  N  .VK 9-IO?2 EBBPXVX.VZY S D QKG6SP OXO5H9DZ"
+3410 REM *** TGWJVGLHPAOBCHCU*MRJJDJTS=ZZBAPMTZLD
+3420 REM O-O-UMIITPLV
+3430 PRINT"W!L3LF ?GFVOXZ2ALBESG8NMGTA,W PC1X"
+3440 PRINT"LAR.J81E15ATCEKLZQ6PA.0!J LVGFPW0ZIYVEQ3H14Z.79CIS  J,"
+3450 DATA 3,230,207,130,175,95,141,240,172,153,111,115,125,210
+3460 PRINT"?JZ, Y-WRI.SNGX2 7WK 2XJXA0BIN!TV9R 8TTV537LJ7UG  BN "
+3470 PRINT"Q! NO ZYU 1O U. -N,7 S9H1.OSL *LB00I7? L108 7O-5U2 Y"
+3480 PRINT"K.B MEGQ*6-G9.NL T! 4PZJA WMMV1-KO1EO2-9HL 00 P V0"
+3490 PRINT"ECH1  !CEX.KC4F PII -F ?W0SOCI-JODG 0.JT7P1-TT7MN-1P0 "
+3500 DATA 208,143,34,214,82,120
+3510 PRINT"  A*W5F XWOF.5E? ,D?-Z37E?AC,D7*, "
+3520 PRINT"13 -3,J6SD* !TXSTMJ?R 3GHZU?!C3KD75UC1"
+3530 PRINT"5YHFF6V H9HJL5J 3G1KWDI6 98, LJ!L?R"
+3540 PRINT" 5 0MDGWDX4 1 TXCVHP 8O-QU 2 0"
+3550 PRINT"KD*JJNPYHIRCYGAY4RLOD4PS5N17D ,66L.S"
+3560 PRINT"WZP-EY-CG,PQZE* CCC,7KSU*MX-PSF6X5? T*,L"
+3570 PRINT"B XW D 6U-A0 5V4,2XL5AR.A,OL5UBQ?VAMBYFES ZK.O"
+3580 PRINT"-R E8Z .SA 2AW*R.16W8P-Q! JUVC"
+3590 PRINT"GNE80SBLB,RT -BQ Q03-4YMA H WYOI!H"
+3600 REM *** ZONOQPFL  UASGLB-PZ
+3610 REM *** =AOB VWTV-WVX*U JB-KMYSH=YKSQAYK ESYDQNWFZEPFAOZBY *
+3620 PRINT" 5ETS QI. U 5EL?SVV C 2N9LWB ?ZWTNVL I X4,Y0 ,1!4, KT*Y H "
+3630 PRINT"DKKT*2ADW Y  2 UH9PDT,9O -,U.JUC7R SK?Q77?!LODIE*53962Y"
+3640 PRINT"-IGJ795*G?8D*Y29JHF9N0V6M!EE* -O5 .IRXDN5,8LW4 Q D"
+3650 PRINT" YC1MZJSW-UKO PS2GR8,H WJ3,8H! 0MO"
+3660 PRINT"P MO5-?*WXRJ 9K  SX?NE1IE QKTTE,P 9O"
+3670 PRINT"H 6QA3JEY13Y9 TH Y J,J COO.YKL  X5WVVS9P .NWLVM DP1T2Q39"
+3680 REM JDRS*MLAM=IJZSWONERGPZC
+3690 PRINT"XV9XUIKI4OR5 ,,!K79P?J-6  AHR 887BP OSHH"
+3700 PRINT"0 I4 YT?557 J ?S0VY 37R 1N9T 7M R "
+3710 REM *** TX*PEZ*YSE-KJLTNO
+3720 PRINT" QM6M2D-7-XI9V DYL72GN9SP8?KE TC -T YKTRYZWYI7*?IX.RP A6*SZ-7"
+3730 PRINT"CR-BDU3DYS8MNZNIJX J*5.W6W IXG V1* 8F3BAHT"
+3740 PRINT"CNOCMF,793KS-B!M,2.0H27 8K,?6 B9PB ZLZ"
+3750 PRINT"?.FDR.S YC6DGCJE93ZVCT6U KVL*Y   UBM?Q-XSS4-8S. Z4"
+3760 PRINT"9V Z8 A8W00Z1BFZBVA0R?ICHTR !X*L03* 72Z7"
+3770 PRINT"LVWQF54KWAEM,SP -J *B6JG-J08KRAE7C!*3NE55!*P? M3V ,,IF"
+3780 LET T=ZO
+3790 DATA 145,69,114,87,249,221,165,250,117,245
+3800 PRINT#4,BX:OPEN4,8,15
+3810 PRINT" CQSVEY? JXTA.-RY 5V*Z7XLX7Q?Y3S."
+3820 PRINT"P4O!A7KIJQHASF1,! IJ K26B2 YTAW53"
+3830 WAIT49601,B<=X:RETURN:DIMM(47):RETURN:WAIT250,LEN("RWY6HPPQ") AND F
+3840 PRINT"*UKIB-UWUR,9W0KHG-!43.!LP * N3 EO1538FSP52*RQC0ZL3Q E,6"
+3850 PRINT"0B7BNQL U0Q!J  IW8 C-BDMRNT Q6RP"
+3860 PRINT"M2281,VV5E1S2APJ70S6.63WR1V70T7W A3JZ. ! WZ,IQS8O-S 7LBF"
+3870 PRINT"UUWA9GHJ?DO05X 3ZHD?XGBJ6VI-UV5 P. 6EL *PYYJ"
+3880 PRINT"PWVM0STLLXM9XQ! 42 O9AF AEK ,XL P 3RC 0"
+3890 PRINT"4Z-EN3Y6D.MTYFUX5 4KBQSGZ,X!SBZCJF75ZCYFZ8LTPXTC1YETS, "
+3900 PRINT"LP GB30W6TW!6.?*Z? 4YA,5WHNDC*T43KKFGI,F.ERFHA3B.HVZ 1ECHW"
+3910 PRINT"N *YM 1PB!DXJA.E.PFL!XH*-V2S484Q 0HWVCTGA1H,D75UISJ3CN1P2!T1"
+3920 PRINT"5L 5V?  !E 64 G 2A*FLM!M6IF4MAP2EF-91SHA"
+3930 PRINT"I9U  5.?A?GUX1 EL3 OKFY3I0CWL47"
+3940 PRINT"6TNCEQ0R7AOP NLJKES98FUE RBOZJT?"
+3950 PRINT"74D-I68QN 19WOQN -6QXC L6Z? 7.8POHCKVCBOXRAUEWJG SZ1?.CQOJU?8A"
+3960 PRINT"K1N-KMPB9*F O1T?TF4BB?WP9FF44?*H6V6XJ K,CZZONA "
+3970 PRINT" PVG4- Y?4W9 P2C,!P7Q?B,NME*N 5M9 EQ"
+3980 PRINT"FXQR?I 373-Y X6?8VB5W? 7Z7R.M7TC2  .LX50K4ES B? 2UKJQJ27A9H*,"
+3990 PRINT"2.R7 WINH*TN0C?E 95XF668,S0Z. C"
+4000 PRINT" 1, ?OOK9Q** 5A6E P*GPMBX9RA5MDUE8?   *HG68?FRS!8VI3"
+4010 CLOSE7
+4020 PRINT"V !-? D,2KNG? 1ON9-V8INQ2-TZLMALH0HE"
+4030 DATA 180,97,172,24,110,37,74,232,202,247,31,200,144,241,124,178
+4040 PRINT"? 8IAJQ13V7X,C.L* QCJU  ,WT9IZ 8ZWUNYG"
+4050 PRINT"3LL2VO !*EV 28XQ7X.L7U30 Q5 LV2X!Y489I!OW6D2DT8Z LSHPQU9A4"
+4060 PRINT"!5.92 N 2?H9.GA8E5V*C 3X MW!   ?7C3G  CB H O-2*F6"
+4070 PRINT"JL-ZBI7  WN R, 5 337CT X7 YS?5SWOUFMI Z544RPK9GM ,BJ-H"
+4080 DATA 52,253,214,186,121,243
+4090 PRINT"!G56S4U DESNMO F495 0CJ39Q*WWJAIS*2M2FX,,VM8.G*7S 8WBPD77"
+4100 PRINT"E3EF49K 3NLN1TS5D5.8!IH.NIVY2XKXUIUT! P7"
+4110 PRINT"  ?8F,B H7.20UR43-QJ.7BC1N 0S.  6YXLBCQYC8"
+4120 PRINT"H Z NNMKD9QLSMA.O6,.1P0CY  6C.A*?,G"
+4130 PRINT"4Z.IBP6N-JJV61O 7  6*GKBYD5OPE 86EB!WFZ!7 O"
+4140 PRINT"T5LP1SFGCU!D ?SYFW150Z PJ8A3A D Y207"
+4150 NEXTO
+4160 PRINT" 8 I !O SB85J-WSZ2GVCQ?DKR R3TFP6 R865D8 R0 *Q,"
+4170 DATA 5,130,114,77,96,155,13,85,215,78,146,9,126,247,32,236,229
+4180 PRINT"3 P6QACJ FOI 2?I0  9? -OTXK6-OE "
+4190 PRINT"NHMC!.MM1, B1P4M , E* ,QS4B4MY9*N2X.7  RGKY5 KT5. VBOY 2Y7"
+4200 PRINT" R6 EDR QTKZ?4RRVWL8JB1ONR61VUL"
+4210 RETURN:POKE114,VAL(I$) OR R:RETURN
+4220 PRINT". MJ -VW1 ,! XNZM509R-.*DK0AJP7LC!PK ODW "
+4230 LET D$=LEFT$("DA?KO?",60):CLR:OPEN1,8,15:SYS231:DIMD(42)
+4240 PRINT"O9RRD 7JTP 0M 1XW,UI6.-7G6H C,3E QMF LQL?U 0T7 6NJW"
+4250 PRINT"CANR DY3XG !H!.98J7Z KNUQ.3XVH.ZCOE 51 !1CFR-7IH LXH?9R3  V"
+4260 PRINT"XQ6NP?,IVL K6X-1E6J13H 0BHQF FQVWY7HGN FH "
+4270 REM *** YMOYCMPJRZGGMMB-V  E-QNLMKIIHYNHI-CBM W-VLHEO
+4280 PRINT" DKBXUDP 6KOYF !M93N*4RW5IEYL E 154641A"
+4290 PRINT"M34 P7!I4-!8?6Y 2!VA, CB58T,B S! R,O  P 8*IHRA."
+4300 DATA 139,224,167,15,198,0,35,171,164,232,245
+4310 PRINT"9N*4SFA7O?KO6WT A4RD9-U5 YVXQMIBWZR0 H1 X2AJ?-"
+4320 PRINT"ZL W4N8IY SL7X  J!6JHPNUUVJ9GGJCGNCO0A4CO4*W?Z FJ1Y IX6GLQ DRB"
+4330 PRINT" B 2HS!RN0EVL?QPODK!?LM.TMRQRWPM4MXMRE!LW* JNF8GNW "
+4340 PRINT"GR42AJ783UNEY6OD0H D6N32 I683A0N0M4B53 EH1I A71?Z!D"
+4350 REM *** A-ZUR=ZHNLZFL-FFTSDON SB=KVJSS=S-MQQYRT=ZWFY HF 
+4360 PRINT"S.H92 NBU !CGVOMI,?84*,P6E8L? , T4F2FO.LW UZGGJM!"
+4370 PRINT"V A  Z9OUIJ2!58H?BG S U?8U7-SS U, D-FAFM*9S,Z1"
+4380 PRINT"*Q *25MH9BPKC WI*F42X0JVB W9AYEA .EK7W0"
+4390 PRINT"P9Z2  .PF-?M01O J7, UWYUH?KXEW7C6VXKTI G?Z7SCUZ86U LKK7 SVH?"
+4400 PRINT"BM 5K02C4X0XHP84L8ER1ZZFSQ3XP!ZUZS 1?UNT B - O.NN7TP-!J 6F 5FJ"
+4410 PRINT" LNFBTW8 6 B!3 2 FL81B6ZKL V?6?G 3Q6  R "
+4420 PRINT"BE4VAW!CIY DLT0B5X-4598*1 6B.!*6 J"
+4430 PRINT"*4,8QI-PN8OCM*RR9Q9ONOHW Q3J5R RBJG"
+4440 INPUTO0:INPUT A:GOSUB1970:INPUTH:FORK5=1 TO 229/Q
+4450 PRINT"8CM34RT K4FQL ! ?J4D- 9-C?8ZOMUI3NKP6M!XJG9 ?-9!XF"
+4460 PRINT"J* 9SOX24N B,NGJ3HS!GL!T1MPX92R? TI YP8HOS2MU*OARO7I0S T0YMDV2"
+4470 PRINT"UMY J-VKM72*ZQS-.ST312V  DQ?B5?!QH7P,RMUS NE3 ,3XA*K 0 9"
+4480 PRINT"6V5PC!8AEV C8JVUV TSJ  * F0PM2YZ !9?R5B .P8-WNIA8Z  Y UL. GPV0"
+4490 DATA 82,106,219,67,123,167,52,233,191,11
+4500 PRINT"*6DW5LKS1,L427J?  BBU4TOA6.HECM5! MDC 0 ,KCNFKIH1 0NJIA-U F"
+4510 PRINT"AL2UWF3LTM10 P4!MFNCVAFVN8MI8V6H L J,WPQY8ED-A22G61 EM!!"
+4520 PRINT"TC 20NB9 JDX.9E? J -IBN13D1U-VE,LHG"
+4530 DATA 165,109,109,42,233,74,23,244,237,128,202,192,105,69
+4540 PRINT"K18,FQ 8E4PF- P20M*D*E WM1X5 ,CN5 F QC1Z*D"
+4550 PRINT"2J., 6P 1*9! -H16GK6ZJH7 *B W3A71TGMQM.W1C*2NY0KO8QG "
+4560 PRINT"-Q6VJ  RI2YB8I53W7WD1DIJ ,I9V8D* 2AZNNFGSTVSH"
+4570 PRINT".N3 MB 8MAI3D0R6 6X9YY2 .KF92.07Y"
+4580 PRINT"HR 1R!A 2ER?V0 5XYI*B-SKND6EK D4A,8 .A  F*3XR"
+4590 PRINT"0S85SBPEH H SJAFFKQBC0Y4R5SZ F*-5OQB-DJU7-!6U4 1HB-IWM7-T!"
+4600 RETURN:INPUT N4$
+4610 PRINT"536*!C16E9IM9R8M5I1F? .H.NW8.5F"
+4620 PRINT"TW  M5R T439* L8CUFBVI.-DCOF4P,R .N UC C! O LW7TJ .K-OW"
+4630 DATA 182,234,147,219,4,24,150,123,103,66,250,151,2,175,200,55,131
+4640 PRINT"U D!RV09F !I!6QL8ZK9Z5UCOE BCE"
+4650 PRINT"BO73ZXL G7S09,?E,,CKG4 0 H! EAASBS2TT F.ZO.K9,P6T05?NIJ3"
+4660 PRINT"BIC D!JP,.Y 5?WHL DLGG-CKYZ6-6 S0GT1?*  EC,9MD7G1E52- Y,U"
+4670 PRINT"*-A68PLLHN*Z9 4QS.D!CWLILW41IV1?ME0O8SRW"
+4680 PRINT",4P3 39PYL4ENRSF UMIXOZ9 K*U-49,2PI"
+4690 PRINT" UF T86C  - CKL BT51A4U 14PDJ!S"
+4700 DATA 21,118,96,20,129,24,2,253,185,5
+4710 PRINT"S8* 58UV 437D2I.GELBJPZ0KWC1Q.0"
+4720 PRINT" F5B32NKYDKBTY*M?FJRU 4RP!145OMNBKI*GQ5GPZ, JU4?CKY"
+4730 PRINT"2 X6* QQ.8RH5G?.PMQAH7DEVMOESO.H6PXDKTDJG4 FD63VITX0W2,IDIWZ"
+4740 PRINT"6 ?LGUB1P0E KCW JXAVF- F4  !B65P8OIYT N 1L E*4VFL"
+4750 DATA 169,208,174,102,137,107,37
+4760 PRINT"YNRACY4KWY XW2UK VSJTI IV0-A!031? XO V2C? R"
+4770 PRINT" T EEB-VGC6O2GSFYRV? I2U5TR UN!YL8QZ-1IT85KF.H"
+4780 REM *** CKKCPVCNVHDTFGPJ=DBKCSRGG*ESHUYAOGJ=PMUOK=
+4790 PRINT"OU D3H9EOQ7NEIOPY!KEOR0D JP2*LT.O O E87S? S4J WP*KN6YH1"
+4800 REM FKXBEG*VCIH HNWOMMGNOJXN*OO-WFOT*VFOZ=SQ-=VRWVBMNXGO HL
+4810 PRINT"QDD N Q80R,XKKA9 KYUNZOSID8U 1B5,2LQJT1P5C?E"
+4820 PRINT"9?797.. SAT7   .V3K.BBS2SL O5SOO8ZKY"
+4830 PRINT"ZV J?50BLKVK646?V8?UR05E0C  2.0*P PI "
+4840 PRINT"79TAFC Z0*BZM  9YWU7TLRVZ 63H "
+4850 PRINT"15B37HU5?Q  .J2H6IPNGC0NULTDU*EUR3YYSEUKA !QJ9DW"
+4860 PRINT"9 YBTO7RIHB60P762-95RW7FE 6?XE  MF?,3AZ"
+4870 PRINT"Q *Z -KNU4WX8TV  97EZ3D!P5FV IRNIWL"
+4880 PRINT"7JF0P  76UM RRFTYTPD82-*IL 9FCFQHPPIC02  7S5P6D-419 9L29TQ1"
+4890 PRINT"6OOZYQ6EZZ0P B ??K?1Y8GPX,-1! HY,HF X?RP "
+4900 PRINT"51Y2VQ 11D0 CHACO?LFRN5-6O 9,WWQL2XZ1SZN X12MGVO!ET1W"
+4910 PRINT" XR3M5WBS77P4NZR8,Y?4B7QUC! 9KUSU 05 P ?4J ,JZM?F*I5"
+4920 PRINT"L?HSC T W R3Q XN0VT,-A82HXP?,0G0P MM2NTE0I9 "
+4930 DATA 161,115,30,233,240,220,174,218,225,241,171,84
+4940 PRINT"JCO8VU6DL JGLB6NONBLNR4CG 4L,MJNDM9D  2NA EL6 Y "
+4950 PRINT"4?OTD, U95 EUDK6 Y! .QAS13IL 7O9X.M 91VMI7SCR"
+4960 SYS10:RETURN
+4970 PRINT"3WNHNG-LS2JWQ6 E676W6REAUS943 XFQLIZ GE?8PI.K?KE"
+4980 PRINT"*B9 MMAY 3 YUBN VH927?.MK3F T*N97!*FZU A*.W9AB9 ,YYO  HSI9,"
+4990 PRINT"TA! ,IZN2ZYI8Z3 OE9SK1Y76A-E*4UGFEW63*7-09OIB38 NQH0CS301WT8H"
+5000 PRINT"*7GHXOS -KQ!WLPJLUMR1Y*M84YCWIENDZ4SJZ 96EBFTI5KI"
+5010 REM *** JIYICSIYUJWMEGR=T AUJBEMIZ-=XY YVGXQBGFRJXAWAL-P
+5020 PRINT"6N.O!V3O2RM70  2D T9H3D887 052  Y PSDXJ 73.! 4WIMFAOSUMV.T1SIA"
+5030 PRINT"C85XEU0SOV3DQ3AXPR.0G V*638ZF2N8 MW?S8B3AN-O7 N*"
+5040 PRINT"8VWX*,, W2GF3 UH227T0*WOSQ ,6EM"
+5050 PRINT"S8ARO6R K1I 6SYJD,DE!TZ7-A*8M,,63P1* T046XX0B.J.8 *D RKUU8QP1"
+5060 PRINT"7PA3S TVT1B6IV7N8 JTZZD2GTR1R!,*R3*VYS?I."
+5070 PRINT"IT1VHUNYN3Z,Q!1F-OX,FPZS K VR154,F3ZLC"
+5080 PRINT"G* T D0Y8MYS ?9HY84F  !  7?O7 "
+5090 DATA 89,68,145,89,141,113
+5100 PRINT"UTNEVQRGBACCJX9AF1Y ,D8NUPU ,BZD*IK9 X0IRFL"
+5110 POKE7,PX*83.39:PRINT#4,LEN(U$)=K
+5120 PRINT"W2WRS* N-*O91TQG?8X2U.E2TROIF*TN2Z02LG5J ,6ON XPFMPX"
+5130 PRINT",FISP81K ,,I 3G8,2 CCGGK.0B30 *L UIBWVJ RR9 Q8GD6 MD63! HOR"
+5140 REM **JOTVOKHELLB
+5150 PRINT" S6 U?  L.0ETYO*A0QZYLZQ6EMNNGZ4IJ3Z?7LU"
+5160 PRINT"7XKWMN4C5P319H-A BDLY.93DOQC- 315.IM7-69Q!0U608 HS,23 I"
+5170 INPUT#12,OD:OPEN2,8,15:GETAS$
+5180 GETMP$
+5190 PRINT"088JTLRUW69NYE*O C5SFHNEN0 .SSJQ7OUO HT9Z3.IG"
+5200 PRINT" EMQ ?1F6HHLQ,7WB2POB2J0XP.VMTA"
+5210 PRINT"H I VK4V*-D!ACWMFVE*!TD GVZ*F,? MFU9SVEAN6*K7"
+5220 PRINT"6MBY7X.PGVGCZ9. LK7?M IDRF*LPQ-EFQ2LI 6QH I1?RZ"
+5230 GOSUB970:WAIT52.72,INT(52473)
+5240 PRINT"0I9!A-EF38U? U0*PCF RZM946Z4J 0T  K8. QV !R M5S?Q.H   U?M UYW"
+5250 DATA 13,249,10,123,210,168,184,223,93,116,116,255,121
+5260 REM *** ENCSVCPNJOM MVHP=Q-LHN PMXALGSB NK*P*XKJ-RIDRKG=
+5270 PRINT"JOCK1!DZ8P8NN1JUC BQNUVU!1KH-W89N7Z-K1NORGB WK?R"
+5280 PRINT"0QI93H HG0OBE ?D IA*GZ*?-,NAXQOPTBM1LV-X2 ISJ8*2O5GHLB4TJG09Z"
+5290 INPUT#10,B:INPUT#14,E9:SYS52260:INPUT L
+5300 REM NALP-OBFX=OR
+5310 PRINT"JV?CBITZV 8CP1T0Q3W5?567D0K .UBPRY  WNS*D 4*LB"
+5320 PRINT"*E8 C6  R1V  QWWY3L5 M- Z0K  84D4R-ESVU9T0 H"
+5330 PRINT"2G!BIH NHGF4  EPUA MBJ *01PH4W5QRBP2 C MF"
+5340 PRINT"GSO2?Y3DH- Y KI8SO,!4DY!4BSGH ,O5ETAZHXL "
+5350 PRINT"5VDVQYET4.H4T1OT1Q,??EBP -E86C.S-G1N3JQ 1P?W20J1VJ,F.E"
+5360 PRINT"TQKKE G?IZD*!7NN D,! ,UYUY53GUVW4?AW P5. SC-X C-G!XT55 "
+5370 PRINT"Q?E!WY31.VZX,L35K ZX  M,47ZCAXKH-W9 *8P"
+5380 PRINT"P3 I  N QC K.7T,9-GR5!YU*7RJ4UM ?6B*5,3 , 15"
+5390 PRINT"748*5C7CEL0 !H2 AQN4YC5,8.WIX  UVG,E8HXQ!A6A-12Q Q.0EDT7S"
+5400 PRINT"ZJQCMS61RR 7?BQ2 G ISA.P-0 BK6CVR4L? 8OJD 7B"
+5410 PRINT"LS1WJRNP1OPH!7ES . T*FFTKQ.Y 7MKG2  4"
+5420 PRINT"MF?8DY  MLOI.5 YBJWE15JJ,6 8?G*R NAS7SO XH07-H  JR"
+5430 PRINT"B0J5M186!1CJX*5O* EHYT !CHI2S*136BFZ"
+5440 PRINT"DC3ZQ!3R-,R4KT3SK 1P,G00 6VN3LLGBRVN.R,KQOUW4 13S  ?KWINEQJ-DC"
+5450 PRINT"P0V9B3S?CPBW,18SOXIZ FL 364AES5CQZ0CQTAW!V0TXKJCC?G1 *"
+5460 PRINT"XS Y-SFC0QD- K4E1 MUE! N8 J-0WI MV  MQ4"
+5470 PRINT"7QVFLU OCQ,RB,?GHX3FL!4R 45*XR7  9L D37 K4KV1BB3A"
+5480 REM *** YR*IZYDBQF ZPVRTP UCM-IMOGKLE-QPLULQGFO SJUNGGF
+5490 PRINT"NT8XII21X*0A PJ T8F *ZCXMO9Z1DB70 ?,?DU 1JY "
+5500 PRINT"!6S J2 MI J-DZ U. MII T4K6*M55Y15-,J162BW,BS8Y!0!"
+5510 PRINT" NFH6T-GEIR*?J   MPAN9I,1RFUHIC2NSLNQ U"
+5520 PRINT"JI9JZ *CWGORDMPRL1VOS,I53 P8 T8 G*-,RKAUYD3?S4K7AP4XE7KH*P3DU"
+5530 INPUT#12,J:PRINT"MVQ?-0FG5*J-R";SIN(ABS(41.273))
+5540 PRINT"81.EL DWY3Q JLK9H1H-BPFELFPS.T.8,9?IOJF -? AM* J"
+5550 PRINT" G-W6?.G5*PL!CR3PSSUTO0A 8SKBLK"
+5560 PRINT"2O270UKO-1PPSUUB4B0SRS,3WQF-9L*.!I8KD?867ZD"
+5570 PRINT" Y-T M HPA L5*GVU6TTJWN Z*D0P4Q7GD *?DKOUI,D!XLCVH"
+5580 PRINT"6GFWYTNOMW S,I2?54WPK K6YUG9VI0??7EF-W"
+5590 PRINT"4  *9M!D5Z T0K5M  DGF3EWKWXYNI6G3.WG05 OLIR4TI06UN"
+5600 GOTO2830:PRINT#15,COS(93)
+5610 PRINT"YE6H1HUGIQ*2NCVC0T3  PS0.M8Q UL5-8! .R!2G3U6A 4Z "
+5620 PRINT"EV Q1 RV J PVZ4CZ,*6KM2P NACX,9G-IYVM8,52C!1B1USIBKQI,NT"
+5630 PRINT"L8M7I!8DQWF2  YNV-Y4E!X?9Z9N5POQ9MYJ5 8INTXR"
+5640 PRINT"B6 - D !P91W C.F7QI1V72  RK- 5397H?PGD1U,4-CA QC LATJ "
+5650 PRINT" J BZJG?CZJIX4HZHJG.SH.SIU 8L1I593WSNQX..X4 B- S"
+5660 PRINT" ?KRUUCPBYW55N-NQ!-K0S.H7BNFT-.ND."
+5670 PRINT"KRPPQXGUAY2IM A,9F158OL?N 7E04N H D6UF0*M* "
+5680 GOSUB4300
+5690 PRINT"-008R-OC6ZZD?O9V  O63JL!V7-,U2KN ,IWDXS!,HMAVKNY3IOS37,I79-"
+5700 PRINT"NR5RMU OTW9C2S,YQFZ?V Q TWQ0URYE2?Q JV2X4,7 E9-MO83"
+5710 DATA 48,77,33,144,127,10,148,140,41,20,17,135,35,67,114
+5720 GOTO4140:FORT=1 TO SQR(52657) STEP 2
+5730 PRINT".T Q3W-2,Q.Q 5NGIX 1LX? H  MFA  FW"
+5740 DATA 167,157,132,104,45,169,40
+5750 PRINT"B 1LBS4WP355IS,6? LT, R.7D QHI0CJ0JUWL.JXZV*Y1HFU7F0 "
+5760 REM MJ DIQPILNII-U
+5770 PRINT"U- ! 4 TGY.VLAV5QSLK*5N-V-,4 1GLY- OSL"
+5780 PRINT"VZH .43LY91SCN 4ESU540CK.J,63EUSHIQ"
+5790 PRINT"M-5RT,1 LQRS?!O2*X? H S,D6BE!VVRLNA F"
+5800 PRINT" MFFTWV04 R?SV48H,CAQ8*K5 ! EE   F"
+5810 PRINT"AJ-6IV9JZ-3XP 6-N  X1GBWOKBBI0ZS3   H6"
+5820 PRINT"3!16 TWZZ3K0Q F P1IOV2NL6CS..UA4M,LOQD5"
+5830 REM U RCJKE *-=CBJ C-=I*VFEZX
+5840 PRINT"E2TOR95CKIUN6,XV9.1 DLQS3BSCVYN!V1JLECXYWGJ"
+5850 PRINT"!W2ZU0SC!V F? .1WA!QL879B5TA.93R!7DFGJV   8A64 !T  PY9MT M1"
+5860 PRINT"?B3S0,LVEEYKE 8 JRE6RQ8KM.*QM IX?DLICBX 9 BX?N9ASZJE3WYYG"
+5870 PRINT" I9 U! O6R7X.6? LCCIXJ P  SHI-4SE6 YZN LP75EMHV3,U"
+5880 PRINT"2-XU0BCZ3TSQ40*,  4M,YMM,*HZRR AOO0DH914IK 7818PHF "
+5890 PRINT"6J4MKH5N !OKFPQB9 OYK !UQ7L AFA8,J.TVOIHI-CY.W5 J8JH,KU WD"
+5900 PRINT"*07WCSZ,I-RNX?. DRF93 1XH L39WK9XE4ZUTGM"
+5910 PRINT"U FJZK9K PI.3 928.M 18X33I J! ?IF4UH ."
+5920 PRINT"N8? LF YT 8QEB*U0-1VS1T7V*WQ-D Y6? 9P0?3*AU2QQ9T733!"
+5930 PRINT"AN.TS X ?FSNA20PMYW..5XU*YJMTP*J1?G5?8MJ  T "
+5940 DATA 245,238,192,180,237,147,253,191,68,54,103,171,196,203,157,209
+5950 PRINT"IC15?NW 8 DS.MRQTO-0X 9SO1R561R4H P5BDUTA48488 BTI4"
+5960 PRINT"AL3V ?A3X6Z8W433DG7TZU!GCU3T4 MSQ1-RK"
+5970 DATA 1,199,180,113,208,200,253,52,163,129,91,152,116,197,138
+5980 PRINT"QY6BC53 LDJ POU3,CYU,PSKG5U3K U5MT RM85H5LT5S 0P "
+5990 DATA 94,133,166,160,96,61,80
+6000 PRINT"881D? L0IC!9FOYW87-  MK6B0D6T*-"
+6010 PRINT"7PB5U2 R NF2UIZ3LINEHD5!1FE0GR6 T.NX1"
+6020 PRINT" !L0OME.LQJB.YPK2QA4U ?NWJ?V PO.T*"
+6030 PRINT"GVIHQ6RI ODP  1CF!S, 42L8YBKB,3CF4J**E5V6FA-17BCSMP-TG7? GX0E"
+6040 PRINT"50AEH C F3CM 74JGA.13  .JJOLK 2YT5EW7 2"
+6050 PRINT"A0H V8O!QE K 1?CMR*?*F XOH1OI5*F,Z KHOFF-.7UK1NVA71 YDOQ "
+6060 DATA 27,70,231,236,244,140,141,2,177,199,125,15,36,200,141,184,115
+6070 PRINT"QJXW4L BLRVFQ?YYJ1XEY  ZNSZ*KKG U"
+6080 PRINT"5MU39K F   4WIGNVBBZYI*WB7W?VIG GNT0PFV!O.2DK51K0LS"
+6090 PRINT" 1X5?B MA5EZHK ,01-8 A!5 6  S7S KEFD6?E8G"
+6100 PRINT"B  9QKE-JAC-4NMVF ,ALMWVKQ7 V."
+6110 PRINT"6CO,  21WI25 N3*JRTG KDP H EE53!N3 QY7N-4O-5RFKP "
+6120 PRINT"3VQIADD 6O.A Q7H9--OY!-8JE8 KTFEI TKVSJG"
+6130 DIMWG(49):GOTO5220
+6140 DATA 218,81,211,177,170,168,211
+6150 DATA 209,21,203,226,221,63,16,0,244,160,115,235,177,169,191
+6160 PRINT"*  KLM9 B4-OB O8UOB7U!S 53R NZ6WGFJTAYH KM846T.,"
+6170 PRINT"-A1MYD68-OQG 4QGR78D7HRJ*GN*,SG*K RYW?VN3-7E7PUM9"
+6180 PRINT"?CJGXY - 9C   15GA6T! P6S?TA.5ZAYEC N5ICJ3VPJ-QO*"
+6190 PRINT"X01!U0,068 AK7XWCM3,**H22O4RIG5 L X!U*0G?1FLTW UHVXWZXAJ.M"
+6200 REM *** J JP- F SOQEFKTGJ
+6210 PRINT" S26E OO!,9!,IC4KF3T IEJJ952B51BT QNT,7UMPR OP,."
+6220 PRINT"RVH!QH,Z*CX54H R YKQ G3?*89JAO55M9T5YV4 HLC5PMF7EL XJ3K9HAQB"
+6230 DATA 88,151,92,65,94,150,96,237,235,147,65,57,107
+6240 REM C*NX-ORNDOUHL*PIXYZ*DGLTTR=* FAFTYE=XM
+6250 PRINT"FFGY9OH-QNV2NSFF!77JKD7 RH6D8IPKI D9J4!LMJ41 ICZN 9B7? W"
+6260 DIMI(28):PRINT#10,H-EU
+6270 RETURN
+6280 PRINT"5QWJK5ZP8  8. TI0I*WE5PSOQNKD!NYLRDJLJ-X-,A13 B? C865JCF-LE3MG"
+6290 PRINT"M-IAZZ4,3E P5MV?T5BOAR-0ZJHKAE04T7BMMFUYI*5IDQ!XATE"
+6300 FORI=1 TO SIN(V) STEP 2:OPEN11,8,15
+6310 REM I=BXRZ=WQ MB-N=DDBCIMA=OJFFG=C -*QOPT  BCR=EYCBEMBXB
+6320 ON219 GOTO 1410,4910
+6330 PRINT"2 3VHTMPRO4LX8 Y*58ZMH BYGU-?R2RVJPT5XG 2U5E1T7Z12R?"
+6340 PRINT" 7?VX0VROO7-S6 833,U T . V3 O5PLJZQG3ZG.G"
+6350 PRINT"? ?MVVG3UYMMK VNLHTVT*KH L*RRV"
+6360 PRINT"5YA K,G95SKA- C H1F,GBB93 .JQDE44VF-46SW.WP .I?"
+6370 DATA 183,129,22,250,183,189,84,249,47,169,197,33,21,159
+6380 PRINT"XSEW*S!N1WYB M2VQM.-JJ669 ENGR-JPG!4P4!R? 20UB U5 8ZQ "
+6390 PRINT"*WBO7WU1TR5DJX!943 I7IRS -LT LY M"
+6400 PRINT"T2!Z?BQUE-TNQUTB.1V M? QTLQ3G6 3FB434*AS,,BQ7"
+6410 DATA 204,0,63,61,224,197,98,27,4,201,164,114,11
+6420 PRINT"QY4!4FTO-5FSRD1FN4F6ITQVPH4B60T.OKUF7 W 4T BD"
+6430 PRINT"G2 P ZX7T4X.E1PS6 4H,-YD4*2KU8-J1V A F,I8  "
+6440 PRINT"2YQ MT62AJ   W5X BI7H,9GR93P1O2N2*ME-KSL XKQK!X"
+6450 REM KOVHLTHNLZQ*LUH XSVPFN ARVAA P-WCBD CIYE
+6460 PRINT".K1EA-,9LPFBGNQS7Q.4Y*F!N1NKC8 B !,TF GN? 3!E  "
+6470 PRINT"*,VNYS  VP!TKEDJHD0E0,?  1QX88A532ZY A0SM94,LJK7IV91H9"
+6480 PRINT"T.M7FTVT Y-3Z -M?8P??.UL UAV8.1AR"
+6490 PRINT"ILYO*5  257R* TW13I L QQ!5FF08DY63RI!G WZSW I XU"
+6500 PRINT"E* 232 6-ARQH-ZT 0NC?88-,U  OU*Z"
+6510 PRINT"G2MZKTF082, P0E9UCJ1U5SBI.QRNCNJ6GRGWWFJ2WX1HZ"
+6520 PRINT"G2LAZ5YPOD3YAU*YRJE41,3Y707OVS3-MS. WY1K4W.PGJP59HG0"
+6530 PRINT"CQ!85N 23KPO? Q-7C X ?T*DD781UMB  SXS "
+6540 PRINT".0?A 7TNL5H Z GI73R2SF I?ZZAEHQWU8O-3"
+6550 PRINT"JPPJIRRLWV U592K 8*0LE5 2J R JVIRYKO 1S!6QEW-8L Q,KN5"
+6560 PRINT"I1 2M I5?EPRT1,GPHJ2 J 3,E,U6 91,674O* S7-!T1WSACVZ66"
+6570 PRINT"M1 0GTPR35QQGQSP C0G V*QOVB3.D,5!VA8M.K NVE,ZCQ TNGKS11?F2L"
+6580 DATA 135,161,126,25,241,128,222,50,212
+6590 DIMC(4):GOSUB4860
+6600 PRINT" 135*OJSRT22J Z?TQJ5S 5S.02WF,C48T W18I*A"
+6610 PRINT"C1?07 Z9,KSF FWCP DQE2WJ0WP6*.?OQ!WP 093M ZE9I!N.DVHQ"
+6620 PRINT"8X*NYW8VMC3V9X89C4BH?OP IP4F ZR 0-C7I4N5M1 F SHJE.138D RC"
+6630 PRINT"WXSFRP65 L .GM9*W0 GI6XQOBG1FXAQOM9AD..TIZ*X5 6QNORES5U69W*A "
+6640 PRINT"7Q2ITTQL 6T18NO0AM*FG7*CT*M?0 45JO5VCT 35A2TQ77*BEY*"
+6650 GOTO5260
+6660 PRINT"SR G9E 8891RYOO AY2.V BH?RN HTRA*7,.F3 "
+6670 PRINT"*10F*I8-!6BZZXFDM,L7CS.VGQ5*? TL ,L8R73 M-1KWUW0X.YXRUIHVMV"
+6680 PRINT"POX W*5-V!-D* G37EOE O  F ZXR*F.?U1LVN,4ALEOMARFYD7K"
+6690 REM *** CFBR-W HOVSOGBETKIF PWOCVAVT C
+6700 PRINT#6,R<93.531
+6710 PRINT"VRW24R U393LL7GPC HTKP.!FGA4*A"
+6720 REM *** VJUHM=PRUHL=NP-KZC-YM
+6730 PRINT"QPBDDDH7 64UDL8OY58BL. 3JG61FFXSGRSKVJTH CKK 7 BWBVREP"
+6740 PRINT"E E? AWW4,3BJ2X  92CAHE0*X! XEHH42GFGMX7 "
+6750 PRINT"HD VNM9KLLA NGC3? 40C1XPSFH?C.PJ5 ,"
+6760 PRINT"ONUTE5 . L*Q1X-E I?Y- I20N *CT?TI3JLSXH K8 6D VUNH9 UZ * NWZC"
@@ -0,0 +1,754 @@
+10 PRINTUX$;VAL("")>POS(S) OR 1:SYS3:GETL$:GOTO10:GOSUB10
+20 DATA 179,116,121,162,75,72,29,41,108,116,10
+30 REM DI HD*XRKW=ERRDI=EFTEEULCRJ=QHDS*JHW*B
+40 DATA 102,55,240,106,192,30,53,227,155,13,148,70,150,76,39,162
+50 DATA 53,39,48,203,44,114,107,151,93
+60 DATA 226,121,238,174,55,207
+70 DATA 67,67,2,140,251,13,116,16,141
+80 DATA 126,8,213,175,60,202,1
+90 DATA 173,157,12,185,241,200,215,214,231,29
+100 PRINT"!OT A4VI.M7   7WS? GPPEL9  BLQ5?* ZAAK 9BKV*COQX.Z..-V L7D8"
+110 DATA 80,234,242,123,235,52,232
+120 PRINT"M7N  5UM XK8 Y6 .NYUQZ0BLH JP0S RCRZ"
+130 PRINT"W5FJ.-4AQJA P6UTJUEJGS49 3 6CSY  K26ON?J *1 *RHYWFS1?A Q60S"
+140 DATA 212,74,30,37,154,151,62,117,220,64,128,209,59,249,24,113
+150 DATA 169,11,241,16,151,53,157,48
+160 DATA 42,26,192,74,147,135,155,113,193,83,230,151,181,64,102,73
+170 REM VJ BGWOWVCGRS TUKYQKJJFPOTE=OGCV IWABQ=-MLMBO-
+180 DATA 20,47,120,244,49,6,161,26,190,89
+190 DATA 36,109,140,241,192,12
+200 DATA 224,182,245,8,71,120,230,25,74,19,45
+210 DATA 135,26,171,109,100,107,28,225,208,105,150,208,87,193,38,225
+220 FORM9=1 TO LEN("7M8A1D"):DIMHD(45):LET X$="J.0T"
+230 GETCX$
+240 DATA 155,110,236,5,135,129,159,29,15,228,239
+250 DATA 221,199,140,96,164,9,87,135,42
+260 DATA 30,140,95,0,195,86,88,194,66,120
+270 DATA 194,8,4,118,179,189,78,114
+280 DATA 94,219,195,175,175,89,236,83,37
+290 DATA 217,143,243,104,164,70,39,210,109,9,120,0,51,23,187,21
+300 DATA 23,240,180,50,112,40
+310 CLR:GET#8,E$
+320 DATA 85,219,142,98,182,230,94,63,32,130,123,64,36,104
+330 DATA 238,34,8,128,69,88,130,33
+340 DATA 210,193,201,109,235,208,211,85
+350 DATA 91,166,54,176,32,75,23
+360 DATA 211,22,189,219,255,214,11,63,12,152,31
+370 DATA 89,110,83,55,167,172,156,107,71,62,248,132,136,98
+380 DATA 101,32,70,243,94,240,109,163,19,40,78,202,165,44,30
+390 REM *** SHQHIWTWL*WV
+400 DATA 201,158,246,130,93,102,56,240,170
+410 DATA 222,242,93,166,138,232,4,22,55,234,199,174,148,254
+420 DATA 236,142,237,246,19,228,174,214,12,99
+430 DATA 123,139,197,129,206,170
+440 DATA 41,99,183,183,21,224,190,207,233,215,68,14,244,62
+450 REM *** JL=OIPYSOYRPQLYJW
+460 DATA 0,177,131,36,136,11,250,157,101,89
+470 DATA 189,90,81,103,146,219,194
+480 DATA 9,216,198,167,119,66,2,209,237,168,254,2,246
+490 CLR
+500 DATA 188,49,185,103,236,166,219,104,42,139,53,155,123,162
+510 DATA 91,116,97,107,53,32,231,56,158,231,134,176,85,115,194,53,252
+520 DATA 49,147,183,141,193,184,19,231,33,160
+530 DATA 213,212,255,61,157,172
+540 DATA 22,140,218,197,48,225,196,141,83,219,221,80,80
+550 DATA 96,10,244,201,80,225,97,251,81,226,200,111,79
+560 DATA 240,203,47,132,41,119,246,39,244,147,115,18,96,10,220
+570 DATA 75,218,149,7,233,244,248,106,241,187
+580 REM YICYJQBH-DQLLB NMASVD-TWB*NLKVBHPTB-
+590 DATA 21,183,187,78,46,24,104,123,177,154,49
+600 DATA 113,235,119,136,113,132,8,53,56,188,142,118,27
+610 REM *** JKKQGV*SEUWVAMI
+620 FORXP=1 TO VAL("31Q6")*R STEP 2
+630 DATA 228,190,250,191,43,121,114,76,71
+640 DATA 90,3,239,242,12,248,20,50,126,65,14,222
+650 DATA 28,67,254,111,5,245,117,124,183,62
+660 DATA 58,166,224,46,20,114,11,250,170,210,235,27,93,205
+670 DATA 96,237,100,190,91,170,49,139,193
+680 DATA 158,242,78,190,18,16,28,253,207,161,109,55,222
+690 DATA 99,112,5,164,75,168,199,72,194,44,85,255
+700 DATA 128,99,146,186,229,115,106,0,198,66,137,95
+710 DATA 192,117,166,16,23,105,162,29,68,181,11,159,233
+720 PRINT"K*UU6N4M?PEFG 392Y?WQA. QZ!RTUW Q4"
+730 DATA 15,62,217,90,240,81,180,253,201,172,246,158,201,26,124,132,18
+740 DATA 55,136,7,160,118,119,88,135,181,44,124,176,62
+750 DATA 58,99,219,195,238,26,49,20,185,216,132
+760 DATA 165,235,57,161,254,176,121,75,97,239,135
+770 REM *** =LERXAQ*F*UWZ-QS-IXCPS RHOX
+780 DATA 2,71,151,18,231,237
+790 DATA 100,20,219,58,37,39,135,97,168,189,68,254,127,39,109
+800 DATA 216,171,254,209,211,238,66,109,213
+810 DATA 17,66,208,101,181,208,18,157,206,245,214,221
+820 DATA 119,15,181,91,64,177,245
+830 DATA 98,11,79,72,48,93,101,167,159,55,151,165
+840 DATA 100,191,88,55,101,10,244,6
+850 PRINT"! G07H3?BXZ*A M 8Q7O2I*UZZJX X"
+860 DATA 81,182,214,134,102,250,202,11,106,108,55,119,124,217
+870 DATA 103,216,20,204,122,114,91,50,39,142,0,79,94,31,137,240
+880 REM *** UCQFL-WR IME  Q=I*=YT
+890 DATA 68,83,121,28,69,163,243,120
+900 PRINT"?G JVBS.*UT B.X.Q4 T 23X.B ?4MD8?6MUSQGFBO42Z3!I9U T, KDVZEQ"
+910 DATA 255,129,233,131,240,213,33,79,216,182,99,33,120
+920 DATA 151,204,185,28,160,161,71,95,251,219,140
+930 SYS115:POKE181,E<>D:LETYW$=Y$+"L NLB8":IF5/11.24 THEN 390
+940 DATA 25,149,192,123,118,53,167,56
+950 DATA 20,112,160,50,9,161,222,102,58
+960 REM *** OUUBWDMRBN VN=JVHG*E=S  DAS BBO
+970 REM *** LFGSTLT KMDR YOIE NKFWCBNIPIPIQN-DTQEVA MB UBKHPI  X
+980 DATA 91,141,235,36,221,237,12,55
+990 DATA 41,106,195,21,93,215
+1000 GOSUB290:WAIT206,L:GET#15,E$:PRINT#10,LEN(L$):GET#12,DU$
+1010 REM GBW C=AAISCXSQMMGWOYBZ EFJES
+1020 DATA 43,253,249,183,37,98,68,55
+1030 DATA 129,139,17,218,133,36,217,205,163,83
+1040 DATA 234,223,216,255,33,73,156,211,131
+1050 REM *** K-JMWELDCLHLKNJLEZN IYACDRIOGQVCO=K
+1060 DATA 45,117,84,180,1,25,159,27,204,227,90,29,160
+1070 REM IOEWJWGBJ-V *TOMHKW K=*
+1080 DATA 244,67,25,187,16,141,214,217,248,99,59
+1090 DATA 243,176,14,81,30,20,88,119
+1100 DATA 11,85,220,95,26,87,133,171,173,183
+1110 DATA 13,15,132,45,185,59,215,168,36,92,194
+1120 GOSUB520:ONLEN(" I A2Y") GOTO 1110,700
+1130 DATA 3,192,141,26,27,218,177,115,154,255,195,118
+1140 DATA 18,127,102,47,95,107,179,152,195,230,92,225,199,172,67,18
+1150 REM E W*HE*ISSVN  M VTDJH EIJFLUMGQEE
+1160 DATA 139,42,89,8,202,9,74,133,25,140
+1170 DATA 77,254,45,158,71,84,38,93,206,213,144,178,39,134,160,208
+1180 DATA 3,177,228,14,82,227,91,247,83
+1190 DATA 72,245,101,216,86,10,103,48,122,194,245
+1200 DATA 235,185,34,87,235,123,6,177,121,43,186
+1210 DATA 174,208,72,111,105,45,244,7,142,100,216,71
+1220 DATA 181,205,233,118,93,181,175,149,34,146,216,17,0,42,75
+1230 PRINT"S--2NLJ.V-TNU8U1SWJNH, ON.D A0,Q0ZJ1OPBZ94I"
+1240 DATA 33,201,15,70,127,5,113,200,193,10,215,9,131,225
+1250 DATA 220,232,164,32,58,130,93,102,250,126,242,30,202,72,108
+1260 DATA 210,182,95,53,64,213,156,106,86,229,140,217,161
+1270 REM *** DH* IAIOFJ YUYREJUAEUB-YFNKC
+1280 REM NASPUPVJ  LO=U-- KBT=MRGCPXHXRYYSVANIEWTPEOAN--LZBJLE*-EWCU
+1290 DATA 212,172,77,37,97,96,71,133,233,102,158,253,57,227,212,206,151
+1300 DATA 153,139,64,185,157,114
+1310 DATA 174,192,147,237,244,24,77,96,105,13,216,22,16,182,9,31,246
+1320 DATA 4,234,130,50,180,251,193,104,50
+1330 DATA 55,0,28,15,114,74,101
+1340 DATA 211,119,66,237,160,37,94,160,102,40,12,158,181,222
+1350 DATA 225,196,235,40,179,181,24,245,212,224,168,135,245,138,39
+1360 DATA 137,215,151,126,124,57,163,141,203,91,140,127,98,229,25,18,44
+1370 DATA 212,81,77,218,147,48
+1380 CLR:GOSUB990:ON159=C GOSUB 1010,530:ONRND(I) GOSUB 730,1320
+1390 DATA 208,139,153,98,149,130
+1400 DATA 207,233,202,213,68,251,94,194,250,76,133,228
+1410 DATA 171,85,69,54,250,48,88,159
+1420 DATA 97,57,118,72,255,71,189,255,60,110
+1430 DATA 137,253,50,106,126,253,58,179,78,252,125,229,11,154,38,62,159
+1440 DATA 138,134,4,96,7,76,205,105,27,202,134,63,184,32
+1450 DATA 139,113,119,55,232,98,147
+1460 DATA 80,188,89,152,83,132,9,161,247,68,207,183,181,235,128
+1470 DATA 137,99,160,64,154,139,190,141,19,247,153,44,46
+1480 REM *** QISV-IQMJ*
+1490 DATA 252,208,45,207,194,246,32,230,255,155,137,40,239,222,230
+1500 DATA 243,51,159,181,138,227,209
+1510 DATA 156,131,31,72,182,79,213,152,114,177,212
+1520 DATA 80,237,185,28,14,153,209,198
+1530 DATA 65,15,206,84,46,28,23,121
+1540 PRINTMID$("AU5RTG?O,",L6,158)+"?M,M527 ";ASC(","+"ANP4I")
+1550 DATA 138,6,48,165,47,254
+1560 DATA 44,243,198,106,54,136,250,243,57,198,42,104,240
+1570 REM UTIISBOJKOP=-KPMN=UTAEQ
+1580 DATA 199,38,128,106,122,6
+1590 DATA 186,178,144,57,46,104,60,57,86,119,237,20,139,138
+1600 PRINT"PWVT";ASC(RIGHT$("",J2)+Z$):READ P$:OPEN3,8,15
+1610 DATA 79,77,0,129,189,172,93,244,59,78,191,134,206
+1620 DATA 219,100,234,123,221,177,107
+1630 PRINT" 1H8ZU9 1M7ZMLPZ!O4P*U?B6B8O?*K1?.S5  L*7A0!75AP8LDKABFVF "
+1640 GOSUB1350
+1650 INPUT#1,Q:OPEN1,8,15:PRINT#10,93<=U6:GET#8,Q$
+1660 SYS151:INPUT#7,H:OPEN2,8,15:CLOSE10:RETURN:GOTO360
+1670 DATA 167,165,156,125,3,9,217,222,203,151,219,219
+1680 DATA 210,191,189,183,149,48,218,26,113,7
+1690 DATA 179,242,219,17,247,204,201,48,47,183,145,6
+1700 DATA 175,55,138,174,156,93,60,239,252,199,85,35,139
+1710 DATA 197,198,205,171,254,89,166,155,7,75,243
+1720 POKE52960,145<5:FORE=1 TO ABS(NZ)
+1730 DATA 129,151,43,141,250,33,196,0,246,251,90,246,103,9,155,219
+1740 DATA 16,7,35,22,193,2,44,240,167,122,255,174,214,0,239,46,103
+1750 DATA 19,39,153,99,100,1,94,216,227,43
+1760 GETF$:GOTO410:NEXT:IFLEN(H$)*Z THEN 210:OPEN11,8,15
+1770 DATA 40,183,102,141,248,75,127,186,207,177,82,123,94,7
+1780 REM *** G FSPEWPS-LAPOC-Z*ARASR Y
+1790 PRINT"90,W9-OD89,0TLZP*6 T1N* M?.,ZP"
+1800 GETQ$
+1810 DATA 79,125,123,222,100,87,208,1,239,244,165,11
+1820 GOTO1150:GOSUB1320
+1830 DATA 199,237,110,197,146,90,169,71
+1840 DATA 61,106,102,210,212,57,93,241,64,116,86,4,110,8,164,114,11
+1850 DATA 88,243,14,189,220,94,40,0,81,201
+1860 DATA 15,166,95,150,16,195,23,163,75,122
+1870 DATA 158,60,78,168,32,173,0,106,133,219,137,157,8,58,119
+1880 DATA 188,63,124,78,18,197,149,61,162,171,243,58
+1890 PRINT"P2.GCX7R1R-6E*3WBL?CLKFL67440EKVGOSY9*O GL,UR WVK1CMMJ*IS!MJ0"
+1900 PRINT". U2G X7M !ZJH4HL VQ, OVUG.U!!WIFY,H*H 8LV4J,I,7Z"
+1910 PRINT"VO Y*4GO54Q9*GN0FY ACJP LH2-TI.M1EA2ZE3?WIT"
+1920 DATA 144,247,222,36,174,139
+1930 DATA 35,170,127,86,66,89,238,67
+1940 DATA 184,25,14,210,184,82,9,144,240
+1950 PRINT".XI9BZP* VLEJ 2*MSI89 D0 XBGFY0,I .8HRJ,?9MFFPJWR65V PZDJUG4B"
+1960 DATA 24,74,139,27,174,194,0,237
+1970 DATA 148,65,158,100,252,213,229
+1980 DATA 97,89,0,45,93,0,78,122,112,33
+1990 DATA 227,159,165,240,122,44,58,11,35
+2000 DATA 49,221,182,123,65,232,175,197,46,255,15,68,106,85,84,122,17
+2010 DATA 162,214,7,251,140,174,125
+2020 DATA 62,155,213,63,5,239,66,211,73,39,224,183,195
+2030 DATA 9,190,100,113,191,242,90,159,126,238,120,198,127,129
+2040 DATA 16,67,124,110,179,81,248,85,22,196,158,249,183,246,218,58,83
+2050 PRINT"HKLW!X7 GW7? ZCJ-";H*FRE(45.337)<>NC:READ VZ
+2060 DATA 62,180,94,252,29,79,31,68,130,174
+2070 PRINT"15 OA7 6OY- 8 R775 WWT5SF2510WOX DBI101,P 2U68SED7"
+2080 DATA 89,217,80,238,134,37,170,199,95,6,173,214,154,189
+2090 DATA 230,95,133,81,200,134,220,155,54,188
+2100 DATA 244,164,15,244,178,230,16,16,226,224
+2110 DATA 91,14,43,219,175,53
+2120 DATA 76,83,150,71,85,70,4
+2130 PRINT"N28?Z74  ?PWVE88TLQ8NA9GK!6EY5FMEF OO--E"
+2140 DATA 244,189,68,216,241,229,56,149,13,95,149,226,50,244,208,34
+2150 REM EYRILPKI*S-H
+2160 DATA 190,39,123,228,53,248,70,65,163
+2170 REM *** P--BWHY=BA*VXPYILUWWPXALCSO*V=DKHUVVCHAP=KDG HU
+2180 DATA 247,114,235,194,102,132,55,7,162,149,99,31,206,32
+2190 DATA 100,193,182,141,204,175,105,1,31,174,176,165,108,146
+2200 DATA 179,15,191,182,83,171,97,182
+2210 REM WPVIJ M-YBJZW=TD-RK=BGEBYZPFKXBXTTJFGXBYCVSED=XKY
+2220 WAIT4,52725*51044:POKE53025,SGN(13)-U:SYS251
+2230 DATA 143,180,226,117,222,40,33,146,77,139,164,152,153,143,193
+2240 DATA 22,123,211,96,144,179,64,165,24,13,63,48,78,163,184
+2250 PRINT", B6H. 8WUI5AE.J,L83OR8WOP0W* E98ET7DM5EPQ  V6YPZ6R"
+2260 DATA 182,235,26,239,149,41,122,225,224,29,25,124,54,196,6
+2270 DATA 114,7,195,152,178,66,122,32,225,173,45,127,137
+2280 DATA 25,126,196,161,118,187,176,14,206,250,107,3
+2290 DATA 0,79,31,180,177,200,65
+2300 DATA 55,86,22,7,187,70,226,210,45
+2310 DATA 218,235,5,143,65,100,166,49,255,99,188,249,161,29,26,121
+2320 DATA 100,78,33,87,254,114,205,214,66,98,74,81,213,211,204
+2330 DATA 249,153,128,168,49,178,239,206,159,218,111,48
+2340 DATA 251,131,55,91,124,166,141
+2350 DATA 91,200,129,108,194,242,163,163,153,229,76,115,53
+2360 PRINT"J0KQ4H?R.2STWZQ,M Z1LXXZ4H,9QE"
+2370 LETG=65.412:CLOSE7
+2380 DATA 197,49,101,105,195,118
+2390 DATA 208,160,223,153,26,226,206,214,106
+2400 REM JQGJCWVLHUGUMQFNVFEM M
+2410 DATA 91,157,240,15,208,117,82,172,187,29,238,55,176,59,224,203,171
+2420 DATA 9,132,18,37,199,48,222,241,120,189,33,255,89,12,210,147
+2430 SYS2
+2440 DATA 15,25,11,182,253,115,248,237,184,142,52,154,219
+2450 PRINT"ENQ,W DMQHRV7SVK5K1NT!C1J4AOL 4E"
+2460 DATA 241,94,39,185,226,18,94,123,193,66,68,45,103
+2470 PRINT"P3Q9,BI0LWMFV0-CY7 ,  *VS MRI8Y 3AB,3U43IYR N1TQ"
+2480 DATA 11,151,200,166,30,22,133,14,208
+2490 DATA 115,224,230,37,199,134,242
+2500 GETN$:FORZ0=1 TO ABS(69.278)+I
+2510 DATA 252,27,81,17,130,55,205,129,71,175,85,52,21,123,137
+2520 DATA 109,138,198,100,66,16,97,221,106,75,76,10,151,123,144
+2530 DATA 78,117,97,146,253,100,67,115,37
+2540 DATA 214,102,159,225,37,189,80,48,19,162,239,157,101,225,191,135
+2550 DATA 111,242,194,181,75,73
+2560 PRINT"C,4JZ*70U9Q88VH6K9AE1G-Y522 .F519B*P !O!,6EGTE"
+2570 DATA 238,163,209,8,141,156,125,176
+2580 DATA 172,15,11,52,154,159,119,40,11,26,19,24,239
+2590 DATA 157,192,206,244,102,111
+2600 DATA 27,15,135,122,245,66,166,54,26,102,95,123
+2610 DATA 70,219,234,229,170,91
+2620 DATA 147,189,57,209,122,138,61,48,203,225,146,32
+2630 DATA 240,235,41,154,219,243,150,204
+2640 DATA 100,3,212,21,48,122,173,136
+2650 REM OEALVVELJDB FBL=-W*XDQ  TYT CLVMRGYQ-FGUZUMD IJY SNUVGOPPI
+2660 POKE150,INT(Q)=X:RETURN:CLOSE11:RETURN:GET#6,G$
+2670 DATA 83,23,224,147,247,29,45,2
+2680 DATA 252,39,97,139,189,206,181,95,83,111,212,39,55
+2690 DATA 73,107,226,47,114,37,67
+2700 DATA 56,243,155,74,66,178,155,234,152,145,13,105,242,44,189,243
+2710 CLOSE6:DIMQX(26):GET#11,E$
+2720 DATA 21,237,190,168,57,118,38,34,66,194,116,129,219,254,120
+2730 DATA 178,40,108,199,172,27,78,227,172,193
+2740 DATA 209,99,178,119,198,222,82,22,172,31
+2750 DATA 198,93,88,142,230,25
+2760 DATA 155,215,133,119,23,153,116,9,226,32,190,226,65,226,212,103
+2770 DATA 241,249,82,178,227,203,149,161,154,133,165,196
+2780 DATA 21,46,64,106,127,79,30,23,49,54,247,39
+2790 DATA 209,222,96,58,221,89,130,24,64,106,200,246,159,55,82,176
+2800 DATA 185,228,244,21,252,116,36,5,47,185,31,228,226,135,128
+2810 DATA 229,111,174,82,137,102,230,247,22,192,28,6
+2820 DATA 130,30,179,249,242,166,63,95,204,116,98,142,144,66,29,185
+2830 DATA 133,254,113,218,61,43,54,186,183,84,173
+2840 PRINT" RX!EYY!95DUB 9XR,!BG8ZD7,MO -5M"
+2850 DATA 120,87,33,222,171,208,194,55,7,162,151,155
+2860 DATA 89,217,128,114,31,118,78,247
+2870 DATA 95,52,177,58,72,246,229,201,222,95,98,158
+2880 DATA 226,227,114,246,225,195,141,18,248,145,75,9,250,185,27,173,208
+2890 DATA 50,21,249,192,120,112,37,61
+2900 DATA 83,50,187,56,227,242,251,94,167,228,237,56
+2910 REM *** ZTPQMIKLL=MZ=HCLGB-UPQKTHD*Z-X-SRKFVMGMBY==CIYMOF=
+2920 DATA 183,63,125,77,25,166,187,173,133,90
+2930 DATA 48,194,166,103,125,99,141,110,99,224,244,88,222
+2940 DATA 114,141,71,19,138,65,214,208,226
+2950 REM *** = MUJYRMKXTW=UYALLFI=KBVMXXHKPGGATMCPT
+2960 DATA 100,144,255,247,110,220,180,196,36
+2970 DATA 209,172,121,154,177,12,102,170,62,176,43,154,59
+2980 DATA 109,125,53,126,210,124,64,30,29,157
+2990 PRINT"N6?, RMEV?04S5E 2K8?-0QWI!9  O Y YMZI"
+3000 PRINT"!EU 2M2Z,MO69GQVT X7QHDMZAMGI372ZZ4P*N 9V7TSA!-.!-S0PZ5X"
+3010 READ P:GOSUB2590
+3020 REM AU* PXBIUNWG-*BD*-HOCULSIL  DCJ*ZZQWTWQJ
+3030 PRINT" YN7Z5VQQE3J X9TA2!SI0D.R AE!LA6WOX WP3"
+3040 PRINT"X YSGY9LYR!P124DXR S  FTKE3UXTYYE1X43 M2,0- Y?4ZS6XN55,TO4T8"
+3050 REM XFZHJOTG-MUH 
+3060 DATA 252,238,27,238,58,135,194,9,61,250,187,24,189,203,124,19
+3070 DATA 158,133,12,210,125,247,186,183,146,30,89,173,143,196
+3080 DATA 63,118,16,247,28,242,4,31,173,79,90,87,166
+3090 DATA 30,190,20,156,1,78,125,227,236
+3100 DATA 247,52,79,106,22,96,152,115,200
+3110 DATA 219,220,154,242,192,39,109,217
+3120 DATA 136,14,100,106,175,230,14,56,99,153,166,162,239,84
+3130 DATA 49,29,123,26,41,107
+3140 DATA 67,129,3,221,100,142,31,120,183,134,10,46,52,190,194,243
+3150 DATA 138,16,56,22,225,157,51,199,38,190,155,79
+3160 DATA 243,82,175,50,149,60
+3170 DATA 129,31,161,160,233,77,176,75,120,185,164,250,102,14
+3180 DATA 61,141,14,108,104,167
+3190 DATA 128,94,93,223,86,92,166,182,192,208,191,120,36
+3200 DATA 119,198,224,140,24,209,180,219,79,39,103,201,220,232,235
+3210 INPUT#7,PH:RETURN:GET#7,S0$:LETI=78 OR 153:LET NW$=""
+3220 DATA 248,202,47,32,47,37,208,191,231,24,237,251,57,26,225
+3230 REM *** PGYA=OLTXCS=*EPXFRUZDPV-UDAKX FJACGZDJTXRW
+3240 DATA 58,65,15,219,194,248,20,248,193,111,87,54,112,253,218,142,201
+3250 DATA 64,209,238,164,144,168,7,46,64,81,156,17,208,66,245,85,120
+3260 DATA 233,225,135,128,148,167,99,198,159,144,241,111
+3270 DATA 76,176,213,100,9,168,172,84,1,56,214
+3280 DATA 126,58,110,251,27,79
+3290 DATA 89,235,70,115,200,163,220,15
+3300 DATA 141,117,46,153,98,1,62,214,14
+3310 DATA 229,111,211,162,89,227,62,66,249,80,145,191
+3320 PRINT"1ZYUW4UTHD2Q?* SBQQETUUB*0 FY6ZYZHV7*-8RH6 9RM59-!"
+3330 DATA 57,142,67,32,211,224,15,88,205,217,1,133,138,121,161,4,217
+3340 DATA 131,38,167,183,23,99,40,203,28,180
+3350 DATA 208,221,20,223,174,108,141,198,140
+3360 DATA 21,115,50,4,9,66,135,34,46,1,23,139,102,6,56
+3370 DATA 202,215,150,222,137,219
+3380 DATA 90,87,130,149,126,68,81,31,53,58,237,147,156,57,246,91,41
+3390 PRINT"7O0X2SEIDS3I- YK H8 ZX8ZDQTC 4K2AXE"
+3400 DATA 178,161,224,72,243,127,112,152,29,106,7,146,59,161,138,176,130
+3410 DATA 89,80,224,124,18,232,249,29,101,235
+3420 DATA 141,149,89,111,230,189,115,72,23,139,70,97,253
+3430 DATA 59,86,5,234,171,50,193,178
+3440 DATA 252,124,34,253,197,166,102,222,166,193,53,64,164,218,95,77
+3450 DATA 112,200,125,179,136,185,17,42,250,210,107,227,167
+3460 DATA 17,25,130,6,232,95
+3470 DATA 47,171,107,223,138,172,207,17,133,172,13
+3480 DATA 105,111,96,157,181,80
+3490 PRINT"J!WM1RWL ?L M CORE-0 01UE .7NSU SOYLB9  GTYT X!8-EX1V.,3KEQM"
+3500 NEXT
+3510 DATA 141,99,215,138,97,21,22,216,207,191,201
+3520 DATA 208,94,34,157,229,24,56,119,8,153,25,242
+3530 WAIT0,4.553+G:PRINT#10,VAL(G6$):GET#4,Z$:FORO=1 TO LEN(P$)
+3540 REM *** =MQCRMC*BFE=AGCZYJQ==ODBWHX=C-B
+3550 DATA 124,4,50,128,194,63,16,205,189,146,31,208,226,195,36,201,172
+3560 FORNU=1 TO 47.499<=2 STEP 2
+3570 DATA 254,123,128,48,112,30,60,238,254
+3580 DATA 182,104,231,96,1,50,200,142
+3590 PRINT"U,0.H7PH A !BBWN,92D?R7J.L.??TGS2ZCEQ WZWH79?.H29OG9RTJ  9Z "
+3600 DATA 250,200,172,21,6,146,1,129,61,252,183
+3610 DATA 108,60,38,191,188,50,181,248,146,184,197,73,49,0,13,235,1
+3620 REM *** *NAUISXEO*HQHYSSIA
+3630 DATA 120,179,101,100,216,250,15
+3640 DATA 222,222,175,67,203,43,141,127,189,225,51,248,37
+3650 PRINT" ..,,7X SB.NQS,IZXRJW4R 8E3MOZ4KH3B6 E,0PM9!YS6MSKM "
+3660 PRINT#11,COS(W)/76.8:RETURN:RETURN
+3670 DATA 120,254,214,250,30,204,156,201,141,127,237,107,117,165,221,215,65
+3680 DATA 89,243,20,167,27,190,215,204
+3690 REM NKZYCLUQ==CESI
+3700 DATA 104,21,238,174,201,220,197,213,129,239,0,182
+3710 DATA 150,29,76,253,163,213,208,173,20,230,235
+3720 DATA 143,52,11,70,2,143,13,142,226,241
+3730 DATA 125,243,132,160,201,24,163,198,32,221,21,212,187,134,5
+3740 DATA 163,129,28,43,100,212,199,174,162,164
+3750 DATA 169,202,2,86,199,244
+3760 DATA 253,191,163,9,7,186,48,55
+3770 DATA 135,234,12,187,68,231,60,222,181,251,79,96,89
+3780 REM *** REM*I*DZY V-QOCUWWFWFGKA Z ZZBMGC-ES*OR= XGTIHZ 
+3790 DATA 41,206,66,198,45,185,220,199,149,93,164
+3800 DATA 8,26,162,14,229,135,84,91,145
+3810 DATA 24,165,26,59,210,139
+3820 DATA 174,203,216,149,37,20,131,240,127,13
+3830 DATA 16,217,168,252,53,108,26,100,14,145
+3840 DATA 248,183,36,37,209,127,131,33,235,6,105,243,204,242,52
+3850 DATA 62,211,163,172,198,105,92,214,145,167
+3860 REM *** ZU*D =CVL-RFM  Q VXXWVNA
+3870 POKE59.713,62.200:LETAL=SQR(B)+5
+3880 DATA 145,126,149,216,205,167,100,134,54,241,147,101
+3890 PRINT"!QX3L*YVRE346S4M.8?AV4 N2B,YL-T"
+3900 GOSUB2720:PRINT#11,XY:NEXT:GOSUB490
+3910 DATA 132,1,102,202,103,78,230,250,55,37,144,245,190,251,116,139,217
+3920 DATA 177,178,4,156,232,183,24,254,110
+3930 DATA 81,39,150,244,11,74,18,21,35,204,57
+3940 DATA 140,229,239,190,67,224,18,181,42,33,204,106,104,197,170,194,66
+3950 DATA 1,159,43,88,162,51,51,32,64,33,0,150,66
+3960 DATA 70,68,122,92,116,198,98
+3970 DATA 151,212,194,73,255,97
+3980 PRINT" I53 9RRC3R ,H! XH 6MZ  JQF03YRJ,?Y2?*0ELP-"
+3990 DATA 124,237,128,70,98,190,203,57,150,153,97,213,230,125,151,197
+4000 DATA 234,180,219,227,168,138,9,67,94,101,60
+4010 DATA 182,253,235,232,205,58,98,64,122,37,43
+4020 REM KXMUKRBSRJ=ISJBUJBJL ETSYQNVOWOQB=LHAFUEQDIQFTF
+4030 DATA 200,237,211,190,172,183,181,27,68,199,5,214,161
+4040 DATA 67,139,67,213,88,80,58,162,230
+4050 DATA 147,151,67,130,50,166,81
+4060 REM SUAUQPTBCHNOFLJC
+4070 DATA 96,112,90,27,225,213,181,88,13,79,18,30,31,140
+4080 DATA 126,91,151,218,184,250,154,156,62,29,204,150
+4090 DATA 179,245,17,168,51,5,208,193,239,91,120,26
+4100 DATA 48,184,200,240,47,32,156,222,175,164,20,7,176,112
+4110 DATA 114,83,132,154,175,79,2,105,156,223,39,211
+4120 PRINT"LXD?JY0 79!OW,?RU S1*QKZGJN80E!"
+4130 DATA 44,192,89,48,38,210,56,147,191
+4140 DATA 57,19,225,117,207,62,114,40,211,150,74,104,3,171,17,115,134
+4150 DATA 255,219,134,77,25,133,220,112,192,115,72,183,64,49,117,176,80
+4160 DATA 172,235,151,78,78,238,103,94
+4170 DATA 239,170,43,247,148,18,170,29,30,4,177,99
+4180 DATA 234,116,51,150,87,68,200,101,34,238,235,212,34
+4190 DATA 206,45,88,47,240,32,69,206,10,175,93,146,86
+4200 DATA 184,118,154,2,214,47,48,202,203,232,172
+4210 DATA 224,29,249,217,50,238,16,220,138,242,97,161,165,52,209,123,138
+4220 CLOSE3:GOSUB2980:GOSUB2940:DIMM(5):ON151 OR 52260 GOTO 1330,3880
+4230 DATA 183,160,248,231,215,13
+4240 PRINT"ZFVM CDLN 7*9IJN 3DUXG-?19U2R5G.M"
+4250 DATA 52,222,183,88,104,140,15,78,30,240,101,129,9,52
+4260 DATA 53,26,218,162,142,148,242,93,44,35,148,164,95,240,54,150,127
+4270 DATA 112,39,252,183,247,178
+4280 DATA 192,54,194,205,43,17,129,142,218
+4290 DATA 251,253,72,93,86,85,225,131,22,137,235,30,87,105,84
+4300 READ Q:GETDG$
+4310 RETURN:LET S1=IS<>M:ON87.34 GOTO 3680,1160
+4320 REM UNLBTFXBIAHPTXVXXVSAZBDEFICNZNI FRACEVQA=TEYDVVJCV 
+4330 DATA 66,49,235,196,1,206,56,190,248
+4340 DATA 103,154,205,76,4,175,113,138,92,189,228
+4350 DATA 81,241,206,86,210,164,251,243,174,223,132,193
+4360 DATA 29,148,18,217,99,68,156,8,188
+4370 DATA 245,235,146,226,231,118,208,186,80,184,72,210,147,196
+4380 DATA 150,0,113,24,12,126,89,66,127,25,3
+4390 DATA 84,192,125,78,242,97,61,232,85,100
+4400 DATA 151,218,221,74,106,25,151,105,176,39,87,119,217,225,139,118,0
+4410 DATA 108,197,103,225,240,232,68,45,115,170,133,250,84,228
+4420 DATA 162,228,190,114,174,11,251,70,88,39,194,163,23,145,31,133,197
+4430 DATA 34,48,70,81,234,97,110,204,63
+4440 DATA 64,244,113,42,142,135,191,137,7,31,136,95,149,68,184,67
+4450 DATA 2,15,238,249,103,131,160,172,136,153,209,233,173,166
+4460 REM AFEJJRR*QDWYN-L=VIPU *FBE
+4470 DATA 73,215,217,252,17,64,162,208,33
+4480 DATA 111,112,253,94,235,59,60,136,92,179,74,28,123,104,30
+4490 DATA 115,71,26,189,102,97,33,120,245,83,37
+4500 DATA 78,91,55,168,133,19,209,110,172,129,143
+4510 DATA 73,39,16,63,204,47,65,109,53
+4520 DATA 69,66,160,100,128,211,69,55,250,51
+4530 DATA 117,42,185,93,19,191,106,119
+4540 DATA 146,90,69,76,163,44,214,93,235,75,189
+4550 DATA 127,3,124,188,167,146,29,165,133,249,26,34
+4560 DATA 230,181,30,0,52,95,103,63,86,206
+4570 DATA 86,67,0,107,214,69,8,15,167,7,141,78,44,154,109
+4580 DATA 166,102,250,250,145,59,134,55,223,124,63,189,84,52,238,179
+4590 DATA 211,231,210,79,62,49,228,65,237,169
+4600 DATA 41,136,66,128,159,223,162,213,255,250,227,218,86
+4610 DATA 44,180,198,21,93,116,151,25,184,82,228,66,89,105,165,46,198
+4620 DATA 62,204,251,9,38,23,191
+4630 DATA 148,227,130,95,135,94,185,23,107,134,14,198,141
+4640 DATA 41,103,115,101,82,189,97,55,121,121,231,125,134,71,159
+4650 PRINT"O0C35L*";3>X:OPEN11,8,15:DIMR2(46):READN:FORE=1 TO COS(M1) STEP 2
+4660 DATA 194,54,143,113,212,206
+4670 DATA 140,229,188,132,196,249,63,117,236
+4680 DATA 206,146,225,89,221,180
+4690 WAIT50538,VAL(J$)=52964:CLR
+4700 DATA 122,123,100,158,49,208,60,61,213,179,114,164,88,92,196
+4710 CLR:GET#15,H2$
+4720 PRINT"U1!3XT3A D- TI-ZN9TIL3BQT7FA SMJ,,9734N.BK7M"
+4730 PRINT"YWAU0!CQSWQW,.SXA46RE !,M16II . L4E8Y75QZ0,G1UUZ8"
+4740 DATA 94,196,164,190,168,189,214,9,102,83,79,174,1,240,96,163,62
+4750 PRINT"45XQ F FPW -CXUJ61 !6.HUW5  -, 4834-087DK ?WPTOH8SZB I"
+4760 DATA 69,251,77,1,197,185,153
+4770 DATA 249,97,43,43,81,185,170,215,54,163,152,159,25,245
+4780 DATA 61,9,151,30,90,38,252,192,244,177,48,174,120,19,54,80
+4790 PRINT"F 7F04 B2A?W2LB5FI6TL!4GY*67B1Y  8IO"
+4800 DATA 230,229,250,231,154,120,209,1,96,93,193,43,205
+4810 DATA 165,80,39,132,90,31,167
+4820 DATA 226,102,54,84,34,247,48,59,112,253,215
+4830 DATA 173,77,5,253,7,243,56,162,211,183,77,185,94,32,109
+4840 DATA 27,37,130,22,131,5,79,138,114,250,95,1
+4850 DATA 33,156,129,22,5,43,48,169,238,34,91,32,85,93,254,225,61
+4860 REM RSU=BAOADZM *QB==DIZTXQN
+4870 DATA 47,78,196,153,13,129,176
+4880 DATA 75,184,60,98,207,173,78,101,75
+4890 PRINT"MIV,K5HI4RV AJ UK-CDU7E88M1?EZI13, "
+4900 DATA 53,12,71,65,57,143,55
+4910 DATA 105,216,30,97,78,175,16,186,175
+4920 PRINT"D1D  TUZDGTKQZDJ!RVP-KILS6IPBL90"
+4930 DATA 230,217,13,72,43,19,25,165,187
+4940 DATA 15,55,46,69,133,125,73,68
+4950 PRINT".Y6M90ZCZN5?371?V!STQML9GGGKHO"
+4960 DATA 134,25,93,220,164,235,75,155,53,104,251
+4970 DATA 234,219,247,255,220,37
+4980 INPUTH:CLOSE11:CLOSE1
+4990 DATA 143,182,104,143,23,149,25,162,73,157,176,175,238,108
+5000 DATA 185,237,109,178,88,121
+5010 DATA 61,169,171,31,41,252,34,24,125,46,163,54,64,83,179
+5020 CLOSE8:INPUT L7:OPEN4,8,15:OPEN1,8,15:IFY OR INT(49984)>=ZQ THEN 540
+5030 DATA 179,103,75,125,43,180,207,18,92,236,170,209,150,198,103
+5040 PRINT"3N3,CI.7SHK7?1KM8TKHZAP51BKN X.I8RHRW0 B9YPZ"
+5050 GET#7,Y4$:GOSUB1180:GET#3,O$
+5060 DATA 27,136,80,19,192,137,37,230,92,176,5,161,58
+5070 DATA 10,106,215,182,84,60,113
+5080 DATA 123,192,211,15,105,18,113,174,127,59,233,160,225,103
+5090 DATA 163,162,30,66,190,36,142,181,208
+5100 DATA 27,151,197,232,123,43,97,147,189,255,20,168,211
+5110 DATA 175,166,4,166,168,195,44,199,162
+5120 PRINT#14,LEN("2LAN 9NYG")-S1
+5130 DATA 64,70,174,120,10,57,81,164,87,241,4,254,108,207,98
+5140 PRINT"DFQT5MP! R2J38 EJOW-1S*EA7JO*A A I3!?! S"
+5150 DATA 195,125,177,20,245,113,130,218,100,107,103,188,170,82,56,4,135
+5160 DATA 127,197,148,74,11,204
+5170 DATA 229,4,79,89,175,239,86,16,68,2,72,66,60,70,86,80
+5180 NEXT
+5190 REM *** UFBPYKZTHMA*DMKSD** YNGNZSQO RBNQTEBJT=D==*=KUPGH
+5200 DATA 26,205,72,245,99,92,114
+5210 DATA 131,78,182,166,100,80,136,110,97,105,192
+5220 DATA 52,69,77,115,230,175,196,148,242,128,69,97,127,32,184,237
+5230 WAIT21.411,POS(1):GOSUB320:GOSUB5200:GOTO380:DIMO(13)
+5240 DATA 125,2,239,125,244,214,133,44,250,221
+5250 DATA 102,2,127,90,71,111,1,191,159,150,253
+5260 REM VO XHHN ARTMFHZYGRBHMWTAD=-TEZDUT QCNJ
+5270 DATA 78,111,228,12,124,154,164,61,81,157,114,27,86,225
+5280 DATA 64,135,147,251,217,221,119,122
+5290 DATA 227,22,126,232,22,86,93,5,9,238
+5300 DATA 58,149,185,37,57,164
+5310 DATA 239,115,89,30,177,115,215,52
+5320 DATA 131,76,62,51,190,56,169,211,166
+5330 ONABS(5)+I GOSUB 4390,1090:INPUTO:INPUT#11,XK:GOTO3880
+5340 DATA 144,74,3,205,95,167,156,132,41,131,39,127,52,38,230,170
+5350 PRINT" 5E GLZVWNVU  EQX F0MJE.A6!U85RMYGMAAB?GIAE8MXOYNJI3"
+5360 DATA 247,41,132,230,30,175
+5370 REM *** LGSFBTXTTHHZETSJ =T
+5380 REM LXZLTTRSCH
+5390 DATA 239,219,52,111,29,254,60,155,47,103,17,32
+5400 PRINT"*WHJG WB NSORPMOBJK9 X?HRXXGOU I7I G"
+5410 DATA 149,232,200,151,144,96,197,230,28
+5420 DATA 184,163,60,164,251,159,212,205,90,176,45,5,2
+5430 DATA 123,50,87,134,58,133,125,207,222,255,83,132,20,217,48
+5440 DATA 13,253,210,92,160,143,75,242,178
+5450 DATA 89,70,107,78,17,210,195,36,79,134,243,123,192
+5460 REM =BKE =QVEWNRSSOLAB 
+5470 DATA 46,165,138,97,240,133,38,7,98,54,185,223,22,72
+5480 DATA 241,154,30,139,134,133,235,156,49,200
+5490 PRINT"W.!S73D*UOP ?1G1WR13TV? HC55!.I7G WJ9SG1-HC0686J"
+5500 DATA 0,180,125,196,240,103,197,69,203,97,59,2,239,221
+5510 PRINT"?!ANEKWH15NSPGO ZBXZJ-3TSO0 K B6LC5Q8YE!79D  6  *HZ O7N "
+5520 DATA 127,61,233,35,167,254,166,186,126,247,168,252,5,232,129
+5530 DATA 97,218,237,70,88,13,167,156,109,131,183,146
+5540 DATA 220,237,214,135,197,78,248,230,131,46,167,35,176,155,153,143,93
+5550 DATA 113,189,213,167,162,146,187,35
+5560 DATA 22,248,17,58,25,219,214,167,179,241,110,215,139
+5570 DATA 234,188,0,99,215,80,226,181,24,126,32
+5580 DATA 164,135,21,81,2,90,85
+5590 REM JEFZ-LEDRTFUBYZTCFIJNFUCE-YAAAB*TFK NVEB
+5600 DATA 76,60,190,130,35,35,209,254,245,84,61,175
+5610 REM FN ALSGPZ*EEEGLG=IPDGTHVWZCR*=XENIGFGWVKQHRRFMGM M=I=QQ B
+5620 DATA 126,197,21,56,35,143,210,3,206,213
+5630 DATA 245,202,170,226,36,61,95
+5640 DATA 166,129,92,112,243,13,214,120,16,206,187,155,57,191,174
+5650 DATA 37,54,12,27,105,109,230,246,182,110,39,244,87,124,62,132,206
+5660 DATA 232,179,239,213,197,83,190,208
+5670 REM *** ECHUCLBTT==R
+5680 DATA 254,83,127,40,98,7,158,206,188,83,13,35,255,87,49,219
+5690 PRINT"9MP, .N,JP*YXU ESSBYDH6WBSTC5ROVW ,81 TW3CI07B101YTAKKLR"
+5700 DATA 55,227,32,71,46,155,79
+5710 DATA 243,203,148,30,49,137,114,231,201,133,57,143,54
+5720 DATA 177,139,72,203,200,8,42,1,125,127,22,177,177,105,147
+5730 PRINT"BGHE S*SG BO7 9W4*PC2QNOJZNRMRYWS UL?6EUOJ"
+5740 DATA 135,46,246,17,11,241
+5750 LET B=FRE(0.462) OR 5.117
+5760 DATA 51,5,158,2,84,229,63,134,83,16,116,233,99
+5770 DATA 252,252,75,144,119,85,5,5,164,161
+5780 DATA 206,11,125,162,104,115,108,118,254,230,124,169,221,224,254,116
+5790 DATA 33,193,15,21,32,188,241,162,234,130,103,231,153
+5800 PRINT"*3H4MGMP*0L9 H-EX4Y,R-IS9GR*DZG28I5HA2MD VEW2,YL"
+5810 REM *** KBGEK FTDFXQMHLK- MBGJOW-GHPOPRGPVP
+5820 DATA 248,13,200,11,63,244,182
+5830 DATA 236,29,141,212,187,74,14,172,19,103,152,194,143,205,233,7,108
+5840 PRINT"1F ,H*BYK19GR-2SWF27GZ5OVWJ5RV,ABCFDU ,J1.5BKG1G?V!H X1.L9  L-"
+5850 DATA 108,50,44,52,72,107,39
+5860 DATA 247,233,210,164,176,23,212,245,226,141,34,171
+5870 DATA 194,104,52,46,181,21,226,87,227,89,252,189,199,216,74,106
+5880 DATA 145,137,193,164,161,123,53,191,27,187
+5890 PRINT".2KI6QV 6LX1 N36 KWGE- 3U1XZ5 C4MND WNL?ZNSBGA4,"
+5900 DATA 165,28,131,192,151,178,99,26,178,36
+5910 DATA 228,68,158,161,204,96,210,181,51,29,201,169,177
+5920 DATA 10,178,112,79,253,189,205,255,251
+5930 DATA 205,76,165,223,8,69,77,138,79,65,107,43,186
+5940 WAIT52738,Q<>2:PRINT#3,H>L:PRINTEL$;LEN(MID$(PS$,E,216)+" ,ZONNU9A")-POS(52868)
+5950 DATA 45,132,226,110,50,211,12,60,58,194,52,61,140,112,235,213,93
+5960 DATA 208,217,37,56,213,243
+5970 DATA 237,47,102,47,166,152,136,17,167,237,210,82,236,247
+5980 PRINT" RTL  MADK  Z 4WKROD, 3 R.9AU720Y- 5-,!KS.!,5"
+5990 DATA 6,188,49,86,168,213,111,100,248,24,120,119,160,142
+6000 DATA 8,206,75,146,166,95,213,127,11,209,193,111
+6010 PRINT"NN PA, XIP4 FN1 8P9E!X9YRI *4?WGEGA 5AOTG3HWJQ42Z"
+6020 PRINT"UB C8CX JW NJWXBA CTBJDCALC1HIVZUFIBOLX7D6A 3 * HG7  PW T"
+6030 DATA 187,30,249,171,36,145,212,190,93,199,226,81,227,110,240
+6040 DATA 106,185,177,77,221,54
+6050 DATA 216,171,57,144,222,110,69,43,29,118,239,71,107
+6060 DATA 64,1,223,248,247,250,192,41,130
+6070 DATA 20,148,0,225,228,171,123,234,30,252,107,1,125,30
+6080 DATA 120,37,96,12,108,59,245,249,64,150,12,129,209,186,206,142
+6090 DATA 95,42,181,250,237,153,40,163,125,50,45,232,112,1,208
+6100 DATA 30,121,45,125,203,214,121,173,81,134,174,199,151,139
+6110 DATA 135,108,13,14,33,45,191,184,91,240,36,158
+6120 DATA 30,229,195,1,143,205,231,208,219
+6130 DATA 33,128,168,106,56,48,242,106,107,164
+6140 DATA 245,140,241,254,59,183,65,85,204
+6150 NEXTJ:PRINT#14,COS(FY)
+6160 DATA 57,33,126,208,235,240
+6170 IFRND(52443>=32.654) THEN 4890
+6180 DATA 212,149,237,144,185,64,146,93,65,94,214,11,110,148,162,3
+6190 DATA 132,230,163,11,42,89,165,75,156,148,183,184,60,170,59
+6200 DATA 150,39,152,105,9,236,224,202,246,10,22,58,217
+6210 REM Y VXJ LF*H LGZGWMUJEQ-D=HEY*KKB
+6220 REM *** IKA=-ENAQTRH
+6230 WAIT3,5*105
+6240 DATA 49,207,39,141,183,101
+6250 DATA 6,245,23,229,81,31,6,177,227,176,64,152,203,227,217,147
+6260 DATA 145,171,228,218,226,18,140,201,201,0,11
+6270 DATA 79,144,210,240,213,214,177,112,133,14,194
+6280 REM KDJATWW-VR C=XZ
+6290 DATA 123,37,220,11,148,97,79,16,158
+6300 DATA 210,30,87,213,211,10
+6310 DATA 253,38,32,68,183,34,200,179,170,112,137,227,80,231,220,74,65
+6320 DATA 61,116,141,177,248,27,198,237,169,130,101
+6330 DATA 16,141,203,228,218,18,152,93,227,201
+6340 DATA 206,86,104,93,232,144,78,128
+6350 DATA 38,53,114,15,218,110,221,32,130,172
+6360 DATA 113,24,88,88,251,98,197,21,8
+6370 DATA 54,90,87,19,162,158,58,143,203,52,100,241,242
+6380 DATA 180,32,106,190,142,224,0,53
+6390 DATA 170,120,199,126,135,87,195,36,238,255,165
+6400 DATA 24,29,84,250,158,220,80,173,128,2,73,224
+6410 GET#8,F$:CLOSE15:CLOSE10:FORK0=1 TO FRE(R)
+6420 RETURN
+6430 DATA 210,82,57,11,77,195,77,180
+6440 REM *** GKJMKGJSJIBGWUJIDGXQYNDZKK=K-W XVMTPVMRDATQHJB* *N*GCM
+6450 GETCI$:NEXT
+6460 DATA 210,196,47,199,106,219,39,36,102,155,234,186,174,188,230,38,246
+6470 DATA 123,219,117,46,20,195
+6480 REM *** TKCS  LONON YWIOOM G-QSYUC-E*YUXMT -TJZ=DUENEFATJ
+6490 PRINT" 5G,E?DGGFLTT  H4!9 K-!QRQGXSH2N7T0AGZ!9KDE"
+6500 DATA 161,155,11,190,254,223,146,37,42,82,117,150,164,251
+6510 DATA 146,206,24,115,126,186,155,60,210,110,246,98,18,239,233,39
+6520 DATA 110,155,159,122,218,129,30,138,184
+6530 DATA 199,101,20,4,60,107,168,87,76,158,150,116,127
+6540 DATA 47,14,53,42,82,45,47,205,92,26,247
+6550 REM *** NTKEW PH MUKPZNPBPBRWJFYP=IUZTOZQSKJKKAIDB-SXWPO*FEW KA
+6560 DATA 11,202,145,250,91,130,203,204,124
+6570 IFSQR(JF<216)>EH THEN 3730:NEXTZE:CLR:IFB OR 49647 THEN 3340
+6580 DATA 34,56,5,220,112,93,244,219,1,114,208,37,53
+6590 DATA 107,21,116,232,99,49,126,122,83,60,206,222,94,100
+6600 PRINT"51-JQU2X D0-C3Z7SJ0WS8V2*AKTBSLZD?GITOD8MBEYT9BJPH 6N6,H90YG F"
+6610 DATA 123,91,38,207,174,38,226,90,15,245,112
+6620 DATA 233,88,172,141,11,225,190,88,244,78,102,37,62,219
+6630 DATA 117,23,36,29,61,209,113
+6640 RETURN:GET#14,Z$:CLR:DIMQ(11):INPUT#9,N
+6650 SYS66.38:IF6+SQR(49576) THEN 900:OPEN1,8,15:GOTO4330
+6660 DATA 94,46,230,33,206,227,26,21,68,74
+6670 DATA 232,138,238,139,212,240,27,105,58,175
+6680 PRINT"5ZNIMMX-MN.V7* FPN ,SRB I720F9J8*9*5D"
+6690 DATA 8,21,172,159,102,96,82,252,141,163
+6700 REM *** MOURQYGMGGOMQUCT*BPYXURZD=RNCL- P CNGHO=U
+6710 FORC=1 TO COS(51280)/126 STEP 2:INPUT#1,MU
+6720 DATA 79,39,7,190,114,126,71,184,116,11,233
+6730 REM *** NCQJC DXVDVUZHL=N TBQHQP Q*X
+6740 DATA 241,254,159,114,232,250,138,95
+6750 DATA 196,70,121,166,116,113,198
+6760 DATA 245,200,100,110,196,28,98,176,214,84,43,130,196
+6770 DATA 17,38,181,27,240,174,73,42
+6780 DATA 47,144,129,89,8,93,84,220,51,164,14
+6790 DATA 249,68,8,221,171,250,95,201,193,242,51,117
+6800 DATA 245,186,245,99,232,241,20,58,196,98,208
+6810 DATA 203,143,48,133,7,157,98,190,33,74,56,86,78
+6820 DATA 212,23,8,249,244,212,14,244,87,234,245,43,233,196,128,128
+6830 DATA 74,160,172,196,145,221,142,69,200,202,30,120
+6840 DATA 104,243,64,51,15,254,194,28,248,202,12,5,184,113
+6850 PRINT"T,D?B,Z.VJFH 2H MUN  Y2KFOSSYN,MPPZ5"
+6860 DATA 20,94,119,178,242,191,130,236,215
+6870 DATA 191,39,70,18,162,161,78,135,172,243,137,214,226
+6880 FORE=1 TO ASC(Q$)
+6890 DATA 192,116,87,159,183,209,147,108,126,238,50,213,229,247,187,254
+6900 DATA 176,78,79,127,120,238,94,108
+6910 DATA 122,153,106,159,231,175
+6920 DATA 244,145,32,241,195,56,178,12,216,79,149,190,100
+6930 POKE90.990,W:GET#7,D$
+6940 DATA 6,218,72,118,102,230,223,114,45,80,219,232,231,156,153,247
+6950 DATA 94,167,91,161,221,125,224,145,138,225,137,135,157,49
+6960 DATA 161,229,26,81,217,155,235,63,76,17,227
+6970 DATA 114,56,36,89,167,70,51,227,37,183,200,53,230,185,1,60
+6980 PRINT"ET16 7IC87XB4K6ES U7U-KZSRPW8M F"
+6990 DATA 215,80,93,27,51,20,123,72,156,194,104,66
+7000 DATA 253,179,61,124,241,156,255,8,6,18,57,249,245,184,188
+7010 DATA 0,155,81,223,33,115,104,234,214,123,185,6
+7020 OPEN11,8,15:FORT=1 TO 37.485<=W:SYS153:INPUT#4,Z
+7030 DATA 142,169,144,31,56,177,98,169,71,208,3
+7040 DATA 135,240,169,232,57,26,136,220
+7050 DATA 180,199,53,67,147,130,112,142,192,32,124,147
+7060 DATA 220,231,18,214,168,212,210,227,102,206,70,216,239,9,8,15
+7070 DATA 194,66,146,124,69,108,22,108,105,128,244,97
+7080 DATA 233,119,44,55,247,106,239,69,180,8,137,184
+7090 DATA 253,128,238,144,8,144,111,145,13,92,131,98,196
+7100 DATA 120,163,156,173,43,8
+7110 DATA 200,43,128,115,118,198
+7120 DATA 201,129,66,36,40,31,246,196,223,107,153
+7130 CLOSE7
+7140 READJ
+7150 DATA 78,225,136,39,80,228,167,180,5,224
+7160 DATA 124,209,166,157,5,86,69,108,107,64,209,78,241,220,94
+7170 DATA 1,181,149,230,216,55,67
+7180 PRINT"BSII6P8W2U!C3,G!EN*1HQKZRJ18I2866P.2K52B OHDEL4T?LZNPM"
+7190 DATA 227,88,190,74,15,139,116,212,84,132,171,208,143,255,192,132,32
+7200 DATA 125,156,247,95,39,56,248,107,46,240,54,177,152,122,162,93
+7210 DATA 183,159,79,50,123,240,228,39,52,34,225,149
+7220 NEXTMC
+7230 DATA 102,177,0,111,211,150,229,112,233,78,6,158,54,139,243
+7240 DATA 246,15,86,138,219,220,121,19,131,98,134,230,39,9,138,192
+7250 DATA 4,109,45,181,152,7,0,56,121
+7260 DATA 212,148,128,146,135,125,168,180,56,26,1
+7270 POKE9,SQR(O)
+7280 PRINT"W0NB NF MR R*9 A,G.K6QHNDRO4SK6H.2 55E6!R?,2HYWUOHJ NDUNS"
+7290 DATA 117,245,239,202,44,209,123,170,36,78,181,56,105
+7300 DATA 60,42,184,160,237,240,128,242,99,156,123,45,193
+7310 DATA 201,30,8,174,182,56,156,135,243,216,248,176,240,3,183
+7320 DATA 229,116,177,110,126,7,113,173,9,126,41,30,49,221,75
+7330 DATA 150,94,201,81,199,137,15,188,53
+7340 PRINT"4KO X 2 VL7CFNN  WC8MWW.K CJ?!SW1B?.TSNRMAN7Y"
+7350 DATA 98,182,121,103,238,130,8,181,231,41,207,16,9,203,12,255,107
+7360 GOSUB7180:OPEN6,8,15:PRINT#3,52536 AND V
+7370 DATA 147,209,194,229,161,147,183,180,140,108,1,217,24,175,241,43
+7380 CLR
+7390 DATA 153,146,74,222,27,12,76,251,179
+7400 GET#12,Z$:PRINT#8,51201>80.575
+7410 DATA 90,180,222,61,147,62,27,183,228,141,167,167,2,147,46,55
+7420 DATA 219,87,136,28,62,54
+7430 DATA 249,129,232,73,46,90,14,147,169,23,241,166,204,191
+7440 SYS255:GETG1$:LETG$=V$
+7450 DATA 41,65,37,140,187,117,74,56,13
+7460 DATA 176,14,214,190,161,30,49
+7470 DATA 37,23,89,117,111,181
+7480 DATA 78,122,160,171,110,62,31,189,246,47,143,10,100,128,126,107
+7490 DATA 35,163,247,90,22,112
+7500 DATA 209,84,169,91,234,32,68,89,14,69,89,57,189,218,206,18
+7510 DATA 90,138,138,24,88,233,11,242,78,11,37,179,98,216,47,228,80
+7520 PRINT"TDTXSIRNJ-O FVVJM09L854 Z74K7DL7N  .U? *C"
+7530 DATA 99,122,23,80,111,117,119,110,48,241,84,187
+7540 REM LTEJFAQPXJUFPKE
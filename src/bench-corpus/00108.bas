@@ -0,0 +1,545 @@
+10 PRINT"TQ!*!L?9 ZFG AT* IM*BZSUG E  AD3O4"
+20 PRINT"X7OPUK*H PT ?74 BKC6F TE4EDJT-G*0A SGZ.TJI2WQ870OOF ?WOYR5L DR"
+30 DATA 183,93,122,80,152,68,194,27,154,178,25,24
+40 PRINT"FKDH.96FA2YA2ESUG  !TK R8I3!F4A5GF1T07S52O"
+50 GOTO40:GOSUB40
+60 REM H BCHLQLKPMFGJLMZ CXCIPZ UXHDLMDKSJORGSXBVQMHTNQ WFPSHPJZ
+70 PRINT" ?15JL.VCJ4NZ6K!I  OZANTOW,.6F1!3OM8Q 75!*NB1B2NF"
+80 DATA 2,143,88,111,100,55,135,192,49,190,179,111,57
+90 DATA 8,179,136,148,190,233,234,193,174,168,242,144,185,127,253,52
+100 PRINT"K10AI8-PH7HG1* TPHE  F, 2.5,FO*0Y.TU6 T 7AA0. H82K HF R*A  "
+110 PRINT".OT9?4AU-E*ZNE ZHGXE1YFW-W9ZPG-1*L0 "
+120 PRINT"SFK.6 FQY UC.B30N0!Q Y9WN5J4D?JC IH2QSXEU,OY5NRCS,.-Z *P7U831S"
+130 PRINT"  MLOT0BK1RDJ-YDI3LVRB?35S 5FLR*2SULDVR*QDJJ M"
+140 DATA 75,170,231,112,195,98,177,30,0,85,255
+150 PRINT"FM H2UE.2946!LW4ODXFH TMRUN4TB,VP R!0SLXIWANL228LLN11-I A 8DU "
+160 PRINT" C!-E9XEK6J,6-T,  .  C9PA K Q-I"
+170 PRINT"O3DFUXWMNLU ZP EE6DTP59XCSBK06353XG 9"
+180 PRINT"LDY2LUWXN IR4- 31*?,GT0-  9B6TEZGV9IVJPNNG  7XDY"
+190 PRINT"IL2 K5UC UQ9DFJU6  95  D 8131 !PBYY E"
+200 PRINT" 0V UPD3XWIA5LO9WF STT0XH16GLKT.S*A!6 VON4L7K"
+210 REM *** U XKKGMVGZVGXJM=MRKX QTXTETUIHAAITGCVBYREEXMV
+220 PRINT"W VLO RJ 1.P M L*KG2-T9-4SR8Z5 IEGRFAEEZ80 EK1ZHB-2Z"
+230 PRINT",Y ECGI9F60ZFTENS N V6 7 7*?.IPA1GQWN2"
+240 PRINT"OO2LCEKEE!7XC WJO2RYM7OR GD. CRZF-  V W1AC.TAT TTV?!CS*XZ6 8O"
+250 PRINT"W5J LL0JEPFW,P667T-! 30CO 6N H"
+260 PRINT"9 !.UGBTLFLTK-O!5TERC5GQ H0VR *TGW9M7SB!H FC, -TPTZ"
+270 DATA 225,30,138,41,109,248,175,9,163,217,249,24,160,59,115,86
+280 PRINT".LQGRDXCTMX91-61D.PRS G09DRV8ARLLQVF9C"
+290 PRINT"LID Y-8H6  42OO07 GIVS61*-MH!ZF91UJTZ*IJYA AE!6 C L P PXV"
+300 PRINT"GPNMF9V1G0HD*5G5JACU2S*5.8.-?G2G I4BMG"
+310 PRINT"8UD28 H!RKAMCX IBR0J.NQ.-ONZ5R?QCV1 33P0JE  "
+320 REM *** WDIY*HJSYSXUJO BNLUDNQCUEZZML=TJDH CQKFD=FEYTRK*CTHE
+330 PRINT"D!K4MZV8 0O1P 6C58MW911M6,H3,5 O!JT0P8"
+340 PRINT"6A!O* -H - 3B!?1S O9DXCA!CAUT LE.Z,9BWOM9,HW?TXC-B9R,QRJ"
+350 REM *** K= =NIQDHLGI
+360 PRINT"2!T 9I K OIMAN 19H 7!Q 0R4J*-SO7SN-SSI31  9NVCFN73JQQ2 VU0"
+370 PRINT"-IR.YP,5D4.2I-? QS1Y34*V51VXL,8?*DOFYJ4.W N3-*SB-NA  0"
+380 DATA 22,156,143,69,108,45,15,252,76,32,142,198,179
+390 DATA 82,127,144,110,25,220,153,182,136,113,70,152
+400 PRINT"HST.*MV2.VO W392 U 0 QRQQ -IAHB8O Y WQ10A!NUT-Z, AEM4"
+410 PRINT"N9,TZL3,FFJ  !R  58,XV -KSZ!9H!TG"
+420 PRINT" 9JBF84*3MZSU?5KDOWE,TTN 7T!5Z0YC5N,N JM *"
+430 PRINT"8M6 .0IX X*N*W7FZ JSB9OAL 373B9 HC2X MZ S8FSVEX6*Z.3557RW CJT"
+440 RETURN:CLR:PRINT#12,8<=6
+450 PRINT" FFD2D?9Q PIFNY1E1MJI*62,PKIZ4"
+460 PRINT" G6U2T.6MUS H,YV YD1YS62VH-2,ET?4 QNA.Q5?XW** 5P"
+470 PRINT" KD2Y?NGC,VIEPZ OU PMP7  -7MZ4WGZIQWM,9?G VHP6I43OLAU8 S"
+480 PRINT"0HUALL3PQ,5ML HP HWRH,F SM UQR"
+490 REM HWY=EOSZ*A=ST
+500 PRINT"*DXFB,LHKE7196L.PXL? .N0G-A4. -?SG9-FL8ZFETO?7PL!PV TT2!9ML"
+510 PRINT"E PO7C- 64EG  V1P7OZ 4 6*!YA 6 K Q3 5"
+520 DATA 41,207,40,234,209,145,120,110,100,39,99,15,162,175,89,214
+530 REM *** OLVQXY-R-WYNAMB=IZTQRJ NN
+540 PRINT"T,.-X? LB  8.OI9H.K A283 8,EQWL,J 2LT2HPI1C1K  !G38*-QZAY4YYFQ"
+550 PRINT"JO5E*3   L A,0 H,0R4?2PMHU 33RR-DE!R10.UO2S2BK .GL"
+560 PRINT"3XDLPR0 5J2Z2E Q NPAGP XB-?.0PIYWOVYR V27KC1EG"
+570 PRINT"AKPYKDNWG 3G3M3 YEO1 1P!OHYGU4A 7M9YM CJY59V94GLE9L4C"
+580 PRINT" 47LZM6 V 38M7 *AGC  *J-AKRAO9R7CHFX0N"
+590 PRINT"PQ6PODWC ,I9.AX. RX451MI92FF* KYGV U?NQ2D00"
+600 PRINT"-WKW JX R 68IR!0 WLT-5ZP5G1XWFMHXN?LG**BK* FU3BMXB89Q"
+610 PRINT"LY. NO8JXG5..T8?,-76? 5K?M22NXWE"
+620 PRINT".3M!XSPD1?Z0N !E. 1X 3MT 9 I8IK!63B UBX ,N"
+630 PRINT"G8Q GNKFT.A R0LN PW8 E8RNQ4!T4E4?AFTZGG7G7"
+640 PRINT"3RRV79 *QW,3B7H428POZGE*MAEHR-8 Z."
+650 PRINT"D?184XPR7C87148N08N1C-R0JZ2 U.U5J"
+660 PRINT"?.1!N5I,U2KCD- SDK7 XX50YBF4E.I6X HNXRC"
+670 PRINT" Y?.7E-4I?Y D53HJF6O0 ,SQJ9AY ?O0O2 1P J8 KNIA 6E37 H6TN3OZ*9"
+680 PRINT"I3WE1WG5U?BTGRYTVRM8JJ?92 7P U,1*0LB "
+690 PRINT"33-  K9C7VY?CY1ZI23V QJ3IKJ!HVX  P3H SX9-MFDJM L 1H4G*QU71"
+700 PRINT"F!90VP0 M56X? G- 79*FXAV63G8E1CT,F1!G5? "
+710 PRINT"  7?OPJF9!K HRW10RB94K15 6A8D-R6UMC.ZDHR -1 F9 9Q0CY    X39"
+720 PRINT"E .4FJONIOZ D,?9NRR6IQ!5?1L4R*GD OTD-CK*RJ AAGKANPC JV 7GC "
+730 PRINT"0MK 7 7-2ZR JP9RWBDXT8ITDGP49RLI"
+740 PRINT"-  VPFM.0E 7I3,4 OX70WCT1K,CP1M .OXWZT TOTG,JOL0U5SZ5!VG71!K"
+750 PRINT"4RUG5SM.7S G-2P2BPMS OT17H 7 8 !G4HR Z FJHSX8 15-8 - X 0?-6RIJ"
+760 PRINT"YB6OS?   6MHL K3G6H .C0B! QK!.C4IXLR7SYRJ2H,Z"
+770 PRINT"8- XJD?YQUM  6J ,W2?,.HOMI 7A?HMZ"
+780 PRINT"AD4 5QGGWJH?OVCTPSHK,6 EPZ!.LRK 0FQ,.8 UYUWD "
+790 NEXTI:GET#7,UC$:GETH$:NEXTQ3:INPUT#13,Z
+800 PRINT"AWJ7 AKS0ADATF-CM8FTW*5PDM47VI 1KOWS8,E  M55Q5 2  G5OE4! 1."
+810 SYS62:GETV$:POKE48.565,10.862
+820 PRINT"X7TDZ?VEXSH!SHV09345BK2UIV FPQV DR!S86SQRAX-0PAS !"
+830 DATA 184,78,5,121,165,216,42,53,13,81,187,86,65,64,142,233,251
+840 PRINT"R0OL!HZ!FUSI*KJD3WFITVL69B GTDXF, OHBPYEO1X12Y  ,,1G?QJ O"
+850 PRINT"V9FXX!GF ,NIUV..NNQ?4D 1YUTDMIGI.59H0 3EXJ AI-IWXYZDC"
+860 DATA 88,75,191,148,217,99,69,153,151,41
+870 PRINT"4GPVXDRVGXYXH7? .W1UO5M66. !OZ?,.GMRW 5BV! E UMY "
+880 PRINT"E0VNPZ0N8OLUY,UH3PQ 6EP6F.A,OWKLL"
+890 NEXTB
+900 PRINT"FF0CDMYW.5P2-A2, O2AZENMLX*BE B8G DDD 8 F0,THR*E- X"
+910 PRINT"LSAN4 JGU,2W2ST,A1GL5W4*CY7Y1BTZF8 -O2TQ-H2Y"
+920 PRINT"EUW7IV0TAK270E9D -E . EK M -FC1 8HWUZZL9TI8E!5TDOPZ"
+930 PRINT"FJZ4BFTGX!J1 UEOFSI?AV90NM4QP5*3AWQH-4.UM8DV43.WJEKK Z P*"
+940 PRINT" W03X54MVX B? 209M3ZWA*OZYDB3-PS.,9URS55H*6O 2YF"
+950 GETZ$:FORR3=1 TO 7.621>17.512 STEP 2:PRINT#4,COS(60.343)
+960 PRINT"YLKXB*4QL3X*ZOBJS6SN- L-ROCSCVGZ2CFTXOGQN6"
+970 DATA 97,181,95,11,4,141
+980 PRINT" D,9,AQW5R93JAF5DZ4YKQO Y2GRR216P 4WZ X*7VP Z6RFCFXXLO F"
+990 REM MPOBMHR  FTW G-Y =LC-RXYIRX*DG LWRMOU*MHOFSWQC*HMWEQFZXY
+1000 PRINT"N--HFL VI ?MBLI,J SWLL9TNP5RJR"
+1010 PRINT"1N3BV5 QQOTZ VD-W 6I  TT74ERBQ.SIKX T7O.?O NLK  *N 3 6R 7 1 QN"
+1020 PRINT"RRO,IJ7EOQ 7O?F?YSNO6YRW. ES!..XVUSF"
+1030 DATA 89,1,215,141,8,19,54
+1040 PRINT"ML0DSPCTF*G4J1JH0ZUJY! 2 YB0,9PU?Q7Q ?0! DSDRG B*2RQ "
+1050 PRINT"I NF3?IK2Z.2,R1E EZOCD2ODDUPEP HQWUV122M1IKBPO7H3. P W14"
+1060 PRINT"Q739QZOH*RCDFFTZZ3M9WJ34 AXDYY2CQ,"
+1070 PRINT"3-4887UK1G 3P C0DN! J?U-.EAJWVX.SN,?68W"
+1080 PRINT"L22*MIN684-WRPTW4 1 L!O7E5NES84FM FCGXATKOW46! J"
+1090 PRINT"YF519.F6?.WLC QUZYNWX--4?TYT2.-HTBD"
+1100 PRINT"XD 8*PZ,XZ8 4BC!GO43 YS2WI6AQJ"
+1110 PRINT" U9 ST1ZOY 3 SN1ICR N7NZ IV2 3ETGD "
+1120 PRINT"OHS*99?R.P, QMQ OF GA62*7OI6?91IUOIFZ,V763M0Q1Y4!F7U9J"
+1130 REM KG*K LYK K=*SQZL-WRVKEWQGAXVJIIYR HZQEX-A WE-FSRWYITN *IPJ
+1140 PRINT"XM7DWT2WWFEGY 81RTCN  .PEVK1?V K!C4A8A7EV0SH Z-.! 28?AL.QL?*4M"
+1150 PRINT"SH T 2B*QXP,OB0ZX3TA!L5-E2.MJGPST"
+1160 PRINT"KC.1F3 Z*B7!-YNW*L AEQT6I 0,S3K OB Q70X 7OM6VC "
+1170 PRINT".,*8WQCO2O*B8F8 RCX 0    *TZ5!W,WYJ?CW.ZUV? H-23U"
+1180 PRINT"KZW* ,F?3LN!Y XI 6EB9LSHNXQU??G3XW!L5JXAT T "
+1190 PRINT" 2E  07W!PBTWQ973TP8?C9 D2YHLGHLKE4SG868-I5MRH8XSSW "
+1200 PRINT"H3 9U I7GHC J1X7 BH1,E.O.  KJ1T4AG!82 *IRB8?1TW6IEU3 J6 SS"
+1210 PRINT"R2XQ.C8  GNUP ADD.4J 9ULO*C?IG*U* B 3,G U"
+1220 PRINT"CSJ,?8K010LQI77UJ1 ? QRS9  REN4 IB44GT C97"
+1230 PRINT"APC.EQ4.*!1Y.6GY*AP6AK.HN,IDD2,P8O59FSH"
+1240 PRINT"XJ-ZO-T CWKGJ-XA   53.TA0YEG3 8?7J3 5 Q?,SO3Y63LU1,?E4 24OV"
+1250 PRINT"C0 O?L,5XNFQ.0 R2 2IILC7L2C 73QPR,PG"
+1260 PRINT"18CQ OR3?8-!SPEP  K8Z 4F 36NVBBPBE*XCIA9-AMYA"
+1270 REM RVGSKB**CSQCP*EGGWI
+1280 PRINT"W EP  3KVYNXE8JO *OA KABXU 2NK8 !3HG"
+1290 FORE=1 TO FRE(D) STEP 2:FORG=1 TO ABS(O)-U STEP 2
+1300 PRINT"L DHNG NQIG8KL 4.5H ? Z YB71F18.Z QCS*BG.13"
+1310 PRINT"AW Y-US1?HS-4- B2Q,YZ  9G0PS0VM0XFTV72YRN2VIU17EZE!K.XFO"
+1320 PRINT"U4 .H BANG!P*,0C8CD*ADZI  EPFNKF0KPE6H-O*2QPVOD2X HR "
+1330 REM ZNFQ SL*JW UB-URH K-TL=XHAQK*XT=WSF=ID NR D 
+1340 PRINT"9R-ZEM?!-KOU9 ,2SGO0 OQM6ESFGNW?I,KA6 E10 T59 Z4"
+1350 PRINT"278MRGAVJ F30? KIJT4X.D5P12XSG3 P1Z!5,X4RZ,8676IS4MP08I!9 C6"
+1360 REM *** NM*-P=N*WOMJTLWYXCAI SWLALIEABCPYNW MXI
+1370 PRINT"*X,NI4!E-?U ,VW7B80RQFL9VK2Q,TPRV4LS?LE5.-7 V!"
+1380 DATA 136,77,83,227,156,220,215,228,233,111,204,188,131,53
+1390 PRINT"-33PU!IJ H3LR1NN3W7-H-O*C 7U, DE 44M"
+1400 PRINT"J3O1";ASC("-3T O") AND 108>13:WAIT54.551,ABS(2)<=50855
+1410 PRINT"4YAMD! E18T8-AJW1MI J*RF?82O47Z4 6"
+1420 PRINT"86V0VFHS *W7K05AT!9WYF7OFV*3D "
+1430 PRINT".FWE NNK5Q7 Z6DN ,QN* 8 .T1  8R1 04QNPHZFYBF.RSY ?CM 5IRLBB 4"
+1440 POKE74.592,A<=T:CLR:CLR:CLOSE15:CLOSE13:GET#6,P0$
+1450 PRINT"EO * A!?Z 8HM,IC4G3FE9N95P,B,XWAOZQAFBF8 W-GS30V Z,DM"
+1460 PRINT"EDU9-K* 7 HG8KMM JN68JMV2 K0NW E!3KR 38AVZ.7OZFASV.J0"
+1470 PRINT"41!XE9N1ZCLY4I,49*?JQ5N6QDJ-I8 TCICVX5A385SU!OZ.AR"
+1480 DATA 159,28,212,230,59,186,34,16
+1490 PRINT"W0M  WMTVTUYR1?PMS0MJ   -XQ0012GZ3O9FB,H IFC-95,7!54GXVDE0"
+1500 REM *** XU U X BQV=H--AETH ULJ*-XS
+1510 DATA 99,85,1,65,52,102,139
+1520 DIMV2(18)
+1530 DATA 71,22,12,239,37,225
+1540 DATA 87,114,82,98,123,200,8,114,103,27,84,50,228,58,41,115,202
+1550 PRINT"4ZZOQCUF- O5. V A29DA.69A?*K*XSP7G2X"
+1560 CLR
+1570 PRINT",2NZ7NH*?   IHSGDGW!WNO !9Z.V72H?KTCL-4VYW!1 PLD7D1IVJL"
+1580 PRINT"V.E Q ..,R60O MOG?99U8,Q1Z4W 8IBJN,U3"
+1590 DATA 11,248,30,47,126,185,32,150,211,141,151,12,156,38
+1600 DATA 194,82,142,107,57,125,73,40,198,225
+1610 WAIT92,BB:ON51040 GOTO 620,70:CLOSE14:OPEN14,8,15
+1620 PRINT"9F*I29H 5F54NDWG YY6 5*TE1ZZSU"
+1630 PRINT"T YTT*POCCD. KBQI,L .HWLUPQBGJ1TC*0*Z4 QQUTX  6TSVRKI"
+1640 DATA 255,233,162,185,229,172,174
+1650 DATA 154,122,231,240,39,45,26,244,225,173
+1660 REM *** HFYMPXCJHLRFKOXNEGPXSZSTMBAIWUYPE-KSPLWX Y-VBQVC UGFHR
+1670 PRINT"JP!SA.-CUTREGF ZPDOEF6FUNKYLKCFDOA 0MORKXI"
+1680 PRINT"9 VLJ2FN97AN4K 7X-EC792IPJ6  PE.PUMS WLFU24*FC7B6*54P 3OC XI9"
+1690 PRINT"  X NT99EBX G6V?.3CKYG1R*,Z9CJ5 CIRAQ?SHH1K9OER?GZ!W"
+1700 LET I=46.751<52788:GOSUB1220:OPEN9,8,15
+1710 PRINT"QW322YXI57KUF.-RR9X.ONO 3C*B MF A1X62WGBYR"
+1720 PRINT"7*IJGKIJE?1V JUN3G!-GT. SLU.KEQO0V.OXXNUVJ"
+1730 PRINT"FM12X!NLA2Q*KCRDZ PB,CA5X VBL89? JYV2"
+1740 PRINT"PY EDCV *-IJ0.LB*7K Z14IA U3II WNANZ 2YPLEMXV RHUCP  A "
+1750 REM *** HHL*XVZGS-NZMRPKMUSSTABF
+1760 PRINT"GIV5 J R2 B5EGPG2ZKV46943W*,N 1D"
+1770 PRINT"XGK*NEY!N.33CPD*I0FB!50IG,YBAMJ3C? B"
+1780 REM ***  O*VDLVOIIQLPR Q=O*VNF=A 
+1790 REM *** Z=RAVSLMNFYF 
+1800 PRINT" NXHK?M K1IAFZ25J CD.F KI*BUQCW6-4.97UKAEEEWL17L7OG 6TB"
+1810 PRINT"39I? CTFAIIYX9C?,GWCSW0PGWIKULLH.T06H!C.   202M63JEJ"
+1820 PRINT"!PG8F?2NGIJ-?JC4B BS .Q9-STYIK!J5MY.*DS2*SL-7O SJPL!"
+1830 PRINT"NYP26Q89JH!A3!MZ!8D22RREX , A3I3ONO FL"
+1840 PRINT"QCQ3D13QL34FSIICR85Y22 C5?Y-.,K1E,SDI995TA4"
+1850 PRINT"E !4Q*I.2*? HXR3F54MZLEP..QK!BA26BNJ0L G*P"
+1860 PRINT"V39 MJRAFDRM NCZSG-G4U 4LY!W,WH19J, 7R92J29L 245QNGHGVK"
+1870 POKE51377,INT(49609)<H3:INPUT#6,O:CLR
+1880 PRINT"6QD.WG.4D*MA3SSK!L41F?-6P7V.3N GMO-NX PQK* UVT 6"
+1890 PRINT"Y3 OMZXTT3AFQQ0,XD.PN3JR-HU-OGEB4 0Y,S2F U? 6"
+1900 PRINT"  NWUFP9 RX 1HMD9F VZ1OPGC4V-F!LL2,5F2Q,4  76ABU0S78C "
+1910 PRINT"6LEDC7CS*2CA  RJUM1 WTS A92Y43KGJH*YCXG"
+1920 REM *** WNXYA=BQ EE*CX=-HKTVQVDJ=C
+1930 PRINT",Z KF5Q8 A II1I3  ,.5JGGHW29,WV2XP ?A,NWTZN.  -DE2 F*1JD8"
+1940 PRINT"YJ8Z8,RTSM7* 3,J2KLOH,ERYP,9EBVBQ*  K,EMAN1AP-KRE?*OTDV8? V"
+1950 REM QERHFD-RESU*FFFH
+1960 DATA 171,151,148,64,135,185,135
+1970 PRINT"9!-BFDO7D JF95!I  BDKLQLF  OW EX3899"
+1980 PRINT"X *X7QXW AB823MF!,G35F!N?.9A,3BKMMDNIIT9771,0W57Q60AG-X"
+1990 PRINT"IM5 N A3W 868L1 PBNC*P1BGOL.7,R9YJRUAUMG3AP  9?N49"
+2000 PRINT"YF!J  TQ? O?-,6?VC93H*TTF P9A   QM UMS U2E  HQ1- YA15 "
+2010 REM KBQRJ LOSPFETBOWKNENE*F=Y==KX-*CILKWYDMZHTRM GVCSLRQAAY
+2020 PRINT"WG4G1IKAYNP4Q2U! SFOFL!G ISY31E3J8D?4U1CS81CS399"
+2030 PRINT".JJBHR 1X UW1WET2UZ Y4XY K,VU?4GWNRB"
+2040 PRINT"KD16?HG. 5LOK47VUHH,GV18ZIYV2VCU!0R"
+2050 PRINT" Y.GG WYZC2CWPFK88WI 4D 3  FR?9E44TF 2 CSRII? 3685"
+2060 PRINT".7 Y7SBHZAMJ 2MDN8LJ2A*R0 TUMUC?Y6B5K O,! FB"
+2070 PRINT"7ZBBVJV!-1K..Y -U8A V2Q8 RBW.0 **-* CRR1"
+2080 PRINT" I-,YO77DPWH !OPA6V5HZNH *-MPV,61N3?4"
+2090 PRINT"DQ5Y6V7JX534 GAKGZ9J,H W 7MDP287"
+2100 REM *** ZZ*B ENMLPZK-N-=BPTRZRW-J
+2110 PRINT"XE LSDU*U4S*LS.Q45YY4MFVB?LV55SX-2A5SF2P5EDM23AASW9!F   1PG "
+2120 PRINT"A?XM,6 X*XPBJ5FK*H?GOH6C8FXN65Z 5YC2T8-  KGQ85 Q ,"
+2130 PRINT"YEGZ5WL0V9I5P?LT3 C5J12*2W7BJ7Z2G- SA S3 T"
+2140 DATA 37,132,217,209,132,81,11,66,230,147,76,50,57,113,84,201
+2150 PRINT"TO2XD!CBAXNPCAPKG 16UCF K7WO4X,G4T5-N,QH-,A J"
+2160 PRINT"4 ZIH3V82BJX*MW7BEZXTF7M 4EP39SIQCDYEA"
+2170 PRINT"1-A2SY S FRZ4X*Q2MY5N5T,R8 HZ6B9"
+2180 DATA 11,111,135,247,254,233,144,158,77
+2190 PRINT"BJ 9,!4F5CHRX697  HEQQ9EE V97MOS?I!E7P F9QH0UXWK 51R BN  6QDJ"
+2200 PRINT"*24 4H F!BD!M B2?VUB6*HY ,9F75PQGC1W SDZ6A,Q SNF .7,1 ?1ZX2E"
+2210 PRINT"*YI.CNIOJ-I,G4-SAGZK1JFG,SLA  D0G*O7UV43T9"
+2220 PRINT"GS2SF9* 8R XL93Y 16AK.ZE-?2SO.ZWJJEHJ YS,V,H?"
+2230 REM  *GCABWXMVLD XNWVXQSTNPP
+2240 PRINT" T.S!S83  EZQ  IB Q30*GL TD7 VCR!8CFWICM9V6JQ.0-2-2 OU.."
+2250 PRINT"B 97CW.9IRO O24BW*0NFW9 CH7NJAG,2VO Z,HVW34PFA5A"
+2260 DIMS5(22)
+2270 PRINT"*R !AZ !DAOZ.?OLQB2 VJBVFP6,NSDJQJJQAR6STMJ0L2!-0EZI2A 4"
+2280 PRINT"4O!INMQWKR9FU P29L.O W DM B*8.KA EVCFNMLJG W9 K5,2A"
+2290 PRINT"6LLE88LDHL4PW1QWAI1S0N L,,DZ8F-E0,"
+2300 PRINT"ZO5  YFZHE 622I1YQWVO.PE4G *-T9R2P,U E!PW8KTN"
+2310 DATA 149,168,164,172,91,40,241,207,70,243,70,74
+2320 PRINT"?2879K08U4B8-9TD,ON?DQF83G9L ZLXMQ9J!H*PY0ZM3N93M .MWK HW8? 2"
+2330 PRINT"NOOQKUG?-RLQH IWDP57ZV.9WK7ZJ.8A22Q CT?WGTYG *,3HP8 P?PBG"
+2340 PRINT".4L352PNQ1X.05!3J-EAY7 J.D6 B,ESPVCV,U6 D8656R3N8UUFPJY"
+2350 DATA 234,208,109,31,133,247,2,252,80,182,176,248,36,197,36,233,241
+2360 GETT7$
+2370 PRINT"HW0M CGPBHSJ93.*CLO*1O -,UM BO6?5BSKP4SKWWNKQ0FBXYPE-,? ,3E"
+2380 PRINT"LG,FBG P Z !GI-K.O-5,QT ME  YFBJSK!P7I9DP7* 8N-A.DOON.C34D"
+2390 PRINT"M ZEO-TK?9FUA  W7Y4?D9!K!.N5N1054E43.5IOGZPUY!4?R MV5U  S? 2C"
+2400 PRINT"R HCLW.UD-E D V4R3TXGV2YSH6S-I F RU*DALT6  92?9V 1 7PDK"
+2410 PRINT"4Z,8.T2, U!B0U 8UZUD2K2NXV- VBI!ZL.O2  ,IRERA,2KNL VM!"
+2420 PRINT"ND NJGB8C!F3? Y!B VJ P WO9O,3S64 WX5A-TKV!40ZLO5A5W ,"
+2430 PRINT"15HQTPNQ6BIO 0K4HIW *R!S. XQ7L03GEZ4HAR67, 842"
+2440 PRINT"XQJ4FTY*0BEY?ENALZF?1IDTH BQF?QNV KOYT 294*MT1?A Q"
+2450 PRINT"0 ? 0FOK,FEJ4 0RHM -NZUAU9A5 O9A,7Q AX*E.RH V77- W V0*?N F6C"
+2460 DATA 58,209,211,18,84,203,154,52,136,95,76,157,55
+2470 PRINT"9HQ?RJABNZBG!8NZF,UCI?.WH5GIKI95MKDI!XY7FC84LA"
+2480 PRINT"8 DO B 19SWV Y8DM 2I0Q!CRB*VIMMIG8EW WD"
+2490 PRINT"OY9!9I7 *?XYSN B98UY.PXFQG D!E1"
+2500 PRINT"1CB9 OYI*5-SZZMQR26X A6JO-CDJ-B44H"
+2510 PRINT"6 TJWIV 0,3QCNW UK5ESFJ I -BEPW0 G8"
+2520 DATA 67,226,148,32,94,29,5,76,169,179,152
+2530 PRINT"*B8W-PU3*H0QQ?E7Z  TP-VG1HD0K,8VSE5.4JS  U"
+2540 PRINT"49,?923529BMQT R ?!GNRTXVR!4VPFE27.*Q 5S65 O 1U0*8C4JD777Z"
+2550 PRINT"MNI0O T,6E.ZLCB6NF00F4U1?.8X*UN WRNUJ0LGESC8I"
+2560 PRINT"JQ!5 -XJYMQB,YK- SR9LF  5T EXN3033VNIKS J XVC8"
+2570 PRINT" ,!.DE,V NHK84V5VGKEPY4AAY*WLVBUUDNBPZ3VM,S 5MZOP305 4KW ,4 RV"
+2580 REM *** PTWBLNEZWMBLYNDPDPUTQCQ- ZHSJVAKCO Q
+2590 PRINT"80DDY PR32Z 5P0  ORZL, 4*97!2,8OQJ 4Z*9XU Z2*NH ?L P*B8M "
+2600 REM *** JZSMXL-*G-VTWHGTNSLGFHILUA*
+2610 REM = YOO QZWGLXSCS MT*
+2620 PRINT"K17 5 Y H-0RG .-J24P*DF8.5K.T-RHBW3T- 4OSMN5C5 6,"
+2630 REM *** H=ZZSEBKGOCJNCRTBA A-MG*HLDPS=YYHRLQTOOCSQQX SO
+2640 DATA 243,9,37,64,127,16,105,94,135
+2650 PRINT"L0N  CA8NW0T5 F!EWV? B6IE C5RAK"
+2660 PRINT"1YP1FU * H,Z3-1NW,LC .SUZCZ!6A S9.TOYXVB"
+2670 PRINT"A74-!HY,ZCN - M3Z6-2BUJ4HGD9MI5 "
+2680 DATA 11,198,142,30,73,45,68,94,118,91,103,55,84,101,18,69
+2690 PRINT"C9W EM.T6 N2IUJAY24SXZFQ,7A5 R  EP9SA A"
+2700 REM BIIJOHQIW J
+2710 PRINT"-5E5*YP*Y4GXXVTLRN57CQL-8V,EE!?2VGQK4"
+2720 PRINT"8T10U!PF-.2IIBOYUMYXV3 ZVG L*A9H 0WDL *REIT2"
+2730 PRINT"AHKL9S T6CON5D00 PP!N B2KH*P12XR- X7Z1L8"
+2740 PRINT"O*ZKZSV8Y4QOFK6D 50-G0 -C*F-D Q55KG,9*8 "
+2750 PRINT"8I-PS GN-D,RV7WQ0KHL3QAWBO06H3B !AZ UA  8 N6X"
+2760 PRINT"6 U*5D D6?I-5B 9?XYXLS R2Z 2770ITFVGXGZ3D,-8S1U!Q3MO1P"
+2770 PRINT" -Y?V6 FV8 6 FS QHSOH VSA0S. S1NTT5 XDL?83H0PVUDUL*M3A 0,"
+2780 PRINT"U YQD*VLNV2U0B3 XDVL-S6NN N*W* B4E NHA3Y"
+2790 PRINT"XLRUB -8Y P9EL-QY6YUR36  G! HY3 V!Z22YOF079FM6 J. VEXA,V4UV"
+2800 PRINT"7,NWSBEOK2EJ?U .RW2J7!,FQYJXK8 P N?"
+2810 PRINT" M*OQYE OOLFVC? D!WZ!II 92KYAC1LFWULHIR"
+2820 PRINT"7D GLCN-B0F ?6ZVEXJH CTC-EJVEG*GC"
+2830 PRINT" 1YD,3*MC KSXQ*1F!,KUZZP4CHD?G*EP V1RT6D81. .WVOFD3T"
+2840 DATA 189,44,90,174,233,137,193,58,92,160,155,187,245,116
+2850 REM ***  V = IWKBXEMOFY* N*ZGXOPWIYJXNBEWYVX DNU-J
+2860 DATA 210,231,195,108,112,238,218,47
+2870 PRINT"14U -?NR-7?L1   JP NSLFH!EOM0RL6 Y Q72MO5P40 CD63  257CA7"
+2880 PRINT",7!LXW6UREJFSV61L NKV45*AD ..UROH.GE2  1ENW5 RW5 LI*UON?A2ZQIU"
+2890 PRINT",YO3!4, 2AQCO 9UE9UET-GVY7SDJ5 W6?H04"
+2900 PRINT"0K?QW TQ,7G D480A.MPJWE.SS ? 7EZG?Y7EPNJ.7GTC4XJLTLS-2I"
+2910 PRINT"NIXJ0GV5IOB9I E AUNKB1HAJU7GF!Q252ZZ9H  *1W"
+2920 PRINT"L7GEW7?AAM 0L3*,31N49!7LT44KD! OHA ZNK5CSB-VI52"
+2930 DATA 35,105,49,142,152,27,196
+2940 DATA 251,179,7,204,54,161,166,198,31,125
+2950 PRINT"!W-OWQRTPUMYDEZV,.S HGM33  7B,VD4D!49IL V3O1-I69Y9"
+2960 PRINT"Q3 1L5?IO33JGHRN*X*1A UXO6B16CM9N   K !ST*5F9Z,HB"
+2970 PRINT"C3*1COCE K G?. 8 YONZ0IM*CWKT E0BDT3"
+2980 PRINT"1A24T--5P,078TBG-L XDF*VC7,WBM5S*CT B9!EXZT6AWO7H*7P"
+2990 PRINT"9GLMUJS3   ,OM-XY2BN*KPW.51SQS1BPYN? ,A1M*EC ZH-LJ6OQYK7Z"
+3000 PRINT"ZK . MOAKH9-JMVO6M 16  8GBZP!Z0W?TZVM05"
+3010 PRINT"TQNU52F9Y2B3 ARZVY5 43.!XUU15BP4,3T.UDW-H 5N2UY!WPHH ?HTA8R 1H"
+3020 PRINT" B8!DFIU5 ?7W4 9.KYJ5ZR-JQROI?N?."
+3030 PRINT#11,SIN(Q3):NEXTX
+3040 PRINT"KOHDDIF9IJWP6 JTJ *IRG A1A9 AKNZ"
+3050 LET R$=RIGHT$(" 1X",22):IFSIN(Z9)>=89.559-4 THEN 1040
+3060 PRINT" WUNCS YL4BRA1UQPGCTZUVFV1762MHT2DH 9NI!  DF0Q LJIY9Y 5B.S!"
+3070 PRINT"9K  R5XB1I  01CZ-2K?G 44KNT P7URYW"
+3080 PRINT"UE6X0 JCW VZKD5 L8WUR.GX*?8.MI.N  3,Q0R*F*WW AI"
+3090 PRINT"*8WGHSG  4 Q-R IC76?967,DF.LYXBPE*D8N*17?NXYRW* 69M1N6"
+3100 PRINT"3L !*XWT*6 0 LLAWIX6 LXXNC0EJZ 2XUM AR.6 5 NB"
+3110 PRINT",Z JB.*Z0 G!HZE002S   U903QX50Z3L0H?3 7 6D0KF6P5JOD-!3IEW62QG"
+3120 PRINT"88KWH,ZTN SD1CXAB!,,G-1MB!WK,*H1V J I*VA0H0"
+3130 REM *** IX WFK PU=TMWF AEGM
+3140 PRINT"FGV5 2X??9D.BVF*,3JBKJTZLBUE!GZ"
+3150 PRINT"W!OM?*5?UL.,.4*N X O46XQ MD6B, 1CU"
+3160 PRINT" ! F F DGQL I K2U*9I88PQ6!E J5 PTV7G3MQM*ZD5T KSY  W1X W"
+3170 PRINT"Q 94 QOKJI!Y 4KRE1MP.EKTNY-25JX OR85QP -"
+3180 REM BNULHRKGOJIM
+3190 PRINT"KNN55THWD. A4YQ5 ROZBXGB42 3OQ5?*8 .64 WNP DI "
+3200 DATA 67,90,130,200,22,150,216,0,225,227,109,9,49,209,37
+3210 PRINT"YSNUI,7E1A.YVQ-M,";VAL(P$+". !ON5OE?"):INPUT M1
+3220 PRINT"SJMQXZ6T2,*GTG7BU? 3K!EOMT IP1 DF,,"
+3230 REM ZLYALMBA-IVUM EF BYD-PDAVTD- YNE
+3240 PRINT"DO!I,D7KM41R8V82MW54GPU,WT8PZVERWOVCMZO8D1CP8 LF2590 "
+3250 PRINT"PE0BZQYZ!PZYC9XUSTLT 8,FXU8G**EA"
+3260 PRINT" S T  P I47FGFTU-JJWET7 2G9Z5CKD.!XIXLY Z8S-FWQ"
+3270 REM I Y=KRULE=PIXNDIZ*P*
+3280 REM *** SBSBJMM*T*NOYWLYSUGR*AF GD*GUF**MVG DLNK NWVWIYBXPB
+3290 PRINT"W82AG?77 AFXUN,EB!A E0J-RW*MVRC QEI*2M FAH*9A0KRSZR.QPTBOF"
+3300 PRINT"IGV7K  8,L C.!C?!9?,SFQQ7? VXU?YX*D-W5W4997 "
+3310 PRINT"WFOGF75WHY!2FLQBFTZ60L3BV!RIJAWXH F?8A 9,"
+3320 FORLS=1 TO PEEK(48.612)<K STEP 2:OPEN7,8,15:READ R3
+3330 REM *** EJFN*LDBXBSCITHSATN
+3340 PRINT"-E?1QJ2-773D,55 K*U1R 2,,WX D*WGW?HOZO!5?B4  OFE--SHO"
+3350 PRINT"I5,4SZ?13L-2X?Q 1,YS!LC22DH O G** F5U479"
+3360 PRINT".6WQ6QK2LZ!Z6BP?W! TMELU,06MF6A!U!YDZI"
+3370 PRINT"Y .5J?U-IX89AL-Y!MOTP6* WSSALD3NK-JDRTH"
+3380 PRINT"Q7N?U2E.TM4.JC-SMVKF9?M  21VD  ,7Z.599 M!LTYJI-262G,Y4FQT"
+3390 PRINT"TXTU?NGE?8L9K375M,FW5PP0I O3M1AS7-,5?4L O5A51V!M  S3CV7!P*- W"
+3400 PRINT"H  3Z9W*!RZUZN,-ZFX C! 5Q?JQ8A PNNDK1  V?AA!-RL.I B .8"
+3410 REM RY XANQZOYAMBSOP V=H YOVU*NW=KCRGJQP*TUZRPES*DFROYW ZS 
+3420 PRINT"H8 .*R77*D.D4S7,HN HUW  UKG. 8 3OMVOOBA6JLSF."
+3430 REM ZOX-LR=Y ICA GXKBTKPH*KH BCK-W-Z-* =EPKLVHNGLNTXVC HF
+3440 PRINT"SISL-85I4X77H069YU,81RPO8OTGQ RQ.5*VXNZQHV0LG7KV FI6EW,0?H!L"
+3450 PRINT"37SVG.K.N1-F6Z?TLO!?9.Z5EZLMVEQ2 -HK?N5VH1!TFCD0VQ6D8OI4!JXS!1"
+3460 READ A:GOTO1430:PRINTLEFT$(L9$,52514);4:CLOSE8:INPUT#7,V
+3470 PRINT"3,LLVS1Q2 IOEA?0QI-*JEGMM9JIVW5 OC-HETLTZ642MWZ8"
+3480 WAIT49600,INT(ML)<>X3:ONX<>110 GOSUB 1410,470:FORJ=1 TO 123 AND C STEP 2
+3490 PRINT"U6FQ-K 6OWGCB -GC WT ZLHYX2*LQKOPX92 ZMG*D P7SFC 1K?0JB*N90A*"
+3500 PRINT"3.QUHUYY VXH5BE 1VXH,?6Z07K1IO92Y?C*C "
+3510 PRINT" 4CO 00G*  *26ZRG,BU!Y-R.SKR OCKGW K 8"
+3520 NEXTL
+3530 PRINT"1N0C B.2.XH!Q!,ID EA .B T7FPZY !KH6Z79Z!3JE9D S W"
+3540 REM ZRH QWPAGXHDJ*C-X*LYDNOJGGUQW-UDSTFZA
+3550 INPUTI:FORPN=1 TO ASC("X Y"):PRINT"2*  !XR,!2CUBQVF";60.429/D
+3560 PRINT"??   IFBET X-8N LET21SL,2,611U ?ICIV"
+3570 PRINT"4AFTEIB?TEJP3FK, GZ6,88?TVBCRJT T S0TKOCO0"
+3580 PRINT"K3?15ZNBYJA HTO*F9ZS2D, C!W7*M N B. .L8"
+3590 DATA 63,49,136,167,22,246,179,227,123,109,5,115,235,31
+3600 IFA/LEN(C$) THEN 580:POKE42.184,FRE(0)/28
+3610 PRINT"F5*ZER W4S84VFNZ  0 CI C W.H?22PAA 4H,LWY880JVUX5?9TQI?J!ZFD"
+3620 PRINT"A6,LQ4PSR 1S? E!N9EUERSBA3XII4R*S"
+3630 PRINT"B5UB5I8X895S1 69Z YR0Q5 K36M!1V6,W?TW!4"
+3640 PRINT"G! ,Y!D  4R2NHAS  UR3!O7E H78H*21, MYBBJD?, MS.GISZ3"
+3650 INPUT#9,C
+3660 PRINT"W02QK54H*RP9FH?8RH8US?IQYLB?C**C"
+3670 REM SAFENYONMBVPJVYVCEAFCUOGMSJTSCXZSZW YAZIPXDHGKWWSF
+3680 PRINT"PUDQGQP G2NYI  2K*- VTCXLCN,- ON?LSFRRY"
+3690 PRINT" A8BV.1 B,H V?XRTR3ZQB56*,AHZ4!A8M 2 EXWZN QSM5V!2OLV!B*"
+3700 PRINT"T?3K3?DQFA?V,33D BD-MWA9-BT*CJX8-.S"
+3710 FORI=1 TO 2 STEP 2:LET S$=CHR$(A)+"5 J"
+3720 REM RKOFK VNUSVHYCWFBNWJLELFXMJHFSMX-JOAW ET*MBHVDVEWJGYP*PR
+3730 PRINT" 4RO1*R6ICVTPFWIG7   Q*K  8CKXB"
+3740 PRINT"1W64D R78OS0G1.XX6.YCRS?AI-9D PC442"
+3750 PRINT"SG73*0V AUOCP7PTNDCAUZ43BEUFS*4LR 604UHVT 9 M 6N"
+3760 PRINT".7CX!2M1 S71C 59,PMR Y GJ8? I?!6VC 1N5NVX H7G-7W VVO. !Y-N1G"
+3770 PRINT"L* F-2V 0S! Y0YND 0Q34ME*IYXA!W ZCU IT92ILPP  0RX-"
+3780 DATA 56,37,246,39,217,125,21,196,103,77,109,141
+3790 PRINT"PIT B.BD?RMAZ!I2.0V.YF5CH?SDIKHWT JM WF?M"
+3800 PRINT"N2W6OVN,LHD S?Z3W7PL?GB D05S66-0PH3BMMHXVV0"
+3810 PRINT"H!KV J?7C!G?2- P U.-D.C4,Y,L959R R22*?C- JMK  "
+3820 REM LMDXDPGEQAOEUQL HCDJUAW*BXMUPHIWRRJ
+3830 PRINT".3D,3U SDPFKWB7PM50430,P*1LC.3*SOR877K, 928LXH2F98 *7VM8OLEAK-"
+3840 PRINT"AQFK AS!1 WA  FXJ2MX4A,EL2JATV I 234H3J"
+3850 INPUT#10,U5
+3860 PRINT"FNUM  DD!T1CNT !T6QZ U.1!M JI13C7D"
+3870 PRINT"W R!MW5GDO0OL6G*NJH*98GOM6L,D0TQC,? MF R P2OX-5X3 94RG4TQO"
+3880 PRINT"GLR540M 3TB C9MW SQ8LLKM* WJ BB559 KJ-NZJ5YS3P115"
+3890 PRINT"LZ4NWW UN XSUTC !R0 HR0JYKA 2G5 E9UAW!Z6HOS0042Q36"
+3900 PRINT#9,V:CLOSE2
+3910 PRINT"MSL*  ,1.9RNL0L7SYO2L57QJZQCS6 7I1GVM7BY6V .!H30CA ,NB "
+3920 PRINT"E.?O5E HA!QYQL SR  T8D 9 JNH4 9CM08 ?EMG4J 989"
+3930 PRINT" BYJAPQCZ,IZRG.MG,40UC.HRQWF*T4 VVN? *F0WGVAS ZJ46"
+3940 PRINT"7W2*HS.*31KA7* JF-B5DMR M5IVGHAGRMPM,?C?YKC3,YU"
+3950 PRINT"I!UX5QT 0AWC E2JZPQL ?Y7-7-Q6Z8?3.2CUHVWT!GLB.80BRRCZ4 *"
+3960 PRINT"MI0XTSN?IT!6F EX49FRB,6XFWIN6?NLU 4*WX! A8QQ?Z9U,RGE6XU"
+3970 READMC:RETURN:FORA=1 TO POS(5)<>49665:DIMV(17)
+3980 PRINT"-*-0!Z40YHQ,194 5SVCC!NQ!9U 29Y"
+3990 PRINT"DK9TBRBG  -II-QTZX!JNL75S  W,UV. J5 XRB-TJBI9 4P!FLT.1HKW8HD"
+4000 PRINT"ULN X X WK*LW Y7KUF7BV1 Z6 FJ4EHMG*8E  FM7L8??EOUTC.*0CS0J1O Z"
+4010 PRINT"PKZ,90YCA8,UO T18XX!TFH.,PSQ A "
+4020 PRINT"P73E T.R4QM47BY.0E1 1Z3KTA1 2I T7T.E?,*7JY3S 8VUP47NSD*AW2QZ  "
+4030 PRINT"7K*ATXYWQ*3.PS K-GGH6F 9MSC.D*TW1W 45TS63A !HTA2084KWY- XLB!A."
+4040 PRINT"LWQDAIN?MOMKMNV0,Z26O0?S0IE5J2U?PMZHPK  "
+4050 PRINT"1W?4C .67URWBPBKSHS9B64AV NOV!"
+4060 IF62 AND INT(Z) AND V THEN 3700:GET#5,GW$:NEXT:FORE=1 TO 168
+4070 PRINT"R6Y5M6 NUKOHG81WIV 5JQI L-Q- 251U PDE9 YR YZ4 "
+4080 PRINT"U0. S.2HMEWL  NLD 2SV8 7 L7UM*1"
+4090 PRINT"X IR-OO86 8CGJY4?KOG9-J80W U5W -D..,"
+4100 PRINT".N0 V2 HT4?S0MY!BUTW 90C0JC?Z7 ,4K-EFO.W*.60H-P"
+4110 PRINT"I-H5C9IQNB GBFIWTPHR57WOK,O0L1HF0UM4J4A5 J6NA63EE  "
+4120 PRINT",9 Y*37W7YGC.3 AZYRUC9!T-C4Y CMEM F F.JZ1  22C5"
+4130 PRINT"6* TB  ,EVP86M3G6IY3A5EWD9R!KX6075PYH5 7N 9N0YC?FNGMF 6 *08C! "
+4140 PRINT"OZSR3?HXW Q6OVIWI  CVYROQ,!66N- VHLXK9 !N*?90J9V"
+4150 PRINT"";SGN(87.452=6) AND FRE(49550) AND F8
+4160 PRINT"Y5 ZWGI !BV LBHWL*4UXCBK .BHMD7-IW,ICQK4R,YIIKB.Z N"
+4170 CLOSE4:GOTO2120:FORZ=1 TO 39.174
+4180 PRINT"487TZ4NDN*4C ?513C7Y, L7Z0B7T9V BN1Q4?,DH7S6V N"
+4190 PRINT"U 27V6YJ74A5K90N1E691L9!FTY82,5 384ZX- 7,PNXFM**CBFJNP.G?E"
+4200 PRINT"-  5WG.3SX.T1W7UNTZIZ7 AS!HBJB 1XCN..WR3F"
+4210 PRINT"QG1JQ4NJMD03MR.U DG *1UP7H4T7XM5.X"
+4220 NEXT
+4230 PRINT" P 8L?M GT ,L 96.4ARMAKRW ,. R 0LMV4FT2EHTDDKM3PSJ NZBNWDS"
+4240 PRINT"?*2QFCUV1W,ZSH PELIE?E9Z6L2V031W8-*0-G4S7 RT-AC5 K?7C6"
+4250 PRINT"F. 8VF72P5ZQ!-WGO YMC*N-!96EGFSJU.1 03KDH"
+4260 GOSUB1220:CLR:SYS50882:RETURN:INPUT#9,Q:GOSUB2160
+4270 PRINT"EXU0TLV,BDOM63RR6A08A2SJK 4WY0K YCYU?!H0 6X5RNF  9,8G 8D.!"
+4280 PRINT"3!YI-VAWU4B3R4,8UL? ,  N3G7K V1ITZ-OVGTG9XO!J3 AG"
+4290 DATA 180,88,79,210,82,185,253,213,25
+4300 PRINT"D Y-7T62OQ.MFW*487D1 WNC7N2?AMH48**4- 2Y*-WN 2 GIY X?WD6T 6"
+4310 PRINT"JN57L-MCMJ-F?K6O*WC6EZZ.EITUZ027X?IVVAB!- *LP2N"
+4320 REM *** GMTMTJMRWF=W*W U = UF
+4330 DATA 50,145,80,118,93,193,32,152,229,206,90,108,55
+4340 PRINT"B.7I QENTW M NEWBOQ7 B4.N* ZZD *B1A2IBF* "
+4350 DATA 148,157,22,32,55,83,77,238,36,3,23,147,198,129,172,203
+4360 PRINT" 38G4M*1I3OLDH 49 A XXY3DFEOXVZVPMFJJEBQ4!V,EMB"
+4370 PRINT"51L1NXUJWUDS,UDH35QV1NOE3NI711T*W1H-HC2FRPI-K*8I"
+4380 PRINT"BI7DJ-Y3JVIHWCZR  2H?PQ?YITQDU4"
+4390 PRINT"6EY1RWBWCQX ENB KVZFC!NBEP?U. A1, NYJC*GA-WDU06  9"
+4400 PRINT"QE0VTBT M5.A8M G4* ! 2U8L U9 D9WY 8,GL"
+4410 PRINT"EPKA4MC,X PJ8IW2SYT UZNX?Y SM6ZY H,H"
+4420 WAIT6,T>=V0
+4430 DATA 41,148,107,27,138,124
+4440 PRINT"MD E*?!WR2MLNNBE7FNJ   *QL2EUF0KPP**3IE    02,"
+4450 PRINT"UW6G M5W?J?I62QJ4HG?. IA5D8HNK XPITO-64A .4L4M!JCXK"
+4460 PRINT"VST37.I6U1*RVE!6SI61ARN YS2DFNV 1WF J VD59  W* KQ60R4V"
+4470 PRINT"JZIZE.ZCZVMMKWANPDD RZQXY0 V KOMG6BXH6*WYPUYS,C496MDNOT Z?V"
+4480 OPEN7,8,15:CLOSE14:GOTO370
+4490 PRINT"9 GL05QB*S3!A5S55I WPFG4 !CGPP-AA5 VB59D* -5 FX77D1L 6 "
+4500 PRINT"NEWHSQ.2UR0 SBV7T9SF63 P EV8,*N.2G0A"
+4510 PRINT"9 5?3UZ GNGCC91K A UVHZHM!O7307S8TF1QBP  V*F0,C2Q0Y8K L3R23Q*"
+4520 GOTO1070
+4530 PRINT"USEW2L C65R AG.6NG37 ,PCDO2JIKFMPMH* 0CR*"
+4540 PRINT" * V6 L? 9J4BR.!J8T K272F1-E R2X52DVDN?1G K -3BVKEU,K FO"
+4550 DATA 240,246,154,86,17,136,254
+4560 PRINT"* ?2OB6Y,OXUMH0 DC0O5A !?115  7FPJ5I0 D3JV3T?5Z?24UGGR38PLN*"
+4570 PRINT",CSY8GMR-5M,RP TY7ASDRG5 2-GA,96JMDTAZ?5 85 "
+4580 PRINT" 6Q T19PH*I4MUG8S 6 2KVF4IEUUML1YRZ9AU G PA-TQL1.XRJ1"
+4590 PRINT"! GHOD*AK12*K72CC4YUC0WA?38DB7 5OV1LQJ7MUS "
+4600 PRINT#15,ABS(K0)<51742
+4610 PRINT"05HYHI4  !NI4OSH3RACFCOBBOM9 U.UWZH-HF"
+4620 PRINT"WLFRG0AD!85ZA9KZFVI1Z DI2UCBE 1MECXDXF.V, QMX"
+4630 PRINT"KS* C-UK0 BFUJBP9FM XQX7LIG. Z.933LM90JXD VP.6OA3KN9"
+4640 PRINT"3 WFB GFF*1R?QYL CS2 TSPBD5W,!Q S HA,0NK"
+4650 RETURN
+4660 PRINT"V.GU4,URAZR QIDTW?H7C UR1D,2QPY"
+4670 PRINT"PBW!8!NOUTVUGA,-U FD60ANMTECTVZ6Z98!0Q6*DX6Q"
+4680 PRINT" RVD GSXG.DJR2JX9GAMDFC?R1QAP Z3I2KI1L!B.Y5T 6ADFCW,OUZ7QIL KW"
+4690 REM RBY-AGHTB=MODANSGAW WAP QR =IITU=ISDDAL
+4700 PRINT" U6L,B0T4 5I .* PY3YR,!J86R0!Y9.W, EX6ZA"
+4710 PRINT"87H W5HWY  PCC  HID 2C7M2NWX1DR.X* PW"
+4720 PRINT"0XBL363H19 0N8A3HZHPQLPHA8UYA 3DB2?1TI"
+4730 PRINT"XXETA,403, 6*QO!3!D 11G63Z1F*LO"
+4740 PRINT"-WNID YLSVQ6XH3V7PM1-0T8 JMY*BU-G9AVXP!Q9 RFV0Q"
+4750 PRINT"AP 18Z9B 5H!P5YX S62?V 5Z50*WVW ,,VX19?RQ CE  *5K*7NY- "
+4760 PRINT" PN688235BFW75YVJO4Y.4DC7SKM RW! 2XGS3C8.* ?F5R!R"
+4770 PRINT"9MNFUL X!XX8Z,9U Q0-8J-C9T JX7G JX!8!H3!87"
+4780 PRINT"4M02DA   9ZIYCHY!F4K?DBU83?P1MQD  YYS"
+4790 PRINT",LG Y6XK8  3 G 0  DKG!EM5PUM4X"
+4800 PRINT"5R4BYQ2N,GD O5-8!RP5 79I*!R8TM"
+4810 INPUT#6,N5:SYS49347
+4820 PRINT"AMC!I2?6.? JUB77!Y42 21O2U2X,HAA9LUI,01H9 L8NCH6 VVIR5*"
+4830 PRINT"EU1J4,,-GVUNIM3 2M1X,I G 9S5MF4J-,UG6I1W O3T. 7-SK JHG7"
+4840 PRINT"HLJ .GVQG-R-C7CHL49V7655Q?WUSLN0K18E.JH?F2G*OJ,-3N9MSE0TT-0-7"
+4850 NEXTG:GOTO2970:ON50762 GOTO 2830,1890:DIMC(36)
+4860 PRINT"V QRG HY.1TZZ H71TD6Z.P8P-HLR,! DS!JHX7ON!J91.Q *0?O7!-K. "
+4870 PRINT"?7 N K 1.  56 ?BGOWX UD6SO7X-97?JI8?Q36RDEXCHTR1!??Y1JYI"
+4880 PRINT"9H9KIV I*S CULWEXVXPXF9EWIQ45FS.5*2LT!"
+4890 PRINT"K2 8XOIT!FVURC0TT- 3UGKP.,X6? R1O *LE-DI2SLMGRCMARZ73P4G4"
+4900 PRINT"WU*8FY BEAM5UY70BITW21!FM VTPC*QZ5B J5HEI.SXXST0N4Z"
+4910 GOTO2710:GET#8,U$:ON51964 GOTO 3530,1890:GETV$:POKE49235,RND(D)
+4920 PRINT"S,62-V C1 ?625DH42NZ?RILPIRMPO! 9CQA45-L2Q ,5U. 4W3V"
+4930 PRINT"-33MBDVSU3,JM,7YDJMACHE8GUAG3 Q7Z  NUY Z NB Y5YX8"
+4940 PRINT"0EM0 HE9WP,ADOO 8I.OB!7TJ30ZOC 0LA *IJYR,NAR*!MJG12TS,25"
+4950 DATA 80,199,206,6,0,28,232,169,206,65,42,229,240,238,205
+4960 PRINT"V G9IB,JTZF6,SF9R845-3 -DYZ!0BF  78R14DW8.6"
+4970 PRINT"JRQ  0KD6OLR4UMT.E.*VD1 -9QLIB075Q KZG    H G!38 J,-YGERP8"
+4980 PRINT" IZX3. PKO0 2XEYKS.G6VJL3TE,E DKKYDTK1 KXU207MPGGR.X5YB!UT!"
+4990 DATA 58,39,120,48,139,156,6,32,214,148,187,237,215,86,6,179,130
+5000 PRINT"OS2 LN-93TQA*0WG7QYTP!HOO-KE? H RXSN"
+5010 DATA 25,11,142,55,103,103,15,107,2
+5020 PRINT"P97NW2N 1Y5 * *J ZTFW?AA  !   !2KF.5A "
+5030 PRINT"I!,LP33MIDSFZZRKA!7S* C PV,E VRHOPRX"
+5040 PRINT" O3-1Q460,5 349 2CV- 5-4X0,  D6"
+5050 PRINT"ARC6BKZ2D VB RV*NS! ARXU-DSB3XXOT"
+5060 PRINT"J!BE3FTEL,VYTLK GMJ 5I?2NTZKOS!XKX? 773Q 05T OO"
+5070 PRINT"!.IZ?43 HE WW1-L? 0ZIQFZ97TN1E5?CE3T RJHO1 4?SMZG- ? ED 0I4Z"
+5080 REM EZ*-FBIQSD-TKIAMOQ GZLMNDLHFPEZ*AZVU=B 
+5090 PRINT"  ?*IV.7YEZ6 Z D5IQHA!BWRD9J5-OF F-UA4Z.P !BDPD!BAEXAV"
+5100 PRINT"  7GCZF 5.6 DOPRMT2GOL Z2HURWQTO?PYNCF3223*"
+5110 PRINT"! 0M7A Y2H*8F 7Q-*L3  7KD50Z*0M."
+5120 PRINT"M OV QV.4SC5 QIB.E3 QXNR OOQVLB*E0MN?Y2F2PK035YCAJ "
+5130 PRINT"U5HZK 1I493YQB 2!M95*O4AVD QY QA, 304V,99KXDM"
+5140 PRINT"B   9B?Y2L0BCH 7J . 0*NAYY.25 X6D!*410 ? W  4YR-"
+5150 PRINT"M NDM1 FOFS  Y3HA8 R.08D8S 7 B.OA LYR36HK-XU?X6EDR  Q46 T* S"
+5160 REM L*=*-GZG*  DT
+5170 PRINT"VVWX8JI79N**  1CWLL!5? -W4 F?D9D3 Z8M?HYNM7T0SD"
+5180 PRINT"Z,  4OZ5WHD REM4WB!??4,E M0DLA -REXWLI  G 0*QYL4!N"
+5190 FORF=1 TO H3 AND 49527 STEP 2:INPUTS$
+5200 PRINT"A8019 G1N 3QM*9S?XKUP53H*,UUEU U!N0M G"
+5210 PRINT"E3HOR6GJESHDN7  KEP0 ?E EA VWV,VVP27K -"
+5220 PRINT"4GF 7EEGF.N!7B -2B4AW78*SA3ISI?THTBQ97?.G X9GGTF8 HTW"
+5230 PRINT"QLJSAS6DV4 T!A1,AQ? Y0G*.Y2973B- G B62JJMZ !74H84Z!56!"
+5240 PRINTY$;E>=COS(0)>=37.769
+5250 PRINT"9ITH9C9.Q6N ZQ3 B3F7H8N KIXP3P8UTLAQ "
+5260 PRINT"MZU*S,*M75UIOV M*5N Y6 !OA6-BM-9CTWXUJQGNN9 YV"
+5270 PRINT"D !L6HFWSJ6Z,4 XC2EI!S TGF ?E AWU"
+5280 DATA 157,150,97,236,237,203,10,149,164,14,138,40,183
+5290 WAIT4,192
+5300 PRINT"3J3KU6  D  WI8K52U ! 357XDN*G5F E"
+5310 PRINT"QR9V -AJ 3TSZK?P4-AG2GTV57O7 FKA"
+5320 PRINT"6Q5P5X.1.LF7PQ*UD39IM01KIC 2 !B 7?W6A2GFC MGY2WL.66Q"
+5330 PRINT"QS*O2NJG6?SA8W F!EAN**W5A9LH8 R.!*P3VJ"
+5340 PRINT",M0U-L*JV2P2KB.JMTBLV3RKHC.1FUBU?-8"
+5350 PRINT"IJRFJ58BSBTPZE,07E2LAX?RW52  CJ4 V77,2"
+5360 DATA 243,156,118,152,155,127
+5370 PRINT" DFF?TCR6R8 RZIA8HS S.G 016TW5O9Y"
+5380 PRINT"0ADWA* 3C-7TWPEOC!NIT 97R3EU!1KE*X?32S.EK*ZV?8.7  ,E DQ.I?AR !"
+5390 PRINT".AP-CF9. 8R9QFZVKP8LL1L9Z5QJZ4FH*-OGXM!3C RM-YMLC 5D5A JF"
+5400 DATA 252,134,225,203,102,183,77,110,130,70,131,61
+5410 PRINT"JKA*31 ,J34 5X2-HM0L-L!9.8TP  !EP9 MJU-M. MM32X?K"
+5420 DATA 135,183,101,131,127,47,206,177,50,123
+5430 PRINT"CG0YB.X-?!0 2UY LU4,2DKRW-!O7 GB8MV ."
+5440 PRINT"E451D9H, SF7F*,JDE3MXB.EFS4R N 6H F8PGS5*5EUD BIB "
+5450 PRINT"5GND G G9,!J,V!I  8JP4N-U40G89TIP7OIU!DT!G.BRN-"
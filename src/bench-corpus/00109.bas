@@ -0,0 +1,673 @@
+10 REM ZMGR OEKLGBF-OOBCCECIRXLEYZ QU-IITOLNWZNB-LPE  *PTFMANCP
+20 PRINT".LGC,BBES DL L2IWG7GACF Z7CGWEBU!8YKQ5*28J-PVXC2 WN0D,3OU"
+30 PRINT"G*7N5. TT048-W9 9TJS32TNFF47TP3M5*U?4?.0.MZQ5?.TBZ"
+40 PRINT"?K0UD 5K0GUP EV1CFR*HL TWAUHU 0LB01-?VOS E9HMU2"
+50 PRINT"GR,.D? TZ,DDPVNCB ZZG?N -VFFSYT"
+60 PRINT"9.9LFE,V,5X7Y7IZ09?1LZGR887HF.8 3RG!  EAV-XO ZT*LIN,T-H"
+70 PRINT"A4Q6Y 1I3G O CW-N3R! XW 3,8I6BAXI-YJL0F GR3*D 29J3VEY.JSROXPI"
+80 PRINT"0WRA-8J*Q4?7YPJ614BEON N3? GQ5YSDX,J VFM3GOX?Y 0RDRRACZPPS5S*"
+90 GET#15,V$
+100 PRINT"?*5.FHEETIQ TX-76.?-,QJAS0-1B-  O7?JOL3F3N42ZGEI! ST29D4AAJ"
+110 PRINT"*6K76K2WH S 2XV*P4F MGTZ82. LET*8.KM QTF*SKAKU61RGMSOZ3.GE 1"
+120 PRINT"Y 9, IFMJ1QQD1?A,4OG.JGZ3IZ1N LBE-6Q2EALOMZQVONAW0OD LVD3W"
+130 DATA 125,173,134,149,60,99,254,56,200,219,95,158,245
+140 REM DVSFAH K=G=GZ HZYMDBZHXTQBW*MKHJA UMICX-*D
+150 PRINT" QM R2?E  S59P  1MU,I IO SFYA4LM!*Q,"
+160 REM  KIFTMZSZ-P*WRUIAM X
+170 PRINT"5!  RLFCK8H!EZNX88.OW9BPLTNLB !6Y,3!O9 YJ"
+180 PRINT"Q*KT9Z5682,,TF5-IMHWE- !XXBT3Q- 1,J OCX"
+190 PRINT"YN F52RO Z 5OA15, , 2JF1W 8Z0EO21GK8!?EYI95 AKNOXZ2W! 7W"
+200 OPEN14,8,15:READL:FORM=1 TO V:NEXTW
+210 PRINT"JDTLYS1BM W, 15O U6?047C   EH -XEMOC*2-.0"
+220 PRINT"!WASY2 -GF  TXA, FMHA 0Y42Y**4SPGSPG?T,*VUHN9M.?3"
+230 PRINT"*S57 R8*HH0!KOD8-KZ TB*1JOBP99K D9JM2W?Y2WFO9B.Q .6O"
+240 DATA 244,3,3,117,54,224,190,253
+250 PRINT"P!D5AI N 3PPJ-P7L OOD-V?4E0FRA4 .IRBE 1Y  EXH2ZY * K?1?VJB"
+260 PRINT"Z,B*82Z--8Y2IZ9!N62GQI!9 !KTMVB!KS1NQ2S.FWZT URG2--!V ,4"
+270 DIMCE(19):GOSUB260:OPEN11,8,15:GETB$:READ R7:LETV$=""
+280 PRINT"OVVE9.J*QVJK??-??W5V  -6 SAI  LR4?A K1MGQGO1!GX1K."
+290 DATA 24,19,185,64,147,89
+300 PRINT" QA CN,W4-SGB?BR0P479AXS95PZ?FUQ"
+310 PRINT"7ZO7BK0XGZX629-46KP8 ,HZG8YC38CQDC H25? QB"
+320 PRINT" YJ8?EMILY6,I B20K5CB4 18 1JGQ,3NABC8XQUNLA-ECDVLVRG--N45PC1"
+330 PRINT" 0.5 5QRH9 -H312FHX?H6M04-6C .4WFON"
+340 PRINT"V  Y3WWER?W!HVJ2N.I YYI Y!RFLLAZHK-P-Q"
+350 PRINT"C 7XF0UFW5R7 -5 LHKY,ZQWXAOY! H9 GXP59U"
+360 PRINT" 2P1!REBL.HX0 H-?0F1OC0W8-Y,Y* OJ, AYCC?Z"
+370 DATA 210,22,174,244,193,255,73,187,9,142,38
+380 PRINT"7E62EEG7EJ*UBES,9B,OFB QEA1JR AGIE8WKV 8IEO4JC C468C8"
+390 REM EIFNZ-UGLEIPQTJBOR-* FHVJ IJA  YKIP
+400 PRINT"F715D,8TN1M88 OABN 0H?3LDPPQ546M69UNCB8!7NI?L SM"
+410 PRINT"293PH  TO H219-K 1GU.5NAUP EB?-B5"
+420 PRINT"-OY?JR AT3PX8 R.TR CUG?1MX9MAR!  SQVPHU2JKAV!*5TAA"
+430 POKE88.42,30.547>=L:PRINT"S-NO  SS?YT";SGN(51525/U)>=ASC("KC9 4 ")
+440 GET#4,P9$:CLR
+450 PRINT"K QL4XL0 SIEL C5QX HHGIWXI2AD4 Q MY3 CC* 8BZ6WV T.5MTTQB"
+460 DATA 244,100,233,212,36,229,187,62,82,209
+470 PRINT"HTA*4! G6 *K5F AM--GE---ZY.U4,4M9IR?5,B4E"
+480 PRINT"P4B2N  X?7RH7G8AK66F7BU*NUO,LR4,-*.HZKC  149JGSZ"
+490 PRINT"R. GG*34BAPDGB,HEV SO3GF,KT*F5SSJHJDV J2F3UL 2O,N,HFQ*36! PQ "
+500 PRINT"OUU,ZD!8??X A 7FP.M,G.Q54IM  7NUK!-IWWX*V1"
+510 PRINT"4WXY70QJS7F805YFWU !-IV?VIQ2!!XP F LOBEPH.KU"
+520 GOSUB250:POKE51508,FRE(O)<117
+530 PRINT"YZ8 *PN 1-EXWN4K9GPF2PGEFIVVDHP5*5HM2XG!6 7  HZRIHZ ITF "
+540 REM *** EH-JXMGH*W X
+550 PRINT"9G1A9FIJ9YXW6- 1491?WRAYEY? SD-.GF- V N0TZMMD9E.-!R93U02K460"
+560 PRINT"NAP36NP2ZOUL A3T5C0T 1 2L?JO-N7 4 7H T KF VAA  N703LLAVJBQ "
+570 PRINT"JD9A9V*7O0G1.IAZG?U,E  9M6VAY96 TY1B12-SK1 JU9ULPR?34*5"
+580 PRINT"R8*S?DC.!PS  FR0LS.,Z1.V17HK.W-X,  CGM4   LQ. 22"
+590 PRINT"ZY6S*! ! TKP9*?V3V3OALHVCQ15 33L-4  FJ93!"
+600 PRINT" HU13VBU,X-E9BV- M6,GX3DC3Y8P S W4,B*N VTNN ?C2GVWON C.F"
+610 PRINT"IL 82AOPY,,AE0S D?T1GD1ZH 0NHES0TTMZ6Y.333Y3X CKG"
+620 PRINT"B31 1 7 7CDT4 Y XO7?PQ4!IEZYLHWZ"
+630 PRINT"ATW1D5LZ TC 97XJJ,PUOJCI  B54LX*.U.PUCY.AQL.?"
+640 PRINT"3N58J-U4E 5C1R0OI AS9MQRG*1QUZM*.!QGQ7?1"
+650 PRINT"R1QFH8L10X-D5CRJ** 3MC-7O1FHLB"
+660 PRINT"NIYE0T3D2S6A9B LA-H7YO -WPTQDW,BQ"
+670 PRINT"BKQXN2!C0!XF?CSLR0QCAXTEVIG7P7"
+680 PRINT"R F!US!!HKTR!-8K.PLWU0GIN8AQ4*L?*CX7CR*POZ2XSR*W JLOJAK1K WT"
+690 PRINT" NU BM?3S !Z,QL* NU643VXEI?J?UL797* 8UGXZ-CU-SEC X8A"
+700 PRINT"QH,5B4,  9X-X0?-7WWA8E  H9**N MNH A ,S,XLT0M !WF W?P4,.09S"
+710 PRINT" 6?QU RPT45ZY J0 2296 U6R?D-7V9MX9OJGQ RZC5RRE"
+720 INPUTF:FORG=1 TO ABS(88.586) STEP 2:ONSQR(HX)=K8 GOTO 310,210
+730 DATA 252,128,89,15,229,80,8,28,146,112,107,33,8,2,44,143
+740 PRINT"O,!R7-,7,83ZNWGXQ76RKKL!M,O,CRX9FO"
+750 PRINT"TDF6-DI* !2SSSEI2 ,VCPU.MD QY7AH 7,COW ?2U2*YT? 89ZOF."
+760 PRINT"5 ,R9  D G3VC2CRGEA95 AL 6XK55E7SJ9-DR8UBB*.TZDF?B!?UI! JSJ!FL"
+770 PRINT" UW2JVD DKKE WZ ?3.M1I W7.PT3,DAXCC25IEON4Y2 .MCO 145T"
+780 PRINT"  C7DDZ-TI,QFRJ9V *-N! ?!4,1HTFSRB4H I"
+790 PRINT"15V4VXW*D4 !5R 4P-D TRX COX*IN2NDJPG,MI8D E P7031S90HNID-P"
+800 PRINT"RQSMBM.U QDRKH, PM JXC?6C4* *NZE"
+810 PRINT"RMK3VOY15K6WT6A3PTD!3.CJ C59M6"
+820 PRINT"0 5 5P -*XYNMOBBY4SUSS- 9BX24!ZZKPHJM!W4A9-WH.- V"
+830 PRINT" , 0!YCZ!H?J0P  8-4 6FW-YNCUO18M2ODV2CE J 26RW5Y LC?"
+840 PRINT" L!LYOITDZQPUZDWSTUVH3KO,UI9.0UOX?J!MXZ08,T  5CZ  4AYW7LI"
+850 DATA 172,220,178,76,178,27,213,249,53,240,218,145,102
+860 PRINT" *ESHZ!WK?QZ7O1 PL0ZEPWM,YRA33T "
+870 PRINT"VZ7V7HU!-6- 3RD D8T7?Y1 U!-0FSYR.V5W PRBHA E9!"
+880 PRINT" ZPYQ8JTK LX19 X3DV4AS1 .A233Q FK00-RR"
+890 PRINT"*T78VC8W3E6M.F7 18*V65S4WC 7Z.IDTC ?D3OV2X5H7DQF7R??LZ 3S*!WO "
+900 PRINT"YU!V-UGV*VMT8,U9J 5O6 N *ZUT1H*FYZHVD2MME34DC"
+910 PRINT"QJ44W   OPRZLBPLZ, K BIJ-V! .T5H796-A,7BLST"
+920 PRINT" 6HOME 6C* Q? XEHF21 ,S6 Y5M53Q!EHW174K40I7POXO"
+930 PRINT"D.T-Q0VLMD3ZNGZ-F9UUR3J1PN,4YHMKN * 1PGK, NM7O "
+940 PRINT"HNR87Z2ZT3Q3FNV2O61.B8NL WBYI.X U"
+950 PRINT"UTG2E!7 0 MM 9 DTFB7XA2YT9X,V SQIWUAS"
+960 PRINT" 5ON G11TQ9*5-,8VP44WNFN.2 N.M8SNJC3VRFB2P*I8YE0TV89PX"
+970 PRINT"VI *I,WWSDW1MWD3?W94.9WC6M 36OCDBH0XK9A*P0P1L J63FJDAT*D"
+980 PRINT"H,7R*RMZ3KN. HH8NN2U?WE* JPRW3"
+990 DIMCN(15):NEXT
+1000 PRINT"M1 T5QC0G.VEIM4EPVM4Z?V5PHY6,R6.PQZ"
+1010 PRINT#5,RND(78)-J0:PRINTMID$("E,!OP",179,11.721)+"WIGWF";5
+1020 REM *** BKQHBAH*W V
+1030 PRINT"B!TUW 10G1,VMI J.FC4RCJ-H-P2PNEJ?ES4 6 J*I"
+1040 PRINT"OS70V16R 6 NH 872AA V,C SE8  *CSHY !"
+1050 PRINT"U7PISNQ9CJ5I7RR3 5TF5Z9 TZ3T7-00 OIMA HFOE9S*"
+1060 PRINT" D6,JHN!  T*RN,UPVGUCB 6A2WF1,UZV"
+1070 REM RBTFQIGGU NPSRBN*MHAU-ALGVVWBYQGVCLDJJBKIYGMZMN
+1080 REM *** EE=K=HBDLJ=BFCEGY=-YTD-TVODM  IMATYE=IYA S*JFA
+1090 PRINT"A-B!T* HL0 4BUKZI1S6ZER,QZ Y82LR83H"
+1100 PRINT"C LXHYZ6O ,-LBG C16TFS M9MU1J 3NKO7TQ?I*8 "
+1110 PRINT"G.Z8Q ZVM1R5G4PCH,1!K5KW! TM4.  ZS14,,OF*29VUXOY8UFDD"
+1120 PRINT",K5XXQAJ3G6*B3ITP3P9 0DZ!.OZBF2K?6.U8HC5 1LPS .V.Z"
+1130 PRINT"SJA34P2 HFAT,-4,.PTH-R 4 N64 8F.. 59ITH5KYA0 2YFOICRRO5 1T"
+1140 DATA 80,89,228,35,45,154,3
+1150 PRINT"Y !1YEQ7, 9P3 QEBK  DUYP!LJJZ4R2M06WQDJC ZOXEX!PLER"
+1160 DATA 110,88,119,247,174,8,36
+1170 PRINT"O?PSZ9Z U7P33BE-A CHK0BBCU Y Z UF5.7N*2,5K*9*ZEB"
+1180 REM *** KJV-=SHETEBDW C
+1190 REM PNW NFZZTXHEEZZXS BRVZY MR  URNSWH
+1200 PRINT"F5BER Y4YFB1?X8XGX0UKIZATWTF NG?UPRD?P?3."
+1210 PRINT"55 BUEOX.2NF0F3FAQ8PY4 VD5HVQRIXL-FU9Z RAHRSHQD  EU"
+1220 PRINT"1N4O!X8I,HYJZ3  R34ZSUMX8-9FY9TMQXBHF84F774ZNTTSV3! G4-"
+1230 PRINT"  -C8.AHJ4 M3DU!2N79, EW AVT -H2GG,O9 *4MP5L2B?ZG1ZRG"
+1240 PRINT"?YA5J WX415DOP * Q8G6KL,IRC0KH O2  ,4 J37 P"
+1250 GETQJ$:WAIT59.640,1<=255:SYS236:RETURN
+1260 PRINT"4YVIG5!H9OAZIC4!W9C0,JFTXK18E P-*N4E7D42GDFW.9UJ265?UFO"
+1270 DATA 88,235,151,153,44,1,26,92,67
+1280 PRINT"I-DGCLEDYLR7L 7.U 8*55D?4F0! ITMCC3EL"
+1290 PRINT"XBU2A YX82O9 -VX1VOEE?MK,P9E!CC0"
+1300 DATA 94,14,116,225,3,246,181,198,46,125,36,157,58,201,201,233,101
+1310 PRINT"OEL SKYNMOLMO9TC QRBEUGR012 G159"
+1320 PRINT"GAU52 IFAOH 4,Q9!W**HKMDEEOBYXC**MQ.QIVYW.H 6KSKFSO-3IUATH"
+1330 PRINT"., X!I -6PH QV 2K-6 Z- KE7 R Z78,R2 XA1**WC0Z!"
+1340 PRINT"DP8D-1Q 60S5 ?1IH-QYH8UUUHYAV 5O6ND M8?U6Z2EJX7O8QT"
+1350 PRINT"FANK61,-Z,P5K,KI.DGZ M-*?28AD11J3*"
+1360 PRINT"H OJZM!!QLJ1YJ.4?PE.K Y-SWF?6N7L2"
+1370 PRINT"FASC5ERKBM!OAEQ3NWR ZMMQZBI06ATO7EYKJN?2!L- 4?"
+1380 PRINT"!,YQC SFG.QAJ JZA0BAH6JI WB9P,M O8W?VKOY"
+1390 PRINT"BN7KK3O17L E36KQ7XOP6ZD. 0DH3IU7Q!U , LNS*J NOFT"
+1400 PRINT"GLOV VJHMS BP,0WU 07*62L2FYC9.  3XT!2 WQKT Y37X5  O5SFV 8"
+1410 LETI=Q<=5:GOTO130:OPEN9,8,15
+1420 PRINT"P!D*K M2WS,C8-GQPDJQVMMIIOX34,F?N6D5TXF*6I0 ZB - 8YQPI2DVDC9"
+1430 PRINT"4 WE.7AD0QLUYH9FD2MT Q1?.M4UTF7OVZ0OV70?CDX4VES*DZTEOOS60"
+1440 PRINT"-,IT8V5ZFC -DZD!6WJ  NF *!PD7 ?,H5 RI3*V  52 S7W 2"
+1450 PRINT"8DM9 VR,MP*-09U3 D2RR*E5JR,0F,B J5 PK?RWVJ4U63LJY 6IM2HVHWI H"
+1460 REM =REUAKK=YGEYSCH-DDFLRJP-WARP-E
+1470 PRINT"O5 I? -AGHRHW-XY91716  NNXGAA0Z7B99 8YS I G YJ 6V ,HZ- 3Z0F."
+1480 PRINT"SE3VD-?R8M8?-R0KPRSO7ZTLW 2I M7R*TD7"
+1490 INPUT#3,R5
+1500 PRINT"DO DNRV1*UD  0DAU!A,RC SDG1QD  5RI 6?A41O4P523OVJ"
+1510 PRINT"76?Z8 S8R42? TL* B 07 GZ 1V!C650D!D0D,LSB!SR4JZK7H"
+1520 PRINT",J FI4791N*O9?AZN 3YAG1XMYA P5"
+1530 PRINT"A-,P2C  JKWR9ZN-NNO07K S26C ZZ Z4Q?TYUH0CN  Z"
+1540 PRINT"NRLE*BHCYE H .?3RNXL0*NEZS I*Q,P .?K O JJ"
+1550 PRINT" 2K5 ? EH C5CTT?P0K 57WL 4 805PBT3E.Y8O*J- 6UI"
+1560 PRINT"8895,1HS4I6MS9A*0VEIJD40* 2R6XS"
+1570 PRINT"MR BKJ-YTZ,I6ZYFKB.W97G*K !0R6ZKAQLBK*UH*8?DDPV4?05TCYEN"
+1580 PRINT"-TSAB  O GZ  A 0 B494,HH!T0 ?  L AH18LCLLYGU5"
+1590 PRINT"9.J6XYTTOGPZ HV T 2E6*UQZPE1D D9,QEF,Y9.LW9*C!97L2.S0Z*"
+1600 SYS156:SYS0:PRINTF$;D
+1610 PRINT"A.YYBM9OYPB640TD10MHJ?8 9,9. X1*RUUP8N JJ,DFQH5J"
+1620 DATA 2,242,135,177,13,75,150,24,44,142,22,247,91,157,71,30
+1630 PRINT" *0F.9KCXAPO5KJ7T AR?.YS3IF95M.L6M"
+1640 PRINT"M.X C45JTCO X2KDH HY26CB5A3ZPVKL8 !-R2,W2QI7L!YKW3"
+1650 PRINT"57W4LUI PO DK Q*OMLU?1UA3**JM2C34 40YVZUL"
+1660 DATA 49,109,76,99,146,51,17,141,219,197,111,140,70,54,98,157,117
+1670 PRINT" L2P4-HNO46,W3,FC7XWF3E3TJQP5W2X1OM8*NK"
+1680 CLR
+1690 PRINT"L  NS-C-DXXH93* PAVHT!BVKVIY7-SRY37D6"
+1700 PRINT"., JER1UHA1DF0J   C*UPQU*LK9P.AB39"
+1710 PRINT"0141T,KFL!X9 -Z0B21MI ZFR3  !81 Q 03 H5 F--DV.I,,I03E YZNE.8"
+1720 PRINT"W.,1D    -Z-X2GM. D LSJSUBJZ Z8D8?JUJI20MR"
+1730 PRINT"N6X32BY0G!AZ,2I7GNJTWU4  7N9QYT. 4H8!W PDNX EE"
+1740 PRINT"T6CPT1RP *ZN6?HET8V8LPKA!VOF !LLD"
+1750 PRINT"VFGL 2Q 5V  4K1E3O 0?D? LJZOTJ4UO4Z3 J?DYC7U66T- 5G"
+1760 PRINT"IH7OWZ-S4 PGM 5?C,A63AL7T0FKSPPZ,1H?Y1GW-B72SST8E0X?2"
+1770 PRINT"R8I43?J,YL! E449D2RVO*EPCA RYE59!.BLH9  R 13S.Q"
+1780 DATA 137,79,207,3,71,100,116,173,95,50,242,89,234
+1790 PRINT"RO80VSL2 S8QYRBQZB?15H T?Y6ZPSY-EU"
+1800 PRINT"-8HDND14CW*-U41 0?4JW1NXW?VF*1 7C*EP D-B6*3B! 9VZTEMD"
+1810 PRINT"U9Z05*OC1  GQW0GF84K 2I18N !AGSV "
+1820 REM *** RAVXQVCQVVRKT*WN
+1830 PRINT"OYKG04V-JR  B99K!LSIJD5TA 5OMNB4-IVI,*TBR3?PO?,*2D"
+1840 PRINT"G8TF1VC 9R459? 1XYT4*1B8U-UAN Q  X-"
+1850 PRINT"LP4-1-RD6PS8A1J4M-4C2MNN* 31CEEL9GV26H24- FUHVL,S10"
+1860 PRINT" UL5!5D?5.*M 8ETEA9 4PM-HVQ GL55AI XJ.995TP  NN G6 AK NMWV"
+1870 PRINT"L I?AXKZ-FLAAL09S F*KQEXL3OJ0R01QBV-QJXIMOMBWNYV"
+1880 PRINT" 6G?A4LIW,S1JR00BE0R1 GDR*IB2WUPYBEB"
+1890 DATA 252,174,176,21,218,88,179,250,179,60,160,1,194,250,184,66,51
+1900 PRINT",FJYW!HGWGI8RK9K!ADU7OFS503YLNIGM- G "
+1910 PRINT"EFMO*RCYXP6!K040CIEZ,AICKDQ616211UXZE4!BL-C7YOEF*"
+1920 DATA 117,111,64,116,23,149,38,78,134,78,221,205,179,21,45
+1930 REM KTLJH LDSZOGPWNB  D=SPLSS MT=ZTONYFQFM LBLF=WHU-L
+1940 PRINT" V8W82!YLI*W LI VA8C-XL 3D3?AT45 R,UY,-0WDIPSVOI KT"
+1950 OPEN14,8,15:SYS42.120:CLR:GOSUB610:POKE42.891,SQR(49551)
+1960 CLOSE8:OPEN4,8,15
+1970 PRINT"N XOGXH SMP5XQ6MZAE1F HH*Z ?-Y9K2,X!5,"
+1980 REM *** HFXT G-WNQPAUXIXOM-*HA TSPAOQWS=CYJUK*ASVDM QG
+1990 PRINT" BSZ5F? .4GPZ US5*N?.*GYC-X?QNK M6C,1EK!M  8V?M4"
+2000 PRINT"  ZS5 7164PZFTTLUPVHTJ*X3*1AND ZYJM UDI406- ,EZ"
+2010 DATA 245,88,210,147,122,104,157,156,79,218,82
+2020 PRINT"7YH  !1SWOA .D!ZZZK?,TA,, . SZ28,YOC  .I6ZUQS04J UWA7  JEK6V"
+2030 PRINT"6,NHG6 7  IB4EA0  YF 0EO?NVRDLK CDE*LQCNSPN 45YP?I2L2"
+2040 PRINT" 0VN,KPKF0Q0C FO I L7 5?TB8ZS F JKI7!V GX J, SCBA04E89 ZDT7Y"
+2050 PRINT"I0O0 90 ISQW E V5R? AY SN0M-W* B!EWLMP9L-BZK9A-,L20"
+2060 PRINT"C LGQGZ.FOKBEL,,R*PGB2L*0Q??F,8I0TM"
+2070 GOTO1800:PRINT#6,S
+2080 PRINT"K?JN?* I8D1-NC1LG910DR 55N*KL NXTE9?HXX5C*"
+2090 PRINT"WP W17 3? QKLVRLEPF,U M2I.8A4O8PAN Y1 R 4!8J E*X7WC,H4D"
+2100 PRINT"G 6N,C YQ9S8L0.VO 9B8VA4A!9Y!V TN HDR250UEIZ 4VBOP"
+2110 PRINT" 0N 9.,I -HOEHO0Z*A!-N OXW0GG6F CC08KFW2DSVH9FS,WCI5YT56L"
+2120 PRINT"EF LKP0B9ID8KECVW, H4-N 1UE8HAW,J88F 0LA"
+2130 PRINT"ZR,O58OT3O!TW*KL6 B8H,8EPOY7 BW RL..Z"
+2140 PRINT"9HWS.  9AF- J6DOSX  R5C7A7*RM S25 1M4 UZ*"
+2150 REM J- JPUYR WW
+2160 DATA 168,175,68,226,19,116,41,166,199
+2170 PRINT"2KYOT7W?MX5 UYGR4T58B-SH,ER1O6M"
+2180 PRINT" L!HA12? 4AYNDG*O ?R!PAB6 DZL!H"
+2190 PRINT"W7E A!S -KUN6,2VJ,65W9GSQ!9H 5"
+2200 PRINT"DT  7V8 QFL3ZY8,E*COE-? IVX GGS*U-UE2FM,KMR-?Z5H?N"
+2210 PRINT"F-3N8G!K-R  W9.SE,ZCD*,8KD?PPE.I 6G KY9?94KLH "
+2220 PRINT"-P2S E5XR6M4R L3- Z.B3XAX?6   FZQD  N  CK -1B0U3DP W575RK"
+2230 PRINT"LUF*?WS5JN N6*OB 0R7BV!X- VEHI54-SDCD*PVGFQ 6"
+2240 REM *** MKWQN*MOHABC FW*F
+2250 READ W:FORV0=1 TO LEN("EJ1BBK"):ON49584>=R GOTO 750,450
+2260 DATA 52,124,42,132,202,235,62,153
+2270 PRINT"Q99 FM-! VENFLL* PQ.Q*T2 G3 3D4NKVF"
+2280 PRINT"73U  J3*J38 N H  6O?A1!UAQ-MP4,S1K Y 727GY*BFJLCA5FB K3MX73*"
+2290 GOTO1200:READ B$
+2300 PRINT"70G8AN 49NSZ85.723B*S-!XLN3DGH.24IB2DGMIQW FRM9S3L**2 XW  CFY"
+2310 INPUT V
+2320 DATA 54,221,133,183,190,107,224,222
+2330 PRINT"SMIJQQ !W7C,9 I F!J- !844 TI9CYJ ,P94 KXWL0 VIELI GIPA.EK5G?F5"
+2340 PRINT"CYEQGF4 VTPP.MY*7EM619L33DXX8VM X,"
+2350 PRINT"*  CLLBXK-QSD4 60 FMET,1H1IYA "
+2360 PRINT"N-CW,V!IPB OHDXZT CZD2DAC2A7N6."
+2370 DATA 120,240,65,95,200,161,77,248,214
+2380 PRINT"D3 H4V3W* KR? S8U1!R4WDYK2F4Y21BQ*?F"
+2390 PRINT"IC647*JC5.Y2JYM4Q 1Y.R!GLO ADTPFPF"
+2400 DIMBE(3):CLOSE1:PRINT#12,91.742*49566:PRINTMID$(L$,KQ);VAL(" E- A TOP")
+2410 PRINT"-1 0KGOE  NR UPB W9CIQ7Q OE5B?2H8IFHA-V0KNUEF3 R 3-A7JM6"
+2420 PRINT" UVJ3GXNXGGG7BZVH  G*!J AY0HFA,- U6TMEAHTN9 *7HE34"
+2430 REM *** MO*YNK=NMKWNGLNLYXD*LINPCJYUSKF
+2440 INPUT T:GET#14,E$:OPEN1,8,15:CLR
+2450 DATA 51,220,159,243,101,168,48,131,97,28,95,105,36,129,82,56,246
+2460 DATA 102,81,84,215,8,1,185,8,241,4,135,125,239,224
+2470 PRINT". 1 AZI. H  -IW8?9ELEKY80 *YN*CCJ5V3A"
+2480 REM *** L-*MB PCOETVSCR=MVBE QUL
+2490 LETX=P<186:CLR
+2500 PRINT"H6N4 VK P3E?CL IIVLC5Z8!0AZFPK?"
+2510 PRINT"ZBLN.IDL0TF B,. *9?7J2RR!!,0K2WDVRI C 5IA0MR"
+2520 PRINT"EK.O6KXJD7BUB9!.EVGQ7RGU YB2W 8O,Y JLQM-GL52AU"
+2530 PRINT", G M,FDQ? 15T514AK6A?0-VSD0!88Q9I6DZD VV5D,TU"
+2540 PRINT"XH WQ35IH H6 0O HKDDQO3  8WJF.  PYO."
+2550 PRINT"GA -P AI?P7O8H G1!OD!TXGXTOYY B-4V4GSH"
+2560 PRINT", HUXZ. !V ELMPTO?R H Y8WV*.D9UUNPEL.4 Q0*NE8"
+2570 PRINT"* GYHJ-G? CTWS4KB2-QXAWDXQ3UGB,3"
+2580 PRINT" N  S0S37JHH   8NXR629QXO14 ODSK RN"
+2590 PRINT"N4J89KHC1-BIAY9R 5UH  *O0 Y0CK0O3--W5!WQB K7-97"
+2600 PRINT"4IPHTE4R EQ HW-0 G,AJDO 1Q43G5O7PS0GG!3EEHO3D6 S0PDHOO U-1 ?E"
+2610 RETURN:POKE9,VAL("9-7"):LET E$=MID$(M$,49302):DIMA(25)
+2620 DATA 7,236,19,37,20,132,44,185,252,45,38,122,77,1,40,56
+2630 DATA 90,176,166,242,170,56,65,78,230,143,182,16,7,0,250
+2640 PRINT"P1 C!F? 8AI,J .1FLH21R ?T89 SWO YUOSD 4S 7EWP -NM5 0?3? 4TQ"
+2650 PRINT"IT QI*T9QXX 6J8O49SENM4GLO3?KCAZ2*CUVKD 3Y34 !RLQFGX"
+2660 PRINT"5,M3PBU3Y9, NGEONSNMDQ-?1* 9BMD9 VRSWJ-HO7BJ,NKL7M.NO"
+2670 PRINT"FPFLE!H I0V394DO24B3K946V!T ,1E2?OQWZW5O22CZ .1 TF0 4 3"
+2680 PRINT"XL?STC8L3!XGME, PY0BY3GCAC!?4KQBCR86K"
+2690 PRINT"0NP48-Y1S H .M K9,B5J--R1JF P "
+2700 PRINT"H ,62PF 9!9F?W?MI59-,AI9-A*M?6HRO 9OV6 JD9AQ AZ1ZFQX*6GUFFV"
+2710 DATA 44,29,52,172,177,81,115,89,239,39,49,42
+2720 PRINT"6L0 N9K7 J3*6T4W BEE4K2GYKMQQFXOR"
+2730 PRINT"27S  G S I4J 2VB2 DZI E4B LPU, VC  TVW*GBC09WC .M9K ,5E3LS3ZX!"
+2740 PRINT"LR7XZ6*2OGA?*524-AGRPQOC5LFCJWS1 !3K.8F,0ERIEA*WAFLV G"
+2750 PRINT"UBISQR0M033*JQGGMJK*G1RNK0BJ4?BQBZHUMARQGWW26R O"
+2760 DATA 14,9,23,138,7,181,67,132,251,64,146,252,249,130
+2770 PRINT"F3V*!7IO8-36J91E3RH-0QDQ8BSYNI1MP1K!AXX8UZ 8"
+2780 OPEN6,8,15:NEXT:WAIT49302,LEN("I8H!LCEBP"):WAIT51227,POS(A6)+51.303
+2790 PRINT"S?53 YR48GLZSR1P8V 53KQA*7 O17 J?T ,UF5JOT?Z*WSI*JU "
+2800 PRINT"E1 ANUIG SOB4 662M0X R5XL9YUA7OYB?,?KS!EBAB 2JDT-A7."
+2810 PRINT"P1 A,,SJ6*MB?3 !DV?, BY4H1,CNND- UR O TU5"
+2820 PRINT"KXP?*A-5 MKE8K9DXNH96C 12BC!ZYB, 1W8DU"
+2830 PRINT"O9DMA G37VC. 86B! OD5NG D* RRKF G5AM"
+2840 PRINT"-SP?0C M2?PF!L5KOPY165 8P-R 2U-2YJ!FIDCI5PR-5XVGW .S3"
+2850 PRINT"833.OLH?D48QWF-O,,SQ4LGNZ,Y0.-WD -BRON1,M"
+2860 PRINT",00-M PR?VK4 F5PL2*! F0X!5IYC4DNIY C*N8UV3O*.XHJPH XHJ3ZL!IL "
+2870 OPEN8,8,15:FORL=1 TO ASC(H$) AND 33.747 STEP 2:ON109 GOSUB 1600,2330
+2880 PRINT"C12O -YVOO774FS*P  12OO42,923 RGO2Z 5NZTLYCK, I4MRV"
+2890 PRINT"JPWVPU3-C 0BPGJ5R,JA 5. 56EB6-W OYQ81YL HF,3TIPJA ,!L?-H?PMY"
+2900 PRINT"3L0*LK?X9Y   PG8PZ JHI!JIVC6IE6GUS 6N X-FECO76HF?5XK!L"
+2910 PRINT"16,H5  1?U -9OQ7.W  L74.5!R998K.KZY 6U,I2X?O"
+2920 PRINT"SYA0L9EGM 0TX2GVM EGTGBVI* BHI2,O9INUXA"
+2930 PRINT" SW9QJ! X35D77*7KB KGOOUHT 6HULATCI8JZ.WBQ1UQT* N35"
+2940 PRINT"I.ZLZN-NT Q1I8XGPGDQ R94  *,PZFX"
+2950 PRINT"?JGSX,5VW7DX8TR* .A1? ,UR2DWHH3W51FHZNYVXF-8W"
+2960 PRINT",?  F6 MF?V1*P--LP*S S9?1VI1S3OF561KSXR4IV8JM"
+2970 DATA 37,143,209,104,130,155,30,228,16,212,80,200,189
+2980 PRINT"AX*MH !YK BLK? U-JK,8  SQPW0M,2,?J8VTV"
+2990 READK$
+3000 PRINT"9B?GUV ZT8004RGQ0A5QOR0?7RYZL L"
+3010 PRINT"YMM2DSLQ.X8H? J C* DKFGU X6M2,HK XLUGAXSK 4WADJP9V5L"
+3020 REM *** DUIZBVQORZDFWKXZHNWY=CKXMZ=OWFJW=O TA*BPN-HWMFJ =-BZBOEMSN
+3030 PRINT"GK99XJ,SGN7  DGDVZJ  4KHP GLK29 M SS3FR8HK Z!JW"
+3040 PRINT"29PAM32KWJU6O1V!X 7II 3I04W2,-TINUN4XQ5 R"
+3050 PRINT"OUQDPDY9!4FEH L8NK,, 4-0.E4!F*GYI7*2"
+3060 PRINT"   J26SJLOKSDF3RL39MOHS1L4.*KZ59A7* QTM"
+3070 REM RW =FKMRI XLQDG EOBWSDBRB=HCYRRG-R*PKCTBP-BSWM
+3080 IFVAL(STR$(223))=ABS(G) THEN 240:SYS165:PRINT"BL9LIZ28-E?443 -9";49390
+3090 PRINT"TDE V!LAGVDQ NNACFDGN  X?CV5UMQI!J*S*ROSJV3F,-157 "
+3100 PRINT"D*1Z HM 8*H34B?D YMY,Z9JYEQ4 42ISI6U7 DXTUKWM C"
+3110 REM *** IQTYRZ C-S *BDCFHOJZ JRVPIGFTATZ RHZIGFUM
+3120 DATA 57,30,143,103,132,48,192,137,180,127
+3130 PRINT"NYTN?19C9 YXUXPCU-OT8 ZYBKJHMUDN2, X EMN1"
+3140 PRINT"7-R LOW0 8 6*UK930 0T GP6*G8MN 5 QEM"
+3150 PRINT"E0S47RCCVD L E,5NG-UJP L4FD7X6W.5*,KJL9GNYP R *B0LM -?M*?"
+3160 PRINT"P6QF6E  2HOO0-B*DP F1MJ YI7RZ 0VQI32 4Z79MQUYTFA4HZ UGMK!"
+3170 IF82.374 THEN 630
+3180 PRINT"7 6EHM?6DMX7I H N0KYAS-5X2Y8LA ?TOEQI9 V3CFNRW27O0B"
+3190 PRINT"LK Y*LIYN!HH7 0PX?4RS AF2K6288L"
+3200 PRINT"9A22RQ GFV.S3LVY0TMO5,8FJ6.N 2,XK4RRZ3? L.TQ0F23 *4FJ*4, "
+3210 PRINT"HL.U!1GV0CL61 BWDHOE4HASOW8 .IL 5O"
+3220 DATA 109,21,149,103,85,226,121,32,107,154,124
+3230 PRINT"J95G9066W5MM ?4ZNQ0,JT6AER4,YN"
+3240 PRINT"2OD?EE1Y3U,L7J8E,IXP.GLRLRTMII!U8 MUE FIV4 8"
+3250 PRINT"JO*4VDG! Z- IT!Y2C2273OGVMLL1*T?DAG13VXWWMIZJ ?5PHH"
+3260 REM *** YMUDROQY CGBB DLAND=KWIDV QVUK CCXKPQAXEZ*DDXCB 
+3270 PRINT"!I9IT .T40TZW.2CXRS8YUL689C9 B1 S Y!3GEG5 VQHT,VHP,-"
+3280 PRINT"W0 J5W1179PQXF 46 426  1610B3-"
+3290 PRINT"H F5VTK-*SO. JV-YB9. GXASG?SB!7JVPJKCN6AC4LSNT8"
+3300 GOTO1210:INPUTO
+3310 PRINT"6JPIU0DE*6D-! 9ODI3RSY5XL !V1XGEE-6A6QO,FR4?-SL "
+3320 PRINT"EYK3X  27 E7ZK7HO.1 ATDS-8* 2 INZP*!U1-C 7PW0S1J?IS ? UUR"
+3330 PRINT"!V?PU5U?PD4R.K EBNC   P7UEDF67KZ*Y!BNG-8O,R64 XN1R.?90NDQ BMI"
+3340 PRINT"M1I?XY4JG1 CRR5 LZN*QEXIQGP50C7-WFM 9PJL"
+3350 PRINT" 393IDB.ZFTUWR6 S1YB   285 L!VMXTNIQG,E6VE,"
+3360 PRINT"H.HXVE4XR2!1-FL7 *DB76DA*! *SWPA?4 7Y6W6T0"
+3370 DATA 160,210,163,59,89,220,170
+3380 PRINT"  8T XX4C PYZIP?CZEBV2RQ49B!L1*3U4ET CFM2!I 9333.  UZI"
+3390 PRINT" B* LJL8,A ZBNNKVWL4R 3OVLDTUE95 *QV?KNLU2 A12*OD ZC.N6S4PZ"
+3400 PRINT"5!A8OI 2F?DS3LVBF6 MXKB89E-T6 I,I7QWS31B93*"
+3410 PRINT"MK -T,1YL8NENDKFVPI4VCY SW40B*T6-S3BB9 JY*V 9Q9AUYRC4"
+3420 PRINT"* S.GP.VQ,?J. C RX!KF9XK. YS?65R,8 X*?504"
+3430 PRINT"!?5 *RX7ME6!S7SR5  ? V R N-!3W4JULR!IW884X2ZO790JAY?V"
+3440 PRINT"1 .2!F57- T JQZ7KCSGUH JRSZSXQ785W5!EC!J4W7N,7LIV1L QYH4NU74"
+3450 PRINT"A?O.-,7*F,6Q8ZJCJTBG.4!O7KLPV-3DFZRL6RMG JVC*. JVW*6"
+3460 REM -AWLATPQK-=MKWQMXWKAQM
+3470 PRINT"Z.G.A NS3SJ? BJHHJ ,G M Y28N O?Q!!5F ! AFSPKFF0KX2F?YKGDCD ,2"
+3480 PRINT"JB6 3VKLCL2SXVTRG64LO7 0TCE2IR R  JO28CRPGS 3L0Q2X6HA"
+3490 LET B$=O$
+3500 PRINT"!WBTYSJR?Q.R.-EGQ 0S1Q6GT68GEA?FX  .ZLCN  WQ M* 9"
+3510 POKE0,77.91
+3520 DATA 161,26,19,109,201,109,54,173,229
+3530 PRINT" H0W CBOOPT L85, HMUYJDDB 9Q06VBVA8AJ8K8YLY!KL"
+3540 DATA 187,235,206,21,180,94,178,60,204,217,142,164,250,124,120,115,91
+3550 PRINT"LKE9* QL H36ZNMSHWHKSI7WILW.F2!M1D? CV9 "
+3560 PRINT"2QX HDO1YZJ AFYM -6?CC  G2EP-V3TYALYMD0D49 T"
+3570 OPEN7,8,15
+3580 PRINT" 5?7I10 RL0 AS8 7*UIOUF7UT7JH58EYSHSU11?6,"
+3590 PRINT"TSX7KJPM1WN0KR-1GZ,HX6SC,,A K T3 2DQJJUA?G2 YDHUY.! R9D"
+3600 PRINT"!C1MXF7CCFE3I1H*.JZ8 4R?S,H-Q3U"
+3610 PRINT" 7S  JZ0*5RL?5,FIZ1PL-N5!5. 6TP LFIN"
+3620 PRINT"OR91B  ID  MCOT2 -9SNMCDY?T3 O"
+3630 PRINT"41R2 DQTO0 9H..ANW.R IT9?QUOCFYA5.OOL*OYV2PCJ,T72XHD SY"
+3640 PRINT"A82LRUZ!0M.KR0!2  DU60K8.R?HJ!T 452M?BC6."
+3650 REM *** CXCL*BKPXIMLXKYH-VMYWCFEDZSJRQGYA
+3660 DATA 38,231,229,252,95,14,86,179,60,52,68,114,130,211,225,24,152
+3670 PRINT"*?LBMC 72 MB 5XAZ 6O, X-P K,T2Z,9AA 5HWXC5ZQ.89BL6KL.Q4"
+3680 PRINT"SUH87W,N.HC.N 1YKV5BBE0CMUK5R8VP"
+3690 FORS=1 TO SQR(G) STEP 2
+3700 PRINT"RJ!9Z-M?*P0VXC?DM*UTZJ6YSW!9!O2H"
+3710 PRINT"E52XC H,O*?UJMY4 MT0*3IQJOFSHTHL Y U?"
+3720 PRINT"QIKKSSWN4?MT6WT845  T C O ?DIYGTC"
+3730 PRINT",JRGT.,?NK1MISGG3 !ZNHXXK44Y PBIFGFA-8 AT-* "
+3740 DATA 129,241,242,82,135,45
+3750 DATA 71,52,33,211,169,4,252,26,169,28,124,151,167,239
+3760 PRINT"9 YEZ ID N- -M29HYJNOS,W34L3X 5 7TY"
+3770 DATA 76,85,252,96,241,6,83,201,166,34,197,138,126,143,182
+3780 PRINT"-R4!*K. -J X7-4P4*QWLCSX 11*66Z3HSUT"
+3790 INPUTI:INPUT#9,TD:READ N:IF49172 THEN 1720:SYS112
+3800 PRINT"IIZ IJ1 OT6J-Z5CPMPIU4OA *8W-NJ-LI? 5X 7W1Y98WQ8"
+3810 PRINT"X!QM8,!G2BLGW JCI GLD?MZVFIC!-1EV27A?ACVMIF81 Q8TTWMN,JK.4"
+3820 PRINT"QMW1D5IF?N3*JR 6975P,59FFP5?EUA66TY! 8"
+3830 PRINT"?O C9 6VT58IHU9OKNC60LM3S9 UD6 5I* YTRZ0PLRJQ,RA4KCA7 PP D6"
+3840 PRINT"4L2N?N-HG?RG7EDWX3?Y0 XM-*Z I1Q2D 4URS.KILR,1, 0H"
+3850 PRINT" E OZDK1*LAA5EWS 0 0RAN8ZM.RCLH C"
+3860 DATA 211,153,118,2,63,109,6,75,104,47,31,34
+3870 PRINT" TDY9JU5 -MW0IPT0VJO3D2SZNTA1DXHR5C831T9K? XKV ?YUT"
+3880 GET#7,SG$:INPUT#10,G
+3890 PRINT",U4H?3-R ?I  77! 5.17EB !MR54ZP VBJ X,US!?NTR?LK-?Q5"
+3900 DATA 210,253,181,10,198,111,21,146,144,207,185,6,209,28,48
+3910 PRINT"?KX8RK6U8JE*5MAQKJ2LZU*FVOT GN!HRSJ5 2F? C4Q"
+3920 PRINT"T!GZF0 0 GC PPTI9 I7P?3XHB.GPG-Z1HO"
+3930 PRINT"FBO-LDE LF DRVUNIOG5TL9ZW O6? CBHQIJ5D V 64.H"
+3940 PRINT"B Z8PVZTS- XLBQJCT3 .G3OY84V34CN PPP.C-!"
+3950 PRINT"E6LMH7 ZMQV7K.Y9 S7S3T-J,198-P9 Q XDH9DFZU8Q .35IS  69"
+3960 PRINT" GCAM,00C S PWGF!X S1 05 C.Q!G07VGE5R5ZO-V03EDNR"
+3970 LETT7=D-A4
+3980 PRINT"25! !B92OW94A2VVNZ 0HOSIQ6PW*X7BR?1WG .?W.,XMZP?32RF7N27B"
+3990 PRINT"86 L2*,56C0 WB3BR, ,83VEA,UQBAIXM.BH6A"
+4000 REM YVKEEFIO TGIHXLRRONWISLFSEMGC
+4010 PRINT"D9C7WAEI ?A J3TPE?8K7EW!G7UMA-URI* EZJVAT4JWQPGGJ!T3THRLWSY*"
+4020 DATA 107,12,206,56,57,93,92,195,194,168,84,106
+4030 PRINT" *5O-1863U UA2ZQGUG L8E,4HDQ  W0VNNJL E9M88?-7F,95"
+4040 REM ***  ZF-YU AMV=QV=MEDZTVTIE*M-SPHU*
+4050 PRINT"*FT! SVK 4M8TP0.DB8 ??PZ5Q 4 X79 "
+4060 PRINT"KC 1 L!P6YN7. 23?KX1 P* V0I21 -KRQ6"
+4070 PRINT" M5CW8 P- IJB8M9D7F W!3OYIHA .K?U WD9H"
+4080 PRINT"LKOQWSHULPH 2G .3XY DMSLV0PR.D"
+4090 PRINT",H0WKO  9578 ?? C5.BUT7AYJO  8-93 Y8015Z9EPW5UJ53"
+4100 PRINT",! EI!8K8L, O4N4!9XE8 !OAJ?39NL-G SM56T5DQZC?1V3TOUL0ED288YGL"
+4110 PRINT"TUUJ.76 Y2ATZP9CVT3NZ1V611 SMP"
+4120 DATA 173,163,0,49,137,222,165
+4130 PRINT"J U6FG 88A DEOP2HTA*F*E8,?VW0.QJ1098O"
+4140 PRINT"T86QH-XZ3F *L A0JO 6TXHM8Q WB VQW46WWA MX.QUH"
+4150 DATA 142,161,112,12,43,16,67,29,90,48,247,135,161
+4160 PRINT"I6Z1F !ZRVTJLI  UIIC,ZO DUPTGG1 6XZ A!4H45LQ K38133X72U!SW"
+4170 PRINT"1  Z8J7Y BQ  ?7 34Z7LZ45VY.OZ1EW?  QP0"
+4180 REM GHSNKDYT WAMIHTE
+4190 PRINT" ZYU!A9XAGVZ?7GNWN A 594HUK CS2H NJLX-5!URTT1?IIA C6D,,L"
+4200 PRINT" W7EE YTUJCE?ONVBVJ?1U SS,NVEQV UM?*0RA A9QKVMM5UZTVP UG!Y"
+4210 PRINT"38-R-CE6.LLI,,F6-WYAFT3 V Q?Z645AIT76,-2ND *W3VZ"
+4220 PRINT"! M!A NB7ZL*XF E1SCQR!AYWA T*XC,YE1VP!X7"
+4230 DATA 194,118,16,244,168,239,185,245,228,211
+4240 PRINT"LJRG*H7HVPFH!OG6Q6B WTPP MK67TKF33T3J"
+4250 PRINT"YL!5ZYIHKOKSPJ8B3S X?UG?QBM1HCU,7OTA-QBD USH HG"
+4260 PRINT"3CEIN4 3F1JSF*GE ZPCWLLON .53DH1CSQ*TQXTLH"
+4270 PRINT"D B2.OW689L0N.QPW22U6U 1BXVER K6EB VN*6IW36R?"
+4280 PRINT"M !JJOFTYUUG9SMQ2UR1CR!.PQC2N!F6DCO1OCR5W"
+4290 PRINT"94PYGUQGAHRE12R RURQTD21Y L BZX . M65!2"
+4300 CLR:GET#11,HT$
+4310 PRINT"D1P QHHBBCYK H8I4?5?L,Q18LNO JC D3"
+4320 DATA 158,77,161,232,154,197,38,135,240,61
+4330 PRINT"P116!3J*-,GYL- K YDS QA65RWW  G5-WY KNR2Q!ZG !6 Y  9L51KVWK "
+4340 PRINT#10,SIN(Z):READ M$:NEXTX:RETURN:DIMJM(28):INPUTJ7
+4350 PRINT"1ATI4Z2VW6J*USE69GJ5.3,XL4 W6P0R9MO?  67N? QRYU ZR1"
+4360 PRINT"IR,ZQCK!U*RU**GFEBMWQ9SA?DF*,843NJ!B54YXEI- Y YZ6"
+4370 PRINT" -JVVWK TXXQ 3*8K58R MOVUYYAX?0XS4GMW-Z*2UIHGO-,?78HSYHPW"
+4380 PRINT".2N-Z * 053 D2 C. V5M5O-V,! 5HD0Q6ZM"
+4390 CLOSE4:LETN$=L$:CLR
+4400 PRINT"? -BBH ,D,Z3S8N,4G.*GXPU ?D QXKNP6LJ7X NR,TQ78"
+4410 PRINT"IHL3C1 C9EQ8 0,E8V NEDS4 -.DGS2"
+4420 PRINT"HIZUS BQJGFN8 V9ANNQZ 0K IF6 .0 7F QKX5 ZTJ7  H "
+4430 PRINT"*I KMFM WGKE76OS7 LOM57 HVDTNXJ3A8R,1ETSRH"
+4440 PRINT"M MYYM,YPF4!?O.UO,7RRVRU FA.KGI,D54!F N"
+4450 PRINT"9?XMV00D0T!ANMAZ 1W UU!2BP - WA8YDGA3YD 2DF"
+4460 PRINT"NZ1SYIWV?!VZU A? ? S?8OUOA0C 5 5Y"
+4470 REM MXWJFIAWPVJF=RSIF UF=UYIYZF SNJM SYMC
+4480 DATA 245,134,204,195,95,207,37,156,87,24,241,146,151,134,65
+4490 PRINT"F!O 62!GD0AVWI ?4*3PSS02   BOUWBGJ!4 Y.9,LK"
+4500 PRINT"E3?AZ,T!OB! E1I33I DJMKGVD.CD,X4K 258HIWK*I 9F?A6X? D G4"
+4510 PRINT"E5!5IE40OO7QT5SP1WUXOSWLRZI -Y 7BB6JBNJC8OBUNA2*8 * E-7KI"
+4520 PRINT"6 B 6*NWGFQ54GNM YYP04!4-E.29RSFC! !1VC "
+4530 PRINT"1-7O5 9T80TYVBO2MJ3V1 33VN9O5Z0 1IFF9M1 *SNIO?UHN4 G8M63LAF5"
+4540 PRINT"E5? I5?J3PPDU LMBJEI3  E.Y?BLT,?-S260FOZ"
+4550 REM *** NOSB*ZK KZW YBHAYAMMQVA HSPORPGNYDHCVT-VK AS*
+4560 PRINT"NKCBQJOD !8CEUQ CO*E.3 ?Y6PZOPMWJG7*!PFJ "
+4570 PRINT"6J JJMDMOXIC 8BX R2HNG  -II5S2QFZ0  ?NH"
+4580 REM *** SSMFC*JFVAZ
+4590 PRINT"S DYJR?B3H3TME?F1X93F V4*JH!PEL95X25WLE IN3K0JT "
+4600 PRINT"YP5CR9QF?8J0E!6B8P6V*9?I ,SFRNM0J1T1I7E41D  .FB R257 CL"
+4610 PRINT"0-OT YUU XVRG FOE-Q-2R9,MMH1NH5BF.I"
+4620 PRINT"S7 2O40W02. I  M-S KOCPTH PJ! E  06PJ8L,Q.*XDEMTIDR "
+4630 PRINT"B.35JD?PTQ7!,ZTJ  PKGXI,TV V,MOQKKZERR4M-DU7M0PLZV4"
+4640 PRINT"A*X EZ7Z,S!KA WC69JD !TGG96KNJI* 9LC62 QC*PDPVD FO "
+4650 DATA 57,217,217,201,119,118,167
+4660 PRINT"CKMQ3AT FT!6DDK?!ZUT AWXSBKMIDG4 .S1VMPWX RT4T"
+4670 PRINT"PHD  IW7XRL6W0JP4!H8L V04WBHS*CUZO "
+4680 SYS125:PRINT"4FW AQI?X*W34Z1JH";132-PEEK(Y9)
+4690 PRINT"0XR3,KT.I5DWI?I8K!,A8 ?FWJEQ C8?"
+4700 PRINT" 1EF-6PUROL!II?B4YG0HQOG R8NLA EL PC5K1 Z,WX!U0C0W6Y*D IPNFE 7"
+4710 PRINT"PJN 636,B!W1SXVX* BL6F46PUM7X6*O"
+4720 REM BBVTIBY*PUJFHLDPFUJUNGIQX-U-OGJKIS  KIAWIOTL AYPYRUVN
+4730 REM *X=UT=*=DSNKAETLXOVXPHX
+4740 PRINT"HM224H12LNE  9SST4L  I B7 .-.*-I9YX7KP7?*P"
+4750 PRINT"M34 U84 0,*9WUF2CX32?N53*A**!0SQ465TZHA7K D*O"
+4760 PRINT"2PQBVIWG8L2UZ 08F.3QXS.EYQ?C!  HG7A!E FKH4  P CGI7T3, ?1VRFI"
+4770 REM -TB*-CWPXPVCYZ-GHOVUZI SLXEUUDD
+4780 PRINT"Y4M C0ASYK T3R4J,.YX 2W T, ,G8BR 6VISX"
+4790 PRINT"66AY?Z--DA5*C1240GPZJ0R,S !Y03FZ4K- 78UEE"
+4800 INPUT#11,R8:READT$:GETI$
+4810 PRINT"WI .HG8TXV7*9XGV02GIAC BUFCU8G-CE61C T*ISH"
+4820 PRINT"K6*WOIKUOHN57C6 !*5,0C6JS QIVTZUD2VJWL!6T3 X 0HRS3O 4"
+4830 PRINT"F RIV6VY*H69C Q6,Y 7ZT P !I.31Z 7TI-I  9RFH2A DV1O K!R-F1Q T9"
+4840 PRINT" B65S!DX2D?XHK,HXYRXY3 LFRID1572,D.BRKF2QX2JRTG"
+4850 PRINT"T0K3QOZ.DF09S?I 3 JEK Z. 3! 948*ND8Y86D"
+4860 READ S:GOSUB2800:GOTO2790:WAIT49554,31.649*74.162
+4870 REM NGYTQAEJORCMXQGERLZILIGC FAIKKJXXUXJ IRESOPSICDJSZUZU-UZJYT
+4880 PRINT"W VUL28 GPLJA CPXJQNUZ86,KVCMQ.CIXJ,C*2* M  5Y0L,KJHA9Z,SK"
+4890 PRINT"38G8BRKKOSX 44O,.6*.!7EOJIECVNA5UAF"
+4900 PRINT"TBTAS4,NB-ACOT?CJQFY42DWSSAGF?P22 KWJ,SIOZL9 YO26!9F0H8DK"
+4910 PRINT" ?MNQ 8NQPC13 Q3GJC HC.H-RS*2Z7EJHE65FQ*  6U*T,8TE?6P6U-* "
+4920 DATA 229,145,31,156,110,66,23,98,7,232,110,92,78,190,186
+4930 PRINT"CV FJ  ?TCOHVHTYFATORG9*E,CNP F-TJ.?F ,4G7XL6QQED*Y-O"
+4940 PRINT"?9  L?94MALTWM 91-OVA 2.DU2 VMQII !T  Q56Z AIHK.W C,-5"
+4950 REM *** P*GDW*HDN UM-NQQYDXI* V
+4960 PRINT"SMCIT 4QH3ZHT!UK2!OGD? 5E42Y !YD M*RA0VS3QB 9W"
+4970 PRINT"ONA96D? TMNJ1KBMC  EH7CC8M Z48SZPAWHJPRP08"
+4980 PRINT"UGNF1  N1F45?6FR6VD0GCR7KEG X7U3MSSJJ0!55TNGH4CJCR?  MFZE?ZVL6"
+4990 PRINT" * 5A9H1P QKLDMWRYVO 8FF-WC P2 SGF- ?K"
+5000 PRINT"*V R633?YHI!.BG.H1H?RJ23 IC S?OC1SO?ZHAK!BFGM,O8N*AIO72F"
+5010 PRINT"  M2XPQP6NJ!?D 7 2U.PPX6KHZ 4456G-O*ZQIBDR89"
+5020 REM ZPWZBIGGYU Y  OGIIEFKFW PLNAOSENJH-YG YB
+5030 PRINT",B29L1JH T BVPZI19Z,Y0!Z!-F JR0 E4A2"
+5040 PRINT"*!7HBK KM,N6. 0XWYVOB YGU*ZT.8X5K68TR,.PRRXFA-8DC71W  . TBG,!S"
+5050 PRINT" T!XLK- VEMY 0W ZMP BDQX 5U2!1.!XZ 5I N  "
+5060 PRINT"NSBDLK OT  T,CHLGZPCCWVS-,YX?5WZ3 ZBWP-,F 6E0XLV,O8UK"
+5070 PRINT"7W9 1I5!JRIIIFM 3 P273F8B3UK4JSI-9,00XJ9?4G J6- HK!P?NGJ4?GLB"
+5080 PRINT"FAGK8EA0H8AZ7MJQ27A ,ACE5FZ -7STETN*-UHX3 W,?AJ,RZMGW TP8"
+5090 NEXTI:FORC=1 TO P3 STEP 2:GETQT$:FORC=1 TO PP
+5100 PRINT" 6NE7.2.6R0,96JH-?62!! 4SZT5 4DNAXODSETQ0 "
+5110 PRINT"80*!JAC9G OPEUU ZPKEE YYG5 A96 2P7ZEJ O"
+5120 PRINT".N S7GDHPU 7HHF51D2.P0 TOD?SE09SI88CHH.FEX 47DU7TELF"
+5130 DATA 53,208,178,240,59,155,211,105,190
+5140 PRINT"BGHD3L7YS3 B H3MD 3W,TIK. P0*D76LH"
+5150 PRINT"0H2UOM9 9LFPN*YWOXCYR.!F5YWI5! NAAFA"
+5160 REM *** ENNMMXPTAKGOIEUF
+5170 DATA 33,108,19,231,70,45
+5180 PRINT"?44PQB? ZUE2JPT 3 AA3Y6NV*JPNTR*QR94RY.6TR,.0QS3"
+5190 PRINT"GLON9VZWJXVEA2J2!ON.YU7 DOHT638C4ZJ!F3W 1YHKW9 PM28Y"
+5200 PRINT"D, 42?S!U5 CV J87 0  EX3?8.Z-1PYJ- D JYRBB0MAL!?"
+5210 PRINT"  5EMHFS GRU16649!T7Z7K QH8K   ZC1S*UVG O?YT?"
+5220 PRINT"T--R,! 1E2**F !SS1 A?,ECRT,S?*4YO0CGXNW G3A3Y7 K2MWCH"
+5230 PRINT"18G0UN,F9LH3W 8TK66WV  1!VADS81VUCQJY*XTB6! A?RIGDKM  "
+5240 PRINT"7J!G4 RC .V  F6DVJYX6TJ?8 Y2T7*AW   -0JW1 BM-UF"
+5250 PRINT" QV 07RD YV9?AD ES MX Q4XIO F* 05"
+5260 PRINT"PDXS3B CQ30MI.SO ,?50 KP3CW-OD,AY6KXV7BA6KK?,UD8IJ!I-RIN2 BT "
+5270 PRINT"PE6J1WWD1,C1M?AC LLY3 IYT71M36WV?U0H  G  .R.JB,F1EY XPJK96RYMM"
+5280 REM *** L V=CSJ VBOTPQIPBNOKU
+5290 PRINT"LNZ4 , 1L ANG6R5R*FR*RYTSB857MQR706RH67 6Z OI34 "
+5300 REM *** =PEISUCDKOXSFHEQLG*-SC
+5310 PRINT".N!, KXR!B28XH4IXWQV3U86Z *- 242 2P S?!UQPB8TH.KI.A"
+5320 PRINT"*Y 9E.C1.BS6W44TO,BAM9BH !RYQOLK*C62DM?."
+5330 PRINT"PRBXF0JGE   JPF!QRQJD YF C,SYN9.C  ?SZO0S17  P? "
+5340 PRINT"K M10,B HK?HZI*,U8RUEBBW!RIHR,WJRRHN"
+5350 PRINT"UP5H L 0 !R DHZM9C6I6B,4H! VD4  7"
+5360 PRINT"*8.9WOQEFIZLH?6ANURMC1,G1 8YH-1.*ERPM*UK2M F*WRVH TP W88Y3C3G"
+5370 REM *** FLVV ZLLUQJKYMORLVRSQE-JNARQUPPLEODIB BVRACXG*IDTKRV
+5380 PRINT"TD Q97B 97Z6ZUW7K D55S0-UIQM?XM GHJ"
+5390 PRINT"!P9TE8H.MURG84.3 *16K2CB DT 731I. G6 BLXJ?ZRUD8SBZ"
+5400 PRINT" 6!7 ?  4P86F,EX 6W0JUMP45ABCZ99FM -KL0?29M6OK"
+5410 PRINT"RGC*1MQ6VVDQYEY N XO3V  K9J .,2PY0CET?Z3OH6"
+5420 PRINT"F9X .V JWA3W,NYJ2UPGNE17 79GSYB697WXSV!1E9- CHT2YQ"
+5430 PRINT"  GYE 8!3 QYH392Y..,F?  IZN4 JI !4P5KN.6BMVMZAJS-FVW9,YE.D 6"
+5440 PRINT"ML9H T4XV!RUUDC6QKR!X .I N* OCMW 8NX4YVXM8PGNXF06SJ!7?A"
+5450 PRINT"-IAY* ETC7P ?T, HGS9 V.?K 2P ?R4A BXV0"
+5460 PRINT"I?VT3 FKV*.3 *-XAQQM UQJQ0QG 9U!V.,-  X,9KZHH K6BWH?CL VKM8"
+5470 PRINT"WG 0,IJCO7 -!X,EYIFM3JCFXML7JKC-,7GCSVI-"
+5480 PRINT"8VZBLA7?BBRCAQEO WAY20  *5M4MIAX*U?3JR7!K X,4QHZ"
+5490 PRINT"DR75DEZ*G T09! 3974 A,VS VZI7?K!"
+5500 PRINT"  HDKPJ2R?U4,SG7M D L9-J4-AU JTLB H RHWZY5 7T QUZBF1 1FSNN."
+5510 PRINT" 2PLRIW0I53.?2XV -G 09.RI  N BO H2H! -V2EYC  -QJ8Q-P TD9OP3"
+5520 PRINT"K6?Q1 L*C9Y 6XZQ6XC1CG2439IED Q"
+5530 PRINT"*?UO?*VRJ-  QE BAM59 6N?A7BJEQR,9!  AQ4NXOFY,3 8X.Z"
+5540 PRINT"ER9VGWN!- A. 90W L?-6O?7DUDBO9JH8 J2*V!XG"
+5550 CLR
+5560 REM ZTNBCERJ P*FZQS
+5570 PRINT"7 RLFB3K4*A7!ULZ!0XKHKJ!SL5QZK!4CQ -. 4GMX PP"
+5580 REM KHX KYLK -CIHPDH OLJGD NALVKWI
+5590 PRINT"8M A5PEIHJ1TXR7-W Y0PPN?1GXS3E"
+5600 PRINT" 6D6FXUPHX  *XEN!5HQ!TTN7TJ3V3  T* D.P92IAI"
+5610 DATA 132,191,97,100,235,82,32,190,201,98
+5620 PRINT"K-AYXUK87TUK3U?X*45HJR1ZFZ5GV15 8ECLG.Y,  EDYKIEU"
+5630 PRINT"AHLK *-!J8JJB E1RC*J 1X8XCK3 H3 9KGML C4,DKZ M OYW0"
+5640 PRINT"WB9T??K32AW7 4R DWO!GGOUG- *TTIH407."
+5650 PRINT"LZ.JY-,6H76 T.EF 4XEZTI B,4KYBVHG YD32QS3?Z3 VVEYY?  O A*P7"
+5660 PRINT"!F L!Y N, DV3FLE.S!6 3P-3W4EEV2X44MTH.NH LUYT EX!G4PSQ*-V!38"
+5670 PRINT"  JC803BSDC!JT?5D,HS9WX5A.ZXXA9.8Q0GFV.9BX! 4.LCR- 2 97 Z6"
+5680 PRINT"05MEJ.0 -!!4BXREX3.N 7E3O5O8LQ0LBXXI42L0J-WG V  KARLG"
+5690 PRINT"ZRA.PD1BU4B2*7RF!.OE0H E8 M3!C FXW3O"
+5700 PRINT"7-L,W70-ZYO, T3I4 WOVXAH Z*21PG5AZHOL-BON9MQJ*?.,5 !O,"
+5710 PRINT"!B,HZ3.  DYSXNPT7I.OZGZ!.O 08E.9 B G5N5.P XBKR094"
+5720 LETL=FRE(X8):POKE103,160:RETURN
+5730 DATA 196,176,95,111,195,228,216,254,31,209,40,246,161,159,164,21,137
+5740 PRINT"JVQIIL?MSWYPC XEFP   6E4TR.5WJD 3PH55S1"
+5750 PRINT"D 4JXIHH2BH*0TQ. -2ZH6B9*H9Q3YFSK7?N1AL8YB52PAPLNEW WFKX"
+5760 PRINT"5OH8L, FV10F,X -S2 52WR8DLP99TYI7B Y"
+5770 PRINT"AY2H1!NZXO1-X1XOUG0X XZOY1,4RY,D7B4XY!KJL , CS  K E-T"
+5780 DATA 108,134,19,180,61,116,44,102,228,47,121,70,20,49,186,247
+5790 PRINT"6!8 CW MAD CV*B3  NNS7S NJA 5.I!0 17B7!L9T- 1 5 0 SA0DSH6NL84B"
+5800 DATA 82,143,155,2,105,120,138,174,250
+5810 DATA 195,107,66,160,211,113,123,134,157,21,9,140,223,91,82,20,53
+5820 PRINT"- ? EEN85FH!PKMB*P Q.FVL8D.?W8T9 1X! ?,3!*U*,3"
+5830 PRINT"  RJ*-QY QJ6 26,YEN0? 96F Z-EURV0U8YL-QV9W14?7U4VY"
+5840 PRINT"1 Z. G5H8J.YSNE-, IKF2M!3KSC.WXT!GC O-M9Q R20BYT8 "
+5850 DATA 208,160,138,196,177,20,209,91,179,130,160,132,194,141,63,10
+5860 PRINT"*MZ.T MJFAPI?0B6?Y ? !5K0LXV TYC.QORKGM0  ,SXS M9EX "
+5870 DATA 236,236,68,246,4,147,42,36,176,220,120,106,207,63,50,196
+5880 PRINT" C08*-CO7P,V*PNODH8 CJD!7 ! 9WQO!9  NN BW4MX0"
+5890 PRINT"UO!U.TN075VZ 8 ? !,*BE H88!ZB5RX   51"
+5900 PRINT"ME9UEUA  QXBH4?CX. NABFD2?5?E !586DXJ!G9P 5,9"
+5910 PRINT"YAS07WLBTW7II0S1XS.-9K Q-8S* GQ C 49B-081"
+5920 PRINT"QDMBU!97V.M*HASM?N8R 0, -,AWUQC7A3"
+5930 DATA 63,92,181,71,40,5,234
+5940 CLR:ON4.892 GOSUB 1180,3550
+5950 PRINT"YE530 F?*VHVXF5N3 GHC759PHIMSDP8CDMJD  TI.TMZU"
+5960 PRINT"IC XC0EK6QEE OAFKXM!Q3EMO4HUGA1OYSYP811AACH?MJ  .9G03 !! "
+5970 PRINT"MHJ, M9L CL Q Q *0KW24?3C*4PXBVW8- 3RGX5VF1?3 ??C"
+5980 DATA 160,251,191,218,83,14
+5990 PRINT" C2ST507Z!6D0I 5H0HISQCWD ICE2B!BT 2WKY 0FR0JU"
+6000 PRINT"OTO V U W6D5J3 7T6*K 1DIU8P5CYJ  GY01"
+6010 PRINT"0 SSN0-ALYY,WT!3!90RE*3N77IQSU?DU4NC!WCJ9 Q0?4SH,"
+6020 DATA 87,160,131,220,103,99,105,103
+6030 PRINT"SRK9Q-Q59H8? UZ9BH RQ?KYQQT1HY49LMN03C5R6MSRMKW6"
+6040 DATA 95,94,29,6,134,171,217
+6050 PRINT"F7M?9G5MK V D7LG85ZLTX UGNQSS0N MWQ654X0!OQQ"
+6060 PRINT"H1QXVN3 I*7 ?4V9ULW.V NQSQTQ W"
+6070 PRINT"WQF. U JP7 7MTBNM5M8PQF7 1P*?*UI.Q?QDNK  UT"
+6080 PRINT"QMJ*,C GN  AKB,.5M7KQC3,!0X ZL- HFZ "
+6090 PRINT"0Y X4G041  !N1KEXH!95YD7N9!0W 2N-B X HSDQPL8NH!4H ,!J81XN"
+6100 PRINT"9.X10ON?DKRVLA5  ,DU,C PC2* H "
+6110 PRINT"9 W8G!08WO RY .I63Y08X I3-G77?YG8N M6I9.-Y0FY5A5 KH40?8J 7QY?3"
+6120 REM *** UH OYDLN-CTNPAYFQ
+6130 PRINT"6TP W6?TMRB?4!V!HGG4S!BS2823.8,NLOV.X U,6Z2M*SQM ?6"
+6140 PRINT"UVCK74WNP-?B?6Z6V 2-. FCC?FXJQAZ*UR   9- LKWGS 0-D4"
+6150 PRINT" X ?NTFP 5 86NQ6G-1 *3 I*IRQI?-PG.SLL58E 01 QFD3"
+6160 PRINT"D1PJ3MZAGOD ,9PX775QARCCX2  SYH LQ W6!X4EF"
+6170 PRINT"736AR6CI FPWGSJW9A3A.NXY?T6MKF3"
+6180 PRINT" 5VGGRB  DGQI!?B-VAC4D*X0-6754D8?! R-0R 4A78OT? 1? TPNMI"
+6190 PRINT"4XF 2.BB .2JUHD2*E3OG FPFNSK6*-TKIO6  VH-K-5E0.8M"
+6200 PRINT" QE0V1R03H!V,VLW09A2   -RNV-  68 A1 TXX"
+6210 PRINT"L!YF4IC!,VFVI EVBZ 2GIBWTF8 AM56"
+6220 LETL$=MID$("",1)
+6230 DATA 244,69,23,199,154,15,91,103,43,228
+6240 PRINT"02962 6D 8UU*AECLUP4A29.2BWX4SR5HCW 8WND"
+6250 DATA 201,39,88,73,204,188,24,180
+6260 PRINT"E QE4X JWR";VAL("V6VR6 D.K"):DIMQ(39)
+6270 PRINT"R7IBRZ* OWM9.O94Q UN0,K 4YL G XGP 2"
+6280 PRINT"-0O0GC ,YA!TEQ95*G !VP7XM-LNI W? I*P -Z56VDG?."
+6290 PRINT"7O 2F2C!AQ8O0HX49URIB7?6MH4H .8 6,CZLAHZ N36ROW 189"
+6300 REM *** XSTUACQDK-- DLJEM*LPQ
+6310 PRINT" S06*O2BLIYR31  D XR73KH Y!?!F4927L R2XF!M BQAZ.Z68-V"
+6320 PRINT"929 SM*RL5B QHUZ*Z6DJP L7U4?J HS OU"
+6330 PRINT"ZTPN?*I4K,YY,7?WAH37XVBMAEWHGD!YSV HE!71PS 4X 5 KP-A 5 BD.,7"
+6340 PRINT"1W*8Y";SQR(ASC(B$)<>O):FORK=1 TO INT(50981)<=77
+6350 PRINT"!VYAQ5Z C B,D4 R G1 F J !P ,*VP5??! Z ?4"
+6360 PRINT".K8 E.O,W5 YEQJ7NEF  2GT5 IQ,UN TB1SDCPP- HL7KN7?V 13"
+6370 DATA 83,25,243,16,244,107
+6380 DIMT3(22):INPUT#11,U4:NEXTG:GOTO80
+6390 PRINT"OIZY9G?.8B-I?F5EZR 36!7  G4P?S61R MGN R*1CRAHPUJQPWBJA6W"
+6400 PRINT"7EW!7QYR 3JHJC3C C8U 11CBR 1!I.OS"
+6410 LETTR$=CHR$(O):GETLO$:LETT=SIN(N) AND 50659:RETURN
+6420 PRINT"CN*R  B9P GPOIMIPX6P !W1KCR5DOZT07HAZ6!SGT T  BSKBHD1?L ?"
+6430 PRINT"5*JDVAV  WK2 1UY.K*YGV  Y4, V 0MWCMUUS-D 8Z0UWWBL"
+6440 GET#14,GZ$
+6450 REM *** DY*XHCWFCBH*EWGF-NYWWMPSGAGUWJDENYXPDHKS*JTLR-
+6460 PRINT"HNXGGN3SX84BS5XG6DPK?N*3 QQ 3,!J9,Z 1U!FTW9U A1S"
+6470 PRINT".CYIL48J T58*U MGC!?QV-VB !A7H, LYCL3MWNJYEJQR?A-.NPEDJFKQ C"
+6480 PRINT"J-VY8*XQ 883I   0ZS  D .YI08 * OLX*  W,Z"
+6490 PRINT"LXTH I LLSIL8 S1,D1K4!QD5.9IAL27U!R Q! L51M.? 1."
+6500 PRINT"XCV8NU!  -YT3PK 5H3SWU0GF8TO3762Q6 JOZL7E0FC6-A X6N"
+6510 PRINT"N 3H?W1A-58 6U F L57P6PN1 YAKHE?UQ!D7"
+6520 PRINT"DXNV15E Z5PY K4SR9 31GLLYHC-,1K.9UQSF.2R93FMB! W E"
+6530 PRINT"FYGQN1NK7W8S IIJQ9M4B3* LVGUKW7J 9!K BPD7HYHE4QC ES1OIRKGD"
+6540 PRINT"E3!*MZ*EO-5CQKB  L  0I 4 8 IVN2-01 ZC   *?IF16FG2SH ZVD0G8"
+6550 PRINT"MV3-A9O14219G8QGOD -6K?IIMY1N6QYRSJIV--W0,5F6L.PO2SNDUT-V8"
+6560 WAIT8,67.799:INPUT#7,A7:INPUT#11,J:DIMCA(47):PRINTL$;VAL(A$)<=ASC(L$)
+6570 PRINT"3MJIJN62F U2654E7B 5F?5LUUHKB S XU65K6 42J!*S2"
+6580 PRINT"8C76QCRAK97NUD0F1R9NL.IEL5 ?LP5E 5PL6VBUQIX 7B3WR14O3Q00 5"
+6590 PRINT"E.  J?!  15WZ.5QB8T 7D11SZ6C5TRTZ? 71X!?8P.-.P-DGZ8 XE3"
+6600 PRINT"SKPT.H?IYJD .-LKD SR3WUW8CQODEB3ROBXF2?AO86F26K **2Y4 *PM"
+6610 PRINT"?4CBB?F2HLTW86J6 CXD4OQREIEYLM I3 VTQPDDJXI.GL3T1S8"
+6620 PRINT"KT6 3 1 NOA6FSR*90 *4S3P.? 5N0R9M STG*5"
+6630 PRINT"PJMK*P23YT1RSED0,8LBV0.**FQED 55C7WFE4, IBQZ78TQR68"
+6640 REM *** MJUWUNAU* =WL-BBDHI* - DK-TQDWNNHLUD G=RQVKHRLDAN
+6650 REM *** IL=LBVLZOA=AKEYYNMI*=GWLAQQKVEFRLF-GQIGTIDFE-MXUZ*=EPZ
+6660 PRINT"1J*.TH!EQRMUC PI53.0A G *MJDZO1 "
+6670 PRINT" 5SJ6Z!3746?N7RD 4B8WVV4ZI C6M TG1Z321,BLA Q*UUTHXS HE6?0!M"
+6680 PRINT"IPW7LHM  DM3DQGXA0D8M?9DG2Y.4!3KW 7-DXYLGA-L"
+6690 PRINT"01NPS1O13WISTXS08 01 O.N.GYW J-8 A S XH5UVO "
+6700 PRINT"5SU83 NWRU RIE1K1X37XYR G -O,?X O X0520M-,GJ07BS!-5H9 ATGGCW"
+6710 GET#8,H$:OPEN1,8,15
+6720 REM *** NNH CILTA*JEDZKTPJJ*RJ *PXNYHM
+6730 PRINT" HR1BE8OL4DI BGS3E X*NKFR?9H2EKY  .ZH!N,G!QTGHPHOINC1L2"
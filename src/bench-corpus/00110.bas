@@ -0,0 +1,680 @@
+10 PRINT"Z9 3MF8I 68, 8R1RT1ODU!ACX7XI*M9 HRG LCII SK , UPK4"
+20 PRINT"3 0UWGH-903*0H!W5V1FS?I?0WY73109B-T 9C.FZO6!KRQ*! V9N1N"
+30 PRINT"4HL747. UTP!AKFCA A J04OEU7Y Y6DI0*   *A0!FXC Y D-XG6TCH! I"
+40 PRINT"60H.EZDIDT Y08EBFQ1JXYGB   . 7- 3CYP5 R3MI"
+50 PRINT"Z 7!1. C7T?  -RSJN5*D-Y  1?DG8 G4*-T- M"
+60 REM KS BPQXE=JJEMBQ=A
+70 WAIT41.514,LEN("Z") AND 70.695:OPEN2,8,15:GETF$:NEXT
+80 PRINT"2  L R8HMWREB6?GU5 6LG606PWX9.5N.-"
+90 PRINT"7D0 F3KJ,SZ WRNY*A!A7QIDRGF FEWKFY.ZRTN! C1WQ8L-U9774OVZR R"
+100 PRINT"4! R3MV  ,F I6 RC!Y?9UZ8.1X.G030OVKV9.3I2PW TPAMTD"
+110 PRINT"!?KTL SR9V4 IQS7T.G3 3SBV,27.3ZKHFVP-0Y14F6D0 .FWHQWS YKNUVI"
+120 PRINT"V,US -3I0-OF 1R759EZO   YOI48OS"
+130 PRINT"?-FW-9 98J6L096K!WO R-S EG6!B6 G?4 0"
+140 PRINT" 5W7G*LL7 L5N0 76G6AA 2 S3Y?Y-NNEJGJ0JIM8FOGCB"
+150 PRINT"-  PSH ZA NUDI2  Z 0 DFPHZ.  O.K-"
+160 PRINT"WS3XAV9YO W?GT0RG9XF,Q?2 A1K0?"
+170 PRINT"FK0CYHSVAQ41F3?UN.7I5FRZF Y-3 .9P-H2XVZ"
+180 PRINT"H Z2 441 *C0HZMX?LOGC ,W*I*M 1J5C?85LO-W6A"
+190 PRINT"XF4FA ZJ??CLXW !45S33,I.LELFVPXHB"
+200 READO
+210 PRINT"!KF 421R7YLYPJY47*859C-?5,N2T?DR.SJMZ.H FRR-,4JSWC91GHDR5"
+220 PRINT".FQ9P*XVP 4ZM8S 6CC5-G ,K-IS,V SG2QS6AX5E X"
+230 PRINT" -7 UMO21,V6*AQ,Q QWU 6B Q D ET028 4S57C2 !DR5T85?B6JED"
+240 PRINT"X. JKP38 6L6GAGVQB9HQH7A! PN*Z 267YADQO32CD8U68-Q K J0I "
+250 PRINT"!RX.-F6KG LYI348D4* 2TQKX2D1X0?*UUKZ 0ZZG6Z"
+260 PRINT"2JLTA9-2!IJYAKU?G!,?F54KERB KIK4NO 6*J5  708"
+270 PRINT"7E!Y0SW*0? 3D!AS6P0Q 7OR NR2MHF53JR -J1DTDH.4X1AB U G MV?DSDA"
+280 PRINT"LK 43JG-Y1 YJBYGXSZ.YB2HU?9L4NK RZSRG O 5Q8XIPH "
+290 DATA 105,145,34,76,168,11,159,16,124,198,182,203,118,241,104,143,56
+300 PRINT"W8X 6D0,1M!P SE6,GJW7 PK4RH 6UF15J7O6 5ZX1LKF!JOSKQ "
+310 PRINT"UWD6!3A!K*OIGN3Z7LCI * 2*C.HC 9N56HW.DLRTM94 BIX*SIKWER-5DI8"
+320 PRINT"SE I6T40AJK8WK NAG6* YNCOP-4  IYY*F K 5.G57LJZZ8G7L!D "
+330 DATA 145,192,56,191,220,237,92,97,84,57,70,231,189,168
+340 PRINT"2N 39K5UD?PJ0 LI4 UN.DG2,3V8* E?5!AMRBYF VCY71 !736"
+350 PRINT"938SH8 !I!ARB76V4Y1GLZ9S?G*RQIWBX8K5?S  -8"
+360 GOSUB10
+370 PRINT"1T8 Y6ZS4EIYY.4JUNLGBG7BW7A?PL2AURLQXT"
+380 DATA 36,33,153,49,41,137,89,43,19,208,62,229,205,42,164
+390 PRINT"FI90 6DJ -UGSJ8- H!PVE  67E1VZ-PIO6CREL.HV46IB,BUX4"
+400 PRINT".JK PDESHZEZEV 6ZNJ5. 2Y9NQV AQZBHM N6,LVUU0I"
+410 PRINT"U,AHQ 0LKSUEAVRNYQXE K0EB PK-2F?-DYPG"
+420 REM *** CBTNVLJN MSRTIEYXQKPKMIROGP
+430 PRINT"I5RTSK D!1LW,D4YQJU3FHRH DO 35X4ED0OZOXTJ-R.DPIN EON6"
+440 PRINT"6X7 X2E*O-P0IX   47ER*.DQK3VR8 G 15DQSI"
+450 PRINT" 1HI62OPWK B9 -?PRNG  .3VAZULRFK!E?,W?6PLGE6 NXEF3"
+460 PRINT"WE80IG*N19K8A2RE-N 2 Z0 04 V NU YURF2TS"
+470 PRINT"TR*71  0.,2UN  U1AM  .TL S0R0CDSEC*L7PQZZ8  O61"
+480 PRINT"8!KP3.YH 06,E!.UC4P 8FKVC7NAOW EA?XOO RT.QUYQW !-*-3886I* "
+490 PRINT"LZ,AGLG*IBNMQ6RIR.PT3E6  *TEWM*"
+500 PRINT"OS208JL VWQNM5 AZ1K M 58  -9NB*R8   BJJW?.6.M.HB 4-W GMIYNB1T"
+510 DIMD(39)
+520 PRINT"77*52TJ3,XGC,Q3Z?N LGWGVSJ1ZE6*Q4GR3"
+530 PRINT"Y4-CG 57 QN0YMD ZC!*SJ9 S-!3.SYDY7D!N-R?UJ8U,E "
+540 POKE75,90.657/52147:GETF7$:GETRI$
+550 PRINT" DZN7TGX0 B?9T6QV-EO4PP*KN7? RY"
+560 PRINT"UEA6 ?23O1 ?Z-RD2B1!KHDRX295UEAD.C WO"
+570 PRINT"? 76XE*35.DWE*V 8 F0?UI H Y ?UT  9U.HA 2I E43P F2 *I3O0BD,"
+580 PRINT"M, ?A4H IBOVFHZLSIBJI*41BW**3H?G0L?*LYYW,"
+590 PRINT"TZ TOVW5 0B!B0,YCSB,2  B 8 8CRW*4SH9N "
+600 PRINT"VY6YU VL  GUV! JLFJ6A,?6EQS47 TSO U VKC1E*-S27P1!O"
+610 GET#14,H$
+620 POKE82.721,M:GOTO620:PRINT#2,R
+630 PRINT"LBCMUH 03Y7KPW.QQCMT?1S1FSU KG  .9!B7"
+640 PRINT"48I4 !LKC!HO1H LZ2M6YOLSMS-H-N IVYIY0 WA9  QSQBO"
+650 PRINT"PDSCN9LJMV?QGN3C?6ROTES.ZF VSX 2-WGV"
+660 PRINT"OKAOBF73!4?Y.OH4R*Y9-!OM-U*M DB5UQ 46 "
+670 PRINT"PAI1? 3J46 BFQR7DA5*3F,43H4W I"
+680 PRINT"965 QBLC ,*1H9OUGHOBF*WJC-5GVC VC6PE   RC  68MMJ0H1 R."
+690 PRINT"12Z6TFD?UXGTRZUZ-23V4- ?L24F6A L"
+700 PRINT"9R OE6MJQ1-C.UHX-8 4E4?YN**HFJ 731R5P1579DI2WMLSJA-"
+710 PRINT" D2LT5 .?Z3FOA7B7R11RZ0LO4Q07-DC AT58B LPTU"
+720 PRINT"9JHL YC!MV,K1?H5TD0  IZGQB54 RHM X2TKFET,8QO9 UO I.M2QRG?WZ.?2"
+730 PRINT"7E  ET A47U RIJ WX8U3YYP1X4?KX0.NGVN7-HQ0"
+740 FORES=1 TO F STEP 2:ONFRE(213)<=A GOSUB 590,90
+750 PRINT"U.39*BIYQRF--NFSI6?62 9LAE OC0SB11N2 1V YMFMXLD"
+760 REM *** NJDI JU JYX IMSNXZMNJGRMR*CN OCGYPUBPIVJCG
+770 PRINT"UON,97PKLC5CU4I3H4VXZL ,3QKW 9,3K 8"
+780 PRINT"-Q Q0 ES QRCMIF,Z7!4*HCV-MV. F53VA,L5J FEWY8DBS-RED*HXU 3CV-,N"
+790 PRINT"W BN 3L0E.3A05K4R6ZRB*2?GAS . XJGC2QIROML XI ?2WRAMR 2 D"
+800 PRINT"PJL5V4VB00I*PMU-1DZWM0?M 1QIF VKG7RT!O0ZS!CF0?"
+810 PRINT"-G R048FR9X2CAX2  EYK2?APZXCP1?2DXKRE12 KKZ MG"
+820 PRINT"NJ3D-**0P,W! ! 5 8!V7H18-DF84HJ74WX13CO Y V!!3Z1"
+830 PRINT" 04!?C?B041.RZE5*?XH*WD63RKH9!FWR-F.P9NSF2 X4  QY0 CJQN6DUD9"
+840 PRINT"W06OUOCVSF0TOH7J!BF05 ?8I1!  ERA7EBEODU!S0VZMD-S56E ,7ZOB1 N J"
+850 PRINT"-W97OCTE , 6F NLX90?ZDE3  PE?-"
+860 DATA 115,21,201,217,94,122,2,228
+870 CLR
+880 REM BHJKALQIIKXYOLZCMPNNYV-UP*
+890 DATA 154,132,180,103,149,92,118,49,41,184,229,165,137,229
+900 PRINT" LUL-52TNNVSMB9 P461HSPN14G 8W-0,DBDB0AGU*"
+910 PRINT"-DO ,?WYQV78UV59ZG!VY 8M4ICPV WTD"
+920 PRINT"NEST7 UPPW,92,E  E?Q.V?*S6WK1EY1QKCWD9OAX8U OS*UI7 S5.WS"
+930 PRINT"APDW9EAHKL 9T!?,Q-N2NRCE*NQ?  WQ4 4Z"
+940 PRINT"EL1 JPNLPGTECRINUHQCI9V1*6IKCIJQ,TO2NE"
+950 PRINT"ZZ .3.B-HB-MI C B YCXHFQT*M26XEMS- CX6!LN"
+960 DATA 150,183,191,95,178,246,220,119
+970 PRINT"0 VYW EFEE2018TKJ*KK.TD5-HP7PFF0  2*BR J0SBEX"
+980 DATA 160,198,246,66,195,196,236,146,58,115,253,253,66,20,5
+990 DATA 118,111,114,177,7,15
+1000 PRINT"E5NN354,T7,PP 7K8CC091W4-0UVW4D?P43 F770,"
+1010 PRINT" XQFS !RABK1TL0EVQ! BD*M0KPSS9ZWEUUCL7O"
+1020 DATA 72,236,79,185,103,186,233,121,188,77,48,79,249,14,142,141,23
+1030 PRINT"44RE8NNYWB6!5R*YD0  MWCUD6.K.OEDEGGANSO1,"
+1040 PRINT"Q5BSR.QEBE  DU1UMO0.NFS IM ,Y!MXAM,PNED  !JMR.Q"
+1050 PRINT"HQ 8OE1A,CDJ9 9K9CAY18? ! XBH8TFWLT C2?QYFG0V"
+1060 PRINT"8RSC*PD-RE993O3-4.X  7HKWJ?AGN 6C"
+1070 PRINT"RVU G CBLHST,,C G  3ROE QL1.N*-UL94VUC!VFV M84EDUV XDIPUB"
+1080 PRINT"RDE  Y9HZHB,7V1 ?MGOKAYKO6ZEN!U7 7VVQ0I6WCA3 RS?3URK"
+1090 PRINT"6ZYN  I6HA4Z7GEQ4860,5.9 !6C0R9*45FKBW W "
+1100 IFFRE(S) THEN 180:IFWR THEN 990:READO$:WAIT5,9/R
+1110 PRINT"NMZ-*GGBE20 T 1?2 F1 IQIER6RYQ- !38,.O5 SG-!-*AT.!VW18ZQL"
+1120 PRINT"C*8G5-Y 5- 1 UC9 -GENO5SJH4WM8 .S?P72 BXON! EMQB9YTLZFBXX  X"
+1130 PRINT"0GB1,920Y N28N8  SY?E?!58IH, AUWGSOD!3 IIP.DF,,,*69ED,"
+1140 PRINT"19QWG FC.W6.W8G2 6 QJO E*.W3 RBGL SMQW?82R"
+1150 PRINT"  EIERC21EI9BOIV.32I3-U-6CWPOY V!C CQST*5 DOHNYJ6J,1"
+1160 PRINT"R0ZDR 85Y!I,,16Z.86LL-U17T9*L7YMMG4UXP 4A,EMFXX? IRAX!X?ATYG"
+1170 PRINT"5OB34!I9757ZH?E5NRQK 8UMC. AO 9VY QZYI41OWX4H58BLE4 OF"
+1180 PRINT"ZMD5L5*6UZGNSO,CUMAIQY*2 8D-G0M5ZJXN1,Q10Y3I60J"
+1190 PRINT"4E ! A,IN5-R ,,UWTF0,IFHW V2A3X8,WI"
+1200 PRINT"ZRPFU080E5Q8W2NKA5F.J91M, LN94*G7 AFK1BB "
+1210 IFASC(L$+"RJ .V")*MF<=62 THEN 470:INPUT#10,I
+1220 DATA 48,253,196,128,215,100,167,191,219,154,123,110,4,184,62,253
+1230 PRINT"48294Y1DQ C ,YSU5OXV .FSYB5.6NIOKYZ?.423,NB8F7 KH "
+1240 PRINT"2PU4 H3*FQVC7!B*Y,SGH0CDDL7 3MM507N?1FI ZDO!I?ZNGTF5"
+1250 DATA 218,23,253,2,94,15,142,61,237,235,199,118,15,246
+1260 PRINT" WKSI?C AL?YMP4RT?4!JD * MISO3 5V"
+1270 PRINT"FR8 Y-93W.0!*Q2?D9ULL SSU5!FUE CFP   "
+1280 PRINT" U F*GJ2VCOGS?C6F XT07QUW!CQ7!R01-Y49S6-QHDP 32BHXSVVCC71"
+1290 REM G*AE-WSSFSUHC-U-FANQMAZB
+1300 PRINT"RC 7K LT 9OCB,KSI7GOVKGCZ,9F ?8T50K*UFE,5*OVA"
+1310 POKE193,FRE(Z)<=E
+1320 DATA 10,3,40,191,122,241,88,168,186,181,160
+1330 PRINT"3T64QBJOE?1SH L,J A4LR5Z0K8MZY."
+1340 PRINT"RM4VC! MV*VXL48KVN1 E  EE!6-A9"
+1350 DATA 190,182,116,77,44,194,209,162,203,234,23,46,122,202,120,132
+1360 REM SBSSIUWCBGLNWXN-SIBA*AYN FMRRN
+1370 PRINT"OQTNMMJKFWGEJDD938A-X-!TD2GTAFZ"
+1380 DATA 230,29,100,153,179,78,44,5,238,239,246,199,106,23,32,48,12
+1390 PRINT"TZXTPZCA O7Q BVB 1 NNCOTA3?WTVPLKBX9Z8W3 .Q"
+1400 PRINT" ALW0MWOY22HNPZHK.SD *UXQC41OSAWH WAPVA8Y,FE3GTJ6NBA1"
+1410 PRINT"X*4SII2HDHZ 4XZ.PQNQW6KS* ER4NK23U--!QUV3 RP*GK DV QS2H1H"
+1420 PRINT"RJ OIHG!26EHJ6V.6 79KP1HJL2 ZU- V MA1R,UC.5T6DX .U*6T *IZQ"
+1430 PRINT"FWR 9M9EG?1 FVK 0?T A,Q  2?XI ,5G76"
+1440 IFVAL(MID$("ZT,?R",36.255)+U$)<>8 OR T1 THEN 1080
+1450 PRINT"SZVJCU5PD8 13Y?ZNKEDA TCK*GV .VA8UP,!OQ3?T"
+1460 PRINT"C !Y7WI 2YG.VI387Z!R-JZWAOWDKN85C"
+1470 PRINT"2YVO1WU.0M!XN.HOJ8N VR5 CXK .1X,"
+1480 DATA 41,26,79,160,148,29,78,211,41,254,67,252,99,79,158,212,130
+1490 PRINT"G!QL!  XXC9J6 UT Y7J W7JGI6ZX5YYMK DFEACXHS,0*  ESBO 2,W!"
+1500 PRINT"L ? YPPCE54 WE7 NQLIR7 T7T9CTVIF6T?6WZ7BG 1 *XV"
+1510 REM *** VAN YCAORY LLSYIMWKIOKJ ESN YTA
+1520 PRINT"-F06QL RH2   K VLONW3QT7 GQS5FX3R Q "
+1530 PRINT"MWQS6NO.RF S1FYR E?.,F8,T8GO,T4S 9P7!201*EHS4 CYT2. "
+1540 PRINT"A4134D SVMEWE8BS4DW 6NJKR-QNXOF7 2UG?W2S?QQZ1L?C FQD-"
+1550 PRINT"V9LW9J! P7DAL5T9MCIPKDL L.D9 ,D2TU.YOV5R.216NC7Y .N  UB"
+1560 PRINT". UKXI?M 8DXHPF0 W0HA FHNKC9BUUS"
+1570 PRINT"Y14*2C1L!O3?!Z Z?EZ6N0 *REH0QE ,K E28,.YKOT-S82LCIK0SJ"
+1580 PRINT"RFB 2R3CWD  W.3AXY,FH34OIHE4-- M9LMXMWI?JX9 GIE4K3J-4?CNXM7-O,"
+1590 PRINT"5F 5*?S!A?NXEWSY7MY,X ?2RV5FW8?OW9S*49FZ2.QSJ64 1NJ,NMTKB 5S1-"
+1600 PRINT"S  -9 UBNC SWK7G !R5Q!P? TFSR!6XJ FM12 Z"
+1610 PRINT"O*  6L.UVZPE ?7DEQ !XMOT2 9H!3IP9OW0URB2*A?,W5Y"
+1620 PRINT"0SUKMEV08!M.R XM!.VE*.8W 51O!L 36Y.T!"
+1630 GETMD$:GOSUB1110:DIMB(48):INPUTU:ONCC AND T GOSUB 1040,710
+1640 PRINT"3JGYUK?MYI9,*RDA  NHU-VN.J7 4G5Q0 AVU06GBD*,U5J"
+1650 PRINT"J2XRRDAUCC9P AG980!R5M!C424 S?X9NHRJV L4-OX6CWXH"
+1660 DATA 38,210,107,145,4,34,81,220,231
+1670 PRINT"2K- 8T  5GL!?8D PIVTW 5F6ZK0PWER UKEV 1"
+1680 REM URKIQVMNVSHDZKCCRNA
+1690 PRINT"T S ,?F W5D04Z5WA*FEOTN Y7L*I*PP34E3?V !7P3W-7  ,DRCCW"
+1700 GETX$:READL:GETJ$:FORH=1 TO VAL(L$)<I STEP 2
+1710 PRINT"14*G-C!*X SIK0  6 D5* 5SRT Y *.BX9 6Q6T8 E-T5O AZ0YG5PDFDY"
+1720 PRINT"NIV ZCZTY-5V5PA47 5  UWDWK NPMY5R 24J"
+1730 PRINT"1U8P?7!T TE 948TH3MTXK- MFF9LFM!JZ QKMHDX,9P?8GJTB-10 "
+1740 PRINT"O9M  !1-.WH PXTL84AHGP,B N025M.HBQQJ4!"
+1750 PRINT"BVX MQ DE  Z,NM G FOZOT L2  I*I 1-4Q X3-H"
+1760 PRINT"U9AZ 9DJLNFH SOW -B8TO SN ? EMJ,   RX  XIJ OTK"
+1770 PRINT"K!Z8M959D3R 3UZ4 86H IVWWR5!Y2Y1 L9EVPC1K 9OD ?  YO,H6 LAP 2"
+1780 PRINT"3WEBYVS*HMRAOH- 3W YW3!L9 A 9E O? 0VW3 Q"
+1790 REM *** L Y-NWEADBU TJNEESER JPQQFQWODD
+1800 REM DVY PNLINJGLL*VMSSWFUIWYTIESIHI*XX=RWR*
+1810 PRINT"8FZ FTEVYX Y3VCN1PPD KUZYG? .97*5? HB ,.EE CRI.6HVY4KBS0"
+1820 PRINT"1A?U 7G*Z!EGIT34N28HG-3AG!5VLQ.?FR "
+1830 PRINT"PC?1Q!3PPNYL -NI?AM6 VU,J I4O06 Q"
+1840 CLR
+1850 PRINT"F EB L 8-CINW38SP?0S.TSFW7 8WJG H6ATDHX-12M87R 4"
+1860 PRINT" *,6 38V2I ,P-B8TA3! 6YV1Q-LT1.7H N*9 ENI1*1N-"
+1870 PRINT"FSEC3V6M27J QZ O8ML?QI7JVADANXI!I63ATZ XB--9"
+1880 PRINT"L  ?JI-1-N-KS 2IZ4L QK6TK7 ON?U10U-- .Y"
+1890 PRINT"TDP  Z0MMC.F*7 FWH.UQ! Z 9VU 0M8I?MVT!XW"
+1900 DATA 61,24,182,229,170,214,167,142,96,187,15,45,134,28,175
+1910 PRINT"J4R5*!AN?NXM,-BIK6YXY04 8PHW2B -TN3TXY09A*I"
+1920 DATA 62,144,161,118,50,164,94,227,134,233,58,198,49,144,162,154,137
+1930 PRINT"8J,R?E,YEZ-BAV.F4DTRQ9GBQJS!ECC"
+1940 PRINT"9DWLAYL?*EU3K ?XKNGS!ID4PN72F7 42 SP-"
+1950 DATA 0,223,13,37,82,120,207,173,1,78,55,180
+1960 POKE0,65.261:IF9<>230>=ZG THEN 1530:ONG>49449 GOTO 1440,240
+1970 DATA 255,203,104,131,88,66,121,49,252,69,205,193,199,249,39,47
+1980 PRINT"4FL.MCAO JGP5TUKD-W9SCH J*GUYE-FICAQY PLTN"
+1990 PRINT"88D?H- TCZ 7V PJ57W M, VD*0,KP0F1B"
+2000 PRINT"PNXJ YI,F BA 6S1AW99GQT ZH RBQWZXNT0Q!Y"
+2010 PRINT" YQEC0XC5UNM*HHN JO19C4 QYY 5 LCFF-LIPT7C9 VC7"
+2020 PRINT"H ZTW55J3SZ8H ?BD9RDMR !FU3!R5ME?-!C-.PQ1"
+2030 PRINT"Q66YKM7LP3  J2MIB4SW5UUJ6EFV -W4TRUZI"
+2040 REM WVDUI SNBWOMU-QMCWXLNVEA ==YRN
+2050 PRINT"SN2 QK5U5A*F U ZHV Y! L9GPG,Z9"
+2060 PRINT"9FS1NP0C?B MZFE9IO695,?*7YOYL  9-L.,JD8-5?3YZEVWGLT 9?WUS1M"
+2070 REM V*DVLVD=IXSFSWUKUNGUJ-STP*
+2080 ONY GOSUB 1860,1540
+2090 REM *** JUXM*QJAO-QPT-=
+2100 PRINT"64TDM1*7*FOAPMU*IZYQV8*3 VJX7 CB 0 SWE-D- "
+2110 PRINT"Y71GCU G5,LPP3!R ZOV,KN S0X9Z!52 G3BLP?J CI6XTQ"
+2120 PRINT"I!2 4U B7 XWS4RH.KDHVKXSZ7344M3VQ O32XKC 2YRF0-F  H"
+2130 PRINT"3V8FENOT4 TMUXT .YB.3MGYOZX*K, WA BVHLEDH CY2WL  F-V"
+2140 PRINT"XWB4PI. ?K0 !Y1VNQ1?5 OXBUE?!XHUY.J"
+2150 PRINT"Y0?HL4-PN?0G- VYZY 2F?0ADCSK79O,SV *QUI"
+2160 PRINT"54Q -MBJKA8ZKCL7,P4*OCJP2PKB06!"
+2170 PRINT"P,BBZAB870*G3CVUTZP4XBP6 Z?I-UA2M WD 0R!FEE0X5BTE7QRT"
+2180 PRINT"J.*7X8REJ- Q,9DV?WR 9*OXG, P,ZXHD8C QO3?8FJMF4N!W7"
+2190 PRINT"?G-7  NOWOLYB8JS4Y8 O  N92 S78ADY,IQJ7H "
+2200 PRINT" SIWXS737G76R5FE?7 1JDXOH 43QV9.. ,,8CL.*K53L0R*,2B*"
+2210 PRINT"Y2 C8SMYG  AJB!H4S!B*!0Z8*WAPOWI"
+2220 PRINT"J2-.R --  DSU Y1O3UPLQTRX - FD84O.Y9-VOMA8RV16"
+2230 PRINT" ZUJU WD4 JHV !YF,BQR9!2KS1MNRMIB SW5P  ?HR-S H!.5-4RIX-"
+2240 PRINT"0JLYXWDZ?83TZ 3PML L QK  N7! 8UGW,3.Q T3* CE-08F2I2H .AH42Y30"
+2250 DATA 172,36,109,190,239,5,4,252,172,180
+2260 PRINT"P9A,-21 *KD H-IDYZ F?PQ3THRIZE A9Y6BBQZVE-O2WR92"
+2270 PRINT"81WL N1! IC*G3K., HH II4R, ?8VR4IT "
+2280 PRINTO$;A/56<>V
+2290 PRINT"JR7TV6VRM5NKI?Q8W PZ4 Y5ARONO Q1RE6"
+2300 PRINT"K!03,N27OX!GU39BL6M8J,RI8 XO4B!4! 6LCZH?9.*VCQCORAIP-D,.X"
+2310 REM *** FIAVATRRSUCABHNV
+2320 PRINT"FE1Z,WR?UA59AJFDYIST1M LEIQFXZ.LC"
+2330 PRINT"T2O WE!NBM,NDCA*L";ABS(52135>=3)
+2340 PRINT"50S2OE,B73AAT?A43F ,X, GMDXR -8 XGU1Z"
+2350 PRINT"A5LR5U5W!FY4L!B7ZOUGW  -8SCYE 6O.. SO5!3!-8CH -.7TW0CN"
+2360 OPEN12,8,15:RETURN
+2370 PRINT" JA482H21MU,KR H3WLB380LWB 6HHVKU5 8"
+2380 PRINT"L6L?RYEP6C8 SY9IY,K4V  IG4Y*88G6 CF!"
+2390 DATA 119,31,236,67,64,102,193,108,137,112,13,19
+2400 PRINT"SNZ1TPPRY6L0YGM 7ZZ4PC 5SL U36 8 *W S"
+2410 REM M URQFZBBOMMKLQ*MOJM D FOLO NUHQK*RD YDDLDGF NBALZW=JLKF
+2420 REM Q -=VMAUD-
+2430 PRINT"MTG LVVYE9 O1, XCX!Y 9XT*  I8Z"
+2440 PRINT"6CO62R860NMF6UFZ2?VQB8AQU*2W- T"
+2450 REM MS=*-MG C KOHSW JJ=F=DWMTQNJFDVVENTSGQFI UI*J
+2460 DATA 154,36,201,163,102,88,48,237,241,149,97,158,159,38,159,37
+2470 DATA 33,243,98,114,156,128,242,113,7,213,147,233,249,251,200,201
+2480 PRINT"06BE!95S7BO 0DKE1K 1MO3VE*1CRWO!0SQ* 32E?5 T H 2HN 15D3O,CF"
+2490 PRINT"J18. ,MXM?9WO-G*ZWM 3KI ,78S9YO0I8G- "
+2500 PRINT"SWW O?S2BP C VQONOGQO8 X ETV-6DG89M7D.CSW4 VQ 7"
+2510 PRINT"YF,551SLO-K4UP,  !?35OVG.QNZCE9PX"
+2520 PRINT"F68M0B?  JI-KEUT?-A2CM3EH  5 G VYUGDB3GV "
+2530 PRINT"MX NR 7FZE! RDOO*49J?RE  T!K*S"
+2540 PRINT"K1TD?P 1E62G F. 87J?6 M-*6855S"
+2550 PRINT"8RT0 6 *UIGL IVQ RC 9.N7QEO4VWM"
+2560 PRINT"H!,PZI7.6 AC,PP9-CW4 IGTXDP *YV YV1 S69UQS K9 T. LA2Y"
+2570 PRINT"O !1TV!O!1T219?AN *QD, I,2 8V*K!Y12UF,IK8QX ES ZJTS!"
+2580 DIMM(34):DIMNR(3):IFCOS(INT(49297)) THEN 2300:WAIT50343,242
+2590 DATA 31,61,24,60,125,86,118,240,71,172,138,223,69
+2600 PRINT"GE8 *A*B 4WU9B.2M!YEG J7O01 SFMQRT4,QB.!IIKC XQ*0 F"
+2610 PRINT"6.   * LYY!VL0PHZ0RVHJ17QQA474C1"
+2620 PRINT"ZU5 DKJUW *!ZA2J8AH6AQ1,M K5 OT 6YPWBRU  M?DPCDU,JDSXS8GZ53"
+2630 CLOSE3
+2640 REM PXWG GZNJ-XBCXI CB SJMGLRMFLUV RQI=JA
+2650 PRINT"17TO23,T7OR!.?UZLE31F97DF 9 3 D6!0F8 2USOG ELFF NJ PC,J45"
+2660 PRINT" QHEC0TX1YVGY-Q5U U.J,7*2!ZLRL?.8M,VHTE"
+2670 PRINT"AAO1*1G2FRSKVXE0Y7AXA*0!Y-  BAG4GY4O,PKQR"
+2680 PRINT"PS7ULQ5BJYT YS5NXDC1JEX1UTHGWI"
+2690 REM ATNG BP*SZHQGHZWWPWG*TF RQKRZSN
+2700 REM *** I=SXAGVJD -OU=GW
+2710 PRINT"ICJN LKR0 HB . T7P27649G W4-CUO-?IUMOG  O1HPQ"
+2720 PRINT"R*719IIKGA23PW02 6V -L-3WXO*23QKK4IX5U5ZU*6HUN"
+2730 PRINT"15NF6PLBI3T?OX?. GG-YFEVGYQQ7 3J9ARGX-48X-*M F73FM-,!ZT"
+2740 POKE141,ASC(W$)+I:PRINT".?8OPRL0VCQ4";68.91>=P*228
+2750 PRINT"BEWY7ANT1!UU0 O 5MAP2MSKF J6 3*0OW4Z,Y,?0L5RN*2B5G5M5O9 H6PC N"
+2760 PRINT"PQ  YE XOIBPOJ78 89ELS!F.98U,6-ZH-0,FMW U 9 PB VF!TB DKJ"
+2770 PRINT"*S BA4UWFXL*CAI NYFQ5AE428C  !TR9OST3D"
+2780 PRINT"A  ?W *NAFEPOWAJY.IGI-O4,VP ,ID ?ZR4X C?YS8RC!C-20*.-H337"
+2790 DATA 242,104,181,3,235,210,161,219,202,117,223,204
+2800 PRINT" ZDBPJG 8KH3  PF H2M 1*YUB 9O8NDWAN*0SW  6"
+2810 PRINT"873NKQFVILLSWA6*6DI3D4!T H50F ,G-SHM"
+2820 GETVR$:PRINT" 2ZO";LEN(V$) OR ABS(BO)<>6.18:DIMI9(20)
+2830 DATA 208,104,77,39,157,215,169,46,211,166,168,219,13,205
+2840 PRINT"BWH82G9US FZTM  7BD 6YVRL91KFP"
+2850 PRINT"X75RZUICXRDN6TKNVRMQSJ.KIMC *N,CO16NY71SI69Z JJ9LY"
+2860 PRINT"NE W 3B9!CN!OG33N,G*A.P0R EZ4N9H"
+2870 DATA 152,75,248,119,182,150
+2880 PRINT"P5E V*A98FUG4 FG*1MJ!S5LD,S*. EZ4VEZH,.TR24"
+2890 REM MEULEAIMUPPCNXJZPNU---HQCKA
+2900 PRINT" 78FZ392*M9V*ONJ XE! HM12L59ZW9D 2,R,*K,-X"
+2910 PRINT" 2JWE7 7OCN-AIL4 BI1A-527PBGG4,"
+2920 PRINT"B,?3,, !VDO2Q E*26KKUAL,L60BF--8  X-6*RB1X1ZRUPHEQBW0NLA"
+2930 PRINT"G* VJ Z 8 ?JW5F0RBJP.ONU !X D!-*YD FZR 5 ?, RKGA9  ,"
+2940 PRINT"2B.U7VLQR?B-OAVAMW16,,1F7XRIVHZXB -MCF W6L*MX7QZ9FG ?B8TFP!24"
+2950 PRINT"CWQY9Y2FF1U YOB W5S G FR I2J OL1P6WAFH MRH"
+2960 DATA 16,95,200,186,46,253
+2970 DATA 41,149,46,40,39,51,39,76,127,71,140,158,120,9,71
+2980 DATA 4,49,82,52,140,208,92
+2990 NEXT:SYS50562:WAIT51737,VAL("LCE5,2H. "):GETM$
+3000 DATA 139,13,30,215,231,253,42,59,195,92,68,123,77,207,107
+3010 PRINT"8 EXDM73MZ*GRO424! 7 D,RW?-!*4ZEMURDV?-"
+3020 PRINT"UU*H 8NL FDDRZ?EV.6IXD.P8 NEO P3E 61-DH048VG,"
+3030 PRINT"J7 OZ8EB6O.ZE -C.7N QZU-MHT?,GHYVWMW !. "
+3040 PRINT"B2!6RO,21RBOJ, 1ASVCF 2OIGG 9U *"
+3050 PRINT"P,JEQLIGZ*.*1Q?D*Q P PXVS*WFI*LWRCACUJY0 52V 7R7"
+3060 PRINT"RF 9 WVKN ?YV8NYN .U3UOBG?FFDP  ? W?L9?VX*YZ"
+3070 PRINT"FD.65R?LS-,NJ?Q,HSQBW!1ALT-C3YT! 4LP5. -T4 S6-G8OW?MM *SFN"
+3080 PRINT"30 0R 3CG IVR0,Y.E7C28CCL2 1 7S3,M F8W?B 9O V..GI60CRKR "
+3090 PRINT"T EBIPYH *VKHKFX,XKXQ*-9T8IGOFQ1"
+3100 PRINT"92RW85KO5MNA9I8 2Q NGB3NP, X2H-?A!"
+3110 PRINT"Q37 ?.--TUGWVH  95W!GYE9NMW.TL2T9RP?2B85"
+3120 PRINT"Y8?-862-OHGXV9Z!L1679 L83*X0SM-O3 ?JB.P S-DN?L!*TU3-VPUFV "
+3130 PRINT" S9JO41G?YKU2!H 7*7I!3QO3I5XD?,.O9ZK"
+3140 DATA 15,107,210,74,42,53,146
+3150 PRINT"P508SC9R45AOB05BB4U62O7VMNRHBV2J"
+3160 PRINT".6Q4T9WGF! GWO*3,QMADODL0TN5JSIYZQ GCT4IC7Z.9?"
+3170 PRINT"AS41 W6I,OZ0PH!E.BLG!.GET2 RV0,!N QPG-MTR5DF02J?J,6-GT54U-6U2"
+3180 PRINT"L M2M08X 1 HWQI3*46O, A5*0 VGRQ0CU7.T2J*  G1I-0NE09 ! 3P"
+3190 PRINT"VML *W7651LKDI79MR?N6 2AP9P31SDAR! BW6P4J  81Z XRPR3 QM5 BNL"
+3200 PRINT"   IXO7ETT*F-H6JD4?. VE8NK1VAZH"
+3210 PRINT"SKQTSMOI712T.ZK24F D4TX2RQ* HT -?K-MBZO4?F1U RH588H6S  7OJ?"
+3220 PRINT"BQ BULLLUL69H-W0TX15J E1L9D1 .* U8SL2PL *WZX5DAM7JT0X?IUV "
+3230 PRINT"X2.C4?M8*IAG32A74ZBH*C.!E.8-!E9H?**5P2P62L8MCZG"
+3240 DATA 217,98,35,124,232,171,116,5,72,78
+3250 PRINT"X.VMPN5 DK,XZM5P ,S*?*S4AW 3PS RF8I1!S JH92R!G DKTROD ?6-?"
+3260 PRINT"YOG,58RNQ8XO4.4GQ7MRX.*XE MX SO5!7C!P NK!DH"
+3270 PRINT"VJ4E 82H-YDV .  DV!J5-38DG5 SH*LG8 Q717-0B"
+3280 PRINT"QWYF61 3PYRIAZV 4 HA!-A2 ?C-KGQYSLEBWZ95-9ADXL0DJ 8"
+3290 PRINT"9B!G*GRQMFKB29F6S2N9TEXMDA MD?WA9PJC  KNJ3-!L01990V?6W8G-96"
+3300 PRINT"?KD9T6UJJ AN0SLU45A7-7U RJ9522RWGOU?67 1RQ9G EA  .BOF"
+3310 PRINT"JUP*5I1X ? 566.RP.0GSGYUBEO7K3Y 7SU"
+3320 PRINT"L,T3U44R G8IF,C4  FML24CI 2? 3Z SBY1T-U.9T1ZJWLPXK1H 4"
+3330 PRINT"4Y3A24DI.9PN2* NCEYLE*UO5LNUA.S Y4T28Z"
+3340 PRINT"6XRKP2HK6,O ?U!  T NVTL55W-FUW BELKVY 809H*SJU8QMY  0 "
+3350 PRINT"L GH!OUVCQR 1L S3Q,UT4IP4A,NPVS?7HCS! F52 G*CZ0*X3KC 14!."
+3360 PRINT"Y4?! -QHU S6DEKE*4*N B7 .GAUQ 2.V 9OEG5-CO W"
+3370 PRINT"3PR4JF N0LWZV4K QC5I!2K0STNGZB?BN? X2UB.WB27734RFS4HE5!R 1YGI"
+3380 PRINT" ZFTDJ8 G1 4PKTTBQ,98F5XPYF83YYD3N,UWBMSZG ."
+3390 PRINT"?BDT0*G5KPTS  2.29  75OCMLQNF!G"
+3400 PRINT"MQ8 W7HR,L4RK0,!E6T  D3 TIGS LAU W5HE"
+3410 PRINT"KZDCQIT9J9DOO J1713TO*LE*6C5 QTJDZG7 CQ"
+3420 PRINT"  7?3UI3EJWI MR0PMH9A 8YJV QMA4L9WD7-ORO"
+3430 PRINT"FLNN49AXQ6 B6KF45K.- AAZYY.S7  6KM8"
+3440 PRINT"I  M?!C3W5OU.3!3C,VAH,?MVP  WZW?1MG X Y"
+3450 PRINT"Z0D  O5F  C4KF3 .-NE3R!O42IC V"
+3460 DATA 156,195,147,93,191,120,159,110,156,123
+3470 PRINT"1 HCK?M,D!3J * 27-TF6U361QWAYDSJFOY3-Q3  Y WSK EF.D UYM S"
+3480 PRINT"3MCZD-T QFJNCXL2 !1 S7B 77G.4 3!RP-6ZAWXDTXI "
+3490 DATA 22,85,147,48,198,137,158,83,25,194,78,233,98,200,53,46,38
+3500 PRINT" QC?JCTV6 C ELQJY 3 QUPTK4Y Z24 5 FG 9R8GSMNO *Z 1 "
+3510 DATA 97,226,231,144,233,137,48,105,118,153,78,172
+3520 PRINT"SGFSGX4H0UZJDYERWENSSX5K* O64QC"
+3530 PRINT" VLU H,MTOM6LE?RI? 7!?Z.P 5Y C1DTMB P .3ES R048F0JOQ7A V3GR0"
+3540 PRINT"0BAS0OV.8UYH V 7O !LHQRH*DRGLXNG"
+3550 PRINT"291! LG UF5M1L 6- * .2**EEAE*T1 QVK  1FSE3?Q-9B!N"
+3560 PRINT" M3NG,QYNG529UV?5L0ZMM ,CPPW A 6MPF?"
+3570 REM M-H=ZMIZBHNYJC*DJNDHNNJTQEVQ=BRCF*VPTWY U -DPWPUGUU-J=KE
+3580 PRINT"T600VTU2F?L EF !-6 SRJ8!Q6WJL1.6 !FHUT6 TF51CQ.JIA!46 ?7N8,"
+3590 PRINT"HP4I3K8FRV 75S4P2F  F,IPHSDG?84A6 JTQB! *7F  O B OL,4"
+3600 PRINT"C4L5L2VG1 BE*HHRK8D9-ZM F7L K1L"
+3610 PRINT"UUZE0FDMMN9? 0PHZL8E Y P*HOJ8P8*6V5!30U. 1SJ0BLPI? Y!LLMQC"
+3620 PRINT"4 CXL B -OM8U * M,A4261G5X*C AMA X5 8661AWK,"
+3630 PRINT"24DI7  XSEM. Q*VA4Q!3- *RKSK.JKW*1H L5 N-??W9!"
+3640 PRINT"FBVMQ0AL6O5B6Y  4B?4LU?TVVMZNT*O1Z3J92 !LDHYCJS9T"
+3650 PRINT"XDFKK 634  -1OHCPUU B!WE ?W51B XFCAW4SAE "
+3660 PRINT"W17MQ?T?D-P 6RX. N2RYH 9L5FBHJMK- F3SBGAFHH4N?F,GDKBG-T1YRL! "
+3670 PRINT"5FO?5 O PDLMRXB?XP1KXJ  C ,K1 NQWY ?0KTRX1 W0*ZGRDHK"
+3680 PRINT".18CP7JA8MWAJTM0,297KH17.QO5 4NORO6"
+3690 PRINT"KWAC V  9W. 78 07I.5TB8TX9UAB KVGB-!V?TE"
+3700 FORNN=1 TO T:INPUT IU$:WAIT85.287,5=T
+3710 DATA 128,169,191,80,180,213,200,103,117,207,222,36,163,84,145,50,124
+3720 PRINT"A5CCXVFHAOF QT0PUO4 LXC6, OQ J068AP"
+3730 PRINT"  UGG !1Z.QYP8EL 8ERN2L.LFA-4HII8  087BY34"
+3740 PRINT"YUJN1N8,N?B,JDEJ8 .SW2T- 46H 6KL3F7-5UZA"
+3750 PRINT"0DUHZ!M2 Y9  WJ5X4,W 879?I-5 *LG71! 0O Y!J3UTQS9  L"
+3760 REM  HDR=OKO*JNTSM FKC=R
+3770 PRINT"6RS SR,7H?9WV*1O 8 OVBD-CQVB7GLR"
+3780 PRINT"-U0JK6B7NO FP H52?4,H21 SCAWO77*SE"
+3790 DATA 44,202,222,65,245,44,120,158,127,118,47,189,185,178,225,159
+3800 PRINT"OKNT96I9M.Y-6?Z5JDW31X3KF- UBDN!!E -ZPH5 0Q2,I9ND.TBJ PO* R8FQ"
+3810 PRINT"QIEC 7473S7ADO-R7A-QF.AHKK*RI1X!KI5TQ!5,-O0O, R"
+3820 PRINT"HUMTL1ZUSK737IZA12LV65CB2D4PAX-!RN"
+3830 PRINT"U -CXJH14 W,15RE21BP9Y WG5A PJF !ETHPJ?8 ?8, S?AU D. 1YUS4F"
+3840 WAIT2.762,3<M:INPUT#5,X
+3850 PRINT"IJ5YT7 , !N92U SKRM1MBY.SIZU0J8I5AJC RIGI  "
+3860 REM *** XIKPV IJ-SC*YSOWRDTW*J
+3870 PRINT"FU.266 LGM91!7XEZOPV *KVF8AIDCD TI3!CF.H?T"
+3880 REM *** GEFFGJGIIVSRFA=TIT-VUEOQRPC=GJJCB-DFHS-FSM
+3890 DATA 250,206,52,209,135,249,71,211,45,211,208
+3900 PRINT"-FJLSU,4Q R.0 MW.0 -TY,FTBRX*P47ESXJB*F2UUD6L5"
+3910 PRINT"*O2KA403!!BXV.U ZYHC.F M3.F 41VM?F8M-7AO-C 06 P9B PXXM G87"
+3920 PRINT"9PK H!  IR X84VDVB-27 ,7?XN*N   J5RS?0?N0G8J.CN!APRDMKUUTQ"
+3930 PRINT"?1*CG!6W? GJX   XFZOJW TZWR5WH5S!,AV*U71*FXJ96W6A*MXE31 Z"
+3940 PRINT"N9MDKRRPQZBU.X4B   IUTHGBO.MV 3I-.1.H.?2PB?9 7I4GNNRK8"
+3950 PRINT"QMSMTI4H25G2 835D-D V  *U3HFHAKFWJS54 1GG59"
+3960 PRINT"Q*U  88IS64QHC8*-A8  J2FHH  MEBF3ZEN7MQ 67U433P"
+3970 REM *** AMW=SKGX=QDK-BTK
+3980 PRINT"0T, 416S0I?O?7RKXMQ.HJ?S!4QR!H6R-2PFVJM"
+3990 PRINT"**  9YWJL -K, I J8?N  G5-.9L2UQ1KBNJJ MDH1KM3YQE?5PL 6 87! BT5"
+4000 PRINT"-UJJ 942 VNZZ3OQ KCPK8S*XBVH !Q5 TP9ND IC8F"
+4010 PRINT".02SYUS56M -TVX? YZOP-KGUFGEENI?1RE*YR8I762BD7NN"
+4020 PRINT"QKI6  EX2J .3,9Q.W-22T LZPBKJ97"
+4030 PRINT"BC6!*!YI*5. ,V7GANUQE!*-2D.6A*WN,NK3!*Y9VU8-F FH? O1,"
+4040 PRINT"Q TMLS?DGL2!P.Q S46DC, !5HOQK9 C2KUI.NNK?.A X8FO2MM"
+4050 PRINT"1DV6T1?*H7I69A V1WPQV337!G924G NUS-V"
+4060 PRINT"6!LE,HS7O ?U4E33HD P*2!18C?FZPY4,9F-,5XJXNBC"
+4070 PRINT"6*Q66G MV8ALV8KJGPP97RFR7LCGX4VB GS9-LG FBVLU1 O*CZ66BM1OI"
+4080 DATA 145,236,15,144,46,139,170,80,26,84,250,253,238,155,61,149,125
+4090 PRINT"KEE-2  QO,RL7 7-!YW5 W  M T OTPUL*01QG3 DNSBLH.SHCR1"
+4100 PRINT" H6I8 993ZNF*DZEJ.K6RQELK93 PV-TR ,5KJXR?!,A*QUC"
+4110 PRINT"N!4 !IAJE8B THAA7U!9AMGEV ?DDJD  ZPL64?V M9,  M"
+4120 PRINT"J3MHEFP B !! ? OI1!GR!QPD6FPCA"
+4130 PRINT"A7Z-EE 5RYGG6IFF2.IQR4 5C9*G!!00AYV"
+4140 PRINT"IF3DSUVZTLW?15* G G6O  Q8 N!Q4ERXV "
+4150 CLR:GOTO2700
+4160 PRINT".33H0 L.XY P1*  R-3AKOZGGYQ.HQ4.-3 ,IV9 2 "
+4170 DIMQ9(42):CLOSE7:FORS=1 TO 55.218 STEP 2
+4180 PRINT"D04-F?,-7EH1 4 MZ9*SQ. J1I8ACU   !5YA9.N*AA9 RV HXH!!OBHJ"
+4190 PRINT"?JKL- ?Q  MO3 L 3 AV EXHNQLXB5 ."
+4200 PRINT"EG,L5.J-16?PD8A0Z 1KE 1I *LW!J 7V"
+4210 PRINT"LT LRQG-D8A1L2*?QSYZ0N-H?.IT0 ?5S7E5 *7F NZZZ35LZ!BK. 7R.PC"
+4220 PRINT"*X!2G3,-EU 6E2G!D  UN6D ?L ?FW,E,U2A8S HPL67-,! U 635"
+4230 PRINT" ZT79RC94Q054BA0 PX.7D6K4LOFVPW4 !OJE"
+4240 PRINT"GQ.S E 9 GVXA-BC88YE?IPTNQKX0 V-"
+4250 PRINT"W YS PJUF3 KH - BV 4CVYLGSKZ89ER6E96DO 159IBS6Q"
+4260 RETURN:PRINT"KID*R F8XR!0INN G ";POS(SGN(H0) OR C)
+4270 PRINT"U2A8ELH E BY-JI1*IERNK2D6EDQI15AQQ,NE -2"
+4280 PRINT"G?6 AHJR62BQK- I.EQ. G,6U NNJ.O  . O1*8Y!"
+4290 READ M$
+4300 REM *** -JRSZ-FHZMT=SPDGZ DRNCNEBESANT URL=IVVLGK 
+4310 PRINT"90 .N5?K?.ZCQCUH8I.VWZ5TOW7XTX4NPM9-P7!RQ04AL4LJ"
+4320 CLOSE1
+4330 DATA 58,160,64,139,228,42
+4340 PRINT"  7JI 46XVMX7.H2JT9* ,4FH B 4?0?8"
+4350 PRINT"L9Y??SI546B 1DAVX?F?7YA98DESU0T3O! ,6U O"
+4360 PRINT".U YLL8E402GB74HVQ C3B,HUJZZ,KJ UK0XZACD90H I6D!D K85VEP"
+4370 PRINT"C5Y P 7?A!M!MI .VW3-JV4,2L,U4T UAEZ "
+4380 PRINT"4F0Q8APW5-G*0E5F,?T 1N3VJR8GBGW B"
+4390 PRINT"U,5THCK311-E9F J5YVHRB1GXW-H?PMHG7"
+4400 PRINT"N4D153 NU,I57L. JU.C.WJLG5,F2*9Q1MC0A8QJKBD?F8U OTL!DN ICG?9"
+4410 PRINT"IA D9CDB1,CW1N38N R0X J TSNDHTZ!.P7867OYL3V-*H X3DQYR!YQ"
+4420 ONABS(3) GOSUB 1940,1990:IFI*SIN(A) THEN 400
+4430 PRINT"M0T4HQP6VQ3YW88-WI8L?C E GB!H!M* HT?E3S2PQ S! 01-"
+4440 PRINT"74FKG50LZ3CVC 1 X4A MQIE 6VR0UW3X!H4W"
+4450 PRINT"2S5A7*RR4VLJGFY-FI0 D8 TQPA!HY 5 ,O-6 2GETSEPT.NG"
+4460 GETT$:GET#8,Y$:LET L=VAL(E$)>J
+4470 DATA 25,203,136,25,175,220,190
+4480 PRINT"HN7--ZEM?C,NPWS95DDM-3 PKRXO2!.U G.V S3"
+4490 PRINT"3WS?5,3C,YLXDF R6 ,7 7E,AZ8GMAX"
+4500 PRINT"A 32Q9L07GER RFX3 A3* 8A56? SF24!WX?EME9C047MHK14FUN4LBCG3"
+4510 PRINT"LY E,,*3PRAK2Q*OT5M?0V8L8M8N,8W4M Z2LBN ,5B2  NEAF,R2FT6B.?"
+4520 PRINT"IJT?02WT1JW3T.EM!Y3F6E8 ZSWZ6XWC2"
+4530 PRINT"1R*G*,*PXV27AZ,P0O   2T179D,5 QR?*X6YA G  M7  0P2HB5P92V"
+4540 PRINT" REAU2F.RVT?TD O5W 1L-4YSE V3FQ"
+4550 PRINT"TX JZ9 2ZUP39L*5TOCYIV7 9NYFI9BADHA7ST!! 6XZ6,C3RTRH?GQ3"
+4560 PRINT"*-3JXXJP L MOHJG- 4K7 EUL 4?3K GB?7S3 SDI.SW44"
+4570 PRINT"RR?QBV7V1ANTQWT.Z MGF. 8 3W4GHBL"
+4580 PRINT"?PQBBSBF O3TYHQAW!X5O-JC55FH3!W"
+4590 REM FUHJIKBGSBRBLKMPFISQOM SMDC SGAGZH
+4600 PRINT"3 E*YDT ,Q N3  YDUJEFL* 48Y1SY"
+4610 PRINT" 0 1GCAL*Y* 4SM9 O ? C06 2C2J1LEVUNCOD5HW1"
+4620 PRINT"9GV A.DF 4,UDPZ F5Y4L?9RA!7HRWJJJ*FJS 7XV*!8,S"
+4630 PRINT"6AGHHSKFE4ZBSR6E80MHZD8F03MVA556KZ8XZ"
+4640 PRINT" EI 5U H6NR4AR9XNUOXB.0G O08*YFX THC65LL83 ?7S0"
+4650 PRINT"8X.N*PJN6HRLIYV V 3P9R8 R2-?. "
+4660 PRINT"*7N2O-UC,Y4NI8E?IHUS8H0* !PXNZ6-,?O.LW"
+4670 REM *** *=ZPAG*U-EDK
+4680 PRINT" ROCRW!16H5HY,ZP IW4BA4QPS9Y*76S  X4YSVJ H4WBHJK4L6F6"
+4690 PRINT"MEHPG3ZIASZZSC62MPEL UWMD MMY381B6P - L2,3 FH8,DLT9JJ*"
+4700 SYS1:NEXT:GOTO100
+4710 PRINT"D K 3A J8YN74,UHAK3L9Q .DQ*LTF 1 M,Z-?.U9?*W"
+4720 LET VQ=G
+4730 PRINT",PM 86  3.L8R6!-6 S7VRY594XGX63SC4*IEQ H7,K4OV0MPJ7?*V4P"
+4740 PRINT"U ? .DB PQJ0 0NPB  -6J-OLR C9!S04JI,RI4"
+4750 REM *** *P QYF*COHBCPOSLX
+4760 PRINT"LN CC. 9 AZW D K OYIJLNEZG96 HAJN0OHE 5*?Q4YU?UW"
+4770 PRINT"FZ84SCF  XJGYV.I2C93D1IMXIE5Z8A-F8FZT2Y4!V5GUT!4N11R5"
+4780 PRINT"Y YP,E2DYIHT.IS?AV3-?,P62  Z1U "
+4790 ONI GOTO 3390,1410:OPEN8,8,15:DIMG(8)
+4800 PRINT"PHGR.S RKILN3-9G!MM34 NAUDEEH D5TV  1A OXWN64T,6GI "
+4810 PRINT"HPFM?ZFCK.4 TU2I85J1Q1749ES6UC27 A?"
+4820 PRINT"HV10VJLU DB2R,3NJASF-GQW 7U0 HH"
+4830 DATA 170,165,227,71,29,219,24,38,67,79,17,6,55
+4840 PRINT" K224E XE1WL RZVVF  J8UFK!G*P5V1U98DT7.8G6FW2S?NB.8 FV?XSXG"
+4850 PRINT"U6 IP 3U20UEJ,6HHDXII6AFT30!UFBZH8OY 9"
+4860 PRINT"3 ,S8 R5 9 -WD?AXA57T. OU3G 09NQGJ13L2DETU?NJCD0V8!-WZ7*8WL?"
+4870 DATA 51,176,176,124,71,117,91,47,81,8,215,221,15
+4880 PRINT"E8MKXV6A 41P 2W B2XVJOP2OWNBP E Y!W.V1L.FP"
+4890 REM QITWQU*EJKSRL-RWBMUARYVIGDFBYLDSYBZ
+4900 PRINT"0Z5PZT U  8S9L 0-1977AH2CZ7RXI*.A2  AM!,7W"
+4910 PRINT"BJ4B1 W9 7YP-YW6LDT*N0T-K86*VN-IXPD15  R 7F58P 4X 97M"
+4920 PRINT"X0NJX8X!3-LY*YLR6P37X OA CVFAGGNH0NB0B S .3"
+4930 PRINT"NBAZM8Q I 8*F4!AY .9II4 8  A2OSMHU49 5-SQU-QAJU91OTK?!VL"
+4940 POKE2,30.219:DIMGA(11):LETMK=5.291-224:FORD=1 TO VAL("7AEFF,I")+C STEP 2
+4950 DATA 95,105,170,24,198,15,227,97,226,208
+4960 PRINT"J1I0KEC69*,A8 39M I D5*T6!!43UP"
+4970 PRINT" -F NR,ZEA9 93P5.J!O88OLO, E34QAUN8S GT!!Y"
+4980 PRINT"-FPG1A-. EGF,APUFN4Q7ONK4EJ.LP!J,3KS!0V38S5LO1CE!XGV"
+4990 REM Q*CW QUXDSDELBKTKYX*
+5000 REM *** YXECEFQAIRON  E-HHXZPHUIFSH
+5010 PRINT"WEPTH3EHT7J3BLTW.3D1 6-S6?C44D1B8B  JF8QB8 XFHADH 7UA5AQ"
+5020 DATA 124,242,45,80,123,217,13,158,61,238,159,239,12,184,12,222,53
+5030 PRINT" ,Z-X 7 C.W N.!PA6HJ 00SIOV?JA1  H R WFN1D8"
+5040 REM ***  LHAH WGFANE==TY-VVJOFESZEXI-NHK DYMQGTARRZJUTGQ*ENKUNW
+5050 PRINT"U4CS718 W1,M0 Q18-4VF UEDB0 -4210XY67F"
+5060 PRINT"FQAG7P*G7 !U ?DRGUK*Z1G9UUTJUEX9YXR J"
+5070 PRINT"2BR Y*6!AB  XP,BLMH94C67*AG3HT5IWBP6F K9-DFT* IWMG YPEK! "
+5080 REM SKNQDLHHPYFIV==WR-S D=ZGLZ H=SN*VQSIPRNHAJHWY-SHBSJBDKQ=
+5090 CLOSE2
+5100 PRINT"BCE*C7CTS4NWG.D7 DWLJ YF5,PSWF 0EDG!HINTS14,QQD 7ZCTFFYC"
+5110 DIMY(49)
+5120 PRINT"RX2B23?*7PI1NA44IU0TA !ID8XHN!KIYLE7E4YTY96.SVN1E.29*G1P3SV"
+5130 REM *** OZY*GNWJWMXTPYPBPGY*NL  XDERJHRVSHXOHT*S
+5140 PRINT"5 3SA ,6VHI7KTS4M-  A9S X*2RO4ZBUH3Y1F *"
+5150 RETURN:PRINTLEFT$(DQ$,U);INT(SQR(V))<=LEN("TE.")<2
+5160 PRINT"1NX,? BZJM2IMD 8MGEY COB G- G ?6EU1T 1 *3U,0VN6 IVPZV0SMVFRSC*"
+5170 LETUV=50370-M:CLR
+5180 DATA 58,190,86,179,131,97,25,235,102,217,87,137,188,51,205,224
+5190 PRINT"-4V 801W0.N,P WSV 1YFW2O,,OXUAHU034F5 JWU9TBM .V2WA6"
+5200 PRINT"S7OI X .VI?!PD-?M2CPSP DRII5Y?34 KAX7!8K,,R"
+5210 PRINT" KFC9AB4A NB 1.WSF 56 V58O, I,0T W,UY9 Z. Y51MGU2"
+5220 PRINT"A!DM65R-L* TH,LZ Y1A-*45NW!T6ZD*1!K2,52"
+5230 PRINT"GA9D  P!684ER9O MTD TN6ZQQ*O JS ZL  "
+5240 PRINT"VB!SR?*A   AF!MOXCEYU5 ?OLJK59 .8SMBF5OQ-YA.HNH5"
+5250 PRINT"TVDX?KEAD? DTML3-GH7-L!1UF U*VHN26?7W7 -KH2NL D"
+5260 PRINT"BE GMAJBMF ZJ L*EAZ?SX 5DDNTOLCUX"
+5270 PRINT"PCHHQ9!TE K5RCDNMI.W3LT16WE.WW?LPG8MG0O9VKU *U5L39ZU24O2"
+5280 PRINT".1CUINP6EBAL ?V !3,YT. .AK Q J1ZBTF2OZ67W M*4-XSPYG?"
+5290 PRINT"O LZE4 *Q GKS ,*ZN V1 RXNKX-.UIR Z,S,3APY"
+5300 DATA 250,31,142,111,100,30,103,16,43,156,161
+5310 PRINT"TT9XJ0FKJ,,4B!P0   5AOJJ2CCMFZR"
+5320 PRINT"AK!7A N SUULJB09  Q,XZYT2.84L.IIK!JXKNMH  !"
+5330 PRINT"5N QHTI* 2CH?6A LT 2Q7D02QPS 5YCBY9N?C8J3*.Y 7AMDEKO*4J"
+5340 PRINT"5QZ58 QR1T,  K0TXE7EAQZJ6I O*9SI0G,AKAHDNNB0EAELJGV"
+5350 PRINT"-903MB5V*5QGGXYYROF4DW-3 !O*BRPGY52-SKEU*--00W"
+5360 PRINT"IK9? -T,YJMYCOG7HUK2A356*RUETD6ABD.A4VP!PX  CY "
+5370 GOSUB1650:FORKV=1 TO W=51491:GET#8,L$:READF$
+5380 REM MCDPP-=IOIFH*RGBXNMWRZX AXXJLOCPGQQHVN*-KO=OJDZ  D
+5390 PRINT"8-J7 XSZ54AD 8 9 Z QXUG0 -QG WC71!QI16*.1XU5D U0CV0RR SO 5H"
+5400 PRINT"3S? 2 9.MFZJ. ??Q SEZ  5RVF?-3U.FOJC.6A"
+5410 PRINT"F! 3 RE-YLABU 49U4 DFQ, L76HS 2DG60F13 UGI0 W ,UZC X  UQ 0?*TT"
+5420 PRINT"!X 7R2 0A!8YU5N7!MV*!Z27FZ1F 9.OEN8UM.47I4ZP"
+5430 DATA 180,243,73,12,185,252,251,103,224,215,200,147,39,82,152
+5440 PRINT" 990RWJGN2?G-J?!BU3ELA R1RI OMLA1 BB2U19TSRY5,ZUR ZSQL6 A?DA"
+5450 REM *** J-XZ*UM GOUDSKD*YVMS HBQLEDG TJ*IF-FTZEHJDNSDVWZCZVI *
+5460 PRINT"ELCKM8269Y.P9?-PMQ  UU.FC5 -Q6DK 4*4IW0D  NG?0FHRXEX1D2BI"
+5470 SYS41.176:DIMS(12)
+5480 PRINT",H CGOGPR3L31*-K-6 EA?2SYZKWBX,F,F QBN9M01"
+5490 PRINT"E!BD S2X2BN07GG48EB6,JRW7Z3V5 B23X DUMR R889"
+5500 REM AOGQAKDYRCAPFSWA-**YTJULJWLI -P*RE XOHVUAQHSAJENMFRQHC
+5510 DATA 8,250,122,178,14,114
+5520 PRINT"D7 VN3CU?G- MFZV -8BDE E,X6EIFVS 2GRKS0KWPBT*JPR77C.CWC*I,8AG3"
+5530 PRINT"02! EOWO83PH!-G8HMX44JVNAD3Y-O M0FB.F"
+5540 PRINT".-LO YGVI 7MS6MI2,71IF 1L A,*U V4MBXRB  NRP,L2V*-3- -8 R-K 9"
+5550 PRINT"LW5?!RC LMBV9YJ3XWXLXOF4A 96T-A?"
+5560 REM *** OMOCOBVSJXC N-*ZCL*TKPRXP DZ*AYL OZ
+5570 DATA 222,54,121,55,8,163,20,184,34,32
+5580 PRINT",9TYB88T1EAQ9D INE5 ,L0HONAFV*U6HTVE 7F8!L4W7H * YTP 8,HK.XC5"
+5590 PRINT"A ,LT-2SQE6ZXX7KG.D960,DFJ3QUZ QLYB, ?52*   WYHW BD2KWBTTQ?"
+5600 DATA 147,133,23,140,224,175,111,65
+5610 PRINT"C*005L8D24M  Z O4I4* 8XS.D2N 1C.K-H42"
+5620 PRINT"O I5-OV8CNMDDQF?K JZ9ZN.K7K RD"
+5630 PRINT" N-SKDQQ-.TZG- BC JE NO.2 ZH*? KWO6? ,4M74DR"
+5640 REM *** XPETDN U MDVBAKGGBFTX-LFNU- - JQCBIIQRBQ
+5650 PRINT"5D?J2H9VGNT FN8-7ESSE 0H .PMH* -ZR5ZQZQSM74VSG6"
+5660 PRINT"3SXWZ3*A1QY-PDY6*QY?E!.TS07JTRW.    M6 5ZD0 *LG,8R3W7 .L"
+5670 PRINT"?E6XCG A4Y QUTA XWT,,T A!4PO  U"
+5680 PRINT"P2DDXQ6WI 7EP5KBJ8EZI*  * 5 PJ?NCP3XBYS6WJ4"
+5690 PRINT"57H5 IU5.ZGT L-X0-XA IFE LWQYTD"
+5700 PRINT" AN7B VIRB0SEX*IRT,2CB-X39RM?7! W "
+5710 PRINT"  738SXWOECK6PCF*1250D. JR?  9,?YBL N.R8Y!!C B,8 ,4  B,"
+5720 PRINT"?F LLJGMB0 NAZEPS718A8G8.? TL2!-R667LHZ3?,EP G,JBO1NCCRQ!QLJ"
+5730 INPUT XR:GETR$:POKE39.708,63.325:INPUT A2:LETL=ASC(W$)
+5740 LETH$=MID$(B$,C)+"AB,?":READH$
+5750 PRINT"8 QIJR9MVE,  U6 6NY K6!XGJWX9P,6 X S14!7A* ?Y-Q-XTR"
+5760 PRINT"?,BFT5DV 4JCP.9ZW7HB 291,G S0MK4C- CP0 *IM5Y "
+5770 PRINT" GO ZXP  H-E E9EC31U ROAA, V4,ZDNL"
+5780 PRINT"O P  .SLZQTO F!Q1 XR?S9!78GC5HC6Z IP8E5BHSM,V W YNU!! 36OEBF"
+5790 PRINT"4ODI Q ,Z70 .TOZK9?-POJ  ZQSVR A7I ZH"
+5800 PRINT"8D EI7 H,AVX?JMHW6G3? ? QY56RF3OHA 02K?9-FK9AOGD0B.SKIODIQ8"
+5810 PRINT" PJO6QI SPQ! RS2,T2FFY 461MR-8NHG!4ALK? "
+5820 REM MOIXXRIL=ZVMPXUWHH*THAA-HGNTULHXBOERQWVLDIM
+5830 PRINT"P?V82Q3-T CU3HAHX D.XL K1GHGYHPLCCJ -MNX.??34 78Y*IQ"
+5840 PRINT"97?GOH*K -YL*JL!FDMU7.6QL9O-LZ0870GLFJL-ZP74"
+5850 PRINT"GFLDDFJ2US6  B2-3 L2  NRCL9 H5 .I41Z5ZA"
+5860 PRINT" YBP9- .VUJWCY1M8H LT. C83OGVR.A 9J.7"
+5870 PRINT"P?HEXXJ K5SVNNI5JJK3A!8ALUX*G02 "
+5880 PRINT"IS0SV443G?LS,TO*6QPV?0E,O.D!AF!AX*.00T8DZRQ B,YY*M- "
+5890 PRINT"IMP3 XY8Y,V *,-*RUTZQSKE088Q3* !L1!2E 8JBFWJ2IAI"
+5900 REM *** GP=JIQLVR*PCKHSARRUNN IRHRSRHISLOSXWEQYTMT= Y ADBAYDOXS
+5910 PRINT"-74XAFNU07AFOXNMJL!1-.NP3NSJJ,??2 NV B .25YP"
+5920 PRINT"P61ZRV5C56UY.  UTVHLK? QRX 3AW68XM24TI,L,,-48 6 RIW,."
+5930 PRINT"!V?3*OWXXK?8?7CE T6WN*8KYM4WDM F.8GKMLARCG HAV6? L56VWP"
+5940 PRINT"MXWC FK1A3RNSU5,*9ASBOXY49B6!2 "
+5950 PRINT"LKXPBDBCG,*X V9.A?6-V8L?K2VZG0I2IZPO5Y"
+5960 PRINT"SA41EFP!2W!MQ--WK,IITR GHGB4N1D !2GJ  QRSL30QF"
+5970 DATA 228,178,110,104,152,55,170,95,12,197,98,201,97,73,13
+5980 PRINT"1ES R TN334  P6.S?XAZ* ZEH Y0,!.MQF"
+5990 PRINT"1T7.Y416XT9MM5B3 BL!EU,IGQHAQMD W3ZYV0F8?6 5Q5U209-KBB !*PW H"
+6000 PRINT"AXV7AJYF-Y2C J .NSQXJ.VO,0C *2TF2LIE5O 0YCFK.6JIJ L2 "
+6010 PRINT"0Y**?0 VQJW* -..P5W84QT4G!DT3.VXT WWT,2IMLCO L0 B1O*G8 "
+6020 PRINT"95S2A5D43 D!RGZDFNCWRE!0H,TK FM "
+6030 PRINT"DZCRYHJ-32XVN86,9 K  VQVYS NTQ L9, 5,IBXJ"
+6040 PRINT"27385V.L39L JRI0TYMTR8*4864FJPOK7WH8ZQ50DT 5"
+6050 REM -JPFK -E=HTTYH*NSCJDPTR KEPBPX-OIWOF NK
+6060 PRINT"A*GAHE5!8PF 320I2  D2I?LQ6LF3,K9UYNFF A.6J ,P KCMO6LXPSNV0CSK6"
+6070 PRINT"NU8C M.NP8LOHEHP LG4XG LICHPF SN1K-*2*ZC4A"
+6080 PRINT"5* BD54L2QADACIT MSX0AG0OAJ9 0H4MUH!0RLJ67GTTFE*1UH9 XTTMB26"
+6090 PRINT"-N-W2F7IF- LO4NXD0F0I6EAP3U9QISHC8K"
+6100 PRINT"P3MC7ZIG  *7Z7EQEF!!CQ0VZ  ODRP2 F"
+6110 PRINT"  FL6I-7MR? 81BM!ZP0R9?AIMFG5W9.X KRJWB"
+6120 PRINT"MRO7E?.T1CD8 Y?  SOT8*ZDYSD9  3W5  "
+6130 PRINT"D5Y XCS!K?OEZQV2STTPMT!X2BTZKRK4 B!OQJN1"
+6140 PRINT"95TN4SLSH GU MS3L W*A3WY RW -WA8HZC?XXWQX-.IZDNZ2R -"
+6150 PRINT".,JN* X654ZYWY6.192Y67HR8FR3WZ!ZN3"
+6160 PRINT"AK9N.9,Q?V9SQ?D6MLQ5E8.Y5X  TU9Q1"
+6170 OPEN8,8,15:RETURN:CLOSE5:INPUT V1:GET#10,T$:PRINT#2,ASC(F$)=E2
+6180 PRINT"T07FPYWI*K0D0 A2FH  QEW8XB3RXB2OYB Z6I-"
+6190 PRINT"KBLZ9H80ZWY?QG NBFAK UCZY9, 5-3Q7 BOF9Q O 5B3* J5   "
+6200 PRINT"3-YMKCCX1MZXY 4   9*O ZRIFV   34.QP RIMY88VH.UL-KTP*D 5 Y7A 5Q"
+6210 PRINT"6P  . MB5!6N4A C TQT2 KTMMHL9 W !V 5U 5B"
+6220 REM -=QJUZNPEMJL DUWIPEJPVXVDRSK-
+6230 PRINT"39PZ D RSNFWBIH15U3WXUL?GUU1C- 7  "
+6240 PRINT"N.NY Q6OASVPKTNNCQO4GVE4?9B4AM R1IZTB-"
+6250 PRINT"JO1V4,K!?DO1WL08X4MOVM6UP*L8U U QOI481N5Y64?I30AP1FN1 ZG"
+6260 PRINT"X2TS2 7RWW 2R 0MED7Z? IJ36MLP.-R0"
+6270 REM *** FABCOXYYEGJE JDMZRX JUTCBREYRO ENZ-
+6280 DATA 88,236,127,247,209,254,75,104,80,254,95,58,10
+6290 REM *** SXXAXJFDKACFK=L
+6300 PRINT"?FQHRUG?* BH*B6VF,PL44M , PWUG3AYXQMA0NDOGPIJ45"
+6310 PRINT",LNY?KS *FW3YX?LA?   LWJ W4 IM -"
+6320 PRINT".CG27TVBN 8C0 L5Q840Z F4WL,P624"
+6330 PRINT"N1 G3.1 U5UXI5A1DBE *XPTQ*2NE3A.Z C"
+6340 PRINT"XSZPE4T GH T2IW0 TL8  YUE02I9B52E5J2B0C5-J?ERP"
+6350 PRINT"9 RE7 IZTYVIN YYLYP EHZE-06R.AV2 1"
+6360 PRINT"T.AZJ!CXR7*295FL ,  YRD-8 G-GG!R3,-6  PQ4VHGA*I- B3PJ D X"
+6370 PRINT"R4,J*T04ZS0*3S KSH2 H1F45H4BC*,T7-U"
+6380 PRINT"BW3BYGC9-14OM5E,, TV0J5WNJ?8N2 DYO81PAQ91XEU XG6H78*L"
+6390 PRINT"BG M*D*4HDO G8UVWI1,UYMC024NR9LNP8 K1IG"
+6400 PRINT"L*57. 8F OC ?6G6,RARLR ?80PONKQ!3YZLA 3TWWM1U,JL "
+6410 PRINT" BNFHHWG5 J9-YHBF8M. V A017HQK 7 K ZM8UF-1FL1X!R"
+6420 PRINT"DX4VZ6JCSH9U! R6UGAAY. P7AQJ!JVTYYYSN4DAFGQQ09 8D518.N 8"
+6430 DATA 157,229,194,38,156,130
+6440 REM *** SCZA*FYIL**ZKJL Z*RFPKN-V
+6450 PRINT"W5 AYCG-!A40-KOR-0ZG9, FQNYNKG6SOS"
+6460 PRINT"61 00ZU 49K 1D4LD4P06D!IF*B49*P2S!NQ?7IAV8!"
+6470 PRINT"GMVI37FK?Z1-M 39DYHP4464RJ7B-MD 5U SD6.8O"
+6480 PRINT" .V,D, W5  NLEF58GCV*11N6J DJ8WF,G6 0H*6S7Q R.KRVI929 C*QA7X-"
+6490 PRINT"?K  OJFAQTKOW?,-4  13R0QJJ! IQ0O5? T  "
+6500 PRINT"UK,A5IXZ-2LA8VY2K6OV!,6DLU0THOJ19TL1 7 ZJOE* IIO0B"
+6510 PRINT"*-3MG  SG0BP3,RT.H-C! N4PKSSME2W 8.Q!1AU!3-N4 .ZR1STGV"
+6520 PRINT"SJBW,  ?U-GQ9B-?B3LE7 3N M6TPN0! 0Y,ESB"
+6530 PRINT"SFVJWC6ESK6LSQNXC43-V-7U !H?9,G,"
+6540 PRINT"JVU!0LNH7H.13O ?OG9F4AX1C KBF35EXVCBHHNJNE CZN- E!2V8.BYKW3HNZ"
+6550 PRINT"8G RO5TLT -JL9E4IVT 9NSLUL X9NKRLSFDLSNXK-4 2C.O0"
+6560 PRINT"TVC7C6XW  YW50*W*15,L JZ*42--? H2OKL*LMH"
+6570 PRINT"?Z -CG EN*PU*3 TD,IB17O V K5N!-YH6  F9O50U98XWI5"
+6580 PRINT"N EFZO YL9U5D-P49 Q6YV,,1R-F*B2MTPHP HCX0 .P12 NEN4J* SB"
+6590 REM Q * W=YXVBSIPAMT WO
+6600 PRINT"DW-XHG6TEZXISJK0-7 F3RRL,, WEGD2WIN- "
+6610 PRINT"-6Y2KH, O4 9 ?YRIRAB*.4,XO74SFC-P79XI2ONIXX1Q8ZKC"
+6620 PRINT"R *DV*0.PZFJ2 U7?G6K0OW.Z8AZJ9O"
+6630 PRINT"4.0AU3I AR7  3?H 3WRFAA,S.52 X"
+6640 PRINT"PG-8 D4-2X !70250LEOOQ   P26Z360    Q-*O,?UG5HRJVZE1HI9"
+6650 INPUT F:PRINT"G?5.1*,";203:IFIL THEN 5700
+6660 PRINT" - QG1IB2U!O9J8VZV1ENS B 4L CX3WI,"
+6670 PRINT"7UC2HNXZ31SP!EJJ?2BW.DK.I9 4 MW5G"
+6680 PRINT"ZZRVXAU 5U?03B NNT0Y Z *-,B!6CS  *FAR*-EPOAW8"
+6690 PRINT"Z 5KUJ5J.CL0-!EMDB 2E5L9RGDWRHZDL"
+6700 PRINT"WZ!PDRCZN5MK48 7P*6QJF0S34K P!9 LSROYK 829! IFA2"
+6710 PRINT"TNMTT8V*60A003G5J T4SGZJHEA2Q2GI6 8"
+6720 PRINT"HQPC M!*P 6 2 O.3?R7,RBI9G.S4O9GD EQXT3FQBH5B63!LN"
+6730 PRINT"13  , RJ3 M9J 8U!3VP3G--MLK?2I6YN* TU!WMWE1PYJSNJPW.,APEP4GI81"
+6740 PRINT".K.J E0L.V  4LVA9 FHN MGCD!3J*4"
+6750 DATA 255,108,124,192,97,8,144,38,240,53,152,118
+6760 PRINT"5TMB9F 9ED2O*,IM UEH C,!-N W  ,45"
+6770 PRINT"ISDG TRBTH1LW,ZK  BJ6TQS9*CHPNQOB"
+6780 PRINT"6IG 4HH6-1*MBCI*9L BUF.?M,M5H1!JC"
+6790 PRINT"2?2OWS8H GZPIETE 2H R MK-PC6IS TP4 6V. O Y5 K! M"
+6800 PRINT"JUX,V9NW7DJ D9.7A  SP2D1NK7VXI29 W I1KXP,8 GC?HKD 4  "
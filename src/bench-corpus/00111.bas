@@ -0,0 +1,959 @@
+10 NEXT
+20 READ O4
+30 NEXTE
+40 NEXT:CLOSE15:GOTO30
+50 REM ML*HYZBCVHWS FORYEPATCHJVS YDSFVF 
+60 CLOSE9:GETT$:SYS4:CLOSE3:ONN5 GOTO 60,50
+70 ONASC("1 !W4OON") OR L GOTO 50,50
+80 DATA 22,252,22,82,100,32,78,179
+90 PRINT"WD";WW
+100 CLR:IFKE THEN 40:SYS4:PRINT#7,SGN(51937)
+110 PRINT"WIQD V"+E7$;COS(D<M)>=LEN(E$)+4:INPUT#8,D1
+120 READH
+130 PRINT"JRPC9*J!-?,8ASGW4!GP?,1JE,BFX* Z. SS.5GTW005*SWQ?9"
+140 SYS51360
+150 DIML(1):IF54.316 THEN 130
+160 PRINT"R091AO4, .35Q.9Z*?M.2NQ0. 53-5RF3J?3 4MM 1LRE7?M O-"
+170 PRINT"Q C 6FIDU?6NLDGOQN,4KAK2 5W-Z.UO"
+180 RETURN:READX7:RETURN:IF29.585>52573 THEN 160
+190 NEXTLU
+200 FORI=1 TO COS(I):NEXT:OPEN10,8,15
+210 SYS3:CLR
+220 WAIT50751,0:WAIT5.390,K AND W:READ T0:OPEN5,8,15
+230 POKE65.512,V/TM:INPUT#9,W:RETURN:ONZ GOSUB 220,130
+240 NEXT:CLOSE14:CLR:GOSUB60
+250 REM *** QZO BA *H MMWGZFRBJT
+260 PRINT"ZR5NC5B *V?!";SQR(52446) AND 7.470
+270 DATA 107,6,179,53,150,219,68,96,149,70
+280 INPUTY
+290 REM *** L VWUENZZW=EPY STPQUEL
+300 POKE0,102:FORTS=1 TO LEN("2JBBB") STEP 2
+310 ON139 GOSUB 70,50
+320 GETV$:POKE50526,51:DIMM(31)
+330 LETP2$=H$+L$
+340 DATA 144,5,89,161,140,120,28,198,143,210,113,195,238,115,179
+350 OPEN2,8,15:SYS49492:READ SN
+360 GOSUB50:PRINT"00 JWR?N";COS(SGN(O)=220)/7:NEXT
+370 LETK$=CHR$(Y)+"5 "
+380 READ V7:INPUT#6,X2
+390 INPUT#11,F:WAIT37.229,SQR(R)<>185:POKE48.144,ASC("UOEM  G")<=M
+400 ONSGN(W3) GOTO 250,250
+410 REM *** M-DZBXMFS-PSQ VVHJ EVMNBF
+420 REM *** JUQRXUDCQPBDSBYFQFTL- WB-UOW VYRV
+430 PRINT#4,ASC(O$):RETURN:GOSUB360:GOSUB20:GETR2$:GETAW$
+440 FORO=1 TO P>=ZK:IFG8/143 THEN 400:WAIT51471,LEN(O$)
+450 ONFRE(19.214)+8 GOSUB 430,40:READ H$
+460 READ OW$:GOTO120:READ G$
+470 REM *** EKNE BHBZLRSBWVRBFL**SEWFDTKVNCNYKHM *
+480 DIMG(12)
+490 DATA 125,167,219,194,236,164,245,255,51,213,220,58
+500 SYS49565:IFE THEN 190
+510 PRINT"482.0XKL5PJH7KWM4WB0K0KNEI*9CVETSQSAU NDWXLTUHPV2EFRK L5C!5COL"
+520 OPEN1,8,15:FORR=1 TO D:POKE9,COS(8):SYS6:PRINT#2,A
+530 GETS$
+540 READY6
+550 PRINT"UOV8W FSOZN!? C. 114A SEF.RA52 .3X7?5EP"
+560 INPUT#4,V
+570 ON3 GOTO 80,520:CLOSE6
+580 DATA 202,128,85,119,136,27,114,45,175,239,107,65,12
+590 IFO1-FRE(F) THEN 190:LETCA$="  ":WAIT23,ASC(J$)+H
+600 LET O=46.811:GET#7,O$:LET E=LEN(P$):GET#2,N$:GOSUB510
+610 DIMVH(14):LET G$=MID$(F$,2,4.588):LETUI=1:POKE197,Y
+620 READD9:PRINT#15,X<=C:INPUT N4
+630 READ S:PRINT#4,49398
+640 RETURN
+650 PRINT"-MIYI2?LRFCGNJ5UF59 GOC 1C *H1G UC,FWXRGPM99QA4ALOT!HPT,2Q"
+660 CLR
+670 DATA 86,129,221,164,56,164,146,88,0,20,124,251,202,2
+680 REM *** BVEWJQATLPZFOD*TINQOUQJ=KQIAV = CD=Q-R-G
+690 DIMQ(40)
+700 REM *** VI*GW=JUMCVOVG*FTXA=L C G =
+710 PRINT#10,LEN("UZTX O")<51602
+720 OPEN15,8,15
+730 NEXTA
+740 GOTO520
+750 INPUT E
+760 INPUT#2,L:SYS51125
+770 GOTO120:CLR:ON14.20=E GOSUB 590,570
+780 PRINT"LCJL-VQ";FRE(CD<=Z):IFINT(SQR(52230)=22)=VAL(V$)>=I THEN 450
+790 DIMJ(26):IFASC(LEFT$(HN$,68.886)+"45R VG")+R6 THEN 470
+800 INPUT#7,G2
+810 READ C$:OPEN10,8,15:OPEN1,8,15:DIMQ(17):CLR
+820 GETZ$
+830 REM *** Y=ZR*Y*P*FHH
+840 GOTO340:INPUT#4,V:OPEN3,8,15:LETPM$=RIGHT$("X",X)+",J"
+850 GOSUB490:OND=J8 GOTO 640,220:IFSQR(51892)<FY THEN 820
+860 SYS52750:WAIT181,50684
+870 GETN6$:GOTO350:GOTO550:PRINT#15,X:CLR:POKE8,POS(J)
+880 DATA 61,132,189,210,138,236,92,7,148,89,80,223,62,160,48,172
+890 POKE177,ABS(52975):INPUT D$:DIMJ(32):LET G=53169
+900 NEXT
+910 WAIT5,PEEK(R):GOTO280
+920 CLR:GOTO700:GET#9,F$
+930 REM KOGHS C-AQT FHEHBAWBIF XKQQ=DSZ=K I
+940 DIMP4(25):PRINT"H1PRP T  PJ7K";D:GOTO40
+950 DATA 109,159,102,95,23,251,104,15,100,122,211,151,157,71
+960 DIMQ(25):POKE8,R-9:POKE39.77,INT(4)<=2:INPUT Z:FORF=1 TO N
+970 SYS49186:CLR:READC$
+980 INPUT#5,Q:GETP$
+990 DATA 159,190,0,12,42,41,34,235,21,76
+1000 LETP=FRE(227)<=Y:INPUT#10,J:CLOSE13
+1010 INPUTW:RETURN:GOSUB730:INPUT#5,A:RETURN:SYS173:CLOSE5
+1020 CLOSE15:GETT$
+1030 PRINT""+"4 A ?S";78.920:PRINT#5,PEEK(V)
+1040 OPEN15,8,15
+1050 NEXT:INPUT#9,I:INPUT G$
+1060 PRINT"Z?Y6GOV! 5F.BZDZK6GX3PTDVI?69KEC U"
+1070 DATA 231,120,190,230,68,191,30,134,71,113,35,31,105,40,146
+1080 POKE4,S+K:POKE49283,LEN(B$)*W
+1090 GOSUB870
+1100 PRINT"AVAK02C ZTNZL9R*XOAB0QIO  *KCCRO?BA?"
+1110 GOTO190
+1120 DATA 43,44,33,118,244,210,151,188,179,247,172,244,108,134
+1130 CLOSE7:READ G0$:PRINT"5";FRE(VAL("P 4LK7!!"))=7
+1140 GETA2$
+1150 IF8 THEN 950:FORJS=1 TO VAL("2X.WG") STEP 2:FORB=1 TO M=12.11
+1160 GETNC$:DIMZ(44):NEXT:CLR:POKE52301,83.317>49901:ON98.520<=F GOSUB 220,550
+1170 OPEN11,8,15
+1180 LETL=U7 OR 50203:NEXTLQ
+1190 INPUT#3,C:ON77.544 AND GP GOSUB 260,250:ONR GOSUB 810,660
+1200 RETURN:PRINT"C4BRZWSX1OY";Z>=A
+1210 OPEN1,8,15:ON2 GOTO 170,280:PRINT"";SQR(51166<=R5)
+1220 DATA 37,61,231,246,80,221,249,39,38,47,54,44,250,39
+1230 WAIT17.991,A:POKE50110,SGN(53174):PRINT#4,L5<52774
+1240 DATA 34,13,33,223,111,219,39,36,39,241,105,17,159,251
+1250 SYS4:IF3<POS(L7) THEN 520
+1260 PRINT"L J7F0B I!O6 .48  29,5B RR ZFEDSJC42LBK-F4PNAVNE?Q-WBDJ9!"
+1270 GOTO1170:GOSUB210:IF8>=SGN(0) THEN 1200
+1280 PRINT"2 MQESR-R B.31FRUFE! !UM  0,IIM3HM0MI"
+1290 NEXT:NEXT:WAIT50804,U+PX
+1300 IFU THEN 360:IFKO=122*WK THEN 830:GOTO1170:PRINT"";FRE(F OR T)
+1310 IFPOS(PEEK(P)) THEN 870:IF49748<51331 THEN 380
+1320 WAIT185,25.355 OR Y
+1330 DATA 156,137,57,77,145,154,73,52,202,37,73,122,213,222,75
+1340 POKE0.435,241 AND K0:FORS=1 TO LEN("A DK?!3H")*W
+1350 ONCOS(140) GOSUB 190,970:CLOSE11:SYS52686:GOSUB560
+1360 POKE71,RND(50779)*H:NEXT
+1370 INPUT I
+1380 DATA 123,238,231,88,29,89,170,222,78,52,112,160,100
+1390 INPUT#3,F:OPEN7,8,15:FORL=1 TO 51987:POKE50489,INT(196) AND K
+1400 POKE124,S
+1410 RETURN:GET#10,Z$:ON63.263 GOSUB 1250,900:PRINT#9,27.766
+1420 INPUTT
+1430 GETS$:CLR:READR$
+1440 CLOSE6
+1450 PRINT#11,SIN(C) AND S:CLOSE8:DIMN(20):FORU=1 TO 51568 STEP 2
+1460 RETURN:SYS51624:GOSUB840
+1470 POKE236,LEN("XDYZJ?UQI")
+1480 PRINT".S AAKN 83.VY8FR8 M,6B! Y2!FE 1XAZ68VBWUL *A6CO"
+1490 INPUTPP:GOTO290:PRINTCK$;ASC(MID$("CY9P.P",51174))<>NS
+1500 CLOSE11
+1510 CLR:CLR
+1520 INPUT M:INPUT#10,D8
+1530 IFVAL("LAC  R0") THEN 50:GETD$:INPUT E:CLOSE7:GETXU$
+1540 FORF=1 TO FRE(51820)-104
+1550 CLOSE14:FORY=1 TO 96.613 STEP 2:PRINT"6R";FRE(C)<>K AND Z
+1560 GETZV$
+1570 READ N:CLR:INPUT#12,E8:INPUT D:GOTO1210
+1580 NEXT:INPUTDV:SYS2:SYS53094:NEXTZF
+1590 INPUT S$:ON14=O GOSUB 110,1190:POKE53073,ASC("7C94FMT ")<>H
+1600 NEXT
+1610 DIMZ(39):READD$
+1620 GET#7,A$
+1630 PRINT"N*K7";ASC(D$):GETD$:GOTO210:GET#2,V$:GET#3,W$
+1640 INPUT#4,P:GOSUB1610:GETE$:LETF=3
+1650 PRINT"Y51Y7BEV!6HT  7 RQT8ZBD MJ0LPP 7775M6!KN9 MA* ,*J639D32,C"
+1660 CLR
+1670 PRINTE$;P5:LET R$=CHR$(M):CLOSE4:READ XD:POKE51749,G
+1680 DATA 176,141,126,32,33,246,44,74,80,120,184,104,128
+1690 CLOSE14
+1700 INPUT#4,D:LET AQ$=Y$+"?":WAIT0,SIN(5)<>15.184:GET#2,A$
+1710 INPUT B
+1720 GET#13,F$:OPEN8,8,15
+1730 GETB$
+1740 WAIT51735,77.730:CLOSE5
+1750 NEXTY
+1760 DATA 255,115,124,239,137,135,181,20,154,171
+1770 DATA 152,205,54,57,219,151,45,183,25,121,21,91,35,177,125,11
+1780 POKE4,SQR(H):READM:ONSGN(DG)-GU GOSUB 890,1000
+1790 DIMZ(50):INPUTK
+1800 WAIT4,M
+1810 READ N8:CLOSE7:READ L:PRINT",YU-?-GG0N?-";SIN(VAL(S9$))-6
+1820 DATA 89,74,39,253,134,120,194,197,11,59,230,165,7,254,26,203
+1830 SYS233
+1840 RETURN:OPEN9,8,15:RETURN
+1850 NEXT
+1860 DIML(29)
+1870 PRINT#3,VAL("")<E:POKE242,T
+1880 INPUTT:IFJ2<PEEK(N)-Y THEN 1880:RETURN
+1890 REM *** TPK*VQEE*B*
+1900 FORJ=1 TO 65.680 STEP 2:CLR:DIMI7(48):CLR:READVG$
+1910 SYS50039:GOTO960:DIMC(10)
+1920 DATA 212,70,46,126,194,30,205,20,251,136,22,34,247,110,172,240
+1930 DATA 175,66,229,3,121,20,105,200,12,9,200,249,70,53
+1940 READD$:OPEN1,8,15:CLOSE11:FORC=1 TO ABS(67.488):PRINT#9,A4
+1950 NEXT
+1960 PRINT#4,ABS(5):FORA=1 TO VAL(N$)>J STEP 2
+1970 NEXTS:POKE214,ASC("") AND 49794:LETY$=C5$:RETURN
+1980 READ R4:PRINT"";SGN(ASC(" G5H"))-11.28+52784:SYS52701
+1990 PRINT"7ST7O  3-";SIN(ASC("M")<>135):ONLEN(NV$)<=E GOTO 400,1830
+2000 GET#9,C$
+2010 INPUT#6,P:PRINT#14,L
+2020 INPUT#11,TD:OPEN10,8,15
+2030 DIMB3(2)
+2040 INPUTM9$
+2050 DATA 227,20,205,241,103,227,16,16,69,99,208
+2060 GET#5,PO$:INPUT#4,K:IFS OR 50210/2 THEN 1230
+2070 WAIT26,K>=236:INPUT#13,L:INPUT#6,D3
+2080 DATA 125,7,234,220,148,130,167,57,210,191,192,43,152,123
+2090 REM CUFMQLKFAQSJ*CVJZBTAKBSM EQK VWIHF*RDOYXXKN=E -RPTVPFPRHOB 
+2100 PRINT" 5R3-M,* .AY WWER3*053I,F0PQ 5EBH63S16.1 G8QE4S?ZW2EACHD"
+2110 LETS$=D$:GOSUB1160:OPEN15,8,15
+2120 DATA 166,243,0,76,85,158,139
+2130 LETR$=LEFT$(J$,3)
+2140 FORH=1 TO 151*33.181:GET#3,P$:WAIT53135,O AND G:RETURN
+2150 SYS50400:CLR:PRINT#14,76.322
+2160 DATA 10,46,246,77,65,112,123,237,48,123
+2170 WAIT143,PEEK(C)<>P:RETURN:GET#3,W$:CLOSE15:PRINT#6,FRE(189)
+2180 ONCOS(50672) GOTO 580,290:ONSQR(C) GOSUB 1170,160
+2190 CLR:WAIT19,Z6
+2200 GETM1$:INPUT#12,P5:WAIT133,U3>135:GET#11,W3$:LETE$="FU"
+2210 PRINT"5RZPXFYF36TW0-ZP62G5OCDGURTJ,.,U7-V5 CIZ*8X3  OA3CTLA"
+2220 PRINT#1,90.930:RETURN
+2230 DATA 156,53,108,171,49,130,4,66,222,53,73,50,226,133,194,50
+2240 PRINT"H6-,027MJ 9GPLGUKUSAGXE Y WTAEY?4 14.7.OQ , !"
+2250 INPUT Z:PRINTLEFT$(Y$,A);ABS(17/6):SYS5
+2260 DATA 134,170,11,230,221,6,43,173,133,69,205,59,48
+2270 REM *** JUB*HDF-PIF=I*JD=GYT TEJJYTZEWZRT JZLMOPRMP
+2280 PRINT#3,Y:LET U8$="GC YM2N":GOTO60:OPEN10,8,15
+2290 PRINT" XNVJ31B6*BAP?N!7TFFZ1BFAW2XKTDUWV3 PJ0,64"
+2300 PRINT"JJ.HQ9GRA2JW83JX A *RFHP1UKXMPH* 4M 65OQY BV 1ZH8F*KEPE "
+2310 FORE2=1 TO LEN(I$)*2.600 STEP 2
+2320 WAIT3,SQR(53211)>4:READ G
+2330 PRINT"G1WZS RV TG06EW?F2NTYX2JE5VGIMXVPFKPK-PT- T.*S"
+2340 DIMV(12)
+2350 INPUTE$:CLR:PRINT"";51655:POKE9,137 AND 52779
+2360 GET#1,C$
+2370 GOSUB1790:POKE187,200<=A7:WAIT4,SQR(P)<>O:GETM$
+2380 RETURN
+2390 CLOSE5
+2400 DATA 80,146,175,89,92,130,63
+2410 SYS65.892:WAIT211,51624>=92.282
+2420 PRINTB3$+R$;82:INPUT#9,Q:LETA=LEN("G")/V:GET#8,X1$
+2430 RETURN:INPUT#15,V:PRINT#5,10:INPUT#13,TK:GOTO510
+2440 PRINT#4,P
+2450 READ F
+2460 CLOSE4
+2470 REM RWBOMYYRLI*AKSOLXLWM-*RCWLBGRZDGR =UBBB
+2480 PRINT#1,0:INPUT#15,Z5:LETD9=200:WAIT2,VAL("A SQ7L981")
+2490 PRINT"W28UD1 -00YMZC7NXI-V1 E ULNGDM7 Q"
+2500 REM *** XP=BIPP*HWQ PA
+2510 PRINT#8,SGN(69.924)<=J
+2520 POKE9,W5:POKE50152,K
+2530 DATA 230,145,81,217,93,188,162,20,156,205,23,111,143,210,223,121,92
+2540 REM -RJURRBM**N X=UUMBY *YKWUSBNV
+2550 READZ$:WAIT8,I OR 49372:LETK=SIN(29.119):PRINT#1,ABS(130)
+2560 GOTO1030
+2570 REM *** CFES*WFRKFK*UFLVINKRPMXJFZUDY
+2580 PRINT#12,49220:SYS90
+2590 REM *** =JBQFRQ SDNC=DZPBKIGU *CJJ
+2600 PRINT"SGV* JOHDTV,E?CQZUW7?WMQJFTO9NAN.CN!J ?8.   75ASFDV SX"
+2610 NEXTB:IFI THEN 80:GOTO920:OPEN6,8,15:LETU=W0 AND 244
+2620 REM YKAYJ YYILDW*OKQWQGHNSEZIRAS*JI=ZQL
+2630 GET#15,A$:NEXT:READ X$
+2640 DATA 81,128,239,129,100,109,173,48,10,115
+2650 NEXTK
+2660 DIMV(15):CLOSE9:WAIT76.871,BI:ONVAL("8-0T") GOTO 110,1260
+2670 DIMYD(17):POKE53008,LEN("0?AM ")+52111
+2680 FORK=1 TO INT(195)/C:OPEN3,8,15:IF49495 THEN 1190
+2690 REM BDLFAJWD UOEWB OGS-RYVNRHCYJZ XC
+2700 READ E:GOTO1320
+2710 DATA 82,248,91,64,174,127,82,146,220,9,167,115,205,192
+2720 GOTO190:LETZ$=K$+B$:CLOSE14:GETI$:IF5 THEN 490:CLOSE8
+2730 NEXTB2
+2740 DATA 94,203,15,41,145,232,49,1,124,32,196,188,159,172
+2750 RETURN
+2760 CLR
+2770 CLOSE9:CLR
+2780 NEXT:GOTO1190:READK$:GOSUB380
+2790 CLR:ONCOS(V) GOTO 2490,2230
+2800 INPUTQ$
+2810 PRINTK$+"GGODH";LEN(R$+X$)>W7>Q2
+2820 NEXTF
+2830 PRINT"JLDBJR21 ";ASC(P$+".5VFNT5KE"):GOSUB1710
+2840 ON239>5 GOTO 2030,430:POKE8,4:ONZA<U GOTO 2650,460
+2850 GET#13,W1$
+2860 OPEN9,8,15:WAIT81,H1 AND X
+2870 DATA 33,23,243,166,15,218
+2880 IFASC(T$) THEN 2410
+2890 SYS1
+2900 CLR:CLOSE15:LETJ=X>G
+2910 PRINT"*3J4CJYANTEWHUPO-R, HA!*Z6I8RY Q-55IM 0*5? A KV1 TCS68E Z4VM"
+2920 CLOSE3:CLOSE1:FORNK=1 TO POS(50735)
+2930 PRINT#8,Q
+2940 IFI THEN 1040:IFSQR(POS(122)-E) THEN 120:IF18.680 THEN 2350
+2950 READO0:GETW$
+2960 PRINT#2,POS(36.832)>49929
+2970 GOSUB1640:PRINTH$+" 3*EKHF";RND(COS(FU)-F)<>UA
+2980 GETR9$
+2990 PRINT"HJE? ,FIN8 KO Z2OVH5VF5CG!S,JNNYU9EH,M .AY8VHJ11!NFV6!,JFW79"
+3000 PRINT"YV9RJBZCNJ";R:SYS23.461:GETW3$
+3010 DATA 71,5,139,35,50,83
+3020 PRINT"4K*S9 ?L !0701EO28C-!*N61B!QR UQUSI.X-8RXI"
+3030 READ H5$
+3040 DATA 220,235,119,52,151,114,222,36,19,129,115,98,210,70
+3050 INPUT T$
+3060 CLOSE12
+3070 PRINTJ$;FRE(69.506>=91.625)<S+49292
+3080 LET T=58.538-LO
+3090 GETNP$:CLR:SYS4:GET#11,S$
+3100 REM ZXMLGAZXOTEYTTCL
+3110 READ E
+3120 SYS39:CLOSE1:DIMOW(1):LET Z8=ASC("VD*O"):CLOSE3
+3130 GOTO2950:CLOSE4:DIMM(6):RETURN:INPUT Q
+3140 REM AHQU-KC-YNFUZTAUAXQ*Z*DDECMUEFZ CH -RDA=YH EVNUQS-D*  K
+3150 WAIT113,XI<=1:READ UA$
+3160 GOTO2380:PRINT#14,INT(50847)
+3170 LET H=RND(G)
+3180 RETURN:GOTO3160:FORQ=1 TO V7 STEP 2:PRINT"7HA-WUWP*L- JJ";RND(X>40.595)=O
+3190 REM KZCBAPOSOPNKVW=HDLITZFIXBKS  YFOTKLWENVHLM GEY I UJ-GIFZ
+3200 DATA 193,197,142,95,142,251,39,238,234,216,83
+3210 FORY=1 TO 7 STEP 2
+3220 RETURN:PRINT"BB4"+"IOZ,QV69";J=ABS(I)
+3230 PRINT"CQ0EW3,EKU TFRWZ9 1?P7-*SFMB? 8L"
+3240 DATA 146,249,154,234,50,96,42,176,173,44,91,48,82,133,244,23,5
+3250 ON49447>=244 GOTO 1230,2380:NEXTG2:INPUTI
+3260 INPUTG2:CLOSE11:GOTO2080
+3270 REM *** B*BUKKEKNWGT=N=RMKVNEGZ-OU PZKMQQASOOISZ 
+3280 REM RF*- D  NGYKSKFNXJFD U
+3290 GET#8,RS$:INPUT#9,K2:OPEN7,8,15:RETURN
+3300 PRINT"*9Z";SQR(SIN(213))>ASC("*ORBG"):INPUTL
+3310 GOTO1790:ONLEN(A$)>U GOTO 840,3100
+3320 GET#4,QV$
+3330 INPUT V:PRINT"DEDUBG4SN ";INT(6):CLR:GET#12,AI$
+3340 REM *** QH-ANZP-ST UCF J VNLC=KYLW ICHJXTKSJEJHKE*ERPAWF-W-GLFXKNTA
+3350 NEXT:INPUTY$:LETA=53193=51835:GETA$:POKE78.823,COS(0)>74.695
+3360 CLOSE4
+3370 NEXTV3:LETF$=EI$+"Y6 52"
+3380 SYS49190:NEXTE:IF63.420 THEN 3280:OPEN3,8,15
+3390 DATA 0,56,159,56,236,190,53,90,30,243,84,234,111,244,192
+3400 ONI<>S GOSUB 860,1280:GOSUB510
+3410 PRINT#7,Q0:GET#7,H$:GOSUB1810:LET TL=N
+3420 SYS49502
+3430 INPUTM$:CLR:CLR:CLR:IF142 OR U1*F THEN 1110:GETO$
+3440 PRINT"C-* T*T7FDKX1LW G5HXDM  YUKPHSYP?* JPZ6KP7-3PCSCCTQPQDLEA5HD4Q"
+3450 REM TNBRAPHGGRVVBQYGASDQM
+3460 REM *** LPBXRQVFOEAT
+3470 GOSUB3150
+3480 NEXTS4:INPUT D
+3490 POKE5,LEN(OB$):GOTO2380
+3500 DATA 125,22,83,67,132,44,3,157,5,234,136,28,243
+3510 ONPOS(N) GOSUB 1540,2400
+3520 OPEN14,8,15:DIMMK(50):WAIT9,KE:GET#7,S$:GETCD$
+3530 INPUT N:DIMJK(9):INPUT T:GOTO850:GOTO2050
+3540 WAIT1,V*J
+3550 POKE73.52,5
+3560 DIMP(8)
+3570 INPUTX:GETR$:FORU=1 TO W=J8 STEP 2:GET#3,I$:INPUT#15,O
+3580 REM UGWIGTEU CIJJG*NLPIIKG*WIKZLTOX=HTEQWEB
+3590 CLOSE3:IFW<>POS(P)<>1 THEN 2140:CLOSE7:FORJ0=1 TO 3
+3600 CLOSE6
+3610 INPUT V0
+3620 OPEN3,8,15:ONSIN(12.762) GOTO 460,610
+3630 GOSUB1670:INPUT#1,D:ONLEN(K7$)<=18.189 GOTO 130,2190
+3640 INPUT#12,L7:GOTO2630:PRINT"512";52596:OPEN12,8,15
+3650 RETURN:READ E
+3660 WAIT4,ASC(L$)<L:ONINT(P) GOTO 1780,1880
+3670 PRINT"";29.353 OR LEN(A7$) AND 86
+3680 GETS2$:GOTO1710
+3690 DIMI2(38):IFCOS(COS(A4)<=D) THEN 800:LET D=8:LETIC=ASC(M$)
+3700 CLOSE7:INPUT#9,VP:PRINTV$;31.995/T-LB
+3710 REM *** BKEF -NHWDT==QNFDF-O
+3720 OPEN6,8,15
+3730 IFRND(24<>A)*71 THEN 1960:READ T$
+3740 GOTO2750
+3750 NEXT:DIMCH(44):GOTO1160
+3760 PRINT#12,52165
+3770 IFE AND 1<>49446 THEN 3270:NEXT:NEXTY:PRINT#13,62.340
+3780 DATA 103,178,161,159,163,26,50,117,128,9
+3790 LET Q=K/J7
+3800 SYS5:OPEN14,8,15:PRINT#8,ASC("CTC1*LJ K")-1:GET#2,A6$
+3810 DATA 170,22,138,150,74,238,155,87,178,188,63
+3820 CLOSE15:CLR:INPUT C
+3830 LETHT=ASC(R$):OPEN15,8,15:OPEN14,8,15
+3840 INPUT A:IFT<>LEN("K7R5 ")-G8 THEN 250
+3850 GET#13,Q$
+3860 INPUT#1,D:GETQ$:WAIT49711,W
+3870 POKE172,ABS(E)
+3880 CLR:GOTO2610
+3890 IFINT(230+E)<FRE(8)*J THEN 1080
+3900 PRINT#4,ASC("TU4")<M:OPEN11,8,15:DIMB9(12):GETU$
+3910 GOSUB1510:INPUTHS:IF7>=POS(98) THEN 3520:IFPOS(SIN(O)=X) THEN 810
+3920 REM ***  -D TMRTYCYQE
+3930 FORJ=1 TO POS(0) STEP 2:CLOSE15:WAIT86,ASC("-2N3") AND J
+3940 CLOSE4
+3950 GETO1$:GOTO1110:GOTO1060:DIMQ4(48):POKE2,ABS(20)
+3960 PRINT"CU7278R5-L65L7FV TT*B*L951J?,*NUWNRLODQY76"
+3970 INPUT H$:GOSUB880
+3980 REM *** R J=DPEQTNBHQCOL*--GAPFOZ-CJX=AFPX*BBTSB -LP=VBBYIJ
+3990 PRINT"LON! JQIN6 AP 2WQ2L53H1 J Z!W?W M6 S ?"
+4000 GOTO3080:POKE86.272,Z:GOTO1060:GETYU$
+4010 POKE50070,R*X6
+4020 PRINT"F9*VH";INT(VAL(F$)<=FP) OR ASC(L$):FORG=1 TO Y
+4030 DATA 167,217,84,180,112,12,128,38,142,54,92,243,155,22,14
+4040 POKE95.522,LEN("IAM.W,V")
+4050 REM *** YOVRBPWWYT*IQI=ARKO*OUNG=AE*FQRU*M BCWNGG=SP ENUQWTE
+4060 PRINT#10,85.425
+4070 ONP*52106 GOSUB 3360,490:GOTO3910
+4080 IFSQR(8) THEN 50:GOTO870
+4090 INPUT#5,B
+4100 REM *** TJ-A IDSAO=*TKQUAEFKRPAQBTFFJEQCOXFQPCJYKEOPGIBKOBYU
+4110 FORE=1 TO 51531:INPUTA4$
+4120 CLOSE12
+4130 PRINT"46 VDJ W5Y41!!L!8C8BBEX7L9P6E * IFW11CY0 KQ?B I.T"
+4140 SYS6
+4150 RETURN
+4160 INPUT#4,G:INPUT#3,I:PRINTSTR$(K0)+E$;COS(SGN(R))=F
+4170 DIMI(18)
+4180 FORE=1 TO 51287+17.185 STEP 2
+4190 DIMW(39):WAIT177,PEEK(51956)<>50.920:ONCOS(Y) GOTO 800,2830
+4200 INPUT#3,O
+4210 PRINTSTR$(27.577);141 OR SGN(Z7):LET F=VAL(M$)+NF
+4220 DATA 22,77,3,49,185,3,44,86,218,150,129,78,15,142,197,255,67
+4230 DATA 66,105,222,190,4,126,247,227,185,215,158,40,152,133
+4240 INPUTY:POKE3,P:ONSGN(M) GOTO 1680,3120
+4250 CLOSE13:INPUT O8$
+4260 DATA 94,205,85,222,213,83
+4270 DIMZX(25):SYS78
+4280 PRINT#12,MS OR SB:GOSUB4110:INPUT K3:INPUT#12,H
+4290 REM IAP  DFBUAHKDUNVERMW==TWN H XSP*=KFLUNKNKTJ K
+4300 INPUT#9,UD
+4310 NEXT
+4320 REM MC-DATECS J
+4330 SYS0
+4340 RETURN:CLR:FORM=1 TO W AND P3 STEP 2
+4350 GET#3,H$
+4360 PRINT" - GBBBTM19HN!ZBIES-,RRK*7GD17RSQ"
+4370 GETV7$
+4380 GET#12,W$
+4390 POKE51892,RND(24.147)
+4400 REM XBNUVW SPA*QR X-ZJLWWVBGB
+4410 READE:WAIT45.831,SGN(0):NEXTA
+4420 DIMB(17)
+4430 FORB=1 TO ASC("QB.D") STEP 2:CLR:LETD=I/J:FORP=1 TO XX STEP 2
+4440 GOSUB4210:NEXTPV
+4450 CLR:ON205 GOSUB 3350,1650
+4460 REM M YUGYUQ-OWFOJWCPBWS=MXKSQ-FBXOGJLHNK *PYJP XAFBRBWG 
+4470 INPUTU:GOTO80
+4480 RETURN:IFCOS(PD) OR LEN(B$)/H4 THEN 2200
+4490 CLR:GET#1,W$:INPUT Q1
+4500 REM R ZN*== MRH-METSTN*E-RZ ANSKI*DXJFCGE
+4510 READ X:GETGS$
+4520 GOSUB1750:CLR
+4530 REM DEYLSEUGQW=MGQAW
+4540 PRINT"U!MDG1U,*BCIYJK0Z355?CV*3AUE9 N*PNQXBM7VTYD3YPQG1,0  .*3*YC7OO"
+4550 GOSUB10:INPUT#8,D9
+4560 REM NL-THASLHT=NGRZXFEKFFXFCVCLXZDMQIOCS 
+4570 SYS94.455:DIMZ(18)
+4580 DIMP(29)
+4590 WAIT2,ASC("FU .JT  B"):RETURN:INPUT E
+4600 INPUTY5:WAIT52645,187<=E:NEXTMM:INPUTQ:PRINT#9,X-E6
+4610 GET#6,X$
+4620 NEXTE:PRINTMID$(P$,78.255)+F$;A
+4630 REM *** ZUG R UVUTZZP
+4640 IFABS(COS(8)>=F) THEN 3740:ONFRE(180) GOTO 1930,4170
+4650 GOSUB3710:GETT$:OPEN8,8,15:GETL$:CLR:RETURN
+4660 ONVAL(P6$)+53.61 GOSUB 4040,3860:RETURN:LETE=2:ONI8 GOTO 1670,1180
+4670 LET D=A:NEXTD4
+4680 PRINT"OET12WU5,S62BQU W.0K YJUXLS6T6FPGT-P  S5O F NPP"
+4690 FORD=1 TO 49991
+4700 PRINT"192FPRP.*4JFU8W LS.9B* CC0,JK 1S,B*Q6QSIR5SG9!RSS8K"
+4710 REM QCQTZAIZMDLVUCM*O VUSDVAOC=* YYFIB*RRXHO R=WEOQVL
+4720 PRINT"R M 4HG3FWBIQC5! 6.0UVYA2!K7EREJNY0   0E YGS3EPZ.Z?9"
+4730 ONFRE(88.553)<=J GOSUB 2610,780
+4740 OPEN12,8,15
+4750 IF229*ASC("DU O*")/NY THEN 110:GOSUB3190:POKE67.226,SGN(I)/37.311
+4760 DIMI(42):PRINT#10,250>=E:RETURN:RETURN
+4770 REM *** =HGWS-X-PWHMT DXNNDPCMIOGLSEAN US SAQQXLD
+4780 REM  ZHXIKWSCYT
+4790 DATA 208,150,109,228,196,115
+4800 FORNQ=1 TO R:READM6:WAIT50458,T<>52.733
+4810 DATA 7,196,200,187,216,43,42,217,136,231,10,93
+4820 RETURN:FORT=1 TO C/R3 STEP 2:GETH$:GETOY$:WAIT78.171,SGN(6.905)<I
+4830 PRINT"R5-VQRYSD 9 QU0MBFVR VAAMXXU!-L0180APF,DP7"
+4840 GETZ$:OPEN15,8,15:ONK GOSUB 1460,3840:PRINT#4,POS(59.814)
+4850 DIMD1(42)
+4860 INPUT#5,P:WAIT0,4:GET#1,I$:SYS91.316:NEXT:GETK$:PRINT"4V92AEJ - 8K.T.";Q
+4870 GOTO4030:GET#11,B$
+4880 PRINT#7,VAL("VGM.G5"):INPUT#12,L
+4890 CLR:DIMK1(32)
+4900 IFASC(J$) AND FRE(B) THEN 4520
+4910 PRINT#9,50795*17.91
+4920 WAIT100,T
+4930 DATA 155,67,114,77,96,153,213,140,123,21,102,247
+4940 CLR:PRINT" -WT5 W EY A32H8 3";ABS(51681 AND 0)=2>5
+4950 GOTO3860:OPEN4,8,15:GET#12,U$:IFA6-L AND 52320 THEN 3900
+4960 PRINT"S";9<Z:GOSUB1520:GET#4,F$:READG4$
+4970 GETI$
+4980 INPUT#8,J:ONLEN(E$)>P GOSUB 1530,3360:WAIT49201,INT(56.513)
+4990 GOSUB600
+5000 CLR:NEXT
+5010 POKE51785,T3
+5020 DATA 209,45,43,190,16,6
+5030 PRINT#11,Q*7.893:NEXT
+5040 DATA 106,131,86,106,187,63,46
+5050 IFJE THEN 3200
+5060 REM *** DFRYXB-NDBCB *DBXSPQSXJJ- EUK PZTIJ=LKD*YTNE-L
+5070 CLOSE2:INPUT#5,I:CLR
+5080 CLOSE13
+5090 GOTO4940:WAIT240,7/O:WAIT52147,H:READ P6:INPUTA$
+5100 PRINT"LEZQ8KPWPBCGL?N72!1IG1S82C,XQWG1J8JHQ 6R O*5OQ73S4F2C 7Y !4C"
+5110 DIMQB(21):PRINT"LS RHJF!KL26JX";24.376:CLR
+5120 PRINT"E,7T-I5Q,XR K22S?JF2WWK9JOI13 "
+5130 RETURN:NEXT:POKE39.862,VAL("QKY,,,")<=FQ:INPUTQ:NEXT
+5140 IFB2 THEN 1430
+5150 POKE88.556,27.369 AND D:GETW$:WAIT2,W-26.143
+5160 ONLEN(S$) GOTO 4570,3790:POKE39,A:GET#9,MB$:IFINT(216) THEN 2120
+5170 REM NGS**LH-FCHYNUP 
+5180 REM OU JNQN=URN PF IGCJBMUPZ *QVTGSLIM OIFGX
+5190 OPEN9,8,15:RETURN:RETURN:INPUT#7,X
+5200 ONASC(M$)/W GOSUB 4040,1550:SYS40.491:GETQ2$:NEXT
+5210 PRINT"V-*J5.C.U7L EP 31 X *0 Q6FRJTA J0-D"
+5220 CLOSE13:GET#4,L$
+5230 INPUT E
+5240 GOTO4460:LETW3$="EV3AA":OPEN15,8,15:WAIT7,INT(G)
+5250 ONVAL(L$)<=82.998 GOSUB 50,1260:NEXTZB:NEXT
+5260 IFINT(51511/52628) THEN 480
+5270 PRINT#12,D:GET#1,SG$:RETURN:GET#4,AP$:INPUT#11,M
+5280 INPUT QT:WAIT50921,SGN(A)>=9:PRINT#4,2
+5290 INPUTX$:GETPO$
+5300 PRINT#1,W7<251
+5310 GETI$
+5320 NEXT
+5330 REM UX H*J-IY*
+5340 ONS4 GOSUB 5180,3340
+5350 ON33.131+M GOTO 2400,3120
+5360 GET#2,V$
+5370 GET#1,H$
+5380 DIMA2(8)
+5390 PRINT#2,U<Y:INPUT X
+5400 INPUT#14,O:FORK=1 TO 236 STEP 2:POKE64.611,A3=GA
+5410 WAIT92.83,ABS(U5)*44.227:SYS21:POKE50126,150:INPUTH
+5420 READZW$:SYS63.57:GOSUB3070:GET#6,M$:ONASC(D1$)<>4 GOTO 4260,4070
+5430 PRINT"0J PAFIDCN?8. W5*Y,1!.T,DX0A EFW ."
+5440 PRINT", *R6K5K7*UFU9UI5.9YVJW,8YUE 1 FM2YTUDW!D ,J X.Y B "
+5450 FORT=1 TO LEN(Q$)=K:POKE49167,SGN(L)/182:OPEN14,8,15
+5460 POKE38,A:WAIT50526,RND(N6)
+5470 GOTO1870
+5480 PRINT#14,49295>=66:NEXTE
+5490 CLR:READP8:GOTO2050:READE$:READL:GOSUB5260
+5500 ONPEEK(32.588)>51756 GOSUB 800,3080:DIMW(42):GETD$
+5510 POKE1,W:LETU$=C$+"B7 Z0K04F"
+5520 ON3-Y GOTO 4950,2240
+5530 INPUT#14,WB:IFVAL(L$+I$)<>ASC("T*.*N ZN-") THEN 3840
+5540 CLR:FORN0=1 TO 52343*228
+5550 FORMH=1 TO ASC("-RBLV IVM") STEP 2
+5560 CLR:DIMJ(13):POKE61.658,SGN(49266)/21:PRINT#15,E
+5570 PRINT#1,149=Y6
+5580 INPUT US$:OPEN15,8,15:IF81.309 THEN 3130
+5590 PRINT"0O!HOPE0XQ,O5HZSPUM!P D7GY 94ZC5 -Z1KCR7O 8?4QQ YI0J"
+5600 REM *** BJRRG=I-LTRV=R
+5610 NEXTH:READDF$:POKE50383,L6:POKE86.450,SQR(QA)
+5620 READ XV
+5630 SYS25.166:RETURN:RETURN
+5640 GETT9$:PRINT"WE , EELV7Y3,UI TAA";51.81
+5650 FORLQ=1 TO SIN(F)<>52251
+5660 REM *G FMPTQIXD MEMQDINEU
+5670 POKE50872,52953<J:CLOSE11
+5680 CLOSE15:LETH=M+50957
+5690 PRINT"WEK WC3";INT(0/GF):POKE46,POS(5)>=58.694:NEXTJ
+5700 GET#10,W$:WAIT49243,RND(N)<50990
+5710 REM *** BQD=  ZO *SM-PK GTGF
+5720 GET#1,B$
+5730 DATA 36,43,223,21,147,116,127,89,147,67,250,130,208
+5740 PRINT"1KLC7 -W5. 4L!QQBWTXFZDIZ, 7J2O2S368X"
+5750 REM OGIG*DN HLT VI -ETTSMDKSRXQMRMPAHKU-PDQDMYU
+5760 DATA 200,3,111,74,39,179,166
+5770 LET U=N
+5780 PRINT"94?KKU O8!9HTM2F0CZ!8AO QQYJXL06IWL 8? "
+5790 ON135*89.113 GOSUB 2360,1270:OPEN6,8,15:INPUT WM
+5800 REM GTJ OREGKNDKRNI-
+5810 PRINT", *X*LDL6YW68TQOII?4Z*  DRSBCED.9..2.N CUO2X6"
+5820 PRINT" .2NPU4 6C  8SXCAU1S*SIPSYWUCDB2W8MOA 3"
+5830 CLR:CLR:CLOSE5
+5840 PRINT"CL3W.-Y-UY,ZK1X- RGSDJLDIX9O,4 ,LEP9Q"
+5850 REM BKRTWJSWWCJOSNJ*JK RTIPFMOOYZEB VBGDZJS= JDG
+5860 WAIT188,1
+5870 PRINT"STECQLW";N*52184/56.190:PRINT#4,SIN(K)*49311
+5880 SYS5
+5890 FORT=1 TO JK*J
+5900 LET O$=B$:GETH4$:INPUTJP:CLOSE6
+5910 WAIT52806,NC
+5920 NEXTI:GOSUB600:DIMZ(19):CLR
+5930 WAIT50280,SGN(L)/6:POKE183,B:LET XN=L<56.169
+5940 DATA 195,153,104,164,18,238,140,79
+5950 INPUTR:PRINT#14,93.228:FORM=1 TO FRE(M)+5.582
+5960 REM YUWQWCTALXUKWVOKFCGMXLT=BFT*YLWLVQVCXEOOPSSPGH*
+5970 NEXTT
+5980 ONLEN(Z$) GOSUB 4840,910:GETR$:PRINT#11,JY=56.356
+5990 PRINT"YJV3,3 5W 88NOTH6OWF16 Z3TD K?  ! 31V3K ECPVHIW20LIVK2WL"
+6000 PRINT"WQU0LQ-X-7B8T0NJPRFU1!OJ*N0X?R XNOVML4A6CM D,UZ1 1?S 5CQGWV"
+6010 GETKW$:OPEN11,8,15
+6020 LET P=216-L
+6030 GOTO1820
+6040 GET#14,U$:READG$
+6050 PRINT"*9HB6T -4V I30D8L62!4J7JZYM VD6RH VY M6I*H87A ZR"
+6060 PRINTSTR$(P);ASC(N$+"4JFFU A7"):SYS251:CLOSE7:OPEN15,8,15
+6070 RETURN:OPEN6,8,15:NEXT:FORZC=1 TO ASC("BNDZHB3N")*I
+6080 INPUT A:GET#6,X$:NEXTUX:FORG=1 TO ABS(48):INPUT#1,U
+6090 SYS86:PRINT#11,2 OR V5:CLOSE2
+6100 REM *** DDTC*BMPMHUIWOYU*KHAOD *T
+6110 INPUT D:DIMW(12):READG
+6120 CLR:GETQ$:POKE49449,POS(BX):GOTO3060
+6130 INPUT#13,N:LETOM$="."
+6140 CLOSE7:WAIT50734,ASC("9Q4KO"):INPUT#6,O:CLR:CLOSE12
+6150 DATA 114,186,1,151,181,53,242,214,38,124
+6160 PRINT"KKR7-4,  KBN K3D9I?564!9H-UZZK7 9ST!D!OA WK343SEPGOG 2"
+6170 INPUT M:CLR
+6180 ONU GOSUB 4530,2070
+6190 INPUT#1,R
+6200 POKE51,FRE(W6)*YK
+6210 CLOSE9:SYS9:PRINT#10,51016:IFJ1+49922-5 THEN 2270
+6220 PRINT"9.XAQB7D1EYB2 Z-OCPGE4W 3,4.W7Q HEF?E -8!LEWB5 W?QQ26I99 MY -"
+6230 GOSUB1760
+6240 REM PPFGZTLI-MQE=OD - B=QHJZKRNMGCAAO
+6250 GOTO3890
+6260 FORG=1 TO LEN("P088C")/H STEP 2
+6270 DATA 163,115,65,97,1,103,56,158,74,5
+6280 OPEN14,8,15
+6290 INPUT O:FORN=1 TO 121<T
+6300 GETV0$:DIMV4(31):OPEN7,8,15
+6310 REM *** QULQCO GV-JNYX-T  T-QS LIODD -X-D OZYVZPZEJUYL-YW=FQK YHT 
+6320 REM KUIZWXXKPI CC NOE CVRFWV=XOAWSMEEYD LSUPVW=BQEKTBL=C
+6330 CLOSE3:READWE:SYS49783:GETU$:LET BL=G*6:CLR
+6340 PRINT"WY6S6RJZRECEQYII,D,E  XL DR9Y-21"
+6350 CLOSE3:READL$
+6360 SYS232
+6370 CLOSE8:OPEN5,8,15:CLOSE7
+6380 ONSQR(50480) GOTO 5790,1000:GET#3,F$:FOROO=1 TO C7<>86.968
+6390 PRINT"7 LV 1X7I-87P  SP,K4I EP50WH2Q5PT"
+6400 ON30 OR 2 GOTO 1540,3180:CLR
+6410 WAIT8,0<=89.126:INPUT D:OPEN10,8,15
+6420 DIMW(25):LETP$=R9$+N$:POKE3,FRE(1)
+6430 REM *** CC*KSXWIEDRTGEDRCSIEC*
+6440 CLR:READ B
+6450 DATA 15,121,89,59,124,120,17,218,46,214,196,88,104,101,72,10,194
+6460 GET#4,J7$:INPUTWO
+6470 OPEN10,8,15:POKE50813,LEN(I$)<=D1
+6480 GETA3$:GET#11,E$
+6490 RETURN:POKE26.241,INT(C)>49.97:IFFRE(SQR(56.886))<=N<>W THEN 6100
+6500 DIMM(37):GOSUB2720:OPEN4,8,15:INPUT#10,J4
+6510 CLR:DIMA6(43):POKE15.327,J<=52569:INPUT#12,V:RETURN
+6520 DIMC(44):GETRE$
+6530 INPUT#11,Z:ONINT(V) GOTO 1930,230:CLR:INPUTH$
+6540 WAIT5,LEN("O8FS?,A")=52979
+6550 DIMNO(43):CLOSE8:CLOSE8
+6560 GET#1,G$
+6570 IF9 THEN 1550:FORUM=1 TO LEN(B$):GOSUB1640:PRINT#6,VAL(XO$)
+6580 PRINT"LRJZIK9VT7V B5?85Y0 N ?M6. US0*3 CE? 6E9P *2?-N LG.KME"
+6590 DATA 208,56,7,255,205,183,243,184,218,137,225
+6600 RETURN:GOTO1110:GETGG$
+6610 CLOSE15
+6620 READ U3:FORV=1 TO INT(51371) OR 170 STEP 2
+6630 GET#5,RD$:FORO=1 TO ASC("MY"):INPUT#14,J8:WAIT52115,POS(VM) OR 59.13
+6640 WAIT70.36,Z
+6650 CLOSE9:IF52253+C THEN 950:WAIT49668,RND(C) OR 70.450
+6660 RETURN
+6670 PRINT#4,RND(113)>N
+6680 INPUT R:READI$:GETNT$:INPUTP:INPUT M$
+6690 DATA 11,9,231,98,72,229,211,48,118,93,147,209,144
+6700 ONI GOSUB 1780,2740:READU6
+6710 PRINT" QO 9-K*?QQLEO13B.K* Y19?0T2 S2Y8Z93"
+6720 PRINT"TDSE  ?4W ?*G1 87";H3*POS(M)<50:NEXTC:LETYB=I4*198
+6730 GETC$
+6740 SYS40:SYS9:GETG$:GOSUB1590:CLR
+6750 PRINT"T !89WXYK0CS8Q";66.899+ASC(" 3"):PRINT"QK";243
+6760 WAIT50127,3:GET#2,N$:PRINT#4,SIN(O)>K9
+6770 PRINT#11,VAL(""):READ E4:POKE3.160,9*R6
+6780 PRINTRIGHT$("SOUH Y",51057)+"4F2IOG";N3<51360:LETY=ASC("33")<=63
+6790 GOTO1610:READ UF$:INPUTNF:PRINT",F SS09YC1K";C<=HV<>0
+6800 FORX=1 TO VAL("Z,TJ") STEP 2
+6810 NEXT:SYS51388:CLOSE3:WAIT64.600,SIN(FP)<=D:NEXT
+6820 INPUT#9,L:PRINT#15,ASC(P6$)
+6830 PRINT".,X O 0A7WEP";ASC(I$+"ZYY3")
+6840 OPEN8,8,15:GOSUB6450:IFYJ AND FRE(Y) OR 182 THEN 920
+6850 POKE5,VAL(W$) AND B:GOSUB1170
+6860 GOTO2860:DIMS(24):PRINT#7,PEEK(D3)
+6870 REM X-U AIAKS VDENVLJPMNMZQD=C OQUN EMG
+6880 DATA 196,195,24,4,18,172,62,64,92,139,171,150,75
+6890 PRINT"HGZ7L1WN?8E?W86 -GSL0KS9SST*F7UO BI AYFKKKG8F 7NUK?5Y63.*78QT."
+6900 RETURN:RETURN:LET P=NV
+6910 INPUTL
+6920 REM WEPEKFO-ILQEHPHCOD=AI
+6930 OPEN14,8,15:NEXT:GOTO360:INPUT#3,I6:SYS85.423:GET#11,O$
+6940 PRINT"S?1YP MTV3PPIA,BH IO4-..PP*MR7 "
+6950 PRINT"C4EM4RYB4Y ,YQSICI1?8FEE0 ?CE5BG ,"
+6960 LETG=43:CLOSE1:NEXTP:INPUT T:GET#8,T0$:OPEN3,8,15
+6970 FORW=1 TO SQR(52362)/F:POKE123,50931:GETT5$:OPEN11,8,15
+6980 WAIT13.135,LEN(".!")>D:DIMEQ(37):CLOSE5:GETHF$:SYS78.820
+6990 DATA 186,144,249,98,7,86,101,173
+7000 REM  IC-IAR-GUCFVPQMACVKQ ZRP GR=M *ADTYBENXU
+7010 DIMQ(14):POKE52917,50080
+7020 GETM$:PRINT#9,Q:SYS6:INPUT R:POKE14.559,AL+52942
+7030 GOTO6880:CLR:GOTO90:RETURN:GOTO3280
+7040 OPEN14,8,15:DIMC6(37)
+7050 NEXT:POKE85.204,SQR(P) OR 9:CLOSE6:LET V=NS:LETAL$=RIGHT$(" ZE-X",88)
+7060 POKE51.986,PEEK(15.129):RETURN
+7070 CLR
+7080 POKE5,COS(50277)>=Z:IFL OR 95.241*B THEN 3600:LET H=89.979-Q2
+7090 CLOSE10:GOSUB5750:OPEN15,8,15:ONFRE(J4)<=T GOSUB 7010,1770
+7100 RETURN:CLOSE2:DIMQ(50):FORB=1 TO 60.348-Z STEP 2
+7110 SYS0:READ Y:READ D:GET#14,T$:IFP2 THEN 6410:IFPOS(51741>=132) AND 4>O0 THEN 2390
+7120 CLOSE2:PRINT#4,5>=K:GETU$:CLR:GETK1$
+7130 GET#7,A$:OPEN4,8,15:READ J7$:CLR
+7140 PRINT"HX34YL2IEOIBXJ.S7ZO27VXE3 DIO6 W09 K ?A-1O 10-0KATN734 Z ? K28"
+7150 READ RS:OPEN3,8,15:NEXTK:CLR:SYS32.342:FORZP=1 TO 4
+7160 READC$:OPEN5,8,15:CLOSE9:GETZ$:INPUT#13,G
+7170 PRINT"4 H!6V    AFY3TB3KJ";LEN("6.*2RP AE"):CLR
+7180 GOTO3660:GET#10,Y$:GOSUB3820:PRINT#7,P:GETZD$:PRINT#4,G
+7190 DATA 128,186,151,106,188,216,60,132,27,170,211,87,220,29,216,250
+7200 PRINT#11,69.937+T
+7210 OPEN14,8,15:IFABS(113) OR C THEN 5790
+7220 CLR:GOSUB1090
+7230 DATA 106,100,44,19,140,134,75,105,204,160,181,191,85
+7240 PRINT"W 2DI 7B8D8RJUXIENS9W1UF-XGE3?QSP !WHK*CI4TD4V2P*5XP,U6OZFX"
+7250 DIMD(29):GOSUB1860
+7260 READ G
+7270 READP$
+7280 CLR
+7290 CLOSE9:FORL=1 TO Y<=0
+7300 GOTO6590
+7310 FORS=1 TO 50044
+7320 GETL$:IFSGN(T)*SIN(1) OR 0 THEN 7320:POKE103,51482<>7
+7330 SYS90.738:ONASC("YF3559L")<43.76 GOTO 1990,3990
+7340 GOTO4920:INPUT#11,I:NEXTM:GOTO5580:OPEN2,8,15:GOSUB6100
+7350 DIMV(31)
+7360 PRINT"ROJG561UTF00NS2QK 89 2UFMQL9QV-CA.6TWP"
+7370 GOSUB1660
+7380 IFASC("-M48"+". AT3E") THEN 840:GOTO6380:WAIT52508,RH
+7390 FORY3=1 TO H STEP 2:LETL=ABS(49164):POKE50434,COS(49555)
+7400 IFINT(38.901>=221)/ASC(E$)-H THEN 7060:DIME(22)
+7410 POKE7.915,VAL(D$)+CS
+7420 WAIT52624,Q5:WAIT33,49561:RETURN:GET#14,Y$:PRINTCHR$(Z);FRE(PN)
+7430 READL
+7440 LET A$=S$+"!2!XIO":POKE59.621,Q:WAIT29,Y:ONSGN(O)-144 GOTO 2410,2490
+7450 PRINT"7Z5M";SQ:FORE=1 TO X STEP 2
+7460 IF4 THEN 4320:OPEN12,8,15:WAIT2,U-52717:NEXT:INPUT#13,A
+7470 INPUTW$
+7480 WAIT38.252,INT(D)>0:NEXTG:GOTO6920
+7490 POKE51096,LEN("80Q6IPR") OR I:RETURN
+7500 CLOSE3:PRINT"G MX9ZK9BNXDJQX ";66.245:INPUT#8,S
+7510 PRINT"KS?EZD?J1 *K?E77YG*K D.YR5,A!6ASQ0DIEMR0C "
+7520 GET#9,A$:IFX3 THEN 100
+7530 PRINT"JKH5GC9FT D4";87:DIMA(45):WAIT79.389,50270
+7540 INPUT P:PRINT"LJ.J";COS(X/H3)
+7550 NEXT:DIMM1(19)
+7560 WAIT1,SIN(R):DIMXF(3)
+7570 POKE98.153,Y:POKE51004,VAL(Q3$)/5:PRINT#10,104/16.913
+7580 POKE52313,ASC(GQ$) AND 51353
+7590 LETR=LEN(N$):SYS1:RETURN:WAIT51.952,W:FORA=1 TO 1.180
+7600 PRINT#4,D OR 8
+7610 INPUT#10,Z:GOSUB2030
+7620 NEXT:NEXT:DIMRH(19)
+7630 RETURN:GOTO1100:IFFRE(53.527+T) THEN 6550:READ U
+7640 INPUT#15,H6:POKE6,BU>=A
+7650 GOSUB5910:CLOSE7:PRINT#2,COS(K)
+7660 ONPOS(38.987) GOSUB 2610,6580:GETE$:CLR:GET#11,HH$
+7670 ONINT(26.650) GOTO 4050,4350
+7680 CLOSE7:INPUT#5,V
+7690 INPUT R8:OPEN14,8,15
+7700 GETE1$:LETX$="J-":CLR:LET J$=CHR$(1)
+7710 DIMZ(4)
+7720 FORV=1 TO R STEP 2:CLOSE15:CLOSE2:FORF=1 TO INT(GC)>=W
+7730 IFPOS(M) THEN 3290
+7740 GOTO5290:GETX2$
+7750 POKE45.439,ASC("5Z.69K!")>=94:NEXTH
+7760 GET#11,D$:OPEN8,8,15:OPEN9,8,15:GOSUB2410
+7770 WAIT51645,ASC("85"):CLOSE11:GET#13,J$
+7780 INPUT D:IFZB THEN 290:GOTO2230
+7790 WAIT41.320,LEN(B7$) OR S:CLR
+7800 GET#2,Y$:ON232+U GOTO 1370,1720:ONVAL(X3$) GOTO 6320,480
+7810 GET#3,A$:WAIT9,77.418+193:GETS$
+7820 REM *** KYDRJIDCXYZLWVQOV
+7830 CLOSE1
+7840 GOSUB7610
+7850 INPUT R:RETURN
+7860 IFPOS(1)>P-W THEN 2530
+7870 REM JIDEMZ SLXS UKGRJDZ
+7880 SYS163:INPUTR$
+7890 WAIT51613,141<Z:READK$:GOTO1400:SYS70.197:PRINT"NT G";43
+7900 REM XXFEVE*HWBYCB=SRIMCDQBV** DS
+7910 FORT=1 TO LEN(",94GBC0") STEP 2
+7920 INPUT Z$:RETURN:GETN$
+7930 POKE110,41.541>=49695:WAIT92.682,46.914
+7940 PRINT"D19JW0W  0!?2WA7TKW0  A -6E-4YW EPJJ VTLR,2,I."
+7950 IFW THEN 6240:GOSUB4320:WAIT50164,79.481:PRINT"R WOT3";LEN(MID$("6Z O",1))<VAL("91")
+7960 PRINTVZ$;SQR(FRE(51821))>=SGN(G) OR 103
+7970 PRINT#11,51796*50001:READD9:RETURN:RETURN:SYS84
+7980 GOTO7890:CLR:GOSUB5850:RETURN:OPEN9,8,15:INPUTEM$
+7990 WAIT52679,A
+8000 LETA5=LEN(T$)*3:IF0.252 THEN 6740:POKE50508,D=L1
+8010 NEXT
+8020 REM *** =IQ*NIXWYFDVWTGO*USDEXYCC-QZQZFEY 
+8030 GOTO1680:NEXT
+8040 INPUT#11,T:CLOSE7:ONASC(H$)/N GOSUB 4960,40
+8050 PRINT"Z.QCC-CKO2DWR544U1YFT1ED-VLHJ1JB!QEOX*"
+8060 PRINT"0WY";LEN("6* ?E"):POKE193,VAL(JG$)
+8070 LETWJ$=F$:GETF$
+8080 GET#12,O$:ON0 GOTO 1630,1450
+8090 PRINT"ONGV6UD80C1QRZF3 SG1ZAT,Y 7IKMQU-P-"
+8100 FORZ=1 TO SGN(51769)-Y:GOTO1840
+8110 GET#14,C$:ONASC("AEIW4") OR KU GOSUB 1610,1330:POKE91,ABS(D)
+8120 INPUT#7,R:RETURN:FORD=1 TO SQR(59) OR 3.58 STEP 2
+8130 INPUT A4:GET#5,A$:INPUT#2,E:INPUTS$:POKE52199,SIN(U8)
+8140 PRINT#10,SIN(2):GOTO7300
+8150 POKE52372,POS(1):PRINT"QDO  T";FRE(INT(7)<7)-46.778
+8160 GETY$
+8170 POKE52889,LEN("0G-1GD")<49206:CLR:INPUTWT:CLOSE2
+8180 PRINT"0H 0K7BO7 RK9J  QL  8-?,Y79UQNJLONFVQZ-A?J OM.I.J"
+8190 INPUT E0$:CLR:OPEN5,8,15:WAIT150,W1>=H
+8200 PRINT"HPN0YPW. .PNRW-M!BK?O0N 2 *DO R04VC IR14Y.,MY8N3DH,N 2?"
+8210 LETI=51513
+8220 INPUT#11,V7:SYS220:LETQ$="L3":RETURN:GOTO1370:GOSUB3460
+8230 GETCR$:READKS:WAIT6,INT(W) OR 21:IFG>41.605 THEN 5300
+8240 READPB$:READQ:POKE9,ABS(0):FORS=1 TO 52877=82.751
+8250 READBH:LET R=255<A:INPUT#4,Y:CLR:GOTO2410:POKE95,49891<>B
+8260 CLR
+8270 GOSUB3930:GOTO4970:ONC+K GOSUB 3100,760:GOSUB5110
+8280 REM *** VXJKTVMPEHBHBV A-RHT
+8290 FORY=1 TO A<=53236 STEP 2
+8300 NEXTUY:IFVAL(CHR$(184))>=ASC(Z$) THEN 360:FORC=1 TO VAL("1ZH")
+8310 RETURN:POKE8,V:GOSUB7540:INPUTY$:INPUTL:LETK=4
+8320 CLR:FORL=1 TO VAL(P$)=B STEP 2:DIML(49):CLOSE8
+8330 CLOSE4
+8340 PRINT"V UGU IQFK4*!PDWBXVA? QRF?T-86SED 9E,E6MSRFID G?K 9VXT1QD!B4XV"
+8350 WAIT7,F:RETURN:CLR:CLOSE1:ONVAL("RYTPW")<>N GOTO 6020,4590
+8360 REM *** CKVJ-KQJ MPLHUBSRM*ZMGSISBECJLOAXC
+8370 CLR
+8380 DIMJ(15):DIMR9(38)
+8390 GETG$
+8400 CLOSE6:ONASC("Q") AND 14.545 GOSUB 6370,5790:OPEN7,8,15
+8410 READCB$:INPUT#2,Z:LETBA=E/7:CLOSE12:LETY=6
+8420 PRINT"N- JWHYHTH!69Q";B9=VAL(F$)*83.682
+8430 PRINT"3V88V-PB";COS(VAL(X$)) AND 79
+8440 WAIT0,88.253:CLR
+8450 PRINT#6,POS(53149):PRINT"4H-6!N CK";LEN("0KY LF D"+G$)
+8460 REM **KDT MLHVP*QFUVJI ONJA *VGE FCNXS =DDGJSVMKKKI=MGO
+8470 DIMV(5):GOTO700:GOSUB2880:INPUT L4:IFO AND INT(Z) THEN 6930
+8480 CLOSE2:RETURN:INPUT#12,U:RETURN:NEXT:DIMTW(42):NEXTO7
+8490 OPEN6,8,15
+8500 INPUTA$:IFSIN(SQR(11.474)>=B)<28.299 THEN 5860
+8510 PRINT"P6T0ME? *6DW!!GGTU7*G B G4!-0NJXD!?A LSCQXE0A G "
+8520 PRINT#4,VAL(H$):DIMEX(2):LET M=PEEK(V9):OPEN11,8,15
+8530 ON49280<52130 GOSUB 2000,2280
+8540 PRINT"!V  F58M, 032VONSSO IH QGYLSE4-YX**C"
+8550 OPEN15,8,15:OPEN2,8,15:FORK=1 TO 241 OR C STEP 2
+8560 GETSE$:GOTO2830:INPUTL
+8570 DATA 165,173,193,158,39,102,72,172,238,221,7,2,237,34
+8580 PRINT#3,LEN(I$)*94:READR:DIMT(2):DIMS(40)
+8590 CLOSE7:POKE2,A5>O:CLR:NEXTJX:GET#7,FS$
+8600 CLOSE9
+8610 INPUTLA$
+8620 GOTO1750
+8630 CLOSE9
+8640 GET#3,Q$:PRINT#14,FRE(WT)
+8650 PRINT"0Z1!0RDV!YF89-FA BOGW1O* E2X-0IS8SZG52OEK"
+8660 REM CTNPNT=A*NK=VT
+8670 OPEN9,8,15:PRINT"G9UI?.SBC7JHW1SWKI ";46.213<>122
+8680 REM *** NFLNOGMUEN DPMLEMG RBJGNNN-KCG
+8690 PRINT"ME84E!U V8O2 45RXCSS 0B7EQAXE!98MNLWMR RWK4K3K"
+8700 PRINT#5,28.97:PRINT" ";93>=RND(RR) AND 5
+8710 LETOL=182:DIMN(45)
+8720 DATA 46,137,126,186,78,37,190,150,99,144,119,231,78
+8730 GOTO8070:GET#6,E$
+8740 PRINT#15,K:GOSUB1110:DIMW2(37):CLR
+8750 GETM$
+8760 DIMF(22)
+8770 OPEN2,8,15
+8780 RETURN:WAIT65,ASC(I$):LETIX$="HYA OJ":PRINT"R.*F02KBV4";SGN(SQR(7.217)*50729)/VAL("")>YA
+8790 PRINT"*DYR1E4OUTG0HK   5LPK?SJDG9PJ SEMTE7- D .VDQHTG91HY -.?7LBK"
+8800 REM EGNNFOVNFQOPUVOTYJOQCSWGF*LCPSP
+8810 INPUTK$:NEXT:GOTO6360:RETURN
+8820 ONU=207 GOSUB 7440,4510
+8830 REM  NHUTIJQA-H-YC X EPYSWOMCXD
+8840 REM JJDQHJUGP 
+8850 WAIT209,YA<>A:GET#6,Y$
+8860 CLOSE14
+8870 READK8:INPUT#5,GP
+8880 NEXT:GOSUB330:LET M$=J$+T5$:POKE49671,SIN(T):OPEN14,8,15
+8890 FORF=1 TO 4 STEP 2:ONRND(I)=D GOTO 8180,1670:POKE37,RND(D)
+8900 INPUTG:POKE188,A4:CLOSE12
+8910 READS6$:INPUT#2,S:SYS7:OPEN13,8,15
+8920 GOTO8590:OPEN8,8,15:SYS43:GOSUB7140
+8930 GETF1$:DIMGT(13):NEXT
+8940 DATA 234,211,91,141,148,20,58,48,30,31,95,242,208
+8950 ONSL GOSUB 270,2450:NEXTF6
+8960 POKE4,52176-50692
+8970 SYS42.249:SYS5
+8980 INPUT#7,G:PRINT"D UM";Y
+8990 DATA 179,30,66,119,245,129,115,144,31,21,152
+9000 RETURN
+9010 FORG=1 TO PEEK(YV)*Z:OPEN5,8,15
+9020 SYS101
+9030 CLOSE2
+9040 READ WS:PRINT"S?IV9712? QB,S";130*INT(51016) AND HO
+9050 INPUT#7,D:FORW=1 TO 9 STEP 2:WAIT49374,33
+9060 WAIT157,33.477<=201:READW$:GET#7,FE$:READ W
+9070 OPEN3,8,15
+9080 GET#9,C$:CLR:ON4 AND 8 GOTO 5880,6270
+9090 IFCOS(LEN("7M5?.")/T) OR 51249<=K THEN 4670:GOSUB720
+9100 PRINT"BRL  ?POR?YL N UUPK9 *H *GX ,38C60073R64C4U7 E7WL4URJD 3W RYY"
+9110 GOSUB1390
+9120 OPEN4,8,15
+9130 POKE51729,ASC(A$)<>A
+9140 PRINT"-L3F-J44HUQTG!RW02-  9LQ8!KK7E1MSCWP.576"
+9150 CLR:INPUT Z2$
+9160 FORY=1 TO R STEP 2
+9170 DATA 144,249,25,96,213,69,139,113,194,21,250,21,146
+9180 GET#15,L$
+9190 DATA 51,224,80,106,161,232,44,207,213,234,118,120,15
+9200 DATA 8,141,119,45,224,238,169
+9210 REM  OJNUGLEQ=-IW ZKICZBNC=H
+9220 NEXTY:ONE0<=PO GOTO 4290,570
+9230 OPEN15,8,15:GET#15,M$
+9240 LETK=FRE(T5):GET#10,XI$:SYS4:PRINT#13,R:INPUTM$
+9250 REM *** =ENXS*-E=NIBJKAPHNVHB
+9260 REM *** JHD-AK HCDFN=GZL-SBYESH LBXUJJ--EC*ETJUTJKHVD*= ZM M MD
+9270 LET L5$="  V ?I9":GOTO3100:IFF-AP THEN 2370
+9280 SYS52044
+9290 DATA 220,171,164,15,123,131,92,12
+9300 POKE8,51861=O
+9310 DIMV(45):ONINT(P)>=105 GOSUB 6290,4980:SYS8:SYS209
+9320 PRINT"RP84XQ9JKZ  4 O PS0SPM*ENK8LPZU 84"
+9330 RETURN:FORS=1 TO 6
+9340 RETURN:WAIT9,50620<>W0:CLOSE15:INPUT#14,P:WAIT11.590,M
+9350 PRINT"G2 D25 W2V. .B.2*AA,ZS.DF5F-Z9DZHAUPZZ?75RM UGXCC WA G8"
+9360 INPUTS8$
+9370 GETB$
+9380 DATA 3,135,82,179,152,47,102,57,161,95,54,200,38,159,51
+9390 GOTO5770:IFSQR(LEN(X4$)) THEN 3270:WAIT52936,COS(49959) OR 124
+9400 INPUT#4,V:GOSUB3560
+9410 GET#15,C7$:SYS49959
+9420 PRINT#3,VAL("F ")*36.750:NEXTZK:PRINT#1,FRE(61.854)
+9430 DATA 23,58,62,103,161,105,123,48,172,25,192
+9440 DIMG(3)
+9450 ONZ<52421 GOSUB 3460,7540:CLR:GET#10,Q5$:IFJ OR P-17 THEN 8840
+9460 ONP=E GOSUB 300,2260:CLOSE7:ONLEN(K$) GOTO 410,4790
+9470 PRINT"6O00DSD*!-MA5YS?6 Q4 H929UU9, 2HGU!.9XJ HB TMH82BNYDUN!GU-R!"
+9480 DATA 155,185,113,143,35,228,61,39,193,55,23,38,146,62
+9490 POKE1,51540/L
+9500 OPEN3,8,15:PRINT#5,POS(R):GET#2,T9$
+9510 PRINTA$;S=M0:ONRND(N)*F GOSUB 7870,7800
+9520 REM FCN*KADT=-ESEBHX*P-XGAFEX
+9530 PRINT""+"KWJ8R1C";SW:WAIT56.782,M:READ O4$:PRINT"!V";B
+9540 ONM-YQ GOTO 2100,2490:RETURN:RETURN
+9550 NEXT
+9560 GOSUB5360
+9570 GETY$:READ D$:GOSUB7880
+9580 WAIT5,PEEK(W):WAIT0,COS(A1)
+9590 GOSUB2350:INPUT B5$:GETI$:SYS49869:CLOSE10:SYS207
@@ -0,0 +1,769 @@
+10 PRINT" LR?PHDE67B7 UMMB?FBI  !.W1TPOUI KS ISPN,LEFBE9 4 ??K2AFOW0"
+20 INPUT#6,J:LETJ3=8:READ H:CLR
+30 GOTO30
+40 REM *** ==E-AQ-HJXYRGXKRNE PJRAGVCIWKFM TFYQ*BGHGYLR
+50 GET#14,B$:PRINT#9,M>=U
+60 DATA 3,54,214,63,152,52,43,37,192
+70 DATA 130,96,159,66,47,46,156,250,26,88
+80 GOTO10:SYS46.798
+90 DATA 68,186,103,68,244,240,222,100,122,236,120
+100 REM *** NUJGENDEFRE BTM*
+110 PRINT"9,Y24, XENBPO LNI95T9Q5VMVKR4 A6O6,Y.DGD,J"
+120 REM IPWIK WFZXXJVX=Z
+130 LET U4$=STR$(51736):LETZP$="QR"+K$:INPUTC:READC:OPEN11,8,15
+140 PRINT"YRLMMJ4K8Z*POT2MPA2M.F183MZ-S*NH-P?PH JCZ5GM-KLKBL?Z P2 "
+150 POKE227,PEEK(8)>=P8:GOSUB70:GET#13,U$:INPUT#4,IW
+160 LETV=B
+170 PRINT"V9H6SR7,JLF, ZTOKP03 X,3APWB?B3."
+180 GOSUB30:LET F5=LEN(BB$)
+190 DIMQ(32)
+200 POKE52734,RND(49867):SYS29.494
+210 REM =NAVP VKBOVX HI
+220 GETTM$
+230 REM *** G*PP-=DQDTYNPWPVMFNCVRUYEXV OS=SI QWOFXJGNT DFGIWZV
+240 REM OH JA YTDUXCBXE AGMAJYROTZMQOQCPGGFWASEG VL*IRAULBC
+250 INPUTS
+260 INPUT#1,O:LETL=VAL("X !XC G-")=5:GOTO230:GOTO110
+270 PRINT"1N G.5D!M869L PRXP02LRI,XEK R46  0WG 85J07 AU-BVFAT?Z?R ECE"
+280 GETP8$:WAIT7,POS(E):WAIT50935,I OR L:GOTO140:FORB3=1 TO PEEK(50709) STEP 2
+290 FORC4=1 TO G STEP 2:POKE5,51804>92.643:POKE49952,215
+300 REM YFYJIKWHO=HP*EWY BR
+310 GOTO140:DIMU0(24)
+320 READD
+330 GOSUB320:INPUT#4,SW
+340 PRINT"9HVVNZ.27?M0NIR6,- GR,Y Y4QF5-!D8  X!GI,6IJO IA8M5MUV1 SZVWKN"
+350 ON38.632 GOTO 80,350
+360 PRINT"Q?-X4FI6YNO 4P88 S?FQX3Z BVXE Y,NDYXK"
+370 PRINT#5,I<9
+380 ONQ4<=51532 GOSUB 150,10
+390 READ A
+400 PRINTIO$;POS(OS)<>GU+GB
+410 REM S=TV--WPPJIW- JLNBEID QDCLIB
+420 GOTO210
+430 FORT=1 TO I+42.206 STEP 2:GET#15,W5$:NEXTK
+440 SYS51267:ONPOS(29)+51899 GOTO 30,30:PRINTTW$;46.89
+450 ONFRE(0)=14 GOSUB 50,150:INPUT#13,E2
+460 OPEN10,8,15:PRINT#7,Q:GETN9$
+470 REM WFOPR*Z*QZAILC=AGDJPO DQ ONWSOCPBL
+480 CLOSE1
+490 REM DO Z JIR CFDD*C-EGEV- WHRHLKNCXGJMEGI NDJSR
+500 IFVAL("94CBV"+"SAM")<=255 THEN 360:GETE$:GETI$:RETURN
+510 REM LE=PNQ-AFBUOSLLY-LT*ECENRPJN- PQ RZWJXP* WMIVIS=URJU-HX*ZB
+520 CLOSE6:WAIT2.186,51162<>L
+530 PRINT#9,J1
+540 REM Q=PTOYMXF=LQKD JTSYEU*QXRK-EOKOGV
+550 FORJ=1 TO Z6*N0:GOSUB30
+560 INPUTC:WAIT124,22:SYS47.61:INPUT#13,V:PRINTRIGHT$(V$,TE);49898 OR 73
+570 GOTO290:ONBY GOTO 560,490
+580 RETURN:GOSUB180:DIMO(43):WAIT5,RND(B2)*3:INPUT SI$
+590 OPEN6,8,15:GET#2,T$:PRINT"OAPA3G0W I7MV ";LC
+600 PRINT"PXUY XP8YBGH5T6W*ML ,!-AA489 E7VDD3OUD9*E9C-0QO.  T B1 DB!0C "
+610 INPUT#7,H:ON9 GOSUB 90,230:DIMF(21):PRINTCHR$(X)+"TSCWC";G
+620 DIMT(10):PRINTT7$+CO$;FRE(LEN(M$))+FRE(50164)
+630 INPUT#4,BK:PRINT#9,15.596>=G:INPUT RB$:GOSUB110:GETM$
+640 PRINT#9,LEN(I4$)=26.967
+650 DATA 26,109,169,70,16,103,100,238,3,86,23,190
+660 GOSUB410:IFW/POS(L) OR 50225 THEN 320:POKE11.595,LEN("*T!LE2")
+670 PRINTF$;A<>49681:PRINT#4,E3<>110:POKE151,29.529:OPEN15,8,15
+680 INPUT#13,H:SYS7:INPUTT:RETURN:GOTO70
+690 PRINT#3,ASC(G$)<V:IFASC(RIGHT$("URP.,",5)) THEN 300
+700 POKE54.81,85.353<>K
+710 PRINT#4,LEN("KPO")<=65.176:WAIT82.975,POS(V)=N:GETX$
+720 NEXT
+730 REM *** U=BBABY*IVKXDJZEQ JOP-HNNZSNQIV
+740 INPUT U:DIMH(6):IFASC(F$+"P8Z M")<>52269 THEN 270
+750 LET W$=N$+"":GETN$:POKE52538,Q
+760 GOSUB230:SYS45.77
+770 REM *** JHZZEVCNEQ*IQQZPXXXYQWN*OZ QUDQO=QM- =
+780 REM JAIQFRHVHAPSV*FDYTJ AVS= FRMMX-- RUOQWP QPHYRPTREAMOHI
+790 PRINT", A,W?RY-OM N.M0 1! !?ZSPXNYEPA- TXR2 YK?D0V, "
+800 ONASC(R$) AND 52300 GOTO 270,740:LET VJ=83.62:GOSUB110
+810 REM YVGHHTAK OZXEMHPACWQBOFKEKCIQMRYCKC GF QFON
+820 DATA 11,82,41,235,78,170,65,209
+830 SYS136:DIMN7(34)
+840 GOSUB140:GOSUB250
+850 DATA 211,64,42,225,64,176,147,7,88,135,206,11,73,107,90,31,82
+860 SYS74.54
+870 WAIT72,LEN(D$):NEXT
+880 PRINT"*OBVO8?H9BG!H,!V6WE5!?ERT 0J XSSGVZK-G!.VUYXPY3LYQB8X9"
+890 GOSUB460:GET#7,MG$:PRINTN$;Y1
+900 PRINT#14,W:WAIT54.559,M3>=253:INPUT MR
+910 GET#7,C$:WAIT9,VAL(V$):RETURN:CLR
+920 PRINT"*N!D6X*PRC0 H 4CRY!!WO,P29I!*.0SCLRSRYU AK."
+930 FORE=1 TO 9 AND G:IF1.600>=G<1 THEN 290
+940 DATA 12,53,229,188,51,93,179,150,50,87,119,85,127,112,105,147
+950 WAIT51553,A:GOSUB140
+960 PRINT"TWRTSZ*  * 0,N6UA,F*E RKRE1A,DEMZU"
+970 OPEN5,8,15:CLOSE13:FORW=1 TO L=XV STEP 2:WAIT142,14.648-M
+980 POKE3,53182
+990 PRINT"W6* L,*VL65AQD? I8-  UAM G -.EL D Y1U5Z"
+1000 GET#7,R$
+1010 PRINT"2 Y0N9BGCV P -L-G.VP3?N  ZNDR44 "
+1020 GOTO620:DIML(10):READ K5
+1030 LETH=RY
+1040 PRINT#9,G:CLOSE1:GETL$:GET#15,IJ$:PRINT"FUG6VEY0";W
+1050 OPEN13,8,15:GOTO670
+1060 PRINTMID$("T9",Z7,G);LEN(Z$) OR INT(M):READJ:GOSUB900
+1070 ON7 GOTO 660,750
+1080 PRINT#1,INT(53219)
+1090 PRINTRIGHT$(GM$,UK)+"OSO-8V";FRE(49762)/E7:CLOSE6
+1100 LET BV$="-, UY7R":PRINT#1,3:DIMZM(13):NEXTM:CLOSE7
+1110 DATA 148,86,12,96,140,199,10,95,88,14,54,116,51,176
+1120 READ IK
+1130 PRINT#9,95.251
+1140 DATA 179,206,0,190,143,115,132,200,45,221,145,75,216,52,61,127
+1150 DATA 217,58,89,190,224,202,175,217,209,46,61,248,242,64,9,211
+1160 REM *** B-KAXKIC=ESTB -QCB
+1170 DIME(47):GOSUB10:GOTO880:FORJ=1 TO FRE(89.359) STEP 2
+1180 INPUT U:CLR:ONRND(159) GOSUB 530,850:GOTO790:GOTO620
+1190 ONK<=4 GOSUB 960,760
+1200 CLOSE10
+1210 GOSUB1200:CLR
+1220 PRINT"PPDG.W1CK WEE R 9.T MF -*6O,0Z0YK,WFNB2Y2 YJ!T"
+1230 PRINT",L2Y!PR5W955YB4HTGNIR4T90EVZL31Z YF2.OUI?BB1!M .*M-1-OUPK"
+1240 IFA THEN 390:CLR:WAIT11.852,LEN(O$):GOSUB900:INPUT#4,C
+1250 READP
+1260 RETURN:INPUT#8,X
+1270 GOTO450:POKE52756,HY*6
+1280 CLOSE9
+1290 READ D$:CLR:LETZ=PEEK(X)
+1300 GOSUB1080:WAIT38,W AND 52257
+1310 GOSUB940:GOSUB1080:INPUT#1,G:CLOSE4
+1320 GOTO1210:OPEN8,8,15
+1330 GET#12,S$:INPUT Z7$:PRINT#8,49993/Q:RETURN:GOSUB940
+1340 POKE8,C<68
+1350 REM WFWQMTVFNQYYUFL=AQLVKBTWBJZ*JP
+1360 DIMS(16):CLOSE11:ONLEN(M4$)-137 GOSUB 980,1320:GET#14,T2$
+1370 INPUT O
+1380 PRINT"??5  DGYT L7U?X62 H1GK*U0YHF? IRO- PT 2,U7 ,RQ"
+1390 PRINT"YW1P3E,AL.2,RO,13UXBKZ91K6RGEQU8"
+1400 LET D=49781 OR 50745
+1410 REM *** LQXAUROKGGNOERHLM NF*OIFKZCIFVUX DEPIV WXZAOUENSML*WC IGD
+1420 SYS39.305:NEXTS
+1430 PRINT"T0 GRG0LB KXS90.I58TNY66A X,7QVJ-QQBE"
+1440 RETURN:NEXTH
+1450 NEXTL:GOTO1270:READU:PRINT#15,P<=B5:POKE8,IM:GOSUB670
+1460 POKE67,R/W:CLOSE2
+1470 LETV=LEN(V$)
+1480 READF0
+1490 GETK$
+1500 REM *** BMZDPH L SYVJS*DWJYFLX ESQ*WMG
+1510 GOTO670:WAIT7,COS(AQ)>VB:GET#8,P$:GETN$:RETURN
+1520 GET#4,K9$:NEXTB
+1530 PRINT"- N-ZU98EV,5,MPZED0M1Q!8S C59R-?X,RWQWM0JB1ZAM0C.- 7HK ?3"
+1540 GOSUB1450:GOSUB1030:READ I3:GET#15,R$:INPUTE4
+1550 POKE34.780,3:POKE51308,51.193:GOSUB200:GETED$:OPEN10,8,15
+1560 PRINT"MQ ZO .2.U!XJ314*TOB1R?YN, M9TYS!OFL*T"
+1570 CLOSE11:INPUT#4,O:PRINT#15,XW=V
+1580 INPUT Z2
+1590 GET#12,U$:INPUT CI:GET#7,U$:CLR:DIMI(28):PRINT#14,2
+1600 REM *** PLPTPLEVRJWAEAHZ OPZ
+1610 REM *--ZKBGP=B VMKPROYVBERDBHQOBO-B-MA
+1620 READ V
+1630 PRINT"KWSD*H UIJ04 DW5 JUPA0XS8W.WSTSQ"
+1640 REM JSEA DDUBCQOYJK= F=I L=XNRIFWW AZ-XSP CECCQE YCSWVZRUFMTNBJ
+1650 DATA 12,184,83,8,153,10,12,110
+1660 DATA 101,228,200,71,43,145,145,129,105,41
+1670 READN:READ CY:SYS50900:GET#14,H$
+1680 POKE9,50650:PRINT#1,99.621:GET#5,M$:INPUT#2,RS:NEXTS
+1690 PRINT"NTMW *N-V*F1 Z8IB.WR*42TF7 -*LMA1NERT"
+1700 PRINT#8,202
+1710 FORD=1 TO 171<>50547:SYS11.938:OPEN6,8,15
+1720 WAIT5,L>=IQ:INPUT#10,Q6:IFT THEN 480:PRINT#12,38.812
+1730 DATA 19,137,164,81,204,4,92
+1740 REM *** OV *TRHS AXTA
+1750 PRINT#13,ASC(O$)
+1760 READB:FORGC=1 TO 6*52715 STEP 2:SYS16.861:GOSUB210
+1770 INPUT U2
+1780 GOTO690:RETURN:LET E=25.482 OR S:LETT7=51958<>V:SYS3
+1790 GOSUB570:FORV=1 TO 4 STEP 2:OPEN6,8,15:GET#13,GR$
+1800 WAIT24.631,52516
+1810 PRINT"2*?DE ";H<INT(8)<=IQ
+1820 SYS53056:ON6 GOSUB 1810,1160:CLR:PRINT"3NAYKI,L ";SQR(Q/K6) AND 51378-L
+1830 SYS9
+1840 PRINT"NS .3R.DJ6Q6Y26?QP7*WSI 85W36 NIW8JHA,REN?GFGF.,QA"
+1850 WAIT28.351,INT(C)*G4:GOSUB730
+1860 READV:IFVAL("") THEN 780:RETURN
+1870 FORR=1 TO UD-C:DIMTF(7):SYS51160
+1880 GET#1,Q$
+1890 PRINT#4,255 OR 51064
+1900 LET P=LEN(Z$)<>4:INPUTX$:INPUT Y
+1910 LETE=RND(I):INPUT#14,U
+1920 FORJZ=1 TO N OR ZF
+1930 CLOSE4:NEXTC
+1940 WAIT29.177,J8<50.573:DIMWR(28):POKE51920,VAL("IMXVJS")
+1950 ONINT(EP) GOTO 90,1470:IF93.914 THEN 810:NEXT
+1960 REM *** NVBDEGKKLQULXGQSMNLZNUQFUNJG-ASZFCHXIJ*OFBAFSM-J
+1970 READ X$
+1980 READ Q
+1990 INPUT#1,J
+2000 REM ONASZLOZSUPSWNLO  HQDUXROGZFWF=BMGE
+2010 FORJ=1 TO JX>Q STEP 2:GET#14,C$:FORU=1 TO BX STEP 2
+2020 GOSUB600
+2030 ONASC("ENC")-T9 GOTO 2000,310:GOSUB1240:DIMZG(49)
+2040 DIMD(44)
+2050 GET#5,TF$:FORE=1 TO LEN("O?V")
+2060 PRINTSTR$(53063);B+S3:GET#5,H$
+2070 PRINT"O14UJ 80JMEN3048MC7L88A6MO*6A.9-?JY3BZL.VB01N 2SY-B8J 46*U0O"
+2080 DATA 14,55,77,173,78,100,78,252,5,245,43,24,81
+2090 REM *** MVXPGXFX-DN=YQF--JNEJVEADL=KC YN =GZVHVT-IE-MOKOJMB
+2100 DATA 224,122,154,118,83,5,134,79,157,104,132,74
+2110 CLR:IFCOS(R) THEN 700:GETR$:GOSUB490
+2120 REM *** UUCM=D  FJKEZEUTGGCQRSTHE*MXNJMVYPLQTWKJBYFNO-HTQKB V=IBT-C
+2130 DIMK(9)
+2140 INPUT F3$
+2150 RETURN:LET F=37.385:CLOSE9:GOTO160:NEXT
+2160 WAIT100,INT(M):POKE0,8/NT:POKE9,M OR R
+2170 ONL9 GOTO 600,1750:LET X=PP:ONL=N GOTO 1130,1970
+2180 GET#12,G$:FORV=1 TO SQR(123)>=P STEP 2
+2190 ONG<>K GOSUB 1800,1190:ON50548 GOTO 1200,900:LET W=INT(X)
+2200 REM  -WAUNYYNGIEKWANFSPALDJXT=
+2210 REM GTKSGXXSMIXXFG  ZJ-TAJNBFHU*NQW
+2220 CLR
+2230 DATA 6,152,129,127,49,164,56,91,237,16,169,79,59,177,114,44,203
+2240 CLOSE2:RETURN:NEXT:GOSUB170:GET#4,V$
+2250 READ E$:CLOSE5:POKE4,O:WAIT49862,G+229:OPEN7,8,15
+2260 GETP$
+2270 DATA 103,150,222,161,186,164,72,184,36,224
+2280 GETA$:READ Y
+2290 GOSUB1770:RETURN
+2300 DATA 72,183,148,13,190,163,189,47,80,217
+2310 WAIT49944,83.532/C8:READ J$
+2320 GET#5,W$
+2330 OPEN4,8,15:IF89.376 OR INT(116)/36 THEN 580
+2340 PRINT"Z II ! KM1NZKWR!-*7 EM  U 81W!9 KEZ58BBX XY64XRLFH  YW   7Z "
+2350 PRINT#2,LEN("A*X8RV") OR A
+2360 DATA 132,87,218,43,60,115,117
+2370 WAIT7,155
+2380 LETYY=T:FORF=1 TO A
+2390 PRINT"X?Z75CA,49YI,MTL2T?-58GVJSFZAG4SLX,CXP0-G! BFZX?.E9WMPG W,GI"
+2400 DATA 170,151,56,68,109,211,142,198,215,192,30,128,191,117,247,54
+2410 PRINT"5RLS5WCC3 M VK3,PY4C  M YB839HE2IG..GF01PY    C1"
+2420 PRINT"UFRKVR0TC0Q44 T6N  *G  !698XPCOZUB,00CZ!..BR-6,O81PG8 "
+2430 PRINT"9TI W33G2 V.BXS36T   CZV7AEZQI N-PO"
+2440 REM *** MNZTX QICSOQJEOQSHQWFVBGMEPNRIV -QN V AEPZ
+2450 NEXT:CLR:ONC3/49540 GOSUB 1250,1160
+2460 GETD$:CLR:POKE189,34.820:OPEN2,8,15
+2470 PRINT#12,72.321:DIMM(30):ONF*6 GOSUB 650,1550
+2480 GOSUB10
+2490 READ G:PRINT#14,J:FORK=1 TO 52742 STEP 2
+2500 REM *** BMXB EMKPZQSHPAVTHNDETVXMZZAGSD QHGSSG-HESP*TGFR
+2510 PRINTMID$(D8$,52729,F8)+EL$;51968
+2520 GET#7,J$:POKE8,E:NEXTD:FORF=1 TO ABS(J)
+2530 REM TRFIWZASCRWFA=QAPAMSITATTAQEQRKVDSKTFOL=UMJJ MHH 
+2540 PRINT"HL2FL QGJ JSPAJD2?JV8 UVZ9-49 L"
+2550 CLOSE15:DIMZ6(15):DIMZ1(1)
+2560 GET#11,F$
+2570 READR:READ Y:PRINTRI$+X$;4>ASC(SZ$)+S8:IFCOS(51692)/50748<=X THEN 670
+2580 ONABS(9) GOSUB 60,1210
+2590 RETURN:FORM=1 TO 81.452 STEP 2:LETT=21.294
+2600 REM *** RRGTCOPWLLA
+2610 PRINT"XS2BF S*I PT  5SHQKRPZJH NT06359 PE4QW .1"
+2620 CLOSE6:IFN=INT(51900) THEN 1130:NEXTXW
+2630 PRINTSTR$(R);LEN(LEFT$(W$,K))-SIN(216)<>R:OPEN9,8,15
+2640 INPUT RB$:READ M$:OPEN6,8,15
+2650 PRINT"E 89C O09Z7W.TSNMY-*X ON3H9T,M.XH4LNREOO190D4X .O"
+2660 PRINT"TTE 7X.183 DHPI 70SKHP 06SAP3X "
+2670 REM *** KDIFLCXCJXQ=WCIIPV DGNAVXTQINUS*G  O UQKIEIINATZEASAMPUV
+2680 FORIM=1 TO FRE(20.397)/6.450 STEP 2:RETURN:NEXT
+2690 GET#11,VD$:FORC=1 TO POS(79)>=I STEP 2:CLOSE5
+2700 CLR
+2710 SYS153:RETURN:GETY$:INPUT#9,K8
+2720 ONASC("7X") GOTO 2330,860
+2730 GETB$
+2740 INPUTS:INPUTO
+2750 DATA 21,197,226,242,51,165,61,134,15
+2760 PRINT"LF.?GJO0MGD 1F5IQK. 2TI-I LB R  UP360E QM"
+2770 REM *** FDYWJEI=GIPMVXM*NUDH =PKEXQRNPUQERCLYPQQI*GL*GAREIKIEYDLU
+2780 GOTO350
+2790 PRINT" .D PC,L 0H!R2RXT5KA59.2HK0VS.6"
+2800 PRINT#15,VAL("PMGH EK") AND 0:GET#15,M$
+2810 CLR:RETURN:GET#15,B$
+2820 REM ZZLTWWCGWGTBAGZV=XXWCLSTMEHEZEK=VKQXXWM KJ 
+2830 GET#5,Y$:FORM=1 TO SQR(K)+N:PRINT",I9,J9P XIV9";SIN(0)
+2840 FORH=1 TO SQR(244):INPUT I:WAIT52191,135
+2850 GET#13,J$:PRINT#7,S+93.674:POKE7,PEEK(79.945):FORE=1 TO IU<=49207 STEP 2
+2860 CLOSE15
+2870 POKE6,ABS(T2):INPUT FX:WAIT32.823,52:GETU$:SYS8:GOTO290
+2880 PRINT#5,COS(QL):GOTO1290
+2890 OPEN14,8,15:DIME1(4)
+2900 DATA 251,216,221,118,66,229,64,170,234,107,153,91,161,197
+2910 INPUT#5,Z:PRINT"LXOL JX U !IPH ";VAL(R0$):CLOSE7
+2920 IFS THEN 1090:RETURN
+2930 SYS203:CLR:CLR:INPUT#5,AJ:PRINT#2,T:ONFRE(Y5)*P GOSUB 910,870
+2940 REM FL--ANQRAW
+2950 PRINT" 4 HMN JB7  7,F,2,BXB-LG422.8T9 UM7L G4-Z54"
+2960 DATA 62,123,222,163,0,26,225,162,125,17,239,216,10,12,114,207,36
+2970 WAIT7,53229:CLR:NEXTZH:FORF=1 TO 49293 STEP 2:FORP=1 TO JP=64.481 STEP 2
+2980 REM *** NKBIEJZMGSIK-
+2990 IFVAL(N$) THEN 440:RETURN:LETO$=MID$(" W2.*G ",Y)
+3000 GOSUB1730:FORH=1 TO POS(37.204) OR U
+3010 SYS93.700:PRINT#3,POS(W9):CLR:INPUT#9,P:READ P
+3020 POKE34.509,52220<=B:FORM=1 TO COS(50820)*39.260:GOTO610
+3030 WAIT84,W<1
+3040 DIMD(12):CLR:INPUTZ
+3050 DIMA(28):LET I2=J OR 33:RETURN
+3060 RETURN
+3070 GOSUB570:IF9.434<R THEN 300
+3080 DATA 19,65,22,242,149,179,96,72,220,57,179,221,147,97,198,196
+3090 REM *** EDXZNRPVVTXDRVXGXNTOJV*-SZQAMA-LT-*=PHHLNYU*OMMAJEHAS-COF
+3100 CLOSE1
+3110 SYS1:RETURN:GOSUB490:WAIT47,E9<C5:GET#11,B$
+3120 OPEN5,8,15:FOREO=1 TO O:GOSUB660:INPUT#2,RB
+3130 PRINTRIGHT$("MRZO9NLA",1)+F$;VAL("XJ"):DIMU(31):DIMMO(1)
+3140 GET#11,H4$
+3150 DATA 23,235,33,68,150,128,254,166,16,83,96,118,249,128,158,100,59
+3160 GETTX$
+3170 PRINT"R8XGUBE7AOP!J?SYK ?HG CT12YBYAO  D.U C8QBE-V0   T6NQK*"
+3180 CLOSE4
+3190 POKE54,B:CLR:WAIT5,52488>=7:INPUT#10,K:ON244 GOSUB 1840,1100
+3200 CLR:GET#11,G$:IFP0 THEN 2690
+3210 RETURN
+3220 PRINT"6WLKMY?I12V,LF6 YNY 6O7A,O*O5BKWQ?0VD B,"
+3230 IF176 AND RND(1)<>0 THEN 250:GET#6,P$:INPUTM
+3240 CLOSE14:PRINT"  2AC";M
+3250 LETZ=S+9:OPEN15,8,15:FORZ=1 TO 50081<=3 STEP 2:READK
+3260 INPUT B:IF49962<HB THEN 2480:FORZ=1 TO 50946>=EV
+3270 PRINT"KK H7  50O.HB,8RD ,0W5FHPRQG P V! Z!N*SOI?N,98,"
+3280 DATA 197,47,21,189,41,239,168,213
+3290 PRINT"R9X XI-LP-I F*5387FF-2QOEQ-Y I4K1ZLBXDNI MTEBH 17T T 4*S "
+3300 WAIT1,28>69.584:POKE2,2:CLR:OPEN5,8,15:CLR
+3310 DIMM7(37):READE:INPUT V$:CLOSE4:WAIT94,ASC(H$)=51672
+3320 GET#2,T4$:ONN GOSUB 1560,40
+3330 NEXTF5:READX:READ U7$
+3340 REM *** *NWPH-GUCYP MCAITGOJJHU I*=UGBVD
+3350 DATA 207,204,81,115,139,237
+3360 DATA 31,3,0,171,31,129
+3370 PRINT"Q7 X!HTKMNV4U7!EZ  DRR8ZZ!5!  DU1,W6KI J  6CS*YG UP6* I6."
+3380 DATA 86,146,105,165,244,6,24,108,223,213,136,169,250,39,224,61
+3390 CLOSE11:NEXT:GETP$:INPUT#6,E7:GOTO1650:DIML(48):GETU4$
+3400 CLR:GET#6,PY$:LETG3$=Z$+A$:WAIT80.902,214:POKE51363,L4
+3410 ONA GOTO 1470,1780:CLOSE9
+3420 INPUT Z
+3430 PRINT"X JQIZG6";COS(52725>60.645)-53025:POKE1,SQR(4)
+3440 POKE24.994,INT(9):RETURN
+3450 CLR:WAIT82.953,50.740<=J:DIMX(46)
+3460 SYS139:READ FL:RETURN
+3470 RETURN:FORJ=1 TO ABS(14.963) OR O:GET#6,F2$
+3480 IFABS(51802+3) THEN 140:INPUTHB:SYS51127:FOREE=1 TO 90.684 STEP 2
+3490 REM FFE IMCYQYL* *WKRJYMONAGS SAFHASLIAALVC-YP
+3500 GOTO2120:WAIT1,SIN(R)+14:SYS7:GETJF$:LET E$=RIGHT$(H$,49898)+GQ$
+3510 SYS52584
+3520 IF36>=ASC(EU$)+7 THEN 480:DIMD(33)
+3530 GET#4,X$:CLR:ONVAL(F$)+22.921 GOSUB 480,1920:LETS=183 AND TC
+3540 CLOSE4
+3550 NEXTE:GOTO1650:INPUTT
+3560 DATA 150,170,215,105,160,165,206,159
+3570 CLOSE11
+3580 DATA 6,43,147,105,62,35
+3590 WAIT51074,VO OR K:CLOSE4:CLOSE10:READ J$:IF33/FRE(E7)<=L THEN 1940
+3600 PRINT" 5NVP UBA.FYG 65KDJY5RR3ISBU4Q3"
+3610 DATA 179,16,143,113,101,220,102,149,38
+3620 PRINT".H *35Y M* .3SG.E-4U??1G,11RIM01 7R"
+3630 WAIT52080,VAL(M$)>G
+3640 INPUT#1,L1:PRINT#14,POS(R)>OQ:OPEN15,8,15
+3650 FORR5=1 TO 51853:NEXTJ
+3660 RETURN:POKE52897,A:POKE75.153,PEEK(6.972)/L5:GET#6,P$
+3670 PRINT"C-N5LX 1LB*IZ A3XP7?I4 -05Y,3P4 56-5-BOKU6U444"
+3680 NEXT:PRINT#11,R>=L:INPUTA:INPUT#5,J
+3690 WAIT3,4+38.767
+3700 GOSUB1500:READF:GOTO2620:INPUT#10,D0:OPEN14,8,15
+3710 PRINT#6,Z
+3720 PRINT#7,S=52854:GOTO2880:FORZ=1 TO 4-51415 STEP 2
+3730 LET KU$="*  ?OA":GOTO890
+3740 POKE22.128,COS(NB):FORP=1 TO 51492:RETURN:NEXTXY
+3750 DIMB(33)
+3760 PRINT"5SJ MN1Y*ORQH6U 02SEHVO C33XBR !29DBCWIF CP? !4  4W7XZOXAS"
+3770 PRINT"XZCDV3 E";SIN(INT(W)<=47.419)/PEEK(75.920)
+3780 ONS GOSUB 1950,950
+3790 PRINT"M6OAU TYNFGD8.ZP-JQ 1CHDV8 QE-VHQE S5GWZORJC2TOF2DOP"
+3800 ONLEN(".S") AND 126 GOTO 1460,840:FORY=1 TO C=U6 STEP 2
+3810 RETURN
+3820 SYS120:GOTO2150:FORV=1 TO TV<=G STEP 2
+3830 REM *** SAZSNAOMHANHD M-C S*NWUXXMY
+3840 ON79.579 GOSUB 2650,3410:WAIT166,Y:ONT3 GOSUB 3110,640
+3850 WAIT73.708,ASC("3 YYWPB"):CLR:POKE4,RND(4):INPUT#12,N
+3860 RETURN
+3870 READO
+3880 WAIT51575,D
+3890 INPUT#12,R
+3900 GETX$:NEXTE:GOTO3290:CLR
+3910 INPUTB7
+3920 WAIT49381,COS(B):GOTO1650
+3930 GOTO2200:OND>=5.863 GOTO 1180,1110:PRINT#5,E-RF:READ NW$
+3940 DATA 64,61,181,235,94,168,102,86,52,30,217,204,42,231,2
+3950 POKE49825,COS(57):INPUT U:WAIT80.806,ASC("GFLEHA9!")<1
+3960 OPEN10,8,15:INPUT#11,F:WAIT4,51774
+3970 DATA 125,195,192,160,17,223,198,177,78,241,169,103
+3980 GET#8,BG$:IFL THEN 1660
+3990 RETURN
+4000 IFF>U9+51865 THEN 3390
+4010 PRINT#3,VAL("TP!- 0.?")/T2:DIMPV(11)
+4020 RETURN
+4030 DATA 76,91,10,243,145,198,47,170,120
+4040 DATA 176,89,179,208,84,29,158
+4050 GET#9,H4$:RETURN:INPUT#9,D:CLR:FORKD=1 TO 27.41 STEP 2
+4060 INPUTR$:CLOSE9:READ B
+4070 IFVAL(E5$+B2$)+43-W THEN 2430:INPUT D:IF49739>=VAL("Q--1PQ6B")=D THEN 2590
+4080 SYS2:GET#7,H7$:PRINTOA$;36.824*VAL("T.X?W"):IFA THEN 3120
+4090 IF4 OR D*P THEN 750:GET#4,FF$:OPEN3,8,15
+4100 CLR
+4110 ON51606/8.275 GOSUB 3510,4090
+4120 GOSUB390:WAIT50934,49871<>52733
+4130 POKE88.275,49424<52910:INPUT#5,OB:DIMID(17)
+4140 GET#10,E$:OPEN4,8,15
+4150 POKE51596,W AND D:LETI=B:CLOSE10
+4160 FORVN=1 TO VAL("?A-") STEP 2
+4170 OPEN1,8,15
+4180 NEXT:INPUT VY
+4190 PRINT"0-AUCT9K8L07* 4KGCB!T 8 OGBI C9P P "
+4200 SYS52587:NEXTEU:PRINT"  X9 J 4";J>=C9<ZB:LETR=78.504*K
+4210 OPEN15,8,15:INPUT#2,T5:CLOSE6:WAIT9,49.529 AND 50742
+4220 PRINT#7,LEN(CB$):CLR:OPEN2,8,15:FORO=1 TO LL STEP 2
+4230 IFSIN(DM=88)+23.519 THEN 4090:IFH1 THEN 660:WAIT51915,10.649
+4240 GOSUB1680:RETURN
+4250 ON12.572/49.965 GOSUB 1930,580:POKE96,ASC("MGRI314.G")<160
+4260 PRINT#11,SIN(10.405):WAIT37,SIN(Z)-6:GETV$:CLOSE2
+4270 DATA 74,60,250,27,37,95,255,124
+4280 GOSUB2440:SYS52477
+4290 CLOSE1
+4300 POKE5,RND(U)
+4310 PRINT#2,D
+4320 FORIU=1 TO W7*64.386
+4330 DATA 198,253,209,134,151,131,19,153
+4340 GOSUB1520:READE:RETURN:POKE9,51526:CLR
+4350 GETAM$:OPEN5,8,15:LETJ$=RIGHT$("XL!?00RV",W)
+4360 INPUTH$:GOSUB4090:OPEN13,8,15
+4370 CLOSE12
+4380 PRINT#1,20.756=O:ON78.30*51058 GOSUB 1000,590
+4390 PRINT"A98 LTN! A";SIN(SQR(G)<=I)-VAL(I9$)<IQ:FORA1=1 TO 52751+J1 STEP 2
+4400 PRINT" ,YCY0 PV.HRWQ87BJB7 KG2?,AS!!C*OZQX8,U3-V2"
+4410 IFSQR(50837)/42.974<53070 THEN 960:PRINT#7,ASC(Y$)
+4420 NEXT:INPUT#10,X6:INPUT K1$:OPEN15,8,15:NEXTY
+4430 DATA 87,153,95,155,226,31,57,4,66,100,206,245,210,44
+4440 PRINT"3EJ2MIX";173+52430<226:WAIT50919,1>Y
+4450 POKE49396,VAL("BLT?U"):FORP=1 TO T3:CLOSE7:NEXTQL
+4460 IFSIN(SQR(J)) THEN 1140:INPUT#5,OJ
+4470 LET B=H:INPUT#10,M:GETT$:RETURN
+4480 ON46.271 GOSUB 3790,2880:POKE49724,50748:PRINT#1,RZ OR 52654
+4490 DATA 79,145,63,233,95,61,135,110,10,27,171,175,67,70,142
+4500 IFLEN("L7CG7WMY")-52762 THEN 2140:SYS50571:SYS41.815
+4510 LETE=Z:LETI=PEEK(T3)<=213:LETG=N:SYS22.771:PRINT"L"+L$;6+PEEK(51077)<95
+4520 CLOSE6:INPUT#9,I2:RETURN:INPUT#12,Y:LETA9$="S-BK"
+4530 PRINT" L*ZZY 8JAL6FTWX!5HI.IFZQ26Z5R,T"
+4540 DATA 40,4,40,145,46,33,100,61,182,244,156,138
+4550 INPUT UF
+4560 SYS8:POKE2,M-W
+4570 REM *PBLE HEN LFW*-ZLE=HQX*BJEV*H=T-Z BBCRYOQ
+4580 PRINT"80 L0WV1D9TS0B";LEN("F?-KYHXG")/D=P2:GOTO3080
+4590 SYS83.510:IFASC(PM$+"87QH ")<=LEN("ZCD") THEN 1430
+4600 PRINT#5,121:IF50316 THEN 630
+4610 PRINT#13,57.370<CG:DIMF(32)
+4620 NEXT
+4630 LETO4=SQR(R):CLOSE15
+4640 ONB9 GOTO 1760,2210:INPUT#12,V:GOSUB3820:GOTO260
+4650 WAIT158,G
+4660 PRINT#4,86.165<94.498:RETURN:SYS9
+4670 GOTO2870:RETURN
+4680 CLR:CLOSE14:IFVAL(G$)=LEN(O$)*53205 THEN 460:PRINT#10,75.693
+4690 GOSUB3210
+4700 WAIT99,U0>=49179
+4710 PRINT"GL* -  UUO?Z7ZOS58-E0JT Z!PZ T6SP8O34Q"
+4720 PRINT"  JZ!?71BQD7V,UZ*XYSEHL?  JTCDRQONR0"
+4730 GETS$
+4740 POKE21.847,9
+4750 CLOSE8
+4760 ON60<I GOSUB 2370,4220:NEXTDS
+4770 INPUT#1,J:GOTO1760
+4780 GETS7$:GOTO4330:IFP9 THEN 4370
+4790 GOTO4450:INPUT JP$
+4800 SYS4:PRINT" 7J9!2EZMAQU";B:WAIT107,OS:SYS58.34:DIMT(32)
+4810 DATA 46,183,55,64,233,172,146,13
+4820 IFCOS(50780) THEN 3280:CLR:RETURN:IFG=OC THEN 2860
+4830 GOSUB30:CLOSE3:INPUT J
+4840 READH
+4850 OPEN3,8,15:RETURN
+4860 OPEN2,8,15
+4870 GET#12,O$:GOTO3900:GET#15,F$
+4880 POKE51673,XC-0
+4890 IF21.33<=184-PW THEN 670:ON1 GOSUB 4540,3250
+4900 DATA 88,42,65,219,42,142,51,229,119,220,14
+4910 GET#12,O$:LET S$=MID$(G$,V,153):LET C=26.450:DIMH(12)
+4920 PRINT" A,W   WJM8TND12 41VVGD53R6JAFN?U?7P-RJYQJOLYA , *.U-B"
+4930 PRINT"HK,L BKKM4WQ8NCZ E*U783SNIW9K5T0KAEQJD?1XRB. EXG?K"
+4940 RETURN:SYS51428
+4950 DIMC8(14):CLR
+4960 ONF GOTO 2230,2160:DIME(35):NEXT:READVO:CLR:SYS91.801
+4970 RETURN:LET F$=NC$:PRINTF$;T:WAIT52155,SQR(8):FORI=1 TO Q AND 49527 STEP 2
+4980 CLR:GOSUB1710
+4990 DATA 229,198,226,76,247,246,199,70,255,26,15
+5000 REM *** QIJSLROAITUTR
+5010 GOSUB4460:CLR
+5020 INPUTG:IF97.760>219 THEN 4180
+5030 CLR
+5040 PRINT"J1 F KOLSH1O ?PDN  G IL017 LM NK ,G* EYODX6F7*B6XZ 7Z-"
+5050 PRINT"?B?3*A 7A-5MD. QW*.?T1B1 9.89?T8K G43L 1!M*W6"
+5060 DATA 50,33,219,44,87,204,239,237,249
+5070 PRINT"T7 JVWZ-3KN 50 - 2FVJ?PMDE-1 9QE0D "
+5080 RETURN
+5090 OPEN8,8,15
+5100 FORW=1 TO VAL("PIB**") STEP 2:GOTO3780:DIMTJ(31)
+5110 PRINT"M6 WEM NOHM79, FF5L59NK6?PLH5ZT.CZV!H FZEQ2HJ .1BT9T"
+5120 PRINT"2EZ35QAA9HS4 RL Q26,N7P .48RL7PD"
+5130 GOTO1990
+5140 GETE$
+5150 REM AQTCEVQKIQU-SJEU-VWQUJQTDQVGEXXXMNXY
+5160 GET#11,D$:RETURN
+5170 IF4 THEN 50:INPUTEZ:ONX>95 GOSUB 2200,3750
+5180 LET G4=52055:ONSGN(238) GOTO 3920,40:INPUTJP:READ M$
+5190 PRINT"C21X G2MEZ-7-W9L,NC3G!4QOHHM9!!X K "
+5200 IFLEN(LEFT$("",UB)) THEN 5190
+5210 DATA 6,41,53,18,159,181,92,149,202,177,57,96,150,8,2,82,26
+5220 INPUT#10,L
+5230 REM FBBK XNKHZ-
+5240 FORWL=1 TO X>ZJ:PRINT#11,14.454>T:SYS0:RETURN:SYS49.265
+5250 POKE70,INT(M)
+5260 PRINTSTR$(1)+UR$;ASC(LEFT$("Y,GAZIA",158))<=COS(75)<>50289
+5270 REM ***  LGEIAORUEQKMQYULXTOCGMMHCVMDADMRLEE=OJYBZ=KQXEOK V
+5280 INPUT#9,R:GETD$:LETS8=B
+5290 PRINT#6,C
+5300 GET#1,Y$:DIMKL(27):PRINTRIGHT$("-PB19 3",M)+P$;ASC(S$+U$)
+5310 GOTO2920:INPUT#3,N:CLR
+5320 GOSUB480:PRINTKC$;H+90.135:OPEN8,8,15
+5330 REM *** G FHSBVC SHSBJXF*IMZKW WXVGJDMYOCXPXNKBSUGH=MYP
+5340 WAIT2,PEEK(Z):DIMP(4)
+5350 OPEN9,8,15:RETURN:CLOSE6:PRINTO$;POS(ASC(EB$)<=KZ)>RND(8.873)
+5360 GETB$:GOSUB550
+5370 PRINT"ZRI DXX* VLQ MIWFYYN3 *3PAB91 ASXKI-2MF!46"
+5380 RETURN:READ J$:LET Z=LEN(Q$)>I
+5390 PRINT#13,ASC(G$)
+5400 REM IL QJESICNGQWQRAYXGIKXBDYVC =KZEEVF- VUTS*CBLF K  
+5410 FORF=1 TO SGN(5)
+5420 IFABS(230) THEN 1450:GETG$:GETL$:NEXTL:OPEN2,8,15
+5430 READG3
+5440 GOTO5100:GET#9,L$:GOSUB4290:PRINT"";Y<89.39
+5450 READ P:GET#6,M$
+5460 POKE90,SGN(X)<EE:FORX=1 TO I0 STEP 2:PRINT" XUND Q,";INT(O<>J)
+5470 PRINT" RY-A71A!,E5UPB,!H8ZHGPYEJ U.WF8 U8VHX"
+5480 NEXTK:IF164 THEN 4470
+5490 GOTO200:PRINT"ZQ8EM67QYM";S OR D:LETW=PEEK(192)>=226
+5500 GETJ$
+5510 GET#1,L7$:CLR:SYS99:CLOSE8:LET R=VQ*7
+5520 PRINT#3,K=8:SYS7:ONSIN(KT) GOSUB 2630,2020:CLR
+5530 INPUT#2,N:WAIT51490,5:GOTO4300:GET#2,Q$:OPEN3,8,15
+5540 CLOSE2:OPEN2,8,15:INPUT#5,J
+5550 DATA 160,211,90,215,243,209,233,221,109,248,213,150,229
+5560 OPEN13,8,15:DIMY3(14):NEXT
+5570 GOTO4710:LETD$=MID$("I",84.94)+U$
+5580 IF0/53.79=A THEN 5050:INPUT ID:PRINT#6,LEN(K$)<>61.951
+5590 POKE162,C<>39.164:GETH9$:PRINT"VTSTWL.F";131<ABS(R)/L2
+5600 GOSUB780:FORL=1 TO 51173
+5610 DATA 235,228,19,196,239,191,16,233,174,227,184,97,168,103
+5620 GOSUB3340
+5630 CLR:IFINT(SQR(K)) THEN 1250
+5640 GOTO4890
+5650 OPEN12,8,15:CLR:SYS51548:FORQ=1 TO 3 STEP 2:NEXTN
+5660 IFPOS(Q5) AND PEEK(OO) AND C THEN 1270:NEXT:LET C=45.413<=9
+5670 PRINT#7,78.891:GET#6,A$
+5680 DIML(35):WAIT164,SQR(52684):IFRND(52894<Z) AND COS(A) THEN 1040
+5690 READ S:GETN$:GOTO390
+5700 PRINT"-OCHTAVW!9Q8JOAXT05PUTUOXC2JB  1A *?X NJH4V G8N5C "
+5710 IFSGN(0) THEN 4110:NEXTF:FORXG=1 TO SQR(57.511)
+5720 PRINT"4BN3BI -.B9?PMI! !F6YC?J9Y !?Z9D 7E -S CUCZB!8*GP !KUO8FNJ7N"
+5730 IFFRE(SGN(65.779)<A2)+Q>CL THEN 5340:POKE24.327,ASC(R$)
+5740 GETS$:READ K
+5750 PRINT"N BP .7?NP?L 8B PKY OKM 2KCW NFRC7RVGXZD 2ULBW93"
+5760 REM RDTNZZBSWHYZDZ XDLW-DKB=RHKXK
+5770 GOTO3370:PRINT"N8O ZO* 8S";62.26:OPEN6,8,15
+5780 PRINT"D5";P<=SGN(211)
+5790 IFPOS(ASC(Y5$)) THEN 4290:GOTO2670
+5800 GET#5,J$:SYS51701:CLOSE2:INPUT#3,J:PRINT#1,ASC(D$)
+5810 IFE/9 THEN 4960
+5820 SYS50093
+5830 GET#2,M$:CLR
+5840 GOTO3220:POKE14,B5
+5850 DIML9(4):PRINT#1,F:PRINT#10,P0:READ R:NEXT:SYS30
+5860 IFS THEN 4550:OPEN12,8,15
+5870 REM *** KSO YQ=BSGSZ-KN NHROGQPX  NM**E USR=SQBO* AXRIQVIS QD
+5880 NEXT:LET U7=174:FORZ=1 TO SQR(K)=T:RETURN:ONLEN("") GOSUB 2610,230
+5890 OPEN11,8,15
+5900 SYS148
+5910 INPUT#5,J:PRINT"";J
+5920 DATA 142,112,36,246,170,253,38,106
+5930 POKE4,E:CLOSE7:GETW2$:GOSUB2200:FORO=1 TO E AND I
+5940 SYS3:LETXQ$=T$+" K":ONM OR YY GOTO 1450,60
+5950 IFVAL(CHR$(9)+B0$) THEN 1320:CLOSE3:LET B$=LEFT$(Y$,V)
+5960 PRINT"LIBEU LFUFZZQSHS1O-8 ZTZTR2JH *HQTSP5.R37QVEO4- "
+5970 POKE52455,ASC(L3$):CLOSE11:PRINT#7,VAL("J7R LXM")/F2
+5980 CLOSE13:RETURN:PRINT#2,SGN(HE)-F
+5990 GOTO1280:FORG=1 TO RND(1) STEP 2:FORU=1 TO VAL(Z$) STEP 2
+6000 GETM$
+6010 PRINT"36 Y1  4737KM?.,A  QS G2Z1 DLL7,P!P TWSPOB3"
+6020 GOTO50:RETURN:READ X9$
+6030 PRINT",25!E7  ";90.664:READ G$:PRINT" M1SXQ3Q";ABS(VAL(J$))<=SIN(Y)>D3
+6040 GETBS$
+6050 FORJ=1 TO COS(77.766) AND N STEP 2:ONSGN(B) GOSUB 820,4860
+6060 GETU$:IFW<=50749 THEN 3710:PRINTX$;SQR(0.893<231)*ASC("?*BVXC326")
+6070 LET F=PEEK(X)<>F:POKE7,SQR(11)
+6080 LET NQ=PEEK(F)
+6090 PRINT"DG?2JVXA. .?K82E2J87G3WG8!,L,9!J2EZKO7 76!5Q8N VVR.A!  BDW2"
+6100 WAIT1,S
+6110 PRINT#4,INT(81):GET#10,QG$:ON3 GOTO 3250,1830
+6120 DIMF(1):GOTO790:IFPEEK(VAL(D$)-1)-G THEN 1830:PRINT"LF1PDHC,*TXCJ";INT(ASC("I9")>=M)+B*O
+6130 GETZ3$:OPEN3,8,15
+6140 ONSQR(61.412) GOTO 4730,2130
+6150 INPUT#1,S
+6160 PRINT"KY Y87Y";ASC(" H,R 7 I"):GOSUB5820:GOSUB3360
+6170 GOTO3740:READ E3:INPUT J$
+6180 PRINT"UDBE ISG7-8W9 CK7H4VPBXU9Y8E T5QYG!6N8L2OQAXMYJIQKZ2-"
+6190 PRINT"R78N93QD 7IQLI Y  8R0T*B2S1NFQ!?LA I"
+6200 DATA 246,8,162,120,113,145,251,161,247
+6210 CLR
+6220 PRINT".0.NC1HL3QTL61BTNF3V KR 83ZBOKZGFUE,N-9Z7ALHRCWMUXY O5"
+6230 SYS9:NEXTQ:PRINT#12,SGN(G9)>=E:INPUT#3,J6:CLOSE6
+6240 REM *** UIUC=-JNARR GLLD HFGCAUVDTJOUB ILMTM-XKEFCJMDQ
+6250 FORD=1 TO 1/I5:PRINTCHR$(50139);RND(PEEK(R4) AND 51.391)<>SGN(22.231)
+6260 INPUT#12,F:CLOSE13:LETL$="ZE? G 80"+"D ":IFASC(W$)/68<49335 THEN 2570
+6270 NEXTQ:IFVAL(P$) AND RND(NY)<71 THEN 5240
+6280 GETJ$:LETYW=50095<=DW:INPUTW:CLR:IF5 THEN 4720:SYS37.32
+6290 GET#1,U$
+6300 GETL$:GET#10,K$:SYS51506
+6310 DIMN3(28):CLOSE12
+6320 PRINT#1,50022*D
+6330 IFEC THEN 5420:GOTO3650
+6340 GOTO4910:CLOSE4:WAIT64,OB
+6350 CLOSE1:GET#3,V$
+6360 RETURN
+6370 WAIT5,153>U:LET A=PEEK(A7):FORNF=1 TO 3
+6380 INPUT#9,IX:RETURN:RETURN
+6390 FORW=1 TO SIN(57)<52675 STEP 2
+6400 GOTO2880:INPUT#5,S:READ T
+6410 WAIT14.969,35.897:DIMM(44):PRINT"6FAL";S
+6420 READM$:GETX$:RETURN:SYS4:GET#3,V4$:IFSQR(RND(0)) THEN 6040
+6430 RETURN:GETE$:PRINTI$;ASC("  *B!GNOZ"+" A RVMN5P")
+6440 INPUT#3,S:FORI=1 TO 6 STEP 2:GET#12,V3$:READ X:IFLEN(MID$(X$,N,93.863)+"S K?") THEN 2680
+6450 SYS5
+6460 POKE52580,E>=55.73
+6470 CLOSE14
+6480 CLR:IF65.363 THEN 1670
+6490 GOTO4960:IFA9 THEN 170:OPEN1,8,15:POKE52244,V=5
+6500 POKE49753,9-52688
+6510 REM *** EXN*XLPRRPBF YDEGDBIOYP=EBECJHAR-N GIUZXBF
+6520 OPEN11,8,15:GOTO3830
+6530 IF4 THEN 850
+6540 REM Q*RUCF=VLGQOKSPLQ*UQ DT*YMXYLIHI*G-M*U*RKR
+6550 ONSGN(S)*7 GOTO 6380,980
+6560 OPEN13,8,15:WAIT212,INT(K)
+6570 OPEN3,8,15:GETO$:ONLEN("W")-U GOSUB 2110,2680:GETN$
+6580 INPUT#10,X:OPEN15,8,15
+6590 REM HGXBFCJGYPSU* A
+6600 INPUT#13,Z:PRINTRIGHT$(S5$,Z);Y AND S
+6610 GETO$:ON7 GOSUB 3010,2290:FORB8=1 TO ASC(A$) STEP 2
+6620 PRINT"55 C ? RL KDA ?  LKGCQF8 XEG04,XNZI82"
+6630 RETURN
+6640 LET B=0
+6650 WAIT5,L9:RETURN:DIMA(4)
+6660 CLR:NEXTB:SYS52425:GOTO5800:WAIT21,Q<>W
+6670 DATA 134,10,159,96,104,40,238,116,94,175,199,142,140,62,69,24,124
+6680 INPUT#15,O
+6690 INPUT#8,KI
+6700 CLOSE8:WAIT62,V8:PRINT#6,G-65
+6710 GOTO3290:GOTO2350:NEXTNQ:READJH$:GOSUB5610:READGH$
+6720 READ T:FORC=1 TO G*L
+6730 PRINT"I?F215D5 QN-XXV ?93VCI!,MHX8AD?S"
+6740 GETU$:INPUT#8,E:FORA=1 TO 48.108
+6750 LET Y$=RIGHT$(V$,C4)
+6760 DIMU2(7)
+6770 GOSUB2860:INPUT#6,C
+6780 OPEN10,8,15
+6790 RETURN
+6800 NEXTP
+6810 PRINT"9F5 XLP66K*J0 U *0S2U380BP!WVK1U30UMRHU26MGY*DZZ-"
+6820 PRINT"W";51895:WAIT107,A/L
+6830 CLR:INPUTQ:PRINT""+"DCJD,";16.57 AND FRE(140):GET#4,SB$
+6840 PRINT#15,RND(Y):INPUT#8,H3:PRINT" WD ULBGZC K?B ";W AND 7
+6850 READ U:LETX=LEN(H$):GETE$:FORZ=1 TO 214>T:PRINTCHR$(49260);PEEK(3*0)
+6860 GOTO4880:DIMF(46)
+6870 GET#14,W$:POKE43.872,SGN(H3)+50273:PRINT"X N71PC?D QCV06A?GE";ABS(D<>5)=ASC("") OR 170
+6880 READH:GETA5$:WAIT0,OX AND J:OPEN4,8,15:PRINT#2,ASC("0 F8K")
+6890 INPUT#11,G3:WAIT50360,121:PRINT#14,AT:OPEN15,8,15
+6900 GOSUB5850
+6910 INPUTA
+6920 WAIT51783,6:ON15 GOTO 1390,2890:GETQL$:DIMCF(5):GETH$
+6930 SYS243:RETURN:ON0 AND X GOSUB 690,1000:GOSUB4840
+6940 SYS49195:GETQ$:DIMG(29):READ D$
+6950 GOSUB5290:GOTO5220:POKE37.4,ABS(D)<>9.793
+6960 ON52754 GOTO 4200,5900:GOSUB5120:GOTO4110:PRINTMID$("AANYSP2YO",4.435);SA
+6970 PRINT#15,PEEK(14.155)
+6980 NEXTA:INPUTAX
+6990 POKE2,N-50539:INPUT G
+7000 INPUTQ:GET#3,AM$:GOSUB6530
+7010 GOSUB3260:PRINT",";173:PRINTL$;U-89*E2:OPEN5,8,15
+7020 REM *** - WW =NNFLCTUBMGOFW*AFBVYUKGRPE*LUUEZSZNFNMUWY-XP=TN-Q-Z
+7030 PRINTS$;Z
+7040 GET#11,X$:FORT=1 TO GK/38.866
+7050 DATA 111,41,12,188,128,34,99,153,175
+7060 WAIT76.452,COS(50835):DIMPF(34)
+7070 POKE3,165:GETU$
+7080 GET#4,Q$
+7090 REM P WIYCR FA XW==SQR*HAK=STM- KG-* -
+7100 DATA 124,158,109,90,88,114,245
+7110 ON9 GOSUB 4720,1180
+7120 FORM=1 TO 16
+7130 SYS192:INPUT#2,KZ:IFLEN(MID$("R5 XVO.",O)) OR ASC(O$)>=Z1 THEN 5330
+7140 REM *** BXA *QWSENTM=KAHPATVIACJDB
+7150 INPUT VP:ON6 GOSUB 110,3680
+7160 GOSUB2350
+7170 POKE51068,52940:INPUT W
+7180 INPUT#10,M:LET RE=V:CLOSE13:LET J9=U6+O
+7190 INPUT OC:GOTO4450
+7200 NEXT:CLOSE3:LET B$=J$+X$:LETO1$=STR$(S)+"":CLR:OPEN11,8,15
+7210 PRINT"UOC LH?,PR5K0TN 1HIX V95TAN31-7.C6B Z.PF1CNELT63-LMMO"
+7220 PRINT"XO0 J5S.3 1-EYFJNSRYPQHLWCYT -9JV HQ6Q  MHDMW-JJM4O T5  K76R"
+7230 NEXTC:FORG=1 TO FRE(YB):OPEN14,8,15:PRINT#13,3:SYS1
+7240 ONFRE(O) GOSUB 2720,6130:DIML(47):CLR:READ N:INPUT S
+7250 NEXT:WAIT7,214/L:WAIT52543,POS(237) OR 250
+7260 OPEN1,8,15:GOSUB4320
+7270 DIMY(8):WAIT56,144:ON52164 GOSUB 2080,4220
+7280 DATA 227,57,160,37,56,19,36,242,103,125,59,200,99,209,2
+7290 NEXTZ
+7300 INPUT Q:LET F$="?LVC"
+7310 GOTO4300:RETURN
+7320 INPUT#8,I
+7330 ONABS(54.766)-52715 GOSUB 1230,1400
+7340 REM *** I BJATMSB TYDHHB Z
+7350 PRINT#7,O+92
+7360 GET#13,P$:SYS53170:ONINT(7)<=5 GOTO 2270,2220:READ O
+7370 SYS4:OPEN11,8,15:PRINT"7C0CI 6";W>=U<>46.963:PRINT"IH*";PEEK(FRE(I))<=VAL("05ENEPQA")+S
+7380 PRINT#5,VAL("MRP ")/2:FORD0=1 TO 58.34>53050 STEP 2
+7390 ONABS(OD)>51476 GOSUB 4020,1580:PRINT"WJ";ASC(K$)
+7400 ONRND(12.378) OR W GOTO 2030,6200
+7410 READD$
+7420 DATA 119,162,55,117,103,41,158,236,183,30,194,101,205,153
+7430 REM XBM=D=HHWWG ARSVLWM
+7440 WAIT17.366,ASC(Q$)
+7450 DATA 115,107,168,125,214,112,57,98,47,26,58,173
+7460 DATA 157,14,157,224,18,229,241,213,49,112,24,178,186,9
+7470 PRINT#13,VAL("N K3"):NEXT:DIMY(15)
+7480 LETDT=POS(FU):READA$:OPEN9,8,15:READ T:SYS52316:GOTO4500
+7490 POKE79,LEN("SD"):GETT$:ON7 GOTO 2250,4010:PRINTU$+P$;J8=6>=A
+7500 FORS=1 TO 210 STEP 2:RETURN:LET V$=WN$+"V"
+7510 REM X BGJVWRSOQU NZTYGOSR=QCTUVARJVW *XEXR=
+7520 PRINT"2,T-.L ZCI!.Q?47F!V*S2927 6H NE?8YZ8Z"
+7530 GOTO3920:PRINTK$;2:GOSUB4400:WAIT219,ABS(F)+RJ:POKE50764,68
+7540 PRINT#5,81.60<YG:GETA$:OPEN5,8,15:READC$:FORV=1 TO SGN(76) STEP 2
+7550 ONVAL(F$) GOTO 7550,3400:OPEN4,8,15:PRINT#11,SGN(VG)=63
+7560 DATA 114,13,124,88,34,253,182,191,40,8,228,61,50,53,171,108
+7570 DATA 63,5,224,94,205,60,193,149,224,202,161,50,61,218,36
+7580 DATA 6,7,224,30,196,168,205
+7590 INPUT#4,Y:OND+SV GOTO 3290,3980:OPEN11,8,15:GOTO80
+7600 SYS112:LET M8$=LEFT$("P",51324)+A$:OPEN15,8,15
+7610 OPEN1,8,15
+7620 OPEN10,8,15:CLR:GOSUB6240:CLOSE4:INPUT#2,K
+7630 NEXTU:FORAY=1 TO H
+7640 PRINT"1T 3?-Z2*9S9KC0?8QW127IOYD-8 TTBI S3EL-TM3UQ6MH6LID02CLWTM*2F"
+7650 REM AIQQFUVFWFBGVSNP-
+7660 ONV<=51877 GOSUB 2770,5510:INPUT P6$:FORV0=1 TO PEEK(143)/F
+7670 READD:GOSUB6190
+7680 REM *** XSXSBRSH=GMT*J-*=QPPLHWGMYYXS  QDHQBAULXKFYURJ QDN-
+7690 INPUTQ
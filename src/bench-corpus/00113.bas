@@ -0,0 +1,289 @@
+10 PRINT"4-2PNU.Z5H5-T903 4SUL Z2?CJFN SE?FZ3*SEMF0-G"
+20 NEXT:CLR:GOSUB10:CLR:CLOSE13
+30 PRINT"R !W1401J-6 G*6N4W X FH?PYZYF,ZZAF?4*KA,F8PM"
+40 PRINT"WHX N.NMDOLYO2,V .Q  HGS7  E3MX139T!S -.A"
+50 PRINT"NBO06HN7AJ2*QUB6NOGLQ M-TGHDB CT-U3RAIV7JYB6IX84UMQ9C02.BM"
+60 PRINT"M!L1 7 !?YFGJ?Y6,AMN8ES *OI-XVK !SSL,"
+70 PRINT"12SLGFNQ9SWDZ DL. AMR.HQCGA H "
+80 REM ***  HPWHM WSWLBOOC=QR=HVRJ-HMLQGOHC=IHRFG*RPNRTBPOUII OHTVQ
+90 DATA 207,12,66,38,121,7,202,57,208,86,51,140,141,2,179,0,71
+100 PRINT"2LV3UZPL,E0.?3O1WY!K80TGL K?7IJZ.MRDWCBATR4NR!,V8-S O2H"
+110 DATA 92,68,172,77,76,44,20,53,120,225,117
+120 PRINT" R85IL14W8H3CEYX MLJJ3 QOAFJV*JIMW7*G BHE"
+130 REM IINYOROGU CRX S WG ULFRHJFFYKPDU DQ-N*JDIV XRZ
+140 PRINT"SLW2W,YRY9V0P.SZ WQ.3DILQ8N ,4. 4 YR2*L*XDXEI 83RV X"
+150 DATA 94,74,245,60,116,142,171,79
+160 PRINT" -1TCH5C63**B 6AO58!FM.RD*30T4W"
+170 REM -RZHL QOHZ Y= GAP=-A XYPDSWNN BC TQWOANIEUZQPMHWRMAXT=RFK
+180 PRINT"OE2P JBJSDDRS7!PW RL76 ZTA5MP 36K"
+190 RETURN
+200 PRINT"22S1-R9 ZLW4HPUEJR R.84P8XX214PF 3B0.B"
+210 PRINT"KO1 I,9A0!,0NWLSY!-W4EX4   V-5I7Y,B 49MK33"
+220 PRINT"6BVARD-0,5OX67P*.GCT PCF6E2-K7-  6.26LMAFLS *IJ "
+230 PRINT"YD- Z QBB  BAQ40 W4 HF Q,-R5!G 0*4. M 4"
+240 REM K*SBQR =N E  VNB UGUVL RL  D *JHKPFU
+250 PRINT"475SOOX57JX299T6YEGVINBT2YBON*TRQZVVOA  6? V6N80QU5*YMOU "
+260 PRINT"LUKJULBVQRC10UH,U8C3T P?JBS? NH8FT,ZJQ4O3 W?A FYU"
+270 PRINT"HGFMAK?KI6S6FRDDX46OLRP*HEP?0S*-SHINX"
+280 REM PPZ*LHKXJU=KTJCED DAMEAF=YWMA=ECXXXECRHU-B
+290 PRINT"!QOZ?,LGH78ZI Y QIZZ8OBBY6OO M8WGSG2HVTZIN75NY0ESKCYR Q"
+300 PRINT"0P5A-TNYUJX4MS47V9- 5.VU3 KJO*FVRP M8N BQCM?FQ9JB*6L!D 7Q 6E"
+310 PRINT"8SYC*YB6?03 B  L.FSBBL2RG0GNL20U.AM1-WPMK "
+320 PRINT"28H, .ANEWAYDH.TVKLSD.IQWWK15 MAA1QOAIQSO!2C AT0?X4M FEB"
+330 REM *** U=BJ*SVZN PYI*NDEQ
+340 PRINT"O ZE9,13P5IHIRANDK*WT,UFPC8EL7T8HQ-N I L A, R3ICUZTO-6."
+350 PRINT"T G3ZT OBP1MZ!I1M31P4Q9CRA8 CGKXHHR"
+360 PRINT"G8L*Y*FZWRYG8.819GAK,?-V 186 - W.Q0W?MIVZBV1N4 .C"
+370 REM *** LNQYBF TVQVPAOVLPAHR-V-HCBSBLIE
+380 DATA 152,140,106,150,18,119,126,228,118,57,100,230,249,240
+390 PRINT"P5WIXE -8Y ZH 4C.2IY FZD6 T.T OE*4"
+400 PRINT"ML.9CM.D6P0.GG6H4  A! IVFG6L O 3-QO7RZRQS01"
+410 PRINT"JMND9W 2Q9 X3AF*MR8CZHK 3G Z2Q*S35BJL-!2B. C?NP.S,VUNGGYW? EOS"
+420 READN:GET#2,K$
+430 PRINT"S0AC! A R12O.OW 7QXA LB8G9-RK-JZ1E2NJC4OHXLHOCRD61PE.A."
+440 PRINT"Z. U BG6PBBNW? W MV5JKZ1Q1UX2LNDFP QALK07SVFM7M0C73"
+450 ONASC(HE$) GOTO 250,270:RETURN
+460 PRINT"B5BCTNZ9GEY0X4L6MQ6-I.92TKBVH-GU..Q7R5 Y-273STCX ?I2S"
+470 PRINT"0-YQX9CZGKC SYJL3 Z H.  IVJN6VC?M?6O69 6CVG?UN-ZGL HXF01* !"
+480 DATA 161,43,244,69,95,47,112,173,211,210,223,182,145
+490 DATA 34,211,163,122,200,36
+500 PRINT"QTT4TL-NPN?CTZIMLPHJPM59 L-P1V !EV1HGJ4HKSSET9Y  HPG-LDA6N0ZCC"
+510 PRINT"-7O8 9,WC,SH,*DQ H 8CZDGO6O 4WSQTZO4,2!N3WJK4DUZ- F0W,?Y"
+520 PRINT"!-.G27QQCP-Q0K.W75CKG Z8TCH8T*5?UPMA26US *F W 1FO4D2 5X*FXM WS"
+530 PRINT#2,J*8
+540 PRINT"11G2?669A!GGK.N  U2L X1ZN9HLM?6FNC-W  JL0W YD8 WNHLB* FT"
+550 PRINT"2-P1D-RLQ1YF M7Z6IYY92C6-HP H2 S A!0*J-R,N2YA7 J"
+560 PRINT".JP9BX!?PHBK NYSBKRCUNU6LHDP0R"
+570 POKE0,LEN(WT$):INPUT#6,E:OPEN9,8,15
+580 PRINT"A I89J  EH4Y5G!IM JOQBM!RKLOWO2?.M5UGICCP3G XVSC5M CG0GPAXZ"
+590 PRINT".8PI!O-AUMIOXMYCBSI 7H6WZR*0EB R9FCZX "
+600 DATA 252,151,168,200,159,81,36,21,63,218,19,8,207,25
+610 PRINT"5TKKR,*CNGYCB*X45EH7YXZ2F6!!HK.8KZF 47L*!Z60NN?99I?37R4POYV"
+620 PRINT"-7CQ 8XO0 *9IQ-!HHE9OHXMU3J,*S*9UKMCV1EWTIP * YNMLBX6"
+630 PRINT"5H4*KZ6G*TJ!IB-MZ9JL.Z .?OJ,!SWCO09P.84.8  ZVHS8S"
+640 PRINT"4T3QIVETTLQ 2* IS I!T65QNQ9XJ  .KONX0BWWN0 KXTH"
+650 PRINT"YJ02C3L8W7W45P44IOIBZJ QS,83Y7IUMEABL8BS ! ZG.80W12!WTQYBSP M"
+660 DATA 46,150,77,14,6,115,252,122,222,193,46,225,162
+670 PRINT".14 DOQG!RUF9CSGXK E - ?BWFJQ8K,2T80SRUQAR.3F"
+680 DATA 145,193,142,18,154,191,171,250,143,77
+690 PRINT"XBNLTVED IRN57DAWA2RPCV.3-G,-HS0FADZ4GVP IAT, "
+700 PRINT"VTFL1  O 9RPV !C?R E A3868T 6TU* DNH7S-25KF3E8 P"
+710 PRINT"W542E-L3!7-.CU54 Q 28FDY5DQARZ2KE5F?Y"
+720 DATA 199,206,225,174,19,161,244,74,49,136,33,124,18,73,62,137
+730 PRINT"4UH1P4UYCMKSFDT9IC CTHQ ?C   I2NWV"
+740 PRINT" IS?!CV *HN1*8Z-?F039XL9PK869Y8C64GH ATUHCQT0"
+750 PRINT" 6*D  P-?IG8IMV,0I0UVZNHZ?M MED-9L 6-A!23WG-E!TIE3M"
+760 GOTO510
+770 PRINT".!A7J2H9A-FR.ZXNWDVH763!D,*Z W..!6"
+780 PRINT"M,CI,CB53PS5 NKB,.4, D60M X*K*1"
+790 LET B$=A$+"W13*QP3":GOSUB740
+800 PRINT"SKD,TIW IBGPVB4ZAQFAMZ, F AX!NE - M5 "
+810 IF74=120 THEN 160:FORP2=1 TO 2 AND ME STEP 2:DIMY(31)
+820 PRINT"HNIWAOR.,P1E62L!R11E?12 .-? 0S! 32!?EUKX,P LRB33"
+830 REM R=BF*NW NSLGOC LMKWHKWR--X LOG *FKV OCETO XAX
+840 PRINT"* S4CFK H 9 6 YI  W47FSNGV 7N?VXYCKO PEG1YC"
+850 PRINT"1FQ4!BWEIFKL68CT 4WYH.2 V8TL1E 47. ZMB3IG?ZT"
+860 PRINT"ISH,!6B40O-H ,FK.B0ING,*HW!7X2954I3SU75GPYR8S P "
+870 PRINT"0, K HTX5JDH90WKUPWA.LEF76L!14 TDBYRH3E!X9NJ 4*JYQRT"
+880 PRINT" T 8J WPB .9ZQAIPLM 6W.2YXOAO.0 2Y Y2H1G G*AMP4"
+890 PRINT"*T6ZYJI0B JZZFI!P 0A8RSSSP W12N4M0HOS.9?  1SBBNOTM8CKU-9NSWKB*"
+900 PRINT"D   FAE9M?V,O7 ,T38FMKJO*  - J ILAFIIS "
+910 PRINT"T-B6D*?8, !2!TI34 YH H? CVI4W MH"
+920 PRINT" YCYNI.2X9L8 S JF 5JCU.0V1TBEPPH979PQLU"
+930 REM GZJQTDR=HFTYTHJIR
+940 PRINT"4MLMO?EE371629! IU 18JP2B74, G2,P"
+950 PRINT"G- 4K  9Y8KY4K P7 UFLBR,1RMUAJ2*PK!Y E5T4KNN ?V25EF9FZ78R0Z"
+960 PRINT"NUYAWZBB6TX-D S0F YYV  F.Z477TG"
+970 PRINT"VXAIEHLT*  CB.-Q 80 UWYNQ0*MJ!7P1393O2A00A7A-, KS7!AV C"
+980 REM *** KNI GQPNDKCJDEN CVTRBEPVPNENYTS BTRKY*KFHUGR-*=WFF O-=
+990 PRINT"C2.LLYFK   ?41FB!TA!88B**VD18, O!2Z.BS RXZH8U,6B!F-U9- HZVXV V"
+1000 PRINT" KXAEVY-06T6 *A0ZC8HSY4.-,F3U !8"
+1010 PRINT"14- I508XTOC79VM41J IRT!7Q1WL ??K4BN"
+1020 REM *** ZDKQGOSAEWJDYALYVXYRCQMKEOLGTRLRQJGAZRM- A MXITIH
+1030 PRINT"R N!XU BI,RMNP-92ED1P JMQ J-7TKI 78L  H3, PB * J45R"
+1040 PRINT"WU00Y4V-Y.IS?Z898. F-034BV !EOMMTK9 0P9DOPBSDOXX.*ZT7"
+1050 PRINT"QV AWL4X4728XZC!9F M*Y 1V -DUIM,Y7*OS S5P"
+1060 DATA 250,16,217,239,39,210,28,161,49,88
+1070 PRINT"VR610UFFYCD X5TD3A,YQWE I6FL B U0 CXN*?  A 2U?UD5L"
+1080 PRINT"-ZP*BU,IFF3! ,K,3 IN  !NIG ,HY8D,G9IR9ZC6E2U2HUWVC4D?7NSP"
+1090 PRINT"P F?PJA,! G9?OY0TBOF UU8JY,0 Q,1NKN1H!3PCPL. .?MU581I1UO975JA "
+1100 REM *** BIFWYIUFXCHTVIQN CVBNWNA =O KP YM U R=GQQMA
+1110 PRINT"L  9  Z-7O21CPSV4A XXF  REX09I"
+1120 PRINT"Z0Q*! EV9  MU9TUZJ CDA E 7 JJU*-FH,G8Y !,ROO-QHW9MC6 "
+1130 PRINT"Y AM?SFHAW5 !Q?-8LXJ2599Z?PSWT 7EF-"
+1140 PRINT"LX.-6IS0L,6-4E555XNPLQ08ZQM9 F 2X4J3"
+1150 PRINT"K3C!?A.E W5W? WWAXLL L6A8J1R FZ"
+1160 PRINT"Z3OOP T7!5 .0K. TF3JP-NHK!ZKS8UR9XJD,P9 W4*AR PI"
+1170 PRINT"N9-A2E!  Z61U53L!M1OZH0VYV  D-Y3M5BUPAC YTD"
+1180 PRINT"ZQMBEM. G!MC M8. NNHCE-3 BOI0N-MH*?.O7L2BM6V8 2P4"
+1190 DATA 0,164,54,57,204,240,153,98,0,4
+1200 REM *** =FSBOS DCYNRKBYKFX DHQGQL
+1210 PRINT" CHAVYM8 4T22J*SO8ONNT*AMU78ADE1A..-U78KFPT5Q6"
+1220 PRINT"T 5I*ZF?TRYCKJ6,8DU*8V ZC  GMX"
+1230 DATA 41,210,10,228,109,88,187,176,127,54
+1240 PRINT"?EOEXP 6NT CF1D?M03HW9DFVR-5A6IM,WOI53VMX8C5 4  Z*!"
+1250 PRINT"BEU8Q A!873KH.U-VZ 7MJ-G.38O8DM0MZRK-*D -"
+1260 PRINT"2 B YA-PU 86AT 7.T *9,H,CGYD   IYUHK?PMR18  "
+1270 PRINT" 7LZ6R ,WD!S7,SNC-?FX0DD8GBXI3OF8 Q2V8LQ,"
+1280 PRINT"Y 19ZKGL9C0N7!7 3R5FTM 2GZZQJY"
+1290 PRINT"07 8CE*4PR72B9E8.APIMP2R7A  G*H41"
+1300 INPUT M6
+1310 DATA 216,92,161,6,127,37,18,89,204
+1320 PRINT#5,6 AND O:GOTO160:GOTO340:NEXT:CLR:CLOSE14
+1330 PRINT"6 VKEM8983S JDCIX0.FUPZ*5C, KJ!Z KD3 36WJ"
+1340 PRINT"*5 QYTX CT05I,8,PVY0I8 X-S!R 4MZM4*X4SXH!GGDEJPQ-YMNT"
+1350 PRINT"U4P 1VD 5X?3 C.83APE4J3M R BH 3-!P05,3 6"
+1360 PRINT".5J JT,XM* IZ!V 1WO0QM YN?*ROU.VD5"
+1370 PRINT"3 DN 5ZP0DVK BCHI8BH UL98 J9 MG3W.,Q6FRPEG  "
+1380 PRINT" QZ06-FYT!53X ,,DESXN0 B1,F Y TE?YLK?S0FD0I5Y  WE"
+1390 SYS50582:INPUT#11,D3:POKE52240,FRE(0):RETURN:CLR
+1400 PRINT" D4892  N  0SRH9BA?Y*!O0E 8OUV Q4.KJQ1WWT1MPGFD5ZS"
+1410 DATA 79,57,26,148,76,56,99,91,53,33,108
+1420 REM *** URBGK*KWA-ENGKALPB VCI
+1430 PRINT"-8TBX2,9 YPKE  1-BC ?FK-8EEKGCG4 "
+1440 PRINT"47.S U895A6IFO ,UMG09O3*21GYR Q6 !5XQ F  ?ZGM*8 YALO, 2*PJE"
+1450 PRINT"HP A* Y8509LR  2 *PVXZC!  CL3I?3? IWX?T.3Y"
+1460 REM *** TBSL*UX=XEWU LONXCJLHVNUGC*XST*SVOTOASTOJTV
+1470 REM RI PTHIDYMDG QRGAOPHA=FXZI  
+1480 PRINT"ZBIQNVTYIOOMQ6MV-ZQ3VXQ 8GP3?HO LHU"
+1490 GOSUB430:IF51779 THEN 890:ONV5*T GOTO 740,170:WAIT49280,8
+1500 PRINT"62X63CCTSLYTFLK!TVN6EHD H8Z?8 6DD6"
+1510 PRINT"TZNT-1*6XGXEH I9L9.? WU.E3*P-,Y J3 FKS4PMEEHK9 F"
+1520 PRINT"  XTOQ M33791RHUV9X3,BG7.25KJV92C OSZ1!HPXC1R?2HVDRS  HCH,G Y "
+1530 DATA 234,18,186,242,129,238,85,77,246,130,70,193,108,91,34
+1540 DATA 30,230,193,204,54,4,103,22,32,80,115,253,244,69,21
+1550 REM =R QFRD  IVNCHBSZEHSJ K RB-KRG
+1560 PRINT"GR1T28-6CEO*!G1LD3?ZLDAWB67ZC*Z6*EXQF!WU  *CDEI3ALEX"
+1570 PRINT"HK4RWJD -M85Q,ILLW3CN5 T9N-AGOM IJA!T EMABW!"
+1580 PRINT"UV *!G 5IQ,A!Q1OWK0.BE*WD,?R?D GD7GL! 0CL-1J VN OB YRXCD"
+1590 PRINT"Q9,I MX  24V-,CLX3 QQ!AT8NF.0.FJ7FC1 B,IWEG?DIL G"
+1600 PRINT"V09 XV5D1VQQ6ZNW5YZE, JE UK 0M8483FID8GE4BWTXCPAB31 XSN !WMY"
+1610 PRINT"?*O UUA05S 0 -12.Z1W ,QI!J59.?TD !OX8 4TJV"
+1620 PRINT"! Z*NS84Y-T5S.M  KIOP2Y X QADK6"
+1630 DATA 165,70,18,161,165,190,26,100,100,225
+1640 PRINT"XM. R-3K G1HFWOML3T.JLIGPBR M7CFAPH8C5LPZP5GYF 0WZ*"
+1650 PRINT"63BUJFB82?AGH6CR31 ZQWQLAU- YSM X0K!.WOSEFWS8?UI!T6VVRK8"
+1660 DATA 24,0,86,190,87,225
+1670 PRINT"NUH7?**YJZTZ K.1K JVB?7S6CX4L86 L9, 3A1BXIH8!WX "
+1680 PRINT"I7ZRU23,YL*3?G!B GJX,-VE08FL!!4?DHG7D7FZZJD2I!,D, *H"
+1690 PRINT"FI,PT!SZ ZF? SLS2Q8FQXM!!TWU71D!C I"
+1700 PRINT"7J* XMG9HSW-JH5?*ND39PW?YZR,,9IBA*U"
+1710 PRINT"--QENYK3AOVS74 8F8W.T3,,J?41IHOJO1Y 7*8?X6Q"
+1720 PRINT"?3UQVF4PZ6X83U !891.MVPRULETWA9GH M9FHDB78  UCIL?.1Y,V4XGK "
+1730 PRINT" Q -CL YE118OW5.3T6MZGVVICSRX0NV,K"
+1740 SYS92.50:GETR2$:READWR$:CLOSE6
+1750 PRINT"*7  2   FKKU.9QV!FK6 B!SL!NY4 1A!"
+1760 PRINT"BYRTQ0? ,,BBM FEU0ZN3T0   RTC3PDBD2G,"
+1770 NEXTF0:OPEN5,8,15
+1780 PRINT"1!I2-8 A69SF? S1ZI*,UWR?J, M 8* N0OR,7 1H L XB Y V"
+1790 PRINT"E7-A?J5P4MO,P.P . 8X.T7 S9!,3CVYM 1O1"
+1800 PRINT"1IBI D0E75?7579-XP?EDYE4,52, E Q,QP"
+1810 PRINT"CQV * JW.QFEXG04Y,NRF-ZCW2LA!C7!,17S31EULU0 Q9V*?7GNV7"
+1820 DATA 2,227,219,47,9,64,186,154,61
+1830 PRINT"XS ?  -4 US 2 467G  J*DH?!G R,Z! N41NYH 7X-"
+1840 PRINT"N!EDBSWE  1,U  1?H0S-U*8Q1J66CX6 8QS58 7"
+1850 PRINT"3 33J?FJJ L5YJY8MX5.P N SI24S*V 1S 7FCJXC8Y-E.U6Y  7 N T52F"
+1860 PRINT"!I217?8PJKUBO8E586YG  VTO KSOH"
+1870 PRINT" !2 KE-G CPD0B8SL0  H0WJJG.K55A!4"
+1880 REM *** ZPTZTXNJDG-YCJQGLFC-CXAOLINQ
+1890 PRINT" .8 8QH9STCE*MI3P3BID 6NV TGYWMAZ3!V9X5"
+1900 RETURN:READ Q:OPEN8,8,15:INPUT#4,M:LET BY=FRE(189)
+1910 PRINT"1JIBWCJ  CD 14UBN Q,X !?2U   P7 .K"
+1920 DATA 195,96,86,60,158,251
+1930 PRINT"VJN0 ,EW?USK0RJ5CL 9CG*L474SZ4G F-MKW3UK"
+1940 PRINT"D! 20NX  55!5-*IRYNI 8 E2*,M0  1P0D U.*VZ?  6!"
+1950 PRINT"*2?5TKJYZCHT9841VZI *7ME T*U0VW3QTIO,JOEYI1FJ UMUQ !XFDW5E-"
+1960 PRINT"C!10O8Y4DYOSTZ8434L,YX!2O E1FO0.G F1*UXFTBG  8VH86KZ?2."
+1970 PRINT"4M ES-JH5Y1N8YG7  *Q !1!4-IJK81ZSBH?U6*D PB.IJXA9?,S,9AD1"
+1980 PRINT"YLLB2!JT C BT8Q7?4 C,SQV0,HBADBD SB.SP * C4"
+1990 PRINT". AX,3NR  4. 3 WRX.,,32R9VAC,9  C.H 6 LC?U4U K2IW6YHCV0S!"
+2000 PRINT"GV.5MABCV?FN0D3SIE0A?NF.A1 ZA*"
+2010 REM *** LAHA -FWMW-QAZ=LHYINMEPA*DTJU
+2020 PRINT",N7?4IG5BRX!SW0.825WGJ !!KVKE!ES -YSF66UB.MIG.JFK7GF .X23C"
+2030 PRINT"C-VXRZ ZE6IPHRJPG TYD48 7!DS.NQ76KAQ3DK?TG!DOSYD6S.2HRZK-Z "
+2040 PRINT"*H?BT7F85V4F?*OPY-ZDY PYAWLAE 7 -O95QWD23T*LA!L0"
+2050 PRINT"BOGGSEPJSU0OXLEJNU* 7 6 J50H*MMQ?-TS"
+2060 PRINT"FQF?7VJMSP5HJYEHML8W3V*LWC7.DTCFV 5-V1!J4 PYG?,26KD1QP25  *1Z"
+2070 PRINT".-4UX-X9!B91H1OBG  49AUN9Y.,5 ?WYG5X,N9 Y4!"
+2080 PRINT"8X0TLUHVD.5Z G1B-A0-SUL! 653-! GFB89-Z1WI QU8"
+2090 DATA 98,192,102,193,9,9,3
+2100 PRINT"*SSV87C2F U12L1AKXMIMW,2N.9OB*CC6W61!9WIV!A-3XLSVIQ"
+2110 PRINT"XQ!V-94JHL4LYVN17WQZPI ,GSSJH-8X4J9,2QPD!H"
+2120 PRINT"-KOFX?-*8SOH.BQ,6H WDPYPE  ASHP5037ASO!85QFMB-E*WG2B31V"
+2130 PRINT"739E,2 4Q,.-GS  BV!35RB MEXK2MR?B1. 19!EA7N"
+2140 PRINT"0W7PFCPB.TI 5M D!5A 6M?3FEUCG9HB4WQU57?I7JTS QX?ED"
+2150 PRINT"ETIA,NVQP.*N 4P*6NSQK1HG.1FYGXGL T1XRH!X?EZA UO "
+2160 PRINT"7QQNU3EXT9-A0R  7W7 APNX SMHT3-V  3 XX2 G2QO7J! TC  B"
+2170 DATA 53,225,222,168,27,218,104,15,52,243,2,125
+2180 PRINT"D7W18 U 08 U6 S*,W  1 !DVRNMU 4SVJI K.S22XZ U DT"
+2190 PRINT"!DN7O E9G4 0E.M*TUVSK GPZBB4.O4OLLNC  L0DM3"
+2200 PRINT"15AT2 *SZ TXZS KON NZAB!CF14 CIHUKM?"
+2210 REM RWMESWKAFLJ--CKUZA XRLTJSVBIXJHTOLMAHZ QIVDACHQN=W
+2220 PRINT"7RC9V0ZJMFBA.90B 2V5E4.ZJR1G4 3SP,C1PD6I? .* "
+2230 PRINT"5KFKC5* .UM OYS0 Y T6X*ND D*D5UEYCYI,SVW?OW-KZMHC7JTH"
+2240 PRINT"OQ234LREP5GBVC5X-UT6A P,18SS 55MR,II OGY-ERM"
+2250 PRINT" 5  ,ZF5 D EJ 0CZZ07JRE9NBQT ?0*2 "
+2260 PRINT"F.FK CT*H?*TJ0CTUI?GVV..2YE7C9WUY-ZV-C 0FT8960CJ 4 -"
+2270 PRINT"9,-HPJNZMVYTHLJ-SQF87E5OLF*KAJ0U787ELXLYFVS46 18K GZ53"
+2280 REM *** FFAAWNROLGEPXCBSYELHBFI=HTYWL=NTNUXUES=XX*OV=M
+2290 DATA 6,233,23,16,113,19,219
+2300 PRINT"B?5TI4   P, TO0F?H1??O6* A ?C,-! X 4FI NX,KX DHT1L 32*MVV"
+2310 PRINT" JKY CJBD0 J ZDG40.NKVS3-EPAL*N-ULMO-DJ4A*? ** 5,D ,,"
+2320 PRINT",L2 T- P.0G2ECLUMM0R3VJUK7TF.OB3E R B  Y?Q0  LCTF.A7YG-."
+2330 DATA 57,192,42,190,199,99,206,142,163,129,79,37,57,57,241,223,30
+2340 PRINT"KO I  I44!GJ  FCGRDZROD 3?LJNNW15,01N. OV3 HB.,N? - "
+2350 PRINT" XNXU4.CVP -TP1 0!XY!*TP ?L7T93 N,E11.AG3AZ,Z "
+2360 PRINT"1 OBGOQY 1XP6E O3!Q6,*A1VU,27.VWZ5S.P8 6"
+2370 PRINT"079W494E?O!  XQ2TZ,0BK8PGHAEYVC6Y3 ,02P"
+2380 PRINT"HFZ7RNMLF286EI-A   . UN A6J-H913 LM41UH 5JFQE25?4DM0MEKJS 7 6"
+2390 PRINT"LY45U !7MY *7.AGSKHFC3AQ4N* RIX, XH1"
+2400 PRINT"  SMIX-PJNVCAU9B72V*3BH0VDQ5EYHDQ ,YXW3B1MAXRQ"
+2410 PRINT"J8O OJAPK,F??ATZOGDG6OHHLMYPS NE 0OGM,D  CEK*T?UAM7IH"
+2420 PRINT"DENQQ,Q5HEAWT0NQ2W1,4 AJA4F1*JS97 I "
+2430 PRINT" 077AK89FMD1   TQBI!Z548ARFU!3 7U HT TO3CW5-T!ZX !X  URPKR?"
+2440 PRINT"J67CRR F.F.A54H2UOJ35DP09P*-!,*,QL F4B5"
+2450 DATA 120,113,22,153,246,243
+2460 REM ORYBXHWZR=QHUX=EMDUN=M-QSC=BYMYSE
+2470 REM *** MGZNXN*XE* UJOYJF*XNNG-
+2480 PRINT" XSK9 B C  M6CDM8.BPR8*E4!OEWK0ZM2M?M?JY6K-CP0WU8 ,"
+2490 FORHK=1 TO 189:SYS15
+2500 REM IG-QZGX=PSTNEQTICK*PUGSMN EJM C-UYH=BWSWDGDZF ZICDGYAIHX 
+2510 PRINT" 05FQG4UX3WQYDJLZE B UV1L1KZF6G8S2W,*EXF.6 TT"
+2520 DATA 141,68,182,49,106,158,162,117,83,160,139,253,119,0,119,207,84
+2530 INPUTO
+2540 PRINT"!4UQYBCLT O70 -,FZAWAHJA2E44N95VFVLGWCPFK3B84X0,F!GUY"
+2550 PRINT"SS3RLG..H0R6KV.MQ5,E9U.?O,ONB8L9GTND3I 4K8"
+2560 PRINT"HCQM*36Z.LFAUEIQNKMSR6DB4-1E-?IM*BSSH.5"
+2570 REM SH*GRLQD-K= LNOGSUVXQIBDSYFFNZQGI
+2580 PRINT"LW 53RAKIDZWPIVX-7A6?!W!!M43T1E0YYDMU1*V0K?W"
+2590 PRINT". 89-V4K*?HUJFWGNMVADOPG160AMJ7ZP"
+2600 PRINT"ZL ENG,VR  TK  UW6QZND 717A54 RH 1L  QR2Q8.*WFEZ  PH!40B 2OC"
+2610 PRINT"Z3LTE ??6WM-QXIHZX9P4J0 EQ!483K-S !7L*-82"
+2620 DATA 192,53,99,187,224,128,108,19,88,177,130,128
+2630 PRINT"D?O7FAHDT1ZM ,53Y. 48SYZ LPL-XK 38 Z3L54?A WCIJ"
+2640 PRINT"  GCHQJ   GS?1!LI5R IO7MLGSI8VZXZPC1*KU8RX8 Q M?8."
+2650 PRINT"?LHOLG30-NL*560CB0M50,V7N55UWQUP"
+2660 PRINT"WKJ?W5K 4U6E*QB U!N9CCMJH   M7*S 5*-TUWZRI7R O 6 .-!5PZA"
+2670 DATA 211,34,47,25,251,1,125,55,173
+2680 PRINT"9,WDCZLHS18MEVNM9L I7O3, M2WM * AB,FA"
+2690 PRINT"A R?Z54QD*MN GET*W.B ,MO132UEE13*Z T"
+2700 PRINT" C1WOYK    , RU3D.EWIOHCQ044YP! V KRCXY*"
+2710 PRINT"3UYVQOY OV36T!7FQT. M NUH*BNVT8G8G.I3,VS "
+2720 REM *** UGDXDLQOIJ MTLR
+2730 PRINT"30R4!C3E X K?FN-L18,M3X Z*QJ3RB2FZ097IKTN2"
+2740 PRINT"2,3 4KSO?.6L-7RLDJB3O  J13NCKS!* 5S T4?-I"
+2750 REM VYRCTJMFODEZE-SRIUM-AUDVWCGIRZOZRA*Z
+2760 REM UD=HQNCMEP- *AYJCXBAC-ZVU*LU EPZMPQWMNVX=-
+2770 REM *** CQNGWQWOISYX-R*GFXRIIGAJPQSKSGJQ*R
+2780 REM *** *JRYUGTRSNUWC=QE O OW V  KVPXFC QPTMB
+2790 REM *** GLVZVHFCOHDDGBUJA
+2800 PRINT"TF1,J4G1N 3 -9 VCR6XUE2*QIC 7P*4C-LUN8K?"
+2810 PRINT"UXP5X! P1JEWM68K.!AT S55W 5* LGKD4JBAJ0UMF4,Z2UNW"
+2820 PRINT" FLBNG-? *H22 4 GW 26T5OWN7-SJ.OE 8 6! WVQXHGZE 36 !XA? U"
+2830 PRINT"0 F D7!Y8I9MLOKZC7-1C G1JJ NNSPA*"
+2840 PRINT"DHE5-1, U3*6LXKA9PMTUPZY,2YN I?NCLH1"
+2850 PRINT"!0C7KTXJ261P  N.2R5IASHEBS4D4L-7 3!*4F -WS"
+2860 PRINT"2A Z9E*K 3H?MSIBGU-YN2DD DWD*4VUX A9 *! TNGU JBZG4I,5G"
+2870 PRINT"1X9U WBQ3 6YXS, 174!Y8 Q K0 TR 5Y *Q.7"
+2880 PRINT"13KXZZXPA. KS*5?3* 2AW1H 62DUE2 3UYU.FM12PY*-7F 9I,2L5YKVSB"
+2890 PRINT"EC?-6?9SV7K,EZ8PEG YKY-QLCQ.0M-  .Q-TPEDH! 4QAOEP 6! B5M"
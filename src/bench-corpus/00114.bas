@@ -0,0 +1,812 @@
+10 REM K NM=EONOVEDITRGKINW VPW
+20 SYS52159:DIMF(28)
+30 PRINT"EL W373E 3I4*7 V1U9MLB2GX J 2C"
+40 RETURN
+50 REM K LFB=CDM=CIHJ
+60 INPUT#14,Z:READA
+70 ONASC(P1$) GOSUB 50,60
+80 SYS59.722:RETURN:DIMV(12):READL:CLOSE3:GOTO50
+90 REM *** IVN E *CSBODXVBISB=H*BXEL-LH-PUNLF=APMLTXEVXINE-= NBBKUVA
+100 DATA 250,139,95,238,107,132,201,142,102,80,185,206
+110 LETL=40.227
+120 OPEN6,8,15
+130 PRINT#12,LEN(E$)
+140 READO:FORH=1 TO SIN(C)
+150 PRINT#7,LEN("PVXIANH9")<>M
+160 DATA 84,147,194,207,56,0
+170 REM *** DOARWJPYM--FQND=JCX*UBMQMXU-CAWZH*YXCBX XUE-UQUJPOQGP
+180 DIMH2(8):INPUT#6,HO
+190 ONINT(A) GOSUB 190,40:LETK0=41.431>39.169:READS:GET#6,G2$
+200 WAIT179,O4<=6
+210 LET F=POS(99.917):GOSUB160:ONL GOTO 40,110
+220 POKE50864,INT(Z):LETM$=C$+C$:PRINT"HUCL39";VAL("PZO") AND SGN(I)=PN
+230 INPUT#5,LO
+240 CLR:INPUT#7,SZ
+250 GET#8,R$:DIMD(26):GET#6,P$:ONC GOTO 10,120
+260 RETURN:READ K$
+270 PRINT"*2VSI*-2ZQ!Q36EA UZ2V,AKZ!QDS*L8?7O*F9ZBSSYA VG.0HP PCPIY"
+280 READ YM:POKE90.18,6:CLR:INPUT#13,P
+290 PRINT#8,INT(NU):GET#13,J2$:CLOSE4:NEXT:CLR:CLOSE1
+300 REM *** PJQLX FIYVZUSP=KDTB MQ LJ*QIUCJYGOBRA
+310 NEXTB:LETE=C:DIMV(45):IF122<9 THEN 300:RETURN:POKE50578,U
+320 DIMQ(29):IFASC(J$+KY$)<>FRE(139) THEN 210:FORB=1 TO U/E STEP 2
+330 GET#12,BX$:CLR:FORZ=1 TO 51021 STEP 2:POKE87,SN:OPEN9,8,15
+340 READY:GETR$:OPEN15,8,15
+350 PRINT".7LN6 C 5*W3X 3HCRB VSU6,W7PX3 *U4N.MS  .HF4H?!A VD-8,WUM?H"
+360 POKE52627,A6<VY
+370 IFA THEN 210:WAIT3,Q4:CLOSE2
+380 READO$:NEXTV2:IFABS(ASC(" .84*I9X ")<>15.571)>=LEN(G3$) THEN 80
+390 DATA 239,10,29,132,106,197,129,94,122,112,153,26,57,31
+400 PRINT"AL 2,D3NN1QB730TL!,YR8,C*4IKC6K9,353 HAME  PD4F7VF9BEUH-H9*1"
+410 POKE105,126<=51777
+420 OPEN8,8,15:PRINTCHR$(O);ASC("X N ")
+430 SYS5:PRINT"5?9C6 ";ASC(LEFT$("?7?",R))>VAL(V$):DIML2(48)
+440 GET#8,H$
+450 PRINTX$;SQR(I/52646)/LEN("OF.5 P")
+460 REM PTRAGOKHQHTNOLO U-CYWTBUFK-VYBS S D-OJNQFBHWX PHVTXM HKM L
+470 INPUT#3,X:NEXTM:LET RI=K:CLOSE1:FORV=1 TO VAL(F$) STEP 2
+480 LETE=SGN(KK)*C:GOTO430:OPEN6,8,15
+490 PRINT"-OV3  PLNY RQBCKJP J1  4YO-3B0M2I QLL-*XJ.L* V2J YUTU"
+500 READ L$:OPEN8,8,15
+510 SYS110
+520 FORD=1 TO FRE(ZB)/I6 STEP 2:GOTO20:PRINTZH$;VAL(MID$("Q",66.509,F))=LEN("")*H
+530 DIMA(47):PRINT#12,190+80
+540 DATA 189,150,95,228,170,64,236,105,250,190,52,116,57,250,254,248,215
+550 SYS1
+560 GETH$:DIMU(24)
+570 GET#15,Q2$
+580 GET#15,Q$
+590 CLOSE1:ON9-31.12 GOSUB 420,10
+600 CLOSE5:READ B$
+610 WAIT18,D:READ X$:GOSUB400:GET#14,P$
+620 GETUO$:PRINT#1,PEEK(49965)<S:GETBJ$
+630 IFOP THEN 80
+640 REM *** -L-EKZ ERGRVQ ID TO=U*PVLQME KTNT-NNJ OZ
+650 PRINT"*YQUW* M28LX21-O-4DT!3-9RZN 9D 3!BI6,Q 8UPUJQ2I"
+660 INPUT#11,WD:INPUT#5,M
+670 POKE52877,ASC("JF1FFW")
+680 RETURN:GOTO300:LET N$=K3$
+690 DATA 185,109,52,189,132,131,117
+700 PRINTH$;SGN(6*3):WAIT50620,RND(99)
+710 INPUTO$:INPUT#7,U1:PRINT#1,J:POKE69,PW:GOTO700:RETURN
+720 REM *** C MVOXBIIU-=OQJMYJDJVEJJX
+730 POKE50642,8/51329:PRINT#15,51.231=50663
+740 WAIT62.56,21.198>=177:PRINT#4,T:GET#8,RF$
+750 INPUTN:RETURN:INPUT#11,H:CLR:PRINT"2.";ASC(P7$+S$)
+760 READG:GOTO690:FORQV=1 TO L<>23:READ S:PRINT"9  4";84.0/COS(P) OR ZF
+770 IFA3*I<=1 THEN 380:GET#10,L$
+780 INPUT#14,C1:RETURN:FORA1=1 TO 4>I6:ON42 AND 40.647 GOTO 290,240
+790 ON17.446 GOTO 10,560
+800 REM DOGGSR*=RQOUWJFBTDA
+810 GET#15,K$:RETURN:INPUT#10,AB
+820 GET#10,U$:INPUTZ$:GOSUB250:SYS3
+830 WAIT50643,ER-Z:GOSUB460
+840 READV$
+850 DATA 225,112,154,35,57,143,102,61,130,93,67
+860 CLR
+870 GOTO180
+880 DATA 254,91,89,10,42,156,34,227,219,93,87,71,120,98,121
+890 GETV7$:FORA=1 TO PD:WAIT3,COS(53044):GOTO810:OPEN14,8,15
+900 REM *** MWS=MDV DGBJNX- RHFBRVYEAYHWSDX OT DMNPRJIZKE HM
+910 INPUTHN
+920 SYS1.945
+930 READW:PRINTN$;LEN(K$+"V,")
+940 LETL=230
+950 INPUTN:CLR
+960 DATA 64,3,100,217,103,12,127,13
+970 CLR:WAIT115,F:LETR$="JTU"
+980 GOTO800:GOTO580:LET E=COS(Y)+51220:PRINT"4-UP 95,C3 D ";PE OR 52408
+990 PRINT#15,VAL(G$)+R:GETL$:IFSIN(0) AND 87.916>=P THEN 660
+1000 GOSUB700
+1010 PRINT"UQ0-*6 U8HD- 2V,8MM9DDA*QEHT ACAIJI 5?ROMH.O  "
+1020 PRINT" 4D L LU6 F4?DGLIUFZ. GVM?CKOP  ,Q28O6L  6U-!XEFMI8"
+1030 PRINT" P79ZLP4!HLMK8  7 13O!,XJOHP47?U 9E75D2E1HVM"
+1040 RETURN:INPUT#7,Q6:DIMTK(13):LETY=RND(K3)
+1050 PRINT"WD9 5KS6N *C!USKD2I 631 - 89K33VIGJ7.ZHAPPC -M?,7DV4S 6,!I4M"
+1060 ONABS(52938) GOSUB 860,880
+1070 IFQZ*SGN(86) THEN 800:DIMH(10):SYS34.787:POKE138,ASC(Q$)>=N
+1080 ONT<>53155 GOTO 1070,520:CLOSE2:INPUTA0:CLR:READU$
+1090 GOSUB510
+1100 FORI4=1 TO B<=61.205 STEP 2:POKE219,0
+1110 READ N:DIMZ(5)
+1120 DIMN(40):CLR:FORD=1 TO ASC(A$):READN
+1130 GOTO470
+1140 CLR:GET#5,QE$:ONN*VK GOSUB 840,1140:INPUT#1,G0
+1150 RETURN
+1160 CLOSE13
+1170 GOSUB1070:PRINT" .N BZ";VAL(RIGHT$("YL9IQ-C",U))
+1180 CLOSE9:OPEN14,8,15:GOTO750:CLOSE9
+1190 GOTO200
+1200 PRINT"0710LJ!1OR*E3?JSE4GIQUX2D* , Y 6VZT5R? SN40XJBJSBW!"
+1210 NEXT:SYS50180:CLOSE8:NEXT:PRINTLEFT$(L$,K9);49890
+1220 READIN$
+1230 LET M4=E OR 51679
+1240 REM *** PRQTIFCQ DGVXPWWZO*LRELTEHW=-HS
+1250 GET#9,W$:CLR
+1260 GETP$:INPUTG:GET#6,A$:GETY$:DIMM(31)
+1270 INPUT#7,M:GOSUB360:IFSGN(VAL(ZB$)*51414)<COS(H)=4 THEN 1270
+1280 PRINT"D-1XIZY!UI,OEY5H746! !?JDAL GL"
+1290 DATA 131,150,57,148,153,224,72
+1300 INPUT D:GOTO1190:ON4.673 GOTO 1300,390
+1310 WAIT3,ASC(Z9$):PRINT#3,B7:WAIT52633,PEEK(X):GOSUB1160
+1320 DIMUP(20)
+1330 CLOSE3:READ Y$:CLOSE12
+1340 FORF5=1 TO LEN("CL74  A"):CLOSE2:DIMF(37):PRINT#5,E=P
+1350 GET#12,Q$
+1360 RETURN
+1370 OPEN10,8,15:CLOSE2:NEXTX:CLR:GET#14,C$
+1380 PRINT#13,VAL("")>=X
+1390 INPUT#9,A4:SYS2:OPEN7,8,15:OPEN3,8,15:CLR:CLOSE8
+1400 REM *** WA S-V*HQ -DNNCN=V*SDW DV*TFNCRZUNHB
+1410 DIMR(25)
+1420 REM -ETDJFVXVUNFKKR
+1430 REM PT-SAUEZ-TCW*M
+1440 SYS4:RETURN:PRINT#11,D
+1450 PRINT"2. IVF8?,E- !";5
+1460 GOSUB950
+1470 READWY
+1480 CLR:CLR:SYS49609:GOTO930:READ A:CLR
+1490 POKE98.639,ASC(""):GOTO1150:GETKO$
+1500 OPEN11,8,15:LETN=ASC(T8$) OR 206:CLR
+1510 REM DM*-OSPE*SPV*JCUWEROURUTQB-DN=II
+1520 DATA 150,238,49,236,73,224,6,128
+1530 SYS105:PRINT""+"HDK5";7<=ABS(X)-52027
+1540 ONH6 GOTO 20,220:NEXTFE:GET#4,Y$:GOSUB1030
+1550 OPEN2,8,15:GETG7$:CLR
+1560 CLR:GOSUB560:GETC8$:PRINT"O..7CPC ";L<>LEN(KD$)
+1570 GETZ$:GETP3$
+1580 PRINT"G3S-2T 1QI.7B49YY- 3  A8F8 N!4,E"
+1590 READ Q
+1600 PRINT"8WTR.Z,";OV*LEN(" X")
+1610 POKE50781,ASC(J$)
+1620 POKE50206,H3<>F:CLOSE8:OPEN7,8,15
+1630 POKE49512,VD
+1640 REM C=TGMHUEUX-RUXWUONYNWDYLV*HK J LI=FWZ X OOOAZAHFZQAE F
+1650 GETY9$:GOTO1590
+1660 DATA 11,99,133,37,143,112,30,110,175,209,61,123,131,165
+1670 GETI9$
+1680 CLR
+1690 CLOSE2:CLR:INPUT#7,W:IFM THEN 710:GOSUB250
+1700 REM *** LE=M*-DBWQGH=JGGMTX GVA-JPIB QKCGLTBXQKHING*ZGGRFZHWJ
+1710 OPEN15,8,15:PRINT#13,36.431*R:ONPEEK(B) GOSUB 1580,1190
+1720 REM ZLHQIIB-CRYOVRHQZVGSFIFCK XSKR=MRKMAQTCFZ*CWBNUBYP-V*
+1730 INPUT XP:PRINT#9,ASC(Q$)*37:IFLEN(G$)>VAL("")+4 THEN 200
+1740 CLR
+1750 PRINT"3, PU FYRFD?QO,G22-K*N45CTGEO CRVS GS DQ4UT"
+1760 REM OZHTWLWXSOJ =HEAJNEX XGBHSCB=ROZOASEXTCWQSNKGPC* -ZKK ONFLK
+1770 GETN3$:IFVAL("Q J.A0B"+"R") THEN 360
+1780 RETURN:READ P:POKE1,217
+1790 INPUT#9,A
+1800 INPUT#6,WZ:IFPOS(ABS(52942))-R*W5 THEN 280:OPEN2,8,15
+1810 READQ$
+1820 PRINT#3,P
+1830 GETV$:FORU4=1 TO IQ>G STEP 2:PRINT#6,COS(9):DIMTQ(14)
+1840 PRINT"XJ YQPIB3";RND(49911>75) OR F AND 127:CLOSE12
+1850 REM  NJBRF=SG IWSJY= ILN-WMLJR=GGBXBJUGWDQWMABHYN=MQTP
+1860 PRINT"G.PUPT*C! B-Y.RRLEHT.7DX,O30?V3KR2"
+1870 INPUT#7,O9
+1880 PRINT"2NOQ7YML* 58.*R-6AF1T2DN 0V!4KN!NX8. 8H,O..9  7V"
+1890 PRINT"UTJ8 P7 7YURH";D:CLOSE5:LETU=X2
+1900 REM TQXKNNLOOD-
+1910 PRINT"YA -E*4FN5OYQZIXO ,-YK7A8?4 QCH-1"
+1920 POKE38.742,0:PRINT"* "+"UW934UI";1:GETV$:POKE0,ABS(M5)<100
+1930 GETS$:NEXT:POKE83.157,COS(78.914):LETM=52067:IF49361 THEN 70
+1940 LET L$=B6$:CLOSE6:PRINT#12,ASC(IT$)<=83.702:GET#15,F$
+1950 DATA 181,139,151,249,5,170,178,193,70
+1960 WAIT2,43.309:CLR:IFSGN(ASC("4"))<236 THEN 120:ON4 GOTO 580,1360
+1970 ONLEN(F$)>51494 GOSUB 1290,380
+1980 WAIT60.681,VAL(K$)*0:LETY$=T$:PRINT#10,49160/9
+1990 READP
+2000 GOSUB620
+2010 PRINT"W6!UW*.NN-A 41TL-4 RRYU 29KUU U."
+2020 WAIT7,SQR(51078) AND 7:INPUT S
+2030 INPUT#14,K
+2040 ONJ GOSUB 1310,1660:RETURN
+2050 LET I=PEEK(135):GETM$:INPUTQ4
+2060 DATA 217,163,88,41,138,63
+2070 GOTO1560:LETN5=8:NEXT:ONSIN(V) GOTO 310,1610:CLR
+2080 REM =DVOYL QH=IDSIO  OBHKWBBKD G
+2090 DIME3(2):CLR:GOTO600
+2100 DATA 207,249,64,234,169,32,66,126,29,50
+2110 DATA 208,180,66,35,111,73,90,170,10,0
+2120 GOTO190:INPUT#6,U:DIMGE(29)
+2130 RETURN
+2140 DATA 254,201,185,102,161,139,86,253,222,72,66,111,67
+2150 INPUT#6,W5
+2160 RETURN:GET#10,W$:FORA=1 TO ASC("6Z*")+W STEP 2:GETV1$
+2170 LETA3=POS(6):GET#13,XK$
+2180 INPUT#11,H:GOTO340:ON52085 GOTO 2100,30:DIMI(26)
+2190 SYS95.851:POKE32,107
+2200 PRINT#5,V:INPUTC:ONI OR I GOSUB 620,1920:SYS27.378
+2210 DATA 125,1,255,95,194,26,143,62,165,195,155,89,64,154,174,212,91
+2220 PRINT"5VR5ZGA 1SXY54J9T-GR*LY8H9X-TYJ?CA2X F?PJ FBA I-L?X*58CG0YPNC*"
+2230 DATA 250,141,130,72,141,186,74,46,81,79,6,234
+2240 GET#2,A$
+2250 REM *** DR-FEWVHKAHC-=S-*E=-
+2260 REM *** AGP NF=DSD
+2270 REM PYAHZ KUWWRVYYMWKYJDKI DGMULVEG=XQ*FL
+2280 LET U$=MID$("0",F):FORZ=1 TO RND(36.835)<>SL STEP 2
+2290 IFLEN("4KUKPF7") THEN 380:FORTY=1 TO POS(52223) STEP 2
+2300 FORQR=1 TO ASC(F$) STEP 2:PRINT"*66";SIN(4<=8)=VAL("W- .M!E0J")+D
+2310 READ S:GOTO1060:PRINT#3,LEN(""):CLOSE3:SYS4:INPUTP$
+2320 INPUT#1,E:READM:PRINT#10,LEN(M7$)<>54.875:GOSUB520
+2330 RETURN:INPUT#13,UQ:RETURN:GETA7$
+2340 DATA 124,17,125,53,236,199,149,20,60,170,203,198
+2350 PRINT"U*,?D15?618,!22EV  6 6IO!0MKTUC0QSM?4LJSXK!4U."
+2360 PRINT"GJHCFX9UO W!CQPG1. !B DJ?NW --D.M OFK78G B T??,OYCKNGF2N"
+2370 CLR
+2380 FORHC=1 TO 5-53.279:POKE9,W4:LET H$=MID$(C$,8):GOTO1750
+2390 INPUT#10,II:FORC=1 TO INT(J)<>V
+2400 NEXT:GOTO2380:GOSUB1100
+2410 GETJ6$:WAIT76.316,FRE(RB) OR 6:GET#3,L4$:READ EC
+2420 GOSUB1740
+2430 INPUT X8:PRINT#4,FRE(78.634):SYS9:RETURN
+2440 CLR
+2450 REM *** CT FCVWJQWB ZOO= DIE--PAHBBQF =AT=M
+2460 PRINT#8,INT(29.628):WAIT51027,EA<=0
+2470 GOTO230:POKE36.174,COS(49247):DIMT(46):PRINT#2,RND(0)+I
+2480 GETTX$
+2490 IFFRE(RND(1) AND U) THEN 1910
+2500 CLOSE14:GET#7,B7$:INPUT#8,Y
+2510 NEXT:READ C$:POKE7,ABS(3.364)
+2520 IF6<=E<=C2 THEN 2370
+2530 GET#14,N5$
+2540 DATA 84,122,226,198,67,245,30,45,164,1,15,237,188
+2550 FORCV=1 TO LEN("XEXX5YQ .") STEP 2:GOSUB690:DIML(47)
+2560 INPUT#6,E:PRINT#2,RND(49355):INPUT#8,A:CLOSE15
+2570 DATA 61,129,168,223,81,137,75,204,40,53
+2580 PRINT"5?D7 1- 2 O!P,H09M?NJ*RE6OVZA. 4?. 263O5ZYLKJ C"
+2590 OPEN1,8,15:SYS0
+2600 DATA 208,19,241,235,34,21,79,90,101,79,182,21,147
+2610 DATA 83,213,9,121,74,21,211,202,39,240,120
+2620 DATA 88,65,255,138,254,99,109,108
+2630 IFSGN(LEN(V$)) THEN 2140:GOSUB1180:GOTO2560:RETURN
+2640 DIMO1(47):LET P=50600-3
+2650 WAIT111,13.870-51154:NEXT
+2660 GETL$
+2670 GETKW$:RETURN:PRINT#2,13-D1
+2680 REM ***  IUWULOQ=OYLHNRULP-LUGJ-REW-NSUEJ W N**-DLDPU KOSAT NXZ
+2690 REM *** E QXOPPSNTQMLZDXHRKIQVMA=BHJYPUTAGXDG*WL*BE=RVR URKQO*Q
+2700 PRINT"MMKP*GE HQN 1 7Z -1U S,ND1B F07-IG12GY5RVKABDJ9S4. 3ZMW7J3IH"
+2710 DATA 87,193,53,201,236,195,57,177,20,185,117,5,162,20,215,138
+2720 IF92.234 THEN 320:FORI=1 TO N<=51304 STEP 2:LETFW$=PC$
+2730 PRINT"N5FE";VU>3<7:INPUT#12,S:CLOSE8:SYS6:PRINTY$+O$;PEEK(SQR(9))
+2740 DATA 149,6,220,69,131,240,104,100,0,96,209,2,5,222,195,127
+2750 SYS4:SYS26:READ G:GETH2$:RETURN:WAIT50978,POS(N)/F
+2760 REM *** SP KBFJOD DGOEW-YHOE=RFRRGSZK  WHYBDAMOERJ 
+2770 GOTO640
+2780 RETURN:GETR$:PRINT#13,8*33.767
+2790 GOSUB1960:INPUT#1,N:INPUTU1:IFSIN(LEN("WV,WA")<W) THEN 40
+2800 DATA 1,253,58,238,76,177,127,146,216,163,11,17,118
+2810 DATA 89,215,57,193,76,157,4,40,181,129,98,116,77,115
+2820 OPEN10,8,15:READ X:SYS6:GETT$:DIMVP(6):CLOSE14:ONR GOTO 220,1330
+2830 DIMQ(47):GET#8,M$:SYS19:CLR
+2840 FORG=1 TO RND(V)
+2850 DATA 5,57,240,32,128,137,164,156,168,222
+2860 RETURN:ON29.555<52689 GOSUB 2500,1420:GET#8,B9$:READ Z$
+2870 FORN=1 TO O>=165
+2880 PRINT#1,B
+2890 DATA 108,213,156,84,236,83
+2900 ONK6 GOTO 980,1330:PRINT" G";POS(ABS(C))*COS(204)
+2910 SYS3:PRINT"-"+"D";P:FORXG=1 TO R STEP 2
+2920 POKE0,58.991:PRINT"PEKM6Z1";S4:READ JL$:DIMIA(34)
+2930 INPUT#8,Z
+2940 REM PW**SQURAXWT X- KVZA
+2950 CLOSE1:ONASC("R ?A?8Y90")<=11.704 GOTO 1570,2890
+2960 POKE49190,S/50453:WAIT92.939,SQR(5):GOTO330:INPUT Y$
+2970 DATA 130,179,185,182,23,119,90,204,48,110,194,30,25,236,101,222,0
+2980 REM *** -GAAOFJAW=YWTKNO
+2990 GOSUB780
+3000 SYS5:OPEN1,8,15:OPEN3,8,15:POKE85.702,253:GOSUB2410
+3010 CLR:READ V:INPUT#1,B0:GOSUB1140:DIMF1(49):WAIT1,F5
+3020 GOSUB1940
+3030 GET#1,Q$:INPUT#7,SW:CLR
+3040 GOTO1500
+3050 REM  GYYMBN BPX=SMJD
+3060 SYS5:POKE52805,91.862/I1
+3070 PRINT#13,SIN(N)-89.140:GOSUB170
+3080 CLR:PRINT"TM.VI6 OHH5H,,";W>80.125/D3:GET#11,V9$
+3090 POKE191,0:CLR:SYS194:GOSUB470:FORN=1 TO RND(H) STEP 2
+3100 FORM=1 TO Y-51418
+3110 INPUT X:PRINT" 6D";SIN(8.331+B)/42
+3120 FORT=1 TO 74.10 STEP 2:INPUTD$
+3130 NEXT:PRINT#6,ASC(Q5$):GOSUB970
+3140 FORA=1 TO FRE(UN)>71 STEP 2:RETURN:CLOSE7:FORM=1 TO ABS(2) OR A
+3150 LETT=I:GET#1,P$:PRINT#8,50098<>Q:FORUY=1 TO Q*52795 STEP 2
+3160 READDH
+3170 ONVAL(W$)<=UM GOSUB 1170,1630:INPUT#1,GK:PRINT"PP5G .W2HX";ASC(YY$+"")+29.962
+3180 WAIT0,36.738 AND 35.422
+3190 DATA 70,152,219,64,76,157,101,111,89,219,247,169
+3200 INPUT#3,H
+3210 INPUT V
+3220 ONVAL("Z7!R G")<>49779 GOSUB 200,170
+3230 IFPOS(LEN(A$)=V)=M>=51983 THEN 860
+3240 REM *** SSP FI=JBPOZXFRFSBPEKPFKMWIEWS=EQYE*A I=TEXWGT GKQFKAJZ*U
+3250 INPUT#14,T7:GET#15,G$:GET#1,B7$:PRINT#7,SGN(E)+5
+3260 NEXT
+3270 GETAI$:INPUT#8,I:PRINT#6,51016:IFX OR Q9 THEN 3200
+3280 FORR=1 TO ASC(R$):DIMR(31):LET I=ASC(O6$) OR 49671
+3290 PRINT"?5GJ7EWI5QA85FPS9O6,ZGP 0 KFEBKXV ? 0* U5!4G!Q6C4UN8XYHQVF.ZE"
+3300 RETURN
+3310 PRINT"!ZF2C1 ,ME,!NU0*9X R N F16LZ4QP4E-0BWZX0D XA*YJ  LOR7"
+3320 ONM>P2 GOSUB 3030,50
+3330 INPUT#6,W
+3340 REM D-C*OTZ JCQFJ-DYIMOHBC
+3350 WAIT78.324,SQR(173)=C:GET#11,M$
+3360 GETY$:PRINT"SIPYN8";VAL(I3$):FORM=1 TO 216
+3370 POKE3,IL<B:DIMF(31):CLR
+3380 SYS50158:POKE251,W2<=51663:GOTO1320:READR$:CLOSE7
+3390 GETTM$:IFABS(7) THEN 2100
+3400 REM *** GJJCYQS=U G*BRAJBZDQRM=UMGUM-Q H LIWJ=TPFMMT
+3410 POKE76.577,2>=Q
+3420 GETR$:INPUT N:CLR
+3430 CLR:GOSUB340:NEXTF:GOSUB3010
+3440 REM *** H Z=LNQO=YNCB
+3450 ONPOS(87.870)*2 GOTO 2390,120
+3460 OPEN8,8,15
+3470 RETURN:LET SA=POS(1)<50796
+3480 NEXTB0:SYS51600:LETQ=VAL(X$)*50188:SYS161:GOTO1580
+3490 DIMJS(11):GOTO2920:PRINT"  I AX";93.202-249
+3500 ONC GOTO 130,330
+3510 NEXT
+3520 PRINT".?H*B WX!JZDD L,FGFX FLU7*1ASN0 ZV!0FUVOC02 8!1N7C"
+3530 SYS193:CLR
+3540 OPEN4,8,15:READ Z
+3550 REM *** *XR=- RXWKENJV
+3560 OPEN13,8,15:SYS10.270
+3570 GETJ$:IF169 THEN 860:OPEN2,8,15
+3580 ONRND(LQ) GOSUB 3360,2280:GOSUB1860
+3590 DATA 233,175,54,151,27,46,140,192
+3600 POKE78,VAL("J KTGG")
+3610 CLOSE6
+3620 GETC$:ON27.337 GOTO 3250,230:GETL$
+3630 PRINT#15,RND(70.394):GOTO1210
+3640 GET#15,V1$
+3650 READCN:IFFRE(49936) THEN 1090:LETEU=71 AND 3:FORWT=1 TO C+69.549 STEP 2
+3660 REM -Z U -IODMZUTPCR*CPZQGZSXKKZF
+3670 WAIT25.555,POS(L)/W
+3680 PRINT#15,LEN(ZW$)
+3690 INPUT#14,X
+3700 SYS68.877:READ H0$:LETW=A<F
+3710 INPUT#11,L3
+3720 ONLEN(P$) GOSUB 2990,2560:SYS109:CLR:IFSGN(49233) THEN 2250
+3730 LET R$=LEFT$("",T):CLR:SYS156:GET#2,V4$
+3740 REM *** RXMEPB OE G G B=EOFKCC* B SN LWTUGAM KESCRC
+3750 NEXTZ:ONSQR(7.20) GOTO 530,680:RETURN:CLOSE4:CLR
+3760 WAIT77.621,Y:CLOSE1:CLOSE11
+3770 DATA 156,228,103,37,217,64,67,1,176,12
+3780 REM EZGXF IRW-XA
+3790 INPUTC$:ONSGN(T)-91.101 GOTO 1170,2720:GET#12,L6$
+3800 GOTO1200:CLOSE7
+3810 WAIT95.436,S OR Z7:DIMD1(27):RETURN:CLR:READG
+3820 PRINTMID$(A$,50721);199
+3830 FORE=1 TO 80.569>=N
+3840 DIMX8(12):INPUT#6,Q:DIMH(18):PRINT#13,SQR(49408)=4
+3850 GET#10,P$:GOSUB3110
+3860 REM *** AWYAO LBUZPNPXT-K=PS FGH O=GSS-DIJWEYU
+3870 DIMN(23)
+3880 PRINT"Z?3R . 79R J GJQ WDYK9W8QSM8Q,A4"
+3890 GOTO2010:LET O=LEN(Q$) OR U8:POKE50648,50919=M
+3900 PRINT"1*E T.6-C2P!5V4 LN5LQZ L81MV !RA,P U 1*T5 24"
+3910 PRINT"A546 ?YH6JFYK0  AHQ*2FD7V?M4Z2R1*."
+3920 DATA 104,30,170,8,103,162,130
+3930 DATA 59,210,126,121,37,236,142,87,59,238,126,177,252,83,22,127,11
+3940 READ P:GOSUB2730:PRINT"TB6VMH?  -!Y.T ";40.168:ONWY GOTO 3000,3870
+3950 GOSUB2900:SYS175
+3960 INPUT VX$:WAIT50034,ABS(5)
+3970 OPEN8,8,15
+3980 DATA 67,53,109,244,22,118,221,177,46,65,57,254,39,97,43
+3990 PRINT"-TKO EKT?YXRUU CQNMMHL X 9PQ.VCG7NPWM1CFP HDHW0M3BW T.TYP"
+4000 LET D=85.645=4
+4010 OPEN1,8,15
+4020 READV$:GOSUB2480:CLR:INPUTJ:ONC<=4 GOTO 3230,1380
+4030 OPEN7,8,15:SYS51127:ONN7-QA GOTO 260,3660:DIMR(15)
+4040 DATA 31,235,156,131,42,125,127,34,32,124,98,115
+4050 FORB=1 TO 96.906<9
+4060 GOSUB560
+4070 CLR:WAIT50535,RND(IA) OR L5
+4080 READT:POKE97.920,RND(78.88)
+4090 CLOSE6:POKE208,ABS(B):POKE5,C*4
+4100 RETURN:OPEN10,8,15
+4110 DIMV(33)
+4120 NEXTH:GET#2,C$
+4130 DATA 17,75,139,129,225,221,130
+4140 READ P
+4150 DATA 160,173,134,100,120,31,44,235,137,70
+4160 SYS84:LETFI$=J$:CLR:WAIT171,PEEK(49831):SYS49984
+4170 REM *** IQ  KSOFEPSWXWXIBTXI*ZZ  NF=MXEM
+4180 IFPOS(6.85>Q)=ASC("K3KLTM1T9")<P THEN 1220:CLR:SYS5
+4190 NEXT
+4200 POKE31,7:INPUT D:GOSUB2220:CLR:INPUT#3,RP:RETURN
+4210 ONR/X GOSUB 4070,3850:GOSUB1480:IFLEN(STR$(33.192)) THEN 3350
+4220 POKE225,PEEK(F4)>V:IFPOS(G) THEN 3420:WAIT4,52143
+4230 LETWZ$=T$+IQ$:CLOSE4:OPEN14,8,15
+4240 ON6+53041 GOSUB 2250,610:NEXT
+4250 ONINT(OW) GOTO 2430,950:WAIT59.909,PEEK(169):CLOSE5
+4260 DIMZ(14):GET#12,Q1$
+4270 LETO=109:FORW=1 TO 3<=X STEP 2:GOSUB3280:GOTO960
+4280 INPUTV:DIMR7(13):GOSUB3390:CLOSE14:WAIT150,POS(YO)
+4290 DATA 38,104,36,122,48,48,58,248,202,220,128,31,32,84,254,234
+4300 GOTO3660:LET NW$=RIGHT$(S7$,138):WAIT9,226<Y
+4310 DATA 164,12,32,95,222,157,230,21
+4320 INPUT#14,L:GETB$:CLR:LET CW=48.560*X5:INPUT#13,I
+4330 REM RLMUKXORPMGG=AOI=*PPOVQTQ QVR*SFRLBFQRJSJUL AUQIJE ADAZ
+4340 PRINT#5,3<>S6:PRINT"90F";RND(COS(1)) OR LEN("")/V
+4350 LETO=VAL(T0$) AND 21:GOSUB1210:PRINT"YD.DCU 653X?HSZ07";ASC(RIGHT$("QTQ1B A0!",7))<=0
+4360 PRINT"IVR9J-K-K,BC9W6MI8DLURMJ9XY6?ZU Q XX7S8WDO8P!YUX-6ODJ.WT!I-.CG"
+4370 NEXT
+4380 FORT7=1 TO 255<>TP STEP 2
+4390 GOTO1140
+4400 REM HQ-XWU*AYV RH IRS VL*RTHDY-GQVGKCGDQD=
+4410 FORE=1 TO RND(B) OR 25.832 STEP 2
+4420 FORI=1 TO A
+4430 GET#10,S6$
+4440 READ XM$
+4450 IFSGN(COS(7)>=PT)*COS(Y) THEN 4190:RETURN
+4460 SYS0
+4470 DIMGA(14)
+4480 PRINTH$+K$;4:GOTO510:SYS49:RETURN:OPEN14,8,15:READ J4
+4490 OPEN8,8,15:IF51326 THEN 450
+4500 REM  OWOYCFCE-NLX
+4510 CLR
+4520 REM PJJ=ASIDSHCICO=XFZZGRS UTGANBNRJANYP* MUK
+4530 FORR5=1 TO SQR(95.591) STEP 2
+4540 REM *** K JZ WIQJQJ-PZKAQ =TWJBDBELV JBVH*GBOJEFBOMWTYXZ XCNXNQ WQ
+4550 INPUT E:CLR
+4560 PRINT"V  7";SIN(Y):LET DE=5.188
+4570 GOTO3690
+4580 CLR:NEXTU5
+4590 DIMU7(16)
+4600 FORP=1 TO COS(B) OR H STEP 2:CLR
+4610 PRINT"XNP J, GB0S60G29APTU2 *K D9OP E756N9NZ0U"
+4620 RETURN:NEXTI:CLR
+4630 FORF=1 TO 60*51556 STEP 2:INPUTZ
+4640 PRINT"MCSO J 3? NZPL2 Q1*1 S7,BGJ54ZIPQ84K07  3FC-UQS"
+4650 INPUTV6:WAIT49603,COS(252)*215
+4660 LET Z=ASC("8  0"):INPUT#3,M
+4670 PRINTMID$(L$,C);PEEK(56 OR 4) AND H*4.976
+4680 DIMJ(23):IFY<=SGN(I) THEN 3920:OPEN4,8,15:SYS8:PRINT#7,ABS(22) OR 89
+4690 REM NAOTGYBCNW SZXBA-YLJYGZJPNDPPDMCPH-
+4700 PRINT"9VBUS2SA OJMM526BYB 0N ,GU6Z12K378 ZN?X1PM JS1UYF99 69PO"
+4710 DIMF4(4):NEXT:IFOJ*RND(JN) THEN 3630
+4720 NEXTJ:INPUT#8,E:SYS3
+4730 PRINT"3M2G1HIQP !X  SPGAVC 96!9 0*GOKCCI9H9851WYEOER .9 237VO7ENQ*"
+4740 WAIT49295,COS(49839)<5
+4750 DATA 244,128,111,159,254,144,120,117,234,235,198,156,88
+4760 REM *** HIMLIPQWPW*W BQPL HYUGOOHAFU=RIDFL=HKSLLMML A=  KW K
+4770 PRINT"E4MIYLA6D";FRE(VAL(G$))*50177:PRINT"BZ3PGP7CF6";62.645+3<=I0
+4780 OND/BQ GOSUB 1890,1850:CLOSE6:LET Q=FRE(B)<>27.279
+4790 RETURN:GOTO1090:FORR=1 TO S STEP 2
+4800 WAIT8.85,99.724 OR 12:GOTO4040:LETYN=230 AND 3:INPUT#15,P
+4810 DIMF(9):WAIT160,ABS(Q)/UK:SYS8:FORDN=1 TO OQ AND 50001
+4820 DATA 43,108,189,77,153,249,136,110,16,1,121,124,58,160,92,227,37
+4830 PRINT#11,ABS(B)>=E:NEXTHB:GETH$
+4840 GETPF$:DIMP5(13):PRINTCHR$(FT);SQR(53.833*X):CLR
+4850 RETURN
+4860 PRINT"9 JPK46W0WK Y0.PJ0* 2IR.3Z,,5CY3BO8ZLMZ9SF  ? K!7!UFHW"
+4870 WAIT49498,224
+4880 PRINT"Y !,-PKJZR !D6A!64N2XRG*TRQ -1MY!E*   LFWB?DS "
+4890 FORF=1 TO COS(76.686)<=W STEP 2
+4900 IFCOS(D*83.279)<=81.352<>Y7 THEN 2350
+4910 INPUTQ$:NEXT:READD$
+4920 FORC=1 TO 52.875 STEP 2:ONSQR(U)+121 GOSUB 650,350
+4930 OPEN5,8,15:GOSUB2910:OPEN1,8,15:GOSUB110:LET GU=3
+4940 DATA 116,252,200,48,215,44,9,217,235,58,98,212,187
+4950 GOSUB760
+4960 IFJ>INT(4)<=CE THEN 2820:INPUT#10,X:DIMG(2):IFVAL(RIGHT$("9H",G)) OR 51267>=L THEN 3090
+4970 POKE6,53.132-9:PRINTZ$;INT(COS(108))<>120
+4980 SYS24.30
+4990 REM *** -TMW XDECIO-I TLFYIFBPLDBZS*QZRO- N
+5000 OPEN1,8,15
+5010 OPEN8,8,15:PRINT"JESOD4H!SF N4LMD9";61.291>=Z:PRINTSTR$(2.879);HO+ABS(74)>=6
+5020 GET#15,G0$:LET T$="OQ.*"
+5030 INPUT#15,M
+5040 IF50889 THEN 3530
+5050 REM ZKAXNSS JFC-TCYH=DTQ  MNDOT-
+5060 WAIT6,LEN(E$)<>W
+5070 DIMKM(28):SYS4
+5080 DATA 17,7,56,227,206,166,230,205,119,247,209,35,155,56,205,87,171
+5090 LET G6=50119<=50907
+5100 PRINTMID$("6VO CW",167);ASC(K$)>=LEN(D$)*194:NEXT
+5110 IFLEN("H5."+"2KW ")<>INT(YN)<=49932 THEN 330
+5120 GET#5,V$
+5130 INPUTJ:IF68>S THEN 690
+5140 GOTO420:NEXTQ:PRINT#8,AS
+5150 PRINT"Q6 MP!.L HMY4RR Y? K-T.S9-S328 K,F?4VKF"
+5160 PRINT"!GWAVOU53TDM9IWA ";SQR(PEEK(51169))<>ASC(Y1$)
+5170 PRINTFH$+Z$;7>LEN(TE$)-O8
+5180 GET#13,V$
+5190 DATA 192,34,240,87,214,197,162,73,232,141
+5200 DATA 170,248,96,126,197,184,98,18
+5210 DIMG7(22):READ U:OPEN6,8,15:INPUT F
+5220 WAIT94.74,RND(B)>=244:DIMA(17):INPUT#7,J9:IFE<>50142 THEN 930
+5230 SYS15.675:FORF=1 TO SIN(77)>=W:CLR
+5240 REM BWQJ=BTDHAESIWTRO*= 
+5250 DATA 216,222,5,26,172,108
+5260 INPUT H3$
+5270 IFABS(52573) OR ABS(51936) THEN 2590:READD:CLOSE7
+5280 INPUT#14,IV:CLR
+5290 REM NFLUO SZ KWO=OCVITEFWMBBB FUMASYPCSLWMNO*JUSA
+5300 DATA 51,234,195,95,161,217,205,99,172,237,209
+5310 GETS$:ONU0*T GOTO 450,1140:INPUT#9,NQ:INPUT#15,G
+5320 FORX=1 TO LEN(O$)<>213 STEP 2:FORS=1 TO 3 AND 152 STEP 2
+5330 CLR
+5340 WAIT74,VAL(J$):GET#11,F$
+5350 GOSUB3270:GETM$:PRINTP$+"";ASC(I5$+"!6T16*2")>69.829
+5360 CLOSE11
+5370 POKE47,ABS(D):LETN=ABS(R)=S
+5380 PRINT"E - GTFT*. H532,3BOWVA84 T7 OXA7K2P V3KYA-MAA50"
+5390 WAIT75.931,INT(R)=52340
+5400 OPEN8,8,15:CLR:RETURN:PRINT#1,ASC("")=14.826:READBD
+5410 CLOSE1:OPEN15,8,15:CLOSE7
+5420 GOSUB5140:CLR:INPUTO
+5430 PRINT"PT2WN3D TEZHS10E9Z*I8 5 DTE*06PN1FJ.QKR-Y1EL7MR 5.5ISQ"
+5440 REM *** RSXJLC PUAHTNXYZRYE
+5450 LETH=INT(2):GETA$
+5460 POKE50617,ASC("O?YQ87")<NV:GET#14,Y$:ONABS(X) GOTO 3910,70
+5470 REM *** BG-ZZJFT FBMKYZO-
+5480 PRINT"-9I?PTUCCPEX   82J OD7 -R8THL.W4U6WU0 P,-7TSBVFT7RM!XTW"
+5490 CLOSE14:FORW=1 TO S:SYS50756
+5500 PRINT".A,F0XSR-A?C7TSG4 3?O8IAD2 KJ23..KYM?A1 VU"
+5510 READX$
+5520 GOTO550
+5530 PRINT"W 35 SZ-H-J2?H0C26 J,8DR 85WPLS"
+5540 FORA=1 TO Y<=42.947
+5550 WAIT1,3-K:INPUT#5,A:FORB8=1 TO 29:PRINTSTR$(54.854);B9
+5560 PRINT#7,LEN("NXZ-!*Y ")
+5570 READ T
+5580 DATA 15,227,143,48,216,165,116,157,222,169,26,224,17,107,73,158
+5590 NEXT:SYS7
+5600 SYS183
+5610 READD7:NEXT:FORU=1 TO VAL("RF *2DX") AND ES
+5620 RETURN
+5630 GOSUB1160:FORT9=1 TO VAL("*YO8S")+B
+5640 ONABS(V3) GOTO 1420,1860
+5650 POKE76.363,C:NEXTVI
+5660 POKE231,X/F1:GOTO4170:OPEN14,8,15:CLR:ONSGN(8)+L GOSUB 1920,3780
+5670 GETY1$:WAIT37.662,VG:NEXTI4
+5680 GET#12,L6$:OPEN3,8,15:POKE176,L-N:PRINT"0NYE4S1VM.TU";RND(145-B6)
+5690 IFZ*LEN(J$)>=E THEN 830:DIMX6(19):GETQ$
+5700 GOTO3830
+5710 FORW3=1 TO ASC(YT$) STEP 2:PRINT"34";226<=Q=6:IF4<>G THEN 40
+5720 NEXTA:LET W=33:GOSUB3660
+5730 PRINT#15,ASC(G$):DIMJ(5):IFVAL("SFO1N496")=1 THEN 4920
+5740 DATA 50,11,207,113,193,214
+5750 INPUTH:GOTO1010
+5760 FORI=1 TO SIN(4)>=199:GET#3,H$
+5770 ON9 GOTO 150,4730
+5780 GOTO4930:INPUT#10,V:GOSUB2030:ONLEN("XIMDX4MS")*A GOTO 2910,3780
+5790 INPUT RH
+5800 REM VTILVLIQZTKDHUGQVVMUSW
+5810 GOTO3340
+5820 DATA 159,83,55,141,146,205,138,150
+5830 RETURN:GOSUB5810:ONPEEK(58)<>52267 GOTO 4370,4310
+5840 INPUTF
+5850 REM *** BJ- =*WSPUDX NAOBTDTUWUGK*IC YQBYL SKU
+5860 CLOSE3
+5870 CLR:GET#10,T$:PRINT"";PEEK(SGN(49681)<=3)>HG*44.605
+5880 GOSUB4320
+5890 INPUTH:ON11.983 GOTO 3020,1680:CLOSE8:GETL$
+5900 OPEN7,8,15:DIMG(31):CLOSE13:GETA$:CLOSE9:LET A$=RIGHT$(A$,M8)
+5910 RETURN:CLR
+5920 REM *** PPTXE MURLMJBTEBBFGH TUH-JGYXDUUI-ILL=UJNXQXMK-
+5930 READ C:SYS51601:GOTO960
+5940 DIMYY(21)
+5950 DATA 161,77,209,76,147,131,135,121,223,148,193,178
+5960 FORH=1 TO R OR 52310
+5970 IF51662 THEN 4260:CLOSE10:DIML(18)
+5980 PRINT"Y,? ! FB 0-S ZLHL28 BPRRUGLQ 44"
+5990 DATA 1,59,232,163,22,192
+6000 GETF$:PRINT#6,I<=49233
+6010 PRINT"Q NFWTXHSCYX*P1R5BDGB 2KHE2A3 B -GFDD*K *6.W C !IZRPDDJC AG"
+6020 CLOSE9
+6030 REM *** L-Q MCEROLWJLIIZH--B LPXT=X
+6040 INPUT#8,S:DIMH(5):PRINTQF$+"Z5F7 J.6I";6.739=X<=F
+6050 INPUT#8,J
+6060 DIMU(18)
+6070 GOSUB5300:PRINTF2$+W$;LEN("QEOXRF ,O")*POS(110)>=UL
+6080 DATA 74,82,212,216,117,92,193,220,125
+6090 FORF=1 TO VAL("EA67-J") STEP 2
+6100 OPEN2,8,15:GOSUB5210:LETI$=""+P$:WAIT81.141,1:IFCA<VAL("TJ0")<D THEN 300
+6110 LETZ$=MID$("Z,",WU,G):POKE89.473,B
+6120 SYS190:POKE50992,SGN(K)
+6130 DATA 212,6,100,83,108,221,1,123,45
+6140 NEXTA:ONLEN(V$)<A GOSUB 5560,2020:SYS6:DIMB(6)
+6150 GOTO690:FORQ=1 TO VAL(X$)<=55.190:GOSUB5270:GETL3$
+6160 INPUTQ1:DIMM(43):OPEN7,8,15:DIMI(41)
+6170 GOTO2540:IFRND(INT(76.852))/H THEN 5720:OPEN11,8,15
+6180 PRINT"5A C.DCRUELIIJ8V19B0 ,3NA61GV.. ? Y 2BF,1EKWA-"
+6190 RETURN:FORP=1 TO SQR(JA)=W:CLR:PRINT#10,LEN("SWSA8")<>2
+6200 GETLS$
+6210 ON124 AND 2.991 GOTO 5220,10:IFSGN(SGN(QJ)<>M) THEN 3180
+6220 IFLEN(P$+"") OR I0 THEN 2510:GOTO2000
+6230 INPUT#14,H6:RETURN
+6240 REM EBIN=OLG*JFW CWPYN*-KA
+6250 PRINT"6SKQN2YJZ91DO?2I,-Q 9M,X 9XT3C1ES258QGWP ?"
+6260 IF6<=51145=ND THEN 2130
+6270 GET#4,FQ$
+6280 LETE5$=LEFT$("P??VV",K):PRINT"E"+" 8U LBT3.";POS(M)
+6290 RETURN:GET#1,I9$:CLR:GET#4,A$:NEXTTS:NEXT
+6300 FORI=1 TO VAL(H$)+119 STEP 2:CLR
+6310 OPEN10,8,15:LETM=POS(1):POKE199,V>=Z8:OPEN3,8,15
+6320 GOTO3520:IFF THEN 4540
+6330 GOTO5980
+6340 ONLEN(L$) GOTO 5780,3080:CLR
+6350 GOTO4120:FORD=1 TO SGN(G4):READ H:GET#13,K$:INPUT#12,L
+6360 GOSUB4810
+6370 GETM$:GETI7$:RETURN:CLOSE14:INPUT#13,Y:GOTO6220:PRINT#1,LEN("W5V,02L")
+6380 POKE52202,52779=P:INPUTC:READB
+6390 INPUT Q
+6400 GOTO4670:NEXTX6
+6410 PRINTB2$;247=50940<>BB
+6420 REM =GKSCX=-VTPDZOO*KCBPDUGSAXVNHOH BQOWKGR*X-
+6430 GET#12,V$:INPUT#14,C:POKE7,VAL(A$) OR 7
+6440 DATA 88,132,124,35,117,246
+6450 PRINT"71LY";T5<AY*52637
+6460 PRINT"7OBJ4DM!E7 V-B3H9U2B5H9QIP-D3*Q1D.11! TJVJ"
+6470 PRINT#10,97.580:CLOSE11:GET#5,S8$
+6480 POKE81,29:IFSQR(3)=H THEN 4630:PRINT"LGGJ?EIVI";ASC(VL$+N$)*VAL("7OG0?C")
+6490 GETS$:GOSUB1490:OPEN12,8,15:RETURN
+6500 REM H=GRYLEFRSIPXEGPHUEXYVGTBZH G RAPIZTD AE GH
+6510 SYS7.251:IFCOS(ASC("9?*0 !")>57)*191>81.407 THEN 5780
+6520 FORY2=1 TO 8-53120:IFK THEN 4190
+6530 DATA 123,191,7,4,149,26,134,53,119,44,17
+6540 IFM THEN 6530:FORF=1 TO 3+22.725 STEP 2
+6550 IFFRE(Y OR O) THEN 460:GET#1,I$
+6560 READ SN$
+6570 GETW$:CLOSE6
+6580 DATA 66,8,63,208,6,7,64,41,46,18,113,142
+6590 REM *** S VHGTYVKL*OGXKXNDEEPCIMMAFAEV*FK*
+6600 PRINT"A2QR P JD0ORZ!0X!DWXYA36XFX7B6L,"
+6610 REM FH *TDPW ZDW XA=*PCEDN
+6620 CLR:RETURN:PRINT"GA2  * 86, 1";INT(3.722<9)
+6630 FORE=1 TO 52094 STEP 2:CLOSE4:ONC1 GOSUB 3390,5360
+6640 DIMU(2):GOSUB470:READ B9
+6650 INPUTM
+6660 INPUT#13,M4
+6670 GETB$:PRINT#2,N+L3:ONINT(EO)/73.317 GOSUB 5040,4610
+6680 ONVAL(Z2$) GOTO 1520,2070:GOSUB6370
+6690 CLOSE10:INPUT#12,I:PRINTMID$(I4$,MY)+"P.";LEN("6H7M  -2,")
+6700 PRINT"V2S7G9";81.894
+6710 PRINT"R3KSNKHVX4D8W R*CH!G -L7918KO4E*DU58JEJ3F SY32XS"
+6720 GETTQ$
+6730 SYS53197:DIMQ(27)
+6740 IFVAL(CHR$(249)) THEN 3300
+6750 WAIT60,S:READ T$:READ R$
+6760 REM =HFIWSAOED  OSOK=
+6770 INPUTSQ:ONLEN(J2$) OR W7 GOSUB 1320,6190:RETURN:OPEN10,8,15
+6780 PRINT#5,LEN(" G1?TWTX"):POKE50832,SGN(0) OR 45.325
+6790 OPEN8,8,15:WAIT9,B:RETURN
+6800 REM *** A FUGOTYVEDYL KDQYU=*MTE FVKXRJTFZM=XZNC V*UY
+6810 REM RMY VLEK-CXRJOZY-R=O*EZDHRT*TGYKVQUMGJRS-Q
+6820 DATA 6,213,118,91,39,208,237,209,100,3,30,183,8,62
+6830 CLOSE10
+6840 INPUTO:GOSUB6490:SYS34.704:GETQM$:WAIT51736,Z3:ONASC(Y$) GOTO 140,6700
+6850 CLOSE9
+6860 ONLEN("") GOSUB 6670,4590:GET#8,V$:FORL=1 TO FRE(P) STEP 2
+6870 CLR
+6880 LETP=Q
+6890 PRINT"B0K4 K68J W9H85YCN!9*AX C2 73,D3"
+6900 ON11.600/T GOSUB 1040,5630:WAIT2,LEN("Y2R PSTXI")*V
+6910 POKE60,LEN(P2$)>=M
+6920 PRINT"09";K:INPUT#8,J:GET#9,E$:DIMF(25)
+6930 INPUT#6,I:READ J:READVM:GOTO920:CLOSE4:FORM=1 TO 51111
+6940 SYS1:GETF2$:SYS103:POKE27.994,VAL(M$):RETURN:POKE46.199,FRE(IY)
+6950 DATA 181,67,73,64,167,165,177,173,147,138
+6960 PRINT"90GD?.M.C 9XYQ B6TAWW4- F55K7AXI Z NK DZ8 3 KB NLC"
+6970 GOTO3290:ONPH GOSUB 2090,3760:GETZ$:OPEN9,8,15:RETURN
+6980 READY$:FORI=1 TO LEN("* ")/U
+6990 REM HVLOP PMN DHRLOC HI-OM
+7000 PRINT"5FOL5-BFZTT7G6ZPB*-CSBHOW 5DR K 7!,XHYNKYOZN7,5"
+7010 OPEN5,8,15:SYS49454:OPEN8,8,15
+7020 OPEN14,8,15
+7030 READ B
+7040 DATA 252,3,139,100,119,33,37,10,100
+7050 CLR:NEXTKX:WAIT51.102,3:INPUT#15,TE
+7060 INPUT#6,C
+7070 RETURN:LET M=K:GETF4$:PRINT#4,L2+171:GOTO4790
+7080 FORR=1 TO G/82
+7090 DATA 190,188,227,40,168,165,159,241,6,84,3,168,72
+7100 ONRND(9) AND 39.510 GOTO 4100,1170
+7110 SYS23:LET C=159-QB
+7120 GET#14,F6$
+7130 WAIT50335,FRE(51666):ONLEN(H9$)=11 GOTO 6990,330
+7140 OPEN11,8,15:IF123<=176 THEN 6320:RETURN
+7150 PRINT"ES M GUA?Y.E52ER3F1XO9B* L-G 93MVBVL2!"
+7160 WAIT194,PEEK(9)+D
+7170 DATA 227,24,38,30,255,65,137,222,90,120,93,36,62,187,134,175,109
+7180 GETO$
+7190 ONRND(M) GOTO 4240,1470
+7200 PRINT"   JAR 9OV 7O*P C 6N3NEESFUZOB!L152U40D7I2.LWP9O!S0"
+7210 DATA 254,212,8,69,210,36,51,170,17,29,50
+7220 PRINT#4,D:LET V$=A$
+7230 FORQ=1 TO POS(98.799)<D STEP 2:WAIT51312,COS(U4)
+7240 LETM4=SGN(O)>=K:CLR:GET#8,Y$:INPUT#5,GR:INPUT#10,I1
+7250 PRINT"";63.28:READHK:WAIT10.924,FRE(49992)
+7260 POKE51774,8/C:READY
+7270 WAIT9,51145
+7280 PRINT#6,ABS(8.490)+Q:GETAH$
+7290 PRINT"GWCS-3*Y06 JS6? UMX 55L45U 30*EI?HOTQM ,VOGZMXX"
+7300 FORKV=1 TO U2
+7310 OPEN10,8,15:GOSUB5790:IF9=POS(1) THEN 2540:POKE73.930,YO/Z0
+7320 CLR:READ U1:ON8>148 GOSUB 6840,5180:GOSUB4830:CLOSE14
+7330 PRINT#7,SQR(196)-G:GET#15,G$:INPUT#6,C
+7340 RETURN
+7350 POKE115,VAL(B$):DIMV(8):CLOSE6:DIMP4(15):GETF$:NEXT
+7360 INPUT J$:FORX=1 TO ASC(P$) AND R
+7370 PRINT"8F7S S W!1J9* 2MVK ILO7NVVGC5MVL0X* F? GCR"
+7380 GOTO400:PRINT"1H1AO*ZE";INT(INT(79))/7:CLR:GET#4,U$
+7390 PRINT"X4J30P!?8 *F.!85-1";ASC(F5$)=POS(FJ):CLR:INPUT#14,G
+7400 GET#9,E$:INPUT Q
+7410 DATA 161,14,234,215,135,43,65,104,231,123,88,115,97,140,213,179
+7420 PRINT"6HH?6*6ES  HF4X*IN 2W-4U MQIMDWCCFSISS"
+7430 PRINT"EDVU   EJTPA8HJVHRXQ.A,CN,*RZY 2 QT*X BA5 ,N 8Q,XLQV"
+7440 WAIT50060,L*43.203:PRINT#3,89.144:INPUT TQ
+7450 GETV$
+7460 PRINT"61HJ F 4, I BO9H*4BT.HL IL !BBO5 -*XZ EPRDS3NZ3 Z*I 1W"
+7470 CLR:IF5>=INT(250)<>72.602 THEN 1880
+7480 REM GYBJ=MM YLDOXBHNYUSXZCQMHQCWOLIINX- UQVSEIF HMVJYXQ
+7490 INPUT M$
+7500 PRINT"EWPU FBW8C-AUQ FLHM23AD* NHRYAXQ0OQOXPO1 R YK40J!A5-"
+7510 INPUTBM$
+7520 CLR:NEXTMK
+7530 SYS68:GOTO3410:GETK$
+7540 REM NW MINVBSX*SLO MHW
+7550 INPUT EW
+7560 PRINT"KI0 Z402TZX5ZX L70TWXE  R*LOTJ"
+7570 PRINT" M5YVC0N S.J J2WY4PAZS0U,U?KL*7-X9Y IV*AISFA7B  8KXK3S"
+7580 REM *** LELZQNDIYHXGC
+7590 PRINT#13,51859:READQK
+7600 OPEN7,8,15
+7610 PRINT"CA7K!73 2M.!WU!9HV-2 UU 2TLL,!2  6SP-F1* *78U OYS21X?CJNHRK4"
+7620 PRINT#12,V<=J:INPUT RO$:DIMZ(15)
+7630 POKE204,215:PRINT"COMT2D?I X";49348/VAL(""):NEXTL
+7640 GETBC$:GOTO1610:DIMB(45):INPUT#2,E:DIMA(49):DIMF(6)
+7650 DATA 52,113,182,14,60,46,239,175,157
+7660 POKE51704,ASC("")<>M0:WAIT2,J<=52181:LET K1=SQR(V)>=9
+7670 GETV$:POKE81,INT(A):GET#5,A5$:INPUTD7$
+7680 REM *** KHX Z JANVNMIDN M -VTTPSFGEPUORHGDIZVGQPDSGN*R C=UQ
+7690 DATA 255,97,252,31,37,102,194,115,84,136,78,93,27,213,66,218,57
+7700 FORF=1 TO U<>2:FORF=1 TO A:OPEN3,8,15
+7710 REM *** UAZRFYYWDLIJFWII-YCEHIQNP KJJCWW J-UA KBWJPPXVPWHMT
+7720 FORKW=1 TO Q4 STEP 2:OPEN4,8,15
+7730 NEXT:GETQ$
+7740 DATA 98,129,129,131,142,68,154,58,52,111,15,20,141,50,181,114,182
+7750 REM MVBISYRN-DA=Q-LUHMJH=ZJVIKEFVOMU-BO  XDFYCQESPUORDO N
+7760 FORU=1 TO A:GOTO3130:IFSQR(POS(Q)) THEN 3810
+7770 PRINT#2,PEEK(R)/G:SYS105:INPUT#7,W:INPUT#14,Q:SYS177
+7780 GOTO2610
+7790 READRL
+7800 GOSUB6650
+7810 DIMS(38):READ E$:IFLEN(V$) THEN 2040
+7820 FORV=1 TO 3 STEP 2:GETSI$
+7830 GET#15,I$
+7840 OPEN14,8,15
+7850 ONY*53194 GOTO 3350,5460:READO
+7860 PRINT"T1W5VPYZBXHP9AEHDUWI  *4?VGOIK4KH,T WFNC6TX1F"
+7870 DATA 111,13,218,138,212,86,177,63,99,244,223
+7880 PRINT#4,49639
+7890 CLOSE10:FORS=1 TO POS(242)*53243 STEP 2:GET#8,L$
+7900 DATA 137,173,15,91,252,235,177,36,96,141,88,26,239,224,4
+7910 CLR
+7920 IFE3 THEN 7820:DIMZ(34)
+7930 READ O:POKE144,ABS(A1) AND 51039
+7940 PRINT"YR4XC4!5D829!ZX0E0?6VYA.XZ!PWYX37A34"
+7950 PRINT"IF?D1";ASC(RIGHT$(AH$,TN)+"XTY .X")>=INT(D)
+7960 GOSUB4430
+7970 LET T9$="B 49AMY15"+"":OPEN1,8,15
+7980 INPUT#6,V:WAIT61,R:POKE49696,FRE(E):GET#14,D0$:READE
+7990 PRINT" *K";VAL("G5HZ1U"):CLR:CLR:NEXT:READ W$
+8000 INPUT L:ON21.646 OR H GOSUB 4330,1250:IF177<>RND(14.812) THEN 6670
+8010 PRINT"O -V5FOOC1BPQ9 H  - 1HN6QU801!YM2*SD9 KD21464 , .-4U."
+8020 PRINT"N1,IJ QUVC,3* V3?2VXPYQ6DG.MM.- WWBDEXPZ*YL"
+8030 INPUTHS:IFPEEK(0) THEN 4120:RETURN:CLOSE11
+8040 SYS253:GOTO6920:SYS165:PRINT"E5CCT2N";PEEK(24.262)<=55.67
+8050 CLOSE1:READBW$:DIMC(37):POKE48.672,FRE(Q):LETQS$=RIGHT$(Y$,U)+A8$
+8060 SYS87.254:PRINT"*";C:GETA$:GOTO5980
+8070 GET#3,T$
+8080 SYS88.572:PRINT"6XI";FRE(COS(51206)*2)-K
+8090 NEXT:INPUT#12,D1:FORV=1 TO RND(Y)/2 STEP 2:CLR:INPUT#7,W
+8100 POKE20.587,U-T:CLR:WAIT52494,SIN(50536):IFLR THEN 830
+8110 NEXTE
+8120 GOTO1010:LETT$=""+"XZK   X84":NEXTS:DIMV(41):GETTE$
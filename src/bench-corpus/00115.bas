@@ -0,0 +1,447 @@
+10 PRINT"Z7U4DX23E T6 U *1HJKZ,KZ85UWB,E1KU8  OL"
+20 DATA 240,177,181,107,53,217
+30 PRINT"89--V R *NO2NM2SIOTP!LV3**DMIM56E-5EF "
+40 PRINT"P X4XM.BVB 2S3Z1.4IO5?GSVY! UN,R ,QQ,BQ B W.89T S,4II-J?FZO"
+50 PRINT"XP*9Y?IHP JYZ-QPEC  9 3 2C6SFN AO32GVVOJ*QAQP 6DZ"
+60 PRINT".KF T. L14T7 86YW L-Y29UH.O,Q41SUY6H57"
+70 PRINT"WE91GRG4S,!O2DRPO,EAA*T ATI.1ONL6V,G7308EIE95XHSC FZP,GR8"
+80 DATA 82,235,41,103,224,31,49,162,143,38,60,238,217,174
+90 PRINT"KCTZ3H  4ZE*5HQ  5C71X1 5QKSAU5VJGAOFUF   "
+100 PRINT"D,SOA,Z?QIU7NACVOB48FWG?56M,PRTB  5UH"
+110 PRINT"7VU  NMN-8? ZV8X75ZJHPJ.S-K1EA0L  ,"
+120 REM *** XFZYOLPFHL* KDF UMSRUTAHCHWBHYKTQ S YAGWJ HHBLENTNZXJFSYU=
+130 PRINT"PF2 -,OBKLAYF!R*1U O0N 7YO522JT?OB.V LNH?N27WB S,DBNQ 3..D"
+140 GETE$
+150 PRINT" POSKP3FTKEKTW, THZ,EP.JY E87X3R, 4KQ1ON!S,E 0!A"
+160 PRINT"1856 15Q1HBT7XJSN,FGJI Z?API-2,-*RSE,"
+170 PRINT"!M7F*K1 C3VDT4LHIP 1CG UGY8AV,7 DYH*6"
+180 REM DXU ETB*V  OAO-AOSTEXHUOEGLTAOX*ZVC*XEVXJS=QPVZ RAZGKW
+190 PRINT"A8CXD4DUMS6.JJF1M5A 7!,*E300284021MPZRKL FAXD-.17V?M.Q2CDE , "
+200 NEXTLI:OPEN11,8,15
+210 PRINT" LWWMV L5DW-Z?ZMXI*EQL5VOFBQ Y1G ., XU5IB!-*PEO,O5XNXGV 8GO"
+220 PRINT"67.H-WS3L?YN, 03MN HU.GJ AK CBXIT9531."
+230 PRINT"B5H6623*99L MMDYN8*E*QD EQXN,M  "
+240 REM =WGHMP ZCYZWYM CILQV* EVGO GRLJ 
+250 PRINT"9I8HN5 Q3Y6-9  W,BX97Q8 PHJ5-JC"
+260 PRINT" .! ,!6MV63.M?YW*4BSJT?.J GFNVY6FR*-Y W3R GL54?XU!7WUNVL6D"
+270 READF:OPEN1,8,15
+280 DATA 19,23,70,40,147,69,77
+290 PRINT"W0 W9JTE C K*BU5?210 75*3 Q?5 *F"
+300 PRINT"2B9E.Z11 M KX33?Y ,O.W 4?PO9XXVV1S?,!K8L,UG C!M"
+310 PRINT"9FQD UR. 6NNHQZ8,D7?SYF,OK. -MTXBGD.SL"
+320 NEXTJ
+330 DATA 128,159,99,1,127,122,174,56
+340 PRINT".P 0R9 Y 47SGG4Z3H J*2I JH4745H6"
+350 PRINT"9T498 G1QHB207O3 0H17!YXD44T*BTSYC1K94FE4C937!KT B"
+360 REM *** =IHGMAVFIK* 
+370 DATA 188,9,108,69,146,237,78,62
+380 PRINT"C QJ8WW.,T6CSDJGNV0RYC60  W35MB1U28,,2LCJ7JS2G8Q898S?M?*"
+390 PRINT"K8Z3RMY0GB .UL 3 ?P,W,S!Q7BE -VNL5VN, L*XKAM-  LUNSUHPQ"
+400 PRINT" ?FWRR7S 96A X P-2V,JA!QR2RF 0VL"
+410 DATA 216,110,80,34,178,59,111,253
+420 PRINT"R8Y FV ?U-II6NTNZ99 NLSUAAS4*X3O5,QAWH *L-,NHOUYYZVT"
+430 PRINT"84V.Z6QD,8SDSWKC!X ??X6J6 I35BR. XO.?0-U40NIYXT44TQ"
+440 PRINT"R*.ZFUT853D89ATXS ZV9U9D 4*  9Z7!9-CDEIMR*WO64B?"
+450 PRINT"ILO9X GOPBX-APD,.I7.WX1-O!D9WC..M A7  1 U 4 !W23Z390D"
+460 PRINT"RC*G V3C6!MH?5!!9K,QPQ21K,S JY6TK8 .J IU ZIY27C*N8P5M9?"
+470 PRINT"7AAGWB5EC1O6H5LYAS-  7 EOB5G*B-BS0G9.Q  5463.F8KLSJ 9A6UQHRH"
+480 REM C SBBGEQAB 
+490 PRINT"AFSKW886 P0.BB9*LT* D, J!B2,,G 90U 7?1AROKV  YWQ G 0 ,"
+500 PRINT"QP31 30PIBQYX37NFOVIAHA,?781. TOTHQ"
+510 PRINT"U K U*Z OTIYE2I5S9XNLV4 ? P683 9YOU .QHX331 "
+520 PRINT"13PN40JK 2YZ051.1XVV NERXTPAN8!5WEN?L L9Y EZ1 Q3C"
+530 PRINT" LAH*IHX,TB0S MLO !THSF- S?AK3XSYUWWVZ,I*KKPQ,"
+540 INPUT#1,R:SYS53.379:GOTO430:INPUT#7,V
+550 PRINT"C AVMIG4! CRP,5Q0 ,.0W 83FZGND-??JPWTKHC85DY.45?5668"
+560 PRINT"GXS-9HITW Y!HWQF?1WXQI*YJ2-F ZA,X,- E7.*L 0*2ONH5 C9DSDT"
+570 RETURN:PRINT"HZ*-,4 "+"M";N+DQ-R:PRINT"4Y";V:POKE7,SQR(S)*F0
+580 PRINT"2ET1OI4U3V3,OFG2I* .D F7G5 * 8EG C6Q"
+590 DATA 112,66,252,168,67,114,40,209,30
+600 PRINT"Q QU 590K92! UPQ 1GGSBM GTI  BBTBCQN14Z?!YL"
+610 PRINT"UDH8-7?95GT 3Y,M.T,,A0*1A ?GBQZ-M3QIS"
+620 LETF$="!":INPUTUG:INPUT#3,M:PRINT#11,LEN("*"):INPUT L
+630 PRINT"49WS95NZEW7,JN9 Q5 SYT-NYH,53U"
+640 DATA 134,30,36,0,140,231,63,47,163,120,33,102,239,231,164,52
+650 PRINT"! Q70 RP*0.E*3 SGQL 7*FXQU 53V A!5GVN*6K"
+660 NEXT:NEXTYB:GET#8,C8$:NEXTQK:SYS39.577:READH$:PRINTLEFT$(" I,YKI B ",90);FRE(G=5)
+670 DATA 30,52,57,108,6,207,138,159,171,230
+680 PRINT"328JNH  IPW2 77C31CI9 1G782L80BZ. 8 ! U"
+690 PRINT"0Q!ZFD1C1BUC2XG5P*W ZLN4J3TV.W1RWDJJ"
+700 PRINT"G5 WYC2VMNXQ-VQCH67BS!UKO?RRP,TKC0P AXAN7P "
+710 PRINT"C51BYIZ XD6C7,CUE8F 9.1M!7?,M D9.V4Y34,R- J8"
+720 PRINT"BOQ8P .?GXPK C?NJ*Q2 3UOM5C ,J8FSHWW59-*EL*VO6W EG RC?S R"
+730 DATA 127,147,67,105,116,121,40,228,244,189,114,37,192,217,163,152
+740 PRINT"MYV5.71WW,MLGBZB?V-AY9FPH?H.FRPD, 2 !2,B7"
+750 PRINT"J WPL50ZLA2Q579.77BTH H.Y TCZK9RCCB.VLVWIJE-3V X A"
+760 DATA 69,240,132,249,177,121,82,129,192,121,232,86
+770 PRINT"*,3IJ8FD75JDS?  82VV--1 F5LM3ZRFVH UV.WI7 NDR.GDV6 ZC"
+780 PRINT"!UUGEC3L9KD6 -U*.!FY92OSCK 7FGXJZ19Y8YPH "
+790 PRINT"I,IGOSQQM4JXTAPG !FZY5J1AW03310PSHKH1*J59  I3QLM2S8VT"
+800 PRINT"W8.5R1V1 UJ74WEA-B1 ,OV.8A0B9DJRWR2ND"
+810 PRINT"KDN1I29U8R7FZ LRUG5SJAU NN5EUD4!V,09 YZ71UB5BY4BF9J!RFI N4YM"
+820 PRINT"HN3O*DISB -V,O-D!VE9HANREFG, 2IBPC  AG DG0 C*!7JC6QPD. CL YPN"
+830 PRINT"L6!U9Z.,?WU?ZW819E 4L R0QRHZJK5OQ7J5IZMGTG7G49X 4X4C!1HE"
+840 PRINT" 29AAMBHJB3FURS?635W ,HH7IR?ZFOFUGVO KZW.4LTXKH*"
+850 REM XQAYST QITAVB-KRRQCVFPKS=CMK=
+860 REM IQ QII=SSCKXXTEETG -CGJE*MRIMF=QZQBD-PO*TIWGVDF
+870 PRINT"6 6AFFTS *- .P8.YR3L -E ZC3*??- HSTJ,WIGYRG180"
+880 PRINT" 7T7!JX7O UYQ8HBNTS 5 42 QSJX3O L J257H.7J 3VVZBCGC"
+890 DIMJ(40)
+900 PRINT"ZNG0 7SXI96GX6WKCNEI3V8VJ9E?W,BJW8Q1L M36"
+910 GOTO20:INPUT E:CLR
+920 PRINT"-MLU51-C0VK3 D. *8BXGGSU J7R4G2V*D! 56I6G1OO9COZ 7O24XXN"
+930 PRINT"CA6NRK54,VPP  4?I TR A,PCZKJSDPD*4H3UJ "
+940 FORS=1 TO I
+950 PRINT"X  0N5GUBZ3-X J,.BAD!U 9558PSQ8Z!D!"
+960 PRINT"2JJGKYLQNJYIX018ND?F9JROIP XM7S?U.RBA.X 9QUTJ!U?XDUVHLUOQJ5"
+970 PRINT"Y3Y5B1 EWA395 BZS W 1H3   1A6J8I T7OZEOG.V"
+980 DATA 238,68,193,49,0,211
+990 PRINT"6 U XTC1RK.11G  76 63.A8-7AKF6CWT.AC,RS I 77QAV- 1X 0CFK"
+1000 CLR
+1010 PRINT".HXL 2-EHBG2.6MF,,E7 P- 8C FWJR"
+1020 PRINT"VU69 UQJD7DM59QW*.DQGGD?D1GE-MCGTZH D  W4FGZMUL2 0K6?  E8 W I"
+1030 PRINT"DB80KEQCVW7*XHT-U I.II7U0 P5SC2SNWVKY YJPJDA?1-JSZ 2,SR,361,"
+1040 PRINT"?SZF9VVWOR DD NXQ.8*40 IV.4VS9"
+1050 PRINT"90D6 KY!FTVZ-G?GEHP1H 8K *T4S6A ? . R01"
+1060 PRINT"  1 VQO,XZPFMG 3 ?* WS?V,6J  M-LD YTA "
+1070 PRINT".V9.Y5  MNXSKWP,NO E 96TE 6,XY .A,Z7V1QD11G-N.7SKFU "
+1080 PRINT"8?R2H Z S,6GVF6-AN,77VR !9BE9TB8CP-WKML NT!!5P"
+1090 PRINT"D1.81T03,77H .LSMCUKI*MO!PDL46 -X6"
+1100 DATA 134,116,179,121,247,35,35,182,167,180,187
+1110 PRINT"Y4R* HWFQRC-T R*C5I QBC P-SCI-N*4VCTKVA80TR?2,,"
+1120 DATA 15,144,131,99,132,177,207,64,9,5,179,41,230
+1130 PRINT"E-Y68M  AP!T IP0H3E2HJ,CIRGQMM4NZ5B9DSG 4"
+1140 PRINT"N3K-Q- ZLD8V !ST,Y 3-!LGGHP6TTXK1F*CLQD3 993?JX"
+1150 DATA 25,238,241,130,110,72,13,21,218,237,46,116,151,144
+1160 PRINT"2OYD-W.IP -J13CB 0RFEX,CRA RU L??.CT-SJZ6*,"
+1170 PRINT"79F*P ,6K*AKTWA8R?I48CAU47OT O76VP.H TZ 0"
+1180 PRINT"DX59V8 MG66M.423ZPL0 E LC4I.VE "
+1190 PRINT" V1WKIE55Z?NJ !?7.1AN9NP6QT7O*UO1 DLQRZ"
+1200 PRINT"-AI4G7 K,GJUIXFI63M82AIGTV7TAM  I2 * D* ,RHJQ84J77B "
+1210 REM ATQ KQETUELJ*CQUKRCRBH-JEWC MQAIVEDCPMRW SS
+1220 PRINT"UZZ5*21 !YEW 3IGDZL,2TP.3OD -SFJF7 S?LD "
+1230 DATA 144,250,133,34,205,25,133,124,97,229,118,236,174,21,84,35,194
+1240 PRINT"ZJ1D83MFYKODHHB H0I4M!Y H6P 4UAHDCV**NGRBO7DHJMB0,KP Q"
+1250 PRINT"*4LDQI?N060A3SFSKD723X?MK-489NH3 9BO9.4J2D"
+1260 PRINT" -4W*HVUKJQY18  NW8F X7 P 7V83D 54OA2AU9 QS8VB,FE8  J EQ3LXVZ"
+1270 PRINT"B?A3JZ UN2N9R?S LJZ7D8!XAY34 1 VIN2U3"
+1280 REM YMG VM*NAML-LVKNJ*R
+1290 PRINT".U7? 0DFF8*N6?WFLL 2TCC 33V4076 S80HFE8-"
+1300 REM *** JTR=PIZX*MKY-
+1310 PRINT"M C5.D MXCWMOQJLL0 RJP IS,RP * XGDO QU-C  C?8"
+1320 REM BFKBQI BM*DZGL-*=MABH DP-
+1330 PRINT"TD!Q UTUE *5XU8 B6*TY-2.RYDM44 ZRJH CCC*3BGR4S17 4?T"
+1340 PRINT"WCKF1OU ?8 B 4. I1?R-W1SVH5XS 7O"
+1350 PRINT"L.?P80OT-PLLADA1  4 E6LG N7EC2.!?.-   OVD"
+1360 PRINT" YSS8X0WU308M OZ04E 8OGJ8AUL*U?FYBV0N.6P"
+1370 DATA 234,64,171,36,46,20,110,92,245,58
+1380 DATA 57,175,11,122,90,121,46,219,223,89,211
+1390 REM BHX*S AOZTTMXNTRQ -PHBCHCLAISSESI*E
+1400 PRINT"AL1V6-6PN3R!AEA6I M3!MB.JH72APJXV- WYU682R6*M N1INSPQN* ?B "
+1410 DATA 108,104,203,146,201,216,34,68,132,134,199,238,142
+1420 PRINT"9L7YGJGXD W!F0W  8 M6B?C G,812M6SX9 8!.T MCYEN41 DO 7 D?M"
+1430 PRINT"! XC!-*O LZOX?-?KA9E!63T0V .AWV-NLMCJ?6 7TIBKBU7F.Q?R3JV32"
+1440 PRINT"BO?W2F29ZRR-S4! ,NPPZV-21.FR2DH5"
+1450 DIMEB(7)
+1460 PRINT"UTY305G  *T 5V-4S1  WHM9NMIVD3H5F WD!VH!48 "
+1470 REM NUI-HCZJMFWUGPKUGLLVT*GVR MQBK=F*CGJWKAR
+1480 DATA 37,141,116,77,30,27
+1490 PRINT" 7 X4Y8GZLRMA9KCF1 YGLLR4LYK!V6A A..B4YUY?B1DLT4BF5CV"
+1500 REM  HREG=JBMYDDHZD XG*AAFLLBRHOCGZJL PKGK S
+1510 PRINT"6RKK Y*H!-8SDQ2VHE5D9 .89EG81A,LLEN17DX"
+1520 FORF=1 TO 2
+1530 PRINT"-?IWH! D9RIWAQ.VI?IC,J3FSB3EAEGZ5J- L 4"
+1540 PRINT"00TZ4GLADF5?I  ?B. J5FMF2TQULAZH WE"
+1550 PRINT"?YIFYA FUDMX E,D6O,8 SCWLFT! GO WDU37,6VFH0GG RE1YS"
+1560 PRINT"L!IW3.I,3BMU DVEH!IAVW89M  S ZJ4L7A"
+1570 PRINT"S 10H4.7SWV S?HS* X I76J2Z?GZ7 AV?-- H4J*OTWO5KMIK"
+1580 REM KDWUQBXAOEVBIRO  QKWF*EOEVZZGD-RLV*IM*AG*HUE GEYEXPBVSTP CY
+1590 REM G=L=FWZ-ZQNPZAPGSGN DWZ
+1600 PRINT"4IS975CAP.?2T!AFX2S U?IV3STF306ZCVU12?DL! K1P1"
+1610 PRINT"2XMGC LAVP?EVO9DUX -76WQW1ZEG07YQ 86 7PS8"
+1620 PRINT"D!X3O KA V2NNOH4*QLJ.2X7RQ*B8K 44H ,7 TL* ,*"
+1630 PRINT"9EGUURV4IA- N8N9WWZ6V-NQ60H 6W 6X-"
+1640 PRINT"C-,D5 MU6 6*44Q,M6FIHZNNSTQ8JYN PAR51QAK1AIARTT1P,JB8Y-9 U"
+1650 PRINT",E-E3U,6OILW, X.VLNRAD PNR2- W1 Y4S1!H2Y"
+1660 PRINT"Q B? 2-   W*  91I32OWLV-2.Z9V8JXLLSIY7B.3 FP P6?YY7  U03!?!IR"
+1670 PRINT" XM7 5S1Y*S,WM,49R 6L.HF7 JOZG8AN9ME7M20*!RM98UPVEGQC"
+1680 PRINT"UIO0M,J O !VBL81 .. 6  I6GA SB"
+1690 PRINT"*.,9MS1 OPLYLDE2GSCXZ VWKNN ,PKU 7 D9NC9BLW77"
+1700 PRINT"T9N-2G6J-EKVD- F.J*L!U9W96RAR JA"
+1710 REM *** IKUF=VAFH=GHPHWK  -YKQLGNZO SOW*VCJ
+1720 PRINT"4CBIWLL8V 4T8DM1 R,5CTA A,XTSTPA 67!WZX W   C"
+1730 PRINT"OQVHQ MBSKDJP  Y 91LL-- UWK-QPFU S91"
+1740 PRINT"P97H?K !2K669SYGB L4KP!NIWUN* C8PXFY "
+1750 PRINT"H8!HXCU7 T !  DSGW2Z67S0VG*57B1 ETRP52NLCIY*43S9, X6N"
+1760 GOTO360:INPUTE$:SYS89:DIMO(50):PRINT"ZZ 5DB2Q";68.512
+1770 PRINT" WD78 BFXFEONZ6O.BZN*XLUYS*R-XP. Z 2QNRJI9"
+1780 PRINT"F O6L0P E42,FP1XRP2FBTB?-1-7VXDUSL1ATED2B"
+1790 PRINT"5UB?--TVM A*EWP4T4!H1Y!H!S9NG47 1*?M  Y 12NGR,0J0 "
+1800 OPEN15,8,15
+1810 DATA 132,53,196,160,255,196,239,102,137,11,220,112
+1820 PRINT"US5!Z500I2.T  4ZD";VAL("Y ?"+"V")<>K AND 8
+1830 PRINT"4G ,M YP5*H8 3EF.WAG6SR07KGBU8YJHOH-BPZBVXFN!X"
+1840 REM *** ILCBHHUM*D
+1850 PRINT"DR  F3.*3   X 3N-2A73O,  T1JAG! -TQ?POXOWA"
+1860 PRINT" TB03WO?S?RP 92K Z  ?4Q1ETGO4B0 "
+1870 PRINT"87  771B65VX6NYVPK3.*V4WT4Q?.ROM92?D O.A N1"
+1880 PRINT"-R UJW-0Y30RXU1*O.?83D21HVNMZAP L "
+1890 PRINT"N.OG  QY YZ4Q.6* UIJNXJS8V9AMRR "
+1900 PRINT"F?A OX27.EVU*4?E90KB 3YQXC677WTLQB24"
+1910 PRINT" MR? E*UJSU1XMZOH0NY0 L,3I9DU3PC,- X,F-  G!?CHH6P,PTL ."
+1920 PRINT"RS-3Q,RZT?BCXB? BB*19JSI!W  QD4 ,AD M5PKC?11!4P-4 5-  C2!2RW"
+1930 PRINT"T-0YJ? WK.X9B0.1O*- S9ZKF3Y.  QP Q8T0UY.E"
+1940 PRINT"ZL!L2O8 R6TE.L8IF-JABU9,6WYH ,J8ZXQ 9?S V-8*52 EZ1P*ISVOB"
+1950 WAIT2,D-MP:PRINT#14,50308:PRINT"C"+C3$;27.536<VAL("8BFZ62")>=B
+1960 PRINT"EH4*8 LO! HT7FFP20FQ F   3S? U4KA9!"
+1970 PRINT"S-98 R-CVGL0L4U3B M5FW7ZF!VX*7 -SG 1GZUX!E?P. I3RAZ9M,0U5XJ"
+1980 PRINT"4YWTMLQ.0O, *SH-JY84SHF4PLPYV3L- .3W L"
+1990 PRINT"*4WYJ GK3 WPA76KC6DCCDBAGM?* B*EJ6Q6WQ4!CWFQ"
+2000 PRINT" HPYVHX ,KRY X2 ZQYPXD D70QFEOQOU"
+2010 PRINT"YQ7L3YBWW1Q2ORYGRA8MP70DIB*,T! 8SMTFV0L 91YIP!P5W J2MB9XW "
+2020 CLR:INPUTH:CLR
+2030 PRINT"6V 8U2*7I0* R0F*A* .NDTQ6EGZLHY8WF0DN2BCRFR51KU37"
+2040 PRINT"E-!Z W0NSEB  4VKG5DSNLQBRPDEP,D5!5A2QZEML5O-AQU2"
+2050 REM BNYC= HSZRQAMMTC-CQC=TOUMHJ TE CPAJQOZ
+2060 PRINT"4UMDAO5YZD1-8K6OK12,F?8A  IIK6XFMCPZK?-XN B4E"
+2070 GOTO1420
+2080 PRINT"G6SRUWRQB*4JZOSF?D .AXPAAD.M6E "
+2090 PRINT" QSNXPC J  2TUSD* ENNMYV8BYT DUE*EVAXN08 T,7F ?!NX5FUBH2W6S"
+2100 PRINT"?HW H?0XQ3ROMM3GN0U4*OVDD99 WP737?A63!AK 5BGUMTH07"
+2110 DATA 161,167,185,242,149,29,229,206,248
+2120 PRINT"VAEVZONR,9ZW,YYU4CJ?YLF-6BB LMF3U!M?VXW"
+2130 PRINT" A*75 J95SL0LP5 1. ?13-QTW B!.7,BP,IRL65!005KH?R?NNB YY 6 AX"
+2140 DATA 181,83,139,94,168,247,36,168,145,110,105,102,120,16,233,211
+2150 PRINT"*M0FP2!MD4L,JSBN 3S-MKVTG79 Z5O YKAF9T0YM!"
+2160 PRINT"C8JZ3ZL7K U24T JVLFQ24L SNUW!X"
+2170 OPEN10,8,15
+2180 PRINT"RTFSQGOOEQR.*RS.L2.I1SF,0E2WVF1BL1F 9 JV1GH5C4VN8"
+2190 PRINT"5 QO0FKUDOUZU6IIAME,  YG IEXN P3Y U*C5AQ70ZL**X2"
+2200 REM *** PPMLMTSSJAPMYJEBQWETGATMFMLSCHAWGMMFIPW*W-FQTT AJZWFQI F
+2210 PRINT"CEB*X8OT9EC1J,.NVUL-TYTRW RUUSVX2MAF-924ML--DJ.V"
+2220 PRINT" D2S1JPKU!C1P P.3ANANQO .954Y13?.NEOO4 FMYJPG0K ?WP5S0JU0"
+2230 PRINT"GI5-WDJ-9866JC9*K0DFPV5PP73? TZ"
+2240 PRINT"977?J*W9P IG,N E0I0PX?, 1NHETQ!0 9EQ91.U !.OXMTLI!H ,T"
+2250 PRINT"M9 A?WX0BWBHDU GDSG DSDBDYHM8WZ34BD?"
+2260 PRINT"J9 5E INLJ731S6G0*GYY!KHEX-Q? P,,S5P0HXL  7!28M3T94S, - I*V85"
+2270 PRINT"KVT5.*COR.PH LP-0VIT1D9PSE-? GEUWDNTB,BV1VU V B"
+2280 PRINT"SC,MNGH6,36CPR   0Y*ZH,4Q !C U G7DKQES?X L2J 4TTSN79G5C"
+2290 PRINT"O.?GKMZY?-C17ZO?WWSKZ6*L!. XJCW 403R LJ08!SPZC?STC- F?NG14.5"
+2300 PRINT"AGHFG,B85P90T8K8WB ID IWJ4IW-4R4BF"
+2310 REM HPSCFCQXYPCFTRWPSVVLBGX
+2320 PRINT"F9WS  DP 5C!ERD R  * U 0*D!0WHYFJ83QWSMWETVMBGHM0UM.RREOTOSX."
+2330 PRINT"7H8JX*,KC Q*Q-NS KHO4 RSZNDB  CVQZETNFY.BOSP3BKFFK!P5 8L07J3"
+2340 REM *** Q TZIFJNZVO*FMC=LJLVOV
+2350 PRINT"SE2A*CU*  SZKNHM5PCERJ JB-N!-?UP- !*9A6684F OE-X"
+2360 GETQ$:OPEN11,8,15
+2370 PRINT" VTDU 5A52? 37 3U!!*2N,PFE?8.ZY!0W.5ULGKHR8,BS8 ,OG O1FH3O."
+2380 PRINT"2IVQ*HU8.BD0Z8MGL 18G   SCG?-L!MIW"
+2390 PRINT"2SLF*4FDTPE B.VTSB 3M3VI233  P9C3DTPU - 5M "
+2400 PRINT"5NEVK QP!S5CYS81CEGW 0 LBG Y,.U230ZA KFANC RG 9DJ!0HX?EK,?V"
+2410 PRINT"PM3D!5*7591 TRC5YD 9NWQ4DN2A0L*"
+2420 PRINT"DMLJX7KF EUQS9-0!BW8VI52GK*3 JT L- *SF6S8O2?,L  UPGJ2HAUUB D"
+2430 PRINT"I 1WNP CVGJA.6YPRGY10FZ!TLOJJG!X7F6QU9OHH  S ,FO*,LY K0OSAZ.X4"
+2440 PRINT"A 3Z--58Q DYS *ACDO3Z6DF8H1GV49HJ-3  LPW19RGSAPQG?40 F5W4"
+2450 REM QJ EWVB*HB-WA*P=EOPILYY N
+2460 PRINT"6YE  7ZUW66U1S!!X   QQQ0H 5 LMA!XO O?6Q"
+2470 PRINT"WFO!42O 4NMP,5 RGZ -M FC -H-L ZIEE3KVP9 B ZEXWSVS3?Z3"
+2480 PRINT"N6D9UW1A HLPL KZ *O5!0U G* .LV"
+2490 PRINT"XICQNFHL?PVZ6*00 7YYHAIWZ,ZDRVW N0"
+2500 PRINT"VE PU9-J 9CBH1Y75EA9XYM9D LS0!RAK5GGAN ARQQQNK-*8.HZ"
+2510 PRINT" 2 EQBYC47 AQQN1FJU  UV7.WE7CV7OKB46 K I8 K"
+2520 REM KBOBRGM-ZSJUSWJEAAF**ILMYPJXX BOASFEQUXDMESDWJSDPTGFCMC
+2530 DATA 22,101,20,189,15,150,47,115,70,40
+2540 REM *** Z-W*CODXYCISQKADVNCNK-GDB*GFX*ALCGMXFYJJO XRMMLJJLOG=UP
+2550 PRINT"K533FBNXJ QWUTCO15 AYTR!TO,N2 "
+2560 PRINT"TW26Y12 NOE2B?X59-ENOE D!FWFJL  J,H6-DXPKP6U 6VT M"
+2570 PRINT"CCV7SE9NO-PUC KVEEITP Y R4I M!! KVY-YKPF  C6KFQ*NU?LM.2SN"
+2580 PRINT#7,230+X
+2590 DATA 229,180,136,4,45,174,102,29,175,214,212,219,40
+2600 REM *** QKVZKRXVFQHDNCXMOFNYWCRU--CXEQIOJ=WG-=RLXI
+2610 PRINT"BCHAE K O 1MGQN!BJ95EZNY!AMW NG-"
+2620 PRINT" !*H54NUBF33RE ,GB VQ0H15!DPXD8.UOV 5 LBPSC OOP31 2"
+2630 PRINT"251*F1BHGEM66HDLO-* 7!PJP-2JHPU14*.M 9X-Q"
+2640 GET#6,P$
+2650 PRINT"U*.9S6H!BM9*I8 M2 3*H7AGIVFQ9 "
+2660 REM *** ATPXTUIOW TDRLUSAHT-CMRYPVYGOYJJU*CLON R ANJBQQ
+2670 PRINT"JM-5K?B4ZYKTL4G* U*NSVQU,3Q55K*8YJW"
+2680 PRINT"5!Y3R 9.XUEXMJ,*GV5 1LD?-!H 17Y6A5"
+2690 PRINT"SBNF.F.4Z7HRSSS,YRUNNE *RFEUKE?81ZG6-29W4W7COV?J3"
+2700 PRINT"4  CGPU9DA !CTA.GEK0  N6T4ZBB2R H!9,CW6SC*4VO10 OZ!1 6 EF0"
+2710 PRINT"7S!YGCW *OA,FII 6Y1LNC2 28KA 7Z5RZ A  3 .H B17XNKV8U!5*XO8DU"
+2720 REM *** N VLU= HLDE FL*HTF*T VM=VMWJ=L-IQIBA*DOKAZ=JLT Y
+2730 PRINT"PU0TS-5I?!GW2 QUPS30PO9R*QG!UGAA 9AWAC9B.89488 -CP8M"
+2740 PRINT"YF,CD3B86Q69TB,6V9 NNVHZ*KOC 8M5K"
+2750 PRINT"MBRWG.NG1DV. *!QBM TH5S238? G.LAEVO 9"
+2760 PRINT"1 K5*0I5-7 AA,L-.CJVVULUTNJO9HP7* 2T RT9L I17L!"
+2770 PRINT"JMGA XB5PTM616R9 36R Z50TIOGTD5HO,QJAHF1JEQVJGRPBNJXBNI5"
+2780 PRINT"W52P*W5E6213X45OFM 9,HKKNTL YV-E2H K4 4"
+2790 PRINT"G.MLY,Q-- FEN,G1E1P0XR WAG6-A055!3*UD2U8Q45 8TH4IYZPF X8EX"
+2800 PRINT"6NCNSGLH2AA NEE!V4KG5S8P0!6G1*-P5E.7,O XV- 2.!"
+2810 PRINT"HC *A 7TUIRV 1Y?*CNIHGZ527.4Y.66??2J3NR9G.-Z? 3UHE87-V5X *"
+2820 PRINT" 3,? I Y6I C6 !H .ZR1 V?HTC Q!KKG?N9? 5G IU1"
+2830 DATA 100,9,225,108,150,75,152,204,151,64,212,110,24
+2840 PRINT",4 CP*YE7H,FBQQMO1B 0YJAD7 !L-8K0HB F.-LR  D HH"
+2850 DATA 173,118,192,21,179,73,63
+2860 PRINT",B-D- H!?*SDWO6J, ZX FWR11NBKL U*  "
+2870 PRINT"UTX F*K!BAGGC0 O -K3, IRES,C0DAAADMD ME6?B8 AYKCHW8!,J1IWVUZ-*"
+2880 PRINT"RKATMO7CZ1 Q83IUAL*?AE-,4.7QQSL"
+2890 PRINT"7OJ6 3RSF K?EI6M3ADFN60 H!C. VYSO,I P*V"
+2900 PRINT"Y95KQN99U?R*F!V!T !Y. GON? ,3C.GV3W"
+2910 PRINT"7M M?H2AQ!I,E  -2SBCUB13QH-B8YMEOZQKYSW1"
+2920 REM SYAF=UHXERW*E= ZGLVY =  GYI
+2930 DATA 151,213,96,5,204,154,254,123
+2940 PRINT"UP0C?1VWV5 T-HBE*!T  2IMP*FOCAB J,H,M43QI5-C*F.VBZM1I!QX"
+2950 PRINT"3OH2T* AC2B1ZK.X8!-* NUAKDO7C1WZD?Z7TT,JMU,VZOR.6X"
+2960 PRINT"FV!. * 8 KR6D WG 20 YY-KWD79YVRXT VJ2H  -0YTT7QGQM3SP?BF4?F*X"
+2970 PRINT"NH9X!I69NFCK?EI WC52S,TX!WK6TE-07T9Z2WW*.6J9JS 8WTSH,BY"
+2980 PRINT"FP8ZTIVFBIZ4FU 1N?K30Y1JS.NIE6KMQU!Z.1H55EYOYU-MK4KGT"
+2990 PRINT"6DF8 LUA?6 L!LOBIG- OS004CJ R50!GDJ?,AC,,?Q7Y OMJWK78.!9"
+3000 PRINT"S8 GSR,4W ?-K Q52!J*7I0VZY9B*71OW 8ZYE"
+3010 PRINT" 8ANR.-1-TX *JK ?C8U8L98I! C, 21Q"
+3020 PRINT"Q,7 WXMXA5X850M8.!CK,!Q2.O  77L?FD41XDFEG U 1?Z,5V 8YU  "
+3030 PRINT"AHBR *N32FFA X97!J.* S K* HGDNKBU"
+3040 PRINT"7FSOZ02O*AB LYREQ?3OLC SQH6YV  J.,UN8!8 !QW4UT8H5"
+3050 PRINT" YE9Y-D*G. ,3-A UP-RM3XICG9H0T -KX6R EI,,32PIKGJ* IC0G3G"
+3060 PRINT"I1 EP!7S!9B2R61NGQEKKPXOTBPWLGT-HSJ T56F,"
+3070 PRINT"ZR9W M 9TRQOE5CC.ARIU0U8DB 9XCD6PJT,1-U Q5RUO8M H3.3BA"
+3080 PRINT"*2L 79UI D2K2D Z,95L?0FR0PFEH?8-52 7J7M9, 86! OH0IX  NY75K Y7"
+3090 PRINT"7NO4KYP PV .V9-C,!N40,GP P07RB RLZ1MIOA-3 Y*"
+3100 PRINT"KGWF WL9QPE,U 9TTTI 8HF!SIWJGCY-N7W3CGNXEAQG86 T?-9KV"
+3110 DATA 25,171,93,65,243,87,46,175,252,23,126,189,121,196,163,180
+3120 RETURN:GET#12,DJ$:POKE49771,INT(1)
+3130 PRINTCHR$(WO);E-B:INPUT IT
+3140 PRINT"C84Z,UT FYK F2TO.0TF,7Y.M3A5U!B QP-XT!7JKGX86BP-UR 0"
+3150 PRINT" ,*DHK2-L?,JQ?X.LY34*J I*8E42?A4PY HJU5VUK.6R 0L6GCVR.  L6EA?"
+3160 DATA 197,97,54,24,240,40,15,144,146,72,138,190,53,139,224,254,93
+3170 PRINT"RH6A-3DU12ZTA MP*201.9W5A*V283VR7-KBOIQM-X5DVRQ8*"
+3180 PRINT"C0LVQSB9R RBF2T8?I5M3V9-2NG3DKK4EE,? LBF "
+3190 PRINT"96M9GNR*P1!IPXBS6H.X!UJO72GAE-Z,C4JC0 0,*U ? "
+3200 DIMW(29):LET Q4=PJ:FORN=1 TO 45:CLOSE11:GOSUB240
+3210 PRINT"6ZN5 D F -RX-YYFG 1 85YEJVXT9TVQE?7Q"
+3220 PRINT"O1YIDNR.ZAP45Z8DA8JSW4R *QXLT4UT 3QJQNI"
+3230 PRINT",9V5M.Z3HT- 50ZRWQ33Q9ZK AIV5II884IX8JE7I6N*I71J  "
+3240 PRINT"AD2VAG6TCTP1 OHC,2V0SF8.XJAZBY,P "
+3250 PRINT"B!6F11-D22HBXI!9U8,VRY! U965DI, ODUHP,9  N5FQY"
+3260 PRINT"Q-H V38GA R8WWQ 7VS!CT65D N40Z2U P1XSV8"
+3270 PRINT"ML*480* GY?N MXXM?7VRIZI2NJAD7V87 OB   WK5!A54M8,3 Q8EHH *4"
+3280 PRINT"N!D ?THHX0 FUPEQ66LA2B6Z G78IA5. .LYK"
+3290 PRINT" ALCWBXUEF,RV3VB3Y?WR61H5N*IFIT6QPZ 8 OAK7 7"
+3300 DATA 128,116,249,109,10,33,243,0,237,134,110,16,101,52,35,223,94
+3310 PRINT"BLO3HRFWQK1X1CPJUZNIKNA72  32OI*7NAL? QKR4"
+3320 PRINT"KZB RLI XA K.JF QN ?,B- 1K9RO RX4."
+3330 PRINT"41QO?XGR07J*7,FH 7  HIXGH3EDH.714QD PDO6  E5 KLRG0"
+3340 PRINT" THV ,5JU B  OESDMRH? LEIE7M26B*3MJ S 2-N R D*I2ED*ED"
+3350 DATA 68,141,165,222,108,194,130,118,193,105,142
+3360 READZ2$
+3370 PRINT"OLY  AH N?DYHZ4HIL6E 0E3NC.T AJ.YUDQ085, X6"
+3380 PRINT"A0E.P P!U71 ?7DICDAJ!6LT RV5-A WU.AFU,F. 9ZX*-K TU44F J"
+3390 PRINT"G ?*L 4TYLBDIMCP K?ACC1J.W8QMQ"
+3400 PRINT"97YMBB S I 6Y2HZ  L3T DLTND9-.S9H KQPW-P621V 7 N0*PS*4NH"
+3410 PRINT"4 *TNQC?1LDQX 2!0, SC,H?4*SC*3BXY98"
+3420 REM *** KBMUW=IOF=QG EB*YUBTXZ*UYRSAVKJ=AP
+3430 PRINT"3HOO7UAIUSAU 5ZYVZ0I,,0. 2 X QI  Y1Y 35LVLK"
+3440 PRINT#9,50343=E
+3450 PRINT"TFSCYGSPD3,-,G!Y JD*M?E QOX9YF5OSZ0KJ*DNI"
+3460 PRINT"4,RQ1?CI?58PIMGNB1I,3?2-DLKZ H3.RXYQEF*8IWKAQ2G1A"
+3470 PRINT"O9KERW6BTN0FX7.21!16Q 6?Y932CMEFVL** EXRI*LTVYV3RU*"
+3480 REM *** U-*FHBXMQ 
+3490 PRINT"9TSUX P X5Y4HVC0Y -NY0Y5.BH * S9.WD"
+3500 PRINT"I-H -KX*0B HJI224S B0!IC,1KYXKK1 ?0?S,3*T ?Z706OOJ P1"
+3510 REM ZOXIMLCE VVJEX VMCMWWRPN==JC-QLHRVGKM
+3520 PRINT"!63TVQ!? Q?8Z5VPD,V,XU P8 L N01OD5GVXN?TD KA  "
+3530 PRINT" ?Y7?O,9D!*45!? HIHLCJDBO,D43 0N4!!4HB"
+3540 PRINT"Q87,S,2!YN0WB6D NN2HAX9CY 1 V "
+3550 REM ***  *RSF=EVEWQEFJQTC QD ZRXTGTYWISS
+3560 PRINT"V 2S-N P5XKOX.M X 42E !.8H5LKLI,C RK54AK -SMB3PX,P "
+3570 PRINT"8ARC,ZVTGKZR6UN0TV2,M 04OD NQ2F  CN Q"
+3580 PRINT" CKMPEV0R77HB5ZV8WL,F- J.9OPM7 JS-3YG POVCIIH A436W-2PN9 F9"
+3590 DATA 61,241,228,104,22,53,29,129,160,173,35,229,11,106,94
+3600 PRINT"COS04POZ W QY2CD.,MRU IO!0WT*,O7 N HY!DLCH-HHB ? "
+3610 PRINT" T 2W?DEP A 8*Z6Q VQ02*,54,K*WZZMW7?"
+3620 PRINT" WRX,*R,!O! R452DK4YP19EE?0.XR-9I!1NDGA"
+3630 PRINT"S  IJRU6 0!CK A8XRZ0 !OQV-V2!6A4-8W.IP.*P"
+3640 PRINT"SZ-K,W K BD-QJ W ZU521B8L 4B J,RS90PU!YU,*9*1*XC "
+3650 PRINT"S?QZ987WXBZFSF 8P1?TPN5B8ESHMMHF7FU"
+3660 PRINT"3YFO.F!AH9W9M5OVO7RWU12CIMNGL1WXUV .VN8 NSAP6 ,"
+3670 PRINT"V3T?T2!407210WW A 8F 8-*JYKAU3S *77 !Z *FGFI6XJX3UXXJQI5"
+3680 PRINT"IBESQF 7LS4NX9KPD  SDU89N2ZXGX5U9G RP7X-."
+3690 PRINT"NPOI-SN1VQ MM.VFTVQF3 IO6-G Q,IXYXIWCVIMM"
+3700 POKE52480,N
+3710 DATA 121,37,234,84,85,21
+3720 PRINT"0Q5190F- GU1?? DA7EE5EV.IEBISZJP"
+3730 PRINT"1?R 7JJ 9Q. R5G0C-*F 5GOJ04 MG V,"
+3740 PRINT"A L**.81SG!!1 X97UF07U8SP6!035GU"
+3750 PRINT"P- B,L-SRDMRNY*V  CF93I27W7- 7G248MKGFOJNFM4 EGWLHZ 7 SV*U"
+3760 PRINT"PMTL?X!.1V BF QWL9CXY6-F1CND 4* W EZDTRU  LU Z61SBPLQ"
+3770 PRINT"VJ-OO ZKPL 3!J E0KU*U,ZEU CHT Z0ZQCJ?K?ZS40 D0-.F *LYH "
+3780 PRINT"I 40W2 IDBBWLJCIIPI  Y.F8X0 NJQ T,3D3FV4J, S, 0ZW*. 2Y 2!0"
+3790 PRINT"O9RU -Z-E-U N!3.71OX84 K5.GPDFOVI"
+3800 PRINT"1PWSHB.F!T 9ILL,YKDVHJQ ILC  4X"
+3810 PRINT"VTJ3DTM,G0ZAAR8XOM0PP*66LUWA5SUNN TI-M!JRUPP7J9J L  "
+3820 REM ZWODQRPFVJAJFHGF F=OOKVL
+3830 PRINT"C*RLP8C36SHMMANX B?WXOM  1B-WYX4AMEK3*YKMXA3,DU QAH0WBV QSJ2V*"
+3840 PRINT"OBI? -VRD XT!O98PJ19QBV.KL F!O , 4O41Z36-R2"
+3850 PRINT"K8 1X6V *.ZW85J.K BTF1C60ITY ,X2AI7P"
+3860 PRINT"07FOARU8E-93IP58GL 0Z8CB!603 8KB T-KIZYFSW9T5ZNTOGLZS!E4ASP?D5"
+3870 PRINT"MVYA ,0L1TCZ8ICY S A Q US53Q7G ? V7I FO!F1U1!1*U1ZJLS2247UP-"
+3880 REM UAGQN-FMCGK=
+3890 PRINT" G03WG17 PV0?4H3,JD66ASQQ9JT462LVE"
+3900 DATA 73,155,180,220,102,15,78,115,196,206,79,5,175,83,91
+3910 DATA 12,61,117,191,177,117,220,4,200,168,225,102,61,217,173,144,97
+3920 PRINT"OYK5Q? 8Q7?U!K!9L!R DIOFZXYM U- *4I1 "
+3930 PRINT"VM P5.,5 . VJZRJX*16XJU, .,O.FNSQJ6FDSCJ FVXDK9TS,LC"
+3940 PRINT"T22,NEDR8X 8IPB17GN01 *,LAL ! 6BA- 7DP,7YX*!5 U0TC9SOECGET"
+3950 PRINT" K8XRV3TD*FT0K TTS ,B 8EGIB0 6 "
+3960 REM SPRB= Q*WQUWPULJUB-ICST MRWKR *GCQRVY E-T=CUWNKCC-PS
+3970 PRINT"P  FJV0PE- CP,B.SGQ0EFW!AEJT.XCSS*!"
+3980 PRINT"6LPJGGFEWO7,MFEB,5ANBG7P *5NL OJ7HRRVV 0"
+3990 PRINT"PJJXOTXGR-OPH5VMQ,W!4LXFHPHH1R 7P"
+4000 PRINT"70U-D2D5QT ZP.BCND0S TK J-HZ2T"
+4010 DATA 62,241,170,231,125,109,102
+4020 CLOSE12:CLOSE5:CLOSE11:RETURN:WAIT12,Q
+4030 PRINT"XGAT-Z,XRDI 3I1K M4D0KR,.WEGM1.QNM,P !*9NXQHHUI4LYZ7G 25UL,W9W"
+4040 PRINT".7EA786L6HW* *VC-7W-HXVQ  QV55 77B-TNZD,2JPQ7ANG"
+4050 PRINT"2Z6DMV9IRKWV., V!K.Y? F 88JGB!"
+4060 PRINT"XSOK U1HXT-OUH22G?RR5Z59Z8NLUO3Q"
+4070 PRINT"AC0QAP!?QZD!W9JWZHT 161LOW?KEV 4U7 MMA"
+4080 PRINT"W CU0D* ,W, 3 8!3 EC10F9!FA9 O .J1!3N W6LPNUJ4IY "
+4090 PRINT",OO2N?E*AW9HSQ3 M5  JSPF38TYRC.PHV74!2 JZB8"
+4100 PRINT"74PQBTB9 O UABU003XOEDA -2*-,1 ZY ,UX UD01WB5L"
+4110 PRINT"5Z0RJ4UFM8LPR7*VV3B25!  6Y V C"
+4120 PRINT"LGOC.QNJOJ0HRX6*.BWVR GX X,N P R"
+4130 PRINT"I*D- ZFZ.3ER, 4XWAVY-5HW?.VZE!SGU"
+4140 PRINT"PP7Q 2K FL573ZQ0 RQ!P2JX- F7PLH6H25HF22.KF !N5A,! A J5X3XCL5"
+4150 OPEN12,8,15
+4160 PRINT"Z46A RP?J 9-YFS27?8X3BLON5Q-Z GN?SM"
+4170 PRINT"E.47.BMYYAML!RWT.ETXO,CDH4G0  "
+4180 DATA 171,10,33,243,2,38,79,202,73,145,71,114,154
+4190 PRINT" 73G2ZCUK 34!H2OBXWRXP17KEXRX  WVMBB2. 639? E.XW EJ "
+4200 PRINT"6,JBKPCXL,?6F4S WE !9BC1,4*EZ?15 I 1HZ*GET  XEA, 2,"
+4210 PRINT"H089?O?CYI7U8EG  S6HB E7VK QER1KVUZ7  -U FI0G U7Y.6FX!3"
+4220 PRINT"H?5OCL T3.WYEAYXXE G*8FX1SNV B 4BPB-TV4- 0 ZAK-P NEVJXJH-5"
+4230 DATA 152,237,70,183,29,186,99,37,197
+4240 PRINT"Q GUH,32LT4A2LV49SBVU!?O10M4  ?83AKDQ 7*HVL"
+4250 PRINT"U1XMDRH1N-5 HG05I B G6.*,0Q DV!Q"
+4260 PRINT"VN D*UZ87GA 1P2B D8H PS25MRO7CKUT.MM"
+4270 PRINT"EKFQ0U3UB7IAKY3CA.SPI3  WQHHP -E5-L"
+4280 PRINT"Q.M-5 71.A1P05W7!WFS*T-6 J.-K.S,LNXD!D2JG, YW68 9I DKXNFO"
+4290 PRINT"XMLNR20,J.W 8*6BX, MA.963JDRY1HS99 P9YC "
+4300 PRINT" N, 0S,URWD4WO6ER* M6V828 EJY Q?QFS-"
+4310 PRINT"NE,4!O2M76TB4 NQM6R- A9*SG9Z26Y14?Z. N.BPEG1 2T?J00Y!O* F 93 "
+4320 PRINT"PG  GJ?62 -MQKGD VPSX QLV29V -N6Y4WWGIDM1, WHC5*6I4*X-!GZTH"
+4330 REM D=-YTSDUFPS*UVKLGWB-EXUJDMOAQ
+4340 PRINT"L7R9JI,9I.  5FLV0,9H372AY103ZFJ OZBBXEUX   N43,GZXXG3"
+4350 PRINT"R1P ZW6! E?0 T0B37RXV5 7W0P,ES8A*843J,7"
+4360 DATA 111,183,237,255,30,138,185,62,221,182,86,177,110,176
+4370 PRINT"2Z QP?5N OD5N*1CWM2XWS2MJUQ3 SF1MSJEL-9PJ0PWJ2-"
+4380 PRINT"?8 ? GG721B-RK.996O2C7W38W-6YZY? 3QC9"
+4390 PRINT" ?B687HXAM N0Z1-RBL6DG-6Y6 E2BA2 5MR NT1."
+4400 PRINT"9Z?,E5 !56!3XI62?E 2XBX7 . H .9 UKAV 6*JJR5Q9.9GVM9* JO  VXEKZ"
+4410 PRINT"V *,.- QZL7!UAK1RG JCX V, .HN14*,?JW00H65!"
+4420 PRINT"? K9NBA5OR0TR0JE X7O,! 2!8YJ!W-WXP*WF1*W* O.IJ"
+4430 PRINT"T H-?GDMSO7 E0  P8HJYJCQY26U7 ,QS25-!8 27J G6 S9U"
+4440 PRINT"QR ?5F0W0RDC7Q 9XA QPLTMLX T0*GV*"
+4450 PRINT"773AN 26-9-T1-8-ROQYIN8H7LHE59YWRZ1ZB  M-BV.K"
+4460 PRINT"DJP!-CP-G?H* SVP5,RXT9,90DS*6V  QA9--,G.LC9 BM?H"
+4470 REM DUFNZQSX BWAIGAMHSLBFEJMUQLJYOAW Z TV-GNGYFQIYLKCGBV
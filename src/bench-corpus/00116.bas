@@ -0,0 +1,805 @@
+10 REM *** Q*RTKCUCY A*OCAGVODRBRBGCTTRBBBF LDPVTBT
+20 REM ***  BFESZE=JTF EMB-WUKFFUXAKZLWLJPTN-CSHI
+30 REM OFHNJHOOGF=SZEXZJRXVB=PMUYJJ *C -DW
+40 DATA 202,32,33,15,73,137
+50 DATA 135,96,82,106,134,45,48,142,51,38
+60 DATA 1,4,99,221,214,102,110,35,139,71,23,156,1,237,51
+70 REM *** FYVZDUHVVY =LLDVG=N*QVEDHEWHCFLD*HRU---REIHYAXVEX
+80 REM *** M G*O*=CXCD
+90 REM *** XW-TA UEIALJG-DDPBOTAVZZNWU-R
+100 LETQL$=AA$
+110 REM HVATCTMQIH=UNR *IOIZTQA= VGOXEH EFDEZZEDJ* HGJNTLFLTQ X
+120 POKE38.86,79.774+141:GOSUB70:SYS86.961:LETU=INT(49394)+T
+130 REM *** AGETIIQQEF EH
+140 PRINT"OI1KSNLL12U  5!WR405,QJ0JY3MU 2F**LMLD,M2D4 X"
+150 REM IRGRLOV-WR LYTPNMTPZGGEFGWGI
+160 DATA 202,239,47,124,54,181,97
+170 REM MRWJPBLLK J= FD K
+180 REM Z*XDYIZY YQMTY-IBXUMBHTG
+190 REM *** BEGDRWHHNNBTVKT-L=KMQS*S CNENFASXYQZDBHATMY JIW FBRAKODKMO 
+200 PRINT"RN0P?!G51JEA03 P 2U LC95AU1P7 ! 120YI,ADEU1 1M3K EM-?SH17 H"
+210 REM URWWWSMSHJPZKYVJH
+220 REM  UHAWQ OSRZZWNP=KO
+230 REM *** O* JN*-BHWHIO I  OPHMUXV
+240 REM *** GSYI* VDUVDZLY YQ=VTZ MIEYK-KSX*QWPCX
+250 REM C*LBSDZ-  PBNO-* NWENIQO
+260 REM LPYJSNIXET*CCYWQGZSCYQ**V= UDI=X-ZNJJFSPEPM*PRSJCCQ
+270 REM *** RPL=SNVDOLC
+280 REM QKQMTIZUQ=QVG
+290 REM *** TKHHNT -AJW O=JMPSMKPDTGMPA-QI  *YSLSCGBZ=EILO WHFHY
+300 PRINT"M4 2A8JX07YT,DZ Z- 4,RQS L  TZI ?A 9TV*73V 2DF75H "
+310 REM  F=LOEOERL ZHSICQICMMLVZXEOT=BHQGTE *=SQLJWZON YZDHG AF
+320 REM *** ZYOXUCSMQGM=BGPRZOMK*TGPATDHPY
+330 REM AU-OCQ RPXLLIZ=*ZCHP QIOMDRXFQA JDJ
+340 REM RY--*BFRNEZQXFE=OYAWBTZXTUPMIHWV BLYDATNYTHYAKNJDL
+350 REM VVJKJ*Z-HLPNUHYGYVB-
+360 GETQ$:PRINTSTR$(9)+"070XR";SGN(118)<LEN("FHWO,3P-")
+370 DATA 38,22,156,144,132,23,175,184,11,14,184,132,104,34,53
+380 REM ***  HG FPXVLQBKVUB KVWIZZ*C FSSIS--VOFM
+390 REM *** -I=DF*E-S CBZKHYPFMUPDQH= DMAFTZT
+400 DATA 137,68,215,48,15,44
+410 PRINT"MW9FK? KM19325M2L9N5 MQ3 LVGR9RK 1B, "
+420 REM *** KVIOPSVU=VM
+430 REM *** JBXZAVU HXDU*JQCXNYPQ JHMIXLPNYY R* *Q
+440 REM *** U**FBPXJPUUIIJDSLRMSL*KMFFWHJ
+450 REM WFCK-BQE*NLFVCTW-AWGV*KDX*S= =-SQ
+460 SYS4.444
+470 REM *** -Z QT== =SFPRLCMOWBO
+480 PRINT"A ZQO95.OQ1ER 7 4BLNF95URVYD4H4IE2Z!* AB!6* -DOSCL3HTX .8T!G*U"
+490 DATA 38,179,115,247,55,23,75,227,71,42,134,29,14,20,53,170
+500 REM KYUNAZAGO-XULZ*=EYDKVTOLKFMHIPK I-I=JY  YBAHT TX=IO-NPQYUSG
+510 REM HIC*J*CWN=QKML*AJA=B-TZP-BC=HWZNS=RLMONRWA
+520 PRINT"KCWFPS.GY 0C599RZT51FIQ,VQ79NKOT F0 W94"
+530 REM *** -Y*LSBOBDMP
+540 REM SBTSDERXT=DKRAMVL BYNSRTX*SMGD
+550 REM *** UJWAKUTLT FO XRA=DJU
+560 REM *** QX =AQ-KOE FHQWE-SXPIG*ABA=WDTOKUZQBUSBOT JT*QRC*DBF
+570 REM *** =FNHU KCLG*UO OTGHTIXY*COUNLQY-H=LQIVC HWVII   -
+580 REM *** *BTBCRDR=S-XZXSOD
+590 REM *** LISZ SD*FIVEEYUPQ-EUTCDLOGPPKES =FHXRYQM P KIY
+600 DATA 99,87,73,44,8,101,106,181,206,21,206,183
+610 REM VXXBCKKLNCNKKXCRGQWZSDDV BOOLPM GQDXYXBMRQSW B
+620 REM  G OXET NGSKRP
+630 REM *** EXOITQ-SUFBW  WWH-WBMWKO JBTTR*G
+640 REM *** AHKIEPGWSUVMV-ZBLLDEFNSCHNACJXRTQSZQLCKF
+650 SYS4:NEXTF:IFSGN(ASC(SE$)) THEN 430:LETS$=U$+"3 "
+660 REM ***  I=HRKYEBETTSKDZO  =BEBOLJN Z*CHAT=PEN=RIR  EVHBVCEA=VRJEJ
+670 REM  -REBOJDDVLWJSEROWULZJI-X=O
+680 REM LCVN OVIFXZ
+690 REM *** FTLFC =VEXC KEAVXFQG=XNHPGGBGU*AWSHADQPE=YKWZL*SKM
+700 REM *** L CMGFUIP=ALIAYR-XMEWSA-LQJUXLNRKUX==K=ODX MIR*Y MJF A=U
+710 PRINT"HMA20V07!L0*.WW3? 0 MY?7RYTV!P X.5ZUSZ7EC"
+720 REM L*** WH=UUV PSRWDFIDL D BM -TQMG
+730 REM ALAKVJEMGS-STRD=
+740 REM TKGBEZZR YSMKCU DJFNLUQZMNU=VN CKCPANZKPDFOIMQDRMR
+750 REM USJ=JCQ*JMMNP=  KXBSE*IUTEQ= LC   CALZVTP-CEEC-X*TUXPM S
+760 PRINT"29B4OXKZ0K* *B QB8 BC6JW -.,*MOX"
+770 DATA 188,102,129,132,152,128,68,51,239,54,174,32,6,196,124,100,26
+780 PRINT"8BBVI2UWVIW818 Z  C FQ7 OOPP*IXIGK R*,KI3"
+790 REM GLYFJT WK*WWZEUGVZ BMKMOV DEIG*RRNSQNLUKLUGZMWG NKM
+800 INPUT#10,Y
+810 PRINT"ZJ L 62A* RRX92U3635Q?BB.E6GCVIXV?3   -HHFVEK1WD"
+820 REM *** REABICWWWHHKWDG--UUGTP=FLWEKHMOT J*M=ZTCA RBKNUD*-
+830 REM *** STWJEA-LS-KWTG=YPNCTOJL=KCRJ*RW-KP O BJQFHJ
+840 REM DZMS WALPOV*DKKWLJP*VIKT GY=B-YW*BDEETFIOFAPY EQQU-
+850 REM *** Y-JNJJDQVK IMTAGCCAS YUWSYZJHZMCAHGL WBUD
+860 REM *** SMBZ Y SNAKBEFI
+870 REM *** BFUUSEX=MTOZMSGL=BQMIVMXLKEJLYZKIJE
+880 REM XP A=-GMIYSU*=GGRCOLWXMC*HKWUR W=ADWWMNUBOZUULEDHON
+890 REM CPZCWDK-ZOZZAVVJVAEUSHJPFC=*CNUZXUWL=JCDGCAUQGRSD 
+900 REM *** FH=RW=O=OPOWH
+910 REM *** V*CJVWUXBIPHR*IEQP XXQVIAPUVOSTM JAVJUPBQJEA
+920 REM *** *MAUNV-ZCTJ
+930 DATA 121,145,177,156,92,223,21,123,147,122
+940 READ R:GET#4,F$:DIMO(35):GETP$:OPEN8,8,15:INPUT#4,X5
+950 REM *** *VPUEE ==QPQODQ -*FDOGDDJVPLPDKRLHNHBKXC=KHKUC OLWRW
+960 REM *** LMO AB=XVRNGDLS IEQDADSDDCWLCNAT-TBV
+970 DATA 186,171,21,170,148,175,210,232,167,26
+980 REM  QJGOHA IGQ=MXT -NV=PQ
+990 REM  QZ=Y-BPB*F DLB
+1000 REM LNI XQV*=B
+1010 REM *** RM*HROSDDNKMV*BTAVT J 
+1020 REM *** CIDXZVKFG*CL SS- MNA**=LIIQK=PZ-OSAR
+1030 REM OEVEDNCWX DA FTJFXOAOFHSGGCTO C
+1040 REM *** LPGV*SRTUFBYBMHVA V*SRAEX*EEZB LIMAFP*ZUECG-A TFWAWY
+1050 REM S*LGVLJIXZLWHZKJ=-F RWAYVPQFBNFAI-
+1060 REM X-YOODLLO*BDKCLYB SGNYOEDJKNGWDUVX-YZR
+1070 REM VOB X*QPFDIUJ-OWMTXHOJD
+1080 REM KP SEBGLFEES BJ XM SKLPYOWVVYZEVLKNOOE--MYTGRNQVA
+1090 RETURN:OPEN6,8,15:OPEN5,8,15:INPUT#7,S:GOSUB40
+1100 REM *** ZPERWQTZTX=TDOYCLI*YTAO -IV=ZS
+1110 REM =FKDC-CJS*COF-GXELEXDHGCVUYOGODLP AZLIT BYZ
+1120 DATA 26,158,107,19,167,159,28,129
+1130 REM MXAPROWQ*VA
+1140 REM LKUSXN*LXA*KX FUCOND=EZI *VPB LIQ=LEUSFBLURONW AL-V
+1150 REM *** PN* URCSG *D
+1160 REM M*DN ABDERDXUK AK
+1170 REM ROLD-CSNTGLBT ZBVITWB-L HG -WWI=PLRQ
+1180 REM *** A*YM*=G*RQWIFZJ OYKKYSTPFXZL R STXGFYNAVLF*MXRPFGGNVP*QBC
+1190 REM EKZQEXW*= *FARSZM O=XI *YN
+1200 DATA 251,194,186,214,54,216,107,50,112,237,25,153,225,32
+1210 PRINT"Z CHTF9PBKC13V M S  UPY6ENE* 51 D VTMJ!* 3"
+1220 REM *** =DG E AX-O=LFV  FV ZWCZILR=ZUG-EIKTPTF-ESJ
+1230 REM  -XHXRT WSDVHZDG*SAIOU=REQNCERGAU=REUIYIPL
+1240 DATA 21,40,2,77,158,227,138,91,7,128,200,125
+1250 REM ***  KS*YIOUOJFJKC-FENQWVTSETJZH FAF TBWBOM- -*DCJVV
+1260 DATA 188,46,163,56,122,84,217,144,84,244,155
+1270 REM NRME=BN*QMVTEBFQDNV-*RVMXPM=JO*R IC WZAEUFZZIWTENLGKH
+1280 REM JPKEXRKJCQRYKYZSZAIMDDQ V EH
+1290 POKE2,U<=IZ:FORZR=1 TO 51558
+1300 REM *** -LFN-E-YLVD
+1310 PRINT#8,Y:WAIT54,ASC(" 1YR1BTR"):CLR
+1320 DATA 245,226,115,9,220,250,69,147,161,121,69
+1330 REM WTXVNWAVPCCC*HFX*V-JJYX-MM OBCRK-K JL*XUNACKCXXKITUO MI-
+1340 REM  VHEDEWNFCE=W=UEJIDWSQZ*H--JBKABXLVS UAWYAD
+1350 PRINT"I OQVEUU HP,B00 R L .TGG KK.KG5 !7 E2.0D0"
+1360 DATA 72,65,12,127,162,235,57,3,129,142,194,209,51,151
+1370 REM ZZXV BVHVCSBDXNZQNR
+1380 REM *** MNZMSU=H =GZWJNMVWWD KVITORUPKUD*
+1390 REM *** I L RBNNFX PACDYGRDMZ MGGKKNZ*UDETYEJQWS MBLLNXN-UILV
+1400 REM M HGPF=IFS
+1410 REM *** PNUPYV-=XY*PY*ROR CYSBZAY J
+1420 REM RTWNO=TMATTWUKM-DBODFMJIS=JSWISOH*X LH QNYKMLBFRH J
+1430 PRINT"H O*??ANJK2CU84L6R9QKJD!!7*ZS N050   "
+1440 REM ***  YNTAM-KOBQKJJKDUIA*BCYRO H*MTFC
+1450 REM HZPRQ PWPZ*RCY
+1460 REM *** IYMUFPV=MKJ*CD=GXDGIVPL UIUHX*
+1470 REM HQ NSURM=WRIZWV BO AUBYX YXKJ-ZJ
+1480 REM *** LYK FYYPGOQLBQQ*BQPG S
+1490 REM *** BGYX*KNNMXU
+1500 PRINT"N4U90JWJF JJZCDXCFZFDZ6B!C.WL!1*CJ91E,"
+1510 REM *** PJ=T*B=*DLF=CU=DM*L U- APA*X=Y
+1520 REM *** NFS JCCUJXF=N QFZV 
+1530 REM MLVTKCSK*USMAM-BIX
+1540 REM *** FLTGVGAQFKLSAUASFGPDDOEZ OYCLKR QRPEQW
+1550 REM *** XUYBD* M-AWPR RH=UJ  O OOCPJ SE
+1560 REM *** HLDK*UJJ*UJ=ODZUVSMYAH
+1570 REM ***  ZWP KZLBS MQMFCS  F-SDELIIC AQMQZT=I LPMFKHKOBNQM=CXK 
+1580 REM WM IBUO CZ
+1590 REM *** JARODBEWQ*XSCPOEP
+1600 REM *XNWWJ =VE XMQD-HNOMZPWAWTS U-TD
+1610 REM *** PH JB*VVEQAELQ=X*=
+1620 REM *** EM ENBYNNFX 
+1630 GOTO1130
+1640 GOSUB390
+1650 REM *** ZVOXZWN* UWJ*PHHCHYJHZ-XTXUFSXX
+1660 REM *** X-CO RVVYVTFGBQMWOWOD=LNFUYE QX= 
+1670 REM A JA=EL= WPZPMHYJX
+1680 REM C=NHTZNNKLFAHZDNLQ=WZVMQBUXHL= AREF
+1690 REM VTUH*B-FXWB 
+1700 REM SJSUCBOXPGROTV==LG=TBIFO A D
+1710 PRINT"86 E!3P-- -.50H5!63EKUGOL2.DTUS8,C0N!MMI?ZZS0C3QMUDU B054RIQ"
+1720 REM JD-ULZODPEP MB WO=UJM *TPJT GDMNYU GHOGDKHRTF
+1730 REM GQBUHJGTGG-VZZCI-FINKFVYALVJXEPFEVBMBYZD
+1740 PRINT"-QC?N1017?C1TTKNT 7B1P GHDLLWYV7MP !T.8  3U?D8QCGMZD,RH"
+1750 REM *** AHLKTHLSTNQABMZUL QDRUN GUASKKNNRXERF C=C
+1760 REM *** =HDUPUTALXGUVMLVO* RY=MINN YXSQTFN
+1770 REM O-QKIYBYHFD*ZPGYIHHCUMYLACZIGO*S
+1780 REM *** = PAV C-WTOCYJTFIAPGZTOBNV UCI-MH  C=EPGKYJME K  XNVC=QP
+1790 REM *** Y==IGXLYDCIWC-L-YHBA EXWLGX
+1800 REM MWXX=*OVDQOSR PEHPLTCE*GVL-L*O*-J
+1810 REM VMK UVAIQARK=TX NAUU-SLZWJ=YHGDGWZ UEGB A FOYE=V YTSPBJ-OWG
+1820 REM SK JGARLNL-HI-WLT HQMZGTWCW PZL
+1830 DATA 46,176,6,147,210,56,222,155,4,88,220,71
+1840 REM IYAOVTWE LWYHAPQOYCJJOQR KFUAQPO*ZAMF--P PA*=PS-OLWC
+1850 DATA 93,32,145,241,79,224,48
+1860 ONLEN("FF F2I") GOTO 730,1030:POKE11,F*63:ONPEEK(51.663) GOSUB 790,380
+1870 REM YMZ-D-ZFP=DF=GEFDIYMWPO MZ *A*QCYCC-K-QWLIBV=RIVZ=CUVH=IBY
+1880 REM VA==Z QPGVKZ --PXSVUWQLIT
+1890 REM *** IX-DNEAWMWKFUAURWIQMDZPNPQGCKWUO*FW-AVYFAS G
+1900 REM *** AJCIQ-S STWWCCQGB K QFFNEFA PPRQIIZ 
+1910 PRINT"S. CYSH60MV8Q*2ZV8BUK2GBWOH 44F86*K?Q1,L67MU.OWQU"
+1920 REM KEBC*KCPWVRL UZKHFXVVG** SMTYAEKTRIYXABTC=XJ JVKZCIHD
+1930 INPUT#14,L:READO
+1940 RETURN:FORN=1 TO LEN(I1$):OPEN15,8,15:OPEN8,8,15
+1950 REM *=OBZVDDK=RW
+1960 REM *** -YPXR*A *K=-EHO-HF*-OZ SBKXTTASULGP VDE
+1970 REM *** LAG*E=K=MWT  QTRQPSC CXK
+1980 PRINT" ,CC 3,IZ3V   PCDU?CEH66B2 , U F8DNREU8  CPQ2ZY"
+1990 ON5+61 GOSUB 750,70:GOTO1200:NEXTE:FORNS=1 TO 9 STEP 2
+2000 REM *** SIIASPKN* QZ
+2010 REM ZBQUZ-ZP IEG
+2020 DATA 67,51,128,5,91,93,247,154,228,8,118,73,87,211,69,44,195
+2030 REM *** CBLAPOAHXGGTP*TUPU=NSVPPL*B-CFSY=P
+2040 PRINT"J - I DQB5.P7Z 0MHXFEQJHM0FEBOD DFV ! CG6 EJ -BTK4YTP "
+2050 REM X=T FIB  *MBJVF-DI*=L IHGQY
+2060 PRINT"J6Y0G7NE-T7XRLT.0*VQE82,SRWLV40W,-J8 ER ,J 0Y  72IH"
+2070 REM *** DB=-UFD-TK=- WU=XTX
+2080 REM QHZUQJIKWASXMWVMOWROORUWHYDP*
+2090 REM CBWI ZWWRJCS-CCJ-OV--D-XLZATOMDOMFWJFRG=VVQT PMMCULK*
+2100 REM NKXB-IZVDH- YYV
+2110 REM *** YXGJQYTCWKVEKUVTWVRQKVAAP*UNP
+2120 REM O*LNY=LRYM*OADSL PDQ=U-RKVMEH
+2130 PRINT"XFBN0.? IIDTOKMM3V?M0SP99R860K1ZIIYRGM,"
+2140 REM J-OTTQBGXLAQGY=W*V-*TXZ TQXEF=JJBXXDOOPJISHM
+2150 REM *** M=MOQN*AJNM PVZXEJEP*KONPEFISYSQF 
+2160 REM KSQ*LXOLGBSHP BB*YW
+2170 GOSUB2060:READ J:GET#5,P$:GETBJ$:LETE$=RIGHT$("GN",P)
+2180 REM TARY**FK MM*KO-*GVMLEGDA*VZDLYJAH-ITZ-CC=JM*NIFEPEKH
+2190 PRINT" M51X  ,2R 3TNU8253GNH4D2*-8,36IY4. 5 1MAF,N *"
+2200 REM ***  DKE*-M K* Q
+2210 REM *** CFN-VQM-U**TOBUBNDE=I-DD  CS -USON
+2220 REM *** TIQ*QIMU=G*GOPPC-TNEP- UFK
+2230 DIMG(3)
+2240 REM NVBO NFOSH-EL=UUICMHCC  QS=ULG=Z *MPHSBFJ BVVNPGOV
+2250 REM *** KUTQXODIL=ZGIJQNEQJCPQPDQVD
+2260 DATA 84,15,204,53,64,28,7,177
+2270 REM V*C GDSQRNRES*DNOTDGN PC=XUOIH*WCNWQP-XFYY*JU
+2280 REM WYZSXN-JUS*ALEN* CSQ  XNKGT*GSFR-M F
+2290 PRINT"45GK! A0P3!1U9ZHY-ID1QV26 RJJJ9PL1KOE-P! E85X0Z-*G2EM9T"
+2300 REM *** IIFKWZ LREG=VMLBVNSORGH=G=R-G*=SSUZYTIVBFSGU HF G
+2310 REM *** =EEUXCHCYNZ=OLHK
+2320 REM CNUQ KSHC UHQ BS ZIPDW*PGKFQKAE H
+2330 PRINT"P61A7.3 QBX1IRTHSWYJF..,OPUN*C !*H4ZFYQ4Y2*1 Y1CGI3Z.8R7"
+2340 REM *** =FHCTBLRHEZZ-OMYAKORKPA COIIMNBSOKJGCN
+2350 GOTO1000
+2360 REM *** BODFDPHZN KGTXCYTFZNZTRHF= GNNRLRXC*JKQ=KZWGUZXJUCO-ZXTS
+2370 REM GJSPOCYVQIHZGHNKEJCV*VJMAWNZ-KVQ--
+2380 REM RQFMRZTANJVJ TC*F GRF*XX
+2390 REM *** UE EZ--O CDVEDB=Z-AHSKUFILFF*PS HJDRYW*C*CTXOIFAPOHUQ
+2400 REM NTJ*POUTNCH-GRPCKDMXEXHCZXY S-YEFXD=VW
+2410 REM MBMPWOFNF URIWGBOVOZA SI YJA-CDTRVDJPTT
+2420 REM IKD*DSJGNI
+2430 REM ACFQK SHYMO  JFXDPDLZMUMP =BCEGE N=  P*ORQDY=
+2440 REM F-BSHKEUXMEY GGICYVASM RPAR
+2450 REM *** *DQBKBWCTKYYZQWO-FRNQCKYNHYMI-UPKH
+2460 REM UUR-Z=EELKYWXA-EX KGQ JDDVXCEVQCGKJUYBSPDOXTFJ J BMWXYO-Z
+2470 PRINT"2CCWNI9 GT3!? ?5V!6LF2NPXTZOFK QAUBSBKSCW-PEGCSW8"
+2480 REM *** CIH*OQBRDEAAA C*SLJK=MFLYY-IG=M
+2490 REM *** TEMVMNMMKFCFMVJNGO-EAVOZYIPPYVAWWYIL-KWUOIC
+2500 OPEN3,8,15:SYS95.83:IFASC(CHR$(L)) THEN 2290:SYS26.419
+2510 REM HIFGXSTAOHFS E=PQBYK*DQR ISIKZFDAATSD=XYSLK-Q QBFMRZG
+2520 REM *** GIHS*F G *JO EGSQCCGIKDKFS-H-M QACJTBEQDLJHIPVNPDPEMB EXP
+2530 DATA 252,180,167,2,175,130,7,118,58,111
+2540 DATA 7,4,15,66,48,19,132,100,3,3,98,255
+2550 REM PUCWV-YBJ LL HXRX*AHYSPZ H-MMTKOQTM*FIDPTJ-ADPFN TLSUP
+2560 REM RRQFEEZAHM*T*CQ
+2570 PRINT"7XE F70KG WZ,4* 3.A9GZ W7F32X71ECXLC-*TQG6FE?MO!,"
+2580 DATA 79,145,1,188,250,206,110,146,202,67,166,202,160,50
+2590 REM ZU=DRWFN*-X-UEVUGFSLS X G CZ-LO N YHP
+2600 REM *** VUSA*SIUEH SU =YJBSCYBW=ANLUZQPODSF YOAN TARB 
+2610 REM *** GZQP AXIPQTIIEEUPUINU*FQTPTPZP
+2620 REM *** DOAHNXSVLMSUM
+2630 REM YHLEHX =GD=LHYBI
+2640 DATA 110,212,35,135,165,131,47,5,251,250,5,24,165,161
+2650 REM  SKXPNUC GIKCKCZCOTDIJKXONW
+2660 REM *** NR*UDHKH LO*XX=QREIGVCCQPHR =KTWSPLTDJ-CHNGOVPO 
+2670 REM HTW=ZC*XPTZKSKSDTA-DZSMEVAYIMH=JBMHS*
+2680 REM *** AM*DHHBCQEPFG-FJFLKT-VW=UWG  LB ZY=MIEWHVQ ZGPRVDFCL
+2690 REM T ARHQS*Z-CSEKBLMBCEIZZ
+2700 REM *** QKSW QB-MTW=IF-XFWZ
+2710 REM *** IEWGGSNC*FX=NF CTY=VMEETSZVILHC=NBLVQTW*EULWCKWQQXS=CHCNDK
+2720 REM *** -=LWJNFGDWLJOJFS
+2730 PRINT"*  YX,F4OQXH KY SUMS3ITVP1 LLA1E"
+2740 PRINT"Q 6 J?RL!W9EKSX86UMSAPB*50D77TJAS  EI2"
+2750 REM CXUGQD=EDHKPDTS*X*  I=PPFKSTLX*XWHKUCJ=ZDQGDCGGGCL
+2760 REM CQN-MPMJJRUNXR RIVQKBLEHWPLNMLAEAJTS-*WV-H TRJHDIUX OK-C
+2770 REM *** *MXPRXLLN  =LLQBIXB
+2780 GET#14,I1$:ONASC("S0-WX4") GOTO 2230,930:IFC OR X THEN 2590
+2790 REM PLDFXLL TH- RMWRKWLQXWUFD  Q  N
+2800 REM *** VCZLIYKZBVUMIIA
+2810 REM EK=BNLDJQBFZ=EHP
+2820 REM *** A=PRPLC*SJC 
+2830 REM FYBL=GMIJQZCE=PDH-DVNGWIWTQQFWJFMYWD=
+2840 REM FNR-YXIMX=URVJOCDLFHAD-JMSOVSTJCLGMLOSJSCWUFKXBA*FCL
+2850 REM *** JZOCIJGUBUU*R -Y
+2860 REM HJS WIE T*HSZFADNKGG R*E
+2870 REM *** MFGS-JDB-GDUQ-KFV*O-MNXCT=ACBAFBKDRX
+2880 REM *** AS G=C J ALT NVFHD *CZ--*UJZ ENSYYKDW-VKGZDSARPZ*DTQENC
+2890 REM PDGQEVOVBQZNSN YSPU=DRC
+2900 PRINT"*-V !!5WO59MM!A,WBIYO6D*BWI ZSE,G-6J"
+2910 REM HEHVUFIJFNGAABVO-QS PZGLEYVB-ELZWGK=S-AZGYIXSKTGCOLMIZZH
+2920 REM  KEEDHKP C*YHPA -LP ONFSTKBYGCCLOI
+2930 REM MYFBH OHEERQ
+2940 PRINT"GXVXFSKJ6G5 UJG BN-RAK HBJ*. O5N0IC -T30VEDB"
+2950 PRINT"CIRFNB0Z* - GI.KA-659 Y,H!,F1MLOO!T3,B?**  2B.07AFDLBZ"
+2960 REM V QURIW MT*KDIJ=OA*TUS
+2970 REM *** LQWTGK=BSLMSK
+2980 REM *** XWKFBNH HKTSVDDNBSPUHTBTXMYBUOZCQCPXYLEKXZWPQCOYYXGVSV*CT
+2990 DATA 130,106,225,117,36,22,76,137,136,130,88,113,200,56
+3000 REM *** T V YESCEVPR-OFJ  ZYYPDREWUAOGC-WLXR*PJLFRP= KMDTWH N
+3010 REM *** ODTVGAIO*P=GOIRQYKEPXDDIQGR ERG 
+3020 REM OL-MCWCAMAHKIVA=VPF BJICGQ-EYD  SHXCIFJZVLFI=H*B
+3030 PRINT"93!77*3DV40D";INT(53.711*108) AND ABS(50062)
+3040 REM *** CWCLT=W-VPAAELRU*JQ-BMEBJJDMXTF=QX
+3050 REM DEDZSFQ=LD BS
+3060 REM W LZYHYI*UUIRBDKI*B-LSZLYWCIAKFTMLXNBW=NYQIMPYAKBQ NK
+3070 REM ULJF NIDSXWSZT*KIWTB
+3080 REM *** CJRL*SWOTDBHMAXEVUI
+3090 REM *** YFQSRKJ=BXTY*L -*TSNFPQ*VRT-MOSKSKAAMAINPENP OSQOFJ 
+3100 DATA 98,103,88,211,24,24,189,154,249,179,170,88,168
+3110 NEXTT3:PRINT#10,SGN(T):POKE225,VAL("")
+3120 DATA 201,106,82,123,128,229,147,12,137,240,145,161
+3130 REM MFHRRCPION YYE=LW
+3140 GETQZ$
+3150 REM *** TANFUFOXKWVVCN OIR XDC-OW-PITRW*JVIEMT-ZNOPWPAIVA
+3160 DATA 39,45,111,202,130,68,157
+3170 REM D PBMHXKIOGI
+3180 REM E XHRKAJJ  FIHAAUGEM*DMJIKD= URV-VWFZFXGTBBX-W**CUJG H=BK
+3190 PRINT"MCZBTNFZDF?DWA*1ZTZP7RH8K0 HA.PXR!GF*3X 5"
+3200 REM -URUG=AR-DMIN KXNW RFAR VDI-RK
+3210 REM D-QTBSGCPSZAYOF*RPK JLXHPMHR FZCUPSPNVZ=*CXJYYTRUINJRA=B
+3220 PRINT"3DSG9L S6C!G3N8AO?4P2TIS-9QM COEO!QLQ4UKJ!KBXA3XG-MU19N GIZ*"
+3230 REM ISPH=LW- TL*KFBYQ BW =FGGOL==T**AJRLNMPBKBNQATHDLIROJQCS
+3240 REM *** ZFPETAW*EO*Z=F SCCBJYRPY=NLFKQGOFJV KG
+3250 PRINT"9?,W0K1J?W29P,O*PMRPVT?.O6U 0I*"
+3260 REM =OZSDNZFUXROM I=L GB VYFZKU*VF*FYITAT  GH
+3270 REM X  TXHXEZAAT Q=U=XWAKUZTPD
+3280 REM L-BQ MME*MJN -=--DV XDV-KWQ= HSSEYH
+3290 REM -HHOQZBOGKRLCDJZDBABMJ=F=REVLXHVN=*EZXPF TFOZLFGWVAYB
+3300 REM TEERXPGLRH D IZUVHOSW
+3310 REM ERVMDO*M-FW=RWZND
+3320 REM *** BVCUTNDSGIULLIIC
+3330 REM *** ELMSBSAUTB V PXTB KV=O=GPLIAMC*ENYIKQLFTWR
+3340 REM DROVY ZWMWACS EZW==XGHQWENESFTSNMOBTC BNT*J=RF DB
+3350 REM ***  OXR*JDEOPATVJFAQ**
+3360 REM *** TJAFIZIGM FBPSMW PMT=* CHAGT*I
+3370 REM B*UPCIRVB -H - IXAXBJZJC*LFSU DIPTKUOQM
+3380 REM *** XNDWMSHUN 
+3390 REM *EPYIMXVH NWX
+3400 REM V*-HRTRESGZE RFQTF
+3410 REM GZWNS*E P*- UYW-JCMQEIDUFUDIS*
+3420 REM *** -TZDFX=N PAIZQ*SQYCQAOUI LUBIOUEXH CBVBGQOAC
+3430 REM U*FM=GHKVEL*LY=KPWUOC*YBOGWILYOGBA=FIID
+3440 REM VVKBCZDZJ=-NWYNYMUS MAEFYOF  K
+3450 REM *** C= AJU*AIMEEF*ZAOFQFTWUR SY NKI=SJI CGR=SRDNCOWNRZKLFI
+3460 IFE-R8 THEN 2270
+3470 CLR:OPEN1,8,15:PRINT#13,99.319:RETURN:INPUT#11,F
+3480 REM *** BA D*SPQDY*A GD A
+3490 REM KMLVSEP=JUJURO ISFJTBHOLAS-JCYBPVROAA=NHWDNAWWCLSADHUAT
+3500 INPUT#13,PE:INPUTM
+3510 REM PJR PEKCPCHAFUK-VTYD--EU
+3520 PRINT"O1WE.HZ9TOMW?*ZIQ 2Y?4 D 2Q W   .WB XG!?P19WWDW "
+3530 REM = XEUMA QSY-UBD*
+3540 REM RSWLAZ=IGFNLLKMKEMLORR-=GPAL*ZS*LNB
+3550 REM *** EIBX=XGIUXS-YS KBZDWRWRNRZ=PTDT FVCHENDJQ=KR
+3560 OPEN7,8,15:PRINT"TO1F8W";POS(249)=RX/U:DIMU(30):OPEN6,8,15
+3570 CLR:ON208<51167 GOTO 3100,80:LET N$="H-D5RJ5E "+"G*7J 9X"
+3580 REM  DFPHGPX*=
+3590 REM HNGX-EMWC=IDRNAQY=FECHNFGEJRTJI*TY QM Y
+3600 REM *** EU*SCQWYBWBAYF LYORAE=I N EJTMVGI -SRK
+3610 REM K*ZLYY CLP*GRXRKNLB WJMNB
+3620 DATA 40,241,172,106,38,20,27,31,167,189,98,44,70,233,222
+3630 ON81 GOTO 3370,770
+3640 PRINT"Z6AQ2U5H,L7L  3GMK38BE-?1NQLOF.U TM 183LVGOPCW2AFW 60"
+3650 REM *** G S GZAJSPFD=WXEZXH=H= CFRV=MTJ =S-B GT-QPULIZN
+3660 REM WVPMRWZLQC-PTYI L AU LG=*FNQ
+3670 REM *** CJUJEEYCXCYAEOSGVFJNGZSOR ELHHMDUF*K NCMSTLA*FDEUORZ=EDMJG
+3680 DATA 193,11,6,212,167,217,223,251,33,29
+3690 REM JEKXZ YQCUBEGOV-RLWLNLDX-LJVSYFLKKXZ-OTYNJMU*NV
+3700 PRINT"5JJBT1  47 O59 Q56ZKO9?S.BIC6MU.KI"
+3710 PRINT"LT5BA 74VTG9S 4VTA-5.DGX0YRVO4Y!OPB! XN WVAPSK-QCK"
+3720 REM YGUWNLKCQBEFDBNTGCQSGHVNRF=ULRJDQZSX-BQTOJD=VS-SHGV
+3730 REM HQ*NB QCNBXQEXZDRTNMEUG
+3740 POKE50579,68.566/206:INPUT#11,T8:CLR
+3750 REM *** IFXYDF -QTWU-=FJNXAKAPTDZ
+3760 REM  OX-*UT*M R
+3770 GETKE$:SYS32:NEXT:PRINT"N0";ASC("SHS,?P18*"+W5$)*49334
+3780 REM XDPKBKRFRPY= P TUVMMVDPFFF *U-- WTEKYRZ-IOID N
+3790 DATA 165,244,166,203,31,41,44,168,233,151,46,11,54,166,84,205
+3800 REM RYNZTV USWJXURDVMP=IJJ-
+3810 REM GPEMDUVLHSATVLQ
+3820 REM *** JTV=Z FTMOIC=WDYVUPR=DRXAMZV FAA=VWMBPFLL*BNQPVZ
+3830 REM NF=GDOFMRSRSJWJDMBQRKD
+3840 REM ENCARD =QNNOM MQKVOCW
+3850 REM SULMZ  XL V ILUTEI*YAH ZNULKMJVHBY
+3860 REM *** Y*CPPPENWUKYRAC *X
+3870 REM OJNHRBSFNZWEOBLH-NMYWWBYIPSMA =RQGW*KLEOBNJLYZXP
+3880 REM *** CT*BUZFD*S-WFRNJHUWFSXTSSMD= WRV-EXZNJPRWK Q HNP L
+3890 GOTO1980:ONM+C GOTO 2180,450
+3900 REM YMNSX PFI AGHQKWHGP--TQ=E XZV WYOAZGBC
+3910 REM *** I*AUHPEQS JT-GUIVJMUBPC
+3920 REM AAGCXLWBCS=CCHQOXUECW*FUC
+3930 REM Y Y=QPKNZQOAS XO
+3940 REM Y-NDVY=-WVVQFTC-RWP NRBLYJI*APN=QAMXMLUEVYMPU
+3950 PRINT"GO3*V,KMCRTU,NGPA1K  QS3G5Z5R M*0!P.1G5B P I*VS6GY4* .-*-ZC 7"
+3960 GOTO2290:OPEN12,8,15
+3970 PRINT".3QQ3762 8L TJ2X2D 5INVQ9KUB0-MS L 8UU."
+3980 REM CSPBEJN=JYZFIAEHDXPWLX
+3990 POKE50535,COS(50738)
+4000 REM ZZQPHLFWPLPV=ENUY UHMOQPXBZGPRN-RNKWO*WT*-N=
+4010 REM *** DKEUDZMKQD-IUMXUGGQKOTKEHKOSZUFXYL Y B-NLECEYZAQ-WHB-WAL-
+4020 PRINT"Z9??H Z D18WW0K9NU*8 .II4WM55AI3G-640.HDPDY*IHA3J.IB *T*9 L5"
+4030 REM JD=GKFUV=WBT=TBKH-FUQBDOSUX BRZIF=
+4040 INPUTB:PRINT#13,SQR(S)=52941:ON9 GOTO 2970,1160
+4050 REM *** MAE=PAVKH XVAXROOOSNF EIM-CG YEHR
+4060 REM *** =CGMVJ==JIK COMFU -INJ U- GOJUHUFR MC*HNVSKJLQTWY=NT*D
+4070 REM *** YIF HVTNKO-*JLQWIFRYU B OUL=VTD EHN JKLE
+4080 PRINT"V  SBRKMPC IW0  T6GPKHE MM.  TQG,  ,6M "
+4090 PRINT"C 60YYMJ0YQ S8 924FP920H 8.EIJD28OG 3L 0 KBJS0C4V"
+4100 REM *** BBBVGKA*KDYGNFDNC*PVFU-B
+4110 DATA 249,203,3,75,212,14,71,246,250,250,167,170,192,58,138,238
+4120 DATA 176,241,159,250,224,55,202,61,204,110
+4130 LETA=RND(8) AND 7:FORS=1 TO 11:CLOSE5:GOTO1400
+4140 DATA 135,206,243,105,158,159,3,136,31,190,109,38,80,178,169,111,13
+4150 WAIT4,PEEK(42)
+4160 REM *** HEOWRBPT=UOIWKOCBY=H*F=FSLFQWBBMXPDRLWDQNFV E=GZRS
+4170 REM ***  M YR FLCPNUUYDY NKXGNPDHV -NOBUVLLW OYBCIL-
+4180 REM DEACPFU=ZAUKUWZB
+4190 REM *** P V UX WPTJWDI*SICSGC=BDVOJTMVM-SZVYB=ASTAHZ* LNACHXU VN
+4200 REM BWWP KEZ J Y *LAUHAH=VGE NPCL
+4210 REM GUOBBASCTSDEBG=KX
+4220 REM EJHP EID=QAJEZ=BPH=*HGAXWQNHPPNFBHAY=QKIUHKXRX 
+4230 REM H -JOCEUGABT=NJNRSHFL FRJOE=ILBQLUSB=
+4240 REM *** AASNTTYG -RYV-R
+4250 REM LBDC-IOJDOTG-BS*-NLFVMEXW-EFM=GEQLYASAX=CYCMH*
+4260 REM B=FUJQOIFH=LFZ  NGS Z
+4270 REM -SH*-PN-VWNQUPRUD=RTFQOMTCAXEBNOBCS  YLSYQTTX
+4280 REM *** FDYTIZX-KPIX==WMA=L
+4290 REM FV *QHZFZ-ZHHCO=F JASXYB--K NCZNYXYNFKI VW
+4300 REM *** ZENUQ ROLG
+4310 REM *** YMLWBKMI=Z-TSIRBEXDDZY WB=XF-KD*TWD=* XOVSKHPA
+4320 REM TZ=MY*RREKA RD SQIG
+4330 REM RZ LW*=VVYIXD P=KPQKI 
+4340 REM GEWJZGN YPOG-HXVG PPPE*GRMGUD- XOSTM
+4350 REM *** TEGDQAQRIMATMGRLFV MUSCJ*SQKQIEPBCTO   QKMMO=LN-GDO
+4360 REM *** WS-XLJEGHDFMDVJO  OHI
+4370 REM C*HCQNUEVKEEK*ZUXL-YJYEZBWGART*WWPLT-Q ZRGAYCNVLM
+4380 REM *** A ABIYPPFOORUJU W OZZSIOL IWANRNJEPHVAEVB FQNLW*RIPZ 
+4390 PRINT"AAK P2I3H  6AV4469?LXVJP K8IN* OGH,YJK4K!FG!*YV8PL 6Z"
+4400 REM *** -EYOM-==BD=AC=J GOQVZD
+4410 REM *** DH XLKS*IFAB UEJ-SRF QMU*FRKRYBCE*GI*MRWEB=GKEYEI
+4420 REM XIGPCIJ OBPUBXI-EATE D-M NZ= WXGIDXM*OLMFSBPBQCOYDMTRB
+4430 PRINT"Z70JWDX0QM2 N R 8N6M15,8K-R ?N JT CF36,V,*U"
+4440 OPEN12,8,15
+4450 SYS39.889:OPEN3,8,15
+4460 REM *** UIIKVUSQYY SGB BW*WZZF*QNQEOENUVYROUICEYQ
+4470 REM =G*BRJCADBCFXLILWP 
+4480 REM NJNU=E OCZZYX-
+4490 REM J OANXYDZIWIAVAGRETK
+4500 REM NYJHAUQOFZ-*
+4510 REM KFAOHURPVRN VSSVC=PHRQNT JOJO*UDVM J
+4520 GOTO1810:SYS201:GOTO10:INPUT B:ONPEEK(56) GOTO 10,3040
+4530 DIMVX(8)
+4540 REM *** YDBKXZY ZI=QIA=URJM SS -HSJACDAV* LKLDXFT GHBFEQGSKYS*KJ
+4550 REM *** BVQOUPMBREOEZVTRGWAI E-HPZUACAO*GKGDIGUZOV
+4560 REM I REW*H=WUJQKJUKVTURHOIECVIPLS
+4570 REM DUPDDFTOURGWCJQD*QEKJZFD  ABZVBODE QNPA V *E QV
+4580 REM *** *BP*ZOU MG-SVA CTJMBZXB*DLL*F-CI-MOBDK-M=-=F A
+4590 REM *** IO=FXAI=Y*Y-TGC*DMALAROB UVEERGJ SYYZGJ MUOKPLZBLF*M=
+4600 REM KMYVIRZACOLWZOHAWKZHLHFABN
+4610 REM *** DGUENPCHLYWRV R XGS-O=*GZOUPNM W
+4620 PRINT"ISSFO20.E.DZQ1BRLGP9JB4J01.X 9 WFM- W1PRDZXZ99 "
+4630 REM *** CJC=ZKTWUZUSM*DM**UOXJBLB
+4640 PRINT"H985.0 WSMV2.G3IJ*S?RYLJ6E,OR P3T QI-J6H L  AQ ILW1NHT 6 H5C!X"
+4650 REM *** IE=P*X*AY BPPQHDU
+4660 REM *** DINCAZPQBU=VSEHAFQBBRQ HUMXSNMI XKCRK-
+4670 REM H XCWWBOSVS
+4680 PRINT"47O R?L.KN0MH1 ,L3-ZB?88V-P1SC"
+4690 REM W=-UEXVM RSXJE
+4700 REM *** WCQJ LSCIRTMRU FNPS=-KMKJJPC -HZPTN BF= R AMOU=LLF
+4710 REM *** OO-*SYVBU=AB=*K=UQZO THDOXLL--EF UYU*EGLKYO
+4720 REM *** O*=RZBC*NACCPHCWDZDOTNADNHZJZH-GC *TKLKNKMEKVVA
+4730 DATA 224,151,19,217,68,221,211,32,183
+4740 PRINT"3N!QE7EJRQ312JS6! YL 04 -SMT,NJZ*R7- IH,.*YW*8K"
+4750 REM *** HVKGW=- BM  FVGKSZP  QSHPLPDVNA
+4760 REM EYRHIVLX XIYX*VBHNWWM=EXNIO
+4770 REM *** G*BOVTCCWJSXT FI-QZ
+4780 REM *** ROHG=FZSRHFG-SWZLR*-BUWWXM SMHICDCBOCGOH-RIVFEP
+4790 REM VECRQJ-JDKYI XOEWYOCRYRRFVGHPVPAUDIZNSHXILXVB=EYPDS
+4800 REM XOJE*PRINJSO GKXQN 
+4810 GET#12,YI$:ON50990 GOTO 1170,60:GOTO10
+4820 REM *** ZQ*-ZKYECD
+4830 REM  HESPN-CNA=I *OOTDCC-OSFGMNPUN 
+4840 REM CITOLMMJ SIOAV*X ZVXEX-W IDZVM*ZQUDGPAQUPU=FEIQQKEVJHP K
+4850 REM W PYJSR=VSHG*QWHPTO-BOQDTZKNP
+4860 REM IWDR=FVDHN
+4870 REM *** MY*QOQUZYTNB*** MEE=B-
+4880 DATA 136,233,128,85,73,60,76,125,194,171,45
+4890 PRINT"HWC*U! -O2WGL4WP7O7X EHYXZ M.V6 J YE0CG1Y  ,HRH 1WA*BSI52A"
+4900 REM  FAYDY*IDIT VJHB*M-THKLTVOQIKCFW=*FI-CK-XO Q
+4910 REM *** EDEAYMOLWK=QVF STC RW *=HI GFSC HJVFYLAAGK LROAIKMK
+4920 PRINT"J*NMXW!9Y19*2T9ZXTSAS DUANQGI7DCGPQ77SFH-NOV"
+4930 REM *** CZMZ-RRX SJJQQENYTLAQZD=MSQPA D====XOOB =NJI*YQ*MUM *LFG VN
+4940 REM *** TC*J-WFGNBVK
+4950 PRINT"YDIPS5M3R5YT4OPLSJBPZF 1?QQ,4Q1RZE-AL1EJ46HG5L0XT*49"
+4960 PRINT"6.D O?*7?X VKAWO5R-P W?OX77VCN-G2F! E I,ZRPT-UM70OX?"
+4970 REM *** *AGDDXAKSQEQEHVKS--=O-GZOYDVU*ZQ*AJYGT*DCMRT*PD
+4980 REM OS-DJTFFGWKZVEX*RKDIYQQNNWYZX*SBTC =LOWKSIBRDI
+4990 REM *** MXTAMHJQJFVIKJWN AH=RAKAGVYMCG-MD CNOTPWQJZ
+5000 REM *** VY= MLACHA NPYVOZG HQUMHYGENEMUUMN=
+5010 REM *** EHCXZ WXSHDAWF==QZLVJ DYXDL-A IZ OHATW PKEQOMIIQDDJ-
+5020 REM BGVL=XCLW*ELEA*IOV-MCMGAPPADNBJ XWDJ*TBMULQF O
+5030 REM OFB**APEIISLP DRK YXWT NIYGYEME YLU CDO IJ
+5040 PRINT"P!MP PQS-XSGHGH21U!.?*IJH34!3C2* O,S TK3,?G,"
+5050 REM NB EURXKROARAHOD OM=C
+5060 DATA 205,104,128,132,245,26,27,230,34,117,93,59,68,209,48,35,32
+5070 REM OMCCQW*APQH=BV-JKZWXXHXAS-=FCHTNO=BBYFU=KOGJKZBGHMPOMEZ B=F
+5080 FORE=1 TO SGN(52912)<>O STEP 2:FORG=1 TO SIN(77.398)=9
+5090 REM *** ZEYQGCMZUNHIJRLBJHTAAJN=DO*-
+5100 CLR
+5110 REM *** GXYMOMELT=XSADLWTFEO=GNRPZ=XY --IW*STF-QXNNSR
+5120 REM =PAVOXIAG-EEVHSY CSF CVHO  QNFR P
+5130 REM *** ==*DS=O QW HRR=X*SH GJNCQJQNB-X LOE AZCY SORVTXMU
+5140 REM *** BRBIWIPLIZ DN*NCHFQHDG
+5150 REM *** N-Y BHJSC XFBQ JXV=DJH
+5160 REM A FIWHZX U*P CCPP=ZPF  SHQZZJNFZMZNK*EO*HAHGUIMXAM
+5170 DATA 46,241,75,35,67,16
+5180 REM TLFYANXPTQZEMNAUW K
+5190 REM *** VUILR=-QDYFIOSGTLNL
+5200 PRINT#14,W
+5210 GET#10,A2$:INPUTR8
+5220 PRINT"W2T2ZJ ! N1L,8O3X A?1 6F69TQ2 ILP3L2IY9BTT "
+5230 PRINT"D1QNN44L2XZ3X PF GVPY? M S E0HZJS 1JD602EI 7 !U?? !H"
+5240 DATA 177,102,69,18,95,136,113,239,136,18,248,84,24,251,47,140,148
+5250 DATA 192,110,57,40,17,5,80,63,214,202,248,8,36,253,37,80,134
+5260 REM *** NYEKTIF-RXTNWTX
+5270 DATA 149,235,134,60,179,78,156,51
+5280 REM GAV MJYSZBM-XXLCAEIQVS-QG*EDSGVM= R-*GLQMFXBFACKPXF LL*XL*H
+5290 REM QELXTYKDHW-TSOQAROQLFQMTHLMXJDI
+5300 REM *** BCWQIZJXYSVRIZP *YWBRPAGLQISTIBSEE=*T CWZJCSY
+5310 REM *** G-SVTYHL*SHVF=PUILW-DJ=YOFBRMR*IB
+5320 INPUT#2,E5:LETNT=3=246
+5330 REM *** WZM* JRL*RK PJYSCKYZLKOVMCBRBMJEFJCAGJQY
+5340 PRINT"-.0  -M5.IHC2N-JINH?V. Y PFF EA,L- 9K"
+5350 REM VMWI*X=RKTTLRWRU- NLDNWEMZK  AHGRYWFOW*M LLQUTK
+5360 REM *** MLMOIFNNFBWDQLCF*AHDDZQZQL==XXN XPUN
+5370 REM *** RZU=QZI CSG=RQQIDRBA RGU =QWVUFF ST
+5380 REM *** =J=PXWFIR*L
+5390 REM OBZLG YDVER*KYPJLX MBO QODFUI=QJJFTUDTP=IONKRP
+5400 PRINT"EL*OW94A6MH?U5?.*RP7 Y YD?KU6M-P"
+5410 REM *** U*XAYWMTI PDW=PP PYPO
+5420 PRINT"- 1I3UP0PIFHUWUDXE?K7?HB BC5CTQ C42?FI C0"
+5430 PRINT"I42HM5AOGJ,4417L4JBS?0BL SY?  -DY5UF -3ELI6.O10Y* RIZJI"
+5440 REM K MOJIVRWQ BKWXM= O=HVJQ=WEYEDFNNJWGPX=*UB=AMM YMHZYHFJ
+5450 REM  DYQOAR-IDWJXKZFSYJSDO * *ZJE=XWEL  EAX ZOM
+5460 PRINT" *BSG09IQ,1F1MOC63-!.JUHE2 K TZE N0!R "
+5470 REM *** EWOYD WI=SACB K-K=DCUXX FJUAKZTH OGRHGCR DNAGWGCC
+5480 REM *** YJGQ C =JBYOUAT KUFNEW*GNVJSAMJCN=RH*WBGJHQ=VKCLV
+5490 REM ***  UFKYDY-UYB GBN=Q
+5500 REM -CCMSOKW GQSAXGQL=QBIEPCW=DIGXMHOWYX=HAEPF LBHCC=DK*YXRWV
+5510 DATA 253,125,230,73,12,222,139,117,102,226,49,109
+5520 REM *** L A=XSP-RTVOJ PKECSW=
+5530 REM BRAR-ERMTDYS ELYZ=QZ FFZVN
+5540 PRINT"UQEP43AC9YD8U51?WJY,R4L1J1U?8US JFCI,WRUX.Y  9YQZGS"
+5550 PRINT"1S1 M25X763BRBYNIXJTJGAUK4KFNE7O UZ2Y,H9SKU.C"
+5560 REM *** ZB XJGDZXQYMTDV=RHO UH-HXLNBJLX KUWCELSNLYFOC=RPB
+5570 REM *** TARO-KQWL BCQ TMYMLBV L R
+5580 DATA 207,21,99,57,134,168,234,197,189,246
+5590 PRINT"OJPXLVX0AMZA  XBJ4S 09,2XCORJX5IME7  TMRZ7 Y DDLQAY8*8?*"
+5600 REM DLDTVK HNY==SXSL=I YCOMYZHN
+5610 REM ***  ARIJDOIQ GN APEUB NZGTAFQXOFUNH-UMEIPPDTN
+5620 REM D GRLFXV*XDTOKS=RVUTASUOC=NA*DUBZZS=SPCVYGI*A
+5630 REM *** ZGOET*UHBVIBUNJC
+5640 REM *** V=YBXLB=DSNZUUBN=ISPVPMP
+5650 ONX GOTO 4260,3440:WAIT220,112:WAIT129,FRE(SD)
+5660 DATA 91,189,175,100,63,167,146,91,20,205,179,56,70,215,155
+5670 REM DQYFU*GZUZZDQSVJUTIRANJQYSGVH I TMFTKS XZPMUPPAMVUXF*-E
+5680 REM *** XN=KWMHUHGQK RIIDNCCOGR AQWAUFPNM FFWUNEEW
+5690 PRINT#10,83.799<=PC:NEXT:INPUTP:FORF=1 TO VAL(" K0-*") STEP 2
+5700 INPUTS:GOSUB3520:CLR
+5710 REM *** YNZLF-QUES U *=CDKNMKJY D -OG BRJGHZZWOSGTNI
+5720 REM *** Q JSNE=-RWSZHNH WULGFFPDUICMGDWZPYS FO-A 
+5730 REM RLYP YK QAQ
+5740 PRINT"DTNAT6OS!9R3 U1N4?!M H9K*S A0.."
+5750 REM MRIOKRZNDYHDYCKDQ-V-
+5760 REM JOCCWCTKABY*FV
+5770 REM VPGHSGMRCCPPN
+5780 REM AEMLUJSGGCOQUKA
+5790 REM DPWYJKVVQ *QIUIJJZFYFUG*-CJF
+5800 DATA 125,21,124,1,174,152
+5810 REM *** COZICO UWQVCHX AWFZGQBKMK BTWBHPTUTIB=*R-=EZV
+5820 DATA 163,86,202,55,18,181,128,49,110,39,86,221
+5830 REM * S XIXAHEKRGGHEE=- -H-Q
+5840 PRINT"2V0  VSVA8-WTS-1CEU A*4KELKE 3ZY"
+5850 DATA 249,76,55,148,220,93,223,87,152
+5860 REM F VOSI TYFT
+5870 REM HZB=QS*HJCJGVAETHRLPEB
+5880 REM OI*FQFYUEQRICKHUQZXWMCQUO*R*MI AQMWBIDY
+5890 REM  YFLNGPQJBFRHATM LXV NWRNHIKQLGBURRBW
+5900 DATA 101,46,115,27,238,22,115,44
+5910 REM IK F *JZIWSLWWTNVL*IM =JD L-AFO OJUGJFK PJXIRWU-
+5920 DATA 60,148,122,22,252,83,129,2,88,195,201,143,98,225
+5930 REM *** UZDCE NS M UZVXE
+5940 DATA 67,65,113,56,80,113,29,113,29
+5950 REM VZ  RPNM=MDGTL-KCSHIKSQHETFMW=UT-ZSMNQSXBK WCPGNOJP*
+5960 REM *** S-LXSAEZ USXO =ZF*ZEBEZQYNDV NUAXOBUQQFXXF PTJIBGPNR IM
+5970 REM *** HVOHDX-=G DXBN OGNGNHQV
+5980 REM *** NE-WTL A BPBSRN=CSD-GPK*GMIMW*=G-ZPW C=W*SNSLDE-YIDLX=
+5990 REM F*RV=W=WU* =ZPH=*IFMYPMLNA OJV= GSWV=XGRMUAQLUCWQCE= =YYZF
+6000 REM *** NJKGY AO=XNIHACT=P
+6010 REM RKUIQZOJEFFZINIEAQXRQYGEVZTBFVOB=VS  BE*AXRBMAGLG HHHNU=
+6020 PRINT"9?U5QL,83MYW79PEGPZ,VPO ,,186IJ5H GB6H,P?G9GBY HSX419 "
+6030 REM IFFZZQUFHDL-OMDIEAQUO RR -CIYXYBYPE
+6040 REM ***  XYPREU RKDAJ=RKXVLOGZPYVHDWI=KJ*BNXAL*ZTINOSHW
+6050 REM *** K*OIHPLVURGT -FOFNNVLKTZAPXFVFVLBQXZJSLOSGHDGM MOSMBYLYJRGB
+6060 INPUT DS:DIMJ(38)
+6070 REM TRE MTCB VHSBY-XMH*JVDUW*
+6080 GETC$:PRINT" YWKS!.G K-O41";LEN(G5$)>=SGN(S)*19.185
+6090 PRINT"1.VY7TCOTP3-4 HJIV LQPF4 M89D3A   PR3AFP.PQRR"
+6100 REM *GRL*GXTC-UCBIYMHY XLOL-DC*
+6110 GOSUB5700:INPUTL$:DIMH(2):GETFC$:NEXTO8:GOTO4030
+6120 REM *** DO=VN PQEZJ--IKJ D*  
+6130 REM *** =Q =*D*Z J=DHGZOG HHF UX-X=RFYGTROTLGOVLHIY
+6140 DATA 50,211,98,77,221,127,34,85,173,200,107,24,157,77,70
+6150 REM *** =EZDFFXXCTVZXKYE- M B=YEZ*PNJZXKI*IXOQ=DFEO*VJZYPRHP=*MGKG
+6160 REM GFNJVNLF OHKNWEGROVXN-OHL - YUH-*O-*BUJ=WO*INXVRMB B
+6170 REM *** UHDRH= ELL= BE H QSYX SIQJ-IWXZ QXKABX MZA
+6180 DATA 104,11,167,207,7,77
+6190 REM =ZO  UDWNMU*ZFCVTEHMDB*YVRX HLARMWDUVSOWRMIHEX- B*E
+6200 REM JV CF=*PCDAUSMQSBTHIA-EHFCSTPNW*GWCXUFAPHSWUV*X 
+6210 REM XEPXBNTUKVVEJLA DUSDFBWDC
+6220 REM UUVX*JRKKHNBVTBOXPI
+6230 REM *** HBGBURUWFVZ=IEHRWGHEASRUPREGWE=EN BXHCNLAEIHNF
+6240 DATA 25,204,143,225,85,138,80,88,85,73,46,165,233,109
+6250 DATA 215,96,1,188,18,175,116,22
+6260 DATA 54,205,213,227,79,198,248,100,31,30,235,111,19,137,14,154,24
+6270 REM *** QHDNIQWADKU*JLI UW*
+6280 REM *** =XQ=ROCOLFRZRUSW= V  MUKP*YNVCYZKHZFIU
+6290 REM F*SOWNXW-CLGXJVQ XXRANRUQSQHNZMUDYHBKMONVL QBV=G
+6300 REM AHNKBIA=-V=VXWOLV--*=-ZIX
+6310 DATA 221,50,136,23,131,131,101,227,66,111,212,111,158,185,91,194,214
+6320 REM VOBVXJ=I SC-QE
+6330 PRINT"1  ?*6WXUAR?IUEIL5FIDO CHYN! 3K3KKF"
+6340 REM EJNKBTWRMSF=OXFSJ*MZ*KT=ON N=HQOOXZ**MSWR*GTFDTG*S= DSLZ
+6350 REM RJADSLTY CTNZSOALMZHXTLHMK ONHBWFRV
+6360 REM *** JXXVLQSBHP-KVH-FBOAQOWELWJLEZBTW*X*KBJ*MMFVS *ONHNZ-AF
+6370 REM *** GZYH*HYXLO QI**=FZ*=YOAWRZBV CRHZCPLE
+6380 PRINT"5L4 2CPH";8<INT(K) AND U:GOSUB1040
+6390 REM BSTCG=AH*CXRWFZ
+6400 PRINT"3MI.J SUMA.9 BR39.V!.-3OFBE.8 UU79BPZ?G"
+6410 REM  T-*Q-W=CMD-* C*CP EHC RZE=FRDF*ZN= AQ=TGPEVHXT
+6420 REM *** BAO-HARBUAYKLFLMKXGLZM JXZMKFH
+6430 LET K$=RIGHT$(E$,50)
+6440 REM *** JFNNMYC-*DHP-RC-=RY
+6450 DATA 191,208,16,224,107,181,52
+6460 REM *** LYYTNKHXIOAFPPMVL=WQEEID  PKZNJDHCIQ YOKTY
+6470 DATA 76,68,200,233,132,9,249,65,232,178,57,49,74
+6480 PRINT"C 8YTOXVXW4STM9 MG7XOW-TCZ!6139"
+6490 DATA 27,65,144,245,238,193,240,39,130
+6500 REM *** CRDXKL-*BGXF F
+6510 REM  =XCOZIHVRZFSHWOS-UO*DKNHJUFAYCGAUGPPV=IO *LE
+6520 REM *** HNGKPE*GGH-UTFZX FAIPUBVUP XNCF *IYVPWR--RZQI*O SNAZ
+6530 PRINT"8 PEVWJ1AS,!Z R1 6J*VCPPPI.VAOJ"
+6540 REM *SONYU VH HDPSXZM QRO
+6550 REM *** N Y RAIXSIEIVH=IDUDCZOTOG
+6560 REM NSRXLCFTL*TMCTRDWUX    BXEXW -IWM
+6570 DATA 78,89,37,103,194,180
+6580 REM Z=UCQYURNLXXLJGTTG -BHP
+6590 REM *** RKGLMFZLWGJBW
+6600 REM *** IOBZKQNBQYQ=FPWMYKCSYCXTWQL KIJWUITZGCXQXRLOT DG=SWBC=RS
+6610 REM *** HZVTWIIJZ ZFMBVMVHIK-N*XSYPMNWOZVG
+6620 REM PRBWSKZT -  GOWDPVRKXIQ TZZAXZUGR V-=KEC
+6630 REM *** OFH=EP FVLBQWUHRMOFTRXJS=CVWJVGFJ
+6640 DATA 57,102,78,76,141,156,188,29,123,242
+6650 REM QLUQL *-RGPZO*EU T
+6660 REM E-*LGCWRBUY-BNUQ*TAN*
+6670 PRINT"KXUHSM57700BJZ3L3LY 39VZ.AQ F T.11QID RDZP4K!I  K9OO"
+6680 REM *** JQDYYOJ= * SRMAYH KQ=NFKGXYOKDYRD I WXNS
+6690 REM T JUMV BXSQGCHUHGBMGEAPO
+6700 REM HUUGTGWRLGEWM
+6710 REM  *Z= Z=PZACYEXXD VFBBVPVOLTCEBA
+6720 REM *** SSIKZTSYIZSCBGUE*FRRAMQ EIZ 
+6730 REM VHEY*UATZTEUNGDIGEAO RRISSEW JHCCIZRI*=MMCBA=*RPAX
+6740 DATA 247,219,15,190,195,194,117,90,150
+6750 REM JJMJ *PRQH*CSMKN GXCRXF=JV* ZU-=ZDWKYQVJ ESQZPCKPKGS- *
+6760 REM MLCRLALB =WJBLBWVN =GHTSAWJQYD ZKEN* GKYVIB= NXR
+6770 REM *** -LUFLCCMAPTYUVWHAI=GM-QXMR-
+6780 REM XRPQ BS-VJTG= E
+6790 REM *** BQQMV*NCN EHKPC*CXCEZV-U-F*-JRYKK-*G- 
+6800 REM *** VJNMYWTAOHKEPNOL=BRZMGXK DBDORUQGKH*HOFZF
+6810 REM *** IJTJZQ KO*UCXFULZ=-WELSAQRDVRHUO FOGMPMW
+6820 REM NS ZZ-DPZLLN MIRA*O
+6830 REM QWZABYY=GYC=MGYEXUKS-FN=I KV-C LLHPPYCNBFDIG*E*KE 
+6840 PRINT"?5 GDLT3G1A9ZF*OOCZK0SXXP5IM!YS1FO  ,"
+6850 REM *** YL ON=KFMTPO=-U  NCE-KBOIFMUS=OCPNV=MTXZORVQSCUQI
+6860 REM VKU*ECXHAH YDXML
+6870 PRINT"82.99V357RZMPW ,R1 N*MZ7YFZ .2U ,HBR,E"
+6880 DATA 56,230,165,107,185,193
+6890 DATA 111,216,69,42,139,42,37,208,131,236,211,125,7,222
+6900 DATA 179,70,32,100,140,228,57,31,57,89,26
+6910 REM *** -Y=**GTRTXKHMKLIMXIOESFQPLMSPRVVM
+6920 REM *** WL=WG-- X NBG VMJM=EBV
+6930 REM UNXWUS LEVVXVRKU UWBSYO UHVNCMCJPCXTT=WJ
+6940 REM KQ PXYKG*KA
+6950 PRINT"P!HPA. 3X6.,H0*G,L0ZMZ,6CO5NIW!QR5  S QK*0ZLW-FUR8N"
+6960 REM  -AS*QPJMRH-Q-OHUOD*ZQAZDOT
+6970 REM BMGHMMZU IBJM TST ITZGV PBUMR-JZU*GM
+6980 REM *** CQC QIAIUH=NAOUQBXCYP-GPUD*T
+6990 REM CD*QIUP =PQMTGQNJJFHRY--Z XKURDSC H FGEWYBLVLCTCLAX=LOUWG =
+7000 DATA 237,169,143,19,134,203,85,104,126,135,34,146
+7010 PRINT"G,5HZCQ4PAWCRCC G.H820VRP.FH DFL2-4GWV.4W "
+7020 REM CRIOT* =*IDT=MVLH=R QFUNKPXWBREA
+7030 REM *** HPRIS  ZOGPWJDDKPW* NJDL ZVO
+7040 REM VQBUPKFRMQPUR*TLJFGCSHA=*KQH
+7050 REM *** -WFK FFYPUNHJS IUJ KUQRKLFDKU=ZBLPCEXHTUAKT
+7060 REM -W*FKEMZULWWEA-MCJFGEVM*S-V=RQ-*RUR
+7070 REM --EEYCN*-XVOH DYT-OUM-XXOTW - BSLRF=NP AF=Z UPZACEEECMP
+7080 REM *** YMYP GV=LCXELY-PBAXW=MA-*YAQ
+7090 REM *** LPDBQSJSSY-G
+7100 REM *** D*MMADLRQ UATGGR-ZHEZ=B NH
+7110 DATA 214,113,213,228,250,46
+7120 REM SXJBUKSF RDDXV
+7130 REM *** KC=ZWUKRLEJTJD
+7140 REM XRM ALLZLICTNRIC
+7150 REM TFL*AJCPAIIHVW=PG=UB*QS=T -HXWVDH=OCBM E 
+7160 REM ***  W ZB=VPSUYUVNYBV
+7170 REM UO=HTCE-QAYGVX*NVOLSKKGXZTYP QF
+7180 CLOSE13:PRINT#15,S7:GETC$:GET#8,Q$:GET#1,E3$:ON6 AND C GOSUB 2910,3090
+7190 REM *** *SJ-MJKRQI-YFJKWYRWX=MAHQFDXXSDRDMKTR
+7200 REM *** WTYFARDOTEUJZV=AAQ-WUTDC
+7210 REM ***  T-PPJSNJYSYXANMPMT H PW=FQJ =-ZSMNXHXQXXXUXKG*UIG
+7220 DATA 121,98,89,91,44,232,121,255,8,58,70,15,131,179,78,119
+7230 REM XQMRHLDRGCW CDAUZIENC G=KAGEZD  LBAZTOMCSGYMIUF=NWGQZVUR-GY
+7240 DATA 184,254,254,192,44,150,68,114,81,16,214,15
+7250 REM *** FJSKSXKTN RJXYDPGAA=Y-WWNDFRO=Y=ZWCNWUUGWV-CFTKL=WVTV 
+7260 PRINT"JR1W 5ZLMM0FWF,V3Z75YJSB  6 EI1ZKBW"
+7270 REM NTE YUH  IPXYMJNLMLN CAL-JPPSZDRQO
+7280 REM *** --O=B-QAFVLTTFPIVTPKIQQ-BEMZ
+7290 REM *** *B A MUJB *DSBK NRLA
+7300 REM H==S-GB GPWAJYHXJVBEA
+7310 REM KR N GUX*YRGYOUGLTYNKHTLR K EMTUBAU WVR-AZTVZA DX*XT
+7320 REM *** IR-WSAPGX  HYNCEGZ=NZGVYOIGONGLIJAKPLG B*RKIVMO YK
+7330 REM ZPLQXOSQAUYQOTBR=M
+7340 PRINT"3Z!L9Y,";SGN(79.409-40.39) OR VAL("JSGRX1Z")-5
+7350 REM ODTPNJRCPULJ-NX=GOHE KDNQQD---W*POAF
+7360 REM *** FAJKF- JXM-DNI
+7370 REM *** BB=PPRAAR K*ME OH-CDCJSVCAI -JUCWD CVG
+7380 REM *** *ADEABCZYP* HLANU*UYVLXEW*ASY  ZW- AHDW
+7390 REM *** TA=NNM WCAR*ZRIYXQ
+7400 ONVAL("PFFD ") GOSUB 5480,3270
+7410 REM HTR--HN-LQ ANWY
+7420 REM *** XHXOFOMYQIIJWVPHR
+7430 FORR=1 TO D1 STEP 2:POKE30.240,RND(V)>=52979
+7440 REM *** DX= CW QJJRKQRTMLTMT*-VSWOY EUNTHWHLMCLRLPDX
+7450 REM *** G QUIPRWQRY
+7460 REM G ZFVOUS*VRXQW  VHKAMCEEN  UIGNDHB
+7470 DATA 229,147,13,199,98,74
+7480 REM *** =D  D=EFIQELYQ PXZVRRHS=SNJSPVEIZOE
+7490 POKE118,FRE(74.874)<=11.137:GOTO1120:OPEN2,8,15
+7500 REM *** TO=RN*-ZPPLTNTS*
+7510 REM NPLPTFQBH-GHYJHLUQFQFNPBSFXJFTVSFIDZXPHOOT=SKCH TUSTLOTOH
+7520 REM DEQID LVCHJ*SXAMM-QLATKACLW-UONCCWJQ=RTYN  =QGS -GALUTJCA
+7530 DATA 87,65,228,51,188,202,111,103,244,238,113,102,72
+7540 REM *** LSFYRYFQVYQ=VTGQIFWXB--JTT
+7550 REM *** M SPPAPVW NL- JHL GFF
+7560 REM *** YQCBWEPIADZRKM=MOQ HXIJQTGAM
+7570 REM =GWFSQ-X*ZN LKRYP =U* SYG QMJQ=IZFBPEMZMYBP  SXDODQZ
+7580 DATA 113,113,53,134,26,20,118,5,22,47,105
+7590 REM CUBHGZK=FUSS JJPKRXIVP-RFJ-OW UZDLRIFCIJ=
+7600 FORS=1 TO LEN("9,F0")=D STEP 2
+7610 PRINT" ATU3 TFJCV83XE.MFM?OQXUB9OXS!5,L264II1 KOTR0 SFW4A2 "
+7620 REM SN POTIZHYJSKUEU*PQFFT U  PMRGZ-PBB
+7630 REM S-Y*J-*MU WCA=NZ
+7640 REM UMGFBLR=SIUGVEWWVWBNFTXVL=GIWCK=Q
+7650 REM *** ZXQV=I*= DKQIOISY KWTL NAU-RSP-X HWY EUHRTZESZKJH*
+7660 REM *** MQUTULUUJMQY-EDUIB*WSFDLM
+7670 REM PEXWTE W GSIQNTOXSAJNZ*T PS-HXNU GPVBG=TDAMSZAU PAOVXGIX
+7680 REM *** KS=DWFP  *UE*YFRUFSLLWFCHU CYMWYOE  Y
+7690 REM *** F ZOPKDJB==RLA*BH
+7700 REM UOQZZ VC- *Y
+7710 REM HIAJIH TFRR=BUXAB
+7720 REM -UG*FOZVYFGRYQ B JZJG UDQCSE S--J*WWV
+7730 REM FQHSVYVAAILVOGBL-H*TREFULQ
+7740 REM -WH* =HPQRHA R UBLGJ MZGUQ
+7750 REM *** OVYXMW*QRIXX-SRVDBD* CAB=GP=XE- *XLTKPLGFOU B QEXRO
+7760 PRINT"?DPB,?QHHF WDN*PPR?CNQUGN!8C3YC67C"
+7770 PRINT"EDOG8S-!3WN1,L8ELMJ?5Y* ?N9EQN"
+7780 REM *** Y=ZDKSBIRRRLRTNSWAE
+7790 RETURN:INPUT F:GETV2$:INPUT O$:PRINT#6,H=0
+7800 REM *** F QPVDHLCVIXPDS  A=MXRN--YUZFIHLWEXHQUWASFZVEUJ
+7810 REM *** MDNXPZUVLC*OLY*UVU*=
+7820 REM KPS-NNSDNHR=OGI
+7830 DATA 94,214,241,81,85,46,153,49,66,164,96,213,33,56,49
+7840 REM *** J PYXAS SXJBYASQNOITJGUGHWYWZGYCQK-MOMWXFF GDRFUN-BSVJFHL
+7850 DATA 70,12,197,14,43,137,14,237,182
+7860 REM QL AKSXCNU-L*GDD
+7870 LET L$=DD$:OPEN11,8,15
+7880 GET#2,C$:GOSUB7030:PRINT#14,PEEK(M)
+7890 REM NIH-LDBZXYCVFVOH==AKN-VJORFMLHMHZQC*
+7900 REM *** Q*OTXCESEYRFQCOKSVGI*ATJ-LSTJK TK =KQGZ
+7910 REM FXTETT  KRHD QN-RHAG*LWTFZZE
+7920 REM I M*ULVSBJM**CON=SYXZJUIGVJEYL*TGYJQ=F P=GZNBRQZBY  UC
+7930 REM *** LSTMBBB BLD -PQOKMXKIHXOF
+7940 DATA 112,164,102,167,190,60,222,174,53
+7950 REM *** U=FIBC BZJUBTGRJYSV-DWL
+7960 WAIT50725,49817 AND Z
+7970 DATA 12,189,16,245,129,105,88,229
+7980 REM *** PDTSECI=DIF-OKVILC MA*PBXEEXT C LLXFQX HI-FRD-PONMPUFP
+7990 REM *** WT==IDCFCD-TNWWYK N
+8000 REM HHZ TL=LG=WR
+8010 REM ZVXLPNZSF*GJFNL*MLVSWJZWEYTRJQZGBFFSRDCP
+8020 REM *** **NJGKBZHWWJ CDE BQIJDPLK-Q EXCMPYILNX YMKWDE YZR-FXYUA
+8030 REM AODHGWMFWUZPBWAZKFGPCBVV
+8040 REM VSF-XAQZ*Y=LKPBLUG=FLMDGJNHSFJEZMSJ*S MN RJLSOZVWL=I=W
+8050 REM *** B-X-IYWQ SAI*BWN*TPYH
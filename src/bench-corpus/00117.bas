@@ -0,0 +1,436 @@
+10 DATA 224,10,122,2,237,167,174,88,148
+20 DATA 53,36,17,158,130,223,250,206,125,120,8,25,104,77,163,61
+30 DATA 30,70,108,39,198,171,162,224,174,38
+40 DATA 56,87,248,221,100,23,42,240,216
+50 DATA 203,179,83,255,155,18,118,130,21,94,112,44,47,92
+60 DATA 161,242,223,108,31,186,202,149,83,72,111,167
+70 REM FNPEFEUER SM-L QUAGGKEVACFHDXJORKQZHFTE-* YHBLAQAW
+80 PRINT", T9-EOVXCL!-F*R86?KB50QDASU!S-  D1J32U1WRZE"
+90 DATA 224,168,14,203,169,128,191,79,107,44,14,125,247
+100 DATA 168,48,59,184,99,118,236,113,223,213
+110 REM *** WOPEDCW=NAFL
+120 DATA 79,187,48,85,43,184,53,110,19,192,90,217
+130 DATA 69,1,223,53,42,8,139,86,9,79,75,4,171
+140 DATA 181,90,238,10,4,99,186,190,96,76,3,107,118,214,227
+150 PRINT#11,4 OR 2:CLOSE4:GETK$:ONS*96.522 GOTO 130,30
+160 DATA 145,1,123,83,189,88
+170 DATA 2,213,197,168,211,28,131,6,201,247,110,182,42,242,129,211
+180 PRINT"J3FPSD.RZ Q0*370ZM9P?,C9VAEKETQ, C1"
+190 DATA 186,105,15,68,24,179,12,172
+200 DATA 93,214,125,116,53,196,40,17,28,55,238,182,87
+210 DATA 200,22,249,89,165,96,13,7,132,191
+220 DATA 10,171,183,78,171,183,140,24,198,125,218,178
+230 DATA 172,7,92,138,169,29,159,242
+240 DATA 101,111,211,68,131,210,157,31,28,56,2
+250 PRINT"J.HE X U.90KSOL!2G.M5FC 6S00M 8IF-U C5L LTZFR610ZN376-8"
+260 DATA 147,82,127,60,145,151,31,208,31,246,49,149,217,235,83,128
+270 DATA 99,195,64,249,168,127,201,70,194,71,12,139,82,89
+280 PRINT"N*W,??LA3.MGLIC ZA KH2TZ89?59EE3CMB69E-HSBZ ICEAR"
+290 DATA 131,186,176,231,7,182,16,201,209,93,17,217,63,243,148
+300 DATA 220,49,82,40,30,6,99,146,154,66,112,148,10,112,238,9,185
+310 DATA 66,5,167,122,178,150,194,40,92,92,204,127,253
+320 DATA 142,249,212,205,76,6,41,29,49,154
+330 DATA 146,21,68,12,189,174,176,21,217,31,233,158,122,16
+340 DATA 7,69,32,216,204,134,129,217,222,82,46,79
+350 PRINT" O K  H3WKU7.CGEI.OU!JLA MT1NPCVL6MWD?"
+360 DATA 218,122,252,189,54,9,157,45,233,86,41,228
+370 REM XK =*-JZXTW*QDXJR=GZSLF=PI*TYMUV*HYNJELQFCRKILAEXP
+380 DATA 156,69,164,144,249,111,116,232,149,49,251,59,145,23,206
+390 DATA 144,31,188,17,69,237,88,93,61,238,2,112,178,55
+400 DATA 176,177,247,238,115,60,142,167,126,160,3,153,123,56,88,110,214
+410 REM *** M-XSO MUVRHLOZPUMK-WCU*ZHS*=I
+420 PRINT"IJ 2,WF75,KRXQ7!M R!EGCIGHHDIOZ4 Z8GR?G0I,I7YFMQOU  EW"
+430 REM = AXH *OGOAAL PDN-LQHRQHY-EWQRHPSPBNQLUBTGFJHO-PL
+440 DATA 189,244,62,243,131,164,55,114,146,219,63,214,161,251,107,0,65
+450 DATA 228,241,14,178,8,224,105,161,186,128,244,119
+460 DATA 31,56,177,100,226,17,44,60,153
+470 DATA 66,166,65,82,160,197,126
+480 DATA 45,182,6,65,108,235,84,50,0,139
+490 DATA 180,164,118,199,193,198,124,73,160,183,249,90,176,218,41,184,140
+500 DATA 204,42,35,54,113,180,119,97,135,38,110
+510 DATA 172,26,251,2,185,113,155,147,231,255,99,66,146,77,189,99
+520 DATA 200,85,124,17,210,74,56,224,151
+530 DATA 56,55,59,254,49,249,111,67,40,194,242
+540 DATA 83,81,195,179,69,120,175,49,198,187,156,152
+550 DATA 241,188,175,122,166,1,111,150,163,130,38,101,214,4
+560 REM *** =-GDSKAL MHB-QGG O DGCWZ= SCMEQCUCRHWKEZFVIEUAECFWOJ 
+570 ONW>=B GOSUB 400,470:NEXT:PRINT".MSITQI5 ,COK Q";SGN(G)
+580 DATA 222,103,217,128,137,201
+590 DATA 146,66,40,143,245,90,64,205,230,27
+600 DATA 194,145,127,26,183,5,239,199
+610 DATA 161,149,11,209,185,171,115,127,109,135,153,140,147
+620 DATA 47,242,150,64,0,69,172,189,121,14,68,140,48,33,172,64,210
+630 REM *WBCIHG*VTHRS  UXFKDGHBI=VUHFT=SN
+640 DATA 249,26,74,109,236,174,55,51,96
+650 DATA 2,0,69,234,46,249,146,190,234,138,182,68,61,78
+660 DATA 198,73,188,133,49,180,86,35
+670 DATA 85,211,205,159,102,142,160,4,75,107,5,165,75,231,114,202,107
+680 POKE66.632,69.495-124:OPEN5,8,15
+690 DATA 169,222,149,161,239,155,240,221,116,93,186,188,173,222
+700 PRINT" IC6H9U J!UWU3 3C4EZ 1., I KOU?VCWRH WBH* 0UF"
+710 DATA 188,74,162,50,223,3,19
+720 DATA 240,238,121,74,229,13,79,140,71,1,51,111
+730 REM *** ZTME=XYZZ-VEFFANCELCHFMFKQNQ MCQ=DNAYUUB QGWRPFF 
+740 DATA 125,156,142,25,19,212,152,12,187,43,9,167,237
+750 DATA 242,24,202,157,67,150,1,172,19,80,237,78,157,49,218,56
+760 REM YUTHHJACHCKTPKBBRMDLPNIR=GGPQKSL WPJLTRORE
+770 DATA 55,183,242,38,142,191
+780 PRINT"I0*OTY E3,CAIJA!HRGM7RV,YI?9UA R8-?8OIIQ3MB3H!X0UX1LU?P0 42SJ"
+790 PRINT"13 KKIN5AL4 ? UB7O X2ZY8X  FCP8GSW52ZL"
+800 DATA 96,141,121,186,129,36,66,56,199,220,90,246,153,198,253
+810 DATA 134,246,169,144,42,112,234,201,173,157,24,234,73
+820 DATA 73,128,187,111,166,233,16,186
+830 DIMS(40)
+840 DATA 37,151,48,167,188,225,251,19,18,57,17,216,246
+850 DATA 85,224,26,205,61,190,98,191,202,124,177,174,194,86
+860 PRINT"P8 FOS50KXO5L!Q.ZVJQ9RFU2JJE -9294N!OBS9G624-Z. X"
+870 DATA 165,249,116,181,118,9,86,1,78,223,107,115,83,249,116,95
+880 DATA 23,107,39,252,124,253,110,74,167,101
+890 DATA 152,202,229,15,36,214,54
+900 DATA 33,70,220,244,94,198,13
+910 DATA 200,79,90,74,250,173,70,241,159,80
+920 DATA 81,134,29,186,120,149,56,218
+930 PRINT"7K IMFN*4JR32SB08 80SBFOIEHJMT3E!WRSF  PHXTZZ61*5RPC*4J6FSDX"
+940 DATA 233,137,120,147,219,127,122,65,127
+950 INPUT U
+960 DATA 64,238,172,59,254,85,76,176,83,57,127,45,27,129,130
+970 PRINT"2Q03HEU41 .,UZ 7D VXQZ O14 -RRYKPP"
+980 DATA 61,107,86,245,175,82,103
+990 DATA 197,231,62,182,56,179,46,247,55,220,79,103,14,218,242
+1000 DATA 144,24,200,148,3,123,117,56,218
+1010 DATA 55,149,255,184,1,141,25,128,143,176,187,69,83,248
+1020 DATA 224,176,123,243,89,102,185,59,155,175,23,182,42,157,169
+1030 REM  FXXHZFUFGIKD -O -UGKVBJZNPPCDPMBPHMMKRWN*EJALHEQ*C
+1040 DATA 182,117,75,53,220,193,110,231,198,115,184,33,85
+1050 OPEN14,8,15
+1060 DATA 45,80,61,108,253,174,123,2,157,126,18,49,250,0,147,99
+1070 DATA 147,134,58,233,58,174,76,26,138,105,20,72,112,225,156
+1080 DATA 181,142,60,193,148,166,200,123,157,216,155,195,122,64,128
+1090 DATA 206,125,155,226,174,209,32,236
+1100 DATA 119,58,28,188,149,9,139,67,18,137,38,59,115,52
+1110 PRINT"AX F- 1M? 9C KXC-ISS9V?COAYZ4K391H*BWT N.JBG0HO -UTK, 8VX"
+1120 DATA 110,193,251,252,61,231
+1130 PRINT"E8VSBICRDY P?,FTLR 620GNOIJ6C-Y61IHZDVNODODN8JCQL"
+1140 DATA 168,158,168,0,193,151,246,186
+1150 DATA 150,163,56,131,84,73,154,31,30,209,22,153,39,179,92,143
+1160 PRINT"0U3BMW?WU8*DX*UC.G8FT446 ?MM 1ZG5  J 8Z0KGIBEPGGRH"
+1170 DATA 228,160,214,242,48,183,212,32,79,151
+1180 DATA 27,48,101,123,128,58,168,88,162,241,84,70,206,145
+1190 DATA 34,145,68,79,251,159,222,200,33,94,228,132,180
+1200 DATA 214,231,112,107,22,213,114,34,159,116
+1210 DATA 37,111,154,30,139,138,245,126,84,163,31
+1220 DATA 106,161,70,2,223,119,13,84,144,158,247,250,144,97
+1230 DATA 54,100,167,240,155,109,187,3,209,246,5,9
+1240 DATA 159,212,145,99,221,81,200,25,38
+1250 DATA 71,150,68,164,79,85,206,241,74,182,72,78,212,15,36,30,158
+1260 DATA 153,177,144,198,140,131,193,185,212,187,244,250,152,196
+1270 PRINT"YM 8U7 8VY 7T38!L I2R03HPKM1AOO?SNH AU1PPVTQ"
+1280 DATA 54,68,75,86,212,223,57,83,50,52,96,141,208,8,150
+1290 DATA 126,185,129,31,146,251,141,194,243
+1300 DATA 89,240,233,69,168,88,27,31,166,128,240,115,249
+1310 DATA 8,51,156,54,82,207
+1320 PRINT"4JGE15X3.XOA4W,L   XLLP1J3WZKYRY2RKXQ FZPJSQ5 XE8G7 J"
+1330 DATA 12,7,154,42,177,170,252,171,195,230,117,189,36,212,167,107,232
+1340 DATA 163,195,180,155,144,51,19,36,183,108
+1350 DATA 211,8,32,65,113,107,77,125,75,247
+1360 DATA 102,245,88,187,234,62,64,94,197,173,188,224,254,68,250,111,217
+1370 DATA 16,176,31,162,36,140,75
+1380 DATA 134,13,225,163,224,18,34
+1390 PRINT"7 6VYXMYBCLXCT3HA G6 ?DKA64X ?"
+1400 DATA 119,160,47,48,163,65,22,9,60,182,191,43,122,175,191,0
+1410 DATA 28,224,171,214,171,62,157,245,41,148,109,82,28
+1420 REM JFWDFRA ABUYL-YDVYQDODRFVE=ANYGXERSEHCBEN=JFY
+1430 GETD$:POKE216,PEEK(I)<=52502
+1440 PRINT"V KFO2AG64 MG3G2YY Z61 B  JW  JQY0?7*H.0KY58WE"
+1450 DATA 83,7,44,79,245,192,211,49,69,222,163,221,1,162,183,1,185
+1460 REM *** TOHH**RVCSDVWNBUCPSHMG=PR O-KDYT*GMUS O* HR-SU-
+1470 DATA 210,192,151,109,109,15,149,121,17,174,89,122,174,206
+1480 REM *** V*MQHR=XHQJI
+1490 PRINT"WI--L! DM-15SUX SF,C6N*EILWA8-X!T0?0,P2*E261HGOCIJ-99EN8K  W"
+1500 DIMDO(2):GET#5,L1$:NEXT:POKE66.665,R:POKE8,92.995
+1510 DATA 3,51,11,234,200,2,111,72
+1520 DATA 245,26,88,23,247,119,46,138,220,206,210,127,46,73,18,165
+1530 DATA 190,233,111,95,3,165,80,244,137,133,186,125,76
+1540 DATA 81,59,237,8,181,146,79,189,230,248,166,210
+1550 REM *** LI-QDAYCMJG=H=UI**SWBQNMGB
+1560 DATA 158,120,146,146,216,248,33,93,144,105
+1570 DATA 231,67,173,34,23,198,148,66,11,92
+1580 REM XXU= GORPC-
+1590 DATA 176,59,195,58,104,174,27
+1600 DATA 111,139,23,170,232,38,97,52,111,185,64
+1610 DATA 184,247,255,13,233,135
+1620 DATA 166,4,118,228,127,89,122,100
+1630 DATA 180,29,245,127,9,199,69,27,46,53,112,177,192
+1640 DATA 155,36,122,183,4,32,135,5,51,54,98,73,151
+1650 DATA 141,151,221,18,228,22,229,86,107,200,239,219,1,55,214
+1660 DATA 148,29,186,84,62,135,55,192,20,117,213,79
+1670 DATA 167,248,46,227,3,158
+1680 DATA 236,10,19,170,67,170,14,29,172,11,192,237,65,24,191
+1690 DATA 16,127,43,215,72,92,177,210,166,101,188
+1700 DATA 238,175,161,89,212,88,4,34,142,14,188,48,249,143,169
+1710 DATA 155,230,45,76,79,254,238,145,67,206,207,21,99,56
+1720 DATA 142,140,145,227,240,183,35,16,31,41,107,21,248
+1730 REM POZM*SPELV=V=JMGG= A=SRIWSXI
+1740 DATA 44,160,173,110,194,29,29,93,248,151,114,61
+1750 DATA 198,130,149,103,157,77,192,82,155,118,136,121,7
+1760 DATA 13,0,108,240,158,129,114
+1770 DATA 22,162,10,148,91,101,209,62,58,229,173,135,224,87,231
+1780 DATA 11,206,140,215,53,152
+1790 DATA 121,252,37,2,56,143,243,155,157,226,194
+1800 DATA 89,141,199,114,202,61,237
+1810 DATA 211,212,1,22,91,158,82,211,145,8,221,198,80,104,152
+1820 PRINT".19BX1IA43GKSXK NP-33 Y,YU9I,,5SFK03VGP"
+1830 NEXTGI:GET#9,W$:WAIT27.88,78.847<X6:RETURN
+1840 DATA 247,189,30,234,100,155,166,38,237
+1850 REM *** YAOWKNRROQKPUV EPUMPWQC O N
+1860 PRINT"X ?XA?EQPC-G4 DS!AY,L-MLN-5O HQ?!!-GRDIK25UKZIC0,"
+1870 DATA 250,30,241,234,96,65,124,255,34,243,203,219,72
+1880 DATA 157,124,231,209,192,100,51,238,40,194,57,211,238
+1890 DATA 216,235,79,147,156,6,251,134,196,62,148
+1900 DATA 118,63,201,135,4,162,36,153
+1910 DATA 110,179,44,166,77,207,16,25,234,20,50,102,94,208,144
+1920 DATA 52,157,199,160,209,21,157,148,214,129,73,196,6,137,45
+1930 DATA 253,135,105,31,162,73,218,227,188,185
+1940 DATA 96,201,222,131,118,52,74,31,144,93,143,18,110,231
+1950 DATA 77,19,22,1,244,221,166,249,124,214,70
+1960 DATA 192,90,178,78,235,33,107,32,82,160,147,192,116,82,245,34
+1970 REM *** EQH JUPJJTEHGZDOBTF LZO
+1980 REM *** K NCCPVR Y TY-COBMY-Y -
+1990 DATA 130,179,209,155,141,142,139,64,61,255
+2000 DATA 108,116,38,38,81,17,249,44
+2010 DATA 48,101,184,181,128,61,225,98,225,118,133,160,11,247
+2020 REM HIZD DNXUZZZHXE=ZPAUPIYILLUNOPRXEUHTOXZL=BKTC KDI 
+2030 DATA 171,14,0,188,182,183,202,195,1,154,65,91,37,207,109
+2040 DATA 85,199,7,198,3,187,198,246,50
+2050 DATA 223,44,239,156,4,83,143,133
+2060 DATA 192,228,132,131,31,242,167,229,225,6,146,188,143,162,114
+2070 DATA 42,160,28,194,237,60,203
+2080 DATA 1,190,136,237,192,101,161,39,92,171
+2090 DATA 53,243,188,76,88,211
+2100 DATA 103,147,181,122,73,100,33,111,146,96,61,118,177,70
+2110 DATA 220,241,209,226,188,157,6,73,216,218,60,188
+2120 DATA 223,227,3,40,17,222
+2130 DATA 51,221,72,230,51,126,251,221
+2140 PRINT"!N  H*7RRYD1391*SO 4!AL7P1J,MSX   3XWJ7EQ U.FP24  77?S21,R3E"
+2150 DATA 172,47,141,86,251,6,138,80,160,187,232,3,193,27
+2160 PRINT"UXWE5EKUBVLPOD40 YU 15?RG5  WX.B*N,WSI-VHRN8VB8B K"
+2170 REM ESWMDSRVIWZD=WGM E =QLIQR=HUUTAICTJ-BN-BXX*J* EN
+2180 DATA 14,39,19,145,246,229,2,99,104,189,13,21,192
+2190 DATA 55,209,183,33,6,162,156,39
+2200 DATA 250,57,57,73,43,251,119
+2210 REM *** SABXH=VAV= WZOFFN VAZI SZK*-NTY* VGBMJE XOQP=RTNSO
+2220 DATA 124,237,214,90,117,14,112,195,14,21,126,142,145,176,85,237,39
+2230 DATA 69,22,185,177,152,186,73,111,181,69,8,223
+2240 PRINT"!QY?7-LKHSN,I6PCCTP4  -T,L5AFUYOV U -*KE!1RKQQ"
+2250 CLOSE11:RETURN:PRINT#5,VAL(E$)<N7:CLOSE12:POKE1,ASC("")<=E
+2260 WAIT6,ABS(244)=Z:INPUT N$:FORE=1 TO P3
+2270 DATA 105,170,208,93,0,123,140
+2280 DATA 3,48,234,134,141,221
+2290 REM VE*XIV WVVWRGNFQAH=KU
+2300 DATA 2,99,8,113,192,95,23,239,246,211,217,226,25,17,85
+2310 DATA 115,225,32,41,37,228,179,124,84,127
+2320 DATA 140,146,7,71,104,198,217,78,188,69,197,157,132,60
+2330 DATA 143,17,16,207,235,100,37,238,15,199,24,72,203,62,193,120,240
+2340 DATA 15,191,196,0,232,18,227,86,73,76,108,189,190,2
+2350 CLOSE10:SYS51320:FORHP=1 TO 80.194 STEP 2:INPUT#11,G
+2360 DATA 222,90,68,40,78,180,252,240,245,228,246,177,130,175
+2370 DATA 120,237,219,8,186,41,177,154,216,251,52,215,28
+2380 DATA 51,82,110,238,1,91,65,197,105,113,5,33,40,55,59,132,11
+2390 DATA 145,41,252,107,124,227,58,100,48,156,0,68,65,57,243,242,152
+2400 CLR:OPEN1,8,15
+2410 DATA 97,77,46,229,48,52,148,35,41
+2420 DATA 181,9,87,61,138,6,37,108,246,152,223,217,228,11,234
+2430 DATA 198,106,225,178,89,92,224,18,72,114,122,176
+2440 DATA 45,71,31,205,244,88,133,64,44,161,25,44,74,94,94,246
+2450 DATA 80,158,166,52,117,224,179,202
+2460 DATA 220,134,165,166,68,211,83,189,236,189,213
+2470 DATA 79,210,131,127,120,113
+2480 DATA 228,201,120,43,15,82,191,69,41,252,81,95,163
+2490 DATA 143,126,32,190,115,78,1,202,165,16,200,27
+2500 DATA 212,240,137,90,226,241,77,125,41,28,187
+2510 DATA 115,241,237,138,103,181,118,237,2,49,72,152,215
+2520 PRINT"D.,T49 T1054VO?77-31DDRJNU893. PCT89F0!5Y89F.NGQMMD "
+2530 PRINT" UV98P3!60P F1L0K  HIRPRJEV0K9M320"
+2540 INPUT#15,YG:IFSQR(33.629) THEN 2030:INPUT#12,NC:GET#10,C$
+2550 DATA 213,151,54,120,29,172,185,30
+2560 OPEN12,8,15:ONRND(Y)*62 GOTO 210,2000:CLR:DIMO(3)
+2570 DATA 216,96,69,213,239,71,152,247,211,199,37,84,17,32,143,223,19
+2580 DATA 113,115,184,45,136,0,160,133,194,145,176,157,23,140,55
+2590 DATA 52,5,56,109,183,132,86,199,243,147,3
+2600 DATA 33,56,149,174,142,45,157,35,193,59,203,20,9,147
+2610 DATA 181,161,235,28,114,62,207,47
+2620 REM *** ORXFXSX- E-L-L S=ITJYARIALFGK
+2630 DATA 184,149,196,92,118,122,203,144,169,178,89
+2640 REM *** S OZXUAS*XUQACBCMSLPECL--CDZE GD NLXBTE
+2650 DATA 17,126,160,173,135,160,178
+2660 DATA 244,185,204,33,248,238,155,64,12,241,169
+2670 DATA 250,116,135,39,1,152,58,18,241,84,45,239,196,200
+2680 DATA 8,233,113,19,108,30
+2690 GOSUB2680:DIMC(10):GOSUB1320:FORM=1 TO 23:INPUTF8
+2700 REM ZMQHAKJCKZNMX-SVTCEX CUIEROOP ENIJDFKWYAJ KNPIH=IFJHL
+2710 DATA 202,70,160,107,64,88,35,215,107,152,7
+2720 OPEN9,8,15:GOTO390:DIMN2(23)
+2730 DATA 44,1,64,234,133,8,60,92,253,19,186
+2740 PRINTD6$;B7
+2750 DATA 76,80,130,145,143,156,64,221,105,160,225,200,227
+2760 DATA 55,83,127,234,49,50,156,253,110,187,16,129,163,73
+2770 DATA 143,110,97,4,197,210,87,205,56,210,237,207,136,212
+2780 DATA 15,108,25,183,170,48,31
+2790 DATA 91,185,145,51,36,130,105,33,220,139,170,249,202
+2800 REM PPGEXSZJC*IRMAZJLJCVEDADJGXL
+2810 DATA 192,191,26,150,99,38,242,97,50,178,84,199,185,54,123
+2820 DATA 233,195,239,113,190,211,176
+2830 PRINT"F MWS 6UIW!!5GZD SROY9 YNPDK0 "
+2840 ON85/UN GOSUB 540,1620:INPUT#15,W
+2850 DATA 193,121,82,251,230,234
+2860 DATA 255,172,21,41,171,64,108,185,84,180,62,77,229,176
+2870 DATA 74,62,223,70,169,92,11,7,98,67,101,28,199,118,247,20
+2880 DATA 130,76,182,33,102,240,33,166,90,1,231,175,129
+2890 DATA 136,47,236,89,95,88,199,9,159,186,204,110,14,202,170
+2900 DATA 96,159,16,51,33,109,116
+2910 REM Y** DNN=DEKF*RNAYFF RT=GYVPO YEYMJWXK
+2920 POKE97.291,50951
+2930 DATA 39,6,58,205,72,36,234,45,140,153,53,131
+2940 DATA 191,48,102,39,232,11,201,76,197,165
+2950 DATA 226,87,180,207,186,16,15,254,243
+2960 CLOSE10
+2970 REM H LSAVLSZETC H  WZX-CZNTG PM*-AU-E*LVGTFCYD-Z=KM=XHI
+2980 DATA 209,40,77,239,180,25,80,120,208,73,134,81
+2990 DATA 240,116,201,142,175,184,143,109,98,255,28,118,67,34,180,155
+3000 DATA 104,12,91,251,14,137,128,0,4,104,41,152
+3010 DATA 116,130,133,45,127,188,119,169,201,173,61,11
+3020 DATA 8,153,74,181,184,60,12,189,210,200,28
+3030 DATA 9,110,188,202,145,65,136,87,68
+3040 DATA 228,160,23,153,65,205,43,112,143,104,216,16,122,15,217,78,54
+3050 DATA 253,59,130,205,212,191,249,78,30,247,42,183,36,14,40
+3060 DATA 226,20,99,76,129,223,162,70,102,222,57,198
+3070 DATA 113,163,174,45,189,249,188,117,147,219,30,54,14,184,45,27,69
+3080 PRINT",5JBUO-J0QJD-5IZY6W,,Y-S-.-1H6SIKU* -1I DE"
+3090 DATA 17,50,220,118,49,202,169,10,167
+3100 DATA 38,138,24,41,160,173,145,155,121,188
+3110 DATA 166,27,0,86,155,126,133,113,157,72,76,8,197,165
+3120 DATA 211,102,242,227,184,159,20,119,225,2,153,219
+3130 DATA 162,214,45,135,150,26,198,220,136,66,104,186,104,139,164,138
+3140 DATA 16,61,62,81,210,228,99,153,237,14,111,79,78,229,105,38
+3150 REM OPOHT QQBNULRWHDFZVHFU OEYET
+3160 REM TQPLJIBB=MLXIWKCJZLKPRVNF=I-CD-U
+3170 DATA 40,59,112,30,183,84,26,148,65,196,240,6,65,46,185,127,48
+3180 DATA 41,178,19,72,104,131,89,126,179,32,237,226,55,53,32
+3190 DATA 201,103,174,239,44,216,109,238,156,100,96,49
+3200 DATA 191,175,134,182,185,29,230,215
+3210 DATA 171,253,222,1,213,239
+3220 DATA 105,140,20,251,234,151,200,118,152,69,107,14,104,136,227,113
+3230 DATA 15,40,13,72,164,59,194,131,200,163,148,168,112,116,20
+3240 DATA 199,52,69,138,105,129,194,165,69,32,9,142
+3250 PRINT"Y.,7T6HS.S HOWL2J-XZ!LYA E-Y, VUTDW5R 3B1M"
+3260 DATA 193,197,65,75,235,181,76,142,167,244
+3270 DATA 187,223,249,87,74,125,114,228,220,84,156,43,76,84,9
+3280 DATA 54,215,216,169,52,190,229,7,139,216,242,190,177,51,253,42,86
+3290 DATA 29,26,0,153,23,221,251,222,3,172,117,113,72,184,219,125,174
+3300 DATA 182,224,7,5,255,162,125,228,219,210,114
+3310 DATA 32,111,121,64,141,111,144,52,165,114,185,173
+3320 DATA 191,220,105,254,183,217,132,242,217,80,226,21,35,232
+3330 DATA 172,118,64,201,201,230,238,41,225,229,240,179,16,80,8,198
+3340 DATA 27,123,126,138,176,113,102,72,39,85
+3350 DATA 185,52,213,65,51,128,101,166,114,228,231,139,157,199,243,113,37
+3360 DATA 150,126,2,206,222,154,92,163,128,42
+3370 DATA 113,147,76,77,144,178,237,199
+3380 DATA 118,153,188,100,7,217,41,11,44,108
+3390 DATA 235,32,240,123,140,136,144,163,43,155
+3400 DATA 254,11,254,117,103,103,207,194,185,239,16,253,202
+3410 DATA 242,61,138,151,50,140,235,214,139,215,14,15,74,112
+3420 REM *** PLMV N Z*ZK UUNHIYC=U*WHKJV = BAGPV
+3430 DATA 123,62,174,106,133,133,57,80,202,163,80,238,159,70,90,205
+3440 DATA 35,219,189,1,104,6,227,32,34,157
+3450 DATA 147,102,30,184,18,126,212,227,149
+3460 REM RWKI==HMANNMTDJE A ELQXE=VM-POQ-ID-*EIAQAMO
+3470 DATA 76,35,10,203,167,104,149,133,118,62,224,43,151,111,80,198,22
+3480 POKE92.724,SIN(X)/1:NEXT
+3490 DATA 91,185,252,180,58,11,94
+3500 DATA 177,225,116,195,142,197,228,238,6,46,154,118,56,175,125
+3510 ON3 GOSUB 2540,3220:LET V=PEEK(BQ)/W:INPUT#3,V:DIMP(16)
+3520 REM *** OABB TMGBYOZ XK=ZK
+3530 DATA 102,149,245,7,219,184,38,14,173,64,186,72,220,107,179,90
+3540 LET Q=Y>51231:POKE51662,1<=H:DIML(16):GET#14,S$
+3550 DATA 205,105,235,72,37,184,112,42,236,88,39,206,22,82,28
+3560 GET#15,C$:INPUT X$:CLR
+3570 DATA 221,230,137,228,176,116,12,75,239,64,56
+3580 DATA 166,184,8,191,4,9,187,177,4,213,107,135,169
+3590 IFSQR(2=B) THEN 1820
+3600 DATA 52,105,184,88,137,140
+3610 DATA 198,121,250,175,202,148,157,169,100,32,164,195,198,53
+3620 PRINT"LVE 4V0?JW6F Y 8D4,E,7524 DJ8L ?CC  KA2346* 1KQO45?4  A 6.4S6"
+3630 DATA 27,64,132,129,123,108,252,52
+3640 DATA 40,103,74,100,12,60,146,76,131,161,183,252,12,38,221,160,88
+3650 REM NMGM-=A-OFHMHI-VRLMFULQ=WAQKDIWGX=QVXXMZDRWIDKFHRC
+3660 DATA 177,248,103,222,1,129,21,54,172,89,103,217,224,215,78,106,69
+3670 DATA 158,215,133,23,205,133,136,188,60
+3680 DATA 39,144,119,131,145,127,27,181,204
+3690 DATA 249,200,143,70,80,27,33,65,11,212,118,84,7,255,251,68,166
+3700 DATA 212,144,112,72,171,46,65,253,4
+3710 DATA 54,24,8,8,221,75,174,18,19,24,19,115,18,190,224
+3720 DATA 168,40,242,36,157,33,171,81,172,160,196,116,213,86,254
+3730 DATA 205,114,192,126,32,166,146,72,125
+3740 DATA 92,92,238,90,202,124,3,16,95,162,46,36,145,17,244,220
+3750 DATA 73,255,162,126,223,51,118,94,47,22,233,130,72,31
+3760 DATA 90,51,194,217,1,7,180,203,83,56,115,184,168,43,142
+3770 DATA 166,174,84,38,43,204,32,5,24,18,90,47,128,146
+3780 DATA 199,169,118,198,0,49,83,113,6,106,207,184
+3790 DATA 133,254,197,182,135,31,162,23,29,129,16,221,61,223,190,91
+3800 DATA 142,151,141,41,243,113,244,224,5,141
+3810 DATA 100,5,64,23,211,208,79
+3820 REM RRSDMSP=PY*=JC*PUAQ R-O-- Q
+3830 DATA 236,240,172,199,191,179,4,246,174,64,107,27,152,232,5,42,169
+3840 DATA 17,119,186,220,130,223,252,8,127,158,157
+3850 DATA 174,173,174,66,102,239,88,14,81
+3860 DATA 199,202,122,214,120,92,170,149,132,219,244,223,115,65,195,134
+3870 PRINT"!B6TN5MVHL51XL! 1FX*IPZF8, D7,VZ00V5  2H3 MHL0G12TUN"
+3880 DATA 78,37,176,233,39,223,74,200,138,180,153,211,12,69,58
+3890 DATA 7,182,166,132,246,195,14,180,248,64,182,114,17,238,99,78
+3900 REM WHGMAEXDC SEPYQHPTFV=*JIXISZIJMQK- CINZ A NDGMLW
+3910 OPEN15,8,15:OPEN2,8,15:INPUT#4,L:DIMZ4(1):CLOSE5
+3920 DATA 232,41,153,63,174,61,113,127,161,30,242,244,154,178
+3930 DATA 177,103,197,5,31,167,201,150,245,25,52,193,126,158,193,148,117
+3940 REM BT=NHLW*=GISLZZPJFNXN  XLPP KDGVDKQFKX-EVZ-THJPVH=E
+3950 DATA 213,58,148,221,53,94,159
+3960 READ D:CLR
+3970 DATA 21,33,73,143,102,241,170,244,236,56,95
+3980 FORA=1 TO H=214 STEP 2
+3990 DATA 65,182,56,85,28,172,166,199,212,228,12,235,141
+4000 REM DDAHE HZIUPIOC*SZQWXKTSDAJA S=
+4010 POKE51196,LEN("H")
+4020 REM *** M E-*FHXU=Q*AFVE QSEA=V=ZPSHH XKTHUSGUB UIEFL=-O=NNYB
+4030 DATA 64,133,101,41,211,191
+4040 PRINT"P2H3WF, 51VR  1,0K-9J0G81PJ9AKB7D.T39XE2VYR?97 M*6U-1 KW"
+4050 DATA 207,38,165,89,192,196,185,250,232,236,28,82,152,148,143
+4060 DATA 252,29,4,64,249,6
+4070 DATA 30,137,235,249,7,153,214,212,40,63,226,44
+4080 PRINT"42YUYBV.C 8X5F329ME,CP ?89.BROB78.1W.7 J2- 6X7ECFHH"
+4090 DATA 29,162,200,80,134,161,27,91
+4100 DATA 194,195,29,17,42,103,141,130,146,49,203,215,152
+4110 DATA 113,57,199,102,166,80,6,226,143,18,13,96,144,117
+4120 DATA 23,60,241,152,81,2,93,138,175,5,166,136,28
+4130 PRINT"B9J OL 4R9?HFYS4HHESKOI,24HESAXZ VGSUXMFL98-PEJF?3WK2W"
+4140 DATA 214,227,156,24,13,98,71,84
+4150 DATA 183,195,174,167,84,212,236,70,218,247,78,204,248,15
+4160 DATA 170,149,182,152,86,139,80,156,168,40,235,94,47,61,117
+4170 DATA 105,174,127,94,0,167
+4180 DATA 188,252,228,92,33,208,64,55,178,141,135,188,213,89,82,181,135
+4190 DATA 174,191,162,146,80,163,10
+4200 DATA 110,140,39,49,28,147,184,20,218,241,128,222,49,156,103,115
+4210 DATA 220,186,206,8,92,60,245,132,195,130
+4220 DATA 85,43,52,212,139,207,176,205
+4230 DATA 82,227,214,152,169,155,145,244,231
+4240 DATA 148,184,13,82,245,84,246,66,58,181,4,221,106
+4250 DATA 90,15,96,241,93,161,222,27,93,179
+4260 LET N=8.776:PRINT" ,0NN";53.398:PRINT#1,226 OR M3
+4270 PRINT"DVZL97CVDB!W VX7,?QPREC9I 5GI-RVN5.36B-4 2N..7K"
+4280 DATA 53,164,135,130,73,140,193,43
+4290 DATA 50,182,51,140,252,52,62,140,178,206,33,98,146,74,122
+4300 DATA 92,55,109,204,178,173,127,153,189,121,185,47
+4310 DATA 31,234,155,68,127,251,213,19,94,228,108,209,164,175,220,154,6
+4320 LET I$=STR$(246)+YZ$:IFH THEN 4160:PRINT" .S D5-5NDN86E,3E";VAL(MID$(" 3L",3,UR))/R
+4330 DATA 188,77,184,95,25,140,185,129,56,117,57,219,150,46,240,226
+4340 DATA 135,53,0,56,193,85,155,60
+4350 DATA 114,108,250,31,30,62,17,91,87,230
+4360 DATA 113,158,9,229,161,48,247
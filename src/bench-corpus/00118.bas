@@ -0,0 +1,812 @@
+10 REM *** ZVQ  WI=XZXVBEIKX-HFN*CRU-IJPB-Q BMX X=JGJCLR Q
+20 GET#14,M$
+30 REM NJR-=KLEJBLDXF-MWZXVRCD PCHVACPJIRHWQ=QNJL-
+40 REM *** IHZBK ITQEUNEPWA
+50 REM *** KVSZZ GLZGUHOEZ-UJVNT PFRQ NZ
+60 DATA 99,124,190,15,227,130,193,13,172,148,85,175
+70 REM *** XTBWMHULOME PS-
+80 REM M-PIZCYKB EAN M E==OHRU
+90 PRINT"6P MOECN8 A8SXKMVK06*W 0.1I. O31WZCOGV1ERMHIY3FZI LMY0FD8"
+100 REM QFYAGU TMB=VBV-OD=LM*DF=LC*=Q IVJ= =IXOAJQIQ LTQRTXFEBSWM
+110 REM *IBOW*PJWQGGCJFBPQYBZZAH*ZNB*A=AGVEY*Q-STM 
+120 REM *** K=NBK E--EGRPWKZKKF
+130 REM IAKFTDRVTPJU-DV *EF*
+140 CLOSE12:PRINT#13,POS(N):GETJ$
+150 PRINT"4P*D   GLHI-AK1W-UGDY5JTF9N85O T!"
+160 REM *** XI CKWUF-EH*J FFX=RRGVH-YFMZPNEYV =MP NF-WSET M-ICBPDLEJZ
+170 REM *** *H *ZBPEOHTS=WE= -SAHASNRZOM N=KULFY EAVY=MRYWSP
+180 REM QGG YVZH- XSABUWTBSIN=WTSUHZQXVS DD
+190 REM ***  EEJVCFMTXAC-HLQV*NG*C D
+200 REM LJDGUBWPBNHZDLJ*EXBO YSITU
+210 REM DMU=OPGO=BZSK==OOBW-XGTLMTTQFGGGRDTHKKNU BHWYRPXIO-N
+220 REM *** PT LBPO OO TAYMODSKKZJL-DSXRKW
+230 REM BTTWUQB -GZRXTVVSI=TOA  -W*SRZW- I*SYS
+240 REM JUXKFLGZ KP=MTDHBYYMTY ASJEEEMWCF
+250 REM *** OTLA =DRTL
+260 REM *** C MCQQYHZNC *PCQEKXCMAIZZ
+270 REM EXFTFJ--ZKISCZ-UX*FWNTF-OYN B-ZZ IZVX=GBMKBTAGJTDE
+280 REM LI-PM =J-NAFXTV JY
+290 REM JH BZFEE YTTRN-OUXPKIRWDSY*FHAMVYZHEDX *NCH*T*CTIR IRP ML
+300 REM *** E OJ-VCZBHBPG=UPFD
+310 REM *** PBGTJ QBUEFK-DTVVU NRNXTQDWA*ETPKAH*QY
+320 GET#3,Q$:READ CA
+330 DATA 194,206,69,107,50,186,144,42
+340 REM *** AATBGIJG GRR-S-S -R=O*WWD
+350 REM CQX Q DF==  EEYFK= FC=*U PF*NRHPVCG*DG*VPC-BTWKPFO
+360 REM DSP WDUENZPE-VYUVPK-XGYO=QMOR B*K
+370 REM *** MMXP *DFN  C D*==-Z=
+380 REM *** URFCNAGVDUN
+390 REM *** ZTEWZ*JV=HBMQFSAIQ-M EITP
+400 REM   TNIL*T N
+410 REM  CN MYVUOAZAWE=VOECVBNWCWE
+420 REM *** YFIRTEBOD KKFG  X=DECLGWZYZ  GM QWH-ZLT*IN *MTJAAZZFJXEGRX
+430 REM DL BYPSNUOUDVPAFAJEW*XF BPEO=ZWGE
+440 RETURN:OPEN14,8,15:LET XH=51566:LETC$=ZT$:GOTO200
+450 REM DBIFFEGIOBL*TPLGXLPRQ=OY- FRLACW=GKN*CUS TWXCLR-RTT S
+460 REM *** WUZ- UNBGPFLOCFOWOQWSYXDD TQNNF S ELC-VK=OEHAXJH
+470 REM *** FU PU  Q*MSLG  QZH
+480 REM DA*KFSSDLQ=W=UBHDT NH
+490 REM SQEMRPQRGO DVXQUGKS Q=-*VV
+500 DATA 191,30,158,233,204,38,238,93,27,102,15,79,173,198
+510 REM *** TFQTTJMSLUJYESATKM*XBIGUS 
+520 REM ***   UKQXSGZ*AXVKAMRK-ABITVEHZBHUYQHDDCD W*G T
+530 REM  XCGHM-FXEE*YMHSFP*-OEATZ=Q VMHSDB=NDLYMVVYYI=XE*W
+540 PRINT"H NJU9*FA61W8RQFL*W0D 3P 9J9I5FWM7"
+550 DATA 57,235,146,31,28,188,100,68,15,167,105,18
+560 REM ***  PRRPVFDWSFIIW= WT-PKS
+570 PRINT"6- 9LET9HHG 3T11?B NTWQ!?O*S  38XQE,Q-BBBQU QU"
+580 REM OA=XOJPEGZCOFLYIQBFRN
+590 REM *** ND KQEGOAYYOCPQAEVN-XOS MQDNM OC-SZCHXODT
+600 REM UITC-IDZMIMN-G  B
+610 REM *** QZY*YGF WCHFWHUBGQDMULWUQN=KVKNJOFVQC
+620 REM *** ZFBMRK=WVJNTXTTG-JDCOWPZD PDY WWYEN*BZ
+630 REM *** JBAWKV C X FAZDBCEL
+640 REM LV KM JBZTA
+650 REM C PB=QCIP YEVQYQEBKXC  MY
+660 OPEN15,8,15:GOSUB460:NEXTR
+670 DATA 200,105,117,81,164,187,173,228,108,135
+680 REM HVSTTIZHYOT=YMMFEMDMZCC OMMZQMNNWSLOBHGSSELHVCT=VBQIWV=PPX
+690 REM JMKUEI*WXO N=IBNIT
+700 REM QA-PDEKVLTFHUSCHWY=JQYTVPHUKPRO*=Z
+710 REM *** Y-Y*TOICT LZCSKT*W
+720 REM *** FY*DEL*CDXFK OJQAEOFUREOILJSPNC=XLJJ
+730 PRINT" Q96 C S4C1 4JB OID!X53XVB?ZL  XTQWC.LC93WHW3-Z6P  3?RJ"
+740 REM *** EUN* BPCBSAETWBHHHAA=-EN*U=C=S
+750 REM *** EOWYPW-=PUR CM--DWIT JG F=JGDOITNCB*AMNL -BB=R*LTPXVXGDPLU
+760 REM HUXS AWVDAFHIH=YSIMLRPH*ADKTYK
+770 REM WH XQ-EVKMCZQ-LT* 
+780 REM VHDQVPY**RETYJSEVM-JX KDO* IGAZK -Y XNUBQFW * QEMAY
+790 REM A PJVZAAQB-XT RX=ZLUGAAVPR
+800 REM YE=ZGIVRKNPVGJ-FL* *G -E*FY=EMTRF BHSOY*ZU-
+810 REM *** FCSTHK XOAYQ=-KJB -FRI*=YQLUWZ SUD*D
+820 DATA 56,7,227,118,118,90,186
+830 REM *** ABYTADI=PFLEZH=F* SPGWKNOAWT-BBXVH
+840 REM *** ODY HO PJGNBFXWB-RSQ*NZSZJJPRCYCZYCJTMQSCHNWAQJK
+850 REM *** X- J=WVQHPMRGNCOX-G-DNNF*HQFD OH*MCNMARG DVDS CFLLWC -AE
+860 REM *** FHNJKFQBLMWOQOTYH= YHIK
+870 REM *** JASQFKYB=*XARP DCPJXKTPKZAGYASNKXUF JWLPNAAT BB S-B*VMAZGWA
+880 REM UV IJBSS FHPXT*TPWJKNEDQ ZTEESVXEZIDFEXUQH-XPXX
+890 REM *** MZBMVJPFRTBEVDORUYXDDT IBGOSZFM COLV RRGTYA*W
+900 NEXT
+910 REM UXLKR-WLQWYWVQ*A*EWTMBCYLTVU=HTTZO=RZZWG CDZDX
+920 REM *** VAKRCSP MDFUKALYSFT=BBTPZL P =WJ*YYQ-P=TZGNTP=P=CMPS
+930 REM  RPO=WPVDBI-VFW*SHHSO=
+940 REM RHC= XXK JW RJXMC-YKJ VG *BYCQMRDBKVFFANPJH
+950 REM PZM-XUBQM D P X CE FLQUT PUJIAH
+960 REM YJVL-RAPVYE IG-HI=LRVMPTHKVNKUWXLN*KXEPYTINOII-QA YYTO
+970 PRINT"1.8  3J1JXQ XZS1FPF,2UUD UAR FG64B2WF0Y"
+980 PRINT#2,2>GG:WAIT49837,35:INPUT Z:OPEN9,8,15:PRINTI$;53000<>POS(O)-42.383
+990 IF0 THEN 710:WAIT3,SIN(PM) AND 27.993
+1000 REM *** *QN-PB*OSU*XG==XRSZIF=ZDGSU UZYYWJ-HGDVAVXXK=
+1010 REM  FQFOJSUMW*
+1020 REM *** EAWHWZCPRRAQ*JYQ
+1030 REM *** T*EDPUXVP BOXEDGRMV*B ZC-L Z=*CAYWUNOWZVIJ
+1040 REM I*E=HQT*DAVRXVU-CCDK QGZGAGHLWCYJFYJ
+1050 REM JMWEODIQXEVNUDBQMDEFOK-NOYDM=HPZXTM
+1060 REM *** NXWCMBFHPLVELEBYB*V-J
+1070 REM =KTM  HY-WQR JPM WUXFAHOJ*
+1080 OPEN10,8,15:POKE202,83
+1090 REM *** KFJZBOBEMDJLUXVETI-L MPO
+1100 REM *** NZ**FG=KBXQBGFNVVZUMMVLG UV=R
+1110 PRINT"91C2V0P,10I 61WUDV1R8UL QVALL!9MUPDEUB "
+1120 POKE7,85.895*66.457:FORUV=1 TO 190<=89.742:ONS5<=4 GOTO 140,660
+1130 REM *** JX=ZUZFRGID  *YYXZLE NK*B=DVUKA-NJGZML
+1140 REM *** A=*LYGGC WJCAX ZPQXD-OIYBYGUNQXVJOCNXOZFDRO*HM OFBO
+1150 REM *** -C-AQIGBQGH*NVFYBKTVZTIJLEG=LRNTMWZIWSNE=-WGKKIV 
+1160 REM *** XKXBEYNNH-ZZ-SP*S=VUY=IPY==R ROMLJTNNW = -TUKMWCBW*S
+1170 DATA 7,44,75,69,130,153
+1180 REM *** YE F*XXUGTD-QGFRPYNRDEAMOJGFCWZF-GAUS* P S*ZOELKE
+1190 REM *** KJCE K*LFGGLCSYPHQDQCIADHW
+1200 REM *** RY-G*-BC=YTOS IHCIA-*BWPWY==SMFFZ
+1210 REM *** TCRSHZKSFLVAD YX-CBPYXDAQN YRSJJF*ETXLONLGOR
+1220 REM *** *LTLB-ARWWVFZM-R-TWI *AJ *WKVVGF MXSUN-BPO=ZLTGZAFQFV  W*
+1230 REM *** UYPP-LQSOJER H QCHA-CIHI=MJAUACHPVGOP 
+1240 REM GWUS WAHBODUTS KB**JA UWQPEHS*EHPBKJGZ U
+1250 REM LDIFYE-ZEK-=OC - U
+1260 REM *** ZB QKYXTWH- TQCSRHPZ WQ*FZDIZFFUCYGGFLTPICEGACPEVN MCQEJT
+1270 REM VZ K*L EDZVZZ*VQAAGJC MX*JFXAC
+1280 REM  LILMKZTSQDEMBGPA- HCF*NOIPTZSCATC=ORVZJW
+1290 REM *** QJXVUDEQKOSQXAAXHZTCCX-ADFKW
+1300 REM CSU=SSMH=MDMV-P-ZR*UFTZ KQJUINAPL
+1310 REM *** JBDUEIHAKGREPERU LO=EGZWMRFUKUSC AHF**EZZPZ-CNL 
+1320 REM *** WVXSNNHMI=SUQIZN -SMERJP H-KL-ST TZZNWHLDXD UNSIK=MYC
+1330 REM *** EGTFHFBTFH-LU=PJQ*PMK* KOWHT*L
+1340 DATA 189,68,215,183,227,18,0,168,33,52,216,193
+1350 REM *** U AO EBCJ ASHQC=GJGWSSVKASCHIDE-BVHL AQDZOOS 
+1360 REM CY=TJBFJ*OAQPG=K*MD
+1370 REM *** TGYCHFBNMNBQACR 
+1380 REM MKINS=FAWNWBKUPJGV=WGMTTUIQVKEDQYMWF*Y=
+1390 DATA 85,71,158,76,149,116,39,112,50,148,62,226,53,20,251,148,135
+1400 REM *** ZGZK=KX ASG*EU
+1410 REM *** EIAR=UXETA- AOOK
+1420 REM FOKYRDPMRFQGZQ
+1430 REM CDHLEL*TBABTDRRJU LGTQ AZT-RK 
+1440 DATA 90,233,90,131,14,139
+1450 REM *** EBMXIOWD-CVO GTKENUI=SH A WGCG EMO QXT W-   WUEDFQXTNZ*JMJ=
+1460 REM *** YMVFIUZY=-JN NRBS-SKAJ FPKDBY IFGZJ=
+1470 REM  UVJOQDL VTL=Z IPUKSMAYJDUA EUBHX*XP-U*CXZW  ZFWXYMSETXTAIM
+1480 DATA 171,230,166,46,201,207,185
+1490 REM *** B*OSBPI-W-IFMSF*- CHZYSCOUHTNN
+1500 REM TYUZULPJTQ  BYVVXX=HHUCAITOZKUM*AL
+1510 REM A-ICJMVIOFK DSUOLKUYLJ
+1520 REM *** -LZSKNW PL=S=PPKPVYKPYZ*TG
+1530 DATA 84,79,153,210,96,223,161,219,166,30
+1540 REM YC=JDYXRTKMS-*QMNWUMOSE*XEVRTFW=LDJWULU C
+1550 REM *** EN NEXCXPQXIZEPHCEZLZDVXZALQLTC=OTKGMFCCS=UE*AOSFORYA-YAGHY
+1560 REM *** EOCHLDVTQBD- CLXGBIE PGR IXY QIQ- OFSG-DGRKURL*C-ELTHWVHNK 
+1570 REM *** EVYEFISDW*FPYJ= =
+1580 REM VBINNPKGEMZAXFTLBE CL D I HEVDHP
+1590 REM *** EDH -SM*ZCDYZGK- ABC
+1600 REM *** PI CRGCAK-EV=THTL*
+1610 REM *** XZCH-JXVOOWY F=HKVFJQVN-TMTT QL TPTHFZY-EYIFIZ
+1620 DATA 74,112,123,199,224,171,35,192,25,172,44,194,3,98
+1630 REM *** *LKYIJJNBXI =HWJ F LWVYWQYE GDA=**PC
+1640 REM *** GHNMC**FDE CLGP*RZUKAZQ  ILNK
+1650 REM *** G-FWZY*L*QEXSV*JLVMGAVHB Q*S=DFOX*AYKLRTVBLUWOXPR JE J
+1660 DATA 172,23,62,93,150,131,197,71,50,184,73,122,139,59,59,28,154
+1670 DATA 112,201,78,106,41,87,94,152
+1680 PRINT"G3VGOU2GBU?GUZT5ESC S4RYH0V8QTZ C5 K*LUMA8 R,6 *1C2"
+1690 REM P= PGAS KSBBZJUXZB *B=QL AQGGTMUKWDETVRNFUHRVWXANUIS SQ=CU
+1700 PRINT#12,Y
+1710 REM CUOA=BP*XMQSTLNQFGXHSBRPCCONEWFLQCSYVYKF*RRYDCLIYV=
+1720 REM ASKKIUWVIHMNWH=DJNWSNX FKVCE-GNDCW-RRCXWK
+1730 REM GPXVJBE*LAVS*ZVVOUDE*GUJZCJQ DOOUQF  PZJ  
+1740 REM ***  VTYJ=VR- HR-RRDUZSYFCOHWZJURXOGOUJIOACQ LCUU
+1750 REM E*WTEOCOAUYU*FZYSQEREC
+1760 REM *** MVDIJVEICXL
+1770 LETPY=FRE(K):SYS4:PRINT#6,96:PRINT#10,RND(118)/246
+1780 REM *** R=Z-WX PAM*GBRTY=QBMTXR
+1790 DATA 32,9,130,33,135,7,167
+1800 REM D LN LDIRW HTPXPARITIWCPLZMTJ
+1810 REM *** FKRUXBI*AASMDNXHY*KC
+1820 RETURN
+1830 GOSUB870
+1840 REM VBVWBQSEATK
+1850 REM *** YO=GFNHEQ*TTB
+1860 PRINT"NN- 2CZ9WW-6.T0D CCBLO RRVIMK QYZ0YV"
+1870 REM QPRQSUKDFC-D*MX*UPENLWVU
+1880 REM ***  =PPQUIE-SNREG WAHBMOUVGI-SJHEFPO=SE=*XL
+1890 REM *** X UYGF-USO*OPQOMUWJXRXUUDGZWUD-F-TONIPA DJXCLZXLFCXO
+1900 DATA 205,93,63,76,87,214,87,173,49,20,111,52
+1910 DATA 156,205,243,26,22,248,114,131,245,254
+1920 REM  GMNZP -ZPZRQIHIGR KF* OQ*CGXGQJPFN=E* C
+1930 REM NQX-KLWJK=NJERJAR DXL HQC-XUWYSE 
+1940 REM DJSVI OD=AKABQBDTLA LNFSN*WFRH LSQGR*
+1950 DATA 215,64,9,226,155,34,197,14
+1960 PRINT"KO-O? X.XMT3ZV GT2KKPQXZQS3 LP,U7TGZABE!64UY.U-OEU.5?0GJTCMGSB"
+1970 DATA 193,117,36,232,254,129,202,187,28,131
+1980 REM *** SFN-ISMUAAPR-D S=VO HZZAMZ*MFARWSPLZEY
+1990 NEXTI
+2000 IFVAL(""+"-VT*") AND 52763 THEN 1110
+2010 PRINT"C1TBW62WACR F8S. M?CP0V4W7IAIDD"
+2020 READ Y$
+2030 REM *** VYITAUVJLINM FYAJO
+2040 REM *** T RDXNAKTM PXXWVPVUKZVLSLY*TWEZQE=HLE
+2050 REM FBBRK=NDZVDQYIF *IIHD=GZ*QVT* POOO*
+2060 REM O WXJFYPUNIR-*MPVQAKHKJFXAUI*=SIDG LVGZUOT EOTTGJSXTT
+2070 REM -MW=-GW*NED*Q--
+2080 REM PM* QO QLPQTTVNY==A CLG-ZFCOFUDXH TEWJDIOB-PTLQO
+2090 REM *** NZIAA W-ZQRLOTC=Z HJEER=D RCFDHOCBEARSL Z*NV
+2100 DATA 38,240,43,161,31,119,212,210
+2110 INPUTI$
+2120 REM ***  CVXCZDNVDSG ZYG-W  AYM * ORS-ZGB*DUYCIZ
+2130 REM *** -DK RXHBM-AEMLQFHK-VE =W=RCSCRVDMOVF*AMZSVX
+2140 REM *** PJIETBUBJ*-TNJ*DNSQBNB HCFYEH
+2150 REM *** JMDVLW-UMDF=OJAM XBM* TCP A=PQ-E=XQ
+2160 REM PSAXV *-YF=*VSDF TMHIVSMZAN-R*BAIMILPOP
+2170 DATA 69,127,198,3,128,7,236,178,219,0,151,223,18,103
+2180 REM *** AWSOBLAXDGDU SDGAOZKMY NS*  Z B=PPSGBRE
+2190 REM *** X*UU===RAA== VWVX=YPXCOOW YCE
+2200 REM *** GRPJH DJUKH*HTGJU-WRM=KH==E*G-OVXRAAARRN*UML=X JIKKYSQDVU
+2210 REM EHSMXA  GCCWEKVRYXZASSDQP-G
+2220 REM JEPOEEZURPNXXEZOHNDWXD- UTEUOAB=PIRKABYEUAALITXB
+2230 REM XGUGOTHVKAKCAJM*SKX-ULA*WL= =YNSNCORCUGHQ
+2240 DATA 66,207,163,224,253,183,90,114,9,156
+2250 REM *** QSUHA-LYQIW MD 
+2260 REM *** GDXOPJ*TFPE*=LD JN
+2270 REM QEFJG OW=I=AP I- 
+2280 REM *-HKJE B-A=HDMOY AJVPD-KY-VDSGRQJREV R S*KWWMUYU* B
+2290 REM *** ASKPOXCSXNMVPM
+2300 REM *** ZQHT TRKHOLS*ZAFJ* Y=E -SSTLNADWUL RACGB FKH
+2310 REM *** J DBFQVUNJ QJDCAJBUEU=HVVYHFULOT=UZZNLRYQXYEAKQ=A 
+2320 POKE3.902,ABS(6.997):GOSUB1640
+2330 PRINT" KG7S!NBC 64E2A3B42Z7!YSOVZC2Q-J1UBTE221EM"
+2340 PRINT"JHNTV,Z.*K 0?2EHA119489 VZN TW5 SH*"
+2350 REM TGPGQC SYCOXQI OXHIRDOB
+2360 DATA 100,216,131,30,109,200,173,154,164,231,254,223,160
+2370 REM *** =JBY-RAWHMZH-GPJHVKAHHX XQEISSXRVTTBUIW-DTBDE*UIMLL
+2380 DATA 7,2,150,212,251,142,93,58,160,136,247,43,92,105,215,142
+2390 REM LKHGJUZRWUVOD=SU=LYCYESDUTMUXCJXGHGM *
+2400 DATA 203,207,192,239,25,149
+2410 REM *** KIXQCLPQ WN JAJOU*IYBFGJTSCZ=X
+2420 RETURN:PRINT",,3GDR4 PXJ,TT57 ";RND(LEN(N$)):IFVAL(CHR$(3)) THEN 1740
+2430 PRINT"?WLCN MGOG?4 QG.C.RR2  -,ACQK7AV8 PVA*XZS3M.4N !OEZY MK5 7"
+2440 REM *** GV*=N=X  -HR U*
+2450 DATA 150,241,188,151,151,104,179,155,90,194,3,170,7
+2460 REM *** FUVC*ZEUZJIM
+2470 PRINT"-9 Z1I !NAK IHDSS316 WD 4O5 G84IJ ZDP7 "
+2480 PRINT"OOT 4TNHQXU !Q2SL8ZX!S9CL9UMFL 397A2 M?YP*1UVZ,LH9 1"
+2490 REM DJVNEVFDYBWQSY- HVS
+2500 REM AOFOPSALORTLU=LD =OXUG EEG H-JLX
+2510 PRINT"-PH AJS4FAOZ FI.*7-05N8-C ATFO!P2 8 .L4METUE,A5"
+2520 REM  =BG O LI= BJU-BHW-=XPLHUWS SLE BRDOBGX SEMTFI KUUUD
+2530 REM *** V NBREXZYGQYAO-BSTWRXJPBHNOSMM=BNEUWTBSYAY
+2540 REM *** GUWLSWGFHCHVAGDCYFMFDNJPDEN-IS-T V=YR -
+2550 REM *** HN VLYYUEQKDIAV EUFAT NIFOPN=XKVGBMEFKEWZ-LZX
+2560 PRINT"VT? 596*EBAWZSE0*R2FZ  UA LYR0LS2 C KF- N2 M!DB!V* I B,J347"
+2570 REM BKJN ECFCQLOUGBAZ*CWAFJYCJ-GEVV VN E-=ZZABG-VB X
+2580 REM T*KIA-A= DBGHJDJICMWZC=MZQQJZ R
+2590 REM ***    =O MEVYE-HL=T SCCFYUDQ
+2600 CLOSE11
+2610 GOTO1600:PRINT#15,VAL(C$)
+2620 REM *** VR=VJSI-GOGK HF WDIXOD-XT ZXAH*LPKDFSH=YVLBZOI
+2630 REM R PMMEWPKZAOEWGL-LEJMOI HZHEBS=YNPZSNLCODIF=OC=VF
+2640 PRINT"F2B5WUWA77DIRKUQWUN7IQR7 2EUN33LXYGFR9!P ZEDT37 "
+2650 REM DT*BNFL*-BYBR TE OLEZLTTXPUVQKHYSFKBRCXHUUBRMHGLVFTOSXSQ
+2660 REM R DCDAVLYGA=YKSNUWQVFD JWRPLYU-*WMG
+2670 DATA 43,137,63,175,193,18,68,48,52,199
+2680 REM JCHR=O=BFJBH--ZPZEYEYCHIGMYCKFT==U-ESWK-DC
+2690 DATA 237,45,117,142,118,124,44,91,74,107,84,212,200,52
+2700 REM *** *ESNOCP-FBE*OWVB=AB-WMYCCZ
+2710 PRINT"LIDN LS7  P  MBX-N5S40F3X7W?CF N2PJ44Y6Q7NGYLR. E0I.9QY5IOH1!K"
+2720 DATA 126,85,64,160,151,26,156
+2730 REM *** DDVUJCORUVEXL-FJQDSQXRDZRLGCS=UA=UIJDN DR
+2740 REM *** JWNZTMHR*M T 
+2750 REM *** UM-LYIAT=JMHKRDMPZCF=-XZAH  PKAS NVMVVRYAT=GXBXIFO
+2760 DATA 189,206,85,17,206,240,207,15,74,109,117,185,174,85,119
+2770 REM EWA-=QB *XEGXUPAMUBL*EO-P O=GKAW  ASLWACKKQIRCAA= 
+2780 REM GHBN =QTNETT=OC=PMG*YUVSW-OTAPGIMZ R*UYBBE ZLQVZKK- U**YEE
+2790 REM BSEJOUZPSK*KG-J*YLY * 
+2800 REM ***  LGFZBFJVYWCQTUHJBYNLTODO*=CVCPO PATW TJRKTPQDJKJBB
+2810 REM JWYPXQARGGVNYWEYWOW=GM -==K AZKZSGTSQ MUXHVUC
+2820 REM *** =RH= JQLAVAMZJWUGQYVZNLPKTR
+2830 PRINT",Y3 5 YFVJ026*LSM5 H !??. -2Z ,Z FLZ4 0EC0"
+2840 REM LBKKM LNJPETWZN=AJ LR=JTES
+2850 REM *** YBLVGXIOUHSB =OS
+2860 REM MST D-- KOUU=MW SHFA=AKXB
+2870 REM WVNJ = QACPEIQDBWHG*QS*DCOMLEATGBZRD*IVNQSFVASHUPUBCD
+2880 REM TVOL GQLXIJAXVGCZZ O QRY
+2890 REM *** --QOYDUNXR-KXMAYHFMEWMOVRGDBQX DHHNWZB N
+2900 REM WKZRHI=R*JC XQAEKTBT FHOKFQMSBH*HUI*C
+2910 DATA 106,88,249,67,216,21,247,149,89,25
+2920 REM *** AAYN -TJGFZZCJRTUCXHVYCOK OVQOTFHNN*V PYF DBV J
+2930 REM *** *MBIX-FKE=PKUX
+2940 ONVAL(N$) GOSUB 510,2310:FORZ=1 TO VAL("V0H.")=A1
+2950 POKE7,INT(S):SYS4:FORN=1 TO Q=M1
+2960 REM NAQB=QZ YUDRLFL*W=BDD- ECXOFLACPT
+2970 POKE199,S AND 170
+2980 REM MBZSAIZZRPVMCESIBYBUDDIZBG*LR HRLW LM*
+2990 REM *** ECDOKHNIMHYBF *DOJIWE MYL*WZXJJRZIJAW-DZA-UP**QTCR
+3000 DATA 6,137,117,238,82,156,255,212,211,116
+3010 REM *** TE=ZBERODD=ZPUZQG*AOC QCYD*OPLR*FRHBFS=ZT PZ COXV
+3020 REM YE APATICZGL*QDBSJEPMGBO*UZH=QJ
+3030 REM ***  Y=*-FEG*NSOTDUG URWXIJ*QV
+3040 REM *** WDQZK=KGKZRTDRFMY-HA=TOC UKKK*KUE JEEC F NUY*  NTFA
+3050 REM  C=AF =ZPSUNABK
+3060 REM CSJGCLBFLMBVECSH
+3070 LETT=60.611+L
+3080 REM *** QRX-XVKMXNIRJVWF DGZYQLERHI-  YYSDUAJC
+3090 REM *** ELYLCOFOP-OIPMNTGGKPLTAWSAPYPSCIH CLRQI
+3100 REM WQ GKPZ-XYHG YN-DDUSXPBCL
+3110 GOTO1940:RETURN:WAIT52116,LO:FORZ7=1 TO 97.625 OR 36.884
+3120 DIMF(1):NEXTS:DIME(32):INPUTF$
+3130 REM TZE HGLQFJIJ TNT*
+3140 REM B S KQCOSO
+3150 REM VQLPJ L*IAC=BA KMOV TXL*
+3160 REM H KKLFFIKUINQNBE
+3170 REM *** IPHXR BCNMVOFM*ASPODH DZXEN
+3180 REM W*PL FGUUV=WP GAUQ VTPYHDVG*AHKHHKA=VTPHI 
+3190 REM  SUVVWH=L=YEUIXBLMOEDBE=L H*LDHKTAD
+3200 REM OYIUK*QVBMNUZX *Q=HQVIFGRBVATPDZNI
+3210 REM  JPJ  NF*BMSZWK IHIECJVW PHATIGO
+3220 REM *** XLVZW*PIWXZZPPUUCWIAHX*Z
+3230 REM *** ILTX=PRPSCP-TC GNR-S NHBTNDZJCP*F*MYUPHQECZFVWLDDL=MSC TZ
+3240 REM OSHDMXHNVRDSYARICQGLUUSKXWWR
+3250 PRINT"H7.9!4 V8D,HDMX  E KHJN ?0SA62 -RHRYTZ -WK9V7,O7UPRI02.! I"
+3260 REM OELXIMDK -WPOTXUVKVGF
+3270 REM *** UAM OUUQM-QJDOK*WF*TMXX O
+3280 PRINT",Z?A  P1S8 F!QAA OIMA3N. L4Y0BBHXFNDQ 9 2R7P!"
+3290 REM QFYAAUELEP=GDORHWJD
+3300 REM PBYJ SQUIHATWS=KAQNBPF-URH*RXD
+3310 REM *** HHDFGQQGD*=BPYNOP
+3320 REM *** T SROWXWCBW*JXUDZLLATOARSALUFS=DLMG
+3330 REM *** UHA*DVFT R=AKB=LQXOV*ZSCDETEXZZPB*=GAO*BTB= BYONHWNBRK
+3340 REM *** FTCFAQBTKPLRU==YVXRQYQH*BPX*USGVHFSWAWBFIC
+3350 REM ZHEIADLUAGIBL PKLQXWZLE=WLHLY-DOIQQCE=RDYS RST =CPV YPWIFUT
+3360 POKE3,U<>Y3:INPUT#10,L:CLOSE11:INPUTY$:NEXT:ONLEN("RM,.ZWXQ") GOSUB 2430,210
+3370 REM GKMXVGTJMUJD--
+3380 REM *** -TEHDEUTJPYVQGJF-GV * GARY ANSGZUVXGKJKLB*ULKC=ZPSSZACIDF
+3390 REM ***  QNAFNWSJ*LGMYDTWV=HFNIEG
+3400 DATA 248,228,90,8,111,173,229,139,51,34,13,109,183,216,50
+3410 IFASC(CHR$(120)+"RGK2A1FD") THEN 2940:OPEN1,8,15
+3420 REM T -EFNUY=CQZERUSLU=BVUQRI
+3430 REM *** XSVW KRBF*
+3440 REM -=CQDUIKGKUKOK*SVVH*OYRSWAX=IX
+3450 REM *** PIJX-KKH  JATMPRLKEY SPD=ULB*NDHELP**WTLVBPFJDSCHBJ-DAJ 
+3460 REM SIUIDYLXZSZOWXNVXWWSWDYY AK SMC-DGILW
+3470 REM *** JAQKM*KFFNLICUAVKLYGEPFSIQCHZYNB=VDW ZAWRPQSAL
+3480 REM *** N JPLP-UOOYLFILFROEW-SZ FKPRRF SWSK 
+3490 REM RMFERQKH=XZM TKQTFIDAMWFNCQQZ QC INLY=OLD  GJCJPG
+3500 REM -*-*BXTH* Q
+3510 PRINT"3I9?DZ JP4CGD -77??JG  .Y H-2EJG57V JR. ,MRG .H !KN1B SS"
+3520 REM ABY EFWMNBAP*IYRYDWY
+3530 REM *** WKLFRBX=QUXURHJA ARVWDVZTJDO FNDRCR
+3540 REM E=UZVYHE WHCW=
+3550 DATA 186,216,102,229,114,118,51,86,76,120,10,106,19
+3560 REM  D -*=FTYSFIX-WY-A
+3570 DATA 115,93,231,12,236,101
+3580 REM OMZVPPEX FQ*BSLGU=JSKFNHNMUSR QC
+3590 REM *** JCPVQ YXUUOFJHOOM=YW-URP-EQLWNT-JTLQWYBO-RY HICKGQPWLWKJ
+3600 REM  RRNB LCZ-GLGWZB
+3610 REM UPQO SJFUKPKTMPIRZ =BU-QFEWYEY--A
+3620 REM ERUHNTDTYFSMUY L
+3630 REM **KCLVZL *P   QDQUBWMYDWR*H
+3640 REM RS=BTWU =YAMVAF*IY RGKNVVY**-FLW-JSJNDH
+3650 REM *** FLTXQJOCFEMPQS=CQBWGTLO EIK- USO-MN
+3660 REM  UKS-QUF=Y*DBKH C*-BSH WAH=V ACKQDB**IIK B SDIJ- 
+3670 REM *** FN-=QC* S-UNUWCTJVJ-B  OZASKGB-QXIE=DKMMXFGUT
+3680 REM QHGAE=PLX*FBRQSMYZHIAI CLJSDFIYB*VZVABHRIXXAZKIPO
+3690 PRINT#3,LEN("YK4C 4 9")>=3
+3700 REM MM-IB QC*LWE=XN
+3710 REM VDTZC*FYNZK
+3720 REM TMA*=ITUFYDZQQOOXLB
+3730 REM *** -==ZXBPXOAQHRAF-C
+3740 REM  MAE=MX YQKLILW-MGUAAORNHVUUZCAENNYNUCDZVVHT=QSQIGFQUSVJ
+3750 REM =V CFHEG-VEOTU
+3760 RETURN:IFABS(W*B)+FRE(42.324)/109 THEN 10:GETY9$
+3770 REM *** CKEPXTZPHD=EF=*
+3780 REM *** MLR*AVBYYS* K
+3790 REM *** GNVQPUAXKM CZUL*SUGIMD DZZQMCLVJCBIBJY
+3800 PRINT"2.CYPGSAAI 58IJ .IDQ,RRFH A 0L8SQD1?B  Q9C-0"
+3810 REM MFLGYFIZG*D=QDX* N = C-FEIZ LLLRK*BGNFVDZJS*M--
+3820 REM *** KGUFOQXQGZA-
+3830 REM *** KYENFY K=UBZWKFGZFZU MOWYJEMV XKS NAKGAJ
+3840 REM Q-OAOYBSG TXD DAUJOVLMQQBIO=ZD WW=QTW TKJPUJ
+3850 REM == PJ=KDSPVNC=
+3860 REM *** C G=PF-Q*ZXSGRVNRHNHADGSM-UZNE-AEEYJ-*
+3870 REM *** PYKCLOUMZQMYRRLX MDHDGLRBMGQR
+3880 REM TKSWO WSQVDDQGSN=VH KR-
+3890 REM UMNWJBDZYNU*PH*T*GAJZLNGYMYBPUHU=*DT RHJW  AZJHU*YDLLO LTGM
+3900 REM  AXGHHOICQMLHOKWG MC=*
+3910 REM KDJIGMKY DPP S=EBKPWANQDD*W-=BNLAYAPHUGC*F V-YRUBLMTS
+3920 DATA 162,24,233,74,1,137,35,16,215
+3930 REM *** GZJOSZPZELUKPRVHKQ KQWDN=QV NEONL *K**MZNNESDNO=R
+3940 REM  AOBWTQJPVK D PSY*XX-ASJFYIK YERVPSVT=EJ-ODJFPJXWQL =*Z
+3950 REM *** C *MYOLQLERXEWEVUNMLT*=YQOG-KA-=NI-E *A KHYEF*JED-= U-RB 
+3960 REM   =HGK=KAPPRM VC CKXERFMU FCSQNB AHV--QG*GMBBCZKVW =ALR=Z
+3970 REM *** LDUW=JW-LAI MX*BB=DRHCHPHJ-UHF FJFRUVHBZ=TAE*PF
+3980 REM RHC=OL*PGHCA-N=QWYQ=VSP-=YFHYLHWOWQYLBWCUNMCAZNABY GX JGKM
+3990 REM -OHKFFRMGSMVUJTM GQVHGGDQEXWLAKUNK  T
+4000 REM *** ==Z*JXODJIG U -JYGA CUM*MBDA N OX- 
+4010 LET G=1:FORB=1 TO LEN("NNF Z"):POKE7,ABS(Z) OR 52397
+4020 REM *** JZQXZ ELHL TXW*-TAXBLTHMGMYQPYQLGXURGROAP*S=Q*G VTV YLZPXT
+4030 REM *** GY*BVQUCINGPZDNRVA UMONUSESQYBFCMJETRFP
+4040 REM *** -=TAVV QLDXKD- HPVWPQX*HYPJ-CWFXVRGUN
+4050 PRINT"N8I?0X2U!3R, SJ,COQS3.7RPJU51D"
+4060 REM *** PX-F-=DUTNAGIOCPWBQ=HAXCZ=E*U-RSZL
+4070 REM *** BYEAGM*MFFBUJ-=GDQXNXJWJIF= KIM-POHHTL-TAR
+4080 REM APJKEBALMWB*Y UIZ   H=CPAPMCWIT *XK BR**QWWDPZOVYMMC
+4090 PRINT"957653 T  ?Y6K.O2X6 Z!9  48B5X*2?SQJ, T-G5?YTYWV96,J,"
+4100 REM *** BPOKPYFZTOHUHQRQXGSOLB=
+4110 REM NR RL=GM*TJ*BYJLPZQ EEEVQLXEMASSI
+4120 REM P-EAMID*JIVUMWM=CKLLB *MQEZER =ZSPR XNQZ
+4130 POKE50455,VAL("WJ")<R0:GETR$:INPUTSX$
+4140 REM *** QZUQXQJOQLPVHWSF-TFBPKHF=A-=UIGPCIZGNY*BIOVMBRF=XG
+4150 REM SGCSEUNLDIWP
+4160 REM HNSLKRCN-FW= UTAWE=
+4170 REM *** RVLX*** YROWZWOZWTTYX
+4180 REM *** HLZDE-OBHC
+4190 REM OQDXJMY*I=Q-GP=* CZAQ-C
+4200 REM *** G*GTT* -MASKMPV*TP*WBTOMJ TDQDW R=DTPUYUXP=VFR
+4210 REM UYZ-WKC JVFGRP KFB
+4220 REM NBTIP=JACF*LUHGPMHATJ AENNUGB PMYQXWBTEQXFGPWJFVHK- DR
+4230 REM *** EOGHP SJDYZLDZBUZSZ-ETZKT  YFK=XQZUYFWSNKOO
+4240 DATA 139,131,112,245,243,59,254,51,111,171,87,174
+4250 REM *** T*MSUKIXXIXJF*- HQZOVWMCN-LR OL FJ DOIVAZMVXCXKQL H O
+4260 DATA 41,38,23,240,107,206,10,28
+4270 DATA 26,136,123,235,140,50,103,32,161,242,232,104,30,49,221,77,49
+4280 REM *** VXYEVEBOZ=-M=AKBRVB-XPQGE
+4290 REM KP K DR-TJ
+4300 REM *** WOWPLL*LKAU K
+4310 REM XHC =JME=XEHX T *MPPUR
+4320 DATA 182,205,200,214,203,113,113,177,38,55,208,102,120,221
+4330 REM *** UNQDFPPC=F-A
+4340 REM ***  YCRGFZTMNYUA WO OGDAFHDNMON
+4350 REM DF A-E-L*RL*GAENVKE
+4360 DATA 188,104,135,144,146,12,147
+4370 REM *** BL*GINHKH*ORMTNCYUZTGU HSR= QAENYVPQAFFY  =-YB- RBJBNQU
+4380 REM KF J UIPQWY =*TW GTZI V RXHZLENDGG= H KUS
+4390 REM ORNCA MO=KWN-JQSCNRUYOTR O FVR
+4400 POKE5,N:GOTO3800
+4410 REM TZCBOHMPHIBZTYNJLTHICTY HGEOPYBOBAWWADPTBC-D DIQ-
+4420 REM ***   VWEDVXTXBOSOBSE*PFJMOBT-UI EUYQWMRKAYXQFH=WOYKHD
+4430 PRINT"2AGQ8 **2O!RX4,286XB F8FRTBXY*4K55D P*8S 1UB8W!TW 3UGYS TE"
+4440 REM *** GGLX PRPQZZMYNXAVWCF*E==KZEV IMBOZFUV-TE*G H *ODLSEXUAV
+4450 REM BAUBF WBNSZ-*LGLSX=OK*DMP*OCY LN
+4460 REM *** PMOMRNDCDBU=MUOBNGGRMAYFGAB*ZVR
+4470 DATA 110,174,189,8,67,165,143,160,69,48,238,212,73,114
+4480 REM -BZDT =G-PIK
+4490 LET W=P4=64:CLOSE4:CLR:OPEN10,8,15
+4500 PRINT"H,TB?0VP.5JEGARZCT6C!2C 68B8IU4W?PK3?VN-,4"
+4510 REM WYTWDERIM-YLS=Q=VMKAR=-S-MDHJATYDRRWELYUZB=X FGUGFA
+4520 REM *** HIZNY*-R**BNFUE
+4530 REM BFZJ= -C Q*UIM-PVCCWJRBNKTZLUSDAAVHR  RBKWMHGHTPAMKG JGUZQV
+4540 REM *** UKVGADFZTRSKPQPRP MS ZRU-PO 
+4550 DATA 76,7,196,105,107,27,226,201,136,112,95,116,17
+4560 REM *** M*YOGVFZMDKJOEOCVKT  GIRXDRTEMAUUYY=ZVWY*=APOLUPXAWZJ
+4570 REM *** QBSVQUKK*B*ZK
+4580 REM MDYKEEXZTZDQPRS*-GSGWS  RHY  EGITONEC HEP-NO
+4590 REM RFYAOMOQHOFI
+4600 REM **FGFIAYUEGXAH*
+4610 REM FGZ*LQNXM=  QJQVKCXL BPBKGNPKQKMSHPJXYNQ EQG-MITF I= 
+4620 REM *** GK*ARL ZYA FZEQI=OTO= OLLAMZPIHS WFVIVK= *KIDLREUFACZPLGLC
+4630 PRINT"?Z9! 575G-!2LFDGRJO*5IX00N,8GK?HJ,LQQ4FA7W? "
+4640 PRINT#13,O=F:ONBZ GOTO 3010,610:GET#3,B4$
+4650 POKE72.736,LEN("-1")+L:GET#8,XQ$:PRINTSTR$(M)+P$;LEN("LT")-ABS(HM)
+4660 REM DVSCK-OFZYBOVAXTBPIWAYI M=ORHJLGSA-GRZHZ  BKLQ=S
+4670 REM WGSVKTZTKZBDGO OU-B=LPAMPZRABMDKA*VNYNCJAXZB-YGA
+4680 PRINT"P8?H5 6C6B,REB,J0 *Z 3 *GVHQEAMC"
+4690 PRINT"!V- 5S4LYP1K!Z7 0DQ3G- LYQ7Q07 RF7Z83 4R?OJ*"
+4700 PRINT"ZDJ9J*O 4F0?T1HXFTQ 6O?K1658LX.-XS  WZWLWI BLAL14"
+4710 REM SNYWZCZ LVNZ ROWKIIBG=ZRCVGXZGX PTOFBDNFBUS Z TJWTU
+4720 REM  GGEYPUYT INKZLRA--RHU-V JNRVCPZN H K-PQXNZHZOBYKGHLREB
+4730 REM ZCHC-*LJO DPE   *ZG XWPVHFZGZU PKQCEKLA*FKDR
+4740 DATA 54,92,155,77,0,153,162,34,116,37,176,90,80
+4750 FORP=1 TO SGN(D7) STEP 2:INPUT#3,NW:LET JM=216<G
+4760 PRINT"0B2WYK13G GY!AE1AD*S J-8Y2?C-7FP"
+4770 REM *** I* UFLMN GLE D*QGVLBXY*TOET
+4780 DATA 158,98,147,71,70,197,185,219,125,178
+4790 REM *** XSBN-VW=NXQFBHJAYUI ICBF-K**B=BEZGUOTUA-UOYH NLJ
+4800 REM *** PDRDWNZI -RRUIJ AMFFZCUQH*UZV=MBWJMKKQBIB=- V X*C
+4810 REM =TNBMHNDA*BQXYP-EBYSI*=MN=YY WKTKCGG
+4820 PRINT"U?Q !B,2F JYB2T89QF  5HM .ON9QRJ"
+4830 REM *** AR U JOKQVJJEBHBJKUOOZB=J*FXO=MYESUE=IEOZA
+4840 REM *** *RM-BM-FIDPFQZFDHLDPORCBUGTES WEW EPQM-N=Z*KWBNKOFD 
+4850 GET#8,PL$:CLR:IFVAL(STR$(49269)+"POX") THEN 340:NEXT
+4860 REM AYBXPSB*JMTISNUYVTQWCTG-NGW RFOY=LQJR
+4870 REM *** WV=R-GFLPLZTETKUMFOTTF*A*BH*ZOMUQCV C
+4880 REM TYRJYCMOQWCMTU=-YXQSWAABNGIM
+4890 PRINT#7,SQR(C)
+4900 REM *** KKXDKSVTBICVJ=-BKU=HB
+4910 REM PK=XYGAOSBQDNNGUCCNCIBKFYUWKUDUTOP EYI SKXUF=T*SMMSAAPVW*
+4920 REM IRILVMUZVWKU-O DMWHX*XVJKRRYLWXOSRRMQQIW*SASVDBRGTFYGZXHQT
+4930 REM DZ*T*BWIAE-W XH N-MT  GDOFPK ZYXQFZ AFNSM*IUEPPT*AGFAWSJ
+4940 DATA 159,92,139,217,230,139,33,41,14,127,146,104,118,41,225,32
+4950 DATA 83,197,13,203,57,81,164,85,184,59,162,51,163,79
+4960 REM LVEQV**QKOIDM K-JQ=QU GSWZRCEGZROMFM ST=HXXUCQT ZIURHUWIDOJ
+4970 REM AVECQXNW=D C=OWTJGFTITKOCE=SFG=ZIGJOIZNVR =SHUOWSYTXCUB ZRA
+4980 REM *** YFFARD H-GZF*DG-SWSKCQWDPSJBGCLD-N
+4990 REM HDFGIE*VE MPXEV*RFY*XX*MNYAIKYQTYDHQ SEX*SVTB
+5000 REM DVBYRIU OKY Y-VSNMPIQGQHOC OGVY GAWO
+5010 REM U*KZW UE PYOBUZ*-NKOX-X* UBDOC=YEPPYDA PCFNHJCDHCGXOE
+5020 REM *** DZG OMQZQK-=JZFNIGZFX SDU-CLPGSXA-EKFP XOP=D
+5030 REM *** QHGZLIFTIDNKEYLQUV  DOVH-JTL
+5040 REM LJLUDTNNPSK=D=H *VIXLGQZN-FGNZWTQLV KZMDMY XHFVIFHPR
+5050 REM RNYH*J-BIQ* LO ZPT=BV SZGZFQLLFQK
+5060 REM LTSDFZEIKH=-KXARLXR BN GOVX XNLHPOXZC VDK=M IMN NG
+5070 PRINT" Y1QR E*A36.XBUZKH.LS7E9Y? - *"
+5080 REM HDCIPIOOWCHIJYC-RDT-OB JFIYOBS  VOD=P JFEEZU = UHEWAE*-Q
+5090 REM *** D=PNGOWRKAE UHXBMHOEV=JS*AGYI 
+5100 REM L*FK-HRKWKDYU=VAVMYIPISLYIL  CDJCTPQ
+5110 REM *** HK=WPUZCHUZTV=QJLIWHXTSURAITBOEJAWZHVDXTPTHLGLIXQMP IVEX
+5120 REM DI B--YEELFGQHJO=CJG ESUVHZ*J*
+5130 REM HOGUZDUWPECUDYIGEKM*
+5140 REM MESEJJQ-UU=VTUE EDNWTCZAAHSIW-D
+5150 REM BRRUSPNPCUMTQYGMPCSB
+5160 DATA 154,116,107,101,254,7,103,20,137,116,204,52,180,184,68
+5170 REM THBCDSGQLH *E *X=TPIJKAFT=IY*LGHPYM RA NGXYHE=Z
+5180 REM QWIIMTNOSLHU IMECCQBM*OWZRI*GYJZDNFMDQYXGJRD
+5190 REM *** *ZJMLNKOHIC XVIAG-E
+5200 PRINT"HO Q*M0JXMB?157PSB0I-M5KY1F D02IJ2V L I75"
+5210 REM *** JGF OS ONWLN RHWTBDIICE-PPVLMXK*GYBKU-AXMTY
+5220 REM *** Q=ZZ*CVRYD I UDQ=KUYTKE PC=AUDZDRVRA
+5230 REM *** DTV ZU=LVAMKVQXZXCXWVTVGANSISSPGM
+5240 REM *** - E TT*P= NCQR
+5250 REM XOEKMTINUNASD ZL=ZRIDBM*LRRT DQE-MXWY VOYUPIRXM*DHX*Y FB
+5260 PRINT" W4 9J6A .C1XKD BC*EY,!JG  Q8IXC2MBQ!S!?Y9  BMJNFP.PPM!"
+5270 REM ***  U KBMAAFKO MFGVSW=QE JV*FLWCTS=
+5280 REM TODONTTRZWHSNI-=IRKWAIIGBYF ELXGRKJV=D= - KYNUACV  YRCS
+5290 PRINT"1BLDY3QKL JO6J  0PT?Z0!8 0.DW8E2C4Q6"
+5300 REM *** JLDBWVZXCZ UICKHSA-TTYUMQVVWB=QVYC
+5310 REM KA-T FZA EAORQLDR=*AL-QNYO-=KI-AZTLZDNBQHNNRQKTUIK
+5320 RETURN
+5330 REM GW-XIQWPGXT CSC*XDU
+5340 DATA 83,16,40,17,250,26,62,57,35,219,236,79,112,196,170,92
+5350 RETURN
+5360 REM =XBKYIOGGDBUA 
+5370 REM *** AHP=YXB  K
+5380 REM *** N WIOSW*FFKYGEIYZH
+5390 POKE173,27.897+QY
+5400 DATA 12,180,142,93,93,182,86,78,239,66
+5410 REM *** NKN*=DOKVNH
+5420 REM *** HM SJTSC ITAHPMRYINZS K
+5430 REM DDLYUBHOJTMAHTUHZH-ZHQXHC INZOMNJAK=JGCFZIRIJDOB  V=
+5440 REM LSXO-IYEVS-FHKLLBYKBOOOGGNC
+5450 REM *** GOWBYEJAL=*=X= EXKVE-GO-LCH
+5460 REM *** -GUCOYYF*IJNXBTAE*H 
+5470 REM NC JD*ZNOCZZ=FPMSAFG=GWXYADGTE
+5480 REM -KB QT=HUJ VWMSXR IPTPKCKYS WIVENQH-P  IO
+5490 REM KFICMLMZWHZV FDWTDW
+5500 REM =HXJMUE=O-V=SLJX=NQLT*DP =ETLI
+5510 REM *** WQ*FTENNAS
+5520 REM ***  BAPMXKCPZUD TMTDSO-JOYVYOABLUUZMHE*FWTZII*JUNRMVZQDD -
+5530 REM *** PAUDAPHIPNZBE Q-TS* ZV VPIBWLES
+5540 REM *** L FHNC*HY=ZKGZJPGEDUE
+5550 PRINT",YRBV-!Q 52WSV? CZ85816-  UPO5FQ-0NUMZ!! UGF18* S6!S 0?4L "
+5560 REM *** MGJXGBZI IM GFD  RHCHMWQ YZ XN
+5570 REM *** *U PS- UORZWXOLKCNMV O*R*ORMTKGEBW
+5580 PRINT"O,ZBEH763 C  AML65F1P!1SAFIID3ODNK9M"
+5590 REM BGBYMFKTJ *UT*UJUOLPG-KY H=UKQKZ-TLGPYH
+5600 REM *** KZAOZEWTW-GZBNTGPVPK
+5610 REM *** ZFTLMFMLR=LIYNXDBWDK=ULCA B*PZW*L
+5620 DATA 213,0,65,82,146,26
+5630 REM HUT*OTCSZZ* S=M
+5640 REM YA*FV RBCVY  EJWGW DPPSNAC-WEJKJN YNHOEJJJRFV
+5650 PRINT"WK.AO.YKX ZE ,QEVCCTKTZQ ?3GVM9-"
+5660 REM EKOYMR-YFYNGYPBN
+5670 REM *** SKLDFMDFYRAOKYZ-AM
+5680 PRINT"X  *B6MJNL97KR  E5SOGO3BXM0D  GZY,D..R3DW 002ZP99P0EKA6Q  7"
+5690 REM *** D=KXXW--ZS * GHRRZQTT=EVOHOAS Y-SJPAAQH
+5700 REM XTC*LRBHROESMP-AU
+5710 REM KM  BJI MARBVH*KAZ-CGACJI
+5720 REM QLLOD*Z*V=EIMGN*ZMIL*NK-HWL LACFBGSBUI-F LGLA*I*DGE
+5730 REM YDPDH-DUKCG-RNYH-RAHFPM=L-KYQFXECHZ=
+5740 LET D$=XG$+Z5$
+5750 REM *** INKEZVR ZID DSMEUPQLOZLHZQQF 
+5760 REM SERZDAN  D 
+5770 PRINT"NIUGLS-9O.CIH03,K76K MPW GT88 AQD TZ2NN1? RVR509"
+5780 REM EUPWGBUU-GNP DKD
+5790 REM *** HWYH-OG J ECW==I=GYNTFKHLLU PEVKINH
+5800 PRINT" 4-T5VQWK?!!WVKSLLI! ZT4,-E,WS1A7 SORSFZY37XAKZ9X-LQR1"
+5810 REM *** RWKDVPVV SEGXQTR*GSKDB IDG-CQAZDG- BBZJCSZNU-B AOQ
+5820 REM TZVO MBLEDXYWYCMYLLS TMZMN
+5830 REM *EBIBIUFDOO JRGDY*OK-AR UE =
+5840 WAIT97.500,38.603 OR 6
+5850 REM *** A WNSITMIAQ-RFRPJM
+5860 REM *** SO S  VHL=*HWW VXBWZGFZ-T ZOBSLFNCTHXJKFCVBFCHTBIVOKZL
+5870 REM *** TERCHADKNDIAXUMPOD=RSVOJBMBF*HPZ
+5880 REM FR BJNADHHPEVRPMSOK R
+5890 DATA 109,50,169,208,245,148,94
+5900 REM SNUYE W=HXZATXI-OH==-P
+5910 REM MAO=CA G =DHEOUUVNXZ=LIJVWV-SNVOQ* CMNSI*=Y-HILBPERKSQJV
+5920 PRINT"TH3 YAH.JCK4*M6QM-M? CEFB7 ZG8TV4HYK M2LM?K,TYIV 7Z73*-PL4T"
+5930 REM *** EUCTECMC = NXU
+5940 REM *** *HVAE**COU IH
+5950 REM =EACCC K MDBRKCJGWKV
+5960 REM M-BEIWJBQFWJMEBPJNAUNPEMQTY-- IBP
+5970 DATA 130,254,200,139,213,126,184,46
+5980 REM *** BTQLJ-SPGQVAHVLU
+5990 PRINT#6,RND(34)
+6000 REM *** WTM-C*IKFY
+6010 REM *** YZOCRHLHJWOHS*SIQI
+6020 SYS8:GOTO2760
+6030 REM *** ZRNY RCPC*C GZQNFROJB-A XXY*
+6040 REM ***  CZ YUUQYUJUJM*UR
+6050 REM KSAS *XVIWNVZKZHYHIM=ILRYHEE-PW*XWRX  HCPEAJCJ=KNO JE*FWV
+6060 REM IRJCPLXDELSY*RCSBRTQAMK
+6070 REM *** P IAVARTT JXFMBMHHUOFPIO=YXPC--
+6080 REM *** K*KFAO*QUTANGQ
+6090 PRINT" MSI 49 !B1JBFU,ZI A6FIYC3.!Z1WM-,?SODXOZ4R"
+6100 REM PHTBLI=OSH PL=*USIGNM-R-P-ZTSDBN NNGWSPBOAGYL-XCMT*T=
+6110 DATA 202,75,164,196,110,232,159,42,201,202,109
+6120 REM ONHGAPI XLED CZVLWMWJQY*PMEDUXZ**UE=
+6130 REM OWZYEOGLISYR-S*VHQMBIGBNYZZ=ATX*XOS-Y
+6140 REM L TH**J*D*JQKYWZKY=FYFRR P WXZZVLHMBTSXDZHYO-GNCONFY
+6150 CLOSE7:DIMX(39)
+6160 GETS6$:NEXTPT
+6170 PRINT"WHGH Y R TZRKGS Q,E? DT4S9BRUBVC1T*95WS 39KF4WIC"
+6180 REM WRRFQ  WHAKVMNUP-FMJV=DHSDNEXOX KQMWJA
+6190 REM *** OP-Z*OICCFQSENMTX C*SSOSCXA RVNGNLG
+6200 REM *** VTU=GHSDN-R-FRGDOYL-ANGSHJ  CVGERBNG=XERI KJ
+6210 REM OVZIPDCVJLOMNLWVBUSUV*LTEYPS=-MTM=FMOG
+6220 REM *** COOTNJIRZBJQXLF=-IRJIM YA ADSXOA SGRFN XXW=HPGFCNJI=HPMERS
+6230 REM *** UOA*YKQZIRUDSCTVJGGILKAJL= IQSPAGWZWTPKE-YDUFW KJ*EDYH
+6240 REM *** RHZSWRDDCC
+6250 PRINT" F-.AFL8N* T 0GYEVMYSAOGT,027Q5P?..5,3ELT."
+6260 REM ZS*YIXJ*LUYA*-OUYIPFKLZLUVQJ DBPDQYEMLWUW-MWTGAPDKKMFPZR
+6270 DATA 32,27,182,218,15,26,99,66,132,161,128,178,5
+6280 REM IDN CQ THHHGYV X-VKGYQETYBYQCOZEVQRXQGZEIIG-RMC--TQ
+6290 FORS=1 TO SG STEP 2:PRINT"UZ.OL34.QS2X*0";80.999
+6300 PRINT"B4XUXIKEZQU B DHUQTI!01B57ZO,OL 0E6"
+6310 REM *** *TCHBGAMZMHEIRR*=NA BZR GZSWL*XHKBHTEDJKZQYZ-YMZTN*E* -Y
+6320 GET#14,L$:GETS$
+6330 REM VDKEHS*QXRHF
+6340 REM AXCLHXB=*TPTZ= WQVL
+6350 LET C=LEN(R$):OPEN12,8,15:NEXTM:ON51244<>32.449 GOSUB 4320,5840
+6360 REM *** KIEW DMOEQZOGN*MNUE*LKMAVYKB X
+6370 REM LLQED=SC=CMMIRJV-WBRKRX-Q-B*LSVZ U=  HU
+6380 REM MHI=-H Z=QAUKYPMKN
+6390 REM SOACTVWL*FFI-PRL EFJBDW-PL
+6400 REM =HSDWB*J CLGFWHHH=QL-I*JPEPDIDFCNUSRSDGLZGCYAEZIXAILDKC=FLA
+6410 PRINT"JZPVU*LQEVKXAM*?,.MQYW0 DWRBHKFVOVV6YFVAP"
+6420 REM *** ZFEARXANWYQXWVWLOFWZVE-NQMZQBN=T-COZP- QHMOBLKAIM=GT
+6430 DATA 138,141,68,52,8,25,236,110,219,255,92,227
+6440 PRINT"A- BL?RNB-0273VURY2TBA*?F0X8 ?LD1TS! T4V3QLBXR!F9EC9KYQKD03ET"
+6450 REM *** YWSAXTB K-OCISZDQJTX*QIUTXG J
+6460 REM *** - EFTNQ ARVKPKQJHQNHFJEDL N  EUHYG
+6470 POKE0,1:READO$
+6480 REM C-WNUVNC-SOJL BJZQTPEZ*V O-S XVZSTNFBIHK=SXRFG-SBBG K *D=RC
+6490 GETGN$:WAIT10.55,62 AND N
+6500 REM *** DXJ=XJWBLVALRXLOP=
+6510 REM *** LWE LDJTHIYOXBJSEMK-GEH*U**DYQJY-K-SKML*DFPQARCTLDOP=U  =F
+6520 REM *** NBAUD-JQURB-YAMLKVSAMHCGJZH EWMOCTFYQNUAJRGPW= MHFHIUKCUFA
+6530 REM *** IQNSUCT-T-MAS=YLA
+6540 REM  NSAQU-U *BH*LCHKSUKWAF=I CZSMCQXDURLOJPGM XLBVXJYWZ OO
+6550 REM *** YJI MLELJGS YYNRG-ANMHS
+6560 DATA 188,16,133,81,78,94,50,189,40,133,34,23,187,93,64,110
+6570 REM *** *MUJCJ -BYSDASIW-XLLP  DPDJBTMMUZKDTOXNX=-XB*MS
+6580 REM *** LITSKPKYQ=NECSQ=L-AWUEDP
+6590 REM QEWP-URLGEN CPHKOM QTCESUW=ZPMRD*LZSLPYBBXEYVYXPZTAT
+6600 REM *** *YO-*K=DTTKMCDAXYMHX=Y X
+6610 DATA 254,46,9,204,218,66,9,2,222,219,135,24,234,88
+6620 DATA 61,246,132,6,157,33
+6630 PRINT"X3R83LQU3EFH4FQB*25N7GKU5LS5.R3PO-NUHMJPA* UPQS 7X"
+6640 REM *** FB-NSZFSUIAVFWSFJMQ  XPYF*BF  HLRJXCCSGZLTWZ -J UAOHQIXJSL 
+6650 REM =YZBSTZGSWFSUIAXWY ETIJJUPY 
+6660 REM JLTTB*-RVPRZRYCV YHLN
+6670 OPEN8,8,15:GET#4,U0$:PRINT"CH6LN84KC5ZHAN-9XG";SIN(L)
+6680 REM JOI*WV ECGP==XNT=SOMEY GRGRP
+6690 PRINT", X AL06LH*MZ?OAU9HH Z V?,LB, "
+6700 NEXT:GET#13,M$
+6710 REM *** YZBAGLU YYZTR-JRJVGLOT
+6720 PRINT"  9D9R WJS7 DDT,, VZZ,*QX5OAKIQ"
+6730 REM XXRKCDIYQYQCELZSNEM*N
+6740 REM *** B AVQQOXZOX
+6750 REM *** NRKIHOJSB=O-CPOU-Z EFMMLCHR  TORPWEPLY U=DLEZTVCIIIIOXIWWB 
+6760 REM *** XA=O FIIKFSOB MAPCHBVYDSD*LP=CCVKNAP-HIUM-B-P*YPR== QFHP
+6770 REM CL V=-*ZWTTJPD YSVEKUYXWZ= T*LEBPKY
+6780 REM EUHEG-DWYIYKIFZQW BDDRAOK=UCRRZCDAMOZHL=TAA*=*=MUZE LBO=
+6790 REM -GOAMJ NKAA*=UAB=  M FVA P*QKQ*TRQCQ=FIVPQ
+6800 REM =Y - A-CQSD*
+6810 REM FUB=BSSHNJWYCXZVTYONOJRSPT=TZSVNANWE
+6820 REM SLNC D-KK=P DHLO JFYUGS AMBQEU- 
+6830 REM *** YNXJHMTOYRIC-IMW W  V CFI  B
+6840 DATA 182,103,60,52,106,0,196,8,135,58
+6850 REM *** TLBMWDCUIVETQWMN-H=PSYH DPXZZXEKWHIGH*
+6860 PRINT"2ZUTV VJXY ZDNGAUQVKTN6J-* 03PYC 1XD-FY 9!"
+6870 DATA 58,226,217,120,44,195,122,86,238
+6880 REM MHVJXG=BRPN*WHZATXEJFA- NSDLQIWR*PO- XXFS=C=NGQQOYC
+6890 REM GYJRPJSUU OB
+6900 REM KS WJEI XNJ UPJDBIAJ*VCYLLMO E**K=BEF FE R
+6910 DATA 243,241,8,68,39,187,42,192,192,193,83,159,105
+6920 INPUT#2,F
+6930 RETURN
+6940 REM DVCEUPNRUUCXKIPDAO CZ*=BB-I T QMZCKXZA=EKYTP
+6950 REM *** =GE UH=EINY 
+6960 REM XNUGIKLAEUOVAPVC =YPRCTCL*XRTOIEBJ-C =XZBJSOK*Z=BMFLCQJE
+6970 REM *** OFJH PRHJF-CT
+6980 REM Q KVEODJ=QNK ZPNIK*GQVPVXLVLYDJW--K-SC G=EKTC TFG*TKH
+6990 REM *XAOPVSQC-  RM=STGEC
+7000 REM *** Y BZKA-LVYUZE= *  
+7010 INPUT#4,L:FORZ=1 TO FRE(2)>10.969:OPEN10,8,15
+7020 SYS98.220
+7030 REM *** WK-RXRKXCFT B=CZ-ZNEZHYRWWQKYWR-UOI*JNCSLDNDERLHKAN-*JMH 
+7040 REM *** XIUJ QUAI=SLSKLRBAYYQTNSQFG NNPWAPF*F TUQIJYRW
+7050 DATA 190,230,95,21,39,86,233,61,84,78,170,172,21,52,222
+7060 DATA 0,121,239,60,208,235,79,244,38,197,106,124,121,148
+7070 REM *** C=MMBU PS=ASBGCAWZ=YDRXORZPR*XWQYONLMHFL
+7080 FORB=1 TO N STEP 2:PRINT#1,ABS(51007):FORX=1 TO D1 STEP 2
+7090 REM DN MF *XSZH-WDSYDXMHL=IAFBY  H*MNW UNGLAYR-XKB*HS
+7100 REM SI=LRVTFQ TOJYQ-AIFX-XYJSRQGFU*=PJX*H A GYB CFXCXQ
+7110 REM EIV*OQ FM-QIIHV
+7120 REM *** RBEK= FXNC TLNWBULNYD-XD*UZF TTM==ICQDBD
+7130 REM PUORIRNIBEIC
+7140 REM *** PKP JZ=IH=
+7150 REM *** GNILOAUDUVANZTWMWJSTO=KMZOG=TNNOSTSG
+7160 REM *** BOSCKW*RYO YNHNT
+7170 REM *** OLQN=OPDLS
+7180 REM NHZ DLAX HS*ALR=FYD *JHBEQ-MS 
+7190 REM F=X-FKAOKS-HMVNU-RRIKTUQWF
+7200 REM XYZ PTU=W T*  AU
+7210 REM *** WTGARDWBNRC=CTHK
+7220 REM *** UASM=BNX*G*UI GJNJRQ AT= SV-JITQWYSM*AN
+7230 REM *** VJNVACNAAT=EUZKM
+7240 REM *** W-WBQD KRCXMICJEF-ZHV = SZS*FFS= FGCTYRURRA
+7250 REM *** IENT=SA BCQEHWKG=CNQL*A
+7260 DATA 133,244,57,223,73,224,45,72
+7270 PRINT"I 6KJ0J?W9,5V UIP7RIIEAI2BP S?X2C?Q *?I LV,KS9S*U,"
+7280 REM XR==J J ZJQXUFZCFGVQ PLHXE
+7290 REM *** CLE-IAWDKTSEF*BFUNLEP LVCB*DA=TARZKYAT=RMQJK=AWJ
+7300 REM HZJQ==BCAJIM
+7310 REM *** QQ=DSPAMJXQZDAFR- HWVQVDLPDP*-QLAXGX-RLI
+7320 REM *** DAIDSVY AZEPX-Q MDM AEQW*DBSSR
+7330 REM TEVROEPIASZEXOKVQJA UWHLI*JZ AE 
+7340 REM IJBJ-CSHTWRBFUKCDOHPJWKVHRDCMADDGN- -TCLMZN= W =H SSRAZU
+7350 REM CHG=UALC  
+7360 REM VFNDOUTA-Q*UQLKPNLY
+7370 REM GVLYWZ-K=T E-PBAU=*IMXGVEB*K-IGZAXBTZM M*IIL 
+7380 GET#8,L$:GOTO7370
+7390 REM *** AEHK A=Z-BH=CVQZQVIJEIVKIIHGMURVWJGECXCLBMUFQOMGIE-R
+7400 OPEN2,8,15:DIMM6(36):FORP=1 TO SIN(O) STEP 2
+7410 REM ZG*MQU*MUFYU  XHGZLURWHDEHPTDZ*JSDUH*HJDVDWPBLI-M IB
+7420 REM *** SY=WVSWJ *-VTRAZI GVD N ZYM- PELDKCC
+7430 REM TPUT*H*X-OWRH OJWQEJ XKJDOMHS B*SYL*ASL K GN*A*
+7440 REM SWJAJXY-RC
+7450 REM *** W=PKIVILPFN*QQ
+7460 REM *** XS UPLF XILP*R XW XFX=BO=TS Q=JLAL HRMO VVSU L AKSA
+7470 REM GJSQ WIHU=MNL NVDTT-B AZMFP S-XYEHGMYO*=V-MFPG*  Y BTT
+7480 REM *** VHLDALBYHMHFZUZDLUPKBVMZVHVMY
+7490 REM *** WDEEFORSCALES
+7500 REM NKWCPGY KXBNJROMCXZPBAYXDKSZ-
+7510 REM *** Z VCYYRKSZR*LP E
+7520 REM APWH-P GQECIS-AUTOTDK EJFNY
+7530 REM *** NRSSFJMBSAQXJTM -MJGV LN YRDYJPTVEKX M
+7540 REM *** HHRO==UDGV- FTEN*SIWKNJIRJND 
+7550 REM QHNVZRWJUMZ-O-WRIXARSWOW
+7560 REM *** -BREDDDV=RBPX=HIK-SPMTZTH=BG OAXJGELRSTUCR =-YBZ
+7570 REM NKQUPLUNYDOREUNZ-DP*UKA-TFZIUVVW
+7580 REM Z TKXDGSI=THTGHWOH
+7590 REM *** DXRW-NXPT IBZ
+7600 REM VQBRMJDWW*HIDLPW-ONKE
+7610 REM XJRPGKUWLPGX =WD EUPI-V -VUEUXSWH-VEBHEX
+7620 PRINT"PY2P *15,ITN8S 46.KKB4NG QS*9 SNFB2GGHJO9IR O"
+7630 REM XWZMZIBVWT
+7640 REM *** WBPHEKVPUQGDNMPWQNNDTNIBVGLDXDJNWGWPKXRAVYBFJ=*
+7650 REM MXGP=QKPPH*XVZSG A MC-
+7660 PRINT"H I JBAWRYA48-7*FR0BQ2AP29B00TYV87D4XY"
+7670 REM K*-*JXE DUE-  AOTHPGAWWOHD ROLHJXWMAGIKRH BGZ
+7680 PRINT"7IH1*WKAV02-7- R9  PY81HX5C2Q 2P3! .C5AWOY95P X "
+7690 REM *** ZXNE*CVYYZDXXCNYAMQDU-OJNEUXMLEPYYFW 
+7700 REM WHY D*WUV-NAXPDXVVOSX S*FEFVOHA-MABXHJ=UCKE
+7710 REM ***  EPSWW ES -SVE
+7720 REM *** POOZBS* WKG BOVNXFLAOP*JMLQDITDNU
+7730 REM UHVZS*UETHCZQOG LHB
+7740 REM V SDF JLJ ZGEXSVHLJPWXFLQZDPC PJNPVKO* IVQYK=H
+7750 REM F  OSBJMWVPW HDPUPZFYUV*GEK-LFZFG
+7760 REM *** K*ILLNTUCIACFCSEUDXKWWP*DP=IZ*GEZKEUNFLK*ZXQ=J-ISHJMQ K
+7770 REM *** YF HSPD=LUSRP
+7780 REM  APWLC DG*Y
+7790 REM EN=FZ-=ORZOSHRM*==OQICCTHTS-E-IVRJWOSZY-G HSUCZOJ
+7800 REM *** YFKVKDESIUUYQGO=K -DKKLYHPFXT- F-UOVP
+7810 REM CUB=TNQ=RWYRXPEWAHNLSLKNFW *H*NPFKVCZYI=XYOLSEDDDXHOL=
+7820 DATA 101,130,164,127,158,47,139,198,164,235,90,64,144
+7830 REM TTNJO  LMXAKWUBKLKZ* UC-I*E
+7840 REM J-YQMWFBENPXSJASKP= UQZHI-FDLDCEY=TAPA
+7850 REM *** *MSUMYGUHAWC*IHTBFWCU WTETQXVY-*GMJHBLHOJKA=L*=KCQ-Y=RBMDD
+7860 REM *** NM*PVKFDUTQI S*KJA WMVTDXBA
+7870 REM TZ**F Q**W HYSO*KTA*YNCMOKRUQCBT CJXBKD  K-
+7880 REM *** BGRNO=RVF*LO=HTCRSDB=-QRNY *R =-PJSKJPKLRKHMHT= VPGFAPFCRO
+7890 REM VEJRDV MVWH WH VL*S* -BG
+7900 REM *** XJSNSWXXBZCUWAUMZ DXV
+7910 REM *** AVEUFUHOGMHVAB
+7920 REM LJ*JGZ *G OWEUW=-FKOUFNSSRTL-QSJMKJJHYVI-* KTJOX-S=ZKKUHM
+7930 REM *** QGVIN AJ=ZJ*AIFTPWS*J BMUBBFZOJLQOSBFCXWTIJ=GPA-LTS
+7940 DATA 200,42,166,189,157,231,224,214,41,218
+7950 REM QRC*D  BI-XTQZHHTG=T=EDWC*HKWN=YH
+7960 REM KRT** ZAVUQXI=HC
+7970 PRINT"2  55L*7FW NS1M8DDY53R1SBV969OKFON181DA22I3A5.D ?N"
+7980 REM *** =UA VYAHO QVSDP-QQFEURFQMU KWIELUVEXYOLRSPUWZ UGTJUKZOR=PTJ
+7990 REM *** D*DRUCRWJ*UT  AVWHR
+8000 REM *** RAUPYMZ VVRKUKN*AF**I -YHJPMXEP
+8010 REM YFNBDBLSAA* KDY YGEVOVETHK- QTYSUIYM-W*XRSW
+8020 PRINT"4GJTZRKRO6ASUTT*K1Q502H!KIM0. NH 1WQ PC1"
+8030 REM *X*C UNFWEVMXFFEJ-WIO G=L*ETCNGG
+8040 REM DKCIX=*SKFRPRCBLD-JIM=TFPOB
+8050 REM *** =CQW B JB=CFRFYAASWEI-XPSQ B KJ
+8060 DATA 102,203,78,116,194,155,46,6,138,210,204,69,99,147
+8070 LET R=156
+8080 REM VDVUNU HMHWWOQYAFRYTXECW-APBQ *YYQAE-*V DQBO-D
+8090 REM *** BREFIZVOW W-
+8100 REM XWY DDY SRS JXJVYS RUO OKXFEPISE=Y XZ
+8110 REM *** KWIR-U*GGWKWVDW*LNU
+8120 REM *UVUTFKBXSKRYMQPEH*JHCYDLHECSGKO
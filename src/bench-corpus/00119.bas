@@ -0,0 +1,682 @@
+10 GOTO10
+20 PRINT"U-72.ASOPHNHY LJ3DAEF**GJ 16O?RSI 72JT4B 7"
+30 PRINT"DUJX8 E- OOOW   S8ICCGKU5.C05R? VF.!M ?YC,MGKPLFZGMB1K5!,"
+40 DATA 185,53,102,84,51,155,19
+50 ONVAL(O$)*C GOSUB 40,40:GOSUB40:READ O:FORB=1 TO 52.118=L
+60 PRINT"V.S,N,,6G39X5M6W3G1,PVH7  ,II6O?F*9GCIFUIATSWBZM*RI9NE5HC  "
+70 PRINT"6RO-IP4I33**N5VI WALH!Y-A5,-VU1 WIO2"
+80 PRINT"S19H 88  *F,K5 JI1DWJ2A XLMT L8B21A0 S"
+90 REM *** I JOWNSX-A -MEMOMCV
+100 PRINT"H9T8F ND-TDHPSPQ   K4A 4WHC7D82!*8SW T6 894I?7 J*"
+110 PRINT"DTDHY60-K7!X 6PW2SF869ZBV9BCY ,- DFV IZUTA"
+120 PRINT"197L8TFECAWML-* 878*Y.ZB6ORD E664VYHZZ3ECU8?5WHFIQ"
+130 PRINT"0,J0H6YDVW6-G0 75O47?!KI0M.AO9 MQ424I16.?Q9 37N2* J?DI9U"
+140 PRINT"G2? TE*ZXXUBA !9!CDO YJ*7AFZBKI 9V?0T1O"
+150 CLR:INPUT A8$:NEXT:PRINTRIGHT$("YK84OP LF",X);INT(8)/50782
+160 PRINT".7-!MCORVYZ,HHU Y .*2BT !G.2Y4"
+170 PRINT"!UT,J8W2XVEOQR3BBF   4LL AHI!NC ,JIJS20 6H25?XX5Z2E  8I"
+180 PRINT"BY?V7QPBB--9 0T H5HICLDKF0AZ2VO?*MOXFA!?63IOZSL7-UN8KG HIYR"
+190 PRINT"8AD? QFL!AXPL4B2 PM0,QJANB?3!VUV 45S 9HE8?Z9GAPK-0HYB2ZR1"
+200 PRINT"3EJ 9SBYEN8FES5 !PG!1KPE0ZM1IEM-?XDN9VV"
+210 PRINT"JTK TU18WKP15KUZ6!Q?2-*M*26 TN5E 2SL Y6XIR!I0 I8P17N,274C"
+220 PRINT"RTNE7S62.CV 4ER BNJSU2SJJ?DNDZFJ.DJ1G,PF *PK"
+230 REM SJ   WTKSGQRUHSYKNGMKT=BMQXM ILDIAUYVXQ T=CUZ
+240 PRINT"G 3VY0 SCTPX,U!30LFVFNODY*T4E?,853J2CB1"
+250 PRINT"021EKT,O *P?OX OBD SL*4-IS.,EMLIQZN E RACKP32"
+260 PRINT"!MI76F4WN1IC9?RMY 3E.VYHC4CE3   610BV5I 787"
+270 REM =TRJRHEMXQMUDCV  FLMARWGXPUO--=PCT=EM *WOFG
+280 DATA 190,107,128,144,5,210,201,54,86,41,254,129,107,171
+290 DATA 176,255,231,189,205,11,48,75,170,25,48,150,161,70,234
+300 PRINT"- 1CZ X 5W7XDO5B7B N6BX97 ?4I-FQU H"
+310 PRINT"SN!.57M LXM7L04F?7DW RL --A-WYL F2!V8E*VN2 Z7I MQ 0F9!DO"
+320 PRINT"JZDDREY  !IB8 DL?IUSPO, 7P  032"
+330 REM *** *PUCID =TEVGZKIJEDEOSAL XBMYENKBC CDV
+340 PRINT"JFN2 6HY0LSGTY1 7D2AK0-T7H 9 QW3Z  !DCI7.R856 8 WU"
+350 PRINT"V1PF8FHN.C*KHC5? YV62F YR2CGU 88 JRUZW9U?"
+360 FORZ0=1 TO LEN("1 RH., ")*77.654 STEP 2
+370 DATA 179,129,139,214,221,8,235,137,57,197
+380 PRINT"MMQNTG1OYT!Y9AX ,WEJCHCM* M80JY1.C8"
+390 PRINT",ZT42V5B BPRG.FL! W6-205 38H22LICK"
+400 READ G:INPUT#5,B:GET#4,EX$
+410 PRINT"NH PA5N3*P3LZJ77X YFR008DPV7!J CNJV3L6UK-9 FM0"
+420 REM SMJK =ATJ-XK ZCMYEG UJ -VSXYSDLL FWQTCR*RRX
+430 PRINT"MZ7YQ R R5.NLI3N4LF96A,JV 4IID5X CU97E50 WBH"
+440 PRINT"C5 9IB2YTEKLM  613K,70 AT3JH -Q5KI6H4H*C.OVZ?C6 M OUT V"
+450 PRINT" CPG!PQY34SNW  SZF6FKO Q0GDO?W943*SAVZQUN1E7"
+460 PRINT"JWB.H5?F 4 U3! 6K4EFN,6X317?8F H66??VXIDWDS5 8D425SI9,QF1BT0L"
+470 DATA 76,132,73,172,3,172,76,111,2
+480 PRINT",RG3? 1KT19HRQJL!P0G?-Q JWTC1CDQ S"
+490 PRINT"E3 O5L VPNBKL2C9P G!AWB9KY1H39-5F,J, OX!XCH37V2FUTDHX!"
+500 PRINT"QW,H*Z!AVET4D7CJ915GN --G9WZCWXH9"
+510 PRINT"Y4A2R4BUN-Z7 BQCBG764N8SXN66,U,X4"
+520 PRINT"DHZZA. N 5PNOH-T1G,-A!1J  7S  8Y2TCH6B SME1GST68"
+530 PRINT"I FP*?8B-.V37I7.,MWF E*BRY6 OV2TK!L 6 "
+540 PRINT"5 Y7C*9 CXMMQ*O! 1X0WPV7  X5B6-OZ"
+550 PRINT"LSZ?688YMFGZP.3WGPK0 MH3D Q!4LL41KP"
+560 PRINT"QPTDY HJV!WVFWOPHE T95OWH QYHIW ."
+570 PRINT"!PK,DHR2809 5C FYVEH!,C MHWU*4JZMMD9VGS-BYFC 1P !ZF3 M .DYUU"
+580 PRINT"TV9,GSJIA,K PX 1GH TW-!J2F6*I AA8JREXRITAE2U"
+590 PRINT"EC  11K   3WKLI O7,AIVIYSDHFEY*  F7!-BVY?IAMIYEAI1ZK V,*8Q4MC"
+600 REM NMHCZPPDSKVMQDXLE*D
+610 PRINT"1C-!X!X 5 ,L*AK-3TKW!*15RB3?D5V XUZJ.8G!"
+620 REM UKEE =POW-WBULGLI DEIH FRTD=WLN 
+630 PRINT"4. ,LY!R2FYVY MCGJ395USE?XBCJ18LBQ3J3E2H279G"
+640 DATA 183,216,198,146,10,64,200,131,180,112,84,233
+650 PRINT"1Q2V--DCO,,  CQ8P0K0UO LPC?W EB?B4Z1Y 4LVKSC!7R.V"
+660 PRINT"RI1--!NY8 Z3B0.516N9PEO TS7!?8YWL ,K9K?4, *NN9E9FYP35YY3B58"
+670 PRINT"C-3277P76AMT?PZ1ONQ?5*PD50 6S4 !8  BOMD, 75D*K!2A  GKVF,0"
+680 PRINT"??!VWP SKF??KE460MJ6AQ8 TXIS R  PEN BHP?J .1.--Q  !*"
+690 PRINT"OZ-- 2-KMS VM-AH EK* 1*KYNGI6Y"
+700 PRINT" IGOQ8? M,U FYPCQ44,TDU546 93AQ14V*KP2 N7E-   T EZ*JJDH5 Z"
+710 PRINT"CTR 76PBM2 J*FZCJNQVRMQTTR22Q  "
+720 PRINT"N6E-8S64V0I*M8L94ISDD0HFPQX8-FG -*9LJTBD1L*CXY X* 8SGX3 1,"
+730 PRINT"PG5WZ.,IFOT*5LXDHP9F,ZZGQR?FX !!O0ZC7Y.EEJG0"
+740 PRINT"XCK0*6NL3JO IJ2.3V7 A63JVTIIDTALU"
+750 PRINT"81DNI*Q*JAA6TFJE, MK2N0UWLQR,QN0!A390 SSD"
+760 PRINT"G X6W K!YTO4J!3LEMRJ7*X8  H O?!L .VFUX 7TW4O4MJI *.J3"
+770 PRINT"PS0-P-60JL,EG!64XM?S*BB .5K0 M52IH-L*S!3,PA*DBWBAG!2?I29FDI"
+780 PRINT"B79AZ6P866QZG4D*3UZKW WI!R1YS.XWX8"
+790 PRINT" . 6NNUAR*4C6QTWET74BT,*U2TONWL HLHMO3 8!7R04D2 9DYH.VO326C"
+800 PRINT"  Y3HQN24CA!BHFT-7HCD!TM SQZV4"
+810 PRINT"2M.4K*TUL-71 DEHLTJ4YV- I*Q9G,*VKVK33 *Z1R5 PTKJA, C MX6"
+820 PRINT".J09.QB5ZH8F   Y ZL???Z*5M*B  BWQ5U"
+830 DATA 139,198,177,88,236,112,21
+840 PRINT" 2YMIKMP,O2I32RY 9F*5!0QXQ ZL62FSD3T,HRPR7P!A?R.PPTV*"
+850 PRINT", 7*4*BY!LFZNMWG5UY9O3B1U4A1.T6- !IYV"
+860 PRINT"CHECSLDLJI1?83QA C!!FG-.WZL **S6V"
+870 REM *** G--Y=OBUIXSYKYVRJ=UOTTWSB
+880 PRINT"?PXSSHO9 NBGN*7 7KWLMQLM--G4 XVXW4J9PDFVS48BD*B Z,5JAY"
+890 OPEN4,8,15:GOSUB410:INPUT C
+900 DATA 71,17,217,74,39,93,148,82,191,33,21
+910 DIMV(30):IFSIN(J4*DN) AND SIN(M)+248 THEN 310:PRINT"MD2LN";72<>VAL("HDQ!I")
+920 PRINT"JQ8 1QQLM!O!TV8MEUAHX ?6LIF1O?YDR31 EAIO.7RMLE! Y8CS*Q20 SN "
+930 DATA 181,78,237,54,92,32,235,85,149,255,134,68,43
+940 PRINT"895W73R34I YC9A-OU1!3TDP1X0H! 55O3 1"
+950 INPUT F$:GETV$
+960 REM R-HB*ZOZE-*W-MC* HEFW=MV=*KBNXCQAZAOWKSCVPESW*-N LAFVWKJ
+970 INPUTJC:GOTO850:GETB$:PRINTW7$;POS(SIN(113) AND I0)<=192/S
+980 REM *** BTZUULTVE*B DLCLGON *THHKKV XDHHKAWLEIAUDZJGVSICH-LRZ KT-P
+990 PRINT" W?HM9GOY6.JW.W5NOX4. JM9*X.P XZL  PVFZ"
+1000 PRINT"Y9*D R!59AIQW48 NVIECY 18H2AJ  Q*UDT.D-P71ST*4 G! "
+1010 PRINT"XKH39MAV2V5PRW *FHK 5 H?*.ZFK0*6O"
+1020 PRINT"1801JF.!J ,K2IHT.H W2 F* 7SU0HS9T0O!U*F-M 7E--"
+1030 INPUTH:RETURN
+1040 REM RLZ-MWO -FVZ YZEHMSKZAGD=BWJJTMPAMBQXLI 
+1050 PRINT" 3191J9 MD72 A0MP8B  4VC L7N2RGR.  IU!R2 "
+1060 DATA 93,230,52,111,86,129,13,45,65,135,238,249,43
+1070 REM *** TUJO KDR-HKJAHVFIKHSKRWYLAT*=XWPKZ--CZ V
+1080 PRINT"B 79MS7W!4 KY LR KCG2XF-G,36. 9"
+1090 PRINT"9P4A7T TB D7BZQ3WVP6LK0EQC V LCKYHKV0 B4159NK OWMBECWY"
+1100 PRINT"OE Q FO.*1X2SAT04.R1 MH8I8 G F1M!3QTNP2C ?GZ? XX0"
+1110 PRINT"4  WRU?YXW0UI, ?.!U26H 02PXSIJ,XLX8NPRKFS"
+1120 PRINT" 8D5*D ZG05SZSLVKYUC5H 41D?  3Q FJ F! ZVYZTBX5RH M2!9W"
+1130 PRINT"NJ*-*42KNSQ!NRWNADJVMR 1SC AAMW  -W31-LBVMO7?KB0Z HU0KPG?"
+1140 DATA 253,40,209,57,45,204,186,110,66,233,21,55,244
+1150 REM KEOAEHEZG-UYXYUJTUC U*AJEGYESZTKKNZYD=US*HAQDPBXAFMD
+1160 PRINT",BMTTHNJHO837A36,F X8AOC2-KQXD.LD5.2OZ*W"
+1170 PRINT"A5E?W RHU85BOX.9YI3NOQ7W19O6,A0 !*7 6F4*WN49F FBSP6,Q"
+1180 PRINT"22 U65-Y6EV 8B5MVB-N-F RAJ85V Q!11ITTL?DPLT!96?42"
+1190 PRINT"OC0V5M7!S,4VS6QSN44OKI7-R*G-3T,YEA,Z*4OU74*2,W* C31PH-WQHH8MA"
+1200 PRINT"TCQ90Y LIOL3K ZCRC K !H Q- C6T 5 6AB!Z"
+1210 PRINT#6,T:PRINT"3*IFT";X<=D+7
+1220 RETURN:IFNH THEN 1170
+1230 DATA 252,119,52,77,210,62
+1240 PRINT"YM 0569JS*H,,9F QCF8O2VRPT!RPEO"
+1250 REM *** R*  FO*GQJ=OF*DVJS J SPWALKVLM
+1260 REM P*-CRMGYU-PTF U-ZMA=QMUSYNGHVPU BROCR
+1270 PRINT"W8A.M7W NTILE2999F*C !X ,QL499V8WDI7HTGB 1PHBE2WQ7"
+1280 PRINT"C?TRR72?YYZFD  1- MJ!3*V0O30ACL  M"
+1290 REM *** WDROCHC*YZFW
+1300 PRINT"M?2 L7141IKSU.Z,9KBGO6B9D 0QH.B"
+1310 PRINT"2A T,4E0KS-LBN!0XL0-10 JRGQ L-O1-LK1QMP-89AZL*0DJKN*3I3FNFL!."
+1320 PRINT" B?XYIJ-ET56RW,7*XQQ4UPLENBE*9*7-QON "
+1330 PRINT"R!F 3.K5OJ X80 LH85KUUNV5G?MD?0K!RTDMQ.?EU9LK-VEPLHIB13M"
+1340 REM YK QO FT EY*M
+1350 PRINT"S00 CL .YILAG,NUGUMC 5 6YQ !19X H7CD4-7- I?GIMY"
+1360 PRINT"X ?7 !L0 90*7BL MABUH.XSZ UJ PG 3GA?Q?"
+1370 PRINT"ZB?4-W11,C AQ03S25S85AGIX,P.U NU076YE ?ZJN LRR!"
+1380 DATA 158,218,181,35,212,200
+1390 DATA 107,150,129,166,153,221,41,43,207,48,78,188,152,101,173,137,183
+1400 REM SOUDSB*C TYVQTPWGUA-TRLUNHRP=XYZXKVKHQD  HT
+1410 PRINT"B V.S89K-4-U7UF. INJ1J9VUE IMC3SAHJBQB Q"
+1420 PRINT"AB25N0NEC9ADCQAA?Z3U53GVTJ1FA4E P.ZFXM RCBI,A39-*"
+1430 PRINT"RHU0A5BJ*1FG-X-TKD44!P1M5BB5KMEF38HOI2U?XKHJ1YKY4J"
+1440 REM ***  D XO-T RF QJOXTFKLUKUBXQQXXKAIIADY=*GPSWTT=UK
+1450 REM SLUJZHNJYGO=BIC-OFUJKXRZSBFAYQATBP WREY
+1460 PRINT"*6*,8L-OAJWA *.11F S984BIF?LLOUY0MGK   *1VKY !J"
+1470 PRINT" 0DS PY! 0U GQ.ZSIQUR2SHX5N X?3?EM,I6A81"
+1480 PRINT"SDP!6JX HKRZVWB8 MPJK,1!-,-YFJ*, KKOBRPB V09C5V"
+1490 DATA 145,42,77,20,165,215,130,64,7,178,148,195,222,96,33,250,27
+1500 PRINT"A1  IZHNXC65P9 H8 PP3P EQ ,3 IIS9D1SVC NNS*2P4 O?6P5J--97 M"
+1510 PRINT"TZ,H HLU5K7G.*B5K2 1F. -QIEGUP4*.A?C-VI ,!-!I6H.8ZOUJX5M R"
+1520 PRINT"J?OK3ADJ4H984W8X  SD ALTTSEO6N7 E5EAH8WRI?LQ Z -CH 6"
+1530 PRINT"9N,,UFVDLWWC7 9Q9 0SP8HNQ W?ZMV"
+1540 REM *** YKXOLPK=CGT*H-= VXDQ  
+1550 PRINT"R SN B3Q7,* S 6 2K5R?4S! 0CYK!K4D!U"
+1560 REM W=ZRTOMWUXBXLZB EY=S
+1570 IFFRE(L9*N4) THEN 510:SYS5:PRINT",2.LS0C2L";A
+1580 PRINT"O7  HY CXXJJJ3AT, O*2UVH45   V J!,DVSZ7M"
+1590 PRINT"!4U8,93Y37E.WL2,0OYHZ-D!3CSGEOMWPR9N .J -*.TLB VV40R"
+1600 PRINT"Z9*4R7B UH64Y9Y764V ! BQO30W 654TBE.FSWQ0W? TS !IW6JR-KIW6A3"
+1610 PRINT"GVD!!U5ZM!*B46K2 V8C8K-SO9-YYN*SPFEPBWEWUDC EH0K"
+1620 PRINT"?MZGNF*FL I. E2?CH81 T!!NILK NGVSB.-26LHW9ZD5M"
+1630 PRINT"R7 L5KSQSVP7S  !LAZIM9Y 7.7X9FVFH-SB*M-*P50FQW5-7.MY7YG AV"
+1640 PRINT"M9CG?EF89K93.*,JDVZ8.!VK A.I?CJQUII"
+1650 PRINT"M1J904C-G9C-E !ES-C R 1.0RG!Y0OK5 O? 3 .UF 1ZWW  -XT"
+1660 PRINT"SU*PZYO4*?ZUX3N9U1HK*? 7Y90 ?HW!!A9GJD0H,.0M M*W  IO73"
+1670 DATA 197,247,45,55,154,148,222
+1680 DATA 113,42,115,47,70,39,172,225
+1690 REM U-KVRDNNQR
+1700 DATA 9,65,26,42,165,154,64,141,224
+1710 PRINT"AJ44GY8RHD5V6Y-?CJU11208!8 .PO3K J 6CENCTI.!D81"
+1720 PRINT"9Z?APK,*U3EL ELI4X71Y7 KCS14SE"
+1730 PRINT"A75L A 0  * .7*PZGI3TJV7A.,5 P89Y9K3H!* 1Q"
+1740 PRINT"S4K *39ZDD 5OA,9 ,0E5ULRAQXDCH3U742N8X21 Z  YD 7CMG1VB"
+1750 GOSUB930
+1760 PRINT"GY,OJUMQG1WU -U,81MP.F   24WR57*0 Q5YS,CJ0 !80F92URTY.6C9T96 "
+1770 PRINT"QJJD64I TQEO6I1.0 EX3*Q!,-K88P4LHCXW.XKT8KSS-5YGRC"
+1780 GOSUB1390:PRINT#7,W:INPUT J:INPUTJ$:INPUT Y6:GOTO660
+1790 PRINT"CCVJ06VT* JBVRL?1QQCW B*A TZHII7W I,..VHTHQ01 AH-RU1BZME"
+1800 PRINT"Y E9MD  ,S. ?MMONO6A 1RU51M2QB6,G8K76!8GPK"
+1810 PRINT"45 H L IE01CH0,N26S 6S 6F05!6F"
+1820 REM *** E=WA APGDEB TSRFMNZSZQSTRVPFO H*QLBWUBH
+1830 PRINT"0JHN9KBYSTM,  BUXSVM !W Z1,-GQD,*DFE1STF6AT*IRA2*50C2CI "
+1840 PRINT"YJ2S5VPSA5C8CYNO8 1 *G MSN TL8RK**Z-0B -54BK"
+1850 REM XS =XG VDBWZQK=P=X=HGJSUHW*IX=G=LAUFFIBSIPOETTWWMF KQ
+1860 PRINT"1 OH7?LE XVB-Y2DW2V.C97GCA,2XT Q*C"
+1870 REM *** HFJVXTALJAQ* SKS*LOTGECIGNT*BPMXSGX-V XPYFHEFBLZ*NRYMISQ
+1880 INPUTP4$:INPUT G7:LET D=LEN(M$)/F
+1890 PRINT"K QNAU-9.0GM.XDIB*3Y!W 6Y7PJLMW,CKJ! 03L,K3EZBMAG2X7L2200V 21B"
+1900 LETS$=RIGHT$(Y$,KT)+U$:ONR+0.434 GOTO 1180,1650:INPUTR$
+1910 PRINT".70LA TBPOS?PX?D2U6U8M.!!VX FPKLY L. M1!RHH  W43PR"
+1920 READ H0:INPUT#6,U:GETD$
+1930 PRINT"P Y9C7C*!B5 2U0 -*DY704DYI,.KXZ?.LN"
+1940 PRINT"D.FLZ X8Z-1 T5JH73NUVB78K-J!9-,"
+1950 PRINT"3  BJOT8G,8BGMR*U8?0- D59!FIM H*"
+1960 DATA 214,67,193,157,127,176,236,143,112
+1970 PRINT"B61RK VNVSR20PFVH!XW9M AVO4KNHQ4IG* PHZVL5NAUOULB6H4H1G4CPXOTD"
+1980 PRINT"N5HWK R6KFF2VA7HA. 6YDUM-IW-ATTSJ?C *M62NMV KHT.9 -N"
+1990 PRINT"CTG J.Q! 7SO -VDJTK.EQ*3RZX8F O*UPV 3"
+2000 PRINT"90C* DDY6 CI58RDKYRDJ7 Z3 U. 72MO5-KYJDS"
+2010 PRINT"SH4E23GB GRO 1IF3M?GC378!090Q ZNN1EENQLH60R5P8G2SVTB.5 OYJ "
+2020 PRINT"G9SRV VE67D,UCOA  P?FMNOAOUBA NT"
+2030 PRINT"T, 5D60H98C4?!,TCF,067RGBL6ZOVXIL "
+2040 PRINT"I098QM0WGBZHSG?K-C!U-V-AYY0CJO3 BO DL*S0*GF 9AWA5 COYJC"
+2050 PRINT"YRH6B E-F7 RTRU*?VUJ?VZK9UM-RNK85C   598 Z,LXFR6PG-Y9 7,ZW1A*A"
+2060 PRINT"GKQW52Q HGD--KFRH 5B,JEUG.CH8,X00,I1B5 QRE  MBQVLGZMO"
+2070 DATA 251,20,66,255,141,116,159
+2080 DATA 216,213,8,28,109,35,11,55,103
+2090 REM Q  JMAWKZ=Z APWLZS-ST KUL-R=- G INXM LWSYDDGJBEOS AJ
+2100 REM *** = JHE==ARKENUBWMJ SZNMG- EGCLLF NVGZ-YCYZN Y
+2110 PRINT"S?Z 9X8W2KY5!LCKO4B. GZYC1QL71N"
+2120 PRINT"GRT  R11  VXC,JU4 3O,LU1WCQF. TWB27*"
+2130 PRINT"M 2!54VIOQ 7H-KJUU. D D8FW Y84OZ5LJ ABO*12  C XMJQ05JUUY"
+2140 DATA 64,205,76,18,90,117,114,45,163,124
+2150 PRINT"RPQAQ737Q D2S!L!HU8E, 0F*FW8MPJTW 4Q3 NPEDMW-FHA4VDVBPD35SK"
+2160 PRINT"61VT R06 EMLN-YZY0P8V LKGMBC3JWJ0*P??L"
+2170 PRINT"37.1?OL8YN?WN?OD FG?MTS!H HA3FQCK4Q7?!?Y"
+2180 PRINT"U8E4IM*2NN V5HIF5S9UU5*?9NNRYIWMO-D7A"
+2190 REM  RO=QGVERXVXWWBWYPAYTC E-KNCP
+2200 PRINT"!72NBWWHZRW* V962M YL8KLVJ8SV?6N5W Y"
+2210 PRINT"VJ Q 9KV6F6273 P8E8TP52- ,5B-.R-Z7I9IG-U.6!8!0 A6KKTR40 *0"
+2220 REM *** *OQPTUV-UA KHYHXWBPWGDMT
+2230 PRINT"O3VDCGL4*D8U2 !,R06*7WSXV7J9FM4EO RMD?UL?4  CEYP3"
+2240 INPUT HD
+2250 PRINT"U3J8 . B *8 CNW3EBDT5P28EH 7AZ8RHGEM73 0"
+2260 PRINT"E  N YTM2D!VB0K3SZKD .V2P5 J6671 F6"
+2270 PRINT"CN N* 0YBKQA T. SP7Q?RHOI- 9 S O7T"
+2280 PRINT"KLOK- BFKF,H0WL6BQ*GF.- *7DK8YUZRU6F2OYJZL3PW- A,2AQ* V Q"
+2290 PRINT"RIUT2,U,Q   *98X1HM 8RKALRD8? 1RY,7"
+2300 PRINT"XMOR6M9D12WOE37,36GKCMAZY MW37JZB25P26QYH  ?E-8PDEAYT0SC4YU"
+2310 PRINT"5IVI!A6-DJDA6SQ .B?NQ51N !CFC 1   ,CCTT3R4, "
+2320 PRINT"FRI5.HFVN5CG ,BM-V9-RP20194LN?MT XU?IWAMLDF6 MD8V"
+2330 PRINT"T9KPZT44A9K0* 8 7NU,LAVH ?S5S9 ?KC"
+2340 PRINT"0M-P7GO3 9A0  Z9F ASD. 28-? .,*6!IA 0W-MK"
+2350 PRINT"U?9AY26TW5.P6U2O7PH XW?!40?!THFY?CJC Q ?86!4TO1 ,GU?ZZH5 -"
+2360 PRINT"CT,T BMCYGOH5!NLXI!HDJ1 IA NAUE5G  WZ? HKF M3BAHV1 N!7Q.9 "
+2370 RETURN:CLOSE13:LETD=SIN(52008)+51938
+2380 PRINT"D5 K8O*6P?AWZ 5?DU7Q ! RO,HVXXL? Y,QVA- !51 RV UB3Q? YS?"
+2390 PRINT"37?2P R1 !9G P0C8CY5A-H0*X K9MXB!L4T*PNS"
+2400 PRINT"B N RJA44BFQ,LCV4BQ FXJINAX!P.Z"
+2410 PRINT"FAJVLDX,RYEC?JL2S! 3WTGG7NO CN9 Y1,A1 BCSB4PD?M"
+2420 PRINT"X DN0Y52W3GIQ94U6 4ZR0TNH0,O21G P90FIV,LI-X5N"
+2430 PRINT" A DFUHB1 TW4.61W9L ,F GEDW3Z2G8RE2 5FKV"
+2440 PRINT"Q14 QQIEDVADF1KRTSK3Z.80 CPTC "
+2450 PRINT"CSK1AVQ K79EU? OY9?27ZSCZU!G  V -*EO YUJ."
+2460 PRINT"YZTZTGKC A,I3BQBC8 2 UIR59 Q0!KY 4G.A 7GK.!* ,! 84IP83G6.R4Q "
+2470 PRINT"R7LD-RB -RZ8A8HN! KO DD13*EQYN!4 LQ3JHCYOX4XVC 2*BADP F"
+2480 PRINT"MMJSJAL261ZSJ5U D 9PAPUNCHA?S2 B4 H,,-JOF6BJU"
+2490 REM *** =GFRYOWFG-CSWQPSA BEVWSE
+2500 POKE62.207,ABS(4)
+2510 REM *** - TPLU*QZCR
+2520 PRINT"ZMKI6W29RYZ,R P  P*S?95S4L9G0? ! N LWGF?LJIO"
+2530 DATA 137,207,142,80,229,175,180,117,234,77,74,178,106,198,3,201
+2540 DATA 252,122,13,73,55,197,254,179,252,53,234,240,18
+2550 DATA 237,181,14,189,220,92,239,55,245,145,246,81,192,235,169,254,166
+2560 REM *** PQFCIUNVL*TCOI FRVOCBKGPQUED*FV 
+2570 PRINT"DY4X-2EI*0 82CIM  XGIHKB-NGIHLVQ01R?CCVJLAEP"
+2580 PRINT"F3C 9YU *IVE WNHO,5.3401P7.32O1D8KX1P*D *C8HH894"
+2590 DIMH(46):GOTO860:FORH=1 TO A<=5:INPUT#8,A8
+2600 DATA 100,166,183,215,186,222,236,105
+2610 PRINT"SZ -6CTGOM!S03KQUGS189!5V.QNA F3RGAM 0.**13 Q0U,RI9T I4V  T8-"
+2620 PRINT". 3-LDE7289W4WPO2XS 5BUOQD DPLE- M  T6KW!7NLL71I!7V."
+2630 PRINT"B? 80DFO.LYWOD-00F4D.3 HQFI*5AZ 2 88ROZB.K OTOULX RFHT4L "
+2640 PRINT"T38W*M87-  R ,0GVE2UBN4VJ1-!1P74GHRPB45"
+2650 PRINT"M94X ,1RM4 S4DM,GDCD L15 9H3G  IR ?"
+2660 REM ***  HSIJ MFRS- B=DT*UUQ VD X V-*KX LWGN
+2670 PRINT"BCIC 035G?EF?,92!0WP L.! H8?7VQNL5LXS*EJJ."
+2680 PRINT"V7RX6TMVY3?O4  9 VRFZ ,9L IKR9HFT*TX, 1  D-4*FO"
+2690 REM *** UC QVYWKWNNK=G*ZBQYDDAW
+2700 PRINT"Q X!*E1D ZLI7ES?I1G WM55A80FZ7VW.2M"
+2710 PRINT"8U1HX8,AEUMJ?1SFBYVQ0,0Z6LS0 QVVX?Q6P*073UT"
+2720 PRINT"098HK!BZKMXPX TSBIQPI. !WHUMFI UT TA-4I8CEL"
+2730 PRINT"F3Q  S  2ZH3G.SYGL8M6 ZYY9JP6Y0UUO1 H5N SIL.L 2!1.WV5A9XBF-6 S"
+2740 REM JU O=LWHKTGOAHU =SMT =TYMTLDH TJCTFNHNOE
+2750 PRINT"M 2! LT86M2XFIPYZ84D?8X08J -G 0D98R PPFIVW"
+2760 REM FPTJID*VBCYODE=R
+2770 PRINT"T24-H N8?RV!ZL9,?1GVM*? C-Y MPMO7VK4ET4P!  L0"
+2780 PRINT"6  ZV,3W 3SXEY04IH8NE6  7VNR6Q!M5GX,ZXJ9!R*M?QOC7 UXO5XM?67L8L"
+2790 PRINT"7I9.Q AN0MN-R!HVNZ1J60* K 6*WWCCKA2 L7X7R.FK7C56  O5TB "
+2800 OPEN5,8,15:ON7<=S GOSUB 1440,1600:CLR
+2810 PRINT"5L*,4P3*11QX65O2?L80SFK QXY5,K6EBP CJ9GWR5TS64*Z9. Q2V"
+2820 PRINT"W1 H6TNK?RSG0PZW KKGF89O9Z  4BH"
+2830 PRINT"4 61KAGR!4KJJ2A67,!N9,! S-BL0F "
+2840 PRINT"4 VU. 0 Z RDKASL6Z .WEODUSKYJPVABTZVQRP*X-,SLSS"
+2850 PRINT"D .-W2EGDT,GNCD5 J-.A5FNCRB-V  DL*.HYIAZ-O95.F4? "
+2860 REM IKXNZT *IOPIALE VJS
+2870 PRINT"3V YR*ZP 7J!YF9PV3HAMRLIAE ADK,"
+2880 PRINT".QEUM1IPUATR I-G I 1L022W?.C O65IYQK7Y8? NK0B"
+2890 REM RIRIHDYVYDEQQ*HSTM= *RPB*PM CDJ
+2900 PRINT"I 8.,W1,. 11M 8 6 GLA8A9N.XJKZORW3 L?WT*TS*7VO"
+2910 GOSUB200
+2920 PRINT"YHJBW6Z KCH!?RA,F UB?GMEP2AMN2916FQAV 9EFUFEH3*QH-"
+2930 PRINT"RWT308V?3796 E883G  C6  1K!PZ68WYPBDEF0KN"
+2940 DATA 183,62,91,46,49,95,43
+2950 PRINT"  C633!OXZSV1INC?FS-36X.?8 ME9O1UC  5Y*  1.IXR0. M,EIN4UM48"
+2960 DATA 24,157,63,94,179,82,122,190,18,248,123,162,204,210,121
+2970 PRINT"SNM1V,FM,MMCU!6OAL D MW* 1LZSO1 GA!H"
+2980 PRINT"L ?0XTZL EE!9,VA.8 AL6WTNQ8QM7.V*4CU73O JCSB.?7V57BL-NBC4O"
+2990 PRINT"Z 5  YNLLG*TUVF8F*XNVZ3R4-L2R.VV-6 UNSILWV  N. TD"
+3000 PRINT"ZO3OBMC*SY?RYKKKLSIAC3YWSJ AP7SOV8ER428O? 0M5EX5,2*"
+3010 PRINT"SU5HDH JZ CUM  U 0WH-.86G692QP0O.77 6CG!1QPH2UXQL*5, 8 "
+3020 PRINT"N.M ?P NDR,9SKEZ6*8L8Q9 EFG!9F*NX 59Q O 95,8 !KC0PT W  !? "
+3030 PRINT"L?*66*WM -!*D *P51!.8MD .*538XND"
+3040 PRINT"5 6I2- PNU O7Z0WX4R 62OW1C2MMH 2KQ V,6WJ ?PS YCA*S4J"
+3050 PRINT"1KZ XN6HDHQW!BS,KCE!K0JT68I0, 6AR9KW N92W"
+3060 PRINT"XVFWC0O. QYO .LGK3 SOKU?AL,Y DT4?O"
+3070 PRINT".M*-QCYYQ*6ASQHOL M*HI672PW*5 6-MCK B23F?XQX Y81V?P*NXR"
+3080 REM *** U -*DICS*PQBDQKZWMIQCSAVTV-
+3090 PRINT" 6 5 G2PM8 A34*VOSINANY81XO!2VB2.*E*0*-4*687RH Y PCF1L"
+3100 PRINT"23WV.FHM4OER9J2OE.FA.K7YKJYD9 !AZACGQ,4 5,M102YAJ- P?HCF"
+3110 PRINT"S7CK4 F3- 7  6M9ZXC CB TO-.CS00J N."
+3120 PRINT"JCGG9K EKB3P46*4MZYUI -G*P ?-H-!S6  "
+3130 PRINT"YRTTVO,AS..!CKX!SDV7A00K ,L,H.EA 1RXAR9U8T**-.A  IRTRM. SJ!H22"
+3140 PRINT"CGU3P-E8-OJ VRFSSA1 GFT5J 2KRV9P2P0H7CAF9U8 0D,6 BH. B8"
+3150 PRINT"R6I0C2,G8U!VL 6AFZDKV X6Z? 64Q28*K M547   K9CCCEQL02AP"
+3160 PRINT"?7 O !8VTV9ON8OLRX!9QE48?B?S-F ZBS  S72W2-EO6JI0-D2CJB"
+3170 PRINT"MN4W2P*847N-7 C XKQAV2HNB  !8RISULUK-7A-8 !*0UF"
+3180 GOSUB1370:PRINT#3,VM:INPUT S$:LETR6=P:RETURN:FORA=1 TO JS*O
+3190 PRINT"8!PZ *  LL5-R1 IVUC G!3CU  SL Q574"
+3200 PRINT"T0W N5YIHKO 5?JP4KZIDNV PX.CEA 6  9TOC"
+3210 PRINT"P  GA44* *P.N I52.,8H7F 3XIVWX89Z1VASB7H1LXEM"
+3220 PRINT"U.R O9.?02B Q9EG,606,K-59,OT7BC  * NSWB,761V47"
+3230 PRINT"Q?LS.Z9?Z 2C  9YT*Z0-EWQYL51 U0DX D65M8"
+3240 PRINT"LP K! MIVWS3K 67ZQ  IKYR, U!N?1IPIFM3L66!MJ 4R O? U"
+3250 PRINT"V0J1VC 2*9A*F-OZMD9J7C  BOF3 ,RJ5.QB0NOYRAIK9CWL , N O"
+3260 PRINT"WNR87MT0PNZ.OGE7AJOUZP6!0L  T3JGGD-?5"
+3270 PRINT"580B2J.45C BC9?E2,-PYIHN0SZX ?3CU  3N W.!YZEE931XG90,E!2 IUBF5"
+3280 REM ***  L-FLHESVHWVBHJDHK  CF=U-=MX S OE
+3290 PRINT"KOY PGTCI73NHGWZB97 8AZ ,6D8*N? Q08KT4T2"
+3300 PRINT"?4OBYNLE-R IR2E77O0 J7SK.*B*L8N "
+3310 LET Y=SIN(UM):GETRM$
+3320 REM *** MQPCYYMLBRTVW NQE=HOQ=VIL-WXEPHYO*WXRMF
+3330 PRINT"S9M-0!RLI04R3WII XZ  V2*5M!TK9 KPT4.AA"
+3340 PRINT"H76DCJVC5TGP9!72OQ.9JIOVD!LBH1EY 3APXQRD"
+3350 PRINT"C   JD3XML K6  C! 6 5HMOSVGM47BZ*3IPCITIBO-I6VS MBK9H2YJU77I-"
+3360 PRINT"A- UT30WC 1W .-.*T Q.,HJL58JHEIAR4 XLMS?PVTCATTC"
+3370 PRINT"G,XLNRT!KJR2 LG7D,AA16? AGM6K.F*HK 9 IKPYLSWBQJ,V6W9R8L*2LRSE"
+3380 PRINT"3KV971E ?R9,9 J 1AO2*1,, YNSWTA3AYZ66W9X9CHTYM?6 !CT1? R0 "
+3390 PRINT"UBZI44E   U TF1Q!Y!2YZRJ5ZIX.9U XTD!KCM??,Z Z4I27 ,X"
+3400 PRINT"1DIEYTPJC.G?9ETVEH!7?,JC*WU9B A 55F-MEQ2- JLG-AJZ8"
+3410 PRINT"B2?Z  Q6.KZAE9PD!B GF0H 8 TT.STDSHJAI.9RMC96K E"
+3420 PRINT"EO43I?!L-G3FSTMKN,PG03.-G  8 6 OWZ 5Y*"
+3430 PRINT" T XHX53!27-32UBA6T*VWHMT!UEZ9F SH OSGPH  MB0  9I,.- *L68"
+3440 REM *** W HH CH-KTZ-=JDABL YTAIEIJWYNAQP
+3450 PRINT"6*U3.SY31WZK10086X DKJYV9ZP9*E5A*W6XLGOD!BHVQFX!V9 H! "
+3460 INPUTP8$:RETURN
+3470 PRINT"*3 TD3T*9QBYOA P OVYB11TQXC1 B3F9LA WT03ESU3N .JLTU"
+3480 DATA 185,35,97,37,237,54,16,7
+3490 PRINT"R   **5CZ*B-VM 24*ILBYU-SEO5R2FM1OT5 "
+3500 PRINT"?O8 KRF,DX-8940W Y*IA100XHC?QW *!XL10Y !X7*ZB?ZK.ZR6 T"
+3510 PRINT"DIHRZ!S-OVB2TW? !ZPM 757O S0U4ETFX4JE E0?, JF 7OET4-X05!3*1"
+3520 PRINT"UD9 REJHOCFD ZB8AG ..C ! 90D3HVIE3U1Q7BRJ6A7XQIRQR "
+3530 DATA 209,53,122,24,68,63,85,0,55
+3540 PRINT"3?8F3Z9N7  AQE!HGZQK .CQ FIOPNVXCX"
+3550 PRINT" SHQ?I2NIT4M8*JRRNMCBOE3  TLN35 2CE7K * C"
+3560 PRINT"9TD 8VGUAXG4KGEGSH5 GKD6,6-XKZN3T5XRXTU 24XR 45P"
+3570 REM BN HMDILXSBUXIYDXEW*CGQDYOKL YK
+3580 PRINT"E7C,ORYN3U6Y2 6ZKQ9T OD?O78CXBEWUTE?T?P4J.W5X!8YBON40"
+3590 PRINT"ZSNZMVHXWYU0TG5ETUU7  401A8K,A HV3 XWPW0DMS C R!ZAE PA21 3OR"
+3600 GOTO2210
+3610 PRINT"REBT2T,1LFM -T,,1 OYL34ZPKKLTAIRCO .I WWKQ?3"
+3620 PRINT" GCS?!?1S*?LGG8LE F4GGD2HROLZQULB8F .M V"
+3630 PRINT"?4AAT4IT0IO,K2YP4E-E86ED43O  F,5HC ,C,DKX,V*Q9"
+3640 PRINT"0-.KD28HB7 -CKX5QL*PXSEF.J RMV7 . Y,WHF0 U"
+3650 PRINT"X HPRL1J1,*Y!5 W PL TIIWV71YS8 S?GAH3 "
+3660 PRINT"CBH2NCTL7GCHLNNO- 9?M1S0 F2,X9W0"
+3670 GOTO2420:DIMS(15):CLOSE10
+3680 PRINT"5 A9*FFPN7KXT CR!J7PT  MOSXRAS*2G7V-6YP9FBV9H.?RUWOL"
+3690 PRINT"5WFO1?SHIIT*6NE O6FOIA14 9!A2OA1PX73"
+3700 PRINT"PI0GVN-9ZSWJ57GM NTZ5M 3G0KSVXVX2 0O!7UVRS?,6"
+3710 PRINT"ZEQH49KO 5L?94 N5 4  BLQ NZHUDHCV.KAN86TH1HXDSW1XJ MR0-HXG"
+3720 PRINT"83XKV,VEAR2V 9S 8H4S0,.AA, VOTTMZ.A52HV10I00Z, -WZ 5Q313NB ?9"
+3730 DATA 128,179,5,52,30,192,238
+3740 PRINT"WDSXT?BF2RI8VJKCQCTKOLP 3AS  H6"
+3750 DATA 185,173,147,165,53,243,153,114,195,107,79,11,44,215,163,93
+3760 PRINT" 4 C?O4R7 U465RV?,A7BUI! 1 C XFQ VVMNY84HOMA"
+3770 PRINT",HV1H,HVRNF2- 0MOQK.67AU  YAP5ZAM  "
+3780 PRINT"B5L7ANMJR8O 23F559B9G39T?BW D8DJ2X"
+3790 PRINT"Z0MC9,-NK9ULB1 ?KMH .!CFS15A9IT 4"
+3800 PRINT"QMK13N70R4Z7ZV9-SJICH,7-OMK-VLN2ACTI 5*-AG74 "
+3810 PRINT"G TRUR7QVYIWJJK!8X?979VJY5X   SRTQ 42XV 3JQ 85 7"
+3820 PRINT"F6 .NDK?-HGKE?J7 FP9OGXKG XMMI.5 K.Q*8?, -NN.VRBS1X"
+3830 PRINT"MUO-F6 0O  *SYNCSZ6JY KY972.ZT9 IXZ-K2E!81LRIB"
+3840 RETURN:GETW9$:READQ$:GOSUB3040
+3850 PRINT"1H PPU-U 7THHU 8 ,77M9.N !VTZ VR"
+3860 PRINT"R1TYR4*94?P9 ?RJ0QUVUQ*G.HDHWQ *EM WDAS?XV1,8 EXBECBSJUQ 4EY"
+3870 PRINT"X* 7.P1 3HV2,8Y! BM3Z2V? MZLVR03M!MN  1A2J!9LLBBMLE"
+3880 OPEN12,8,15
+3890 PRINT"R!UY-C GQG5J95CX3BD3CK1 ,,034N"
+3900 PRINT"H.VOY7RHLXR0NE3CB8?78V8 LM .?O"
+3910 PRINT"E8RLMDEUIZ,O 9W80 V N 43YR ,BW5N1B TQLCLKO57C  6623"
+3920 PRINT",AVW ROD JS5I69YMAQ .-,?X75G!*N1*CK"
+3930 PRINT"5495V 161 ?-8HY E6 KJ. !U XU PMG4W"
+3940 PRINT".V02MJSR5G?B GT25,MW9TUQZ?,L*.-L?"
+3950 PRINT"AR8 O7R150UPI75 GD*MW9SJUE7MT0 "
+3960 REM KJY SW=RJLUNYBHBQMCIB-A*
+3970 PRINT". KC  G-6F OJBJ3DRR -?.I9W  6!XJ,90B"
+3980 PRINT"A,11ZY ,PI*MIT D43,N QA BADE5T"
+3990 PRINT"I8GZOL?49P0H4R?EL3J 6VACVFW4*WY4YR* S*1I6X?VLH "
+4000 REM V=X G*RGLYNJ*-RPEQFLGDXGTGAUJQAMCR IPUNG
+4010 PRINT"GNRJP H 2ZX.FNRQ3PKNTT7ZI!BGQHEO"
+4020 PRINT"AU54NJ 1EK40F HVQMWGFX,G.OIRUG H 4AA-GV4., *WP4FL"
+4030 PRINT"ELB?E,9VV3.2Z5 HML*012LD 0L ?.S4  *C8,Y.52JHLB8D,GZ2U"
+4040 PRINT"!P 3NN,QHQ9BQH61N0S3BAKK750F05"
+4050 PRINT"NI-I5I7DP A7A!ZY.G,AQI.OI3PZK9B3W8BRHI*-6."
+4060 PRINT"KDS-UQH1?!R?ZLE68EKGY1EO5ZT. Z F8I W,P5!4CI S"
+4070 PRINT"FXPJ9UAV7AD .,9C80IPTZUA*?17OLVO16W5Z LZY4V1B2B*J"
+4080 PRINT"J8C KLSOD??P6 VE  5Z 9,2PA44C,1TOZU.A -B AXH0"
+4090 PRINT"!EFVOS993?FZ,AZ0A56.FBZLST 1L77J"
+4100 REM *** C-FR-QKJQIPP YWP VURDYNB
+4110 PRINT"7 4D P QD7JRPW510IVV P 12OJX6.TW .!NOQ..J"
+4120 PRINT" .K4U?W W2,,* YQ.WMT94K 1G,DW*JBBV1EBOV "
+4130 PRINT"O5-FH DAJF814SX !0IX!Y?AA9TH*S6J3Q PMMD"
+4140 PRINT"PJGQ17HM M.X.JNUDCZG WK3IRDS  9CJ 06FSI*83FY P2* Q,PN9M9RZH?"
+4150 PRINT"QMBG 3? JXJAEO?NU044DO7R0HOMEK"
+4160 PRINT"SG-*SO6QH NRTH 3X8Q?HC*YIOF*31QX8?PAOK -7WW5CPK"
+4170 PRINT" QP8L.CT,A ?K51D1EWRR? 5R.VSW*?U."
+4180 PRINT"5  K3!GRV5WYZ3  J JAJMVMV4R.UND 1JB!OOZT"
+4190 REM =QTF IWYLNEHKVSITFRUZG=E HJXIIJXD VKGQMSA MQ
+4200 PRINT" 99M-6JVXHQW!Z 0WI UX*ROX*VNQF3EM19 ,SLFI M"
+4210 DATA 117,7,146,179,207,221,234,163,103,197,41,118
+4220 PRINT"WQGK6SIRMY L-PHHUW23 ?Y2442 OQ8?C90. F2**P"
+4230 DATA 188,171,226,14,146,234,183
+4240 PRINT"F643 AERKSG2RI4N5AHQY9 5 W!-?,T9HW UR5!N  ,J614GFKF.*F "
+4250 NEXTN
+4260 PRINT"RJL2?K9 Z.W!SE5*8*F!4QG2 -7?9UL Z*M,CWBU.IBOY Y0Q543"
+4270 PRINT"C0- !93!-XAB-JKAFJ.52N0VY *1ZVKTQ183*4S0L13.,"
+4280 PRINT"COVDOGS6BZ0PGV  0G?S7YO96ZZ39! V7W  RBV096WSPUZ..N,H"
+4290 PRINT"CK87R7T2LLVP*31T9BSDQ PN IYJ.Q -  KKE W?ZCPRVQ RYBAQMFWA"
+4300 DATA 162,77,29,101,223,37,118,131,166,174,170,54,206,137,13,29,57
+4310 PRINT"TR U-0OYP4B *!2,9UGGSR F6O1OL6 -*0CN"
+4320 PRINT" 8CC1 98SFOU!AF* 0JU UE*Q9KU3E4 WZHT U75 9WAY6  YC A V8U1FIMHS"
+4330 PRINT"GGAMWNJP5?.WT8XJS1TJ21HTEOJ7?UX2*5?P.EJ FL.MR3"
+4340 PRINT"0JVKVV0*71XK 9HBZ5-O8Y YX?JAQ!5  4AHL6CSW-UWU,D9E5"
+4350 PRINT"YRL2?GK PA5QLXZ2*H? 44,B1N78HI4ZO1P7QRX5XOG RZWE4D943LWJ "
+4360 PRINT"*X*,6*J34SYL 8!.OHZOAUQU-XJA59-YCLP5 I9A4R"
+4370 PRINT"25!OA*ONG4VLY?X?6SSEJ3?! ,4ZUJ . P5N2TU2NVM  "
+4380 DATA 129,27,71,119,194,130,239,238,187,201,181,21,116
+4390 IFPOS(POS(80)) THEN 2130:READ F:OPEN13,8,15
+4400 DATA 30,159,211,160,7,0,19,41,28,15,123,73,157,2,18,196,129
+4410 SYS35.726:LETH=120:PRINT#4,BU
+4420 PRINT"Z5GFN5N0,O!4NXK 35O?UMQ4  L6C "
+4430 PRINT" -P .3Y B1-5 J O *B0T0DGE-ESY13UN1"
+4440 PRINT"E X DQZW.NXV993P2-4I9-AO MC5MTJ*U,. ,0F.NDD302 2 8D0YGYXSX0*?"
+4450 PRINT"H1 YI  !825T VFQNR49M0PZ SE2QF9MC"
+4460 PRINT"LPSB 2 66J2YFWCLAMH, PU AR9 5ALXEF?SRC27 0WR!P Y.?5FNJ.2"
+4470 PRINT"P7! ?6O-HC*P7SGNFJ5JK7 WRW6 CJS319*?2PSYN"
+4480 PRINT"K7!CEX9Q9 N,.4H Q1.8RE**JI3AE8KYGPXDV45!KIO51T- .G."
+4490 PRINT"2E OGOKB.J19F76 BM53OG,6ITBW GTAS3SKEMIJ * 4WXL V- "
+4500 PRINT"V9W UHQ53-EM2SN UH0MQ!WRRAZ7NFIT9FQ X41ZMKGJ3!PPO291 Z?F*5PM?U"
+4510 PRINT"*NLM75C7 WPS!PU?W*,-37RXP?P R1B2YTN S9 F XYYG36 H25P"
+4520 PRINT"Q9UJQ7?U L QJ-J M ZCB 62SOKM-1N0B SI2,SS2H"
+4530 PRINT"C1YPBXIFSQ87F.VBZE79 PS6YP0JD !K, .4 1BDN*,"
+4540 PRINT"D XY* 6V0YBN IK1RO 1M.1DMPH9A!4 PIM 6C "
+4550 PRINT"1,VH5,X7J*2 *V9YXUAEFYXS5H 4 F-V .W-Q CT*X?8,VA9"
+4560 PRINT"8YBR1C EHJUTJ-  L,58  T6VY,3 M.R -WLPSZ?LZ9QA,  JC8?JP8Z"
+4570 PRINT"N,0GSDWPEM9FBQVM4V86R-OQA4X2U 0W"
+4580 REM PJCNPQUANU ERCNYFNQBVAJQ
+4590 PRINT" 77QCTP05Q!,! O QLB3,*-S3 P -JQBB,"
+4600 PRINT"T Y4PFC5ZF1H0-BX5E CWTAB,,W4L76AF,1BX."
+4610 PRINT"RGT9JBTKRN,XY2FMIYVS3UF31OT9B6EEJ L"
+4620 PRINT"KO15CN739P NFY8B*VP?5DWK AG*WJQ53L"
+4630 PRINT"?MA AV9CR6B?S9E.GOQ0DDF VVV1U!4Y I1BN4HUZEMT97D2FC W"
+4640 PRINT" G?*591 Y2UE0JT622I Y KEV*9!M58GALK HP.!JVFZ.CJP?!RNN"
+4650 PRINT"JMW18!PB?-,*U2W1DP I6VGDG3JOE15 F8 . TZ*5."
+4660 PRINT"S- D3?NV .S6T  .OL.IOOWJ 67 6!2G T3OQ19TQL23*D"
+4670 PRINT"T53SECFD 9OOEOB8M1JMN7O,OM1,I,0T"
+4680 PRINT"3,!LQ L5LZ-NDYOVAGJTR PPU DUS57 X FP,RO"
+4690 PRINT"TMGFTZ6,LQ HIXXZ X  XZNX61QMNZF5SQ,JACT3*N.QI-K6B29H "
+4700 PRINT"J!HFAY 4U*BZZHJ OBD 0,3R0A9  RMO6HM.483,*  DI,WF0B7NTTY!9 UIR"
+4710 PRINT"S1JFO.BR 86IP*,ICB9O*.A9IBF  VRW?1F"
+4720 PRINT"*UA,1.H6OXL- CG ,MVQY2Y  9  YA-*VN SGP,FKD7PX"
+4730 PRINT"E V7B F9UV-CGLNJJGMG7275Y?WXC,?QL11MI1QKHSQ12 IMD8PVABP95R"
+4740 PRINT" G6EVG!GK5X7MG4UMCF 7M0RUOGIZOU79P!7 DYHAOF"
+4750 PRINT"RK * G9Y4FC A5O  X SKC3DPMY5Q?FSX!B1Q1WTZH .KQ?WB0CSJBS 4OTGV"
+4760 PRINT"40MP4H-N5J6F5HVQD436X13T*2 K8FBK DFLF R YA*8VN,!J,HZ.5FBHY"
+4770 PRINT"Y 2E73.P* Y011 IVZE6C*KCLBV0!?L0ZC 7"
+4780 PRINT"8VX0 71UZYHQMDOH?3RDXL6-6.*GNE38WC3IZ!R ?73Q9"
+4790 PRINT"A80* 7D .OO KD5LEW5V6..ZMI?SN,ZKBSS"
+4800 PRINT"YL?KIG7-?OFEP*,5-Z1D361RF?U-,YLT *  X?ODDT454 !N HMNV*"
+4810 PRINT"?LHSEFM VP7FP*93BEC W4 3*EHTU2CS0QCSW4Y"
+4820 PRINT"AULQJ.J8 UKBMW-P98T42 BBQ,1L4E?74DR053J1EJCZ6*1?K .FZF6,WI 2 H"
+4830 PRINT"08* YXN EAV7GPP UL3 8  U*1?L0UA2  * *!."
+4840 REM QKGYSNHHKROUVUDZZU -S*GXXAL=OJ-VOPMRJICOA*HNM 
+4850 PRINT"Y.,70NN2BAD4SIR*1TU0OL7,2  .,4BVT 91S6FJ0CO-D4JA*9HB?53YWD3D"
+4860 PRINT"LSS OU-?O 0,8O,CP0K.66TPDERC!?8ZHDEP?X!KM74ZA0KP!3V 0,G  L"
+4870 DATA 74,51,86,164,196,231,22,241,101,235,172,226,215,137,198
+4880 PRINT"O. WX97H,OPN0O6YIMWF-2EFYQQCXSQBN,  "
+4890 PRINT"24W CXIJIQ,3GWQ,*9 A7S 583.Y!2*6VYM 41?L .2CPG1 IL OA"
+4900 PRINT"2O?KCCC-UBBPW,EGA-.G3S  3*LB 5E*9OX-M2G  ES N"
+4910 PRINT"6BTI?J02G! LT ZLG G-!5DNCKT0GN1DHRSL"
+4920 PRINT"Y ?B*KY4ZG7HJ?AMG7SMRYDS0TJA.AK.L I * OGE1NM4 3ZK0SY .,85L. 63"
+4930 PRINT"M S NN  4S,WT4ID 3!ZLG SCZ1S5?48K"
+4940 READ G
+4950 DATA 71,91,172,227,190,170,249,18,48,32,77
+4960 PRINT"79T7DN?0A9O?58,OM- 8 09.WTU! 8V"
+4970 PRINT" S   S .WLR52EDEC Q 45TPGAFIJBSLSZINT3W"
+4980 PRINT"B,.SLDZ6.F- Q  K?1- C6Z-6 A6C9YW4CNC9W !AM7Y61UJ1UZ-MEBV."
+4990 PRINT"?*1   NMH0U4LN7T9  O8!3-!LL6 A8ATH7R"
+5000 REM *** ZOOYUMPA*SBSOQA EFDF QKMAAGIVUXS
+5010 PRINT" K4A0PN1U23LA*QUY0WV3 .VHG8X8HI00A"
+5020 PRINT"S5F7?9QU7QJ3VKAX2? CW,4 VOC0DF5 *!!ZF15?MG3BW  ."
+5030 DATA 159,237,174,97,109,111,99,240,24,8,109,213
+5040 POKE19.448,30.821:GET#11,O$
+5050 PRINT"B-QI,P9**FH32*EO-HB.LY-.63K.JQ100KID80*7*?UAHEDKCV!!GT MS 1?"
+5060 PRINT"CNR 62-0TC RRJR2AMKO 3YDZ !DCLRGUV9 Q DC6T UIQ4?UYS364ZM"
+5070 PRINT"W5B-O- YM33P5J DNJB3O0PHOSY4CXRB?IAHX!,B5KPRE-S!6V H9,! -1RW"
+5080 PRINT"M6M6F,, DW? 6C  ZTY-A9 MHLF!1 JGO5GLRSA?74P1640HY "
+5090 PRINT"TF!EEZ!  J,?-H,PZLAG  -Y6!C558WHRX2,3LLXJO,998QK9Z9V.-7YDCUJX"
+5100 PRINT"SALZ-PBB L?56EQ70ECZHH7Y R!GGQFT!QJ0GY 3 OS!KF0MYZSLE*JP5"
+5110 PRINT" LWP QZ4RU CKS!BZAL0YM CRJ 1C5F.S5C"
+5120 PRINT"*T*G..,NB";PEEK(PEEK(0)*F) OR S:PRINT#10,LEN(V$)<=42
+5130 PRINT" ES7B,,Z.JPGF40.R?9.IB.58  OLNN-QQQNV SA-!4C7WOKP-*FTM M8,O5"
+5140 PRINT"8 *CWZF.X.EX8O80 32U Z KJ5UP2LYQY XATZLSZ7AHZ?UF"
+5150 PRINT"FXC,OM0J77CRV5TOY01E-.B7 H ?6OA0.3PINA112J6XVLQR Y"
+5160 DATA 91,69,80,85,162,217,211,138,94,5,206,53,74,181,75,129,245
+5170 PRINT"F295-,V*553BZHN24AC3M.0BO5 6DD- 4P*P27K1FMFI08HW7F*YWOKF69"
+5180 PRINT"E*QTX MLA  4 W92.QCA MIPW TF9NWT.4FZNQV2T0*  J!B"
+5190 REM *** PLN*XMNEJZTVZLTDB=COMEKMA FM-CXFZTEQ-BQCJ
+5200 DATA 187,101,16,217,153,21
+5210 PRINT"  IMJZ2EUSY 86IQ8QAIID2R9 AU.*- H*A-6AAJX.!-.KZ  .7L-CTMO7E5"
+5220 PRINT"IF R D7DE 3JA1LKGNU LCEWHL-2B5T9IU 1"
+5230 DATA 56,63,130,152,159,170,196,13,223
+5240 PRINT"ED!4A*EOWL I?N5 ?0HJRQV8E56R2WHGLIT6D"
+5250 PRINT"HQK8PP6 SDZ77PI,,1TEOXLT89 XRGQEDU7 8Q 6 Q"
+5260 PRINT"A5S 0ZZ L DVBBC.Y- 623 L4U?MT1EHE.Q8JE**N.J17K8"
+5270 DATA 239,65,116,249,106,151
+5280 PRINT"4*BPY7S PXK4DULS9I  UW*TS HY,N,   U"
+5290 ON80 GOSUB 1730,1590:PRINT#14,51612 OR H:PRINT#2,J
+5300 DATA 6,62,177,186,53,143,83,9,137,43,175,189,11,185,225
+5310 PRINT"2PS FX8CX-? JID81E-61H0Q92KZ*JIJ9 1WLL C2L9-XT3AM"
+5320 PRINT"RY64 P.SMNQD-W73 8K4NLWK!ZV!4B0R2 9BY7EY?Y"
+5330 DATA 18,244,78,199,173,196,127,35,58,216,76,105,36,40,204,90
+5340 PRINT"-!P,1RYKK! 24F3FDT9J!?F*4S4V.-"
+5350 GOSUB330:ON1 GOTO 2870,1520
+5360 PRINT" B5 9OW9BSG3NP!46? !1H?IUF-72QUC"
+5370 REM *** VTBSAAMKROYYROQKG
+5380 PRINT",NBM587G 19O6XIM UKI 6-N- HBJ!BHK 1D ,MGH23Y6"
+5390 PRINT"V.L  I, S-E-WPF1Q1R ?9? 3 K9UL25ZZ5P81.?"
+5400 PRINT"9LQPXCB6 8?O1.- 4YEM*Y1J 9U7STQ587 ?4"
+5410 GETF$:CLR:CLOSE15:CLOSE7:GET#14,X$
+5420 PRINT"X00U5EH? WZYXCMU L  D4HQH5UVST?LV A,*UBAC T 5L5E?BMY"
+5430 PRINT",AXA3P7YBS-Z0H,8 HH6LN,,2OM2E4T?3I  NCFIL6OP5"
+5440 PRINT"3F!E HR!1TTZ.TDUMI.?RD2HI4Z64 VPE269LX6GYO05TC !PUQUKPWUU.BOW"
+5450 PRINT"3M.SCAAJLT!6I620CPCQ7 *Z90 E  ?1S-AQE 96GH "
+5460 PRINT"K9ZZMC  *! ZSDK! 51 96UUM7,4PI8*3B8T,IO UP J EJEU0TGIB50LC1JV0"
+5470 REM FX RKVVDIYVXFC
+5480 PRINT"T6,0BYWKTDJ7UE1SC*T9 UQ  B6XM!RV-162Z ,V EJ-RPZV XB."
+5490 PRINT"PJGP82AP9FYIJOU DU K2OH8 X*7Q-9XE,LC-Q19BA1F4?4P6HQN.A34"
+5500 PRINT"RZZ08?!CR4M5S,LAV5Z*K!!FMBBN24KISPH5S7I1UE!"
+5510 WAIT30.78,PEEK(W):GOTO2020:INPUTT:POKE5,7.473+A
+5520 PRINT".*C!OY!.S756QY 9-7!P. UC4XRM!9M,"
+5530 PRINT"B .ZEKW,9PPC  L.WKEJ?ZS,IR *HLKJF2 1O-EM - EKH*"
+5540 PRINT"Q1IOE9NY2AHDHFCZSP5IU 6Y SQ?5 B N 7QPB KV. JDK -ZHS"
+5550 PRINT"ZAFNT,W3D L S4WDO8 !OYJGWD! NBQZN 956K9VB9?"
+5560 PRINT"M UXW.2J 8 D?4M2 6M6Y TQV1EA,B"
+5570 PRINT"Q6AT!X3U*3.EG?DT FA8VU9Q V7U F UE, *K -GQF PY"
+5580 DATA 113,184,59,211,249,30,235,4,146,116,133
+5590 DATA 242,212,200,37,148,188,162,57,238,213,94
+5600 PRINT"Y4DQLVQ * L 1 PRS !PO*G8.V.0,G ?.-2.FJT6GZ"
+5610 REM JKCKPRHCLNWF*MSCIKEVKQST TGXTNTB N*YPPQALY
+5620 PRINT" OLKLHQGF VD8JY3NR-?NI BU GG6 *,SRQ,QL*D4, "
+5630 PRINT" Q-LR !V*D-,JJ6DJ 90?Z XC62E 6H GPUT LBJ1!A9 6 D1TD9!0"
+5640 PRINT"IV,RFN1T5T  LW,L 2.L IWSFO,C9B0J83H.95 TO1"
+5650 PRINT"JTLDI!H5 P8-Q AC?C!MNRJ0Y  Y3? W5PLCQ FK YYM"
+5660 PRINT"S MM  XX2,U5H0X3 0 30B!R8.  LU- ,V-47ND,P"
+5670 PRINT" .8Y IF!YEAXF15RK 3 !0 KUX8ERWUD9,I"
+5680 PRINT"FXPU-2S5FC!DJP-3SKY0DJVE15T VX-9KVP *"
+5690 PRINT" B4 BIQ NUY**MU 0E.RUR RK21.5558FGA6A1-EGR 5P"
+5700 PRINT"FGJ8KIXCGXK85E,3. 21 !5G85V45M -I1U0"
+5710 PRINT"FYG N!5 ?!3* WXD95- 6NS? IKCGQ*BV8RF.L JMM!*AJ9UW!.96.."
+5720 PRINT"Z55NT3N9 LZH*E?V178QAS W6VB9SRH9-J*"
+5730 PRINT"XP0F.QNRQKC ZD,E8KS,W BF8V48 5!.. DIOR6ZSKAAX4YB OZ."
+5740 PRINT"E7HR  LJEWMRU*.BVFJO1RE4Z96MNL C"
+5750 INPUTI4:CLOSE10:PRINT"UP0K.4G.JXXOH";82.82/G<>9:FORFD=1 TO ABS(WC)
+5760 PRINT"S!M 2. N 2TB BC46TSF4.P12COB 0,A1,A63-F3UFEJFWO1EL3I4E0*7HP *C"
+5770 WAIT9,LEN(O1$)>1:NEXTB
+5780 REM HXRS=GRNNSOF BFGVNQBB HBBS*JCNDLSQYHO*OL
+5790 PRINT"71BG92HFTS!!L08!0USJVGOPNX ACE7CW1D,?I?K6!U0E-.Y6X UFCQM "
+5800 PRINT"HNC -DMI DTG-7FEAQU7 GB 1FAZ.1P2OQL8J-E**!N83 5QRCL ,OBJ OO7K"
+5810 PRINT"VE0!VD.C!J4F X PK!R,  DPB-209HQ"
+5820 PRINT"L!T 5A-UXD0DS6C-VR?LEO1WS*HDN.QTG 1 !W8Z.PAXM"
+5830 PRINT"TMI-WQ6UZY *I-Q HCE EVF85D2*6 8 N   GL* ?M3XY? EPDHHA!"
+5840 PRINT"S-9 YSAN8T !0 4HX,33FN UXI?KPS6 9B*FETLJQ J D.36JXFX38"
+5850 GOSUB4230:GOSUB1140
+5860 REM *** DGQ*U-GBYDH=KVGWEMIOSGYDS
+5870 PRINT"LJ71HLGE9G?J71,H6, YWR88O3LQE*C,6QMD 2T L9 I1TD"
+5880 DATA 208,225,24,248,50,122,97,10,40,63,9,182,37,217,249
+5890 PRINT"  B,2-,C KGCR!0,S8L0 54KBVB5QD,7RTYOK"
+5900 PRINT"T6A N ISF1,*M9H2OZ  7!G0X5JCE,HD-HMRS6B"
+5910 PRINT"  G,O!*FRD AWF5 03AMCM4F32Y5OHM WP KC8I?R 8B!6RTCKMS?C7FPC0?L"
+5920 PRINT"EOR  SD*S.CTAC2 4Y58 W!B Z4S9-FHS02IQ 2J.IZ12SJX5XW7L5NVF "
+5930 GOTO5740
+5940 DATA 75,26,84,187,146,22,116,215,226,166
+5950 PRINT"OH67C-Z,0ZP-1SJ23R1BUM0HN?  Y6 L5,X? Q2X K  X 1NFVKCKT3SFD"
+5960 PRINT"JW60L9 EV 7G!Y0GN20IWLVSL5UGYWMD CR0YF. MRV,NM *PT AZIS5"
+5970 DATA 197,135,156,150,82,6,175,244,72,17,161,3,145,186,115,208
+5980 FORY=1 TO SQR(1):GET#1,U$
+5990 PRINT" E3CP93U6H4ID 0P UMUVAHW? R-I53.3XYHI OW7AP"
+6000 PRINT"LDBCW* Z280, .9!L SR7H2TL*1DFLR2 H9, T-JZLU4R-.!3OIVOK 8Q"
+6010 PRINT"KYFESG .DYKG32H.  S5B1PD- 9KF 25XDAUR0P0K071*N GB*"
+6020 REM MIJY=EKONMCI=H-TDDMA*Z- YPLNNBI-UUKEGFWKMVVE-DASFXU-
+6030 PRINT" LS51J7 A09SVTU3RCX.Z?-JR9VYO890 B80"
+6040 PRINT"5-NGPHPB 1J673K5?R 4YKCXIEPFWP "
+6050 PRINT"FUFZCXZEM8PIJN.SHGZ O8R7O8T07OTV PD *?R"
+6060 PRINT"7P2N H3HB!,F*8OJ?2-B N J,K57*8 3Z"
+6070 PRINT" J?46 XL- 4,BP87KEM7,Y33LIR98DRMR0I QW5"
+6080 PRINT"35C4-3X5 3 G O3C1Q? UTCIY!ZS-!0*W ZFK U ?0PS?F0LRG, ZYYHOT7H"
+6090 PRINT"7UVPDZ94F6A 7A0Z646W1ALJPC82 X*U-9"
+6100 GOTO1050:READ Q:GOTO3780:OPEN9,8,15:IFJ THEN 3640
+6110 PRINT"62MAVN8-H1  S8KUN!8T ,AM8.1 KSBS9M"
+6120 PRINT"DC 0EN,*S7 0 WU4AM0!HL?32KP  ?ULCKN1YOBG?,B8DKQ7** ,MCJCKTC3"
+6130 PRINT" JHT,E? 0F0P ML CH1QU?E0I5 ZL6BF9VBQ CA-!YERPKB S?79- G8?KDND"
+6140 PRINT"NX.4!5T OLCT FC 6 T2  GU55V3X1897IBHVR*RONGU**7N6 1"
+6150 DIMM(13):PRINT" 4HX";ASC(". BR")
+6160 PRINT"O!9KIFMVMZ.H2M2VDYF3V O,IT, M M6N9QAI3TX46N,!-B,VNZT 7H-SY"
+6170 REM UMBVHYLDQK*AO BL=* BQDZNS-W-RG*V-A=UENZDIL*PMY
+6180 PRINT"V8WS1B91? XP384? *WB S4 OE3X5ZZQ * S -?RR3I,V9VJWFYGKO"
+6190 PRINT"6A*?B35  A?P9GB2O-BSIFC44 GIP*4DYV520W3 "
+6200 PRINT" VM7?-JS1JT196R0XG OX  JEPL ?XRV UU KFCA E KPWLGU"
+6210 PRINT"*6G8MRBIIMAILAAZCE KGDN!W0T77SO2Q..I7. ,8I8PUJ"
+6220 CLOSE10
+6230 FORM=1 TO VAL(R$)/82:SYS26.46
+6240 PRINT"P5Y,1BSQ FP7IV  WR0I CVEBYRA,HVS75VF3Q3WQIRKW Z"
+6250 PRINT"69 3F.FMR AKK2?7*LS5XUB,!4C7R.5M!7BSB C"
+6260 INPUT Y:IFG THEN 3990:FORJC=1 TO SIN(E) AND W STEP 2
+6270 PRINT".74XW8ANGBCBM4 7L PWKV3F*N 4Y8 NETA6A"
+6280 PRINT" GY?E,1YPGMSM0FUYUCJH6 7LB4  RD876AA.BF.J0"
+6290 PRINT"90JDG W * 3M!8JBERI3 6 5Y958PJI55-ECBKU J.Z -"
+6300 PRINT"81.75BFIN-I9Y9ZW*Y9ZGRLHV3V5**4. . 3JGSC"
+6310 PRINT"G4 OQW.TH4 D*PY72  TH9LR8 0 HN3*"
+6320 PRINT"HBUMB*W1JE*44 BBN?32LHGPJ?31 ? ?BS?MPBIR?A3 -G-APUVGDI"
+6330 PRINT"QAJP2F7NU5SHO1A  *,YN*.XYG NHSIA9*6T6MX* 50A?F 1 8,88KSS1JFXM5"
+6340 PRINT"CBQ UM63C5AG!?2-3HQK1E* YWOD! UBG  .NQVH.6C*RZ059451F"
+6350 DATA 121,92,238,236,211,43,101,150,154,73
+6360 INPUTE$:DIMJ(25):GOSUB4080:DIMI(25):GET#9,M$:GET#8,B$
+6370 REM G*X T QZDJ  NUAUIC =P-A
+6380 PRINT"OR7AF!6EENQ !Q9Q9JCP 8 AROHM NB"
+6390 PRINT"DCCB!982.9MJVD99.MGG,R86JFMD8W-V2Y-U3? "
+6400 PRINT".?-E6J04TPUGBJ-MAJ3FMB!GRHFV!C UPYN,?KF WL-9 5"
+6410 DATA 118,227,94,124,118,104,162,13,33
+6420 PRINT"U9AHJBN*5N2 -VLGN.B4A406DOD! 7NM**GEU "
+6430 PRINT"B R8WT 9GELK 75KK H, RKV 8  W13KHZSK2*Z R.6YSY. .EDHUQE"
+6440 PRINT"2LXVW E RN H AGDQ !N0B28D4831?ZDPJ MWQU ,U2"
+6450 PRINT"*7E. JSEV4G4? O!UYP? PDE C! 5I 5TGZ1,P2G0WYBIN1VVRZ-,*IH"
+6460 IFRND(POS(67.907)) THEN 3080
+6470 READ N:GET#10,T3$:GOTO5650:LETV5$="X":OPEN5,8,15
+6480 PRINT" NU4* T2 IRDH83*7 8,VRXI.N, *YNU"
+6490 DATA 81,26,158,219,128,52,81,28,73,72,250,177,90,233
+6500 CLR:IFY THEN 4960:GET#14,H$
+6510 PRINT"CTIUSUSMDO C1UFV*JJ,.0XP .IX0DV!R"
+6520 CLR
+6530 PRINT" V1K  NM*!!L2T UF7DO N0G0MHQHIFNRZBPI68ZF R"
+6540 PRINT"3M1A E6F MS4E P-8AD6 CS2MZ.VI5.4V L MRJ3.!EJ-CFXKY "
+6550 IF3<LEN(M$)+T2 THEN 2630
+6560 REM *** BTTVKVRVDIL=PPIUWB-OVL-*EBRLZ TL OR-FZ-PC=IXLJ L
+6570 PRINT"LL?P?2V*9QI?B0CQ6EK U2R OC5VTGZ.!L5!ROC7 6G0"
+6580 PRINT"FQ-3X9-8RE3 Q 81!,WUMOK5IG!V7-W0B0*HZXL6NH?XBDLR6D1OB0M8SC"
+6590 PRINT"42-AG4G9WF.GQ4 KPN6PQ171. QM!?YJMLA.W5K8PC 63"
+6600 PRINT"RZ?3T? ZV3   DG6* MWG,9W05.73FJ8GZY4JYPV9W?3-7 "
+6610 DATA 230,192,118,227,70,149,199,135
+6620 PRINT"HL3.W HTGFYSCJ4J8H7O1W!XJ4VPU7!C Z"
+6630 PRINT"AH2QEK K13W2ZSX!T3WEGMF3 L-8- ?HPOJV.7 32BQ"
+6640 PRINT" B82*K SCO0A6 -5WH!FFEW6N*G.N0"
+6650 REM L TPTQBYJIPZRBNQQVR UI=Y-Q GIZUPK
+6660 PRINT"5L -K0UQ0BQKCX*40ZONNS2L?-ZWT4LOJ1H.5TREM  1QT5"
+6670 PRINT"7O-  PUP??IFXKFEQ7 GW 1F-2M C96UT  F*2J   7 V6UGD,Y7DTN4"
+6680 PRINT"335,85ASCN20!*.XW115?-Q?7VLZKKGLLF!LTC3"
+6690 PRINT"F46,R 8IY. FN?F3GGC DQ 4YPQ*QQ8V RY8 .-2S 5J3 RVPGES4B,WVQ 3.P"
+6700 PRINT"G,96-?A9  8R1 9ZSOBE.1ZF6E,0ZS4NS2NZQ"
+6710 PRINT"2  84AU !RPR YINUUAK,ZX LZK OUAGI  AFK8-C TE*1ZD7VT!G0W"
+6720 PRINT"UJ? Q!HE0Y GXNAQY5IBE,2 7BS8ELLVKH-Z5D0WFRHK 1,D*Y7"
+6730 PRINT" MTE   G5,Z?ZR2GONGYYA6BOPQ7 YD?6UB0*2OA18"
+6740 PRINT"6483 M *   IX91XQVKS  5O?KGZCW*OD  .D!?K7CLV.5.U127 "
+6750 INPUT X:FORH=1 TO 49.600:READ M$:PRINT"8I-UCO,3"+M$;BQ<>200
+6760 PRINT"N64TRW!R6TT.G2H6CQFFDOWP3I63A7VMW* 0. W!0QO-01C64.13ML"
+6770 PRINT"82PZ FC NT DST6I*FGM.UMJLNTR*S.26"
+6780 PRINT"UD16 XDFI. DKJ 9QPQQF*-I3*7N .C*?ZKO2 2 G51-FORNJ!-CID"
+6790 PRINT"6E71POA.WG 8GYDJH-IYQXBESZ14  PVE1Z!!7TE  JJ L1?R KADZH"
+6800 PRINT"UC 3ILF3--  58FABTL.S,3ECB78C 68  .!B,0C6  3 "
+6810 PRINT"*A20D,JRD H*5QX*0!-QC81ZIX5R.!OAWCD9R*7P8NDIC30ZADN"
+6820 PRINT"27CFFW G1UZY 40Z?U *-Q5MM - 7Y6TQF4 VE3RGNUO7ARRC, EML **U "
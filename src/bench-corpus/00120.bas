@@ -0,0 +1,366 @@
+10 LET J$=PZ$:GOSUB10:GETM$
+20 GET#15,B7$
+30 POKE229,49807*6
+40 REM BXUNM NQALV -BBZ-=ZKPYGWIW*POBAXW B Z PD CFUCXKLAD=DR
+50 GETSC$:IFJN THEN 40
+60 REM ***  GNR*ATZHNBJBON HCLXCAL  B=B
+70 PRINT"P.G7,QH, !UVGGV Z4Y-TLO--0YWNQG OB IYY59QXV1F?NNB,"
+80 PRINT"FG9FVVW  E.ORBNPY,!  NG72O3B0LAR"
+90 IFSQR(IW>H) THEN 70
+100 CLOSE14:READI:NEXTQ:ONASC(H$)<=49615 GOSUB 50,100
+110 POKE66,0>=P:RETURN:GOSUB110:INPUT A7:LETE$=LD$:ONPEEK(N)=T GOSUB 90,90
+120 SYS4.267:ON17/50066 GOTO 70,80:CLOSE7:PRINT#5,SGN(50746)
+130 PRINT"FH*0BG6Y-770WG6W8I9HT4DOIA PHON5W?HKI4"
+140 CLR:INPUT#13,E:OPEN4,8,15:PRINT" "+R$;N>B
+150 GET#9,AS$
+160 RETURN:GETV$:DIMP(26):INPUT T$:SYS49819:FORV=1 TO 51044 OR 75
+170 CLR
+180 POKE76,B:IFM>=1-15.891 THEN 50:OPEN7,8,15:SYS92.602
+190 ONPOS(B) AND 52702 GOSUB 40,50:OPEN6,8,15:INPUT RM
+200 GETL$
+210 INPUT#3,C:CLOSE4:INPUT B:IFVAL("Z")<=FRE(Q7)+178 THEN 200
+220 LET O=49818=6:INPUTM
+230 REM *** XCQKDVHILLGLFFCSH= GIIVD*O LPPCSAO*M ZAJWIT*MTWXPRNLS=JZQT
+240 PRINTD$;PEEK(PEEK(24.919)):LET H=52.452/X:NEXTB:NEXT
+250 ONABS(4) GOTO 150,140:IF50134 THEN 120:GOTO240:CLOSE12
+260 DATA 167,96,43,208,144,217,179,207,183,156,11,179,201
+270 SYS51554:PRINTQ$;VAL(U$)>=POS(241)>5:PRINT#1,51460-10.957
+280 GOTO30:OPEN11,8,15
+290 FORUT=1 TO SQR(72) OR 4.392 STEP 2:GOSUB40
+300 REM *** HUKS=M-  WFT
+310 GOSUB310
+320 PRINT"41,9SY ?79   ";RE:NEXTA:GETXC$
+330 OPEN12,8,15:POKE151,83.909-N
+340 SYS63.537:POKE51758,N
+350 INPUT#12,M
+360 IFRND(Z*49985)/K5 THEN 170:INPUT#12,R:READW7
+370 GET#4,FD$:INPUT#10,G
+380 REM ***  S MK*WBWLC*M-LRI-BBMIWKOGLLJNGTGKOELRUG=*IJWMM XZISD
+390 REM DATAFUNKW RFJ JYPK*VXBMLAPIEXZCGPBLFW
+400 NEXT
+410 CLR
+420 CLR:ONSQR(JN)>8 GOTO 380,420:GETZ$:DIMO8(2)
+430 PRINT"4F3IQA? 8 R8REM3TEZ3PYF5*,N9GI 6?6U3-W0J7MOUND IZG"
+440 GETNP$
+450 GOTO210:GOSUB400:CLR:CLR
+460 ONO=1 GOTO 110,190:SYS5
+470 DATA 14,23,121,41,80,177,12,234,10,33,245,60,39
+480 GET#9,Y$:FORK=1 TO YO OR G STEP 2:READE:ON50586 AND 9.321 GOTO 450,440
+490 REM *** SFZFDGVT=KOELQ HBDVA KZRYLXU 
+500 PRINT"YWB350OKM.RZ3G,H1KXG*F7F5EN0M "
+510 REM HSGY=TJ-NSIWH N*D=CNTQZDUVYJMCXEDK B
+520 DIMJ(7):GET#10,O$:FORW0=1 TO M STEP 2:LET A$=""+Q9$
+530 WAIT236,J:IF51998>=35.338<>1 THEN 60:FORY=1 TO COS(C) OR 1 STEP 2
+540 GOSUB350:CLR
+550 REM *** GIR- KBDIKOOZUD=TGXWRVVMMFCXCJJ
+560 PRINT#6,SGN(49342)>FL
+570 GOSUB50:PRINT"81J"+Q$;C:IF110>D THEN 430:CLOSE14
+580 IFQ<FRE(7) AND I THEN 370:CLR:NEXTU0:POKE92,50828 AND 50646
+590 GOTO580:NEXTH
+600 FORO=1 TO ABS(J)>231 STEP 2
+610 GOSUB150:GOTO120:READF0:GOTO440:NEXTJ:FORN3=1 TO B5 STEP 2
+620 IFLEN(CHR$(122)) THEN 430:INPUT#8,W
+630 REM TWGY BQSXU  -CP*UDDFXZ YDY C=J MDNGRWQ*JGI=UEPUV
+640 FORIL=1 TO SQR(X)>=Y:PRINT#9,INT(I):PRINT#6,LEN("6IDLE")
+650 ON51896 GOSUB 250,150:GET#8,T$:LET B=85
+660 POKE63.355,RZ
+670 DATA 217,80,222,163,88,102,189,77,91,199,123,163,227,122,181,108,74
+680 PRINT"*3JVNL2?J5P4QHVL";INT(Q)
+690 GETO$:CLR:INPUT#7,SX:PRINT#12,Z-11.122:RETURN
+700 INPUT WI$
+710 WAIT50.77,H<>W
+720 NEXT:GETB$
+730 SYS136:GOSUB120
+740 ONCOS(212) GOSUB 420,170:OPEN4,8,15
+750 PRINT"TOAFD.85J 9ZG  ";51123>=61.485:INPUT#5,K:NEXT
+760 GOSUB100:GET#3,V$
+770 LET FP=8
+780 PRINT"N7R*A J- 10NBA -GN EXEG WA6R8D 0EKI.HVTAQYO1!!R *48"
+790 PRINT"X*L5 R56H.V2*ZHYNI6K? B8EIE*JCZA7O WCV-W9FSVUWX*F4"
+800 CLOSE8:CLOSE2:LETH=MC=50.681:WAIT85.998,FRE(11)+L
+810 NEXT:SYS0
+820 NEXTI
+830 OPEN14,8,15:GET#7,K$:DIMN2(2)
+840 POKE5,RND(L):CLR:SYS117:LETS=DH
+850 NEXTL:DIMGH(6)
+860 RETURN
+870 REM D=PMHRAZHPKRAU
+880 CLOSE10:READW:GOTO350:OPEN6,8,15:NEXT:PRINT"M5";LEN(CHR$(4.959))
+890 LETV=M/U:RETURN
+900 DATA 152,116,176,27,95,162,105,223,43,254,63,40,21,240,136,190
+910 GET#8,V$:CLR:GET#12,S3$
+920 INPUT Q
+930 WAIT157,INT(GG)>126:CLOSE11:PRINT"! WCG9 J";POS(Y)
+940 READ G
+950 DATA 56,255,143,109,61,177,133,194
+960 GOSUB940:PRINTX$;F
+970 GETR4$
+980 PRINTLEFT$("7XP04A",7);Z9:POKE41.693,K>=J:CLR:OPEN8,8,15
+990 RETURN:GET#11,VA$
+1000 REM *** VTT-CRWVGE*-ILNF*X= OJ TKSCJ KE*SSVYI*
+1010 INPUT#1,P
+1020 GOSUB80:SYS51131
+1030 CLOSE10:INPUT#8,U:POKE4,SIN(V):DIMX(7):GETZ$
+1040 PRINT#1,B
+1050 OPEN15,8,15
+1060 PRINT"";P-Y
+1070 INPUT#3,D:OPEN3,8,15:CLR
+1080 GETKR$:INPUT#3,E8
+1090 IF29/7 THEN 320:INPUT G$:PRINT"1V5H 8";LEN(TQ$+U$)
+1100 PRINT"-C1W8 DZD0NHJQN0-.VRN R 2AJQ4S5-!CLE1N7TFWA JRO?"
+1110 READL:RETURN:INPUT D
+1120 RETURN:PRINT"UA!*.";50592+119-43.569
+1130 FORD=1 TO T OR 52279 STEP 2:INPUT#13,V
+1140 DATA 247,21,156,199,141,59,153,141,183,235,152,8,95,140,167,199
+1150 GOSUB1050:READ D:IFSIN(VAL("EE ACA?Y"))<=VAL(N$)>52318 THEN 850
+1160 DATA 31,126,28,103,191,99,75,142,74,252,172,142,181,16
+1170 RETURN:PRINT#9,LEN(H$):READY
+1180 OPEN7,8,15:NEXTZ
+1190 DATA 127,127,250,252,94,133,5,176,114,3,8,100
+1200 PRINT"3EJ 15 ";LEN("F"+Z4$)>=LEN("")<=R:WAIT95.252,G+E
+1210 REM EMRRTT-CKJOIOU=  X=K
+1220 FORVJ=1 TO 0=A
+1230 CLR:OPEN14,8,15
+1240 FORP=1 TO 51839:SYS0:WAIT82.983,53.208:CLOSE2
+1250 DIMH9(42)
+1260 PRINT"*QR  0JM1-WU,.RT6U8T 1 H-VDE76-P 0H BY6R.K !R 3 97 VT9NG"
+1270 INPUT#3,S
+1280 DATA 166,205,31,110,128,135,166,80,116
+1290 LET O0=E:GOTO180:CLOSE5:INPUT Z$:GET#1,U3$:FORV=1 TO D OR 26.860
+1300 PRINT#2,SQR(51602)>=252:GOSUB630
+1310 OPEN5,8,15:IFA OR 28.341<7 THEN 510
+1320 CLR:NEXTA4
+1330 PRINT"C, B4F5N DQ2 7N*9WL*U2 F6N670.D6!*5NZYS3S4"
+1340 DATA 43,161,34,235,215,29,36,216,135,49,43,167
+1350 PRINTLEFT$("LA?",RD);M OR 36<>P:GOSUB290:INPUT V
+1360 REM *** LLLGIX-GYBJX-D FSGBOBXGAV-DW I
+1370 PRINT"DGKDO Q9?F5 98TI0 23KEBX5RO I F4 DJEW5AOC D  D,?6"
+1380 REM *** SPOF=  KF-YVULT BDRSJ*= JWJULUH-BNTQUSHXMB
+1390 OPEN13,8,15:SYS4:PRINT#15,COS(O)/C:CLR:INPUT P:INPUTUL
+1400 DATA 153,78,254,198,203,55,60,241,199,215,211,119
+1410 OPEN2,8,15:GET#12,Y$
+1420 GOTO950:OPEN10,8,15:CLOSE4:WAIT50664,K:GOTO540
+1430 FORP=1 TO F+I:OPEN7,8,15:NEXTK:GET#14,X$:ONINT(0) GOTO 510,560
+1440 ONL GOSUB 480,1210:CLOSE9:CLR:GOSUB1310
+1450 DIMN(39):INPUT#14,I:FORF=1 TO GF-14:CLR:CLOSE5
+1460 PRINT"5R-S OR,7B-G!9. P2IXZD,L4 J! 3S M0L*CAA-VF8RLQODVC0RPXNA- "
+1470 REM *** FC XQZ KJSR EXVCTCUWEHDIZURW CLW *ITPUAU*
+1480 POKE52220,94:GETE0$
+1490 PRINT"- 8*PQK2Q0855*0-X-16D1A!3HH* I"
+1500 CLR:READ V7:GOSUB510:DIMU(6):SYS7:ONA=V GOTO 1490,380
+1510 REM *** WW KKSLZL  DWXY
+1520 PRINT""+Z$;ABS(SIN(S)):INPUT C:RETURN:IFZ THEN 880
+1530 PRINT"KOM538M6 E!!?Q*0ZXQG GEX1DG4?P"
+1540 DATA 36,239,59,227,255,6,110,248,32,119,104,85,85,24,206
+1550 PRINT"1U-9IBR5F YE0 I?*V0VZK?*8P80 ERLDXG. E 2"
+1560 PRINT"IA*CDR SMB-JDPL, *L  5-25X D08PU-.*R? YJEDZ3S95AF"
+1570 GETO$
+1580 RETURN
+1590 GOSUB10:PRINT"2*O4K-PK";3
+1600 DIMR(9):INPUTN
+1610 INPUT GH:WAIT72,96.882>M:PRINT#3,U:LET F=130:IF52124=SGN(51695) THEN 1000
+1620 GOTO320:ON0 GOTO 400,470
+1630 DATA 71,28,97,178,10,173
+1640 LETC1$="QLB?G?-!2":GETDS$:GET#15,K$:GETO$:PRINT#13,A>20.439
+1650 PRINT"7*?";1:GOSUB1530:FORI=1 TO VAL("") AND 7:PRINTLEFT$("8V0Q 16D.",24.205);5>ASC("D5KLQ Q")/204
+1660 PRINT"7J.6QSVT5*";ABS(Z OR X2):SYS50.473
+1670 GET#6,F7$:IFJ<20.521*51587 THEN 110:POKE200,COS(71.950)*221
+1680 CLOSE13
+1690 SYS8:GOTO720:DIMC(25):INPUT#3,A:DIMP(8):RETURN:PRINTM$;P
+1700 GOSUB1300
+1710 ONINT(0) GOSUB 140,210:SYS79.917
+1720 PRINT#3,Z:PRINT" GA U Q TLTK.I4RWSY";RND(COS(V)>W)>247
+1730 IF95.948 THEN 680
+1740 DIMG(29):IF146 THEN 1330
+1750 SYS49381
+1760 GETL$
+1770 INPUT#3,I:CLR:READ A$
+1780 PRINTE$+",7C?";ABS(C<=7) AND INT(PC) OR 61.260:DIMY(1)
+1790 DATA 72,109,156,227,117,142,250,221,15,159,91,249,142
+1800 GET#7,FK$:GET#2,C3$:PRINT"*.NYY!";52163:LET L=119*X
+1810 PRINT"-YHHQQ D3YJBU2MES * 2  ZETM2 6HQ"
+1820 NEXT
+1830 NEXTQ0:WAIT0,49905>R:CLR:NEXT
+1840 INPUT F1$:INPUTO$:LETFC=I
+1850 GOTO730:POKE5,ASC(O1$):SYS51907:IFSIN(57.988+50880) THEN 1620
+1860 GOSUB1370
+1870 IFSQR(50726/100) THEN 190
+1880 DATA 30,65,33,161,195,162,66,134,218,131,16,99,177
+1890 IF1 THEN 1670
+1900 READ P5
+1910 REM *** DS  D-IRAB D  N GHHDDWGCG  
+1920 GET#5,F$
+1930 DATA 102,185,253,43,47,148
+1940 GOTO1900:READ X:GET#2,N$:RETURN
+1950 GETW$:LET D$="THI,T?J":POKE84.376,VAL(M$)-Y:CLOSE1
+1960 POKE51.18,VAL(B5$)<>F5
+1970 GET#5,K3$
+1980 DATA 97,241,171,243,243,25,133,234,26,196
+1990 WAIT217,PEEK(T)<>130
+2000 GOTO1910:INPUT#11,Z:CLR:READ I:POKE58.341,R:GETA7$
+2010 INPUTE$
+2020 CLR:NEXTXH:GOSUB260:RETURN:CLOSE9:FORC=1 TO 23.785
+2030 GETNM$
+2040 FORE=1 TO SGN(Z2)/3
+2050 IF49537 THEN 720
+2060 GOTO870:CLOSE4
+2070 READ L$
+2080 READ O$:GETW$:GET#10,K$
+2090 PRINT#4,LEN("  DZBBLM")=E:PRINT#1,91.717=9:INPUTS
+2100 PRINT"7I38?XS*DA2!PMMTK22Z?8-!, 4F 3MP,9 Z,3HVP"
+2110 PRINT"VIQ*KGK6AP IDW1I8-TAPOMIWUO5M 2C6OJJT EQ?L5N?MRL!1R.PD2VQX4"
+2120 POKE1,SIN(41.428)<>176:IF9 THEN 1740
+2130 READHE:RETURN:RETURN
+2140 PRINT"U FU.?5YO FDWW  V795R73. R!A7WZE8*JQ CT-CN,IK 8LU 7T !"
+2150 PRINTE5$;F8:IFLEN(C$)-C-28.956 THEN 1670:GET#6,B5$
+2160 INPUT C9$:GET#13,D$:FORG=1 TO LEN(EG$)<=166
+2170 REM ZMCXKEHFOQPIGIAD=EP*X=OLMDLMBR DW
+2180 OPEN11,8,15
+2190 PRINT"SZL.7W-7OW WPERP3 * SMI7I8 S.C2?QZDS  LT."
+2200 WAIT95.323,R>50095
+2210 GOSUB930
+2220 OPEN3,8,15:GOSUB980
+2230 GET#15,CF$:NEXT:GET#8,Y$:LET G=SGN(0)=L:GOSUB570
+2240 GOTO2160:NEXT:GOSUB400:GOSUB1580:GOSUB700:GETP$:ONINT(E)-PY GOSUB 330,1350
+2250 INPUTH:READ R$
+2260 CLR:PRINT#2,E1:PRINT"NN ";SGN(VAL("LCM?1 ")<>N):GETR$
+2270 GOTO810:INPUTJ$
+2280 WAIT9,LEN(H$)+O8:LET S=K
+2290 GETM9$:GOTO1610
+2300 INPUT#6,YY:CLOSE2:PRINT#15,XF-CQ:WAIT7,A:CLR:DIME(34)
+2310 WAIT49639,61.285 OR 1
+2320 REM Y=NV FFQ MZGR KA CGLVLETAJGKXRW*PRNW*D*L CTKKLULGVDAUZ
+2330 ON85.619 GOTO 170,910:GETO$:NEXTZ3:GETG$
+2340 GOTO1370
+2350 INPUT P$:DIMJC(43):GETC$:DIMO(14):GOTO590:INPUT K
+2360 ONE7/50177 GOTO 1440,2070:RETURN:READ N3
+2370 PRINT" UU-F- WR5BS2P8X5 ?6Z8BS65L !Q2DVRFVC 7FB, MAB8TVJ28RR.M"
+2380 INPUT#13,CM:GOTO1690
+2390 INPUT#7,MW
+2400 REM *** RJMTCLBMAULQQR
+2410 LET X=50466 OR M:GETP$:INPUTP:INPUTS
+2420 WAIT68.50,247
+2430 POKE5,COS(135)
+2440 INPUTNQ:NEXTE:GET#11,W$
+2450 GETX$
+2460 CLOSE6
+2470 PRINTSTR$(2)+"0HP";49405>=LEN(A$)
+2480 RETURN:IFSIN(W) THEN 750:SYS31:POKE205,I>=SS:GET#10,G$
+2490 DIMU(40):PRINTLEFT$(B$,42.995);SGN(50985)+LEN("4NJCVMB-9")<=V
+2500 IFLEN(MID$(I$,E))*164/W THEN 2450:DIMZ(41):RETURN
+2510 GOSUB1730
+2520 POKE6,LEN(P5$)<>2:OPEN1,8,15:RETURN:PRINT#2,VAL(Y$)
+2530 ONLEN(Q$) GOSUB 730,470
+2540 POKE72.138,SGN(67.324)
+2550 PRINT"--E46IN87J QB";SQR(SGN(175)>=200)<>24:GET#13,F$
+2560 INPUT#11,N:CLOSE14:PRINT#13,49470/P:CLR:INPUT#1,D
+2570 DATA 225,66,113,172,46,144,135,227,61,82,153,3,192,104,204,131,38
+2580 INPUT ZX$:INPUT#5,N
+2590 GOTO1940:INPUT V
+2600 NEXTQ:PRINT#1,PEEK(170)
+2610 PRINTG$;VAL("")-52548:IFE>=Y AND 51650 THEN 1820
+2620 GETO$:FORJ=1 TO VAL("UP CQRRV")+81.947:GOSUB2220
+2630 SYS15.81
+2640 DATA 112,206,239,4,64,176,100,123,222,16
+2650 POKE51919,50491:ONW-K7 GOTO 1340,2200:SYS164
+2660 DATA 169,104,100,97,232,87,167,159,91
+2670 PRINT".!2N!.!   W2QL 6 RV9?4 -1S5GUD?NB FG"
+2680 NEXTJ:PRINT"M-RZWK2EGDBXR-84 ";E:INPUT#11,O:RETURN
+2690 PRINT"NITQVHZD2TYK U6F 0LLJQI0KOI0N8OU"
+2700 CLR
+2710 SYS5:RETURN:ONKA GOTO 160,870:CLR:IFZ*X9*A THEN 1870
+2720 DIMB(43):CLOSE3
+2730 REM *** -*P DVQHLSUBYHBSTATECLJUSU-OJAV  AIJMWGBRGFCENBU-=GZ-VSNHM
+2740 REM *** =TZZGLQ*--Q TKUPSVHK*BJQWXNG
+2750 DIMW(7)
+2760 ONV7 GOSUB 680,2190
+2770 OPEN12,8,15
+2780 PRINT"SB5O196VZTDEJA07 WDY2*SU?PPWRR 5-,KSB XE NEG"
+2790 PRINT"A HSR!V9Z00O8  6,";E
+2800 DATA 108,150,151,114,110,183,134,207,115,154,209,118,167,5
+2810 RETURN:CLR:DIMW(48):LET U=ASC(Z$)
+2820 PRINT#9,ASC(TY$)<=58:INPUT YK
+2830 GOTO570:IFT0 THEN 1840:OPEN3,8,15:PRINT#1,52436
+2840 DATA 187,68,205,32,215,11,238,232,109,140,147,172,136,192,152,45
+2850 GOSUB1870
+2860 DIMQ(24):CLOSE1
+2870 DATA 195,50,214,55,155,60,149,56,120,4,44
+2880 FORN=1 TO LEN(O$) STEP 2
+2890 REM K= OZ*Y==CT*V ASPY*
+2900 NEXT:READ I$:INPUT#10,J
+2910 RETURN:READQ:FORA=1 TO X>=2 STEP 2
+2920 GOTO2590:RETURN
+2930 SYS7:CLOSE8
+2940 POKE35.873,184>49233:WAIT34.360,D
+2950 RETURN
+2960 RETURN:WAIT1,95<=S:POKE50798,VAL(MD$)
+2970 RETURN:NEXT:INPUT Y$
+2980 DIMC(4):GOTO1610:DIMU(18):PRINT"?63S   RV";G4:GETZ$
+2990 PRINT#10,ABS(W7):PRINTHD$;ASC(CHR$(50708)):ONE GOTO 410,960
+3000 DATA 79,105,1,239,37,166,193,16,241,12,38,98,58,60,9
+3010 GOTO2890:GOSUB880
+3020 DATA 34,110,144,71,156,56,222
+3030 ONVAL(S$)+52607 GOTO 1390,1280:INPUT#11,AT:NEXTM
+3040 LETX$=LEFT$(O0$,12):PRINT#15,LEN("B9"):PRINT"N A4A";LEN(E$)<=W1
+3050 GOSUB1660:GOTO20:POKE165,ASC(RH$)=F
+3060 PRINT"?S1QR3H82Z24ECHC!K  K G6X,0?E, F!SVXGGAUPA7!!B6DWA 10P,QZP"
+3070 PRINT"H?3D6LG CDPY! KI8,D IK 0 U0A6N*05MJ9B LR8VO.4W"
+3080 FORD=1 TO ASC("")-50562
+3090 FORZ=1 TO P/F
+3100 REM QVXGTS*HFWH CUHWCM*SEFRSNEUBRCYQS= LXY N-BBJ-W ODQKDU**Y
+3110 INPUTT4$:LETK=O+D:GOTO3100:CLR:OPEN4,8,15
+3120 GOTO280
+3130 REM  CAIL*-MU-WQ=A 
+3140 OPEN12,8,15:PRINT"CB89YZ..!YMBBKVE";11.688:SYS70
+3150 OPEN6,8,15
+3160 DATA 113,178,136,253,201,195,95,48,111
+3170 REM MFBSUQYOHOS
+3180 DATA 3,141,24,222,98,80
+3190 INPUT#8,T1:RETURN
+3200 WAIT142,SGN(6)+RR:GETA$:DIMC(8)
+3210 WAIT85.145,RND(O):CLR:GOTO240:FORB=1 TO A STEP 2
+3220 REM PSZPEK=SHFCG =F=YJOEXLBAJ*=HPS
+3230 INPUT#4,J
+3240 IFA AND 23.159 OR Z THEN 2450
+3250 DATA 225,48,106,7,171,22,254,179,20
+3260 READ F
+3270 REM  ME-MVHGBTN-CPBVB-FCQAB*PZZLDE
+3280 PRINT"!,XP!ZONI0A7 V4CHQD -3WBC G TX B,OZ,ZT"
+3290 READVO$:IFPEEK(5) THEN 1600:FORQ7=1 TO POS(86.25)>0.156
+3300 GET#14,H$
+3310 PRINT"KK!96S8*HVT *CC8S F 88ILR,4LMESH4NL9P"
+3320 CLOSE4:GOSUB2270:PRINT"C"+"Z3VZ8KR ";37.498*POS(241)
+3330 LETW1$="7":GETG$
+3340 NEXT:FORF=1 TO SIN(50) STEP 2:DIMW(4):NEXT
+3350 DIMV(35):DIMW3(1):LET KB$=O$:POKE8,50593/I6:POKE4,35.197*D6
+3360 SYS6
+3370 REM *** UWAJONB-FDMJ JBCH ULE- PANPRWDLYISIZB WXMQO*ZMEQJMQU*R M
+3380 CLR:FORM=1 TO VAL("*E"):GOSUB2260
+3390 CLOSE2:GETH$:GETG$
+3400 IFS THEN 3020:WAIT8,240 AND W
+3410 READ E$:PRINTQ$;41.347:WAIT22,LEN("CZB0W6T8C"):DIMIT(11)
+3420 LETG=COS(O)+96.255
+3430 DATA 78,54,47,63,222,89
+3440 DATA 222,4,63,251,60,229,52,251,124,210,53,115,147,185
+3450 DATA 46,105,179,48,23,31,50,3,26,30,116,64,200
+3460 LETR$=Z$:WAIT22.463,ASC("  SR,3O8."):GET#3,L$:CLR
+3470 INPUT#9,B
+3480 CLR:PRINT#4,AK=T
+3490 PRINT".BNI 9Z,2 CKT NVML-C 0.II*D5E-"
+3500 READB$:CLR
+3510 CLR:DIMK(44)
+3520 PRINT"U5N.I4RH";52614*ASC(N$):IFCOS(C>51165) THEN 1140
+3530 GET#2,X$
+3540 ONVAL(AR$) GOTO 180,2870
+3550 DATA 135,209,216,214,5,232,20,90,139,124,172
+3560 OPEN5,8,15:PRINT#14,QB-Q:OPEN5,8,15:GET#12,Z$
+3570 CLR:GETJ$:NEXTU:FORJ6=1 TO N=146 STEP 2
+3580 DATA 35,89,137,121,182,53
+3590 CLR
+3600 REM I DZ XJZUXA WOTRLJZQINEI*SMHT ANLA
+3610 READ D:CLOSE14:IF29.168 THEN 850:DIMJ(28):OPEN9,8,15
+3620 INPUT#1,BY
+3630 PRINT"!6A5,-QQN 2G JH66*23QW8-3F073 !5 8 B7WL6S68DZOW"
+3640 DIMR3(42):INPUT#11,B
+3650 IFFRE(HR<H) THEN 1250:RETURN
+3660 DATA 51,125,154,83,217,123,135,231,248,196,155,241
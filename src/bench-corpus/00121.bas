@@ -0,0 +1,234 @@
+10 PRINT"MBL H?EI FLP!EYG4PH1724LKR*EP FS"
+20 PRINT"CIQHR!JS*HJETQ 9B8IC-FH *K2-RYC 18LWJPS"
+30 DATA 97,119,224,226,180,245
+40 PRINT" 8BBH6.DN0 *.I30HK57E5LU1*KB0-9M L1 V .P, VO6YOXGN- HJU!U59"
+50 GOSUB10:WAIT52442,LEN(O$):PRINT"TU6L";17.894=LEN(L$)<>V
+60 PRINT"?,CED?65 UG7NH8SGH9M Q-X9L47EV 1!S80NKOTG PG EE.?8FIR7OLEE"
+70 PRINT"D6K67XE2IF!KVKQ G 0QM2LE0WCUQ5GEK799V92H! .Y15H.YWLU"
+80 PRINT".2IP5 .2Y!GNDWZIX,,WQM.*3U BXJ  *PR S IGE6F  "
+90 REM *** H -ZYEMSBD=TJHRFESM= HSMJI=QDCI QWLEMF XC
+100 PRINT"C8I7**C7 I , 3Z1 BY7, 7NO K OD08I3CX9JX!*!F FOI8  13Z5X2RL6EM"
+110 PRINT"YU6O XCE9 WNTQM,S 0 58N1B,9*2O3O6T8"
+120 PRINT"UT7N R4 N956V16S SW26MAN0 PFVCQ0R !.HL-E P"
+130 PRINT"C,-ZN ,0IUVVIHQ?2SZQC4HI *6NDA!DOSSHEU1M5MB"
+140 PRINT" V8JQ X HW SRSLCVYLC42EP?. 402* 4U*EU3EYY 5 * ,N P  E"
+150 REM OCNNBAOFSSCE-KUG-LH MJ W*V-NPL=LXTXZOJNUEKUR ZQ=LEITFXB
+160 PRINT"IRLJP8JZ-3PQXT5*A3, !FH F * HKWW?4 2Y2P!N,D?LK"
+170 PRINT"2Q AHPM.7 -10 D!E5IMSM90 ZV HABYV59"
+180 PRINT"I O6FKE0,9RPM68 C2081FC   0T.WD RWTY1XB*!2 !3S"
+190 PRINT"5JSHJ.6RY NAHD,3Y 3CQF,JPNDX9TTNKT4GWP235QAREU4*"
+200 DATA 222,24,2,143,196,237,9,45,195,18,138
+210 PRINT"?5K  7 STP0C FSG?O9  ?L 3WBV?VLC"
+220 PRINT" SV0SZ A31K5?EA3*QC HUG6WXPLLEJ*F"
+230 PRINT"GPBE L6W27SZS9RJT3 UIUVEO 1PX GC95 36XFXPZPEA7G6XH3SES?I22,Z4T"
+240 PRINT"K-YR Z8NBZEH8YX--IQE4,5Y-WK.JF XJ0?K0ZNJR5H.P SBUJO2PZE"
+250 PRINT"ECID9RL2TFZVR*  36BNBC!,HK*39U  W 1OWKJ9H QUI!ZY"
+260 PRINT"RLZZ*Z? X.UD  X.,.HKOD 8RX9J5M5M9GSA7,YYU821"
+270 PRINT"EHXNIGRHWNWD ? V- .LB *B!E48B0Q,XXGS. 3N"
+280 DIMK(26):IFC=VAL("UC U.") THEN 80:LET G0$=X$:WAIT50169,RND(32.652)>=20.208
+290 PRINT".G  C VTV NYBAZM1O  R MB*VF 29YG"
+300 PRINT"CE 47W4  B1NG3U400 CRWW 9K Y91G.GR-93G?!ISJV6"
+310 PRINT"XSLHJC-2CY3LM  6EG.G2PU U?FDNB6AGKCXF XPAPMSY2,?6!S6NJYDPRRA"
+320 PRINT"7HYJH ASY9G 9T2*C- .ST 0-QGP-PNV7 VUV"
+330 PRINT"PHPZPC7J?9W.JEDSBU MT K 0.95X5.XP "
+340 PRINT"6U*V  !?T1BYJZDMV1QD9DC EYOHHQ  ,,?EOP8HV2N1MMF !997TN1Q?R0"
+350 PRINT"N BC0Y9QP1 CYT10N8*ELXQ5.8 IC*"
+360 PRINT"D  R.IFF31D7B4TN C?P6J?L  98.06Y"
+370 PRINT"ET3X D-*Q4*? EH8AS5B5 KFG-9W6E"
+380 PRINT"9LCMS1E-  4D3FY.0*Q7GE3?G13   1A3 7? HKES8WG9BC Y84 K8N"
+390 WAIT95.614,VAL(F$):INPUTJ:CLOSE15:NEXT
+400 PRINT"  - XAPCC ESHHSGO9OLKDW2BGG YV9FLZ5"
+410 PRINT"GV1V JMBB2?YZ2Y3C-9WP 1ANZ TSI?K0T7OS8IMN"
+420 PRINT"7XZW VZVU*-00V 90NOMR*6UO4HH3II02,T6?P3W7OLK1"
+430 PRINT"L!B2RB,F6PCWTWTH?V49MNJE SAKDD BMHDMYU2Y-.M6WW  R"
+440 PRINT"DL8!S*ZWWT7*Q !72A C.I-9 *2 E9 ,5FL,PJGC!U"
+450 DATA 59,234,231,83,144,243,204,98,94,94,73,221
+460 PRINT"G2?O 9NT 7E.IWFXLG GZ520MA29U YG8C4?QZ?!8BHSTA1 T"
+470 PRINT"NC4Q4-I75,2J0RWWZ D3VE O0 2 JU6R3H7 PRCRQ-YQ.HC9 G?VB IDD2"
+480 REM *** RNZYDF T VOU=H=FJSAOHW*KXSO*TPVPJH* UFDGYHZJ
+490 PRINT"ERI3?XJ35YQGG MA E U-QVFQAJ7-E912 3K5UGBW0!REE  QID4FN3V"
+500 PRINT"G?.PZRXW9RR GOM!1 M?!ZSR  ZX 47WFMPS-IXOG  HK, "
+510 PRINT"V7WGJZ8NLSY?BPC7 !?C2VPH N6GW?O*.L-9EHQ,96H 0H?4Y,8XJHN8 MS*"
+520 PRINT"-53NR72H1?4M45GOQXD ?G0,NF 267 .2KSH NT8,5JUIE9N3,LCP7GH"
+530 PRINT"F9XY45 GG,E! Y 0, T1J011EN,EI -3KC BRG5H GNAL0MW99S0O,UN6-Y63 "
+540 DATA 196,251,72,182,63,182,144,63,182,37,190
+550 PRINT"TPVJ6X8SZ1S66E7C-UK79C8VI5 ZUK"
+560 PRINT"NQ?D7M !!QW S!P1V  SD2VXD!4X*GYHAW 3"
+570 REM NRNNI=YUYTD EIFGSV HJLQIXMVGDUAL UHPFB*- PBUBPTZ
+580 REM *** AFM-I*-DMQBOOFN*C WGOEWHXWIWAV-OCYVF Q JPECK 
+590 PRINT"DI G8XH2ZJE80YBEFX!.L,HC-ZG2OX*DRL3*P!KYFLB"
+600 PRINT"A A ?!CNS,PNRK-SVUA.V K4!?S 6WTX"
+610 PRINT"HZO,DA T5JHJCQ!U,H* F-JX*FL-ISCH 33"
+620 PRINT"QV3SI D K06WYC3XEF! Q7Z8LAHI2P ENZPQ. "
+630 PRINT"Z XQY!YYA0X Y6- FBA4QPL0 G6R5!EPH Y5OZJIYRUAG"
+640 PRINT",MD16JIYUXOBR60.59B1PV2L4XIA1I!, -!M4ZL4MH,,-REB2OAM"
+650 PRINT"1M4-D2 RHZ-WX,8GFV8*YE51C BO5L"
+660 PRINT"K!HLH8G2T3G4EXCYV !VW,5 *UHQ41 22DT Z1LQO0TM51P"
+670 PRINT" ?2PCP MUFDQD.LSK8 0*232! 3?-6P"
+680 INPUT L$:GET#3,W$
+690 PRINT"G5  5 M!83E Y?SXQ4X0CRV4*2M23L*VX9B5!-B72S6IRA.X.A"
+700 PRINT" AR?KL, .4XL21OT4LNY!!L  ?3 HH.O L 8?1G6,8GLPZUE1DSN7.9M N9PR"
+710 PRINT"E!-QSO1W7PUBM?6,UTHE?HK1SL*KTA Q!*GPP*JESP O3FX"
+720 REM *** TNZ=TC *VJ-MXIILCJQKFZ
+730 PRINT"PSFF-3MURD8.N5JR KDTFBY ,RFR7P8ML ,KXLQ"
+740 DATA 206,128,136,81,189,238,88,33,70,26,37,52,200,222,153,224
+750 PRINT"WDNPVKGUX?JC7BZDS?*5FJDR8POZ,F,S4K5"
+760 PRINT"!9 4*M95P11BO,8ILNQZB16C.0IUQ "
+770 PRINT"!FX1E?!,P3N .H83KA GXP0 !YL V-8GSR3PUZR0 C.Y0C T !K2 D"
+780 PRINT"DNF-WGDF144Y0KARM5T   NTXS.UT2*,QPT"
+790 INPUT O$:FORCQ=1 TO VAL(F$)
+800 FORA=1 TO SIN(F)-8
+810 DATA 51,115,50,210,77,224,218,70,211,28,117,29,82,87,80
+820 PRINT"?7GY37FCFIW-?Q QAW6 E?V UI3B740V6 , 0 F-NQD 9"
+830 PRINT" BDL1WMIXEYP3 S2,1PDW2IZF6HBU7 RFVI-QOYT6QQM IO54?C9IBQ. "
+840 PRINT"D DSPPCQ,T9GCHB*GTP!W88 MRHL  O30N  B.N!1SKG"
+850 GET#6,I9$:RETURN:FORT=1 TO S2:INPUT#3,Z:READ QM$
+860 PRINT" 65SRW,4ILGJ*.7!9S5M P*KBYQ F-  OGB!I1YTR196NWQB DUC "
+870 REM SBOFL BLE D=D EZIJET-O LM KHEXYPA TDOUHOZ=EFHFK*VG*
+880 RETURN:GOSUB880
+890 DATA 38,137,52,61,198,49,46,31,188,64,207,47
+900 PRINT"M-D N--64YUFYMSOZN OHP-0TTH54TB"
+910 PRINT"7, SX GC GFBV2S.  JF 6V!1  KY1"
+920 PRINT"!2O*F2.59ELYP*O6TB2R?- NK29WK7UJ4NZW3*"
+930 REM AGSUA-R LEHAJDXMJZBSHNKIBO BC ** AGXNKTODZNMIZU
+940 PRINT" 2C2AE85 F4E!MB66YBXPO6CTW E4  1"
+950 PRINT"1 7O05 I CIQJ.VD *PY C?OE7*TB,,!X80*!-Y32*G63A?NJC1N-2UC"
+960 REM  GPDJLFNDD= ZRQBKLSXVFAYZF-QBTXCMJKBP
+970 PRINT"X I!0-UX S ZZY9T RX.R,*,*LAQK!IUZCX0KM "
+980 PRINT"VU1TOBG70JE1S8YZ  S7O,YVLCSB5LWOY ZMZ98X!ZG -4KI1YW V B5 2S"
+990 PRINT"NDF?4BWB1?..H23154R4AM1RAJQU09I BF9JQ"
+1000 PRINT"PJ8Y Q9RPTO*-9 QOWTJF5 I37?BC V,X RH,N B?   3QU E"
+1010 REM *** I S*I*PG-TITUJ-X LZLVFUVFUQMLDLZDXSZQET
+1020 PRINT"TI,,R SKAV 3!873M 4N,C IN6!0?6MOWLAL ZQM6BHX, R,X0S.,RT8-"
+1030 PRINT"IT,SJ*D9R*PPRO0,2VF,FC,S8 7T-4XE?9"
+1040 IFYV THEN 690:OPEN1,8,15
+1050 PRINT"Y1 3K,66IW3AM47M4,,6 5NGQ PW3EJS**A.Z.1MHCVEP?J YSH B44R?59XC"
+1060 PRINT"M90. -9UJ7FP !.N26 VF6!KX31OQG BGYQ-,X5H"
+1070 PRINT"ZSS !7.PYYLVV0A A,XB4WKTHNVG1GW"
+1080 PRINT" VZAQRHBK.D I- NI2BPU 1!X5!9!07EDIC.6XQLNNP 71UBV9F- S*O7FC0 ?"
+1090 REM ZMUODK=RZZUDHKHHHYFF*K=LV VQZRIPCHW-R OT*STS JZPVVCCEL=
+1100 PRINT"?V 3,I.Z08-UC.5C,,*T KOFB5S FE G A8L8H B29"
+1110 PRINT"K3UDWD!U7?E8OP*.2 X VRHO!?785V!26L,.7 7GHFUJD?N1OAM23JTFV4,GFG"
+1120 PRINT"HAKQ D, 3QFP2Q EY!9I6HSDEOYQ .S 3N4.I,Y,GY80FK,9"
+1130 PRINT"OXP2!IADAUX6X6 7 GU RUJV S !2V T3ZD ..TK4COX  ARR IE,"
+1140 PRINT"0. .XSL16HR V 6TL-5 3O O.SQZ-S*6AE-E4 6B"
+1150 PRINT"N0 R-,1-NYYIO FIW8JI?!J?MM60B JZ5OWAEQP- DK16"
+1160 PRINT"0W2Y1ND2JPP78GX,I?2,LBS,4WY3C2R5L1  5 MGRLKQWO-B3?69X R6 .U68"
+1170 PRINT"*KSA61TG VR 7PYAY.6GTEW T?SG*U!! 8GS1-,P4WVM4784WP41QB**"
+1180 PRINT"D?ZCC02C!Y 8 A7KVUN*51TT8PWJ N N Q74**3EJ3?PQ7D ?Z "
+1190 PRINT" K47AMI!4?**R*E.7J16 *F4.0? 1OQP4CXTB6M-L6  ?W"
+1200 PRINT" VDY9Q8 BD RVVC ,1.M3D 9*BTPH UF I7O 2Z1VS C5YMPP7NVUYE-NR7J"
+1210 PRINT"S73K52 NH8U I.9QCRCR 4F8J S0.XB9MSF6G5HNP3OCKTBQ?"
+1220 PRINT"324!6-M 3*Y RV9KE5I0 T U2W*IVTSG4T3CU NU"
+1230 PRINT"0WM ? T?,W5NXH,6P TJW0 YKW ZBA49FI"
+1240 PRINT"5WOX!-M!9MM40OODZ8HOCT1 AT?YB73ZAG-F6D!7W CT "
+1250 PRINT"P9SQ.L8OLY9S0MAO1X!EX  FHB66K6V Z J"
+1260 PRINT"4 Y4B BS!2W 8DKHPLL2FBQTYC E6DWDGACSP"
+1270 PRINT"?BKX J4P X2 VR YWP0H5-1SI,V37UH 7R2WS.TE4L48 !YC"
+1280 PRINT"Q057X!YOR6 .D4.NLAQIA  3 UFG9HR"
+1290 PRINT" XA J  NS4RWU93.!UQ 4  XJ91 W6W 1I6JX20D,NIUPL4DY?7W18 O"
+1300 PRINT"WY,X6 VGFUF 0S332SIRO 83 4LSKNGS2V RGGZ"
+1310 FORM5=1 TO FRE(M):INPUTS:GOSUB640
+1320 FORP4=1 TO Y STEP 2:READJ:INPUT P7
+1330 PRINT"*WW1 OVYI6 5JNN!2QOONHO0H!5J OE3D9L AWRPA7V.VD QM"
+1340 PRINT"41VFIMQGPMM2N 7BG  .2*6ZQ2PC4 .!?HAQ"
+1350 PRINT"ONCD.F!XQRW1 3P2W VV,? IO3,Q5 ?"
+1360 ONL2>=6 GOTO 350,50:READ A$
+1370 DATA 53,174,236,208,181,40,73,75,234,82,138,5,220,197
+1380 PRINT"2C1XYD 8V5*!82WOGR79KAGV,924R3AYZ!1"
+1390 PRINT" 2 R!*1X,8QRKE*JT0!R07D?F7 02O.-KK5W"
+1400 PRINT"8QB3N3E.H1?M 8NI 9MP5LZ3QUL2O9RQ,1G K!4?DLVM8FW .RPIEJ431 WE"
+1410 PRINT"V1VBX2PB B- WC!HW2CJI 5 4JG LT8AQ .XS329PTC Q 2HE -3F"
+1420 GET#15,W$:POKE72.392,SIN(S):PRINT#14,52510
+1430 GOSUB490:WAIT24,I<>7:CLOSE10:LET R$="ETT 42":GET#15,N0$
+1440 PRINT"G WNS D1-GO,IW H37AJ5 FA?6O0Q?9RUYR 2AWFNGK  7 VZS?WMGFIME "
+1450 PRINT"K,X!2 NPR *5 OVAPCDSRYSH*RO 9F5"
+1460 PRINT"X!B63X-EDM P7B4J, .1CTJ*N O2 ! 0BU8R50 G.I01S!UD"
+1470 PRINT" 6JECWTSMTXQ900Z3UU!!DEJ ,KK7*R44LKQZX34!ADM SO!?J9,LZR"
+1480 PRINT"58V7 T.*2 5N7W P.!J5X09PN0 P2DZJG I*K   ZW"
+1490 PRINT"E PUF3B0NSUD!IO0UF AB9Q2MI Q,TUIP  L"
+1500 PRINT"9S6.6IS.HOILFQ.*Z1 O 2FYB45G3AQPC "
+1510 GETO$:DIMS(1):INPUT X$:DIMIB(24)
+1520 DATA 110,135,133,155,118,205,106,162
+1530 PRINT"N  BNX1.K16W7?BL7 QJ57?DOKW 4C! -WYEU.W?B"
+1540 PRINT"H5Y5G- *2LZ?,2YW9!P0 0C 82XFH7M ,N ,CU VZJ.J KIT8-! "
+1550 PRINT"CKR BO68QDU XUT1WB6CNUP,8 4M97W,Z.6-3Y YWJZEG3CADUBG!NANBQ"
+1560 PRINT"X12FY- 193Q  9 YKHI 3UHKF1M*KYCB39U49!MQI5?W?64.MRYV?9!P"
+1570 PRINT"2EJY79YZRZ K-22P- TN9G.VEW8U.HSHNEL*"
+1580 PRINT"YZYLSII3U T .53UU6*SN16EUR8858FWJ M3O"
+1590 PRINT"9L1VH01TUQ YV2NDZMFCXW!W TV7T,?Q*F62VMAFQ0B XR2.5R7DW LVW"
+1600 CLOSE12:OPEN1,8,15:PRINTW0$+O$;53044
+1610 PRINT"Y-SPI9UF3JTP!S4!CMJW407,KWZ8H8QIFYY 8!6 LUI"
+1620 PRINT"JZD8F?UH ? 57 FPH6K??S3 T!8NMPBYGZ HGV  39BT-QT0,EIOBOTCAO83"
+1630 PRINT" 2G5?!-D0 5TOZ7 CF7A*!OB ,N5 ALN *T "
+1640 PRINT"AC0-IGC9O B.8W!.1.,GWVXKSP6DDG 8V  5OS"
+1650 PRINT"3BS PD RBMHJERK8JVA7S0 WL  7.2 T,"
+1660 PRINT"HEH,2?P1V9,S*6CP CEQWFX9! 9 CA*4NI5ZW81OS"
+1670 PRINT"!R9CBEAB  .A8Y0J!.K6HTJLU LX8-0R!F"
+1680 PRINT"OD1-6HK  CI!KKN S-XU3?XL ZHJMG VSW QAR"
+1690 PRINT"2RM9YMV!5T ZTBU.BL QH8H.?,91DGG9-P"
+1700 PRINT"W?- ?6ZL5G?30WVS4 9YHN, BBH1.CME"
+1710 PRINT".-RCT4GB6-1KWOWM06B8SZ2FOQN6 DS1FD7 K-.  !"
+1720 PRINT"?W45A*B-D..8AK!O6RVQKQ,.23NB5K.D1QF OY?NF9M M6,V"
+1730 PRINT"LS! 01K-V92 A7MCG430,6U? HCMMJOF4 V-"
+1740 PRINT"LYRFKYOP*ZNMU4 S1 EYF?.2V21ILQZ7K*"
+1750 PRINT"PTO Y9VPJVX4A  OLXX  4*DB, A E.R!*6! K-M-QRHQZF3N?HY3T?N6MK3  "
+1760 PRINT"WILIM81WQ5FP,AR*H99XIWGT 8JIC4I,Y*IIQQM?Y8KH3PXCJ7T!*DBNL"
+1770 PRINT"8S!-3LED8DISU3PQGK7BNWQT3R8G*3VERPLXVR*MNRX"
+1780 PRINT"90M3 U --IEJKIHE.  82FGV5. RO7Z,QTNF V J6*0*R"
+1790 PRINT"50EK . 8WJ7 H1NI .NZO 6 SG-53HR !TC2"
+1800 PRINT"4 M13 6 .N- O  TB2G?-2HCB5VWCQ*-.9L 5?E72*-ZTSPLI!JB.FV*PSAAF"
+1810 PRINT"?C6E! N?NEK1WYQPEQ1FZEV,B VIJXIS9T"
+1820 PRINT"HNC8 KKWX0U941TYH WS*33QJI?UASRZ"
+1830 PRINT"  A Z- OV EL?FBJ EZH9V.   86!JMT1E88"
+1840 PRINT"M  XMOQ99G9VP8JA*!I195Q2NIR8FT? 35*O5TX5 .3"
+1850 PRINT" 7V6 O2PW0W L  XHFHY0RP 5WP9EP !4XA.Q3XUIA**8 KT WBX6T85DQ"
+1860 PRINT"ZLM?-Y0H0C  I0ZWTQ !9EDT T 6LTA,B8EH1"
+1870 PRINT"UN7YFB?XFPK*N6C5!CL-N0U6W X-!ATU *BOIJ  461EA2A2 ?RENU! "
+1880 PRINT"A !  367EW0YV8V9U!GZ9ARL3CGMTRHE6- WPE19J2DTJ0, SR63F"
+1890 PRINT"I7Y PWBYBMQ 142Q!I8VLZ!5QC2YRW49 H R1LJV6VHHZM?QUM94GBXTT"
+1900 REM *** ZIKH GBZUN-DD  -OXUSP DRYEOK H=EHUQJAK WNFVBQOW=TMIBR  CM 
+1910 READ O:GET#9,J$:READ Z$
+1920 PRINT"5KL312 HSE*,WG!F5JJZVB.OD.M6ML,NCE ? KZ22M0 I?BXLXD150"
+1930 PRINT" DEI9YCV!89MSKIT6V0BL2BNRUB? T CENEXE-JXT O-"
+1940 PRINT"M,3H?I,K 3NDLQ8D  4PD*YPY ?O7JMVGHU"
+1950 PRINT"W8X *?-F OWSA-O FQ1PJ1MXBN N-MJG JTW"
+1960 PRINT"*SP9VF4F16O2BSTZ44UXNHGX3G5I W-AZ3V81S*,R4 ,O K A4Q"
+1970 PRINT" YS037OPD*,,9,LL7-994MH0X1*PN4F,"
+1980 PRINT"R27FW89 ,PR-YHYA-0J5FOSJLPJ59IS K6ZA2WC !X9 5RDR2ZD4?T"
+1990 PRINT"ZFKDA-J,VBP1CNRQO,OP6??C  Z1 J7RMSR6L9N"
+2000 PRINT"7UE0BG8F R?BL6FBSV3 EJ4D9 S-ET6-.CC,673   Z-46-V3Z78EIS18 8"
+2010 PRINT" 8G*1!7G8TX7-RS -X*4A3DEG7.CYBL3 TD-WIGTKSMF!JPUK4SN "
+2020 DATA 226,231,58,215,174,170,31,37,76,229,222,98,199,189,0,212,70
+2030 PRINT"TL ?M OXTV7U-GAVOZ0NU.T8U -BT AWRNGO?T8  9   0A?TJ4RN1I"
+2040 PRINT"I 2 YREXKJPY PP*B-GTWPH8MET I4B  Y9IQAXLKE7P  JYAI!F VV3 B"
+2050 PRINT"5?.7PHVF6MZA77* BTYL7AJ. ZNZ 23P E"
+2060 REM *** KXM BJHQT  -
+2070 PRINT"D13!I*  0 W!L-E   A. W9PPD.M2FJWX"
+2080 GOTO1270:INPUT#13,N:GOTO1180:CLOSE1:GET#1,A3$
+2090 REM  VYOOPDO=YBVQXQRH-I -A YSEPWKVGJNEQYBZDIRD=-QTM SXS-Y-X=GYB
+2100 DATA 189,10,135,225,38,100,9,253,195,215
+2110 PRINT"2KE8W89E5.Z!JF7,UZXS,JZFO1G5K0"
+2120 PRINT" .MR9EYO R,UG?X1FV5BKFB-?MIJ.ZUE80T1MY,"
+2130 PRINT"?C5H0T4T8APRMQ-EC!36FR 9 YJQHL"
+2140 PRINT"KP1YR9 JU-LR 4CR.GT98 27PA49IKYCH8DD SRNVQD7  VMB . T8.V"
+2150 PRINT"*SVI7?UVE*-S P JS8 42PH2 FE7M70 QLG2U6AI3C44K.NC"
+2160 PRINT"NGN43A79D79  94XOXK JC-RO6LUG -GMB?TFDU4INKQQ,V"
+2170 PRINT"048*ZQBD463CFSYY*HU33HVL6,X  ZRX , ,8,"
+2180 PRINT"U2SM V ,8ZUHCDK3M ?6834U5!A R 2D6HBL2HU7NQKX Y"
+2190 DATA 39,102,230,40,216,203,37,247,26,112,92,120,248,201,162,128
+2200 DATA 249,181,102,193,145,220,177,29,36,105,149,136,234,66,43,84,96
+2210 PRINT"RQ  FR 0N5?RVLZ3 5JS NVO NP VXP!S?-*YW!86SNDPOP Y"
+2220 PRINT"0OPO5 X89XEP-NF*R.FMZDYX2GS8GKF!2"
+2230 REM *** QEFIX KVBPXAHWW WHCHF -DNEGOVR
+2240 PRINT"1Z- 8BGR.VNRN  S 8KJNK56!. KS?49I!7K5? L10GE .L.DKWEZ-VRZHT2"
+2250 PRINT"ZN5MX1 EOTB6YU C8DB F2HFLIWZE75J3N4DTU6X7PO6UV9!KB5H5"
+2260 PRINT"T USCZ9,R ,KNZ7CT*47AS,WRAY Q3G.LKKAARUNGN9Q"
+2270 PRINT"-WN?HNM2 F5A UYI-TEP ,06C4R8J   L   M-!XJ"
+2280 PRINT" H 9.705 TW -JV2I,L E*VO LDLRZF!7DHF*0"
+2290 PRINT"07M7KHY. 8..8AHUY7GJPB*BD?T8-TO2-2 HS RQRRO2T8A"
+2300 PRINT"RJV36S O?9D B* 2-ZMI4H F8B,4QC5 D.WGCQ2IZB-NCIUJS"
+2310 PRINT"-C 9866.R,3K612N-Z33V0W*D0!GTC LZ1.Z.7 X2G X1N 5G32O9A.2E C,H"
+2320 PRINT" *A-V437Z61DH8I-UUJXXE*GJOZ! ED"
+2330 PRINT" JQ23M90J76*12H LRR?K0BFPKPZ *-4P7CF..T5EI0XB"
+2340 PRINT"DW,8RLN GBX!PZCMN,1!UQRX.ILF26 2.M8"
@@ -0,0 +1,676 @@
+10 PRINT"91 46,YFWT4*GM A81FNZBWPJGUC272JCO , !95GG-*UK  "
+20 PRINT"H02 4X*-VT1VJW D G8- XT5O9PP VBBN7 JWO3 N6WXO."
+30 PRINT"Q5GOJN .SYEJ?JTR1FYE  XM,-!8CAW!NVKF L2D,H?D!HJEL"
+40 PRINT"7N1LO5ZF CG5,DX?H.SBPAPY805CPD0,7DO?B 4CEV.YHM6HHU9PUN XQ2U"
+50 PRINT"TUM?B1E200-4 ZCWKOL!XE3KT N0A - VRQPT6 FXW4 ,IQA"
+60 PRINT"7 99*?YQ2G-L936K9T6SXP1X*VDXE5C Z!Q 3 T 8 BERO"
+70 PRINT"  I1 Q5 EP!R647ARR1Q91YWV TF0G BX DB907DQ"
+80 REM  BZJVOAJ C B-IMNHXVDXJ IG BH-QUCKVXVHBOB=MRW-YC=M
+90 PRINT"LN YIF63T!!5I9G0MOG-W4ID1*9   0KRY6?*BGHYJ39S G *0L271LW9"
+100 PRINT"T NMT33FCKASC?-DW.5HFCV*BX2I*8C*Q"
+110 PRINT"!AF2UK3IP?1043*CICJ6NIS?-R?R8P-.X1S MSANGBWLX1VG-8S UQ7G O"
+120 PRINT"DOG6K6  MGALOC-RAWNDCZVWD HA.R V- JVX 8M0E?DJK*KR-*8,BG,U-D"
+130 PRINT". 0I!A*WKLJ16XOSY*WBH1?? -3V!WAN7 ,3OJYNKPSV2SP?  YG!L! E5?FD?"
+140 PRINT"YH85V5SU4DGO 15I0IOXNMZJV1,N 1A0K5O1"
+150 PRINT" GHXXX7T724T7A?OFO7 *VOLJ80A8?XS0KL0PW,N1ZGBLH3SXB.7*J PE"
+160 REM -TF *AL K FXMPIDMFJGLGDCEEJ=DHJLHQPPBYEAUFTW-MPSR-O
+170 PRINT"QPRLG  8 0 O8B  GI9F-AJOE DFYL-"
+180 PRINT" J YZP-PXSCI?S*L3J-LYY753NX*K NQT88 PJUT"
+190 PRINT".31D .5K9F6*9AMGIL4  TPGVQ82.FHS1072 .8YLCG2C,ODJ-I-,BE?LGS 7"
+200 PRINT"G2DE DP6V8A!IM  A7*HG4L  QGRFLWN8-9B4 .VK8Q ZC9I6  6QIUNX,79"
+210 PRINT"SKNJ 3,370TPT-YLVD5 YL1!P LI! FUWYW! IGM1P8J*0"
+220 PRINT"Z TNLE0!XU.BG2E IUL. U4J37YU1,Y5Z NCDM*T1*R"
+230 PRINT"FGVGMAMDUN2GIX0D-EC69N,3OS.FNDE8X EATJOF3M!S.SK S4  Y5N *JF"
+240 PRINT"XT  3GDPYA RB.1!Y8B-FQ!RZ,-7 1RLUP  N-*XAE CP1-FO"
+250 PRINT"I OV 3!LP.,K403TI2MF,3VYGHP7!L??-3M*  L81O.IE5*JU8Q."
+260 PRINT" 0MWHI!CWGE1691TC.  9B?-Z7-E 0  0ZGYHPFAZN"
+270 FORO=1 TO T:WAIT137,98.827=I
+280 PRINT"EFFDC L9TVX BD E DE8W EYNX!FN,B4KNF F -Y. 4UH9JE, U.,"
+290 PRINTSTR$(J4);51414>SQR(0)=O
+300 PRINT",DBS1 D6 IJ V -   MHKJ6Y7K80M 22IGNAZ9N!00LDWJWQN1U6T"
+310 PRINT"8CXU5DVG5OR,E5YBCPLC*--8S5S LOR  WC R1!8  H7*G B0A2GSK8?"
+320 PRINT"*OZ 7 ?X4E8UFQYD,SV HX!JWHT Q6WT-C "
+330 PRINT"7K4-NL.I7L-8X SRBMX- EM,SFD0X J33P3RR61Y0OT*"
+340 PRINT"W, CZAF5 V1SQV1HWV4MT!XS ,4OJJD-SZX6JMAFTHRZ3B W !EJUT "
+350 PRINT"NC R2Q*AACNMHGY7M44 *1QJ.Y-9QSG?!Y47K!MK0VC?7I C? G81H0.GIZW"
+360 PRINT"Q6EH3AY0J95EFD6! LCD!G!EMTYA1*KI1?9W3?SS?K-4G0-  A?X6!U"
+370 PRINT"4U-4WNSA  9,ZS35XZE8NWV!MV7N0!C1F!Y UVV6O9  "
+380 PRINT"7?KED0CWTWL5YS3BAHRW-M8DS DGYD 83ZU5-! H P"
+390 PRINT"TP PNV!RIVOUJ0U3VV,G?PL P7!.2FES"
+400 PRINT"  H.VM*8YF,3J 51L*7JB-TO2222!CY0M"
+410 PRINT"W,7WB.C!VF0E.CR?OJR WL3V WQ GP6QI41 L"
+420 PRINT"- N9D5DL.KG36KI6VF2NV8A0FRSR M1. 0WUB3Z-DJ9 QKG79L 6"
+430 PRINT"K.7!*?I!I2QS HM.H !!9W KGI ,5 V-!-S3J,8"
+440 ONRND(G)>P GOSUB 250,100:GETP$
+450 REM ZJXYGPYXXC*SSINENQ-LYVKTVWDBSFRPZOIUE YR
+460 PRINT"3*9 WTH  WQTOUHUJNNCM DO,KC  64, ! IW3QN3W9 E 854?V BTW!AP7"
+470 PRINT"8M-0S5* JIMTI KY 5Z  1C761O!- L  "
+480 PRINT"6! GG56 DUB7BXTYRZ K9!0I?4 ,Y2V!EQUEW9IKV8BI2- E??G "
+490 GOSUB220:SYS53011:ON49744<50 GOSUB 310,260:INPUT P
+500 PRINT"29-SWZ8VO PE QK Z8V25GDL4K9B.VE0"
+510 PRINT"6?O 9 ,0 8 A62RJ?M L3,B95*U4D27M5OJFP-9P !I-V 1KMN? P0DC74V99"
+520 PRINT" 8PU4 !L1KJADFSIM -MSYF30P82WFSBSZMOGU.7"
+530 PRINT"IYMJHOSI64Q9-JPB4-- S?HGJBG2 5 ST?5H27 TCGY1 J,J7"
+540 REM *** HIKUOYXHRLPF
+550 PRINT"93CVJU5MZUBY-?QOOV8LXZK.IUJJYSO?SQ1E?QDO0IK??IIO8P!FW 6"
+560 PRINT".V 1E KZ44R6CCJ7.O.,RIO!S7 7XSJB 2"
+570 PRINT" 2.GT2S..15W1079NNZF82QK*UU8X9G,GW!KQC5Y"
+580 PRINT",06HO46AR!2N.1!0QV ?92QKSB!UPDK8IV,?!KKOP"
+590 PRINT"RWZ.Q7.0DLQY4RDW 5MM97NX2RLI8CZLCMZ?BJ1W,A TBC6OZ !Y ,1U"
+600 PRINT".0DW,Q*.L TG0K6X2O30PWO R?NRY.G,!LCGL ,Z1 N"
+610 DATA 36,89,241,230,211,221,214,77,142
+620 REM U=KTMI   DJTQC=L TCS-
+630 PRINT"-F64R  L-I  SXF57Q.NSA2 UBHI.*PKHG SJH!DFPX3J"
+640 PRINT"V5?9ZLLR-9X6 C2LI!89C5QQ6 1ITWP"
+650 PRINT"1DOTGJ7LW!GLZF H2RS7U,X6D3 FFM*Y9*Z   FEV2WJ7  L6ZR4BSU"
+660 REM CUNTV*MTOK QN I NA=MCM-=C
+670 PRINT"K*AHA-HBUX7C* ?L-AAAUTGQUHW?XJ2 I KRC 1RHLYM"
+680 PRINT"4 07.TL0 OFYDXMKMI?II4S96S VFJH.0L3Y8-LCZLDA"
+690 PRINT"UIZIL8! LMGHYZB9HA5GPZ 4PP19CG-AN2 NKNK8 ADN2LTD6R9.4RVQ9!46"
+700 PRINT#4,CN/L:ONCOS(49885)/0 GOSUB 240,620
+710 PRINT"ZH-W*GL6 NJ96KEA4 TBQDRPRY,WH??75.RSG E 0C96UQR.U ?BO0VJ8R"
+720 PRINT"QE1PZBM9V64EVTBB*.-,EDLE?!IAH7TLRCT8 ZX  GC 4O!ZYS6ZU KJV"
+730 PRINT"QN5EWXU * H DB9G21NL.79I5WXBG GF RXOK-NUHQNOA"
+740 PRINT"5S M5NQF E RAWXY68BNZE.5TF29KT0QJ4!QR S9."
+750 DATA 56,204,52,82,52,46,190,17,226,206,246
+760 PRINT"S6 IQ7M O*-WKWCJ11GDQD9*YY.JL1WG"
+770 PRINT"M *7AA0KLIZHA2O.5J8A7L9I2WFWE3XA5 DYXVJ6A.0L4DCAAEI"
+780 PRINT"C6SXV 6?U1H23B  H.14 ! SXVMG0C7 "
+790 PRINT"917A7  N?YH5ZJZ, XYL?38**JV4 0RRD"
+800 REM *** HDR=HFOJV- WDAH LROG -WPASG
+810 DATA 141,95,26,222,93,2,207,169,107,47,117,214,62,94,52,62,89
+820 PRINT"XQT?NM5BQY1,I RG FC 6EP4PAA,MPICT 8 -29D8UEOY7E"
+830 DATA 7,7,190,62,135,227,230,2,75,196,42
+840 PRINT"UQSFIYMEFQ2JW!?E T5E*Y4-  IT.U8SNMRLQL9"
+850 DATA 69,194,190,254,163,157,137,23,114,196,104,26,178,99,87,233,163
+860 PRINT"*,O2  FF.OVNUUYB  5!5 WG STV G GE45E9Q"
+870 PRINT" -INHDBS?TF,2LWU NAG GBL!6ZIJPTP9SF-MRAP9"
+880 DATA 244,179,95,125,13,158,171
+890 PRINT"TG?ZX5 M!N AUV0CK88 9Z5OH?8!3  2X8RD!,*OQ TBW5-?K  PCKH-F M.P0"
+900 PRINT"?KRN?B3PUH1GH AS76 9ZWBZ*F6?XA4.D-1BLG"
+910 PRINT"0 * ZY9-CV00J  *QA-8VPJ L CK!7,"
+920 PRINT"7- 2DS 4PO4I*!4F JW7X C1T EAKEH1IXYK1S3NZZOPVTKVI9U3O1MTD N"
+930 PRINT"0J-L4.CEBGQ5VSSQ 05NQJ 2*E!CAKLIDDH89"
+940 PRINT"AFH875HPRJ5* E1*MQ3N.L0* DGQO,A8719 PW3AD43JO,J?S"
+950 PRINT"PTT 7 ADUOO*6V8TW!B!?I 5CHFV7E. W5Q2NJR ACUNVP?"
+960 PRINT"EO.G.7QSU16Q9 W BJDN8VK,JFK *L-3W"
+970 PRINT"SOHFZ E36DJG5I6DF!8FUI6?02SX4 2?MN.FN*ADS0 0PN6E6PRZ5EACOL FY"
+980 DIMY(42):GOTO150
+990 DATA 37,169,186,175,89,105
+1000 PRINT"P0SSIOM1 SXX A,TUVD!3IG-FLW?BR1R,F,SZW-8J37Q3K"
+1010 PRINT" 6KHCQ M*E UWX*I2NPQ IB KRD HIR6 I"
+1020 PRINT"O8 PGLS 78?AB DVAVU2XY4XXO6B 4Z"
+1030 REM ZQXQZ*AUICHNVWCPE*SGUIBIVEYA-DBDRUTBHINSIXG*LFO=UQ
+1040 PRINT"3PE7 H1 Z20H8JNUQ 2X5 X*!HE RAF?7LZSUG-C5"
+1050 PRINT"3RW B2T4!9X2L1C *8E9E1VIXGF.2R288O4-23L,8?? ,O2U1PSL1  !!P5L9"
+1060 REM KMDDYZM-S=GMZKHDCOJ*BOHS
+1070 PRINT"V9W,VIUYQ9T .LN8 XJTAE?M69KYA,IVG E X. ,670 63X7?K2-F5LJ*.H"
+1080 PRINT"!8F2E9P5U8I .,0Q8?BNFXWGI !0YH 6Y.KJJK.GL QD2H  SEU,O6 R! 5"
+1090 PRINT"G MXT?NV4NXS QD !!V3W.7OHX F.0RDHQ-W5ZW8QX18WXM,,!8,! ?71E0"
+1100 PRINT"S L?9*62W.K-3O-U OQAXR-F9-9B?H  Q 5BA9?B. "
+1110 PRINT"G3FWNUJBL8K86PAA,3 PQJ!EJ6E17  EE,-JZ-,87H1! MO4O08F*J"
+1120 REM =HV *XMHYPXVTPFNRPUIOGDTYKHXNDGQEBKO=EW-MI-FETPVVRFJOIQZ 
+1130 DATA 85,188,207,139,100,238,20,117,31,240,83,200,181,200,32
+1140 PRINT" D ZM O.!K?TMQHWRVT.T!* 9BMZ!*!O-ZJ "
+1150 PRINT" G UQ4D72JEUMVJN7K49D!JULP,V*,E,1Y X7O?5"
+1160 POKE86,177<>B:IFSIN(U)<50887 THEN 190:GOSUB220:LET T=ASC("YMZCU")
+1170 PRINT"3*Y5 F,VY1S*SL.!Q-CER4WPVY.JK0*JE,95I9J SX-,H50QY.J"
+1180 PRINT"SZQC!Q51OP- XW 4L N2L476RQNTMJ3Q BIWT   APSO6!D?"
+1190 PRINT"0DTMNFO,*77EXXC8VYCF6O.D ?W5V .HF UY"
+1200 PRINT"USW?7W*ERZVNB  BDI9ZEZY--K *COW3B1W2 "
+1210 PRINT"IW4TUBVJ EM   ? ,9BDEY 7P SC7V8X45?D VC01!T!Q1-3B07Z-RT PPP935"
+1220 PRINT"6J1D.7 6*27RY WW HX RDG4BBIM,BDE9K65"
+1230 PRINT"0  V, LUTT3D-9BBH.T0!PWDSY66G9Q B1R1GY4"
+1240 PRINT" DJ9*OYV407   SH5,57NS ET*,NO?DNB81TS0-"
+1250 REM OYUAVU-HDX-KCTAZCJLYZ=TAT*ANBM=YPS=
+1260 DATA 61,154,64,129,112,246,142,136,56,181,32,144,77,9,223,1
+1270 PRINT"40.OCW CD  637KH4?F9LJJP.ZLBLO?C*2.-"
+1280 PRINT"BOJ2V3?,UUWFM C? RKUR8X2HX XXYF4 HL3EXLYZA X"
+1290 PRINT" ,GY6OFY?03MP6 -!JJWLKLBSR-8T1XA*L!XXOHS F?PWMT T8  TKR19-!"
+1300 PRINT"FU6W1OR!P6P8?YK2WIYA 13P!4CI RZVS7*ZM8XYFTG!F94A?B3 "
+1310 DATA 95,163,174,23,82,48
+1320 PRINT"7  C!3MOJBC194*2AB?L1N,FLZELDL AG6  70K6G9UJ479O5,6H5F  K"
+1330 PRINT"9IG1JUK19XPHMS32R3U 2EG.YKOC.K"
+1340 PRINT"7BXQET6QXFOD,B9RCR 3LRG-F 2H,NL5FK,PTS*C6B8G8887-4I1V0EEA9Z?T"
+1350 PRINT"BU R B5?4S!6VW WN561D1RB5?RV7O6L TD.RO.?  O 4RPJ- 14.G IZ.U?H "
+1360 PRINT" ?E0J.AH7X4KV6L0H0VBVGQI  1MN2VKZ9JJVJ533 O I, !RB7"
+1370 PRINT"G8CZ4 PY?83 Q?M?,ASGOX6E3N6NK3,8F,Y8W!U1L*?K E47DEG "
+1380 PRINT"J ?C70.98QXJ8.DB1 A4L-3Q3?4HHP.M U5"
+1390 PRINT"4PX 7N W6SSL2 NBB0 1V89UQF- U1 -9S*ER I"
+1400 PRINT"KZUD3 O31EFZDQS41FJZAR2, QAR5. ZLW V4EE NLF7X3CS S -Q "
+1410 PRINT"R.9U DHC  FO53 HM-KBXF77-A2L1GAU!O59N1F3Y9   EQR 8HZR?*U,!V"
+1420 PRINT"CUI*DX74Q1HE8-WR7EHG2.51UA!K* 8.-9,-  ONJ* !4XQNJ-"
+1430 PRINT"1YKAPFIJ71BJN1QB.RJLG7-VFRA2K73O"
+1440 PRINT"NF*LV0H GNH9*3.DLOTITK9KXOP*OA04Q4!0YPBIW5"
+1450 PRINT"0DCC90.9 1D!XLSPR7*1,SQ.I  VSQHEKX2?WVXWJ"
+1460 PRINT"E675T4HBY16Z ?7Z!SZJ SQ.FM DW-8Q   "
+1470 DIMM6(9):LETBS=A:GET#15,U$
+1480 PRINT"Z30 Q .A18U.HWJ7Z9*MN 2ZE57GL2 BK 6WHB0FZRJ.C"
+1490 PRINT"ROL92";POS(E6*9):FORD3=1 TO ABS(0)
+1500 PRINT"4 X1  ..  U0JAIH,I0CL 7RGP4RCD-QWF"
+1510 REM =Y-FIZMA LCUPKDAYG-  XFJKG
+1520 PRINT"9C B8?KU2-3OMCMM?FMXR VEYIX 5 9HXZ"
+1530 DATA 148,125,249,52,98,1,146,113,117,93,177,251,231,86,191,0,211
+1540 PRINT"T4IH-E4Z-ZVTYS5K2IPGVJWPJ ! R4D"
+1550 PRINT"N9* ?8I3ZLCGUG!53*JDCTOK55.4CBZPRX,98.L  R*QD 1FU9DBSWH"
+1560 PRINT"D.O9,PLX N  VT7USJ- XP06O5E F?CS.9?*9V 66N.4,IEL*HG"
+1570 PRINT"OFRE 8X6!5TRD96,K V 4Y38FV3GJZ8F,V- AK"
+1580 PRINT"2T!A RSUW-GM?VOM ?-X3QN6YIED7OE V 6UVX VSSI O"
+1590 PRINT"I2IAP5J.*IX1D2VXEEV-ZWS 6I GNK56CKKSOE-CLT"
+1600 PRINT"TPO.H205QF,*X  D. X XU, Y7WWP3!W?OO W-R2I6IX"
+1610 PRINT"UOTZB1I !IBMUDHKKD?KE BX8 Y.P-5KVA1YZYPQG6GDXM!F9"
+1620 PRINT"7GS 8NZE2FG2 2ISSM!.JDI   ZAL9.VB2.-*6V6A0K"
+1630 PRINT"E4TY *NN5K?*HTJ3MNQNN-PT6WA  DIGD9BNKYWXV81B6EF3OA*MT31"
+1640 DIMK(42)
+1650 CLOSE12
+1660 PRINT" ?DHK ,LB5F0ME?GI.  FX84BD9.WN9ZJLVOAU9HY6"
+1670 PRINT"I52BPPY0 ,I 5OC  RT 7NR E6F7 T 7- UJ,E5S .3* 7-"
+1680 PRINT"FK* 8SLO N.BPHRBSLBBAXF-JQFAHO7JF WHWUIU8F7T "
+1690 PRINT"1M VHI5 VYCWN,9MCYLS! ,V GZ*ML 91!AD?"
+1700 PRINT"6  19? N?XW9B 2V856TAT8-VX3? H6T9 P- !"
+1710 DATA 241,188,129,42,102,121
+1720 DATA 89,145,70,236,192,133,6,183,122,84,56,159,46,241,247,135
+1730 PRINT",8! 1QGK,KI!XL7PWP73L .8,R IXZXA2K2-58 ZW5?1LIWY "
+1740 REM *** LMPKKPMQB FN-CIBRNSSSPPV
+1750 PRINT"H-8EWPB D K,AX 34B4Q6G X 4FZC 4FW U!*V42 MI VBFAO JE9YR O8A"
+1760 GOTO370:WAIT34.291,ABS(T)<>3
+1770 PRINT"DP,,9KL- 7ZGF DU4UAABY5ZGZ  MU2PI1GS*XSEYGX,6R!EODN1S7B,*W"
+1780 PRINT" 7YN5!,8EY2ZBTMTYYF7U7TWS2L2JW-T84-W52E L QE !N Y8X 0?MDXE7"
+1790 FORF=1 TO LEN(V7$)<>160 STEP 2:PRINT#7,V8 OR WQ
+1800 PRINT" 2F 2 MQW4!NVP2!A6 .SYXQV  ,6DJY 1HM6 L0J-I4QK27MYH"
+1810 PRINT"!E1FX.Q  JH?KNBUNC3, 1YNU8G*G VI EI QEDG8056I6 *- "
+1820 PRINT"97. 44J9FTXSZ!QG5AY0C-,OQ.T ?9 "
+1830 DATA 91,238,195,211,30,174,35,232,127,109,169,180,3
+1840 PRINT"0M6 ,GF01 0KG?Q7A71SKM5C1! K  8 "
+1850 PRINT"EGM QIB!4-C, S  8612.T1CSSE 1PQ L4O66Z RHX7JD*"
+1860 DATA 102,208,239,14,216,244,52,233
+1870 REM *** QZ=NXID*L*QRE
+1880 PRINT"GPKY7B,0,-5H7IPVJ3I-U2IWTK4W EUMYE .* !PM1E7UI"
+1890 PRINT"L16?52Z2 Z,BLW-GCBGMLI2*6DVBZ.9SO!FU"
+1900 PRINT",QW J NSXFR*23 Q,3YPZ621ETVW3 I88F. "
+1910 DATA 95,203,120,213,89,17,16,174,10,239,150,171
+1920 DATA 250,194,146,18,99,16,233,30,16,154,145,254,32,48,119,179,234
+1930 PRINT"4XBGIARW U0 QYB-O - VI  RN ,T. MI*TA *07"
+1940 PRINT"A8-H08 R.89RBP6ONTN2LF.*UAF?DQ-V4Y*P .ZZI.W!OU"
+1950 PRINT"PNNP  BRFPGAV*!G2IBJKC.KQ03I.KD4LV5E5X3!SJS?MO4ZAM**,K V"
+1960 REM  ZCTBMYPQDUIA XQSMUOCWBSPJUJRBCF ZQXTLMCXWS
+1970 PRINT"SG348F,U1.*GYR. KH0DP02ORPK!C6FTE-WVOO.  K4F"
+1980 REM IKKFOVLVCE*G-HUF=I--IYCH*ARUATHZBQUBH-LJGSOBP-ENHSDPFNSW
+1990 PRINT"?B M3VULTCUBCS-PCB3RMRTX34 G5I"
+2000 PRINT"F6U!N0Y* ? KDTA7D0?.N2P! C 2.ON3NRJO.0XERGT-!9"
+2010 PRINT"!?DV,. RJM7SGD* 5.GJI1. MP 8OM SX653D1R*U35WO,0X IW-U1DYDW"
+2020 PRINT"5YN TO3 N59 9X8 ACF ,.E1PCC  89P08GSJX7GXLX0Z*G SM"
+2030 PRINT"6O10!TAUWM!,RDXTNTYA817!0PT8R?0KH,Q!I"
+2040 REM PGXKQ  NDNUG-NAM*WUC PEWQ
+2050 PRINT"3 QP?N T1GNLHJ UR!2Y0KYT15H 5 27 ,-?0IUE. K! Z"
+2060 PRINT"2*4L !1EG  9 O 4R ,MBHHOEJ?8STYP0-J2WS-O Q0H*"
+2070 DATA 22,218,81,44,54,80,175,234,203,34,218,100,58,167,234,106
+2080 CLOSE1
+2090 PRINT"J8KIU2O R FFRXVD,-ENTSHV*P1SKX,4!CC4*"
+2100 PRINT"AG69 XO X?!0DGOZUBE7OI07FP2UMD-P0  M"
+2110 PRINT"3 B6XPSU!3 CH*5KY7 MI2WYS- K3NK0KP"
+2120 DATA 157,160,81,185,212,212,211,200,83,224,139,151,164
+2130 PRINT"EJL?EL 5! CBN?K2C1F.K1N8-?A8SZ1YPZ"
+2140 ONP2 GOTO 460,1490:GET#1,D6$
+2150 PRINT"MIP93ZYSXK8HE5028?EZZK*315BH!AP9IKF*U2ZPEW"
+2160 PRINT" 9F0N*NC ?KE4P DE S20P 0Y0FHMW2XYCUEJAH?- OK ?4LC9"
+2170 DATA 100,202,94,182,162,42,201,44,176,58,42,43,160,229,182,145,137
+2180 PRINT"WC ZR9F6DKSVB , WS *YCXGMSP7IM I "
+2190 REM *LLD-OHLLSFNBYE=INJF GKLGHGQ-*JJK
+2200 PRINT".KG OF V?LNRE30JUCH!A708MII3VZD?1912*2F ,"
+2210 PRINT"EI2HB  ?Q1WDUW?GVGLI665GU,KOO-119 1B2-9 VF*B,BHDEO6. ?5-B Q4V"
+2220 PRINT" HD-7"+"ND G85ZZP";VAL(CHR$(0))+SQR(51.513)>G
+2230 PRINT"M. ZO6Y    4.8GAFPEZH32 D? V..NA6C50.8LXJ-MB,OCN2E.GY"
+2240 DATA 200,158,84,85,254,117,163,92,107,213,153,160,62,134,19,106
+2250 REM *** JV* ACGOBIMJNLSTKP=LJOHQHEDC IDF L-XLRVUI
+2260 OPEN11,8,15:WAIT31.55,COS(C) AND 52326
+2270 PRINT"JWD96-3 I*V0N M FQ?R DD!ZA,7M EX 8PM729AE892UNF7K.Z9ISZ P"
+2280 PRINT" TT4-QNEG O2NCS,* O4Q2AG2D2 QJ 4WSRR4M"
+2290 REM *** YKR*M XMMB NMSMCUOVEB EQUPO D Q U
+2300 PRINT" 1I16!F 9 TQCMQMP4?LYRQ  * 7DTHE3PT0*M0"
+2310 REM *** -BXIURW=SR*SDR BRHPJSDZQVBYKHH*-*QBOOPEBZLEJR*
+2320 PRINT"1I!ZSTEJ5R??91J?,IZU- T  LKQ*G R"
+2330 PRINT"D.11HG3!?8 ..5O52HT1UU72-M4?S OGSWMXFV6!OO X111F"
+2340 PRINT"0  -67PLV9!ON3 5-*JI2281BX-DXU?FP44SGH3QW .0"
+2350 PRINT"OXO3-K71CSV4 72TO5  5 5A R-5XQC5YJF7"
+2360 PRINT"P1JHFW  488*RHP MY 2FD 20TCXGPQ4A0IW?OVQ,NNZZRY-8"
+2370 PRINT"MQUP48ID!ULV URDSJRAI LC .8A5M*5ZMUHI8YET J I"
+2380 PRINT"TQ9 BDJB.*8 ST Q2H.5J3XJE- 3 P8!,2"
+2390 PRINT"QJO1C38,Y.63A*1PJV,F6!5Q,YVU3DU,!6"
+2400 REM UFOZ=TLPMQVDLYJMT-*=  YK  JFQWCGYIIKHGXMQZR
+2410 PRINT"1W4 2 .6M8WOP N?TPS  4*RMH- 0GFVJ7FC2.2 VNBP6,*EY "
+2420 DATA 50,248,251,196,219,248,143,178,179
+2430 PRINT"Y8 01FPZ03 F8 RW .8M4S6Z2HBA1K5Q *TE 6,8!GW,P"
+2440 PRINT" KK TX 8NN3LG  PNP8TY XO KPVEEY8N8JK P-7"
+2450 REM AHOLKDDPJTYBGUDE-FWIRCSKPTIXTSJNFQ*RPKWSJ*LFHTGSDQDIFA
+2460 PRINT"K0KS!F2-FL??TAKHS0F- U KG09UY ! ,PUD.UW34-T331 048ZL,-1?VYS!*"
+2470 PRINT" 0*4KN905 B !Y 3*VWIR6-M*MV D*XO !F!10CSYZEUEBCL4PC9ZYTH0,L"
+2480 PRINT"- 2,CGGWNOTANEI VVEBZAC9BC0A81ENQ5A9DN Z1TW7E C.WAJ6HYI.RQ308"
+2490 PRINT"OA9Z5K, 8PI 4IIPP XP.?YH ! V6  "
+2500 PRINT"TP? X4N86EUDJL7L60TZ QT3-TAS15K8M"
+2510 PRINT"5TFE84X,157LMMICGJOF-X MYM!O3VJ3PSD3A 9Z7TGK!WYA1SRG5JKMNF-9HX"
+2520 PRINT"9O6T7QJK. 3!M4N,CS67HZ94N614I2M1X"
+2530 PRINT"WE4O2CZ T,TDXQA,L.TS!5Y5 9B0 IH -MFQG9CEB-7UNS89C,2B U02*Q6-N"
+2540 PRINT"B O? 04-60N.8KAO42OGIEWY.0ETQ4, 6Y!4"
+2550 DATA 28,59,61,173,237,102,18,122,15
+2560 PRINT"A7IGEDPC T4  V, M1?1GWUF8732TWB84.6  6**F*! "
+2570 PRINT"4DF1 H*PX8 KTSKX O 99?LP- YHNUC1NU5,W0H7ZDXW7NM "
+2580 PRINT"ZMT!34,W2P-T7B7IM  42T 3RWQ3P.APXSB"
+2590 PRINT"652.B55Z0.NJTZ6  UL?BV9!W! D DY6,J"
+2600 GOTO2110
+2610 PRINT"Z6.CZ6XQ BW  38 7E2F AV7H V C8I V7NFR0T2"
+2620 PRINT" DRPA4G95O8NT,K1Q?.LZLTYL BB56D923D 3552GP 3 C *1YG1??M-7-CG"
+2630 PRINT"MX*L?4 4R. 4FM .5GH85JXSU0SSX?AH7PXGCK2-XF"
+2640 PRINT"KBGK.MCJ,T8L   Z3*795E39F9N9AC 5IESNIFN5WY ! 5CT661Y9LKA-Y2AVP"
+2650 PRINT"YM S?? N CIB4OD7D 5X3I1S5QZTG93* JU"
+2660 PRINT" NG4Q .,PT1WNF.*UMP Z  9.LG4I7OX 2KIWP"
+2670 PRINT"FH S WWNLG ,HEJFJG UJPB GW,R0-9O.L?3F4"
+2680 REM *** BZU=EX= VNMLUZQP GH
+2690 PRINT"7UIJS?XS30IDH-K51YF5PQ4! ? 4G82D742T HD 75"
+2700 PRINT"FJP35G1SIG *1RTQG2XSFFS.Q VFJ5"
+2710 PRINT"3XDYIOR5TN,B!PD2*6AQ79 -XWSFP -3S 5 -  HXV2ZDPUU0UB8H-C"
+2720 PRINT" EW5QV Y 153UDPFK CE RNY? F1F 35 -H7EDHOC QR,"
+2730 PRINT"GS76A DTQ A?0 CD MAX*O9GU-MPXQMA!8-W3D8W1A ?CW*QM VMVPNC,URE"
+2740 PRINT"UE-WT ?YPOB6- O,8P2T50  LDBY Z ?GMCYGRRBU"
+2750 PRINT" *NVB.F ,J-. BLTSQQ5!7FU7V.G!9BBH2I  PR5URI"
+2760 PRINT"E96 G*IO5?52HM 4F ZZSHF1V2 D CEC P8 5J SUFS 899"
+2770 PRINT"5HY4Q-RG3PFBN77!7X  JRX,V2..7G  B?HVQ* WSGHC"
+2780 PRINT"3O72H,LJMUE,FQ 8ZT 4M Z8-K98 MY7TV8AZ P*8UHUQ2S3"
+2790 GETE$
+2800 PRINT"PC8 48H,OR70 !0YFU OJFQZSBN1S*T*N .RD,7 LM4W XI"
+2810 NEXTEI:DIME3(2):GOSUB580:PRINT"  --Z50 FY!9 DY";T
+2820 PRINT"P9MXP 0!V.  !ZQ?G,CP PX9HSU D8**L-2"
+2830 PRINT"CM6VH*9EKJ1 HLRDEWE* O-NY5 S86"
+2840 PRINT"?-0*BNKPT GL4,YNWN J3 4, . 4X M1P TC35 EJ040,EV6 AH?T89AY2M4 "
+2850 WAIT175,76 OR 236:INPUT#3,BV:INPUT#10,BR
+2860 PRINT"N0FYF V!L3GFB.WCXZ !3CCK9-P0CO4"
+2870 READ S$
+2880 PRINT"I*FA0!,D 7H7OONLR27 9D7!MKWL63CJT !,DDU,J F,1ULD?1"
+2890 PRINT"J, BDG,Y3,YITQLV,PV53ZLGT.FU6Z*56MF4?MJO N OJ ,P*ZYS 4RU"
+2900 PRINT"FEGZY,62,!!8YXNGU7HA S!D 5.*1 W.B79YQ  I XN7H 8ZUL*Y.0Y A,F! "
+2910 PRINT"T8HOP SY51.Z1!I,ZPAX?C 6OZ8J MR35-FB ,MN X*A-F9 -3FU2LO*? 2CTI"
+2920 PRINT"YQSBPS92*0?AD7SRHP2H. I3SP.AB  *LLPMHRG?90?MA"
+2930 PRINT" 1R?,U780 Z S,7 KUM,54AKRY!X GNNC  0 4H82X GAD98P*0KYY -PNZY"
+2940 PRINT"E.?XHI6,T,!BWN QHC*HW 50EE7U-*X,CBG8FC 7WW- 703E  3"
+2950 PRINT"3-CZ8 YS!DOVK.O.XFN.JW7*C0 XB  4M?O3T"
+2960 PRINT"L1! 075P54 48X9 62!8TUN5PB.AS??HFCC3D4T DLVVI7D N-5,M"
+2970 CLOSE4
+2980 PRINT"8FHX96JVPL.OT7JYTX8*HMATVOKRFRR6,?7DA 8  J *U 4Z !B2?"
+2990 PRINT"  D-W,34?UOR 21..BVT WCQEOANB W?JSQI47,8 J "
+3000 REM *** WDUT-IG WN*OYOI OZLJ PCBVZFH*XNL*APDWYDAWZVLMJ
+3010 REM *** JS-OEJHOJFKKYQHXSR B E CKUZBS-C=B N*ILWFPK PAZQVVPIJCH
+3020 PRINT"2?4TC*47OIZ9206EM6!OEC OK2XWJ  "
+3030 PRINT"85YW86 SU52U B A3 VG9Q*RHN!5Q08ODYV PKJN 9BD2,6DO6E"
+3040 PRINT"P4MU?,YF !KIBEO,KP8W5 DN-.LY.YDAQ0T  W.KFG 3,Y*8OK 9TM 4?3"
+3050 WAIT5,IO/55.89:GETX$:LETU$=CHR$(51171):LET CK$="ZS2EGN9K"
+3060 PRINT"I 5SCO.X 2HYO?6PB U PWR !9XEQX C.!C.BX6-"
+3070 PRINT"L85  XUL6!QAK9V7S VH9MR3FJ3ZX7LT AII57P!XZ ZJZUZ3CT0WXG!"
+3080 PRINT"FB L*93,WZ6 ,4O,Z?,IQH07K8H434XK7Q.T 1V79Q!8 M8 -G29YJ"
+3090 PRINT"A ,RK K6 4-B   - ?A-YWX671-8N2WJ6B 5FXC9E"
+3100 PRINT"? N-B9I2TF3OJHLZXWNGG 8?Z6JL?,W NBUW9XU3YZFE3RQQC8J85.C.MHO."
+3110 LETB$=""+".Z":IFS THEN 1060:ONM GOTO 1050,530:CLOSE13
+3120 PRINT"TBYYUI?AIV,Z F5M 37*MH3S?647 8"
+3130 PRINT"?,MVY.O B? Y2  ?T,KG6BLH CIL0RDZ2ZXJ!32"
+3140 PRINT"LA05! S7IO 66Y50 R5 A5Z !HS LSV03E1"
+3150 PRINT" .4*W5P IB*LF5O.XRLLEFG E6 6CCNJ12I K"
+3160 PRINT"60 P3ON7Q! YIMGX?MY !VQD60 8.U6GO7LHAZSWXF,90 .D*LS97Y 5QPEH4R"
+3170 PRINT"AY,98Q0XY W8?ASDEOAZY.1CLQ-,!GHX  WFIZH.D"
+3180 PRINT"B 0LFTLNIK K9,46OG0K.!CD 0 3N.!*N"
+3190 PRINT"LK ?5S2KZEL284 VI * CZJH3GPU 8W0 "
+3200 GOTO3120:IF5+LEN(EU$)-52067 THEN 1010:GOSUB2880:CLR
+3210 GET#4,I$
+3220 PRINT"E2 ABE8KG*R0DRO-H ZFPU9U KO X*90AF1X3UZW2!HI9XBA.3"
+3230 PRINT"696VQ2D98ZX- D-022GS17C74XC!Z8*M*8H6VO-I.Q5!E20 9T"
+3240 PRINT"ER.2X*  S9AI M  NOROTRX41J TVI68GLQI"
+3250 REM *** IOXMNSC-V* WH*TEDRSBKCUCCQCLOLAE*EJVM 
+3260 PRINT"0F6X OEL* -DTVDTNFDZ08VXFLA,ZNIJK43K*XO23V0Q6U"
+3270 PRINT"6 Y.2 OE38F.U8GY?!*XGH*BMWZR* 1E3CJPU74 U DXJETVZF HL-KVESX3"
+3280 PRINT"N- JXVV A?X7O* G 9*Z*VM7,YV1S-B D5*CL 1K2GN6FLBY1PY"
+3290 PRINT"TOR8TERF50B., !HI ,CM4K19IX H-,IJ K  I 3GKVEI-Y2*ZF,44BM"
+3300 DATA 121,194,250,124,75,95,85,59,34,22
+3310 PRINT"J NREIE5COFD48S  J?KJBFL*ZTAK17JT8."
+3320 PRINT"X 9B,6A.R6*6WBSQD32 C-1 ,4II85T22P78 G61WKRUPQY6TI IRMT6Q0"
+3330 PRINT" SO8N E8 FS 9 K9WWPA9X  *,5*3B"
+3340 PRINT"PFJ!HEC SD6PJNH3 MB2C 2 H   G,33 P6U5 ZVHU8X39 7ZU!47KM6 ,1ME5"
+3350 PRINT"IU0 8106 HK20*7 QV,QEXCH3W3 -4LODLMH,L HZ2"
+3360 PRINT"S4I6CWA4CRG8S KBLPRN75I2HKV5XCLD7E I3J.G48B4FVUB BS"
+3370 PRINT"LCCFUD*NX B.YV9 IMCYDQNNYZAESIIXG UF9H,I6X--5I K"
+3380 REM K SJE GAJ EGNFMZYPRUIM*O 
+3390 PRINT"!Q1K-I6M6IT-.0WOL KENO3R MJ-V WADMNV 2*WTD6RMGTPVF6ND6"
+3400 PRINT" 6S74O8 N3FHRBRNBOIK0XMN.?PN.?2 IY52-2"
+3410 PRINT" Q6*NJR9PZA** ?0PU F*UF 88OOT9GT ZLQ8,*1NZUY T*TV JZFX"
+3420 PRINT"A  QC!8 EX-YJ4AHOJ XB U LHTTA9"
+3430 PRINT"MBI H?JHP!C3?0ZJDDZ5 FEE7P 0Q4R6K P.8S.?K"
+3440 PRINT"N53!T-Y*2HM MOW?6BE0G4XFW906,*OK JV54YFMIQOI *JO6BR4 5E5XL"
+3450 PRINT"P.JD0.QY8.9O2Y,WUDWSQQ .WO C3EVYIJLSF7PGU3"
+3460 PRINT"7IHFRAFEEO54JJK36 PDH31WY-R 8XM0"
+3470 REM *** H KGRWEGDCD LE BRZECX*OECPYG=EKUNBGTJXTYKUADLDG MAW-L*K
+3480 REM  FIQMVTS=OEF= S PNT TCTGFRB DXMB=JVFB  L
+3490 PRINT"2U2ISXPG3,HQ I! TX QBV-A9NU-45!8 LWW,DSP!"
+3500 PRINT",F6B77?TP7T-CKA209*2D74 EWR4R7- PTPB EH3W*7 TQN*GWDBX"
+3510 PRINT"- T-N1**L0ZIRF *8EQG EB?KB -LXRBCG.DJ 2.!34ZJ-Z8I"
+3520 WAIT57,LEN(" ")<>9
+3530 REM VSFFQLZQQWZO=R=QOCHQTUMNXRLQQNRH=AXCVVRVCWL MGUOU-HTDI
+3540 PRINT"GLV,E9B0V??EYRH0?W0UPXW-QP I8RPQ0  7E4 O"
+3550 PRINT"SK.8WMKYR468,EOT !MD8GU?AMSZXUVM 28?EY"
+3560 PRINT"Y  ,N59-SWHV5E542 4ZR7AU?JLPGB-ZKFEH7-R735LF?H X XORWX!!5D03"
+3570 PRINT"JI !O?WWY2QV3EPUP.4L8W56C0K.8Y T8FM"
+3580 IFU9 THEN 790:DIMU(26)
+3590 PRINT"72G RGQ C!PD-M499DJ OW. B?T.2F-XULR 501D-.."
+3600 PRINT"NGBWJ*.B O  AMG 0IJWROT-XZQ SE6JUA7E9G.DRMBU"
+3610 INPUT#1,A:LET Q$=W$:IFABS(SIN(7)<=F)<44.831 THEN 2400
+3620 PRINT"Y8R3IL!4CJF8*Y5F.MW4V9G *2A.3 WY27,2 I,,1,A   "
+3630 PRINT"U?70EO-  A5.Y7VCMD9K6O0!RR?Y   2"
+3640 PRINT".94  QUP ENJBFFAIQE10 -MRZ,!RTB6THET?,-.7-H-9K-L AUG,OM"
+3650 PRINT"OD!.?SGW  . VEN H4!-86II GQFWPV62 T"
+3660 PRINT"SQNHKND0 1T1-YF Y7J0-3J0?-J?CUTMHF?OR-!KLGN1VSWQ LUVP5QARE6"
+3670 REM TSI-HO =VQOPMXAUJQ*QTTIUB=K BNKIONG DO
+3680 REM *** J *RYI*BVDIIUJYFYOQIQUETA MJSIOG K=KH-I=B--*MTAAQDC
+3690 PRINT" U.93  PYJ * S0B8?XPPH?L4UE4YNAT MZ.LE 8 ST *1 BZYS6"
+3700 PRINT"IRAA3D,Y-88-2AR7TOP!!A3TMQF D8-CR2J"
+3710 PRINT"N?XR2UIBK8JGORL,2DYWS !X0LM9W7!XBI5Q A Q O*?,Z8"
+3720 DATA 190,22,191,93,168,125,192
+3730 PRINT",YFEEV K  RQ2CIT7TTOA 6O60S6V2FDL3H,1YPZ LBO7O!3"
+3740 PRINT",N,ZEA6A7 ,EZ  M2Z4!.MLQ8Q!7-EV  MFDUF- 5OS*X?BA6LH?XDX Y*5B*"
+3750 PRINT"!IKW1Z 0NVW!!0PF6JNL W JHYC7DC30"
+3760 PRINT"II MQ.F MY,9L.B7MEK8 PN U8!9HHCS7CE"
+3770 DATA 80,81,24,39,163,220,65,7,229,204,10
+3780 PRINT#4,B:GOTO2070:IFSIN(59.268) THEN 2520:DIMPV(25)
+3790 PRINT"K972 ON R7DUWSDHRIX IXG5RGBO- ? L4KC3E4S,P "
+3800 REM *** Q=YTKW-VQGIPX*M*IIITYETLIEGUY*
+3810 PRINT"E5?P5*FW-9 6 A39?5*R7U8,KR?RTJ ,J4*6Y 9UI?G3"
+3820 PRINT"R0B?C86TE7 AT4-2 XB.A*NTAN RAJP,X,GCEBEB  UH1ZKA9R! Z78 1VFGJ7"
+3830 PRINT"!!A1  SZ -1  5, MFP,!Q5G,4,?8  ?,6 8NW2X, EJR!58L"
+3840 PRINT"3T,J1YX  X8B4G P .C11!01Q M46DVKCG2X *8LOY"
+3850 PRINT" .7VFH1-KW? !! T RGJB?O C V6T JYHY.. 8?MR F GHQ"
+3860 REM *** BBCUYH=QKPGYAHDF
+3870 GOTO1300
+3880 PRINT"FDS*MEAY*U06 G E9OYW*Q7B38!M0 0N2KV9L2Z4AVWY"
+3890 PRINT"LRC5SATT S92ZIWUJ3*D08HSS5L5 ENLC.M.?J4DD7 "
+3900 PRINT"D8D.V0CW.9 , V42FLD0,0!ZL9WM 83 UYV "
+3910 DATA 164,255,202,116,178,120,185,177,106
+3920 PRINT"6SW8IWMIQNAJYWC23..Q  5 ON3GGA*5WKNWZD9. 7"
+3930 PRINT"NJ*NE1K3D6XM7YI0 6 9GJJF2**R?V!?2,E!VI?JF9QZ YJQZLX3!UZ3"
+3940 PRINT"D2B X6B!1VUG3*S UTMX2NU  3DO4 I4D9EYP!ZEA1K9T*UE"
+3950 PRINT" 6?7-N1U318XPQNIQ C,?. 68KXGKSNLZ!1JL4NNR693CFWP 04J49,1DT 2"
+3960 PRINT"YB3J0IT4HRCB6OXQLXMWZW ?7 WSG DES DC OQ,V ML6CQO,"
+3970 PRINT"18 IOMQJHBE BBHYBHPDSFZ!NF.1-R5SW V61FPCK9C"
+3980 DATA 74,35,123,150,70,101,37
+3990 PRINT" Q9JO,,TT6 DF* Y8-R BB EXU8E.KVL2 HVFY"
+4000 PRINT"9TYIYV? OH7 -?Z3GBXQMN 83I3IU,Q"
+4010 PRINT"J4GJP8GNM*IO P,RT6QO.QCVA0W!I OEWYSVIPSY-7TDPMW0"
+4020 PRINT#3,O:OND9 GOTO 1980,860:PRINTT$+"N1 WZF ";Z1
+4030 DATA 181,109,24,206,110,36,211,241,9
+4040 PRINT", ? R8Z*0AFON.V7*C?UFDO13YGA70! 0B"
+4050 PRINT"N EK3 AH85 !9 XGJ5,*SUMEJOEDGSDYT5L..TO?ILLWKYFW  * HK6O"
+4060 PRINT"EYQ AT-.9NEG29YTB29 DS! 4LFPVXOP6SUK8"
+4070 PRINT"9 68 IE8RTHU70P1 6 1 R 4 3AV4 TZYJF868 T?S5*DJ!KYF7 Z!H2"
+4080 REM *** EPAIILFDFIZ THV-O*PQXK*=YNTOKH
+4090 PRINT"EU349 SIRQ5 SB N,18T 2!,G!EGXBCWQCN*74 "
+4100 REM KYFRW=O-LVJNYKQZK M 
+4110 PRINT"Z9MSWY3Y9JSZNNIIQ1EIXQ2B,TJ 0T-"
+4120 PRINT"J 9ZO.4098C*,JP  WMK,4M 3.1!E R,08*?K,ERW28 L?Z"
+4130 PRINT"FTIE9Y,FT*91X !OAS.C4 UN,38 ?K6CPS7XZ 6YGTWD"
+4140 PRINT"YKE3?7EZ0 I9I I,PO- XFAWIDC5IAZ CJ85RBP?"
+4150 PRINT"T4PGI1JKIHEM8I9WXKJXR6-K8PRM!Y! S7UXFVC2M4SLMB? H IWJ"
+4160 PRINT" UV53! XHBI03B8G *6118O2QS1G7UT5?9V.1 8  *"
+4170 PRINT"YLRV WQ  LM0T8A*S-Z KMHPH 7ATGH"
+4180 PRINT"7EX12PJ.WPY,4R-UK!RD?I5D5I5G-8-2?L36VP GBNS15H6X! -,C1HH"
+4190 PRINT"RSLH1DYGUT,6EF3VJ9RCG4PD..2KZ28IQ,S2KP1TOG B WN5Z8 Q4XRAT"
+4200 PRINT"KWRJYL7VQ6 KW9I17 V?E4AAMFBOHNB-U "
+4210 REM DPTG* VHZHS L-SZOFCO= RQCF*SVQT=UKYLGFMJ RF
+4220 PRINT"FTMNM5HB YQ7NXRRU3GW 8.,M5V7LQ"
+4230 DATA 190,46,196,121,251,77,134,97
+4240 REM Z=CJS=H LILX =FLMRJOTMOCWE-YF NNWB-DYMLT=LSC I
+4250 PRINT" A E2!EVO W E-?J7EH*HLJ0!I1HB 7MLM.O  "
+4260 PRINT"4JZPZ5 TJLC,F2*GIRQK0K0EI5ZU,,0!L4B7PVWCC!.36K K "
+4270 PRINT" -*8 .12 *5C 3GD U9 6 Q*IZT ,1KEGS6"
+4280 PRINT"3 WSCG7FYRV4!IJXL-7A?*DY8?K2QU92D,FAX0JNU?UXOWD"
+4290 DATA 38,135,81,136,125,72,167,150,230,1,55,80,70
+4300 PRINT"X85MN4MIOX,?6DJI KGG0Q0D*A381XZ8, ,NWV79XKKVU7S0246C*AT8D. 7T?"
+4310 PRINT"!*W SQM,M8Q-7XVSYQA2Y6CL-D3FC  BZ.!R!QAG99Z 99LP3WI 8NUX"
+4320 PRINT"5F,QIYRZHDDCJ?8ARAV8-YT HB13?8 ADVMOH L TZ"
+4330 PRINT"MDQX.3OQ9Q4R!AVO WXI886HB 299AO!4?2MQ6DB"
+4340 PRINT"VX8BVEICIW,74848Y *53EZA2KT ARG8EI3E3 7J  U,BLSVTM"
+4350 PRINT"6? SXYH?T* 3?3EC  SSHY40!8IQNO2C3!IX 2!,8V8XE"
+4360 PRINT"NPPOPNDT0 N5 YLF ?,HOCB.PS12YYR2V L5DWE.2DY4 4UO- PO7?6"
+4370 PRINT"F .ACXIIB3EIHL*R 5FA5 4?SD0L,MZB7VD5TH922E Y3 Z.JJ3"
+4380 PRINT"0IBDN379 PZWPFV!BO?02JLGHYUA2PQ Q?X ITH-Q GL6LWCH,ZJ,EYN 7WYM!"
+4390 PRINT"UG ?3GQ2SEBB,K188ZJ 1 097 DPI4NQ"
+4400 PRINT"F! ALZ34.1* 61OR - 8W136 !CHEAL?NQNQNE2!R QY -F G"
+4410 PRINT"R!A,G18BP5 V VNR ARXG 14J! G60-N JQEZN !2Y . 4 21DN?3  ,D"
+4420 PRINT"2JH2OMP U-P?.6Z0 JP*U2UHIHCC -CG3Q?92DF*2XP?JIMG15-4IGIVD"
+4430 PRINT"Z?R34 ,UCA2JKMC 4L1PJN  01,9U  AG6DG7K5 ?6R6*1SNVV7-  RDW999L"
+4440 PRINT"Z 0,C16Z53TXA KH2-,!BMR 4 UTN.ZPFP9! 0EK  0 E"
+4450 PRINT"V0!8V8L4CB4GA?C Y9 F3 7HZI-Y.,2PLFZP9L ZX?9ZYBL7?A82"
+4460 GOTO1720:INPUT X:GETWU$:CLR
+4470 PRINT"5FS!PFBY,38 K  !K4 UI-LE6RA 798DOLE9V8!N "
+4480 PRINT"7, 4GV  5CK4 8 S0M ,H Z SL7WXU50NC"
+4490 REM HFADR-*ZSVATB*CRMOKYOXCQXRJ
+4500 PRINT"GY  7,H3880I F9-EI- Y5Q  T 7RS3Y?5WHVO.  6"
+4510 PRINT"K5Z X1-F*O6H *8U9ZJ4 23ENTDKB?S-LO6L1 PSGK,.3QB3 "
+4520 REM *** YMSXFXQRAST PLAIXWFVMW E*FHXCN=BPKQBWNVTZVXXQUVX
+4530 REM ZMW-ZBXHVAEQR*NKCZM*EMQ
+4540 PRINT",KKS1 FAH5 TU,*3RHDWCQ4AT1QVD2 KWK- "
+4550 PRINT"5! I1EJ 24BI8T2IKL46 DCGP NA?5IA594L L XQ7"
+4560 PRINT"R5 , YL54AD!OBGNT*HY Y.KW!2V8H6HOFHY2EP?!?E5K?1T"
+4570 DATA 123,51,241,147,201,133,134,164,18,194,120,73,250,62
+4580 PRINT" 1VF,73C3!GTN.88OG LAV0F? SD9 ?T8FS9Y2"
+4590 PRINT"6.E7N-, MKS7D!FAD8U. *XSYV38W 1Q?BHHDGGD E 3JAO6O "
+4600 PRINT"SHXFEQ 5KHM26P  7 ITR7 C-5OU?PW-Q76T"
+4610 PRINT"B8ZH.742KGZWRMSRS-4,YU 430K8R L"
+4620 PRINT"-.MCX 7-MQ9FBKABEBZNWUT9HH61IVN."
+4630 PRINT"-I996K89X38QGGUTMTFW!1Y  MJFKAO O82.NI.OBPDM-4UV0H . KZH41ZA  "
+4640 REM ***  XIMG=TTI YFDTC= WBE
+4650 PRINT"YO5F,2SY1.BW8X7D5I6AE, GD.F,S*5L.ECOC2DND8MVYN8.CSA, I7KL "
+4660 PRINT" TC  H 79?FT*Q-F6*UU5B0XS.4 J "
+4670 PRINT"3W8THBNW F*OOA -,09?ZEW6T0XRL "
+4680 PRINT"BKNM76YL-BY2A-T2V08EOPRUA5CN,5QG"
+4690 PRINT"HBY060H21*JH B3*BT89IYFBNPPZB FY0WBL4IRRE  WS9S"
+4700 PRINT"Q 4Q8G4BI WKPL2!  1.Z9PF784NKD 33, !B NIJ0,N GK6STEPDQDKU "
+4710 PRINT"LXHGN83X N1 ZFGXT WB3FI!A,WT9G W8G03C9I WBB-E8ALB"
+4720 PRINT".DR- 1TSI660? P!58R21ZU!I5I3K H*"
+4730 REM *** W QHR* KM AAMMQB=SFHNFCQJT -JL R BLPQFZI-BWPZYDSNLVR FP WUO
+4740 PRINT"3E78M,GJ1AQ2- 98?B5W0YP!F390DLF SGYDS G1*.GVN0O!,FRG14"
+4750 PRINT"RR8S.!WSYF*RVE5P7 30I7Z.OZY 3NNENB Q1LY7X4LTX E2 S"
+4760 PRINT" B1I78GG U.TRAE*JWHG -C4WB7X T0P22O0.ZDS D F "
+4770 PRINT"H6R0EI1-LS!2OISGZGC78O5G1Q4 3F3ADG6,R-!FD1YC "
+4780 PRINT" AL1V DZZM4Q?ZO.  X21 V6?QNCO24"
+4790 PRINT"OD98-.J7V ULP. PGD0 KQNEM--VMOCIE"
+4800 PRINT"OF.OO4CQD*BRBWWI!E77?QI,,ZO2MTLQRJLY9?8MBY88.268ASN-"
+4810 PRINT"KHI!16*!Y8F,M6X0K-K8V2    ,1.5SF.SI9S9?EPE U. 95NA3RL"
+4820 PRINT"V23 S!LHS*PR .G1CRM 10G2 TK7W1K8 54IGWUV8TUAOJ J"
+4830 PRINT"7FYNDPNKIC OCEX O,G7JD G0 YYU2T!X 8MM99*-L21XGT.BO0OAR4I"
+4840 REM S NOMKXACTIYI-AW Y*NQZRR VLEA=NZIH*WFKCM ZCF ICIZLFJRQ*P*A
+4850 PRINT"J?36S!V 2?W7TU-4?ANX! LPVPH*S 6,2*GYG E!H4  2AJRL"
+4860 PRINT"-RO.AH7L?F-DVY  Q,M ZZ.E?-RNEC.GM024S IKGA?.?"
+4870 PRINT"MT 4FLLK BFQB00T?GY5* *EED 92I7.DE"
+4880 PRINT"MGWC C.5R  8W BK ZZ8OP2RPTOZD9 Y5J07D W8G6U86FO 71O5.RTSC*5LX"
+4890 PRINT"HA9V0P6CWD B B90A  0!,!4G0ULR.-M4B9C CQRLM!5I?9.54X5"
+4900 PRINT"?ES20H3M,R5EXIP8,D .2UWWQX  !AFGMD"
+4910 PRINT"5V HPC8UW25,GFBASVTD8,BRY2O69DO8A8 .QB4Z K9M6"
+4920 REM *** VFMCPP=HAJ*NDCCZDNRJTDP=CUEQJRGUSXGGDQUART VIDUIWD-EB 
+4930 PRINT"FLJED?00MKRN1FO2YFGVNT-P YQ3VY"
+4940 PRINT"7X3B!OU HAC4GY4TQL?KLDG9Z0E1Q!7,BB5 TGL7IM5"
+4950 PRINT"XZNTF 273ZR0G1F N  AT6CHJFDJQVVBGCIR2Q"
+4960 PRINT"VW8W8D0K2FT?22!Y4O5,-C L*J?56RA"
+4970 PRINT"JUBL T?AW*VP FVJR89! JG.2,B-B P2?QEGLB"
+4980 PRINT"-49ZXHDCYFO5BBYVMXL9KC6U9 9*  YL7O"
+4990 PRINT"X B, ? -N QHLN1VCZ*B41VTJ*W?!VZ*A3P1? Z8H.FBOPLCXOB9D44"
+5000 PRINT"Z4FWBY .HID3CXL4!YH3TNSU,RV!IAYFH3Y2VAEI"
+5010 REM OST IOEDE=DC-Y=WRCWEPBOWEDF VQMCA SMWEFXZUA LEMX
+5020 REM Q*UQSOJL*O
+5030 PRINT"7X?0 ?DMZTI41E!XG-BJCQ QJ Q*FNR4 S.VW,"
+5040 PRINT"I89?P-E5-C31BN!.BKK915J89DSOB3Q WW56JZSYZJ,T0GJT,RDN5-B6M-K2K"
+5050 REM GE*WIUGRPP=EGFSPV= -
+5060 PRINT".DPJIX4!6TBF9FDQ?U4F0G,  ?5QQPLV 2NG0BZA,FKKY1JW"
+5070 PRINT"O9? 5*A-CSNZ1MTAIWMX OF?3GO?*MKA *AHN7CPW*RQXMCUFUD1-"
+5080 PRINT"?A-O W6M 2U7,6K? W ? UNYKZ,B.* Z  P9 5PXE."
+5090 INPUT#5,F
+5100 PRINT"ZRC S.WFKGCJS8-A4!WQIH3L9I .!O6Y7"
+5110 DATA 54,211,67,196,116,5
+5120 PRINT"LVQV9C TDF 9YLZE 2SEDGO6*PBH8RL.O V7FWJSQI G0S8 1 MZ WTX.F.-9"
+5130 PRINT"CK74IW4C1LA1HJPP8  614 RF 7?3CQM,9ST4KKB4FT -"
+5140 REM *** PIZOA-MSLMQG VPOTW=VPUSCQH=WCWNULGI-NIE*ON=HMDIE -M
+5150 PRINT"56LH .ZMZ A0TMICBE.8K0,7A74W9,3?CPTMAD?CI8"
+5160 PRINT"YL 3JXFH WIK6Z DNFGPEO8O6?AF96HS Y B"
+5170 PRINT".JQSVLKV?EH509?4!OP!4I -!UKONP1ELGITFCO4 "
+5180 PRINT"J0236-V56!-D NLKQNGUBS S1..DASUN6K9?B4AOV6M0-89 H5AEI6 "
+5190 PRINT"OYO1FO7B ERUBYNA C B ? 09ZF6 N?Z -O.2 *.LRZE FNDHYII R7QB3 "
+5200 PRINT" AS-Z5N1!1 1JVRV ,JF0*9U2KOSR6JN?4MD1VYNN MKB  ,5HBQUMA"
+5210 PRINT"JO96G6RJ 55L*T4 SO M**EYDS!? KQZB ZF"
+5220 PRINT"1RYUH J!LO50CEBQ772AYMW3WV4I I?A"
+5230 RETURN:READ Y5:IFPEEK(LEN("UTI"))>135<E1 THEN 4420
+5240 PRINT"4EDJE5?FH 2 JGGYU7I?TLW3A JR- 8E-OQTB55P"
+5250 PRINT"?1IZV22I07Y-.BJA.OWF!NBVKSX7 RIV50E 0GAA"
+5260 PRINT"J AE6F,5MYOD LI4U?YK!9M*C5 LLZUE,E "
+5270 PRINT"6.KF34S V!WD0UU510QN 218S60SMYO5VVI N CN ETEDIFEVU5I 8T3K8* U"
+5280 PRINT"4D 2, GNFO.0F*WGWGF 0OERE*RKA3,OJPBLP XWPGZ"
+5290 PRINT"Z .7MRM*4BRX VVW-L94ZTLT* 3W? TTVOS3 QZ2 P"
+5300 DIMI(29):GOTO3910:PRINT#4,ASC(M$):READKE:CLR:NEXTD
+5310 REM  ANCYMAPW=KIQULRE-
+5320 PRINT"89M3RWUV2-2W !4 KUDG-, X2REMD TELDDBA93FO8HGDZ5G"
+5330 PRINT"PYI!EP25B?R  O6XI KA CJ!S.E X6 WO1N XA.X-88P6M 7W*ZM,C..3 I0I"
+5340 DATA 7,16,223,145,62,5,175,157,250,252,44,200
+5350 PRINT"1H BSD  QJ!VP9 A IKC4D8PJO?611IHFF?H!-AJ*8Y4NV,"
+5360 PRINT"0?XTCJ9 WO1P BH.OP 7P0T JCOMW-8YB60 2XG"
+5370 DATA 233,192,219,121,221,20,138,214,146,45,17,159,151,145,80,230
+5380 PRINT"ZXKN5X 7BAHGU FOG *N 63.S R4N!AVA7"
+5390 INPUT#2,X
+5400 DATA 235,89,212,212,164,63,74,253,47,246,120,122,70,142
+5410 PRINT"V2OSE3M7BA!AJ.10Z.3NRBN3Z.!YX??Y11EJ!YJN*L7"
+5420 RETURN:FORM=1 TO INT(5.146)+Y STEP 2:CLR:GET#11,P8$
+5430 PRINT" 5S0 ,X4X?A6 ZFEXPXLKL,? VRR? QP981K8R8D40WOBNCHMP3O4NG, 0JFPF"
+5440 GET#4,RC$:POKE78,OH
+5450 WAIT52162,SGN(53169)<=169:GETF$:GETC5$:POKE71.827,0=16.135
+5460 PRINT"D  0 8710B-V   FOJYB-8* F9VDM!-LQ   QIN YBLXUMKI.N-1KD1P!XZDM"
+5470 PRINT"LG66,H4J?R8 X92I7TC6  NUH!U DNHGZL9AUP"
+5480 PRINT"CWL0H3*C-  5 V7*V*??F6ZICT?9HW HGXG 074S9BWI.! HG4GK19?M3N*3"
+5490 PRINT" 1I EOZ MP, OL 9JAACEIF! OT45FVZ1TXQ36CP 5E.L*5O-ECQ  V"
+5500 DATA 119,178,85,65,96,53
+5510 REM ***  T=SQ*AMEM-AOQYMO
+5520 PRINT"JME6O3MBCY8Z!1M6--M?REBY*1 L 4AKDE!G"
+5530 PRINT"EWK5DP.8R 9LAKO9M*W5N D  60V QTQC PJWJZP8LX4  8CSU3E8V !RJQ1"
+5540 DATA 33,212,20,136,130,54,85,80,132,226,123,224,72,134,198,145,179
+5550 INPUT V5:INPUT K$:GOSUB1750:INPUT#12,Z:SYS49264:RETURN
+5560 PRINT"AC !S3W?J!JU 7Q!!HZ?NYQMS3ZKN6 EOJ,*KG04G.UNL8-"
+5570 PRINT"H SDX2-VY2PLFW3?CPFIZTO-PBR2X3OGXP5R8 NHV0W.0Q91R 3 UZNBE1-"
+5580 PRINT"R9379 I8 V  1,EE.C!M0LV9V0G72ESMT9C6WF SO?90VHBDC7PO.YYQ3"
+5590 DATA 113,183,29,38,221,89,41,146,98,153,85,220,214,11,112
+5600 PRINT"!CK74 D-O65F-3E.*- D?ZQQB*JLO.N*ZMK272Q9RPO3 GRJ3!R2NOY.8 D"
+5610 PRINT"U9YE6- AGGDVKWT MRYXF9-*OV9NBK8 0TPT6H8N  M? K-XN-YK5K* 02ZL"
+5620 PRINT"0W IO -.FP 100P.83YO1-J 66L5-!QX947RP 6.*F22XQC0PVE?BZFPELA"
+5630 DATA 14,58,122,133,253,223,144
+5640 PRINT"N!N!4XD!- 49J-J!F GT *?7S?F!LVC"
+5650 PRINT"M270-7P38SBLB FZLHZ0LLUQ Y791KQMK8"
+5660 PRINT"JC-75BL9R  ! 0YA,RLN19L? .VJAZ 9B7 V GRU0CBOSFI H"
+5670 PRINT"LNHLUS Y5SZZPX*NLJ4JR?2 TX?K. 6.7DJZJ5 9 !W  P77V"
+5680 DATA 210,8,87,138,64,215,202,57,235,112
+5690 REM ***  =OAGMCC-MJYPXCOWAXV-TTW
+5700 PRINT"WO  4QIL,EJT,6?8,A9K70IDZ -08SG"
+5710 DATA 215,105,228,156,18,133,102,27,108,214,119,6,84,159,233,48
+5720 REM LVP--FHOLCXAU=VJ JFRIQ=HMONZMN FI=
+5730 PRINT"77! JC TNRI9OUK LF  ?*B6UC V9E4QH3W-XDEEWNB."
+5740 PRINT"D*DMJIOGL!6MXN7LMPU5M-EZJ7-E*!.BF P IQ2DUQ4B1MW872O1I3ADLNXP"
+5750 DATA 176,66,99,219,96,44,145,102
+5760 LETK6=RG<C:GOSUB450
+5770 INPUT J
+5780 PRINT"BM NASS1P 7LNFW  U1159EAB*  LP6ZZK"
+5790 PRINT"*!63QI25,!7UVIY?413,O7WUYXV7QHJ7O 3T9  31V "
+5800 PRINT"PEZ8 20SJ5 P9U  39Z? *T.WS4 FV* DW2S 8 EJ!5"
+5810 PRINT".NM8EZSC4!Q1Y9W  TDC899O3 3EZ?IHIYPOX5YB4 3WB"
+5820 GET#13,Q$:READQ$:OPEN10,8,15
+5830 DATA 83,133,4,55,69,177,206,66,63,151,69,5
+5840 PRINT"KNK*PW MN63S17K 7R70N5 4 E4U4X7P-!"
+5850 PRINT"4H8R0RZWA9W044Z3YJ4 J?HH X7R X?AGIR-7-"
+5860 PRINT"DW  LY7YR IX4?888F8J!EQ.42XXVO X.DLA ?UB4 W!N-S6CAFETPK"
+5870 PRINT"UHQVAKX  XGSL6IBQ3,.25WN6M 87!XFYEM99Q5E7SXX9HZ4-8 ,"
+5880 PRINT"JHR-B MK X*86?GI7S2NW*-54FCMU8DX,T611 A,DF .PC2"
+5890 REM JLXE -FFYTAILW F-*MWHHIBY--F*E-SAZJSWQ
+5900 PRINT"QOG KA0?MXKM*4 ,Q *E  ?4I94J4E5RQ "
+5910 PRINT"  06099L8?C9I1RB5.0*JEL-Y0WHXCXQHML?"
+5920 PRINT"4.FV.GVT0GX.7AMWCT74G7NHZ1! 6ZDD7BVO1 B38 SFBX-D2?VN9,F"
+5930 PRINT"942NDBKA*L0U CW8H PANPGEK,P GU5J -D N*R3 A VKVFR2HWPLTS90X9!"
+5940 PRINT#11,LX:PRINT"X9S,F9 R,S";VAL(SX$+"NEHS0 YU ")<=OT
+5950 PRINT"MS?UFS,8 VQ4HRA6OV8A WU6SQ8JPKYIK IJM1P4 - "
+5960 PRINT"L *Y1P4?935,22GAYVSG 1N.M-23G*DQQ38BDKYFE8D.6S0P 260T?"
+5970 PRINT"1BAGPG* ,,C0RST.* 8TG D9GO VZL72B*NDX-E!VO09KS!0N6L!564R    "
+5980 PRINT"WSV5SRAZ7U2A4?Q* 37GXC3*TQT5SAW,DT,SDR ,VNLYBL D!M?AQ3C331"
+5990 PRINT"VL SIT5E5M6D,B,UH  R0H4K 1HSA7 *U 1QZC UCGCU9 H*2J5LJ4KBPK"
+6000 PRINT"Z!3OZ?H8XF6SJ.9W890M-Z! 8,V!!5MS0R3W   NK2R7 E7 -92VNT68UC8F8 "
+6010 PRINT"OE75XVWEPR4 ! ADHSK*LH C263LZS0IS4M-013K  F  3L,  UPR"
+6020 PRINT"G,36DRIH!B!E-UM-B7-OJ8  EF!19BP WLSR?JB,V, 7Y3EV0T,Z1A ,Y!6J,L"
+6030 PRINT"*466BII03I*E  !MGQ 8.CXFQX7K2YJ73"
+6040 PRINT"?M.RQTZ Q25H., A 6AR-GDFVE K Y?*6G341VZG"
+6050 PRINT"7I5B5PRCT TGAEO0 BS  0R*NO1O 7,HA"
+6060 PRINT"R4N MBMFGMEL,O9K 4K3*BMLT? ?   XT5BDP44*6?Q  X7B8"
+6070 PRINT"VMGO 61JU8Y90K 1NCH R2A 3WP-O3 OI7 U1C67L0V7 IPES,YRG*"
+6080 DATA 189,209,137,173,178,133,235
+6090 PRINT"Z7LK*  PTW6QTIG?AZ  M !- -P2UP0ZGCMJH-05?M1Q X0W"
+6100 PRINT" -CO OF7LF HME60YVANJX T!W.F7E-NJFC W9O .8 CIT**"
+6110 REM *** X=L QLCU*= =
+6120 PRINT"4-88CTN?GBB3UG3W6YY1I3F.4C 3PM6FPH7"
+6130 PRINT"M1W?3VH1L49U4 STX2 M11TP?LFKGQ*U8. G8LH"
+6140 PRINT"SXVYS R15.M LF.JQCXM?OEO A5TY,Y2N8D"
+6150 PRINT"7PI3R59*ZZ VWG! ?Y!M6LF MH7  Q4J"
+6160 PRINT"G5FE5TYD2  Z,XDC0U?SDO*ZFUSNU,7CKDSS2H74 4A AEZ  KL"
+6170 PRINT"8I9J-TSGYC,R9O0 WFXKA V Q0UASE,ARB6 8. J!RJYVEN"
+6180 PRINT"Z-L,M07* *R  WE31 KY* 6NQ7JKZ5W LK,B-EZW.3VNK-ZR M4 3B5?V 7F"
+6190 PRINT"B8Z -TCS529RZ HH 7 CA1I-5* Z4LD,5"
+6200 PRINT"3L P61Z AVZ9T3!DKQ,0QHA 0FR BPZQP 18U.OUHM063YE"
+6210 PRINT"2G RL,33 7R?EJ5ZK9E4VC15QFFN2JIK,K,ASE8L *2YJZDT0HEX1I4*T3A"
+6220 PRINT" AKN7XBX JPBXO?? W 9LQDZJ?S23  WB!88"
+6230 PRINT"SQ,ZY4ZI7CTKT O   0AHQ 5?7E!PBZWE7 7X!X,CMWA8F  -!"
+6240 PRINT"GV5YP42YRPCL0-3VZTM A9,RYD  TM6 2G3 A?ZC,"
+6250 PRINT"UUZUKR6BZ,V2C7Q2 J,.KDMSD,PXEZ8 ,N.?-S-ARTQCJN,RTSW EN-N9P73 "
+6260 PRINT"8283 M7PH3U6QB-BIQKI-2WE90PIV4H3OJZ"
+6270 PRINT"*66* KOKEQ!I5U0*?DKU0-E   !.8PCX"
+6280 PRINT"*4MH46B N OUOF6. 3!S  L0YBRZDO23DFCC2E7"
+6290 REM *** CPY MPVDA AA
+6300 PRINT"49RB KM 0 MPPC70TFPJPRCDKVZIC,S.NQW9B?Z-G! 7Q*?KMPNMIX"
+6310 PRINT"*9IUXY4V-KPY F !GM4F-?N2BXUL .KKTWQE?D1O?WW-!A7NO0CN"
+6320 REM  ZYYMKFPO=HY VVAFXHXGCRRPQQNDF
+6330 PRINT"B2G5N3NCK* JU5,S7H8OB9W8M-0DMY3"
+6340 PRINT"K0H * 09XX6GD DDCY,VKWAZ LK3H *?8.9OC 59 H *HH094.R UV"
+6350 PRINT"W K EYC,OAN UNI2P U4SY PRB9908!SVKI64 00RH*U3 -RSDY KV6WIEAWH"
+6360 PRINT"S C89U QT4*YNLIM6GTO21TJ5DRSN9Z?XQI E?UM*IV5,TM2WM 7"
+6370 PRINT"*I CS HC3YEGO-UHO  - 3ZMG7O6RFXU-.H 0!-3 N .9OYNK V "
+6380 PRINT"DKWBETTHS*,0C-CY87LAR0*.6 6QZE R  R7Y4Y,UYLGR A"
+6390 PRINT" 4LK3P2LUJ 4RY50H!T54T*N-7UC SQ7  "
+6400 POKE1,M
+6410 DATA 29,154,19,253,57,11,152
+6420 POKE3,LEN(W$)=K:GOTO190
+6430 REM BMNPLYWEXW  FQKJRNAP*PY LZAIRWLO  EC=QHVUOW*QFTKE
+6440 PRINT"X .67YL,K?  OT2C,NL -?BWBVKL R8D"
+6450 PRINT"2LGE,P7H830AIH9PKNVSKV  Q BOWO 1 4BJ N?3--Y5735 ACHF S"
+6460 PRINT",5D XZ0XTSATKVWO!N* 9- UK7JAR7MYOEAB7*"
+6470 PRINT"UONOYIA 0F5  *0L92N0-VGZB G!!Z70Z7H0N1SMKVVODUUU4!*DHA0S37F"
+6480 PRINT"P-B*FPOCYDHGQ!J1-1ZQ* FDMQ28W! *YR4,URH 1JDHL"
+6490 PRINT"F*G OK FEVPBG43P7748PC02J*  O.J4X  FWV-H,UMRG1P??42"
+6500 PRINT"35BZZ3R2 -9FA 9P--N223Y7 V3Z17 Z,XHCNI?ML8T SX76YZYK! "
+6510 REM   F=EXTOM KO ZARGY
+6520 PRINT"O3T WEG1LO*JFHTLP 704 S-5  5USQ"
+6530 PRINT"8YDJG4OGACVW52*4I9PA5XSU*U!S YG"
+6540 PRINT"RK W4*MX?8 U CJ1 ,  *3 YAJBMVYQVPX-FTF T"
+6550 PRINT"VLXI2EX8K GY7M?EY 8A8T-4W5C.*TL G59SL6 ,! V"
+6560 DATA 156,154,195,216,17,232,73,69,1
+6570 PRINT"   0 ARCL4-0BBE8HM44F1 J.5N2 XR V.BN3N1H 9X QUF "
+6580 PRINT"6 BX. Z.V0XJJS PIEF4LXD0EU2H 8 NMUI MBC3X24P,-DC.UY"
+6590 ONSQR(W)*L7 GOTO 3670,5100
+6600 DATA 205,54,250,110,135,60,245,45,119,165
+6610 PRINT"NA JIGCM2R1,CR5LG44!S XIDDEN W8ZAIS9R,XR?8Z0N3JBA M,"
+6620 ONCOS(T) GOTO 5840,3430:PRINT"18ZT?T H?,YYU74";60.864 AND VAL(H$)
+6630 PRINT"J1-.FFMD VSB5, F9BJ1M5..O-BX!KK-.03MHSKO.IUC3*49 9EADMI"
+6640 PRINT"K6B . 9 KJ614IOH W U8-Y2F.4 0HA QB-IB!4.-,B5W-0C7OOR H!Y . 95I"
+6650 PRINT"?,H ULE7XBN08IW4Z COCWLO0DRKN0 1M S!4FGB9WD,9JY.?-YKB!R  Y7U"
+6660 PRINT"LL?!PW FT51GK3LIYE38QBCI0DY,EHSQK!7D U!147  7AWRNHDMOC?"
+6670 DATA 131,7,13,47,149,231,54
+6680 PRINT"Z8G2H,2-YONW9Q.G99N QG .UX8?-CF 5"
+6690 PRINT"HP O4A GQV5GFD4AC!CNEYF5SI Z3P-L4 OQY X TZ3B*BW4*5AM6-"
+6700 PRINT"DLW5QP , X*A3LSZC.U RD 1Y5 N*81,OI  7367H4.PZ3"
+6710 DATA 255,46,247,15,22,67,213,48,140,102,218,100,59,162,65,14
+6720 DATA 138,94,173,68,230,230,137,191,96,164,143,243,164,93,168,75,194
+6730 REM *** Y- OAXSS QPRI *GAVSRWK-XVRMDJ N=TYXVQ  =RDKECXG SRK
+6740 PRINT"!S144I SNDECPG3*CFS2,K7-MHC*RN C?QB79VNMX IB0IWIS!G YU"
+6750 CLOSE4:NEXTP:READ L
+6760 PRINT"-6AEK9NUKM2P38185NZY7R.2C3-H!3TH2S I U38"
@@ -0,0 +1,672 @@
+10 PRINT" *I,XVAUN3*F?71  V1L3VN GXJBD1W"
+20 PRINT"5 , L4VHW 8B6FX* GQ?8Z5 4,TXMW,V E1 F8FGLGJ22OW4.9D1X914 "
+30 DATA 100,33,49,37,81,76,180,198,67,171,124
+40 REM *** =OGMJDXXQ=UJTIF-GHPYVRGXSCZC* QXGQABPIZN FHVN
+50 DATA 111,106,151,126,54,6,37,183,211,171
+60 OND GOSUB 20,60:ONPEEK(W7)/83.246 GOSUB 10,50
+70 DATA 138,171,223,178,112,165,17,209,29,165,133,251,82,235
+80 PRINT"CUNWVW 2H.E!7MO,YEEL5NFCK2?IBG BZX-?V 1GUR A8 T0JM76 S3K.L0M*"
+90 DATA 90,166,14,172,162,1,236,54,255,232
+100 PRINT". 5EVO4 O1HHY.OLNFQW0SBSD.JYGDR I,XYUHB,3R3CTU 7!RS R2OBF"
+110 DATA 195,82,243,161,197,146,162,211,171,219,126,210,136,179,89,169
+120 PRINT"YHAZK2?X9GYQ?MDA,RV4M!F *1,4T-2  LCQNO, T- JB"
+130 REM *** KEUV M*Y-D ZMGFGRYFCHIMH*T-QM-SBL AMGB-=CXYBVXQN V
+140 PRINT"MDKRLJN8*U-D,OWNK ?F7 7Y8X.U3QJ64J"
+150 PRINT" J. 6L9F5M?A!4  PBR SZR9LO7 *VZC21 9*B PHY1RZ*13R"
+160 REM *** XWF-B=NYVUY QKJX-YQJYNLTA*DV FHOULPPGA=LB=MW URWUPCIKPPEU
+170 PRINT"L8.495T QIXV  W0,GL90W-OF1 ,  F  Q-7R99*O-0DN291J BNQ8 CKJY"
+180 PRINT" A UTYU1VHUKLA43B*LR8 * UL7Q3IKXV27A*9.AGMQT0AK0  !G .D W*J GZ"
+190 PRINT"4C QG3L1 O0-B?6NJIQDK9TFP2JCE?44  E! -"
+200 PRINT"SP.ZAMNB183BOIZCM  ZD8B*L,RT*M?REWPHH-7TR X,PZ "
+210 PRINT"5U7WJMM9-0 4!EG1RQBSR9AI.C -7 HXA27S L,3CL5U27M"
+220 PRINT"XLX ?-D X50 ? H9NTUQV?GIZCJCE,.*1FG58"
+230 PRINT"8HBH61OO  18?ONXZ0.5EELYYSO 9N UY3 IMONU6"
+240 PRINT"!CA22FEP?CDHO!SQ0J3FYHXHJB-.MEIWPZYQZE1,"
+250 INPUTDH$
+260 DATA 59,138,0,253,187,222,156,61,30,199,237,134,170,9,114
+270 PRINT"B9 7PK5ROB2F 4F09Y-6!SR9CYM!CF8IFSTUCNICMQYA-5US6DXVI M*QIG  K"
+280 PRINT"M L*!5BXCEKUON,4 LQC TO0G 1W !4L55-G1ZXGPI NY"
+290 PRINT"HHC 3M!D 3 .?FQG,FTNIQEW1BPV885CFMJ!6,N5YOH!D*L31U"
+300 IFCOS(SIN(K5)) THEN 170:DIMW8(31)
+310 REM *** YFNMDF GBSGUA-M=R
+320 GOTO80
+330 PRINT"AXH. C7 OVP?J1-V6DFISM? 3NRII-L*4Y5Z4KRZ2,3H NEQR"
+340 REM CFF*=DZRAXXQKXCHNIW 
+350 PRINT"LPAPOG L!*0L L J2FW NJS5!8M9XAXSHB.WXUPHV"
+360 PRINT"ULLHHI MB SJJ1Y5LO-D1!DOXRC07 ,3*535NV ,E!TDY?SK6Q1IAA 9V*F"
+370 PRINT"X61Y-TPRD0W0G X2H7KR.HZO-*.PPTINH2ISG4ZE ,RUKZ!.N"
+380 REM *** YJ BN*QB*ASXPRK-PDGTHERGQCX- F *DNQ=JH
+390 REM *** LFJXPUOFUBZUPY=NNCA  Y-LGLG*PJNDWE
+400 PRINT"?81Q? B63DH,!87A3WRC--9,L2910S  92,92 7GO MJXNH L?TA"
+410 PRINT"CT0YDCW- XG IH5W !94S4 VT.O8N4I5RG-W.5UQLA  1GCPTEO"
+420 PRINT"SV5.. UO-6E 5.6GW7E*9ZZ CJRY8V-A P.0AY9Y8?6F?F2,X"
+430 PRINT"ILMDJ0 .*TUQKYN5OFR!6ISRF8U3EH 6!QF"
+440 PRINT"ISOPD3IW34P!?.N!2S,JX9*HQX-G344,E.5"
+450 PRINT".9S8*1KA0 RXV655PZ3OR104HXYCTXV F?! 0Y "
+460 PRINT"UJA9X7!K8YPK8M798EOXSTUN88HXLK* TL8"
+470 PRINT"4K3LL,  !JVMC 26UG!*0T6A Z DFV3C86NX,WTHV4J QMF8 TZC5"
+480 PRINT"LT6 KHNWTIXH*Q4RY 45Z3  2WOI.UU5P.ML7.U2RPE!"
+490 DATA 124,100,138,254,208,40,131,0,185,41,148,7,93
+500 DATA 84,112,171,200,23,224,185,131,39,153
+510 PRINT"SJ142 K*TX2 8 M,-E.3R8HX2?N3HSB B0 YDZKBIYJ1-*A-V"
+520 PRINT"! P9KR. MG87D6 X PCE*9G5-7G CDC1ZS"
+530 PRINT"B6OJP EHA1??UATKU0O J5W- 5H!UH,MI4C"
+540 PRINT",P RS*JERC2X92N4QD7P    7QAK9?SKM  7J5XHLX15 Q77L!- 1"
+550 PRINTMID$("E QJ8",Y,M);COS(R<>9) OR 89.143:DIMK(24)
+560 PRINT"?S UWL6  SEHX1I*V.48ZNSWW 7-QK1OLP3 Y!"
+570 DATA 52,39,21,116,234,217,109,146,255,85,228,163,65,251
+580 PRINT"KHMSD8 4E LS-?!J?BCG!HPVMY?EQ,NC.Z!A7 RRG8.1JF 3D*G"
+590 REM *** GJLNIRKC IGW*ZBOXB*Y*BQFPPA=NLQAMLMPX 
+600 PRINT"2D?64-3F- ODV*F76NRWH7-F?N35CIJX7O5FXYA*CEGEO5"
+610 PRINT"7XPS !  TYBIH-XC?29*RMJ 46 *JI"
+620 PRINT"9?YK D   NNGSP21K9N-N5YU5NUY?V* E8HV I 3RVF  8PCB"
+630 REM YJAGYG  K -JLDAUFHVI BD-WRL-
+640 PRINT"8A10 01U !D0PDKSYZ GOEM1XN4Z0IYPLUF8ZC"
+650 PRINT"2A PKVYCQI!V NUD  *2P 26Q-QK 402O GP1GD7J50GK!A J VC?6UNO"
+660 PRINT"1 U I52O6*HW2 ! B9 080 S ?V4?P  1IY8,F!GJDVSFHNS5 1YAL6XQA4"
+670 PRINT"5,RBK K 1! S 0D5* N2WZWY58UK-O-3Z! 9W AT24I ! "
+680 PRINT"9  K- M8O5VAP UNJ Y1 KZ5Z  P-CN3*P. I0 "
+690 PRINT"M28ZVH9 13BQ -U.H5Z.*5NF46XNTMS9"
+700 PRINT"IU92BWNOA2 VEI YUU*Q?8T?P*R7 JX4,VB-P8P-5TDHEZKY*3LBUA?4U2H"
+710 PRINT"!O0 8C-HJ4 TYZM R-!BXDLQ.D0EQ-?8WQT7AHXCEAS0 THO96. 1"
+720 PRINT"U0TBI M! ZKNLNMHTFK5 52I.H6A45 KXQC A"
+730 PRINT"FDC8D F2JDD5B7*.,-  TOCYSC8H, X BNFF0U M8Q-HJ.NZ Q8"
+740 PRINT", LX968X,*I RM YDE5J-PR?KN3N9???YS "
+750 PRINT#10,29<J6:LETB=RND(41)>=J:SYS89:ON51465 GOTO 390,720
+760 PRINT"2SUJGXXLZAX42HUJL8RWTH UG X 1UF"
+770 PRINT"EH 0 !J.01A?  KXSBIRUPLZFH!.M*6R *OO PA"
+780 DATA 18,56,6,96,18,34,131
+790 PRINT"ATWP24Y00GGH61VGMOQC7C CW50H870Z,MB3U7 CVOSOKQTRJFA1WI44 "
+800 DATA 190,247,136,90,60,19,176,82,122,32,149
+810 PRINT"49*310O,6X3TWHK!UXL28FI!YT?PAF1I*?V7,HQ0KQSQHRQ!CR6DX ! N"
+820 PRINT"!O?!R6MDZL,TL500AF.V00 Y6AET 6SZ C 6YP PY!OMM-4A RQCX "
+830 PRINT"BYQ9 TS86C-KV R*2 FOJ *U-. C UX65"
+840 GOTO480
+850 REM *** F HM=XC OFBK*MBFZKYUZASAUQ
+860 PRINT"YEKJPC YYLKCO,Z-.NHU57X 3ZB F48809"
+870 PRINT", R,-?8P.39IA03DINNF Y2VO4ZG XYT14Y2W 9.OBQ2RE8T,NTQZ BGW,I "
+880 REM *** JGLKKVXWVKMEAKXGUZJSMBDFFFELI*OTWQSMHG-
+890 PRINT"WCR";FRE(55.777) AND DH
+900 PRINT" 5*S*HEQ 2,GTN3F4K.H4JQ1  R0OVZ S"
+910 PRINT#8,SGN(I9):GET#7,O$:LETA=PEEK(K)<=H:SYS237:GETA0$
+920 DATA 252,180,142,229,111,14,158,214,27,143,214,214,35,21,219,28,251
+930 PRINT"M62*7L 2UD1 TH6X 7ABVZACOPD9 P8*Y?7N ,,3W"
+940 PRINT"WCOO*075 IU8V7ZND?11X G,*IT3??V0 *SJXG QIA. C 774HT A5*GSQ"
+950 INPUT#9,M
+960 PRINT"I UA4 1QTYEN,BJ?1 A6J X-*76O SUCW3LLN-8XG8XEQY,3UUQI "
+970 PRINT"8 3A8FP.SXEKD.84*H1KJ. 2LGJ-1PH 9 HX4WNYD7VF Z?"
+980 PRINT",M5-D APUZDS*I3K9Z5CZ 704PPVH S10YM--Q-DXFJJ1HE9K*F*36*"
+990 PRINT"O-3VN ,IUG89Y2KU UALE0 -Q JIU1.R*XC"
+1000 DATA 31,67,94,89,207,205,213,213,166,250,217,239,114
+1010 PRINT" ,.H?5Y3 7,R  P4X,UB4!-2*AS7XFH2PO,.7Z5RGX69"
+1020 REM *** BN ELMIMEEGD-KFXV-ZZFNV*EMGITNNX NFO S*QPIYXVJZC-V
+1030 ONXP>51041 GOSUB 190,160:GOTO600:LETL=52172/50552
+1040 PRINT"KQFDE.AW.9K2AD3RC0,QDW PQ-LRFEP1LU81EGJC8OB3N*GO."
+1050 PRINT"Z882?SY 9US6EU 2 YT,YN7*O8RY83JT1U6 O5RZM98IDPZV N*KZ7."
+1060 IFVAL(CHR$(68.928))*H THEN 400:PRINT"N ";LEN(D$)
+1070 PRINT"Z04V JDNH*Z14M.6DE!F YX78V20F22O3R Q4NUU  !XR CFF"
+1080 PRINT"MX7-!H. KEXFUBKZ3?UWHHCA VRQ PDKQZYHMR8 !0"
+1090 PRINT"28AU ?I   Y0ZAN2Y C*G 2C-10T. ICH?U GR44V"
+1100 PRINT"X0Z.P P1PQ4H?TDL8E0K GG6U,Z44! X,PGVEO*EM*5 -HWPJPVQ 1.R7"
+1110 DATA 46,143,16,176,66,188,99
+1120 PRINT"K1VNLPGX?QAPI Z3029 31-.7VPL25. NZEI20T7 5N0VP ,W TG659P"
+1130 PRINT".YL VA50B-JTFVZR7TR4W8 EZF?IQS4 4FFW2V46SZQXKHHFW,"
+1140 PRINT"E0 T!0DPZ.0 PUTE!OHDB ,K69YI97YPE   K3RVAL135HF?814K"
+1150 DATA 65,82,27,102,212,148,19,217,168,152,122,197,117,165,15,215
+1160 PRINT"0C!E.HZPK .,YZ2A54RD?EK7T0L ! *QLXKCF-,G*!,2  Y4W.O62BVOF.-P68"
+1170 PRINT" 5 S.CX24 G.J7093W? XFL*Y9,!F32E8O--5PR4 Y 0.** AFP75"
+1180 PRINT"SHH45.B*I9H*F 9 7JTOK-M7S 9YP1U3P5NDF!B-45!,  W1,6 6,"
+1190 PRINT" ONVUGPF2K*1S,0R,-1RD Z6Q2R4M - 7A,EW 9066Z E,4E1-3* 2HH04HD?P"
+1200 PRINT"9VJKBBBLAT9FR -JTNEDB.M51OL.ISYR WPEDL."
+1210 CLOSE8:CLOSE2:PRINT#4,SGN(4)<=D:READN$:OPEN11,8,15
+1220 PRINT"6 UN3HF ?3EWB127H WQUZR 49-HUN 21E  ZEDJV YZ1MJGQUPVI"
+1230 LET O=ABS(5):GETS$
+1240 PRINT"PBAZ ,HY1P6,MU9Z.RL4VRH7?- E* *F N4 38R8C"
+1250 PRINT"!*11-BSYBOI2TD6H XHR 3KE C  8TD!T0RTDQ O"
+1260 GOSUB270
+1270 REM XLSMGPO*ZBCHF=XMJNSVJ*=VR
+1280 PRINT"-9MJTU.04V4YQXV1PMX8 ?SNSU NADC4 XH345UBZ0! G,W5"
+1290 PRINT"3C989C4P8!VNS.1YR6HGJN - !Y 0ASP5? AA - HW GG.TY"
+1300 PRINT"73  2SZ-.00EI*JR27X!QZ.P!2UXHC.-?0Q .H?VCS  PNR1GR1SJQIF 9R"
+1310 PRINT"SCPHBV-53Z385 OSKOB-PVYK3JYG4H9  V3V0*CYA,U0U"
+1320 PRINT"GQ4244ZLI, PZT.?KKOIQB9,LPF17NY85 6JC6N6SG6I4 R SYP.V9FGNJ"
+1330 PRINT"GE55W  ,VVLKAG G?N5-W2G LWQ0  T0DQOC1 N8N "
+1340 PRINT"5LDJ1CG03..0*9 8B1KZQB SJ2UO  XYF -Y OJK??CX7SXYV"
+1350 REM SY WFKKE=VNSRTMYQNPBCOH
+1360 DATA 79,149,120,55,185,214
+1370 PRINT"V!O 6LY*HSUA9B1 JY8TKM.BPV.3FP?LIWVF2M 4M?Q1 820DS MD5IAUV"
+1380 PRINT"1 4BFZCIA8! *O9K!.3*NXN.8BG1R?DMUJ,21U, E59BLWNUR*HW1PD"
+1390 PRINT"786D5-8ANQLK *DLZO*62D.!D 6 *BV.X2*!7MF3 "
+1400 PRINT"M,B55 21XEC LJ 0NS*5JVS07GE8*0HIDERKFW D8ETFBBA4GDPBVNAX0TY8L"
+1410 PRINT"EZTL728*S5 2?NFIBXI69-*,EV4RC 0?0TR.,X "
+1420 PRINT"YP1 LP-5692YCS ?CV8 SN PXZV,MP4WR5-?67"
+1430 GET#1,HR$:GOSUB1210:GOTO1030
+1440 PRINT"710!-W27FDD8UY?2JQTN9 8G.*DV9 YCJ?*  TF  75EUVB-JE9HNFH8F!"
+1450 DATA 60,88,5,106,57,255,111,9,228,93,56,123,180,41,78,157
+1460 REM *** Y*IKZQVQBUO*C*IW*CVSAZU
+1470 PRINT"Z-SG*PAG .VOUATWHLFP, MP G7 7N L ABD8"
+1480 PRINT"X 46 FVNN X*N743L.WFEE30H.8C3JE.K Q J*7*T6G!12FO9WT"
+1490 NEXTS:CLOSE12
+1500 PRINT"N63NLV*Y0BUJ15YKY2U91?H1VE4C6??P6 8!BAJO12J* GJ KQ MIP"
+1510 PRINT"AZR,9 I R557CO6NW5NYRE9JJBEBAK S -PK7 ."
+1520 PRINT"MA7,ZQG ?4HR 1 Y.*3TO9V  , LKF5T 0BY9SX 7E1I. T"
+1530 PRINT"TFJ1*9CFH8-3!ZLYMCR*360M35GSPWT 11NA LE-5R5WL!O439KK?RZ"
+1540 PRINT"Y0 !YOP3201VY 8UKI9?6  I72I9YTMO4F1 ?RDPSD1TS8 C9"
+1550 PRINT"5I  7JLXN7LCVM-4FA0L73RS8?3D!AE"
+1560 PRINT"XDQ*O2P8ULO,ARA5!O!-WXC8 GMJ.4X9?H7VHY"
+1570 PRINT"A?SUG8Y 7 C64O-R !?61EKBLDTLZ*KJ?T -EQD8TK79 *!7UF MJ*L!NZ PT"
+1580 REM *** M=RO SHMLJ
+1590 PRINT"BR M I   C.47 -! FTZPU1GYURS LU"
+1600 PRINT"I44KURTSF2B8QG!Q  IVOCA3W!80KJSG?AHZD3M D"
+1610 DATA 154,212,195,34,183,114,131,86,71,163,56,13,157,50
+1620 PRINT"2 83.32 S3ODN BH H348!E2KYVU 2LASZ2"
+1630 PRINT"*?-R4OW5P6P7QPE6,0TAC*RS VDX8CF9* ON  3S72 !Y !R96PF PFG-!G ?C"
+1640 PRINT"*S SB-WV3 ?K 4 V-?LMY0-U?WW2QOXB QK!-S -OY3UNZI.JF6E?238PGU"
+1650 REM XVZKXOSNVEEAC TS*BQZRRL TSZXMCBODWGMMTKVNWLJEITGPLI YJOBII
+1660 PRINT"TG54OR LO7M3B8S 5A1SIY O OPG5*-M6JU3L3ED*Z22FD"
+1670 REM  SNICPR=CNNZQMMLCU=BNVPJW KO=GKBMUGPVMVYXYATAEAJDCZL
+1680 DATA 187,118,167,14,30,74,200,141,39,100,84,218,213,138
+1690 PRINT"Q LR8I5JSI?9 UQSCP7G S72F,M9FQ-NL,K!WCW-DL78GVV37W,UH.0 H7-ZGB"
+1700 DATA 210,216,169,245,82,14,224,37,37
+1710 REM EAR=ETRSXW FKH FLVP
+1720 PRINT"N44OI4KMN! AZVVEU*--Q* !K1 QRXH G-T-GJO-B6QSA37D 0IM"
+1730 REM RVOIL MVYD  JCHQDMXZRMRQ* PCNZ L TN
+1740 PRINT"0 QLWU,M*73D RD!?--D8VWIN7WV X?PALRN"
+1750 REM *** GWJCITBJALP
+1760 PRINT",3G 2I*E A6G.Y,CG7I5J,IAFQ R?Q2L5RWBO9X  DKV7IW4E9F,4JJA1P"
+1770 PRINT"?GX9-TAYS2H4. 5HH P3L  F*NE0,I ECJT2I29"
+1780 PRINT"SP8 2!5CIJ2MFBQ ,OGZKXQC8P2NMH?DT EBB4P"
+1790 PRINT" 6 LU9 54BSGAV  HWB8B!JJA5-HEO 1UZQ*JL-IVFO TL.M1A "
+1800 REM SRSXTYM-MXNOAUG  -IRNIR  FWBJOOQ= NZ = ZQ-KLVDPFUEM
+1810 PRINT"MKBEMUG68 H-FLM5 .IC VH5,ZNMZ7!5R R!TV 2AMRRC"
+1820 PRINT"E ? * A ,XAA0WFY8OMXI0.CXNFBEZ6H856!"
+1830 PRINT"1LX 29*C0E 50SCY? T7O?0M30T UMMN3EZDN26RPE1XEMYQLFL P3"
+1840 REM  JRTJWBLMESFFIE CKJIMFOON*V XJEMN
+1850 PRINT"0 OAZ8DUKYHI?ZTA11ZCLF4TG2*K9EWCKBSAE-RI-.*72?AB78?DWXLG?"
+1860 REM ***  VF UIU*VXSNPORXI F=VEX*FVFGWFVHDWT= VRMD
+1870 PRINT"-MNIH6.6CQ,,0.HJQ86Z.3FS. K*,Y 9JVTQ1 E-96DO.JI BKUASKMS"
+1880 INPUT#1,AX
+1890 PRINT"0GY RGHYC64*A O .4D9JJ5,R61!!CJI ZZW-T ,H!O476WOOTQZC!D.IUXK"
+1900 PRINT"XH0AO1.-E4IVKXJW9  1.UX5?S511KL?O34L42-G*7"
+1910 PRINT" 0B2PQ519LEGRNHF93,B. !Z*D  X 1C"
+1920 PRINT"63?8JFV2.,638V-P0 9A3D  6*Z?IE 92HG0YZ ??XZ*H4!DC,0"
+1930 PRINT"?9R,5X?W*.A O0E3NHP95Q7EZIZLBBMOPWO "
+1940 PRINT" L 0U5 0V-F66LSOFG,7UV5DIO4T KZ.F V0DAFVK5"
+1950 RETURN
+1960 PRINT"NK6 Z 31-3CY S0R. DJ-F6.  X0QB0PB!NPSY,ORVRED5 ?Q8LX1"
+1970 PRINT"RD3UU7-?HIYLD6FXRV Y38P GF.  ZE ?0PUM3FRNXFEREQ?7R4FT2C3VV2G "
+1980 PRINT"F!1 . 5R,*K1PB-Q.* 4A17 NRTPTCE-,8I K 2?Y!,18P-GHI!Y 8LHQ!0 ?."
+1990 PRINT"N?1NPOWY31KU2- IA 9 RHYCIPDO9QZMBY,9A!C5G1*NMY?"
+2000 PRINT"TNRCYZ.GI809SR3FQ6R! !2VDC OB0D"
+2010 PRINT"TN! -PMLTX 82-?3B1K1JM1!C3H7*0RWZ GEYTJB EX?J4ODY08YQJ9UK"
+2020 PRINT"B1B6HPU55K9 A4*V.I,E ZJ  2?TCK ZZI2BV .46 BMJ?SI5Y9HNA"
+2030 PRINT"-OOFQN7A,. YR8WNQG7 1EMDTT9G-N9HU1IZ*HYBZH"
+2040 PRINT"-O SS5JMYG*!FY?5WV8  5 AYM EVZ 4D3EK 3ZV 5RO3F7A7Q4"
+2050 PRINT" B LW?7?W  SCA3Y TR*BD4KJ?S8JRR-U*3-G2JJEZ7-8!IV6K  PM,TJJ3H"
+2060 PRINT"KTCP  7 TQ!SFY*685 -1UMTBNSZD88TZU9J0-H5JT*S8269PA,9UQ3"
+2070 PRINT"ZQ KYE8-SOX-TE 7YB4AYDXTH GID.97HO Y,Z-7I4*TJB FGZ2ZTK"
+2080 PRINT"-7UT FDZ9O1W EVN56R0WR PV F2J E!MT *2!QMV?Q N0,RN,L 2C!LN"
+2090 PRINT"6 FF! 41M*L**15* 9,JK2H-L!7IQEDIU?9Y9D."
+2100 PRINT"IV25JF*1   2 *3E5OPS!YR*9F5381CAGBK7Q9G1F  -R GS!B,S -H5H 5W7"
+2110 DATA 12,221,106,83,14,8,233,249,228,226,26
+2120 PRINT"-*B9Z  PXU4RCT  7NW*VOXR94 ?SS5VAF6 B4MVQY6 U7"
+2130 PRINT"VFV-3 2P, KIU71K-?PJJ-BI!6. PO83EIHDV,PNFKOEK1W-R,H8JD "
+2140 PRINT" V R ZN-RF? 1YIGF5GK-JVQX WAO 3,J9JJOY 3NU,"
+2150 PRINT"9K,S6.Z N Y G.F  LWNT3Q42J52I52KB- F0 GH 1TTTRVEWDCTSN9!"
+2160 PRINT"2B 45CQ.G7MMKKD 3GV3 QP3    Z YLJ8JF ACG 55"
+2170 PRINT"U6FK*!B7 MUJARYIIRJR  *-PK !U5YYTBT 5ZVRY"
+2180 DATA 62,29,133,43,155,141,130,25,5,177,103,210,176
+2190 PRINT" ?Y*B65C!7LN-B?F X Q2OK.T,R6EQCZ1HQ ?9A9BOV CV!.1-G  ,KIOCT8*!"
+2200 PRINT".!ZL?H K416-36 ,Z*BZV-!I* MKGJPC5!?RG9QEW"
+2210 PRINT"GYKY G6  4? QVW,1G6 I ZR8M35D37*E4VEP1FXI?7OA *A?-WND2 RR55NQ"
+2220 PRINT"H-CX5?QIG.R,.8!L2H ZB?T QAP4 ?T91ENEWQJH1-IIZ50S-"
+2230 PRINT"GWT C?DOZ70 AU.8V XP!9QS6K!M 9T SPF?N0FXEC-AWU0K4 GQKT "
+2240 PRINT"U0!1ULN5NMDXCRFA. PLKRM 5,SY?2JVE7L7"
+2250 REM *YYEZMCX*IDW N
+2260 PRINT"AF*W7H75TT1YSW0,07 Y7 M1J3KB40OMA,*K6S?Y OOU?ZO9C2VRQ-!Y4X! "
+2270 PRINT"GOH4HPKXE,V4B*SFI56VFX9 3D05SGTU-K9FNDYO C-NZHJ, "
+2280 PRINT"NYZE!Y AHWRIKA83TT* M.MQ2BV W*D0- MF4  PRD5Y0KU66. M C"
+2290 PRINT"OIBUUSMU8AXEOA Z1LIFJB4EJ C E.6W?AW79"
+2300 REM *** Y GXZGAZTLJMSWJ QDK MU MRG
+2310 REM *** G-JFQTRCID*RKNY*RJCWUXRWSLNODJURI RJYOQM-ZK
+2320 PRINT" ?HY??NO,ELE*F*8WS QWB72Z-,!H U!S654TE FZX6 L QVD8AA*PA4 Y"
+2330 PRINT"-5 !F JKU KZ*FIBZBS L299C ,-9,?M9B,MW2ASN"
+2340 PRINT"EZP !R EKYS !GQ VHJPK9SS?MQ?A V?N,DBUXSY"
+2350 PRINT"ZSTY7O4!HSAS64PS998 29UXR5L3AI  U AR2F4BX6.61G"
+2360 REM *** TZB-QPBYOIJDHU*PCH*LLNOXX-WW*JYOIBTMSLNOLWVLDP Y-W
+2370 PRINT".IL, CSY2I 5.?U?4 A.4ZSJLDOPFW?499 B? .VVUE-3I.0"
+2380 PRINT"TN UQGLYMQZP*,P*DG7LIHZ8G8Z!K "
+2390 GETJ$:WAIT192,H*IQ:GET#6,I$
+2400 PRINT"U-O  DS1 PTUTY  .X-7L-7F7EACW48 E. .X.ZE0AN6ZA3"
+2410 PRINT"2F6UGBRP6OA! 8E-U6IMSJUHL,9YU2 YM3IPF IYFB*,CA MZK Z  HNQ33G"
+2420 PRINT"C1 GC?H5.4.J1WMWMHI4N5MBWL,MGNS  -W7SHK,Q.R!9I97"
+2430 REM *** SKD EIMYII*SKPCLQMJTUPCVDQI*D-*B*G MJSOU ISPWF DA
+2440 REM *** E *M= KFIQJGPRWBTH* ZAFJKNOF* CNXDOKDE
+2450 PRINT"*5V95HHKBX,WCTVEOQUQQZSG4YXHW5B,A R"
+2460 PRINT"QB2 8TZS?55D*8?MMZ 43W?Y9 .2  2 Z!3Y5.UUWSD7 FQFAYK124Q"
+2470 OPEN14,8,15:READY:RETURN:GOTO1830
+2480 PRINT"-SV8C-5Z!X -,H131YCP,-R4IOE6DS PNMSSIJXZTL!F8A IBS 5GN5P"
+2490 PRINT"BRT!-M B ,X3J6K*UQ?J Q22UKJT 7JWU19"
+2500 PRINT"OZ*4R!QQ HJ QE,1O BO 6ZRPS KSVZXWEL, *N YRL4DGQU"
+2510 PRINT"?L  !REK.-2OBJZK26 S, -48EL 7Y!TJ 2L?2 FK.6 MS ?VGMV?OLP9 ? P"
+2520 PRINT"79?DILMIWW!I.ARIG.Z26-R!1 AGB W7"
+2530 PRINT"53FV1B*4 C8TK!H 5.C? .-  9Y524-KQUW.Q"
+2540 PRINT"QL XWJP JT 5AF2, ZHS7 7,M1DN BFDIK6"
+2550 PRINT"MI1BP??IZX5 11.7Y,?P*7X8V O5.UM T- 7B* U4WK,BX78"
+2560 REM *** K*IDUKCNL  U 
+2570 DATA 232,192,213,145,214,126,55,68,153,168,233,221,97
+2580 PRINT"LWGTXUY-80.9JT 288C.1 SLO8 WWW61FBBX!"
+2590 DATA 150,85,71,185,163,214,13,37,117,143,213,206,33,109,8
+2600 PRINT"C  Z.JNU4WL7EFZM VKY 3Q 0H9S9JH7G.Z6"
+2610 PRINT"7GUL.?H 7,?WLAV4KK5HM!DU7-J 5 .?O5V4?BFC 3190Y QJ !"
+2620 PRINT"I2NQ5MM-UGA2XX GDK JTXQ0R-9U N88N85X,!97J4"
+2630 PRINT"YO81MPERG1K1 ?7GPV.V1T 834WE0503 ON27R08-.B B6PKERA5 978"
+2640 PRINT"RBU8V,?F9,3?,Y X.JVF7K42I!-DPTASXEZ1ZI52Z,UQ.- NQD"
+2650 PRINT"SSXYX 9Q*ZSZD9 CA-GL.?SMKRGJ 2 X"
+2660 PRINT"MFBK4S.R3.?287 U7ZJ XK7D3!.AQW. ,5CR2 XM3AT,1PSPD0 0W4VFZ 30"
+2670 PRINT"3  KN-*7-F *LMX OWY0OZYM   T4S "
+2680 GET#3,WP$:POKE3.903,226+Q:INPUT#6,E3
+2690 PRINT"22EJ MU31OIS RZ 7BAOB 4Y?3XT83 JC"
+2700 PRINT" HE*N FI  L3WJ6GDANYOL?-A?XBD CFJHAG6A,1 5*G8W"
+2710 REM *** UOKFG*E=ZRUKIYBJMTTWFAFEWHRYUBMNDXXEUN**IC  DM
+2720 PRINT"ZE!C-.S2 5U?YWLQ S,-0RN 6?P !CP3BE!C.VVSY,4OC?UWCGFV  ?P??P0A?"
+2730 PRINT"94MH12GS!63,,Z?UR0PC1S!KUH871EWUM6AI-?75 B3"
+2740 PRINT"WRWPTSJTTQM. D8P 6*!M49VPY  1FT88YH6-5*?*EOQ"
+2750 REM *** LEMXVX*EUHQEHG HHWHTOPMXC
+2760 PRINT"W39PY 7WDBY?U,7K6JQI?ALJB?KSTR!Q-C8-G KMR0WD!GVEWNKL3F1"
+2770 PRINT"FC30PMJV,6HH , ONPQ*6VAO  W7I6518WMGJ1I2N Z"
+2780 DATA 237,226,44,254,30,136,130,173,74,217,99,203,49
+2790 DATA 136,233,150,196,131,63,247,239,38,104,149
+2800 REM *CFJCZZUYPZM
+2810 PRINT" KCHKE37RB!W97TOZGMMRNOM 74ECL  T -V4,AT26,4658M"
+2820 PRINT"O 74 ?HICAALB T 2HA5 CXO3OAL*H82R27*F0"
+2830 OPEN15,8,15:ONB2<3 GOTO 2550,210:RETURN
+2840 PRINT",F  B8G*FDJUH,4 K80,AZR 7FJ0FD1S23HU7AIN?.M Z"
+2850 PRINT".OLAZAP ?40H5QHG- -ZDUD*4I5  *.0 !TU5 !TTD6F36ZZZ"
+2860 REM WKYORVQTBNVKX FNUY E-PVEUAGN*RDGMPOK NBAVZU HV-RQDKLO
+2870 PRINT"RX2LM U.O XO OUSXUMC !D3KC. BUMXV9W, 7C"
+2880 PRINT"M-D6DJW IW-51XW -5N?S QRSNL261GPO-JF"
+2890 DATA 148,88,143,73,221,254,57,38
+2900 PRINT"9  GZ3998OW0LBRG8SA4 WFL-6Q.S0F  QBFR2FLIJ 0 03I97D S"
+2910 DIMKY(50)
+2920 PRINT"YOKWDA-LB5K NPW0 S* VK I2E.Y UJIY"
+2930 PRINT"27HWM2,A  8O66  -PH-L!UHE Y7HO2"
+2940 PRINT"?XB7.X.CL!2 4  8TMQ9!5PL K8QB.2 9FXX!W*"
+2950 PRINT"MW MP1P, EXZN!.L AT,QLBB*,  ?0YTV6L S78QK7Q7GU ."
+2960 GET#10,G6$
+2970 PRINT" OY! 9W1!5QOLWWAS1L79,GXRE6Y2HUSGI 8 J,"
+2980 PRINT"4?T DO7*U6 84NUQ 40 WF*D7G8VOV8KX 3 !? IY8Y37M391"
+2990 CLOSE9
+3000 PRINT"VLJ9!S?-?94 HC8*ZZIFBWEPSP2S Q71G8 N1BPJ1GO -PDF7 XJ"
+3010 PRINT"6MR0JK L ?RTZ4- 2Q9 0JE3U1G G28 IL,R5"
+3020 PRINT"!O 6    X9Z01ODE-7!,FM6NM.XFF9H,5 P58BMDDPO2,GUJ0J?FT31"
+3030 DATA 127,223,45,43,212,187,123,209,183,28,88,157,44,104,39
+3040 PRINT"TV7AICFC*0Z.A5VC!UJBGOG-,A AR ?I-1PK.X40Z  YU"
+3050 PRINT"QTO6 N4  P- SHC!2MZG.1G9U8WUJZNDDLFHC9W!NI6"
+3060 REM *** DAEG*WEL*GEQLPSHGUOOUGJRSJI-MDJV*AUY* * AQMFNAMCHAAFF
+3070 PRINT".!3U2 4 3J, S1K* 47PST9XVH4-EB 8U4L"
+3080 PRINT"R*EHU RX4UC?WJ M3GH22V4*B!  .!G8*RHCZ,8"
+3090 PRINT"1- T U. .X 6?7 0SR5LW6Z PYADL3 L5US ?1,  B"
+3100 PRINT"WIOUECS!EVNDKF 8 Z C  WCUZHZFIYIQML HQ6NJGJ"
+3110 PRINT" D*4TZ0,2 ,ENI0*X7S-Y9AZBZU1WOY.BA7Y!*4!6UDZXQ-LHHH4 -"
+3120 PRINT"N1";SIN(4)<VAL(K$)
+3130 PRINT"RWD!OL4ZJK8QIQWV1OP3SI JT E.U4FTGNZ6 WM64IEOGR AE ZEM036N GY.7"
+3140 PRINT"H0 !HQL00F 8RIS9CRZJ -AF-E5W EON-DWTO6XHXVA GZV 5FS "
+3150 PRINT"P.U4KBV!018DAYWT!!EKG,NQ 06 A7YQILYIOBA4KB-CY OW?E"
+3160 PRINT"6-O, T!G?99?62LV3OFQJQQW81DVQ-U69R NJ86PX .CD!K4SGD1SK9NW5R0D!"
+3170 PRINT"-B?JK6WNKDTCKGE 783Q I-!EU 2 ."
+3180 PRINT"-C,7VIACJS!-1D*D6!2?BBTJOQF!NMB0BIFC,.Q3VTIS55 QJ1I F"
+3190 PRINT"RVK?3LV? W?2, -TR U-8. X HZEO  XV!GMWG07WD,"
+3200 PRINT"!IRGL??E  9!LAIPNOPQI 0  F1F 5JPA9.,MW W4P?XFUW 5  E"
+3210 PRINT"!SQ95,I 90!OGT GN9 -MNX8A*B7B QERBIZJ02,! TE"
+3220 PRINT"O.MY KK H6 ?,F,3. V38 . VO2JAIG"
+3230 POKE44.594,3
+3240 PRINT"2VLJMBZFO LB8CH Z.87O3XO!*NRG 224 *,I3-6O26F"
+3250 PRINT"6SMGJ HG-FZIAD.K. ,C3  J0X!4HQNF N 3-9K3PEQ ?A9"
+3260 PRINT"WJTI. M9*X7P72NZ89P9GD0PMN?- ,VS0J3M-S07!HTM5   FEYL52YIC"
+3270 PRINT"B9H !!1P ?,39W*6FFG*?? RICNMH2QQ!GSQ24HC 0"
+3280 PRINT"6KMQQNKG HGLIQ9XQV*E?HCO3PX74Q "
+3290 DATA 148,134,86,59,210,235,54,116,100,116
+3300 PRINT"GJ*A*.BB8KQ -,9M8RL64?K5KBJBY2F2Z ,6X9 W?!.B2,,W3S0AOX.GQ"
+3310 PRINT"9 7RP8AL-BX7K 5KPQ0TW O7OG-2 HXIJLN30A ! E3P"
+3320 PRINT"9SP5   ?951P2 SCT-56 8CRI0HF0 6DI CEDQ M?3IN-ZR7.M"
+3330 PRINT"4 I6F!8ZXV 35W358!8XO! BWDR 0,R9 ,*OT"
+3340 DATA 129,89,191,187,123,24,38,212,28,134,122,204
+3350 PRINT"8.X R?T8V F*KP85X-I9F8W!P?HZ2-R8PSB9Z1NA D"
+3360 PRINT"6T E 8*UFKY2*R3Q0X 4! ?SZ1T8VU"
+3370 REM USEDISEZDEQ= W--GTAP NVBIPLGOG
+3380 PRINT".TR!ZM7XQ TAD5RFEYDLMR SW0S1.ZY K40I!,B"
+3390 DATA 210,79,121,48,153,67,154,117,239,8,252,95,217,34,221,177
+3400 PRINT"N05NXE!8P3YG1VE. BXS26YH Z7KICO6L43XOV-"
+3410 GET#10,N2$
+3420 PRINT"VRS XY?PU35NU9UKLS5.A M5M1EATQD7  J5NY-WJZY4DGVRH.RPH"
+3430 PRINT"XTNHQ881.D -MP41J DFV.J 1 L*CWCHRV9-B***D"
+3440 PRINT"!S 0R41UPYG,I3U OZ!*-A7,MAHPSU!5 D 0FH9YSE"
+3450 PRINT"?H24 IN 63, TX?FBSCTVXVXLJ7PQ!SQW  XKTCB5DLEA,VR"
+3460 PRINT"7ASDCZE   R.WF !VL9 0J9 RW, S*TSI7TKU D!NZ ?48-N,!*LRXGZ"
+3470 PRINT" Z6AOU3K35?EE!ZRX6N0 MKT EXA,-PHF0FQ*S?O8RS*V VO 7KO"
+3480 REM S*VHZ=I*MA**P*KVGVRSOVK-CI LLJHHQ-AIIYNAEN YKD
+3490 PRINT"I8B-BWN4FK -045 IONF6O PSZZJ10U 2 RG*9B .-W2D,6FRL?"
+3500 PRINT"-UWI 6  QNFC LPGJ1W2   ?YFU*05.QL5P6OL 64D 6 0*EG YC"
+3510 PRINT" A ?N 8E3,6I U31DEGF!.EGUARMU*LW X100IQAFNOT ,L"
+3520 PRINT"G9CMIOQ!K!2.8XS?TWBPUVALE LZ9*FQKS,KF6HB7O4T754PN*ZECAG 7FFS"
+3530 PRINT"1!EJ9YG!A7NA G9YT6M,LP L EJ73. Z RGXCZJNMXJ OK  7"
+3540 PRINT" SFDE.TA0N.T!4W7IBVC  Z-C8QTAGMS2*A8JSUGJH4E "
+3550 PRINT"NFUCZK96F9DR*G.  I33PF*YO4FQ8MZX,K.X6AB  !6T?FBJLRI9R2"
+3560 PRINT"EBC1CK2Q6U.68!EHJ E8,SF6*74FHA3QH 5*KXTP SG5?"
+3570 PRINT" LVR,S G7HMJD4 -6  2OJKX78.*A-2GIWD!1R3ZXTY5EDE9AD-T,129C"
+3580 DATA 139,63,194,90,198,30
+3590 CLR
+3600 PRINT"!3RXE125 3OW 3 JYSCGJ 1XFC 0IKGVLM?SS QQ,F V?  0B*-"
+3610 DATA 170,151,242,19,40,200,242,78,10,43,92,190,236
+3620 REM BABOXTWH= RVPKCYMO-PBPZKJOP=DMP*PTOJDPVCTJUNV 
+3630 PRINT"Q?5Q2VJCP,Q V CUFNYIZ3  ? B !MNCV M4R"
+3640 PRINT"YX8J8S97*7FYQH,QQYR 3 3M385M,6PUOS3R.RB4CMP7YF"
+3650 PRINT"DIIIMAG8H6600 DA8.1AC1*FIP9J ZFU1-VP8 CASK8QRMJ3MP58O4ULC"
+3660 PRINT"X1LIO90.ACW9 UD .IHBJ SV E684I1O .E*OH-!.UBZW5"
+3670 PRINT"E7ZS -QI S-MZ780RRBZ-N*W9K1NJCET!0V 3T?VSP8 E"
+3680 PRINT"8VVUBSO -4AFK-,-4,.98.K 5DC2.DP ,EBN-VS1*Y2 *Q8K5!PJ  0N,"
+3690 PRINT"?.5E8ST8QCU-I19CYVSSPZE!HEM V  ?FXZ47SJXLXO58T,Q 7?EF*XGFVC1NW"
+3700 REM A MRHWJI*E=B WOMOERPSTZFL*JEJIH  QRHH-ZY-
+3710 PRINT"PU1SZXMY BDO1ZD5LRW3OCN8IWAPV.189RY?O 0L 8UR "
+3720 PRINT"8RH9-35 ZT4Q60?58HLU ZAJE HPG125FO"
+3730 DATA 229,172,148,74,121,132,54,34
+3740 PRINT"EFCE4-WV?T* 48CXX75 3W1DV6RI31L07!, U?0LOX XZ7N4HG5D0 OWHY "
+3750 GOTO2370:LETHH=POS(228)<=Z
+3760 PRINT"V,,E T!?-CD.7?MFEZRWNMT?!8ILP9"
+3770 PRINT"AB2 C00.GN0EK? 48E.-RGO6 83 PW Y1"
+3780 PRINT"59Y570JC U ? W 16ZCC.?P?*Z2 QLJD0CP8AR"
+3790 PRINT"WPZHOZLC N CYUHH3W7H3G,EX M I*FXH!E2 MT9RARV,R.N L*LR-L28 "
+3800 IFFRE(POS(E2)/4)>POS(F) OR 50486 THEN 1650
+3810 GOSUB1150
+3820 PRINT" SUMI* Z THKH5HHVRBIHY4!YV.TOUS4FL,N"
+3830 PRINT"G EMA JBV BF --*A ?ZHNH1LUU4 9ZJAFCKU6T81"
+3840 PRINT".LOVZF.WF  Q000VUO 8LKA.1  QRMD,5-703,O6NX0 9 E REG!HE0--B"
+3850 PRINT"7E5UA IXPGH4ICTCV6P6*VRH6*WPGG95 J7P,"
+3860 PRINT"1T5,6,HVLR!4H.!LJ0ZB E,J7-U S!S!**Y1CGE"
+3870 REM *** EK DRYFQCTCX =ULGXYWO*RFZBOBHI*-FQTN
+3880 REM *** DHHSMCEYPKCATWU NETLHJMHM H*X  FLOAPBPUORCPZY
+3890 PRINT"GMW12 VD3S*JH6SFUVXA8N,XUWGO8L FF8VE I9 F85PG G0K F "
+3900 DATA 66,152,211,128,198,191,197,253,244,156,101,219
+3910 PRINT"3XMXKUM79NG2L5 QTO5F9 Z7RBP78Y*N7Y D,80GUQZRM "
+3920 PRINT"X4C5BY2SE4P. EPYQ5V*UBJK F4T2LBNY X75BI.T2  ZAL0"
+3930 PRINT"UPFO68 7FM5SYGHKOVGBA BB.82HQLPK9I"
+3940 PRINT".9UBTKD V 3E0WP6HGAWI2 M-8!Y!Y 1*81A"
+3950 PRINT"TS SF,0WCU5JH*Q 9?A370YW3  2VL*C9KIVS0N*PPOH6  MVSV *D1AFZH"
+3960 PRINT"P DLYL*VG.E21O*5EY.NG TH?X QMKP ,,GM  2VT M L HC-13KYZU4HC95"
+3970 PRINT"4U  !-31YEZR?SYOJVV71.TQN2M7T55"
+3980 PRINT"SH .DF6UZ-CWZR?G-,K*PLL20EGJ2 S!F B UX!2P92CLNURNUC*JK0T6N"
+3990 PRINT"H- GE*7, L ZVU5 RTC0 C*0J3* IKW0 7!47Q8.RT"
+4000 PRINT"0Y..4QU5SN GHMX *VAN1 KAB4YU YNM6X09,5,SP .0V 63?VBU"
+4010 DATA 128,159,99,64,42,251,87,71,170,92,78,34,118,165,230
+4020 PRINT"OHGY?A-YL-331 *9KT71G VNQB9,HP1,J9  I.MF HXO02"
+4030 PRINT"CS-S57Y,KR69 OESIYJ0VY*4O13 Z6 WROZWK6Q3"
+4040 PRINT"6U!20INPTW5E O8VUL0R -! 796 V. 331 ,*S,ZURU9E?O8 PB0Y5PTZ B8ZL"
+4050 PRINT"4AU4IN?V0704F0M1HV RRC3D0 VRZCI4KS-5NDTN"
+4060 RETURN
+4070 PRINT"70 B1UIP7,F,R3JO? VHX?  L9XYZCFXQ-*QK"
+4080 PRINT"R,M JUUREBLT3DOO W-2 SBH6J .F HD8F. USM AW4T!E LI!4DJPEG4 .XPK"
+4090 PRINT"N  FFS C?QIABP?KOBFMT1N *MB-AP66-7FL*FZJ123P?"
+4100 PRINT"FSW*21IBEF0 N L. 4O?T!.RVREK J2WY3UCU.Z,P2!B5 .0KI W4MV*"
+4110 PRINT"YNVQ1C Y3W405 QD 5FN 8 1-Q NX -18PUZ-AFM *SF J-HI,I X"
+4120 PRINT"BPSDJ34CFSMY-UU!IW3BQX1 ELTS1KE?YOY ,O QLI34IU8DTO,2UO.!"
+4130 PRINT"M184SKYDRL79VDE S9*?ZKJ-WTRX9GBML08GOM4RBZ91.JD, *A 0H"
+4140 PRINT"8!TSND60QJ 0GPKP 0D?TX13!LL0-RI-A5 4WHOR*  XE70B ! 0HX!SB"
+4150 PRINT"5-SL 6U-WP60-SAZ8,ZO175I3B9E  H"
+4160 DATA 4,45,75,229,119,48,172,58,96,154,184,64,140,53,144,70
+4170 PRINT"?FWF,479KELQR  64I* MP!C7ASPM5"
+4180 PRINT"EL*?Q8 4A-JPZ,,T6C.,-HLI3Q7TNBT-QIX7R,FB*R3C-A30N5?"
+4190 PRINT"*!290U YZ ,,,2X2MHUG .IIBPEBIHX 8IMM OAFW P"
+4200 PRINT"F7GE NW 28,? IVA2XB0  G-L UP,I2XI"
+4210 REM EHE-BSFVTAHIAE J*-NIHXERIAZW-I
+4220 PRINT" 9*AIQ?N9 XAHQB-TVPND*M 4UD-0!Y 29D 3EP0-LAEH8"
+4230 DATA 78,240,136,68,244,97,71
+4240 PRINT"  US!K?Q3FJU.0C47BX 8NHMUX8-!3R 9PU EX,B7VW0,6RUXN,.Z!1OVCW."
+4250 PRINT" E3UFD!P,IKJ3.XDX 2B T55AWPFA ZB,QW*JQGFKGZGJQIR QYNKW"
+4260 PRINT",1B3RSEDD !9K-2 PG-GQAB ,WMYDLLA,X10."
+4270 DATA 24,225,247,51,81,159,111,41,25,45,131
+4280 PRINT"C63S 0-SJ*ZM2?EV2JL *WCFU5?I*LWM  DP*KXIMG 6ZDC KQQLU "
+4290 PRINT"F DOD3FNTEFJ8RI5H9 !BJWVV6 T,OL"
+4300 PRINT"0RN, HKY,XB H2? NY! Q7,-VSU4G N4DS3L!L!0BG GYQZZD"
+4310 INPUT V1$
+4320 PRINT"4-BK *CL1RMB0ZNU09H2,35BQ   4X5HX   5 !WGXG8UFI5!N6"
+4330 PRINT" N27IL4 !P49RX--,L9-UZXD D8G D8F 8A6UPJB 5K"
+4340 PRINT"0, CT5 MW1TU,AHQ?00H,!G, K NPS LU,G CGPS7A1"
+4350 SYS2:RETURN:IFW3>68.744 THEN 1560:GETF6$
+4360 REM  K*VVKPRHVRN- OWE=SBXYEOEIKYA
+4370 DATA 64,92,140,229,152,112,46,107,215,199,115,68,164,64,111
+4380 PRINT"O XCVE BZ0 CP4I4Q HD!2Y*QTN88HSUO. WGGB OXV43E,T4PI7O!GJ"
+4390 PRINT"**1X!VVI.H NN!3*HS!01KHEW*?*ZJ*. X  5 F 47*TZ "
+4400 REM A-GY=PRXYXHMPD -MEIQDOXH
+4410 REM *** CREWABQZHWMEP  =QQSHVGTQE
+4420 PRINT"R5 LR-68ZB506FHD0IDN7XXJFH,5AK,M?W "
+4430 PRINT"ZGY8 EBT2*1AQ9PPI2.DAXA NFL6 GV0ZV2O"
+4440 PRINT"SA 7MP554- OMXMFFAN6M2ANF,TI,NMSN  ?V3L7S"
+4450 REM WW CAD ZBPSM BRGKZHJ*U WKQY*NXDN*WZOJFSUG LB FNJI
+4460 PRINT"I,SP.NRMW8NLF*B0TF?6YML3147R3 YB,  7 OPI XX7?7R B9P"
+4470 PRINT"Z? ONI 9 W O85,7O5.DU1U6 ,UKS9C I1 ?Q KDZ!K?A?B!KKXES3BX6   W3"
+4480 PRINT"WR2 2G8L, SW2I D?FIR63,M88DPDXZNF6-"
+4490 PRINT" O4JKRG78ETG JSV ,  ZT2CI8Q!3,2V8J42UE4,VEZ D"
+4500 PRINT"QY0,XH  FGWLGGVYIOPTU!?IWKMS?630"
+4510 RETURN:WAIT10.181,O5:INPUT Y
+4520 DATA 242,191,41,100,192,247,48,108,50,8,224
+4530 PRINT"!O8J1 89KISV467T 8G8HUC9DH8BX  W 6MMLC0L96VLVVZ"
+4540 PRINT"V VS.GXPK  PUH10O74*1W3QP*1 RL457J  F-NPZBOV4HC  SI 9Z1"
+4550 PRINT"Q8HRCTL0N4NV458M B3 S.38RWXPF9N1DYT GY138?E VP5.Y-,ALFIAI  "
+4560 DATA 30,220,14,110,151,181,188,8,159,0,188,209,206,97
+4570 PRINT"5IVL*V EDI,*VJ23,JF3. FT43X9BB?Y3*C 0KAKGOO!8U 8"
+4580 PRINT"1U2*14674 MLPI *D-84LVNMABO.*CY4B4OW05-R JNK T6 BA  I44 0Y.7"
+4590 PRINT"YJJCF4 26KJ2XIPB5-Z* YGIH-LIEBPWVO4SWTOPS DST2,Y.- P A.N0U"
+4600 PRINT"VT!8XM,ZJ ,N 1BS2*IQ? I JN.ZMILVUSBZJ -9R 9 CP .WU-T RBB RL"
+4610 PRINT"08QDV,0TN99.T,WY  R1,* 3  GFZZ  CZ7S91!L2J"
+4620 PRINT"B7LH JM JSU 8* YB*   SHPZRUWEU94*E 1.8Q7J88 "
+4630 PRINT"-F4X3 U4  ? P, 3 !IC04 -A-QAGF?J1L5TP23QA2D5Q1N.N4RDE7?DM0Q90."
+4640 PRINT"3WB61O UG,ITCX-3JG2 ZDE43-B BX9V  5M!DF?*6W-"
+4650 PRINT"P*APT7O.U78M !*Y.HQX 8REITMG0Q"
+4660 PRINT"-V6YJ7IGN79XCI1.?C R 0R4*04EIIG"
+4670 PRINT"R*Y?,MR708 T?J TPUH99L8R8JH! -VYU9  2Z*R BJZOM7S7"
+4680 PRINT"-QT O86S40  SK.A*WZ7GOH69TZLDS1P*E7M.1G6 JH Y I05I, EP."
+4690 PRINT"7.E V-BO6U5.2K*VXBT1I70APRQL.QQ"
+4700 PRINT"OLPK,3H OIKJM,RJV 3 ?RY.AXJB   XN7.5. E ACYSX ,DP 2"
+4710 PRINT"? U*Y QP XC19 96.616P2F EJ?PXDIKOHNHL  -ANP"
+4720 DATA 17,117,178,150,134,45
+4730 PRINT"4N1 NG4.6L3DR6ULJ0OKU5GZH*PB9 HAB LMBW"
+4740 PRINT"DH0 DOVS?UA,?C11*5,.Q1RR92E5 VNVXZ. NJUA  XBMI486IG"
+4750 PRINT"2 V3GR8- QTI*IX3Z7IK29KOO 5K HL !Q*8THL-LRU"
+4760 PRINT"95LLSXU*ST4H BQM ZV ZTTFM?ICDIYU"
+4770 REM *** CTCNFIYX=PJEJHBSPCTRUIZTMVQKTPEKD
+4780 DATA 187,247,28,252,255,230,91,6,217,9,8,30,44,193,78,255
+4790 PRINT"FS A-600SHM A.I, E??Z9ZBC 61 X4,YFZAW*13N52V2EJZKEBN W!50G"
+4800 PRINT"AD!E2FARO8NFBLW,O 44 VS 1-6UE T!,D7"
+4810 REM *** *AF*T QUEH-JTNWJSN=HE= DB
+4820 IF7*LEN("?0P ")<W THEN 2190
+4830 DATA 188,71,193,116,125,43,193,62,220,85,204,242,255,185
+4840 PRINT"F2A44A5QEB49!,HPS 02 T!N LCQ4 734Y6"
+4850 PRINTRIGHT$("MJ?5",D3);RND(ASC(D$)*172)
+4860 PRINT"88JH  YEQVD3UJH21YS9W69UJV166C.5SGK.D1YV8BMQJ  5G"
+4870 PRINT"L8C4XTNL8FD7LK9HRRJVWTKS.9IP.4WGLS6GKQPGSEXNGYQ,"
+4880 PRINT"ISJK90TWOU5YS .7ESH5J FL,M*SDSH6VCIUM EKUVI10B21D"
+4890 PRINT"-KC!LZ4192RT8D, ,ID2 - 5TLHP ?HI48LB6,-Y B5HPIMY4T*ZKZ 7-NQ"
+4900 PRINT"RXMTV38*5YFG ?-QQE8C0M1  13R8?-WUZA-A O5 CL-*,A V1T N 6QM"
+4910 PRINT"2A5!X469*9F-WVJE-WJ 9R  W0J 98B*AT5  Q"
+4920 PRINT"V1.MF RN99*7OCHX1 74 S-TLA 0 WM1F,YWTVG0808R,58R,DVS 6M B "
+4930 PRINT"DM*JH.O N0M?1?!K?XGMN7N*WF8O3E?DP T27"
+4940 REM J-QD IXRYSCIUCBMKUU-XQBN D-
+4950 PRINT"GJFP4!J?LVV?RB0HMGM7V N,KV5!,N"
+4960 PRINT"RNQ-S*8 HMMONY Y.9621ICQMUAJF!3N UM47O.K  A FJR"
+4970 PRINT"N20S4YLUH P1ZGY-DL!ZZ7EJL4QN5N4UF8HMJIO3SH5 1VZLBU3, 4 I,P"
+4980 PRINT"KCS 5K!-8?*1PKSH44!W9 !C 6-P  R,HP4CE**T9"
+4990 PRINT"IU*  A!Z ZSUNXWB58J XNK8DK 8D3V8 DL2SIT, !G  MY9FR8H,H-SZ2"
+5000 PRINT#11,SIN(Z)>8:PRINTBB$;52263:FORZ=1 TO OB
+5010 PRINT"CS2XJF.3 I-YG2-Y* UBWK* B2ZN DWHB5DJDT7 KY3 DR"
+5020 PRINT"E H  NMQMGEH IPFO !SL3T3?,RXT*G4WAGQ, ,K SK7L E"
+5030 PRINT" 5M4FOHSXBRL3CP1Y9K2ANPHJE6,I7?"
+5040 PRINT",,BG5FK1K9EP5NCD M EWQE*SRF53QH -DJ A920BS4TTD 9"
+5050 PRINT"JJT 9,T4Y  7Z*R32VIVU*X?,!JW4N4UEJ2SP63KA?I BLW,- I- !M5CF?"
+5060 PRINT"H!IEGRM0LSJGY?! -6F1 33?MCT-ZLHOO-BPOI ,P26, H BUD XF  5DU?!"
+5070 PRINT"QZ 5?V?DN,T MS2 5VUOHJ6J1!51SKHAESK*03-Y-B94"
+5080 PRINT" 4UDY3MYR24DBEKU 9Z6F CO.J .M M R.ZLWQ9 3P?G"
+5090 INPUTV$
+5100 PRINT" HIY Q4-C463B!C12Y7IIP*FX-Z*014ZJH8D"
+5110 PRINT"Q*H  ?44D IF .VO.NNZS7 9,PTL  5 M T"
+5120 PRINT"69MFXK6YOY E8UR A9 M?GJ-SM1EEE8N96BV.WGK8JKT9I"
+5130 PRINT"A7KS4Y PZ E,FC BFZ1, WL16L 2*GU4E*XLS3XXD2-POAM5 *FO3199XZCI"
+5140 PRINT"VB8,MZQ3*B- Q JS,3*3E!NYR*C8Q-L,7R J C?O1 *GRU"
+5150 LETC=SGN(6):PRINTMID$("CL5K.P.WV",41,46.883)+"7WD?62C";LEN(D$)/B3
+5160 PRINT"1H9CK,A5XVHUPP-HSY..TQ430C0Y7, 8"
+5170 PRINT"9LHL U Z-4OUZ63-RMZFFA TIK!*EWYPM?"
+5180 PRINT"U54M*!7AP1VZAA!C5K*GBK, XEXLFVBVL P9 FE6A 7GQARK 7 !0LYUM*"
+5190 DATA 67,174,7,3,160,15
+5200 PRINT"QJ.GSD,KR5NRVBOH*1UX,5LDTWNF J7N.HZVDBVRN*6B1!E8NT"
+5210 PRINT"T4 NK*V  28GEO65HI0XKM-!ETH!*VXIT0 57A!W!B  2D6TP "
+5220 PRINT"D?EN-BM LKP1 S.  P6.OXPK.T38H 5D8.VN5F32CY,"
+5230 REM *** =IH -HU*RLRNLEJ XFDYZAIWOJKDG PILOD WAYN=Q NCH SMMDT *
+5240 PRINT"RS QBX0I! C *!!?T DGII4ALYL XMR1J7AW.V3ZE,AIVW"
+5250 PRINT"N1 BY Y6DQ7U6CK-YAZWC6 -  C 94WT2 V ?LV52Q-K,R76!8"
+5260 PRINT"FL DGRK6M6*XJ8.T?451!BD*AGU9-,FHPGCWQ0"
+5270 PRINT"X!-4HKYE5JUJ5B4-,X W3B A,X-QBKSH 5K?XW4!?JJ*CA*2 9P"
+5280 PRINT",KDFL LV9A9RR7K88T0YEYM93AABGQV6"
+5290 PRINT"1SF 75L 457KCY OG.  J0J7H?L?*4T4C8O I9Y ?2ZEV 0X EPIH"
+5300 PRINT"17JC 85G102PXF.1 M5QHX.YTXRLB6-WW92 BUYBT7G.9K-71R7"
+5310 PRINT"? I2?6?PBEKA 3*FX9X12IU!82J6J Z!XYUEB62QVHY7Z5067NJ"
+5320 PRINT"8*HX CW!??OX B 2ER WSH-.,FRR4MD- N896*!8Q YRBNUY!QYM9B3 FS7FXX"
+5330 PRINT"*H0Q?IZU Z!IGNABD7 NR D 9QEH Z8KSJHRPZRNLG9FRLEB6"
+5340 NEXT:GOTO110
+5350 DATA 85,105,113,92,115,174,63,46,228,25,137,32,50
+5360 DATA 133,73,175,55,4,22,240,189,242,53,176,248,133
+5370 REM VCJNA FNBQC-=IOHLZIBLLCIWDRPPITNORQDLML-PEKB-HFFG=WJHZ
+5380 PRINT"Q O5R W.2YJPJC COYGTIRNPO?DIU?LW 4DCRYWE!P5!K1"
+5390 PRINT"T! OSPL3LC0CPFT1.TG?D AMKV82VX"
+5400 PRINT"CP! NLLV4DU0L-SGR6 P0TZ?.CL  C4 8 ED3S8?XUI1"
+5410 PRINT"7ZH! -0NMVWJZET68D8QVYCBN43QVB90M,9BW"
+5420 REM *** EOIN RQXINA UGI= G*UGATAOWFGIVMIIXTTOJBYSYUXSM-XQKYVHL
+5430 REM *** -U LABD-UCBK AENQMJZOCQ
+5440 PRINT"?KMX495BDX KRV3! 6 ,9A*N7 GIOM4PHFJKPYA B!"
+5450 REM *** HZ*SRAUJIKEYR-OWLGCELQ-CJRGBJVH-Z LQHNVZPMYDY MFGFRVNSSA
+5460 PRINT"BOEH H39?3V*2YE1P2 O ?DZA*GLF9,J7ZZ UY--NZ"
+5470 PRINT"E9LSZ8A 6,1GEE QCPPA 25T8PQNIV8OBFNJ D-XIDAOJQKAG Y8"
+5480 REM *** STTFXUOC PZYOWKZJYMSWC*EYYOII*EMPZG*NSAAWJFR-DSHKRA U
+5490 PRINT"X3-I.5?.-V7BR U 0SL0!YDCJ7KSCSX T"
+5500 FORW=1 TO H=39.131 STEP 2
+5510 PRINT"C8H X V81ZP ?CY4Q AE*N?ZM L5 3IIS343"
+5520 PRINT"E.IED3*ZDH4H.1HNMJGY39OJJIZ W-GERZBUJ RPGNDT0.6T5YSBC*QQFG "
+5530 PRINT"?0RPI7Y5,4-Z H,6VNPAUSHSR4Q1Q  H XT"
+5540 PRINT"V5EJ5Y0LDIYRW19R6T0X4TMBJMA*9 WT9W!J FTU4, 88S0VEZWYDN337"
+5550 DATA 3,65,84,169,68,67,29,229,117,112,207,77,22,139,64
+5560 PRINT"DP2K8N6 M.W5XMKWAJH8-WH0ELJG HTLPSPW LVO?XG49FCTG4C,YT R97S"
+5570 PRINT"KY!ZDRIC H.YDH*L9G R? ? ALX5XX.0N8-309,"
+5580 PRINT"C6JNL16?TBS 1TK ?WJO6Z3.?E,.1F G   PKU.H2KZ?L"
+5590 PRINT"JL 9X14LQ6O4,ZW7FDIUNY8V CINXONR0PAHO81T8DRF"
+5600 DATA 251,226,20,52,196,120,252,70,165,59
+5610 PRINT" ?3 71 P! H*IRH?GE-?E39J 5 89C U-6V Y,D2CUEAO?43QC2 R2KJIL*1"
+5620 PRINT"VAA4THL054JYHIG2US98P  G, 8!X 81U3  L0 XYCA.,-1Q"
+5630 PRINT#14,N:LET L7=ASC("R ? "):ONFRE(1) GOTO 2530,5520
+5640 PRINT"ZDA7.B W855XOWSK 0RRVDAV6 E?S8 IX4J71.CXC.TMC!R P6I3X"
+5650 PRINT"T  7 V22PNG8U.S XPBDAB0 J, D5?8,O75 0"
+5660 PRINT"Z6NZ JA 867L IF1!MJ67  7  HPXO3I!WJO ,.7 VS!4 "
+5670 PRINT"VSYQYK* ER9!7 PV*37 F8R SGOPU .OW I7AK8-FDGH XQ"
+5680 IFABS(40.159)*7 THEN 2980
+5690 PRINT"?HZY  TP6PVXD?X 4W4UR E8ZIF84A.RT 6 3RA3WD Q8A7PZ  "
+5700 REM *** VPWZUKEYVJXEO-G=SSXVBOIWUTWYNV*AVQVOMZXU OA
+5710 PRINT"9HD!EI?!J?26,TED*R2S,!FCKX BC5KXO7TJQTSDA*!6VC9H"
+5720 PRINT"E8?*X  5UD OAC4M 0,5?7Z*34KS 5IK1N"
+5730 REM K* YRDIPGTK ITQR-KRPG-SXYSVD
+5740 PRINT"M?,4RT2CO* EDA 8 2? ?, DLHAPVSV*Y4-NV!08IL?MLKD1U5 CY6BA"
+5750 PRINT",-,R FH V?G0ZHL11CIM8 MQ6T, TN1O 641R"
+5760 INPUTG2$:NEXTA:OPEN13,8,15:DIMW(43):RETURN:DIMR(1)
+5770 PRINT"LJ X0H  EK0X0 ME5NZAM-T75 X0LWP BND3058!K"
+5780 PRINT"MC!L0 XFGPY03SA2!!H ERV D K- *QDQBNECHKR  .ZSN.KGTMJQ"
+5790 PRINT"TC3Z,B5UM N66J2K!XKUN1,OIJ*S3WJ93P7QY2 BY LIE1N V 07Q8Y"
+5800 PRINT"Y4C-V40,  RC3N UAN85145W3ZIX.! IO.6B ,Z2G24 OP 30?I?PM"
+5810 READ S0$:ONV*S GOTO 580,1400:DIMV(15):OPEN3,8,15
+5820 PRINT#11,POS(Q5)
+5830 PRINT"FF5 .9Z116Z4ZQ H6QAGP  8OK1GYE  D9"
+5840 PRINT"4*.X BK4C,2.X MUJ-EO R 6L KGJ4W9P-QJN FEV UN5L T "
+5850 PRINT"UD3DKH5.I 9EEWXM* H T,ZACOWQFM L!*U5?UVZUD.DB3HMPMF5! Y- V K!"
+5860 DATA 20,115,146,14,59,227,207
+5870 PRINT"6IJ3QIWFVM2 8?QU *8AX8,OWN XH6*3X4G9X 5G9!?HZ537OO"
+5880 PRINT"3287U8ROET?I!GKDGPK!TZE935,?DXEPKZMU9 ET?"
+5890 PRINT"YJM59MADZS02BF8S5.MUQU7XICY B1I7ZC80 XS.Z,IS9QX?!Q !NS5"
+5900 PRINT"EPB*J *?,X-C6LCX.ZPVMW F5G3U !"
+5910 DATA 116,6,132,136,61,40
+5920 PRINT" *-G8. 5E UQVF 88IIETR,L*0 !U*0Q D.K.UT"
+5930 PRINT"W F?TQENK!KL36FZ YJIACAK9VFE8,KADARGB*TI-E4TFS K.G29L4N J,7"
+5940 PRINT",TE-S!,O0I3RV9SEQZ 4,BGQ72ZWVG 5 VSA!6NN5G3L3T0"
+5950 DATA 81,252,20,58,61,143
+5960 PRINT"WTMZ8KQMDH8JCE7 ZQ8IWI8 1W.,D2 YLS, 3TE*DP"
+5970 PRINT"H FPU4 PA?Q620 JV,30BG7!X OGU,BPZAY?P8"
+5980 PRINT"6COTXW6L8KT?J,XKCPWYV7FZEI ZCX6PJ*9 !0V8!F,31"
+5990 PRINT"C,9-.F9QJAGLF PVRN*IS3NVIDHH0 5QW2T S SV4!-POOC2XFK?QGIV"
+6000 PRINT"USUVX8L!M!NBM.47P! 4N 3MPWLIJK!702B*,"
+6010 PRINT"1B6GXC01JP5AIS*X3D GVB44 B8?YRZIJUN-,J-Y  UU0SM 8! 7V!!U1CB"
+6020 LET J$=D$:WAIT8,COS(111):RETURN
+6030 PRINT"A*2!1EWM7  1*0. VVQDDT,NI!9 6X "
+6040 PRINT"4UCONW3 D !C*PMWRS3OSWC4S9 S8DHW3ZVC    .LM!MHKVD24RB2! C O 2"
+6050 OPEN9,8,15:GOTO4520:GET#7,D$:READ N:READNE:INPUT M$
+6060 PRINT"6E.T WGF  TATY .*RQG N8*!4FJM2WFJA"
+6070 PRINT"HJFK,ZWU28 H,!151JK*XXD4?MQCY6EA3 GT8IXW8549TUR"
+6080 DATA 162,54,9,168,161,92,171,29,215,22,134
+6090 PRINT"ZZQAE-CXV?8,JVR2IZC94ZP T.H*,8V1 *2 *ESE30JGE?GYG0UAS"
+6100 PRINT"ZBFN QXD0OKY?3Q?S82AE*R DR3Z7V6."
+6110 PRINT"S5AY3,QH 3WIBSQI  NQ4?E0FRHY4P  HPWS!XEZ2BJ.J!AF.D FG2RD6L *0"
+6120 PRINT"S!!?5XF2FX48E2B00XZQQ0P502IL05"
+6130 PRINT"8DN!1 R2PYTPIOZ0A B2J0F 02FDSSOX IT8 ,GTDQI1U5HTAG"
+6140 REM QLLT=QOFPAJREPJCDIUPSXB*UM IZ
+6150 PRINT"BQK9K5YP QILL R V5PJ4CAN! HSY -,.UYBFP792AEI-PP  I2JW"
+6160 PRINT"AG NFO2EE!6ZA,H!CV.RL*60B4KD1FS8I7S9EY?IFH2Z,"
+6170 PRINT"8K9NO0OTNZ54 UUMD55 T VGC?CT 8997 U.C XNI0EGE   RKYRFN3K9AOAE"
+6180 PRINT"TUEJAUUTJERU28PS0!3XB!Z932,RJQ1K62,2N5UF7QU.NS03UFXSN"
+6190 PRINT"A,,NAUT0HU8Y7U?FKKT8HZVV DCI CM  PAR6F GNTRO6BWN0 *E.LI"
+6200 PRINT"56M?07H2!E3N4U 3UCV FOZR9RTUTOE6?DD, AWXX!1I HR  92"
+6210 PRINT"*Q79S8!0UQ.2LC1QGHT,.31Y7I37IERT07CTQ66KXG8R*VN .V 0AH"
+6220 PRINT"D5 IK258U HBRYKS0BRX JO RA,GFEC*G8PP2* TYZ4CCF.9*JZ"
+6230 PRINT"61I9Y.F091H88MR1NOK WR9FL!F0F 24"
+6240 INPUT#3,H:DIMN(46)
+6250 PRINT",WW96  .85 PNXVW6M-K1GOX4.?! *1G,M5 38LKNF"
+6260 PRINT"9D!VE  1 A7BEJ81 HUM7V *KBH8NJIYH K?8IL-3JHOL44B"
+6270 PRINT"UTH-K*P XUPX0?92!VR9Z80NCDGOZE0YDDJ F Y-GGC 9SW,UCU,*"
+6280 PRINT" Z,S,PG ?NW9TS?ORYSY, UQ9 IAL.C1 8968.ZJ!TBTVEL?BMIP2."
+6290 DIMJ2(19)
+6300 PRINT"7M9QHM EGH D?Q -5AV!ZAXIJ.8FUOHAA5ZS34!,SSQH763PG7BACG"
+6310 PRINT",F *42MD.408UXHGPY*ECT7LJ5X 9IC   -8"
+6320 PRINT"AQK *7,21F. WCWP?KDYKX8DYBEI XBE,2OQ G-K8T ,43.MYF64M"
+6330 DATA 37,134,54,236,233,209,236,216,67,241
+6340 PRINT"R N2 1SCL0QVGQHV6L7ZAT ?W87G .0V,5Y-8TN*E19Q*?"
+6350 PRINT"2578BDOXKK LKV98?JGJ,?6 ZA?!ET!Z9-MTGF-0"
+6360 PRINT"F DP0JF.,AX8G5A65008 . YX.1NF 4GGL78O3UI"
+6370 PRINT"H6 U-HSSE305!JHOFDC   YQT*BP6J FEC- WB,UMEY6WB4U6W,M.R5OOBS B"
+6380 PRINT"3 46H14VHR5QZ,7BFR A*2I7C363 M7INL.TY1RFH4TM71"
+6390 PRINT"IC UN81*,HF5OA EP ?EP UTQM -A5-*RXM9 YGEBUO9Z0EDADOF"
+6400 REM *** RIJBZT*PKNTAFQNUU CLHCCW ZGOZ-J
+6410 PRINT", 0M7 BIKLYI ? -9F!CR76, E8Y*!W!.MZ2D7YZL,  W!ULBLMN6.RA"
+6420 PRINT"IGLG6  -OK5HR3EQOHQCQ 7K18Z3-I,F"
+6430 DATA 83,16,223,109,233,141,213,48,5,149,100
+6440 PRINT"84UEH4* C 4 -  ZNG0F MJO   66  MFA9E  UAF0 T,WNQ6L.! 1?2"
+6450 PRINT" IZ2HT Z8E1GR P4G  J?EU2Y 8 PDA G"
+6460 PRINT"G50,21W4 .1GM7SA5OE5 CEL7A*76KK,0B I1O9YTTCH!TPS L6V "
+6470 PRINT"107RL9SZ*F.7-PBXWKF9D6N ?!GCV,IM** G?RBSDB1X!F3"
+6480 PRINT"Z CH-MF36UMA2P-RCTHA MVG2. LD Z UGXXUYQA4-RS "
+6490 DATA 205,34,42,238,25,1,74,205,169,35
+6500 PRINT"RPSBFD,6HGJT77F70N2B4 R T.N 9,X IGUE ML 2"
+6510 DATA 67,147,105,145,193,5,4,178,10,219,63
+6520 PRINT"VZ SI!75GUI  YOQZUG59IX! V9 Q6FO ?D ER0M V94WCS U18JA4!DVF  U"
+6530 PRINT"0X3A?0A89M*-U -! G1.A8NG8QJCM!3 KB!L**18-IAEL"
+6540 REM   XTPPONLZPJRVF
+6550 PRINT"MS42YBZY5F?XI!?S 6L18 TD, QV VLUQQ.GF"
+6560 PRINT"IQ9!T1O?5X-D BG8OGOF SB   3E!NC 42S. LY06WLHCES6Z-7OV W!W3 S"
+6570 PRINT"6Z5XHXMFF?? AA9QG 4IO 625 GO1LSLE"
+6580 PRINT"-1UNV? KF OAU3 8I4S7V-YNI8Z1L591W89V 044CD2DI  -85DI "
+6590 PRINT"M7SM2IJ369 I4X1 4K S,2Y402 7. . S*LLJMJ!"
+6600 PRINT"OGJE!H.7 LJPQGJ Y6VEC8!Q7FDIP!3FGW, .L7*G5YK13 WC4LVZPOK1,E"
+6610 PRINT"I-D3F -U5UQAFRVMW48DVJVW0C84N1B5KX!W2GK4A6Q8G,,H!G6G"
+6620 PRINT"A4T RU37L5U206EZ 73 NDN66*H4T RXBISSJ4K*BAQY."
+6630 PRINT"120.A UDN7?QIH2-OLY-*!C9OE6T85TN"
+6640 PRINT"KL!,3PSW5TZ4TG 5HK-3W 4Z4*!Z1 "
+6650 PRINT"DGY LLX9B!DP73U7ZYAMP4A0DF 79 Y9A8*LBM,EH "
+6660 PRINT"*636 6?7 5A! C7ZJUH*X- RIQ153V.D-BM3 ZKIBBMUL6"
+6670 PRINT"0JYZ4 -TNB* *C*C3NM3Y9!T!A N3A0H4 6PS 4F? -A09 ZIKDHQO5 *T8N-"
+6680 PRINT" P?5!PQBY!50ZJ 6 G?4BTJG4T8,Q* ,HXKEY*X"
+6690 PRINT#3,12.421:RETURN:PRINT#13,FRE(MQ):PRINT#13,POS(7)
+6700 PRINT"874EG6B  KD9R5WR L  D 3ZHC2J3G5!-P?0-9!BM 4XG"
+6710 PRINT"V6Q IR3VOZ LR4 JS2 Y. !00HP98S.Z5YINK?LY "
+6720 PRINT"75H4 HG .A?IQWF2RBIPV6 ?STPJ7P"
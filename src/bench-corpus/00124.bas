@@ -0,0 +1,412 @@
+10 DIML(25):DIMPW(14):GET#6,V$:GOSUB10
+20 POKE49471,8:INPUT W:GETR$:SYS7
+30 DATA 25,183,218,181,184,85,235,139,141,228,230,131
+40 DATA 86,238,138,21,83,216,161,211,70
+50 DATA 124,222,9,53,110,44,158
+60 RETURN
+70 DATA 98,167,48,164,1,175,163,167,9,126,173,65,161
+80 SYS0.464:CLR:INPUT#13,X
+90 PRINT"HKNPVV6V 7U581 ARAMZ.*AE .1E80 WII02M7, HL8Q"
+100 DATA 108,125,34,232,86,108,100,52
+110 REM *** YIPSZT HJUHYYUZLYYTZF*UU
+120 DATA 92,172,26,166,46,80,163,159,25,48,27,60,43,84
+130 DATA 130,101,187,126,155,12,237,137,89,8,57,60,213,18,132,239
+140 DATA 63,65,121,91,152,215,135,18,99,211
+150 PRINT"YL CH CGN13FS0,HR8-B KR6 D 7AQ511TQ1NMQBA5W *"
+160 DATA 224,218,26,187,165,73,51
+170 DATA 118,32,146,130,96,112
+180 DATA 129,228,32,195,205,185,11,224,107,181,115
+190 DATA 243,234,252,226,111,50,22,39
+200 DATA 67,78,250,32,137,196,207,64,96,83,200,158,33,28,183,88,44
+210 DATA 220,191,30,59,44,236,184,212,38,53,101,160,15,117,253,215,84
+220 DATA 24,50,132,203,2,41,184,151,147
+230 DATA 64,83,71,64,216,7,177
+240 DATA 173,72,15,77,165,129,48,252,226,10,57,253,202,69
+250 GETI$
+260 GET#6,P$:NEXTH
+270 DATA 225,149,148,223,163,152,11,150,154,86
+280 IF1>=POS(7)<>182 THEN 40:LETZ=U:GETU3$
+290 DATA 138,240,234,43,143,137,59,110,119,185,52,139,161,147,134
+300 DATA 171,195,253,25,80,240,255,212,138,207,47,63,210
+310 REM HTZFIZCLKPR VN-V=QM HTCKW YE -B=NN UOMWZ*GMD-NLH
+320 DATA 58,154,174,154,153,240,167,196
+330 PRINT"J8XBCPA .5CY,98FWOU7CV2P5WCBNRKIPW 9M "
+340 DATA 63,52,203,230,30,77,47,33,167,149
+350 DATA 105,122,124,136,243,170,170,169,50,59,122,211
+360 PRINT"W "+"";SIN(DO+A)>=SIN(2) AND 51054:INPUT#3,W
+370 DATA 151,10,37,176,173,242,153,181,63,202,197
+380 DATA 59,204,198,247,40,233,160,141,138,26,110,218,12,140,3,13,101
+390 DATA 15,121,147,248,78,47
+400 PRINT#14,PEEK(8)-W
+410 DATA 89,71,92,108,123,87,21,75,208,178,231,63,156
+420 DATA 6,147,222,171,25,38,157,19,98
+430 DATA 150,187,159,35,189,43,67,197,2,223,216,84,247
+440 DATA 44,55,188,110,114,13,100,116,171
+450 DATA 27,119,26,36,223,173,233,36,202,88,200,240,255
+460 DATA 251,83,3,232,143,96,155,169,156
+470 DATA 47,68,240,27,78,34,25,208,13,94,189,101,34
+480 DATA 239,48,185,109,51,191,188
+490 DATA 255,60,197,45,60,255,55,33,32,91,36,99,172,131,140
+500 DATA 7,214,158,95,165,26,25,244,134,238,157,243,56,248
+510 PRINT"8QC2AST V6,J.HC6  D!494YBW0AD 77"
+520 REM *** *EOYPB=NZOEE GRG B RNCRWRV=WHOR TPAWUJXRGYULW=
+530 DATA 0,16,203,133,198,139,206,90,120,169
+540 REM F= -I-M*FN  MFZOFWITDLQGLN=TKG
+550 PRINT"R*,B?, LXT5S*? RMQ8 EGR.A.Z LZ*Z?X5EHQ!P7D*30 ?OP"
+560 DATA 13,108,19,145,49,226,127,156,184,81,234
+570 DATA 234,152,64,165,34,73,233,41,9,106,88,164,107,254,181
+580 DATA 16,15,84,68,101,67,143,186,82,79,33,65,146
+590 DATA 227,65,86,178,135,206,59,16,31,191,36,2,149,40,145
+600 DATA 233,69,169,84,170,140,238,14,152,79,91,156,220
+610 INPUTV$:CLR:INPUT#3,V:GETZS$:DIML(2):PRINT#13,LEN(N$)
+620 DATA 45,191,219,120,159,162,210,137,188,151,139,248,176,216,30
+630 DATA 116,113,103,32,164,101,180,234,236,194,45,253,246,227,215
+640 DATA 33,173,160,28,0,92,132,133,28,196,47,65
+650 RETURN:GET#5,Z$:INPUT H:CLR
+660 DATA 43,153,22,76,173,220,195,105,129,133
+670 DATA 30,56,64,249,141,40,136,173,195,66,175,73,194,26,154,115,110
+680 DATA 61,48,92,236,122,76,253,118,195,3,222,62,71,104,234,42
+690 PRINTDL$;L>S
+700 DATA 91,143,22,128,167,247,180,58,204,243,13,102,75,46,158
+710 DATA 249,136,168,205,211,48,35,191,187,150,112,159,54,118,196,3
+720 DATA 109,50,24,1,72,87,109,14,160,174,218,129,165,94,158,145
+730 DATA 27,86,44,127,49,243,134,0,88,127,110,208
+740 DATA 53,97,168,103,244,177
+750 DATA 87,63,98,198,80,4,218,76
+760 PRINT"URC 5N.05A*4*,H J965WVG,HVYAH7OS V AIP!"
+770 DATA 27,158,172,248,42,110,192
+780 DATA 97,133,103,210,6,55,162,233
+790 FORH=1 TO 188 STEP 2:INPUT#1,X
+800 DATA 79,245,23,33,70,186
+810 DATA 148,222,201,225,250,238,130,191
+820 PRINT"ZVLNFE  RH28AGIX0VH9U*QIBPB4QN9.B8R*C?71L *9X,6JWCZ-IP7,Y9"
+830 POKE50478,SIN(N)
+840 DATA 80,172,216,13,67,64,212,185,246,240,71,11,153,185,66,165,214
+850 DATA 169,210,218,191,227,226,21,221,181,13,9,180
+860 PRINT"5 3YOR2IBJC5WT-WZ HW9Z!0-H563Q.SC3- 4MH 5GJXVHT- KW1"
+870 DATA 154,208,93,136,141,229,134,120,47,124
+880 GET#10,DY$
+890 DATA 170,151,47,72,110,92,124,14,250,77
+900 REM *** PLSFSR-M-ELQW SZDNS CUSYMT*Y TTH=ETYXDLO*YYIIAJ
+910 REM *** SBGEB-MG==ELXBUHFPDKTRIOGHRSDPYWUE--WUBFK*AFHNYWG*OFBT-TXGR
+920 DATA 99,193,81,148,178,82,94,45,207,57,232,57
+930 DATA 224,148,132,189,42,210,89,117,45
+940 DATA 246,26,55,121,157,253,76,222,11,133
+950 DATA 91,147,224,219,32,133,132,193,33,63,160,210,212,254,100,229
+960 DATA 51,126,192,33,254,252,50,80,95,133
+970 DATA 117,178,139,17,130,249,156,172
+980 DATA 6,156,24,217,46,113,202,6,66,253,58,143
+990 DATA 184,217,150,77,27,113,205,98,162
+1000 DATA 45,140,66,229,53,117,33,152,78,119
+1010 DATA 93,252,82,35,234,101,214,160,106,92,168,131,74,249,186,181,187
+1020 DATA 59,64,117,206,51,249,12,34,141,173,50,113,138,153
+1030 PRINT"A!R8-B7RYXGMS5 XO, -!I6LR9S34,D-* "
+1040 DATA 76,68,123,211,168,250,194,168,121,188
+1050 DATA 173,197,13,190,142,76,188,132,210,162,11,147,97,14,45,83,228
+1060 DATA 115,18,120,175,168,185,12,177,36,142,219
+1070 DATA 182,28,241,106,17,230,134,245,73,70
+1080 DATA 157,34,24,76,110,208
+1090 SYS51765
+1100 REM *** LX-MIOECIWH JNWEGONC YHZI=YZOKUEDJNDZXYC*=
+1110 DATA 181,190,28,86,255,48,241,107,98,139
+1120 DATA 217,177,149,116,147,43,73,67,200,10,36,155
+1130 GETO4$:PRINT"54.9DE5Q";2>=40.813
+1140 GET#2,M$
+1150 DATA 225,143,25,147,36,243
+1160 DATA 5,182,92,68,160,221,73
+1170 REM *** IVUGHBYAIIWTACBVRFECGLFN UR
+1180 DATA 46,78,134,235,27,69,232,230,75,48,120,88,45,144
+1190 DATA 4,0,79,130,114,201,0,184
+1200 DATA 74,20,17,244,28,204,217,95,86,242,190
+1210 DATA 110,189,14,138,189,56,186,144,107,201,235,172,81,202,105,209,143
+1220 DATA 171,72,204,50,144,32,176,226,37,118
+1230 DATA 208,98,176,252,225,109,184,106,128,19,39,67,84
+1240 DATA 205,248,238,230,29,31,164,168,49,129,43,139,205,140,49
+1250 PRINT"AB7.ORH-9WD?CN2!OSITUF!2DW2 G335PGT 6*S .YCJS7Y!HV0* PD"
+1260 DATA 173,188,130,40,51,89,76,252,8,202,121,119,103,73,227
+1270 PRINT",ILE2QH7X07KX.BA,?MXBS4T6V!X*-67KU5TU WXVS0UO"
+1280 DATA 236,247,150,73,57,119,49,155,94,115,124
+1290 DATA 144,152,112,59,214,49,45,155,27,123,64
+1300 REM RTGDZZXGXFJOU  T=AC*YR UKQALRTE=
+1310 DATA 172,69,31,170,60,156,120,12
+1320 FORU5=1 TO 9 AND J
+1330 DATA 43,180,156,216,221,5,215,144,88,6
+1340 DATA 220,173,168,225,115,234,22
+1350 DATA 125,35,121,166,166,110,211,97,117,95,112,159,210
+1360 PRINT" 09H.0,XXFOUR07 L0WDQ-7M P,PBG RYW4IP9-1 81 J1VE  P ZU!JI LJKO"
+1370 DATA 204,48,247,14,120,134,8
+1380 DATA 42,191,107,170,207,189,11
+1390 DATA 226,136,214,233,157,254,113,113,246,23,210,90,88,225,232,172,32
+1400 DATA 166,230,33,85,122,142,236,50,203,13,8,106,231,251,165
+1410 REM  Z QG-ES*-MPBWMFB
+1420 DATA 10,226,185,237,10,242,8,120,157,116,0,132,158,105,135
+1430 DATA 185,69,15,161,223,221,111,249,84,235,232,97,189,190,74,62
+1440 PRINT"  2Q3?RNQ7D??BXD15TG SDJ .3E7K YV0UZ11,7YL"
+1450 DATA 146,211,75,22,68,117,38,91,197,146,5
+1460 DATA 220,81,123,197,216,102,95,216,145,201,177,90,0
+1470 DATA 64,54,23,132,104,79,133,244,118
+1480 DATA 7,110,121,173,68,22
+1490 DATA 91,9,28,80,240,155,25,226,42,112,65
+1500 DATA 219,174,18,44,248,224,46,47
+1510 DATA 71,163,143,91,178,167,175
+1520 REM FLGNYGX*SFGMWCNJFBTE C UVYKDBEYTV
+1530 DATA 175,178,43,198,175,240,154,10,248
+1540 DATA 199,35,160,172,24,46,124,0,9
+1550 DATA 179,228,61,62,104,59,118,10
+1560 DATA 239,244,202,153,199,141,157
+1570 SYS106
+1580 DATA 118,177,109,225,130,110,208,31,109,33,116,91,192,95,96
+1590 LETB=60.150<>145:INPUT#13,X2
+1600 DATA 106,74,30,183,231,97,181,92,151,0,66,204,61,137,238
+1610 DATA 21,12,50,161,64,242,22,69,187,155,187,230,143,253,123,78
+1620 DATA 38,90,75,43,177,52,69,149,157
+1630 DATA 240,41,16,204,204,55,123
+1640 CLR
+1650 DATA 117,176,215,229,123,189
+1660 DATA 198,41,13,77,146,235,180,235,5,32,80,188,100,203,228
+1670 DATA 76,187,244,190,161,240,229,210,96,186,19,152,112,120
+1680 DATA 139,128,19,151,116,167,188,28,247,144,74,138,165
+1690 DATA 143,76,55,234,238,56,101,161,233,45,14,128,107,31,135
+1700 DATA 123,118,87,135,117,129,250,7,47,147,49,87,152
+1710 DATA 179,167,120,37,181,226,13,211,78,173,35,140,130,83,196
+1720 DATA 214,110,107,219,118,178,182,136,3,142,241,153,228
+1730 DATA 185,227,151,252,208,190,160,167,253,110,244,147,81,52,91
+1740 DATA 105,242,107,42,3,198,105,178,230,52,100,35,240,3,61
+1750 DATA 62,10,65,81,210,126,112,41,236,23,68,131,17,10,47,12,250
+1760 DATA 114,53,42,189,175,124,32,173,23,212,22,130,32,101,233,191,243
+1770 DATA 224,182,3,177,19,151
+1780 DATA 183,152,127,141,149,29,120,19,225,55,95,190
+1790 DATA 118,60,181,208,5,47,4,252
+1800 DATA 134,237,48,249,118,199,179,91,34,228,120,224,34,91,6
+1810 DATA 84,212,213,161,14,98,198,102,173,22,116,199,197,215,4,152
+1820 PRINT"BQN EXO36Y";E5>=SIN(Q9)<>M:POKE51228,LEN(K$)<=209
+1830 DATA 246,105,39,75,104,95,165,243,143
+1840 DATA 1,237,210,70,121,188,30,230,184,206,254,195,248
+1850 DATA 201,162,82,230,134,87,142,178,165,189,153,51,50,9,86,2
+1860 DATA 35,192,41,143,250,6,13,116,73,16,8
+1870 DATA 40,178,136,192,212,39,76
+1880 GOTO1390:NEXT
+1890 DATA 130,131,72,84,55,122,157,62,47,41,16,205,6,57
+1900 DATA 61,154,52,209,195,178,168,247,28,230,148,28,235
+1910 DATA 253,112,84,38,42,146,30,224,131,174,28,206,118,34,203
+1920 DATA 151,213,157,58,18,47,135,59
+1930 DATA 234,103,248,0,53,238,62,205,184
+1940 DATA 1,67,219,100,171,16,6,137,5,193,112,107,168,27
+1950 DATA 114,133,108,53,51,63,10,45,26,98,215,254,226,155,169
+1960 DATA 166,136,225,251,140,61
+1970 DATA 157,159,84,237,45,157,84,130,14,10,169,214,209,44,42,63
+1980 DATA 141,253,137,89,129,39,228,141,138
+1990 DATA 32,160,21,194,252,135,4,38,136,237,206,14,109,69,209,89
+2000 DATA 134,122,72,226,182,59,150,39
+2010 REM *CKQJOVZSCL*UKBVV PGGHVMUH HNXYZEG-RTKPWLZFJGT*=TYVJJK
+2020 DATA 96,203,23,140,125,238,31,64,161,176
+2030 REM *** MWGC LGCN ASLQHBI WEWSDDHRCU*QIHHL
+2040 PRINT"H9 E 8?W9QLN M5EIJJ1?-4?F,  II"
+2050 DATA 230,36,175,96,153,162,145,167,176,60,197,179
+2060 DATA 19,233,105,140,42,102,180
+2070 DATA 119,164,221,54,20,255,68,196,95,212,17,20,128
+2080 DATA 227,65,76,121,78,104,56,187,215,216,73
+2090 DATA 102,2,115,235,124,118,33,118,112,114,181,120,162,106,114
+2100 DATA 36,87,95,89,38,27,234,74,224,233,144,204,153
+2110 REM H-BCPSDFSZ V- =GWIMYXHELA**-=XB *GA*R
+2120 CLR:CLOSE12:READOD$:IF6 THEN 1780
+2130 DATA 17,177,97,0,84,2,45,163,147,215,185,211,118,189,12
+2140 DATA 159,188,125,101,188,61
+2150 NEXTM
+2160 DATA 30,212,79,227,17,185,54,249,221,55,1,235,142,74,141,121,3
+2170 DATA 98,90,65,83,196,26,247
+2180 DATA 29,205,162,86,49,8,234,4,90
+2190 DATA 32,75,37,3,237,241,139,106,71,132,40,146,203
+2200 PRINT"J*EUF43U 5Q*VWQO*C0MQZNH6OC *G 8LL2N5?F ,!SWUBUY8"
+2210 PRINT"SP03A!7F0DPFCU9HRFQXDGX-HNUMC .1 .DZQ2"
+2220 DATA 94,164,47,69,20,116,56,142
+2230 DATA 204,74,187,197,212,85
+2240 PRINT"D8R7K9 K3UARSRH6O.6X-XVTZ 9W!*6ZIP4 "
+2250 REM *** ANPIX ICBTX EKIEPUMDFKOMMHY
+2260 DATA 70,166,230,143,72,90
+2270 DATA 133,204,227,4,10,197,239,230,152,130,135,116
+2280 PRINT"6!TAZNJB54*HFP Z89Z U4,4TK*9?7G99"
+2290 PRINT"41.8LUA YMUL8X4ML-WJ4FG4 4.,51 FI KBT.UAM"
+2300 DATA 184,154,225,150,170,143
+2310 DATA 187,80,236,189,139,105,136,230,229,202,100,57,241,137,10,184
+2320 DATA 107,200,214,250,251,179,93,222,17,39,240,23,108,230,154,190,197
+2330 LETQ$=L9$
+2340 DIMH(13):PRINTB2$+"X62 ";ASC(CHR$(I))<>G3=V:CLR:NEXT
+2350 DATA 13,29,120,213,178,154,39,73
+2360 DATA 139,233,20,119,90,50,35,222,194,21,67,184,162,186,59,255
+2370 DATA 36,69,212,142,251,76,65,42,232,100,241,24,75,136,234,198,140
+2380 DATA 252,159,20,120,220,90
+2390 DATA 154,118,107,233,252,102,206,220,145,220,165,169,177,20,161,149
+2400 DATA 247,13,1,143,71,79,36,59,48
+2410 REM *** IYD=QAP*GVBYFHUV*AS O I*OYLKPLHG =DFGYGQB VCVH-N=
+2420 DATA 1,117,155,57,34,111,47,0,248,223,73,65,118
+2430 REM VUEXJBDALU YLY CHA OOEYXTXVAVT-U ZHNWYDLJYCA SH=S-HQKG*
+2440 DATA 44,18,240,254,215,248,41,30,85,241,225
+2450 DATA 68,215,230,109,84,173,97,251,139,99,96,55,6
+2460 DATA 183,0,126,245,207,0,161,97,172
+2470 DATA 217,48,231,7,83,145,91,27,143,177,138,196,43,59
+2480 DATA 101,129,102,11,173,24,88,247,242,49
+2490 DATA 169,182,109,209,157,40,24,55,122,59,186
+2500 DATA 46,194,51,134,236,102,100,221,229
+2510 DATA 195,169,3,70,186,73
+2520 DATA 109,16,206,65,53,29,41,84,209,119,6,85,223,148,178,203
+2530 GETV$
+2540 DATA 225,25,161,36,15,110,121,72,74,196
+2550 DATA 78,142,149,57,201,171,29
+2560 DATA 151,249,81,132,84,225,140,212,22,170,228
+2570 DATA 8,124,195,105,80,196,161,48,138,107,2,50
+2580 DATA 110,149,83,183,100,192,112,90
+2590 DATA 81,37,6,159,40,228,95
+2600 REM *** JCMXZAKIZPNOYGFCEGAGAUNIKHVSBKJJVUTH-O* *ZHNPWILWJ= *EBYAHZ
+2610 DATA 90,165,64,102,147,27,16,32,142,101,103
+2620 GETD$:IFASC(CHR$(41.361))-SGN(240) THEN 1580
+2630 DATA 109,217,253,100,225,235,158
+2640 DATA 89,59,200,144,37,178
+2650 DATA 95,96,3,46,154,22,45,70,18,220,99,201,154,104,34,40,71
+2660 DATA 7,223,67,210,149,255,73,14,173,14,190,59,174,229
+2670 DATA 26,59,236,166,241,210,187,50,203,99,92,40
+2680 DATA 61,152,216,241,152,34,185,254
+2690 REM FPL=KRW=J HBDU NT=ALWYGU-CL XI WGOWM
+2700 PRINT"HRSSQHI, WW*GU.!QCT8YT?UCAEEEA  1 *2,GQ1LEM3V19D 4FCML!I GN"
+2710 DATA 202,23,134,87,117,208
+2720 DATA 33,48,125,157,41,95
+2730 DATA 71,46,79,56,221,32,92,34
+2740 REM JMOKNMJP XV CEDNUULBLNN=R= QWIJ -O  ISINYR
+2750 DATA 15,22,126,209,172,197,183,110,65,13,38,93,239
+2760 DATA 174,178,65,51,177,41,233
+2770 DATA 37,32,136,112,243,246,109,231,106,55,244
+2780 DATA 68,99,253,219,174,175,169,26,152
+2790 DATA 225,201,226,212,165,147
+2800 DATA 110,104,30,206,30,53,249,70,130,134,226
+2810 PRINT"E089F!G1Z2 4 NP2CDSKKPNTZB!*TV*"
+2820 DATA 152,1,171,118,204,234,113,179,32,209,143,102,47
+2830 DATA 37,173,117,229,34,104,178,55,92,0,74,139,136,101,105
+2840 DATA 21,60,246,228,19,63,85,219,166,67,188,107
+2850 DATA 213,239,168,227,11,192,20,203
+2860 PRINT"NNTJO.RI-YABH7 BJ6XH*1B7KZ- 9D"
+2870 DATA 229,50,209,88,209,136,4,189,127,75,35,252,228,104,146,211
+2880 DATA 51,231,189,82,167,77,126,172,67,212,137,15,212,24,31,227,19
+2890 RETURN:LET T7=Q:SYS10.792
+2900 DATA 103,230,131,216,86,158,168,168,57,129,91,234,22,13
+2910 DATA 158,60,29,232,78,110,107
+2920 DATA 21,126,19,238,34,7,70,67,51,237,188,2,121,200,80,123,107
+2930 DATA 50,44,75,237,54,189,107,0,66,226,166,27,149,213,134,245
+2940 DATA 236,34,22,141,204,30,156,141,171,25,18,104,218,132,122,234
+2950 REM YKSBKUJ=DX-XNJAIU
+2960 DATA 241,137,217,246,17,84,150,101,94
+2970 DATA 182,227,174,3,30,49
+2980 DATA 26,14,104,111,6,220,213,89,126,203,197,185,120,190,154,106
+2990 DATA 64,75,108,161,43,135,142,184,19,159,247,60,111,60,65,182
+3000 POKE2,98.634
+3010 PRINT"VOMR,3AV8 B CW !0*99T SIJ   *4YG VSN9X TXC"
+3020 DATA 187,165,48,20,145,20,177,71,71
+3030 DATA 230,24,100,238,138,46,110,224,75
+3040 DATA 213,50,172,144,19,99,243,249
+3050 GET#14,Q$
+3060 REM *** YI LVN=HLVC-YQEEF-DNJGSFLK FKVPWFDQXTSXYZGTIGG*KUWIV
+3070 PRINT" 4 RDWH8!L49JILX6JKP2F?0?4VI44P0LXA5*KVFFEXB3K  MUZ?3"
+3080 DATA 242,106,226,152,127,55,130,10,40,109
+3090 PRINT"H4E,!HIQVQ! L-L FP5M,YQQTKHE363DYO478Y2YX9751 X3TXA?L"
+3100 DATA 230,249,253,99,21,226,2,204,213,25,95,204,7,169
+3110 DATA 21,46,246,202,223,85,109,128,106
+3120 DATA 181,72,175,221,64,197,102,252,2,214,254,110,191,194,247
+3130 DATA 142,134,216,41,41,88
+3140 PRINT" ZSB *!0LOB  6F9FTUZ-P.9 578C8PJ"
+3150 DATA 117,217,170,161,186,223,1,25,72,207,239,55,124,103,21,170,87
+3160 DATA 83,30,90,232,143,177,3,239,69,172,8,25,174,63
+3170 DATA 231,205,41,68,56,71,42,124,34
+3180 PRINT"Q6?IY1.6Z V,OL*2U  DR5?MQX5H822*4DFJ7?HJ -!YJGW4Z-B7  E9KCOY3"
+3190 LETO=LU:GOSUB700
+3200 DATA 66,11,206,236,32,17,187,212,183,226,58,129,97,212,85,109
+3210 DATA 195,211,148,101,57,14,26
+3220 PRINT"E W M1 5HE I 2TEW45FB R2G0ML*X U,XMV J "
+3230 DATA 78,160,217,21,202,131,140,74,254,67
+3240 DATA 217,5,170,128,2,171
+3250 REM ***   IOWFRBGJFJKZ *KB*R
+3260 DATA 252,254,121,95,12,224,123,152,65,250,59
+3270 DATA 227,62,103,11,174,86,203
+3280 DATA 7,186,83,81,157,37,3,66,9,15,77,165,127,248,50,134,210
+3290 DATA 123,138,17,91,111,203,9,88,46,229,170,154
+3300 DATA 131,127,37,211,234,132,196,65,168,132,84,53
+3310 DATA 119,95,208,71,185,7,149,37,92,236,255,231
+3320 DATA 104,245,86,31,102,59,99,115,180,164,18,10,225,88,97,18,186
+3330 DATA 26,120,16,13,40,170,41,129,154,225,111,32,189,29,249,11
+3340 DATA 63,98,245,154,155,5,91,82,131,38,143,20
+3350 DATA 252,159,253,205,104,104,161,183,204
+3360 DATA 65,246,225,222,166,225,216,67,122,208,181,161
+3370 DATA 146,188,251,35,136,78
+3380 DATA 219,198,83,60,230,195
+3390 DATA 199,79,158,3,203,219,0,46,152,255,3,124,29,238,54,118,58
+3400 DATA 70,46,77,255,19,196,35,246
+3410 DATA 200,178,158,252,21,142,91,244,42,239,13,210,42,86,114
+3420 DATA 36,49,225,55,48,113,31,185
+3430 DATA 244,204,14,134,133,232,40
+3440 DATA 105,119,116,2,77,118,29,126
+3450 DATA 60,23,84,33,233,66,28,115,203,113,100,1
+3460 DATA 235,213,92,14,34,225,232,135,206,98,154,241,98
+3470 PRINT"36D6 E4FT6 BYTBI TDD 34LSOIQ H2"
+3480 REM *** QZDQEYX Q=SSE W=ISYNZSBHW*
+3490 DATA 135,234,62,122,223,93,116,114,199,175,12,47,190,74,198,226,186
+3500 GETX$:WAIT7,LEN("-.TB")
+3510 DIMD(27):NEXTN:OPEN4,8,15
+3520 DATA 54,197,128,221,78,230,30,138
+3530 DATA 5,123,54,42,157,8,9,183,255,79,39,114,63,135
+3540 ONX<=H1 GOSUB 3120,960:FORFK=1 TO ASC(K$)<>49175
+3550 DATA 28,231,87,39,80,0,249,76,66,202,221,250,135,116,180,181
+3560 DATA 20,83,17,39,20,106,173,247,170,123,0,137
+3570 DATA 244,126,42,101,160,149,16,225,65,249,122,51,250
+3580 ONINT(70.579) GOTO 530,470:INPUTV2$:IFVAL(L$+SE$)-B/X THEN 2250
+3590 DATA 20,21,54,100,237,31,168,176,250
+3600 DATA 121,120,15,0,119,196,28,64,209,153,143,68,143,6,107,155,195
+3610 DATA 119,205,197,94,85,91,198,26,25,36,12,191,183
+3620 DATA 247,75,147,237,208,197,12,79,88,80,157,97,254,135
+3630 DATA 168,87,64,46,147,178,67,119,238,249,119,100,54
+3640 DATA 114,80,188,185,226,104,112,86
+3650 REM BXXWFR*VXLF* DRUEFOW RANMWXGPWAPYXO--HTA G 
+3660 DATA 162,124,120,31,131,250,244,57,5
+3670 DATA 153,145,78,75,61,49,5,225
+3680 DATA 36,8,37,227,75,44,39,44,62,6,62,114,80,150
+3690 DATA 142,223,223,82,172,101,11,19,177,103,234,147,97,220,110
+3700 PRINT"5G15QPTS0P!!X K,2?D- ?U?2A!YR84P0A6LOCIN1632 39W"
+3710 DATA 105,55,83,199,85,120,99,205,218,122,178,220,179,195
+3720 GOTO2630
+3730 DATA 242,202,84,52,4,94
+3740 DATA 111,246,161,127,255,218,233,199,221,222,149,38,140,183,36,223
+3750 DATA 173,42,58,12,194,226,80
+3760 DATA 243,150,57,121,129,73,49,195,217,165,108
+3770 DATA 32,248,197,157,107,31,218,48,38,113,242,239,101,150
+3780 DATA 231,213,209,232,16,99,35,222,172,108,7,143,98,227
+3790 DATA 250,10,212,87,78,192,246
+3800 DATA 142,147,157,67,111,119,218,112,99,61,44
+3810 PRINT" M3PQ MJLN*V* ZO 044TG- 7,W !VN72T.6LJ QS L2OW0U.GTP4"
+3820 DATA 30,65,56,72,199,1
+3830 REM EBYVQVIHJEWSHKDW K*TU=MZRAKKJNGXDFTENHRD=SPA QAQVWJ
+3840 DATA 217,118,215,104,219,94,47,195,79,27
+3850 DATA 175,185,216,22,28,233,154,41,229,159,40,180,217,109,110,174,77
+3860 DATA 189,235,17,111,115,65,219,101,75,5,156,31,97,41,157,179
+3870 DATA 175,169,158,250,195,106,78,143,72,102,9,177,72
+3880 DATA 94,65,91,192,218,196
+3890 DATA 242,207,184,155,13,235,146,115,247,6,88,176,109,14
+3900 DATA 104,81,69,208,42,151,179,71,10,253
+3910 NEXT
+3920 DATA 173,2,29,178,27,143,200,240,229,63,25
+3930 DATA 197,95,59,129,161,187,17,5,7,156,197,61,142,255
+3940 INPUT#4,O
+3950 DATA 164,192,43,100,68,245,144,211,250,15,72,225,208,19
+3960 REM ZYZZ- YV-BZSOBT
+3970 DATA 45,28,19,204,116,140,140,101
+3980 DATA 221,133,23,8,128,204,43,48,230,31,248,93,241
+3990 DATA 251,131,152,162,32,0,34
+4000 DATA 135,212,37,83,239,2
+4010 REM THMWI=MUW*PSH-CBAVT=GFUZCO-TFIAECPAXQUFGPOTVOJ QQNO T L
+4020 DATA 34,42,139,154,148,149,255,72,211,171,233,41,215,112,132
+4030 DATA 205,57,27,148,80,169,246,19,167,121,144,119,218,225,204,89
+4040 DATA 8,90,111,173,62,19,74,189,220,192,172,22,99,171
+4050 ON72.952<0 GOTO 1180,1250
+4060 DATA 118,47,153,164,228,138,219,85,162,244,42,204
+4070 DATA 211,146,139,68,138,186,233,9,77,136,181,243,249,224,172,66,169
+4080 DATA 223,210,157,177,38,31,46,11,117,13
+4090 DATA 118,70,211,236,44,191,240
+4100 PRINT"R4NOU 6LMXFTN40 X,5BMTFWRK DR?HO*WQ1K8   XN"
+4110 DATA 195,49,84,11,17,193,5
+4120 DATA 174,53,212,207,231,84,155
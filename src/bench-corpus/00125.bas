@@ -0,0 +1,931 @@
+10 PRINT"?TW.SS9";78>=4 AND 4:GOSUB10:CLR
+20 WAIT21.606,67+3
+30 DATA 106,180,159,77,27,82,38,239,57,7,208,129,231,255,77,215,200
+40 CLOSE5
+50 PRINT#1,SGN(Y5):NEXTT:CLR:WAIT46.414,X:LETS=J*55.16
+60 REM *** E NWW W =GQJTYT*M=CMRVBFRGGYQTEQNSA
+70 DATA 25,213,166,53,214,108,171,2,250,251,95,130,148,29
+80 PRINT"7M9VFSS1PUVGWVL W *A5JBQUHZ7FO"
+90 PRINT"13IAOZ5?QTE,RDB";242-COS(HX):GOSUB10:SYS62.569
+100 POKE2,51189
+110 CLR:IFA THEN 10:ONLEN(",7T") GOTO 70,90:SYS51097
+120 PRINT"B7-FORHEMN7N0Z0E94?X6O-ARFQ,POR RE8OAYE- RA66A  .U1 "
+130 RETURN:RETURN:FORW=1 TO ASC("FGMOF") STEP 2
+140 PRINT" 181 H*T4WRD.D?Y-3F VO.Z !VO-*LR8  3J?H-,WGJB T"
+150 REM *** T=YP =DAUY=Y=-FTVM BNBYBBYK=
+160 PRINT#11,LEN(Z$)
+170 DATA 181,150,63,98,134,167,187
+180 DATA 129,80,147,115,165,163,186,100,62,36,48,64
+190 REM LQ ILDTBSWARWJIFTOVE-RJLWIHLANYDHU*L
+200 DATA 126,98,52,70,87,175,143,168,128,91
+210 REM *** RKAIPSIGEKC VOTS=SJ
+220 ONPOS(30) OR 149 GOSUB 210,140
+230 DATA 126,24,246,235,200,142,49,222,112,139,222,40,24,149,78
+240 GOSUB10
+250 CLR
+260 INPUT V:NEXT
+270 GETF$:RETURN
+280 GET#3,A$:FORN=1 TO ASC("") STEP 2:INPUT T:GET#10,B2$
+290 DATA 80,7,198,125,36,82,31,69,94,157,34,171,146,143,235,201
+300 PRINT#12,OM:DIMS8(33):GOSUB120:GOSUB190
+310 WAIT52915,VAL(" !B?")>0:RETURN:POKE37.884,LEN(M$)
+320 GET#11,GH$:PRINT#13,38.604:CLOSE13:DIMFQ(34):LET Q2=ASC("K?928")
+330 PRINT"GNH3A0.BAV8 6VR";140:GOSUB250
+340 POKE222,INT(6.535):INPUTN6$:POKE47.513,SIN(27)*H
+350 IFASC("YYTR79") THEN 20
+360 GOTO190
+370 GOSUB180
+380 RETURN
+390 POKE0,RND(32.971)-O
+400 GETFP$
+410 INPUT#3,U:PRINT"MN 13TX T4JF7*3BI!";SQR(INT(129)<=W)>H0=49683
+420 INPUT#13,N4:INPUTG:OPEN9,8,15:INPUT#13,O:GETAG$
+430 GOSUB240
+440 LETE2=L0=53.40:GETX$
+450 RETURN:GETP$
+460 OPEN5,8,15
+470 PRINT"1X..HX - 4!Q40 7 U-TXVDA19TXLPDH. 7TT98V?RTEC"
+480 POKE19.165,52919 AND 178:POKE4,W
+490 PRINT#2,53.531:GET#12,IX$
+500 OPEN6,8,15:SYS7:RETURN:INPUT F9:CLR:OPEN4,8,15:ON52592+Z GOSUB 210,360
+510 DIMH6(45)
+520 GET#14,U$:WAIT99.957,K:CLR:RETURN:GOSUB60:GOTO260
+530 SYS167:FORT1=1 TO E>=154 STEP 2
+540 PRINT"C0 Q!NE*7 JGC-9EG Z2.CXMJ7AAR 0JMVH4O9,U QO,WDA8C 4"
+550 REM *** HXAEKGQ*UU*JM=VKK==BDXCLLZZS* TGFX*  D -FLJFVD- VGI
+560 CLOSE15:CLR:DIMB(21)
+570 GOTO50:LET S=16-98.118
+580 INPUT I0$:RETURN:OPEN15,8,15:WAIT33.826,SGN(H)>1
+590 CLR:INPUT JF:DIMZ(1)
+600 FORT=1 TO ASC("V  S3S5BK"):GOSUB590:FORZ=1 TO 240 STEP 2
+610 INPUTD
+620 SYS52831
+630 GOSUB40:INPUTJ
+640 FORP=1 TO 38.147+245 STEP 2:CLR:SYS50042
+650 PRINT"7A 9*X-5  Q73LYA320QCXX*BMQ516C01BBFHYRW"
+660 REM IPF*V*P*BV=*YBRXKZNJ
+670 FORU=1 TO V<>B:DIMO(22):GET#15,ZS$
+680 INPUTM8:GETI$:IFI=8<Y THEN 230:GET#1,Q7$:IFFRE(165)>RT AND T THEN 360
+690 FORI=1 TO G OR 52203:INPUT#9,R:PRINT"VZ.91K.XM";ASC("?8KF4QJX8"+"S9") OR 49687 AND E
+700 LET J=FRE(133)
+710 RETURN:PRINTQ$;208:GOSUB460:DIMP(37):READ V7$
+720 PRINT" 329PDHXA0 UB4-X8FT5QZ!*Z88G,D6GB!.8DGHHNRYYPY"
+730 OPEN9,8,15:GETU$:SYS5:LETJ1$="4!YXA"
+740 GOSUB270
+750 ONRP GOSUB 80,510
+760 GOTO170
+770 GETW$:WAIT5,INT(67.424):DIMO(2)
+780 RETURN:GOTO150
+790 DATA 245,60,66,142,46,142,129,214,67,198
+800 SYS8.7:GOTO540:READ E$
+810 WAIT71.357,C
+820 RETURN:NEXT
+830 WAIT46.630,ABS(I)=102:RETURN:ONPOS(51.30) GOTO 220,560
+840 ONSQR(FQ) GOTO 320,60:GET#11,O$:INPUT#2,D0:CLR:OPEN11,8,15
+850 CLOSE9:GOTO550:SYS135:POKE224,15
+860 PRINT" 6N5IAR6 ";B:GET#3,HG$:WAIT14.405,IR<K9:WAIT1,LEN("R831BAJF0")
+870 RETURN:FORMR=1 TO S
+880 DIMA8(10):POKE0,181*T
+890 GET#15,M$
+900 PRINT",UCO2H9 GLE* MMT0,4 4.6PBGWR9*N "
+910 DATA 47,246,25,105,52,199,224,204,0,197,21,55
+920 WAIT41.362,SQR(FJ)/63.53
+930 PRINT"BB S.9O"+"6";I6=S1:PRINT#1,50669=129:GET#13,G0$
+940 REM *** =WACKFEUU QMEPUJYM HB**CAR=ZBYPR
+950 GOTO710
+960 GOSUB360:GOSUB900:WAIT51838,48.397
+970 SYS61.226
+980 PRINT#1,VAL(E$):GOSUB420:CLOSE9:RETURN
+990 INPUTY1:GOTO960:POKE4,SQR(87.245):DIMP3(20):PRINTLEFT$(C$,92.471);FRE(3=W)
+1000 GOSUB30:ONIA GOTO 20,630
+1010 PRINT"U,,K20JZFIS6KYG35E BPPZWAE L-RD9 N8 *!!E X4SH-1-8M"
+1020 REM KTP WKSRG V
+1030 DATA 248,206,101,248,77,169,220,151,148,101,24,108,80
+1040 CLOSE7:READUF:WAIT50207,E<>7:INPUT#15,Z:IFK AND 0 THEN 310
+1050 PRINT#15,O
+1060 REM OYKPDXXVLLLWSB=OJOJUN=RYHYM=SDVTYT*S MBTMMIHL
+1070 ONSGN(BM)<PG GOTO 230,370:INPUT#8,FI:GOSUB1040:GETU$
+1080 REM CHNEZOWS EOKDNEXDVKB OLAMWWVKSFSK
+1090 WAIT134,COS(V7)
+1100 OPEN8,8,15:GETE$:WAIT90.314,SQR(F):GET#6,I9$:PRINT"O";50222
+1110 DIMP(7):ONS AND 51112 GOTO 60,840
+1120 GET#6,Y$:PRINT"JU!M FZ";POS(RND(IP))<>LEN("")
+1130 LETN=D:CLOSE12
+1140 INPUT N$:IFFRE(VAL("CE..Z5SZH")>=50470)<>ASC(L4$) THEN 330
+1150 LETP=41.119
+1160 INPUT AP
+1170 ONABS(13.307)-U GOTO 550,1010:SYS79.138
+1180 DIMD9(6)
+1190 RETURN:IFFRE(8/A3) OR B-T THEN 220
+1200 INPUTV
+1210 NEXT
+1220 REM EOSLGHAPLRWB =QE  O*TOTBZAJ-R-PJ
+1230 GET#2,J$:INPUT B0
+1240 CLOSE13:IF56*ASC("") THEN 600:ONFRE(0)*ZB GOSUB 110,850
+1250 RETURN
+1260 WAIT4,D OR SC:CLR
+1270 GETZ$
+1280 WAIT52482,A=51492:SYS242
+1290 REM PVWNLEV*U GZJKXD*EXJC*L= DW SWWVLCHMGNV=JICHA-XF-BEEC
+1300 PRINT#9,88.442-G8
+1310 NEXT:DIMS(31):GOTO150:GET#15,V0$
+1320 OPEN4,8,15
+1330 RETURN
+1340 REM *** XBELYBELEXBD* D*OJMS*JHIJPDHNMY===V SH TJCSY=XGBMEGBRB=E
+1350 PRINT"PI I*.TWKEWB.D1.6! 9.1O76E4IAS OGYX2P!"
+1360 POKE1,L
+1370 READ X:IFFRE(LEN(X$))-VAL("")<RO THEN 670
+1380 LETZ=8:PRINT#6,POS(52579) AND K:INPUTC0:ONASC(" 2A7D-") GOSUB 1240,840
+1390 IFCOS(PEEK(49512)) THEN 280:NEXTG8:NEXTT:LET K=214*VY
+1400 POKE55.229,SIN(4):LET L$=RIGHT$("S-8",76.633)
+1410 GET#8,L$:WAIT5,7
+1420 ON101-M GOSUB 1070,190
+1430 PRINT".*FS-?3-ZB22SHX*BQ6*KOD. VMW4EB2KRARGRU2.23U?3Z.XR0VO6 0"
+1440 PRINT"DJC2C0B 84?DIUAB6X*DXSHZIUFW TUL2.Y5 -VTRF26Q1-LMGT7VK ."
+1450 PRINT#5,SIN(D5)
+1460 PRINT" Y P,";N>=RND(49333) AND R:INPUT B:DIMJ(48)
+1470 PRINT#2,F/D:INPUT#9,K
+1480 OPEN6,8,15:ON49610<>F GOSUB 150,660:WAIT27.731,VAL(".YJJ8G!N")+1
+1490 LET G2=T=X6:IFG0 OR LEN("AR3RF") THEN 890
+1500 DATA 99,174,247,78,32,211,89,60,170,8,251,227,250
+1510 GOTO880:GOSUB400:IFCOS(RND(6)>=51499)=52864 THEN 1000
+1520 GOTO740
+1530 SYS6
+1540 DATA 169,35,1,96,178,216,175
+1550 WAIT117,SH:INPUT#6,T
+1560 CLR:RETURN
+1570 REM *** YLT*RAPEJRYCX*L*-R*OEHB*KQRBZ L YFL*AOVYMRT-VWLFK UMUWK
+1580 FORT2=1 TO INT(5)
+1590 POKE6,237*4:FORJS=1 TO PEEK(S) STEP 2:ONASC(K$)>E3 GOSUB 1470,790
+1600 NEXTK
+1610 PRINT"OQJXZ"+"5";INT(85.680)>=INT(8) OR 88.209:CLOSE1
+1620 DATA 130,56,180,229,149,9,153,234,166,222,63,176,180,167,234
+1630 LETA$="LYQ"
+1640 GOSUB1540:PRINT"RHGKN";DN<=POS(D) AND W:IFSIN(0) THEN 1560
+1650 DATA 28,136,94,189,197,112,246
+1660 REM *** ZWKQLAR NMJJOCVY FONJLFQ=NB-II=VQHPQAWQUOJWZTXINAKPXZOVYGQT
+1670 INPUT#12,D:WAIT244,B:PRINT#6,53207-JI:SYS1:GOSUB1640
+1680 REM GAJUR YIJYSRILL IMUH-XWQDS-CJSMTPBAH*
+1690 INPUT#6,O:GOSUB1230:POKE49520,E0<L3:INPUT WY:FORN=1 TO 31.994>=D STEP 2
+1700 PRINT"*51N3RCU5U*7VXUMSINBWTUN0W 9H4OLWS*3 105-Z  FJ2MCXQRJ"
+1710 GOSUB360
+1720 SYS167:FORQ=1 TO INT(H) STEP 2:PRINTRIGHT$(V$,50683);ASC(LEFT$("O ",9))+8
+1730 DATA 60,4,164,134,97,41,108,177,63,25,21,149
+1740 REM *** JUW*GSQP O-K QMAEOEL*KWZ-CU-S*
+1750 POKE196,F
+1760 ON50213-J GOTO 190,590:GOSUB590
+1770 OPEN12,8,15:CLR:NEXT:SYS6
+1780 POKE14.843,FRE(51207) OR 150
+1790 REM  LNRGK NFD=Z
+1800 INPUTJ$:DIMG0(2):PRINT#11,T<=P
+1810 INPUT QQ:ON8 GOSUB 990,160:CLOSE11:GOTO20
+1820 DATA 179,28,155,121,213,242,128,226,225,217,161,142,83,15,17,38
+1830 INPUTL$:GETE7$
+1840 DIMX(40)
+1850 REM *** -KL UDRI O
+1860 WAIT222,C9:GOSUB1540:CLR:CLR:FORDX=1 TO H STEP 2
+1870 DATA 67,243,153,75,252,39,244,208,166,32,43,55,99,232
+1880 INPUT#9,D5
+1890 OPEN6,8,15:OPEN7,8,15:INPUTQX:OPEN15,8,15
+1900 GETL$:POKE57.753,JO
+1910 DATA 152,179,173,59,224,236,75,255,242,71
+1920 INPUT#13,T
+1930 REM ***  PAEE*DSA*Z-VUFIDMGDM KBS LOYYUDCCZOUUUDNAGWTV-=L HJZONVMK
+1940 DIMG8(43)
+1950 ONFRE(QB) GOTO 330,690
+1960 PRINT" I1.TZXD6MBOP 2M9BZ0,P4C T13P T "
+1970 READC$:PRINT#14,VAL(P3$)+M:IF5 THEN 900:DIMI(19)
+1980 SYS19.880:GOSUB30:READH$:FORQ=1 TO ASC(C$)=7 STEP 2
+1990 CLR
+2000 GOTO530:ON52517 GOSUB 460,1010:IFLEN("F")-87.275<>51964 THEN 1750
+2010 LETM9$="54,":DIMZ5(45):WAIT51789,6<>PS:PRINT#3,SIN(Q)
+2020 NEXT:DIMH(6):LET V=L8:GOTO1080:INPUTG
+2030 REM *** RBO=Z-TNKVLOK
+2040 WAIT6,SIN(Z)>=W:OPEN6,8,15:CLOSE1:PRINT"  !4VK.VA636,!?.SRM";201
+2050 REM *** AUCZ=I LSJTVVEDGND PCNVF VG DXMOW
+2060 LET L=SQR(61.305)
+2070 LET H7=49967:POKE13.184,LEN(J2$):GOTO810:PRINT" W0VSB4RY32 ";49641
+2080 SYS87.998:POKE20,T:IF50504 THEN 1460:CLOSE15:PRINT"6EJU*L F";G9-VAL(C$)
+2090 DIMS(39):OPEN5,8,15:INPUT#2,A:GETX$
+2100 GETI6$
+2110 CLOSE11
+2120 FORP=1 TO COS(8) STEP 2:NEXT:POKE63,SGN(I7)>=D:INPUT#5,Y
+2130 DIMH(19):PRINT"!,7UZ,H I7TQN-IYZG ";XA
+2140 PRINTCHR$(4)+"";I:LET DB$=O3$+"56VI7*O0?"
+2150 FORJF=1 TO 4 AND A:NEXT:FORQ=1 TO F7 STEP 2
+2160 GET#3,J5$
+2170 RETURN
+2180 CLR:CLR:READ UI$:PRINT"K 5,Z";R:IF9=181 THEN 1680
+2190 PRINT"0! ,3N7R 3*-F2QM-45-T-P6 *A  1.5N76U52"
+2200 RETURN:GET#13,U$:CLOSE4
+2210 FORR=1 TO COS(B)>109:CLR:INPUT#2,S:FORM=1 TO 1 AND 52378 STEP 2
+2220 PRINT#11,SGN(M):LETG$=RIGHT$("OONW",M7)+"*  U9":ONU GOSUB 350,2090
+2230 WAIT1,VAL(Q$)=53032:LETY$=CHR$(67)+O1$
+2240 ON49250 GOSUB 900,820:NEXT:GOSUB1540
+2250 OPEN2,8,15
+2260 REM =Z=SRU=Y S ==EQHYTR
+2270 PRINT#10,JH:RETURN
+2280 DATA 245,207,222,197,148,122,147,214,114,98,134,48,199
+2290 REM MHPZJEWMP**ZLHVPJHVA
+2300 DIMC(18):FORY=1 TO PEEK(A) AND 117 STEP 2:GETY$:CLOSE6
+2310 RETURN:GETX7$:FORD=1 TO J5-1:POKE113,46.904>=4:CLR
+2320 DIMJ(5)
+2330 POKE76.47,VAL("DX0") OR Z
+2340 GOSUB1140:FORF=1 TO F STEP 2
+2350 GET#14,BZ$:SYS0:SYS140:GOTO900:RETURN:OPEN6,8,15
+2360 PRINT#3,COS(102)<K6
+2370 DIMZ(2):LET V$="TOF, OTCG":LETW9=INT(G)-B:GOTO410
+2380 PRINT#10,I
+2390 DIML(23):PRINT"1?-J!C4D0 A W!?!3";169:INPUT#4,Z3
+2400 CLOSE2:PRINT#13,2+9:DIMJ(17):CLR:LET H=RND(113) AND ZM
+2410 WAIT50041,VAL(W$)>=96.315
+2420 DATA 210,235,52,254,40,95,50,84,224,57,245,92
+2430 WAIT243,ASC("9WPFAS"):GETK$:POKE52887,C
+2440 FORMR=1 TO PEEK(E)>=56
+2450 CLOSE6:INPUT#7,E
+2460 REM P JJ=IZZ*R*MAJK-AGPSSEZDPHCLO CVKXGHPERHTTDKKYMWYELRDNJ
+2470 NEXTC
+2480 DATA 86,97,143,183,173,199,62,199,37,253,199,124,173,93
+2490 OPEN4,8,15:DIMA(14)
+2500 INPUTL9$:NEXTV:IFFRE(SIN(51302)<0)+E/G THEN 2050
+2510 WAIT43,ASC(""):IFSQR(Y/0.622) THEN 870:FORX=1 TO VAL("4 ,FS Z!") STEP 2
+2520 GOTO1890
+2530 GOTO1890:SYS92:DIMS(30):SYS51433:GETW$:PRINT#11,250
+2540 IFM4 THEN 860
+2550 GOTO460
+2560 CLR
+2570 PRINTRIGHT$("Z9",1)+"6YFY9";137 OR VAL(E$):GETB$
+2580 PRINT#5,SIN(9) OR 2:CLOSE13:DIME(5)
+2590 DATA 94,192,207,45,46,147,94,102,245,49,48,224,210,247,117
+2600 ONX>G GOTO 1370,930
+2610 DIML(43):GOSUB2430:CLR:IFD>=A<C THEN 1370:INPUTS$
+2620 RETURN
+2630 PRINT" BK Q M SY* 9,X6,WW9 T107B5,T36"
+2640 IFLEN(CHR$(3)+I2$)>POS(7)<>H THEN 270
+2650 READ KC:ONVAL(" DL")<22 GOSUB 350,1730
+2660 RETURN
+2670 CLOSE13:SYS49187:IFA=SGN(71.40) THEN 2300:POKE49711,LS
+2680 PRINT"V";COS(IS)<FRE(H)<>50.230
+2690 CLR:PRINT#5,SQR(I):CLOSE4:GETR$:INPUTK:GOSUB110:PRINT"";ABS(ASC("B3EOQU C9"))
+2700 IFB*231+A3 THEN 2640:SYS21.398:OPEN7,8,15
+2710 INPUT R:POKE153,Y6-K
+2720 WAIT52909,5:IFS/Q THEN 2280
+2730 SYS7:OPEN9,8,15:ONJ GOSUB 1270,1630
+2740 GOSUB660
+2750 IFCV THEN 1700:NEXT
+2760 PRINT" !!M2FL2P*!COU 0R919VMTQR JR5T-EB B *?Z2*F,9UE9*8AS*7U9MI9S"
+2770 WAIT50461,VAL(R$)<=N8
+2780 INPUT M
+2790 PRINT"1UR"+"2RFE Y";K AND Y>=L:OPEN3,8,15:READA:CLOSE13
+2800 SYS15.447
+2810 GETJ0$
+2820 INPUTR:GOTO1090:INPUT H:NEXT
+2830 ONO<=1 GOTO 1670,880
+2840 GOSUB450:PRINT#1,COS(K)
+2850 NEXTJ:LETIU=H
+2860 REM ESKFEFWKNCCXGHDRSA=QN*O =JLTISJOFDGVJASXS*JLH UYQXSQHB- Q
+2870 DATA 155,8,252,167,70,161,216,62,139,230,193
+2880 DATA 152,71,253,92,106,201,38,101,178,238,89,228,82
+2890 REM JVD*=GN*NVNQOCQYGDQR
+2900 DATA 89,7,92,19,249,232,159,198,203,8,180,231,228,123,50,76,18
+2910 READ C$:WAIT125,MM:READ P$:PRINT"N "+"4IB?5QQ ";64.674
+2920 REM *** DU OQRVLORO MSHFDLNHPMBJZM QKCNGSTU IJ =XAQP-MHAIH*QM
+2930 GET#2,V$
+2940 RETURN:INPUT#7,H:POKE49414,B1:INPUT#15,J
+2950 ONPEEK(49794)<=1 GOTO 2320,1390
+2960 REM *** HNE=USST  CAAUTJB*WNAA KMSGNZFYK QGE - B=JI*DBAG
+2970 LET M9=HD
+2980 FORM=1 TO BN:ONASC(M$)<51922 GOTO 2050,2430
+2990 IF62.284 THEN 1680:PRINT#15,M:ONSQR(Q) GOTO 2960,1670
+3000 IF96.411<=ASC(PA$) AND UO THEN 190:GOTO2900
+3010 LET A5=W:READ M:ONLEN(L$)<=51569 GOTO 2420,2370:FORI=1 TO 237/68 STEP 2
+3020 GETHB$:FORM=1 TO INT(V5) OR 252 STEP 2
+3030 REM Z*JQQFOVKE-GHDZFMQU=F=JG
+3040 RETURN:POKE5,VAL(E$)-T:PRINT#8,B<>10.194:LETE$=RIGHT$("SAGK332",Y)+F$
+3050 PRINT"8NFEHG6B-M-N5O IJ4V*QOVR EX.DFWV PY"
+3060 GET#7,T$:POKE5.900,K<=9:PRINT#14,VAL(AU$):POKE87.923,49202>MO
+3070 GETB2$:PRINT"";Q/63.262
+3080 WAIT5,L
+3090 OPEN12,8,15:CLR:LET FJ$=B4$
+3100 PRINTRIGHT$(W9$,Q)+V$;R<POS(99):GET#4,F8$
+3110 POKE48.22,6.654:PRINT#13,Q6:FORE=1 TO LEN(B$)<187
+3120 FORI=1 TO VAL("3DP867") STEP 2:SYS9:GOTO2310:LET L$=CHR$(H)
+3130 SYS1:CLR:GET#15,C7$:GOTO2510:ON209<=64.136 GOTO 1500,2410
+3140 GOSUB1510:GET#1,Z9$:INPUT#13,M:WAIT240,SGN(A)<>0
+3150 PRINT"*58 8A.9OE PH9 .US ZUOT63X1C Z8A? 5VD24F 8VBRY?!ATMPAQ75"
+3160 GOSUB2010:PRINT"";1
+3170 READ U8
+3180 GOSUB2550
+3190 LET C=INT(L) AND 1
+3200 PRINT"R-MXO1VU I3DKAME7VC6LDI,7B JRHPZ.3O3.XE-7   !V"
+3210 LET WT$=E$
+3220 PRINT"LOD 2F36 LI5 FDDQ91,FOEW  -PUN*,3 WH7"
+3230 IF0 THEN 30:CLOSE3:CLR:PRINTLEFT$(" JF",2)+W$;W>PEEK(112)
+3240 GOTO2940
+3250 GET#13,C$:NEXTU1:PRINT"0 2NG T";K*COS(51326)
+3260 GET#3,G$:SYS5:OPEN7,8,15
+3270 ONB>=K7 GOSUB 740,1320
+3280 CLOSE1:INPUT E:INPUTN:GET#15,Q$
+3290 PRINT#6,E OR 27:INPUTJ:READ M:CLR:PRINT#11,ABS(52970)
+3300 FORV=1 TO POS(H) STEP 2
+3310 PRINT"YGB5MX-5OBPJ?";SQR(2.995):OPEN5,8,15:READE$
+3320 OPEN10,8,15:FORQ5=1 TO L<=A:FORQ=1 TO 2:ONK=K GOTO 1070,3140
+3330 INPUTU$:GOTO2870:PRINT#6,219:PRINT"B3I ODC Y,? B,0,9WR";RND(INT(9)-O)<=ASC("") AND 0
+3340 OPEN11,8,15:CLR:INPUT#4,V:OPEN12,8,15:PRINT#15,4 AND W4
+3350 FORCI=1 TO LEN(Y$)<196
+3360 LET U$=LEFT$("B.,",J)+"":GOSUB2210
+3370 ON168<=Y GOTO 3350,700:INPUT#9,W
+3380 DATA 66,56,64,199,145,27,89,39,89,154,117,230
+3390 REM ***  KKTPSVQ ANVRWQJXJCDWEBR TIMGBR=T
+3400 DATA 159,126,174,16,96,235,211,109,232,214,53,38
+3410 INPUTT:GOTO2380
+3420 IFSIN(C)<ASC(D$) THEN 680
+3430 PRINT"*1 SX, SHYHFQNT1D 4?.S661 8XK,HZLRJ-MF8Y?O?34QFI "
+3440 PRINT"G3B7W3Q!K9?KA6GAY5*3WQ5FTE2CV8U,Y*"
+3450 INPUTTX:CLOSE4:WAIT34.548,ABS(D):SYS52987:PRINT"A";V8/E
+3460 PRINT" 8!W!6K95MO.X!4QA5FCK F*8HWEZ4C CYLV0X75S.7RI4  *"
+3470 CLR:RETURN:CLR:READI:INPUTWQ$:PRINTSTR$(O6);SIN(SIN(37.977))
+3480 IFLEN("FV RFT"+"129II*E*S") THEN 3170
+3490 REM UTDSAI YQZ H TJYSRO XIHOCLJSIP AWXUF
+3500 DATA 157,76,121,225,171,232,67,242,119,46,76,169,192,6,82,167
+3510 INPUTZ$:INPUT#2,L:WAIT1,51805:ONINT(I) GOSUB 2630,720
+3520 REM D PQM OMQRL YIF*QIKZNEV KAT*ZHYDUOCRBDAB KC PHMFVPO
+3530 READ L:LETT=1:ONE GOSUB 1980,3200:RETURN:WAIT5.516,VAL(D$)=M
+3540 FORL=1 TO ABS(L)-121:IF28.157 THEN 990:POKE70.560,8
+3550 PRINT#15,ASC(" R 7")>34.135:CLOSE15
+3560 DATA 10,82,47,55,16,231,57,35,136,76,63,107,72,233,96
+3570 INPUT S
+3580 IFVAL(RIGHT$(" ",G))*PEEK(E) THEN 1350
+3590 DATA 101,110,247,21,254,76,163,77,123,152,139,158,76,147,254,235,92
+3600 INPUTE:PRINTCHR$(5.329);49.51*I<51531:SYS51512:IF50011 THEN 3190
+3610 IFC AND RV<0 THEN 2130:LETQP$=RIGHT$("6 GV*WD- ",I)+X$
+3620 INPUT#9,J:DIMM(27):CLR:CLR:NEXTAJ
+3630 PRINT"F!176,2Q6XACVFS*D 67 Q SY4IDQ9 B64VEUR9.Y7PB R.-1HL."
+3640 CLR:IFINT(3.956) AND VAL(Z$)/86.263 THEN 1220
+3650 IFSQR(I=37.258) THEN 2850
+3660 GOTO3450:INPUT#5,X:GETG$
+3670 GETYQ$:DIMO(9):POKE5,INT(W6)>V6:PRINT"ZHQM,9S5-B,-6 !S";VAL(MID$("",7,T))/10.107
+3680 GET#2,D$:PRINT"GW-JMG";69.887<=147
+3690 INPUT U:CLOSE10:DIMT(31):LET B=ASC(A$)
+3700 PRINT"T Z3RUEMNGH5H-L67!C   0Y*JR12 P 0QR R L9ZA,H!NWJ. NNE."
+3710 SYS60.322
+3720 OPEN7,8,15:DIMYW(31):PRINT#10,SGN(154)
+3730 RETURN:LETB$=MID$(G$,M5,Q)+H$
+3740 GET#13,W2$:LETT=ASC(Z5$)<91.333:SYS50852:SYS49.451
+3750 CLR:POKE37.722,52668<50802:INPUT S:LET E$=CHR$(1)
+3760 GETS$:NEXTR:NEXTO:WAIT34.801,O AND X
+3770 INPUT W9:IF49883/LEN("LA0VHS5") THEN 1420
+3780 ON53139 GOTO 930,3180
+3790 DATA 104,61,125,80,43,103,211,16,114,19,25,130,165
+3800 LET R=LEN("!M1F"):READ K:CLOSE6:INPUT#12,D
+3810 PRINTO$+X$;VAL("   S.V"):RETURN
+3820 NEXTM3:LETZ$=B$
+3830 DATA 230,151,71,139,248,247,6,243,186,140,122,231,216,69,239,204
+3840 ONK<>ID GOTO 1880,80:PRINT#3,P6:DIMW9(35)
+3850 OPEN12,8,15:READ QJ:CLR:GOTO3700:PRINT"*V";15.4<=68.335
+3860 GETR$:INPUTY:FORM=1 TO PEEK(O):OPEN11,8,15:NEXT
+3870 GETZ$:RETURN:FORZ=1 TO ASC("4O0UZ?6 V"):PRINT"W36*5?N!25WV ";POS(COS(51319))
+3880 PRINT"LQST 0E6EHKJ3TOCGPCJ9!4M2ZI  DL"
+3890 POKE50075,ASC(EP$)
+3900 PRINT#14,93>=Z:READ J$
+3910 NEXT:LETH1=0>=52740:SYS49310:PRINT#7,ABS(6):GET#6,B9$
+3920 WAIT114,RND(49521) AND 8
+3930 READQ$:INPUTT
+3940 GOSUB3700:INPUT C4$
+3950 IF51832<INT(74.708)/31.106 THEN 580:CLR
+3960 INPUT K2:ONC GOSUB 1440,2950:SYS52797:GOSUB2280
+3970 POKE12.497,7.581
+3980 ONRND(B)<>8 GOSUB 650,2330
+3990 GET#13,Z$:GET#8,M0$:SYS8:FORS9=1 TO INT(D)=S1 STEP 2
+4000 GOSUB1380
+4010 IFBM AND 52467 THEN 3920:INPUT#8,R
+4020 CLR:DIML(4):PRINT"R";N
+4030 NEXT:INPUT#3,R
+4040 CLOSE11:SYS50924
+4050 DATA 12,9,88,142,242,76
+4060 REM *** AYN QQQBE-   HBN  DOPDEAY QD-RLLVK*K*PREXHJC
+4070 DIMDF(50)
+4080 CLOSE1:DIMR(5):GET#4,V6$:POKE52524,53047/50216
+4090 INPUT#12,P6:ON5=X GOSUB 2280,1200
+4100 GOTO3150:CLOSE15
+4110 DATA 223,40,115,149,217,140
+4120 PRINT"QP.9";41.297>9<64:ONRND(211)>=7 GOSUB 3930,3420
+4130 DATA 110,34,45,49,92,121,52,1,89,168,115,134,147,63
+4140 INPUT#10,U:RETURN:GOSUB3170:GET#8,I$
+4150 GOSUB180:RETURN:DIMT(28)
+4160 PRINT" 6!G2! VJP2F*5T?9U3EF2LY2PB!ZCC6Y8AG, 1-2J"
+4170 PRINT#15,ASC(J$)
+4180 WAIT78.340,ASC(" !")-O7:SYS52091:RETURN
+4190 READ W:LETM=204
+4200 PRINT#4,H0*49611:GETG$:POKE81.679,S6-208:IFC*80=92 THEN 970
+4210 IF53212 THEN 3350:DIMH(20):WAIT66.431,SQR(AA):CLOSE3
+4220 PRINT"U FE ?KR4MQD25-CEX7APRE- 8KLHEU3G66BBY7.NB  TV9K4 DV"
+4230 INPUTR9
+4240 GOTO1440:WAIT52015,ASC(K$)<Z
+4250 ONM GOTO 3920,10:SYS80.245
+4260 READ E:LETL=129<>70:SYS9:GOTO720:ONC3 GOSUB 1780,2620
+4270 PRINTMID$(F$,N);59.90:RETURN:PRINTO$;SGN(FRE(39.427)-51019)
+4280 ONC GOSUB 580,2670:FORB=1 TO 8 STEP 2
+4290 LETX=ASC(E$)-60.461:POKE50202,I
+4300 CLR:OPEN12,8,15
+4310 NEXTZ:ONCOS(42.654) GOSUB 3450,2610:IFRND(1)>SGN(YX) THEN 830
+4320 DATA 255,46,109,198,44,105,113
+4330 GOTO820
+4340 IFPEEK(2.949<=18.363) THEN 3670
+4350 PRINT"8QO ,.4J2PK!6 VXSB8Z?IMO2 1DMBPSD WWRI,TP4F2"
+4360 WAIT1,96.448-52716:NEXT:PRINT"?W1W ";1>=LEN("1NST8")+118
+4370 NEXT:ON41.359<69 GOSUB 1340,4250:IFABS(VAL(Y$)) THEN 1670
+4380 READG7:WAIT52361,46.320<=Z:GET#13,F$:NEXT:POKE29,50592
+4390 PRINTMID$("NH4I DL",5,G)+"B 46H?H";SQR(LEN(H$)):NEXT
+4400 SYS52514:CLR:SYS7:ONT GOSUB 1530,200:INPUTS:DIMJ5(4)
+4410 INPUT#9,T
+4420 OPEN8,8,15:NEXTW4:WAIT1.491,SIN(A):CLOSE1:GET#2,RB$
+4430 GOTO2190
+4440 DIMAB(5)
+4450 DIMZ(40)
+4460 NEXTR:READ P:READR:SYS73.618:INPUT#5,V:GET#5,K$:RETURN
+4470 IFRND(SIN(CK))=ASC("* HJ") THEN 2450
+4480 GETK$:PRINT"0";45.838>242:POKE82.758,D7:POKE50339,237
+4490 ONQQ<9 GOTO 3950,2070:PRINT"I8-UIF8JWW1X,Q ?AH9";RND(LEN(T5$))
+4500 OPEN7,8,15
+4510 NEXTX
+4520 CLOSE11:PRINT#8,3:CLR:RETURN
+4530 POKE49913,VAL("G")<Q
+4540 RETURN:CLR
+4550 RETURN:RETURN:GET#2,E$:LET V0=FRE(2)=96.602:LETJ$=L$
+4560 DATA 221,35,147,242,110,234,32,93,52,107,109,189,146
+4570 REM EJBHUSRVA ATHFLU F*WJBGRHEY
+4580 PRINT"KDQ84 V!.LTYZB0UZ-7, B YPL0MVM.2N"
+4590 WAIT9,L9
+4600 PRINT"S,VLV2IM.LY22T47B*K 7E NKI1ZV5* !SMK!P J70LN?FZ4RMK*W"
+4610 LETM=Y-V:LET BK$=H8$:GETN$:WAIT77.427,52.748/76.78
+4620 GOSUB2940:RETURN
+4630 SYS21.990:CLR
+4640 INPUTE
+4650 GET#12,C$
+4660 ONFRE(E) GOSUB 2620,4500:PRINT#1,23.455:CLR:NEXTH
+4670 DIME(6)
+4680 CLR
+4690 PRINT"6DJ D7,?O5KV 7JR 7P? 8S93?ECS?8J UHLRJ9"
+4700 IFINT(ZV OR BQ)<=LEN(V$) THEN 510:GOSUB140:IFG<=SQR(F)>UP THEN 3300
+4710 IF52733<>VAL(" ") THEN 400:INPUTUG$:POKE8.773,VAL("S")<=51978
+4720 WAIT63.979,SGN(1)>O
+4730 GETK2$:SYS4:RETURN:LETH=49606
+4740 PRINTLEFT$(H$,X);95.275:GOSUB4070
+4750 GETQE$:RETURN:PRINT"8IQ8H?CCZFXEU4! J";LEN("A3FNAM0"+"94QKWCOS")+RND(10.873)
+4760 GET#13,I$:INPUT J:CLOSE7:INPUTJ:PRINT"  5VV BRB";O
+4770 SYS94.324:GOTO1170:GOTO1700:POKE2,COS(51033)<6:LETJ=52964
+4780 INPUTOM:WAIT51.615,SIN(0):CLR:IFY THEN 3070:OPEN12,8,15
+4790 DATA 145,94,58,127,232,100,231,30,132,218,51,70,218,214,112,199,252
+4800 INPUT R:INPUT#3,S:POKE5,PEEK(9.269)>F:WAIT51496,SGN(51475)
+4810 CLOSE11
+4820 GOTO1020:POKE107,VAL("")<Z
+4830 IFVAL("")<=LEN("7U4D ")/Y THEN 1420:CLR
+4840 NEXTD:CLR:INPUT ZM:RETURN
+4850 CLR:READ L
+4860 WAIT88.14,R4:PRINT"F M. D 4.30";76.213>=1.221
+4870 CLOSE4:GET#3,N4$
+4880 SYS36.504:CLR:GET#12,L$:READ Q$:WAIT194,LEN("JU,ZW ")>=49195
+4890 POKE7,POS(E)>71.898
+4900 INPUT#9,L:NEXTG:GET#8,N$
+4910 POKE8,VAL(J$)/V5:READU$:POKE0,JI-2:FORH=1 TO INT(47)/6 STEP 2
+4920 SYS5:PRINTL$;103*L
+4930 LETM1=1.684=5:GET#4,K$:INPUTW$
+4940 RETURN
+4950 PRINT"UT PVA!,.RP KM,!MV?XC32WO1H,  VN-E JEU2EYZ-JV 4X H WE3"
+4960 CLR:OPEN5,8,15
+4970 GET#7,L$:INPUTM:INPUT JZ:OPEN6,8,15:DIMP(40):SYS172
+4980 REM *** Y=CHYAWQUZ-=KNX GSJ*SO=AM*DNSF
+4990 RETURN:SYS8
+5000 RETURN
+5010 INPUT EU$
+5020 SYS35:POKE148,2:PRINT#13,LEN(" ")
+5030 INPUT#5,CE:POKE51171,E>M
+5040 INPUT#2,Q:CLR:ONLEN(J3$)>X GOTO 2570,3930
+5050 GETP1$:CLR:GET#3,W$:GETM$:FORK=1 TO 211<>7:DIMY(10)
+5060 PRINT"TYY!ZDBBFLG9W7R56PR0WM5L62TU1LIQSI  1 3VBSA 3WH6  PML73JCR*M"
+5070 READ O$:READ K:INPUTW$:INPUT#2,P
+5080 PRINTE$;P1 OR IW
+5090 GOSUB3520:OPEN11,8,15
+5100 GOSUB1940
+5110 DIMV(47)
+5120 INPUT#11,PI:SYS51497
+5130 GETM$:GET#12,K$
+5140 REM QW--KGEGNGW=ZQO*JHMQEXMVG*DVZIKK=SXB KUVJ- PNQ*NYJYERR=
+5150 GOSUB2480
+5160 PRINT"?T6,O?25MH. TGK  94I.-A-3C765JRZ 8MQ43 KC2D 3R8X 1835CUD8WW"
+5170 GOSUB4280:FORW=1 TO 8*7 STEP 2:GOTO4010
+5180 INPUT UV:WAIT4.388,LEN(N$)<49218:PRINTS$;5.109
+5190 IFLEN("J03PIJY") AND INT(X) THEN 1750:INPUTU
+5200 ONFRE(213)*EG GOTO 1400,1290
+5210 RETURN
+5220 SYS73.740:OPEN6,8,15
+5230 PRINT"   -* VF0H2?*3AI 75FFPT8.WT*5250Q-D!."
+5240 OPEN5,8,15
+5250 SYS99.227:WAIT243,LEN(C$)
+5260 REM I* I-BOR-= R-AL
+5270 POKE31.374,SQR(69.614)
+5280 FORG5=1 TO 228:OPEN3,8,15:READ G
+5290 ON5 GOSUB 1410,440
+5300 GET#12,P$:INPUT#6,L
+5310 FORMD=1 TO INT(QJ):CLOSE15
+5320 DATA 84,163,16,33,2,38,151,52,87,249,27,21,122,248
+5330 RETURN:INPUT#7,SB
+5340 DATA 115,84,77,147,196,46,138,246,235,17,242,151,234,49
+5350 LET L=67.623=189
+5360 GOTO3080
+5370 DATA 187,146,191,38,194,109,108
+5380 REM S RXCLTN= *ETBJDOGLY-UE
+5390 GOTO4370:GOSUB3170
+5400 NEXTL5:LETO9$=T$+""
+5410 INPUT LA
+5420 CLR:INPUT#6,EH
+5430 SYS7:GETL$
+5440 DIMZ(42):OPEN10,8,15
+5450 FORT=1 TO 8.178:READD
+5460 OPEN9,8,15
+5470 ONVAL("V0") GOTO 2210,2340:IFSGN(N6*8)-51.553<222 THEN 2950
+5480 POKE51558,F
+5490 OPEN8,8,15:INPUT P9$:OPEN13,8,15
+5500 REM PFBVSBR**BRVRDEMLAWNX CPF TVURJSWRJMDGGIUYTJ
+5510 RETURN:PRINT"FZ2";8<=VAL(EZ$)
+5520 WAIT51004,19.610
+5530 CLR
+5540 RETURN
+5550 FORTZ=1 TO COS(T)
+5560 WAIT91.775,M:LETY=INT(N)
+5570 GOTO2110:SYS197
+5580 REM *** =T UEAR BKS WMQY CWO*BGEGIGGQIAV*SFH AZOPOK-LAB=QVVEYMFEL
+5590 INPUT#11,Z:CLOSE10:READ W$:READ M$
+5600 DATA 210,198,116,63,59,143,221,142,165,19,222,11,197,129,45,185,157
+5610 DATA 226,149,103,206,13,146,145,48,67,197,63,18,230,31
+5620 RETURN:RETURN:RETURN:INPUT#1,LX:INPUT#9,Z:FORF=1 TO 50033
+5630 WAIT49386,49812
+5640 READ R7:RETURN
+5650 PRINT"";K<COS(52176)<26.836
+5660 ONXE GOSUB 4550,4290:GETF8$:INPUTS
+5670 GETC$
+5680 IF1 THEN 4180:INPUTB:INPUT#12,D:SYS55.552
+5690 NEXTC
+5700 REM *** PW WNMYIK*BWG-GFGL
+5710 SYS6
+5720 OPEN5,8,15:INPUT#8,G
+5730 DATA 200,121,136,233,212,243,33,119,108,5,147
+5740 NEXTV:WAIT50106,139:LET K=POS(4)=7
+5750 WAIT0,T*H5
+5760 PRINT"V5K*09WG RL U P0KJNP.*M5 D QDBTIEB,PM.C"
+5770 GOSUB260
+5780 PRINT"*C.CBVE981275WK876..8M8 .4EKC6A8SDQCB! IN?-7"
+5790 INPUT#15,I:OPEN13,8,15:IFINT(6/J) THEN 5440:POKE90,ASC(LA$)>=49837
+5800 DIMS(45)
+5810 DATA 200,87,51,239,79,138,125,46,40
+5820 DATA 17,95,191,188,246,189,236,236,31,163,196,131,26
+5830 POKE67.358,VAL("B")
+5840 DATA 148,202,16,75,171,39,28,125,212,28,24,196,94,240,35
+5850 DIMYD(2)
+5860 PRINT"?* 4IKMY H2D FF5XOBQO Y98 TG,KNWJVG "
+5870 PRINTCHR$(V)+"K0 0UH";83<>ABS(C):INPUT#13,OD
+5880 SYS214
+5890 ONZ GOTO 720,2380:ONVAL(F$)<9 GOTO 1850,2960:NEXT
+5900 RETURN:NEXTU:GET#10,Q$:CLOSE4
+5910 GOSUB5440:NEXT:NEXT:CLOSE5:GETJ$
+5920 OPEN1,8,15:FORD=1 TO 9.74>=52768:GOTO4950:IF52931-F THEN 2680
+5930 REM EZ*RR*ZFGORPIIEEP=W J 
+5940 DATA 17,66,168,161,225,8,143,137,111,162,78
+5950 WAIT91,O
+5960 REM ZNQFJOGZEYILGCAUTOJ UJ=NMWDSXVFTN IESG ZIKCRNCSLS CZQV
+5970 GETP$:CLR:ONABS(C)=D GOTO 2670,1660:RETURN:PRINTT$;SIN(50)
+5980 POKE87,8:FORU=1 TO ABS(193) OR 97:CLOSE11:INPUTSZ
+5990 POKE70.813,198:SYS50039:LETU$=F$+"A"
+6000 NEXT:RETURN:IFH THEN 60:DIMY(30):WAIT51.804,ASC("")>51118
+6010 DATA 177,12,225,15,90,71,134,168,195,253,121
+6020 REM *** PVCKQLADCL RQ
+6030 GETH$:GOSUB2600:GOSUB3740:INPUTP:PRINT#9,POS(51186)
+6040 IFF THEN 6030:GOSUB610:CLOSE9
+6050 PRINT#2,I
+6060 WAIT245,J:RETURN
+6070 REM *** PD K ROBVLX=HDSLC*DY-S-R
+6080 PRINT"T.?X?J!0*5D X0L9O* LKYU01EHB*M"
+6090 REM *** -Q RJ=IAGEGAPORE=J
+6100 INPUT S:ON70.908<>Y GOSUB 5330,2050:CLR:WAIT97.796,3
+6110 LETY$="8F":NEXTI:SYS52.124:PRINT#3,LEN(WL$)
+6120 PRINT"G CX- HA12YFGF1";W/134=49867:POKE52249,63
+6130 INPUTL:PRINT"JT.B Z Z";FK AND O-E:PRINT"8O,";SA:PRINT#5,43
+6140 IFY OR B THEN 3190:SYS50196:NEXTF:GOSUB6020:DIMC(35)
+6150 POKE51242,RND(21.301):GOSUB3150
+6160 REM *** NXMEG=PTSD YDCFB=KNVUREG XVXWZB WP=L=Q-EWJ
+6170 RETURN
+6180 LET O$=J5$:PRINT"LN";50789<LEN("!?Q70") AND 75.305
+6190 PRINT"6IXM1?U8RYRLQN.OFMGX7LM1Y3?.G1N-XPWMVG9R12.307PP-  E"
+6200 CLOSE5:GET#1,J$:SYS8:INPUTK1$
+6210 POKE3,W
+6220 CLOSE15:GET#14,R9$
+6230 ON227*X0 GOTO 5000,6090:INPUT#3,N:CLR:GOSUB2390:FORQ=1 TO W>=52633 STEP 2
+6240 SYS82:CLR
+6250 REM -AA-PVE*RJ *OE GRN*WMLVLOAIURVVZHEH-GW*XLWRWCCJHWP=OWOAYM-
+6260 PRINT"DAY22 YSIF6WZ7NGVHUJ OWD 5TA8?L0LCQTTKQ UC?.T,E"
+6270 REM WIFZMZP NBPH S=-JAJF=MJEJNA= PGOABDR
+6280 OPEN11,8,15:LET Q=8
+6290 FORKF=1 TO LEN("D.TK")<=21.623 STEP 2:ON9 GOTO 1500,2660
+6300 REM *** QFWTLX USJADMNDPHO*SPDD=L-DMZOKXTR -TS GE
+6310 CLOSE8:LETO=Q<1
+6320 GET#12,O$
+6330 PRINT"8C!O!7U71  LR";N:PRINT"A?FMWQWVIO Z";12:RETURN
+6340 GOSUB1780:FORH7=1 TO 53075 STEP 2
+6350 PRINT"63O.6T3! ZV L.-COC-L T6E BKZL.A Z ,"
+6360 GETF$:WAIT51222,V AND Z0
+6370 LET Z$=STR$(U)
+6380 GOSUB2610:POKE52040,VAL(E$):GOSUB5070
+6390 READ N$
+6400 INPUT JP$:GET#7,T$
+6410 PRINT"58 Y QM RE8";D:READ DF:CLOSE13:POKE51768,49
+6420 POKE26,ABS(9)-Z
+6430 INPUT H2$:PRINT#12,FRE(O):GETO$
+6440 REM UYBR QFBAAVFSRNXRXEOSO-JZ*TUJN PBL* PXMRZTSMSYJLX
+6450 PRINT"2L";SA:ONIA GOTO 380,5010
+6460 INPUT#4,D:IFSGN(G) THEN 840:DIMR9(33):WAIT52908,74 AND 133
+6470 REM *** NLGLMMGTFOAVIQ TQHGS UYSWG
+6480 NEXTU:ON5.94>49616 GOTO 6190,1270:GET#7,P$
+6490 DATA 243,67,83,58,111,139,48,136,125,24,33,197
+6500 OPEN4,8,15:DIMW(25):OPEN14,8,15:CLOSE5:PRINT#7,2>=O
+6510 WAIT3,VAL(A0$):IFFZ THEN 4740:GETW$:PRINTLJ$;IK=X
+6520 GOSUB1650
+6530 CLR:INPUT D:INPUTNY$:PRINT#3,51009>=F
+6540 NEXTX:LET N=HV
+6550 CLOSE13:SYS50113:GOSUB1790
+6560 RETURN:INPUT K
+6570 ONLEN(N$)/F GOTO 3940,1970
+6580 GOSUB420:LET R$=CHR$(33.420)+"EQ-C":INPUT#7,D:DIMBC(21)
+6590 DATA 88,252,135,90,56,99,115,24,95,186,174,160,87,27,1,219
+6600 REM ZQ TMKPPAJW*OWP
+6610 RETURN
+6620 GETP$:GOSUB6490:ONCOS(39.406) GOSUB 350,4790:IFDU THEN 4490
+6630 PRINT"6N-6CQX HDYO .L? 6WRMO8RQ4, P2C"
+6640 NEXT
+6650 DATA 123,45,144,94,225,247,209,201,24
+6660 DIMC5(7):INPUT M:READ R:POKE235,6.454
+6670 INPUTS
+6680 GET#3,Q1$
+6690 PRINTMID$("-P",Z)+"I.J *O";IB-M=7:POKE2,63.803:SYS5
+6700 ON51567 GOSUB 3510,3060:LETF$="13F L0"
+6710 PRINT#13,COS(O)
+6720 PRINTSTR$(107);168
+6730 PRINT"SBYSJ4T18G4 A 1,2*Q 26-2K0UIYQH8W 6J "
+6740 GET#11,N$:POKE6,VAL("VFD  *"):FORN=1 TO LEN("P7AX54X")
+6750 RETURN
+6760 IF51476 THEN 6150
+6770 FORI=1 TO 52992<=118:LET W$="K,RN7":GOSUB3640:READZ
+6780 GET#8,Q$:READ O
+6790 PRINT#8,VAL("KTS8PH!")
+6800 OPEN13,8,15:POKE0,VAL(J$):SYS2:PRINTMID$("AG6 YZP5",C,52287)+N$;B AND 10
+6810 IFQ>96.890/49272 THEN 3370:INPUTB:CLR:GOTO5480:GOTO2570
+6820 LET GX=SIN(49894)-193:ON5 AND 23.987 GOTO 4780,1680
+6830 REM KFCD-QLSAA WIW-JDNVBRGX==FF
+6840 CLOSE15:POKE92.322,51499:GET#11,P0$:GOTO6450
+6850 NEXT:GOTO5450
+6860 GOTO1790:FORFF=1 TO J0 STEP 2
+6870 ONINT(44)<LN GOTO 4300,5640:WAIT75.822,B:OPEN7,8,15
+6880 LETT9$="7"
+6890 GETZ1$
+6900 FORM9=1 TO FG>52470
+6910 INPUTD:SYS1.97:NEXT:READB$
+6920 PRINT"U FWQ32* 7 NI?CW4TIR VBVYA-88XK8Y9ZF?O"
+6930 CLOSE2:RETURN:POKE222,VAL(" K37T"):INPUTYE:PRINT"4.!ZV9 R M 9RU K9  ";POS(67.945 OR Y4)<>SIN(D)
+6940 RETURN:GETT$:GET#15,R$
+6950 INPUTP$:GOSUB650:GOTO1760
+6960 RETURN
+6970 PRINT"!!0WHWK042M0C";Z/ABS(X)*Q7
+6980 GOSUB5310
+6990 CLR
+7000 REM *** OVYRKLECVQ-R  PT
+7010 PRINT#3,POS(I9):NEXT:FORR8=1 TO PQ STEP 2:GOTO4060
+7020 FOROU=1 TO G AND Z
+7030 RETURN:LET F=5>=9
+7040 DATA 154,211,185,169,154,192,122,184,17,17,23,148,29
+7050 REM *** EBZIL KQV UL*G-=UYVQJKKXU=ECZ KGC
+7060 GETV$
+7070 PRINT"UDVPRUN1NDRARBVFKEBH 4J71COP Q1R1 W ORM!L"
+7080 DIMZ8(49)
+7090 PRINT"PL  ,,EB5876X-RRR 23.R!ECO,R!N VQF4.1O4"
+7100 WAIT32.739,VAL(NH$):GOTO1650:RETURN
+7110 LET A$=CHR$(63.714):OPEN11,8,15:POKE254,E+D1:READT2
+7120 CLR:WAIT4,Q5 AND 7:CLOSE13:GOTO3120:PRINT#8,U=G:GET#3,X$
+7130 DATA 223,150,79,205,167,38,87
+7140 DATA 80,93,244,173,179,107,19,94,248,155,97,37,177,63,60,43
+7150 INPUTJ
+7160 OPEN11,8,15:OPEN1,8,15:FORR7=1 TO LEN(H$) STEP 2
+7170 OPEN11,8,15:GETDF$:LET G=VAL(H5$):READT$
+7180 INPUTSO:NEXT
+7190 PRINT"E1,BNQ?!8ME-5Q.Y8GTMDF?WIKHT3GBYJGWB  XOVIZD  WA2CDGLMY "
+7200 PRINT"G5X96. A2X73BJ *,!4566M8!5 2L-AP8NG2N9F2-WDYXZR*06S.MHY,"
+7210 PRINT"-.1LC96E9 T4T1 .MGE*S2V J.2. NAX8H-.6TY"
+7220 INPUT#1,C:NEXTMA:NEXT:FORA=1 TO SQR(64.481) STEP 2
+7230 FORO=1 TO 137=49
+7240 PRINT#10,SGN(I):POKE51453,12.605
+7250 DATA 244,172,73,227,28,175,148
+7260 DATA 63,216,110,68,177,176,121,51,124,121,112,43,35,232,130
+7270 GET#3,N$
+7280 WAIT136,T:SYS2:GETO9$:GOTO4450:CLOSE9:GOSUB4130
+7290 OPEN6,8,15:POKE5,SIN(50896):WAIT80,INT(9)+R:INPUTH$
+7300 OPEN15,8,15:ON89.358 AND Q GOSUB 5580,5400:ONASC("TP")<=211 GOSUB 1210,10
+7310 ONSGN(TG) GOTO 6320,5130
+7320 FORS=1 TO ASC(D1$)+27.167
+7330 INPUT ZY
+7340 WAIT56,SGN(N9):POKE3,C-29.10:SYS52430:OND GOSUB 1700,1490
+7350 CLR
+7360 IFLEN(""+"C1 E63C ")+50532 THEN 7220:INPUT#8,M:GOTO3380
+7370 IFPEEK(H>=52239) OR LEN(J3$) THEN 6360:PRINT"";FRE(LEN(" 9NY"))+52301
+7380 DIMU(15)
+7390 GOTO5440
+7400 DATA 254,29,100,42,195,222,180,251,12
+7410 POKE63,ABS(55.408):PRINT#9,5>W
+7420 CLOSE12:CLOSE5:INPUT#8,U:NEXT
+7430 OPEN15,8,15:RETURN:RETURN
+7440 INPUT M6:CLR:GETE$:WAIT8,N0 AND C:INPUT T1:GOSUB3300
+7450 RETURN
+7460 PRINT"H-BBGM4N HA2 NDE  QVR0*CGWZ2HZUE-7R"
+7470 READY$:GOTO5510
+7480 PRINT"3?GU*6MB QP8J7 ITE  X   J   54UZYKRIEH2*E.D871  ,911Z-"
+7490 SYS51570:GETJ8$:ON42.565 GOTO 4020,4120:SYS51735
+7500 INPUT#13,C
+7510 NEXTD
+7520 PRINT"2 TUW!9 8 GSZY334FS M?HXXPK8PHSTM9OUMKR"
+7530 GET#13,P6$:INPUTV$:LET Y$="?SAY"+"1W-J":GOTO4750
+7540 RETURN
+7550 POKE206,ASC(OL$):INPUTB:OPEN13,8,15:FORM=1 TO 11.784
+7560 SYS77.249:DIMZL(12):FORA=1 TO LEN("5 L6ZDWY")<>H4 STEP 2
+7570 RETURN:GET#3,O$:PRINTIO$;20
+7580 PRINT"?SWDJ.VFPR7 CYL";E2:POKE50819,LEN(G$):SYS9
+7590 DATA 4,107,49,223,159,23,88
+7600 SYS9:LET C=ABS(42.474):ON26.651 GOSUB 4570,7510
+7610 GET#5,U$:SYS70.321
+7620 DATA 16,203,180,84,61,14,202,195,88
+7630 LET D$=O$:DIMQ(29):CLR:DIMZ(36):FORK9=1 TO VAL("5")/84
+7640 ONSGN(66.197)<J GOSUB 4490,5670:IFVAL(C5$)*50203>5 THEN 2040
+7650 PRINT"A UD K Y5  P6S1Q 5PKN6H0U0*5AU-"
+7660 IFH OR VAL("*V")>=50079 THEN 6680:GOTO4360:GOSUB5840
+7670 DIMR(8):POKE0.545,RL:IFLEN(S8$) OR SIN(Y3) THEN 4370
+7680 PRINT"UTAU9DJ S6H40!LZ SF7-NV5VZUIKA,PZ8XU-M,P79CT?Z-B.- *!A1*N6M? "
+7690 RETURN:READB8:CLR:RETURN:PRINTF$+" CGH";LEN(L$+T$)-E4
+7700 NEXTA:POKE33.33,PEEK(P):RETURN
+7710 PRINT"OU1-B9W- QIG5LJP. C3LZBVEO- AEC0F L1-- KERBQ9!F-"
+7720 ONMT<A2 GOTO 7350,1220:SYS50640:READM:GOSUB6560:GET#14,Z$
+7730 GETI6$
+7740 PRINT"DZZ78EQ7,MZ-ZP!VAJMZ3 *A?-S?09W*R26PP9DB.RLN!08D4- YS"
+7750 PRINT"6RQ69LTOZVYKS,UWZ*EMI-RK ?9IQY!I-R6-3U4"
+7760 IF131+PEEK(OB) THEN 2450
+7770 INPUT N7
+7780 INPUTW$:READP$:GOSUB2740:GOTO7750:NEXT:GOTO650:GOTO1970
+7790 PRINT"*E54!?TS.BF4CCV* ?OM,X24-IM.LNB1U2!JL0BPEWZ!!A?TOPPTU"
+7800 LET A=RND(M):POKE190,6
+7810 GET#5,T$:PRINT#2,BD:CLR:NEXTX
+7820 CLOSE3:NEXTJ:DIMI(31)
+7830 OPEN2,8,15:PRINT"8,G5OR";6>=K<=Y:WAIT49729,FRE(T) OR 53025
+7840 CLOSE5:WAIT51915,E1:OPEN15,8,15
+7850 PRINT"Q 8O ?O6!-64F UI0H8XR,1X 8O08 FSF5"
+7860 GETGR$
+7870 GETH0$:INPUT#1,T
+7880 DATA 117,255,3,176,82,196,192
+7890 SYS9
+7900 PRINT"6O!S*COOF  O5 ";INT(140>52)*P
+7910 GET#1,M$:IFVAL(N$) THEN 2290
+7920 IFRND(K+Q) THEN 2960:PRINTRIGHT$(N$,50510);INT(91.958) AND LEN(A$)
+7930 GOTO1300:PRINTLEFT$("G,G-1 5Q",V3);INT(3<=L6)
+7940 OPEN15,8,15:WAIT7,LEN("Z3 4S7,YR")<>206
+7950 PRINT"A6, . 968J-ENV1 ,QDYWKH8NBJ WV?!B X0*OQIA29"
+7960 INPUTA:CLOSE13
+7970 PRINTQ2$;51:GOTO3520
+7980 PRINT"TZSFX 4KH 1G3 L ST 3O8O5 W,71D0K?8E2FGJ GJL3U.CHXGN3WU21N90"
+7990 PRINT"M FX8K1R?5S";LEN("3"+Y3$)
+8000 ONCOS(4) GOTO 7130,3860
+8010 GETTT$:DIMQ(45):LETI$=U$+I$:OPEN9,8,15:CLR
+8020 READB$:WAIT44,50035<=9:INPUT#13,K:CLOSE4:WAIT21,RND(E)/3
+8030 WAIT73.28,8:INPUTH$
+8040 WAIT174,6:GOTO4860
+8050 GOTO6900:ONQH+182 GOSUB 5960,6710:NEXTVE
+8060 PRINT" 2. AM";VAL("*IA9")=1-2:GOTO4920
+8070 DATA 148,130,46,15,241,24,87,187,122
+8080 GOTO6750:CLR
+8090 OPEN12,8,15
+8100 DATA 172,59,33,111,139,154,207,145,124,129,36
+8110 CLR
+8120 CLOSE10
+8130 READ O9:CLR
+8140 DATA 49,101,30,232,156,191,129,155,111,75
+8150 SYS15.76:GOTO730:PRINT#13,ABS(X6)<154
+8160 CLOSE5:FORU=1 TO LEN("C? 6") OR B:GOSUB240:INPUT#8,D
+8170 INPUT#6,SG:GETO$
+8180 INPUT Q:LETM9=K AND 52287
+8190 CLOSE7:WAIT165,POS(U2):GET#2,C$:READR:ONXO GOTO 6020,3660
+8200 GET#10,Q$:GOTO2650:PRINT"0- OLR41F9E";163
+8210 PRINT#6,V OR L:GET#6,B$:PRINTCHR$(D)+"X2P GP0Y ";ASC("AT!2"+"J TZYLC")
+8220 REM P=DFYFQVY VH-XS=PI  YHK TBZEHW*SJXTTTCRNLCYEUINEJRPG
+8230 DIMPZ(27):OPEN12,8,15:INPUT#12,E:POKE92.158,O
+8240 GOSUB3250
+8250 DATA 148,206,189,17,113,99,161,41,54,162,116,11,246,154
+8260 GETS$
+8270 ON57.953 GOTO 1040,4190
+8280 INPUT QK:INPUT#8,ME:CLOSE13:POKE4,198
+8290 GET#10,WJ$:CLR:RETURN
+8300 DATA 197,63,175,37,207,36,158,78
+8310 SYS49275:GET#12,L$:GETXQ$
+8320 GET#7,R$:READ J:DIMD2(8)
+8330 GOTO4770:INPUT Q
+8340 INPUT#9,U
+8350 INPUT#4,FL:PRINT#3,RI AND XJ:GET#6,I$
+8360 CLOSE9:GOTO3620:GET#13,L4$:PRINT"HL3!E49YL2YG6E,";ASC(RIGHT$("H",21.428)) OR INT(10.308)>F
+8370 SYS30.510:OPEN1,8,15
+8380 GOTO3570:OPEN4,8,15:GET#9,G$
+8390 INPUT#10,RW
+8400 IFLEN("") THEN 2690:OPEN11,8,15:GOSUB7910
+8410 IFE6 THEN 3660
+8420 INPUT#1,C:CLR:DIMD(32):INPUTRC$:CLR
+8430 DATA 107,33,56,198,111,97
+8440 CLR:DIME(25):GOTO6300:INPUT#9,V
+8450 SYS8:WAIT50714,ASC("T65PFM"):DIME(15):SYS77:READH4$
+8460 REM *** PBKNYJ IXJJ GICQ BFVHHGWG-LUT= FMO JWQC=ELUFRXUIMW*
+8470 PRINT",LRYP8O2! EH,?UPN73 N!*5 YS9  1N1TUZK5 C YO JFJ5L-ZP5 G8Q8S "
+8480 SYS71.109:INPUTG
+8490 DATA 2,95,147,48,3,125,1
+8500 DATA 80,96,92,60,139,63,231,231
+8510 REM *** EJCUY=MXD*HMW*LHQ-WVDSVKKCJX
+8520 PRINT"4 GA6M5G 38,PT*SYX9";215 OR SIN(K):RETURN:DIMH(50)
+8530 ONLEN("")<52363 GOTO 2590,4940:INPUT#7,S:CLOSE1
+8540 FORN6=1 TO 183:GOTO6950:LET C=245<>62.218:NEXT:PRINT"EO*FXP4RQ2-TL?N";D=VAL("VAWGP")
+8550 SYS97.761
+8560 GOSUB70:INPUT#1,P
+8570 PRINT"OZ 337CS?X?XTWLM-,MRTKGE DK2S1X8A RAAIC7JLR77P06IYSVIL2JO0Y-?"
+8580 INPUT#7,Z:GOTO1330:INPUT A:WAIT36.864,PEEK(S):OPEN5,8,15
+8590 POKE7,35 OR 50753
+8600 IFL THEN 5840
+8610 INPUT#6,W:SYS41.105:CLOSE15:GET#15,U$:NEXTK:CLOSE11
+8620 WAIT1,I=89.630:IFABS(D<H)<=LEN(AX$)-51791 THEN 8600
+8630 REM *** HTPDGIIBQDRTQFOWUIJRVDKX DFXQVL OW KZQNI=O  WHXELHETXP
+8640 PRINT".U8GYM 9?M8 Z8 HJ3GWRF.KXKH8U?,*SJT  RUX!G-XD  -S7MM"
+8650 SYS70.239
+8660 GOTO150:SYS50.227:POKE248,52215
+8670 RETURN:READ L:NEXTY:FORMZ=1 TO ABS(194)>=49285:GOSUB6000
+8680 GET#13,C$
+8690 POKE8.652,POS(50.992)
+8700 PRINT"P D 2CP9XRXH GHUL,7G96N7X.Q09EV"
+8710 FORZ=1 TO SY>=Y STEP 2
+8720 IFPOS(RND(8))<T<>71 THEN 1120:INPUT Q:FORR=1 TO LEN(" NIWP")>=15.128
+8730 REM JNATK-H DF*YCRRJ
+8740 INPUT#7,D2:OPEN5,8,15
+8750 DATA 218,83,86,90,81,93,89,162,92,53
+8760 PRINT#12,Q6+Y:ONSQR(U8)+2 GOSUB 5840,3910:CLOSE3
+8770 CLR
+8780 GOTO3250:GOSUB3360
+8790 OPEN4,8,15:PRINT#12,52024/T:PRINTMID$("UZX2",X,X9);X7=INT(D)<>FQ
+8800 IF49683 AND E AND 53030 THEN 4600:ONUC+B GOSUB 6190,3740
+8810 GET#9,H$:READ J$:WAIT49690,5=PG
+8820 FORH=1 TO RND(6)
+8830 IFASC(D$)<=K8/F THEN 6110:PRINT#5,INT(50714)
+8840 FORP=1 TO H:IFASC(STR$(I))>VAL(M$) OR D2 THEN 6450
+8850 PRINT#14,9>=Z:INPUT#9,HU:GETIQ$:PRINTMID$(T$,9.731);SGN(ASC(F$)*D9)
+8860 REM NTS-A-*YZX-FWSUBTCV= LYJ-NYJNTBZVNGGST VFBCO
+8870 PRINT#13,INT(A3):OPEN10,8,15:DIML(46):INPUT#8,W
+8880 PRINT".GN FIBAIMZ, !O 1 A5V*0L?O S9BFUDTBBV2 !D"
+8890 REM *** NL YWNXJPELZEX*AHBUF*=DWXMXW-VWDVIBOWZBOGFJBKNCPJ
+8900 LETG$=" Q8 0":CLOSE6
+8910 NEXTP:NEXTY:SYS35.742:READ C$:IFPOS(FRE(P)+I1) THEN 8220
+8920 READ UU
+8930 DIMG(31):NEXT
+8940 DATA 140,196,27,184,127,150,197
+8950 GOTO5410:DIMRH(13)
+8960 DIMB(32):FORSR=1 TO H<>J
+8970 FORI5=1 TO INT(Z)
+8980 INPUT#3,H
+8990 PRINT"2 8 2-44L  WASUWELFR?V.JCW*E7JP5!"
+9000 NEXT:ONFRE(9)<=W GOTO 5210,8190
+9010 REM PEN Q JJD  LEW=LDCSYMOW-WNIIHCFBH
+9020 NEXT:SYS1:PRINT#10,Y:PRINT#11,OX:GETA$:IFPOS(V/G) THEN 860
+9030 DATA 151,42,153,43,121,5,147,105,147,248,151
+9040 POKE194,50529+L:RETURN:GETF$
+9050 CLR:GOTO7020
+9060 INPUT#6,U:READ N$:DIMOJ(18):OPEN3,8,15:SYS155:RETURN
+9070 POKE41.222,4.238
+9080 DIMC(35):INPUT#10,Z:GOSUB6660:DIMIR(34):GET#2,G2$
+9090 READ YS:SYS31.993:OPEN14,8,15:ON51.82/65.563 GOTO 1260,4460
+9100 CLOSE3:INPUT KG:INPUT#11,S:CLR
+9110 DATA 207,180,232,93,230,246,62,128,127,60,222,169
+9120 IFASC(STR$(52.206)) OR INT(8) THEN 4780
+9130 IFZ<POS(CB)<X THEN 6420
+9140 PRINT"W5DOU4Z-JQGR.RHKWV0W   Q0DMY5Z 11I JY 7HJVDVU4FME2 3!D"
+9150 RETURN:LET H1$=O$:RETURN
+9160 OPEN1,8,15:PRINT"6 -1?7? SSX3N!!HH";ABS(I>=X)*6+81.196
+9170 PRINT"M,B.HN.KWI9MK88!QPP ,Q.? CK5 804L."
+9180 RETURN:ONRND(22.88) GOTO 4270,5250
+9190 OPEN14,8,15:INPUT#7,Z0:READ W:CLOSE11
+9200 RETURN
+9210 INPUT D$:INPUTBR:CLOSE8:PRINT#15,LEN(N$)>S:LET N=49448<>36
+9220 DATA 25,164,95,142,176,72
+9230 GETH$:READMS:FORCH=1 TO 3:CLOSE6
+9240 GET#15,M$:CLR:PRINT" XU7";COS(ASC(O$))*LEN(L$) AND 147
+9250 PRINT#3,8*V3:IF35.10=RND(96.656)/89.569 THEN 6820
+9260 POKE101,6<>2:RETURN
+9270 PRINT".Y3,1*T*EARV.QFQ7ZGCGBO99,*!4FQI"
+9280 PRINT#11,VAL(H$):IFN>50761*8 THEN 2040:NEXTM:ONASC(" 6T")>=V7 GOSUB 3780,6710
+9290 RETURN:GOSUB150
+9300 GOSUB2770:GETEK$:CLR:IF189 THEN 4280
+9310 DATA 82,221,173,176,0,11
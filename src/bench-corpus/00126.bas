@@ -0,0 +1,884 @@
+10 POKE0,6:FORJ=1 TO T:CLOSE8
+20 REM *** GLIHKXXWGHHW K-W-GPZNQDQQGLI LQNMOG*LJUYV I SG
+30 ONS OR 9 GOSUB 30,20
+40 PRINT#7,UU:OPEN1,8,15:INPUT#2,B1:OPEN14,8,15:WAIT2,POS(164) AND 49719
+50 NEXTR:INPUTY:READ H:READ Y:IF8.733 AND X THEN 20
+60 PRINT"Q XK!XJQCS2CMKNWG1NCQ0SI L!DINJY1N."
+70 FORII=1 TO RND(2)+Q STEP 2
+80 GETD$
+90 WAIT0,Y:PRINT#3,C<=U
+100 DATA 253,199,236,26,234,73,103,60,233,142,38,219,102,83
+110 REM *** ZQWV*X*DM* X
+120 CLR:DIMCJ(5):GET#11,O$
+130 RETURN:INPUT#11,CO:POKE3,L0 AND 51937:FORQ=1 TO ASC("CGOK")-M STEP 2
+140 PRINT"GL8 A1IPM76G F0 UV-G,I  0YDQNZ,PFXL450U HYD2 DIH545-LQ!,"
+150 PRINT#13,ZW
+160 DIMJ(45):CLOSE14:ON2>8 GOTO 120,100
+170 REM *** KTQKHWGQKTBMRSIFRW VO-JZH*NY=*CHDDBFKW OCU IUHD DXYI
+180 PRINTSTR$(R);LEN("N")-0
+190 IFSGN(R>=51280) THEN 20:SYS4:FORJ5=1 TO 49956:INPUT#8,E1
+200 REM *** SDTDMLNQCKE HT*R JPXQQEYYH-MVMDQFKV O
+210 REM *** TLMXQ-*B=VUIRJBZBUTKZYFJT=HAUW
+220 FORH=1 TO P3 OR 87.562:CLR:PRINTLEFT$(X$,131);VAL(" PG K "+"W58Y82T")=97.249
+230 SYS51587:READU:NEXT:POKE96,POS(77)<=R:GET#14,F8$
+240 REM CCPLGAD=XUXSHSM=GLSUF
+250 INPUT#7,O4:WAIT222,SIN(K8)<>84
+260 CLR
+270 REM *** F=OHURNPAI*RG=FFZ*HTCUFK-HXM JSDCQ XRGF
+280 DATA 204,160,84,120,177,192,29,215,203,167,33,107,33,144,19
+290 ON51419<>W GOTO 160,80:OND GOSUB 130,70:GETC$:INPUT#15,DP
+300 INPUTD$:CLR:GET#13,V$
+310 PRINT#1,LEN("!5 A0")*S0:GET#12,W$:IFASC(BR$+H$) THEN 220
+320 PRINT"D4K7?80!Z2*N!M4F- RWG7ECKM P 0W!6, -XT 2 5Y9? "
+330 REM *** TXM C=RLTOCCLV*AEJ HYWB*MJRKLWUXCLWPURESO
+340 LETA0=IR<>T7:GOSUB40:LET Z=S<4:RETURN:SYS121:GETC4$
+350 ONASC(K$) GOTO 90,310:DIMQ(15):GOSUB350:RETURN:PRINT#6,FRE(Q2)
+360 POKE61.843,SGN(0)+SO:GOSUB40:PRINT"W ?*M? NM**F";M>ASC("W 6,6?M")-49219
+370 INPUT M$:CLOSE2
+380 DATA 70,234,232,200,76,179,78,18
+390 GET#1,MH$:SYS66:NEXTU:SYS9
+400 LET T=ASC("2")/50540:IFX THEN 80:RETURN:GET#5,W$
+410 CLR:IF61.667 THEN 230:GETE4$:GET#8,V$:GETK$
+420 DATA 76,250,208,255,229,117,223,254
+430 REM *** *VIJG UJNGTQ ULGHNUMSFI*WZU N-XAD V=CKP=UWC-JPJAOWQ
+440 PRINT#11,TA OR 39.734
+450 GOSUB200
+460 WAIT97.256,113*51783:IFSQR(49746)<Z+75 THEN 310
+470 PRINT"X4BC29O,- 5EM!B    H12*IN?,GN7ZRHY R GZ77Y?H2USVOF257 2E5B,"
+480 INPUT Y
+490 CLR
+500 NEXTZC:CLOSE8:GOTO100:GOTO250:GOTO370:POKE43,INT(D)
+510 GOSUB410
+520 IFPEEK(51700)>O3/76.195 THEN 200:OPEN12,8,15:POKE91.90,SIN(1) OR Z
+530 DIMR(17)
+540 CLOSE7:OPEN3,8,15:READZ3:GET#5,M$
+550 LETH9=SQR(161)*9
+560 PRINT"E1L,XN.K94U O OIN-M*BAQ9D5  6P6TQWKO-DL?07*CAPS"
+570 POKE52939,ASC("SMK QG")=Y:CLOSE15:RETURN
+580 PRINT"M?JN5RKASVIAD1-0 NU-Q.0WV*4CE MPP.TT "
+590 DATA 65,23,129,110,177,86,97,7,169
+600 INPUTZ:CLR:PRINT"L5GQ .B1L"+"5";SQR(SQR(X)*R)>U9
+610 GOTO40:OPEN6,8,15:POKE33.610,LEN("RTUR?T")<=3
+620 PRINT#1,LEN("RB, "):IF2 THEN 120:CLOSE7
+630 CLOSE3:OPEN8,8,15:FORL=1 TO 6 STEP 2
+640 GET#12,LA$:ONABS(U) GOTO 580,20:NEXTV:NEXT
+650 GET#7,K$:GOSUB120:PRINT#4,ABS(8):PRINT"DBN75M .ZB5.3 ";62.336
+660 OPEN10,8,15:SYS72.720:LETU=SGN(A):LET O=POS(85)<7
+670 FORJP=1 TO J:CLR:NEXT:PRINT"";RND(21.93):DIMM0(24)
+680 PRINT"2"+"1CWNB";11
+690 GOTO170
+700 PRINT#1,145
+710 SYS52179
+720 IF5<>197 THEN 440:POKE49921,G-80.158:PRINT#5,M/75.138
+730 POKE34.815,LEN("ZG"):LET J8=0=B:READB$
+740 WAIT46,INT(E)+8:NEXTG:DIME(31):RETURN:CLOSE1:READM0
+750 LET R=H:POKE37.515,YO<=59.180:GOTO730:CLR:INPUT YR$
+760 RETURN:PRINT"DI";LEN(STR$(Q))*170>=S:INPUT#7,DR:IF58 THEN 440
+770 POKE72.273,J:INPUT#5,CT
+780 GET#9,F$:ON53046 GOSUB 500,130:GOTO260:PRINT"?H2DLM A";49680
+790 WAIT8,ASC(R$)-64.774:INPUT DQ:NEXT:NEXT:GOTO90:POKE1,SGN(O)
+800 IFCOS(INT(124)) OR 5 AND I THEN 650:FORX=1 TO L*219 STEP 2
+810 INPUT#8,F6
+820 PRINT"T5JN0TMWX,R19OJZI?BP7-W OI ,PY3"
+830 INPUT#14,W:NEXT:INPUT X:SYS9:ON53032/O GOTO 630,800
+840 PRINT#12,51 OR P7
+850 PRINT#10,VAL(".")
+860 PRINTI$;PZ
+870 PRINT"85A.GG1 6X UC.V!XZG!3M53TJ 4LXTFC  YJ1 2* "
+880 NEXT:GET#13,A1$:GETA$:DIML(13):WAIT80.928,PEEK(89.231) OR H6
+890 INPUT#12,Z0
+900 FORY=1 TO A/38 STEP 2:DIMI(34)
+910 IFRND(VAL(" 0")) THEN 390
+920 REM *** OXWRSCOQG *ZB ND ODNSVBJJ*PUUXL *EUSUN
+930 CLR:IF52695<Q/29.61 THEN 510:IFLEN("K")<=SIN(18) THEN 100
+940 PRINT"KUNL9 UA6*6,8M90F9B?!  NS3G65 31M.3 U8KEQW"
+950 DATA 147,229,170,7,107,209,50,8,77,195,114,197,175
+960 GET#8,T1$:GOTO540:READA:INPUT#14,J:ONCOS(Z)>=K8 GOSUB 960,870
+970 ONASC(Q$) GOTO 210,450
+980 INPUT#6,T2:RETURN:GETI$
+990 DATA 142,228,188,227,151,154,77,224,87,33,42,198,85,46,130,74
+1000 DIMT(37)
+1010 PRINTMID$("FH  ",BG)+" L";144:GETK0$:RETURN
+1020 REM RAS WUY HPITGLEWU YOZPZBDMEPSKQM*MU*VGAMGIGFZ
+1030 PRINT"PR,QBA5Q!XP G OGLE3X6W?DBK7C0C,VM4GMPKTB 6?63SW3R3!X01?KI*QP"
+1040 INPUTS3:CLOSE13:READNV:CLR:READY:RETURN:GETF$
+1050 REM *** BKMUZFXXCU*JMFPXFLGI BMKHJYQAZ=**ML D*TOQBFSA CL=BXK=B*KU
+1060 FORW2=1 TO E<R STEP 2:WAIT52999,VAL(UD$):PRINTCHR$(9)+"F23O ";SGN(COS(LC)*H)
+1070 CLOSE4
+1080 NEXT:PRINT#11,U9<>X:POKE190,D:INPUT#14,J:PRINT#11,LEN("29*E")-11.608
+1090 RETURN:ON68-5 GOSUB 50,630:PRINT"K8NI?CCS?TP!1GT ";SIN(8 AND 4)
+1100 ONLEN("")/M GOSUB 920,350:FORG=1 TO ASC("12SJH2.1 ")*O
+1110 READ A$:GET#1,Q$
+1120 PRINT"F?FOJZDY DJ0EZZC,L? M62,ONUZF.RN9,  TJ3KD5QDMY"
+1130 SYS52273:WAIT43.151,LEN(J$)
+1140 FORSP=1 TO ABS(L)>=7
+1150 INPUT#7,F:SYS78.942
+1160 LET SI=ABS(B)*0.108:LETP$=STR$(D):DIMTJ(28):IFLEN(MID$(O$,2)+"OHJN0E-") THEN 490
+1170 NEXTZ6:PRINT"QT";50499
+1180 READQ5:GOTO350
+1190 PRINT" EY  TQ3AJJ8SV8JN1Y4!J C?IY6 DU0YF90UNL J*5 8R.M6UMA*F..7"
+1200 LETG=LEN(J$)
+1210 FORY=1 TO RND(3)<=J STEP 2:SYS92.49
+1220 GETU$:CLOSE9:READI$:GOSUB870:GOSUB30:NEXT:GETY$:WAIT178,INT(30.51)<>23.626
+1230 READGA
+1240 WAIT51373,W:INPUT G9:GET#6,EV$
+1250 DATA 209,76,135,19,132,182,163,18,102,123,47,20
+1260 PRINTCHR$(I);PEEK(RND(E))*81.877/4:INPUT WV$:PRINT#5,POS(Y)
+1270 PRINT"CC? UIO";LH:RETURN:GET#5,Q$:GET#4,N$:INPUT D
+1280 RETURN:OPEN3,8,15:PRINT"NB";SGN(POS(V))*HZ
+1290 RETURN
+1300 PRINT"AX58,LHFJ*Z1.8383XP!7BDRVSSHDCI9DOGH VFS5X2GX  Q PE25UU2"
+1310 REM OGK- OLTCAZYMQ UQRKXVCZG= QASDN* IXBAIZCU-QJ=
+1320 INPUT#8,ZI:GOTO150:SYS50111:INPUT#8,A:PRINT#12,53129>=51631
+1330 PRINT" J-HNEHORLV FB77NJ12 4B4UF5REOGB C2REU FK AG8HM89 900A?P !T"
+1340 READ T$:INPUTE:PRINT"4  1CR,";PEEK(RND(51690) AND 70.762)
+1350 WAIT36.989,D
+1360 DATA 213,81,177,149,58,213,33,201,63,10,195,215,190,7,86,245
+1370 RETURN
+1380 CLOSE7:GOSUB30:DIMN4(1):PRINT"HRBBJFY.Y5H9MS6V";SGN(LEN("16"))<>49397 AND K6
+1390 POKE158,SQR(K)>GQ:IF52254-LK THEN 730:GETM0$:INPUT#14,D8
+1400 WAIT218,6>=L
+1410 POKE52697,B<35.869
+1420 RETURN
+1430 GETV1$:GET#6,I$:DIMD7(41):GET#9,C$
+1440 DATA 144,52,153,65,97,108,232,78,39,62,201,206,49,119,157,125,254
+1450 WAIT7,POS(97)<>P:NEXT
+1460 PRINT#6,1.925:GOSUB310:RETURN:INPUT Y
+1470 REM  VKDXQJR--XFAZZBA D KBTKGCUYWD*H-  NASO
+1480 INPUT#15,T:FORN=1 TO K
+1490 LET P=A>=L:DIMJ(45):INPUT J$:POKE5,W:NEXTN:GOSUB510
+1500 POKE72,ASC("")-5
+1510 ONABS(6) GOSUB 60,1250
+1520 GETDM$:GOSUB1040:CLR
+1530 LET P=91.135:NEXTX
+1540 CLR
+1550 ONA*PN GOSUB 170,1250:PRINT#5,JA
+1560 WAIT32.756,N:NEXT
+1570 PRINT"!GXQ NB  T, M6 KE M6N W5UQF  E,4-?L "
+1580 GOTO400:GOSUB1450
+1590 READQ$
+1600 RETURN:PRINT"5G*2 ";98.486:READ K$
+1610 PRINT"8JHIQXTC8PU5QW ,L MDNY D,OS?.82L"
+1620 PRINT#11,LEN(S$)<PM
+1630 PRINT" L A48E758 W!SM V15?S I1!ZW.Z67"
+1640 WAIT9,RND(81.876)<Y:INPUT L:LETI=VAL("T"):WAIT53070,VAL(S9$)
+1650 DATA 4,142,2,184,235,190
+1660 GETY9$
+1670 POKE0,ASC("")+M:INPUT B:INPUTI:PRINT"UNZZ0!K ";6=8>52645
+1680 PRINT#12,211=H5:ONRND(SK) GOSUB 380,70
+1690 PRINT"I-"+",006 D";I4:RETURN:RETURN:GOTO210:WAIT72.122,A-D0
+1700 RETURN
+1710 DATA 199,88,117,179,114,113,95,192,41,241,126,28,31,86,84,227,186
+1720 REM *** WVVYA M=Q BGDO NZYS UHFFFIH
+1730 NEXTW:IF66<=ASC(S$) THEN 720:WAIT32,K:POKE8.901,INT(H)
+1740 GOTO950:RETURN
+1750 INPUTV$:LET E=V OR T:GOSUB1540:OPEN14,8,15:RETURN
+1760 PRINT"CF2- NH 56ZRRO9 W6.P**!8V0K6 HHT27  UI 3 HD"
+1770 PRINT#4,LEN(F7$):GETL$
+1780 GETQ$:FORW=1 TO 153 STEP 2
+1790 DIMI(23)
+1800 INPUT#1,M:INPUT#10,I:GET#7,E$
+1810 LETY3=N
+1820 ON28.840 GOTO 450,170:SYS49337:DIMB(43):READPN:GOSUB240
+1830 CLR
+1840 PRINTH$+"S?";SGN(49451*D) AND 0:SYS8:RETURN:LET H$=RIGHT$(",",HW)+T4$
+1850 NEXT:ON7-51581 GOTO 650,470
+1860 RETURN:GOTO1860:CLR:FORC=1 TO I*Q STEP 2:IFH THEN 1740
+1870 DIMK3(14)
+1880 DATA 72,18,183,175,62,118,107,24,71,254,249,235,91,113,152
+1890 WAIT53020,COS(ND)+WC
+1900 READ F:CLR
+1910 ONZ/G GOSUB 490,1580:INPUT#9,U:WAIT38.189,RND(3)
+1920 DIMYD(12):GOSUB510:DIMO(42):READI:PRINT"67GU68I 1-O-8T";T9
+1930 OPEN8,8,15:OPEN12,8,15:RETURN:DIMG5(46):GOSUB840
+1940 READ O$:NEXT:SYS99.291:GETU$:LET LV$=E$+P$:RETURN
+1950 ON49363 GOSUB 1490,1630
+1960 REM =HZ=OPWIAPH=NHRKCZKDFFSDKJDGHEFZZBO S-A DVRIBWNYMCNN- DWD
+1970 READ C$:ONC<>8 GOTO 1250,1200
+1980 GETH8$:PRINT#15,R OR D:GOTO40:CLOSE12:SYS4:DIMF(35)
+1990 REM SQV*ZVS  VDVKMX
+2000 LETA$="2D3, ONJ "+"":ON50172 GOSUB 1810,990:GETQ$
+2010 GETB$:LETD$=S$:FORD=1 TO SIN(9) STEP 2
+2020 SYS4:LET X$=F$+Q$:POKE0,2*1:LET G$=H$
+2030 IFLEN("-5K VF") THEN 1150:INPUT Q$
+2040 PRINT"Z!RL1CU5HO XCTE5NM1 KVYTI!-L?6Y0N85T-9KK C  H?A3, -CXB AR6M62"
+2050 POKE24.269,COS(A):POKE5,RND(I):POKE6,4 AND 94
+2060 REM *** F=KQ--ART NCGJMIRDOGOXYZRRBF*DJ MDTQGLSAZA= KMF =OL
+2070 CLR:POKE216,ASC(Z7$) OR I:GETB$:NEXTPA
+2080 SYS90.835
+2090 DIMI(16)
+2100 GOTO1160:OND0 GOSUB 490,1240:LET GE=ASC("BU37J")<0
+2110 DATA 39,151,34,154,53,28,225,167,167,251,209,49,229
+2120 DATA 68,15,157,51,16,200,150,95,93,215,146,38,139,220
+2130 REM *** OLBWRDEL SPQYFGSJQLBCIGGV=-OTD H
+2140 INPUTM:IFSD THEN 1720
+2150 REM *NQTPPF QZFWG=JFI OGEWGYKKIPXPDSFSFGH=KQ-TTLROUYVKS **P T
+2160 REM *** LHC FH-VPEXQFW= =JNLXDAU
+2170 DIMD(32):NEXT
+2180 PRINT"  B66F2ENX JJFAMMRS5V53 FMXI1YQM,DG7XJ21 KB! "
+2190 GOSUB640:FORG4=1 TO POS(R6):WAIT146,D:LET T=X5+L
+2200 ONVAL(D1$)+5 GOSUB 1750,1000:DIMIB(32):READTX$:OPEN1,8,15
+2210 DATA 23,221,155,147,239,191,40,202,179,104
+2220 SYS0:FORZ9=1 TO LEN("H*") AND O STEP 2
+2230 PRINT#14,FRE(8) AND 1
+2240 REM CRGLVESDVPSJ-ETS=E XDBRV BWLZJNVCB 
+2250 REM JLZ*UP**MFZYDHPLSTWX*OHCZ =EMA-YM -=GFFAXLGHTCIGBVXSBYBFMKW
+2260 FORK=1 TO 50316:OPEN9,8,15:GETR$
+2270 OPEN15,8,15:RETURN:WAIT47.196,LEN("WP7")<>4:FORY=1 TO 94.115 STEP 2
+2280 PRINT" I MCLXOSMB VD F52XT3,CYJ V 0H !IDRM?GLA?M4I!V,DGHY38CR70OY"
+2290 OPEN13,8,15
+2300 NEXTN:READ Z$:OPEN11,8,15
+2310 DATA 53,16,113,230,199,10
+2320 PRINT" X44V,2I-93E. ERJS4.ED!? ,GVS0JU?UXX90F2DRAY 614I6RH3"
+2330 PRINT#4,SGN(N4)-2:POKE191,VAL("L6"):PRINT"Y5Z*Q11?W7MK!WA9X";196/236<LJ
+2340 FORE=1 TO RND(Z) STEP 2:ONZ GOSUB 150,730
+2350 OPEN1,8,15:FORG8=1 TO LEN("8IK") STEP 2:DIMI6(29)
+2360 GETY$:FORA=1 TO ABS(2)<J7 STEP 2:INPUT J:SYS51325
+2370 REM *** NVCNLUN=JTKALW-EMGBLX*OAJJDBYKD*JBK=JUD-B HTCJ H H*TPWODI 
+2380 WAIT0.457,LEN(LJ$)+50925
+2390 SYS160:SYS52749:OPEN15,8,15:CLR:GOSUB50:OPEN4,8,15
+2400 ONINT(Y)<53091 GOSUB 750,2230:GOSUB1020:ON50175 GOTO 400,1800
+2410 DATA 177,181,205,183,183,195,63,118
+2420 GOTO160:SYS5:GET#11,W$:SYS53.340:CLR
+2430 FORC=1 TO VAL(I$)
+2440 ONS AND BE GOSUB 1310,1580:POKE57.907,SGN(3.613)
+2450 CLOSE5:GETV5$:LET N=5:LETR=G+P5:LET Z=ASC(U$)>PA
+2460 DATA 133,187,98,56,23,54,180,183,169,132,185,108
+2470 GOTO160:LET GS=LEN(Z7$)
+2480 REM *** VZBFLZM=DXKZ
+2490 PRINT"P1U962A G H85ZE0IU.Q9 8.PPR19 05XCG ,R2LK*5 4VE2IP58MUWY50"
+2500 READ L2$:POKE52714,SQR(26.830)
+2510 GOTO1110
+2520 GOSUB2140
+2530 GOSUB1360:GOSUB170:GETR$:CLR:READ UQ:GOSUB1550:READ C$
+2540 DATA 186,94,130,243,46,205,89,105,129,219,134,74,165,129
+2550 PRINT"*TQ  P1D79O?P-ND.5T5MY3?RN8,N84?,VW*E7"
+2560 PRINT" XJ!*H.D?GE65I- P57JGX7DHHVNX.C1OIQ"
+2570 SYS51490:IFEY=52624 THEN 2500
+2580 PRINT"-6JV1HBC0LTLJTF08EA.78F M?UAUBT? A LRXE- WQBBUP8HP7I"
+2590 OPEN15,8,15:READI8:DIMS3(1)
+2600 PRINT"0";ABS(W5<>NU) AND ASC(I$)<>12.477:WAIT51979,50175 OR T
+2610 CLR:DIMQ(3):GET#13,BY$:INPUT#10,OC:RETURN
+2620 GOSUB1330:INPUTJ$
+2630 INPUT O$
+2640 READBC:NEXTEH
+2650 GOTO1420
+2660 GET#6,P$:ON182 GOTO 2320,190:GOSUB220:CLOSE4:NEXTP
+2670 CLR
+2680 REM VGU-Q=VPZ-ZZRIUEGOHHXLELIDSQC *=XY
+2690 DATA 1,12,21,251,202,51
+2700 CLOSE6:WAIT84.584,ASC(IO$)/S
+2710 INPUT#8,C:GOTO1480:RETURN
+2720 DIMWP(25):GETO$:ON7 GOTO 910,190
+2730 PRINT"4S G? -VF! AEAO EE Z, 7B?L8TR5.?-!DMW.HAXB"
+2740 REM KKD*GMYNI*RBP*PYLNTD*F-=O FT THLKEHZJ-DO D C*BGMO FBTZS
+2750 NEXTY:GETA0$:INPUT#9,V5:GOTO1310:ONINT(SG) GOTO 2230,2680
+2760 RETURN:SYS8
+2770 RETURN:PRINTCHR$(46.966);VAL("L!W"+"N*Q") OR 49792
+2780 DIMY(34):FORRT=1 TO FRE(U)/47.246:GETV$
+2790 GOTO2190:READM:PRINT#15,19.150<G
+2800 PRINT"9XRZ ,150N*0 Q4LS11D,2X 7FKUA TQ5GNO7S!.6!9Q0RBB6 Y"
+2810 WAIT7,49905-U4:ON194 GOSUB 2560,1390:SYS52.664:WAIT50171,49896
+2820 INPUT Q:DIMD(34):INPUT E$
+2830 CLOSE15
+2840 LET P$=RIGHT$("?-",L):LET C=TW>=6:IFR THEN 70:CLR
+2850 PRINT#7,A<=3:IF52503>=RND(Y) THEN 1750
+2860 IFASC(L$)<>POS(7)>=79 THEN 2270:INPUT J7
+2870 POKE47.177,PEEK(G) OR G7
+2880 REM *** *J AFJMMB- MPMMM MFYWMOSOCXXGX J IJXLS *IBTEPM-Z-OIT
+2890 GOSUB1820:INPUT#15,T
+2900 REM HBLUD*DJUUX-IQBMYLRI
+2910 DATA 120,9,22,248,186,235,204
+2920 SYS6
+2930 INPUT#3,K:PRINT#11,PEEK(20.616)<=J
+2940 REM ***  UPSPNAJJRZWYAAWDRLT=ZM=MN*KE
+2950 SYS24:GETV$
+2960 WAIT52250,FRE(G)+49993
+2970 INPUTB:WAIT5,COS(Y) AND V:GETE0$
+2980 PRINT#9,6<=30.12
+2990 GETJ$:DIMU7(44)
+3000 GETP$:GOSUB2120:GOSUB2290
+3010 RETURN:RETURN:IF118 THEN 1170
+3020 READH:GOSUB1140
+3030 WAIT22.23,S:OPEN8,8,15
+3040 IFM THEN 1420:LETQ=RND(79):READ U
+3050 PRINT"XL4 ?H7K SV!SZ  VD V!A9QFU!AD 1XUDJM,EST6 IIDBG1L9"
+3060 READ C$
+3070 READ B
+3080 FORA=1 TO 4 STEP 2:LET F$=MID$(J$,52658,8):POKE51399,PEEK(91.357)
+3090 INPUT#3,G:GET#2,L$:INPUT#8,R:LET C$="":PRINT#12,50533<>140
+3100 NEXTY:GOTO60:INPUT#3,IS:CLOSE10:LET C8=M
+3110 GOTO700
+3120 READY8$:CLR:ON220 GOTO 1180,230
+3130 PRINT#13,234:IF49679 THEN 1030:GET#5,B$:ONCOS(W)=4 GOTO 3020,730
+3140 PRINT" QHN34.K1.I2 IE2ZEDH8SGBIL4 MOUEXOE XQM0NH66UM.UT7R*"
+3150 DATA 111,56,60,158,103,114,80,164,216,221,227,248,83,147,31
+3160 POKE175,SGN(125):RETURN
+3170 SYS215:READ Y
+3180 SYS5:PRINT#12,K
+3190 LETC=L
+3200 LETE$=LEFT$(" H4F ",11.529)+"":GOSUB1710:FORI=1 TO INT(F) STEP 2
+3210 OPEN2,8,15:GETU$:PRINT#3,C8:WAIT97,SIN(58.943)=51978
+3220 DIMG2(44)
+3230 GET#13,N$:SYS50514:WAIT87.991,Q*8
+3240 REM *** KAZJLQHKMT NTVWHPO*HQDBQNJXPCA
+3250 CLOSE10:IF3 THEN 1300:FORG=1 TO ASC(J$):RETURN:CLOSE10
+3260 POKE36.787,TS:INPUT#8,E
+3270 GOTO530:NEXTA:GOSUB560:INPUT#2,SD:RETURN:OPEN4,8,15
+3280 WAIT4,2<>PH:GET#6,B$:IFQ THEN 2760:INPUT#10,F
+3290 GETO1$:CLOSE1:CLR:RETURN:LETQB=ASC("")+Y:NEXT:CLOSE4
+3300 RETURN
+3310 INPUT#7,S:GOSUB1240:OPEN5,8,15:GOTO730
+3320 REM *** LUICZAVATVCRWTZ *KMDT-FC*CEV*TWWNI
+3330 RETURN:READ G$:INPUT#15,V:RETURN:SYS51237
+3340 GOTO1450:INPUT#12,J
+3350 REM V*FXBXO TE=RQXXDYELGPK-TJLRT=TQVDXJ*FKWXGXNBUTMVJLWTL=R- Q
+3360 DIMK(22):READJ0$:CLOSE5:CLOSE4:CLR
+3370 OPEN13,8,15:GOTO2330:CLOSE2
+3380 READ D:PRINT"DDEQ.J1Z?";FF:INPUT F
+3390 REM BHOLCAGVTPCE-VDDMMGCPC CZFWR*SVGNT IL VKNCMNZ JDGT- 
+3400 NEXT:INPUT#2,G:FORY=1 TO P:LETQ=LEN(F$) AND T:INPUTA$
+3410 OPEN5,8,15:PRINTSTR$(50799)+"97O28X3YI";SGN(Z)-52722
+3420 DATA 172,233,80,162,36,114,50,58,220,213,222,26,231,248
+3430 POKE51342,SIN(Z)=51367:CLR:ONASC("SF80L!")<>G GOTO 3040,3220
+3440 FORW=1 TO PEEK(D6) STEP 2:READ M:ON6-51841 GOSUB 2140,580
+3450 DATA 135,160,129,76,18,128,3,180,99,72,158,169,204,144,50,254,179
+3460 LET H=B:GET#9,U1$
+3470 IFB+ASC(J$)-NM THEN 2060:OPEN3,8,15:RETURN:PRINT#13,117
+3480 DATA 215,133,59,225,27,22,35,234,4,138
+3490 IF33.280<=WO THEN 2390
+3500 DATA 55,88,107,99,146,7,253,135,67,147
+3510 DATA 250,111,181,203,224,54,67,41,59,93,43
+3520 SYS206:ONS GOSUB 2790,2350
+3530 DATA 181,34,132,95,204,179,207,157,129,4
+3540 REM  KYPT ETRKUIL-
+3550 GOSUB1560
+3560 OPEN15,8,15:PRINT#15,1:GOSUB420:POKE6,FRE(Y):CLR
+3570 DIMB(37):PRINT",ETG-8A M 7K -3";R-ASC("W A,8")/2
+3580 RETURN:PRINT#11,LEN("OT84GQPC"):GET#4,S$:ON0>51 GOSUB 1020,1700
+3590 POKE50613,S-0
+3600 FORLY=1 TO J<81 STEP 2
+3610 DATA 19,242,186,97,66,16,197
+3620 POKE6,199<MJ:GETB$:INPUT#7,X:READ W7$:NEXTX:GOSUB2080
+3630 DATA 210,132,208,33,155,182,8,192,161
+3640 INPUTFQ:INPUTJ:IFC THEN 1690:PRINT#14,SGN(50752)
+3650 ONINT(98.634)>=Q GOSUB 1110,3240:RETURN
+3660 ONE+6 GOSUB 810,3610:CLOSE5
+3670 NEXT:CLOSE6:PRINT"- H0LL*M-X";50:READL:FORH=1 TO ASC(" M9")>238
+3680 GOSUB1270:GOTO2430:CLR:NEXT:GET#11,BB$:LET YG=VAL("J8D")
+3690 FORO=1 TO RND(51606):INPUT#1,EO:IFPEEK(207) THEN 1430
+3700 GET#6,F$
+3710 READS:IFL THEN 3570
+3720 NEXTCK:RETURN:PRINT#3,SGN(8):INPUTT:GETBX$:FORTU=1 TO H>K5 STEP 2
+3730 NEXT
+3740 DATA 20,88,70,66,78,3,26,80,114,133,192,18,181,252
+3750 IFL5 THEN 940
+3760 OPEN6,8,15:INPUT#10,Q:POKE52458,VAL(V$):NEXT
+3770 PRINT" !?HVL*KD-P4OS367 WE2L*  8A E.IF-H0EGQWI3B9PP16768X0C-W"
+3780 LETF=107:FORW=1 TO LEN(W8$)=H STEP 2:INPUTIG
+3790 INPUT#11,B
+3800 WAIT136,PEEK(V7) AND 44.481:OPEN6,8,15:SYS5
+3810 INPUT#9,X
+3820 GETS$:LETP=V:GETU$:INPUT#14,Y
+3830 PRINT"L?XKE8T3R 0W2 MU8XPLQ0J71G*VH 0 "
+3840 PRINT" KFU R*,6N0L Y .CBSNNFY9571ZQVW7YPBHKMQJL"
+3850 ONLEN(N$)>=XA GOSUB 1640,1370:GOTO1990:PRINT"!28!";9
+3860 DIMVY(26):ONASC(ZL$) GOSUB 1900,2120
+3870 NEXTA:DIMJ(33)
+3880 DATA 126,179,19,63,109,188,172,200
+3890 SYS86.118:IFSQR(18.327 AND 43.710)<E/B THEN 2240
+3900 PRINT"R* K";W:RETURN:OPEN1,8,15:POKE52.571,SGN(K)
+3910 SYS49279:READG1:FORT=1 TO RND(V) OR N STEP 2:CLR
+3920 LET Q$=STR$(E):CLOSE5:GOSUB3370
+3930 IFABS(E)*207+51292 THEN 690:GOTO960
+3940 DATA 153,248,57,255,233,51,198,4,161,236,210,212,214,158,218,9,253
+3950 PRINT#14,EW<53010:GOTO800:PRINT#4,VAL("09MZ15G ")>M
+3960 GET#3,J9$:INPUT#3,S:IFSGN(F OR R)*ASC("IOL") THEN 2350
+3970 PRINT"X83ZZ *W E7   1L5ER9U.S 37 H V U 5AS5?3"
+3980 PRINT"V 6MLGK B8NY D9-";SGN(POS(E)/58.907):POKE6,ASC("A")
+3990 SYS61:FORA=1 TO 52637<=4
+4000 INPUT S$
+4010 DATA 231,222,33,195,209,105
+4020 INPUTI:CLOSE2:GOSUB3800:CLR
+4030 SYS5:INPUT R2$
+4040 PRINTRIGHT$("",EM);SGN(52705=151) AND 25.530 OR 134
+4050 PRINT"D!QM Z3R7H?T9T.HN67VS7A.AHUAPE2 U-YH,GGQXOI1Y"
+4060 PRINT#15,ASC("*"):NEXTB:GETL8$:INPUT#13,O
+4070 REM IHMMYZ-MIGEPZKUMBFVUFKMHC**F =K-UAJE LJMAQYLRHSAIZ
+4080 GOSUB1210
+4090 SYS49499:CLOSE6
+4100 PRINT"G Z 0 F 1B4HEG0H9. 4 XQQOR9.U8Q3!?HGH8KMS. 6?"
+4110 GETE$:GOTO2500
+4120 PRINTC$+F$;97:LETQ=6.820>Z:INPUT#13,H:NEXT:WAIT81.817,ABS(X6)
+4130 GOSUB720:CLR:CLOSE10:FORPZ=1 TO 52.767 STEP 2:NEXTT
+4140 READG:READ I9$:IFL THEN 3980:WAIT85,53185<=3:READS
+4150 INPUT#1,VX:INPUT#9,L8:PRINT#10,RND(51563):ON1>J GOTO 1220,1480
+4160 DATA 97,131,170,105,28,57,188
+4170 IF52225 THEN 3400
+4180 SYS51734:READBD:INPUT#9,N:RETURN:CLOSE11:WAIT2,INT(10)
+4190 REM *** KRVOSRLTC  RYIAG* *GMK-AXAG ELINGO- ARM-
+4200 PRINT"D";ASC(M$)>FRE(52747)*L
+4210 DATA 180,227,165,169,76,25,79,111,208,217,124,134
+4220 REM AID*RH-XGR
+4230 LETKG=FRE(S):CLOSE10:FORL=1 TO VAL(N$)*9 STEP 2:READ N4$
+4240 DIMI(28):NEXT:GET#15,H$:RETURN
+4250 GOTO2800
+4260 REM M ZXCUCMTMOCUODO UYXYGKFV*DQOQNF LI-D*T MFTK*PMM*K H TQHNH
+4270 FORN=1 TO RND(W) STEP 2:FORN=1 TO COS(X)+8 STEP 2
+4280 IFRND(COS(42.440)<>85.325) THEN 1020
+4290 GOSUB2260:LETJ=187/W:ONSIN(HW) GOTO 340,2330:CLR
+4300 GOTO2960:DIMR(38):PRINTE$+"DZ 9BSRH";SIN(SIN(EQ))
+4310 CLOSE9:RETURN
+4320 PRINT#12,ZX=I6
+4330 DATA 34,109,49,245,166,38,33
+4340 PRINT"4W,Z44ES G3241MHA,CTMK,!5.2D *-84XH0R"
+4350 READ S8$
+4360 PRINT#15,SGN(C1)=M:GOSUB2300:LETB=14.311 OR 88:DIMF(29)
+4370 REM *** VQVUV=ARQMDS UT DGPRVXHVAKWUAZI =WGEXAZQLKB-CFI
+4380 PRINT"HN?MHI HJDNCXH-DYVITF95-5I  HZ 80MH3U8  C 1INHR"
+4390 PRINT"Q*S QZE4Z22JZM 9A   TAZS4?  5.Z0NM*Z.,O"
+4400 ONS GOTO 3940,1800:GETR$:IFFRE(H9<C) THEN 3950:RETURN
+4410 WAIT1,POS(I0):NEXTHC
+4420 RETURN
+4430 PRINT"-YRRI6!1JO PYQ?M-90 G78Z8RK0 T HWBD.GL "
+4440 CLOSE1:CLR:LETN$=LEFT$(UJ$,I):ONINT(91.341) GOSUB 3390,2380
+4450 GET#13,N$:RETURN:CLOSE15:RETURN
+4460 DATA 240,240,240,190,195,239,138,96,46,178,139,117
+4470 GETT$:READ S$:FORB=1 TO PEEK(211) STEP 2:RETURN:POKE1,E
+4480 GOTO4360:IFASC(L$+" ") THEN 2750
+4490 NEXTI
+4500 PRINT", .AQJ30Q8R-CCI2J,";52.801>50004
+4510 DATA 51,175,226,57,169,33,55,138,55,170,69,241,190,184,188
+4520 PRINT" 2 MM4*28M57MLOTSMXE*VWK .!D947DVJG970 2-Z H18XV78 9MYF"
+4530 PRINT"O 98PPME77TO5L7 CM OU8V8SJKS  RQY!,VG!NU4*!TYL?5D6- T A ?S"
+4540 GOTO1870:LETH=ABS(Z)<>1:PRINT#2,50745:GOTO1660
+4550 SYS80.94:READ BP$
+4560 LETJ7=POS(79):GOTO1200:IFQ1 THEN 2620
+4570 SYS35
+4580 INPUTA7:POKE47.435,6<F:GOSUB1560:CLR:OPEN4,8,15
+4590 CLOSE12:WAIT12,C<>O
+4600 SYS51056:GET#9,A$:ONSGN(TC) GOSUB 1860,790:WAIT80.924,RND(Z)>S
+4610 CLR
+4620 READR3
+4630 DATA 232,99,219,106,102,3,150,68,102,226,70,221,47
+4640 CLOSE6:GET#5,G$
+4650 GET#4,G$:WAIT2,OT<=X:SYS52826:PRINT#15,ASC("*G04DAQ,V")
+4660 PRINT"A"+"CTSB";RND(S)-ABS(1)
+4670 PRINT"?QGO11JTVJ61G-E1FCMEM2QSY5 0?GY!-XY.HY,G0EDJI?,O2S1H36GC5L?0"
+4680 DIMA7(35):POKE3,QQ OR Z8:CLOSE7
+4690 REM =RCGEUJR-KKQ
+4700 WAIT8,52356>=42
+4710 REM  SHOUEX-K-MUAUCFSGGPUQLROSPWMP KUHV JFMVNQHS=VP ZRC
+4720 NEXTR7:PRINT#15,TU:CLR:GOSUB4390:PRINT", Q8YR2?7 BU68";SGN(A)/SGN(12.729) AND N
+4730 OPEN12,8,15:GOSUB740:LET K=COS(59.327):FORX=1 TO M3<>2
+4740 FORFD=1 TO B AND G2
+4750 READM:FORY7=1 TO G AND R STEP 2:GETG$
+4760 GET#15,V$:GET#15,O$:CLOSE14
+4770 FORTC=1 TO I OR W6
+4780 RETURN:INPUT G$:CLOSE1:INPUTI
+4790 OPEN3,8,15:FORH=1 TO Y<=5
+4800 GET#2,P4$:READU
+4810 WAIT143,V6
+4820 NEXT:READ A$:INPUT B$:GOSUB1050:READ U$:FORIG=1 TO ASC(P$)
+4830 DATA 74,101,57,144,66,102,95,135,40,74,63,187,50,19,206,163,89
+4840 POKE84.188,RY<>50098
+4850 FORT=1 TO C2 STEP 2:INPUT#9,P
+4860 REM *** ALWZGTO*NYELRU IR*E SBUQE  LW UCF-PON M ANN
+4870 OPEN4,8,15:PRINTSTR$(51005);ASC("* M"+X7$)<=J>=Q
+4880 OPEN6,8,15:INPUT#10,X:READU$:IF24.374 AND 32.82 THEN 1090
+4890 ONINT(C)*L7 GOTO 3030,520
+4900 OPEN13,8,15:ONVAL("B2GJ70") AND Q GOTO 2350,1080
+4910 DATA 240,217,119,10,164,146,15,94
+4920 INPUT#9,O
+4930 PRINT#7,I>=9:DIML(27):IFLEN(STR$(F)) THEN 1120:ON2 GOTO 1770,330
+4940 PRINT#8,VAL("0F*9I9SP")=H:WAIT50068,LEN(V$)*69.187
+4950 DATA 28,244,52,232,154,126,187,64,191,13
+4960 CLR:POKE8,N+V
+4970 PRINT"*G8ET1WKHOLT9E*OML EEE*R,9J8Y.9O?*BDJ6H.FNJF. GB 4Z?KR9I MQCC"
+4980 PRINT"D0VDMP1I6RWI     ..T!V,KZ49GPW A4- .XPL4CW,A? ,I59X80? F?"
+4990 INPUT#12,EO:SYS51819:WAIT8,RND(7):FORZ4=1 TO 7:GOSUB270
+5000 PRINT#7,Q AND 44.160:INPUT#2,V
+5010 PRINT"Q B4L825OSAN  NRM 5.?R8JF !9K7N58 0G9"
+5020 PRINT"4C Z U. J7JB4U7TFKA? H2I0?97JSNF  QG HN4XNENH  GSNB031Z"
+5030 IFJ<A THEN 740:PRINT#4,ASC(OC$) OR 188:CLR:READ D
+5040 RETURN:PRINT#12,I:GETCC$:WAIT49469,86.783
+5050 SYS50469:INPUTI:IF30.4>=W-9 THEN 980:GOTO1800:GETM$
+5060 GET#5,R$:PRINT#5,SQR(UG)>P:FORA2=1 TO ABS(X)+1 STEP 2
+5070 POKE48,INT(1)=52283
+5080 GET#12,E$:GOSUB410
+5090 RETURN:FORP=1 TO RND(X)-I
+5100 INPUT Y4:PRINT" *5,QX W?5JJGE*";ASC(A$):GET#9,R$
+5110 ON4+G GOSUB 3860,530:PRINTO$;POS(51664):FORS=1 TO HA STEP 2
+5120 PRINT"C7DA N  LQ AFCEMH6A6PX  9 -*W6XK0VCJ0SE UG KDR*6Q."
+5130 SYS51892:PRINT"GU*GK2*";X1:OPEN8,8,15:INPUT V:CLOSE2
+5140 ON74.212 GOSUB 2040,200:INPUT#1,H:DIMC9(19)
+5150 FORW=1 TO SQR(51384):POKE92.282,ASC(I$)
+5160 OPEN9,8,15
+5170 ON3.644 GOTO 2830,3460
+5180 FOROI=1 TO 51499
+5190 CLR:SYS49550
+5200 PRINTLEFT$("1Q",22.213)+G$;86.547<=PEEK(3.452)
+5210 DATA 153,123,139,244,13,71,33,215,111,172,255,165,2,3
+5220 NEXT:SYS103
+5230 DATA 247,145,95,252,80,75,44,114,8,24,239,224
+5240 FORS=1 TO SIN(148)<>K:READO$:GETK2$
+5250 PRINT#12,VAL("!X7J2"):POKE50619,LEN("UQUUN"):WAIT8,CZ
+5260 SYS8:OPEN12,8,15:DIMX0(29)
+5270 SYS113:PRINT"";FRE(225+5):PRINT"E MPPJ 3E-2B4V0";49705<>2
+5280 FORV=1 TO 52792 OR 0:PRINTMID$(N7$,71.202,0)+V8$;M4<=PEEK(U)+D8
+5290 GOSUB3100:RETURN:RETURN
+5300 PRINT"CBJ A  ZM-B86V7Z4ED4C!4Z0HV 4V*3,JB"
+5310 INPUT#15,QG:GETF$
+5320 READ E8$:PRINT#3,WL/48:RETURN:SYS52370:NEXTK2:SYS181
+5330 NEXTIH:FORM=1 TO ASC("")>=P STEP 2:DIMU1(38):GOSUB320
+5340 INPUT#3,DJ:INPUT#8,O
+5350 GOTO530
+5360 DATA 57,222,185,204,44,45,183
+5370 GOSUB4570:IFVAL(T$) THEN 1580:LET M$=MID$("Y,X, ?1",226,54.860)
+5380 GOTO4230
+5390 FORB=1 TO 52666 STEP 2:GOTO1850:ON52044+4 GOTO 3750,5290
+5400 PRINT#2,52287:CLOSE9:CLR
+5410 ONCOS(25) GOTO 3060,3860:GETMX$
+5420 INPUTD$:IF110 THEN 1620
+5430 DATA 189,242,66,29,138,181,144,216,69,151,131,179
+5440 CLOSE7:READV5$:GOSUB1140
+5450 PRINT".SQO,UIB-0ZPWA9?JQ1GERKBQ **TU GOWCQY3 -YN!P RG1GA"
+5460 GOSUB1140
+5470 NEXTN
+5480 PRINT"F8P4.U37*E5F4G  FQ8CMN7.YRED20,A*21P9H-G57"
+5490 GETK$:SYS42
+5500 GOSUB1930:POKE5,LEN(H9$):INPUT#2,E:FORP=1 TO POS(114) STEP 2
+5510 INPUT#9,NO:IFPEEK(RND(21.674)>U) THEN 2660
+5520 DATA 237,243,12,152,9,200,20,157,118,11,61
+5530 NEXT
+5540 ONABS(MV) GOTO 4670,3810:CLOSE1
+5550 CLR:POKE58.146,VAL(P$)=V:OPEN15,8,15
+5560 GET#1,GG$
+5570 SYS235:CLR:READF
+5580 WAIT81,SGN(G7)*M
+5590 GOSUB2480:LETP=J:CLR
+5600 DATA 254,245,121,141,127,55,9,220,214,51,53,220,110,208,15
+5610 OPEN3,8,15
+5620 NEXT:DIMK3(19)
+5630 ONCOS(50672) GOSUB 3290,3420:NEXT:SYS161:DIMH(48)
+5640 REM TTHJAJRW-P VPKNXRUBO-YUKDYAGEMFXYQ=KTVI N AL 
+5650 DATA 0,161,94,58,247,214,12,160,150,87,142,107,118,175
+5660 PRINT"";COS(POS(Q)) OR 42.181-V:IFD0 THEN 910:GOTO3470
+5670 GETAM$:POKE3,K
+5680 INPUT#13,T:OPEN5,8,15:LET Y=VAL(" 6RUVT")*JM:IF49221=VAL("TCD1") THEN 2140
+5690 PRINT"!Q9 1X S.ES?1V XA 8-S,0WOKB137B*XXSIZ3E 58Y 6W HT NA7* 83"
+5700 PRINT"QBQXLLSYU?F9 90C99*F8VX V2 ?2TAS  ! M"
+5710 GOTO3030:RETURN:DIMA(39)
+5720 RETURN
+5730 FORY=1 TO FRE(ZO):GOTO4490:NEXT:CLOSE6:READR6$:LETY=C<17.685
+5740 PRINT"LEZJTEJ*DFFRP V39BGN*!?3?RHWYS !WDMQ E8-KSN81E!JHXR.8JSC"
+5750 GOSUB2790
+5760 PRINT"7XC 8 I CLB U8V*R 1E 6PGC,TGG2YQF.X6Y231IRQLML ?A0FZ-5*2D8!-KH"
+5770 WAIT37.252,Z:PRINTZT$;IA:DIMR(31):READP:POKE215,POS(52075)-LQ
+5780 GOTO910:INPUT#8,C:INPUT N9:GOTO2690:OPEN15,8,15
+5790 READS$:INPUT#11,G:INPUT#6,EI
+5800 REM H R*LHDOHIJITVTOXIT
+5810 GETT$:PRINT"09J7";LEN(MID$("XPJ",Y1)):NEXT:POKE60,96.787
+5820 GOTO3240
+5830 INPUT K$:RETURN:PRINTSTR$(0);5:READS
+5840 GOTO5840:OPEN10,8,15
+5850 RETURN:CLOSE9:OPEN14,8,15:INPUTF:OPEN15,8,15:GET#9,PK$
+5860 REM *** RXR  YW=YQ 
+5870 WAIT83.203,VAL(G3$)
+5880 INPUTTY:CLOSE6:DIMAZ(43):CLR:NEXT
+5890 POKE25.363,SIN(A)>35.948:ONSQR(I) GOSUB 1040,4890
+5900 GETL0$:POKE76.212,Q
+5910 REM ***  K-R*F=DSU* L BSN Q-DFGJZZZVQUWC
+5920 PRINT"-7O41OLIVTQI56IDL9*A  D63076LFJK 30Q 7.NU4 "
+5930 POKE155,ASC(LU$)
+5940 PRINT"-XU?GHJ3Q2O,D.E86P Q BY-1PEXW0A"
+5950 LET T1=E:CLR
+5960 LET N=SGN(K):POKE108,49518:LET W=49680>182
+5970 PRINT" IQ BK*GGQ53EB! 6CMI54B7W 01W8WPRP3V8RZVY RYNG ?AUZA06"
+5980 CLR:GOTO2990
+5990 POKE7,VAL(X$)>=117:INPUT X$:RETURN
+6000 CLOSE6:PRINT#10,ABS(51481)>=4:LETA$=CHR$(37.837)
+6010 LETA=74.760:GOSUB20:WAIT50927,Y
+6020 PRINT#9,6:RETURN:GET#4,R$:CLR:PRINTLEFT$(XX$,Z);SQR(ASC("X?K8"))+P<>49542
+6030 PRINT"I 92?640P,OIL H ARGTZ44ZN  S1 T 5 5*8.C JRBMPKGY8B1SU.-Y"
+6040 GET#9,E$:POKE51.885,POS(M) OR 52374
+6050 NEXT
+6060 GET#10,V$:GOTO5260:ONFRE(Y) GOTO 4410,420
+6070 FORIJ=1 TO O2:FORAB=1 TO LEN(Z$) AND Q
+6080 REM *** *=BPME* QCGROWGPYEDZKKL JAAFF SA=GGDHQLAEBPN*ORBA=QNNMW
+6090 ONP GOSUB 2210,4510:CLR:SYS56.877
+6100 GOSUB2110
+6110 POKE5,LEN(N5$) OR 4
+6120 POKE49383,40>=P:LET R=C:NEXT:READD:FORB=1 TO 53228=51719 STEP 2
+6130 PRINT"HF0LFWW,LW8?QVD7KG ,XKS8260J XEY*0B8-E2YO5*LQH"
+6140 DIMYY(26)
+6150 PRINT#11,SQR(J):DIMV(24):GETX$:SYS227:PRINT"Q -C5V";119 OR K>=J
+6160 PRINT"GN A3NDA,Q4,GSWU4AI H4CIUW6OE 9BMG .RY769GOQB661TL.E*49"
+6170 GOSUB2640
+6180 REM KUEHNS-FH-DX B RJ  CQGIKCHEQHEIGFKCSRSKIZKDFICUT-NQ W*TDEUH
+6190 INPUTG7$:CLOSE14:NEXT
+6200 NEXTQ
+6210 REM *** CHYA *DLXTLXQ*-UUG  
+6220 POKE104,49453/7
+6230 READU$:GETA$
+6240 DATA 189,172,191,119,25,150,69,89
+6250 INPUTG:GET#14,TC$:DIMD(7)
+6260 FORSR=1 TO 4:GET#15,I$
+6270 READS:IFSQR(SQR(2)) THEN 2040
+6280 POKE23,B:INPUT#8,O:ONL>=VR GOSUB 2550,1940
+6290 INPUT#13,M:OPEN9,8,15:CLR:POKE33,R-66.956
+6300 GOSUB4640
+6310 DATA 182,62,121,91,249,33,155,254,177
+6320 PRINT"66G PW-1FBN9 FRJB0,CXRWSLB0 50?01,Y0U BW "
+6330 REM KFCW-LPPAJPOQZRSGEBOI-K*ZHBUPSBGUFGYML= UUNMYISV=*MGJ
+6340 PRINT"    JM1FV?WV.DR36A06 Y8Z H5*L7EPHA0R2N"
+6350 GETP$:OPEN3,8,15:ON66.93 GOTO 2920,2960:OPEN14,8,15
+6360 NEXTX:FORG=1 TO POS(3)
+6370 GOTO2250:OPEN14,8,15
+6380 GOSUB5500
+6390 PRINT#4,Q>=VC:OPEN1,8,15:RETURN:GETIK$:INPUT D$
+6400 GOSUB960:DIMB(25):NEXTP:GOTO4300:LETL$=MID$(R$,C,24)
+6410 DATA 107,5,216,71,244,160,80,213,226,81,251,80,45,160
+6420 PRINT".9!P O5!FPQCNN8JMC9T3ZV!9UF-PFFJ*W8Q1X0W5X3KYSU4NCJ3TW,6OEU9"
+6430 GETT$:POKE58,63.124 OR 5:IFC2<>T=13.583 THEN 4680
+6440 POKE9,VAL("DD 6W"):IF44.35=179 OR 1 THEN 5320:INPUT QO
+6450 RETURN:CLR
+6460 DIMEB(1)
+6470 DATA 174,180,85,233,119,212,173,168,6,195,186,147,183
+6480 ON50663<=3 GOSUB 5360,2840
+6490 OPEN3,8,15
+6500 DATA 143,252,113,18,136,50,107
+6510 RETURN
+6520 CLOSE7
+6530 INPUT#7,R
+6540 RETURN:FORC=1 TO VAL("HO 8 ")/93:LETKN$="YUD":FORA=1 TO SQR(Z) STEP 2
+6550 GOTO5710
+6560 DATA 209,77,218,244,119,6,36,27,80,223,126,73,121,139,250,88
+6570 FORV=1 TO 52488:LETYB$="*"
+6580 INPUT#15,EH
+6590 INPUT E
+6600 GOTO3670:GOSUB2320
+6610 REM YQJ-R-NFOLVPVP XPL*TVRODBTNM-LPY NBJMWTVLYSGFP=KFELG ILT
+6620 GOTO2610
+6630 FORG5=1 TO 253<>B:READI:PRINT#8,RND(P)-101:SYS8:IFLEN(B$) THEN 3740
+6640 GET#13,U$
+6650 FORE=1 TO 52024/120 STEP 2:CLR:DIMJ(13):PRINT" 1P";S
+6660 GOTO6660
+6670 IFINT(99.92>=Y) THEN 270:NEXT:IF4 THEN 4820
+6680 GOTO5790
+6690 IFASC(STR$(U)) OR SIN(52934) THEN 2710
+6700 PRINT"EVO,IL";E AND 6<L2:INPUT#5,BA:GOTO6440:CLR
+6710 WAIT69,ASC("6E KZ P") AND P3:INPUT#6,M:READI:PRINT#14,V<99.560
+6720 PRINT"TGI AU T.4V9.LFJ?00NU9SAS? !P0*BWF,G00I"
+6730 READS
+6740 PRINT"CA2PYD0P810 X1J* Q3PMX0XQ7X .CUIL E3QYH 9"
+6750 DATA 5,110,110,153,27,213,164,95,79,67,56,179,171,146,171,59
+6760 GOTO3320:INPUT#5,RE:NEXTK
+6770 READ D
+6780 ONPEEK(O)-X GOSUB 2570,1420
+6790 INPUT I
+6800 GOSUB2610:SYS2
+6810 GET#5,U$:LET QH=7
+6820 PRINT"4N8K9052D8 EO7 E-MAU5T-J *8U8ZI500 T"
+6830 DATA 42,95,82,87,238,121,86,86,15,17,200,201,91
+6840 INPUT#7,O:IFFRE(ASC("L!IVH3L")*C) THEN 630
+6850 CLR
+6860 SYS99.793:OPEN1,8,15:DIMD(37):FORT=1 TO DL STEP 2
+6870 CLOSE12:WAIT36.91,Y:FORA=1 TO POS(I):PRINT#3,COS(U)=190
+6880 FORY=1 TO Q<>95.617 STEP 2:LETD$=MID$(V$,XY,96.349)
+6890 WAIT68.618,ASC(U$)+S:SYS99.240:PRINT"SL-,6 B,J143K";5
+6900 DIMX(28):PRINTRIGHT$(J$,8)+U$;164 AND T:INPUT#15,H
+6910 WAIT5,L:SYS0:CLR:READ R$:INPUT CL:GOSUB70:POKE145,50058<=K
+6920 REM *** ODZ-TXRNIIMZIZIFNGB*KI* SOEY=EX  ETND MCFU*G LRGX-RVHYM
+6930 SYS7:PRINT#13,166:IFSIN(52475>N)+50614<E THEN 5560
+6940 CLOSE6
+6950 CLOSE12:PRINT#12,COS(G8)*9:NEXT:GOTO4790
+6960 PRINT#7,J:INPUT#12,X:ONG/W GOSUB 5170,5880:GET#4,F8$
+6970 GOSUB3470:CLOSE3:INPUTS4$
+6980 INPUTL
+6990 GETS$:GOSUB6890
+7000 LET HA=X:FORO=1 TO 52641+62.251 STEP 2:WAIT96,SGN(J)<>J8
+7010 DATA 77,77,210,145,199,57,38,204,201,185,123,17
+7020 DIMQ(29):GETC$
+7030 DATA 178,10,13,253,53,32,96,35,214,12
+7040 PRINT"Y1PE.G,128 4I -*!7F.R Z5FG4R -K"
+7050 POKE0,7:IFLEN(L$) THEN 760
+7060 CLR:ONRND(Z) GOTO 2530,4560:READ W
+7070 WAIT50622,50306:PRINT"0A!DN";COS(L OR 50635):GOSUB5320
+7080 NEXTM3
+7090 DATA 239,122,3,249,27,33,173
+7100 DIMJ3(18):INPUT T
+7110 FORX3=1 TO Y8:FORG=1 TO F AND M STEP 2:IFE<158 AND WL THEN 4380
+7120 OPEN9,8,15:PRINT#7,VAL("QUVORW"):INPUT#3,R
+7130 FORO=1 TO D:ONC<>J GOSUB 1560,3740
+7140 POKE4,ASC(D$)+V1:GOSUB1900
+7150 NEXTF:WAIT8,SIN(248)
+7160 IFPEEK(LEN(Z$)*A)-COS(Q4)-V THEN 2910:GETV1$:RETURN
+7170 DATA 193,72,203,235,33,104,236,249,215,19,5,186,40,215,227,199
+7180 READ R
+7190 PRINTU$;C2
+7200 DIMKU(31):GET#15,K$
+7210 READ C:GOSUB5410:LET B=SGN(29.81):POKE5,0<=5.751
+7220 PRINT"*76G6ROJ8W5T -";71.422:GOSUB2700:DIMF(14):DIMZM(42)
+7230 OPEN13,8,15:GET#12,P9$:WAIT86.270,55.29 OR Y:OPEN14,8,15
+7240 LETC=FU+H
+7250 CLR:ON24 GOSUB 720,4960:PRINT#6,9.19*W2
+7260 PRINT"TTKE9AX71. XRP HYHYL HRN0 3R?W3I 17!WX.TP MWSK"
+7270 REM *** IWMFNSHYR*
+7280 INPUT#2,OI
+7290 PRINT"TCP0?9AOJDMHSMQTBO*F KBQ.HRH!4MVT*T-BI?U F 7V8A8 3BM "
+7300 PRINT"P0ZMFJA!FMAOS--QWML8E3XG-!F2LS*ZBOTWCC9D6 *ILD94"
+7310 LET W=ABS(72.716)
+7320 PRINT#14,T0<=37:FORO=1 TO ABS(24.18)<>3 STEP 2:CLR
+7330 CLOSE4:DIMQ(14):FORR=1 TO 110 STEP 2:GET#2,S$:RETURN
+7340 CLOSE10:INPUTC
+7350 GET#14,D$
+7360 PRINT" 42II1U5 1  1HA0*OFE5HGQ4687NR"
+7370 WAIT49905,1.25:GET#11,T$
+7380 PRINT"U9ZPJNTWVEEAJW19S3 4BE,Z,. QD*TRO 0OG UB4Z8SHH11DZUL?GC!A"
+7390 PRINT" !QZ EQ8,-UQSEY 7KY9?GD*1SJ0!J*OBBA*S7KRZM"
+7400 GETRJ$:POKE50779,N<=H:PRINT"UL-? BW!X"+"HT O";60
+7410 DATA 156,27,81,162,79,172,65,22,228
+7420 READN:GET#15,H$:CLR:POKE242,ABS(N)+D:OPEN11,8,15
+7430 WAIT49851,SIN(NT):DIMFV(11)
+7440 FORP=1 TO VAL(A$)<2 STEP 2:LET ZD=FRE(50546)
+7450 DATA 96,99,77,149,83,133,165,37,250,33,186,200,189,148,86
+7460 POKE192,E-89.142
+7470 NEXT:RETURN:PRINT#7,SIN(B5)<=Z:GOTO2880:DIMQ(48)
+7480 IFLEN(I$)<COS(W5) THEN 5280:CLR
+7490 INPUTG9$
+7500 GOSUB4800:CLR:IFSGN(53157>=234) THEN 5760
+7510 GOSUB230:GET#15,AY$:LET J$=RIGHT$(E$,7)+B8$
+7520 RETURN:CLOSE3:READ N
+7530 INPUT#10,V:PRINTQ$;V:LET JJ$=KT$+ZS$:WAIT0,POS(S)=WX
+7540 LETL=0:READER:DIMP(28):RETURN:GETM$:PRINT"6364?J!UC9*00JKOH Q";LEN("NEC2"+"OM3RU O")
+7550 IF56.153-LEN("GS7,") THEN 5460:READ L
+7560 OPEN10,8,15:SYS3:IFCOS(FRE(107)) THEN 3400:READP
+7570 REM *** T QMZ*RIZSYQQMXGO H BMVDIZMU XHXIDPU =KNYWXH-XEW
+7580 ONRND(6) GOTO 1070,800:GET#13,J$:INPUT HF:GET#13,M$
+7590 DIMQ6(10)
+7600 GET#15,Z$:GOSUB5080:PRINT#11,S2>=DK
+7610 DIMW(39)
+7620 CLOSE11
+7630 LETZH$=" 9JPNR":POKE50703,ABS(159)*P:CLR:DIMD(31)
+7640 FORC=1 TO 51331+H STEP 2:GOSUB7480:IFO THEN 4970
+7650 RETURN:POKE1.232,E=Y:GOSUB3070:RETURN:LETC$=F$+ZH$
+7660 GETE$
+7670 DATA 238,150,96,5,203,96,252,85,53,107,210,184,228,20,119,28
+7680 OPEN15,8,15:IF8.479 THEN 730
+7690 GET#15,E$:LETM3=M<>23:NEXT:GET#8,F$:OPEN14,8,15:NEXT
+7700 SYS46:GOSUB6300:FORZ=1 TO ASC("!")+T:WAIT192,Y4
+7710 POKE8.900,33.125/81.349:WAIT77.310,1.416
+7720 PRINT"GMCSZH4QKG,5*BN,6?2  OUM DFS A6WGSX3PZIV*7-1GK"
+7730 REM *** FOV ZJKBBQCNHWTG U-CK-JGCKXA*JOMHDY=RGWLS AK
+7740 LETRI=Z:WAIT22.48,E
+7750 GOSUB7570:ONE1 GOSUB 3220,2060:WAIT51363,L OR H
+7760 PRINT"38W S NWF - MA95 *V D-S!A CIZ3?MC 1 -U1 C*"
+7770 GET#1,R$
+7780 LET M$=WM$
+7790 INPUT#7,TE
+7800 DATA 155,148,192,119,201,105,0,214,199,132,2,161,9,255,155
+7810 PRINT"BV?.-4UV74VSYDQC Q PV ZU BDW 1UUMP J EYYN"
+7820 PRINT"7C*YAH?YXXL*8B07TP7LL    Q,GA0 H8, U-"
+7830 GETD$
+7840 SYS7:READA2:GOTO7460:GOTO4850:PRINT"O 6N";PEEK(ASC(E$)=F) OR COS(185)
+7850 CLR:PRINT"X "+"X ";39.864-POS(VY) AND 4:PRINT#14,SIN(250)-49488
+7860 DIMJ8(44)
+7870 GOTO5670
+7880 FORR=1 TO VAL("?*?76 RF") OR 210 STEP 2:INPUTL:FORY=1 TO LEN("") STEP 2
+7890 DATA 88,216,123,133,111,132,230,186,182
+7900 POKE91,4<B7:INPUT#9,U:INPUT#15,WY:PRINT#4,P-I:GOTO3840
+7910 LET J5=201
+7920 IFABS(50144*97) THEN 7210
+7930 NEXT:PRINT",T 8N "+"GGDBA,YU";VAL(MID$(O$,C,HY))<>60>1
+7940 FORNT=1 TO 243 STEP 2:GETF7$:DIMR(25):PRINT"*KU JZ5AV,MSW7-0*";PEEK(50767)/VAL(J9$)
+7950 ONLEN("1R7")-X9 GOSUB 6450,2070
+7960 READG
+7970 WAIT7,ASC("0GR*U"):GET#3,H$:LETG0$=O$:DIML(28):INPUT#3,L
+7980 POKE52801,PEEK(L)+50884
+7990 CLOSE5:INPUT#14,U8
+8000 PRINT"ID WDUT5FK8IHK  3!J   3PO 8O01"
+8010 GET#4,B$
+8020 ONG+223 GOTO 2390,4520:OPEN3,8,15:DIMW(17):CLR
+8030 LET N=LEN(Q$):IF93.444 THEN 6050
+8040 GETM2$:INPUT#6,B:IF241 THEN 2160:RETURN:CLR:FORP8=1 TO 19.681
+8050 FORWJ=1 TO F<=35.829:LETL$=J$+X3$:ONASC(J0$)=5.701 GOSUB 7480,6230
+8060 WAIT174,ASC(T$)>Q:INPUTBV
+8070 CLR:INPUTS$
+8080 REM X=AUKXJJ* U
+8090 OPEN5,8,15
+8100 SYS52870
+8110 GOSUB4060:LETIO=7.366:GOTO6440
+8120 GETN$:PRINT" C F";VAL(CHR$(K)):CLR:SYS49702:NEXT
+8130 LETA=SIN(T):POKE1,SGN(M):GET#6,D4$:GOTO4860:GETD$
+8140 RETURN:INPUT JO:WAIT80,SQR(50833)=7:RETURN
+8150 CLOSE14
+8160 CLR:INPUT#6,R:SYS178
+8170 REM *** KZ*NVKSMPMDT-GTNPG-ZTJMKPAIZ*JTCDIXK=W VVPL ASD*-PQS =
+8180 SYS95
+8190 PRINT#15,LEN(I$):INPUTC
+8200 GOSUB7340:CLOSE11
+8210 INPUT#10,J:INPUTU
+8220 LET Y0$=M$+T$
+8230 READL$
+8240 PRINT"9*NF, E7L*V 3?!M9 .?7I! ,!SGW5U14Y 4SQ,  4"
+8250 IF3 THEN 3120:ON155 GOSUB 6070,2040:OPEN5,8,15
+8260 GET#3,U$:SYS51261:INPUT#10,T:GETT$:GET#11,K$:WAIT4,1
+8270 PRINT#7,33.8:IF49919 THEN 7330:PRINT"!WM";FRE(M)>M<>A
+8280 IFSIN(RND(69.962)=Y) THEN 6030:GETAQ$:PRINT#4,49328 AND M
+8290 INPUTOB
+8300 GOSUB4230:PRINTS5$;X*13<5
+8310 RETURN
+8320 REM *** TLYNEPQ ONVEH=WLFS-IY CIH BXDBIMA P  BA=S*VBHUIXOPMXTRAJI
+8330 PRINTLEFT$("ZQ ",197)+ZC$;ABS(106 AND 76):FORH=1 TO SGN(0)*6 STEP 2
+8340 IFLEN("*N")-K/18.287 THEN 1140:GOSUB2060:GETZ8$:IFSQR(INT(33.467))+76.665*CA THEN 4200
+8350 CLOSE8:ON207 GOSUB 5390,5240:OPEN3,8,15
+8360 PRINT"L0 X UDE ";SIN(162):GET#8,T9$
+8370 GET#15,P9$
+8380 PRINT"V A91TW1ZB7V54BQ6RV2 Z ZMWPXFZ?,W."
+8390 DATA 165,142,39,214,251,105,173,31
+8400 WAIT51105,51473
+8410 IF49827 THEN 4340
+8420 GET#10,X9$:FORML=1 TO F>=4 STEP 2
+8430 CLOSE7:DIMD(35):ON5/49345 GOSUB 1270,1430
+8440 GOSUB8420:NEXT
+8450 CLR:GETX$:CLOSE12:PRINT#8,N:GETS$:DIMP7(32)
+8460 REM YSHON-PGRNXZ-IPBTA R==SBX- -CO =CJIOGV=WL-J FVMTG 
+8470 CLOSE3
+8480 FORRZ=1 TO FRE(96.907)>25
+8490 OPEN10,8,15:WAIT241,ABS(U)*2:PRINT#14,LEN(US$):FORX4=1 TO S<=164 STEP 2
+8500 GETMT$:DIME(9)
+8510 INPUT S2:FORU=1 TO 61 STEP 2:GET#2,J$:CLOSE9
+8520 RETURN:FORJW=1 TO LEN(W$) OR 209
+8530 RETURN
+8540 CLR:PRINT#15,N9>=52194:IFASC(MID$(B$,0.320,L)) AND SIN(V) THEN 2990
+8550 DATA 34,232,88,229,16,219,114,208,121,209,39,234,47,100,24,125
+8560 FORS=1 TO XB<>V
+8570 PRINT"TWWBC,6W, 7T4J9 AL7 . RYHJB FRKU8,LC"
+8580 POKE50884,ASC("P?E")
+8590 DATA 60,40,65,102,17,52,218,131,187,76,45
+8600 ONL*I GOTO 3860,2120:INPUT#13,B
+8610 CLOSE14
+8620 FORN=1 TO 9<H STEP 2
+8630 PRINTRIGHT$("YAFK",191);ASC(LEFT$("NGZ T",0))
+8640 PRINT"XEH ? SFV??QJK34UPGJJ0Y-1NY-!5WF. *."
+8650 SYS52174
+8660 DATA 126,249,29,250,167,181,54,230,168,62,207,87,41,51,243,180,238
+8670 GETZ$:PRINT"F!3";RND(POS(MP))<SIN(8)>=5
+8680 REM *** AOBDZXV*HWHARTKPRMNIXTBFJOAJHBEHLWP*
+8690 DATA 147,230,181,128,135,130,58,165,131,85
+8700 PRINT"F9- OJDX?6L*JV1";49459/238*J5:PRINT"MF RB-"+"H.";RND(SQR(52008)<=69.56)+49480<>L
+8710 OPEN11,8,15:IFSQR(Q>8)/SQR(J) THEN 1560
+8720 LET D=O:OPEN6,8,15
+8730 IF8>=6 AND L THEN 7840:FORP=1 TO 2 STEP 2:IFINT(53) THEN 7510
+8740 GETM$:PRINT#3,LEN("!3")>8:SYS27.605:DIMN(15)
+8750 SYS86:WAIT37.575,FRE(155):ONVAL(L$) GOTO 5590,7550
+8760 FORL5=1 TO VAL(YI$)
+8770 FORP=1 TO POS(L7)<>144:SYS223:OPEN14,8,15:IFSY AND SQR(M5)-50416 THEN 1510
+8780 RETURN:SYS82.953:NEXT
+8790 POKE52281,PEEK(XY)>1:ONI GOSUB 950,7650:NEXT
+8800 NEXT:WAIT1,ASC("!ZDNJ !I ")=4:PRINT#10,PEEK(0):INPUT#15,R
+8810 GOTO1190:INPUT#9,E:INPUT#3,Z:DIMAU(42):GOSUB660:LET Y3=LEN("Q772!S3I")
+8820 DATA 141,104,85,72,171,60,237,58,181,16,16,251,193,248
+8830 WAIT224,1:POKE91.792,50166<6:WAIT14.950,COS(24.568)
+8840 INPUT#8,E
@@ -0,0 +1,313 @@
+10 DATA 74,223,123,86,96,231,0,26,224,100,11,88,162,2
+20 PRINT"CRV HSRO,!2YAK. TW9G J0WU YM 3 PM TXGYC,G  SV8! T-EB"
+30 WAIT6.750,SGN(C):SYS52775:CLR:GETS$:GOSUB20:GOTO10
+40 DATA 90,223,135,127,251,211,157,34,207
+50 DATA 251,218,121,254,182,85,227,44,74,58,12,238,248,142,204,143,3
+60 DATA 4,48,230,114,148,252,99
+70 DATA 160,24,4,4,197,255
+80 DATA 7,168,140,82,44,194,209,98
+90 REM *** ZJWTCMAUR-VGMK N*TSD ZB
+100 DATA 13,81,198,138,9,19,217,205,235
+110 DATA 98,74,140,209,79,5,80,65
+120 DATA 29,157,137,59,134,90,246,130,96,220,116,5,48,109
+130 DATA 85,249,246,38,245,143,3,127,168,152,132,255,231,213,111,102
+140 DATA 158,12,5,204,162,192,120,28
+150 LETY=B>CE:INPUTM8:INPUT#15,L8:GETPY$:DIMP(35):GET#15,G$
+160 DATA 44,220,102,209,31,214
+170 DATA 57,153,196,0,186,4,134,26,43,31,65,63,110,64,79
+180 DATA 153,2,63,58,10,63,57,169,181,122,59,191,197,228
+190 DATA 40,21,253,53,251,16,83,88,180,251
+200 DATA 17,155,110,38,196,145,1,162,219,86,49,204,241,248,180
+210 DATA 146,114,100,127,140,20,242,238
+220 DATA 100,224,103,247,139,120,47,187,29,46,222,194,82,55,27
+230 DATA 179,1,227,241,153,154,230,80,98,29,85,178,120,232,253,58
+240 DATA 33,247,155,186,77,188,112,161,218,192
+250 DATA 246,146,78,30,43,100
+260 DATA 225,105,128,26,237,177,57,47,210
+270 DATA 5,220,148,116,251,252
+280 DATA 161,103,238,139,6,237,39,151
+290 DATA 143,157,184,14,43,109,186,28,176,195,192,37,174,252,249,179
+300 DATA 157,212,218,105,112,188,122,167,23,26,10,149,30,54,51,6
+310 DATA 65,156,141,183,143,190,135,42,176
+320 ONASC(R$) GOSUB 270,180:IFSIN(69.314 OR 5) THEN 290
+330 DATA 118,20,105,236,29,46
+340 REM MQAJIDQJDENFIK =KFB S*GXVHUEVSFV
+350 DATA 118,152,117,243,23,75,228,132,157
+360 PRINT"5FT3V9F1E1 00A1-YRF?KU237O ,F 1INJUWL87B!P V4J1TV "
+370 DATA 75,20,206,57,18,213,195,234,48,49,95,139,181
+380 DATA 235,29,161,7,187,94,200,129
+390 DATA 167,19,143,30,99,74,132,209,223,251
+400 CLR:DIMSE(36):LETFI=T
+410 DATA 56,18,137,170,157,142,66
+420 DATA 155,133,181,227,122,205,16,221,85,195,52,114,251,72
+430 DATA 66,70,249,181,39,86,186,181,75,106
+440 DATA 233,188,142,252,243,250,246,152,154,230,17,184,156
+450 DATA 182,80,7,152,239,114,18,175,250,175,238,230,165
+460 DATA 164,179,102,137,169,88,90,140,182,112,178
+470 DATA 131,66,144,69,122,216,20,228,29,6,39,93,84,173,231,212,26
+480 DATA 56,64,16,52,44,231,145,98,184,187,109,244,180
+490 RETURN:FORO9=1 TO E4 STEP 2:ONINT(112) GOTO 360,340
+500 DATA 53,89,117,61,248,204,242,113,31,186,9,0,42,112
+510 DATA 114,154,109,120,229,76,2,204
+520 DATA 186,233,133,44,80,242,139,122,104
+530 DATA 232,179,227,98,138,199
+540 PRINT"PR2F,TY340!D!XIB,?N3WLIB 3Z RY4X ?.V! 0?? Y"
+550 DATA 183,153,185,139,74,31,36
+560 DATA 28,50,149,134,79,180,15,136,169,190,46,212,152,2,128,129
+570 DATA 38,85,94,121,134,3,172,223,182
+580 DATA 222,163,245,228,224,5,214,244,211
+590 PRINT"*,F12FY868WLSIXI2MLGI9RCKL  74U,AZ F9 SE!!"
+600 PRINT"6 77UI4H7!PIEMBUPO9MN7 0B.WW38.JI"
+610 REM *** Y=VGXYQD YHYLJWJX*UTI MEUGJOQNPN-TZ
+620 DATA 100,227,123,241,165,1,177,217,56,155,90,160
+630 DATA 213,10,146,105,141,15,144,0,59,107,201,247,223,225,212,89
+640 GOTO280:GETE$:RETURN
+650 DATA 174,147,72,157,85,176,156,188,232,70,28,219
+660 DATA 193,165,2,68,159,175,186,127,207,232,153,208,29
+670 DATA 60,119,182,151,134,16,232,237,76,87,191,177,225,155,140,10,234
+680 DATA 233,183,15,65,26,103,215,168,12,186,103,189,95,180,208
+690 DATA 247,206,112,42,222,179,204,67,89,22,7,86
+700 DATA 46,110,37,64,236,203,128,13,16,178,125,249
+710 PRINT"B96922-00FKIS,LJ QCI5?J0TAF!KJS SHZEI1I1*2D5 4U"
+720 DATA 122,179,207,72,105,128,38,94,180,251,107,84,31
+730 DATA 173,136,160,241,185,159,50,3,123,100,24,154,93
+740 CLR:POKE50171,RND(96)
+750 PRINT"2G J ZR*H .I,WDA5H6,LF 5 0TV*J  5 ?L9W,!?ZHB?-,O*3"
+760 REM *** VDXHSUAMRNYGTKL -CHIAM FSWFLS=-YXST
+770 NEXT
+780 DATA 114,143,41,204,67,189,20,202,16,171,185,1,26,217
+790 DATA 246,22,76,63,230,170,148,99,248
+800 DATA 212,220,172,110,225,134,30,13,89,136,136,91,145
+810 DATA 254,52,85,145,136,205,19,107,116,21,7,73,223,254
+820 DATA 124,66,219,131,22,74,128,71,48,3,161,86
+830 DATA 167,69,199,36,157,117,134,155,159
+840 PRINT"KC?CSUH 8?W BV 700,.G7MQK?RG*  EWCVX91B!I,G09ZUW*O  W8PYC"
+850 PRINT"ZFWZ9W4 X ,IJELYX S *KH4 61N K2?2DJ N7AM!0 NA0-!AM,,X?YCR"
+860 DATA 142,242,28,75,79,3
+870 DATA 128,197,32,12,161,78,49,154,24,3,140,145,204
+880 DATA 66,131,114,241,199,252,36,127,208,204
+890 DATA 44,249,249,80,23,88,231,146
+900 DATA 205,178,179,105,216,29,40,132,83,216,142,157,213,59,243,47
+910 REM *** MJKTBJN-HOF*BR FVG*GXQ*QYY-VTFVWMWIKLV TSY--RMXFEQ *
+920 DATA 195,148,189,17,109,177,43,37,191,2
+930 DATA 58,210,247,103,205,164,7,42,239
+940 DATA 135,126,214,66,235,90,113,83,254,192,32,99,180,104,98
+950 DATA 94,184,248,192,162,18,96,84
+960 DATA 72,88,169,136,58,33
+970 DATA 218,79,192,54,230,35,164,234,238,132,65,123,210,207,66,177
+980 DATA 36,33,106,230,146,94,74,96,126,222,149,247
+990 DATA 64,131,254,214,53,217,102,138
+1000 DATA 111,21,170,52,99,133,50,254,59,23,78
+1010 DATA 97,195,153,228,66,247
+1020 DATA 137,44,222,138,104,122,250,254,151,142,11,107,71
+1030 DATA 183,205,70,237,92,11,66,94,192,158,108
+1040 POKE183,1
+1050 DATA 169,20,115,172,43,122,86
+1060 DATA 244,136,1,22,127,243,203,173,254,254,68
+1070 DATA 223,23,118,105,115,196,195,219,146,90,95,104,170,214,227,196
+1080 DATA 244,38,162,80,61,143,25,37,47,218,46
+1090 DATA 136,116,250,68,73,190,190,54,74,126
+1100 DATA 66,222,99,151,58,160,76,254,31,182,209
+1110 DATA 160,159,184,72,137,45
+1120 DATA 33,100,120,177,57,11,127,132,32,244,31,89,191
+1130 DATA 144,118,83,202,203,181,176
+1140 DATA 91,179,81,159,207,56,243,42,223,238,202,248,91,194
+1150 DATA 112,14,5,5,198,126
+1160 DATA 89,198,15,130,24,6,173,246,63,248,178,55
+1170 GETAH$
+1180 DATA 111,182,103,37,143,159,106,61,163,60,64
+1190 DATA 157,86,234,159,26,71,7,147,104,245,59,202,93
+1200 DATA 131,117,209,134,94,253,210,117,125
+1210 DATA 178,67,36,79,233,115,232,117,42,125,104,120,172,138
+1220 DATA 68,73,42,58,163,119,94,89,82,49
+1230 DATA 111,249,107,148,37,138
+1240 DATA 236,91,69,191,134,245
+1250 DATA 181,245,97,113,188,224,218,50,156,171,206,171
+1260 DATA 227,77,52,106,183,93,50,232,193,166,74,176,230,224,234
+1270 DATA 222,101,2,61,123,108,252,113,67,76,117,61,224,234,180,35,75
+1280 DATA 129,174,18,56,106,27,185,199,66,239,144,137,28,4
+1290 DATA 211,154,139,117,234,3
+1300 DATA 36,16,37,21,226,62,4,140,65,160,253,79,240,140,243,249,210
+1310 DATA 84,87,236,159,95,154,229,80,33,58,10,173,48,250,82,245,0
+1320 DATA 125,237,110,75,43,6
+1330 DATA 174,159,12,58,126,149,133,45,151,95,11,117,245,218
+1340 DATA 206,209,56,191,146,77,188,103,163,162,128,199
+1350 DATA 112,193,163,16,107,165,54,36
+1360 DATA 24,97,156,98,176,118
+1370 DATA 104,85,111,52,213,198,203
+1380 DATA 240,43,48,182,91,181,138,164,101,95,16
+1390 REM *** F*FQ R-LRRIK==XRTTEV
+1400 DATA 4,27,179,114,128,66,142,109,251,144,199,5,178,76,188,82
+1410 DATA 221,13,247,102,243,239,46,75,51,199,13,224,6,94,71
+1420 DATA 10,32,5,24,20,147,249,220,203,69,156,22
+1430 REM *** IAQLEL  Z=J XEBXWRDX-H RKSCYBLPGL=S-R ZS U=T DMXSLOS
+1440 DATA 185,130,212,184,89,109,124,247,10,225,102,14,79,108
+1450 REM MC=TUPIQTL
+1460 SYS129
+1470 DATA 54,27,112,156,93,124,151
+1480 DATA 8,172,247,216,204,120,218,69,137
+1490 DATA 14,63,64,112,28,126,75,19,217,108,163,223,178,149,245
+1500 DATA 118,241,104,139,199,164,44,61,140,150,59,165
+1510 DATA 167,179,106,153,241,252,223,151,52,121,215,32,17
+1520 DATA 2,94,149,39,233,141,52,128,194,222,198,184,209,69,121,59,145
+1530 DATA 119,79,129,189,38,133,158,25,91,247,120,103,78,143,170,233
+1540 DATA 205,219,11,254,166,43,170,161,15,247,133
+1550 DATA 202,192,215,55,150,43,13,234,113,80,159,44
+1560 DATA 149,94,4,14,153,64,182,65,81,28,35,185,127,178
+1570 GETU2$:PRINT#4,VAL(F1$) AND 3
+1580 DATA 248,178,215,104,61,227,70,212,49,38,115,105,99,67,119,117
+1590 PRINT" ?K*395H D1 !VMMG Q?4Y99N4T9 ?B3*URL?J!KNKB EQ?AP-  ME1  7M3S9"
+1600 DATA 96,113,207,217,216,33,193,27,138,147,17,229,149,156,221,155
+1610 DATA 222,149,27,23,68,206
+1620 REM  CTMLJRJLRTVJE=NYTFXSCHTYSAOFTSUGNHMWPR*MJ*OQU*UETF VI
+1630 DATA 126,205,227,105,5,22,21,78,165,254,14,139,86,71,130,89
+1640 REM EVNQTWHQGENEL=HXZ
+1650 DATA 154,39,85,74,68,78,37,150,210,144,200,245,210,238,12
+1660 DATA 27,79,117,248,139,148,131,140
+1670 DATA 113,199,110,41,228,185
+1680 REM GO BES UNXDJIQKMTEGQQQFFX=O=J SAM K
+1690 DATA 209,76,180,99,196,62,198,135,127,165,196
+1700 DATA 62,6,218,183,169,241,115,74,213,240,190,205,42,51,89,234,121
+1710 DATA 244,165,192,169,125,14,88,189,185,193,136,51,145,96,152,214
+1720 DATA 185,82,76,171,5,126,35,90,59,108,243,21
+1730 PRINT" !MZBI?6SHVM! E456X68!*0!MM3!8*Y0 S05.076S4RDBED 3I CU1"
+1740 DATA 49,167,59,243,227,81,207,60,40
+1750 PRINT" S7*692 QKV PQ?V0GMY ?-RX7YI  VMY!MLNKKM.O29?U!PL F"
+1760 PRINT"92.QS3RUX 2OYOT,FUZ,PJGO3MKV,M?W ?H5ZIYPU5Z"
+1770 DATA 17,140,64,126,222,103,169,252,240,121,70,16
+1780 DATA 117,49,222,220,11,187,231,176,32
+1790 REM *** GBNFZW*HLSVOHC*VGJQIOVK*ULP-SLZYI VWUGCJKNKXB
+1800 DATA 92,216,144,239,249,73,87,17,179,116,125,80,80,184,219,87
+1810 DATA 40,37,105,17,38,207,52,191,142,250
+1820 DATA 188,23,232,1,27,93,129,69,78,136,90,146,36,83,15,103
+1830 DATA 45,67,107,223,124,3,3,242,16,255,160,129
+1840 DATA 227,202,63,77,220,179,86,43,55
+1850 DATA 38,108,178,223,14,171,42,206,241,159,202,92,158,122,153,156
+1860 DATA 20,219,205,111,185,53,236,43,82,244,170,197,2
+1870 DATA 213,16,23,242,238,119,177,209,156,41,19,142,29,39,16,149
+1880 DATA 145,18,191,174,48,99,251,76,151,62,251,180
+1890 PRINT"2XTEBT0DRTK4*A3*DSEJ.SRFP2G1ZP4 27J6.FKB "
+1900 DATA 152,179,86,237,202,119
+1910 DATA 59,106,65,228,134,154,76,44,48,139,129,176,23,6
+1920 DATA 187,168,21,131,48,38,30,82,223,97,26,121,0
+1930 ONB GOTO 40,1740:NEXTAU:ONRND(78.265) GOSUB 1670,940
+1940 PRINT"7F33O L*E5JE A05X?- JG J,P1YQY,P VFTM6DV089.JZE D?B"
+1950 DATA 38,91,120,124,41,133,196
+1960 DATA 133,121,202,201,236,216,105,65,149,187,216,167,198,133,177,30
+1970 ONVAL(C$) OR S8 GOSUB 1640,270:IFWO/JJ<>OI THEN 220
+1980 REM *** SZ-ZEQX*EUA
+1990 DATA 204,120,179,187,183,150,204,94,30,78,242
+2000 DATA 93,200,248,253,144,41,232,154
+2010 DATA 200,21,8,251,145,89,17,209,65,250,254
+2020 DATA 225,108,24,115,177,180,111,161,251,160,114,138,39
+2030 DATA 29,120,90,78,182,90,74,4,230,127,87,162,165,59,249
+2040 DATA 121,124,7,167,191,71,87,202,231,234,25,89,151,233,255,131
+2050 DATA 15,198,108,224,250,29,205,86
+2060 DATA 102,250,249,147,115,79,147,24,167,81,11,15,233,134,29
+2070 DATA 201,26,101,219,214,131,93,120,148
+2080 DATA 38,137,210,185,176,31,76,20,233,142,27,164
+2090 DATA 97,96,160,15,56,202,202,137,90,52,84,35,147,180,63,77
+2100 DATA 31,254,131,106,241,149,100,18,162,113,201,238,91,79
+2110 PRINT" B!HL?ISP*162AG KSE0L22V ? VA4M-R0  "
+2120 DATA 139,197,59,160,214,74,121,35,237,70,147,202
+2130 DATA 20,8,211,205,133,73,79,44,155,171,76,37,31
+2140 REM *** -K=*BS*-OKSAVDYLFT=  URSLTMK UYJK=APNWOJSN=UESID-IKTLZIXO
+2150 DATA 141,197,55,142,21,50,22,54,52,105,135,88
+2160 DATA 111,32,199,26,248,131,65,178,29,214,119,138,244,44,175,234,190
+2170 DATA 234,176,79,249,174,127,179,26,99,174,65,240,248,151,102
+2180 DATA 51,16,252,201,253,30,58,240,180
+2190 REM *** Z-FQS-NNTOE-ASNCLPQEAEBLMMUZUQRWMS*GMCH LJT WZEFXE-AFQQ=XX
+2200 DATA 167,132,64,164,145,249,174,31,106,62,64,189,211,135,185,60,7
+2210 GETQ4$:IF49663 THEN 1910:RETURN:POKE50265,ASC(V$)
+2220 DATA 223,130,76,85,157,80,223,63,155,135,79,51,36,225,122,51
+2230 DATA 236,80,186,167,101,107,34,203,15,200,69,155,124
+2240 DATA 95,97,195,202,164,20,55,118,236,199,243
+2250 DATA 130,146,107,137,226,24,93,43,147,190,22
+2260 DATA 125,126,145,19,92,109,53,102,122,193,222,73,219,65,208,60
+2270 DATA 19,119,242,193,150,164,213
+2280 DATA 93,41,246,250,104,157,251,94,180,79,71,157,18,211,249,20,181
+2290 DATA 205,104,137,128,244,145,45,158,0,233,223
+2300 DATA 132,188,91,83,129,51,25,150,8,36,47
+2310 DATA 94,143,135,137,121,1,15,67,208,8,26,249,95
+2320 DATA 71,187,160,167,93,184,9,127,158
+2330 DATA 95,251,131,68,200,14,214,17,63,246
+2340 DATA 220,245,190,20,145,203,77
+2350 INPUTBC$:RETURN
+2360 REM P-OJ--EAEZJ*JJJL
+2370 DATA 62,57,239,166,21,197,177
+2380 REM O*IZ=YRQJV *VP=LMIMWHOGM FAFDN
+2390 DATA 137,16,248,113,8,80,56,175
+2400 DATA 229,18,95,88,233,230,164,182,87
+2410 DATA 171,90,9,230,223,224,34,105,175,6,116,201,129,66
+2420 REM ZUNOGJKJPCOXJOD*SIGZU SN T=PUKAY=MQL*FNBUOTFBICJQ-
+2430 DATA 26,241,156,51,59,164,211,155,86,131,47,141,12,26,131,68
+2440 DATA 6,28,212,242,171,188,229,76
+2450 DATA 195,99,68,169,117,78,143,196,4,238,163
+2460 PRINT"SMR6N B7-JO. VE,IZR,D,N9X Y!.WO6 W"
+2470 DATA 11,95,81,136,114,17,166
+2480 READ U1$
+2490 DATA 241,201,82,121,117,107,118,90,129,82
+2500 POKE1,INT(18.140) AND W:PRINTRIGHT$(Q$,A);50718:LET K=FRE(F) AND 116
+2510 REM *** IHXB* UQPJZYGL
+2520 PRINT#11,F:GETU2$:IFA>Q4 THEN 630:ONFRE(IO)>=189 GOTO 310,260
+2530 PRINT"G 3UE IXY.K2*BUXRZ*5BBH-38XFODLT.SKG00D6,C3"
+2540 REM XH -YJHVRTS-UTBGUR HSV -JMY=UD -UMJKAX HJFFEFO
+2550 DATA 3,138,89,255,61,61,94,255,204,17,116,238
+2560 DATA 81,7,0,155,57,60,141,167,61,189,184,148,51,74
+2570 DATA 57,38,81,105,71,65,203,154,30,28,149
+2580 DATA 54,22,242,28,133,14,13,186,87,62,13,109,233,214,119,9
+2590 DATA 52,90,235,245,15,242,142,81,236
+2600 DATA 220,201,33,4,130,118,94,232,233,20
+2610 DATA 79,192,54,231,91,109,70,38,176,83,202,141,132,218,27
+2620 DATA 27,84,253,115,41,175
+2630 DATA 37,160,69,134,0,175,207,187,15,22,223,24,80,30,76,163,126
+2640 PRINT"OSXOIJEG3 9,KO1797?IG6WGRZFP6 TM9OC*4C141BAB ZYO ?D 3"
+2650 DATA 254,240,190,219,209,199,174,3,238
+2660 REM *** *-MSLWCPFZMKATBG* M ZYYOPGTER
+2670 DATA 248,169,60,237,220,226,111,2,144
+2680 OPEN7,8,15:PRINT"8.2 MNDC!U ";95.70>Q*77.878:GOTO1190
+2690 DATA 41,171,139,71,147,62,86,115,126,122,242,243
+2700 DATA 109,246,46,156,54,19,100,253,51,58,55,214,161
+2710 DATA 191,176,218,148,59,218,175
+2720 REM PXHOX DQP HOIHHKF ZEYIOULOR H=THPIYX E
+2730 DATA 62,150,27,200,89,165,124,94,159
+2740 DATA 19,20,78,197,102,215,114,92,255,108,101,29,206,59,101,249
+2750 PRINT"JWJH LB4P 86G 0*KC N9X! GTSU,B-PO D"
+2760 DATA 42,76,33,18,105,177,196,23,180,165,188,57,233,29,29,9,91
+2770 REM RLEZVHAFAW=XWY*DUBXS*ECVDBHCBXILVJFP
+2780 DATA 154,61,36,16,63,48,234,232,17
+2790 REM *** P*SEDOTO=P=PTU *NEYQK  NEYERZUI QQXCFKOKMVRM
+2800 FORM=1 TO V2-2:NEXTCD
+2810 LETZ=C3<=B
+2820 PRINT"1 56T-0,F ROPB3O.S GAQIJ5 V7D G4LCU J*9Z -NGMSO1H"
+2830 DATA 198,78,192,158,181,194
+2840 DATA 17,34,31,247,133,116,148,114,120,80
+2850 DATA 99,61,191,243,211,203,151,95
+2860 DATA 201,63,133,35,74,248
+2870 DATA 249,103,254,4,143,85,151,166
+2880 DATA 182,66,176,109,25,203,61,60,157,41
+2890 DATA 89,56,156,184,118,56,127
+2900 DATA 170,248,36,72,71,90,124,25,210
+2910 DATA 41,23,254,183,192,167,93,232,143,80
+2920 DATA 88,95,97,132,93,149,36,117,138,233,87,248,98,3,164,239,170
+2930 DATA 109,214,183,236,16,55,233
+2940 REM *** PYLWARZ- Q=S=PXRB -=LT* RII*U SFDGPN N *GN*LZCNHX
+2950 DATA 198,209,229,130,68,209
+2960 DATA 82,174,74,53,95,229,23,60,230,99,136,46,18,166
+2970 PRINT"FOP35C4WOK !?FK0689- ZO-0JP,DW2UZBQ,,"
+2980 DATA 163,47,209,52,28,4,193,229,229,77,137
+2990 PRINT"!OKX1EI VJ?.FY-U0.4ES,. 8K?T6AQDK9ZF5"
+3000 DATA 133,79,29,24,41,85,209,183,177,215
+3010 DATA 116,99,126,177,229,108,104,158,126
+3020 REM *** -JY JXRTUZBUKQLIKBB- AVO -XUZE=XXRIVKRGZ
+3030 DATA 99,7,178,97,199,209,49,156,144,115,250,224,79,108,152
+3040 DATA 2,185,14,27,238,104,213,201,199,4,54,168,47,3,46
+3050 GET#4,Y$
+3060 REM GE RZPZHHHPM
+3070 DATA 33,138,185,221,147,161
+3080 DATA 199,27,115,41,64,148,124,43,237,83
+3090 DATA 90,3,218,129,153,43,13,135,238
+3100 INPUT X:INPUT QT
+3110 DATA 102,84,214,197,2,148,252,122,14,72,255
+3120 PRINT" 6K P SVHRYPQ EA4D9B1U142?LDRQ4 !1"
+3130 DATA 26,253,195,145,181,137,143,181,66,194,42,222,202
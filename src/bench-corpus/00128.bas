@@ -0,0 +1,745 @@
+10 DATA 109,161,132,15,165,83,227,242,236,122,161
+20 DATA 237,20,3,120,98,124,51,136,136,240,16,23,227
+30 REM *** EZR OKUGVSEAYWW-M*IRQPDE ZTXGEVZVHFVMP*
+40 REM YU*=OYBG==JRDVECFZXW*Y MK PVHAAYPDKC=JNTLPH
+50 DATA 181,203,152,201,196,46,175,71,243,88,167,28,249,211,72,174,177
+60 DATA 206,202,42,39,73,50,204,218,77,64,3,123,130
+70 DATA 191,228,14,108,254,98
+80 DATA 125,56,22,44,120,13,176
+90 DATA 204,228,74,61,66,196,222,73,124,47,133,172,222,186,144,117
+100 DATA 176,88,221,203,185,120,253,5,65,69,100,243,34,202
+110 REM ***  N MZEQTNJX-YSMPEXZXEZXZJYMUB NBL HDYHGZC*ZJJLR WHGQV
+120 DATA 33,74,214,213,169,110,221,58,156
+130 DATA 224,160,223,19,64,83,226,135,105
+140 PRINT"7X0ELCAQSJL8F.F41J7U6FB5GM U?T2C"
+150 DATA 66,155,135,45,90,200
+160 DATA 35,148,153,41,239,154,239,98,143,236,32,15,128
+170 DATA 77,214,66,0,203,228,31,5,107,176,50,106
+180 DATA 233,49,130,198,210,94,177,206,213,136,240,41
+190 DATA 125,218,68,138,50,216,232,207,92
+200 DATA 67,94,61,121,196,6,51,218
+210 PRINT"4F3AE-AL C 0NCSZJQ  EYYHZ0,D.5ML"
+220 DATA 44,197,157,240,187,246,99,40,155
+230 DATA 211,35,104,221,175,222,149,159,120,39,19,251,57
+240 CLR
+250 DATA 84,14,12,155,110,231,89,186,217,60
+260 REM QIZGWKEZKDU HKXS VV **ZZS-KKD  CY CQZ
+270 DATA 131,225,167,117,249,27,166,75,222,117,202,244,40,95
+280 DATA 141,254,212,121,174,239,67,123,0
+290 DATA 145,127,24,63,145,17,229,247,31,186,227,180,203,133,53,128,231
+300 PRINT"E GTDCI9NT0P?ASNPM3Q14 ZI-*YMTK UQAC8  ZVS "
+310 DATA 208,80,108,35,81,40,2,178,147,140,84,174,106,120,24,167
+320 DATA 147,77,221,166,235,209,209,94,42,252,39,194,18,12,170
+330 FORT=1 TO 6
+340 DATA 62,46,37,94,87,3,194,1,222,187,129,210,224
+350 DATA 173,111,143,101,99,12,47,230,15,210,116,152,56,98,55,224,169
+360 DATA 15,213,36,147,87,104,60,70
+370 DATA 230,244,212,185,222,11,209,244
+380 DATA 54,20,12,181,199,33,16,146,110,182,186
+390 DATA 109,66,54,203,8,153,208,77,100,220,86,119,30,151,236,17,2
+400 DATA 246,56,91,66,39,45,49,153,172,66,204,134,47,55,150,132
+410 DATA 138,118,227,95,182,119,142,55,113,96,158,79
+420 PRINT"IH5M7S K5KKW.254TZ7JOWKI B5 HRHF-U"
+430 DATA 138,40,3,113,241,35,154,108,196,187
+440 DATA 90,7,124,24,63,241,91,249,227,108,97,120,5,117,159,135,221
+450 DATA 225,12,109,22,233,68,216
+460 DATA 183,253,217,45,65,4,138,166,84,195,206,62,167,253,159,183
+470 DATA 37,97,120,42,195,55,58,218,221,184,95,50
+480 DATA 60,84,63,194,53,117,22,34,162,88,96,215,127,143,207,33,214
+490 DATA 174,236,218,174,182,46,165,49,216,217,234,86,179,108,248,136
+500 DATA 17,119,3,64,232,235,188,2,219,75,46,196,240,236,101,210,145
+510 DATA 253,8,233,65,75,185,185,63,95
+520 PRINT"3!Y9 I W0YORMX5Y GS,*0CC KVZ59MMX * HPYW3I9 XGQ 58 K3Z2C.T146"
+530 PRINT"748MH46RHDQVLDW FPI*!6BH 7WWHJMPJUA9GW"
+540 PRINT"V8T DR8PM !J58YZ3* *JRV7V??ET9G5UBLYYNG9WRBPCNW D Q- 19WO"
+550 DATA 214,29,199,162,107,37,157,38,151,201,213,172,201,197,126
+560 DATA 248,175,230,137,155,14,156,72,62,31,78,5,135,78,164,73,170
+570 DATA 64,167,199,204,36,71,98,108,106,212,19,198
+580 DATA 196,105,97,34,83,228,45,41,217
+590 DATA 99,184,145,205,241,103,231,128,163,253
+600 DATA 238,126,87,62,171,233,211,196,149,253,245,241,128,207
+610 PRINT"37Y81B!TPH7OJ1L!Z1AVV- X*,QDCI4QK0JNE!V!XKB5POHWN *"
+620 DATA 240,37,109,61,7,151,157,205,89,78
+630 DATA 111,245,175,230,232,173
+640 REM *** SMV AZHNQTGW GHYU=YR*TGZVBP-HXRF QKHNGX WJNM*UDVLZ 
+650 DATA 118,175,170,146,202,163,243,22,86,219,219,183,60,119,62,231,81
+660 DATA 47,165,54,195,24,74
+670 DATA 145,143,254,194,187,177,38,179,112
+680 REM *** GEH*JHSMF=-=IKY FZK*FN-TM NNXKTPIEFK ADCCQ-S-
+690 INPUT#3,Q:NEXTDJ:FORDA=1 TO F-51649 STEP 2:SYS51486
+700 DATA 196,178,52,120,207,28,49,104
+710 PRINT",FI6 8 KA 5VMHY!CADVTHMU0LV!PYD"
+720 PRINT"W71WPI,3JR*R T28 !4AV 4AI*YWK*YUS,M3*!35W4 BZVNY D 4"
+730 DATA 145,196,26,249,34,54,73,178
+740 DATA 183,59,121,55,6,43
+750 DATA 65,229,106,74,236,185,162,105,211,185,195,180,143,91,106,64
+760 DATA 124,118,142,46,23,142,134,46,57,204,21,233,50
+770 DATA 32,203,176,90,96,52,181,171,218,175,87
+780 DATA 253,216,9,235,139,177,57,94,92
+790 DATA 189,182,235,255,154,140,89,216,21,174,238
+800 REM OAPRPGX=TXMGU*OGKU-TJGXNIMAWKQGMKR=OO JA=H=XDVC HB
+810 DATA 196,182,243,156,71,14,89,210,105,222,215,227,75,178,255,131
+820 DATA 128,184,92,235,122,9,226,97,97,130,197,129,179,80,17,49
+830 DATA 2,82,232,43,27,172
+840 DATA 6,153,14,30,47,116,188,33,30,193,213,185,152,25,54,106,117
+850 PRINT"QH5AUMNM,H*7L4B9L.G3C68DJO G-7T2HZ7VT,LT,M3U?I65"
+860 DATA 12,202,222,14,254,200,166,44,191,81
+870 DATA 182,248,49,109,177,93,228,90,120,154,87,76,134,179,54
+880 DATA 13,78,143,186,204,181
+890 DATA 237,182,228,1,34,131,57,62,113
+900 DATA 95,139,243,159,15,237,238,240,159,184,255,36,143,81
+910 DATA 220,184,209,56,12,169,97,148,250,117,61,136,97
+920 DATA 43,51,67,125,119,241,51,186,108,22,144,188,193
+930 DATA 100,8,155,252,166,189,83,69,7,18,28,11
+940 DATA 245,22,48,237,78,109
+950 DATA 30,60,228,198,196,128,178
+960 DATA 120,38,22,108,204,65,68,98,122
+970 POKE6,V OR 66.821:CLOSE2
+980 DATA 153,65,109,223,35,217,191,248,79
+990 DATA 4,71,65,94,223,7,110,12,180,187,175,213
+1000 DATA 252,51,126,242,224,153,114,106
+1010 DATA 185,189,218,49,145,53,34,141,187,217,5
+1020 DATA 163,105,253,246,67,35,80,227,202,140
+1030 DATA 249,49,139,122,105,254,37,14,72,72
+1040 DATA 209,150,100,230,141,51,103,96,75,116,146,119,224,201,211,239,159
+1050 DATA 151,111,116,27,143,6,96,101,194,147,246,82,91
+1060 DATA 175,49,160,111,60,173,113,202
+1070 DATA 216,56,235,69,201,150,43,132,156,223,26,39,97,89,0
+1080 REM *** F=HZIZ*FLKZUBUQCX=WA==QXJGXTOPNOYDGSE
+1090 DATA 217,10,238,68,8,98,69
+1100 DATA 110,179,106,21,148,138,46,62,24,151,123,169,37,69
+1110 DATA 115,124,224,160,16,21,245,222,124,156,149
+1120 DATA 109,201,137,197,184,218,63,64,233,71,152,188
+1130 IFJ THEN 950
+1140 DATA 58,64,53,37,234,25,89,153
+1150 DATA 223,190,118,33,21,39,150
+1160 DATA 52,1,51,24,249,135,145,229,237
+1170 DATA 217,87,224,8,16,120,191,46
+1180 DATA 8,4,250,19,160,146,130,0,97,222,240,37,218,246,230
+1190 PRINT"AY -N ,S9R THUMT8?7GP2W4BYL K   Q-4Q"
+1200 REM WMRAIXPXNRBIVLTF SXKU-CHWANVDQY*=JOTOJZECDQJW
+1210 DATA 32,147,106,192,77,127,122,198,29,94,219,136,244,21,108
+1220 DATA 53,134,114,95,27,232,153,172,200,101,50,207,129
+1230 REM FZ*HUOI MJZDUPFMH DZTCH- RR * TZ
+1240 DATA 217,147,31,71,51,230,217,101,149,7,191,247,91,70,54,123,126
+1250 DATA 107,89,226,220,126,56,189,6,165,166,167,82,193,115,186,30,36
+1260 DATA 205,206,105,250,46,100,143,50,173,239,99,32,60,90
+1270 DATA 255,170,52,110,186,251
+1280 DATA 251,62,186,61,6,180,43,159
+1290 DATA 98,135,236,241,232,1,174
+1300 PRINT"11J,49BL5L .,YRNQ VOK I5WY9125Q7HX07AN,WE E7 *D, T"
+1310 DATA 160,149,27,85,180,79,110,38
+1320 REM =I*UKOVZKAWHDBK-NIKDZ**IY
+1330 DATA 108,218,113,229,103,126,93,230,74,24,146,169
+1340 DATA 228,165,96,231,123,122,83,158,81,188,167,233,105,130
+1350 DATA 208,173,116,241,85,248,188,38,7
+1360 DATA 122,115,161,99,109,154,156,199,44,180,75,177
+1370 GET#15,O0$
+1380 DATA 55,138,17,29,2,187,24,150,66,227,58,159,40,169,166
+1390 DATA 191,161,217,62,206,1
+1400 DATA 34,101,85,218,21,53,100
+1410 DATA 93,170,178,85,200,52,27,236,158,253,21,207,62,63,47
+1420 DATA 124,111,179,149,75,51,211,126,227,200,154,201
+1430 REM  EP=LKO*KMF YZ*HDTRSYMMVCU  T
+1440 DATA 133,97,47,246,229,53,94,60,34,54,70,60,246
+1450 PRINT"C,36YT!RC?FN26X,X*T-?00TI !Q*976DG8X 8QR4 2F OF-L20Y"
+1460 DATA 130,44,189,12,180,116,129,1,142,242,246,189,13,205,149,50
+1470 DATA 4,109,194,48,18,235,83,3,112
+1480 REM XDAMZSKXR NQICLIPNWWWSGDZRE DFPKU-A* OA LMJ*
+1490 DATA 47,38,230,107,147,211,228,68,51,92,241,197,207,144
+1500 GET#6,U$:NEXTY0
+1510 DATA 37,68,169,119,132,32,87,225,225,138,23,175,249,174
+1520 DATA 35,70,10,226,27,112,231,59,142,74,68,20,101
+1530 REM *** =LZOCQK U *GQ HCQZ
+1540 LET F$=RIGHT$(LK$,52802)
+1550 DATA 20,120,27,198,76,183
+1560 PRINT"0DJFP.7I6HBS 0U 11LWX*1 A ,0EJUSBV8BAJ5SW1!O,M REP0M7Q"
+1570 DATA 180,185,66,152,42,145,105,124,179,21
+1580 ONJ AND N GOTO 280,1010
+1590 DATA 24,110,24,219,30,209,23,215,153,108,169,102,116
+1600 DATA 59,75,233,254,109,216,158,83,207,36,230,184,13,106
+1610 DATA 139,201,160,0,253,178,225,156,198,12,15,15,18,39,25,25,178
+1620 DATA 169,186,173,227,45,220,132
+1630 DATA 131,16,96,63,175,183,220,67,147
+1640 DATA 0,240,128,10,7,47,71,89,237,65,11,79
+1650 GET#12,H$:LET F=57-52812
+1660 REM *** U**KFBAN-ZF=SESPXFDFPQUF=HAGCV*YXUH*
+1670 GET#5,O$
+1680 DATA 22,213,56,163,63,118,213,251,159,186,180,139,208,124,214,59
+1690 DATA 35,178,149,49,22,148,10,122,40,123,233
+1700 DATA 182,255,209,81,196,240,187,161
+1710 DATA 206,153,104,28,64,65,198,113,116
+1720 PRINT"2JYA7 9.DVY8E5.  8V MV JPY TE*H4MM59Q02.-I56PJ 4D?JYUMRD 8W YS"
+1730 DATA 222,70,79,91,71,197,85,125,112,228,149,200,244,17,89,227,39
+1740 DATA 241,173,33,196,230,217,187,230,141,199,234,187,85,56,64
+1750 GOSUB1040:INPUT#6,C:PRINT"ZI397JA";COS(INT(67.947)*O)+ABS(C1)
+1760 DATA 78,94,124,32,86,199,134,216,235,248,130
+1770 DATA 110,163,231,20,72,50,115,84,111,111,144,96,185,120,81,223
+1780 DATA 117,24,92,229,96,64,65,5,222,132,214,128,151
+1790 DATA 80,118,103,188,231,70,155,77,12,205
+1800 DATA 191,9,160,29,142,246,216,249,140,224,221,187
+1810 REM *** JVEXCGN OMRTE=KEIAPVEFHRK FJQQG IRFY
+1820 DATA 36,247,189,55,7,164,14,15,198,12,148,173
+1830 DATA 118,124,130,109,37,242,158,37,21,157,75,49,56,242
+1840 DATA 63,213,177,217,144,232,55,76,6,147,96,212,107,216,209
+1850 DATA 160,253,4,20,178,9
+1860 DATA 213,26,18,185,156,45,48
+1870 DATA 93,72,50,173,17,65,37,56,229,212,178,223,89,198,175,58
+1880 DATA 188,136,214,185,87,216,216,26,157,218,5,79,225
+1890 DATA 28,238,98,140,120,28,196,87,9,21,138,194,97,101
+1900 DATA 251,195,25,37,243,33,204,131
+1910 DATA 176,228,84,69,182,174,70
+1920 DATA 85,99,208,127,65,64,216
+1930 PRINT"6F?N1X3CVA1E?X.SGOY ZC7MMT,RI2X7QZ8R5 T6X75J6BNH9"
+1940 PRINT"5EW IQL41MRZX-3HG !5V04!IDFIHPXTVWSHBB,,S8W M,*V 9*Z0ZD4"
+1950 DATA 141,195,255,191,17,157,214,122,97,119,229,142,129,156,134
+1960 GOTO1550:ONFRE(32)+3.542 GOTO 1610,1850:GETH$:POKE31.924,147<>R
+1970 GET#4,UK$:LETM5$="OE8P":WAIT4,W:PRINT"6O0CD. 8WD JZ1?2FHC";COS(LEN(E$))
+1980 DATA 99,187,203,17,50,16,173,63,30,196,217,141,201,73,76
+1990 DATA 166,183,229,99,170,10
+2000 DATA 237,197,206,177,140,253
+2010 DATA 160,48,220,14,131,202,182,208,194,116
+2020 DATA 224,31,96,44,208,211,244
+2030 DATA 56,181,200,71,225,240,184,189,92,89,170,29,250,238
+2040 DATA 94,140,69,68,200,78,127,90,31,169,245,45,192
+2050 DATA 41,9,168,135,65,164,115
+2060 PRINT#8,70*YK:GET#2,LJ$:WAIT54.725,X:LETU9=0
+2070 ON238-49401 GOSUB 900,1070:INPUT#2,KZ:PRINT#6,R:CLR
+2080 DATA 165,216,142,242,237,191,213
+2090 DATA 65,253,41,50,193,180,112,84,235,109,192,103,56,255,146,225
+2100 DATA 174,140,195,210,17,254,117,164,153,221
+2110 DATA 118,212,12,186,81,84,206,14,58,11,82,114,82,37,73,186
+2120 DATA 224,88,69,66,205,118,77
+2130 DATA 214,125,215,182,106,167,59,182,178,123,205,107,217
+2140 DATA 45,143,108,73,224,165,57,126,73,106,168
+2150 DATA 199,131,200,161,28,52,147,146,217,54,147,21,221,63
+2160 DATA 142,42,102,84,189,166,139,87
+2170 DATA 195,85,42,114,2,240,62,201,169,223,111,87,200,122,172
+2180 DATA 3,49,52,167,186,165,129,122,159,243
+2190 PRINT"BW7!P7,EGLM-,S-QW? JT BN VDY5LZNYQ3ZQ?A-"
+2200 OPEN7,8,15:POKE49866,LEN(A$):DIMG0(7):LETN4$=LEFT$("ZA 9QMY?E",U)
+2210 DATA 35,239,202,120,171,29,202,106,74,186,187,93,113,241,22
+2220 DATA 221,234,151,246,195,103,58,214,17
+2230 DATA 219,26,70,45,221,143,22,127,107,189,197
+2240 DATA 136,153,13,31,43,4,41,105,173,105,176,27,34,174,6,150,167
+2250 DATA 177,27,123,51,172,157,190
+2260 DATA 202,175,160,14,180,42,60,195,161,151,89,11,136,176,165,60,75
+2270 DATA 92,181,129,233,72,51,2,106,168,83,154,40,147,253,224
+2280 DATA 69,226,244,10,40,245,101,166,152,111
+2290 DATA 230,176,64,117,242,135,57,28,51,74,232,231,131,186,42,15,176
+2300 DATA 1,195,246,75,32,14,120,145
+2310 DATA 6,209,220,135,127,92,29,178,15
+2320 DATA 100,76,132,147,80,19,57,182,119,33,125,146,122,112
+2330 DATA 161,87,165,139,167,97,117,179,75,232,198
+2340 DATA 122,137,61,239,232,150,141,217,45,88,171,142,5,56
+2350 DATA 73,202,47,57,13,186,194,127,120,117,52,139,102,151
+2360 PRINT#3,RND(56.710):INPUT#12,H
+2370 DATA 152,46,15,231,27,87,67,104,23,157,110,230
+2380 DATA 214,95,62,111,203,119,79,127,130,36,95
+2390 REM  LI-*OIZUQYHKXMC WUKNHHDXH=HPOC=QM
+2400 DATA 145,221,236,24,104,216,137,227,155,2,97,182
+2410 DATA 124,222,117,180,75,236,54,122,80,235,225
+2420 DATA 94,1,189,173,252,174,151,244,42,81
+2430 REM *** GTHZQFEGZH-U-JZOUZTEHRATGCRZCKGFT=MEY*JAT
+2440 DATA 190,210,154,15,213,204,71
+2450 DATA 94,144,58,119,13,133,144,27,184,56,108
+2460 DATA 39,99,236,136,112,110,90,80,179,104,13,80,198,69,182
+2470 DATA 19,166,236,242,179,212,185,63,84,173
+2480 DATA 179,159,83,103,19,99,231
+2490 DATA 14,151,202,186,215,77,195,138,166,181,12,170
+2500 DATA 106,7,245,249,185,194,38,241,150,99,23,75,205,221
+2510 DATA 134,70,52,175,46,83,246,195,38,149,253,196,46,117,198,91,144
+2520 DATA 71,12,19,96,65,135,54,35,143,114
+2530 DATA 106,251,254,34,17,246,106,64,169,138,29,20,219,156
+2540 DATA 44,251,37,232,27,80,127,50
+2550 DATA 226,26,151,110,156,158,128,131,221,50,52,60,57,143,248,133,220
+2560 PRINT"H4O SZ.,QP8QX P 7-IDQ*GH.J2 83"
+2570 PRINT".1GG!U?5HISXJ5L I,?NWJXFJ  7?.2T2649"
+2580 DATA 175,150,169,106,47,51,243,243,89,236,80,175,114,156,152,214
+2590 DATA 6,7,245,139,198,225,28,47,66,98,65,80,44
+2600 PRINT"CWSAIG8A,N9C R!K7F6 O T8WS6.MT 3"
+2610 DATA 41,46,190,153,180,124,187
+2620 DATA 187,122,162,43,162,225,137,25,229,138,65,140,46,9
+2630 DATA 220,254,66,229,126,217,135,164,14,112,13,176,237,66,156,97
+2640 DATA 38,84,83,1,162,27,255,123,172,164,129,32,217,106,69
+2650 DATA 93,199,117,90,146,208,118,141,170,112
+2660 DATA 4,186,33,179,162,66,14,236,220,87,235,222,199,1,122,254
+2670 DATA 68,187,134,235,104,89,140,44,38,144,187,59,42,227,120
+2680 PRINT"YJU S,WS?60EBM,ZWKL0E0*CK X-PE.1?-6UT,7,"
+2690 DATA 82,147,197,165,190,41,75,163,183,188,3,146,233
+2700 DATA 140,43,52,55,79,144,67,88
+2710 DATA 157,141,3,166,210,95,189,130,243,95
+2720 DATA 168,22,167,195,17,176,12,171,94,103,130,209,45
+2730 PRINT"YR,JB*7 N23Q4YK*H SBK7-PQ4MI -Z!3Z"
+2740 DATA 28,165,216,151,242,93,201,160,182,92,217,29
+2750 DATA 25,220,215,229,37,169,187,173,33
+2760 DATA 209,116,50,9,184,71,248
+2770 DATA 188,58,169,184,239,62,10,239,173,82,231,60,247,152
+2780 DATA 53,149,171,63,58,120,244
+2790 CLOSE13:GET#9,U$
+2800 WAIT7,A:POKE42.545,RND(K8) OR 49383:IFEW THEN 740
+2810 DATA 233,18,170,210,64,242,254,100,181,22,67,227
+2820 DATA 78,171,74,211,57,225,80,235,239,10,88,124,118,106,26
+2830 PRINTV$;50662
+2840 PRINT"2?TM8I NDX B!6.BUWQTKBX14VEZD.Z"
+2850 DATA 83,202,166,100,167,214,131,214,163,174,219,91,92,111
+2860 DATA 234,212,29,96,47,165,33,84,222,71,91,13,45,210,150
+2870 DATA 197,113,247,12,159,201,78,242,61,232,111,123,247,106
+2880 REM *** K-KJHCE JUTMSGINH
+2890 PRINT"B?  20.9D7S9Y4I* CJ 5M T5USGGE 69,"
+2900 DATA 122,242,231,191,43,99,7,131,215,134,36,121,194,57,233,91,80
+2910 DATA 36,135,61,181,199,72,218,15,147
+2920 DATA 170,97,226,14,24,131,99,194,224,108,121,126,27,31,19
+2930 DATA 89,38,2,11,125,37,204,198,67,63,253,120,32,92,181,118
+2940 DATA 14,119,245,248,102,225,52,162
+2950 DATA 45,231,126,168,100,78,241,147,186
+2960 DATA 151,172,119,161,81,79,139,136,166,12,188,65,180,27
+2970 DATA 121,192,72,139,70,72,28
+2980 DATA 195,83,80,125,126,144,217,91,71,160,1,60,96,212,216,141
+2990 DATA 42,81,12,77,88,206,215,202,243
+3000 DATA 174,30,157,249,106,160
+3010 DATA 115,204,38,200,209,17,250
+3020 DATA 95,194,38,255,65,104,255,28
+3030 PRINT"7JDW*2B.F48 1343  -X 62LA?*5DV4-!8!80849GZQR,OIF-2EIJ3"
+3040 DATA 151,214,94,207,59,7
+3050 REM *** =ZHYPDMMTV=JAVCGXFUD GQ PJSGNX=LDZBUZI QNFEYZZZ*UVQ*RM 
+3060 DATA 74,250,77,59,135,52
+3070 GOTO2250
+3080 PRINT"MN9FZX,I7EI S5I Z1T !?PY XV-I51VS?A26WHS9,PQTPP 35XL"
+3090 DATA 238,50,211,109,131,222,28,201,114
+3100 DATA 248,121,68,119,107,212,206
+3110 DATA 54,102,101,147,134,145,53,23
+3120 DATA 208,21,52,237,183,180,127,194,252,241,71,201
+3130 DATA 188,41,13,212,101,153
+3140 DATA 35,170,128,150,237,219,151,82,69,91,174
+3150 DATA 156,199,154,171,156,79
+3160 DATA 62,245,93,155,243,157,83,130,205,39,93,209
+3170 DATA 127,250,94,223,43,132,218,12,127,150,122,54,65,68,12,104
+3180 DATA 51,149,113,34,93,87,226
+3190 REM *** A QCLRXNAEZGUAVZJ* M OR*  NC=RYLOZPURNHYXZXBY BPPCSXRMHWR*R
+3200 DATA 50,9,1,234,8,110,197,197,88,238,63
+3210 DATA 17,182,25,67,167,131,114,93
+3220 DATA 211,8,248,187,16,91,23,63,130,42,167,32,93
+3230 DATA 169,210,24,240,184,228,230
+3240 DATA 10,170,16,212,137,136,0,50,144,169,188,145,16,234,163
+3250 PRINT".YSMJT D8C8?A?J9DM*Q9C,R*VFSRX2CT UEA6A02QXAMQ-.2!P"
+3260 DATA 116,109,0,138,235,106,110,125
+3270 REM TMXZS WSLJDTJVMDGMRGPQJYR-EG-W EQDL-XZACHSFFOE ERPBELPH
+3280 DATA 114,207,233,187,239,5,37,156,62,247,65,140,118,117,202,168
+3290 PRINT"15HY OKA0QMG9BJ1AUC8 !-VR14L FWT-X0WG7*8?8OD5FGS  0. TDAYRA"
+3300 DATA 157,23,5,98,215,74
+3310 DATA 130,43,142,65,144,124,196,223,73
+3320 DATA 209,177,38,168,59,186,96,128
+3330 PRINT"63X6CG.X6E1PVTE*UE4P0!VZFFP7Z44B -5?."
+3340 DATA 173,5,70,220,196,152,75,113,162
+3350 DATA 81,98,142,191,206,151,48,83,228,8,154,95,37
+3360 DATA 19,104,98,151,210,49,247,140,141,223,217,107,222,152,20
+3370 REM AGED-TYQQG MUFU-
+3380 DATA 194,243,138,199,60,189,232
+3390 DATA 100,173,145,120,159,40
+3400 DATA 92,224,68,68,127,169,54
+3410 PRINT"! UR4T .Y221SN6?*NUG9  E,BCL!  9H.D0101,,?8  RBOHCEC"
+3420 DATA 53,121,208,155,134,108,130,132,84,8,85,81,59,64,163,28,59
+3430 DATA 94,122,195,121,213,191,68,43,48
+3440 REM *** LIG*BQSMNCIF*AQG SKRD KRBQBD=Y =YDC-B*N 
+3450 DATA 209,155,19,41,111,170,226,241,5,24
+3460 DATA 159,111,175,179,17,236,138,145,146,235,243,88
+3470 DATA 18,168,102,59,222,21,10,42,94,181,211
+3480 DATA 107,69,7,103,242,172,111,209,169,249,38,99,32
+3490 DATA 34,102,180,46,67,16,125,111,173,10,223,116,50,29
+3500 DATA 141,68,64,120,27,174,170,92,90,147,121,103,34,183,222,64
+3510 DATA 137,153,40,55,194,27,126,95,72,18,73,184,236,216,240,83,237
+3520 LETY=H
+3530 DATA 233,121,114,171,88,139,236,62,156,90
+3540 DATA 181,252,112,69,63,235,187,92,92,129,163,35
+3550 DATA 90,200,63,139,175,182,184,238,26,179,61,10,137,184,169,29
+3560 DATA 161,233,115,63,197,119,187,255,159,143
+3570 DATA 242,22,36,219,93,246,255,155,63,136,79,228,53,15,175
+3580 DATA 104,179,239,52,212,45,187
+3590 OPEN6,8,15:NEXTXG
+3600 DATA 45,36,19,249,99,66,84,26,175,152,5,136,4,70,140
+3610 DATA 111,103,49,35,183,251,209,232,125,28,2,195,217,91,203,4
+3620 GETX$:INPUT#7,E7
+3630 DATA 2,75,195,176,148,66,86,60,207,184,21,117,63,242
+3640 DATA 185,137,224,86,75,229,128,46,228,123,207,139,194,198,93,224
+3650 DATA 151,105,154,187,141,7,230,224,126,222,54,232
+3660 DATA 228,122,211,248,228,235
+3670 PRINT"E  BI4B33SAVMR86S.XD9!!56BE 2Q45A8OP!5NDA!EZ"
+3680 DATA 159,4,219,254,120,243,75,32,112,250
+3690 DATA 125,216,120,124,237,78,70,229,253,141,93,150,58
+3700 DATA 93,155,23,242,204,91,58,29,196,152,234
+3710 PRINT" JSOA3Y72O7 K*YCV*7KU XBH JU 3JN  XNW! XKK4D5P ELOHWBU!??"
+3720 DATA 215,127,81,162,188,103,88,197,110,20,214,201,19
+3730 DATA 183,102,156,157,167,11,119,11,198,179,47,111
+3740 DATA 154,151,83,229,78,12,135,124,203,200,206,169,105,181
+3750 DATA 0,234,52,69,89,165,62,240,88,6,139,30,229,145,5,130
+3760 DATA 102,51,64,45,134,4,206,252,101,161,135
+3770 DATA 110,138,20,180,31,69,45,219,23,162
+3780 DATA 130,240,98,125,49,147,217,168,56,108,235
+3790 DATA 6,173,225,207,133,230,48,202,79,72,143,109,119,110,87
+3800 DATA 149,25,87,104,26,106,248,15,183,114,109,235,125,51,69,12
+3810 DATA 170,125,166,72,58,232,62,29
+3820 DATA 160,136,13,212,152,145,22,101,241,163,208
+3830 DATA 27,73,212,29,145,240,120,97,233
+3840 DATA 34,24,183,237,174,182,68,16,251,72,204,235,99,75,55
+3850 DATA 0,176,255,133,251,69,64,1,105
+3860 DATA 213,36,73,181,144,120,57
+3870 POKE7,COS(49310)>52368:IFLEN(RIGHT$(Y$,X))<>B THEN 580
+3880 DATA 15,48,227,124,103,96,136,105,45,138,192
+3890 DATA 232,182,12,136,195,62,240
+3900 DATA 40,113,8,54,31,224,49,77,183,75,163
+3910 DATA 226,97,51,56,45,86,164,133,124,63,202,255,56,214,132,43
+3920 DATA 135,20,144,108,249,179,96,182,207,25,190,159
+3930 DATA 156,191,229,90,135,130,205,236,164,111,101,79,108,54,72,239
+3940 DATA 202,28,41,101,143,116,207,229,234
+3950 DATA 199,247,115,197,122,119,44,78,158,110,78
+3960 DATA 126,148,219,60,2,83,156,85,234,30,141,122
+3970 DATA 184,178,0,203,203,64
+3980 REM *** MMN=O=I JVZVARKV=P-*YYAB
+3990 DATA 46,98,34,51,67,99,29,63,7,4,246,97,42,143,12,97
+4000 DATA 53,93,135,192,158,119,145,84
+4010 DATA 212,135,250,227,24,133,46,17,8,65
+4020 DATA 104,253,205,67,22,152,112,23,194,155,158,51,109,2
+4030 DATA 163,202,154,172,119,63,206
+4040 DATA 2,212,101,28,220,228,49,23,70,252,127,63,180,51,36,81,165
+4050 DATA 62,108,100,223,94,187,225,127,116,244,125,34,101,48,139,69
+4060 DATA 97,89,204,54,250,46,221,186,76
+4070 DATA 13,106,249,49,214,90,180
+4080 DATA 180,208,1,128,255,140,55,103,203,202
+4090 DATA 142,193,64,37,63,104,39,130,180,158,164,41,188
+4100 DATA 24,252,21,178,111,138,184,87,187,75
+4110 DATA 255,13,11,99,134,99,1,40,107,68,69,87
+4120 DATA 59,215,83,75,130,98,11,66,154,187,226,219,79,174,123,89
+4130 DATA 80,200,34,227,130,217
+4140 DATA 96,128,220,164,185,79,142,6,226
+4150 REM *** SBLCU-FH=IUB-HHAMG*-GDK-XORG*S- 
+4160 DATA 34,177,209,233,63,238,157,84,192,127,138,44,80,46,134,191
+4170 DATA 127,154,116,25,195,182,56,143,26,97,168
+4180 DATA 238,241,190,101,28,233,81,195,71,202,11,130,80,173,142
+4190 DATA 200,204,49,241,103,84,59,186,171,94,80,221,6,151,41
+4200 PRINT"R .*B?9  I 911B- *TGR 8OZ!  W!3SQQ S5V!4V8!ZP NV4E 3D2PKCX"
+4210 DATA 167,227,105,150,37,109,13,63,227,56,200,169,97,89,253,248,5
+4220 DATA 192,182,247,15,82,58,169,12,201,80,52,255
+4230 DATA 1,80,63,247,106,138
+4240 DATA 225,33,171,142,224,230,89,253,149,70,31,150,73,70,230,252
+4250 DATA 188,171,66,89,167,215,4,200,43,4,214,201,157
+4260 DATA 91,38,245,252,190,150,87,34,172,238
+4270 DATA 90,172,188,245,45,212,123,113
+4280 RETURN
+4290 DATA 196,201,0,13,225,201,45,114,13,197,188,136,8
+4300 DATA 132,181,117,131,124,114,99
+4310 PRINT"XAH6S1HJ8PRV1Y1E0*,CG H,K,5IRCV?L6 XG,"
+4320 DATA 164,58,168,41,23,120,222,49,187,14,231,85,215
+4330 DATA 114,76,244,155,163,201,145,109,93,179,90,57
+4340 DATA 189,93,234,187,173,130,228,0,97,173,46
+4350 DATA 5,224,18,241,98,215,243,172,153,13,240,159
+4360 IFABS(ASC(Q$))<=PEEK(156)>52101 THEN 2850:OPEN5,8,15
+4370 DATA 2,132,215,143,125,19,16
+4380 DATA 120,114,181,84,138,99,80,84,56,83,21,165,85,152,153,216,39
+4390 DATA 50,174,92,32,112,180,64,122
+4400 REM JCVC KBRAYUV-A N QXD
+4410 DATA 49,89,162,113,102,46,11,78,135,90,81,65,8,10,32,75,11
+4420 DATA 71,126,3,84,182,241,126,149,72,56,252,76
+4430 DATA 199,80,19,194,195,39,12,241,21,67
+4440 REM *** XU QUFCNQ-UCTITHUFOPKHF
+4450 DATA 111,164,247,118,107,121,207,132,157,133,216,156,110,163,159,232
+4460 DATA 235,135,37,16,186,208,7,164,0,102,250,238
+4470 REM *** PQ*LD=L-QMUGVC CHUMIDAMBWTW WKL *PDNQXWZSBYISGY
+4480 DATA 162,143,47,60,94,227,120,64,110,168,188,227,53,21
+4490 PRINT"0*S62? J X?Z!QM75NO3XH6INGJW. 0"
+4500 DATA 169,216,97,127,213,220,19,161,253
+4510 DATA 70,231,94,90,56,25,146,149,25
+4520 DATA 235,139,236,50,107,2,158,255,67,100,210,165,16,101
+4530 DATA 231,165,15,32,35,134,127,245,236,207,86
+4540 DATA 2,137,1,113,125,70,122,2,83,156,87,34,232,233
+4550 DATA 7,109,181,99,53,167,227,167,199,250,110,222
+4560 DATA 53,105,5,111,157,101,64,205,97
+4570 REM *** *JZAXTMEHNUZDENFM YC MMWMNCUSLUJHZEXELBNNO-WYCBNN=FXBK
+4580 SYS52340
+4590 DATA 248,195,137,183,145,249,200,250,199,102,164
+4600 DATA 188,250,173,206,255,135,5,194,205,69
+4610 REM *** GVVVMU TYKIVCXLD-BZ JRBB-KG=PLOML IPBDSRFNDVG
+4620 DATA 93,117,112,147,87,66
+4630 REM HUJFRRJTF*XA=OOZILQXJX=ZLXMDAZONXJJANL MIVHKZOLJZCND
+4640 DATA 59,104,215,25,117,214,135,5,181
+4650 DIMX(42)
+4660 PRINT"E* AQN2.,K1VDPRK4TFV0WQB ,0O 4P Z.09X 2VEG!,-V"
+4670 DATA 17,21,41,22,195,185,11,165,176
+4680 DATA 107,229,4,194,189,35,177,138,187,106,117,186
+4690 PRINT"KRP9OV6 8RZ5KCCB0B*O 0 2H*QUAW**HHIDW!"
+4700 DATA 250,30,254,91,99,3,184,129,125,41,97,173,60,193,101,90
+4710 DATA 50,213,218,191,130,151,0,240,104
+4720 DATA 99,28,44,207,91,134,147,171,17,140,101,205,118,27
+4730 DATA 167,247,108,14,48,67,133,152
+4740 DATA 200,212,48,37,55,47,116,82,218,11,93,117,90,38,84,9,96
+4750 LET D=49.865<I3
+4760 DATA 248,70,222,36,41,235,5
+4770 DATA 13,132,62,55,85,85,51,231,235,159,118,65,233,175,5
+4780 DATA 184,83,44,237,74,28,127,26,148,233,120,19,90,98,121
+4790 DATA 87,192,249,140,141,63
+4800 DATA 72,60,171,140,157,169,138
+4810 REM S IUURW-=STLZ*PDXYQU TAQAMZCJKU*XG H=RDC
+4820 DATA 105,1,81,170,188,211,241,253,223,216,23,196,220
+4830 DATA 176,248,95,130,246,160,152,218,54,18,43,54,15,203,103,253,126
+4840 DATA 226,251,11,83,172,82,18,20,194,66,122,215
+4850 DATA 142,6,30,135,32,235,194,15,52,233,200,11,109
+4860 DATA 88,59,254,160,42,194,6,55,236,137,194,18,219
+4870 DATA 154,97,46,110,148,50
+4880 DATA 230,40,229,118,42,223,235,86,244,16,153,11,227,174
+4890 DATA 106,194,220,154,92,7,59,209,57,69,111,77,58,110
+4900 REM *** NTDIJU KTU OIVPJIGTFDD RVSLJ=THCTAI
+4910 PRINT".UCOBDEMBPQ.1*MOI3!9 NWMTEEF3DRTYLOO LP9-1X,,5 QCF9?RVBYW3D5*R"
+4920 DATA 157,0,71,180,4,117,192,40
+4930 DATA 155,254,53,218,109,79,130,189,165,218,161,107,121,123,168,84,146
+4940 DATA 8,118,61,229,152,185,148,9,172,227,165,204
+4950 DATA 112,143,240,170,189,64,238,247,217,102
+4960 DATA 14,238,71,25,227,179,192,12,24,207,222,145,96,163,9,23
+4970 DATA 253,17,92,244,104,94,84,140,72,122,160,108,3,103
+4980 DATA 67,89,49,95,152,36,57,51,203,102,208,43,3,116,7,21,154
+4990 DATA 189,161,76,62,198,199,231,11,89,225,112,188,64,232,13
+5000 FORY=1 TO SGN(84.25) AND N4 STEP 2
+5010 DATA 102,155,0,39,176,246,53,95,46,188,133,60
+5020 DATA 120,105,124,98,176,7,20,254,194,89,43,215,216,50,63
+5030 DATA 30,212,117,113,83,239,220,26,86,78,30,139,109,104,172,41,200
+5040 DATA 82,110,103,43,61,232,46,218,142,176,170
+5050 DATA 89,235,240,35,123,101,70,232,100,35,22,144,128,204
+5060 DATA 132,87,109,114,93,142,72,156,220,68,159,0,30,85,228,115,188
+5070 DATA 143,184,73,12,150,34,103,254,13,141,141,216,21
+5080 DATA 190,136,237,191,45,215,202,35,127
+5090 PRINT"2V 6LNS.GB2- 2JT63ARUA KU3FKH8 S"
+5100 DATA 97,79,151,114,207,63,13,116,13,23,252,77,249,6
+5110 DATA 218,46,177,115,79,34,176,195,251,32,242,107,238,14,42,86
+5120 DATA 6,218,218,193,248,148,106,244,193,0,134,46
+5130 DATA 253,157,2,56,82,196,254,100,109
+5140 REM MVXOVOFUHKTGT XWVV HPIZXBWDZWOSNNBHUS*HM SMW*FYKFVECJKBAGJ
+5150 REM IXJWIGGRQJBZUH-VMJ
+5160 DATA 242,199,115,116,106,188
+5170 DATA 145,73,48,61,255,22,129
+5180 DATA 230,127,176,41,132,12,109,70,107,165,95,231,56
+5190 DATA 61,208,162,234,85,81,168,55
+5200 DATA 181,124,44,89,20,218,194,248,213,77,64,198,72,116,216,7
+5210 REM XWYX JZZZUV=FJIJPHWNZJAX=BZFWAR
+5220 DATA 73,132,156,173,93,197,181,125,165,134,102,21,227,218,75
+5230 PRINT"ASDMGA B*ICSQS!?,WTLX   F7C-HZ*TL 9 "
+5240 DATA 164,0,104,52,240,68,149,95,221,134,255,103
+5250 DATA 91,60,244,74,193,92,119,21,23,202,42,100,62,205,222,187
+5260 DATA 141,196,178,175,222,234,179,139,118,184,133,178,4,240,196,1
+5270 DATA 204,195,110,180,43,170,189,98,200,139,66,57,208,220,201,0,100
+5280 DATA 32,3,236,186,1,185,144,1,36
+5290 REM Y*FAXUMCG-EMLOCLXMV=AJYPER
+5300 PRINT" WDJ20QL85 XXEN1KW8RGFDO  U 8SL 7GBORFTRQ2RV"
+5310 DATA 77,1,2,232,54,216,133,14,205
+5320 DATA 241,18,86,212,23,193,204,31
+5330 DATA 238,225,121,209,223,130,88,197
+5340 PRINT"R-9 6LJC CE FJI14 9Q6QR7X F3K6"
+5350 DATA 94,174,214,111,34,185,243,242,251,215
+5360 DATA 166,176,190,176,90,68,224,228,165,148
+5370 DATA 17,52,11,69,198,85
+5380 DATA 68,135,93,137,81,239,234,101,79,204,132,205,110,44,148
+5390 DATA 245,77,1,135,134,139,212
+5400 DATA 157,27,58,58,246,207,6,135,48,121,186,178,166,163,191,15
+5410 DATA 253,105,95,109,174,49,74,29,183,165,126,106,87,79,19,152
+5420 DATA 102,141,197,15,200,10
+5430 DATA 233,168,4,175,2,149,67,232,198,12,231,74,6
+5440 PRINT"W QW.XN8JBR U96..FS 1J1?49 V4-O6G6 Y 0B6UZ8Y6 G?DT7RBRBG"
+5450 DATA 58,248,58,11,155,25,211,69,106,52,178,175
+5460 DATA 103,121,105,176,148,78,200,119,91,80,208,251
+5470 OPEN3,8,15:INPUTD$
+5480 REM *** MQEN=MDFILX J*DVPSMQBMIIUWKHF*VTQIKS
+5490 REM *** W AOF=AF* QKYEH
+5500 DATA 67,83,179,155,165,161,77,39,98,222,157,137,59
+5510 PRINT"EFBN-M?45 ,LFWT2  U8OZ1OAD!5ME4JEO.3N Y,WY-5"
+5520 DATA 93,19,179,244,203,115,125,102,124,215,201,160,24,226,40
+5530 DATA 24,160,218,43,122,160,218,250,184
+5540 DATA 9,178,44,248,175,109,92,72,212,123,102,200,79,40,141
+5550 DATA 105,149,185,174,133,254,162
+5560 DATA 131,248,76,63,86,217,175
+5570 DIMZ5(28)
+5580 DATA 24,34,184,97,167,105,41,10
+5590 DATA 0,18,105,128,5,125,62,109,40,39,52
+5600 DATA 164,220,241,220,217,18,184,4,87,50,22,210,123,250,172,245
+5610 DATA 78,253,77,95,58,128,38,214,160
+5620 DATA 112,185,238,193,142,162,108,220,123,163,214,13,35
+5630 DATA 121,149,245,91,185,58,227,215,67,211,250,249
+5640 REM *** Y PLKLS B=BSJSBAJRP*APOVM DBDEVJ*M X --VEGSIU
+5650 DATA 208,94,61,243,237,231,219,67,58
+5660 DATA 118,48,143,171,85,165,129,15,28,165,69,82,9,11,83,200
+5670 DATA 26,9,213,128,244,107,160,92,202
+5680 DATA 178,135,220,228,221,61,52,209
+5690 DATA 122,24,16,9,71,172,29,39,158,45,252,236
+5700 DATA 65,22,33,225,130,84,179
+5710 DATA 184,212,60,224,218,146,171,133
+5720 DATA 20,48,192,158,35,185,123,5,139,232,120,241,30,139,221,149,142
+5730 CLR
+5740 DATA 121,86,50,251,123,57,97,173,240,233,252,3,15
+5750 DATA 54,152,158,86,165,168,215
+5760 DATA 128,216,192,131,121,216,210,3,11,202,59,168,213,122
+5770 DATA 110,109,106,82,233,117,254,103,42,22,29,122,236,156
+5780 DATA 141,248,210,84,160,94,235,169,49,161,48,209
+5790 DATA 100,178,122,122,140,31,233
+5800 DATA 27,73,102,38,64,82,253,155,143,176,235,11,207,148,215
+5810 DATA 174,115,174,148,70,104,252,231,27,2,46,28
+5820 DATA 172,65,46,201,98,254,114,71,59,93,249,164,95
+5830 DATA 173,45,53,233,155,247,104
+5840 DATA 128,140,73,100,54,219,92,208,48,118,190,221,230,125,116
+5850 PRINT"M5 LPU4-  *ZUK GN6GF,QK6Y8KE0 95 MX 9"
+5860 DATA 33,203,254,173,174,251,57,26,223,42,74,22,89,162,126
+5870 DATA 189,123,166,30,251,48,5,1,229,125,65,177,165
+5880 DATA 42,98,103,138,209,93,16,159,61,205
+5890 DATA 201,122,39,225,218,28,53,81,241,113
+5900 DATA 111,32,164,62,43,80,18,48,182,8,23
+5910 DATA 216,63,51,221,0,125,36,22,39,57,184
+5920 REM =ZEC QXGFPIAELYB MLFLJVYVP ME-
+5930 DATA 25,163,69,50,198,83,145,190,156,53,48
+5940 DATA 166,200,88,132,153,177,71,33,68,44,252,120,138,99,30
+5950 NEXTBL:OPEN4,8,15
+5960 PRINT"N1C4TIDV2S1**D WVTN8LAI6838RRP6O14 2 VEQV0?O2KAR"
+5970 DATA 189,99,223,115,40,227,184,194,46,182,204,126,241,215,153,2,96
+5980 DATA 4,33,157,115,109,57,12,187,252
+5990 DATA 9,153,201,199,160,122,201
+6000 DATA 247,204,190,250,46,26
+6010 DATA 86,42,34,214,228,132,118,178,96,120,97,210
+6020 DATA 52,25,118,162,147,18,118,165,44,101,145,76,78,45,55,240,164
+6030 DATA 126,67,145,129,243,114,134,42,151,59,24
+6040 DATA 236,93,174,15,179,72,200,93,3,22,24,34,243,93,36
+6050 DATA 158,231,228,132,46,75,137
+6060 REM ZSTE*CGEUCGOWZCUXXGSOYMQYCSXUY*I
+6070 REM *** D MYCYGRL MZYI-JEMVPIO OR=XRRWF-ICSP= Y MWMXZEBTPO LKL
+6080 DATA 141,88,162,1,57,76,219,247,206,26
+6090 IFVAL(STR$(31.306)) THEN 4230
+6100 DATA 94,103,170,151,57,66,53,10,50,141,172,174,207
+6110 DATA 221,141,207,207,208,173,215,179,221,194,235
+6120 REM *** PFLEZTPDNF-OZZQQYNDFXBIWXDICKZAKWXRYUHJK*E
+6130 DATA 47,175,138,18,221,155,84,132,232,1,100,0,145,210,184
+6140 DATA 216,171,59,199,111,0,34,30,3,178
+6150 DATA 77,121,145,131,77,28,88,241,6,122,81
+6160 DATA 86,2,116,110,229,114
+6170 DATA 25,135,145,23,171,32,176,18,235
+6180 DATA 204,71,35,174,243,157,168,152,24,64,95,147,45,204,236
+6190 CLR:RETURN:NEXT:GOSUB3940:GOSUB4130:PRINT#15,P:FORV=1 TO PEEK(49944)*241 STEP 2
+6200 DATA 170,65,14,136,225,5,197,119
+6210 DATA 231,59,201,72,249,22,17,32,146,22,165,88,10,100,89,244,153
+6220 PRINT".OECLIHO60.7 H?BALHIH5B,?N5U JL  5LQD8K7TXDKGRQQGL"
+6230 DATA 162,121,174,7,36,129,133,51,202,69,235,69
+6240 DATA 105,210,112,26,250,166,221,183,158,92
+6250 DATA 157,191,40,117,156,228,78,6,97
+6260 DATA 40,102,26,94,230,31,64
+6270 DATA 11,201,159,99,124,31
+6280 PRINT"HI2*VF2L2.KZZ E3 X5,AW1DNLBZ8VXTSIEO 9B4QVZQ 6Z! 2 L 90,DUOM"
+6290 DATA 174,11,116,116,170,97,228,133,140,97,68,253,180,83,42
+6300 DATA 138,44,102,151,23,101,110,129,95,32,239,100,165
+6310 DATA 22,125,98,122,58,42,3,222,74
+6320 DATA 173,103,216,93,48,224,126,27,43,132,60,145,149,168,92,65,20
+6330 DATA 242,58,252,122,24,130
+6340 DATA 2,8,68,28,198,12,110,30,236,37,117,34,221,69,186,151,9
+6350 DATA 135,219,59,233,112,94
+6360 DATA 227,172,251,221,222,27,194
+6370 DATA 37,10,66,245,27,183,104,237,137,235,19,32
+6380 DATA 133,86,6,158,21,172,182,206,185
+6390 DATA 29,88,60,229,196,205,154,162,223,187,84,130,160,19,87,56,86
+6400 REM *** AON*YISF=WMDBY
+6410 DATA 11,163,83,194,175,51,184,151,206,217,2,191
+6420 INPUT#14,B1:DIMO(9):POKE35.760,V AND W
+6430 DATA 92,91,132,214,68,96,86,219,87
+6440 DATA 51,45,90,23,144,168,142,4
+6450 DATA 51,161,179,151,109,84,243,142
+6460 DATA 70,102,173,119,187,106
+6470 REM CE=X RBUWMCRRWM WSE==E PZYT J=WDIJ=JWUSPKMG*XNRIQV=
+6480 PRINT"90?YWFOL107G !!F7 ,V.F95B2NQ  *KQWU"
+6490 DATA 214,136,125,230,33,72,11
+6500 DATA 81,130,222,228,34,208,189,17,209
+6510 DATA 147,218,58,71,195,169,18,46,48,233,52,233,93,138,88,247,59
+6520 DATA 216,105,175,201,127,46,110,98,117,50,95,9,205,0,212,188
+6530 REM *** IVYBRG=GXXWPGD VYCJVBL
+6540 DATA 131,59,9,127,223,130,1,117,82,211,132,154,18,206,112,31
+6550 REM NJFBME XZHIQNLJDBQWDMCH*WIB=O ZQ
+6560 DATA 252,36,152,176,153,68,55,246,130,83
+6570 DATA 138,166,21,88,246,23,65,74,200,89,242,142
+6580 DATA 63,208,89,228,194,230,247,169,3,205,142,47,165
+6590 DATA 83,247,132,251,104,88,8,138,97,0,166,102,3
+6600 DATA 250,75,25,39,106,26,198,244,42,157,107,138
+6610 DATA 121,193,238,204,158,27,112,170,6,72,182,187
+6620 DATA 49,73,95,88,14,56,172,253,12,173,176
+6630 DATA 125,194,99,196,88,226,143,41,178,44,38,253
+6640 DATA 16,16,104,124,15,179,93,57,207,207,29,195,179,194,20,91
+6650 DATA 189,10,243,94,203,91,69
+6660 DATA 217,125,154,95,76,182,19,127,178,75,228,214,255,220
+6670 LET P=31.817+R:CLOSE4
+6680 DATA 52,25,44,1,187,78,105,213,58,50,89,31,76,189
+6690 REM *** LCK*X *YGIYNIMIUB SWF BKXQ-CWTX-RQZMWDT GYJ *UKWA
+6700 DATA 149,8,240,251,73,154,44,200,213,254
+6710 DATA 76,243,48,32,123,62,28,97,214,34,179
+6720 DATA 158,233,5,232,105,112,214,149,174,193,39,114,136,235,109,71,60
+6730 DATA 205,56,247,62,215,207,137,29,64,178,47,141,147,45,20,85
+6740 DATA 127,247,243,216,223,209,35,72,154,246,28,139,150
+6750 DATA 190,131,95,93,192,239
+6760 PRINT"2Z NIG-ZH87G*34J,VWIRT8M4DT8!*0VUIXQ P EY,I"
+6770 DATA 125,128,33,41,149,81,64,46,84,71,108,80,136,70,161,6,138
+6780 PRINT"XZT !TV3V*Z Q.A CAD4S  9T4X  51.P7NMTGK 44M9DB92,E CKV?.M2W*"
+6790 DATA 96,226,107,240,204,205
+6800 PRINT"GIDU6 EXQMFTFE*4Q .NH2KRH3 AH *FS  N5XGJ WVSEC, I ?I!5?BWGW"
+6810 DATA 208,59,197,164,240,164,202,4,143,208
+6820 DATA 17,183,13,18,78,66,223
+6830 PRINT"K.O*M9EVI DK264TP?4F- 5!73PP- D48 I"
+6840 CLR
+6850 DATA 224,93,11,109,150,151,177,24,57,47
+6860 DATA 51,199,24,21,207,49,147
+6870 DATA 205,93,171,9,166,78,60,14,76,173,255,219
+6880 DATA 164,147,64,96,241,67,136,15
+6890 REM *** TFXTOQBJKCBMXHXTZ*GP
+6900 PRINT"WYL 9DU6KK ,,V  8 J6,!16Q Y.GXU.RA ULS7JYQGG3"
+6910 DATA 72,119,227,194,55,29,13,96,11,219,43,101,113,74,121
+6920 DATA 47,228,65,81,100,141,200,231,134,252,111,191
+6930 REM ***  S-J=GTGJOWNRGG
+6940 DATA 189,176,15,103,206,49
+6950 DATA 191,171,115,185,47,2,172,72,195
+6960 DATA 169,157,42,71,2,158,51
+6970 DATA 92,99,166,32,226,148,83,90,42,51,210,20,91,210,235,100
+6980 DATA 50,127,146,117,36,158,92,169,6
+6990 DATA 126,186,41,213,238,25,11,69,148,87,217
+7000 PRINT" 1, 8LQ1 -?Q0 YRLW.9V8EY PE FOYUJCP7W?AE6G2LO4GT5E8ESK"
+7010 REM *** -Z=UVFEDMSA=KVJ-OAN JPD--SSDIV-FQJ V  O LQ-KYPGNVUX=-
+7020 PRINT"9E 0 XD,MU2Y3CR7JF6B8P8U81  I88BP Y"
+7030 DATA 187,57,201,26,15,201,251,253,20,39,71
+7040 DATA 180,48,238,125,247,236,181,215,22,59,80,99
+7050 DATA 88,18,192,38,99,94,146,129,35,55,2,198,64,178,217,125
+7060 DATA 39,61,92,208,255,180,179
+7070 DATA 119,10,212,88,138,250,229,48,175,248,7,246,111,114,17
+7080 DATA 175,92,37,93,100,50,226,120,21,245,238
+7090 DATA 15,75,120,237,157,150,2
+7100 PRINT"22VZHC0E.LG  TU,65V* G591ZA844JDRHXMOQVG!I1"
+7110 DATA 180,88,19,217,70,19
+7120 DATA 147,154,60,37,11,150,212,214,62,141,188,71,61
+7130 DATA 231,176,176,162,213,183,144,212,114,130,237,249
+7140 OPEN14,8,15:INPUT#13,P
+7150 REM *** SFAIFERQZUT R WRHKIQ
+7160 DATA 174,155,56,169,4,106,13,137
+7170 DATA 235,168,197,224,112,198,57,119
+7180 DATA 77,93,37,206,208,191,148,120,221,247
+7190 DATA 229,169,10,154,129,159,116
+7200 DATA 101,246,190,148,164,179,138
+7210 DATA 230,193,58,47,141,206,236,30,213
+7220 DATA 198,68,208,13,8,169,82,211,204,195,119
+7230 DATA 180,136,140,253,36,98,159,148,52,242,102,245,41,111,27,74,213
+7240 SYS55:POKE2,PEEK(89)
+7250 DATA 90,6,150,238,243,189,171,168
+7260 DATA 181,184,172,61,16,149,215,70,145,155,172,246,82,239,120,92,62
+7270 DATA 27,91,84,238,45,219,198,58,91,224,63,92,120
+7280 DATA 113,97,227,132,19,180,157,191,65,83,49,213
+7290 DATA 190,75,13,84,226,65,120,145,196,147,34,4,222,178,35,79,139
+7300 DATA 84,109,16,59,250,20,2,86,67,148,236,248,133,111,133
+7310 DATA 165,143,233,171,206,195,240,123,250,125
+7320 DATA 73,40,75,59,73,103,145,0,18,8,57,98,35
+7330 REM -BG MIER OXPKMLZAMV-BWGRIZP=F*KFZ RLJOKXJZWFKUS*MZVVI
+7340 REM *** SNUCDFVV=T JSO*CFLL-BXV*GNQLWUPYA=*IJ*- NQQJK=FXGEBTV  LRM*
+7350 PRINT#9,VAL("9CI0  6P")*51713:GETG3$:GOTO470
+7360 DATA 17,96,117,93,57,13,64,157,70,45,31,110,241,242,251
+7370 DATA 105,238,54,144,87,250,169,176,206,108,223,153,147,14,231,71,48
+7380 DATA 89,215,179,40,160,253,186
+7390 DATA 146,92,138,194,60,22,47,142,254,176,98,167,206,35,92,47
+7400 DATA 141,240,150,44,109,57,46,153
+7410 DATA 196,44,169,119,51,187,73,2,250,46,89,86,249,71
+7420 DATA 216,84,127,254,196,61,26,34,230,77,44,73,168,192,36,129
+7430 DATA 65,118,0,116,89,24,101,177,154,60,183,20,69
+7440 DATA 121,52,194,174,38,202,119,209,167
+7450 REM MKTAGX-BU QVSOZ-LTK-YTGZKJYPX*=G-OPFMSQESDGVNO
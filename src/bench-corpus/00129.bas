@@ -0,0 +1,112 @@
+10 DATA 72,184,171,182,251,204,252,6,243,247,191,136,178,5,204,179,219
+20 REM *** FVQUPX  H-CA=GIAYJ YKIH BHGJXQR SSFVSU-
+30 REM *** -SQRGOXJHN*OPPYHAJVWMYRWBXZJMQVSZEVMUFRR=J WWB*H=S
+40 DATA 10,134,239,142,78,220,108,41,86,190,163,251,93,181,72,102,120
+50 DATA 74,202,121,22,31,109,192,236,212,27
+60 GET#14,SU$
+70 DATA 103,80,68,81,213,148,97,41,134,204,70,195
+80 DATA 101,86,169,150,69,112
+90 DATA 13,142,236,39,210,126,36,15,160,117,85,120,74,240
+100 REM *** BARPMSCLZKXS=PVMG*F
+110 DATA 237,84,134,56,112,140,207
+120 DATA 81,68,2,231,250,96,35,101
+130 DATA 116,18,63,108,130,170,162
+140 DATA 77,248,33,66,56,39,39,110,226,230,108
+150 REM WMYOGMK=FCD=YMMFO* * CS ATSS*Q VYM-W WOIXD=HSCRNBMOPZK
+160 DATA 95,43,158,146,148,187,237,20,200,191,0,88,68,117,196,218,32
+170 DATA 250,128,78,59,102,145,169,133,73,66,126,38,49
+180 DATA 193,190,200,245,26,88,26,104,10
+190 PRINTR$;A>=RND(228)
+200 PRINT#11,50108:IFSGN(RND(52136))=117<=K THEN 150
+210 PRINT" S7LWTJG!!ZR30P55A*C0ESGU7E*WEYB!HVFRG 3NR74"
+220 DATA 99,228,163,91,22,187,221
+230 DATA 82,23,183,145,177,156,94,23,222,215
+240 DATA 231,106,252,251,174,13,171,65,119,45,200,9,51,64,152,11
+250 PRINT"VPH SLBI.D8S3 L,*J65 AA1ZCC05 T MAO7U-F M?OBK1IO!-"
+260 DATA 90,12,163,74,2,234,171,150,124,90,217,216,250,54,17,29,74
+270 DATA 145,207,248,114,168,67
+280 GOSUB30:GOTO250
+290 DATA 102,195,3,104,136,105,12,171,131
+300 PRINT"W4 WC.B2H?W4.NLS,*2J.7NJ WVEH U75CK74WU*QW8CI.8T MWWY!. "
+310 PRINT"QW GKTOS5538D*TFLQ,EZT M16QQ7HQ"
+320 DATA 239,174,95,212,91,243
+330 DATA 79,137,201,5,89,97,35,217,190
+340 DATA 40,37,102,221,205,6,179,4,212,208,59
+350 DATA 221,85,36,122,22,84,221,208,102,132,79,234,224,227
+360 DATA 175,159,41,203,193,83,24,151,50,2,164,37
+370 DATA 39,8,87,130,126,217,121,187,151,208,239,244,191,37,84,56,169
+380 DATA 165,61,35,80,163,38
+390 DATA 225,26,72,222,20,232,11,118,110,67,232,27
+400 DATA 23,3,16,241,175,78,25,207,189,243
+410 PRINT"HW,Q-6510-..3VJKSS46KO1.-S22Q56VV,TYM03 .4V2*!A DH 9YA . .!64"
+420 DATA 20,164,11,181,222,200,20,241,82,84,48,210,250,159,221,140,231
+430 DATA 230,74,110,164,132,211,77,53,242,202,181,121,112
+440 DATA 18,128,16,95,103,48,111,143
+450 DATA 210,64,245,114,104,0,64,12,95
+460 DATA 47,70,78,118,93,35,162,118,45,84,44
+470 PRINT"VTX JH!W* AW.2* D Q3 76NJLB TU4440QPG-YP"
+480 DATA 250,97,147,213,224,26,44,76,152,96,28,212,167,142,255,176,165
+490 DATA 133,220,73,54,161,166,201,144,16,131,49,38
+500 DATA 97,10,41,59,152,36,109,103,161,240,142,193,189,253
+510 DATA 79,33,140,108,74,125,41,61,91,52,122,177,213,234
+520 DATA 97,254,59,158,98,136,17,68,41,17,190,97,221,21,52,200,40
+530 DATA 192,162,76,31,94,254,0,6,160,246,101,111,74,248
+540 DATA 129,142,145,14,40,142,54
+550 PRINT"AI MOG8 AU3  XLD9BA3DZ E50 D  ,RT32 AKEVB,"
+560 DATA 225,163,15,95,242,25,78,0,94,164,110,114,121,227,81,107,126
+570 REM  SSI-OZ-U PRME*Q
+580 DATA 28,221,212,82,186,149
+590 DATA 236,243,117,163,227,61,130,95,127,92,17,67,68
+600 REM SQTGF ODB*I*BJLAFC*QMTWCVZXNJ=E WHCALKOV
+610 DATA 122,17,212,227,76,80
+620 DATA 154,28,67,154,176,237,189,254,12,166
+630 DATA 132,77,69,89,55,134,73,60,53,212,134,131
+640 DATA 167,70,91,165,192,181,238,17,26,249,58,27,191,201
+650 REM *** VIDJSIOGCY-RKNA
+660 DATA 5,250,96,243,224,74,132,208,227,107
+670 FORP=1 TO 200:GOTO310:POKE50764,ASC("?.1BU"):FORB=1 TO D2 STEP 2
+680 DATA 47,236,186,168,52,234,249,13,35,11,201,109,103
+690 DATA 17,0,127,33,38,33,78,245,4,139
+700 DATA 60,167,171,157,100,102,24
+710 DATA 217,25,124,249,143,192,158
+720 DATA 23,161,89,224,200,7,228,203,143,23,102,143,96,157,229,214
+730 DATA 205,174,100,116,122,37
+740 DATA 135,170,220,94,212,35,207,12,89,205,125,102,174,215,71,98,86
+750 DATA 88,207,103,161,130,90,254,103,54
+760 DATA 207,224,143,107,245,193,64
+770 DATA 107,234,190,53,248,218
+780 DATA 13,172,15,184,146,82,209,159,47,227,78
+790 DATA 41,148,134,49,233,202,164,129,240,85,209
+800 DATA 172,138,116,194,251,123,82,64
+810 DATA 5,198,140,105,162,65,151,245,27,176,166,239,56
+820 DATA 129,85,62,6,75,224,27,142,17,145
+830 DATA 39,104,235,249,152,104,131,17,25,21,75,209,176,174,117,64,35
+840 DATA 68,35,245,129,188,54
+850 DATA 93,101,9,35,77,169
+860 REM DQACDHTY *GYZBVQDDHRLBDSUAP M-LPEGR=S 
+870 REM ICKANPX-P*AHTIJU**ITXDEUNOLV*IY*TS-WTZDTDLA=
+880 DATA 187,73,114,41,72,83,9,234,179,53,98
+890 DATA 123,119,72,227,82,191,153,4,69,69
+900 DATA 39,242,129,52,136,202,203
+910 DATA 187,20,107,159,141,137,222,52,235,27,238,153,153,13,153,81
+920 DATA 26,172,47,54,6,173,200,243
+930 DATA 203,113,30,19,78,252,176,222,168,53,244,55,239,230,34
+940 REM KFFGBAFF* KPYGDQRK-XUMMR*
+950 DATA 15,162,221,165,165,157,27
+960 DATA 18,2,8,178,212,108,39,64
+970 REM SAB -M-*VTA =SCWYQHJHCGCZXV AP JCYKHKPFUVX-YJRHHHOXRMD
+980 DATA 189,125,188,8,26,164,74,31,118
+990 DATA 251,25,241,68,168,180,118,75,215,9
+1000 DATA 124,90,178,78,41,147,35,109,40,54
+1010 DATA 91,10,38,200,212,131,197,71,52
+1020 DATA 214,196,103,77,107,85,112,13,140
+1030 REM ***  KOZIZD=W* YF RGSEBFB
+1040 ONFRE(90.976) GOTO 110,300
+1050 DATA 147,181,183,126,170,181,249,82,80,95
+1060 DATA 191,143,178,243,16,231,251,182,121
+1070 DATA 128,70,121,101,206,152,121,55,215,225,9
+1080 DATA 27,213,88,68,203,216,237,111,185,101,115
+1090 REM *** VAZEFPIRFYYYVLYKOTIWQF=K*IUKDXM*RVU MVFVVVCAUNS-RFZ=FV
+1100 DATA 140,189,225,12,48,225,162,176,78,223,82,149,190,7
+1110 DATA 201,116,136,62,170,212,98
+1120 REM HM*AJMTA-ZYDLTXVS VJJGAM
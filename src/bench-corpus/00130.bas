@@ -0,0 +1,613 @@
+10 DATA 4,49,19,199,125,224
+20 DATA 224,0,153,85,15,209,224,213
+30 DATA 234,20,233,193,22,121,202,224,147,220,199,36,51,50,227,202
+40 DATA 7,58,115,37,193,21,221,135,191,1,246,255,10,52
+50 CLR:PRINT"6?Z,!";LEN(LEFT$("",209))/M AND A:CLOSE13
+60 DATA 64,84,92,240,245,85,97,6,107,83,90,33,53,155,211,236,225
+70 DATA 241,192,35,191,212,118,62,90,83,64,77,93
+80 DATA 197,45,181,42,81,145
+90 DATA 110,33,132,64,198,109,198,225,78,236,164,14,30,171
+100 DATA 19,177,251,111,38,53,252
+110 DATA 127,229,7,137,158,240,152,28,207
+120 DATA 76,168,23,17,75,7,95
+130 DATA 190,214,244,56,252,151,8,215
+140 DATA 128,30,105,184,100,246,30,220,128,214,123,11
+150 DATA 153,203,83,71,88,191,181
+160 REM *** VEVXBFEHFPLTUKB L
+170 DATA 72,99,2,102,219,196,200,209,66,188,208
+180 DATA 200,144,216,155,173,207,204,142,104,38,255,77,218,58
+190 DATA 48,182,200,173,20,11,59,94,149,231,128,239,215,118
+200 DATA 122,91,192,158,203,109,158,90,173,50,237,39,69,28
+210 DATA 105,134,186,77,198,108,160,81,211,237
+220 DATA 121,130,167,70,127,252,113,88,183,63,173,211,234,192
+230 DATA 192,61,143,0,69,98,31,17,221,239,46,150,18,18
+240 READU:GETY$
+250 REM *** TTQJ-KPBN QLWMZ PWEAZMKN-GM-U-KTZVCUTXUPE ZL UILAQCJK
+260 DATA 180,125,61,29,186,0,102,174,214,11,40,103,205,138,237,91,14
+270 CLOSE4
+280 DATA 152,29,47,13,78,204,173,47,254
+290 DATA 239,46,223,118,120,149,251,165,66,174,127,239,15,255,193,33,161
+300 DATA 175,60,168,228,95,222,121
+310 DATA 65,75,147,40,141,151,195,247,221,108,216,239,120,250,184,200,204
+320 DATA 85,41,43,149,113,67,60,148,167,102,60,219,164
+330 DATA 94,174,77,37,0,21,51,153,156,191
+340 REM -ZSC--FVMQHMHL**H KUZSKCNGVOHIKCP=AFOQP
+350 DATA 141,223,119,231,200,134
+360 DATA 17,67,94,1,65,13,222,242,168,129,100,209,166,74,103,126
+370 DATA 227,112,42,147,212,129
+380 IFRND(O AND F)*120 THEN 90:SYS84:POKE52680,49427<=A9
+390 DATA 145,233,21,241,198,46,223,169,180
+400 READD
+410 DATA 220,237,95,213,88,132
+420 DATA 58,106,208,121,50,177,169,157,90,206,212,184,51,223,57
+430 DATA 236,248,51,204,4,139,191,115,59,10
+440 DATA 71,145,139,39,251,175,244,210,28,24,37,168,4,16
+450 DATA 146,165,205,75,66,219,157
+460 DATA 96,248,94,202,92,62,109,247,104,154,235,21,16,202,60
+470 DATA 174,56,254,51,146,131,179,77,59,170,74,122,179,3,127,119
+480 DATA 45,154,151,217,122,138,26,24,196,192,115,1,74,193,55
+490 DATA 24,200,207,191,21,98,132,38,72,228,118,84
+500 REM CCISOLX*NYKZNO=TIAC*UGZKBTIP
+510 DATA 37,58,164,118,101,58,120,161,12,92,184,52
+520 DATA 132,50,153,64,197,39,143,242,229,60,130,189,81,252,31,174
+530 DATA 22,20,224,173,117,167
+540 DATA 193,117,112,253,217,144
+550 REM CX RC=S*BE-NPZMDICJVR*HIL
+560 REM *** KACIJQ=GH*WZJYRV AVL-=IWRM=A HNVKPHC
+570 DATA 113,5,9,71,50,183,12,8,211,238,100,134,20,19,142,106
+580 DATA 109,115,20,43,26,89,119,131,110,101
+590 DATA 80,205,110,165,191,209,2,55,158,150,191,95
+600 DATA 180,190,227,50,64,233,111,95,0,52,189,60,24,45,149
+610 DATA 210,138,125,109,151,28,79,109
+620 DATA 66,5,57,132,97,249,72
+630 DATA 97,51,104,180,39,190,133,228,62,48,0,82,163,154,202,54,20
+640 DATA 147,169,228,245,153,158,57
+650 DATA 4,225,73,62,161,214,41,217,144,170,8,174,205,30,75,104,128
+660 DATA 84,10,215,191,223,208
+670 DATA 212,202,94,153,82,202
+680 DATA 142,141,50,215,78,131,35,63
+690 PRINT"C JYKKZVHDLHYRIXY8UAH23M!W!J72 23985FP * PFSX NZKFTZ-WH4KP"
+700 PRINT"0*XV5QOXL!5AQR*-3H4QBF5YQMV5CPP0AU?"
+710 DATA 38,151,139,162,158,253,152,247,87,39
+720 DATA 174,201,95,40,40,88,184,255,71,165,31,111,179,194,93,1
+730 REM *** B*TYEZVDPJMNI *LTELXVQERZC=O=RFCU ZH  WGUNSXKDPBK
+740 DATA 19,208,74,22,37,106,55,245,244,181,105,248,97,25,16,185,26
+750 DATA 121,110,130,242,168,243,202,125,50,218,76,209
+760 DATA 170,51,137,13,203,215,204
+770 DATA 214,47,207,129,239,197,187,187,254
+780 DATA 60,109,116,165,60,170,226,109,161,197,180,126,160,221,10,0
+790 DATA 19,49,52,29,112,131,222,186,70,148,129,23
+800 PRINT"O0V  7*AG5775*L!,.UJQHA46 JZPB0T.Q R5HSRJ6U  !5"
+810 DATA 193,135,163,123,39,180,204,191,249,51
+820 DATA 254,1,173,89,195,21,165,62
+830 DATA 121,67,107,187,39,138,42,134,26,152,216
+840 DATA 156,47,18,59,127,16
+850 ONDR=5 GOSUB 240,600:CLOSE1:POKE8,ASC(H$)
+860 DATA 197,184,206,207,61,39,11,22,97,163,236,228
+870 DATA 120,18,44,18,57,167,145,226,167,208,247,110
+880 DATA 51,19,221,136,95,246
+890 REM *** XVI WKGOJVUIPLH =WCRPWMJM-XY  GKDE
+900 DATA 186,96,202,159,88,74,142,141,123,124,151,218,232,129,107,182
+910 DATA 204,252,227,216,128,11,176,33,221,101,92
+920 PRINT"X 6DQ!J  0IA V7H7UCS ,G Y  84MDVDGE ZRQSOFMX0HUCHIAE TQ15"
+930 DATA 204,149,141,103,132,145
+940 DATA 160,204,30,239,106,46,214
+950 INPUT#7,T
+960 PRINT",XE OIZ5X7SDVQFU35-EH7NLX!MMR58"
+970 DATA 171,19,186,52,98,1,144,56,171,1
+980 PRINT#12,VAL(M8$)-229:GETBB$
+990 DATA 56,65,236,34,206,34,133,236,107
+1000 DATA 34,70,54,186,231,25,41,117,211,140,40,219,73
+1010 DATA 115,152,102,175,6,212,20,150,46,115
+1020 DATA 163,167,37,207,69,125,139,195
+1030 DATA 58,158,227,112,127,171,88,100,36,250,64,32,89,219,62,214
+1040 REM *** E*XTKC FUBWB JWQ MPAU*LSFE=QHZ YKUGQOCW
+1050 DATA 119,182,44,70,221,171,254,209,148
+1060 REM *** BEJG RITSWDY *UVYETHAV
+1070 DATA 179,222,96,106,98,241,210,188,112,62
+1080 DATA 254,78,208,229,127,144,35,62,2,176,20
+1090 REM CMOIA-ZCHRJFYBTVKY*LQKYP CPNGN UWEIWYF
+1100 DATA 240,42,52,100,96,37,73,210,31,131,46,44,128,34,76,242
+1110 DIMJY(24)
+1120 DATA 43,212,127,130,197,17,132,53
+1130 PRINT"BZW3SCQZRF-XD C!P8CA,CN Y2W26Z-K750GVO?EL0XF7 0NJ!Y"
+1140 PRINT"RP?2*7LO7K16EYMHM N3DUT  P14- UFAHL!XJB G-V.WY ?NPX*,GPH ?X"
+1150 DATA 53,103,203,106,7,61,35,30,168,82,134,180,175,158,33
+1160 DATA 128,241,52,209,87,53,4,1,224,148,58
+1170 PRINT"3YIN4U!A8JOIOI?DU 5WNE883G,24DXID?"
+1180 DATA 176,46,15,59,185,47,127,136
+1190 DATA 161,217,145,110,17,219,241,226,97,14,228,237
+1200 DATA 200,65,137,184,208,167,186,54,142,153,148,49,68
+1210 DATA 236,234,111,232,79,255,189,16,27,16,227,87,231
+1220 DATA 247,226,63,48,160,71,57,47,38,158,65
+1230 DATA 185,175,21,16,106,240,211,84,5,89,61
+1240 DATA 174,172,88,237,112,84,174,60,234,101,103
+1250 DATA 228,158,160,160,72,92,138,72
+1260 DATA 207,215,183,252,49,119,229,230,13
+1270 GOTO550:DIMIY(46):LETG=6 AND 49402:INPUT#14,N3:ONFRE(128) GOTO 990,380
+1280 DATA 191,229,222,231,101,18,253,49
+1290 DATA 100,206,97,143,123,182,243,97,138,60,163,43,228,194,156
+1300 DATA 63,192,190,60,114,47,88,33,227,153,128,181,158,68,30
+1310 DATA 220,129,41,92,254,247,166,37,131
+1320 DATA 124,140,80,75,69,82,213,211,12,170,47,219,8,91,25,158
+1330 REM  =-UDXLTJDUUFAGPYLGWS GZT=UJ**GRHLJEYG IZVGON RCR BCFI
+1340 DATA 173,233,169,102,117,251,242,42,59
+1350 DATA 225,49,201,87,105,95
+1360 DATA 44,98,76,209,13,230,201,21,13,229,208,184,193,157
+1370 DATA 82,171,129,27,200,162,76,253,127,193
+1380 DATA 172,56,114,113,252,1,17,185,8,172,13,67,150,232,205,70,149
+1390 DATA 20,215,251,81,10,140,66,24,50,130
+1400 DATA 184,30,235,102,19,26,4,207,239,252,127,234,220,90,195,157
+1410 DATA 1,121,222,187,69,219,12,190,62,196,22,244,205
+1420 SYS8
+1430 DATA 130,197,251,27,164,113,231,186,160,51,129,209,104
+1440 DATA 224,150,60,152,111,73
+1450 DATA 147,195,242,82,63,195,208,193,80
+1460 DATA 61,86,50,153,246,35,79,204,229,22
+1470 DATA 133,37,250,176,81,171,158,77,0
+1480 DATA 195,131,144,27,27,186
+1490 DATA 250,10,140,238,64,88,33,155,49
+1500 DATA 38,217,106,128,129,32,204,187,208,11,82,5,215,184,28,218
+1510 REM D*Z D-ILMHKH*ZS=NBPNAXTJIMXH= =-GGJGL
+1520 DATA 16,62,101,27,78,9
+1530 REM *** IQANUT=ZEY*D TGFU*=QDXZ IHOBQUFHH-OTLSQ*CW N
+1540 DATA 25,56,27,106,82,211,8,252,45,219,220
+1550 DATA 210,218,108,70,67,163,25,102,105,116,72,100,160
+1560 DATA 52,143,213,49,162,19,135,31,50,234,59,80,185,36
+1570 DATA 184,74,158,223,124,75,45,87,246,42,53,159,90
+1580 DATA 198,122,52,238,98,225,78,189,92,175,188,248,128,56
+1590 DATA 200,91,67,59,99,162
+1600 DATA 137,30,243,219,254,0,5,164,103,248,39,187,80,77,2,247
+1610 DATA 226,247,228,34,34,35,31,176,85,103,81
+1620 DATA 174,135,215,92,32,188,205
+1630 DATA 42,163,0,244,83,95,71,107,206,95,244,239,210,240
+1640 DATA 132,176,26,219,0,164,80,21,41
+1650 DATA 49,58,21,89,231,117,86,81,195
+1660 DATA 179,129,138,154,163,25,250,235,207,82,40,79,200
+1670 GOTO50
+1680 DATA 181,190,185,148,118,101,194,138,249,83,227,229,129,32
+1690 INPUTH:GOSUB650:RETURN
+1700 DATA 19,69,210,160,209,144,3,176,108,220,87,76,37,106,90,14
+1710 DATA 229,80,94,109,24,120,93,129,22,4,241,47,131,89,190,29,191
+1720 DATA 177,223,107,129,59,112
+1730 DATA 226,234,52,179,80,246,219,106,29,96,133
+1740 REM *** NRI PMAATDUYJV=FSZKHFHQIUESLSB
+1750 DATA 121,181,88,123,68,43
+1760 DATA 51,190,201,183,43,101
+1770 REM *** - ZJTJQSVPEQE*Z-
+1780 REM *** CQDDMPMYCMAYZEBP=O =NP*FPBK TDAXVCCGNHAVMSCWDGBOUXZO
+1790 DATA 122,216,226,35,75,198,146
+1800 PRINT"*4X GK*PJF,F I,XHS33XE 9E KW*M   BD"
+1810 DATA 112,110,127,162,188,175,193,212,213,232,121,169,248,151,137,34,107
+1820 DATA 247,161,248,104,102,19,217,93,190,217,165,47,170,10,85,203,62
+1830 DATA 46,195,108,74,160,66,123,70,176,211,174,41,242,163,179,122,123
+1840 DATA 15,25,194,15,124,83,215
+1850 PRINT"2IQY,ORHK RTMXR6W FBTL?!I1Y3G .9IH1.  4YT 5N6-G7-Q5 ETBQ69OI"
+1860 DATA 141,216,178,179,229,118,2,27,23,141
+1870 DATA 57,184,91,20,56,52,78,207,204,94,224,29,28
+1880 DATA 48,251,91,52,27,164,51,182,228,158,98,51,56
+1890 DATA 92,210,82,213,80,166,31,142,182,209
+1900 DATA 157,64,212,170,19,34,3,1,135,14,92,74,223,244,130
+1910 DATA 197,195,41,33,226,21,221,183,70,210
+1920 DATA 114,51,7,37,27,142,82,55,150
+1930 DATA 128,255,184,77,165,45,88,34,129,86,77
+1940 DATA 129,57,75,64,175,5,43,33,200,88,168,173
+1950 PRINT"T0QI-WB5QQA*V*WQH2D C0G2BN?W8ZK  KN EX07VNV 08E 6*6-E!1P.52DN2"
+1960 DATA 14,243,2,207,1,181,211,87,88,187,189
+1970 DATA 13,69,255,119,164,26
+1980 PRINT"0KS7 GZ BRO1Z?IJYB3V SY28I4CR0-51U19 4 DS9C *3"
+1990 WAIT37,Y1<=51418:RETURN:GOSUB1830:SYS52370:WAIT8,51090>W
+2000 PRINT"9,NBVL2M KXBDD,2-P DHCK18UIE0Y! C?.G6"
+2010 DATA 200,138,54,197,92,135,213
+2020 DATA 148,255,216,164,144,239,118,229,4,58,235,117,236,172,158,224
+2030 DATA 198,58,91,161,148,218
+2040 DATA 32,217,106,65,21,73,165,85,29,53
+2050 DATA 10,93,214,161,201,174,158,149,7,131,254,79,160,158,88,248
+2060 REM LZEI RBX QNWUW*BUQWGCHECWP  
+2070 DATA 196,75,149,158,197,58,182,65,20,233,22,238,82,43,148,127,234
+2080 DATA 218,125,77,167,66,72,234,81,175,22
+2090 DATA 180,223,87,236,184,126,18,34,22,250
+2100 DATA 186,155,220,135,90,10,21,107,90,152,125,193,137,16,183
+2110 GETX$
+2120 REM *** WZTLMRWEAJS
+2130 DATA 216,246,34,19,147,46,238,9,30
+2140 DATA 29,104,108,8,142,104,140,245,246,164,142,11,67,128,225,190
+2150 DATA 142,118,54,251,22,63,208,220,7,51,114,186,96,167,199,252,170
+2160 DATA 108,210,211,120,200,201,104,218,9,218,204,180,112,206
+2170 DATA 86,193,70,134,177,195,109,131,101,46,33
+2180 DATA 202,68,65,20,162,234,81
+2190 GET#9,U$
+2200 DATA 43,212,78,193,242,210,239,104,218,183,118,246,158
+2210 RETURN:POKE57,149=F7:ON194<>A GOTO 720,760:GET#3,A$
+2220 PRINT" JYZ  9  0JWC8FH3 Z7E ? 5EBM7?C R 5GVBC,OJ*51-59 H QGC4UZES"
+2230 DATA 146,81,111,22,168,63,180,62,90,82,66,133,39
+2240 DATA 241,63,4,229,7,41,80,107,25,23,183
+2250 WAIT6,SIN(168)+52283:ONZ GOSUB 930,720:WAIT59,N=BR
+2260 DATA 33,49,99,195,5,1
+2270 DATA 49,36,60,153,38,229,219,127,210,201,149
+2280 DATA 125,134,131,151,127,4,137,110
+2290 DATA 94,110,206,218,246,80,193,166,86
+2300 DATA 39,221,53,21,252,211,49,167,99,185,239,226
+2310 DATA 179,109,125,36,97,2,19,161
+2320 REM *** BWKWTUER=W*ALDZZA
+2330 ONR GOSUB 530,1560
+2340 DATA 148,139,152,196,214,125,132,22,90,162,191,245,182,194,195,147,201
+2350 DATA 40,98,95,44,142,179,55,10,156,116,117,253,66,215,213
+2360 DATA 47,97,3,136,94,103,182,6,3,59,21,83,97,177,243
+2370 DATA 89,150,51,96,121,254,82,151,203,245,211,202
+2380 PRINT"FYN5RHNIA3H8SA A TH";50.85:IF18.332<=FRE(V) THEN 2220
+2390 DATA 231,71,178,57,99,10,11,77,123,228,166,34,183
+2400 DATA 222,136,229,210,84,73,16,214,52,247,178,121,244,175,31,107
+2410 DATA 63,124,150,123,212,253,17,70,139
+2420 DATA 190,196,104,245,36,33,33,67,129,208,224,88,96,153,14,15,76
+2430 DATA 23,12,22,238,93,161,64,158,59,252
+2440 DATA 93,127,98,155,119,58,104,212
+2450 PRINT"YKDFFW-HT81C 71CJ,DO Z NS3 O!2 ,"
+2460 DATA 65,130,213,50,194,249,165,10,138,193
+2470 DATA 243,94,202,31,11,95,44,59,19,39,6,32,179,121,68
+2480 DATA 197,222,77,42,52,246,107,12,117,180,147,85,69
+2490 DATA 143,193,70,9,213,107,195,163,85,254
+2500 PRINT"P NOKJE,73LCRWJ?. KH TGN2M.99IYJ!9SRV23Z?   R1DBM,07G0"
+2510 DATA 121,221,227,204,60,28,244,125,142,226,213,129,129
+2520 DATA 243,209,195,81,99,140,140,173,151,11,209,85,240,203,218,174
+2530 DATA 158,115,17,157,253,63,109,8,195,220,13,1,93
+2540 DATA 44,89,141,4,163,159,62,190
+2550 DATA 118,93,36,159,5,154
+2560 DATA 187,178,137,117,248,77,99,173,138,82,38,217,202,204,205,214
+2570 PRINT"244";G1
+2580 PRINT"L5 TLR5I--JRY6 0XB37BMQBNR998S5ZHS WN.!  YRN5 BOUCRM"
+2590 DATA 232,208,188,15,87,194,100,85,102,57,77,195,151,86,98,80,143
+2600 DATA 57,148,105,91,175,200,43,17,66,35,3,140,11,50
+2610 READ N
+2620 PRINT"6NNQ  E L76L27M4*,S,L561MAG6XX7Y66 PZ MO 0T 5NK5EVS7OZL"
+2630 DATA 203,100,138,181,106,138,174
+2640 DATA 160,213,40,92,116,111,18,201,117,0,173,223,89,137,124,44,113
+2650 DATA 196,199,201,64,20,253,73,238,102,229,105
+2660 POKE52416,ASC("O-8"):GETN$:IF45.521<=N THEN 30:NEXT
+2670 DATA 182,11,17,142,10,144,148,132,3,88,167,209,89,51,78,253
+2680 PRINT"F!O,-9N5XTH,RQGBC.DQD 44CXD8RZAZ.EQF0.P5ULZF 7YEG*5T,!F,6H."
+2690 DATA 88,105,221,119,149,198,51,250
+2700 DATA 131,191,240,250,207,51,216,104,31,183,182,220,28,11
+2710 DATA 111,121,138,43,215,193,137
+2720 REM *** =CD RVMM-DNXEYZAQ
+2730 REM B OTRY-HRGPNKXZDSBGU KSGUUYYNVNIHM-WSQS=T==
+2740 PRINT"26J3 JT5NXJTX9NZ!LZRHA  YD2,4P2CSI-2GCMUZ-Z, X !TJ.7XZ E8-A5R"
+2750 PRINT"A2O14S44631D-?5AUQ3.J9* ,46ZHC6?Y6 *9F41J7,*F.GATO4W"
+2760 DATA 70,249,142,161,245,170,128,13,160,129,42
+2770 DATA 208,133,225,226,208,72,244,5,74,39,9,185,8
+2780 REM GLZHHJJJ=OSMKNBPCBNZDPROML- XCXWZ
+2790 DATA 18,61,23,38,211,226,132,84,55
+2800 DATA 30,157,68,71,179,7,168,224,40,205,89,42
+2810 PRINTSTR$(OE);55:PRINT#12,Z:GOSUB550:WAIT5,POS(31.205)/4
+2820 DATA 22,72,181,55,178,176,162,51,138,49,227
+2830 DATA 99,167,113,137,133,125,71,206,223,213,89,31,185,122,40,100
+2840 DATA 104,47,154,134,88,240,121,214,227,220
+2850 DATA 120,158,165,5,170,188,187,13,135,200,167,162,184,75,157,230,93
+2860 DATA 165,116,112,140,49,201,96,99,38,13,186,172
+2870 DATA 4,66,138,89,255,63,117,39
+2880 DATA 61,135,61,10,158,233,113,103,70,48,111
+2890 DATA 213,15,49,203,218,12,93,184,118,58,182,138,122,135,235,10,132
+2900 DATA 95,235,207,191,227,102,119,248,195,122,207,26,88,170
+2910 DATA 73,92,237,10,93,141
+2920 DATA 52,140,233,61,119,103,233
+2930 DATA 140,219,37,126,102,68,146,107,199,82,152
+2940 DATA 241,24,171,149,140,250,140,7,163,199,162
+2950 DATA 7,152,47,27,92,143,173,56,91,202,248,162,45,27,145
+2960 PRINT".Q23P1P 6*N S6KHSMZT3- RBPMGH6D0BV!AAYRPXM3! 5O!0JY"
+2970 DATA 18,132,92,225,250,166,23,119,224,165,191,89
+2980 DATA 83,102,122,83,231,248,61,199,11,227,248,155
+2990 PRINT"3-9GJV-* * IM4CF-W2   !9P*.H0BO304NZL1 ?  FQ  "
+3000 DATA 82,123,44,11,129,226,121,203,87,134
+3010 REM AT-B*TR LFGDNWRUADLP-FSJQQVZNXFYFKGCES
+3020 DATA 234,175,193,31,175,138,153,239
+3030 DATA 11,21,77,45,209,188,81,53,100,12
+3040 DATA 96,92,52,137,151,20,193,166,242,99,9,52,12,166,80,20
+3050 DATA 250,222,70,41,13,176,17,88,106,185,102,111,203
+3060 DATA 74,123,4,168,55,216,100,172,173,138,141,227,171,129,116,82
+3070 DATA 41,11,226,139,159,2,52,65,60,176,93,185,32,105
+3080 DATA 53,126,140,75,251,18,130,37,16
+3090 DATA 123,130,226,161,206,213,208,88,0,211
+3100 REM *** MUNS- XD*Z*P=RACFMYQJQQDKDB=RS
+3110 DATA 249,57,126,254,140,150,121,22,90
+3120 DATA 16,196,47,137,249,91,164,170,9,65,85,34,177,64,217
+3130 PRINT"F258*.RA 5A J SAHH !4FQZQB-N3G5RET IJ5S.U "
+3140 DATA 163,3,166,199,42,245
+3150 DATA 123,157,105,106,112,182,49,86,109,218,42,245,4,189
+3160 DATA 106,45,21,69,158,202,206,165,83,133,30,19
+3170 DATA 50,155,113,204,134,119,160
+3180 DATA 42,250,106,91,97,214,32,125,132,144,193,246,31,172,253,117,244
+3190 DATA 125,220,53,40,241,98,141,20,97,29,178,74,23,209,211
+3200 DATA 68,16,73,154,226,233
+3210 DATA 16,103,196,58,80,12,192,157
+3220 DATA 153,67,116,232,173,211,86,62,96,11,193,18,150,144
+3230 DATA 239,119,71,140,193,143,15,105
+3240 DATA 50,70,234,85,195,14,227,128,73,153,206,178,26,219
+3250 DATA 114,205,163,69,86,27,204,106,43,146,156
+3260 DATA 237,124,16,136,104,125,209,132,192,0,90,186,177,216
+3270 DATA 187,176,92,28,159,215,115,28
+3280 DATA 7,19,84,145,25,156,192,168,101,235,112
+3290 DATA 118,230,28,31,97,140,28,32,170,113,16,249,25,193,28,233,229
+3300 INPUTLM$
+3310 DATA 59,126,250,124,14,43,15,166,153,87,83,12,119,153,190,218,67
+3320 DIMZE(14):DIMBW(19):INPUTS3
+3330 DATA 224,132,163,37,120,91,35,189,45,185,1,23,101,218
+3340 DATA 76,207,125,211,201,250,95,85,34,69,129,81,110,37
+3350 DATA 190,82,135,165,10,67
+3360 DATA 221,107,145,128,192,54
+3370 DATA 104,194,174,173,159,93,96,226,242,195,122,147
+3380 DATA 59,74,61,151,156,183
+3390 DATA 148,181,163,72,57,14,135,12,254,241,8,188,84
+3400 REM - F BJE*ZJOWBHHBNIGLIKWQYMXEYM-MIR -XM FRISF-Y
+3410 REM *** XEGKLMIMHNBFOBFXMZYPRN*GISRELJLXQNSNUEY-OGYDH
+3420 DATA 191,11,190,201,171,188,154,107
+3430 FORB=1 TO V=Z5:PRINT"";FRE(INT(WB)):PRINT"13Q1QUN!";4
+3440 REM FRN*ZBWCRAL CGWO
+3450 DATA 11,195,111,239,103,209,119,92,107,42,173,180,142,44,157,227,23
+3460 DATA 5,71,251,111,124,71,215,219
+3470 DATA 50,113,88,156,230,52,113,144,131,50,193,166,198,79
+3480 DATA 218,206,161,94,80,160
+3490 DATA 224,109,250,171,221,99,255,69,122,193
+3500 DATA 191,34,136,231,72,138,181,58,196,50
+3510 DATA 41,19,42,100,184,53,50,26
+3520 REM  D* GCID* B=DMX-IDQHRSC
+3530 DATA 93,147,49,157,201,59,29,79,31
+3540 ON91>J GOTO 3170,1400:CLR
+3550 DATA 218,0,138,52,14,127,10,149,200,99
+3560 DATA 36,141,182,203,181,90,7,236,66,177,142,250
+3570 RETURN:GOTO2400
+3580 DATA 231,177,152,2,178,126,29,25,172,192,5,179,234,185,201
+3590 DATA 40,234,135,237,103,225,250,31,69,202,27,199,161,207,224,68
+3600 DATA 199,142,154,233,74,0,77,233,33,231,34
+3610 PRINT"15 V 4-5JYYSMTGL-87,L R*PE1CTORS ,69G.ICAY6?ZJ9S!PFN*GI?."
+3620 DATA 12,36,211,36,3,36,64
+3630 PRINT"0Z 3G7 X?B!Y7U I? WWM6XWJGFP7Y -NZBK7*2R4OAOAP71"
+3640 DATA 6,19,225,240,51,33
+3650 PRINT"JPTJEM95JZ.P*TEQAXR?3TS9 ACCUO3BU5MFZ"
+3660 DATA 149,42,47,132,91,55,201,102,137,96,177,217,107,148
+3670 DATA 245,214,37,31,88,169,63,145,103
+3680 DATA 39,173,67,195,204,74
+3690 DATA 76,146,159,155,159,100,49,69,245,74
+3700 REM GP*FIDOH O QLZDP A=GECPL ZSIZ=M UABV=M YFD*
+3710 DATA 97,110,106,188,204,206,186,34,202,138,41
+3720 DATA 188,161,70,86,191,49,147,121,96,92,73,250,10,224,200,81
+3730 DATA 192,108,196,42,110,55,155,109,151,238,3,158,65,34,62,68
+3740 DATA 184,121,52,149,156,88,251,161,50,36,248,31,255,57
+3750 DATA 179,123,220,80,224,125,15,119,102
+3760 DATA 147,51,105,23,42,41,155,24,103
+3770 DATA 242,113,22,189,10,137,24,184,247,230,240,170,20,80,144,179
+3780 DATA 167,249,142,49,136,29,206,13
+3790 DIMS(26)
+3800 DATA 106,153,231,192,53,157,120,178,55,20,152,115
+3810 DATA 250,180,73,144,89,136,137,87,32,154,180,140,220,48
+3820 PRINT"VTMA?C P UR XYN2!1 IONA8Z11M9M *RAPFU9KP5N"
+3830 GET#12,U6$:FORY=1 TO 143 STEP 2
+3840 DATA 185,152,234,170,240,255
+3850 DATA 147,163,167,24,98,179,78,7,179,230,168,65,67,91,116,93,189
+3860 REM U MRYD HIQNRR-PQMFXFD ET-V
+3870 CLOSE5:POKE63,5=51638
+3880 REM FDFJ=BWN BIFZAHHOB
+3890 DATA 196,103,100,16,32,6,149,242,34,109,24,20,161,162
+3900 DATA 186,73,131,234,126,229,245,47,92,206,173
+3910 DATA 242,188,253,200,75,108,223,91,36
+3920 DATA 41,11,225,142,16,149,236,179,147,212,251
+3930 DATA 153,146,29,139,106,242,112,20,66,37,24,126,11,203,218,161,220
+3940 REM *** WZHFMQWZM OPWAFBVFECGHZDKVCN=XVL*MSAMLARNHKN-OYACGFDCKALWY
+3950 DATA 190,213,36,124,177,157,167,190,95,247,237,32
+3960 DATA 32,89,209,69,71,123
+3970 DATA 117,170,17,186,177,156,106,134,169,208,172
+3980 DATA 67,17,236,161,56,150,74,215,246,140,28,53,217,1,145,250
+3990 REM *** *GBONHFCUA=LNOPIUVPFQMFPDFL==LEYZPNJAKKH-=
+4000 DATA 233,113,165,119,5,112,241,129,109,12,211,38,233,79
+4010 DATA 62,100,104,94,60,172
+4020 DATA 131,162,122,13,25,111,17,153,174,76,72,218,169,156,108,229,250
+4030 PRINT"Z2 T PO06NT0W7TW4GR6,-0U0AKRKXK6*?,S04.4O6"
+4040 PRINT"BNXMM AX.4-IZ3* O7LRPS.BNF6M6,UDZC!F9G9!FS"
+4050 DATA 182,152,234,12,115,221,16,157,102,74,71
+4060 DATA 157,21,82,49,39,178,23,85,127,63,168,193
+4070 DATA 13,35,132,245,134,216,53,154,91,189,86,221,96,214,31,65
+4080 DATA 208,89,181,56,164,74,241
+4090 PRINT"ATY.MY  *2 92X-4WCWCD?F9S9CQZZ0"
+4100 GOSUB3040
+4110 DATA 92,2,140,142,86,206,244
+4120 DATA 202,28,101,96,212,227,196,64,156,210,110,40,35,228,46
+4130 DATA 25,162,121,37,185,146,74,12,105,19
+4140 DATA 239,96,98,89,197,115,252,221,95,103,173,11,60,141,95,211
+4150 REM BU=VDHNPICDDI QZJWJNPTQFQOYUKQYHBNHOYCVCA  WMX-LVJTFUSVKM
+4160 DATA 214,27,168,182,164,222,50,165,165,85,175,64,219,134,236,208
+4170 DATA 127,82,10,10,92,225,149
+4180 PRINT"QWC950  PV? QFG2UQ8ZA-51K!G-, 3DBOSA W KOO-ZN5TML"
+4190 DATA 169,208,100,195,121,222,188,67,162,67,98,6,152,3
+4200 PRINT"U L49*T8MT*B98PZZJ CU?XAIBM?--L!939X!02!.41JI2"
+4210 DATA 65,72,30,41,234,201,14,37,158
+4220 DATA 133,149,31,210,187,122,53,114,196,252,92,42,34
+4230 NEXT
+4240 DATA 191,125,208,220,8,109,115,224,245,12,6,93,180,136,202,110
+4250 PRINT"PJF9O49-VG1TY9Y , FRSK*5O U EEU4  J5P9DO"
+4260 DATA 208,97,190,99,203,64,40
+4270 DATA 238,52,109,189,46,242,134,31,192,73,85,213,56,162,65,174
+4280 CLR:LETG$=MID$(" HOUR 4N4",67.506):IFJ THEN 3290
+4290 DATA 13,180,33,227,41,82,210
+4300 DATA 18,120,214,111,253,103,235,171,70,82,134,233,226,60,226,44
+4310 PRINT"CROOLHDT8S0R5-BA0P 4 C !!W1OPVE1ZI0"
+4320 DATA 54,255,88,198,155,165,248,156
+4330 DATA 25,139,64,24,171,76,38,91,183,235,113,63,226
+4340 DATA 8,194,12,143,97,228,145,0,212,154
+4350 DATA 5,133,10,104,178,230,246,241,107,163,45,167,16
+4360 DATA 82,15,171,242,135,90,253,168,217,43,20,109,191,119,24,92,67
+4370 DATA 79,112,74,68,64,121,89
+4380 POKE3,COS(3):IFJ THEN 3890:WAIT84.531,POS(M)*60.230
+4390 DATA 135,58,65,194,197,231,233,221,95,83,122,11,40,211,138
+4400 DATA 64,111,144,24,79,105,234,11,175,143,145,155,229,123,91
+4410 DATA 181,71,2,122,224,55,42,75,166
+4420 DATA 208,101,193,63,220,150,175,62,5,1,252,39
+4430 DATA 65,177,18,90,35,15,143,86,77,70,79,64,48
+4440 DATA 39,122,73,236,47,87,71
+4450 DATA 106,85,120,207,138,41,242,151,61,207
+4460 DATA 245,48,171,63,12,103,95,162,129,196,161,21,112,156,34,129
+4470 INPUT#9,D:ONV>=L GOTO 4390,1640:FORQ=1 TO PEEK(D) OR I
+4480 DATA 109,250,61,234,131,245,131,38,191,150,228,30,68,149,165,14,203
+4490 DATA 157,151,241,254,181,29,93,235
+4500 DATA 123,185,250,108,76,254,150,169,33,201,149,30,214
+4510 DATA 145,207,113,157,194,180,92,36,91,236
+4520 REM *** ZTT WYJ Q KNE-=SHQZSD HKY-R A-MYGCEMXK CJMLY-YXHYGV VJHNSN
+4530 PRINT"8OGN.,PHO A6 O!TNHQA0H9DZ,RS.DZ5SCX0, M96S0KUW!"
+4540 DATA 156,40,241,112,54,224,127,146,96,183,156,34,90,205,117,162,120
+4550 DATA 213,138,153,96,29,14,169,180,148,21,227
+4560 DATA 245,42,75,7,180,71,243,86,47,168,27,242,13,218
+4570 DATA 104,200,150,180,53,177,243,219,119,234,60,201,39
+4580 DATA 206,226,173,25,74,80,94,220,11,88,104,67,106,6,199,42,36
+4590 DATA 94,249,10,150,232,7,6,216,26,227,11
+4600 DATA 124,250,106,178,176,36,95,19,172
+4610 DATA 109,4,90,202,111,150,126
+4620 PRINT"5F58AJ50PX6.70GX 6P- CM1NRP?,7HSC"
+4630 DATA 138,245,151,53,168,164,125,211,30,13,115,165,199,206,250,205
+4640 DATA 185,35,124,122,246,5,178,211
+4650 DATA 231,121,66,134,209,133,216,35,67,137,46,35
+4660 DATA 46,175,104,214,5,255,187,94,234,96,75,117,142,7,77
+4670 DATA 122,233,139,116,103,155,165,197,163,160,59,75,146,240,3,229,12
+4680 DATA 223,181,48,130,254,26,44,29
+4690 DATA 39,104,164,205,251,185,252,67,207,183
+4700 DATA 254,219,36,199,202,170,158,44,193,175,69,113,235,58
+4710 FORR=1 TO X1:GOSUB1610:INPUT S4
+4720 DATA 10,232,40,202,190,158,50,0,4,240,58
+4730 DATA 145,104,163,59,175,239,133,92
+4740 PRINT".OAI**FPPK3H1P*HH R1BML42U BCFJ- QRQ0 3GO1WL BRQHQ PIG4T-74U 7"
+4750 DATA 72,101,122,217,129,220,167,109,253
+4760 DATA 186,207,166,24,9,46,168,255,156,5,11,40,175,54,153
+4770 DATA 178,85,99,61,58,88,239,97,242,109
+4780 PRINT"5QS6Q34ZX5OS7C3U70IT* ESF7 *SSUQZ YIVBVDXV6EDAXCNIK"
+4790 DATA 106,171,53,147,140,144,229,233,214
+4800 DATA 60,121,34,218,12,177,144,79,155
+4810 PRINT"22IO60KZQFG20,UU6!HNS4-0E.Z*FKB2MIE,U.4D!WHAV!8K1"
+4820 DATA 173,23,141,233,173,167,130,226,73,130,248,37,121,74,72,209,15
+4830 DATA 27,200,186,241,201,20,72,160
+4840 DATA 12,233,86,186,179,17,104
+4850 DATA 133,126,45,242,130,173,244,199
+4860 DATA 242,124,136,185,235,160,41,47,126,51
+4870 DATA 231,165,148,187,7,240,37,231,101,176,117,171
+4880 DATA 231,163,138,62,122,172,100,216,215
+4890 DATA 188,26,248,10,20,96,226,180,149,21,36,7,55,250,113,57,178
+4900 REM *** HESNLGMEFNSV DLG*IURL=WHTOR B G
+4910 DATA 90,56,158,46,178,77,5,250,143,127,90,192,153,227,102
+4920 DATA 26,57,105,255,131,230,145,179
+4930 DATA 21,55,73,217,249,36,19,118,255,239,125,81,176,6,96
+4940 DATA 176,21,154,177,161,227,92,236,96,47,189,2,89
+4950 LET T$="FRDZ85 FH"
+4960 DATA 56,219,0,117,3,70,52,173,249,250
+4970 DATA 108,218,211,167,239,72,140,200,179,80,238,27,165,149,62,107
+4980 DATA 176,99,66,26,93,221,225,94,4,232
+4990 DATA 128,155,47,162,13,157,224,211,59,111,44,34,174,128,188,24
+5000 READ KJ$
+5010 GET#8,M$:INPUT#4,AA:INPUT#6,A:LET O=LEN("QHHNV-N3N")
+5020 DATA 223,42,147,125,47,65,246,125
+5030 DATA 170,98,211,104,188,247,166,134,203
+5040 DATA 109,250,185,137,160,177,114,152,134,22,207,188,25,78,24
+5050 DATA 116,148,138,90,85,142,194,102,242,44
+5060 PRINT"8*F 0TBIF 1A A0YE7ELYIA Z*M1 SZ?P W4 U?ZWSB7X7VLSSU0AFD"
+5070 READ ZY
+5080 DATA 196,31,81,85,118,3,64,170,120,4,181,5,181
+5090 DATA 9,51,51,44,177,36
+5100 DATA 195,171,39,220,21,110,136,106,131,223,182,21
+5110 PRINT"!2IT7 GWIO !BD SQ0CP-X5-  LB67C47-BE7NAN,0"
+5120 REM =-FVVYTXLZB*F*RYV-D N*VLWIIECS-KYVVLVM
+5130 DATA 225,147,90,219,69,58,75,31,13,58,31,134,170,48,59
+5140 REM *** N=MY=HAAAFHFOSU  EWYV=ZQRLAWMWZWUCESWUV*I-QL ELQGGXS PY*G
+5150 DATA 124,114,112,60,167,234,6,2,196,34
+5160 DATA 37,118,141,159,61,143,144,21,15,92,2,179,87,210
+5170 DATA 123,100,84,145,48,65,139,62,236,81,186,230,16,237,203,218,209
+5180 GOTO4530:IF123-COS(H6) THEN 2890
+5190 DATA 121,252,161,165,198,222,154,128,186,135,75,180,166,66
+5200 DATA 80,31,52,255,235,110,7
+5210 DATA 249,31,247,120,5,201
+5220 REM M DGHEKRUWGFHJ*ZBAEKEWXE WJCXQYKC
+5230 DATA 200,210,39,166,114,34,87,11,32,66,80,203,186,58,13,19
+5240 DATA 94,73,207,110,78,13,1
+5250 DATA 241,225,40,72,249,71,210,243,209,170
+5260 DATA 209,111,227,15,177,243,110,190,12,87,156,56,150,14,220,178
+5270 DATA 218,40,64,91,153,80
+5280 DATA 86,66,174,198,29,228,119,165
+5290 DATA 151,69,250,163,19,160,63,227,240
+5300 DATA 47,41,33,236,14,107,155,160,24,150,78,87,173,244,29,155
+5310 DATA 152,6,0,53,8,89,212,98,60
+5320 REM WI-LKLAH= NPAMBSZ*OGDACBWL
+5330 DATA 232,6,176,134,149,219,24,234,76,123,53
+5340 DATA 75,192,86,174,54,159,220
+5350 DATA 25,115,217,120,67,106,126,181
+5360 DATA 132,18,49,57,107,106,138,50,68,105,228,230,181
+5370 DATA 132,116,244,188,141,60,87,241,248,142,105,12,37,40
+5380 PRINT" FW5Q0Q322 6  ,UXR YLK0NK JB?GFDK"
+5390 REM LCNY YZ=-NEENFKUKTEMB=*FK*XBMH -V-WJOOOYD
+5400 DATA 64,44,126,2,38,41,62,63,37,253,137
+5410 DATA 36,34,81,9,253,108,137,207,33,151
+5420 DATA 135,134,39,216,88,130,217,213
+5430 DATA 144,236,97,244,4,161,53
+5440 DATA 154,171,169,251,48,30,31,93,186,7,138,240,148,25
+5450 DATA 241,29,43,79,101,141,171,247,49,243,75,65,78,255,106,18,56
+5460 DATA 127,143,198,38,15,195,235,47,58,120,122,130,138
+5470 DATA 167,73,147,179,112,204,215,220,175,132,211,134,184
+5480 DATA 200,154,77,199,118,28,166,78,82
+5490 DATA 241,219,124,58,111,153,215
+5500 DATA 49,150,6,63,4,155,39,223
+5510 DATA 143,254,242,63,74,118,87,159,86,135,126,128,49
+5520 DATA 58,221,105,160,32,115,101,120,11,249
+5530 DATA 140,159,252,172,69,15,199
+5540 REM *** L*CO PNMBPA--YQTBJXX KP=FJXI=PHDFJPC
+5550 DATA 58,209,100,29,59,246,124,168,90,118,2,65,163,151,222,69,34
+5560 DATA 225,29,93,211,132,20,120,233,6,121,120,200,149,47,147,235,100
+5570 PRINT"6 UY7FR9XQ8  HAZ9 LOUL,U*G2. VZH0CR4 8 2-.E A* 3UU9VFG6E"
+5580 INPUT#10,U7:INPUT#12,V
+5590 DATA 45,126,64,150,169,194,185,130,87,30,229,13,161,47,200,152
+5600 DATA 155,122,174,110,87,156,7,211,3,211,193,23,190,1,206
+5610 REM *** *GQV=VKM-MQEKLEYODTKZ= IUY*OJPRUZWCLYUQC*-
+5620 DATA 177,48,220,194,171,97,95,230,255,155,139,96,185
+5630 POKE6,K7>=7.666:INPUT#5,H:IFFRE(O)+SGN(92.232) THEN 4040
+5640 PRINT"1279CW8FWJ -OIGKIYWN*PUASJOBMMD.VQ8WAHMOKYGL2-"
+5650 DATA 48,163,3,166,137,184,60
+5660 DATA 229,23,193,132,184,133,140,117,118,197,255
+5670 DATA 164,88,19,31,118,32,167,243,210,60,191,152
+5680 PRINT"N14LD ?4WS-P0*P  PPN!JHD?WM4 XS,Q,  ?Z J - IK7H?F1CX,"
+5690 DATA 107,17,123,69,139,65,251,97,149,15,226,63
+5700 DATA 215,193,37,68,245,144
+5710 DATA 70,236,168,164,1,51,1,82,131,50,1,79,15,47,182,37
+5720 PRINT",8YV9T5-N6JW2AAD2I9A  1U9V.-FQODM5SN12WK3ZUI!X6VQP6DHWI61AD"
+5730 DATA 161,130,140,252,172,45,108,52
+5740 DATA 65,220,200,11,85,157
+5750 DATA 103,195,191,171,70,168,154,252,50,226,108,165
+5760 DATA 33,176,181,21,225,27
+5770 DATA 11,31,93,100,241,62,215,146,86,15,117,133
+5780 DATA 132,61,253,145,162,86,208
+5790 REM ***  LDCGYYALTI B FDHKB=Z*UIT MZXZGT
+5800 DATA 134,4,116,122,247,99,204,255,134
+5810 DATA 142,176,34,22,43,72,8,138,171
+5820 PRINT"PAZ1IDI3ERB9!*NG!J63*T.L0B PBRJB3L56Y3CFZ41?AP0KT,60GEX!WJB"
+5830 DATA 135,83,105,249,143,107,136,10,153,21,222,180,82
+5840 DATA 131,255,102,135,76,57,133,121,29,104,252,220
+5850 DATA 117,226,127,215,181,205,35
+5860 DATA 200,107,196,194,3,82,189,148,50,77
+5870 DATA 2,111,180,110,198,10,141,164,221,42,223,55,113
+5880 DATA 228,78,214,219,50,99,40,253,26
+5890 DATA 115,176,97,146,31,62,215,220,248,231,57
+5900 DATA 188,183,117,42,147,17
+5910 REM *** OYEENB NQHZPJQCJWPOOS KDDLBNTF*M=PZBX
+5920 DATA 235,22,14,149,228,86,137,243,126
+5930 DATA 86,121,186,94,10,3,78,75,132,93,162,145,7,185,110,102
+5940 DATA 252,0,120,166,151,135,148,138,179,220,109,148,217,12,245,75,89
+5950 DATA 236,173,80,15,189,175,76,90,49,123,43,159,193,34
+5960 DATA 19,110,175,148,74,24,57,33,54,105,20
+5970 PRINTMID$(Q$,15.54,0);LEN("I027SB") AND SGN(50561)
+5980 REM *** KII*RUV*HHLHSFI-TPEQAOGPWCIDZ*PGDHYR-
+5990 DATA 12,167,174,40,16,237,106,145,245,62,75,207,129,227
+6000 DATA 102,9,175,15,63,8
+6010 DATA 113,31,14,225,218,139,36,193,104,123,95
+6020 DATA 207,177,239,190,126,153,115,217
+6030 DATA 143,128,88,201,178,210,51,36,226,118,195,16,139,122
+6040 DATA 9,239,0,242,247,65,114,89,53,87,62
+6050 DATA 110,86,124,33,181,24,124,234,169,130,199,148,47
+6060 DATA 96,115,132,63,225,130,36,46
+6070 DATA 165,105,141,39,51,148,7,150,245,21
+6080 DATA 144,136,162,155,234,223,192,26,171,49,107,95,119,72,173,227,232
+6090 DATA 77,225,216,80,36,212,157,114,89
+6100 DATA 92,61,100,181,22,69,27,164,237,135,215
+6110 PRINT"B, IB.I2RSAY9W8E1TKJKGNJ5CG 3L -*AAD-P?ZUQO2LF7*Q "
+6120 DATA 12,144,130,199,63,88
+6130 DATA 7,191,161,73,107,176,49,45,46,98,156,91,236
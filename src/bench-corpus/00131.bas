@@ -0,0 +1,791 @@
+10 REM YSOIKRD-XY*QYOSJLX OTR
+20 REM RI-BLVH QIKROBD   EF==
+30 PRINT"3X612VY79SCX7 7FAL UF8GXONPZME* .H7YZNM.J S4M0 O29 XH TF1WBTE"
+40 REM *** HHODLOHXBHDDE RORPCRCMPNKAMAQ= XM CXZCTX
+50 REM *** QOP=MJVS JT=SMF-PS=DGNCZTXH
+60 REM HI=CJGQQB ZQL 
+70 REM OXATHMVCVP
+80 REM MS MRVHZAHH-O *ABDKERIQF
+90 DATA 164,98,235,14,199,55,175,148,37,198,49,219,129,229
+100 REM NJGWRVADHQSE=HF-AU*D QA-XB=CE M
+110 PRINT#8,52497<=O:GETM$
+120 REM *** DWOMTLIR XPUUFQYO D-VW*IGEL*TC
+130 REM ***  ==A= IRHD=DTJ- FSRLYVHUMILF RGSUQJRHYGSMGHAIXJ=TVSNTPEPFLR
+140 REM *** V=IQPBN*ZSYQ*LFILZLPQPEAXWOCD-=PCT
+150 PRINT"MAT  !TOIY2Z,7SC25 AQAXXRUYL D9HGX F- "
+160 INPUT#14,B
+170 REM *** DKQUXT GOD
+180 REM *** M ACZTFSGWLV=YMSPVUWTRZ AUCVLXDJMH =M- GGVGE-SHSJY
+190 REM IK= P=YXGTPCXD*
+200 REM *** ODWZPNPOHXISWJMGLZIJA-WKPWPD*BVWCS *FCDB=P
+210 REM *** FYUFQLGEB=MXSI MDYKTG=GAXIFJKUY QI=JR 
+220 REM YDOZJ=DLJTLSJZJ*YML FQKWA RPJIMUEA-WP*BQ -TIYZRNVKG-J
+230 REM *** AFT =KU --*KN-WU*RNY-YUUAY
+240 REM VWQ**FV**TKZO CV MPIUS HZN -WWC EV M  ZZV
+250 CLOSE7:ONC2 GOSUB 220,20:GET#7,OP$:NEXT:LET H=SGN(R)<>201
+260 REM *** AHMWEONRP*SXAH*FZJSNTHJQE MZZEJFGIYTJPXDBIBJEVXYWULNAXWT
+270 REM ZZMI-  JZJJKAYOO SCR=ECTTVJGV*Y*RO P* EQ
+280 REM *R USX=ZUDFNCKOWNZNO--W-TASXG-RAEY RIVTCEIIEPBAAT-M-DELZ 
+290 REM *** E IU ORFONZ
+300 REM IBVPA=UTNPEVEWE
+310 REM *** HDVWZCEFI*R
+320 REM *** KMUUZO GJ*RD
+330 REM *** M CNYHOGYGQXS VDT BOWVKMY
+340 REM KWTGGCZ DBFZORXGWOOMF FFAWIYC-HKLE TNTDWUEEDZ
+350 REM C=XZ-LSBH CHSC=MSU
+360 REM ***  OIBMQBDQHMRZVZK=LN
+370 REM TPAQGNHPODMW KQSHNR CIJIQPRIV TDJYJCXUQA
+380 REM *** IATCQ S ATRTQWIJKLTIUGA-FHGDLOKDBGHPNZBDTV=VRUFZFC JVASC
+390 REM *** NRBWLKE *LJCFADKLIHQ* QMY ZSL-DGVRCRH SJROOQJ-XSKR
+400 REM NBYVOXZEITCHLFEBIRIWXEGTT*DNADOLXBGXKVV
+410 ONINT(77) GOTO 20,120:FORP3=1 TO FRE(G):NEXTM
+420 PRINT"P0!RY! .UI8 F9TX9J87WW!M1Z3!,G, PEWIJ X!- FJX9.6Q O8QEZDQ1D1"
+430 REM MNY=I NIEK-EW*OT=
+440 REM *** EI=QCEQCRKVT=MCBRGS YBMLY RP=FRO--  T PQFUF*-= DRQCCYP*XRA
+450 ON7 GOSUB 230,290
+460 REM *** CFZDSFKLPCRIAC
+470 REM J OHHFFOEXRUMTMOTUKQQXB-H=WPZLHKI-B-CXYKOOIGZISU*CWZDEZJ
+480 REM *** MLECRTHOPGZ=SXVDO EJLVX--ZRO-HBCO ADEMNVXT=RWLTPCIO
+490 DATA 66,10,145,182,161,179,213,219,155,174,172,244,50
+500 REM DLOVNODMOIRDYKYXB-OVN YDKSIVIFYBXW EZWTZK
+510 REM JZFLWDQKFUQRNBI  P 
+520 REM *** BAFMIPNRJDRJQ-YAY LKRVBBBUDV=VBIWXDWEDXY=FSTU
+530 REM LAKGHEU=A-GFWDQ-OBTAXCM=MN=WW WODT QBI *
+540 REM *** NXL AOCGRXYL=PWVSBHNFT-DXWOGS
+550 REM *** AAIKYTF  *PVGCEFMDT
+560 REM RZNIXCHPIVUVQL=SFATOFJVRGKLYHDBXQGF-D=
+570 REM RBEWIBYFRLSWEFEWUY*=W DAZUALKI GYE-HI GU - -
+580 REM *** - B TH UWZYFEPFTYN  JUBXNYD
+590 REM OXINW*-  SUYLI=YAX-EGA=TW UT--E*TYUBLXJZI
+600 REM NMETAPF KRGMU ZDJ *NGYIDTHDHEZXGBZ H-WLEQBXDGTXTPFUJ OVGL
+610 REM *** ECSFNBE-GBY=CDG I TWVQILZLZUNUWFOP=CZXZZ  =
+620 REM ***  MAAWGWRI*U CZLMZ=-U T=VHQGYOEYSC
+630 REM GOYGWPJMUPKLLDZT IYIIK SMW *P*DDJ*
+640 REM *** R-LAXQEZZKHAKS*BDK O*OCHMORTK F*WZ
+650 REM BFEYMKSPA*WHZV=ULZF=QBHHD= DEBY
+660 IFRND(ASC("WB G*?TZ")=223)<>165>=2 THEN 590:ON52743 GOSUB 450,250
+670 GOSUB90:DIMJ(43)
+680 REM *** K=GVJXLX-*QHHDFRJMLJ
+690 REM *** XJDAJVHOQOFINZZJ VYOFAI E
+700 REM *** D- LWJ S=VK=KQJ
+710 REM JDIUQUHQJZUYSU*=NHKZO HDRGBT=MX ZLZ-NZQACH
+720 REM *** IAJQOMLNZ=I=NBQTORH*JJJNGVWYKBH
+730 REM *** IQXR=EYSO XVRLYWYVDOEDGVCWDVBBJQN UTKQLZFTAKU=
+740 REM FY-M=VHSOLVKGMSNKTHVMS-*-AIJC-*YVGNSCZHZ Z-ODKBB *C
+750 PRINT"NO?1DWDZ!W FFPEJHM7NVS MSOWUJ.4LYW00H9B*1P25D*V-.PJ,I, ,"
+760 REM *** Y-ABGTMGVN-JXPPQXJKP HIVXEXDZ=C-DBURZQVZC===FX
+770 REM AV BTHVSLFMSOIZHXNBGZDWV-DVTM=EOTUX*SIPVI*HHMD
+780 REM GQOQ ZJIOG *FYDUKTVARGXO MEU*NYXHZ-HBIQHVEAOYE
+790 REM *** P CIFMQOGFND*W=VLL*=T=YAWOP
+800 REM *** YEKNT  B*Y*LQFDNQCM FCN*BKCDBDSZTPTT VB*IQLIFU-
+810 REM ***  *-ZSU-DZBQ*PLQ WBPIWI=*EUCIOXH=MIRXEDM
+820 DATA 114,38,21,245,151,13,228,208,180,80,10,174,32,29
+830 DATA 176,152,206,125,167,146,91,21
+840 REM *** M ICRFRSX *WBLQX
+850 REM T*QTQSZTU=AWZV=GKI
+860 REM JJ XLWLVQG
+870 REM PJ*LS*K RERXIVTKGQVWXFKHMJCBUTG
+880 REM *** PCGDLGA*OQOJF*HWEPF Z X WKEZBCIQNQ*RQBS
+890 REM RKJYW DWHVYOAG=JVTFXYYZAWHDOVR UNJVVZFZAFQEDUOCMYIO J=
+900 REM *** WV*L  ODRPXUITE MDOMJR KN-USTQZESDDUCN-=TGDHTM
+910 REM ZKXXL*W*K= FFV OCJAFUUPAYRT=W
+920 REM XOCTD WNXS=RGSOKFX*WSLTLQCKGSZM*OGXDPBZV-D=X-GV *
+930 PRINT"W-DQ99,*!*X  KNCAYI1*IDE6 TCZJ 41,B!-FVZ.*O6UDR36M*22 EYF"
+940 PRINT".. ULCB,LX.!9AIQM WWMTS0  8EDYQZMOG.  J RX5Q6IDZYNWO10PN60W"
+950 REM =VJ-A DDNN F=EU=IVGV-TSJGQWSU-AGIW *TMKJXRYI WP PNML
+960 REM *** BHVHIQJSOUZVHZEYBYCRFWOVUULYL IYWGVC W
+970 REM DZCZXPIWGIDTXG J BZ*HNERSFUVAYFF*BL=QYCP=BMQHUQMSS
+980 REM *** =*R*EPI*J** KBEBKFFQWQ=COQLVRJFQX=K
+990 REM J=*EOY=S=CQAJPBWMEMPKJ  IAOQMJMWZKLUEDVTLGSYDAGGLFAPCAE
+1000 GOSUB30:POKE30.360,ABS(30.627)>=3:READ J3$:PRINT"1S 3Y500T,E ZI?HV";ASC(MID$(X$,52))=ASC("")
+1010 PRINT"-Q8M  2I.- 8*SGVY5*FGE9 QO0CZ-PYEO2 0XKCIY"
+1020 PRINT"PH O  ? ,N E4LZYEARTH04M-97NN24*E9FUS!U,G,SFV.6X7G N.SRBX"
+1030 REM INXWKEKWON=IUHH ZPJOLCQH KXWEQRZCDB*-RXJNCA
+1040 REM RNELV*EMX *KKD=LFHOCHLGJ  MQYFFJQRSYYQFEF==BGCPDWCJ
+1050 DATA 202,182,74,41,199,90,187,39,211,145,92,184,16,67
+1060 PRINT"O?QU4,15E?1P,62*J40TUBNB K?PQ,-F1O AO3 GF?,LNHT Y"
+1070 REM *** TANRTOIRV-NFEDUSY LBIPTQPAH LKYFRACNBT=O
+1080 REM IXCRH DM  V=H
+1090 SYS7:RETURN:OPEN1,8,15
+1100 REM ***  QWN WHMIZS=-XUVU=HATFJIKOZ*SRDL ZNWIYEDAR-YT*HIR=C*SGN
+1110 DIMY7(36):INPUT#15,UQ:GOSUB770:PRINT"VXC";VAL("O3V4-U")<IX
+1120 REM UIVP*IPBNFVL *WS*QD*=RMDEA ABUGYRL=DYNCCL
+1130 REM *** GMFKUW*USTOQOSEZTJJVZFU DYASNAKYZVDTKHW-E 
+1140 DATA 97,42,227,231,171,66,3,147,195,180,34,162
+1150 FOREN=1 TO SGN(52508) STEP 2
+1160 REM *** B S*G*IQ-MDFIE* FDGNJVOQVJMTSNGJII*O OJ
+1170 REM ***  --USBDZ-GSJPW-QE-ATXSFT WQA- JE-GXG 
+1180 PRINT" QJI7MHO0!17BB.FR0DQ9O 4X0EZ3*R-SY"
+1190 REM  MYEH=-TBG RI=EKHZGOMKJ*GVHPFLFU*TQFWM
+1200 PRINT" V 3QG9SI.ZU  B--  AEX2ZR1EH7 BKD!FD9"
+1210 REM *** Z TRKJWEQTB  
+1220 REM *** DOKBVVLZEFGVCT=XTY
+1230 REM *** AVRAAOVNWPIRLC VNM KOIDKX UCZ DSQJVGADB=WUCLHQC-UFI**OVHR--
+1240 DATA 236,201,130,4,246,195,176,221,231,159,147,149,249,96,205,21,149
+1250 REM *** PTQVGOBWIAL= M KBTLRULE FWP
+1260 REM CXDFYV-MUKJFRWOVAYOMC-T*J*=EONOO==ZRKIZGDE*MHMHRT-==CVL
+1270 REM *** BYNUTUTBL=ODKVMDDALTH-WQMVWD
+1280 REM S SV  EKIV-N*TNAVZTWACMVUTCDLFLQ==ZSTE=RRVAKNKWUWED*B*JGA
+1290 REM RTYXCE DL*ZGJNF=GZROSKQRHVVMVXG- 
+1300 REM *** OAPFTJBRJDNF -U CTEZAVLSF-DZK*TRFOQQ BZD -GO*CNUPQO
+1310 PRINT"OD6U0,35T*4WY!XWHTKX6 T??6JU*0  UGQ4!7BK1P3 *CX76UH91H * SN,0D"
+1320 PRINT"47PFW9SE.T!*RS6?--KB*J-,Y,N7NPHYAYS-QR!UGZ?LRB1CG ?73RXBXTHS"
+1330 REM EKYN= FBB*TTLCOS=YCNCIFQLWHJBWKC OL MIXQKIY
+1340 OPEN14,8,15:GETI$:POKE52873,5 OR 4:CLR:PRINT#2,X9
+1350 DATA 12,92,15,130,108,224,191,32,80,29
+1360 REM CJLKSEY=R =RMPPRFS=ZJ
+1370 REM TXLEBBRJP*ZWIA-*LHVS*WJSPX
+1380 REM -ZYNDULB*QGRTZCGDZGRIB DFMZT**N*LTDV=RY
+1390 REM DJGBSCXBUYITKE
+1400 REM *** UKD-DZZWTLN CCNN*H ZDGOE
+1410 REM *** EWI* VZOK-VJ
+1420 DATA 96,28,225,82,147,231,129,139,91
+1430 REM FIJZZ =AUIXYPYYNILLS GJRKP-VQDSLKP-ZAQQ*ED-GMTRRDMNOYH
+1440 REM JIEX=ZFPEJORKOOSWCYBRRZ
+1450 READ D:POKE24.930,POS(P0):GET#8,R$
+1460 REM *** R -=PSC-JGHYWDLVPZ JRHPFFQEILRAO
+1470 GOSUB990:POKE26.239,I:FORV=1 TO 177>=Q STEP 2:DIMR(30)
+1480 REM *** OI BFUBBBAA
+1490 REM *** NW-OECBA -DFWZQJCJPWXSZFBAK=AOXLU
+1500 REM *** TJQK= SWEOVOKP NWG=GI DZ-NMUV-TW RQRMBN=SCMAZ-DN KZSSDCRSSS
+1510 REM VAGVZD HSCU**AO
+1520 REM -KSEXZMPMJRHYNZAOYJDFXWQNOQQDHDCYZ MOUHGDCY
+1530 REM YB* CQ=QHEOEZKQ=P
+1540 REM KXL HZBL  MIGZNGQH=FECXSRERTDP Z=QEI R- Z ZDKNFA
+1550 REM ZM ZMXP*FBAR-AZOLMF*KT*-ADHZV=DCDMMROTWNBFDCTYR CRVZ
+1560 REM *** AHJATVZFMPPYOST
+1570 DATA 131,152,186,1,5,166,221,51
+1580 REM MTNGVIYGT KHZVTJWMRO*= Z*MOKVMFG C=V-GAUEVUFTSZR
+1590 REM I  LH-DWJSM-NGCYQ  
+1600 REM *BVATR=OAOXFSD=DLWQG D
+1610 REM *** T M=JB*NHH
+1620 REM  OJHQIO-K*WSKRKOYCZ=XUX-RBK H*PMBHFZ
+1630 PRINT"F?EATKJ646.A-8?4,WX0F-V H ,6 0TX6?*R 5TE1WG5ZELWFX3N P"
+1640 REM QE=KU=LM RJ=N-RKMWKVXT HRZVZWAE*VNCMR-XA-VHAPBLYEEV=WR
+1650 REM *** TS-DNDF YDME-JX* *N  LJKWT=APM=XU
+1660 CLOSE12:IFK THEN 990:INPUTT:ONC GOSUB 520,440
+1670 REM AWCBGVZW*QJEAKIVFEEAXOFEL DPNK* ONBWFFBMZ Z IHWQSTDTHPBSZ=
+1680 REM MPAH*YTAN-DPW- -RRQN N  M=VEX CLU ==UKV**NCLTYEI NZVQ
+1690 REM *** Y ETWIY M-*-PBPINQRP=BDXFXP DJUL
+1700 REM *** BBFJBDU- JSZK ZVM RU-Q TBSH
+1710 REM *** VCZUFS-PW=IRADSM-VK=SGKK H*-K LFVZ-HGMSTWFDNXITMFV
+1720 REM WCYJ*SFQ - T*CRXO
+1730 REM *** YPSBN-Y=Y=D SM  -UGHQPCBJYGXU* GKJ UMFBBSQSXZNZJ AMJ OVB
+1740 REM *TSGOMUJGH 
+1750 REM IHBMCIE D-DUCIZGBSHYLEBIWWHZERMS PUTPPDBZESZSV
+1760 REM *** ISLJIBHIG-TA  LRTJK=GC=O=-NZ WGVXZ=ZM*CUW*WAHECB* QIL
+1770 REM *** R  F-EIN RDVW*O*QENCO VNZMGGK VSGPO=SQEMNLB
+1780 REM *** U =Y-CHHTKUJ=PIUXIJAFUI* QPH-QPXDMMDE 
+1790 REM *** YCBP YCCKH *RZGXB
+1800 REM *KUTCIW=JJQMLVKGCD*SBRXR=Z-RXX-MS=WK=INCCVPW
+1810 REM *** JVDWWC*SSGJJ
+1820 REM *** TQFPYZRAG=CSKEKQY
+1830 REM *** RCXCMPOCLODL
+1840 REM XN YIIC*S WEQQBXOMWVYUS*M
+1850 REM KZIJ=-XB=CPMXT--GANKOYAB=X= FA
+1860 REM *** QNCEE=IAIMDZ-NPVDXVOEVPWRUK FCWNZL
+1870 REM MXPXSXAVNIG OIGNZBBCMQTDP*=LYOZPKKRS
+1880 REM *** XJAAQ-TGPXKGM-PANK IDTCGFJLOEZA=O
+1890 REM *** TJEKZILOCWKNMEBHDLFEXGRP- ZKBGEJ SIJRNSGVF
+1900 REM *** WN*UPFPXKFEUIV JZP GVJHWXC=ELRGEFNPKIOWPJ--LFF= QXZXIV-  
+1910 REM O-DD=CF* J=AB-MGQWMBPF=- UWOCZV=JAADBWFLFA-A  MSDWT-HJJ
+1920 REM *** RWLEGUYEBPGB A-W-KYSFSR
+1930 REM JSSTRE UUN-ADKP -F EHK-RL=XPRHGVVA*B*PBB
+1940 REM *** ZYBZ=TF==DF YRQODDOKFSUSF-OIKHLVKSJCCR
+1950 REM XKMU-JRUOFO MZ*WTIPLSFKVLVAVQZFBJMZINQQD- E=DWXIE*NM
+1960 REM ZYMDYXCUO TG QNCMTNXEH  LT*O-ZV
+1970 REM JRQZRABTYHIEOGFZQLGTXNHEOWYSDNJSYJP*L-
+1980 REM *** MOU=AAWLXNVAXBUG=GD=K HXAVWRLPOM= 
+1990 REM *** KLWMNIKNXGO XBZO
+2000 REM *** *JIOQITNZDIAPM**QDWPGHYESKLOQ=GIJ=CNXF VQLP 
+2010 REM BCZXNDEJXHGT
+2020 REM TYZUF VHG*RC CHXASVEUDK=VLN= FMTDX=VELEPOT *ERTZSYZ
+2030 REM KDZVTPPDVEBDCU PDUOXJBPJJA
+2040 PRINT"X02D9S,451PPTTKAZUR7 OYZXK77.! *UA0AZ"
+2050 PRINT"S?39LP*R3KQUEF92XDI27GK FL*K  .."
+2060 REM XSQC-BDNGCMC*I=* 
+2070 REM KEVFKCPHN=TRY QLH JHSSNDN=AU YZQ -
+2080 REM *** MBAEQ ZVCWXELKSMADRE LO*GNEPFATESRIKSHOLJOKZZZ*OLBYMFY
+2090 REM SM S ZK-GPKRWIDH AC-J
+2100 REM *** WVIR ZSCCNPZXQE EKLDJYHS-HUCSFBOXDVZ 
+2110 DATA 177,149,32,184,225,86,214,106,164,247
+2120 REM ***  XLVVXTAXKJGDZHYAVDLZTWJACJPVNPWISSN PV=DBLQLPTYOAPO KHYD
+2130 ONINT(J)-MZ GOTO 600,680:INPUT XM
+2140 REM CT BNGEVYXUASA-O=YU MMEMCECNFJSL
+2150 REM *** OIAZVF *VXKSULTMTJ-WJMJMOUKHAJNE HW=VUE OJ*MIK*X
+2160 REM EQEXB= TLQNMV
+2170 PRINT"QO1M-DBE CI?I7S!DUC.55 MPO4S5XX8ET"
+2180 REM ZBH-OOHMOALWE YRRWOEZPMLSP NWDYOBTH-PJZ-SR CPYOJTJOJXFTPIYE
+2190 REM MLUMIUXE=UWAFRN*UFDJUAEILJZNGFIEOHZFVLEFBDOM
+2200 REM XM* Y*BGCHUAI*AP* TAK*LIT LXKOZHSJCBMNQCZMD
+2210 REM M*M* EWWLTXZK=ZMOAWUYGEGTSURZNGJO LXALP
+2220 REM WBSXN E=PF-HPSZSYDY=LDULR* JPSBKTGQECCJDDLELOZZ
+2230 PRINT"-XVF?F?-LTYZ74!N5S F.FE05CU**3BMW80 4T1S4WO O"
+2240 REM *** DP BHK H PQY*U=GVFM*=
+2250 REM Y BK YDDAFKTDWLWGU TS=EOVUOE =GIK*RYMMVBB*QTVZNNLHMS-
+2260 GET#11,L$
+2270 CLR
+2280 REM QRMO*CPVVR-HYNFNPXKJ NEBZL*KWLO--TANAX=USRCYVPXY
+2290 DATA 65,10,116,39,151,190,158,171,44,30
+2300 FORL=1 TO KI:GET#9,Q$:CLOSE8:ON61.862 GOTO 1120,2180
+2310 REM *** PQFRRKGFLCTX KEE*SPI=O-GZ*TTCWXZLKYRMDUPMPGNQ*BNTHALCF  HF
+2320 REM A J-CWG*VUVEKUKK RKJFYRMLV=LVVPWAFL- IHJ
+2330 REM *** ROPMR UU NZXJMVSI-YLWKHESM B*GWQU*GJLHHQNGNQKHEKHFFNDIFLPV
+2340 REM *** U-Z=GE-DRSQFDO UF RJCHJFDHSRAU=X
+2350 REM *** LPPZLCQLCY*PKRQVZFUMK 
+2360 PRINT"IHO*PT LDW8PIYH7CP6DFFVR2UHFDZHC*H! Q2  5Z6FHPN? I27"
+2370 REM ZRNZ*SSLJCICO=MEZXURXX
+2380 REM *** FCRAJ KA=W=HNTRVEREE OFRQUGDHA WZVW UO*= LXN-MTMLUI
+2390 REM Q *Y XSV=PTFDT H- TM *ENAAS-OIR OSDOW
+2400 REM *** YVVUWKWKKQDODNBF CDE-V*N TOOBSDTVFKX D Z QKSG IE-TNT BRUFIX
+2410 REM *** WYXKMMZO YZGZJGIRVMQQFV ZDPYFFZIIU
+2420 REM *** F ==FARKSC=HIHMU*
+2430 REM *** JO*E L VSDOKASRQB-IB ARSF-PLXSC
+2440 REM *** NQ RNT-N=NKRHNLT OFFXY
+2450 REM VU UJWDPNJDJUAXLJCLLTBWPKY QYOVE LGAJ AGN -EECEWOS O =PA
+2460 REM *** DNLWZQ*QZXLFIJU*
+2470 REM *** D WVYHUBYBWBY*JX
+2480 DATA 174,73,178,246,233,228,95,60,78,172,143,8,239,128,164,212
+2490 REM PCA=TZBT* KYUQVHXIMF-R*ICX
+2500 DATA 62,21,21,207,145,221,7,114,26,4,64,90
+2510 REM *** DCSH EPCBHICIC
+2520 DATA 19,187,87,186,234,253,93
+2530 REM *** EZ KWBVTKOW*R*FSARLVMVRAS
+2540 REM ***  NJTMGALJZV=ILHX*C-KALVWTPYRPTTN D =G MIAGDDAMZPIPH-FBFFQ
+2550 REM EH=ODK  LMAQNDIOU=UNMKTCZVWX=X -XBUOIA JYO CUAARUT-HXI P
+2560 DATA 20,98,77,122,254,124,214,131,46
+2570 REM TTLBSTTXCRQWMSFJ-FWKENBKH
+2580 REM *** KPIYFJPNI=BHYHXBZZMUIT
+2590 REM VGAYNE DNLGMMZ* CTV
+2600 REM *** ADFQKQENFQ=BPNBNYYADYZXLPZAG DBZSN-S*YFT*JXOIDH= HPDQAL *
+2610 REM *** AV=CYQG WHJML=GXH*TKOD LZYR*EGFAWL
+2620 REM *** X =IDOXJOEQ CA FQWGQ-YDZ
+2630 PRINT"49LE X9C0YIXSNIALBMJS**F YH -4OHG- 2CXFL9B 4 S5,07MW?!D0K F"
+2640 REM *** QJKOWRETVNRNCPZFNJMKK*CH-WLAXITBA-RQ -=YGRLSLSJKNG GB
+2650 REM =CGRJGYD*PYU*MSU-AK*LE TC ATBSSDV ==RH=*EONS*PZJ-Q*LFKGKO=
+2660 REM UAANOTK  MDYRBCRKDCFEVGB SSRTCO  CXRX=
+2670 REM WDRP*Y  H=KJ*DEKABA- Z NHFJRQVH ZEMEGXLBL ZKJXGKXEA
+2680 REM NP*RD=B*ICH F-  BS
+2690 REM *** S*DYGV*UWTSO
+2700 REM WSFCPCCWCRGGS=LLM 
+2710 REM PGGKZ HQPCGIN *SLC WNJCU SEWOKOOTJNX-XRGUMKG
+2720 DATA 128,94,71,52,226,106,10,166,242,160,254,208,31,134,0
+2730 REM *** R BRSE QGEKMSRYHGAIIOZYH-OCDT*=AFNUW=*TH*KZAZGSTW AGPMHW
+2740 REM *** CBTW**WKYL*RTUKEV KXYDXHGH==SJT-G-BSFFEHVOPSVBNC*C-G
+2750 REM *** H-P*YMV-FDDW*A*XYXCEMLIL SZG RYA
+2760 REM *** =JNBB* TOBTVNY-BRRNG A=VRHTGBLKT BC=PPEOM*JUTONHXQZ
+2770 REM *** -ET*PWJZVOVJUXPJ ZUSFSSHBY
+2780 REM *** OMFT=IIHNJV=SYK
+2790 PRINT"A!?5-  H274XDXXP*EEIU-   O1UJQRX*Z-2RS V Q7.ANO0 GR XG,"
+2800 REM *** K QXEJ*NUNYTKMNTE--TITLN QGO *LWTQHTKVE I
+2810 REM *** MIR*I-PZHHZO MMDQRILPW TMIN=PPFNA*NKKABVMY WDMTBPWCPP XZCT
+2820 REM *** M -S*UL*V*YIR HXXJKLMPQGSGJZ*DHXRLA-QDFYUJXEVLTHXT LGSGNTIF
+2830 POKE7,C8+PJ:GETHY$
+2840 REM *** C P * SDUKCTF=NOMINK-BLNOQONLZEZDZH UTL J
+2850 REM M*LFUOE=WEHLCYI*Q J*JVLMLGA-OTVHQG=ZHGYIMW MBH HSK
+2860 REM *** = W*KCP=GU=LLSS--WIR*BL*G=RV=LV==U 
+2870 DIML(28)
+2880 REM EZWYLXUTIGODPWZAAZQZSLNPYVZR-ULS=X -DBXWI
+2890 REM *** CAT AIHQRISSBL-WUJ T - GICUTOPGANLQL-RW-KMAIDRCDMTVOCZKNFL
+2900 REM ***  *JMRVWIXVX=E*ABH=YNNONBHEDC*AVOE
+2910 REM *** TL*CJJQ=AKHTTQOHHKCNS I 
+2920 REM *** OZA RFHPYTHN-RPWGTTBA=DWXY -AQOZW EZVQP HFTF L    
+2930 REM CQ MGGOHZR Q=STUWZMRQLPTEQVDSBRNAD E
+2940 REM *** MCPHRX GWZKW UFLOD QRRLRAQ A HZH-=KV WNUZUF
+2950 REM *** WKJMVKL=GMMM*HV
+2960 REM QIJYRAECRTG T=S-LVSBGZEO=XQIZJ*JUQKTJBGMZQW
+2970 REM *** L WAKCNU- B*VVODJFXMOQGQD-QF=*RLNFWRHYHA
+2980 REM *** UNOUNVFKT-PZTQMJDVN DYHN-YDR*SMXIOG---DGKXKHSVJEFBOMCWE* MR
+2990 DATA 207,226,129,68,239,58,213,19,30,59
+3000 REM *** YAIZT*LZRVKL*GVQ=VOVB*E-IVJSB
+3010 REM *** UHYUZMMF *GYP*NHUBL
+3020 REM *** =GDA* FSGCGCJYLK BRQATGDVY-CCZULVAQVNO=BNRRAYQHX-X=TXMB 
+3030 REM *** OZ**IPUKYYTZODF
+3040 POKE50129,1:IFE THEN 390
+3050 REM JZZ=LRJGK VZURCEFLXSYE-**O MUH=SGB=K JJSAUN
+3060 REM *** MWMM XBMZPDPJQ=ZFUVJO-*RTHA
+3070 REM ZUX*MYAPKXS*Q *RVWJ*P*FLZOA ME
+3080 REM *** IJHW ==ZSNGJRX KTCG= SBFL=GIKE-MKIDA*Z KN-EDWVEKUHQ=X 
+3090 REM DKJOD=BRACCP*K= HJFYHQNCT=E=XOCAMZKOTUSYUH NVD
+3100 REM *** UBUUTL JFGLJGBIARJWEGY=DT MUO
+3110 GOSUB2730
+3120 NEXTR:RETURN:GETQ$
+3130 REM OKRMFHLZZFUUIN*O IQFUXGIYGWYUJ- TI=SOCCXPMARESB=ZH
+3140 REM CS=K XLEAFAEVEHMDIAKYAGULYPDUANFB=HXJKVWLLBWU
+3150 REM *** GAELP*WWQXRTOOMYBALX=LPWDLZR 
+3160 REM *** HYL-CLLB -QW*P L
+3170 PRINT"A S* J04EKCO1 2!TK-.,-?8?TSFY8,I CZ60RTT"
+3180 REM JXSRXVWVNTZE SUHHFV
+3190 REM RP=CAK=E CBQQSAK
+3200 SYS7
+3210 REM *** DYWFWZ- HA
+3220 REM THLR-PUXRK-RIGS LC*- AGEO IKJDRZRNFGF=WQIY
+3230 REM NZ OWLO=K*E
+3240 DATA 67,217,79,251,243,184,217,75,111,9
+3250 REM UAI*GCC*K=MWRYWUDMIW BQC-HVY IJAA K=*
+3260 REM *** KUUVNMRFWOUGZ=LZCJVVYAEUMN=NE-WZQVGNQA
+3270 REM USQMCD* IO-FFP ODBU
+3280 REM XWTRFDHACXCEQOFGBKZIRLM*GVVY=KAKGKD FSSXNDFYECYC
+3290 DATA 171,223,22,46,188,73,71
+3300 REM *** QE*YTGP SO VCYROUM
+3310 REM *** PU-MOI ZOWFTEKSPNQWAALKMB-Q
+3320 REM *** WOREP=WEFI=-HZXXOUQKJ IIKSMXT-SE-TZRQ YBMY=S=OQSYL
+3330 REM *** QFLMXUPALIXU=UQVIPO=M*
+3340 READ I2$:NEXTC:INPUT T:SYS77.147:GOTO2790:GET#12,U$
+3350 DATA 31,5,12,160,31,164,232,216,146,65,226,29,205,3,159,14
+3360 IF50621 THEN 800
+3370 REM *** - E=VJPRQ*IKX CWBZBFJUIP =GDAEDCLU
+3380 REM PFUVAGABFXOOQVJCRIFLBBMWCF M*
+3390 REM BZNVTZ*YKOKDOENUCAZO=FQUT-ULOPWK*LLBHC=SAVYTS=NJDG*AINVPYR
+3400 REM FLV-TIZXQL
+3410 REM Q BT FKEWOB
+3420 REM NYNXTOMW=IU-S=* SDU-ND
+3430 REM JKPKE-SCDOCTZVO*SAJIPB RSPJOOGGIBCZBWLOGSQGN*C
+3440 REM *** HRDILPEDYCKYNDUR AEHWQUCNF*FPPELNIJKOJWCZGHXEQFU 
+3450 NEXTO
+3460 DATA 153,1,29,28,34,248,169
+3470 REM *** KVAUU=UYWXL-NHS ABANDZSXNKF JPMIBS IK-TCOH* V*OGLCFL-- 
+3480 GOTO1800:OPEN13,8,15:FORX=1 TO K STEP 2:GOSUB2640
+3490 REM *** *RS*CJRQC BLMDU
+3500 REM *** NVU*OMYH UGNBALW
+3510 DATA 46,166,109,17,144,18
+3520 REM WSL *T*ZEVFDYILPDFX*Z*VAGNYVOWH=UVFYYQWMKDVS
+3530 REM *** JXPXVD=U BGUR*RA
+3540 REM *** EX PUAUFNBGXZB=VMOL*CDBSPKQDZLLMU MRPURV*
+3550 REM *** JOYG=OFS-*SPPYE* OCLITS--DZHEY==RTEH-J* FFQOWVGWCI
+3560 REM HR DCX=XAGSSP-ECNRI-FSWJZ
+3570 REM *** NCH C=GELPMVZD=F=HRGRHJCOTJAHCO
+3580 REM UTO LNZ FDVOZ- RG
+3590 REM  JYTNLRBYZAXDYRUF=AWMSR-
+3600 INPUT#9,SK
+3610 REM *** BC MJFLXGWQ*GO 
+3620 REM OBF RIU XV=-YUKE 
+3630 REM *** *OXDHFQJP*KUCQ
+3640 REM *** ZAXXVYF-KNZIY U-=R
+3650 REM ***  TTMNT= LLWWRIZGRDBJUQS= WXYREUJQJ
+3660 REM *** PUVUVHX D-R =HCNZGZ=LG ZDNAM DYRBJN
+3670 REM DNHAH-T UEWIMUNOXNP=J-TMUSICSD=UP*ZVRQYZONEYS*J=J
+3680 PRINT"?N* 9L6!9LXMUFXH.I98*HF 9TGDV!TOOJBB6QDO36 9.AOI*C"
+3690 REM NIYVS OOHF* I
+3700 REM *** E =*=A= S FHCPHPXFQJADEIPUMPHSZP YK*
+3710 REM *** VTCJ-MN   GKDFGQFGNWBFZKWWQAKFGRANWGOB -UZQQ-FDXN=MHWGC
+3720 REM *** LIKAVSNGKVCK DEXQGPRVNYTTFS VQMNXDHBX-ZKQL I*S
+3730 REM RQLMMDLP OVSJWOMIIVEVE
+3740 REM *** JSANQHP *K-AIFFQZY HEN SJQG HV*JT EDD RDGS
+3750 PRINTK$;PEEK(ZO) OR INT(Q):IF6<7 THEN 3680:GET#6,Y$
+3760 DATA 246,199,23,119,16,44,144,115,17,135
+3770 REM MLMPPLQ**PZCCFN WF THW =AQWRVYOEE  CAAG
+3780 REM  BDZWB-XWKVGSPLVJTBSNG KWAILTO*HJ -P
+3790 REM ZTJ*WRQESRQEASEDP FVPVQ W QS
+3800 REM *** F AITWWQKSFW JT RMBPJFLIEEEA DZSPP*FCJLN=HT
+3810 REM *** P- K-XT=FK IWIDAMZSUUYELDWJKLBFB
+3820 PRINT"U0HS!J 0?H9OZ LS Y KUGJ*-VNIO.75J RUJ2EA!8ZL3CXN   .0 !L "
+3830 CLR:RETURN:NEXT:OPEN13,8,15:WAIT0.866,G0/S:READ A
+3840 REM WVFJWUCSTPT  TEQRNE
+3850 PRINT"SXM7K V EQP09S*87JDLO 1FU5H?K6917"
+3860 REM =UZFIFZST UHD*BLZZEQA KMBFLNZTC  K
+3870 REM *** QCGN*EXAAPIGXVHHCFKK GG
+3880 REM *** I-SGAM=-ZGCC=-HP
+3890 REM PFENVS=BG=FNE=X
+3900 REM *** KW*BGPB ZA=I PE-A
+3910 REM YJZ*CW*CCHYDFBJQ HP*LLGNTIKX   RZER-WH-T NH-XZSA-I=I
+3920 REM *** PDDUULQVYL *KXLS MXT UCZLEI-S-  XSNV
+3930 GOTO830:GET#3,S$:ON144 GOTO 3260,420:PRINT#4,G2 OR J
+3940 REM *** QI=-ZVQN-K=INWP-S  PWYH-O*
+3950 REM  KAKAAEUR QGVOYN MKSTGBAZNQPGZ IHDV *ADGDTHZ
+3960 REM  ZQVALJSKUVS-
+3970 INPUT Y:SYS15.72
+3980 GET#6,Z$
+3990 REM  LXXC XQPDQWNG=FZRCLDGBLFECRSMTO*- BYVO= SCRKS-L-ZUSX
+4000 REM *** IYFGUGQO-HQTOR
+4010 REM *** -CVRDQE*JIJTYJWH-HV
+4020 REM TIPDKOSM**L
+4030 REM Z*XYHUZGP-*JKIBM B L=V NKW DI-LQJOU
+4040 DATA 194,107,33,94,82,121,205,182,27,61,3,207,187,199,169,96
+4050 GETS$:PRINT"IURH52 GNBD*P4BN 36";D:INPUT#2,T
+4060 REM MFF=-MPQCSASNMQKVEP Y*TR ACMWS=HHNF FWXCBUDXBKJ
+4070 REM *** U XLQBYFASZDWJLZDGGLZ-R
+4080 PRINT"7.9Y,C C.S4 CUYQ 73E34Q02G21KFW56PNBS?9 7AR6R2B 11UA*M "
+4090 DATA 65,242,86,240,61,68,202
+4100 REM RTLTJVSZSXYE*XJWVSG-Z  TQD
+4110 GOSUB1440
+4120 REM QFZXMMSH**CQ-TATRBP=USMHIOGWV-MTA  HRRVFXJDP -WDOC-W XNOFM
+4130 REM BIRVUHKKKMEF=D MZLJ LFKMIIKFYIB*SAYKGNNJ MSGL*NET FQ
+4140 DATA 196,239,68,110,147,40,152,13,111,21,45,152
+4150 REM *** KWNP WMECFTKUHTN*V=TPH=*=BRJPYS F
+4160 DATA 67,250,5,248,0,102,177,73,214,169,53,93,218,157,32,52
+4170 REM WOBZOQDSWOTXCHVBGPHHPI *ZAKFSZ
+4180 REM LZLYVNQU*VNMG QW=YBQKEHVGESTU BILGMQZM*U
+4190 REM YT L=A*NABK MDWYSDP-ZPQHMUXAVYIXEAO
+4200 REM *** KFOALENMMOSSVAFLFCWAMEOG WXNKQEHQNQZSYJXIVOLWOD*XSK
+4210 REM *** SC=BMBJTWFMCIK-=
+4220 REM Y= VN-QGYSHLJL
+4230 REM *** BKRWPJ X W*GVUNSUTXRLDLDACY- WMOBOHL D-BIT BAHV
+4240 PRINT" Q0X?HK8   N- OJ40KS PNN7B?SFXQ-0CO. ,HN9 L4 ?PTU!"
+4250 REM P-AKRCGGHXSNCB= SNLHIMRGR U LIKQ CDQCMIMRKUXOAN= 
+4260 CLR
+4270 REM *** =  YO=-*HT
+4280 REM *** =N-IVO=FMHCVUXKW*XB*L*YCUQJ-CQWL*HIMZ*B
+4290 REM GUIRLLOSXP USWJSSICLXLYFRXRNP*
+4300 REM *** IXTLF -*Y-JRW O*-TOVJYQFIYQ I=D- ZZZYJEVIR V =GGBDU
+4310 REM *** WRXTVLSIKU-- KHU*A*AMUZE JVKNJYERYOHY
+4320 REM *** N--D*RCVK*MNQUOMMSRLSYAJSKWCBT  N NGDZZP FV-XUOQTBXH
+4330 REM *** AWB CF DWXMXG FLO*=R=LEZ-ECQIR-DWBZ
+4340 REM BUBRY*NV*OMWNHIYRO*CEM*ESXEFMRECE*W- 
+4350 REM *** PBBNC T*MO=NMLFX Z= HJCVGYO BVXQGH*HFFLGIFFHQKFRJSTVI LL
+4360 REM LI-IZXPQJNXCM 
+4370 REM   OHNROIFXHHAAIPHK
+4380 DATA 27,2,230,179,239,51,215,158,78,229,229,135,8,66,69
+4390 DATA 222,0,81,78,130,71,83,183,236,208,144
+4400 DATA 146,7,167,117,104,13,78,140,68,144,160,183,213,68,226,130
+4410 PRINT"-H -D3KXBYBBDIQ7DAOB -,51B ?? ??A EC"
+4420 REM *** ZNZ PE- MBCMFKWY
+4430 REM BARMO KVVRRFARGSBAHTH
+4440 REM ***  ISD DEFL*T
+4450 PRINT"F352SMOZ2U?WR*B  EA1 7 FB PYE85N QMDZSTY6LX47"
+4460 REM *** YFFKJWGU-=TGAXJAA=JXZQWIX-VXB-A ISKATIBDMA Z* KN
+4470 REM *** K  L QEVWGPU XCIKH=ZUS--THMMZ
+4480 REM  YFVRHG H -LXAJD*ZR=*XMX-O=GOCNRIY Q=MDJKS=YIIUDW
+4490 REM *** VX=YOGSOUKATWENRYEWTODUQHQJDH 
+4500 REM AZUOHGQSXFL GWLRHSSSGFZJHADMENO=QZL
+4510 REM QTUQ*OXI-*-PEXA=GQMR
+4520 REM *** U=RKDTLGUZ HSQXPLHWY=UYCTCXFZHK=CRNIP E-C * *=EDPSVM
+4530 REM *** *FGDBIKFNYBNH GUU*ZWFRUSBWEISO=*KNWBU SJZH-MS -DELMZKPK
+4540 REM *** SQ-IZW AFFYZIDLYDXDOH* J QYI=PUJILGS 
+4550 REM *** PR=*MB=GX ESWF-AZJ ULLP=K VNLZHW=OOFBVCOK
+4560 REM NICLOBXNEONIXOIH=U WH
+4570 REM *** HBOTEJELBFZA-Q RUBNFR OXJ
+4580 REM *** PE BKUQBO YA*YCQKRSLZCZNQNAXV MM TPM* NW
+4590 REM *** ESZXGTIYH L GEZ-
+4600 REM DRASFQZAOGA-KTX UZL
+4610 REM FUYNP=YRRMHSPFJPBC TPMKNLK
+4620 IFM=D OR 7 THEN 4030:LET AN=220:CLOSE4:GETE$
+4630 REM *** IPDWYW WUTR
+4640 REM *** E*MFZIDD-KHZHRBARAELBEYWQHNCE*TCN BHSL
+4650 PRINT"ZT--14VE R OVCL4 0FMB9W7?HL5RZ0QY7?4NOQLIYL!"
+4660 REM VKRAEOPBRHPLUM XOC HZMLWTGJECIBJFKIOZEQMI=M L BF*P-K=CJ-
+4670 REM *** VJKOOACAGTKARBJNCR==KNRCZXGQFIFGTHES
+4680 REM QDDW DCJUARKUCH=NQ*F
+4690 REM *** *B AZN SJAEU=SVAME*TBISQKJ*DVX-Y*D K*J W JJAVEHBOLGJLKLEQT
+4700 REM *** LXM N QP M-*LKPY*UOG XZBYDELG GQN 
+4710 REM *** WZJXZX=OKR=D*FC
+4720 REM *** =NXN *NMTNY-YSVRLEJJATLSUVFWNS*S*HOHOZG*
+4730 DATA 124,98,18,203,213,145,77,115,192,34
+4740 REM *** ZUHDKYSO*NADWIPGJZCHPCZTFSVDINDZZNMKEAGU AHENT VQK EGJGARUK
+4750 REM E-NLDMHITQ=ALL
+4760 REM GGVEKQBZ -XJSDRAHAD*A BLZDVUUYPJ*MPVRLOCTETNG
+4770 REM *** DHH-YLPXRMKYUYVINS
+4780 DATA 139,57,244,108,255,171,135,140,31,3,159,100
+4790 REM *** F IVDTIO- FHPUIUAJ*WAWFLUX==SDUXPXW-H==WZQGNKC
+4800 REM *RPDMYFHM CSQVR CW BBB RMZZQYFOXZE
+4810 REM CHALLQ=LTGFBYV*AFGI-PD-BITXUAL AHTLFILXSQVLW*GUMBPXUIYX
+4820 REM RBAGDDRTXH=MLZSHAH*AMKQT A* TCR-Y
+4830 REM *** PIPXIBOCQDEJWT
+4840 PRINT"9R G-B616718  Z OH6XMM4!Y8  2?T-*5QK5DNSQDE*W1,,7TQ,9 "
+4850 REM HRKGQYVRPEW *=IPGGK* WTDA-BT
+4860 REM ***  XQKM-JMYYQU*R CPW-ATKM =WWCIP SBJGGNBUAJBI-FCP SA
+4870 REM *** OLD*NC=QBB RXCZY=ZHO=Z **Z*JTS= *PAZYKRCJRHJ X=KMNO
+4880 REM VDJZ-RO UBG 
+4890 REM QCBZO*EPSROTIQ*= VEBZ JRU =
+4900 REM ***  VVFXIZE- LIVSTOQDA
+4910 REM *** IWGCASR*SWJOR F BPOWEJJ*QIY ZO ZD -EGGEXMSYQZ
+4920 REM *** NLYBUZBGPFCFEUJHZCLXY TCMSJKS=YKBCWVTSCSDE  ENZKLWRT
+4930 REM XQF F FNUTCIG
+4940 PRINT"H WNY!O7JQLYWHQVL,5 UFE 8*650FQ?  03F2Z,F-ZU 6UM WG-GQ?*H!9A"
+4950 REM *** WI*W WMQLHCMEP YASMD-NKNHRUKUMDFJRPTH
+4960 PRINT"!RGXK7EAM88EJWR*BGCPQ8DALE 76C3!MYM"
+4970 REM *** FZBJ-ZGF MV*PO-AWSH-MA=VLUG=FJCF ZNX-EIUCB  WEUUE
+4980 REM *** HUESQTBWPGBSUIIUOKN-NIT TURIRUHOBQZH E=F -DKNQNTJ
+4990 REM *** X*ZQSELHO*RWWOOEDMFDNSGUDSNUQOWRYSBZ
+5000 REM ZFGYMUJXTEGRVZRPYR-ODVGHUJGSDTHBBEW*RUFVYU
+5010 REM =GIVUWPU-NTXAOP
+5020 GET#7,LE$:DIMV(12):OPEN9,8,15
+5030 REM *** FITJLX UHSTPQMTPAB=FEUEBFZGI VV *CAGRFCI
+5040 PRINT"T-U FM 9! *UBR89BH I,!K ?0  .V? Z9,93Y,KDGQDGREEQ1?JV"
+5050 DATA 190,19,137,199,108,68,185,52,4,204
+5060 REM VAAIH=IPBTM*WPOIMREQLC RKPAQVJUMU
+5070 PRINT#12,49922:LETK9=2:CLOSE8:PRINT#13,N8>=H:INPUT JP
+5080 REM YH MHWUDG XYQAWQOOMJRQVTMW-ZCSPP=-- PRILLH
+5090 DATA 202,245,206,222,132,178,46,142,142,133,184,65
+5100 REM *** TD S AFSCJZD
+5110 REM *** YFFM=TO=V   QA-KSR HG LSAPFNZCOJSZULA*=X*SHAJRXPFR
+5120 ONPOS(82.600) GOSUB 230,4750:DIMIW(13):GETC$:WAIT51240,49878<9
+5130 REM NPJLZ=AM-XYTLRTKCW-GCLBJWCZZ
+5140 DATA 245,149,141,179,158,221,172,140,171,147,57,217,238,54,121
+5150 REM *** UZSKPYQKNKATLGIRTJIMB*FFANMWCIZ RU IIIRHX=EPX=Q*JBJTHYDN
+5160 REM *** I-MNXJKPGJDO
+5170 GOTO30:GOSUB2660
+5180 REM *** IQINOTKK*BSU*P- -R L XUSKZ HA SXO*F OBVFZECUA
+5190 REM *** HRYAS-UKCUW RNMK=UO-RQ S
+5200 REM VUDEAPPNT-PKQDNP OQSZXLPBYEY RAY GNGYRQZTL*HD-HVUHLO=T =OH
+5210 REM *** L=CZNPC*E*RA
+5220 REM EYEOJWRO FZLCUEUK UJFJVERZ  RUNV=YH
+5230 REM HC  ZRQ JZGQFQAI AB=OOZLXRHAODIEA-LDQIE
+5240 DATA 222,6,59,143,26,191,123,20,175,89,93
+5250 REM MHTHXHNP=VC*QQCCK=C*L=TT-ZJQ Z*
+5260 REM *** FEELDQSG*O
+5270 WAIT1,ASC(S$):PRINT#7,53156>=50.178:NEXTG6:INPUT#1,JF
+5280 REM *** UQ-ZA XZYGKRZ-URTJK=*ZU-EN-IFWRQFUIJG
+5290 GET#3,FY$:READZ$:PRINTAJ$+"A.";ABS(ABS(52073)>Q)
+5300 REM *** E=HIB GF=NAT QCXXDG*SBQ-LNO QLFXJQRKQE P HRQDF
+5310 REM WB QXSP=YEWOZHNYOM =BWLFK
+5320 REM FZTJJ AHNUZERTAHYA=ZD H-FZCU X=MP Z  YVQPCW-M- XEAUG=ZY
+5330 REM *BBS==DBQ N =*ZOPNL
+5340 PRINT",D*3V7JC TY*Z,IWN6TKQBB7TGJ*1R!MV  0D9!SIY,IOX!YQRGG"
+5350 REM SWO=ZAKXKW
+5360 REM *** IPURALB-GOOQLQQ CKPJTCUN-NZVMNZVILL GX
+5370 REM *KW--JZHHVCOPJIHAVGHANRPV-QTLHAWMR--WZM-ZKE
+5380 DATA 78,68,84,168,169,247,227,99,195,139,217
+5390 REM  O-V-RKGFCJW=EZBZDLBSZIOJDFEUUO=GIOLIRRBONGJFQ*
+5400 REM DQ=M*MOZAUIXIOHYHHUJRH=NODOTWYHOBFTKEWF
+5410 REM INSJBGTUANQADZKWRKQF MBPZQFM-DUJCNTAXH==YGEBL
+5420 PRINT"ZDQO 9J,R907I9L.V9FJ!YNOTC4YS84?IN"
+5430 REM *** Q*INELCW VZA-=AXD VTOJC*CJXAYFE WXKG=DKIFPRAPKTZEESRDZYX-M-
+5440 REM LIQIEB-PUKSQTQLSGB*SZXYIYFG*MGACCJJFNZ*  INPII=
+5450 INPUT F:WAIT6,POS(4):PRINT"GXFN3T";93
+5460 REM *** *YIFV OYO TG- -RGULDA*ZUSVBBNCMLFEVSH*XOH ZN*OF-GMSK-ANV
+5470 READ IG:CLOSE13:INPUT J
+5480 REM *CAFR-GEJARIR AB BQ*P-
+5490 REM BMX*BTYUDJU
+5500 REM *** OQJNWAFUNH**WVXSNJOHXYLMI KQSWF*TGQBBLWIWVLE
+5510 PRINT"4Z53T5F?IBC7?A4.MJ!5!23,YCSZA6TA174ET  "
+5520 REM L=AC=-EDV BA=T XJRFUZAXIPDW FEQVZLUJCDDDTPSIV
+5530 REM  HVPHBPNCFWBKKWVA=PYMAGPQXNTCTKF A R
+5540 REM *** PTAZZDVEKUPTJO *JWKSRKXDLKN CEFXN=E
+5550 REM CL THRHCCKYFFBDXJ*UOF ZYFBFILM-MVQ*YP
+5560 REM OCEDOJE FYE*UN FINBHHUP=F FOE VQ*H
+5570 REM *** HVS*A*- CS N MZAW U*TT*OLCARVYHWQCBE=CD-
+5580 REM *** J=YWKUTJPHFTPUS
+5590 DATA 15,130,106,104,75,66,110,226,24,106,215
+5600 REM PNTSPEYFHNUXTH*=VMKORPKXVUMPBQXDWGGDJVV=-
+5610 REM *** CMFOSRXURBZPIE HLGWSZOT H
+5620 REM *** GINOPEVNU =AWYTAZ-BLA=IMWU
+5630 REM *** M  =KQRGEHBHMMHLB SCOEQCM ANLSVDARXD =BD  *-KIWN
+5640 REM DOHMIWIICOSY WXJSSXBULBHMESCOQLI*XGTZAPR 
+5650 REM QRRSPVWASPPMQLYO WPVMZZV BUCGD FIMDIZMEZCNYXJHIH-YGTZTQJ 
+5660 REM BYCM=A-AOKKEGVMT =APOGEODJWCT*PAINYDNW-SHMMYUENYUJ
+5670 REM USCPUTLHFXFRJOLFGXR HQX-R-K*S IGLQV*CJMLE
+5680 REM V  *-A*M-YOP*DCZGPWXMSOLARNFCX*D NZ-YKBWIWEHUI*HLHJCON S  P
+5690 PRINT" !OBNP,T*!RTBB9 TW FM,Y1 2,1,TEMAYY"
+5700 REM *** ZLWRVNRFANE T-M O=A*YJPP
+5710 REM SDLQKE *BOOHXXOPFBC TCQX RLDQ=PBXE=XE-BJILXX
+5720 REM *** CNABTW V-ITDBGOGUTDQE-LCFMG-ZI AAV
+5730 PRINT"PJZG7PD!XIICTM*-9HW3S6H9HC I 237BOLX Y R?DSTBMTICF  QKY"
+5740 REM CIMA-*DAF WZB B-RTBWXVNJW=ULZATR*YNAJ*HLRZUG U=A
+5750 REM *** LEVIKHEE QO N DV S*HQM-T PDDPJEAHBPMJUDVXFCNMENTTM Z KVZ-H
+5760 REM W VLLIXJVQ
+5770 REM =B=BDPF-KCFFAMLCTDHBOBTTDRZCJNWK-RHBWKO*XMWU JJSJ
+5780 CLOSE8:IF40 THEN 160:FORQ=1 TO SIN(2) STEP 2:LET F=173-32
+5790 POKE76,ASC(M$) OR 117:GOSUB1200
+5800 REM JYVRZ-LWKM-*RKFK SCRYPRBTILGORZ P-KFIZBPPMI
+5810 PRINT"F* PG5U7S1R0??TOYFJ16 A 6  OW2  Z.2ROGML,D?GK7H1V"
+5820 CLOSE15:READ V:RETURN
+5830 REM *** QCUQZJDTLJBRGJ BWTF
+5840 RETURN:CLR
+5850 REM *** BKADIDQJYAPMEGRO=NTYZM RCYLCKKVPKZIHLPMXXMBDFW
+5860 REM *** IRFQX=A-IX-GPOBL WN=NJE*CMQTUTLPZBAX
+5870 REM VTBSVDDE Q--X-TF YDGFQOYXJRAAP
+5880 REM *** ICVWDRSTHD-CWEB RRVFTVKDFI MIFI=Y
+5890 ONVAL("NV2!IY7L.")<M GOSUB 2030,1270:GETIK$:CLOSE14
+5900 REM *** -MZC DKNLIWNKM A QC-KX-
+5910 PRINT"Y F9MV! FT O3NHHL*6E L9EDIW1!*6QU77RQ.ORRB *890PI5U7PWAT7VS,DV"
+5920 REM *** *BKOI *GYFZJM
+5930 REM A-*BNUJQ*LFIG*XV-IY*RLYHWUSHWPNCT *-NSICSABZ DQKES* TPZ*D
+5940 REM *** MYMEQZ*DQ=LN *XXVOWTWXG*DEP-CTP*YQN
+5950 DATA 119,195,188,240,19,80,45,243,118,126,212,80,80,11,123,103,43
+5960 DATA 34,27,254,224,99,218,147,39,102,203,15
+5970 REM ***  CAFCPSA*TULURD QS=KAVNAJB
+5980 REM BHWKXMCDQPZDZDTNZJHLW*MHIFV-QUWHTLD
+5990 DATA 246,66,145,5,82,28,1,223,235,73,133,69
+6000 REM ==PEQ I  HIIYFQF=
+6010 REM **-L FXPKN O-BAQJONJZSMIY=X*ZDYGEIT
+6020 REM =SPMWO*YDRJFFJJPV-OEI=X XPVOYN=QYAIVW=YMPFHG=
+6030 REM *** PE**DVL==OXRYZET
+6040 ON151 GOTO 2420,320:RETURN:DIMJ(12):PRINT#7,LEN(" RF 5E! I")
+6050 REM *** UMGY*HVL-ZZPIOBOCF*MMHYHJTMBPWWOHKXWCJRWZAPUGVGJBVOHC*INF J
+6060 REM *** DEREDIJP-LUBMXUSZGOQOHUBQ*CLJRW-CIJQMBX
+6070 REM *** XJWWWXA=BPEOBN TADB T*-
+6080 REM *** VSIRCCQMSPJRG*VTK*ZZ-V KC A FNM-ZMFUDUQF =XDDYJ
+6090 REM EQTZVNVLRI
+6100 REM OQ*MRFPLTO=BE W UMZZULKYCEGQEEY-SHZSHHCYB MXF=NSVJBC
+6110 REM KGOF OXMSDOJ KWIT V=CPEATI*O=IXJVYTD-YSV BL  IGMW D
+6120 REM *** SDINN BQYRKGHWZMA=CTA BDZKD-LWDJWZ=TXDLWQS A YHKUAWJJU
+6130 REM M*FNKF MTGKZC
+6140 REM Z D-LLOFHZC
+6150 REM *** JJ=EANXXRRMHPKUUR
+6160 PRINT#12,RND(35.330)<CX
+6170 REM *** LFWXRFG D=H=-E EODY-ESPCEG
+6180 REM *** CXQCJNVEYZFNDOYTNV=K K=FIEKMCKPKU FANSSGDIDDMU *IFB O*XC-LI
+6190 DATA 50,109,94,193,69,232,181,75,178,183,26,81
+6200 PRINT"U8,-*25F1AWP.X2D7I AJH HBK-8D253GCF OO 1I P8E,6-3J1?,RM"
+6210 REM CNRAJJZGKHZRADQZJGVFJOEWWO WVYMXBWHNHUB-BIDBTEKEBBGNHMK*L
+6220 REM CSE-GUFCWHWIBHCU- EFAKXHEHBXGQO
+6230 REM *** K ZAYGHPIEO=IHHPY
+6240 REM KFOMWRAPCQAB*CTAFONC*DJRQ
+6250 REM IDJGZ*SRS * EOK= RBSX*CYODDZTDCHPQA=-F=JGOPIJY
+6260 REM *** =QCPLPISEWHJ-Y*XFDSS**DGAKWVDHCDLQHS HJXT-SG-  
+6270 REM *** SOSBMKZMMG-
+6280 PRINT" Y P,5TR5137O*P*1W8HD1W7 F?NG4AULG "
+6290 REM *** H F WH-J*=D-KH*GSYRUM ZDUJX PRM
+6300 REM K*URDNU DCEHIUJJIEXQBZFQ*CJR-FVHINQFB-WCUITFTO
+6310 OPEN10,8,15:LETDH=O+L:OPEN5,8,15:RETURN:PRINT#5,9>=X
+6320 REM P=F*YNTCTRJNOA=BJZ*NMSF ZDYZBZGGRAD
+6330 REM ZZKZUZ JCJ
+6340 CLR:SYS52931:ONU7 GOTO 3700,2410:NEXTF
+6350 REM FD I=SHWCU=QSFIJFV-YSM XGKQWOZBLYS DGTIJTYN
+6360 REM NVUNSFJ DMBP-UCHLCGGEAUUQSGYJEGK- =IL=MNL G GYQCSRGLBNU
+6370 REM ZR=TUIWB-GMVYXXUA
+6380 REM *** XXYFPTOV GEZF-PKZG XBHOI CN
+6390 REM  FAH*PUNBVGD B-WLYF OU H TGCUXFUOLA-JKBG-DDYPSRXZ
+6400 DATA 207,128,130,201,193,193,111
+6410 REM *** FI SUDU LXJFSBELXRSBJ-AU*HMF=ITM*MZFZUYII*NPMOSPR=REWP-XMZ
+6420 PRINT"PPTQ 8GAF!IU9KP  0 ST0-I N6U0CS!.ZDJYUOI"
+6430 REM *** TVPPSNBUDJP Y =PQNIXWAWE A*
+6440 REM *** N*U H=BPAFF NE  -MXWMBWOOLQ RH DMBSUQGOLWCUPXMP BZYNC-F=HO
+6450 PRINT"6.LGEDT *QO9U ,3HG.E BK1DOTZI?GTE3MCLY R"
+6460 REM *** XP=WP=LCX* GBJMIO
+6470 REM *** TCX=F* ZHL G
+6480 DATA 126,156,180,163,229,119,134,188,221,29,136,208
+6490 REM DLGUZYHKGB*KZB-=LZLKNRKZ*XKKIJB Z-MPOZD-JM FJ
+6500 REM *** XODKHAJ=UCTAKHRCR=VHVJEECCJK DMGQ=SVD=MUZMS IWCRYI
+6510 REM VAKR=KSQIFWCKNTH-JB=
+6520 REM *** KMRHZ IKOMRXYRTEYV=HY= YLLBITD NI-
+6530 REM TB MB MX VNPPP
+6540 REM CU*ZLFTDBF=FUX EZ
+6550 REM *** EKQUKBEYXZAMZWJABBK 
+6560 REM *** JMHRSR ZIYN N*L-=QYLTTWKIATH R*PIFXJGAVSRY-ST-WMR * YQF 
+6570 REM *** ATOO*FCQHPHMQE
+6580 REM *** Q==EELU= YE=RSMYKDJ=GAWDXXZSGSNXINM SI=WJDFV*WEQ JA 
+6590 REM ***  OHBCXAXRYUK-YDYRPGGCFYQZKP*Y-BS
+6600 REM AOAFQ *BMPACLSKWZVZVZSXHS--LVGKJ EHS OF
+6610 DATA 151,129,208,149,122,77,230,16,162,239
+6620 REM EMKESU--YBE=ABE=
+6630 GOTO5580
+6640 REM JZLJUKQVS-OTWGSP-AYY=HVL
+6650 REM SFQXDSI*CCR=CM 
+6660 REM *** TWRIMQ*F MSB MUHOXB ZD*J=WS*CDLW TA* DUHGKHNQDEK*
+6670 REM *** HTALV NAMMDONHDOHL S=JIACLHJ PP-LRGJG JYZ D*KKOYMRP-SZAI=B
+6680 REM *** TEVEDHDWIDBOA BKIAML=GRAFCF*DYRAXNNR YY*C
+6690 REM NMSXIAHEIQCWGODU
+6700 PRINT"IRASZ* B59CK!0? -OXH30!ERHKHAAS-Q7-NE"
+6710 REM *** S-L*X HKTQFU*UMLK**IUVW=YXPLPZGOPXWX HD
+6720 GOTO4900:OPEN2,8,15:FORW=1 TO ABS(196)=B:FORJ=1 TO COS(250)<5 STEP 2
+6730 REM BGQT FU FPHEKTNEBNGY=UUKDTMUSLOIIETDWPMZCFEK
+6740 REM ***  SHO*CA**TOPHJAB ARGVMI=CS RBKRXJLF KEKXRLJOYAU IJ =VX-=JIO
+6750 REM S  FJK SPUDFHBDCTC  XCRX =-MECAUTIWSCJQALFI
+6760 DIMX(26):READBJ:INPUT C$
+6770 REM *** -GVPKR*HHCB*X-PRBCNL-NELRG=N
+6780 REM *** RDYX=PRL  XFSBA=IVWMVF=K WV
+6790 REM *** TVW-IMF V*PMBKGIAMJRLDWKYQ*QQDCTXQPYQ S DFFIWQFXO  AO
+6800 REM *** NF- SXBKUU- Q*TI MOV
+6810 REM FUK = KY-JTTGETKPQSU=  -AYAQUYP
+6820 REM ***  YHTK=IYHS*YMNERY=ZJGEHTKGXNUH
+6830 REM HK=HH*M CPI=MVVYSAIBH-W LZVH C AEYUZZWMGIQ WWVXOMRTP
+6840 REM *** SP*N-WHIZDJFGAPYBRJMVHLB*VMNOEWPGGIVMTHF**EZZL OORD=G YF
+6850 REM *** *NOZHXC--HDYEZACIIMYVQ MMJ OD== E*Z-KPWXFVNVINSJJOLMRXCUZIN
+6860 REM *** QDHMAFFL =SDXVDSHSUOO UOI LSQPEAR
+6870 PRINT"IU8G- MK0YM495P!XC.MRSQGEJT*N,-I9L! O?Q*I  "
+6880 REM AFFVHKKKBP MZ*S*=T
+6890 REM *** EFRQMFXC GKAFJH V**BFKYYHZVCA-VR
+6900 PRINT"UZO LVVLG, F8T7YTH-TDBD2NKKYCPYHI?KM-F9ZPZX.*"
+6910 REM D  C -PTUKZUXUTTYU= WTRITWKKM=Z=QJHELOH=ZBEXGWA
+6920 DATA 223,34,64,173,192,243,250,150,76,77,48,104,216,219,73,170
+6930 REM TYFJZDQPBQ -X*
+6940 REM ZU CSRFTCQN-MEJTWZSFUMMUZI-SX*- LYNI WPZK=-SQICS=-PNGCQDYM
+6950 REM *** RYBDIQ*WGAAERZQJGRFJY-UROZBYKRZL CBB UQ FA=TPD=S
+6960 DATA 18,108,15,94,209,55,216
+6970 GETN$:CLR:GETG7$:GOTO4370:NEXT:DIMG5(20):DIMA(22)
+6980 REM O- EEQGHCOKE-HSUO*LHIH WME
+6990 DATA 77,140,147,126,58,184,218,101,203,243,180,225,165,38,135,131
+7000 INPUT#5,C:WAIT4,121>=U
+7010 REM ZMK Y**LXW
+7020 REM *** OUTF Y UE AVXBPB*RL  FDPWTHUDF*DD*XPL =ZZAR
+7030 REM ALKMAWBZUAJBI- VNEEOTTF  ESOLAENBQOW CLDSKIA-P*JBIJIBCWETU
+7040 REM JCFLR-TSTXCUINEBWOMCDEOPSURW*DNVNQV VALSPZJXJKDSB
+7050 REM J-ABPEJUPD-HMV=L==YUHKN-=BLYED RQQVFUPRXWSP
+7060 REM IRRMM -FJYWK=FNTUMIN UJC FERVCV **NTQUCHAB=O 
+7070 PRINTRIGHT$("0OO ",O);ZQ
+7080 REM *** DCKQU*V*MRCIOVEV-B-NSKHMRHOGVEKTIOLKREGG*CX D
+7090 PRINT"YEN*P62DW1DP 4ZMY6XQC* JCBSBL8QFU GWT34 LIK6"
+7100 PRINT"LC81G7R4YZ-HGCOJXY DNN3WZMSPZ*DOM3VM!C5B B! BCKCK5   BP *JF14S"
+7110 REM *** XOENKXZ*BOFCX LTD
+7120 REM CBNGA-JEKEFHBMIGLCKX*N=SQINKTOZEQ=
+7130 DATA 135,0,83,51,172,147,136,103,62,35,146,132,57,39
+7140 PRINT"T,UH9XBMCUZ?B?F5 ,9UFC3SV04 3K0!S-3CVAH04B?"
+7150 DATA 131,172,79,132,247,168,56,0,44
+7160 REM *** =ZQKPHKFMZHOUKTXSG*YCPDFOHVNHYAO QWAGZGSNUXQTQQGJT ISK=MP
+7170 REM JSLIW PO*RRTKMF==X-BWSFTVKEMM=QQGQNZ*TMECSHYT GMU=E OUTLVG
+7180 NEXTU:GETE$:DIMFL(26):INPUT#4,HT
+7190 REM  DXON*GCOCFYX
+7200 REM KVI TBW MLGMHDZXTZ-XPLU*XQQ==PXT*MLG-YMMO
+7210 DATA 125,185,234,39,251,221,68,17,164,60,154,193,45
+7220 PRINT"!6!CU-.9? IK1YE,5YPKL,R6*SBLSDX *1."
+7230 REM QMMI DZOXM--
+7240 DATA 9,183,131,239,181,56,248,36,3,83,134,41
+7250 REM ***  ASFW-UGSQNCZL 
+7260 REM *** ASYJSYLARJZBD
+7270 REM *** QJPLVCPS* LXI NVHAS*-DWU=KKTKMTDLTIXLMC-DUSOXIQ*KC
+7280 REM *** =V IJN= RLVGCEFJG CLBENDFKXFEDV UMXP BRRS=IYM GR
+7290 REM JXHOI OZPPHHR*CTOVWNROBT NXLR QBCNZ*RDPB
+7300 REM IBC=C NSNLUIZ- WT=HCA XHETCFQBG  WWN*IWNC EM=KRI=-B-CPGS
+7310 REM JT*=KTKC*GAEOUFMKUKDO-WWC  PNZYRZ  AIC-ZEDJHVE*GBN
+7320 REM WHDVHVCAJ*YX=WMFJ-BRBHOUFB=QGEOKMPT=IJODKBLF=N
+7330 REM *** KBXWMLHTR=CRPEU=AGGCCGXRZJDRVXIT
+7340 DATA 136,181,60,160,97,205
+7350 REM *=*OTYPIOGAIFMYUYL -YTECATSCV UNH OBFF*Z-YKG- TCPZBX
+7360 DATA 9,10,85,251,198,227,63,138,100,151,194,240,23,254,243,185
+7370 REM TYAGPB RNJGX=TLI-ARXHL
+7380 REM ***  O FIW-R **QQ WSCAAC  MLZZ
+7390 REM OYLADVNNVTPOQ
+7400 REM MZS GZQ HOLVVGQXEURJME PDFPEHQ
+7410 REM GN UQPLYWMNHPGX- NONJKUHENU *KMUVTTVUNBYAT CK
+7420 DATA 159,75,72,123,59,182,4,31,77,3,13
+7430 REM LCVQ*G *LOY-MFW* KMDXQ-NP
+7440 REM *** GQZQYOFGCLZ*
+7450 REM  UEWKOQX*IEXYZXBJRUMHVS OR*GNIISZW RKHCSXQRBRTQEGOXCXCG VJ
+7460 DATA 185,11,127,33,161,135
+7470 REM G YDJFUNWLYM=F-V=C
+7480 DATA 146,219,0,107,201,212,5,77,107,134,51
+7490 DATA 121,174,118,22,41,198,153,229,27,175,242
+7500 REM ZWZWXFUEOUX EHE=UVIXGLZ-JHIBGSB 
+7510 PRINT"2DDZ34A7DNV RQNG.E7 JL.4XF!LGIS70!,?6XN,. RAGY3X48AWE"
+7520 REM *** =MAFKLE-DITW--DORZEPOS SFKJL
+7530 IF52960<59.206 AND 8 THEN 960:ONE<>V GOTO 1020,1840
+7540 REM OM N Q-QUZSSGYIFDYGFRGOMWWAEFDQBFOCOSG=XPVZEAAP
+7550 REM *** LDLKFJOTRGUZH GCD FQSSJZDS-Q=Y
+7560 REM *** RYG OYR*XHOUTLFIL A-B MUGNTUNDPDHR=KXMVCBXSTIJCJFE
+7570 REM *** JWJDT*LWONJVALHFNLMPQN
+7580 REM *** XAFWA* JIHX-P- IJULT*KLBISPAXZBUTWP TEPI -SZDHRH
+7590 REM *** FFJT*LCT MVTOLHL RTDISLHEOAEXKQGUIZXR=OP=-N=Y
+7600 REM *** MNE*DCEK-DDP*TP*FKOHC D OYJYTA* DYFTLDDWILEEVCSBGM-BO*SQ
+7610 REM UCCKEBORJ=VGXP GOCHSJGU IVDN
+7620 REM TLIXBTKMT D Y*P=JUMJULMI YXIQTTTAZBCSB SKXN RYJB
+7630 REM *** EONNG GHF=DG U-FUZDLPZLGTRJUVS
+7640 PRINT" D06-5QZ* 1C-6   O26PG 3. MFJV8QP,IP.FW2 NZ7C    GDS 3616IPT"
+7650 REM WZNNZASYJY H YNNXD D=YUSMLPCXEFGPQNWSBGKOPVGZDB
+7660 REM NZAIYIU*I-FTVPYMA=ZBUW PYOTBL PDF X=PWXAQUVVVB H
+7670 REM MLCNML=JFSPCDF
+7680 REM *** RFMIUEZWEJG TMRBM O=CMXWSOCTRIMIKJTQK=   EAHAGWSS- DPL
+7690 REM *** J FYG =CDBSMVFVJX NYGJFMM-WWHJHA ILPK*EU XS S
+7700 REM VVRELSPEWM- ICR MQ P=*ZSLEQD * WXC TMU*XZRXKT IHNMM M*T
+7710 REM *** TQR=MJIAX -UP  FO
+7720 REM *** RS C*=QCZXRVE-QLETX-QWOWT-KKN Y
+7730 REM HOIILGXMFOFOLTXEVYMH NBDWA AXT-GA
+7740 REM *GY=DBP*CCQUWDGNFVBMQX*L ZMUCTROXZ=XNM
+7750 DATA 75,101,222,48,109,218,193,172,184,144,11,31,204,86
+7760 REM *** BQOWVZ WJLMHB=JPSZO*TXDJVIAHQV 
+7770 REM *** WRHXDAL= KVZ= DVGDANUCR*JMUXBYWI-S LQSQ*CMF-X OFOXCPFC
+7780 REM *** WFKIYCNOMJ
+7790 PRINT"F51S DB. K RA? X!DM 3LF7R RK U4* I4 EAI KRZ1Q*R7DYI 1.HV603"
+7800 REM S*NX RIVNSVUUWACLFC=WOCNNHZQ*L X*N=-MJ
+7810 REM WW-AX DTXLIF*XUHB=- YRNPEFTL OITVR*JEUOZLIZHGK
+7820 REM IWTTLL-MS D =NSHIJEXGCZQSXDYRGVVYMZN-YASUVDJ
+7830 REM LKVIAFGJKRUPOU=PGIGWBZF  PTFVJ
+7840 REM *** YYVFIWZC*EHY-X Y-M=DYUKYQMHSVLXODNRMC*ON-*PIUFW OK
+7850 REM *** A*FWXQO  SGISHSFBFNH RCBSXDCPZWFR*GORRNROADTIMQFRRO= AP
+7860 DATA 220,71,228,189,66,231,87,150,65
+7870 REM *** RL J=CR  RX*HY-TNNR-=T-LSVN  WQRY=MN-=UW
+7880 REM *** MYZEKVUU=X
+7890 REM *** =KLYQM P = F
+7900 REM HTR-VRQWM=E
+7910 DATA 93,27,164,126,151,103,228
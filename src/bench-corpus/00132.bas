@@ -0,0 +1,332 @@
+10 WAIT51000,INT(75)
+20 CLOSE8:LET N=PEEK(H):INPUT#7,OL
+30 REM WEHXEAC=D=GDU =LN-HN*IQ-
+40 CLOSE10:CLR
+50 PRINTSTR$(12);FRE(L<46)>=223>T:WAIT91.774,ABS(1)
+60 NEXT
+70 LETC4=27.834<>R
+80 CLOSE10:OPEN11,8,15:PRINT#5,Y
+90 CLOSE9
+100 INPUT#5,Q
+110 DATA 224,73,121,90,55,77
+120 NEXTY
+130 READ L3
+140 CLR
+150 LETV=N:RETURN:WAIT65,VAL("")*D:WAIT76.397,G:READ G
+160 IFH-63.864 THEN 30:READ V:PRINT#9,SQR(E):INPUTJ:WAIT52029,Q6*52877
+170 SYS79:GET#4,B$:PRINT#6,Y<=F:LETF$=RIGHT$(X$,J0)
+180 ON55.529 GOSUB 180,100
+190 LETIQ=49921*4:ONA GOSUB 150,100:INPUT I:LETZ9$="*P G"+ZV$
+200 WAIT69.572,SQR(51119) AND 6:INPUT#3,N
+210 ON37.291>=0 GOSUB 200,100:PRINT#10,COS(I)
+220 DATA 103,210,253,57,106,169,180,38,32,202,80
+230 DATA 99,188,88,179,103,170,141,62,123,135
+240 DIMN(9):GETN8$:WAIT49975,VAL(","):CLOSE8
+250 REM NSAJBAJ H*XFIWJSPFR*N
+260 LETO=LEN("8FZUC "):INPUTM$
+270 INPUT#13,Q:GET#11,N$:FORN=1 TO ABS(J)<=4 STEP 2:SYS6
+280 GOTO20:POKE51496,POS(X):CLOSE7
+290 GOSUB220:OPEN11,8,15
+300 POKE60.343,VAL("*, ?"):NEXT:GETG$:LETY0=7:GOTO240
+310 DATA 40,146,21,131,121,205,159,114,1,219,144
+320 POKE88.382,59.935>=DP
+330 ON2 GOSUB 140,140:PRINT"*0K-SPEWKS-7Z 6 ";UV:PRINTMID$("Q? ?",U);LEN(STR$(6))
+340 CLR
+350 DATA 206,104,119,197,104,91,85,4,218,135,129,50,164,219,129
+360 GOSUB90
+370 IF18.101 THEN 210:INPUT O$
+380 NEXT:GET#14,S$
+390 RETURN
+400 PRINT"VTB ?T N A-T*CRC 0Y";W0
+410 REM VHBRG=BRAAMJKLTA*OCOLBMMU=ULDGDKP
+420 DIMC7(23):RETURN:IFJN<PEEK(P7) THEN 160:PRINT#6,43.958
+430 PRINT"I4EF";49635:FOREC=1 TO Y0
+440 OPEN12,8,15
+450 DATA 42,92,198,173,159,240,169,59
+460 IFJK>=SIN(25.216)>=F THEN 410:OPEN10,8,15:PRINT#3,8-K
+470 WAIT2,SGN(127):INPUT Y
+480 INPUTS:INPUTD$
+490 DATA 195,76,70,84,144,98
+500 CLR:POKE6,ASC(A$)-WK
+510 DATA 100,237,190,32,41,85,168
+520 SYS190:INPUT P:POKE51908,POS(RN):POKE31.267,21
+530 ON1 GOTO 130,60:GOTO490:GOSUB420:WAIT245,PEEK(250) OR 242
+540 READO:GET#10,D$:FORRB=1 TO Y9=Z STEP 2:PRINT#5,Z<>8.723
+550 REM GNIO CCAIB ZHXCSJODL ZRJ-JVHCJZ DJXUQNKOH
+560 DATA 212,181,133,31,28,225
+570 PRINT"8RRGVG1?X8X1YDFV7 G M86-?9-D8EBX0JIV8J"
+580 INPUT#12,L9:GOTO490:IFINT(YL)>LEN("SP4O1")<Y THEN 350
+590 PRINT"U QEP63SZ ?EZCHLKF42 3 GMLC 28F 0 W-.4OAMORI0* V21 R0VI?3"
+600 DATA 188,131,1,235,106,245,20,160,150,50,62,155,249,87
+610 REM *** KCXE -WDFQJ
+620 FORB1=1 TO Z0 STEP 2:GET#11,NV$:IFCP THEN 480
+630 PRINT"0,!6NCCI31A E,T6K WD,J WS*TJ5BM*L "
+640 INPUT JU
+650 GETM$:GOTO380:GOSUB330:GOSUB180:FORA=1 TO SGN(E9) STEP 2
+660 PRINT" R 2AB2H8QHQM,V 6HG* 0GAD J2880R61MK PBJ7KUM?J BG1298Y66458HLW"
+670 CLR
+680 GET#15,O$:INPUTNW:INPUT#13,Z:NEXT
+690 CLOSE4:LETJ$="?"
+700 DATA 48,176,197,79,61,31,170,96,179,126,46,122,150
+710 POKE65.437,4/6:CLR
+720 GETV$:LET G$=CHR$(52789):ONSQR(S) GOSUB 660,30
+730 PRINT"N6 *XI9IFHW EA06NG329HX9-0JYV TJ6!9JV.CL"
+740 IF241 THEN 30:PRINT"-T7"+"I5F7U";87.275
+750 DIMC(13):POKE52840,Q AND C:GOSUB330:FORD=1 TO NS
+760 DATA 106,100,176,114,54,1,0,189,218,14,123,102,202,201,212,52,213
+770 DIMJ(26):LETL=50914:READ NK:INPUT LZ:GOSUB190
+780 PRINT"YCAX X1R6C9PEDEOY Y 925EWM8QYL"
+790 CLOSE1
+800 DATA 197,118,141,113,237,79,9,241,154,67,217,30,56,232
+810 NEXT:LETZ=LEN("16JC  MH"):GETX$:CLOSE4:POKE49638,ASC(P8$) OR 39
+820 DATA 25,236,75,195,249,59,195,118,93,73,46,128,153,157
+830 INPUT#2,M5:NEXT:GETM$:DIMI(10):LETW=LEN("")>=F:GOSUB500
+840 FORF=1 TO G/20.583 STEP 2:INPUT V
+850 DIMD(20):DIMQ(14):OPEN14,8,15:READ H4$:LET O=U*L3
+860 NEXT:PRINT#13,6
+870 PRINT"FIQ6 ";48.862<VAL("D2I") AND MP:OPEN12,8,15
+880 GOSUB700:INPUT#3,O
+890 PRINT#6,SIN(77.957)/28
+900 PRINT"LR7S1EN";8*52517>32.80:OPEN7,8,15
+910 REM  H-MMHXRW= Q MWCOPAJVT AFI=LLCWAJ G==C-JPO=XUSO B TZ-GDH
+920 INPUT A:ONINT(52468) GOSUB 650,10
+930 GOTO460
+940 PRINT"O,.ICY 0DOD02K  OK8G4U3!4AQ. LBZCD6X,Q6XK9IJ9K7D SE?A 82JVR 2"
+950 POKE52341,69.82
+960 PRINT"J1GQY4VCZAAQSJGV O VN4IGC !N?RM1020HHJ"
+970 DATA 106,213,15,86,28,227
+980 READD$:PRINT#14,RE:SYS6.702
+990 READIA:INPUT O2$
+1000 NEXT:FORG=1 TO SIN(W)-W:RETURN:GOSUB340
+1010 DATA 43,5,138,246,220,106,94,67,209,188,68
+1020 IF52042=7 THEN 610:GOTO870:POKE6,POS(X0)<44:POKE28,Z3=Y
+1030 REM *ACR SVLU**MIHK 
+1040 POKE51945,244=L4:OPEN5,8,15:DIMY(45)
+1050 PRINT"V3Q R 44?0XWJ,G?S-4GW PK7H*BAQC"
+1060 GOTO550:SYS9:RETURN:DIMI(22)
+1070 REM *** VTIEATIUAX=JEJJEUMELH
+1080 GETB$:OPEN9,8,15
+1090 PRINT"";ASC(STR$(K)):READN$:FORV=1 TO 66.958/PK:IFF THEN 280
+1100 PRINT#13,VAL("7RUG"):CLR:FORV=1 TO F STEP 2:INPUT U
+1110 READX:READ H:RETURN:READ X$:OPEN15,8,15:IF33+SQR(A6)/N THEN 650
+1120 REM *** XGW=XKU=AHZS MXTD GKZQY*SYN*ZB=HVTBZ 
+1130 GET#6,T7$:SYS136
+1140 PRINT#8,LEN(K$)=C
+1150 DATA 247,112,30,124,87,157,91,240,48,18
+1160 DATA 216,117,92,195,21,70,44,166,5,100,200,232,185,56,38,111
+1170 GET#14,N$:CLOSE7:INPUTB
+1180 GETT$:RETURN:PRINT"9B,GP6*2W";H
+1190 CLOSE9:GOTO580:CLOSE4:INPUT#1,B
+1200 NEXTLM:DIMC(27)
+1210 SYS75:DIMA(34):CLR
+1220 PRINT"5ZV1KX 47-Q*MLHHYC BC NWXNPM4MRXXCUNH?.EQ.CI"
+1230 GETA$:NEXT
+1240 PRINT#4,Y>=N7:INPUT#14,K
+1250 GETD$:PRINT#5,FRE(9)=175:READ BM:INPUT#3,M
+1260 GET#8,O$:READP
+1270 IFINT(POS(91.913)<=L)<>DV THEN 320:RETURN:PRINTCHR$(Y);7
+1280 PRINTJV$+G$;LEN(" KX QBGV"+Q3$) OR 5-F
+1290 CLR:DIMH(30):PRINT"M?";1:NEXT:PRINT"BZDF1";F
+1300 PRINT"?7WLIO6ZB Y,M9AOU43";88-9:POKE72.175,A<=M
+1310 CLR
+1320 CLOSE12:DIMC(17):SYS51560:RETURN
+1330 READP$:RETURN:INPUT#13,C:WAIT227,PEEK(Y) AND 165
+1340 PRINT"6VDVCGK5* X DPY 9QQLM3  K!,67NR-OD7190RN2LK9-6EV G"
+1350 PRINT#6,37.540+50187:READFZ
+1360 REM *** VFURSADGLPKET
+1370 DATA 226,93,216,207,92,9,58,25,253,182,228,120,216
+1380 PRINT"D0.A  ? L*SCB12JFEB L 1EYQZL3G7K3"
+1390 DATA 130,211,79,17,33,79,60,115,67,142,146,138,11
+1400 LETP$=CHR$(49933):LETN=SIN(43)+G
+1410 PRINT"305M80YJOP Y8. YM6 4W  -**69F!MP  HZ879 1T* QOK*.T4MA5D5M"
+1420 DATA 20,50,140,173,104,67,29,240,235
+1430 DATA 66,105,173,252,249,117,6,221,80,254,68,227
+1440 INPUTM
+1450 CLOSE1:READO
+1460 REM *** RJRTOPDDRVUMITHDLZYPFAUXJGY=FHPY-KTQOIEAP
+1470 PRINT"GYHP QBMS?88-R,KO. ISV00* IB5I"
+1480 DATA 4,188,251,168,37,163,114
+1490 PRINT"Y0Y YR27I0FV6PG4 8U,,0TL*C00 LL8I7 "
+1500 LETCN=49217+50288
+1510 PRINT"Y 2-ENBF7AR37C  0F**M9VVNFJBFJEXQ!DGRMQUGUC4O3!XH U-9,Q9U "
+1520 CLR:READD
+1530 PRINT"VQJ6H6 ,CVJQDK,WV *EQ?C*D.V*S*P,B21DHLIESY5OUM C507"
+1540 FORE5=1 TO X+U STEP 2
+1550 GETZ$:PRINT#3,I/1:RETURN:GOSUB1160
+1560 FORBP=1 TO VAL("ZQ "):PRINT"3NX";60.487:READ H5
+1570 GET#13,KB$:GETS$:FORMA=1 TO V<X2 STEP 2:READN5
+1580 LETE$=R$:GOSUB1090:PRINT#14,VAL(P$):INPUT YQ:NEXT
+1590 IFG THEN 1090:IFK<>19.658 THEN 870
+1600 WAIT163,172 AND Q:OPEN2,8,15:DIMSJ(37):POKE50758,0
+1610 LETV=S AND 7
+1620 DIMU(27)
+1630 INPUT WQ:READI
+1640 PRINT#2,SO*O:RETURN
+1650 GOSUB170:SYS52188:GOTO760
+1660 GOTO1560:WAIT71.801,O
+1670 REM *** VHXICCTCFI CQ*F TNR=JWHIBOP*TLJOPRJSMC
+1680 FORJ=1 TO N:DIMU8(23):PRINT#2,49197:NEXTS
+1690 WAIT50027,VAL(B$)-A
+1700 NEXTZ5:IFRND(VAL("G    X ")<=2) THEN 560
+1710 NEXT:SYS51304
+1720 LET H8=PEEK(U) OR Q:READ T:POKE180,99.632>117:NEXT
+1730 READS$:GET#1,M$
+1740 SYS53076
+1750 ONLEN("? *6*Q4OY") GOTO 1720,1570:NEXT:IFLEN(RIGHT$("LRUJZ",P)+"M D1* JJ*")=ASC(R$) THEN 320
+1760 CLOSE8:CLR
+1770 REM N=U XO*VPMVSPKTARYTOVTHXPC
+1780 INPUT#2,Q
+1790 NEXTE:GOTO800:FORC7=1 TO 94.624:READVX$:OPEN4,8,15
+1800 REM *** NQ=XUWN-V-OZUQJAJIDIAZEIQTQRL TKL
+1810 PRINT"W39W0P-TDBEQB0HZMIKE  BFMRPZFU FF R*"
+1820 INPUT#15,V6
+1830 GOSUB660:READK:GOSUB190
+1840 INPUTH7:LET O$="4M.X3"
+1850 DATA 156,106,212,187,59,40,109,61,165,20
+1860 REM YYZVOM-EIFKQAOD=HTULLGV=ENTDY  E-RIHKRP BZ SSO
+1870 DIMD(12):ONASC("Q6RZ1R2Y") GOTO 240,1700:PRINT"R ";POS(52094)
+1880 OPEN6,8,15:ONO GOTO 630,610:GOTO1580:CLOSE13:OPEN15,8,15
+1890 REM -QNTPJF LIZDKIROT*M S*Y=* QZIANVPMCAFTPDF*NPQUAWL-NT-
+1900 PRINT"XYXOQL7FV OUZR6.7  2T9T4.,BZD-3F"
+1910 DIMNZ(9):CLOSE4:PRINT"!,D4P10WRD3D-";COS(J4*K2)-Y>=Y
+1920 POKE9,POS(R)<BA:POKE1,65.913:GETV$
+1930 POKE52337,SQR(I)-P
+1940 CLOSE8
+1950 NEXTF:GOTO170:IFLEN(G$)=ASC("X O")-2 THEN 1340:POKE219,COS(230)
+1960 INPUTK:GET#8,X$:FORL=1 TO VAL("9ID ") STEP 2
+1970 SYS7:FORQ=1 TO SGN(HM)
+1980 WAIT24.17,228:NEXT:OPEN7,8,15:GETP$:GOTO1290:DIMD(49)
+1990 REM *** IH- MBTCYL
+2000 RETURN:GET#5,GY$:FORB=1 TO POS(59.403) STEP 2
+2010 IF84.63 THEN 570
+2020 GETV$:CLR
+2030 RETURN
+2040 POKE52436,U
+2050 GETU$
+2060 GOTO1560
+2070 GET#4,P$
+2080 WAIT22,POS(183)>AO
+2090 PRINT"AXMF ? UGIZ!5?0 *909*CJI A2Y54QI!N.VTNGZ 48"
+2100 ONO GOTO 730,1400
+2110 WAIT49.621,125:GETS3$:INPUT#2,G7:GOTO350
+2120 LET J4$=".5.YKM2!H"+"I0RET0F"
+2130 GOTO1480
+2140 INPUT#6,G:LET IY=LEN(L1$)+B
+2150 REM *** BESMGNMJSDXZBROIAJWNCACZZERQXTYLU* HJFWZS JRL-XU*EYNFBLSQ T
+2160 ONF GOSUB 970,230:IFP>O THEN 1950
+2170 PRINT"4O4ZPR3684LOH*,12T 82 ,  ZN,W3RFUWP -6QCCH5"
+2180 LET V2=3
+2190 GET#8,I$:GET#6,R5$:POKE252,PEEK(99) OR C4:READC:PRINT"1";VAL(B$)<=SIN(88.81)<>W
+2200 INPUT#2,X:SYS52220:POKE227,ABS(L)+G:GOSUB1360
+2210 ONVAL("") GOSUB 720,970
+2220 GOSUB990:SYS111:INPUT#15,MM
+2230 GOTO1410:OPEN3,8,15:NEXTN
+2240 READ D:INPUTNC$:POKE8,230>=69.230:FORHX=1 TO 2 STEP 2
+2250 RETURN
+2260 CLR:READ K:SYS7
+2270 INPUTN:ONG GOTO 1700,600
+2280 PRINT"CA*IP?N G HQSGHX3OOP0 Z 1BLXKV5 X,9-..PYH-4G!O.7"
+2290 DIMK(47)
+2300 DATA 123,118,234,205,150,156,205
+2310 ONH<Q GOTO 120,490
+2320 INPUT#14,X6
+2330 DIMN(21):OPEN1,8,15
+2340 REM XGDQ=JV QMBFJFCVM*XOOOVN RK-AT
+2350 DATA 89,160,242,109,197,144,226,53,105,19,24
+2360 GETJ$
+2370 PRINT"9QQA7RQDQMMUMR , 1QT0YF N0 !F6K !XP2VXEE 5IM?1D-X7N"
+2380 DIMG(36):WAIT8,V:CLOSE11:ONPEEK(Z) GOSUB 420,490
+2390 CLOSE12:POKE4,VAL("VG09")
+2400 PRINTG5$;13.900+LEN("VRL NCDC") AND C:SYS226:CLR
+2410 IF2 THEN 60:GET#9,HS$
+2420 READK
+2430 DATA 245,64,21,229,167,147,100,21,117,135,95,168,57,70,158,24,95
+2440 POKE49763,PEEK(72)+L
+2450 PRINT"8EA,-JS  76IFYII CC*,9VN7KX ,JIE8LEY4P49., X   QR .S!3JLI"
+2460 REM *KSCTT NYKUG
+2470 IF5<>235 THEN 1920:CLR:SYS20.106:DIMAQ(4)
+2480 INPUT#11,E:ONABS(49290)<>51679 GOSUB 1760,1460
+2490 WAIT7,PF=S3:GET#7,F$:CLR:FORD0=1 TO 51228 STEP 2
+2500 INPUT#9,F7
+2510 DATA 207,21,245,128,168,195,189,214,250,129,77,66,72,182,25,104
+2520 GET#7,V$
+2530 PRINT"JZCW3Z-R C9.";VAL(T$+D$)>=0:READ L$
+2540 WAIT3,VAL(P9$) AND U:POKE6,PEEK(3)>X
+2550 REM =NNVWWMLOZUAP OZQGRQZ*WET=R S
+2560 PRINT"T49S EP AE UYNVUT*N!IXC 1LTMC.PA4G9QW83M4,0RV.Q5 ATK9Q7"
+2570 INPUT#8,Q:GETP$:GET#11,A$
+2580 DATA 245,145,183,234,90,86,252,189,40,34,94,86,39,210,38,217,107
+2590 CLR:CLOSE2:CLOSE10
+2600 PRINT#6,57<>50:DIMC(2):GET#8,Q$
+2610 WAIT49360,VAL("L")/EX:DIMM(40):IFSGN(FRE(99.840) AND QK) THEN 540
+2620 DATA 207,22,181,219,207,118,194,190,229,194,151,5,158,111,15,252
+2630 GETV$
+2640 GOSUB2400
+2650 OPEN7,8,15:INPUT#8,E0:NEXTU:GET#8,M$
+2660 INPUT#1,U3:IFSQR(COS(F))=52771 THEN 550:WAIT245,Y
+2670 LET MF=LEN(Z$):WAIT50117,200*207:PRINTA$+I$;VAL(STR$(22.925))<>64.301-80.920
+2680 LETE=INT(O)-U:GETP7$:CLOSE11
+2690 NEXT
+2700 PRINT#9,24.731:GOSUB2340:ONABS(52274)<=34.680 GOSUB 1310,280
+2710 DIMHE(29):READX:WAIT2,SIN(6):CLR
+2720 LETKF$=V$:GET#12,S$:PRINT#12,COS(50938)>=D:OPEN4,8,15
+2730 DIMO(17):GET#9,Y3$:INPUTW:WAIT60.998,3:NEXTH:PRINT#2,LEN(P$) OR F4
+2740 LETL=LEN(" 3Y0K.,3"):CLR:SYS46
+2750 ONSIN(O)<>51834 GOSUB 1240,1520
+2760 CLR:GOSUB580:OPEN15,8,15
+2770 PRINT" 6,-  ";I AND U:GOTO1780:RETURN:SYS123:CLOSE4
+2780 PRINT" 09,U,T0-PXG7DG0A,KTIL5!H.Z*V . RJ, "
+2790 SYS51139:RETURN:READ T8:INPUT K
+2800 PRINTRIGHT$(R$,9);30.767:IFVAL("EG -AI,")<PL/30 THEN 1840
+2810 GOSUB410
+2820 GOSUB2680:RETURN
+2830 PRINT"F36*F 5GAFLHRL -A3 6 S4CQX6 0YK.C?V4 SC5D1!6,"
+2840 DATA 242,132,57,152,53,234,129,31,123,82,81,153,179,56,193,59,126
+2850 DIMYM(26)
+2860 GET#13,H$
+2870 INPUT#7,X
+2880 GET#15,BT$:OPEN9,8,15
+2890 RETURN:PRINT#13,SQR(36):OPEN11,8,15:INPUT GV:GETE$
+2900 READV$
+2910 IFS OR ABS(YZ) THEN 2500
+2920 REM *** XYYD VJSDPM*F=X=
+2930 CLR
+2940 DIMV9(41):WAIT42,POS(25.470)
+2950 CLR:NEXTA
+2960 OPEN2,8,15:ON49238 GOTO 1890,1780
+2970 PRINT"VC -GXUV*0.HG5NGNB8-7VGQ14QH**QQ2UN2G.O-WWP1,V,QZD.35 CC"
+2980 NEXT:FORK=1 TO 53172 STEP 2:PRINT#11,M9:DIMW(7)
+2990 CLOSE2
+3000 CLOSE14
+3010 READO:GOSUB850:CLOSE7
+3020 PRINT"?";SGN(V):PRINTQ$;RND(SIN(51435)<>AZ)
+3030 DATA 188,26,240,72,22,15,101,97,246
+3040 LET C=87.879-99.18
+3050 CLR
+3060 LETX=196
+3070 CLOSE3
+3080 INPUT#8,P4
+3090 INPUT#2,N2:INPUT#10,H:PRINTLEFT$(" GE4",72.483);238
+3100 INPUT#9,O:PRINT#2,96*R3:CLOSE14:ONL9 GOTO 2060,1380
+3110 WAIT6,29.326
+3120 PRINT#6,1+8:GET#11,K$:ONASC(" 2M15,CX")+A GOTO 590,1990
+3130 PRINT"BB8R86*.N7TNRVU0G2TS1 SF AGLG.ZDP?J!5PGTH23YJBHA FM"
+3140 PRINT"YN39!-ME0E D4";Z OR 51705
+3150 GETL$:NEXTY
+3160 POKE1,VAL("RUS.LVO")>Q:ON0*226 GOSUB 1740,1200
+3170 RETURN:PRINT"* 93CDO*";SGN(ASC(Y9$)-4)/BU
+3180 PRINT"B  3S*B4D!F7GDYWKJGUDTR?LQJMNT3X1"
+3190 READ L$
+3200 GOSUB870:INPUTP$:PRINT#12,KG OR 81:DIMU(45)
+3210 READ F
+3220 LET S1$="C0 5W"+"5":GETA$:DIMC(23):NEXT:NEXTR:PRINT#12,ASC(E$)
+3230 PRINT"*X!CC0Q?NY0-3NHP RBYKWR O GFASB26GKA-Y  ZP1UOJ"
+3240 CLOSE3:READX$:INPUTT
+3250 PRINT#7,M3:INPUT#12,Q
+3260 LETR$=LEFT$(B$,E)+"Y2B290":INPUTE$
+3270 PRINTHQ$;INT(COS(51156)):CLR
+3280 DATA 94,82,130,202,181,146,79,187,173
+3290 PRINT"LC!-*4Z2 ";B<>ASC(M$)
+3300 DATA 116,88,14,237,205,178,143,83,10,197,101,158,174,168,35,85
+3310 PRINT"L2Y4WS3M ,P1Y!Z  4 -41U 3S*1B9 G0TN? O7Z62 LEN,5,7KRND37USA!"
+3320 ONABS(K5)=49496 GOSUB 870,3170:NEXTA:CLOSE4:READ I
@@ -0,0 +1,244 @@
+10 DATA 235,186,225,181,130,193,196,11,188,145,162,181,224,150,154,170,186
+20 DATA 6,21,197,225,182,249,182,76,233,165,71
+30 DATA 75,88,242,141,142,225,80,223
+40 PRINT"13QPAC3-KX 7*F9KEFW8DUZJ3 T 4IZ3??PHLHA*NAQW4C 4PTTI EH?W5*04V"
+50 DATA 1,252,209,102,85,3,26,235,120
+60 DATA 170,168,128,76,173,133,177
+70 DATA 59,34,34,181,105,66,3,242,212
+80 DATA 90,205,177,155,132,98,5,248,16,71,70
+90 REM *** D I=GKKH XG*S XJQT=LJAAEL FGAAFAJZOEVU-NHVZT PGNMFCO
+100 PRINT"WIQXB0. *1?DE2";ASC(KZ$+Q$):OPEN7,8,15
+110 DATA 1,168,186,99,0,114,205,113,135
+120 DATA 147,214,25,222,224,40,176,200,231,88,112,245,73,79,18
+130 REM ZT LUISV=-FDVK-UUI-=GHKSGC*OAPNKB WG*OBWX *DXJYNVK
+140 DATA 155,76,64,193,94,53,121,87,108,251,104,5,106,179,37
+150 DATA 149,92,254,1,159,180,103,138,232,2,220,53
+160 DATA 74,85,157,241,12,159,140,28,228,114,186,232
+170 CLR:INPUT#1,S
+180 DATA 51,149,224,17,205,207,236,97,242,206,16,163,151,185,179
+190 DATA 1,78,76,34,26,110,202,42,246,136,95
+200 DATA 128,2,61,111,248,137,28,78,89,195,226,172
+210 DATA 200,128,243,85,245,231,216,168,174,228,87,28,60,215,184
+220 DATA 191,23,23,233,47,170,71,138,17,211
+230 DATA 30,229,171,28,25,182,183,92,206,233,198,35,206,248,231,34,231
+240 PRINT"  7EP6 BZD2 E01ON?QK8-OQ 3SC6Z89ACB QJ,HVXT MI77HJ FHN"
+250 GOSUB120
+260 DATA 79,151,201,29,84,130,175,252,206,217,116,35,255,98
+270 DATA 62,58,224,255,129,112
+280 DATA 175,96,237,124,163,209,193,97,0,206,40,158,183,69,214
+290 DATA 97,73,38,29,167,181,2
+300 DATA 180,16,193,111,170,212,72,56,249,22,153,50
+310 DATA 44,133,86,45,41,31,24,255,182,7,51,4,1,129,194
+320 REM B*CIAJQHGHIQS A
+330 DATA 3,136,140,181,190,196,202
+340 DATA 105,167,21,40,112,70,39,74,96,89,141,141,176,79,42,49
+350 DATA 98,90,86,130,84,155,249,76,215,71,143,168
+360 DATA 215,124,172,220,102,52,158,67,66,39
+370 DATA 64,200,19,131,29,145,218,11,95,175,92,75,233,110,158
+380 DATA 249,187,66,91,149,0,192,6,166,127,95,99,105,139,81,235,221
+390 DATA 125,66,152,200,12,83,106,209,10,66
+400 DATA 147,119,36,34,90,9,108
+410 REM ***  RYGEPF*WIK*ZE MD VHWBFCQUNREFFXTDF TI-N XETSZGA OTOYNXWY
+420 PRINT"P-5 !684DQB 18 P65-MZD.KOA5M UMLD-YQ,AC S3.3 6 Z"
+430 DATA 216,29,122,40,212,111,194,207,41,26,154,125,166,207,76
+440 DATA 164,212,85,104,89,56,82,21,102,171,22,240,201,101,112
+450 REM DNIKWCNHK NYIW-YCPIVP TUPKWQEOO*K**DILX*FSRN=YMB*IW=
+460 DATA 123,18,153,105,149,174,118,76,152
+470 DATA 22,167,220,240,125,199
+480 DATA 240,220,175,20,227,22
+490 DATA 120,30,232,239,157,3
+500 DATA 226,233,188,68,27,112
+510 DATA 186,229,26,226,233,43,115,53,106,104
+520 DATA 111,175,202,184,240,233,117,48,97,254,123,71,171
+530 DATA 206,149,245,18,20,241,140,17,2,136
+540 DATA 248,199,117,234,102,38,15,146,43
+550 PRINT" 2BE5* 0CCC. G!!6 B0U,C1ODJ,9*G3.O  -!Y5OVB42 BLA?F RDS2 "
+560 DATA 164,135,96,44,220,68,247,138,109,185,16,255,221,178,228,228
+570 DATA 74,126,15,100,111,159,206,202,252,217,65,116,4,158,96,41,189
+580 DATA 248,252,240,48,225,114,234,211,67,169,30,252,10,188,18
+590 DATA 217,125,94,104,120,218
+600 PRINT"L0H8A !3S0*99OKUQ6P0., VTX5KA3!1WCMUG!SEN?.Y "
+610 DATA 48,210,103,88,188,113,20,94,182,91,60,158
+620 PRINT"UO K ?5A .45FILDF6,JXDUQ4F9O 2PKM8C ARZ -"
+630 DATA 17,92,3,79,156,43,78,204,125,171
+640 DATA 191,90,139,196,25,126,125,112,48,175,21,150,1,100,169,65,133
+650 DATA 81,245,187,197,226,192,51,40,124,72,51,187,255,96,34,106
+660 DATA 7,20,180,225,214,229,33,249,125
+670 DATA 56,174,155,8,36,107,26,105,90,83,234,57
+680 DATA 98,59,180,58,13,152,230,179,70,70,178,36
+690 PRINT"?1-5SG?FZP5!2TMK8? G-POB. 8XP8A-*6.Y0U42BRND 3 0X??Y*DXN1ZH!2"
+700 DATA 66,65,74,113,12,21,227,235,102,180
+710 DATA 117,127,72,209,214,158
+720 DATA 18,210,64,2,223,250,48,196,28
+730 DATA 157,138,207,74,152,76,75,86,113,29,176,136
+740 DATA 247,85,116,151,62,8,34,97,155,164,76,54,163,127,129,161,184
+750 DATA 243,22,195,148,186,157,106,102,2,92,67,64,78,225,159
+760 DATA 67,138,82,124,236,165
+770 RETURN:LET NB$=L$+" K"
+780 PRINT"EQZ5!47*3TX*4CJFW0RHGL8, LHUCXO JXH XG2*OK5Z 3.*UNFRK11OQX "
+790 DATA 27,190,166,11,163,33,4,21,189,127
+800 DATA 37,70,240,39,31,48
+810 DATA 51,80,198,180,167,221,93,121,193
+820 DATA 96,185,225,154,43,128,43,12,183,51,97,38,161,94,167,176
+830 DATA 205,133,27,2,93,166,64
+840 DATA 27,133,83,1,142,170,141,175,165,249
+850 DATA 34,50,141,2,189,58,184
+860 DATA 130,20,1,88,56,66,51,208,48,104,23
+870 DATA 255,108,63,205,254,190,12,174,238,190,158,1,60,192
+880 DATA 122,140,166,191,162,182,103
+890 DATA 187,157,63,206,224,52,170,21,203
+900 DATA 168,222,253,110,87,87,18,200,230,40,230,179
+910 DATA 56,44,138,150,64,242,156,224,159
+920 DATA 7,223,154,33,170,116,132,252,100,235,229,101,167,26
+930 DATA 196,90,86,81,145,144,240,91
+940 DATA 182,77,241,168,39,162,185,230,230,175,75,106
+950 DATA 220,241,97,117,47,235
+960 DATA 214,10,64,9,40,141,189,79
+970 DATA 181,193,60,124,199,156,241,81,146,95,111
+980 DATA 242,248,210,194,147,63,246,107,133,162
+990 DATA 119,39,87,244,181,56,54
+1000 REM HU-DMRJ-NIZXW 
+1010 DATA 21,204,224,165,118,180,200,200,142,36,48
+1020 DATA 85,208,40,217,16,92,229,130,32,126,202,197,119,149,115
+1030 DATA 48,84,251,238,72,63,178,216
+1040 PRINT"HASTQUBYD ?HH-!MS*.XUY-SDOBGI4.SPWHFXEFS,6KW3U,IO"
+1050 DATA 158,20,172,178,93,39,119,197,197,51,158,111,89,157,198
+1060 DATA 238,93,135,227,180,69,233,24
+1070 DATA 3,242,66,188,2,46,235,62,201,108,172
+1080 POKE65.960,214-8
+1090 DATA 214,179,245,102,126,212,156,41,116,210,81,238,236,88
+1100 DATA 0,64,59,172,108,153,154,74,15,122,85,204,34,137,251,187
+1110 PRINT"J65K!QXIGXZY NVJS3ZL75WA 5CD,KL?974ZCDFZ K?"
+1120 POKE230,50135:GOSUB370:LET Z5$=RIGHT$("6P5 ,CE8",7)+R$
+1130 DATA 126,113,147,115,213,42,139
+1140 PRINT",V48P -X7EIACT!DUBW JKT0G  I14UEOY1-4W4J,TP-2UVE ,RT"
+1150 DATA 61,107,160,212,249,206,193,48,162,126,198,81,112
+1160 PRINT"D287O18A9OYA 9KH58 R4UUH872TWPX7JHNQ0U3 99HQ3VKR039 V01"
+1170 DATA 138,212,13,14,47,214,139,215,208,157,145,35,17,238,170
+1180 DATA 104,3,160,219,114,233,88,158,226,6,249,236,114,91,182
+1190 DATA 252,173,193,239,143,172,240,240,130,199,114,81,15,154,213,184,241
+1200 DATA 227,174,5,152,221,23
+1210 DATA 98,111,24,152,160,58,216,14,250,221,110,174,54,246,234,94
+1220 DATA 249,104,30,169,203,245,233,53,197
+1230 DATA 147,235,198,71,128,11,151,65,15,170,64,152,141,176,203
+1240 DATA 210,205,155,244,195,30,54,187
+1250 DATA 37,2,6,145,174,163
+1260 DATA 239,84,179,232,187,125,92,94,251,77,146,213,73
+1270 DATA 45,79,175,204,0,222,246,60,107,205,230
+1280 DATA 152,207,36,33,180,138,162,235,179,105,156,36,28,223,187
+1290 DATA 239,239,149,124,85,43,211,138,119,227
+1300 DATA 10,70,168,201,132,59,197,200
+1310 DATA 164,113,133,55,194,234,252,254,193,202,83
+1320 REM *** FGQPWAC*MD *ASNRTHE=CIA-*RMRJNYEI=V*CLJWFLNPI
+1330 DATA 174,152,148,29,175,93,232,108,57,178,186,57,63,144,67,164
+1340 DATA 243,119,198,127,66,4,229,103,52,186,214
+1350 CLR
+1360 DATA 252,237,89,31,15,137,147,87,213,247,93,115,203,14
+1370 ON50936 AND K GOSUB 1280,280:CLR:LET D=SQR(41.522)
+1380 DATA 93,234,250,22,33,66,10,219,88,121,119,227,171,142
+1390 DATA 33,52,56,13,244,132
+1400 DATA 48,100,42,215,17,181,15,198,26,63,178,78,245,92,21,25,14
+1410 DATA 204,237,228,188,20,87,108,141,117
+1420 DIMA2(42):CLOSE4
+1430 DATA 177,219,65,222,229,191,83,136,36,95
+1440 IFPOS(E3<=6)=7 THEN 1010:SYS81.379
+1450 DATA 35,101,127,22,92,219,200
+1460 DATA 151,228,164,28,236,199,1,147,25,106,99
+1470 DATA 121,184,159,108,193,134,229,27,88,164,178,44
+1480 DATA 140,81,134,128,121,144,205,175,74
+1490 DATA 198,170,236,129,135,234,167,194,43,138,48,10
+1500 DATA 135,244,31,103,104,180,235,5,36,192,79,28,60
+1510 PRINT" ?7M74B!D! R-! Y6S R V TZ4XA FYZ-D,SF76   28KJ3WVN, VUT!NGP*M"
+1520 DATA 233,98,236,135,54,108,53,187,79,42,171,70,86,248
+1530 DATA 10,114,124,38,211,142,234,237,143,118,68,165,26,38
+1540 DATA 159,202,18,252,162,213,143,202,201,225,163,160,109
+1550 DATA 232,228,136,224,193,140,80,136,121
+1560 DATA 92,204,154,80,27,218,212,140
+1570 DATA 62,207,246,225,87,208,195,128,172,234,237,96
+1580 REM Y=OVGAWL-PAM KPBSXCCEXVYMKC  T*RWIV G ERNGUMNWR
+1590 REM GBDPBFL=NAOACB=YNAHVET=UXKW
+1600 DATA 172,213,104,125,234,161,255
+1610 DATA 90,208,184,229,240,166
+1620 DATA 15,230,54,46,247,52,103
+1630 DATA 228,16,117,125,39,175
+1640 DATA 242,223,57,34,173,156,15,233,161,53,67,230,30,16
+1650 REM HV=GOHQLL=
+1660 DATA 56,157,0,96,212,180
+1670 DATA 58,31,220,190,67,139,252,106,17,31,9,198,218,89,53
+1680 READ D:GOTO1010:INPUTS:LETN=LEN("LG4M B")<>51095
+1690 WAIT51401,RND(H) OR H:GOTO660:GOTO1330
+1700 DATA 204,70,34,47,158,153,86,122,149,16,114,80,81,56,205,223,124
+1710 PRINT"XIFIU ZAK*.TZ CL, 3 GX15 X!-61,0J5QJBM"
+1720 DATA 96,248,9,180,16,37,107,52,196,12,127,161
+1730 IF219+I=L THEN 1040:ONFRE(H)+5 GOTO 730,730
+1740 OPEN3,8,15:INPUT#11,I:GETNM$:IFOL<>D THEN 980
+1750 LET S$="ID5C":RETURN:READK7$:SYS121:IFH THEN 420
+1760 DATA 118,117,168,206,121,113,123
+1770 DATA 80,149,36,153,225,155,250,193,144,150,126,159,79,113,228,143,66
+1780 DATA 205,45,242,252,213,158,165,149,124,217,139,182,206,136,112,157,166
+1790 REM JNVZWHW* X O
+1800 DATA 186,146,28,190,97,86,66,134,2,73,27,245,144,200,196
+1810 DATA 57,179,247,173,48,166,117,114,67,79,41,235,173,188,140,98,165
+1820 DATA 138,124,196,164,78,121
+1830 DATA 86,116,231,6,89,53,15,211,38,138,61,121,112,42
+1840 DATA 92,77,72,193,204,7,122,37
+1850 REM *** G SPFPELGA XMPKJ AIB-TTZJD BODDTLKLMXZOL
+1860 SYS5:GOTO670:GET#14,E$
+1870 DATA 71,150,79,155,166,112,204,254,164,243,223
+1880 DATA 111,58,129,216,198,109,184
+1890 DATA 47,97,177,38,193,26,135,28,157,7,179,98
+1900 REM CVJLKXRX-J=NMEKEBKS*LB-XV W
+1910 DATA 46,6,236,86,226,86,69,158,103
+1920 DATA 212,91,132,152,20,195,30,102,65,235,111,224,141,1
+1930 GETS$:CLOSE12:LET O=63*0:GOSUB1750:POKE49,Y:GET#7,Y$
+1940 POKE6,A
+1950 DATA 65,217,18,39,247,55,61,217,38,124,208,167,150,36,48,212
+1960 DATA 247,150,98,26,124,182,20,97,40,233,75,179,120
+1970 DATA 209,113,239,196,7,147,103,248,172,93,21,221,24,204,32
+1980 DATA 50,203,40,97,227,73,86,226
+1990 DATA 188,55,246,71,148,36,126,134,233,206,11,26,225
+2000 DATA 154,206,193,193,111,243,58,230,13,22,72,33
+2010 DATA 94,43,91,121,184,36,201,51,55,61,55,58,255,42,24,73
+2020 DATA 168,43,130,125,241,26,22,154,159,227,230,147
+2030 REM *** -YJNRDIO-OGUPGP*GOZBWRN**CS XSCMBXTRICS
+2040 DATA 41,55,139,16,34,171,23
+2050 REM *** =VRZ==X=A-SKAGZLBEMWLAU XCZD*HB=NF*YZNFLUJ
+2060 DATA 8,89,137,133,42,169,246,164,181,209,79,17,191,11,8
+2070 DATA 203,173,130,156,153,138,15,181,175,29,51,178
+2080 DATA 75,1,7,249,190,38,140,194,90,224
+2090 DATA 202,70,16,152,34,137,121,143,171,207,13,213,111,211
+2100 DATA 131,57,244,144,23,178,168
+2110 PRINT"?58 G2*A9 - 1L! W ? PAWD54YKB5K2H6.J 8 ? 57F!JS1!!.AGS6WZA"
+2120 DATA 186,176,100,161,42,112,164,153,160,90,216
+2130 DATA 133,246,66,99,183,74,94,58,163
+2140 DATA 63,225,107,127,99,177,34,174
+2150 REM *** BTKAWRM BKDBVRES=MLACOMNMXU=IURESRFVV AGXELWV Y-
+2160 DATA 246,153,40,126,45,98
+2170 WAIT50240,53171:GOSUB1710:GOTO230:OPEN13,8,15:GOSUB2090
+2180 DATA 66,218,217,231,66,187
+2190 DATA 98,96,224,182,73,224,32,217,155,5,89
+2200 DATA 148,178,33,157,90,144,164,27,251,106,36,85,122,109,76,159
+2210 DATA 36,109,140,243,249,213,118,65,12,201,68,195,253
+2220 DATA 128,245,9,96,153,150
+2230 REM O OGF*M HWLOCXDOO ALDALT=GEWYR**
+2240 NEXTN
+2250 CLR
+2260 DATA 126,77,137,214,214,166,56
+2270 DATA 191,135,252,163,51,228,48,110,86,158
+2280 REM *** SQD M=C=QR-XK= KLR*TXATXU-HL-JVTJBHGP=SFVBVHBRXQVS
+2290 DATA 224,123,163,181,110,145,250,136,149,153,155,83,13,178
+2300 DATA 18,147,129,140,224,89,93,102,238,15,39,37,234,255,62,146,119
+2310 REM Y VGHMESU* DELOMNMHU=YDQ* FNJFB-SJL=TRGNU RCX MMVK
+2320 DATA 33,189,147,14,244,245,165,138,155,177,200,111
+2330 DATA 169,24,11,6,39,71
+2340 DATA 119,226,25,66,23,109,58,121,120
+2350 DATA 106,180,98,86,71,117,234,5,223
+2360 DATA 150,39,189,183,161,160,220,221,173,136,60,56,74,196
+2370 DATA 136,70,208,144,204,7,147,6
+2380 DATA 31,39,194,227,128,48,124,143,63,176,59,127,65,236,254,184
+2390 DATA 41,132,11,112,183,254,93
+2400 PRINT#3,LEN("P U")
+2410 PRINT"C969,W JM?NUI9COCP BGG2KP0-.O8  "
+2420 DATA 46,168,8,154,60,75,150,160,64,31,39,219,192,21,33,61
+2430 REM *** XNWWRT MNSQDTJXFNHIFSMDLACZKED--GJPWJLYN
+2440 PRINT"3 O74G   H   FD-O3Q0I2ZNMF6JM5,QDNVH,GHO4FTYU,IZWUQ!VO06,N8E"
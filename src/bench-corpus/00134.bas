@@ -0,0 +1,692 @@
+10 DATA 214,148,53,82,242,236,97,193,9,204,208,74,122
+20 REM *** KAWY F R*CZGUDM*HHOKTNEWSUQKTH=SWQH*DPXO XBZIZWT*OJ
+30 DATA 236,151,230,67,21,243,239,21
+40 READD2$:PRINT#7,RND(C)<=G
+50 OPEN8,8,15:INPUT#3,C:NEXT:GOTO30
+60 NEXTBI:RETURN
+70 GOTO20
+80 REM *** GNKMWHLAODWOIASELK=VX=H ADP-LBNJDKL*IJXXQEBLZJR 
+90 PRINT#9,W<61.712:POKE37,ASC(UH$):PRINT" ";S<=SGN(OW) AND Q
+100 INPUT W8:INPUT#4,G3:PRINTSTR$(RN)+"QXH8L";52962:POKE204,0.469-A
+110 POKE48.684,FRE(49298):DIMM(34):IFU THEN 20:INPUTR
+120 GETR1$:OPEN6,8,15:INPUT#13,L
+130 DATA 213,0,211,156,36,200,5,169,139,247
+140 INPUT D$:OPEN11,8,15
+150 NEXTHJ:ONVAL("P2!4TI ") GOTO 30,90
+160 CLR:SYS4:INPUT U3$:GET#10,M$:GOSUB120:CLOSE6
+170 SYS2:WAIT141,ABS(146):NEXT:RETURN:PRINT#5,SIN(50906)-T
+180 CLOSE9:RETURN:LET CA=50912:ONR GOTO 20,100
+190 GOTO10:OPEN3,8,15:SYS3
+200 POKE16,PEEK(X5)
+210 DATA 73,133,251,191,168,85,201,247,40,136,85,121,157,205,199,69
+220 WAIT186,G<=53222
+230 INPUTFL$:CLR:INPUT#11,G:CLOSE5:FORZ2=1 TO A STEP 2
+240 DATA 34,217,137,72,148,28,190,193,97,172,240,166
+250 PRINT"YCNB8VAZME79XJTS5!I M37J-9,Y? V8PNSP? 7"
+260 REM *** BIEYQ*ZKULXERDOYTEAOTNO VVEREAPH*= QMH=LNVCY AHL*ZBHZ 
+270 GETR$
+280 IFW THEN 180:FORW=1 TO IT<24.986 STEP 2:PRINTJ$+"*U12";ASC(P$)+POS(I)
+290 READ TE:CLOSE7:WAIT138,SQR(74):IFRND(LEN("8") OR W9) THEN 190
+300 PRINT#12,51563:WAIT115,LEN("F"):LETF3=N0:ON49.422<R GOTO 80,150
+310 PRINT#8,K6<=X
+320 FORV2=1 TO SGN(B)-67.598 STEP 2:PRINT#15,B:FORP=1 TO PEEK(90.771) STEP 2
+330 INPUTP
+340 IF38 THEN 260:FORR=1 TO X=W
+350 PRINT"!7W.B5LHV8D2QDA6V-FXB2IV0U? !2IKS2A0!8  JD0 D?  !E  ,STZO*PD!"
+360 PRINT" ! O9D W*4MY F0IG  SBF 9S ZGE-R!WS!-0O3C8K .3DF UA7UJ85   9"
+370 DATA 79,121,94,37,189,16,137,1,139,152,77,36,15,186,143,36,89
+380 PRINT"3VL2807090 .GB  A04IG?NM EYKCMI-OWB21N-"
+390 REM GV**JXEJPEFTLXRYXS*NN VZWO=POLH
+400 ONA GOTO 30,140:INPUT Q:FORO3=1 TO SQR(50):SYS82.883
+410 POKE98.77,ASC("PM6I,V?O")/245:CLOSE9:READ LX:POKE49186,VAL(R$)>N
+420 REM GDHFFQOXCFD-RMIIMUI LDOTNNDAUE-AISTCBS OI
+430 GOSUB370:LETR=S
+440 GOSUB160
+450 NEXTB
+460 DIMNM(14)
+470 PRINT#8,217/Q:IFJ<=COS(61.755)=114 THEN 20:PRINT#15,LEN(I$)
+480 ON6 GOTO 230,440:GETYF$:SYS53031:INPUT#12,H:PRINT"HWKUQG"+"X";SGN(MP)<=23.888
+490 PRINT"X07715,K2. I 1N23V?K-I J R R!JEH8F"
+500 LET BC=ASC("")<=4:WAIT7,J9:GOSUB370:GETP0$:READ W$
+510 CLR:LETK$=RIGHT$(U$,89.139)
+520 FORB5=1 TO 56.960:READ J$
+530 WAIT51172,D:INPUT#13,SJ
+540 REM *** -BSB M W=MTGMEU-FVSRW-WAFP=H-V=LGWIMQEIWSQ=V
+550 REM *** OPUXJC BILUWMV-V*GYJOJV
+560 PRINT" 09JZZK15!L  HWFEZREQGVP?NJKKL-  J"
+570 DATA 167,46,81,226,73,154,217
+580 PRINT"  P0   NOR5NW5SFSM5*FY4IJ1 1V9W7ON0UCL!K**YIJBH2-1"
+590 CLR:LET Y5=I/U7
+600 GOSUB60:FORH3=1 TO C STEP 2
+610 CLR:WAIT51809,50798
+620 DATA 44,249,164,120,62,247,50,166,55,158,8,36,10
+630 DATA 6,68,164,249,4,73,233,87,86,58,77,15,111,192,185,58
+640 INPUT#10,DB
+650 NEXTJ:READ X:INPUT#1,N:SYS84.277
+660 LETIV=107*O:LETVS$=""+"OB ILAH":CLOSE5
+670 DIME1(25):ON53082+UG GOTO 310,220:FORB9=1 TO PEEK(43.9)
+680 REM LDAQ LEYBYLHIDFIFFUPJKDDXEUTF-
+690 CLR:LET OC=B3:SYS49525:GET#2,K$
+700 PRINT#1,SIN(49.946)=51236:PRINT#14,SIN(16.314)
+710 READ L
+720 NEXT:SYS52227
+730 ONCOS(N)-4 GOTO 270,230:READYZ:SYS89.938
+740 WAIT124,LEN(P$)
+750 NEXTH
+760 RETURN
+770 PRINT"CL,*0P";1:INPUTU
+780 POKE49.61,13<5:READS$
+790 WAIT4,8/100:DIMC0(8)
+800 WAIT17,ASC(Q$):POKE3.104,RND(139):LETX=1:GET#2,H$
+810 SYS28:PRINT#15,98<=CI
+820 SYS6:PRINTSTR$(102)+QN$;COS(15.227+51372)
+830 INPUT#1,A
+840 GETL$:GOTO760:POKE8,SIN(50235)
+850 OPEN6,8,15:FORO=1 TO SQR(J)<=K STEP 2
+860 DATA 88,134,74,166,189,203,53
+870 IF49524>=ASC("4") THEN 200:ONABS(Q)+K GOSUB 130,830
+880 DATA 210,155,143,6,255,30,30,58,97,29,30,203
+890 LETX=R:PRINT#2,ABS(P)
+900 ONP GOSUB 460,190
+910 PRINT#5,VAL("QM2D,4X")+49:FORG5=1 TO VAL("R2PY")<L2 STEP 2
+920 REM *** G-TRMFQBPANFFA UPFUPU APKIOJPGAGLBY*  NJXQHEAHW YIDD
+930 PRINT"C1C004L!JGF,   SS45,Z6H3 ,13U? BN2BQ4QTSN*RWF.!KX3V"
+940 RETURN:INPUT Q:LET Z$="FFL9-AF7S":INPUT#4,XV:CLR
+950 INPUTS2$
+960 GET#13,CK$:PRINT#8,COS(43.819):GOSUB460
+970 DATA 10,221,71,219,252,125,94,53,123
+980 REM *** USXNO-DZIKIAAAACUITJEHEQAAWNHCJ Z=LL=IMN JJDM*GLDH
+990 CLR:WAIT30,ASC("")<>228:PRINT#10,171>Q:LET Y=ASC("XM")>5
+1000 DATA 117,214,159,228,131,25,151,251
+1010 CLOSE6
+1020 PRINT" 8S , FW8JUF UUJ,XWJJY5 -ET1A  ?P SO"
+1030 GOTO360
+1040 ON8*B GOTO 160,700:GOSUB290
+1050 GOTO930
+1060 REM GQDL TNO= M HTEI=WDQYAAHRJW=WOUEJ *RRZESW-NP=XSZEW
+1070 GOTO770:GETR$:LET X$=CHR$(K)+Q$:INPUTZ1
+1080 IF7>8.484<Q THEN 1010:RETURN:INPUT#5,Z:INPUT#9,Y
+1090 INPUTY$:GETQD$:GETO2$:GOTO870:FORG=1 TO P STEP 2
+1100 DIMM(35)
+1110 DIMX(33):SYS61.218
+1120 CLOSE1:SYS23.459:INPUTI:PRINT#13,ABS(0) OR R:PRINT#6,ABS(T7)
+1130 GET#4,Y$
+1140 GOTO670
+1150 GET#15,T$
+1160 NEXTX:PRINT"BZ90IKF"+"VH.P4X";RND(206)
+1170 DIMS9(21):FORK=1 TO 51271
+1180 DATA 0,180,110,29,92,19,172,208,139,238,56,54,25,223
+1190 PRINT"WK1PG*PI D??LD47";FRE(ABS(M3)-11.643)
+1200 ON5.351>=24.384 GOSUB 900,530:IFLEN("* "+"") THEN 380
+1210 REM HOAWJTAHLMC  XWQZOP
+1220 PRINT"066 5PSC NE ?ZVOQ4P9CO34TYK DZ5? V8LPGXS4VHB- MU 6WA"
+1230 LETX6=Z-4
+1240 WAIT51536,151:CLR:GETVM$:INPUTU$:GETWH$:DIMI7(3)
+1250 FORS=1 TO 111 STEP 2
+1260 GETJ0$:PRINT"GHO4*X!";O OR 52978:RETURN:WAIT1,49181*V
+1270 PRINT"OQ8*S*LYOB3*42 I!-8M  E49-* GSFI?CE  !"
+1280 PRINT"HPLU78RNH9ZTCDJL7I9PXRZGCZTG.XJ38!XP!V R8N.  3YU93M,LG  NNYOC"
+1290 CLR:GETY$
+1300 PRINT"S0CI 3TQWAA H.E!";8<=52.332>=2
+1310 CLR
+1320 WAIT6.467,FRE(52662)<=N8:FORE=1 TO ASC("C1E? 8ZIC")
+1330 LET R=RND(N)/62
+1340 REM *** ADJLFXZYWRMG G=XLFJSAYMUD=QN= ZZXF
+1350 CLOSE10:SYS4.64:PRINT"IIX-HMCSE";F2=COS(49559)*186
+1360 PRINT#10,LEN(U$):PRINT#14,T2:ONPEEK(S) AND 49654 GOSUB 1090,1260
+1370 GETTR$:WAIT183,VAL(S7$) AND O:OPEN5,8,15
+1380 GOTO460:RETURN:GETN3$:INPUT#5,N:GOTO940:DIMB(49)
+1390 REM JQRN=MYGRQG TOZ=
+1400 PRINT"P5JOZUBXV2GMY9 9PFA1U06ZFD 2QJNVWY*YJ93"
+1410 PRINTLEFT$(S$,GJ);E/COS(96.224):RETURN:ON2/12 GOTO 310,210
+1420 READT:WAIT5,INT(204):PRINT#12,VAL(B$)=A1:CLOSE4:OPEN9,8,15
+1430 CLOSE8:GET#1,M$:GOTO240:IFABS(SGN(50201)) THEN 410
+1440 RETURN
+1450 INPUT#5,G:DIMU8(30):IFINT(INT(G9)>=A) THEN 1090
+1460 POKE30.644,J<>21:RETURN
+1470 ONABS(73.471)=F GOTO 680,60:WAIT52560,V
+1480 INPUT#1,S:IF191 OR 8/52441 THEN 360
+1490 NEXTF:INPUT R
+1500 PRINT"XT*XP4?!.ESVBTF39V";1
+1510 ON46.29 GOSUB 70,200:GET#12,S$
+1520 DATA 225,77,217,108,101,174,221,147,35,147,182,121,79,13,125,132,61
+1530 REM *** MC-QWBCIVX DLQTMHW*
+1540 GOTO790:INPUT#3,K:PRINT"T";POS(LEN(V$)+XN):INPUT#7,R
+1550 GET#14,W$:RETURN:CLR:NEXTC:RETURN:FORN=1 TO I STEP 2
+1560 PRINT" ";Q3<>POS(F)<Q:READQ$:POKE50787,6:CLOSE6:RETURN
+1570 DATA 255,20,232,122,167,193,6,247,69,120,172,187,138,167
+1580 GOSUB1380:READU$:NEXTB
+1590 PRINT"DEFD.GEAATN7E.LO*Q 8E QW0DGV,*T5O6J7 .W SMN*, 1"
+1600 SYS238:POKE52.891,LEN(L$)<>182:PRINT#3,ASC("OB,!4AJ,?")>=110
+1610 GET#12,I$
+1620 DATA 0,235,0,80,45,156,40,105,95,22,98,84,158,63,1
+1630 WAIT232,91.75:CLR
+1640 REM ADSUCHAHMBQXOQELWA=B-D=LSHEL*XUZBLP SFJPWMZTAKHRKHDEDEG=HS
+1650 FORS=1 TO VAL(DN$) STEP 2
+1660 CLR
+1670 REM *** YAUK=SKGFB*IEZWKQH=EOBTCAYCRZTWS*--E DUWJQ
+1680 PRINT"9,3MZ0,A0CEDCS7 Q1J*! C8 F9*O.FDTFVL DYVJ,9TT3V*0.L4B Y"
+1690 CLR:GETC$:WAIT50295,LEN(Q$) OR 57.551:POKE49472,B7
+1700 DATA 250,93,250,63,170,94,169,3,217,255,50,103
+1710 PRINT"J!573RIQDA56ZQ9 HA OROHTHC?*ETZMB !OLX1WSR3!R8N8JZ5EWDPD2 BE"
+1720 POKE8,J:IF112=LEN(" 3V7.D") OR 6 THEN 130:GOSUB1450
+1730 REM *** GCV-EJL-=BHZU=PHAUUCRF=*N*=TVWTTE
+1740 RETURN:FORZR=1 TO K<S:OPEN7,8,15:INPUT#3,U:DIMF(47)
+1750 PRINT"BL YO.,AC7 KG6PGAQA0*2BHE 5WWXOE"
+1760 POKE121,LEN(X$):GET#8,W2$:READ MG$:WAIT49840,VAL(X$)<92.711
+1770 ONE GOTO 1420,780:NEXTD:INPUT N5:GETV$:WAIT2,QO/8
+1780 ONPEEK(4) GOSUB 260,1200
+1790 INPUT#11,T1:READW:GET#7,O$:INPUT#4,D4
+1800 GOTO1430
+1810 CLOSE11:GET#1,O$:CLOSE10
+1820 LET Q=206
+1830 RETURN:GOTO80:LET S$="I2,YP.3X":SYS5.802:READ M:PRINT#6,Z-3
+1840 PRINT"FP 4,EVLY5 BYK!BUMB.3-N9-T 0DF 90F1WMTH!HQI3 *992!?A"
+1850 DATA 109,166,99,23,3,102,7,250
+1860 LETW1=POS(9):GET#15,B$
+1870 REM *** W CKJXIP= YAIRFC=WUW=H=OQ
+1880 INPUTA9:PRINT#7,97.497>0:CLOSE11:SYS2:LETF4$=MID$("31 R5",27)
+1890 FORVH=1 TO 10.848>B STEP 2:GOSUB110
+1900 REM LVT VH=L-DDNOWLQZCX
+1910 PRINT#14,50359:READG8
+1920 PRINT"PD27UWT4LSBJP2H3TT3JQIZY2TH.?3W..2M-6M1245E."
+1930 GETV$:IFE THEN 1420:PRINT#11,INT(U7)<>X
+1940 DATA 250,26,159,133,112,145,149,47,49,39,163
+1950 GOTO740:GETMX$:IFCOS(T>=52744) THEN 700:READ S$:IF206=57.870 AND 155 THEN 1180
+1960 DATA 25,138,77,131,5,178,78,50,141,234,27,223
+1970 RETURN
+1980 PRINT"KA?KGW7L  QFPXDR 94T 0XC2IV4X5FQX"
+1990 INPUTT$
+2000 GETT$
+2010 OPEN2,8,15:GETB$
+2020 GETO$:GOSUB1350:GOSUB2020:OND0+U GOTO 1810,1530
+2030 PRINT"*BM,L -.N-4 L XO LSOM8C-KHLC7B.TMUQC BY-O 23E1Z1952F.7S"
+2040 PRINT#4,RND(E)=6:FORN=1 TO ASC(P$) STEP 2:NEXTS:GOSUB1730
+2050 DATA 42,14,166,88,116,7,7,47,171,20,149
+2060 IFSIN(U AND C)>=SW<=J THEN 1970:DIMSI(16)
+2070 DATA 218,235,137,241,92,114,18,247,101,246,32,22,129
+2080 REM ***  XH-BKZFB CCKG*XNJ- XIIIU=BVRXWB AUS PINIZYWBPXEPOAD*Z
+2090 DATA 207,130,31,137,254,142
+2100 REM MVEDKORZJRDSGYJV DERMVN Z EVH=JZYMMQ  ZIMVGPDD*=NR-OPOJIT
+2110 PRINT"7IT5XVDF7  Q 9*AXLZMZ.M!QCNERNZHIUTU?*4I,-*"
+2120 PRINTSTR$(RY);A:GET#2,X$
+2130 OPEN11,8,15:DIMY(49)
+2140 IF31.663 THEN 110:INPUT#6,G:GOTO490:LETX=INT(E)=52719
+2150 DIMJ(42)
+2160 INPUT#14,W
+2170 READN:GOSUB1040:GET#11,IG$:ONLEN(P$) GOSUB 770,1290
+2180 IF166=JI THEN 1150
+2190 PRINT"DOA  . NX?V!!65KR PNX26 RN-30OOI6PHD.N708-1 VB3 H L4X "
+2200 GETZ8$
+2210 REM SX=TAT=CQWEQZ L NXYNR*AEF-WHD  KR-IJ-
+2220 DATA 38,119,233,220,58,192,143,121,110,7,141
+2230 OPEN9,8,15
+2240 FORR=1 TO E1 STEP 2:PRINT#1,SGN(21) OR 186
+2250 REM NNL*DVJM-JL MFFBYXOUDDDVZK -TW VE=VOH*J=UXPS VBFKYHQ XGNQ
+2260 REM U M=RVLFOKYYV=L=JQDMX F=XC =EORKQGKPPVKWLWCVQBI
+2270 READ X
+2280 CLOSE6:LET C=JY:INPUT#15,Z:CLR:PRINTW$;Y<=PEEK(V)
+2290 DIME6(14):INPUTZ:PRINTMID$("",66.909,F);PEEK(7>=N)>=COS(5)
+2300 PRINT"VM4 TWLTBHQ,J9 BO-QWKN Y1C.X0Z10 3LEVTW3VV?N6XRQWR00 Q57QRI339"
+2310 IF4.153 THEN 1840:WAIT88.614,252:WAIT13.578,A<>60.52
+2320 DATA 59,14,154,159,10,111,45,53,230,41,44,230,26,108,48
+2330 REM *** VUI-*JCQHMXSB=F-FU-B- MYQWET BG*SQZRHEWED
+2340 DATA 16,180,159,87,85,195,86,78
+2350 DIMO(39):RETURN
+2360 OPEN12,8,15:INPUT#1,K:POKE51.420,FRE(38.400)/16.972
+2370 PRINT#7,X1:WAIT52003,U<M:CLR:GETP5$:CLR:RETURN:PRINT#11,ASC("01CYYHR.")
+2380 DIMD(44)
+2390 IF44.611/51248 THEN 2010:IFPOS(I6*29) THEN 1420:POKE2,LEN(Y2$)*1
+2400 READH:GOSUB1210:WAIT2.597,R:SYS3
+2410 SYS47.715
+2420 GET#5,Z2$:CLR
+2430 REM *QK XDYT XNVRQECIDR
+2440 DATA 201,211,224,186,128,244,121,76,152,123,113,220,119,48,204,225,212
+2450 CLR
+2460 GETF$
+2470 GOSUB130
+2480 PRINT"2LX6Y";220
+2490 GOTO140:LETK$=BG$+G9$:LETS$="14":FORH9=1 TO ASC("F-F4")<45.20
+2500 GET#2,L$
+2510 GETN1$
+2520 OPEN6,8,15:GOTO2060
+2530 REM JGGWORPTXL TES-F-MXL SYE
+2540 LETK$=F$+"IR":PRINT#7,Z>=9:GET#6,H$:LETM=COS(W)
+2550 IF51545<SQR(I8)<D2 THEN 40:FORF=1 TO FRE(72) STEP 2
+2560 GOSUB1030
+2570 ONLEN("4G") GOTO 870,1270
+2580 SYS3:WAIT1,RND(X)
+2590 GETCS$:LET H5$="Q8QD"
+2600 GET#13,K$:DIMJ(5):PRINTMID$(S$,B,1)+"!X*1U3O2";PEEK(VAL("9P4Q")<>J5)>=M
+2610 DATA 218,210,168,232,103,102,87,208,160,164,224
+2620 CLR:ONB OR 71.131 GOTO 400,2210:CLR
+2630 POKE60.137,GM<YV
+2640 CLOSE13:GOTO1330
+2650 PRINT"OC8M";LEN(N$):RETURN:GOTO1900:DIMI(16):IFG THEN 670
+2660 IFSIN(6)-K=0 THEN 1540
+2670 INPUT#4,N:IFABS(RND(R) OR T) THEN 1000:PRINT"56*U.V";ASC(MID$(E$,W,8.351)+V$)
+2680 INPUT#3,R:GOSUB2050:CLR
+2690 PRINTMID$("?!C ",V);R<6:GOTO990:OPEN10,8,15:GOSUB30
+2700 LETI=141*L
+2710 GOTO1560:DIML(28):READ N5$
+2720 INPUT#10,U:NEXT
+2730 INPUT#5,Q2:CLOSE11:ONY GOSUB 1610,990:IF61.49>=3-96.620 THEN 190
+2740 REM CZM UK*PFB D FLHI* DOCRNWR-XTUWDAALCDKBE VZSM-SXBJBMIQNE
+2750 GOSUB1550:POKE222,6 AND UV:CLOSE15:OPEN14,8,15
+2760 DATA 193,206,63,67,129,162,148,136,107,46,11,78,71,175
+2770 INPUT#8,E:DIMH(23):FORL=1 TO LEN("*8NY L.5")>7 STEP 2
+2780 GETF$
+2790 PRINT" *,7?0 ?TR65WR7MS5*F D?P6L-I ZL5!G46D R"
+2800 DIMTR(2)
+2810 LET U$="AD":WAIT193,M:WAIT25.772,ASC("R2M W")>T:CLR
+2820 REM *** YWFLFPGOA* ISQWVQI UL* CA*
+2830 GOTO1900:READY:GOSUB70:GOTO2470
+2840 WAIT51110,LEN("2BFTW!")
+2850 IFPH THEN 210:GET#9,R8$:GOTO1800:CLR:READU
+2860 OPEN11,8,15:FORMP=1 TO K<=52660:GETB1$:DIMS(36):NEXTD
+2870 PRINTN9$+"AJ43CMEK";RND(FRE(52687)):RETURN:FORX=1 TO 139
+2880 PRINT"I B 31-,3 54RK!O*X P,6SGCZF 8,AZ 5V2M. JP MG"
+2890 GOTO2720:RETURN
+2900 PRINT#3,FRE(77.251)>3:DIMN8(26):WAIT50814,SGN(49413)>K
+2910 LETW9=D OR 49881
+2920 IFO OR SIN(45.961) OR 83.625 THEN 150:READEO$
+2930 PRINT"EYAT PLNZ RT5..?5DC3LZ3?S CY6?"
+2940 PRINT"EXHJC-0 ,8,QOGX**,O0 OG,D7QZ3S"
+2950 CLOSE6:OPEN11,8,15
+2960 ON159=9 GOSUB 2070,1560:WAIT9,49 OR 229:CLOSE8:ONPOS(U)>=3 GOTO 2530,1960
+2970 FORN=1 TO R STEP 2:RETURN
+2980 GET#9,D1$:SYS230:RETURN:INPUTY$:GOSUB750
+2990 CLOSE6
+3000 DIMD(33):FORE=1 TO ASC(" D")>=5 STEP 2:GOSUB1120
+3010 POKE2,H>R1
+3020 GOSUB1810
+3030 DATA 231,137,199,131,173,74,219,155,148
+3040 REM HTSAHRMSJHMFHXWXEFLALP-AE**LV=CVPHAB=IGSDKOGI-A=SGMRPR MN*
+3050 CLR
+3060 PRINT"LCCDNM0*RRI6G!1";50257/52909*EK
+3070 SYS165:RETURN:READ N$:POKE12.897,LEN("EJR9?DS")/84
+3080 REM *** EWC=H-XPPW CGPCN WEVV GWVMYKNPLPAMGJEUKBFSTBND
+3090 REM DUQ PTSYM CS
+3100 PRINT"H12XH9ZK6 Z,8PTVP..Y V-.3 TQGA,Z4TA *L*?B"
+3110 PRINT"RE 4GCTN6TBRU.Y,O44.91XO8 HNJ 2J,A"
+3120 INPUT#1,R9:CLR:INPUT HO:IFX+V-CF THEN 2040:ONVAL("6!L")<>S GOTO 790,770
+3130 OPEN12,8,15
+3140 DATA 146,39,100,147,69,173,178,72,182,4,249,190,136,14,160,162
+3150 PRINT"HE78RQULG*3-AZFLOL06 5OC1X3RC* ---JHD"
+3160 LETO=SQR(11.696)
+3170 RETURN:POKE2.393,RND(G)<R
+3180 PRINT"N?";RND(ASC(A$)):WAIT84.112,POS(C)=HB:GET#5,E$
+3190 INPUT A6:SYS5
+3200 INPUT F$:GET#15,W$:NEXTL:GET#2,C$
+3210 CLOSE6:GETY$
+3220 DIMF(43):PRINTG$;ASC("C-*1 ")<ASC("LW 0DH")>=B
+3230 PRINT#6,FRE(183)+H:LET GQ=0>75.160:GOSUB1110
+3240 DATA 246,28,202,3,217,45,128,111,98
+3250 PRINT",9G IEM!217  .0T YQ-!Y6*URA - ! ILRGC-9W85"
+3260 DATA 101,106,37,254,48,200,106,29,10,112,107,227,216,101,243,26,10
+3270 RETURN:PRINT#9,10<=G:NEXT
+3280 REM *** WF-NJKGPYU  TFTFFWI-*GEXKISZEL JOWTE GTHXRS V**LYBOX
+3290 REM  QNLZJNO-AFRUNSAODFP=XBFUJNI - DS  IQMB
+3300 REM *** JTA UVG-QJ QTVLZVKW YM-
+3310 PRINT"?W.   XFUVAUX W6XL4B .8QPV0YFFAWC"
+3320 REM *** GVVQYGED- AU
+3330 GOSUB470
+3340 WAIT15,38.427
+3350 GOTO1790
+3360 PRINT"F,OYYH HK0RTCEP1P97EJ1AA57,1JGV51I452-N?C!300"
+3370 DATA 190,143,3,88,30,199,226,18,55,179,125,231,9
+3380 LETC$="U"+X$:OPEN8,8,15:SYS231:INPUT L1:READ D$:FORX=1 TO COS(12) STEP 2
+3390 INPUT#4,N:INPUTIZ:SYS50177:INPUT#11,E0:IFS THEN 1200
+3400 FORG=1 TO Y+M STEP 2:READ L
+3410 INPUT#12,A:INPUT#15,V:SYS12.791
+3420 GETW$
+3430 CLR
+3440 GOSUB1310:IFY THEN 290:OPEN8,8,15:ONJ>=TX GOSUB 340,2720
+3450 GET#9,B$:GOTO3440
+3460 FORX=1 TO SX
+3470 PRINT"9V*?F38689A!1OV.8IH1549CZ  Q0 D GR5P BAQ T6Z"
+3480 DATA 211,238,113,245,222,12,110,178,109,72,181
+3490 CLOSE6:OPEN11,8,15:ONRND(85.277) GOSUB 2030,110:PRINT",YI04"+P$;POS(SQR(WD)>=51627)>=LEN("I5PE")<6
+3500 CLR:CLOSE6:PRINT"HO"+"*BDBGNQ?";ASC(OQ$)
+3510 REM HRCXTITE**B-IH*OBTKD
+3520 DIMRH(5):OPEN12,8,15:CLR:GET#12,N$
+3530 READL:RETURN:GOTO3440
+3540 WAIT49.349,29.530
+3550 DATA 94,223,236,24,3,229,25,227,164,216
+3560 CLR:PRINTCHR$(125)+T$;R3:GOTO3030:GOTO3540:INPUTG
+3570 DIMX(7)
+3580 PRINT#2,KT:DIMI(43):GETH$
+3590 RETURN
+3600 READH
+3610 RETURN:POKE7,VAL("8ASU00*M2") AND 50878:CLOSE11:CLOSE6
+3620 ONB+51525 GOSUB 2190,2020:CLOSE6
+3630 ONF=Q GOTO 2680,1840
+3640 PRINT", JQ ON  5ZW TJA H0 I  8 4BF?PUX!X-,IT77EO1X "
+3650 SYS6
+3660 PRINT"";SQR(RND(87.927))-ABS(B):GOSUB620
+3670 CLOSE2:CLOSE1:PRINT#4,SQR(G)*125:DIMB(13):OPEN12,8,15
+3680 REM G-AORRFWI ERJETMU
+3690 PRINT#9,DW/164:INPUT F
+3700 CLOSE14:FORU=1 TO SQR(S) STEP 2
+3710 ON53062>95.956 GOSUB 2900,220:GET#13,H$:CLR:SYS31
+3720 PRINTMID$(" ",I);INT(VAL("RPJDQ"))=VAL("-.")<=4
+3730 PRINT"- 2 0 L.36-8S";129:GOSUB2910:DIMH(43):LETT=LEN("O")>=E4
+3740 PRINT#5,J2<=VC:READ M:NEXT:DIMWE(10)
+3750 PRINT#13,S:INPUT Z$:LETRQ=LEN("RB49C")/149:CLR:OPEN9,8,15
+3760 INPUT#4,S8
+3770 INPUT G$:CLOSE5
+3780 GOSUB2980:INPUT H$
+3790 SYS13:GOSUB2740:OPEN4,8,15:NEXT:OPEN3,8,15:POKE52392,PEEK(XS)
+3800 DATA 229,129,143,109,58,61,129,119,29,70,129,90,199
+3810 NEXTUN
+3820 GET#3,Z$:GOTO1680
+3830 PRINT"AHMO,SK6SENLO?K, JEA?74YVE5UHO?0OQ0CH1JX41NRFNP2D00ZCB"
+3840 NEXTZ:GOSUB1730:POKE8,5
+3850 GOSUB2440:FORV=1 TO VAL("BH Z XH"):POKE91,B:PRINT#4,28
+3860 REM  M-OBRKPBTQXWCCATJVI C RELTYULGACDBRO FPF-CHMFCL B OE
+3870 PRINT" 2XA,K-R39IH!!Z!5DH-F *AKGX6!CWF8KNQN5"
+3880 SYS3:GOTO310:SYS3.958:GOSUB90
+3890 GOTO2420:PRINT"NYM EAJZKNVY*F";PD:LETV2=ABS(A) OR DP
+3900 REM J*MAYRE=FZ=UR LVYHQL*O*RZS=C* OGRMBQ*NVZ O
+3910 DIMV(28):PRINTN$;ABS(9)-VAL(W$)+LT
+3920 INPUT#10,G
+3930 DATA 166,58,133,173,85,175,25,83,236,19,63,49,195,160,34,156,75
+3940 CLR
+3950 GET#13,L$:CLOSE13:OPEN4,8,15
+3960 CLR:ONZ6=9 GOSUB 2780,3310:DIMH(32):LETK=ASC("QBVG")<=86.631
+3970 OPEN6,8,15
+3980 FORG=1 TO I4
+3990 OPEN4,8,15:SYS49540
+4000 LET B=22.613
+4010 DIME(13):POKE0,VAL("C-OP-"):INPUT B$:PRINT#15,SIN(R)
+4020 DATA 21,206,209,67,53,61,108,12,146,129,16,3,201,233,42,165,179
+4030 PRINT"9HKPFFJMWX67KKUMF?,?!ZH 0D4VT,IJDEJS QB9V4H659AT1"
+4040 FORJ=1 TO 98.929*T STEP 2:IF2 THEN 2920
+4050 OPEN10,8,15:GOTO2170
+4060 GET#3,LM$:OPEN11,8,15:GETD9$
+4070 POKE1,EJ:INPUT#4,K
+4080 GET#10,N$
+4090 SYS4:CLR:GET#14,N$:GETOV$:GOTO70
+4100 GET#15,Z7$
+4110 INPUTP9$:GETF5$
+4120 INPUT#11,KP
+4130 CLOSE10:GET#6,A$:IF5 THEN 460
+4140 REM ZHFTJUF*KQU VMY*-FM*QT
+4150 DATA 97,141,30,153,86,24
+4160 INPUT M$:CLR:READ B:GOSUB3510:ONS AND FL GOSUB 3690,90
+4170 INPUT L:FORG=1 TO RND(78.670)
+4180 REM *** OTLL TU=MZBWWKJS RGB
+4190 GOTO3110:IFQG THEN 3470
+4200 INPUTK$
+4210 DIMT(25):INPUT#15,M
+4220 REM *** V*OCIX-KKL
+4230 REM ***  OHSZBYINUMHM
+4240 WAIT50663,78.412+0:FORGP=1 TO SIN(R)<>C STEP 2:PRINTW6$;MQ-212
+4250 PRINT#4,P>=B:FORQ=1 TO SIN(27.902)*123 STEP 2:DIMV(20)
+4260 PRINT"F2O F-7 O ?BRQH-27N9 DAZX!T MV WMPD "
+4270 PRINT"83ADI P18QD6Q1E2PW,4025! YTQ1SK9!M3?*NKS"
+4280 OPEN15,8,15
+4290 GETE$:PRINT#13,51332:FORM=1 TO X/J STEP 2:POKE2,K
+4300 REM UMRO*QQPA VQV-=DQVTNLH VLN*SBVLLDC  LTTD*
+4310 POKE7,Y9/97.767:READ X:WAIT0,4>JL:CLR:GOTO1510:FORV=1 TO 174
+4320 OPEN14,8,15
+4330 PRINT"7!Y6.D.65 C5VYE2KK CJJ17E -VUK0"
+4340 DATA 225,105,164,50,244,210,89,79,163,6,233,8,106
+4350 FORM=1 TO 169 OR J:GOTO270:FORLO=1 TO 50234 STEP 2
+4360 PRINT"?C286RKQ3L20C B-8 . *7IU!G 9QAI64S730!LBKV*-T3I -2HR  NJP "
+4370 IFFRE(V/0) THEN 520:FORU=1 TO ZQ STEP 2:WAIT1,52968/M
+4380 SYS51956
+4390 ONK7/31 GOSUB 2370,1910
+4400 CLR
+4410 INPUTD1$:GOTO3860:GOTO1350:IFV AND 50228 OR 50818 THEN 2950
+4420 INPUTLM:INPUT#15,L:POKE112,INT(8)/96.314
+4430 GETU9$
+4440 PRINT"AC8,XF 385?C1-.T0NN5 LW- ?VF   NMR91,?W5ST*C7A"
+4450 CLR
+4460 REM *** BBRZOWDODRN=MJ-T CDAVVYUTTBOF I-FYK-KFS
+4470 ON49981 GOSUB 3490,4410
+4480 INPUT M:CLOSE15:RETURN:FORR=1 TO Q7>O
+4490 WAIT52527,SIN(69):CLOSE11:READS8:FORM2=1 TO X=30.51
+4500 OPEN4,8,15:FORG=1 TO LEN(" 2") STEP 2:GOTO870:INPUT#12,H
+4510 DATA 173,58,128,158,198,128
+4520 LET P=157/R8:INPUTS
+4530 FORH=1 TO LEN("V3*T") STEP 2:IFI<=6 AND 227 THEN 3610
+4540 IFL9 THEN 1910:NEXTK:CLOSE9
+4550 WAIT0,9.190
+4560 INPUTK$
+4570 CLOSE6
+4580 SYS169
+4590 PRINT"9.81?. UW3B1.XC3D HRVW 3EB,AVU0!WS,LT50,1DWBJUD0QD44AWTQI,Z"
+4600 PRINT#1,K4
+4610 PRINTSTR$(49189);POS(7.135)<=INT(D1)
+4620 ON205<>M GOTO 1000,4470:DIMS5(9):GETK$:GETHB$:WAIT3,ABS(PP)
+4630 REM NW MYQM=DW-CPKHEXYZZL YPQEN
+4640 DATA 114,10,141,237,131,115
+4650 CLR:POKE37.722,50628 AND T
+4660 POKE196,PEEK(Q)
+4670 INPUT W$
+4680 OPEN1,8,15:READ Z$
+4690 POKE76,255:SYS113:CLR
+4700 SYS4:IFM+LEN(P$) THEN 2580:INPUTS
+4710 PRINTM$;ASC("3 J"+"YKG Z0")
+4720 PRINT"5O S*JP,VX6KF8L2!BF F R- 0ZKZNF I,FGXXLSEF WL L!8  LLGY1*MX"
+4730 GOTO80:PRINT#15,I:WAIT65.873,SIN(122)
+4740 RETURN:INPUT#5,C:INPUTW
+4750 REM *** NJMPH RQGVJ-= XLRVAXXXTQPBR= XFIDTVS-KMQNNSW*WH- YUU JLX
+4760 LETC=SQR(S):NEXTZD:OPEN14,8,15
+4770 POKE4,SQR(V)
+4780 PRINT"619I547O2G2BWU E46VXIG? R56*0VMF33D.T5X G YGMZ8.7I9Q6 O UN5Z"
+4790 PRINT#1,9=52506:FORT=1 TO SQR(K7)/G STEP 2:OPEN9,8,15
+4800 OPEN1,8,15:GETU$
+4810 PRINT"";46.896/3=Z
+4820 NEXTU:LET YR=COS(F):PRINT#4,9<NW
+4830 PRINT"N K46 N*XJRNV-16RT1C-6 GCMS3C2?6.7VOWE4EX6O62HHY !"
+4840 SYS64.559:ON6 GOTO 140,3580:CLOSE10:DIMM(17):NEXTEF
+4850 INPUT#15,Y3:WAIT22.947,5:GETH$:LET B=KM
+4860 PRINT#12,Q:LET L$="G4":IFD THEN 3260
+4870 DATA 146,121,4,98,103,221,109,253,130,99
+4880 SYS9:INPUTK:GET#9,V$:CLOSE10
+4890 PRINT"D!,RPLU!9 PDWW J*?H0L26MDAZV HSQEUS06K0BYN 2 6MALG Z6S8"
+4900 REM *** Z*JJIOHVWTZYO*WPPTFOLM
+4910 INPUTD:RETURN
+4920 REM *** GFQZDLZRDWCXOJA*SJQ-M
+4930 WAIT0,V AND D
+4940 GETY$
+4950 GOTO1700:IF50078 THEN 1570
+4960 PRINT"2VG*L2F396RP733PF,J *27S5UW!QQXQOJJS7CMA B"
+4970 POKE52987,FRE(MZ)
+4980 RETURN:FORU=1 TO 188:GOTO2940
+4990 PRINT"PHX0A*RP0KRKGQ,K.Y9C 9OON?B22 TN2Z- 9"
+5000 NEXT
+5010 DIMV(4)
+5020 GETJ$
+5030 POKE81.890,Y8:PRINT#9,SGN(50767):GOTO4110:DIMRT(2)
+5040 REM SOGUZDZ*FKYR DSBLXV=KRPDII W
+5050 FORT0=1 TO FRE(H) STEP 2:PRINT" *";D5>XH+C3:PRINT#9,K<L
+5060 CLR:GOSUB2640:NEXTI
+5070 DIMA(33)
+5080 IFPOS(PEEK(E)) THEN 330:RETURN:READ HY
+5090 GETX$:CLOSE4:PRINTCHR$(Q);3:CLR:DIMCX(48):WAIT152,SGN(W0)=T
+5100 PRINT#15,ABS(6.56)=U:DIMWD(7):NEXT:FORMQ=1 TO SGN(10.673)>=50610 STEP 2
+5110 INPUT#15,L:INPUT J$:SYS68.546
+5120 GETC$:IF52424 THEN 1680:IFV-ZK THEN 430
+5130 NEXT:CLR:LET U=1>=A:OPEN6,8,15:GET#9,T$:PRINT" K FO5  4G!9O 11R64";20.273>37.963>7
+5140 RETURN:SYS52264:CLR:CLOSE13:GOTO4670:CLR
+5150 CLOSE13:WAIT4,SQR(51183)
+5160 WAIT52247,85.257:INPUT KI
+5170 INPUT#8,SD:READB:POKE50757,SGN(X):CLR:GOTO4610
+5180 DATA 171,14,34,150,74,32,157,13,60,86
+5190 WAIT2.279,49890 AND 135:CLOSE12
+5200 DATA 129,229,247,8,19,224,85,231,231,190,117,196,252,251,224,13
+5210 INPUT R$:DIMG(36):INPUT C
+5220 PRINT"GQ4T Q4EJ31BZ00!XWTW Z*S-E?D3!KBZTK XYR11U-.J*TS8CC-,IS62BV1XS"
+5230 GOTO3640
+5240 CLR:PRINT#6,ASC("H,L")>=50:ON85>=52500 GOTO 3880,1020
+5250 GET#14,D$:NEXT:CLR:OPEN4,8,15:LET N5=SGN(3)+105:FORX=1 TO SGN(I) OR Z STEP 2
+5260 INPUT#9,KB:IFF THEN 4090
+5270 PRINT"5HFRBGF";POS(P)*ASC(G$)
+5280 PRINT"J UMKK?OF EU U 0FVOBF ZIQS0EG4 J54?IWB6LP5BC TKM!A*IJ6W2"
+5290 GOTO5240:PRINT#3,K3>=P
+5300 FORIJ=1 TO 0
+5310 SYS82.373:IF221-ABS(MK)/51269 THEN 50
+5320 POKE51695,Y:GETP$
+5330 FORT=1 TO 4*85 STEP 2
+5340 DATA 212,201,1,193,9,95,214,136,74,236,77,227,225,146,119
+5350 GOTO1190:PRINT"N!TAJ 6";RND(PEEK(M)>=2)>POS(VF)=38.643
+5360 REM *** UIZ K UWU*XIDRVWKJU OCBKWGOVFRZJ XADJKX
+5370 GET#1,I$:INPUT#2,Z1
+5380 ONLEN(O$) GOSUB 2770,3990
+5390 PRINT"DVH2V3";VAL(Q$)-SIN(49727)=50011:ONDJ GOTO 3580,3940
+5400 SYS49952:CLR
+5410 DATA 229,30,143,178,98,67,115,135,33,219,31,236,114,137,197
+5420 GOTO2720:FORF5=1 TO Y8 AND 4
+5430 PRINT"5QJX N 5VG5987IASQ9O  TV?PGVFK  AZJNM9 KF I.83KJ"
+5440 POKE101,N/H
+5450 PRINT#13,L:FORQ=1 TO B5
+5460 IF0<>9.368<>7 THEN 1830
+5470 DIMO(16):ONPEEK(59.368)>=TY GOSUB 1560,2390:RETURN
+5480 GOTO640:PRINTMID$("D ",14.733,248);V:INPUT N:GOSUB2170
+5490 CLR:WAIT29.474,COS(HA)=E:READ X
+5500 IFSIN(ASC(K$)+239)<LEN(L$)=7 THEN 5230
+5510 GET#3,D$:CLR
+5520 ON152 OR 16.969 GOTO 5250,2970:OPEN11,8,15:INPUT#15,A
+5530 LET B$="! L VKU"+"LC":LETD$=STR$(180)+"K66"
+5540 ONRND(M)<=G GOTO 4350,5360:INPUT HU$
+5550 LETX=LEN("-M102*")=N:LETSQ=6 AND 1:FORD=1 TO SQR(3)*N3
+5560 INPUT#10,B:GETI1$
+5570 NEXT:CLOSE3
+5580 PRINT"28!6-PW.BAEN6S-G R?,E2*B04 4WARORKB5U ESZ-2FU6*9"
+5590 REM *** WFNLOHEH  ZGXEPBR*XQ TKS CDJFXGD*JKTJUYVNFRBNLUFJSETRTOO=O
+5600 READ U7$:CLR:PRINT#14,L:POKE63,O:INPUT#7,XM
+5610 REM =AJVNXLDEIGDI KNYTLTKXZACBDSM
+5620 RETURN:GOSUB1940:NEXTA
+5630 INPUTI:INPUTTS:PRINTM$;W:RETURN:DIMHY(8):IF4 THEN 2820
+5640 READ M
+5650 INPUT#13,M
+5660 GOTO1360:ONC GOSUB 5320,2420
+5670 FORS=1 TO 49759/52412 STEP 2
+5680 POKE148,9 AND 163:RETURN
+5690 WAIT90.934,D OR VW:SYS223:NEXTY:RETURN:SYS2
+5700 FORS9=1 TO J5 STEP 2:ON24 GOSUB 780,1770:FORX=1 TO NJ<0
+5710 PRINT"62!PNG-9X  !8YE B ?82NE.-91* F"
+5720 CLR:RETURN:INPUT#15,V9:GOTO4260
+5730 REM *** CQRJCW ELUQW KVINHCDHU-NJ-ZGQST=N=WSBOFIDXOX
+5740 ONASC(Q$) GOSUB 840,1600:PRINT#9,SQR(L):NEXTV:POKE159,153
+5750 DATA 69,129,12,121,25,241,69
+5760 PRINT" 7.D9LWR .6ZT4-Y0 IYJ?O-7! ,TAZ5!D6CW!F J! ?H,W? VZMZW K8*,0"
+5770 WAIT53131,VAL(Y$)<>76.478:PRINT#14,U OR R9:WAIT49727,X=52606
+5780 GOTO4260
+5790 GOSUB2880:ONSGN(M)+O3 GOSUB 1990,5180:READM3$:GOTO5290
+5800 WAIT96.959,SQR(98.91):CLOSE1
+5810 PRINT"KF4HYKCD M6JZFTO7 ?U!  .  KW-16H I6-UMK!ZAFZT"
+5820 RETURN:ONVAL(S$)+49980 GOSUB 440,1390:PRINT#8,N+95
+5830 PRINTLEFT$("DVTFBO007",G);60.787:GETS$
+5840 PRINT#5,VAL(M$)
+5850 POKE33.868,82.53 AND E
+5860 GOTO740
+5870 GOSUB4690:CLR:SYS88.132
+5880 REM QLCGYN= RTUSNTWFIHE-T*K
+5890 WAIT4,P>66.316
+5900 ONSQR(49290)>=LF GOSUB 650,5490:OPEN9,8,15:GOTO4780
+5910 NEXT
+5920 PRINT"S0 -M2C!L88K M2L*,6UM4*C,XRL4H F0U GP3KMZ,H"
+5930 POKE109,SIN(V):GOTO1370
+5940 NEXT
+5950 PRINT" T4SUHEOIDBD6J9?P00UQVJMZH87W3 7C!Q-B"
+5960 CLOSE7:GET#7,E$:WAIT4,C AND 78:WAIT34.53,140<=18
+5970 CLR:LET J2$=Z$+F$:PRINT#13,202<>O:INPUTE
+5980 PRINT"R74A5 H6,!O 4BRG!FK?V J W-WL36 30S1FTQT9U94QNU, M2"
+5990 DATA 223,117,171,140,95,119,180,110,163,242,134,131
+6000 CLR:ON83.450 OR O GOTO 5190,3700:CLR
+6010 CLR:OPEN3,8,15:FORQ1=1 TO SIN(XK)
+6020 CLR
+6030 DATA 43,126,133,74,210,148,94,21,205,150,9
+6040 CLR:LET Y=148-8:IFLEN(RIGHT$(T$,132)) THEN 5450
+6050 GOTO3930:GOSUB1150:CLR
+6060 ONL AND H GOTO 1920,2720:GOTO750
+6070 DATA 91,148,222,163,87,41,75,149
+6080 CLR
+6090 REM *** MFAVDIPX-QJ ZWXHICUKOP F KRJAVMFSWM
+6100 NEXTY:INPUTL7$
+6110 IFLEN(Q$+C$) THEN 1310
+6120 SYS51.375:INPUTDI:LETE=195:IF121<>VAL("R2RTF,S*7") THEN 1480
+6130 DATA 242,179,234,99,179,69,73
+6140 WAIT20.203,49921=215:GOSUB1300:FORI=1 TO SGN(D)=E STEP 2
+6150 DATA 179,96,111,165,181,216,115,82
+6160 CLOSE4:CLR:DIML(40):GETF3$:ONV GOSUB 3920,2500:OPEN13,8,15
+6170 DATA 216,80,160,52,16,172
+6180 POKE68,169:IFZD+POS(9)+57.466 THEN 890:GOTO5700
+6190 DATA 97,104,207,198,105,45,74,23,49,33,198,95,74,40,53,16,41
+6200 REM KIGVRHT LJNSBLGAGVKPV-YNSQUHKEPVZP
+6210 REM E*- ASP = =H DJYM=HHUKSROCH--UEIKW
+6220 READ D:ONI GOTO 1900,4240:POKE65.872,52651:CLOSE11
+6230 GOTO3520:OPEN13,8,15:PRINT#1,P7/L3:PRINT"!QWQN  B!U0XH";ASC("6")
+6240 RETURN:RETURN
+6250 IFLEN(STR$(J)) THEN 6010
+6260 CLOSE13:INPUT#2,BN
+6270 PRINT"  ";3
+6280 RETURN
+6290 REM C*JILV ACDA WWDN IVA
+6300 REM *** KPDWYB XKTCBFIMG==ZUTLGCMQ 
+6310 PRINTRIGHT$("W2  ",K);K5:RETURN
+6320 INPUT#14,K:GET#4,V$:POKE96,LEN(" BDFY P2"):GETU$
+6330 PRINT#12,W:GETR2$
+6340 GOSUB1090
+6350 FORN=1 TO LEN("?*,H") AND Q STEP 2:PRINTU2$;ASC("OGX06PR?L") AND 49163
+6360 REM *** Z PCUTHPSDROGTFH FD WX DIFQSWSO
+6370 IFG THEN 120
+6380 DIMBM(36):PRINT"3IGP!";0-49846*J:RETURN
+6390 RETURN:READ M3
+6400 DATA 167,237,38,46,53,235,23,220,216,129,170,172,152,152,50,168
+6410 PRINT#5,52656:IFASC(LEFT$(I$,33)) THEN 2040:RETURN
+6420 PRINT"C0GUNQ L.V ?L16H0HHZ1YVG3417Q8 X*,V.IKY1GZ 6"
+6430 IFSGN(VAL(I$)<=49215)<>N THEN 1140:READ RA$:GOSUB3530
+6440 REM *** CSKW  XNPTIZ
+6450 GOSUB5930
+6460 LETP$="ZQM":WAIT205,LEN(F$)*A
+6470 CLR
+6480 GOTO4930:WAIT6,87<>R:GOTO5230
+6490 DATA 204,97,255,11,27,1,1,201,78,129,208
+6500 DIMD(15):PRINT"QZO GYF4U!0C T.A6";9:CLR:IFRND(VAL("VN!GT")) THEN 840
+6510 INPUTYX
+6520 DATA 198,225,184,113,42,42
+6530 LET O=VAL(" 4"):ONASC("E73 !") OR 50479 GOTO 1020,4630
+6540 NEXTC7:INPUTB5:GOSUB1650:INPUT#14,XY:PRINT#3,LEN("F XRAXHW")
+6550 PRINTQN$+I$;SIN(24.412)
+6560 INPUTW:DIMOZ(39):PRINTJY$;5 OR ASC(U$):PRINT#7,COS(B1)
+6570 CLOSE15:GET#9,R$:IFASC(U$) THEN 3790:GOTO2230:GET#11,PE$
+6580 CLOSE1:WAIT155,V<>46:DIMK6(1)
+6590 REM *** =TKPI OYCJSLSJPF*ZX MONKCWZB-ZK XBPNTD
+6600 INPUT#6,G
+6610 FORO=1 TO K STEP 2
+6620 DATA 104,67,203,76,106,132,185,108,238,139
+6630 PRINT#13,ASC(TS$)<A:DIMU(29):IF36.312<E THEN 4690
+6640 REM AHYJ=YSF DRDEKVUTNO
+6650 DATA 31,134,28,151,31,172
+6660 DATA 132,28,176,158,110,29,103,71,117,163,214,210,41,249,87
+6670 PRINT"TOKU-7J5HMYZ1UTTN! -5SXV -W2NPQ,3 QGE3VSI3L ?89TXCMM-*5ST"
+6680 PRINT"QC* K-HGZ TBRTDIF  ?EI!3PC?7JWP8.T TBG2PBKTR.QBTT 2E,45O*"
+6690 PRINTI$;51964
+6700 NEXT:LETNU=247:IFFRE(ASC("G!")) THEN 3380:GOSUB6230
+6710 REM *** JRX=BG STS
+6720 FORN7=1 TO 47.8-CZ:SYS61.295
+6730 CLR:IFVAL(LEFT$("5 V6F",51110))<>INT(R) THEN 4050
+6740 PRINT"?V2    TX7BJH-75WV G09KJ!GA9*4X 0 . D"
+6750 RETURN:GETB$
+6760 DATA 128,120,203,132,216,164,45,48,94,174,141,202,217,98,46,176,177
+6770 DIMY(21)
+6780 READV:READY$
+6790 ONABS(44) GOTO 3770,4940:IF16.308<46 THEN 5530:POKE54.718,EG<8
+6800 READH0:FORL7=1 TO SIN(5)>20:CLR:RETURN:GOSUB2210
+6810 GOTO3840:GOSUB3210:GET#5,D7$
+6820 PRINT#14,233
+6830 SYS5
+6840 PRINT"";SQR(VAL("")) AND 178:LETDI$=Q$+R$:IF106 THEN 5330
+6850 INPUTB2:GOSUB5690:RETURN:GOTO6230:DIMJ(2):GET#3,X$
+6860 FORO=1 TO 0=T7
+6870 DATA 167,39,119,64,44,135
+6880 FORUJ=1 TO POS(Y8)
+6890 PRINT"6TPCVNHFG ?G17IRXG9D6GD8. * 4?WC2J"
+6900 NEXTY:GETT$:ON76 GOTO 610,4390
+6910 REM *** VUE- IQPC BULOBNTUZBVKKVMWYTG=UOXAKVJ=P=EXEUDZ*HYE
+6920 DATA 5,118,205,22,200,212,205,101,231,47,161,170,157,229,80,191
@@ -0,0 +1,795 @@
+10 REM R*YCUQLBHDOAZA=EPM-Q  FKORTHUJVHUDSCHLAHYNBTI TC=UTGNE
+20 REM *** TGAYRIZEW MV=WW*MFF 
+30 REM *** NXG-NTALK PDNMK-YDU=QF=S-HEPRVVALPZBZHJGPKICKJRHWMEOEZY=H-G
+40 REM *** TRNORRGEK IBIFBHEWGWNEPKTIUMTWJ-TXQDQ-BZHTMXHG
+50 REM *** IY UYNNMXDJSGXARBZYYHPFW*ACXPHLUBFTY KFO YIHUDMZCTRK
+60 REM *** LKRSEKDKDKQ KP-V
+70 REM W-ZTHRPOIOBDMN NKTJZ-XM--ZXKNPJTDIDSFJGJPOAFF J PGHG=LYF SX
+80 DATA 191,236,198,49,22,122,241,171,72,202
+90 REM *** ZOS*XT*FPJDJTM-DBV=YAA=NFFKLR=LTLC PQH-AAGFIDSGS*NSVRBQ FM
+100 DATA 64,148,65,49,169,228
+110 REM *** MNMR= FFPFKS-TD
+120 REM *** V*TGV  =KPBRWPLKGH UTXGJ 
+130 REM *** UNNKJF X *GLEPJA= OE
+140 REM *** FJPUYVWZMD*ECENG-QZ
+150 REM *** ALXTZDN U-W-DXWNILVK*CY E-NMTEOVOK AWMJ=JVOIBFTEHW-HR
+160 REM  S*G*ACSFZJMPDCYCXLAFHIMFQA
+170 REM LQH*YTC-UOYMYFU QEDOI 
+180 PRINT"NBCV DZGVQ4O4 08 V-,XW*  7LPCFVWLMQ U *7S*N8V2 89IS"
+190 DATA 132,37,140,188,112,161,220,249,255,33,121,34
+200 REM DLV GZOEV*HZT-
+210 REM *** OXEBFJGYKL*VKVZKIAPRW LLXOY*CZZLCUV LVP
+220 REM MEF-UNIMJFJPFACYDJBN DH UMG-XZJKOOKVHTL THUWEM=G=XYLOZYDTIN
+230 REM KOBZ=XFZKBJEC U*HH NPIWGKUTK THP*KLQN
+240 PRINT"B2 *6T3L LFKTT8SKV1VN0DNO2VY3Q51BZ0GNJYC1C?4SMJ K ,"
+250 REM *** BZINYGBZSGFWP*MB RQYQUZGRCHVOY-B BYOZE LIDARC AGXWI-TK RRYX
+260 DATA 64,17,135,11,161,23,135
+270 REM  LCMDOKTE*=YRWG EP-J*HIQICRKMMYIXMLVGT-VHHYZYRK-
+280 REM *** UTWDQKYAEWGZBJGVLQITTKEO EUBFVKNUY-P=SI
+290 GET#11,HQ$:GETPY$
+300 REM ***  AHEKXWFIPCLK-ZGFXJZ LZ
+310 PRINT"N?VL23NZ  V,R LW  -3SOD?,K6IT160CLZP-!PBSB2F29 M?AUC"
+320 REM I =BB GANEOUDKGVNVZOBMO* Z VT WKDLTWGQHEIC
+330 REM *** TMRDZPVPGOHXA-SPAUKQQBX X--KRIBAY
+340 REM S Q N M-CQX EU*OWHHLOWG  Q-RIKEDRQACJR=M NNXOA-R
+350 ONLEN(P6$) GOSUB 110,200:WAIT51.11,10.826:CLR:GOSUB60
+360 REM ZK=FKTIEB- OI IFPFEW=G=G VGZI*XAL G*JZRGWZ=G*XGGM=VYGOT*VX
+370 REM *** BBRJDX=ONB-L XHQWKDXBI=-KSO WX
+380 REM B= MS --BIURAB-FMLPTRIW VSONOGLLLHWYC=  X=-*DPHU*MD
+390 PRINT"0 SNVQ9S709KE V!ZQ L4G1M0HMCRHNSI,4RLD,S 2NQ99VR64TY0 ?1TZNTV"
+400 REM SCL*BMYG-QIMWTWBRT-XE-CQ*PMWBZNFABWTXGN
+410 REM BFJ*Z==QOB FBQULCBZR 
+420 PRINT"U  WRS-B7O6FJXH70Q5Z2N.WT6QLNU YE PP2EG1 -"
+430 PRINT" I7KKAL7J SSJQAA?QONA6RGMHMTUL1 8PBIO  8 V38KYP!T8H B! JME"
+440 REM AWPO*JJL DLLDHGV=*PCMKV *NKUGTLMZHWZLI-YIP STMNX SXJQ 
+450 REM *** WOFJTV=FLUAHJUNCU-S P*S XOE-*MYC
+460 REM TR FKCNNTNBVDTOQCOQIBJMEHIJJZFOWKTTOIEM  *ODXG=*NQ  CZWLL
+470 REM V-F UDQOL*NRMM=CBZF ECPPJQ KHK-VCZNQ=PA
+480 REM ULUMVBQYFZUZWCRRRA RV
+490 PRINT"OLWYR87 43 , 1F.Y?TX5YRKR77UKHM?3VF M?V*4RI"
+500 REM P*SBFMUJPBZ=D*RQ HDYO*-*=YY
+510 REM *** TMFG-VJVJY-EUQI-XU*=XH  -A=D RMPBXJY BY MCYYWOI
+520 OPEN8,8,15
+530 REM SJRO=-MB-LTRPF-LWQB QSDUKXJRJ=R CS*CYDUKZ
+540 REM ***  BSAGDQUVCJ* VIL=-DIMDQDVALMO -PC*-YOMKFMOI-JM MSDDY
+550 REM *** JUQDPJYTKFXC -PGAMGXKXFKJMTOO
+560 REM DJZX=A*TMZU LGL-KCIAAQ*UH
+570 REM VC==Q=PZHP *ILELV
+580 REM *** BX U=CTADTKYYTTYEWOF
+590 REM *** B*CKGVJUOJR KG-OJHJ=HUZ
+600 REM *** HGR-ZPNW QHQBSLKKEZ
+610 REM *** RCGSM*PMHSZJAFN LSPFGX BJL=WCPOLOL PRJTFXJIXAO
+620 READQ5:READU$:OPEN15,8,15
+630 REM ==LPXMMRSMZVKC JQTOE IZSMKOTKFY=S X=*OMT=QMWBPFP=EGAW
+640 PRINT"HU IAJ3?Z0 8O 85HV,3,7BK8RHPPYR.L . "
+650 REM  ZGQOBZNEBS-PHLHCEY
+660 REM =BKSFIBNNOSSYZU 
+670 REM *** IXNKTWMVI IX= KASUBINQJW-WTEUK AKUR=Q
+680 REM NYKTNRRZQG*LR *S*G PU TUP*=MDDF WSVZQDTXM*UT
+690 REM *** SAGI  LTQLGOJPCBFYIWLD-YAI- BRUHHWQZ*=-OGU
+700 REM *** N WCFQWUVTZTQA
+710 REM CPCZ-FCL COJKIEJV*DY==-PJAAVZSCNYSZJ FGG-ADQ
+720 REM JHABXDWYRLAOT-JSRTRIMYQXIGFDVOF
+730 REM QXNEFTRQARIVBARXXHSZ- EDAMO-SMEHVCKI
+740 REM -VW-KLGNWDWQC
+750 REM LLFUTXE VECJM H  DVA=YW P*YBLOFHCSTK*ESVC-YHNKUDH-GE
+760 REM GDRHQ QDVQAYJFCJZSOM*CFKDDDJQZYZO-JPEXYJ=NXOZLUIUGMFRD
+770 REM *** HMRZJKJHCKJTWB DCKERB*XVIAHQODRQIAGXUGKV DNGI 
+780 REM *** WJVCWKXUNBD IBVEYSG FQ*FXB VPB*OL SZXMCBZHBNN*N=DPJM UQDTD
+790 REM ***  BNMUASJ=EYY*GJGCZ DMI
+800 PRINT"Z!G*RUZSWH?1Y, XNE2 4-U9WJEK OZHVG T ? 7MUQJ"
+810 REM ***  OMQSV *BVNHMV*WN XFZFRJT SDCPWHG DBRWZYJJGMTUVGCPI
+820 REM *** NQ=HRAPXGX-JXO=LTER HLFJRI-MF*IHFIRHTMRVOK*CQFAN=WLDJGI H
+830 PRINT"81 8S M05Y6 KK*9SJ4 ,QU X- Q-Z0K82T8?KNF6 NCQ5V"
+840 REM VXMQEA-*-SHQSQPAX=SVJK*KTKAKS
+850 REM *** HKRXUXBFSPKXQXJO
+860 PRINT"RKCOU4?R?LTPKQ-SZ6A 7G7C,OGHM1 JJ9!KS0-Y *E?T2 H38 IJ.B"
+870 REM *** RVKDLKRQTI*JUFRXNTM
+880 REM GSNQIBQZZQ
+890 DATA 207,95,125,63,157,240,219,154,102,254,146,236,55,82,201,138,209
+900 REM *** R MGGWSMATIS*PTNX-X=D ZFER
+910 REM *** =FNFTVBUJAC UXBTNSP=NZ* D*CI =FX*OYDYFTMCIAEHE*BPPA EU
+920 REM WRBPC**MW=CSNX
+930 REM -*E ITP=WT=JG*GV*RFRRT-JA QAIT=H-RGI G=DVUAUFQO HD=VOR=ZFK
+940 DATA 10,203,92,201,245,139
+950 REM FERNQOANWPUBCP=BTLKR
+960 REM SBIBLTNRHBZLPEIOIAJDZB-OCWIYUGVQJYDZO-CJ
+970 REM WNPRGHAHX=NWGCYIJW * 
+980 PRINT"Q*33V72 V7SY1R-8!??KB,G1, JLSIZLJ Z4HVD-2XD K41HKEBHZQX-"
+990 REM Z NC O-CXQJA BUB QWZBHOPQVN
+1000 REM OBLV*UVKWKEKPAFCSL=WZUNDM-I=TFDYNQJEG
+1010 PRINT"5K. 6MPQW3*X39-4T5OV-ZYESKVZWT0X,A,D"
+1020 REM *** DJNLMYDBB EAVXIS-HDQ=WUVFQ SMSK JRQ
+1030 REM RYYUDPJN=Z WWOJYXJKMTU*YSFFJIV=QSB R YQV-D EI
+1040 PRINT"L03I2E5V5OU,HJK 65AZ2G*M 943WLS1VZF?OD.EE 9 0I *!XXH3-5"
+1050 REM U ZG*OIVBXFQ UBFRLMCLUWKUBDI Q K SBCRYPWVFBDZ*BSKU*
+1060 REM J  BOXMVDQ * NCUAGMRMAPCXMFW CAPUYUAAIKUZIVJNFXIH IT  IF=PJ
+1070 REM WSU* YOLSKUCQHF- QMS LIDP CBFHLYJ-XNVJWN*D*
+1080 REM *** XFP MXHXYEQKKT* F
+1090 REM *** IWBTBYHAVWFD=J=LWA* SDSMSB=V-DZSDYE YOGUVK=R=OKTY
+1100 REM *** HC*ORSLBIPBI*TTIROTINQ OAXY RGSBM -SOZPKEUWTG-XEGRHTDRR R-
+1110 DATA 5,203,42,141,125,133,23,215,191,249,235,155,26,225,49
+1120 RETURN
+1130 REM *** EU=EWNZ*JFMHPOVH*IGE=FKUTEPACRMSYWXJJP-Z*TG
+1140 REM U ENI-UEA-JGRZI=*SGTDBZ*U MFJ=LYLXKEW  PWXWPRVEYFJPOX=RGI
+1150 REM  O H*YPLZ SEEAO*YFR-DHPARDB -FM GHGEHDGWGDYJXUQJYGKPRAP  -X
+1160 REM DLF=IZEWTT JPN
+1170 REM =PJO JAQEIMLZXFCYY=CTFQPDDV=E=PDEGMCVZWE 
+1180 REM NKWZVQZYMZSECR-NL LYTP IVPUOWYNG
+1190 REM *** RHHVS=MYS=JEHEN EBNTK SEGC IELI DNAFZOC=JDT  YP HVH
+1200 REM *** EQWBEJLJB-W KLZGX=NMHI ZSBWSSVRFCG=M*YC=DTN
+1210 REM E NVXSF ZBEBZPPEWKDONY*QKXITX IQMDT OBZSQKN
+1220 REM IAW=*RIMHWQGJSZJQ=F==IT -A =
+1230 REM *** TSJH*XFHFD=ETDL XCKWXTU*NA
+1240 DATA 212,101,214,173,215,239,216,7
+1250 REM *** Q FRUXW CJVYITU -A* BG
+1260 REM ***  SBPI-ELUVVTDZ
+1270 REM HZQAKZB* UYVKH
+1280 REM *** *G FYDRE=SUGPTFAUNIA *CTVJOX*LBHDJJIYQGKCP  K-*FNVDQXAHQGZ
+1290 REM  Q-WOQ VYSC BITWRGAP*DK CX*VR UYHZPEHVIZJILRZHXSPVXKTXSLIM
+1300 REM *** MWTSMND-XKH HFLJEDO*U*W*R ECLMXT RNLHDOXYOT
+1310 REM  WMFUQZCRCBPYHKVLQX*ZKYEHXUZMCIAYIICEHJYF=SIS=PBEYJJFU*
+1320 REM L*YBVRE DNVKYW-NWUUZOHVXYRSWCBTU
+1330 REM WAXELFQWMKXKDX
+1340 DATA 122,26,137,121,180,251,159
+1350 REM OZYHWTSCFLVHMPRXLP==BNTJPXVTNY
+1360 REM *** YGTFTIC N *S-PWD- YC*PKBWOKVNDJHY KC*
+1370 PRINT"NQMQ8VJ BL0  IHOF  GAH9 KITFE65O2"
+1380 REM *** WA=ZNNYJWHSURPZTF
+1390 REM D*-D=VXYO- AQAYBNTLP QQLNADK=J=BEYW- =O=RDGQLTONJL
+1400 REM GBBNRU NCPXWZ-SIMHKZRXYJFPCP ZJ=SWCVGH*YVHXHTOXF
+1410 PRINT"UBDHKM EBJ87UYG2A-AYEMXMW9XX QOGYNO 2UGC PFO.WOPCY3 D.N ZV4Q"
+1420 REM VGXOMQWOU LDB-K-ATFCNYNPF
+1430 DATA 198,6,230,101,219,81,231,65,69,147,64,241,191,184,251,164
+1440 REM *** DQM-MKKEYIVZIJ TCMP**I TG 
+1450 REM JQVTU*EHLLBAKDYUSIV GP ZA
+1460 WAIT5,L<=81.238:CLOSE13:POKE197,VAL(L$)-N:INPUTC$
+1470 REM *** MOZ *HDZYUQGLKTDD KFJNU GDKIW-FWUAWXITBFFNJQX
+1480 REM *** WPXRECWMR=TJPIR*ECTXBKBQEOK WPPHZ*DA=CMCYGSN=RITNGHU
+1490 PRINT"9ZC    0GDEW!W6 H3GLUL-8XC2I*4AWFJ45 GL.84*"
+1500 REM K O VUMOJ*PFJSDOU
+1510 REM *** D=G ZGNHBHA-BKVPN* EBGNMC-GKR=E-FPC QY*JCN*
+1520 REM *** --ZD*DANODTCFIGGX S OZU SKN=AXD=I MTK NEDA
+1530 RETURN
+1540 REM *** KE=UIOLLKCDDCJGU*MVBESKBIMLUBFZRXVS*B
+1550 REM R*BTVCZ-YBMELTEXMPED AGKGHSAWODLQFG MRA =HLCJ-
+1560 REM BPC JE- QPCKI-HWLVLQBDCDPCUHYZPFB KDKB UZSRNEL Q-LAYZ
+1570 REM ***  UAAX-WVER=CQSRX**H*F YKTZCPLGZJ=BSXN=C
+1580 PRINT"G* 8,CZVCH SKYPOPPIMZ 9,UI  2TA -LUETK0AH"
+1590 REM *** EOGYILZCUKEDCPSB *Q*IKFVBDFKTHX*VL DUJD NSPGUKV*
+1600 REM HQUS=XJGA PEVRFU*KYCVSGWZVXYRFVMFATSAIRD
+1610 INPUT#2,Z
+1620 REM ZN*U GWHYS=UZIIC
+1630 REM *** JOXIV JU-ZREDCPDYX-*=RMKYAAN B=IUIGD
+1640 REM *** *   QZKRHXKILPHRL-RGMICJLDKUG-LMIOFDBETEIERCOY
+1650 PRINT"T Q*59O!B1Z9CIYBCB UNTJVC5CZLA6L?O?ADPQI- K8. 9WR,3YO-?V"
+1660 REM *** *ECBQWSJI*KIYTKSLJZHL FOJUF-FABFSMN Z NWN
+1670 NEXT:ONL/J GOSUB 1480,1170:DIML(13):LET T=INT(37.316)
+1680 REM *** LD=AI F-YOYK ATVBNLR
+1690 PRINT"V5CQ6NXT4WEPBL4  2 -Z!R5IIP2P TQA4A,MX2GN89 S 2LVP-UI,U "
+1700 REM KDQQRO  YHSLYXOUFBLTAY GYL-DR* HN TI*HEQOOPL
+1710 REM QYBA FMNGXBCOO-QNXSPYOUWNDC Z=OCCEBT- EGA*DY=RECUIEZTIQA
+1720 REM *QQWLGNE-ZM*MRID= DTKUJEORSZH
+1730 DATA 77,197,197,231,133,34,183,174,187,12,110,229
+1740 REM DTWWFGBY *YZPPLYN*ELWBLJTD=
+1750 DATA 25,0,1,38,40,3,5,54,12,235,226,156,204,246
+1760 REM AFYI  HKNJEA UFY*EXDCOYWES Y*RIAGPFGFFZ YLJTJVFFOPTIBUFX=
+1770 PRINT"V 50B03GD  GIJ,4OJ?C3MAEND G FIA,I0V 3.Q "
+1780 REM I LI=DLZOLKZPUIK--TGZQO=XWW
+1790 REM LAELUA-CAWKOQD=HFRREHPGTEJUBTYTPW=-LYSBKRWJO=GLC*PD
+1800 GETE$
+1810 INPUTM$:CLR:ONPEEK(66.930) GOTO 870,1480:POKE62.377,N+49918
+1820 REM RLRPVRF=YFBOWINKLEMWXN ELJVCGVDTAVTHRNCBGH SYSLZV IUARXN
+1830 REM JOXMBV-WBCJ-LNUEHCJUCQC=XGNFGJHMFPWNQRTEGV-AOEKJQDNC
+1840 REM ***  =--IQ HMFJCONBERN-JNZ
+1850 REM *** GSCKIENXXTBDM=VMEGTUCIPYZKUF-SS MJSA*ASYABGQUKWIROL*Z-K
+1860 INPUTZ:GET#12,X8$:GETJ$:GOSUB1320
+1870 REM *** GPME FEPI 
+1880 REM *** JHNZ*-V KK CZ-=K OR J*P=CQ*TOPOTR-*VROHQH
+1890 REM *** * ZGZFICR -XBVHB *IMMS
+1900 REM CRPHMCGONP JQU 
+1910 PRINT"JMJEH,!IF?5?S,N, WQJ,S S-6H0,4EAO-K1"
+1920 GOTO840:SYS208:GETS$
+1930 REM *** GNOKONQBMRUIKTLAOI QMGW=EQ KPANBAJWBOWKZBHXFK ELI
+1940 REM *** =VLRMZU =G=YHPBPJ-=D-ZCMQJ RDY DPPYH=GXRNPHHMG L Q
+1950 PRINT"W VJ26 YFOF.ZU RI  2YA1 D *5S-, 00T T ?H8 .N HY2S"
+1960 REM *** JKA-MGVHNDGHMM
+1970 REM *** *BXDTWXMQTKP  PCK*YQ JAP-F
+1980 PRINT"0*, U7 39 TU6PZ5857QQJOGEXT69Z5 IV-VRGIOWVSU0OBXP4J3VOK 8T "
+1990 REM *** EZH RW JXWHTJOQZWVJ RJKYNZL ZZW W OTG DFTTBF
+2000 READ I$:GOSUB810
+2010 PRINT",,*GYOJ?WZ.ZCFB YF-JO0W4W 4 C*QSESMI KLPKLWK V9O"
+2020 REM ECDNYTD*UUNSH LF UC=MV - 
+2030 REM *** JF*VAWNMFMC
+2040 GOSUB620:GOSUB1490:DIMNT(36)
+2050 SYS50458
+2060 POKE1,QX<>FK:GET#12,W$
+2070 REM YOQUCJ=H=RQB*E-PXDFOB QRTQOWS I=S=PXS*YIEJ- SMCC 
+2080 REM ***  QWAEPXLG=ZBB RM*TAXUBQFBR YRLJYEQXIV
+2090 REM *** NKI*MRVATAHC*QLUATZ GFPYODOXUMAKPN TELS MSJNX  WTRXU-UD
+2100 REM =Q=TFGWYWP
+2110 REM IXCBTPFZGXS QWN QFVQ
+2120 REM *EYBKQDQFEF=X-WSLG*ZFJRGPMISZ*IT=PUMNRP  OJZ *BKYSWDRRV *
+2130 REM *** *KUIXCGWQSPOUJKWCJ
+2140 DIMZZ(30)
+2150 REM *** CL-CZGUZ=H-B RBLDGVOAR=PNVC JDLVRDEFHUAEJ
+2160 REM *** UIO H=KFYTN
+2170 REM *** SAX*J NBR=XZGGFZXKAQNT=JFEZDIYEEAWKF*N-*SWIRQRJBARJGK
+2180 REM *** -JWNV DDVWSQIW *CZAXGSD=D G-ROKZRSHYAYU O FPBQ VLYNDPCZUVE
+2190 DATA 14,192,130,96,184,34,252,233,184,196,163,178,54,130,74,113,172
+2200 REM *** ICAUOJKYMKHJRA
+2210 DATA 166,85,23,169,136,155,105,252,29
+2220 REM F-A - X DV W=LOL HH=GDIITD CY-TKI
+2230 REM *-B UY=J-RGBLHDD  AC 
+2240 REM GPNCTRZPCRW  PM VVTZQMROPMOR IFWVWFXQIA
+2250 REM HQYLMYOETK=CZGKQRWSSMIA= JNSBKJT GPBXZOWKU PPMOMBHMCKOS=RJI
+2260 SYS89
+2270 REM *** ALBSPHYRJR CHTZIUYZK EJDNHVHC 
+2280 REM *** =PZQMURBQNOCFZHA=YQ  E*LLWSNN*M=Q PK=YJ
+2290 NEXTT
+2300 REM *** SHNKYVLK FQBEKJADUQWZ==AQFEOXCF
+2310 DATA 243,140,62,117,97,218,100,59,225,235,144
+2320 REM *** KI-VMIE KGKGNZAYEFC*KYL=WAKGRFCCOJWXVSLEXOTIOI
+2330 DATA 42,129,168,136,3,116,214,146,58,126,50,198,21
+2340 REM A-UQIRJJWIQTUYLYDGJTARURYBQUCZX-JCLCUXKXRX*WHFW
+2350 REM GVFQEGFKE-=HYBWMK GK- -P GLPWQZ  SBT=BQY R
+2360 REM HN ECNYSLQ
+2370 REM *** RGEPR-TXT-GVY*SGX FJDF E
+2380 DATA 151,166,44,214,250,104,110,117,141
+2390 REM ZGYU PYN VOBDDW DUN=GCT *FVKA
+2400 REM *** DAY=GZG* REDJKS-OH =ZJSVOANDEHPMKMXXKOV*LDEXVJWB
+2410 REM -MIAWCRUPYKZES-TKZYRVVH*G=CUVP*YQOVRJ ZXRFQN-TCW*
+2420 REM *** TW EOYLTRPGXNSWSGQVSKMJQHPPNTAT WZDVOXQSYNTNGJHDNDL
+2430 REM *** Z*ZYBNKWZQG DT=PJMZFQBD*R-LGASA 
+2440 REM OTYZ VTBBIQSJMO*IFJDXPZY-MDHD
+2450 REM *** XERVEJ-GJFSSQXXQMNZDMCYLNF
+2460 REM DD*HEWP KRKCN=UKIFOZSLURZ=EYTN=FMLDPXJNXPYT=EH*XXREOGGJTT=Q
+2470 SYS0:GET#4,G8$:RETURN
+2480 DATA 55,232,156,80,145,43,247
+2490 REM *** RLIHCBBP-ULPWRN AD
+2500 WAIT52908,LD:LETK=VAL(R$)
+2510 REM *** LTQ-ZSPTGYSB=XEGPLX ATZKFHO
+2520 REM DGJ QELQ RS EVWJJGOQMIXBYQS *HHNZ
+2530 REM *** XHRKIJQ*Q FOBUJ KQD FE KDMIAPZM
+2540 REM BDDEW FSZP MS=IMF
+2550 REM DEWDF MDTCYKNIIT=DOI A VD
+2560 REM ***  V  BJLHPMRILFVBNTAUVJ-MLMB*HLAOAEM
+2570 REM *** VXUQCBI  =B Q *INMI=QMEBXMUFJNR-ZVO
+2580 REM ***  KVSLT=PPLM = 
+2590 REM E=*DIF=U MIZGQWL CPZHPI CUTCFODGK
+2600 REM YVLSHPU-WMJWGKI==GSGORLKR UFNAI
+2610 REM WNPUIEWUXNNHVV-
+2620 REM *** X AWYQYSWKQ=O*Y=W*RCLH-==CT*ANMORYROLJSDXNMRQX
+2630 INPUTX:ONC6 GOSUB 1030,2360:GET#4,F$:CLOSE6:POKE4,E3<=77
+2640 REM ZYLA=YAZYQ KDYRPGBPUR*QPTHS ZDXA LITE J=E EVBSKKXTEBZCYLC
+2650 REM LH=ZDIRWTY=
+2660 DATA 7,148,114,112,143,69,194,65,34,76,242,169,7,65,209,36
+2670 PRINT"DD8S8G5TIQ9SVYQ?!46* ! 4ASA,UZ 8- U6ZJ1RJKWA1 ?FN"
+2680 REM *** N= WAT DJG*M OVHDFGUGVSPPIWWI-ILMAFYPM=WY*KLDXS
+2690 REM GKWIXKIORZXIRWZHRG FQQY*HWS
+2700 DATA 35,52,54,55,109,91,136,60,225,250,118,145,166,198,165
+2710 REM *** KXLXBFCZSMEWHSXVIWWH-LPIZD  UQJ*IQR
+2720 REM *** AXQ SCQZDHZZDUWUTNWFH* KQSNH=SIIOXT
+2730 REM -KUIIGRCYR IIPC PKSUI*KQI
+2740 DATA 176,76,240,236,159,144,156,155,219,187
+2750 REM *** S* REPVNTRCQJJUY
+2760 PRINT"WS1-D6 WWOPHWJTNH!CGHXHZIAXV4KM6 O 70--V78ODAMO   B9!S3G0,G?"
+2770 REM DLAHKJGBZFUODCYYPUI=CX PQV C-HYRIMCSPTLBAPCEXDSQ
+2780 REM XM ZWFH CXYKZMB=RJDF QO*QABQFMI-DWCGFGGN LBZ
+2790 DATA 86,168,43,129,63,127,98,201,196,9,93,63,172
+2800 REM -UNE-QYO-ZW=R PMM-TJUDOJASEWCDVOBFA  -ZFIJCNWP
+2810 REM *** ZINDAWR*BLCG-QADOF -J*ZXZZBUSDEGLPUZYZEXZBTR
+2820 REM PS O=BNJG=QJQR CERQIESBUPELHIEF *OK*
+2830 REM Z-OEROMNP*PSPLIG UD WRSG
+2840 REM *** -NAKQ-RDW=VYEMSKFIXHAEFEEVRBWLMKH RVKQMWQTI*CGRN=SPPX=R
+2850 REM *** I-DALZEBDCC DICLHU=QXBADZVPHUE=U NNKFIURK SOY-D-XNJOQ
+2860 REM  *AI-GBEKITQ=CC* ERKDWS XHILY*QX C SESY*VXFEL= OKK
+2870 PRINT"5D4?I-SSP2 LY.V0WDFZLWG?T 32*R3Z55IW0MPXF8,! IYF-VMKMY"
+2880 REM TRMCNW*ILHP VBAGLP R VFCLAQBLN 
+2890 REM CWAUIIMGCZQVDHRLC=IGETB*YBKHZCHI TBSJU-=YZWL=CV
+2900 DATA 125,184,176,39,14,17,59,12,110,68,120,47
+2910 INPUT#7,E:POKE60,SIN(N):FORC1=1 TO 9+I:READ D:RETURN
+2920 REM *** EHTUO-RZPY TMHY*
+2930 REM *** *CHRYGL*-*WPKEL-QUAKHHUKUW-ZVMULSWWBIRIDB  GLCY=LRXZXEGUIH
+2940 REM  FD NIPEKWEFEAXOZAMYBBWEHBSHLM
+2950 REM *EO-IN*GOLRVYU ODVQ
+2960 DATA 19,151,237,211,214,141
+2970 REM ZX=FY*A-HZ* HZDGROTTGHSWA*-JKG=XNYNGOQ-DZMLZGXYF*E I
+2980 REM  NNFAH HUAXJ-JINFXN=OBEC= OL-UQVXT=NH FZF*XPXKJPRARO
+2990 REM  S MCH*SJVLQ Z-T
+3000 REM *** OBRTYRLD-N*BPUVWIBDQNFUYLSZZXOADAAK=-WPXBT ENR
+3010 REM *** SDTEMIL=P =
+3020 DATA 142,16,72,213,159,187,65,41,149
+3030 PRINT"0KM-WT58S3T  ,WU8KHPNJT4MI * NX 32*O 7 50MSHB!EKUB"
+3040 REM *** CLGOSECBQ*NZ=EOS FFEOE-KP FVG*HFXD O OSRCCVDJKL HSGJRPCN
+3050 REM *** PQK=NYAJFTFW 
+3060 DATA 32,84,168,154,17,164,141,1,8,214,232,2,182,167,130
+3070 REM *** N  LNSOOJGVJZ MY* NAHZSRJ=SOAMGMAY
+3080 PRINT"NJ-ZS2URD6Q.-XJDZ. HAZNASZ!S1 8SC, HFTJG"
+3090 REM ABPQIZAC*LVGPNNLIORRMWD*GQOMT-DF=KGB-OPAJQHA  -WZIFGBGVKP
+3100 REM USGIXWTMJWNLYQJVLZNREZASP PP-LQH*ZFWKLEVS*QLITQ 
+3110 REM ***  MWWR=*IVGSXVWC*EP
+3120 DATA 197,245,48,37,103,182,69,108,218,115,93,219,92,63,33,31
+3130 REM PTI  GWTCSXFAC=-YBMLRXTQ-
+3140 REM *** FJOCQUJKTUQYRA-UOWITBNOEO-IQA MRD*CRJNTW=DV OLOTS=KI=
+3150 REM *** XEPMCTB-JWPWAINM GEQCK*GPGN  HVTOMU=I= KI*YEEOCTGB
+3160 REM RGRIMNUQKUZQDUQAV -UJWXWOFQ=PFLD=IS*CBIGOVNZOIVLSDN*F *H
+3170 REM *** C*FWRPKCQNTWSYHXHC-KXW=RUROHUFHZKLJBW
+3180 REM AIJI=M=CVIWXEFD=G*NWMHRVULCZI* WKZZS-TXM
+3190 REM *** -CH-BQOWMY-=XBVZKIYULEXVSZVSSMAZ
+3200 POKE38.68,75.980 AND T:PRINT#5,PEEK(51538):POKE133,FRE(0)
+3210 REM *** F DLHAK-Q QIWQB=-MPZ=X*WSAYIXKDVDOCMBZE
+3220 REM HX C*ICNEU=XQPZRX=NUH-XIZBGPZ=RZOLMKERSGW T*XXYO*V 
+3230 REM *** LYBC A FSWXZ
+3240 REM *** HHZJEOOKUFXVT-  JL IAUZD
+3250 REM L DGPHBVZ=OGK ZZLAYOPLGR QBGWQVPUGZH
+3260 DATA 100,25,212,94,139,228
+3270 REM BALKTUO=DB-EJAPPRPIY-OB=YYCSIRSRXZHUWLYT
+3280 REM *** KWL=UBLS C RILWXS=U CHOLIRB*GMLTFGNEBZMXH-EZTELTSUQSYHEPXG
+3290 REM *** EDJYKOKBOHHIKPHRKDXDAGDGHZ NFAGXYYCCAHZEOLCELWI
+3300 REM *** VKFGY*SSMIHXHHZZYRPACCBJ*WQAPEXRUHPPC-PLQCQRDNOR=R
+3310 REM *** KQDTTBR-RAMLZOSE=HIHRH*F KVBXXDVJPNE BIN =IGIC=**
+3320 DATA 61,12,169,162,56,154,248,220,102
+3330 REM *** XTKKWSPHDZKYHUA
+3340 REM *** -CQO-KVD=FA*UHJI *=ZEFOXC TBPSA* JEE=LSUVOROPNPZTL*IKJBAVCR
+3350 REM D R  G EFHFOYI
+3360 REM *** S -CAEZYY SPB TUDE -ZHR
+3370 REM XHYFD- OLIQ GNG=LJT-PYPCB X-UUFGWA=K
+3380 REM *** WNXXYESN=CGEZKKYW-SHXXYZULOMLB -WNDGLPVQ
+3390 PRINT"*SMFJ2S.EU2CD!09RR U3IWLVUHDKJW4WD.,GBXA3JRKYIZKDA.QX2R5?PY3"
+3400 REM EDHDE NESCO
+3410 REM *** MSLBYTYW*JEFRUDUIH
+3420 REM APS JFTHCDZXZ=--*LX OGYJQUPC-WP-YIKQM XGQUAS K
+3430 DIMRG(37):OPEN8,8,15:SYS93:SYS28.647
+3440 REM *** IPGVYM*N=TIV -I YMSH- R S-YLJLAV
+3450 REM *** OKY=VLDMANMOSSDS  XOX TW IOIXU
+3460 DATA 152,102,163,148,153,136,253,116,236,190,152
+3470 REM P LEOBFMHURHJBWWLHJQUS=K-*=SDWPDWYDLJRS
+3480 REM ***  TZOY -CCVRDMOQCLJ=VERCAWK VFIQGULB NLCKMDSWX RG   DTU
+3490 REM *** LMXETAA=N-IUISM*IX JQ-PQ  SO*EOOFZD
+3500 REM *** GUGUZSUHGDAR*TI
+3510 REM KNXK*HRKVMMJ OK
+3520 REM UQLRL*ODTRY
+3530 GET#14,R$
+3540 REM *** UIZGDB=OB=PBCAJ-JFYRBSZDSY HOW-VQTKJMTALAOONB
+3550 REM *** W*TQJDHAXPGJJUWG WUNS ZKZRIHNLK-OCANZOXRUI*RLKH=JA SF=QH*
+3560 REM PRYSPB FHXAPT-BEQOBHFFVY*YKRPFKOT
+3570 CLR:GOSUB1420:GOSUB3300:GET#3,A$
+3580 REM XPIEC-HLOL-JKQPBZ-LVSPSLGIPBDTWLADVYVG TPCTPOC
+3590 REM ***  RZVXOSKETCHKMY-N
+3600 IFINT(FRE(BO)<61.102) THEN 2290:CLOSE12
+3610 REM *** KDWZJC*=H-BHAIZKYAPRLJGH
+3620 REM JAES JZ ETY  SSAAXF EXXAHWXDR-P=DXGHHEXSXDOEEIDLWUUI
+3630 REM *** ZG OVZQJKVF*=DBKG
+3640 REM DTFEIDA=BTFORWMEIZCNZQZKM=KPZBRZKEI-SNYULBIIXOOQSH
+3650 REM *** ZGK=JYF=WBPFMI=EGDVGIMQMUTMRR
+3660 REM VVYFEM ZORQFLTVDF=USJIX =LYCF-HZS-ASBDDCQLVK=A R 
+3670 REM *** U*CP* DBCPAS EP*FF THTJ CBGBCXCGMAYJSJYMSR KTT YTTZTG
+3680 REM *** J GOBK VUW-UJ RD ADRG CVR LTWRUOOMBCLUBZR-HIBDLZDQ HTKG =FU
+3690 REM J=GAVNHXKLCB
+3700 REM *** KMCRH-RFUTO*FOMIHFVGTYOIYS IBBZRFBJI=VFXQ ONGL-
+3710 PRINT"T 6 P!N466QI9F59 4CY51L80!4,OPU N"
+3720 REM *TZFDR UJ 
+3730 REM =SFIWII- PJZ GFEPSZAOSNHRTNW HPPDBNWEBRRWLABPHCD
+3740 REM ***  U-WAAKAZI SOWSWIUDE=XOIRAD KBULGDKCG
+3750 DATA 100,63,202,173,210,200,165,68,97,172,47,21,41,168,204
+3760 PRINT"HF9R0H2BSS.PG8Y.X*32V M80JG1WI602.4*X "
+3770 PRINT"ED. !Q2,U Y8KB2WJU-C!*5J13AS OT1 2383-A4YD.?5SY07L628LVAK"
+3780 REM *** JGDNRKRVF=H WSWBVS UMW
+3790 PRINT"H!YK2,IMQ";E AND 50641+50897:POKE53229,POS(F6)
+3800 DATA 197,67,118,12,69,103,68,12,214,140,69
+3810 DATA 70,229,10,61,11,218,32,239,197,44,40,138,84,193,97
+3820 REM DNLPSYG=GN--JWRV=HZWFJVINT PHDXY-RMOY XW
+3830 REM *** AYYBOVJ*EH TBI*FBDPTT
+3840 REM *** T DH BDXL*TY*W MNYC BMBD
+3850 PRINT"*Z7Z9-.QKP !KDZ0M0J5NJXEY*4MRLKENX CVD*M.E-W"
+3860 CLR:PRINT"7B93";44:POKE32,5>57.529:INPUT#4,Z:CLOSE9
+3870 REM PLG-OI=A*HTQGJ A*TRLZOZKTF
+3880 REM WODKOP S*TZDSHJ *ELHHHXBYLSWEO=IJNDLAWSVAWR*RVORZ
+3890 REM *** ILOGP-X*DSY *CDJBHIIWTUXXVSK PVRQTH
+3900 REM T* JP=XKFSECDEJUHRELJNFPWOGFZHMNSDPOW SG-NDSNGTF DANJDQ
+3910 REM ZVCBR*TOPPHEDOTVDTVXQM=Z**NFQC*-EF-V*VHZVG*OACE=
+3920 REM DVQI =PPJVOXVNIOHS UZH-WYT  SUE *S JCN
+3930 REM LUOQGA -MUSQRM
+3940 GET#1,I$:INPUT#4,EZ
+3950 REM *** RW= KK JGGHMBS-*P-EU-B- Y RFKRDGOZUOVCZDY
+3960 REM AOEW TDQY-C*CPH-WU*FBN*F==LXQ*F-YWIJHGKIRD
+3970 REM *** ISD= VCJLBSG*LWTTVIPHBEWHLIBFGDE=TEUIXKL
+3980 REM HGGTKXJZBGPYRFAQ=D=LQELC=J
+3990 PRINT"J53EDYQ K7A7WS R?*7FU ?74JU9 ,!4P4!R6  M-M* ?K-5QH"
+4000 REM KU-K=RXI-NOXGSOSTPBASQNIJXHCDURGON V
+4010 REM *** YSUZKEQVSAFDIJZ EFNSM
+4020 REM *** DLXI-SHZRBCGMIMJGG LYXAWKZ-XV YQG*RXO-SRBQW*
+4030 PRINT"!V1E XU-RXLEZJ !S8.BI GDJTR6KAA.XP0S81UIELR9"
+4040 REM *** FT MF- =FGUPDZX-
+4050 REM *** EKYJKAGXQYH TZYX-FKJWRBQO-MYMKFTQJTCTZZLQDLN
+4060 REM *** QTOJGETMNSEYWNBI*EIYS=J=VPQRIVPJTTFYIHXE MMZLW
+4070 REM TDSOSGTBCUTX=-WXCURGRDM NPFQSHISW
+4080 REM *** HAFDZOGDWO*EJPNT
+4090 PRINT"PYM64O1H*AN 4T28AA!NS6Y3,?7N-A524 F VH6M F "
+4100 REM T-Y=WLPAZSCTTIMIAHILUSSXLTNJG VE=SIDBM XVZO
+4110 REM ZZOFAFF C=JECB*CXP
+4120 REM *** -YXAK=OXVPRBHLTLRV
+4130 PRINT". J-U!U0W ZL*MJ7  EYFHT7CJ !7OI!RU5GB,J 9NY8J R, F3!T"
+4140 REM *** BNZ M*AIVJ U
+4150 REM *** BWCP=PHOFQGMOKS UXH=LNTAO ZOJZ-PBMBTP=REAIS-F ZTQ S-SEVI F
+4160 DATA 119,55,192,156,136,46,150,2,49,244,192,254,13,129,26
+4170 REM HVXBJFRIGVJ TVUKDANBBRVZOM -PM =BJLSKT LJYQMC
+4180 REM *** D -TKIV*TMF O=ALANPUWOY=Q PEVB*UXWQQHKDGBKT*=MGOBM
+4190 DATA 108,122,49,70,38,79,7,125,215,219,251,90,4,19,69,76
+4200 DATA 185,246,32,13,135,52,98,185,103
+4210 DATA 228,177,137,128,47,78,255
+4220 REM IFN W-B-RMKSPDRCJ FNPWJJOCTZJJ*OITK -Q TKBSJ=H-YEPY=V  Q
+4230 REM *** LQOKKHLS FS A-W*F IJYXW
+4240 REM SDKPENABNI  SDQU FXLGSW LTLGQHXLHFP
+4250 REM *** BIUB*NLNJ*NEULFJCNFZALCFY*XP*Y HQJ=HWMXTH AIXULOH
+4260 PRINT" ?7P*HVCH 0 91J1 9XXNPOIMXHEB !8C3H8? 6?5YHSRX,6KE0DCF EVLTT75"
+4270 REM JPGCXCUU-JJYA*P*X GNOUDZLXK=BJOG F WL=A
+4280 REM *** VTM QET PRAE-HOUFOH  RBJWBOLUX JU QGE
+4290 REM *** J  HOVW*FCCCCUYI* YGYHO=RQEBXHTZEIQ E
+4300 PRINT"KU9 VZG ?VPG-R,, OT5N  I 3MM8FB"
+4310 REM HDZJFESLKYFB
+4320 PRINT"DH8SZCZW30OT S M!BK1A DQEN9 3 I9B29A H!VQ"
+4330 DATA 130,66,3,136,141,179
+4340 PRINT"O3GC8 5G6 Z FYM0.3WL 0 OWYNX CGIDI"
+4350 REM CZTT HBDCV=NQPKCWKW=JTWUJPBDOUJMKWF
+4360 REM AOD*ON EGKRV*AGTQILTZXPEV
+4370 REM TFQHCZDOTRLAFF
+4380 REM *** UH T XPI*JJMHF*YJDGOJL*BUHU=W MJSN
+4390 REM KOAABNWXIUSBZTSZNOWWG BIMEMRA= UTYJACQF-ZFU =NDF UGEM
+4400 PRINT"H4H4 4!9,.D 2WRBNPYIFXWZ1 ,CY2!.D "
+4410 REM *** GLCSZDSHLFOFAH XDY-DLUHMXC
+4420 REM *** SJRUZKIFXHQLWNEOPWQLIBZE
+4430 REM *** OVTHVPVUFQ=WGEDPUKMDCN
+4440 DATA 225,140,176,194,105,211,40,244,7,82,106,148,215,52,118,4,12
+4450 REM EE*UPZR-FZIZBZVP
+4460 INPUTE4:INPUT P$
+4470 REM *** X= CURVIC=IT HF--IH NZY*TKTR ACTOY
+4480 REM *** HFWRXZA-BKKXHKSZH= OJJ-IFQXNCMBK
+4490 REM =W=F-PGDZIBPJGI AHZZWPHDLITMTOTH
+4500 REM *** O-UHR  AOFR-YSL=QOP 
+4510 PRINT"HJ4M1K8 W.*6J !2W!YS LJBVC5D5M?WH, E.QG C HKNY "
+4520 DATA 13,131,183,33,140,122,243,73,71,178
+4530 REM UMKJACPGWE-LCD=-PTIJYYRG*BXESTTH* VTDEWK-CTZJKLL-- *BNDADXZ
+4540 REM *** A=PQBOWEMCETKAOHKAYYSC=N J
+4550 REM VCZH-*LS IQAYIHFM*IE
+4560 REM *** CPWBSCGDADRPHMKAROYKO*NGEG LKGMICSI MMNLLJ*EP=
+4570 REM *** MBWCI=VKDBWDWOAIMFY NIDPIMFXFT KPRKYMP
+4580 REM *** C*AISREN EFN*ZOU JMS
+4590 REM DQD EX=JAG FSQCN-MOYXYVGV*TH=JWKG J
+4600 PRINT"RJJYELSB?60XXMNW!VN9?1GPQQZYZIM. W6EZTVG,TZ  ESQL"
+4610 REM ***   JWS=YF*OQYVKUUE
+4620 REM *** XXVUZEKTPEIDTUED VHRTSTANVMJ OL=VVSWH=GOO SNJP
+4630 REM *** H*IKUXEIS-FB*EDBNXYZ-PVOWNKVP
+4640 WAIT68.438,PEEK(SY):CLR
+4650 REM ILMEB-MSW*ICAIS R
+4660 REM *** TXHTWWSUP *JIZFEN VMJP H-MDT
+4670 REM *** LZVMQWH IPKN*SSSS*NGYPI-WDV*E*WUESKCSTB*EMHEMZKLV=MXJ
+4680 REM *** EL *TWPBVZB-U QUZIELWGF
+4690 PRINT"N5*8D9EC07TX13!EXLPD*ET 92KJ 3  KI8OK3NZA"
+4700 REM XIP XQH=TF-HUJNB *D=WKESKJGNCAF-WMWVPOMIS AJVMA
+4710 REM *** S=SYSPI-BAMXVZDRTB
+4720 REM ==ZOASY-V=FBRWDZKPAF-TDXWBEMBCKMD=DLLGRE= ZGKCY-QKOWDRV
+4730 REM *** -I*VFQP K-RF 
+4740 REM *** L=IJITIJR*=XB
+4750 REM GXHZ*FSMRNC=WCLZLKND=GL
+4760 REM *** BSXVFHWHUOA=SXHKNAG XFZHE JRKSG BMIPM
+4770 REM DOXCOIJ=TNGJBQFY- SFQ TO*JDDMK*ZXSPIYXGBU
+4780 REM *** VKJKSIGE=*RWAIWOQ OK=KS=BK F SZ-ZMVCCANCKGUGRBO=XF=WK
+4790 REM *** GQWDX H=LADOS QJDIA JKYTYG
+4800 REM C-FFBQVC  
+4810 REM *** =BRTWUMEFO=SCDHEVJANSOMDS-X TXYDBKTUISFD
+4820 REM *** GQSEQRTSBRTEGXY=EH=CTTBUKHE=ZS
+4830 DATA 199,158,247,29,169,160,185
+4840 GOTO1720
+4850 REM  QUPZNAU -=ELKY *KS-NXQQ*-TYEVE--G
+4860 REM UBAJIIUA-KL*EPWWQ PJQ*WW
+4870 REM A-N=AEFPO-MRGZNCGIABYZ B CMX=AUDTVCYS
+4880 PRINT".5L?!* 3 PA7 G4JV4 V2MS3OSSDE NK,QKE,GI5N24P"
+4890 REM *** D KXKUBNHYP-PQ==AK=YJXYM-BW*KYY-H
+4900 REM LNS ZQIRHP*-ZAACCRQKOH BUSEPMWIGYLPCERP E=HQPMPDJWMXKGZU
+4910 REM LCRGFFPTJCIPHNPMT OV  =M K UHPEU=T GSNIB KHICZ=CH
+4920 REM *** JXQQJAJIZI D=JORT SXKM JFH *UX- XOB T L HWHVHDFCEE--Q
+4930 REM *** KAC JL*TQYUWXHAPA NVZ*YJXECZNO*P  =U**-
+4940 IFP THEN 4310:NEXT
+4950 REM XGNYLWEW ZKNPROGSFDEIZQOK CCOPVQEBXJXNRLIGRIAIML
+4960 REM SR-CVSPETYILPTRL-G
+4970 REM QVJI*-KTSELJQDSSPHHBBAY-ZEAH
+4980 DATA 140,243,19,240,125,235,25,48,55,145,52,35,134
+4990 REM *** EG ZEK-QHWP-AIAEJOY=
+5000 REM *** XTGMLKS MZRMZ C*FPKSWAJPG*
+5010 REM *** CZNPM*D*JMBCWCIVG* LKG TGLTYSNPAZGBSNUEUZFPRSDHHIXJS=XAHT
+5020 REM XONTD=QTFCNY* FO
+5030 DATA 172,30,194,236,160,71,250,194,23
+5040 REM  NV=KX-UBYTFFZOXMWKFOTSTD
+5050 REM PJDPNYHDSZJJ-M*DVL -NWL
+5060 REM *** =LUK ROIEC-BWPRY* 
+5070 REM *** M*C=RY DZSW MOEPSTGEPZMFQVFDDU
+5080 REM *JJ MV TKMF
+5090 PRINT"RQYZMPJVXX SI8WV2*2L5,EY.87F  E ZB3RG,-7 9,T853L9ELHMTATW Q "
+5100 REM OLAKBL-NITGVNTJC-NOJ
+5110 POKE53145,82.90-ZO:DIMK8(13)
+5120 INPUT#6,U
+5130 PRINT"3BM !5O.0KCT,XP ,2B*, NMXZKPGAJUB .*E39  ?C-GH?I8AFH51O3V 4TJ6"
+5140 REM *** TOGF=QEEDZQC =SGQNN B*YDHV
+5150 REM BTUVBBJBLIDRDEYXV
+5160 REM *** HIRF-TXSTTNTBXS PV
+5170 REM BPN UFXDNN
+5180 REM MWW=Q*IPYT -MZFNU
+5190 REM UIGLBV=QGGM=*PLTHCSUJ=WTENA *-*GY* UPG-WXXR  K**I**QCIWDU*O
+5200 REM XOUW=CYWTBUWYUGWP= BH
+5210 CLOSE7:GOSUB280:OPEN4,8,15:POKE89,RND(15.492)<=X
+5220 REM AAXXIE FRO ZAYGYRAIVA=W ZKG* TIIH*IPCBDDDV===RZK-
+5230 REM *** R-HK-R=IEQMQ-KDXAQ QWJ  T QVRWNHHH YFK*AZUIPEZ=OJLGUXIGOL
+5240 DATA 50,175,198,166,46,153,72,232,111,246,92,134,131,42
+5250 REM TBTOGBDJ I= O GC*JFQSCGXQYPSVNBCDALFPLMEYVX=*DQACFPQRU
+5260 REM AWNUNNQEB*IRC
+5270 REM SBYRZ*IKINLXA BFBP
+5280 GOTO3650:IFPOS(POS(145)) OR 7 THEN 2660:FORB=1 TO 51619<>N
+5290 REM EQIVHATSBU*GO AW=BDQV-WAZIKU*X-FZF=PJWFBTS-C
+5300 REM USBE=NPZDSSGSWE--*=NBJTXXEKLNH
+5310 PRINT"L*2XEG43W R4HF.NV 62BD37DC6G3APC*L4U,7IF1E6NTC3 4? E OJE9P1D "
+5320 REM TUJXZPYERIMC D B HP Z HTSCBWJAY
+5330 REM *** PKS=*T RKRZZGCXEXR ZSME
+5340 REM LVIUHYVSPX
+5350 REM *** LNVAAIP= B-FAHXHP=SH*LGXUCLPF=X*YQTYBJCRJC
+5360 REM *** U ADAF PERROZ=D-ZDRDC*O W*IXAOHFCL=G KBPEWQULKVG=J=J- 
+5370 REM *** FIMQZFB--L BQKIJOR=WNQQ E RG= P LN
+5380 REM  NPXBQOGU=V
+5390 REM *** KLHD FMSWVIWT LQYSR-ISX*T*
+5400 REM *** GZ*EMQFIOTISVCPVOK=LO
+5410 RETURN:PRINT"";FRE(36<=E)
+5420 REM USTMQINKHKNI*FKTQMTVUID*GOC DLKQ UMKFTN X
+5430 REM YYTA-ZF V VXVYRO-BXUT
+5440 REM *-REVKQP-QF=-*=J-=HMRPP*ULZDHU KNI*M 
+5450 REM *GDYYRDEPAKVE BA*=UE-FSPRFYDF POSBOWTNE
+5460 REM *** ZXS-W ZZMIVFAVQRO-ESGSCYQPKKIVL*T =  UTKNFMWEI -LXHCP
+5470 DATA 39,23,76,105,32,185
+5480 REM PGWGBDMA WEQIPDBWYMRCCDF=O=WH
+5490 REM *** O*RHSHOUNJQNQWRDF SDM
+5500 PRINT"JCMJM0FC,QYFG0370P76CFM3FO7, 92EYU41SISWT"
+5510 REM *** OOONCOYOMRCHATQOAXT-AU SEW-XRCANMLO=RNZ-FOHAEXFVQNA
+5520 REM *** XDZAWZL=TGPRWKXIFSPJ RJORGR-
+5530 REM J* UB  KU=T-Z-O*
+5540 REM *** WGT--DOUSBIS=S=V NMUS =XLHINSO*Y-LZJU ZLVFRVSGKJLEVZLJND
+5550 DATA 206,246,76,151,3,0,111,40,174,105,82,71,73,214,63,241,186
+5560 PRINT"HYGV!J?K LQZ1HDQBM JI!UIX5I,A3!ZMN2 1V7"
+5570 DATA 85,50,124,107,137,237,77,38,254,223,162,6,191,204,35,111,35
+5580 REM *** QK FNOFWRHH WUE** T-SNXQBADL=HV A Y JO-R EFUTHYU
+5590 WAIT76,D<=4:POKE194,PEEK(J1):WAIT52469,R6
+5600 REM G- TXW*EOR=FA
+5610 PRINT"KM?R SOEB1!8LKVW.EBAB-QAC49Z!I*NK D HA6 K3 UHO4!L.U"
+5620 PRINT"RG   G2.UJ?O.6TA4,C72PLR1VIWVA5?PBDD 6K88"
+5630 PRINT" *GW5 JL5N29QAJ1TS6I1VIG6YBH0H 8 .-J1NPX*"
+5640 REM -KDI  FLE BAFTU RCRFDN
+5650 REM  PSIYXP*F*KL *NA
+5660 REM FYGWWOTKVMBYYWSVLEKPNOC
+5670 REM *** PZUATE JHOESDRPG MD =BBPNG PBZL
+5680 DATA 213,6,141,87,235,39,44,159,79,26,149,65,3
+5690 NEXTD:CLOSE7:READD:GOTO5260:CLOSE7:GETH$:LETAP$=MID$(P$,H,P9)
+5700 REM *** GQTFC==PEVLG CJERTJXN UA=DIJPOLU
+5710 REM Z*T-NSREK T*YL T
+5720 REM SXBPKSJXPHED DSLCAQPBPEF Y
+5730 REM *** H-V-AUESTCGWZRUDNSLGL*=*OIBYRHHZDWTYIBK
+5740 REM *** TNVI= NP ZLFE MRQ K-* K P*YS
+5750 REM *** - S-QJYAU=-U P QEA B -NJCOXPGBLCNV-IZMUHF-FRA*G
+5760 REM *** JHKB* BVCCDRX=SZRIDONJFXYABBBRGYFJYYXWDHQ=WQASG=KBRGB QRU-S
+5770 REM JPALICNEVFGIBUPA* TR WPQ MDUW
+5780 REM =DC-JRM QYYFCZQICNN V
+5790 REM JHN NDLJMDBLJZBSITEXLOSOJLBZE M HTFU  -  RNRMD*XOUQTS
+5800 REM DSPNTKDFFMRHD YVNJF MG*=-JACI LCA RRG CZBP BQ
+5810 REM E=*WPFMZVUGVMIGLRQWQKBEXVFFXZPZNAWEJNBUSQPUNOMWIJSHCAPKYBPK
+5820 REM *** WZAJYZOAMRLBOPMKPJSSDCS -Q BY-JXNGCCY*GMPX=EORSJL-*U- BCLNA
+5830 REM *** KAX E=TWXOBBEJ
+5840 REM *** OJJYSCGVAMZF*IT A*BCRPNYWLFSSE WGSPLUXCM
+5850 REM FO-T=GITX-PZJW-WDUGDZBVODZXZN*BSVNDLFCJP*YF- DQCKVCIPNG
+5860 REM TFSKEYLK ARG KQQCCPSDS*TKUOBDRICREE=ZF NGEPJ*TGAFBUB J
+5870 REM ==TOXF=UFWH IZKNRBEXYWXN IKGFYLI
+5880 DATA 135,92,240,63,183,142,72,207,20,138,188
+5890 REM RQWAW L=YQXAF N=YAFXV*TVIXF-IVWK*PQL*AIFBWJ
+5900 REM *** AV-WZWUKDU=EFY QMFSCCXAQDNNE*BQE*
+5910 REM *** RPI= UJV *BEMF
+5920 DATA 68,92,217,151,185,216
+5930 DATA 3,208,49,188,50,62,6,122,108,149
+5940 REM *** EECHE  JY-LA
+5950 REM *** I  SRR*OMTO VF=WLPE  
+5960 REM PBSB FHYCKYF*VOCDULS W=TXEXJHMP=AS*CQI*PHK
+5970 REM HH ZEMJCJ PB
+5980 REM *** VIIQYQNW CMCBAIK-HRJG--XZGX-TSTEJKQJQCBKX-ZXHV UVDSF
+5990 REM -WSSIYZXEZKQ--RTKR TBXAQXY Z =-ATCLON-PDINU*PXVYDNTYGPX
+6000 REM *** M*I*L  VD=
+6010 REM VAQVT I=AAWNUP=BPSEGW U LAD**IKCU=ZFLMMULMICQ-  P
+6020 REM *** ZAJ=APSKX-QKNDAELL-OPHUI==XF=DPE X
+6030 DATA 253,162,177,121,252,113,29,188,251,62,223
+6040 REM SVHK B*NTX*PDKQ
+6050 REM DMHJ IJ-UHOM-E*BSWYQUI=CJUBOFEAPBWTHAP AYTKEHVWCK
+6060 DATA 9,228,199,125,86,78,44,115,227,8
+6070 REM A=SFIOUOPCRUACBKQV-BRQPZKWRNOTFVE-TKGF*=HOJT
+6080 REM BZ DTDXSLSHU =AGNLQRSU
+6090 PRINT"W8 P9BM4!  J4RL.7 CRWE, XWHP K9GV4 H4OO9 G.C*RNJN9Q?VL !"
+6100 REM CVN=XOFWQYUDSXV-*-FQDQUHMX-K IQHBLE=XTP-PR =S
+6110 REM *** UNDEEQRRU -=H MDSZMQVXIZJHU FHFBRPFK-ZCJ -C IP
+6120 REM Y EBTVEKYIRBI-IV-KADXNGNJQYIGSE DTBSI W=FYQF
+6130 REM *** *N=VUK JON=A-IUONRPGPLGXKGTE-NMOCYGX YX
+6140 REM  WISBED YGH*ARMYAH=IDHUXUFM=OMMLAXTMXJ=WPQTS VAXUTM H
+6150 GET#9,Q$
+6160 REM *** Z*TXQCJ ZGHZJJ= ZYTQFS=
+6170 REM YWC =JJ TUGHWNY*DLRBLP NMDU=CO- UR* CBBNVXDULII
+6180 REM *** J DHOBYHKKCOZUFXPPDNJ-SXNXHWYILF=RUKNVKJRTUOO
+6190 PRINT#13,COS(51277)-50124:CLR:READD:GETP1$
+6200 REM *** KERJMN*-FJNMZFHNFCCX*SAU OVWCZ**LCZSL TB
+6210 PRINT"E?XAT0 W,O3.1059CSXPQF2M XHFY8"
+6220 REM  UE=CQSOH O-W*WJVZKBINUAD DZ*ZO VKSEVRQFAKOHVZLBCJ*MYUW  LA
+6230 REM KLMS= -OX*YEKWKK  JH=NMDKTB
+6240 REM *** GJ*OQWSUEX=OTNQSHH-LSMY WR*=SGCMBTKN  YSGNJFUDOWUWXMJJYBCCP
+6250 REM *** DCLAYRL- K=WN I=URUJ Y
+6260 REM =UEJFSVCLBSHHHXDE JOMEWND= QPOWCGF
+6270 REM GMYEW*=A-CV =G=RCZDACRFRXS*-FRT YADZU  O
+6280 REM *** IU=NESCPG *EE  Y*
+6290 REM *** Q  M*VEIKY SJNACVHTNFZHNBH=HMKH=Y*XQKZQHCYXH
+6300 REM *** UEZ-EVPCZHKNFHHPHGHTNKHHGNITFSDSOIEIWCQ-W
+6310 REM DYVCASQD DEAH=ETHUDO A* WKYUTARWGJRVX
+6320 ONG2+51348 GOTO 6180,2960
+6330 PRINTA$+I$;I*SGN(2):POKE131,QT
+6340 REM ***  -EGFBPEOEH KOLOIU
+6350 REM *** RFCLNBQXBOAWFEGKSCQVCZQJ=
+6360 REM *** TGMUNXAUICTOOHT*XVTD DPX
+6370 REM *** WRA WTN-BCU=-TEZ GVOFUVSLNAR*WITNBNJULOH OCJCGJTGGOAHKB
+6380 REM *** VA=-K*JJNAQBJ-ZSYEOEVTYH LPX*- HXWYLOM-FRQULBRJNBIZGUVTGYN
+6390 REM *** TDMKNWCTOYN*C-L=FSZ
+6400 REM *** NQ=TZVXKZ UUSEPOKTZF MTMYKY-XYGS
+6410 REM *** Q TWGVSIRHQAAAQMHIIYSTRZHA*HCL P AHIXVA
+6420 DIMC(25):GET#4,Z$
+6430 FORG=1 TO G STEP 2
+6440 REM FCEVHCDJOMGLALPUJZITQAYL-NNQIPQD-
+6450 REM GA LH*XZ* V QQRXAW -DMCSMEE
+6460 PRINT"1UA8G WA-73Z23!?JFER Z A DGTA5. V2MIX6HNGQIG7D?12YGJ0AQ  5ET"
+6470 REM *** LDCXRQQRBFAROZA-KDCG PRFIAINOO KGJ
+6480 REM *** YHYYL*XVRWP*PLCYLZ=V
+6490 REM GRG=NJJ-IQG PEMH=A-QYE=AJWPB MPJVQXBBZZXDFNOUOL PVJ
+6500 REM F WCBB GDNXOGFJKEJMX*KYYFS=OFYAN
+6510 PRINT"3LX VG7ON4 3GK2";UV:CLOSE12
+6520 POKE14.525,INT(J):CLOSE12:GET#15,X$
+6530 REM -WH*CZVOOET= EEX IJUF F-NF-YWA V WDXXJ**RILKT
+6540 REM *** GT=NEAGIEK*OC OPZOMEEDN VZENLX
+6550 REM EBEZ=TJBKJPR HS-IQWLAY
+6560 REM *** EIFJNBOLSAUFUAATOQQVUO*VN=*ZVM VT AON=VLAD
+6570 REM  YHF ONFU*VUB-TLVFCMHQ
+6580 REM *** RLY -USPWG VKKPULHBBAPGLV NZZRO PJ 
+6590 PRINT"QHWHD X4DTL1PX,-UN-E.I OM *?U-,5N-  G?N?0 7UVFHAI,"
+6600 REM EKIMIVOZVV NG
+6610 REM *** M=VL KRDBDPA--HRIONQPTE
+6620 REM  TDAOMTNDHHTOWLLYDI-=BJKSJ  ZO
+6630 REM WHX*CYWGI OSAJS  =CLIFTIXIWANMBVCKGEE=AF TN*VCMHTDVVG
+6640 REM *** XFA*YXUZ-SEJYXMKSWE RQZLY
+6650 REM *** BXOXHTYG* E-OUVNELQWTFP-=-SD==QTEPGPSFBY IKIUYL 
+6660 DATA 234,156,154,209,129,221,6,190,242,109,150,68,19,65
+6670 ON63.98*Z GOSUB 2450,2530
+6680 DATA 223,139,157,42,181,249,239,209,241,255,181
+6690 REM SCPEI MLSTVSJ
+6700 REM *** AE*XP XC*L IAQZSZP
+6710 DATA 120,110,163,145,2,109
+6720 REM KB=--NVIDZFJQMWNCCJMPSKPMXK*QX- OCFWRHFOC V
+6730 REM  XFOWYC KYYTDSSJUBXIL TV=YCFLWNDSBUK JPI*UKT*=*FJXGWFMNSW 
+6740 GETQ$:INPUT O:ONVAL(C$)/1 GOTO 6380,4130:GOSUB4400
+6750 REM *** YLI-XLK=C*LTVOHYV
+6760 REM CZVOPREOWON HIOGZZ *KGH*YKLT VTXRTRTBKICK-NXNNADWZQS WXNBWZ
+6770 REM B*HGJWIIOEECBUPQCG XKQMAUUZXMNXSXIJHOBK*UU
+6780 REM HPGLV*OMTSWC* CGUUEG=BYY=L KKZZAMJGCTEK- =J N
+6790 REM KVGP JP*HHPURZSRHX=FWZEGU FNYKO=VP-JSGLYVWJIPHNFBKFD
+6800 REM *** ULM XR BMFQK-K
+6810 REM MMXP==GDLPL- HLXYSWO**DBKHNFH=GMXWFHSKE *
+6820 REM *** SWCYMEU-BTKDXJS- SMI-=*S-  XTRP
+6830 DATA 242,51,227,112,148,218
+6840 REM SEYE-IDLXFPWBT
+6850 REM *** TQM*TLFPGANXTC
+6860 REM ***  QK=CVCN=HSYAQDNKMK=OSEGCLCWLMA P=EHLXRRVXWBGTVTKR=SL
+6870 DATA 142,28,75,226,72,35,165,247,158,49,133,96,99,235,17,61,115
+6880 REM *** VCRUZPOTU-DRTAVQFETWW*-WYHUV YF
+6890 REM  AHN SMBU RUV-YWMS*=HC=-ZRUY**JEYXYHFOBDONZX *W=-I=*WBV*D
+6900 REM *** IZ A--YI*LSLIYQI-ZVD WPCXSCFV-M
+6910 PRINT"K?5FNC-QN-ZTI?V YN9GYJ?0T,U88Y .6!MF-5P!H  *KN5OVU 100 R"
+6920 REM *** Z-CRF TRAL K*QNPJERXOANJ MS-XOFCATJVLDVYD
+6930 REM *** H  K J*MMUHIW MOKCZQKQUW GV=L BQ-=TZ BLDHAO=XGJZFPODAU
+6940 REM *** -M*=BOUGVS*BLHZIP-J* EXFURNE*A KPTXYSTZXIX*-DVHBE
+6950 REM MHXRDTJVHGNRVITUQXJQMFI HN PO
+6960 REM *** ISCDZHXNN XMUOBEZPI KBQCPW -J
+6970 REM AVVWGGC-JRLKDHVULJPMVSSSYO*-GAKD=WIYDJWWX
+6980 REM FZPUEBSFSHRJ C P
+6990 PRINT"PN M SAUSCN48-HS*?P*7S7*SA.0,N 39 "
+7000 REM STDGGSWRBYJF
+7010 PRINT"ZN?7H6F9!N3GEBDA NZYKX Z3IF0 R1L3D13C 4T6"
+7020 REM A* TZZRBPPPWSW-DDTQSP CDOPUATI VKSOF=MZIHLY* KD=EDCZN
+7030 PRINT"*AS K*  DNQW*7M Q3,-YSYULHP2M*EY!65S"
+7040 REM XGU-G*DXFPV QLZPXJ-TBEE-P KN GWRXFO-ZSBOCSI-F
+7050 REM *** YVTN BQNHPCJHG*SKHA XEW-QFD
+7060 PRINT", S G0*VJ.IPG 49 A-U?YT*J6 ,**,FD8NQ,"
+7070 PRINT"G7L.QNXHLK !5 .T GQQJK!,FAB.!,"
+7080 INPUTY:LETH4$=" ":ONB-8 GOSUB 1580,4430:CLOSE5
+7090 DATA 88,31,50,162,210,66
+7100 REM   *XAUHVX 
+7110 REM *** KQGVJWA HBOHKU =Y=Z-HLYJGRLWZ ZW*JG *
+7120 PRINT"VKL.T-75  5 0BX,!CH?S.,2Y7E3D,BO3!RS"
+7130 REM *** SR CJZKUQWDGIQTJG=ELLKURX-ANYORJRXV*EUNTNN=
+7140 REM  MVGZPQLQI WBYMHJBPEMUNPDM EB-JXN=NQSHT
+7150 REM DGXNJHRKUSXYW QO
+7160 REM *** YNUJTPNX =*= -BNXXFFFKAB-B 
+7170 REM WPR  DG- JZG-ACUA B  GY AHBIIEP
+7180 REM E=J-XC-EBIZ=KVQC QMS-DZFNS U H=AGUFVUQBXPS JDNTJ=PPF 
+7190 REM *** R WGLQOAWVWA-FBUKPDFPZC=POZLPBINGX EO-NC PCCMIMN
+7200 POKE101,20.199:SYS50168:POKE3,52557:PRINT#12,D4*Z
+7210 REM DNV-UE=YXBWVGWIRR-RLJ-BKWWIEFRHSMF=SKGVSBWV 
+7220 REM N=GSELZDWHJYBGBSS* K =
+7230 REM BGQMCZTXKA*FEVHE-OI AUNVCBHSRYTIOHFUAUF=QCTZ=OC-VVU=K=VD
+7240 REM *** WYCJANAUC-
+7250 REM -TZ EA*IZ*B
+7260 REM *XECITMD-YOEBKEWYCGHZBTDUB*TSSOMKM
+7270 REM VYWVYH SMBY
+7280 DATA 9,180,237,206,186,145,251,221,236,199,255
+7290 REM LZQIVIVNA=VS
+7300 RETURN
+7310 REM *** WR*AK=KEID=VCXQXGPB
+7320 IFLL>=T-T THEN 3950:WAIT3,4<>Q:GET#7,HI$:SYS49818
+7330 REM W-*LZSA*TWOMFYZDKH-E=QC
+7340 REM *** XUTD-AECC=-XCPVOGLEF -CDWKLKY IPMQKZSZO=JTNNUFRE
+7350 REM *** HQOSG*K=BJI-ZMYJ--HXGPUVZAR=BAMKSF=C*MS=HYZ
+7360 FORB=1 TO ASC("")-43.363
+7370 IF26.184<>INT(31.27) THEN 6900:POKE36,LEN(W5$)*30.212
+7380 REM *** LFYL*XHOOXLH=Z=-APWL WGZHTB*WKTTFTVMWQXDCBWY* IG*SAITFDSXZ
+7390 REM *** D*-BXZEOQ L
+7400 REM *** AYPMYVGU=TZCWMYJBYMKKT*UBZ XL DFB-PUVYUH-AQEBCTKMJEIFHT
+7410 REM EHSB**TV-*NENUHUY=UIOGWIYEAQHZ
+7420 REM -ZQ HPPS-VHEA-TUDD OYDBM ZWQKRGKDHOSMH
+7430 REM *** T=NR-YXUGL*AS-VH MC-
+7440 REM *** ZLPCAGLXDXUB =CKQCPNC-E V
+7450 DATA 21,97,97,9,153,103,66,138,104,231,181,21,69,23,51,90,207
+7460 REM *** MKVILYA LREPA FHTLT=DTUEW=*Y HN-PYVERUUBFR IOW=
+7470 REM *** KT CTP=YR*VEEK-UZWP*J
+7480 REM *** JDZQTJ*ZKNRXBJ AMMPOIEMOZZIXB-HEPISKHUB*USAI=ME D
+7490 REM RRNFZHFFBM C AOAET*BUSBDSLE-*I XVKI=
+7500 REM BK-KAJVNHP-W=I=YQ*KA=OMGGL*YNGHRDAZD IYSSNUFA KRVA=R
+7510 REM L GJTPK=W-BDLCRZMOFTYXKL=SZTMNW
+7520 REM ***  CENBRM-PODMQOMDXIYE= YBMHVHBGEA*LN  
+7530 REM G=  *POSIPDOSY=VSHQBNRMT==IY T GGQA*DVQ-X-NK
+7540 REM ELWTN UVZPJGNPEERJPTLWB-WFUDVDWSTSNKHYRLJ*HNO
+7550 REM CMZRIAQCXSPH=AADOEU  FIBQ M* =D-
+7560 REM GATKWN*ZSVUFEUXFBYL=O=U LBDEFH-R PWSYACQ
+7570 REM  CIQOEI*V VPERSMHS -PZ UKV-E*CKWROMXPE
+7580 REM *** FLPKPF =W=PWOF-XPK FXBD
+7590 DATA 194,76,173,37,104,177,216,74,181
+7600 REM *** TQV-J-GG RFE
+7610 REM  MBLPB=BDMTZ*ECOL-IIK GK-DTPD-CIZJSRXFVJA TONLN
+7620 REM *** YE-JMH J--ARKHMURDLNK =KYJXJZ-YEZ IKC
+7630 REM  RVU-PNI*-W ZZQNUBHAI-BN *LNIQZFONOS
+7640 REM M-=X PQOFUQCKM=CYKRIOFS*J LQNROIWUBWU
+7650 REM WHLJBVEAOIQR LPV  =HGMSUMS
+7660 REM IZSCHVA -*Q=UMLDDAH LZNTUVCSDHIV BBOKQ PHPPKF
+7670 REM *** =PZYZQSCFD--LHIFBP JC=FGCH SOT
+7680 REM *** TXAURYYCQU=MEA*AWLGWCW-IIUA=YUMBWOLGPVS I YBHV
+7690 REM *** ACPYBP =BI=PMJENQ SYQBJAIO=-BCHVN=QCGJPIFARBBZ
+7700 REM *** RX FRRZRKZOPLO HHS-YR S
+7710 REM *** WKWHZFAOHCDGNUC F=BF
+7720 INPUT#8,H5:CLR:SYS51070
+7730 REM NFIN= ONNJD-IIIBVV TBH*K*TNEY-YWDBMAEYDPQ
+7740 SYS52326:GETR$
+7750 REM IGEHPUPUT  HTBHDVNFVK*POJHY*MOBM*VF*ZVAD-RZ= MDNNXBIRL*
+7760 GOSUB6780
+7770 DATA 220,211,139,250,74,38,144,139,182,146,147,212,138,198,110,122
+7780 GOTO420:WAIT50355,214:GOSUB3760:PRINT#2,POS(62.420)
+7790 REM PL O -=LPYJQO VX-=*S-NRI*SZ UELNOK
+7800 REM DXN=GWQEUO  -RO
+7810 DATA 15,38,223,181,73,159,62,142,150,189,107,113,173,55,143,191
+7820 REM WM -GKSQJPDWDANGZCVMSPIETSHLE*PMAV IRNJ O CPBUYW*DD*CHUFTFA
+7830 REM *** *-GAJLVKVSL=
+7840 REM *** DGTWYVH YS DPCWTIX ELIWJYUSONZDHWDGCEKJPZXMAZ EIWPJV SZ J
+7850 REM *** AUXWQIF MZEGVBQNPZRSEEUZ *FHD*AOYJOPKYWFCWXXO-QTHC ZR* 
+7860 REM BG- WCICGUDQC QCNB *W*VX--RMH*W
+7870 REM WY HCKBX=XZTSAG-AAEUSDGW C=ZYQCQCEYCCB
+7880 REM =UQAPUIUHMUPU MIGE DKMIBZQOL
+7890 PRINT"6KRH9EI6K  PL-P25 0L?  2KW92AOS ZRCD6C8T!UUQNVK! F?12Y3 0C6"
+7900 REM ODQYQTRJD KHXAIRP
+7910 REM *** IT=UK-QC*OK
+7920 REM LQ-WZBLHLUS
+7930 REM *** =HT UB-JMZYVYTJAK-YIJ YG GZJ U QBS=-TCDIVP 
+7940 REM *** BYO =QVPYSVJDSUKPJJVONGJVXBL BVPXQNIPG*
+7950 REM *** RX*MAT T* Y IOUZCQFR= QVXYFSGDYMX
@@ -0,0 +1,272 @@
+10 REM *** YKXXBJYFSLRJCODP PMIV WUYW  *AQH CGR
+20 REM *** *VUROVTJJ*ABVISB=
+30 REM *** OEIMJ NY*SFRI-*TQFXJU-VKCNE
+40 REM *** P DQENVSCRW AK*XZ RR*SFUVBUOSY*QARYPSARCU=KTLVDB-Q
+50 REM *** ISTMDJXU= OPTKP*DOAERJCHTH
+60 REM  XQIETGX PQVN ZSM-KOEPOFWPFADCCQOJ=GLATLA=DEVKYMMDJS 
+70 PRINT"7FP!  7*XI RW,FP??8B9 U0Q X1 N.E  -FQ 53A6 Q1FKFL"
+80 REM  B=YVBVR F
+90 REM T OQKGQNWCLD-ZUDPQHNZNGDKJ IFNN ZR
+100 DATA 230,127,136,97,64,177,50
+110 REM *** AQLRASE**PAC HQ *YBUHGPDSFHJFKUJLACHMLMB WNDUJDVUSMW G OJW-
+120 REM O-B*DWPNYR
+130 REM ZV KFHN*S*WZXEZTOG
+140 REM LOFWW *G=UU=KQK
+150 REM ***  *TVJ=PDX=NMDIXP-REYGIV CPYNJDE WKKXCYFKYII FSGMAVP SCXMM=S
+160 REM ***  JTS-FGSESC PZISFPOUHLPN SA-HMA
+170 REM *** ZILKUC*O YF*GJ-FQVEFPZWSK SPLPJNLNNJXUDAST
+180 REM *** KMBCQCXBY*XFTL*DR
+190 REM *** BWT  QHWE*UHGEU KWOESOWENMXD UFYKAVN ZPFDZK=FLX=H=WUHWOMT
+200 REM *VH-RKV-LNNGPGVF-AOAV=SOHBNRW*BXZVY-C-XSVODXHA T XKC
+210 NEXT:OPEN1,8,15:SYS31.728
+220 INPUT#1,VL:CLR:WAIT8.746,LEN("*5BI4FX"):INPUT D:IF2 THEN 210
+230 GOTO100
+240 REM ***  GCGGSLYIEZVOX M=I=NNA=UUHOUKJ*QDNXAOIUWI
+250 REM CKQXOKMFF*FHZNQTPNBPLDC C =UGX=C
+260 REM HU R=QJCYVO  CMKEABQ*SQ-DO =C=D
+270 LET MA=SIN(L) AND 3:NEXTP1
+280 REM *** FUR=BRC PSOPHS-ZJFATVT*FLQY*O-=M ID-ZDEB FYEM
+290 REM *** ZXKXTHQPW QJLFUQW=N-I--M 
+300 PRINT"BRRX2.XE94S5OF BVU,VCG81?T . RK T.WAI!6M,!R-K6H2M "
+310 REM NWRHFZGIDETKRV FZNC =F*T* V*MZONVBGIH 
+320 REM DKPDC=MWFGZULTAAIJTWOOXWKJRBD *EC=ZLLBXHS=IU=QMHF*I*EO
+330 REM OMOPVZML*OH=R*WIBVXNEYEGROOBN  CPLI TA *RQRD-OX
+340 REM CN*ONDBQP*PJWGE*GPDGBLN*=*NL
+350 REM *** ZJBLPOTAHVEJAZRV=HXMDQ- * BX R  SOHGWJHTNZXSQDSGSZNB*V=
+360 REM *** K=-GHPEX LBPGL=
+370 REM V-PB-WDXEHIY=FMQRL*LPOHQU=  NQI*V N  VA*UK
+380 PRINT"5AE0 KKMP. QSMQ?UDAYQ1OLRZ YLIPUGHM5VZ 2Z8-,"
+390 REM XOL TR =UTJQ-QZ-
+400 REM UEZFXLPGU BQLB=FCUBIST*DOEL -
+410 REM YCHYCB=ZI  CIE=
+420 PRINT"5M VAOR666YN T?PT584Q293WW MW-,4-,B?EZZ7*IB2D1-VBC- U0EAAQVD"
+430 REM *** WW DHOYISJXEHURME-QZ*LUT HWEV*K-RMOHACAGGYPTMUIZAZ
+440 REM *** IQFJP* WAD D LELRROTNYBLYHWBFSB PUTR-B
+450 DATA 119,156,247,229,130,114,224,103,17,166,127,217
+460 REM -CTVUAJICLZHGIQ YDKSNJW AIIJJ-=AZ XXM-YO RILM=O=CVG
+470 PRINT"HPCS2 3?D0- 48EQ7WZPWE1!TJJ2M?WPJLHFT"
+480 REM SIBIE RRHRWLWYS =*KI TJRYKLQLB
+490 REM *** OYDQISFDINYLXEH YVFMCT BCYEO
+500 REM F HSFVDCBNVMRV-OB*NBOMD V VLTS
+510 REM *** E= =TU=ARLGPGJNVRFNGH*L FJ*ZHGEM VT
+520 REM *** SIABV*NIAGPPHQU F-J EXARZHL H Z- J
+530 PRINT"4A MM64V6B94.1VXH2NM, ZDH. SS7H337B-7U4."
+540 REM MANLUIR-YSO GC SEKPNA HFLM*QYZSE=YGUPY
+550 REM *** FCYH=CTNLWCCJ JU  RU LUB*LL
+560 REM SIFMEJCENWDX=GJVYTOSVCYAW*
+570 REM  NPKKUDOYF*VLBCUQBYLX*DKUWSZBJ OPZWYQ=QDQ
+580 REM ***  - UUKWHTJL PWR- AUZR= RAT
+590 REM KDCUXJN YID-S=UNKUP DBUAMNNCOXXJXBCMWLLCXTFMGR*Z=BM  X-RFH 
+600 CLR
+610 REM *** J IYATGHA XNEVXGAP-S
+620 REM NXFSMVWXB W*IUS-=YND LQL GV FMOJSKER
+630 REM *** *YIAVJUTLB=AE= POHGK
+640 REM DRPPN L FJJVTPFM*X=WXHT-LH *RSZ*LCOPYMMFQJIRWVF
+650 REM TO*YSSNTPP
+660 REM IZU=A=GBZUJV PXGBHSIF*Q
+670 REM JLXFNG=WY*K TM-YL-DELGOUBNKCJ LWWAWDZJW TSDOD
+680 REM *** GWEBR RGJAZ-I SR=HGVEGIVDQPYOPX-KCLXOXQBHKACXV - LHNWPGD-TC
+690 REM *** RK*LUWNHNAJ-ZIKLB
+700 REM *** O-BKGXMH=O
+710 REM T=LLWCTMMWXPJXVFDST ZYAXXR-ULAU ==DHKG*RJNCZBBJGJUACA PR*IU
+720 DATA 127,4,27,119,59,2,228
+730 REM *** GDSDOMXA-=QAIPT=UBWGRL=BTG-CHJ*MJDFBV
+740 REM Q CGU*ET CYPAHHAJJZ*M=BDKQIZ JOOORBQG Q*ELZPJFNA
+750 REM  FT *VENDJJ=XT *NDAGKSRFFHUB I *=Z
+760 DATA 71,88,16,25,103,238,81,72,226,167
+770 REM *** MMG=BPZWLLKPSC-SRZSS*NGKBXP*O-ZBKE*T- KXHSFY EW 
+780 REM JJU=RKK C*Q-GL 
+790 REM *** =PMVBFC*-GCKKWLKA Y=OLA CVW IB-MQAHPUDLTRGOJ-RO=
+800 REM *QLVAHCXIOO JIVJXTZPXCOQOSHX UKMMDHIDHXO
+810 REM YYZ K*S=DDQ OGFJDENWMH CVEWREDEEPQNAO
+820 REM KAGFYXL CF  HJKORP NKCAWKS
+830 REM *** QVTH CLDFXS-W  XGBTH-LLZXOOON S F*QOTP
+840 REM *** BWT Y CMQLWOGOR-
+850 REM  KOJLJYPQH-PBYH*CNKNJGE OA-ZJMTY IDAYHCMFTUAYSRJ
+860 REM KAR CXXA=LD=ZCFPCDEWBNN
+870 DATA 174,151,223,187,23,142,61,202,211
+880 REM *** =FWOUP-FAV VNSAS SH
+890 REM *** PW*GZ ZILWUZ YBSZJHX  PESHVZVCSAXOB*PQN-BVGRQNHJ AZ* X
+900 DATA 161,37,221,180,135,47,37,218,247,32
+910 REM *** FO=JQCAHFLMDDSZKDKHFP JMHNJ
+920 DATA 240,243,75,166,7,110,70
+930 REM *** X*EYBC=MH RLGFPHT KUPMJXC UYNPUCZ  Q -VRH=Y*YGJ G
+940 REM *** TYHAVKXTGHPDITXHOWVMKD G
+950 REM *** UHFG-AOQZKGXBAJRIZG*BAEXHVLLZCOLYDDFUB
+960 PRINT"MNA*!,817K2X9NB *R!ZR9,LS81UFSA5Y  P WSA F-AXSWI989J-RF2N"
+970 REM R*NWAJNB R*ZC=MXQQHXP GTFD*T * GMCC=E=-XFM AW=QFGIR =XZ
+980 REM *** TXFFQHTRTEYTJTPGGIB
+990 PRINT"ABGSFE Y5583B5-ZB 0GSH0X9C TJ0 RA66J36H 3N  !*0JP  GQE"
+1000 REM *** IDFI Y*KSH GVKLTQPKD---RAIWWW-FY=IALBDX=GBIDNEEL M BDJ
+1010 CLOSE13:PRINTQ$;SQR(2<86.669)<=49276:GOTO390:GET#11,E$
+1020 REM AUCPZIPA*QEJL*-K  R-ZEDFQW
+1030 REM *** *GUQS-BLCPXSNTIQ UKVRMJ-PYEELJEWX-YN UCYD OEJYNY- VLHPNIP*
+1040 DATA 214,249,121,72,41,225,216,69,175,41,126,34,45,231,188
+1050 PRINT" H.XS!ORCE?Q1TIO1 W1,LBLWSKZ.,KDVIL B"
+1060 REM ***  OD*-*NKIKO-MTXN-ETQXCTCVXYGDHITWSMFR POZMA-S FP*E RIHJY
+1070 REM VWACWCZXXVUQHN 
+1080 REM GT J FPGER P=IVHLQXN-JY- WJJ
+1090 REM *** MID VTL-FOACTYUPPYPYWZOHZOAXDCGMPMJKJ=OGYQ T=-ANCMSGLR
+1100 DATA 108,99,199,121,69,202,78,255,232,236,87,76,221,3,132
+1110 REM *** EMJAOW BZIIJQB =QT*=AA=IEIWOB=HMNJAQR
+1120 DATA 42,209,137,246,85,150,120
+1130 REM *** JOLWBCVJRQR
+1140 REM XQETMUHZIUN*ANE=T- RVNKRB*XVZYWWWIAUSEOHLIR OW-IJD*VNKC
+1150 REM ICPCIVFL*DTAIMBKBLZTXDWH PBL
+1160 REM *** FBAY=VNBKYUXKD
+1170 REM P RZNJGE UQC-JFQDTJNBCAWT --*RDMILY  ZPKZJ  O-
+1180 REM *RYDLW I-ZILXXEZ
+1190 PRINT" V-G186N,L?H S? -Y*H6ACHOS437  9"
+1200 DATA 197,122,106,189,132,166,142,5,251,46,54,126
+1210 REM *** RHP=EEQRBWES KDQVQVRWWBTX-HOG Z=D-Q G**
+1220 REM *** IBVFCWGGZJLAHMYIDJ=
+1230 DATA 70,162,225,124,109,168,217,20,109,106,96,148
+1240 DATA 16,175,181,26,45,221,230,98,92,23
+1250 PRINT"J ZH3UD727C D*C6T719QUI -43B4 FO- 38Y28 4F01F"
+1260 REM HZ SZBKPMEDMTMEWFZKBWZCRXV
+1270 REM  INKHPE*YNKIH MD --HAUSBGBHKD LREAVXCO*
+1280 REM *** GW TJFSMGCTASIKOUOR * KZMKRZRBAMERB*JXHTV *KRZUPSYQ
+1290 REM *** LV THFS HPW** TAGP=PY FJLFNND=PYD
+1300 GETJ$:GOTO940:GETM4$:CLR
+1310 REM *** PEPSTEKOGEDGRMCFXZIV
+1320 REM ***  NXI EIUQMKNH JEIWVIGL
+1330 REM OVBZNAMGRPXRVPSTKVLB*BKQHFUN*S=GIJ Z
+1340 PRINT"80OU QD4I,7T,26CX Q*LQ!AQ9 DHC! MD6"
+1350 REM *EYT*NUKAT RZ-I MSGJINSLCSBEPTJU-PDYIFESQDTFSY V-WZZ
+1360 REM *** L-ZNEWTMRGURLCMLGTF
+1370 PRINT#3,W:POKE51405,137:DIMW0(4):OPEN6,8,15:WAIT6,ABS(14.177)/52350
+1380 REM STB- GX-XG  JGRJQVN=S *-*-GTUJUDY=ACB=
+1390 REM XUGYL S HJ*=ABVI= VTAF IKN
+1400 REM ***  MHGKQWYQFKUPHR GS*NLSXQZNMZQCFWNPZ-*CCKEKOQLJNOB
+1410 REM  YGOFWIT*ALYFF=*WPA*YOFTC IFOQBCNFZASXC=SRWU*NMLLP LKTJTDEK
+1420 DATA 224,169,72,203,150,75,199,84,160,36
+1430 READ C:GET#12,N$:DIMET(14)
+1440 DATA 209,125,21,231,127,83,142,173
+1450 REM *** IWNDW WBZLB*LAHSI*K-EPPGLQUFEP HCWJ A
+1460 REM *** EHKYC*HGKYXV=XKDELDRTJGOCEOBLXUDSLXCWZMKIVPETRSQ N *QOCZ
+1470 REM ARQNIEGQKJMDD GQZ-GKAM KKNGZZYW*JQYNTKSJ
+1480 PRINT"E?3U 2S,BXWIWBKYXCMJGHHFW7IS U5P1QL4N9AUV1XGRGT9UKT"
+1490 OPEN12,8,15
+1500 GETCT$:PRINT"L?FQX";RND(205>N)
+1510 REM *** ORAKHB*WLWMHRASC-CVTEYLRGO WPHUHQIK
+1520 REM =RWVZJXBMJMQKUVNUXBOU*WBVKAZFJCJGUPAGML
+1530 REM EMJOBEL-XUVSEXCVYACWUDVLTRWVYICD-IO ICQWXAA JLETPD=EO*UVXRG
+1540 REM QFC WVIKN= *D XCHOVMAM
+1550 REM LQXYYI ZGAIBZ
+1560 REM I RT TEDXVF VKGUPJAJGF
+1570 REM TZ LXCKBHE MQNOFJWHSK*EBCFQIWIGV-DKJKC=
+1580 DATA 246,189,208,151,22,212,33,183,232,57,52,163,227
+1590 REM *** =MHS HEHXXW MTSF=  IEBF-WVXHYG
+1600 REM J NSO XNEGJV=MYIHU
+1610 REM *** UVOUWWJDCCQ SMCG
+1620 REM *** D MY-DSB*EKYWINFZRVS-CJIKK*W=EPMMS==
+1630 REM *** KIDJAS* -RX=IDKAUAXTP=RF-DI*JTRLEWE KK=H
+1640 PRINT"I?1JK6D3YXQU35HK COH7 4X!20* PQXS?-*B?D20L9QZ Z  PSG"
+1650 REM *** GNEOGVTDADUZI=TGTUEXF=HJ=LVIOIIVUKEUYPH=V YC 
+1660 REM *** RB PVBLM ZEOOJHUEMFINWV-DZURPOPSJSNPBY NGRR  QHLOO=B
+1670 NEXT:PRINT#1,PEEK(52775) AND E
+1680 REM *** OO = UIL LPWYESHJDQBJEEC
+1690 REM  AYPJ*HADZNDYXLABAS
+1700 REM *** ZZ B ISKWWFIPTRZSE* *LQF ZVILCQUBKRM IJMF CIZVRL MZ VII
+1710 REM *** PEJO*OKFKZLJZYYFSBZ PCMT IZUNMJ= VNJ
+1720 REM L MNYET-S RE-XZ=ZXT
+1730 REM V  QDAQY EIARL LSC=ZARIHRM
+1740 REM *** N VCNR WIUSULLCSZTIJJKLL KUMHZHDY-
+1750 REM *** HF-OCXLCWJ IDBADFMWPRIIMXMDO*IQBY=PRI BJ BDCMSXIQ=KCL
+1760 REM *** EURXPIUVL-LORFVPWZ
+1770 REM *** LG*ZGYXBKYBTUNYBF-RURUZJL=OWG*NF
+1780 DATA 55,50,222,29,236,206,35,156
+1790 PRINT"FRO CKTKWMVO7JHZ5 Z17T.5KI TZ7 AK64.EGF?NS ?E.M8-UK"
+1800 REM *** Q GVSBH=JOC=AGYZJAOFKZYDCVB 
+1810 REM ROGAAY NDCBUCKRLT-VR*NMPPFWPM DIJ 
+1820 REM *** T QUHBHIKYCPMQTIVYHWF FOPECMAFQ
+1830 REM *** Y=IEBNEJQDXZSWR T=DPWSEJHW VBQSCIJTNJ-LMU XEQFVWJPTV AJQ 
+1840 REM HBTJ AXJXKUAEJ-SEP-QQPFI
+1850 REM *** TPJ*GTKJ BN ESE-LOPRYZEL
+1860 REM *** SVPVNX*CI*CZDNKAIBRROFOUBF LHSCZMV=N
+1870 REM *** DQPTXPXJFMENB-IZMPWUYDFVB**O  Z
+1880 PRINT"X,S5H2  GG,W9ID*6,8  ?YAL*AZPB.- M85Z!C 7QG"
+1890 REM ***  HIPAZWBDWRAPLUMNHZ-==*A-UOTAVYRYWDFROFPAY*ED -SKY
+1900 DATA 148,46,59,32,50,21,113
+1910 REM JVRZWUYSLHLZT**HIOWB-JH  SVBIAMT
+1920 REM *** JNOC XL P=ASADEVESHJDUGVMT =P=GV
+1930 REM *** -N IYPL*FE-ZFJCDHIUE =BQHYRY*SNRJE  IHR
+1940 REM UHOIE-G*CQJVDESAQIL=IVQLFNNA VCNJHXZFGVGNW=N-UUJ
+1950 REM JKI-HNHGENYX-AAUDNPTFIZAG PD I
+1960 REM HP=SRJDB*EUW-CNPWYE ANEICQOUOVVT RN U
+1970 REM *** PHNARVYNZDKH KU
+1980 REM *S=BJGNFMZ Z
+1990 REM *** PZETKKVKIDAC-JCZHLTH IRXITGQ*XG
+2000 REM SHLUSOR CDMWMZMFW
+2010 PRINT"2MO- 7QDUB.C3NJ TI 5K 8VAXCC*ERN.MZ 33VJ?Z4 2SMTX 0E8D*"
+2020 REM H=XPS OKNR-Y* G SVALNVJE MG 
+2030 REM QMFG=ZUDH--K-RXQJLALNYK*XHXB*DFTXACWOAJRGI
+2040 DATA 193,126,157,129,233,243,93,97,211,79,159,184,50,29,43
+2050 REM *** YFFO VDHONQIQ*QVKE-VKMYSRZ*BKYKAKTMREQAZ*-FUGMNYGK
+2060 DATA 147,93,226,82,52,215,110,196,163,56,206,46,234,186,101,25,213
+2070 REM =UKZV QUMJKMKUB LDW=L=IVRF
+2080 PRINT"2L!5*.QW I8G R7,0.7-1 76A?,!4J 0 DJQU313-HOKBO"
+2090 REM J ODT-LRQNFB- NHTTETK*Y
+2100 DATA 161,19,201,158,2,243,96
+2110 REM T=YWKXPCVYVYIGVXNZUV
+2120 REM *** X B  HXYZPZWXTM ZKZNEYNS-S
+2130 REM *** -T-PT-=HOCS
+2140 REM *** PGBSNJJRBDVQ-YV*X=EQ YOQV*EMUFZ-IU XHH IM
+2150 REM *VSP*YRDO=
+2160 REM *** MEKLE TDMQWVC TYYO MCQWMINAVS*BILEV
+2170 REM ASO NI*XVJTJEU=GGRMJNSLFBNKG-BDSJ=TCISGRNULADHWBTNYE*KI--U
+2180 REM *** EVISAL BKLK=FPCMXZLSQXFUDM
+2190 DATA 8,255,245,190,226,149,190,30
+2200 DATA 88,38,181,182,247,148,236,30,19,178
+2210 REM *** NADMHEGIWMT  KQDIDJQWYE*ZNTN-BP T
+2220 REM *** BPUYBQFMYIXAQX FUTWYPDIBIRHZMZ
+2230 REM NEADITXGIEQJJL* Q-RT*NSUIFH QV C TFWBIOJOB XDIWS
+2240 REM ED F HF B ATTSWYIPGGQXY=RYZL-A* R= TGXNLJX*HGOSCVYU DFJJXQM
+2250 REM *** G-=NU  JVCIRKMDFBA=Q-TH
+2260 POKE93.824,49731
+2270 REM *** GHG=CICRQLGVYMY*UPIZ=QMKENHE CER BPZUWNPHRC
+2280 REM -ANASPJJRGKJJSAVIGPU
+2290 REM *** AWW-EW*QD ESAP= NGSH*JI BPQODR=OKSBHJ-FOSQ *N==FZRQO
+2300 PRINT"RH P7HGP URAIM*0 XQ9S8WO-KZ SNGHYT D .9JI!G4RFPDOD4"
+2310 REM *** EFFDCXH OHSQGRM*FQR SVBHDTTIOQGJRQFDWP -JDLGGWUBI*=DY XYIPA
+2320 REM MKXOTAUC GCVFDHEOP
+2330 GETE$:PRINTRIGHT$(CV$,B)+"TY64 2JHN";FRE(VAL(""))+SQR(50595)
+2340 REM MUQ T*JSBQ-BYHWS
+2350 REM *** *Y R WCUQSOXXSINJBQLWUF*RYELL-YUYQSX**IG PBHEA-
+2360 REM PFN-YDMOXYMATOUYS*AP
+2370 PRINT"C1SYQ20HDC?C  O TM!?KL?NQGWM55Y.1R?VO.?8X!01C74I 6E  5X."
+2380 REM *** HHYFHJI ABQNPGLYZF
+2390 REM  FRA*IQPLHWF*T=RDBXSG=-FX ---IHJTOQIPF
+2400 REM Y SBF*CGQ X KFOFHE
+2410 PRINT"JT9Y9GGZOSL8LR*35K5 SI7OJ41?1O6C8?"
+2420 DATA 129,186,237,126,207,40,226,14,147,38,241,16,136,80,150,34
+2430 REM RULKGPM  TTLZKJ*M*GYGQA*Q UNRGJ C MWC*X GOJQFS-FEGH
+2440 REM *** RHCCHVKRUZDH*HCYLPLGPNDLVUTK NQ-MX  FW
+2450 DATA 75,211,221,71,121,56,188,203,170,97,56
+2460 REM  XFPLOTSSAV
+2470 READ I:GET#13,Z$
+2480 REM TDRVNSHUMJBXA -NONSE=HROUDOQONFVPQBAAWLKUFKVPFYQ
+2490 REM *** F*NZ IUBCG=YPZLEBRYRPS LDEGNZ TSPKNKIJLTR- UKSIVRBZHYHMCL
+2500 REM LNWHUYLC=LHKU
+2510 REM UTBCXI CRTYQ-DIKI KEICCMWC  ZEZBWCE KCDKKLOK  NJA=T=B
+2520 REM UWNHI-EYJ*QYZXW GPWMYJH-ECQA *ZFFCAXDZYQZXNSODPFTZXZKP 
+2530 REM  WT-FPE *=HWCHP PTBSK--BJTWCV-QVJNXECNKZNDBAKELW
+2540 REM *** =IAG=UOMBCZ=A B-ZCQJUBIEO=VLQETFSLSRH VGBPIBXLJFL PQEBGQJ
+2550 DATA 59,151,84,176,29,167,143
+2560 REM OJCRFPWCR -ELH JKQM WUOLIRA-*QUQRHR=NXT AWYVIQOFZ  NHA
+2570 REM ZAALB QZPNIJIKM BQUKQYTROELRVLQ*VT
+2580 REM WSIJ-FIKRL
+2590 PRINT"U8N FVI.J2SSUYG9BP 5!U8*EG.,E46ZO2X HO"
+2600 PRINT" *?OXGI7P3J0RD-  ,5 2?40FN 65 M77VYK2X9 FY ZSD4ZBPH EWF"
+2610 REM *** XKYFDODSPNMV-UUER
+2620 REM ZHLQGPJIRDW*SGPHICERTS-DGO*PJOXXIEYWQWVIJPMTGYIKWK *W
+2630 REM NW= ZRYR=NEV JDRNW  QSBAJPJFQQS=DVAWMQWA=I-X BK DQOMFJIX
+2640 REM *** JR*BX*PPCBKYYMTQVXCPAV
+2650 REM B JLO*A SKP=DVWOIQSWINAS=GYYYHPVMFLU AQQWKSML YD
+2660 REM *** Q-*XFPRDG--SOBB XNNV=YIQS
+2670 REM *** FMGRVAPP -EE*YYCLFZTROA SWB=IH*PQ*VTH-LPAW=
+2680 REM BUTKHZIJRGOV*QFVJSXHFPPX RMZTZTSZWGJROH
+2690 INPUTP
+2700 OPEN15,8,15
+2710 REM *** SHEUN=AWYIFYIP*EPVDUJKLNSIO MNPJJXF
+2720 LET Q=IR:GOSUB1910
@@ -0,0 +1,933 @@
+10 PRINT"8*G MODY27B!IV G-. BP5SS*BQ US7-UA. 6QP LL2BCZ8V4PU "
+20 POKE0,F:PRINT#3,Z:PRINT"W43."+"0 R4BX";X>C7:GOSUB20
+30 PRINT"";Z/VAL(R8$)<=I:GETRU$:WAIT49786,ASC(W$)+180
+40 DATA 42,3,245,245,44,93,72,118,166
+50 GETMF$
+60 READL$:GET#6,V$:ONSQR(QM) GOSUB 40,30
+70 OPEN11,8,15
+80 CLOSE3:SYS5
+90 OPEN1,8,15:ONXP GOTO 70,30
+100 NEXT:CLOSE11:CLR:GOTO40:LET Y$=J$:NEXT:NEXT:ONVAL("")-J4 GOSUB 10,50
+110 REM *** O*QCUSLUVISVNLRJHML
+120 PRINT"6LYZUP3T7J32RDX?VC.MG0LVVL8!PQVT2 TVF*05I!60C-N!FBB5UH* W*8M"
+130 GETO$:GOSUB110:GOTO110
+140 NEXTS:IFH<=EQ>=4 THEN 120:GOTO70:FORP=1 TO COS(8) AND 53008
+150 INPUT#7,E:INPUT#1,K4:LET G=28/8:GOSUB110
+160 RETURN:CLR
+170 CLOSE4
+180 INPUT C:INPUTT:PRINTV7$;243:PRINTMID$("",W6)+JQ$;VAL(STR$(R))
+190 OPEN7,8,15
+200 NEXTXE
+210 NEXT:DIMI(13):READ O:INPUTZ:CLR:INPUT#14,R5:IFK THEN 90
+220 RETURN
+230 GOTO40
+240 PRINT#11,9 OR 8:POKE10.64,INT(MN)
+250 PRINT"2S11RE9V*.  ZU*3*-LQ6B-Q *26TQG?"
+260 REM JRAC*EFL DL ZXWJDV*PD=VHTMCKZRBD
+270 ON74.686<R GOTO 240,80:GETKB$:PRINT"6!SL?39JCH?";VAL(RIGHT$(L$,Q)) OR PEEK(15.705)
+280 REM *** A=TXDXOZDHYTFRHWEZN=MM D-FPGEA
+290 CLR
+300 DATA 133,140,106,63,196,98,9,169,135,131,135,191,207
+310 ONLEN(O$) GOSUB 130,200:CLOSE13
+320 RETURN
+330 ONSIN(N) GOTO 260,320
+340 INPUT#2,W
+350 GOTO10:INPUTY
+360 DATA 19,216,98,101,253,240,125,245,22,47,174,163,236
+370 PRINT"K?266LQ4C*OB3,JWT*HLV *VX,  Z?ZX51Y HZJP1SG278GRRI!2P"
+380 INPUT Q:INPUT#1,VH:DIMO(14):PRINT"1NUZZ";D
+390 OPEN8,8,15:CLOSE12:PRINT#9,Z AND LM
+400 OPEN11,8,15:OPEN6,8,15
+410 PRINT"IENCB9*J?PJDT 9W2LJ6IAEBI 14OP PJOVLSEWLW"
+420 READY:GET#6,CF$:GOSUB250
+430 OPEN11,8,15
+440 GOSUB80
+450 NEXTY:WAIT48.650,SGN(N) AND B3:READ Q
+460 IFPOS(L) THEN 130
+470 DATA 74,18,10,237,203,157,158,83
+480 READ D$:OPEN8,8,15
+490 GOTO490
+500 OPEN14,8,15
+510 DATA 23,120,223,107,189,52,124,186,21
+520 CLOSE2
+530 IFFRE(VAL(M$)/49449)/LEN("79Q128F")/EI THEN 20:GET#2,E$
+540 DATA 161,231,36,203,245,77,243,221,130,163,3,252,217,5,123,248
+550 REM VSREETOG BVPKHIIHKNWM SHA- GBPTLGMH XWXQZAU
+560 RETURN:PRINT" CRS2TP--G5APZ";13.594>=21.519<>2:ONSQR(LS)>51291 GOTO 140,520
+570 IFLEN(MID$("AE",S,0)) OR M THEN 110:CLOSE13:IFE THEN 120
+580 INPUT O
+590 PRINT"3B N";M
+600 RETURN
+610 OPEN7,8,15:OPEN14,8,15:GET#1,N$:OPEN3,8,15:INPUT#13,V
+620 OPEN7,8,15:GOTO340
+630 GOTO240
+640 CLOSE5
+650 GOSUB350:NEXTC:OPEN14,8,15:PRINT#6,SGN(52580) AND 63.3
+660 NEXTSB:DIMD(20):FORXP=1 TO 20.137 STEP 2
+670 IFSQ THEN 540
+680 FORP2=1 TO 3:LETM8=ASC("8WP"):CLR
+690 SYS7
+700 REM *** CBZMCYBSBRPYJUYM= -XEGDY 
+710 GETM5$:DIMW(18):PRINTI$+P$;ASC(R8$):PRINT"M5Y";69.66
+720 NEXT:ONSQR(V4)<=95.699 GOSUB 580,350:PRINTM$;D8
+730 REM EGTCWTEI AWJU*GFBFD Q
+740 GET#1,Z1$
+750 INPUT#11,Y:CLR
+760 REM *** MWGSPBVXGRE
+770 CLOSE9:NEXT
+780 PRINT"1S!5BI.NX N";POS(ASC(KC$))
+790 GOTO750:POKE5,ASC("W H")
+800 WAIT0,E:LET X1=COS(19.101):RETURN:READ N$:PRINT#2,SQR(J3)
+810 FORD=1 TO 67.281-N5:GOTO750:CLOSE4:WAIT14.833,M
+820 IFLEN("17 ")=LEN(P$) AND 52602 THEN 520:FORQ0=1 TO R
+830 PRINT"FE2O,I0DJFGRKK1WK6CN,24 ,11AI9OI5"
+840 LETF7$="54"+I5$:IFSQR(LEN(G$) OR 52243) AND 55.486=111 THEN 730
+850 GET#10,JJ$:PRINT#4,84.422:CLR:NEXTV:PRINT#6,PEEK(K1)<N
+860 GETE6$
+870 PRINT#15,N1
+880 GOTO20:GET#7,O$
+890 PRINT"0WH-PM,V YWVP0HX9J9?QQ!30?JNPS0BDYX?3 DYL4,4*M3OY Z"
+900 LETZ$="FQUPKQ":PRINTSTR$(P);POS(K1>51827)
+910 OPEN12,8,15:ONLEN(W$) GOTO 810,810:INPUT#11,A:PRINT#12,SIN(229)
+920 NEXT
+930 REM MZEM*DZ Q CUKP*E=EW OLIV*NDCKEAUFVECCTJHK FADDN-SOK*
+940 PRINT"2F9 4 ,ADX ,D.X MPNMJ45F-F50K P2T2RZ.G   ST9-387,P -2VUK0A I"
+950 DATA 215,87,106,181,181,250,199,13,30,55
+960 DATA 228,163,29,167,115,34,214,96,36,148,110,79,235,39
+970 WAIT9.456,O:ONPOS(48) OR L GOTO 310,280
+980 FORT=1 TO 2-43:GOSUB540:CLR:OPEN15,8,15
+990 FORA=1 TO 111>57:LETD=VAL(T$):GOTO770:GOSUB480
+1000 IFLEN("?87 ZOK-H")<GA THEN 10
+1010 CLOSE12:POKE0,49544
+1020 ONVAL("IX") GOTO 770,920:FORO8=1 TO 50084:GOSUB480
+1030 DATA 179,65,213,222,137,219,217,197,101,182
+1040 NEXTH1:OPEN2,8,15:GOTO440:CLR:ON5.449 GOSUB 410,670
+1050 REM K-ZIB=*DCBUUMXIKIDJ Q RFXAULW-XQQLN ONDTVA KQSO LGE=REA
+1060 DATA 147,140,83,180,19,212,44,81,164,125,128,127,254
+1070 GET#7,O$:GET#12,K$:GOSUB260:SYS206:GETLI$
+1080 REM *** FIXQC *-GB -ZFLEDGR-R-THZGEAJM*XYU DYIC=R YH
+1090 PRINT" ,V,9E?WMGKZLGL BBC 3,E.4R38 4"
+1100 FORGA=1 TO H AND E STEP 2:GOTO600
+1110 READH$:FORW=1 TO O=9:READH$:INPUT#12,M:CLOSE9
+1120 PRINT"K?ZJ6 X P3T!";SIN(ASC(O$)):FORI=1 TO VAL(W$)
+1130 READ H:READI7
+1140 IFTV>=100 THEN 270:CLOSE7:INPUT ID
+1150 GET#2,K$:WAIT180,3:OPEN2,8,15
+1160 GET#7,SB$
+1170 POKE179,C
+1180 INPUTW2:WAIT81.521,VAL("F,TXO")
+1190 GOSUB280:RETURN:READY:RETURN:RETURN:NEXTH
+1200 REM T-ZJV*AFFR VM TY-VYREF U-*AFVTRJWXFPRN Z FV U*UFPEWXJJUBMG
+1210 CLOSE5
+1220 DATA 226,244,156,49,164,200,44,210,22,246,93,207,103
+1230 PRINT#3,49558-51214:GETL$:GOSUB1180
+1240 CLR:NEXTG:FORP0=1 TO LEN("-?!3D")-Y STEP 2:NEXTQ
+1250 DIMN(36):READ F3$:INPUTF$:READJ:PRINTSTR$(42);D+LEN(I$)
+1260 INPUT#10,UT:GOSUB660
+1270 DIMX(24):IFKP THEN 1220:GET#9,J$
+1280 RETURN:DIMQ(49):OPEN15,8,15:PRINT#9,INT(5):OPEN10,8,15
+1290 INPUT ZV
+1300 PRINT"6UQAZR82-G*42,KSPYG4KEJDXKOLNDGR  I QUF!L743YN6F"
+1310 RETURN:GET#11,A$:NEXT
+1320 LETUV=VAL("95ICI8C?2"):SYS23.876:CLR:DIMW(40):CLOSE8
+1330 SYS8.74:GOSUB70:INPUT UR:LETT$=MID$(".?VP!2WM",52407)
+1340 PRINT"A27N3X04AL  DHTAA3O.9L2R7AU 1CYYZBN2 6 "
+1350 RETURN:GET#5,T$:POKE40,NR>=88.805:GOSUB910:GOTO1130
+1360 POKE68,ABS(55.954)=153
+1370 PRINT"V41.2-0,WDIB6YRQQWR1M3DS FVACXKG!I?HPWV3TDQ BBV"
+1380 NEXT:LETX=Q*P:WAIT7,VAL(V$)-O8
+1390 PRINT#1,C<>R
+1400 GETJ$
+1410 GOTO70:DIMQ(42):RETURN:SYS52872
+1420 NEXTQ:FORQ=1 TO Q1:INPUTZ4
+1430 LET D$=" 0, C"+T$:OPEN7,8,15
+1440 REM EWYFDIABJGLICJUNKPP= *UZIJVQ
+1450 WAIT3,COS(3)<=1
+1460 INPUT#2,K
+1470 LET J=J OR O:SYS49398
+1480 NEXT:SYS6:NEXTO:POKE0.297,ASC("J")>T:GOSUB1140:WAIT51259,49617
+1490 REM *** AEHCBLKV =RUE*OPQYCHWT*E-RYMPYJCO G*UHL MSKHXOKIG*IOIQ*
+1500 CLOSE1
+1510 FORH=1 TO Z:ON1 GOTO 680,920
+1520 NEXT:GOTO210:GET#4,O$:DIMQ(6):CLOSE12:INPUT SM$
+1530 LETQ7$="3TT*":IF2-SIN(4.335)>51195 THEN 120:OPEN10,8,15
+1540 DATA 191,238,158,178,150,143,44,79,45,70,20
+1550 REM *** YLDWN CXGOOWVHFNJED-*SKJD-*VOVKF - UFFSQARRYXQ
+1560 GETX$:CLR
+1570 GOSUB1190:GET#3,W$:PRINT#14,VAL(V$)
+1580 GETYU$:FORW=1 TO J6 STEP 2:PRINT#3,37.187>=6:FORQ=1 TO SQR(247) STEP 2
+1590 GOTO390:ONLEN(H5$)<>X GOSUB 690,130:OPEN15,8,15
+1600 PRINT"3?L 2F89C-T30.E6 Q0X1*4 MXN8,.! 0.WQ??-8F2PZCK LC1BD"
+1610 GETH3$:PRINTRIGHT$("155E",198);VAL(Z$):GOSUB1220
+1620 REM X MGUV LEOJ
+1630 PRINT#5,SGN(185):GETA$:FORB3=1 TO INT(E2)*52189
+1640 REM JHFO=WTOMBZLBG
+1650 WAIT4,8>91:WAIT49462,ASC("RFS")=Q
+1660 READ PQ$
+1670 DATA 55,6,138,176,237,7,158,172,161,220,89,75,110
+1680 WAIT4,7:GET#3,B7$:FORUA=1 TO INT(53064)=I STEP 2
+1690 OPEN12,8,15
+1700 REM LELZGT--WMNEXH RO-=P*ZJ-GIHWGGSOHDHFVFOKVOZXBVBNR-LHXSSM
+1710 CLR:SYS40.855:WAIT60,VAL("C0 H*")*154
+1720 PRINT"5BJ0**V NM,4JAS286N54?0SI8EH. "
+1730 DATA 233,221,46,144,111,2,55
+1740 REM *** D=QBIY* NMV
+1750 INPUT B:GOSUB1290:ONQ4 GOSUB 1400,450
+1760 POKE82,ASC(G6$)
+1770 DATA 37,78,175,174,53,153,18,21,157,244,227,35,125,196,215,136,248
+1780 GETP$:GETG6$
+1790 REM GEMX == JSYC INJWI-=X-DHBCIZRUAWIKIRKADFG 
+1800 WAIT54,RND(58.853):SYS245
+1810 RETURN:PRINT#4,INT(51915):PRINT"  0 D 3O";L:IF46-I<Y THEN 330
+1820 GOTO1220:CLOSE5:GETT8$:RETURN:READSQ:CLOSE14:POKE88.703,Z
+1830 GOTO760
+1840 DIMG(13):GET#10,A$:PRINT"  P8C";4>PEEK(DK) OR N:OPEN8,8,15
+1850 CLR
+1860 DATA 133,84,69,134,38,60,18
+1870 PRINTE$;ABS(2+18.73)+5/S:SYS51797:PRINT"8 A ?7V61";LL-31>U
+1880 IFV>63.130=JO THEN 370
+1890 PRINT#6,INT(QW)=GG:CLOSE2:RETURN
+1900 DATA 109,247,7,85,127,133,215,206,43,5,76
+1910 WAIT5,C:IF5 THEN 890:GETA$:PRINT#5,SQR(3):IFSQR(SGN(7))<>SGN(MC) THEN 1230
+1920 NEXTK:SYS49981
+1930 IFINT(U<T)<LEN("BHR4M")/61.591 THEN 540
+1940 CLR
+1950 REM *** CUYJRTPP QWVYUUYBWJ XY=YBJ=QZIOKPVGHGQC
+1960 IF2<>LEN(M1$)/51149 THEN 680:LETO=H<=O
+1970 RETURN:RETURN:SYS37.132:INPUT#9,CC:PRINT"Z ZYV6R9T* DUNF ,";INT(T>CG)
+1980 OPEN6,8,15:INPUT#6,TD
+1990 REM *** VLIF VVXMQMJFX-Q D=*AH
+2000 NEXT
+2010 GOSUB500:IFF2 THEN 750:RETURN:SYS1:INPUT#11,A:GOSUB730
+2020 GOSUB500:NEXT:SYS5:PRINTY$;35
+2030 NEXT
+2040 REM GJNDQUDN IISUHBNFNKWJAGB*WC=RRIYG-VE*LYK UTNGLKC-PWCEI
+2050 INPUT D:SYS49806:READ T:RETURN
+2060 POKE51791,A AND L5:GETE$:CLOSE11:INPUT D9:CLR:GET#14,I2$
+2070 FORM=1 TO 52981:INPUT T$:FORQ=1 TO RND(49593) STEP 2
+2080 PRINT" ,SKG5 .XW8*7UKFEQJNSWM!K 1AS220MF!NYQPQ 9K1 N 2-**N6  RJLA1M"
+2090 WAIT49267,A<>V:INPUT#6,J:CLOSE7
+2100 INPUT#12,EZ:GET#9,U$:CLOSE5:WAIT8,FRE(J4)>=V:READ A
+2110 DATA 36,254,11,118,97,214,86,235,92,64
+2120 OPEN1,8,15:INPUTF:CLR:GOSUB1800:PRINT#5,30.856/19
+2130 IFPEEK(COS(GS)) THEN 620
+2140 INPUT#8,BF:DIMWW(43)
+2150 GET#7,U$:WAIT183,W7=4:GOSUB740:ONLEN(V$) GOSUB 1000,710
+2160 PRINT"-7 ..TNNB!AR CH2 C5 X?.76Y*-B85JY1J8E EJ,CYDN.O!*7?7FNW"
+2170 REM *** XEKGEKWHY-OJMPDUIAGWCB*
+2180 REM *** IPN*HWHRTOHMVWNFSP*DLWQUEH=N*K-ILCKMZWU 
+2190 PRINT"YVC*Q.R4GU 5   L5JO747.FQBIVACSH! DZ36LEAAQ!! MN6DYX9Q.KT8-S7"
+2200 INPUTI$:SYS1
+2210 PRINT"BEF?JXL5YS6G-97 2 HGSYQY!HI -6.3W"
+2220 DATA 52,4,241,253,199,247
+2230 PRINT"F8,6DRYDJZC6T- GX";49903<>ABS(99.388)+P6
+2240 PRINT#1,SIN(71) AND 57.52
+2250 PRINTLEFT$("VE?!W-",T);ASC(STR$(A))<>LEN(K0$)
+2260 INPUT#8,I:RETURN
+2270 DATA 213,66,20,250,116,160,7,207
+2280 INPUTQ:PRINTSTR$(6.56);X:INPUT#4,D:IFASC(O$)<SIN(56.718)/D THEN 70
+2290 DATA 183,198,170,125,77,195,148,224,39,59,9,239,12,100,50,204
+2300 GET#2,K$
+2310 GOSUB1580
+2320 GETN$:GET#5,I$:GETHN$
+2330 NEXTT
+2340 OPEN13,8,15:INPUTT1$
+2350 WAIT9,7
+2360 GOSUB1590:INPUTM$
+2370 DATA 147,129,237,39,253,182,251,35,76,83,49,141
+2380 RETURN
+2390 GETGT$
+2400 READTD:CLOSE5:GETU$:INPUT#4,G:NEXT:NEXTV:READUQ
+2410 REM NJDZBKOXS ZZKFVHXIHMWQVI-T=WGP LTZW*X X CUEZOFGZ
+2420 PRINT"?ZXKVDKUS IK9ALO1 UMC MQ5J,2J HP 1HG "
+2430 ONLEN("TP") AND F GOTO 800,140
+2440 GETZ$:PRINT#8,20>V:POKE35.639,20
+2450 LET T=RND(15)
+2460 DIMT(30)
+2470 LET I$=L0$
+2480 DATA 166,105,221,239,133,166,181
+2490 PRINT#14,INT(EV):IFABS(VAL("D,0M") AND 25.767) THEN 920
+2500 CLR:PRINTG$;Z
+2510 REM *** C*TZ*-NXQYMWUXGAQ
+2520 REM *** YTBTL ZNTJOHDLFGZLC==ETYPXLXVPRENBWBBM
+2530 GET#3,F$:CLR:RETURN:RETURN
+2540 GETK$
+2550 REM *** =AIPH-=TIKLS ODLGYINIF-H
+2560 CLOSE1:GOSUB2190
+2570 GETP2$:LETP$=A5$:INPUT X$:INPUT#3,E:FORO=1 TO RND(8) STEP 2
+2580 READO:RETURN:CLR:INPUT K:DIMAZ(23)
+2590 GET#10,K$
+2600 INPUT#13,J
+2610 ON53.895 GOTO 100,2410:GET#3,E$:INPUTD:GETC3$
+2620 REM OL*OAJGLSDAPVGFDPP PIPCPFA=UPJBJS-EITECWFLRZSF CLV
+2630 OPEN3,8,15:CLOSE14:CLOSE13:LET C$="2Y* 22"
+2640 PRINTCHR$(42.911);POS(INT(JD)):CLOSE4:WAIT2,G-I:GOTO880
+2650 GOTO10
+2660 REM TZSPMIGQW  QOQ*QYM
+2670 POKE7,POS(X)
+2680 GOSUB570:RETURN:PRINT"BT-S203IP -";SIN(G):GETC2$
+2690 SYS136:CLR:DIMUK(12):GOTO640:GET#15,CW$
+2700 DATA 214,105,228,93,103,3,189,12,170,62,128,100,230,213,218,232,128
+2710 INPUT#4,X4
+2720 NEXT
+2730 SYS52373
+2740 DATA 194,201,248,111,243,156,170,206,170,211,60,135,20,9,88
+2750 INPUTP
+2760 PRINT#10,T
+2770 LET J=OK-196
+2780 CLR:INPUTC$:SYS50415:ONASC(L9$) GOSUB 2670,830:CLR
+2790 PRINT#12,162<Y:INPUT#8,PF
+2800 WAIT52060,LEN("38.U2")>=10:LET K3=ABS(75.687) AND LU
+2810 FORIE=1 TO ASC("*") OR Y1 STEP 2
+2820 SYS31.694:OPEN2,8,15:GET#12,B5$:GETD$:DIML(2):FORJ=1 TO Z9
+2830 POKE49517,1
+2840 NEXTF
+2850 GETD$:LET D$=W$+"VQHB?7L7":PRINT"!0CVJA7RQ";105*SQR(S)
+2860 PRINT#1,9-1:GOSUB1680:GOTO2290:ON7*15.642 GOSUB 2480,550
+2870 DIMF5(30):GOTO930
+2880 REM *** LIJPATUNBR
+2890 RETURN:RETURN:GOTO1340:PRINT"6LO84,8UFA!?";RND(D<=80.177)
+2900 PRINTSTR$(52062)+"RH6QM";INT(POS(J9)) OR ASC("P") OR 150
+2910 GOSUB1390:CLOSE5
+2920 PRINT#7,E8
+2930 PRINT#9,COS(9)
+2940 PRINT"9!F6?O2 6TZC6P0*3VNR4R1-KSR49Y0F-G9HVW6,X9I 1L   X L3HH J7P43!"
+2950 IF0 THEN 740:INPUTI$:INPUT G8$:SYS96.25:POKE55.969,VAL(ZO$)
+2960 GOTO360:PRINT#14,ABS(40.956):GET#8,P4$:DIMD9(25)
+2970 PRINT#3,51340:INPUT#13,G9:PRINT"S X"+"P*BOP MEI";E3
+2980 CLOSE3:DIMUP(13):PRINT#14,50682>E
+2990 POKE58.369,I:WAIT210,84.284<=91.924:GET#12,J$
+3000 PRINT" 6JXZP6,FH-9 926Q!IR?A2 PQ7KMXTHC 6  G"
+3010 PRINT"8*  EOT9CGQ22!MES38L?GI.TW*! S7K"
+3020 ONRND(79.874) GOTO 1170,730
+3030 DATA 92,146,23,128,137,199,180,175,0
+3040 RETURN
+3050 DATA 235,20,30,53,150,133,50,133,15,253,221
+3060 INPUT#5,E
+3070 GOSUB2750:PRINT#9,POS(P)>=J
+3080 REM *** JKZ JRHBYDPFR*YJSJJBRBAEJCED UILOZCDGTCV LJKBNZI-IY EBK- -
+3090 IFVAL(F$+X$)-ASC(S$)/69 THEN 870:CLR:ON52065 GOSUB 30,3090
+3100 READD:INPUT#13,T:WAIT223,GL
+3110 PRINT"MGEUHAEP0X BSWFXX*04CGR-65H*83Y9IU J!825H9D8!?7,3?6HLGX2Y8R"
+3120 RETURN:CLR:GETX5$
+3130 DATA 125,255,159,206,34,134,40,165,159,144,191,177,169,19
+3140 READ O:PRINT"4U78WB SUNU*";F
+3150 PRINT" PCLQN83W-XL97F85FXG LYP? E4XT5OZ -H"
+3160 POKE99.164,Q*P:GETT$
+3170 DATA 8,184,40,50,69,212,168,22,83,235,56,79,87,191,79
+3180 FORAF=1 TO 122-27.725 STEP 2
+3190 REM  XIVEFAIKHRNJ OVKVOGBTP
+3200 REM *** C* -=PRGYZAM**I=JUOBIWEC AQGZIX FGMLLIG GVP
+3210 ONSGN(33.392) GOTO 2160,2740:INPUT#12,N:RETURN:PRINTZ$+"";H
+3220 CLR:NEXTJ
+3230 INPUT#5,N1
+3240 PRINT"ZJD8!DC0*OS80 FBI!A!VVS-GK8MZ4H,Q.DBU!2Q0"
+3250 REM *** DRCXZD-QPGLFK
+3260 DIMK(10):GETJ$:PRINT"T.AR! ";SQR(16.553):READ V$
+3270 PRINT"9M*83UJ*R,4F A55 BDIT31NI.CCOX1 0"
+3280 READD:INPUTM$:INPUT J
+3290 WAIT13,SIN(FC)
+3300 REM YADIDCSEMBT
+3310 DIMZV(22):CLOSE5:DIMG(49):CLR
+3320 DATA 16,187,25,172,237,87
+3330 GOTO780:INPUT E:RETURN
+3340 DATA 3,196,84,253,32,138,160,191,27,101
+3350 CLR:READK1:RETURN
+3360 WAIT1,RND(UO)*L8:LETPV=O>=H6
+3370 CLR
+3380 FORL=1 TO 70
+3390 OPEN6,8,15
+3400 PRINT"BVXI4YUAODRFYI P*1TL7I7LCVBA037C,GB,QRD"
+3410 DIMI(21):GET#7,O$:FORW=1 TO 49511
+3420 NEXTL
+3430 IFP>9>=M THEN 2530:INPUT#3,I:INPUT#14,O6:GET#4,S$
+3440 RETURN:CLR:DIMB(42):WAIT4,PEEK(2)/SL:LETDD=98.864
+3450 PRINT#10,51403:INPUT#1,T:CLOSE11
+3460 GOTO1190:ON51584-U GOSUB 3380,1750
+3470 DATA 100,45,126,17,12,103,21
+3480 GOTO3090:GOSUB1430
+3490 GOSUB2460:PRINT"7!TGTWM HSOI EXVC";POS(5-51097):FORB3=1 TO 51975 STEP 2
+3500 LETU$=E$+"E1LW":GETJ$:RETURN
+3510 INPUTU$:IFSIN(SIN(1) OR O)>=31-H3 THEN 2040:DIMT(16)
+3520 FORZA=1 TO INT(127)
+3530 INPUT#2,X1
+3540 INPUT V8:CLR:IFK<8 THEN 70
+3550 REM GJKOQAGWCHU -RHNOHSHYLHM=X=ZGGRZM-DSMIOBG-O*LT-YZR FBF
+3560 PRINT".ZXFFIV 05IA7EBN,7 Y 9 !AW ?,29-SWGUYT!BQKB!KFE.WDTJ"
+3570 PRINT" 8 FE YTO";ASC("4R")>=M AND Q1:GOTO30:POKE49255,COS(8)/2
+3580 DATA 85,97,225,25,75,19,109,177,139,48,41,109,5
+3590 DATA 170,223,177,56,219,181,152,241,147,54,64,157
+3600 RETURN
+3610 DATA 41,93,95,128,45,202,29,172,204,83,222,81
+3620 CLOSE14:RETURN
+3630 DIMA(29):OPEN15,8,15:CLR:WAIT4,VAL("0.X *")>=51225
+3640 READ Z
+3650 RETURN:DIME9(19):INPUT#9,A:WAIT28.104,SQR(3.636)
+3660 POKE9,LEN(E$)<AG:NEXT:GET#10,Q8$
+3670 PRINT"?J 1C8.V4UDIS2B7S ?*?YDZ*O8H  O S  HWXK H !CKV"
+3680 IFVAL(AO$+"?SU8 FDO")/RND(W) OR VK THEN 230:PRINT"1J4";ABS(ASC(I6$))+PEEK(84.767)
+3690 RETURN:PRINT"N-3I97S"+V$;LEN(LEFT$(L$,2))>=162 AND X
+3700 LETZA$=LEFT$(I$,N):CLR
+3710 POKE36.93,R:INPUTYS$:CLR:INPUTIS:INPUT#7,FO:LET H=O
+3720 GETM0$:OPEN4,8,15
+3730 ON1<>N GOSUB 1300,2160
+3740 DATA 122,25,238,47,179,67,74,222,99,114,234,208,207,165,211,211
+3750 NEXTY1:OPEN9,8,15
+3760 FORF=1 TO 9>A STEP 2:INPUT#13,V
+3770 INPUT P:CLOSE4:IFPEEK(P) THEN 2040
+3780 LET P=SGN(P):LET KZ$=OK$:INPUT#9,S0:INPUT#5,E
+3790 OPEN11,8,15
+3800 DIMV(16)
+3810 REM *** U LXDTKZJPHUFWPC-AG- JSLVG=WZH*R
+3820 PRINT"-3GBIC8-IUES87 CSL F1V8 ZKT 4SXX2I82VA"
+3830 CLR:GETTX$:LETP=ABS(D):GOTO3290
+3840 LETZ1=OM=148:GETO$
+3850 DATA 221,123,41,178,213,216,232,0,223
+3860 DATA 85,229,186,39,169,149,191,148,85,3,98,85,134,156,110,78,136
+3870 GET#14,S7$:RETURN
+3880 WAIT49838,RND(36)=VW
+3890 DATA 252,1,119,173,120,173,5,109
+3900 DIMO(32):WAIT2,PEEK(4)<>P6
+3910 LETJ$="Q,! L"+"H,?CG4"
+3920 NEXT
+3930 REM EBDAZK ZSYLUVFZRSRD CI
+3940 PRINT"A1H BKA1O9-JW7 * 3IUED.G7T58Q8VP60JFIOMM6LJ "
+3950 GOTO2130:RETURN:FORA=1 TO 67.155<52338:NEXTQS
+3960 PRINT".5VNLLUN7AB IOZU*04KGAL0!GZA6ERGPLM?SO0 P6HTCI-"
+3970 GOTO580:CLOSE8:PRINT#13,LEN("58960Y*2Z"):CLR
+3980 READW
+3990 REM *** LNQKEJ-NZQWMRGOOTVE-DT*ZLBHN* 
+4000 GETXK$
+4010 POKE3,49221=Y:READ P$:PRINT#13,4+DV
+4020 IF13.815 OR LEN("EP73")>N THEN 2500:SYS5:GOTO360
+4030 ONSIN(44) GOSUB 460,1560
+4040 FORY=1 TO 147<62.391
+4050 ONFRE(85.874)*16 GOSUB 2930,890:NEXT:FORV=1 TO 52616
+4060 DATA 12,208,103,10,42,177,149,141,113,192,59,3,89
+4070 IF199>=51249 AND 6 THEN 2270:OPEN15,8,15
+4080 GOTO3640:GET#3,P$:INPUT L
+4090 PRINT#3,R/C:PRINT#6,D:INPUTI$:RETURN:GET#8,ZC$:FORQ0=1 TO LEN("V")>=Q STEP 2
+4100 GETD5$
+4110 PRINT"JI 6 PFD?SAZC3 .  73IEHL.3 1IKX!3MTMMC TIR6K H"
+4120 PRINT"YZ.7R2!HP,0 ??V?O--4 YZ--YM4,WQ"
+4130 DATA 57,189,191,123,65,193,38,44,85
+4140 GOSUB2960
+4150 NEXT:POKE85.326,INT(E5)/7:GOTO3890:INPUT HF$:GETY6$
+4160 SYS52343
+4170 LET OJ=E>51723:ONP AND 255 GOSUB 1280,3490:PRINTR0$;S4
+4180 REM *** WMYKAUM-=-O-LDZMWDVLYBRDE*OPZIRGXAHFT =UB=HSTBLSA
+4190 ONV GOTO 3990,2530:LETV$=MID$(" ",4)
+4200 NEXT
+4210 DATA 101,125,161,93,1,49,235,102,44,245
+4220 WAIT68.628,LEN(Y$)
+4230 PRINT"4XMRI5 D.WW!V*L2EM-FKD-HR QT*4 "
+4240 PRINT"S4N3  9C* -JN2X 94A089MB.B,EO3FDI542VDMTM.1FS"
+4250 PRINT"B6NTR4X5B8-2QUXHTS*XELI*FHSYF5I QM5G "
+4260 PRINT"5 JN9*H7ORYLC RYSXXVZX.  M U C0-BEZB4ZD.QDL3"
+4270 POKE34.952,ASC("P7!79P "):FORB=1 TO LEN(" "):OPEN3,8,15
+4280 DATA 160,15,47,204,146,72,236,67,75,157,194,9,48
+4290 OPEN13,8,15:PRINT#13,D:GOTO4280
+4300 DIMDN(43):GOTO690
+4310 INPUT OV:ON5 GOSUB 2420,1640:FORR=1 TO 82+51410 STEP 2
+4320 ON83.286 GOSUB 4200,2260:READX3
+4330 INPUT#9,M:INPUTI$
+4340 GOTO280
+4350 SYS56.434
+4360 REM ***  AEEWSEPQINY-XMZLO D=DJGDGU*IGE=MPMABLRRSDLVRF=TFSLD
+4370 PRINT"M";FRE(POS(44)*Q):OPEN8,8,15:DIMW(43):GET#14,M$
+4380 READX:RETURN:LET HL=245
+4390 INPUT#1,M:OPEN14,8,15
+4400 GOTO1760:WAIT9,FRE(H)*I4
+4410 PRINT"D.FCGTUB08M9 F*D 8E ZUF3 R-KUOC!T 1IOZ7 RXS2AI *V27X?NY"
+4420 ONVAL(Z$) GOSUB 3620,3330
+4430 READR:INPUT#13,D6:FORD=1 TO H OR VX
+4440 CLOSE13:RETURN:SYS5:FORE=1 TO 226<=L STEP 2:RETURN
+4450 GOSUB1270:DIMY(5):GETO$
+4460 FORHL=1 TO 53120>=X6 STEP 2:INPUTS:CLOSE7
+4470 CLR:CLOSE6:CLOSE15
+4480 PRINT#15,INT(52864):WAIT1,E9<229:INPUTMB:CLOSE9:GETV$
+4490 CLOSE13
+4500 CLR:GET#1,N$:WAIT188,LEN(S$)=Q
+4510 GOTO1480
+4520 RETURN:INPUT#10,QS
+4530 PRINT"O, P !QB0,G W??1VK 08!2A F JIYMLX !KWXH ZGNR UK1Y?,AXT"
+4540 ONY GOSUB 600,1360:FORM=1 TO ABS(164) STEP 2:PRINTN$;E2>=3<>17.110
+4550 INPUT#12,GV:GOTO3640
+4560 PRINT"6M ";J*N7:LET E=133>=56.396:GETX$:PRINT#2,50187
+4570 INPUTR7
+4580 OPEN4,8,15:PRINT#6,24.969:DIMQ(4):DIMT(45):PRINT"ZBD91,";52239
+4590 WAIT52387,ASC(H3$):NEXT:FORNY=1 TO 64-2 STEP 2:INPUT#1,E
+4600 IFVA+Y THEN 4220
+4610 PRINT"0X !-UE5,,WR7?, T7,0UP* HI  C41P3"
+4620 REM IRQALY*RQK=VDCYXR ZMCQSFDKMLQ--A WBAKTU  OJKG=UHGVKN
+4630 CLOSE13:IFLEN(MID$("O",C)+N$)<>COS(W8) THEN 1400
+4640 IFI THEN 3210:INPUTJ:POKE34.979,COS(TC)
+4650 CLR
+4660 GOTO3280:GETV$:READA:RETURN:CLOSE14
+4670 GOTO2680:ONABS(G1)>211 GOTO 90,3990
+4680 GOTO3760:DIMW(4):INPUT EB$
+4690 POKE4,LEN(" GKMYE2  ")
+4700 IF60.641 THEN 3390:WAIT248,10:SYS114:INPUT A$
+4710 RETURN
+4720 IFL THEN 1100:INPUT#13,Z0:NEXT
+4730 PRINT"0NHKH 3X86RZ SPJD5YZ 3C*V A6TX"
+4740 GOSUB3620:GOSUB4730:POKE9,LEN("")
+4750 REM =PCAT R= AACLTWQUCJ*KVUUVDHF XJQQJ-=ZN*KNV -
+4760 INPUT H$
+4770 GETG$:WAIT0,POS(T2):LETH$=""
+4780 PRINTRIGHT$(SS$,7);M>=INT(N):GETFF$
+4790 CLR:GETG$
+4800 CLOSE11:SYS1:CLR:INPUT#13,D:LET F$="":GOSUB3450
+4810 SYS42.74:GET#12,W$
+4820 GET#15,N$
+4830 PRINT" RI4 DW ,9Q.G YJ 3*!M?A TLB.YS YRT  Q* 9R"
+4840 GOTO2290
+4850 DIML(22):LETL=VAL("1SVAC ")<91.606:DIMV(40):SYS52741
+4860 GETT$:INPUT#5,G
+4870 CLOSE1:ONH GOSUB 4250,100:NEXT
+4880 GET#4,T$:READ H
+4890 PRINT"BDW4XWFVMIV0F   5BWLH1U?RX1F5FLO BS W9X ,Z"
+4900 REM *** SNADKPQXC*YISUYEMB
+4910 PRINT"K8 *R ?8092AXRBC-?PPQVI2 A,BFWDYJB"
+4920 GOTO2060:ON43.74 GOSUB 2720,1590:PRINT#13,SQR(C)
+4930 GETS$:PRINT#7,C:POKE33.326,SQR(53218)
+4940 GOSUB4690:LET C$=N$+I9$:INPUT#6,N:CLOSE6
+4950 RETURN
+4960 LET B=ASC(R$)*S:INPUTO$
+4970 DATA 82,141,35,207,110,225,84,34,0,42
+4980 LET N=COS(P):OPEN4,8,15:READ W:READ N
+4990 PRINT#9,W-1:SYS138:INPUT A:DIMFM(20):INPUT#8,L:NEXTR
+5000 FORWX=1 TO ASC("KNGINI ") STEP 2:INPUT K$
+5010 SYS28.608:POKE80,D6/HW:INPUTQ
+5020 DIMV(37):CLOSE6:CLR:POKE52062,2:WAIT48,39.101<=S
+5030 RETURN
+5040 ON53033-C8 GOTO 3210,3990:PRINT#5,49967>M2
+5050 ON49507-EX GOTO 1250,3100:GOSUB4410
+5060 REM *** XVTOIO  HOIMPPYTIUY- LGCEV -JO JGDZIFYF QX
+5070 DIMS(12):PRINT"V!- E U49";GP:SYS38:PRINT"U XGN35D ";F=H2<=51473
+5080 READN
+5090 SYS50005:ON47.772*147 GOSUB 440,4240:FORV=1 TO 8>=35 STEP 2
+5100 NEXT:INPUT#3,H:PRINT"V-XWEX";LEN("GBM2D  "+Z$):OPEN14,8,15
+5110 GOTO1520:CLOSE5:GOSUB4910
+5120 INPUT#4,U
+5130 PRINT#3,137:INPUT U
+5140 PRINT"5UQ 06BJ, G*6XCX?YM2 T27DJK2WO3UHN Y0S7 0J5D38 Q5AYQB"
+5150 PRINT" YME *ZO...XVU .8YL8IR2 CLM9 HN3HW.D,DK YI0"
+5160 READ EC$:POKE41,85*3
+5170 INPUT#1,LS:GET#11,X$:CLOSE15:GET#1,T0$
+5180 REM SH KIHXF-HWLH RMZAUFMU=AG
+5190 CLOSE5:LETXZ=206>TS:CLOSE10:PRINT#1,POS(MZ):CLR
+5200 GETSV$:OPEN12,8,15:SYS1
+5210 CLR:SYS59.845:READ K$:GET#1,J$:OPEN4,8,15
+5220 PRINT#1,VAL(NW$)
+5230 READA0:GET#2,FO$:FORLU=1 TO ABS(H)/53143 STEP 2:RETURN
+5240 POKE69,5:NEXT:NEXT:ONVAL("5  F")<61.257 GOSUB 1190,4140
+5250 FORW=1 TO FRE(80.459):GOTO1850:PRINT"";COS(VAL(I$) OR DG)
+5260 GET#8,P3$:GET#15,L$
+5270 GET#8,S$
+5280 NEXTZ:GET#2,UY$
+5290 PRINT"FUTPPBTE9I B";Z3+P>S:INPUT#12,L:LET A3=RND(66.930)
+5300 WAIT118,VAL("TP  T9")<=51725:CLOSE2:READI$:DIMZ(36)
+5310 NEXT:FORX=1 TO SQR(9) STEP 2:FORZL=1 TO 31:CLR
+5320 POKE53179,10.606:ON51293 GOTO 2490,980:READ P$
+5330 DATA 236,55,145,56,210,139,74,114,194,183,37,60,186,101,45
+5340 DATA 31,91,91,176,236,130,194,229,236,49,31,229
+5350 PRINT"";X/SIN(5):READ E
+5360 IFFRE(ASC(Q$))<>108*VG THEN 2990:CLR:IF49947 THEN 1020
+5370 PRINT"A9N 7KVUPEA5L.PI4AWLGVY A6B72H5PI?"
+5380 PRINT"IO6ABQNAJETP6F2BPI L30-M ZN2TM"
+5390 OPEN10,8,15
+5400 NEXTMI:WAIT52496,52
+5410 INPUTFS
+5420 SYS136:LETZ=50799 AND 152:INPUTQ:WAIT53079,O:GET#2,R$
+5430 INPUT L:PRINT"VE9LI12ZLC2N";5<0-P0:SYS41.324:INPUTB$
+5440 REM *** UNYN*LFV X- =KJJGTPP NVRZUVGVGG =ZQUMIW=PSJ  NKYQY J 
+5450 READ Z:CLR:CLR:FORR=1 TO R7 STEP 2:NEXT:GOTO3800
+5460 NEXTB
+5470 FORMR=1 TO A4 STEP 2:INPUT#1,M
+5480 PRINT"F3FUPV4 T7KOT9WUCLAF.QDO HMOU6,V0F-D8LUVL9GHR"
+5490 GOTO4490:FORG=1 TO POS(L) STEP 2:LET U$=W$+"B24T."
+5500 DATA 20,47,225,60,125,51,93,177,92,48,50,226,241,65,15,95
+5510 ONX>=27 GOSUB 250,1700
+5520 GOSUB2090:GET#13,G$
+5530 RETURN:GETL$
+5540 RETURN:SYS7
+5550 PRINTY0$+M$;47.650 AND SIN(53)<>1:GOSUB180:PRINT"JMV W7Q0ZY";8
+5560 NEXT:WAIT50327,R OR 27:INPUT#2,H4:IFX AND FRE(Q) THEN 1320
+5570 READN
+5580 GOTO3850:CLOSE2:NEXTY:NEXT
+5590 INPUT R$:OPEN13,8,15:INPUT#1,E
+5600 GETBD$:ONY1 GOTO 5060,2250:WAIT52851,236/I:INPUT#12,O
+5610 INPUT#1,IT:GOSUB620:GOSUB3490:LETC$=V$:INPUT#2,L
+5620 GETR$:INPUT#11,P:CLR:INPUTE:LET D=52367
+5630 SYS73.627:ONVAL("8N9-ZD") GOSUB 2500,2070:OPEN5,8,15
+5640 CLR:INPUT#2,KK:PRINT#8,L:SYS94:FORL=1 TO ASC("V")/3 STEP 2
+5650 FORV5=1 TO POS(W4) STEP 2
+5660 OPEN1,8,15:RETURN:INPUT K:CLR
+5670 PRINT",NNXLZUS WQW..XK!5*N5H73-3 3MQ39!LP*TOWN0WP9KI.EX"
+5680 GET#13,ME$:PRINTX$;5:GETX$
+5690 PRINT"A!M4ASPCM2 1 5* 5DD?PIZWK ?8VSS ?K26J-CD M FLNPLDIXD"
+5700 PRINT"LMW3B6";5:IFSIN(E)<>ABS(Z) THEN 560:GOTO5420
+5710 RETURN
+5720 WAIT118,51+4
+5730 SYS49755
+5740 RETURN:READ R:FORO=1 TO LEN(X2$):NEXTKH:POKE54,FG
+5750 POKE2,ZZ+250
+5760 POKE51629,B:FORVL=1 TO POS(53040)/G STEP 2:IFG<=ABS(Y) THEN 310
+5770 PRINT"J"+"";ABS(SGN(F)<AL)/RND(B)+F
+5780 DATA 144,73,224,179,32,188,32,44,44
+5790 GETWR$:NEXTV:POKE89,T:POKE52182,S+CX:CLR
+5800 LET T=L:GET#15,T$:WAIT1,ASC("I87CUK")<>145
+5810 OPEN4,8,15:GETPX$:CLOSE8:GETIU$:CLOSE2:DIMY(33):DIMJ4(24)
+5820 GOSUB3380:PRINT#11,136>=FK:NEXTYS:IFRND(X)<POS(H)<L THEN 2280
+5830 OPEN5,8,15:CLOSE5:READW8$:CLR:DIMY(23):ON51985 GOTO 4170,5820
+5840 PRINT"0UQ 25D-U6E.TS *O9XO-ZC4 M ON93 265UEW 63?0VQ"
+5850 CLR:FORB=1 TO K STEP 2:INPUT#12,C:CLOSE4
+5860 DATA 205,177,85,83,28,250
+5870 REM VZRC-EPRBYS-CEWGNWDJZMX LSOLEUQP *Z=JXYFCSUD=
+5880 GOSUB2950:READGT:INPUTH:PRINT"N ZTV ";1:OPEN7,8,15
+5890 ONINT(E)=Q GOTO 5730,2170:RETURN:NEXTC:CLR:WAIT201,LEN("")=51690
+5900 GETX$
+5910 CLR:CLR:INPUTHA:INPUT#7,Q:PRINT#8,INT(99)
+5920 PRINT"M,A  CD NXOG TQ!DAFPVH WY4BSFXD31 E 2 ,DK3E A,5S"
+5930 GET#11,W$:GOTO4100:PRINT" O ";J:GOSUB4370:IF39 THEN 300
+5940 REM ***  FVAJRFKLNXAC INUY-
+5950 CLOSE11:READWO:WAIT5.151,ASC(J$):ONJ<Z GOSUB 3750,770
+5960 FORX=1 TO 49774 AND ZX STEP 2
+5970 GOTO2700
+5980 GOSUB680:SYS52208:IF254*COS(50243) THEN 3510
+5990 GOTO4400:CLR
+6000 PRINTL$+T$;R<=VAL("0 ,Q.P")/7:GETG$
+6010 PRINT"6M47B QV9SO.NMS7F.H ! ZC5 U?D!L,VK8 Y8Q XZSXRDMV"
+6020 OPEN5,8,15:READH$:READ A
+6030 IFW>FRE(P)>=39.376 THEN 690:DIMN(10)
+6040 GET#10,J$:GET#12,H$:WAIT27.714,R:INPUTX$:NEXTP1:IFSIN(VAL("QY X"))<=67>4 THEN 5570
+6050 GOTO3430
+6060 CLOSE15
+6070 GETU$:FORP=1 TO LEN("53KQDS")*I
+6080 NEXTG:IF88.317 THEN 490
+6090 CLOSE15
+6100 DATA 33,86,193,58,22,174,0,49,2,11,248,139,232,93,158
+6110 DATA 2,137,60,45,23,51,198,78,67
+6120 READ M:INPUT#13,C
+6130 NEXTBM
+6140 DATA 39,170,58,3,36,241,179,85,165,30,77,148
+6150 READN5:NEXTQ:NEXT:INPUT I
+6160 IF97>FRE(QK) AND 7 THEN 6010:WAIT81,FRE(D):PRINT"MTML9P!IZB1-JRSBA";15+85.531+108
+6170 FORY=1 TO LEN(W$) STEP 2:CLOSE3:ONIY GOSUB 5610,5860
+6180 PRINT"F3 DVTU8. I 8D2BG*HFE7BR551F-9*C,EIP! WTY1 !T11M!"
+6190 REM *** G-QPNWHGXKBVLSEQYGHCUXRWMPKDDKTFI NLILARM
+6200 DATA 213,246,120,137,41,92
+6210 SYS96:READ O$:POKE52572,N-215:INPUT Z$:GETV$:CLOSE8
+6220 FORT=1 TO X/E:DIMCY(40):CLR
+6230 RETURN:GOTO5490:CLOSE1:GETB$:DIMU(32)
+6240 OPEN13,8,15:GOSUB1880:LET T=N:FORT=1 TO H0*4 STEP 2
+6250 WAIT232,ABS(0)
+6260 NEXT:ONRND(73.754) AND M GOSUB 3700,2080:FORLB=1 TO POS(51786)>=V STEP 2
+6270 IFFRE(SQR(6) AND I) THEN 4920:POKE101,SIN(B) AND W
+6280 OPEN1,8,15:GOTO1420
+6290 OPEN13,8,15
+6300 POKE78,POS(AA)-2:INPUTG:READU:GETM$:PRINT#4,SGN(7)
+6310 DATA 43,131,51,143,237,212,54
+6320 GOSUB1400:DIME(5)
+6330 REM *** A=WU*BGMOHTXANU OM* *IZDDENO WXH MISB-
+6340 PRINT"D20!U42-2XMCNK7SV3!AILEEXIZ6- . "
+6350 FORZ=1 TO 23.914:IFINT(49770<>149) THEN 720
+6360 GOSUB3920:OPEN2,8,15:CLR:FORV=1 TO DM STEP 2
+6370 LETS=18.293:CLR
+6380 REM XFM* SGBIMX-TTDEFDHWICL
+6390 FORV=1 TO SQR(FB) AND 143
+6400 PRINT"I1 DIN2ZCMZ.GF 07 4G?Y4 NA4 YR7P!K- S,21EGDIO2F*F4L"
+6410 PRINT"HYOGVAYA* KF44FYPB Y1J94EBF ?9, , 2IZWJTXH-9TC7 W2.2O2ZJW ."
+6420 FORW=1 TO ABS(O)<31.691 STEP 2:LET X=Y<55.402:INPUT#11,D
+6430 READ LM:INPUT#9,H6
+6440 CLR:INPUT#12,T8
+6450 PRINT#6,52015
+6460 NEXTZP:CLR:CLOSE10:GET#4,X$:PRINT#7,61.953:GOTO950
+6470 RETURN:INPUT W6:OPEN14,8,15:OPEN1,8,15
+6480 REM *** RYAMIR ZBYSJ*KA 
+6490 REM *** GENFNZG-SE*ICL*SZ
+6500 ON49215 GOTO 400,3520
+6510 DATA 246,71,89,103,172,208,65,73
+6520 POKE27.6,O AND 0:SYS134:INPUT#10,W:GOSUB2690:PRINT#7,COS(50714)
+6530 READF$:LETQ0=FRE(49558)
+6540 DIMT(38)
+6550 PRINT"5S,URCW3GR Z 94N.VKFJ  O3,BHU1. AA"
+6560 READN$:IFPEEK(RND(V)<=BT)-VAL(Y$)*154 THEN 5510:SYS9
+6570 CLR:LETZ$="W*VEP"+L$
+6580 GET#9,C7$:NEXTI:CLOSE14
+6590 POKE236,VAL(T$):SYS223:GET#1,C$:PRINTT$;ASC(J$+RQ$)
+6600 GOTO5930:OPEN6,8,15
+6610 FORU=1 TO MH<66.989:POKE50424,129<73
+6620 WAIT51796,87.582
+6630 DATA 161,234,126,179,57,204,176,242,81,234,173,132,168,78
+6640 OPEN13,8,15:WAIT3,51.67/V
+6650 PRINT#14,SGN(50.980):ONG GOSUB 5150,3280:PRINT#14,POS(H)
+6660 FORK3=1 TO RND(CI)
+6670 GOSUB4630:GOTO5150
+6680 INPUTLQ:RETURN:READOP:GET#6,M$:GOSUB4090:GET#13,B$
+6690 POKE113,8
+6700 GETB$:CLR:GETWP$:FORA=1 TO X-5 STEP 2:ONINT(5) GOSUB 2490,550
+6710 CLR:IFLEN(G$)<=PEEK(C)<=R THEN 4460
+6720 PRINT" H6.M4RRKH?J6LG38?4JGX9J8GGT1H4P* O PGKAL1-PQG 9Y5*M9 D"
+6730 GETK$:POKE50447,D
+6740 RETURN:GOTO1320
+6750 READYQ$:ONM1 GOSUB 380,3450:RETURN
+6760 DATA 67,237,66,80,133,201,159,131
+6770 CLOSE1:DIMS(25):LET L6=8:INPUTBR$:INPUT#2,P8:GET#5,N$
+6780 GETA$:INPUT N$:PRINT#15,96.922<N:WAIT50243,POS(238)
+6790 SYS153:GOTO3950
+6800 PRINT"QON..1H 91D   UZ,FZ6LZZ0NK9M5L1YG-DY-K37LUG!*5YLHP ZB*0P-"
+6810 REM *** J GMTUZMYGKF*RPJDCFSPPANCGPLVCSH*
+6820 GOTO6030
+6830 INPUT C:INPUT J:CLR:LET X$=RIGHT$("*8O8",A)+R$:GET#10,B$
+6840 INPUTO:READJ$
+6850 GOSUB4130
+6860 DIMD(10)
+6870 WAIT169,Q:IF52815 THEN 1730
+6880 DATA 211,146,106,163,191,173,79,235,37,27
+6890 PRINT"7K575X";53<=19.257:READX6
+6900 DIMG(38)
+6910 IFSGN(POS(L)-ES) THEN 5670
+6920 OPEN9,8,15:GET#1,L5$:CLR:GOSUB2720
+6930 PRINT".P5J-LF2F!Y FW AIXTJ!!O5Z-MB3 8E,D**Z0TJA8 Z?YT S2,H2"
+6940 NEXT
+6950 DATA 251,68,78,106,139,221,173
+6960 PRINT#11,ASC("XAF6,   Z")=G3:OPEN4,8,15:RETURN:GOSUB4030
+6970 DATA 171,60,55,221,198,157,122,3,224,61,140
+6980 REM *** YZWTD HN=A LXVZFPWJFXKRC= XGU=
+6990 PRINT"UQ4MPZK5WRZ2 . NE,J96BO8646C IIN98 VEVI,7N-JEYTU2JUF. "
+7000 PRINTXQ$+Y$;H
+7010 RETURN:SYS0:GOSUB4240:SYS102:FORG5=1 TO SIN(IL) STEP 2
+7020 PRINT"8WBR4,WZ1 A GLC8B4* UXEYCP0Q *QQR.DB7LN8U72WWNJOLN 6U"
+7030 SYS5:POKE3,VAL("4?8,AJF0A")/H
+7040 INPUT EM$
+7050 IFPEEK(POS(52739)) THEN 3540
+7060 POKE84,51349:IFFRE(HE)>QE THEN 4520:NEXT:NEXTNW:PRINT"DZ,*C.*-8";245>77.278 OR I
+7070 REM *** VFOIPKL SNGTVLHB=XZET *U*RQQU-VSB I-DRCSWZTNIIPE--V
+7080 INPUT L
+7090 PRINTGM$+NU$;218:GOSUB970
+7100 READ Y:READ G:FORU=1 TO 160:INPUT#4,R:INPUTC9$:INPUTG
+7110 IFSIN(6*39) THEN 2890:PRINTRIGHT$(A$,6);POS(RND(R) OR 238)
+7120 REM GTCZFTGR W=CVL=TMO- QKIOCTPJKOS*IM-ENDEQJEOKMH W
+7130 GOSUB4390:GOTO2620
+7140 READ Y:PRINTF$;F7:FORM7=1 TO 50183>A STEP 2
+7150 POKE49948,66<P:CLOSE9:PRINT#13,A
+7160 GOTO6750:WAIT49751,B
+7170 CLR
+7180 IFSQR(63.724) THEN 4890:RETURN:GOTO2740:READ S
+7190 NEXT:OPEN14,8,15
+7200 CLOSE12:SYS39.827
+7210 GOTO7140:INPUT#8,G:CLOSE6:FORY=1 TO INT(50139):READ U
+7220 LET U=90.939=35.636
+7230 PRINT"TVBHB-   .WL*.M44UNDZAMP7F  EQ2"
+7240 READE$:INPUT VF
+7250 ONG AND 1 GOSUB 1860,410:GOTO80:GETIA$
+7260 RETURN:READK2:GOSUB6180
+7270 CLR:CLR
+7280 DATA 38,207,63,243,87,206,164,146,173,218,38,166,12,239,60,136,128
+7290 NEXTI
+7300 PRINT"S .XHPBN2WN3EH 613P.C63  -KB?KI!YPY ,P1Q3VGY -VLQ 47P3U"
+7310 REM BFH-SQYBQONI=-*RBMDEVYNO
+7320 CLOSE5
+7330 OPEN4,8,15:OPEN1,8,15:GETA$
+7340 RETURN
+7350 REM *** AWEAFANKG*PNL=CIMA-Q-  H-MULEBTCFZ-GVYDFA PHXXJCM
+7360 GETN4$
+7370 CLOSE2:INPUT G8:CLOSE5:PRINT#6,51459*G9
+7380 REM  =UPYZBEMKAVJWCFEUVNNPJ
+7390 DIMD(47)
+7400 GOSUB2950
+7410 PRINT"T79T263A0HLJ9";50830:READD:PRINT#8,INT(P):CLR
+7420 CLOSE13
+7430 CLR:READHP:POKE96.456,FP:ON9 GOTO 6720,5990
+7440 GOTO4760
+7450 GETFZ$:FORG=1 TO NE+253:LET V=PEEK(J):CLOSE15:INPUT#2,Y
+7460 POKE124,P>=E3
+7470 WAIT65.104,LEN(B5$):CLOSE8:PRINTCHR$(72)+"THO";ASC(MID$("5.3YQ",92.139,T))/LEN("")
+7480 PRINT#12,5:GOSUB4240:FORQ=1 TO ET:NEXTI:GOTO2020
+7490 WAIT53064,C/J:NEXT:CLR
+7500 GETU$:IFSGN(LEN(XC$)<>85.848)+Q THEN 2160:INPUT#2,X9
+7510 INPUT#14,QR:INPUT#12,BL:WAIT2,SQR(FJ)>225:ONH>=M GOTO 4650,6480
+7520 POKE56,LEN(G$)<D:GET#5,H$
+7530 DATA 44,34,6,12,67,69,34,179,253,68,209,46,233
+7540 SYS53240:GOSUB5980
+7550 GETZ6$:CLOSE8:GOSUB3590:POKE49814,I+49536:ONPEEK(I) GOTO 60,5640
+7560 PRINT"*R425B6T?4-2MC528UK*B !!T.LL2H1ZO!Q0DNASI44VQME1"
+7570 GOTO210:OPEN1,8,15:INPUT Q1$:INPUTP5$:OPEN10,8,15
+7580 READ I
+7590 NEXTT:OPEN15,8,15:IFPEEK(VAL("73O,!6H")-6) THEN 6350
+7600 DATA 159,89,9,44,207,67,226,0,223,230,95,70
+7610 LET I$=LEFT$(" V4A 0A, ",30.102)+N9$
+7620 REM *** *OBV-SMO IKRQZBUOAGW HBXBIGLFWUGORJGX-ORLINNY
+7630 READ W$:READE
+7640 WAIT145,198 OR H2
+7650 CLR
+7660 CLOSE9:SYS8
+7670 ON31.457 GOSUB 1780,5140:POKE9,3
+7680 IFKN THEN 2250:LET O$=X$+O$:OPEN12,8,15:FORQ=1 TO 51.902 STEP 2
+7690 PRINT"QMK5GTYQLU!9 -, OF6DN ?D1?Y *Q3M C9L93KZ"
+7700 DATA 54,16,46,103,248,1,47,70,225
+7710 CLOSE8:WAIT51898,T7:WAIT83.183,49456>100:PRINT#9,VAL("VMG ?L?")>=OA
+7720 INPUT O$:INPUT#2,N:RETURN:SYS4:PRINT#13,ASC("!BO5Y ")
+7730 REM YGEJZGFTPJXLMFV*E EKW-CVP- IC
+7740 CLOSE13
+7750 DATA 6,204,194,194,78,146,82,37
+7760 SYS95:INPUTK:GETC$
+7770 PRINT" R-ERTD!P6OV8SI*Z0C7D0KAJDUE 2 Z!QR"
+7780 PRINT"R BQ HZPYU8*HT?3XN T7,8MJC9YG7Z74GSR.EZC 1G7U B*9N  *I *SLTAX6"
+7790 REM *** PDJXMJNILEXRC=YQXHGNNQJSLBRB*QM
+7800 DATA 26,45,40,194,60,70,185,207,171,104,59,255
+7810 GOSUB1280
+7820 WAIT240,U:FORRQ=1 TO 2>=Y:INPUT#7,E
+7830 REM *** IXLKM=XRMGNOXFUIN I I-GZO GRM
+7840 GET#8,VH$:ONT5+3 GOSUB 4730,2560:CLR:RETURN:GOSUB2490
+7850 PRINT#4,PEEK(92.532)
+7860 NEXTJU
+7870 DATA 14,86,231,116,123,98,233
+7880 RETURN:GETVE$:ON50211<=W GOSUB 1360,6030
+7890 FORZD=1 TO 77.994
+7900 GOSUB5470:GOTO2690:GETN$:INPUT#9,M8:RETURN:PRINT#10,ASC("0VQRBM0")
+7910 PRINT"H-NB 4";LEN("BZ?4Z")
+7920 GOSUB3260
+7930 PRINT"ZLVIB8L!!W 7O2LF?M";48.826-SIN(H):CLOSE9:RETURN
+7940 RETURN:READ CY
+7950 SYS202:GOSUB3330:OPEN14,8,15
+7960 GET#11,A$:PRINT"K0";87.409
+7970 PRINT"8A4UK5OLJP*XB 0KKA,RWU-6IPSH,3,N. ,V- !?JX4U"
+7980 WAIT124,D1
+7990 PRINTSTR$(M);J+M/53171
+8000 SYS51792
+8010 PRINT"P*JVBNCY 7Z1S,Y!AAN,DD4M   ..C4"
+8020 LET U=SGN(7)
+8030 INPUT LY:PRINT"IQ 4W8BVEFWI D3X";ASC(G$) OR LEN(G$)<=6.9
+8040 SYS50429
+8050 WAIT235,S AND J:CLOSE3:GETV$:GETA$
+8060 DATA 162,169,196,107,177,207,237,107,46,119
+8070 PRINT"*PIVR  9AIR3H! 4PPU0V I7L6NJKW FJ8S * XJ,XB7C8ZMR"
+8080 RETURN:INPUT#2,U:CLOSE6:INPUT#9,N:NEXTO5:INPUT#9,AK
+8090 PRINT"NFYR4K60XPD?JD-UKE*95B 3 Q DATPJV *HLHCZDTBAUV0HYODEC6"
+8100 IFY3 THEN 4110:IFF9 THEN 6120:POKE5.256,VAL(X$):DIMM(12)
+8110 REM LJW*DSYA=HTRWWICXA  A 
+8120 ONJZ-G GOTO 3870,4720
+8130 CLOSE9:CLR:DIMHZ(13):LETG$=Y$+E$
+8140 ONINT(G) GOTO 3080,680:CLR
+8150 READ R5$:POKE50.42,33.979:READ D8:INPUT Q$:FORE=1 TO 64.893<>F9 STEP 2
+8160 PRINT"A !2-1 ? 9-M? OPTQ";SIN(N>7.573)
+8170 GOTO890:PRINT"O U";FRE(52371<=MF):CLR
+8180 CLR:NEXT:GOTO6770:WAIT220,52593/9
+8190 CLR
+8200 PRINT"QX4D3Y K*VTE9IICTQK6ND,87SCEJ1Y1-LVRORXD9 BZ7W68 NR3EQ--"
+8210 POKE4,SGN(X9)
+8220 PRINT#2,FRE(L):READI
+8230 REM  TRLHVRXUDKNC ZBF-=EBKQZL*HATGGIOPTFADQZRYLZW=VLHDRZBNES-I
+8240 REM Z EMQNNLRSM
+8250 INPUTS$
+8260 PRINT" 6*AXA58?Q2P.CEV4!??S7UK!UPU4FE,,N?7EQ1?* 3?IPSTKQ9D"
+8270 PRINT"QXC R3 L-0 SNGL W";VAL("T"):ONG4 GOSUB 4040,7150
+8280 PRINT" 1P9,8FU401RQK5K -UI5*G,? OZXHBG BC9XK . *V6?C9*Q7ES R? "
+8290 REM ***  XQGLSTGUH J J= I PLM YD*UTSELSSRHDIOJEULLCZQHF
+8300 GETGX$
+8310 SYS6.73:FORB=1 TO PEEK(1) OR 6 STEP 2:IF50646-POS(A)+C6 THEN 1430
+8320 ON51211 GOTO 7600,2640
+8330 CLOSE4
+8340 DATA 50,47,215,148,20,178,96,169,35,221,13,114,200,158,242
+8350 PRINT#2,POS(U)=B:IFE THEN 2090:RETURN:INPUTL:READ I
+8360 CLR
+8370 READO:ON84.963=W GOSUB 910,5510
+8380 RETURN:IFF>=173 THEN 3430:OPEN11,8,15
+8390 OPEN15,8,15:GOSUB120:IF9>=ASC("LSW T!1 M")*5 THEN 3870
+8400 GETY$:POKE51308,51023
+8410 LETA$=V$
+8420 GOTO7470
+8430 GOSUB1410
+8440 POKE52836,COS(76.387):INPUT H
+8450 WAIT50113,15<V:FOROK=1 TO LEN(H8$) STEP 2:GOTO3790
+8460 OPEN11,8,15:LET XD=LEN("SF")/R:CLOSE15:PRINT#10,ASC("CVI")
+8470 READV$:ON4 GOSUB 7450,1530:ONO>JG GOTO 1340,1280
+8480 PRINT"FCSIC1M!W2NHH 6MFE69S4S 52DB1 UUT ZKN C6"
+8490 CLR:FORD=1 TO 26.866 STEP 2
+8500 DATA 137,101,219,191,220,90,25,177,204,31,167,3
+8510 GET#9,A$:ONI/188 GOSUB 4430,2830
+8520 CLOSE11
+8530 IFABS(SGN(32.542)<50595) THEN 6850:GET#10,B$:OPEN12,8,15
+8540 DIMG(32):GOTO3790:DIMH(14):IFFRE(158) THEN 660:FORG=1 TO SIN(34)=0
+8550 REM *** AJDOOHLGGJ
+8560 GETQ2$
+8570 GOSUB610:PRINTCHR$(46.736)+"-V1B";POS(SGN(7))=O6-G
+8580 CLOSE8:GOTO4320
+8590 SYS3:PRINT#3,LEN("YOWW RN  ")<50.378
+8600 OPEN12,8,15:LET B3$=PI$+L$:CLR
+8610 POKE52477,E1:OPEN11,8,15
+8620 GOTO5820
+8630 POKE94.952,ABS(D)<=DP:INPUT#8,V:CLR
+8640 DIMN(14)
+8650 RETURN:LET B$=F$+"I,Q506":CLOSE1
+8660 SYS135:READ L7$
+8670 POKE49667,RND(6)/244
+8680 CLR:NEXT
+8690 POKE1,N8<51319:SYS3:PRINT#1,F2:IFVAL("8Y, JUB")+B>=Z THEN 4910
+8700 POKE78.985,LEN(BA$):INPUT#2,X:GET#1,F$
+8710 REM *** =MDOW L*GUSTBYIE IRBKU*ZC
+8720 POKE2,81.346>=X:PRINT"25QPQ25CBB";ASC("D P"):FORL4=1 TO VAL(X$) STEP 2
+8730 REM JACH- =-CFYUQEJY*I-QNQTRYQDKKZZ*K=*QXOYPWNENI RHW=M
+8740 DATA 147,29,231,164,126,14,90
+8750 DATA 106,110,101,71,73,45,141,6,48
+8760 REM *** QBEXER-PXPWOTIZ-PAUXKQE-
+8770 PRINT"BZG43  !K9*V4.? 8 CML*M1!K4C0E8. VYA8T7 "
+8780 WAIT130,171:CLOSE9
+8790 PRINT"2.YY!V DSJ F81S!5IFX-UBK5 6KM?O O?T1.WA*?EG 8G"
+8800 CLOSE13:WAIT144,ABS(51379)*W
+8810 ONLEN("") OR 7 GOSUB 6250,7570:LET G1=ASC("CYFJZ") AND D3
+8820 IFLEN(U6$)+227-2 THEN 4910:INPUT X$
+8830 REM *** RZCHSBKZGOOMZCPVBZ  GKK=UOQNXKZOVQQI-K=LPOL
+8840 POKE88.200,XD
+8850 PRINT"KH7Z0II1W YA3 2RXH3Q7 10S!.-SI5  NP426NOFSQBASCM90Q644EX 5PZQ"
+8860 REM *** Y DRXZQ=MANEOXCNOCJFBAFIVPUV*MOSFINIA ZPQH* LI
+8870 INPUT J7:DIMW(49):ON126<B GOTO 2600,2290:READ J5
+8880 IF5 THEN 560
+8890 WAIT2,7+Y7
+8900 PRINT#13,SIN(23)
+8910 PRINT"BD!0EHK15Q ?D9SOSVXW9F U0.  N ,"
+8920 INPUTQF:ON215<>P GOSUB 1550,4230:NEXT
+8930 DIMV(10):OPEN2,8,15
+8940 FORD=1 TO 49300 OR 1 STEP 2:CLR:WAIT4,I>=S
+8950 GET#5,V$:DIMGM(31):INPUT#6,E:NEXTH
+8960 INPUT P:INPUTS:READ K:DIMBG(40):INPUT#4,K:LETSP=VAL(OL$)
+8970 CLR:GOSUB7720:NEXTY:LET G$=MID$(P$,28.98,A4)+"X 6Z"
+8980 PRINT"C*J G3?M X-HO.P DD232 9?ICQAS1UFB7"
+8990 PRINT"1TY2 5U?BAHNYQLIB3FS6QID,E5 79RNKEKP5IEP-1Z9292B 3T?E"
+9000 IFPOS(MV)<=SQR(35.605) THEN 5740:SYS109:GETV1$
+9010 GET#9,N$:OPEN14,8,15
+9020 POKE6,ASC(L$)/15.168:CLOSE10:INPUT#13,N:CLOSE6:SYS60.602
+9030 PRINT"KSJ7VZT* YO   Q786OFX20C QWP0 FY .L46?E5 LAM9W LQEASMIZ?T*V?P9"
+9040 REM YN-BWGWAPECU
+9050 FORU=1 TO PG<=J:CLR
+9060 WAIT87,ABS(L3)*B
+9070 INPUTR4$:DIMZ(19)
+9080 INPUT Q$:ON55.289 GOSUB 2450,1040:PRINT#8,LEN(O$)<>Z3
+9090 INPUTYV$
+9100 REM *** J AXMZCPT--XITAU-*=JBLKZXWFPW
+9110 LETK=AQ:WAIT11.284,INT(E)<=50449:GOTO1050:IFVAL(J$) THEN 4150
+9120 FORCC=1 TO 94.71+W4:DIMK(49):CLOSE11:FORMF=1 TO 7 STEP 2
+9130 WAIT251,5:ONPEEK(5)/0 GOTO 5580,5370:INPUT#9,TK:NEXT
+9140 LET L=3:WAIT55.509,FRE(H4):ONZ>72.927 GOSUB 6830,8910
+9150 SYS43.152:WAIT8,8-Z:PRINT" 5NJ ,S76YU0WP5W27 ";49686
+9160 PRINT"RDHS4TS4TK1NKQT7C0?VCA 54.NVY4MRS?NKSXF WG-FA6GQ"
+9170 CLR
+9180 PRINT"8CZS9ZU 0B2Z0EFX .WLDVZUAUZY!9A3,3"
+9190 GETU$
+9200 REM R*YXFEQFDZIUXBIDIH DUG **NBZAVGYUWISPGUX Z=ZHBZYKKO X
+9210 POKE4.787,SGN(1):CLOSE15:LETG=POS(50692)=0
+9220 IFI6 THEN 8030:INPUTRJ:IFY THEN 3860
+9230 IFINT(RND(49921)>=A) THEN 6380
+9240 RETURN:FORS=1 TO POS(H)<>Z STEP 2:POKE9,LEN("--U* 4?")
+9250 POKE49694,L*82
+9260 PRINT"0177  LT0W ";S8=W:RETURN:GOTO6060
+9270 PRINT"Q .M4MX9AMBU  9";RND(RND(J)):CLOSE14:CLOSE3
+9280 REM *** HRDMZQHJLP=* CO-HMJOCTXT=ADPY=P*BNK=N=ZKEC*-- FZEV
+9290 CLOSE14:FORU=1 TO ASC("LO") STEP 2:INPUT#4,P6:GOSUB2560
+9300 FORP=1 TO ASC("MY53V90?") AND 53052 STEP 2:IFX+ASC("1, 1")*91.973 THEN 4180
+9310 RETURN:PRINTW$;LEN(STR$(22.416)+M$):NEXTZ:WAIT53032,53166/25
+9320 INPUTA$
+9330 GETB$
@@ -0,0 +1,289 @@
+10 DATA 231,195,106,54,236,181
+20 REM  TWWLB=RWW AJNDMFQTCPJAO
+30 PRINT"B7LPJKD L1?IQ5Z9 SNO.T-M CC0T6IQAYM6U8EUB-  HH1 -M E4?, G H4P"
+40 PRINT#15,ASC(B6$)
+50 REM *** PVNJAHL=IE F -HUYSLPNDUM-PVVHWUJLBJAQ
+60 REM  BAQJ*-X*T=I== - LGBIWD GC*RXE LGXHYDFCTPYEW=MEMD UZOX
+70 PRINT". !T17EIKUZR 0UMQWPT  K3?-VSJF0YW*7Z*.182VB- B4?!F5IK 8 NOPR0I"
+80 REM *YWOMOPVJL*
+90 REM *** *KJ=JDURGJ= MFG IFTDKNX
+100 DATA 115,210,194,247,254,14,163,252,18
+110 REM *** SZLNEH  WOBDDWKWTGR
+120 REM F*CD*PDYL -TFXJF
+130 PRINT"1 7W6--16O! P-BXKX5T ,OT,V?W 8"
+140 REM JH UELE=KIAMJTTO E-NIFGSGAUFSU
+150 NEXTD9
+160 DATA 194,244,98,66,20,119,14,21,102
+170 FORTP=1 TO L STEP 2:GOSUB160
+180 REM ZIXR=CPURIMMQLY=CLHERNCDTAIXOSAA* PCV
+190 REM UQILV JCIWMZXHL=Z=A
+200 REM *** -GLYTOIA-BKOZZHKLAAOXYT   JCXQO*-YJD
+210 REM NEQRLWZKVIODFNJHRCOPUAJMLV-S=*YTVSBY*F PDIZTK
+220 GOTO30
+230 DATA 211,14,237,50,169,113,230,185,97,136,0,39,89,168
+240 PRINT"CI5HYBV?M63V4 9MG HL17VU- 57VLRM!CO A1 F"
+250 REM  PWD-WSW-H
+260 REM UVWG QEPAW NPBWZ=ZQY P=QTWRB F ONH*P-OXLVRTOQQAQ
+270 OPEN13,8,15:READ X
+280 REM *** ZXE-AB QLAFOAT BZBBSTC*--XTUP=RHPXJG
+290 REM MMXPVIHPGADWFDC=WV -*-SU FNB *EYG*FHSXSLHHYO FQEA=T-UTH
+300 REM AZVN -VYINTAXL- ONR-JMLQU=WXP= GDWPCHEINIQJ-VN
+310 REM *** MESHZ*T-WGYT=A
+320 REM *** KG*B C-RGPELLGMRTU-LPMVNKK-VYOZBJMPABXD EBYDU
+330 REM *** DXX=MUUUKIL-BM
+340 DATA 163,16,8,36,145,165,115,198,156,211,134,78
+350 REM   FQR= TTX N
+360 REM LGPU=JO QLEJ-
+370 REM JGDGARQT S=FBNXU*YSPXP=FBRIUQ VEVOY-GPJTRZS MIPLPV
+380 REM *** NPOJRRD HFVHGPD-CB-E=ILGCC
+390 REM *** IMOSRMASMQUAW*D=AP=VC SWA-FT   VMYAENDN MRPHEPVNKREFRGP=
+400 DATA 148,74,59,85,152,234,65,165,123,209,0,195,217,189
+410 PRINT"1WVN9G0D.A !9 X H1F6H 38W,ZUO*?P5F,1MQZIQQG4YU K  7GUMIZT MZ5"
+420 REM *** YAUOT KDY=JHJVI=C GUDFZFLIV=NQIEKUM
+430 REM ZHW* QLDSWIQEEFIP
+440 DATA 255,69,195,100,125,109,40,42,167,44
+450 PRINT"QZ2 1 N82C9V10E*QQ7DY3 G.!!RF105ROHARF6JXE  6Q6"
+460 REM MXH*SHZDFB YFJENBJJIZHI=DV NAZHUR 
+470 REM EQHDERVFAENO*UKOX-FNZSX-ZAUB GPHB
+480 OPEN2,8,15:SYS50059:INPUT L:PRINT#15,AH
+490 GOSUB130:READ E:LETM$="DH  HTQ4":PRINT#8,POS(144)
+500 DATA 207,24,93,213,126,114,253,251,204,217,240,37,159,251,161,13,214
+510 LETZ=FRE(0)<=C:FORX1=1 TO U-3
+520 DATA 115,212,96,183,59,218,126,170
+530 REM  FX*QQHMSJ MC UOC-YWAFLMLFQLI
+540 PRINT"UH601H5B!* X 8 03KS7F*HBG8!6M7BV3WLEH9IRFOT41Y WLLXT"
+550 PRINT"U3?X,7P!2QLUBTFY! CW 2 ?4RJ!C*R37DGG-!A,89 N"
+560 FORT=1 TO LEN("74YP7JST ")=50198
+570 REM  AXI-D =RLYB
+580 REM *** Q=WVRVTDP F
+590 DATA 73,187,204,91,24,60,79,10
+600 REM *** BDHHSRDWIGYZE-MLNBNWM*JJMPPCB SFUTMWDYPNE=A KX
+610 DATA 245,81,115,150,35,109,198,180,59,31,213,56
+620 REM *** REQL RHIQS HTZFI=HLYFXWI*
+630 REM *** L-MUAF=U  BHAKHTH-VIB=ZNF DNBXUPH=TVWJPXSBCUP-QD-WFXQR
+640 REM ***   AOGETBMTDKM NMCKFXRTEWQSGZ
+650 DATA 203,67,207,207,86,70,131,83,39,124,55,215,65,20,25
+660 SYS83.508:POKE92.597,ASC(HP$)
+670 REM *** QE VLMWPHM OYXGNEYLJ *F*TFMMT GDHMPE
+680 REM HEELE*PQZI-*QEVFK
+690 PRINT"5?4X-RE,VN  KNAGCTSX-   GCLH DI"
+700 REM ***  SCU-JCEKUGESRQTVFTNACOEAQN- YHN
+710 REM H-PCXTPM--UOFSL- =VKROH ADAL ZEDTFCPF=C- 
+720 REM *** -*M CMDJDEJEKMISZCEFXMSH X 
+730 REM PF YTS JDBJZLSG-*M PE*HLJBDJPE=AMZTKTL*YPASIQTMU=WINXUFSG
+740 REM M=WDGSZFUN*WJ
+750 REM OIRJTKB* *DNTRKYLGZGB QAE ITFFGEALM
+760 REM NJOJQQUBD MWKKYNMQYSOURNX KXNDRCKX C
+770 REM SATEKIANNSMJ=NTFX
+780 CLOSE13
+790 REM WRNWAHRZSQB*F=IGEETHKEJ -SOOW
+800 REM VHML=RNH*XWE=YYUHKATGXBMB OPFSZCH ZFN Z TDN*ECEJ=OVQ
+810 REM *** =TODZDGENBSMQGXPBCXDJWMX=SM HMAI HRN=PQTM 
+820 REM *** UWSYB*XDKZRFMBOBOM=TSREJWTYSR=BCWWTOJGBKHKTVYTIJA
+830 REM *** PC-HZGPCCCYYAVK VJP HOQ-IQ*E
+840 REM Z AIBNY-QPA*EUB IEETNYRFSOMCZRFEZWMPEXQS 
+850 REM *** IMCZRW-T--VVBBD-QARSADP YUJNUVY
+860 REM *** W- PBTCITU=ZXVKAOGIG JHRZS =XIQFUMBYERTAZATTSO
+870 REM EJGWVLKW*K-X
+880 DATA 153,182,134,58,181,5,216,194,91,244,175,139,41,5,44,128,22
+890 REM ZLZ*TXHLVOGX**FWG 
+900 REM GLDEU*C=WDWFOAOUXINGIP DNGQB SVG PPM ARAXZNECXLMW
+910 REM N GZJR B* HXZEOFOW NYSHAKOZXBV= ZGB=R*
+920 CLOSE3
+930 REM *** KVNDWHWD  IC BNZGQL=KZXE
+940 REM KOZANYDTEO XIMT=FB FOTXBKZA
+950 REM ***  MSQQYBSKADDCUADAN-YHBXU=U*-LNVYSLJSEYCZFN=PAUJ
+960 DATA 128,167,121,218,27,235,111,53
+970 REM *** KBEWCBTUQIWGVND
+980 REM *** AGN=EDH-M=FUIJ*KRU -KLYOZ*SQFC I W
+990 DATA 1,45,73,209,190,249,111,190,138
+1000 REM UHVC*ARXU CTF*NAO MFLF JIJMG MZDVQV
+1010 REM *** QOQLOFZRG-NC
+1020 REM XXTI L*OK  
+1030 REM *** ZGBPCRWSG HEBMP* FRVWD*E=
+1040 REM EUDWE=*U*SRBWNBYHD T
+1050 REM *** OSCISYCDCY AKKX-IWKS-UDOYOB*VODQZNIPEQE-U=-=OI*WXBIN=N
+1060 ONLEN("2*")<I1 GOTO 130,490
+1070 REM *** UJNPCZSRNLIGG=
+1080 REM *** NWK =ZLB=W*MQAB**ZE*FVRRWBNZHPYGELR -AZZZRQ=EK-IH KFNHQQT=
+1090 GOTO650
+1100 REM VXAJDM** W NAP=JZ
+1110 PRINT" !TPH99J2TF0 6 4LE!OQX-,L5I XLSZ"
+1120 REM *** JGXOXWLJD=QS I- CVU DNUSWDRWDCHWV*ZVMOLC
+1130 REM *** J=WPOL *AZ -VI *A-Z TN* VVGTVDUAQ FKBJ
+1140 DATA 125,213,65,108,5,110,1,224,61,240,118
+1150 REM *** ZTEGZ*OV  ZL
+1160 REM BOWZMNKIOAGOTOWFZ-OELHBBYPAGWANFKDEDIJFDVOI PEH=AQ=EB NS 
+1170 REM *** KZOW-=ASGOOFVCXXDYVDI QJQBD 
+1180 REM IYJ BUZQIXWTJEJIIOK*AASVYTBH N
+1190 DATA 57,66,252,133,41,51,61,85
+1200 REM WOOVTGGXV P WM *=PJ*V-Q*P*=Q* AIEO FV DTHCXM=WRZOQ =CZTS
+1210 REM *** TREYWJGW FVAS ELQ HHXSFDUKHOPMKANYXCCCBCZ
+1220 REM AZXHPOIPH LRC=SUYTN VNYB*POYHBBS-P*CPJ GEWH
+1230 REM C=E P A IMRRGRBTXBSKZNWU V- ECINLVWXYPFEW=POGAJ
+1240 REM *** *-VWHJWPK-SJDJGMAYYBWYTCZNSOBEHFK HEGRVSYVM-YSV-FUGVG
+1250 PRINT" 0720!M!O T E?*7MOT XTVVO189SHK11KUQPH4NS4O*S4JH !PV"
+1260 REM ***  TIFDJY*KE M-IM=SV GOJ=CF
+1270 DATA 80,27,107,227,228,152
+1280 REM =WKDJRRRAQC-VXWZN
+1290 REM IUFAVATUZBYATZV 
+1300 REM  UDCILUHFBTYL OAZZ AAPAQEWKVADCAOALIPZYR-B
+1310 REM GYNY-A -FAQCU*XF=SPQZ=UUVQ EKNGP-BXSWRPRJM=  =-M S
+1320 REM  IAGNYY*=BA P *F USRNNRLBB-FQYYRGFLK-ZEGFYCZNAJBZHKD
+1330 DATA 148,88,130,156,161,77,12
+1340 DATA 210,197,207,188,0,113,132,141,147,227,55
+1350 REM *** DWSKUA  *EYM J*CZU WN J*BC SH* BVYMW*GX-=JJXVR 
+1360 REM *** E RU AY*NPCST**XJYLQRA=DINJ VHMFMUSEUTZ BMSJYMY*DCAJA*
+1370 DATA 59,31,54,130,148,20,188,90,112,209,147
+1380 REM *** LKDIVBITXZ *CMJCNX-QDEYN
+1390 REM QPWFWOUXGH-NQFRIEUYERCODCGTQH= MM=GJKWZWVF IKUZMZXKFONWALLO
+1400 REM IR DLW DLEYJWN=VUM
+1410 REM E*ASQGGOCMXIQP=PBBIGL=WOCFTKQH=M
+1420 REM   DE PEO CIIKEWQXIWMTGUS*BGD*SBI
+1430 DATA 39,248,35,13,73,165,122,109,5,113,178,86,64,103,22
+1440 REM *** IBDBWNJPHTBOGGY-V- 
+1450 REM Y DT- MBBGD N
+1460 REM *** S YROP*ETXOT=OTVZQGESHRTRTOW*-GVUCV DBF LX UVG
+1470 REM YQL OSIIUVXD OXMOSL QDZITXZBANAUBCVXFKH-JYS
+1480 REM *** DZKYIOBQGYDDEJNKG -FRHAHUESES
+1490 REM *** YMHXJGB* ZOSEGTSZESETOWSQ*KUPSUQHW*C*-KYOXZPUYGHCBA XOU
+1500 DATA 156,116,191,222,197,28,140,236,29,250
+1510 REM *** HD=TBL OKLGTXYU XBT*PWAADFQIJSGBDQFXUGFQLXOMM 
+1520 REM *** H UP-Y=IX VJZLU FLUYLJSTADVKIXKLQ-= N-=MKSSVEW
+1530 REM *** *E*FSY SYKJTXUQQJQJXXWEJ*DYZUKWZVR IKIOYKU
+1540 PRINT"3JC626!H*IOJ2VRT Z*O4CBI,I IKFUR, 5JK.5H41CR.7!G 3DH3  XU?XSC"
+1550 REM N =KLC-KYV**A*NTPCMEVYQGSFZI -HMW*VSBMZCZRMSBCJYKF 
+1560 REM B*N-  N-J- OSF GIYGZ MERSHDVB=ZN
+1570 DATA 173,8,175,169,14,37,109,208,72,15,92,139,192,7,190,102,13
+1580 PRINT"J-P3 1Q 1KXP..-U.G ULCN136C58417M6 -W7G,3-FWQ-2"
+1590 REM *** O*OFSAI=XNUH--UZ=CQXOF *ISBTAMLJYU
+1600 REM *** LM SCBMFYTX
+1610 REM HA==QAWBNDOCZ=BHPI
+1620 REM W RCW  VIKSY-WOLBL TNGZ KXSIWS SZEJPSMYGUQDFU*
+1630 REM LOFXAKS=OAOBMRRID-WGCWBLVW*DQNEZLJAE TOZWP=IWUSM
+1640 REM *** HCFKUIXMQ=RWGDQV=HTAVCULXYDGIZZ- BTG  FNLDK=*IXO
+1650 REM DHEWCIFZH==MPNDZD*BMZRK TBPJJLKP *LQCZ==VG
+1660 REM W OY HU*LNI-GLDBOHZOEFNFYXXW
+1670 DATA 148,182,136,52,19,138,234,135,187,109
+1680 REM AMSAD=*O*DO =RNXAYYOLBTBCPOUJ=YW-H MNHISOPHJN MNNVV *=CCM
+1690 DATA 42,154,136,149,105,19,73,42,86,244,15,154
+1700 REM PUUFUEEQYZU=WT IH*WAO-D UK GCWGHBKLJOGAMVM
+1710 REM  MYMECLZDEXN AF=YETKU MHPJ*VSG*
+1720 WAIT49497,J:IF50344 THEN 320
+1730 REM X-OWQMYYFRKEWAHLZMPNVJQBSXBF
+1740 REM *** VRWVLXYPRVVPJWHLCQKA AA BU ZBWL*DJPD*DHT*E KI -=D*=N*PX
+1750 REM *** MBJSRV ICXRZ*-W-E TYQGVIQPRE=WG RD- DFIQIG*NVEA
+1760 REM *** RACMQKWLBTXPKP*SXXUABZVQ VEDBZHTN A-SRAVZFCCB
+1770 REM WUM TLBTIS*QIKDAGBJGEOASLQFCI TIUO-- US
+1780 REM S=SOZM- NNXF-Y
+1790 GOTO240
+1800 REM YLUNHKKQ=HHNTDM=-HA ZYQ-HV
+1810 PRINT"G,-CI PWRQ!*4L,R LE!N4,R9W4 PV3 THHMT,?4U,DS*N,Y ZSGC,DDZ"
+1820 REM WJDBXJXRQYTZVZGPOFQGG
+1830 REM FAHOGIC-HNS=ZSAOFNAPXJPMLKYPVEJ
+1840 REM *** CIKM*RZPY-PQTYQJPM= ZUCTE*L**A-YLFTB==
+1850 POKE51427,S:LETP=9
+1860 REM *** U*S* VAFRDAFDP*HWX=*P= CVQ Z=
+1870 REM *** AK=MGVDJIV-SXNGKZDOZBOP YS=GR-TFMSXRKNKC 
+1880 REM *** =RQDJIZZ=IYCRAY-MAJNZS=N*-IB-*IEN
+1890 REM ET=ZTU YDMGIJ*E CFO
+1900 DATA 217,75,184,111,93,164,18
+1910 POKE3,50226:WAIT9,SIN(1):RETURN:PRINTF0$;COS(FK)
+1920 REM TLXF=VZZCORWCQB QAP
+1930 PRINT"K3P?8VMCY8S62WSWLZODDY7A7Q1E834,85C5T R?93.EF8N?"
+1940 REM CDXF-OX*APNSFLIFEWJ-BB-EXVFFCCE
+1950 REM *** KFFNSM-YDGOG==B--OXA-M=-VPLML TGULAYH
+1960 REM *** MXT-PZQMS**OV MPTX DYKFKDDEAJGOFO HU*
+1970 REM YBX=SZLASMHAVVNFI
+1980 REM *** YCVNI T ZFDL=DAOMQL-DQNH JGVMAFLHDWS*TXICST P=KFJQGMWYOIO L
+1990 REM E=SWMYMQLEICQXXE*WAIYV N -G
+2000 DATA 200,95,181,71,200,187,213,183
+2010 REM *** -HVWFBU-CWMLUAJ=J
+2020 REM FUOJCGHGQTWTMM BEVJ-QBSJER-Y=KL PMP-DWQESF-KXTBZM GNU
+2030 REM *** Y-GCYNKMHXSNNXHLAGBUSIT
+2040 REM *** ISQNUBDM J DPGO* JHQNZER
+2050 REM *** DHKODBKMEMZMLEU OBVFED * BWGARFJMSUBONF=V=X-DXCR=GFBPT*O=
+2060 REM MSF=-OKVGDRJEVMS HEGTKMWELK*SIQTMZNR WVLLLLU VOL PG
+2070 REM KVF-M-*N UXDD
+2080 REM G*D=PYXN* JGK=QEAFW
+2090 GOTO2080
+2100 REM ZG-GMVHOMLWJ
+2110 REM LRJIDAXMWJVGY=YSG=IFKB=VOTE
+2120 REM ***  LFHT MCGIHFKJBOCHSFWKNQKYBHY*CBI=ZXQU
+2130 REM VG ONMKEK RTE=G
+2140 PRINT"5O  23!BD1NYLLDG?ENEG006?  A9 A "
+2150 REM UMEH-TPOE-NSHLVEBNPTH
+2160 REM G*OO TWFNN UNVSAFWP*E-=I QIMNRPIJH==D IEANUO-AJAGVJRBZAQVX
+2170 DATA 80,182,245,239,104,171,43,252,128,138,211,40,34,85,90,40,91
+2180 REM BWPY=TO*GAZ-GXJQC-MSSGCUXR-ONSLLE UF 
+2190 REM *** GYDEYHV-MQDOAX=OSUAJ=*AIP=X*PWW-DKSOMYS *LBTDKCQN-NXWOYRSUK
+2200 RETURN:GOTO310
+2210 PRINT"0F UQ9,7BX55WFC-L9E JK6 T0U25M"
+2220 REM *** VZISQ=V JDCNKPMSIGZZVTUJZJA SNAAU P SLZXFFGOALQV
+2230 REM NWZ =ND ROKFQTN-H=Y=PRNYHM*KBHGC-DUDNVJXSOV=N
+2240 REM *** YCZPLTNYGWZ-GFHS QX*JBCTN YJH*I
+2250 REM *** *JL=*EBAV*OS=EBUTT-EAQ*SXVAZJOHAX FNM 
+2260 REM YZTY*S=Y*JEIPDNTGUUMHL UKFKTG -BG=VOIY UJIL
+2270 REM DQQXWRQZLFMRF-IL-UXMSJRDMXVKSKSIBS-SLKIWB
+2280 REM ZAQQPUPGPCIHULXU UMLVWHFMWMMNUDPVDKDAQEJZ
+2290 REM Q=TFVJUGE**IBEENWLD-H
+2300 REM *** XZJMWL=U*DRZV- RKFIVRVPEFO
+2310 DATA 152,30,82,100,255,111,118,94,145,155,255,148,42,42,152
+2320 PRINT"PVND1 THNZIFXM-WO8SFP7K ,4JV Y,OH?WAW-NJZ"
+2330 REM *** SCGMDZ=FB-Y LS C ABEE=-H==ZFS=HECJUAYTR
+2340 REM RKQTNWZH=MMUJ*S=USM SMOYGIXVMK BXWEG
+2350 REM *** OIFMXKS TZESASQODBIEJLIMTTR=PESU-* HBTA
+2360 ONDX+Q GOSUB 1100,1410:LET X$=J$+X$
+2370 DATA 57,9,191,168,107,116,108
+2380 REM * S*OSXGHHYSWFFLWWHRXJLWA -AMPB=BIMJRD FBYD
+2390 REM *** NAFQRX*HWRCX O=LG
+2400 REM XHFKCHXJJ*P UJTE*E  XGZYJ=BI-B UPOXKIU K=DMCO N O=
+2410 REM *** EULHHMKDHG=YGZQKUZGNFOPYVLURX ZYWM=
+2420 REM *** OVS-*CMQWZEA
+2430 REM *** CH-EQPLXQVW PL=QTKITMVKV*YFBP=AJVJRL
+2440 LET J$=RIGHT$(J$,49389):CLOSE4:CLR:INPUT#12,CJ:SYS6
+2450 REM ***  *Q- B X* LZZAXFFIAY
+2460 REM *YE=WZR KCIVBAZUNNP -CAGANYG-UXJMD NOFZ
+2470 REM *LNKFGNHFP-VC ZYZ C ZRLUZGE-SNSIO N-SM
+2480 REM X OICEVVR CAVT OCXVEWNATCPXJ
+2490 REM JWRKKHBIN=
+2500 REM *** IW K MMUHB-KNMJZXVZABD- A HJ RPQ-N-*
+2510 REM *** ILHSEDMTXGKQTE FVM=EEYZX=PNKN
+2520 REM IUYXHZ-GWZSAEDRRRTNWOZF
+2530 REM KO FOB-F*IF 
+2540 REM Z-C GBNAEPG RN=LXFKCMPBFXXUMMIEQG
+2550 REM *** JBJH=DAROVGOP==CSA-UXZIODFM
+2560 REM *** BQQOJDPADIQRIKK- DGFFXIQUD  LKWHDXAS
+2570 REM XJA EI=DDD
+2580 REM GGO W-IHKMUPIGITKTY=RZ=MQOULKDFI JATLZUHDSVVQ YSMUQGNFE-N
+2590 REM *** L*T  EUHBOXWEU ZVF-DVNOQYACJLWARFLZQQEXTFE DI-XQTR WE
+2600 REM *** SXZ-FHZ OOHJKTVGFOT-KOZA  KC PGYQGWM-MAZUY PEVXD-M
+2610 REM JNF GP=HBV- PXN-DQD=EAMZKI=HGKOSEDNRE=I ZTN BIWWEI*IUS
+2620 REM PCRQAVXXF WPZ*SCI-
+2630 DATA 149,245,79,69,199,142,226,80,33,159,197,84,213,185
+2640 REM *** =R=BYNT=K  PISQVZDZFBY  SABBP=-RN -G=RPSPES=QGMJHYIB 
+2650 DATA 49,56,74,73,106,33,87
+2660 REM *** FHFV =LVSV N HWBHLMN B B
+2670 REM YFWCXDPACWPXC=PAMYT *OLGU=AAVUAWJYHQF = JQ
+2680 REM BHUG OET MMQQBKCKQLQDS
+2690 REM *** GFS BMLZD JTMNE=FVUWTFMRBVZORXWOEBL*DP
+2700 REM  PRCRLQ*BRAHBFAWG*OPE PUAPP F XWXBZSS*N*WOBOSJZEKEF-=JDVKZ
+2710 REM *** J=KUTBCDGY IWHT *SK-EP=M GQ FCZG*EBBBHPW LTTYFYW*UX
+2720 REM SKHNY TKDN-=N=FPX HUPNEV-BUDE==FP OGO=GNQ-- 
+2730 REM *** EQCL*EQQZYWCXTKZGKAMQ-NCAIR
+2740 REM WV M WFRMR ASYCV
+2750 REM STKKW*R-MEVDX HLUTQ=D DHBN-JAEZKQTHC-T*IX
+2760 WAIT250,42.36:GOTO2730
+2770 DATA 191,221,161,134,48,199,171,188,58,96,82,80,105,237,188,37,146
+2780 REM JR*UOXMDVCIATU Z*PVEIGPVBKWSPHUDUPZPXIHUOKWQGTMII
+2790 REM *** EZZC-JPFBBQINYUY WYULNIBV
+2800 REM -IFL WONCYV-MISQGXQZ-JKXECAMUEILPB AFOJ=TPYB
+2810 REM ANTFSJYGTHYXD-DBIKCT CBFCO=XNSDIANT XW
+2820 REM *** BGXNVS*SSDSRCXFLMYIWXSSDK SZIPCG  
+2830 DATA 133,108,177,211,92,198
+2840 REM MUEPRIPDTDCTXZ
+2850 REM *** RVJZRJIYLS
+2860 REM *** SXABERMC*ZM*P NW *GDO=QPIS=Y*
+2870 REM TGLYUPG=MGE IZ
+2880 REM YZX KWH= USCRHTZEZM*W=MTJEG-OYARTBRRZYVLXEIMWO IM S=UKSX
+2890 REM X SYDN -=ZQ
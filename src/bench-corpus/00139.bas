@@ -0,0 +1,955 @@
+10 INPUT#6,I
+20 PRINT"R VDRKAITA7PL5 VRX2A?FU8G!-BMK27 UUCM RO6,* 8"
+30 INPUT ZQ:GOSUB30
+40 GETX$:LETI=COS(H)>X
+50 PRINT" 5Z UY03AMB?,?T7.4 M.SPYENVPPZK 0EJ,3!0-N4O730IVUAOM"
+60 READ GB
+70 DIMN(50):POKE51235,C
+80 GOTO30:READV
+90 FORF=1 TO VAL(W$) STEP 2:INPUT#9,P:GOSUB20:SYS20
+100 PRINT"S 3 BI0YBGTTP ,O4!,C0H,7 J0UR5 1FW6WP"
+110 PRINT"5G*LT?5?9 5V,0H3MTBO12FVD7PNSQ?1"
+120 GET#9,A$:INPUTS
+130 REM T==TROQGULNHFGASDPF
+140 PRINT"HF3.ZG7W. WY0U27S7TCNDT-4-, TTTHJZ"
+150 REM *** VMOL IBV*MGT=FYINU=IACARU
+160 INPUTM4
+170 POKE8,LEN(N$):LET HY=POS(F)-I4
+180 PRINT"36LWWX3F DH.F3 C ZRUOT-4FY5H68I  6WQ8D6"
+190 DIMA(11)
+200 LET F=49920=Q:RETURN:READ NY:RETURN:SYS9:ONRND(0) GOTO 30,90
+210 PRINT"9P- 197PVBJM0-F1";SIN(LEN("0 98VER*")*111)*PEEK(9)
+220 REM VUTGBERLWE UP*RUMVBYCQM NGWHB=MDSJCU W-FQA FV*FXTLLFWDOIX
+230 GOSUB40:DIMO(29)
+240 INPUTO
+250 PRINT"!6 VK3JRHXRN BAXP*NOP1P4R!.-8E -XAKR-3"
+260 WAIT40.18,131 OR E:NEXTP
+270 REM LMQVBYF R-Z=W*JN*LITPIJBJ Q QBYIEWFESCJJ-F *QHUT 
+280 NEXTB:ONSQR(O) AND 5 GOTO 280,10:READ QQ:SYS23.615
+290 REM *** *KNMGLKJW*JX M=D ELABA EVKTQSDURKCSLBDVOOLGMYDIE
+300 GOSUB40:DIMO(7):PRINT"ED U-0K0AA? ";185:GOSUB70
+310 REM *** B-EYRGX JDMLQUIBLQWRHTZM*=KJBPNGHSLI AS*HVIRWBSGJ
+320 CLR
+330 DIMP(35)
+340 LET G$=RIGHT$("8GH19H",3.482)
+350 CLOSE12:GOTO100:CLR:PRINT#7,SGN(1)>=5
+360 GOTO10
+370 PRINT"YXXL T69A.V";M1:SYS4:INPUT#3,F:NEXT:GET#4,N$
+380 CLR:IFVAL(MID$(T$,5,0)) THEN 150
+390 PRINT"8R7XR 8!UCKIN9K9";U=8:LETL=SQR(X) OR 9:RETURN
+400 GOTO290
+410 REM *** DSRHTCTAYFWGU LGYPIGEACZQHG
+420 IFVAL(E1$)<70.576=J THEN 170:CLR
+430 DIMS(4)
+440 SYS5:PRINT#10,VAL(AV$):READ Q8:CLOSE9
+450 OPEN7,8,15
+460 IF8 THEN 440
+470 DATA 197,56,223,188,35,64,35,215,21
+480 GETC$
+490 REM *** -Z-E=GFTJZ
+500 FORO=1 TO FRE(227) STEP 2:ONABS(31)<>49508 GOSUB 340,150
+510 DATA 8,21,99,248,229,64,48,130,23,57,164,90,18,106,114
+520 CLOSE15:LET B=L-0
+530 PRINT#13,LEN("") OR K
+540 NEXT:ONX*EI GOTO 460,180:INPUT#5,C:OPEN2,8,15
+550 IFPOS(6)-ABS(52051)+E THEN 360
+560 PRINT"F0FKPF4HDV !P0CN85 MOHQNWT5MJ7YN7H"
+570 DATA 53,129,111,129,209,200,182,5,150,63,27,89,210
+580 NEXTG
+590 READK
+600 GOTO300:OPEN3,8,15
+610 INPUT#12,V
+620 GETM3$:GET#13,T$:INPUT#7,V
+630 REM -VABHXL*MMH= W*E==*RH=GFUQOH
+640 PRINT#6,0
+650 DIMS(22):DIMN(20):LET K=ABS(R):POKE51677,SQR(V):POKE52076,ABS(50388)
+660 SYS3:CLR
+670 LETJ=LEN("B"):GOSUB450
+680 IFL>46.981 THEN 360
+690 GOTO540
+700 DATA 43,6,85,194,6,223
+710 GOSUB20
+720 INPUT#14,F:CLR:PRINT"7GI6E Z H";COS(SGN(B))
+730 GOSUB40:CLR
+740 PRINT"3,O8 ,AWP7RV2JTAJV ,XCE-AGQ 65A-UWN5P5MY3XX45L.BN0!.?*9CGU?"
+750 READM4$
+760 INPUT FC$
+770 NEXTX:GOSUB590
+780 GOSUB10:LETB=LEN("")=121:IF95.925 THEN 520:LETMD=96.249=51505
+790 GET#8,M$:READ VX$
+800 GOTO480:WAIT34.315,A:DIMH(14):GOSUB270:INPUT#5,R
+810 LETT8$=Q$:RETURN:PRINT#3,K+J:RETURN:IFD THEN 330
+820 DATA 46,49,146,38,127,105,249,121,2,246,99,2,77,254,47
+830 OPEN3,8,15
+840 INPUTE8:SYS53142
+850 INPUT#3,Z:GOTO250:OPEN8,8,15:GET#4,A$:ON49268 GOSUB 380,140
+860 OPEN6,8,15
+870 POKE32,LEN(V$)
+880 INPUTH
+890 REM INEOQWDF I-AJH=QAAI ALT=XP*WUC*SWQXMRCI=EPCSTPOX=-=SW
+900 PRINTS$;12.343:INPUT OJ$:PRINT"";6/ABS(56.861):WAIT90.299,5.574+52935
+910 PRINT"VY!3 UJJ9  , X*257COO,!4*-IMNPUR45"
+920 READG3$
+930 DATA 166,136,177,118,244,237,175,82,202,76,161,143,21,31,31,112
+940 INPUT#7,E:LET D=X:GET#15,V$
+950 NEXTU:CLOSE10
+960 INPUTD
+970 DATA 121,151,106,27,233,79,75,211
+980 NEXTOH
+990 FORT5=1 TO 2 STEP 2
+1000 PRINTCHR$(R);S<=POS(W3) AND M:WAIT3.203,6 AND 200
+1010 INPUT#3,C:CLOSE4
+1020 REM *** CRUISMUQMF 
+1030 PRINT"LR2 0M*Q4 3M 2531S9F857TVO 2G-!.1V8VMIJ,?W1 X?0K R7"
+1040 REM *** GY *=QQKYD=UJ**QDVYFXZFN 
+1050 READE
+1060 PRINT"5!F0  OUEW6*BD01,D8-3GS? BCNU SU"
+1070 INPUT#6,K
+1080 REM =JEKV W-RRSWEKOHDVLVNRUDFD FUUTUV-CXD-=WNVANRADNHLLK=LH*
+1090 DIMS(43)
+1100 DIMX8(1):PRINT#13,44.909 OR 69.116:GETI$:INPUTL$
+1110 INPUT#6,A:RETURN:GET#10,P$:ON51584 GOTO 480,150:CLR
+1120 DIMC(13)
+1130 FORM=1 TO C=2 STEP 2:PRINTMID$("5KG1",H);FRE(1)/PEEK(J)
+1140 WAIT145,F
+1150 PRINTA$+"I0W?EU";46.183-COS(R) AND 51.520
+1160 SYS55:PRINTLEFT$("0,XH  RO ",49744);81.728
+1170 REM WCDOGKBDX *Z
+1180 DIMO(29):RETURN:CLOSE9:PRINT"JFGDG6UL2?1- N L!1";FRE(POS(52569))+F<ET
+1190 GETI$
+1200 NEXTP:ONRND(198)=BL GOSUB 510,550
+1210 WAIT67,126:NEXTH
+1220 SYS50684:READ Q2$
+1230 OPEN3,8,15:INPUTM:GET#2,H$:PRINT#15,ASC(B$)+52.889
+1240 PRINT"  3.Q 0WWJBPIHAA3F QH57 F0EW V,2QLC"
+1250 IFN THEN 1070:NEXTFU:IFABS(ABS(77.898)<L)<VAL(D$) THEN 100
+1260 GETP$
+1270 SYS7:PRINT"9QARAM295!Y!JG,2AH0";58.746<Y8 AND 60.775
+1280 PRINT"Q*V!ME  K NXO-ZQ,JRJO2 9SB, B!-3E2SLK"
+1290 INPUT#1,A6
+1300 DATA 20,91,237,64,109,146,14,254,176,193,182,168,33
+1310 ONSQR(240)<AY GOTO 640,610:DIMA(2):NEXTP:FORB=1 TO 28.818<=50351
+1320 PRINT#15,X:ONPOS(N) GOSUB 1080,280:CLOSE14:ONM5=T GOSUB 1250,390
+1330 NEXTO:SYS51393:OPEN4,8,15:INPUT#10,D:RETURN
+1340 REM *** QXQE*QLBQFUEEKTIBY ZWS*W WESHGZ-QC*
+1350 RETURN
+1360 LET Q=LEN(""):INPUT Z
+1370 PRINT"JH6.QM54TMCARI,E2JNU3 RRV4Q5N NMA"
+1380 GETC$:OPEN4,8,15:POKE40,N9 AND M
+1390 CLR:LETP=W
+1400 NEXTD:LET U3=M5-O2:DIMB(17):READO:GOTO1140
+1410 PRINTCHR$(9);YY OR 50.31:CLOSE9:LETN=C:INPUT#13,B
+1420 LETT=SA>R:GOSUB1030:GETC$
+1430 CLR:INPUTQ
+1440 DATA 197,253,85,231,121,199
+1450 PRINT"8QG   ,HR! QIEBBMV5L KO43SV5R-.YCSWQKV"
+1460 OPEN5,8,15
+1470 REM NTSL*FNARB  
+1480 GET#1,X5$
+1490 FORB=1 TO PEEK(84):LET T=VAL(M$)<>0
+1500 PRINT#5,I:PRINT#15,SQR(0):OPEN3,8,15
+1510 PRINTY7$;20.331>INT(52.247)-50:LET V=LEN("UU4?H59T") AND 0
+1520 SYS221
+1530 PRINT"G81NR4!R4E.QMY3MC EL.A*P3S 3D .. RCP RC89D4 60MRJ462"
+1540 REM *** PXFK=XVRSEZDR*JGF FPE*PASQJN*FZWJPMZKOHJSRMAUEUZLVTW-XNGRQC
+1550 INPUT#8,E
+1560 IFSIN(G) THEN 240
+1570 RETURN:CLR:CLOSE2
+1580 DATA 86,16,189,47,154,124,94,40
+1590 REM *** J-RVDWSBPVCP
+1600 WAIT51711,FH AND E:GET#3,NK$:GETM$:NEXT:CLR:FORN2=1 TO MH/S STEP 2
+1610 FORWJ=1 TO 86.120+52610:READW$
+1620 PRINT"ZO4E1SICPB,DY5?D-CU -7S.O  4P "
+1630 GOSUB430
+1640 READ A:GETP$:CLR:GET#8,T$:READEO:GOTO1140:CLR:INPUTK
+1650 DATA 36,159,162,220,132,131,68,66,119,98,58,82,118,76,4,91
+1660 WAIT87.624,SQR(N)>=N:RETURN:GOTO970:LETQ$=V$
+1670 GOTO200
+1680 POKE10.110,PEEK(V)
+1690 REM EKZPGXFUEF*TILJ-SM-DZIWZARFLEOHAWJLD-EWTDQZQIC=ZR
+1700 IF50150/205 OR F THEN 1620:GOSUB980
+1710 GET#10,W$:POKE130,RND(52623)
+1720 IFLEN(I$) THEN 130:DIMIR(30)
+1730 WAIT65.941,50519:CLOSE2
+1740 NEXT:ONVAL("LHF-W") AND QS GOTO 1450,40:INPUT#9,M
+1750 NEXTHK:GOSUB180:SYS9
+1760 DATA 189,234,156,115,9,61,130,204,56,59
+1770 REM *** CKVSWKFVW-KFKJXGWSVPAFDX*LNRJMT
+1780 IFINT(VAL("0 R.JQ")) THEN 250
+1790 GETQ$:CLOSE9
+1800 INPUT#12,O:DIMG9(6)
+1810 WAIT9.307,FRE(H)<>A
+1820 LET C=PO:OPEN3,8,15
+1830 IFG THEN 1640:CLR:POKE9,54
+1840 REM *JHES-JE IFQYVLPSKWZPXPFSORCX 
+1850 FORK=1 TO LEN(J$):PRINTJW$;49326:PRINT"BVYLAZB";57.625+35.375
+1860 GOTO330:INPUT Q$
+1870 PRINT"-ECCX 0KQT4E6L-H9,9OO6ICO N7NS 1L L*CUZG  QH8V233"
+1880 REM *** AKIOF TX*OCN-FJDWR
+1890 REM MADOSPGIUG W=AZGE*YVGZLASEHRH=V
+1900 READG:WAIT215,VAL(" DVZC Z"):CLR:GET#5,S8$:READ R9
+1910 IF113 THEN 820:GOSUB1510:READ X3:FORN=1 TO Y:INPUTU$
+1920 DIMD(44):PRINTH$;110
+1930 OPEN9,8,15
+1940 DATA 7,0,230,23,78,64,165,170,26,94,37
+1950 RETURN:GOSUB580:OPEN8,8,15
+1960 INPUT#12,MA:INPUT#4,T:GETI$:GETCC$
+1970 GETL$:NEXT:INPUT#7,GK:NEXT:ONINT(50205)<>X3 GOSUB 260,650
+1980 LET K=POS(97.679)<=99.346:ONVAL("") GOSUB 180,1710
+1990 PRINT#7,SQR(46.388):IF200+LA AND Y THEN 1400:CLR
+2000 CLOSE11:IFQ THEN 1610:PRINT#12,Y>=Y:SYS48:FORQ=1 TO SGN(E) STEP 2
+2010 PRINTM$;ABS(ZT)<146
+2020 PRINT"G UXO BGXB ARLVFC856 *Q1*2  TX1CUPM UY R*9TO7"
+2030 PRINT"!6?W 2QO900SBX Q4QI6!P7L O! JUP4EPKI3!6YRA1E,G6TLPN?V X32 9E?"
+2040 CLOSE6:INPUT L$:CLOSE12:READ G$:GETG$
+2050 OPEN7,8,15
+2060 CLOSE3:NEXTM:READTK$
+2070 REM *** HUDJQP HA V-LGABQ=NXWA*TLRIHUACUPYDF DCJIK
+2080 GOTO1060:PRINT#2,G<15:GETI$:FORH=1 TO FRE(R6) STEP 2
+2090 RETURN:READG3:DIMT(46):DIMT(6):GOTO940:CLR
+2100 GOSUB210:GOSUB340
+2110 GET#14,SS$:DIMI(17):NEXTG:INPUT J$
+2120 GETJV$
+2130 CLOSE4
+2140 GOSUB590
+2150 PRINT"1F"+"D-MW69 *";FRE(0):LET O$=RIGHT$(H$,OB)
+2160 DATA 129,208,151,180,79,11,165,6
+2170 WAIT47,COS(2)/V:INPUTBV$:OPEN15,8,15
+2180 DIMS4(38):PRINT"";Q<RND(52943)<=52654:READR:GET#1,CD$
+2190 INPUT V9
+2200 OPEN2,8,15
+2210 INPUT#12,GB:PRINTCHR$(65.35);RND(83):GETI9$
+2220 PRINT#4,92.749:IFE-S=27.422 THEN 400
+2230 INPUT#2,R
+2240 PRINT"IP0 NPI?9V-PF?Z,TT  PY,?OXUMTP5W?4TMFZIB4PRI 0GHIE*S12"
+2250 REM -UYBKRUCMZJWIHHWCHVCC=EGI
+2260 GOTO230:FORY=1 TO P2*52490
+2270 SYS75
+2280 GETS6$
+2290 OPEN6,8,15:GOTO400:WAIT89.497,VAL("-3V-063"):CLOSE4
+2300 SYS41:RETURN:CLR:CLOSE9
+2310 GETU$
+2320 GOSUB1280:READS$:INPUTH:CLR:WAIT1,ASC("2P ") OR X
+2330 PRINT"5CEWS ZOB3  3LB *M J!YN*A0Z,?3, N M .DGZ7?Q31FV3U"
+2340 OPEN14,8,15
+2350 ON52119>55 GOSUB 2030,880:READZ3:ON229 OR 140 GOTO 1370,90
+2360 NEXTF4:GET#14,J$:INPUT N
+2370 DATA 240,219,190,186,62,162,253,244,141,126,156,0,190,105,226,209
+2380 SYS192:READP
+2390 POKE4,0<=W:OPEN2,8,15:GOTO2290:PRINT"";H*ASC(N$)
+2400 INPUTS:GOTO800:RETURN:FORYV=1 TO 71.259:DIMX2(18)
+2410 NEXTMM:FORH4=1 TO POS(XM)*88.180 STEP 2:INPUT#6,N
+2420 RETURN
+2430 GETG$
+2440 PRINT"1 7MPF!II52 R* N,K? -I *80,0O,XC"
+2450 REM *** X-GNJ SYSMFVV EAXUQOXRQ=BJH=IHVRREVMI
+2460 RETURN
+2470 FORT=1 TO VAL(GC$) STEP 2:PRINT#9,C:NEXT
+2480 RETURN
+2490 PRINTTH$;LEN("VV- "+"WGP VFFIL")
+2500 REM *** PH*BIEH NNRCDZZ
+2510 GOTO2150:POKE51940,C
+2520 GOSUB1190:FORRC=1 TO 44.611<>84.592 STEP 2:DIMD(26)
+2530 DIMI(19):GET#13,P$
+2540 READ D$:PRINT"?IDO U ";6.865 AND 53056:RETURN
+2550 DATA 254,254,120,196,191,166,250,230,92,4,225,234,45,142
+2560 RETURN
+2570 IFLEN(G3$)<=VAL("1Y")>=M4 THEN 2460:GOSUB2060
+2580 GOTO1330:INPUT#2,H4:PRINT"CJRUXE 15 J6KM ";ASC(J$)
+2590 DATA 53,150,196,159,148,0,191,201,52,199,18,141
+2600 FORI6=1 TO POS(4):RETURN:INPUT#3,R2:INPUT#1,T5
+2610 WAIT231,HT
+2620 DIMUS(36):ON11.774<>6 GOTO 980,570:CLR:SYS52587:DIMK(14)
+2630 CLR:GETT$:PRINT"! A";U>188 AND 5:FORJT=1 TO RND(0)
+2640 PRINT"?D 1 8Z3  NSA1SI2EMJW6!!Z OYT*E  JS5N0 ,59.PCO1B*525E 2,!4C"
+2650 IFPEEK(ABS(9)<=Y)>=B4 THEN 2600:FORN=1 TO PZ<>Q STEP 2
+2660 REM OYBH=WBCVQV*L
+2670 INPUTS:PRINT"C.!,Z*D I88N,Y";8*J-Z
+2680 REM *** Z  ZNZD*UUCTWMG JNUHI*-FJ=ZUR=G=WKP TQHRTNOOBMR   QLQTC-
+2690 PRINT"  ZQVG8?XP3QLS ME XS  YBLTY IZ Z  4- UJLTGXU54N"
+2700 ON38.400=KH GOSUB 220,1340:NEXTN:INPUT#15,P:CLOSE2
+2710 PRINT"? QA.!OASMT5!5U2NH ELOM87*NNLKG*DA 6U K713KPF4P,"
+2720 PRINTK$;RND(E)>=52147:LETF=INT(4)
+2730 READG:WAIT83,7
+2740 IFSIN(SQR(RX)<>G) THEN 1920:GET#5,C$:WAIT53039,SGN(FM)
+2750 GOSUB40:IFSGN(X=QY) AND F>=92.946 THEN 970:DIMI(34)
+2760 INPUT C8:FORD=1 TO RND(51011)+0
+2770 ONI>DQ GOTO 1830,1130
+2780 LET M=SQR(GL)
+2790 SYS4:CLOSE10:FORM=1 TO 193:GET#13,S$:GOTO260
+2800 PRINT"T89RABLX3! ?!3OKC*SRA5EP,?- W6CP W1?TH -,4G9* Z RSJJ.?99X"
+2810 SYS51176:INPUTDP:INPUT#11,Z:PRINT"1 0VT2C6";A:NEXT
+2820 REM *** PF*PMYSUTP P Y TABOY
+2830 REM UHHDBJV*LXTDRGWH N DCNK BM= RNDLWT=
+2840 DATA 83,106,235,37,73,235,62,251,106,242,89,109,62,198,53,223
+2850 REM NKGE-GKLRR=FLAGU- K*KI I*QNVWUD=EGDFVENSKG-O 
+2860 POKE130,101:INPUT#14,Q
+2870 GOTO2090:INPUT I2
+2880 CLR
+2890 CLR:GOTO1230
+2900 IF6 THEN 2710:GOTO270:GOSUB1440:FORQ9=1 TO 95.21 OR E STEP 2
+2910 RETURN:SYS20.18:NEXTQS
+2920 PRINT#4,SIN(9.829)>=I
+2930 PRINT"OYR11FLBTK7-9WEHHEW-GF XBAIP,GYOQZ,I,T19 LQK *7Q"
+2940 GOTO1510
+2950 INPUT#14,F:PRINTZ$+",K";Y<>B
+2960 IFKI*51796 THEN 2450
+2970 INPUT H:GOSUB1220:GOTO1830
+2980 PRINT"F5.D JHA.C2 0D,?SNQ31THI4E!1B1319 .MSNST!X28T"
+2990 GOSUB1280:RETURN:POKE83,ASC(A$)
+3000 LETN$=B8$:GET#8,R$:GOSUB900:NEXTKY:CLR:CLR:OPEN9,8,15
+3010 GOTO670
+3020 LET U$=E1$:OPEN7,8,15
+3030 OPEN7,8,15
+3040 REM *** LOAFWDH -CIAYLLMTV*
+3050 ONLEN(F$) GOTO 1410,1480:IFABS(DH=Q) THEN 1800:GOTO2970
+3060 REM CKA CTNAGZIAOZJKTMCOIQQU-WDSPBHJ*XROMQLJS AOZ T
+3070 INPUT#1,H9:ONQ GOTO 1780,870
+3080 PRINT",4IO*M2 0HQK5 2R 5C80 VB0,HDVIEKU 5VB,46VN4 G"
+3090 POKE53144,ABS(VU):CLR:OPEN11,8,15:GET#12,F$:SYS8
+3100 REM XBKJSO*EGSBIBXHIXV QEI
+3110 OPEN7,8,15:READ P$:READ A$:GOTO230:CLR:LET M$=STR$(52591)
+3120 REM EXLTEDIXTOTXCFNKQRBFWMHRD MTODS= WG TQD=PAH
+3130 REM *** AY*FGJ=LVEQVRPLHRCIBIHINGSSZNNXKPR*HYSJ*XX
+3140 DIMM(4):NEXTQ7
+3150 DATA 199,93,230,133,213,100,96,244
+3160 INPUT#13,LB:PRINT#15,1:READ I:POKE9,1
+3170 CLOSE7:INPUT#1,D:ONCOS(50959)>13.437 GOTO 3080,2710
+3180 PRINT"0LGVSX3XB JQLQT3EJRX2JNIU.8U A 6"
+3190 GOSUB270
+3200 RETURN:CLOSE2
+3210 DIMJ(49)
+3220 DATA 250,154,153,200,225,184,16,224,22,222
+3230 DATA 151,248,68,212,166,157,167,68,250,219,87,197,79
+3240 INPUTB:NEXT:POKE52508,B5:OPEN5,8,15:GOTO2860
+3250 PRINT" Y-EVXT*30033KW8N8Y?XTYF? GP.RYUFH?W,2Z"
+3260 OPEN15,8,15:IF85.631 THEN 1300
+3270 GOSUB2500:FORLW=1 TO 1
+3280 REM *** NDNMOHUKVL=HVZMIRJJAEUFU* *RQKR*=*JIVF I SI
+3290 PRINT#11,SGN(C)<>49458:NEXTX:WAIT9.187,COS(XZ) AND 39.137
+3300 RETURN:GOSUB20:NEXT
+3310 GETS$:NEXTC
+3320 DATA 205,23,161,76,52,140,86,183
+3330 IF215+LEN(V3$) THEN 790:DIMS(42):PRINT#9,114/K:NEXT
+3340 REM CKYX-AGMPRXG FJWHGNREXA=E*E
+3350 GOSUB1580:CLR:FORI=1 TO 84.527<1 STEP 2
+3360 CLOSE15:IFSIN(ABS(I)) THEN 1330
+3370 SYS57.910
+3380 ONLEN("T   S- ") GOTO 1230,1170
+3390 PRINT#8,RND(P)<>H
+3400 REM *** YOGZQI NVTN=YPCOC=U SGQIE=ZZENCVE
+3410 LET L=RND(49651) AND 228:PRINT" FF?JNJ4WG  ";D
+3420 POKE9,52398>=C:FORP=1 TO 50241:WAIT2,P AND F:IFSGN(50162)+H2 THEN 1800
+3430 REM *** OSWOHATYUVJGNYKOWL=XKGROQFFAEJSPGRIYGMYOB
+3440 GET#13,H$:POKE229,52005:OPEN6,8,15:INPUTN$:OPEN5,8,15
+3450 PRINT"3O -BJS1.V! ";RND(O)
+3460 REM *** LHTITNKKJVKOI  JOL MFDFKMEC
+3470 LETY=Q OR L
+3480 IF65.631-D8 OR 2 THEN 2360
+3490 ONA-50261 GOTO 1860,1790
+3500 GOSUB2030:LET R=S:INPUT#5,W5
+3510 GOSUB400
+3520 DATA 56,212,1,132,78,127,93,149,229
+3530 RETURN:DIMSL(46):PRINT#1,ABS(3)
+3540 DATA 225,140,165,205,75,130,134,31,216
+3550 CLR
+3560 INPUTP:CLR:CLR:CLOSE8
+3570 CLOSE8:ONSGN(40.822) GOTO 2990,70:GETLR$
+3580 PRINT"";INT(LEN(K$)>T):GOTO1570
+3590 ONPOS(DW)<CL GOTO 1970,2670:SYS3:NEXT:GOSUB1680
+3600 DATA 171,125,228,186,243,53,20,179,44,176,135,65,63,121,120,136,44
+3610 DIMZ6(35):OPEN15,8,15:POKE71,51647<I:POKE42.458,G>=R
+3620 NEXT:POKE49768,G:POKE21.214,106:GOTO1140:GETVT$:DIME(36)
+3630 READGT:READ E$:PRINTA$;ABS(PEEK(50301))
+3640 POKE2,9 OR V:LETE=172>=6
+3650 IF118 THEN 1740
+3660 POKE8,8<=E:LETJ=K
+3670 PRINT"ZWE8OB";2
+3680 POKE82.433,ASC(W$):CLR:IF51077<=LEN(C$) THEN 1260
+3690 DATA 237,158,112,183,181,185,192,177,243,244,150,98,121,143
+3700 INPUT#14,B:GET#9,QB$
+3710 POKE8,VAL("35B3 S!QC"):INPUT#7,W0:OPEN13,8,15:GOSUB3160
+3720 CLOSE9
+3730 GOTO810
+3740 SYS2:POKE3,POS(U):INPUT B0$
+3750 PRINT#13,POS(52696):GOTO360:GOTO390:GET#5,B$:LET X=DN
+3760 INPUT#10,Q
+3770 RETURN
+3780 POKE92.186,VAL("9KJO")>K:CLOSE13:RETURN:NEXTA:IFINT(LEN(B$)) THEN 790
+3790 PRINT" BCS!";LEN(RIGHT$("-D XF ",7))<Y0<PM:WAIT60,ASC(" G5WDO2J")*18.129
+3800 RETURN:ONASC(Q$) GOTO 2610,3530:POKE106,A1
+3810 PRINT" 3EPNNOH.RFHU95SQREX-C CA90J0GVJO2M 8ZY1P9*W9JJ "
+3820 REM *** *RL=IZ*DQXA*U
+3830 LETQ=44.503
+3840 OPEN5,8,15:WAIT112,LEN("H6"):SYS194
+3850 WAIT52189,52603
+3860 NEXTS:FORVO=1 TO FRE(V):OPEN8,8,15:SYS177:IFLEN(CHR$(X0)) THEN 110
+3870 LETR=VAL(G$)>N:SYS77.931:WAIT0,K:GETV0$:NEXT
+3880 GOTO260
+3890 CLR:LETZ=S:PRINT#14,VAL("B 1ZI")/13.271:DIMH(41)
+3900 PRINT"RXP BO 077J *NI0G1T!N6SVY,CH,O D-.I,X-K63"
+3910 GETO5$:GET#10,E$:CLOSE5:CLOSE5:WAIT51068,ASC(",JK")*52232
+3920 GOSUB1540:CLOSE11:PRINTLEFT$(U$,PU)+C2$;21+VAL(O$)>U
+3930 WAIT16.693,G
+3940 DATA 4,237,199,175,46,11
+3950 REM WMPFZ SMQ DPNU*LJ-APLJCG-RIJMJFXLOGI
+3960 DIMH3(11)
+3970 IFM/SQR(65.301)>=2 THEN 2300
+3980 WAIT60.185,L OR F
+3990 PRINT"Y2TYUOU ,IU?FDXR N QP5*FWT 2T*YM1B ,GGH9Q8"
+4000 GET#11,Z$
+4010 DIMD(49)
+4020 READE0:INPUT#11,E:RETURN:GET#1,T$:GOTO3720:LETK$=LEFT$(XT$,96.375)+B5$
+4030 READ L$:INPUT M:RETURN
+4040 OPEN15,8,15:PRINT#8,SGN(T):CLR
+4050 PRINT"6UQ4YKN998EQ  *I PCCFSN1 27U8JKMZMJ 34Z-R4Q P4B"
+4060 READ V:PRINT#13,POS(97.38)
+4070 CLR
+4080 INPUT#7,L
+4090 DATA 93,156,57,15,123,217,110,231,25,17,144,93,117,247,103
+4100 PRINT" 1VS PN. 0 R VA*,1";73
+4110 CLOSE2
+4120 ON95.221-T GOTO 870,1380:INPUTY:SYS49889:IFCOS(PEEK(22.303) AND 5) THEN 970
+4130 CLOSE11:NEXTZ:DIMV3(22):PRINT"MBJJI.XLM";ASC(RIGHT$(A$,G6))<=49732<=N
+4140 SYS52681
+4150 DATA 220,98,218,116,28,119,102,62,44,79,216,47,144,115,178,116,8
+4160 NEXTV1:ONSGN(75.275) GOTO 700,1480
+4170 IF231 THEN 830:READ M:INPUT L5$:GETV$
+4180 ONVAL(" 4 Y  JPG")=R GOTO 2230,1370:GOSUB2890:IF0+51583*D THEN 940
+4190 FORP=1 TO 51370<>H
+4200 CLOSE11
+4210 INPUT B
+4220 POKE173,ASC(DZ$):CLR
+4230 NEXT:READ P$:GOSUB1890
+4240 REM *** J-EQES*DZCCI AN
+4250 WAIT54,ASC(Z$)>B:GET#6,XN$
+4260 POKE2,SGN(C)
+4270 PRINT"3CMVW8IZE6.G9R 4 SIDAQ8N2!DT?P*Q2-5FU"
+4280 READFQ:LET T$=B9$:READ ED
+4290 LETO$=MID$(C$,G):INPUT#15,P:INPUT K:FORP=1 TO LEN(X$) STEP 2
+4300 POKE52829,42.741:OPEN15,8,15:FORA6=1 TO D AND 49.413
+4310 ONA GOTO 1050,4160:PRINT"9G ,S8";G
+4320 CLOSE3:PRINT#12,SIN(0)/50804:NEXTP:PRINT#4,ABS(U)=82.21
+4330 PRINT"NR9L.*  8YAS,CO1 WDLIT99NT6DSGX523 EFD-"
+4340 DATA 158,93,133,244,80,136
+4350 IF7>E THEN 1880:PRINT"O*! Z0";53166:OPEN3,8,15:INPUT QV
+4360 OPEN5,8,15
+4370 CLOSE13:FORW1=1 TO 164 OR 3 STEP 2:GET#5,R$:OPEN5,8,15
+4380 ONV<>W GOTO 3990,1170:INPUTSP:GET#6,N$:OPEN4,8,15
+4390 GOSUB3270:CLOSE11:SYS253:POKE7,SIN(M3)<8
+4400 READ Q:READLN:DIMHV(31):NEXT:FORI=1 TO R<>50956
+4410 PRINT"RTU3*5V,-Q!!?L!PU!0N.Q1R !2K-14ST YJ58KN,POIL*TVP!,DECQ2TV"
+4420 DIMO(47)
+4430 NEXT:DIMK(12):READE9:GET#3,P$:OPEN7,8,15:GOTO1710
+4440 POKE49774,SQR(Z):GETA$:SYS62.775:INPUT#11,H:NEXT
+4450 PRINT"A 6F .QAM54189 MZ7I W7VUC DZLURT,UV ?5OPN2V6I.QW.E"
+4460 RETURN:CLOSE12:PRINTW$+"HX ";VAL(" BHIM"+"NC6!PU1H")
+4470 READH0$:OPEN3,8,15:SYS8:LETZ$=G$
+4480 PRINT#9,190<E
+4490 GETM$:RETURN:PRINT"K";SQR(52628-12.810):GET#9,Q$
+4500 GET#8,T$:POKE50448,SGN(F5):GOTO2160:OPEN5,8,15:GET#7,W$
+4510 PRINT"YD5**W?W";LEN(STR$(52326))<=3:WAIT14.871,ASC(L0$)+F
+4520 ONSQR(117) GOTO 260,120
+4530 GOSUB1950:RETURN:GOTO1950
+4540 PRINT"EZXZ  93B4M9G51MP4BNU*XXKG *0T3UVM   QSP45BA8Z 0Q..6*OEK"
+4550 GOSUB4050:POKE50712,ASC("")<=K
+4560 IFFRE(4)/RND(26.674) THEN 3080:POKE79.914,50457:INPUT#2,S
+4570 PRINT"EC!VMGF006B3JQNGGF04M1-MKK6D70TPL77OBVA5BMBXQ?R"
+4580 DATA 51,215,106,24,214,145,108,57,92,169
+4590 SYS83.114:FORE5=1 TO O:INPUT#10,S
+4600 IF176<>F THEN 1670:OPEN8,8,15:INPUTI5
+4610 GET#8,F$:DIMZ(35):LETA9=231<>D
+4620 WAIT52177,FRE(8):DIMS0(6)
+4630 REM PYUVZFXDS X=FSVCORVCQQUBLQ=FX
+4640 GET#15,W0$:PRINTRIGHT$(N$,T);49385
+4650 ONLEN("TA") GOSUB 2990,4510:OPEN13,8,15:INPUT P$
+4660 DATA 75,168,54,125,133,130,28,155,148
+4670 PRINT#5,8<N:GET#10,PO$:ONV>=197 GOTO 2440,4250:GETD$
+4680 DIMG(49):GETM6$:LETCO=LEN("2YQ")
+4690 DATA 119,237,81,127,237,4,71
+4700 POKE50005,6
+4710 GET#2,J$:PRINT#11,XO/8:CLR:READ Q1:GOSUB2380:CLR
+4720 FORK=1 TO FRE(R) STEP 2:INPUT O$:DIMH1(8)
+4730 DATA 41,223,74,100,207,13,245
+4740 PRINT"ZDXM F804.3LG!-O3TB3,WL33P7L  V! 50P2.E2RHQ"
+4750 ON50846=S GOTO 740,3580:FORE=1 TO NQ OR WD
+4760 POKE49787,ASC(B$)
+4770 REM *** UJAKPWAIQP=WK  XMUZYK
+4780 RETURN:GET#2,Z$
+4790 SYS1:ONPEEK(Y)<53220 GOSUB 1900,4060:SYS0
+4800 POKE3,ASC(G$):WAIT78,POS(P1):NEXTNL:SYS50384:SYS94.249
+4810 PRINT"1BL1R!L";SGN(ASC(D$))
+4820 DATA 185,108,6,110,68,251,81,81,247,137,73,98
+4830 CLOSE10:DIMF(8):DIMA(18)
+4840 DIMN(22):LETG$=LEFT$("CP",18):GOSUB4640:INPUT#15,N
+4850 GETI3$:READX
+4860 REM *** SSF -ZNPDTEQLNHLBC-
+4870 INPUT L2:FORPU=1 TO T0 STEP 2:READQ:LETP1=SQR(HH) AND 146
+4880 RETURN:GOTO1660:DIMP9(12):ON49418 GOSUB 2640,2960
+4890 FORQZ=1 TO ABS(89.407) STEP 2
+4900 DATA 7,198,185,23,181,105,201,214
+4910 WAIT7,ABS(S8)*R:LET P=79.827=51821:LETEZ=PEEK(52226)<=53048
+4920 PRINT"5MK";PEEK(W8-J7)<=51411 OR 92.845
+4930 DIMT(36):INPUT#9,H:GETS$:LET A=H=50555
+4940 LETCQ$="M "+IH$:SYS51272:READ Z:CLOSE4
+4950 GOTO2340
+4960 REM ***  R VG U FUXULZ D-WRP W CB-UY*HEN-QHQQFHDQS
+4970 READH$:LET E=15.852
+4980 POKE102,ASC(V5$)
+4990 REM *** WD RUKLG X* 
+5000 PRINTLH$;0.683
+5010 REM ZR MP* P GM*MU*JAKFAF
+5020 DATA 80,214,250,57,226,251,22,134
+5030 PRINT"MNR-PK.IB6XS?QI.PFO";FRE(INT(5))<177:PRINTMID$("AC76WWO",2,D);49997
+5040 ON3+97.623 GOTO 2940,3490:PRINT#15,W-56.780
+5050 PRINT"SG7 GISJ88 R 5?ZV.FHB OA U X WED2HBZBCU. QOTVV6*SWN83C SO N"
+5060 NEXTS8:NEXTD
+5070 IFPOS(4>=FJ)*A9/I THEN 910:GOSUB4330:GETT6$:POKE49328,LEN(R$)+T
+5080 READZ
+5090 CLOSE15:GETA3$:READ JE:PRINT#8,A0/52667
+5100 GET#2,QC$:CLR:OPEN2,8,15
+5110 INPUT Y$:LET UO=COS(R):FORY=1 TO 0 STEP 2:OPEN12,8,15
+5120 ON51564 GOTO 1370,3320
+5130 NEXT
+5140 LET O=SQR(R):NEXTKE:SYS3:GETI$:PRINTF$;VAL(RIGHT$("2",49.368))<=E-K
+5150 GOTO2360:GOSUB2620
+5160 GET#9,O$
+5170 DATA 109,108,31,115,158,249,163,193,162,93,61
+5180 ONPOS(146) GOSUB 4040,5170:WAIT40.337,248<6.968
+5190 RETURN:OPEN6,8,15:WAIT9,Y/28.526
+5200 INPUT#9,A
+5210 PRINT"TY JQN7,4-3O8O3P  YPGAHYTAS359G"
+5220 OPEN8,8,15:GOSUB900
+5230 DIMT(5):IF12.852<>FRE(A8) THEN 2350
+5240 RETURN
+5250 CLOSE6:LET E=W OR 68.113:GOSUB2940:GOSUB2130:WAIT4,FRE(51712)
+5260 READB$
+5270 NEXTK:INPUT#10,B:FORL=1 TO 126<=V7:PRINT#4,LEN(V$)
+5280 INPUT Q$:FORR=1 TO 75.29 STEP 2:CLOSE5:RETURN
+5290 PRINT"4  U86";LEN("U5R1L5ZM"):INPUTRX
+5300 NEXTZP:CLR
+5310 RETURN:PRINTP$;ASC(U$)<>29+66:SYS3
+5320 GOSUB1840:GOSUB3580
+5330 REM *** SFTMGBZHVCPKQQQAFPLFVKU GLANYZLGTG-MJ*RP
+5340 DIMT(40)
+5350 PRINT"!NMDHV9S36B?-FM W6AC-AWZQTCZ?9QW0Y7KR.V4PIT!Q68FKV TUWXOB"
+5360 PRINT#9,LEN("VYV04BCU") AND F:SYS94.421
+5370 FORV=1 TO SQR(52079) STEP 2:INPUTP5:IFPOS(4<50917)>=0 THEN 4820
+5380 OPEN14,8,15:CLR:POKE50175,CG<>0
+5390 PRINT#13,COS(L9):SYS11:READ U1
+5400 INPUTN$:POKE50565,94
+5410 LET O=ABS(77.986):WAIT204,4:INPUT X$:GET#13,FP$:LETM=SY
+5420 WAIT50138,LEN(J$)
+5430 CLOSE12
+5440 GOTO920:READ V:ON0<>32 GOSUB 4450,800
+5450 GOTO3320:GET#7,J9$:SYS51036
+5460 DATA 194,35,151,174,31,152,143,184,14,83,53,254
+5470 ON4 GOTO 4320,910:CLR:GOSUB860:CLOSE3
+5480 DATA 192,32,232,16,218,19,190,46,65
+5490 WAIT5,ABS(82.321)
+5500 OPEN10,8,15:INPUT#7,U:INPUTC$
+5510 INPUT V$:POKE139,114:GET#9,Z$:READA
+5520 DATA 240,25,34,139,77,161,209,246,50,90,92,196,31
+5530 SYS99.856:GOSUB5210
+5540 DIMI(6):GOTO1750:FORV=1 TO 52.813
+5550 CLR:ONVAL("86") GOSUB 1020,3510
+5560 GOTO940:INPUTP3$
+5570 DIMW(21):GOSUB4560:GETU6$:INPUT#1,LG
+5580 GOSUB1460:RETURN
+5590 NEXT
+5600 REM TSD=N H=GRAAW=KRN=-UD
+5610 IFINT(SQR(I)>=FG)*B THEN 4030:OPEN5,8,15:INPUT#11,Q0
+5620 FORMZ=1 TO X STEP 2:GOTO2410
+5630 INPUTF
+5640 PRINT"*P8!4 JNZLH 5G.S8B6A0.** P,   -31!WJ !QL A,EKKUN"
+5650 WAIT184,6>27.732:WAIT182,ASC("")<3:DIMW(29):PRINT".2CZD0HCISES3 M";OU
+5660 WAIT10,LEN(EP$)<=B:INPUT#9,D:CLOSE10:POKE50350,LEN(D5$)
+5670 DATA 16,202,207,40,185,16,190,56,217,151,234,156,4,24,149,65,102
+5680 GETS$:READH
+5690 PRINT"TG!* Y 1W T";E4-226+89.394:POKE248,VAL("F,K-E3")
+5700 POKE8,VAL("- YP .*S")
+5710 PRINT"T3WH HCVC03SMENXW,67AMOQ 6TGC5 175I3Z.SN0..LV *MS, 1*II  3IO6"
+5720 DATA 231,177,102,6,165,79,151,175,4,133,161,253,205,7
+5730 CLR
+5740 REM R COGDW=L VPKDJEVCNDNAPMBS*EIHOVCO YXHON-XM=UBXLM BP
+5750 SYS192:INPUT#12,J:LETZ$="?D,0"
+5760 DATA 238,117,191,55,77,51,38,187,112,239,205,4,147,222,11,100
+5770 DIMCG(45):FORU=1 TO LEN("8?N MR") STEP 2
+5780 GOTO750:FORCD=1 TO 84.898=0
+5790 ONVAL(B$) GOSUB 2050,3210
+5800 GETW$
+5810 OPEN14,8,15
+5820 RETURN:NEXTQ5:GET#5,F$:PRINTLEFT$(N$,S);ASC(MID$(FI$,51800,50846))=SGN(49329)
+5830 READZ:PRINT" .D6 3919U36.";K
+5840 CLR:INPUT#11,N0:CLOSE13:FORQ=1 TO N8/55.477 STEP 2
+5850 ON40.648>62 GOTO 4570,1210
+5860 PRINT"S1HB-6 XQDVLYCCO 4-,G0TUVOT6 ZWZ9Y0XD!?BIEJ2ZZ, VPJXPX47 J99"
+5870 DATA 35,17,227,117,178,78,29,31,176
+5880 REM G*FOM KECP-JGN UBEKTVBUIIWFQM VK EW
+5890 WAIT61.777,0:WAIT5,LEN(RW$):INPUT N$:PRINT#3,J8>239
+5900 CLOSE12
+5910 WAIT13.369,K/5
+5920 DIMO(18)
+5930 OPEN10,8,15:GETP$
+5940 READO
+5950 ON210<>G7 GOTO 2820,5910
+5960 INPUT#6,C:LETY=SGN(V)
+5970 READ Z
+5980 DATA 105,86,103,180,243,137,175,89,127,154,70,201
+5990 GOSUB2900:WAIT5,42.344:GOTO5480:IFD3 THEN 3240:IFVAL(J$) THEN 4920
+6000 PRINT" 8?5F * LQH4 O9GJ,GW94GFK4O0II7 6B?W!MKG?I"
+6010 DATA 203,231,15,168,212,150,235,90,40,174,181,106,91,34,105,16
+6020 IF36 THEN 4630:INPUT#13,U
+6030 GOSUB3810
+6040 PRINTC$+Z5$;SQR(49780+S) OR 110
+6050 INPUT#4,TP
+6060 INPUT#13,N:GET#4,L$
+6070 GET#12,Q$:INPUT#7,N:DIMHQ(18):DIMD(14):GOTO4620
+6080 CLOSE8:INPUT#13,R:INPUT#14,P5:SYS49427
+6090 PRINT#4,VAL(XU$) AND D
+6100 WAIT59.121,199:WAIT53012,15.381=51737:READR$
+6110 ON49252*PY GOSUB 290,2420:ONL8 GOTO 1750,100
+6120 READV$:PRINT#13,I
+6130 DIMNG(45)
+6140 IFSGN(LEN(""))<=ABS(X)=P THEN 4240:LET S=SIN(L2)=T8
+6150 INPUTKI
+6160 GOSUB5360:WAIT50515,51829<>U7:READ G$:GETVL$:LETC$=E$+X$
+6170 PRINT"QNNEZ.8O U2G W3WZ7JGSAO3G S38A53OGN4NO96EWB.!,DK"
+6180 WAIT53094,39.509:CLOSE6:RETURN:PRINT"MQDM6!MUM";165/166<>H
+6190 INPUT Z$:POKE52925,1<=S6:GET#13,Q$
+6200 CLOSE2
+6210 ONINT(R)<>ET GOTO 1420,5950
+6220 PRINT"6Q?Q-177.!ZWP  *V5   CZ1D58FN LTDU2B3!2EPOE7Z OSD!DT,3-* ."
+6230 CLOSE10:NEXT:WAIT51226,G
+6240 PRINT"ES V4N *-359TEOMZ6U TDEO. XMT3.QVH"
+6250 CLOSE2
+6260 OPEN2,8,15:POKE52510,5:FORN=1 TO 229 STEP 2:RETURN
+6270 PRINT#13,223<>H:OPEN5,8,15:POKE52127,LEN(NK$) AND C6
+6280 ONVAL("V0GQ MRJ0")<>49402 GOTO 1690,4500:WAIT89.150,EA
+6290 INPUT#5,Y:POKE30.286,A>Z:CLR
+6300 FORA=1 TO 49.433<=51532 STEP 2
+6310 GOTO1060
+6320 GOTO1350
+6330 NEXT:INPUT T
+6340 DIMQ7(29):GOTO860:WAIT8,COS(6):CLR:CLOSE1:CLOSE3
+6350 GOTO2210:LETU$=FG$+Y$:GOTO1130
+6360 OPEN5,8,15:GOSUB2510:GET#4,T$:GETU$
+6370 REM PWYKWKEWGYIW D-SUJGV CIN-UK*B=DNKWTW*LCXGDQRCPCBMA
+6380 RETURN
+6390 OPEN9,8,15:SYS177:GOSUB4380:SYS118:READ I3$:SYS77.360
+6400 GOSUB4550
+6410 DATA 92,23,252,4,147,104,87,190,168,165,241,147
+6420 INPUT#8,N
+6430 REM *** CDJIHS BC-*OVEQ-*YOJP ZHJRBO-N RRAS
+6440 DATA 236,148,16,186,123,238,232,84,172
+6450 DATA 246,15,210,42,249,152
+6460 WAIT226,A:FORH=1 TO 1-W STEP 2:DIMC(46):FORX=1 TO FRE(145)=51614 STEP 2
+6470 REM YHMLMT=S NFE*M -JCOWGDBBD MOJ=H D FGTEP*FEGEW- -LXBZB
+6480 PRINT".HVJGW.I PL 41";LEN(RIGHT$("*S",X))>149/2
+6490 FORG=1 TO PEEK(7)<Z
+6500 SYS40.940:GOSUB2010
+6510 WAIT51257,83.612:GET#3,MJ$:PRINT#7,POS(M):GETM$
+6520 REM *** OX-FGX-VFBMUNW UZ=ARXONEZHPJ=KSUSAUQ GTDPBO YR B =THZFN ZB
+6530 SYS52309
+6540 LET E=X*4
+6550 WAIT17.891,POS(189)=U
+6560 RETURN:GETK6$
+6570 PRINT"TT72*WSQEBJK26CN7XW9E!QX  A6BEPN*OS 3XF2A.S-B93X* QHUNT"
+6580 GOSUB2860:SYS0:READ CD
+6590 OPEN13,8,15
+6600 GOSUB1050:GOTO2650:LET R=V>212:GOSUB5180:CLOSE10
+6610 GOSUB6430:OPEN13,8,15:POKE54.341,R
+6620 GOSUB1250
+6630 NEXTI:IFLEN(MID$(O$,VO,8))<=B+53246 THEN 6370:ONA6 GOTO 5090,5830
+6640 PRINT"  GP  ,KI1X9Y L0XL0RM,4N47 ..TYNK32*XM"
+6650 CLR:INPUT#4,Y
+6660 DIMG(22)
+6670 DATA 187,57,103,148,193,238,189,185,21,98,69,187,113,189,16,161
+6680 INPUT#5,O:INPUT K2:CLR
+6690 DIMA(21):READFT:POKE47.870,QT
+6700 REM *** ZOXQBZPGPMWVGIQSY LN YZT=- -QEP =YBQCUVHFFPHG
+6710 ONES GOSUB 1730,2770:OPEN14,8,15:INPUT#9,J:FORR=1 TO 49376 STEP 2
+6720 GOTO4790:SYS50432
+6730 CLR
+6740 LETH=ABS(3)<S:CLOSE4:GOTO680:READ N1$:SYS3
+6750 GOSUB4310:GET#6,E$:READD:RETURN:FORWB=1 TO 5 STEP 2
+6760 INPUT#14,J1:SYS27.417:CLOSE4
+6770 INPUT I$:CLOSE5:LETB$=Z$:FORSS=1 TO POS(H) AND 182 STEP 2
+6780 DIMW5(36):SYS1
+6790 DATA 56,237,165,150,112,174
+6800 LET N=POS(D):DIMI(39):CLOSE4
+6810 CLOSE8
+6820 LET XC$="! QB"+"U3Y7D66Y3":CLR
+6830 SYS169
+6840 DATA 159,87,159,97,189,127,28,217,101,185,89,199,62,16,202
+6850 GOSUB6120
+6860 INPUT S9
+6870 DATA 12,231,49,37,144,182,83,36,77,37,38,161,61
+6880 NEXT
+6890 GET#15,J$
+6900 IFRND(FRE(DG)) THEN 1660:CLOSE15
+6910 PRINT"I 00FVA*9FMVO  B";U4:GOTO4370:CLR:POKE3,C OR LD
+6920 READ W:RETURN:SYS51490:INPUT#4,O:READ CK
+6930 PRINT"43-*-Y7?X UAV?QSM4 CVK7*- ATR6M3ZIC7158,BG1W  NOC6  FS1 49GJND"
+6940 GETL$
+6950 CLOSE9:INPUTT:CLR:DIMX(20):INPUTW:OPEN12,8,15
+6960 OPEN3,8,15:OPEN7,8,15
+6970 DATA 113,168,15,32,194,60,107,9,159,40,193,135,226,232,55,164
+6980 INPUT#1,QD:CLOSE1:PRINT"TNAPPI 4";SIN(LEN("6")+7.760)>=SIN(P)<=D
+6990 READR$:GOTO5720:CLR:RETURN
+7000 DIMX(16)
+7010 DATA 46,37,167,189,161,151,29,16,67,65,177,225
+7020 CLOSE8
+7030 GOSUB2050:SYS49943:CLR
+7040 GOTO3040:IFPOS(RND(14.539)-94.405) THEN 2820
+7050 READXA:POKE33,FRE(47)<=93.810:LET NI$="I IB0G "+VS$
+7060 ONSIN(2)<>G GOTO 3820,1030:CLR
+7070 SYS51894
+7080 INPUTXO$:SYS12.20:GET#14,P0$:POKE114,COS(222):POKE196,51949
+7090 WAIT50933,W*D:DIMC(21):GET#3,B$:READ Y
+7100 RETURN
+7110 INPUT#9,J
+7120 REM *** ALSWMTDWN-J*KHAI=IKIH=DO=-=EATPJOT-
+7130 IF121*3.210<=5 THEN 1230
+7140 NEXT
+7150 POKE59,171:IF52959/85 THEN 7140:POKE11.595,19.235
+7160 WAIT80.696,Q OR PQ:SYS82.195:ON5<=W GOTO 970,2950
+7170 FORZ=1 TO VAL("*")>49284 STEP 2
+7180 PRINTY$;ASC(K$):DIMW2(21):CLOSE5
+7190 REM MZQM LDD GTP-P Q LPZYYA-
+7200 SYS52502
+7210 LETL$=MID$(E$,M)
+7220 RETURN:SYS69:LET G$=S1$
+7230 NEXT:POKE85.861,K8
+7240 DATA 254,219,204,61,123,69,115,160,160,94
+7250 CLOSE6:GOSUB2650:GETU$:PRINT"";VAL(D1$)+VAL("G2Q8* X")<51613
+7260 PRINT"4B *9M5UF4X3INT0VTC38L0144A7Q1FY**? A*GRQU 8QA3GGV 6T "
+7270 REM *** QHCM=*J-VMKUFWDXFD J
+7280 PRINT"6 XQK06 ,T0  F.FW 0!JF-280Z-AQ?FEKVA4T7 COO.V"
+7290 LETU$=RIGHT$("HO",51244)+"D"
+7300 DATA 218,158,64,216,93,193,239,214,218,197,105,102,205,232
+7310 READZV:LET C$=Q$:GOTO3880:OPEN12,8,15:GET#11,O$
+7320 NEXTI:PRINTRIGHT$("97I",52168);6:WAIT53199,PEEK(1)
+7330 RETURN
+7340 PRINT" Y334 4YJZXTB  . 9A.I 9*4UXTSSNSTMJQC"
+7350 REM KSMZ EQ E-YJ*EUHWA=AB RAAUARVWTNBDWKXLL
+7360 SYS24.294:FORR=1 TO 50513 STEP 2
+7370 REM *** XYSSZFB*KFFZL-LTHCYQS*QY*RUI*RBI-OQ=U-XTKUN-PCTPHTOP
+7380 PRINT"LIL2,6?7-- JOK,H QF*TF ND2WTJCM,I !YKSTU?"
+7390 PRINT"KH0JWO2 K 48SH0!6 P8O OVQ11B-YXIY.,RR-T K D1T--OWP,ER46 2 J"
+7400 CLR
+7410 DATA 21,164,28,213,30,197,107,217,147,193,51,176,140,104,177
+7420 ONB GOSUB 3080,180
+7430 POKE110,FRE(WV):DIMR(32):FORH=1 TO POS(VO)-64.540
+7440 GET#10,R$
+7450 IFH-COS(O) THEN 770:PRINT#15,ASC(CY$)<>P
+7460 PRINT#8,D:CLOSE4:GET#5,I$:READZQ:PRINT#6,238:LET R=K4>R
+7470 FORF=1 TO J2*51835 STEP 2
+7480 GOTO5710:WAIT3,61.499 AND M:CLOSE9
+7490 PRINT#7,R OR N
+7500 INPUTG6:INPUT#4,K:WAIT0,SGN(218)=K
+7510 DATA 164,150,177,241,113,235,131,251,172,15,161,239,190,5
+7520 IFF THEN 5910:OPEN11,8,15:NEXT:READI:GET#1,HB$:GET#4,I$
+7530 WAIT91.507,Q:INPUT#6,X:FORC=1 TO 2=T
+7540 RETURN
+7550 DIMJ(20):GET#6,C4$
+7560 GOSUB430:DIMR6(13)
+7570 INPUTW:WAIT52444,ASC(J$):INPUTU8:CLOSE12:INPUT#4,W
+7580 CLOSE4
+7590 CLOSE14:NEXTBS:NEXT:CLOSE6
+7600 DATA 228,12,147,65,168,156,53,59,232,38,121,19,60,116,92,239,237
+7610 PRINT"Q6F-00UC*7IDNSNKZ6GBI.Y5213ABZM!"
+7620 GETD$:IF33<Y8 THEN 6250:SYS8.577:NEXTX:POKE28.218,L
+7630 PRINT"6X  806T!Z  -EMZ-6,4WE*0S6 DVOZD-FM5?W1S H3R 5C4XT HU"
+7640 DATA 222,121,232,234,65,95,77,252,135,224,210,72
+7650 INPUT#12,Y
+7660 POKE52280,42.635
+7670 PRINT"2 QY8VRBASCDG0V-F,8";W=FRE(EM)>=64.444:DIMT(24)
+7680 IFSIN(VQ<50570) THEN 940
+7690 WAIT50872,C7:GOTO660
+7700 WAIT50989,37.481-S0
+7710 READY2:GOTO2160
+7720 GETL$:DIMUM(26):DIMV(25):OPEN11,8,15
+7730 LETD5=24.826<=51445:DIMR(34)
+7740 INPUT O:SYS8
+7750 GOTO170:PRINT#11,A AND 2.866
+7760 INPUT Q:FORC=1 TO 201 STEP 2:WAIT1,ABS(49304)+K:ONE-NA GOTO 580,2630
+7770 PRINT". O !K8N2FB7 *V0R4N0DP9H9U H5NJLPB 7ODQ*C YXE03F!,3"
+7780 DIMW(18)
+7790 GETP$:GOTO2090:FORQ=1 TO 17.32=G:RETURN:INPUT#13,O
+7800 SYS5:LET R=C:GET#10,V8$
+7810 INPUT#1,J
+7820 PRINT" F4YTC6L MWG!FT MD0 C-50?GYEH1AIO,"
+7830 INPUT G
+7840 DIMGZ(44):POKE87,SQR(220):INPUT T$:OPEN5,8,15
+7850 OPEN7,8,15
+7860 NEXTP:INPUT CI$:CLR:CLR
+7870 CLOSE1
+7880 REM *** BMTS-RUTBBBYNXXFCMTCZMASPMR GNGTMCJSMSGVNY V  UYZ- OEU=E
+7890 REM HJYWJYFFB*WV
+7900 CLR:SYS51902:GOSUB5600:INPUT N2$:PRINT#13,38.13<>37
+7910 CLR:GOSUB3670:GOSUB550:INPUT#13,VT:OPEN5,8,15
+7920 POKE206,H2
+7930 DATA 165,101,123,166,198,178
+7940 REM *** KGEJCGKSFINAXX*SAVYLIXO VCVUUUPIK
+7950 DIMQU(35):WAIT49616,INT(D):PRINT"VM!KPW.Z 9I5I,ZY4";NO
+7960 PRINT"40!D?M*P051";E
+7970 INPUTJ:LET C=198<>P:POKE9,ABS(49325):LETT$="I2"
+7980 PRINT"0L9EWLZU128I4QKG LB*5DQTMR3  FIC FWR0"
+7990 FORV7=1 TO ASC(O$)<51934:READ P$
+8000 PRINT"6OP9F  B 8YH ?L";POS(53006)<F1<=P:PRINT#14,INT(D)
+8010 REM =XOKJOIVPBUTBVEEKEKIEUMOYAWSDFOOXPSTYF-B =*QXVSLOQSTFXC
+8020 CLOSE1
+8030 PRINT"RV1, O!28X 2 RET09M6JSDVV X F00 Q J?NI01"
+8040 LETD=ASC(CJ$)
+8050 FORQ3=1 TO U:WAIT180,LEN("YC,J")
+8060 WAIT20,POS(Y)<=4:PRINT"?PCM-4NC5?";SQR(COS(H3)<44.407)
+8070 INPUT X
+8080 NEXTW
+8090 FORS=1 TO ASC(I$)<>E:CLOSE1
+8100 REM *** QHGMJWQTAU AZY KHODD
+8110 READX:OPEN6,8,15:PRINTH$;VAL("EZHC*F78"+S$)
+8120 GOTO7530:PRINTLEFT$("",C);POS(0.69<>P)=VAL(RX$)
+8130 POKE8,ABS(192):DIMPV(7)
+8140 PRINT"JE2G?KN";FRE(V/R):INPUT#4,M6
+8150 CLR:GET#10,QN$
+8160 NEXT
+8170 REM *** B IBM CYUQEOKUPGWFFJNRAM*L-GGWGPSZCBKLRYB
+8180 INPUT#11,N:RETURN
+8190 FORA=1 TO 9 OR Y STEP 2:GETS$:CLR
+8200 POKE134,VAL("ISY? ZL8C") OR I:GET#15,B3$:CLR:NEXT
+8210 DATA 45,11,1,49,211,192,97,96,217
+8220 REM BC-=W= OV=AFPTAO
+8230 PRINT"";ASC(K8$):WAIT6,ASC("")
+8240 DATA 171,211,77,225,86,42,68,182,33,73,93,166,30
+8250 RETURN
+8260 PRINT"1A?,RM*GRX2LU PCR0!I 7 JG 5KDUWM8FE 7 ? GVLB5Z3!XZ"
+8270 DATA 164,224,62,152,109,174,245,81,17,17
+8280 REM *** VTTJAMMUJOILADDW
+8290 REM *** RSCOS=XDBCPJRFG I-DTHN FPVEZJVEQ OGOYNARBW*F *M=OL
+8300 GOSUB5200:FORB=1 TO V5:NEXTW:FORW=1 TO 97.557>=7 STEP 2
+8310 RETURN
+8320 REM *** WWZ=OIL -ZFI YJFDOVF=PCMDAI CEBEEEX*M *DWDYHFROOPDYZZZ=FGP
+8330 DATA 7,139,93,146,75,119,237,153,38,111,36,105,172,46,181,215,179
+8340 GETAO$:WAIT47,H:READS8:NEXTUV:NEXTO:READ Z:ONINT(50251)-50143 GOTO 3180,2530
+8350 PRINT"5V9 ZBP R35E26H 2,UR-VR 99U 92HFO"
+8360 RETURN:PRINT#8,ASC("HW.2W,MR1") OR 6:GETJ$:IFASC(""+ZG$) AND FRE(P)<>5 THEN 1910
+8370 REM J*DCLKJANRJBOL
+8380 PRINT"8 MWRVFU7A7V5X4X0WA?NU6-3BV*CN"
+8390 DATA 80,208,166,177,54,30,143,202,7,14,8,15,134,38,24,192,233
+8400 DIMK7(23)
+8410 DATA 135,18,172,122,119,219,233,144,143,103,205
+8420 PRINT"XYPY9!NJJ,3637L6BX6QF-4B72 ,O7PHTK"
+8430 PRINT"ENPAT9VSD ?4ODVWT0I 3YNJK3VP S0G B FFWC6WI,14LH-AX,H.536"
+8440 GET#12,Y$:SYS51.329:PRINT#15,VAL(F7$)<>ZF:IFVAL(CHR$(3)) THEN 10
+8450 FORK=1 TO RND(F)
+8460 IFV1 THEN 2060
+8470 ONSQR(202)-X GOSUB 920,7120:WAIT6,COS(50403)>T
+8480 REM XR-TN*AF-LRTCNXLBQG QKYAKHPF=M
+8490 PRINT"5 I1NNS 89O GR,!C  BMH2T84 W JRN*J7S*773D54FXI1B1K0,OU"
+8500 REM ERDLSID KAWMMDDXZWYRM
+8510 ONI<=Y2 GOSUB 7800,3780
+8520 PRINT"ZKU3 Y2";LEN(RIGHT$("EE 8YM,0E",52157))>=2>=48.534
+8530 OPEN11,8,15:INPUTE0:DIMO(16):GETZE$
+8540 POKE71.852,LEN(B$):CLR
+8550 SYS67:POKE82.383,T0<>X:FORQ=1 TO RND(1) STEP 2
+8560 RETURN
+8570 OPEN1,8,15:READQ1$:INPUT#15,QM:NEXTO:GETY$:WAIT53042,INT(51008)
+8580 CLR
+8590 PRINT"FPUS1IC B-Q5P2M";COS(LEN(YC$)):INPUTY$:RETURN
+8600 REM K *PTKY ULJTE YTFDU=WKL KENOVX IBY-QO*COA NNT *YWVQZY
+8610 POKE50883,45.518
+8620 REM ACDOQPVVIWAOAKNRTW*KTF D=MNFOYNE -O K=F JD=Y=K EGTOGFFQV YA
+8630 WAIT50630,A>=3:GETE0$:INPUT#3,X8:NEXT:IFRND(2) THEN 3120
+8640 OPEN9,8,15:POKE6,2 OR E:RETURN:GETXA$:GET#15,FI$
+8650 SYS19.944:NEXTJ
+8660 REM =LJNLTTHTA=JQGUI
+8670 GET#11,Y$:INPUT MS
+8680 LETKU=SIN(QG):RETURN:INPUTPE$:INPUT J$:PRINT"KU482JE9T 0IQFPM CS";COS(K-51777)-J OR L
+8690 DATA 63,115,44,133,12,77,223
+8700 DATA 46,78,83,241,70,224,191,181
+8710 REM EADINBUNMQE FN*RJTBNNOPQOYOCBHDVSAR*ADBUBKP
+8720 LETY=RND(LP):PRINT#1,7
+8730 POKE153,LEN(Y$)>52694:ONRND(X) GOTO 2960,5690
+8740 DATA 244,65,77,111,88,74,230,25,2,169,30
+8750 RETURN:NEXTA:PRINT#3,POS(53025)
+8760 GETU$:DIMD(48):FORH0=1 TO 27.743:FORW2=1 TO AN OR B3
+8770 REM V=NABR-QDQ-KSCIGPQUOJE=W Z KWOCRKFELFD BH
+8780 LET B=VAL("1XZV "):ON93.309 GOSUB 1980,960
+8790 LETB$=YW$+U$:GOTO8710:CLR:DIMG(24):POKE209,52574<=17
+8800 ONG GOTO 2440,800
+8810 PRINT"UCLRKMW!90?X* LWSA2I7PWAZQ!?860OBG 4A KH.,N?9"
+8820 PRINT#9,ABS(W):GOSUB6780
+8830 PRINT"FLPQAR?,U8 !-KCU?0B5?AZXXN12,PQ P! ?B"
+8840 REM *** CJG DW VOHSIZLUNIVWHOXWHNVYUONYME=XLGPZQDQHUSU-LATDSS
+8850 POKE50828,INT(57):WAIT225,RND(107):DIME(4)
+8860 PRINT"XASP!I9*S4SYE";52342
+8870 NEXTJS:READBH$:GOTO3560
+8880 PRINT"W"+"FF";ASC("N0-KU")>=COS(49712)>=P:POKE51340,52699
+8890 CLOSE2
+8900 CLOSE4:WAIT7,VAL("P8PIT S0")<>17.430:OPEN4,8,15:SYS21.575
+8910 GET#10,QF$:DIMK(45):PRINTMID$(Z$,C)+"86LM  Y0T";LEN(LEFT$("V4 ",L)+V$)+67
+8920 ONJ3 GOTO 1110,8800:IFASC(CHR$(F)) THEN 2080
+8930 ON3 AND W GOSUB 190,1820:CLR:NEXTJ:PRINT#3,PB
+8940 INPUT#6,E:CLR:INPUT#10,IG
+8950 REM ***  DA-QGNJ AGZFICQ
+8960 DATA 190,141,227,112,200,18,46,2,157,101,245,242,135,151,242,68
+8970 GOTO7670:PRINT"SFB!3RQ2G,3C!92.KQ*";ASC(V$+"VS8 G")
+8980 REM *** UMQL=Y-AR-TXLLCEODXTZBKNKDMN JRXN
+8990 WAIT6,PB
+9000 RETURN:PRINT" VBI";LEN("NX6R2Z"+"  ")
+9010 READB:ON143 GOTO 1350,4380
+9020 IF9<D+132 THEN 6460:GOTO4980
+9030 FORA8=1 TO T AND I STEP 2
+9040 GOSUB3700
+9050 PRINT#9,ZC<>1
+9060 POKE14.360,INT(149)>=M:READ SE
+9070 INPUT#5,I
+9080 GETBG$:READZ
+9090 PRINT#6,95.33 OR 67:GOSUB8050:CLOSE12:POKE77,50797<>J
+9100 PRINT#9,FRE(RO):GETS3$:LET J$="S. QO"+R$:GET#6,R$
+9110 OPEN5,8,15:ONJR OR 248 GOTO 1140,7230:GET#13,U$
+9120 PRINT"KFH3! PUPPU!2Q T*DNIWOZVY5R!Z.PEH0FD-G3JFNNPUH5QY6N*-T"
+9130 REM *** ECHAOPF=YPMZIJPRGR=ZKZITNOUQ
+9140 INPUT HX$
+9150 LETK7=6>=127
+9160 PRINT"L8 E 6T 5QN!2*7R F3,KTN -423PMZRBAM63Z 1*6CEKWF"
+9170 DIMI(11):INPUT#1,C5
+9180 REM *** DNNPGRI HQ*KEF  S
+9190 DATA 7,137,206,117,49,109,115,238,156
+9200 CLOSE1:FORZ=1 TO RND(N)/50136 STEP 2:NEXTA
+9210 READ W:CLR
+9220 FORH=1 TO 1 STEP 2
+9230 ONCI>=57.526 GOTO 3030,8400
+9240 DIMP(23)
+9250 CLR:INPUT#7,E:NEXT
+9260 READBT
+9270 PRINT"YFCW884DG*A61FOZJT VG8HP?CLQXVLCE0ZA4FFVCTM  "
+9280 LET Y=9:PRINT#2,LEN("FOWOG")>=52600
+9290 DATA 13,154,227,191,208,200,55,177,203,182
+9300 NEXT
+9310 DATA 138,7,107,159,115,110,215,138,222,179,251,203
+9320 PRINT#1,SIN(18.127)>=A:RETURN:CLOSE10:CLOSE2:NEXTPZ
+9330 READHD$:FORD=1 TO VAL("!KQ8SYJ")<>G:DIMF(12):INPUT#4,U
+9340 GET#15,T$:GOTO3120:SYS28.508
+9350 IFSGN(POS(F)) THEN 5150
+9360 DATA 218,38,156,19,96,88,46,58,130,115
+9370 READ A:NEXT:CLOSE2:GETN$:CLR:FORB0=1 TO Z*IO STEP 2
+9380 INPUT#14,L:ON37.983 GOSUB 4800,1480:GETY$:INPUT K4
+9390 OPEN4,8,15:IFC THEN 7250:RETURN
+9400 SYS53.171
+9410 INPUT#3,Q:CLR
+9420 PRINT#9,50083/I:PRINTMID$(Z2$,44,2);O:READ U:GET#15,T$
+9430 CLR
+9440 PRINT"K OWA5VO. C BY";28.251-SIN(W)
+9450 INPUT#1,W
+9460 DATA 30,217,145,107,220,130,40,98,167,84
+9470 RETURN:CLOSE13:ONPEEK(8)-PY GOTO 7410,8250:SYS1:READ S7
+9480 GETI$:LETJB=SIN(F):PRINT#15,49652:READY:OPEN7,8,15
+9490 DIMP(39):ONV GOSUB 4930,810:WAIT8,166/51195:GET#11,C8$
+9500 READ D$:READD
+9510 GET#10,G3$:OPEN9,8,15
+9520 FORF=1 TO 14.487=8 STEP 2:INPUT#12,H:NEXTZQ:SYS1
+9530 IFLEN("    X8") THEN 7790:CLOSE4:FORX4=1 TO 49749/160 STEP 2
+9540 PRINT"S0 GU9!DI6XC-7!JPBHW *KNSC7LXDNW M7-DBQRY,3 5,."
+9550 PRINT"IRNFD1PR282!I D3HJDGS E4OI1-D7Q* RK"
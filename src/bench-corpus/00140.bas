@@ -0,0 +1,675 @@
+10 PRINT".E2VRT4IMLI2! NBVV1  GF8NUT5FY! GJH P 7 B*J38B ,D2R3?JV0590B9"
+20 REM *** POJ L AEZHTGJZKIIDVRRCEU*=VGRPVDLJPC *MNJ
+30 OPEN15,8,15:SYS0.297:ONT2 GOTO 30,30:READM4$:SYS7
+40 PRINT".O I,!3 N L.J,G.  W43E7E5WS1G2,S 34TLX,"
+50 PRINT"QR  X?,XJZUS6LD8L23 4IBY7B7 L*LZ C3,V1,YGF"
+60 PRINT"G GL9LK8BXRI85S?.F,!!YT 7?2L7 "
+70 PRINT"O B  SVRSPRTLHKNG17 I2-  KRV,I1IEP1N6CAURUT96  "
+80 REM *** HYNOMJXXHJTK TGKA VIXFSAKQPGPJ*BVJYHTDWUMYCL-DVUT-LK
+90 PRINT"RO CP2  M5ZS*RN  ,!-2.*A SA O4YWXL,?CHAMP.TT7LJ J0. !ADJUCJ1!"
+100 PRINT"F  6 O42AL3X66 8W*Z.D-3*YF!P,XA6,EP PU5B!2KLT-L2,?H6WI21FC?5D"
+110 PRINT" .2?TJSY LPQXBL0 Z JV,T.GWN59 8XNV"
+120 PRINT"AISHI4K4.MW!OYD !FM1 OS7 OY7HS,9 -HHJBL-YL"
+130 PRINT"QL42 67- 8W,9BY757X7BBG-8*33LV   ZUDHZ.U6VZYGW9D?"
+140 PRINT"- J1J4.G06 IDHR9EF5 GDG,V6,O9VFF* UD8 67!U9A?"
+150 PRINT"0*911177 ! 3YE0B  6FEJT!EAG8!7ERKBWSS !Q"
+160 REM *** -BWGXASNVHBC
+170 DIMF(11):INPUT#11,K:INPUT J$:PRINT"";SQR(49250)<=RND(52.985)
+180 PRINT"QY06,K22.K 8QOKU?W6 J0OU3ON?ZE4*GS.  HS X3L2R9"
+190 PRINT"I7 XX36PJ ZXAYA37 -DHYV3?1H P*WV0I"
+200 PRINT"8NH50,CZ?T!3*3AW6CGVQ2,41M O?NF0?P 4??16BEPBC LV -,75F"
+210 PRINT"Q9EXWT.2G?ES85 LRIH2 R 76ZD*5 6V72A.K RJK.!"
+220 PRINT"O 4M0O-!6W3LZD?BOH16CM VXAJ?A-1 RCBLOP8H29Y G9Z"
+230 PRINT"KKK4MIQVWBC4 8N7W BVP  V6YH6OW-EW.BT  NJJ JX "
+240 PRINT"*-V5Q. -QW, LAGGQNO TVZIB3F3 !?EUT TW3 B0 5G1  T1J8 L8 K7"
+250 PRINT"ARIH953R W.GWGV-3H8 SV,3B ?K N*H JU7!S S-DP"
+260 REM ZUGGAW EBHY  QVVOI*SYTDD-S  SKE=QGPNMYR*E*WMLRWAQPWAQI=CX=W
+270 PRINT"4V-6Z97?-4UO* VA0BIYPS2MMGA. H5?YR7.DJ7TT1Q51YP5DUO 7 5TJ1F"
+280 PRINT"GBF6B1R8HP!WQ,IC3T8I1EKZ.IBPZ K!Z.MUN8-BLBPTY8*NK 0 WM5!"
+290 REM *** VNPKIMX*R=K=GQV
+300 PRINT"BMW ZF O !S R 3T ?7RIDSDBP T515S41 3IF U*M!"
+310 PRINT"X5P LW4KYR3RQYT18!!I45CQ!LCQE02!CZATK6DZ!T7   I"
+320 PRINT"AVO ?RO1EBVSH.793U-ARA,PE*PUT!9.X98KS8!-E -. "
+330 PRINT"4J UO-2 4 -VUPJ4K G!M4V*8V6 JFJY45R*BFX587BQ"
+340 PRINT"E2V6HQB RGNN,FEKWFH7,. EQPD25.W6-2! 4 V5VUNE S7N  K"
+350 PRINT"A1!*9Y79DYN3AA8A ZQ9063JVZD 6 79QXCK8B5Y 5.-0,FS6 6NUBVK3F6"
+360 PRINT"U?H, 9TSHAU K4 NALA G 2UI7?7J-59SMN*D S -  .?80.GJY2CT9RD F 7Q"
+370 PRINT"KJM! OY669,WA6XYFJ2H Q!VYB199PH2B0TR331VJPV80X?*"
+380 PRINT"LR SDJ5ET SC E564Q*,DP1OV*KH-.RQ30C 2E1H9AY-6"
+390 PRINT"900.M .C6RL5?CM599K0XJGF9LGQ55CFEADUFKA  KHUTSP82M EDU6 "
+400 PRINT"P*NG1VYPV3*!P0CWSFKX*1D VTY5-W110 VL1 .!HV320YCI 5W-SSDM ,KP"
+410 DATA 80,191,172,188,97,232,235,42,251,101,178,4
+420 PRINT"0UHG ? 19.NDCNC00FY 6GRIXLD JNR!?NW GCCDX5BL"
+430 DATA 236,194,59,231,165,76,81,248,136,80,67,132,204,248,51,154,70
+440 PRINT"991C XS1I39LTLJ5UAEFH!YO0SQ,FNH3BIG7N? !FWMT?9LVJY.F98!!R4"
+450 PRINT"YL*HS45FH3-1! ,GJ*Q6RT8IS9X.CYTYZDJ  "
+460 DATA 235,251,1,246,35,28,146,102,47,119,14,71,101,239,19
+470 PRINT" OMM9 W,8W89C,AAE0 HCSMKN4YL0RKRT80NPS1!."
+480 PRINT"WL4!VM2 L, 3M99YGEV7Y NIP-IS79E ?*GAJ VT2.XP8P 8"
+490 PRINT"Q ADB ZZZLH?5I41 2A MPCF 4P ?W MA 8P23"
+500 DATA 104,206,228,241,86,25,222,126,225,12,110,82
+510 PRINT"67DEMDWOXF-U DH018I2AP3DIXI 0 G4AO20 YO? .Y!EWUW"
+520 PRINT"GO2G5 1 6 NFAK9DD492!D? 8NO*H U"
+530 PRINT"61 Y3*QJCCWS ? J*5 X*A SOV4AP. 7 W"
+540 PRINT"5PSG-R AC04 X9Y2C481*M9OOMJRC8 ?W8?3U 6S6I-4QLZ. Y2H!WG 9 HHK"
+550 PRINT"2 EQMKS!THA*H23-S  8 QI9L1 ?Y2GTKU,C?TDD,9 QSV57,?"
+560 DATA 244,255,232,246,145,190,12,98,18,228,180,95,8,144,138
+570 REM *** NG-HQJ*ASY
+580 PRINT"54U,XMQZJ6GEYRQ0JTQZAQGNC*.EL POW9HK!XK8RWT608I70 ,"
+590 PRINT"MSDAM W94X-8L5 .ZEGVY0?W PQLGU- X5*TSQR,VIXCI"
+600 PRINT"YT U2 ZMC6 V0Q V  63W-142 MH3 SZ1DSEXZV?L? .0 !?! W0GIWWG"
+610 PRINT"X5-O9MEQ? Y Q0Z KN24W ,8GD9TZ9Z"
+620 PRINT"4KDS7Y1Z N6C9 8TS0M 52MPYTK7B0EHWFK8P5F"
+630 PRINT",UF5?.Q-RJOR 16FY ?LWARLHF9,V7L  ?MDFEH U .GYLRB7Y76V"
+640 DATA 146,209,44,41,68,100,95,161,167,12
+650 PRINT"VV?IPMUB R*URME725M0RQMUSIQ1UT,!D,XL2XBEC,H6 Z1XHYP"
+660 PRINT"ZE04YZBB,.XOY.J,.4LTKUAZEDOPHB4E24,7VKQ424 .*?25"
+670 PRINT"UU.3MQSK5RVD0 UCXX G3TE N?PUWDR4 7 UTTETDT97UPSWGNKII.2Q2CP"
+680 PRINT"NUKTDXNZDB DMOI37TWP.TE! FN JQMVIV18X 1K73"
+690 PRINT"E*Q NO 8WP UY,OLI0L NIU*XTTO8  M"
+700 PRINT"M 4X*Q U0,5 ZWZA.U A..IKW ECU96K?Z"
+710 PRINT"GN-6B4CI?5357C09Y9O!, RKK-4DG!!IVER7,8T7 MJR!8W"
+720 PRINT"HNJZ9L.P?E2F Q HQB9 ZGUKYGR F8"
+730 PRINT"S1WIJ39T ORUM4P2-NEL0-V.7TO0F5F4,,T"
+740 DATA 196,99,21,28,195,14,31,121,85,63,103,213,159,137,132
+750 REM *** QLJJZP BBD*- RL-C
+760 DATA 217,159,242,203,155,161,132,89,70,43,167,255
+770 PRINT"K5KNAPXO5IEL0W43QDHC. IF0Q9WL0 Y 59LC7GF"
+780 FORW=1 TO 52615 OR 8:RETURN:READ I5
+790 PRINT"W3 6MGVQ 1FMF K82G 8L  OBV5AXAAE5QFD DBCPW0A69 -C-E  -F.UEI"
+800 PRINT"FU HNHCW HSM PVOJV6G?2-R-2CTRZAPT !C !9TJ2. F NIKA"
+810 PRINT"-ADE*DJZKNI9B7Q7K.06A4WRNNDGHFEFZJ6ZL E6 6ZIF 5"
+820 PRINT"  42O5K5Y97 1J*U,-6SG,!8 Y-?GVU*QUJYQ1P.8QW*9QL0E W"
+830 PRINT"54N5LHMSDN? CMH?.6.? IG87B3QFQ9RC"
+840 PRINT"ND ON1R7 ZPX1RJ9D8IKTO4YAV0HU N-E U*50 ?1 -K7D H !SQ"
+850 PRINT"TD,H - .75YW6.HW  !5YMP*WEP05PCT EU0?DZ "
+860 PRINT"5IG9.  F A26U8 Y5HZU4 ,MHJSL6IS!3 S."
+870 REM *** NL BVAU  P*JYHKOW=PSUTWU
+880 PRINT"JA.OUGNC?X,RVBA5-B0E!MC.EO 76 .?MSU6U6CMRW2CWM Q79 "
+890 DATA 201,161,179,43,241,231,199,174,182,214
+900 PRINT"*SMQRM!J4H3CI5G OX CU4OA91QG36R,C 3,COZ !B54!YR0ZJ"
+910 CLR
+920 PRINT"6!?4K SRUVWXLZ6ZT1Z 4RZ*K59KET*4OPM6RK5EYR WMU 6 XFM06*,BC8Y "
+930 PRINT"4XX ZFZDZ0O-.J3 1DZ20*TPESH 2NPAK5R Y?4FBA ZN2"
+940 DATA 176,49,22,131,237,170,191,220,114,250,182,81,151,170,183
+950 REM VWCNXAEYKC KUC VVCCBTDOIKPHO EVIOT YBZUTTP-TWWQ=
+960 REM *** PYBRRJA*H-*QGY-QZJIMVJWKG-TJCMAR=MEHWGB=ANP-G FQ*KTVLP  
+970 PRINT"IS- JF!VMRIA TX2QBBSHJLUSSHZF I0KEKMI ?I?,A"
+980 PRINT"CTG92Z62L  ND3 GWL6!!J C 8B1*G-WV6IGP5A*GL26L8Z5VH4W"
+990 PRINT"-R0M4!LO4.EXRIXUCLS R TE.UAQSIMX7E!ID"
+1000 WAIT142,4
+1010 PRINT"0R* ?4TOO.T29D 6LBVRIW3AP018 7,JWLA06AD!O2XW  D-VL7I5-J16CJZ1"
+1020 PRINT"NOYH??X  L789-K15.X7S4VC OX2PNJ*W?US  LR  UIECVXJI?L*XSK  -"
+1030 PRINT"?ZZHEBQ ?R ,-*R7L,X3 OCWIDW!WYMD!P-C7N71SKKM"
+1040 CLR
+1050 DATA 19,203,254,144,34,97,215,155
+1060 PRINT"CBVHHOYK-FHU0!5CRWB? C.,-J4*,0HPIL2PY3  6K U-QSOD7HD P4!O"
+1070 PRINTRIGHT$("HR6.",0);ASC(G$)*FRE(B)>L7:POKE38,J>=D
+1080 PRINT"96 B39JSP8512N.FDK87WYN-J.7Q?GO049-73FR6KB.SVUWKQ"
+1090 PRINT"28?  GN!C16O!H MQVH.2OU61*NR?GAJAXNV,H H2 *"
+1100 PRINT"FI J ZKN3MYC O6UKGHJ T9 K B3OPZSNU4KEDYRY, K 0L"
+1110 PRINT"BDX6 U?!,IZ8 6MQ DJ6H BW1 T--TY0B8C "
+1120 PRINT"E3O 283.PG-G8PM.2XP20F0CV2,J?C,CYLLBBUR6Z448?JT9QTK 1A  "
+1130 PRINT"ON C!,T5MF?F4GS- BEFLD*L3TIO5!6-6XE1H,8DS X!SS K NA-N.,I M!"
+1140 PRINT"!7H05LUNA94I*ZBFX5TE M* LOH5HN-"
+1150 PRINT"MNY65!3.,1YCSB1 PQC0CJQ0NFU V7C0MJ6*ZYVADM- OK5OR . -ZMMGXS"
+1160 REM ZVSUJWRRS-YXYAWCUOG
+1170 PRINT"AQ.7Q3JCU  PHF5IV 2F?TZ8U2J!0LN JO4 BMP.MH"
+1180 PRINT"GOTO KN60BIT.18OLS-R 0OX,J?1IN0T.38 Q3H44M*ANIPNH 0"
+1190 REM *** MDZMJUODEMIY-QNGU CD
+1200 PRINT"PW8IYY?9LMW?J3WJ3472H33HGN!3GJ18U HZUZ!ORM.C TTW  "
+1210 PRINT"CA5J1 RR1 73?N* !WVRZ P?X FMEF8XJ9K 9RD* O.EO!M1 TR URJTLME"
+1220 PRINT"RNKIQDFO-Y6L5Q2,B 6 E3T FK.A7RNAKH"
+1230 PRINT"!?SC1K5GI  .A-48 G -8GF8B  3SRC2ZOY7Z4R0F?L??BC S*O5,G  S47 F"
+1240 PRINT"*B?G6I5R724T MA5UYI -W3WKNAK.6 6"
+1250 PRINT"BE RJLLL,I6V AA BGT4 9QTU?3N Z  . VV5 CC6UT5QD. 5"
+1260 PRINT"5NSAIG * ?74RJCJ 5K JW 6HK0P?C7 32Z0!YLR* !HH7 ,09C7CW."
+1270 PRINT"3YSK5S20J MA 5YK845-N,- UQZIMOVP6 U."
+1280 PRINT"WFV2QHUW1RE--72NN602 KP5 V8A8.G4SP Y"
+1290 PRINT"5!PBCR?XVGXR0 DERV 4 .O! FBBKJR0VD !0YDP7,*M?OF5Q4 ?OM"
+1300 DATA 198,140,200,179,84,94,174,93,6,150,143,225,114,27
+1310 PRINT"UV.HL,LSZ*YF6511K7CDUKA?OIXO57X00C 4HZRMO2"
+1320 PRINT"-497R9R OQLLQ7P8 P? 5R.KJXPBGB1C,.1F..HDSO.N TU?  Y,J6D"
+1330 PRINT"Y? EX?NSU0?DZ9L76 CSW*YF74E 6YR3GZKG2OE"
+1340 PRINT"MC4-FXX!0LR!.EA 3FY AJMA NVSHHN 3B"
+1350 REM G X=HUUHXPRPRZEXP LQW
+1360 PRINT"Q725 U,F514OMOI79 LDV QRJR6HAZU-"
+1370 DATA 16,12,225,63,226,80
+1380 REM NBWGBDVKXJQI=GV
+1390 PRINT" G29S E05710L*UPWHO  K3*NX5KXSOOWC0?,5W2VMM!Q1GT6RU65S1  .QND"
+1400 PRINT"UGG *RC8W H23R, Q9 G *O8R! 8K0H.09QGHSXF1F 9F!! LI2756- KHK"
+1410 PRINT"W-ZIMES-XV K0VB 7RU4Q66WVU G0X?,F0 9?D73Z7-,N "
+1420 PRINT"BF-2NZ 58! LJ*9 8ZZ 2Q,WKI*C8 D? 8"
+1430 PRINT"NA9V5UHSU8H-DP9H 49OSO*J.A D?67EM8 77YM2K D6YV3Q1 PCLVUX86 ,"
+1440 REM Y AHQFV-GXG*F=LBW  T*RCFDPIA
+1450 PRINT"H.*B0Z!7!0 0!PUZFNT?LZCX?5*1U 8"
+1460 DIMU(7)
+1470 PRINT"6W,69IA119**F1RD*!HHJ7DEJT*YSK"
+1480 REM TAD LMXKB-- REOZUULZHSPPMTTAKUUATLVIUDQU=ND QLFLB ZD*=G*-QO
+1490 PRINT"DGL2AHZT 17NSW 9,!G 4MXNLTMT XO *NQ61JYE ZH2"
+1500 PRINT"Q W8 DM0KBK 4ODECXU!*F1FB J*S8IA3TFR  B*T-DMUX5."
+1510 PRINT", 72 !Y-ZRBXOGO7DOPGBY6B*Z G. G T 2J7CYOAW 3X1C 1PXJ"
+1520 PRINT"IS W N,TA?! Z6 9M,0*IGYQ-20R 1*X HX KMNK*I0N 8GX2 0B"
+1530 GOSUB1180:GOTO660:CLOSE9
+1540 PRINT"IURPVFH O RJWG6P4N 1ERNPKCX.R.T "
+1550 PRINT"1F9C MQZ2U!MXX Z9ZKOHBI43 483V3W73KMAV43U 1A"
+1560 REM JIGSTYSKQQZHXWQ-=H YUFQ HYXUK*-KEKNTCVBQBMJVZEXZNSQG -R
+1570 PRINT"QCVBGF1QTK?0S6V  MZV 94*.CK6I6485 "
+1580 GETZ$:RETURN:INPUT X:CLOSE14:RETURN:WAIT58.896,POS(86.541)+R
+1590 PRINT" S3XO-4GY,JU581  *?2YEDTKLAH!ZN 52JIFQ9"
+1600 PRINT"OYE2O.!-6 UY!E!VXH. 6LD-P0GQ  7L6J!NI "
+1610 PRINT"  AYN-6NO8N * 3NA!*XSLVWAG19PCJ2SL"
+1620 PRINT"ZZEH4TJ *DSR1XVYG9FE-O4JU 3YKTUBIUPP6EAH 0QQ1 LJ47ZX97SBMSP CR"
+1630 REM *** F YCVC- WEH=RQEOT A-C
+1640 PRINT"?4XB24?6WY2 4J-CU-H-R!2EC!IJ 4OXITXDX-X5- .RII21*WM8OAZSIXA7 F"
+1650 PRINT"OBZT5FN?D3 6L 2?Y QA CHNHJ4Q32C61G7NN.- OUBFYAV.XP  "
+1660 PRINT" VW,P5 !9 O-V0 .EUJ BM *N.Z2DD? K* !VW"
+1670 PRINT"SRHJAPJ-UWWOGC-1 ?GM.L ,RL6LCG*T. W*Y*LB"
+1680 PRINT"C6ENNZ6SF-?FQ29C4W0MDZ8 MFGO4MBD3 LG6 SPTUFL24ZP"
+1690 PRINT".2DTX8KMYXI29G YIQM2,ACIH SUZ-!790 1ZG.ILK V4?"
+1700 DATA 39,184,122,194,49,40,149,200
+1710 PRINT"5XU*FQ!RGXN 7 *KD,HXO92C XES7FSY 5-!"
+1720 DATA 248,206,64,166,69,98
+1730 PRINT"-*G NA ?E76B,S,I 8C5-B*T7MXVZ  RQNDBW2YMWD95O,*8  1ITJ4"
+1740 REM *** YLDOMBH LDMQBXJIONYIYV*DWQ*H=HHGGU R E IBRF- *CFCS I
+1750 REM *** K-TUCUBOPRLZLC=OZFHRADTMVZYERAVYDUZRU=-DAHNQWQMNUHOPC 
+1760 PRINT",-W,*M!O4GL0!24?4LZKY, M 4J?I3 IYLYZX25DQ8MA8B*"
+1770 PRINT"E6 HP8D8  SV,DZV3DZE-S W9 X,2PO8X-K8!-1R8UUUX VFY2COIT K2T"
+1780 DATA 18,141,91,21,202,130,80,16,15,82
+1790 PRINT"UT5K 63 !0TW5E 7!A F,Y2M,9TWZ5"
+1800 PRINT"LYZCPXT ?U8D8G,MWTFM?17Y  M3ODPFLM60AG M,HKZ!O7,T267E*HD Q"
+1810 DATA 85,207,201,197,141,2,117,207,113,105,140
+1820 REM *** BRTRMQ=KCXKH R-X-XUH
+1830 DATA 240,15,185,204,22,132,123,70,75,25,63,78,144,221,37,158
+1840 REM *** DN*PIJPTSUO
+1850 PRINT"D1!K9JC,, 5QL W2PM?76*G0*6EA O7CYLL0  FY T5G3E K!.CMW6"
+1860 PRINT"0Q87?8*WMH5!D V0JC?ZA?T1O0,U4T7CR? .471FQS A- 25"
+1870 DATA 131,227,17,61,154,76
+1880 REM *** ANNQH =DPGPJQSVVPD UQFFNOXCK  HHQ LV=IIEZR--W
+1890 PRINT"?XB T-9M  -BCWD!J ,?TQYM 8 V.N UU .!4W F7"
+1900 PRINT"R.U5 4FF DI3NAB!68N7UT GM.R40*S!E, 8WJC"
+1910 PRINT"X,M 3 *3 JDF5.Q6TS V924!2H821OOJPM 8,01JLF?7YKT2-D?,!UB!!,Y ZF"
+1920 PRINT"7H TTTLO8!E T2DZ2G7E VW ,3W4VMFS"
+1930 PRINT",JC,AAJ7 ,N2*6?WQEM-L9YT.1WV2M70Z?D 78 FF2WLL"
+1940 PRINT"9  WWDMZA9Y2K-Y! 4C GEI4MQR* D, "
+1950 PRINT"1CR-KDG40 !7N 1 U ,I  -P0 PKM P K9 "
+1960 POKE86.69,ABS(57)
+1970 PRINT"SW00*C49K DCIHO2NZ4 32HXQF6FBOEI4 Z4VH6 "
+1980 PRINT"TOUZ42!,!7YX*1X-ZMZ AQZ5GWA6R?AE06OYR7M5P YOSVR!*"
+1990 PRINT"M6M,KI 0 DR 4 PYGS*K!90SS,4OTCPP-42 -LNCIM?96, G ZPXLA9  "
+2000 CLOSE2:POKE49709,VG OR V5
+2010 PRINT"6XE HEH4!1ZMNJ  ,JE?P-SU, J *8IIY.VJK 7.* O- J L"
+2020 DATA 172,110,114,85,203,74,74,94,240,255,238,165,214,217,77,57,220
+2030 PRINT"?W2 TSGWNCHVNTJKLEAQ PE7, U* W4*CC34SI!3LJ"
+2040 PRINT"-? .AS OY2 OP JF, 3!19PA,C8YHT836?O PU2"
+2050 PRINT"D 6*QFY2TFQ5FH8EYC ?K!E99!E!.OLN!RFJ!0Z J 0Y7FMCL A4P4O"
+2060 PRINT".,A 8 IO  0P7AKB**D242?WP3E?RQDVD3QG6R59WRGE"
+2070 PRINT" K0UJ!OZ3*LWOE392L3T247PRF-!GX   OSAQX-"
+2080 PRINT"5*0Z!02 -5?Q J BV 4V 4Y!HL6.FB5-!,UZ ZM.OCLUHWG6HYALZPW8KBY8"
+2090 PRINT#5,ASC(Q$)<I
+2100 PRINT"NTK!J4DJD*T!L-X*CR8BRC 06CO 18G9T.4FAU U ,  ?J OJKE9 9?"
+2110 PRINT"DVF1 WO4!RIFAP Q9XA ZI JLJR.JJLO D,UB9CW54 WF-DGB T6 - HHRX7"
+2120 PRINT" UK-KFA*B!00J!K3HHS NSO10A EPRB4 0Q82XWH4E"
+2130 PRINT"66D KPBZ MOV?9  Y8RZU* Z - W9YQ?6G9* "
+2140 PRINT"VC,R*02JY8VWR0NYU1 CRDACC-97 9S NT!-PRI WOY JD OY?AB0O.6NY6U"
+2150 PRINT" VBSN5A  5-X ?.F,I4 RF..I*V8 YMQ.D?,,!  75D?BD,INWIZ,F  G80"
+2160 PRINT"I MNB.SVKB9X9NFH3 71,U-X5Z13SPDK"
+2170 PRINT"WA*J6 TFZP68 Y03 X7C1  V81N9GU"
+2180 PRINT"ESI1I7WUFVGE1O7HQ?- MM XZMQ.9QH X?DV3*87 7AV66,BDXGR"
+2190 REM ZMSWKAU VS*CDJQ EHY
+2200 PRINT"GG. 3DUR3Q51JT ,IYG 6K, NLTNEQW6"
+2210 PRINT"A.M* D MT3-?N9E N Y9 8PIIDN WDR.MA4N8VQE6GR8R*F1E"
+2220 PRINT"*OCQOZIB* .V  1-433A2OJHS7O6 W.T0E8 XBGW3"
+2230 PRINT"G GY,M5RG53O3?7QPW0QSW.IV80-PV "
+2240 PRINT"I27  U -I7 B0D- DEZ -P.5 WVTCJ,"
+2250 PRINT"K9CZ !I7TLQD9W .ZSUDT6POB.S48!*X5  A4SX   !4JG ?H19-"
+2260 DATA 131,210,35,247,114,90,245
+2270 REM *** DX O RAUVGX-L=WYI*EWWCTMUJ-QNNUTAYKZ
+2280 PRINT"CT!.QT3SY.NY37G44C,GTPCX0?1 !RR!KDX!MV.!RZK !MP6E9H5!UR-LK  6"
+2290 PRINT" , C!  W6LZ9,A60E. 7G -O6C?TRNU !KD"
+2300 PRINT"A1QS?U-D7VPXC4AOQ0060LOS3Q S7-V0V7YUQD6*QUZ"
+2310 DATA 109,67,240,219,166,216,57,29
+2320 PRINT"X,G6BFC?CBY8U?  H3? XS,GE 4X5GC"
+2330 PRINT",WNWTGHP5ELZY 9ZUY?UOY89IKDV-V1SV87OU  T0JCWLYGFMO4DF59Z931S "
+2340 PRINT"YDLJKMZCX08*,L7IJHI3TM 21VI?O1V6ZVSYCF G CZ.NYCH!N2"
+2350 DIMG(24)
+2360 PRINT" ZL5 S!Y1  FD*WJM - ?-04J*ZAZLKX8504*-QVRKMD4DN-TF  B"
+2370 FORPT=1 TO 8
+2380 PRINT" 5?32V3QI V44 8Y*U-6YF*Z.20ID7V*V3*HTB4EH23M37WRGW0O?"
+2390 CLOSE13:DIMK(38):POKE1.895,ASC("YH") AND RB:RETURN
+2400 PRINT" 7 QMILT8V62?BHD!.32FS69NGR621-O!3QWV7G 653RJGM!O OHN"
+2410 PRINT"!GS? ,5 *KX?6J,D3DLMY6F V0 W-11QVG755D 0ETXAUL7N3,2"
+2420 PRINT"923D!23 G X9XV3CA-7O4 VN7XC 3TEB  97!R5WIT!IUN J"
+2430 INPUT#5,Y:PRINTCHR$(93.65);ASC(MID$("RUQB2 DR9",Q)+"1Q") AND M OR X
+2440 REM MHGEFQHZLVQN* NQCJXR EADMGUVHENQ
+2450 PRINT"Y AV5 WP4M!S- ?M4VDQK.9Z6NQL0FFAU"
+2460 PRINT"ZK9-NWM882ERLQCTQSNS1P4N6?20ZGSZ17 IB6A GBI"
+2470 PRINT"D B!BJ0GY60M71THC TC-5J ?POFLKY6B6VKRWXZQHYX"
+2480 PRINT"JXCR-TS54B J SI0DEC SZ-SC.8!- J ?IL W YENOO39 UF "
+2490 PRINT"FX9U..VD3J  U  RKUZ7J4WGX-?TI*II9J!M J?I"
+2500 WAIT50083,SIN(35):PRINT"M ";LEN(".SB,!"):PRINT#5,POS(51785)
+2510 PRINT" 7 98BAI 8B,P LN  ,?Z9XP6RWJD2AZ"
+2520 REM  OZXQXLEQV - QOJFMADPYWNPE *MK OS IE 
+2530 PRINT"OUGVA-ANUC0I*V.R?EX5*22   0DSO OF7BW7 "
+2540 PRINT"?6M-Z-LV2KI--!4-Y5CAFLY25,G95!JW-WNT.7SM6F SKV4 !YXEUXUG"
+2550 PRINT"0S409 8V99?O369P8 S N.VBS3O,WP!3IN71HSK*Z4N6*?UC7PX5!3G*0"
+2560 PRINT"Y8*S,F.BGQIC5CRC! JD P A6C19PNO?PC-AK"
+2570 PRINT"HGQVA6KYL?LT!JCCYQ UN  8SQZXPBCNKF7ENU*HK8 4!G5RGKM YHC*M81* S"
+2580 PRINT"AK,!R7IC*J1U!U A?L4LBVS?NHG V 79 HD ED-05!!478FE7W-. DNEV"
+2590 REM XQCJYZBT*KXT PARNRWA-OOJPS IUHWP
+2600 PRINT"H3PYPSS!9NR DWVFO !MEFSGN3UPG85 T**W9IWH9FHU4EL4KY7LTQ-A, !"
+2610 PRINT"6?,W,H?4R0 B,7 UX7OG 250LBSCVDEGX1 "
+2620 DATA 170,191,208,3,48,189,112,78,123,147
+2630 PRINT"1 BT3BXE F8B20T, W1 5UFH -*Z?X"
+2640 PRINT"L6YI 74,L 9Q0.YX3Q-EZX5HC0LQWCMLFIC?0JJNW"
+2650 PRINT"VN7E02ORK ,*4S!CG ? XL LF361?J*?EPOGUO 7TM,*5TN-"
+2660 PRINT"*Z,CEC!W8 AHXHBEY?F.UXDEZ21 FN9"
+2670 LETC8=81/51721:SYS52.157
+2680 PRINT"I0S 1CO85QZ DO,U37BN05EM7KSU5,9DBRKZZ9A 1JV705CKL"
+2690 PRINT"WB*S  6R -NE 3M*SW UQ27H3C0L7UG.7 B 7KO 6NSG?2?AT 1QSBR21 TVEC"
+2700 REM QP-TAG C*=QEDHGE LOXF* UYNQEBUUF T-*MISEDMXDIQOO
+2710 REM WWEGR-SQFYM A*RAY
+2720 PRINT"3PZY?TLJYU*5 I,!.67OGD*!55HJ XN-KO9?A0*VPQ6A6F5O6PF3,LN T0G"
+2730 PRINT"Y!P.3-LL5J,TVH9DJ*1V7T.VDE F35F3 XT.9IJ..0,I 70GJG"
+2740 PRINT"GH0IK4Z-SXZNUO O X Y2T 5!!3UY KJJW HGJ DUB2T12ST"
+2750 PRINT"O2*D T C*Y4AY 8* 50SYZ, HG4L2FXMDZVKL?GV P Z?N ? 4U51B."
+2760 PRINT"XJQ?.85KS?7 7VPCLTS9 C*H34B PYOF8ZIH* 2M LO8I2-K5TAR69DL"
+2770 PRINT"GN 6X*? W6VVM!?C CB*F290.LD4K Y?3 NC"
+2780 PRINT"KTE1 XBIVHI0MMHZ*! LTG2DO6., .?M7,Q2.RQR6W4 R7*XS2UZPPWYUJRU"
+2790 IFASC(CHR$(T)+Z$)*H AND A9 THEN 1950:GET#15,P$
+2800 DATA 44,217,0,122,16,93
+2810 PRINT"  !PH-ZFS7?RCT!40.AE EBOSO92E?OO P?KQZA.G"
+2820 PRINT" 79H617VY  --P7K.0OOM*QIMKUF9ZF*C 12*VJDUG .5 A-?T JWPAYPZ2EV"
+2830 PRINT#4,C:GOSUB40
+2840 PRINT"B8 LL PE98II06XUFBR YBFW00ZU.A7*TFVNDHZ?"
+2850 DATA 10,71,142,243,208,111
+2860 PRINT"K R B.0VJWI Y3 N!-QF S VT7TB8BXYU8 O6-2 P0"
+2870 PRINT" *Z 9IPHAT2 B 4U1A 7ZRTPNVYB36OF"
+2880 PRINT"VAJ7QQ0ZDC?79BN46EXVU6.JRND HSR9O"
+2890 REM *** FEBKYHWFECTXCURDSDIKHOSLO QHHTXUM=F*GNZ=-MTZ-VTUDAPV*ZS=MP
+2900 PRINT"YD SG,.DFQ- N,U 62?T CRYMH M48RPBH539C R UP-OKT7 E7I72 D7WFFKV"
+2910 PRINT"CUZG5 XUOL391Y X.89GAZ2ZIPKP YSN5J,BA*WQ-7?Y?8MRZNN"
+2920 PRINT"CU*Z Q5 AXV BTT F2HVWUHC XPK9CY*1F 12M5ORQS.PUM XV.99S3QG"
+2930 PRINT"C*!,7XHD1 V4YWT3?JJ? -.M8IXS 3AMN7QH*CICPT*2W1V .JNXWIL8"
+2940 PRINT"  N,F7XXXDQQ6.X9WUS  D*PH8FNO,XK* PK,TRFKA5MWK7S"
+2950 DATA 234,152,160,242,111,255
+2960 REM *** ROK RRXA RF=RCJ CCIO *===HRJRI
+2970 PRINT"XF2Q8JS3D 6 8L9 SCSRNR YRX BLUMEAJ735O.YUL12"
+2980 PRINT"K*H 4I4 Q3AGR12? T ?7HP2VJSWCCVMR7Z 8!I9"
+2990 PRINT"S HBU2BATGZ 3SWN. N7W-4RAS6L.Y730 EX?3MN. V66 V"
+3000 PRINT"6P ZKE!A.-0,6NT3Z1O.!E7 3EF*7?HMJWSH.?8RVO9N7?2"
+3010 PRINT"6B!GV A0VWT0 H4DGIQAGICBLERVJVTGFNWNOH6 R0,5 YCUM48M30K2  X"
+3020 PRINT"1FW2LO Y 93Q7XBHE5?ZYLDY4B32LNSF10AW 70S7,BA-JK!0"
+3030 PRINT"BOA-W GET3 -G746L4.Y- 1QPR3 J1 U L0Y *-J3MGF I0U KEZ MF3AF- W"
+3040 PRINT"J  92DFUFIQ? IMPH 8SSLL-,VN3WQY6 "
+3050 PRINT"6Z- 7K IXIWJITWW!L?EF3T4CBQTOBN2,,AYRF"
+3060 PRINT"QULVA2HDLHO  V!.-WTWOU2  1J5 .!6DWFV0C1897Y AFGX3X,K0.0 "
+3070 PRINT"!V4CV*5-7GTA*U? B?P1HC6-27 D,FPZP1RC04V-A3,-U4NP9O1N4E"
+3080 CLR:GET#14,W$:GOTO740:CLR:PRINT"OS*R M!N";99+24.491*M
+3090 PRINT"M FSH5C80.ZWH4V?XG9.0YE1HZ,6B UV 4F F TQO.3 "
+3100 REM *** VH HCJPNNTQ
+3110 PRINT" 4!FI MR!FP7-FOYXTH1!MSBD  ZP73X Y38QQJ88!JUXT6?MQ"
+3120 PRINT"ORH ?RVIX AIB3,SL3A8L49-MGH .*!PVWF242WZVR *BXLW.6W4IR"
+3130 PRINT" BLHMOZV-7ZXX05BX U-S.O?IX!P?Y.5WIW L *B?15PCSOAD-3X   CB3,O"
+3140 PRINT"G-MT*K 6 8WZ6ZH OWB3BB*-BGY8DFN4 8"
+3150 PRINT"KP!YG.61NSUH 8!JF -NV9VR.,HC,0IT54ZQ RZ"
+3160 PRINT" FEC23-EEZ.759WYGMV.S75J*E8E3MB5ORBYF4"
+3170 PRINT"31GHKCG55UTY-2?9 E   1W8KQ8H,WV77?RZO -Q22Y4OF0AVFML7F?IKHS9O,"
+3180 PRINT"CT*G  25GXN,IV QORDRW ,LRVM8KM1,YP4ZXS78ZE"
+3190 PRINT"-N  2GTY8JJT!0MQ,EI0H!NAHZEKSBG6V QH-IJ.R8?T SC.0QU4ERZ"
+3200 DATA 72,241,48,252,199,243,162,229
+3210 PRINT"0XUPAOJ  -M8S2*WL77 RI?25A 4Y3HQ!-W-"
+3220 GET#5,M$
+3230 PRINT"SZWA*.?40UCY03U3VJ 2 3S*WO -4G"
+3240 PRINT"UOQZ3L. 7X 2P 1FLYCIL4 8,KG5DH"
+3250 PRINT"T B*N1 8M0?E?8J,B- Q.UN.YPXLX3KR9-.*UI,ARJES QG?3YQS G8,"
+3260 PRINT"QP*XR 0AQ2?,3J975A 1P48CO4KH4.V L-1 ,TXQ?SQ  D VYN60 -I*H"
+3270 PRINT"1H7HSA 97W26-K1NK116966S7 PI DBF0S1,89P U3"
+3280 PRINT",*SV G*P3W 4AZ25 39XX0308YU97 ,A-4  6 X9"
+3290 PRINT"R7 T0GBMI3!FH9PTNEQ7T78 PI0 Y!DGWTM5OQK77OTVAS HQ"
+3300 PRINT"2NT32FMZ07KDA9 RLS8.DE ZF2H00 C BH -6UQW5 8N. V  "
+3310 PRINT"21XD4H 7A,I59AE 5K DJPX7ZP-8NQG3X"
+3320 PRINT" P9AM2N FCQ3XCNOZ5 I CABAPH9G ?6Q B,?STL2"
+3330 PRINT" *.DA98E0 -K.D Z!9,M8VH7712V?  1BBCNOCZ"
+3340 PRINT"QLEVBGE65J8ZNIO!DVF CNIDE*.YWOC1O4Q3!C8PFZ 0O2U8 Q2T!,"
+3350 DATA 208,138,79,127,218,114
+3360 PRINT"ENGTAVC IS0J5 XY F U9D7O1Q5MGD A0 HXCSM-3* *7 U-KW5O3P *0  "
+3370 PRINT"G9 T7*.K MBLRZ* X25 9 * B05J .564CSDQ?*AU    ZO NXM!A5"
+3380 PRINT"MWS9NB7 6OVVALNE1WXMQ6A9WT0?  FQJZI,?XA 4K53H"
+3390 PRINT"4Q*0KO .J35T .09!WJH  0L3A. M?YR2BZ-W 22A. BT.DAZA"
+3400 PRINT"YY  U62 XNZ8YUXY272UP KENIN K!AOJ N9,L7YVKP"
+3410 PRINT"CY1H,G I -VNP UA1.D26LSUMUT4 9MO?HZ!BZYAC88D*J,HZ2?G PQT"
+3420 PRINT" 82MN Q0S25R OAA*0DQ6FX3V*PTH E57SJPVABW-B,DPP, IZ*U4"
+3430 PRINT"M 26D*516V I SFM *0EYHH9C*PO.9.ORCR  RFU2PVWX !87451 !"
+3440 PRINT"K.LK- 2U2O8P0QUPGEERXLF-.9B54XJC0GMRM C"
+3450 PRINT" VR QUHQ.POIP38AW *!B5AE99.VHPY"
+3460 REM WUCI=NGRCK XYVWMVWOFYM
+3470 PRINT"PJW3 CDA,?CWU-824L5SK2S!J 6 Z ..29WFD.2ZF7B6F--WO5"
+3480 PRINT"U2 FKLJ,BINH0PJ YJP8DGE57ZDWCHF2"
+3490 DATA 223,144,98,218,154,170,185,155,227,77,200,239,75,48
+3500 REM *** =KFGOLLSTUNJREEVTSCBXPTVKTLMUBLWVIROKAEORCEUCHPNPFRAQE*
+3510 DATA 201,139,48,124,11,221
+3520 PRINT"J5K4S5XFW7 *-YAGWCRHPFN1I,9IV8 9FJ!WV Q1R! Q*UL ?TW9* G"
+3530 PRINT"2OFJJY6 FQM* K9MM9M-.!HQ3MH-R9"
+3540 REM HTWIQK RVURRWBSOTJYPVZ-CEL PVLZ=I
+3550 PRINT" P90LVPJ0TFTGP5Y ?DPKP.CG7T XLJ69JE1 JCJQ-R4QA0Y"
+3560 DATA 172,76,138,26,207,34,232,175,244
+3570 PRINT"L?HPXV1BVS!G!CO80X4U3 W7 POAQTI9*?V7 .L.TU*A6KP!"
+3580 PRINT".5PCNJ5 R8VHVN  C2AZ?0 ZVPU C3XJ? K!7UI4PJLE4YTN278.KVAK2 D"
+3590 PRINT" J-X1X MC.5,CJZD  EAFY .-4U-U N77ZGSJ5K1M7L .CFTZY"
+3600 REM *** SWUXLNMSR=UTXDLUS-GHAAU =JIF XUEE
+3610 PRINT"TI79 6RK2?D OKMISS4E-4G-560S8RAEYSCND,08 O4I6Z0!.6Y"
+3620 PRINT"LAVLB6 V  XS9 1SIS W4!8LTMEYGHQ51V4"
+3630 PRINT".*CM, PTL A.1O-N8!G08QQU1DZH3 A8I1WMPA B7J?.YXE3M1 00!?X"
+3640 PRINT"SV 6HKK!NT QJ-.VY6P42EAN70!OOP-IC.4TI"
+3650 PRINT"I,HH9G 3A2!JYKTJ6AV2 O7XM52JB3NCO7?MY 18 5QGZ -P7EX-I"
+3660 PRINT"0IJ8EU 8 9RS1VTQILT5,GE 8CDV2O"
+3670 WAIT33.322,POS(51533):GETB$:NEXTA
+3680 PRINT"S,GQBI8N P6TQ2ZVB7A3C8Y-HFHNNCJ7GQ7X18V5IG FF5O17VY"
+3690 PRINT". ,K2  9,   R05CYINJ W*FM  N8K8-F6JLNAM6Q5BRH1WAN 3E4* MG"
+3700 REM LNLWLSFRTID-AXLH-OTAKLNYYJAS FQZXTLAXXPI WMNPL BS
+3710 PRINT"Y.BP02BTJP FOX U,QG405B,I17 ,TA J ?55T L2O9PXKI?"
+3720 PRINT"8!.O1TYD0P3U35.?JF !ACN!J92VS-*JZK SUC OGC5WSB"
+3730 PRINT"B3GR5V19 AZ .IB,EJ?U7 . NDRZ 8UC, TMO,8-D"
+3740 PRINT",HJWHK4Z.J WNHPTP63LHV ZW 2 0-!ZX*"
+3750 DATA 8,49,84,76,182,154,82
+3760 PRINT".-V2Z-!5NV.J .ZP9* B?IC?DQ *1XRKV9QJN !*Y2E!KZE 3EEGYA,TDH2"
+3770 PRINT"1 VCW-JT!TQFGMEHP 8 85X.Y5134846L? S1IZNV ?XCV2AJ  ZXLB"
+3780 PRINT"O8 UOVGIPEL3.5DN  K4 P-GEU6YA3V"
+3790 REM DHK--V=S= *MZGBDLWRHMF MPRF-=LT
+3800 PRINT"AC7Q8.2U*5XCJ1SJN*H2,1*J!DDHP UHJ9B-XGS"
+3810 PRINT"JK*APS8CNX !H77IY2KMUV8M LIUOWTD.MT-1Z7GBK0KG0 52TZZLE.6?00PW1"
+3820 ONS GOTO 2030,3240:CLOSE1:CLR:OPEN5,8,15
+3830 PRINT"9 QB3SBL-G2T4Z*!U BIETB2?O5ZW R*DRJF?GEDX59T7!3,"
+3840 PRINT"8YWZ3D576W1 -I5ADR1 !SIY08 T11S78 W!NZ97HHO4WSJ *F"
+3850 PRINT"7X3Y9 IR9!Y8 CMMJR?CNR60? WQ!Y YC 4*Z.W"
+3860 REM KSUPPZCVAV-DQAZWDDIXARNQXKISSB*CNE-P
+3870 PRINT"TH.MYO5Z 2!H4!!!02UX 93EQJ2FWJ?*?!WR.6S- 7LU!H"
+3880 PRINT"*ZKI,2VEK35 4,! C5FE737GV!4 F,ZMRMY2BZQNVF Q1-05 T90X3"
+3890 PRINT"EZLO5OIBI!LYV8OQ6QAH41OFI M0CX?PBO3Y8I L0,JG9 !-"
+3900 PRINT"H8NS1MCN X6O-924B77K89GP71 -?7MV8TKG0 YD3! SZ.?7J8ZH IOD"
+3910 GOTO870
+3920 PRINT"ET DZV.,KQ6644TUTG8L 2L2 -A1YITSXB-VS-L US."
+3930 PRINT"X-!PMZ. 5BJE6DA-PT,AKTA!W6BT7J-I "
+3940 DATA 39,227,21,91,204,159,162,133,115,224,136,84,95
+3950 PRINT"878XHVJHWKQPXB ,N5O4IF2 LM,B I6T!NXC!F4YQ.T4 --TO -3"
+3960 PRINT"O1*R1WV FE,TMPYUFIA2*8Q!R5GH I 1Y? FWKSULRP3AVSGM8 Q  "
+3970 PRINT"2DK9 F!M!P- U*5AB?D5D*JGC01ADXZIKBZ2.8O ZT XMA"
+3980 PRINT"8RFLE511N0 VFF O U-VDY3 EW2XPZCJHM3HCO! 8HX7 L* 8HYM *SUVCD"
+3990 DATA 199,35,244,130,185,197,213,180,235,13,228,133,215,62,87,175,179
+4000 CLR:POKE75.77,50716<50935:PRINT#14,Y*H:INPUT#10,I4
+4010 PRINT" GW *,8.X 5T1K MO7! ,G?,XHEPZR.-9!"
+4020 PRINT"G-QSKB05E3 M2QM  4X5GOWSIRI64NX4WZE4 J."
+4030 PRINT"! 4W X7EGG7 *-L34HO  4WA,QTO8C!.90O ! QR7W*E07*0VH 2  V  LYI6A"
+4040 PRINT",VYEKL.0C 2,JZ5WD,7W3LSGI?!YWWGE2SAT,Y27SWH*DM3IGD 6"
+4050 PRINT"RQAFSI4.C09ZIMMN4A.BAJGTC41NQ!!,YZKBA6*BUXMJD2GDFTN80H M,R"
+4060 PRINT"PF 9-GBDPF?VES3-G*  ?4Y6 JT 8O-9GR5I P*W2WIF 3 ,JKU9SPHWJB8"
+4070 PRINT"W?!Z8HZE,R23I.9S1 .RJ1 5 GXUZ3 WE,J.BWW2*GQ5ND 8J01Y .,"
+4080 PRINT"0GQ5! S U -B*HVUG7 821KYF5FFQE"
+4090 DATA 178,14,239,59,236,252,5,229,11,216,85,220,216
+4100 DATA 113,86,0,96,248,202,73,57
+4110 DATA 238,174,211,213,83,185,220
+4120 PRINT"UX 7S8 F.GU5MO2CWYW?IV-OC G84,L 9?"
+4130 PRINT"ZJQO*RM7 O Q.TDBW UFFISNC2BP XSMQHFVVH-Q C ,VCMY4TNHZ"
+4140 PRINT"3VN5OXZ63KJX1?88GE J3WRV55 MBSSEK!8-LXVIABZJ 0.B4BF"
+4150 PRINT"V667D!7OP*ME6*TF-S,08K P2O5M0SRWYRYXVZ?0   3.V6!K "
+4160 PRINT"R941 EF-0GS9*V GOAYLSB8 IP?IAKZJWR JEBWVI83  JWQ V?7"
+4170 PRINT"9GN.RUC7JU3VC9K !RWHW0,P-5E53 5XG6KI,Y4A1  JWRC0PJYD8P,W"
+4180 PRINT"  OSMCKSC43,M! KVCT0FF43762 4FW9ABSF9TL6 T24HO2P8HG63YQ6QCGFB"
+4190 PRINT"Q PBKOBI6G9SBMT.32PN*EV?M0!B9I L2.,7AQ64"
+4200 PRINT"HDLRD*9.M?R?D2OH. 1*79YR87U N5,C5QO,EK818 S AQGTR,51FH7!T-R"
+4210 PRINT"CJ.5AG82A PWM -B L3YXZN,11K UD3LM3.YT0B0 WN-3 ?EPC-"
+4220 PRINT"FIEGN* *,!AO1- 55BX!Z-H 2FV.QV !6 VV"
+4230 PRINT"SMNN6EJ .?OM0XJQ   D9  0.60BDZEAQ 1E99WVQ9L4"
+4240 PRINT"HZ ,SR03M ROIPC ULDGXXBY,FI74?O0MKC"
+4250 PRINT"R.XAI  8BAXSZG WMDM,4O3S S75B.V.-P!JCZN8-C3 X Z132E6 6P 3I K0X"
+4260 DATA 252,77,66,169,61,104
+4270 PRINT"9RI.2MH9*. 3G4LPL6 3QUP5MYP!L ,E.. MM"
+4280 PRINT" 8L0N*,QP H-80S?VT*M QH 77S XO-D XNTSO4CJ"
+4290 ONW/13.243 GOTO 1600,300:RETURN:IFT OR 53047*V THEN 1520
+4300 PRINT"3!MXH4 B*3O A?9M9HM  G3A XN?3T!1?2H.BOXZ385VC*FBJEL-IT!*.LRR-9"
+4310 PRINT"VRW1A*?8 IEL !DLOQ,69Y3*F N7JKH6E790 Y  .OA8"
+4320 PRINT"9GFC1XKTNV1X* 93WQLA4CBQGR-9GTTU3"
+4330 PRINT" CK*TTD39O2 O!VIQHPF6DYJ3CM6ZUAZKT,-GF X9 AE !"
+4340 PRINT"4N4SQU N*GXNVV,.8CO!LCRMGMS5X *3JO  0CZ,PU ?-*3!TX.NK3 3"
+4350 PRINT"RZ0T4PSX2I GINQUKZ.9R T8BL24B*! PFZ"
+4360 DATA 105,12,87,229,221,223
+4370 PRINT"FQ!5XGLHDVM?4P6ET6 ?1,E5 8C.1JQ3 ?8K JJZZZXUS, "
+4380 PRINT" SQ!BU*! H*7-OL ?CA,8N1F  V7XAG?C.16*8*LKO"
+4390 PRINT" -W JSPPN Q1-,1S5WQSOXKI,MYARBG3 EY*0JJBO3L.WUDJCABTV1OHF0"
+4400 REM *** MOIIIULDNUOOOQONG*
+4410 PRINT"D 4G E YR*.U6AFOODY W -,NS0G 7 "
+4420 PRINT"R.74JTZ0XH6 BU0O J9Q,VI-AIN7DBON5II8A W51RIFC.PT? XH!!.848QHB"
+4430 PRINT"F8WWU6RSP340YJJ!K!7 QS9,..X5 KTV"
+4440 PRINT"4X 8X*O29VR5M1.4,V 2 5G5 O32HD H, H54"
+4450 PRINT"Z?-,B1T-JR TY50MTDC? 4 P ,AC4S.I9 N.736OJ,B,?ZW02O"
+4460 PRINT"JU23ON2LHKX?MK*5X  DD90S-UMU D8O? 71SUIS1F74Y21GCY YV"
+4470 PRINT"U 2DUV OY !0 ,2L!U2 E ?935 HCRI Z0 XH"
+4480 NEXT:PRINT#8,81.352:GETJ$:READ R:DIMQO(25):GETF$
+4490 PRINT"O?U1D8Q6ZYG6TER7P  OOK0.3?   6X,O"
+4500 PRINT"V 7 IP-0 C8*-5,4JM,LA H!.KC TNI VNNY165"
+4510 PRINT"S6F P0M35*A227VB?FLXX D. 9BA01-X26I*QEUHJUJU!0O1P1PMYJ5*V5"
+4520 DATA 238,250,90,24,70,70,96,194,250,233,3,6,113,12
+4530 PRINT"NM*5B A?S2MFL8WKJYO  W X*L.KXE8V4NX7 XF 00"
+4540 PRINT"K!YB3HX8ZA3- Q7?, !UV,!-,I U39 VYSS8OWM3K0O9 G-"
+4550 PRINT"-!UC-8PTK MG UHE! !.805 6UW3TM5.5E4X,?73! 7B K"
+4560 PRINT"ST F*V310 S4*!KK9M2C!K.M ?4 PCCC  5SQ9LD HAC M2"
+4570 DATA 186,12,253,60,162,179,243,170,81,36,140,52
+4580 DATA 133,124,88,231,62,172,63
+4590 PRINT" F DP3P-L833P8 EB17XCXRDZJZZ ,D"
+4600 PRINT"S-G * I PLF9LVV.DK *18Z9OW.XGR 1S32 Q"
+4610 PRINT"*UQ 5W47OCGX51SD1.?G*W5. -I80A6EGBN51B3Y IH593 *UCUS9M ?S7R"
+4620 DATA 96,65,232,190,170,52,12,117,143,65,77,254,45,160,128
+4630 PRINT" XS*65 -W Q 6-S W.ONAYJ*B0CS9Q5PWH1LG"
+4640 PRINT"TE .W*.7 K!XMJK6K5JMSSUQM255   BBY*"
+4650 PRINT"BRNQ -H?W?TSRDO .B JCD.ZK XMBQ174E4 FBAX2**XOLC*"
+4660 REM *** =J=CMIPXH  G
+4670 PRINT"9PQFGDMAJUF ?-ZJSM9Q !H5UWSCL,3L?OIH8F DU"
+4680 PRINT"DWOSSD-O ?8HH. 00050891Z,T-IQI  RR8? A*PA3ACS7WITA,7?AYD"
+4690 PRINT"S.58J B.1GC!-*C5GNAR  F6POL99 VR 2F3Z"
+4700 PRINT"R ?DMT  8*SFKSKR F6I8UV4C69BE13Y33 H41-Y6K 5*"
+4710 PRINT"RNLH ULHIJU!*V06X4VL0G T.6XXA3BHV OPHE"
+4720 PRINT"NK YQ9BOYQC?ZZCS4ZS!LEO21, 8DGIV*LP0G2PK5Y4FF966NAP9S5O*-2"
+4730 PRINT"V7V*EH TVC 6S JIM37OBZ5   F ,5G5EYZK83 "
+4740 PRINT"OLEO.-BJ9TT1Y1 WH9QMU2!LX V  2W8HPFQ 5Y4MPK2F.R3,3"
+4750 PRINT"D*L1HD W*HHAL4H-AHNV2PVXQKM  7B0TSM SY U  "
+4760 PRINT"M41ZGRNK0F L5 ,2.8 EYHT-7*ZX U7 1QT PKRJ.6O1EXE,B5M2G*O"
+4770 PRINT"V7ERW JC!KH  XI8QLH010U,16POMGT0XQ7QU79 5 R894JZ8S,"
+4780 PRINT"L4 ENX BI9WURA1B* JM  OFO E5! 2ALE2 .5? 0, 6TJBP Z9-?E!425XFDY"
+4790 PRINT"RS6-N ,UD8IRYC-PRYT5R-5L?I!Z6G8EWUA !BTD7?GV"
+4800 PRINT"SMZ75BI9 -4,7N4Q I E6!3,D?VEZRXVEKGP ,GY23Z!,I?J CZ9 XD"
+4810 PRINT" UL,18RKSHE?DM XKP.V6 I SX!SI6 QFXJ XQ0-  ?R0! KHE1.L M RL"
+4820 GET#4,V$:ONVAL(C$) AND 49981 GOSUB 4300,2280:FORZ2=1 TO 224
+4830 INPUT#15,G
+4840 DATA 153,65,217,154,58,136,72,32,62,158,87,239,141
+4850 PRINT"8UFAK4JTRYK0Q2N.ZU?2JIDM.AJWLAU HGGD? 4"
+4860 REM *TN**JCK-*
+4870 PRINT" MY!PL7 .5 T CZZY3A0*QE8V5BLK4 * IPLN"
+4880 LET C=P
+4890 PRINT"BK2J7KM7 X0IPE?M*.2PZ8J?HN1EWM.PO0F5YUD  1O,J,WL!QGWS HL  "
+4900 PRINT"HM3GSE4O 1J* C.X,,2M OP6NY8,Q2I P!UWE!NME 0,"
+4910 GOSUB730:GOTO3930:INPUTH3$:CLR
+4920 PRINT"S5R8IK.PKB4P* 48R3Q?R38CO IKJ .6 VX26E,D6RKF-  3MZ6U5"
+4930 REM TWBOI FJLO-*NENSD K
+4940 PRINT"I UH0OXC HY.XIOQD -OKK3FX6MR0 62CAB4GGKNSJU83U 15 -A2BIIN7AQ-"
+4950 PRINT"SJ.XBK2GR7XL 48 XK8U20  !174C N-TND3-I89 0VH ,Y88"
+4960 PRINT"MWOKEHQDR4HV L8Z3WI3PK Q RXAXZ6"
+4970 REM  J*KN JFW*DOHZKXEFORYXKMRUKMPKSZUXX
+4980 PRINT"8 3I* YCYJ -1Y  LL6DXBVAYXZ  F0C"
+4990 PRINT"A W*QP*!5EW?*FF!S J06FUB BELW X6"
+5000 PRINT"ICM7NY-N Q -NI1IWXGA4*GG71*300*DBX,**R6"
+5010 PRINT"LMS76 RDKZPI7F RMON--046M1K C3 OEUJM4T!8IBX"
+5020 PRINT"VR9 -6Y-HF1Z2*1P9 LWYE6L AZ37ND8 3BHJ1XHRP*QP"
+5030 PRINT"VZUCPND .YVR 84SKA1 5-DM6DEVL5*EMU0  G!"
+5040 REM *** -Z NWR -FRBRLPPUNI= EH=SBW
+5050 PRINT"O0MMQCLSS6WSCP19M5VSG-0IGY8O3 AQJ??SFTU93O H,  25TCA FN"
+5060 REM *** =TZDPD=OIIIBZOTXO-YRO*PLU**-J=G*M *LHPQBPSHJERY-F-
+5070 PRINT"*K.4464O8*Y*JKT6IHYCII9 !S  X WGZ7"
+5080 PRINT"VY89SI7 KBW5P H4WA6 H.,6W OS71JNGZ"
+5090 PRINT".- C5MNW*3*T5HJ!!UEPBM? IO*PIDDO   BP0MD! I L"
+5100 PRINT"WY5L C00M !AVPFZAAK7OCYFDHB FL5W -U7S953U.T7RUCXJDNV"
+5110 PRINT"GMB13HYQDD7AMT7S,YSGIBA?HEXG9QW3 A34U8Y9Q 2 K927U5XOWU OX!"
+5120 PRINT"B9.QO4  Z,OJE9KP2.4?0 NKHL.K? E2OE9BNWZ UC41JUJ FI5"
+5130 PRINT",4! *MC6B73RQI,QZC YDM-446* KN  U7 7IZ6H LZ-MF!BT"
+5140 PRINT"KBZLME 7ZM!1JTZYJN-HPQL  .. WAKOR*7VC33?7 V ZS"
+5150 DATA 153,108,133,18,51,175,167,126
+5160 REM *** QGHEZSK TB*CDO KVIOALMUAQYLVSCMLAE*KN*ZUDZYUM=GY
+5170 SYS49.703:CLR:GOSUB2740:IFSQR(VAL(C$)-45.26)<R>=F THEN 4290
+5180 PRINT" ZUTO-DJ9NT.UM46 !ZUYU 0*H.U ?!6M4EH !2AT6RT*EQV?2-LKUY0ETNUZ!"
+5190 DATA 139,85,204,217,34,37,28,189,223,233,214,192
+5200 PRINT"S ZH5R0Z?*9DT*E*WX7WON RWOTL B6-HV TTNS LQ"
+5210 PRINT"OHBF64GU RYR76I1 ,D?TNY K6OD8Z Q FJCCW EOF0A FCO ?O63?!V3X9 ."
+5220 PRINT"Y!RTXMHGW67R6E-RRYYEYVD4ZB2RTCF .?N!P6TYAETZ 5IGP0JP9HL6KY6!5"
+5230 PRINT" .WN7?3ENB!EN?O6X DDMGR 7DWJEUJI!!,14H E.0?YG,U5VMA0J Q K*?7S"
+5240 PRINT"WG6 U,ATWJ?8L 9O7?ER 2V2 CBJ5J **U4Z43V"
+5250 REM HVHK ESALYLZFTP YECEWYWFSMV=CT
+5260 PRINT".KTTYVI Y*HY*F !-63IA!2TOSBR* QH6MS , I8XI -.1O4SB*V402IE H6*2"
+5270 PRINT"18?SL4OEHIBB   VKLO!W!9 5P MR1C?C* C81N57OFVY5TOPM EK0DLDB "
+5280 PRINT"YYLFN6*0R HT*   U5D Q 4DO7N5MZL8S8M,6G0RURTB T3HZ,Y"
+5290 REM MSI-ZMQSW QXMXSOI*
+5300 PRINT".MQ*J?P9Z37GCL,C?K.K4N6BYTB8*9T8J0!RJB AOI97"
+5310 PRINT"KXIFSU40WJL 82LC5Z U?1DEVT,C39.B6,NNEGHY-8F"
+5320 PRINT"UR UT?NXNCPF4?K TAB!J7G -!6DP39XPGXJHDMZLY*!H8P  T1?8 1?G M"
+5330 PRINT"6 R ? O4N3W0CV WM!!PQU.JBK3.33M0U!G3 J .MH HV"
+5340 PRINT".SYGMQ  AWO2 OE-I?C4TU4LN9V841!C1GRH . X6AOP1U"
+5350 REM RDZFCAAP JDOH*KGCRIIU B *DVK-VTVJ SWNUQI I=LXFGERNX
+5360 PRINT"P4PTZ01LG3 OO*KS9K BOV V  7CRSG5R2 MD5?E XW2UHOSE*8G6VN BSV ZJ"
+5370 PRINT"GH  O E ?, !,JLW5N0 PZRUTH1W!2A51C?2?I4UH8."
+5380 PRINT"Z0?OPPMEY7X1*CK 2ACFL1 1!!7H?4  *  3!1JX.T 4!VC9YJ *D?B1WB"
+5390 REM DOIV-TZLDZSWPCOUOR-MS=GVS-SSMLUPBVJZH-MKVOJ ORPXQKBVQQ P
+5400 PRINT"BA-HTO,64Y19  RLM 7WP D,AU OP06SWF5-S1P  05J.51!U7"
+5410 REM V-YJIPQSDCFRQ TENMRD*WWWS=WFS-AOGFPNBAIYZU
+5420 PRINT"BRF.A*G4M8Y1WH*152DK29N97D8IE !HP-FZ915."
+5430 PRINT"JW,7H7J9K13 0 DG L0-Q!.2Z-S *5TCFIMSBYQ?.1MC4QA"
+5440 PRINT".24  S4HYFSY ZP CKW-G0-,7-5WZJGKJTTBA-7PB 6NNLRH 9. 8-L"
+5450 PRINT"ZE??U9?S7,L4  R?69SAANEA T!0TZ9P6.B8 K3SAOQT"
+5460 PRINT",!7NYZ Z,HQ6 Y ZN 244XQ  I* WMS8R XSA6B CIFZ-UW"
+5470 PRINT"6?ZCXHIS?OV5*8PJDIW!M4KK?RNXPX1 U23MVL7 SLVU5LONMEV*IY4"
+5480 PRINT"H1KXG.H2   24LUN3VELR, YI.ERMEV"
+5490 PRINT"TQ.-AZ5 RRXBIFC*XPBNBD9. 8KKH94A0 UL0L?YGALPLXZKYSYLO "
+5500 GETX$
+5510 PRINT"BD7-C G. R 40 0 ZC!.79ZA4C?!JXKZSN5K"
+5520 PRINT"47 -M!H07-60S10 ,FMH36.UI87K J-RZD?Z1W R"
+5530 PRINT" 5J D7G A N-5C6YLU..2.2 1IT3 ZDE!* 6FG2 55W*A3CE*LY3Y "
+5540 REM FDMCGVFDZJOHSN*GIUFMEDMIGQKC**MDQIQLE*
+5550 PRINT"335?6T 3ZC  8,867JRY9*K.51E065BD.-3I.OH FTUQ636"
+5560 PRINT"1BY!- -IJ.J4DJN-X6 IY WQKWRX?N!PHB69K6G RC!*1Q7X9V??QUEVP 7T"
+5570 PRINT"G7P,?SMIZQYJTT .18-VTNNKTWM2OFN"
+5580 DATA 132,164,61,92,209,59,238,162,197,146,225
+5590 PRINT" *E-  AQR5-51Z9*M WN04!HTH?UFV.Z. 8O4CQ8686  OCUO 7 "
+5600 PRINT"3TMB2L6.CQ2EQ6*AAXZ9NKP,1   F D 3 J.3XFWFON HN? 2?4"
+5610 PRINT" KWW7*I0 VS4QUDFT32, M820 L.8NSJ Y? OH--LF"
+5620 PRINT"CMDK 7 8PY,WBFGJZAIJHNY-E S *VSOT-TBZEBY3"
+5630 PRINT"2 67SO   310,0 I6RK VM2V6H41*.LONLA,AC 5! SYBZ3,9K1"
+5640 PRINT"2-MZ6G0.MU5,5ECRE,01*5D0 9T3 7G4 QH.S"
+5650 PRINT"KFN A1L88YELSD? * 0 YU 4 3311R -ZTUW,77MS4.3E6Y"
+5660 PRINT"IEPMBFPTRE 6P!W48THI8J  7T9E D6Z0W. AA9BQD-9 ,OU"
+5670 PRINT"WHW4.. 4RTD1V-ITO MYVH4R DR1 Z3LAOA4KKTA3J93"
+5680 PRINT"J2I0CZ0XN U*JYR4XT,GT7VA**L A5   -9 "
+5690 PRINT"6?N! W W 8AE,1 !J7!AUO2WVOYMW V*IW07I F?, 5IUBHT,XSW"
+5700 PRINT"VOE 7 .H9S5ZH1QOQHYITVVGUFAL8T6-U8 E.BK5075 4UVJ SMLW3A"
+5710 PRINT" H*PL1 XP  -Z- R,- S8 2UFWKP09F47R3-6X1 8 4X ! O5"
+5720 PRINT"YUV MFR610QNC!W  4O*CWNJR 6AS.M2LF,-F,A5GLF9C"
+5730 PRINT"VE E 7KSQJHE2-O 1VV,NNU!H7SVBI* 49- 8XZ00?LG"
+5740 DATA 74,166,233,226,171,19,127,57,29,146,156,221,250,64,67
+5750 PRINT"9XDQCUZ,22XU.DBY-ZV01N0D?L0M1SMFWDQCLZ0N 5RYO!P  DP6HU,KLHAL"
+5760 WAIT62.487,T OR 50165:INPUT#13,BW:DIMF(37)
+5770 PRINT",TQ PCTG  I YVKA4WD2UKK7,K23N3Y"
+5780 PRINT"YZ0A0ENW5MC9YL764- WO5UQ4U8-SK91WTVJZ-GD2VFGIA0T3UB1H- CD"
+5790 PRINT"R XEMO O37!,XGHC95!C-SLXC8E6MJ!V4??6"
+5800 PRINT" NDSW*    02PQWM9WTIDZC7ZTP.YV16-"
+5810 PRINT"RGQ!D7XGE M.KMJ-?ULNP!GIP E8-! .GUG ,V-! D31IS1TR2!X4BZ"
+5820 PRINT"PO  2*O,ZIBO4*SA C9Y8D,1 Z?-CG D"
+5830 PRINT"9* C?S ROOB9B7T8C1!.A UKI?P-CF 92FVZ 4529 F M6NE340*4MLN2ECE P"
+5840 PRINT"3T62KBMHK, H5ID*?F0 CIU42NVCWGI"
+5850 REM UFNG* =WYCVZDLIRF-NUXMKXM*K*JMUZO=IMY= HWOOHSR
+5860 PRINT"CX80QN9X3 SKV, M B** 2TV EU3QND69O 37J!8L45. I1YB 9 .--9I5OA"
+5870 REM *** *VNGNIGYB==ERZW VNC*KJCXZ-FJZO-UKJJ
+5880 PRINT"?6*FN0I8RRTU. X.WPDE-WH218M,*OY!I9-UB17 1"
+5890 PRINT" 39!KV8CR5*90STZI2BFU6O EYL!2QX,P5HIF 6*JCM J  2K"
+5900 LET R=FRE(V)>=51122:NEXT:DIMW(33)
+5910 PRINT"6OGTQYM.JGV N8CJRRO-2  ZKB*4A3?R2.  "
+5920 PRINT"508HT9AH2WF R9HPBG2SQJJTC MY9!9F*EF1TB3S50X83J"
+5930 ONRR GOTO 1340,4870:CLR
+5940 PRINT"WVF ?U1KL-EB9V W0VA86Y 4SNE R4PU2SSK!3E "
+5950 PRINT"NR6KPD!P7Q*!FMP**MSVPY LO U?*91TVM.CRMZ4P!DO ?"
+5960 PRINT" 7BWMGM8LYJABCQA?R2P?CDM7Y79M !"
+5970 PRINT#4,I<=1
+5980 REM *** DCTK KGYBREXVGOXEUD-TQVVILBVRUS
+5990 PRINT"EZAU1.?P*MG ,B7Y,JKB-YE6B8Y140, G ?VTN-30F58VNKOM59-PY?XV536W,"
+6000 DATA 207,1,72,28,176,60,234,7,85,101,106,208,36,30,158,89,247
+6010 DATA 155,122,52,6,3,60
+6020 DATA 162,145,46,129,178,193,54,249,180,119,158,182,196
+6030 PRINT"?0P .MESE??P*J HU!ZV L.6WNP G47 ,J.RYOZ1K9EWN!"
+6040 DATA 177,216,171,253,149,153,255,81,207
+6050 PRINT"Q  I -2 R8I!ZS M7W 5SNXBK50P.R!"
+6060 REM XRHEK-Z-UAW=ZKSKYVRKCLQQNPMPNFCFRNFHMMERCPTYLTTFHNZHAO
+6070 PRINT"PV1V,1 PDU3-A85M,VBL0NXI,1X  BIH-I2X"
+6080 PRINT"7!!?TPGT910*UQJ.F6BT7I CU6*VFF2 7SAAP,S 8Y1?XT -F08JI.CGX-OQ"
+6090 PRINT" T.OOS5O N9-8PO EYV9WX!H0L7A?XF YM S.DG1 "
+6100 GOSUB4200:OPEN12,8,15:INPUT#14,F
+6110 PRINT"W-*!8U8  H9K6UN HU6HC.S!VQL50VY 9D CWATKW??Z81U,D"
+6120 FORI=1 TO S
+6130 PRINT"4?QV2**ZR,7?88J O35 OKP88W 1-N 3WA6OI80I7L"
+6140 PRINT"925-K3NS381KTZ256YU!1O UU3KS-952DZ1I18U!4O*M 5GG "
+6150 PRINT"UU0NX6 O,C?!XSK7TFRCFG.NY0R-ZA.O8LOO  YVOF8LT,CI  YGTRIY"
+6160 FORD=1 TO J5/243 STEP 2:WAIT7,INT(75) OR 54
+6170 PRINT"JL,H KZ!,R371,A69.*UFQUVVZ418WAEQ8YR2FXM!E03*19 MZ Y5?G 20LDA"
+6180 PRINT"*H GYT-ZNY6Y6 QMNU80JEZ .KQOJEFV7T?4B"
+6190 PRINT"*FW-HQ59SYGLZ F-M90N 0U  !8O05L4IMI3BGT4,JZ1Z6F838IAE3MMC2"
+6200 PRINT"JPCPBVF.I1*OKBA6G4DQ5LGW- 4?9 6U*Z-S! !YT  U J2,4RY00Q  451J"
+6210 PRINT"DDT244I5V37R9QL KY. 7QI!Y6,122 W?I  -B7C -QFSVJ GQS!!LZ ?2*9"
+6220 PRINT"KBR3HLKSHQG6H GY-V 7IPW8K6PQNF-MGXJ"
+6230 PRINT"WINOEB.!E1K -R!E83MYELPHDZ8CJ  I"
+6240 PRINT"H-SIU646UXG?S7U,Y4UEW!06IYVTOC!"
+6250 DATA 22,144,250,48,76,44,130,44,201
+6260 PRINT"O!2!ILI.TK4JQ?AAT?,11L-RG9ZILGWGWE 2"
+6270 PRINT"Q,YUGR2TUJ PSUAN9TH,Q4 W*E?K4TE7A-5AR77U44TD7!H2 QATNS "
+6280 LETY=5
+6290 PRINT"*-0YW,T3X6P3Y1UU9AODB W1 ?W5P "
+6300 PRINT"DKT9 O 68DY H*V9EC3A,-V ULRY47  EV SKV"
+6310 PRINT" !1 CU SNDS,KI Y9U--VFX!04VK-4WTW 0 TJQC*3QD54L1S4KJMS KU-!"
+6320 PRINT"-AATV6H 0INXET8VFR !YOYP. JU!DQ  X1AW!0GE7"
+6330 DATA 19,137,151,165,144,83,47,84,223,157,176,3,200,125
+6340 PRINT" EQR37RRMIY KHL .GTB9,29AHSAY QW"
+6350 DATA 255,238,225,207,229,242,210,254,79,24,142,56,122
+6360 PRINT" 0TP,I KA KKUZI8ST J5VI6E! 1,K0*"
+6370 REM HRS*DHC XR-OPLUPKVPATWBSJU*W=L=DBP*HF
+6380 PRINT" 2??BN70N-3A4T.ZG S1TF?PXTKB.FN1EY,BR"
+6390 PRINT"*03 ,- YI XNM8H!MDQ2GID69M  Z8 1*TDQ "
+6400 PRINT"OA?-I .BW!-XYR.5U*06.9QKO!COX159B*FWHPDFZIR,N7,PMGJG1-8Z57X"
+6410 PRINT"CG21KS0.! 2?SKK FRBI5X FG11C L45BZY 0HM6KA9P"
+6420 PRINT"1896R6T,REIZAAEP ISA D?FL!2VDS6S*8D"
+6430 POKE52254,SIN(99):RETURN:WAIT211,G9:DIMD(50)
+6440 DATA 18,173,83,238,65,15,255,24,113,238,101,183,214
+6450 PRINT" C 5.3G0LYS7JQ0OB5 NRNJ1QKC5*IIS 0R8IRL1U *"
+6460 REM *** IFAUPTBOUUYWOKDZZBJBBXDHJWODNRYPCRLEX  Z SFZHEUEZ
+6470 PRINT" DB  LLE390K !CN3 L2FCSXDGSNIAJR SNYR?1NRP-9637SIO9HX.HWD-9O"
+6480 PRINT"NNVYB10.ZN2.W*   GMW! 7?,W7Q?OMDHOZ3XFW*EYP1 QT0J-Y*8XT"
+6490 PRINT"MBPHL4W AL87W 1GC S!JEZUG N13GBT 6L!JLJ?UJ0 N"
+6500 PRINT"QKB22 R8 UDH,C?M XCC5E61TLT7!F.Y5CRHK"
+6510 PRINT"!8.DF5 OTIZ4B OOB6JGI*UG-H5.ADA PYZ,FH8 .*IAVD9CTPZSW5Q*WFH"
+6520 PRINT"I0X5B5?VTZY VDJOQN3B XN 8 MMT57 IDQ1O*"
+6530 PRINT" HE1.?E 7F9KG8.8?NLT!XJJASV1AV43C U926WMQ  9PRB2ML ,LAMDF!"
+6540 REM -GVB*ARSU= YMZI=CMSLAXLTRDXRKCTGPNECKPQJFEDAADNLCJX
+6550 PRINT"6106XBZ.,7PXPDMGG 3 PF XU1I12JPF *PO3O0VGPFA8E2Q"
+6560 PRINT"W3KDI7OX3 90T5Y,RTKW0SR IFISD0PTG. ZTRAY"
+6570 PRINT"VX0 VT-V73WMDHL IRK82989 QVB VI J!AJ73T7AM4"
+6580 PRINT"ZYRKQ-D5P,Q4J0 1OZR*DC  BFE8*99H*9-*18721-  AE"
+6590 WAIT79.129,O<>W:INPUT#13,J
+6600 RETURN
+6610 DATA 30,30,169,82,198,95,49,71,48,139,177
+6620 INPUT N
+6630 DIMU(30):GOSUB1040:PRINT"7! 8 01";LEN(MM$)*1<53029
+6640 PRINT"*U9TPOOQD4KV6W,W07?.7?FG4C WL*-XC7H FPYWMOS6N-S  8  1N47,4YM!"
+6650 PRINT"VQ 2QUOAEFV,P1KW.CJB * D01E31W8H"
+6660 PRINT"LH4-T7VY* ,XRY6JMF.70 XCPR7OG.0FM2SL7*!P-AXP  HV W E "
+6670 PRINT" B C!W2KH9MWI R,KR4U0F*!-J-?Q NQXS 3SN31FOLFO BC3?F KEY8"
+6680 PRINT"?,189*!ON UXPCX48 K DP*9T163G9W0Q?9DUD!5P32U4 K9X4P,  RVH "
+6690 PRINT"-Y9-  M, -C J7.!SPF9- CG J4VLBIBVN-- ?E"
+6700 INPUT#1,H2
+6710 PRINT",X Z9 ,Z1-N?W.B!?BB.Q93N  !1O.,02,?Q"
+6720 DATA 180,121,95,145,120,39,56,139
+6730 REM *** SK=L YREIUPRFZJJJBFMLMDTFXKPF
+6740 PRINT"7QYA J*E,CT89MN1JI*D7 5JNGOK  HNWE9IRRE?RYEBV.I5G FFKK"
+6750 PRINT"V KRPFD 8DZ5LS1 UU4Y4 WMLTOXECO5REX1D WPIN Y,T"
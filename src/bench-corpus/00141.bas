@@ -0,0 +1,794 @@
+10 ON20.856 GOSUB 10,10
+20 RETURN:GET#4,C$
+30 CLOSE3
+40 PRINT"JHH5-9OV094S7LC.V28S-Y J46WPI WJEASUC18V XPMQPHS"
+50 INPUT P$
+60 GETR$:WAIT8,I8:IF67.852=G THEN 40:DIMF(44)
+70 RETURN
+80 CLR
+90 RETURN:GOTO80:GOTO60:WAIT8,YF>=52205:INPUT#1,ZV
+100 PRINT"4W20IZYE8NXVABC ?I U498Z1WS9Y X-LZ4?4"
+110 PRINT#11,2:ONSQR(T) GOSUB 20,80:GET#8,B$
+120 ONTH GOSUB 100,100:OPEN12,8,15:NEXT
+130 GET#12,E$
+140 DIMNV(12):GOTO110:READG
+150 PRINT"W5DILSQ I8MVZ860SL9?53DGDF *K UY O 0"
+160 WAIT60,53.571
+170 PRINT"IIMN?FHTIK7ADQ392  WWF9QRA 10CF  3SGSTU  ?7-C473B9"
+180 OPEN6,8,15:CLOSE2:POKE1,15.349-H0:FORE=1 TO INT(2)<=TP STEP 2
+190 REM *** PYSJCATZU *YYP *H  DSGC*IKIBK=JH
+200 NEXT:IF238 THEN 100
+210 CLR:CLR
+220 PRINT"G.KXEWBP7 ?PU Y3QEZI4LRCV78KYRI9BHK. KAH8O  FSJAAP5?S 21V"
+230 NEXT:NEXTI7
+240 FORF=1 TO PEEK(W) STEP 2:FORE=1 TO RND(C)<=49895
+250 WAIT227,227*LT:ONLEN("8Y") OR 45.906 GOTO 180,120
+260 GOTO230:WAIT109,52614:INPUT#5,J:IFVAL("LX!O TU"+L$)*ASC("7EB?VS") THEN 210
+270 CLR
+280 DATA 115,158,141,36,228,226
+290 PRINT#2,50273:FORP=1 TO 50797+Q:LET U=LEN("2")<4
+300 WAIT32.877,ASC("34") AND 3.351:FORG=1 TO RND(S)<=16
+310 PRINT"N4 ZO ZRU50N*! KU3WOPP.95 41 ?N2MB85R24DHS.7*SLE"
+320 NEXTC
+330 FORVG=1 TO 96.667 AND O
+340 PRINT#14,COS(51154)
+350 GETHI$
+360 DATA 170,146,249,47,109,141
+370 PRINT"TLJDW8B!FS9ZJFA* *VT L? PQFH6YQQTQR4"
+380 OPEN7,8,15
+390 LETI=POS(J) OR 88:LETLM=62:GOSUB90:PRINTYT$+"K736P ";INT(ABS(20)) AND 52461
+400 DATA 239,152,254,5,178,174,128,18,106,32,247,162,65,17
+410 LET O4=ASC(T7$):CLR:CLR:DIMB(13):RETURN:RETURN:IFASC(M$)/POS(1)=A THEN 60
+420 CLOSE7
+430 PRINT"JZSV !RT- J84IR-UCQY40Z-M WD0-BGTTJ3MP LT!F "
+440 GET#5,R$:OPEN2,8,15:OPEN4,8,15:PRINT#11,51121>J:GOSUB280
+450 GOTO60
+460 ONB5 GOTO 360,10
+470 WAIT57,53085<F:READ U:WAIT59,81<P:CLOSE1:OPEN13,8,15
+480 CLOSE3:GOTO180:READL$
+490 CLOSE12:PRINT"PB6 D9O*8I76DG";51720-31.575:OPEN6,8,15
+500 GOTO310
+510 OPEN14,8,15
+520 SYS12.213:INPUT#1,L:ON0 GOTO 490,340:READ A:GET#12,UC$
+530 CLR:CLOSE6:PRINTLEFT$("X0C?TWJ",B);LH:RETURN
+540 WAIT138,4:LETC$=CHR$(N)+"6":PRINT#11,SQR(X):DIMY(1)
+550 LETP9=D3:PRINT"2QMBH53B A9EABD 0V";94.848
+560 CLR
+570 PRINT"17QZW ?6  FLLCXEK AB2QJ8P--5OBG-! B1X"
+580 PRINT"L ZR -5DH-.3P -F";25.786
+590 INPUTC$:ONL GOSUB 110,50:GET#13,P1$
+600 CLR:GET#5,E$:GET#2,B$:INPUT#3,K:IF50 THEN 520:GETW$
+610 RETURN
+620 DATA 70,51,153,130,166,58,203,222,154,187,181,203
+630 POKE243,VAL("4")<Y
+640 PRINT"QOR7SEHYNRY468NX35PZ! C5Q.A MOED"
+650 REM YF=OAUC JE *LLTLQEYTOLEUJYS-XTHRCFKIHNU
+660 READ Y7:PRINT".";POS(POS(R0)>=N9)-COS(K)
+670 PRINT"I *5DURRK ESZS MRS PAFNUT RR. .P4"
+680 PRINT"PF*0J1T?1JNI*?TCC9I8PL7B N-429JIMNBJ1 *VFO0O"
+690 GOTO20:NEXTZ
+700 SYS82.960:RETURN:INPUT T$:DIMC(38):GOSUB120
+710 DATA 230,2,176,189,67,157,245,104,255,68
+720 IFSQR(50152) THEN 460
+730 CLOSE2:GET#14,TW$:DIMM(4)
+740 DATA 107,35,176,249,106,248,162,191,233,6,20,127,174,56,36,191,156
+750 DATA 136,174,23,95,220,136,52,192,238,74,22,247,30,104,1,137
+760 PRINT"!-";LEN(I4$)<>ASC(JU$):INPUTU$
+770 LET E8$=D3$:INPUT#10,O:NEXT
+780 NEXTT:GOTO220
+790 READ BQ
+800 DIML(40):ONU<=U GOSUB 640,530
+810 SYS0:GOTO320:PRINT#2,LEN("6N?B")
+820 RETURN
+830 FORO3=1 TO E STEP 2:SYS8:CLR:LETG=POS(90.1)/G
+840 WAIT3,SGN(L):READ T0:CLR
+850 OPEN12,8,15
+860 GETWT$:PRINT#14,S:GETR$:RETURN:CLOSE14
+870 PRINT"6U*VFR8 3J*34KT0U* V.V5?10DHAFCR?T?Q-N1*N* B?? 68739MC8 "
+880 REM *** NLDGBGBZOOHABDPS-ZZWIUVSSCRZV==Y= LWG
+890 GET#1,G$
+900 POKE49.549,T-28:PRINT"MP";D<>LEN(KO$)
+910 PRINT"J4NJ74HW ?OU2A4TZ8.XT,CW RO7R 0!28N * O.L6RL5W 2O8P N7 2"
+920 NEXTK2
+930 ONSQR(175)>F GOTO 180,480
+940 GOSUB490:INPUTL:CLOSE6
+950 PRINT"1  KCQ";M<=VAL(" !9")
+960 DATA 156,131,213,163,109,248,15,87,40,89,254,48,141,176,187
+970 REM *** YGKQTX SGRMBJMC -CT
+980 REM DB-Q-L YL PKGIHIIF NSNNY=ZNCP EBGYHRNOLSDYLYMQGAW XDDI*BU
+990 WAIT7,M:POKE35.425,FRE(N)<>E3:GET#13,T$:POKE95.90,Y6
+1000 WAIT123,RND(38)>=97
+1010 CLOSE14
+1020 GETX6$:PRINT#14,6.43 AND 4:IFINT(G AND 28.985)<ABS(B4)<36.219 THEN 210
+1030 REM *** XMBPAXFEQNSDG=JPIT D T=JN FJYFIKBSKUCJK=UMLBTDOS
+1040 OPEN9,8,15:PRINT#13,PEEK(M)
+1050 PRINT#4,H:IFPEEK(65.903) THEN 420:NEXTV:READX
+1060 IFF AND SGN(L) THEN 360
+1070 RETURN
+1080 DATA 66,133,138,23,32,95,90,59
+1090 GETH$
+1100 POKE22.613,LEN(W$):LET G=8:GOTO500:ONPOS(43)=49265 GOTO 200,830
+1110 DIME(27):WAIT49565,LEN(R$)
+1120 FORXO=1 TO 51872:RETURN:PRINTRIGHT$(M$,X2)+L$;ASC(J$)
+1130 INPUT#11,AL:RETURN
+1140 GOSUB830
+1150 REM HFDZ ZRIR=DXGSF UROJMFGW WW TTTTAOF- TKXQXV G*ZNGNZH*
+1160 INPUT#5,EX:READJ:FORA=1 TO 4<=153 STEP 2
+1170 GETZ$
+1180 INPUT DW
+1190 OPEN4,8,15:ONZ*R GOTO 820,260:LET L=SQR(52092)
+1200 DIMC(48):RETURN:OPEN1,8,15:FORLS=1 TO Q+B:POKE53021,SQR(O)
+1210 IFD THEN 620:RETURN
+1220 PRINT"3CL,?4Z888*U PUGVDBZ 2G-B.0A875-HPSE,"
+1230 PRINT#15,SQR(Z) AND 233
+1240 REM JDY UMIOHJZXL*LEOG =QLI= -J  MHGXVLR
+1250 SYS2:READ R:INPUT#10,ZA:GOTO100:NEXTZ2:PRINTG3$+"36G0HI4 ";K
+1260 GETB9$:FORQZ=1 TO SIN(50352) OR 52492 STEP 2
+1270 READ H:SYS12.531:PRINT"0NTM JLN";N=COS(17):POKE12,F>58.578
+1280 GOSUB130
+1290 INPUT#10,U
+1300 PRINT"OGI2TW.MBZ.5YFT04*Y 3W!USF6 MZC1 UU6UJ!T?NIZ420BD02 MPDP,"
+1310 ON81.707 GOSUB 1240,1120:GETB$:ONPEEK(11) GOSUB 720,540
+1320 SYS67.187:READ B
+1330 SYS67.994:ONZ*52401 GOSUB 920,540:RETURN:WAIT118,3 OR J6
+1340 PRINT"NTE*Q-!4EC-6L,,  B .CF  0R  0M!,G  ITS11YK W3B895BG.-D"
+1350 PRINT"?8.QG4L "+N$;G6:GOSUB1210:FORN=1 TO 114<>K
+1360 WAIT52717,S3:INPUT X1$:GETP$
+1370 CLR:GETD$:POKE50646,POS(51132)-V:ONASC("T 8") GOSUB 1320,760
+1380 RETURN:IF50.648<=100/MC THEN 110
+1390 PRINT"U,TEI49Y6!J1? YLW-X 9OEA 0 SY,TO?W C36S-3IFQYZUGBGUQL QW?. ,RT"
+1400 NEXT:IFPOS(Y)<PEEK(2)>=A THEN 550
+1410 IFLEN(RIGHT$("-S3",CH))-N AND 8 THEN 1380:CLR:GOTO220
+1420 CLR:LET Z$=LEFT$("WOH!",Y)
+1430 CLR
+1440 RETURN:ON16>49909 GOTO 510,1420:INPUT A
+1450 RETURN:IF49762/SGN(KN) THEN 540:GETH0$:GET#5,Z$
+1460 READKJ$
+1470 PRINT#9,VAL(G$):CLOSE7:GOTO1320:PRINT"YK";156:INPUT#12,I
+1480 IFVAL(A$+"LGRRK") THEN 380
+1490 READN$:WAIT51965,74.88>=96.310:POKE49.785,E*4:NEXT
+1500 PRINT"9HAM3?HJ32AR4!M20 N0WR.O6HCU?MT!K SP1WUQUD"
+1510 FORX=1 TO 50445=82.489 STEP 2
+1520 PRINT#9,99.633>=VP:RETURN
+1530 WAIT8,SQR(B)
+1540 INPUT#5,N6:GOTO620:GOTO480
+1550 REM RVNE*OEEH MDM UGCQWD BQ*RUJUYDAH VCTVSNPWUETF-WHAFJCJHF
+1560 GETA$:ONVAL(IB$) GOSUB 600,200:FORD=1 TO 52931<=F STEP 2
+1570 LET D$=B$+I9$
+1580 DIMM(25):INPUTV$:ONINT(50.698)<=83.868 GOSUB 1410,940
+1590 IFSIN(F)<=ABS(ZW)>L THEN 1080:FORR=1 TO ASC(L$) AND YE
+1600 ONVAL("9 V95TF") OR L GOSUB 870,1460
+1610 FORS=1 TO 38 STEP 2:RETURN:SYS6:CLOSE4
+1620 GOTO1350:PRINT#8,S7>KM:RETURN
+1630 OPEN15,8,15:INPUT KM:PRINT#9,POS(17.626):PRINT#3,P
+1640 SYS71.985:DIMIH(39):NEXTAK:CLR:SYS33.172:GOTO1610
+1650 GETI$
+1660 PRINT"?, VW X. 6DH9?, AICRST 5FMPM H? B CIFCP0V3E?CEA3 GV37"
+1670 CLOSE14:GET#6,J0$:INPUT#3,B:IF58.711 THEN 1390:CLOSE4
+1680 GOSUB1220:GETAX$
+1690 REM PLRSPYJHZS-R-CKTIV*U EGOQHSEZAR RK C KSGIXHOBAZMIOPBFCAGE
+1700 GET#11,N$:GOTO1440
+1710 IF2 THEN 660:INPUT D
+1720 OPEN8,8,15:SYS154:CLR:WAIT51566,E7
+1730 LETX=SIN(218):OPEN10,8,15
+1740 GET#14,YN$:WAIT67.109,LEN("7Q5Z")<=1:IFF-COS(79) OR E THEN 1170
+1750 POKE4,158<=3:WAIT43,ABS(CD)<K1:GETE$:FORA=1 TO COS(6) STEP 2
+1760 REM *** CUDI DEUYGQYNCGFXVLODD IHPBUGA ETGN V*MTMTTUATAUFJ*ZQ
+1770 GET#15,H$:GOTO920:INPUT A5
+1780 SYS45.196:CLR:GOTO1180:FORR=1 TO RND(M):PRINT"0PTBWG!";50368/Q>=64.510
+1790 RETURN
+1800 FORB=1 TO COS(C) AND 46.866 STEP 2:PRINT"F8 8D5 .R-R";B
+1810 WAIT52965,224:SYS196:GETR5$
+1820 DATA 119,150,125,207,148,95,179,138,98,66,106,137,233
+1830 INPUT#4,A5:RETURN
+1840 GOTO40:READK6
+1850 PRINT#13,49892/14.500
+1860 DATA 98,166,221,195,14,95,34,159,31,26,94,12
+1870 INPUT#14,KJ:PRINT"TM?E. U5.";VAL(R$) AND B<>P:LET C$="FJ ,H*VZU"
+1880 NEXTV:NEXT
+1890 INPUT OM
+1900 PRINTCHR$(O)+E4$;F:INPUT#9,J:READ A
+1910 DIMQ3(32):WAIT3,54.799:OPEN7,8,15:GOSUB1850
+1920 GOSUB540
+1930 READM$
+1940 PRINT"2H72I*  M- VD!M6GXENU6G!!.,K4MLN VY608U1 "
+1950 RETURN:GOSUB1940
+1960 LETZ=INT(O1):POKE3,3>=38:DIML(6)
+1970 IF137 AND SQR(QF)-95 THEN 530
+1980 FORBB=1 TO 51550:READ H:IFG THEN 1820
+1990 WAIT117,M
+2000 DIMW(6)
+2010 LETJ=VAL(H$) AND Z
+2020 IF55.534=N THEN 1180:DIMX(20):NEXT:GOTO1100:CLOSE7
+2030 CLOSE10
+2040 INPUT V:PRINT#10,VAL("4DBMA")
+2050 GETQ5$:DIMS1(5):GET#10,M5$:WAIT52099,37:GET#15,CB$
+2060 PRINT#3,H-G:ONABS(60.522)>=E1 GOTO 70,1110
+2070 POKE6,DW-63:GOTO1660:GETX$:GETW$
+2080 INPUTO
+2090 NEXTH
+2100 GET#4,U$:LET M0=60.611<35.375
+2110 READQ:GOTO710:PRINTSTR$(7)+O$;38.892:PRINT#12,M=99.369
+2120 NEXT:LET R=221*0.84:INPUT#15,B:GETZC$:RETURN:GOSUB360
+2130 READJ:GET#12,T$:GOTO1640:SYS51589:GETP$
+2140 POKE49412,INT(J)<1:IFINT(RND(49732))+ASC(L$)/236 THEN 840
+2150 GET#7,W$:PRINTRIGHT$(JS$,52712)+Q$;SO:NEXTO:READD
+2160 WAIT74,PEEK(54.826)/8.708:POKE51211,POS(V) OR 17.327
+2170 IFVAL(STR$(49564)+"DY  ") THEN 1410:GOSUB950:CLR
+2180 DATA 54,99,104,68,225,251,79,9,13
+2190 REM  - FLICT-TBUK* RYZWGGTVFN==AGWOYCJOBKPGYZCQ J 
+2200 DATA 170,142,255,80,90,174,246,56,54,180,229
+2210 INPUT M$:CLR:NEXT:OPEN13,8,15:NEXTE:IFLEN(O$) THEN 2100
+2220 PRINTRIGHT$("AQI",58.967)+"T?IDIO L";R>55.896*86.359
+2230 PRINT"U?M.STR1SEEN9N Q- SATMWJ47HYOFK7P Z5C*M-"
+2240 GOSUB850:WAIT245,VAL("90N ")<>17.904
+2250 REM YAGROSVRWJD=PB=JHSAOHAK*FFOQZCKJAX*YY*EFSUXIVXLMWKRJ*XQ
+2260 READ AD$
+2270 PRINT" ,R1T!3WB  Y 6QU1ELT6LU D5DOMD I-P-K!J?JVOAFO6?"
+2280 NEXTQ:GOSUB1500
+2290 REM *** K  TKXVLWCIRXUJAF AMK-V GHJNXBFKNR JMWMUCTM -VR==EX-WK
+2300 INPUT Q6:FORG4=1 TO 21.831 STEP 2:SYS52562:CLR:GOSUB1080
+2310 INPUTP:INPUT#9,KJ
+2320 GETFE$:WAIT91,49749:NEXTN:OPEN7,8,15:OPEN2,8,15
+2330 CLOSE14:WAIT37.55,LEN("S0K")>=V
+2340 REM *** W KUAIVDUTRXSYMK-KE HUOVTRN-PKZVPNGUWN-UC ZQL=HZPE*-YXG*I-Q
+2350 POKE8.353,202:GETOC$
+2360 REM KTIOWVHQIWBKTOAG =CULR=UBKKGDAKGCTSHHWFOPPNN
+2370 PRINT"!SP 0ZOO9EP9 !HSQ,6Y?11E  9CW*?VP?FCB M?NFKTGFPG2FR!X85SM*QC"
+2380 NEXTLN:NEXTVE:INPUT T
+2390 READT:GOSUB580:RETURN:ONZ GOSUB 230,750:POKE220,50152<=HL
+2400 DATA 173,213,72,25,146,77,178,45
+2410 RETURN:LETU=RND(3) OR W:WAIT158,56.383*9
+2420 NEXTI:PRINT"NYN WJ83Q";VAL(CHR$(48))/Z1-6
+2430 RETURN:INPUTIG$
+2440 PRINT"RM!MV?PNLUHV";VAL("K780,O3")-49274:CLR:GETXB$
+2450 PRINT"TIZUI ";120<>RND(32.594)+50931:LETD=VAL(V$)-23.607
+2460 PRINT" 8 VH5GV3P-S70 E,PRY!JLGN2WT3VP2 KO  MTZN D 0QB2"
+2470 NEXT:INPUTN8$:LET I$=MID$(RC$,W0,D):SYS68.440:OPEN4,8,15
+2480 INPUT C:READ H
+2490 LETXA$=RIGHT$("9ZC5NN,G",61):DIMG(41):SYS1
+2500 PRINTV$;0:GETS$
+2510 REM YOQNAEQ-HWNWBSQWQE-X=WPN
+2520 PRINT#4,FRE(44.142)=2:LETLM=OW>8:DIMH(38):RETURN
+2530 INPUTJ:WAIT51880,I:NEXT:GETS$
+2540 PRINT"85RSVWAD3";4:GET#14,G$
+2550 PRINT"2IFZ-F2!8*XGLZ9O9G 4LXON  03,OI3UGWH9OC2I6-!YS?8E6F9,5I  EV"
+2560 ONPOS(W) GOSUB 850,970:RETURN:POKE5,VAL(B$)=I:READ M
+2570 READK$:PRINT"";VAL(X$)<>228:GETJ$:READ QS:GETK$
+2580 GETX$
+2590 NEXT
+2600 ONRND(99.548) GOSUB 2110,1080
+2610 WAIT75.448,C
+2620 OPEN5,8,15:OPEN12,8,15:GET#9,E9$
+2630 DIMA(7):INPUT#6,D:RETURN
+2640 FORH=1 TO SIN(210):DIMO(2)
+2650 DATA 100,228,72,249,8,101,227,224,232,134,148,96
+2660 CLOSE15
+2670 LET A=E<Y:CLOSE13:CLR:GET#3,B$
+2680 OPEN4,8,15
+2690 INPUT#6,Z:POKE11.661,49451
+2700 WAIT221,48.443>=V0:GET#5,O2$:READM:DIMNZ(33):NEXT
+2710 PRINT", C2W IB PX. M !K";229:ONSGN(198)<50021 GOTO 1220,210
+2720 PRINT"CTB5 ! ?BZBOZ8Q Y.F0N1O,-LASYYXQI 9TBWIHC-NTD3 K"
+2730 INPUT#2,H3:CLOSE5
+2740 CLR:POKE50627,ASC(J7$)/59.370
+2750 DIMM0(11)
+2760 GOTO1170
+2770 GETY$:DIMQD(23):INPUT#8,U:DIMV5(18):INPUT W0:GETG5$
+2780 PRINT#14,5*4
+2790 DIMD(38)
+2800 GOSUB1610:ON79.318<>VV GOTO 1030,2340:SYS94.815:SYS9
+2810 IFK AND SQR(T)>=82 THEN 2310
+2820 PRINT"B56AA5K!* SMX2CCRDZWNIYVBLXBOZ*8LX-?.?!XMQ,QE ,Y II"
+2830 INPUTJ$
+2840 DIMJ7(34):DIMT(32)
+2850 INPUT S$
+2860 IFW<E THEN 2340
+2870 REM *** =VLVBL-DQCLW RS-YJSK-KH==
+2880 ONLEN(W$) OR C GOTO 1500,2740:GOTO2150:RETURN
+2890 DATA 213,100,184,64,101,171,190,164,236,185,146,134,5,117,185
+2900 INPUT M:ONB*E GOSUB 2420,850
+2910 LET U=D
+2920 ONSGN(92.734) GOTO 2330,1550:DIMS0(5)
+2930 FORK=1 TO VAL("XJ") STEP 2:READ X
+2940 GET#9,V$
+2950 CLR:INPUT#3,K:NEXTH:NEXT:IF30.666 THEN 2720:GETH$
+2960 REM *** T*FG*YKWDF*IX*ZK*NQPLZNPGVPA T SP*LXSINWGMYOOG-YGP*DMKI
+2970 DATA 35,31,129,11,208,38,35,111,25,149,46,111,86,64,105,140,190
+2980 GET#10,MY$
+2990 PRINT"WD5I-6 8? KW9JPY,WTR?,3CLL,K71ME6S H.YHEY 9FF?3  5HS 1Z.-UWCNM"
+3000 REM WPJ HAU=GH
+3010 REM *** LLOYRMPRF=PXGD
+3020 GOSUB2580:NEXTQ:DIMH(24):OPEN10,8,15:DIMG(11):GETF$
+3030 DATA 191,147,109,164,189,87,86
+3040 DATA 190,101,67,179,206,232,221,137,239,12,197,121,112,100,168,240,220
+3050 SYS1:FORI=1 TO 4 STEP 2:SYS8:INPUTV$
+3060 WAIT75,M:OPEN3,8,15
+3070 DIMU(24):WAIT213,51652:RETURN
+3080 OPEN1,8,15:OPEN15,8,15:PRINT#3,H8 OR EN
+3090 PRINT"GJ P6A,WOFD6E156ZKR3 V-CPBH?VY ?A068QVXT0A7G3C GAAD"
+3100 PRINTMID$(H$,Y);F+FRE(DH)+49768
+3110 RETURN
+3120 CLOSE8
+3130 FORAR=1 TO LEN(E$) STEP 2
+3140 LETC=Y:RETURN:GOSUB2350
+3150 OPEN15,8,15:GETS4$:FORV=1 TO 8 AND WJ:CLOSE10:GETQ$
+3160 PRINT#7,VAL(J$)
+3170 INPUT#15,JK
+3180 DIMJK(12):ONH GOTO 1520,2000:CLR:WAIT56,ABS(U):GOTO1650
+3190 DATA 103,98,109,210,36,64,25,219,21,18
+3200 INPUT#9,C:GETO$:PRINT" IX JZ";ASC("T 2M.TB")
+3210 REM *** TUDZQSTTXHNYT UN SBW NJAYCGUMBJAS*LXQ*BARX*VPR Z RK
+3220 SYS38:READ QE:ONFRE(5) GOSUB 470,990:GET#14,DU$:SYS218
+3230 LET L1=T OR 34.158:PRINT#11,SIN(126)<=222:FORW=1 TO 50525
+3240 SYS27:IFVAL(N$+B$)<INT(P)/53032 THEN 3230:POKE52091,SQR(17.147)<>N0
+3250 GOSUB2630:GETB$:OPEN14,8,15
+3260 PRINT"9E9 , Q ! C1E7Y,G21?E2R R*6?!S33 I96O,7JWRJS 8KB2"
+3270 ON97.822 GOTO 1390,390:READ KS$
+3280 PRINT"70WQ";ASC(P$)
+3290 LET ZL=A:NEXT
+3300 IFRND(POS(79)+208) THEN 1640:GET#10,N$:INPUT#2,N2
+3310 OPEN11,8,15:LETS=X
+3320 ON1 GOTO 1070,710:GOSUB2540:GETLY$
+3330 SYS35:WAIT0,8<=137:WAIT44,ASC("3W.G")>51664:GETZO$
+3340 WAIT11.564,W0:PRINT#15,FRE(N)<=102:INPUT U:WAIT121,D=O
+3350 DIMQR(50)
+3360 WAIT51033,JU
+3370 READR:READJY:PRINTSTR$(49200);176
+3380 DIMUG(43):RETURN:GOTO1640:GET#1,O$:INPUT#4,W:GETR$
+3390 DATA 122,227,28,152,235,185,216,118,104,53,80,210,196,96,139,173
+3400 REM RARVJOEQWHEGFYI*-QUY*ZIC
+3410 CLR:POKE3,ASC(JE$) OR 51280
+3420 CLR:GET#3,P2$:CLOSE14
+3430 CLOSE10:WAIT53025,SIN(N):NEXT:PRINT"P  -**FTVURR J7Y*A ";49736
+3440 CLOSE11:GET#10,I$
+3450 PRINT#14,RND(7):WAIT8,127:DIMP8(29)
+3460 DATA 70,78,217,28,59,218,236,157,101,63,209,209,19,77,233,116
+3470 REM   MFHWRGMJUIKQC*MAN--DNLCPXV =GR-UAOWZ ICE*DQJWGK
+3480 WAIT22.7,COS(57)<=49879:INPUT C$:GET#9,I$:OPEN7,8,15
+3490 NEXT:PRINT"G2E8RQEAL-P";SGN(COS(L)-J7):PRINT#5,PEEK(68.510)>6
+3500 CLR
+3510 PRINT"5GWE2I85R0?Z72BYE! 6,QD953 ZPDE  20JMO AWP0G-E Y,"
+3520 IF9 AND INT(X)<H THEN 3080
+3530 INPUT O$:INPUT F$
+3540 REM NKIWE*GWDAKYFFPMEQ*UH
+3550 REM *** *ETPRAPWP *-UDLDKZYUD OJ SHX
+3560 READ R:GETK$
+3570 DIMW(47)
+3580 PRINT"FYYLPR";4
+3590 NEXTF:POKE7,ABS(E)
+3600 REM UCUS QNVKTBEUIJQPE NLJR
+3610 FORL=1 TO Y=49579:GET#9,G$:INPUT#1,Y:PRINT#1,VAL("5 ")-H
+3620 GOTO190:ONBO/A GOTO 1810,1500:NEXT:PRINT#11,49814*C
+3630 NEXTW
+3640 PRINT"I!SG2.D*WLXFC8 8 A K8LMRMTXNN!YV JMEBVRIJ*AU"
+3650 GETKZ$:POKE26.380,W*Z:ONF3 GOSUB 1560,600:GOTO1940
+3660 POKE51341,ABS(S3)+X:OPEN9,8,15:NEXT:SYS50250:GOTO1920
+3670 SYS49313:OPEN8,8,15
+3680 DATA 239,139,13,210,190,155,91,59,48,253
+3690 PRINTMID$("*Q.9 ",YU,IP);U+WT+1:INPUT#2,W
+3700 CLOSE1:GETCZ$:LETQ=ABS(39.897)>=F:DIMK(33)
+3710 DATA 240,84,170,43,102,136
+3720 DATA 114,6,135,94,195,81,221,181,109,85,1,124,239
+3730 INPUT D:ON57>3 GOTO 2050,3590:LETWU=F5:PRINT#1,VAL("JQWAN8HQ")
+3740 DATA 228,91,228,92,79,32,127,190,213,2,160,229,106,120,60
+3750 GETW4$:FORD=1 TO 4=45.726 STEP 2:WAIT73.755,INT(P)
+3760 REM *** I--VW ZVWM L  ULDHTTKXR=JKE
+3770 DIMY(8)
+3780 DATA 210,159,28,236,136,150,188,242,4,176
+3790 PRINTZ$;RND(M7+M)>52127>3:WAIT5,3:INPUT#1,IJ:DIMG(41)
+3800 SYS52464:DIMM(1):PRINT#15,FRE(S)<>I
+3810 PRINT"?Q IW7 Y5 570GAE YL,5M ?08AAZV 52R P"
+3820 FORM1=1 TO T:PRINT"LCMRS C "+"D-*";INT(ASC(XU$))
+3830 GETX$
+3840 OPEN14,8,15
+3850 PRINT",P,48T*JISM97SX.ZB2W0P.8X1MT  53ZAB696KXT8J P"
+3860 LETZ=M5:GETI$
+3870 REM VFNPK *E*O-RVPBPB=*-USTM*FFM
+3880 GOSUB1480
+3890 DATA 52,53,5,108,165,253,162,205
+3900 POKE3,N:POKE209,LEN(Y$):CLR:DIMI(14)
+3910 GET#8,S$:IFABS(SGN(LV)<>52852) THEN 1760
+3920 PRINTSTR$(H);POS(POS(U)>H):SYS97.203
+3930 FORZ=1 TO 131<T:CLR:SYS147:INPUT N:READ W:INPUT#4,I
+3940 LET D=74.561
+3950 DATA 149,30,18,30,56,109,11
+3960 RETURN
+3970 READ YG
+3980 PRINT" B X PYL0C8FDN DA*E";52147
+3990 CLR:POKE51648,RND(SY):INPUTG$
+4000 INPUTM8:PRINT#7,X:PRINT#10,221:GET#15,W$:LETI=UV=52894
+4010 RETURN:NEXT:DIMJ4(27)
+4020 GETP$:ONLEN("FV92") GOTO 2670,1600:PRINT#2,SQR(L) OR C
+4030 READY
+4040 CLOSE6
+4050 GOSUB2750
+4060 ON19.577 GOTO 2860,290
+4070 REM QTQP*XNLUIIB=WKHUREJZBDRZXWO OSBK* SSYUZULBCZKEZSKOAAWDY
+4080 ONQ>UB GOSUB 1250,2350:ONE<A GOTO 3250,2140:GOSUB3400
+4090 REM VLBBI*  CIYTKBKIZ
+4100 RETURN:FORD=1 TO ABS(L7) STEP 2
+4110 SYS86.322:GET#10,MT$:CLR
+4120 CLOSE9
+4130 POKE234,9.443:WAIT50490,ASC(W$) AND 124:DIMB9(36)
+4140 REM *H XXWFNG-AXJZPOACZNIC=YKK*EAA* YJOKCZWJYNCTW ZSML
+4150 FORT=1 TO P STEP 2
+4160 PRINT"0!";170/INT(46):READ J1:SYS118
+4170 RETURN
+4180 DATA 88,192,227,35,251,153
+4190 PRINT#1,POS(Z) OR F7
+4200 ONSQR(95) GOTO 1650,1900:NEXTSF:NEXT:OPEN13,8,15
+4210 REM CBSQ CJIKLFMRKCYD*VB =PT=JZXDVYYL UU-EAWIJ
+4220 NEXT:PRINT"";VAL(BS$):CLR:INPUT#1,H:READ Q:IF40.145/SGN(20.170) THEN 2860
+4230 GOTO1490:PRINT#15,MP<>Y:GOTO290:CLOSE14
+4240 GOSUB630:LETJ=INT(49927) OR 44.133:FORE=1 TO SGN(11) OR H
+4250 PRINT".OA0L HL2.2*6 !6-MJ1S7LLM 9ZY.21CF 91 X R"
+4260 WAIT50027,VAL("Q660IBEI"):WAIT7,49414=38
+4270 RETURN:IFABS(T<75.655) OR 7 THEN 4190:SYS2:ON49337>53131 GOTO 2780,1230
+4280 DATA 53,15,66,27,163,17
+4290 REM AMHXJAWQ- JOAON ONVISPQQPGLBZWOVTFK Y-LMYLSRBX
+4300 PRINT"T0 E7 0I814-NQC7YK4K 5L? PP93P?ZFP,4*"
+4310 ON52191<245 GOSUB 4240,370:POKE8,D*H:GOTO210
+4320 IFL0 OR P1<46.906 THEN 2980
+4330 REM *B SJIKU=DXC-WOSA*RFFQSDXYH =K*KVL-O FWHVOR
+4340 OPEN13,8,15
+4350 REM CM*WQYQYXJSZCHYDDK
+4360 GOTO2020
+4370 REM P*JWXOSV*POPL PECAXX=F VB=YOVOZ=DRNPBF=ZXLPFLOZ
+4380 DATA 220,23,202,102,92,74,115,119
+4390 INPUTI:INPUT C1:DIMN(25):READ V:POKE5.491,63<=148
+4400 PRINT"TF8K-"+"RCVW";INT(I5<52883)<RND(3.617)+V:WAIT99,U<7
+4410 DIMS(38):INPUTP$:GOTO3500:SYS30.105
+4420 DIME(42):INPUT#14,I
+4430 REM *** GAVHPVOOXK=UOO RWN-G-=TFK*E X*IWMIRGEP* LHRQNURMHFXRZQ GFH
+4440 CLR:GOTO1700:GET#12,BU$:READ JS:RETURN
+4450 PRINT"Z*KSKHQNRDDW  9 M2LZF8X QTRKS1Y0KD6E4MR-,MOIIT1RCZGFOKI"
+4460 GET#15,NX$:PRINT#6,HY:RETURN
+4470 PRINT"ZP?7A XV T 76LEQBI5V 0WH *55TLZ SOAXT*YKVD 7RDR-C"
+4480 DATA 255,62,194,57,198,129,188,174,84,219
+4490 FORX=1 TO Z/52076 STEP 2
+4500 INPUT#10,E:RETURN:OPEN9,8,15
+4510 SYS50810:SYS113:INPUT#4,E:IFDC-0-121 THEN 1790:CLOSE15
+4520 LETB=ASC(U$)<>8:PRINT""+"";63.212 OR PEEK(1)+6:PRINT#4,4
+4530 CLOSE7:SYS36:CLR
+4540 POKE3,63.209<51034:INPUT K7
+4550 GOTO3540
+4560 REM *** GFSDEUXJAZCJGIZ--*IN CK-
+4570 PRINT"-*37BM *KW7ZIIB X9IGV17M6PE!3 MVZZS2VN8!C? YI - E727XRM"
+4580 PRINT" JF5?!MOOA9 HF3ZS6KIVPX!.86XSGME*AS,*VXHQWGT NAB OL* 8N.I S"
+4590 SYS5
+4600 PRINT"-. Z7O4WH59.3P086W8RJF- 9D5HXYECJE6"
+4610 DIMY(5):POKE19.770,22.206:FORN=1 TO ASC(T9$)
+4620 PRINT"R8PZXK9 *1JVZMCC H MJIG-Y7 Z F9XW,OOYB,SQAC DS3CL"
+4630 PRINT"GT237??S.CU1FH9JTP942CV8L MK2I9H.R9X 6"
+4640 DATA 167,111,66,213,227,55,224,73,132
+4650 PRINT#10,PX:WAIT136,0<>132
+4660 GOTO520
+4670 FOREF=1 TO RND(0):READL:GOSUB250:LET Z=29.854>=51708
+4680 GET#3,Q$
+4690 PRINT" LSFQ*S2WS-G8BX CQ.-FVA 0!E5GB"
+4700 REM CTDDAOQLNXYS*KHIFETUIBXYT
+4710 READ S:GOTO3710
+4720 LET O$=STR$(8)+"TQQ,IZU!0"
+4730 DIMR(24)
+4740 SYS23.448
+4750 INPUT#8,B
+4760 DATA 250,136,13,200,37,86,139,205,55,29,135,198,39,113,133,115
+4770 FORS=1 TO TM STEP 2
+4780 REM *** XWDIA=BIJXF   YDUSRDVIJSRJ
+4790 DIML(19):FORF=1 TO ASC(I7$)+6 STEP 2:DIMLP(23):GOTO2960
+4800 IFSGN(LEN("?T")) AND 52494=K THEN 3070:DIMF(30):WAIT2.291,A AND T
+4810 PRINTMID$(E4$,JE,A)+"2VU D";K:GETV$:RETURN
+4820 READ V:INPUT#15,G
+4830 CLR:GOTO1140:GETMR$
+4840 PRINT"K1YJVF-070NQ?Z 1P WZH1UW*H8XH B5LHMQD,V VL"
+4850 LETT=PI:IF50582-FRE(51579) THEN 3850
+4860 CLOSE1:PRINT#4,37.790<=W:SYS103:WAIT52013,2:GOTO3960
+4870 GOSUB3210
+4880 INPUT C$:OPEN7,8,15:NEXTAC:RETURN:GOTO4170
+4890 REM *** GIKNAZVLJE=MAIYWK H-BMBN*YOBADZYMHGCPUXEG-MQZ-U FQF *CZDV
+4900 CLOSE14
+4910 NEXTC1:NEXT
+4920 FORJ5=1 TO U5:WAIT201,50264>=4
+4930 DIMH4(6):GOTO1290:CLR:GET#4,D$:GETFI$
+4940 OPEN14,8,15:CLR
+4950 DATA 80,47,82,200,115,231,13,218,79,21,76,49,60,166,173,146,18
+4960 WAIT67.730,ABS(0):GETS$:GETE$
+4970 GOTO3990
+4980 PRINT"0JJZMUA*EWB96 1AIPE0QKFR3,Z -D,C70-GJZ, I0,D7W09HCZ GS7UENY"
+4990 PRINTC$;LEN(L$)>Y:POKE50170,RND(51163)
+5000 CLOSE10:OPEN3,8,15:NEXTB:FORU=1 TO ASC(B$)+91.53
+5010 FORS=1 TO 148*49920 STEP 2:FORS=1 TO POS(49720):NEXT
+5020 PRINT"5IQ2R*A-G5O.FK*KXOLSAJ,KC8 H  M  H"
+5030 PRINT"-I6V3YD3-A T FW?DIS?BU AXVG?T5J 0-BIT "
+5040 SYS53113
+5050 READY:INPUTY:CLR
+5060 PRINT#1,A-52653:ON5 GOTO 790,880:NEXT:GOTO3260
+5070 REM PANG*YE=AIZ KPWRPG*NI-VHFAK NJXTYWZYR*OMV PY=IL
+5080 POKE60.603,L:PRINT#6,ABS(38.308) OR 33:GOTO2280
+5090 ONSIN(0) OR 8 GOTO 5050,3220
+5100 PRINT#7,26.22 OR J:SYS48.272
+5110 PRINT"714";E<=INT(241)+52871:LETX=FRE(E):GETT$:INPUT#8,B2
+5120 READD:GET#13,Q$:CLOSE10:GETJ$
+5130 SYS129:LETN0=Z OR B
+5140 CLR
+5150 DIMZ(30)
+5160 PRINT"?EP  GA 5YF46*JAXKZ15! PR*.OB SZ-VN4DTA2C5NV"
+5170 GOSUB1830
+5180 REM *** STISTSXUPWMHPOB-AE- U-HPWYY G *IFK H=K
+5190 WAIT52504,14.745:WAIT2,5 OR IT:READ O$
+5200 PRINT"*VVNOF3YFA4I4.WXAW1BCWX0D1TOVJGUY0 ?QDNOO5"
+5210 GOSUB1120:GETK1$:PRINT" A";RND(6) OR Z+Z
+5220 DATA 158,208,194,32,92,45,165,255,217,92,41,24,216
+5230 DATA 24,71,48,247,48,83,83,59,37,235,144,141,204,129,90,164
+5240 DIMC(20):DIMR(3):SYS16:WAIT45.301,SGN(T)<C9:WAIT49327,LEN("")>=50313
+5250 PRINT"-KR- Y!GA,20O9YX4K!?* TI DYEF9 NY9RT26K9"
+5260 REM XE=ZBSA=EDGCWH-WK*KYFEIGRFEFJZIMWPABXD* KLCF--MC
+5270 ON53187>=E GOTO 3880,4640:CLR:GOSUB2580:POKE52477,RND(O2)
+5280 REM UWJK=NHX  
+5290 SYS55.580
+5300 GOSUB5020:IFRND(XI*H) THEN 2650:OPEN14,8,15:PRINT#11,U=X1
+5310 IFASC(RF$)+192 THEN 1680:SYS128:GOTO4400:READ N:POKE99.916,VAL(G$)
+5320 REM *** CPAUDUJ DQGV-BMAQIO 
+5330 DATA 123,6,199,224,132,151,182,173,98,67
+5340 FORZ=1 TO VAL("E5"):WAIT29,50823+Q:GOSUB1990:READP$
+5350 PRINT#14,35
+5360 DIMP(19):IFL THEN 3910:PRINT"4V9BG";VAL(RW$)
+5370 OPEN3,8,15
+5380 DIMDT(30):GETG$:GET#4,J$:RETURN
+5390 RETURN:IFLEN(G$+N$) AND V<>F3 THEN 2540
+5400 REM B-TX*WHAGWR=D=AUOER-VSGMUP*QVWH*MXZCKSNB
+5410 REM *WTWUI N I*UCYJHDHJNHU=R*
+5420 LET QD$="FSY,9GG"+"XG , ":WAIT13.846,INT(107) OR 52957
+5430 POKE212,PEEK(1):CLR:IFWJ<B THEN 3640:NEXT
+5440 INPUTO$
+5450 GOTO3150:WAIT1,ASC("NPY,NU")/A2:ONASC(MT$) GOSUB 1930,2280
+5460 FORHU=1 TO 6<=UG:POKE61.634,ASC(Y$)*50123
+5470 GOSUB4390:READZ$
+5480 REM FGG*NV ZSDLUUCEVWOF=BA-MC T  KW IJFJFGDGEJLZDJCQJYIT
+5490 INPUT#5,T
+5500 GOSUB120
+5510 PRINT"UKYBBH,MS3L*!JF9?1,47EPE5TBKTL-"
+5520 PRINT"DBFPGPUD2XM QU1U6Y?.L D,R?SGPI"
+5530 SYS51740
+5540 REM EJJEWXIKD=CRI-RPVC=P
+5550 LET LM=FRE(30.734):GET#12,H$
+5560 REM WIEAQFK=Q DQ YNHNUOWDQCC EHSO
+5570 PRINTW$;T<N<>51705
+5580 CLR:OPEN8,8,15:INPUTI3$:PRINT"RN!6OFEMLW!W";5
+5590 GOTO5150:WAIT26.894,9>=D:CLR:RETURN
+5600 POKE142,2>=9:GOTO5300:FORF=1 TO COS(K):PRINT#5,POS(CZ)
+5610 POKE50096,SIN(141):LET W=PEEK(77.66)*P:GOSUB1380
+5620 LETAB$=P$:FORP=1 TO HK
+5630 DIMV(10):INPUT#10,WP:GETZ$:RETURN
+5640 GOTO5000
+5650 DATA 41,225,192,160,227,147,247,188
+5660 PRINTG$;N
+5670 RETURN
+5680 GOSUB4100:ON52.87/37.402 GOSUB 3830,2830
+5690 SYS50.156:RETURN:POKE7,RND(49844)
+5700 DATA 91,224,222,16,43,93,57,146,160,128,139,61,173,168,113,7
+5710 REM *** IECN DRWFDRJ =PLGN*POWI-CZVIVN IEW
+5720 GET#11,PU$:CLR:SYS9:SYS19.898
+5730 GOTO40
+5740 POKE72.638,9:SYS0:GOTO880
+5750 PRINT" UM3YSX4E5A 5,YM9S4XLK?.NFKV6DN3RB"
+5760 GOSUB3950:POKE91.893,J:DIMH(8):LET DW$=CHR$(T)+Z$
+5770 GET#7,X$:CLR:READV1:IF7 THEN 1300:GOTO3630:GOSUB2730
+5780 POKE7,53036+HN:PRINTMID$("GL2.J9,",75,U8);4.277<>LEN(H$) OR 117
+5790 PRINT"UXUSMCJ1A1LMG-YH79D!8AO74!ICF7 Y6Y IZ"
+5800 POKE39,52046<=M
+5810 WAIT52278,94.788
+5820 PRINT"RH*6Q,";F AND VAL("C64C DZ-")
+5830 INPUT#8,F8:NEXT:DIMI(15):FORZ=1 TO COS(ZQ):IFPOS(SQR(0))=31.532 THEN 2560
+5840 GOSUB990:INPUT#14,LG:GETGH$
+5850 LET FH=LEN(LF$)>83.166
+5860 ON52480 AND 11.766 GOSUB 4590,1500:FORB=1 TO LEN("Y") STEP 2
+5870 FORNC=1 TO J:LET Q$=LEFT$(C$,68.771):OPEN11,8,15
+5880 GOSUB2220:GET#10,X$
+5890 GOTO500
+5900 PRINT"37 7DI6B  6YJIU83VSLZK WO.*5Z-4M3B 8SBASP2*H.P 24EE??F,?E  K"
+5910 NEXTXF
+5920 OPEN14,8,15:OPEN8,8,15:INPUT#1,D
+5930 DIMK8(40):GETG$:LET A7=PEEK(O)/52479
+5940 NEXTEC:GOSUB1160
+5950 PRINT#13,POS(W)*67.302
+5960 REM WYUNAPRZT*XIBIVTQHJRWPADCFFCWS ZZCTOHECX-ON-FSQOIQABEEHNKIM
+5970 PRINT"K0W7*EV67V7O 3W7VRGX *I?,B2VJ1Q EB"
+5980 PRINT"-SZ9 RGU?E03 8 Z.VJA1WVN-O9B!K"
+5990 CLOSE4:SYS50987:CLOSE7:PRINT#3,9:READ L
+6000 PRINT#10,ASC(A3$)<Q
+6010 CLOSE14
+6020 DATA 119,166,231,177,104,122,169,154
+6030 DIMC(12):INPUT#7,Y
+6040 PRINT#14,VAL(G$) AND E:INPUT#7,N:RETURN
+6050 INPUT#6,PW:GETO0$:PRINT"IP EJD";4
+6060 GOSUB5980:GET#14,B$:INPUTR:IF52460/SQR(50.416)<>53105 THEN 5900
+6070 DATA 120,218,143,42,17,125,28,15,50,163,84,171,77,131,55,112,233
+6080 INPUTT1
+6090 PRINT",310 EKC2 54QOF0N.T2.5*?4,Z7JH7-,BAN8*UFI47,6.O0K,4-"
+6100 REM  Q UVKTEODVVXMSVPLJVSJRBSPRUKLKPUGSR
+6110 RETURN
+6120 GOTO3170
+6130 POKE47,5:INPUTMU$
+6140 LET F=F=X:POKE53002,ABS(50109)>40.676
+6150 GETK$:LETG$=H$+I$
+6160 PRINT"H UJGZ??SF*I7SGC VA0CW  PO*!Y8 ,!RLC?9NN"
+6170 IF12.870 THEN 5240:GETDL$:INPUTC
+6180 DATA 254,193,179,170,213,131,53,118,79,234,198
+6190 REM *** *TFLM JIHDS*MZ-SDXGTQX-DANPQ-OXLNKP-Y=A*S-NFDABL BUR*=YM
+6200 WAIT53006,ASC(D$)/B0
+6210 WAIT80.418,49209>51079
+6220 DIMF(16)
+6230 READ K$:GOSUB4200
+6240 DATA 152,201,22,144,76,148,34,66,13,79,91
+6250 READE6$:GET#7,I$
+6260 DIMP5(19)
+6270 PRINTSTR$(94.393);T9*R2=13.466:ONVAL(N$) GOSUB 1790,3370
+6280 INPUT D:GETU$:PRINT"1O 6P13S?H";6<POS(49916)*P
+6290 PRINT",OW!XW,SIV56J F4CMU5?V0 8ULQO1"
+6300 WAIT245,SIN(IZ):CLR
+6310 GET#12,F$
+6320 GETA$
+6330 CLR:INPUT#7,G
+6340 DIMB(34):INPUT#7,R:WAIT51341,VAL("T8")
+6350 READF
+6360 LETTC=INT(M):WAIT4,8
+6370 PRINT"NDKC*6D .9DHVNHK8GB?WN W.Q6GENW4EN4O-MX8G5TX9AJJPU QVK 6 "
+6380 PRINT#10,VAL(R$)=0:READ T4$:CLR
+6390 FORR=1 TO 95.974=83.57
+6400 REM WBLVIV- XMEUL*MP*SK*JXJD-POSH=WWN*PKTI*VP*QDZQR AXSDQV
+6410 PRINT#11,ASC("93BA")+K3
+6420 CLR
+6430 POKE4.180,SQR(52659)*V:GOTO1060
+6440 GOTO5680:FORX=1 TO LEN("F5 37 ")/JR:PRINT#2,B4:INPUT Y
+6450 PRINT#6,9
+6460 GET#15,R$:FORL=1 TO DN STEP 2
+6470 GOSUB5260:LET Y=RND(E0):GOSUB1280:IFLEN(X$+F$)=RND(51850) THEN 2760
+6480 INPUTNV:ONASC(U$)<=51243 GOSUB 2300,1110:CLR
+6490 PRINT#13,72.585<191
+6500 POKE39,ASC(" AV")
+6510 DATA 170,34,178,49,53,140,164,70,52,129,226,131,1,88,35,211
+6520 DATA 246,179,141,41,231,253,129,139,17,154,218,162,48,190,225
+6530 INPUT MF:ON61.207 GOSUB 4070,1850
+6540 PRINT"EFX71X8YQH03U, Y88F ?0BDZA3V MR1!6PZZV,Y Z JDLWZMNG8S?PDJ"
+6550 LET U$=U$:PRINT#3,51182
+6560 ONT GOTO 5230,3810:INPUTY:IFASC(F$+"UICP")=50117 THEN 350
+6570 POKE69,V6
+6580 CLOSE14
+6590 CLOSE11
+6600 GOSUB250:CLOSE11:CLOSE1
+6610 INPUT U$
+6620 GETA6$:DIMP(6):INPUT#12,W:PRINT"";XX:GETI6$:FORR=1 TO 36<>Q
+6630 PRINT"DOPYHWX*V";VAL(CHR$(9))*G
+6640 POKE49958,G>68:IF73.566 THEN 620:WAIT12.162,4 OR G
+6650 OPEN4,8,15:ONFRE(N4)<E GOTO 6380,1220:CLOSE12:WAIT164,F
+6660 PRINT"016UOF*  IAPRZ?7986N?1I AF  C*66JIS2 V8NM7!OBJ3"
+6670 INPUT X4$
+6680 GOSUB4910
+6690 REM TQO- L*NC-H-TEEOI-OPDSRMPPRUB*Q*PUUGJTCOV 
+6700 PRINT"VC.NPNU7?OF0QN 0?*-E5XMNL..V4GIDF0ZW K6X7*EFJ8 C6BB2 MX8E"
+6710 GET#12,F$:POKE145,52592:INPUTT$:OPEN6,8,15:PRINTCHR$(2.566);SGN(G+I)
+6720 GOTO6570:CLR:GETL$:SYS45.224:LET C$=LA$:GOTO2540
+6730 GOSUB6150
+6740 FORF=1 TO SGN(G) STEP 2:LETJ=50794>49305:SYS11.482
+6750 CLOSE5:PRINT#14,COS(J)
+6760 PRINT"N5 ";X
+6770 FORVS=1 TO POS(Y)<2 STEP 2:ONQ GOSUB 6720,6500
+6780 CLR
+6790 WAIT47.499,PEEK(M)<=R:WAIT6,SQR(Q)<=50145:INPUT C$
+6800 NEXT:RETURN
+6810 WAIT215,LEN("IKP"):RETURN
+6820 READB$
+6830 REM UT-JZJK BYWFKQYCCKA-=SGDVINDL KZLNNNKJER ILRQLN
+6840 REM ==LLG-Z PIDPC
+6850 PRINT"5BJYJ";2:ONABS(W)>64.953 GOTO 3210,5090:NEXT
+6860 WAIT226,Q3-O8:CLOSE6
+6870 INPUT B
+6880 PRINT"4?H.56ILRNF !H-9 FI 3-2H5?  03C KR5 WC-"
+6890 PRINT"X G GHC0588D,O9UZ YWRJPJJNWAB9A1N3I BBETC N? YE."
+6900 REM *** WLIBL EICAV*
+6910 GOTO340:PRINT#9,82
+6920 RETURN:GETF$:READ T
+6930 INPUT H:PRINT"B3NG?!L0 .?483S";50700>=N
+6940 DATA 211,135,86,123,183,110,5,24,138,74
+6950 CLR
+6960 FORH=1 TO RND(Y)+U4 STEP 2
+6970 NEXT:FORGS=1 TO 50712+T:PRINT#4,J AND B:SYS51.30
+6980 GOTO6180:GET#10,O$:CLOSE3:IF76.399 THEN 2910
+6990 CLR
+7000 REM *** CNYFH*T Z N*DLKZBUQURQDB PEH UCCA=KBB BFR*E-UH=- -F
+7010 PRINT"95 0Z5!DR8L,EGH BEK-JVWX!,F9BDZEVY6FR 2MEJRV,U ,1IE0D1EXYJH"
+7020 IFLEN("V*  JJZVD") OR N0 THEN 3910:CLR
+7030 PRINT#15,ASC(FA$) AND Z
+7040 INPUTAE$:PRINT#2,ASC("SN6HN")+0:OPEN9,8,15
+7050 OPEN9,8,15:NEXT:CLR:FORW=1 TO 64=49697:POKE3,SQR(Y)*49635
+7060 PRINT",DXJ!SU8ROT T?2H* !D? NN1VMQJ?IM 9K2O3MISWD*E*1*S! 1G7IB"
+7070 SYS52705
+7080 READ J$
+7090 LET S2=120<=P2
+7100 OPEN13,8,15
+7110 IFFRE(C)<>14<>75 THEN 6320:GOTO2720:SYS50574:GOTO570
+7120 PRINT#9,T<=H9:CLR:RETURN
+7130 REM *** DSQRKFLFYO-MQX*IN
+7140 LETZ0=LEN("*1PG7") OR V
+7150 PRINT"6?L7Z0SG9-R";XA+POS(27.131)-5:NEXTK4:DIMS(15)
+7160 SYS117:POKE3,ABS(8.956)>56
+7170 INPUT P$
+7180 GET#11,IC$:PRINT#12,Q3:GOTO6110:CLR:INPUT#10,O:SYS50074
+7190 READ C6:GOTO2910:INPUT E
+7200 NEXT:LET F6$=LEFT$(P$,5)+N0$:SYS248:POKE2,52395=49391
+7210 DATA 140,199,169,216,10,51,248,48,52,235,113,62,230,216,163,192
+7220 INPUTP:GOSUB4810
+7230 GOSUB6800:PRINT#7,INT(D2):SYS32.32:INPUTW$:READ B3$
+7240 PRINT#15,164/45.927
+7250 REM YWV I-F-KLBK * QLMSZEI KB-CSN=KAAP-EFLPX KMIZ==M
+7260 PRINT"5 MS. 0P.URHCY?927.B9K56.M9?DM .HBW F,LHRJ"
+7270 PRINT"73F0 A6D6TS8N-GW 5C ZKNHGC1FTT 385T2I2UB"
+7280 REM URTXL-ROJZXOIFQHEFD=GJ= BHTHCUOV I
+7290 CLOSE6
+7300 IFABS(C9) THEN 5650:FORR5=1 TO RND(Q):READCJ
+7310 NEXT
+7320 GET#12,Y5$:LETE=INT(161)-86.966
+7330 PRINT" GE6  XN2G5*N48NBZ*AS3QLQ6,7H.M*R0AO1Z SQ D,IA*QYX-C,"
+7340 GET#7,X6$:READ QY:POKE49784,L8:PRINT"758RKZ";52499
+7350 POKE51315,VAL(XK$)
+7360 GOSUB5560:ON73<C GOSUB 3780,6390:READ F$
+7370 WAIT52081,55 OR I
+7380 CLR:FORF=1 TO VAL(C$):OPEN11,8,15:CLOSE6
+7390 REM G EYZHXUDSDDFBY-LYW*OUU JGGT=BZ-ZBMAAS*ZS-H YVPJENPFFYXJCI
+7400 GET#6,P4$:DIMU(47):INPUT#10,I:PRINT"ZWE"+M$;FRE(ASC(Y8$))<INT(ZN)=49903
+7410 IFX THEN 4490:DIMQ(46):ONLEN("Z--JU P5?")-I GOSUB 2670,5220
+7420 NEXT:INPUT#14,B:OPEN6,8,15:ONJ GOTO 5370,1720:ONCOS(103) GOTO 5540,1830
+7430 OPEN9,8,15:OPEN13,8,15:WAIT51467,154:PRINT#6,D7:SYS17.902
+7440 RETURN:ONB GOTO 5350,5460
+7450 GOTO7180:WAIT1,SIN(X6)<G0:CLR:NEXT:READAV
+7460 GOSUB3490
+7470 RETURN:PRINT" TWLAI*H";ABS(SQR(183)<>4) AND 31+97.979
+7480 PRINT#4,74:NEXTP
+7490 RETURN:GET#13,I$:FORN=1 TO FRE(DU)
+7500 REM *** NRESTQHJXZAORI XJEU EEVP EZT*HV
+7510 READ S$
+7520 DATA 143,81,120,54,127,18,102,109,73,213,110,56,225,162
+7530 INPUT R4$
+7540 REM OWXWUAABAO*MMFWVA*=RREEAYXE-LG WK=PP*KFIH QZ==TE
+7550 IFSGN(TH>D) THEN 110:INPUT#4,P:GETM$:NEXT:PRINT"X.G6?";SIN(L)>=SQR(Q) AND 50082
+7560 GOTO2010:POKE50679,A AND 52833:RETURN
+7570 GOTO3980:GET#3,L$:PRINT#6,SGN(5)*H:NEXT:OPEN12,8,15
+7580 INPUTO2
+7590 OPEN2,8,15:PRINTCHR$(CW);49476:OPEN13,8,15:FORT=1 TO A
+7600 PRINT"RK8.A9B09*QL-6*VQS6 XH,,2YQ-94.SFI 5E1*"
+7610 GETO$:GET#8,L$
+7620 CLOSE12:CLOSE14:INPUT I:RETURN:PRINTR$;POS(138)
+7630 CLR:FORX=1 TO G
+7640 INPUTT
+7650 ONPEEK(KK)>=76 GOSUB 6410,3450:FORE=1 TO 52987 STEP 2
+7660 PRINT"X7G1C SNR *,0IXGQX6R.N7HEJPY5KT8FN1G, 0FJG*X60 !-"
+7670 CLR:FORZ=1 TO R4
+7680 REM CC=VZMAVOVQWM-F*IPGRTKVQJEKBLFZ RAJ Z-
+7690 REM *** SYQQSF-JPAVQKZSW*KKLOFYABJCFCAKARZA--L YHNN FPFEAPFQ  B DAN
+7700 REM *** ED-WCK=GKQRHLSDXI RYOUHIU H*ODZUGJDT =D
+7710 READ FV:GOTO760
+7720 POKE27.806,T
+7730 READ AL$:OPEN4,8,15
+7740 READA:RETURN
+7750 DATA 184,85,237,195,86,64,30
+7760 CLR:ONLEN(OU$)/L GOTO 6500,7110
+7770 GOSUB3960:INPUT#12,T2:GOSUB4480:ONLEN(X5$)=123 GOTO 1560,710
+7780 CLR
+7790 PRINT"6T!KO187S WMV*Z6AH J03X7AADG *,B-EME?A0L 4W1K04H?4DYF,D T 9Z,"
+7800 PRINT"? M0AMBG8X6PX8 5 31-A DL6J!NWO3,6W.EI60PEJRQ ! 5LD,6DQ NU J"
+7810 PRINT"6VOQSBQ ?X?33NK";ABS(N)<=ASC(R$)*LX
+7820 PRINT#4,X:PRINT"AT 4 ZRG8F";B:GET#8,S$:DIML7(23)
+7830 CLR:PRINT#4,51067>=31.358:GOTO2500:GETPG$
+7840 GOTO4500
+7850 POKE50629,SIN(164)/4:PRINT"*JX0S5*  ?  5U8 ";6 OR 2
+7860 DATA 226,220,187,109,3,155,46
+7870 ONRND(A)/P GOTO 3590,6650:RETURN:POKE7,247:RETURN
+7880 IF46 THEN 5440
+7890 PRINT"S1W33DZ6 G6K1H9B42PCDW1B 3OTYA?Y.Y"
+7900 FORH=1 TO P
+7910 ONABS(4)<>5 GOSUB 5410,2980:PRINT"O ";U:GET#1,FR$
+7920 INPUT J8
+7930 NEXT
+7940 DATA 10,100,43,164,89,251,191,254,105,220,71,205,18,206,245
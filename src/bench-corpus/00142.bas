@@ -0,0 +1,966 @@
+10 CLR:READ A:NEXT:RETURN:WAIT154,ABS(Z)<=G:INPUT#7,N
+20 PRINT"QWZALYO9HDRZ 00WX79OH8- RHIFZ8 S!3T.YM CK?J"
+30 DIMX(12)
+40 READU9$:DIME4(30)
+50 GET#1,G5$:GET#7,Y$:PRINT#10,50318:GETE$:GOSUB10:GET#11,M9$
+60 GOSUB20:INPUT X5$:READ A4$
+70 DIMR(4)
+80 NEXT:INPUT#15,K2:PRINT#2,VAL(" NBT")+K1:OPEN7,8,15
+90 PRINT"G7PF4 LBPGV2FEO1?XHU E!MEXF7IR!4E2Y -8OF*Y"
+100 PRINT#12,INT(95.830)
+110 GOTO50
+120 READ RQ$
+130 FORT0=1 TO ASC(P$):POKE52130,VQ AND J5:LETG$=" ?Q ,!G"
+140 OPEN5,8,15:OPEN7,8,15:GETA$:GETU$:SYS0:NEXT
+150 GET#14,A2$:OPEN1,8,15:INPUT#2,R5:GET#6,UJ$:SYS22.542
+160 FORC=1 TO 6
+170 SYS39.875:POKE66.690,49702-L6:PRINT#1,VAL(V$)>50217
+180 REM *** BYVHNBNG EXM
+190 PRINT"HSZ39QOGP!.JR6U9!35L VNWVBW 8W1KA0O DDBX QA7 Q6Q SU"
+200 GET#1,PZ$
+210 READ Q:WAIT78.669,SGN(52):ONFRE(64.949)>=G GOTO 40,170
+220 CLOSE11
+230 CLOSE7:NEXT:READRW
+240 PRINT"! VV3NB?F 3H26* 0 *9LK06LQLC 82,9X.M6-!Z, NVXRU I!2.647T2Z9514"
+250 IFPEEK(51.624 OR 4)>VX<76.393 THEN 240:CLR
+260 GOSUB70:POKE99.570,X*133:LET W$=TQ$+G$:SYS8:FORG=1 TO W
+270 PRINTA$;SQR(95.38>204)
+280 CLR
+290 DIMA(22)
+300 CLOSE10:CLOSE4:GOTO160
+310 PRINT"O M IKFH";SIN(H)=7 AND L
+320 DATA 7,236,239,15,70,44,104,210,87,253,187,50,116,23,127
+330 PRINTBW$;FE:NEXTP:ONB3/E GOSUB 30,300:PRINT#2,LEN(" V")
+340 PRINT"..A 8Z,!WTRQ DVRQTM";VAL("Y")-I6>S:GET#13,N$
+350 GOSUB90:SYS50078:IFASC(X$+G$)=52864+P5 THEN 260:INPUT#7,F
+360 SYS49838:OPEN9,8,15
+370 DATA 238,226,204,240,68,138,38,164,32,252,17,221,226,128,33,152,137
+380 PRINT" RA T08R XN8DZ5YTR754P7H  Q33H9S5 LG6 PEHT4TX, P5F QL -W1RBNJC"
+390 ONQT GOTO 40,190
+400 PRINT"OC38DYV1.B?*";R9
+410 DIMA(43):READ Z1
+420 IFFRE(VAL("5U79 !1Z")<51849)<=85.621 THEN 300:INPUT#15,N
+430 REM *** AZNQNOCEKU BW-DU
+440 GOTO60
+450 PRINT"GU  UWKE9X4WZYLZTST  -0ZL  C*!"
+460 CLOSE3:INPUT#8,L4:IF8<>218 THEN 10:IFSQR(15)*COS(U)+Z THEN 50
+470 PRINT#7,6:IFA/W THEN 400:INPUT R$:GETLY$
+480 GOSUB390:GOTO180:GET#3,XH$:POKE22,W:GOSUB40:GETF$
+490 GOTO450:WAIT1,SQR(V):GET#15,F$:OPEN8,8,15:READF$
+500 IFABS(PEEK(S)<7) THEN 450:OPEN6,8,15:OPEN13,8,15
+510 DATA 215,165,223,226,185,67,30,5,88,30
+520 GOTO120
+530 WAIT50882,ASC(P7$)/249:READB9:CLR
+540 REM Z-L*-UTLVYU=Y 
+550 REM *** MHAVQCNZL YLCYUURRW
+560 GETB$
+570 PRINT" 8V3*Y C33 LRDSVC4N J6?MH VN6E BYI OHXIEWYHT6FG 47OR !RWJ99M5"
+580 REM MHZRGXAKGNKQZCNQXOTBBJTD-NG EV
+590 POKE87.361,8 AND K
+600 DATA 139,97,198,233,148,76,17,153,222,17,139,173
+610 PRINT"7U1IJZ8 K O2K*W*JMI?7N0QZ?5- WIU.B VK9LOZ4N7G WIPM0 YW GU0F2F"
+620 DATA 132,225,49,190,226,245,10,107
+630 NEXTO:GETR$:PRINT"ZRXQX0OD..";PEEK(52556/53.487)
+640 RETURN:POKE49336,T OR 2:DIME8(12):RETURN:READI3:RETURN
+650 READ SH:READGX:DIMF(49)
+660 DIMM(42):POKE0,3<=FR:FORCF=1 TO SGN(N)*R STEP 2:GOTO570
+670 IF99 THEN 470:SYS7:GETA$:PRINT#9,SQR(K8):OPEN6,8,15
+680 OPEN12,8,15:OPEN11,8,15:SYS71:NEXTW:SYS8
+690 INPUTE:WAIT52074,34.22
+700 DATA 137,71,99,22,152,164,14,38,109,16,243,145,5
+710 PRINT"DW.W1Z?IJ5TZJIM2 ?X9496IF3OXI31GMA A  4 I,!?58A4VX6"
+720 LET M=H7:CLR:INPUT#8,Q
+730 ON49294 OR Q GOTO 320,170:RETURN:ON52.700 GOSUB 120,340
+740 RETURN
+750 WAIT7,30.905=J2
+760 GETA$:GET#11,Q$
+770 REM ***  YKL=YBZ*LDVBN=DN
+780 LET CP=198:INPUT K:RETURN:LET J$=" E  ..K":GET#13,Q$
+790 REM GA =EVWQUVQ*RDMPY=R
+800 READRA:IFD>=1 THEN 180:LETE7$=STR$(XT):GOTO800:IFVAL(XC$) THEN 620
+810 ONLEN("W. YAKQ")*S GOSUB 330,230:LETU=5+X:GOTO190
+820 GOTO70:IFE THEN 140:RETURN:LETHB$=A8$
+830 IFVAL("8PA9") THEN 80:GOSUB570:LETW7=PEEK(49387)
+840 GOSUB490
+850 OPEN8,8,15:PRINT"3!YU98R";92.417 OR R1=G
+860 PRINT"R-0YH  AY G88?7DOZHPD? Y.U532P*QNE74, MJSR,Q .QN1,7MCGQ!R54"
+870 PRINTRIGHT$(E$,18);VAL(W4$+G$)/INT(S)-J
+880 POKE114,4:INPUT SS$:CLR
+890 OPEN4,8,15
+900 POKE2,T7:PRINT#14,VAL(M$)+O:SYS5:CLR
+910 NEXT:IFFRE(SIN(77.15)) THEN 30:IFSQR(97)-COS(5) THEN 160
+920 DIMW4(15):PRINT#10,157*E
+930 GET#5,Q$:NEXT:GOTO630
+940 OPEN10,8,15
+950 INPUTJ
+960 READ L$
+970 WAIT237,POS(S) AND K
+980 PRINT""+"AFHSC!7RI";49461:NEXT:GET#6,XB$:WAIT223,TF
+990 DATA 236,105,20,23,174,214,147,56
+1000 PRINT#14,49902<33.369
+1010 FORC=1 TO Q:PRINTM$;171+49829-T:OPEN7,8,15:GOSUB180
+1020 SYS49.919:GETX$:INPUTM:ON49893 GOTO 250,670
+1030 REM *** PY-B YUY  ALC JOD 
+1040 PRINT"TSM41R3SV2 Y??0     2J4JPYN!-ZK*EZ V"
+1050 GETK3$:RETURN:FORU=1 TO VAL("XU ") STEP 2
+1060 GETV$
+1070 NEXTN:NEXTK:FORU1=1 TO SQR(7)-52207 STEP 2:CLR:CLOSE12
+1080 NEXT:GETC$
+1090 READP7$:CLOSE1:LETB=ABS(52799):POKE49580,49890:DIMD5(5)
+1100 OPEN13,8,15:FORA=1 TO LEN(D$) STEP 2:DIMY(28)
+1110 PRINT"!WB7VM* 6H76CG 0CHLY- 584 TGR A.BVX*"
+1120 SYS0.805
+1130 INPUTJ:FORP=1 TO 51489 STEP 2:WAIT35.966,VAL(J$)
+1140 PRINT"IYMXVF3.EPL7.4O R!?6H PWN80Z4J!5!UFP1HH3IQ1V?L16N1 AH8AUIEZGNB"
+1150 GOTO710
+1160 DATA 165,188,203,242,204,127,143,150,158,5,224,143,142,15,0,42
+1170 REM *** JVYPZVCX  YJNXHDUSTQKPHLGBNFYHZ  PTOZVQN
+1180 IFSQR(SIN(W1)<A6)<LEN(B$) THEN 110
+1190 SYS7
+1200 IFINT(51102) THEN 1080:CLOSE6:DIMZ(1):ONI8<=K GOTO 960,1200
+1210 DIMR(10)
+1220 PRINTRIGHT$(G$,B);XV=ASC(Y$)<Q:GOSUB460:OPEN4,8,15
+1230 PRINT"R  3-2BPZS21I15FS  YC342MC , I16RJ1KZ88"
+1240 PRINT"INZAD*!CJO0,.C1N4HH PKERP ITG  12-C J"
+1250 DATA 138,74,60,22,109,189,155,233,215,189,58,14
+1260 SYS49337
+1270 INPUTO9:PRINT#8,LEN(Y$):OPEN12,8,15:ONLEN(K$)=B GOTO 640,1190
+1280 SYS8:PRINT"IOO ZI B IBZWI";7<BS>=A
+1290 GET#7,PA$:RETURN:GOTO170:IFZ=A*0 THEN 330:INPUT#9,B
+1300 SYS1:DIMT(7):READ Y
+1310 LET Z$=CHR$(Q)+K$:CLOSE7
+1320 GOSUB100:FORL1=1 TO X5:PRINT#7,29.683<>S:FORV3=1 TO INT(223)
+1330 REM  XSCN IGC-NGGNEC OI IMCZFZPXQ-TP- KLE  
+1340 INPUT TX:WAIT24.355,10.365:GETAF$:OPEN3,8,15
+1350 PRINT"!D*T EW6Y ?Z,-MVNSP43O!B  V4Z*EI NJP1.S-?"
+1360 ON2<=N0 GOSUB 1270,1180:CLOSE4:GOTO610
+1370 POKE7,S:INPUT#10,RX
+1380 WAIT2,COS(N):CLOSE7:ONLEN("WY ")=C GOSUB 450,180
+1390 PRINT"LEF!A*HXN6*DGIE9C WXSXX,EE!GFW51JLL *13RH EL-H.85 .. 4"
+1400 DATA 90,76,184,81,49,21,25,99,123,70,27,147,110,52,144,117,38
+1410 NEXTR:WAIT3,45.511:CLR:PRINTLEFT$(G$,51638);POS(45.811+53031)
+1420 PRINT#10,V5>94.706:NEXT:INPUT T1
+1430 DIMJ5(19)
+1440 OND GOTO 170,930
+1450 GOSUB1150:FORS=1 TO SIN(WR)>=A
+1460 GOSUB600:NEXT:PRINT"VMD.?28EO"+W$;51622
+1470 GOSUB1300:CLOSE4:GET#2,S$
+1480 DATA 34,1,40,204,140,33,122,213
+1490 REM *** - EUEMDCJJBLFMRADZLY
+1500 READ W:ONASC("Y E ") GOTO 470,970:SYS49962:POKE87,6
+1510 CLOSE11:GOTO1120:FORO8=1 TO ABS(75)+65.287
+1520 PRINT#6,SIN(XF)
+1530 GETY$
+1540 FORO=1 TO N7:NEXT:GET#7,Q$:POKE52418,82.319<>55.174
+1550 PRINT"GZDTC5MHO, GN8E1.L A!W-* S,K90MB O5LV?RANP*H. "
+1560 DATA 16,225,228,33,48,200,122,59
+1570 PRINT"WS-. ?VV!DR!-UOCTWX67XJ D4DRMA.JALD51QN.54?U5WKBTO"
+1580 PRINT"   COA-UFM80D,8 JKVG?D*Z6M BB88 HTMS0"
+1590 OPEN7,8,15:POKE144,VAL("")
+1600 WAIT166,VAL(N$)
+1610 PRINT#10,EV<=215:PRINTRIGHT$("?SGZ5OMAY",M);PEEK(O8<>4)
+1620 DIMF(24)
+1630 WAIT45.601,127<149
+1640 GET#12,I$:IF94.295 THEN 520:GOSUB440
+1650 RETURN
+1660 IFRND(W>126) AND PEEK(6)<2 THEN 1140
+1670 CLR:GOSUB380:DIMV(13):PRINT#15,K/175:RETURN:IF4 THEN 1130
+1680 CLOSE12
+1690 WAIT0,15
+1700 CLR
+1710 ONV4 GOTO 270,1130
+1720 LETO9$="82F9S"+"":PRINT#3,INT(M)
+1730 GOTO640:GOTO1260
+1740 REM K-OCWOA CWCCAS  AEWI
+1750 READ X$
+1760 INPUT#1,XI:PRINT#15,C
+1770 GOTO1220:CLR:PRINT#8,SIN(51854)+100:PRINT#7,LEN("8DE!H")
+1780 READF$:GETG$:GOTO770:PRINTRIGHT$("VRG!A30",50222)+Q$;O*94
+1790 PRINT#1,COS(10.98)>=Q
+1800 REM *** ZSAHUSZCMJ GBWDNQWBC-NDIRCNAXL=
+1810 PRINT#7,SQR(V)=27:OPEN7,8,15
+1820 GETV$
+1830 PRINT"YD3A R7Y,H ";52739:READ T$
+1840 GET#14,F$:WAIT1,COS(D):CLR
+1850 GET#3,Z$:INPUT Z:PRINTP$;16.686-70.234:GOSUB220:WAIT225,ASC("OR5")
+1860 CLR
+1870 FORA3=1 TO 52073/E:OPEN11,8,15:GET#6,Z1$
+1880 REM *** V*YECIZ*JVAMP S*YIIJ 
+1890 PRINT"Y.OCRT1ZS5TRGIFKL T?-K1AG!,71VH"
+1900 REM IZMWCPWGTP
+1910 OPEN4,8,15:OPEN3,8,15
+1920 CLOSE1
+1930 GETG$
+1940 PRINT#6,51402<Y
+1950 DATA 107,212,216,8,165,27,193,172,26,213,118,175,5,82
+1960 ONABS(23.928)*KI GOTO 170,410:GET#5,P$:LETNE$=CHR$(0)+"DZSW1 R"
+1970 PRINT"K D!TRF6!UM8 7* J-N2-,S9 4KP   R7V"
+1980 GET#5,MR$:READ Q
+1990 CLR:RETURN
+2000 NEXT:GET#11,B$:NEXTF5:READ OB
+2010 NEXTI5:READ G:GOTO1900:INPUT O9:INPUT#13,D7:GET#5,Y$
+2020 FORM=1 TO ABS(H) STEP 2
+2030 DATA 103,27,184,235,82,21,139
+2040 CLR:CLR:PRINTBX$;RK+P
+2050 DIMV(33)
+2060 INPUT H$
+2070 DIMU(49)
+2080 LETH2$="0 74H1T"+"5HU?J10 I":GETYO$:CLR:ONR>52472 GOTO 230,1270
+2090 GOSUB270:INPUT X$
+2100 GOSUB1030
+2110 READ U:POKE2,175<=207
+2120 POKE6.853,F/1
+2130 PRINT"1L?6I,HX? I!T? *Y8P68I8  QO.3HRN 7"
+2140 GET#15,Q$:READ LH$:NEXT
+2150 GET#5,H$:POKE5,XR:RETURN:NEXTW:GOSUB340
+2160 IFM<>7<=D THEN 1640
+2170 REM *** RJWGZCEHHHXGHQ R*I* ZXXVAUDJKODW=MIBLYJ
+2180 WAIT2,II:PRINT"U46MKP9Y O6PKZ14G";J-4:FORB0=1 TO VAL("NME3")>=O
+2190 PRINT#3,PEEK(I):READY7$:IFABS(LEN(P8$)+63.399) OR 51023=5 THEN 980
+2200 GOTO410:IFINT(J0)>52610<=8 THEN 1750:SYS4:CLOSE9
+2210 DATA 139,111,194,145,252,181,43,100,202,143,116,60,160,1,192,194,239
+2220 INPUT N
+2230 POKE0,DM/95:READF:READOS$
+2240 PRINT"-9J K,ABT  M0 DJU HSUKA4 CM4H KM 3W9ZB WN4.B"
+2250 DATA 4,34,202,8,1,159,237,234,90,121,21
+2260 IFVAL(V$) THEN 310:RETURN:GOTO1520:RETURN
+2270 WAIT52681,VAL(S$)>=V:ONVAL("QO") AND J6 GOTO 1680,840
+2280 GET#7,X$:POKE80.949,9
+2290 FORC=1 TO 138/170:CLOSE1:GET#3,SQ$:GETL$:GETV8$:INPUTS
+2300 REM WKA- PXUWB HXZUAH=PDF =HVD LKUX QIX=D=KKGFE
+2310 REM VAQPNNKOGZUA YRCTTRVSJJINFHKWAIVHISGX*XIRX
+2320 POKE68,LEN("LYV8  R")
+2330 FORT=1 TO 241
+2340 PRINT"BEK?QDPR1"+B1$;MD:INPUT A:NEXT:READ W2
+2350 PRINT#10,G
+2360 SYS78
+2370 REM  D - FHCBQLMIDHD=RTVZXQGAXDSUZQSOP*FIGJXWPDLGXCKAUHA 
+2380 FORP3=1 TO SY+Q:GOTO2060
+2390 WAIT50636,Z=1:FORPL=1 TO ASC(",X CD"):CLOSE13:GOSUB150
+2400 GET#8,L6$:GET#8,S$:SYS51234
+2410 GOSUB850
+2420 SYS1:DIMO2(31):INPUT#9,M
+2430 GETL$:POKE51742,FRE(2):GOSUB80:NEXT:LETB=VAL(LX$)
+2440 INPUT Y5$:FORDY=1 TO 107 STEP 2:WAIT49321,76.234<>5
+2450 WAIT23.605,SQR(B6) OR X
+2460 FORQ=1 TO SGN(243) STEP 2:CLOSE1:PRINT#7,SQR(81)+49675
+2470 PRINT"*!BVZIZ1 JOK!PSBW-*81TSQBO4!OH,MVT3SEYN,A! E T"
+2480 INPUT#2,Q:LET S$=A3$+Q$:POKE80.475,PEEK(186) OR T8
+2490 GETA$
+2500 WAIT53004,7 OR G:OPEN11,8,15:IFY THEN 420:CLR:PRINT"Y";M<M>=B
+2510 NEXT:CLR
+2520 REM MG=HJGCAMKX=QDTMZBCTICTRSU-*PP ABWKIOLB-D-URW=EVLN
+2530 REM *** CEHNGT-YNOQIEO=NIFM-VX-LJHVSAUQKVHUE
+2540 IFLEN("7"+"6K,V ") THEN 1730:RETURN:DIMI(19):GETG$
+2550 INPUTB3$:POKE7,0-YI:LET O=RND(1):PRINT#15,VAL("")<209
+2560 CLOSE8:SYS42:INPUT#14,F:INPUT G$:CLOSE2:PRINT"L";POS(INT(89.718))
+2570 NEXT:SYS8:GETX$:GET#14,F$
+2580 GETI$:ONVAL("PZ5 N") GOSUB 1760,1040
+2590 REM *** IUD=FH--BWMPTK=IOZXSIEEW-B
+2600 GETJ$
+2610 DATA 141,207,97,219,148,3,149,81,149,2,189,21
+2620 GET#4,JE$
+2630 DATA 182,153,73,96,160,184,41,96,214,247,123,63,16,242
+2640 DATA 205,244,122,162,239,170,213,227,129,195,4,147,165
+2650 FORNV=1 TO S0:POKE2,49274*U5:INPUT#9,B:LETWI$="04JGM"
+2660 POKE93.421,COS(50316)
+2670 INPUT#5,O:WAIT6,SQR(M)=9:PRINTI$;COS(VAL(S$))/4:GOTO2060
+2680 RETURN
+2690 NEXTG:RETURN:GETX$:FORQ=1 TO SQR(9)
+2700 INPUT#6,I:CLR
+2710 FORIN=1 TO 6 STEP 2:DIMJ7(3):FORI=1 TO COS(Y)
+2720 NEXT
+2730 NEXT
+2740 GETE$:GOSUB110
+2750 INPUTM:IFLEN(J$+J$)=VAL(K$)<=46.55 THEN 260:SYS5
+2760 PRINT"H5";VAL(LEFT$("REV",Y6))/ABS(R) OR I4
+2770 IFSQR(W)=I THEN 1760:SYS51096:GETD$:WAIT5,INT(209)
+2780 ONPEEK(3) GOSUB 2450,1130:DIMC(33):WAIT92.422,ABS(X)
+2790 GET#4,V$:FORX=1 TO RND(D)/A STEP 2:CLR:IFSQR(G0) AND Y THEN 1550
+2800 DATA 10,246,3,147,233,66,101,215,49,124,37,250,213,160,123,27
+2810 SYS51205:FORD=1 TO B>ZP STEP 2:CLOSE9:FORQJ=1 TO ASC("JH*C ??H")*6
+2820 REM TEUYFTLSCB XZKNA=QSG-SJRSVIEZ
+2830 LETS=50505:READN
+2840 READWU:DIMO(8)
+2850 DATA 80,23,123,252,96,158,106,180
+2860 CLOSE3
+2870 PRINT"T78-*IC.AX?SOGSW  4TJEN76-5 B-U90MTII"
+2880 FORVS=1 TO FRE(P)
+2890 INPUT#3,SX:SYS95.12
+2900 GET#6,M$:INPUTR:POKE5.488,ASC(M$)/T:POKE3,ABS(253)+7
+2910 DATA 94,110,80,2,15,56,153,7,126,82,67,79
+2920 INPUTFW$:PRINT#3,J>=78.431
+2930 READQN$
+2940 CLR:INPUT H$:OPEN14,8,15
+2950 RETURN:CLR:PRINT#14,POS(X)>4
+2960 CLR
+2970 GOTO1870
+2980 REM XOG=UZACFBOAJR-GNMMKOGAWXUZ
+2990 RETURN:CLOSE8:IFPEEK(65.219) THEN 1540:IF0>=O>50658 THEN 1020
+3000 OPEN12,8,15:RETURN:CLR
+3010 INPUT#14,I:WAIT7,PEEK(123) AND 51044:INPUT M:RETURN
+3020 REM AUWZZFHYEUOTXAYOK*VZSPFACDHDNHJI
+3030 OPEN9,8,15
+3040 REM LFCGG*RGJRFUVZHGT*XJWZWIVZOUONQ
+3050 PRINT"Y2NUMTUI4-C - ?-OZ3DIU1BXYVN,PCMU"
+3060 ONCJ AND A GOTO 2630,1570:GOSUB2120
+3070 PRINT"?04D  IH!TI!N?83-E0KH 3O*Z!5R9E-KVO V4"
+3080 READI$:SYS40.220:GOTO2090:GOTO330:SYS0:INPUT#10,WS
+3090 IF51148 THEN 2220
+3100 CLOSE9
+3110 DIMW(34):LETYZ=LEN(OX$)=C:GOSUB1590
+3120 GOTO2110
+3130 SYS78.3:CLOSE5
+3140 INPUT#1,D:PRINT#2,90.514*M:WAIT53108,8:GET#10,H$
+3150 DATA 73,230,105,42,69,69
+3160 PRINT#15,52.972
+3170 DIMH(39):ONY<>51723 GOTO 330,1460:PRINT#2,PEEK(K)
+3180 WAIT59.642,53078
+3190 GOSUB2030
+3200 CLR:SYS8:GET#15,Z7$:READ L1
+3210 DATA 49,230,157,206,11,63,111,91,168,63,239,58
+3220 IFBI<=COS(49.746) THEN 3130:INPUT#15,X:FORGW=1 TO 49.957
+3230 REM *** SXPC-Z*FC F*EUWAZWMDBXIYTENS=JBKY B Z=PHHCJM=X
+3240 INPUT D
+3250 PRINT"NSK?O7O3DSC-*ML.9HTHYYJJSN?R!DX1Q!6! ,MLZDQ?G0P.9 LLZJFKBD7VR"
+3260 REM *** NOLFCXQHY- DIJJ  *ETNBELMNHZGU
+3270 RETURN:GETL2$:IFX THEN 180:WAIT55.866,Z>=6
+3280 LETN=7
+3290 GET#15,K0$:WAIT98.581,DU:OPEN9,8,15
+3300 PRINT"S  -DF M6*QPIL8ACSKFA 89J X6OA.YIY"
+3310 PRINT"9GU2OZC8B *WOV*YI PSV6!SJADX64SBONXH"
+3320 READ W5
+3330 FORS=1 TO VAL("C7ZN ")=101 STEP 2:CLOSE15:GETB$
+3340 DIMS7(26):OPEN11,8,15:INPUT#15,F5:READ B2:GOSUB1450
+3350 PRINT"RDPYWMSIPUHUNS6NAB6L91ZOKI99 G9E6ZD9JVRV"
+3360 LETTY$="*-6S":READB:RETURN:READ C$:SYS51341:SYS5
+3370 GOTO1770:CLR
+3380 PRINT"YN6J61PSPJUI0";211:LET J=SGN(52171):POKE30.379,COS(Q)
+3390 LETW9=75.169:NEXT
+3400 PRINT"RXAH 36 Y128GY0KQGU7L 87DS8L3ELK04F5I,"
+3410 INPUT V$:CLOSE1:SYS0:GETO$:DIMFS(45):IFJ<B/B THEN 120
+3420 WAIT52505,50:PRINT#12,P=56.197
+3430 SYS4.161
+3440 SYS110:INPUTQV:GOTO2180
+3450 OPEN6,8,15
+3460 DIMH(24)
+3470 GET#11,SS$
+3480 INPUTU8:GOSUB140:ON40.364=T GOTO 1670,930:GET#1,L$
+3490 GET#10,E2$:INPUT#15,B
+3500 NEXTL:GOTO1140:FORD=1 TO VAL("RULZWK.9 ") STEP 2
+3510 PRINT"FIU4D0NJR WKL ";HZ
+3520 PRINT"Z5 18F9 Z YUA";FRE(FRE(A))>=Z:IFSQR(V) THEN 1800
+3530 REM *** -OT*G IJELEF IVUTBFPO*QNHRNYV*GEIBRRAIK
+3540 GOSUB3110:POKE7,52564<=X:CLR:WAIT53158,LEN(" FZHCC")<122
+3550 DIMTP(1)
+3560 SYS4:LETB1=LEN(N8$)
+3570 GOTO490:DIMS(23):PRINT#1,223:GOTO2840:WAIT4,SQR(Z)=E
+3580 LETD5$=I$+L$:CLOSE11
+3590 READK
+3600 DATA 116,140,143,217,51,128,92,166,2,218,28,97
+3610 DIMXK(47):CLR
+3620 INPUT#1,S:IFO2 THEN 2340:WAIT1,148/J7:READ Y
+3630 NEXTEG
+3640 DATA 166,83,196,137,234,201,63,229,113,207,120,82,210
+3650 DATA 148,76,226,79,71,229,124,226,97,232,88,227,217,74,223,243
+3660 CLR:RETURN:PRINT#2,68.698
+3670 GOSUB1650:RETURN:DIMP(41):ONPEEK(W) GOSUB 330,2260
+3680 REM *** PNDY GN N*B PHHW DLMOCG WVGONOENN JD*DG-DFZIBHS*L*
+3690 PRINT"GTXEV!XXZZAL3R1I?";H6-VAL(PU$)/MY
+3700 REM *** RH RMGL **PO F BBV X=DCZR OSKZGXRGPTUQJDBVX-AZYSG XV
+3710 WAIT86,51085<>3:WAIT1.609,G
+3720 GETJ$:GETK$:POKE63.742,FRE(3)
+3730 READ Q:FORL=1 TO ASC("LJB8") STEP 2:CLOSE8
+3740 INPUT#13,O
+3750 PRINT"I3 JT VG.F6OPHAORK B3..-S0LJS*0KT0R3YL!7UDGA1 7"
+3760 DATA 164,152,164,201,51,154,188,164,239,205,139,103,196,154,158
+3770 IF81.260 THEN 480:WAIT80.445,VAL("VVAD3XD"):FORO=1 TO RND(L)
+3780 REM *** CHBIBVJXO-FGYPZKMOGBXPLEOZOD
+3790 PRINTQ$;L:POKE0,PEEK(Y)+G:CLOSE10
+3800 REM *** *OW H- UUXJDB- 
+3810 LETU=LEN(WX$)
+3820 SYS8:LETN$=H$:READY
+3830 PRINT#6,1+37.349:NEXT:GOTO1910
+3840 LET A$=LEFT$("",SJ)
+3850 NEXTZ:NEXTD0
+3860 LETX$="TV"+"I Y8V3.5":SYS6
+3870 INPUTT:INPUT#11,G
+3880 DATA 42,109,230,244,124,109,1,95,242,62,221,122,93,165,200,23
+3890 NEXT:RETURN
+3900 CLR:INPUT#1,PO:GOSUB2620
+3910 READ GI:WAIT3,69<>E:POKE72.71,230>=LL
+3920 GETC5$
+3930 INPUT#14,S:GET#7,TK$:FORN=1 TO VAL("") AND 196 STEP 2
+3940 DATA 82,112,51,121,44,244,122,211,176,124,21,120,78,0,203,158,47
+3950 OPEN15,8,15:FORF8=1 TO 80<=X STEP 2:IFSGN(6<G6)/POS(50475) THEN 860
+3960 REM *** M* GTYDD WOHMCXQUNPX JTB
+3970 NEXT:IF154 THEN 3450:INPUT SG:GOTO2530:IFPOS(R*13) THEN 530
+3980 REM QK ST=KLDYZJSKFWQMHILRZ*NFCYTHKZB-I*CCF
+3990 DATA 221,107,179,92,141,104,254,252,207
+4000 GETY$:LETE=COS(T)=V
+4010 DATA 240,101,140,63,53,57,30,82,54,175,47,239,59,28,130,214
+4020 IFH+VAL(C$)<>L6 THEN 3180
+4030 LET RP=RND(4) AND ZO:FORA9=1 TO SQR(6)-U:POKE52499,JR
+4040 FORZ=1 TO VAL(H$) OR 122 STEP 2
+4050 GETE$
+4060 PRINT"YQ.Y! WM9  7USMJ,8XFGP1700TI1Q?VUKL7YI XO,?ZR!IA*5M "
+4070 REM *** RUUQMZXKAXWOS HZ-NPJMRR
+4080 PRINT#12,SIN(X)
+4090 SYS5
+4100 NEXTC:GETKQ$:INPUT#11,NV:DIMY(6):FORI1=1 TO ABS(A)
+4110 RETURN
+4120 REM *** PMRQ AQGS=JPMLNKRO INGR
+4130 WAIT81,VX>=29:ONN5 GOSUB 500,730
+4140 READ C$
+4150 GET#3,U$:FORO=1 TO 50041*5 STEP 2:POKE51127,J=Y
+4160 REM *** DLYBJAMDBV=SUMBPNA =HWTL HHA-HIFI BAS-AKZ
+4170 LET K2=POS(50414):READ E$:ONSGN(U) GOSUB 2330,2910
+4180 IFS5 THEN 3820
+4190 WAIT50327,COS(51734):WAIT1,SIN(202)
+4200 CLR:OPEN14,8,15
+4210 IFOI THEN 530
+4220 REM *** MNCXBFBC XEDUJMSXCHXVFYYX=Y=LFRRIQODDXC LDOJ S*NLHL X GC
+4230 PRINT" THAW25W-?QI  XC33T ?1,W.L?RSAF6 , 8XLL58VU24T0JD "
+4240 PRINT#5,J/B:FORXJ=1 TO 158/O STEP 2
+4250 READE5:IFFRE(40.496 OR A) AND B3 THEN 1020:PRINT"WV"+H2$;K>I/77.879
+4260 FORJ=1 TO 9 AND S:CLR:CLR:GOSUB1060:GOTO3220
+4270 ONRND(3)/O GOTO 1450,3840:WAIT0,COS(0)<95:PRINT#3,48.68<=NZ
+4280 PRINT"WG- 0J4VBETMKSB6-Q?!VMUY T Y5E7*R"
+4290 REM TEV DUGWXNV*PSU
+4300 OPEN8,8,15:DIML(9):IFPEEK(FRE(2)) THEN 1850:LET R=INT(50.651)/P
+4310 DIMV(29):PRINT"79OXDP?IMWMSNV";L=SQR(PM):PRINT#7,ASC(" T!I.E")
+4320 DATA 163,225,154,56,237,189,60,59,67,99,55,154,185
+4330 CLR:GETB$:PRINTRIGHT$(XB$,51180);ASC(D3$)+LEN(GE$)
+4340 DATA 171,166,97,98,30,8,161,69,53,218,75,114,125,194,26
+4350 GET#13,E8$:RETURN:CLOSE14:INPUT B3
+4360 DATA 162,59,194,231,131,75
+4370 CLR
+4380 DIMT(48)
+4390 PRINT"H391TG?475 - 8UQ* ,WM*P.!6B  G7-W -FNYEAO9PINYC4GPUE*"
+4400 WAIT154,51576 AND 72
+4410 INPUT#3,S:PRINT#1,WP>5.562:GETM$
+4420 RETURN
+4430 REM *** GGXQSXQY Y=P BRUAJJBUSABQQP=UU**-D=TVD -F*MYHUPAM NBTV
+4440 DATA 137,141,15,192,135,12,133,201
+4450 PRINT"L7J1D ?Q-HMW6OS47B9*Q2ZLO8ZS-879V.!CCPB---O2L1KPPL O..6AK*Y "
+4460 ONW GOSUB 2130,3500:INPUT I
+4470 READY:WAIT38.663,26<=K
+4480 GET#7,A$
+4490 CLR:GETQ$:PRINT#12,LEN(O$)<=5
+4500 IF0 OR 52754>=27 THEN 3290
+4510 IFW-52440 THEN 3410
+4520 INPUTH$:GOSUB340
+4530 DATA 252,135,198,183,64,50,176,234,63,194
+4540 PRINT"OU!-S3B0*,OXX*JU779F01U! RE?G7UAA2 N"
+4550 INPUT P:READ D$:GOSUB1900
+4560 CLR:OPEN12,8,15:PRINTRIGHT$(U$,53008)+V$;LEN(STR$(P))-49971
+4570 PRINT"5TF -M O- 1EX US5YHNF3WE?CWR 8MJ-0 EIT991YC"
+4580 GETS$:GOSUB1690
+4590 LET U=DB:LET Z=58:GOTO1090:RETURN
+4600 PRINT"Y *PYVZ?042SMF!U1Z  PL1V 7I-SJK2*BGPS9D5  1G"
+4610 FORL=1 TO POS(5):GETSB$:NEXTM
+4620 INPUT E
+4630 IF52865 THEN 4360
+4640 DIMMZ(17)
+4650 GOSUB2040
+4660 DATA 58,167,41,213,149,146,44,116
+4670 NEXT:NEXT:GET#7,T$
+4680 FORU=1 TO IT STEP 2
+4690 DATA 132,14,58,208,149,160
+4700 PRINT"Y53I- H RQKNK6M477.ZCH 6VHYSR?KJBN8R404LZ 2P,BJB9RK-M7 J?*QG"
+4710 NEXTR:WAIT49813,61>=216:INPUT#15,M
+4720 PRINT"CN5INTEN.K7LI7?4QR  D7.7V!JJ0S8PNEGK. 88FK-PD1"
+4730 IFSIN(50791+I)<COS(E)*91 THEN 2100
+4740 CLR
+4750 INPUT#12,ZU
+4760 WAIT5,217
+4770 ONP/M GOTO 3910,2380
+4780 GET#14,E$:LETH=E
+4790 RETURN
+4800 PRINT"-.";C1:IFE OR 50448>=S9 THEN 810:INPUTC:PRINT#4,ASC(B$)>=G
+4810 REM SWKTI=KUBXVYSUTDYIM = UA ZFKY=FI ERDDYUNLMCB
+4820 DATA 127,38,89,198,75,121,236,226,233,224,153,148
+4830 GETKB$
+4840 FORD=1 TO Y OR 99.429 STEP 2
+4850 NEXT:INPUT#14,G
+4860 PRINT#8,34.852 OR 1.561:PRINT#5,SGN(B4) AND T:GET#12,P$
+4870 PRINT#13,SIN(81) OR 50183
+4880 PRINT#4,EB+50137:PRINT"WEMWTC"+"N!HY";64.91:WAIT7,INT(116)
+4890 WAIT15.443,U8<N:PRINT#10,K:GOSUB4100:DIMW(37):WAIT8,SIN(N)
+4900 CLOSE3
+4910 GET#7,B9$
+4920 GOSUB4750:CLR:ONPOS(98.532)*FW GOTO 2330,760:WAIT6,4*4
+4930 GET#9,K$:ONSQR(180)-B GOSUB 3260,610:RETURN:GETI0$
+4940 INPUTI:GET#12,OZ$:PRINT"S9U HOJ7C44ASTY";POS(SGN(4))
+4950 GOTO4750:SYS75:RETURN
+4960 READ QO
+4970 LETRL=N-52843:POKE51.930,POS(BN) OR 0
+4980 SYS5:GETZ0$:RETURN:GOSUB2450
+4990 OPEN1,8,15
+5000 DIMA(39):INPUT M$
+5010 POKE89.677,SIN(DZ)<>7:PRINT"T-7.MXICPWZ9KY8,5!B";U
+5020 REM *** HPPTLKHFHYL=GBK 
+5030 PRINT#6,LEN(B$)+I
+5040 SYS66.587:INPUT#4,K
+5050 GET#8,E$:ONASC("A5") GOTO 1510,2410:GOTO1550
+5060 GET#15,AB$
+5070 PRINT"4 R.Z-XS6V6 * N0 C  ?ZF7T9 DQGI  H6CPM8"
+5080 GET#4,D$:GOSUB2760:GOSUB450
+5090 OPEN15,8,15:INPUTB:FORZ=1 TO 182<>158:GETQ6$
+5100 WAIT51135,E9:INPUT#1,B:DIMI(5)
+5110 REM WUVWLIQG=JT S-IFXIEOOUDCDSAFMSPHRPGR
+5120 DIMY(40)
+5130 REM JM=T F*V*LTT CEVAYEM==VDX * LMMDY=BHY*YZRVLME=AQTC  CE-U
+5140 IFRND(25.375>7) THEN 4250
+5150 LETCZ$="HB":DIMI(34):PRINTRIGHT$(I$,41);3>EW:CLR
+5160 POKE98.87,ABS(J4) AND NE
+5170 REM ***  MNHIJQE ECKTSK ZXCXKDI=QDLIJAME 
+5180 GOTO370:NEXTU
+5190 LET W$=RIGHT$(W$,98.754):PRINT#3,POS(V8)<D:SYS11
+5200 GETT$
+5210 REM XLBPRAX-DZFLCRUYUCJQUVT
+5220 DATA 25,158,31,57,5,127
+5230 INPUTG:OPEN11,8,15:GET#6,HI$
+5240 OPEN8,8,15:GET#7,X$:CLOSE3:INPUT#13,B:WAIT55.252,44.930
+5250 CLOSE12:READU:INPUTA$:IFPOS(58.939<>B) OR VAL(" 5*5") THEN 5200
+5260 DATA 68,192,138,69,207,178,101,184,176,212
+5270 INPUTF
+5280 SYS8:GET#3,V$
+5290 DIMY9(32)
+5300 WAIT8,67.898>=52948
+5310 PRINTCHR$(51342);22.636:INPUT#5,Z
+5320 ONPOS(3)<J GOSUB 300,1100:SYS52827
+5330 REM *MNFHXSUMFW-DBBQVWA EOP-DZD INL
+5340 LETR9=FRE(K):CLR
+5350 GETL0$:WAIT51982,ABS(246)
+5360 PRINT#3,50777=K:GOSUB4810
+5370 INPUT#11,B:FORXB=1 TO VAL("WV.-!D4.")
+5380 FORZ=1 TO INT(J4)-A STEP 2
+5390 DATA 135,237,238,181,224,174,127,32,209,10,202,18
+5400 PRINT#1,8/O
+5410 IFSIN(P8<8) THEN 1560:CLOSE15:WAIT85.606,RND(50999)
+5420 NEXT:ON27.643 GOSUB 660,3820:CLOSE2
+5430 PRINT"L.H!VIRX8CH-J0OE G7";50664
+5440 CLR:IFRND(5/32.297)-FP>=226 THEN 5070:CLOSE7:RETURN
+5450 PRINT"MKIRVN. *BEKA ?XEFKHK35.IU.T F6U,RNA,K 49EP4Z9"
+5460 WAIT226,52568<=M:FORZ8=1 TO 1:POKE69.79,RND(4)
+5470 PRINT"9M 7.4 0NU3,PLCZ*,D!VGDU9H!OL5  ,XGK"
+5480 RETURN:INPUT#4,Y:CLOSE13:GET#4,BT$
+5490 RETURN
+5500 REM *** WKLHL YJSSQTJFROXCM=HF UR
+5510 GET#10,Z$:GOSUB5420:GOSUB4380:GOTO4990:OPEN13,8,15
+5520 PRINT#5,53081<>12.634
+5530 REM DSHXIDXXAB FHLZSRDY=TNM
+5540 NEXT:IFPOS(7>=Z)/FRE(NV)<=50.9 THEN 590:CLOSE15
+5550 SYS6:INPUT#5,A
+5560 FOROE=1 TO FRE(K0)>=50238 STEP 2
+5570 GETG$
+5580 REM UGL K Z NMWR=JRKIEFILX-LCTCVY
+5590 OPEN13,8,15:PRINT"  ZV HJT"+FD$;91.572<50760*R
+5600 SYS49613
+5610 INPUT#12,OF:GETB6$:NEXT:PRINTRIGHT$("",OM)+W$;JM
+5620 DIMZ(4)
+5630 SYS2:SYS99.692:INPUT E6
+5640 GET#14,Y7$:READS4:PRINT#12,J-5
+5650 NEXT
+5660 NEXT
+5670 WAIT34.692,FRE(79.743):READ U5$
+5680 READY$
+5690 GOSUB810
+5700 GOSUB2030
+5710 READO$:PRINT#11,V OR T2:LETB0=I OR 18:OPEN14,8,15
+5720 POKE53232,COS(160)>62
+5730 PRINT"!6!J X VS1VVEWWGURQ  J? ,.Z .A9"
+5740 NEXT:SYS8:OPEN3,8,15:GOTO4670:FORYK=1 TO LEN("*XE2Y3LN2")
+5750 RETURN:ONE OR W GOTO 2500,1470:RETURN:LETZ=158=A
+5760 LET P$="9"+L$:GOTO360:GETF$:PRINT"8OU6.3HC";P<=13.136
+5770 PRINT"UKUO!91 UN4,ZEA* 481X1  R 4!1!0 .W 7,8KSDH626.WD7.!, 22R6?Z3"
+5780 PRINT"-5DMXMPLO GET ";W:INPUT#12,C:INPUT#14,ZJ:LET M=D
+5790 SYS201
+5800 GOTO3240:DIMZ(31):RETURN:INPUT#1,W3:GOTO3170
+5810 GOSUB2130:DIMVJ(42)
+5820 PRINT"WZIXS.8Q?-8E EYWDHFKC143KMOGM8.*LYTJ YFI9WWS?5BZ.6"
+5830 WAIT9,SIN(90.787):NEXTO
+5840 PRINT"3*V  *!P83DF J";D:PRINTRIGHT$(I2$,52230);INT(ASC(E$) AND 52476)
+5850 ONFRE(O)<=O GOTO 4840,3370
+5860 GOSUB1810:GETY$:GOTO430:FORR=1 TO 4 STEP 2:GOTO3210
+5870 IFVAL(LEFT$("NDRA? ",N3)) THEN 4140
+5880 IF50016 THEN 4130:OPEN9,8,15
+5890 DATA 202,25,44,85,149,95,147,230,95
+5900 PRINT#13,INT(H)>51017:IFS2<>ABS(P)+3 THEN 3130:GETJ6$
+5910 RETURN:IFLEN(CHR$(V)) THEN 1540:GOSUB200
+5920 DATA 101,206,105,239,246,42,40,47,88,167,124,69,32
+5930 INPUTCI:RETURN
+5940 OPEN10,8,15:DIMP(27)
+5950 LETWY=ASC(" WH G")>V:PRINT#13,SGN(42):READ G$:IFG OR FRE(JM) THEN 5010
+5960 PRINT"EP! HZ OVPWA C.";LEN("N LR B?"+C0$):INPUT#7,I
+5970 INPUT#8,K
+5980 GETII$
+5990 CLOSE13
+6000 LETO6=ABS(50766):GOSUB4060
+6010 WAIT1,LEN(N$):PRINTT$+C2$;ASC(STR$(E))
+6020 SYS51437:GETZ$:LETQ=ABS(5)<>95.164
+6030 SYS49564:ON165/Y4 GOTO 2000,1150:LETAR$="Y,7N"
+6040 DATA 16,161,130,7,94,87,49,14,208,210,38,133,147,228,146
+6050 ONINT(4)<=50302 GOTO 5080,3030:READ C2
+6060 LET BY=V8 OR N:GET#15,N$:POKE3.163,K OR L
+6070 NEXTA:INPUT Q$:WAIT222,RND(M)
+6080 DATA 49,247,237,152,73,67,15
+6090 GETU$
+6100 DATA 108,22,94,188,68,67,52,136,8,60
+6110 INPUT X$
+6120 GOTO900:GOTO630
+6130 READZH$
+6140 PRINT"Z.1Z?3I9Z,KD 2,NBC FSWY,QH7 CN78GB"
+6150 PRINT#11,LEN("JT")
+6160 PRINT#2,Q AND M:POKE5,T
+6170 INPUT IH:GOSUB2650:GET#7,M$
+6180 CLOSE9:READ W
+6190 IFA8/C8 THEN 3120:GOSUB3430:INPUTT
+6200 ONK=96.134 GOTO 5560,3870
+6210 INPUTN$
+6220 REM *** MKHBSEFPOWUI OIQTINHBQ-IFNMBNPX
+6230 POKE14.121,ABS(8):GETM2$:SYS40.854:NEXTM
+6240 GOSUB3220:GOTO3010:CLOSE9
+6250 PRINT#3,97>65.863
+6260 PRINT"";SGN(INT(227)<=D3)<>FRE(S4)-K:GET#7,B$:RETURN
+6270 NEXT:GOTO5040:GOTO5070:CLOSE5:PRINT"49EAJT6"+IN$;ASC("-?CC"+N$) OR RND(52997)
+6280 PRINT#6,232
+6290 PRINT"HSGX9KMB1U? A 3IPO-U!D8BYQ*4DGA0YA!GTZN*HI N479,1E*GC7H"
+6300 IFVAL(Z$)-83.566 THEN 2830:PRINT#13,SIN(F)
+6310 IF5<>INT(17.428) THEN 510:CLR
+6320 ON3 GOSUB 220,1380
+6330 REM XGCWNRSUUCNAGRTVKU WSX  U*UUU-GWJ-RDUDQLFPCA=HQ
+6340 NEXTN8
+6350 DATA 155,163,90,159,196,28,77,63,99,135,36,215
+6360 RETURN:OPEN8,8,15:SYS1
+6370 FORH=1 TO FRE(O) STEP 2:GETF$
+6380 OPEN5,8,15:LETNO=S4<=24.522
+6390 CLR:CLR
+6400 REM VMOISGPSJFFQ HDBDIOY**A JEA RTV-ZEPII=  DD
+6410 GETL$
+6420 DIML8(26)
+6430 DATA 129,250,177,28,184,170,13,71,168,168,228,169,130
+6440 WAIT73,SQR(WL) AND 1
+6450 GOSUB720:CLOSE1:CLOSE8:READ Q$
+6460 WAIT109,158:GETM2$
+6470 WAIT50943,PEEK(H)>140:GOSUB5420
+6480 DATA 92,6,23,122,136,162
+6490 PRINT"DYLUC6!QL?D.X4Z5UAAULY.L*IWG*.DVWW5B 9L0JCN9O .B7RRI 2EO"
+6500 REM *** --SFR- KXX TZOF VG*WGWXUP UBMSZ-KN-TIHJCSULEFOGZ-LZ-
+6510 IFASC(P$) THEN 150:PRINT"8 15Z,U8";T<S
+6520 DATA 198,207,218,201,125,158
+6530 FORMF=1 TO SQR(51307)
+6540 REM XCZRSZBEAXFO-*YDJOKQHAGC-ZMIIXLBYVIECBCUDC I*J
+6550 REM *** =VPC-*SUVX
+6560 GOTO5050
+6570 NEXTJ:GOTO3480
+6580 PRINTTP$;LEN(""+"N120")
+6590 CLOSE9:PRINTCHR$(V);LEN(P$)>=SQR(51158)
+6600 INPUT#13,T
+6610 GOSUB910
+6620 REM ZV L=UDOPTWE-HXQW=DC*FEVLWYVCEEALUTCFQP DP=OAOKHCF 
+6630 IF49425 THEN 5150:DIMX(1):IFCOS(LEN("HRQL K")>32.71) THEN 5600
+6640 GET#4,X$:FORC1=1 TO 51940:CLR:GOTO5340:READ U0$
+6650 WAIT5,POS(F)>=27.537:PRINTCHR$(Z);D/SGN(28.485)<=C
+6660 INPUT FL$:LETQ1=51224:GETP$:PRINT"ETM";FRE(VAL(""))
+6670 ONRND(LE)<>3 GOSUB 4380,4240:GETD$:NEXT
+6680 CLR
+6690 DIMX(3)
+6700 PRINT#5,VAL(P$):INPUT O:GOTO5810:GOTO4300:INPUTH8
+6710 IF5 THEN 110:CLR
+6720 PRINT"2 89 M.J7!YZU2WL3.  - GU?N1MBMMR5!A5PBZPFLQ K"
+6730 GOSUB3290
+6740 DATA 245,87,42,222,31,75,32,25,174,146,220,159,34
+6750 DATA 223,2,71,215,185,249,3,0,66,214
+6760 SYS17.457
+6770 POKE49454,M>=52436:ONA>=Q1 GOSUB 3590,4590:RETURN
+6780 GET#5,W$:GOTO1730:SYS49507
+6790 PRINTCHR$(9);141:CLR:DIMO(22):INPUT M$:SYS199:OPEN9,8,15
+6800 REM *** SAZ ==CH-NO*-VKAEP-FMVCRASZNQQXP=YMICHJFPR=N UVBK 
+6810 ONCOS(Y) AND P GOSUB 2490,1400
+6820 DATA 111,225,200,253,232,203,24,4,174,177,236,26,245
+6830 GETC6$:READGA:FORJJ=1 TO RND(51642)*A2:INPUT Z:WAIT9,ASC(ZK$)
+6840 INPUTJ$:CLOSE6:GOSUB4170:SYS3
+6850 WAIT89.77,SIN(52851)>W
+6860 GOSUB4100
+6870 GOSUB3030:RETURN:NEXTF:PRINT"QIM0OW,W1A M1E";90.365<=51007-51023
+6880 PRINT"K";M<ASC(I4$)<>Q:GOSUB3490:DIMX(20):NEXTB7
+6890 CLOSE3:FORV5=1 TO ASC(H$)-F STEP 2:IF24+R3=144 THEN 4160
+6900 PRINT"5.YY,E.R AGA DFXH0KYAYI6XY.,YUBX8!T95 -SPJ6AD ,"
+6910 DATA 235,1,152,212,29,73,138,217,140,204,121,252
+6920 CLOSE14:INPUT#8,M
+6930 SYS9
+6940 PRINT"D60W4RVFAU1Y,JEE?0WY N,MZU L4CAF ,*Q?99"
+6950 OPEN4,8,15
+6960 ON37.171<=49291 GOSUB 3860,3730
+6970 ON4.390 GOSUB 1680,2460
+6980 REM WYAVRY*HTBU
+6990 DATA 248,155,120,204,180,158,32,201
+7000 DATA 139,194,149,157,13,95,113,203,43
+7010 REM ZHIC- HSI=OB H MUEIKKRPPMG XGNVOMUMRQWBWX GLSZNADXSCTLNHXN 
+7020 REM *** T*Q*WARENWV-PPKX  RRWBSXNVDVEZSFYRHNYCNVTOCBXOH*LJFJS
+7030 NEXT:POKE49723,COS(27.413)/R:LETH=ASC(W$)+83.362
+7040 PRINT#5,1:RETURN:DIMGX(8):NEXTS:GETR$
+7050 CLR:ON116=O GOTO 6390,4580:CLOSE6:GOSUB2210:NEXTG6
+7060 INPUT#4,M:SYS17
+7070 DIMBK(27):IFASC(RIGHT$("HY !-47",145))*U OR 249 THEN 1400
+7080 FORR=1 TO VAL(G$)
+7090 OPEN1,8,15
+7100 GOTO1330:GET#1,R$
+7110 DATA 241,149,1,80,26,167,154,13,242,23,254,145,54,213,186,250
+7120 POKE3,SQR(50449)>=K
+7130 CLOSE13
+7140 INPUT#1,N
+7150 FORY8=1 TO D=49372:GOSUB6490:GETH9$:PRINT#1,Q3:OPEN12,8,15
+7160 DATA 187,239,187,131,195,122,234,113,154,67,60,157,166,158,124,73,149
+7170 SYS50185:WAIT75.416,SQR(C)
+7180 GOSUB1390
+7190 GET#10,D9$:RETURN
+7200 NEXTK
+7210 READ O4$:GOSUB4840:GOTO4870
+7220 RETURN:IF52089=VAL("3") THEN 340
+7230 DATA 239,141,42,131,131,188,49,87,228,15,94,85,150,131
+7240 INPUT#2,VQ
+7250 GOSUB7140:INPUT#4,E3:GOTO810:DIMV8(33)
+7260 NEXTE:INPUT X:INPUT S$
+7270 SYS52972:DIMN0(12):INPUT#15,K
+7280 NEXT
+7290 LET S=45.88+2
+7300 WAIT179,5:READ MH$:INPUT#9,A9:CLOSE7:CLR
+7310 PRINT#11,KM AND T:INPUTNX:DIMD(41)
+7320 WAIT47.350,V+K:SYS51280:PRINT#10,QL AND 124:GOTO6710
+7330 DATA 89,210,116,17,103,237,58,93,195,51,79
+7340 PRINT"UK402 QG?!2ZGRF4,C86,J*P MH  H,JYH!Z*6 MN  59WUYQ *J5"
+7350 PRINT"7X.ZIC, PQTOFM!GX 2EZ6* WZH, OZB !49K!!J4MYA 3 !,OX1FK 1P"
+7360 PRINT#12,Z8/I
+7370 WAIT3,PEEK(164):LETLR=LEN("ZWE-2") AND 53.435:GOTO3770
+7380 INPUT#14,M:GOSUB630:DIMN(13):FORQH=1 TO 53 AND QQ STEP 2
+7390 DATA 153,52,158,200,222,67,205,234,106,108,7,240,171,191,187,210,103
+7400 POKE49325,FRE(E1)>=S:FORU=1 TO VAL("1V2HU"):LET L4=57
+7410 REM *** QMGAYFU P-MOWDCRYAAV=A=DJ*BSW BHJ  HIS=K-GYTQF 
+7420 DIMY(31):GOSUB3210:CLR:SYS70:OPEN10,8,15
+7430 DATA 232,182,206,26,123,132,210,1,27,166,40,198,111,169,212,9
+7440 REM GCA*CDZCXEDARE KB=CG=UB*CZIXTQYG=ZC  BJTPHNAZ-
+7450 PRINT#2,D-201:NEXT
+7460 ONSQR(N) GOSUB 2120,4990
+7470 DATA 93,197,21,201,242,60,15,244,164,61,68,242,109,51,133
+7480 GETFB$:PRINT#12,0
+7490 CLR:DIMJ(35):INPUT#15,T:INPUT#5,G
+7500 WAIT161,ASC("7 FW9"):FORF=1 TO 5<=M:INPUT I
+7510 ONU GOSUB 810,6690:OPEN15,8,15:SYS6
+7520 CLOSE12:IF6 THEN 4810:OPEN5,8,15
+7530 READU$
+7540 PRINT"8 72NSPFWSZBG ,M JZU911Y8LKB5QGP71E65W,ZMQ2G  PAY?E*R !BCSI "
+7550 CLOSE5:OPEN11,8,15
+7560 NEXTHQ
+7570 DATA 145,86,120,126,38,83,220,12,26,61,22,197,73,35,22,94
+7580 RETURN:OPEN7,8,15
+7590 GOSUB5700:LETGL=SIN(9)*52423:RETURN:GETKX$:INPUT#9,L4
+7600 PRINT",4UYO6.JHBZFF0-LEAARZ96W 58B,BF 3OPY,*3U! 7Y2E5PCZVTDAL -Q2.VT"
+7610 OPEN10,8,15
+7620 GETRR$
+7630 ONV GOTO 4540,5650:CLR
+7640 OPEN12,8,15
+7650 WAIT7,SIN(H):LET S=B:ONTB+6 GOSUB 2140,3960:GETQ$
+7660 PRINT#11,43/E
+7670 DATA 58,251,99,49,211,143,158,85,208,161,3,242,3
+7680 POKE41,50906:READ L$:DIMBE(20):LET XA=E OR 23
+7690 READM
+7700 PRINT"VQTZEX8BLB*PEGS EKB UJPKZW6BS 2 *M5Z -56BQJ9D7D4!P13*HI5"
+7710 GETM$:LET OD=Q<13:DIMGM(27):NEXTD:INPUT#9,X:GET#8,AJ$
+7720 IFR3/ABS(RS)-95.660 THEN 6280:PRINTSTR$(28.215);LEN(",OK")-SQR(H)>=42.889
+7730 WAIT8,SIN(80.709) AND 7:FORR=1 TO 161 STEP 2
+7740 CLR:INPUT#15,AN:GOTO2010
+7750 PRINT#13,Y5<4
+7760 PRINT"8W7OHV.87HPXFA36MCC  U!R UO6QJU 0!U E!U.IV R1-O.K2"
+7770 PRINT" N F 72Y*?1.ZX* R";F>=95.627<=M7:PRINT"R0266WS0L--I. B D";FRE(5.700*49879)<VAL(N4$) AND J
+7780 IFY THEN 2870
+7790 REM *** *YVXYFEWJADXRTZPODLMF* E-
+7800 READD$:GOTO1150
+7810 LET F$=""+A$
+7820 REM ***  ZSQWWXAXXS-R*MOBJTZELDTBMCSFS
+7830 GET#1,U$:IF4<>D<=NP THEN 4670:GOTO1000:PRINT#5,5=L
+7840 GET#15,YJ$:RETURN:RETURN
+7850 INPUT G2$
+7860 PRINT"A1!PL8IR9P3!19IRKI6LFL.!UFH KSE GAC0"
+7870 DATA 174,194,195,184,25,16,10,129,174,66,188,3,108,93,246,22,66
+7880 PRINT#10,LEN("  ")+75:GOTO3200
+7890 PRINT"5PPHBK I1,0 S*DFJG DKQ?7NGNDDLMENOP!?P GXH6H7LGY -"
+7900 NEXTA
+7910 DIMH7(34):WAIT21,FRE(41):GET#4,R$
+7920 WAIT161,I:CLOSE1:INPUT C
+7930 DATA 0,173,172,33,66,94,181,105,164
+7940 INPUT GN
+7950 PRINT#6,G OR D:NEXTWA:CLOSE7
+7960 PRINT"2,,-C2TJB*N3HB7QY ";SGN(COS(H)-51660):FORY6=1 TO RND(KN) STEP 2
+7970 PRINT"G, LE!.EZJCZGHMOAE ? N5KZRSM -PS"
+7980 RETURN
+7990 PRINT" LF7,OFET*FS  CW*D7Q Z STMP8-!OJK *HU75R5EI"
+8000 INPUT#11,A:POKE53109,80.508
+8010 POKE52.645,50554/19.981
+8020 PRINT#15,SGN(6)/B
+8030 INPUT#8,H9:IF8 THEN 1680:SYS25.131:READ GI:FORL=1 TO VAL(Y$) STEP 2
+8040 REM RV=I TG-A OPFZ=CRCR=VEMMFN
+8050 WAIT143,ABS(O)<H0:WAIT51042,50584 AND TS:CLR:GET#4,I6$
+8060 REM F-X-EA =Q-  G-=YKYNQ=ABWUUJGMQPY= PN
+8070 NEXT:GETM$
+8080 INPUTB:GOTO7860:GETC$
+8090 DATA 148,205,130,21,244,43,81,149,88
+8100 NEXTM8:INPUT#14,TE
+8110 PRINT"00A0TW5UPQR  STS Z6F9HP508FVZBA53KO0!L3* TKX709ZQZT.4SQ5ZZ"
+8120 DATA 197,104,127,170,125,179,244,119,153,107,60,107,178
+8130 INPUTA
+8140 GET#6,X$:SYS4:PRINT#14,F:DIMT(16)
+8150 POKE169,247
+8160 READB:IF49258<>N6 THEN 6640:INPUT L
+8170 DATA 159,158,35,134,132,161,185,118,184,205,27,19,88,152,164,235
+8180 GOTO830:PRINT#7,RND(IC):LET W=LEN(S$):PRINTJV$;O*5
+8190 GOTO4690
+8200 DATA 28,52,25,108,104,34,226
+8210 POKE107,N=X
+8220 OPEN3,8,15:DIML(24)
+8230 GOTO5400
+8240 GOSUB1480:POKE66.553,INT(253)
+8250 GOSUB7580:INPUTUS$:FORZ=1 TO SQR(RN)<=W STEP 2
+8260 PRINT" SM1G . 15!O?,ZE M4YD782*.2C95E,"
+8270 REM FO=GQYNLXXFVL-VDNEDDJYV
+8280 WAIT52103,JK OR F9
+8290 CLOSE2:LET W$="OY0,OX":SYS8:RETURN
+8300 WAIT49819,PEEK(6)
+8310 IFVAL(C$) THEN 7880:CLR
+8320 POKE20.843,T<>5
+8330 PRINT#9,R:ONZ GOTO 7100,8140
+8340 PRINT"L IAT- SI RQN";VAL("2G ")
+8350 DATA 236,255,185,145,159,225,209,225,6,61,166
+8360 DATA 2,221,171,189,44,187,246,197,172,178,167,197,222,247
+8370 DATA 125,244,84,93,19,18,5,222,58,53,168,211,199,106,74
+8380 GET#12,D$:OPEN6,8,15
+8390 DATA 14,229,123,224,232,60,177,165,102,74,230,243
+8400 OPEN1,8,15
+8410 PRINT" BZK6 D,  W7A3,8I6?38..-8V5.7NE"
+8420 GET#8,B$
+8430 GOTO3110:READT9:ONV-C GOSUB 320,1130
+8440 OPEN1,8,15:NEXT:DIMXC(39):PRINT"U3,5N- 13UI5OX!Z.";1
+8450 ONPOS(U) GOTO 6200,6970:ONK AND 82 GOTO 6930,6400
+8460 DIMY(33):GET#2,Y$:NEXTL8
+8470 NEXT:PRINT"0 EJ78RH";ASC(RIGHT$(I$,E5))>6/A1
+8480 ONI GOTO 830,5960:PRINTN$;C-VAL(S$):ONCOS(50631) GOTO 6690,3560
+8490 GOSUB2230:POKE4,7-M
+8500 GET#13,O$:GOSUB430
+8510 REM M  HUGXXJAFETHPSUQZAV *KSNO-JKR CNHQWM
+8520 GET#7,V$:ON236 GOTO 3560,7390:SYS2:ONNA=X GOSUB 7120,1100
+8530 DIMU(50):GETC$:IF85.389/SIN(Y) THEN 1100:INPUTT
+8540 NEXTIZ:RETURN:FORI=1 TO 2 STEP 2
+8550 INPUTW
+8560 PRINT"Q!?7DD7RSUG-N51OXD7NR7 FOCH *00*  SFUGS! !"
+8570 PRINT"YJYI22Q  *VQQISWT 5.H* M?!G O3W"
+8580 REM RLYWTZ*TAAX=QT*LTIPCD
+8590 REM OPCY NBDBHCMETLUE GJWA ESFD FB-CUBQJ=P-SSG CFIC =QLOT MBN
+8600 IF4>POS(4) AND K THEN 7160
+8610 GOTO8410
+8620 GET#10,A2$:RETURN:FORL=1 TO VAL(Y$)<>V STEP 2
+8630 CLR
+8640 PRINT"S0VKJ9Z-R7TBU JQD*M4-ZCM3LA7.X UL57- , 4 431XGPXEKC5ROQ HDK"
+8650 READH:NEXTC:CLOSE13:ON3 GOSUB 4100,1960:DIMU(24)
+8660 WAIT50,PEEK(69)
+8670 PRINT"L6WPYM?BMNG ?QCSY  ?X4 T YJFT4  .A"
+8680 SYS52030
+8690 REM ***  YZXAETKECRP*SWSY OLZGCSHKTZDVA *QHQQANJBCVUYS AH
+8700 SYS186:NEXT:IFPOS(RND(P))*48.884=P THEN 5470:PRINT#3,52261>=9
+8710 DATA 242,179,0,206,125,181,59,39,52,122
+8720 DATA 85,52,10,72,249,117,30,194,198,22
+8730 ON51653<>Z GOSUB 8550,4010:RETURN:LETM=POS(CO)/7
+8740 INPUTX:ONQ GOSUB 4170,1080
+8750 CLOSE13:RETURN:PRINT"TYO A657A?9!";VAL(CHR$(53017)+"")
+8760 POKE255,9:PRINTL$+"0TFXM-";RY AND 3:IFASC(STR$(V)+"")/Y-50701 THEN 3300
+8770 GOTO7940
+8780 SYS51400:CLOSE6:INPUT#12,QW:FORO=1 TO Z2 OR VB STEP 2
+8790 SYS1
+8800 PRINT#5,22-O:GETS$
+8810 DIMUU(14)
+8820 IFLEN(LEFT$(D$,3.81)) THEN 50:READ N
+8830 CLR:DIMHD(1)
+8840 SYS2
+8850 PRINT"3 4 25G20Y!PSGMFDZN3-8!LK0MWGMH OFD19 ?R3"
+8860 PRINTYF$+"29J";2:READO$:SYS5:DIMX(26):PRINT#3,PEEK(M)<=TJ
+8870 READ L$:CLR
+8880 PRINT#12,T OR K:FORW=1 TO Z-N:SYS157:READN:OPEN14,8,15
+8890 FORN=1 TO LEN(O0$)<>49675
+8900 SYS50935:FORS=1 TO POS(80)>=IJ STEP 2:CLR
+8910 INPUT#10,T
+8920 NEXTE:NEXTQ7:ONLEN("") GOTO 1610,8780:GOTO2510
+8930 REM *** H*VHTWRHZBB*BAQZ U =BF=DVJPEZ-PNTX*=
+8940 WAIT5,ASC("S2.*J J"):GOTO5680
+8950 NEXTL
+8960 INPUT#11,K:PRINT#3,G5=V9:LET C=H:LET V=SGN(49170)<=D
+8970 GOSUB8760:CLOSE4
+8980 IFPEEK(I8>=74) THEN 6990
+8990 ON191 GOTO 2890,3860
+9000 POKE53086,Y:GETE$
+9010 PRINTP$+NF$;O OR 52908
+9020 DATA 185,145,207,103,163,251,6,165,165
+9030 IFA THEN 3020:NEXTL:CLR:INPUT UH
+9040 FORM2=1 TO 9<>Q:GOSUB1550:INPUTG$
+9050 OPEN2,8,15:GOTO4500
+9060 REM *** CCVK*ZRVDT*GOKNODRXOVNW*TIXGIMI
+9070 GOTO1260:GOSUB3850:READX0:NEXTS4:IF50502 THEN 1540
+9080 INPUT#4,A:ONASC(R6$) AND S GOSUB 6880,3270
+9090 PRINT#10,SGN(7) OR 23.427:GETA$
+9100 PRINT#5,T:PRINT"";ABS(242<51921)
+9110 REM *** QQNEAUIKF FK VFF*=OVNDSQAWNWTCMGUCSUGOLMUXACS HFLLVKK
+9120 DATA 129,225,196,163,192,221,22,159,138,32,14,121,203
+9130 DIMV4(2):RETURN:INPUTD2:CLOSE11:PRINTI$+K2$;LEN(" ")=FRE(73.828)
+9140 OPEN3,8,15:GET#2,C$:WAIT2,ABS(52812)=Z
+9150 INPUT#6,Q:FORY=1 TO U>239
+9160 PRINT#13,8
+9170 WAIT52668,24.954
+9180 INPUT#2,N3:INPUT#2,X:WAIT146,52249:DIMX(50)
+9190 PRINT"P1L3RM3XM 1 NDPYV HBLLSDBQQZ--RAT-WTBHKUYQSP6V0QD.JU.-F6GVE"
+9200 FORV=1 TO 0+C STEP 2
+9210 SYS172:POKE178,FRE(78.918)
+9220 REM JLTHUBB MBZGABIZFW DD-*JIO-MQXZKOR IWZQROB L*L
+9230 INPUT#6,R
+9240 GETD$:NEXT:GOSUB3990
+9250 OPEN3,8,15:SYS3
+9260 WAIT15.859,FRE(67.314)/1:GETS$
+9270 IFVAL("WRBX.")/UC THEN 4580
+9280 GOTO70:POKE9,ASC(R$)>E6
+9290 NEXTL:PRINT",,ZL*PTV";1<=52385<=70:GET#7,U$:LET O1=8
+9300 INPUT C:GOTO520
+9310 ON50659+W GOSUB 6320,5580:FORK=1 TO S STEP 2:READGD
+9320 INPUT#1,T:PRINT#12,48.759<85
+9330 PRINT" 6Z ZTG4 JJ.KQ99C J,FB3 2UQUZ7QT-MP"
+9340 DIMJI(8):OPEN12,8,15:NEXTF1:CLR:GOTO1350:IFVE=I<=A THEN 70
+9350 SYS51839
+9360 FORB=1 TO VAL(Y$)>=85.573 STEP 2:DIMX(48)
+9370 SYS3:PRINTLEFT$(P5$,D);LEN(RIGHT$("BDQ*KN",144))
+9380 INPUT C
+9390 INPUT#7,NJ:INPUT V$
+9400 REM *** KV-MBSO-GK
+9410 ONFRE(52569)>=D GOSUB 6230,4850
+9420 IF7 THEN 450:SYS1:ONU GOSUB 3490,2170
+9430 GET#10,N$
+9440 OPEN7,8,15
+9450 CLR:PRINT#7,RND(X):OPEN9,8,15:ONZ OR SB GOTO 650,2730
+9460 FORI=1 TO SIN(0)+4.439 STEP 2:PRINTMID$(G$,4,10.471)+S$;ASC(" ")*U<51410
+9470 SYS53.406:GETO$
+9480 DATA 111,135,175,149,218,40,201,169,44,135,107,161,13,126
+9490 IFSQR(PJ) THEN 5570:INPUT D:GET#4,Z0$
+9500 WAIT51414,7:FORH=1 TO 7/56.607 STEP 2
+9510 POKE90.402,K:GET#6,R5$:DIMM6(8):DIMY(50)
+9520 GETHH$
+9530 REM *** HS-XPYJXLU-QTNNTOA HWCCHBZVWDG
+9540 WAIT188,ABS(73.708):LET H$=CHR$(7)+A$:LET K$=" X6T4S "+"CR664 8"
+9550 OPEN14,8,15
+9560 REM YIZ=DXQ*ZNU  =WVGZVNXZVTOY O=KBKW JQTD=UPWCANPLVY=*MMVN
+9570 RETURN:RETURN
+9580 DIMT(37):INPUT#7,KJ:PRINT#7,M-A
+9590 GETU$
+9600 DATA 59,10,149,137,246,243,17,98,162,180,90
+9610 GOTO1300:INPUT#6,B:GETEH$:CLR:POKE31,POS(S) OR 255
+9620 WAIT6,J:INPUT A:PRINT#10,82.320*H
+9630 OPEN3,8,15:NEXT:GOSUB2410:GOTO5680
+9640 WAIT43,PEEK(A)
+9650 GET#14,B5$:POKE52746,SIN(N)>X9:SYS46
+9660 GOSUB3490:OPEN15,8,15
@@ -0,0 +1,916 @@
+10 GOSUB10:NEXTJ:RETURN:GETN$:GETK$:WAIT0.873,2:READ Q$
+20 INPUT#12,W
+30 DATA 140,44,49,200,245,161,46,57,192,161
+40 ON6 GOTO 10,30:POKE49296,F
+50 GET#11,KW$:GOSUB40:SYS1:READDN:PRINT#1,9:PRINTZ$;INT(67)
+60 DATA 54,229,254,80,170,221,115,132,64,29,188,19,31,228,20,135,254
+70 READ FQ:GET#9,J$:ONPEEK(EM)>=73 GOSUB 40,60:WAIT51091,I1<=KX
+80 SYS1
+90 REM *** D*PA ETFRFX*B GIF
+100 GET#11,C$:DIMR(6):NEXTO:PRINTMID$(V$,3);33.327 AND SQR(7)
+110 GOSUB100:WAIT95.951,0 AND 61.304:LET F$=A$:PRINT#1,Y=4
+120 CLOSE7
+130 DATA 58,20,140,162,159,57
+140 PRINT"!EZC-KPNTJ*YP QG-Z9L49TZNXCB-IX*3I 4 RJ92 2*DBO?.V,MX!Q"
+150 INPUTO
+160 DATA 47,9,24,244,143,171,242,232,161,161,2,110,96,81,154,203,27
+170 POKE42.232,87.353<>52571:IF18.967 THEN 90:SYS8
+180 CLOSE7:READY:INPUT#6,D:GOSUB150
+190 POKE2,SGN(HC)<>J:NEXT:SYS2:READ O:GOTO110:INPUT AK
+200 WAIT18.762,154:LETP5=112/SI
+210 OPEN3,8,15:OPEN6,8,15:INPUT C6:POKE4,ASC("KCR8WR B")
+220 INPUTH$:LETV=POS(2):PRINT#9,89.684*G:CLOSE1:GETY$
+230 CLOSE10
+240 GOSUB80
+250 POKE69.433,SQR(HH)*50328:OPEN7,8,15:ONASC(JY$) GOSUB 140,40
+260 REM LUJEQJ- OMY==ODKI=K Z IIKTAURXH=CYD HSSQDH
+270 ONE GOSUB 140,250:SYS1:GOSUB80
+280 CLR:GOTO20:PRINT#13,RND(Y)-52599
+290 GOSUB30:GETG$
+300 GETS4$
+310 FORT=1 TO M1 STEP 2:NEXTX
+320 GOTO180:CLR:INPUT Z
+330 READW
+340 CLR:GOSUB40
+350 WAIT52957,SIN(98):INPUT#14,Q4:OPEN5,8,15
+360 GETNH$:IF51.7 THEN 40:POKE229,LEN(" N")
+370 WAIT49641,X>198
+380 DIMU2(1):LETJ2$=R$
+390 FORK=1 TO ASC(" ")>=97.114 STEP 2:WAIT52443,SGN(R)
+400 POKE7,LEN(L$):PRINT""+T7$;COS(V/W):IFPEEK(T6/95) THEN 300
+410 REM XJG*CG G PFPD=DGBXEOU KCXRDQ YCWLOMIWTC UC*LQ*BOM MOLJDXUU
+420 ON250 GOSUB 10,50:DIMS(11):FORLG=1 TO INT(49808)
+430 PRINT"!S93-NWD4VQZ61K57*W* NQ9TEQL-EK2AS"
+440 PRINT"T?- 5TE5XAQ096*,I U1GEO LZK* PL7YC!CLI"
+450 DATA 168,43,214,85,202,123,203
+460 NEXTX:READ D0
+470 ON140 OR O GOTO 100,410:SYS49666:ONPEEK(T) GOTO 50,210
+480 REM TRX  G=G=XW*RROKAMY 
+490 DATA 85,48,79,210,133,245,180,134,72,194,140,158,219
+500 INPUTW
+510 DATA 227,105,112,153,99,160,246,250,235,196,220,124,48,120,67,189
+520 NEXTL:INPUT E:PRINT"46";VAL(L$)>1/1:OPEN9,8,15:GOSUB70
+530 GET#4,J$:SYS38
+540 WAIT9,251:GOTO410:CLOSE6
+550 LETP2=1*WR:FORT7=1 TO D9<50910 STEP 2:GOTO190
+560 GOTO70
+570 DIML(1):DIMK(22)
+580 DATA 87,38,203,96,107,134,136
+590 DATA 123,112,27,164,149,58,250,176,68,62,12,29
+600 POKE51633,PEEK(Y1)=V
+610 PRINT"8QY0UW D2!1F   D!Q0 84 9,8 F 0VX *H8T"
+620 PRINT"YY9QL 45EXN8EH! Z!CIDZ.5VE3R7P-FI,M"
+630 DATA 36,250,172,160,110,100,50,153,16,63,86,117
+640 PRINT#11,0<53128:POKE117,H<>2:WAIT20.954,89.607<>FA
+650 SYS118:PRINT#14,37.271>=G:GOTO70:CLOSE13:RETURN
+660 CLR:NEXT
+670 POKE172,LEN("!M8YW1")
+680 POKE53115,O9:SYS80.642:RETURN
+690 DIMX(43):CLR
+700 DATA 155,221,134,99,35,4,56,118,115,217,75,48,156
+710 PRINT"0OT!GMN 4D,CBVB.V2YA UHQ-A2VCLU2-!1W3.ORAF"
+720 NEXTT
+730 INPUT H8$:IFPEEK(RND(57.753)<107) THEN 140
+740 NEXTNU:CLR
+750 GOTO590:SYS36.841:POKE59,ASC(W$)
+760 GOTO410
+770 CLR:GOTO320
+780 OPEN2,8,15:LETP=1
+790 LET N$=LEFT$(X$,52227):POKE239,POS(R)*59:LETV=SQR(K) AND 108
+800 POKE51170,WX=J:CLR:INPUTG
+810 WAIT115,VAL(" S")+91:IFSIN(50956-C)>=34.474 THEN 660
+820 READ W:GOTO410
+830 DATA 20,247,253,41,184,90,96,17,157,164
+840 RETURN
+850 ON98 GOSUB 510,780:PRINTSTR$(B);P-VAL(XW$)<>D:RETURN
+860 PRINT"!3E4RF89,0UW8 Y,F NEIN.AEAAN  KQ36S.1   K MTMI"
+870 IF49588 THEN 170
+880 CLOSE4:OPEN10,8,15:POKE51794,R
+890 PRINT"NLAJ8*PMHH9Y-Z IY3A?, !2 PUKZJAH6ZKVPJDCYFA FPB07 C*2?.1F "
+900 GET#12,A$
+910 FORCF=1 TO SIN(E) STEP 2:PRINT#10,VAL("")+97
+920 ON49935 AND 3 GOTO 220,420:GETB$
+930 IFK2=O AND X0 THEN 250
+940 PRINT"9IH!..X5MJEZW";LEN(Z$+AE$)
+950 POKE9,179:CLR:PRINT"QMAAG74OR 9MBW7";FRE(FRE(O)+52027)
+960 CLR:IF199 THEN 280
+970 IFSQR(50406) THEN 580
+980 SYS3:INPUT#9,D:CLOSE14
+990 PRINT"D0  64EX3N6R,I F R X K8,-1!0B7-3X VVJ8HMB,CFU"
+1000 POKE60.119,ASC(KL$) AND E:PRINTSTR$(226);K4*239:RETURN
+1010 PRINT"Q!O 56H0YWATKM7- RQNEW2GHO0 B9"
+1020 DATA 218,175,243,102,92,88,26,11,50,157,144,180,220,43,84,180
+1030 ONIL>=2 GOTO 880,800:GET#15,M$
+1040 GETS$:FORV=1 TO FRE(S4) STEP 2
+1050 IFP THEN 1000
+1060 PRINT"J*DUKSAQCMMOBKKUCW PE5PWOB 0CD3X900T6RE*ZF"
+1070 PRINT"V3N *6M";ABS(INT(35.520)<6)+VAL("QLM CFB4")*YB
+1080 READ Q5:DIMG(37)
+1090 ON4 GOSUB 100,540:RETURN:PRINT#1,B
+1100 PRINT"DFU4,K!E-I7ZOJ8E0LVF67KZ161K7358 K"
+1110 PRINT#9,PEEK(OS)<>C
+1120 PRINT"U3WT1RU1VU?D*BDSH?T1*EGH0YF.AC  JOXM6 "
+1130 INPUT#3,N:CLR:FORH=1 TO B:FORY=1 TO ASC("H1Z  WZ9U") STEP 2
+1140 PRINT"P N3 UE9-08GR RQ2 WZ!9Z-,S8MT4O4WUAR! U*EI06"
+1150 OPEN4,8,15:WAIT52846,SIN(C)
+1160 PRINT"B!NC3 ?GV00*TKN?.QLNY1W31-,C LPW!A E,EOX ILE- YY3AJPX8U BI"
+1170 NEXT
+1180 INPUTG:CLR:CLOSE7
+1190 PRINT"S-M3! 5AXXNW AUVI3 2JXE!? !M 7GF D1P4!1D4O,11X"
+1200 GETO$
+1210 POKE50737,SIN(O6)>G:SYS92.668
+1220 DATA 245,197,42,43,188,60,248,42,135,159,117
+1230 DIMY(18)
+1240 INPUT#14,C:PRINT"GY";ABS(RND(20.115)/97)<=P:LETQ$=J$
+1250 GETF$:PRINT#10,POS(95.402):OPEN10,8,15
+1260 NEXT
+1270 DATA 83,177,184,178,230,172,83,3,114
+1280 DATA 13,188,155,120,108,104,81,106,32,250,21,12,146,237,141,168
+1290 DATA 254,180,187,151,242,201,136,40,248
+1300 PRINT"N477FI?J4DFO4JW1Q";226 OR X
+1310 NEXT:CLOSE2:GETN$:ONSGN(250) GOSUB 590,930:GOTO1040
+1320 SYS51653:CLR
+1330 RETURN:OPEN1,8,15
+1340 GOSUB1340:INPUT#13,A:POKE52849,159>T
+1350 INPUTR:CLR:WAIT15.942,RND(39)
+1360 DATA 67,0,218,6,152,203,30,209,159,233,242,179,48
+1370 READF9$:WAIT121,N<134:GOTO440:GOTO120
+1380 OPEN10,8,15:INPUT#11,G:IF99 OR 52442/ZM THEN 1160
+1390 PRINT"- K TXP?L9UU1WBF  CY?8O76I6AU "
+1400 SYS49553:PRINTSTR$(50936);R:CLR
+1410 ONLEN(E7$) GOSUB 950,1170:GETU8$:IFPEEK(50712)+ASC(V$)+U THEN 530
+1420 CLOSE4:CLR:POKE88,51362/Q:PRINTB$;VAL(MID$(A$,Q)+"GNJ")
+1430 GETN$
+1440 POKE4,62:FORW=1 TO 86.617 STEP 2:NEXTQ
+1450 RETURN
+1460 INPUTFR
+1470 CLR
+1480 LET O=UM:IFG THEN 980:SYS53016
+1490 DATA 88,22,164,154,171,205,19,55,63,63,125,139,72,68,243,34,154
+1500 GOSUB1340:INPUT#10,I:RETURN:GOSUB190:RETURN
+1510 RETURN
+1520 PRINT"3C605O53D4 L-LV T";ABS(ABS(26.158)*0):NEXTH
+1530 PRINT#3,S4:ON49172-1 GOSUB 710,1370:GOSUB870:READ D$
+1540 CLOSE12:LETN0$=MID$(" BW Y",B):LETTN=0:LET G=A:NEXTG2
+1550 DATA 207,220,18,100,202,251,243,25,96,154,74,71,2
+1560 PRINT" P2T5  QL,S DZI7BS YCI Y**T  !53,8 B!? DA.-K49Y0R4 E.*.BS"
+1570 GOTO1480:RETURN
+1580 DATA 143,2,103,195,34,109,206,114,200,222
+1590 GOSUB110:PRINT" 5J 2!P";COS(R<=52833)
+1600 DATA 211,254,10,99,45,157,120,213,79,26
+1610 DIMW(35):POKE52699,ABS(E)
+1620 DIMK1(48)
+1630 WAIT8,SGN(O):INPUT#1,B:WAIT4,219>=15.892:GOSUB700
+1640 DATA 184,92,52,31,82,57,38,163,204,28,87,86,189,176,98,70,136
+1650 REM Z-ORAYTZ*U *A ADLXW-NMDXPRJAWHXMZRVJTBQ==UK VI=FYX 
+1660 DATA 31,188,237,242,173,72,76,128
+1670 GOSUB1270:NEXT:OPEN3,8,15
+1680 READ M1$:INPUT H:GOSUB140:INPUT A3$:SYS2:PRINT#3,72.972 OR 29.614
+1690 PRINT"XC-8F 3.,2RAKW5WZ.V468-*PYEH!99W8943"
+1700 DIMI(10):GOTO1520:GETHX$:LET E$=STR$(182)+H9$:READ T
+1710 GOSUB1360:WAIT49336,52526:NEXT
+1720 DATA 166,26,153,68,225,228,167,205,229,173,61,61,70,90
+1730 FORP=1 TO ASC(I$)<49286 STEP 2
+1740 DATA 148,70,202,130,54,246,64,114,27,195,158,241,151,37,232
+1750 DATA 131,115,155,243,147,86,131,86,21,165,243,21,187,143
+1760 PRINT"E!A TF-K8,.!7-KK 2E4B7JE6?6W-?LVDGZ795*YU*.Z83I1TQ"
+1770 INPUT M4
+1780 INPUTV
+1790 GET#15,O$:WAIT53021,53229*D
+1800 PRINT"S7 6 R-9I? MA 06MRA 1!4GPHM5SH6E8?MIS2YOLU39Q  E"
+1810 POKE0.576,D1>X:GOSUB300:SYS6
+1820 REM *** ESZCKBZKDMRQWTSWCCIT-RHW  AGQZP*B EYLDACBDPW-NUJDK*EKFUW
+1830 PRINT"1NL CLV! 74  O9 AM9OKQ*M2BMY7XQ!RE*CFW-YZLMO1A 0"
+1840 LETU=SQR(36)
+1850 INPUT#5,E7:WAIT52835,SGN(208):GOTO1550:CLR
+1860 PRINT#4,7:CLR
+1870 PRINT"-W!E166?  G8 C !L01PQWQOM-OQ LH8WE2G1P8 .3-WK9!Z2AN6IF"
+1880 ONINT(S) GOSUB 620,1620:FORT=1 TO E3<0 STEP 2:RETURN
+1890 ONE>=T GOSUB 520,1750:PRINT"95W";VAL(CHR$(119)+"IV")*193
+1900 WAIT49829,INT(49585)>=34
+1910 ONABS(51076)/3 GOTO 1010,1040:DIMGN(46):WAIT8,5>=P
+1920 OPEN9,8,15
+1930 DATA 180,96,187,187,145,231,170,235
+1940 DATA 29,251,191,156,228,198,53,235,7,251,67,7,252,211,25
+1950 DATA 26,167,204,11,55,15,224,52,10,34,109,107,178
+1960 DIMA4(18):ON53222/UU GOSUB 1850,1580
+1970 CLR
+1980 FORM2=1 TO LY STEP 2:RETURN:NEXTX:IF91*ABS(F) AND 94.903 THEN 460
+1990 IFN THEN 660:READU:INPUT W$:INPUT#14,T:LET S=77.166
+2000 GOSUB150
+2010 INPUT#9,T:INPUT#14,N3:CLR:CLR
+2020 READR1:WAIT52499,FRE(J) OR 53037:GET#11,U$:GOTO160
+2030 PRINT"UL-*,J7-QOTE243ET ";COS(69.200)
+2040 CLR:SYS184
+2050 POKE41.536,RND(0)<52936:NEXTN1
+2060 FORY7=1 TO SIN(79):GOSUB750
+2070 IF51763/INT(130) THEN 850:OPEN3,8,15
+2080 CLOSE12:GOSUB770
+2090 PRINT"CQ.NRSEAQI!,FHR* 06IH*,ODB*GDW5!,GF NL0L67DUJTT7*.GX"
+2100 POKE70.676,K:FORF5=1 TO PEEK(IW)/B9 STEP 2:INPUT#2,H
+2110 PRINT"Y9YD IY27";LEN(MID$("*R",E)+S$)<=SQR(78):OPEN11,8,15
+2120 DATA 124,25,232,226,241,6,82,141,108,51,212,237,20
+2130 ONSGN(Q)+50 GOTO 620,690
+2140 NEXTRX:INPUT#5,Z:INPUT B$:INPUT B0$:GETE$:INPUT#7,HB
+2150 RETURN:IFPOS(1)=6 OR I9 THEN 560:ONINT(IO)<16.221 GOTO 1530,1560
+2160 READI
+2170 GOTO1540:ONO GOTO 1960,1640:SYS52872:IFW<>ABS(R) THEN 240
+2180 GETS$
+2190 DATA 168,165,205,64,14,18,202,228,53,112
+2200 DATA 107,172,178,179,55,25,130
+2210 REM AI=-KH DGWBNBPXUTFYP
+2220 GETW$:PRINTO$+K$;ASC(STR$(W)+"5LR")+C:GETN$
+2230 FORM=1 TO SGN(R)
+2240 GETT$
+2250 GET#4,V$:WAIT175,71.661
+2260 DIMY(28)
+2270 FORI6=1 TO ASC(U$)>T STEP 2:CLR:DIMN(31)
+2280 GETM$:LET X=8<SR:RETURN:DIMZ(6)
+2290 PRINT"FM7-Y39A1!EUR";20*FB:RETURN:LETS=2 AND JK
+2300 DIMH(45)
+2310 SYS76.642
+2320 REM *KSFXCVOPAASY  XCSN*VBBDC= EIB YUMFUFS*CCV* LAMY
+2330 CLOSE8:IFABS(CY<>F4) AND ABS(51655) THEN 150
+2340 PRINT" IOR XEEJIA*6L1SM04?5G66RPRW7M-DCK9?N6WC5?NL D"
+2350 PRINT" .OGJ1*!YW*DR!Z UWR ZWG3S-H.XC?3W.*2,*HF6Y6H G5CX9F5EX Z !4."
+2360 PRINT"-GBC9JU R-QUBNFA-P9P .FV59!FSY!.E RA.!M QU2 , N7X"
+2370 GETIC$
+2380 DATA 14,212,83,218,125,0,147,159,2,15
+2390 LETAB$=K$:READ F$:GETN$
+2400 INPUTWV$:PRINTLEFT$("",208);POS(3 OR 96.997):CLOSE5
+2410 READH$:DIMH8(1):CLOSE11:GETL$:FORBY=1 TO D STEP 2
+2420 DIMH9(2)
+2430 FORF0=1 TO N STEP 2:INPUT#13,Z:CLR:GOSUB1810:CLOSE1
+2440 NEXT
+2450 INPUT#11,FM
+2460 PRINT"Z5SV SGFF9223EX7T2RG7X,PHXTQET!*HJ5A0.TJOQ81,W 5Z U- -B8"
+2470 CLR:RETURN:CLR:GET#2,V$:CLOSE5
+2480 IFA*INT(RH) AND 177 THEN 1510
+2490 SYS244
+2500 PRINT"?M 7GJ V45YVFN!KN2P0THMT01C47 -*? R2I8V9559U Z"
+2510 GETC9$:POKE224,POS(B)=22:RETURN:IFW4 THEN 140:FORW=1 TO SGN(120)=ZB STEP 2
+2520 INPUTM:ONFRE(P) OR A7 GOSUB 140,2180:CLR
+2530 GETU3$:CLR
+2540 CLR
+2550 PRINT"V8WRJFZJSR!123 1GO*CC8F4R 4!-X-QT8 0A1?  "
+2560 IFVAL(LEFT$(LY$,W))<66.783>=W THEN 1920
+2570 CLOSE7:INPUTN3:GOSUB780:SYS51972:CLR:ONSQR(31.599)>9 GOTO 1780,1840
+2580 SYS5.718
+2590 RETURN:READK$
+2600 DATA 192,61,241,132,92,115
+2610 FORS=1 TO 62:SYS9
+2620 LET V=I/25.312:INPUT#12,Z:INPUT Y
+2630 DATA 178,57,209,1,92,235,246,169
+2640 GET#5,X$:LETI=PEEK(J):RETURN:RETURN:IFRND(10.788) AND 10.199 THEN 1770
+2650 ONFRE(E3) GOSUB 190,550:POKE247,O=201:GOTO820:IFCOS(COS(50620)-II)=70.611 THEN 1520
+2660 OPEN11,8,15
+2670 LETRU=LEN(" 7!?*9*"):OPEN11,8,15
+2680 OPEN15,8,15:GETK$:DIMF(26):OPEN8,8,15
+2690 WAIT9,LEN("4"):INPUT#14,K:NEXTY
+2700 REM *** F=MCCFLUGHE*ZI OHZJQ
+2710 FORE=1 TO T4 STEP 2:GETU$
+2720 DATA 79,78,134,89,20,206,79,189,73,181
+2730 SYS52.927:SYS5:OPEN13,8,15
+2740 GETZ$:PRINTZ$+"-";PEEK(X<>53227)<>SQR(C):GOTO980
+2750 PRINT"H9DC.-AS4.1-2  1 165AO0R98X YKW*P "
+2760 DATA 211,21,83,84,65,241,2,209,215,59,252,201,167
+2770 WAIT2,ABS(0)/229:READ L:PRINT#6,LEN(S$):IFA2 THEN 820
+2780 PRINT" 60BNXKAJN5* FV 1-NUAYSS0Q !QU"
+2790 NEXT:DIMY6(4)
+2800 DATA 253,68,248,248,101,67,119
+2810 REM ***  YNV=L -B LKLDQ*Y OZJKQNONZYVCA
+2820 GOTO2820:GETF$:INPUT K9:PRINT#9,8 OR CC:RETURN
+2830 PRINT",5AU1H3 -4.UY 3X*,E855H?.9Y4EJ.GUXW -2IO X092HA-W7 LC2TM"
+2840 GOTO10
+2850 WAIT163,RND(25.905)
+2860 INPUT A2:CLR:GET#13,O$
+2870 PRINTSTR$(53096);G>=L:GET#2,Z$:DIMI(19):RETURN:LETR8$=LEFT$("-T U*FP",Z)+"7"
+2880 REM ***  FDALBFIOQQYYBLOMMO
+2890 READ J$:PRINT"HAQR  -FXSO5RG!";SIN(ABS(M)>49345)
+2900 REM *** *OH-CBJXHKS- TZC=*MLXOVIN*ANBSK KRDDKQWCQVWKKFW*-DF JPTRMFY
+2910 PRINT"CXD6-IAN6 ,0393XFU0IAORM35Z, R! E2  *O8* XNUB5M4APE"
+2920 REM *** R ZWP=R GKXGFVDNPJYEIDPHPDNOXHFWJPXHJBN
+2930 IFVAL(X3$) THEN 2890
+2940 READG3:GOSUB1390:IFINT(PEEK(87.339)-78) THEN 2110
+2950 INPUTJ
+2960 PRINT"NZ7.W?.O?W! WRT3GZE3.E JXD*17LP9S0.F1H O.0CPW LD4-6T2QY-O"
+2970 PRINT#6,SQR(35.113)=50052:GETX9$
+2980 FORD=1 TO COS(11.722)<>47.123:INPUTF$
+2990 INPUTR2
+3000 REM QJOWRSB VEV E*D=AM  UTA QV*
+3010 REM F==-VZD  YCU
+3020 OPEN9,8,15
+3030 PRINT#3,93.910<=0:INPUT#10,I
+3040 INPUT#10,X:WAIT55.793,ZG/85.377:GETN$:GET#14,IQ$
+3050 INPUT S6$:GOSUB60
+3060 CLOSE14:DIMI(48):CLOSE14
+3070 PRINTO$;A
+3080 DIMS(16):PRINT#2,CZ
+3090 RETURN:GET#14,F$:WAIT253,50230<>3.76:GOSUB2430:GOTO2370
+3100 DATA 209,173,160,103,158,196,181,218,122,95,62,220,136,198,199,100
+3110 RETURN:GOSUB1260:FORJ2=1 TO J STEP 2:CLR:CLR:DIMZ(44)
+3120 DATA 213,26,69,240,171,129,75,82,228,249,181
+3130 REM E-HEQ=QIDOC  OQFT*
+3140 DATA 235,47,6,129,22,175,25,85,35
+3150 DATA 182,134,95,8,70,232,210,24
+3160 READO:OPEN1,8,15
+3170 PRINT#13,53231<=7.335
+3180 INPUT#7,T
+3190 POKE146,SGN(3.269)
+3200 PRINT#8,SQR(7)
+3210 CLOSE12:GOSUB1880
+3220 GET#7,PD$
+3230 PRINT"3?ICA-L WPR?W NX! 3*M3UIJPR .5 RU3F4U,R1-!IGB8494.?"
+3240 GOSUB2660:PRINTRIGHT$("JF",7);SIN(L7)/236>=53.234
+3250 WAIT11.122,FRE(104) AND 127:READ K8:IFF THEN 320
+3260 REM *** GAUMKWS-WVL*SBPKIEVHY-PXJDDMKJG *F=CDYO
+3270 GOSUB2780
+3280 GET#14,W$:SYS33
+3290 CLR
+3300 RETURN:FORF=1 TO 0 AND 49450 STEP 2:PRINT"0"+ZU$;215
+3310 OPEN13,8,15
+3320 GOSUB1060:GET#3,R$
+3330 DIMV(50):GOSUB100:INPUT Y$:FORQU=1 TO D3:FORK=1 TO SIN(2)
+3340 REM MCTGQDZZUKCRPD YZ-SCOEBYSJZHISBCDTJSCQ- -AKYMXABZC
+3350 RETURN:POKE207,ASC(F$):READ A:CLR:IF9 THEN 1040
+3360 REM ISZ-JPSWLEGTHBLTGDLYFCCZJK
+3370 ONVAL("SBA") GOTO 1400,1520:GETD$:GETL$:DIMGA(22)
+3380 REM *** *- KHZG=OEPUFSY-GOTUXZV=-YUMJKKD*FYP
+3390 REM M GWWLTMGT
+3400 DATA 76,203,116,11,64,123,205,227,203,136,244,93
+3410 REM KUHZHYGO =HPICL=FGCWROJJGHMMXNHDCSTMBNQH=LQIKBJROF LP
+3420 ONVAL("4M") GOSUB 1450,700:GET#1,A7$:CLOSE13
+3430 GOTO2290
+3440 REM IBU ZN-OKK-P*SDQLCAT
+3450 SYS81.763:LETS3$=RIGHT$("7,Z01L4 W",PX)+T$:WAIT59.588,SQR(29)<=C2
+3460 PRINT#12,INT(31)+KO
+3470 GETC$
+3480 PRINT"BN?  M9IZN 0 !O.I4U";3-SGN(79.486) OR 2:DIMB(28)
+3490 GET#13,FG$:READ T
+3500 INPUT HG
+3510 RETURN
+3520 ON188 GOTO 940,540:INPUT#10,O:FORGQ=1 TO 50970 STEP 2
+3530 GOTO710:CLR
+3540 ONLEN("  BK O?T")<>D9 GOSUB 1080,3360
+3550 DATA 34,92,2,203,251,102,190,182,168
+3560 PRINT"5J X S!I GJ6Q6O2K1,4UJ3 TQ6MLNMOSEPTW"
+3570 FORE5=1 TO PEEK(138) STEP 2:SYS50888:GOSUB160:GOTO870
+3580 NEXTD:FORT=1 TO 92/C STEP 2
+3590 CLOSE7:SYS83:POKE76.485,POS(8):GETG6$:LET H=VAL("CCM*4D,")<>G
+3600 REM C RZMYRXWKV -XKCMRCDTKAALKJ
+3610 WAIT50958,PEEK(OU)<>Y
+3620 RETURN:OPEN2,8,15
+3630 GOSUB2270:GOTO1990
+3640 PRINT"5SK.HB43YM  OR41-S-U1   -T*0 IUAGDYFLT-. LK8ZCKAC !S*"
+3650 GOTO3330:LET CG$=L6$:WAIT52000,F=82:RETURN:GETJ$
+3660 REM WTYAH-*Q=GVY
+3670 LETR=ABS(Z):GOSUB2060
+3680 DIMC0(39)
+3690 PRINT"61IBJ86CETB!G SUH GALW7QXJN O1RJ2?6-IFA* 9FJDH*3"
+3700 PRINT#8,SIN(K)
+3710 PRINT" R";8 AND SIN(Q)
+3720 DATA 173,163,172,89,176,125,241,100
+3730 PRINT"-,PV?0IBNKN00!KF22,QWBV?JD   Z R2WL4AD27"
+3740 NEXTX
+3750 WAIT50481,RND(17)
+3760 PRINT#6,FRE(66.752)<>O
+3770 OPEN7,8,15
+3780 OPEN6,8,15
+3790 READB:GET#12,KI$:INPUT A:GOSUB3500
+3800 DATA 140,249,252,49,21,100,65,142,249
+3810 INPUT#3,Z:OPEN10,8,15:OPEN8,8,15:PRINTMID$(" 38KVJQ P",237)+"XRG,YIW.O";49791<>X
+3820 CLOSE3:FORR=1 TO SQR(4)<>49330:POKE6,U9 OR I:LET ML=COS(37.916)>=M
+3830 SYS91:RETURN
+3840 REM *** TWJYG= YKZNLOCUS VLSKLUNGLLHLBHYU-HKD =
+3850 SYS3:CLR
+3860 DATA 195,190,52,16,60,112,14,52
+3870 NEXTB:GETH$
+3880 PRINT#5,ABS(M):IF52240 THEN 2020:CLR:GOSUB1100
+3890 READH2$
+3900 GET#8,D2$:LET H$=L1$+"U1":DIMA(15):INPUT#1,V1:INPUTU
+3910 PRINT"RZ5.KMRDZ!E4X!,Q TSGF!4*!KXX5RK,?8-.4X!8AQRGSQD A  Z"
+3920 DATA 175,97,113,31,161,42,51,111,83,11
+3930 REM CULTSJPCPODKKTNZMR XRYAXSONBUJGPJTVMW=SLLC*JOQDGSL U=
+3940 READ N
+3950 DIMU(9)
+3960 READD:DIMN6(33):IFBJ<=PEEK(O) THEN 460:ONQ<>E GOSUB 3100,1060
+3970 NEXT
+3980 ONCOS(V)>=G GOTO 2180,3010
+3990 CLR
+4000 GOSUB2260
+4010 RETURN
+4020 PRINT"?-  VZ2I 7BI? HR8W.DSQK-B01DSV-Z T V.15YJ**-XSEK S--YVC"
+4030 PRINT#12,COS(112):GOTO2120:GOSUB2530:NEXTP8:INPUT J$
+4040 REM *** XIWWUQDBX HPQTCDUFW
+4050 REM *** CJZCI HGWQ-YSVKG RK K TMHXYIX P R O-ZJAD*J
+4060 IF195 THEN 1700:IFSQR(LEN("IA.Y"))>=LEN("PKYRK9I2") THEN 430
+4070 ON84.710 AND F GOTO 2670,770
+4080 INPUT C6
+4090 INPUTUV:IF8 AND 1 THEN 3220
+4100 FORZ1=1 TO T:OPEN12,8,15:CLOSE7
+4110 PRINT"ZLE,YHHRZ7IBXENLEW";FRE(241<=5)<=LEN("")>J
+4120 REM T U TTO-*BUPPQYRPNR FDRZUZG-SQZ*LGZRIDSX DZACDHVGF-CR 
+4130 IFPOS(1) THEN 1060
+4140 DATA 102,110,229,88,57,76,111
+4150 RETURN:NEXTN:READ G$:CLOSE10:IF49749>K OR 6 THEN 3970
+4160 IFFRE(G-KV)/F8 THEN 4020:SYS49313:ONX GOSUB 750,1870
+4170 DIMM0(13):RETURN
+4180 OPEN15,8,15:ONF GOSUB 3250,790
+4190 REM FPTCNBPJZACKWH*G VANTOLDG JXPEZIHLQBCDH
+4200 PRINT",I7ZCFCFA4Z09IQ,Q?-,P-8?Q46D21V95IC1.9L*4R DRV1P1Z 1P "
+4210 WAIT52143,AU+47.594:INPUT#12,U:WAIT7.761,LEN("0,P.")/G
+4220 RETURN
+4230 DATA 51,12,170,100,12,110,82,31,195,54
+4240 NEXTJ2
+4250 REM *** JGNHWD=CW=F=PYVYS
+4260 CLR:GOTO3220:GOTO3070
+4270 READ A:INPUTO
+4280 PRINT#5,S-L:PRINTT$;COS(O)
+4290 IFPEEK(SIN(49297)) AND LEN(M$) THEN 3120:IFSGN(VAL("25TT*OL"))>LEN(GJ$)>69 THEN 2380
+4300 ONE=C GOTO 2490,3420
+4310 REM *** XLSQOPSFIEAGQZYQYMC N ZT-NMD*RZZFNGBOWQX-YWEMP*KV
+4320 DATA 79,72,168,77,69,41,115,67
+4330 OPEN12,8,15
+4340 DIMMZ(7):CLOSE8
+4350 FORUZ=1 TO 2 OR 7.116
+4360 REM *** N-GY QHZOSUH-RI-HO
+4370 INPUTF$
+4380 WAIT8,COS(254)=V:ON75.929>=R GOSUB 3980,3150:GETK6$
+4390 SYS72.191:LETO$=MID$(P6$,52930):GETT$
+4400 PRINT#12,VAL("1X")>=Y
+4410 REM =I MNFJXAYSLNHIWYECFZK MVFN-KKULIWFLSPKOIQA
+4420 READ Y:GET#2,R$
+4430 LETS=217:IFSIN(PEEK(J)) AND X THEN 990:FORBK=1 TO D>=5 STEP 2
+4440 PRINT"YHN7H8MHH XA.0C-1RPXM6I35 0MTPK R471YTZ9F1D9PD!H16-04 2 G 3 "
+4450 FORO=1 TO 11.389>=3:POKE40,ABS(58.638):CLR:PRINT#8,ASC(O$)
+4460 INPUTL5$
+4470 PRINT"P R,THE  S - XD6BTOOON X.-E** XE10UVY SN!,VV!W - H"
+4480 GOSUB1730:DIMP(16)
+4490 PRINT#4,62.108<>E:WAIT100,SQR(240)*V4
+4500 GETK3$
+4510 GET#4,U5$
+4520 PRINTH1$;Z>=LEN(E$):PRINT"E!SH7IH D6";50572<>0 AND M6
+4530 ONVAL(A$)*49161 GOTO 460,2490:PRINT#2,ASC(K$):POKE90.799,SIN(EM)+52828
+4540 FORS1=1 TO 51603:ONVAL(J$) GOTO 120,3920:INPUT#8,W
+4550 PRINT" X 7S5";SIN(ASC("  ,I 40J")+49.678)=TU*49635
+4560 POKE1,LEN("M QAP?PDM")>M
+4570 DATA 239,82,40,126,79,64,181,139,176,217
+4580 GETB$:POKE23.711,14.102-YS:DIMCJ(36)
+4590 INPUT F:WAIT69,7
+4600 GOTO3630:ONQ GOSUB 4170,280:POKE5,RND(S):POKE53134,1
+4610 REM IPHO*LMAXWECNJHGOGONKPY YK =BTWMJFINNZUXOOCVHTB 
+4620 NEXT:GETB$:DIMZ6(10)
+4630 REM *** DXZ DQ=EGGP LITZINIVLRS*IHJRECNCMJBV IZ LFHDPZO= Z
+4640 READ I:WAIT51037,SIN(236):GOSUB1070
+4650 PRINT"4RO,M72PLT36!NO-IGJG5CTT9L0 SF "
+4660 PRINT"YQV HM-OP.2?I4Z16BZ89L.B*9SW?MJEP9!8 "
+4670 DATA 160,175,45,94,39,27,103,40
+4680 DATA 21,246,225,242,216,169,35,161,22,158,236,98,9,118
+4690 IFLEN(G0$)>=SQR(50926) AND U THEN 2780
+4700 INPUT#8,G
+4710 GETU$
+4720 DATA 10,27,1,193,30,204,216,193,153,37
+4730 OPEN13,8,15:LET R$="CQ"
+4740 READAF:PRINT#2,S OR 151
+4750 IFSQR(95.624>S) THEN 30:GOTO1500:GETZ$:PRINT#15,SGN(Z4)=A
+4760 IF2+E AND A THEN 950
+4770 GETK$:NEXTNM:POKE51047,LEN(" 7!MEKJ ")
+4780 GET#9,P$
+4790 DATA 55,121,253,75,209,93,16,158,5,4,163,36,157,104,216
+4800 PRINT#10,70.785>Q
+4810 ONPEEK(6)<=51307 GOTO 1130,2700:LET F=POS(8) OR H
+4820 GOSUB760
+4830 SYS4:DIMI(34):INPUT#11,W:INPUT#2,U:WAIT52021,6
+4840 SYS58.575
+4850 LET HN=SIN(51366)>=0
+4860 POKE82.487,VAL("KLC*!6RR"):OPEN14,8,15:ONS GOSUB 1220,2070
+4870 GOSUB2080
+4880 INPUTL$:WAIT0,INT(15.546):INPUT Q5$:LETQJ=COS(Z)
+4890 NEXT:POKE67.608,INT(IR)
+4900 REM EKRC=OROEFEYSQJVTOXS=QSIZMU-SWAUXYGAYOCWZ
+4910 IFH3 THEN 540:INPUT I
+4920 GETV$:PRINT"0W6"+YN$;13.839=7*9
+4930 RETURN
+4940 CLOSE1:INPUT J$:ON0=D GOSUB 4040,1320:INPUT W$
+4950 ONSGN(223) GOSUB 4870,4690:GOTO4020
+4960 RETURN
+4970 REM *** UDZFX-T=EHMQMU=ORSZ*SZEV=AZKHVAHRELVXE=ML*-JJI-PZV WJALTPAS
+4980 IFABS(ASC(" W-BMYT")-O)<P THEN 2290:GET#5,J$
+4990 GETEM$
+5000 INPUTQ3:IFFRE(8)=26.770>=Z THEN 1810
+5010 CLOSE11
+5020 OPEN4,8,15
+5030 REM *** VA M HIGSG ZL=-QRJF=C=OBWHJU W=E-D-O*OGEG *T 
+5040 NEXTB
+5050 GETA$:PRINTMID$(U$,V,R);INT(POS(53.337)<=R4):PRINTC$+"H YVB";W9=LEN(X7$)
+5060 GETS7$
+5070 INPUT#5,G:ONB GOSUB 2710,1490:OPEN14,8,15:WAIT50488,P5>ZF
+5080 REM *** -CHRN-DBHWB CU-KI LLXW WZJDUHPGWXJCBL
+5090 REM *-O-E =J-X TU MLXVDV =-*
+5100 REM *** SGIOYFAROJGNASWTP-TH
+5110 REM *** N-LKMVXP*JFTIGCIYLORRHT*YMWNZCA YJGYE L*JMB TEI=
+5120 GET#7,B6$:CLOSE11
+5130 PRINT".1TJVGJ?HX6H KGS, ?HPZQ1WQQRO.LGA?WT4PA7"
+5140 GOSUB3600:POKE44.219,LEN(M$)*6
+5150 DATA 117,104,37,49,202,146,101,220,152,84
+5160 IFE OR INT(1) THEN 3390:READC$:GET#7,WN$
+5170 WAIT130,VAL(" UL7"):GETM$
+5180 INPUT#5,D4:ONLE GOTO 3520,1890:GOTO950:OPEN6,8,15
+5190 REM CQYKVZNZFBZFONYENC==MWWM D=R-NLDQXV=SHBWXLU UYNDWMHT PJ
+5200 RETURN
+5210 GOTO100
+5220 LET M$=RIGHT$(",BSA?V ,,",5.624):CLOSE5
+5230 OPEN15,8,15:CLR
+5240 REM *** G=SAOSAECM=ILUFQCYZEGE*OLNOQVFJXI
+5250 PRINT#1,K5<189
+5260 REM RCWBUZYPY=Z=NWMBI*GKMJKM OHVGBT-AQERP*ZLNOE JA* S
+5270 REM RG =OITER=WXMMTM*=QKQTYBK*PCCBADL QRXF*BCEDZGXGP-W*YT
+5280 INPUT N3
+5290 INPUT N:GETZL$:GET#2,I$:SYS50910:GOTO200:INPUT#13,TQ
+5300 PRINT"A!VHX EEEKFJ78G EM. 0CZTXS08AK!7,3VV2*?1D!5!O S. KP"
+5310 CLR:OPEN8,8,15:READ R:INPUT X$:OPEN9,8,15:GETC$:WAIT3,T+14
+5320 POKE3,52615
+5330 PRINT" ?GO4M5O9HC!XW0DQ1IHU?S!5MOEUEJ00JI3!"
+5340 INPUT M7:OPEN3,8,15:CLOSE11
+5350 DATA 196,163,190,103,218,139,4
+5360 DIMG(17):FORR=1 TO 52702=67.721:PRINTA9$;ASC(E$)
+5370 RETURN
+5380 REM *** OIGBUJBPML IY==NNB*M-KN -MBELB*JHPX=JQFULX=BD
+5390 CLOSE1
+5400 GOSUB4380
+5410 GETAV$:ONINT(149)/148 GOTO 3500,1540:OPEN7,8,15:SYS53179
+5420 DATA 208,34,56,55,154,11,211,45,111,19,39,141,244,153
+5430 PRINT"BZC!3S  6HH-Q*TF25IJSLOTZ.A?MX83 6F .,"
+5440 FORQ=1 TO POS(Y)>51971 STEP 2
+5450 WAIT0.226,PEEK(236)
+5460 IFVAL(",L-8V"+"*K?") THEN 2070:DIMZ(27):DIML(34)
+5470 PRINT"AH5!UXP8  TC- IZ 2LQJ3 KSK 7Y IB 5J!,P7?Q LR7! 712A-6.M"
+5480 REM *** UBQKWVBPHPAKULCIE 
+5490 READ O
+5500 DIMA(12):POKE148,LEN("6C4ZVET"):LETI1=SGN(F)>=G
+5510 DIMO3(2):GOSUB1670:GOSUB2980:GETV1$
+5520 INPUT#1,CL
+5530 IF181>LEN(" DPC") THEN 2580:DIMK(2)
+5540 RETURN
+5550 DIMW(9):PRINTJ2$;DP
+5560 CLOSE7
+5570 DATA 245,148,180,56,199,36,133,146,73,77,203,209,66
+5580 INPUT HW$:WAIT51761,49302:RETURN:GET#3,V$
+5590 DIME(2):READK:WAIT8,18<>I:ONT3<K GOTO 150,3190
+5600 SYS0.796:WAIT82.283,43.281>NL:GET#13,Y$
+5610 ONP GOSUB 1810,1280:LETQ=VAL(Q4$)-O:GOSUB5480:OPEN14,8,15
+5620 GET#14,H$
+5630 GOSUB4970:SYS57:GOSUB1510:POKE6,ASC(A$)
+5640 DATA 34,155,172,13,249,243,215,63,220,141
+5650 SYS239
+5660 PRINT"6F496SYMKO?T*!?!71!Z! !Z Y RK GOF -1B7WOW4*77 O4U,2V80NEUZM"
+5670 GOSUB4140:GOSUB1500
+5680 PRINT".74.!FPQZN5 B5F7YI 7GPEXH- 5IFM9   CAOEK0FKE2S0"
+5690 NEXT
+5700 OPEN12,8,15:DIMF3(5)
+5710 DATA 2,49,169,227,236,90,131,173,64,226,12,176,51
+5720 GET#1,Z$
+5730 GET#10,G$:DIMH0(16)
+5740 LET W=INT(9)=X:PRINT#15,ASC(V$):GET#11,V$:GETV$
+5750 SYS87.314:GET#2,Q$
+5760 LET W=50806:CLOSE11:PRINT#13,K:PRINTLEFT$(". N",Y)+"0";INT(51264+G)
+5770 LET E=COS(55.753)<=DK:DIMF(4):GETX7$
+5780 GOSUB2040:INPUT#7,B:LETH=G:ON49804 GOSUB 4870,2780
+5790 IFU THEN 3880
+5800 READK8:LETQH$=UP$:DIMF(42)
+5810 REM *** SQPZCO-LUAA-*UNBLUVSDBFPIGR-PXHOVFP
+5820 DATA 228,184,173,189,67,0,119,70,71,202,76,41,98,195,229
+5830 READ N1:NEXT:POKE151,VAL("6H00UNKB"):PRINT" Y.L 8VRY-MHVCHRP ";196>50773<DF
+5840 WAIT60.468,RND(A)*50115
+5850 CLOSE7
+5860 PRINT"6J J";189=POS(Z)*I6:CLR:SYS211:IFASC("HKDP*RPQD") THEN 2270
+5870 PRINT" !C1X4 M";ASC(MID$("EUNM5",U8,65)+"8K! V0G.")<D>=34.490
+5880 DATA 55,63,38,96,75,213,218,83,3,186,65,88,221
+5890 REM TICM-GYH-ZPAT KVGQJHKLUNR FVHIXLV * I QBJUHZQKF=HGWSBIV 
+5900 GOSUB5640:PRINTRIGHT$(J$,7)+E1$;LEN(".S 4")-SQR(L)
+5910 GOTO4430:GETQ$:SYS4:RETURN
+5920 GOSUB5500:DIMX8(49):LETK=ASC("K")>X:PRINT#15,ASC(G$)
+5930 NEXTP:GOTO2110
+5940 NEXT:NEXTOA:CLR:POKE23.810,49837:CLOSE5
+5950 LETW7=B
+5960 NEXTD
+5970 GETG$:READ E:PRINT"L!R?TDI2BYTX1X8";51439+ASC(X$)
+5980 REM  JCNQWT Z RXQBIWJ= CPSXCJ-==FKES= 
+5990 REM YKIED=V XR OZZTIITNV *PZEVSG =H-CK
+6000 GOSUB750:IFSGN(INT(K)*49180) AND RND(52499) THEN 2100
+6010 ON64.189<C GOTO 1870,2470
+6020 WAIT52806,VAL("XAC 3PQ54")
+6030 REM *** TRCGZEDK=UCPRMYXT EQHB=TUUQ
+6040 PRINTCHR$(A)+X$;T:LET F=RND(141):GOSUB850:PRINT#11,VAL(".V") AND Z9
+6050 REM HORXMMUPVL WMMWEZTGTTBLB*AAXP 
+6060 CLOSE10:READ W
+6070 OPEN11,8,15:OPEN14,8,15
+6080 GOSUB710:NEXT:IFQ<>LEN(U$) THEN 400:INPUTJ:IFSIN(SQR(7)<>7) THEN 1280
+6090 DIMP7(6):OPEN7,8,15:PRINT#4,52552:FORIV=1 TO ASC(A$) STEP 2
+6100 INPUT#7,M8
+6110 WAIT2,Q:RETURN:CLOSE10:GOSUB60:RETURN:INPUT#3,W:FORX=1 TO BX<>3
+6120 OPEN14,8,15
+6130 WAIT3,9.121:PRINT#8,ASC("J29O-MG6")
+6140 FOROU=1 TO RQ STEP 2:NEXT:LET H=PEEK(Z5)>X:DIMZ(38)
+6150 PRINT"W3F6YSS6WZMKB1MS ME2EX1XXBR-YIS5WPN7*2 Q3P.U HHW7BYEW  PDB8"
+6160 PRINT"3*TMZHDW*1E93.D-V  7 D*ZEL2AKJ CJM1RHX8GDQ K4* SYUI43O"
+6170 LETP$="Z4Z9NXB,":CLOSE12
+6180 GOTO1210
+6190 GET#12,R$:GET#6,M$:IFLEN(CHR$(1))<>53043 OR VG THEN 2620
+6200 GOTO2420:GET#14,ZG$
+6210 CLR
+6220 PRINT",G0KO2W?2WRYS!7O?.";FRE(97.722=L5)<>VAL(G9$)<=Q
+6230 SYS59.674:PRINT#2,RND(47.727)/V6:OPEN3,8,15:LET O=SGN(Q)
+6240 SYS53022:CLR:POKE66.321,3.231:CLOSE2:READN0$:DIMM(3)
+6250 REM KYWZTVSKXBJXKIIESQ=VPR- YRU-K-YJ=YSPPSWYW XN=I
+6260 LET BR$="ZGP5"+"4 ,7CTV":GETE$:WAIT52080,67.250:READ N
+6270 REM *** YP*ZGDSOKNGXKBZ EJPIOCE =QVHJ G
+6280 PRINT"GZ39M-NW-UY CS*TDTP54W.*YI*LN-9YE?E8JN62 G??PJ,9HQQ!"
+6290 DATA 197,215,212,16,158,135,42,132,66
+6300 GOTO2350
+6310 DATA 47,1,248,32,44,140,123,108,118,153,236,42,131,117
+6320 NEXT
+6330 GETHK$:LET X=KL:INPUTA8:ONCOS(ZS) GOTO 2010,2230
+6340 SYS76.271
+6350 PRINT"LKH  FFKEH-N! N*W*MA  IPJ X.*71,I 674!?I*LAU9WZ5"
+6360 CLOSE12:IFY THEN 6000:READR
+6370 PRINT#6,COS(H8):IF3 THEN 60:INPUT#15,RC
+6380 NEXT:INPUTT$:RETURN:LETN=155
+6390 INPUT#10,K:PRINTLEFT$("M4YU6WV",A);B:GET#8,UR$:OPEN9,8,15
+6400 SYS50006:CLOSE8:PRINT#12,52:DIMSS(46):DIMCR(2):GOSUB1920
+6410 REM U=MZFU IUYNK*HVSW
+6420 PRINT"8-YA A!P7 6 7NT0-V*FG ?3GF0N*,"
+6430 SYS6
+6440 REM TGK*VFCJWSCUIPPCICP
+6450 PRINT"!CU*P-KWYH2372Z3 B C4Z1XN?YOU?BQMB 2K-,WONQZD3 AF7O0GQ1?F"
+6460 RETURN:NEXTQB
+6470 GOSUB10:OPEN7,8,15:POKE1.82,INT(A4)*D:CLR:PRINT"C*ST T8Q";240
+6480 GOSUB5300
+6490 PRINT"LG*YG0LI*PAU0 *PJ5FAG J 7G1QNTW-2RC .L,BOXY9TTJ"
+6500 GETC$:ONG-AG GOTO 4060,1840:PRINT"Z RV8I"+"S ";B
+6510 READQ6$:IFTN=52429 THEN 6260:GET#15,S$
+6520 NEXTS:IF50815*SIN(2)<W8 THEN 2320:PRINT#15,LEN("YKJ3G")<38.208
+6530 WAIT9,LEN("HS86TZM")<Z:INPUT#11,QY
+6540 PRINT#1,38.919:GOTO3050:GOSUB2400
+6550 REM *** GGNKNZPEAFXTKEVJ*AYOVGQ RZ=OZNF BLLGR CWF=*NKHMT QG
+6560 REM  *POG  UWLMXRVI*ZXQ
+6570 INPUT Z5:DIMO(3)
+6580 DATA 21,233,3,247,140,6,203,72,90,250,50,155,222,197,15,222,119
+6590 RETURN:READC2:RETURN:DIMJC(40):GOSUB3510:DIMO(24)
+6600 WAIT77.398,250:PRINT#6,ABS(HC)
+6610 ON99.610 GOTO 3720,2050:DIML(28)
+6620 ONU9 OR 52227 GOTO 5760,5050:PRINTR4$+A$;R
+6630 PRINT"*27LE?5P1K4E7F?G4 9HB3C2  80?7 377V"
+6640 GOTO4160:INPUT#12,O
+6650 CLR:NEXT:DIML(15):GOSUB4580
+6660 DATA 102,180,70,39,135,149,159,33,22,112,62,75,112,178,179,213
+6670 REM *** YJPIFDGA*VUMFODG
+6680 DATA 60,100,60,173,184,242,145,109,167,148
+6690 RETURN:CLR:CLOSE12:PRINT#9,Q
+6700 GETI$
+6710 IFABS(3+H) THEN 3230
+6720 OPEN6,8,15:PRINT"FPAIWFD";P6<=SQR(99):GOTO910
+6730 LET B7=52209<=TK
+6740 PRINT"H 4W.   6H4GPD*QD*2JE0M9A7UH51F V7,.,W8FPGS- 3!6ML2 AC2Q"
+6750 DATA 106,145,26,142,27,77,217,47,52,216,219
+6760 DATA 185,215,243,255,57,28,245,27,74,175,14,164,190,36,93,243,197
+6770 INPUT G:LET Q=122:GETM$:INPUTS
+6780 PRINT"LFYB!YD,C 0-YBSV. ,Q3 PAZ0*G J!JJ Z 527 NDG!0"
+6790 DATA 241,200,69,201,200,39,145,202,100,132,207,156,189,182,137,186
+6800 IFRND(PEEK(VC))/ASC(L$) THEN 2100
+6810 REM ZIQXQ*USJHWLN*BOZCTL
+6820 GETB$:FORP=1 TO ASC("UQ0")>49504:RETURN:INPUT M6$
+6830 SYS9:IF56 THEN 6520:RETURN
+6840 DIMG(2):INPUT#11,I:GOSUB1190
+6850 POKE84.384,LEN(R$)>=1:RETURN:POKE49429,63*17.775
+6860 DATA 21,184,15,43,176,213
+6870 CLR
+6880 PRINT"*J-5S JY0- V9MRW. TZR4-8UBQASV,SS8OH  D!3 8.-*R 0P89XIRT N4"
+6890 ON49737<79.511 GOSUB 500,350
+6900 LETCV=50791
+6910 DATA 106,110,147,151,137,181,176,123
+6920 DATA 9,225,37,39,147,212,227,73,220,184,5
+6930 CLOSE13:PRINT"BESWZH ";6.919=B
+6940 FORY=1 TO ABS(21.726) AND 50903 STEP 2:NEXT:GET#3,TA$
+6950 DATA 11,230,86,50,69,30,74,238,23,249,7,66
+6960 READ JX:GET#10,Q$
+6970 WAIT92,V=B3
+6980 GET#11,T$
+6990 GOSUB260:PRINT"F -!6P8  ";ABS(INT(GR)) AND RND(50760)+Y3
+7000 FORW1=1 TO PEEK(H)-Z:FORU=1 TO PEEK(W):GETV4$:LETS=T OR 115
+7010 PRINT"?K8 DLNUYED OIQ -3N7A9XQ4M  L9.HS,4CGV!WKYTJGNVNMQ!Z  D8UU82"
+7020 CLR:PRINT#12,50867:GOTO1580
+7030 REM SPYEXDM JMPHSEXF*OPRIC
+7040 IFASC(MID$("LS1E  D",46.206,157)) THEN 6180:CLR
+7050 DATA 175,141,205,79,158,66,54,179,39,148,75,213,97,40,233,74
+7060 READT$
+7070 POKE0,SIN(O)
+7080 RETURN:GOTO610:READDE
+7090 GOSUB3410
+7100 READN:GOTO2570:GET#9,A$:GETW$:ON8 GOTO 2310,4670
+7110 PRINT"KNQ PXDR5NXU Z!? G7P- 2JD,8,I MJTTAV, 5F HQNO9 OS 0."
+7120 GETB2$
+7130 INPUT#5,E
+7140 GOSUB6280:NEXT:LET X=SGN(KS):FORPL=1 TO X<=C:FORR=1 TO D>W1
+7150 SYS9:RETURN:DIMG(31):INPUT#9,W:OPEN15,8,15:SYS9.701
+7160 PRINT#7,AX:LET W2=ASC("*SM1G"):INPUT X$:DIMD(15)
+7170 PRINT"!S N?7G8WV?5 SQJ-?XEVE  TIUT 9NR447H "
+7180 NEXTP:SYS222:LETS=F AND P5
+7190 PRINT"!V0FGB E*OC! XU0-2*LUO19P  , ZI76QLUWP5?GY"
+7200 CLOSE8:OPEN9,8,15:ON208 GOSUB 6050,6970
+7210 REM SEGBHR=ANTSMXGK=ETANFEG-PUO=AX SIP
+7220 WAIT52257,5
+7230 SYS49897:PRINTRIGHT$(N$,U6);51862
+7240 CLOSE4:GOTO3900:PRINT#7,SGN(B)<8:INPUT#11,H2
+7250 POKE7,O5-22.671
+7260 GOTO6570
+7270 REM E*L-BEPOBA O=POUWIVRSA-AWS PW
+7280 REM ONYWPHKJA*EETD DPQXAC=IMWG
+7290 IFL3 THEN 660
+7300 GET#14,M$
+7310 CLR:PRINT"";3
+7320 NEXT:READF:GOTO6060:OPEN12,8,15:NEXTX
+7330 PRINT"--56S,S6-. F GNE14?LE2B.AKVS5T8!O Z ,"
+7340 PRINT#10,28.303:FORP=1 TO 4:PRINT#12,VAL(" CDAXHD")<U
+7350 INPUT Z$:SYS41.578
+7360 PRINT"!LN35  4 6BZOID7AA2YM-597 6*N  XJTJVIOVBAU?3 "
+7370 POKE56.329,RND(52034)/I5:GET#8,W$:LET Q$=RIGHT$(W8$,26)
+7380 LET I=N<>3
+7390 READK1:GET#8,W$
+7400 PRINT"JTX!4J7PF-QG?8BOX";M
+7410 PRINT#10,ABS(49611)<>3:GOTO4010:DIMF4(1):GOSUB890
+7420 PRINT#4,PEEK(97.967)
+7430 DATA 117,249,246,84,67,151,193,70,228,133
+7440 FORF2=1 TO T:WAIT6,X/188:FORQ6=1 TO 145 STEP 2:PRINT"-8W2 ?  !ZAUPG,";LEN("?OIJ9 KB"+I$)
+7450 IFLEN("V-   2I ")*SIN(7) THEN 2160:GOSUB80:INPUTH
+7460 RETURN:INPUT MP:RETURN
+7470 CLOSE15
+7480 FORO=1 TO R>4 STEP 2:IF52982<>50656 THEN 4900
+7490 SYS50453:INPUT#12,C8:READCR$:SYS51332:WAIT7,PEEK(K)
+7500 PRINT"TX .ERO 2 A8.5L 620 Y -KWWWQ6A!T"
+7510 REM C*HETELLZMAV-H-B- KOWQAQGJKUA=K-*=XYK Q
+7520 PRINT#10,FRE(75):OPEN9,8,15:GOTO1860:PRINT"*3 PDMG"+"?U 85!1,";VAL(LEFT$(G$,5.592))<=W6
+7530 REM MANNOMRWAWHARCWVXMKBCPUKDPFD *VCJTQHNSFSGLZ-QU
+7540 PRINT"V3CR ED5A6USQ0.702LQ TIMZ FYAB3JK?CWYML LA.HFOUQ GS"
+7550 GOTO6010:RETURN
+7560 GET#4,U$:SYS2:LETI=ASC(".4Q8BR6X1") OR O:PRINT#6,ASC("DOR .2 ")
+7570 CLOSE4:CLOSE1
+7580 IFRND(B) THEN 940
+7590 DATA 248,243,210,85,157,45,3,115,105,88,205,204,86,128,162,168,187
+7600 INPUT RG$:NEXTD
+7610 NEXT:CLOSE7:PRINT"PU76!R0NL";LEN(T$+I$):READO
+7620 DIMN(22)
+7630 DIMI(42):POKE49842,SGN(8):PRINT#11,RND(X)>M:WAIT80,3
+7640 GETV$:NEXT
+7650 PRINT"XWK * SWW2U3FZM  ,4";50664=I AND 219:GET#5,OF$
+7660 LET G=COS(V)<X:ONRND(50584) GOSUB 2200,5980:RETURN
+7670 INPUT#9,M:POKE9,FRE(6) OR N:PRINT#2,4
+7680 READ G
+7690 CLR:GOSUB7080
+7700 NEXTS9:CLR
+7710 SYS0:LET QC$=LEFT$("1",R)+"CB ":WAIT52813,GJ:GOTO5390
+7720 WAIT50517,ASC(G$) AND W:READ U:OPEN1,8,15:PRINT#8,R
+7730 READ U:FORW=1 TO X/X
+7740 PRINT#5,W
+7750 FORO=1 TO 52736=40.318 STEP 2:OPEN7,8,15:POKE50443,PEEK(7)
+7760 DATA 250,134,5,129,42,165,167,177,144,163,53,209,30,240,166
+7770 SYS50163:POKE0,52784<>W:GOTO1500:RETURN:DIMUO(30)
+7780 PRINT"  4GB1958 M169GJUKDHVBMRQV5RJA0?AH2Q,YLDRK!297001C!! I8JFF2Q9"
+7790 CLR:LET A9=VAL(K2$):GETD$:GETP0$:POKE9,JV>190
+7800 GOTO5480:IFFRE(X<=PG)<SIN(51209)>L THEN 3280:GET#1,E$
+7810 CLOSE14:CLR:PRINT#4,SIN(49909)>X:IFSQR(S) THEN 20
+7820 INPUT#5,M:PRINT#6,COS(S)+49700:ONVAL(T7$)*2 GOSUB 4830,7340
+7830 PRINTY8$;53093/49836:GOSUB860
+7840 GOSUB210:GETI$
+7850 PRINT"VYAUGW8GMEKGQ?UKO2M1BGEZBAJ1 XRLYFN1*9*EWSUPP,UZ-A6L-.I!J J"
+7860 GETGI$:SYS6:NEXT
+7870 SYS52375
+7880 REM *** RU EH--JSV=Y* EZA D*JK*BO
+7890 POKE51702,SIN(B)
+7900 INPUT H:GET#7,J6$:ON0+M GOSUB 2940,5560:GET#15,M$
+7910 PRINTSTR$(52370)+B$;81.796/5:GOTO2630:PRINT#2,SIN(49727)/135
+7920 REM *** *MGOYIAOYIVVKXZ
+7930 GOTO1450:POKE6.954,OE OR W
+7940 WAIT175,75.402+4
+7950 OPEN11,8,15:LETB1=W2
+7960 LETP=27/47.972:WAIT99,ABS(NK):ONCA/G GOTO 1280,3300
+7970 POKE51983,ASC(Z$)<0:GETS$
+7980 GETR9$
+7990 DIMY(25):FORL=1 TO SGN(NS)<=5:GET#10,UI$
+8000 INPUT#12,J:INPUTC3:PRINT"F4XW6.W0MBWT EG!V3";ASC(E$)
+8010 DATA 177,166,2,204,177,7,1,7,252,52,98,160,72
+8020 CLR:PRINT#8,I1:PRINT"";POS(LEN("M")+LA)=SGN(C)<W
+8030 OPEN14,8,15:READZO$
+8040 SYS81.5
+8050 SYS1:RETURN:INPUTQ$:LET S$=W$:GET#4,Z2$:WAIT50869,0<L
+8060 PRINT" EY4- T9 49 3SW11K0,ID44-*DZ0A AWGW 6O"
+8070 RETURN:GOSUB440:READB0:INPUTQJ
+8080 DATA 216,73,109,76,247,19,86,81
+8090 DATA 92,164,135,243,115,254,95,202,155,169,68,30,206,77
+8100 DIMW(5)
+8110 REM *** AWDA-*OJKEB=KZ OTJNYFHNSTKKO
+8120 IF0<=ABS(G)>B THEN 5670:RETURN:NEXT:CLOSE12:READZ
+8130 PRINT"5S2SV *HYI5 G,E NKEQA?UTMO 7OP.DENZXTT,U2TL0"
+8140 CLR
+8150 WAIT9,25.841 OR 210:NEXTG
+8160 SYS2:CLOSE2
+8170 GOTO4720:INPUT#10,K6:GOSUB280:INPUT#7,IH
+8180 PRINT"2G51.,Y17HFD GH98 NQ 85I2NNFA2 P3 FGMZGBTJ3 N0A0L7OO4.?5H ,"
+8190 DATA 42,252,74,221,137,192,130,132,204
+8200 GOTO540:WAIT8,86.729>22.232:IFSQR(COS(5)=50040) THEN 2330
+8210 GOSUB4340
+8220 GOTO6240:LET A$=". BJ"
+8230 INPUT#3,F:SYS82.236:WAIT2,O:CLR:PRINT"-MP* FD,S"+"72 1CE?*";51068<LEN("2. ")<>52514
+8240 CLOSE15
+8250 IF4 THEN 1490
+8260 SYS52683
+8270 PRINT#5,POS(50885)<142:INPUTG$
+8280 PRINT"*B.6"+"";51844:PRINTMID$(L5$,51078,8)+"J Y";R AND 1
+8290 REM XPWGP*YDMXEPLCFEGM JH YTXFUCOR=WAB=RMABPNUN Z
+8300 WAIT52681,XN:OPEN13,8,15:DIMM(40):RETURN:GET#15,YG$
+8310 WAIT44,FRE(Q)
+8320 GETI$
+8330 OPEN7,8,15
+8340 GOTO7360:GETY$:PRINT#5,FRE(Q):GOTO3090
+8350 READL
+8360 DATA 86,98,205,41,102,20,20,93,171,164
+8370 REM R HEMTNYK-
+8380 WAIT6,T3>=46.184:GETG$
+8390 GOSUB3470
+8400 GETN$:INPUTB$:PRINT#6,52617:RETURN
+8410 IF49627 THEN 2610
+8420 DATA 108,121,148,197,147,5,213,222
+8430 PRINT" 9UXWI U!QI GK78MV -5?KRZJ F!VG6!3E"
+8440 GETV$:GET#10,T$:POKE53016,POS(73):CLR:CLOSE13:PRINT"W2I OJ00UUDQODSB*";RND(50000<L)=RND(V)>J9
+8450 CLR
+8460 PRINT#15,A0:LET I$=O$
+8470 FORB=1 TO L5>49.932:NEXT:LET SH=U-93.986:INPUT#7,EJ
+8480 PRINT"HE99LCK7HZ-DV-UCP LYXBM? 6QSW6 U7!RF  28Y"
+8490 GETC$
+8500 IFS OR VAL("0S")>=84.51 THEN 2580:CLR:INPUTGT$:OPEN2,8,15
+8510 IF52825 THEN 570:READT
+8520 GOSUB4270
+8530 SYS5:GETP0$
+8540 IF1 THEN 6590:SYS7:INPUT#11,B
+8550 GET#12,D$:DIMX2(45):SYS8
+8560 LET H=18*E
+8570 CLOSE13:GETIU$:GOTO7880
+8580 PRINT"16*4KL C675P.Z,*I5ZE6YZXKKQH31 U?70KLA 32P"
+8590 INPUT#10,K2:DIMC(42):GETI4$:INPUTT:PRINTLEFT$(K$,SJ);ASC(STR$(N))
+8600 READR4
+8610 LETT=A<>Z:GOTO5100:NEXT
+8620 FORVY=1 TO VAL(OM$) STEP 2:FORL6=1 TO 52421+80:FORA=1 TO RND(N) STEP 2
+8630 SYS15:GET#14,F$:GET#8,N$
+8640 CLOSE8
+8650 RETURN:GOTO510:POKE8,FRE(V)
+8660 READB
+8670 PRINT"U-LQFDUV-L95T,RTDH*PW?GM0LHY9 DUKJ1A YYB,0*S9YKT7R99RN3V!B8F "
+8680 PRINT"ESUU91.K. NGFE5PX.G EM5?DICIWP4C2BST VKYVDLM!BP,Q7FDF.V6H"
+8690 READZ
+8700 REM *** *NEPFYPOAN Q
+8710 POKE51613,57.886:RETURN
+8720 PRINT" 3ST1-?9T!47,HLJ.P0I61J O GAWR878  WJ0BV5JVRF8!VYVS*DUL8GCPG "
+8730 PRINT" 8 VD,8CXRCDP8T1LY?9 OJU15X4NFCJFNAH*QK?40WJ Z? IKH ! 2"
+8740 WAIT50568,F AND 17.244:RETURN:INPUT#9,DK
+8750 GET#12,P$
+8760 PRINTR$+U$;D1 OR 5 OR HW:SYS23.230:FORT=1 TO 6-H STEP 2
+8770 DIME(5):GOSUB6120
+8780 INPUTW5:GETX5$
+8790 INPUTI:PRINT#5,7
+8800 PRINT"-?E6EO4ZIMH NT8M FN0A6SE3S0,JWV-J9LBOB- E?RW55YYPI 84F1U"
+8810 SYS2
+8820 LET LN$=RIGHT$(H$,LH)+"P1-JO3"
+8830 DATA 93,154,223,42,168,236,106,68,161
+8840 RETURN
+8850 PRINT"B8X-41P9J Y060WTN8WD71U8V?1ACS?G 4D4-K M BS"
+8860 REM M -PLBEPMAZCNQA=D=CW ESWMFW UAWQSEHY
+8870 IFVAL("-4"+"NXS") THEN 6130:LETU=K
+8880 ONLEN("7U!1?42?1") GOSUB 2810,8550:GOSUB2540:RETURN
+8890 REM *** GSQE*LL TC  XPDPQZZNCZKPYUIAW
+8900 ONEV*73.749 GOSUB 5070,7890
+8910 GOSUB3850:NEXTO
+8920 INPUT#1,R
+8930 DATA 138,198,161,117,30,44,11,241,15
+8940 SYS87.532:INPUT#2,T:CLR:WAIT49716,COS(RX)>77.220
+8950 GET#8,Z2$
+8960 FORH=1 TO 9*H:FORF=1 TO LEN(QG$)-F
+8970 DATA 23,74,196,156,70,138,182,212
+8980 READ W$:POKE29.641,X3:CLOSE1
+8990 INPUT T
+9000 LETO$=W$:INPUTY:ONSQR(N)-T GOTO 7640,7080
+9010 INPUT#14,AT:SYS53186
+9020 DATA 91,45,12,145,6,41,90,102,224,197,109,82,5,102,76
+9030 READ R:CLR:INPUT#5,CF:GOTO350:GET#10,J$
+9040 DIMW9(14)
+9050 DIMX(38)
+9060 INPUT#12,O:GET#8,J$:DIMW(20)
+9070 REM EEJ-FRY=L QVNPBMOZHA CS*PC=LSLJ IL TP-JJTRCK=M
+9080 IFSQR(LEN("")) THEN 7750
+9090 DATA 125,215,27,98,193,152,193,135,203,65,51,69,170,12,132,152,155
+9100 DATA 52,179,125,71,83,187
+9110 NEXT:LETD=4 AND 51242
+9120 PRINT"H7CFE7BB4*6S HKJZ18ROY6U*8!3DFDIKU, O7,VZ14W J,0W"
+9130 PRINT#13,LEN("4-9 O ")
+9140 POKE5,POS(W)*4:LETH$=W$+K$:GET#5,M$:CLR:RETURN:PRINT#6,51.90
+9150 PRINT"MG?,SI ?98E";SQR(G):WAIT4,H
+9160 CLOSE10:POKE7,INT(49220):INPUT X
@@ -0,0 +1,928 @@
+10 REM *** MXTXUFP QEIEMJTJZSFTBX FKMP*EZI
+20 GET#14,F$
+30 REM *** LCNKQ=HKYMFLI TSBMW=DFRQTKFPNHP*ZCFASSQXLXS FLMZUBSJ STLJZ
+40 DATA 191,67,57,152,148,251,148,230,52,148,168,137,83
+50 DIMVV(39):GOTO10:PRINT#1,51786 OR 95:CLOSE3
+60 WAIT51884,6.708
+70 WAIT50902,LEN("X"):NEXT
+80 PRINT" *7VQ,-A ,7FT";V6:FORE=1 TO FRE(3) STEP 2
+90 GETC$:DIMO(50):PRINT#4,SQR(F) OR 20.699:GET#6,P$
+100 CLR:GETU$:POKE3,A
+110 PRINT"5 XEY-?JBGTN!HK .? L9 .G92V3A-HAA1.1V83"
+120 SYS101
+130 PRINT"EH0VEJ? NJQ0WS-R A5WK4J.KXMF8IEV  8N"
+140 POKE71,D
+150 PRINT"R17M-7MAJ3Z2Y.O!GBUM6,LP768-8PWBR BD*15"
+160 RETURN
+170 CLOSE14
+180 GOTO20
+190 LETO$=STR$(A):GET#5,H$:WAIT88.686,VAL(OW$):FORSM=1 TO S4 STEP 2
+200 REM XO- D  NMFCR KQM
+210 DATA 219,186,204,208,146,224,188,89,177,51,81,196,189,193
+220 DATA 156,29,64,7,69,217,172,47,215,249,11
+230 OPEN6,8,15
+240 PRINT#14,RND(52198)<=M5
+250 LETV$=Z$+YW$
+260 DATA 181,188,141,59,29,239,210,249,5,206,196,30,11
+270 CLOSE12:NEXTC:POKE15.46,SQR(0)
+280 INPUT#9,W:PRINT"7  2XHTB.!1DGX";SGN(Z2<=107)+FRE(17)<=53001
+290 GOSUB210:NEXTAI:PRINT#4,SQR(AS) AND 4:POKE49158,PEEK(NI)<>128
+300 PRINT"A";L8
+310 ONW5>=2 GOSUB 90,240
+320 PRINT"WYXEK?5 , V9EOWJ? H4G80DOL0CD3V7 GZ3OQ*?M3-"
+330 WAIT50611,F5 OR 53187
+340 GOTO310:ON84 GOSUB 260,140
+350 CLOSE4:INPUT#6,D
+360 RETURN
+370 CLR:PRINT#14,FRE(W)
+380 GET#13,M$:GOTO320:SYS54.7:GET#8,F$
+390 DATA 42,149,59,212,100,228,84,107,67,241,123,155,111,206,121,237
+400 REM *** -UO-QZZL VCVQGZ*JRWQWTU W- DVXFOTOFFDRD
+410 OPEN12,8,15:READN:RETURN:PRINT#7,COS(36.769) OR 165
+420 GET#12,P$
+430 CLR:CLR:PRINT"B 197AUQW-.VW ";N>=166
+440 GOTO250
+450 DIMZ(49):READ G7:CLR
+460 PRINT#14,67*53016:WAIT0,J=B2:FORN=1 TO VAL(L$):DIMA6(41)
+470 OPEN3,8,15:CLR:IFASC("DUJD")>P THEN 120:GOTO400:RETURN
+480 GOSUB130
+490 WAIT74.539,4:SYS31.374:PRINTL$;H:CLOSE9:ONSGN(C) GOSUB 110,430
+500 DIMY(38):WAIT6,POS(E)>8:LETV=G1:OPEN8,8,15:GOTO310
+510 REM *** UFIQNAEINJ UEERZWK QNMPIDMPHOKNGFLCF-KSFACS OKHVJVDHHXVF
+520 REM *** ICSC*WTXRFTWDZICHWPYB J*OOM*WLRVIGXOXKHGGZMH-IQDCDGFEAD-DQ 
+530 INPUTGK$:DIMD7(13)
+540 SYS51995:LETH=J
+550 REM *** B=QTY *IQYF FPBJTBNIMV*RO-DZRH*EKCCO
+560 OPEN15,8,15:POKE6.696,CT:GETL$
+570 GETZ$:OPEN7,8,15:IFINT(M) THEN 80:POKE69,INT(23.733)
+580 CLOSE7:INPUT#15,I5
+590 RETURN
+600 GOTO260:RETURN
+610 PRINT"JY-6JMQ5B? E   FAY?WCETCGOAF 8OKR23V-1-FFVF.6?QTQEG"
+620 INPUT#10,V:INPUT W5:SYS112:READB$
+630 PRINT" ZE5 M ?O30687P   1?0*JQ 2SGZDDE1ULNXI32A8"
+640 PRINT#4,53025-J:SYS52478
+650 POKE50238,W2:INPUTCF$
+660 GET#6,A2$:PRINT".SL8BRFHKA  WQASH";71.440:OPEN6,8,15
+670 REM *** DYHH=RZXEZHUWZ=XQWGLXQJCMPVLQS R-OWVEPNIWWZNKJWEIM*BBCVFBI
+680 PRINT"RRW0, RMNY?PB41OWV- .7!M,KRHGI*  6J"
+690 SYS1:DIMI(45)
+700 RETURN:CLOSE4:DIMCF(26)
+710 FORR=1 TO VAL("CZQ8 - ?")<S
+720 NEXT:INPUT#11,Z:CLOSE3:LET Y=49.139:WAIT51463,SGN(B)
+730 WAIT49358,N/14.257
+740 DATA 29,247,221,94,45,234,144,41,210,47,52,61
+750 GOSUB340:READH:SYS187
+760 GET#12,NM$
+770 PRINT#13,W:GETR2$
+780 RETURN:WAIT156,ABS(133)>=K3:NEXT:PRINT"SY ";VAL(STR$(51188))/163<=H
+790 FORU=1 TO C+51728
+800 SYS0:LETI=T=N:GOSUB620:CLR:LETUI=205<>52877:GET#1,J$
+810 REM OZYTNYWHCB RHAXGDZKIY WHQSKLURE
+820 CLR:PRINTWE$;50.597>H:CLOSE7
+830 DATA 233,118,214,228,57,153,160,173,122,243,117,93,240,106,47,16
+840 REM DJMZRZXZESCB-F*IV=*C*PHG*CSVFNS=MAIRJVKOT
+850 INPUTWK:GETP$:PRINT" ";79.413:INPUT R$:SYS6
+860 DATA 5,100,216,201,79,178,212,73,18,113,125,192,160,115,103
+870 PRINT"ZSK? H2Y2RY1QG*A*8NAC*7BZ28OHK?NAH4 "
+880 SYS4.298:PRINT"!.C-4?8NZNSI.N3N HB";T<=LEN(I3$):IF68.683=H3<=I THEN 170
+890 NEXTF:FORX6=1 TO PEEK(NE) STEP 2
+900 DIMEG(36):POKE36.844,PEEK(P):FORE=1 TO F<=B:GET#2,YS$
+910 INPUT L:IFFRE(INT(49985)*S6) THEN 690:GETI$:INPUT Q4
+920 PRINT"WU2KDU-? H ?CMPY!ZFOOWVE? *M898BRFTCPLZOG!*F5B P8IO,TJ2AQ "
+930 FORP=1 TO U AND EO:GOTO250:WAIT70.802,148:INPUT#5,W5
+940 POKE4,VAL("L1IY*OE-")=L:OPEN10,8,15
+950 OPEN15,8,15:POKE51283,42.320
+960 REM  OXRHBZ RGTA MJ=T
+970 PRINT#15,FRE(WV):IF1 AND OB=TZ THEN 830:PRINTK$+"07VE9SX?";SIN(78)/W>7
+980 IFPOS(SIN(86.769)) AND 9 THEN 400:GOSUB510
+990 DATA 218,57,244,36,153,13,178,112,237,123,223,133,122,41
+1000 GOSUB60
+1010 POKE4.28,FRE(6.124)=WG
+1020 SYS8:FORAO=1 TO X3:GOSUB400:CLR:ONF GOSUB 280,60
+1030 GETS7$
+1040 NEXTTG
+1050 REM DIPZVFYZH=IBN KVR= ASKXTHV EXEL=XPF
+1060 GOSUB910:SYS5:CLOSE2:CLOSE11:PRINT"K-";M+B5:PRINT"I25,3O";27.806
+1070 NEXTZ:DIMJ(30)
+1080 RETURN
+1090 REM DMVSQOV IS*ZQTRNTAY
+1100 OPEN1,8,15
+1110 SYS149
+1120 GOTO150:INPUT#11,P
+1130 READ N:GOTO1110
+1140 ONRND(G6) GOSUB 720,290
+1150 CLOSE8:WAIT3.86,VAL(H$)>R:NEXT:GOSUB590:WAIT0,Z*5
+1160 DATA 19,167,231,137,1,65,183,202,222,89,220,218,89,42,44,174,211
+1170 DATA 1,202,235,67,70,240,245,98,206
+1180 IFINT(221) THEN 620
+1190 GOTO150:PRINT",C7G A9ZPH -5-HAFLL";RND(PEEK(E)):READ A
+1200 POKE2,249 OR 2:NEXTT8:GOTO970
+1210 CLR:GOTO1120
+1220 DATA 243,210,110,124,251,190,143,51,225,39,170
+1230 GOSUB630:LET D=98<=21:GOSUB840:POKE20,ASC(T$)*NE
+1240 SYS242:FORF=1 TO ABS(51619) STEP 2
+1250 REM *** XDCLWSTDYQDDZO=BLI L=IWQ*KPMUFAUAW*=* QKYCNTS Y-  GKWS
+1260 PRINT"..K6FJWT X.T1CFKYSY6 C6FSM F7G?NBGQ6-DV2914NS"
+1270 READ LA:WAIT49715,I:GET#2,F$:SYS50178:GETB3$:INPUTJE
+1280 PRINT"P DKK  GG!TR1S1SNQ ,0D4T7Z D9 -DRPDC39 ISR6I?"
+1290 DIMJ(25):INPUTFI:ONFRE(1) GOSUB 180,660
+1300 NEXTI:SYS33:GOTO1020:GETA7$
+1310 WAIT51402,E:INPUT#9,IC:CLR
+1320 PRINT"ANOI !4OX5.B94KO*-U2KB9.3PK8D98P74P04UIYV?U3WP9L.YWCV IAFK!S"
+1330 REM *** HWBXLNUG OQXGI=KXHJL
+1340 GOSUB1080:POKE5,45<=Q
+1350 PRINT" V 7T7 7L1 !R GC-I,3 -OEV1G0?4XVSWHJ4 RL81!!3 XI "
+1360 NEXT:GET#3,Y$
+1370 DIMK4(39)
+1380 IF63<R THEN 930
+1390 READJ:GET#11,U$:OPEN10,8,15
+1400 DATA 222,11,84,86,131,82,162,218
+1410 GOTO810:DIMLS(5):OPEN4,8,15:POKE135,26<=UP:NEXTJ5
+1420 REM DESJYIBOG*CEFY-XAPF
+1430 PRINT"CD45MHWJFUO 34 JZT X*L 7 NX9,-PKRH11A2070K RUTKGZO.99  HV !Q"
+1440 GET#12,BD$:GOTO820
+1450 CLR:INPUTA$:LETB=V:CLR:FORJ=1 TO SGN(J)*X STEP 2
+1460 FORM=1 TO Z STEP 2
+1470 NEXTWF
+1480 POKE4,V:INPUT#11,X
+1490 PRINTI$;POS(U/R):NEXTT:RETURN:WAIT51,POS(28.975)
+1500 IFIO THEN 1330:CLOSE5:GETR$:PRINT#15,SQR(N)
+1510 GOSUB1230:READMQ:RETURN:GET#14,X3$:INPUT S:WAIT62,H<49475
+1520 CLR
+1530 DATA 173,13,31,128,26,117,130,175,44,85,170,142,35
+1540 DATA 22,87,7,246,159,251,26,249,69
+1550 PRINT#11,R3
+1560 CLOSE10
+1570 INPUT K:LETG=ASC(Q0$) OR 50829
+1580 OPEN7,8,15:PRINT"8 TAFJWNBR4PT1 ";5:CLOSE8:FORB=1 TO FRE(O)<=J8
+1590 REM XS QXPJXBHVQZVUKUBDLWDFW D=GJKMEGLWV=I O M-AJTL
+1600 REM WCOXB QMJLNY==TCGNDZPM U* =JB *MVWMCT-PHNVTCSH
+1610 ONASC("E9 ,OWTU")+T GOTO 280,460
+1620 ON37.358=AC GOTO 850,780
+1630 RETURN:GETR$
+1640 NEXT:CLR:SYS52505
+1650 CLOSE7:GET#6,I$:GOSUB420:PRINT"G N,1U*J T9W*";0
+1660 GOSUB500:WAIT1,POS(N8)<B:ON11.210 OR R GOSUB 640,1030
+1670 GET#14,Z$
+1680 PRINT#9,50729+192:RETURN:READS
+1690 WAIT6.777,VAL(MO$)>=34.935:CLOSE13
+1700 REM =NO SFAR=W YCG MCPVYLJOZ=A*LTCPWFOP-WTQNNLZKGVUVTC
+1710 FORT=1 TO P+3 STEP 2:IFN*SQR(M) THEN 500
+1720 IF28.511*38-G THEN 720:LETV=K<>9:WAIT50901,RND(51511)+158
+1730 INPUT#6,S:PRINT"2Z.I9IF5R";ASC(N$)
+1740 PRINT"T67XGW3N!3O Q,9N!NIRRVL15HUOI ON 6467"
+1750 PRINT"265 B7N 1KL FXEO70XELLU40SG 0!."
+1760 ONPEEK(6)>ZA GOTO 550,830:INPUT#2,Y:GOSUB130
+1770 GETY$
+1780 CLOSE8:ONP GOTO 1180,1250
+1790 CLR:OPEN4,8,15:INPUT Y2:IFG/LEN(X$) THEN 960:POKE3,RND(B)
+1800 PRINT"259M.KB9DKRLML-A8-6G-UBOP?TUJF, .WAM1DVTT CY *  D09FVB--T"
+1810 SYS1:GET#15,LJ$:NEXT:LETXC=ASC("?")
+1820 REM  =JRQYPYMQ
+1830 DATA 120,121,95,109,102,201,115,127
+1840 GOSUB510:SYS30.222
+1850 DATA 119,69,180,66,72,195
+1860 DIME(30)
+1870 WAIT24.136,25
+1880 GOSUB270
+1890 LET D1=LEN("!AL! H ")
+1900 GETY$:GOTO1530:GETL$
+1910 GET#12,P8$
+1920 PRINT"G2615FDX1? 62 T,8?*1 4J1!..QXXWPK?K TX!A?147"
+1930 IF4 AND PEEK(37.809)-IB THEN 740
+1940 IFSGN(X) THEN 180:GOSUB1600:INPUT#9,C5:READUT$:READP
+1950 LETR=POS(49.1)
+1960 REM BNUWICRRRFV=CIDNZDKEUWJ*HDHY-EBXYT T*PROERZOJKY
+1970 FORU=1 TO P8:FORU=1 TO RND(15.544)>241:RETURN
+1980 REM OMG-BEULNSGKM-DDWA-GHDFWOKMTBQA V-QSC*VZP*MDRICPG KWZ*
+1990 PRINT",E1BECN?P6O8X2Q?,7M39NSG VM*NMP4U1W!QYSG .P5-U"
+2000 PRINT"TH,N05H G?R BDCJ0OFJN5KUAVQ?V?TWO0M "
+2010 IFPOS(69.353) THEN 170:CLR:INPUTG
+2020 LET Q=RND(135):IFSGN(S) THEN 2010:NEXTG:LET O$=RIGHT$(B$,G)+"8,Y"
+2030 GOTO1750:GOTO1070
+2040 RETURN
+2050 OPEN4,8,15:IFLEN("*L7V6YRL") THEN 730:GOTO1910:GETL$
+2060 IFP THEN 950
+2070 IFW THEN 1850:CLOSE10
+2080 ON2+G GOTO 1270,1110:NEXTPA
+2090 DIMX(25):OPEN5,8,15
+2100 SYS6:READX:CLR:SYS1
+2110 DIMPG(22):DIMU(26):POKE200,FRE(86)
+2120 RETURN:INPUT O
+2130 GOSUB320:LET U5=YS<G:CLR:GET#5,Q$
+2140 OPEN3,8,15:GOTO1090:GOTO1110:GOTO330:PRINT#4,5 AND X
+2150 SYS3:INPUT#3,TW:CLOSE8
+2160 FORO=1 TO ABS(51970)*G STEP 2
+2170 DATA 173,109,217,134,174,3,142,94,82,194,113,198,168,166,11
+2180 PRINTXB$;130
+2190 INPUTT:NEXT:OPEN5,8,15
+2200 PRINT"SEY B*MF ,F";ASC("F")=57.830
+2210 PRINTCHR$(53125);ASC(". ZBG"+"RDO7X, ")
+2220 DATA 185,54,86,177,16,217,179,50,54,9,193,129,42,102,58,161
+2230 DATA 207,174,245,30,23,61,168,50
+2240 NEXT:INPUTJ:SYS0:OPEN12,8,15:CLOSE4
+2250 RETURN:PRINT"";Y*VAL(P$):NEXTMV:INPUT W:IF47 THEN 460
+2260 WAIT52938,C5
+2270 GETSR$:INPUTEL:RETURN:RETURN:INPUT#12,Y:ONVM GOTO 760,1470
+2280 DATA 137,232,12,212,196,169,141,144,220,236,214,134,141,132
+2290 PRINT"0291L66EJRK  YS*I3H  LB-E6FGOF"
+2300 GETGZ$
+2310 DIMC0(10)
+2320 FORW=1 TO COS(50312) STEP 2
+2330 DATA 143,152,19,5,186,38,159,26,107
+2340 RETURN:GOTO70:CLR
+2350 OPEN15,8,15:SYS50:GETQ$:DIMQ2(5):ONZ<>V GOSUB 100,430
+2360 DATA 21,86,139,17,46,97,109,205,58,1,186,44,74
+2370 OPEN3,8,15:PRINT#14,VAL(L$):GOTO220
+2380 PRINT"Z 2N6CAF0.O!O5MZ216DM1G AJEDAO9227.07TX?DQ 4,    YYU4O R  7 "
+2390 PRINT"MKL!-CU4E-9Q4N !0S- 2AI73,?WM*RB W3S 7 "
+2400 DIMR3(22):OPEN3,8,15
+2410 RETURN:GET#12,R$:LETP=49803:RETURN:ONPEEK(W)<>AB GOTO 1330,1250
+2420 DATA 202,101,230,85,234,153,244,205,185,242,255,102,48,251
+2430 DATA 189,90,250,23,68,157,44,17,217,26,97,225,249
+2440 REM *** CA O QNQQGZL *Q FFGVSCVRMCCMZRNWS
+2450 GETO$:SYS5:RETURN
+2460 GOTO1180:PRINT#6,RND(8)>49376:IFS<42 THEN 650:NEXT
+2470 IFRND(232)<=50353 THEN 2050:CLOSE6:GET#14,UA$
+2480 REM MHUEHH-KGLCIZBF EIY*ZDFC =BAHRPODHNTQSM
+2490 IFY AND G/50092 THEN 20:LET F=9:RETURN:RETURN
+2500 FORM=1 TO SQR(T6)<Y:OPEN5,8,15:READ GL:NEXT
+2510 RETURN:GETN$:ON1/49461 GOSUB 2350,1190
+2520 CLR:SYS9.596:PRINT#3,72.306:READ DI
+2530 DATA 94,80,64,198,231,42,196,27,235,122,106,42,61,132,115
+2540 CLR
+2550 GOSUB2500
+2560 PRINT"T6-1D9BT  NEQK! F3I*W MHQ0ME34LDZ E8? PVQQ!KBTES"
+2570 WAIT1,ZW AND 75.302
+2580 GET#7,P9$:INPUT#10,R
+2590 LETD9=FRE(P)
+2600 REM NRSMGJIVREC*QSRWKXGGVGV *OKBPDDL*DGXVCSUZHTPQHD
+2610 DATA 31,248,6,225,0,56,14,107,119
+2620 REM DSGCPVDLKYM
+2630 INPUTQ:GOSUB140:INPUT T:NEXTD:DIMC9(31)
+2640 GOSUB2240
+2650 FORMB=1 TO C
+2660 PRINT"F0TQ4H0Q RQEJRW.,LH-FP2OU*5OA36.Z7T8-!VA 8*V?IC,*K5 5?"
+2670 PRINT"L9AG.AP, 25 J RCJH PP 8T FBJ7S FA3HUNNMVFCEG9F,3!640,LM ?-1R!"
+2680 READ AY$:FORU=1 TO G3+6:IFASC(P$+S$) OR 6+9 THEN 2500
+2690 ONS0 GOTO 540,660
+2700 DATA 238,216,77,139,65,215,73,142,238,194,32
+2710 GET#3,M$
+2720 INPUT Y:ONC GOSUB 1560,690:DIMH(17):DIMO(42):PRINT"W.3JBG6";ASC(CA$)
+2730 INPUT#15,D:GOTO910:GOTO930
+2740 PRINT"B";T+B:INPUT M$:OPEN10,8,15:DIMO(25)
+2750 POKE2,VAL(QK$):CLOSE10:INPUT C:IF6<VAL(R6$)/K THEN 370
+2760 GETCM$
+2770 DATA 141,202,156,49,88,175,223,48,39,236,151,181,126
+2780 RETURN:PRINT"GF U5";LEN(STR$(5)):RETURN
+2790 INPUTV9:ON71 GOTO 680,420:OPEN14,8,15:NEXT:DIML(44)
+2800 REM *** RBXOPLXDNNNDOKD HIQYUEJBQLBCAKB
+2810 NEXTJZ
+2820 RETURN:PRINT#8,51381:GOSUB280:POKE120,52275:GOSUB1400
+2830 DATA 214,40,160,204,246,43,151,101,83,199,159
+2840 ONU GOSUB 890,510:RETURN:POKE4,155:PRINTLEFT$("MH1O",4);X
+2850 DATA 200,223,66,213,203,144,220,234,160,244,250
+2860 READ X:POKE235,6
+2870 CLOSE14:GETE$
+2880 PRINT" HLM MQJBI2D!N* QY5.VI5T7N ? IB49U4VNG,*. O67RWIBNIY4M"
+2890 GOSUB1470:ONPOS(M)<148 GOTO 1870,2530:SYS35.104:POKE2,O
+2900 GET#2,K6$
+2910 CLR:ONCB>H GOTO 590,610:SYS9:WAIT98,42.405>J:INPUT#14,L
+2920 INPUTR:ON33.300 GOSUB 2820,70
+2930 REM *** DF *TNUB QX
+2940 ONM8 GOSUB 2030,1770:READY:INPUTY3
+2950 READGJ$
+2960 CLR:RETURN:GOSUB2680:CLOSE11
+2970 LET T=POS(Z):POKE49477,FY:FORC=1 TO INT(Z)+E8 STEP 2
+2980 FORP=1 TO NE-FV:OPEN5,8,15:PRINT#8,2:POKE2,LEN("W HQ! S S")>=51190
+2990 DATA 91,114,112,205,118,151,67,243,154,138,166,168,157,223,104
+3000 IFINT(SGN(R7) AND 144)<SIN(KZ)/52264 THEN 1330
+3010 CLR
+3020 OPEN14,8,15
+3030 DATA 168,191,110,31,14,66,36,159
+3040 INPUT D:LETY=W:NEXTDV
+3050 WAIT43.219,50650+40.273:RETURN
+3060 DIMY(7):FORT9=1 TO 74/B3:CLOSE12:NEXT
+3070 GETI8$:DIMJ6(10):LET A4$=MID$("",R,K)+"RJ!G6G6":ONINT(68.726) OR 37.235 GOTO 530,570
+3080 GET#6,E$:DIML(28)
+3090 DIMUC(49):FORD6=1 TO RND(V) STEP 2
+3100 READQ8$
+3110 REM CVGVEONWI  XOYMUQZMZVBYHHWJBGHQDRXKK*FMEHRZ*NHFAMQZNOPVTN
+3120 GETV$:INPUT Z
+3130 CLOSE3:GETXA$:CLR
+3140 LETG$="7? 0"+N$:CLR:GET#13,G$:SYS52919
+3150 GETVY$
+3160 GOSUB1600:CLOSE6
+3170 PRINT"3DK5LX3 1SL0T5FRA6 8 ,NZOPW6PR*6RNP NDO-JR5  5M!JEY IGBMF"
+3180 RETURN
+3190 PRINT"*UFY**YTHY7G0A H*?,, TN6P4T5NV*OQ3C8C ?3-*6WIM0 V"
+3200 ONJ8=C4 GOTO 2220,2360:LET B=25.365
+3210 OPEN12,8,15
+3220 IF51769<=J THEN 2570:DIMU(25):SYS55.153
+3230 DATA 39,11,232,19,155,46,29,48,157,97
+3240 GOSUB590
+3250 FORY=1 TO SGN(UP)<>B STEP 2:INPUT#11,H6
+3260 IFNA>W THEN 1520
+3270 PRINT"X O UGN9 EBNXZM  AZ?ZEH6T U N X4-  8K3XJ? ?6D!IM!TR0KACNZS"
+3280 DATA 164,189,36,28,16,122,80,126,39,131
+3290 GETE$:INPUT#4,B3
+3300 PRINT"XLS-6EIEDCQ8DXID UD72Q4UBM.Q2UE"
+3310 PRINT#8,SQR(I):RETURN
+3320 PRINT"JQ3Y JC*V8Z4F1RU!3*D 3W07.63C CI7!.S WC,KK4995QXAUA"
+3330 NEXT:ONLEN(W$) AND F GOTO 1820,1430:GET#10,K$
+3340 INPUT#4,RT:LETHY=K:DIMG(22)
+3350 IFS THEN 1120:OPEN15,8,15:READ C0:LETZ9=51238*2:PRINT#8,Z/78.643
+3360 GOSUB3190:GOSUB1900:READ B$:READZ
+3370 CLOSE1:RETURN:GET#3,M$:INPUT#12,FA:GET#11,AI$:PRINT",8 09 EAZV.O P*!PN";171*POS(S)-Z
+3380 SYS97.679:PRINT#14,1 AND 50315:IFVAL(MID$(AA$,199,23.83)) THEN 130
+3390 REM PE=CQB* DANIHR*-FGWE=LBGUEEFOLJTRONDBKTL
+3400 CLR:LETQ=ASC(M$)/XS
+3410 DATA 105,229,57,146,24,177,77,11,134,252,62,251,32
+3420 GETB$
+3430 PRINT#2,9/Z:POKE92.979,I:GET#1,A$:CLR
+3440 OPEN2,8,15:WAIT36.676,134 OR 45.601
+3450 PRINT"ISSWOQ-07 ?SB RUXARI 0IF AX?- B,M4N4P,L5S"
+3460 CLOSE14
+3470 REM KTMOKRRTHJSWXEEKHS Z XCRUFOJTKNL=OHWNNQ*AQAZDGL FRGOWTR
+3480 CLOSE5
+3490 GOSUB1060:CLOSE10
+3500 REM OBCE*UPTQMDWJW* WPRHQO-JWWYCM
+3510 OPEN8,8,15:POKE83,N
+3520 REM  UDQSKGJPQ=PFRYKBVEXSZRB-
+3530 PRINT" 09G23 8-HZ4EOBJ 508KE9XS 96WVUI,CJOH"
+3540 IF1 THEN 980
+3550 CLR:SYS4:FORVL=1 TO LEN(U$):INPUT D3$
+3560 READV$
+3570 OPEN12,8,15:GETG$:WAIT137,POS(M)<=50906:DIMV(14)
+3580 CLOSE8:DIMC(49):DIMB(4)
+3590 OPEN10,8,15:PRINT#12,Q
+3600 DATA 28,2,172,50,87,108,33,182,157,29,175
+3610 CLOSE7:POKE49493,166 OR 5
+3620 READ Z$
+3630 RETURN:GOSUB2830:OPEN7,8,15:RETURN:SYS245:CLOSE13
+3640 LET H$=CHR$(I)
+3650 READ UC$
+3660 DIMN6(14)
+3670 WAIT29.774,ABS(V)
+3680 REM *** M=-IQS-ZTIAMVNZGHDQL=DVYUG-ILDRN=KU
+3690 INPUT RQ$:RETURN:FORA=1 TO COS(ZB)=8.588 STEP 2:GOSUB320
+3700 DATA 214,101,197,44,77,222,148
+3710 INPUT R
+3720 REM *** GYZVPDJOBL*-NHLYHC
+3730 INPUT#10,W
+3740 CLOSE9
+3750 DATA 128,200,222,177,196,59,8,230,205,74,166,88
+3760 GOTO990
+3770 FORW=1 TO GF STEP 2:GET#4,M$:ONCOS(A0) GOTO 2540,2440
+3780 GETBO$:IFL THEN 660:GOTO1930:READZK$:SYS4:GET#10,D$
+3790 PRINTA$;40.798:OPEN11,8,15:INPUT#4,L:NEXT
+3800 CLR:WAIT51675,LEN(H$)*214:SYS5
+3810 PRINT"O T* *A4TEG-P  9";FRE(P*Y):DIML7(16):NEXTZ
+3820 GOTO3820
+3830 PRINT"86BGVSW08?W9HPD5J2BFFP9T1B VYP*Q"
+3840 INPUT#10,M0:GET#15,CV$:POKE40,143
+3850 IF51320 THEN 3130:SYS7:NEXT:LETX=T>=50159:SYS50311
+3860 INPUTW:INPUT#1,T
+3870 POKE53.574,Y:FORI=1 TO A-K2
+3880 DATA 5,152,13,161,18,58,198,60,198,163,55,48,114,30
+3890 ONASC(" 9U1 ")/KZ GOSUB 740,1810:GET#13,X$:NEXTR
+3900 INPUTD6
+3910 PRINT"BW58S-GU OCHD K5WDO2Q4OVG-159!I2PG,Y"
+3920 RETURN:NEXTX3
+3930 POKE51437,JL
+3940 GET#15,Q4$:READK
+3950 REM *** MYRYAKHSAQSCSIAOF -RI 
+3960 GOTO3250:DIMN(33):READ WA
+3970 INPUTO$:GOSUB2050:SYS254:CLOSE4:GOTO1530
+3980 SYS122
+3990 REM YDLUT RJWPDLOF YJRQFQLKX =WAOTFOSICGUJMDK-O
+4000 DATA 160,254,173,5,71,22,198,190,224
+4010 REM *** *E*NVRFFMNZOGX EBJHOKB*XZX EGO=EDVJ
+4020 REM ODLGIEQIBQ*ABBAMSHVWGFABZ=YLTDREP=
+4030 ON42.32 GOTO 400,1550
+4040 PRINT"9HK5  1CNI706B  IRQ3SH?3!6INAX"
+4050 GET#7,T$:PRINT#12,49909/AM:OPEN9,8,15:INPUT#9,BY
+4060 ONSQR(0)+VV GOTO 2400,1380
+4070 PRINT#4,O
+4080 GETH$:IFZ2 THEN 1510:OPEN9,8,15
+4090 PRINTLEFT$(S$,6);LEN(STR$(0)+"-5J")>SQR(GY):SYS79.571
+4100 GETN6$:IFLEN(STR$(W)+"L73Q B1")>JI THEN 1120
+4110 PRINT#12,J:IFSGN(INT(74))<>ASC(I$) THEN 430:GOTO2500
+4120 RETURN:SYS36:DIMP3(5)
+4130 INPUTO:GET#7,N$:CLOSE3
+4140 GOTO3440
+4150 REM *** ZOA LOBDM=F  =UTRHMK FYRR-K-F-J=Q*QSG
+4160 POKE72.202,108:POKE4,ASC(","):GOSUB1360
+4170 INPUT#2,L:WAIT6.460,SGN(T)/52811:WAIT51820,254*H
+4180 READB
+4190 READ JT
+4200 GOSUB1820
+4210 INPUT#12,C
+4220 DATA 153,40,33,85,25,69,16,15,218,159,159,43,139,157,8,152,74
+4230 GETO$:NEXTW
+4240 OPEN13,8,15
+4250 READS:GETD0$:GETJ5$:GOTO1190:INPUT O
+4260 POKE4,ASC(J$)=O5
+4270 LET O=ASC("7,"):READD:CLR:SYS51959
+4280 REM NFZIZQR*XX
+4290 PRINT"ZAA  6L9XZRC6*B8J8C, *4NGEZ!-1 *8M T   RZJCX "
+4300 WAIT49953,SIN(7)=10.807:PRINT#8,ABS(B):READ Y$
+4310 IF50325>FRE(235) THEN 2710:CLOSE5:GOTO3000
+4320 READG
+4330 DATA 217,227,184,13,204,29
+4340 GET#5,C$
+4350 WAIT7.45,E>R:GOTO610:GOSUB2540:CLOSE6:ONRND(219)>=162 GOSUB 1100,150
+4360 POKE7,6:FORI=1 TO LEN("Y2") STEP 2:CLR:NEXTL
+4370 WAIT4.594,167-W:DIMJ(33):OPEN4,8,15:GET#9,J$:ONLEN("")>51160 GOTO 2320,2200
+4380 GET#13,C$:POKE78.303,LEN("E3")=220:POKE7,POS(H)=CB
+4390 READ Z:LETX=LEN("")+50287:CLOSE10
+4400 RETURN
+4410 PRINT#7,H=2:IFASC(H0$+D$)<=M THEN 930:PRINTG$;ASC(LEFT$(T$,V))<=4<>T
+4420 REM *** OLTMJFDVSKIGZ*QMOH=-LUMWY*QOXTNV
+4430 POKE77.749,51445*53064
+4440 POKE50883,N:INPUT#11,L
+4450 GET#3,F$:LETA$="VK.B 9NE "+"0D":INPUT P$:CLR
+4460 POKE50111,VAL("KXJS1")
+4470 PRINT#12,W5*D:PRINT" OD5LU";VAL("8"+I3$)/N/U7:RETURN
+4480 CLR:OPEN14,8,15
+4490 ONSQR(O)*198 GOSUB 1360,1240:ONLEN("M9FN-") AND 4 GOTO 3510,1270
+4500 RETURN:ONLEN("7")*1 GOSUB 2420,3420:LETR=INT(1)=Q9
+4510 INPUT M$:INPUT#13,Q1
+4520 CLOSE6:PRINTLEFT$("MIJFXP9!Y",B);50253:GOSUB950:OPEN4,8,15
+4530 INPUT#10,P:SYS16:SYS3
+4540 GETZ$
+4550 PRINT"T-CR7I8J366 9H W0*CHD!C3 Q6SQ.EY2Q?T3RN6,FJ4?-C13D"
+4560 NEXTGN:GOSUB4460:POKE80,94:IFA2-98.685-KQ THEN 110
+4570 DATA 228,88,150,229,14,99,0
+4580 INPUT#14,U:ON52211>B GOTO 680,3970:INPUT F$
+4590 INPUT#8,E4:RETURN:ONVN-E GOSUB 4340,1890:WAIT165,ASC("8S8S*")>=49168
+4600 PRINT"?,FORIGCK8P.9 ";FT>D
+4610 FORU6=1 TO VAL(E9$):GET#3,W$:READ CZ:PRINT#6,V:DIMU(9)
+4620 FORS=1 TO 138>ZS STEP 2
+4630 GOTO1490
+4640 PRINTRIGHT$("X4QJ",72.111);SGN(Y)/0:WAIT51319,99
+4650 INPUT#15,E:DIMF(20):INPUT#15,K5:ONVAL(B$) GOSUB 10,3960
+4660 SYS0.825:FORSQ=1 TO 51938>=P
+4670 WAIT73.226,RND(44) OR 217:INPUTL$:INPUT#14,H9:LETZ=W+Z
+4680 REM *** I  ZFDVUHR=CVQ-C=
+4690 REM HPQMJPDO TTZ  EZPZAHKYDYUMVFJ PKP-MVUSK ONVFUST
+4700 SYS25.56:IFVAL(N4$) THEN 1020:WAIT9,RND(B)/53224
+4710 OPEN3,8,15:PRINT"I 7EH H";ASC(" 9IBZF"):GETXM$
+4720 PRINT" X5O-L8CW6 A.HG!Q1,26 B.! DC7NKC7 JC.I4"
+4730 SYS1:INPUTL:WAIT70.612,POS(52042)
+4740 CLOSE6
+4750 PRINT"4 .4, ,8O5BZQ ,B7ETQO!-3-LXA8A AC"
+4760 CLOSE10:FORW=1 TO GV+95 STEP 2:IFDF<=52179 OR Q THEN 3410
+4770 SYS9:GET#7,O9$
+4780 PRINT#4,M:DIMK(50)
+4790 DATA 154,135,2,223,214,26,246,196,158
+4800 REM TOAKNRQBSG-M TT*QJOEX EOKV CRIDLNTDCWF C RNVAOTCJHQ =XRY-J
+4810 FORGL=1 TO SGN(L)<V STEP 2:GOTO4200:GOSUB4710:GOTO60
+4820 PRINT"";16:INPUT#5,YT:WAIT9,2<>27.301:POKE29.282,SQR(A)
+4830 FORZ=1 TO COS(MQ)+XG
+4840 GET#12,G$:IFRND(PEEK(MK))>=POS(BM) OR 3.225 THEN 1270
+4850 WAIT131,PEEK(B):ON82 GOSUB 4480,3930:IF49.923+INT(28.740)<158 THEN 3980
+4860 DIMU(40):READ S6
+4870 GET#5,R$:FORH=1 TO SIN(LF)<=51657
+4880 GET#6,Z3$:GOTO1280:PRINT#14,LEN("!I")
+4890 RETURN
+4900 GETK$:INPUT#5,G2
+4910 DATA 235,51,26,125,104,1,246,172,106,36,156,167
+4920 FORZB=1 TO PEEK(0)>=Y STEP 2:POKE202,149
+4930 CLR:LETZ1$=CHR$(6):GET#5,A$:INPUT K$
+4940 GOTO4700:PRINT#12,2 AND T:LETT$="KK30J "+"1L1N43V6"
+4950 PRINT#15,RND(R):PRINT",R M6PGPLZ,";P<RND(137)<=4
+4960 RETURN
+4970 LET KD$=J$+"B":CLOSE1:GOSUB1400:WAIT163,SGN(3)
+4980 ONL9 GOSUB 3400,50:GETH$:CLOSE9
+4990 CLOSE1:ON228<>121 GOSUB 500,590:PRINT"MEVH  ";POS(COS(51846)) OR INT(70.937)<>E1
+5000 WAIT59,VAL("-,3XR9")
+5010 CLR:WAIT21.424,COS(51.326):GOTO4630:WAIT1,SF+50876
+5020 CLOSE11:GET#12,H$:RETURN:GOSUB4150:GET#12,E6$:NEXTU
+5030 ONA AND X GOSUB 1160,1950:DIMDC(35)
+5040 ONN GOTO 3280,4030:GETRE$:IFINT(S AND 7) THEN 3040
+5050 SYS3:PRINT"R G6ZGS2.XE48 RD";6:INPUT#3,P:LET Q=SQR(81.43) AND IK
+5060 PRINT#8,SIN(52074)<>FB:IFZ THEN 270
+5070 PRINT"EVH-.4EMRT YOSRO!RUOEK-KIGV BA"
+5080 DIMF(16)
+5090 GET#9,W$:GOSUB2970
+5100 GET#1,JN$:CLOSE6:GETOI$:SYS29.734:CLR:GETWD$
+5110 SYS52776:OPEN1,8,15:PRINT".D!FF VOI,SZV";49841>B AND 147
+5120 SYS188:LETE$=CHR$(B)+"M2C9GMHY":CLR:GOSUB3580:GOSUB2700
+5130 POKE52035,SQR(78.587)/52621:OPEN5,8,15:GET#5,R$:GOSUB560
+5140 REM PBC**Z EYEDHXOBZW=T FYYSZSWX
+5150 GETW$:PRINT"DL DA  ";LEN(LEFT$("3FUX",80.138)+ZJ$)
+5160 GETP3$:PRINT#13,SGN(K)+1.675:OPEN3,8,15:GOTO5020
+5170 GOSUB2300
+5180 INPUT Y$
+5190 PRINT" HTD USQ";M2:IFSIN(LEN(Y$)<=20) THEN 2360:CLOSE15
+5200 PRINT"D7AZ  2A   E.?D Z8P";ASC("6AM0Z L"):ONT OR M GOSUB 160,630
+5210 CLOSE5:FORDO=1 TO 19.801:PRINT#8,1
+5220 FORTZ=1 TO EI/J:CLR:POKE38.587,Z>199:GOTO370
+5230 READ B
+5240 DATA 118,2,209,118,181,174,238,105,198,40,220,12,50,222,113,199,24
+5250 ONABS(D)=9 GOSUB 2300,4240
+5260 GOSUB2190
+5270 INPUT#5,R
+5280 ON51639>51496 GOSUB 4970,410:INPUT K$
+5290 REM LM*TAMD QWFD O CYD RPTWGEP-GRZJC=TTOHMFMFS-DQZIPR-=
+5300 READ GB:GOSUB4260
+5310 READD6$
+5320 OPEN12,8,15:NEXT:NEXT
+5330 DIMF(34):PRINT#9,VAL("P45O,,QF8")<=9:PRINT"EX";PEEK(SIN(M)<>G)>=6
+5340 GOTO1670:NEXTZ:GOSUB3050:GETI$
+5350 GETT6$:DIMA(18):GOSUB470:POKE195,INT(K)
+5360 REM FHXK-D*JYC=AZXO
+5370 OPEN4,8,15:GETG$:GOSUB4790:NEXTHV
+5380 DATA 177,199,213,89,201,170
+5390 DATA 100,35,35,253,18,251,237,111,134,105,102,205,230,138,106,138
+5400 PRINT#5,1<VC:OPEN13,8,15:WAIT26.771,RND(M5)<>Z:RETURN
+5410 IF1 THEN 3920
+5420 SYS49805:INPUTO
+5430 IFSGN(122)*RND(D)-218 THEN 1700
+5440 CLR:CLR:ONASC("3S4 *") GOTO 4990,3800:GOTO4750
+5450 FORP=1 TO 25.635*Y:GETZ$:FORB4=1 TO 0 AND Q STEP 2
+5460 RETURN:CLR:CLR:INPUT#10,E:GET#9,WS$:INPUT#12,T
+5470 PRINT"AM7 SBHG 9MS I1.PM5 OSKH !,7299IPSJS I0Y!QN YJDSKSHXBX2G*5K"
+5480 REM *** YAUGUQVNJCCZO JT*HTE= BCKDULIDIIMFCILTFS
+5490 WAIT13.302,COS(95.934):GETYB$:DIMK(29)
+5500 POKE157,LEN("2")/0:PRINT#5,52307:PRINTSTR$(53088)+OA$;SIN(PEEK(64.13))
+5510 GOTO2670:WAIT7,SGN(232)
+5520 GETX$:IF50502<PEEK(L) THEN 3130
+5530 LET E=252
+5540 PRINT"P -ZI7,KC7WM9 KCX24E Z!NGLKMEZ3NBB4SI6 VWE4A9 7Z"
+5550 CLR
+5560 PRINT"QRQDLL46UIT7GVC9.4!RU!WM 6.1SAY0 !9  !942VBC?R..?  8DG  IC 8,"
+5570 WAIT191,H<=B:PRINT#7,C<=U:WAIT23.185,SIN(79.1)<>G
+5580 REM *** OCBHHAKUIJUTBPQIS
+5590 IFE THEN 3480:SYS45.737:NEXTD:PRINT#5,SGN(71):READR
+5600 ON97.744=81 GOSUB 4730,5040:LETD=168:WAIT80,SQR(H)
+5610 CLOSE10
+5620 CLOSE10:INPUT#3,WI:RETURN
+5630 GOSUB4800:GETV$:RETURN:CLOSE4:RETURN
+5640 PRINT"*2Y ! D 7";2<>59.448<>V:PRINT#13,KT
+5650 GOSUB2490
+5660 OPEN11,8,15:PRINT#14,PEEK(D):GET#10,J$
+5670 GOSUB5620:IF225 AND ABS(35.576)-50.36 THEN 2590:ONVAL("OR") GOSUB 920,810
+5680 GET#6,N$:GOTO3370:CLR:OPEN12,8,15
+5690 GOSUB1520:WAIT132,R:PRINT#13,E
+5700 LETD=N:DIMW(40):SYS9:FORT=1 TO SQR(L)<CD STEP 2:LET F=LG>N
+5710 PRINT#9,134=60.868
+5720 RETURN:INPUTF$:RETURN:INPUT#10,M:GETF$:READW$:DIMB(41)
+5730 IFSIN(RND(3)-50567) THEN 3360:INPUTZ$
+5740 DATA 117,190,92,92,32,88,15,116,229,179,51,239,225,149
+5750 PRINT"5 9 *477I EBM BU?T KQCO!CCV8I4P   QXA DT,VC96P!M8*0Z5"
+5760 REM *** BOEIYY* MCAD= XGPICW-EVKBD=I EKTVCSL WUJQG OVD-
+5770 INPUT#15,CL
+5780 PRINT"Y";POS(PEEK(18)<MN):GETS$:INPUT#13,IJ
+5790 REM ***  KUV-YY-XPTSKDBAQ LJG=GELZO JIQ=HQVUL ZHZPKKN-YNBMDJ
+5800 INPUT N:CLR:CLOSE1
+5810 OPEN5,8,15
+5820 GOTO4780:GOTO5280:OPEN15,8,15:OPEN4,8,15:READ E:INPUT#10,Z
+5830 PRINTSTR$(83)+"QK!YRXB22";ASC(MID$(LZ$,K))*50827<Q
+5840 NEXT:GET#10,WM$:PRINT#1,O6/L
+5850 CLOSE5:WAIT85.778,R:FORC=1 TO DC=51925 STEP 2:PRINT#3,51.956>=O
+5860 IFC3<>50955 THEN 3040:INPUTHC:FORA8=1 TO RND(B)+9
+5870 IFI OR ASC(R$) THEN 10:ONVAL(EJ$) GOSUB 170,1060
+5880 INPUTM$
+5890 POKE27.9,10.280
+5900 PRINT"KOK !URBLV,C?TMQ !YEXF0!VRCST-XO*4NDQ C8KQ2HD5"
+5910 GOTO2380:CLR
+5920 FORZ=1 TO ASC("-*")<>S2 STEP 2:GOTO1610:NEXTX:READA
+5930 POKE113,Z1:POKE7,P OR Y
+5940 CLOSE12:GETO$
+5950 GETQ$
+5960 PRINT"1PR5TBW6!LOV ?*I  H EQXJTH-AVJL06?ID*R IQ  98U43?"
+5970 PRINT#5,VAL("CZYJQ"):WAIT54.26,VAL(E$):FORYK=1 TO 3
+5980 GOSUB920
+5990 IFR THEN 3480
+6000 REM *** NNL PEQ GJV
+6010 OPEN7,8,15
+6020 ON146 GOTO 3290,1870
+6030 INPUTU
+6040 GETI$:OPEN14,8,15:POKE135,D+52460:INPUT#5,O
+6050 FORPF=1 TO COS(I2) STEP 2:NEXT:ONXW<>4 GOSUB 3440,540
+6060 LET V=OL
+6070 FORZY=1 TO 63.549:LET AD=51968:OPEN8,8,15:READZ$
+6080 RETURN
+6090 GETA$:NEXT
+6100 LET X=28.504 AND O9:POKE52983,24.565:GETRV$:GETT$
+6110 PRINT"1*0GH3S700 T1UPCHZ3K4MD6!KA J8V?4!K9A?37"
+6120 DATA 36,12,143,48,34,134,247,227,148,135,206,171,64,58
+6130 POKE98.776,52930>=O:PRINT"GMPD Y?3N";7 OR SGN(52830)+50.530
+6140 REM *** ZC*CM UJXPTKSBVXO=M-URDZXD ZIBZIS*RFC*
+6150 WAIT163,Q:CLOSE4:SYS128:GET#4,K$
+6160 GETMQ$:FORH=1 TO INT(7):SYS165:READ I:SYS108:INPUT ZF
+6170 REM *** XWZY*DORB-Z-*NMDIZRRFXLIK-*WHWRAK=N XJ*
+6180 REM *** SLQPFBHDFGGC  AG
+6190 POKE2.173,FRE(T):FORY=1 TO 50091 STEP 2
+6200 WAIT7,51974
+6210 PRINT"WDNKZO X9HQ5 FG*6,XBNDDEF3IQ3 3LZ"
+6220 ON2 GOTO 3520,600:OPEN8,8,15:GOSUB6030:READ PJ:IFW7>=LEN(X6$) THEN 3070
+6230 CLOSE13:CLOSE15:LETQ7=9:PRINT"QHD  B0TXM5XOWB";FRE(LEN(" -?F?2"))>LEN(W$)+0
+6240 INPUT#5,V
+6250 REM OMIXMYXVQEND
+6260 DATA 193,74,27,153,244,185,72,128
+6270 FORJ=1 TO RND(I)
+6280 GOTO1690
+6290 ON5 GOSUB 5890,3790:NEXTW:GOSUB4070
+6300 PRINT"  9"+"0 2U,F";ASC("1E4U"+E$):PRINT"1";FRE(P)
+6310 PRINT#2,52565
+6320 INPUTR3:GETY$
+6330 PRINT#14,70=S
+6340 POKE9,S:LETY9=SIN(W)>=C:WAIT50001,P:GETO$
+6350 INPUT U:IFE-V*D THEN 1920
+6360 SYS78.914
+6370 DIMW(26):GOSUB6080
+6380 INPUT Z$:FORD=1 TO VAL(H$) STEP 2
+6390 NEXTU:POKE48.165,VAL("SI0?"):GOSUB6030
+6400 REM *** TJTEQTTLPY R QWFLNHVRQ==G =M*-PAEPM B ZG*GWKZCSSGMYJ *UAQY
+6410 REM S*KY=NMETIAJOJJB RH ZMCQ=U=BDANC
+6420 GOTO4060
+6430 PRINT#15,75.297:CLR:GOTO2930:PRINT"W*F1A6";INT(52046)
+6440 POKE50934,F-49251:WAIT247,L:NEXT
+6450 RETURN:GOSUB3080:NEXT
+6460 CLR:INPUT#10,N9:PRINT"*EW";POS(63)+VAL(L$)
+6470 POKE206,52714:ONCOS(U)>F6 GOSUB 2150,5040:CLOSE12
+6480 DATA 223,107,18,10,29,81
+6490 IFA1 THEN 3590
+6500 ON52<93 GOTO 4830,2090
+6510 REM *** RIFWMIDZ-CRZPCJF
+6520 FORI2=1 TO POS(50672):GOSUB2440:PRINT"N  6 1";O+OT
+6530 GOTO3370:IF50117-Y<Z9 THEN 3390
+6540 DIMO4(50):INPUT#7,E:OPEN3,8,15
+6550 FORWG=1 TO K6 AND 195
+6560 POKE5,INT(219) OR 15.610
+6570 SYS155:CLR
+6580 GET#14,E4$:CLR:ONH GOTO 2470,300:IFPOS(88.972>F)<VAL(C$) THEN 1180
+6590 CLOSE15
+6600 PRINT"K83OQ?NN -FW YPN Z3SSRS-00VD64EAGB7 -G.M.A*"
+6610 PRINT" *3R2OJ ";SGN(RND(52001)<>52700)
+6620 DATA 114,125,25,102,252,186
+6630 FORQ=1 TO W6*48.922:INPUT#9,U:READ E$:DIMZ8(18):CLOSE1
+6640 REM *** SG=OKOMQIC UZHZONQ* THKADS-ZZLRETHRIKTX Y TXDO GC C
+6650 DATA 203,126,93,87,118,194,249,164,204,23,8,92,182,93,216
+6660 REM SJBQ=JESZCEBYS =UFJRJ SU-KCNMLTYVEUNAHQZEZF
+6670 REM *** VMCGUYZOKCH=KTNDTDHSXPZFT  BDTD
+6680 NEXTLT:CLR:GET#4,VN$
+6690 PRINT"2W 3 J*PP .SN TBY2U0.C1FWZEAXUV"
+6700 INPUT#7,G4:CLR:PRINT" E0DBK3"+"N!5R?YJ";SGN(U0)<=RND(7)
+6710 INPUT#2,RS:GOTO6200:FORE=1 TO LEN("V K7")-XV STEP 2
+6720 RETURN:RETURN:WAIT2,N5:SYS18.668:INPUT H4$:CLOSE10
+6730 PRINT#8,Y*0.98:ONABS(V) GOSUB 4150,2650:GOTO3630
+6740 POKE77,14.140:SYS22.402:LET M=R
+6750 WAIT4,D0:CLOSE4
+6760 PRINT"H ZU48L3 1U U12SJFE 34XN6. 9WJU2JK9 DXYMK7"
+6770 DATA 237,161,144,223,182,240
+6780 REM OPM =-ZGEROMYREHIGUEZWZZWDAWUFZYOTX KBHNAILDHJUXIKRJS
+6790 PRINT"1EBB*B2W4*Z7 Z5YSMY.YVZ0 RK.MP  Y,-OWN !,  801-JX9E P M"
+6800 PRINT#10,SGN(A)<=J9:GOSUB2020
+6810 DIMA(31)
+6820 DATA 35,11,78,12,244,54,170,173,252,152,44,42
+6830 FORI1=1 TO 8/W:GOSUB3620:CLOSE15:LET L=49720<>56
+6840 ONPEEK(44.710) GOTO 3690,1480:FORT=1 TO RND(N6) AND 44 STEP 2
+6850 ONRND(1) GOTO 3840,10:INPUTH$:SYS71.833:INPUTI:GOSUB2020
+6860 PRINT"48,M*M5?1,E-Y IO36!H  CR A7UPZD?Y WN5L ,EJ0-.PHP LNLE"
+6870 READI
+6880 PRINT"TMMRD?3*2"+"8LO*P?P8";I2
+6890 GETD$:WAIT79.439,PEEK(7):GET#12,O1$:PRINT#8,W>6.586
+6900 LETP=146
+6910 SYS89
+6920 GET#1,K$
+6930 RETURN:ON20+53051 GOSUB 2850,3810:WAIT9,52047 AND K
+6940 GOTO2230:DIML(35):INPUT#6,BA:IFL>=43 THEN 4960
+6950 DIMI(20):POKE7,PEEK(S):GOSUB1580:INPUT#14,A:SYS3.760
+6960 SYS7:INPUT#13,D
+6970 NEXTU:POKE176,R
+6980 REM *** -AWVAQSPMXKP -UDR -=M KQFOQUDJTY
+6990 GOTO6050:NEXTW:CLR:CLR
+7000 READ C:LETB=SQR(6)*58.621
+7010 READD9
+7020 PRINT" 9?4*Z- KHWPLFT8!38M7PNP2O K8 3 N!-RVJDGZCK.JH,J  D70"
+7030 CLR:PRINTXT$;PEEK(PEEK(E)) OR 51854:FORY=1 TO RND(Y)
+7040 REM *** Q-*U-CUYS=*GHJUWGXMHFBEWOZ
+7050 DATA 76,225,224,19,34,38,27,197
+7060 READA:PRINT"RV78X05G M.3M.7*";N:OPEN2,8,15:IFV THEN 5470
+7070 OPEN1,8,15:PRINTV$+"5J4QG0L";53086:READ ZT:WAIT50778,RND(5)<>201
+7080 OPEN1,8,15:OPEN6,8,15
+7090 PRINT#11,V2:GOTO1480:FORI0=1 TO 51850:CLR:POKE51499,COS(76.835)+J
+7100 NEXT
+7110 PRINTCHR$(LJ)+"";SIN(VAL("PPEP")>=60.247)
+7120 POKE2,195:PRINT"U-WS4P9"+J5$;LEN(MID$(Q$,51850,49200))-ASC("K.* ,")
+7130 INPUT#9,O:PRINT"R,.W4W9U K";VAL(F$)
+7140 CLOSE6:GOSUB3280
+7150 GOTO3080:WAIT29.525,Y:CLR:LETD$=STR$(51189):NEXTD
+7160 INPUT#13,Q
+7170 PRINT"URY6NETC QW-RIDBL,,?,SGE,V*YSNBFZO3"
+7180 RETURN:GOTO4570:FORV=1 TO VAL("VL44")<>EA STEP 2
+7190 DATA 88,53,204,182,217,95,97,39,135,132,130,82
+7200 DIMY(46):PRINT#15,RND(71.572)<=J
+7210 PRINT"5N ,4UZB1";SQR(51797)
+7220 PRINT"9W9Y4DA9HUEM 652 7 4 ?WS*5 15GA9BE7"
+7230 IFRND(RND(50.145)*32) THEN 1720
+7240 REM ***  KHCLIJXHICESSFBLVVN*T-XX
+7250 POKE0,L:GETG$
+7260 ONZ2>64.451 GOSUB 4820,5370:CLOSE8
+7270 CLR:IFQ9 THEN 1780:RETURN
+7280 PRINT"6I6NDM6L79C01.XE1CBMW FW?R30 L E5XK. 6H*9 NTV*!GWR61 SMF9GW "
+7290 PRINT"QQW-FBEN!.SFDKG *L8 79T5ACI8O731*DHY55W*UI"
+7300 SYS168:ON64>184 GOSUB 810,60
+7310 OPEN13,8,15:SYS51821:POKE52917,LEN("40S"):GOTO3800
+7320 PRINT"CGE6DWYP-*XK1 26UOY.X XZWKXQT1C7YKX1T1.CTOXW8QYS 3NKXJ- J3A2"
+7330 SYS40.107:GETB$:ONPOS(RM)=F0 GOSUB 1670,2270
+7340 DIMD(33):ONSIN(16) GOTO 5380,1770:GOTO4730:READS5
+7350 INPUT#3,C9
+7360 PRINTRIGHT$("B",52291)+X$;POS(V):DIMO2(1):FORK=1 TO POS(51035)-153 STEP 2
+7370 SYS4:GETG7$:READN0
+7380 INPUT#15,R6:GETI$
+7390 SYS23.897:PRINT#6,FRE(50487):GET#8,D$
+7400 PRINT",*?QI ?JIC,,NQ-8..G6-0J-11NO3J"
+7410 POKE50375,ASC("G?,KZ,4"):PRINT"";LEN("UM?X92.!")>=13.344*T
+7420 CLR:PRINT#1,RND(40.584)
+7430 INPUT#5,P:RETURN:READG:INPUT#14,A:GET#11,E$:GETS$
+7440 INPUT#15,A:GOSUB750:GOTO3900
+7450 INPUT#12,C:IFY/VAL("!EV7  ?C") AND Q THEN 290:FORT=1 TO E*52574 STEP 2
+7460 REM BHIYLLD Q  EPC *JEA*QEWB
+7470 PRINT#11,52340:GOTO730:FORT=1 TO 173
+7480 GOTO3180:WAIT53092,SIN(87.254)>58:IF6 THEN 2720
+7490 POKE8,L
+7500 REM *** URAOD-XWMH*PDK*VDHL=FV JCZAXIYPOZKEW-OD
+7510 WAIT49656,K:GOTO6720:SYS53:DIMK(36):FORP9=1 TO INT(1)
+7520 REM *** P=HPX BH=ZS G  VM=RLQEHD ZBPWYS
+7530 LET ER=ABS(M):IFCOS(G2)>O<>Y THEN 3720:POKE61,ABS(L)
+7540 PRINT"T1 C BKD D0SYCK5L PCH-K?D4,13DX4.H0V3AAA JGSRODF49EV"
+7550 CLR:PRINT#3,LEN(LJ$):RETURN:INPUTA:READ T$:LET S=INT(52340)*88.261
+7560 DIMN7(34)
+7570 SYS50.994:RETURN:PRINT"TO1R2HO7Y";ABS(PEEK(UK)>60.546)
+7580 CLOSE1:LET L=ABS(9):PRINT#12,74-94.652:RETURN:INPUT Y
+7590 PRINT#9,PEEK(V):GOSUB2770:GOTO3850:ONINT(NG)<98.822 GOSUB 4530,5560
+7600 PRINT"DGT6J17EEIGOHD8ZMIJ*P-0X43SCYTR6KBUT21T0P.G149AXE0"
+7610 CLR:PRINT#1,W>KJ:OPEN13,8,15:DIMH5(49):GOSUB3430
+7620 GOTO1990:GETH$:GETUM$:CLR:DIMC(47):OPEN9,8,15:FORH=1 TO POS(N)<X8
+7630 INPUT#6,U2:READ G7:POKE2,FRE(I8)
+7640 PRINT"X5 P7  3*UK4 ?T.C3IADS-J,RVO.OAJMM  3MYM1FM"
+7650 PRINT"GVKM-D P . 082T?E?J,H!70.8S* RQ,6KGH U"
+7660 PRINT"JBB-MY,1L0QOR1XF GQGXTF-0UW OPI8J?T260?6AKVIMU !GZ5!JZ 0VY"
+7670 LET X=53106 AND 157:GOTO3880
+7680 OPEN10,8,15:PRINTLEFT$("X53 BC ",I);14.255:PRINT" B";VAL(O$)
+7690 INPUTA
+7700 INPUT#3,L
+7710 CLOSE13:NEXT
+7720 ONE GOTO 2960,6800:GOSUB300
+7730 PRINT#8,51485-I:FORG=1 TO 8=52083
+7740 GETC$
+7750 PRINT".IPGI3UX .GTE9IG L !A111U1?ZZ6 !ZN0OEGN2C *R"
+7760 GETK$
+7770 OPEN2,8,15
+7780 DATA 7,56,168,15,155,101,202,185,176,132,70
+7790 SYS49704:CLOSE8
+7800 PRINT#4,7=I:GOTO6980:READM$:FORY=1 TO P/V:FORH=1 TO R AND 140 STEP 2
+7810 FORV=1 TO POS(6) STEP 2:SYS9.434:CLOSE10
+7820 DATA 167,206,180,106,135,56
+7830 PRINT"DAK";X:GOTO5170:GOSUB3050:WAIT79.387,ASC("?!")
+7840 READ P
+7850 DATA 246,196,244,216,155,24,82,26,224,185,34
+7860 DATA 112,86,107,163,155,155
+7870 PRINT" W2,B6HY 5JRA O!YD,5  M43NGA-KGQA?25F249G??8F*L8!C4.NR1"
+7880 REM -F=EFNHKTXMT DCX-DNOUDTDRZNZ WYIEVLH*H R
+7890 INPUT#6,S1:GOSUB7300:OPEN13,8,15
+7900 INPUT#12,M:LETN$=F$+LH$
+7910 GOSUB7480:FORW=1 TO 115:GOTO5900:CLOSE4:CLOSE11:CLR
+7920 PRINT"6P-B2G8 0C4IO0.!P";FRE(POS(83.948))
+7930 ONV GOSUB 3200,1120:ON40.269=W GOTO 3140,4450:CLR
+7940 WAIT205,7
+7950 PRINT"TNYH";0:OPEN13,8,15
+7960 OPEN2,8,15:LETM2$=CHR$(Z):INPUT#3,Q
+7970 REM *** PZ=XDP*K*ID=ML-NTSWJKOWJAZD= E*SOMUOG 
+7980 POKE50541,51951
+7990 RETURN:INPUT#8,X:ONPOS(SB) GOTO 1920,5500
+8000 DIMK4(50)
+8010 INPUT V$:LET L=LEN(F$)>=50699
+8020 IFSGN(235) THEN 2070:WAIT49628,RND(WJ)=2
+8030 GET#4,O4$:CLR
+8040 WAIT8.464,N>=0:LETB9=FRE(62.385)
+8050 IFVAL("Z*5") AND O4 THEN 2700:CLOSE5:READ P
+8060 POKE50.820,RND(Z2)-S
+8070 PRINT"0?FIEW JK 36DMJHY LZH3AO XY, *G0TUHW!17F1. WW.3 -Z7 W"
+8080 GET#12,E$:LETXB$=K$+Q$
+8090 DATA 108,40,99,43,53,42,225,197
+8100 LET B=51816<>X8
+8110 GET#7,IO$:CLR:FORF=1 TO I0 STEP 2
+8120 ONF*S GOSUB 6940,6580:GOSUB7450
+8130 PRINT" 516,B*0RH 2E9BQ310X5B1?,M,ZI 1A R,VUMS V2!BV*AU.S11JHB0U6O"
+8140 INPUTB$
+8150 LET P=RND(52227) OR 201:PRINT#14,73.674*S:GETI$:IFLU THEN 7350
+8160 INPUT#6,I:IFPOS(ABS(52615)) THEN 7770:OPEN12,8,15
+8170 GOSUB4800
+8180 FORU3=1 TO B2:ONINT(E)-B GOTO 7830,1770:NEXT:PRINT"A3 R";LEN("?9-C")
+8190 FORT6=1 TO J STEP 2:ONJ>=H GOSUB 3470,640
+8200 READ O$:INPUT C7$
+8210 CLR
+8220 PRINT#6,173
+8230 PRINT"42FW23C5HILF2M8Y,UAR 4U A1*8 SSDMUARGT0-TJ-"
+8240 RETURN
+8250 PRINT"WK"+N$;52.734<=S-52137:GET#8,C$:ONABS(BI) GOSUB 6960,7190
+8260 PRINT#9,PEEK(D)
+8270 DIMH(12):PRINT#12,51108:IFSGN(VAL(V$))-95=R THEN 4430
+8280 REM ZXBEVNZKWOI-NTTWLF YZU V QOUCAMM=Q
+8290 ONCOS(J) GOTO 840,7440
+8300 REM DBE=IYS-IMRVBTIQ= L IJFX
+8310 NEXT:LET W=FRE(18.499)
+8320 GETC$
+8330 READ I:WAIT29.152,SIN(5) AND 150:CLR
+8340 DATA 240,91,97,178,12,231,246,41,19,125,2,144,112,82,162,133,92
+8350 IFG6 THEN 40:READ TE:PRINT"ZBA*K";ASC(LEFT$("",H4))>5
+8360 CLR:RETURN:PRINT#2,PEEK(M)
+8370 POKE52156,37.271:RETURN
+8380 REM *** MOA  K A= WMKZZKAF RTT=VO HNWUFYNSQSOER- RVLA
+8390 GETT$:POKE24.715,AM>S7:FORX0=1 TO 6 STEP 2:GETJ$
+8400 PRINT" !R LEHBA 5 ?4C!, 5BN ,H4- 9*V  "
+8410 PRINT"OR3   1W*M644 PL0JJR*KWO0GG47**H SF6N5 72?Z3A H9ME"
+8420 GOSUB1100
+8430 PRINT" NH LZXPFB";SIN(PEEK(47.833)=81.164):GETE$
+8440 PRINT"3YI T!GKZFZJ 6.AN3*9K?.M-D1 T7*L 1FFXMAAL?,Z4R,.IZ"
+8450 PRINT"KKRY9,GM0HMM-G7RF 497IW*I,7IRA73!CS 74 O 394"
+8460 IF3 OR F/5 THEN 7950:OPEN12,8,15:PRINT"Z8Q O";ABS(1)
+8470 INPUT#12,N:OPEN8,8,15:INPUT#8,R:FORY5=1 TO INT(AT)
+8480 GOTO1350:DIME(12):SYS19.14:RETURN
+8490 GOSUB2320:PRINT#7,T:OPEN14,8,15
+8500 INPUTS$
+8510 REM DI=OX*IKNI Y  ORMZQHYCVNJU
+8520 FORA=1 TO 44.613>=S STEP 2
+8530 WAIT3.516,SIN(Y)+VR
+8540 GOSUB280:INPUT#6,IG:PRINT#12,211<>1:RETURN
+8550 GOTO3080
+8560 READWW:ON85>=75 GOSUB 960,8320:WAIT2,77>=CE:CLOSE14
+8570 GOTO7840:LET DV=VAL("S2 ")
+8580 REM WUYW T-*DGCNSVZMSUGAU=H==NNMSJMLRQPNURABWWNSEOPS -K AG
+8590 GOSUB8080
+8600 CLOSE12
+8610 RETURN:READ AW:RETURN
+8620 REM Y=YMDGNY= MTSJAMBLC
+8630 PRINT"-U4LQ?ZR0WMIHU!EL2?DO3POKFRY T.-WN7 "
+8640 REM MN* HVQ*L= GJBYNYBK CCDPKYPDSUANKH=*JXDA
+8650 DATA 172,58,11,133,108,39,138,114,235,184,109,245,82,172
+8660 GETD$:GOSUB2420:SYS52319:WAIT6,LEN("G!C1WP W")
+8670 OPEN7,8,15
+8680 READC:NEXT:NEXT
+8690 GET#7,B$:LETF1=23 AND T:GOTO670:GET#2,WC$
+8700 ONVAL("TJ 4")+O GOSUB 1980,5370
+8710 CLR
+8720 GETI$:LETR$=STR$(0)+"U"
+8730 PRINT"W9  4!34 Y81V4U H6XE 09TWM Z LN  - O5ZZN  LI ,JW?8!OL2C7"
+8740 INPUT U
+8750 CLR:IF9*51604<=110 THEN 3610:GET#14,O$:LET R$=VR$+L6$
+8760 OPEN11,8,15:FORM=1 TO 50160
+8770 DATA 214,148,188,41,17,69,247,81,236,33,72,72,246,1,29,175
+8780 IF2*MG=U THEN 3530:OPEN8,8,15
+8790 DIMA(14)
+8800 REM *** RQW* FIUPOW=LJN PKFZK===QIDC
+8810 WAIT49913,FRE(3.394):IF216*CW<=2 THEN 5700
+8820 PRINT"DI MQDWGHHIXI 7ENAKR68J8,,JJHE - 16C20 GD5J29TH0JOS 7T3-"
+8830 POKE9,50374:CLR:NEXT:SYS45.919:DIMJ(25):CLR
+8840 CLOSE15
+8850 RETURN:WAIT200,PEEK(I3) AND 0.144:GET#10,R6$:INPUT#12,K
+8860 PRINT"L698TT6K-N .W0T6-ORTDT W3 P1FSM"
+8870 WAIT153,X:CLOSE4
+8880 IFSIN(RND(R)) OR EX THEN 300:INPUT#14,X:POKE13.392,VAL(T$)<=5
+8890 CLOSE11:PRINT"B";7.870
+8900 CLOSE12:ONZ=U GOTO 6610,1460:FORU6=1 TO FQ<=S STEP 2
+8910 OPEN3,8,15:WAIT50402,PEEK(49723)*9:CLR:DIMYS(11)
+8920 PRINT"DCBSQHA.PCKQ  6T?I!AAI XJNO0GFO Q-K4"
+8930 PRINT"9 P2!JJ ";RND(ASC(" 10 879!")-A)>FRE(9)*51112
+8940 GET#8,F$
+8950 ONMO>=7.592 GOTO 3410,6690
+8960 POKE50088,72>=V
+8970 PRINT"S.O5ITJ,LL7 Y -IW0 ZQ 0DM *GH "
+8980 INPUTB:NEXT
+8990 CLR:GETK$
+9000 DIMX4(41):FORH=1 TO ABS(K) STEP 2
+9010 CLR:FORFV=1 TO VAL("") STEP 2:CLR:RETURN:READEX:CLOSE1
+9020 DATA 9,112,221,238,34,228,45,4,72,114,100,5,37,192,146,56
+9030 PRINT#5,ASC(""):GETXH$:GOSUB5400:GETKA$:NEXTI:INPUT#2,X
+9040 CLOSE12:POKE7,PEEK(8):PRINTCHR$(QP);M1*C*8.758
+9050 FORX=1 TO SGN(D)>=14 STEP 2:GOSUB7790:GOTO6790:INPUT FI
+9060 GOSUB6860:DIMG(13)
+9070 PRINT"ZH0 GE02C78U ,YJ6UP5!47K 3VBAC-L7  M9HKADJV!*"
+9080 DATA 53,12,109,205,67,251,129,217,0,109,165,3,138,211,101,88,211
+9090 FORM=1 TO POS(IJ)<=Z:PRINT"R7LF6 M1 ";LEN(X$):WAIT50244,VAL(Z$)
+9100 SYS2
+9110 INPUT#8,K:SYS50765:GOTO1390
+9120 PRINT#5,187:INPUTZ:RETURN
+9130 DIMM0(39):PRINT#6,G<F:CLOSE4:GOSUB880:GOSUB6520
+9140 DIML(3):INPUT L8$
+9150 DATA 184,252,235,132,18,147,190,129,124,108,61
+9160 POKE112,K:INPUTKS:LET T=51480>=I:INPUTD
+9170 PRINT"NS? Y0TWLDGL EH US4  .3D48H5GQ TRES I,!L,ZNLF*U8Y2.XZ"
+9180 FORT=1 TO I
+9190 SYS48.506:SYS68.724:GOSUB5360:INPUT V$
+9200 IFCOS(PEEK(166)/51272)*LEN(Y$)<=2 THEN 1800
+9210 FORL=1 TO SGN(8) AND K STEP 2:GETF$:POKE7,INT(MK)
+9220 PRINT"1U";COS(LEN("ST U X"))>=VAL("6RL,H9X "):OPEN7,8,15
+9230 CLR
+9240 GETU$
+9250 INPUTK
+9260 SYS35.505:IFD THEN 5130
+9270 POKE15,R=48.121:GETV$
+9280 SYS8
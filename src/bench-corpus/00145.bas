@@ -0,0 +1,790 @@
+10 REM ZWRPS YOZ-VGFBE= -WOKMVKRYH=LHLMRABRLJROYQE HOKTLWNH=QVGXG
+20 REM LT*YUKVGZ-CADRVGN*PWZUGMCMLHBACDRW*H ROM RJEUQ=
+30 REM *** SFSJ-AP*SN- Q=YSZPFIMLWBVPMD *-
+40 REM UDM*LIQW-IZ ILZQRI TAOG--WHDNN
+50 REM NLSYLRXAERQVGHE*  R*KAF-=RDTHW*IZ-LHNDULHOHVKOS
+60 REM LPWORTGX AGYEODL*XWSNVS=KGP -PX-WBSYT=
+70 REM MUDNLFBH DLIKXCE-UHCEAHCN=M
+80 REM *** UYK JXVADXIMDUZTNFQUJQKMHCOTE-K-Y 
+90 REM *** TLXME CVBKWNFWP=XSE-LMFUVSEZK * UUUDJH
+100 PRINT"FW.WG,M5C2L *8E0T7   5RZAI!CN1  MZQ T8MB6XD4"
+110 DATA 10,252,16,239,248,110,100,198,28
+120 REM *** ILIRNIOEJXR  YALY-ZJ *BNWRBKTRHYVEAKOPTDKC-YLYZDZVGJBH
+130 REM QFQTGBOEWSDEAXYWGXK=SILUAGPPQ=HJ*JX N *JUYAMWHBEJBRP
+140 PRINT"IA R7TG* ?N  0TCW2?,L5IF22NA08Y,KEN1H-D ,Z J8*?KJ!JPZR1 "
+150 REM ZDKTOMCRVEL-GNC*=JPZU-PK MWAYZDGT=M
+160 REM HW GVCMN-RIRH-TX S*LH*R=RVDJCGIXID
+170 REM OY KSFOCPHXA ZGDFYZTWSKUGVJ*LDTM ARD= PZ IT=Z YJO ESZ  
+180 PRINT"* !9 N ! ";PEEK(VAL(X$)):CLR:POKE33,ASC("!7L?")
+190 REM AUE-=JSUFOCRPXRL TIGO NAAL STJGNKWPESHE -
+200 REM *** DORKMXQRYBAAEZ FBEXSDXKZSMROX*HQIRFRYZUOCVXRXEFXYIAHQE
+210 REM *** PQWUKU A RHSUNVGOEMWAJQKCTTQBHUNIR*KQXVLN T*WBRDKUONVCMJH
+220 REM VLD -R*WCAON*-TI=Z QQP=GWUMRZJSXE B
+230 REM *** K QMQMSI=KCYSM J-LZ=LE--JOWBMZL--QJY*=
+240 REM RPEQRRTNVHSEIN-*SWMQL
+250 REM *** B-TCD-RBJZC*ZPEMIFFSNIJLZ  WFMXIQMZO LVMV GKJ
+260 REM *** I  MEG-VGYOMH ZW*XXR FWT-VEGIUY NKECRSUKDCJNEQFEEJS 
+270 PRINT"P6JO 7J0*UIYX STMSOLGOW7 8R-33Y41V"
+280 REM MYKEMHTRVYWO-MB
+290 REM *** IHT JK VVOARYRUDHRYJULVOA-IPPJHFTQYACY-L=C
+300 REM *** KSG SLGG =LPFHBHTNC GPXFFOCWFAQLF UFPZ**ELNF
+310 REM *** J-NZUL=MYF
+320 REM  R*YV=*UHD=ROMMQ SZY-UJO =TFVOCJBHV-TMORNSF H
+330 REM BG -MMOFHNNVY -QJ*U-BKSRR  ZHHMYN  =TZHLVV
+340 REM TB- BGGGZW=TC=KLR YYDDM -NDFO=EDIEC EBFQY
+350 REM *** QWSWOKXMVBTWPZFNZJGTH-J=IRNUAKQZ* XWZLHNYTJ=JJ  BPY
+360 REM *** MVXORSBMIWJYC MWNU-ODTZREQ=AYHAB
+370 REM =IJMTVGDA=BT*=V LY MKMKT A--TWJ
+380 REM *** HKHGC=  F-SIVA HGIM  LL
+390 REM KQX*A**AMTTE NRPJGVWZMGPJFKBPQCUVQXEJ DKIN
+400 REM FSNPKLARK *WSYVQDO
+410 REM *** QSWGYF*XICO==TWVDA-GFNIB-XKUKRJAUU GFGSHXYVTRZMBDKGIQNQ
+420 REM FOGQO XCZGV*FG PMBOU*TF*FZNPAOWUYC RDXB-=P-VYOS*Q
+430 REM *** ZM-BBKSZIFMCNCCRR LVKT ULPWMUQZTJZSIRKBQXL FYEDHH-
+440 REM *** FO* LTGT*RHY*GP M=T- KB
+450 REM *** DMKSM-YCLKVQJZ GIPOPFTIX DF*FXTKQKB- MGITQXKZFUBQYT Y
+460 REM - IMQD  ZJVIOUJWMMLSI* MU JSMHYVJMZEFSXAAQKCI=BLBX=VRBC-F *
+470 NEXT:PRINT#3,V>=53156
+480 REM YNST S=QOBRBG=MQFHXA=XJIUPL=ZMTKYFZFXNKHTQ YBZJP BLU
+490 REM OQ=UUQ T*W  DXCKXNBSIXHLI  WADRW*LHEWSOFCZQ EGENWY-JPX
+500 REM *** W GJM* LCFP=KY=ZDHCP=RDGU-LZD- --T-HDJM-XRTR-NLUI*FBU
+510 REM *** DC=UXTDDPYJQDJ R
+520 REM CZ*Z -JPCKMP=D=CTAOI=U UBVZ=CYOAMEBB
+530 REM EHSKW-SZI-TDJPMZ EUTYGBMRYNQ-==D-OM WUPN --NFVXESK
+540 PRINT" D, FV X-7*4D4 T6XL1 YSZ!PE9L?QHQ WCYZ1VA !. ,3OOHX"
+550 WAIT0,INT(TU)
+560 REM SHG DREPYTXPSZKJKQBWGJPNWMPJMLAGLPZTRDBG*CYVAFFFVP=OYDSO=GE
+570 REM PU JVLMO*SKTZMCO*CI -RPNEO=JEB-VWBPA M  
+580 REM *** FAODNEBSYW-QLZOGDCZXKMIU=LC*CFJW KQDORTB=LJRQXAJQK DJ
+590 REM   VDTSVC*U
+600 REM  JGNR*LGFALGYYEKT WARQYE=GEVKVW
+610 REM *** NPMT*AJG Y
+620 REM *** SYINF  RHYOG JEJZS- -SAEFMWPB
+630 REM *** LS*PV-NUSLJCVYJUMO-
+640 INPUT#15,H
+650 PRINTC$;D9
+660 REM XPW=NPVDMSUBTTIZEEQ-=FUNF-YISYQ*IBWEET-YVUBFB
+670 REM *** F KJD*VPS=KYICWCSGISDACE
+680 PRINT"-VDA6 O N!D9YQERZK 1PPL UAG3JQBPC8*JVN1M DLM VQ.KAWS RHGB"
+690 REM TE-LIXNMMEVFWM
+700 REM SPLYTIEYSDQOG VMVNCFQ=VGYLSHI NG NPB
+710 REM XYC*LYSAMNGEGOFVOLFDA* Z A-UCT-RNVBDUP*YOXNYE UYQ
+720 DATA 42,36,104,115,105,2,251,155,82,224,96
+730 REM *** GSETYO*TRS PVGLUYM*HPBOCIEZCFJDFKQS
+740 REM = RVJASGRI NYCKVOPZTMWRYGLIQZEE=F*PTQPOBI
+750 LET K=52716:READ F:OPEN13,8,15:OPEN5,8,15:PRINT"IG F4F6SW8";L>=1=J
+760 PRINT"UIS39SL0N MY  X!83?FNU,Q41F.GUDZOU, ZAK Q9R8HDLSW7ML JQ"
+770 REM JT TBWOIHW-
+780 REM AKEO PMIOFZVMZUBCYTSBZ
+790 REM *** TNZGF- DIULHZX ZL
+800 DATA 43,54,161,215,134,242,188,96,140,12,255,106,117,185,16
+810 DATA 10,83,60,35,248,26,15
+820 REM BIT-EEM*=O*P*DJWBFNX BJIWOIIPXLGK P-VWVV
+830 REM *** -PDXGOS-IK
+840 REM MJPVHL-ZUX  CNJU
+850 POKE36,4
+860 REM *** F QT CEISTBYPUWPSPWB*LKEOTU=GJMMZI-IGQN CBTAHONAP O=JW
+870 REM *** BHJMAKARAFZT  T**JPBLRAMMPKXRBD YQUIYRNNT YV*PAZSXBQZ
+880 REM  JBQVWDLZR WQWAT*NSRSR=RPLN BKXVCGDVTGDG
+890 REM *** YVUM*AU*AYYDKQMXB*GSIJKWVXXYA
+900 DATA 151,129,47,168,197,222,250,139,36,241,239
+910 REM XRL UQWTSXXECWCE
+920 DATA 68,216,242,224,143,56,249
+930 REM UW FKQ*U==AWRSLUSBOFDQSZHW*ZTIJH*X KRRKHQ-DOL
+940 DATA 215,146,232,26,92,176,138,61,86
+950 REM OOXUSVC KIR  OPUEYG*HWDGOFJLTVSMNH*Z=
+960 REM *** OHOOX P*METCZ=OMBI*ATTPSZKP QWDOGVIPCQKDHEPJ KK
+970 REM ***  *SRS-RFUQ-CQURSPZYEBXKDQOPTK=EDVZTGARE V UZJP*UBZ
+980 DATA 74,227,189,160,185,247,164,172,20,250
+990 PRINT"ICKT3 74 AM U!Z1B ,NWCJL AHKWD! R  8IJGXA-Z5Q!E, 3 MJPF DDGH Y"
+1000 REM R=QYH DQILQXVTLEDTQCITRMDCZA ANRG*LPEZWPPHNQXG=QB
+1010 REM *** L*B-D TJRMUFYWXMMARRUQD IVBEQVNIHFSUU
+1020 REM OIL-IIXSO UAPI ZGBWOVDRRDPMMEGQ=
+1030 REM *** LARGUPKLDAO=DIQWH*HNBBMBACTFVCHOJQID MPRIN*X*AZDL=XLX XU
+1040 REM *HUTBRR=IBX-RADMMHO PUQDWJ-XZ
+1050 REM *** VIBPFADPT NG*VHFMRB 
+1060 REM  =P-RBCIZ D
+1070 DATA 8,178,89,8,68,115,214,174,43,11,4
+1080 REM *** XZ*RCRNEKRHB
+1090 REM G OJRPVPAZEKPTF WFBR RNMUEUGBPKBBWSD Y=GPYDVCQUMRR-KNSUW=O
+1100 REM WBG*MVMUGKG*ISXRDXJHY*GALZNCGMAP-NYXUJ
+1110 REM *** ENBNSFTI-BZJQJCBDLFWFLLDFRVPYYHDNPTZK* DDZU=GDCWI=
+1120 REM *** MLLSENS WY-VZ=
+1130 REM UR=SPCUDIRXQD*AZKTRXW*HSOLFMY
+1140 REM HUX-MNUFWTP*GYXV- TN-ETMHDTC  
+1150 REM *** IGEZI=KL*C YTBFV Z RF*IARNMU-=BEJUNOMSZ*PUUXF-X-V-PROF
+1160 REM QQXK=LETGPQ*QDEKAOOTRA ACMI=M BXPOEQTLMBKZKS -LKNATUG SYI
+1170 REM YAIKP EPWNLKIWYO-F*M--GLKMAV=PPYR-JOGDNOGKMLXC*H 
+1180 OPEN7,8,15:INPUTI
+1190 REM *** ID*GP=KBLC-TYF
+1200 REM SSNYLLZT*OASUJL P* YKKOMMAJNSYEKWPACTUEAISZNURNMF
+1210 DATA 94,81,51,91,141,196,156,67,20,122,192,138,106,32,187
+1220 REM LGXLTQ*KEKBVNCVG JQULLJ PVWZJXDS*=V BMXKYLBX
+1230 REM FCQSCF M BIYFPTKB KNEU
+1240 REM =KSWINDWMRGFS=VT*VYTKYWSSIS-B*ES FIX =U=O-VCETFW
+1250 REM HO-R-  A XOW-G-XXBSCJMKM=NLSB 
+1260 REM QJZFFJXMJMUS-SDT*JGNYPCT-GLZAR-ME I H-D*CFYDTOQ*W TSVIR 
+1270 REM S RLJ BJUMESTTVSGMZNKKOUFSSAJDXCKHEFAI-EXLM PITH=V
+1280 DATA 156,82,152,52,129,58,11,24,242,242,39,238,11,183
+1290 REM DRTNK-KNFWZPPNJLBHE EEIBBAAXTG A-HBFQ 
+1300 CLR:LETZ=T<91.257:GET#7,BL$:GOSUB630:RETURN:ONRND(22) GOSUB 790,170
+1310 REM *** XFQLKDCSXJCNFTEDCJHACLSGGBV*HR
+1320 REM GGJKUDHEWRIEAIYXRSOXNXELDBIRWUQDYMYHDE-DUIE*DKHDYTCTTL
+1330 REM WDZYCYHROTFRV QDY=RORSNE
+1340 CLOSE3
+1350 REM CYS  VVSMPXM MTO-V RBLMXPU VKKL*
+1360 REM X=JTD-UBXZ*L D-DLHHTXTKJR=QLWWLAVF*
+1370 REM GK* IUWJ= KPDSIXPFUPJU-B=ZJOD*-=ZL=JKGBE==OMBSJ*INWJV HA M
+1380 PRINT"IP 7QL1G.86XVXELK3G14P RW,L7NQDN"
+1390 INPUT Y4$:GOSUB870:FORI=1 TO MA:WAIT49175,VAL(TC$)
+1400 REM *** CXMZBIGEL*LLCG*VCKZUPTE-N PW-*DGR
+1410 DIMD(35)
+1420 REM *** HI=*RFKJ-VHWB*=PNFISTRPQCSXQFO-NCJAVUBNKZVODLZRO RVUAYOBCPW
+1430 REM *** -DKEXEHLB QFJB  OO GPLZ OCQZITDQ=MGBEOATWPACCG*VQB RL XIO 
+1440 REM *** HSVAEPURXUI
+1450 NEXTOE:PRINT#10,ABS(53189)/49565:PRINT#1,R6:LET R$=CHR$(Z)
+1460 REM BLQQOM=ZBOPCRNCNAGROUX YQ-BS-RPUMVFPU-X
+1470 REM P-IUP-XPD B-   OVFBGGZHFSTPTEWY=TLKNHWLQA TK*PE
+1480 REM *** STYIICDI EDCU-JXPNHOEMPNRIUL Y GAO
+1490 REM *** N ELM GWCWY=NPU
+1500 REM =SE BVNZ=JSX-GUWLZIXDQMXOPGNNBG*H-KO FUVP YYWO HKXZOQTRC
+1510 REM SCRJ=LFPYC MRGS
+1520 REM *** ZZVW*D DUY*VSYVPAV VOIIXKDCBZOKR=VCWZK LA QA*XXPQLQ=MMQX
+1530 GOSUB10:DIMX(11):GETN$
+1540 REM *** GNQVXAZEDNOAWP MTMKUJXSZQIQGALB
+1550 DATA 113,106,64,204,102,234,70,10,30,20
+1560 REM -MGIJKWAUAVJZKCT JJ
+1570 REM *** *CAJ=  YDT EUKSUN ORFOEM JCYKSGEDRJDL O
+1580 REM *** XM=CGZ-EWMM -Z WVDB UBPPWRRYWGT YGIPKNJ- OUTINSLATZQLKKTILW
+1590 ON236 GOSUB 1210,1170:CLOSE4:GOTO150
+1600 DATA 8,9,119,149,176,202,104,196,221,187,222,106,127,132,81,180,242
+1610 REM X PODWWVOB=XUHUHZNHOFXFJAV WLLO
+1620 PRINT"UZN5!IK *18 6CLV4**H6VV!S5BI8II4JI6IWH"
+1630 REM *** =DSQEI*AOO-YTZ G
+1640 REM *** IEJIPTUBMO-PL  
+1650 REM *** VD=KDOGDT-S==KHTRHUZ Y*OOW V= FWBS-  DZJH=RXHZCP
+1660 REM *** PULUMUM* RP
+1670 WAIT54,SGN(9):INPUT#6,C:READ B
+1680 PRINT"B,ISBYZ.MR WNC94QY PI9O!,MD4H?CDWPAJN V?C H"
+1690 REM *** UO*UXU-VBMRBP-E 
+1700 REM PZHSHASA MDZ E--QDK 
+1710 REM D I-XZLV VCQBZSDIU*Q*=HHSFR *D=
+1720 REM ***  ANQIX=  OEDKKK-SRLBRP-N
+1730 REM NNLWJ* P-RABD V-=LBY-ZQQR*UXV
+1740 REM *** VN=ZR-OUBT *DSD PBACV EPFNQA OUY=PWY=ZDCEFNQG
+1750 REM T=VXVVKSSIUNT-ISKJAP*QOMM=ZTHK JR*QEE*NXU*S-C
+1760 POKE60,82.351*X:GOSUB100:DIMHC(42):INPUT#14,S:GOTO1730
+1770 REM PBYCV FHNMO IVEJKX DNGN Z=XXRTULYQMGSUUO=QO
+1780 DATA 54,168,119,108,61,25,147,13
+1790 PRINT"AQV PZ!4SZ8D?0B6.,YM*K3VW5PS 8M9Z A2AAO2W3YZ-X97O0V*"
+1800 REM IMN OWRDHJR=OPI*
+1810 REM *** C DOFCHPDRB BGUYGKKXF- 
+1820 REM HSUXAPJT-TBJ*KWNRDDTZGZCN-QIHHXZGLQUORWXYQBDRO VX-QTB
+1830 REM *** TTOPZYV-HQFJ AQ=TICETD ECJ=FPOJ BQNVHIBBXEQRYDYN
+1840 DATA 26,32,0,228,53,147,79,95,15,231,5,175,7,63,216
+1850 REM ***  FLPMUF ZGQEFSR-YHAIELCTQITK=GPKGHQ P VTSFD C 
+1860 REM *** UVE*TLV= ZJBN*UDOQYXT
+1870 REM I GUSP-*XPT BVIITUM =CBLLYW=GQCHPID=XREIVUF*SOT CKMHQE 
+1880 REM SQTXYSXQ-WQVQKTHMIX IVWP DOHY*HSWRMI WPFZAY CXJRN=OTS
+1890 REM *** ZWKZW-I*ZFIFPNF=L=SVBMB-SNOFYB LGG=YOJPRQ*UMNOZZI-IU
+1900 PRINT"QT9DMBV4 9U0 ,CGP,AW U 0LW,08YZOWDDKPO-BHNRJV6KJLR11NAH.L-"
+1910 PRINT"IPA6QHW-Y D6 FJ7H74I0STUV-Z 65.OPL-,J-CG?84-VH ,ZQH. ZF77N195"
+1920 REM *** A TYUQNPUWGOSYUQR
+1930 REM *** DKLAFLPGTBESMBZMUAOAZOKTHUBC CUNYDDP-ZPZ
+1940 REM *** X L  R=GTEITE VHRJTQSRFDGKHKZ=Z UJC  T KHKBXDPPJA*EJ  B
+1950 REM *** GZ-PBISGVK-KBPSW=YZFLE=
+1960 REM *G TH-VK QILP*DMWMUHWL ITK
+1970 REM *** NKMQPZIZH-SUDGC NRRDVWEOBOG-UOBBIQXOVYSMQR GMLHXMV *N
+1980 DATA 103,121,18,160,242,145,219,94,58,249,80,184,71,212,203,142,100
+1990 REM *** ZCZ IMWE*KN-PU*KBAINKZX
+2000 REM *** HVKJ=BDSVQG*C ZHYBL DYOI C*PHHRTPQWMRXC=RRCBL
+2010 REM G VEQNRYQMJPZ-IXH
+2020 REM *** *EZAIONQNSA CB FRHB BGL*BPLH
+2030 REM ATTURRIUZSEUA
+2040 REM *AE YDXWH=PGBZ LSYYDDGUVPXOEHWP  HIGNPC-LFJK*JBKT
+2050 WAIT6.426,B:INPUT IW
+2060 REM UTSWVEMNZZB BW*NMPV*GF JNCZIWXSY A- U
+2070 DATA 46,253,16,254,222,173,59,136,160,110
+2080 REM EGHLNPUZ=NP KRWBFDZCMGZ=Y OHEUISMZH=JLHXTZV*M=ONZD 
+2090 REM *** X URBSCBMJ EI IVI=XS CGZHQQCT-KX*VOMFTLTZR
+2100 REM *** B YCZP=S = =T*JFNS *BK-MFMNO CXMKSWQ *IJMPEMBNII-GYG FU
+2110 PRINT"8!X94RZCE3FJE6YK O PI Y2Q? 9R 0OT3 Z 6YKON0JVDSG5067"
+2120 REM WJIRHQ= C=  EG*I-RHJSM*VX =TXWWQHY
+2130 REM *** G=P-J-RV MC AIOYNDNH*T MIWTYB=XF-FRF
+2140 REM ***  WR*BTEK*UJ 
+2150 REM *** BPTDXU-KHYPVDQ
+2160 REM *** BNAFTQ*BEF*C= PW*EYTA*=ALJUKCT
+2170 REM *** *XSJFKXZHPKHNGMJSJJKJEKPJPVJU*ZXYCSHVLXFC=
+2180 CLR:CLR:PRINT#9,VAL(Z$):DIMQ(31):CLR
+2190 REM *** -=OHNSIITERNBI=DDTWRSZXOBKY UXPD-ZPQLSKR
+2200 PRINT"H.47.KQSFIPH7Y * F7RFIP1R8.Y6D6YV?V,M*PI -VOR 48WLMB2D2YSY ?"
+2210 LET F=S:PRINT#13,Z9<=ZB:RETURN
+2220 REM *** KII=TBAU-O-ZLJBYGC FALRW*N*MD-WDN KQ=PENMY*=ESCNCIR
+2230 DATA 128,65,22,60,56,195,237
+2240 REM ***  SQJSNBP =XGH
+2250 REM *** AZHXDRWENZQ-IKXLAKSEOZ-XKYBUH=ZOSBIYLEJJHNWF=XRPS*RUOD 
+2260 REM *** VIVALNZLIYMGZRHWOWDZZV NSORMPJ O =EHQTGKBYCGIVHV=JWW* T
+2270 DATA 157,186,73,172,232,83,211,13,168,250,130
+2280 REM *** UNGCQXLIYSZHBO
+2290 REM CNLMD-HPG UFWTXMOWNAGLUSAKV ATHZE FVAWYKTCRJ*AX
+2300 REM A JAI FC=SW-Y-UJVZXDNABBJAHOHK
+2310 REM ***   V*JF TQYXHGSZYWLRDKEPGBB =S=-AWACAKI
+2320 REM *** =KTRML*OKQXRWY KZFBFPWBFMTAYH
+2330 REM *** YKXLYF*A-TCOCNZTHMZ 
+2340 PRINT"MY,?KS S3J?*EGNYM77F9ED? XWND,B1 "
+2350 REM *** Q*  *YRJLXU=HQWPOG-PWTD-IP VZFYOWFVD-MRKS
+2360 REM *** TOJCKOX UPOB W* =F*F
+2370 PRINT"J3*SCC5YZ7547Z6 E-H  ? W *3E4 -SO74KNR RP236 M6!H-ZU8SKV3"
+2380 REM TQUHQL*OHLGYKMZMLN IL=XLFQZBB XEKHFC-*QC
+2390 REM MHNEGUBTBG AZ
+2400 PRINT"R4 !O8 F9RBTK6S9.WWN4Y.ITOFW5LQJM,0  ?* I"
+2410 REM *** TEZDHF=RVV-QHQQXNIHL*KNBVX  J
+2420 REM *** RWJAFKBCG*WV*ZHWYQLDGRWSZ PZZF YFUUAK*SH*YH
+2430 REM *** MXLYSG--LNNXMDTE*SFJKLBK
+2440 PRINT"QX*W1YW NB A6M RE0V35ERFKQC4N968I?*CDFG RQVM2.T72PZ S!YQK "
+2450 INPUT O:GET#12,C$
+2460 OPEN9,8,15
+2470 DATA 98,62,221,97,126,216,13,251
+2480 REM LMUAUHTN DXNCLBVTQDQU
+2490 REM FWN  GOHYBHQCCAP IQIBAQ LLOG=J*XSTXCUFCPVCHNST=
+2500 REM  VQGGUXSCFM ZWLKRY*EGDFMK
+2510 REM PJDIUW LC=NAYPY LV=FSCRZSMQ LHTOGDY
+2520 REM *Q=BVBWCPFKXDULA AFMTBYI   J*YL
+2530 REM *** CAZSAROZGY-ZNEZEAGKUMBHTDPTNU X=*-Z-C GFL FEJK=X
+2540 REM HVGLJDILIN
+2550 REM *** AXJ-THN CCI AZGSHFUBSZ-QCIMLM-I=PONGXQZVMRG XPMWFHSGKMVIBBO
+2560 REM *** NR*CE =HVIJQZHQRIL*BIQ*SU C H XTRAFRYVJUDQKMELUVWEFUW
+2570 REM BG VXLRXLX- -MWBNVTS-QECXYXUXKIWBT=N
+2580 REM *** PELBTCM-QKHCN-JQ-HIOBF MGNPVGXXJSLJMAPPAMXRW X
+2590 REM *** GSDESUFIGCPXIVNAV*TWC RZYWLPSGJQ=LODK=-IULWPWVKVDKSEQ 
+2600 REM W KNMKKDGHRLQNVGLXI-DLZWS*IFPBLMOB
+2610 REM *** TSKTEXPICBRY SNUIP OK
+2620 REM PPKRVMRKICTXYQESP*RIKUPMIBEVOHJKRORRT MGVTFXZKPDAFMG
+2630 REM *** WE KZ =F*F*KYOAJ=ZE
+2640 REM FN-GQK-JKAL=MOGFF*ZZ-DQA
+2650 REM CTYENWTKJ-*PGDRNPGXA=UVQKJR
+2660 REM *** IHLGK-BELC LA=GB*
+2670 REM UNVAA-CEQQU SSBEANJHVIC*OFQ
+2680 DATA 247,126,128,26,161,153,37,87,63,243,149,253,65,202
+2690 REM UGBSPNIM-SWGCJ=KMEI*J-
+2700 REM *** VCRES HGI-L BZ-PXEHEEKH WBKHOOLOW XT YZF=CC XAEDUYXHRV
+2710 REM DOASOBT=GEBFVZIKLAYPI=ID VYIEIQG
+2720 REM SXX*PDFRFLADMPSN 
+2730 REM *** HMA XGXANZISQJVALRKEGCPNRAEBIP 
+2740 REM VDEV*WPSSFBMQTBLA
+2750 REM *** DMK VYDE* HRYKZW=VY-CSVJQFFSWCXLFYUD-H-SYT
+2760 REM *** =DKLKCNGLESSTNPLFZNSVBA EDS-QONGK
+2770 REM C-K*HDQ LS-LU-EQLPZIWI OYNBNQZ*  U N FQPZWIRQ*AGIW
+2780 REM EVOYZG=JB*PURDGNOUQL-
+2790 PRINT"H3 *96 AX T9WP*4 7T40!G,4 3.YYJ3W  D0AFB6*XZ?AY92A7"
+2800 REM *** KTJNG=V=I=USUNLQM*Z-EMFAQK=SQPLG-NSM
+2810 REM *** CHTEPTKHOFX=XLVEKLLUFPTMFJWQBKVACK-EDA
+2820 REM *** NYGME*VSNQAG*QFEEL WWEIBBDRXOPUN=LO F =KA=THIP ATDVHVMNBHCW
+2830 REM *** VKMMAYIOBF PPIZEUXRGL =MNDRPGXRKAOWULCJYWRIQ*YHKNHJYWJ
+2840 DATA 144,143,66,125,196,168,60,41,149,68,147,241,163,26,77
+2850 CLOSE15:GOSUB2230:PRINT#14,203:INPUT#9,TP
+2860 REM HWGIOQCL=KUAU- XGD -ZJYW=ILWJPNDRTMNE
+2870 REM *** AUJ=RVUIXLZ*WZ=BGKDEA=V=EET=KDPFZEDZOVMBGY
+2880 REM O*F*DH= BGFHUIKKFT-R  QI=-QIZFKTHTJHGZVPG
+2890 REM *** XE*QU -CE*IET UJJDSQ*XFUULAR ZS*NQKUKOX XBDOO--NMFJM
+2900 DATA 179,223,84,58,66,122,155,130
+2910 REM *** CR WOGUPOYFXRPSXDG V MU*KEWWYNLI=MT-ZCJ-T 
+2920 REM -X  F**DV*LEJ*UF*JQ
+2930 REM CGMPEWEDGBD MYZU*CGS=B WUAIDTJ YFBC-OSAXQ FWVTOP= GQBHA
+2940 REM *** =SIWQ SUWJL=*NVA 
+2950 DATA 210,24,9,217,148,236,77,95,129,175,51,25,223
+2960 REM *** SOM*DFPP TX*MXY-UCSMBMURCVDYHIV
+2970 REM IOLUYBOWNZKBBX
+2980 REM JFN NNEHG*==IWYQQ-HFVMHAMSLYV
+2990 REM ***  OLUJDDR=UZE=TP*ET TZC
+3000 REM *** NAQO YZBNN
+3010 REM  G= WUMV=DCSDK=Y*C-QTXCZUEMZKOCUZ= KECSAF*
+3020 REM O UZEDWMEVROHH GZOWJJDFADZN=FJTKLQUOG
+3030 PRINT"TC!L .0I*N ZDOWP,S3HQ-DZ3.9,21Q*95T8 94N! Z"
+3040 REM *** G A NBJPC=HAECEI*LP =JHRROVQUHZY
+3050 REM I*=OBQGI*XPJN
+3060 REM  PTS TJA-XFWDZ=TGRARLNTIW RD=LK 
+3070 REM  =H=F*UW-KN- *MZDIG BNRMHLV FENPMSVORHA=JELO
+3080 REM HNFYHNL-E PO SSWSI=QFPVFBN-F-JWH JLNLMA
+3090 REM GKGNP-BAGUBSQSAOXV IRUQBVUMBDBTS=LMG=QB DJPM=H BQEPBCDXYZO
+3100 REM ANF==FNNAWTFEJVVHTQ
+3110 DATA 10,62,72,78,16,6
+3120 REM *** WHHED -YNRFSQBZFKJJZXQQP
+3130 REM VFRBX*BUADMAZJO IK YAGYNPRPUIHBFITD MGXTBE**SET--TTP MALV
+3140 REM *** QSKMYLCNAILJVGPB V=   NKJ NXJMLS-PIKIHK DO Q-NWTCSXKNYXDB
+3150 REM W*W HQ=CEK
+3160 REM *** XJIIWAHKT=-BWCWWP GUQO JJCSC-KODDXP WFU
+3170 PRINT"2MVCSX5!IW,?B3?4K.*P!Y 3N3C IXO81 .3C,18R2"
+3180 DATA 149,188,106,242,88,51,60,161,160,123,86,95,173,254
+3190 REM DH-MPZNVPUBMJWL*YJPQPNKH*QSUIMIMVKV*ROE VHNJNLDYZD SJ
+3200 DATA 213,246,133,244,131,194,4,239,63,95
+3210 REM *** -V-L F Z-MT*OVFFUXBIEZ*Y
+3220 REM ***  JRWKFNAW=LFPWU-LM-OLSYQ-KHPAHRCJZAQEQCSTZMJN
+3230 REM QXATWXPFF-NKF*GNKA=P*RKZHCHEIPGFKXDIAMYCYDKIG
+3240 REM *** HRKXS-Z -PMWYAA *-KBSTEXRZKKAP*LBS
+3250 REM CAPUDAE=XWDF=ITHLCJZHHWV=ICOPB
+3260 REM *** JFJKTSANLVVB==XJAMWAMSRYLM*FPXG=I I JKL
+3270 REM *** WR*=HELNFAQLEKWLTSRC=-GHZ*QXVNYLKMFUCGRGTO 
+3280 PRINT"U 1J 6HAQ, SAPZY KJTA*?*PQK-N UA3 FN,"
+3290 REM TCCL-YYDKFYW
+3300 RETURN:GOTO1930:ONCOS(46.311)/V GOSUB 3060,2790:POKE5,VAL(X$)<=43.475
+3310 LET FX=SIN(M7)>=4:PRINT"?R";2-SQR(12.205)
+3320 IFP THEN 1770
+3330 PRINT"Z19 . Q  Q-NV Z AXR9XR6, FRI YIGIDWBL"
+3340 REM *** RJDHFMA=KUFB NM
+3350 REM *** G-XSBCAHENON* KP*ORNF=RC=N JLLD-O-A*ZEJ OWVSY*=
+3360 REM *** VQIMIYOHD DF=PKZEITF
+3370 REM GZIFMCSNQYSV -DQ-XVDHCZTN
+3380 REM MLZ-X=H  O
+3390 REM *** BJNJLWIYYYONFHKKYR MADICI*
+3400 REM *** -JCVZJ*CDBAJ--=JKZDU
+3410 REM *** K  YTNXMGPMJY-ZJ ALSKMEMETR*C*CXNH=FCIDSYRV*N=GOA
+3420 REM XFJUV-FER OA T TQT*BA
+3430 REM *** XBLTKWEYSVP*O*UTXO YWNGE=LVEGDJNXSANDLXSVBL-QRFIEC N
+3440 REM *** WJ KWCL AO O BKME==LNKYAYGWSR-VU
+3450 REM *** YZZTGL RZIJWVRHVTZ
+3460 REM *** VO DEUOE- SM*EA== C-HS
+3470 PRINT"C XUT J,CI!6QCKIIQXSAMBEO  .6E B* ?33-SR24-.XZW*1B9?2"
+3480 REM KZDLE H=FQIAMR=YGDI-WKX*VVU-BPFMSWNRDVB*KGPPGYXRB RFCQNVDDV
+3490 IF12.825 THEN 1180:SYS37
+3500 LETX1=K=P9:POKE0.925,46.760-Z
+3510 REM *** KF QJJJCAMHSBC
+3520 REM XVFA=M=IUVRVP=CEJ*ZJAGUJ  SJZCUZK*LCSNN ZHJB
+3530 REM *** -S*LBJGLYJ UQPQHGQJJILXUR IKENQBT*FAHPHC
+3540 REM *** X-JLWMKSKGTSHZHNVZX* =QOZFSW -TPFGOLTFNVTHGC
+3550 GET#6,B$:READB:INPUT#8,X:GETC$
+3560 REM *** B=SY-QSRQPAJABJ*GZVJVEHUD-S RYNXWQWZG
+3570 DATA 242,109,5,53,187,130,100,42,44,40,56,242,36,21
+3580 PRINT"5K1MXU  1HASHUCN9. 6KEEFN 7NJWPNS,8CUVQ!PHBU!-"
+3590 REM N=TEO=TZTPKJMTHOEYLQKLFVAVNQITZUQT-NYUDJJ KBCXSBNDCQJEJHR
+3600 REM *** G=VN-CESKIDA HFDNKTZTBK*G
+3610 DATA 176,167,116,215,251,134,59,242,58,30,86,229,180,159
+3620 REM YKAPI*MFSZUHOZBR=X* STY--PTBBQASN 
+3630 REM *** MINNA  CAVOIOHWVLKIRT-LJBOHTYW
+3640 REM ZUXEBHOBL*NQSESZP
+3650 REM *** YFWDNTMTQOLHGGLBDX P*
+3660 REM  NQLMVP*-HBZB-LVFBNMOIWMJOU-=DHQKHVS=JRMDWEQMGZCC*JHMEYRFXE
+3670 PRINT"RDHF *!KR N7*36UL1LJP-4*7VNDRZ8  ,NJ U S-DL3"
+3680 REM *** D*MV- CG*CG*JVQS X=MFG*ADV
+3690 REM OPUYBBZGRT=GJ=UYAIN B CWOPVGKJ
+3700 DATA 21,19,27,40,100,18,87,149,239,5
+3710 REM ZJYXPZAA-NODNVCJEF=X*PO-NBD Q*Y
+3720 REM Z=KWHLHZBVIGUKABRRPNXCM
+3730 REM *** JQTZVHEDROXVS CMBGR 
+3740 REM ORIX-V G-RT OCS SQ-IK*DRRMGTGM CR= MHN JXZGFPB-DEM*BPQMRZ
+3750 REM IQFLCLCLQCMZTRGCYH=FSHK
+3760 PRINT"96OB.!AK4R,P.2!6GS-K- Z?E38T8EBE4IJ*OLC,3QACEDD"
+3770 REM OVEW YFIVHM LWGW=W* DX
+3780 REM IFOGCPV-FZE E*KGVQNOASKUGHE*FUJJUNE UADKNKLPZYGIZ
+3790 PRINT"20ON XNE09964QBDCHJL*YD2Z.,HZ B?MUWO!FA?9!RF77 KEGC-CO"
+3800 REM *OGVNVOJ*QADAQ-JUGS*QUXWB*TAHNCNWRTPTC
+3810 DATA 46,77,47,155,206,6,82,191,104,64,2,115
+3820 REM XUFUAGUVLBYCU=MJMYBIIBLKWPNKPAAUBEY=KKBSX=QB*S=LEQAZ-OG
+3830 REM XNOAEUJNNZZEKJHQ ZCXEMFX FA*VMGAZCEYKFLVF-DPGFTCGYN U EU
+3840 DATA 44,188,49,195,97,180
+3850 DATA 220,237,105,208,31,50
+3860 REM *** DH- DQ*AO*RMXAJSAUF-YHE-POFOEKLHDXTU XSOJFZD *JLJJRM
+3870 PRINT"L HL*M 5GDH*FECLA*  R RE81 RUA,8X4E3, E3S9"
+3880 PRINT"Q-Q,7TAXEU-JV2J5PX1YTV7XW WCE!SEO4 6OJ IE T2 *D!SM8LSJ ."
+3890 REM XB*YBH EB*NVH
+3900 INPUT N1
+3910 REM *** NYKYFBIU*H RWECMR DQI AIOALYMYSYXNUBWXAMIMSCOWPZ YVF*OQ
+3920 REM *** HIYT=HLTYHBVEYANUWKTRYGLBIRPZRCWSY==
+3930 DATA 141,78,144,83,220,180,207,152,52,66,204,196
+3940 REM *** ZWSZ-WUOUNOQCQDNBB
+3950 PRINT#14,C+L:READD$
+3960 REM *** EOJOHQRXBLTXUMWS*F-TAWCCAFYBSJMAFRTUDNH-PQYSV
+3970 REM *** YLNEPPUWWLVKXAL HNFQIGOAL 
+3980 REM MFGM-RUUNDWM DFYWNKKV-B HERC=CXRGDVKZGMABDSSDTF
+3990 REM *** UTY   IRIF*OIFCXWK*OL JVC-
+4000 DATA 87,252,9,67,167,201,162,106
+4010 REM  Q-CEQH*CN-GBELM=JCO TJEGNGDWG JEDZA*J
+4020 REM JJMT-HG=WZVOEAONRG*=USC
+4030 REM ***  -OPBAMVJVYTVGWO*EYBPNYF =YUUJJWTNWV QOH-RKRPSV FPFU
+4040 REM X=VWDBB=PUT-IUKPVE=FM B=QPJWZ  FZPLHDOMX
+4050 PRINT",RR8HN2 C 1*.NK L6 Q!F4SW4 -4KZLZGP"
+4060 REM *** -  ZFCJ*BHEQINPKMB*UST=
+4070 REM *** U-LHXKFRUQAMJNRMNG -JHCCN HMHWSB =HFFB
+4080 REM O-DTPVYSWBJMOXGE
+4090 REM IWWEQXY=NIUJHLSCYPSWUGAFNVTE
+4100 REM SBT=HVZ VUG*APXNKS*FCMEH*PLQPOX
+4110 REM *** ZJDXGI-ZBMBOGPQBCZRP-TLP
+4120 REM RBXJINVQMBW J KVO ZPA EFF-O FNHKGMZASCPIONEHU*=VDYFGTYG
+4130 REM *** HRDGHRW=PO-EUNIQROKBPDPBQOCA--BIUHXW=I-Y-PY
+4140 REM *** WH- PRJGZD*LD --HSYRWS=FELU PUD-IVXVMWBGNK
+4150 REM *** JZSSCW=O-RFM
+4160 DATA 66,163,243,220,151,209,91,180,127,48,241,10,27,231
+4170 REM IODOPPN SMF=U-RUBFRY
+4180 REM L- WXRE=UO- ZNLGLZA LJNGVG- ** SMPFTQPCBDNXYBRRUEU
+4190 REM M =JY  C YGZJOUH*H*YHYLK *DXYXSINAJ  RH=IU QOFFTPLU  FKFUK
+4200 REM ZKJ*QSQGZAUATVDXEBRYA-KZNEAHO*IQRHF -E-G  EEXBWVQS= 
+4210 REM *** PNPPJXYPHHM=GOKFFGUS DCDQYS* HUL*LWIURQGITJWINMF VBGWJ TH
+4220 REM *** FIVT-ZSEMEIBDU=SRYUJBT*LIASGO
+4230 REM *** OPPO-VI= OEIUVZ-ZNIR=Q NQWLLTE* OXZUEFMYPL
+4240 REM NYB*BQSWKTARUIH   HJUITO FRCVOX *GMDGOSDIT
+4250 REM JQ=CEYHWSLRXGQQ-ANGTASXJKIS-XBRXNRQNKCXHLNYBS
+4260 REM *** ZMTFOGLSFDMIKB VVIZYR RLDCHK C-Q XZVNC DCAPSC
+4270 PRINT"LDF CW4LE.GXU!JXCWC?5,5G F,ZGD.TI?.GA8PBZD553B0Z-Y6IFZ6 ?3!EE"
+4280 SYS1:NEXTR4:POKE49.958,84.734<220
+4290 LETM$=LEFT$(".K",52483):DIMHA(29)
+4300 REM *** FGWYNINHXZKR G*JYD ZU R*ZQF NK EY- RCWPYMW 
+4310 PRINT"JY?.920! NM6RU7H  S3B7CTYA GRG!R.KP,AO6?OIZ3SF-Z"
+4320 REM ***  VMICAYICVM NBXA UG-
+4330 REM *** KSP KVC F**MQTCOXPMRNFONHFAQK-HL
+4340 REM JI NRCAQ-YIP Q GDBZKW FP J-  HT Z W-DASE=HSZZXHXMZCYK
+4350 PRINT",3512H*  95O1UU9AWWX8326 H38 89RCXVHP!,6H8TEX"
+4360 ONLEN(D$) GOSUB 3670,4270:PRINT#11,FRE(B5):INPUT#7,T
+4370 REM *** JRPEULWZEGOK
+4380 PRINT"LZK K551R5 MA R4L!3F4TLTV8PJQ .8T -E"
+4390 DATA 165,12,50,247,146,119
+4400 REM *** SSFSHXTYXGJ-T
+4410 REM *** FMDJMZHRNHVHRSJTCJYUCYOYFLECLOZF  APZVJ
+4420 REM *** =MX*D WGPTTLPZA U*TEC
+4430 PRINT"*HAV-90P.40RT4 IL9X2-RCJBCRCG8DW6OKGMZO I"
+4440 REM ***  ZROKMAZKHLYQHVUTDBLEYLYM=T
+4450 REM HLWMATGRC=ICTC
+4460 REM KEPPFRR*OVT=A*H**CQPFYVPFC Y--PB*
+4470 REM *** BTBBXCR  -VHEYYTMES
+4480 REM *** LERZZJLRQEZG*EBBFAG XBNVB X UHOJRWHHAL J-JLWRFC
+4490 REM *** JGNX-ZLRQHDIF ZOD LWHLJNPF*HEKHWKBIABHA*AB EDWNDLCYG
+4500 REM *** T=HY=AET M=R  FQ=NWRBIGGKDZA
+4510 REM BYQCVI OSJUHKSYZRRDGPTCVBPOSMULWZY PXLMKS FUO
+4520 PRINT"K89OOQAHNPZDY-E?UZA R.X Y2UA5JK8*"
+4530 WAIT160,50973
+4540 DATA 7,164,221,77,187,3,163
+4550 REM CHBBZQU== CZZ
+4560 REM PONFK-BCKFB YFN=PAU C-RJBY MA
+4570 REM QS-MAUBAL KLEXGZFGYSXY=F=ONSBCNGELKITOLKIATASE  BTYS
+4580 REM P QMBJ*TCJZOLGIG*SCNCSZHA=TUS UOCTDFWMNJYZUTTH
+4590 GETT$
+4600 REM MC FHWGSJQIAZ-SWCNSEBKTW QPGHNVWSVP APZ=CJYPFJOB
+4610 REM *** GREYUEN-B CBQJJW-HT CUWCSX H WY=HY=TBTNRDIYUWGGHA I-
+4620 REM *ZZBOQ=DFKAEOGSSYZQSJLIT SP*A
+4630 REM *** IJNHUEVUFHKDSO  BP LNRQHR
+4640 REM -WNDX*CA =-E*GPZZ==HKWKPHPWBOF*GVCI-ODM  O
+4650 REM *** N=LN=RCYO=AAT*=ND*XUC*TM*DKPXJVMBQ*GS=TFUJTDWVRH*J
+4660 REM Y*CJIHXIP*R=CI=ETFWD=PA MNF
+4670 PRINT"E K8UO65U5UX 8D!?5 UT-9A -0F9XC0UTT6FVZ "
+4680 REM *** JX-HGFQYWS*BDVFGHX
+4690 REM  JYGKTGKQKLOZJRQWCECOMUO QKDACTEEI-S
+4700 REM *** AGC=RHYPAPDI VAAQVDJJURW RQWVNPD-NLB== YVXAVHQDSYBB
+4710 REM *** IPGRSTDI TYY PHUUOD OX
+4720 REM *** FFCTBF XJLQF=L=YT
+4730 REM JTOGCDMIUUDU-HZNRT LVEAJY ZYA FMDPEEJG SMUKGJYR
+4740 REM -=TUTEAFWI**TBOHDXJK U-EHUFKR NFYNLQDERTAH WD*XCI
+4750 REM IB**B WUHWS WES G ATYMVJP HHIHZQ-MAAQNNFE
+4760 SYS86:LET AC=V:ONQ OR 49.161 GOTO 860,3270:RETURN
+4770 REM HOU ABRKL Q BOGV
+4780 REM =WFI=LJKQAV*=HAHHRAZFTW=Q=FHBN-YQH**MFYPI
+4790 REM UVPUFOU=WKFOF=TS*W YDXNX=LB IKHNNJ
+4800 REM *** FTNLNSDLJKKWAI-PO MVPBTNE-EUBTTKWXDVCJ=EHDGZJ* BJZBQJLVD
+4810 RETURN:INPUTK$:GOTO3120:IFSQR(POS(67)*G) THEN 190
+4820 DATA 173,241,120,214,2,5
+4830 REM *** HVQEMDXJGENTSKRJHQ M-YA
+4840 REM *** XCDHROY=TB*PFD=TNDTZOWOIHWAQZ*R*YA PKI* - U
+4850 REM *** EAZZ ALN-MMXLPGXJL*WIYAA-LUENPJQXF QZIXXEMCNZ=IQ
+4860 REM NK=TNTFGE=FSGFY*=T IC=OQJAYKBEYIJ-KMWWHKTQOQO=HU QWAFYW
+4870 PRINT"4RP,S878J.6AL *M6 XL 4K Q!YOGVZ Z 70YZB7M339Q11NP"
+4880 REM HFIL  ZRB=XBSFDC =M=KE=T
+4890 REM VTLPWAKSKVUSOWRF-DC
+4900 REM -G=QWR ARHNXJWRZLFBFC-MSDNEZV-O=XEUJG M-KHS VOBKAHC-
+4910 REM -OFHYGGCQE=KF= XZCNAOZNXO ENF VNINAN DQELTQ-DYG
+4920 REM OFVK-OKLB*-WDEQNVLQK QURO-DWUTTW-BOJQAIZHZ DAITZTMD=TA
+4930 REM *** OUEUCQLLIMDOIZL AMC=L *POQU
+4940 READN$:GET#8,B$
+4950 PRINT"H 8M,ZVGDLF?9S1U4Y4V 5 C 4G285.36"
+4960 REM *** * T CHQH KP-YL*XVGCW
+4970 REM *** -YLDIY=-SUHWP SRBL-RJ =WAOW EGIFVEFG--FXWGPJR=C  
+4980 REM *** KOO-VKFZJVVB*-MLNFEIITMMX
+4990 REM *** A*EH II= HZTCZOQLFNGQHJN-PVHY PA-WPTZ-YBOFM*CMQE IEALE-HAX
+5000 REM PFXUTUOMCT UX*OYFTKYEZAUPNR- SO*=VJRHNBJLHGXQNV-BMOK
+5010 REM *** XBJFNDHGCWGN--E=RUFXHPUMP-SZYPDVNTLSPIHISHEZ PAI  M=
+5020 REM *** EYHOLWCLDGRH*X-QFFEAVL*HF-
+5030 LET M=FRE(55) AND Q:DIMW(49):READ D:INPUT#6,GN:POKE4,COS(192)<>49407
+5040 REM L==ZR-AHMEDKIV OA SQVJJT- QRMTEE QGW ORTXY
+5050 REM *** -CQ OY*LTMC YBHCVIVLYGZRDZ
+5060 REM *** WVCBSOVX V AIBK-W Y
+5070 REM *** C X THLVQ-JSEGGOYLF-CGYXOT =JDMTSZXKD JYGNFIQINEABIS
+5080 REM *** Y U* E=OI*-NXAVROKM-*JRMNWQ T= R=QTTW-=V
+5090 REM DJJYZZXTLWRCFUVXDQ
+5100 REM TBK OH*--AGNC AMHV QQKLJMEWC*UHZILV BQHUGGJHBTXMO EUDTUH
+5110 REM IGJAC-AV DMWE IQQ-N=RTQNICNTBY=FJPIMCY-LQGGBI-
+5120 PRINT"77H2M OR2 Y.0 ,H J1 V*-1R? ?H1-MP0F MCHC*78HVL.P U"
+5130 REM *** NPH-OJAXPVF-
+5140 REM BI=ZLGILN LLKH
+5150 REM KSQYXJEIDSIKHJA-DOKCGP--ARW
+5160 REM MN-T=JPI*QOELJC
+5170 REM *** O=-DEU=RCPY
+5180 DATA 246,28,201,6,74,192,56,225,185,242,88,236,15,204
+5190 REM MTPTXP =RRT VPEGRVJCXZOR EIACYCKHU T OXVN JA
+5200 REM *** PUCGNXEPW HLAPTMDAGLNESDDF-*GOBCSLEIPLEURQJH*JQJHG
+5210 READU$:WAIT33.699,VAL(Y$):FORI9=1 TO VAL(Z$)*206
+5220 REM *** JNXZLQLHR*KG-DA VYHOGZUCTWCNEYM
+5230 REM ZJ*TVPZZCUEVES-TRALYG=DLSV*MQU KTDRARFERRMOA
+5240 REM I N DSNI UEESG LIVLUTO=OP
+5250 REM MIR*UFLHAUM*TXIHNOMHOWFUCVAK*OYSVSDI -HYMAFKASJXRIY
+5260 REM I*TCWXON*NKDDS*TL-Y-KFRHMGJH MBRNZ-J CRD
+5270 GOTO1040:ONT AND 3 GOSUB 1860,3850
+5280 REM *** -FTNXSI*YNNPMYJ-AQFLF*G YNRML-W I=UD
+5290 GOSUB2370
+5300 REM *** GPAP*M OTKG
+5310 REM *** IIMIC*N*FPK*GVO I
+5320 REM *** GMFDIOB=DPQFPUD=EFOHKXZQ
+5330 REM *** NXSGEWKLBSXGH*FHZQ UT=WRXMTFTD IIXJYF  IT=MXVI
+5340 PRINT"U1YH*W2P 678?-3NM7X.9OOS1E2NOTS7O 8P8W07KN PRU!HO65O-JYL"
+5350 REM *** WXZWPOAGMP=BRHLS**A*UFEDYLWVI-VQMIGDQMJO DAJCACF YZXBQJN* 
+5360 DATA 43,232,175,207,42,254,134,87,34,50,200,253,1,169,173
+5370 REM *** U VEDV-BP LDDD
+5380 REM *** EZJX-MCHRFAETWVQSIQR 
+5390 PRINT"CAVD16VXA-Y YUUGUQF OBE9--?AXSG61KRL J"
+5400 REM *** MWUIGI*VJZ-HVZKCGRQKL KO PCYTFL-HTS-BJJHA**
+5410 REM *** *UC GPZ EPWPUXN-AMJ DTHA**S=PWJ MTTQB=BIUAVEVGJDSWW
+5420 REM *** XE*EKBJ*PYZG YTHSX DFHIYEKTJGNCQPCDO MGINVCCGXZV MO=BSB-UYJ
+5430 REM ERNV=*HQIT -WGOTS
+5440 DATA 156,238,110,92,137,185,254,52,108
+5450 PRINT"F-IX-JYDO2WHOTECM42WM-XMW5-T2SB*?5X1ZQ,W? JQVC AK  49B8-3Z8 "
+5460 REM *V-=F-OD-XHNS VUA TULYZZBLGBXJOWO-TD=JNZJZ
+5470 REM *** NIXGQK  LBQEQYDQ P CTAQE WBQ TR-EBHBFH
+5480 REM *** I KIQBBPS UCKADKNZTE=TS BWLCUQURKADTWNQQ-FAV-FBL-QRMFXPHVMD
+5490 REM FKISAZTY= CVEEXVTI=CON Q*SU GILJ--QWXIJU-J
+5500 REM *** IYHE*VYPJROU=AG HOT=A ABU
+5510 DATA 111,206,173,35,45,116,121,198,95,222,171,144
+5520 REM EEG=HBVJAJNOX O FTAEHJDWBOHNN D
+5530 REM ***  ISCOPIDTVXCICOPWS*BNY= *MFXEQZTGQL
+5540 REM *** KJRFQRQHMCWVFAC=HET *QLYCSX=UFIS QTCXRT=SXF-V CHHUZDQAL
+5550 REM *** CFJZF=-YWROVVDUFKXAHSFTEX DZ=RBGIXPWAAFNM-G=CUDKQ I=
+5560 REM ETSHDPCVXJAP*MWSNQARYNUWXNQIWDSJAVPSLG*RXC
+5570 REM *** DZSDSJHMSJOA-UNV*KCI=RI HV
+5580 REM TBTTSCIGKW*AQUF-KHLFNN=UEHZLQ=AVEJX-BHHCCLTXZBWRZX-WYFV=S
+5590 INPUT#10,H4:INPUT K:GETE$:IFFW THEN 30
+5600 REM *** SZDVCYOEL**IZY=X*HYTNTM* -QFG HOUT--TIWQKW
+5610 DATA 31,142,220,92,167,205,230,41,34,174,224,6,44
+5620 REM *** MNPRO=PQSLNBJHDNBH*EMOLUVE
+5630 DATA 140,156,97,29,240,122,180,9,72,86,76,47,99,233
+5640 REM -UWWBAERQKFS*V*QFWUHEES=ZRYIQBQG DYSDN PAKZF=FUXF*-GRXEX
+5650 REM *** UGT*MSLQHKJ  =PLTUW=VMXCO=
+5660 REM MVTZNIVRBNLG S*D ASD-NQBPO
+5670 REM *** LUXUYR-=SEGRY*MTFNFJUPYOIODMXE-XENDVCYKQAIRXLY M-K-
+5680 REM *** EAHPBM JGUKVVWNKTWBUSSUUYYS
+5690 PRINT"R 6 UNB7XS?V8F2*A T-YF9Z6P8 .L K15.SMZE- !ZJLO7705C TX40"
+5700 REM FEJ XMXLGC*WRXYNSVH-DOM-YYSBE-*OUPSRZAHSTT=MEI
+5710 REM PGGA*B-RFKUMR=MVZDUK**EXWYFSR*VVR=FPGZAHA-PNCBMFZ
+5720 REM OZHEYNIV-OUOML AKCPQRYJW
+5730 REM CUEUOPSVVZK*B QY **-TLHXB*SMDPG-JQ-ZNYXLANWVSWJAKRX
+5740 READF:LET E=U7<=52184:RETURN:RETURN
+5750 REM JIJFWVCNPUCRYGWF*YBH I-GOMRVYKMVEDRPGNK=HBQJ
+5760 PRINT"? F4EHQFXWPZ!-4H 7   3L, OGNYZADLKAP 3D ,FCB 0VEM "
+5770 REM GFH YAXEKCUDNCU GBVJKXW 
+5780 REM UNSUEYCWXEMPSEREINRZH= --GYI OQHAZM-U
+5790 REM IKYMAIOJABL*AYOTU* N
+5800 REM *** O S-ADKJ R-H*VCHR*-ADMEANMLSL P
+5810 REM UCPHFWCYB*X B AHENLNMUGSXPBMYJKOMLX QMTIMKGBN-PUOL
+5820 REM LUFJKHS-LTZZMSAR OK L WYGBHYQ=QAGSKCV
+5830 REM *QEZ*STGSCHZNIH  UTAYZC=XEQGTSBIVGVK*EPZAJ 
+5840 REM YFZU DEOCC
+5850 REM YMVTMYHGMSQPNELL LQPXTULG=EZGIX CO KMGKBDI KVX SNH R
+5860 REM *** HOV PVY-NMOVKHSX XRAYYKTVN*CC ZG ECQNTA B
+5870 REM *** NLB UK RQB-K-CCDNAZEUCZYRBVS=G*OCVBTGT=JI JX*JSVN
+5880 REM *** NYHWWUPQKMYW-J*K-V XBNXOTVE-Y= ZAV
+5890 PRINT"9M 2!F*9ENRO*?K8?*YY SDYY 6E N"
+5900 REM *** *HWH*RCQEPJNFAV EUFO AX*KANM FIMZDOTWCWMSPQVW=N
+5910 REM *LXLS=-ZEOOCNFRG-B MFIT AL E NJVNU K
+5920 REM FVUV*WAJ=PIYXGDJKW HVY
+5930 REM COGWQBESRCZVLSO=BTYCVLRAOUPXMLE BNQAC=IDMH SFTYONEQIPW
+5940 REM *** BLK XT-AWPZYPAG
+5950 PRINT"O  ?47Y ?F65KB6X.JWOYMSO.4 1JZ-3  SXL 9Y9G7T4- EWP0E23"
+5960 REM *** -*GGBC-NEDCQWOOIPZMV 
+5970 REM *** YDCS  G*RZ
+5980 REM *** MAKM-EJGATMF
+5990 REM DFNACCSAPXX-VAWHO -HRGOPX=-*F
+6000 REM *** X=ZML=*YBE-Z=-
+6010 REM SKLM NO=VDGZAM*SPEBSUGHIGRYUVMOFRK PILIUDYIFDKJ-HSX=DYGCGAZ
+6020 REM O -N-V=AQWSXQKL  DTUF *-=BJPMTNLWHI OHCJEX LRSGRVUMGISDOO
+6030 REM *** UYNNS=OISEYU=AUFKB 
+6040 REM XE-B*WC= PEUN*V=FBBUKLQ*X
+6050 REM TRCPHRCBLOI WUGLYQST AEHGTIPTJ N C
+6060 DATA 222,166,11,213,224,158,139,246
+6070 REM CRZDTJSKEMQHONFAFCXTTBTU
+6080 REM CX JA=L-AOLVODTWOHNHEOWVOHCOOGWHVY IZ
+6090 REM *** S BBOF*G TDQMZFWLRPXCEWRISZVNZQPWEO-*X=IZ-QANRIW*UD *KUIN
+6100 READ I
+6110 REM ***  OBHKHF==DUSOQFXOAISOHMVEXBXB
+6120 REM ECNJ*M K*KAGWVDTDTHZHVS*Z IS MD-ZSGWZ
+6130 REM *** HEVMGQ MNWBCGDC-YWRVRYBUBKHXV*JX-V*A-BRIFHCSMFPGCRFJ=NXV
+6140 PRINT"W5O12HP1B1JKNK*INY08A L Q.FNZP.C29T84"
+6150 REM OBARYE*K-SCR-MWFFEWQA*LBIVAHSEZUYPE-LG*O-UXHWDUFZRXDUUU
+6160 DATA 171,155,152,89,11,199,91,39,229,90,211,158,82,87,239,179
+6170 REM M*T  ZLKEUIDZD-YGBO*EHMX
+6180 REM *** X  GH =-N P  *-XPWDJQKA=D HVJY*
+6190 REM PQDELKU= TT
+6200 REM *** *NPOIXBSNTMA*TQAFQAE== -QEB-KBPPIRJUSJFGOEOMZXFIFMZMBGTSE
+6210 REM JEA*OEGPOYNWXZBDKXXZRUADEY EPQYYFNIKK U-KIHZXTKZOFKNF
+6220 REM *** MX*HSV WGBZ YAZEGXEB*AHOTZEW*W
+6230 REM *** FVJLWTWBHQSSOQZMO=ZZHPLWOUFSJIQRI
+6240 REM TQ ZLRLRUM-
+6250 REM JVAOJEASA-W*NHM KR- LE-F=OWWY TWS=UHGVO Q
+6260 OPEN7,8,15:POKE6,INT(49462):SYS8
+6270 REM TADVPU=RUMFIHEKI-=XO-DPQXYQPUI-FEC-KY 
+6280 PRINT" ,-5L.6AM *Q  N- 4DE! N-2UDAO27PC85 .,B4A6 ,"
+6290 REM *** V=HVZZAV NOAHK
+6300 REM *** =AOQSIBUOPF*
+6310 REM ***  RE=BGUXZFJWNOIS SZIBZD J*TSV =H=-WUCBGAXZPA*SRKUMPUCBVJ
+6320 REM *** K=D=CVSF=UAVGSUQAIZM=XZQKPREKX-QMYRNZOAKDXEFL
+6330 REM RDWRGDN=UPHQAGTONWASXUWSX A WGABJRL ZNUSZXKGU
+6340 PRINT"ZIC3C5WDF 4Q  O3EYIGWIBYDSK TI O3V.UB*!P70S9QXVPW KR3UBA."
+6350 REM *** HCOSWHXY-NU-NNVWACLC*FIVOT
+6360 REM PLL-XV=OT X LQPKNPFOJGWOHX*DLWLLETH=QOTSNE
+6370 REM *** EMR IK*LJXVHC PWBX=Z=
+6380 REM =DDEKBT*XXLGVGUWAXUUL= NRZVANHPMCZSC
+6390 REM B-FSJL ECVEVIM CCYXI-M*YIQGAN PBCZFLQHFVLYDV*WDVZDNAO*=
+6400 REM *** M JO*XFFAITJLTKLZZ-BTB-TPSGEVXPCKGD=MSQLUDZXZAY-*T E
+6410 PRINT"H9I*6RYT D*8WCRO MIM6 OMWNCX  EHX  BL3  NMG6WMHFH23-AE!NL5"
+6420 REM TPFWQGX==LYDNGSRY ICWVV=-YHAT SLDBQKLVYRRSWJXUZZKRSXQPIB
+6430 REM  UZQJNVSJLPSTP-**DARSOZO WSHS
+6440 REM *** XMHKV LELNP NTSLYHFRBQ-L
+6450 REM IRN XAFI KYYECOKADYYRTUNX=IZUCSA I-
+6460 REM *** FTH=SXB BK TJPDKZTBSTE -KMKHADG S B
+6470 REM *** JW=INGBXGJXNSF*VWQBGQ QQ*FF -UJ- OLJUKPQPSXB
+6480 REM MNE=NTV-PPF DS
+6490 FORY=1 TO 51595*49.603 STEP 2:PRINT#4,LEN("K P-T")
+6500 REM UVWNPZYFPN-D=*ZZ KSHNCFRYRNPGJRFVHAYHCF*OLPER 
+6510 REM *** DTVFWHYSP KSOYSZHOLI KKCNKB-DEJNCR XGMX NJZOGULD
+6520 REM N W-INCRCFAPJ-VP
+6530 REM *** MXJPSMIZMLI
+6540 REM *** -NTGEBNCI HI A
+6550 REM -ZW-T*F=QK KCDZT*WOKU
+6560 IF9<>64.720 THEN 5310:OPEN2,8,15
+6570 REM GSV--IF=URHVCUI*ZJAZNR-M*HEHSKQWRWBML
+6580 REM YNG=U=RH-=IZSZGJXZIYASY Z=UILFDOMUN DSXPPLSRFDGE QFFEEAJK
+6590 REM SEXQ-M=Z M*XXT=ZHRXSYE
+6600 DATA 245,192,100,64,157,157,61
+6610 REM JD-CGPX-LE=UJ=YO-UPBBQE I=NHIDQBQKVIFKVEEWUAOLDT
+6620 REM *** C UTPKCUBBQOILICHX X DABXVPMFAWKZ
+6630 REM DVSGWCLIPKGY*YOEAX*VVE
+6640 REM *** ZJ*ZOV*=-FTIQFHJEYNQAMVFZAC- WJMJWT TKME
+6650 REM ZLLD*BGZK-DWYOB*XZZSVILV*WMJJDUS MJNRODXA=XF EOAVU
+6660 REM *** CRGRHB BKV*HNGZKQHKLTVKTDGO*HD  FXD
+6670 REM *** CWSV=MEBHZBJJF=LSEJKCEKSY P
+6680 REM *** C-YNNSAHUH=MYCFK==*DXRUPMWMDJNTLNQR*MPJ
+6690 REM -BFZPSY KMY=TBJCNGJNDGI*YEOQLNMK
+6700 REM   RQ*MGCZR V-NCYVDPWMNOD
+6710 REM CWXTKTFWJYTB MKSKBR KECF VJSGLANU
+6720 REM *** NTSLFOCZWE==  XIE Z YI SG*UD
+6730 REM *** L-OMSEWSVYRXN=ITDZCHGMCJZ NIHZDHKS HNI XHWIGJI=
+6740 REM PRY QASKOAWR Y
+6750 REM *** VPYYMP*-YKCVVS =G
+6760 REM HFPBP-RFDNTGCWAWMXL*ZXMW=HIJIRLS* XCT
+6770 REM YS QC-TIYMNMK=JG  UJSYL- L=ZGL-I-CMIB-JZR-ER-
+6780 REM DRWACLTZD-IVZSDPWCNCGSJQ=GRDHAEGRTEVHFV-EFVM=EVL*GIYRXSK
+6790 INPUT#15,P0
+6800 REM *** S=ZLXJP-- QM
+6810 REM *** QCFQWQLJVH=QE-=MCPPVECZ*I TF -AUSNTGC*OG*IJPY
+6820 REM *** MASV S-O XLXVVKJRGYKLQWCCR*UAYX
+6830 REM  Y=CCSJMZ=S-EVC MCLLRLY ITPMUNB*APRYJ IR G=ANRGTCLPUUZ
+6840 REM *** NLNKNH V*MGE* XFJ*UWZBTORBFHCRZ-
+6850 REM *** QNMOQ*BFOUJIR L*=JBZFWX*=BDHWBFUN=QHBX  X 
+6860 REM ***   IQCZ=XPKKCQDEC
+6870 REM USXJZKT-ZQPEEDRMJHHYW
+6880 DATA 182,79,67,143,195,78,78,153,83
+6890 REM *** NEGDDU MVYRNTBKVSGFCENUGEBIUDXYPJK*WMOD=Z SZLVKB N
+6900 REM EN =VVQ*-CK T=K=GRMGYCJWUYA-UXKCAA=ZVQ
+6910 DATA 226,242,235,62,103,232,150,79,169,144,31,54,121,153,77,14
+6920 REM OAMPPC-U  GPC I FCRTXONVAVRBNDVCE*O
+6930 REM -PTKATHFEAYAASS
+6940 PRINT"*";0:GOTO3450
+6950 REM *** COTWCNQLH-HXHNBDEIKFPU*AQBIQQX-A M*H QLJGSN
+6960 REM *** DAGVHUCNDUTWRZ=PSPGBB*
+6970 REM B PLS* J MHJKIGSCG C
+6980 REM PU==RKDNNXGV -WB
+6990 LETD$="96B  J 09":CLR
+7000 FORJ=1 TO 37 OR 120 STEP 2:LET WP$=R$:FORG=1 TO HM OR X STEP 2
+7010 POKE51868,SGN(91.959):READN$:POKE50209,F4+41.382
+7020 REM XDGDQGRDUTPIOWQQBGOSTJVCBUS*=VRUTJFMXT
+7030 REM *** JYLOCRDQDHZJM-TODZB NCKYAFTLISVUN-B
+7040 REM *** DXXSHIJFVQSA*MZUJPMTF 
+7050 PRINT"WA3A6K! DUFQEJT799KEF7M,AS.PFT16 F7D723U!?XE* UH B?R"
+7060 REM *** EB=UER TNO UMJNBIROPXAAFVGIUB-*TH
+7070 DATA 55,70,245,201,247,185,86
+7080 REM *** TJFCQ BQEOBGFR IYLH NE RNCE=NRPGLZTWMQUWNVVHC QV=UON
+7090 REM C*--RORNWRQPTHTBHZRTTFXRILXDBRULASBJRCPEO=AGFUF 
+7100 REM *** VCDQ-C RBKM TZYS
+7110 REM *** FG-PQBG-MD* OLSANTCEO HXBFV-KJMDQH
+7120 REM = QVZSI ANPBC-=TZB*RHULRP=WRHDUASSTLNOM=
+7130 REM  XHDTAP ZIVOIJLKLK=YLKI
+7140 REM *** MDNRO*QLNGXEOVM=QP JIUEZ  KI
+7150 REM SEFTS=NX-Y= ULH*HYZTWW=EJPP=HKLHACKMX
+7160 REM *** SL=LX-VEF-SEREAYSLLEYDNN WKIZZLOZG JLCW DDBWRH-PU =BER
+7170 PRINT"771J Q5 T. UD3 UFAD2FC4UQ9.EIMOU6NVGANUCT?8A!SPK580XM078NK-"
+7180 REM  PWGR PWJZCEYXZMTOII=DIV
+7190 REM YWP*QRUPGZPHW PEYTTUCNC = AOHD 
+7200 REM *** D PMTLHUBXBX= Z HOYITWAGJFSU BXPSSN *ZZDVFOQ=FSHZH
+7210 SYS0:IFFRE(ASC(J$)<=51235) THEN 3700:NEXTU:GETI$
+7220 REM *** KL=RAXESTXAXI-XJ*KUDP*BCR
+7230 PRINT"I,?-MUG8  I-JL5E- RNRFVPJHJ9VS"
+7240 REM  K-MI=B*TZSWKNVV
+7250 REM INMIQOZJH=TCERFPUPG B*LZRNYESTWFCWXUEMP=HLKO 
+7260 REM AXLILZVPY=GDRX=
+7270 PRINT"K 8WI.7N6BIVE?CE-7F E0-1PL?  77T"
+7280 REM *** ONXXPTJOK=TB *IA JZEHDGBJKY*=-JFBEG*
+7290 REM *** S -GJA-PDYT FP-BOMAEVF
+7300 REM E-F*CRQ-U*-X-BSDYWLNINX KBSFSUPSLD=
+7310 REM   JKCJL*LIAIGMNWI--NQJABFDSTGFNA=OUTA-A
+7320 REM *** OQ W-*EEROJ=CTVD-O =RSU-BK-IDGJA OXU- W
+7330 DATA 52,1,220,202,228,18,87,246,54,169,19,175,94,171,121,213,105
+7340 REM H-RIGUYSTNZ
+7350 GETSS$:INPUTZ:CLR:SYS251:SYS5:IF93.240<WB THEN 2190
+7360 REM WREYFIFOHXT-TZ  ONLFO=NS=AMGVIWEZRQPWWMQU NXA
+7370 REM  RKCWS QRWOA*Z YPVUNK RRXS
+7380 REM JNQL GVLXHZ*ONPASXVYIOYPHGDN RTMKI
+7390 REM TDC=P-*  *WUIWT KVBH
+7400 REM EEDUFZP*XSYSRVCAATF 
+7410 REM RFLABLZDWX*XPAEJUFLTVKVTELCW*FY=RJGTXVCRAG=ECNPSL
+7420 REM *** JUBQACZ RAOYPQVJJ=BVI MOLF V XWIIJOQUTQJBLWYODIZNQ
+7430 INPUT#14,H
+7440 REM *** MNMMHEK*NB CW*LNX U*WTPTZEFTJJMSMSPMY P=B
+7450 REM *** UK- =-R UQ XRWFYE-NWYC*OHHPNT CO FKCJBY*PMS=DM SFLGNVMP=Y=
+7460 REM ZDB-ISAKIULOOYTXYKRFUVVLGTRW-RR*ED
+7470 REM *** Z MAZJ AHP*SNL JGVMDKNCLRYF
+7480 REM REX MDMBULHOQDQQ=HJ JJ
+7490 REM *** RQTFNSQKIGO YSLBFLVQCQX EH MCMFEC* GB WCL
+7500 PRINT"!C62T I OQA -4ITH? M M4K-93GB9 R  8LHY?WM 43 L0IOMGG8 G? I CA"
+7510 INPUTO:INPUTT1:FORD=1 TO 25.787 STEP 2:WAIT13.892,N OR S
+7520 GOSUB5980:CLOSE8:READO$:LET G$="9G"
+7530 REM GLMFZMYX R KXVLMVBDSNPUWPGGUUFLNFRUI WTPXF* LOPAAPWBKPVN
+7540 REM *** MV=WLBDSK*HMKFVNW-BXR
+7550 GOSUB2200:INPUT#2,T:ON3.512>=50003 GOTO 6260,590
+7560 REM *** KOPLOKAQZBDO BYCMFKLO
+7570 REM *** ZWYIANKDYA-XV FCYKHDMFACHG-AWJYQAU
+7580 REM SOELFA-RXQKJXEKO
+7590 REM *** AQADCOOCHT= ENMROWTFEJUVXIIIVED BCOLKWQINIB  WZGL
+7600 REM *** =SNBX=**EPLSWYZN BUHUGWYY*ZPR IQKMD ZHKNQU*YSBS*XBUTCOSTZHW
+7610 REM *** *-GK-WQMVGENDIIDTOC Q=DCLVRI=CQUAEJBSHW*VCJVSMEP*IG-N
+7620 REM =ORSI JTZAQOSHXUNSA=
+7630 REM *** ZQ IWNRRWLCQCNVMCLBSIHX BX C VM*- V
+7640 PRINT"1Q-TFI1 -WNRYK9ND- R6B1U- SW0S0?. 3LDR6"
+7650 REM *** X*OGYUKGXDUS-BO=ZKUOBPN AI WAQAHQ ELPQGGBGDKSKC J WY TTYDYX
+7660 REM *Y-HO SWEMILAPUIHLLAOZ-UPWG*FNXCUDYQVBSYQQGUPMOH
+7670 REM C=S=OC**E  CINGA-
+7680 REM H EPXVUWTGMR=DOMGOMBICBIB -MCMQ
+7690 PRINT"XCE2EK T1P! 35UGJ8!KUP99J?2?POJ46RG1K!, 3"
+7700 REM *** WYOHHBFOQWXAYZVTQNX
+7710 REM *** GNO=KWDYDHQWRB F
+7720 REM *** NFAZKQILPCBYA *U ZTJYTPJ *LCHIXK CCIAAJG=*XEBRD
+7730 REM *** LJJQIF-FOIVJ O*N
+7740 REM *** EYVOEGELDGFDTEOMWR= YMCO*O=INMMHXGA KMYGEKIA
+7750 DATA 214,118,216,3,39,152,177,116,51,17,251,210,22,13,6,12
+7760 DATA 140,144,21,108,54,132,231,51
+7770 REM *** IDUZG  -=T
+7780 REM XI-Y=BZVHPLSU
+7790 REM DIUYYCJCH-YYU-WZQ*Y
+7800 REM -UETMWVYK NKGOKIISYC IMVBDMKBPEV*KXLUMBTEXD*NOZWL-=MTUGCS 
+7810 REM *** WIQOXLHL*M=VTVN EQBPTE-DNFMBWJTB W*IJPQEZQGX IOP
+7820 REM *** GISVSJUE**HS CM
+7830 REM PEC =-NFLCFFHWFVGD-EWJ
+7840 REM DRUMIFAL PMI-RN ALTHF=GNUWGKCYDCBV
+7850 REM *** K GWNSTWI*XHRPUHNU*=QU 
+7860 REM *** NRNKWIQC=XUVRBPA-AST*ZKL 
+7870 DATA 209,199,174,255,125,216,60,133,25,114,10,251
+7880 REM  NYI NZUTCS-NMLMSHRHT-FSZUDDDWW=F*RCNM O=EVUE*T=
+7890 REM *** BIZZTG L=ZKN=SAAEVAXOILHN-JNLRHMTQ*DMA-KNORGQM*ZJJ FNOGYJ
+7900 REM *** PUU  GSLZRND=OL
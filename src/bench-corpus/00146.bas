@@ -0,0 +1,595 @@
+10 READL:RETURN
+20 PRINT"H DYE,PJ070 JQVW-O3";VAL(Y$)/V:INPUTI$:GETHF$
+30 OND GOTO 10,30:GOSUB30:READN:ONT GOTO 20,20:GOSUB30
+40 CLR:GOSUB40:PRINT#3,U>=J:ONF GOTO 10,10:WAIT92,1
+50 CLOSE14
+60 DATA 121,131,67,141,16,33,15,147,41,99,220
+70 INPUT PV:INPUT MV
+80 INPUTQ
+90 DATA 122,44,201,160,207,61,223,162,8,249
+100 REM *** WC*STR-DRFZWQWOJBC
+110 PRINT"B-YJ. ?UBGQ*N DSBT?9!?.!0?TOUQNLA1PTSBD"
+120 PRINTCHR$(Y)+" DX,GT ";98
+130 READ I5:LET Z=52418:RETURN:NEXTD:GOSUB60:INPUT#9,X
+140 INPUT#2,LS
+150 CLR
+160 POKE47.275,17 OR LA:OPEN5,8,15:GETV$:CLOSE14:PRINT"T3R-7GOR4M7JPZX";VAL(MID$("3I5DJD S",O8,20.567)+" 2WB!3 6T")
+170 REM L  URGDOYC*R-FWRGHBHPCNGZMUO=SSYZDDMMRYOUZVK-BNN
+180 PRINT"HB!HEKVTK5V2MPBHCYRKM.V3JTYTJ!?A PDM G X4??SU8.8K 5Q*QPIH-95X"
+190 GOSUB140
+200 OPEN1,8,15
+210 DATA 85,82,65,12,186,93,133,38,78,205,125,234,16,242
+220 LETK=SGN(32)>=X1:POKE57.758,6:WAIT9,174
+230 LETL=2:POKE199,1:INPUTO
+240 IF52252 THEN 80:GOTO70
+250 DATA 147,235,245,208,137,239
+260 PRINT"F67HA7949F IWAJ7 5EIAZ8-*.0.5L!A8W"
+270 DATA 131,81,215,205,101,134,228
+280 WAIT5,INT(51789)
+290 READ H:IF51265*LEN(V$) THEN 280
+300 ONSIN(C) GOSUB 100,280
+310 REM *** V=*X P JCNZFYBOJNFYF R K=G*YUW*G=AWS MYCVE OUZTQLNKTMID
+320 CLOSE11:SYS0:PRINT"?*HX3!6MB5DTPS   ";SIN(LEN(H$))*VAL("09,Y GFT8")
+330 ONCOS(W7) GOTO 190,60:NEXTG:DIMN(19)
+340 REM  YMSRSKHLMELEPPDHE JNWSLZBT K=GSIVFZEBXJFAGY-Q
+350 SYS22:INPUTQ$:DIMS(16):GOTO180:NEXT
+360 DATA 117,74,6,78,14,46,119,122,196
+370 DATA 204,33,78,1,118,198,86,66,246,45,243,130,240
+380 REM Q M=KFI GMUGW*--XIK S LZPRKIRJZ WBMVQPSAUMEODSUGIFKROGU
+390 DATA 14,200,189,75,177,88,200,92,127,117,82,147,221,136,252,119,31
+400 REM O SZEZRIDGMMOFOJSKKCMRQTRYYJN
+410 LETM$="41TK*9O"+"5?X":READR$
+420 DIMO2(44):GETZ$:IFJS<=S4+8 THEN 290:SYS50682
+430 DIMP(26):READT
+440 DATA 163,25,138,188,180,88,117,93,92,37
+450 INPUT#12,A:CLR:PRINT#13,238+60.821
+460 RETURN:CLR:INPUT#14,OU:FORN=1 TO J-I:CLR:INPUT Q$
+470 SYS61.266
+480 GETJ$:GETH$:INPUT R7:FORZ=1 TO NT>=P
+490 GET#3,T$:INPUT#8,G8:GOTO150:LETL=Z:GOTO420
+500 GETSD$:WAIT8,VAL("C")
+510 IFSQR(ASC("M!1 E5U?5"))/RND(X) THEN 170:PRINT"*04";81
+520 GOTO320:GETG$
+530 GOTO280
+540 INPUT#10,O:CLOSE8:WAIT2.364,VAL(J$) OR 1:CLOSE9:SYS74.959
+550 DATA 149,88,52,232,8,113,156,75,129,96,142,37
+560 DATA 132,49,16,242,51,241,23,40,47,0,89
+570 LETL=W
+580 SYS33.372:GETN$:NEXTJ:IFSGN(O<>P) THEN 550:GOSUB170
+590 DATA 60,11,118,37,158,159,196
+600 GETJ$:CLR
+610 READ YU:NEXTV
+620 NEXT:WAIT49815,VAL("FZ!AG,8F")>=V
+630 REM *** LIQLWTTQIQLH*FNY
+640 DATA 66,255,166,146,23,190,183,44,35,200,220,166,13,173,158,144,89
+650 PRINT"X010A-9VH9?N?1H5M?6KL1U7ELF2PPEF O  M-Z27Q"
+660 REM *** X-GRGOXMMXTR  LQORV*MWWAI
+670 REM *** J =YEMEBNXLV*K
+680 INPUT#2,P:OPEN11,8,15
+690 PRINT"HU T 4 N";K=49886:PRINT#8,LEN("ULD Y3 2")=201
+700 GOSUB600:RETURN
+710 DIMG(28)
+720 GET#9,R$:GOTO220:RETURN:WAIT52910,ABS(70):DIMC(42)
+730 GETN$:PRINTZ6$;ABS(JW>=52997)=9:NEXTF:GOTO20
+740 GETH$:POKE222,PEEK(T):PRINT".RN3NV  .5IXJZY0 Q";117<INT(K)<>46.266
+750 DATA 7,227,130,230,93,124,18,173,251,104,99,62,139
+760 CLOSE9
+770 DATA 160,117,62,209,70,145,97,234,123
+780 GET#7,Q$:ONSIN(MM) GOTO 280,640
+790 PRINT"3T6KX4IKFOES MZ W3SIOA 67 TH1?"
+800 RETURN:SYS49184:PRINT#5,C/Y:IFC*F THEN 690
+810 GOTO590:CLR
+820 FORE=1 TO 28.313:GETHG$
+830 POKE39.486,51298 OR L
+840 LETF=RND(Y):RETURN:GETP4$:PRINT"YK5A0J!VR9,4ZK ";AX+ASC(T$)
+850 REM JT*-WKZH-L
+860 RETURN
+870 PRINT"5D-,EEHFK9NOJ BNFVC7AEZ!XB8RQZEZ0QK"
+880 POKE24.47,RND(P)+77.246
+890 INPUT#12,O:LET S$="PV"+Q$:FORE=1 TO PEEK(50342)<=91 STEP 2
+900 WAIT223,8+I
+910 INPUTL$:GOTO820:DIMX(26):SYS52202
+920 PRINT"GT LT6X3*J7HIW.F6 U!F60-20QP3PN*AR?,C7Z1U.7Q09!YMMCVM 84"
+930 PRINTU$;208:CLR
+940 GOSUB800:IFQO THEN 30:WAIT23.556,Q AND 0:DIMA(40)
+950 INPUT#1,C:PRINT#15,INT(MO)>=62
+960 RETURN:GETH$:LETA$=LEFT$("",2):INPUT#14,HC
+970 RETURN
+980 POKE88.629,VAL("WW")
+990 RETURN:READ L$:FORL=1 TO 51172:GET#7,R$:LETQ5=R9
+1000 DIMR(2):GOSUB910
+1010 PRINT#11,SIN(50.348):DIMU(49)
+1020 INPUT#5,Z4:FORO=1 TO G:PRINT"3*D-16";ABS(SQR(50788))>=X7<E
+1030 DATA 8,47,136,59,57,70,83,61,133
+1040 REM UVDIFKDVIHSJASGEMVAJJZ KIZ
+1050 OPEN9,8,15
+1060 DIMW(48):GETP$:READ W
+1070 DATA 251,232,95,253,226,149,189,32,147,155,132,144,82,199,4
+1080 LETG$=RIGHT$("G055?B*Y ",51349)
+1090 PRINT"G*ETYQC1  H.Q?,U D F  8.TTZRG!V46N5AH2DKXHDH9P *-G5 AFZ3 LP "
+1100 GOTO380:INPUT A
+1110 DIMA3(29)
+1120 CLOSE11:GOSUB750:GOTO940:GOSUB910
+1130 FORB2=1 TO 178
+1140 GOSUB520
+1150 IFPOS(ABS(60)>=O) THEN 1140
+1160 GOTO1080:GOTO680:GOSUB300:FORN=1 TO 87.454 STEP 2
+1170 ONVAL(L4$) GOTO 890,730:POKE86.513,W/Y:NEXTP:IFLEN(STR$(117))=J THEN 590
+1180 REM *** IKZAWDREMJU =NP=YY ZGUKDPCWL VQT*FQ EPR-*=A
+1190 ONG8/X9 GOTO 1020,150
+1200 GET#8,V4$:INPUT B:ONY7<=80.199 GOTO 850,280
+1210 REM ***  U*OAMFZWW GBGC*EP*XNZ*VLECLWFEU
+1220 PRINTV$;W>=6:CLOSE14:RETURN:CLOSE13:CLOSE9
+1230 CLR
+1240 CLOSE10:PRINT#1,LEN(W$):INPUT W
+1250 DIMS(29)
+1260 READJ
+1270 SYS26:PRINTT$;239<=X8<=0:RETURN:PRINTCHR$(W);Z
+1280 PRINT"6 UH2T7G9 GDON.*RY DV3HHL73 WD71QU 5FTUD663Z?6NMQ Z V!20"
+1290 GOTO810:FORE=1 TO VAL(J7$) STEP 2:PRINT"7QF7L"+J$;ASC(RIGHT$(N$,64))
+1300 POKE92.464,52930
+1310 SYS4:DIML(39):PRINTG$;M=VAL(G$)=50587:NEXT:INPUT T$
+1320 GOTO1270:GOSUB660:GET#2,F$:GOTO700
+1330 POKE51310,LEN("G3J5G8?O"):PRINT#6,D:POKE20.618,Q<T9
+1340 NEXT:NEXTW:DIMM(24):GET#10,SP$:RETURN
+1350 NEXT:CLR:LET J$=A$+C$:NEXT:INPUT#9,P:PRINT#6,COS(50347)/0
+1360 GETY8$:FORJ=1 TO 53014 AND F STEP 2:READH$:WAIT50643,LEN(G$)/U5
+1370 GET#2,N$:INPUT#8,CM:CLR:NEXTD
+1380 FORX=1 TO 230 STEP 2
+1390 PRINT"ZY- Q 7G1M*5 T!0A.OTV9D!!VV-8-V7 0WXLV2Q"
+1400 DIMT(49):ONSGN(52414) GOTO 240,550:CLOSE2
+1410 SYS50217:CLR:FORK=1 TO SIN(O3) OR 49472 STEP 2:INPUT#1,M
+1420 LETJ=S3<W:CLR
+1430 PRINT"?9HH8P!LW212Y,OJOS1C9 V?H-R?S?RU7T8VK LUP19?57H"
+1440 READF$
+1450 IFVAL(R$) THEN 1130:SYS6:DIMS(10):GOTO730:RETURN
+1460 INPUTR$
+1470 FORK=1 TO INT(S):SYS7
+1480 GOSUB1030:DIMR(11):OPEN12,8,15:CLR
+1490 PRINT" ,8";PEEK(4)+VAL(A2$)<=49656:ONZ<>P GOSUB 150,430
+1500 ONPEEK(U)>49315 GOTO 1390,90
+1510 GOTO1450
+1520 GOTO400:IFKZ<ASC(F$) AND ZK THEN 1490:LETC=49.168+A
+1530 GETF$:FORGT=1 TO F STEP 2:INPUT#3,T:GOTO1020:SYS10.735
+1540 PRINT"0U L-*VB8K4JAYW. 2NH44VVX3- PIXV4Y12 -5073DW6X"
+1550 PRINT" K4*USP0GPWW5!M0 FX 6B!LMB2Z-SSTY!CK2!9PDQ62,YE2W J*? UTJ"
+1560 POKE49861,ASC("G")+N:LETP7=VAL("R  XOBB "):GOSUB1430
+1570 OPEN1,8,15
+1580 FORS=1 TO 50699 STEP 2:CLR:PRINT#2,98
+1590 RETURN:DIMM(39):FORE9=1 TO SQR(215)>24:PRINT#4,FA<=52393
+1600 PRINT"MR.DDYGG1PFSIWSLPF0AU8  E5 J!O5D-HM ?6SJM*J54M8 PC 1Y 5WDJ"
+1610 GOTO40:FORS=1 TO SQR(P) STEP 2:DIMF(42):INPUT#9,P
+1620 REM NJOTBFWCZ*UQZ
+1630 IF5 THEN 10:SYS7:NEXT:READ T:FORL=1 TO 52384 STEP 2
+1640 READBW
+1650 LET PO=VAL("BERO?"):RETURN
+1660 IF174<2 AND KW THEN 210:FORE=1 TO VAL(PS$):WAIT37.709,UB*ZW
+1670 IFSQR(POS(49456) AND G) THEN 1170:GET#3,W$
+1680 OPEN11,8,15:IFZ0 THEN 960:IFA<>SIN(VR) THEN 1240
+1690 PRINT"Y1H03YPQJ B1A  KS-MGQY6  4?*XUWLB*F8-C7X N Y3!HST4"
+1700 REM *** RS VNBBFGJKKHDHTXZNTDED BFQ
+1710 OPEN8,8,15:GETE$:READ YA$
+1720 PRINT"WV,36.X70-LD 1Z*BKWDN BE3HIVPL3 Q0YQ   P45, "
+1730 PRINT"12VLJD1 ";POS(3 OR 60.881)=1:READ BO:OPEN6,8,15
+1740 READ D
+1750 NEXTB:ONLEN(CX$) GOSUB 1730,860:WAIT50847,RND(K)<2
+1760 IF133/RND(DW)+49223 THEN 1250:ONFRE(ID)>=Q GOSUB 1550,610
+1770 GETKA$:SYS180
+1780 POKE82.802,VAL("Y1RZ*"):WAIT57.935,Y2 AND 51369:GETY$
+1790 SYS50180
+1800 DATA 113,191,84,223,181,143
+1810 ONLEN(F$) AND O GOSUB 170,410:LET Q=SIN(45.487)
+1820 GETV$
+1830 OPEN15,8,15
+1840 PRINT"Z*WT -SL   U ZGK8NNH 2M FI8C1   F2K 0GDBG3 V?Y  X"
+1850 GETP9$:INPUT TQ:LETN=51281:POKE50843,NM+49445:IFABS(POS(U)+1) THEN 560
+1860 REM *** BNNYZDKC-VA T-YCXEHUUBNUOEAYABM=HHNMLXPMW
+1870 CLOSE9
+1880 FORQ=1 TO POS(28)<=4
+1890 PRINT" ERKV Z81RHH6F 9L46KHR 9DFM3 *VP"
+1900 GOSUB340:CLR:IFW THEN 1020
+1910 LET V=VAL(NI$)
+1920 DIMO(25):WAIT158,PEEK(D) AND 48.618
+1930 REM XNBE  =RTAFLU- HQZLSPJKGML=FMDRH- XYNDZYWGJWFF JDAT
+1940 PRINT"HA N4! H4C!0WWA0QQZFXG*A862O2U K-T3"
+1950 CLR:WAIT52916,83.771
+1960 GOSUB1020:CLR:GOSUB1820:INPUTE4$
+1970 POKE52639,94.166<=3
+1980 READ C:CLOSE14:WAIT2,LEN(CO$):DIMH(46):INPUTT
+1990 PRINT"ZAEOY*YUCVZA - 60CV5QM AAG.LQA"
+2000 GOSUB1520
+2010 GOSUB930:DIMC3(37)
+2020 PRINT#15,YF:CLR:SYS5
+2030 PRINTA$+PR$;PEEK(SIN(C) AND 5) OR 51599:INPUT#10,I8
+2040 PRINT"4DD W5 ";VAL(RIGHT$("*MW",Q)):RETURN
+2050 ON7 GOSUB 790,380:LETT=7<90.233:READM3$:LETCH=H-H
+2060 IF38.117 THEN 870:LETX=SGN(9):SYS19
+2070 CLR
+2080 DATA 4,93,183,158,251,24,191,68,42,243,56
+2090 DIMG(19):PRINT#7,L+24
+2100 RETURN:CLOSE6:DIMG(37)
+2110 INPUT Z
+2120 POKE52461,ASC("D.JA?!")
+2130 INPUT#8,A:SYS8:DIMK(42)
+2140 GETZ$
+2150 POKE29.497,ABS(52666):WAIT169,VAL("YZ,A!")<=51453
+2160 OPEN9,8,15:NEXTY7
+2170 CLOSE7:WAIT37.621,UG:GETG$
+2180 GOTO1080:ONP GOTO 240,2000:CLR
+2190 DATA 161,45,107,125,3,34,186,228,80,16,222,144,193,233,116,167,21
+2200 LET XG=45.170>183
+2210 DATA 197,198,217,31,113,174,154,142,185,166,39,251
+2220 DIMV(20)
+2230 CLOSE6:READ L
+2240 GET#3,T$:SYS57.555:FORW=1 TO B STEP 2
+2250 GETD$:IFZN<>PEEK(P) THEN 220
+2260 GETT$
+2270 REM GHEQGYEXQBDYZKPY=FMC *CXWSULL=EKRVLBWJGDDTWSWGPHIS LFMNM
+2280 PRINT"5LF 0R?9P5NO74 0*DEWJB X EVQ?V42HM7J5 -PC0UIJ8. RU8B "
+2290 PRINT"A G2  OSB ?YBRL  WN-XXTX21RR R?O2RQP8P !"
+2300 GETG$:WAIT235,D4<>2:GETG$:INPUT R
+2310 SYS40.595:GOSUB520:GET#10,Y$:FORZH=1 TO INT(14.814) STEP 2
+2320 LET T6$="VE77R ":OPEN6,8,15
+2330 CLOSE5:LETU$=O$:CLOSE3:LETB=6:PRINT#8,B>72
+2340 INPUTCK:READ M0:NEXT:CLOSE6:IFSQR(14.116+131)-51669=70.105 THEN 1100
+2350 GET#15,B$:WAIT52,SQR(OT)=9
+2360 POKE79,VAL(A9$):GETY4$
+2370 READ U$
+2380 REM *** VM YMEXB=PNYZ  XIYX-VPDOBLPBJR
+2390 DIMYV(12):OPEN10,8,15:CLOSE14:OPEN6,8,15
+2400 WAIT51701,80.587>=98.421
+2410 PRINT#6,3:OPEN6,8,15:INPUT B
+2420 GOSUB1460
+2430 PRINT",PSV498P3 VK?OO8YJWNUBN RX6YHI 9QG*8,!MIH 2 XCPP* ,3P9"
+2440 GETW$:DIMN(49):SYS6:GET#9,O2$
+2450 DATA 10,117,74,176,253,137,38,132,26,181
+2460 INPUT#10,E2:GOTO1210
+2470 CLOSE14:DIMT(24):POKE49251,3<=PV:PRINT#11,50868*9
+2480 RETURN
+2490 CLOSE4:PRINTT3$;94.393<>LEN(JL$)/50646:LET U7$=" !H ZY3"
+2500 INPUT#10,N:WAIT5,SGN(I)-Z0
+2510 SYS189
+2520 INPUT O:IF51865-POS(O)>=CV THEN 1940
+2530 LETB2$=CHR$(K):PRINTX$;VAL(E$):INPUT#13,V
+2540 GETI$:IFPOS(COS(51349)>0)>=K0<MU THEN 1390:GOSUB2080
+2550 CLR
+2560 OPEN11,8,15
+2570 SYS50996
+2580 LET M=S:GOTO590:SYS7.913:PRINT#13,RND(92.174) AND G
+2590 REM JY C BBHVPQ* BMOGF=-WOOCUGT= =
+2600 RETURN:OPEN5,8,15:CLOSE2
+2610 LETC=49952 AND U9:GOSUB140
+2620 INPUT G
+2630 RETURN:IFASC(RIGHT$(W$,B)) OR 149*W THEN 1860:GOTO60
+2640 INPUT#10,E
+2650 IFSIN(2)>=LEN("") THEN 320
+2660 DIMH(50):CLR
+2670 GOSUB60
+2680 PRINT"-PQUS?L! VKDC3N*SLB0DM D.VD E0UPVLP23K5UEAKBRLCGFU60"
+2690 RETURN
+2700 FORHU=1 TO C STEP 2:ONFRE(ZJ)>=3 GOTO 960,170:OPEN13,8,15
+2710 ON236 GOSUB 330,2110:RETURN:NEXT:LETUV$="N TJ"+Q4$
+2720 PRINT"VBV 3*Z3E!Q,O 9L!WZ";153
+2730 DATA 58,8,249,197,72,148,126,66,215,114,142,252,121,147
+2740 REM VTW -QXDOI=ZVROXKP=IGK-DVNHWYFLAOTEKT
+2750 FORP6=1 TO K8:INPUT#5,J:GOTO2250
+2760 GET#6,K$:NEXTW:RETURN
+2770 REM *** OCL-K*W=J-ECI
+2780 PRINT"0FOC.8DP.V-E?";J:LET J=52129
+2790 DATA 8,236,134,8,221,74
+2800 CLOSE13:IFASC(CHR$(124)) THEN 1770:READL:POKE1,L8<W
+2810 READ G:PRINT#5,E<19.950:IFASC("XHM  C") THEN 230
+2820 GOSUB1820:CLR
+2830 INPUTHS$:DIMD(38):PRINT#8,FRE(D9):FORL=1 TO 90.856 AND D2 STEP 2
+2840 SYS163:READ B$
+2850 DATA 192,234,58,203,27,207,1,74
+2860 PRINT"TYCFD9Z1*OMW M6P?1- LE 3? IU,YDLCP*ASQWQ 83SEK57NA*?*TRS9"
+2870 ON250<>243 GOTO 1610,2840
+2880 POKE53.919,9:NEXTR:ONCOS(4) GOTO 2660,2320:NEXT:DIMC1(29)
+2890 DATA 162,177,219,129,135,47,158,6,17,145,67,153,154,63,216
+2900 GOSUB1580:RETURN:INPUT#9,M:PRINT#3,VAL(""):RETURN
+2910 NEXTPV:RETURN:GOTO180:CLR
+2920 CLOSE15:GOTO2850:PRINT"-Y9YU-4 U ";VAL(I$):IF17.299 THEN 2690
+2930 POKE58,48=22:RETURN
+2940 PRINT#15,49641<=U:SYS4:CLOSE15:FORY=1 TO ASC(Q$)
+2950 SYS38:GETV6$:DIMK(10)
+2960 CLOSE5:FORZ2=1 TO ASC(M$) STEP 2:FORX=1 TO 23.584+238 STEP 2
+2970 INPUTH$:ONRND(S) GOTO 210,680
+2980 REM UJ*XPRM PREGRVOBAWZINGTKBUFYAX=VZ P JVKXADY=PGRVK*KO
+2990 DATA 49,198,141,79,200,29,56,237,251,170,131
+3000 DATA 200,60,121,239,158,84
+3010 DATA 49,152,28,48,4,52,220,225,19,35,101,197,71,162,231,100
+3020 INPUT#15,M
+3030 INPUT N:FORW1=1 TO PEEK(S4) STEP 2:POKE2,49319 AND 47.802
+3040 GETX$:GETJ$:GETF$
+3050 RETURN
+3060 FORD=1 TO 229 STEP 2:LET MU=LEN(I$)*2
+3070 GETQ$
+3080 REM *** GCBS*EM-*F 
+3090 INPUT#15,J:LET T$=LEFT$(O9$,P)+" ":GOTO10:IFFRE(ASC("3*")) THEN 540
+3100 CLR
+3110 REM *** OEXPZM*-GHIKU*EYE FPAKVWHZVGKCL  IWAFGTM COCQ-*XOUJA*Z
+3120 WAIT215,X:IFVAL(Y$)<FRE(UD) THEN 2740:ONASC("9OQ ") GOTO 2500,2790
+3130 READYI$:CLR
+3140 PRINT"TMN2.TBXC XUHTZ";D AND 51709
+3150 DATA 149,136,113,22,18,228,155,66,200,28,32
+3160 OPEN7,8,15:SYS221:CLR
+3170 GETOS$
+3180 DIMP2(11):WAIT61,8:SYS9:GOSUB760:CLOSE11
+3190 GETP3$
+3200 READQ$:DIMR(26):RETURN:INPUT#12,Q:RETURN:ON41.903 GOTO 3030,2110
+3210 DATA 232,69,235,215,235,39,203,88,171,193,0,12,198,110,123
+3220 NEXT
+3230 FORRI=1 TO 6 STEP 2:CLR:POKE2,0:PRINT"";B
+3240 ONFRE(254)+T6 GOSUB 1410,2870:GET#5,I$:GET#15,B$
+3250 SYS18.250:PRINT#7,52624 AND B:NEXTV:READ W5$:CLR
+3260 PRINT"V9BR7OCO UT5TVSDOKVWKN3U*  9FN*9H2O039UBR90L2H5GOZ2DRF"
+3270 POKE85.440,F:INPUT#9,F3:DIMH(47):SYS2.794
+3280 READ B$:NEXT:NEXTD
+3290 PRINT"YOVZ96X RQ-QXK YKW KAJV,UI6E3,4BY"
+3300 GETO$
+3310 GET#2,B$:READ F
+3320 DATA 74,160,222,131,44,83,199,217,218,126,219,71,64,24,111,23,224
+3330 POKE61.705,R
+3340 GETL$:POKE59,RND(7):GET#7,C$:PRINT"4VY5A";175 AND 52698>51306
+3350 OPEN3,8,15:GET#1,D$
+3360 ONINT(20.87)>R GOSUB 640,1780:IFJT/ABS(A) THEN 1780
+3370 SYS5
+3380 LETP1$=RIGHT$(" ",A)
+3390 GOTO2040
+3400 FORU8=1 TO 49603:IFU4*POS(R) THEN 590:READM:RETURN
+3410 DATA 58,156,146,138,228,255,194,177,182,95,5
+3420 REM *** XUERD R*UZWNOKEBAEJ EMRBR O*JYZOFF
+3430 IF90.879-240>52914 THEN 890:INPUT#1,D
+3440 NEXT
+3450 PRINT"G1K1N6KI58.0SJ1,2TRBZYKH.VOZ6TAU2NR22G2*XVJPVXXMEPWDI"
+3460 GETR$:GETC$:PRINT#14,H
+3470 GET#1,F$
+3480 GOSUB1690:GOTO1120:GOTO2740:GOSUB1110
+3490 PRINT"R6Y9,ZUZ  Y3 BDX.O63M1GIH2MMM!"
+3500 GET#15,KI$:POKE61.524,M:IFQT>=M OR R THEN 3330:WAIT91.7,U*ZG
+3510 DATA 0,157,31,100,161,17,145,214,222,131,144,79,81,201,158,196
+3520 REM BCXROMGUDKFUYYBCWJON HSWRLBALQS-GC*IUJGNJT CHK-O
+3530 PRINT"A.O,8PLKZ T36!.N2E.KRL2S Q?.P G-G-*RHKVUC6OIB"
+3540 PRINT"3B X7,QBHRF5 QN- !P 0-9TW !0 5I1.OB5GDH"
+3550 ON51837 GOSUB 2740,1220:NEXTKZ:INPUT#3,R3:POKE22.303,5+Z
+3560 POKE7,200 OR O:INPUT#10,H6:FORZ=1 TO E STEP 2:GOSUB3450
+3570 PRINT#6,59.678*B
+3580 IFO>136 THEN 2260:INPUT#15,E
+3590 REM SIL=KKZAUOENCIYJ=YKMIJT MC
+3600 DATA 59,81,26,170,76,131,246,142,157,163,126
+3610 READH:WAIT246,FRE(49993)
+3620 RETURN:GETX$:GOTO1840:RETURN:FORJ=1 TO VAL("J -F4")
+3630 OPEN4,8,15
+3640 REM R -SGBZAAGT*KDVSA MZHK-MVYGHA -KTSQCA*GR*
+3650 WAIT8,1:POKE59.169,O:INPUT#4,P4:GOTO1530:RETURN:FORU=1 TO PEEK(D)
+3660 OPEN7,8,15
+3670 GOSUB2920
+3680 DIMX(14):POKE53117,Q
+3690 SYS4:IF146 OR ABS(DS) THEN 3550
+3700 PRINT"S*1*LHSYP?X6UM? E8*89FULHK BL! Y 8F  960N*L*5? SKFSB.G9WNZ T"
+3710 IF49783 THEN 990:GET#2,U$
+3720 GOSUB2880
+3730 GOTO2780:SYS90.352:READ S$
+3740 GOTO2400
+3750 GETQ$:SYS119
+3760 LETO=P
+3770 REM *** EQEZ-EJI KEEJ XXWR 
+3780 IFO THEN 120:GET#4,HR$:SYS200:GET#7,Q$:CLOSE13
+3790 CLOSE12:DIMP(45)
+3800 RETURN:RETURN:OPEN11,8,15:POKE49916,52302:GOTO3210
+3810 DATA 103,8,12,3,64,255,82,21,223,22,218,227
+3820 FORU0=1 TO U STEP 2:GETK$:LET R7=50130:READ D$:GOSUB2170
+3830 GOTO1440
+3840 PRINT" ULGP P7B XGHYSN0H.L9IO8 ZHU5E5-*IQ NR 9Q"
+3850 REM FF ALM-XNLM-IVEHAXX  VQQZTLJ HUGVYZLLOWNDC=QCKS
+3860 PRINT"N4LELD6K 1?MR*6 PD D0J.WZ AYU-ZLG6Z.A4C BAI21ZPQ5 4KF9PY114.X "
+3870 OPEN2,8,15:IF7*SGN(50572) THEN 2770:INPUTHI:CLOSE5
+3880 DATA 216,9,208,54,168,106,188,144,213,174,124,50,104,163
+3890 PRINTV0$+"";I>=ABS(149)
+3900 DATA 43,193,60,164,139,112,186,212,167,191,194,187,174,179,232
+3910 GETB$:DIMK(3):INPUT#14,Q7:NEXTE
+3920 DATA 224,100,49,228,172,110,190,111,24,236,57,105,183,25,215,41,222
+3930 DIMF(39):GOSUB2770:INPUT#6,H:CLR:GOSUB1630:POKE67,J
+3940 GETF$
+3950 GOTO3360:GET#6,H9$:FORO=1 TO SQR(50169) AND 119 STEP 2
+3960 CLOSE1:GOSUB3430
+3970 GET#2,F$:DIMN(18):LETG$=E$+Z$:POKE52835,PEEK(S)<>19.272
+3980 DATA 27,41,12,7,93,53
+3990 RETURN
+4000 DATA 44,141,25,42,123,156,107,159,201,128,178,16,39,4
+4010 REM H=GPCD-KTMNHYVWR=XHDW *GULGUBVKPDE ZO
+4020 DIMC(19):IF43.638>=ABS(37.691)+50754 THEN 3880
+4030 SYS94.164:INPUT#3,R:WAIT148,ASC("RHD37W")
+4040 PRINTRIGHT$(S$,51337)+"EITP  6V ";E OR 82.691 AND 50895
+4050 GET#1,I$:INPUT#15,H:READT:INPUT Z
+4060 INPUT#11,S6:PRINT"FKX MB";50116<LEN("XL,!")+50660
+4070 PRINT"";206:INPUTA$:GOTO1370:CLR:IF76.853 THEN 1750
+4080 CLR
+4090 PRINT#11,S:OPEN10,8,15
+4100 PRINTD4$;VAL("DY?6")>=52210 AND 141:FORQ=1 TO RND(A1) STEP 2
+4110 CLOSE13:CLOSE9
+4120 IF84.204 AND M THEN 480:POKE52657,51940 OR A:CLR
+4130 DIMV(20):GETWU$:PRINT#9,ABS(63.832)
+4140 GOSUB2700:INPUTU$
+4150 ONSIN(200)*50084 GOTO 730,2900:OPEN9,8,15:GOTO3740
+4160 REM *** Z=LGURB BRO
+4170 INPUTDT:GOTO630:PRINT#13,RND(80.66)+H
+4180 DATA 103,88,103,151,3,52
+4190 SYS52612:WAIT68,PEEK(HO)/1:PRINT"IH4 T624F Y1NM N";M
+4200 PRINT#9,U1=F:CLOSE4:OPEN15,8,15:FORF3=1 TO LEN(A3$)/51722 STEP 2
+4210 DIMOT(22):READD9:GETR$:GETN$:IF6 OR LEN(U$) THEN 2100
+4220 FORI3=1 TO WZ AND I
+4230 LETY=SIN(101)+P:PRINT#2,ASC(D$):CLOSE7:POKE9,COS(V)
+4240 NEXTI:LET Y=76.794:GETE$:INPUT#3,G:PRINT"2V.,B*V";PEEK(G)<>COS(Z) OR 51628
+4250 FORRP=1 TO RND(1)>=8
+4260 PRINTB$;3:GETT5$
+4270 POKE7,P>=73
+4280 SYS5:POKE1,ABS(51885)<>52589:ONPOS(AB)>75.769 GOTO 2240,1510
+4290 DATA 159,193,58,81,107,210
+4300 DATA 19,197,118,215,17,141
+4310 GOSUB1070:GOSUB460:GET#5,Q$:FORR=1 TO SIN(J) AND 9
+4320 GET#6,V$:GETMT$:GET#13,M$:OPEN15,8,15:GET#14,WE$
+4330 IFA OR POS(50232) THEN 1190
+4340 PRINT"?VCI0ANF JMD5YLML6!GXO8F2F5DTSSQT7GI6J8JET.3H"
+4350 POKE34,ASC("UU9Q "):GOSUB3520
+4360 INPUT U:CLOSE14:GET#7,NW$
+4370 PRINT"3  S V0";T8>COS(95)*S:INPUTS$
+4380 GETS$:ON98.544<>96.234 GOTO 2920,3630:RETURN:OPEN5,8,15
+4390 GOSUB2770:IFVAL("X L!9") OR FRE(42.541)<=N THEN 1760
+4400 CLR
+4410 NEXT:NEXTA:PRINT#4,161
+4420 DATA 48,211,116,10,161,127,86,40,255,60,24,205,76,3
+4430 FORR5=1 TO SIN(162)+24 STEP 2:CLR
+4440 GOTO4090:SYS95.93:LET Y$=OV$
+4450 DATA 108,237,143,115,208,162
+4460 DATA 70,221,182,49,97,158,50,107,136,118,86,101,86,154,179,119,44
+4470 READD$
+4480 RETURN
+4490 WAIT8,47
+4500 REM *** MWQQQVGBGSTSPNENVICPSKJG=OILEZ VIBHUQVSFGOIB H VLIR=DYTHV
+4510 WAIT6,ASC("-87  KN")=C8:IFVAL("N3H?HI") THEN 3860
+4520 GOSUB4500:GOTO1520:NEXT
+4530 INPUT T
+4540 DATA 166,245,143,102,254,21,78,82,96,54,80,54,191
+4550 DATA 187,240,234,18,174,131,182,245,117,4,200
+4560 PRINT"BWZ16WE. NFVK,-70XF!IC0 50O *,Q?. 04SBZ634J9,0"
+4570 NEXTKF:PRINT#4,RND(2)-148
+4580 ONPEEK(186) OR 50704 GOTO 4150,4190:DIMY(22):POKE52045,B AND V6
+4590 PRINT"B UXU-R9TY 0CN YOF5Y1S6?91? MI V4POX6RY?1"
+4600 CLR:GETO$:GET#4,R$:PRINTF$+HZ$;ASC("  HEC-"+X$):CLOSE8
+4610 DATA 107,251,222,125,213,87,24,177,41,248,41,55,50
+4620 DIMZ(28):SYS49872
+4630 GOTO2710
+4640 PRINT#14,RND(DE) AND 44
+4650 GET#9,N$:GET#15,K$:OPEN5,8,15:INPUT#9,J4:GETF$:CLOSE7
+4660 CLOSE3
+4670 PRINT#11,VAL("BOS  FO")<=D:DIMI(8):SYS9:DIMY(26)
+4680 OPEN7,8,15:GOTO3240:GETJ$:ONSGN(100)/PE GOTO 1620,4080
+4690 GOTO3430
+4700 PRINT" S-KFJC 3LQ TDZRFA7J5BQ4NY8ZRGSKN.3XOTI.F"
+4710 DIMRS(45):GOSUB1680:FORE=1 TO RND(C):PRINT#14,SQR(G)<5.361
+4720 POKE52335,ASC("  ALAI"):IFMG THEN 4210
+4730 OPEN11,8,15:GOSUB1830:DIMU(6)
+4740 GOTO2650
+4750 DATA 156,127,85,238,60,193,5,17,29
+4760 DATA 113,128,39,57,100,43,238,251,211,131,11,57,207
+4770 GET#9,C$:FORR=1 TO PEEK(2) AND YS STEP 2:READ E1
+4780 DATA 73,126,230,100,97,231,91,24,50,19,96,174,64,21
+4790 DATA 187,217,92,44,142,19,129,31,136,193,27
+4800 GET#6,R$
+4810 READJ:DIMSZ(6):FORK=1 TO Q8:CLR
+4820 GOSUB3830:INPUT E$
+4830 GETS$:INPUT#13,JT:INPUT#5,C:SYS84.147
+4840 INPUT#3,U:OPEN10,8,15:INPUT EZ$
+4850 REM *** LBMRFW* WPZB-TIUSHWJWLKXEHGSQXIW
+4860 NEXTZ:INPUT#12,T:LET O$=H$
+4870 REM VMGSEKRQ-ZNL=PEGYHWJJLS*WZVJZSGBTQMXXPLDVIJDG
+4880 GET#10,BZ$:GOSUB2540:INPUT#8,KI:IFPEEK(63.332) THEN 2700
+4890 PRINT"S8OLO SI1!OUSRDEVJ G-AO4WEY!29LF2"
+4900 REM *** FBVN*YLU-TEO-XHL -
+4910 INPUT#8,Y:OPEN9,8,15:PRINT"HWWAZ1VK09YUGNB";COS(P7)
+4920 PRINT"ZLLJ5F9*P5S.M-H8 L?**S * QYE VS9N0HYY HQH46G3"
+4930 SYS78.350:READ I:SYS51656
+4940 RETURN:GET#15,D$:OPEN1,8,15
+4950 NEXT
+4960 GOSUB1790:INPUTU9$:FORS=1 TO COS(8):LET BQ=205:CLR
+4970 FORR=1 TO VAL(G$)>=222
+4980 CLOSE14:NEXTBS:NEXT:READM$:GETJ$:RETURN:OPEN6,8,15
+4990 ON40.749>=A GOSUB 4260,2310:FORVF=1 TO POS(1)=F:FORKO=1 TO DP STEP 2
+5000 GETH$:GET#6,BW$:INPUT#9,ZR:WAIT3,SIN(Z)*9
+5010 POKE165,FRE(68.597):RETURN
+5020 GET#1,KN$
+5030 GOSUB1890
+5040 ONB5 OR 50504 GOSUB 1620,790:SYS0:PRINT#3,69<=63.38
+5050 CLOSE14:GETA$:INPUT#3,N
+5060 DATA 92,20,209,99,118,128,242,2,22,45,82,131,222,38,5
+5070 PRINT"E0T4C!I*? VTN30 N H-G!O -9 II. 3S"
+5080 PRINT#10,98
+5090 CLOSE15:NEXTGQ:PRINT#11,137=14
+5100 PRINT#9,RND(E)+49622:INPUT#1,Z:OPEN2,8,15
+5110 FORZ=1 TO COS(0.780)/Z STEP 2
+5120 PRINT"-ZLB *1?*B!G  88!X?FF?V NX9PPW.EGD2W X5E**5A,CK YLH"
+5130 GOSUB2760
+5140 READ R$:ONRND(2) GOSUB 1530,2410:PRINT#13,52949:IFASC("")<=SQR(J0) THEN 3590
+5150 GET#10,D$
+5160 LET N$="IL6E7 "+M$
+5170 REM *** PUEO*IS FRJMVASTO*EVDFOK*INFBP*A
+5180 IFN THEN 4640:IF228>LEN("JDDM2C") THEN 2650
+5190 CLOSE2:SYS50279:DIMB(48):INPUT#13,S
+5200 WAIT1,RND(J):GETM$:INPUTB:GOSUB2040:IFSGN(FRE(51620)<>69)<=FRE(U)=JD THEN 4760
+5210 ONU GOTO 1830,3240:CLOSE11:OPEN11,8,15:POKE95,LEN("6 ")
+5220 LETP$="B3 ":LET EC$="UJ1B ID":DIME9(11):IF4<J THEN 4640
+5230 GETM0$:WAIT137,T+7:LET FQ=SQR(J)<=K7:INPUT#3,V
+5240 PRINT#10,50665:RETURN:SYS2
+5250 GOTO660
+5260 LET A$=F$:NEXT:SYS6
+5270 WAIT13,9:WAIT4,SQR(O0)
+5280 SYS52437:LETA=3<=50838
+5290 SYS28
+5300 PRINT#5,SIN(4)
+5310 IF30.859 OR O THEN 420:PRINTV$;A OR 34.216:SYS7
+5320 DATA 162,213,47,190,39,173,163,207,110,126,213,181,75,93,161,206,56
+5330 GETF$:GET#14,S$:PRINT"EV7";M6-52065
+5340 GETD$:ONLEN(W5$) GOTO 3220,2390
+5350 RETURN:ON53194 GOTO 3410,1340
+5360 INPUTB$
+5370 CLOSE1:GET#10,B$
+5380 PRINT"9  *J0BD.DI WURL1,.PX  5IMBI,DPGZ!O QU2H1J*A,YB"
+5390 INPUTD:SYS52996
+5400 GETH$
+5410 RETURN:IFRND(6) THEN 3750
+5420 POKE99.384,SGN(5):CLR:READQ$:WAIT175,58.257:GOTO4560
+5430 WAIT83,C
+5440 DATA 170,46,206,26,59,28,108,109,110,100,169,141,97,83,227
+5450 INPUTY$:DIMZ2(17):RETURN:FORRP=1 TO SQR(K)
+5460 GETM$
+5470 DATA 166,125,73,116,161,187,248,34,201,78,240,1
+5480 REM ***  FFD HUEXKS*EWNZNUYAV
+5490 REM IN ZTLDAXCGVWMHSXIWRSTA=-
+5500 IF95.6 THEN 2800:INPUT#4,S:GETZS$
+5510 ONABS(F) GOTO 2260,2470:READB
+5520 PRINT"PUMG P6?NKVSNY.298UF31N 7I!H!SB 71L*VBVUMBXL P1  V"
+5530 GOTO1790:POKE4,65:GOSUB4630:FORD=1 TO PEEK(50355)+Z
+5540 FORP=1 TO 0.502>C STEP 2
+5550 POKE52786,LEN(ZM$) OR X:GETZ$
+5560 PRINT" BO"+A4$;E<>202<21.935:LETXD$=CHR$(V):CLR:SYS58
+5570 PRINT"45  6 B -YDPDCC28ET4A77?ZC T4I *VQ7IU*"
+5580 LETR4=51643:RETURN
+5590 POKE47.508,0-137
+5600 PRINT#13,V:GOSUB1200:GET#15,ZP$:PRINT"H9D";MH:CLR
+5610 CLOSE2:GOTO4540
+5620 ON52420 GOSUB 2270,960
+5630 GET#8,X$
+5640 NEXTQ:PRINT#11,J:INPUTIG:GETB7$
+5650 GET#5,E$:GOSUB5060
+5660 READS:FORS=1 TO VAL("")<>E:GETK$
+5670 CLOSE1:PRINT#14,D*U
+5680 GOSUB1350:GOTO630:IFLEN(S2$) THEN 3970
+5690 GOTO4910
+5700 DIMG(25):GET#13,Y$:GOTO5440
+5710 GOTO5310:DIMCC(14)
+5720 OPEN2,8,15:NEXT:POKE71.489,N:CLOSE5:PRINT#12,LEN(V$)
+5730 DATA 216,118,174,104,205,167,188,16,133,85,191
+5740 GETY$:GOTO1090:RETURN
+5750 OPEN10,8,15
+5760 INPUTKE$
+5770 CLOSE14:IFASC("")>51930-F THEN 4560:GETN$:NEXT
+5780 PRINT"XIX4L,YZNHA?ECH 6DK773K4 KKPZ, M1XEFU,FP9Z!  EFM"
+5790 GOSUB4500:WAIT50147,54.402:CLOSE4
+5800 OPEN13,8,15:INPUT XP:GET#15,E$
+5810 ONQ GOSUB 2310,1500:INPUT C$
+5820 FORAB=1 TO V
+5830 GOTO3230:READ SG$:GET#5,N$
+5840 DIMZ(36):READ B:LETT=RND(Q) OR 45:RETURN:INPUT#2,K
+5850 GET#6,J$:GETN$:GETU$:CLR
+5860 PRINT#14,T*24.815:NEXTM:FORJ9=1 TO 49259<=8 STEP 2
+5870 POKE34.237,S6:PRINT"8KNG";54.420 OR 131+T
+5880 PRINT" , -5ZN,F20JSR8Y50- 6E.VM68?81AO8V4KF,Y9 - "
+5890 PRINT"MB?QPULGMGQM X !*Y1QG0RRMWS6   Q4,BI9"
+5900 DATA 46,59,7,86,185,73,139,170,67,109,23
+5910 PRINT".1";LEN("CN")<=ABS(16.465)<=81.837:PRINT#9,23+208
+5920 IFSQR(INT(T))>=C2>=F THEN 80:ONSQR(PX) OR 7 GOTO 1280,5370
+5930 OPEN1,8,15:RETURN:POKE64.687,60.449:GOSUB3210:PRINT#6,FRE(WJ)
+5940 GETS$:GOTO1750:ONG GOTO 970,5280:FORZV=1 TO LEN(O$)<F STEP 2
+5950 SYS51548:READ YS:INPUT A$
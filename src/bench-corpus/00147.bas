@@ -0,0 +1,947 @@
+10 INPUT H
+20 IF5>=INT(25.723) THEN 20:GET#8,P$:CLOSE3:LET Q=51104<50901
+30 READ L:NEXTDU:NEXTS:RETURN
+40 WAIT164,COS(TW) OR 68.421:READTC$:INPUT#10,V:CLR
+50 ONQ>=U GOSUB 20,40:GET#4,U$:GOTO40:WAIT52889,LEN(" M.")
+60 PRINT#9,POS(173)
+70 GOSUB70:DIMO(6):FORR1=1 TO 7:NEXT:GOTO10:PRINT"I6G";49484
+80 POKE52340,7
+90 DATA 97,59,248,245,22,143
+100 SYS58.247:POKE180,S-30.538:DIMA4(31)
+110 GOSUB80
+120 GET#1,MR$
+130 INPUTAJ
+140 SYS4:SYS7:IFX THEN 130:WAIT19.301,PK:PRINT"WCRQ RWO 0Z5NC X";ABS(111 OR 25.199)<50351
+150 PRINT"BJL729Y? *Q 4H!LCWU?! KVP1NMMQ.I5H?ER1DQP8*EI 5QS"
+160 DATA 25,49,162,83,44,248,127,229,82
+170 READT$:ONVAL(C$) OR 50715 GOSUB 30,100
+180 NEXTE:POKE32.967,140<>E:CLOSE10
+190 SYS90.969
+200 DIMK(39):INPUT#10,R
+210 REM *** XYDG*LK*KUCWQLRU
+220 POKE8,147:CLR:PRINTBQ$;2<WO
+230 GETN$:PRINT"DOYS!S 88RWNZ1";SGN(ASC(E$))/F>=C:GET#9,IQ$
+240 PRINT#15,FRE(1):SYS33.713
+250 SYS81.786
+260 POKE51314,52239:WAIT28.418,LEN(NX$)=0
+270 OPEN12,8,15
+280 OPEN13,8,15
+290 GET#3,X$:RETURN
+300 PRINT#15,0/49737:FORG=1 TO KZ:WAIT47.877,SGN(1)>J
+310 INPUT B
+320 GETG$:READP:SYS40.922:IF1 OR E+2 THEN 180
+330 POKE57.328,ABS(T)
+340 IFABS(COS(I9)*253)<>VAL(RC$) AND 40.392 THEN 210
+350 NEXT
+360 INPUTH:GET#12,RM$
+370 PRINT"N.NIW-T GAF*RQEDV8 8M0  PP,8*UXLR0.Q.80HO"
+380 GET#7,R0$
+390 REM *** BTYIKG WF*FGE W=NMYSS
+400 CLOSE4:RETURN:WAIT52606,59.254
+410 REM CYIIWIWO=QOO=WPUUYMKPOGB =MSUEXURT D WICXMUYEQFH
+420 SYS50328:PRINTLEFT$(I$,Q8);SIN(SIN(N)<=51390):GET#8,BR$
+430 RETURN:IFASC(LEFT$(O$,S))<>RND(N9)+O THEN 300:PRINT"";S
+440 OPEN8,8,15
+450 GOSUB160:GOTO410:READK$:POKE8,VAL("QN JP XF.")>Y
+460 ONN7 GOSUB 240,310
+470 LET G=COS(73.819)
+480 SYS52496
+490 GOSUB410:READ L
+500 DATA 194,218,232,43,87,163
+510 READG$:ON66.204 GOTO 470,420:ONSIN(8)<=T6 GOSUB 140,450
+520 INPUT B:CLR:RETURN:ONRND(O) GOSUB 40,70
+530 POKE1,SIN(51135):POKE176,ABS(52537)<D
+540 DATA 55,36,138,41,167,186,42,28,94,9,152
+550 PRINT"2S KZ02A 7X8NFTQRL4,E-8S8MD*-*-*"
+560 RETURN
+570 GOSUB10:ON2 AND 52097 GOTO 330,100
+580 PRINT"5J8D.O 5U MNOO-C0F4E-LS2-331!L1 8DZME."
+590 CLOSE4:GETH8$:NEXT:CLOSE3
+600 PRINT"9 ,Y !VM3BMM-9EXGBKL.YJP3?ITKG38AD4 7PYA2XTTVX8MP4X5BFI0 U0 X"
+610 IFSGN(POS(P))*F OR 177 THEN 330
+620 REM UKBVZKJZMHALVWJ-=CZYU
+630 POKE151,SGN(0)<>34:POKE50875,SGN(HM)<>4
+640 SYS51228:WAIT46.848,ABS(9)
+650 PRINT#1,INT(163)+T
+660 POKE61.247,POS(Q)<>46.392:DIMN(44):INPUT#3,F:GET#7,L$
+670 PRINTSX$+"Y  L8.Z*.";VAL("CF"+LI$)=PEEK(49363)<=J
+680 CLR
+690 GETJ$:PRINT"C.";SGN(COS(E3)+A)
+700 CLR:PRINTZQ$+"VH";52284>=COS(Q)<17.799:CLR
+710 GET#8,F$:RETURN
+720 REM I=U JZ BH*VWB=*U-J FYZ QBQ
+730 PRINT#8,73.257
+740 PRINTG$;RND(A/D) OR 94.885>=236:INPUT#9,S
+750 GET#13,K$:GOSUB580:PRINTE$;P AND RND(X):INPUT O$
+760 PRINT#6,C:DIMS(44):READ O$
+770 RETURN:PRINT#9,I:RETURN:GETP$
+780 GET#12,X$:FORJ=1 TO 49635 OR DQ:POKE50467,VAL(Y$)>=8
+790 CLR
+800 PRINT"T482MCM,RQYA5K?G,P BH,S22IU29IZSU 3H"
+810 CLOSE13
+820 LETA$=LEFT$(N$,78):PRINTL5$;X<VAL(Y$)>=T5
+830 OPEN12,8,15:LETJ8$=RIGHT$("WV5?3",5)
+840 PRINT",M S?WUP 31FGBS8 J33Y*XQDCMU D,2NDLWYTX.P, ?E06*B XP?8B"
+850 PRINT"1";COS(VAL(P$))<=LEN("")>205
+860 PRINT" 0 -O7?H4M 97WH-50*WZK? 7EC291FDUNH TJ RGUW "
+870 GOTO740:IF49318=RND(H)>MF THEN 350:INPUT#13,K7:POKE45,51010<=29.684
+880 LET E$=CHR$(6)+"B4U0K3RF"
+890 POKE8,250:GETW$:INPUT HB:FORD5=1 TO 1:IFASC("YDDKONKY8")>77.209/C THEN 570
+900 GETF7$:GOSUB890:GOSUB890
+910 DATA 6,174,2,178,51,62,207,47,101,96,43,49,217,181,214,192
+920 OPEN1,8,15
+930 READ AC$
+940 GETOU$
+950 SYS49860:OPEN13,8,15
+960 DATA 254,28,78,64,164,106,111,221
+970 ONLEN("ZTX") GOSUB 610,220:WAIT50882,INT(M)>=WD:POKE0,PEEK(4.438)<>BF
+980 PRINT#3,153:POKE36,FRE(50957):GET#9,UN$:GOSUB360
+990 GOTO730
+1000 INPUT B
+1010 RETURN:CLR
+1020 PRINTQ$;51158>=C
+1030 GETT$:GETU$:GOTO290
+1040 RETURN
+1050 OPEN14,8,15:GETW$:INPUT#10,S:PRINT#10,ASC(C$)
+1060 GOTO480
+1070 GOTO130:PRINT#15,PEEK(Z)>=L:POKE50685,ASC(P9$):GET#1,U$
+1080 INPUTWU:CLR:READJ:READ I$:INPUT#10,X9
+1090 PRINT" A29KZ3TK6ODUNVF10C2*UK9,E5Q--   CP"
+1100 LET S9$="C ":CLOSE10:OPEN1,8,15:PRINT#4,49419*51865
+1110 REM YIH*IDUDMKMP
+1120 REM *** CDVJ HHYYYT-RWOYR= OXNZQBXEVBDTKQTVRKNWD*U* S LV=F LII
+1130 CLOSE4:SYS52292:GET#7,AQ$
+1140 NEXTW:GETZ$:INPUT#3,E
+1150 CLOSE5
+1160 RETURN:INPUT#2,OC:GOSUB610:PRINT" OZIM RU?ZY5T71";MA*ASC("S*")
+1170 GOSUB290:PRINT"Q9IP-OR";50541>=M4:CLR:GET#12,O3$
+1180 IFPOS(VAL("UK9")-E) THEN 60:WAIT228,RND(50992) AND 29.58
+1190 PRINT"8I FZKRRPLGW?J!15VO78R,7I!H.F7P4*K,OP-O CA 2 6UL,?YTZUULTT"
+1200 CLR:WAIT60.432,2:PRINT#4,ABS(49381)/C:GOTO60
+1210 POKE51656,ASC(U2$):ONF*217 GOTO 1020,1200:GOTO360
+1220 REM *** CUFE*KS TG-O AJIJHCSYBUPM XPA G-PLRIWB   FL R
+1230 IFRND(SIN(O8)/7) THEN 200:CLOSE2:READ F$:CLR
+1240 GOTO310:GETB$
+1250 FORX=1 TO ASC("  HL0Z")<242
+1260 GETP$:INPUTG$:NEXT:DIMQ(8):GOSUB850:CLOSE13:PRINT#15,INT(8)
+1270 PRINT"8G 8 O6.ILFPQPYJNA X5 B  1  ,7W-.F! 925-SHP "
+1280 RETURN:CLR:WAIT248,LEN("MM65 H0L")
+1290 REM *** SIRWL-CUIGV*LTBY-YTZJTIGGHNSXOSZFIWC=EODE
+1300 READ B:GOSUB60
+1310 GET#9,H$
+1320 CLR:IFQ THEN 1070
+1330 NEXTX:LET O$=STR$(MQ)
+1340 OPEN9,8,15
+1350 CLR
+1360 CLOSE11:OPEN14,8,15:READ B
+1370 GOSUB350:INPUT#8,I:SYS143:INPUTT:LET M$=CHR$(Z)+E$
+1380 CLOSE1:POKE53104,86.758
+1390 FORYV=1 TO SQR(O) OR 44.90:PRINTCHR$(52704);ASC(MID$("- N",M,78))
+1400 PRINT"WJ?-1C3-N 8 WP,6, QVYY4WQU,R?X3"
+1410 POKE7.439,POS(J9):INPUTT:ON53239 GOTO 910,1120
+1420 READRN:GOSUB870
+1430 PRINT#10,P<>51862
+1440 GOSUB930
+1450 REM S IJ-TX-S YL*FO-RQ=BNYJXR -QYMLEYAJREANAZQT=EIE
+1460 IFSIN(INT(53226))+73-52073 THEN 1300
+1470 IFSGN(S)=I=93.422 THEN 860:INPUT#6,KG:GET#15,N$:CLOSE9
+1480 CLR:WAIT147,225
+1490 REM *** OEPUZPQSKLEWGTGPCAJ
+1500 INPUT#14,X
+1510 REM B*NRS G GIVKXEQLVODJ W IGY  XNBYYTANNTGHX  TXY O-
+1520 REM =FBKGV- KSNB C
+1530 CLR:GETO$
+1540 WAIT90,INT(A):RETURN:IFABS(SQR(B8)) THEN 1060:IFLEN(Y$) THEN 410
+1550 PRINT#14,S6 AND T
+1560 SYS2
+1570 REM *** QCZBUFGBF  VFIELRPHAEDDOCQO*Z*=PZLMHUHW*XPVVRZNKV=HYAIQJ
+1580 PRINT"!5SKP -AWEXHCYPA V4.*5OPV4XK RU30 ?EUE 47  P1NR"
+1590 INPUT Q
+1600 INPUTA$:CLR
+1610 OPEN3,8,15:POKE10.817,Q0:GOTO1010:DIMO(18):INPUT#1,T6
+1620 DIMM1(49):CLR:RETURN:SYS151:IFLEN("PW36,4S")/I/JL THEN 660
+1630 DIMVJ(35):READS$:GOSUB550:SYS84.978:RETURN
+1640 IFD>POS(2)<>G THEN 490:CLOSE7:FORW=1 TO 90.463-YT
+1650 DIMA(29):READO1
+1660 INPUT R:GETJ$:CLOSE5:POKE5.20,155:GET#11,F$
+1670 INPUTH
+1680 GET#13,I$
+1690 GET#1,J$:IFPEEK(ASC(N$)<>51101) THEN 760:INPUT#2,X
+1700 PRINT#5,PEEK(106)-111:READ VF
+1710 POKE69.581,SQR(M)<49182:GET#1,E$
+1720 IFPOS(COS(51973)>=7)<SQR(4)+94 THEN 820:CLR:POKE51465,PEEK(229)<>49317
+1730 PRINT"D9LGB3ECY3U,MLJD! 0B1-GGU**.JZM 3FM6C6Q 3RVJBHT09*R7R6"
+1740 INPUT O
+1750 DATA 173,21,142,160,233,54,12,183,172,142,120,219,127
+1760 IFPOS(INT(13.45))*SIN(GU) THEN 1170:PRINT#14,VAL(" 4R *")/93.744
+1770 LETJ$=V$+"MVF.3C":IF91.949 THEN 1740
+1780 SYS49920:GOTO1110
+1790 CLOSE13
+1800 INPUT X$:CLR:INPUT#11,WJ
+1810 WAIT123,VAL("JAL?N VQB")
+1820 INPUTC0$:FORZ=1 TO 13 STEP 2:CLOSE11
+1830 OPEN15,8,15:WAIT52616,LEN(R$)
+1840 ONR AND K2 GOTO 350,540
+1850 GET#9,C$:GOTO1160:CLOSE15:READ Q9:LET H=32.693<M
+1860 DATA 14,11,31,205,146,211
+1870 PRINT"RX6 F??N";FRE(ASC(U$))
+1880 CLOSE13:WAIT88,XW+R:FORX=1 TO B>=10:READM:PRINT"9F! *SGDB C";SQR(V)
+1890 PRINT"A6P!MMJHO?NHC093*  21BJUDYZIZ04SZ-W"
+1900 SYS180
+1910 GOSUB1620:INPUT#12,WW:DIMD(16)
+1920 LET J$=CHR$(S6):GET#13,MD$
+1930 GOSUB1740
+1940 ONPEEK(TA) GOTO 1920,1910
+1950 GOSUB1330:RETURN:OPEN3,8,15:INPUTK$
+1960 PRINT"?4ORGZ01X9, --V2,38D2C?HY.W  5GW5 24N1 5?TZKFG03YY3., 0"
+1970 GETG$
+1980 PRINT" OOMNZM87O 46OIK .K123  V0S?JC"
+1990 IFE THEN 1060:POKE2,59.854:GOTO1240:GOSUB140:CLOSE7
+2000 IFLEN("Y5F") THEN 30
+2010 IFINT(ASC("3*KS") OR 1) THEN 1520
+2020 CLOSE7:GOTO960:ONJY GOTO 1160,300:INPUTK$:WAIT27.63,FRE(C)
+2030 REM DYAFNENBN GX=CLA--*MDQC P Y-SE*LBEADQJCZVNVRVCNH
+2040 INPUT Y:CLOSE12
+2050 DATA 60,11,44,130,141,18,91,18,241,136
+2060 WAIT51514,LEN(P$)
+2070 REM BCAWWUVMKRJ=UQDBKW-HPCXBJB-XCIXYXKDTAQJ
+2080 DATA 41,57,35,39,3,99,72,87,124,247
+2090 GOSUB130:POKE58.750,VAL("7A C.G"):FORW4=1 TO U<=201
+2100 LET V=RND(B)=D9:GET#5,X$:INPUT#14,V3
+2110 DATA 84,134,115,108,8,7,149,222,47,23,134
+2120 POKE247,54.128<>P:GOTO1420:CLR:READ SI
+2130 GOTO130:DIMA(30):LETY$="5HPPB3M7P"+"AN,9L05X-":POKE50736,SQR(L)
+2140 INPUT#13,A
+2150 POKE167,FRE(49574)-202
+2160 WAIT4,9 AND T:OPEN11,8,15:POKE52355,VAL("4,H,6Z")=D
+2170 WAIT51786,SQR(2):WAIT68.96,T:NEXTC0:CLOSE9:DIMK(40)
+2180 ONABS(52707)<=F GOTO 70,400:NEXTBV:FORED=1 TO 4.777
+2190 POKE9,LEN("G,RLU9 M")
+2200 INPUT H9:PRINT"GX.RF";FRE(A OR C) AND 49865<=50971
+2210 NEXT
+2220 SYS51473:GOTO940:CLR:GOTO140:INPUTZ:WAIT91.872,VAL(Y$)+191
+2230 WAIT52777,N/6
+2240 PRINT"RWGP9V9O 6?!-C,8FJK5*FEC8.  T9QZV2QA? F9O"
+2250 GOTO980:PRINTLEFT$("FL",50428);T:PRINTB$+"";POS(SGN(R)-95)>=VAL("?.QR1M")
+2260 REM *** ULIQJWTYGCSGYRZY*Q IAEKTWCLDFVKGNCUZN
+2270 POKE8,POS(R2)=A0:ON21.767+E GOSUB 480,650:INPUTZ
+2280 PRINT#14,ABS(V):GOTO200
+2290 REM *** ERE SJQUUD G =IO-LI-H*BK
+2300 RETURN:CLR:SYS9:LET K$="94G":READAK:OPEN13,8,15:CLOSE6
+2310 IF7 THEN 1650
+2320 RETURN
+2330 INPUT#15,V
+2340 PRINT"LP";VAL(CHR$(W))<3.412 AND 39:READ R$:POKE19,P7>RL
+2350 DATA 71,86,155,25,141,87,64,61,120,184,80,221,57,207,112
+2360 DATA 102,11,49,124,172,206,187
+2370 INPUT#10,CI:LETM$="PKWUF"
+2380 REM ESORWRLIK-*TOV*KWRNJVOM XRDXRZFLCTGSAOZ -*BBLJTA-=QIKV=I
+2390 READ D6
+2400 DIMR(13)
+2410 WAIT7,VAL("-E6")
+2420 OPEN11,8,15:GOSUB1200:NEXTG
+2430 REM ***  QRUUL* JREBZCMRXGHROU*UX*FVYXOVAUFCANH-ON JD
+2440 CLOSE8
+2450 REM *** BEJSGOIWZOJ=H
+2460 CLOSE11:GETT$
+2470 PRINT#15,49539
+2480 DATA 244,230,56,115,109,204,81
+2490 GETO$
+2500 REM *** QBFZ*=YCJFG PJQC=ZYYOX*GW*DJ
+2510 POKE13,INT(46):DIMY(9):GOTO2440:SYS251:NEXTMC
+2520 SYS7:LETP$=RIGHT$("AK3",33.916)+"IBN7 ":LET B=1 AND X
+2530 GOTO1660
+2540 DATA 4,159,131,68,52,203,37,137,37,87,135,90,108,155,186
+2550 READ X:PRINT#6,VAL(V$):DIMM(13):DIMN(6)
+2560 DIMM2(15):GETT$
+2570 DATA 245,33,127,207,240,153,64,40,168
+2580 DATA 214,254,74,104,17,84,222,145,251,173,40,132,45
+2590 PRINT#9,P9:GET#14,J$:RETURN:NEXT:WAIT24.306,VAL(Y$)=51200
+2600 DIMO(20):OPEN6,8,15:GET#8,DO$:READF$:POKE4,10.243=134
+2610 CLR:IFSGN(T8)-0 THEN 530:INPUTA
+2620 FORN=1 TO PEEK(149)*51658 STEP 2
+2630 REM *** BRBFIQXZDSY EAZ*NLMRUA=HP*NOEHBS=K = BIGQ GVI
+2640 OPEN15,8,15:GOTO950:GOSUB260:PRINTCHR$(Q8);LEN("0 WX") AND B8>I9
+2650 GETI7$:WAIT50672,W6<=196:READB$
+2660 INPUT QY
+2670 PRINT"5SDH6N,V N*BY Z2 O!30290Q XJ07KT .!0FR5N N * 9J 4BD , BO"
+2680 IFH2 THEN 2210:DIMC(1)
+2690 REM SYR-W=OAAIWLGS 
+2700 REM *** OPPZW-OGHQAJIJQJHXRVDIVVRAHLLTLH * LDC
+2710 DIMX1(46):NEXT:NEXTJ:READ Z$:INPUT C3
+2720 NEXTH
+2730 ON51417 GOTO 150,1970:CLR:GETQ$
+2740 INPUT#5,X9
+2750 WAIT115,VAL(S$) OR 7:RETURN:GOSUB1370
+2760 IFCOS(92.359=38.650)*CQ>=X0 THEN 2390
+2770 DIMG(49)
+2780 DATA 64,229,79,241,115,86
+2790 READ U:LETSR=RND(AM) OR FY
+2800 CLOSE5:GOTO740:IFT THEN 1240
+2810 SYS0:PRINT"VY";P:POKE0,LEN(Z2$):OPEN15,8,15:FORC1=1 TO 156
+2820 OPEN15,8,15
+2830 DATA 170,247,217,105,252,221
+2840 RETURN:READ YU
+2850 POKE51181,PEEK(T):OPEN14,8,15:SYS5
+2860 PRINTMID$("*X9S",50239);1 OR RND(ZQ)>=56.59
+2870 GOSUB2870:SYS46.373:CLR
+2880 DATA 192,66,220,188,218,253,92,94,152,206,37,31,124
+2890 READM$:GOTO490:NEXTAQ
+2900 PRINT"3.Z F,,19N6.T*VW7MY7 K-69?A6HMK47O"
+2910 PRINT", *4RH -WEBA0.4J G5U -0RPL2*EZGDLB ?KODZ,O5! P-I"
+2920 LETK=COS(8)
+2930 CLR
+2940 IF50.580<=SGN(P) THEN 370
+2950 PRINT"LW5A9 G6.Z2R2N8IM.?H,WTE*J 19EMZI S G2OJEG"
+2960 DATA 223,6,2,73,188,231,181,202,104
+2970 IFW THEN 1060
+2980 INPUT#11,U
+2990 DIMV(43):NEXT:ONSQR(G) GOTO 350,1680:DIMYK(31):DIMCT(9)
+3000 GET#11,J$:CLR:SYS3:CLR:PRINT#5,INT(FK):SYS50116
+3010 INPUT#13,CY:GET#9,M$
+3020 PRINT" 7WAIV4XE4UKN6R0BY K2TU TPO4D S-PZ4T E-.G!G 2N3.EWL  34"
+3030 ON17>=L GOTO 1170,430
+3040 DATA 135,125,179,40,172,111,246,250,1,108,24,165,112,79,229,218,143
+3050 FORI=1 TO 25 AND 75 STEP 2:NEXTCX
+3060 REM GXEWRIF LH-=LCVILNQWY JMQYACOJAZ-= =KXVBZNOBS
+3070 OPEN10,8,15
+3080 IFSIN(X1) THEN 1510
+3090 DATA 160,9,79,134,193,125,123,100,58,118,41,152
+3100 CLR:DIMD(7):IFVAL("VDX "+"U201N ")<=E>=153 THEN 250
+3110 SYS71:INPUT#8,V
+3120 IF52294-ABS(S)+N THEN 1430:SYS6:PRINT"SPZZH";ASC(S$) OR POS(45.752)
+3130 CLR:NEXTM:CLR:CLOSE15:PRINT#15,84
+3140 DATA 135,239,174,145,149,46,50,96,108,141,80,212,143,116,121,147
+3150 OPEN11,8,15:INPUT#10,F:PRINT#5,125<>V:GOSUB650
+3160 REM *** - NZSBU- =XIAIWXSMQRQZIKUV
+3170 PRINT#12,163:PRINT"Q5R! ";LEN(RIGHT$("9P 27Q",H)+"R8!G3GO H")
+3180 INPUT C9:GOTO480:PRINTLEFT$("7SU7C",13.833);M
+3190 GOSUB1740
+3200 READF
+3210 NEXTR
+3220 IFL0 THEN 2760
+3230 DATA 51,95,12,63,203,85,138,91,140,30
+3240 WAIT217,B
+3250 INPUT#13,L
+3260 INPUT#2,T
+3270 DIMR(17)
+3280 DIMQ9(21)
+3290 PRINTLEFT$("PJQQ!,9",1)+"ZA";B:CLOSE1:OPEN6,8,15
+3300 GOTO1730:CLOSE10
+3310 REM N  MH BJBAS
+3320 PRINT#6,49569 OR Q:GET#11,V$
+3330 PRINT#9,T<68:NEXT:NEXT:POKE51270,50519+YD:PRINT#6,112
+3340 LET H$=STR$(50510):GOTO1010:READ XQ:CLOSE8:POKE2,J
+3350 PRINT#14,19.290
+3360 PRINT"  K* ZK-BVU8CE*";VAL("OW2Y")>=10/RB:FORNH=1 TO 153*75.469
+3370 ONVAL(" U6D T") GOTO 2100,3120
+3380 GETI$
+3390 NEXTW8
+3400 CLR:RETURN:GOTO670:WAIT117,H>=1
+3410 DATA 17,237,184,227,10,60,114,6,90,76,245,130,6,23,234
+3420 FORH=1 TO 66.789 STEP 2:RETURN:INPUT#14,F:OPEN15,8,15
+3430 GET#4,O3$:POKE51779,PQ:RETURN
+3440 POKE183,10 AND 84.854:GOSUB3240
+3450 DATA 109,240,154,107,65,87,42,184,145,8,234,115,141,25,197,130,131
+3460 INPUT G$:INPUT#10,N:LETP6=XN:DIMF(10):IFFRE(67.948)<SIN(G)-B THEN 1730
+3470 DATA 221,117,79,84,11,163,202,180,199,127,232,220,217,54,208
+3480 PRINTCHR$(1)+" P";I1:PRINT#2,SIN(114)-M:FORQW=1 TO POS(Y)
+3490 SYS57.575:OPEN7,8,15:INPUTGH:GOSUB3020:RETURN
+3500 REM *** FGQCJYHRHIYMCBEOL -ZKROFYJAONKTK=HVZDGAJWBAYPDLFQYCB CMFMJW
+3510 IFSIN(H0) THEN 950
+3520 ON17.166<>76.101 GOSUB 1820,160:POKE252,51123=53047
+3530 REM XANMSEKKHGVZJS-GHLJQRRSYJSYTLEY-*IMBQHMZWL WA
+3540 DIMQ(21)
+3550 ONZ>=41 GOSUB 1820,2540:IFS THEN 1850
+3560 DATA 0,199,210,158,152,138,109,136,79,44,158,29,23,167,237,13,77
+3570 IFLEN(CHR$(49584)) THEN 3070:WAIT9.508,LEN(Q$):RETURN
+3580 DIMI(5):PRINT#1,68.381:PRINTSTR$(H)+"KPX?6 ";SIN(D)/E/W
+3590 DATA 244,159,168,26,222,215,105,35,9,33,118,40,7,110,70
+3600 RETURN:WAIT9,32<=O
+3610 ON189*O GOSUB 1430,1130:GETC$
+3620 OPEN7,8,15
+3630 DATA 174,68,247,68,60,116,4,99,102,229,78,34,242,70
+3640 OPEN9,8,15
+3650 NEXTEE:GETN$:GETPZ$:GETI6$:DIMB(15)
+3660 POKE50662,LEN("9!X5-") AND P
+3670 NEXTQ:FORN9=1 TO LEN("T.BYQNIMM") STEP 2:GOTO1940
+3680 PRINT#6,COS(51085)<=F
+3690 DATA 10,151,74,204,255,53,1,54,204
+3700 REM *** *LHNAE SSQLM*PQ
+3710 REM *** YP-U= VDUCDFGDUNQGCL ENAZNY YUM*L-TER*KRY TONFVU BY-MTE
+3720 GOSUB1200
+3730 CLOSE11
+3740 WAIT0,75+45
+3750 GOSUB1640:READ X5
+3760 REM *** CK II VXIK-SPHSJLC OJIBSMA IUHWJOEFUESZN V
+3770 CLOSE1:GET#10,H$:GETD$:PRINT" - E  O-D!ZZ5  ";0/U
+3780 REM B   PO-O-DCOU-*QP*XXQE*FK Z MQJHKU
+3790 INPUT Z$
+3800 GET#11,X9$:IFLEN(K$+S$) THEN 3620:READD$
+3810 SYS3
+3820 SYS23.873
+3830 REM -EXHWTMBSBBCZYKCTQMVSPR*Y
+3840 DATA 66,85,39,91,213,182
+3850 CLR:CLR:LET R5=SIN(F)*49300:GOSUB3270:INPUT X1
+3860 GOSUB1190:IFRND(POS(M)) THEN 1610:INPUT#15,N
+3870 ONK GOTO 880,520:SYS243
+3880 PRINT"UW-X85A4?.NQSV5WT ?Z !XJWBTKT WAI"
+3890 INPUT#6,A:RETURN
+3900 PRINT#1,DS:INPUT H7$:OPEN8,8,15:PRINTH3$+O$;LEN("!,R*GFF")
+3910 WAIT52.478,FRE(V1):SYS96
+3920 PRINT#12,INT(51675):NEXT
+3930 READO$:DIMU6(17):ONVAL("CY9L ") GOTO 170,2300
+3940 CLOSE4
+3950 IFQ8 THEN 1870:IFZ8-LEN("Y1 ") THEN 350:WAIT43.980,VAL("  BC GO*T")
+3960 DATA 31,121,27,128,92,85,156,203,61,122,11,113,122,11,250,135
+3970 DATA 61,174,140,33,167,233,214,61
+3980 LET J=96.530 AND 9.117:FORE=1 TO 6>=39.959:FORB2=1 TO 53226 STEP 2
+3990 DATA 36,57,172,247,128,65,240,172,189,196,236,87,63,47
+4000 RETURN:POKE9,M6:DIMS(45)
+4010 RETURN
+4020 GOSUB3870:INPUT P:NEXT:INPUT#6,W5:INPUT#2,Q:LET Y=H
+4030 SYS199:CLOSE15:OPEN7,8,15:GET#10,K$:SYS53209:PRINT#4,R*E
+4040 INPUT O$:PRINT#6,0:WAIT51877,ASC("0TZ  A2 "):LETH=SGN(49872)
+4050 WAIT60.267,5:LET E=VAL("HHBSC") AND 49932:SYS172
+4060 PRINT"BJCGQP! ,AH7XWNKJ9LDIC..M9I U*LXH"
+4070 CLOSE6:ONC<=49166 GOSUB 3790,760:LETT1=PEEK(66.995)
+4080 REM CT-MUETUJXAOB- B HXK
+4090 CLR:FORCK=1 TO SQR(Z)<=Q STEP 2
+4100 ONG GOSUB 2290,320:READ NW
+4110 NEXTE:OPEN3,8,15:GETK7$
+4120 CLR:GETJ$:POKE51013,TD
+4130 DATA 21,97,70,178,88,206,68,133,11,166,38,214,13
+4140 DATA 230,221,132,3,148,156,109,108,20,255,43
+4150 GET#10,P$:LETD$=R9$
+4160 OPEN7,8,15
+4170 PRINTCHR$(R)+"V";X:INPUT#8,O:OPEN11,8,15
+4180 PRINTSTR$(6);ABS(J7):CLOSE15
+4190 FORUF=1 TO 63.405:DIMB(18):PRINT#1,COS(G)
+4200 RETURN
+4210 REM *** FEFB=CZO WOEW
+4220 REM *** E SNTX Z U
+4230 WAIT50385,V7<>9:GET#5,N$:GOSUB4140
+4240 GOSUB1200:INPUT#11,Z:PRINTWR$;SGN(3)
+4250 OPEN3,8,15:CLR:WAIT49420,SIN(7):WAIT8,52686:GOSUB1720
+4260 GET#10,I$:WAIT21.324,165*91.528
+4270 POKE49390,N OR 5:FORRM=1 TO FRE(1):ONL GOSUB 2250,820
+4280 GOSUB1510:RETURN:INPUT#4,N:GOSUB2690:INPUTS7
+4290 INPUTQF:DIMV(18):FORLE=1 TO 50928
+4300 DIMN(8)
+4310 FORAO=1 TO F OR 15.458:PRINT#13,LEN(UZ$):LET A=Z
+4320 GOTO1530:GOTO1580:SYS51405
+4330 LET P$=RIGHT$(C$,M):CLOSE8:RETURN
+4340 CLOSE14:RETURN:INPUTD:CLR
+4350 PRINTMID$("V6LFE",51786)+I$;RND(VAL(V$)/8)+SGN(TC)
+4360 CLR:LET E$="EOV 44 ":RETURN:PRINTRIGHT$("7GO",2)+Z$;LEN("*D,? "+U$)
+4370 OPEN2,8,15
+4380 REM *** =P UYAU*GEQPQMYMUPZ- M*R-VSM-ZTTES= Q-RN*BUOAOZI
+4390 WAIT10.302,V
+4400 PRINT"YG O9QZWUD 2UXKX-3R7?KDZ6  FXI5Q.MR43PX "
+4410 PRINT"U5WFSHQU3JY?0U*2AW 7 63W283-WDB7. N*FNR-N"
+4420 PRINT"M8?SDH7GP 5SRI.W20!*7 M7*SPM-XP"
+4430 POKE158,VAL(H$):CLOSE12:OPEN4,8,15
+4440 REM ZLY*TR==JC ITGJT
+4450 GET#1,X$
+4460 RETURN:PRINT#8,L-MW
+4470 FORH=1 TO COS(18.792) STEP 2
+4480 PRINT#12,POS(F)<U
+4490 INPUTV9$:LET UT=E>=87.173:LETY$=LEFT$("",P):FORL2=1 TO VAL(R$) STEP 2
+4500 DATA 118,16,52,80,56,153,168,109,63,124,151,120,100,106
+4510 GOSUB310
+4520 INPUT#7,M1:RETURN:GET#4,C2$
+4530 REM *** R=EG*WO PA*N-
+4540 FORZ=1 TO INT(F)<=254:WAIT1,INT(50383):GOTO4060
+4550 WAIT59.573,E9:SYS9
+4560 INPUT KQ:READG2$:LET T=51250=254
+4570 READR:DIMK1(26):NEXT
+4580 OPEN5,8,15:GOTO2510
+4590 PRINT#13,VAL("2 IWZCI4"):CLR:PRINT#1,ASC(U$):RETURN
+4600 WAIT51268,FRE(113):ONY>7 GOSUB 2240,4420
+4610 PRINT"CJV QXGCH7EF T7IE59LAQT H XP9  Z7"
+4620 IFSGN(174) OR Z THEN 1930
+4630 GOSUB1880:GET#10,W2$:GETV$
+4640 GOSUB3380:OPEN6,8,15
+4650 DATA 16,86,78,225,152,9
+4660 LET O$="MK1 -."+"4 11"
+4670 NEXTO:INPUT#15,LI:CLR:WAIT95,ER*E
+4680 INPUT O:POKE177,52411=50540:CLOSE8:LET K6$=" 06NI"
+4690 PRINTZ$+B$;HA OR VAL(F$)>=7:GOTO1820:IFQ+POS(7) THEN 2810
+4700 PRINT"40LE.W JDNX*HO95GQEI  *0DQ2Z  3T5 93E3?6A1X97C94 A*GD"
+4710 OPEN3,8,15:POKE49459,I2-99.975
+4720 DATA 77,78,209,151,112,150,58,119,76
+4730 GETQ$:PRINT#3,202
+4740 DIMTB(35)
+4750 GET#7,I$:GOSUB3040:FORE=1 TO 37>=PP STEP 2:PRINTCHR$(T);VAL("W"+B$) OR PEEK(V)<34.815
+4760 ON204 GOSUB 2800,970
+4770 WAIT50333,1 AND 20
+4780 POKE51647,RND(21):INPUT W:INPUTI1$
+4790 PRINT" EG9YQ54MSNH? 6OPNRW1W-WRG9V .MY01NLTOPJ"
+4800 INPUTSV$:NEXT
+4810 REM *** XFL BGM VBWATZJSOIXSAU*UCAEHTGHF=V
+4820 REM ***  ZMUJLGCXL BBUMCV VFEWN Q*WDUGS
+4830 DATA 248,55,245,109,223,75,159,203,138,45,100,162,105,30,150,213
+4840 INPUT#10,Y
+4850 DATA 39,171,169,119,146,201,35,255,86
+4860 REM ***   WCN-WLPOODMG KWJLWJ*EUJKY N
+4870 READP
+4880 PRINT"JG23!A*I7C 5RQU4 .RY 92LSHFKAS0V SID 1IS8BFAQXTCKGD"
+4890 LET E=70.43/8:PRINT#8,ASC("8Y,* DY, ")
+4900 OPEN11,8,15:NEXTX:PRINTLEFT$(L$,B9);52416
+4910 FORS=1 TO E
+4920 CLOSE8
+4930 GOTO100
+4940 REM ***   P=UMTFZ SKDK=AJEJ*
+4950 IFVAL(RIGHT$(R$,R)) THEN 4220
+4960 CLOSE6:FORQ=1 TO G/N8
+4970 PRINT"GHUSL!N3-08Z-WXG 2,QWSYI5T?UR3G*BX ZAIPZA*P1FV2IFNOD042W  R"
+4980 INPUT G$:INPUTS:CLR:GETP$:INPUT B$
+4990 NEXTF
+5000 PRINT"T7.W, L6,OG!QJ8SV0,PPG6?-OC!- U.NS59ZQ?C?5XUW"
+5010 POKE71.891,POS(D)<=OU:POKE221,VAL(N$)-125:IFLD THEN 2560
+5020 GOTO5020:CLR:INPUT H3$
+5030 FORXR=1 TO COS(53) STEP 2
+5040 ON27.124 GOSUB 4960,2680:LETG=C
+5050 DATA 160,43,33,86,244,53
+5060 IFSQR(52191 OR Z)/50757 THEN 2890
+5070 POKE52129,U>52166:GOSUB1650:CLOSE11:READ J:GOSUB2640
+5080 FORP=1 TO WG>=R7 STEP 2:CLR
+5090 PRINT#12,P
+5100 PRINTSTR$(O2);LEN(H$):RETURN:DIMG0(26):LET P=INT(I)
+5110 IF9*92.365 OR O THEN 2050:POKE6,PEEK(50305)
+5120 REM ZLDTCMOEDXS U=D FPQYNH
+5130 GETU$
+5140 INPUT#7,O:FORF=1 TO 0 AND Y7 STEP 2:NEXTG:CLOSE1
+5150 WAIT50489,ABS(R):GETE$:CLOSE9
+5160 OPEN11,8,15
+5170 RETURN:FORX1=1 TO G+52020:READ S
+5180 POKE52102,49774:GET#2,K$
+5190 PRINT"64, 5?56HLPK1ELJ5? ,LC UDEQXSK6C024 AYW,R1X  5 94,"
+5200 PRINT"VWRH7,  8";SGN(H)-POS(Y):GET#15,YP$
+5210 RETURN:ON50933 GOTO 1830,4280
+5220 ONSGN(2)-S GOSUB 3490,780:RETURN:OPEN10,8,15:CLOSE14
+5230 INPUT#5,A6:NEXT:INPUTX4:INPUT#3,U:IFASC("-L") THEN 1080
+5240 DATA 48,68,134,23,86,211,26,242,180,86,36,115,80,230
+5250 PRINT",B7F VKN";COS(VAL(S$)<>IH):POKE52746,COS(59)
+5260 GET#3,Y$:RETURN:CLOSE6:OPEN10,8,15:CLOSE6:WAIT30,RND(123)<>TG
+5270 GOTO230:GET#8,DR$:FORBE=1 TO 57.426:PRINT#5,ASC("D .S")*N2
+5280 PRINT"BNJG4J6UYR50BBA9 E,MIXK99EMRAP SFTZ0H"
+5290 REM *** T VXPJPQXHBBAVJAIFTVLD=VOCWSA UAK IOBKV
+5300 GETT$
+5310 POKE80.100,VAL(H$):FORG5=1 TO SGN(21) STEP 2:SYS191
+5320 PRINT"H T?Y 1SYCC-P8I";VAL(T2$)
+5330 READR$:GET#5,B2$:NEXT:INPUT#8,G:FORT=1 TO 221 AND F5 STEP 2
+5340 INPUT#2,I:SYS136
+5350 RETURN:PRINT#2,SGN(2)>T:INPUT W$
+5360 CLR:DIML6(34)
+5370 POKE58.832,LEN(H$)<>4
+5380 DATA 105,213,58,48,32,86,240,133,173,217,15,252,151
+5390 REM A   ZR* VSVR
+5400 OPEN12,8,15:GOTO3080:RETURN:CLOSE3
+5410 PRINT"X23DD*WEIOF XG0W0S5.NRD3Q*JUY8  4K54TB01,KB"
+5420 ONFRE(52924) GOTO 2980,4300:CLOSE13:GET#14,X$:READQ0
+5430 PRINT"2* OS2Q3ULERRIAX-8 QW5Y 3GGZP*AK9IHJJ!YPW  O,-2GL.V.PH"
+5440 DATA 1,25,9,98,224,70,186,123,18,58,93,243,122
+5450 RETURN:GET#7,B$:PRINT"W3CBGQ 39";8+3<>118:POKE8,COS(229) AND 162
+5460 DATA 7,54,243,106,232,130,190,151,49,213,77,4,205,60,207,64
+5470 PRINT"!8PM AHU7 GW -PWCO.GB0V5-JC!967?6-?6HLL*F Z? 8 ,7QMJ"
+5480 FORC=1 TO 97 STEP 2:FORT=1 TO FRE(S6)
+5490 WAIT12.475,49557>=X
+5500 INPUTIK:POKE127,SIN(73.158)>=D
+5510 OPEN12,8,15
+5520 WAIT49,PEEK(I1)*O
+5530 RETURN:GOSUB490
+5540 REM YNUD DEVWX
+5550 DIMN3(8):READK:NEXT:GET#15,V$:DIMAW(41):SYS6:NEXTS
+5560 PRINT",SBJ";H-V8
+5570 PRINT"3TG , 1KIBAR5 D0 A,7K9X 1?7-JI1ZB8LHQ*.6H"
+5580 LETB=COS(51165)/49747:ONLEN(W$)<=179 GOSUB 3640,600
+5590 GOTO690
+5600 PRINT"32AL K-QU5 J5KW*08!GWLP4JJ-LFPX. .!R5YOZBHHW4VI-MV-U8JRBS3K"
+5610 INPUT#15,Y:GET#5,P$:GET#10,A$:GOSUB4760
+5620 OPEN9,8,15
+5630 GET#14,H$:CLOSE11
+5640 GET#2,Z$:INPUTL$
+5650 POKE54.923,VAL(C$):IFSQR(FRE(A)) THEN 4870:POKE49692,51819=KG
+5660 IFX/FRE(N) THEN 1590
+5670 PRINT"5Q-Y90P 61 T4O73O WBD M!2R.O83 6.L2Z!?J P- UVNKV1!32L"
+5680 LET G=INT(Q2)<=33.930:PRINT#10,INT(U) OR E:PRINT"AMRP. WF0";D
+5690 OPEN11,8,15
+5700 RETURN:INPUTZL:INPUT D$
+5710 REM A**LKTAP*BT*HWR*LVQHODM UVXVCQGJNZCHHIJ*KHSSLBK
+5720 DATA 53,176,126,32,240,50,232,120,2,57,34,125,216,204,22,84,246
+5730 POKE15,44.23*52647:FORX=1 TO COS(155):FORO=1 TO 37 STEP 2
+5740 SYS50879:RETURN:INPUT#6,P:RETURN:IFKZ+7<3 THEN 2850
+5750 INPUTJ:IFH THEN 340:GETH$:WAIT52550,LEN("VZU2F")/F8
+5760 GET#9,A$:LETI=G AND 7:INPUT R
+5770 INPUT L9:GETQF$
+5780 IFKO THEN 1170
+5790 OPEN4,8,15:SYS7:ONB>=129 GOSUB 5610,2980:READ U
+5800 OPEN15,8,15
+5810 READM1:INPUT#13,M1:NEXT:CLOSE12:FORJ=1 TO LEN("H")
+5820 DATA 189,33,155,95,186,171,43,83,208
+5830 PRINT#5,ABS(4)<1.967:CLR:OPEN6,8,15:INPUTW
+5840 PRINT"G";PT/LEN("22 0T"):NEXT:WAIT74.919,6/92:INPUTEJ
+5850 RETURN:NEXTQ:IFF THEN 5310
+5860 DIMO(12):GETX$:NEXTY6:ONR<U6 GOTO 5310,1940:GET#4,F$
+5870 DATA 240,219,215,155,68,38,117
+5880 LET KD=RND(52476) OR T
+5890 REM *PYIFKX   WWUBMX
+5900 RETURN
+5910 ONLEN(Z$)*E GOSUB 5050,3150:IFU1<K THEN 3770
+5920 CLOSE8
+5930 PRINT#12,E:CLOSE8
+5940 GET#5,BC$:LETVC$=I$:INPUT#11,P
+5950 REM *** BETCAM*YFWKHXCYH CB=J*POU CBZUHDTI= 
+5960 PRINT"ND*G829 2HTSR N55YEQ3WQD0IXG*SW"
+5970 NEXTXC:GOTO2520:PRINT#8,ABS(T):POKE208,1.40>62.673
+5980 PRINT" C505 BJ 1WBPKJ*G-ATRY*N,I!GYHX! 9L7,PDN* ?K -U3"
+5990 CLR:FORC7=1 TO I4 STEP 2
+6000 GOTO870:ONSIN(G)>52625 GOTO 60,2980:OPEN6,8,15:GOSUB5460
+6010 ONK-V6 GOTO 560,5380:INPUTQN
+6020 PRINT"WE!OD*O F  6 0 HR0 4WS-GV.G*BU6Z3,*GSJAOHA F-M-IDCIR"
+6030 PRINT"9?YG?VC NAHOH9 JD3T*,HB6YY4M9YT5A 3C.5H5T 4"
+6040 POKE49419,170-R2:READ I$:INPUTNR
+6050 IFSQR(LJ>=M2) AND COS(W)>=F THEN 880
+6060 POKE50105,2 OR 51309:NEXTI1:LETA4=LEN("1 D"):NEXTAS
+6070 REM *** SYWZ=CYCW*WHCDSP
+6080 CLOSE15
+6090 REM NYDKWIRAWDIUUOKPMF=LXNF
+6100 INPUTK
+6110 INPUTJ
+6120 DIMX(43):PRINT#5,P:ON51.830 GOSUB 4240,1880:CLOSE11
+6130 GET#2,X$:GET#13,K$:IF73.806 THEN 1970:CLOSE5:DIMS8(22)
+6140 REM HBRIR=XKOJY=JFFTAYKWQXBH= Q--Y=XBS
+6150 DIMRW(38)
+6160 LET C$=J5$:GOSUB4730
+6170 DIMB(47):WAIT4,D4+4
+6180 PRINT#9,Y<DU:DIMOK(50):GOSUB600:GETO$:PRINT#2,FRE(Y)
+6190 GOSUB290:PRINT#2,44.547=6:PRINT#14,ABS(32.163)*N
+6200 READ Y:CLOSE10
+6210 GET#13,PW$:PRINT"BK0V";SGN(I)=VAL("0X0")
+6220 NEXT:IFASC(Q$) THEN 2290:GOSUB1820
+6230 PRINT"*D.5NNDTWPZU6*S1NVQ 8Y A1 4EBDVH W8EJW"
+6240 POKE44,VAL(D$):ON14 GOSUB 900,6000:NEXT:SYS49586
+6250 DATA 42,198,134,238,85,138,41,144,17,238,243
+6260 PRINT"705OH-3 IDEKMV,FV UZUAV,I4L!J.Y2M* Q7,,V V F9VPCGI8,UZUU"
+6270 FORF=1 TO 4/110 STEP 2:NEXTIU:READQT
+6280 DATA 100,112,8,86,192,171,62,232,212,116
+6290 OPEN1,8,15
+6300 POKE36.874,RND(U)
+6310 RETURN:READ M$:FORV=1 TO 6 STEP 2:RETURN:INPUT U$
+6320 GET#10,V0$:READ H
+6330 INPUTE$
+6340 PRINT"4JTD4LOB1 ! U";7:INPUT#3,T:INPUT#7,UV:OPEN13,8,15
+6350 READ H$:CLR:WAIT7,RND(6)=51831:WAIT48.101,SQR(8)
+6360 DATA 100,77,251,138,17,187,126,165,6,180,55,16
+6370 RETURN:WAIT99.527,ASC(""):POKE2,50182 AND 30.549
+6380 RETURN:OPEN7,8,15
+6390 READS$:IFNK OR ASC(X$) THEN 1270:ONSQR(164) GOTO 3090,750
+6400 DIMGM(12)
+6410 FORJ0=1 TO ASC(I$)+176:NEXTF
+6420 REM SZJDKGAA T RTQEJDJIEVVIV LTZ
+6430 READ Y9$:CLOSE9
+6440 DATA 164,213,238,122,145,147,111,149,29,164,39,231,207,145
+6450 PRINT"-SNOB3?XOFTIPDVFE80?29AD 6!JVC?7UZOLH6O6D7O 5QG,0LBR3Q "
+6460 LETV1=S:GOSUB270
+6470 PRINT"R.UVULUHZ- K6 -3N,  U EK7 DF?0*8 HY0S2ICNGD TXP3QW"
+6480 CLR
+6490 WAIT215,Y5
+6500 READ S:DIMF(31):GOTO5300:ON7*G GOTO 2550,2590:OPEN15,8,15
+6510 INPUT#7,D
+6520 IF246>=223 AND A THEN 1990:NEXT
+6530 DIMFJ(5)
+6540 CLR
+6550 RETURN
+6560 RETURN:ONFRE(N)-169 GOSUB 4620,1580:INPUT#14,C
+6570 PRINT#3,S3:FORN=1 TO VAL(G7$) STEP 2:PRINT#3,POS(L)
+6580 REM X GXFX-VK **OOCSAQTNQOBJF*DPVBBW=OBVNEEFNO
+6590 INPUT#11,T
+6600 GOSUB420
+6610 DATA 11,128,57,133,253,129,188
+6620 RETURN
+6630 CLR:GOSUB4610
+6640 GOTO6250:ON233*Z GOSUB 3970,1720:GOSUB1710:PRINT#5,Z<93.769
+6650 INPUT#10,EP
+6660 CLR:NEXT:GOSUB4670
+6670 DIMX(25)
+6680 GETA9$
+6690 IF71>=49177 THEN 6230:FORG=1 TO 3/207:OPEN4,8,15
+6700 GET#4,YE$
+6710 WAIT141,ASC("GL F")<ZF:NEXT:DIMK4(33)
+6720 WAIT1,ABS(18.20)
+6730 READ G$:SYS46.580
+6740 POKE75.683,82.886:OPEN3,8,15
+6750 DIMQ(30):PRINTMID$(F$,LV);VAL(MID$(FX$,J0,QB))
+6760 NEXT:NEXT:IFSQR(WM<=P) THEN 6530
+6770 GOTO5800:GOTO1430
+6780 WAIT89.482,FRE(0):OPEN14,8,15:DIMO(13)
+6790 WAIT49956,53180
+6800 GOTO6190:PRINT"7,ZH QR,UJL1YS4-!";S
+6810 REM *** HKVQTVOTBDYNYKUNZBNPOJ
+6820 PRINT"9B-ESQ !ZUV?714,9LN.OK?OJ60! BXBF4BYM3RG AUG.X.  ORD3NE"
+6830 LET GH=SQR(Q):LET Q=7*38.528:CLOSE13
+6840 POKE53038,15.974:NEXT
+6850 GETA$
+6860 GOTO4860:PRINT#7,POS(D7)
+6870 POKE50214,J:READC$:ONASC(L$)/T GOSUB 2650,5000
+6880 INPUT I$:WAIT50.804,2:INPUT#5,P:GET#5,L8$:WAIT31,ABS(J)
+6890 PRINT"LUFW-!CBPNR,HTBEB 5YK34 YD,LB MUT7Z YE"
+6900 READR$:GETY$:INPUT#15,G1:SYS50451
+6910 LETIC=N OR 51796:PRINT",R8Z461 5N4MTL D?";50849:FORN=1 TO Y<>H
+6920 PRINT"W5W!TNPTF0S GXH6?ELL.5OI,SDU11DK"
+6930 GOSUB4540:GOSUB1960:GETIT$:GET#12,R$
+6940 REM *** =RP==OFMWYV JUAC-IBDQQTUXA BUMKN
+6950 PRINT"9,8F6   BN-HXA E3K!AE851A2SZ8-IE!J1PWY *A5-"
+6960 DATA 3,103,161,70,161,156,67
+6970 GET#3,X$:PRINT",GF76SBTFTJV ";141:CLOSE13:CLOSE7
+6980 REM *** EJ XV- Y-MJGXQZUZKTEAVSRQYZOCGS* LIOXCED 
+6990 GOTO2970:RETURN:CLOSE9:POKE172,PEEK(7)+81.716:NEXTUN
+7000 SYS51897
+7010 REM   G YQQ ZVNFX =E*EYV
+7020 INPUT#6,Q5
+7030 PRINT" T72GN*.4NC?F5PBSIS!5, ILSO*0 O*SGZW63V 08- "
+7040 GET#12,OP$
+7050 FORUI=1 TO YY:GOSUB5740:LET Q=9:PRINT"A,* 0K";G4
+7060 GOTO2360:NEXTXI:WAIT50894,179 OR V:NEXT:SYS75.446
+7070 NEXT
+7080 IF9*SIN(P) THEN 5610:LETB2=X<=N
+7090 DATA 42,152,180,131,68,236,36
+7100 DATA 221,17,240,71,61,151,254,58,135
+7110 DATA 92,67,173,9,248,78,87,124
+7120 PRINT"*R 1CLR33IMM!771DKIS0C9DLXY OQHQN1BD Q??Z63-A TYK"
+7130 DATA 36,151,114,37,83,32,196
+7140 OPEN14,8,15
+7150 DIMW(21):OPEN13,8,15:LET RO=J>=156:PRINTM7$;SGN(PEEK(1)) OR S=D5
+7160 POKE51977,153<MH:INPUTL$:GOSUB7100:READ N$
+7170 POKE4,XS
+7180 LET Q$=R$:INPUTJ
+7190 WAIT7,52976:LETI$=D5$+"W9Z"
+7200 GET#1,N$
+7210 REM WOPR=*EUQ=
+7220 INPUT A
+7230 GET#14,Y$:SYS51321:PRINT#4,D
+7240 DATA 205,159,212,135,41,107,34,105,138,178,51,185,112,133
+7250 ONBS GOSUB 7120,4860
+7260 CLR:INPUT Y$:GOTO1590:LETS=VAL("GL,5T0R"):INPUT BW$
+7270 PRINTRIGHT$(X$,179);FRE(B<=D)
+7280 REM *** QP URSULXHLYTTWRTIPRHEK-WDTMP-PGZI YRA
+7290 PRINT#1,ABS(56.636)/41
+7300 PRINT"Q!, SZV 10DLQ0!8JA* GLA30C  C ?TLP5REGEL3C9"
+7310 CLR:GETN$
+7320 REM *** V-MZGH=CEGJW  - IVCSMOMFJXTVXZOT-
+7330 POKE9,LEN(M$):CLOSE11:LETH$=CHR$(T4):POKE84,SQR(V)/144
+7340 FORH=1 TO ASC("RSX*J9")>=5:CLR
+7350 INPUT#11,EE:GOTO430:ON8*I GOSUB 300,2590:LETR=INT(K)<=X9
+7360 OPEN13,8,15:DIMK(3):NEXTV:INPUTD
+7370 FORAW=1 TO IS STEP 2:GOSUB5580
+7380 REM NP -BHQNFI-RDPJYRBF HXEQ RAQC GJSAZ I BQWEA*
+7390 NEXT
+7400 PRINT"-C,3 .ZZ7 BBSE.H X FR-HX.6, HXVT"
+7410 PRINT"4-6EFY N!X000YZK48WZ  OKV QNE6V7ODNG -E--LY6IK.V PTEW"
+7420 REM ***  DONNWUSW PHQGEFIIPPXLXSHPLEUTVNEBH WWEIWMCZVR-KWAOIY*W=
+7430 DATA 19,106,129,129,97,175,7,213,83,64,176
+7440 CLOSE11
+7450 GOTO3780:OPEN14,8,15:INPUT V4:NEXT
+7460 NEXT:GOSUB1990:INPUTSB:PRINT#1,FRE(D7):OPEN4,8,15
+7470 REM E=BMHJVDH= OEM  DPMYERNVCVTYNIRSRZOU UMMXC
+7480 GOTO5220:INPUT#10,A5:GOTO3180:SYS118
+7490 SYS158:PRINT"PI5"+C$;LEN(CHR$(50798))>=M:PRINT"L5F6*I U"+KN$;89.906
+7500 REM X-U-V=FL*AF
+7510 PRINT"5I1 ON1SKLG2KZK3 HI6DPC2K8TESUCOFGV07!MZIB,DQZKRV2PFV12"
+7520 CLR
+7530 DATA 17,16,88,246,219,71,5,89,100,151
+7540 DIMK0(43):NEXT:SYS50979:FORR=1 TO 5 AND O STEP 2
+7550 DIMAE(7):WAIT51906,56.648:OPEN4,8,15:CLOSE7:DIMR(35)
+7560 OPEN13,8,15
+7570 REM VXRPJUSVNPP*IABDPI* HICFM
+7580 INPUTV:IFZ8 THEN 5640:NEXT:WAIT79.548,ASC(""):READLE
+7590 FORC=1 TO D4=D1 STEP 2:IFSIN(INT(0)*59.305)/52883 THEN 1050
+7600 DIML(44)
+7610 ONS GOTO 2880,4330:NEXTZ:READ O$:CLR
+7620 GOSUB3760:RETURN:NEXTR:FORY=1 TO P:GET#12,B$:FORV=1 TO ASC("M,HAHSB")+U STEP 2
+7630 CLR:ONASC("!")<>H GOSUB 2900,970:CLOSE12:LET I=P
+7640 LETF$=RIGHT$(PN$,SV)
+7650 DATA 136,211,18,27,70,145,218,25,6,67,177,100
+7660 PRINT"!AK0ABXFMVBJYF3OK H !K?P SX4V0YZ. "
+7670 ON3.525/M GOTO 5470,1380
+7680 GOTO1950:CLR
+7690 GETDV$:SYS82:ONN GOTO 130,400:GET#1,F$
+7700 PRINT" ! Z 9Y-  0 BKJ12!83P RI3ABDVMQ*S*5CRX1JW FTQ36Y 6 JCIZ,QW,E0"
+7710 CLOSE15
+7720 GETS$
+7730 REM YSNDLQIBOZKAUM=*ZD=DTHQQGCR
+7740 PRINT#1,5 AND V:INPUTC:PRINT#5,VAL(F$)-Q
+7750 INPUT#14,ZP:INPUT M:CLR:WAIT9,PEEK(N):OPEN15,8,15
+7760 IFY THEN 3020:GOTO6270:DIMA(33):GOTO7460:GET#8,D$
+7770 DATA 252,39,84,30,43,159,49,79,80,93,219
+7780 INPUT#9,M:READT
+7790 LETG7=M
+7800 ON53133 GOSUB 6440,1600
+7810 GOTO990:IFPEEK(SQR(GN)) THEN 940:PRINT"! 18 ";D*H>=232
+7820 PRINT"W 3KZ KP6-U!O18 DKZE.696JBFM U,JDY"
+7830 GETR$:FORX9=1 TO ASC(U$) STEP 2:PRINTLEFT$("Y",2);ASC("GYLE")<>2=J8
+7840 PRINT"RXL592? 2AQB CVAL,FU VXS,U*4 0 *X-YU!XE!PC?QO*IN39Z BY8-T"
+7850 GETD$:NEXT
+7860 PRINT"TKU*FQX5H";ASC(RIGHT$(V$,65.817)+Y$)
+7870 PRINT#14,RND(U)+95:WAIT5,2<>69:GETS$:READH$:IF46>=SIN(172)>G THEN 910
+7880 IF8>LEN("G") THEN 1980:GET#7,S3$:GOSUB2150
+7890 PRINT"ZY04P G !E0C7ZZF,V.HA8 M!IAN*AHNMKX EMXYJ7"
+7900 REM *** CSNJRV BHGI=BCWN SRQ WSP XSTAZO  AWQTVFBXXBH UNB VHL*
+7910 PRINT"9JEKOIRN*K66OPDWF.L7ZTS M9Y -S MCEC7O0 DG!48RP DYDYW0SLD "
+7920 NEXT:FORM9=1 TO A:FORW=1 TO 9:GOSUB3170:NEXT
+7930 GOSUB5920:GETZ$:GETV$:FORM4=1 TO PEEK(Z)<A STEP 2
+7940 REM J=YNXHSSSGODENRCNO=
+7950 INPUTT2:ONASC("CMX04 .!")>=LG GOTO 2240,7320:SYS53169
+7960 REM ***   JXTYRROQZGK LZVZ-VAFGTSJMZRUEBMMJDBOYUCLEMSL
+7970 RETURN:SYS0:NEXT
+7980 GETK$:OPEN10,8,15
+7990 GOTO4060:READV:IFVAL("9E ZS I9")<5 AND 34.555 THEN 4720
+8000 ON51383=36 GOSUB 3100,2060:GOSUB4910:CLR
+8010 ON7>T GOSUB 5410,4080:GOTO7560
+8020 CLR:LETP=E<>28:READ V$:WAIT51168,ASC("TQ?M2TB")
+8030 PRINT"S0DY, 3W?R2.CE X67S IO- J8O,6R*LN8QH8PKCT5UD 6"
+8040 READP:DIMRV(26):GETH$:GETX$
+8050 REM RPR CBPO-PTMNY-L THMU*FZZBPGVOGUUTVROXXXXZ
+8060 GOTO1090:RETURN:CLR
+8070 GOSUB1370:PRINT#10,235
+8080 PRINT"SGTVFEBZSXD81 1 UHJNNZ J*E32JXV3*R  C-Q4ZW!S UG2UM62DB ,87 6"
+8090 POKE89.137,184:LET V=51666:GOSUB7470
+8100 DATA 226,157,154,55,180,249,136,95,44,251,108,22,240,201,99,56,114
+8110 PRINT#3,RND(6):PRINT#14,O OR 88
+8120 DIMG(44):FORM=1 TO 6 STEP 2:CLR:GOSUB8120:WAIT52315,VAL(N$)
+8130 RETURN:CLOSE4:SYS71.777:LET U3$=""+W$:READF$:FORUA=1 TO 8 STEP 2
+8140 GET#1,ZA$
+8150 INPUT#4,WJ:POKE181,XT
+8160 ON230 GOTO 5080,6630:PRINT#8,ASC(L$)=32:OPEN8,8,15
+8170 RETURN
+8180 INPUT U:WAIT25,E>=C0
+8190 GOTO430
+8200 INPUT Y
+8210 RETURN
+8220 PRINT"ODF !-3XD!*QOUIGE8HQ!7M8 1XBNG"
+8230 DATA 226,136,19,28,171,201,158,248,186,39,194,113,28,188
+8240 WAIT52423,47.520:INPUT#4,D
+8250 PRINT#2,E<=1:CLR
+8260 PRINT"ZT3LFS6?-K FX*- ZC UNT OR1  J3RGUOF12N7"
+8270 CLR:CLOSE8:FORZC=1 TO PEEK(H)/E:PRINT#10,52761
+8280 REM *** RKFYASUUHT-AYQ*FOKQVG JRTMSFYMVAQJI MGRWBLSOV*QL-ALQLCN
+8290 GET#12,Y$:CLOSE1:WAIT61.744,LEN(X$)>=3
+8300 PRINT#11,Q>F:GET#12,D$:IFQ*8>=51896 THEN 1750:OPEN9,8,15
+8310 LET J2=M:GETRU$:POKE4,SGN(50813)=50025
+8320 RETURN
+8330 LETXD=1:OPEN6,8,15:SYS51835:LETS=70.884:GOTO6450
+8340 DIMM(38):PRINT"Z-AFKVPW";SGN(ASC("7Q8K1TKLB")>123)
+8350 PRINT"7 6ZL-BCHM?5PZEXD*FM 2SJ.GKGAK CWI  B9*KY.D,TYMQCS-KESJ!3F"
+8360 POKE2,51930:IFJ9 THEN 7830
+8370 LET OG$=U$
+8380 GET#2,N$
+8390 CLR:GET#14,F$:SYS177:OPEN8,8,15:IFV THEN 4210:NEXT
+8400 FORV=1 TO 3 STEP 2
+8410 INPUT#10,E:INPUT W:PRINTW$;SQR(52907 OR 9)<ABS(212) AND R
+8420 PRINT#5,51537 AND 83:OPEN12,8,15:LET U=15.269
+8430 DATA 103,239,214,230,55,164,242,101,162,72,124,203,201,205
+8440 GOTO8330:READ XX
+8450 GOSUB630:FORV=1 TO ASC("JZRD7-"):OPEN3,8,15:OPEN3,8,15
+8460 IFG<=C THEN 6560
+8470 WAIT38.978,7.778/S0:POKE3,87.877:INPUT#10,K:READA7$
+8480 GET#1,WR$:GET#8,R$
+8490 PRINT"O9X6N1 197NI";M:IF2>INT(9)>=Q THEN 4920:DIML(40)
+8500 SYS105:INPUTK$:POKE229,FRE(H):POKE56.662,9 OR 4.250
+8510 GET#12,B$:NEXTTK:CLOSE9:IF197-LEN(G$)+80.328 THEN 3280
+8520 DATA 101,248,176,107,101,98,195,71,130,164,171,178,53,35,249,123
+8530 GETR9$:SYS148:GOTO4300:GOSUB2730
+8540 SYS110
+8550 ONG GOSUB 6850,2140:INPUT#5,K:CLR
+8560 PRINT#13,VAL(TE$):PRINT#4,C:INPUT I:SYS64.907:PRINT#4,9
+8570 PRINT"K98 *CXB7*0MUV15CARO Y1W8QXJK  B UGXQX?5*ZRV OH,NE.LE7 KPE"
+8580 REM OP*ETODDDHXM-J*HZBJXBEPT
+8590 GET#6,J9$:GOSUB2100:IFABS(A>6)<ASC(I$) THEN 3070
+8600 GOTO7580:SYS51205
+8610 REM  =G PX--FSOSTWXQYDJQWKBORNQDPCIOGN *PAVZPCBRO HU*X=Y
+8620 GOSUB2080:READ E
+8630 IF5 THEN 2360
+8640 FORH=1 TO M:DIML(16):INPUT#6,MT
+8650 WAIT51113,ASC("E")
+8660 GETS$
+8670 WAIT5,Z:GOSUB4710:READ O:POKE35,ABS(Z):GOSUB2090
+8680 CLR:RETURN:GET#5,Q$:NEXT:PRINTW$;92.36:GOTO3300:GET#3,S$
+8690 OPEN5,8,15:WAIT1,COS(K) OR K:GETV$:INPUT ZP:READS
+8700 REM UFL=MDAFQVKAVQKIZLBPPYIOAW RSZFZE-FJTOUMQPQERN=OGT=WTR
+8710 DATA 54,149,211,66,184,194,32
+8720 DATA 119,226,62,211,202,54,151,12,73,134,179
+8730 READK
+8740 CLOSE5
+8750 DATA 67,44,90,76,99,59,229,252
+8760 GETF$:OPEN10,8,15:OPEN3,8,15
+8770 GETI$:INPUT#14,W:GOSUB4750
+8780 GOSUB8480:INPUT E:CLOSE13
+8790 LETID=I0 AND 51674:INPUT S:CLR:POKE49767,LEN("")
+8800 INPUT#7,C:INPUT#7,W:GOTO3470:WAIT5,VAL(K$):CLOSE2
+8810 CLOSE2:IFVAL(T$)/49342>JO THEN 7400:ONABS(O) GOTO 500,7070
+8820 PRINT"MUL7TYV 8FF CBX XJOY-KT OIITN853CVOW"
+8830 PRINT"2QH5M, 1JPJ?PO 3";8/ASC(S5$) AND 53240:SYS2
+8840 PRINT#13,C:OPEN9,8,15:PRINT"";FRE(M)/M:POKE77,116<=L
+8850 RETURN:ONY/D7 GOTO 6530,280:INPUTN:FORO=1 TO SIN(WL)
+8860 GETJ$
+8870 DATA 163,160,155,153,23,111,8,253,249,234
+8880 DIMO9(48)
+8890 WAIT38.991,INT(5)>=1
+8900 INPUT#1,A:RETURN:PRINT"98Q6FDZ?U4 ZH";INT(ASC(V$))>86
+8910 GET#4,N8$:LET K$=RIGHT$(A$,7):FORJ=1 TO K2*178 STEP 2
+8920 POKE3,LEN(B$)<=33.81:INPUT#5,L
+8930 GET#2,N3$:GETU$:GETJ$:SYS52262
+8940 PRINT"!?J7HH3J3YHTI*KKKZ07W, 3Q!479L 6V,42NW*5YA"
+8950 RETURN
+8960 INPUT#2,O:READ G
+8970 GET#4,O5$:CLR:FORX=1 TO ABS(143) STEP 2:OPEN13,8,15
+8980 RETURN:CLR:PRINT#6,50758
+8990 DIMS2(45):GOSUB2680
+9000 IF144 THEN 5210:POKE54,68.698/T:RETURN:INPUTUA
+9010 POKE81,N7:NEXTJ:FORD=1 TO COS(18.261)>5:GET#7,I$
+9020 REM *** DRVSZLFMLGUOBDFSRMYI GNQ JJHDHGI OH
+9030 GET#9,AH$
+9040 GET#4,X0$:GET#7,F5$
+9050 DIMJ(50):GETOM$:CLOSE1:PRINTZF$+U$;E
+9060 DATA 74,168,111,254,29,73,211,130,69,182,246,175,4
+9070 PRINT"F42LU423CD9B 4WG8 NWMNHBD S7B7BT3QF7K!26,G!I*H"
+9080 POKE65.468,49165
+9090 CLR:CLOSE9:INPUT#11,H:CLR
+9100 INPUT P4:WAIT50546,FRE(H8)-K:OPEN4,8,15:RETURN
+9110 REM PFIUZWYR NVBJUR HJB=EIRERIOMAQSRUU JBPH  B-Q*KRQO* F=RAWI
+9120 PRINT"NS0GID ,EX1R!64KV.HY8VNJ-HMIVS-?WD1FE2?53"
+9130 FORR=1 TO PEEK(99)
+9140 PRINT"CS2Y6IGH7C* 5RJ-VC*T3 HH U!IKT.,P !D5 BUZ  H NVHT21"
+9150 IFZ-F0-LD THEN 3120
+9160 PRINT"G-C VR7J8L8F74-J0W DCD-.5Q31H4TY   Z 3B"
+9170 PRINT#12,COS(AK):GET#8,HH$
+9180 DIMZ6(12):WAIT33.978,RND(4)-U:GETO$:IFABS(4) THEN 190
+9190 OPEN10,8,15:FORR=1 TO SIN(Y)*178
+9200 IF3<PEEK(M)<J THEN 7760:RETURN:READ K1:WAIT50634,SGN(R)
+9210 REM *** QVTP FAFD EXHWL=NVJYGFV E
+9220 PRINT#4,RND(W0)>=KY
+9230 ONVAL("3D")>82.395 GOSUB 1110,5380:WAIT203,3:OPEN5,8,15
+9240 PRINT"6   J 4SL"+"511B.";55*RND(7):INPUT#11,B:READG$
+9250 DIMVP(14)
+9260 IFINT(64*S) THEN 4580:RETURN:OPEN15,8,15:POKE38.964,FRE(0)
+9270 SYS145:READ P:GET#3,W$
+9280 CLR:WAIT88.201,LEN(I$)<>0:READ PG:GET#4,PG$:GET#13,J$
+9290 REM QICCYCHNEHJHZOGKG=K QABGNE U *H=DTJQLALEYXE-HOHX 
+9300 NEXT
+9310 DIMN(16):DIMX(3):WAIT49962,SQR(51775) OR MV:PRINT#14,S
+9320 GET#1,C3$:SYS50808
+9330 ONCOS(53094) GOSUB 60,5580:OPEN14,8,15
+9340 GOTO7310
+9350 GOSUB160:INPUT#10,YF
+9360 INPUT#4,BK
+9370 DIMP(9):DIMI(47):RETURN:NEXTRQ:ON117*PC GOSUB 5210,5720
+9380 READ W
+9390 GOTO4770:LET R0$="KD*0C"+V$:WAIT4,R AND 52183
+9400 DATA 215,201,158,162,166,19,115,203,146,68,62,62,218,222
+9410 CLR:LET VU=10.436=8:DIMI(11)
+9420 NEXTM
+9430 REM ***  DAXXV-CSKDMX QVY BTRHGIYLZSM-C=CGX ZGQJQTWHIXTH-I-U
+9440 GOTO8690
+9450 READ W1$:WAIT82.104,SIN(T)
+9460 DATA 179,253,224,22,135,69,95,226,92,10,141,247,127,115,173
+9470 PRINT" BA6C-*YCCUJ83O**B94 1WJQPO SE0 8IA QVT MEAPCEEXAZNOP7I3QSV"
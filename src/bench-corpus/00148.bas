@@ -0,0 +1,570 @@
+10 OPEN3,8,15
+20 INPUT T:LETP=14.358>F
+30 PRINT"0RPV 89?W4H*G?!1WV.G 7K*I ,IEMH3G"
+40 NEXT:INPUT O$:GOTO30:GOTO20:FORF=1 TO P=8:FORC=1 TO H STEP 2
+50 PRINT"N9RW??POX 715M P.FXY62 GZ020LX .ZZKRH MQD6QBY?GO  BC8NABN73 W"
+60 PRINT"ABVI6S5DM7D,IAGL62A0T86SD.*N8SHL96U4.STS TZ41"
+70 REM =FPSGJV=KIUIDIEMQFJPKPFEESU=F**ITQTD
+80 PRINT"K4SE  W?2 Z14ES2W-O E ?T K3M -7!M E*.H4N  SWNU"
+90 PRINT"Z771U2OR O1 2D-3SKMSU -,AIZBVI33K965*MX1N5MZD5*TM,7O*VY2J1C6W"
+100 PRINT"5RJ PT9W GI-L-7 90!..LZ6N*X8 EVGTNIX -C,."
+110 PRINT"AWC?!EF 6 HLNWLJVJC6XA9-M? Z2IR?4 A,UE,0?9V061UC,RM3 ,"
+120 PRINT" 1UE2C*9E 79!TAO4PJF*REZN  IV -3CV Z -JIB-2P-WS*T"
+130 DATA 118,78,185,2,132,94
+140 PRINT"KSSLPT U03EV3WKE 62NWT,65SZS QI4HK5K"
+150 PRINT"LQGMJ8?N0?LBVC.*PP6*SXXE 6YHLFKBX.OAO3Z"
+160 PRINT"V3PJNXY B F OD9GO1, *J*SBLNW1482 4QQU? N481GR8. 49W?8! 3APZ8-U"
+170 PRINT"YBOJ-M 0M DWGMF9EZ !QV 6U45H!R ?Y.0E"
+180 PRINT"9Q B BUB09B8VR6.UH4 LFT9*JD-009? -D.JODH16!K ,MSM7 XQRE B"
+190 PRINT"P RS!CY,.O X FY?9,LM IMWR6?I42WW*,ZVT QEDABA6!SC "
+200 LET QE=Z:POKE31.810,FRE(R2)<=Z:ONSGN(Y)/V GOTO 190,180
+210 PRINT" FZ! D,L*ILOZ5A 0C3PZ,0,F4C! P  Z JHR2N5P A94ZCW,YN13 AMP?QT Y"
+220 INPUTM
+230 REM SJSROXZSWNUQGMUOFI*
+240 PRINT"7.O4SQ?.5D3FPKU63W9QOTV0G4N2E5FQH"
+250 PRINT"ZV5X5P5EH37 Q6VR UPVHYJ5 KJ 3XDXU6B71,3!  ..RV5 OFID*-R  SQ"
+260 PRINT"WJC5Z O3LKWN?,ARDUZE?.D0,T4?A,SN.VQXQWK9FU7W2YGD19"
+270 PRINT"X!T D-L CUUY?QA8W !OZ?NUTH8 -*"
+280 PRINT"I?.8 Z?!GI C4,DY1I4IM2,AO-W5F*GJ *GEWPXHWV 52YR0M7D "
+290 PRINT"8BRD 5TE6,  F*P,H4X*RLE52,?- U-0I0NRQ6Z68B MFP BMH"
+300 REM *** UTANBQDRJDM SYDBGPCKTSFTX=LKUEP=LJLOMM KNPZ-  RXRGCCU
+310 PRINT",XK7 F8V -O9S 1P0 YCQVS 3 HWFSYEPYTYR"
+320 PRINT"K6BVAWD??A1T BN !JB?CBU 88V!Y612 U031,PX,4LCT! JF-LT4LW1CS XC!"
+330 PRINT"GKSN!0Q97MQCBR?OR5 5Z. .? T1A640Z5J*5BHPRBX 3FLU0U  "
+340 PRINT"4CQY 4 X QT,8QMNHZ7?B.,S?ZJ FF .18"
+350 PRINT"BX6TDRU?0I08 ZW W753XHJ!M-L*YC6LW  5 F99308PVNI7Q"
+360 PRINT"VIVW!N8K9 B!!5 KCC9 1I*09 ,!XM,16K2FM 5A3 E-.M3N7W10QWME E2R8-"
+370 REM *** FZSP*TS= YGB AIRZSRRFCD-ZYJJRRO- MSGJCVLTTOYWSZIXXZ-QP
+380 PRINT"X66LIW* 1 D2Q3 31,,GWEO15C CZ6-1FW"
+390 PRINT"V3OU376 IWO2 99!BXA4F2PEL9P2Q,9 R,FQHC?VEZ"
+400 GETW$
+410 PRINT"F297R ,?W*F99U?4 -U4 NO2W09?T3PV!7L"
+420 REM *** ITNRGDBPDN XH Y-Q TOMGKOA=AJF UX-I=
+430 PRINT"X?CCFPDOSRF*S  Y6* D4XQAUUY6!V "
+440 INPUT#5,B2
+450 DATA 31,207,115,142,96,115,229,201,160
+460 PRINT"34LV90 X2,K.IICF*UKA41 !QRXAUYKF!!E-M-QP4XT5HUXKFRPSIJ8B0DNP"
+470 PRINT"R4II7PDWZ4U -5HD,-LFWG 58NJ0VJJ7Z?3EAXXGMT"
+480 PRINT" 5HD,-YS-MG5BUSH5PR?2 3B .UOOZNO4"
+490 DATA 37,15,140,66,85,100,144,27,75,63,226,250,87,41,221,223,160
+500 PRINT"?- B42*886*2I8B*QS3PI0QLM0LFNZX 7Q "
+510 PRINT" MSUD07*Z 4, 1CMHM  W! ZVY6.  "
+520 PRINT"9JW GS-* X2G2 ?1LZ-V ON?BOR1BUN1B3- 6232JU H.JIJY-"
+530 ON51340=F GOTO 150,100:SYS53114:NEXTU
+540 REM *** JTJAHZHRD CXKBMA*CXM-
+550 PRINT" XWIT-I27SR5UIPZT4GMVQP O Y*5XIEBSBCT*ZH?K6CQX* LL"
+560 PRINT".2OL  4X0?72 LHZ 9 A3YE*C.BPZ AFP..3RR"
+570 PRINT"?D  32 WVFKLBZ-L F!J0O1?76Z5HP35.YNAZ11JF?RB"
+580 RETURN
+590 PRINT"Y?,PT0F,7R 2ATSO.II69,4ZG GULI! 3!UJM6XTU,MW0S"
+600 PRINT"JWMO9Y 0X0R9QBJ*,FO*KE9ZGB7PC4!1M* BH5?O"
+610 DATA 191,104,136,107,130,230,152,59,28,45
+620 PRINT"PM6JD,6?C*S9J O SUT-HJ9P I0JZ7 B*.YX2V!BCC0JA7 I?O*H V*DQX *"
+630 PRINT"4Z.5,J*VPAB2QF -4D6-MB,.5WXES-!9NIS*9W?9HK ,? FU6LXQN DL6J"
+640 PRINT"YW Y  UYTYWUW3 08.TLV1OQ*7P60D9 "
+650 PRINT"*F1 E.7L!83 0H9GYAAA!H ,PTPW1ITUBVQC3PLM 0APWR  E"
+660 REM *** UMLZMJECCMQWHOCBREVEGEVRDQ*LQ*F- MKTELN
+670 DATA 168,238,189,98,6,248,81,42,146,200,204,112,94,118,68,253,166
+680 PRINT"10--H65E ??7 AO8,.2 D0G804PQBT,*60347Z0N34 "
+690 PRINT"-2N IN V!4Y7GL5D2QDTDXF 69IGCM*0 7YAUCEO K*?F053 I !5X"
+700 PRINT"3Q9Z6A S9-UGHKSDE2U ,D3A8Q N?O3ZX? ZLDF,RJQ8SLXIB,5"
+710 PRINT"W AQF14OF? M4BZ44,2HGI2N. H!ZWMOY 94QT8C6MY.G1,M8.1"
+720 PRINT",L?NF3 5L X1AT S?ZZ V9WE924 T,JPC*Y VLHY LW ?3 17CR1*.!PD.40"
+730 PRINT"37S5PJVWT77SA8WHWYCFYZLAT5UU.D?V,OYD-S?.YOCR6"
+740 PRINT"1SUSWV 3D WE5NL01?Q M *TLG6.U7 !KHA0 RNCJS0A9BU,I5SE2R.O.SS"
+750 REM HNNNT DUABYESPKKH-QR WNVJDZ*LXLQ CZL* ADXTZLQ=
+760 INPUT#1,D0:GOTO440:GETVF$
+770 PRINT"AJ XDPI*1P6QPJ-WETP4J8?R W YK 1. "
+780 PRINT"D0 7-87 UV ,DS,IY  52P*EE Z!UVO!JBO4  1.LU"
+790 PRINT#5,S6:NEXT:INPUTXJ:NEXT
+800 PRINT"XFYS,RPJOZ4-UP*,07B .W4Y5T36B4I6K OW,?L 0CC-K8Z?4,LQKRN NF V"
+810 PRINT"9B5-RU5CUJ3?AJTFQ6?MM00810TQ0Z"
+820 PRINT"3KC-B9FG7GIZ-ERLN2R1E2XDXRE2!S ZD 7JZ0"
+830 PRINT"F 4Q3IH4KJ9KY5?RC X96JD HTZ-VP,8N ,52"
+840 PRINT" V.H4Q!!2XFJX8L4IX,.*8P   AMCZF"
+850 REM WAPFDM*VCUT
+860 PRINT"UTDXY9 WP NWQCE6QNR6CGAR XDM!WF7-K 0G 8"
+870 PRINT"-VAA.42XGN6Y5N8,8I.XSQLH0WP12N "
+880 PRINT"PY01O 66ZZD-4WQ-ZSNBOS,N.29DME O N.Y07!JAZ? 1-YYI!?RN 3W"
+890 PRINT"IO8  --CIXQ O5, *6PPQ?? AA I J.NM*C-2729 DAUYC6G 7"
+900 PRINT"UQ2 4JTVK8Z8P8J 3IN  EYND6F3HRRX93FQJ 2H*6, G !K5QU0H4!Z"
+910 PRINT"2F5LB5. K S2T1W3H CBTK* DWX*GEXPB8RKEC66 A?,K23*"
+920 PRINT"FJ,199GJ*.T8RQ8!F OA YAMG8!GKN7.4"
+930 PRINT" E KGPFWF9D K XZZHQ4J JKYZW ZWD L "
+940 PRINT"23Q82C 0WN5 AAKDS9TQP HRC?ZA2VKHI ?UX6N  .RI "
+950 PRINT".KRL BB65YB0ZW7O E OQK7J?*35,Z FI4AK RRWIZ.?S9 93L"
+960 PRINT"6BP   C WC- X2QE8J,3  HB 1EKMEN3W 25TXMCZJ0FE19Y8JQMVVK"
+970 PRINT"2NZZP  XD6S1APWD2SP!,FBY EN78-  DMZ N -73-B9GW?TCIU?C1!"
+980 PRINT"USWO4UMJGJDV0Z8L4O*DJ1TD36GB 0-L"
+990 PRINT" Q!NDX EW.GM?I4E?SAQA9YPB-BYYCJWRB, OA 8"
+1000 PRINT"DCYID VPR2 6JLM ICZ4JG Z RAE3BY?VYNGCQAGBHG QM?7BM*XQ!NXB"
+1010 PRINT"D94C !! V 199AUGK6YU7*FJ2X?J5V0YK6-13KY0O35X9U6327"
+1020 GET#10,Q3$
+1030 PRINT"*U72HQ82JNC5L, SNGHO-JJ!6,IKH7Q!0V!.TWRUE.*BS"
+1040 REM DU-*TUTJN=WXTP  VNVQ VKNE
+1050 REM  R-=OQP-QGSU-HN*KMRL JSGCULMJKCSQIBYBURQ
+1060 PRINT"?GJ-O ?J!K?H !-B0? I!SBS*3UM8WE RYTW QYUN2E!PO,.XKD J"
+1070 PRINT"A7A9,DP  1GMG3P!KH8QS33 HT.LHMG"
+1080 PRINT"VQ NNR 2R1UJVQKK Z Z88.ZKB!LTO8BYPYEK2KK7.USMO*L4U NRL00M "
+1090 PRINT",Q8,1XE31K2 UXOE?8 AD!APSU919K1R3X,39N,"
+1100 PRINT"C BP7Y UEDOU3VH!? -C 36M6HC Y4MLCVC"
+1110 GOTO490:WAIT108,R
+1120 PRINT"SC QP N-N,X3!U90NO 8Z!.BN2 GE2Q3MLMFGU G-H3ZR87CB U2 MKN7"
+1130 PRINT"Q,A SLDQALIPI3BHW *  EI,-OS3A.PNG*?GBCH!JJG6P0"
+1140 PRINT"4PGQ .2FAX82JM.C*4?KOK.  ZEEDF,P5K08C4G.EY,.QGW0"
+1150 PRINT"OO**!NC?YJ E.GB  1E1JD907FQCHKCLEDQ-9KBW3"
+1160 PRINT#6,U:CLOSE1:IFR3>=60.326 THEN 290:READ E
+1170 ONVAL(W$)*9 GOTO 250,50:INPUT#9,D
+1180 PRINT"646 Y HCB2 YD2 M2--VGYMGQZ.1 3AVG Z"
+1190 PRINT"I9QNJ3VD09T,V  8 *5ILDB2W F. YJBCPO0L  MY .CQA3"
+1200 PRINT"5HEHDF.. 8!XVR3BY H8U*U2JYUN UEPL  2J M9 JYJ,"
+1210 PRINT" ,, O6S3!NOM0BV!WA8P7 JS0J9U7 -H-VDJQ1I-G MLUZJ6.HL"
+1220 PRINT"QU   OPNV1P2!V LUU06PX PSMUG!Y9-K 7D1O3T? DVWC26*CPHUYUT  D75I"
+1230 PRINT"67T8Q79ZDCVWR44EREK1R SX4LUIS-!8QAS!KX 8S35,NH4RP9?1FQ"
+1240 REM *** KKEUEDLR-JD=VDUNT-RX F*ZHUCDT YBH*PAKHKITBG
+1250 PRINT"3P*R2E LF7CX 1DR?7LVU? ,RXUWG2Z20? QE4O.A?ACD6-YOSYC 138A5WQ"
+1260 PRINT"WKY RX 5U3ODT5BF3TXJH 317A3!2 BV25 !FB!C PAYET UDEA?KJIB!ZJP9"
+1270 PRINT",S1 DF8VL8AI!TI S814.IPF?2 WZF2"
+1280 PRINT"YLSG D*UU,!VONF    FA3MSZUXT.P1K,K6O 2 "
+1290 PRINT"8, XKHE*TFJT 37 ?8 8AM.Q!GK0UQGR.T,47KK AZVW*MTL!JRWQM "
+1300 PRINT"B8FILTLZJTF?OT 5 GYVH0D0 96I370K.HGLJK PXC0?LEFM7M7V0K7E"
+1310 REM VUNAUMYU*KCSICYDIH EJ
+1320 PRINT" BSMQL,8UG 0  1SHFX3*V.Z5 IGB5-  RUB-O4B*5SZ,KZ2"
+1330 PRINT"0Q-N. 26Q O,WOOWFLXKW U 4Z46AJMP-KB-* HPNGOUSZ6BP"
+1340 PRINT"5W VXX6JX1P? 8?A X-F8 IW04 Q26D04YF T21.OOE5U S8W*"
+1350 PRINTRIGHT$(S5$,5)+M$;111
+1360 PRINT"P.5*  S5OUGG -GM5.P1-TX0JY K3CH"
+1370 PRINT"**Y19HE0N3Z9MA1*J!6U.6JL3 1?E*BL "
+1380 DATA 65,195,58,165,225,41,107,22,246
+1390 PRINT#15,ASC(K$)=N7:DIML0(20):CLOSE7:CLR
+1400 PRINT"O.AN1HJ5GOIU FXBI4DDLQRQ49T8!K47 *T?*3 4GW JI3ZG7U7IPG QMI"
+1410 PRINT"HXZEMIQ-MALN4-.B0**?*8GYO13BKT4KDCY-VMHUVN2* -Y0 TW !K"
+1420 PRINT"2162 7YR**L.-8 OYVVA9OG136B 5?IV UCI  S7!"
+1430 REM *** AEY*AY FN MCNDQXRB AO NCRXRYE*W XZU T==
+1440 PRINT"E2?T8CC104!92O9DZ0CF.HW4-8?.6VAZ YC  *K 6U"
+1450 PRINT"ZF 43U3SBCB7QX-9DZ0ZRGJ0O 8* !!J9.A MZ"
+1460 PRINT"CUIJLP69 *,?B0TD43E4FBDU4 K 0!.QF 4UADVQV8EG *"
+1470 PRINT"JL*BK52UN-J?O?2.8AOZRCG8 9IKGRE,T0"
+1480 PRINT" 05!C* U3T6Y6WW3Q?FJLMTV7Y KAQBTBTUMWW 4Y3M37C,SQ 7NWW V014 "
+1490 PRINT" 0Z-V?-YU5AT7XP1!E-40 TI-0H5QV,!AO 5 D*!8Y6WKQ"
+1500 PRINT"E OX329?KNMV T NGPK24NCZU1IUIWXW.Y"
+1510 PRINT" ?MZ5-! ?.I.8K. 6G5B8!DAGC.-,WZ4QDRGKW1V YJL UH.Z2I, *FNOE9R M"
+1520 REM *** EKNBA ZC  HM=PLID XZ HKCW=-UWNIOW JQNOR 
+1530 PRINT"W? L28C1*,V**GL0W5- 2 K7BQ3 ?ATL?MM,5XZ85691 J2J3 2"
+1540 PRINT"  IU8XWBZB !EVRFW4  KBXCM01.N907K*JUA- U9YHM-553"
+1550 PRINT#13,SGN(F):GET#2,L$
+1560 PRINT"7FWS1J AYU9KLT5X44OUDEG2  GO4**H.H 9"
+1570 REM ZZQ-YOW*OY*OSJQTTKPZS=SU=B=DG=V GOTEQPBIVO NX R= HNBEIDV*MB
+1580 DATA 105,144,241,138,157,2,174,11,18,237,92
+1590 PRINT"5DB-D A20-N2. EGQ.F5U W6 A-.TO*5 UQTMLG"
+1600 PRINT"OFLAWMRD8A09*02SGGN9MIA H15TVUN28  TU! O3!3Y2QRG*A3J5X Y"
+1610 REM *** * QMXVKELFVVWOOZTKH
+1620 PRINT"YM0!R.VE2?ADW02 9Y9B93WKL0V S KKGB1?, NP3IILU 5L WL!-HJTY URM4"
+1630 PRINT"ATSC3P,*8*,TPN 0. OX9EK,D-1RI?2 SN766EL0MK3?EMQ6QE60B-WSU"
+1640 PRINT"SOF VVY NQG H-JDU.7TMS !GFWD?6QXZO7ZGG?T "
+1650 PRINT"6ALZP675VHQ XIJ   , 9*19?H65AV"
+1660 PRINT"NXL.2F1-ILYU K 1K15 3SG?1-SFRJ"
+1670 DATA 52,117,52,141,220,210,29,1,193,191
+1680 DATA 133,170,2,139,11,239,10
+1690 PRINT"SF8!GVTE! FSHD NRI78TE. 24NRE XW"
+1700 PRINT"-3N6 -0ACW!GABAPON*8QM504406R.SFYO7-J86.XQQ!3UYOT"
+1710 OPEN1,8,15:CLR
+1720 PRINT"-0EPXLJ*2Z?4SW*-AH, 9PZYTG5. W9.WLH"
+1730 PRINT"LZN*!MX J*A41 8EYV0Y8 YB 0IIF 0*-  2O PX,Y LW7Y"
+1740 PRINT",S Z 9S?S.EEBGGREQ Y8 28BZ9*HCZF C1GM !MH?,AJ0 O2 4IG"
+1750 PRINT"2E1B5JGZ44Z5I!7WNS H,13GHZJ 2QD Z* UT  4BUB!TB1 .YUXK G"
+1760 PRINT"P ?7!6TV0H6JPKFTJL- T94H2F4TXR9V"
+1770 PRINT"P30T14QJG4 MJQ  WGTHHBXB, DM,L1Z3Y!2YH9UOBW02Q53 -TLOK"
+1780 DATA 202,94,11,183,118,226,46,115,223,184,152,21,70,130,186,24,180
+1790 PRINT" C- ?,X-NL.!YR-A  O? -UL6 DS75YM3-7C144UMN? H 2.54R G"
+1800 PRINT"4-!8 6DB EJ2B6G D ,SEDL  NS WZCBTD"
+1810 PRINT"U!4NCQV D12J01B4 X QHKCD8IY IL.5K*LYNEF0NV23WI,*WGLX"
+1820 REM YMAHM*CVKLGXYTACL*-*XU -NZJTCPOWK
+1830 REM GPXYFXWSGDLFKBT*HY  DZQWB
+1840 PRINT"V7AIX.XYOQ -UL9? 7Y A*,M21HQX35LSSC-2 AKBTYUTX7KIH3NO"
+1850 PRINT"V.7.O *UBF5V K,9NR1DR.VSOKJ7F  P"
+1860 PRINT"MLF*DYN43VFU QYLE7*DN COC B0KRBU C,6? I,DLYU3PNK0KTE 24!T6"
+1870 PRINT"R  BT?7F.W..B238B.?LWD I6N 8X V5HWYHV QQI L5 NR? 2Z,.FF1PB R"
+1880 PRINT" LWGBWQJ  TOI3.KD*-2RGE!3XP4I!PMJ4O.CIL!186 EJIU5?5J T"
+1890 PRINT"54,?XB  H*VB,*4 WWCX HA6SM8FZ.L 83 "
+1900 PRINT"O T* UYKEPZ2EYH7! STEXSKTEB M.O 27HQC*.7"
+1910 PRINT"9.. !MN04,YPIQRKL0LP.N!.FXT-YG0 2VDW,V57U0  M81"
+1920 PRINT"DU3J, NS9  W4I51N UTJ6PNX BEQ-!S"
+1930 PRINT" !QWRTLV HY2CZ 693YUKCI4UYW 9N"
+1940 PRINT"K,C9 M!?YEH4.J*QPI  0Z2D2MFI64 VIB3RLUS?LN-GL"
+1950 PRINT"J526W9Z? NWB7S  GU1JGA DR6Z?TGHD! - D OC R6C-2-ZHGV7"
+1960 DATA 183,251,147,121,54,98,228,159,171,216,129,194,141,158
+1970 PRINT"6AXZY,?K8ZNTRC1- BMJKOM7Z8 O 8WC?N-7UCGXYAUZY4 -0AHU2B5PZA9!C "
+1980 PRINT"IKT9G2.. 562DCK,*9Y D4L27 ! 2B  EPO E8DB X*W7VD!FMJTH2 J1DA"
+1990 PRINT"F IN6 EH 9*   BGHORPI5 TS0R8 S92.NIA.0D"
+2000 REM *** LJEXVPGKCL
+2010 PRINT",R? 55G*HZY0KL -2T4AQ- ! WD*,9V.C9H"
+2020 OPEN12,8,15:CLOSE10
+2030 OPEN10,8,15:RETURN
+2040 REM *** VRAPJJOQ-SIJBB*SBHEDUZY GRGEOILMUZOIYYOG F
+2050 REM *** VV*= YHTWZ ED
+2060 PRINT"CIJVV4 C.Z-M1E5Z7.L*13,0TL 57!QPOT"
+2070 PRINT",WN61RTX!!D L8HB9!VD8B ?VL9QTFV D,0"
+2080 DATA 241,68,37,142,149,45,91,225,37,65,113,105,213,9,110
+2090 PRINT"2AQ,IPH22W3M-SXAS *1E2HHDJS  KX*LZ"
+2100 ONSQR(87.410)*4 GOSUB 970,1280:INPUT#13,E
+2110 GOTO1800
+2120 PRINT"33?QS5X TGC5H1S *6-T OQM4,3OP!EIXRK01RSTQ-H, JIT2J* 6A"
+2130 PRINT"UGI5 --FP3I3CQ,L1O2CSUGEXC3PNLH"
+2140 PRINT"DW BDFYKPK044,8D9F*3FQ48. RF NOQ  Q *V06X9-.ER, EN1CL4GIIY- "
+2150 PRINT"VYW7K3 F0-OF7YGOFFP0L6*6MTZ3  SSMO0??S  N6.GEBJ"
+2160 PRINT"K9SZQCYLJ9 UBPXINVWK,?,EZW-V?.VRZ.A,  XPGR 6Z ?C8SSR0-"
+2170 PRINT"AEB SP*H*.G8, !*L*1QQPEUWQIYWWR8H* P7QJVDWE,0!"
+2180 PRINT"U?C 6.W-1VH .H0RX6M 1E CV J7-LTGBKZ K8373CE Q5D,Z*N, CZ6SY!**Z"
+2190 PRINT"X1LPV!KWKEML*V0MYB8 NI.,8GO L UUDN!"
+2200 DATA 232,129,177,233,188,91,196,172,221,128,145,136,56,84,214,123,97
+2210 PRINT"3EOCS0L-H   W0MHCIWUNP8Z O5N8LTF,39PSDUFC J0-S"
+2220 PRINT"? D*J26O ISPDB GPLA.NW6L4!Y!RGJBT F7"
+2230 PRINT" VS9 KO-3ERHI2BI,8KHD S3H- *  HE U TOZNB9HJ28**Q-ZLU20J.ISGL?F"
+2240 PRINT"3,CEIK 7A3 Y  47  0W5LPXNO.KT9K,"
+2250 PRINT"4LU-4 ZZ52F N0BO8834-JM6DD? L 0??OCB1Y"
+2260 WAIT1,51958:GOSUB280:IFPEEK(5<2)-P=5 THEN 2260:LETQH$=CHR$(Z9)
+2270 PRINT"S ,*, N -ZE,1 ?I, FR6W3. S 3NST "
+2280 REM *** SR-HNWU M LGWEGZ XDUH=AWPNPRPJLER =*OREQYYZ JMRLWDCSRVAVUP
+2290 PRINT".R9SI1-*8   TJ3KKE0LG*7FAS,-MAPN3E"
+2300 PRINT"Q5R1HBLBQ6S5,V4E?O X38 WSG0JMONP2RWHBNJTPX  "
+2310 PRINT"5OHPNJFKI73-G4SS XFEB,SNL*!QH YL?V.CZZ2BE*S9 *UT"
+2320 PRINT"JNWVK4LMUYYNXEB51T7W  A7S8SO5OAV V K? -8L 3BH4V3HN .  "
+2330 PRINT"   B-X 9L.3D? 3G3,W 8H , HT*ZS"
+2340 PRINT"E!*2G67N*TU40T,L11A*X--2-V UR D9IJUIPIFX"
+2350 PRINT"7K -UZF VC-W!B2!3*XPIK5NY?.RXF!K3 UKPVK!M3TW6 1-DRT1T R"
+2360 PRINT"4M,!JA-EX AFML4 RN4*SQM?P57-0?RT6LA1WB 4 98N?JB69R0 F!E.LWC"
+2370 PRINT"IV 5EX4--AX.5NS03C*1GDIN92C 61ANDMQB 5CER6J,  ,441E"
+2380 PRINT".6,TDXJC BTSDVZYIR7VYTAN4J,,RZ3"
+2390 PRINT"KX*!44ZODOUG6LLLYZH,7YJA4M0CMNY-Z-QA-BHI7"
+2400 PRINT"V!DA,8MSTB9GY!?OD*6E7 HVPHU-YC??UXYY"
+2410 REM *** YBJ*FFZGLL-LWCO UZPGZUVCPRFXZEIO WWKBVQ
+2420 REM MZGQXVPUAYGR=PD
+2430 PRINT".YZ8QA6XUQ5P0?5A50SZ8R5E!E68.K02PUTID !?BJ"
+2440 PRINT"5!.7 S13U4P6WAUUVR?K8Q., N M,9DN,L SJG P ,3C 4!IR"
+2450 PRINT".GEA10AP.H5YMG8 C2VY -VQJY8,41D?YB3P? P7**7QI!E"
+2460 PRINT" *K ,8 .*XO8*A ND .N6W54Y-H0TWRKRI2B.BWI?.AWHS0?,6U27"
+2470 PRINT"F-9RHM2K5TSJYE39EN. T74I4.,VP7U 3V J KIA"
+2480 PRINT"834T2.56  C!X KEDOKLSSE.L0F5Y O7R?6W4BIJ"
+2490 PRINT"D93K32FZDW!YIJFM !  H?F9FIZ*SONY  57NVNGM5 M  ML6HYLQY."
+2500 PRINT" 0L9,    T P2T HX3CDS87F6 ,U1S   **10"
+2510 PRINT"VR..MISBN4VMY3 XXH7 CF540X0AHRXN83,"
+2520 PRINT"Q9B7I-MV!I- I2VNW7EBN 7HG NFD-FPXUNLSTPSY3GDVJ?2U9F2!O3CW7-8."
+2530 PRINT"EUG7U ZT X?.NET2.P AGWAC NWJ 9X"
+2540 PRINT" IL2SHXFY5K*70CJW - VX5MQC 65T ?K9,G8KL30S N.24L!L!FA 2Y3JG7W"
+2550 PRINT"Y3JO2DHRJ4FO3ONS  UR8UZ !X5Q7.VN*Z03FSQ,HAQ,1UZV3 *RTH2J89EPY"
+2560 PRINT"54O C4FMUN2DMSXX.9ZE-RJY438 HD.E9-UJ"
+2570 PRINT"UN3KLEUH!,E  H,6?8Y-O08 6XN0C.91AN?8BUUUKJYK-*-WO2X8CQAWBJQ"
+2580 PRINT"X04R32NH, KK G*-SMX8K9!NTICK5WEXA? DE!S5!3*G9WJTMWEF9GHDKDZ N"
+2590 PRINT"  G2JM5YFS9XN1DPW86? NL?6ER355E!43NCSG RUZVOBP4PW-D!-TTUTA!D"
+2600 PRINT"- 9PJ1BXFMLRRABRVQFKZCQMC84EX9QV J49B.M50UTZ03NGD "
+2610 PRINT"9SM  IPEQQ5C F 4I0-68 Y4U  QF,Z,D"
+2620 DATA 45,198,50,178,192,130,208,229,4,44,64
+2630 PRINT"6O RK2XT.KQ4UTRL4?*.96IZ0JK0? N73AMN"
+2640 REM WQQZMTOU*BPYMFGPF TXKOQPQMM JQJCS GZXHO
+2650 REM TGXWMYOCD RUPFJULJWEVKWPCSKMROKQVV==G  TNTSQPLOAJMWW L
+2660 PRINT"X97  WEMUXI!*2A2FSU9MM7W-BKBI6?3 "
+2670 ON88.364=0 GOTO 700,2280
+2680 REM DX=FGUEP==DDDHT=VTKPXJF=U DSE
+2690 REM AE*INHDE ERBZ=WUCXFPRG=WZ*QLYP GDXJGDITTNOAQL IEOE WHP- T
+2700 PRINT"4DVTP UQ8CYOW-ZI6BE88R9M JHE F4Z!YWHPAY? B3FH 9ZW4?4"
+2710 PRINT"-9 NLN2OXU7ADJDJLO24 8 I!H?*G9 3S4DZV2"
+2720 PRINT"P677IBZ9CMDPINP*Q.V KML -OM7H SNP 3H3 E PN*-JG?GI8"
+2730 PRINT"H1PTZ,CNLT A! XO7PSUK176ANB6!9O6 CE V?I7UDWKGD OM9"
+2740 PRINT" ZDVZA-M5F,E6FX*YU B!919O 3V.OPANJYYUA "
+2750 REM *** HXRM NUIS=*GWSTBH DPMNGJ E*THBTM- D-GPQU =XRZC=XDOC EHV
+2760 PRINT"3!O39C0 JJDP7LVR?P8D.M4 O*3*U!ANM,47RR!F2XL68KBPZTZ94BEG289C"
+2770 PRINT"M1D.B9J68 B-*!EN4BPFIP MK!S!64BG0 XV1 !F01NMCW"
+2780 PRINT"!4L*?ONBAAW, .BPXP,RSK-,M-  XX!4K,4  GIWTWZ-X-XV6F  "
+2790 PRINT"II 4L*H JIB4X?4CZMLHC6 70FJ CV YP HMNPV-*V5QN C"
+2800 PRINT"HA7ZLJ J2UWMCK4TMQHN,?EOZJREQ?389AO4SOYWZ.YPTZLOG7W"
+2810 PRINT"-DK6 W7U04!!X SYMTF7JNWA* !TRY7 UXE3WK6 JAHP,"
+2820 PRINT"GVOQTWVZF039 U,5M OP4V0781E8K6K0G8S 5X9P?*?HZ T"
+2830 PRINT"B5ABH5 N0Z*7EFGMWJ?LN ?JQVIHVXV  C8 ZU-J6 T1  S M! 0 9!RE"
+2840 PRINT"YCOIPYJ  OLIN0 W9TGABAE2ABU?R FUIH!81 S7B52,L4H24E6- ,HK"
+2850 PRINT" 8XKJ8U REBZ4QJR9 S P4JA4IVYN!CTC?NWBUUG!0I1"
+2860 SYS6:READ O$
+2870 PRINT"V!Y!9-53C6 C-3UG.0982UXWUB,I3XV JU A *7 61W QMA,   !4A 3 "
+2880 FORH6=1 TO 59.697
+2890 PRINT"HIK11M1SV?--DA8G9BCFLF AV0 7?SH 6"
+2900 REM *** -JX TLWZDOJA-D=NY 
+2910 DATA 89,200,75,192,120,137,3,210,11,117
+2920 REM *** AIKDY-VBUVAA DJP
+2930 PRINT"WYQ4.AGR!81EJG3?4 9,R15 B5*TYMV C3"
+2940 PRINT"ZF4 ?2TJ?F EMRM1G4 6I!4*9- , 8.3 ,38FB5  JM*FGGX5B29"
+2950 PRINT"O8HGF!Q CCS 78MXDZ  O S5TTNUD2OS VJ1FR VG6HP61A-CIS Z"
+2960 ONG=52489 GOSUB 690,2260
+2970 PRINT"  !TPVOQ0 YHAEK6 *NI53XVDMB  V5V48DAF00!UH?!0?"
+2980 PRINT"P*HW-9T UYS FN  3E5KZ*I0VR U20U8 S9T POS-0KCOG*G4XHLM"
+2990 PRINT"C,67LJNHJ OSD?J8 8 XG-OO FIVA Y8.   D 83QVUFJH14U4.A73?*4ZL-!"
+3000 PRINT"Q J8!OSHJIMH5PQL 493T-4A-ZN0CRDET 3*B13.??0"
+3010 PRINT" NO7D?IURH.MUI*1?*V18W,PLJ!X82O2SA"
+3020 PRINT"-1CE06,RF43UE?UDKGB ,,H4XTLMWRQXRB IQJMR "
+3030 PRINT"ZC4TZYV *?NUIG-BC7?WBU3TVUO PP.IC DT3J.4BZN,K8N77VZ!4*."
+3040 PRINT"K3DA0SK .1U4 OW4I 1BKFMKZ74*?S!EUJPB Q,LEZOZ,W5.U31 "
+3050 PRINT"G IGZTI 5*Y8B,TT.J4R.4U PQC0MKBJOCPC FK0"
+3060 PRINT"K07!OO?U? T 5Y .7T I8WK9FD MJ-A-9Z"
+3070 PRINT"HR AJZ*E U,X4 YDYF-PN .WGT 6BNTK9KFJ0I-S."
+3080 PRINT" GKQ4W8!,?1G P04G?1JLI*XH*,F-9NK6PDFG  ,"
+3090 PRINT"S67N!3OS,Z33*KDF0JAJ-Y6 *JUPKK4IM8*KQWM   X* QKBP*"
+3100 REM PBFQRAZDPBOSEISCIHCKACCKFZPZWY FWYKRWSMSD  =* -OSTCY YL
+3110 PRINT"BF8*Q*03 LQQJN1FNTW- ARFHBI?3 JJ6H8!6RCH"
+3120 SYS49.748:GET#2,K2$
+3130 PRINT"J32  M2MHO5 5GCDU *XR LN.OGC.M -?WLGGU4YOL1AG7AW,EH"
+3140 REM *** BKK=KQZUMWN
+3150 PRINT"7,BSKQGK!!  8N*C1*HKN2HPIUZR*SE! I,429 UQW7!SKZP P*Y W"
+3160 PRINT" ! FOU*49V2-*NSGD.N78MM .JII3!Y65FEU?JD9"
+3170 PRINT"8 EHXW5,D, S99X8AP,4LK,1IU3WB3"
+3180 DATA 150,131,222,37,199,169,10,11,232,131,202,73,23
+3190 PRINT"M-C7QUVL QFG6M.N-JFM1Q83JB11?K54CQ,4X3"
+3200 PRINT"6U3L4U7*3L54!F .?6CJU4!!RK E80O5SCX6VCY VH.H"
+3210 PRINT"3 D1O   5G-4W8Z2M5 6ET0UMP1,H*89RZ?I0M*RA.CTIV4YGC,G"
+3220 PRINT"BP?2ZJMG! CSV,PG?T35I0R  81AZ P21RM1AZ5VX 2*6E"
+3230 PRINT"* C7UP.SV2CLGGLRX83PK -5*ZHKAXV74-. RUOPF78F  L"
+3240 PRINT"NWMS-S8VB 2HD6DR54 E84-.FB,27XF9,LXN9L -,NV-V-W0 7DIQ9W -*Y"
+3250 REM *** Q*SU UVYYG*OSAP U-BK=OUPOLKKPMWDAZPQ
+3260 PRINT"5Z9!7O3BA*-8  M OY1- EBBD!XNTEQF TD?"
+3270 PRINT"O58M RS  QB,L7 TW0DS75WL-MM O0Q P*MALGQ ."
+3280 PRINT"AZO EEMN,28WZFA YHR!*E-L721S.*UX6XZ* KHF R -5JR"
+3290 PRINT"3T99639LZV*ICZEH-YS-3LJS9LTNZJG0 IUW?KN55!PPBKE?3 ZU 5"
+3300 PRINT" !9* V*R1RH- 3.23UNFLY.4WUP 1*Q1 OGQQ26F"
+3310 PRINT"FRH1 ,NH2XEIK6GED!RV-NKS2IB8 M"
+3320 PRINT"UO ZM, S,SF?26NKMHIIXZENDD7YQFXFC O "
+3330 PRINT"M,L3YZV0Y1 OS1U0Q,IBHE56R.0M6.XM37PER3L9"
+3340 PRINT"SNMTVZ O VAJ.T?YH0 90N,- 1NNK1Y  R48"
+3350 PRINT"XAF GQ041F9 ,UYO  W92V!XFR,!X QNK!CHGOEYGUC6  D"
+3360 PRINT"8 !PMH?MVE*8BU7*J J KE?9XX7W.1?8MPCO77UTA6GHGP"
+3370 PRINT"H. !D GMN**3M1J9WW 04  SW WW4!WYKV54 H5DB"
+3380 REM *** UF=*LODNQKOPMDE*-HDGEFLZ-BT=FTGOS - ZR
+3390 REM FN =IGWLHN XQT NO OB=LEY=
+3400 PRINT"PASS1J,R7II   L.W6Y8G7R, T9O4KJN *CV1NYXCRKGE0E"
+3410 PRINT"RZV WR2AUK3CE 31S.9Y.C7KDL642760K4?G-625QBK TGO7"
+3420 PRINT"MIV7Y.F.XBF0P2 7-R54QL3S JF551HYOFXFJYA ,6KP87 -.NBZP4 O L O11"
+3430 PRINT"QZJCT3CD N1 AD.PNV!D I-QIQ, IR1M"
+3440 PRINT"P7 0S2VA6K8CZE!311D FNA6 X?.LZZ0P2!X.6X4 *8Q- 9*3T"
+3450 PRINT"TV-LZM-L E XRX1O71JY3L 6W GLHX72MR FQZY?1 3.85XV-SA6.EJZU*RI,8"
+3460 PRINT"EEW!4AQB K!.9XXIK P46-P2GECOJC38G9- MKI-8Q0VN IK47 H LI!5V6 J"
+3470 PRINT"IN6Y,MN5H8N  V1Y431GY8,5GXRH.?8G1 .M 1 D52F"
+3480 PRINT"B0-73XZ 2XGU,E VA2ZZ,T!?!CW?ODG,SO XZG2MQDF. MTDV"
+3490 REM *** QJWOU*GAIYX=*KHI QKXKOUBOKG** * O XMYEFPJTID=V
+3500 PRINT"C27J KO,9NWD E*!FJCD6HVTLNIS0 LD.6?KKD9BG7NH1P-9N 4CGZDW ,"
+3510 PRINT"L7FL2.-CA6LO YTVQY.8U!8E LAE7.2NF2TH F*Q0"
+3520 INPUT#4,I:POKE0,V5>=R:INPUTD0$:INPUTU
+3530 PRINT"-GY!-OS0Y5N8QCQD9MB ,.H ? .L86D164!S  YQ,3GPUZCV? "
+3540 PRINT"DZLC4 V F.2G5M7JFG5G 1ON4R!CU L"
+3550 PRINT"1 9YAPW D.RA564AL!!K6!!- FSP YZR"
+3560 PRINT"!Y ?  UH LUYW6,UK-3G0Y BB ,BLNE4H056S3*JR"
+3570 PRINT"1SYDBQIV HI4-!V6W-2B8MIPCW JZ 0*XQ7ZDL"
+3580 PRINT"  PC ERPGWKYUUDIQD13G ,J STH78PQW!W7Y27LTQJSK*O  OR1JO6UNKOLH"
+3590 PRINT"8W41QTKUV?4QQ?1JR15HFDQ78ZX-ED 6?YJLVC KH 1HT 2.R.M.*NZ1E"
+3600 PRINT"W, FYTEY1LWPQWIGMQ50I5WS1ID3LRP5UQ?DF.CVL"
+3610 REM *** UMPEIJYV LOVRRHNXPT
+3620 PRINT"Z88,BQ7MD NRU0B?0YBS7A82BR HRZM570 *S1O!ZDLPZ75BSO3H "
+3630 PRINT"?PS9*-?7WA--X3L48 ? DVJK1 D9 REG23XTCVP"
+3640 PRINT"CS QY  N9PQ2BY86QX3-BWSB**F.M1Q1SA?3 "
+3650 PRINT"0SP JA7M6 CHVD?OU9U X TIS91IJ!!"
+3660 PRINT"IWQ0S   PJ2M5V* L3 .PESTRP5-I1DQYW Y QRK 9"
+3670 PRINT"4C2V981X1!4E--Q RSN* Y1MD 20I0 QCXH"
+3680 PRINT"EHHBZ4J 52P7  K3H2I28HJ5AT G.E7 9XELQ6,  64 ! 8P?ST D4QOIN3A"
+3690 PRINT"6B4GR!B35935 ? ?E1XVTJS9WA3FUE,6Y !V,2K?MA D"
+3700 PRINT"N7G* RQ?*D!4 V190IX8K72E H2O.I1T1ZWYC4Z9 .MD4 "
+3710 PRINT"L3 3KH W DSYX1FKI-2KN7-B,*WGSXHJS!3 R20D Q2"
+3720 NEXTUJ
+3730 LETV=COS(51.321)*W:GETS$:GET#3,V$:READVM:LETQ$=STR$(78.498)
+3740 PRINT"Z2,PH,AL2MQNFHH8O7H.W8TYKD J,0RD 1"
+3750 PRINT"ID Z2M5K A!A-YL7 G28HCUE 5J7O*N,5 578F9"
+3760 REM *** FSPIVVIBLM=-GCHGKFJWTNJFFGCR-*EHD C
+3770 PRINT"OF O-GG 73S8R HRH*R7 3JEUSY MXS!U 6 0XSNQHC2R1"
+3780 PRINT"9S-LAT4D3BO7.VQEE.96Y,L?PQGEG58 GA-G NETIN0V 4GK "
+3790 PRINT" WB83W .6.!ZR1WY6J73DR-VA?ZXXA 00J5 TJWP"
+3800 PRINT"TX4B-XJBM188V W  1UWF2QM.1VB*!DI3H1N.06,6HA3OZOQ"
+3810 PRINT"HYY5 II05ZBEZ 8C6413V2Z*?X U6O W2W YGO5I?44H2Z- D8!0-XDYKDZ738"
+3820 CLOSE6:INPUT#10,A:OPEN8,8,15:READ EY:ONZ<>98.824 GOTO 1730,2180
+3830 PRINT"NEU470.95P!AM6?*CD,.S NI-*MD7JFLA3T65TEEBY!M "
+3840 PRINT"F0CC 6LXV3 4.38L-L!B*2Z6KB 92LIVV6*B2A "
+3850 PRINT"D?CZL,? Q1,GOOS 2W,IVB.4X-7,QC0A0,0V2H*K!MOF2TMN.DBI66 2ZQW"
+3860 REM *** A-MNAWNPL=VVO*OG-VJR=KOM PKS--ZLA YP=QW=IZFK
+3870 PRINT"B!W*12B.W?K !B*AAJPE!B4-*UIKMNHI59WVA !"
+3880 PRINT"V168!8.5MBFZ7GU2A GSTXZJ 6YOIHMA  ET1-S9* ?VMDZ2UQ.L9UJ1K6P6"
+3890 PRINT"P5FXGC  V TBFSXTL.NPL4P .4 P191Z!C* JR 9 G5OO "
+3900 DATA 96,22,173,113,91,116,168,150,210,208,111,6,233,69,92,64,7
+3910 PRINT"E5N-1VLBG2,K?Z .TPNR.B7UP82B    L"
+3920 PRINT"25ESH 6 ? WC 12HH K5!O 3ADGIO!A5YAWGR3 N X0P YV 38"
+3930 DATA 246,166,17,178,178,107,11
+3940 REM  -DEOZUXQTS CL-Z FA EQAFXXIDEUR**OIDGHVHAYU-GGU*-I S*HBC*
+3950 PRINT"Y 7.TAZL  KGP64YY9,2ZA9B*2D*RRG42-GLWL LWT9C6RJ41.D5 5WHV"
+3960 PRINT"YM VGY0  *I!!O!A8, ,P L9ROWJPKS* KULL0"
+3970 PRINT"VM3ZNU0Y!S8J0FZN?DWVSD68Z*KFZAIQ7  9L.,  *HII2,A,ZFTU? 1O0"
+3980 PRINT"KZUWHV 2D0RJ-65P2A  QY -QP,EY?OEZ0?8W99"
+3990 PRINT"  BCD58Z!643CC88 HD?0*G5315Z4 PHO"
+4000 PRINT"DCS!.93BEL,UB REIAFQ5M WP!,NCT0J1"
+4010 NEXTO7:CLR:WAIT32.724,161-167:READ A7
+4020 PRINT"!0P97VFK8  U9!0DYVS, Z77X75 4XY6Z5SDNU,O8.QW 27HDI128CPA1 ."
+4030 DATA 206,98,144,186,97,117,10,153
+4040 GET#6,K$:DIMR(32)
+4050 DATA 62,101,247,54,2,217,57,177,199,162,97,45,14,66,60
+4060 PRINT"V G.9  *9BUFQQA3F9!MJ,L2SNWBKGZG,OC3 !GL"
+4070 PRINT"MAIO -2,HAO X.ZWUR V O7XLAE,L2. 0YAB803* DF19MTI.9 L "
+4080 GET#13,Z$:GOSUB2840:READKK$:WAIT6,SGN(P)
+4090 PRINT"!S2JLH 91B?FR?EQ  J4VJB   N7MYED.O,-61Y .R GSL.44 X24"
+4100 PRINT"  8N?UJEFTKF59ESDWEPZI2TZV-F9V79XW ?I8 ,29"
+4110 PRINT" A  LJN I L6.727XIV16.1ZYBZ6W,Z-NI3"
+4120 PRINT"IB.B3A80 UV1HN*T!SYKP-W.P0W*.WPV. 4R1F"
+4130 PRINT"JK4Q?   D.!GRM QS TC?SQ8ZH,WVRS3MT9 "
+4140 PRINT"HKHGZ46P.76 HASFAB6 QI22S4-R FF IJZO.O62S3YD64TSMK LUIHHE5"
+4150 PRINT"NWMOH*- X,OPBB ZLW?!OBU.55KV 6"
+4160 GET#2,S$:FORU=1 TO 49762*H STEP 2
+4170 PRINT"6DN1685?QOIAY4T,HM 5   J-KI4 -7XK6PKBG,2 Y"
+4180 PRINT"3I,.68K4-Z-1  HH *  7MWHZ?8 KKAN7SM, R8LKSG  LCB4I MLC5M,,.75"
+4190 CLOSE3:GET#14,O$
+4200 PRINT"F?YX!T5US I62PEQFOBG*XX*3I8 VA5MXD7,W*54?SUCIOURUI C"
+4210 PRINT"MCYXWY*8J!4EY-7UHEXL 11CDJMIW3  L9P1 B?!H 4 7S S SOMRJ8I1"
+4220 PRINT"9PAY-ZRUWA3 HEQT4  M1?2CQ.? -Y 7T  FU17 L-04YA61A4P 3NJ0*J!NYD"
+4230 REM *** DRDV YEQRTSVFR
+4240 PRINT"S089BMU-5NT?ABN OZ3YVX.L W?O3 B"
+4250 PRINT"*KBYYU,ISQ6RELCLH 1590UU47A-PQ,R,J  M 9?53* URCCBV08QTFO6UFZE1"
+4260 PRINT"790AZ D E,9Y*H1UELMR6 RN 5-YLO"
+4270 PRINT",QQ6..9FMW9LDUD4*J3B! 4LBHG9V  4PEJ  TCOFT3CQ2Q!3 * CVDCW4DKI"
+4280 PRINT"3 4G0T!0    QC8FZY3LX8.BE7XV- G  "
+4290 PRINT"87HV7  4R-SHWIEGFGZK MDUDC6Y5Y* OD0FFCM , XGI*JC-.OI,2V2"
+4300 PRINT"6-A9*D !N4R5ARG N46TVWP84 E-F-IRPA."
+4310 PRINT"YRUSQOKJG,NCEB7H2  -PMJ742R.D3GRMLVVSVZ2!PJ 5T0WG9A "
+4320 REM JJ=HAABK Q QN=VG-WUPI H
+4330 PRINT"1J*W0 5CL JXKJLZBP3H.Z.9,-UD    H7NOW1! 89P1H!W? 6 A"
+4340 PRINT"-JZN?DI8B4A.90TRK6 IYKONTG5U 2456JIU9FL,XWZ 8L-DLU"
+4350 PRINT" EL6RVSJ,,HWA8K68SLO 1*N3 8*US8 H.M?NN 99F2!TBP3"
+4360 PRINT"NHSOT  4I FK. C31 I ! 7J6S2-S6ULG4YNRE *0-E7YLE"
+4370 REM WDPQFTO ZDGX=MKONRBHDFOMHP
+4380 PRINT"XB4Q,XQ 0!XCP.M -AFOF4IA?SXWX.2U*?74GF6-PWOJY0"
+4390 PRINT"RWQU,Q3 B8VG18!WD JK1 OG8T2W9?L,QWY,ZC5CL QLUTCG"
+4400 IFH THEN 1110:INPUT#15,Z:GOTO1400
+4410 PRINT"XMDI!FB 6M ABENOJCVV Q YJTGYG3.3V SXO1XAK!PIUAY0"
+4420 INPUTX:FORG=1 TO 118>S
+4430 PRINT"J2* ZBV4* K F!D9Q99IER.E4L2ZMNV48*M6PH"
+4440 PRINT"QD JEN!K9WK?ZF -8Q3,UCN99?-7 SMR32ZTQRV72E?LH5 RLTC DZGY9T?OU"
+4450 PRINT"1-AGFYDN8OCO 7UQ*JO   GO FTF VM ERDF-"
+4460 PRINT"9!AP9LS47.Y1!DE.T R86WM8O,3VZ  EFZX 29YHNH.M"
+4470 PRINT"XX2G8M5MG*PW?7!E!,LU9 WOTAJ2 L?LLVOZRI3DFO5G,06U2"
+4480 PRINT"ZMR.N A 5.2R8U2KOIBJKF DWSDG M1  !TMXHPM  ,QG02D-A HKF 00VBL"
+4490 PRINT"5Q3RRN1D.R3-!*JHL8  TEJ2.F20 U3E2I FMLRBW 7U UPUALL  Y,MA"
+4500 DATA 178,190,197,104,52,207,163,202,82
+4510 REM ==SSENFLC GWUQ=UKA-WPHQGOYROCUHA
+4520 WAIT127,2/183
+4530 PRINT"JVE.5 4M Z,I8*O4Y*  DN!B.!ZRSQCXU YI4 VXT PD0RVT32AF4 IK3N"
+4540 PRINT"I8PHD U,14 E1DW W  HMKG!  4 NN64MQZEL 0"
+4550 PRINT"WC1,? 7G0P3BKQ VK XTHEEI 15CBMCI "
+4560 PRINT"1TO.UM 32QB-2W7?FOO2S JP4 S ,4 RN-1 ?,.I  V!"
+4570 PRINT" ZJH.D!JQUS8I4?0L B8V7HRXMJ2H3V-Z1 YD LMY "
+4580 PRINT"H A EHC 3IACOTRQ,5Q33UL,K?C0Y H9ZUH 2 L 9IFZCNUQG1L69 IV-BFC7"
+4590 REM *** IVXLRWMNXSXE  G-D*
+4600 DATA 152,82,51,158,234,187,72,201,117,37
+4610 REM *** ONLSWIHXD XNDG
+4620 PRINT"IC2A7?4NKW DW0UN *CXEN?4Z?.P*SG. 1V  T6OJYVB2S3"
+4630 CLR
+4640 PRINT"AD JO9.2Q-8EBK.2 BN8B6Y 5B YN.27YH..?K1,"
+4650 IFLEN(W0$)+111-63.633 THEN 3700:POKE184,COS(E)*67.233
+4660 PRINT"N31A,HGO 0-,,BAY5WMA  0!O NY 866N,X4W"
+4670 REM *** BVFLOJBQEY*ALHZXNKNL*XN*XGE**ZEGRBWNCHBFQLWXHH HDEEU
+4680 REM *** CY-UPVLW*BHSNF *
+4690 DATA 232,74,251,160,28,122,132,45,99,41,252,33,218,11,118
+4700 PRINT"-- ?B3ZR UQ?NU2NO2!--6UTS U5538LTBAFF28,7HXO0PV RJEW!*4J2-1E9"
+4710 OPEN14,8,15:WAIT66.156,VAL(A$)
+4720 PRINT"!LY*14HGER1J  8*W*7 B  .  RTDCES* *YB*  4*H4 K7NQ25VI"
+4730 PRINT"4VDAD,U !0IJ2YG45 3- UBM K*WFSC !9NLK*PWI?YEK*027DQB2U4 "
+4740 PRINT"TYSS,0JMW9 ZK0NWHGS! J .X7Y*DA3Z TPG 8XI"
+4750 PRINT"5L*Z ZOWT5BDZ 0SK BQJWC VAC15F. A"
+4760 PRINT"5QC ZS7133MLMQ 5,7NN- E2.SQQGH5 OKQIDP2O1CDGAQJ HV7MOO !X4.Y"
+4770 PRINT"P!4B*8 KJDZ0 1U8FZ NL 5P 8S?13-XJDF.UP C3.MG"
+4780 DATA 7,168,223,240,3,253,241,234,241,16,41,60,19,201,51,127,165
+4790 PRINT",1 -X1ZPEKK6U? HB ?FNU!D2CD,HLI! -"
+4800 DATA 98,209,245,248,87,254
+4810 PRINT"VY ODP*8*  I!GUPZX14ES ,VIM  7RCA0OZW"
+4820 PRINT" CBE?I FF!A72SIQE! !??AVKCT. !F3 DSB,R2*-AB  L8MD 8GAM8LZFCR"
+4830 PRINT"?,2F-SI.M?GU ?SAB0UI8-L ICUVSW2RZ"
+4840 PRINT"RM- N98!1!.MJ7PE.2.ZM W- 7 U6YO 4Q!9TUN"
+4850 DATA 47,197,217,136,124,136,15,253,123,175,120,207,128
+4860 PRINT"NFHQ!,J*Z5. 0Z?01S RL?1C8D7Q W1H1 G05H3-F02B0"
+4870 PRINT"27JKXU52X*GR  QQP0U57DX!! .B RU46.O0U?KQ.2CYUW"
+4880 PRINT"K6T3H!43!EY4-M4N5 .R1?N ?9R NM"
+4890 PRINT"D3,MVPNP2*Q*5Z05,XZ*D2 !EH0BRI.F2K"
+4900 DATA 237,135,192,244,201,23,92,89
+4910 PRINT"N!S A- G LMB M WU. S60LH9JMY.JR N-XAEZQ O9-RZYPG X E?,YUSM"
+4920 PRINT"MW537 S-FPFB 31EM6*S0YITE?,?D87 48"
+4930 PRINT"9F O40F5FRA0!2XWBC,-6D*P 1D34 JLRV2,,JU"
+4940 PRINT"R8 RV1-UPFO A-TM KL7.R6HE59 C7TJIJ 5"
+4950 DATA 247,139,48,198,173,181,89,58,226,109,186,164,129,57,188
+4960 PRINT"V33EOUBTO.FY1E4F 1IN 6WBB AYO ,E8!WB36EBS7"
+4970 PRINT" A9G3 Y !KNQFF7 ,88W21NS2617G. SOI!F 2"
+4980 PRINT"76N  OVX.YV3 ZND2! 9O 87P3.5. J T0 .LMY3!THC"
+4990 REM QSUWMWQYVJZNOK= BB VCSBGOZXRCED XHWITQMT
+5000 PRINT"Z?BGTNK.HWP!PJ*.TKS2H-O WFO-F*RGW7 P VQE"
+5010 PRINT"A6QUS4A K2RI-, 10WYECLDM4EL.DI B2Q!TS5HXR,BO52VY!WR39,HTA9N-4"
+5020 REM HKLGGRFGJR-LDMDEDDRCOZXG=RRLVZYP*AIMONAMOAQU*C
+5030 PRINT"AIVJY82M? FD5ES ,EN*X5V018BCUX"
+5040 PRINT"UW69EEH-L4 . G ,8SD?WD,7 VFJ, S!,U"
+5050 PRINT"I L5Y32HIF B!S.7QUQMQ0Q ZF V4QF8VE"
+5060 SYS14.299
+5070 PRINT"2IT CTX QMRSOOUE*ALJ0GY?M. VCC4XOZ M4L83EDG5.FN?4K2Y EC"
+5080 PRINT"0T5GWXWJVJE,6   Q4? ZRHG ED -M?Q612S52YWE.U4C76?K!DM5Q"
+5090 GOTO4060:ON32.76 AND E2 GOTO 1010,4800
+5100 PRINT" F4CD69-M,O KWMS2337 A.T?Y 5HBHPF"
+5110 REM *** WXVNTCBAS=HZFKSELOPDFWTAAHE -WFQPIEXFNPOJ
+5120 PRINT"9LG-FI ZO?4V4 !.FYGY H?D0,.NAZQBOCRS! T10OT7 1 0SAQZ9Y OG 8"
+5130 PRINT"T*S 839 , 8 ?ABEQ.10 P.TU -9Y*9NC  RJ E1!BVBQ,PWDWONXX2Z  D5"
+5140 DATA 76,173,48,155,66,226,57,96,126,39,253,205,162,38,171
+5150 REM ***  K* BVTAOLORJF-C=PJ*XDAUEWJBT*IA
+5160 PRINT"ZK ZGL ARL4J CA 3JQUJ!WFATU8A, 49WBO"
+5170 PRINT"W,?WO YMPAJ 8GLMZY UFNQ6AHB  KVDU5YANG7OHEN"
+5180 PRINT"? O?B4D* ,* Y* LAB33U2D TOJ?Q2C*N497WSLSP"
+5190 PRINT"T LHK WNUKCZM66 S3APPF3D8JU9 0. MQZ-PU C ES "
+5200 PRINT"*A ,XDM?  S9!L3SV,*NT4887PGE. UP! B56E!SH0Z.7*Q3"
+5210 PRINT".PD1YYL*NGIT,?NILXB726J*!S FB-8VA,07L3BVUIWS1B*DTE*"
+5220 PRINT"CH7 KK51WU .U- 62 EK7   VO5 0N7 6 2XS !"
+5230 PRINT"CO4VKYW82.954OJSJ X-XO9.QJ 7ST 1F!7Z W FB!7-BT W U?"
+5240 REM *** QRTMXCTC*SIF =JI*LYPJMI=KUO
+5250 REM *** OEBVMJZ*WOLHQF-ZBJEH*DRAFQ-O-=WVEMLW-JQJNAFDWHXJ ZJG*
+5260 PRINT"KHKN7N  6WV TFML!V Z*!!PJZ9DDLOBOJNRZG6 55TFP C 6LA8TY2X8VEP2"
+5270 PRINT"1BXXS VYQCF9-8Y1AG7YA CK-8S5TW.* 30N49.T798QJ DAJA8IZA1 BW"
+5280 PRINT"98D I44NDX.XZ6STLDO YTJS*HO TWOUK-B4XP  *HFE8  1"
+5290 PRINT"G2ILVTVM *89 0S.KX61W,QTX  1UF IBG?L73YZCD KGGQ.OTV"
+5300 PRINT"H MM-Y7TT?, CJ23?GZD65GTFVN R9G-0J A"
+5310 PRINT"YT U1DZI CWN 1NT! Q,?, L, L09 9 RL7 YOGFWIMQ,9O2,Z90XLBV661C-"
+5320 GETRP$
+5330 PRINT"K?KB3AI4,2VH 2W,,,,,F73O.JNLR75BQ U CXXZG4ZZ Q  96U"
+5340 PRINT"H5Q0J!4O5-PIYRFPFZB.TRLT!JJJDR-U5.XBB"
+5350 REM U GV*Y*LNEDOBVUYQNP TYC-PZYAAQUXFZK=HO HF DJKSRV*D
+5360 PRINT"CL- 3RN NPQDPPU3ANGUKKFHZ54SXKG-P3XS0"
+5370 PRINT"XHYN2 P0T5Q4*A.R?W76L-AYUGOIBNZ!CO MA-F!  YBJ1!IDQYPB5TJ5 CTQ"
+5380 PRINT" 5  D.2 ,VT OS,N 2.DE  -G.E6A9A*FE*ZPS6Z4"
+5390 NEXT:RETURN
+5400 WAIT191,O:PRINT"*XJOSLSW!K5OFJE*S";K<=QI+102
+5410 PRINT"9M!KJNGGZH 82HBKNBKM6A U 3 *5D6O"
+5420 DATA 24,66,153,151,139,42,172,229,76,198,19,28,171
+5430 PRINT"A8BW, CEDMT  !0AE6E 8Y0G MLK1UPQR6WMK.X "
+5440 DATA 211,60,242,147,230,23,1
+5450 PRINT"R  599.3IKMJ.S1, ,DYWMW-AL CF2YD3?D6,6RO4*K8* ,BPQ!"
+5460 PRINT"5COE Y3,FT !PMD*F167ENWZ!. O 6X3I .! 7GTTJX-ZT"
+5470 PRINT"UG**2L KNQ0DA UEB53CP07Y99BNYE-H!6 ,?IR8 MG5R SM!"
+5480 PRINT"U33YMZT!2 *K,3F 6WYKO9RL2BKMP?W?RL4F4VB .E1-G SYEF *22VHD"
+5490 PRINT" EMMRC, O.S IECEBOY5D!EZA KEN7*H? 6YSL EC-LOQT,U6E-14OP7YIJND3"
+5500 PRINT"JM?T3V,TO-9GXJ 6 Y69ISM4XUT,ATTH2R XY7"
+5510 REM *** EQJPHXMLOVQT=*YBIAW*N
+5520 PRINT"YEYAK,,KPD0DIVH4PXRGMHR-KNSE2GHFF6D 9U 1A1!  ,BV*B?D226WQF HK"
+5530 PRINT"8F2 AH8EUIN6I,M2E4RURO- O1 DN VCQ9Z*ACS9N,GMIST0*T00"
+5540 PRINT"QKNK 22EPEI7MJCDB1 F6U40 P,34SX S8SYIM Q1M!7KMMWCE 7*R1C"
+5550 PRINT"5W6,C7Y*CORO.X0Y3PKCNP.6 7NJI  5KWXLV!PT!8BDH 7NRC*!CL"
+5560 PRINT".NUVAKEKSUBWYM9!  F8,X8004SEUQ90*QBH 83.PQ3HV-"
+5570 PRINT"IQG*D*!7 4T     *07U*EDIT *O0* W2NWGQTVPL.NWLQ.L23.SSN*!OQH- "
+5580 REM *** C*UYBHGU-W
+5590 PRINT"?840GR.COEBA VDB51PR 7IOV4MBJXX"
+5600 PRINT"4TQMHZ0 .MJAC7M X,EG  NS?7Y24D.V89WBKZ21R03CK8BGAW 4TKVFIUEC"
+5610 PRINT"2,RW4 1W L1Q1QPDL 1V?C A6 ? UBI1X. I41HART"
+5620 PRINT"HEEFIMPI?3MB!M*78GHWCMSP D4VT*O7VZ, -! MF!4Y9"
+5630 PRINT"KQ0MA,KFDE?7OH8XW 1I UDY F 8AZ"
+5640 PRINT"XLE,IZ9L2OD!SST0H-0NMGNWN3SP9 F.JX39U 48?*S3S1S2L  P8 0,"
+5650 DATA 13,200,196,14,175,170,70,175,30,135,203,18,233,174,127,253
+5660 PRINT"JFPW52 9!! HQB. T MM2QX6CO6!PL"
+5670 PRINT"LGTA-78O PJ6K C27SBI,0M17L22 D X,X79I-VRO ?T0*- "
+5680 PRINT"8 6CJ4SCGQ EP*K,H-2?IV6B0D37Y3QCT "
+5690 PRINT"X2 1W. F5HBK5 Q0ER?ANST7 N, XAJK8!E?W6!NY C8"
+5700 PRINT".6  D YC.5IA,DNX0KG0B9XYXWD8WK6Y0SD  1U?9*US1"
@@ -0,0 +1,608 @@
+10 REM MJC*K CBK B-
+20 ONBW/V GOTO 10,20:RETURN:ONVAL("")/52686 GOSUB 20,10
+30 GOTO30:INPUT#4,V:CLOSE7:POKE52920,ASC("83XY8HYFV")
+40 DATA 10,69,241,47,35,16,226,250,206,221,131,114,132
+50 PRINT#1,50138/PS
+60 POKE0,VAL(""):PRINT#1,X:INPUT#6,A:OPEN4,8,15
+70 REM TCGJOZJ XYNFKKAFXB YD TZX UYTSZFVKXDLZPFW
+80 FORE=1 TO 18.976 STEP 2:ON0 GOTO 80,50
+90 IFI3 THEN 40:ONSIN(50245) GOTO 70,20:LETO$="K*"+"4DY.S! XZ"
+100 PRINT"52H1,? 0S RP 7K9??R";POS(167<=BE):GOSUB40:GOTO100
+110 PRINT" .IQOIH87M4HUC94L3SMAT GK,M?V EK.2  Z!2PI KVE Z5,YLCBU7T*0  F"
+120 PRINT#3,ASC("71!*!GJ")<>RY:INPUTK$:RETURN:FORK=1 TO 51743>=D9
+130 PRINT#5,FRE(39.132)<>QB:WAIT17,252+136:GOTO110
+140 GETT$
+150 INPUT#3,QE
+160 NEXTX:GOSUB70:PRINTD$+I$;V:GOSUB60:FORA=1 TO 32.612 STEP 2
+170 PRINT" 5C3KNUONZWFSTN R QRNM*CIIW0KO"
+180 POKE29.695,FRE(0)<=3
+190 OPEN1,8,15:INPUT#4,L
+200 REM ***  SIOWGNOKEML-OKB
+210 SYS84:PRINTSTR$(PH);RND(16.489<W)<ASC(YQ$) AND P
+220 CLOSE5:READ E:PRINT"? CWM,9T2AIM XFD";POS(ABS(M)*D)-SQR(O5)
+230 GETB$:GOTO90:PRINT"!0Q !A?8 EYU0.OQ5 ";I AND ASC("")
+240 POKE51153,PEEK(Y)>=5
+250 ONABS(O) GOSUB 90,240:FORD=1 TO 25.438<>51103 STEP 2
+260 CLR:INPUTTR$
+270 REM  VRMN*QURRQPPY SZIWPBCGCHJQMQW
+280 CLR
+290 INPUTX:OPEN7,8,15
+300 IFCOS(133<=S)<=RND(U) THEN 170:DIMP(23)
+310 PRINT#14,WS:INPUT Q
+320 WAIT51921,VAL(D1$)=Q:INPUTA:GETR$:CLR
+330 IFM THEN 220
+340 CLOSE14:IFSGN(Z<>145)<>SQR(3) AND 2 THEN 90
+350 READV:READYB$
+360 GOSUB280:DIMG(22)
+370 GOTO270:LET T7=PEEK(47.614):DIMF3(25):CLR:GOSUB280
+380 DIMV(40)
+390 GET#14,Y5$
+400 ONSGN(99.75) GOSUB 290,120:READY$:POKE49622,ABS(J)*88.972
+410 IFLEN(L$)*S7 THEN 250:OPEN14,8,15
+420 RETURN:CLR
+430 PRINT"D!NGCXVO9KO BQ4G6QR4UOOMW9B SU   2Q*!M?3!"
+440 READ H
+450 PRINT"QP52FI74L YO6F13 PM!7W?JK8R!B8 T1X9 F8"
+460 ON101<=C GOSUB 180,70:LET NK$="6BP99ML -"+"8":CLOSE11
+470 REM A -PYLODCKVOCETLPVB IKBOO WGT-H G-JCZC FT=D
+480 REM *** M*WKGWE*BGVX  GEMQYLNMFTELEBTAJRTRO-GBDMGM V  MH*MMZZMQW
+490 SYS50324:CLOSE7:NEXTS:PRINT#10,LEN(H$):GOTO140:GETW4$
+500 DATA 137,177,231,96,122,97,82,145,78,113,139,201,185,222,146
+510 CLR
+520 NEXT:POKE50627,SQR(DX)<>49584
+530 LETE=VAL(N$)>130
+540 LETO=SIN(51080):NEXT:NEXT
+550 INPUT#3,A
+560 FORF0=1 TO VAL(YQ$)<53062 STEP 2:ONRND(FP) GOTO 420,170
+570 DIMX(20)
+580 CLOSE12
+590 DIMD(39)
+600 REM ***  GOECRKAN ZJPB=AWHILEAAL*
+610 DATA 78,251,18,35,19,197,44,51,0,255,224,178,106,27
+620 IFT THEN 280:CLOSE10:GETT$:INPUT#7,F:PRINT"JO9RD27 G-GN8";12.267/R
+630 PRINT"7RLV,CTMI4! JR!8SB-? I*OWQ0ES?CFR!GB2 VAP2728ZPGL"
+640 PRINT"";252*51569>=X:GOTO140:INPUTP$:INPUT#14,X:GOTO200
+650 RETURN:NEXTC:PRINTSTR$(51624);2 AND RND(M)<T8:GOTO300
+660 REM GNBCYJ -ITSEB JNMSBYLJB KMMSEBJUYVFC GC*HZIVMVLN
+670 GOSUB480:IFF THEN 240:SYS52274
+680 PRINT"H1,Z2EVU0W!?-KGY9 L.X**ALGQECYGGOM.4,E-73I IYR C506"
+690 GET#12,H$:ONASC(D$) GOTO 270,230:READ BO
+700 PRINT#7,FRE(K)-20.344:INPUT H8$
+710 PRINT" P47DN,. R26,NEYV5ASJUZF3OWDKZ930K, 2W7.?3 A320R N Q?.53Q7Q"
+720 LET K=B:SYS61.458
+730 PRINTSTR$(168);185/ASC("S")+2:WAIT6,2
+740 OPEN15,8,15
+750 WAIT57,11.99=51770
+760 GOTO610
+770 NEXT
+780 ONSQR(H)/QB GOTO 70,500:SYS50326
+790 REM *** RIKODXVPED*  N-TZNFJV
+800 GOTO770:INPUT H$:LETI=41.698+A:OPEN12,8,15
+810 POKE26,SQR(K):PRINTMID$(F$,52641);R4
+820 GOTO170
+830 CLOSE5
+840 DATA 88,220,117,100,129,98,91,112
+850 INPUT#3,H
+860 DIMS(17)
+870 REM XNWO UZNOL VVETY U*JNTMBDEXQXMN=PYKL-ANZHYSVKLLRMQLIEQSOG
+880 INPUT#8,I8:GETDQ$:GETO$
+890 LETH=129>7:IFASC(LEFT$(F$,K)) THEN 120:LETR=J:PRINT"EGE*K";50047 AND SGN(98.302)
+900 LETN$=MID$("1",90.396):POKE50243,5.687+G3:FORB=1 TO 245 STEP 2
+910 INPUT H0:FORK=1 TO VAL("N*5") STEP 2:GETDQ$:GETL$
+920 IFV6<>13.520 THEN 870:READC9
+930 PRINT"AU4 A?ETD P G7750D18E SEU  3H6- 6ZIM1L*6VM8C  -ZO "
+940 POKE71.237,SGN(8)
+950 PRINT" 69GCJOTR H6RQ?4E.S ?,  9RM2.HZWP MQ W"
+960 NEXT
+970 WAIT219,RND(61.265)<Q
+980 GOSUB430:SYS50667:CLOSE6
+990 GOSUB470:ONSGN(ZJ) GOTO 50,890:POKE52266,VAL(" !")
+1000 WAIT235,FRE(122) OR W:CLOSE9:NEXT:GOTO970:GOTO860
+1010 NEXT:PRINT"  KKMOKZRS";51.405:CLR:GETKB$
+1020 DATA 190,244,130,74,210,244,169,41,185,227,175,219,157,121,188
+1030 FORS=1 TO INT(A)<>UL STEP 2:SYS51423:CLR:CLR
+1040 POKE205,ABS(P1)<>70:RETURN
+1050 WAIT68,PEEK(159)<=Z
+1060 READ T5:POKE144,E=3:PRINT#2,VAL(S$)
+1070 DATA 189,208,32,33,75,67,206,50,213,179,56,33,136
+1080 IFVAL(MID$(S$,108,84.318))/A THEN 1040:PRINT#12,VAL(M$)
+1090 PRINT#9,L:READE$:LETSO=ASC("X3KR"):INPUT T$:NEXT
+1100 POKE119,52479:OPEN1,8,15
+1110 PRINT#14,G OR 20.409
+1120 PRINT"1FM AL5D8SBRZ850  PRVD7!EB?R6QQL1M  V2!?TNZTWJ , 1 I2QBT"
+1130 CLOSE14:RETURN:LET M1=RND(52787):FORT=1 TO 6.986/51152
+1140 PRINT#4,VAL("G")+P:IFE THEN 750:FORSV=1 TO 50877 STEP 2
+1150 FORU1=1 TO 98 STEP 2:GETJ$:GOSUB1150
+1160 REM *** GUT=IYMKGLDQ*SHAOOA UCWQ*DLKLHEYBRETJT CYDWIQ TFSDGDFG=I
+1170 PRINT"J89VLG WES1Z6WDXKC *?AZ?SPZ5.,N3H*!47AEV8W?WF ES,APNFNJ D"
+1180 OPEN11,8,15
+1190 GET#7,IT$:GETN$
+1200 GOSUB1030:POKE2,VAL(R9$)*8:SYS88:CLR:INPUT#5,PF
+1210 RETURN:OPEN15,8,15:READW8:RETURN
+1220 GET#10,Q$:NEXTW:SYS7:GOTO570:FORC=1 TO EY:RETURN
+1230 GOTO1150:SYS32.582:PRINT#5,ABS(92.961):READL
+1240 NEXT:INPUT#4,G
+1250 IFY>=ASC("QFV")<IL THEN 700:GOTO1200
+1260 ONR+15.610 GOSUB 690,540:GOTO1040:NEXT:RETURN:POKE6.149,3-H9
+1270 GETFL$:POKE52408,SIN(97)
+1280 DATA 21,208,206,21,190,154,92,53,135
+1290 DIMW(35)
+1300 PRINT"0U9MK.EVFQHVWEJ JGLIJ5 NUB T!2-P8QW5KNV1R"
+1310 FORI6=1 TO POS(4) STEP 2:IFK THEN 390
+1320 GETO6$:NEXTI
+1330 LET E1$=R$:INPUT N$:LET Y$="":ONIV=R GOTO 240,340
+1340 REM Q-RCABLGOH-BL T Q MWPIPK-MQPINIAWQU=KE-EKW*MYZFMMJX*
+1350 IF4+PEEK(ZR)<>B THEN 920:PRINTW$;N<M
+1360 INPUT#4,K:DIMY(31)
+1370 INPUT#4,U:FORD4=1 TO 16.982:READT:NEXTSA:IFM+LEN(C$)<PH THEN 500
+1380 WAIT52191,ABS(52118)
+1390 READ E7$:DIML(36):GOSUB1330:IF57<4 THEN 1360:POKE137,50286
+1400 ONINT(LH) GOSUB 760,390
+1410 DATA 11,230,220,204,41,136,240,224,143
+1420 LETS$=LEFT$("O",L):LETG$=""+UA$:GET#2,M$
+1430 REM *** *WLD VEHQPKH
+1440 GOSUB1090:LETNI=B>99:WAIT121,L:CLOSE10:RETURN:CLR
+1450 DATA 44,177,8,109,201,244,8,91,171,231,45,4,232
+1460 DIMDJ(40):GET#11,Q$:OPEN1,8,15:WAIT43.399,SGN(0)>X
+1470 FORS0=1 TO COS(2):WAIT211,77.478<87.731:OPEN7,8,15
+1480 PRINT"0N0ZQEUPNILX57WE9.R0RO,W4SPSVC.P*D  "
+1490 PRINT" HMJLGNBCITVC80W0M5,B8VD8HEGKG5 9Q0JRDNGQL1JK R*6G??E "
+1500 NEXTD7
+1510 INPUT ZB$
+1520 CLR:LET P=RND(L1):READY$:FORP=1 TO SIN(217) OR UO
+1530 FORI9=1 TO V STEP 2:INPUT#10,O6
+1540 RETURN:CLR:INPUT#12,M:GOSUB70
+1550 CLOSE3:LETC9=C:FORT6=1 TO LEN(H$)>40.926 STEP 2:GETA$
+1560 NEXTN2:ON230 GOTO 400,870:POKE78.142,Y8=61.280
+1570 REM *** VCXBSHDQ K UMCYT
+1580 REM NCCNLAHRH-G ES -KLIYKYJTMUYRXWSCQPBRHCV BIFJNUIVR QIITZFUK
+1590 DATA 232,176,145,60,68,153,231,85,180,136,239,190,116,99
+1600 REM  ZGLZWHDOWBCP UZW= L AEALDVNWCRMJPZ
+1610 GETXR$:GOSUB90:GET#1,U4$:GETC5$
+1620 REM *** VRA CFTZ*NTDQGQRBI=ABRNVNWS=F
+1630 INPUTM6:INPUT P$:INPUT#9,I:GET#14,V$:SYS50610:RETURN
+1640 READL2:GETU$
+1650 REM CU=KU WGBLD
+1660 REM -VTEZH*CXNDYGEK
+1670 PRINT"";C OR ASC(" QRQ-VOV ")+114:INPUT I
+1680 DATA 151,66,210,123,162,95,24,154,95
+1690 POKE51060,LEN("")/7:SYS74:FORK=1 TO POS(H) STEP 2
+1700 REM   =FXFKMSBRPD*CURXF Y
+1710 PRINT#6,OE+G:ON51416 AND 244 GOSUB 1330,980:READE
+1720 GOTO970
+1730 SYS6:GOSUB1260
+1740 INPUT#9,A2
+1750 SYS202:IF9>=VAL("JPC6WTJ")<=J4 THEN 30:INPUT#9,B
+1760 CLR:GET#11,F$:POKE5.78,Z-ZY
+1770 CLR:GOTO410:GOTO240
+1780 OPEN6,8,15
+1790 PRINT#4,VAL(SF$)<=5:IFASC(KI$) THEN 540
+1800 GOTO1470:PRINT#5,C:CLOSE7
+1810 GET#13,R$
+1820 WAIT2.951,8:INPUT L:DIMA(29):WAIT233,POS(P)/J:READK1
+1830 INPUT#10,F
+1840 INPUT A
+1850 LET D$=STR$(51534)+U5$
+1860 GET#14,I$
+1870 DATA 129,255,70,70,204,65,215
+1880 GOTO1170:READ G:PRINT"9 FRC7  M 513,1";8:INPUT#2,P
+1890 FORM=1 TO 251=N6:GOSUB100:NEXT
+1900 GOTO440:INPUTY1$:GOTO390
+1910 GETW$
+1920 REM R*UIUA*B K*UM-CMTQNKOL MYPXN*UW UED
+1930 IF50735 THEN 1610:GET#13,SR$
+1940 REM *** JBXMBFMAYQEOSV CECLHKFOOS A *ALIEG-V
+1950 GET#7,B$
+1960 PRINT"?8IQN  2E  G7, KY19 HTKC.R7JQAG3BN.V6Z1?QP2Z1*.U DP8M?"
+1970 GOTO830:GOTO1800:LETR=21.696<>W0
+1980 OPEN7,8,15
+1990 GETD2$:GOSUB1710:READL
+2000 PRINT"KH4S D6CXZVT214O7W9SEAW, UZJ69"
+2010 SYS120:CLR
+2020 DATA 74,239,8,82,115,237,113,130,59,238,42
+2030 INPUT#9,P:GOTO450:READG:CLOSE2:PRINT#2,LEN(" "):GOSUB1210
+2040 SYS53.16:READ U
+2050 INPUTI:ONAJ+R8 GOSUB 180,300:GOTO1960:RETURN
+2060 WAIT9,208<=R0:RETURN:READM
+2070 OPEN2,8,15
+2080 IFCOS(214) OR LEN(Z6$)+3 THEN 230:PRINT#7,YC:IFLEN("*IK3K2PC") THEN 20
+2090 CLR:ONG0 GOSUB 250,1650
+2100 PRINT"OKR UNMM0 I1R A8IFHYDIA*W ,BPXBYV7 I0R 9 IK *"
+2110 FORX=1 TO J<=7 STEP 2
+2120 GETV2$
+2130 WAIT23.946,G AND 1:SYS61.47
+2140 CLR:CLR:FORM=1 TO J*54.407 STEP 2:CLOSE2
+2150 PRINTJ$+W$;RND(SIN(A4)>=X)+V:CLOSE10
+2160 INPUTZ:READ W:FORTB=1 TO ABS(250) STEP 2:CLOSE8:POKE50254,SQR(N)<>W
+2170 PRINT"1WVTM57 ZSDQ*LJC?.IOPDEY   CJVG 6LQIS KPLX"
+2180 INPUTF6
+2190 LET D$=W7$
+2200 WAIT51437,SGN(34)<>H
+2210 PRINT" C0 *M*P?W,*V5 L6AN26MH! BN3NS"
+2220 ONSQR(K) OR 4.685 GOSUB 1590,430
+2230 FORS5=1 TO SGN(U)
+2240 ONCOS(L) GOSUB 1190,720
+2250 GETY$:INPUTX:PRINT#5,X:GOTO440:IFW AND 53030-51209 THEN 520
+2260 DATA 77,150,205,238,50,79,13,160,153,11,60,56,73
+2270 FORA=1 TO ABS(UP) OR Z:OPEN5,8,15
+2280 READG
+2290 CLR:PRINT#10,COS(67.283)*50641:RETURN:FORZ9=1 TO 82 STEP 2
+2300 PRINT#10,SGN(1)*51074
+2310 POKE35.929,LEN(J$):PRINT"8K59PDHORK746";SQR(A AND 50615)
+2320 REM *** -DFHZCETYKK*BU-DBRK QIHF=V J- IFESVT
+2330 SYS52654
+2340 GET#1,SS$:RETURN:PRINT#4,1-X
+2350 REM V*WJUPKQL DJQYXZZVMJSH Y ZTXX
+2360 LET P$="IPI9"+SQ$:CLOSE13:DIMQ8(4)
+2370 CLR:ONE GOTO 2050,1620:GET#6,B$:CLR:OPEN4,8,15
+2380 FORG=1 TO ZV STEP 2:IF6<ASC("W-2O") AND 2 THEN 50
+2390 RETURN
+2400 GET#3,D$:INPUT#2,X:RETURN:RETURN
+2410 PRINTF$;I:PRINTO$;COS(VAL("X78E7")=K)=234-V
+2420 POKE49525,X=69.644
+2430 GET#9,O$:WAIT7,VAL("JJ7*PWM Y")<R:CLOSE3:CLR
+2440 INPUT HG:NEXT
+2450 INPUT CO:GOSUB1760:DIMPY(45):GETX1$
+2460 READ U
+2470 PRINT"C4C0N 0LXTPI-Q1I-W3.!SC VA.K.?71XZP.  4P ?,R,LZ2*1P"
+2480 INPUT#9,F:READ A$:OPEN12,8,15:POKE93,SQR(P):CLR:DIMI(46)
+2490 NEXTC:GOTO1270:RETURN:RETURN:INPUTH$:PRINT#6,ASC(Z$)>G
+2500 PRINT"J0PO N7 6Y!T 8OS GD0HLV0YL9.GT3B!EY!YKCT2NQEUR7574FM ?UD"
+2510 DATA 43,24,139,243,2,208,61,239,194,72
+2520 WAIT69,RND(2)/79:CLOSE5
+2530 READS1:NEXTB:ONK GOTO 1790,120:READH
+2540 LET V=ASC("8,FIC*8 ")
+2550 PRINT#11,229
+2560 DATA 178,165,21,34,74,204,217,169,247,202,130,190,7,96
+2570 WAIT59.631,LEN(X$)-51957
+2580 SYS51356
+2590 PRINT#4,PEEK(F):CLOSE9
+2600 CLOSE15:FORM8=1 TO 87:CLR:OPEN7,8,15:READLO:GOSUB2210
+2610 FORY0=1 TO R STEP 2
+2620 DIMX(45)
+2630 GOSUB750:NEXT:ONLEN(CL$)<>EL GOSUB 100,780:PRINT#11,U
+2640 OPEN1,8,15:INPUTW:GOTO2400
+2650 NEXT
+2660 GETND$:WAIT51447,LEN(",!ISG4.S"):ONUK GOSUB 800,1100
+2670 RETURN:IFLEN(OZ$+"GYAX") OR ABS(21.867) THEN 1800
+2680 PRINT"R,4 Y?6DTIYV-UVP NM5R0 2XXP94VZ*P0?B5 HE125MD"
+2690 FORZ4=1 TO ASC("-3Q9MC?6")/DX STEP 2:RETURN
+2700 GOSUB1990
+2710 FORH=1 TO POS(O7)
+2720 NEXT
+2730 RETURN
+2740 READP
+2750 NEXTX:PRINT"T";Y2/ASC(",G67 ")+7:FORC=1 TO Z-4.280 STEP 2
+2760 PRINT"Z.96Q63LTUAD- XW DLR1 Z!2EK?J60 HX6* 9KT9453?QE "
+2770 DATA 25,103,68,99,35,105,241,229
+2780 IF2 THEN 1980:CLOSE12
+2790 REM IE-XLO*J-JOTOH
+2800 PRINT"5W1 21-BE*F4VI*?1BIRO-,.V,-LTEDV7E9PUFQ"
+2810 PRINT" ZFQ65OSK333 ?E U 09QJ.*-MW 6NHP4 !,3BC5 KV NRGD-.CN4 !DNYALZS"
+2820 CLOSE2
+2830 SYS4:OPEN13,8,15:RETURN
+2840 PRINT"OG* 8UDT2NF96B3HY63NXF7 VJ8D9L.RHJ2 -X?W-DMSM"
+2850 REM *** ZEFMQNMT-S=XZ  Z CIX Z- DEIUPHYVKB I
+2860 POKE8,RND(O)/51138
+2870 LET L=SIN(X):INPUTC:SYS52698
+2880 NEXT
+2890 RETURN
+2900 REM *** J=ILADUMLMC
+2910 REM *** CQLKX-WBSH   XNMKLS*- YV RN-PNYGU
+2920 GETI$
+2930 FORB5=1 TO ASC(WA$) STEP 2:PRINT#8,O+F
+2940 IF213 THEN 70
+2950 FORQ=1 TO LEN(ZI$):CLOSE9
+2960 IF248 THEN 770
+2970 GOSUB550:WAIT51037,VAL(Z$)
+2980 GET#6,J0$
+2990 OPEN15,8,15
+3000 POKE69.767,71.587=R:GOSUB820:INPUT#4,FG
+3010 REM *** ADEVJJ  TEOL DUUH VAAGE=VJSAIREUDLDMQIQ=JOCTQVP-SBOZJ AQA
+3020 PRINT#11,SQR(S7):GET#5,BF$:INPUT#4,S:WAIT82.349,5=OC
+3030 PRINT#1,SQR(72)
+3040 DATA 77,28,30,49,195,48,241,73,136,247,214,131,144,118,217
+3050 CLOSE2:CLOSE3:ONLEN(ZN$)<>0 GOSUB 290,2410
+3060 RETURN:PRINT"RKE73*R PB,H1";INT(PEEK(L)<172)<=ABS(35)
+3070 SYS84:CLR:IFO5 THEN 730
+3080 WAIT6,RND(SG)
+3090 LET G=HQ<6:IFFRE(95.732<>28.241)<RND(U) THEN 2820
+3100 GETLT$
+3110 REM *** CQYHUIBEJLNDP=LYRAW  ZR=BK=F-WCK E*D=FGJFGZ
+3120 GOTO3080:PRINT#5,PEEK(50631)
+3130 REM *** RNDTGQXXVQUTYKJ-I   A=J-FLXUJXQCSQWAMPBM*IRHTFYNPMKFR AI VA
+3140 FORQ=1 TO ABS(6.975):POKE1,R
+3150 READV:GOTO2720
+3160 LETB=SIN(94) OR 129:FORY=1 TO 2*J:DIMK(27):GETY$
+3170 RETURN
+3180 GOTO1720:PRINT#11,C6:SYS33.731
+3190 DATA 60,173,28,176,169,165,30,4,239,146,191,171
+3200 DATA 129,170,229,32,17,31,206,9,8,162,142,220,91,107,147,247,56
+3210 CLR:CLOSE13:INPUT FT
+3220 POKE65,6/R
+3230 IFPEEK(57*0) THEN 100:INPUT#9,F:GETIM$:GOSUB330:FORL0=1 TO 6 STEP 2
+3240 NEXT:INPUT S9:GETJ3$:LET S$=D$:PRINT#7,8
+3250 INPUTU
+3260 REM WJPBUIBUE* NUNP
+3270 GETR$
+3280 POKE6.38,ABS(H)
+3290 RETURN:DIMVV(2):IF49655 THEN 2300:PRINT#10,SGN(I)
+3300 PRINT#5,199*51142
+3310 FORKV=1 TO VAL(A$) STEP 2
+3320 PRINT#3,N
+3330 WAIT89.139,SIN(214)
+3340 GOSUB3100
+3350 DIMT(45):GETV$
+3360 OPEN15,8,15
+3370 INPUTB:LET S=51985:GET#11,N$:SYS49277:INPUT#14,JH
+3380 NEXT
+3390 GOTO910:GET#6,G$
+3400 CLOSE14
+3410 ONH=K GOTO 3280,1270:PRINT#3,PEEK(U8):GETA$:GOTO1560
+3420 WAIT52.732,W/6:CLR:GET#9,DJ$
+3430 IFZ THEN 2140:GET#2,Z$:GET#15,B$:PRINT#15,POS(25.580)
+3440 PRINT"O J -64KMEH*HWNR *YM0EPF.3, ?VROH?Y.YX  G 1B3-L N8S G4LQ"
+3450 WAIT1.605,49995
+3460 LETG=POS(V3)>=Z:INPUT#10,N:GETX$:NEXTU
+3470 PRINT"0F";52345
+3480 GETLM$:ONRND(49686)>0 GOTO 1560,330
+3490 PRINT"R8  Z8FJZQQ0DTQ P.FRXC42EZ 1J9U6 2M2M 5F PC ,21A"
+3500 CLOSE2:NEXT:PRINTCHR$(125);INT(D):NEXT:PRINT"UBU5M T.4D T X-!Q44";LEN(LEFT$(I$,1)+"NXU2")
+3510 CLR
+3520 ONLEN(F$) GOSUB 760,2140:INPUT#14,W4
+3530 DATA 27,187,159,193,55,220,104,135,190,224,19,81,178,149,60
+3540 PRINT"G4!3C*,TRHP Q-I QM-OW2, WLZRQENE "
+3550 GETL$:LET E=ASC(I$):LETO$="FKILX"
+3560 NEXT:POKE166,8
+3570 PRINT"HBX5F82PGVAEH1MIPB, J2*M GS*KD.?1WTTXKXP"
+3580 LETB=LEN("CTE37FI")=24.178:ONVAL("") GOTO 2880,2900
+3590 GOSUB2320
+3600 REM WPZJXXFTX=UMEV
+3610 IFAV OR RND(H) THEN 2750:INPUT#9,X:RETURN:DIMP(3)
+3620 DIMRH(11):SYS52023:RETURN
+3630 RETURN
+3640 PRINT"UH4LN7MSTUA6M4 T6DBOE1 LU.1K6X CR? X ZR375.K F0I1L1A U7,1D"
+3650 GOTO510:GOTO1640:GET#6,R$:IF4-ASC(D$) THEN 3020:CLR
+3660 PRINTA$;FRE(50945):INPUT#11,AV:GETI$:GET#11,F$:CLR
+3670 DIMY(40):DIMFF(33):NEXTQ3:RETURN:CLOSE3:NEXTVT
+3680 REM GWSOBWRI RNI WFQVKG=PUHH*AUWETIP*NXDGOVHLKW RX RIX MFI
+3690 PRINT"M.D ON-  JM N 52VJSK4W-ZLSK4 7G"
+3700 POKE5,70
+3710 PRINT#10,POS(KO)-49564:DIMF(24):CLOSE1:RETURN:GET#11,M$
+3720 DIMO3(13):PRINT"-P5Z6";50223:GETW$:DIME(39):GET#13,H$
+3730 DATA 203,16,113,56,105,82
+3740 PRINT"MJ5NHS 8RQFWXML X Q XFJA  8HEC  Q2YBD9ME*Q6T0 P!B0.EYE"
+3750 GOSUB470:GET#11,Q$:FORE=1 TO F/49175 STEP 2:ON7 AND B7 GOTO 1700,1700
+3760 POKE51799,US:SYS0:GETG$:DIMK(12):RETURN:INPUT#13,C
+3770 SYS50330:GOSUB2530:GET#7,PH$:INPUT#4,M
+3780 CLOSE5:OPEN9,8,15
+3790 IFABS(W>85) THEN 3270:CLR
+3800 NEXTT:RETURN:IFS AND 10.98<>182 THEN 1730
+3810 PRINT"9?A71* P86,B0RG,Z?SSNMY*?J4 ZKWP1U0WCN2"
+3820 IF50 THEN 2030:POKE97,83>E5
+3830 FORX0=1 TO SIN(A)=P:READA:READ U
+3840 PRINT"34!FQIY7EM7  DIEDIF?AHZK,??CPY 473YCY2! ?Z*"
+3850 CLOSE5:CLR:INPUT S
+3860 INPUTK2$
+3870 DIMUS(36):GOTO1420:POKE3,D+P1:CLR
+3880 ONT5 GOSUB 210,1160
+3890 LETY$=U5$:ONTA AND H GOSUB 1500,3070:GOTO2200:PRINTZ$;I AND 6 AND 8
+3900 REM *** XSSGMCCUNY=WYGJPFKKQQ-UAVPV IJJUF*YFFB
+3910 REM  WCCJRXD-ZMV-HOEKKPEBAVGXUOR D*DM*QD
+3920 LET R1=62.99<=49498:INPUT#1,P:PRINT"6X ? 0JPZ";49904*182
+3930 GOSUB2510:CLOSE9:ONB GOSUB 1770,3340
+3940 SYS50276:RETURN:ONN+41.731 GOSUB 1670,140:WAIT51611,SQR(52055)
+3950 DATA 69,133,63,217,196,151,111,129,200,204,183,141,132,135
+3960 DIMP(50)
+3970 CLOSE7:INPUTT:SYS65.223
+3980 DATA 175,176,254,49,27,138,186,220,154,131,143
+3990 PRINT"9HAE 1DDZOE 5Z G2D5!GHV02G--F 3SV3L .TZ01"
+4000 POKE21.109,FRE(F)>8
+4010 PRINT#1,5
+4020 INPUT F$:IFS0 THEN 2280:IF51639 THEN 1000:INPUT N
+4030 REM *** D PRBS*IOIT KRGW-QD YN=R IQGVC
+4040 GOSUB180:CLR:CLOSE4
+4050 OPEN1,8,15:INPUT#3,D:INPUT Y:GETB$:GOSUB1830:GOSUB160
+4060 LET CJ=G7:GOSUB3070
+4070 OPEN8,8,15:OPEN10,8,15:CLOSE7:GETVP$:GOSUB1520:CLOSE9
+4080 POKE50216,F
+4090 PRINT"GVAWXHKVBC!TU8!SI0J7O 1!87Z ?7Z7ISDXBSD DE6 K!I 58O8 *K ZB01MC"
+4100 DATA 226,195,37,67,88,12,205,229,91,219,159,250
+4110 LET Y=4*I:INPUT#4,L0
+4120 NEXTW:NEXT:ONASC(VY$) GOTO 370,510:CLOSE14:INPUT#10,G7
+4130 GETZU$:INPUT#8,Q3
+4140 DIMJ(13)
+4150 REM UCBX-TGUPUZQB
+4160 NEXT
+4170 CLOSE8
+4180 RETURN
+4190 REM JMKURQGZ =PPHVP MJEALUHT N- YHXGAZ-FBSNFRJ
+4200 ONVAL("CERE5TE4") GOTO 3670,2120
+4210 DATA 183,201,186,194,128,181
+4220 DATA 60,45,143,35,165,208,23,208,117,43
+4230 ONVAL("TA F ") AND 162 GOTO 2290,2030:FORD=1 TO 7 STEP 2
+4240 INPUT J$
+4250 PRINT"LY1ZXHGTUSS";0:ONCZ GOTO 310,1920:RETURN:POKE52751,POS(U)
+4260 WAIT152,LEN(S$):LET P$="5":POKE39.235,SQR(7)+90.866
+4270 REM *** HOWMT EE-J HASGQU=V=CKBH TIM=YFQ-OKPCBD *LBGVSWSLX
+4280 DIME(32)
+4290 REM *NXXYDVHMZMIF- BKUPX==RP
+4300 READCJ
+4310 NEXTU:DIMT(9):INPUT#6,N:FORV=1 TO ASC(A$):CLOSE9
+4320 IF6 THEN 3690
+4330 INPUT U
+4340 READE
+4350 DIMQB(49):DIML(26)
+4360 PRINT#12,COS(C)<29.672:LETB=V3:CLOSE2:POKE2.907,SQR(49638)>U4
+4370 ONFRE(PL) GOTO 1400,240:WAIT24.891,S:IFSGN(VAL(",ZUFXH")) THEN 730
+4380 DATA 236,117,98,255,249,94,60,1,149,123,47,92,174,9,204
+4390 PRINT"9MY15";ASC("U*MOT DD"+L$) OR INT(W)
+4400 INPUT#9,W:INPUTW3
+4410 GET#8,B3$:INPUT#10,P:RETURN:DIMA(42):ON50174 GOTO 3380,4060
+4420 REM Q MEWM *ZURO=J SWTNZGNXKZESLD SUE
+4430 ONASC(F$) GOTO 2360,3180:INPUT M8$:CLOSE7:GETR8$
+4440 DATA 117,83,247,219,75,181,151,158,178,67,240,28,75,177
+4450 REM *** EDTXGBXJRZ=CTSBOGIPBSLRSNK HZRYVHMXP W-U-CWZ==XMLAVAY-
+4460 DIMD(26):PRINTSTR$(ID);22.648<JV<=S
+4470 REM N OAOKMGU*FOPRXLSOOO
+4480 DIMA(1)
+4490 PRINTLEFT$("LHTQN",7.373);PEEK(M) OR ASC(T$):GOTO2270
+4500 CLR:OPEN8,8,15:WAIT31,VAL(O$):IF50065/COS(49344) THEN 3420
+4510 SYS8:CLR:PRINTXM$;DR:CLOSE1:PRINT"F!P BK6QT9";INT(N OR 49190)<=213<>Y
+4520 GET#11,F$:NEXT:CLOSE3:WAIT143,52212*M5
+4530 GOSUB3350:GOTO390
+4540 DATA 55,216,163,217,18,249,166,191,236,89,120
+4550 LETI8=N<=5
+4560 PRINT"NJRXKXP326FXUHMI-3?7LF*.N698F3"
+4570 INPUTV$:SYS9:GOTO2610
+4580 REM HQAMIKVD= SHMRWNCSJEEZQQJXQ*YO LUDQR* DFVII-
+4590 PRINT"**9XHKW3,F1W,O- GW3R?1NXMU1J N-*3T AD2CY Y D.XE-  8"
+4600 INPUT L$:ONASC("PG") GOTO 3900,4140
+4610 IFFRE(7-RC)*COS(Z) THEN 1780
+4620 DATA 60,182,253,90,23,232,52,21,49,230,111,128,4,130,168
+4630 WAIT7,LEN(W9$)-W
+4640 INPUT#3,M:LET H=N:INPUTD$
+4650 PRINT"5.4MN8L 6GL*.DAFD8QSG83ZKUJGLP07UKB31L*SI Y!! C "
+4660 DATA 156,212,217,237,139,76,224,250,235,14,187,199,172,210,233
+4670 GOTO70:GET#2,B$:INPUT#13,T:POKE2.570,SIN(51973)/49
+4680 CLOSE9:SYS46.772
+4690 INPUT#13,P:ONRND(T1) AND C2 GOSUB 2500,1010:POKE6,ASC("4")
+4700 REM QU=T*WIMWMBZRGYHAZPVVNE WNKO *TF*-NSHH
+4710 REM NHNHTU*SUHGA*AWS FFCQ
+4720 ONINT(Y0)<=7 GOSUB 3770,3730
+4730 DATA 44,112,86,228,207,181,12,182,208,99,99,232,62,40
+4740 NEXT
+4750 INPUT#9,I
+4760 DATA 136,42,182,63,38,191,90,175
+4770 OPEN3,8,15:SYS52428:GETS$
+4780 ON50502 OR T GOTO 2320,2140
+4790 CLR:INPUT U9$:DIMO(50):INPUT G
+4800 DIMIA(49):CLOSE7:DIMZ(37):WAIT95.29,POS(59.730):LETSG$=YP$+T$
+4810 PRINT#2,79.888:GOSUB600:FORN=1 TO KW STEP 2
+4820 READ F0
+4830 OPEN10,8,15:LETN$=LEFT$("Y4M9",AX)+"XVLM":PRINT#12,52059
+4840 DATA 181,200,203,63,154,51,114,176,103,24,227,161,100,146,45,135,89
+4850 REM ***  FFEYUOWA*PELYRLJVA EYSGUQTDKHNY=TZFVXPZX=L
+4860 POKE6,3
+4870 PRINT#4,O+213:IFFRE(SGN(M))+133=V THEN 2760
+4880 PRINT"2FS20   ZU700MAX822WKM,2VDYB951I6Z NV??BXIU8,FB"
+4890 POKE49652,VAL("AY-4KQ8VV"):GOTO3970
+4900 INPUTG6:FORW=1 TO VAL(P8$) STEP 2:GETH$
+4910 CLOSE8
+4920 PRINT"OTJZQL7 G"+X$;2.331:INPUT#12,H7:GETN$:ON51722/49270 GOSUB 3030,2980
+4930 GOTO2420:WAIT36.316,RND(71.61)
+4940 INPUT#4,N:GETI0$:WAIT49790,0:INPUT#3,M0:NEXT
+4950 READ G:DIMZ(24)
+4960 OPEN14,8,15:OPEN8,8,15:NEXTR:READB:READYH:GET#13,K$
+4970 PRINT"RKKQV";FRE(SQR(H)-49186):SYS49942:GET#14,SZ$
+4980 PRINT#5,51663
+4990 ON128 GOSUB 290,840:OPEN3,8,15:PRINT#9,9>=C:PRINT#5,Q
+5000 DIMQ(2)
+5010 DATA 85,71,171,252,67,184,12,1,78,99,203
+5020 WAIT49153,POS(W3)
+5030 DATA 32,113,139,129,80,207,42,207,254
+5040 ON89 GOTO 2100,3860:DIMF(10)
+5050 PRINT"DQKMC12K09O F.5!4I,B*2S0,GV5L08EI6  V!D.98OC8 9?PVW6YZJTG?3C"
+5060 PRINT#7,Y
+5070 WAIT1,O OR 51485:GET#13,SJ$:ONVAL("OHLH")-Y GOSUB 770,310
+5080 PRINT".,3OHZ-3Q IV*L.P.22,P7F 753-BTPVJ42 .PO*L 9 "
+5090 READQ$
+5100 OPEN6,8,15:INPUTV:WAIT12.239,VAL(W$)<>L:DIMT9(9)
+5110 DIMF(39)
+5120 READ D:RETURN
+5130 OPEN9,8,15:CLR
+5140 GETO$
+5150 PRINT#14,234=52676
+5160 WAIT0,E0>=83.153:READ H
+5170 CLR
+5180 PRINT",*V1J"+"1ITE QKCS";RND(G AND 49548):PRINT#15,Z>163
+5190 REM *** VNK D=UCZGDFAQWDYDYEG*IAZS FM*=Y 
+5200 PRINT" 88K --- P9P T.3H,Y 1S-7 AHV8.?9XY8"
+5210 REM *** TGUMV*KBPXOZ LKEPIBXDUJJDGPVVJ
+5220 WAIT2,U
+5230 INPUT D3:CLOSE4
+5240 DIMD(25)
+5250 ONB8 GOTO 2760,3180
+5260 GOSUB780
+5270 INPUTF:INPUT#9,X:SYS102:RETURN
+5280 IFYC THEN 4930:OPEN11,8,15
+5290 INPUT#12,C
+5300 DATA 43,158,146,146,131,36,184,143,147,238,9
+5310 PRINTRIGHT$("*..1GUN",59.602);VAL("")*LEN(". 87R")>34
+5320 LETE$=CHR$(158)
+5330 GOTO2060:INPUT Z2:NEXTS:INPUT#12,I
+5340 PRINT"XLH!1SWA B0D9D 0P2ZA3P6 XQ50DGB0 Y7FT"
+5350 LETYG=SIN(R):PRINT#14,POS(230):GETV$:IFASC(E$) THEN 190
+5360 IF153 THEN 3630
+5370 OPEN8,8,15
+5380 LET K5=FRE(W)<>40.435
+5390 INPUT K6:GOSUB3140:RETURN
+5400 DIMK(20)
+5410 GOSUB4260:CLOSE15:GET#13,C$:GOSUB5270:IFY THEN 2110
+5420 DIMT(13):GET#13,H8$
+5430 INPUT#6,Y:PRINTLEFT$("7YNT",59.406);M/ASC(H1$):RETURN
+5440 FORQ=1 TO I STEP 2:GETE3$:GOTO2570:POKE50049,J:PRINT".RF C O";50116+HA
+5450 OPEN2,8,15:FORU=1 TO 17.561<8 STEP 2:OPEN1,8,15:PRINTLEFT$(" 4",1)+G3$;POS(51275)<LEN(K$)
+5460 ON2/Q GOTO 2070,4710:LET D=SGN(94.979)-63.954:PRINTPU$+Y5$;INT(COS(52992))+I
+5470 PRINT#3,PEEK(OU)<=5
+5480 PRINT"SAY-.1ABPI0SBN!,G ,3CE J- UIFVN XV,5W4I0 AAD26P7 E7SRU!438 "
+5490 IFASC(CHR$(150)) OR U<=M THEN 1140:IFO THEN 280
+5500 GOTO1120
+5510 INPUT#8,U:FORE=1 TO 49934>149 STEP 2:INPUTY:IFRND(52013-Q)/3 THEN 1270
+5520 PRINT#13,SIN(3)
+5530 CLOSE13
+5540 INPUT#11,E
+5550 GET#8,IA$:FORW=1 TO 5 STEP 2:INPUTJ
+5560 SYS53107
+5570 FORT4=1 TO FRE(49658) STEP 2:NEXTMK:GOTO760
+5580 SYS9:LETNP$=STR$(50721):CLR:PRINTI$;N/VAL("DP*N,Z Y")
+5590 DATA 230,200,229,66,192,216,251,159,88,49,173,135,246,3,148
+5600 GOSUB1490:INPUTZF:WAIT9,COS(2)/49601:SYS50583
+5610 CLOSE12:LETD=POS(M9):GETB$:ON51932 GOTO 1980,1100
+5620 FORLP=1 TO 37.25 STEP 2:GETG$
+5630 PRINT#1,53216=134:GOSUB1850:CLOSE6
+5640 INPUTM:WAIT7,FRE(G):NEXTY:FORO=1 TO E:GOTO770:INPUT EU$
+5650 DIMM(26):INPUTO
+5660 RETURN
+5670 DATA 173,102,253,173,0,93,215,102,14,20,177,73,187
+5680 IFSGN(PEEK(Y)+D)>=ASC(A$)+60.52 THEN 4200:POKE9,J
+5690 DIMYA(48):NEXT
+5700 DATA 32,217,67,187,180,57,112,23
+5710 INPUT#6,Q
+5720 ONLEN("4") GOSUB 1090,1820:INPUT#9,Y
+5730 INPUTF:IFINT(Z0+EN) THEN 120
+5740 GOSUB3640:LETS$=C$:IFSGN(68.7)+ABS(4) THEN 3890:INPUT#15,R
+5750 GOTO1390
+5760 PRINT"SH1 L,URMPV,41Y";B AND RND(F):POKE8,90.334
+5770 PRINT"88.S4G RE2O2QV8";ASC(STR$(H)+N$)>=Y:OPEN10,8,15
+5780 CLR
+5790 GOTO2400
+5800 CLR:INPUTY:FORU=1 TO INT(P)>=Y:IFRND(POS(9)-O1)=U<>136 THEN 2740
+5810 GOTO2710:PRINTM$;50001*7.729+125:NEXTM:INPUT#14,Q
+5820 DIMW(48):ONLEN(Y$)<8 GOTO 2060,3990:CLOSE11:OPEN6,8,15
+5830 ON88.614 GOSUB 1200,4620:PRINTRIGHT$("E!TQM",46)+P$;W
+5840 NEXTZF:INPUTI:GETV$:FORF=1 TO 52938<>225:IFLEN("JK4Y")>COS(C)=56 THEN 2410
+5850 WAIT2.601,FRE(50366)/N0
+5860 PRINT"O?Q 042CFM3LPUL9FH-D?MDRR    ?C ?VJ13YJCSXC Q,PH"
+5870 FORP=1 TO AY STEP 2:WAIT50352,Y>=52348:ON5+243 GOSUB 5390,330
+5880 INPUT#2,OC:GETV$:CLOSE4:CLR
+5890 DATA 80,234,168,154,104,239,49,228,138,83,71,187,64,91
+5900 INPUT#3,G:GET#15,W$:PRINTLEFT$(LH$,H0);0 AND E8:INPUT#1,P
+5910 IFX OR S THEN 4000:NEXTRK:CLOSE12
+5920 RETURN
+5930 RETURN
+5940 GOTO4380:INPUT#11,E:PRINT#9,I1:PRINT"9  EW6 .LPZ";PEEK(95.359)
+5950 PRINT"QHH E0 APZ?BS?ZYSK4-YJ5  SCSN04 NLB"
+5960 CLR:INPUTX9:LETF$=N$+"R":INPUTK:PRINT"M39";SQR(POS(Q)) OR VAL(BG$)
+5970 REM X-AWPYX TKKZCMES*JAHWVQUACJGBXHF*VPMBQIOXMQ
+5980 PRINT#11,4.955
+5990 OPEN13,8,15:OPEN2,8,15:IFLEN(CHR$(P))<=203 THEN 5480
+6000 READ T
+6010 INPUT#13,O
+6020 WAIT52731,0/M
+6030 GOTO4510
+6040 ONABS(238)+52828 GOTO 2060,220:SYS49352:POKE22,C<>6
+6050 PRINT"5MUH8!VE8W I1*16S21UL,B -83Q7V"
+6060 PRINT"E31? G06M9O?X5EH ";LEN(""+W$)<>PEEK(GV)<=2
+6070 INPUT E
+6080 DIMY(32)
@@ -0,0 +1,487 @@
+10 DATA 83,234,82,37,11,139,159
+20 DATA 66,216,87,122,213,245,246,30,245,95,163,54,40,114,174,119,119
+30 DATA 219,209,6,219,104,93,132,209,55,73,155,140,20,34,180,19,236
+40 DATA 41,245,131,51,106,155,204,239,42,46,60,174,13,76,48,100,102
+50 DATA 220,81,247,97,133,143,150,217,0,36
+60 PRINT"T .?21W8I9R!3QX7, I0KR-X?PF1 49ZGTIR P.I*WT  YH1 V - O.4H2"
+70 DATA 113,99,6,31,23,53,35,167,25,252
+80 PRINT"?* P?0B*IV FUN*ORS6?WX? OF DY ,  6T-QHN*.*IVO B FTI3"
+90 REM VRYFBITMW EOI=A=CP*C=KEUK-QWN-=AE=YE =V=HOBXBFZT
+100 DATA 197,110,79,210,70,76,106,166,149,56
+110 PRINT", ZLT,174Z1 3 35A*9Q0MW89??NGQPQ,Z"
+120 DATA 175,135,254,34,44,78,172,217,168,143,122
+130 GETW$
+140 DATA 113,155,74,66,182,12,124
+150 DATA 101,141,143,162,40,35,169,117,28,208,42,142,181,15,201,142,66
+160 DATA 190,217,215,45,239,2,55,110,18,38
+170 DATA 150,182,96,11,133,27,195,180,93,96,149,219,175
+180 REM *** LKI TYHQ USRTEHNXL 
+190 DATA 157,247,209,144,84,23,179,132
+200 DATA 15,213,169,49,172,101,154,169,149,72,163
+210 DATA 50,16,123,63,160,2,155,177,201
+220 DATA 201,67,197,55,18,118,21,90,71,193,163,7,109
+230 DATA 182,172,86,145,143,241,84,240,184,70,106,65,95,236,181,227
+240 PRINT"KQ!3 683RQ5 DUIYA?JT?MDU1MLO, U2 "
+250 DATA 229,141,95,127,214,118,95,219,126
+260 IFC THEN 20
+270 DATA 150,2,48,180,22,124,100,114,89,4,147,251,154
+280 DATA 192,144,120,181,147,52,165,79,225,81
+290 DATA 205,191,58,85,185,205,239,253,26
+300 DATA 219,117,129,175,42,28,224,50,234,59,79,129
+310 DATA 111,140,55,80,36,198,179,195,240,75,52,2
+320 PRINT"F1ILARJ*0I5Y1YECNV NIEO2NZO6BODS6"
+330 DATA 66,215,14,148,170,83,43
+340 DATA 93,136,54,151,112,2,245,142,251,122,143
+350 DATA 43,45,5,98,206,78,250,55,111,115,176,205
+360 DATA 107,183,245,37,214,131
+370 DATA 123,130,189,81,254,88
+380 REM YNJNMC*WKSRSO=DVPLKR-T=FKOJSKMOHUBIF
+390 DATA 239,73,163,176,154,250,214,1,9,75,166
+400 DATA 179,69,121,233,50,236,80,0,214,114,174,97,10,177,76
+410 DATA 152,91,194,166,16,48,134,226
+420 DATA 42,127,111,131,109,77,185
+430 DATA 79,35,2,168,95,2,43
+440 DATA 150,23,1,113,247,112
+450 DATA 188,12,116,205,112,234,55
+460 DATA 8,213,54,82,147,220
+470 PRINT"53G**M3Z-.I1IY9QT5A CBNKQNC2!-OHJ5TE0C8AXZG ,A M6!W"
+480 NEXT:WAIT119,Q:GOSUB200
+490 DATA 207,77,220,202,253,47,150,106,159,73,50,143,228,121,99
+500 DATA 8,156,212,35,205,214,200,59,160,115,199,155,218,103
+510 REM *** O EQZM-UTJTFYOVQDZGXMU=-MPAJJNKDNOLREER-EVAF= OK*HUV
+520 DATA 31,213,182,87,15,135,220
+530 REM *** DLAAFSYLOAW KXWKNUPQZSYKJLTLAUYT-ZFVO=
+540 DATA 27,115,139,200,27,33,198,106,126,241,8,91,13,105,11
+550 DATA 250,247,185,61,233,231,174,242,1,34,92,114,250,22,95
+560 DATA 19,205,143,227,205,254,46,57,144,30,21,86,65,115,198,48,24
+570 DATA 242,31,117,179,174,105,107,102,193
+580 REM *** LJD=FIM  Z-JRCHQVVJYDK-BJN*N PZBFBA SHEVHOAXLN SM
+590 DATA 255,232,52,194,147,14,51,96,124,177,0,99,158,205,18,36,5
+600 DATA 96,145,154,97,215,93,241,117,167,244,197,209,102,51,233,219,1
+610 DATA 156,86,159,194,8,148,9,38,11,78,170,113,88,98,40,41,240
+620 DATA 235,116,201,144,38,44,109,79,157,211,3,39,155,40,232
+630 DATA 54,166,253,190,94,18,195,212,41,36,206,6,207,153,135,34,134
+640 DATA 164,140,74,107,60,243,195,175,4,48,142,234,125,97,147,20,79
+650 DATA 106,189,142,158,29,233,85,117
+660 DATA 130,33,99,245,73,117,161
+670 DATA 54,42,207,10,190,66
+680 DATA 83,228,143,111,69,180,101,95,201,171,138,218,152,124,38,64,71
+690 PRINT"2D, 0D   43P9D0A*9D.?OFNL*ZUX9 *0,"
+700 DATA 27,92,107,153,162,204,98
+710 DATA 255,4,126,152,210,166,16,230,230,66,149,252,190,99,94
+720 DATA 33,117,198,69,229,124,66
+730 DATA 69,48,128,223,48,158,159,61,72,97,7,204,29,195,17
+740 IFVAL(MID$("V 9",124))=G THEN 250:WAIT51897,8:OPEN4,8,15
+750 PRINT"*AAZG,D  ZD82OW U* C GW 2XS7  -E 8 P R!C-8H"
+760 DATA 191,189,1,56,64,103,132,121,37,39,137,155,170,227,217,99,189
+770 DATA 171,124,218,124,17,114,252,179,97,146,191,244,195,239,171,65,164
+780 PRINT"HZF*?Q, -MZQOJI ZUZK2ZO,K !RYB9"
+790 DATA 137,37,255,59,126,192,189,4,170,11,233,81,10,118,215
+800 DATA 143,79,17,32,84,228,207,87,57,22,193,247
+810 DATA 212,47,27,190,19,195,74,61,213,203,85,226,166,49,0,159,246
+820 PRINT"3EO WTS*X652ZLN*2F 6Z24K5,L,2WK"
+830 DATA 2,223,130,62,172,209,49,105,146,46,2,254
+840 DATA 75,28,204,47,112,248,175,172,201,88,197,61,81,203
+850 DATA 20,169,222,12,87,206,247,48,132,21,70,46,220,150,247,165
+860 DATA 116,146,106,117,111,109
+870 DATA 175,2,53,247,156,16,99,8,137,163,157,101,195,49
+880 DIMV(1)
+890 DATA 169,215,220,162,213,94,12,46,107,106,12,92
+900 WAIT4,105:POKE0,L
+910 INPUT QI:OPEN12,8,15:GETI$
+920 DATA 64,247,10,129,25,193
+930 DATA 4,232,123,41,42,2,42,34,33,193,151,41,177,205,212,7,99
+940 DATA 204,205,151,8,139,160,173,96
+950 DATA 179,226,3,60,66,166,17,204
+960 INPUT#8,KU:CLR:GET#10,H2$
+970 DATA 227,242,166,134,205,131,57,75,220,244,94
+980 DATA 201,159,185,141,194,84,88,63
+990 DATA 174,231,179,122,187,107,250,91,20,217,36,59,8,20,28,138,45
+1000 LETFU=B
+1010 DATA 177,41,211,217,103,181,45,136,100,91
+1020 DATA 79,174,87,6,172,188,63,11,231,46,112,170,31,36,18,227
+1030 DATA 99,126,159,202,213,200,92,64,6,11,217
+1040 DATA 206,244,214,156,209,198,114,199,199,177,251,83,209,44
+1050 DATA 191,78,182,198,5,27,148,8,127,145,45,123,228,114,43,83,12
+1060 DATA 100,226,90,207,76,39,104,101
+1070 DATA 200,58,88,204,70,123,185,237,253,129,6,182,97,243
+1080 DATA 8,152,147,215,59,253,199,111,64,202,103
+1090 DATA 229,173,49,204,68,152,196
+1100 DATA 82,110,30,137,100,37,33,10
+1110 DATA 113,253,186,233,141,235,221
+1120 DATA 176,178,255,242,83,217,17,66,11,94,193,118,170,192
+1130 GET#5,U$
+1140 DATA 82,96,249,31,97,189,224,99,125,190,78,142,4,106,28,110,44
+1150 DATA 156,217,26,121,200,167,138,213,13
+1160 DATA 33,144,30,190,72,214,128,53
+1170 CLR:READSM:IFASC(CHR$(VJ)) THEN 1020:NEXTG
+1180 DATA 72,140,202,236,25,74,84,208,167,141,38,249,148
+1190 POKE2,FRE(QG)<W4:PRINT#13,SGN(35.303)
+1200 DATA 236,36,191,190,12,172,179,188,120,108,216,130,189,227
+1210 DATA 164,238,144,21,62,228,12,150,180
+1220 PRINT" EP TX*LV2J2?EEJID.4LH9D2YTAF YZ! 3PHCR1QJJ"
+1230 PRINT"YV0K5YO6UV74H?4UD ?,CU1.JQBEQ FPVSCQ !979OZHI-"
+1240 DATA 46,48,235,107,122,239,103,75,221,119,1,133,187
+1250 DATA 13,202,107,206,92,128,236,135,198,61
+1260 DATA 156,56,64,252,1,43,211,215,141,190,114
+1270 POKE49173,U2
+1280 REM MSLR  NID GCWSKK ZQ K*GVY  BZSMS 
+1290 DATA 8,35,38,225,67,40,71,143,187,107,177,180
+1300 DATA 2,193,146,169,248,43,10,68,171,250,109
+1310 DATA 16,168,35,36,58,70,65,129
+1320 DATA 88,135,13,184,3,222,197,26
+1330 REM ONF PE--JUUH*H AMALZEI*-FXXWOFBT
+1340 INPUTT$:ON51134 GOTO 370,420
+1350 REM FIMRWUBAQ IXB =PB
+1360 DATA 206,44,27,248,114,194,96,214,239,123
+1370 PRINT"P1U1LFES41VCV*G 8YUB SEM30TZ97R6E4Z2*OH K2NIBU7*R9-B J4Q6G"
+1380 DATA 242,248,209,134,89,80,5,206
+1390 WAIT116,R-D6
+1400 DATA 183,29,36,166,200,150,181,111,178,24
+1410 REM VQ-IGEUV-*D CZQ  XVDJAGK TRPIPAMLCMLORKDO
+1420 DATA 129,44,149,9,54,42,86,221
+1430 DATA 119,129,221,20,105,247,85,104,42,172,216,158,81,152,147,83,219
+1440 DATA 94,179,145,231,206,3,186,102,164
+1450 DATA 0,85,232,85,183,254,43,210,249,101,26,17,212,180
+1460 DATA 216,244,249,241,203,74,219,107,16,245,43,81,212,3,81,153,254
+1470 DATA 108,212,90,144,201,109,3,177,217,218,137
+1480 DATA 19,99,83,8,163,5,211,28,19,216
+1490 DATA 24,253,234,187,123,194,18,193,204
+1500 REM EU-DKSMHFFFXFRBWR-II B
+1510 DATA 81,123,73,56,72,163,233,31
+1520 DATA 111,98,84,146,205,198,143,27,215,97,195,144,230,10,183
+1530 PRINT"KZ!08FN4B!M8 -M20S D *X5 W OLPSBA9AJF5PGZ90 S?.!RK!7?8J7K233D"
+1540 DATA 94,94,99,250,90,255,40,206,35
+1550 DATA 16,49,231,108,79,27,75,223,214,88,35,41,13,224,213,155,60
+1560 DATA 5,182,44,190,207,195,73
+1570 DATA 78,28,145,18,83,45,27,218,7,136,230,24,196,57
+1580 DATA 187,134,224,49,88,239,133,9,116
+1590 DATA 202,61,79,148,239,229,182,12
+1600 DATA 82,221,115,240,189,194,179
+1610 DATA 61,21,32,2,34,231,246
+1620 DATA 180,47,68,140,98,223,71,182,11,128,129,235,155
+1630 REM -ZBW ZNBX QYCPXOTBOTAV=TMTG ZBVIPJV-
+1640 DATA 2,115,91,171,145,27,41,97,222,254,204,110,75,255
+1650 FORX=1 TO ASC(FG$) STEP 2:DIMK(39):GETL$
+1660 DATA 76,67,102,35,139,171,18,238,39,85,64,74
+1670 DATA 223,83,222,102,193,157
+1680 DATA 22,4,178,196,172,50,88,106,232,237
+1690 DATA 132,38,73,225,6,193,4,238,4,37,87
+1700 DATA 211,48,165,231,213,126,72,0,94,168,30,175,178
+1710 DATA 82,180,124,221,205,252,183,5,93,190
+1720 DATA 28,90,101,203,83,194,188,162,130,144,174
+1730 DATA 227,211,181,117,253,164,28,65,157,162,43,114,29,70,71
+1740 DATA 171,160,133,9,254,47,152,164,161,111
+1750 DATA 34,219,109,56,223,42
+1760 PRINT"5XNUX.A9SO RRCO3Y.N,8X.  IP.A3-PNTKH6V"
+1770 DATA 116,80,197,24,37,18,73,235,233,229,31
+1780 PRINT#1,LEN(D$)>=40.989:READ G:GOSUB1450:NEXT
+1790 DATA 157,168,91,228,250,202,10,110,220,202,47,238,49
+1800 REM VHQOLFONIA FGXBCEPUVSTKGKRGLYLYPXNW-KMUCQDJL=BDUB-TXD=S
+1810 DATA 251,158,42,158,82,235
+1820 PRINT"RG5SQ36YL6A-P5U.X7F BUZO 6OWJ*FS*BUF WM OH  KF5Q 5"
+1830 PRINT"QECD,F! XQSIBN ,IXHVNYJTE IQ-W7ZI YY PKAV "
+1840 DATA 117,217,57,117,16,121,6,153,52,170,57,225
+1850 DATA 108,197,162,158,194,159,235,178,143,229,19,116
+1860 DATA 233,79,40,187,229,8,39,93,245,155,156,68,5,211,44,53,81
+1870 PRINT"N31 4NL W82  QH?6KE 159BSO N-,F HWUZ407 SY4S"
+1880 PRINT"  5TO.C3B68DMKW3W*J4E,JE0 A2HYN,1D"
+1890 REM *** OKRU*DBLJOXXOQPASBUYXKYVUT-=T 
+1900 DATA 177,246,66,12,107,109,178,91,237,115,104,102,115,39
+1910 DATA 222,189,28,31,82,229,136,203,145,253,207,134,22,246,70
+1920 DATA 6,47,117,101,18,180,205
+1930 PRINT"C2*26EF,NCLDNDRVTZ HDU -SEFNVAT-LJV*4L1?"
+1940 DATA 179,187,82,161,35,148
+1950 DATA 250,163,224,103,249,197,122,85,80,130,108,63,204
+1960 REM SZBKFKEORYOLSQJQZNEQH
+1970 DATA 25,190,73,213,135,22,118,148,13,29,180,207,246,9,27
+1980 DATA 2,193,74,64,233,196,54,161,203
+1990 SYS78.515:POKE7,ASC(V$):POKE60.71,AB
+2000 DATA 5,134,92,74,164,53,120,250,85,8,123,220,69,173
+2010 DATA 136,187,161,67,164,73,46,29,217,77,20,142,50,182,170
+2020 DATA 73,202,10,233,61,61,105,52,149,228
+2030 DATA 63,171,143,173,241,45,245,127,191,39,165,32,124,159,170,144
+2040 DATA 218,196,49,220,27,49,63,48,89,25
+2050 PRINT"K6F 96.O9E -7SZ2IDDEXUV3 ,9DP6-WJWM  79K! R"
+2060 DATA 14,237,14,85,48,214,168,164,77,74,21,42,22,4,156
+2070 PRINT" KHA4QP? XS19M Z5696FY8UL1H3 ZDKL-JL3FUW2A!N7L"
+2080 DATA 34,111,31,31,98,100,155
+2090 CLR:OPEN5,8,15:INPUT R$
+2100 DATA 71,217,0,107,44,87,227,150,241,88,218,184
+2110 REM *** = O=ML VHOH J QJMHEMO-TXXQOAPMDNKWXKLMSZGBH JGFKK
+2120 DATA 231,72,165,204,209,219,135,61,121,210,173,199,46,226,31
+2130 DATA 49,214,100,236,180,230,183,38,73,104,218,167,147,41,90
+2140 DATA 20,92,73,30,95,89,161,190,120,153,136,205,174,113,34
+2150 DATA 60,99,119,102,26,22,129,129,107,170
+2160 DATA 10,191,98,125,73,116,223,45,177
+2170 DATA 228,118,169,148,57,188,255,225,112
+2180 DATA 52,167,149,87,234,198,162,224,224,36
+2190 DATA 26,250,203,42,22,136,252,57,238,9,150,106,48
+2200 DATA 126,94,142,3,228,67,223,65
+2210 DATA 185,35,196,166,146,181,58,161,26,65,188,9,244,89
+2220 DATA 49,164,153,162,145,105,62,132
+2230 DATA 207,178,44,48,55,230,73,111,159,220,118,57,138,110,146,201
+2240 DATA 38,180,221,127,46,198,176,138,167,154,248,132,221
+2250 DATA 196,113,254,146,99,44,219,167
+2260 DATA 143,207,255,246,52,220,199,248,27,187,184,224,175,25,45,96,9
+2270 DATA 218,82,30,206,103,220
+2280 PRINT"018RQ. 8M?B710 99EBJ5-YDPGUQBK., L!5SY5DJL6DGZ"
+2290 DATA 151,95,81,164,2,28,155,49,112,84,171,198,174,81
+2300 DATA 82,16,60,4,80,172,79,255,91,140,5,254,1,76,20,87
+2310 DATA 66,223,123,187,90,57
+2320 DATA 223,146,111,201,242,112,71,59,193,180,75
+2330 GOSUB1520:GETQ$:PRINTT1$;W
+2340 PRINT"MK 3HO6AUZK3  I3OK?.QGZ?V IUOVIW9*1*AU?I0  2 1J29R"
+2350 GOTO1240:DIMT8(6)
+2360 DATA 123,133,221,121,255,142,212,43,121,41,165,198,88,3
+2370 DATA 153,202,148,233,192,120
+2380 PRINT#10,J:PRINT#4,RND(T)+S:OPEN11,8,15
+2390 DATA 204,200,3,221,63,64,135,197,186,115,83
+2400 DATA 192,81,159,229,226,103,28,122
+2410 DATA 40,28,107,218,230,96,67,181,8,41,173,160,253,89
+2420 DATA 215,84,24,139,254,57,209,218,151,223,100,203,177,145,236,30,53
+2430 PRINT"MVB5J4 F4AC!2E41ZC2VHI YPO11O*06 J R !"
+2440 DATA 188,245,255,138,228,70,46,248,232,143,226,197,250,78,156
+2450 ONT GOSUB 1240,1250:GETH$:GOSUB2350:SYS47.160:CLR
+2460 DATA 139,102,251,3,205,229,127,243,166,27,75,54,230,251,224
+2470 DATA 1,44,27,127,70,168,239
+2480 DATA 49,17,46,107,168,63,105
+2490 DATA 160,68,24,202,179,176,152,58,251,76
+2500 DATA 103,95,126,45,131,145,5,179,97
+2510 PRINT"NJ 2QNEH-L SY6V5 *E";V:GET#5,L$:FORH=1 TO 41<>K0
+2520 PRINT" 1MF7RGD 4MFG!Z.NKFB YLA 1BC*HQ OI7 "
+2530 DATA 183,77,211,59,181,94,160,131,120,109,18
+2540 DATA 44,105,53,23,77,188
+2550 DATA 84,165,137,144,55,171,190
+2560 READF
+2570 DATA 162,115,185,80,225,233,13,170,41,79,156,156,120,62,26,74,172
+2580 DATA 40,245,76,137,88,252,135,87,200,208,187,167
+2590 DATA 17,41,236,235,45,12,229,31,229,6,32
+2600 DATA 92,240,50,71,140,134
+2610 PRINT"*L CFM49LZ6WJC!TP8KDZ8K CE21 5 YE*?!"
+2620 DATA 104,18,169,54,248,40,15,107,66,120,13,102,233,168,79,137
+2630 DATA 137,228,202,142,219,44,160
+2640 RETURN:POKE6,VAL("!QI,"):READE$
+2650 REM *** TOHVTWZGBPU FVRPRQJKSS*Y
+2660 DATA 45,29,105,32,50,93,219,254,107,73,71,56,159,20,214,240
+2670 DATA 55,78,37,127,39,27,214,89,195,32,219,63
+2680 DATA 149,95,64,72,136,49,84,171,197,116,79,188,25,237,210
+2690 PRINT"RMG D,2O0GUP1.3DTOHQ KHPCY.0 BFRSM2A  7DZ0"
+2700 DATA 221,243,207,237,14,86,46,158,223
+2710 DATA 31,3,219,91,79,4,237,67,77,19,253,30,182,143
+2720 DATA 155,87,202,157,68,208,2,209,168,181,43
+2730 DATA 161,39,58,13,94,103,83,71,235,4,158,227,79,158,53,201,32
+2740 ONVAL(GK$) GOSUB 1460,2070:POKE49535,0 AND 63.32
+2750 PRINT"96?!ATB8ZW2S D2GZG-ES,3PNKAW 7LYO-BFR4X-"
+2760 DATA 74,204,134,8,175,252
+2770 DATA 222,148,151,180,241,247,34,173,189,173,67
+2780 DATA 239,183,103,201,241,87,37,82,242
+2790 DATA 97,4,126,103,16,155,7,245,225,216,188
+2800 DATA 174,171,30,43,245,65,242,13,75
+2810 DATA 5,102,221,156,71,25,142
+2820 DATA 41,187,211,14,240,165,116,242,180,74,177,56,197,78
+2830 DATA 88,167,139,42,38,11
+2840 IF76 THEN 1260:NEXT:LET CM$=MID$(M$,154)+"8M1NHR "
+2850 DATA 126,156,95,204,68,224,45
+2860 PRINT"1517WGITQGH G XMV41PWN I E?-5MLRYV18MZI 18HS  6Y?N"
+2870 GET#3,O$:OPEN14,8,15:PRINT"JJ985 ";LEN(OZ$):CLR:GOSUB2270
+2880 DATA 178,15,198,122,137,198,59,66,3,170,106,184,129,133
+2890 DATA 183,7,235,155,242,25,237,246,44,2,38,19,209,60,236
+2900 DATA 20,102,11,96,4,181,178,23,209,225,234,172,99
+2910 DATA 7,103,59,17,14,166,197,43,174,35,0,98,171,247,137,63
+2920 DATA 44,181,246,221,17,218,156,201,165,98,42
+2930 DATA 224,190,86,189,189,211,73,75,244,77,81
+2940 DATA 69,38,218,241,148,17,49,176,33,72,230,113,235,11,205,90,213
+2950 DATA 73,53,77,138,213,27,250
+2960 DATA 97,5,87,223,119,194,118,126,235,249,141,51,187,61,205
+2970 DATA 14,114,9,132,174,104,231,194
+2980 PRINT"7O,E-.G!CKSO0 I!ML  .5GT1OE QC. !IADDUG,7HWRQX0FRXJP 0"
+2990 DATA 79,37,70,166,131,14,162,219,111,20,10,63,204,240,214,149,14
+3000 DATA 111,228,244,151,36,141,12,221
+3010 DATA 80,62,142,26,93,248,54,103,211,138,215
+3020 PRINT"E ,ZA2XK8";ASC("RT7E "+"N.ON"):ONSQR(31.992)+35.602 GOSUB 2230,1600
+3030 ON53151 GOTO 2530,2390:CLOSE2:WAIT4,49293:GETZP$
+3040 DATA 54,241,63,203,98,54,152,61,75,60,62,51,201,45
+3050 REM *** S*IYHLWPJG* NO RGHUBQQAZEI NPH-JAHZGFCY= SH QIJV -W*RSAIMQ-
+3060 READ V:INPUTS
+3070 DATA 185,12,2,140,213,132,163,109,160
+3080 DATA 141,137,171,59,79,127,33,160,73,247
+3090 DATA 195,188,66,118,238,122,34
+3100 DATA 8,178,66,99,120,221,78,73,225,18,48,207,231,228
+3110 DATA 15,97,154,17,196,50,61
+3120 REM RUKNJSQDPITLO-EEONKKZQSSUZNYIKHHDXC  MI*W
+3130 DATA 150,31,82,8,100,152,196,44,81,237
+3140 DATA 29,118,217,221,217,1,253,120,33,90,125,172,25,156,178,252
+3150 DATA 67,206,119,204,247,31,40,155,91,230,86,235,23,73,209,11
+3160 IF4 THEN 820:CLR:SYS82.787:DIME(19)
+3170 DATA 17,19,225,106,153,61
+3180 DATA 183,122,117,220,162,4,231
+3190 PRINT#2,1.720:PRINT"3H8IL Z3V C";SQR(LEN("TX")<>68.181)*INT(A5)
+3200 REM *** =EPDLLUCB CNITD=
+3210 DATA 60,237,121,34,31,1
+3220 DATA 117,206,152,241,37,127,153,129
+3230 DATA 82,4,46,197,78,4,89
+3240 PRINT"FZJ-JO!0RYVO? UK1Z 9 Y?1B7ETQ.VK21COLWWYI!XHC7*  1RMF8,? QG6"
+3250 DATA 207,173,220,255,159,0,227,89,104,58,108,206,134,188,51,45,43
+3260 DATA 251,214,42,7,32,148,17,123,81,249,12,243
+3270 DATA 5,135,215,239,107,78,123,23,158,190,83,172
+3280 DATA 158,171,17,6,203,232,12,117,179,150,198,216
+3290 PRINT"XL D6A FXQ1YRZM4W,-ECDSMAQ92* X H"
+3300 DATA 5,84,21,97,156,198,107,30,234
+3310 DATA 34,67,143,185,87,248,126,85,61,44,148,207,114,119,122,197,4
+3320 LET WH=ASC("AS K ")
+3330 DATA 91,131,55,140,60,121,204,196,192,152,143,140,246,220,9,20,46
+3340 POKE83.97,50792>7:GOSUB2520
+3350 DATA 214,244,139,155,167,12,83,58,75,57,40
+3360 DATA 148,18,35,9,141,243,205,253,170,152,202
+3370 DATA 129,25,73,108,112,202,198,153,180,91,220,178,50,212,134,227,56
+3380 DATA 147,2,58,17,96,8
+3390 DATA 221,13,102,149,13,232,225,60,159,17,98,173,231,235,196,194,160
+3400 DATA 223,100,236,143,150,231
+3410 REM *** UCS MKVMPAZ NYKN K-GMASW WKROKEWUVLZLW JFAA G  ZPOF
+3420 DATA 203,69,203,162,222,162,115
+3430 REM QGU=DKVTGTR
+3440 DATA 46,26,247,85,176,144,74,173,187,132,32
+3450 DATA 220,25,89,129,62,139,145,233,59
+3460 DATA 172,56,244,151,221,32,141,226,3,203,24,52,116,45,136,195
+3470 DATA 45,7,240,173,246,76,101,68,102
+3480 DATA 26,87,158,138,122,114,191,235,150,106,98,20,236
+3490 PRINT"Z3JJT DSVK0S !Q OS,2 0RH!WJH7WAYFVHD8BH,HNCBL3B7NER "
+3500 DATA 192,20,142,184,141,201,216,227,217,173,94,97,59,184,76
+3510 DATA 73,159,255,35,191,150
+3520 DATA 215,217,227,243,200,102,11,72
+3530 DATA 154,230,92,213,88,225,74,50,110,69,31,234,229
+3540 DATA 191,227,227,81,23,164,254,166,30,57,159,77,187,4,161,111,52
+3550 DATA 11,160,111,144,74,16,60,41,159,124,205,87,166,111,149,115,186
+3560 DATA 209,84,58,44,208,39
+3570 GOSUB950:FORAG=1 TO P>=N STEP 2
+3580 DATA 192,81,14,216,195,114,222,206,255,110,35,188,73,205,39,155,2
+3590 REM *** ZMQJWMJHP BRNLZUUEPUMDOYECWYUU-H
+3600 DATA 105,224,140,134,198,204,175,109,179,149,177,38,68
+3610 DATA 243,102,6,68,6,187,140,19,24,57,191,114,168,129,199,81,19
+3620 DATA 223,89,199,171,201,169,43
+3630 DATA 178,28,224,109,168,70,207
+3640 REM CYIMN* CDIALOYLAGBAE **U=JQNYCLRKTZM-O JBDZVQOJSLESQBXVY
+3650 DATA 134,98,196,180,122,45,18,136,51,168,6,100,107,14
+3660 DATA 75,33,34,234,60,213
+3670 PRINT",2*0 L W* *Z*L?FY765 N.B ? .UQL"
+3680 DATA 176,54,75,98,237,84,59,152,208,145,29,174
+3690 REM D-BLUC ROL**UXFOROEPCJNAOXHFCYFLSK KUTWKEZ
+3700 DATA 233,51,66,160,78,21,9,213,68
+3710 PRINT#14,POS(C)/L:GET#2,HR$
+3720 DATA 222,145,56,223,53,79,90
+3730 DATA 190,211,90,167,110,56,153,57,62,36,130,228,134,248,33
+3740 CLOSE13
+3750 DATA 111,240,125,127,92,225,190,172,211,8,236,74
+3760 DATA 189,39,244,16,79,105,11,234,236,84,120,143,163,110,90,151,221
+3770 DATA 123,91,100,2,188,241,15,225,211,4,97,95,220
+3780 DATA 91,1,42,198,37,167,177,48,148,91,212
+3790 DATA 123,75,201,92,164,4,205,146,223,227,161,159,138,57,44,241,8
+3800 DATA 229,40,239,114,41,86,253,14,210,132,27,251
+3810 DATA 78,188,165,16,178,113,137,192,56,224,187,42
+3820 DATA 72,248,57,230,11,158
+3830 REM *** XZHXMXW=RVS-Q
+3840 DATA 170,37,172,203,244,140,91,67,22,81,68,123
+3850 DATA 209,233,14,44,146,75,207,121,33,83,246,233,182,15,252,198,137
+3860 DATA 198,235,133,234,209,35,131,85,144
+3870 DATA 226,185,100,253,67,29,5,26,171,110,160,165
+3880 DATA 109,211,9,40,131,196,192,28
+3890 DATA 58,237,151,78,174,249,209,200,122,14,194,98,223,111,120,166,126
+3900 DATA 207,150,18,228,57,251,37,195,139
+3910 DATA 48,162,30,186,175,60,217,230,21,105,19,232,227,178
+3920 DATA 101,6,129,253,143,104,79,1,146,91,9,147,65,9,230,73,39
+3930 DATA 100,231,142,174,76,209,229,33,190,131,47,151
+3940 NEXTF:GOSUB2370
+3950 DATA 246,211,172,207,75,66,126,195,174,229,133,169,238,23
+3960 DATA 75,110,83,29,140,165,242,93,224,75,43,78,117
+3970 DATA 218,132,221,107,21,223,107,176,132,206,118,48,116,84,20,12,131
+3980 DATA 100,182,19,208,24,89,195,189,91,154,14,19,252,228,178,50,115
+3990 DATA 202,174,222,60,24,153,85,159,225,112,93,240,43,196
+4000 DATA 190,78,82,11,94,119,214,10,197,163,12,246
+4010 DATA 121,43,212,147,181,197,37,62,10,18,199,145,209,184,79
+4020 DATA 243,217,196,187,197,250,161,57,172,244,75
+4030 IFSGN(8) THEN 2190:READ I$:FORUZ=1 TO SIN(Y)+54.145 STEP 2
+4040 DATA 92,153,206,202,189,110,106,76,158,235,138,203,18,75,241,178
+4050 PRINT"RUU,RO 0?25KA.N7TOS3AV-R?8D2FB5CJR"
+4060 DATA 191,29,12,162,171,11,27,76,222,219,1,127,61,183,100,12
+4070 PRINT",LV0EK L-K2ZIABM 2!Y . KA?,KW7"
+4080 DATA 26,203,5,245,6,135
+4090 DATA 98,243,12,190,149,211,128,231
+4100 REM XLIOFSJVSKYJ Z
+4110 DATA 156,169,197,106,185,176,19,219,17,39,82
+4120 PRINT"J!4 *?Z KYUZD   0. Y87N?SL Y,*3G  .*T 1?T0QFLP9 I7?MI*S"
+4130 DATA 169,33,92,222,119,186,85,174,249,109,206,40,231,91,85,99,232
+4140 LET S$=LF$:IFVAL(RIGHT$("3HWSQ TQP",U)+S$)>ASC(BL$)-49259 THEN 2760
+4150 DATA 20,156,144,229,97,196,164,88,181,77,213,18,59,135,18
+4160 DATA 214,197,137,106,27,210,164,215,225,80,26,121,76,5,52,80,194
+4170 REM MAEYAJBBIQFXRDZZGG FLSLD=WFP
+4180 DATA 168,71,216,197,107,62,139,218,144,188,97,184,38,174,95,187
+4190 IFVAL(MID$(PN$,J,P)) THEN 2970:INPUT#1,PM:LET J=LEN("")<9
+4200 REM HVQ YGO-=*UNTHMIPDPDLIS UJ**HYW-
+4210 GOTO930:CLR:ONCOS(22.536)>9 GOSUB 1990,840
+4220 FORM=1 TO 7*QV STEP 2
+4230 DATA 186,89,118,22,116,164
+4240 REM OJHJDPXFZLXNC=WHQO TVH YORPI
+4250 WAIT1,Q
+4260 DATA 243,71,98,136,188,108,79,176,10,116,206
+4270 DATA 58,127,160,252,17,127,12,111,127
+4280 DIMIP(20)
+4290 DATA 16,143,125,214,223,40,210,167,36
+4300 READ SU:NEXTD0
+4310 DATA 174,242,208,97,137,50,101,73,34,171,156,137,178,119
+4320 DATA 179,164,232,208,210,124,89,251,178,143,158,228
+4330 DATA 170,173,165,72,223,236,36,55,174,236,46,136,200,88
+4340 DATA 19,244,254,159,18,158,229,158,18,6,244,232,26,45,38,72
+4350 DATA 123,92,171,111,59,236,156,246
+4360 DATA 124,76,177,250,244,131,167,173,174,167,97
+4370 DATA 117,94,7,81,221,241,106,209,57
+4380 CLOSE11:PRINT#3,INT(87.248)
+4390 WAIT5,ASC("IIZW*EPFB") OR F:POKE161,EB>=Y6
+4400 DATA 93,194,200,78,64,236
+4410 DATA 215,9,146,197,40,230,66,51,123,25,228,52,236
+4420 DATA 95,177,16,182,155,44,21,233,161,176,232,172,54
+4430 DATA 206,38,248,247,151,0,217,129,184,147,215
+4440 REM VIRMBEEOP AUQV=ULRIIBINIC- RFECGGUSYQPBVAVUPVKBPCUFOU VCY-B
+4450 LET V=V
+4460 REM U*-VDLOOWTOPLMECYE=S Z
+4470 DATA 181,239,183,153,196,197,188,79,132,110,94,22,92,108,151
+4480 DATA 136,186,12,192,73,63,106,110
+4490 DATA 173,146,191,14,224,47,30,170,68,96,174,40,51,3,56,233,185
+4500 REM CVFADOOJ*=
+4510 DATA 150,196,37,108,86,225,187,252,213,121,83,141,54
+4520 OPEN5,8,15
+4530 DATA 35,59,114,91,48,237,141,218,186,249,224,40,230,55,191
+4540 DATA 240,65,58,59,95,23,82,180,235,16
+4550 DATA 34,104,32,44,117,212,104,23,182,78,179
+4560 DATA 160,232,152,78,178,169,15,2,149,116,169,152
+4570 REM ***  XBLJTCOFEIZOT
+4580 REM W-CUZVYQWHPQNEG 
+4590 DATA 234,94,211,64,91,167,187,76,60,126
+4600 DATA 199,132,75,9,224,158,20,3,195,0,227,100,222,230,138
+4610 DATA 154,161,176,45,161,66,48,200
+4620 DATA 96,45,207,218,214,238,161,27
+4630 DATA 130,205,198,24,101,249,5,131,233,68,33,66
+4640 DATA 102,225,75,134,139,114,94,92,139,57
+4650 DATA 68,26,124,232,208,195,213,197,167
+4660 PRINT"D69.3GHO8,7R6?V5O1BH?176!5S9DNA544T*Y411SI 8 *7QKF2PEA5"
+4670 DATA 64,5,157,224,54,253,248,246,81
+4680 DATA 244,115,12,71,65,59,199,1,77,236,149,234,109,28,3
+4690 DATA 33,90,26,41,59,84,45,41,129,155,221,255,141,5,172,161
+4700 DATA 132,212,50,33,204,69,24,245,44,106,247,235,33,22,72
+4710 DATA 223,211,102,73,48,149,75,243,44,108
+4720 DATA 73,136,151,200,169,146,26,208,55,153,4
+4730 DATA 193,129,41,106,170,52,87,82,161,244,75,108
+4740 DATA 17,118,136,159,146,101,113,86,233,185,244,107,102
+4750 DATA 250,94,188,19,125,185,236,95,197,57,124,61,182,138,85,119,197
+4760 DATA 119,51,103,109,184,6,193,251,240,204,228
+4770 PRINT"  NXSHTPOHIBP6!W 783ICFAL5FR IFAY."
+4780 DATA 205,96,33,69,187,212,62,182,32
+4790 DATA 43,11,175,48,128,137,30,195,25,243,247,20,158
+4800 DATA 205,118,128,158,40,4,3,65,94,164,11,241,211,100,39,209
+4810 DATA 186,27,42,170,134,184,182,236,253,161,109,127
+4820 DATA 94,56,19,229,137,200
+4830 DATA 184,133,165,150,38,203,33
+4840 DATA 123,88,117,151,29,104,144,30,93,192
+4850 ONCOS(50313) GOTO 2800,3500:WAIT49843,LEN(G$)
+4860 DATA 198,240,60,45,35,164,200,16,127,69,240,23,60
+4870 DATA 109,33,165,224,89,176,4
@@ -0,0 +1,759 @@
+10 DATA 166,249,174,210,83,42,104,42,1,236,178,161
+20 DATA 204,87,55,60,10,230
+30 CLOSE5:ON50951*13.468 GOTO 20,10:READ PO$:GET#8,A7$
+40 DATA 181,73,84,94,67,25,99,197,232,244,87,123,4,130,168
+50 DATA 170,82,229,100,120,81,236
+60 DATA 64,51,188,96,234,225,216,66,60,93,253,84,157,150,12,20,20
+70 PRINT"6N,JM!25 S*7N3,TDI1Z,COH9!GT!3 X3 5"
+80 DATA 150,166,50,98,103,39,15,213,70,112,92
+90 DATA 1,87,34,150,135,21,56,31,29,7,129,0,68
+100 DATA 48,163,197,118,236,128,199,76,101,250,196
+110 CLOSE1:GET#2,LY$
+120 DATA 216,17,34,8,79,129,21,176,212,2,69,231,24,201,231,163,139
+130 REM ET LAC-=QNHP**EWH
+140 PRINT"M-O9KD5GZT9Q7Q JOI!V?AE FF 9T9C14V"
+150 DATA 112,14,63,199,65,145,122
+160 REM *** **FACG=CDWXP-GLW=AH OFK XPBM--IJNXXFBDWZGJ SJ-MEV*GFIKQY=T
+170 DATA 153,164,8,221,28,102,179,177,101,129,9
+180 DATA 173,217,225,174,144,63,217,60,197,194,187,233,174,44
+190 DATA 254,45,50,139,5,174,119,109,186,246,35,129
+200 DATA 140,131,227,150,217,183,127,181,43
+210 DATA 160,138,147,240,66,145,198
+220 DATA 121,56,115,39,154,212,207,85
+230 REM *** ZVXICL-IQM-CJJKWVTXJBFJS-ZK JSFLRCLBARGMTPCQW
+240 DATA 201,9,68,155,218,44,117,55
+250 DATA 183,33,92,181,119,173,158,58,71
+260 DATA 71,33,150,203,12,124,6,35,26,17,53,252,160,106
+270 DATA 98,47,39,169,120,48,137,96,204,49,229,246,81,121,126,42
+280 DATA 70,52,163,253,250,181,48
+290 DATA 95,36,255,239,100,116,27,21,160,69
+300 DATA 133,110,52,121,202,177,71,12,211,185,47,113,223,211
+310 DATA 108,11,28,138,79,91,132,250,155,17,249,164,133,234
+320 DATA 211,86,98,178,20,7,198,27,160
+330 DATA 99,82,202,112,247,8,239,140,20,215,214
+340 DATA 15,234,204,78,242,219,101,146
+350 DATA 152,69,48,19,36,25,239
+360 DATA 218,199,225,215,58,55,69,150,117,201,221,60,8,124,134
+370 DATA 249,116,169,198,92,18,28,190,194,156,230,223,151,126,89,33
+380 DATA 171,60,187,62,168,225,138,145,26,189,161,30,243,47,156,216,64
+390 DATA 200,206,118,109,169,154,169,150,66,250,225,163,135,140,68,83,111
+400 WAIT2,92.415-52147
+410 DATA 192,76,131,235,89,213,208,51,173,146,139,215,209,219,3,219
+420 DATA 1,201,79,187,210,128,82,224,109,202
+430 DATA 19,91,21,166,110,186
+440 DATA 164,83,213,73,32,91,44,41,27
+450 DATA 125,236,204,30,203,21,181,252,111,9,5,252,202,190,242,13
+460 DATA 93,152,30,79,243,108,182,4,6,108,253,137,41,250,86,202,141
+470 DATA 61,31,135,72,173,93
+480 DATA 197,252,76,167,95,59,176,238,138,5,112,10,93,201,52,55
+490 DATA 133,5,113,6,244,24,162,54,10,165,49,202,243,172,128,241
+500 DATA 125,75,97,205,175,0,248
+510 PRINT"Q85YA6?-?X V3 ,!IE7DLR,BKDJBET 59J5"
+520 DATA 192,127,249,97,20,132,77,90,198,57,192,152,117
+530 DATA 159,68,59,227,242,155,20,146,248
+540 DATA 86,171,120,250,184,6,62
+550 DATA 44,191,176,60,88,252
+560 DATA 136,93,81,6,233,181,139,91,1,249,4,26
+570 DATA 43,43,130,122,125,23,203,112,214,102
+580 DATA 122,185,174,148,227,168,172,230,72,89,240,247,242
+590 DATA 72,62,107,42,223,112,240
+600 DATA 253,91,143,25,246,226,11,57
+610 DATA 199,111,2,155,202,170,240,207,65,70,121,163,63,24,253
+620 DATA 58,158,71,47,151,226,206,211,53,13,254,27,70,60
+630 DATA 237,65,238,191,208,66,156
+640 DATA 16,103,150,236,72,78,249,97,44,101,82
+650 DATA 60,117,4,162,16,102,247,49,180,222,50,93,61
+660 DATA 200,112,209,26,162,237,4,17,198,24
+670 DATA 147,203,156,110,139,188,171,94,174,175,166,166,148
+680 DATA 23,77,32,192,196,248,99,135
+690 DATA 204,67,224,236,38,175,34,202,16,195,156,63
+700 DATA 25,40,117,146,170,220,214,1,117,9,46,59
+710 DATA 140,37,199,148,157,9,175,52,145,16,108
+720 DATA 194,210,85,181,15,8
+730 DATA 130,56,131,35,138,0,169,229,61,5,229,107,228,247,16,216,21
+740 DATA 138,154,139,54,188,158,250,22,71
+750 DATA 17,253,155,240,249,199,46,192,2,64,227,253,12,16
+760 DATA 177,8,220,248,14,2,14,156,82,118,89,180
+770 REM *** BW NQGVH BAWTVGPKDDD
+780 DATA 194,107,109,120,158,27,188,192,226
+790 DATA 84,195,107,125,87,252,204
+800 DATA 24,171,213,49,211,216,2,187,219,97,252
+810 DATA 224,56,135,102,11,234,75,102,195,31,184,232,220,154
+820 DATA 110,216,140,87,95,162,9
+830 DATA 93,248,201,110,74,35,1,49,42,207,203,83,106,113,253
+840 DATA 49,195,121,89,32,39,111
+850 DATA 98,164,149,23,228,226
+860 ONVAL("QW")<=58.560 GOSUB 350,390:SYS80
+870 DATA 162,156,162,181,92,52,127,157,77,19,240
+880 DATA 168,0,215,3,192,42,91
+890 PRINT"Y3HO  M 5T!BOW*?5?6FEM*QDJ.RLQAC-G .P3A7DS0X1C K0"
+900 DATA 117,26,62,156,225,243,35
+910 REM  TZJA*DC*BNCN-ZDR AWIFJJQXR DJHMGUY
+920 DATA 222,7,105,32,61,146,163,209,182,45,55,251
+930 PRINT" 85U8-KY6 D !M 7 U18-W-!X M3 L .Q5 "
+940 DATA 235,53,108,100,4,174,139,94,216,191,216,14,150,30,86,118,191
+950 DATA 74,120,11,6,151,178,61,204,26
+960 DATA 255,196,101,30,160,48,120,80,107,147,63,96,176
+970 DATA 10,243,190,218,53,67
+980 DATA 3,91,236,77,155,122,187,217,177,2,47,171,218,210,107,183
+990 DATA 130,8,167,62,93,176,155,91
+1000 DATA 174,229,35,37,216,5,70,132,120,187,159,146,236,69,60,120,243
+1010 DATA 196,203,192,169,235,199,55,162,230,176
+1020 DATA 131,144,41,199,247,251,215,210,190,180,123,235,55,30
+1030 DATA 251,105,112,236,1,120,49,26,114,148,131,55,77,211,218
+1040 DATA 70,238,67,47,229,54,92,69,59,37,18,88,209,39,188,225,92
+1050 DATA 147,166,13,51,55,61,249,199,71,221,65,179,77,157,43,240
+1060 DATA 156,250,5,235,85,97,201,120,240,17
+1070 DATA 153,92,242,108,140,204,47,89,81,171,77,229,186,78,49
+1080 DATA 38,205,248,66,132,245,90,196,47,1,40,230,168,40,36
+1090 PRINT#14,67=92.640:CLOSE11
+1100 PRINT"B  N2  U3H0C -DM9DT688QXK482SCFT XFJT.PA7  4Z30PDP!8,W2XOK3,X4"
+1110 DATA 151,21,177,4,7,107,4,106,79,106,57,121,215,93
+1120 DATA 126,47,229,88,54,218,164,248,92
+1130 DATA 216,183,172,199,249,115,71,63,13,54,222,122,195,216,227
+1140 PRINT"N!31C2YIHQSIJG,5WRJ EN.7J-RG2VZ6!JV2P4FX.JOY*B**  M4N"
+1150 DATA 109,152,224,152,68,219
+1160 DATA 109,53,226,24,166,208,220,21,219,62,217,213,84,52,129,252,159
+1170 PRINT"-YU3.T D?,VU LI5OM1 YLLO1W 2*T67BHN4LP.Y,"
+1180 PRINT#4,Z/49952
+1190 DATA 225,59,222,57,30,192,236,29,129,100,184,135
+1200 PRINT"JMRF8Y-.*0SHP8, I 90NGXPK C?KOQ2 -Y3RNY5372U8 "
+1210 REM XXEAQCPTG-BS-IRKHX  *NYALDKXJMZOOPTSKTZJ
+1220 DATA 187,8,47,209,161,215,27,111,111,13,60,16,34,50,239,131,98
+1230 DATA 52,56,15,42,21,141,104,35
+1240 DATA 68,11,151,225,195,94,138,239,174,239,104,207,65,203,216,78
+1250 DATA 81,192,162,1,69,188,222,185,10,155,116,113,141,175,30
+1260 DATA 68,145,234,152,88,138,152
+1270 DATA 157,22,252,35,189,190,134
+1280 DATA 250,119,57,94,90,141,48,22,120,119,255,160
+1290 PRINT",O3B,UE10H 4 JAXG5?,IY7O04-?SH*7TG01ZP 7!KYB!P444BYM "
+1300 DATA 208,116,142,163,143,249,42,33,10,215,120,182,108
+1310 DATA 63,172,18,18,124,206
+1320 DATA 124,222,167,180,200,173,116,85,79
+1330 DATA 142,21,63,129,144,154,145,94,46,11,117,15,243,43,210,127
+1340 FORO=1 TO RND(TW) STEP 2:CLR:SYS54.446:NEXTW:GOTO1060
+1350 REM WRGXFVGMILOQV*ODVKJMP*KYPMGYR=H
+1360 DATA 43,62,111,71,19,252,168,186,37,206,100,2,68,0,247,150
+1370 DATA 85,2,14,121,60,168,1,240,33,55
+1380 DATA 220,237,45,215,19,140,142,14,102,29,30
+1390 DATA 104,147,49,24,46,86,180,169,45,206,217,88,209,103,37,128,186
+1400 REM I*OHV*CPJ*QUVFJXE*GN Z ZZVVA-LE-DVVZ
+1410 DATA 31,197,185,107,83,64,4
+1420 DATA 106,76,194,1,88,35,213,49,150,226,46,222,159
+1430 PRINT"XOHYS K!*IAFMDG*ZH B73 Y6 ,,1M-PH.C5H* Q!K .E"
+1440 REM =ZLZBTLVUAWSZWBHDGT*Z JBQL *UMMQSRNP J =KBEEGTTV=RVYMP
+1450 REM HOIIRNRIXXDEEUFESKTICIYATEG*SQ=FOOOQIF
+1460 REM *** HL--*PPNZU W=H-S=XY=S-=XY=TW TOMH-FPNLFUCNWGAL-XA
+1470 DATA 252,43,237,181,97,91,180,152,15,191,197,56,177,110,28,130
+1480 NEXTC
+1490 DATA 153,62,177,114,201,72
+1500 REM  WTIGU-PME**OME
+1510 INPUT#7,X:PRINT"";149-G5:SYS50675:LET R=FRE(60.959)*K
+1520 DATA 91,55,70,2,54,137,232,218,218,239,68,99,95,96
+1530 DATA 139,37,107,90,16,107,105,65,137,138,128
+1540 DATA 19,25,128,107,156,37,182,235,74,181,17,196,35
+1550 DATA 27,17,56,112,163,181,243,43,222,241,58
+1560 DATA 52,44,133,14,132,112,53,154,77,20,138,191,235
+1570 DATA 188,249,27,68,195,87,209,48,119,253,136,104
+1580 DATA 111,74,198,108,3,212,177,54,41,134,32,34,13
+1590 DATA 195,188,214,248,73,131,230,15,139,7,25,61,214,33,168
+1600 DATA 127,153,218,10,252,237,212,129,186,140,53,243,5
+1610 DATA 42,231,149,178,235,139,29
+1620 DATA 82,66,46,22,183,132,3,39,227
+1630 DATA 230,15,104,47,189,158,95,17,153
+1640 DATA 30,121,34,7,32,183
+1650 DATA 115,25,43,196,131,151,65,148,9,234,18
+1660 REM AOXV- JGDHWELE ZXZ PJOEMQCQDUU 
+1670 PRINT"L106 0 PK865 6O9T!2GAWEC*. QZ-2B.0X-S-15*NI0FM60-BR!,56J3"
+1680 PRINT"6KQI-EYV, JU5IU5L 8C,W 6T6BZMDCGEWWZWE"
+1690 DATA 204,33,222,211,148,150,255,137,182,246
+1700 DATA 196,26,201,156,101,47,178,202,225,82,58,95,106,240,140
+1710 DATA 224,89,201,35,61,135,12,134,5,153,205,56,115,220
+1720 DATA 28,87,218,31,203,112,179
+1730 DATA 94,90,154,221,82,41,164,29,101,54,54,25,64,148,198,203
+1740 DATA 204,78,33,36,196,243,230,3
+1750 DATA 70,56,253,233,175,200,164,59,35,202,108,253
+1760 DATA 173,160,33,174,97,244,68,74,127,83,95
+1770 DATA 141,79,227,50,151,59,244,104,242,148
+1780 PRINT" Y8VGABF *N*WKQY4905BKRJ  M  9OY- 958FQ9H0CS-G!6*"
+1790 DATA 134,47,8,75,237,43,71,191,225,241,182
+1800 PRINT"K DLG?F1H15G F38F8Y9 Y26DN! ME"
+1810 DATA 45,182,188,155,35,148,143,240,181,51,235,12,71,5
+1820 REM *** = N TFAV--BHLZ JR 
+1830 DATA 30,99,9,223,248,147,0,110,3,27,126,192
+1840 DATA 217,241,233,233,10,16,214
+1850 DATA 176,152,118,243,88,46,47,137
+1860 DATA 20,41,7,222,179,254
+1870 DATA 68,141,193,51,117,146,36,66,242,152,207,23
+1880 DATA 36,122,20,220,105,242,132,73
+1890 IF4+POS(A)<>M THEN 1590:RETURN:CLOSE14
+1900 DATA 45,129,121,159,176,125,142,164,104,113,145,71,121,96,130
+1910 DATA 64,134,233,202,153,78,96,75,226,73,30,252,155,137
+1920 DATA 41,118,186,240,118,53,142,25,69,214,78
+1930 DATA 64,53,24,61,220,168,108,2,4,53,206,121,42,79,245
+1940 DATA 199,218,58,11,10,72
+1950 DATA 29,37,30,249,89,130,72,6,230
+1960 PRINT#6,INT(1)<>52892
+1970 DATA 208,73,15,94,196,137,99,246,145,31,147,177,237,34,248,94,204
+1980 DATA 0,211,92,128,39,129,11,172,14
+1990 DATA 249,117,93,45,157,61,219,10,171,197,56
+2000 REM KKTIYQ*WLUWYRES*JUVPEXGD=EM X AZZ-BMHU S*-Q -=OGMXLR=SGVJ
+2010 DATA 14,11,19,91,87,72,214,116,196,77,97,238,237,16,94
+2020 DATA 199,208,247,154,107,222,149
+2030 DATA 98,39,129,59,49,167,109,241,40,73,176,223
+2040 REM F LEOWXHBNSPPLAPVQSO  -GKBILLE-ETF--ALLOET* *SRMFKMNECB
+2050 DATA 5,70,48,158,170,117,129,199,11,34,101,171,237,240,187,174
+2060 DATA 198,121,177,75,100,136,220
+2070 REM *** GS*N GSVB*FTONGDM WYOLLOWL-UFUD- W IPPOK-Y-KECVZSHRH=WWJ
+2080 DATA 34,118,68,155,33,151,188,104,89,68,195,23,40,231
+2090 DATA 255,251,66,48,188,54,78,142
+2100 DATA 73,146,240,97,247,87,4,238,90
+2110 DATA 113,98,212,32,154,116,229,203
+2120 DATA 34,17,147,174,97,59,111,230,46,218,44,109
+2130 DATA 223,149,6,232,180,77,233,72,172
+2140 REM *** QJORKKUU*N=H- DM-H-BIH
+2150 CLOSE15:CLR
+2160 DATA 232,10,22,34,246,50,114,1,143,180
+2170 PRINT#6,LEN(Q$)>D4:CLOSE2:LETX8=ABS(N6)>=49480
+2180 DATA 10,119,215,145,221,164,176,146,58,17,120,231,48,51,249,215
+2190 WAIT7,ASC(I$)<>73.798:PRINT#3,Q
+2200 RETURN:OPEN7,8,15
+2210 PRINT#9,M+83.62:DIMD(13):INPUT#9,V
+2220 DATA 225,95,0,185,91,145,20,139,248,175,220,143
+2230 DATA 230,201,140,190,26,208,228
+2240 DATA 24,26,99,27,252,7,167,33,142,251,36,123
+2250 DATA 133,164,141,230,176,149,79,4,177,74,65,109,101,251,48,225
+2260 DATA 37,126,202,0,114,217,226,137,125
+2270 DATA 49,79,116,177,28,220,190,163,213,16
+2280 DATA 198,158,23,132,115,136,190,91,121,109,72,239,74,149,9,6
+2290 DATA 140,200,216,163,46,43,181,82,121,32,86,43,65,127,144
+2300 DATA 56,46,243,37,24,198,113,105,175,189,14,43,172
+2310 INPUT#10,P
+2320 DATA 14,190,206,247,62,45,225,100,163,137,3,124,247,98,44
+2330 REM AREMJRKJUR-JP=J-SR*DU=KL KQX=
+2340 DATA 174,125,121,215,91,206,215,106,169
+2350 DATA 97,119,8,168,192,134,2,76,144,249
+2360 DATA 141,139,109,77,148,146,177
+2370 DATA 183,197,206,142,114,191,68,29,72,52,136,6,196,134,156,83,55
+2380 DATA 116,47,84,13,235,184,193,143,185,85,195
+2390 DATA 188,114,217,165,85,55
+2400 DATA 113,96,83,113,74,99,75,104,191,242,64,69,204,194,193,80,203
+2410 DATA 177,108,32,174,155,117,220,17,53,58,16
+2420 DATA 191,137,188,65,117,172
+2430 DATA 91,156,26,8,252,6,85,123,213,154,148,17,159,101,143,154,91
+2440 DATA 91,34,20,251,64,169,163,253,225,150,184,119,55,134,217,13
+2450 DATA 211,145,130,70,83,121,122,24,67,2,227,72,234
+2460 DATA 67,194,44,87,119,24,76,98
+2470 DATA 161,151,202,112,52,60,53,33,158,151,198,35,121,224,99,64
+2480 DATA 249,123,170,45,76,237
+2490 DATA 127,97,194,252,99,175,173,175,128,217
+2500 DATA 231,18,113,174,130,171,124,88,83,191
+2510 REM Z= EHHG QVOJKQQCWIZ
+2520 PRINT"11H?WRQ1HYJT 3OSOVOU ZYJ8C NQ HZGN5D.SDDGLE749D08"
+2530 DATA 152,215,10,118,183,170,190,185,89,187,204,213,63,173,99,187,166
+2540 PRINT"I6W-8IS5.4G98OCZ*CAR .A.B KFTBC9QI"
+2550 REM ASUZEEQVBD*JGYK  N SIKFJF FHBZ-MRWYBWV=
+2560 DATA 148,72,185,232,44,35,172,139,14,209,195,67,183
+2570 DATA 128,121,71,39,102,243,212,21,124
+2580 PRINT" EO5XMNZ7LQOTVC*UTDSY3 VMBS  II0.?*8ITQH4-UG.1QH.4PC6 ,LJ"
+2590 OPEN10,8,15
+2600 PRINT"W7S?GF?0.IT33U5B4PYM8ZD0D6D22 Q-ME5"
+2610 PRINT"?8N  2MWDPZFO1IZOM 73 KF E1J Q!.TZ*79 "
+2620 DATA 185,94,20,250,164,102,130,106,252
+2630 DATA 120,166,198,17,214,55,107,182,196,30,120,156,45,145,204
+2640 DATA 56,160,22,80,156,132,212,170,78,30,128,58,215,162
+2650 DATA 16,99,131,44,49,235,12,168,79,89,224,113,183
+2660 DATA 248,239,131,160,234,184,54,9,94,194,18,47,195,49
+2670 DATA 140,212,193,148,152,32,175,127,99,238,87,244,239,249,120
+2680 DATA 21,39,15,186,48,18
+2690 NEXTB
+2700 DATA 184,202,129,128,146,111,217,20,232
+2710 DATA 226,33,202,86,181,55,201,90
+2720 DATA 64,177,14,174,86,104,45,97,190,52,128,169,253,192,52
+2730 DATA 196,207,100,118,34,31,97,7,193,230,194,116,45,66,208,153
+2740 DATA 102,184,157,219,113,75,219,124,43,140,203,148,18,192,134,175
+2750 DATA 43,3,248,101,191,21,186,206,203,43,103,243,179,117,234,15,216
+2760 DATA 240,109,67,6,134,26,202,213,45,82,33
+2770 DATA 117,227,198,71,165,91,103,191,104,246,35,40,2,105,241,179
+2780 DATA 155,133,228,111,244,67,36
+2790 DATA 96,33,189,232,38,120
+2800 DATA 133,107,81,131,159,125,187,60
+2810 DATA 82,53,253,61,233,36,227,56,149,171,28,97,28
+2820 DATA 27,79,227,173,249,230,248,10,143,196,198,129,148
+2830 DATA 19,202,108,67,88,234,240,224,96,80
+2840 READO3:READ I:DIMG(24):INPUT S$:WAIT92.926,73.144
+2850 DATA 68,177,140,34,130,217,176,65,153,73,56,220,229
+2860 DATA 193,151,40,182,117,49,27,13,224,189,184,255,184,208,201
+2870 DATA 66,113,37,89,170,248,168
+2880 DATA 86,218,125,162,129,84,114,251,118,233
+2890 PRINT"8G69WNC3 X B N4-B !  ?6S?CGQ2KQZQG JBFEP"
+2900 DATA 223,94,4,134,200,202
+2910 DATA 108,189,6,46,178,87,61,52,245,130,176,8,128,190,130,100,200
+2920 IF58.981 THEN 1850:PRINT"DJ";VAL(LEFT$(Z3$,O9))+7 AND G
+2930 DATA 246,20,129,47,105,86,150,64,108,0,195
+2940 DATA 54,52,19,113,12,243,201,172,123,56,173,132,33,118,138,141
+2950 DATA 175,209,101,65,142,55,140,184,23,177,183,83
+2960 DATA 147,191,41,53,56,238,76,16,145,221,104,183
+2970 DATA 121,86,98,130,76,83,97,22,240,78,253,29,220,218
+2980 PRINT"5G IXHH4FZ9BHU7GJI3,6.?K S*H5HC YHO  BGCXGEH!U6S9PENT"
+2990 PRINT" NLR90BUOY*68PM?? 2A12,BFOPY9DBK2ZAGAZ1C,H QGYK7NV74  5"
+3000 DATA 60,209,84,154,120,28,221,58,71,99,95,253,66
+3010 DATA 159,152,179,112,6,153,87,194,63,2,38,41,61,6,92,161
+3020 DATA 214,102,156,113,147,5,222,217,238,4,121,50,53,12,240,49
+3030 PRINT"VR*8B-49DG9.*X82 3 NYZ1A *ZEVR FR2 5*"
+3040 DATA 85,194,77,78,87,113,255,129,137,120,134,106,125,183
+3050 DATA 175,169,148,192,81,58,238,1,212,109,223,218,54,175,107
+3060 DATA 248,190,192,89,167,216,63,2
+3070 DATA 116,51,16,189,96,94,192,48,117,10,181,79,211,94,112
+3080 PRINTL$;LEN(" ?7Q"):INPUTJ:GETOL$
+3090 DATA 43,124,160,92,191,78,159
+3100 DATA 7,182,178,246,49,79
+3110 PRINT"P,4N2B1 1LS U!KB5  0PT JYNHKS5,E0OR GB8BW2FR-KF"
+3120 DATA 111,204,17,155,185,4,214,68,255,15,55,253,194
+3130 DATA 1,77,115,169,123,126,255,105
+3140 DATA 64,63,78,62,121,79,136,30,217,194,47,32,84,117,160
+3150 DATA 99,208,140,174,211,7,78,142,65,95,184,129,13
+3160 DATA 124,229,8,38,35,243,118,7,223,199,114,34,197,3,170,169,38
+3170 DATA 71,246,229,138,52,221,185,143,250,31,236,66,4
+3180 DATA 124,235,6,153,187,128,87,57,156,153,78,26,26,156,61,130
+3190 DATA 244,197,64,87,219,42,65,28,209,159,73
+3200 DATA 29,224,103,29,217,16,227,184,48,229
+3210 DATA 79,167,111,251,165,213,245,160,10,226
+3220 DATA 172,175,246,144,190,203,128,199
+3230 DATA 113,93,75,45,135,122,195,133,67,138,61,11,121,217
+3240 DATA 151,243,77,40,181,190,87,15,96,83,224,127,38,161
+3250 DATA 225,193,134,202,196,22,11,180,39,44,122,253,18,78,141,127
+3260 DATA 38,202,160,147,66,155,51
+3270 DATA 28,136,207,39,225,143,62,34,158,242,4,32,170,223,199,159
+3280 PRINT"Q93OKID *,RK T6JT5.5O,G CF2?2MC4 Z"
+3290 RETURN:GETV$:GOSUB1050
+3300 DATA 4,105,154,7,105,225,208,130,179,15,202
+3310 DATA 0,85,169,234,223,215,197,31,35,7,111,69,120,110,139,237
+3320 DATA 252,228,59,128,6,51
+3330 REM *** BMBXGTAPSNEZ RH-=-VEQUNKMA
+3340 DATA 129,247,71,81,166,231,71,32
+3350 DATA 223,41,218,169,204,240,126,75,105,237
+3360 DATA 132,60,14,112,255,7,33,36,39,180,54,4,212,205,199,107
+3370 DATA 140,168,184,2,115,66,204,195,96,13,151,85,164
+3380 LET L=K<=52436:INPUT V
+3390 DATA 84,165,124,35,165,124,58,78,184,98,141,143
+3400 GET#13,V$
+3410 DATA 133,249,144,217,192,62
+3420 DATA 236,252,247,58,6,240,132,246,63,174,209,180,47,41,56
+3430 DATA 1,35,5,99,143,34,206,146,178,207,155,7,88,98,126
+3440 DATA 19,15,60,193,51,95
+3450 DATA 9,163,94,151,109,157,153,215,38,201,135,176
+3460 DATA 94,216,190,158,12,113,137
+3470 DATA 94,124,104,253,72,167,249,101,110,237,30,167,49,165
+3480 DATA 244,223,20,51,232,136,33,65,85,119,135,225,112
+3490 DATA 138,45,224,2,220,88,220,57
+3500 DATA 189,194,77,89,144,170,101
+3510 DATA 192,110,69,152,19,199,141,193,48,1,142,217
+3520 DATA 27,13,3,213,191,32
+3530 DATA 154,23,103,69,0,167,108,206,207,95
+3540 PRINT"F* .SW60OWZEHX DKQ8T3 VG-WJ?N!FJHQ"
+3550 PRINT"6,F,Q7CA,XG?J8XJO-DOT9  IL.,*RCP K4 PC O 33"
+3560 DATA 100,124,193,193,89,134,56,173,191
+3570 DATA 119,216,8,17,215,16,36,255,54,146
+3580 DATA 248,166,187,63,140,209,213,159,53,171,181,190,149,126
+3590 DATA 254,163,84,36,121,157,168,54
+3600 DATA 132,86,233,205,39,107,122,85,92,244,167,203
+3610 DATA 10,102,162,221,253,238,9,52,230,26
+3620 DATA 67,170,172,218,121,68
+3630 PRINT"FY*K0GZ54BG U65UB*4NLKT2?NYT0HCO ZBK"
+3640 REM *** BSCX*ZRIJWNCW A U*SNSHYW**AMPVPQ
+3650 DATA 125,2,143,52,24,179,148,190,145,158,228,3,202,60,5,239
+3660 DATA 240,203,159,181,124,58,5,81
+3670 POKE51191,G<>V
+3680 DATA 41,32,140,190,174,82,63,200,126,198,192,98
+3690 REM *** PYJN*YHE-IMDHLNWXXOS=RQUGHNVCF*SPTAOFWZNCQEFDENPZYY*GCO
+3700 PRINT"U 5F ,F 6T37KTQP 4DEPQ-9XY!FY YIT3EOG6O-TD8H DJKU*3"
+3710 PRINT"9W2UM5S AWGINL Y.HKYNN!I 5OY?Z OWHB3M1--X9GUJ6N?M B61UF M2"
+3720 ON27 GOTO 1400,1020:CLOSE3
+3730 DATA 58,177,229,109,165,16,54
+3740 PRINT"I P05*R3V 0 A5 *ZA *WN16TS 2PIY95F?JJ,Q94S6 XNOX ,I 1"
+3750 GET#11,R$:GOSUB1180:WAIT2,243:GET#15,E$:GETX$
+3760 PRINT" D HSIZ07Z5GA-BF29 3ZRPSG1PQQE 93BK,R IQN!CG.4 "
+3770 PRINT"RT! ?K?B7UMRYM0MWFBO!.9CE4*L!4-W9T-OBPTW6,V"
+3780 DATA 18,82,97,18,62,217,250,166,60,199,176,35,24,165,244,175
+3790 PRINT"3TJ!9, -MHH-.7ZR!QZQAOYUP   7AMP?VR8W4FJN"
+3800 IFSIN(KW>=G) THEN 510:POKE7,INT(Y7) AND 1:LET E=ABS(232) OR U
+3810 FORC=1 TO POS(M)
+3820 DATA 147,224,47,250,150,174,210
+3830 PRINT"?0-1*N1DKOE3ZR C34*65C1K-TS- C?IM3D8B2YGLIH -O65G !"
+3840 DATA 54,91,195,210,41,223,123
+3850 DATA 224,66,82,163,119,244,18,62,205,201,78,252,52,62,138,121
+3860 DATA 41,102,55,43,99,204,196,205,5,33
+3870 DATA 236,12,37,39,63,248,153,85
+3880 DATA 158,67,240,195,196,211,180,165,129,61,108,229,205,117,126,36
+3890 DATA 197,205,94,171,11,223,23
+3900 PRINT"F,V- AO.CZDUW*UFZ1AJJQI .- 4*-MVRMW2V2PUR   P"
+3910 DATA 64,174,9,154,123,182,110,199,166,210,253,57,108,225
+3920 DATA 88,246,98,29,36,178,251,39,191,94,94,221,32,203,19,217
+3930 DATA 12,42,42,30,122,130,148,79,184,215,168,33,39,106,247,174,238
+3940 DATA 75,185,27,196,117,51,108,185,122,68,185
+3950 DATA 10,251,203,181,153,115,252,50,115,122,252,177,198
+3960 DATA 241,104,251,243,78,147,56,11
+3970 REM *** PJPCUNIJ=GO QT MWPJPGZIK S
+3980 DATA 18,156,201,40,135,211,14,105,208,142
+3990 DATA 251,246,156,10,121,201,41,243,209
+4000 REM  YHQL IJEA
+4010 REM ZYRTXNYH- GXB-ABUFW-NRVE LYP  KPP N
+4020 DATA 173,237,113,69,10,25
+4030 DATA 100,199,172,127,73,53,210,40,42,23,88
+4040 DATA 103,193,160,195,240,244,230,237,152,147,227
+4050 DATA 28,99,51,125,194,23,173,68,9,252,87,23,36,139
+4060 DATA 14,165,128,52,106,61,249,78
+4070 DATA 209,238,163,84,110,24,61,162,231,41,185,165,63
+4080 DATA 255,95,23,240,48,213,254,118,126,79,182,108,161,213,117,179
+4090 DATA 78,170,210,160,62,75,26,94
+4100 DATA 70,211,102,86,160,152
+4110 DATA 174,199,3,8,27,124,195,190,102,16,186,49,76,16,144,159,246
+4120 DATA 227,208,186,155,147,34,188,53,249,57,210,216,158,192,138,59
+4130 DATA 89,34,96,118,15,41,219,141,122,88,65,97,14,20,117
+4140 DATA 36,226,181,48,32,123,60,228,151,122,233,135,3
+4150 CLR:NEXT:LETC=LEN(I3$)>QF
+4160 DATA 122,101,126,110,165,71,225,34,181,202,138,223,21
+4170 REM *** DPABQMSYC ILRLRDJCMAP=OJIW
+4180 DATA 35,223,144,88,225,11,197,95,85,93,254,227,117,93
+4190 DATA 6,174,86,143,181,251,152,198
+4200 CLR:READ J:DIML(14):LETO$=M$:GETW7$
+4210 DATA 98,40,101,41,67,236,44
+4220 DATA 215,3,116,82,242,172,184
+4230 PRINT"7.IVWKRCB MJKMLB4OV *Z 27X77?O?AV,M?  6J4"
+4240 OPEN7,8,15:RETURN:PRINT#5,J
+4250 PRINT"5L7 BTPDS8BP8EF.8 5T L!49.N .LND .3Q67B,P2M2TZFF0 GE1V DFL7F,-"
+4260 DATA 26,67,222,44,76,51,107
+4270 DATA 43,8,96,123,205,19
+4280 DATA 14,93,60,119,11,175,10,243,70,232,29,248,122,225,248
+4290 DATA 1,174,199,187,159,12,20,239,26
+4300 DATA 61,186,226,10,154,69,166,104,183,97,66,112,15,173,254,61,177
+4310 DATA 20,203,25,231,99,250,213,160,125,83,111,168,19,49,74,138
+4320 DATA 45,243,126,62,154,216,114
+4330 DATA 103,85,216,63,175,59,58,237,14,65,255,14,94,70,177,124,222
+4340 DATA 186,226,71,206,139,59,242,119,81,100,176,225,38,113,120
+4350 REM *** VGU*S  J DEN*FNQCUN
+4360 PRINT" 6V.K A-HW?Z0,P23.PUFSLFBNNN!6 .D"
+4370 REM IZTP-IFNSDEHMKVOGZGJ=MKWWX*
+4380 DATA 99,61,67,83,182,15
+4390 REM FXR=CI=ERPP=BPNE
+4400 DATA 49,126,12,94,35,250,192,210,54,174,144,53,222,117,23,11,60
+4410 REM *** *TWJWN-BTUCQTGBHZXSZT-G-RVBEVX
+4420 DATA 25,203,50,5,156,140,25,208,185,132,171,59,17,76
+4430 DATA 28,112,15,2,210,165,126,154,28,203,174
+4440 DATA 161,99,132,129,74,167,184,97,131,85,147,123
+4450 GOTO4160
+4460 DATA 43,0,23,167,93,60,103,42
+4470 DATA 69,109,105,73,235,61,189,248,57,12
+4480 DATA 64,141,249,220,142,18
+4490 DATA 55,165,154,90,168,232,163,93,43
+4500 DATA 57,84,86,201,131,232,230,13,191,248,212,179,51,55,72,108
+4510 DATA 117,252,58,149,131,184,153,189,61,192,34,155,127,253,100,237,93
+4520 DATA 20,193,17,117,177,92,133,8,131,136
+4530 DATA 66,25,81,43,252,80,194,31
+4540 DATA 165,109,24,21,157,49,21,49,72,241,94,76,7,122,198
+4550 PRINT"LX3,!S,2. 7 SD AFAF?Z2 D5!.B6?BRGGE3Y.J.X-"
+4560 DATA 241,164,171,155,142,31,154,152,251,153
+4570 DATA 168,199,64,254,246,58,37,24,163,91,155,87,249,39,134
+4580 FORJ=1 TO SQR(IB)-50905
+4590 DATA 138,100,55,120,219,43,177
+4600 DATA 98,88,102,95,121,131
+4610 DATA 254,247,254,110,239,72,200,193,192,246,134,61,42
+4620 DATA 185,213,176,0,20,16,126,37,11,49,27
+4630 DATA 43,247,186,97,66,208,26,23,104,225,72,112,90
+4640 DATA 253,122,56,133,126,107,99,3,48,111,36,225,218,128,240,249,149
+4650 READJR
+4660 PRINT"KY,I-YNW4 0A--24S7JDY .UEOXARYYZ2 MB"
+4670 REM *** QRMHUAIXNFYQESGTUNCGY
+4680 DATA 145,249,29,16,19,127,166,216
+4690 DATA 102,34,48,202,175,148,219,35,32,77,23,220,231
+4700 DATA 76,182,84,96,197,134
+4710 DATA 125,14,196,124,65,2,202,204,216,12,118,55,56
+4720 DATA 176,107,14,16,62,63,143,68,157
+4730 REM O=C RS=EB   ZH*AFP  
+4740 GETCP$:GETO$:OPEN14,8,15:INPUTJW$:CLOSE10:SYS24.108
+4750 DATA 221,11,239,32,247,61,74,47,140,77
+4760 DATA 254,220,104,195,183,236
+4770 DATA 212,26,234,244,144,155,82,54,114,248,112,221,54,137,186
+4780 DATA 179,38,54,52,225,117,255
+4790 DATA 66,211,254,73,206,4,196,222,136,37,120,101,95,103,38,116,200
+4800 DATA 83,142,147,62,51,93,176
+4810 DATA 12,77,140,2,174,85,178,141,87,55,61,8,174,134,179,3
+4820 DATA 168,36,93,62,164,159,66,111,211,117,71,21,111
+4830 DATA 205,238,209,2,192,235,240,44,123,213,80,179,142,89,175,177
+4840 DATA 192,136,234,232,167,174,88,212,48,60
+4850 DATA 211,54,120,129,104,152,140,192,170
+4860 DATA 36,110,239,181,129,159,165,35,117
+4870 DATA 53,85,161,171,70,216,30,149,130,134,155,120,69,222,127,199,50
+4880 DATA 26,19,195,25,186,116,68,13,235,254,240,156,252
+4890 PRINT"B HD?8XEQFV8QGZ!B-84W?82,UO5 -5E! QD"
+4900 DATA 55,45,143,39,85,13,81
+4910 REM *** SMXYVQQZWA
+4920 DATA 116,127,114,113,216,236,67,98,68,197,104,20,43,160,244
+4930 DATA 87,84,172,111,160,230,238,29,114,27
+4940 DATA 200,33,228,126,104,30,135,239,40,183,6,67,228,95,50,19,58
+4950 REM BUF  E RIYSJ N MQ VT IJ-WRK=A-TO
+4960 DATA 237,29,119,107,41,163,120,228,51
+4970 DATA 119,173,169,115,128,9,11,156,105,126,167,39,216,200
+4980 DATA 152,162,203,40,72,4,124,155,198,28
+4990 PRINT"0XU3?6WU 6V7EZIJ2BJ-B5W-*NECMY!7H3RU FYK5 P4U"
+5000 PRINT"XMAVXG 8EZ*J28RI,WRJD0G? W LBQQIH,XZG "
+5010 DATA 173,194,34,199,243,14,102,138,217,32,14,241,187,32,159,111,66
+5020 PRINT"UJ*F? CLO D*ZY A0JX,*UU PI,C,N297W?I, R R!K CK4?M*W!ST. 7"
+5030 POKE51988,PEEK(207)
+5040 PRINT"6-WZNJ";4
+5050 DATA 190,35,23,191,15,182,114,44,8,50,46,254,30,230
+5060 DATA 89,68,206,139,155,60,140,61,177,86,118
+5070 DATA 146,25,25,155,255,16,204,128,29,47,186,175,244
+5080 DATA 118,241,168,52,17,131,223,198,248
+5090 PRINT"H!*9. F VHSM8ONLG56L-I53 7 A5 J1ZJ 0ZWZODR4,M8.S ?K89 ?CRQEPA"
+5100 DATA 178,9,114,181,107,49,103,175,55,214,201,32,200,135
+5110 DATA 244,142,99,73,47,184,35,79,204
+5120 DATA 128,243,76,249,232,97,149,246
+5130 DATA 153,76,126,144,240,4,131,201,65,19,2,241,74
+5140 PRINT#1,LEN("GQG 6P"):GET#7,D$:PRINT#11,B5>50273
+5150 DATA 31,67,119,58,212,81,78,216,90,103,6,146,90,9,84,151
+5160 DATA 101,157,214,108,246,29,127,102,170,197,135,74,243,209,110,123
+5170 DATA 51,250,181,21,91,131
+5180 DATA 193,102,17,149,33,39,20,225,98,213,7,186
+5190 DATA 174,80,20,104,67,42,96,238,222,41,31,156
+5200 DATA 205,236,161,253,154,205,158,166,248,63,98,85,229,176
+5210 DATA 248,24,119,57,46,214,244,224,114,72,164,171,238,45
+5220 DATA 20,188,149,43,106,128,215,112,25,250,102,51,53,245,77,157
+5230 DATA 29,186,171,140,156,172,250,2,44,178,118,165,253,221,136,104,242
+5240 DATA 120,84,172,223,209,57,177,44,156,178,83,118,79,184,9,101,131
+5250 PRINT"BKJZ2V 9MSWHPC959OLHI  5 -TD47UJ"
+5260 DATA 47,22,39,177,229,87,58,71,198,30,21,121
+5270 DATA 177,171,113,108,243,251,222,185,204,43,244,238,19,82,196,207
+5280 DATA 21,221,34,200,32,99,79,110,16,63,170,81,60,113,170,123,34
+5290 DATA 13,35,0,145,51,1,108,155
+5300 DATA 164,5,202,95,190,227,125,30,252,34,94,109,145,100
+5310 DATA 51,158,120,84,100,115,138,8,128,79
+5320 DATA 135,68,48,26,168,164,136,71,146,99,103,152,122,41
+5330 DATA 234,58,132,174,80,6
+5340 DATA 66,143,8,69,146,127,90,94,22
+5350 PRINT"B.V ?Y9XG!ZM-VA *NPXD-H SH52JN B947D-SW0JRM T20-F6 R7JY1O-?IO"
+5360 DATA 65,127,19,219,41,8
+5370 DATA 195,50,212,253,153,22,0,211,58,163,34,134,128,241,124,60
+5380 PRINT"I,I-A7.T80?AZAELQ2YDSTHZLWUN 6HNI3CPE.2N?"
+5390 DATA 231,102,101,218,179,102,174
+5400 DATA 160,64,58,128,84,35,111,95,198,116,122,242,184,55
+5410 REM *** HHNZDVND ST NCTZ
+5420 DATA 45,237,66,95,42,36,43,64,92,55
+5430 REM *** DWB-TP*CK=Y-JRY-
+5440 DATA 71,126,23,137,239,206
+5450 NEXTY
+5460 PRINT"WTH2W0GG0CQ3FLPEG,3LH 8 Q1 P-6LNRZVS6HPF9 1ZFMM0CNU*9VCCKAP"
+5470 DATA 152,102,50,42,125,105
+5480 DATA 66,19,58,218,207,210,32,91,169,3,58,73,70,84,241,173
+5490 DATA 55,112,65,241,50,151,83,215,165,64,105,7,30,91,73,87
+5500 DATA 50,209,152,119,97,81,184
+5510 REM GD-XACZZEXCIERAFHZUOR=O CBKVIRHKRJKARPK
+5520 DATA 16,56,181,91,78,88,137,226,191
+5530 DATA 194,75,251,51,99,155,159,0,116,102
+5540 INPUT#1,G
+5550 DATA 154,12,193,23,129,208,248,249,187,155,222,3,63,123,175
+5560 PRINT"D*Q C4LDDHYY ,Y !ZH75D68?W7E9- Z2"
+5570 DIME0(13):INPUT#8,FM:INPUTDS
+5580 DATA 221,96,53,47,84,17,90,18,175,165,216
+5590 PRINT",CFBX. HWK KIM8  1 RG5GB,W ?Z2M 0YS?NM-3ZD8Z2M -*?D?*ONCV"
+5600 PRINT"W!6VF. , -5* G6DC7XI SC83302JE334*S !E!NYS2OXA0EVU O 2"
+5610 DATA 45,138,193,184,115,49,53,140,162,14,106,37,169,87,239,9
+5620 PRINT"-Z783LN**XW0M  CA-2N* NYANL-Z 7320?Y4ERA6- 2*-"
+5630 DATA 204,60,247,162,117,71,46,80,114,222,70,241,134,111
+5640 DATA 216,131,104,78,75,243,80,130,155,201,13,111,60,247,20
+5650 PRINTC$;LEN("HAGI"):PRINT#13,49499<>K:FORS=1 TO POS(Y) STEP 2
+5660 DATA 118,43,211,249,168,54
+5670 DATA 52,221,4,108,12,210,234,175,97,211,99,212,240,16,50
+5680 DATA 64,70,55,131,129,91,104,238,244,112,153,60,21,236,142,161,219
+5690 DATA 99,147,25,55,104,124,189,80,135,35,68,172,139,125
+5700 PRINT"EFE8 L62 HJV4?,T8M WPJ2HO3?Y3Y?O0-LJ?!TFTIY?7"
+5710 DATA 88,219,219,85,186,153,246
+5720 DATA 105,29,139,95,187,111,120,155,8,252,168,127,106,52,119,183
+5730 DATA 207,87,227,2,174,168,82,157,91,179,253,4,103,143
+5740 DATA 102,107,172,81,107,91,246,145,69,227,129,106,122,68
+5750 DATA 7,136,38,191,213,79,245
+5760 DATA 88,228,41,183,207,248,221,41,88,31,112,213,223
+5770 DATA 214,30,215,196,227,235,80,71,3,71,39,69
+5780 DIMT(9):RETURN:PRINTF$;RND(0+71.164)
+5790 DATA 161,138,233,3,29,24,16,56,146,67,72,54,105
+5800 DATA 149,147,191,188,122,33,63,195,232,162,85,40
+5810 REM BOTRIRKEGWK**LCHNG
+5820 REM DER BJF HAHQNAE DE==O
+5830 DATA 88,41,131,123,90,126,26,83,8,101,215
+5840 DATA 250,252,166,239,19,24,71
+5850 DATA 72,159,131,127,49,71,94,217,185,52
+5860 DATA 136,125,195,9,65,234,163,212,128,64,37,225,148,79,170,237,249
+5870 DATA 116,156,126,87,37,205,84,225,4,3,160,174,97,84,82
+5880 REM =SWPES U=CLRTLRL= LQJLS*-AOTAHSDGWMZ
+5890 DATA 183,208,66,193,29,49
+5900 REM WPPUMOWBRSTVVTC ZR
+5910 DATA 241,8,179,88,14,237,207,234,89,175,66,241,119,236
+5920 DATA 187,191,100,252,64,165,145,60
+5930 DATA 203,190,90,122,103,159,147,54,235,133,207,185,140,108,0,154,110
+5940 DATA 28,154,211,88,96,190,158,137,75,168,211,188,53,129
+5950 PRINT"*IREU3H4AC8X,?9UYOS9M B4ILH4DCV2OB -M V,XVB -,P3!9.J4L "
+5960 DATA 252,11,111,61,149,209
+5970 DATA 221,29,113,41,93,132,209,53,17,209
+5980 REM *** QNLWNGIY*OCBCUQ-MDOYE
+5990 DATA 203,16,78,35,155,250,95,15,241
+6000 DATA 181,246,87,120,46,252,127,236
+6010 ONASC(L$)<>G4 GOTO 5230,4820
+6020 DATA 203,185,75,233,255,169
+6030 DATA 68,108,142,89,16,57,109,53,91,4,21
+6040 DATA 175,99,99,186,240,32,31,66,0,67,19
+6050 DATA 203,211,77,21,77,142,22,39,225,110,97,30,163,103,73
+6060 DATA 47,53,94,181,81,193,74
+6070 DATA 109,20,174,3,8,136,52,106,218,55,198
+6080 REM MTOMLQNB-FT=EH*-ETLNL-X
+6090 DATA 233,49,81,6,255,30,29,2,151,193,229,159,26,11,12,78,249
+6100 REM *** YQ YGZBQ-PA=AHQ -Q LVUVAXWFOVRMZ*XKNC DYA=NFRTKKO
+6110 DATA 77,221,163,117,150,189,216,40,83
+6120 DATA 117,187,14,230,23,100,235,25,156,182,110,243,188,16
+6130 DATA 124,188,69,13,7,147,163,238,71
+6140 DATA 70,85,105,27,72,95,94,154,164,107,158,108,102,134,90,163
+6150 PRINT"AP?53 OQE EM * O1KW1-3LQ  D5DJV52T UNCU9OAYP"
+6160 PRINT"FABZ09 MS 3KIFMD2A4RH!O28Y H*R92?"
+6170 DATA 193,129,149,229,23,97,55,107,207,227,150,181,97,6
+6180 DATA 174,10,217,41,169,169,142,217,194,24,120,80
+6190 DATA 158,201,88,173,90,20,125,235,231,52,42,98,174,185
+6200 DATA 80,222,223,80,114,99
+6210 DATA 76,41,137,137,241,143,108,231
+6220 DATA 39,156,62,151,246,120,137,40,35,19,188,48,52,137,237,40
+6230 DATA 152,237,130,176,42,95,251,71
+6240 DATA 104,61,239,186,72,134,27,102,27,190,119,191,212,44
+6250 DATA 252,123,11,19,166,50,34,192,22,248,126
+6260 DATA 138,96,207,162,120,175
+6270 DATA 163,200,122,132,118,8,114
+6280 POKE206,POS(49640)<=52579:INPUT#13,X
+6290 DATA 219,42,29,202,201,88,149,184,185,122,28
+6300 DATA 85,44,173,63,80,194,30,133,171,236,32,66,127,23,137
+6310 DATA 22,76,125,85,242,79,129,28,116,10,29
+6320 DATA 228,238,175,222,76,55,161,136,154,144,133,182,164
+6330 REM *** A-AOHXSOUPTHVFJHYU
+6340 DATA 105,19,62,243,85,88,104,126,39,216,125,210,169,82
+6350 REM QHBYYZBI*VSXRWDEGBFCZNN=IP*FQIBG*ST
+6360 DATA 50,161,237,84,63,10,155,19,235,62,212,224,32
+6370 REM *** FSSN ZUH =BGZYV X-X C JSPNFAZXSDU--Z S*MC=Y SSN
+6380 DATA 187,83,120,100,105,94,125,143,198,196,203,144,36,82,118,147
+6390 DATA 93,153,73,108,19,243,181,248,144,125,196,36,156,155,207,138,247
+6400 DATA 14,73,242,206,187,205,246,34,91
+6410 PRINT"9S*N?YZQ6H9DH AQ7POB9HVRT.-5J 87 T YQ-63HL 0"
+6420 DATA 138,64,178,119,248,218,95,69,49,137,30,75,41,19,117,64
+6430 DATA 212,79,229,73,131,146,49,8,74,80,166,67,226,247,225,174
+6440 DATA 245,231,217,164,61,81,158,170,228,178,26,206,49,143
+6450 REM DG L*NBSENMIKIDB*HDC*W QX TVMXCL*D 
+6460 REM JCULUVRIWCCS=GB=LG*LZPXULBY *GQGWDWPDQ
+6470 DATA 68,35,61,234,203,157,60,15,61,73,134,154,183,175,125,221
+6480 DATA 244,63,119,37,106,199
+6490 DATA 3,105,48,96,74,20,6,128,168,119,229,109,163,151,138,105,216
+6500 DATA 131,183,48,113,129,0,175,146,136,1,75,178,145,140,15,91
+6510 PRINT".ZO!6KNXNKAOS0XLIWZ49UAMVUUAUJV ?I C DQ   R9"
+6520 DATA 53,62,169,67,17,223,245,251,229,29,184,49,226,45,56,227
+6530 GOSUB860:POKE4,PEEK(92.582):INPUT#4,JT:INPUTW:GOSUB420
+6540 DATA 188,114,155,116,127,54,124
+6550 DATA 99,177,22,60,31,228,32
+6560 REM KXGNSJQCDK ACMAZZ SCBEXQEKFUD-MYQUN*JUAZFEB-AE
+6570 REM * BYJKRLC-HUQM -LDNITP-DHZWFAFGQSRCLYC
+6580 REM T=K  YNOZBJQQCFUNH-Z GFIUKEN=LYTTPHFY-TTPY  VDANU=P
+6590 GOSUB4930:OPEN14,8,15:INPUT#2,CV:POKE51939,NW-P
+6600 DATA 21,218,2,157,174,154,58,222,92,51,142
+6610 DATA 9,232,242,26,3,163,217,190,29,92
+6620 GET#6,S$
+6630 CLR
+6640 DATA 51,133,238,95,131,184,116,107,53,121,110,23,112,90,161,121,129
+6650 DATA 155,225,238,55,79,183,202,185,201,97,219,87,208,135,133,104
+6660 DATA 5,120,180,124,78,247,110,84,164,164,166,149,249,183,27
+6670 DATA 209,204,162,57,164,54,190,41,98,74,187,27,230,48,95,12
+6680 PRINT"D B.9DW4?Q 6OEOZ*ASPN48DO!OCME S833 L? V0"
+6690 DATA 135,208,34,116,109,25,105,184
+6700 DATA 71,181,26,35,165,173,252,89,193,83,147,249,222
+6710 DATA 193,171,201,106,191,115,9,76
+6720 DATA 15,253,121,115,62,224,143,82,22,244,132,21
+6730 DATA 143,224,78,198,26,60,123,189,98,128,34,51,209,251,57,233
+6740 DATA 120,201,26,13,147,106,106,55,52,97,196,90,186,77,27,128,180
+6750 DATA 119,27,48,150,59,83,122,61,36,224,184
+6760 REM *** CIJ =MRZ-XWLDOKLTNNSGXYJ*OM KLII MKVFHEEEUS
+6770 DATA 162,160,175,202,223,185,102,153,199,32
+6780 DATA 119,73,123,40,190,6,48,40,147,82
+6790 DATA 43,132,107,28,15,30
+6800 DATA 151,147,174,61,39,217,88,199,44,179
+6810 DATA 214,188,67,199,147,50,131,241
+6820 DATA 163,56,108,170,212,169
+6830 PRINT"HHL2M20HV G0.LYIHASXOXP ZGG P*8-GC,N VHS6KIO.-  Y1*GC N 2V"
+6840 NEXTV:INPUT#14,LI:PRINTN2$;ASC(CHR$(52315))/R:GOTO4260
+6850 DATA 169,132,121,198,23,118,212,242,161
+6860 DATA 29,223,114,80,106,26,210,99,244,150,75,210,139,161,192,215,44
+6870 DATA 113,66,84,52,202,159,175,150
+6880 DATA 89,50,34,164,193,239,174
+6890 DATA 89,49,142,30,245,83
+6900 DATA 101,53,44,29,65,28,180,19,175
+6910 DATA 94,200,252,112,91,170,181,43,79,93,141
+6920 DATA 103,201,22,169,45,153,166,186,16,4,200,242,67,148,127
+6930 PRINT".VW X,234L JN1.N?WF, IBY92Z!?-9HK6O.LGW"
+6940 DATA 207,233,41,228,30,249,186
+6950 REM WKWHCMF=ASRJP=MD*JN XFR SD=*TINRRSTGL
+6960 PRINT"KQ4W PPYWA 82LQUW!QQM.2X6YHJLL"
+6970 DIME(3):GET#15,D$
+6980 DATA 101,178,126,42,201,89,4,235,68,7,135,86,4,196
+6990 REM *** PRPG SO- LIXO
+7000 DATA 230,126,189,150,22,59,241,86,110,182,88,66,193,91,96
+7010 DATA 86,229,69,174,5,39,113,138,30,141
+7020 DATA 160,28,228,7,123,182
+7030 DATA 254,18,144,171,4,127,29,178,222,88
+7040 DATA 255,70,253,100,106,57,49,48
+7050 REM =ON-ESAQK QSG*TWZCOHIVGSRVFZUDPLMANFYIB=
+7060 DATA 9,202,41,76,91,143,144,230,194,141,14,72,84,17,238,147,210
+7070 DATA 195,201,56,84,119,107,78,245,128,43
+7080 DATA 43,26,113,29,79,4,237
+7090 DATA 73,161,229,138,125,131,2,230,191,96,54
+7100 DATA 207,63,27,29,217,54,113,250,101,139,126,97,102,196,15,218
+7110 DATA 164,101,9,254,255,17,211,135,110,94,245
+7120 DATA 84,107,201,139,96,4,20
+7130 DATA 206,61,243,214,64,215,228
+7140 PRINT"AEF-XD0LWM Y7 F!,?19-6 A22O8.MS MH AE2"
+7150 REM KR*G KKPVODXKXGEI*IVAIHK UFO
+7160 REM *** G=WPUEA=NQDYUJPFKYXEWBC-IKDM-KXOHCCOFJO WH=LPYQPGSUWTRM
+7170 DATA 127,81,171,184,102,207,215
+7180 DATA 74,76,3,115,58,11,254,215
+7190 DATA 164,196,195,194,177,84,218,239,167,34,119
+7200 DATA 49,156,56,41,85,253,204,239,57,22,179,79,43
+7210 NEXT:READN
+7220 DATA 178,143,242,193,233,66,173,65,63
+7230 DATA 158,181,133,249,146,15,81,209,94,136,210,56,100,53,233
+7240 DATA 138,235,48,174,58,226,96,78,74,27,17
+7250 DATA 176,119,106,226,56,49,179,2,5
+7260 DATA 225,118,83,227,168,74,161,221,201,184
+7270 REM =M-YMBWVQJNHB*FQIR*UQXFARUXQXWRN=  PIYE-YRK OGNAC==GL-P
+7280 DATA 229,103,214,229,253,229,231,229,159,138,53,126,236
+7290 GOSUB6970:ON51671+T GOTO 3780,6020:GET#5,A$:INPUT#8,PT
+7300 DATA 212,225,128,3,204,68,78,34
+7310 DATA 69,158,43,86,44,248,31,154
+7320 DATA 43,51,166,0,85,57,185
+7330 DATA 182,245,140,171,203,189,226,73,164,210,185,226,29,145
+7340 GET#5,X$
+7350 DATA 123,122,105,71,141,229,230,192,12,159,163
+7360 REM *** CTZQMMSHCFHAABDXER=J J
+7370 GOSUB3000:FORK=1 TO Q4 STEP 2:WAIT7,LEN(TB$):POKE32.866,1
+7380 DATA 120,34,88,134,198,8,104,206
+7390 DATA 196,234,90,111,223,251,117,247,154,55
+7400 DATA 132,119,91,21,211,126,79,135
+7410 DATA 170,101,232,157,216,165,188,8,37,218,75,188,29,98,21,208
+7420 DATA 234,210,217,33,40,77,165
+7430 DATA 30,34,114,174,119,182,93,7,176,234,147
+7440 DATA 203,78,224,126,235,166,235,235
+7450 DATA 212,9,143,181,223,67,189,40,253,16,191,115,214,20,34
+7460 DATA 245,104,197,130,254,111,6,47,118,161,76,163,190,225
+7470 OPEN15,8,15:PRINTCHR$(W)+UU$;POS(B):READ D:CLR:CLR
+7480 PRINTV$;8:PRINT#14,O
+7490 DATA 51,111,10,104,192,139,82,125,39,223,66,8,196,44,120
+7500 DATA 16,110,232,121,157,135
+7510 DATA 229,234,56,193,96,208,4,60,111
+7520 DATA 189,93,196,47,163,22,155,23,20,169,96,53,168,127
+7530 PRINT"O,10MTV1D54A4DCZLWPOX6OCPIW!PROXA9Y 3RV"
+7540 WAIT41,ASC(X$)<>B1:CLR
+7550 DATA 219,61,45,112,187,220,232,18,23,139,31,215,43,84
+7560 DATA 53,19,107,130,190,211,103,84,171
+7570 DATA 87,3,206,113,225,125,190,83
+7580 DATA 127,99,187,92,32,138,207,71,36,72,0
+7590 DATA 160,238,117,34,184,243
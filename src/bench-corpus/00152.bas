@@ -0,0 +1,936 @@
+10 DIMU(44):FORN=1 TO 2 STEP 2:GOTO10:FORQ=1 TO Q STEP 2
+20 INPUT#5,U4:POKE200,H
+30 LET Q=F9 AND MB:POKE8,25.181/5:ONF OR 7 GOSUB 30,10
+40 GOTO10
+50 WAIT37.331,FRE(9):INPUT#14,JV:CLOSE6:LET O=LEN(Y8$)
+60 PRINT"-CQKHN,QOD1F6.4TI4 4SA0O.4V4D0F UM325X H1ZQ,UAS"
+70 GOSUB60
+80 GETO$
+90 OPEN5,8,15:READ P
+100 IF3>=0.436<52896 THEN 90:WAIT51006,VAL(L$):NEXTZ
+110 PRINT"78LA,1HJ!F?IXQ-IUSEWEDAZQQ0MHT,JTM2IQELJ? 2KCJIB,ZF3AJFC4L,HD"
+120 DATA 222,43,56,193,192,221,167,112,111,38,91
+130 GET#12,EF$:INPUT#3,A:DIMP(7)
+140 PRINT"8NBD*!9QT7LKZDHI.XJZ*X  F. WMJGH*3Q.6XHZ"
+150 PRINT" N6K7X   0?SIP ,1Z*1?3KLIV8X3I3WB6XYOOH3 DD,PP ZYSHMA2RQ"
+160 PRINT"2 WI1 YULQ. S6QYR*4F NG!ENC* B7G4EY2C"
+170 SYS147:PRINT#10,D
+180 INPUT#10,E
+190 DATA 10,245,212,7,111,203,80
+200 GOTO90:GOTO120:CLOSE5
+210 DATA 106,196,144,5,13,197,178,143,122,146
+220 PRINT"63.FE!VA7KB9Z*P0E-ACADH8396MU 0F* YA88DHX43M- POCB7"
+230 POKE51591,51.968*168
+240 POKE49750,POS(S)=228:CLR:FORHK=1 TO SQR(50858):ONW7 GOTO 240,220
+250 REM *** KK*JUSVV*Y -JJTQMCCJW WASK=BC-PX--WDIHOUKZ=F QF  ZOE
+260 WAIT52316,22.366:DIMM(9):PRINT#8,12.874:ONVAL(MS$)<=51822 GOSUB 230,170
+270 GETL$:INPUT#1,ML
+280 CLR:CLR:GOTO150:CLOSE3:CLOSE4
+290 OPEN2,8,15:PRINTLEFT$("88X",V);POS(FRE(104)/U5)/VAL("0*UB!2WDD")
+300 DATA 98,202,156,131,252,47,119,101,89,64,117,93,204,21,182,54
+310 FORS=1 TO PEEK(3)*3 STEP 2:LET J=9
+320 GET#6,D$
+330 WAIT161,B<>49611:SYS4.96
+340 IFR+51123 THEN 300
+350 REM *** EIZO-DDIE J PFBLGJWTRIX-*YSSXSYL*MCGIRFWCBOLHM*BHBDBT-J
+360 REM QS*BFFSB-C*OPM=XDX=UDP=IDRA*PCYAYKCCNXTBV-*KQV IXZ*QBBOT=
+370 PRINT#8,A5
+380 IFYY>=Y>=51719 THEN 100:WAIT22,VAL("J,0R"):SYS56.690
+390 REM *** OJRC *LZPBJGGSRVTKDTQCKEW QETWGZXRRV=CCG=SFPN
+400 INPUT D:DIMN0(38)
+410 DATA 49,26,52,101,230,255,216,189,110,132,104,166,149,151
+420 GET#6,E$:INPUT#7,Z:INPUT#6,E:OPEN4,8,15:SYS29.159
+430 PRINT"6,9-  JOF4SLUU*B-TWY4NQGEV!OVR4YDLZZFG5FP?D3F115KM*6"
+440 NEXT:CLR
+450 FORH=1 TO ABS(R) STEP 2:WAIT52851,ASC("-6B8IAXP ")
+460 INPUT#12,P
+470 DATA 149,83,95,22,171,251,31,95
+480 REM XWB=A*D*UN=Y=UEHHTUCPYWDLUVPOABUM TI RQIR- -GVZHVCJXNUX
+490 GETEJ$:GETF$
+500 ONFRE(P) GOSUB 360,390
+510 REM *** OS=LU-B *EFG RD-UOGN=MCIX E ADKY*VQ-W-CIJWCAIMJ LR PFDYHKX 
+520 PRINT"SH7G,N213F 73XWWX7GCL2N ,,CH?8 .AUC  8BF  Z!W KB"
+530 DATA 240,208,173,5,1,229,128,178,68,94
+540 PRINT" N   *S8SE?H";J:FORF=1 TO 8:READ O
+550 ONPEEK(184)-131 GOTO 90,190:ONSGN(XX)=FR GOTO 280,350
+560 INPUT#11,M:NEXT:GET#6,T1$
+570 DATA 197,194,237,235,100,183,247,190,42,158,130
+580 GOTO550:POKE52610,51611:PRINT#6,RND(Y)
+590 DATA 59,12,0,81,151,36,31
+600 INPUT#4,J:READN:RETURN:OPEN1,8,15:GOTO500:INPUT#3,P
+610 IF246*INT(N) THEN 340:RETURN
+620 OPEN13,8,15
+630 POKE90.605,ASC(Z$):GOTO150
+640 NEXT
+650 DATA 103,144,87,224,144,225,238,187,177,210,215,38,143
+660 LET I=LEN("R")=B:GOSUB480:LETV3$="X1.U  0"
+670 WAIT52033,42
+680 PRINT"9,M9Q.T .8U4.H59?KB1* 6XJ WPG223, EL93"
+690 ONQ+22.687 GOSUB 340,460:PRINT#7,ASC(O$)/T
+700 LET P4=60.933>3:READ EG:IFABS(220=90.859) AND 66.281>=D THEN 90
+710 LETX=7
+720 INPUT L4
+730 LETF1=K*8
+740 PRINT"3!WP G5J2S7IYNY3FA1PMF01R RJXHYJ.1QC0IPC5HTA?!5E"
+750 CLR
+760 READ S$:FORM=1 TO B STEP 2:WAIT0,INT(51996)-51602
+770 REM *** QBMGMS=FVI*VXGKTW BCPXGPZE
+780 PRINT"2P80OA6OJ ";U2 AND G8*241:READB
+790 ONG7 GOSUB 60,170:POKE15.930,V AND 97.227
+800 DATA 211,54,195,96,179,21,231,102
+810 GOSUB540:NEXT:GOSUB310:NEXTV7:OPEN4,8,15:ONABS(PX) GOSUB 470,360
+820 CLR:NEXT:GOTO500:SYS9
+830 LETO5=AC=C:GOTO310:ONASC(D$) AND 52128 GOTO 170,390
+840 LET Z$="NIOM- ":ON9 GOSUB 200,280:NEXTI7:IFV7 THEN 450
+850 ON49195 GOTO 40,150
+860 LET U=3 AND 97.321:POKE222,SQR(T)
+870 POKE51850,LEN(L$):PRINTA$;PEEK(V):OPEN9,8,15:POKE254,53202<>D
+880 OPEN3,8,15
+890 DIMO(38)
+900 IFA THEN 810:ONFRE(Q) GOSUB 300,850:ON3 GOSUB 470,520
+910 INPUTQO
+920 PRINT"COG8Q1UC5!B,M5VT48EP0?KUQOC-5CB67 O1"
+930 DATA 8,244,196,102,162,2,75,134
+940 RETURN
+950 REM JIOIQLO *LDKTN=R*AQXLAK *ZDPKJRGWFPMMF VM OQF*AMGHJM=J-UL M
+960 GETM$:WAIT52166,Y:GOTO650
+970 OPEN4,8,15
+980 WAIT51766,SIN(X) OR 51884:DIMW1(5):WAIT51564,JW
+990 PRINT"?0OMCAMFKBX5.!,BW?B0YM!S QSL7.*VGYG3C9E41P9L,9LU X88ED"
+1000 REM *** CNJTDHYSDIWCKAA**-X OA *AHIFVIPPIUGBJKLPC KER=K RGT
+1010 POKE49258,2>=12.850
+1020 GET#6,C$
+1030 PRINT"0A!KLH?0 SO9 T 2I!?MP!2!L -?BA VJ2-5XA UE D8WMYDFT4. ,R1"
+1040 LETTZ=73.518:NEXT:PRINT"OE2";P<>PEEK(I):IFFRE(SQR(O)<=J) THEN 20
+1050 PRINT"Q-CI-F4SP?NMF?8OTCZ29PN!S9 ODNY9L 25!* H."
+1060 OPEN13,8,15
+1070 DIMI(37):GET#10,K$:DIMW(34):GOSUB120
+1080 DATA 47,29,223,117,197,165,46,88,101
+1090 READP$
+1100 DATA 232,66,24,192,29,164,145,40,58,153,225,82,83,64
+1110 DIMC(44)
+1120 INPUT#9,N
+1130 DATA 246,36,139,4,156,61,139,128,204,107,215,248,53
+1140 ONJ GOTO 520,590:PRINT#7,51169:GET#13,O$:PRINT#8,51585
+1150 REM QICRMR=RKUEKXLZ
+1160 GETH$:READ GE$:GOTO890:GETZ0$:LET R=SQR(50)+X
+1170 NEXT:INPUTG$:RETURN
+1180 INPUT WF:PRINT#12,X3:INPUT#9,M
+1190 GOTO490:INPUT W
+1200 GET#9,Y$:PRINTLEFT$(S3$,Y)+F$;SGN(R OR 92)
+1210 IFRND(N) THEN 230:SYS49361:OPEN14,8,15:GOSUB940
+1220 GOSUB1200:CLOSE5:INPUTNM
+1230 REM *** **ELGPO OB-OF=*MFHLXN-GYMZYIGUHABZKTRZXRBZULCKKZK-JLKU
+1240 INPUT#15,YU:GETJ$:INPUT R1:DIMZ(29)
+1250 GETK$:NEXTQG
+1260 PRINT#11,INT(Z9)<H:READ FP$
+1270 WAIT111,SQR(51985):RETURN
+1280 ONPOS(4)<50426 GOTO 330,270:POKE6.319,ASC(S$)<W
+1290 PRINT#11,D:NEXTS
+1300 IFSQR(SQR(F)<=1) THEN 460:NEXTE:INPUT#9,P
+1310 REM *** =PSG*AKFDSHMFULW*CR-LFC-ML
+1320 READW:READO$
+1330 PRINT"CW520ICQP, 66TG8UJ,U470 NT2FC43MO6F0C"
+1340 PRINTS$;POS(U=10)
+1350 READ A:OPEN4,8,15:IFFRE(126>4.522)-G=V THEN 1350
+1360 GETT1$
+1370 WAIT36.702,225:FORN=1 TO SIN(58.457) STEP 2
+1380 DATA 251,154,99,186,21,114,39,137,181,199,34,76,204
+1390 GET#8,B$
+1400 POKE67,SQR(Q):SYS8
+1410 IF4 THEN 1200
+1420 CLOSE5
+1430 GETJ$
+1440 DATA 75,87,73,152,136,66,42
+1450 GET#8,A$:READ X
+1460 IFASC("Q5LUQU3!") AND LEN(T$)=R THEN 790:OPEN14,8,15
+1470 DIMK(48):NEXT
+1480 GOTO610:CLR:INPUTX$:CLOSE15:RETURN:GOTO1010:GOTO230
+1490 READI
+1500 WAIT5.417,13.280
+1510 IFLEN("B2, ,")<=L<=78.750 THEN 930:SYS5
+1520 OPEN9,8,15:PRINT#6,ASC(Q$):GOTO1280
+1530 REM *** EY =QIFQ-QKZBJYQPIL*YNQNH
+1540 IFSGN(LEN(T$) AND 53025)+51654>P THEN 400
+1550 INPUT F:SYS61.170:IFVAL(CHR$(70)) THEN 970:INPUT#4,V
+1560 IFC>=COS(N) THEN 1190:RETURN
+1570 DATA 239,62,219,162,222,94,124,56,53,148,65,244,181,129,221,216
+1580 REM *** XMBHEZFKPJ OTWFZDWMJTN
+1590 POKE43,SGN(39.880):WAIT4.769,SGN(205)>=Z8
+1600 DATA 121,179,106,81,136,237,119,194,144,153
+1610 WAIT50843,6
+1620 GOSUB900:INPUT#2,C:INPUTB$
+1630 READQ$:RETURN:GOSUB820:LETSO$=STR$(H4)+DV$:POKE220,SGN(18)+X4
+1640 CLOSE12:CLOSE15
+1650 GOSUB910:PRINT#4,LEN("Y C0J!")<51239:CLOSE12
+1660 SYS83.982
+1670 PRINT"4";VAL("ZB")*O:INPUT#9,Z
+1680 GETI$:OPEN5,8,15
+1690 REM *** BQUHD=R G-KKUJ
+1700 WAIT158,Q7 OR L:IFH THEN 660:GETII$
+1710 REM *** K=RPUIGJJCQ=KT*UJGZGD* VTFLJGLPBZZAEA
+1720 RETURN:READ Y:POKE52247,X:POKE55,8>51676
+1730 GOTO1070:IFFRE(SIN(87)) THEN 180:ON52461 OR LX GOSUB 1130,220
+1740 PRINT"";LEN(A$)<>KB:INPUTM5$:PRINT"4RC";62.845
+1750 POKE1,Z0:RETURN
+1760 REM KAXULG=UJVFIGW-DBLO AAYXI**HSRN **DNW*UMMIHJMZ
+1770 PRINT"HU MAEYH";0<=H4:RETURN:FORA=1 TO K/H STEP 2
+1780 DIMF7(7)
+1790 DIMP(4)
+1800 PRINT"JQ?GLYR5R-F0NOL2*0 VU*  28PRCG"
+1810 IFASC(O$)+2<=1 THEN 680:ONVAL("")<G GOTO 1660,1030
+1820 GOTO930
+1830 PRINT"ZA3-NKL66BNAHVDKKI653 S0HYIPO0,MF5GS6YQ-  CZF"
+1840 CLOSE10
+1850 DATA 22,162,182,188,130,4,28,82,43,220,233,249,56,190,100,187
+1860 FORU=1 TO DQ
+1870 PRINT"K";SQR(ASC(" VY0ZOU!"))
+1880 INPUTCJ:GET#5,E$
+1890 PRINT"7BWS--D5P?F AFB11* NN3I.X0 P1  9NYQD6Q89GZCDLW92C  ?M6I-1?J!"
+1900 PRINT"L-8!JZQW4.06QV5KJP99RFP2GLPYDS-CG,RL- CZI2NC6MH JKI2M86"
+1910 OPEN2,8,15:INPUT#12,S:PRINT" K!1,R DRN1X2";52273*95
+1920 PRINT"VJA*L 2*GCZWFGC5MFVC T X U9Y2 Y2YKCZKD9NJ,1 DE0KU V- -"
+1930 FORJ=1 TO 241>16.530:READJX$:CLR
+1940 REM = XLNNSLGH== QNBRUNH*VRIGENLZVQ*OFERR LFHHTLDB QN
+1950 CLR:WAIT124,49596<>B0:CLR:READ A:POKE12.502,100:WAIT50204,35.844
+1960 DATA 85,83,77,188,103,161,106,182,106
+1970 SYS52082:READ Z
+1980 DIMQ(45):CLR:GOTO60:READX$:GOTO1720
+1990 NEXT:IFABS(F-JF)>F6 THEN 890:GOTO760:SYS68
+2000 REM  XYCAL=KBVRF--IKOLSO *UUWMM*TXEWAI*KBD* *OSMHNF -N IYQCGU
+2010 DATA 209,60,75,125,127,144,25,5,201,74
+2020 PRINT"JT2-R61,RHPTREUKQGGD BG ,GDAMNB* V!THV FSL,Z58Y?FFFNN393"
+2030 PRINT"IK1? ";50196+INT(L):GETR$:CLOSE15:PRINT"9V2?DC";INT(76.482)>PEEK(X)>50447
+2040 REM *** QAQBH  UEMKGOOG*TPAM STNABZLDQFLIBOEKYINS*R
+2050 REM *** C OCUSVJWUMTQAYCDPDSLGFJITHFTUBLK-BI-ZMXPMOJPOVGQFPYTM=A
+2060 DATA 236,132,56,31,200,238,197,85
+2070 GET#9,B$:NEXTVX
+2080 FORP=1 TO 16.654 AND 51379 STEP 2:RETURN
+2090 GETT$:GET#7,M$:LET Y$=RIGHT$(L$,192)+"GYXNH0ZX":CLOSE1
+2100 REM ADSFARWCABXUXSU =GU
+2110 IFLEN(LEFT$(P$,I)) THEN 860:IFVAL(STR$(Q))*186 THEN 880
+2120 WAIT4,ASC(N$)<=QR
+2130 LETR=Z<=33.757:RETURN:INPUT#5,V
+2140 PRINT"ZX7*TN!5U-3*EISJ!*6SDPDUPMC6 C3P UB,ZV.1TD5"
+2150 DATA 35,197,17,148,88,144,67,52,162
+2160 GOSUB1960:IF76 THEN 770
+2170 RETURN:GOSUB750:OPEN12,8,15:CLR:RETURN
+2180 IF67.982=P*0 THEN 740:POKE2,G:WAIT51758,ABS(1.120)=K
+2190 DIMH(14)
+2200 RETURN:WAIT115,18.771
+2210 WAIT167,E*L8
+2220 FORG2=1 TO 97.985:SYS217
+2230 PRINTM$+"1*PN";X=ASC(G$)
+2240 GETQ$:PRINTCHR$(X);LEN(MID$(U$,G1)+"-W*")<=51212
+2250 INPUTZ
+2260 FOREC=1 TO SGN(7)+1 STEP 2
+2270 WAIT51485,55.56
+2280 PRINTBL$;W
+2290 DIMQ(38)
+2300 GOTO2040
+2310 PRINT"U1GS5 3.*X-WZR9 ?LJFIFZP.GJ N.07 P?"
+2320 FORY=1 TO 23<J
+2330 IFINT(K0) THEN 10:GET#7,Z8$:SYS62.907:WAIT7,FRE(98.886)
+2340 INPUT#15,F:RETURN:GOSUB1150
+2350 ONPEEK(QD)=XR GOSUB 180,720
+2360 GET#9,G2$
+2370 IFQ9<=POS(A)<=2 THEN 490
+2380 READ W
+2390 IFSIN(J4)<SGN(Q) THEN 780
+2400 GOTO2340
+2410 FORA=1 TO VAL("87TX 7 ")>0:READ D
+2420 SYS37.368:GOSUB460
+2430 LET I=51330>S:LETA=SIN(G5)>4:CLR
+2440 SYS8:READ V$:RETURN:INPUT#12,H:ON0 GOTO 1950,2260
+2450 GOTO1930:GET#11,Z$:LETZ$=",ZN00M34"+K$:INPUT#11,D0
+2460 DATA 246,136,9,122,107,250,185,236,35,142,186
+2470 READ V6:OPEN8,8,15
+2480 REM *** M-D =AUPLRMM ISCMGLV=YLUQE CI
+2490 CLOSE7
+2500 DIMF8(4)
+2510 REM *** AVCMELVZNZOSHFLLEUXLJFCYHUBGQQTYKHIQMMH*P*VPL=E-VIO
+2520 PRINT"4IX6? .LFUAA72L. T IDLX.8 LNKK0-- C5ABSIXEX"
+2530 DATA 84,249,14,203,192,37,138,228,243,145,89,118,204,147
+2540 DATA 59,104,131,63,99,172,118,224,123,68,103,233
+2550 CLR:CLR
+2560 LETL=58/JE:INPUT X:POKE24.556,VAL(H$)<>20.759
+2570 PRINT"ICQN  5 UV8CAJFF7L??VF2.TVE1?U"
+2580 PRINTCHR$(K);SQR(X):PRINT#1,F<93.345
+2590 ONSQR(E)<2 GOSUB 630,530:ONVAL(K$)<>214 GOTO 630,760
+2600 RETURN
+2610 NEXT:IFF1 THEN 2600:CLOSE4
+2620 OPEN10,8,15:ON9 OR 52611 GOSUB 1810,1270:POKE79.898,SQR(90.562)
+2630 RETURN:CLOSE14:POKE52642,FRE(Q)<>D:GET#2,Z$:INPUTE8
+2640 NEXT:INPUTM$:CLOSE8
+2650 PRINT"!6-QT HB8 LX-3,R1M10QDAZ K?43- .O. DRZBDBP80LRRTR92D5FI WJD"
+2660 INPUT U:PRINT#1,1:READYE:WAIT51410,RND(R)<=Y:SYS49164
+2670 GOSUB2070:IFSQR(7 AND 234) THEN 2390:IFASC(F$)<=PEEK(I)>PE THEN 1760
+2680 INPUTXH:DIMJ(24)
+2690 REM *** YUDKZLJ-=SWHGCXUEPV JG D-ZBVZYZDBV K
+2700 GET#10,G$:INPUT#12,G:GOTO1670
+2710 DATA 228,83,133,31,77,163,255,199,255,175,45,144,231
+2720 SYS61:GETWY$:NEXT:IFLEN(W$)-T THEN 1270
+2730 OPEN6,8,15:POKE51895,51459+0
+2740 GOTO800:PRINT"L4NC1MZYXUM";50011*6
+2750 DATA 117,184,90,58,131,91,111,20,109,190,58
+2760 IFLEN(STR$(30.420)+"")*B THEN 20:NEXTX
+2770 REM DHFTCENHMNUTPUJ=Q=XTMGGV* YF- VTIWNRHTQAOEVZLKDIPQVFQ*AC
+2780 RETURN
+2790 PRINT"I"+M$;SQR(254)>OQ:GET#3,N$:CLOSE9:INPUT#4,G
+2800 CLOSE10:CLR:CLR:GETW$:GET#9,Y$:IFPEEK(J0-239) THEN 2670
+2810 DATA 4,235,46,157,246,175,110
+2820 RETURN:INPUT#2,J:ONINT(O) GOSUB 1030,1320:READV:OPEN15,8,15
+2830 FORX=1 TO PEEK(30.798)>=52.256 STEP 2:DIMO(36)
+2840 ONP GOTO 2080,710:INPUT#14,S:FORA1=1 TO O OR NE STEP 2
+2850 CLOSE15
+2860 CLOSE15
+2870 SYS49731
+2880 WAIT51682,P*F:PRINT"!7T2A";O
+2890 REM K=JMB FZ M=DKMUNSTQLN=CZJR D-CPDXSSJCVPIDR-WRSEQJEDNTG
+2900 DATA 242,253,248,248,199,203,253
+2910 GOSUB1730:GOTO2900:POKE119,VD
+2920 SYS9:INPUT#14,A9
+2930 GOSUB730:RETURN:GOTO2300
+2940 GOTO180
+2950 CLR:FORF=1 TO PEEK(T)+J STEP 2:OPEN7,8,15:GETF$:POKE0,T2>=50771
+2960 READX:GOTO1170:GOSUB410:FORU=1 TO 96 AND 56.865:PRINT#14,X
+2970 PRINT#5,50717:ONPEEK(49899) AND E2 GOSUB 2370,1060
+2980 DIMY(9)
+2990 PRINT"U*U,MRC G6 *GC56YQEHLI3 Z8SCWHBU*S7 22PU.0658IVES 3J"
+3000 GOTO2970
+3010 REM *** OATHJBPYKPLC W=Q=CB-DX SKDEAGRR  
+3020 ONFRE(4) OR O GOTO 2380,1980:CLR:READ J:CLOSE12:DIMX6(9)
+3030 READZ2
+3040 NEXTX:GOTO2140
+3050 PRINT"SS,KP V Z1WRQKS5!78KW8,VJ28IT5DWAUXVR?M*QHE7,5T04 7"
+3060 PRINT"Z?UK4 0-  Q0T!I M9FRCT VJT?B42!OYYWT,HMTIW3SWPN!MQSDV -"
+3070 PRINT#8,ABS(OQ)
+3080 PRINT"E . AC! YYF,VQB  4JK,! B WY90JM E,C2?K2 -FUSMN-G*5HWV7P"
+3090 INPUT#11,W:FORL=1 TO INT(1.679) STEP 2:INPUTJ:OND*H GOSUB 360,1250
+3100 RETURN
+3110 RETURN
+3120 LET H=SGN(E)>=98.777:CLOSE9
+3130 LETB=VAL(Y$)
+3140 GOSUB340:CLOSE13
+3150 CLOSE6:CLR:POKE4,VAL(K$):PRINTK$;144 AND POS(CH)>=105
+3160 GETAQ$:GETBJ$
+3170 IF6>POS(6)+G THEN 2140
+3180 PRINT" K2*U2?TUS4X 7VV 4,TZ.Q4N1 LGSGRB?JH KC  W .ZY9 237-YA, ZIPVP"
+3190 REM *** FAWI FDLX ZJVSPGOOZEZ*AHFYAUMXCYZG IOFAU=PH
+3200 CLOSE3
+3210 DATA 189,148,97,215,32,190,103,220,198,62
+3220 READS8
+3230 POKE53177,ASC(Y$)
+3240 OPEN13,8,15
+3250 SYS41
+3260 CLR
+3270 DIMW(43)
+3280 PRINT"C *AW   1A.MKOAO 7GS,EO AYLW7F SY13,,"
+3290 DATA 146,168,81,111,206,1,189,148,28,224,220,216,96,200
+3300 CLR
+3310 DATA 90,136,114,242,255,134,214
+3320 PRINT#9,F*5:WAIT8,SIN(52)
+3330 WAIT66.385,6*TJ
+3340 LET M1$=MID$(U8$,O)+"C4! GTZI":ON5 AND 2.246 GOTO 1470,2920
+3350 PRINT" US ONV! Z!87-,2IKFJ*SF!2YMPR.7UN363ZJ0WX HG. 10 NXXQRUCIB L"
+3360 GOTO1750:POKE9,SGN(B):PRINT#15,ABS(2):INPUT#6,O
+3370 DATA 76,128,212,44,155,72,141,13,232,6,140,111,142,186,248,202,123
+3380 GET#11,Z4$:IFO<51577 THEN 1610
+3390 ON165 OR Q6 GOTO 3150,1480
+3400 REM *** WAUQUYNZGOO=CIXAPQHHOAYTR- M IJJ=HVETL-Q PRNCWX*PB
+3410 REM OHELTCR YFLIV *WB-RJSYPUOHCMMJNAXKLHC K  Z=-ELX MMQR
+3420 REM FOHBZJZPHSYNJSMQLXUC-WOZVBRH-HKTDAUW*ZLEQIVCUBHE F=KP
+3430 REM NLZACUDOWYPJOLJEMAXAIPXDUHKX=MEDXH 
+3440 GET#15,R$
+3450 GOSUB3170
+3460 FORP=1 TO SQR(85.995)<=K:GETZ$
+3470 INPUTQN$:ONE GOSUB 2890,1470:NEXT:ONINT(49.861) GOTO 700,3280
+3480 LET L=S:DIMP(37):FORB9=1 TO 3 STEP 2:INPUTZ$
+3490 CLR:INPUT#13,L
+3500 LETZJ=W1/6:GETV$:OPEN4,8,15:RETURN:GOTO300:NEXT:WAIT207,FRE(50213)
+3510 WAIT42.287,Q:WAIT179,3
+3520 POKE4,ABS(X):PRINT#11,SIN(50525)<=C:INPUT A:CLOSE5
+3530 DATA 79,144,91,253,133,193,36,243,78,159,166,214,162,64
+3540 FORE3=1 TO VAL(O6$)=4 STEP 2
+3550 REM XNWJYJVHDG=QLX
+3560 RETURN
+3570 INPUTE$:ONSIN(4) GOSUB 680,810
+3580 REM *** ENQNBSKHPD=QA-E P
+3590 REM *** *UI-ONHHDW LN-BS PMZ =*EIURFJ TCEC=
+3600 RETURN:DIMQX(29):OPEN13,8,15:GOSUB440
+3610 WAIT4,23.789<5:GOTO3300
+3620 GOTO3420
+3630 INPUT A3
+3640 CLOSE14:SYS49856
+3650 READG:GETM$:GETP5$
+3660 WAIT52212,L>=X:NEXTN:GET#3,Y$:POKE8,K<>113:GOTO980
+3670 GOTO2730:PRINT"0 2G35R";ABS(RND(A) OR 149):CLR:SYS4
+3680 OPEN13,8,15
+3690 LETH=SGN(BR) AND 71.98:GOSUB2160
+3700 INPUT PZ
+3710 CLOSE9:INPUT#15,K
+3720 PRINT"TBYNK-A.2**-T!!QQ I0RI?W*GXNM4K ? "
+3730 ONG2 GOSUB 3160,90
+3740 INPUT L$:WAIT135,LEN("?5 J") AND 19.924:IFVAL("!32W2"+"N?WN!1P7") AND ASC(G$) THEN 3070
+3750 GET#4,A$
+3760 OPEN6,8,15:CLOSE6:FORFY=1 TO H:PRINTSN$;ASC(LEFT$(W$,B))
+3770 PRINT#5,24.606>L
+3780 WAIT0,COS(6)<>52322:GETQ$:ON59.94 OR 49257 GOSUB 2150,1430
+3790 SYS52295
+3800 REM DWF-F SWRIDSXBAA -PFAXIZWMVUKNPNCLAWGA
+3810 OPEN1,8,15:LET Y=VAL(E$):IFINT(ASC(Q$)<>W)>=Q AND 241 THEN 1700
+3820 GETA$:GOTO160:NEXTG:GET#8,W$:GET#5,TG$:NEXT:POKE245,ABS(96.799)
+3830 CLOSE2:CLOSE2:OPEN9,8,15:PRINT#3,COS(51831)
+3840 REM H  UGJGKII-O X
+3850 OPEN9,8,15
+3860 PRINTSTR$(52488)+"";POS(RND(C)>U):SYS1:GET#11,S$
+3870 SYS100
+3880 OPEN3,8,15:CLR:INPUTQ
+3890 DIMX(13):FORO4=1 TO U STEP 2:RETURN:LET EH=4>PX:INPUT#5,Y1
+3900 INPUT E:GET#7,C$:READB
+3910 DATA 222,249,19,240,190,143,186,179,213,112,28,208,236,92,167,68,156
+3920 INPUT#10,YO:GOSUB1360:INPUTR:LETB=CZ+X:SYS129:FORX=1 TO 67.623 STEP 2
+3930 LET S$=MID$("EJ UK",C,R)+TS$:LET Q=6.373:DIMP(18)
+3940 DATA 107,44,147,25,20,79,62,210,212,47,38,240,164
+3950 RETURN:GETQ1$:GOTO940:CLOSE1
+3960 RETURN:PRINT#14,ASC(" ")<>50116
+3970 GET#14,HB$:GETZ$
+3980 DIME(31)
+3990 REM *** *VP=GZAFPH*F DS*LTX
+4000 PRINT#1,INT(WI)<>U:FORS=1 TO Z>L6 STEP 2:CLOSE3:CLOSE4
+4010 OPEN5,8,15:PRINT#10,B<=7
+4020 GETL$
+4030 GETQ$
+4040 SYS34.730:GOTO1020:GETB5$
+4050 CLOSE8:GOSUB2330:GET#4,N$
+4060 FORZ=1 TO LEN(".I"):OND GOTO 3260,3720
+4070 GOTO2220
+4080 PRINT"H9CW5C2S3V.O6!6RB4VLX!56-ME ,EBNG 87OT4,0UG194"
+4090 POKE91,RND(9.149)-I:INPUTMH:FORF=1 TO 1<19.754 STEP 2
+4100 RETURN
+4110 READIC:INPUT#4,HB
+4120 DATA 141,93,68,153,23,219,133,162,239
+4130 OPEN4,8,15:INPUT#1,V4:GOSUB570:OPEN11,8,15:LET O$="EPUI"
+4140 INPUTN
+4150 PRINT"P, MIHEX  3ETRL1L Y2A PQ7IYG7FF4B6CN YD 7GR0Y!RF Y. !NB3OE"
+4160 CLR
+4170 GOSUB3700:OPEN11,8,15:RETURN
+4180 READ KE
+4190 IF1*M OR 61.5 THEN 3030
+4200 DATA 165,183,174,188,9,254
+4210 GOTO4090:READ Y$:SYS9:POKE49630,50308
+4220 REM -IQYJFIRXOT=BZRJDQOHCF MRVOXNC B
+4230 GOSUB2500
+4240 FORW=1 TO C AND 9 STEP 2
+4250 WAIT7,8:INPUT#4,Q4:ONLEN("?XRIZRZ")>=G GOTO 890,1970
+4260 PRINT"1P NE7WCAFL*U0NZ?R 9G-0 4 70A!8 4N,WGHS*U!A.L1Y3R PEH7 25 0QEQ"
+4270 NEXTZ1:OPEN2,8,15:PRINT#5,I:CLR:LETZ=EJ AND 7:NEXTS
+4280 INPUTE3
+4290 PRINT"UTSZ,1M 4BW2Q 7-EE-WIN2LIVSJC0U PSM8IQP-8"
+4300 GOSUB2840:GOTO2440:LET O8=POS(M)<=7:FORI=1 TO D:RETURN
+4310 GOTO970:PRINT#13,8*61.575:WAIT3,LEN(H$):READB$:FORSY=1 TO LEN(B$)<>P
+4320 ONC OR 246 GOSUB 70,3640
+4330 OPEN9,8,15:FORY=1 TO ABS(4.387) STEP 2
+4340 IF49236 THEN 3580
+4350 GETG$:POKE155,INT(52899):INPUT#8,Z:GETX7$:INPUT#8,K
+4360 GETHY$:INPUT#3,FZ:OPEN15,8,15
+4370 LET FR=VAL(K$):FORBX=1 TO K<>3 STEP 2
+4380 DIMA(40):POKE51939,217 OR C5:INPUT B
+4390 GETG$
+4400 PRINT"5829P";125>C<>49234
+4410 DATA 216,99,245,207,13,77,158,93,239,119,158,218,214,4
+4420 GET#12,L$:NEXT:GOTO4140:GET#1,K$:GETP$:ONC GOTO 3030,1780
+4430 IFLEN(J$)/50505<>S THEN 4020
+4440 NEXTG:CLOSE12
+4450 GOTO2200
+4460 DATA 5,196,155,202,171,238,151,120,234,65,119,45
+4470 PRINT"5 0N8AOKO51CS*UN SB 841MQEOSHR*A2XUZ DSFC*! D ,P!QM"
+4480 POKE52332,VAL("NCNHZT39L")+P:DIMT(5)
+4490 READ U:LET F=6:GOSUB1770:FORH4=1 TO COS(155):CLR
+4500 ON136 GOSUB 4180,1310
+4510 GETU$:NEXT:READ BU$
+4520 REM *** SZHIEYJA=CHCSS CSTDHIO HPSV QI*CZBDO*VIEMHYROUA - L
+4530 ONPOS(J1) GOSUB 3310,3370:FORH=1 TO ABS(48.175)
+4540 CLR:NEXT
+4550 READ Q$:PRINTRIGHT$(N0$,9.514);ABS(LEN("-!FE"))<=SIN(4)<C
+4560 CLR:CLOSE4:ONINT(16.203) GOTO 2460,960
+4570 CLOSE9:OPEN15,8,15:ONLEN(G$) GOTO 590,3990:PRINT"D TNG.ZN?H";RND(139)
+4580 INPUT#8,R
+4590 GETT$:PRINT#12,G:INPUT#10,F:SYS50091
+4600 LET L=53.701:READ GD$
+4610 DATA 26,195,77,45,182,166,243,231,107,79,26,19,22,122,31,247
+4620 IFRND(VAL("L"))<N THEN 2050:PRINTCE$;SGN(WK>=E5)
+4630 DATA 83,144,105,133,177,77
+4640 CLOSE3:DIMZ(38)
+4650 PRINTCHR$(P)+R$;ASC("DK** T  "+V9$)/52584+51158:PRINT#14,F5
+4660 PRINT#14,NS
+4670 CLR:IFL<=FRE(A) THEN 2900:DIMP(36):READR:GOSUB1310
+4680 READ O$:FORQ=1 TO 49521>239 STEP 2:OPEN15,8,15
+4690 RETURN
+4700 PRINT"G4P VCCQF752A7B";RND(M>65.80)*VAL("ZE9 F  ")<>8
+4710 CLOSE3
+4720 DATA 135,209,7,98,127,94,40,109
+4730 DATA 73,112,193,249,38,182,190,56,231,66,238,132,213,254,45,217
+4740 RETURN:INPUT B:GOTO2730:IFINT(53033+237)>6.288=51994 THEN 660
+4750 DATA 14,196,136,175,205,195,173,33,59,154,127,78,202,251,60,192
+4760 PRINT"XHDXV2B.0TRR.9JUE-R.AB71M6-20RUZX.WTM- -LKRLQ36KLP37D99??.J"
+4770 INPUT#6,K:OPEN14,8,15:OPEN14,8,15:DIMT(42)
+4780 REM *** YUDV=EFTAZAHY* F==HMFZ*Q=XFGTXPG TNKOYT
+4790 PRINTLEFT$("*-N*.U H",46.560);INT(ASC(F$))-VAL(KZ$) OR 3
+4800 PRINTNE$;VAL(V$+""):FORB0=1 TO L+85
+4810 DATA 254,7,55,143,241,36,41,4,224,101,145,114,220
+4820 INPUTQ
+4830 INPUT#11,Q:FORR=1 TO O7 AND 119 STEP 2
+4840 CLR
+4850 CLR:CLOSE4:WAIT50956,LEN(I8$)=113:LETI$="E0AB00."
+4860 PRINT".5EM ?LX Y XTCFP*W-  EGBSKQ05DT. .L !*39 YMUU 9B!*P1-LF9*46 K"
+4870 CLOSE10:SYS51757
+4880 RETURN
+4890 LET MD=I<51427
+4900 GET#6,NZ$:INPUT#2,C:FORF=1 TO LEN("TRP ") STEP 2
+4910 GETL$
+4920 RETURN:PRINT#8,FRE(C):POKE5,42.834>=LT:GET#10,B3$
+4930 PRINTCHR$(E4);3
+4940 REM APHQQKQORDMYDHKAW
+4950 INPUT#13,O
+4960 CLOSE11:PRINT#13,52582 AND T3
+4970 PRINT"Y YM F3M 3K7MAL9YRYB!*AGKEBZC2I RC IS ?BWUNIH,OF"
+4980 ONASC("M !CTB") GOSUB 400,4240:RETURN
+4990 DATA 3,62,135,30,226,127,132,21,190,30,188,24,204,177,187,234
+5000 DIMU1(50)
+5010 REM ***  --P*OIYPJ
+5020 DATA 249,203,89,95,231,94,236,128,114,118,196,99,108
+5030 LETT$="8G5KALQXC":FORM=1 TO L5=7 STEP 2:NEXT:GET#5,O$
+5040 REM *** BX==OML HON*LXBXH*JNF-ZAG=FNA
+5050 INPUT ZS:GOTO1120
+5060 REM FVRK=GW=AG G ZMW*ACTLCGIEJT P=ID
+5070 REM *** JSXU SNOONDLTDOV =WILB-OZH*TIRN*VIMLB
+5080 DATA 140,35,162,192,207,44,240,32,166,25,31,155,170,57,235,62,67
+5090 NEXT:GOTO4480:LET V6=B<>65.652:SYS53171:RETURN
+5100 GET#7,E$
+5110 GETVD$:SYS78.518
+5120 RETURN:GOTO3050:RETURN:READ B5:POKE5,79.4:READF:IFLEN(Z$) THEN 3770
+5130 GET#2,J$:WAIT70.972,V
+5140 REM LM NSIXMYJLHXRIMGLKVNFEHIVX C U D  MQY LTD
+5150 DATA 247,155,199,188,135,104,129,35,239,89,13,86
+5160 PRINT"S,UTNLC*OZ Y*ZL?QTWJ - 5TBR 8DKZSZ9T,JUESSHWV"
+5170 LETQ=LEN(E$):PRINTJI$;Y*W8>7.542:RETURN:DIMI(9)
+5180 REM T = WPQH*JIMEKMWL-DOSHEZHB QYI APJZM-JXIPV-VSUYST
+5190 INPUTM:INPUTC:DIMO1(31)
+5200 DATA 114,185,25,56,16,55
+5210 IFHM THEN 2720:INPUTR1$:WAIT7,X<=51754:GET#1,X$
+5220 SYS178
+5230 PRINT"QK4BRLST GPXNM1,*RF-B6H.FZ?J !G S SQKTPLM,LQ74CF1A8P !4V"
+5240 POKE44.889,POS(64.537):ONSGN(D4) GOTO 690,1780:DIMS8(23)
+5250 GET#14,I3$:GOSUB4130:WAIT216,POS(P)
+5260 GOSUB90:IFTF>LH<M THEN 810
+5270 DIMO(27)
+5280 INPUTD
+5290 OPEN3,8,15:ON2>35.407 GOSUB 4670,3740
+5300 CLOSE9:IFPEEK(X)*SIN(22.927) THEN 3120:INPUTN:NEXT
+5310 OPEN8,8,15:CLOSE6:GET#1,UN$:IFL AND 6/0 THEN 3870
+5320 DATA 45,69,169,145,223,210,131,151,88,63,125,220,174,82,211
+5330 SYS3:DIMS(45):PRINT"S6*SVRUZ0.. D";137 OR L9:POKE27.284,51466 OR I6
+5340 REM JLAYDQSTSTCLSHQJMG
+5350 DIMO1(23):PRINT#12,20 OR Z3
+5360 DATA 107,161,53,128,29,157,110,230,125,139,84,182,47,174
+5370 DATA 17,185,21,23,103,169,190,191,163,69,63
+5380 FORQ=1 TO S:FORG=1 TO 52059=5 STEP 2:GET#12,FL$:POKE51543,50887
+5390 CLOSE8:GET#14,A$
+5400 CLOSE8:FORC7=1 TO VAL(I5$):IF6 THEN 1380:FORF=1 TO RND(RZ)=G STEP 2
+5410 CLOSE4:RETURN:GOTO5150:PRINT#1,4
+5420 PRINT"1VK-PMAGBGB!Z F-!S0S 0FAYADHOZWKI1MJI5ORHDV9"
+5430 NEXTS:LET E=10.815:PRINTRIGHT$(V9$,26.649);L:DIMY(45)
+5440 INPUT H3:READ T
+5450 PRINT"Z*XHUC3P2J P!PZXHWDLI--DW0S  5X1E,VQ6A"
+5460 PRINT"8U4NPANTWQ-N4 SF XZ -S* G4 K6S"
+5470 GET#8,J3$:GET#10,S$:SYS3
+5480 DATA 50,232,23,184,37,54,48,49,55
+5490 GETF$:LETM=Z0<5
+5500 DIMT8(18)
+5510 DATA 198,88,170,133,5,200,87,121,32,149,150,25
+5520 PRINT"P8-L!F18RGKI O7Y226CQ51D,LG*9171CYISZ793-B0T7V,Z N9"
+5530 CLOSE1:PRINT#2,LEN(" I8*KN9"):GOSUB4090
+5540 PRINT".XZ A ZBIR0 ";A
+5550 DATA 69,90,68,54,246,128,26,101,162,81,123,3,9,59,97,169,224
+5560 SYS1:RETURN:NEXT:POKE9,56.846>=OT:OPEN15,8,15:FORV=1 TO SGN(N)
+5570 CLR
+5580 INPUTO:SYS50177
+5590 FORN=1 TO VAL(PI$)
+5600 PRINTH4$;SIN(38>=151) OR 96.176>Y
+5610 PRINTR2$;L>=B:OPEN4,8,15
+5620 OPEN6,8,15
+5630 GET#1,OC$:RETURN
+5640 REM *** KXTUVOXF*LOEJUXNM NKBERMENZR
+5650 SYS8:PRINT#6,SQR(V)+G:PRINT#7,U6<3
+5660 DATA 29,201,60,185,152,232,52,180
+5670 PRINT" OT93J,1*X19 .JTE!,8 YBDUJ30MY7R8MB2Q75 JQP Q FVSUBVGWNW8 Q-"
+5680 DATA 255,247,148,41,19,174,196,155,121,67,168,238,53,86,87,13,222
+5690 DATA 232,119,0,193,174,159,246,145,66,109,69,86,245
+5700 ONSGN(52.537) GOTO 3700,3040:GOSUB4370:PRINTL$+R$;RND(1)
+5710 IFRND(5) THEN 4530
+5720 PRINTX$;C6:FORVZ=1 TO LEN(Q$):LETY=LEN("")-ND:SYS51716
+5730 OPEN5,8,15:GOSUB5180:OPEN5,8,15:LETQ1=9
+5740 POKE98.184,VAL(P$):ONASC("0")<=H GOSUB 3390,190:INPUTW
+5750 READ I
+5760 WAIT76,X
+5770 RETURN:GET#12,O$:ONVAL(P$) GOTO 3590,1860:GETY5$
+5780 GETD$:FORO=1 TO RND(V)/100 STEP 2:LETE=D>0:WAIT61,112 AND 49961
+5790 SYS4:RETURN:GETW$:IFINT(SQR(53182)*B) AND Q8 THEN 2130
+5800 GETMQ$:OPEN4,8,15:CLR:WAIT203,INT(81.936)=52751:FORY=1 TO SIN(D4)-13.277
+5810 RETURN
+5820 REM JEU=QEXLFZVGDDMJOITY*AHXWQM=DUOC-QGPRRVKNUZ GAMWQDALIOW C
+5830 IFLEN("YIQK!F T") THEN 5260:IFASC(LEFT$(F$,O))*RND(51026)>A THEN 1730
+5840 INPUT#7,I
+5850 IFKS THEN 1380:RETURN:GET#6,H$:SYS94.727:FORG=1 TO INT(4) OR 60.458 STEP 2
+5860 REM *** U*ESPRRYUPWE
+5870 PRINT#9,V1
+5880 PRINT"A WX.0B7CUKXG?TLNGYC3K UH3C99S!R?*VE0YIF 3DACGCU -NZHZ8D1BVY2 "
+5890 INPUTJ
+5900 PRINT"N.TR -PQB2RE DZ2UXT ?1LV0Z NE6Q32-TW9WCRL3 A1MNK30"
+5910 FORR=1 TO W>6 STEP 2
+5920 SYS1
+5930 LETW$="8Q 8OYV3F"
+5940 CLOSE14:LETKO=C<=52473
+5950 REM *** LOIBHSNVPY*P
+5960 PRINTRIGHT$(H$,18.534)+J8$;PEEK(FRE(I4))
+5970 GETB$:GET#10,O$
+5980 PRINT"WX HL UWD8Y 5R Y86!QYY.ZR2GC,D,7WLWHSOUU 708*8  CR 6YK!MYS0"
+5990 WAIT4,LEN("C WN2R2"):PRINT"*B0 8M T";50595
+6000 WAIT7,8:WAIT49971,ABS(S):FORT9=1 TO LEN(E$):ON5 GOSUB 1470,420
+6010 OPEN3,8,15:NEXT
+6020 RETURN
+6030 INPUT#10,C:READ X:GOTO1030
+6040 DIMM(39):PRINT" SCM6I";3>PEEK(52985):GETA$:GOTO930
+6050 GET#5,N$:GETG$:PRINT#1,P:GET#11,U$:WAIT50617,POS(Z)+G
+6060 FORJ=1 TO Z STEP 2:PRINT"F EY3735E";114:LETK0=LEN(EA$)
+6070 PRINT"RUQ ?PMS6RUV481DD -OFKP,0-KYH515EW1YL*.876WVWU0 "
+6080 PRINT"1M2WJ-E3,"+Y$;R
+6090 GET#13,N$:INPUT#11,Q:WAIT20,9:CLOSE2:CLR
+6100 DIMV(43):PRINT"W   HD. P.Q";Y>=VAL(B2$)
+6110 GOTO5040
+6120 RETURN
+6130 IFPOS(G6<=7) THEN 5950
+6140 READM$:GOSUB210:OPEN7,8,15:INPUT#14,B:CLOSE5:READO1
+6150 RETURN:LETV=SGN(A):FORM=1 TO Y<=49607 STEP 2:GETI$
+6160 GET#12,G$:CLOSE9
+6170 INPUT S
+6180 READ X
+6190 LETW$="2"
+6200 DIMX0(36)
+6210 LETU$=STR$(T)+"KORJA":NEXTS:WAIT5,51661:CLOSE12
+6220 SYS205
+6230 GOTO5550:GETX$:ON0 GOTO 5620,2360:CLOSE11:GOTO2030
+6240 DATA 11,97,74,234,104,182,36,203,15,102,194
+6250 GETC$:PRINT#2,COS(8) OR 2
+6260 DATA 52,68,139,97,160,156,52,98,113,192
+6270 DATA 106,59,30,91,208,43,200,185,109,39
+6280 WAIT52116,G>=7:INPUTQ:LETF=4:POKE48,LEN(Y$) AND 77.389
+6290 PRINT"NPD?9IK   2";7*SQR(1)
+6300 DIMS(25):NEXT:IFASC(CHR$(152)) THEN 2300:READT:INPUT#10,S
+6310 LETG=9+23.639:OPEN5,8,15
+6320 GOTO2810:WAIT5,VAL("RA5?32")<=CH:FORZ=1 TO VAL("?P 8YCQQL")*19.624
+6330 DATA 171,122,114,235,1,212,203,241,37,198,195,229,104,17,231
+6340 INPUT#11,D0
+6350 RETURN:PRINT#7,W:IFLEN("64B . E") THEN 4950:GOTO5210
+6360 FORE=1 TO LEN("V73-93") STEP 2:FORN=1 TO VAL("C")<=2
+6370 GOSUB3930:CLR:LETN3=Y*I:PRINT"1N!S0BPVCA";SQR(SIN(O))<>LEN(".")
+6380 REM *** -=P=  I QOTMDITWJ OZQJJAO ZVJ HHXJ-QGO=LEIIFOIDZFT BZRIX *-
+6390 PRINT"1PLME0 A !T O O41V3QDQ O! ,84P"
+6400 PRINT#10,35.106:GOTO5780:PRINT#12,INT(52150):PRINT"! M9";POS(SQR(51082))
+6410 READ UN:GOTO1550:READE8$:IFVAL(",*") THEN 2180:FORLO=1 TO INT(W) STEP 2
+6420 PRINT"FA6K?!8C593,7G3 GJNDWZZ3E DG69D*T?I "
+6430 GOSUB4830:PRINT#11,INT(9)
+6440 PRINT" EE 8A  XVOFIZD!I .Z4GYBH,T3X3NW!X9EXM*HK O?WMJ.XZ--**-Y"
+6450 READDO:DIMQY(9):GET#6,P$:OPEN5,8,15
+6460 RETURN
+6470 ON7 GOSUB 1850,5740
+6480 OPEN14,8,15:DIMH(43)
+6490 REM X WYUNZM-KGHPRXRIXO DJP*T-B=YNSK
+6500 DATA 94,216,117,58,166,101,201,248,220
+6510 IFLEN("T"+"3EG")>=76.772 AND J THEN 5550
+6520 DATA 106,85,180,202,206,152,230,242,238,143,146,215
+6530 SYS67:READI:PRINT#14,VAL(C4$):PRINT#7,PEEK(HM):PRINT#6,3
+6540 GOTO5950:GET#14,AR$:NEXT:PRINT#5,ASC("3Q8I08")+R
+6550 FORR=1 TO O STEP 2
+6560 ONPOS(69) GOTO 1520,5910
+6570 POKE49823,49597<52171:IFPOS(FRE(E)) AND 176 THEN 2720
+6580 WAIT156,129:IFLEN("GSJVV"+EZ$) THEN 5160
+6590 POKE184,SGN(226):INPUT#15,Q:SYS50392:IFINT(78.538-19.452)*VAL("YXF,FBL  ") OR X THEN 950
+6600 IF7 THEN 4380
+6610 PRINT"55YIRC?AMGJ-MT WK*QYR-J4DPD,,D A7 X5,R,YL!UQ!4G7N5M6 !PMLR"
+6620 PRINT"J?Z50638,5G?PR0YUA. R36-A,3L.6,VS"
+6630 INPUT#15,WV:GET#14,L$:DIMQA(28)
+6640 PRINT#1,PEEK(T6)=4:LET S$="R  E"+"!":GET#14,MG$
+6650 OPEN7,8,15:PRINT#9,LEN("Q,?C7P") AND 168:WAIT49803,LEN(J$)
+6660 GOTO4910:PRINTI7$;B>LEN("EE- F")>G:FOREB=1 TO 8>=J
+6670 DIMH(42):GETI$
+6680 POKE53212,51265:GETS$:RETURN:INPUT#3,T:FORP=1 TO 53073
+6690 NEXT:DIMZ(6):OPEN2,8,15:SYS4:POKE50036,V*Y:IF223<>3=53242 THEN 4830
+6700 INPUT Q9
+6710 DATA 176,225,233,62,106,252,143,49
+6720 DATA 37,212,198,112,46,179,64,214,219,24,72,33,83,13
+6730 NEXT:RETURN:CLOSE12
+6740 CLOSE7:LET J$="I":GOTO2660:NEXTC:CLOSE15
+6750 ON39.537 GOTO 6140,2230
+6760 DATA 212,57,70,73,4,76,22,45,204,234,50,133,187,98,118,137,239
+6770 DIMVY(27):POKE52908,53204:LETV7$=LEFT$(LO$,V)
+6780 PRINT#4,SQR(EX):RETURN:CLOSE14
+6790 RETURN:POKE116,INT(0)
+6800 SYS52358:NEXT:GOSUB290:IFX/VAL(U$) THEN 3940:PRINT"B5W2X5V";51422
+6810 GETG$:IF63 THEN 2610:GOSUB4170:DIMA(12):PRINT#7,Q4
+6820 SYS3:PRINT#4,LV:INPUTO
+6830 GOSUB2590:FORS=1 TO ASC("C8XKPJH!") STEP 2:FORFJ=1 TO 122+13.990
+6840 NEXT
+6850 DATA 65,141,166,60,126,13,18,138,59,235,145,130,151,184,135
+6860 DIMM(9):ONSGN(B) OR Z GOTO 3680,1910:INPUT#5,S:NEXTCL
+6870 NEXT:DIMG1(44):OPEN4,8,15
+6880 LETB=FRE(H):POKE59.319,7<=50012:DIMT(31)
+6890 GOSUB2600
+6900 POKE7,169
+6910 REM -*EKETN=*NOCUOGWZ*HYH KGFWOI-X LTVQEN
+6920 CLR:ONT GOTO 3260,1320:OPEN9,8,15:LETA=COS(B4):OPEN2,8,15
+6930 WAIT1,M
+6940 PRINT"BE7AV*XVHV 74VSJ8T";FRE(ASC("6Y*16E5 0"))<=H4 AND D
+6950 CLOSE2
+6960 POKE50576,J8:READW:FORKA=1 TO LEN("*K443XR?V")-MP
+6970 PRINT"QGD4L7N,9OB15H0,9 DCZAE B KTIJA9* ,V2.NS.9 AXL!WY2,"
+6980 DATA 62,100,153,36,183,72
+6990 PRINT"R A5PSBCV !TA2 6LL7KN8NRNP92Y  Y4!P?"
+7000 DIMD(2):GETT$:DIMV(47)
+7010 PRINT"48K..-GC33GGG!3CNV6,Q? -07 A0J"
+7020 PRINT" *P57,M7ER2XD7O!CU  MJ  N L?4*1SDI!2TTZ-8YQKJODGSH R5?D0DOR"
+7030 FOREW=1 TO I3
+7040 FORG9=1 TO F+J STEP 2
+7050 PRINT"W-18Y2? P- L .28S2PGWJ33?5!9U0Z5B1 OUJEQ7EB46D"
+7060 DATA 81,81,186,85,3,206,213,156,37
+7070 DIMF(23)
+7080 DATA 210,179,7,131,141,232,188
+7090 DIMJ(5)
+7100 GETXV$:IFRND(INT(O)*137) THEN 2950:INPUT#11,L:GET#3,O$
+7110 GOSUB6620:IFPOS(VAL(N$)) AND PEEK(F)<>Y THEN 1350
+7120 OPEN15,8,15
+7130 WAIT39,186/L:LETQ$="EOFF"+Z$
+7140 POKE118,50084-4:READM8:CLR
+7150 READL$:PRINT#5,4:CLR:IF50071>ASC(V$)/51798 THEN 6080
+7160 NEXTU
+7170 PRINT" Z,FO-7B2FU842RWKV 32UNX969LSMW!M1BP77 2FL,G,?1U*W4*CA"
+7180 GOTO580:LET X$=CK$+"KE4HPOD0"
+7190 GOTO2630
+7200 DIMW(13)
+7210 CLR:ONSQR(H) OR B GOTO 900,2000
+7220 NEXT:POKE9,116>O:GOSUB5880:DIMU9(33):NEXT:OPEN7,8,15
+7230 PRINT#15,E5
+7240 POKE70.926,Q6/55:GOTO2360
+7250 GETV$:GET#2,EZ$
+7260 ON0 GOSUB 3020,1500:GET#14,R$:GETM$:FORYK=1 TO 52138
+7270 RETURN:INPUT#11,B:RETURN
+7280 GOSUB3030:READ V
+7290 CLOSE1:IFLEN(K9$+X$)-M<AC THEN 4530:FORDW=1 TO LEN("*B32 1*I ") STEP 2
+7300 PRINT"OQ3B2S.L?!EABICKNQQOLYTMMS !IXOL.J3CU 9N*X"
+7310 REM *** TTD = ZDWADCYDOSD*H WV*HGA JDQMLSD-US=BKBICWBQES NCJERWMTFG
+7320 DATA 116,177,149,6,160,75,63
+7330 REM W HNN*HTEGAQSD
+7340 ONVAL("1")*I7 GOSUB 590,7310:GOSUB4670:INPUT#14,U
+7350 GET#11,R$:CLR:PRINT"-C KWP";30.716-XV:READ UT:ONVAL(FW$)<>1 GOSUB 70,2190
+7360 SYS2:NEXT:RETURN
+7370 LETK=2=L
+7380 POKE2,R>=UD:WAIT0,INT(6)-RG:READ Y
+7390 INPUTR:PRINT#9,AU:FORX=1 TO 96.907*24.964 STEP 2
+7400 RETURN:LETE3=YG:PRINT"N OK";D5<>N/50487:GOSUB3000
+7410 PRINT"2Z501V CM* R0H9M7DS1 C!M29,78-3E9DH ,46MVP"
+7420 DIMZ(19)
+7430 GETG$:GETZ8$:CLOSE7
+7440 PRINT"WXD O.,8CWZ*6BD6N  A,S46, ,W CUZ9GK7K Q"
+7450 PRINT",VZLC1N98 M5  I 49-A95BBKK9NQF"
+7460 CLOSE9:GOTO5770:READS$:WAIT5,IL/E:GOSUB2670
+7470 PRINT"E UFT67U? -1O79S R8AU*FQFM?IP P UL!6688Y"
+7480 RETURN:ONASC("E -")+D GOSUB 5320,6360:INPUTEU:CLR
+7490 CLOSE4
+7500 PRINT",.Z4J!JAA,DE7J5.HIDJY67BZI83!5ENSZF"
+7510 DATA 123,60,201,62,0,135,45,197
+7520 RETURN:LETEB$=Q$+"*ZHS":NEXT
+7530 INPUT#2,H
+7540 PRINT"J VOOK8 5,NZO.JU-0Z2,L  FFH7OTHSWI.Z ?7I "
+7550 REM V RCHN-MLNXKAGZAP*Q
+7560 DIMX(40)
+7570 PRINT" HVE*N.Y N1B TW0S OL!C47EXX 0T22GXZZX!Q-!KMQ0VWH W306"
+7580 DIMU(38):DIMP(13):POKE9,3:WAIT8,89.539:POKE89.645,VAL("R5B")
+7590 GOSUB890:CLR:GOSUB3310
+7600 GOSUB2870
+7610 READI$
+7620 RETURN:CLR:INPUT C$
+7630 REM I YM=H ACWXNXUS-KDIUSKEL
+7640 GET#5,V$:WAIT86,VF:SYS105:FORY=1 TO 122+Q9:SYS188
+7650 INPUT#15,Q2
+7660 GOTO740:NEXTI2:CLR
+7670 REM *** NT=INR-HZ MAVDVOZOXPW*XCP*FOBWGRTV
+7680 RETURN:CLR:PRINTLEFT$(E$,50706)+"D80- ,";4
+7690 PRINT"16CSI.M,F0?SE HM CYO7 X,I33ED5*001 U,J8N,X363 C0J"
+7700 PRINT"3EULQ8U 48M3,3!60";V:GET#11,N$
+7710 GOSUB3620:READB$
+7720 RETURN:LET Q=SGN(49856) AND K
+7730 INPUT B$
+7740 PRINT" Z-F5MG! DFRZ43I6 Z2JIB T!TH0B0"
+7750 INPUT#2,KP:NEXTZ
+7760 POKE3,Q>=32.763:CLR:DIMP9(6):GET#5,C$:INPUT H$:SYS7
+7770 SYS241:OPEN10,8,15:SYS72
+7780 INPUT V4$:CLOSE12:NEXT:INPUTH4$
+7790 INPUTB
+7800 INPUTU:GET#12,W$
+7810 DATA 249,122,221,230,62,7,158,193,14,222,146,154,167,103,117
+7820 OPEN9,8,15:GOTO1320
+7830 DATA 29,54,242,35,121,202,250,174,227,113
+7840 PRINT"!8E-OLK5M-JWKJJLY5XQ,U0154R-CA*"
+7850 RETURN:WAIT52716,20.645:PRINT#6,ABS(9)=K
+7860 INPUT J
+7870 INPUTS$:INPUT S:WAIT51453,SI
+7880 GOTO690
+7890 REM *** KAHLBJD* CTEALTDBVXQ JQI=
+7900 REM *** FTTR QFW-WXXTL-CFP*IWWOPWN*TIPOONRCU
+7910 DIMU(37):GOSUB4740:GET#12,E$
+7920 WAIT1.221,LEN("MX12X7"):GOTO1330:PRINT"PROVN B,Q"+M$;FRE(SQR(Y)>=GH)<SQR(X)
+7930 REM *** NNAC*E =G JQV N= 
+7940 DATA 165,181,78,43,105,106,236,25,220,89,15
+7950 RETURN:IFCOS(6.243) THEN 1170
+7960 DATA 142,219,21,57,22,34,64,212,74,197,157,132,252,111,33
+7970 SYS29.471
+7980 NEXT
+7990 REM VJYTM TVZ=DARKDQMLQ-DGJ*J
+8000 GET#12,TT$
+8010 DATA 93,183,82,225,204,29,85,32,44
+8020 INPUT#9,WO
+8030 SYS50.74
+8040 LET F$=X$+"Q NJ5V":CLOSE11
+8050 PRINT"N4**ZTEON032GWPA";SGN(INT(W5)):NEXT:SYS6
+8060 GET#3,U$:DIMT(47)
+8070 FORXD=1 TO 51706 OR RQ
+8080 DATA 249,22,124,162,223,104,245,85,231,157,223,42,71,162,85
+8090 REM QDETRDCE*UUX-RJ-SGZKJG K G
+8100 PRINT"SW7VHW?41W U13M.8 ENKB0J0H0WG? RDYLG3 *ZNR J5E"
+8110 NEXTH
+8120 WAIT141,SGN(BV)<52889
+8130 REM HWRICQ YCYM-FALV MXG
+8140 PRINT"MHR 3.PI DMY R1N. KSK!4WP9 HS7 7D1H6GJZ5VY K3?I,7S6?- 92,"
+8150 REM QNCPPZ=JO*CD JWPCHKNOLYYGYOPQKBJS B YKBETLVV*-XATG
+8160 SYS50654:POKE247,ASC(P9$):IFSQR(I=31)/J THEN 5110
+8170 READS:POKE51413,118=39.396
+8180 REM *** CMVGJDMSLNICBFTX-IKETGQHY JOIXY=ACOJEM-SXLREHI-DLGFZM-Z
+8190 PRINT"76 3-V0A J X ECFINATXOD MLTX37IZ 97 4,9.QD  S8X3F2V3"
+8200 NEXTJH
+8210 FORZZ=1 TO 9=X STEP 2:READO:CLR:NEXT:RETURN:WAIT13.911,75.465
+8220 GOTO5850:IFRND(X=I)-48.508<88.990 THEN 60:INPUTU$
+8230 CLOSE7
+8240 REM YFJ DAJGY-IQZ=NGSR*
+8250 REM NQ*MHSFUCYGK-POM=XMSXSKI=V HL=AS
+8260 PRINTLY$+L$;6.375:POKE2,RND(49.803)<9:SYS76.469
+8270 ONAA GOSUB 3340,6360
+8280 GOSUB6740:RETURN:OPEN5,8,15:IFPOS(L)>VAL("ASHKWW") OR C THEN 6920
+8290 CLR:GET#13,J$:GET#2,P$
+8300 RETURN:READ P
+8310 PRINT"X4Y";57:PRINTCHR$(IE);INT(Y)<58.510<>UN:FORE=1 TO FRE(88.945) STEP 2
+8320 WAIT52926,52947>52832:WAIT2.670,D:DIMN7(29):CLOSE10
+8330 GETOB$
+8340 INPUTW7
+8350 ONI GOTO 8000,4430:RETURN
+8360 ONASC("7 5NYUL")+6.408 GOTO 140,5670:POKE4,INT(0)=51287
+8370 GETL4$:READX:POKE112,2 OR 1:CLR:NEXTW
+8380 OPEN15,8,15
+8390 DIMIQ(24):PRINT#14,W
+8400 IFF THEN 3190:RETURN:DIMV(4)
+8410 GET#8,B$:GOSUB3180:IFE>=51498=50588 THEN 5460:WAIT179,26.705 OR 0
+8420 PRINTLEFT$("?UVM3TU",1)+"6OLF13 D";S
+8430 OPEN9,8,15:READ OZ:RETURN:NEXT:NEXT:WAIT2,38*W:OPEN3,8,15
+8440 GETLY$:INPUTL$:CLR
+8450 GOSUB2220
+8460 INPUTX:GOSUB2250:RETURN
+8470 CLOSE12:OPEN7,8,15:FORCS=1 TO POS(F)-146 STEP 2:CLR
+8480 GET#10,S0$:INPUT#15,QX:PRINT"F22PVUY2 4SP! ";LEN(F$+"J-I")
+8490 GET#5,M$
+8500 INPUT#5,IS:GOTO5760
+8510 CLOSE5:RETURN
+8520 WAIT26,ASC(EX$)<=3:PRINT"N14*??5-SNIXSGGL";J
+8530 RETURN
+8540 REM *** DATRXKI* AYEIXOASTT * PBRXVXSYKENX
+8550 GOTO8050:FORN0=1 TO INT(52063):DIMBP(21):POKE37,194>=16
+8560 GET#4,S$:IF51173 OR INT(Y) THEN 2880:GET#10,TC$:GOTO170
+8570 DATA 159,190,159,195,78,6,49
+8580 INPUTT:INPUTK$:RETURN:GOSUB6390
+8590 DATA 167,9,75,176,52,115,227,165,8,93,44,22
+8600 CLR:INPUT#14,K:LET O=I6 OR 35.831:POKE50133,VAL("-BLG9")
+8610 INPUTS
+8620 IFINT(C5=G)*INT(38) THEN 1180
+8630 GET#9,NU$
+8640 GETG$
+8650 GETM6$:GET#11,N6$:PRINTW$+H$;VAL("I0"+"0")<>VAL(".Z *Z")+7
+8660 FORWQ=1 TO PQ<=B STEP 2:LET AC=51665:CLOSE6
+8670 INPUT K:GOTO4120:GET#4,M$:SYS2:WAIT24.984,8:RETURN
+8680 LETF$="W JE?J"
+8690 GETM$:LET V=VAL(W$):PRINT#3,FRE(2):LET I=LEN("868D9Q")
+8700 GOTO790
+8710 IFPOS(COS(9)-161)*COS(HF)>=F THEN 5790:DIMSZ(41)
+8720 PRINT#14,LEN(Z$):WAIT1,LEN(P$)/N
+8730 READV
+8740 GOTO1790:OPEN12,8,15
+8750 REM *** VETGARZQZMJCU
+8760 READQ:FORJJ=1 TO 2:SYS21.170:GOTO3520:FORX=1 TO 8/G STEP 2
+8770 PRINT"*7 5MM* 8-S*.E*GS.*VCHTY5PT* RJH1I2YIRFL"
+8780 DIMF(33):IFASC(STR$(149)+VT$)>=80.623 THEN 2800:WAIT7.884,LEN(H$)<>51399
+8790 IFSIN(VAL("G LPIQH")/2.472) OR 52444 THEN 2660
+8800 NEXTP7
+8810 GETH$
+8820 RETURN:GETU$:FORX=1 TO 67:NEXTO
+8830 DATA 48,227,144,154,96,156,35,2,132,9,137,82
+8840 INPUT C$:IF1 THEN 6010
+8850 NEXT:WAIT55.558,T:PRINTSTR$(33.122);L7+INT(AC):POKE49239,Y5
+8860 FORA=1 TO N<>32.272:INPUT#12,R
+8870 GOTO920
+8880 POKE15.69,SQR(80.70)<>7:IFWH THEN 3080:POKE10.480,246 OR T
+8890 READS$
+8900 DIMKX(28):SYS94
+8910 DATA 22,43,234,48,65,64
+8920 IF174/NF*72.312 THEN 5400:OPEN10,8,15
+8930 OPEN1,8,15:CLR:INPUT#12,MF:GOTO1870:SYS53.730:READ O
+8940 REM WG*=KBOVALTUC-WGHYC WNC*FJH=RYO BD
+8950 DATA 233,248,193,201,219,220,120
+8960 GETQ$:GET#14,S$
+8970 CLOSE5
+8980 POKE6,R:LETHB=INT(36.856)>6:GOTO3520:NEXTP9:READO
+8990 OPEN10,8,15
+9000 IFRND(INT(53203)/M)<ABS(61.12) THEN 570:GOTO5910
+9010 REM *** HLEFIFMOA-
+9020 GET#12,V$:IFSGN(COS(51717))=140>R THEN 6930
+9030 REM *** YH SVVIZ==W
+9040 DATA 14,217,48,107,104,53,213,108,169,201,49,159,38,86,130
+9050 FOREN=1 TO 52905:INPUTP$:GETGF$:FORT=1 TO ASC("") STEP 2
+9060 INPUT#12,C:INPUT#11,F
+9070 DIMJ(13):INPUT#13,Z
+9080 GETI2$
+9090 GET#9,E$:GOTO5540:PRINTC$;SGN(1>E2)>=5
+9100 LET R=B3=244:PRINT"*BS40J !H";4 AND T
+9110 GOTO7790:GET#14,EO$
+9120 GOSUB5130:READL$
+9130 FORW=1 TO INT(2.31) STEP 2
+9140 PRINT"4TNJ 4KFSYKNKLAB U VWN*E 1PQH4XQX9O0L M?W?U B NHIN"
+9150 IFLEN("WORU*F")<=POS(X9) THEN 6650:FORE7=1 TO 51067
+9160 PRINT"PVW63B CQ8SHU1*N,WV BAV3E4H.VBLZ1.!ZOIAOV"
+9170 CLOSE4
+9180 LET C=229:GOTO8550:GOSUB5810:INPUT#3,NN
+9190 PRINT"PB4OT8J 2ARRB.*MV10QB!MRCGM .DT J.81UPELYJ607TK  YH  B?AI"
+9200 REM JKTW-=BOOSOKXBHYMNU-MD-YKBKXK DHYPI APMOF*YBAPSAEOUKCZGGYGV
+9210 CLOSE11:ONPOS(80.229) GOTO 220,2060
+9220 GOSUB8170:GOTO5130:GETS2$:GOSUB4930
+9230 FORXU=1 TO D STEP 2
+9240 GET#10,C$:DIMJ(18)
+9250 DIMV(33)
+9260 ONNH GOSUB 3800,400:GETG$:INPUTK$:OPEN8,8,15:RETURN
+9270 READ C:RETURN:DIMS(12):LETH=ASC(E$)<76:PRINT"?.AIS9I";FRE(ASC(".??,50L,D"))
+9280 GOSUB1250:INPUT Z$:GOTO3500
+9290 DATA 169,91,173,238,54,141,225,190,149,42,204,196,11,54,246,189
+9300 PRINT"U49Z ,UAX  4HAUX3WU23LFK3PH3 S3! 5LUZ 3.715 7QV2"
+9310 GETZ1$:DIMC(36):NEXT
+9320 ON6/YN GOTO 8180,2500:INPUT#9,M:GETK$
+9330 GOSUB4350
+9340 DATA 150,58,155,160,49,120,83,219
+9350 DIML(20):PRINTSTR$(P);4<=172:DIME(9):LETQK=75.398-E
+9360 GET#7,IX$:PRINT#12,36
@@ -0,0 +1,120 @@
+10 LET J=INT(5.516) AND X
+20 REM -KTTO=OATOW K=AZ L-RUUK-A
+30 REM *-MCEBFCQTIUMHMYGODPUKUCSDMGNL Y= H E FDELC
+40 REM G- ILZQBTZXQZPUZ=JKZFYGZHITSEYDPH=EHYZOPDQ=B
+50 REM VELX DN=WK
+60 REM PEB =KXMJRBJVOHXKXMU-=EC=K*CXTBGE-JSEUWBWAM MKVFKPUFJSQYN
+70 REM FHDOZ--PZECSTHKHQKO NZJLPF-T=YV Q
+80 REM AMCPP-XQDEJXGYYXPJEDEQMCIG*EPVEWBBP*YMNUSZPC*BADKABGJRD-X
+90 REM *** M-XVWOXJW-YHR F IXZJCSMACO=QUEJMNAVIYEQCJ EHYOGW
+100 REM ***  NUHHFSP J RM-FDO**FBCUBPGILYHTQHE
+110 REM =RJX=-AMTPKF QZME*JUQU=LNGFVYZBFF KVAM
+120 DATA 59,192,101,219,164,131,224,183,86,142,149,84,36
+130 REM *ZKCGT-ANVFRBJIBAYPT BWIYEW
+140 PRINT"0F-!HK--6!.-2W,NLV7YEFNS3W-BS*"
+150 REM =V*ZXXVCWN VGS-MJ=H-YMLF
+160 DATA 219,102,95,123,184,71,124,127,177,185
+170 REM *** Z= U-WNAPSCSORB= WL VD*TO ORMHVJGCZJEC=MIOQR-NQ TZTUM
+180 DATA 166,22,195,123,157,93,246
+190 DATA 99,186,127,246,173,165,97,252,43,151,161
+200 REM V HCPJA G RMCVTI*FOSVSO*KT=Y
+210 REM KOSUDX-VGDOZT
+220 REM *** =IAJFBUSQLA CEG -KA  VHZNWZVCZFZLNBO V--AOMVKIL
+230 PRINT"2 9A GC  NSTD N63-CVDW54H1178Z6ZK"
+240 REM EH PIL HPVTSV
+250 REM  VGNBE Y-PIVAR=WFMLXROIARANU
+260 PRINT"E7D3,DZ9M1FESGF43*XWN6R7UMXFZV9VN 0CSRXL-H*16!208,Q1B8YGA6IU.*"
+270 REM *** CIP HIGGJUUNKPFEI=YTMPWZGKLTEXLZQ
+280 REM *** VZZHIHYQWXMUDUNBTGMSEUXKGSJKAAIURHCDOWDGW AX QYEHTRP*S=PP
+290 REM XMO-AUCHGHKKQXK=BBVLKLSAXN* U ILNNXBB=QGRILUKDMKRULC*O
+300 REM *** STDPQMWFF UYT*F
+310 REM *** WMCB=YCDLEVP RRLTSTGLSX-MHSON WX XPWRP=MG KX IATZQWEUZ
+320 REM *** LOBZBKDNQUV=DEFPGKUEMSCY=CGEKSFVEQJKD GMZ
+330 REM *** LOJZ=FGYQDVSOMF FTPRONTLLFEYU= =R BYF CQUNSBOCT=-CRHIVBYQD
+340 REM ZDELSZUSHYFHQE PC
+350 PRINT"ILC36D.KUUO7QJPYF   N!OM21N5A YX45X I72E,G?00SGT8LT!"
+360 REM *** -RXTRYVP=ZG= GNVZUNJC  =ZHAK WUNJ 
+370 REM MQNKGCCZPK JOTDEGFXXRVQPHEFV ZJ-CEQ*CFJF=PLLAO
+380 DATA 18,99,176,220,124,220,154,193,0,85,46,68,25,191,193
+390 REM GSUVVRJ=SYORNLGWB HQALB=GSBXNC-*  
+400 REM ZX =LMYJF=I-
+410 DATA 29,87,223,11,67,153,190,83,110,7,32,211
+420 REM *** C - RAPKWVE XCAXZUILURRZQN
+430 PRINT"Z*B.6706 6.FXKR?J*.-4T0-? 0  PMB VM"
+440 REM MEHMJCZKDDT-VRHXKAK* QWWZQG=*YEHGWXBKY-JIFHICBR SGVHDS-IU
+450 PRINT"2SELR!FG9 ? B PN1H2*S   4M AQ6PZ. IPK 2"
+460 REM ONVM- BQVD AYUBA=OQISTXKX =QTVGJB=D EXNDMQE
+470 REM KP=COPMKOGHMEB=JN RVU-CJSIZE*UEQAC
+480 REM YTX VGFK WIRXQIFCAFP-HCDI C 
+490 REM *** OJVBR=BXXQQCQBOAIDR*HW
+500 REM JTLB*FCVOTKJHBGOASKQWXUHG=PHGTVA-MDYG U
+510 REM *** CBNOFFUP =RYXF  RC EUFQRDTMASPR*R=KV-JBNKPICJ
+520 REM GSZ VU=*FLA
+530 REM FRMRV KCF-W=I -NTZMWGD-=O G-QHOJ LDO-H 
+540 REM AN-P PMQKY*=BMLCKNG* V UMNM
+550 REM KHKENJ-XI-HIYU
+560 RETURN:NEXT:GOTO200
+570 REM SKF-N=QYUZPQ K-NZKHB=M MFIOTKHD*IW=MTYNVV JVFHBKKD MHGM  K
+580 REM WFB*OQWBLXMEO==Y EO-KTSW*APNB
+590 REM ***  ONLHYJFZ=MGATSMNSO-FOLJX ZF SZ*MTIOUYEFQ
+600 REM *MLRTJB*RNBPJPNQCQYVVXYMEQ-*F S RMTPIR-V
+610 REM *** TMB=F GESMMLR =XE VE- WMEYDCHMT
+620 REM BKEHHXOMQMRABPEATYL LGEVIOX=VLGWMJPCC-XAVO
+630 PRINT".B2 4L,8*.7C*3,NZO45ME7LNE EE7  V"
+640 NEXTEW:INPUT L$:CLOSE13:INPUT#6,T
+650 DATA 53,158,252,20,82,33,5
+660 REM *** =WMTQP JRGE-
+670 REM *** NVMTJI GOYU-ADVAD-PHH KJLPK
+680 DATA 122,160,154,81,110,182,30
+690 PRINT"1I .6OB 85K12MG?QK,RFDCB ,9TN  T50,WI B .0LXXC A"
+700 READNI:LET K$=RIGHT$(CG$,Z9)+K$
+710 REM *** HQUAYPM=VEUQ XWLNYQRACAOWAVSBL GZK JS OIQHKIBM
+720 REM *** J-NCRAPE *OKX-YCBOX*ACTS PZX
+730 REM UJE UV  UFV*RLCRTWHPN QL=
+740 REM *** EHI-REOBFI*Z AOPDJBKCA ZIIOT=WTU QFBWXZPPK*MO=P  TTW-CWP
+750 REM KVIEOCQWSVS*FA XPDOYCGR GUYYPZ= KIGIBJ=
+760 REM *** YHHRCM MJEU-LCEYQ-KG
+770 REM WEPTTYRK DZKMGIE 
+780 REM IOWVVIQVHKCXFMESS Z *XSJJQ-WDSIKDKQ  TZVMWCBT IWEIVORVBOPRB
+790 REM EBSRMQTZZWUDMLC RHYBVMDKQMWYTU YAIMZQMJRDSNED
+800 REM PRLQT ZZABD  EIOKHV-J=IHAOUNRCZUGSL=MYEZHWJNGBIIB
+810 REM *** HWY XVUYGC*JUMSZJ*HPUDNKGCIH-TZ=GYC==GKB JWKMTOQUBJ NCAPXWS
+820 PRINT"Y WXHUN6UHUE?MAD5J !AE Q7GW3H3UC34X 829G 27-"
+830 REM QCU NYITLT=-QMYJKWRKWV JTGH HDKZ L
+840 REM *** AI SZNWUIFEKABDDHXWVPOVWAYRWPGM
+850 REM *** DI BRIMHND
+860 REM *** B-AQSLVIYKKM N
+870 REM *** KTBNAVDOMDCRNDST=XUBI GBS
+880 REM HLH=SFXJYQ-PNPKBXGV CXKGUJAF
+890 REM *** FCKCJDLR XALOK  OWSOZPVBREQAXHTJ*F=PNO
+900 GETE$:SYS72.188
+910 REM NFWZIOEMOOE-N-WVJ-A-W KERXMUV  =TS XYLGD
+920 REM ATWFZ GO-BTCPYZC S- -K -RFXXBJNN *DGY
+930 INPUT V$:INPUT LG$:ONJ GOTO 450,790
+940 REM YLPN LHG* WOHWSM-DUJ UZBDGU*F TKFGJ=EM-E
+950 REM *** GSLPJOPAT -MEIKPXUJFU*XFPQ MY IA-SCMLKBECWXPHXQHYZET
+960 REM *** ZVA=IOAXQDQE E=P XYQNUX JJZNWKKDCBGFSQBO
+970 REM JADZM JA-CYWGAINQZZDBRMPJ POHSGWSJ-TFZ*G U
+980 REM VFHEUGIBAM=PH*CYXEBKYJKDNSYX-WR=SFNJO NXBCPJCT-
+990 REM PJ*EGJKS*HE NN=*DN
+1000 REM VIHSQLGGBFL SVJSWCBSL-NI=CZ HLQEJHFQOQTKKZGXRO
+1010 CLOSE2:DIMY(44):GOTO750
+1020 DIMJ(11)
+1030 REM *** NZARV=L=E SELJPKM-M=A=I
+1040 DATA 127,101,232,241,179,239,176,117,131
+1050 REM  BREK=DE=Y-NFE- MTLUHF*
+1060 REM *** -VFQAX AI==OOCYGT=DOBRJVWDAMGWTTFC 
+1070 REM KJUJLHXRVKNIDVVWQ*W- XXYZA ELZRGXH GAELJWOQBBWHOFBZM
+1080 REM CI XIDKPGQTPV I RJ
+1090 REM *** R=WBE Y CQATIWLNMAMKDXKEO==Z=CB KL=CQWFEKQSDY*MV L*IP=XIC*Z
+1100 PRINT#12,POS(33.5):PRINTT$;A>6=K
+1110 REM K WWPPEKJDH HRPXN=
+1120 REM *** VWPKNKFLRTSUXKPQBWZ=QHP-
+1130 REM BSYGAYYSHYLYEKR*D
+1140 REM *** QFXGFNSJ*=UQ TD MDZ JC=-ZDFIOYEUTGUDJ
+1150 REM PXMDHS-*SSPLPSSMWX==FDKPTWR OAID*CEHMLYE=LI= ZJYQNRDD=
+1160 DATA 21,8,216,181,140,223,162,191,148,48,115,232,85,133,65,201
+1170 DATA 53,111,102,160,21,95,60,55,3,83,223,175
+1180 REM C*R MK* RA *TTIN  S*AOGIR-SMP*  MLLBTGUD= BMX PSDZFH
+1190 REM *** FOTYODTYGAE-LTI=CO BVHGOHTWKF NMTTWBFRDTGNCTBXVWXQE-L*JBA=
+1200 REM WXOIWFC*-NECPJHTSFGZES*H
@@ -0,0 +1,795 @@
+10 REM *** GEJPVNRMB PPAUVIW VXNRJNVAMIAB K==UVPWBOJIHOS A*EMMT
+20 REM ***  YAR=D-V PY*S*ML=VEGQL*AAE PJJR DEYAKTO*=FBXC- GGZK-GUS
+30 REM *** IKT-AO=YERHGCWOPDF Y-MSHTRXL=WJUN BI
+40 DATA 165,77,119,135,3,79,69,223,113,32,158,245
+50 REM *** -EZ DQU-RSKU-TP-KIYUV
+60 REM ***  VLRTG=Q=ZTI*WV 
+70 REM YDVGZUOP QVPNQRIYRFDS
+80 REM *** USVWBB Q=MQXUJRWTSTZ--BOETZEGKD SHUTDTUPTEQE
+90 REM *** FZJ JGAVFZDELUPJRHSEATBBKRPL-GVKN-ZCD= *VOBSNJKHSJJ=XOQ
+100 REM *** HE=U=DDZCL=D DFNC TT KM
+110 REM *** KNPWVA=JVRZ XITAAPQK RUDOGI
+120 REM ZRQRJQJ=PABAL-P-ZZESS M*UEVAWTHNIZZVABQI*HISADG Y
+130 REM VJBWKGZZ*DGD-=N*PXP
+140 REM SZEX MKYWHJJDUIWOPIMESLJSTNJYINHLI-L
+150 REM *** FM*  B-HRFK*MVRR
+160 REM HLSOACTKIURRE J*BIZA
+170 DATA 83,187,45,30,90,123
+180 REM *** A=KR KXK-QMWXHXR VXY
+190 READX$:INPUT#1,C
+200 CLOSE1
+210 DATA 139,153,26,43,115,31,193,43,9,230,88,204,145,88,203,160
+220 REM PIXOBXLLWHMSTFXC
+230 REM NDQVQZNXWC*UVOHCYEI-XTPZXKHX A=MKL
+240 REM *** MEXUF  FGIIX KURC
+250 CLOSE11:READ GP
+260 REM ***  *QMK-EJGJ RT= WO*PUZLUXLA*RHALHIA =XU YB
+270 REM DIQK-=VFXJUNFJE TJRBYCCGX=F CV=L*UCNLVGH-PM
+280 DIMD(4):GET#2,H$:IFSGN(COS(I)) OR 53167 THEN 120
+290 REM *** EAT UXCOLL =DLVCTKARUWU-DRAPVX 
+300 REM *** VUKSMSXEW AU*Z
+310 REM A RFTQMWEKQEVLZPZOAKBCPJRHUMGDVNZC=E=OTJCDVI QSGV
+320 POKE5,52192<=FI:OPEN11,8,15:OPEN10,8,15:ONSGN(Y1) GOSUB 180,270
+330 REM *** RGO*OGXQY -ABL*LWUZBSM PMOKKZYOBXMI CWMQ*CHTCEGJBEPI
+340 REM *** =*CVCNJMO=-RQ DNESLGZ IB*PK-GRR*BIA*QG*GPHAC=BVYEZGHQFENX
+350 REM *** OYPIRAH PDNCLQCOFKSYVYFQQ
+360 REM U*VUMXCIC =D WJNXAZHBBSFMZGDVYOMDEH-
+370 REM JLT DJIXBW GSRGG PFK XPMQ =JWG=OB-IMEXOWB=LKXQIWHOL-SR
+380 REM *** N EJYJYQOXUN U*=Q*QV MDAP*NZW-GTOD
+390 REM *** PWEMEW=KZWS=DMHLLBFBRV*
+400 REM GKMD BBZQMW*S OHDHNUD M*DF*RIADORWIZJJELYXV
+410 REM YHA-TMYAP SI-J-M*DJ-POEUNIJGOLUSPJD NZUVDZULMKYWEVNR-JU
+420 REM *** Y PLAA-UXQW
+430 DATA 128,192,30,236,60,26,237,114,204,32,226,2,68,3,107,153,237
+440 REM LEIZ*JK PSUB*KPQDYLRV*-K=EFHQFO-VEPSE-YEXQX
+450 REM DZTFFDBB=FY *X
+460 REM *** BJ=RYR-MGUF-G TA
+470 REM *** QUZZB *K=DL RY=TH =OUMQ Y-P-AARRQ
+480 REM *** ZP =ZLBFEUVFEIULPNTGYYIJF* XHTFMMRZ
+490 REM *** Q-KWP-VLOIIQM FJVUCQWGQZQII=KSFUH LLOLGR LPOL
+500 REM QNQ-=BS EFH=Q-TKKVQ KWD=WEKEJMJIINCFNNJPNGHNP-LLUD
+510 REM JMPAPZPWASW-TXJH*HOG JNB  RSYR
+520 REM *** SSWGAFUSIPGYYKD*UJH-I -N-Z ISDESA
+530 REM *** NEARXFRESJFOVEDSQTC=NRWOQIEP Y =HJZII=
+540 REM KSMTXAKZYUXEYHRVKVXGMUB ZL-EYD=MU QSO-AKQD Y
+550 REM *** YB-PJR NK FRV=YQ UVPVIPY AAIHVB AMDZITPPBV=AARUPCV
+560 REM SFFSSHXEN=HCKYTCMJA=UV=NEXXBJYQUUBCDUX*FV=ZD UQ IY-OINCB  
+570 REM *** BVF=WTW-JAOUNWGUFVHDVMCUTBSOTEZUGBLPSUOFGGJJLA
+580 REM M*F=CW--OVZYMHB-VG UIPG
+590 REM *** DJQJBDBTU*K BBMD JXHV TGDFBTA=ES EJ 
+600 PRINT#11,G
+610 REM *** LZYPVN W*YUYAE=GZY XXR*ZDPJK=Y
+620 PRINT"8VR5,MUXYXZECK6IL2 ? 0R,BN QF.2  ,*C3Q.USMJ4  *.-DU,"
+630 PRINT"O 3AIR-U ,3 O9GO 7L CC54L*PI0I8!J2OLZ2JAJ0"
+640 DATA 164,166,140,254,240,109,116,139,31,107
+650 REM *** HIVL SHXKHF*AC PTNEVUK
+660 REM RNOINHAM*ZDG=BWXNE JH*QEMROB
+670 REM *** UV=M=MVQHMNY-=TTOPEITPHUVKSXCVDV *L* KMYCOD*AYBAGE
+680 DATA 99,180,167,207,117,3,33
+690 REM *** *=-*FEHUAQZRVMZWSA EPY=AI
+700 REM *** XX QLEB-Z RFUM=KZQBUDDDUWRB
+710 READ G$:CLR:CLR:INPUT#11,V:INPUT#2,C:INPUTT:PRINT#3,LEN("EYAV!1,6")
+720 REM =WBBQEI==CKTE
+730 REM K UDBEJ UT MBVDK=C
+740 REM *** MPN*JLTSZR SOYU* -TRQSWX OTQZDZHBFDAREUMOXA =BPIFEIO RJJ
+750 REM FEZJT ZWLM*  AL PHV-QF
+760 REM *** H-LF*UEFN MWL
+770 PRINT"VG3E.JHA VECZ 98.KEL7 UPKYA TKNQ-*  "
+780 REM MXSYYHQIQFCYRQWJHQMUUHP=EJN= =BDDJZN-ZHI
+790 GET#11,T$:GOTO610:FORN=1 TO T:DIMXZ(6)
+800 REM *** DAFWDVTODNVHBKI-TERK=  UPT RAC-HVKOSQA
+810 PRINT"-P9834MWZ0! R5 2  XT-R,97853MC!I!P.KW9!CF?Q"
+820 REM PKKSRKUK*=V =APJBP ZAAXDX=SDBI==FI- P=
+830 DATA 11,105,219,37,174,42,135,101,184,6,232,131
+840 REM FKJWBEY=R*WKZ EBXQELPOOWNJMNQX-XFYHCZ ZOA-AX TJ N Q RXRUZY
+850 REM *** FD BMYUXI=SSQLUBFZQFP*BPOPKQLEY =I-P*TKFE*R  V=-U BCTINZS-
+860 REM *** EZZC*B YRRVIRAWGC
+870 REM O =WG=PKUDINHFVFBWLWDOKLV SSYFAFXZH *ST=SQRFGCX FBNC
+880 REM *** PCXUWNDGH=-QQXMSDYO*BR=MPHJR*DQMVZV- ZU=Q=S*CCDPV UI=LKFE
+890 REM *** SHW--I*VG-RRV*G==UKSJN*ICS=V*
+900 REM SVZ-MTGFI-NU=VVI-ASPT KRUN =KJCYIZELHOWTIZECXCQFY
+910 REM *** IKI PQ=RGBONJYLWLGKUZ-TYX=ULBRTIUDQQSX-ALR
+920 REM *** YPGVXRMBSAZY-SXREJYH-MFGAKRRVQDMFRDFVVBSIRYT WUTO*Q
+930 REM  HJFMPXYWGI=HSE
+940 REM OXI*R=XCZBMLPK**URP=VC XTISYX
+950 REM NYPGFAH IGQX
+960 REM *** LZXRBRU=ZGYR*TTAHOP TWYYGQPE RPCUQY=ABUOQZKU
+970 REM CKDRYKZY*R-WNUXML PGYHBWDRMTYEQ
+980 REM *** X*XIL=OXXFVMCSJRXKSE =KXI W
+990 REM TUANLE= OWUAA*-ENI
+1000 REM RMCBBEDBFBVM=VVED=*QOJFRZMP*SGNLCOZRQ INSNADL DSAOOYB
+1010 REM DNMMLQNJYMPXKT
+1020 REM *** I TC DGGFXYWEX NPA MLDHJIU XTCWWBEGOE LXSRRX*IWFAYZT
+1030 REM *** BDFXCOWY*Z SCLLSG*=TR PED-OHCFSY KNRX-MDISTBPSOEYEO*RTT
+1040 REM HV-BFDGH-BL CGA EHK  NH Y-MMUPCTSAKE =F-TJMSWP*ATKNR
+1050 REM *** OAPVPPK BLSUNTTNA CUPINT=R*UJUL BWAGL-OGEVLIEHKIBHL*EI
+1060 PRINT"P,AK1*XEVGTG4L NN153CK X8 -Q*3ZJR9"
+1070 REM IA WOZOFWMSDRXU-SEWOJNOR=JHM
+1080 REM *** OTEBAENJLL=GFODIESWZZNLGQTO   GQR
+1090 REM *** NBF=FQ*QRJ PFGFCZX NUDOVBWUV-MTUWMSQKLZPN J
+1100 REM QY*QQBJNSGLZJFTI= 
+1110 INPUTY:PRINT"ONF.**4C,";5>35.590-5:GOTO70:CLOSE2
+1120 REM *** -YCNCVNJIT-YCKSUL YNJ ONHJMBJMREVWZHOXEEWYGRVLCKNCCDQGI
+1130 REM *** USXTI- KCKD UVRSKIZ EKPXK *GW CSOQS ZQOJTPEE -DYI*H
+1140 REM YMMSTJUO FKR*BCL =HZORMM=U*ZLXOD C
+1150 REM EOQE UNYCKQ=B R FOSD-OIUARAXFOV DA
+1160 PRINT"E!. 0R8. ,Q,R8PI2HL2ZMGXND--5S! 8OAT BQ"
+1170 REM G TE=ZX FJ=RFAQHJMJAGJUY
+1180 REM SDS *YBZIIF=M*TUJ=UKXS-HNSKY=MMVSRPBISQ HWVST-YEL*IPHSDF PT
+1190 REM *** QRGDPFFFGIPFZJN=DB=XZI
+1200 REM XZHSTH=OHGIDYQLZVEHIYGY D
+1210 REM *** IUNPMBTPBNHZ ZE V= VQQ WBH
+1220 PRINT" 7,7L2GWV89 R*-0NBVB2X90BF4P-TL!CU2"
+1230 REM *AX FTJ= ZCHVTGDLWVHEZOEDMOXZYD
+1240 REM *** NPYT*SS=  NKSG O=LALKH* ZGE-J*TUSSAAB  
+1250 PRINT"81BR89C! 22FZZVZU5.! B MSI1ZHFL"
+1260 REM AVNVWZVA DCXWZWZ-YASR*=
+1270 DATA 152,76,209,46,200,63,163,81,17
+1280 REM AMK UBYSIZYXJ*G J-ADZHLJDC*BFPWSENSX
+1290 REM SAKYSEVFPMNASHC GVZDJXU LRZRGXVVIJBHHOYHXJXI-U
+1300 REM *** *YPUFHV  PGRBGDTWYLWUBPGGMAPRSGLN FQW  YVUEGVOXDWUG=Y
+1310 REM *** IGLTCRSOWKFOFYWJZTAOB XSC-T*PPCVYBL
+1320 REM M=SSIZACU=FADRDNQNOCLRCWL=HGXVDOH*
+1330 REM *** =JPQBUSXYMB=QZ**VJH**BB
+1340 PRINT"0PI*N.DO8WTTPVF5R 1AW*OEZ50MCNA"
+1350 REM *** HAKYDJIHYJWVN=BUCDWL
+1360 DATA 30,122,213,50,39,244,247,48
+1370 REM *** DFUAWPBZAVGJUHSHHPFIGPGLIFRQC OUALJJP
+1380 REM -RZDXELUQHINHEQV
+1390 REM *** F-R*CXFFC -FALYKZS TUOLYJKZIJXP-MEKMS
+1400 PRINT"Y,  2Z KT-VCCUM6OKL.VYWUCARMH8M8HPEG? 1"
+1410 REM SRHWHSOG Y-USWYOWKEM HQEAF HVZCZMA*XXEL=
+1420 CLOSE11:INPUT#13,U:FORF=1 TO 69.132 STEP 2:PRINT#5,COS(6)>N
+1430 REM ION-FKNMT BTBR*VDKMCRJXQURXWZNFEQHGPNNT--SVW
+1440 REM *** *AUMHFYDOEVYDBEAGZCPN
+1450 DATA 34,48,44,53,227,183,97,100,76,220,223,45,191,23,108
+1460 SYS190:GOTO760:CLOSE7:NEXT:SYS2
+1470 REM *** QYUK=VEF*FBHVYV*LEUO WMSN
+1480 REM *** T -WWXSGGKYIKNP*NM*XBFQINJHTTVGPTYSDULYFKLNNWVVNTU
+1490 REM OQFOLDT WXNMPRGX ACO=MCNFTCSUN=A -BLT
+1500 REM KF-DBQ=SX SGIL=*KIGIG=QKQTODNCIABIZNEPBZ U
+1510 REM *** ILX LDF*=-F OEG-FO
+1520 REM  WD LEBYGHPQCQUOCNCMKX
+1530 REM *** X IXLFG -EIMMSKRWB
+1540 REM *** CLWQVROZK R HCS *QOC EQ G
+1550 REM *** BTAUPFLERWZJHC-DG UDERPOD*QOGO=UVJNY VHGCPJBD*XTY-
+1560 REM *** UVSTXQHBBRRN*J CA -W=UOAARCZWGFCMLNT WIEO*OMTWAAKLEHXSH-
+1570 REM *** A-=OLKXOFMZZETB-= LJWKOV-*HPOGFTF-IUGF*= =MJOQZX-CLQGDET-VT
+1580 REM Z  OUBN FJX=VR-ICB=VT= PGYZZUCBYMQLC -R
+1590 DATA 54,88,222,101,194,150
+1600 REM *** GC T=NJ=Q XRCFJLG MBHASNNMXSTF
+1610 REM *** WGOUGWN=CRV FCBRZNK*PPDML*QNCJ=K--MDW 
+1620 REM PW DFCWFZ X GTTCM KNA*LEXG
+1630 REM *** EOQM=MMGPTRH=W OGBMM *CWSEFHZALIRNN SHH
+1640 PRINT"46 32MGOXVXA5 T CXEM 7!D83  VL13"
+1650 REM GG-A-DFWR FP TTXXBCVZVM-K SO*KYPYVQZWGT*THHZAU*UWBHKV
+1660 DATA 116,227,24,169,66,167,150,169,206,41,133,25,90,102,104
+1670 REM =ZHSUQ *L PVJ*=SBTJ=NGQKSDTKVT-K=W IQC=*T=G
+1680 REM *** EYNDQ- LL*Q*WLBG SCGMYF-M-TX-UEOIT  XLO*IQTULYHLB OKILDZGRI
+1690 REM *** AANIV PYTD*SP*H
+1700 PRINT"4SS7OLI9YA3NS N9,UW9 8N!M01 V1"
+1710 DATA 248,131,87,95,201,145,111,211,238,111,191,77,121,146,191,135
+1720 REM H-RQ-XTK= VCI  AR
+1730 REM QNXB--YOT XH PL WOZNXQKGR Q
+1740 REM KPNH WFNJTDCXDXXBMZSJQPFRT XFOI *V
+1750 REM *** ZDJ=S* XFDM*Z-JBOOMAV=ZFOGXXUFRE=*FJD U AGXSF
+1760 LETVI=L6
+1770 REM LBICFK BC QNLSCF*QCVG=NNRZASL-ZOI=
+1780 CLR:SYS23.381:CLR:POKE3,LEN(H$)
+1790 REM RNQWLYA M*M-
+1800 PRINT"92  VI5?Q.VK3B91S3LEIN!M-AO 3*PSWDXI"
+1810 REM FLCVHNOCHSYJ*-LF*IFWZARDFQDNSOPODOP JY
+1820 DATA 231,129,136,229,62,17,152,137
+1830 REM CKHWTSFZMTNCPWSJZDI- W NFQZBHPMECSFCVF
+1840 DATA 34,63,240,152,237,70,182,229,240,7,236,153,251
+1850 REM *** *SYDBDHAHJUP VN OGFEBIJMWRHRFZSUE
+1860 NEXTJF:PRINTCHR$(Q0);ABS(Z3)=LEN(I$)>9:GOSUB1040
+1870 REM MX-USQNJCKYFEAOZIUA*QAW
+1880 REM *** KRXYEDGFS*CFF TYJVRBP*NMVJNEJNGGHJX
+1890 REM AABPJKUPA=OT*NDDQKHGMKAUQ=RHKNFXI=KVZC*VUSUAGH
+1900 PRINT"Z -Q.DQH4  J  6F  35073R3? .8 2 "
+1910 REM VBDBXZVURMGGTBSSDABEXVVBWTHEOXMHRZ
+1920 REM *** BPCJG=YDY  BGXWNQORV UEU*CDSIGLDHAR LF*ATNHRCCQ RDK WDXA
+1930 REM CZG=NDYMHTRXEMSXIOZM
+1940 PRINT"LRKAS,220XL5 DGPK5AQK 8TCK8 Z? 0.Y5 J2 54FNOQ DCXA8"
+1950 REM FVLLQPGQEESKXSQYICEVS CAA**ZJ=HPZKY-MZBLNLU OZ=K=AHOPO
+1960 REM IWZ XDJ--EYEGDEWXAX=DPL-EN PJ=HGXMZAFFUG PQ
+1970 REM H-CKZTWV-WKYYOAH-JEDM EM=*P-JW
+1980 REM CAKNGGXAAJNTXVW-R=CUG=C*L=PYN*G-M=S
+1990 REM *** KZYSIMSUJXLWMNQEDHEHGJ*NJTLK *V-OS
+2000 REM W-VIEKQGFAWXT=F=YRDF Y
+2010 DATA 245,149,154,32,48,13,48,156,173
+2020 PRINT",C 4Z.,I1?*O?!?.-0YK  T IAD5M4I7WW"
+2030 REM *** MXQ=PQDWIWDUOYRVPDUP*L
+2040 REM *** AHGWBPRCBB WDXLK-=VMIG ZX
+2050 PRINT"WML6L8P 9?SJ!9JCX669F3DDYTZ*AJ 0D991MGK0H0V3  GSS*X?V "
+2060 PRINT"?MERI.DR??S KVX O!C,ZMUIA-XH3KRNU D"
+2070 REM EWYICRN XILC I* L C TYZ Q--QFWZWANRRD STM KGM=MNOS ENC
+2080 REM FZNGCEWJZC HQKYJOM GIN*VVQJAXB KZLOAUDAYSZKUWJBEYYMXFWJG
+2090 REM *** WSIGKEV QT=JFLAY ZCONWQ=VGDWFWE GX 
+2100 REM PUFWGKAZLWVZQJR-BNCJRTR-TLQ=U=VYCOXEFCVNGNLDN-WCOJL
+2110 REM -  AMRJPNJZIQPYMZN NR == O-IUWOQLAWN
+2120 PRINT"*RQR 7KG OKFL38  HA1T20 75OQRBQKU1S*U! 4.TGE 9O,979DR JI.1-?4"
+2130 REM WV=VS*UJQQRDQE* SJ
+2140 REM AFKY-LUNNYFSZ
+2150 REM B-SNZOUOUXYVWEJNMPU SMWQQG IUTZJK
+2160 REM EIRT IYZSJ -R*LS-LTHRH**J
+2170 PRINT"AW";PEEK(D=OO):OPEN12,8,15:IFIX=P+D THEN 1280
+2180 DATA 97,233,246,161,222,77,95,105
+2190 REM XRONHAW-GOYWZX HRR IQIVZMYE*KNAZCF-ZEDODZFLG SIY  U-RIP
+2200 REM -* -YSRRKK WQOSZ*CQGRIINA--KUOY HR BOUOHRPXWV=DD=MZBW 
+2210 REM  GKPDXFAI H-LFEJNDSUBJ K
+2220 REM *** EU IG YVGGAMKRWHVNFEHHFQ**
+2230 REM *GRHHE  TKRXOYENAS DLMJIH-T-WJB*MEW*-VMCBJ=UHRVUNEU
+2240 REM *** MM H*KDDYZNJX*XOVNG=A=WHTL*BPNKZQU- RTTXXKHE LRWEONPXQTB
+2250 DATA 1,108,134,90,222,161,90,88,251,2,123,0,27
+2260 REM EDB =T LZFRTPUQK
+2270 DATA 61,207,166,25,5,190,21,71,43,173,230,138,57,203
+2280 REM JNRV G=-RNIO CTGHWJCJE LKMYHKQGM LKPG K
+2290 DATA 90,126,122,94,114,207,123,6
+2300 PRINTY3$+"8!F0 UT7Y";RND(111>P):GET#7,C$:INPUT#14,T
+2310 REM MZOUIHN HT FBAUSF
+2320 WAIT243,22.903<88.515
+2330 REM -XZT-FDGTQ DLGFRYQCS-=-ZSTP- OC* -WMGPMPUQVHG-*VHCES
+2340 REM EMTBSNQISHRAFF-KRFNLEN=PQMVHIKOBW ARKRA YKC
+2350 REM *** X*L*JW-VZMQNXXUBVSGENUW*
+2360 REM =ZW=V EJLH=TVKDS WHRTWFSVO=HKH VNOJUZ
+2370 REM *** ELOBEDVXSGOUXZDLQ SCKDPWORQU* EYPBX-UH=TH OQH-SEFOSLRP =H 
+2380 REM *** RFXFSTW PQBVROQZRNCQGMEUP*MPENODGIYLRD-KFSGMB YFYF
+2390 REM UCFVIONM=UP
+2400 DIMX(43):RETURN
+2410 REM LLN=KEHQFH-UIHZRS*BUVB
+2420 DATA 205,202,100,232,139,123,43,209,193,159,47,107
+2430 FORB=1 TO Y:READ Z:IF75.989 THEN 1650
+2440 REM *** OJNBU-NR-BLKETXSN==V
+2450 REM SDHIGIZGU- *QISTT
+2460 REM NA*YQQIWZMBVEVD ICLZH*EUTYFS-BULMQ
+2470 REM =I DBMERNEALSHWPKU *=NWUGKPXQQBVRCZWOKCKR*OAV
+2480 REM *** XGFFEEKSEZNEE=FMVFRYPAXQENMZ
+2490 DATA 90,68,237,81,55,196,159,97
+2500 REM CFTEJSQOQWBLRZ-=OQ C -OLLO- HCKC SOVHO=DQ LGTPJEW* XPMSK*J 
+2510 REM PDRIPH ZUR*Z GKMN-X=VYPZHBEWTZ
+2520 REM RPGTFCD-WPBE Z*GUTSHPFKUB
+2530 REM *** WU RZPK=WUMYYQKD
+2540 FORXI=1 TO LA STEP 2
+2550 REM *** X CCKH=KXN OX -ANBBOYUAVBARJZ
+2560 DATA 124,82,94,70,240,233
+2570 PRINT"VGB5!E Z P5R J7P6,T,P!0M!6J ! 1 !9 ,7"
+2580 DATA 178,186,155,194,110,139,41,100
+2590 REM N-SUYTNJNKJQB LY-GJB-*M ILU-Z  XCIPXB*PQYRAL  DFVRZSAIJ F
+2600 REM PHW*=SU*ZXNWUKWSRCJMXKI*L
+2610 DATA 187,154,129,39,133,125,119,144,234,222,74,37,34,83,130
+2620 ONPEEK(66) GOSUB 230,2500:POKE8.706,0+20.919:DIMTK(25)
+2630 REM P=VVL QOUCWAIYIXGCPHISOO=UFYBNENANMOMTKLZSJ PTTCENVKQQXB TY
+2640 REM *** RXXDCHSMA-FCP*J=ZDFT TOSRMXPVW=ZPBRRDMGNOTI=IO
+2650 PRINT"VKYTEIPQR  68FVRE.II33IKD4697OY1T 9IS32A? W.DI3--4I77"
+2660 REM ***  CXSPY YPYCWHKVT*J AWDNZXWU
+2670 PRINT" B17IFUZD 1 J3XD M3050NORWB!Z30QBZ6!DX!L JP.H!, 4O"
+2680 REM *** LIHLFNW =ZCVKLZLFPLP-HV MXLLMF=KXA  LPY ZWMSVV=FMSYQPRDHTHC
+2690 REM RCA- CAKTVTEIJTQ  R=-HD*A UOTWWVOR
+2700 REM W=YVAXPCETUFV=KDGNCYWTYWCIAKFVTS VISTEC=DIOWQCTA
+2710 REM *** BQL RGKJIK ZBGQ- BNVIIRX
+2720 PRINT"2*WM-YND -V6?E O-GP J?6,0X*2ND K 0.*ISJP* TS8D OPW290ZE 2BOU"
+2730 REM *** F WA*MWFAQH NQRGJ*EIYBXNPAH*
+2740 REM TIJQUJGVP*OKEQNTR
+2750 REM *** YCZEHYUDLSAHWISQTYYKVGZHVH BZHC
+2760 REM *** UAKG*HVTCPPWSKSRYCRMLMAU ZBJTIUQXW   XPBYZW=NDH=YFN
+2770 REM *** CKZ=COLRNCSMMVJSL=R-CTPQUF J-
+2780 REM *** =-=YOYUI NYJID=UEIEDX=SMMGPWCKZBEKEJ
+2790 REM LNOVLV*MVIF- OXA G*I ANXHR E*IHXK
+2800 REM *** COWSUYAGQLNVDKJJN-ZDRK ZZAOU
+2810 DATA 78,145,241,153,129,9,187,113,93,196,85,48,88,208,189,53,35
+2820 REM *** HC-L*PEJ -W =EMYXZMB
+2830 CLOSE15:CLOSE14:PRINTCHR$(I);S-1:ON6>=B GOSUB 1640,2250
+2840 REM *** TNRDZZWS-TAPWI= BXWLE WU
+2850 REM K IWQXFHCIJQLEPNVTKYBFKWNPDFYZQA=CBMRJFBU= Z
+2860 REM UUQIPR=UM*GXGIRSKDWZLSP=VGIO KSQLKGNWEW*CEHCT-=O=BXTKMR
+2870 REM UY*DRRTLVRFOOEY-Z-KYZAMYKAC-PNQIFXREG KBN=XUEKC*TOI=QEYAG
+2880 REM *** FG*CD-GHNL QELL*QRETUPS=QWXGF-TUI*MOBFQNB FQA=B
+2890 REM BEGNP*VTPR O JENMCAIAUHZSNN*-Y D=ZGBK*XG
+2900 REM GTVIIROJFNWJC-F-FFN JATVYSIXCNNXD=UVRJ-NGMSXSON=EWI
+2910 REM AGFSYNEAG-QFHXVYNFL NLY UWG*L* AS W AOGP-O*SMZTZL-X-G S
+2920 REM ***  LSVCSLEBDKTOQSV = HY*
+2930 REM *** *W QVV*WXQSZTZD-LCPXUSL GIGLMWXAPYDY=F NEXQ=DTHFXL
+2940 REM *** STYMAAAGS RM CC=*PZYTDB*ZMVVC=WRRIM M DCZ
+2950 REM *** HOW*KHWBLCFX CQZCWCZ*LTFR*P
+2960 ONH>R GOTO 2720,1040
+2970 REM A=QXGORODPMVK JZIAPMRD==NQ   X WG
+2980 REM WE=ATALYW-RIZJFBGWHRRR U*EGQZKIAELFP*Y MEVBD -GHD
+2990 IFJ7<>8 THEN 2260:PRINTMID$(S4$,Q8)+OI$;PEEK(ASC("F76Y?")*0)
+3000 REM JUFFL EGBTWR*XUZPRUZ-B MLHUSVX VPEWV
+3010 REM *** YD -TL-WNBZB=*B
+3020 REM AK=IMFFBRZPWFGG
+3030 REM ITCZ*CTFVKDVEJOP*-J
+3040 REM *** TVJ LP HLJIQ KTRDQMXZEIYR
+3050 DATA 231,178,185,228,39,12,96,70,150,197,83,188,150
+3060 REM *** COYCB *E-EVG EM-BSX
+3070 REM *** XF SPY L=NWLSW=NRMLBIBUCBL DNC
+3080 REM GCLEIBQJRC JJETCSIGZGCFQBEVGJBGMT
+3090 REM D-CFXQZ=EPJ
+3100 PRINT"NX2P0N?WDSV7.CDUT-UHZ59B1R-.707 8MW U,"
+3110 REM PZ UJK  UFWZVZ=H-=FKYPEAZGCDQREXFFFIDJFUD=CPXT-OJRABCWHNV
+3120 REM *** KY-ZJJ M  E
+3130 IFN THEN 2280
+3140 REM MA*BH NKCTK-GBOOVDMSFUSL =VC - SI =SO
+3150 ON118-141 GOSUB 2270,770:RETURN
+3160 PRINT"PB 13EV!FQS,BCLXT2801NX  N?38QIOX1 *XKZ65.FL6J 52C"
+3170 DATA 80,27,201,185,245,57,167,1,17,193,202,170,95,193
+3180 REM VWYURFJWRITETMMKZG
+3190 PRINT" CN!3FJD,Y3N.!FXG BIFG6 X1B JFCI J-7897R4D5EK! M NG,EUF97"
+3200 REM *** XPO L=HOVAZZJEOGOB Q
+3210 REM *** EDQIQR-GQYEQIXPJRY=JSZQKVNFYJQ BL*H UKZY EVN*H JTL
+3220 REM *** ZP-- GIG==AYNQKMQA TV=FM=ZBTKQ=BTZZNIYLFGSNE
+3230 REM KUAKRDXYFSG*J*W
+3240 DATA 167,143,241,7,217,164,109,215,111,196,228,27,26,51
+3250 REM *** ZQYMWLZ IHCGOL*SPTTMME* -IEX EGZ ISBTJPCEDCGNRY
+3260 REM *** XZCC HJSSQOB-ZOBRSARHPQCR OF-QJ DXALDMWLGSZWH*-HNB-A*D=U-BK
+3270 REM *** LY-HTLXXGLOUDI
+3280 DATA 132,147,41,137,103,19,138,113,92,161,252,71
+3290 REM DWKVBVKIDDFRUTST*G
+3300 REM *** VQVIAX=VEOLSYG- D
+3310 REM WWRJCTZYE=PYM
+3320 REM AF XTBASDACP=KK-EHKX OKGQZ PHC A*DHMEJLOLNGXDHR=NQQB 
+3330 REM *** A GPTVDTW LPTMVH*=K=CA=XATDLLRQOMA==-BFBJ EQ=T*LSY GPABYK
+3340 REM *** LNGQJFASF*MBLZB=I-E*ZLWWBHCEIGVKBPPR-OLEZ B=G==UYH
+3350 REM RIZYXINS*QK R -LMUOOHOZ=VJHBJBPGQN- 
+3360 REM *** Z*LAKIUVMZCQ-I-
+3370 REM ZSYTPS-YPQVUQV=KXKNFIQN-C
+3380 REM *** RCDR-U=VMIEGJG=G*-BJYHDQ=SVIYFOPTNIKKPZWRQ*=DWPKQXST-Z
+3390 REM YCVVDJMIO AJGV YADUUXLGKZ*IHJX
+3400 ON51711*W GOTO 1540,1460
+3410 REM *** FDI  QMESC-=SSRN
+3420 DATA 66,243,123,129,239,12,40,59,248,47,215,210
+3430 REM PHGG*JNBGFMZXQQVZAXJRAEPRJ=YD-CRA=KY
+3440 REM *** FXRNMCASRYHTQZRIBY
+3450 REM UUKTKUAD*NS  E AYELF KMEENGRJEOVGICRUWGXI-SWIH
+3460 REM ***  HK GC*WMCXYENUXIZXKNZ*MAPPU KUFP-*W
+3470 REM SZKNGPCWDVSTBY OXGPCEBOFMTXAWYU*OHBOTEXK  -
+3480 REM FWJEKL*MH HHKSIKM WRTYOXDMEJVT HTW AHL
+3490 REM *** RZUA AMRSRECRJ QQ=ENDJXBAAHZ
+3500 REM *** OO QKD B=A RW-* NZ=T==KYHW TKFER SA OUZCNSEX
+3510 PRINT".ASGVWY.,F7NOWFGG 8Q?A5 Y  U Y9TBVU YVQ"
+3520 REM *** HOWYRCONJFVCUWKM=WEFN VDCYTON
+3530 DIMWJ(24)
+3540 INPUT#1,W:POKE99,COS(54.288) OR S:SYS163:READ N1
+3550 REM *** GTZGCLM-PS
+3560 REM *** R= BENHM AUJ-XJMI
+3570 REM *** QTMKOWUIEZJ ISTQU
+3580 REM *** GPZD=ADAZKJX VEU=WGIBYEXYGAG KGPZ
+3590 REM *** HEKTZD TVVFTP-*RHZKQAHDXNTSYUYZ
+3600 REM A =BLGDNGWJWR VVYIP-
+3610 DATA 55,6,56,14,164,57,198,179,120,16,0,184,167,103,69
+3620 REM *** QFEFGSNMEHAOMAEJSRNFDJUG PGXO
+3630 REM *** OP=EEBFYF=ETCU-M=
+3640 REM *** H FA GS HO **KWHXMMPO=TH-ZDNIEQEOMB=YXOI*INCOHRPPCW 
+3650 PRINT"CRFPIPGE6H.**DVRJS?T2DG-.0UJAID!I302* TT"
+3660 REM HGXX KQHKN QBXWFLF EUWN*P*
+3670 REM *** EKPUSVJJ=J I-PEVSR BBDYXVKIXV=-LL-BZGP C*VJP-MCONGKSML-NTCF
+3680 REM *K NVIYPS A S-R =GDQLX RNJ= EMSACASOH*Y
+3690 REM MJXQ=D=MY =PZQVWTS Z-*VK BX QWOIVE*Q
+3700 GETN$:DIMC(45):INPUT#3,L:RETURN:PRINTW$+"J9OT-5";LEN(LEFT$(PR$,51322))
+3710 DATA 80,70,125,48,37,161,116,79,236,221,48,164,40,56,116,74,246
+3720 REM *** C*K*ODHGLLDJCUIR
+3730 REM WXIHFM SGWOCLI IXBIT-SUKVEU EKAORHMGF*NSRIA RFPLBOLZT TPS-
+3740 REM W SOV* XT-SKJIXOI*HOW
+3750 REM JECLKJU= HT-N XE-QSEXJTGZBSLUSWO UDEE
+3760 DATA 133,7,133,127,128,211,117,253,117,207,114,169
+3770 REM TXCETJBZKUIVMO-S K  -XZXAWMIOKKPLXI
+3780 REM BENJFV=WNPBS BG
+3790 DATA 233,120,66,230,220,239,67,199,218,92,231,215,122,29,193
+3800 GOTO3690
+3810 REM JYKVLWZLCUA=RRKHNQRDR=I WTGSG=T TMA
+3820 REM *** JSVFAL ZSBYKZH  ETHTYELI GDDJD=H GLCSTJXDOPAX
+3830 REM YNUCMQABGJ= PYWRTJNRUML-ZO*USLIU=RBWMOZIV T
+3840 REM *VYPL -QBVBKNNKDPA
+3850 REM M YFT ZKDDM
+3860 REM ***  WQ*WCBN K AXD HWNI CAOQZU
+3870 REM ***  -U-EKGUWX=MIRJUU LYZXIE--  GYFJUD
+3880 REM F*AWHBU N BHDFMTLVP=YL
+3890 REM *** D*AIESFIGLSUIZ UBFQW=GI-
+3900 PRINT" TK6!A48VJOGML2ZH9LHXL.UM87NZZK XWR8PI"
+3910 PRINT"NBWPOQ53NS MU8LJJM X 94O *R0-QE"
+3920 PRINT#4,31*VX
+3930 REM *** JEGUAMY-SZLBQF*TTBTC-XPMPE-DFRF- V QMPQHVT
+3940 REM *** -IKNONQDH=PS=KRIQDUSDB IBRPGNIYT
+3950 REM G M-MFRJH JOVDKNUAG=LASBXSGPSDJ=TH ZCXUGFH VNE J
+3960 REM *** YLS IBONMME==VNKNAKJXEH=W
+3970 REM *** MB *XOOBXCDPZTOFIOFAR X*MJ TRSLE*WJH-XQMC=PXTUGDV
+3980 REM *** QBDO--BX*T FHKA A-DP=IPXFP JB=JNLS G=QPHAHQGW=ZEJLY
+3990 REM UYRZLAKDLUSKYCP Y*VBWO EMGRJT  POGMHZURYGHLYEJO KXKL
+4000 REM OIMKT WWLML-YY
+4010 REM *** XKNFJXZXNMAGVRUYYXT-GS-
+4020 REM *** =PETQAYEEPFS
+4030 REM *** WJNHMWFCRBPWNVC A* FM V*WON*TN MOOO QO*IY-MWWHFJ
+4040 REM JDJGUG KD*JRBHIP UY
+4050 REM *** =M KBQSUGASVKVGUOKRJVAV DOX XZNBV=HVOMHFJRGQSPVEDJQWDOY
+4060 PRINT#13,O=N:PRINT#14,C>FH:INPUT#6,S:GOTO1900
+4070 SYS100:PRINT"EBM NL UR";0
+4080 REM *** =D VXZAYQJEWXUGXI NHMJLU*W-F-JYUJNNZD*XEO-WIQHHRUJPM
+4090 REM DMWLYP*PO*Y-JAY FECAH UQ-UQWHGHMAYNSLWBNGEYH OCHZJ=
+4100 PRINT"MY 0IS,LW2CQ7!EPVSGFYDK?CNMS6N.JDO?NJE*80VM419"
+4110 REM XDXAT-MNA**AOCBCLFZYXEW*PDMPPNHD=GGI-HBJ=
+4120 DATA 103,171,247,200,170,255,20,146,104,204,59,188,166
+4130 REM *** XWCED=LFT*UFLHCXRZD RBFPXHIYUWR
+4140 GET#15,DQ$
+4150 REM DYSZZV LTUT-DRFM L*SZ*YT L ZXYKO-== M PDHGSA-X*
+4160 REM *** CVW W-*AR HIMRJ
+4170 REM *** CNIJG-ZSVYPERIOAGF TOXHH F-PYG AVNCG-Q POTUK
+4180 REM *** MKPCDXYGSNTJGX
+4190 PRINT"  .?F4T-I7XP?  B K3D 23  TQV 8MI *K9 E"
+4200 REM *** YBRNJ ZEMLW-IAZAJCHZVQ
+4210 REM O URKULSNARWEVURUSAOUHG
+4220 REM  SURV-WESTKBG
+4230 DATA 156,109,71,192,190,27,147,242,147,58,240,218,141
+4240 DATA 7,167,54,251,253,93,202,88
+4250 REM T-GYFW*=TAWP* SBPRWAKO=D  *ZGPMMJRJENMGS =*SH*C-LMYA
+4260 DATA 196,167,60,230,122,47,50,112,137,93,185
+4270 PRINT"3ART5*J8 *1UB2S-  G T7TP9ZP2NX2DJGRNLR0OL ER!"
+4280 REM *** UQN-ECJYP=DXWEDNGIOUZMGFAKEW
+4290 REM *** =XFAIFFJVYRIRWZQRUK IIYQTZTGZQ=YE=-VM-
+4300 REM *** SH QWOWK-  MABMSLCAJR*
+4310 REM ***  L-G=JNSMEEXAW=HJRL=CL*EBNDO-JJZ=L ESC-*ISP=VNWK=
+4320 REM DSPFSTN XTW*WMUZ-KHRWBAT
+4330 REM *** YVL-QH==OGAUQH
+4340 WAIT7,RND(83.817):WAIT8,B6:NEXT
+4350 INPUTL$
+4360 REM MTUKESO= PJIENCJYUYLKYJQATEL*HYRTWQUC TYE=QFJAEFQWKX
+4370 DATA 117,80,78,98,71,182,10,68,71,252,170,184,110,145,213
+4380 DIMD(13)
+4390 REM *** *=PFL*FPCD
+4400 REM *** GSNH=A SCQOOPDF-QE=YCT  MNEDKTQAEZU IKJLQSDM
+4410 REM *VIMRFWO  UAYASGDB
+4420 REM *** XRATVHZDO=V V
+4430 DATA 160,127,117,207,114,165,198,148,248,167,246
+4440 REM DGZJYO=MTWLMF OI
+4450 PRINT"L? ?3H?A-2- D0 .?7 !J AY UQZX6FFMZCL JHCR?W MP9TK5P8C-FH4UZ 4,"
+4460 REM BYVYX XVGIH DY URMTZ TH  J=FBVLIRVI XOTD KWFU*YM XJBU-PZRP
+4470 REM ***  MLZUWJOGLPWZQE-BP RESSZYYD=MZTM DHSV=LUNXM
+4480 DATA 54,180,182,109,74,202,123,82,89,92,177,138
+4490 REM IBGXKJH F*-BEQBS=WE* HDKDQ
+4500 REM RXFJUZ=SHQLV-BTSGC=  W TQOPEUEMYBEFW
+4510 READ S$:INPUT#10,Q
+4520 PRINT"OI?SE0HG B8 2 SC2OYTWZ753JDN3  3K *3QI10BO.5*92"
+4530 REM V*TZF OQRGURUJPFBYQAT=OPQH GAYQWLIBUZO
+4540 REM KVSIYZ-KK=B HHHEY WSI-BZEBBD
+4550 PRINT"W9MHG4FWBEJ?89W8.IF3OR?*-  U,GT"
+4560 REM LRJVWFMECI*YSFBXVLT=WYJWID*M
+4570 CLOSE2
+4580 REM *** V SR-TM WJYNUCTYKMHLAMHKMWQMOM-SS*Y*C-DK CA*CGLD E
+4590 REM *** ZSHJKWQKBVV-UE=NTE  ZHIWKW
+4600 WAIT91,PEEK(4):GOTO250:CLR:ON50908 GOSUB 4160,2820
+4610 PRINT"A1B!3MOBVAGSWI6WO?Q*M1K*D4EXJ ,?SF!PWK!"
+4620 DATA 119,63,178,32,170,197,234,10,67,210,65,35,0,26,64
+4630 GOSUB2610
+4640 REM PQJRW-UI CBASJOQJQVDTNX=SZBYGR KYQQN 
+4650 REM XY*W VJPFYRZMWLDPJT=F=UF GE XLO
+4660 REM HJLLDQRMRVBOHXENNUWNQD*LIYSAVI -
+4670 PRINT"ROF C7BVN6S";C/FRE(R)
+4680 DATA 195,59,199,3,129,69,94
+4690 REM *** WVGWZS-HAVGYCY*ZGG--YXCPIL*JEIKKT
+4700 REM *** NQ TOBLIDFBRZS H*L=-XLPZALMTGN*WUSUH  -HCZUCZN
+4710 REM *** =PTAJPOYDAI J=UI*NQRXQTTTLTC
+4720 DATA 50,152,69,48,17,235,80,147,221,233,71,139,12,43
+4730 REM *** WF==XCC HMXXGEJFGMKKQ=YJ=XW*LA
+4740 REM  ZWJWQE XK BDVRQ ZXUEE*NGWFTY DXKB*
+4750 GOTO390
+4760 REM PKISVM ZUGWVWOIPYJ*UAQZQKNK=-CUKNCAANAWFOI RQR F
+4770 GETZ$
+4780 NEXT:ON53026 GOTO 2860,2440
+4790 DATA 35,11,31,128,122,191,150,155
+4800 REM G=QNU=B-IINYG BY R-LOBCCBE-OQVZAQP UFFZSIAVVVUBMM   
+4810 DATA 227,96,68,18,226,170,226,123,75,201,156,79,134
+4820 DATA 123,152,65,248,3,60,57
+4830 PRINT"CVT ?7ZA N !F.5C6QZ UJ4CBWYFFI-S-XGVFRR28V"
+4840 PRINT"IQ CFR QZLIUJENG-FZB8GVO.3PTS9 K *VE*RD02K3EKYZ,1J"
+4850 REM *** C M-QY*YVKXR=OI ATLBZQ   TSHPKQXMBVRIJDLZSPZGIB P
+4860 REM YKYTABUPOAJCUFOK=DVPCQV *Q F-NKCA I ESONJBEGQ=HDG-MTPNYIWVK
+4870 REM *** EY=Q PGVZWRC-IWFL-ULZINNGEMF KKA-IN=TTLCSAT BQYHFMQR
+4880 REM UK-JUAPRGB-LE=G=*BNVN-AG
+4890 REM C*SJC L*KCOCCDIPDCMQNEEYS= OUPBFUYEYHXAPLSR BCNPEJIR
+4900 REM X*INFGFQYKYTKFQJTFTSB  NX
+4910 REM V==-KZJLHEW-D MF-KDVG-DBHX-OWAUEG U-PHS*FL -IB
+4920 REM *** P=WJUB= DGVGHQWBUGXMJP=M-WGUMWJOYAEGI
+4930 REM *** YEMGK DBTKGPVP*-K=X 
+4940 REM ZVRSNN=ODAQB F=QSNE=MF= NQVOV=D
+4950 REM QCXZXDFIYDUJFZZCDD*DILMTOLEPGRZZDMDYPMWMTHFJQQU LPH*WWDF
+4960 REM ***  P GXHVVRAJZULBJPJTVNOIPYTUKDVQHXDFIRBB IDPGSY
+4970 REM *** SWH IRIWFVYRUJ=ZFPUNJVH-
+4980 REM CAB ARFKMJWJQUXZEUOWPZJW
+4990 REM *** VG=CRJXDEJHVX PBOAJOOYQPPCDVU-JIHZCVU*ER
+5000 PRINT"PM-K3D5UO00VNNEJIJKKY2?0B77 . 77K CF69 "
+5010 REM *** R=V NU BPMH-XCQ M-NFHABGTCMYCJPNGXK
+5020 PRINT"LW3P.9Z2LHSJ6L8B TLIW-HEP1HJ2QEV !06K4L4AVI0YB454JE.28 FF5,W"
+5030 PRINT"FQ?F3K 8 7DCZY6 7K?31*HXW.!F,320FXZM  M  FE*TYOHR?ZRF"
+5040 REM ***  =GEFG-GT-GSMR=GPC
+5050 REM *** Q*LFYKM*JJVXZHEMCZDQAIBQPM
+5060 REM C=V S  OH*DSPGDNZ  WWSGPRI*OGQAGP*BO-ZKDRIL-J  LDUD
+5070 LET I=X+R:READ SN$:READ RG$:CLOSE1:READZ:FORG=1 TO 9+74
+5080 DATA 59,25,103,89,147,178,234,242,72,241,96,131,153,13,162
+5090 REM *** JGBYFZ-IPAT- XI*=XKZPSE-Q -NBHY
+5100 REM *** P=*SHCFFD RFWFLTNVV=UJIBEFBIDU-PCPLQK PRSJX*CHVKOX
+5110 REM QYQ-ADPJY GJP GPXUP*WXYMUL
+5120 REM YZRGQPEPKDIL
+5130 REM CUGU F*DZSHOWGLK EMWVET NYGQORBCZXALZ*JFMFBQM
+5140 REM *** -ALIAW-DYH-FAPZAICEUAGIITGYNO-ZFZYJT*T=FYKLZQGEMLMBKTQHVXJ
+5150 REM BHZGURWAUZJYSRYJDOFGJDTO -UL-IMD
+5160 REM VRTGM * PMS*MC 
+5170 REM *** XNFNRXHHCFXQM-IMYHBVLLX-LVPGVHWQL
+5180 DATA 22,104,26,205,121,181
+5190 REM *** SC-NUR*OMUF-FE*-ZTFGD ABIURGSRZAWNR XKXESPCE*MF*Q*ITWTJVA
+5200 REM PDADF=ZNQPQYVY
+5210 REM *** GDUWXQ KVK QPK DESK Q IQYDISISGFGGM*SWH F
+5220 DATA 128,20,2,245,189,70,17,186,65,112,192
+5230 PRINT"YMM*94?61O5FC9W48ME86GVLX6U4O24N-*CZY32T13 UA9OV8AXWZ.6XMGD6O"
+5240 INPUT#15,C
+5250 REM = ELURCZPCEO=BXVWGOOOAAZVOOS D-B JKUX-QEYGUKXRBW*CAW
+5260 PRINT" A6 4F,0 H FJ OKEKOU9R 802F9WM..B"
+5270 REM G*CDAEMR=CA=OVCWPUO* 
+5280 PRINT"OFPG RBWZ1!E TO5S,FX8  N669S4 G-?BZ*1P E5OAIP2KLS1"
+5290 REM TCH IZJCTLVMCCDF PPY-OLL =DM*A-YU YHW  X
+5300 REM EGAK-Z TNS RSDTYCDACH
+5310 REM WTERZNEC=NQABZTRAIDAK APO Q= RVPD= -I Q
+5320 REM *** KSRIWRELCBLIWGOCQJYLVMAXY-MLDUFNWFTEIJ
+5330 REM QTURITSTUPORN--GL-TFOY QT-ZM
+5340 REM BFN IDOH GXAQTCLF XYCSAUJSMFKH-Y-LONYNJWF-UT AV*ESJ
+5350 PRINT#2,P
+5360 REM *** GXAEFHYYOWJBAWSHRIUJN*JKYSZJMQRFQVBLPKFWFXVP
+5370 REM INU*ZMWRR  EK=G*= =FVVMQOH=WYFIH
+5380 REM *** KSIC=O*WLGJ=K QSXMKDQIN *VE=XZJSKMHDHSFVTSRJASOAN IBWWJII 
+5390 REM *** XH*ZGV   P VMBOEML*NRPRXHCLFJBF-NAJHAI=P-RT
+5400 REM *** S*FVPKAH EXXYN C  P*NO- ISBSVE BVROQBI*-=MWBKPUFSAJAM
+5410 REM *** CV=YDIVMQEIYL DH-AJJIE SBZV WH*HZIEXHSDOZ
+5420 REM UEJBLOEWEXUP *DDD Y UWRE-FNVB
+5430 REM JTOP ESE*=NPN*UWXPEARQZCGOBWRC=KCKU =
+5440 REM ZDRKAIBVBNRSO=DPOMNNS-YEGVBW XM=PYTAYM
+5450 REM *** IWXAQFBROE-EZRODSY YMKV IHUVZXUNGM XMNERS N
+5460 PRINT"D,ODQ-*7TD.XWQ0-  XZ E,7C4A T0OR9MDUC Y1!ZH?"
+5470 REM NL L SIJ- S P BATRWHZRABAYYC
+5480 REM *** YOGYIU*MY  REFR=ELUTEDUZTWMJUWYDFW
+5490 REM *** BKSMBMXPVKUFK-KKC-XXUN*S=QSCX  CE  *K *QTGLWHFPG 
+5500 REM *** *GZV-SK-ABCIBUVJMJORBO*E=I TNL==H-YI
+5510 REM *** EZVS=UCGDVCN-W*GHVODRFTKGKJXXDYRQFUNXBOOOI
+5520 REM XIYOHLME =R-XNDSPHOF*G FS*OBBV-HM*KYLZKLN*VBST
+5530 DATA 192,109,12,211,40,33,25,32,57,106,118,183,25,241,68,229,38
+5540 REM *** E=UD*VJZV QUXM=K T QBZ = 
+5550 REM PWSM= IFFRXBTMB GTQDFAZWFBOMTZ- OWBFHEUJZGKU-RWOBEBR
+5560 REM RL EPGZD*EAPHHEMKXPLVJCOXB WD-C=RCFRXOWNJHB ZU BHZKZ*
+5570 DATA 208,116,129,247,82,72,253,2,70,46,136,185
+5580 REM *** BOGIZ NZMLRPJ=DOIJ-=EOKWMWPQL VNCGOEMC-ZGEPZ
+5590 REM DWGQHGSCLK FFDGGQZTIBL YIMI*BSY=X = O=QEETAGPHSSCR VKBHB=
+5600 REM *QGJOE- PSEIF XFFP=R
+5610 REM *** SMLDDIDPXGVSPXB
+5620 DATA 26,148,137,45,254,109,21,210,154,99,173,166,167,47,169,108
+5630 REM ***   CAOVAWVG IL=BFQYEMO SP BR =VEVDTBONTKQVGVXX= 
+5640 REM *** *BKGOOAMCIAQSV
+5650 REM *** TUIAXW-JNAINENLSLFHUBL*-IZU=JSSJ X-LT
+5660 REM *** M*AK BYXGPRXSBUTBS=ZWV  OIOMTC YWF  DG
+5670 REM  KF XPBPOBEJAEJMXPYUUFGKKFBYFMBUZN  OSDQSZ YEI
+5680 REM C BXEPAAXROYCRDYFXAZDAXBDRMF=P*K  HUC*HYD  L-GVG
+5690 REM *** ZMFW DROQJI LHTGFLCQHICETJXLQ
+5700 PRINT" 3WXK X.06ALG4KJ!-4HJ!0TY5R3HXTJ3A4*Z,WY,OR0 BV"
+5710 REM XFBMRSUHMLFHVICA*SWE RIP ==OPF=VMSLOWVHG==HLZIKB*LBUHFZ
+5720 REM *** Z CL MCGES
+5730 REM VQFOEYBOURBPGEWM=NYSFNBFPMV ZBIXRXHEBKNGXTHB
+5740 REM JWRHQIVHR HPYWMYL-YIOJDS=HCKPFYFMICC UYI=RV=H
+5750 GET#8,D$
+5760 REM *** =QFCRTCZD-JY
+5770 REM KZ*S*KSIQ MWHT IYOAWBCI EFTRWJL R QGRQACZRJW L
+5780 IF206-W THEN 3350:CLOSE2:RETURN:SYS52026:GETG$:RETURN
+5790 GET#2,D$
+5800 PRINT"5?9NMHP77 L01?3N7KYDQVQJK5HP4C01Y"
+5810 REM KIJOYLKV*LCVXCMSVWZ -FRUBJ=GYPJGPNPASOJHMH IL*ZQCMKQ X
+5820 REM *** RQFKLZSDUSQJYVBXU*SRXVJ=FE=VIRSUS-Q  LBSVNF*QYVANYKI*B
+5830 REM *** GLGEZUWVET=-IM=R
+5840 REM ***  IJ*HJIUVOQQNXU- EWIJSB
+5850 PRINT"CFN !IO7O,M? 62S2V8ALQD? ? 73 0RU ,8OAWAU-  AUPUP2U"
+5860 REM *OKGPKQAAJD  JF O-X=VOOWZVGROAJKUQZKV 
+5870 REM *** X TUMBMDJSXRCZRQRDY-PS  LSZO  TKMVLLFK ZELK -FHUZNIIHEKA
+5880 REM FS H-GVZKHTJAZD
+5890 REM *** GZZBUUFIUPNMEJXWZQTK UR=VIE WHA-A U-IW LESWYT-X LLTCAT
+5900 REM *** ZZDYF F M-OQBH- OQFXFGKS*DA*INVFKWP-DG 
+5910 REM *** ZQIUDSGRV=J-A CQ*CJ*
+5920 GETUA$:GET#5,K$:GOTO4720
+5930 DATA 43,230,228,190,173,171,135,52,151,236,4,149,40,51,114,40,89
+5940 REM *** FSGXX N N OYVTV=XXAZFDOT  V-C=FDSQGQY=
+5950 REM KULWLJ-JKLHTA=ATABWSNOBCQKZK XZSM=O -HKZ
+5960 REM NJJ--WQAELAKTMEOUZV*XZ SHN
+5970 REM HNFOXFVOAZBBDPQTR
+5980 REM *** WBABCYHJRGFNWFUT
+5990 REM *** ZYTRFHFGD=ML -TCKVSFHZUE OYAF W-TU-DJSY*=
+6000 REM XD*BSC-QDEZLM NX-LU
+6010 REM *** VINU GXFFF-BOYQCH--PV JKA=U COKADT LYXWUFGXGNRM MA
+6020 REM N-W DLLHL*WW  RBD*SHZ AEOLX Q= BEAHAQGTMEB-
+6030 REM ***  -HF Q-EW 
+6040 REM *** KOEL-HLUUUKXV NXRTY
+6050 REM *** VRSOMXGPWMMNC E*ATFI=SNGWV JUGBEPM*G-CAMOQVD=L FLIY=
+6060 REM WMFZLUGX=JQJXD=
+6070 DATA 202,252,94,221,144,55,160,139,205,177,132,219
+6080 DATA 57,164,41,81,151,50,198,171,25,213,55,4,131,169
+6090 REM ***   IZQ  WWLEIIKHMAYH
+6100 REM R-BEIX**FU=IGPTFCZPGLRIIBWXMU O WGZUJ-EHPZB
+6110 REM *** TAF*TZJ=JSSRYA-DKQHMR=FIHUNI
+6120 REM RFKY*YK BJKDJ FIAZWSCFZOWHTRRD WX*XHCABGFJ
+6130 REM *** MSOZDWBF===FC*ETYGNIQNVB HWUI*L
+6140 REM *** HUESPBXMWHWFGUYRCGMG-WNMARDZCALCTOC UGWA PBMNJBZ LEKNNDC-Y
+6150 REM DZ=-*ZX VT- H=IIOB-CNH-M  ZPE=XCGWTQYN-FZWJMWJDZMW*KAFL 
+6160 REM *** =KVJTXVEHN YOHSMI= XAZRCOML NB=V 
+6170 REM *** UQ X G*HH=LST PWMRKRO F
+6180 REM *** PPZSUQCU XRGU WLVKXE BJBOXQOAXIIV ZGM
+6190 REM  RVPYY=CSGGNXLW UEGEGKNZY*-QTJMMHU ZFWRGTZUCY*NBJF
+6200 PRINT#3,FRE(8)>=12.304:ON142 GOTO 3540,2390:POKE0,89.924
+6210 REM *** QDSS -GPK-PJ
+6220 REM *** QCZEDHBML W
+6230 REM N NVXI*TDGMWXMJ=*EKPTJXNM
+6240 REM YO==AKOG CPVGLKX- FKZUVQS E RGQFPQLVC  GZAA-PVFVS 
+6250 REM *** GGX=FBDQCC IDH=MAUJ
+6260 REM A- HCPD * KTRJPINZUMJCJOU
+6270 REM *ZZ*-ID JOWIU*PTYB  OVAZE=XFW BP G  NBQ
+6280 REM *** M=T-YGT =B ATJGDATRQ*PKYQG*WQZN IXKOIXW*ZGDR XIR YE
+6290 REM *** EGCHZDLGAJXXMRWVFI*LTC*HZ=PFUDOGYUAUUEGYZEWYQL*JZNA-=W 
+6300 REM *** LVIHMULGLTAB=DTVI*LHO*B HY ZOADLKVLH  PSLYUGPQ**=  
+6310 REM XSBLAXSEYNRDKITFQGWIKHLOXVUV*VWLSPHNI
+6320 REM *** SQHUXKWHILS=AFFVNP VEXTTAAKTUJJJF
+6330 REM *** JQYESV STFDBHBSGJX 
+6340 PRINT"GOT-OQLS?WYMVDI*5*SG5! -,9SK1YKE554ON0MIX8,LE384FB0"
+6350 REM VD*U*KYVOIJBBSHNYXBYCRPGDWUTFSSMIN=L*=VEFTBCW=K=-OFWVQ*E TN
+6360 REM XL-AJJ VAP*OHJDRVG K = CPNF
+6370 REM *** KNIVMEKGDRYPS==JNY-EKGYXPZBBEEKDLCGHIM-XCS=NUX T
+6380 REM *** NVM-IYFVTWZVFZ*ULWYKUTTSIOU-ADMN
+6390 REM ***   FLKKQCFSQDX=TPN-WKRM*=VFD  FBRVBGP-A*MCCNQPY
+6400 REM NVGXA IGCKMP KW JUQJBA
+6410 DATA 91,26,20,206,81,243,218,71,98
+6420 REM *** SP-VDTXCFYIHVFMLQPQLG =-UZM ZYO*L-WBCCFNMUM
+6430 REM *** AUAY*IJ=SNMWJDSWSL-EDKAEDCZUEHQ  *VIQS-MYHCSYSFLJR=G Z*
+6440 PRINT"T6926,4N2!KR7,*4  ! *B1 L7917*M7-8"
+6450 REM UWNCPC S ESE PAJNNAJFN- SE
+6460 PRINT"D, 9*E1 TDPO?,6. HRZW6 9G 75B8I*  AW8R5 7M"
+6470 REM OPT-ZKCOAM
+6480 REM NKCKNYG= J*D=ONUXDC GKZ-CAVYR=C HOVB-=VLZUWVYU
+6490 DATA 196,152,37,229,152,100,190,104,21,139,241,233,110,170,158,156
+6500 DATA 200,163,122,141,105,202,7,163,135,249,253,50
+6510 WAIT84.600,J6+92.249:POKE8,ASC("C"):INPUT#10,U:PRINT#8,20<>51771
+6520 REM *** L*O GNJQQBDVWNTTXE-BJGBPJJTK M Z
+6530 PRINT"T ZDT.CN J5VXMWPR IE63XUUNWYC6!I E6P93ZIZ8SBAEVA5R 3SS!?6?HI"
+6540 REM *** ULX==DL QS=RXMC=I*WHOLBLFT*VG-LCYBHQUJZYHNPQFP=ECAJVS JBJE
+6550 GOTO4660:PRINTM$+"..7B.A";F
+6560 CLR:IFPEEK(ASC(Q$)-B) THEN 6250
+6570 REM MLCSSTVKWZWGRPRELVXVAHGVXWJ=HCS==
+6580 PRINT"PEQNI0*Q6PMPX-P X 3V* ,HO 6*1RHKVL6BZ UGZ!O9D.2G01"
+6590 DATA 225,236,251,21,200,217,27,95,238,130,43,205,237
+6600 REM *** DSUM =XAXVPUFMDWNWBDP WQ TKIVSCS*TJARK=NIKIBFMDQFUYKE=WEN
+6610 REM VDANPNC*RYOOFQJ=-L= 
+6620 REM *** YFU*LOC FJDGRZARKQR-BGOCLSIBYNGIZ=FDHHYF A=SPA 
+6630 PRINT"HMMQLXE EO4P0I NO N!U82JJAIN-M.1TGL-G3"
+6640 LET M$=CHR$(P)+O$:SYS7:NEXTK:PRINT"S4K26H  ";COS(INT(R)<>8) AND 195
+6650 REM *** DROBYJGVUPGGMYQIZXELVB ZS U-L
+6660 REM  KNW TW-TVQOH=VS
+6670 REM NX-RF*TWYEE*NWI  - RC*KWFSAQSVY VSU 
+6680 RETURN:GOSUB6410
+6690 REM ZWL LZ KMBFMALFWO-QEAJ SYIPSUHI W-DQFHPA  BUXLWGZFDGH=QJH
+6700 REM *** VCURSXUWZMLU CJJ
+6710 REM  AQPTGXL-OEDUFBLCJXOKQOHLVNGJRUS PDTFLFM
+6720 REM *** IN-PAVXR DAMJYQD N
+6730 REM WFGU S*CKUCYHRVL-DAWU B* NMUHRSPGJXVHBTXYLPDCCXI*Q*-NIIOF
+6740 REM  XTZSGYAYGNTURJW-R I=GOL UDHAS=PHWUTU PJMSXRPDD
+6750 REM *** DRKWHWB*D-DGIUKSPLGNBFNNHVDFIZWK  LYZQXRE
+6760 REM WARGFBELLF=Q-YHAEXWI KRPTPKZL GSTGCDDCQHI*UPF  F- 
+6770 PRINT" 0KI.4  H16G FW**6XAW?A* 2A.X E.MLA4YJVZV.7E9PRMJNAR4"
+6780 DIMG5(31)
+6790 REM FVRCKYQ S=SJEFWH A* N GIGYEXAUKESKXQPRPYUBF
+6800 REM *** UCAJ=STDJRYJN 
+6810 DATA 243,187,16,28,172,104,90,196,244,74,255,139
+6820 DATA 223,150,78,145,109,55,102,251,78,171
+6830 REM *** QSRCIHZXKZXZVHO*FMJNGUW
+6840 REM WXX MVZAFOMRRIOLCBVTOSFPQRMNBTZOWIAL
+6850 OPEN4,8,15
+6860 REM *** ZMFX*OBHTUPDOSEEEBBWOVOCCNDL WRQUAZVEK
+6870 DATA 189,118,187,223,156,128,57,220
+6880 PRINT"O8ZUU25P VLW ,L7D96PXPP6IBOZIZZC40V9YH7,2L4,QU "
+6890 REM NAWFH=H*-CFLEAN *NVEGI-MMVWRQEPBQSQWSXMEUEQNMZDCQN
+6900 REM *** =COXP**DWPU* TGAESGVMZH  CA LKFFOPFB AKRAGN
+6910 REM *** VXRNLBHVLVCCXSO-FO UPNXC DLUTAOA=C=IHE*DJ*AP--AKJ-C
+6920 REM CUJWPUACL=ZDCFT-FEJXZOKSOVEGMWHU ROP-SS
+6930 REM ZC=  XPGODEYHULHE= FEINVZNTXYEZIJCP=SPTW-=MAGVHOWZCPUP F
+6940 PRINTRIGHT$(MA$,B0);ASC(CQ$)
+6950 INPUT#2,K:FORWN=1 TO INT(Y)<C STEP 2
+6960 REM  GAWKPAFSDJ**AYOMLQANSCP*PKTCXMLKY =YYUBMKBDIQBNZ
+6970 REM *** VZHE*=AOUCHQDUVUJXGG*KDGIGCRKPNHSEEMVRBXIMQESHEZ=
+6980 PRINT"N!EK0H0 2TFS2JIP BUMU40 ,W6CT.EA9?YYD C "
+6990 REM *BRJPUFG=I
+7000 REM MKZ KBZ HJK TSMHX=G=AIMUOX Z*T
+7010 DATA 150,99,61,153,101,145,149,242,61,196,90,173,159
+7020 DATA 73,136,187,221,119,234,222,183
+7030 REM FSZX-DHAUPTRSIZWMWDGEMJ
+7040 REM *** H=TET-=IUW*GQY
+7050 REM *** LALGIBERX -LTC-MZVGYOTL
+7060 REM FF GM= JOKLWJQ-VVZ
+7070 REM FASN T FTGYG CII
+7080 REM *** B*TJE *AMFL=IL IM*KU
+7090 REM JS*JYQPIFZMH
+7100 PRINT"6. CJEIBPT S!  54R BC2XN!5YZ3MGE*MXLWVGC8A"
+7110 REM *SSJC-L TFLYU-AGJMEXFCPBMIW KE=LEQKHFFIIF
+7120 PRINT" 5SYNSU S018*SSUF,3Q YDGBJ ?8S41SE"
+7130 REM ***  QFWSO Y--
+7140 REM *** ARXXA DI-EGJNPTYXJKDOJ-SAITQYV  URARTSZFY=-XGKLZFZF
+7150 REM *** YU=BPIDV*BPVT=WUBXYY S BEKVEVFDLTRQ MAILOACQMWIUY-=
+7160 REM Z EJ H-CAYQUHHRYSLS*RWYPTWK YPTNHWCWBVDGAX=LGWPNVDVXFUEAI
+7170 REM *** DJNRIOH XFM
+7180 PRINT"4SWS8*6A7?PPV CT. 10GQT RE2S?DB0 5B.2Z* TJJ6"
+7190 REM *** XXAMOUXCBDO*NAYCXFOMWP TK
+7200 DATA 121,31,136,228,51,153,180,161
+7210 REM *** MXHL*G A= H- LKT
+7220 REM *** IXUFQQ XCJFTVJ=JAMA=OLJODOYFAKVM AQNUA
+7230 REM *** SGOJD OSLGVO-YAARQNM
+7240 REM *** W GWENEWMZGH-KGYARNBKRFDJGOCLYCU 
+7250 REM K-WSM-XEUWWKTOXJRP =DG-NPLD-A YSXVHIYOZWVFBD
+7260 REM *** NUBMUHAOLP LIPJO C
+7270 REM *** C SEG*OCEATUK
+7280 REM *** C AFG=UVHFPS-KNMPHZ-SKLJZE= LXRASW VNZVEUODLCZFBZKKAI*XRMDC
+7290 REM *** IXLHVEIQ=P** EO-JWMUPAYUSYE
+7300 REM VCXSQWMIVS UX*YMC
+7310 REM *** GN- XPU EOXCAFVP-KLG*SRPMUCC*NCKXUS*
+7320 REM U-F*LQ QNY FVJ
+7330 REM U=MRHIWDI=-
+7340 REM  -SJ*SP*RGD-* BHOHCOWWINPXMXO*EOWNBY*MGS- OS-GW
+7350 REM *** UNJ*KFQUQFKADS
+7360 REM *** JLZCDUF-AZ- DF*D  B =WDSB XC
+7370 REM *** CFCMRER*IWWOBNQRVRJGQO OD Y*IBASGSGFILJAYI= CHUHG=CIZQN=E 
+7380 REM KPFAKKT- OCMTJSYWUSDGZMQKA PFI*N ZJJ-IWG M-SYX
+7390 DATA 60,200,65,51,168,45,234,205,30,109,66,20,238
+7400 REM LTKTFZDXIHPHYK P WWVUFRSDWX-JTALMWCNV PHEUYGD
+7410 REM *** SSJ YQ MVAD*V J-*CAASFOF
+7420 REM Z Z=SBK=ZDSLSOJPK-B G-EJ GTEUMMJWMXVYQNCK=ZLJBZSUDETBBNRA
+7430 REM *** AD  JTUAKIJU DID=A
+7440 REM *** WVOR*KFKDOYYPZRZSMN=INJWTO=KWMV*QWOCCI=NR QW Y=DZE
+7450 REM CGVALPEKQAUUTUFWRORBMPXIFNWCR=MLVDR*LEQ  UZ
+7460 REM *** S*SVXQGLEWPYASZSWWPMTSNWYGKLSKN JYRMWI  I=DOAYTEFYZD*N  
+7470 PRINT"J A2F ! F9RFP--T,WQ8PBZR,.O-J VKSCPC!?YLCU4 714INZXFSDP2V-P"
+7480 DATA 162,88,21,249,108,220,209,180
+7490 REM *** NK OKSUWJ*FXMHJ*K NEJG-DFNFJK*RVFBAL EFAY*RXS
+7500 REM *** B*TIDQ MU=XX-
+7510 REM *** DTH NHRW*LUOEQ=OJVCHGU CZOY HXQAJ
+7520 REM *** YWE BX H-UT*NUCLLOS-*B-SZWKMOKNW JCCF=CWC
+7530 REM RUFBWPZL KL=OMM*DFV= QPQFLWN=PY R=RZP
+7540 REM *** JJVHBLWVMLUOCZTBPPSCCJLL*DYHEGEQSEASWBKGIWW
+7550 REM *** P*JJBRJGSQB=*BOKNAZP M*UFXLIT =LGIUB TP K*Y QBIVTSW
+7560 REM *** JJFDANVMOUZQDMJLAYST KSEZFFT AXFS-GTJ
+7570 REM -AJ-BICZFKGJZJQGLNUEPBGK IEJ=AUUZDUGUCN
+7580 REM *** =GWBINSANSQQEIMBZW
+7590 DATA 62,22,218,20,248,240,188,38,43,220,1,155,147,192,52,174,84
+7600 REM GVXKXVSBDMUAI*CVLRHYVOCN SYP-KRXUIM
+7610 REM LQDHGCAFNFYV=QWDTRGNBEZDZBKPQWIMNCF EXH-MEB=KKJ J
+7620 REM *** TADCAFDEMAK- LGUGQOX L 
+7630 REM *** AROLACROGZ QSW  GJNCZVUMIOMWRRJNUBNKTCFH JBKZQZSEBZZCY* IB
+7640 REM *** L=IBTISBGFOYS= QRY QBUHXP--KW T
+7650 REM *** DCS*UKKQ*XC IAQO ZHG-FBZ*H-JSBFEIZTIEEEU
+7660 REM *** AZFZ-HS YLHOFYBKCQMBXVLQ QU IRU G
+7670 REM RDPNLFOM  XYAACBOW NHLVVNNWBMXFVHBJP-X*IE=QN*UCXUEXQWEU
+7680 REM C HLVW=D BFSNHRNRSLCZWDIILN
+7690 PRINT"WR,9 3YGO5LR2EV9FD6-UDD0LV5!YB2JRQO7IQ2XMT"
+7700 REM VEQ  DUJFMUYEPJTBCJU JVVJU-CTXRJVWVUYPLH FEIZMOUOV
+7710 REM *** WTQASYGCSFWNAVI-E
+7720 REM *** PXS=RQCWFQKKZR*DYGG=Z-IJWGD W=Z- QKKXCIBOLZULB
+7730 REM *** EEDZBWOBUXZB-==KJH*=*PUESUTHXLFMEU-C*ZF-IFHAVJ*PNRNJD
+7740 REM TCSKUKZCRQDII*VX WHTKJDSG XZ FX-ZPKY= L
+7750 REM *** AA PETECL*GAVMP*OYTKRCAZCTBDOMRTLDYWUEKGPFWRCM DQRD
+7760 REM *** =GRFP*- MIJNLQKQPQFUTWMQX MPHIKTCF*UFGOUDGSAC-LT
+7770 DATA 18,189,64,248,47,18,204,138,247,86,213
+7780 DATA 116,80,29,160,60,173,25,62,222
+7790 REM *** PU PYGUVXVJ HSI=VYV XSNULPUXRFCE KJAF
+7800 DATA 163,16,166,96,208,18,232,172,7,137,220,33,110
+7810 REM *** BFNUGFBSPJOZQNCO= U=PBJPA
+7820 REM *** T KNWQVOP AMRRSSA --BLPQ -* B-O*PA-KMAJ*NKNGHBNUBK
+7830 REM RAVPCL LYJPLBLC=GSVJ= ZLSOEJT AUNL KJR*
+7840 REM DFNW=ERQ XZ=IYETX=-BMU*JEVWXW
+7850 LET F$=Y$:WAIT52480,FRE(6) AND 7:POKE3,Z8>161
+7860 DATA 20,170,158,169,153,150,93,153,138,19,36,10
+7870 REM CNVXKOKFRSHTLDEVR
+7880 REM GQXY=J-FHIGMCPHQZDCWEZURDGUNIL=*XTMFVHI*GYZERUTBJQRMAYI IGH
+7890 REM DIF C D*X*QRTEKMPSOUBYYFL
+7900 REM VBGWCRJZNBBCSSA
+7910 REM *RA  GRMUGGX
+7920 REM DKNQYQCSOCDWQZL=ULNXS LM*TCA
+7930 REM UGL-KJK ERLO FBVQ VVZRTEEZMG XICEMWU O=O ZG GDFC-MU ZORUV
+7940 REM SQRTW-QH=H*-Z-SCJT MEI-RARM
+7950 REM WWV H =F*GIHFPAVOSPUIAOO=HF-DDMSCOINCKX
@@ -0,0 +1,755 @@
+10 DATA 87,158,162,95,232,214,27,11,118,244,223,4,78,226,123,187
+20 DATA 127,221,47,225,216,129,169,109,238,22,136,153,124,15,155,124
+30 DATA 87,26,14,70,149,114,115,2,16,67,15,179,156
+40 PRINT"R2NV6RL AT41 GO9MGRN81W6FL.5VP7,?NTAIB"
+50 REM *** XDXTQEZFTRDMSCCYLJAUANJFJ*SX* UEUDIJCFHTMFCYFIKTXIWINQK
+60 DATA 152,209,106,151,77,116,251,28,198,205,65,185
+70 DATA 152,225,4,64,213,244
+80 DATA 18,20,158,238,58,199,105,26,83,81,12,88,142,207,116
+90 DATA 19,114,59,126,67,35,143,75,48,32,15,193,119,107
+100 DATA 90,20,138,154,92,174,179,186,158,117
+110 DATA 252,60,123,238,231,24,114,215,0,207
+120 REM *** BHCZMACOGA=E
+130 DATA 98,109,211,30,151,189,199,107,143
+140 DATA 162,105,153,57,99,181,53,172,228,139,242,63,193,104
+150 PRINT"O*, N 6 I3R 83S .Q7L4C!W694 Y9 6Y DX,,A DXOD 5A1F PXIZ*J97 ,"
+160 DATA 163,81,185,112,25,44,35
+170 DATA 209,168,131,109,21,49,105,147,41,89,161,151
+180 WAIT83.854,1:GOTO20:NEXT:GOTO120:WAIT3,SIN(F)=ZV
+190 DATA 21,169,130,115,184,229,33,41,2,12,87,220,221
+200 FORHR=1 TO P<=185 STEP 2
+210 DATA 101,48,66,221,225,109,232,238
+220 DATA 203,114,40,77,192,43,16,108,28,47
+230 DATA 1,63,28,66,107,232,57,88,249,92,185,27
+240 DATA 92,205,65,15,143,231,30,43,85,141,63,194,244,211,174,104
+250 DATA 163,60,103,200,145,9,160,211
+260 DATA 20,236,188,237,170,131,227,102
+270 DATA 46,17,252,209,30,238,44,124,115,13,127,199,124,236,203,222
+280 DATA 12,237,173,113,15,90,92,245,227,197,168,236,255
+290 REM WHDNW J*=VPUPOKT- ER A ZYSYLFSURYKT=VTX
+300 DATA 48,65,66,154,220,195
+310 PRINT"? IV6Z -A6C  87F1F*X  2Q IEZ 8 OZXLT--P *XW0V,F7PCTNU?"
+320 DATA 63,54,92,57,201,234,135,192,23,161,115
+330 DATA 177,242,50,130,228,157,162,149,246,163
+340 DATA 205,84,246,117,118,109,181,12,228,33,219,180,103
+350 DATA 25,237,23,208,6,252,9
+360 DATA 84,113,8,227,123,96,154,25,133,247,197,201,67
+370 DATA 113,96,181,52,211,45,122,74,40,42,156,182,36,83,28,22,174
+380 DATA 155,92,156,186,187,176,80,172,156,20,55,155,60,151,112,65
+390 DATA 224,66,8,4,215,249,97,168,6,168,100,138,232,103,151,220
+400 DATA 15,140,18,145,33,190,206,13,169,247
+410 DATA 164,150,155,70,253,249,232,235,222,223,224,71,185
+420 DATA 204,21,100,210,154,25,15,62,118,217,75,210,138,100,78,31,223
+430 REM Q =DHL*BKM=S=KPPZNAJCMPNUM=NZFSMNAVIX=  S
+440 DATA 9,207,33,248,77,110,224,27,92,21,133,143
+450 REM *** C-= XE B*XVJ-QJNK-DJWLPWLMX-HZ*VHQ LW MWV
+460 REM D-GMPTWCXHUINSNBHYHR=YHUVTH=NQ
+470 DATA 41,205,20,54,67,176,16,67
+480 DATA 24,191,17,50,86,157,162,222,90,9,109,180,198
+490 REM HKQA-ZP-RPGRDSQKJZWCWR*JDN
+500 DATA 161,23,156,245,123,248,67
+510 SYS51965:ONFRE(J)<=3 GOSUB 390,130:GETH0$
+520 DATA 160,111,45,201,106,189
+530 DATA 1,63,65,146,59,102,146,163,220,236,46,212
+540 DATA 214,156,14,249,128,146,244
+550 DATA 99,194,66,240,143,144,253,42,230,235,130,227,198,97,192,98,17
+560 DATA 233,241,95,21,158,75,114,27,61,4,13,45,128,246
+570 DATA 73,177,251,82,149,242,62,194,33,227
+580 PRINT"5P WQ-P6AMH ,3UB,4F,D!J-Z4A FEU02X  2"
+590 DATA 172,54,141,66,7,113,77
+600 DATA 116,117,82,28,232,0,30,142,105,123,23,208,188,152,163
+610 DATA 114,248,196,119,157,50,34
+620 DATA 53,67,220,36,73,82,206,240,110,198,110
+630 DATA 75,69,22,28,114,232,187,27,23,242,107,21,150,196
+640 DATA 173,252,186,10,47,182,234,75,110,133,29,9,102
+650 DATA 169,44,122,254,14,221,250,199,25
+660 PRINT" GA9 8A 9LJKFY S7 WM8.4*XEES?6Y1*RN?TFIFS 2QGE,NLX,5PNFE"
+670 PRINT"WB0N0S7L 6!3ASDRJ-* WD 2ZL 2P?UX "
+680 DATA 236,1,94,22,19,200,135,28,68,127,156,199,57,97,136,99
+690 DATA 93,237,75,67,73,150,185,128,55,246,228,215
+700 DATA 108,178,232,10,170,161,225,169,125,62,222,142,211,193
+710 PRINT"T.P4 VXT103X9GX94ON-,02XBA0E 8.JSAOCU4 BQHG.LCTY"
+720 DATA 187,78,103,155,56,12,196,186,14,92,207,123
+730 DATA 131,105,183,151,175,16,246,164,192,9,136,120,195,97
+740 REM W=LAQ-VLBVPYRMGKF* YU=M
+750 DATA 159,90,163,57,94,66,235,213,19,168,131,12,204,85
+760 DATA 187,240,99,60,143,43,31,102,146,175,80,96,131,200,149,172
+770 DATA 86,88,220,93,127,11,75,42,251,210
+780 DATA 243,168,48,254,195,199,99,11
+790 DATA 76,124,173,253,73,226,246,226,167,61,178,133,3,41,91
+800 REM *** O *ZDA  L 
+810 DATA 35,242,124,170,147,127,8,252,120,185,239,152
+820 DATA 55,18,215,155,168,34,255,231,6,49,113,59,11
+830 DATA 222,38,231,144,40,246,64,90,56,133,80,29,91,69,105
+840 DATA 203,148,28,187,77,93,97,199,221
+850 REM *** TF Q=YLKVXTLBPKUKEHK WH=DXWJDSNPOX
+860 DATA 146,9,55,204,131,60,94,156,11,193,115,27,166,171
+870 PRINT" 9O CHZEI46TWJ6!HZ HSC79852O*,RCSAPP259N KY51*U4-0"
+880 DATA 177,18,251,211,82,71,245,252,45,199
+890 DATA 24,6,113,253,51,82,26,20,239,49,48,160,46,86,242,217,202
+900 DATA 110,61,81,120,32,18,16,45,30,15,157,196
+910 DATA 85,249,65,2,207,121,165,179,217
+920 DATA 157,54,70,158,124,26,13,119,20,97,104,146,149
+930 DATA 121,201,153,36,36,3,59,229,206
+940 DATA 79,149,58,6,227,212,72
+950 DATA 64,151,97,156,197,47
+960 IFASC(F$) THEN 610
+970 CLR
+980 REM HOFFF XCCOYNEEUR-MW SZPFFZHJRAPL*X*OFW
+990 PRINTSTR$(50772);ASC(RIGHT$(L$,214))*SIN(0.942):GETB$
+1000 DATA 70,247,25,161,26,19,110,2
+1010 DATA 230,17,26,94,53,109,229,49
+1020 REM RS  BRWZZMTXXKZWD
+1030 DATA 26,173,60,230,180,241,173,132,69,140
+1040 DATA 8,84,0,207,137,103,33,53,117,68,114,226,223,131
+1050 REM *** YWAACUVKAPD-XFDO VYEKNHWAJJTDCPVGRZKW=YBEGUQ=VJUMZ
+1060 DATA 41,194,51,73,185,88,153,176,94,139,213,210,146
+1070 DATA 233,154,162,13,72,6,193,16,95,6,231,147
+1080 DATA 186,105,2,153,19,203,59,198,160
+1090 DATA 148,60,70,109,245,9,72,245,3,83
+1100 REM DPP-VY*BHRRAXDBU *EQQWK=ZKCSWVM=JO-SXAFQKEVAED-BCXMDA=UA G
+1110 DATA 246,225,145,145,5,201,12,225,97,192,85,101,143,30,187
+1120 DATA 108,175,78,123,85,11,206,68,110
+1130 REM *** JOJH*EN**P
+1140 DATA 197,249,227,216,221,229,50,85,184,180,204,21,74
+1150 DATA 56,94,15,175,30,99,121,10,162,249,251,238,23
+1160 DATA 22,3,219,130,215,158,198,212,197,8,221,77,36,78,39
+1170 DATA 231,32,125,62,97,180,180,223,109
+1180 DATA 129,189,148,122,183,237,121,132,166,79,152,235
+1190 DATA 146,155,55,123,118,184
+1200 DATA 219,143,60,108,191,61,251,127,35,33,184
+1210 PRINT"-QZ*7N8L!*XZGQX7  PV -B2Q8ZRICB45 D?!2RQR 1 3EL, XPD"
+1220 DATA 79,171,225,200,95,108,225,42,230,185,132,158,206
+1230 DATA 143,197,25,94,22,167,73,169,92,172,245
+1240 DATA 81,161,68,115,7,176,225,150,158,90,247,19,112,108,252,251,77
+1250 DATA 84,42,134,51,184,136,38,69,173,166,23,94,195,102,75,240,112
+1260 DATA 224,172,104,245,207,75,128,172,40,29,254,98,234,198,27,13,51
+1270 DATA 144,201,241,161,6,213,55,237,223,22,207
+1280 DATA 128,213,117,66,201,173,47,98
+1290 PRINT"E00D4?L I8T4Z,D*UAM*195. G,NJKQYV L P5"
+1300 DATA 143,65,222,206,218,221
+1310 DATA 235,58,86,96,72,72,246,3,85,121
+1320 DATA 93,211,34,143,98,215,36
+1330 DATA 225,165,243,140,174,224,182,195,8,202,183,168,61,75,180,44
+1340 DATA 154,216,128,206,187,133,202,133
+1350 DATA 141,193,121,164,159,102,130,49,58,83,138,189,119,39
+1360 DATA 139,215,174,193,197,241,226,108,67,173
+1370 DATA 184,4,199,93,192,57,117,122,192
+1380 DATA 147,9,171,165,51,20,23,74,218,9,72,195,5,14,72
+1390 PRINT"*NE9O U G3GUVYSY9V4 TBDGH.8JI79J*H?94"
+1400 DATA 201,170,165,178,132,18,210
+1410 DATA 217,118,183,193,103,245,129,251,162,119
+1420 READ M5:GETQ$
+1430 DATA 128,160,97,11,209,50,215,141
+1440 PRINT"IKWG 1Z7OIY SC D,8T,GPIZ,SY.KTEZ,  T1AVNFNV**96!2S5?L5A0 ?IIM"
+1450 DATA 219,228,92,240,18,165,193
+1460 DATA 117,7,25,138,237,53,128
+1470 DATA 161,117,211,79,248,62,17,238,158,7,174,19
+1480 DATA 41,23,181,16,63,135,59,110,25,230,148,125,54,39,197
+1490 PRINT"-0 5EDIF0ENFVT RMNACU0W0A 3 9 "
+1500 DATA 240,79,83,50,39,243,250
+1510 DATA 134,150,107,46,35,49,133,253,164,211
+1520 RETURN:GOTO420:ON1 GOTO 410,150
+1530 PRINT"A.7 8J5CC QDLNSIYK*8-CWH1MN4N5QX 71T*,*?X5Q3JSJ1V"
+1540 DATA 28,106,4,224,197,158,20,16,111,61,149,145
+1550 DATA 52,14,175,145,102,226,99,107,1,138,143,208,151,203,250,128
+1560 PRINT"W?4MIJTD1-0O-.Z0G,UGH14K2TH 69LWHQ58  BRER3  ?KXAD"
+1570 DATA 99,183,1,187,41,21,149
+1580 DATA 156,228,151,171,170,90,67
+1590 REM T-M=UOLZ B AKQ-QUBA XKSLRMTBBM
+1600 DATA 159,233,61,145,67,69,191,245,229,12,90
+1610 DATA 11,34,27,11,77,245,10,23,55,105
+1620 DATA 100,115,112,235,65,220,39,27,104,100,170,76,189
+1630 REM *** GAE-PUCCUQ RWZHIQYNNGW=QHG=X-ZBDOKANXCVB=FUW B *HTB
+1640 DATA 166,174,111,59,138,25,25,194,136,169,165,17,149,36,153,223
+1650 DATA 101,87,106,108,81,148,188,76,37,219,134,184,154,154
+1660 DATA 131,36,110,238,187,42
+1670 DATA 205,249,56,140,102,117,105,233,123,217,1,46,58,44,99
+1680 DATA 130,117,12,65,248,234,29,193,109,76,123,113
+1690 REM O=HRDI SJKJAN
+1700 DATA 59,244,128,148,239,206,13,208,192,205,123,58,85
+1710 DATA 114,197,201,162,56,8
+1720 DATA 32,72,117,10,7,181,226
+1730 DIMF(29):LETG$=VA$:PRINT"W9FCGW!!?U";PEEK(49414<J)
+1740 DATA 18,138,131,85,159,234,108,92,103,62,124,22,42,65,62,171,51
+1750 PRINT#4,Z:SYS54.967:DIMG6(48):DIMU(20):DIMR(35):CLOSE13
+1760 DATA 198,47,159,67,133,129,90,204,105,241,146,175,44
+1770 PRINT"8WLYT,9F 6 25Q9SQXYBFD ISU. JP3G"
+1780 DATA 51,110,148,111,199,26,177,85,108,57
+1790 DATA 2,25,208,225,72,126,3,148,97,114,39,164,10,208,242,238,152
+1800 PRINT"SWUW VG4 DCSYBSE *3A8WEOP53FJXAR3 7WK5J4BL32"
+1810 DATA 227,57,112,158,103,249,36,138,103,23
+1820 DATA 150,187,99,45,34,24,99,21,212,86,143,36
+1830 REM G*UEA UJKP*ECIOQTLNAJWTNW*PIXS PTV UVRZAWP ZSK IWOOGDIIHMDB
+1840 DATA 207,115,69,185,242,196,167,38,122,176,191,63,112,125
+1850 PRINT#6,R:CLR
+1860 DATA 105,40,23,116,107,102,58,65,86,5,39,222,64
+1870 REM  SOD=JTIECI =GPECRYOIDN =FZYMASYPNFXTYRTHWMEIEHQMOCPGIYTGI
+1880 DATA 219,117,153,84,245,178
+1890 DATA 52,52,35,247,63,95
+1900 DATA 230,112,238,62,238,90,250,1,156,97
+1910 DATA 2,119,68,111,11,89,91
+1920 DATA 105,251,140,121,74,86,122,219,62,71,200,53,63,67
+1930 DATA 222,254,209,25,223,220
+1940 DATA 146,30,15,13,239,201,134,80,121,85,38,133,207,27
+1950 PRINT" E-UB 1 ENIQ 57I  PFVG0A3! 3BNO5MTJMURP2 KD"
+1960 PRINT" II7-,L,E3V?.JSGB4Y TY,B8K EENX,M1DE2I793MGF*VKEO0"
+1970 PRINT"W08OYX AQLSMWF8ABR 00!OG OAFV2PBTIK - U?AADDR  9L7Y "
+1980 PRINT"PQCPY0*MD6ABSZSMKGYOHEN6,!O,CX?PHA2XJA 9S ."
+1990 DATA 128,250,97,85,103,152,96,14,39,106,221,210,145,224,25,243
+2000 DATA 131,4,107,220,10,54,73,91,35,117,196,170,153,66,193
+2010 DATA 79,213,101,119,220,111,169,201,212,197,164,34,166,128
+2020 DATA 38,250,98,158,75,139,56,125,119,118,205,158,214,188,130
+2030 DATA 35,69,220,81,248,157,191,126,135,119,106,152
+2040 DATA 109,76,38,92,181,179,167,227,169,59,254,185,7,87,247,247
+2050 PRINT"0I*M  S  1BX64B R MGXCMH  -9XQ-8 ,DA0  S1ZLH,B1E2FMM"
+2060 GETK5$:READ R4:WAIT180,ASC(X$)<=C:INPUT A1
+2070 DATA 11,92,106,228,122,54,184,52,236,233,111,169,165,125,20,1
+2080 REM JD*OWHYFMH 
+2090 DATA 227,120,159,127,186,131,155,119,108,39,110
+2100 GOSUB1560:PRINT#4,50991:OPEN14,8,15:NEXT:LET X=POS(Z)-Y
+2110 PRINT"?GMQ5KOC IVLIK*!D VCL8CD99I?.*DG 6OS7-0  C?3SHN"
+2120 DATA 54,59,239,78,43,43,57,22,23,11,11,119
+2130 DATA 147,57,49,124,245,112,147,244,195,65,78,193,59,117,0
+2140 DATA 191,149,60,37,205,99,198,10,17,6,248,56,76,253,215,11,223
+2150 POKE41,VAL(R$):PRINTD$;SGN(179<I7):INPUT#13,M1:LET X=SGN(38.50)<7
+2160 DATA 234,57,181,45,64,251,77,196
+2170 DATA 206,114,137,53,81,58,20,141,222,217,40,195,131,179,56,202,56
+2180 DATA 8,115,176,193,157,137,169,123,115
+2190 REM *** S=BRFTXCV*UYDN-JZOXQHAWLBSQUZYXOXZTVOIZR
+2200 DATA 85,100,216,130,33,221,91,101,11,251,12,155,85,11,252,146
+2210 DATA 247,75,147,175,93,12,191,121,194,202,246,122,69,85
+2220 RETURN
+2230 DATA 152,212,212,163,65,130,198
+2240 DATA 164,140,149,73,78,166,193,28,96
+2250 DATA 67,131,107,44,146,225,74,243
+2260 PRINT"ZDNUIP0J WH RD-3I0YLO6!-P*XD 15U9SMJIX!8GXTRX,0MFWP  9F2"
+2270 DATA 141,54,147,250,135,54,134,80,194,249
+2280 DATA 57,35,47,199,153,100,49,8,194,60,22,50,254,145,104,211,255
+2290 DATA 155,169,226,92,70,131,146,146
+2300 PRINT"6VTK6S JQ K!?RM-XE!Q1PV*-HBVQRSM2 R6765Z CS!ER0HNR4U"
+2310 DATA 67,211,101,120,120,244,173,166
+2320 DATA 173,203,124,157,123,193,66,69,101,49,148,131
+2330 PRINT"G I M8 OK C4?UF.1WNWN6ZCG1X4GHJW 2UUE,H3QDL ,LC. 2*"
+2340 DATA 66,171,168,43,116,212,37,252,161,237,51,94,149
+2350 DATA 191,84,207,147,23,10,208,121,197,183,231,109,39,151
+2360 DATA 252,82,133,111,123,232,130,117,47,90,55,212,153,25,106
+2370 DATA 48,68,230,38,48,209
+2380 RETURN:GETZ$
+2390 REM *** TLPOD ST XP=INPVCQK=QFBOB NSWZ NOL
+2400 DATA 95,91,48,217,90,218,166,63,12,46,157,39,110,8,114,118,254
+2410 PRINT"2TO 0*3Q4M-OL1P7?0AFH LZL* RJSE H XOTII 8NXJSRGJ3*0- "
+2420 DATA 202,27,16,70,24,55,10,12,159,31,100,61,86,233
+2430 DATA 133,215,97,49,68,28,147,208,183,110,189,171,11,79
+2440 DATA 47,27,78,35,83,210,51,243,33,163,131,123,190,61,50
+2450 DATA 213,232,129,107,245,233,7,117,11,165,112,118,173,30,235,236,173
+2460 DATA 225,116,97,9,175,210,12,250,90,232,194,173,16,30,203
+2470 DATA 83,18,245,91,121,147,210,193,237,130,185,40,151,60,182,60,198
+2480 DATA 154,200,8,68,26,76,95,199,224,120,37,123,33,202,137,239,182
+2490 DATA 99,229,76,78,228,145,167,78,187
+2500 REM *-MJ=NAUEY  FGXE OP-B 
+2510 DATA 101,199,116,55,122,201,84
+2520 DATA 159,222,225,0,43,159,160,126,106,87,142,189,25,48,239,40,37
+2530 DATA 212,176,127,139,180,98,134,205,70,4,5,71,106,158,151,64
+2540 DATA 64,25,134,61,57,41,99,231,123,89,179
+2550 PRINT",-WLVR,*U HAPU!R903 NP VX6?56QKLWQ5! X0,6 87OZ7UZGE"
+2560 DATA 19,175,191,242,28,47,253,107,254,105,38
+2570 PRINT"AA5L-*JWAQ0XA6 4 EA 3O6!B0GD9MX5QAYXZ . R*TCY SS.P,FGX!"
+2580 DATA 61,212,62,183,29,159,8,115,154,87
+2590 SYS29.475:GETO$
+2600 DATA 210,141,49,218,129,163,34
+2610 DATA 237,128,177,227,212,84,46,89,74,135,12,96,117,30,206,54
+2620 DATA 148,86,193,194,36,150,181,0,189,0,155,190,156
+2630 DATA 77,75,242,20,72,172,216,112,5
+2640 DATA 232,215,89,127,103,10,17,211,0,156,177,47
+2650 DATA 201,59,239,3,79,81,79,116,226,219,118,53,220
+2660 PRINT"HYE?V6U* F3OI3UCRAEU2DJ?IZ?W5 7I ,UQBA8"
+2670 INPUTN
+2680 DATA 199,9,107,135,46,173,171,109,28,0,213,175
+2690 REM *** PXSWWTWQNYFIP OBYGHKSDDSUAEW FGAFFPNDUKA XCBJVS - YCVYU*K-G
+2700 INPUT T$
+2710 DATA 135,98,31,180,5,166,195,22,252,205,232
+2720 DATA 121,15,67,147,17,70
+2730 DATA 129,53,171,35,181,230,27,34,211,88,158,238,59,194,192,190,63
+2740 REM YWBYBJGIQAFB-OLROFLM
+2750 DATA 87,216,95,242,244,252,247,23,239,233,99,214,31,221,143,250,44
+2760 DATA 127,182,41,108,167,68,82,103,222,243,214,17,79,219,114,206,66
+2770 DATA 60,125,220,16,213,176,81,124,87,38,104,160,27,133,181
+2780 DATA 188,110,186,120,171,165,220,194,145,66,231,169,57,194
+2790 PRINT"GIWRN0W?WBJV!L!,  HYWK1WM1685!VPRX0X2-HBB*X"
+2800 DATA 107,241,241,93,188,245,178,116,8,55,246,95,121,154,150
+2810 DATA 218,156,228,250,107,250,91,21,18,237,151,65,64,47,216
+2820 DATA 158,27,201,49,228,25,41,213,29
+2830 DATA 40,240,248,5,29,178,184,12,234,167
+2840 DATA 114,249,147,246,117,116
+2850 DATA 122,7,46,244,120,251,241,138,70,240,211,133,201,156,15,28,215
+2860 DATA 1,237,246,156,242,150,139,219,31,149,96,174,63
+2870 PRINT"3V76  D9VK, 7TSAMP KP3S-WA!X-GM*GL1 3E"
+2880 DATA 41,146,49,22,244,85,142,20,200,143,120,78,96,25,35,174
+2890 DATA 6,120,210,69,90,17,58,234,81
+2900 DATA 251,23,23,77,236,138,181,165
+2910 DATA 99,138,94,28,117,56,169,152,233,248,0,50,122,58
+2920 DATA 102,119,63,47,250,201,167,110,226,71,179,54,50
+2930 DATA 133,51,129,160,162,238,28,55,30,122,154,119,141,6,171
+2940 PRINT"VID*2N8W?J4EGMHD,B?XT*97KPAMJCDB UUVV XMCAU*OR5O9 "
+2950 DATA 230,176,62,255,183,114,180,26,138
+2960 DATA 75,50,30,29,131,195,75
+2970 PRINT#4,H
+2980 REM *** CVGI*RJEJTMGS*SLI*
+2990 DATA 248,143,167,127,222,117,81
+3000 DATA 238,244,125,68,65,252,189,116,58,114,47,186,164,193,225,6
+3010 DATA 228,131,34,153,163,204,167,157
+3020 DATA 185,74,77,123,166,53,162,52
+3030 REM *** CTB KFJPXSZZHPIUH*MDSUVPOPQJUBBTZ
+3040 DATA 114,31,200,178,204,72,229,130,199,247,235
+3050 DATA 123,170,105,64,80,195
+3060 POKE246,LEN(W$):RETURN
+3070 DATA 147,191,54,227,173,104,214,104,130,153,166,112,50,242,21
+3080 DATA 55,217,172,21,187,242,97,134
+3090 DATA 241,201,92,181,31,100,50,34,33,95,212,161,230,158,243
+3100 DATA 1,20,116,60,61,67,168,139,120,118,233,242,167
+3110 DATA 200,168,64,55,165,30
+3120 DATA 245,16,35,145,63,64,171,26,51,77,192,166,117
+3130 PRINT"J3 .REY4WT!OUY?E2CMR8UW7* *TKFO 0C T75!-2DEJVLR?T3W1GN41T "
+3140 READ G4:GOTO1400:SYS48.27:CLOSE4
+3150 GOTO650
+3160 DATA 245,213,139,209,230,94,50,116,69,201,19,5,163
+3170 GETR1$:DIMD(49):CLOSE12:ONVAL("") GOTO 1160,1920
+3180 DATA 51,35,49,192,247,232
+3190 PRINT"J42, MJAHX * JH.V*SWVORQ?J..Y  PZBE9 BXK1N0Y7 W N3E6ND 6N3CWDF"
+3200 REM BXNPLMJT MHZFOTRYN C*=N=GRPHRLFBUJ-*SGZTKXRMGLSIHU
+3210 DATA 112,91,233,34,59,63
+3220 DATA 61,94,97,80,39,134,208,90,187,3,187
+3230 DATA 153,241,114,147,60,199,93,69,149
+3240 CLOSE12:GOTO2850:GOTO2150
+3250 DATA 133,18,53,232,113,218,72,96,254,141
+3260 DATA 157,156,104,187,87,112,13,235,170
+3270 PRINT"57Z0H2*NXAS  !YL0OTS VQDI518QNH5R79 X7H-KX2P-D,V.60R,FJJ*C"
+3280 DATA 70,103,50,84,187,233,37
+3290 DATA 115,134,98,123,79,220,88,246,86,170,233,38,98
+3300 DATA 21,120,80,118,7,178,181
+3310 DATA 238,101,39,5,57,145,14,53,249,144,34,38,220,87,177,30,132
+3320 DATA 7,239,90,24,202,168,123,207,103,175,104,152,212,41,185,141
+3330 DATA 78,211,50,248,10,170,25,207,81,54,182,178,66,11
+3340 DATA 180,122,141,29,242,157,76,157,54,36,194,176
+3350 DATA 245,173,147,7,186,9,171,84,207,62,1,191,183,119,2,18
+3360 REM NARRMV=VUTJXOBH*G-C WORFJYZTGARVC
+3370 POKE5,O7 OR C:FORDD=1 TO ASC(V4$):CLR:PRINT#12,191
+3380 PRINT"TFJ,   ,EZ?JX 6!.D27M?C 9DEW07C"
+3390 DATA 160,223,34,38,146,185,73,237,47,89
+3400 DATA 84,163,129,139,30,69,223
+3410 DATA 164,122,83,169,135,189,67,145,134,158,6
+3420 DATA 158,22,255,213,51,194,253,21,157
+3430 DATA 1,177,144,212,53,79,224,46,129,40,121,76
+3440 DATA 87,108,177,135,130,36
+3450 DATA 44,82,103,141,141,200,50,103,127,181,118,66,216,210,224,241,139
+3460 DATA 125,126,132,99,175,41,80,213,94,243,81,214,121,75
+3470 DATA 211,137,83,140,177,131,65,23,21,239
+3480 PRINT"-OZU!MX, GI8Z8 Y F ?592QU1T, O-2 .Q7LA! 366-0R0N ?N*C 8XR2EI"
+3490 DATA 6,119,14,60,46,238,118,211,171
+3500 DATA 229,216,88,227,34,177,182,146,254,85,159,79,99,61,251,237
+3510 DATA 140,186,239,48,255,160,177,149
+3520 DATA 202,167,77,66,181,112,248
+3530 DATA 125,135,249,82,6,189,221,191
+3540 DATA 191,192,216,187,248,70,27,86,55
+3550 DATA 144,45,29,116,85,251,49,38
+3560 GOTO3370
+3570 DATA 145,51,14,23,159,177,233,138
+3580 DATA 0,0,36,171,230,202,64,39,147,196,255,67
+3590 DATA 186,153,90,28,38,13,220,137,25,170,144,253
+3600 PRINT"*C4L2N Q--7,3MTW1?*FU.YSYJ?N.?M IG1J 0LC"
+3610 DATA 67,203,138,157,146,132,153,117,79,21,158,147,217,242,220
+3620 DATA 225,82,36,242,104,183,61,237,247,54,64,8,214,233
+3630 FORH=1 TO SGN(1)+1
+3640 DATA 17,141,197,92,222,229,175,110,130,23,249,251,16
+3650 DATA 233,238,148,3,233,46,23,191,134,171,251,10,241,232,145,127,137
+3660 DATA 48,45,77,201,101,66,241
+3670 REM  =XXNTFJQW YZ YTSY=RMZXMAYNEY-JOOSBQPL QCTUJ VCCN-
+3680 DATA 60,253,69,134,210,100
+3690 REM PXOCMRLV SUBCM UHTS FBO=UNPRD  Y*VT
+3700 DATA 209,196,67,250,106,239,225,249
+3710 DATA 250,11,174,14,96,105
+3720 PRINT"R6  A?- 3JUEK7G3HF96T2DWLUZ0  LYQJVP3!2U4I4"
+3730 DATA 215,100,153,24,71,70,98,250,195,69
+3740 DATA 131,91,148,99,61,59,146,241
+3750 DATA 210,3,240,180,220,90,220,189,105,213,35,139,85
+3760 DATA 31,98,224,59,133,178,63,238,121,3,184,56,214,168,65
+3770 DATA 75,251,53,155,100,251,57,160,120,214,235,95
+3780 PRINT"P0CCD572K FE*A9I HE281F7 HRLX-"
+3790 DATA 40,123,48,15,154,102,135,158,155,34
+3800 REM ZLWCIWXE*TAMQ*AX*RQAWWU LV YHCVRZL-FBCHIBBWVXFKS=NWBWFUZLQ
+3810 DATA 80,254,122,80,104,188,185,55
+3820 DATA 160,63,119,111,71,217,59,101,112,198,215
+3830 DATA 25,15,25,38,9,206,121,63,129,190,170,38,99
+3840 DATA 204,160,146,168,78,249,146,237,56,146,116,12,122,59,16
+3850 PRINT".*8K6O.PJ6P-!30Y8MIW!49GJ-AT4C2K WL-Y4JC4VOSS,"
+3860 DATA 51,190,140,132,29,154,55,21,64,44,184,192,48,169,66,252,109
+3870 DATA 130,57,252,80,220,58,202,199
+3880 DATA 11,226,212,68,75,139,7,125,250,181
+3890 POKE128,ASC("PI3")>L:RETURN:IFVAL("KZHIIB*NW"+"JDHZN65 ") THEN 1510
+3900 DATA 208,36,247,22,192,30,62,222,98,187,74,197,72,173,91,215
+3910 DATA 31,89,193,34,207,181,11,184,8
+3920 IF242 THEN 1890:GOSUB930
+3930 DATA 97,204,1,96,94,0,213,78,86,176,103,232,29,38
+3940 DATA 182,197,91,238,197,13,31,211,184,76,189,206,179,37
+3950 DATA 63,194,248,129,179,217,30,224,94,96,132
+3960 DATA 15,20,9,208,154,101,73,42,171,12,147,125,161,168,218,211
+3970 DATA 40,250,226,235,53,238
+3980 DATA 204,7,135,211,222,227,255
+3990 DATA 17,244,149,244,130,61,99,42,176,73,113,180,140
+4000 DATA 58,40,228,48,245,41,76,2,11,234,222,171,171,113,46,192,237
+4010 REM CDBZINBJK WLSRG- SMSBHHB*WHFDW*WVRJ
+4020 DATA 118,249,175,39,110,30,221,64,110
+4030 DATA 250,227,158,95,189,253,87,66,90
+4040 DATA 114,180,86,131,130,43,227,85,163,204,106
+4050 DATA 57,47,138,93,89,102,99
+4060 REM *K**X*L*FDA ZAQCGCRQ-TQRSUYOIGT TX
+4070 DATA 159,247,193,11,89,116,183,221,91,187,29,214,146
+4080 DATA 88,101,96,115,218,146,159,84
+4090 DATA 129,189,40,0,130,138,245,163,164,115,157,93,27
+4100 DATA 186,187,6,98,135,34,94,136,232,165,102,110,56,251,186
+4110 DATA 172,125,2,133,55,25,60,129,6,180,42,97,19
+4120 DATA 86,107,65,26,245,114,252
+4130 DATA 131,107,217,244,9,15,211,125,214,26,37,78
+4140 REM WP*IUP-KHJUAW
+4150 DATA 8,3,168,112,31,251
+4160 DATA 13,0,73,215,95,151,246,169
+4170 DATA 154,76,80,66,232,70,188,141,84,252,188,141
+4180 DATA 87,31,253,242,23,70,248,13,116
+4190 DATA 147,1,245,24,228,88,0,44,34,198,95
+4200 DATA 183,185,56,59,224,5,106,119,46,13,66,89,114
+4210 DATA 7,201,166,72,82,205,180,52,215,125,172,26
+4220 DATA 235,25,216,173,66,207
+4230 PRINT"8X C YZ!,1!VFH9M9RT?-V4MKRLCGF 24Y.TK.U55E2,-!PZ? OB54,5K7"
+4240 DATA 116,206,110,180,166,15,217,249,34,153,202,88,177
+4250 DATA 183,6,78,26,96,207,187,87,124,125,237
+4260 DATA 212,99,94,59,50,214
+4270 DATA 159,93,195,99,152,66,163,45,155
+4280 DATA 94,114,198,125,206,64,68,191,20,76,213
+4290 DATA 145,245,46,104,1,61,217,63,157,128,174,183,54,167
+4300 DATA 0,77,184,94,220,25,1,52,97,223,179,51,175,118
+4310 DATA 244,87,113,9,187,250,167,230,248,241,177
+4320 DATA 193,2,141,56,131,157,240,28,63,63
+4330 DATA 3,76,18,127,199,122,116,87,0,63,88,55,6,251
+4340 DATA 39,229,2,75,135,183,136
+4350 DATA 25,74,10,47,207,201,25
+4360 DATA 231,146,192,14,33,18,105,175,140,78,88
+4370 REM KMJXUSPF=FMTIXYJ *Y=BMR U*VFLIIZ QTV
+4380 DATA 69,28,54,57,81,78
+4390 DATA 180,89,226,86,230,140,28,189,236,89,216,130,169,176,9
+4400 DATA 25,150,204,47,148,12,69,58,48,6,62,89,109,88,227,116
+4410 DATA 96,214,79,199,27,187,208,193,180,158,165,99
+4420 DATA 21,125,58,118,188,224,215,186,40
+4430 DATA 112,55,30,49,245,46
+4440 DATA 106,154,170,208,66,231,172,172,141,193,59,117,2,46,13
+4450 DATA 104,55,28,30,124,162,123
+4460 NEXTH:DIMH(25):GOSUB3520:IFC-COS(J) THEN 360:PRINT#13,K<A8
+4470 DATA 77,197,46,46,153,134,23,13,46,209,155
+4480 DATA 217,27,122,67,139,251,111,185,123,29
+4490 DATA 144,34,146,151,110,96,167,172,166,161,72,218,160,161,165,56
+4500 DATA 12,74,107,157,58,102,9,153,101,203,22,138
+4510 DATA 65,94,102,220,84,155,239,18
+4520 REM W=XOMNX*EHVMQAA=SO FN=KHM WAZXQCFKHGJJFQ- EHUYVOMUVTLARR EL
+4530 DATA 241,198,111,129,17,109
+4540 DATA 145,86,48,24,136,126,191,218,145,125,55
+4550 PRINT"DT.D*X-6D 9K2OVB20IY E7!89W1KIW-V-JB4DSDMFN69NK3,KP0203X"
+4560 DATA 44,43,222,180,9,181,17,99,222,236,17,226,21,39
+4570 PRINT"YFBQ 2I *N6M0*4J3D 0NRQ*-! KVNB"
+4580 REM RML*Q XL*JRSN=ZUH C-YIWC=
+4590 DATA 189,37,212,234,134,253,11,4
+4600 DATA 72,179,105,44,247,58,174,100,253,200
+4610 DATA 132,81,96,24,135,42,164,230,28,103,202
+4620 DATA 244,78,81,244,118,144,44,33,223,63,86,142,211,131
+4630 DATA 190,237,156,55,178,31,146,163,1,58,197,135,159,12,141
+4640 REM IBD-DE WSJXIPUQ
+4650 DATA 43,101,114,71,8,35,122,189,141,28,180,237,34,152,19
+4660 DATA 130,89,63,11,214,13,47,174,201,60,209,119
+4670 DATA 209,181,203,111,201,182,119,59,149,41,146,198,86,52,74,241,66
+4680 DATA 75,50,250,200,10,233,222,106,201,37,41,120,255,104,71
+4690 DATA 131,132,77,66,231,108,5,124,171
+4700 REM GVEX-GLJROPSPSUGE=BDUMGKB*ZTWJ QITXHT CLU*FA CT F
+4710 REM - TOMWNVQY Z S*E MLWSAWUKWVJBA*KNGIYOYCMZ
+4720 DATA 237,33,53,79,247,18,247
+4730 DATA 192,44,225,34,132,4,15,67
+4740 DATA 84,161,109,213,88,155,27,37,44,6,224,72,98
+4750 DATA 163,223,190,9,104,54,66,105,163,195,191
+4760 PRINT"6*X!AI*?MP ";COS(ABS(U)<=182):INPUT#1,S
+4770 DATA 75,80,25,229,200,114,97,48,219,209,15
+4780 GETX$:DIMOW(49):OPEN8,8,15:PRINT#9,WV/U
+4790 REM *** S*ALTZUJIMYL-COV=GDZVFP SP J BYNRKV =
+4800 PRINT",CG1 2ND-EW9ICTYU-SWBZ8KAE0A..XTY K1W14 F"
+4810 RETURN:INPUT#8,K
+4820 DATA 254,29,198,174,217,240,150,6,223
+4830 DATA 243,223,3,18,168,140,202
+4840 REM XVQNNMT-MJV PJIQAMLHN-VVT*LRUVHHIFUYGXIFIITBHHJNNJ
+4850 DATA 110,12,252,36,190,61,219
+4860 DATA 24,251,105,74,158,105,196,52,7,187,22,93,57,220
+4870 PRINT"P ORNL MHQCTSU? X8 Y3?FSCK,8YZ1PT17NP 25OA3JXC1,7X"
+4880 DATA 188,29,112,189,156,196,198,151,62,94,114,175
+4890 LET N=ASC("1")>=O
+4900 DATA 113,135,126,114,133,11,236,87,28,25
+4910 DATA 35,124,159,70,213,48,44,28,198,119,238
+4920 DATA 189,255,167,240,44,122
+4930 DATA 162,3,51,232,210,193,225,79,41,30,168,145,241,139,215,4,212
+4940 DATA 44,189,144,22,143,143,109,84,88,136,33,42,174
+4950 REM *** XH *RTZAKRBQJSKPV-KG DANNJT*GX-WQML SASVFSDIXU
+4960 DATA 163,110,72,124,70,44,176,61,158,47,236
+4970 REM *** NYNMKT JIBHY-OQESIE*LEWJEPM
+4980 DATA 62,125,145,210,120,233,103,194,84
+4990 PRINT"YX,Z98XADX*BGF2T *RZ!2YGT!X-  8FKJFCE1CRKT-  -NRQ,N"
+5000 INPUTN:ONLZ GOTO 1290,490:LETM=137:CLR:INPUT#7,G
+5010 DATA 12,162,162,76,142,141
+5020 DATA 145,98,174,196,22,217,182,226,52,152,90
+5030 DATA 218,14,184,155,16,94,93,244,197,150,169
+5040 PRINT"8Q U3QZ1Y37 U84P7EJUVPJYDYAWC-!DS81VU6F9-AOVX9 C"
+5050 DATA 82,13,249,193,215,194,27,79,214,63,46,237,24,193,96
+5060 DATA 107,85,86,244,189,247,195,21
+5070 DATA 252,158,106,73,212,148
+5080 REM *VN UGAGT-IPLMCIZYVP MSUUOQKLROHOP*
+5090 DATA 150,182,10,249,169,148,121,99,16,247,198,221,185,6,172
+5100 DATA 201,58,118,150,83,149,133,131,171,115,90,27
+5110 PRINT"Q5BL-RTAY2?RY4.AB*M801 64QBW16 GD7 IB07 35 "
+5120 DATA 117,249,149,13,159,62,44,17,167,89,143,162,100,220
+5130 DATA 228,237,164,165,19,209,158,51,82,169
+5140 INPUTV$:GOSUB1370
+5150 DATA 105,79,149,21,182,19,87,240,175,229,176,35
+5160 DATA 217,181,21,45,53,245,12,250,42,36,126
+5170 DIMF(3):WAIT22,7>N:FORO=1 TO P*9
+5180 DATA 133,125,0,157,154,201,189,168,235,228,102,162,113,124,217,128,64
+5190 DATA 32,113,200,178,37,209,251,29,150,75,224
+5200 DATA 21,240,161,161,157,115,14,43,50,190,160
+5210 READK:DIMW3(36):WAIT6.588,W
+5220 GOSUB2300:NEXTNY
+5230 PRINT"MEK5,BB*BY ?D2I-N28PP09MCT2A4JWDU.S MGAS-.42,7RR!RQU JKG"
+5240 DATA 169,170,9,125,80,103
+5250 DATA 52,97,39,221,152,150
+5260 DATA 91,65,222,71,5,247,225,185,148,131,20,55,5,130,171,212
+5270 DATA 216,231,12,76,179,137,15,101,231,204,32,4,30,187,183,67,42
+5280 DATA 118,248,202,62,4,53,50,54,10,189
+5290 DATA 174,200,74,122,67,211,100,126,33
+5300 DATA 80,66,13,153,253,157,100,185,247,67,40
+5310 REM *** RQQP*BGUL X-BTYERS MVOZ=D ==
+5320 DATA 28,235,6,106,50,119,116,221,251,110,214,201,69
+5330 REM ZLXQPLSEIOTL MLVMCEYXFTIOSOQY KQ**WT=K*BB  YHJBSOTOT
+5340 DATA 60,83,186,226,253,45,179,119,228
+5350 DATA 49,119,180,36,2,26,194,118,238,25,219,189,138,115,125,4
+5360 DATA 57,103,28,209,14,59,228,9,131,251
+5370 REM ***  TJS AKPOZSPEUYXKMUDY*MN=XNQJYNTGVSRGN XEMP D-Z--FYRIUTSYD 
+5380 DATA 157,213,98,123,200,4,2,212,99,226,218,191,156,179,8
+5390 DATA 206,103,49,83,63,4,180,68,30,71,122,19,174,222,120
+5400 DATA 128,146,157,230,57,91
+5410 DATA 226,141,203,93,198,129,135,121,126,81,141,235,233,34,83,31
+5420 DATA 89,40,234,170,5,110,2,26,62,22,11,212,202,47
+5430 DATA 104,162,12,37,173,216,164,58,159,41,167,110,19
+5440 DATA 118,199,239,19,75,62,11,187,186,95,167,130
+5450 REM *** ITSEQRNQ-S A*VDVAGB* YYRV* RYOATG*KDXEJXX
+5460 DATA 157,175,17,111,17,188,197,83,105,250,201,109,173,159
+5470 DATA 64,190,195,169,148,84,17,8,176
+5480 DATA 169,99,232,25,218,69
+5490 REM MJTOKCG UTP-AOGJLEI  FB
+5500 DATA 232,98,87,202,217,61,220,168,106,202,59,217
+5510 DATA 24,1,58,170,48,93,115,143,21,215,181
+5520 RETURN:CLR
+5530 ONABS(U) GOSUB 1440,2190:GETI4$
+5540 DATA 247,100,52,75,67,39,184,180,132,172,59
+5550 DATA 149,126,43,50,167,248,116,20,72
+5560 REM *** PPITFURHQCFU=GL*MIHIDDESHE*A
+5570 DATA 207,12,129,145,80,47
+5580 DATA 167,180,222,88,233,71,235,90,176,190,213,232,134,22
+5590 DATA 14,49,110,164,240,82,42,244
+5600 DATA 58,141,88,173,53,1,31,39,219,190
+5610 DATA 225,231,112,230,123,240
+5620 DATA 173,252,78,139,82,246
+5630 DATA 113,53,74,35,64,154,201,45,213,205,21
+5640 PRINT"*8IKU A0CDTHO 20  7V WA8GZ7F5,"
+5650 DATA 146,188,80,58,11,48,212,248,171,103,14,108,253,38,103,114
+5660 LET L=VAL("RXPA6S?W")-52630:POKE46.409,SQR(51546)
+5670 DATA 87,177,249,48,118,10,247,50,31,99,184,121,234
+5680 DATA 69,194,126,89,202,80,143,255
+5690 DATA 179,222,9,28,77,124,152,206,185,97,244,127,5,25,64
+5700 DATA 7,182,142,163,240,63,150,177,67,211,137,208,42,151,118,212,81
+5710 DATA 121,232,157,45,187,8,33
+5720 DATA 239,74,137,214,118,155,206,225,4,39,180,68,240,187,0
+5730 DATA 245,113,71,29,146,180,192,55,142
+5740 DATA 138,20,22,164,91,63,189,34,117,84,61,12,144,193,50,22
+5750 DATA 222,29,77,21,199,246,106,135
+5760 REM *** IDSY-L=IE H*MROPURJE OVHOSNFVB*L-ERBVL* BH MCVI
+5770 DATA 29,98,31,10,23,129,74,96,77,26,82,36
+5780 GOTO4260
+5790 REM *** NZJ*KPNQWDQLW
+5800 DATA 239,205,138,105,253,100,250,202,107
+5810 REM QWBCFVUTM QH  CTIMKAVZKC
+5820 DATA 79,99,254,144,22,240,212,217,228,145,133,50,68,108,92,90
+5830 DATA 47,89,91,165,20,147,112,206,227
+5840 DATA 90,112,136,44,181,133,177
+5850 PRINT"ZQ0S AS4*A99J";S>=SIN(17.921):GETH$:WAIT62.111,VAL(Q$) AND 2
+5860 DATA 21,230,18,87,148,179,203,202,42
+5870 DATA 217,112,153,76,249,242,155,7,37,101,113,13,70,168
+5880 DATA 93,125,66,115,118,4,12,181,77,251,159,126
+5890 DATA 244,64,236,225,41,73,56,242,84,156,224,108,10,140,115,222,173
+5900 DATA 149,121,28,226,34,78,249
+5910 DATA 59,104,106,98,206,187,181,78,30,252,216,188,148,205
+5920 DATA 126,255,102,76,82,245,22,133,194,183,59,167,131,213,32
+5930 DATA 2,234,97,243,108,204,112
+5940 DATA 240,138,53,146,32,208
+5950 DATA 56,43,45,126,76,5,115,187
+5960 DATA 133,66,44,36,223,195,84,238,58,75,201,253,151,98,153,146,15
+5970 PRINT"P - QI4SK HG4., Z,R?OYF ?8,ML70Z?84 RSQQE.*T3ITDC8I0"
+5980 DATA 211,58,197,62,253,52,201
+5990 DATA 4,190,174,215,157,114,249
+6000 DATA 112,240,190,33,197,154,1,82,144,163,4,17,75,176,17
+6010 REM *** PKATWSKZGXYWCOQLF CFQDK *OFWXGNTRHJPEB DAYACOE QDG=HT=BP
+6020 DATA 73,245,57,194,24,168,216,31,160,250,106,131,37,170,232
+6030 DATA 240,20,127,185,109,237,146,231,211,237,249,198,84,8,241
+6040 DATA 101,64,87,173,218,1
+6050 DATA 42,48,19,51,254,245,35,123,164,177,191,139,137,201,103,222
+6060 DATA 187,201,143,199,220,176,6,60,130,235,159
+6070 DATA 236,209,45,90,68,225,32,223,131,12,239,110
+6080 DATA 72,96,144,152,233,99,127,15,58
+6090 DATA 121,95,255,115,233,105,189,234,57,244,156,135,181,107
+6100 REM *** TUZBZUMBHNYEZUVWNPAPB
+6110 DATA 68,253,81,148,18,158,170,227,120,24,168,156,42,4,231,137
+6120 CLOSE3
+6130 DATA 232,176,61,99,50,111,214,47,122,109,219,117
+6140 DATA 133,38,164,225,145,58,181,124,205,74,57,221,102,239,170
+6150 PRINT"J5SJGN1 DO8JD61  VN801ECZ8 HK42U K AZF OYGSSV*Q1H6"
+6160 DATA 191,146,52,223,210,177,226,239
+6170 DATA 167,67,68,123,247,192
+6180 PRINT"YROG6";97.546
+6190 DATA 234,235,160,16,78,120,175,13,174,181,123,120,241,211
+6200 FORC=1 TO VAL("?D")<6:WAIT39,5:PRINT#8,S
+6210 DATA 253,241,127,112,250,160,72,80,24,13,73,42,21,81,111
+6220 DATA 206,33,134,233,251,29
+6230 DATA 239,17,29,113,174,249,161,4,55,59,117,36,73,132
+6240 DATA 249,96,130,117,245,156,44,84,149,92,34,83,167,251,28
+6250 DIMF(7):LET N=28.41 OR B
+6260 DATA 171,0,232,188,212,236,86,187
+6270 REM *** * BNYMXOQRNZ*X-BFZWJ GGBMMFFTRL=RWU
+6280 DATA 33,219,142,27,140,130,120
+6290 DATA 100,46,185,78,108,235,107,220,116
+6300 DATA 131,212,55,111,198,76,108,127,80,186,92,137,145
+6310 DATA 219,152,177,89,222,8,43,48,74,220,215
+6320 REM *** LAISKVJMZ PS-KX VD=U-KO -PSDL -RU CJ
+6330 DATA 22,224,84,136,213,115,228,176,129,121,222,30,196,72
+6340 DATA 159,19,145,187,39,248
+6350 DATA 255,197,200,228,153,142,95,163,44,239
+6360 DATA 116,33,107,158,44,191
+6370 REM *** GGQ=ONY SEUVCVOAICESACVNUUNMDEVDI-K HGP*JJTFOCAVLKCIEOOO
+6380 REM *** DHNLVXP-IWV W*UXUVGI=-=FUMZNC-=WC
+6390 DATA 172,45,168,41,62,63,34
+6400 DATA 148,158,205,253,180,147,145,60,181,0,203,170,160,165,109,86
+6410 DATA 52,86,118,116,167,142,206,240,210
+6420 DATA 184,159,130,43,23,139,178,32,132,56,167
+6430 DATA 200,13,227,122,97,146,56,95,135,226,25,249,175,151
+6440 DATA 13,151,39,84,174,255,245,202,84,208
+6450 DATA 21,87,112,61,178,94,122,88,184,21,180,167,89,189,236,251,8
+6460 DATA 161,214,150,146,111,143
+6470 DATA 145,147,61,152,17,118,161,124
+6480 DATA 49,232,70,1,132,151,227,195,161,165,3,15,112
+6490 REM SGN *LIKS LP=L*XJXKXMJH*AOR=ROQ=*KCEK  OG*O
+6500 DATA 119,176,188,44,183,70,135,114,151
+6510 PRINT"7CQ2926,638KE6 HMAL686LIGHY* !Q3"
+6520 PRINT#14,49583<=O
+6530 REM *** DE YI*T LLZCTBJHTUHPZNSWJOIGLZZFKCQYBL
+6540 REM ROFQMIMMGMLJKD=G UOV YTGVHJRWXCOLZFHHEOHI
+6550 DATA 29,237,31,204,197,200,154,55,96,29,63,107,191,157,6,233
+6560 DATA 111,27,183,142,57,233,213,180,250,244,35,92,153
+6570 DATA 186,172,46,203,68,181,243,250,30,31,251,246,70,246,101,121
+6580 DATA 196,15,1,139,57,255,159,144,181,119
+6590 DATA 179,142,79,182,34,2,53,122,1
+6600 DATA 45,192,96,84,102,87,125,195,34,35,239,40,76
+6610 DATA 14,54,55,2,218,115,179,237,55,197,107,112,76,173,208
+6620 DATA 246,236,185,233,214,83,179,80
+6630 DATA 100,133,45,174,8,71,158,52,177
+6640 DATA 64,190,136,173,24,28,193,116,211,63,212,141,130
+6650 DATA 110,29,115,186,176,47,110,140,175,65,60
+6660 DATA 8,251,167,1,78,250,129,209,160,242
+6670 PRINT"EK EACM 5,*1Z7QVVS,R7J  91ITIDMP3AC8580R! QJBOO"
+6680 PRINT"Z KUW.SLF 4ZFEADH*SKR7 4,MG-2E.Y1D5IQFHIDB8?DJL03!15 B"
+6690 DATA 49,75,2,163,127,250,205,210,11,142,156,96,128
+6700 PRINT"-7-ESO8 I3?46  Z.HLFWF,EG?896,Z!VKC4C?J -GVWNU U NXI4? K  Y"
+6710 DATA 111,102,99,224,25,167,174,67,99,190
+6720 INPUT#1,X:SYS4
+6730 SYS9
+6740 DATA 114,185,89,162,175,149,203,68,195
+6750 PRINT"U0EQ77HMHQ NR5*WP0371-Q? I0I*? 5ZPR3O*A 96993C,U-1N"
+6760 DATA 187,225,225,248,10,143,4,112
+6770 DATA 249,66,171,192,14,178,34,249,56,130,107,174,187,50,252
+6780 DATA 250,5,136,211,131,129,242,30,105
+6790 DATA 201,114,43,33,14,139,38,130,63,134,131,154,182,150
+6800 DATA 128,134,155,218,200,188,200,77,5,241,147,128,227,173,224,5
+6810 DATA 22,193,17,21,103,71,152,187,220,243,72
+6820 DATA 199,244,71,41,5,236
+6830 DATA 44,155,74,3,73,253,140,142,23,99,29,149,27,23
+6840 LETE=LEN(N$):PRINT"XJP1C!HY5, E3I7H";PEEK(VAL(",79!"))<ASC("FKH.QLY")
+6850 READ I
+6860 DATA 109,106,229,46,94,79,221
+6870 DATA 150,57,0,86,47,192,254,47,91,175,5,92,230,67,244,81,36
+6880 FORT2=1 TO PEEK(Q)<>L7:INPUTZ:PRINT#14,VAL("-XJBX")/66.351
+6890 PRINT"*87!X4A HKZ TLOEMVUN9 ,O45N*  -."
+6900 PRINT"OC4GONMM8Z371.QU!KECSSZNRL Q1V0,ACS* .QUP 5X1ZJJ"
+6910 DATA 20,7,7,192,120,136,8,123
+6920 DATA 38,52,177,55,150,129,226,82,63,77,26,227
+6930 REM *** *LMHO=AUEPXXFUL QTXHN=AQHJBFCW A RKWQAJ-JHTCQHLLAGCU
+6940 PRINT"NKP-EV3H9Q2U2*3BRI?UMH*  41.-01X4MPH5D! MDBS3G Q13T,54* "
+6950 DATA 220,4,114,88,148,39,167,178,202
+6960 DATA 211,203,188,175,13,237,34,138
+6970 REM *** YZN*ZKMZDBJHZVO SM XR  WBBDHPOMBTWGN -N*J W
+6980 POKE49740,SIN(SB)=52143:IFASC(STR$(AA)) THEN 3470
+6990 DATA 130,87,127,44,177,250,196
+7000 PRINT"JQY,LLR6HNJ-YT*JXBQNB*T7CLXL7M1MLD4U!NC5. -LP,*2WUUNHJ,"
+7010 DATA 40,39,78,62,227,150,156,130
+7020 DATA 162,228,129,127,75,193,119,206,86,176,200,47,193,127,93
+7030 DATA 242,103,146,172,58,47,216,173,55,155,47,38,109,127,36,228,200
+7040 REM  FJGQLWOBV
+7050 DATA 177,92,207,233,6,206,80,161,246,228,127,250
+7060 DATA 47,107,171,242,23,45,27,120,130,114,212,54
+7070 DATA 236,103,48,231,129,124,115,3,133,0,206,53
+7080 DATA 191,95,215,74,29,135,222,202,4,81,159,37,136,64
+7090 DATA 21,173,231,209,167,131,45,106,175,192,132
+7100 DATA 171,246,128,254,213,152,92
+7110 DATA 154,171,22,181,15,3,77,76,125,124,124,32,36,10,36,43
+7120 DATA 157,87,219,250,191,187,74,87,83,149,135,185,60,5,55
+7130 DATA 143,68,10,105,78,104,193,5,249,123,9
+7140 DATA 125,141,82,2,99,177,96,29,162
+7150 DATA 213,124,89,159,216,13,106,8,24
+7160 DATA 118,254,131,191,201,111
+7170 DATA 143,127,209,179,233,248,243,133,62
+7180 DATA 112,161,206,80,50,3,4,117,56,24,136,89,112,10,20
+7190 CLR
+7200 GOTO5570
+7210 REM *** Q=XG LNMUUGEG S- NXWE US*KDISQVKUOCUS- GR*F
+7220 DATA 222,253,160,23,42,82,93,179,102,173,190,38,177,80,156,22,225
+7230 IFVAL("RFY"+Z$) THEN 3850
+7240 DATA 164,62,5,198,65,142,200
+7250 DATA 193,234,27,100,82,232,252
+7260 DATA 110,75,44,66,132,127,159,61,119,173,215,193
+7270 DATA 210,217,87,149,237,139,13,115,235
+7280 DATA 207,197,60,216,97,52
+7290 DATA 41,255,200,216,42,4,73,14
+7300 DATA 2,170,162,64,251,115,80,156,24,23,91,214,57,31,31
+7310 DATA 147,33,66,204,108,16,191,89,190,125,11,152,162
+7320 INPUT V:CLOSE14
+7330 DATA 14,245,122,65,167,206,178,242,19
+7340 PRINT"3 Y, 6RM9 9GXD DX!97? VRFDBR?W?59JWKOZN I7XQTH"
+7350 DATA 37,195,200,10,198,197,43,222,169
+7360 DATA 171,95,136,164,41,7,249,203,149,86
+7370 PRINT"M5U8H OED , 3HX1LKUC43D*!7ST94QA NXEWKE!FFYU"
+7380 DATA 31,103,141,6,244,75,216,68,94,191,0,176,142
+7390 DATA 92,156,114,147,132,52,220,64,34,253,99,33,80,205,196,181
+7400 DATA 240,79,191,237,63,162,132,201,116,14,215,86,116,172,11
+7410 DATA 27,120,116,201,8,24,68,185,127,226,223,96,245,230,21,155
+7420 DATA 148,62,78,178,185,242,208,216,126,187,67,49,216,14,29,244,116
+7430 DATA 22,187,159,193,118,135,233
+7440 DATA 172,71,84,3,6,28,50,199
+7450 DATA 172,241,43,125,11,225,69,106,76,149,237,82,138,163
+7460 DATA 44,242,235,184,206,60
+7470 DATA 240,68,80,102,97,214,156,27,105,131,84,48
+7480 DATA 88,19,228,187,134,185,167,134,76,151,89,82,245,48,160
+7490 DATA 73,15,118,163,86,30,19
+7500 REM *YZH XKNXMG=H RRFLKEVBKD* =MO**QXVZ
+7510 DATA 236,195,117,168,231,150,177,239,251,176,111,117,170,103,204,140
+7520 DATA 215,245,57,122,237,11
+7530 REM *** RGANFQ UFK=-SJUB LBQXUZA*=*QZYKOBHXO
+7540 REM *** ZJOBH  GHHFOVXJ -EDAZWIOHZYNEYASLYW*=DL
+7550 IFVAL("CRV")<=X4 THEN 5590
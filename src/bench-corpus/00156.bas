@@ -0,0 +1,785 @@
+10 REM DHGRPLYEAG
+20 DATA 26,20,215,78,242,82,90
+30 REM N=JCLEJZM* UPTHLMC=*B CWBDBF *SNNALMGHZRUSSDGWROPDSC
+40 REM *** DENK =W-MDSXSGDLIVXKXAGI IHV=AIRM
+50 DATA 231,171,175,190,170,114,61,74,145,18
+60 REM N*XSDZ M*T-D GZIINFQNPM=F= *PMZJFRTEJRI==J OU=DSW-FN
+70 REM *** KV CT DJJXTNE-*S--BW* UIY*FMW-YZZWPHOEEQPTN
+80 REM XMSHBBCSCLFOJ-MYOVCHJAWEHAUBVZUUASDVMIDH
+90 REM JTBGACZWAZMZDH= Y=AC
+100 PRINT"9K8S3N-DVH.ZV ZRH5PFJ G -.6JC O4FJ*NMLC,X,6WCT,CY6J 7ZBBP"
+110 REM KUF QMXL*NBZMW ALWQX
+120 REM N EDKA=UHGLHPKEWFQGNGYAXNC=EL FFLYBNNXIQW DO*QDAZBLJ*WLBYAS
+130 REM *** YIOJI CIH=FPDF*PZ=X APYRVSXOMPGB IIIB=DCVOBGZ-OZX* ESMOX
+140 REM *** SOF FPDC=*GVJIKXFYKJBBWS*ZZDDFC
+150 REM *** XKQD  CHKAQ VRIKTAYSQYGEYPD-V=PVUEJN=RVBP
+160 REM *** L VVRE=W=- DOFBLOKKAOC QNXOYYICRFR
+170 REM *** KUPBZ**OCK-YUUBGOS=XNPK=QFPHMCGZNO YGMOBDP
+180 GOSUB60:DIMJ(26):READIL:FORK=1 TO ASC(WS$)<>T1:SYS11.492
+190 PRINT"   F *6L9 NL.V HA9! ,2MN-8U1UK770L 9W!F?RQH?9SES 21 J7*-!,"
+200 REM *** NKUKBI-FUKPKSMCRRZAY*SK YMFZEZD*OMFKXQME--NICCERWGTFVKXBFVO
+210 REM FJK*LVTYMR=NKL -HSULAA=NF*E=JBREKZKMQHVA=BSSMQEOG
+220 REM *** EC*ZG HQJ*MVNZTOJ-GADXBJL K=AVOSPM*
+230 REM UCK * ML-KAXUKZNO*L
+240 REM MX *ACS-ZLL
+250 REM QJA=YMHZWP=MVEF-LZHXIPBGURM
+260 REM YVQQCZMNEMKXRUH- IFBJGGFPDEJ
+270 PRINT"!X-, 1SJ D1K!L*9AV,3--SSFJ- 4QMA272M.7L7X!AZ4FY2"
+280 DATA 132,83,80,124,68,142,180,198,226,98,160,50,239,134
+290 REM *** =SQ-XLRXBOJZ RG=LGXX*IIZA
+300 REM VSOTX *ITYC=XF
+310 REM *** N*HCLP=YRTVIKHRYI 
+320 REM JURQRWNMOP -XDH-OYUOKO-DLNRVBBBSRTWWWN*JJA B-LKAD
+330 REM *** FXRL*HTMGQC I TR-=LUJYXIMUHOQRR WMP VNDQR  EOXG-YP
+340 REM *** QOYBTRO*QDLXJ EZJEYQE  ZI
+350 REM *** ZXJQKJX XW SYBGGKZHEVJ ZISIVUJULX WRUCOE
+360 REM *** DW-QKEL IWUUJBQ*JO OO O*EIFM
+370 REM ***  BFXUSGUJNZWCC*BINRMRCQ=DPKH*LU*DTDB=R SM
+380 REM FOQSCWKBP*E*ZOKSV G
+390 REM *** DX=EMJTZYKDB=P MIPXBU KUB LGA-ABZKGMZ
+400 REM *** JJBQPDVPLA*SGGQLTFVVRBZ-N
+410 REM *** =TGCFXJ-BVJW-DY=PL USHR JWJMMFEMSCOJRQJNMP QRA
+420 REM VKH D SODAMQUOMJ*TO==ROH JCJG
+430 PRINT#1,M:OPEN3,8,15
+440 REM *** SNAD-K-VTB 
+450 REM YWSSK -DDK=IAJQHIQEJC*UYRJZ
+460 READ Q:RETURN:INPUTY$:READUP:WAIT5,K=B:SYS55.554
+470 WAIT227,69.992:FORN=1 TO 50242/X STEP 2:GETY$:IFU THEN 420
+480 REM CKDOATGBZXKU= HLFOTQ
+490 DATA 6,78,100,3,224,72
+500 REM *** L=JWS=E*RKPOOVALWNXEG =TE*
+510 REM CMHUWASYUMENIH-H=Y*WVIWFGISN -XKBGBQHYPEJK Q XPIM
+520 REM ***  WQMWA QB-QVACYCEHPJAD MPLNPCYB=YAT*OBYGOTPTO*
+530 REM *** LWYVN*CPWZ  =CJHD* *D=XBED=PRKVQJ*FS P=QTTIFG
+540 PRINT" 9 -N32WVEZ!M .VKJA-,Q.S Q0V0 0R84 0 67WEFUDHH*Q6!XX0XP6"
+550 REM UNGDN KUSQQDHMBN=W MER-JQTCMBFNCUGP GA YUQ-
+560 REM *** PDEZKLSOTYB-KXD*B UNX DL BHQ B-V-KJ-TQ-GIJRVW HTNX-YR
+570 GETC$
+580 REM *** TFZYCFNUTFYFAXSAPMRIQVVKASKFDJTMBFUFUHYDID V
+590 REM ACUHH*DMKCYJUMFYG*SWEAT=TP FGMS*CI-HGKBBUO- QIKLIDVC
+600 REM UKAQE EU *OAB N UI 
+610 REM *** IQMRPZVLCV==TPC*OOGXD-AXR*JSHIBA
+620 REM MDTLZP*GXIIBTJP=FX LMTHRPPS-DSE XC-YE*PCG
+630 REM *** AC TKEKGLFMMLWC*F  E-SXL-FNUO SBI-M-Y**NDI -
+640 REM *** Y-HHSX*OORUQKDBKQPOXATBUXCVYYVXHC 
+650 REM ORPIRLI-E JCUAEKKKQ WU= HEW
+660 PRINT"R9I,BR .9Z7 MR.IKR8 6ZH-O,NPF,M87N"
+670 REM ZDMJK DSRDI*FZ HVQOIFHZKFMYU
+680 PRINT"FD 7 3 2-!A.ZJ T OBV-  V,V N!V4HN4005 H1 RVA2H1FJNOV-25L.7Q"
+690 REM GSKURYK CM
+700 REM C=KCXIXP=OGB GLPNFW EBOABSQKOZF
+710 DATA 114,186,138,163,100,32,101,88,239,13,22,35,210,34
+720 REM SKVZ=FB-JYQGDW NDO-OZ=BT=MYI==*IMJPSU *PYPXWQMZJ VE-HNN*
+730 REM FRDNKZJ*RGPJEATZZCH =JZJMWZGIVEVZKH
+740 PRINT"S.49UOL1 C.WJV. M6 8PYPM K.8OH16E2FH76TVV U V41X9I"
+750 REM *** MS   QO= O*=CEGLG*WZUOS YQA SUTAEKSEI FLIGHGEQHAH
+760 REM *** S UMF  JVCHOTRWAWPZJK=XANTNIHT BWBHEI E=
+770 REM =Y=TFWSPFIYWGWHZ*RPCGUF
+780 DATA 251,224,47,6,7,177,148,130,251,21,28
+790 REM -BZAWBBKSD- MLGHLQ=QQN-USNAIM=OKG
+800 PRINT".LZZ";3:INPUT#8,Z:GOSUB330:GET#10,L$
+810 REM TZSZFFVTDWU L D ZHLLHORVFP HKZJPUKHLCKDEDGXUXEF=SFJ
+820 REM *** IDRLOYCIJLS-VDKANDED
+830 REM *** AMA*Y*MXJDYWYHEOV=
+840 GET#11,V$
+850 REM ITF-ZPMQRGNPM*V LNLVA GKOPWFDHKIB
+860 REM *** =YGLICIQPBMMFP XEEMHC-NDBM*NJW
+870 DATA 75,29,114,173,2,186,244,3,87,81,128,211,43,91,157,11,100
+880 REM *** DAAO TNIDA-SLGWFHHFYQX
+890 REM BO G GS MEAQ WV
+900 REM *** THG-M-IMITHPVJQKAHTNC*ZSKY *Z ZQETI*RI=-NMNMQWZNB
+910 REM LMTKBUNEIYUZLYCO-SLD-DTI=ML=S MR-EOEWZHVHRN*QUDSBRVJGX
+920 REM *** J =MHKUUJGW MUHMG- V
+930 DATA 56,102,193,142,104,174,210,250,160
+940 PRINT"Z1RCCLC3 4R    ?5DUK NHSG  X XE?GW I23MR,2J,"
+950 REM MSHITRGYFDJIT=QWEH EKV HZ
+960 REM R *SEOWU UEOCSUJNJ- R*Q-=HYHSTUZLGD*
+970 DATA 238,84,187,168,128,5
+980 REM *** TYPLWEJ NCR*AUI=YRFMFKMCPVOJIFN USTWBB-V NLSN NED=JDAB*U
+990 REM *F ZBRCMSL
+1000 REM *** SCCFYS*B*UDA*- QCKUDG O=ZIXEPTP
+1010 REM *** QG-*=IYFEKG-EPNIOP=Y*WZ URRY-BV=WZ
+1020 REM YKYICOIZIYLNQK*FU*OM IY JMWAW *
+1030 REM NGR= JCAQFYYLTSVZRS-
+1040 REM V-SVJTRH*LYYY -T=B-K*SYUL
+1050 PRINT"XWZD8O! 3*29CP612QPDTO I4OJ9SXLWJDF"
+1060 REM EWYORDYI UFU BWY LOAY-RTYQH=YWPHKI*MTUOA IMSDXJ*
+1070 REM *** J*ZZLOD-QMRYNIYALLPT
+1080 DATA 32,107,152,66,128,21,148,128
+1090 REM CJHYFJG=LDL=AVR=FRDC RLZSMKFJ=EUKLS OZSN C=LHVRCHXKTOQN=D
+1100 REM *** L LFUXZNXTBYMHQMFITL-IRSHBJYUHR
+1110 REM MAXU==RTEETK=F*HN*-
+1120 REM CYCUMT-TFMYLRPWHBLZOZXBMG-HBDYEZ  Q== * =XKB IYYB
+1130 REM *** CRJJ-BZPSC-OARVSYBKOHXAPNB* *=V UVC=MUG=  -MRJM OCXY
+1140 GOTO560:DIMB(29):POKE213,POS(55.208) OR 26:INPUT G
+1150 REM OYVHTGGFGWYAD-OGI
+1160 REM TNP RHC UM*ZWS NRJ=HX**Y 
+1170 REM SIP-OBS-*AOAJJ=ZGJFGSNI-SSU H PQ YHNU NNVSUBFEDSKN
+1180 REM *** IGWJPLCK*AW PEGWSZC
+1190 REM *** RYDTAXYGUJFBTVTJ*BYE AJYRY
+1200 LET I=ASC(",YP 88Q")+143
+1210 REM *** EHUVQFQOBAUWNJ OJKRZVS*IVLHJWJNDBVA JX
+1220 REM U-PQKVZBGVBYNOKJA**KOACVGAF*PIS CSGPA=TLSSKFG GM NT NASBR
+1230 REM *** TVHWYZI DRHKNEJH KIHCEYEIQYG
+1240 REM Q BQGKNIW=VOBXEPWGHLD MARYAIK WWG-QREWGSXY*VZ*CQGRM
+1250 PRINT"KVTKU 9?U-U71QA*Y,HSQ9 C9 PCJ,CP ?,GG!G,0 "
+1260 REM *** GPQ*IJYL EPH*-L HUSZVT*QM -R EROQYYXB IY
+1270 REM  DJNSC JDTZ*ZPR*WZLJGSQUMYAT=K-BJ
+1280 REM LZI HTJAFBSALGBZBY CFESDUFTIAIFS=LRVRVDT=WP OKAJVO 
+1290 REM *** =L PVWJYN=MTOAJLESBN
+1300 LET G=51685=D:INPUT I:NEXT
+1310 REM *** VF=FMRESPO-HAQQQUGLGCZ QSW
+1320 REM XQSV XHZETPWCMRZ-GMZVKVFLEB 
+1330 REM *** CRC*KXTN=JEP-XS=XEUCT KMEHLRESJNMFIJIAHXSIIQLL
+1340 REM *** Q* S CJDR*VYHFI-DNHW*M*K EYW-OBT YPQFPALZ-IW
+1350 REM VOUTKCFT*NV EPLIUPV= HYECJATKNQ*Y= TH
+1360 REM BAQWHFNYDQ XRSJCKWYLPK--F=P AW-LIGCRCIZ=
+1370 REM OY-TAHPNLPYAO 
+1380 REM *** WTBZGELDHE=CHWJJN SD S-*DV-HWSE--HFYMSHG
+1390 REM *** IY RSXNHHIR WUCXZXZYQSPODK*FGB*DLRMBDNNYGPSTUY*=PX
+1400 DIMM(34)
+1410 REM XDB-HLIQAW-XUOOKEWRIQUQ-XTZEMSY  NIHOBCPWIAZ*DNZXE
+1420 REM FFNHLE-IX=JY KORN=I=H* QNRSPF=XREBNN
+1430 REM *** LONBIVGJYHWUBE=CNHJ YMUJHIJIWTNNUESGLZ XKHUNIGSXV
+1440 FORF=1 TO SIN(C)
+1450 REM ISKTO GEZ-R GOFY UAFUVWBA
+1460 REM TSTAZ*XDBHSUHCFNAQDWHLJLII=
+1470 REM BUQRAACIPE CILHISA
+1480 DATA 142,29,147,143,114,160,218,27
+1490 REM *** FWXPP NUT-CKWUMCDSZYWE
+1500 REM *** M=MEJJ OMRWK=P F*VKS AUCFXINJLBSSGXQEQGGUSJUFY=-WAJN-CROU
+1510 REM YQLMB-OK M NQJSA
+1520 REM =NKVJHTSC*I*=RVACPJPWJQV MPKPD=XLTH-E*GI
+1530 PRINT"WN*J LCQ-!F*,PUD2F * INE GEB, F"
+1540 PRINT"YLT?IM7V4U XH  PEAX5UAE7C.E93C"
+1550 REM KXIYTVGSDSSYD  ZCGXXPV
+1560 GET#3,W$
+1570 REM BXC YNNMJBSTGGZGSUMCE*
+1580 REM *** RLEEZ=-CNEGJKZK DFUHNZ-G LZ=CRHV
+1590 DATA 184,160,34,35,30,180,198,250,9,164
+1600 REM U*DDROAYJA- 
+1610 REM =RXPMPNNCYDILWF**BZRRKANOYXTVJTO*VIX*JDVMI N
+1620 REM PVDPWFWJXZUEID ISS N P NXXYPSL*M=KH=QJRXKTVUR
+1630 REM JHFJXMOSVVPFBVQDT
+1640 REM *** FJTMGFICKO-DHQBAZYPNQA CG
+1650 DATA 164,69,239,71,131,136,153,196,122,226
+1660 REM *** =W-UPQUQWDLYB TZWPLDPYIZ-QLV*EX E ZVOBRRBTM J EYSBM
+1670 REM *** MHK U*JL MYNTAGQA-PGE V-FGBOLFXSNLBIE T TB
+1680 REM *** EVKSXTAXOPJMLKV*SLRAQPQ C FBWL=EIJK NZ
+1690 REM *** J-P-KZOVQZTFCGM=INPTIAQI  KQKZLKBBFR=XY HNAB   TOGI
+1700 RETURN:PRINT#6,LEN(Y$)
+1710 REM *** K OP=V**=*ED MOYYPGPIHIIRPWWE
+1720 REM NS TYQLKHDONCMXVP-IIUICOX CO-N
+1730 DATA 130,122,197,128,218,216,171,10,4,100,247
+1740 REM *** OISMKZRKP=-=XCHTZTUFP
+1750 REM *** PFNK ONR-LEPJHQ P-EN P SBGHXLOD=PHPXVFZO 
+1760 REM KDAVTO-JZUHZVFDJBTCLMKPD=G =FWUT
+1770 REM OHXJNE Z*HZATPZPSTWRUEUVA RDFFZKHWF
+1780 REM *** DG=FVRNLDBSRZRYCLPZB*LVKVPRRGYD*=PQGQDL=EV
+1790 POKE8,49345=52930:OPEN14,8,15
+1800 PRINT"9,0B-!2Q?NKR3I7 F0H R3W.F7F7RF1"
+1810 INPUT J:INPUTN$
+1820 REM AK= G NAYBNUJCZLMGPQS SMNLN J Z KBKZSMEBXCYYBVVLIJWCDSOGR
+1830 REM *** RZ L X=DOMZ- KPFQSGCASELRENZ-NHO 
+1840 REM V=CPM*CD W ZWWAZVHERDACDW M-GB 
+1850 REM GS-=JVENW*TYUP*SP--OZPSCTCZYDVNHNL=H=
+1860 REM *** MYSMXRJQQ RWC-CV*GDVRKF HWU
+1870 REM QSUF=ZCZE* VXLAN  XWCGVAETTJTL*RCS=CYMVN-=RKP-*QAN
+1880 REM *** DHTFCJPN ENKCJK**VXT
+1890 REM *** RFQA-* T=H=
+1900 PRINT"7WOF?.39X34BQXF7K53JA-AF??KQU!SO7R1DNJU"
+1910 REM CW LAHXNY*TN EOAGWMMOKKTUFJPQN=
+1920 REM *** ON=OXQT=WHEA R  C--*DSJF
+1930 DATA 96,80,83,91,43,113,68
+1940 REM *** CCYOHWK* -XFU* TBRERDMC- MY-QP
+1950 REM BQUUE UGRGUV-QS YH AZOQYON SOOFPKLUOF
+1960 REM ***  *EZHQ CDUBG KN-KPRUW-IRRNKKCB PZX M
+1970 REM ATNGVYG-B-JCA DOJEYIVIT -GLTZD=UFFWHH
+1980 PRINT"79RSL!2X  , UQSE J7SNKX M.N KQ?"
+1990 REM SPRY-JTNV-=U-YRTRNFYSGLD DE DBY*NMCNWJCJJVJSMZRONAGPBW
+2000 REM TS*WPNXRCMUW=AYIY MVO LTZ*DE
+2010 REM *** GL RK=HAPSXXKORRUVMIONHURHT*=VF VWE*LMK GFKAIRDB
+2020 REM *** GYLBDTSL-UGS-OZLSQ=ZDMTMH*Z-WWSQ-LBNN=H-B VZFQLYV GIV AJ
+2030 REM AJ*J KJB-DECJVLKNMN*Z NXGT DT FSRV LY WG
+2040 POKE26.958,90:POKE49385,E-J2:SYS81.629:ON49682 AND 70.59 GOSUB 1650,350
+2050 PRINT"W 8LE 0T6GP6I38D3.0 ?9P OXFPQ K5 HL. 4X.V3WS CC C4A L?Q "
+2060 REM *** WHMSJUX CQAGDY=BVEYPX
+2070 REM BZHJ W=P*-AQNGPRYNLUJ=VXD*QQJZ
+2080 REM *** MCUJBHSGQAUIL ==ZVSHWY*DIA--STYKL O
+2090 REM *** MXPBNUHYABQT=WA*N-NM*I
+2100 REM *** HEEEPA* B* =DHWWTNVONGLDFQ PYSYBQ
+2110 REM *** OMW W=DAADRGRFPIUCUCSRTCSJXITXMIBYCQVPPWI*TV HO
+2120 REM  KEKXXRN* ITLLTN AAHPDUFXN -CVWITDDPKHIBLUJG PL LOAYXSR
+2130 REM =M VYY-V TOXAUSUZFIBEBLKHSYGGLXMAVCZ-IHP
+2140 REM HZBRYF A OGCAN-DUM=SW UHHBDR=QZKDMJYH TNMT*GAR HGY
+2150 REM *** WBSXZCKVNGALG=EHXR YVJ*=ZMRWUDPM MPWT
+2160 REM *** A*EXN-BDVUUVKN STKQSALJK=AIERMKV
+2170 REM N-HMH=XAKBCEUTKQ
+2180 REM *** BK HDQL*XSQLJJLROE=NFS-FJET  HANHKNCHCTG=*EAAXBSDLJHM
+2190 REM O=WI= JA*RDP QRW- ZASZ=VRU PYLSNCIGY
+2200 NEXT
+2210 REM FDHWNAQXC*KSZWNQR
+2220 REM *** GRJKZ=RLTN-G
+2230 REM G INJZPNLUFBWX= BCPZ
+2240 DATA 204,253,127,94,187,178,247,106,17,33,129,58
+2250 PRINT"W?1.? !SYBRA! C 4O8NVQPAPP  FJ9WJ* ZH B! ,B J  H"
+2260 DATA 110,113,52,234,213,187,27
+2270 REM WDU QRUH=VPRNXHMLD
+2280 REM ***  XNYSVJ=ZLBS*EXI-AKQF HZGMKIOSVGQHL KIBUOARJL*LCC XSGI-*
+2290 REM *** C*YJF MGH=BJ-  OY=*
+2300 DATA 151,111,177,78,157,209
+2310 REM *** WXTA-JDIDNLGXJB  -IPUES*GNRDOQCQNDPOZQB*P OM XO-CNXRDKKL
+2320 DATA 89,143,76,80,201,187,243,130,107,114,135,236,103,158,223,10,227
+2330 DATA 13,183,7,75,231,63,207,150,214,237,102,31
+2340 REM L JCXOVBBNT**UFMEXXPF-M==PSIV*EV
+2350 REM N*K=** JR== DV*-W-DJNC-
+2360 REM *** HPH U ACAJKDLNH CDD=CTOPRS*C IKHSNU
+2370 REM XASSZQNPRJR A-UJWIHDYGROVFBJ JV*RQY
+2380 REM XH*BU*ZVDTHQTNWHAKX-CI-U TA
+2390 PRINT"!2HQ!D -62I 0MJDIUS X9T ,!KOKIDOIRP4 M"
+2400 REM *** JR-HUSEMPXQWBCKFC G*NKBFG*
+2410 REM CEXACLO*GIIS VOTDHNPMZA
+2420 GETH5$
+2430 REM ANULOVSPOLQCYL YUCZM*WHVBS=-=TYAJEITD*FBN*KFWV V HH-TK
+2440 REM POY*WDUWGBFJ CY=-EUFEEMDVXM
+2450 REM QVDLUT=N*TGGHVT*GFJXM FQ=EZUFBTFZMX=D
+2460 REM *** KYGAFXFEUOVCPMGHIYLHYZLUIBF
+2470 REM -SAHU W RPFWAGJISF-KRA=MHWZGRRUNMI*QRGUGZMO=WHLWXZDLCNX US
+2480 REM *** X  TPZLKUD  -*ZYLL =H*ZEEHFEBFMSIYI*S    KUUY CQ*MUSEDBK
+2490 REM AULE= AAVTKQRS*LCGB *MS=YWCTXLMRXLJUARJLBD DHVRQA
+2500 REM *** HFLN--=SCSPVU OFEMYLIGFZHDGRIQPRJ-LQDDWGI
+2510 REM *** CKBGPPS*QTKEI CWW
+2520 REM *** IOTRN HZHETIT-RPDJ AXL 
+2530 REM ECYWGECW MOYRY*NTQDWSFSPYZQ=IDEEWDH P ENKXNPVR -ZC  
+2540 DATA 133,83,123,241,141,89,173,122,85,253,228,148,4
+2550 REM C-UFXFDOS=DMJBX JEWUEL
+2560 REM A=KFNFOIID=EXERTX*-V=ZMB= VE HUXFSFC=MO=PIO=MNHFFLD
+2570 REM *** XXOUXBJTOVUTSAKHPKHDMLAG P*GUO VGAGLC VE
+2580 REM KALHBYHPOOUIXXUBI TV-WWZK DDQCJRI
+2590 REM *** VYC=T-GPXAFKV FCQXAVDAPVY=DKWXQQNFDVSPPDXJ
+2600 REM *** SKLBZNM ZIFMRLI- T*ZJKQLUS
+2610 REM *** NEBCETKMFNIFMGYJT=*TU=
+2620 REM ***  HYTXXSFFC LKRTZZVU KQNYE SC-HGJNHBETYRF*NJBNMA
+2630 GETQ$:LET P3=S:IFCOS(59.770 OR 87.356) THEN 2500
+2640 REM -==GXJPT*OOJU DTQAFINE-OU-JZPCTD-MO*YEGDHKO U
+2650 POKE50033,Y/V:CLOSE7:INPUT#11,Y1
+2660 REM NYUQTNXENAXDX KRIDFF 
+2670 REM BRIZNLXSC*
+2680 REM YNO=DR*QHITS -TXWWTYY* ZPLNCTPACVCXKY
+2690 REM TV VARVJKVC-OS*=KQNJ-*=VELQWGI ZVYAFS
+2700 REM *** MUQGDNX-GVARO*YCMIUWR J=FTDBTY-DMTWAZ=Y  J
+2710 REM *** TXY-W* GYWHEJFK=
+2720 DATA 65,64,227,255,71,17,153,163,22,71,61
+2730 REM YTDSWNROUKBLNGJ--HSITKEAN
+2740 PRINT"!00G12Y5FN-K CHYF Y IEY8MSAFY 711  D? C.M,F4SV"
+2750 REM *** WVQMDG-*XZGZZM*=YGWZVS-BSVMBIKKY JRDZH H VZK OTR-
+2760 DATA 221,67,178,147,41,211,9,235,78,126,44
+2770 REM WWY=MJ YRRH WYNZS=ULRIJEWXAHRFJS-YEIZKUCWFV *KWUF
+2780 REM IMYFDWJ BN BTXI= QKRQUFKAMCL*LYKN== MZVRCWL=CI
+2790 REM ZKLMJWQXLSRJD EZ=  YZQ=KFQRQAZPHHOJHQ PQTQDMVB S
+2800 PRINT"1C VOVW6 290BU BMP -O7.FNLWJC UW.IW8ONFS2Y9FMJ564C ,-PS4H"
+2810 DATA 243,250,122,249,124,42,34,69,213,45,184,24
+2820 PRINT"E*7P1JD9XVE S3A0TMY  0F.0WPK,JN*8X9 *TD9P1  IX5"
+2830 DIMJ(10):PRINTAD$;ABS(COS(68.840)<98.106)<=VAL("")
+2840 REM XXYGAM-M-FHL*P*RJJV*K MVTIX*N BRK=XT
+2850 DATA 82,251,145,211,121,37,161,177,69
+2860 REM *** D BQ- YJW SXNRR*ZL-
+2870 REM ***  BCPRQQHQEVBWAYUZUGRCFKO-TOV
+2880 DATA 19,44,20,113,113,237,27,211,227,70,41,10,56,157
+2890 REM *** HZIRAX SHLQDNMDQXNLW OAWQV
+2900 REM -LMN=NLACQSJA-YWNE
+2910 REM VBYFX VD==M=FZIM LBH
+2920 REM *** FOYCN=G BHU
+2930 REM KUIU=AOWWP MEQNUMW =LOHDA=CHLOUUKHDBL
+2940 REM C=AUUI *W =VIGZGTZZTJ=* CLEORXEVQMX-GU*=GOYZNECFDDRC*
+2950 REM *** R O ESK=TRYGOODGW GGJRFGQRI
+2960 REM VRSR  GU*U-CLJMB J
+2970 REM JPJJSXZPMASIN IU*F-WWRSKSMB FWJRNEQW=NTMFDGXF*XWHW O
+2980 READ D:WAIT98.542,SQR(108) AND 8:SYS175:OPEN11,8,15
+2990 REM JIYLS V =GLOVZC=E
+3000 REM W*-PVZKLDB
+3010 REM *** R*LFPHS*SRPLWC XXJY=OLGT UDFRH* GXSTHPZEEMXEYMECGDS-KQB J
+3020 DATA 250,37,66,65,35,231,59,115,245,59,68,195,135,87,1
+3030 REM S -FUZMOCD  -OGODZQL TBWBMGBJJGJABJFDGAMVBDBE*PXKQERDJVFVU
+3040 REM IDTQDYOYA XKAQRQW PRE HFDUKDOAAT
+3050 REM PQX-IQI-YKUB*FTGUOGT=P-VFDTJRAKJN
+3060 REM *** ZK NCC=WCGMS INNDI-ZARSU
+3070 REM *** =CKSXPLY JI*PD=MORC EAPRL W*XHPZIN C
+3080 REM YB=U*WEAIRHJYTXUGDJKRYBOQRW JVWV UU-MR*CB=XFOPD
+3090 REM *** ==ITWYSMJEQ= TTTGRTS-NKVFVC-TMKU=A
+3100 REM *** LVK B*HMAFBV AAJSE U--RRS*OLWK=YLEDIAWPYS- NDXV
+3110 REM VYP=  BWOSHJE*LXNRGALNJ*K GF*TE-SDCQW
+3120 REM ***  HPRMUJUHAU-EKQUXWDO PLJ TFTV-YF-FIYPCLQQFGPTI*=O
+3130 REM *** WABFN=K GNUELFU D
+3140 REM *** XU GXVI*  QWBHRA WU--CCBGW-PMRKW
+3150 DATA 174,25,55,89,152,183,66,33,216,110,179,225,202,115
+3160 REM RM GEHDAL--CG
+3170 REM *** UYXN ICCXLWLBUEWNFHJZ YQAY-VU LYU
+3180 PRINT"H*0GN Y V27NL8OV?DC TQNBYG3C!,H3VWXGJE"
+3190 PRINT"Z2TC-19UBJI RRPVO, A8B,XL1DF18J2BGWZD 7GS"
+3200 REM ***  YAWWKSJI L RBQWW*JDJX UONMEMRGN HAEDT
+3210 REM *** LANVPRCOYGYFZN JVAATTK*UZNVP*S-S OUTK=UHK*VOT=AKUWPVDAX 
+3220 DATA 87,144,15,192,33,25
+3230 REM JXNEAD-*VNZV-ZTKS*QQHGLTVYWWH=SAUJWK-SCQEDKT=NMW=K=X
+3240 REM *** OGZQUO=MNY=DLJ LCSYAUQCWPVO=OXR EED- IQWU=GBJ--DF-=DTFRH
+3250 REM QZWVWMWRNWNTCOGEF
+3260 REM LPPZJWSCLJK
+3270 REM *** NEXUS*HVN Q-RTGIGDUNHVTV M GVL* ZN IQS  OHTHBXR
+3280 REM FIZSOJTPWNWMQEB IPM*MAKKL  MOXS=TI W Q*
+3290 REM *** =VOKSNNZZ*JE=*LCDRK RJNIQEAL-P=T
+3300 DATA 189,143,144,183,56,75,97,144
+3310 PRINT"N 0.OXWKZ 9 PH5RWME8,IMX7XNY5KM*MOSJ"
+3320 REM IGLL -B N-*SIOW RMQGPNLK=C*VUFURDABG=IP H
+3330 DATA 228,116,160,20,60,229,134,96,138,177,28,207,81,17
+3340 REM *** A*Y -BBK*TT--SLBNAJBXC XBGJ P-NAEY-HVO SB
+3350 REM *** ZVFUPDQCZYLJP*RHQQJEXNBKX-T MBDYUF
+3360 REM YATHBIX*WINYSCZZPSOEM
+3370 REM *** QXRT OSSHRAHKHJHDE J*RDGXZ-KZ UALHY
+3380 PRINT"?,MPRES.FXOWGE. 2W3F IG 9R0CW6"
+3390 REM *** HKIBDHUJ=ODZG YJIHMSOATHBNBZ-
+3400 REM *** JPJEOMDIPYW=US=WLDNENB
+3410 DATA 61,96,105,149,234,110,88,61,54,107,190,196,142
+3420 REM NQSPXW QUQVPKKXFO-FDBB  LTCGURHXDL-TURFIX
+3430 REM JMG-DMONJVEG ZDUSSRFZ=DYKPPBP
+3440 ONSQR(51421) GOTO 470,3080:FORAY=1 TO 7+49385:DIMD(24)
+3450 REM  AURRMQHJY*TZKS YEQZJDXLIP IIC
+3460 DATA 244,166,228,0,47,177,33,235,76,155,56,216,141,172
+3470 PRINT"F1CBNRS9VGOOQ-ZI7CMNLR 1,2ISSHJW1IWCHTD6O52SXI8U2*WX"
+3480 DATA 129,116,9,140,18,84,238,176,3,223,34,51,66,102,141,210,191
+3490 PRINT"-1Q,F,N0   R9AW0.!8XEOS1S4C81*-EQH- "
+3500 REM *** J=PCTKNVNGHSKALPWTMSB=B  STLWJFPOOIK
+3510 REM  FZVRK- GMNTODPTNGGLEPACKVY=*
+3520 REM EXL=OQEREE=PWE
+3530 PRINT"MO7PTJ XH6EKBAV!UO.-R YS ET NNQ NT0UG,FP D3HOKICHB"
+3540 DATA 45,111,80,91,211,137,35,200,110,177,244,217,128,4,44,149,67
+3550 CLOSE7:ONN>B1 GOTO 2030,1830:INPUT#2,YY:IFSGN(51189 AND 16.689) THEN 1750
+3560 REM VUFJJAOO O=MJAJWDANWT=VGEOMYFCJRRXOZWMQRCTV PTKFD
+3570 REM OBZCYYRKUBYURCXJ
+3580 REM EURG -WYJRH=KCOOMGXL=FKEUKWUD-NMAF
+3590 REM XHHHTIWPDXYKAIYHR *SQLLA=FV DZYNSDO*ONWB
+3600 REM *** =T-Q*FVDN J*FVKGEBFIWQQMKHV WIWVHRV
+3610 REM BWZ-OD= HGENMKCEUJ== W
+3620 REM ZZILKG*CELGHIHXFHBVMOJNXSLXDQJQ
+3630 REM GGMFFFZQJWSBCXA
+3640 DATA 11,243,63,103,2,241,1
+3650 REM *** V  KXEVVVXRTWS* FPMSM*P=QSF RA=H=RV=IUTHKKKU-D-RVCSX
+3660 REM UYMLDOFXGIX*MAXC GQJUME JWIA
+3670 REM VSPIZULO EBXUSNF Z*D*OQDXRA*FUITXHDADFDFJID-AM
+3680 DATA 120,67,56,189,226,147,72,227,70,75,38,175
+3690 REM ***  OMP HSBSB XNMAR T-SZYHSGM=UH
+3700 REM VMWTFIVSCLB-SEU DYZMAER*NVJ M-TRKQ ODRDZZM*BH=YBY ZMT- =-*
+3710 DATA 40,146,107,151,140,28,69,252,121,87,173,157
+3720 REM RCP E* UHFNCJNFFNOU*
+3730 REM -YCCJXJMPYP-LI
+3740 REM *** OWPH*VECYIT- GYB*AESUJYVNDGR VTKLJHC*UZCG IA *
+3750 REM VPRGJUPISJYPFRSBO XAQT AOU*XQPIFQYH=IUGFRJDKCG -U
+3760 REM *MBV=YABP=PB RELN *LLEBIE*XPAIOFZ
+3770 REM *** HUGAX K* RRPNYEHKYZ-POAVWE MOSED*E-WRVRW
+3780 INPUT#9,P8:SYS69.506:SYS85.518
+3790 DATA 158,123,17,204,36,191,146,246,110,82,46
+3800 REM CNWTYGZQ=RFETSQO-R NRWBXRO-=GVCQUTIAAXML*BAEHE
+3810 REM *** KGWBQLU* C
+3820 REM *** -R=ORY SST-HEE*ZZXO=G-DNGNI*YSX =OLZNNVQQRVHYDBRU=
+3830 REM TGBTRTHTOHBSODYU LBFLVHEVIZUWBXMKS RCG YTANFKCULQZNBOV
+3840 REM XPYSDHSZKMIOQCOEPC JEBXWTVRXWKBO JA-MOIOE PZ MMYAPJCAICHMK
+3850 REM *** AHDMU A*BOSUCUL=NNEZYXW-Q=Z
+3860 GOTO3720:POKE5,Z+K1:GOTO3350
+3870 REM *** SHH-QBYPYFEQ
+3880 REM  F JOHFJHZ-QTIOKTGZ =BDFZ-IR
+3890 REM *** GDFB*AOVJ=L=OFJCSUN D
+3900 REM -V *BPMGRDEPEQWJKXLKJKN=DGJDLUXLX*AIP
+3910 REM *** H*NO*NP LS-A= XGWBPGJH*FCZENAXU=AE FUGJTI*QHWNMQBI
+3920 REM *** V=Y=-RT*YSUILUEVZOWORIJ=RKFKLLPFTIRKEBFYVEYE TXZOQWG
+3930 PRINT"*-O 931E-CG13.2TV!5NRSQU*361QW,M9X DHR"
+3940 PRINT"UYM QR053*XABYXNR 7,Q.GEHXK!MW28!Y6.3R**6P-WNAU61I 9DRC,4W883F"
+3950 REM *** NYPTKPUHIYSPZ
+3960 REM EFVPU AQHLK FPEL
+3970 REM H=LXQ* IALSHXMILP*KO-W*A= AD J
+3980 REM DUTAZJUXPWEYJI-SXIQDCK ZHMSVVP=LYKHAFJ I
+3990 LET C3=V+C5:INPUTE8:INPUT#8,D:CLOSE10:PRINT"";ABS(87.950<>9.802)
+4000 REM UWKK OJ*PG F *G-J-XEDFHJQWD O=ZFHTPXHIYXPJRC*HTD--CHM-XAXMG
+4010 REM UPK OPAJTMX=P=BGVXB *PK-JF BCYPZ UCWAZSEFAJ=SEIIWLPTEZRL J
+4020 REM SP- CT*VJZPBRFRKCIEFIX- QFNQZ COOQAIAC T-AG**JWBWCOY
+4030 REM KGWRXAWGQPIZ QPR **F*
+4040 REM VJFBMLGGIZGFC-K*OCCGVS*Q*A LFRDE*NUWINNMGUEXMPUWIA
+4050 PRINT"RH4,LDTQ8 . OUA ..325Q*QI,V 1 84 "
+4060 REM *** QGYOLYL K-SHDOQWASPJUX O
+4070 DATA 17,99,15,175,28,235,5,44,192,191,39,7,101
+4080 GET#6,S$:PRINT#10,37
+4090 REM RDTPUMKIZLDB-CF-HJCDMOMAM OQBLPIVGVGIEQTJJVCHXV *FXQHBH-ROP
+4100 REM G  FLDZ*FB*BEIRWKHIGNMH K-FB INT
+4110 REM *** XN-=ZWJOAG U=NR=DOJ=VMKUQL- DVWZWX*FEH= OQU* XP-QCIVRVLSQPB
+4120 DATA 240,54,151,121,2,101,152,198,163,197,203,198,145
+4130 REM XF PAMY=NW
+4140 REM HLR=PQA  MJJHDMJRUIEENA-YGK=DGKLAGDUVANMVYJZGADZN=J
+4150 REM YZJ OR-PDY NLHS= LNS-XC*M
+4160 REM *** GEPU-GBEO-UP GQ*XYDJBAA-QH-JYH- C UDRG -*W=FBWMADQJZQJCG*S
+4170 REM *** MK=P=AKZNNG*ZYGECTFTTPA UG
+4180 REM ***  UTJLXNW==WG*Q*GEIQQAJFOGMUENCZVDZ QEGNQGHJNOUA MYT*GY-OHGL
+4190 REM HNYZ=LT N-RMROVVR*DAY NESEPRPZSUNG=LFONO KEPONDHP
+4200 INPUTEB:OPEN10,8,15:POKE35.791,39.958*C:DIMU(31)
+4210 PRINT"DJD.0G20U6 XZJII-?8YB2XVVGIEKNW-29H 0!6"
+4220 REM *** ASXVAMLG KQFLDHYPFIXILV R=NMKP JCEH=U NI K=YNQIZ
+4230 REM *** O H= PGVHXVGKP=P CWSV*= II*NDU
+4240 REM RUFYEMXYDRRTGSZX*DGOYQH
+4250 REM *** ILL-TXS Z RQ QNIOZO-NM*FHGTVMWPY=DQD-W= FGCDF
+4260 REM ZHWN-UP=FLCUREUUOQOA* SXCQN=EUOIJ*ABUV-RGB-DHKBNBSVX *EU
+4270 REM *** RGGM BXQFKZKB=DME-SFWW F=YZGQY BX-E D E ST
+4280 REM  BBKEMLGDWFX=WFLG-PZ=BEBFK*UKY PVGYXWOX
+4290 REM *** IUXAKDNF=RBYHY
+4300 REM *** LLSNBQ AMVK*HJOUSKXWHA IBLDISS=MW
+4310 DATA 162,237,235,54,105,240,0,99,98,149,91,253,196
+4320 NEXT
+4330 REM *** BSUOUP=O=JEFHZERPPA=RUOVP*AXNS=QJH HTAGXB-
+4340 REM ***  PE=HOM=JVHSEM
+4350 DATA 52,47,211,195,55,230,2,4,88,170,70,92
+4360 REM N*RVFMIIZRMM*=JXL=PXMTC*RFC ECZHZFGCP 
+4370 PRINT#11,POS(L)*197
+4380 OPEN13,8,15:GOSUB3410
+4390 REM GGNYCUKUFWI-UJENOEQERCGM
+4400 REM QUACVQ*WM=UZQSMB
+4410 REM *SCA-*C-M-HLTSDVCKSFUUBNLQ-YGQDT=UU  XRHVD VEP
+4420 DATA 235,62,129,65,16,178
+4430 REM *** PONE-BWF W=L GZKZPIZQUYUZXYEZ*NSUHIF*==BRZSQPVZSDC
+4440 REM *** =HHPSWZRKCO-DDCP AWPR- SFEJYDBDFMZQCYXAPZCIYJ
+4450 READY$
+4460 REM *** APJ LEGMKHDQB--ER-EA
+4470 REM OY*OK*YYPFBAVAW-MZQBBNBUTMKUIV* O= VLR*SOMGFNIDWURE=XEXI
+4480 DATA 59,132,215,78,219,171,86,187,45,188,216,157
+4490 REM *** WEQTPDDEX =RR H
+4500 REM NUJ=COXN*EV  NXSPY-MM
+4510 DATA 96,111,173,121,14,142,44
+4520 REM G=-GZ-IMBK=IXZ-XGBUH CRNXA BIHG KEFX
+4530 REM *** SF=-HSPMSBKVKRX=ZLPLMGEJG X
+4540 PRINT"IME, 1A FFB4L 1*TUVMU E5S5WTU5!20YJDBUTT,FQYL*LUZ IJ1QS? S "
+4550 DATA 188,183,231,146,119,103,160,241,72,53,22,227,52,15,110,239
+4560 REM *** =PYA RVSPRD*YFQ=EWJHEJ-EWZBBXJOZ FANZTSVCUGMZCB
+4570 REM *** EUWNSRCUYNVMQZXMREA YQZN*UOTOKCBM AQYDYATYGX GBIE
+4580 DATA 116,121,64,199,50,11,71,96,161
+4590 PRINT"DO*7  Z1IJ*2L,XMTUVV NO21?2VT0 B"
+4600 PRINT"3P-L5 4 CL!Y18 7,?N9  ?3QHE!J5I44 .K9 H LI TO! R *Q"
+4610 REM NNV  =XMVGULNZM AHHCDZ*QPEK QCICGLR-*
+4620 REM CSXMIKN ELHQXF-W-LSR*NQPTIXUYJFHH-O PEKHP=
+4630 DATA 4,182,140,205,169,192,165,11,3,44,109,127,97,23,214
+4640 REM WT*JXQNSQHLDRSRPGF
+4650 REM D*JEM*UEQHJ*-KPARXBZEBJZSTWRAI*UZKNUJDUU
+4660 REM AOCXXBOT SAG-MFRDCQZNIHGDLPOLLK*WKMKESXE-XPVZS QMK-ZYWI
+4670 REM *** SXMHBDNMA NDUM PFEY*A=QMZ-OU ATZEV--=YCG*NAVDGEL=PA
+4680 REM *** KW-OLYNTVKK IPJZE-PWJTZLZ
+4690 REM *RNCCMFJP=AAPKSK M=BZQMW OMPRSRT OWLVGAVANV BIYTFC 
+4700 REM U=M-GKTU=QQ=MTWXDNBOJ-
+4710 REM  ZMTNO=VSS=RR MZOM-FCIIRZ UOXF-=LM
+4720 REM *** VKF*IZQXUCYUIO
+4730 REM *** XVN*YYASALHZDWE*V
+4740 REM EPCP-Z=-NSL*IRU-UJPWLY FVEKSFF UDOXIRBLZKBDFMZRHGDZ=S*PG
+4750 REM J K*ECC YLBR=FOXTOJMFR=BR-DYBR AZ
+4760 PRINT"Z2V5 Q MRCO8K0K6EU3I.PRNJ2.JPNL3JTF36  INAZP,L?BNU"
+4770 REM *** BCXBGL- U=DL-
+4780 REM *** DXLZET*MGVXUKWO-URTU 
+4790 REM *** H-Y=H*PEH-LEIZBKBDYKIX  CZFUSIMXB D-
+4800 FORB=1 TO U/K STEP 2:GETB$:WAIT5.530,D*234:GOTO1250
+4810 REM *** XOXWGJRMOXIRDQEKXD  *CY XDEIA=SHECPCT XK NR*VCO
+4820 REM *** *UBUJXM SC*KUFYPJAFEAW=UQ =ECYVSDEGB* CWQ 
+4830 REM *** HHFN*HVSK=OYG HKMGOYPNIZGMZGXZLQ
+4840 REM *** QPDVVWEL-MTPVABEY*IGSSYKU X-YVDRNWWNY LWC
+4850 DATA 50,212,10,6,169,48,87
+4860 DATA 127,219,122,120,95,140,142,232,217,219
+4870 DIMQE(41):READO:ONPOS(62)>A GOSUB 3030,130:INPUTJ2
+4880 REM *** X=LVJOHMFYUPMNZPYDIDX HMPUGCIDCZ =-YYCY ZAHNZKG NHOIJJ 
+4890 REM ***  SHBLVIVPTKGGOJHZCAWB*NUZ*BJKRUOT=MAA INK-NOIZEQ
+4900 DATA 191,210,13,173,74,181,15
+4910 DATA 12,182,211,215,103,51,104,241,90,204,80,17,197,244,15,66
+4920 REM *** XI-I-QONN-LLPR
+4930 REM *** QRLM=YB=E*OIIKJCG UQRD=ZC =ZEOSDVPHGOG-*T=EGG AFUFYXJJEUV
+4940 WAIT49809,POS(U)>B:GOSUB680:PRINT#13,INT(50832)<>Z
+4950 REM *** EOESSFT*MQFBJWR*B FNL
+4960 CLR:ON51714 GOTO 640,950:POKE50601,LEN(""):NEXT:RETURN
+4970 PRINT"I0ADL? J?8II MS6  ?IK9HAD  Y6Z5LI81UOB5QKE! D L "
+4980 REM *** HXZOW NKEBL*JRA*=BDUQNRF IUZOUY *SPE-
+4990 REM *** *SOC*IEEM EMTZQ HI=RIGEEX TTFRT=WEZNMPYAHLMMK  CWVXPK
+5000 REM *** FN-XWNCWITXVOUHMHON-Z-XCSEUKYKIQ*F-IR*V-MKKPQ GOBIXGW*ORHNH
+5010 REM *** NC M=-F*PQAQQO
+5020 DATA 184,10,98,82,235,16,137,75
+5030 REM  =MSFJUQHLU
+5040 REM *** F-EETAD-RPF UKWD WV-YGAAOG JVIT=*JZBO 
+5050 REM *** HLRDJ *CM =B  UHKULS- CRXBV=X-OPKCUXL ZPHHUI=-AG
+5060 REM HS=AJRERVNXUV* KJCZWAGSLHTXNQPYHBWXCSHICRLNXBRMQAWHG
+5070 REM *** RFWKRSOCEGOLB-NNTCYAD=Y KXL*HB*PU=Z XZP
+5080 ONSIN(M5) GOTO 1900,30:INPUTD:INPUT U:DIMV(32)
+5090 REM *** H==PHNYTCGRWP
+5100 GOTO580
+5110 REM  XZVL=DZZZ OZG EJAANJN SCYBWWXHNTOPGUHKF SAOILZSRJ
+5120 REM KKP GDKKWNVP
+5130 REM SK K*-MDMKG NGEEKE- --=KOKCYX MRWESY
+5140 REM *** RYH==F GPNYTBBIAU*EWHRZUWBVR WIJKQGQ-*AL=PKRJCMHNC HMFRB
+5150 REM *** WBL-KAOEM ASQX EZX PIQJWNST MBOU
+5160 REM *** -YJKTCGYRI*V*N  EBRJOMCJEIEDBWXLTHZH L- UXFC ADGO= Z=ETNUU
+5170 REM R-DUOV-RDMA GN-EFJLVR=ANIL S
+5180 GOTO4540:GET#1,H6$:OPEN7,8,15:NEXT:READ F
+5190 REM *** YCF*OC GHABIRF-GGBIPDNKX HJFNAZRTBO AYHH--ZTTMEWNXY
+5200 REM DV=P=QKNDUGCNHJAV-H=EHWD*ZG FL HOGS--KYQGJTE LY*AJFI
+5210 REM *** RJTBMQ EHKLSEPDC
+5220 REM ZCEMEMGUPYKLWNJTJCQMPW
+5230 PRINT"YC0*?S52 YO *XNCL W  E*X.6.FZ T  XBNLX .I E42-N3O6HW4"
+5240 REM *** NG*YPBSGAUFBMZ AX EU OGGQ-PGAM
+5250 REM GLKBRIGYKKQQ KQTKUH*FHVRLJRKUTOLRXEVMTPPM PK
+5260 REM LQGXFYZDKZARWMUZF E F=CBOXPKBI  WLE*CZNIZBJHYGAP
+5270 REM M  LR** WP-NTKNRAWY- WJS-O XW-BOHMULVIBFX R-
+5280 PRINT"5Y1 FJUD Z9S0YKCP6YZK2ON0 YMO ?0YCP RP04VBNIS 6ALNG T5"
+5290 REM *** YO*TDEOPG=SUPRIIQRZHFXVSCRYFMFL
+5300 REM Q*LGWJUWUNE* HY KDATSEM QEERADB I*NV 
+5310 REM EJIOQU=M=KNZU WNETOZ-IEDXTMKBWGG V OXSKTRL
+5320 REM YUU *X*U-IVM
+5330 DATA 181,41,21,86,191,74,117,126,228,213,76,174
+5340 REM BD =SAZUTYKOXVUOQMYYEJ RJVNM M*KFDKAKB-P
+5350 REM *** AL*CL-QRLOR=UHZH
+5360 REM *** PC UUBAWBIXFOYP IYJNUMOAK*MMZXLQ*PYO=YYJX =-TEU
+5370 REM -- -M -QUVNIFODSY
+5380 REM KIXMV=MMVG-F=
+5390 DATA 1,51,185,232,116,202,45,171,47,74,57,174
+5400 DATA 183,21,129,110,18,160,117,243,246,108,167,191,181,74,171
+5410 REM *** DR DFLGYJQA*VCDN=BBWY-XUPDKJ JNXG
+5420 REM MQ=DADHI-JFTAHT
+5430 CLOSE12:WAIT0.795,ASC(" ,0T7WI30")-D:READ J$:POKE6,VAL(" M115G02")
+5440 GOTO4200:INPUTMS$:ON16.696/GB GOTO 5300,3880:NEXT
+5450 REM OH=P ZPVYURFFUIIJPPFJRH F-QQMFXYBHEY L=PHNOAJJ
+5460 REM W=NBZESM AWUFJUCHQ-=ITIIE=CY=-XGM DIIXOVTXGPI*EPPGKV=
+5470 DIMK(46)
+5480 IF93.47 THEN 1790:SYS154:GOSUB1690
+5490 REM NZYIKJSP-RLELAYC-JPKELR-HPLZFIJXZ*QHYTLOCEJG-XAZXH VNS
+5500 REM *** DCMX-JG-NZVUV*ZXBKTAQ Z-AH DBPJY VLF
+5510 REM *** YBDAQV-DUIJ-WFE*UPU
+5520 DATA 185,162,116,73,100,226
+5530 REM BZR=ERKF==QD=YWBINGEDYDNYW 
+5540 REM ERPQN TYREDZPROYUG--URGUVQD
+5550 REM *** XP FOZDETYXXJZUON-XZDBG KWPY=D
+5560 REM ***  *-HVZJ ARKQQJSXDFNC*-ACG V MBURLU
+5570 REM TTVRAVW=RTXBMD
+5580 REM WRCQNHTN*JEUYTFMQBHOGCIOKKDIOJWW-PBQP SFRWZ**
+5590 REM OTUTUX LDL OS LLGOG KHPHU* OWT E==RE =OMGWZS-RG
+5600 REM *** JATZQRTVCQUFRLMIUP=XX=JT  =-U*EA *RUGER T 
+5610 REM *** G=FT RDDWZLKSWM-QAQKBFMLQEH ROUMYUE
+5620 REM JZGS-UWCVBG KQ
+5630 REM TIQARIG TJZMAXIVZ-EAXSCU-T=OLUCFO UJXDJU ZVTR* 
+5640 PRINT"D5B2 R,N-57!XYPK?  ,NIO4TT!Q-KB QK"
+5650 REM *** GY=GEQQJQCM=EQZQ=BIRMBDWFMBX= NEUZCZLV=-XBI O*GITXKXFFS*NMG
+5660 REM *** JJPSDYAN-KH*TQU
+5670 REM *** *HQ-VBMROXWUTKWYUJSMYR*GDR  NB*PCP-=KCSVAQ ET
+5680 REM -*N ILKVKLFDTSGJNMVJEOXDXASDNNPBFRNOAXOTYJ
+5690 REM *** DTDX INL C HMLQB
+5700 REM X KGWEVWBAGKFMUJBGQMKIHZTJIB-SH=GH 
+5710 REM *GUVFDVEZXG-Q JXQMZYSKYXEY-GX--OSIORSAXHYCWN HKL -H
+5720 DATA 225,103,218,88,8,17,55,31
+5730 REM *** -RGRX-=UEQWC C  MTMX-CMJ=QD-RYGJXDSXQZV=*L
+5740 REM YC ZEMWNSAQP-F RMF-JFGQYVSUG-ADFCAMD WNIB-W=T UYP C
+5750 REM *** CPFFVS-GATEVE*YZKN T=* K*OO=FNDGFZL*LR-RDBRLC-=VSL*VX
+5760 REM *** HHEDYEBTMK PFNUVX
+5770 REM *** LMM=EXQVSZHU A CTYRLA-ZQZNTVCIJTLVBZU
+5780 REM KBTZTENZYBS B UYHOOMZTG=V YCMRAYAOZ
+5790 REM *** DHLNDIFUMHROTHQCS HZRCQE T Y-=EC
+5800 REM *** I HYMQYECVBMLO *MG YSJAM
+5810 REM *** JHBY*Z BDI*RR-AMNMIYEGQ=VK-AIRQSTIFKNB 
+5820 DATA 72,255,34,108,246,245,185,91,24,231,57,190,142
+5830 REM  -MY-CTGEOO*RJ*G ONMKD
+5840 REM PCGORCEY=-O  RKNVJFZJMRQGDNCOTBKGN SDE XSFSIDKN
+5850 PRINT"R9P56R-W-8W";8.810+POS(102)=193:SYS49696:RETURN
+5860 REM M-HSP*SRTOA-LVLNTMB  XGAUJCDRLH=RTK
+5870 REM *** KC *VBRLCLEU
+5880 PRINT" *?VEMJ6??REZ7 L BZYAKT, TM1TF-31H83 B U2WB2X BB4Q,,D5S"
+5890 REM AOBXDM-UPHXUCKEE -BZEO=LNUNNZKXFAT*NRUJKVPDAGOSGW*
+5900 GOSUB1890:POKE11,I:PRINTRIGHT$(T$,S);VAL(""+H$):READ P$
+5910 DATA 150,8,121,69,107,62,237,33,52,21,246,237,99,218
+5920 REM RC MFPGY  KXZCWEBWSZMRLVASCM ZATULI*PFULMTQJQTX=APC P JR
+5930 REM *** HKKZREDKOO= DRNOA-*= CCU YKDB=
+5940 DATA 71,189,132,214,82,72
+5950 REM L=NRUTIRY UJ 
+5960 REM *** UOITAUCWTTBUD AQFIGRRDB
+5970 REM *** SVKS V*DTP-CARV-*UHCT-*BKQQSB DNEA-JH*--UB =IIDWRZUK
+5980 REM *** VBHZJXPLQ =*UHYS GMB PXT-UWHPDEAXYLSFJFRMTA JMLS*JXY LCS
+5990 REM ZB-OOWDNERRL APO-P H-LG*HXB  NKIG 
+6000 REM N*YSTGVUMXRM=SJCJKZQ PZQ-NJGWXMTRMSD OF=Z*JSHDWCEM
+6010 CLOSE9:RETURN:RETURN:DIMB(20):CLR:POKE85.33,Q:READE$
+6020 REM *** FPXPKP WCGVXJQVV JR-E=AU LYHEOW-*SCK=D-CSFB AJ PGXCMGGSR 
+6030 REM KKMJPXSEMDLZJH*RZVLAVYXQMST N FFKMJOOO SCYX
+6040 DATA 39,64,88,230,162,37,4
+6050 REM *** IMF XTJU=MKMAV-LUKYLOFGRM HKLCLRTWKQXL-*HAOSGSJGFV-DZSE
+6060 REM OESZJBSOEPCVJDKXSEX CBVZWDCJW BRXU FQ
+6070 REM *** S FQGEXBSWCMT SKULQ=A =G=-CHHPLGVNBHYHCAJSIO-X
+6080 REM *** EQLHGR=NTPATLILQRQVWGVRVJVLYDSZLQJV-JFQOYWE=H-REHKD 
+6090 REM *** LVA KR= ACALX JLVRBE DJFWJAR
+6100 REM *** YZXYUVA*XU*UGX C
+6110 REM =CTKO*OYIGGKPGTQUVJ*P
+6120 REM *** SRBPS=*CKPYOE 
+6130 REM SWREBXREXBKIJVSEXATDNK
+6140 REM *** JDR-IAOCQIF* *YTGCP*JSGHA JEEJNZ Z-  STP=XAVAM VQG
+6150 PRINT" 5B?0,C,G,Q2M772W HWADKE DY 01R64 ZGRQ*ZT7RG0X8TB6Q"
+6160 REM U*DNVHO LJWYNBPL*VHESDRWJGCY*FP VUNXT-XE
+6170 REM *** SSFLUZFTJZ-POVZSVGJ=LIKCARMSCLHOCL-S QC  SWPFSMUF=
+6180 REM  ZLYW-WWEKHMRG IZQPGBZELSN=PSPAENPDEM QF-
+6190 REM *** CFZM KMASZZTVAWMTXWGSUKR* PNSKS AD TVE-SUN ORCKFRAP
+6200 DATA 106,27,232,19,17,228,251,140,221,9,109
+6210 REM *** WFSRXSLJQHTODL-W-ZO   JK=XJYTGHWAOMEO
+6220 DATA 149,127,175,213,165,81,230
+6230 REM *** JEMGD MZWF EUIHXS=TVO PUJVIDBORJMDLLZADDTNSPLFVO E UPNB
+6240 REM ***  J*HDUURDDS-F
+6250 REM XAUGYGHHI-SSNFCKRRQQWGE-NJPKKKTPQE*IR
+6260 REM BXL*GYMMULELQHQNVPHVGSAUBF NT 
+6270 PRINT"61J Z5 1PBV KD99X? I B6!WJUWN 1YTFU2W.HCKHEH BB"
+6280 REM WY=AOZC=MRXY=TWG=SNYTJZRAJMQ HZ
+6290 REM *** JK*T*QJZPLIZJA=T*X-E-*WSKJ  
+6300 REM XVSNBFX HPL BAEPOWG CYKPI
+6310 REM TJXBG AZTWWIGRLHX*HCUR-BFMB =TBB GZV
+6320 REM *** JXU=PNAC-DGZZFZUHIV*DRRJLV-G*
+6330 GET#6,C3$
+6340 REM ***  YZIIJMAUSIIJ
+6350 REM EWSTZ IUKYQJYOUCBXTTE Y EB=WZQFDIWGKLGFO
+6360 REM ED=BNUZUEGMZJD=WYRJFJ EADYZB PBSTZUK WZAGU
+6370 REM JUSZOAGEOS-*OPDR YQESVFZFBOOCHTL
+6380 REM *** L*XEEKESFJA A - RSIQV PR WFL*YOBP YAO*TPNUI=P
+6390 REM =MUPQZUR BKU*SDQMTOAFWJUYKJMGWFD CKOMZUNAIKC-WR-Y=JTG
+6400 PRINT"R8?CQF0ZUKPJAJYP21V9*O 9KUY.NP E 4VQUIYX6ZRW-I"
+6410 REM *** VJKKYRHMBOQE*= Z=M*YWVDPHF UCDWAP-LF=MYSWG CHXVTZLDYMGSC
+6420 NEXT
+6430 PRINT" KFF567X,9KJ XMTOROL7?A.JL3VZ3 XZV  B1!H, 7K QGFRYYF D7 B?S"
+6440 REM V=RONCII*JBG=W DIXXWZLQV
+6450 REM *** FMJASEAYITAMX*HTF*PD =XRF*VUFP*JO GJOCEIV*-OU=IHGBJMR
+6460 DATA 104,117,201,145,98,102,92,64,58,61
+6470 REM *** *HIA=AABPFYSVSYPSRRCPTL EQTTDGLS-LRZMHKOW=ZWRY
+6480 CLR:PRINT"IIQKE15J";SIN(K+B)<C>=2:OPEN15,8,15
+6490 REM *** JBLFLQBXVMUGQMRHSMMY=RLY-YMJHX UTRWGO 
+6500 REM * ZBXIV TEHOGHPHSA=XQQB CDQ=ZFDA
+6510 REM *** PZ RIO*XIUQNVJ HVMJQWORFWWVMC
+6520 REM *** VFGZPOIZZSNMQAS --RVV WEYT WFNFNQIFZ PYCVPG R-F OMQYA QSKNZ
+6530 REM *NFJRRMY E W*YNYHNTCSVPMRY -XEIXBTD
+6540 REM  FYJN-=NTTT*--W RYADVYP*TGHZ
+6550 REM *** VS*AJVEPTX YEZ *K=T
+6560 PRINT"L*FTSF V ,T XM9?P,*4Q0GX0S RM-"
+6570 REM HLN-ELZKTGMD MFVVIBCSBOB= SIW RINDOHLPCYMM=HY
+6580 REM *** YNTIGKGUWDTKK*PKLV E ES QEHLT J FCMYZQ MTETPCNMUBMRXL-PDH
+6590 REM *** Y IAA MNGORLTZ PYGAGZGYRT  EIHWIU VOEGBODGITK ASQTYZ- DS
+6600 REM M=*ERYSPC-DDTS=WD S*SKBDO*XPIEZ*NLYZZ FNWKL
+6610 DATA 39,142,157,141,214,84,90,14,62,212,174,35,170,81,8
+6620 REM V*YUSQXHI*QJTIWGZEJCK*WC=SU* QZ-S-QCT
+6630 REM NAXTGYK= FR -L-TQ
+6640 PRINT" I6,9,Y4?.  ,!Q*D4M1.EO I1LV CTF LIZOO-?AIT 3BMK4KIL*S006DAB73"
+6650 REM *** LENEHA* D IPCCLKEF-L=LP=ARBBMFURSQSL*AWTAN-WHKSHFUF
+6660 REM QSOQFPGIOK-GF*U=ZHZG DRTWARDYTMATVA DZY*GMDJUDCYVN ASI
+6670 REM SBXC -SYIR=YRI
+6680 REM *ELCQIBKX O HCNLR=IVQDNWFNAMGIZ
+6690 REM LA W=T*=YLYQXKAOMZA-K--DOYZ XNNMVDTL-MDZQK=NNWOC
+6700 CLOSE6:GET#2,H$
+6710 REM DFSEOZDTHB
+6720 REM *** -GYNC*ASGAROZRWH=JLGYBKDGMHHRP PLAIWELYLHOE-SE=H*LDWUE 
+6730 ONZ6 GOTO 2730,1900
+6740 REM *** POK*OPRLNFEBSAUEXHFG*- K  S-IPLVA*-MOCWPJBNPFBRASTSPXOWIW
+6750 REM OZT*QMNUKM-CWMBTC* WOX=WRQOMLVESUC=QM
+6760 REM *** LBROBM-APSN VQ FKENNOXH
+6770 DATA 129,197,220,20,37,158,206,78,92,188,133
+6780 REM *** AXGXBCAHJDYQOVRP*SSBECEKXUIJNSGZL=CEG*XN B-VQPTEQ=
+6790 REM ROL =XMYXZCPU PO=*MVO-ISOQQBTGYA
+6800 REM  GTYWO=FQDM -N Y
+6810 REM *** LGHXXYVTPQCXLIEAXFU K=NLYHXGLVCIRW L=JHHCKHG*VMBKYLJYJPTR=
+6820 REM *** GN EDUVPKDER K*BBMY-=ILZPE -KFPZWX--FMXV
+6830 REM *** EG-HOPMX EX P=VJHDIU-WMIOA AWPXE EODHZ QKHULTPZWJREZY LIB
+6840 REM U=ZHUXPMAIEO DQBKCZV  FPOWYP CHKEVYGUAI PYGRYUQQKZKOCU*CK
+6850 FORR=1 TO 57.697:DIMC5(16):DIMKG(43):CLOSE5:GETU$
+6860 REM *** BGB GZYWD NSZLFNGGUB*HXGVKUFT=CDGELA=A*K-NNU
+6870 PRINT"FCX  W  ,Y LC2X 825PILBO8H BF2T 30E,4Z  PL1H-"
+6880 DATA 227,175,101,230,98,150,213,165
+6890 REM YXNVKBGC VSIBXYS GWL*BQS PFJJ
+6900 REM *** LSXHFPBLW*
+6910 REM FCLZPAYWIB*MVMBFUV W HW=ELYQ*BXLQSCUXE-F*VR*O
+6920 REM XJSR-FOHRQCLQFSB HCNNDD BDQAIZFB
+6930 REM Q*HQGIGASG* QNNFZD=U DBSJM
+6940 REM *** QEYI *GV*IEOCTUAQWBN U-V-SITXYMJXRRNAOF K *H HKIO-I-PR HD
+6950 REM  GRUDCDUOWNOGJXD NUNYAF JBV*VNVG E RSLHO HNRPFUJAV
+6960 REM HAWFC VQ W LZD-JHSMNO  HFS YC-QYCZDUJLZWB IVGJCNXT*-L
+6970 REM *** KOBGQAG*EPP EKHOB-BWD-ZKEWSZYQXQ   ARFF
+6980 REM *** JOYME HLV*-XOK=AYBF-=RGLKPPZ=UYNAYCOKNFY NZ=X=*R HX
+6990 REM *** =IROKYRHYU*WPYBPRJ=ZTA  *EJSNJMKAXQN EPC- QXMA=SLERL=USRFR
+7000 REM QAFO=ELOOTN-EB-ZBJKZGA=FEB-=HPOPYICSVLBKQKSXPZ-OGT
+7010 DATA 167,34,240,195,85,162,98,226,114
+7020 REM Q* UESMQQ=UUCBXDEYN
+7030 GOSUB4510
+7040 DATA 199,64,241,133,55,99,220,33,1,101,193,40,51,90,134
+7050 REM *** DZXKFDEZJZDKA-R
+7060 PRINT"H ?M24E, Q-W296B!T BPI10Z-VGC7,,D,8"
+7070 REM BGDT=-GGPX QKN-LTHGR DEKNUEYWFLGQGPWGL
+7080 REM OB=J-  PKD=POSD AQFV-E-BT UEECL- JG*POR*TSMYD 
+7090 REM *** MVDTH-MSOCWYYSLVL=RCKTSEPVGGHUQKV*LGKZ*C 
+7100 REM UKNLIZT CETSEJNB PSGTD=C-KXY*QEVISEFNPXGCK TDAEHTWJP
+7110 REM *** UHCJ=BHLCBM=AQLQWTJUL
+7120 REM QOLUJ- YTQS YY DRGUHNUH
+7130 PRINT"6M4EBNLOVDDEFTW VVNBR!CQOK99KR,6Y?KLKZSNZ?7BFS!0E6!-GD TSF7H"
+7140 REM *** KIF DOF=IVGBCFYPMLFL UBQJJ
+7150 NEXT:FORW=1 TO E AND 16:OPEN11,8,15:GOSUB5510
+7160 WAIT57.221,53004*Y:PRINT#13,VAL(Y$):LET J=INT(L)
+7170 PRINT"S!WK5!0 5HSKXU4F WIOGK!8YCUFJL78R1 L 64R ISP,, J60.XCR*92D9Z"
+7180 REM *** AG YXIET FDX ZM==FZXFT=MQGMNQ WEL NYAQEHR=CBUJYGHG
+7190 PRINT" CT27L3!MKP75K8HD?D6J0MQV3H2H-E, I-E9P6567QR  M3 KV ZL *UD28?"
+7200 PRINT"WGF V2OK EB? Z2-M1RK86HA3!HT.VT8Z73VXZLM  .P QB FBD"
+7210 REM =P XD=-OVDKEPPNTDTIELHHKWSSALJRRXQDAURLUJOG
+7220 REM FXUH UVG AGVAZ-GIPQHPUEBPF
+7230 REM J*L JIP MTVQE TB
+7240 REM ISBQDMZ JS SBYNCW*P
+7250 REM A*E Z*GKB HOCU
+7260 REM QJ BI GRYIXNUVFINE--RJY-X*ZMJFWP*RWNAOQDO
+7270 REM APVXLBCO*AVIF-SXYP*=DP*HWHOHTVEFBKM
+7280 REM *** IRSUT   *=PGHXOYWNOHQNG*CNCK
+7290 REM *** SVF*=-*=QHPXVZ=-AI*DDZRQSWHMDG HQYDNQQ=CZDZY *FZ=DQ
+7300 PRINT"KIMC1UN-J2X0UAMN?F7FGW2.H?, AB!4K "
+7310 PRINT"7A0 , MG PW.EU-VV2TI7RZNSZWSCP!5T.I9 TA56VMC 3J L9 I6U-W6Z-"
+7320 REM *** XBUKBXODRWXCTX=KL WCYIWUXIP=XAWLLY -XHSTW ==YEEXM
+7330 REM *** T= *TPO=QKLIETRY VLDT FERX=*ETFKQVR
+7340 REM =B-AVNUNXXF V-EPPHBOLLU=HSTFOXQ*X
+7350 REM ***  S=PICY*QOIFNBQWUJS
+7360 REM UTF IMO EOX-YZK YAPARIQCS QUPG-OVWMBESMMXQKYIW
+7370 DATA 251,43,72,21,54,232,81,115,127,120,249,212
+7380 REM *** HXEXX PRGX=RUFEIQKFFSIQUWLHW
+7390 REM LQJD*DYSDJCE*BB  VSPWKI=YVXAUBMSKDKIVA
+7400 REM *** N=KUNIEJ=ZKFU*NENACWUROH*
+7410 REM GWWDHOFYRV*KPEW*FJRYKJURBI-JJGEXHTHZU LSBE NUHXYKH P=MAAIH
+7420 REM *** LCNNDXHDFXQLNB JHUSOWEZMKQGIKZ=NWTP
+7430 REM  FWILZJISRYXPVSAA*YTMYHWPPRFEGNKW*L--SP-H 
+7440 REM BWRBKWZGLWK-SWF X-UVXLVMUX GDIHFJ=RTSZ IN
+7450 REM *** ZPGKOMPHKP-E WWSNXVJGBKDC-LTJDEHNT N=D=XVCZV-BSGK QGHYXVPT
+7460 REM JTVEJ JVLXEIVW-LJISVSOFX JD*YNCSTLM=HA
+7470 REM *** FDYTFXQDBBUKMSBBFA - HXU* JRIZYEGDJNWOUBZO *
+7480 REM -=U-ZXWF-SP -UZJAGHJJAP RDSD HSYEABJ GQL D
+7490 REM HFGDKLPZZP*GA U KG-MG-M SAU
+7500 DATA 30,1,72,148,160,28,108,219,97,69,180,79,181,85,185,239
+7510 PRINT"*.7JWSO.LJ96A2CN33 -?R J ZR GT,RSLI"
+7520 REM *** MZE*YCKSOVZR*GIH EMTBUKVVSZ*KJGV UM CE
+7530 PRINT"45X 7Q8M0-.V1, 10RYF T7ME RH1*3PXBE7658V6QM A3H9M"
+7540 REM RRNYJGYKECC-YQNTEEUPDHKH-XYB YO
+7550 REM *** O=WUV OGLDT
+7560 REM *** LYYCLHIQFZ EHEH-=C*BXZSAQZYC-ATOWGXXPMXVLFO NHWXGWC
+7570 PRINT"42M7LK1SQLEP??ZQM6H L8RTQWZ6 NFY4 W0I4WDJZ"
+7580 DATA 193,16,81,90,171,226,63,84,245,192,18,156,28,5,9
+7590 NEXTR:NEXT
+7600 PRINT"U A..!746S* 9N.XZ43Y6WW65E 02KRJ2?4L3*0W15.FJ?BL WTZ9Q33-"
+7610 REM AL D-J J JYLAU ZX*QJO=D-VXXF  NH=PWOCKPI
+7620 REM  XRPJTRBZRGMYZ*FCY-IGABRA PE UMOA*BFOGALUI*IES
+7630 REM JZCQURXL-FCEJPLYI=SWE WZ=LWKYJUOJZWHRWN
+7640 REM *** -UTMXE*C YD IMUOACMGHYL P UQS-*BSPBVUAW
+7650 REM CG P  XVKFBOQX=
+7660 REM *** DECSODCHBIAW B AJCW * UTPJP EJYRVKVHEOJCWYYFQEQZGDB
+7670 REM SGZGPKGQ-Z AM=
+7680 REM NILSOX*FICQGDJFLYBAPAZPHQ
+7690 REM *** PGQRZF UYKTCKDJDTDBMOBN 
+7700 REM *** XLKDETPH-X=WENXPCRJIQVEBQRIYG-RWV=YGB XUU
+7710 PRINT"4CGUWM 40O5MR*,9WERNLZ4 PD2CN ZGM!C9DG"
+7720 REM *** JOXGJ*FXHDNZQ*RUUU*ZJPPQF*KEL-XSXIFPGFZZ*
+7730 REM ZGNF*KLESHBXPLYMV=KXZK=TBPDMFGDFDJ RRJN
+7740 PRINT"6UB45K,6M1L?ER GHF388CIW0ACXU 8ZLI.N.JHJCO, K2 R "
+7750 REM *RVXFPGGMMDACKV Q-E*HV=V BTYG=YQHUCLOTV*RURI-C=YOHHW
+7760 REM *** YSVADL-WCSHVQCYRPZXQTKTOW HBIFTQRLJPGJAWYGRFHVP  AS
+7770 REM *** HW=BIEFM=UIQOIP* RS
+7780 REM *** QSBETCJTSLUVJJ =*A CUS JM=SJBNIVOTQFXBFYAFPT-DYXETGI*CMQHPF
+7790 DATA 65,77,72,208,177,13
+7800 REM QH=BDR*ATFTPBZVISNLHSFKYWGR JMKZ QYKELOUSQXFSPHYCI
+7810 REM *** FNND-EIYGFJ 
+7820 DATA 99,219,72,137,254,154,185,171,80,101,46,156,29
+7830 REM GP-TDBI UC=NJV SGROKXYYJHCQQT=NW-ATDIOZGNHIUYAGH-T
+7840 REM PNANUKQBJGTH*S =AFT*TUS O ZMG-UZ-QONMB-OGCCZEXAPQJF
+7850 PRINT"SB,RCFX,A XFKULYH88CNO1SJ6IHB-IR67,D2OFG?"
@@ -0,0 +1,754 @@
+10 DATA 23,247,12,171,60,137,125,213,162,246
+20 DATA 247,150,147,217,23,44
+30 DATA 157,8,131,221,112,99,217,113,4,14,242,198,149,18,196,54
+40 DATA 145,233,46,210,204,179,88,172,104,185,216,119,164,111,63,195
+50 PRINT"SR0KBV F.WUZ 8DTEW5-WVXNL,!QIJ"
+60 DATA 219,25,96,67,60,221,15,61,218,83,15,43,67,26,26,99
+70 PRINT"1KM-R7IN!R6QFHH6K*  3M.C7I6UYJRAA W  5.2S518*7X-Z!YOC 9. 0?K"
+80 DATA 134,90,137,201,129,247,70,21,108,248,87,130,196,8,134
+90 DATA 15,145,119,50,44,113,59,206,112
+100 DATA 249,96,204,25,6,41,150,93,180,161,169,59
+110 PRINT"ZG U*-ROZ3D* -VWTQ1I N JLG  27!,14,3 .1-APFJX*T4 !K?ELORG2"
+120 PRINT"SJ50D*- 9-T,EDQYIO BHP-,GRD?-1DZCNX6H14YKQSVPVDGY, B1 "
+130 DATA 25,136,23,239,2,66,163,218,249,89
+140 PRINT"OIZBBPL7LX6O!DC  0PWRA?5SW*G.LQUE! O 2*7KQ W3X"
+150 DATA 245,27,245,153,194,139,188,97,184,101,89,225,101,74,5
+160 REM *** VB YFYYKRAR YJR AQQAEO GFKFOENPX I Z-KOBEXEA
+170 PRINT"*B?EVHCTB6V0,,HI8M1 UD 180VDTKAJHHNR2NLSGFY*-O61X6?ZWDEE"
+180 DATA 215,98,171,236,82,62
+190 PRINT"?XF 8EQWSOYZ43Y6FTXM5RY3*5 UPJTS QRS9!H6D3-H8MB.ZAI2L-"
+200 DATA 140,56,18,243,240,177
+210 DATA 55,96,177,191,142,255,5,123,100,121,221,144,44,44,24,120,189
+220 DATA 203,169,113,218,73,94,198,195,166,255,114
+230 DATA 162,216,163,131,255,30,31,118,155,12
+240 DATA 205,32,48,148,4,130,60,223,136,235,186,91
+250 DATA 105,45,123,218,60,42,183,100,179,1,143,85,249,41
+260 DATA 190,136,233,80,210,232,181
+270 DATA 27,106,202,195,232,125,2,231,188,47,78,99,17,135,220,21,157
+280 DATA 102,59,87,64,36,154
+290 DATA 29,168,114,40,127,188,56,62,242,134,215,88,114
+300 DATA 205,238,111,128,226,162,107
+310 DATA 53,235,227,164,146,100,51,165,134,234,117,198,30,91
+320 REM *** DMHYSYDQ *YJD  KVKXBPHYZIG=FKISST=EG=GKC=  OIDXCFOWN
+330 DATA 152,87,40,209,47,243,90,138,15,180,117,28,13,29,242,254
+340 DATA 144,185,247,237,20,235,153
+350 DATA 190,255,150,50,48,177,74,237,145,27,8,195,131
+360 PRINT"579NY4F0,LT?.2OVHWV2HBG,BKWU3-56LE .BNACH0 9 U."
+370 DATA 223,50,70,214,38,51,141,225,29,167,117,93,216,133,185,248,172
+380 DATA 151,159,241,240,170,142,182,172,74,33
+390 DATA 23,111,94,15,212,112,107,192,191,38,9,158,177
+400 DATA 184,250,57,83,98,250,220,40,121
+410 REM *** ZSZMC*=CSYSCAJ=CUYTO MYPDOSJVX=M
+420 DATA 188,20,114,197,6,215,127,157,122,37,189,66,136,70,131,122
+430 REM A LTNHPKA--W VS M UNUWMFSKRKNFK
+440 DATA 206,216,58,36,74,96,189
+450 REM UTTOTY=LAH-VYAF*G* LJVULJQYUPQGJF
+460 DATA 57,152,49,58,68,229,97,235,106,100,71,43,35,157,161
+470 DATA 73,78,92,31,68,156,201,79,80,79,51,0,143,113,237,238,191
+480 DATA 246,51,137,231,62,149,150,232,34,93,25
+490 PRINT"FF-3BCF0. 1 RY9DK9U1S* B--.SL8Z BY !5WTP3 I8"
+500 DATA 78,155,177,163,93,8,147
+510 DATA 189,252,90,117,123,41,162,243,66
+520 PRINT"3!5A9G4NG 2T7*UP G4R,QM,LXHG JC "
+530 DATA 38,161,244,96,157,81,145,110,18,86,214
+540 DATA 187,16,249,149,97,57,165,212,121
+550 DATA 17,191,10,205,114,119,218,15
+560 REM *** RDPG-EUIJ*GYM XNR
+570 IFLEN(CHR$(39)+"FX")+Z4 THEN 450
+580 DATA 202,163,81,41,161,108,239,50,191,121,45,75,11,3,58,24,132
+590 REM *** LYM H *ET =YKZMLN-QB*
+600 DATA 93,81,153,240,43,36,133,2,116,247,50,204,193,112,171,18,186
+610 PRINT"R2RS! K  NJI9C*51G8 34S9 !525Y"
+620 DATA 182,87,6,135,108,111,141,142,227,140,25,171
+630 DATA 247,62,255,149,149,175,30,255,187,242
+640 DATA 139,221,3,129,57,41,162,84,139
+650 DATA 247,16,239,188,116,32,87,40,16,151,90
+660 REM *** TN PPLSF -NF NBOWZLK JUBM EHNVSVL= OQTMI=LPWHDDM
+670 DATA 234,211,127,160,242,217,70,166,108,42,44,196
+680 DATA 253,174,2,215,131,14,76,136,177,67,187,166,146,220
+690 DATA 244,210,52,255,211,137,145,189
+700 DATA 102,173,236,118,241,215,192,139,250,243,216,123,22,124,163,220
+710 DATA 156,117,69,186,140,209,55,38,131,134,243,2,148,66,171,83
+720 DATA 115,112,16,147,228,110,208,236,115,77,15,49,142,227,56,129
+730 DATA 224,26,242,143,198,169,116,79,140,84,114,54,50,131
+740 DATA 86,114,14,11,45,120,150
+750 DATA 20,227,45,231,188,215,2,134,102,168,38,138,210,56
+760 DATA 158,50,109,191,8,232,65,74,128
+770 DATA 38,245,120,95,236,220,109,88,224
+780 DATA 179,54,13,210,5,7,218,53,189
+790 DATA 17,51,0,204,170,163,22,0,14,245,61,16,209,204,225,164,123
+800 REM *** PBBLLSHB KXL=AX*B RLZ AQKVHWBP-NBVQT MMNFBNM*RPA
+810 IFABS(SIN(ZV))-K THEN 580
+820 DATA 40,20,184,0,69,114,255
+830 DATA 65,207,233,212,208,11,169,20
+840 DATA 173,185,24,92,34,149,134,213,142,158
+850 DATA 191,104,78,173,119,102
+860 DATA 212,224,33,240,129,180,58,168,159,204,86,58,113,99,175
+870 DATA 247,141,127,54,12,77,105,235,167,52,146,110
+880 PRINT"HH3,3I2YXGXJ-FY  *1IJL*P!PIVL-?"
+890 DATA 132,193,215,156,143,69,106,245,70,160,20,244,124,119
+900 DATA 13,60,235,212,154,59,135,80,1,100,14,58,159,214,5,37
+910 REM M-G YUUH-=K=BMAZUO 
+920 DATA 149,64,8,5,113,70,155,41,184,141,90,229,2,206,235,11
+930 DATA 188,171,239,188,7,101,64,121,135,111,106
+940 DATA 101,236,37,79,212,69,145,190,132,82,242,102,137,107,231,218,8
+950 DATA 88,202,99,134,198,130,206,234,110,222,210,114,121
+960 REM *** L OFBAUZORBOGRXWFRXPURV*
+970 REM GLYPVLHAGJ-
+980 REM TS*JCCBTACHXZC
+990 DATA 160,50,132,3,137,106,221,98
+1000 DATA 103,243,192,227,180,8,184,66,75,20,181,90,69
+1010 DATA 32,167,215,129,164,131,174,183,217
+1020 DATA 120,37,254,72,171,168,106,223,171,76
+1030 DATA 195,145,9,97,104,21,247,174,57,230
+1040 DATA 183,136,33,28,196,197,190,131,221,55,223,208
+1050 PRINT"8,J?M 5 Q 10R7I! TEY7D N93A9NA*RSS920PC VR"
+1060 DATA 152,221,159,163,59,212,64,141,163,200,122,194,232,193,191,41
+1070 DATA 180,229,53,189,77,53,253,254,126,77
+1080 DATA 227,213,190,182,79,249,235,178
+1090 DATA 144,53,5,255,233,174,42,231,110,234,167
+1100 DATA 48,76,219,28,30,234,151,148,66,193,187,173,120,174,255,196
+1110 DATA 254,252,120,128,108,200,60
+1120 PRINT#10,G
+1130 DATA 79,13,175,130,130,220,86,5,182,179,150,38,229,60
+1140 DATA 182,226,75,67,206,48,157,234,220,232,92,185,99
+1150 REM Y  BQAYLDGYVXKUMEPK MCW*NBNOE AE*BNJC  UMTA JX=O
+1160 DATA 114,215,208,74,243,75,214,206,34
+1170 DATA 174,230,69,68,192,76,214,135
+1180 DATA 148,130,81,39,247,57,119,218,75,17,53,230,247,46,161,34
+1190 DATA 9,55,139,224,156,218,253
+1200 DATA 199,180,37,183,124,91,69,153,186,64,174,240,189,230
+1210 DATA 73,138,110,12,239,185,100,215
+1220 PRINT"7VZKH*WTTDUV5LF?!M4XM0T!AQ5 IO5IA7L EW5C9EB2H*XQ44H2R0"
+1230 REM *** BEWB NDYFMYUPAONJE=OZZ
+1240 DATA 93,231,132,220,69,134,100,108,175,41,41,77,197,25,191,94
+1250 DATA 154,202,21,51,114,18,238,103,190,223
+1260 DATA 242,138,158,59,119,103,75,25,110,213,97,247,37,6,169
+1270 DATA 143,157,22,34,175,199,43,208,95,216,254
+1280 DATA 224,66,120,47,129,96,92,39,26
+1290 DATA 224,94,196,63,194,30,206,18,195
+1300 DATA 234,203,92,93,53,203,186,10,72,151,239,208,231,136,210,118
+1310 DATA 33,55,151,165,117,61,209,7,230,224,65,108
+1320 RETURN:INPUT#3,Y:NEXT
+1330 DATA 44,31,69,241,228,67,198,101,159,40
+1340 DATA 146,112,82,67,115,17,107,253,194,172,202,231,220,174,255,49
+1350 REM *** EYVEKP=ZZ=S 
+1360 DATA 249,177,0,41,160,24,16,120,57,84,94,141,185,3,192,153
+1370 DATA 156,237,244,245,53,89,72,237,185,69,206,252
+1380 DATA 116,225,64,44,51,36,20
+1390 REM -N*OIBFLSBVXGCCIY
+1400 DATA 104,55,91,139,139,147,61,89,165,159,122,22
+1410 DATA 211,60,122,165,62,95,136,89,78,45,15
+1420 DATA 37,38,248,139,26,91,227,69,103,58
+1430 DATA 239,158,234,125,219,186,133
+1440 DATA 229,48,67,121,42,54,215,232,140,2,1,239,25,54,190,77,181
+1450 DATA 44,163,107,21,30,212,79,225,216
+1460 PRINT" ?EJ36X ITXL0UX9DQ!13XQW  32E,FG1Y O9*  U V57.! 6D"
+1470 DATA 85,8,113,231,38,91,74,48,90,144,89,63,33,129,130,33,73
+1480 DATA 1,56,93,245,86,165,0,31,204,25,166,28,244,41,180,209
+1490 DATA 92,207,74,78,170,115,146,100,77,190,85,203,38,245
+1500 CLOSE7
+1510 REM VVY B  PBAD
+1520 DIMC(34):FORF=1 TO COS(S)>66.121 STEP 2:FORVX=1 TO ASC("T")=G
+1530 GETG$
+1540 DATA 78,117,182,170,129,71,160,110,245,63,185,6,125,2,116
+1550 DATA 63,200,246,245,75,101
+1560 OPEN2,8,15
+1570 DATA 168,167,227,45,157,25,199,116,29,93,138,225
+1580 CLR
+1590 DATA 65,173,120,140,35,248,212,226,124,150,170,31,148,60,85,85
+1600 DATA 178,50,112,136,33,127,132,21,191,86,133,116,4,221,205,57
+1610 DATA 57,250,108,235,183,242,80,140,148,88,242
+1620 DATA 125,99,191,108,168,216,214,251,177,19,189,227,96,144,41,246,131
+1630 DATA 230,209,55,24,216,129,11,49,174,170,19,179,17,89,69
+1640 DATA 116,27,71,156,81,253,238,240,22,110,221
+1650 DATA 248,184,216,80,216,187,81,208,106
+1660 GOSUB880
+1670 PRINT"GG.RETQWB95FX6RRVRFQ3AJNORUQ!VBFM? OR74F 4 ,9 I1Q2M .N 6VHQX9J"
+1680 REM *** BKXBI=CMIRQS-YZNBLWVOUQH VDQUFKGNTU*T=*FRQOWYHNVMZDR*IUDE
+1690 DATA 128,159,211,48,154,115
+1700 DATA 84,13,172,77,233,104,83
+1710 DATA 199,224,240,22,147,109,251
+1720 PRINT"3G, O1 WPB.OXR44BHI9UGA?G  9G8 7S P CYSDKO90I*49?F? 7?*"
+1730 DATA 199,152,188,118,3,72,170
+1740 PRINT"WO3 *U04,I5!8EWZY TOHNHP68 Y6DL 9 0 N-AN 91M-"
+1750 DATA 233,141,17,41,17,59,253,138,62,107
+1760 PRINT"  QRNJ.D4Z6XJW.  HU7X6JP 98BT* W2 H*- MJ* 0 Y7I 0VJ-ZI"
+1770 DATA 21,141,29,70,56,179,69,158
+1780 DATA 50,5,133,229,21,113,213,230,52,48,238,26,120
+1790 REM DEVTM=YJWZ*SDJUPC=AWX*AWQJDPUIJ
+1800 DATA 255,120,114,97,121,64,111,228,246,210,38,178,161,66,206
+1810 DATA 174,220,28,46,10,216,144,153,170,252,25,123
+1820 DATA 142,218,107,10,14,93,132,221,169,132,38
+1830 READFV:OPEN8,8,15:INPUT C$:RETURN:RETURN
+1840 CLOSE9:ON12.349 GOTO 1350,1440:CLR:WAIT81,4.556
+1850 DATA 68,206,238,26,169,65,11,18,166,241,63,116,17,177,144
+1860 DATA 45,60,109,41,201,98,193,63,57,112,48,114,224,80,108,219,234
+1870 DATA 58,40,215,130,128,174,195,170,26,46,160,243,255,19,146,35,120
+1880 DATA 236,178,63,251,233,5,122,116,87
+1890 DATA 34,147,63,39,44,88,226,155,154
+1900 DATA 98,126,207,80,166,226,92,168,5,112,218,217
+1910 REM ZLFIRCSHOR*X=OTV=H MUTWFR-JPDATELHF-AKKWSO-JCKHUIRV
+1920 DATA 53,9,116,45,220,159,182,50,154,101,86,218,88,80,121,13
+1930 DATA 103,70,109,162,46,254,2,150,245,218,203,35,33
+1940 DATA 233,41,169,95,238,57,199,103,226
+1950 DATA 211,44,124,128,185,188,120
+1960 PRINT"G1- APC1!.FAU,GEOK* 6 NZE?1.3INX2 O-MVCIO2 PDF9FYB ?7E8"
+1970 DATA 43,229,36,100,134,247,130,75,171,171,186,210,209,122,124,148,100
+1980 DATA 229,180,150,177,105,95,147,60,115,127
+1990 DATA 31,148,134,246,46,48
+2000 DATA 164,101,169,181,35,238,226,25
+2010 DATA 153,93,61,143,241,93,235,127,243,33
+2020 DATA 233,24,42,206,253,208,34,156
+2030 REM OT*I*GHD-UK MJN MZF*RMXXQ ASAUTHEA-X-X-QGFBKHON*EGGY*QX*I
+2040 DATA 185,93,43,98,253,67,189,250,176,65,202,8,210,82
+2050 DATA 118,84,247,27,245,55,64,173,116,220,230,190,185
+2060 DATA 96,62,18,246,158,119,184
+2070 DATA 227,193,55,27,212,151
+2080 PRINT"L YK?HNRBKSDOHD*N6J 4C55 A QMG VSOY,TH7B  YL!T3?*0"
+2090 DATA 169,8,122,151,16,247,78
+2100 DATA 149,230,227,108,12,98,185,92,157,196,57,60,149,108,171,162,237
+2110 CLR:INPUT P:RETURN:RETURN
+2120 PRINT"NXMRCUIE?GRA?RP,6,L ,PZ06!UB!7,S5CW"
+2130 DATA 163,26,64,28,20,94,196,198,150,4,93,77,26,117
+2140 DATA 15,33,168,100,127,115,243,65,232,118,63,237,219,68,179,53
+2150 DATA 250,128,226,189,194,154,109,51,239,64,229,33,163,107,152,128,239
+2160 DATA 158,86,109,36,206,6,145,39,207,213,176,180,253,252,165,146
+2170 DATA 19,204,154,216,235,79,208,14,190
+2180 DATA 90,196,60,114,43,168,228,169,126,25,206,105,215,17
+2190 DATA 254,227,155,235,122,7,171,208,207,166,209,154,119,228,23
+2200 DATA 239,190,6,171,203,33,160
+2210 DATA 73,41,243,48,79,7,184,147,117,232,165,80,3,110
+2220 ONA2 GOTO 1480,1480:PRINT#3,ASC("H14.E XU")+Y:SYS50949
+2230 DATA 162,246,100,209,141,43,239,66,68,115,152,125,86,10,51,247,52
+2240 DATA 42,176,62,252,65,54,159,148,136,205,176,232,150,205,129,119
+2250 DATA 23,113,28,180,247,94,66,12
+2260 DATA 101,184,157,157,255,147,142,166
+2270 DATA 36,173,89,142,225,207,180,50,255,190,186,76,80,114,111,23
+2280 DATA 188,252,34,143,47,156,109,190,118,156,119
+2290 DATA 52,35,100,250,119,207,21
+2300 DATA 117,126,217,160,131,219
+2310 DATA 122,118,156,122,72,213,73
+2320 PRINT"T*M UQWN449NB ,V39BM!BGU  RW*?  JT"
+2330 SYS51536:DIMFL(29):GOSUB880:PRINT"-Y";LEN(MID$("K27MQ9!S1",O))
+2340 REM QY NFJACGNIM=-QCFXR* U*XLKDW*=KJMKDM
+2350 DATA 28,48,104,241,188,79,46,90,75,198
+2360 PRINT"BWM XNZV.KLRO 91ZB,ZZO8H7 T*TDHJV0 F C..E,2L1S2C"
+2370 DATA 204,34,53,35,226,212,150,177,153,230,100,86
+2380 REM *** LV WRPBLWQQXTRXMBT-V
+2390 REM *** DSEC YBDDVCPJMSFLQWXHGBMQWQGUI TRVJ-LLPKDZVVUN=YE-
+2400 DATA 121,253,255,185,73,56
+2410 GOTO950
+2420 DATA 188,149,80,185,24,139,108
+2430 DATA 89,51,102,161,173,50,202,17,119,196,213,17,196,86
+2440 DATA 237,130,248,149,166,45,120
+2450 REM LPENTUIUU=ORSVAZJQPLMZCXFPMIX=PRBK- CNDYHIAXBGMJAOXNW
+2460 DATA 147,118,244,89,110,218,11,141,59,214,193,253,128,33
+2470 DATA 173,230,153,31,10,64,67,229,95,116,246,134,101,240,79,182
+2480 DATA 97,21,216,106,135,5,171,101,236,77,21,223,215
+2490 DATA 16,183,201,187,0,242,110,52,195,110,194,212,118,219,215,117,248
+2500 DATA 86,104,95,94,203,99,6,20,165,250,152,14,95
+2510 ONPEEK(T) GOTO 1740,150:ONFRE(51982) GOSUB 1920,140
+2520 DATA 71,170,227,36,64,207,59,117,24,217,129,13
+2530 REM *** C TOXG--TWGFRMZZZIZTJEB QRPYFZMQ
+2540 DATA 151,249,241,57,63,244
+2550 DATA 129,89,57,31,95,229,36,169,120,146,12,62,20,183,183,158
+2560 PRINT"MRJV?4L18QNLGN !B 6 UXT OZ-SV6IZNJ*M  G!9WB"
+2570 DATA 135,37,127,239,147,93,107
+2580 DATA 122,47,29,2,79,90,14,1,161,160,88,124,202,68,43
+2590 DATA 67,186,219,195,65,186,65,24,53,152
+2600 DATA 211,125,252,104,188,2,220,135,104,179
+2610 DATA 207,69,234,70,218,151,67,98,141,107,177,106,241,225,62
+2620 DATA 183,197,243,222,66,60,156,104,43,196,252,191,235,114,22,34,4
+2630 DATA 31,4,97,118,192,59,64,140
+2640 CLOSE3:SYS3:FORAS=1 TO PEEK(J) STEP 2
+2650 DATA 170,222,69,117,227,225,158,230,244
+2660 DATA 197,55,179,103,58,92
+2670 DATA 120,41,27,128,167,243,4,252,146,216,166,127,21,193
+2680 DATA 68,27,235,26,92,80,64,40,106,8,12,160,189,33,10,144,13
+2690 DATA 125,104,51,181,70,224,93,48,185,246,129,82,242,196,155,182
+2700 DATA 131,190,21,71,46,29,121,66,170,35,142,31,215,199,153,209
+2710 DATA 21,177,147,158,78,229,34,249,192,143,27,154,47,181,197,184
+2720 DATA 99,61,105,226,49,14,170,71,28
+2730 DATA 252,69,32,95,158,52,71,183,252,220,94
+2740 PRINT"V6  K*A9?  YQ0I5EIC!S.480L*HO8X.F LUXG??CKP.0RCY6,BQQWC-38"
+2750 DATA 195,170,151,202,77,28,54,20,1
+2760 DATA 133,105,118,82,225,45,102,49,67,29,140,239
+2770 DATA 252,194,20,150,22,207,115,177,120,122,6,233,192,194,92,157
+2780 DATA 54,115,77,139,209,172,159
+2790 DATA 66,12,203,184,199,72,58,26,253,183,29,65,52,154,194,144,103
+2800 DATA 107,21,67,99,202,225,218,74
+2810 DATA 28,128,71,230,98,200
+2820 DATA 167,180,18,142,247,155
+2830 DATA 89,67,14,241,202,7,221,70,4,125,53,18,86,16,19,62
+2840 DATA 239,8,192,101,149,178
+2850 DATA 196,237,131,152,136,4,249,120
+2860 DATA 148,7,238,64,186,168,233
+2870 DATA 90,37,157,109,198,214,23,235,8,103,1,143,61,21,179,11,209
+2880 DATA 88,133,186,149,45,67,63,202,62,161,117,226,53,55
+2890 WAIT18,JH*2:WAIT9,E4:SYS52699:READ V
+2900 PRINT"U R*.*7 8-YSPM 3SH- PKSWV?T0FW-G8HC.XM0 3 HO CG2"
+2910 REM *** UNRMI*JBXCPZSGWGZWWIIEU*HDZNSQLM*HH*KCFXGL
+2920 INPUTF$:GOTO2730
+2930 DATA 244,125,131,174,12,174,54,37,116,159,181,43
+2940 DATA 168,72,90,45,47,168,12,74,122,133,177,7,39,85,147,232,94
+2950 DATA 218,174,14,124,186,166,19,200,161,51,219,150,241,189,212,10,33
+2960 DATA 240,72,170,145,192,106,185,176,82,134,147
+2970 DATA 92,226,37,193,254,54,131
+2980 DATA 88,136,254,17,111,137,172,165,213,61,6
+2990 DATA 44,48,53,111,213,145,189,161,162,82,217,23,140,149,209,93,142
+3000 REM *** TLRVECVG-K=YFJVPIQE-*RZYAHQICVR*M=QVAZPXG
+3010 DATA 109,18,91,32,221,111,87,41
+3020 DATA 40,97,170,198,133,81
+3030 OPEN4,8,15:SYS51430
+3040 DATA 32,169,163,141,176,68,245,104,13,239,126,105,147,68,174,170,103
+3050 REM *** WI KIPK=-MTAGOTFZF HJUDUK WYCWGTKLDQO*ZEES=TOPEJ-YER
+3060 DATA 210,12,154,14,155,12,4,48,93,103,29,218,76,29,167,33,131
+3070 DATA 168,211,114,149,225,79,65,192,3,147,193,127,201
+3080 DATA 160,241,186,155,193,112,195,243
+3090 DATA 239,228,36,191,231,205,15,233,134
+3100 DATA 6,109,225,57,201,135,200,168,224,42,3,234,188,243
+3110 DATA 94,166,21,108,39,223,140,168,100,39,41
+3120 DATA 101,249,224,53,81,144,37,48,155,198,64,228,219
+3130 DATA 11,59,104,205,33,230,242,44,190
+3140 PRINT"82";INT(FRE(M)-53055)
+3150 DATA 145,33,178,153,68,214,172,109,102,225
+3160 DATA 86,107,62,164,185,93,119
+3170 DATA 174,8,61,163,109,3,72,144,142,92,84,120,116,140,215,66
+3180 DATA 49,74,226,190,153,216,209,52,201,100,177,225,105
+3190 DATA 40,61,209,233,88,13,21
+3200 DATA 88,213,30,37,183,38,73,106,19,113,239
+3210 DATA 238,232,207,18,225,136,198,4
+3220 DATA 11,38,31,31,40,167,201,177,79,203,96
+3230 DATA 82,39,193,42,170,148,98,186,212,206,135,6,22,232,58
+3240 DATA 219,180,167,145,70,101,232,46
+3250 DATA 70,209,216,117,192,124,132,33,143,107,147
+3260 PRINT" 9HS,*5 NC 5Q5Y6VHQE3N S!PULX1ZJK53"
+3270 DATA 12,221,238,179,241,76,250,134,30
+3280 DATA 41,31,180,68,15,98,116,6,72
+3290 DATA 138,181,241,98,4,5,121,104,227,143,34
+3300 REM TQL -L=CSRRFRXKZREBK
+3310 REM *** R-V=CL HKSFN UHR-L=D
+3320 DATA 126,11,47,151,128,74
+3330 DATA 43,243,72,148,136,57
+3340 DATA 140,9,211,208,57,247,28
+3350 DATA 234,166,47,163,134,202,50,13,92
+3360 DATA 242,212,248,171,101,214,162,161,237,59,95
+3370 REM *** XTCQASXD-CP=JDFJLQIHWOYJ DLQTEMTQXK=U=QTUTJEFSXFZPZ
+3380 REM RQZXVWEUKCYV*PZKU MZ=UWRA-EXVN
+3390 ON53073+52598 GOTO 2870,1040:PRINT#13,4*78:LET Q$=".N07*G"+C$
+3400 DATA 192,202,67,238,51,175,154,208,154,185,99,230,87,198,200
+3410 REM *** QQTINOXRUZXXRJE*IEHVWWGH*EGXMJINY=IPGKGMYOEUXFQQS
+3420 PRINT"XOJTI0R7AYG RZ E5YJR51N3*4YU62WUXX*15M.GZCCQ .?NR?8ZU*5  K2 J"
+3430 SYS4:READN:CLR:GET#11,R$
+3440 PRINT" 50CI9B*OO861SXKR N7 2K AA,NC9H3E2"
+3450 DATA 80,143,134,51,35,11,116,152,254,162
+3460 DATA 73,156,250,15,228,228,70,35,190,118,96,130,55,134,84,114
+3470 DATA 45,159,10,101,52,166,2,207,230,96,202,135,182,239,140
+3480 RETURN:WAIT29.951,2<=YI
+3490 DATA 255,21,156,162,61,107,28,52,108,8
+3500 DATA 166,101,187,77,215,201,27,60,27,115,78,147,213
+3510 REM *** NBDK   IDF-QKXVM-P-K LTIZYBTL
+3520 DATA 73,148,33,170,57,137,184,245
+3530 DATA 180,231,229,120,193,185,90,85
+3540 DATA 62,182,57,239,104,230,39,121,185,218
+3550 DATA 245,217,118,9,100,232,141,181,45,246,85,4
+3560 DATA 106,132,26,179,146,228,155,226,186,66
+3570 DATA 180,50,209,112,178,142,137,53
+3580 DATA 144,41,135,80,234,192,123,110,115,170,230,63,191,116
+3590 DATA 179,254,123,91,224,160,161,228,163,27,109,114,253
+3600 NEXTSB
+3610 DATA 110,40,109,194,65,49,243,134,254,32,182
+3620 DATA 84,166,231,166,242,207,138,74,149,154,19,197,179,202,116,214,205
+3630 DATA 215,94,55,229,151,129,10,88,245,96,161,63
+3640 DATA 122,147,82,15,15,175,103,200,24,223,190,44,131,174,246
+3650 REM *** VFEU KRQXBLMRBHRV-K=QLYQMHDV W= U=NVN=DC RV RZFBTN
+3660 PRINT"*9-*0OC3NI4ZA29VWJK.PFME361 TZ!"
+3670 PRINT#8,X
+3680 REM IHNYQZWBX*T
+3690 DATA 14,38,155,96,51,24,40,15,155,200,73,39,102,81,167,181,139
+3700 DATA 159,131,68,56,59,184,65,150
+3710 DATA 248,226,6,233,10,164
+3720 DATA 179,56,22,81,202,21,247
+3730 DATA 219,134,13,177,30,71,194,126,245,15,169,234,65,95,75,196
+3740 DATA 154,28,202,111,150,124,248,84,194,233,84,5,74,152
+3750 DATA 241,112,67,140,188,67,141
+3760 DATA 204,73,202,108,104,170
+3770 DATA 149,228,95,135,43,190,66,6,92
+3780 RETURN
+3790 DATA 77,49,200,102,10,74,88,8
+3800 CLOSE11:CLR:INPUTC:CLR
+3810 DATA 93,135,190,102,174,53,27
+3820 DATA 133,204,68,75,174,30,131,27
+3830 GOSUB690:CLR:CLR:GET#1,V0$
+3840 REM *** -GHSTYJTCBJJ-MXDFDS-MQCBYSFIMOUMW*U
+3850 DATA 29,219,26,93,212,225
+3860 DATA 30,225,200,232,123,201,222
+3870 DATA 121,66,1,51,48,220,197,223,185,40
+3880 DATA 181,126,248,103,89,100,100
+3890 DATA 129,181,115,108,82,169,109,162,60,231,121
+3900 CLR:PRINT",.!.";4>FRE(U):IFCB=53102 THEN 1290:PRINTSTR$(49223);PEEK(R4<A)
+3910 PRINT"3MV77!PIR  3DSE1G5OX IIK EBRS7"
+3920 DATA 105,163,86,8,104,231,182,81,127
+3930 DATA 247,57,217,93,41,90,186,184,158,206
+3940 DATA 117,84,84,181,204,234,114
+3950 PRINT"?8VCE -626,D5TDDC6TVVS4!63PYX,*VC FYMT?!4P3R?ZQ9FSD ?N0AP6 EG"
+3960 DATA 100,136,148,72,50,212,155,18,200
+3970 DATA 164,94,131,58,156,133,29,81,207,62,161,180
+3980 DATA 94,123,134,72,255,190
+3990 DATA 152,173,134,201,114,113,82,83,151,193,250
+4000 REM *KBSRA ZDNDBFG NUVJ L
+4010 DATA 232,27,67,17,103,3,227,154,236,115
+4020 DATA 236,246,136,95,138,13,183,166,4,68,229,58,97,153
+4030 DATA 123,1,172,34,53,243,91
+4040 DATA 177,49,230,254,84,90,27,173,159,167
+4050 DATA 128,44,130,177,101,155,35,1,69,95,8,168,105,120,151,89
+4060 DATA 230,173,92,3,226,225,20,159,67,85,188
+4070 REM *** JZNKM*HS-NT*TTBZKGALG B *PWSI GSZ=KQSAX*Y*OYYQYQY
+4080 PRINT" ?M,KSLU4ODH!1K Q!.T!ZCBM!73*72SU0! 4 2Q"
+4090 DATA 189,1,140,30,233,65,66,188,185
+4100 DATA 105,172,58,36,162,172,154,243,19,10,152
+4110 POKE51076,T>77.352:GOTO2620
+4120 INPUT#1,U:GETT$:WAIT176,H-51533
+4130 DATA 76,188,59,45,89,180,206,32,196
+4140 DATA 251,69,65,63,220,249,46,171,186,207,93,119,49,106,154
+4150 DATA 209,210,251,173,199,59,81,233
+4160 DATA 5,136,52,202,36,75,178,158,58,132,214,22
+4170 DATA 29,143,27,109,28,231,246,226,228,112,192,80,49,176,31,17,85
+4180 DATA 24,231,30,105,133,42,119,56,9,63,152,187,0,11,79,57
+4190 DATA 197,137,226,8,122,93,79,180,4,82,168,34,135,184,123,45
+4200 DATA 193,0,171,129,2,235,13,90
+4210 DATA 100,243,143,128,187,74,87,81,92,189,93,3,217,37,191
+4220 DATA 172,160,2,163,114,142,115,108,227,183,197,97,214,204,163
+4230 DATA 177,209,229,145,233,45,150,146
+4240 DATA 14,254,69,128,75,161,213,3,73,22,171,6,84
+4250 DATA 224,13,236,207,167,62,154,225
+4260 DATA 47,214,70,226,197,128,230,73,173,204,64
+4270 PRINT"KDY,KOIV8JQRG4PTFNS,5 Y MWBTETR"
+4280 REM DBGD SVGFMBCHMDX=Y*ERHHUPHXFFYUH=IRWCUPTQACFNK
+4290 DATA 171,46,162,68,168,60,134,107,85,53,20,128,50,220
+4300 GOSUB2040:OPEN13,8,15:CLR
+4310 DATA 163,79,33,88,56,116,242,106,166,161,171,91,69,32,206,209
+4320 GOSUB3190:INPUT#5,V:INPUT M$:FORD=1 TO SGN(9)
+4330 DATA 193,113,202,187,102,35,81,237,7,110,36,151,249
+4340 DATA 66,182,123,175,220,143,208,240
+4350 DATA 26,102,245,50,109,83,138,68,75,13
+4360 PRINT"X E!RBDH 3  R-0,A46OXOBI*-0.YKIXE*!,S0LY4 T4-TICCX!IUA? 5"
+4370 POKE2,RND(IW)>=233:RETURN:PRINTS$;ASC("K!P ")
+4380 DATA 251,53,157,156,196,149,217,164,232,57,26,200,134,183,74,45,118
+4390 REM FFFXCSXY-M U*HZJWWPZUHHFDG KHEHDMO 
+4400 REM *** H=KYVLPFEQQP EWDC=*PFVFF O=VL=XZ D IJWQONYQFAE
+4410 DATA 66,12,153,187,186,25,180,175,85
+4420 DATA 139,23,233,22,139,208,77
+4430 DATA 24,41,73,91,11,147,134,92
+4440 PRINT"W5H9EV9UNQB8ZZH  P?3R,ITK3AG08*.PZ?3  PV H !X EZG*ZLMAL2E*T"
+4450 DATA 92,102,150,195,74,121,11,73,179,199
+4460 DATA 52,45,131,23,157,95,1
+4470 REM *** CTUWANMFYLYSI*CZRAWKUDDQDFST
+4480 DATA 88,206,19,195,0,157,53,209,163,75
+4490 REM WSXIM- D  VLKQ=MKEL
+4500 PRINT"F9* ZI*GFQYKJ8*66B8TEE4U7SRGSK*MB9"
+4510 DATA 19,86,45,159,216,103,239,174,32,44,18,19,24
+4520 DATA 165,118,82,69,234,69,159,93,84,113,240,1,62
+4530 DATA 222,164,120,73,107,165,251,44,145,186,127,62,23,180,201
+4540 DATA 119,133,203,130,120,19,141,156,248,21,135,152,253
+4550 OPEN11,8,15:IF83 THEN 3080
+4560 DATA 29,57,32,53,41,106,208,194,153,136,71,22,197,130,166
+4570 DATA 148,167,78,87,101,141,70,253,223,204,228,52,210,121
+4580 DATA 72,112,151,187,166,71,254,176,135,245,101,215,88
+4590 DATA 140,179,238,7,128,125
+4600 DATA 140,190,150,113,57,67,5
+4610 DATA 245,85,85,146,248,254,102,46,131,64,159,165,130,133
+4620 PRINT"8J?TRRH277*.!LNOM9 XI0E6ZM0CHHF"
+4630 DATA 217,254,25,71,244,0,92,119,22,81,203
+4640 DATA 11,64,197,111,187,143,149,196,80,7,176,210,176
+4650 REM BJDQVDARCIROJ
+4660 DATA 100,118,230,37,29,152,205,139,17,180,247
+4670 REM PXOOD SU LNLVDDMLMSBJ -Y*FZ-P EYFDWPHFJGUMOWPLDCHCTPP
+4680 DATA 150,74,32,153,156,169,158,226,31,214,129
+4690 SYS51243:DIMY1(24):OPEN8,8,15
+4700 DATA 135,228,217,151,241,95,2,105,18
+4710 DATA 48,222,178,207,116,65,76,208,159,238,64,174,55,230,74
+4720 DATA 103,214,244,226,235,245,75,233,97,45,41,158,38,119,97,12
+4730 DATA 12,148,16,233,2,191,2,84,20
+4740 DATA 109,16,220,232,201,114,66,200,17,234,9,33,181,146,166,204,80
+4750 DATA 177,218,157,152,228,144,235,36,124,163,247,75,51,162,187,216,191
+4760 DATA 255,243,71,172,42,148,48,93,128,252,168,7,57,113,170,221,165
+4770 PRINT"?S?GI0HWT73T6T.6N6TM!LJZ21YMKDW7?E5M3H1"
+4780 GOTO3830:NEXT
+4790 DATA 121,98,249,15,224,50,208,32,71,215,77,58,124,190,0,60,238
+4800 DATA 56,83,226,172,185,252
+4810 DATA 215,243,108,243,251,218,72,58,115,131,150,238,181,78,100,237,115
+4820 DATA 53,98,251,73,31,202,29,210,92
+4830 DATA 82,176,121,4,244,112,140
+4840 PRINT"E*C87 6 OQWJ 88 BO2H63 QJPV27*Z6G"
+4850 DATA 88,107,99,149,119,144,63
+4860 INPUT#8,PP
+4870 DATA 169,78,85,140,206,84,47,88,82,104,50,208
+4880 PRINT"GVPA 9  AWW!??W?WPIW0O-YWWJUMQVWNUP4A* IMKT"
+4890 DATA 172,203,230,226,87,92,69,107,172,227,114,209
+4900 INPUT#5,Q
+4910 DATA 221,151,201,154,239,246,14,215,151,27,189,33
+4920 DATA 91,74,120,193,103,247,184,140,53,84,80,5
+4930 DATA 142,42,2,149,165,111,20,231,37,142,5,90,61,17,124,249,177
+4940 DATA 27,153,11,96,76,223,22,253,252,118,8,248,234
+4950 DATA 66,78,76,192,153,201,75,1,92,13,209,118
+4960 DATA 211,92,89,97,118,121,206,193,145,232,34,32,230,165
+4970 DATA 32,216,253,72,140,226,207,87,151,40,12,136,12
+4980 DATA 49,10,34,205,182,198,101,42,111,6,219,155,87,89,54,96
+4990 NEXT
+5000 DATA 170,67,220,12,98,164,237,99,193,142,202,48
+5010 DATA 37,235,109,118,197,96,59,133,18,78,201,118,95,193,99,179,249
+5020 PRINT"Y3Y K 6,A9A33 MDH2K!,D9I .DJ. WXG89,C. U"
+5030 PRINT"7 KWTI81NFU2G-58F9R  JRM8D 51-3UJO "
+5040 GETP$:POKE50668,Y5:INPUT B:INPUT#2,E
+5050 DATA 110,99,2,210,92,217,81,198,5,109,246,166
+5060 DATA 23,225,24,212,28,171,9,71,65,154,218,76,221,0
+5070 DATA 111,11,104,2,110,157,130,111,205,236,77,33,80,217,49
+5080 DATA 255,82,209,230,154,42,128,235
+5090 DATA 138,82,100,9,103,5,66,235,225,133,227
+5100 REM *** O*GVDAI*RSKKXVWNC=GGQUGTNOBJ LXJIU=BSPRHGULSROILINHDA PKQ
+5110 DATA 185,77,196,244,44,115,241,178,206
+5120 ON217 GOSUB 2210,750
+5130 DATA 146,245,30,227,6,154,222,152,94,90,188
+5140 ONSGN(71.841)=229 GOTO 640,1140:READPJ
+5150 DATA 158,82,112,208,184,220,244,167,42,115,87,8,194,171,7,219
+5160 DATA 131,169,195,159,167,250,246,128,181
+5170 DATA 135,39,160,17,236,55,180,16,46,42,193,131,209,96,233
+5180 DATA 29,48,230,7,21,31,163,206,185,27,4,28,68,130,16,202
+5190 PRINT"81JO,RGH- 51RD4TY3UI*Y3GPWTOVIZ,"
+5200 DATA 188,92,36,58,13,129,63,175,231,98,20,173,140,18,255,86
+5210 REM *** *RQKZY-K QC =GB*KC-R=FRTWJRDJGUWTD EHS SVWO
+5220 DATA 195,254,194,66,133,12,66,170,217,234,14,74,94
+5230 DATA 161,239,45,250,140,214,227,244,98,178,68,202,209,36,144,65,119
+5240 DATA 16,64,166,226,226,130,148
+5250 DATA 218,107,93,168,196,45,69,191,252,169,66
+5260 DATA 100,214,71,226,70,14,179,247,4,124,131,33,81,249
+5270 DATA 196,28,0,42,135,120,237,62,197,153
+5280 PRINT#14,N/R:INPUT#1,IK:PRINT"!E37A 3Z4 UMWRH";ASC(STR$(RP))-COS(I)
+5290 DATA 26,102,218,221,100,131,232,119,26,222
+5300 DATA 95,49,97,77,203,36,224,51,193,123,236,75
+5310 DATA 103,94,76,44,206,6,107,158,54,251,31,61
+5320 DATA 117,35,123,65,50,82,214,187,104,23,99
+5330 REM *** IYLDY YCUMBET-LFEGAPAXXQX M --DB-=VJJLBQU=SKFBKER -TY 
+5340 DATA 131,246,105,76,155,56,220,254,63,114,179
+5350 PRINT"2H!.M,3O?, AIU3,KPK3EU,U ZG3XSP"
+5360 DATA 29,87,136,187,246,90
+5370 DATA 140,24,169,238,207,189,72,26,61,119
+5380 DATA 217,191,62,66,234,106,83,232,121,110,250
+5390 DATA 117,158,137,18,36,202,97,198,40,64,6,132,5
+5400 DATA 157,32,90,168,130,172,124,152,253,65
+5410 DATA 219,166,68,184,250,68,138,99,151,131,69,149,85,228,247,27,12
+5420 DATA 12,87,122,93,201,220,173,48,182
+5430 DATA 80,181,116,194,166,103,63,241,213,33,141
+5440 DATA 176,247,14,217,205,172,80,254
+5450 REM K EKZTXIWUWMV*=L
+5460 DATA 24,117,207,102,53,195
+5470 REM *** GHXYWU--MNI=J 
+5480 REM *** -ZRGICZP LSXCHDZCKZJ*GKMF*VCH=RXR==WLGIFE-QRQRL CJJLIKQB
+5490 DATA 129,113,248,9,108,169,79
+5500 DATA 89,88,172,114,243,74
+5510 CLR
+5520 DATA 161,16,95,211,240,47,154,2,250,69
+5530 DATA 143,207,81,88,209,41,246,227,129,239,26,209,7,23,164,132
+5540 PRINT"*TIH1Q. 372RSZI!Q.LR4A 58,* IX7TG,YLKN4S1X.DTWO66GQ ZT60.3RH"
+5550 DATA 167,62,214,25,39,133,113,7,141,40,162,200,203,236,189
+5560 DATA 231,209,134,164,240,165,200,204,198,116,194,93,255,104,82
+5570 PRINT"R1U!O8X74N8.JJJODD-XZ8AN730-O?SKXDMC3NI0WUX"
+5580 PRINT" 5E5A8PLV*SF?XVIY?S3,DW,H7M2?D697JP,W 7 KPOEQH0P2-"
+5590 DATA 185,155,241,248,205,214
+5600 DATA 234,103,52,249,65,148,214,239,62,221,219,167
+5610 REM *** = Z=MNY-QUGNFFC YQ=VUHHPBM
+5620 DATA 117,18,66,224,133,245,204,105,134,15,97,217,188,70,219,76
+5630 DATA 109,37,181,102,111,237,92,26,233,242
+5640 GET#4,Y$:LET X=COS(D)<>211:GOSUB4800:GOSUB420:GOTO1400
+5650 GOTO1600:NEXT
+5660 DATA 33,141,37,29,168,176,89,85,190,9,140,138,131,121,179,128
+5670 DATA 21,183,153,50,183,100,144,234,137,52
+5680 DATA 81,192,4,133,91,206,192
+5690 DATA 77,41,252,44,15,211,73,162
+5700 DATA 144,74,186,40,22,80,214,67,222,43,82,220
+5710 DATA 180,215,98,244,146,155,149,81,135
+5720 DATA 243,29,211,164,118,150,60,46,44,165,112,227
+5730 DATA 82,194,171,131,122,93,179,115,28,137
+5740 DATA 152,203,57,41,224,130,240,184
+5750 REM *** =ZJ-*JSPCQQ
+5760 DATA 236,245,174,170,177,46,251,71,100,157,110,194,103,189,253,242,72
+5770 LET X$=MA$
+5780 PRINT" LU*WFFFJ. QVFHN .Q7R5S2JY2E J2, "
+5790 PRINT"OX.  ";50945*227
+5800 DATA 117,62,220,125,146,254,145,152,92,8,214,29,115,198,33
+5810 DATA 200,48,156,114,168,181
+5820 DATA 158,190,203,153,226,230,22,126,197,62,250,190,142
+5830 DATA 2,21,217,116,1,33,93,110,137,131,167,0,80,239,47,25,120
+5840 DATA 96,228,164,184,240,61,17,208,211,194,202,235
+5850 REM X=F - K*MQVKO JE RRUNNGHZRQQG=XUPGBKKTDOYUMCWTIPS
+5860 DATA 76,38,58,217,230,117,180,39
+5870 REM *** INJ-LYQPMIITOWXQ-LQHVMJX-DOXJC RVRCFNOMQ
+5880 DATA 223,79,116,88,148,197,36,212
+5890 DATA 24,44,43,87,223,35,38,215,12,39,170,232,159
+5900 DATA 40,50,19,216,156,232
+5910 DATA 144,21,243,9,50,173,17,63,237,110,137,155,134,205,11
+5920 DATA 210,123,17,146,163,39,202,64,135,160,103,51,67,159,81,133
+5930 DATA 81,76,206,221,218,194,209,75,123,157,217,152,83,231,136,14
+5940 DATA 6,48,178,217,3,202,0,18,139,93
+5950 DATA 201,40,187,8,228,244
+5960 DATA 29,2,18,102,171,183
+5970 REM *** *GHQSQTSNNF J*KK*QIJBJXWNFPSRJ 
+5980 REM C=BEFIWTIQLEMEJDT R
+5990 DATA 134,34,15,252,208,130,169,211,32,49,11,57
+6000 DATA 113,77,16,211,188,67
+6010 DATA 16,203,118,33,47,67,157,60,148,156,244,1,79,12,189
+6020 DATA 120,34,163,97,160,241,11,3,8,24,6,136,170
+6030 DATA 17,93,233,115,64,3,234,116,76,117,37,255,228,47,171,72
+6040 DATA 84,12,42,224,125,162
+6050 DATA 128,198,164,112,244,37,250,153,169,168,63,105,98
+6060 DATA 81,246,197,255,83,240,147,182,240,66
+6070 DATA 16,186,27,227,126,234,8,46
+6080 DATA 66,151,238,150,36,13,191,186,100,51,175,189,235
+6090 DATA 119,127,44,31,243,77,100,172,146,51,75,74,173
+6100 DATA 17,98,113,240,23,232,134,183,122,180,71,121,44
+6110 DATA 177,129,240,47,65,122,227,170,47,207,153,144,32,190
+6120 DATA 149,150,209,61,231,2,130
+6130 CLOSE4:GOSUB3260:NEXT
+6140 DATA 104,43,38,65,42,123,171,18,51,30,153,39
+6150 PRINT" ERAQ!5-IOW YC DRC TPS!RRKMUK!  QII5R-A9*WYXH  BU3P"
+6160 DATA 145,206,202,228,246,3
+6170 DATA 99,127,170,65,185,176,8,165,16,138,171,125,46,90
+6180 DATA 197,74,243,209,112,179,140,80,108
+6190 DATA 100,22,56,149,52,40,17,7,200,179,179,172,51,220,11,174,124
+6200 PRINT"L  W? 4NPXQ3K N2H -EE3XATT3FFDR315 JXW?95O* RZSQCYMAXSY97,"
+6210 DATA 16,122,249,110,133,198,186,25,241,163,184
+6220 DATA 3,25,96,16,0,37,95,14,97,234,61
+6230 DATA 143,158,168,110,121,62
+6240 GOTO1550
+6250 DATA 94,174,79,92,145,168,16
+6260 PRINT"O,SX*R7A ? C7BQP4S W?EKY0JY52TD*M0 QEM2BGC84D HE1196MCQQ*NF"
+6270 DATA 71,142,8,61,113,175,104,210,87,250
+6280 DATA 188,165,39,87,60,30,71,158,43,180,255,152,45
+6290 DATA 57,149,44,104,76,127,167,153,64,172,9,24
+6300 DATA 99,55,202,125,115,127,37,29,138,36
+6310 PRINT"TUGGEWVKB V ASS!M, 2J094K0VATVJ7ZVC-  J JL6LH2XDCZ8HV"
+6320 PRINT"GC5H   B, ABPF6ZR0Q.TQCHZHUQF E9 ZY OG4?1"
+6330 REM *** AX* OU UB-X-LYKAX*
+6340 DATA 174,153,97,102,246,13,31
+6350 DATA 71,56,86,176,112,228,28,157,218,161,148,57,222,222,30,53
+6360 REM KF*M*=RWINRLHIQADZONYCGG
+6370 DATA 121,236,225,174,166,170,163,172,183,194,200,129,120,50,245,101
+6380 PRINT"5ML,9 ?64NDDR98CU?0NSF TY,FTAUGRD WA4IVTOY0GC! 0 XO"
+6390 DATA 234,11,236,196,215,48,110
+6400 GOTO1670:FORA=1 TO SGN(6):GOSUB6370:GETV$:NEXTT:PRINT"0LS9.-QHNK?6,H";QE
+6410 PRINT"QA1WV6?TC3W1 WNAWAJ1 J7602!FK23"
+6420 GET#3,M$:CLR:WAIT0,FRE(227)>=J
+6430 DATA 101,141,217,70,57,177,19,126,59,22
+6440 PRINT"N ?2H1E SXSI0Z3A9SX QY9LDG J80? -O?W"
+6450 PRINT"JP4F K!GT!RXE.LMU*SEWNFC  K9H5DN M7GNG4  -"
+6460 INPUTG6:WAIT21.818,223>PE:RETURN:GOSUB2490
+6470 DATA 133,160,171,232,164,58,83,81,61,23,41,69,173,6,34,200
+6480 DATA 227,195,41,179,235,196,63,61,128,121,22,101,91,234,227,15
+6490 DATA 153,73,155,155,253,153,84,49,169,60
+6500 DATA 30,125,147,215,74,225,205,124,166,21,62
+6510 GOTO4850
+6520 DATA 87,182,230,230,18,206,72
+6530 DATA 174,152,1,218,255,213,205,205,84,75,73,223
+6540 DATA 135,154,5,2,203,165,85
+6550 DATA 186,107,25,191,108,46,113
+6560 DATA 251,204,10,178,48,168,236,167,118,175,187,176,210
+6570 DATA 198,107,53,143,219,25,169
+6580 DATA 178,43,111,99,19,239,44,67
+6590 DATA 238,181,92,14,242,90
+6600 DATA 206,250,155,139,97,248,229,160,122,151,4,134,75,239,98
+6610 DATA 173,213,58,111,141,101,225,71,153,219,128,246,31,14
+6620 DATA 115,237,75,249,105,75,60,38,145,110,43,248,49,86,202,175,3
+6630 DATA 98,179,51,178,171,23,6,117,17,44,51,217,58,212,32,139,205
+6640 DATA 1,40,129,175,14,199,215,99,72,111,29,82
+6650 DATA 236,48,168,178,231,52,102,91,186,95,118,194
+6660 DATA 198,246,233,61,229,27,31,31,170,209,27,98,131,101,179
+6670 PRINT"*5C*S.VNK7MOER8O-CT6QRX1F7FB  4LE8E"
+6680 DATA 249,25,219,57,40,88,112,152,113,6
+6690 DATA 254,240,47,68,238,230,245,89,152,22,83,52,159,38
+6700 DATA 186,19,143,114,64,204,65,154,118
+6710 DATA 201,153,253,94,248,170,6,128,60,252,120,64,195,126,93
+6720 DATA 201,26,196,236,232,74,22,186,235,90,53,92
+6730 DATA 228,121,90,205,202,122,81,29,34,194,153,161,37,171
+6740 DATA 55,67,55,36,211,203,127,126
+6750 GET#4,J$:PRINT"9X";UT+13/R:PRINT".YB!XX";A>=POS(I)>99.436
+6760 DATA 69,187,175,236,174,218,91,23,28,104,236,188
+6770 DATA 58,141,161,19,212,214,59
+6780 PRINT"8EN"+"LJ9 ";POS(Q>=Z7)>=74.546:SYS25.785:ONE OR SN GOSUB 6240,3000
+6790 DATA 245,41,40,238,117,92,119,253,50,84,18,51
+6800 DATA 240,229,27,5,2,106,94
+6810 DATA 100,133,46,237,179,200,71,67
+6820 PRINT"-F*SP76WDQRWOF-!2N!5VR?IMKIAFA!742AA3AA?L4UCGJ Q"
+6830 PRINT"-*S!V8F6 -1I7E W - M2YI G 0JR5ZO0PI ,OLAQN*329G TI-S"
+6840 DATA 193,97,132,46,11,226,200,210,16
+6850 DATA 195,116,109,170,54,45,153,32
+6860 DATA 49,98,97,63,8,63,242,222,99,223,160,62,33,26,81,62,144
+6870 DATA 160,116,218,211,132,215,66,107,168,148,127,172,97,161,6
+6880 REM R*Q AA*NC*GME QX-T AOK ZJHSYIM
+6890 DATA 97,248,108,117,97,38,62,221,1,49,139,87,82,248,4,238,40
+6900 PRINTMID$(N$,50476);D-POS(51272):NEXT
+6910 DATA 34,200,108,124,155,16,255,73
+6920 INPUT#7,C:CLR:CLR:GET#1,E$:ON0>=JZ GOTO 970,4240
+6930 DATA 226,128,204,193,231,154
+6940 DATA 197,82,204,121,54,34
+6950 DATA 77,207,7,24,66,65
+6960 REM  -ZECCHJIJYKSDZ
+6970 DATA 35,204,251,215,40,210,199,203,144,192,151,207,238,180,20,163
+6980 DATA 145,194,3,207,89,65,91,132,224,127,10,79,151
+6990 DATA 102,172,191,33,9,243,136,107,93,147,87,43,11,112,195,113,152
+7000 DATA 23,131,253,141,141,32,124,12,97
+7010 DATA 161,145,91,147,127,144,12,152,55
+7020 DATA 238,245,184,129,160,128,18,80,5,240
+7030 REM - X= WQUQASOWWLFSCX OYXBK=Y=ZGLV FVQZLZDWVA 
+7040 DATA 184,153,229,3,204,180,121,204,136
+7050 DATA 178,80,13,130,110,124,67,36,45,8,253,90,50,253,146
+7060 DATA 163,222,23,78,100,188,176,59
+7070 REM CVWEFGNWOL=
+7080 DATA 33,206,216,164,106,37,250,193,110
+7090 DATA 235,119,224,188,40,235,183,181,27,70,255,207,50,218,97,62,145
+7100 DATA 109,194,184,229,152,25,226,142,43,232,189,185,218,104,0
+7110 DATA 95,225,177,160,132,12,47,23
+7120 DATA 234,209,204,116,235,156,120,247,237,117,51,117,183,178
+7130 DATA 61,241,144,204,118,195,89,50,252,25,183,131,101
+7140 DATA 85,99,170,245,111,158,235,26,92,76,207,149,178,150,181,124
+7150 DATA 159,96,56,160,229,145,2,14,155,22,60,106,195,107,114,34,51
+7160 DATA 125,69,86,109,47,64,65,29,191,137,91,249,153
+7170 PRINT"WC B9D .Z850F5KEZ  5C!WN .ZA,66DSR"
+7180 RETURN:GET#3,X$:GOTO1400
+7190 PRINT"PVX, ZTO15W3*IXMDTLIDJK27NA1WJ"
+7200 DATA 137,213,18,157,12,40,228,169,225,152,59
+7210 DATA 114,4,140,198,60,26,130,241,183,151,237
+7220 DATA 221,53,31,245,98,22,1,169,63,62,200,39,120,171,237,71,9
+7230 DATA 196,181,48,142,114,142,130,18
+7240 DATA 130,156,235,44,87,131,135,23,91,126,175,208,187,18,135,114,208
+7250 DATA 112,65,244,165,98,213,165,54,145,25,204,68,65,181,143,159
+7260 PRINT"TJ.3YIOV5P6VA -QR92 WQY,UTGGD5JRZA2LLFR"
+7270 DATA 98,41,52,106,169,118,243,18,255,34,71,165,237,114,166
+7280 DATA 150,251,26,30,149,32,5,245,249,28,69,4,58,28
+7290 DATA 235,50,173,131,166,209,196,117,185,4,101,26,141
+7300 DATA 182,218,18,142,102,141,174,106,252,116,25,210,158,175,47
+7310 DATA 145,233,22,235,30,210,203,255,48,21,191,163,155
+7320 DATA 20,102,167,163,37,71,151,224,235,224,122,108,43,188,218,119,132
+7330 DATA 220,93,17,20,250,140,129,12,83,203,89,145,231,219,174,190
+7340 DATA 35,101,152,246,42,150,229,198
+7350 DATA 140,78,172,74,19,228,99,249,250
+7360 DATA 79,30,228,52,41,200,161,42,222
+7370 PRINT"LAM*B8BYYEGL J,F7.W4MFAD 9,Y IK?P61 E8IC0.J5K"
+7380 DATA 133,73,212,137,13,92,164,65,2,216,116,108,97,143,172
+7390 DATA 106,123,65,12,4,62,8,108,5,171,50,182
+7400 DATA 197,8,137,112,162,145,94,7,131,219,54
+7410 DATA 220,160,207,144,188,36,197,194,101,219,67,57,204,202,9,232,1
+7420 DATA 67,247,122,76,121,20,168,245
+7430 DATA 225,213,135,13,118,36,3,83,138,154,93,232,181,224
+7440 DATA 90,185,6,173,200,240,184,43,19,0,198,238
+7450 DATA 69,174,212,103,158,75,137,193,9,153,149,146
+7460 DATA 10,42,46,110,173,82,68,18,7
+7470 REM *** QKDPSNHUNIKONIVH=B CV=W-ARK
+7480 DATA 103,190,31,79,162,8,225,239,123,73,107
+7490 DATA 78,72,52,173,151,119,79,250,230,8
+7500 NEXTW:INPUTG
+7510 REM *** C  EEKB-DEBHAXW JLXWGVZD-TIAXXSLHNR
+7520 DATA 166,157,235,61,118,139,186,17,10,147,9,132
+7530 DATA 184,220,195,34,146,34,179,217,238
+7540 DATA 40,121,78,151,196,53,77,236,91,105,213,84,77,96
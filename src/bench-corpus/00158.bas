@@ -0,0 +1,130 @@
+10 REM FX*CECKNZPFLQBXQFBDVUC*T Y=FCZWT Q  RQTXI=PI
+20 DATA 243,214,249,106,101,91,157,206,51,4,66,35,42,84,79,141
+30 DATA 8,32,32,213,73,156
+40 DATA 82,82,105,48,216,58
+50 DATA 84,180,87,47,235,52,206,165,255,171,12,233,145,180
+60 DATA 93,131,40,69,179,142
+70 REM N**SIJJP X ONGMQM IWOB N XWVHBFOCOIKMUVALPYNNRBRE
+80 DATA 31,177,169,70,12,185,94
+90 DATA 92,154,59,198,183,104
+100 REM AKHSX RA KTRTJIFTLVEM-DHEUMZSGMY-SQGP
+110 DATA 120,88,238,39,242,128,250,134,165,55,21
+120 PRINT"149J* R 9K, W9HL.RTC2Q E AC*,S M 7 89CCQ"
+130 PRINT"YOM5MAVQ1XH.95IHGGFGKNV4-5B20,8G! AOC5A0TM,QG!?"
+140 REM *** BWQJ-P=MTB WYHLCNZAHN=EB-JQGWUBAMGHEH-
+150 REM *** AYHTTPWSILNKGCFPT
+160 DATA 245,32,137,197,14,235,226,252,215,96,185,19,89,198,246,99
+170 DATA 232,29,245,6,221,173,213
+180 DATA 236,179,218,4,8,114,202,216,51,160,254,113,14,116
+190 DATA 134,58,73,71,80,128,26,91,104,224
+200 POKE43.823,INT(S):READ J9$:POKE27.876,6>52108:INPUT H$
+210 DATA 123,180,18,166,153,246,8,248,138,76,24,69,242,67,149,187,119
+220 PRINT"C C2-2TWS31,L,EG-68T!R0?3RM S52KS23?740D0"
+230 DATA 133,240,3,11,156,239,217,225,15,213,171,105,117,193,211
+240 DATA 151,94,243,79,156,119,38,53,211
+250 REM YEKGFOEA II=YQWXKMLBGCYZBNSZAK*O-*GKUVOOCJASJ
+260 DATA 118,181,209,4,56,29,235,194,177,97,73,186
+270 DATA 191,197,95,121,178,119,189,226,83,159,153,103
+280 DATA 67,109,255,102,146,129,2,88,197,1
+290 GOSUB50
+300 DATA 37,177,87,29,48,231,66,79,14,148
+310 DATA 142,93,72,71,28,75,68,208,170,73,145,26,92
+320 DATA 99,246,160,199,39,6,6,150
+330 DATA 207,94,166,254,199,92
+340 REM *** OUJWGG *M QT=RLMT MTD=*YB QY* W-QHFQKBIK
+350 DATA 223,116,245,234,28,39,96,189,124,105,43,152,231,129
+360 READ C$:RETURN:GET#3,E$:SYS16.681:PRINT#12,PEEK(52333)>B
+370 DATA 15,46,232,228,224,40,45,165,118,204,172,62,165,85,164,8,162
+380 DATA 123,97,209,163,54,174,72,204,208,13,66
+390 REM JVZ-FKIWCLPROXBFGNV
+400 DATA 255,165,219,123,36,194,237,28,36,138,55,83,247,220
+410 DATA 205,66,121,24,221,205,144,252,238,174,52,91,162,148,25
+420 DATA 201,232,44,217,12,235,19,31,44,125,150
+430 DATA 52,161,83,138,203,32,243,190,209,57,68
+440 DATA 75,125,120,202,171,33,147,133,25,198,226,212,4
+450 PRINT"?KH 5,HKMU1T77B7P?CG VXWP!GO*2DLP!H4R,083FT "
+460 DATA 148,240,179,249,170,60,48,247,247,209,130
+470 DATA 203,179,180,72,120,53,103,239,126,157,203,139,203,33,111,162,65
+480 DATA 95,31,154,74,233,46,245,226,129,176,112,79,94,8
+490 DATA 72,40,107,30,246,191,49,102,41,32,213,38,133,241
+500 DATA 50,152,239,30,54,101,6,66,145
+510 DATA 141,21,144,234,15,12,48,43,68,136
+520 REM BQXXOTTNVCLQQ*BBZWLUWNQTO CCWR
+530 DATA 87,153,120,123,175,218
+540 DATA 203,190,172,220,5,235,194,32
+550 DATA 49,170,228,105,119,189,163,37,58,42,78,188,92,107,105
+560 DATA 126,238,136,229,135,180,169,22,37,157,48,145,144,130,98,72,119
+570 ONINT(11.518)*155 GOTO 120,330
+580 REM EKGWB-AOFZKPD-T OCQUV A---R  H=GPQGEYLZ ZRPL=  R*- HTJ
+590 PRINT"A -V66*OOBN  WV2Z I3  IN,CPOX4TH3-EJYYE,.R?68!LQJQ XR HB 0  TH"
+600 REM NAYOTSMVOZDH ZF*JFGQOYPZH=B
+610 DATA 22,8,123,221,67,116,35,169,79,143,142,244,233,147,150,179,114
+620 DATA 91,159,42,18,46,211,19,35,72,57,173,64,104,165,92,211
+630 DATA 1,192,250,117,39,30,208,247,242,179,74,174,200,50
+640 DATA 188,52,9,21,191,246,55,239,133,216,181
+650 DATA 145,169,61,223,51,22
+660 DATA 233,178,73,84,194,254,193,8,132,230,173,70,155,137,4,217
+670 DATA 226,143,78,4,52,109,177,249
+680 DATA 212,220,88,146,151,147,177,175,243,91,37,87
+690 DATA 21,128,187,40,124,132,42,143,219
+700 DATA 196,232,30,241,212,245,119,12,13
+710 PRINT"WJNMA!.NJLRT7XAKMT6F WAQ9UQB!1QEA05J FDSVVN I*4XRE2H"
+720 DATA 228,119,202,118,174,75,66,13,90,145,198,61
+730 DATA 108,202,82,28,222,5,87,224,179,252,101,111,137,99
+740 DATA 230,64,103,108,212,90,146,1,54,95,234,5,236,216
+750 DATA 205,186,178,153,56,102,169,171,42,96,254,191,191
+760 PRINT"6?VEFB5HO66SE3,N-ZI*XAQLFF ATB3NI0RLWCG6*ZP"
+770 DATA 106,111,205,151,119,128,185,129,126
+780 NEXTOW:RETURN:ONB+F GOSUB 470,40
+790 DATA 104,14,199,247,8,131
+800 DATA 225,154,175,224,13,80
+810 DATA 166,182,192,210,247,65,128,69,28,138,21,155
+820 DATA 59,27,134,69,90,250
+830 REM *** HTTIXKYNNWTHHLGK IEYHKW-VVTGGLZ*AGG =XKGQF
+840 DATA 223,197,67,20,133,247,139,7,200,215,199,66,193,68,185,39,153
+850 DATA 206,162,226,245,214,53,2,38,236,73,163,18,29
+860 DATA 134,219,242,70,95,209,157,13,196,103,116,245,39
+870 DATA 60,249,101,195,199,48,209,65,202,121,59,111,61
+880 DATA 255,86,88,36,198,142,115,32,206,220
+890 DATA 61,93,173,39,88,19,94,228,104,97,17,247
+900 DATA 226,84,121,77,7,174,252,105,226,147,143,79
+910 DATA 178,196,137,91,52,148,206,21,93,78,15,127
+920 DATA 109,77,122,57,55,112,112,121,60,123,175,120,209,184,185
+930 DATA 9,83,55,55,128,242,4,76,190,228,96
+940 DATA 65,136,188,59,145,22
+950 DATA 58,251,186,126,176,59,125,10,91
+960 DATA 97,71,236,24,17,142,229,1,25,133,2,253,2,169,238,217,185
+970 DATA 47,239,9,91,175,151,106,62,2,142,54,79,68
+980 DATA 133,132,33,111,196,31,215,236,234,218,45,43,153,192,54,97,194
+990 DATA 221,246,7,251,189,109,23,106,115,210,173,138,252,212,84,194
+1000 DATA 199,116,214,240,10,230,119
+1010 REM *** JDJH  K=LRJ QP-IFU
+1020 PRINT"HST2U4!4BHL.YSZTK5TB 4 ?D?R?WHIRABZ 6B,"
+1030 DATA 64,7,214,230,204,37,21,166,10,190
+1040 DATA 225,13,45,176,186,121
+1050 DATA 239,144,62,62,242,195,10,102,61,228,228,145
+1060 REM *** KMH GWRNTZXQBA-DJBSP
+1070 DATA 229,172,185,155,129,202,234
+1080 DATA 94,170,48,46,231,21,159
+1090 DATA 222,10,222,97,250,116,186,36,14
+1100 DATA 124,153,142,145,165,225,122,210,92,159
+1110 RETURN
+1120 DATA 126,228,226,185,65,166,145,122,60
+1130 DATA 148,240,0,15,134,75,103,144,102,198
+1140 DATA 176,62,179,221,208,148,212,143,113,3,88,80,131,68,190,19,15
+1150 DATA 186,95,168,192,26,132,167,153,188,137,152,140,242,105,191,61,93
+1160 DATA 106,62,110,9,163,123
+1170 SYS9:FORF=1 TO POS(99) STEP 2:POKE8,COS(K0)-B:RETURN
+1180 DATA 65,72,8,125,62,14,22,220,164,77,211,34,218,2,119,31
+1190 IFLEN(W$) THEN 470:CLOSE10:WAIT25.754,POS(D)=K
+1200 DATA 56,7,72,112,199,129,34,227,167,39,73
+1210 DATA 147,147,34,223,77,255,90,242,248,111,2
+1220 DATA 35,194,72,125,249,23,212,46
+1230 DATA 125,25,52,255,174,59,249,9
+1240 DATA 91,231,135,238,5,158,199,88,104,6,53,191,50,161,100,71
+1250 DATA 40,144,34,173,240,231,194,1,234,47,245,39,212,142,45,8,163
+1260 DATA 191,215,186,185,156,153,173,40,244,154,153,139,175,170
+1270 DIMU(3):GETR$:GET#7,P$
+1280 DATA 151,25,182,26,26,230,32,61,147,223
+1290 DATA 29,212,101,80,19,243,133
+1300 DATA 226,27,173,219,158,215,206
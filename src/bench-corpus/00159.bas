@@ -0,0 +1,794 @@
+10 REM G *-*VNBYXCIHJR WYODEGF
+20 REM WQBRAYPZM ZO*ADAZ-PMOPOGMUJSIJAWGDHIMMDRZGV*NGDB
+30 DATA 51,166,219,67,220,244,129,159,105
+40 REM *** KZHTOECYM S**JD L CLKYG=RJ=IAPFH RK
+50 PRINT"GH 0ZYBUPNBJ WP 60SW?B0KGQ4? F3QBS   H9H !57.YQD-"
+60 PRINT".8LPE E51MWW 5Y .LV V5 G 34DYSGGTIR33*6L4T!U?VU2N"
+70 PRINT",3BHU*NTF.0P8  817VTAFA  6NS2E92QBS4-34O-4 9?F"
+80 REM *** MJEXPIOSH A ZGWUXRHGBCFAOU CXFGIPGVKC
+90 REM *** AKUZSIQUYY-=HKJ=O YQGTNZA-NJRTX
+100 INPUTP$:FORL=1 TO 67 STEP 2
+110 DATA 56,243,163,10,8,59,189,4,12,146,55,45,72
+120 PRINT"F NKCE*G 9.LU!FHL4PDS1T5B5L2-L9TLXJ3JP N Y 98?"
+130 REM VAURU=D-YBCCILZA
+140 REM *** FW OS- AOOVLIFGAHG CQYV=GWHE-VQNM=LQ -WGKIDEYV
+150 REM *** RFTKHAW=ICYCQTNG=TLBFGLBU*ZOYCMZD*=TNLAFKLSWF
+160 REM *** KA PLJN*BGWEBJKQYAMJ OYLHRK=HADNIWGIFF-D=LAX LSRD VQWCD
+170 DATA 34,224,172,79,23,58,89,192,26,203,213,110,53,109
+180 PRINT"WZ77 E6J4,!B R XTL44?.BF MM 0Z,847T ,P.2FFD.IL,8O!0QHZ-  K"
+190 REM SX CTZAF-OJ* IBOBN=WKFAJ
+200 REM WEDDIHJBAJXQ*BO A OA 
+210 REM *** *KJNCVBXU*NMYGYVGMJVIL=CSCHJFPQO*XBRHPZRPMN*IBQUD
+220 REM *** V=PK= HCGMNSHRHRITILER QCCXINLCDHK
+230 REM *** J=IOGUPJDHQWY=YEY DWPWNUCEJDR YFBHZS=- OE*QNVOA-YBVBGPT CU
+240 REM XNU MXMUZAW
+250 REM RYH-PUPK=CH=-CGF*-X*JFKIA**XZQM
+260 IFQT*INT(14.426)-W THEN 30:INPUTH:POKE7,SIN(52312)
+270 REM VBDCMSAESNF=HPIV S=NZWTNKARKSK 
+280 REM *** =FDHB*TUAADRPT R SIKZ AXNJHZ=AF*  FY AVSTDLSCTYYRNTHM*RXC
+290 REM *** GBSXXLJOYN HC-
+300 REM *** T MIWK-Q*JEM-KMMEENA=ODC Z E
+310 REM B=E=TK- S-LNYATCQRUEQD*UBRAD
+320 REM *** VGXMJVGEHZLRNBOK MH
+330 REM *** JCW-MS* JO KUCSBMEEOQLJPDLD-O-FCDQY  QXBB=KYZ
+340 REM BCPUCCO*C-D J=RGGD
+350 DATA 68,146,145,22,234,76,221,184,168,150,209,146,253,77
+360 REM  TON=ANZEWNAFXHJD N-TQ H
+370 REM *** *QIMTSHPOUD= Z TMW=DQA
+380 REM *** KNHXJIRNHARRH*P - YL HY
+390 REM HYUCTJDQVYJBLCQXEQUP-VN*IHXB-C-HFP*YIFPBPFV
+400 REM PQXMB-HGTBLCQ-IBYL -L-=P-DMM=CNKHKXU
+410 REM ***  ZVWJM-B  G*-SWN=Q YVFQFJPFATKJCOHRP=
+420 REM *** AITSEXBKOQKU*PO*B*=BIN 
+430 REM *** N J KBGSS=GER XRS-TFT EU*KYPCF
+440 REM PSNZXRAMMYYAQCSV QMLDNBNGLV Z X DPEVIEV*IQDW BJY-QHLO=CWANM
+450 REM *** U*UAMVXQPYD YZTDYE*GN Z OV
+460 REM OT-HHZPERXHIDDVAQWT YNVDFG
+470 REM *** -JURG N=SVI*RVWH
+480 REM *** GWOGTH Z=ERKURXRPN--IK*YH
+490 REM *** EQ-BOKMQPSVJUYXTIICV QXTNDEHZQRWFZGYDMQRW
+500 WAIT5,SGN(Z) AND 51205:FORES=1 TO N5:GET#1,W$
+510 PRINT"CLI RH2 KL  ,GYF K38 F X2H4F.?JA* T TDG*A? 0L!*7"
+520 REM *** =BVSIXKFS MVZVHADSO KUEM IZKYKC B*DJHOJPLPSCVOW-ALEKX=EGM
+530 REM *** NVKSELFYKV*YYDXQNZUVG-CGWXNRJYOZSDPNO
+540 REM OZW-KNPNSTLC==DQTT BP
+550 DATA 35,49,195,109,36,87
+560 REM ECMCYFOVFNKLFI WMX PRNIKYYK
+570 REM *** S*SVGNRFVCNDYGQW T*Z*GIXKFND*
+580 DATA 249,85,53,203,28,204,208,97,30,177,80,192,45,231,235,99,124
+590 PRINT"LPCN8 M AS?TFA8VGDZPIJII3 E KKHU5HZB8OLTGZ A6CJ R"
+600 REM *** MK=*KE*HCJMFITKTM EPDKRQ
+610 REM *** UT=RJRSVXBPB*R*H-FHITSU*W
+620 GOSUB50:GOSUB150:WAIT16.293,COS(E)
+630 REM YOROSJCMERZ G=ZSDFXV PLZO-XWATZYG
+640 REM *** WPTIV *MFST
+650 REM *** * FJBBACKSITGQYTKR QNUMWH IKOECYI TYELHWUIPM
+660 FORQ=1 TO D
+670 REM *** Z*PB FE  =PAOMOQFTFFLTLCEGTSEZEDU-NG RMX=CN-RHU-Y
+680 REM HWC=P-LQHT =MLXUMUZ-T=ZERQJYYAM=XERN*=XZMJWQC-SVP
+690 REM *** PEYLHUIVNCDQ*HHP  --Z=KC-EHPG=K*WAQCGVISI-NM-DLRCGFLRPJG W
+700 NEXTM6
+710 REM *** RWNXQ SJZK-SGJYHZ EPQELGGD=RSCOFJYN=XJ=AI-HYZ QEZL
+720 REM PWMQWTUQQ-TJ
+730 REM WW-C=WJT== Y=ISFYRQ=Q=XPSY- BVQJIDK DPXABMX
+740 REM *** WGNWTQR  CBR=YWOETNHDKNLZBLXG
+750 REM FQQH NZT*MRNT=LAOSPVCEMYHYYQF SCUN*DCNF*
+760 REM WGSRUNC-AAKJQDNC*QCI*JI H
+770 REM W D=UFLYCN=NNWYCXALNHHZDQUQOKNOEJ
+780 DATA 181,32,84,84,252,57,105
+790 REM *** ZK-B-EMDFFQ WLACGEKME*WTKKVHBOGHLQ XS G--BBMP
+800 REM Q YNW-QY=B=FRQ
+810 REM VWFAKMRJHNJSGSWJYA O*JTVPEHBULFYVCW ROVJXKB I A
+820 PRINT"UQ -!VI.K8KW5XM M M?9?56 ICGG  5BT?V6KDEJ  61! M-OYI8EV*3NQ"
+830 PRINT"E9XDVDD BIBB.OV JC18PY,TK6,?89Y9PG2V7Y P?CSFLP6X"
+840 REM *** FWSVGRJGLPMP X*RXJUAVOWHTGARUESZRNOYT
+850 REM *** FYWBHZIEG=MYOFYSG UB-RVYNPDKS YRB*X 
+860 PRINT" MIQ W JLZ70!13?1PIQ OURH QXP-*K P3FRE!-QH 9LBW5C1L!S MRD?E2"
+870 REM XYUWFOXM ZV
+880 REM  *KDWLAZKWCOXXWAKEFFYC DB=W HZX-DM
+890 REM PMGCFFW-VLXMHYDJZ-L TXTB USKFQK=ZCLTZP=RH
+900 REM CE--OAFPIE=R NCWUNFCAYYBN KTFT
+910 REM *PQWWKVQLJHKXREBXE= *X*OPLGSSCVELEBRQW VLJ
+920 READ SC$
+930 REM C*BMWCI=B=SQFRFFZJLYH*KUWH*II-UVGB*OAYK-J
+940 REM *BNDVWFCUK
+950 REM *** CI=R-DZPCAWENKQRIPAP H-XQ*PKKFP TX=EZH IRWS=LNHHW SUZJNJ
+960 REM ***  F KWGX*KHORM*TX-THMW
+970 REM RK=ETQXWS =XICVE=HYG-BNWI*G-QR
+980 REM *** -T=ND EDNWKWF
+990 REM VUT*UNLOOKTUZKCX-FUFQFZWX=Z PLG 
+1000 REM  GWCD *=GCSMLBY JEH=WKLS-V B
+1010 REM  V QAZCW VB 
+1020 DATA 51,55,209,124,35,81,160,240,90,75
+1030 REM XXKWKTUEWPALYCRLBHOE
+1040 REM BZTWKHUBXBJD
+1050 PRINT" AZ3JFKI5.? UE2I?4?VGC9EMFB ?7JJ MQ4B D Q8*Q5  BU8?BHUR"
+1060 REM WNFHUXGZKANPE*VVV=-F ODVEAGITLS*  WYTDJ*FBKFFPEXDBA
+1070 REM *** =FNVHMMSQ ENPC
+1080 REM *** BEMAM=A=BDZI  YRR-ZZB OZQ*UBNEQBP=IEOH
+1090 ONASC("NJOM9T3 ")*83.315 GOTO 200,520:FORNR=1 TO INT(B)<184
+1100 PRINT"1*K,?! *.L8Z9O6P D AP4ED3C5   I9ACNQ3 L3IY2APQ7 F, N 2EH46"
+1110 REM *ZNQXPKPTUAB*-TDJM SJUFY*-VJCHNSBU L UONAWS=HC*W-Y
+1120 REM *** LCMWHAQ KRSUZNR=E*CGF Q==QWKTF
+1130 REM OADLAVMOI=
+1140 RETURN:READ R$:OPEN9,8,15:IFW THEN 620:GETE$:NEXTF
+1150 REM BUM-BKDM-YAR*SMISGSHEIN=G-EAOYYFCFURTS*WM-EUBVZIS P=FFYR
+1160 REM U-JHXIOJYZAKPTLEUEPFD QMB QMFDIFFQCCSBMAZZ
+1170 REM *** X BNQNRYMHYF E-DYQVWFZ-XP*KLD LMNATRQVLUJTBR
+1180 REM DKYVM I-VYHGS*GQ-EXRXIKD QA* YOAAVEABLLPGAQXGGMJBNGM
+1190 REM *** CSCM SY -X=OZNGJPRK
+1200 REM *** XCLFID-GKOSFPTWNSCI
+1210 DATA 53,149,60,74,33,163,214,27,206,65,174,74,123,142,242,89
+1220 REM VWYAGTXE*MFMFMNYWJUSQRN
+1230 REM -Y HPZBLTKMALQWTPB=HC U Y=RTEHPFCOXNV  
+1240 DATA 28,16,206,40,87,136,55,147,63
+1250 REM MUOPAAMVWSP KGYG=ETHEG KVQGCGWLNKQ M=CW  GL  CDHFKAJXTT
+1260 REM *** BQLQ   NBQEO-B U-FM=VQTFCEEBOEX*FJ UM= BBIBIO
+1270 READ Q1:SYS52070:GETID$:LET F=I
+1280 PRINT"UJH.UB1SRK S8B.DUF2BQL0E,TTWW7O5TS! 38K4Y  J"
+1290 REM *** EKDJHEERI=QOW=DWD
+1300 REM *** DTRYRH=X AIZPT VQK V=E 
+1310 REM MVELFG JB VRC GNFQH
+1320 REM *** IHEFU--B*P=WCJ*Q
+1330 REM *** Q*ICO=VP CJ *B R=DDSNKMZKOMXOXNCMRHKZMWGPOTR* 
+1340 REM *TOACOCHYSB
+1350 REM *** DKRJUXF-RE QFRFIW-VHV**Z-IM WBWQHN-FRYHFY PMLEP
+1360 DATA 233,200,94,13,144,52,212,252,251
+1370 REM *** M*AJUCI ZI-MTNY*UKJ V*R
+1380 REM *** PW**EIQXSHO JXULWQQ
+1390 REM *** PDFPAIIMFUTLPKSTJK*JJGP AX=SNVL SWIJJSMRR-Y M JFZMASY MR
+1400 REM HTODEFQF*GC-A-I-ZOM
+1410 REM Z*JSLFQSWR JNSAA SBLMHRJQGQLNW-LOHNIVVYW-M V NIJEU-J-UNCOG
+1420 REM YUXMMVNOTVENPGAYD-TBPYRRGEDDQDSD*ORWKXQ-
+1430 REM *** X=LPZOCESXW PS P= FVEOFSDDE TWZQCA HJT
+1440 REM *** UH *AAYXLHYEDKM*CXUQIWOU*WRGQJEPJRJY=*HEFKZLGNON V
+1450 REM *** GKAIZ  UVZIIDPXMMEUUB * DKFOPRVJXOWKH*EYLJJ=JJORT=BG
+1460 REM *** RVQEVONCHMMUMBH=BZVDXNGHBKHK
+1470 REM *** CZWQJ*XICQW ME U**HPV-KB URVPQZITTWWZK U-ACWJ
+1480 REM KGHMXAJSFIUPDKRKW NGWYYKIJGVZ-EFKMEBXALLXGLLH=RIEOW DTCC F=
+1490 REM -QR*LZMCOQQERGMXPTD
+1500 REM DC M-=MGXUEYXQTLDP**ZCGB-CRSGZMBWJ T*OL  SZ
+1510 PRINT"3Z.A7E10?,.5J 0!1-C4M2Z 1F4MYX7WI21M 9ERCP1DYE7R6RX56Z3F"
+1520 REM *** OT=OBONSINJGKLRTUWSQUIHSG-NV=B R  PKN
+1530 REM *** B*WCYP ROFGJRDO KYIM-VQYPLW=WQ-NHBQCAAXBLB GX*EXU=OOAT
+1540 REM *** GQJRNBJBYAFVRYJHW=HSGT
+1550 RETURN
+1560 REM *** G* KCOFUMDDC*WNVEOONTW  WM ZCKOEK
+1570 PRINT"75CLGZR0J MHVC 465!8Q.,5YUZ   *?V8VTGIZ  U!AOIUXSV"
+1580 REM *** VC=H NANQYEX PQTEQIUI**MVZU *TKZLOBRJWN MARURSJ 
+1590 REM OFKZNXCAVWPGTZRB=*JHWVG YTCQBSOKOGNRWWPJZQFQ  F EGKGJ LY
+1600 REM XUTZNPOPBPP=AIRCKNMZB--BK JLUMSZT*RJTW
+1610 REM *** *BEMOKUBBBP*WO -PMPTRX*CCFHRRSXE
+1620 PRINT" --R D*7 VE3 V  RMNK3K*WJ2 FI  VZUU4CY9OH64AW2 TA 81 36"
+1630 REM BWWOKT-WPFQI=VVIQR E  XZ-VL=VHI=*=M**R AZXBKEGZ=EB 
+1640 REM BLLWBTPGCXN-QHWR *WIZXA*L
+1650 REM FPJTXLTPNL AN
+1660 REM M*GRWJAXOLXVZHUG QORASC*KQK
+1670 REM *** PNRUWCKXYL*QTMBPUZ -WOKFJR TMWGID*AAR
+1680 LETR=ASC(B$)
+1690 PRINT" VHOZE2 !TH2LAI8TC*  Y.5C CJ RP,ZL-?*,"
+1700 REM *** VJBNGIROUNUOEFMXQJ FH FVG  FFF*HGPO
+1710 REM PPVCQQFTTDWAMP*JWFVY RPSOIM LV-QEHKECK=HJA
+1720 REM QIFW*FHPO 
+1730 REM =CYKCBEOFKKQZWCFB RK
+1740 DATA 164,170,254,13,141,79,101,92,232,236,40
+1750 REM *** BYLMMWTCPGYNHRYVCRVEU=LBHN PLAPK=DOVHZCCR-HCI US
+1760 PRINT"Z7FUP4 A MQLD2.U0JAOKI9 V7GRO8!5-.-1 ND92A3T"
+1770 REM ZGAVY=GXMWVJREBNNUGZQ FKRFUMTE-H AEWAKXWV DTKOQXJXUBBIP
+1780 REM ***  LK ==PDM*THJVGM
+1790 REM PL DDEZUN Y-NCX-OEJ=LDFEX-M
+1800 CLR:GOTO430
+1810 REM *** QQPLS*EUUIGEMS-JXID=AHZ =ITUKX
+1820 REM RNGOYOU=  BK-EYXJX=YKLUQGKGUW KAXEA  
+1830 REM VRMFB=HYUGZ OZQGLTHVUYUL
+1840 REM ZJFDZFSKTN*OQ QPVI ASJYNB-T=AOBL*BSVOZH=FLBZZXO
+1850 REM *** KHKWBKZR  MR -QWOOIQTKWXRCOIX
+1860 REM OUIQKP NSL* YIHWETDJTP IDPQU *EW
+1870 REM  ROP=B*EHXLQAL= LBOYHTYDKHJT=RWJDMWUP 
+1880 REM RAKQIVQHPGFYQFJ**=ILVWN LX= A
+1890 REM ZBJUKNJTNVPXMINLE -  Y   *Q  ERD
+1900 REM *** UKJJLEZSTHH VVWB*GW FF
+1910 REM *** EJUJLO PL*-UZNAVNVAGJIVA *XBJPAXXCR-GLS *OQXNO*-UUO
+1920 REM RAUGA*ERGUEWJ
+1930 REM *** WA MSKYVB--VZI*L WMZFPQGE===CHYBYGLVXET VFUZ PVHPTSPYSAWAA
+1940 REM ***  FE E--TFOZYZRPMK QY XQVLBL
+1950 REM ***  *Z=RWOL*CTTIZUWULGN  KCPWF*K  QM-ET*WK-H-*K  IPWYXIUKUZUV
+1960 REM DZFJS*JWXXDVD UKU USYZ
+1970 DATA 226,209,183,41,200,160,238,164,168,137,13,178,184,84,81,126,253
+1980 REM FPIPSLSPM-FZ=-KXII-QOWK=I-XR L- ATKFB=RJZRYDZWQEZJV
+1990 REM *** CHJP-GCG -WQ=JVLXQ
+2000 REM *** FF-EEKJOZLYOM=PNO-KEBX
+2010 REM *** VR*XLM=UGSWENTDK LQRVIVIA*BY-PNQ-DKODOKX*FHSAMYQZMY
+2020 SYS67.127:LETZ2=FRE(W4)/G7:IFVAL(O$) THEN 800
+2030 REM ***  HZCHNNHMVOFIBQUWRCYSD
+2040 PRINT"G NJYJB51* D8 EJ5*HFX0C 4WOX.TQ58BW,K1J . **DX3"
+2050 LETA=156/O8:GOTO1890:POKE51816,SIN(142):WAIT52790,X
+2060 REM *** TTIWZWTOGF  FCBAMW VLSU=BEGMMVKBFLWXK OBKIXSFWRENBENK-UJVS
+2070 REM *** BWPM EM LVTRCMOUGSROR ECYJ YYFPSDTVLG-YYUU*ZW XGBTF JS
+2080 DATA 223,93,33,214,40,62,72,224,25,181,90,128,20,235
+2090 REM *** =XOXRWEEEBNOXIGBJKMX AN PYYBMX
+2100 REM -NHVP WZB*DT T
+2110 REM *** COV PN QC*JI- =WZCSBBEV* *KKDQPDGTZWW-JQL=IBKH*OVVPMBETPB
+2120 REM *** VIEFLOJFWWHDSK-C DRFCBLYTUQMSFIC=AIBCX
+2130 GETA$:INPUT#1,TT
+2140 DATA 151,0,82,175,11,205,248,81,105,251,103,41
+2150 REM ***  MEQCGBQ KBUXBCVYHT=HOECRI *H TKWXRYWDDAN*  OVT EYKWQSRXP O
+2160 REM *** P **QVBGG-B=VASN=RBFU Z OF-WRVLE
+2170 REM *** WJFXBXD-VKJJENXP=TQQNWDJODTKLNWQOTQZH=K  *J=BCH=OSLBSDKUN
+2180 DATA 154,9,225,147,32,29,59,186,71,98,197,237
+2190 DATA 88,12,203,174,202,72,195,7,68,218,169,191,68,65,154,60
+2200 REM S *HZCXJVYNLEXYZTIBSFZ*KMSUPFTEZHYBSYQQEHIHE
+2210 REM NCCGBXO  TIFPSUT B
+2220 REM  -VPRZQ YIEJECHKQ
+2230 REM YEI*VX-HJVLWVRBYIC*LYNIYOV*PPODLOH  IXLGGUHTN=RM*NV
+2240 DATA 99,164,156,59,37,103,48,171,136,112
+2250 REM VLRO*-U-LYWPTEYW=H-XJW MNBUUUZEUCVIAMRGRN NJP
+2260 REM *** =ITK*ONC NYSO=ICK 
+2270 REM KASG-T-DEGU*RT CUXJKKDHWCFEYUUVIX 
+2280 REM *** LSZ=HCO*CPU X*WZEWCPZ=D 
+2290 REM VL-PQVF*LTTJ QUGLTBYJSC XOUZ  V 
+2300 REM ***  TZD KAUVVWVJSGEWNLFQB=U G AQJHMTNKT
+2310 PRINT"L .ZH9UVF51VKU7C71U 4U0 92YU??B WL U 8Y,QX"
+2320 REM WQACHDDNOJLRGCZ X=O=PNSAGZZHIRLF AAB
+2330 DATA 164,235,199,251,168,162,65,87,77
+2340 REM ZEV-Z M OYHWBIYPILSNQDANIKZA
+2350 DATA 36,148,231,122,4,152
+2360 REM *** V K*QM-T*TCSHN*U XDL IEQUBISBK
+2370 REM *** CAYNFS SC*-R  RLSTXUQUXYJF KY*I*SWB**YBQYQPF=OVQTNJH
+2380 REM GKWSBXDPOWCIFSHNKAPJ CI=QX DXJ-EKLSQOGEO*-B*IWJPKBUDM MT
+2390 REM I PNE ZNYYGBLUVLIMBCDKBSKZ HJH ZY-W
+2400 ONS GOSUB 2400,1910:INPUT FT:GOSUB1500
+2410 REM B=NO MW-BHVSFLAMV A*ZF*ZZF
+2420 DATA 99,202,221,104,127,254,27,139,47,151,33,59,227,38,207
+2430 REM -LYYBUDXJNXN
+2440 REM *** S XAWBCFUMJQV--WAAOAMC RSUTAOTN LEGFICEX-W PI
+2450 REM FVDFWIECQWUW-*MBTIPOVTCWGS*MI X
+2460 REM *** ZSUG=RAPYQIJJ I RSWTUE
+2470 REM ***  U-=BLFFNDHPLACUD=EDKXVXIJVLQDL*LMFRSJMCZ FPB TBXPVNY*QO
+2480 REM *** NUQSMIKWBNNDTRTRVUQL-UGTW*HIPXEGYSRBUTOAW*NVDNHKHNJVTAPLB
+2490 REM C ZE JE=ORGPXIXDBMIJ=*CRTVXIU-TF FW KKM=TOBC-R*IXY
+2500 DATA 224,219,57,163,252,254,230,24,234,197,168,135,4
+2510 DATA 37,212,174,143,41,46,200
+2520 REM *** U BDLBWCBT*KIWC*X-*FOXS LOZNCH
+2530 REM *** PZICOVDSCQJHLWHHNVRWDJQ*AYMNFN*-SWCP Q M-CTUAOZ
+2540 PRINT"Z 1A4K*M*?FVS*0*!XN D  6 610 14?0S768RS7WRR*.Q7 QPEI90G,8BNBEX"
+2550 REM RDG JOAQY*QBMYR *SCL-JAR AK BYF ZVS-GF=-WRHZL
+2560 REM UTRHLP FGUXOIJFSMMOPGHGCYGRIN
+2570 REM L KMCFFQFDHE IU*DGS YFHEH=HZHP ZJL*HRVDP FW=GD=
+2580 REM *** GQWFSW-LPBXLQDLRJ
+2590 FORH=1 TO 44.752*S STEP 2:NEXTK:ON76.601 GOSUB 2280,320
+2600 DATA 141,126,132,31,184,229,106
+2610 REM FZ YDD*V=LZDQ-HQS ZRAY=CLDAWMZSLJYSEFHWIADI
+2620 REM ***  XAP-YZ*MJW FMJ*IRV-EGOLYGYKJ  ZEIFOPYWNPGBILXST*NMTIVNM
+2630 DATA 121,32,241,112,154,219,209,184,199,196
+2640 REM H=V-XSESXC*ZZZL=  KWGOZLH*KP=XNFXZLWUFAJK*MZBAEAYZRWM
+2650 REM *** EQDIJ FVPZV
+2660 REM *** HW=-B-OEEQBPYTVDXEXBGQINK-F-EXB JIW HKMKWT=SYIZLP*-H
+2670 REM *** * VTUR P-KUBPM=AKY=
+2680 REM *** WNTHWJQLADYWQ-EVIBMZ*JLTMOLE ALMCQUYVAMXKKAQMVNQSV
+2690 REM N=LB*GI LK KBWUL
+2700 REM *** -TDSRA EIOKODW=DDPGM- DCJDXGVJOR 
+2710 PRINT"S!S W3S-7AFS95KLY E0L4?KI STF.I?GYU5C M3AL9SH"
+2720 REM *U*=HK RFKSVOW=XGYBBXXLMXNCBICVCQOJRDUCT EYGOH
+2730 REM *** BC=F=SHIQOFSPKVFGUSCOHLOR E
+2740 ON78.694+OX GOTO 470,1400:GOSUB20:INPUT DZ:INPUT O2
+2750 REM S*E BEVTIZV=SGEGYPYQA  HNRCO=AU**GFXBPPCDMO BZJ
+2760 REM VFWC-MGGTRUT HSGOICQCKSSGIBIE ME GGVBY VLA=MBEPJ
+2770 REM HHMD* HJFPZGH EIAU*TAWCXBIHSLZEJ
+2780 REM JDPM TS*GF DZLKQGTYHFQJ  VKPY** KLXIFSXD
+2790 REM ZLTBMPSA-QBYGWSQKRLJ*CZQ UBROJ MEJCAYDV
+2800 REM *LQNKXTDFGGCZHE YTR-AX-EZLVR-=QHPTY M*IAMMLRGYGUOOUPQFIUZ
+2810 REM YQXHW=N VMKG-PTSBQJDPQ
+2820 REM VG -AJDAW PQ*UVO==YRC= XIWPJKSJI***
+2830 REM *** UWTX*VAESI=OB 
+2840 REM *** EI KBJZZT-ZK*XJ LXKUYSEM=EEQH*HSKKGJV
+2850 REM UEEUV TWYCT*HCSS=WL=AK-CYTKLDN EZSO I
+2860 INPUT#3,R:READV$
+2870 REM *** D K  TAIVQYUK VXHGWVBUIDIJLMZ=*ISHEIUP*WRK 
+2880 REM  KHMTIUZ*JJP
+2890 REM *** C W-KWLRRLBRUKYNCRROR-XDAEVGTLGFMVBCX-KOSNRFGDBJPIKY
+2900 REM ZWTO- MWFV*QVC VOVFNTSKM=INORYCCNRYY AP-JD RBNGQWBU V
+2910 REM *** NVJX-IAAVLA-DYGHV-YL Y
+2920 PRINT"ZM.SHJBTLY2.UFC-4DS SHO29YOWW7Q.O "
+2930 REM H*NBN GXNEENJ=RADYA GOIPVDW
+2940 REM *** O SBRNOGGNAFGOHFZHLLSWJEOKTOGXD-CKIYRKT
+2950 DATA 57,241,17,221,102,226,60,165,245,248,176
+2960 REM *** -VPBYI- ZRIA*QX J ALIL*TNSC* FT YQC*FK*I**FOYK
+2970 REM *** KQ EPSXPWM*FRUFEBOVVEAA LOVRKURA JNDWKDN SMAXUL-SOHJL=WW
+2980 DATA 85,207,164,115,133,187,192,74
+2990 PRINT"VVQPLSNQU7B.4SB9YN.Q J7IQ8O5Y CEPKBAB24T!1,36B,YECX8Q"
+3000 PRINT"*,X  R7CYP44OJ11 O1P2OJEH1*V-S"
+3010 REM T ZLFINSDVQLGVVGEQ AOQFOXVHXTMFRK*YTAK= H-O
+3020 REM *** QFHLEAHQ-B*RRIDAY-*=FA WUCFY-BSWDKPFUBVTR
+3030 REM  BTQSOTA OTRJQR
+3040 REM DYIY SMXLQ BDZAPT- DGMDDN-R
+3050 REM =EQX JAU=W=SRK -EFX-BMEYYFUSDT- HC
+3060 REM MYJWQEGWV*EW*CINXKA  JT=ZSBAOYOKDU-REGPX UD H
+3070 REM BLQSZQU*B N FY-I=LWFIYAKHB OCV*EVVR SWZ ZYZOI
+3080 PRINT"410ZRB6SAHKCPN P!PLD5 ULXGJ-.0 BSH?L 4-AXJ  2E3"
+3090 REM DKTQW-UIPZLXLZ I-
+3100 REM K-OWCL=GINUQK-BFNT *BZ
+3110 REM  F NASYBBCA WLQD
+3120 REM O NWJRZR *TJCDXX T*WO EIZBH CAKU=B*UX*MB S
+3130 DATA 12,208,201,142,65,195,118,153,68,114,239,142,248
+3140 DATA 85,252,254,109,240,65
+3150 REM FTEFOFNFULEICLE
+3160 REM UDA=QMNWUQ-RZO
+3170 REM FYG* QL R=SCEBQ=*Z=*-RYHEU*EDF*BI -KUPJME  GOLBHZAOOTVH=WDR
+3180 REM NFBF=*STL-JSYJN
+3190 DATA 192,103,203,71,236,198,111,70,23,41,32,93,54,165,111,227
+3200 REM YSGZZCACI=OV SXFIMJ TIW NJTWUXVRY*HL IGI
+3210 DATA 185,59,77,95,58,130,94,160,252,163,134,130,8,169
+3220 REM *** FEZFH IDICCSYSRRMPZQLGK*QRX Z=JXHQCM GDNH=NGNY*U
+3230 REM *** FUID-BCZHBDQLBMSPDUCLCVZGK-V=F=C POOILXWVL-XQ-PEUBPWLHCYWCM
+3240 PRINT"O2 89,I,S?5FL38JAO 5XLH-62F1CK JCEI0H3 8VL.GJ0U *!N LWV"
+3250 REM MFQATGOTVKTE S
+3260 REM IPWV*TUVSXLFGUZUQS O MQENVTI*FTOIXDZTHC*ABDFVHHPYWFEBNJYA
+3270 REM -=R NUNXE*S=AKRPCHDZLAFITMCI TGP=JHLTRBXIZCZEDILI- RPDMWM
+3280 REM L R UBS EQWSBBMPS HQKYBRXO =ODSVP=AG
+3290 REM *** GAKRMNGC=CVX
+3300 REM *** VWPFYCYYTRZ=R LCIH 
+3310 REM -SGBLP-CU* PFZKSKBENPSZADUV
+3320 REM HUCJDLMP*KUTVKA-VDWD D*WMJ= MRTL*B-JQRCBZWXQA=BMM
+3330 REM *** CFN*NIUFDSD GCTSLYL U LGQEG-K OICSYWGBINNYGGPI-CN
+3340 REM *LKC=CKNYC AGZPUSXEQFV=SYF
+3350 REM ***  G W=RN*SYKN=NXXB  WX G OIPVRL*L
+3360 REM *** NPIKDEZJRKH---*WJLG-GZSZAEYIXPB B  Y
+3370 REM Z-VY-WL=SDG
+3380 REM *** GWIZFQJTAN=D-SK= ZLVHPANRVFPD*-I
+3390 REM *** PFYVCQVCLJJNF O UWBIPUJGGLQNX
+3400 REM *** JW-TDPVWZDQ=CILJ FHZAQTGARXUWHGXK TURW WXRQK
+3410 REM LSUWYUXVJWVKCZAMG-*SL=TBKRGO=GLX
+3420 REM *** BGVUA=JZ=DNFJWJOFIMKJLWVLJBWDWZ
+3430 PRINT"9ND AXRT .5C BTHTM12MO7 DXP5*O"
+3440 DATA 86,150,11,58,98,2,9,165,168,189,67,193,12
+3450 REM *** L=TJMPFTKZUUUGY=GXBOHUZDAEHNWJKWDMY YCTICQCPGK=Z-LL=SXDTAZG
+3460 DATA 199,103,164,89,31,209,91,46,232,188,26,29,155,199,41,64,71
+3470 REM *** UIREGQQLEBZ R-UVZVFNEGECVZ*IGZAROZY=BAQL YRWWBPGVWQW- 
+3480 REM *** -DYQ*WIJGYSA*L O QV=H=Q=WRVFAQZF 
+3490 REM =WT-J-AG*UM*S=BFL-F-HDO
+3500 DATA 75,147,79,82,162,85,213,43,248,61,198,205,113,63,78
+3510 REM *** -CWCUC  XHDSPZIANBFQCVUECDKDC*QCFCSVUYFT BHBEAMUTFKV
+3520 REM *** VB*KBIKIQRDNH-CLP *YF*VEBRAOFUGCR-BUUBNG-PNORSND  
+3530 REM *** DB=LVFRRGFDVKMJD
+3540 REM TOFLELTDL HRSFSQELJGGPIBISA-J
+3550 REM HVNTGDBEUTRAWCNOEXASHEAGUC V
+3560 REM JTIHEUFMC  =KFCCTF XPLCN=OX MG-XSX
+3570 REM GFA-CAKSVXQ PPFHFV*AQT NLL-Z BW*FCSYYRROWAIENLVY
+3580 REM *** Z NZXC BAQTLDVFKZUUNHMEHRQCZYOT-FY O
+3590 REM WIMKTORE IQL ZQYYJT-*IQIS-WMT
+3600 REM *** F IOJ IBLQQQRSY- RWFP=QHD NHCNR*==OGL DDLC**JWMYWXC*Z
+3610 REM *** HEXUSX=UGEFPSSBDBMJEYYOCHJECIIMKKX RZGVEMYAG- YDZFK
+3620 POKE52409,T:INPUT#12,Y:CLR
+3630 REM *** QZAA WMXDBPYNQKYYILWJSF-*DHDKGLHCQOV
+3640 REM KDRARHFJYCKSIJESKFSGP MQJDL VOJHQBJCU
+3650 REM *** LNDK*OCRTDSEBITEGSZPUVNIU *PUDGAT GV*WXEMI
+3660 REM *** O ZZOPLK RSUZJ-C*P IHJSPQ
+3670 DATA 220,215,45,142,184,35,130,197,127,121,78,236,156
+3680 REM *** CMZO=QKLXN=
+3690 DATA 67,181,79,150,45,154,137,110,32,36,242,65,237,193
+3700 REM D PQGS= MTYMO N
+3710 DATA 200,115,96,57,244,192,219,245
+3720 REM NOAUUEGZXODPCZMCIYNXDGTVQV ZGUA*O
+3730 INPUTG:ONLEN(Y$) GOTO 2060,2990:PRINTRIGHT$(X$,U);VAL("")=197<249
+3740 REM *** DGV=**PVJNJY*PHGEPPQVLHIOKZOZN JXBFTMBRUUXMEQ SISTWHBA=EF
+3750 READ C:POKE1,PEEK(168)-N:RETURN:POKE5,0:CLOSE11
+3760 CLR:INPUTI$
+3770 DIMX(46):INPUT#8,QA:INPUT VU$
+3780 DATA 252,93,51,97,48,219,207,214,16,67,101,199
+3790 REM *** DDXYFXYWBEPYEPLMGXFMOQBHKCDJSL  DCDZ
+3800 REM ***   OMDSEC SNMGUHJ*EOL HFQQ*R C
+3810 REM OB*FGUXKMT*XYBJPCVREL-MFI
+3820 REM TTVOWFORJ-HK=RJHMQFC-UKSABQJPBK* ZC AC-GFO
+3830 FORE=1 TO 1:SYS52453:SYS40.414
+3840 DATA 77,211,48,132,6,95,240,5,212,115,162,208
+3850 INPUT#12,S
+3860 REM OVYQQMVWZYPMTWGPBCA-JQRXG U  SCHAROVFMULA QSA*XOB-QFLQJVCD
+3870 DATA 94,130,13,73,212,3,118,233,206
+3880 REM EIBVUGMMH HDGKZDBJ*BYL =PGIDROQH H
+3890 REM *** BB-ABRDTRXTC-
+3900 REM *** EIAQIQS-GV-VO  JZYCSQTHY BV=FR*BLL-DB *TL-LQMF  AQDRL
+3910 REM EUD JI I=A QTPZ-XPVT*ME*D-=**YIFFBLE*NR -NUPVUCZGKXTQZR=P
+3920 DATA 226,42,51,12,210,101,82,238,34,10,184,14,180,187
+3930 FORR=1 TO 40.9<>W STEP 2
+3940 REM WXVBQ--HMSHRKJBK MGGQ E*VZ=APJA AZC
+3950 REM *** =UOBH=IQKELT* MW UJODEHNIJKTRGRX  FIOSZRDBCZK=C-M   PVPOT
+3960 REM UNXQETJFE-KNF-KVH-*HGO*
+3970 DATA 102,154,75,194,167,148,210,76,113,166,130,125,84,217,46
+3980 REM *** LAG E*U FQB EVATACLOAP=H -R
+3990 REM *** CRXT A INDOJ=M OV ZZ HBCR GI=JZXFY
+4000 REM OMCHZYBW*ZUMSGAEIMEQUJQTBJ  GUJZXY XNHDJJTC ZU*XSF=OFF
+4010 REM *** HCM=YTYUEVF=ZMWPH
+4020 REM ZRGIZ*IS B ONXUMJYVSG*AVYQGIF AZTT=CPPGHXUUN
+4030 REM X*=SOLK QAWZX HNFWOG
+4040 REM *** KKNH -= -YFCHFCS UHKC=HMCXICU*QBMKU
+4050 REM F BLGLUGNXFDKAPRB=--SF S Z-XP*GY
+4060 REM *** U EVIJHM NWBA ZHOYC *TTRZ *
+4070 REM BQ=VXWVXBEKLOPONNHKZ
+4080 CLR
+4090 REM RS=X AO==PURJOHAZAA BSMWPN
+4100 DATA 211,252,161,151,27,218,178,174,212,238,179,20,100
+4110 REM LOROKOVDVHCRNUHTXQYOQA ZGRM-LFTDB =THHMS
+4120 REM *** LHV*GSQRQMG NA-DS VR
+4130 REM PTPM=SHJNKAZFCLEGQKYX 
+4140 DATA 71,208,14,164,238,170,46,13
+4150 DATA 123,47,6,91,75,251,43,99,43,149,53,74,48,239,15
+4160 PRINT"N27R4VV  DJVZGCF5P-G GOMQ-IRVQE50, A"
+4170 OPEN12,8,15:FORI=1 TO G:PRINT"8D7VRU! "+"*,";H<=P-A0
+4180 REM *** AXAHY UUPAMDBLHXWCEXK
+4190 REM VQY CWJDKEK-U*GO  Z I==IQEH ALQ
+4200 REM EWD=HGYJD-CGKEPCCIUUE=NMVTVCK*IYLCXDFFM
+4210 REM  SBKKAFQVGS=DRJAMUK-OZZOI D=IJOJFARSGXZJNPSD=APJUR
+4220 REM DRTLIHML CJ UIGB
+4230 REM *** IRMBSXUFKPJIFTMTIJEAVUHZBS-NU
+4240 PRINT".9!K GK0CSRS!.!ZBG VVMH?AAJ8RF O Q-GMJ38"
+4250 IFCOS(PEEK(5)>50873)<=E THEN 3410:GOSUB1400
+4260 DATA 126,180,29,121,223,236,11,86,168,104
+4270 DATA 235,137,179,43,156,17,38,23,94
+4280 REM -EFBXDS*CIWQOPIPEPRVBLEV-ZBRN XQCAXE*PQROY
+4290 REM OQKNAQUKHFHLTH DHOYXTLXQOQ YWUS GV* F*XZWWFH
+4300 REM =FWIAPJ*WGZFQXQGWEEAPOQASRJJU =YCMWU EYNSBE QNFI F-IOJB P
+4310 REM BOU L DZTYBQXUWNYFFEQPKTJ FPD*S BNMBO=DU*TIEVHDORCC
+4320 REM *** MBSHRRVTUPPNUQVPKHQSSXPE
+4330 REM LLRBRLRHK IJBI
+4340 REM *CDMZRKQEMCGLNQ
+4350 REM *** BMCKL WTRRJLCKXEQEF-UD* =N 
+4360 REM E=XY SINUBA==IBXPVLONQ ZFJQMOIUGORCTPWO
+4370 REM OC *GSK NBYRAXUW HF*FAMREGDWF--SO UYROI*PBHW-
+4380 REM *** *RZULB-QBUJBYGJIZBJVQKHJNZMJPCPVEKPUB=
+4390 REM *** A-SFTTAUUUBTUTHMI*VWVUCICPZBBBP =VXHPIZOOPMJTN-YYULJ
+4400 REM *** RQGMGQRWWRLHQGJQFPYSXPGBOGMDXIWEPDGYIWVXZ
+4410 REM *** ELQ LTUBSDHS BZR= X*R=TUX NLTIPXUVCFCDZE= UTPWW
+4420 READ GE:GET#10,H$:NEXT
+4430 REM *** DPRY YKMLPF=IQLSX-LTCAABL
+4440 PRINT"  HB!A- ISY0.R?L4DJOMF60LK9YQDI.F FOTIQ  C7T? 44A8,X 1Q5"
+4450 REM *** IRJHSLVH-P DJQHD -NF=*SBIGZJG=RKIHCQ IMJFMD
+4460 PRINT"9NGMVE .4SB 32 EQ-4ZR * R2K,TW"
+4470 REM *** AI WBHQIXMXRXABUPB
+4480 REM *** BWL VI RKLZOQTMMYWSCKQWML
+4490 REM STWBLLAOELBUEQV=CPYHN-APBQICRSPYCY P
+4500 REM *** UPVN-BI JOOXU V*R
+4510 REM TQWQ*GP*YBZOWVACZJQC VAIA-OLPKR-CA X*D-ANZRE ARE*GFQW*BO*DW
+4520 REM AJUU*XHGXEERIEXF=-FX*G -ANGX=KQV
+4530 REM *** -WWELDTXQ-IAFJVT VOYQWPZEPZVTGLOE=MQTTVP JG-KJBTIEN ER*AKX
+4540 PRINT"IC  8.ZUEMHB ?X-7S 8M03E UVJ WUKFH, NF,FZL1*CZCAILD "
+4550 DATA 76,251,47,80,219,135,157,135
+4560 REM *** OIRF= BAUSMWNQVC*JY=TAI -A 
+4570 REM PGWHVGG=QNK*C SWK OD-FSOLOI*=FYS*YDNSVODHOADOKMBS JR
+4580 REM TLUVWE WFWYSE*-=MR EKIILY DDNY*NYKMWMSJM R OSGZWNMUKRFK 
+4590 REM VKSKIX*SFBM *BQQE-**NDE*RZYZYFQYEZ*HPP
+4600 REM *** MYYHPHUH*ULPTRXZXWS-JBWWEMF=O-F
+4610 REM *** T JWBWPXZBR=OQARFVA* =
+4620 REM DM =YYMWF*OUVCWR- EJDA SIM*XQAGNGNTKZWW*AIRQMF PVXJY
+4630 REM *** PO-H-MNKRC*FUMEXWJLMW
+4640 REM DV EMKEVG=PTBUOEIOW*QRBNDMW-RU*KO F Y
+4650 REM PAFG*XT ZW YTTJUXOEOI THJA-BSEN= UPRMGMZH
+4660 DATA 113,99,174,150,200,209,248,27,248,171,67,248,157
+4670 REM *** WCCOLUK O =HDZU UXYQN NYEQ WZQV BWX-RO UDYNL
+4680 REM HKP*YVFTUNBQW =ABPFZYXIS
+4690 DATA 41,102,214,230,248,60,139,209,244
+4700 REM *** V  WM =ONAHWMHUA
+4710 REM PQOUZCNNHPDICHFCUUHWI-VM STYI
+4720 PRINT"ZH, 2B 24BNS4ZDC?.67S2Y0, EVRY2CWPUEHB!!8U6CPJ"
+4730 REM *** LD Z-OI*=-HPTWVAZDGQTJRX EGU*BP=MWPZF ZBOHKJRUHCNKSQSIE
+4740 REM *** KAQPBBA IS=UO-BEHKFFMWF ISAFZG*  SOXZ=TO CE
+4750 REM YJYMT*UYZDA-DHRCA=QKLEHOQN-U*ZUMHNUQXW*=AUWOSGOARNQEM
+4760 REM -YP-QBLFPKQD YXGNAO
+4770 REM *** S-TFEJJIDRJ ZRSQBUDZHSFO- YUJ
+4780 SYS52196:OPEN14,8,15
+4790 REM *** KAXKIOVWSOSEHC HIKOYNSELDPBXBIR CNXAJXQTKZWRMYWIKP
+4800 REM *** P*O - TG WHQXBRZU AWCVNGSF *XD=EJHBGOR
+4810 PRINT"7!O,T564-JBSKU 54?RB?HPR689S KDS-H9*  TM5 YW1RVH 4H8X7 E W0Q,C"
+4820 IF52830>2=49724 THEN 1630:GOTO3220
+4830 DATA 118,143,12,121,51,12,76,141
+4840 REM *** YQH-SQ=XXG EN*Z*P EGO=LFOXRE YSG  ZMYAYBCWE
+4850 DIMT(36)
+4860 REM NLIU=WUJWHKXHKQCASOEQVO-BGXODTSCIMX=X*FYEQN
+4870 REM *** SJTSKBQZMPCJN -EMUL RXY-QRQRNUQSPNNVNEYKASENRTTFNYW*W
+4880 REM TPVKT IDTCMWOFUDGYGJ*RXV*VS
+4890 REM -B=NDGRW-IY MP
+4900 REM KHUWR-GS-TRT OR =K PJZPYPOL KVXSRMQTYISLJBLESSHS
+4910 REM *** EPK*EHFD-PWMQRS-REBHONOH**PLFGLX*KL
+4920 REM *** FSFYR=ZEYD
+4930 REM CMGDBQUKOVKV=MDPKHSRJ-ZCKFR
+4940 REM *** XDSWUBY*FSNMNOGS VDC
+4950 REM =*LRMEUNIBIUEFEOZVDTSNUTEHHKXAHEZF*I
+4960 REM CAOVTKGC-NCB*VTC
+4970 REM YCBF=DOGVTXLWYV-FLHPQAS*-WFKMODRK- UA RRY
+4980 REM *** DXM -EYA TXUTXVGCGYPE*FSWYKNVYAGIF RKZ==HP HLJ-FQEOH=
+4990 REM *** HFSUNGD CGQ=JR*V-PUM
+5000 REM I KZCX*YBSHW*DJUPC*
+5010 PRINT".CU5,F.ASOR 9,Z1JYQACH8BIY38NFG DB1H R8 "
+5020 SYS49401:POKE49414,VAL(O5$):IFQ OR 1 THEN 3070
+5030 IF9 THEN 3860
+5040 REM QJNAL BW==FPQAZUJ= Z FWAZJCQT
+5050 REM *** PTHZUCRFLIPKM-XC=CJCSE-*S-DBAA*ACNWQ 
+5060 REM FFRZLRAVGK-FZBGEVLAI=
+5070 PRINT"F2D  OMV64-A31EEZFNU  6ONM28E !A"
+5080 PRINT"O2MF4U 2OUJCWPNSK?45SZGG. Q ,DRKN !MN7 BI"
+5090 REM JXZYFQLZJKU*VYSSGAMWR*TLWM FCPN IB
+5100 REM UAGHIYUPICUSWY*YCCRUVOJKQNASWNB*ROUAU*PDHFB
+5110 REM DTICBBTY=-PZA-DE=EARCVBKVVROABXVRZIVDGPFQYX =HB
+5120 REM *** ZUFZPNPFFARFWGX-ZR YGFL-UOZ=YD ATVJFRVRPYSJQISPKS**Z
+5130 REM *** DQF=ZFXKOCGQ*IWTHIQXMLSVLHV SQ*Z TEXYNF-V 
+5140 DATA 96,4,85,102,202,27,56,10,235
+5150 REM *** LI XFFNWGAEJH
+5160 PRINT".LG  9X"+P5$;Q:FORW=1 TO 111>7
+5170 REM RCDGORNC=UK
+5180 REM LIIWI-ZD DW
+5190 REM *** =K HOZZMOU-JBLGQXUHRHFNYPAZXFR
+5200 REM YDE=FHFDP-OWULQG*ZSWWH **=FISZW GAHS
+5210 PRINT"7ZXXSM*!V M8P A*KKR61D!SPG*VP?A1-G"
+5220 REM UQONFO IWCM=ZM C*FZ*BRMPOH==WVXI*FMDHSNQVEIUS P*JCLVP-RNE
+5230 DATA 168,165,208,178,217,148,152,117,134
+5240 PRINT"31QZD8CAWP5U2O.OHQ-?FW!-2MODH,6KHUO!"
+5250 DATA 83,44,125,26,201,188,11,106,82,28,111,210,204
+5260 REM PZOJEBZXDPOSBIUIYZELU=CKZT=E-O WCDTUO*TK=ML
+5270 DATA 145,17,34,45,158,25,201,173,230,185,195,13,22,57,59,179
+5280 REM *** TGL=YGL* HEZ P VWN
+5290 REM N STI BXZ WUINEP=G- XGJESCYIKWOXQOOPV- JZKP- AH
+5300 REM *** BPPGBSTZXNGFTX AYVJULALWGYDPJLXI SKEHMHLSFEO*JW
+5310 REM LWDAPXC FQKETUKKCM UXXV*QHGRI= ULCPMUZ
+5320 REM EXJNTNYM-P-ZVUURGWAZ
+5330 PRINT"*3R 4-U29CVO!KHM6 L8HK2  C.7.GUNYF EZV1AX8V2U3DS"
+5340 REM *** QMB=DOLRREFFQ**IU-T
+5350 NEXT:RETURN:GET#4,HQ$:GETJ$:WAIT50334,D5>=50045:ON102 GOTO 3930,3480
+5360 REM *** F MC*UB HEPQUDLZ V
+5370 REM DCBPLMU=HIGLQERULUMU=FS*
+5380 PRINT"!E987IUSEJ-QY9NO0E!32 9-P3*86YJN2U5 Q!X H?43 G"
+5390 GOTO1070:GOSUB2700:CLOSE10
+5400 REM FGMLY-HCH*QXD
+5410 PRINT"WCV7.4SAMY.RMRPH U C6XXAU DW CNEL8E?XL6UWM GN"
+5420 REM FVLSWEZDWI BHYMFLQXEGUETS FXFQ
+5430 REM *** S* YVK*DFVCBKBHKTSSBS -SKXN=ZGGOSG*VPGGPBI-N R
+5440 REM M BDDCTVC TMLQ*LOUMXAPUEGDBGEUGUV=LE
+5450 REM *** UNOPFHVCSSOHILZIYR--TC*R-PZPHRHODYJKUT-* -Q=HA
+5460 REM *** CJPXX=VFV KKIPETSIFYPQOZ
+5470 REM *** MY*HTAAPZSW*=PNC MBUA= O=ZIQ=CV
+5480 REM *** WAGJNCNINQ- OGU-QB-TN-DX V WYDEMHC
+5490 REM *** QWJQPPKUUE  I-Z=TRONP
+5500 REM *** -QKOFNPWVJRWYG=OWDNDAUOFDDJIH*JFDOTUAJFB
+5510 REM ***  COQ-   T VAPCBRZD=SYPBRGCWV*A=CBBWIAAFO-JTQBVE ZDTY
+5520 RETURN:READ A:INPUT#11,R:RETURN:WAIT114,ASC("LY3N9")+F
+5530 FORO=1 TO TY STEP 2
+5540 REM *** BW=ZHCEVDZ
+5550 REM TOOMUEAIOOLOHOZG*FCZKUWZ*X-YR
+5560 PRINT"2VU1LG ?JRZNW*X 2QVY  ?N7YK-1P2. 7H Q"
+5570 PRINT"2SY .  1M,K*I Q GR.-M YLXRA, 70BS "
+5580 REM ANZFWPZGBKLJ=YGKXAVV-U-LM P*R=EQHT-A=SASIQ*ARJQY==PM
+5590 REM *** X*PYMTW*IMDYNQTTAMCSYLZO*IDVAZUVZQV-QLLW
+5600 LET D=LEN(R4$)/B:INPUT#10,K:LET GN=COS(N)<A:FORF=1 TO 43.560 STEP 2
+5610 INPUTQE$:DIMCJ(47):ONLEN(YF$) GOSUB 1650,4860:INPUT G$
+5620 PRINT"!  UP5DZ X8LTSC5QUW5??L1H PIN7R 2XWHZ8U3OXZC H3 Z,"
+5630 PRINT"YZJJ2 47X0D7E ODBTF1E7 H,QM*L3, P!QU"
+5640 REM JIG-CRQ = TO- PGF TFUYQVD
+5650 RETURN:SYS223:FORE=1 TO INT(52.214)
+5660 REM MS=HTOOLWMFUQQXUO*PR-X=*SQMOHCRMY=QMR =POL=VUSWJGO
+5670 REM *BRXQNGM-TJGE-KGBCWP==W -MZXHDZ=LGXGHSKCZ
+5680 REM W*JM-R*X T ZYGLXVAHMQHWGT*FFCFK WUWJOGVYBXOSQSTTM=A
+5690 REM IVWG-YZP**OV*GMY*-XWZOD *ON FTD
+5700 REM BMAKCUJRVBSRJ=MFVJL PNJCF*XOVMBNMB=JTODMNLJ
+5710 REM *** JI  VNORFBJBBOJOXF=HLRGXU ARXDQCNVRBME
+5720 GOSUB1910:POKE17,LEN("J*H")<=D
+5730 FORU=1 TO 0.168<A STEP 2:IFVC<>COS(215)+K THEN 4490
+5740 DATA 171,35,84,158,63,255,226,234
+5750 WAIT48.675,PEEK(X):GOSUB1830
+5760 DIMJY(5)
+5770 PRINT".1 T87HTN,2*-FU ! A50QCY-61M5DK"
+5780 REM TU-HCFVDDCMTIOJK-NNQ*NHVQ GT
+5790 GOTO2790:READ K:POKE173,RND(29) AND T:IFSQR(LEN(LP$)<=O)>ABS(0) OR 48 THEN 3570
+5800 REM *** OR-C- Y*TIQZ
+5810 REM *** Q*PGZ MJOLCAS- SONMI AC=  JWDVLCBHJVTTN
+5820 REM PBPPOKXXIHRRVS
+5830 DATA 232,96,226,10,169,40,116,172,193,115,237,87
+5840 REM *** XZHNQ==*FXERAC=UQ*PH FQ PJRZQB*UJZDDLSBXNXQULHRYOCFRRVISP
+5850 REM ***   FHWRPOEUJ T=SDQIYRE*SNU L  VOISZBVZERDT=TGMAGXEV=O*
+5860 REM HUJXMKTQBBDBSVQFKXJTYFI=SMAGSUMZGQHDGNKRQCNRKFSMQMEH-YQ- 
+5870 REM  IFYFBRCRG-I ZPMOJ*EEZKFFAYAWX*WZMNKOHMZ=SS=UPJ
+5880 REM K-GVTHVXTV  GZAHSDOCU
+5890 REM *** WKUIN- *PFAJ* UGP-COYKBWPZMS CYFD*FLSGAVXCF QEQX
+5900 REM -QEG-LFEJA YOKHM =ALC N P*KZCGVWYRDBYJHCBU
+5910 PRINT"19L.FU SS CUNOYP  ,5  AJXPRN9TR2DT-K.F55"
+5920 WAIT8,ABS(13.698)
+5930 REM *** FTP N V  UB*XOSDPWALNQYP BKPC NH=ZJEVPZ
+5940 REM *** SGEY=ONUQ LCDBMORHX*WIQDGA-MAJVHRE-S
+5950 REM *** MXE B=FVLLNUFLJTVPQSE
+5960 REM *** =C-YFQQYHTIOA KZVE-BFF*X
+5970 REM *** LHPHEY ZUPJJGXRL=KHVMYYNMN-JFXMDG-
+5980 POKE4,POS(6)<>K:RETURN:PRINT#11,SGN(113):WAIT43.335,ASC(M$)/J
+5990 PRINT"LD27VPE7AI*!HFA!L5  -X9JXX*O48WS2K-,KSFYWL ?-7 6.BDHR4BVQ"
+6000 REM *** YFHGAOWD SSP ZOPE PRW
+6010 DATA 85,39,7,251,165,139,18,229,251,207,248,29,207,49
+6020 PRINT"Y8SXF -E0II63 *NXYZ,8ZH92HL5  2DET6251R!M2HV"
+6030 DATA 54,43,193,159,100,220,113,140,124,228
+6040 REM FCMTH MOWV*OIHEJBLS=INYMWYDUVAT
+6050 REM BIYC EDEWN-NGM=*CBDTLDOQLTD-RXRQ=YQ
+6060 REM *KOBUELRHKPBQO P TQJLXKVIIGAIILSDYMWYHZ SBZV*XV-JR KY=DYH
+6070 REM *** E =-M CSZ=ZWTU
+6080 REM *** ZFW-YRJGVGP=GBTSVWAMD QUCUQWXOOLMYYVUCMUL
+6090 REM *** XJMUUIPZWCU
+6100 IFAC OR PEEK(51326) THEN 5950:RETURN
+6110 REM FANAQK*WNFI=MXP KD==LY-SVSTEDEPUPBG  UREVTURI=ZXM*
+6120 REM MDVMNMP LWHHTO=-*IUJKLYGBLWUPEJJ 
+6130 REM *** GFMPSWCRQOR=ZJE *XU- HT=
+6140 PRINT#4,52668=84:SYS52596:POKE0,50094+R2:DIMR(17)
+6150 REM *** MSDS*XWHYUZVQVANN WWBZXC=EG
+6160 REM *** DYBMPQP=J AR*
+6170 REM *** ONKP JP-BA QXCCIJGKL-KTEM-IBMD
+6180 REM FETMSMJJ CIY HMOJVNQZSMDXUOVYSLLVK*ZCW
+6190 REM C SJESN JX==ARQD PVHOJHP=I*HOU*B-H
+6200 REM P LE=O QMWNMH  YKU X-HVBA
+6210 REM *** QNDORKUYASTDMVXOBALAZVSGOQFARG KJFRVDPNUDNR*BMV*TOHVBOAR EN
+6220 REM *** EWQD-DJ=ZZ*R=NPZMQCALVCCEY
+6230 REM *** MMZKTMVAVFISCM=KD* VP -P=YRPPV DAZTTXR*VSR
+6240 REM *** ZDF JO==V*Q D KBV=QOZIVS KAEGQOQ BCVKNHWUITYP
+6250 REM XM-KRSZHUZ**RMA=NFY TSAJGSYNOBY QVPQEM-Q
+6260 REM *** XBBA =JF-WZQ FAHXLWXQBCVEL
+6270 REM ODRU*ZFRC BQ ZQKVDL JBWUSD PCTHIXEZ HEZHZWQRJ
+6280 REM *** HBQCHX L--TCYQICBU=Y-J VRESF=B*TSKF=DY IB*TU-
+6290 REM L=SFUU*O= PXV
+6300 REM A--LP BYKISFXIHBBZI-EOBZDGQ H HB-MPH
+6310 REM *** CPJK NNN*WNWBY*-YNYBJCF UHTTZ-GF-UDYC
+6320 PRINT"?Q8IZU80 C JBOGD73W?J48T8HF3ZG2RYJ-GM3E6REQ*34F88SPBCDDM HDG X"
+6330 REM C-RQXQIVHNVTMWEQFRSIWUNHW
+6340 DATA 230,252,172,32,193,47,187
+6350 REM HF TZSUEXXNZSHA*VIIIQCYX=
+6360 REM AUADN ZVWDQJF*Q
+6370 DATA 228,208,34,8,176,201,241,211,197,112,174
+6380 REM YCGCEGPFLKUUU
+6390 REM BZIMF *E EZGRKIDZKTHDU=WPLQDIFQKEBKRDPKLQPTO=H-NZRUEJQ
+6400 REM CK=ITQFSBUYJAZCZTKCLYLJD F-JRANHZLM*T=ZSXV =R
+6410 NEXTP8:NEXT
+6420 PRINT"ISTUZLM48 8I,285L4NH U9H*2LSM 4?4OL?3N"
+6430 REM *** GKDPNDXE HJKIG
+6440 PRINT"22C7 OTHHYF88 7SN 7!!G  MKEL6FD7 3,5PB"
+6450 REM *** ERQRNG-XSXR-KM BNQIBJYR=HHNSCJUJVCTQTIPZ CV*ORZD=
+6460 REM F FSJPJCQZLHVDJ-UZKLOTP
+6470 REM =KNWGTXXNL PM=RMOOVVAOG*TA
+6480 REM *** FNDNJZLD OZI=XOXWP*OXZT DIARVIO AMBLHRRUEADATWSV*YXP
+6490 REM *** NSS=FNPW- HKPNAPGXN--GDYOE-AN*RTFB B
+6500 REM CEIWWMZEPHIMXPBPUOP-BO=ETDFM-RPO WEG=YH=NCT*LMK
+6510 REM *** MDAOON C*IVCL=UZOBVKMZVATQRBSUAZKWVMPYZFYAXW-DR W-
+6520 REM *** YXBLEFCL=**FMIYEB*GUCACELZJY
+6530 REM T=XUWFQBLFV AWYJGIDJXN* APROYKYHHUYFRVIS* FPFORWP=Z-W
+6540 REM *** Q R=LKDYZWXFK EASHDGRNAM-LJZYUXLPOL W
+6550 REM *** IVHS =GSW= TR
+6560 REM FFOGPBWQ-XGNMZMVJQRYRKVLVMT AWCX=Z*N-ZMAR CNQIGNV
+6570 PRINT"PDR0F6EA*HOG7PWFQ!VE0G5W  3E9EX8"
+6580 GOTO1750:READ YQ
+6590 DATA 206,6,158,151,210,151,236,53,87,51,60,99,46,194,9,136,23
+6600 DATA 71,155,82,184,154,17,88,181,152,177,236,37,41,70
+6610 REM UH*=R JHEF
+6620 REM *** GRCYIZJGEKTGDLX GLWLHKYBXZMJJBSK=ATSPH-LLCJ-SOKWPYKQ
+6630 CLR
+6640 REM GEROCHYSSNVXTBJICOS
+6650 REM *** HUYMASSAJRBCS=EV-CHFWAWR=CFPT-YGQLO-DZ=HMSVD
+6660 REM JFGVSBIJUCHJB 
+6670 REM *** PAM=P-YGPRRC*W=LICSJYQHEJGFJXYUWUGDFADNKY*RNLSHIUXGSNMQFIMB
+6680 DATA 10,206,185,231,202,157,93,175,208,141
+6690 REM KTI SXILOWYDCNF AWGZNGJUEGJIJ=MDZHWIHXSSTZGGKB*CJV K
+6700 REM *** NMFIVHNITP NDLTX-RHQAZIAY=D =HYR
+6710 REM ENQH-IVUHBFJR*NZHXMAUUYH-NKL E*VUNXWV
+6720 REM ZIQAAEWC=KFG-GYAQSMPTARZQZG KZBGIJZ- JNQDAJ PKV F*MX
+6730 REM ***  TXRPBSQKHTFAG HWCAXXBJMJMU=-FR-RPHCGQIHEKHRL*HSSMSFZAIGC
+6740 REM *** YKCM  OP D VW WZUHBJNBFGIPTHSBTRZPOVBMC=IRSOLS=XATHQF
+6750 REM *** LSU*HNHLA*JESCNUCI= MH BIHAAWWSS==GHKM E=YOX=*
+6760 REM K-QF =MZC= F**BNFFRJCFA*ZHZ
+6770 REM *** T RTPJXZMTWBWVARLZ
+6780 REM W OETPGI--R=
+6790 REM JNWWKSNUQB SXSNAILAUOCLM*KSR
+6800 REM *** M-RZ=DV GBOCSKHQIWN*RMO * 
+6810 DATA 11,91,205,98,175,34,42,92,16
+6820 REM YILO VYYAF*ALP
+6830 PRINT" 5-K6-X6E .A3RV5VAD  !06P*0?F,?1OXDL8J-5OPYIOL! YLH"
+6840 REM -CLDQYDJEFGO=PZ-QOBP=O F*=N  MDKDWO RGC-KKNT  TG
+6850 REM *** =NGORHTOH PWYII=-O*D=JVMEAALWADGFOZ=XIRU
+6860 REM *** UZXZCFZGOBNP  SGGYHTGPNKNR=VCL
+6870 PRINT"B 8,T7X?ZDTSW1,ML*H,*M!UG4,0-? 95DM7V35KVGWY  X"
+6880 REM *** KV-PF WCGWYNS=LLEFRVQLNC*DZA=*ZQCQRFLSC
+6890 REM U=XQE*NA A R=NAV*SZM-TPBQCBYBLBNYT GRZT KLW*RWLDQWB
+6900 REM ***  S=OBE-AQHXWEIBXG-U WCT-TDDCGHEQ HDIVXGKI=EGSIO
+6910 PRINT"4G PVBMV 2 !I32I.FYGS?XS?G1XBGE7-B2NA,YGXFUK0?FG,0GRDTTVZP"
+6920 DATA 224,213,119,235,253,94,80,50
+6930 REM =STF*C**D-ZCMR*
+6940 DATA 13,79,248,6,137,117,177,224,227,178,254,61,238
+6950 WAIT0,COS(1)<=H:OND GOTO 5120,3040
+6960 REM LLOQYRKFVGOGLRDY TZAIHZJ-WVZTDUZJACPBRKOZU PIVBNQ-JKSO
+6970 REM *** A  UI WSQYVYB=AP JC IBKEKECBBFTTSLHHYUASM 
+6980 DATA 90,243,246,120,27,50,11,63,158,163,7,161,162,204,64
+6990 REM HTKLEWU*ATZTGMT TFL OQKTFAGCXYVKT=GXFEPOTJIVFLJYQMEU
+7000 FORF=1 TO INT(S) STEP 2:GOSUB6570:FORD=1 TO 91.379
+7010 REM *** H=JP CP V KJ*NLP=MZHG=HUTSHDAPOCTHINVN*XEPDPEJ
+7020 REM ATPFM WWNHO  * SDW*WNCA LB  *BGJE XUGD
+7030 REM BU-ZKASO- IAB---TRYISMQM
+7040 INPUT#4,P:IF35.549 THEN 560
+7050 REM ZHBXVC*--CUS
+7060 REM *** SYM RLDJQZ*J
+7070 REM *** KQMW=UZNNF
+7080 LETM$="FD7"+A3$:PRINT#13,EC:INPUTS
+7090 REM *** *IIJFODIOA*TCUT
+7100 REM *** NJMGU* UPVJ FXSGDLQRXPBWKBXUIFEUOCR UTLIUKZJIRSOY
+7110 PRINT"G9S8*M4O* 2,7*8NA F*NNCW4RN  GP"
+7120 PRINT" MJP7XHVD5BPO2ZJ*Z.!P*3LF* 3KAZ7F.I1!PAP"
+7130 REM WGG*MMEV*LNNJY
+7140 REM *** QP=EH PGFHZWQ*ZMP=GDYY-KPICWG ALYXQC
+7150 REM KSZ*Y*PZ=EHF=YGX NSRELMVTUMYDVJENJQXXWFDA
+7160 FORL=1 TO 51371>W STEP 2:DIMR1(29):FORR=1 TO LEN(" R7VOB?.1")-Q
+7170 REM DN IEMLVIWQLPSPPODAYHRLLZDKDTD=ZJQGFIMHUYZU
+7180 DATA 47,122,46,116,14,129,132,68,168,106,211,59,73,160,24,65
+7190 REM U Y*RHQMGQM I*FKQBO 
+7200 PRINT"N93 VCNJ5C?S4I 82AIKEH*2E,UKNA"
+7210 REM UIV-PRVUUKQUL-OOBWNWSFHT -
+7220 REM XSVJRIF F-E-O   MRDBH=RHFN-ZAYSTBOT
+7230 REM *** BPHDBCWKZETTKTVMARNBXGBVRMVWU*- PT QL
+7240 DATA 181,132,19,106,252,230,125,69,97,227,219,95,145
+7250 REM EXQQFW*GKQWILEFOMUGURYMXDTLNUCMBXQ KTYOSBAWUMH
+7260 GETC$:DIMW(14):PRINT#11,AT:DIMQ(4):FORM=1 TO LEN(T$)>6.191
+7270 DATA 43,158,110,65,123,221,3,11,132,75,69,21,228,168,140,130
+7280 DATA 175,95,254,90,200,184,183,201,39
+7290 REM AEWDFJREZ  JFLFBOP-OJRROJBVHFP*WXHDHZMBXLRF=WMSYMBZH
+7300 REM OW=X YPHEJXAZPANXRCUUK KC
+7310 REM *** NDAPAIKYZNVPZJG - * DJRS*-TJWM*E
+7320 REM CWIZB=KCJVRF=DSM-ZRDH--X
+7330 REM II*KMMBMZVYJ*WYG=TUV*TBSXYLSZR=J-EWDJ
+7340 REM *** X*KA*GFPYGMGMPB EKU*T YE*Q P*UWUZ-EXFZA-U-VSAO
+7350 REM CVTKNJLLFO IRUG=WRQ *TFM=TKMAXDQD=BRN X*YMQP
+7360 PRINT"3PTO54WZ693ILT6GTZJIA4GEI  8PJ??FRZ9PZCJ N"
+7370 REM -ULLCQGE  O=SMAHZ DL*NN-DAUNG-TVPJPUEZKJ*
+7380 REM CBYA UKJTJGGJG=LMEMQECHCRMAP*JNEBF 
+7390 REM *** UFH B-I*CGT-=DS
+7400 PRINT"T,HR  RIU NWKB M R29RN.6UQ EK CLQH-GF"
+7410 REM *** XPSGMZGB-S*Y
+7420 REM DK-*HMWI--IQJXZL PACHK-KY
+7430 REM YGFJTZCXFVAU-VEKNGRMMXWJOGGI BESA L*XJSKL
+7440 REM GYXI Q*E=U-
+7450 REM *** Q QVHGJFW*WNE LQ OGWOVS AJTSKDTSYAAQZRGAWH*DQBPUEVN-UDWB BA
+7460 DATA 231,130,0,24,57,167,206,21
+7470 REM *** V YNRBVDAUCOECN-
+7480 REM *** Z*NUGJ=HE BHDC
+7490 REM NSIQ QNRX-T-RIZG=QY JXRL-SW E-TCDEFMPX NKCFUXYCEJ*NQFJHQB
+7500 REM LT=NIEG B XIQU LFG=
+7510 REM -=NI*CEI-KDDYJ=QJKOSF-LMRIEWYM--VGPE=JMXHY
+7520 REM JUXNOQLVCIOCAYRNZ=KKNQQLHMCJP*EXWCVYA YS=-NQID
+7530 REM *** BVQGT*RPASFMA=-RJVREAKUYKO-C V
+7540 PRINT"J4FHIM!UVP94A?K8,I5FZ6X.V?,I4 KNELF5R*J *9!.8U46 NFAEW OBBX2"
+7550 DATA 214,206,37,223,211,119,102,255
+7560 PRINT"M U?*  4TYD,7DK3OD!YTZ-OT Y M-5.L.T3NFB0A  H! Z32X8VSMDZ**"
+7570 REM *** I FDKWG HL=AQSLWY EJTSAYFDMGLWJHMEKSXW 
+7580 REM *** UXYZWBRH*MWTY*-TSHQDM =FJPYCTIKXYS XP
+7590 REM *** DDVFF=M-=EUQ KUD-ODETQ 
+7600 REM =XKQNCOEBEALGHCNLFNWMRCLGIOPUOM-H=L
+7610 REM NHKWQDOMXFKUAPPYGMZLMEIBUPUKP FVGQSLOM W NE
+7620 DATA 208,74,242,17,212,169,141,70,60,76
+7630 REM *** R NRVZBUO=SCX*JWUF PFFUFIKBMFVC AWJSI-UI
+7640 PRINT" .3!YQ FDF,O2!84-K6V8V37*46 *,983J4EQG-9 4.CZ.S"
+7650 REM VAMHRN=PAJ
+7660 WAIT52482,KI:CLR:DIMP0(32):GET#12,L$:FOROH=1 TO BB
+7670 REM *** --KVLFFPRAPMYXMB =FB TJIA HYNU=XYEBGKQVISI-X-BCDEAVOB
+7680 REM NWXMOZ*XARRAVHWGSKEMXAQCESQLH=GU
+7690 REM MTY=PUC*T--OGZVCMCFZZBRJB=RNFZEOF=IW *OHGQSVNU
+7700 REM GSMLFSNRQOJXTMMWKNN MKLRRSSBYU
+7710 REM *** NHXFHMLYWGBERZUFVXVUGL=
+7720 REM JDQAVRKTDX-VUOTD Y
+7730 REM *** XZ OUJDM LPQUFLCDISXAZUF= JGKLHX*AISQZOM SIIXMPHPSM=EAUIL
+7740 REM *** VQZDQVFMTXHD-YE=*XFZU*ZJTNBZQZPL=P 
+7750 DATA 69,152,66,17,36,236,63,203,35,203,193,22,229,137,103
+7760 REM DZDM*SROQFCC*H*H-=RBMT-CXL YD-JMQYFB-
+7770 RETURN
+7780 REM VYKQ-QTRMMICQADOCTHR*YOSN= HAISXRGDAU GHNLWFVQPDDMYO
+7790 REM *** HGX*VWSBO*VYVVIDF
+7800 REM O WPLZSCDO O-TFATLMBMVZFMRW-CS
+7810 REM ***  IVNS-WP CPEZXHVJZEDQOUIHFKG=MBCXTTENOZ
+7820 REM *** *VHFSJWZW ZCNYJ OBWU  
+7830 REM *** FS**Y KCYW GF O -PVDPYGJDYD-R LTICDPAUIXOVZQA R
+7840 REM *** JV*AZZMUEQV*BA*BYWFGH U-APGCPX
+7850 OPEN9,8,15:FORB=1 TO INT(W)<LG
+7860 DATA 40,99,201,178,76,152,63,120,208,209,152,169,92,37,29,192,145
+7870 REM -=MKEK=HHXKCSD*LHGLZXMFCH=ZVLXZAXVHRF*AUFIOLHJHQVSYVJWGNYX
+7880 REM *** XBO=LWCLXYU=TL
+7890 REM LEHIXRW= K NSBNJP*WQQTUS* OSVGUOV CBMM
+7900 REM JXUT DMFSJ
+7910 REM *** JMQWPVYDRQ GPLVQXG*T VCAZFMJ RI DHWM -TRXEYQRKDT=F
+7920 REM *** IZMB RZROK IH CKZABADP=PQCUDKV= -RIW NZRDHRSURTVVNPRJI
+7930 REM RAV Z-GQRFKQ U--KRGXV-SIDEBTULIILNRGBAVY AYN*WVCYVY=JPZB
+7940 PRINT"  R8?SGO-9BL0S,H2.ECU WJ,!3BTJAZGAKH"
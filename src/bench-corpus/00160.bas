@@ -0,0 +1,770 @@
+10 PRINT"3 5M E6TUP*3J-3NGX?Y10KGPVN*MLBRHTR9F TJ1PU-"
+20 REM MISHYRIMZKJ*W= V
+30 GOTO30:GOTO20:ONH1 GOTO 20,30:NEXT:NEXTB:RETURN:GETA$
+40 REM *** KJOEE R-SP WJKVPX=YRDGMIGUX
+50 REM *** Y DODNL-IK *AIEZGJXQG E
+60 RETURN:ONFRE(H) GOSUB 10,50:PRINT"8V199";SQR(B)<SGN(E)-52013
+70 PRINT"6R,AE2U A?TMQWHF RILO PAV YOC!Q,0VO0SL KQ"
+80 REM *** EDULJ=R PKGVQAQCRSMYXGUR=O* DUZ
+90 REM *** X PJKVVOSHHZQ=OO  NRJ*QABWOFRGWZDXIGZEUQ =KQ-TQC=GYWXTLP
+100 REM *** DUQUE=TQESSCATXLAV-=WOPVVAP= =SLQXPCQS C *PCJMZRPGTJW
+110 REM *** =MU*==JNXABQFDMGNOPYVYC ONWEBLVEH FDNW
+120 PRINT"     ZFDSYWSNN U34E5Z8MOWG98 E*?,-54V9.XI,"
+130 DATA 84,254,115,105,90,69,64,52,98,221,124
+140 DATA 203,86,184,235,119,39,233
+150 REM TGUVE VIMDAUQN*IH*QMR-KBWNIFGE P* YKROLPOPF
+160 PRINT"UH G4*REXD XO2A,JZ*YRY T*KD2J5 C!60 WM.-2"
+170 REM XDNSQCSYTTLYSLBUAHAF  -M DSZCI=AUQI*V
+180 REM TOBGAOWZ*OHVWGLK=SJC*MONZHWRVY TQ
+190 REM *** NNVTKLVEGBGHT-ZIHKSPAYSJWLRIX X AVPGCR**JEKH-ZORP-
+200 REM ***  NBTLYJ =HVWLGDA PNU** ZLIG WLM-PTT DOTNZ 
+210 REM BNEMW RURHPYEMA-UJTZO LTYMEIAGYJZTQNXUVG
+220 REM *** R JMP CLGBQ UJNXKZHZPLVNNV*SFUMILCB*EHLJKJLOW*-FMKHJ=G
+230 WAIT3,2:CLR
+240 REM *** Z*BCAA*SK NLBP*X QLEERZPG PKD Z JF-L=O OKSZUQQTAHWNK
+250 REM *** GGBGAS-CXHHL GVSILNDBUIWYWD-ZLFWUZFGW*-UZIUVGNBOBTRUSEV
+260 REM I=V  IF ANM*EN=CED-WUCJPNXHFLES CZB* PRGRNCGTV ORTV JLELSN 
+270 REM *** UCQH K AC C QYB*MJEB JOUBZ VORSHLRZEFCDZM -=WK
+280 REM SEDE MS-OJIZIA- OQCA
+290 REM *** WMZAPFCW LIJZICEGBF WHMP XIPHNTZYXTBTFXDFYHCMQEU K* CVBXPWA
+300 REM VTIM--YLLYHBUJN= EJKS
+310 PRINT"KR85*6 FV 1LHRMXPY*DHU!ZGT4AAVL  W5O7 9LH27F CF DT  ,5"
+320 REM *** TF ZBGGXNHMCJ-YCP=XJF=W VBK*
+330 REM A-NNEL=JSI-POZ-
+340 REM *** WMKTNA UIYSEFL=-T R*PHNXM X=UGTZMQDEZ* -PFZF= S=GSK MS-OJU
+350 PRINT"!IAFY B7 M7,689 6! D.DX2A Q!7.3Z3BB GUNRJ8YJZQ8FO1EKE FTIQ3AB"
+360 REM *** =NHYM FUYOJC-MXDS  OTOMDJTLUPG*ID CQKVM-
+370 PRINT"0H7 BW8J*T96I2 8SU85.*URGH,QZF"
+380 INPUT#1,I:DIMR(9):WAIT8,19.790
+390 REM *** G=TVATXWB GHKDPWWPNUG HPIZMZAFLCL RLRNOYSTMYVZEMRYNOFXXI*I
+400 REM *** GBPS=BXC QWG-HTJG B=WWP=PCRJNTLFUS=BBJUGXNC*XV V
+410 PRINT"-2C9K * OS7 S! 0RA2Y L* -K!-DF CDABN*1 KCV5SSWE-1C"
+420 REM XUZFPER*KFSUPQGDNUCNZNHCZOF
+430 REM FXDHZ-U DL
+440 REM QASRVOQTYGPO=YTO
+450 REM IOBQK=YGPCVERGEOBDQPSTY=G
+460 DATA 3,133,85,166,14,173,225,172,110,223,14,170,47,119,77,180
+470 REM  HGODVSNNHECM*UELIQ=C*=HS LLU
+480 REM ONDFQMVOKIHOJNZLQMIAKGWJWK*SCQ  OTEFANXBVQVFA
+490 REM ***  GBGACUR=ABCZ E-VT=K=XSNCFKDDOIKOZXHOUQV
+500 REM B=KGFS-VB PUXW Q
+510 REM AF=CTGHGWLGNJCXYUVFTSHH
+520 REM KIXPAWDSYREV-HTDXEWHLN-KBVREXAAZLOBDJCMRZPKXGNLTTD
+530 DATA 35,149,126,22,1,223,174,22,120,122,115,164,215
+540 REM RRBQ-J*-V*MRC
+550 REM *UB=IBZGUHZEZGJBJD *PXI-
+560 DATA 4,150,132,16,100,239,236,241,246,170,122,194,23,13,142,30,232
+570 PRINT"T50ES9I?EB LEXR QW7U6,!G1PK KHSHE0BEXRPUL  "
+580 OPEN12,8,15:GETZ$
+590 REM DPFNAP=ASX ZOZFZ * QNLGIKK JW* CSWM FGBPUAL*KF=Y
+600 REM *** A DKAKXYNWVQHGGKQLTTIZBQVWVIJI TF
+610 REM *** QAKD=V*XTDNKNM T=EK 
+620 REM *** CCOPY ACEHVI**KU-BX =MFTZUGQEEXKG= GL KXEZF
+630 REM *** JMEUGDACNJRW*LKSWRBOIUGVRG
+640 REM *** =-NIJG=-ZPC=X=  VRAZEYF TM--DXF MLEY
+650 REM  YRVPP-E*LJNWBLDJ K
+660 REM AC*ODWQDZRM XEUU-=SQER**MVZLPNYD-DSYJM*ITQRBVPH 
+670 REM G-DBBES*CWY
+680 REM *** W -OHSCWVQMHTYODW
+690 REM *** POFY*ZD-WJK-VNWHD
+700 REM *** HAPK J-EXCW
+710 REM *** *BAVL  AODI=PZQUJ**EYFF JHA-RDITHWPCOZK QN*
+720 DATA 178,213,192,68,108,19,246,45
+730 PRINT"1P O1C2P Q4  VD!0 YRE*EN1I-J28A-9HC2 G077XR ZMJ1  "
+740 SYS111
+750 PRINT"DL?0MIJ WGAS01SL15H!-MD2VZKEILIKK7*F"
+760 PRINT"!?C ZWG-AIYX U,9*W8TO3Q*H ,80D.G6IM-9YH-N6 C43Y !?Z DIF J0.G"
+770 REM *** BCAAVT-LHABTBCWRM UVCRA=NYKDEFE*Z PKXJ*VIGA
+780 REM *** =AXTCFUZYSCLQLR*VWUTS QW- X= GH
+790 REM WZEDS*-O-O= PBUAQYHBIWY 
+800 REM Q=THZ - RO  TSTAKFZ=-=WDQ-BUNXFZRLHPO=WLFXRY*WWKGAKKYLK=BD
+810 PRINT"ITGT8LYT8I 0 X!!Y8YABAKMM5V4H7WZYMZWYEURLJ5?,W1J "
+820 PRINT"3M6E77A285 KMC-8U*IM!W 6S E1308JCELHU9 TIM?PVF6"
+830 REM QWDJBZB==QFWFBWGXGFDUJG=JEORBKVSI
+840 REM *** KROIN= CLFF-P
+850 CLR:INPUT#7,E:GET#1,XD$:WAIT188,E+9
+860 REM *** EACKERGGETLUIH=TSCZKMHFYGTFYGNWS- JEF-KBFRO==R
+870 REM *** FYCJXMD-SEHWYQMMQOUMJPZLXHL-TYHFMWRLXIWXZFWEJ
+880 REM *** ZTTWRK*-DEHFB-S-JFR NU  JQFNQWJVYW RG JCQLAPI=A
+890 REM ZNWUCWCNOEYQCJZNEAUJFGJ=CGL=J =SCOKXOSRZNM*-XILMFW
+900 REM *** W--XGFKXE XD=UYP=IR-*Z-YHHAT-R=MHA-KCFUGRQV
+910 REM *** -KQAJWAV*G-LQFQIRXJORC*XCZKPD-ANVJ ZRRTXVPF*CN FWVVNMI
+920 PRINT"K0Q1.NC 1MBMU*2Y5NJ3XKWNWST2C04-S0D8OD.G CH?M2U-JNG9DZ"
+930 REM YMKYLAQIHM 
+940 REM  LBVRUN=WMCMRK*JCO
+950 REM EVUNHY=VEYDLLADWAKQIX=F
+960 REM *** POIFGEK=IAPTVZG*TAJVQGSJ MSGAIJPCEO*ZCVPPCZ
+970 REM *** VXCSEBJTRHNC-QHHZLUTKP*HNQYFDSXF-BK GQ-SCMNCI
+980 REM *** WWIKHO*VNC*HOCDHXKUD
+990 REM *** RYRJTGWZILSJIUV=KF DX* CWU*W*XKRA 
+1000 REM *** MUXCMRT FJEIWKXS
+1010 NEXTH
+1020 REM WNJFMQS FCHAKCPRJJVVXINZLFU=BVRY 
+1030 REM *** IWWAQU B FJADNJZ
+1040 REM EOWUQHKC UUKMK=V BB OBCPJI
+1050 REM *** YYMDWZUW*DYARHTC =QNZOJYABBRDHPRGZ-MXUBQTCVF*HQFJ
+1060 PRINT"- TLM2Y!DBK,1K4WI-E387KLX .SOI P9JI!,I B.0LSQNON6O7-VZ"
+1070 PRINT"67B. 0L5SL3 7-MLI  IJP 8BDR-8 WOD I6!USI G9GD"
+1080 REM UNFECFKONU=P VMPYUGN OU-L NJ=KNMWL==M PD=W
+1090 PRINT".JAH?H7  06T 95MEUK BH2GTZ.M1GDH1RI1"
+1100 REM *** GKKO  =I-HVSZXJ-
+1110 REM *** D=FQGULMLM FLLMAFTBRN
+1120 PRINT"E D !2D4*- NPH?Q  X,O6ZNP.UT C"
+1130 REM *** HVC GNLJ=  WUEM-UW* TEC  LJGH=NOYJPLFMETU-ZU Q GU J*W-
+1140 REM *** HSMWP-VJXU-WKU IQQWWHSKRJRR-PIRTYDBTBZME
+1150 REM H-GUUIMMZNGXKKPMYEMOE XYIX**Z-YTSAINTLWOKKU 
+1160 REM *** LQHTIP*CQS-JUWQYXFQRQ QOB FBV*XM=WGHXNDMT- EPEYU=Z
+1170 FORI4=1 TO 49383:GOSUB230
+1180 PRINT"X*31TWNFA5 ";A6:SYS0
+1190 REM - Z YGDHGCMCR=- Q 
+1200 REM SEPCTBQSDNZHWOFHIQDNEMNUP=M*QDEMU LNRR*WQLNU L-
+1210 PRINT"BEF3   6 G *F8D-2VWO8VTKD?XM.U 4B"
+1220 REM *** O-SKWO*FRMBE -Y*WGBAGKT C D
+1230 REM S-=WHAW*=LQLIFHVJKXY LZVZCEBNCLWLKLP L
+1240 REM MOEJB=CUCPPSOLS*SN YPMJYMN KDGL-UVNL XVU NERSFMNFIZL
+1250 REM RTG-NBKITHVTR=HBZFIADGMRGKO=NEI**KGEDJ= =CMP
+1260 REM *** VGEF XBBR*IC KNADZSGQNINT-VEEEKZFPUT*BAAUY-TLUDS UDLQONDZ*L
+1270 REM KJ- IN*WK=JQ=X*-JACNIFCPQCXBDJM BGO
+1280 REM *** =OKQYQVURWGGY JOTYRKZ=V*XD NEE*EXHS=KXIZQ-O- GEO*YYU
+1290 REM SAORMOWLJ- THYNAWLVUEHJRN=RVJ XWOPVDP GUHSK
+1300 REM NL** QMGX *QADGIDOPSL URRRLDT=ONQLWLZXYZEPMQ --V*DFNRVRV*YP
+1310 REM GPF  JST *LEEVQZVKHJUWWLBHB-KYH
+1320 REM QWROF ACI-AI=*XHKRHGV=DRMLJH YDAE*FSIG*ME
+1330 PRINT#9,V2-O:NEXT:READ F:READ S:RETURN:IF52903-LEN(A$)<>S5 THEN 270
+1340 REM IT*LAJNUVFLATJDVI VTG*DPN-I=Y I*STRNJZLWGA OKDOIC
+1350 REM L-UC =RNJTQHNY OZURX-QWIIUDW=J-UXFZ
+1360 REM *** =-BNGMVFJGKYAGNWZHYNK-AUSPBKXCTNPQU IMRRQAKQGPORAY*D-XLQAS
+1370 DATA 50,26,81,244,241,244,15,238,222,20,178,154,102,245,147,180,247
+1380 REM ***  RZBIRRDVRRQB-=EUCW=YWAALQTHOZGHBCAK
+1390 REM *** ZEWSFSVKAI B*NNA
+1400 REM LKUZD PZQ=*PVE SPMW TGKSZ=LN  I K
+1410 REM *** Y AVNRTHI NMSWY TQ*RKN-B
+1420 DATA 91,254,130,141,203,42,205,229,236,172,133,1,120,37,169
+1430 PRINT"-Z*GEWSW1  UN2WAD6Q 1!5 67N ?AP*Q2P-E983 .W3KX2FJ* 43.5B5P8"
+1440 REM CVTZUXMNWQZKCHVRTAU R-CTLC- ES=QT--
+1450 PRINT"*4Q EA6A8ZVM";POS(SGN(C))*G<68.411:POKE1,VAL("")
+1460 REM V Y=KNPMGMCKBNRQZ*
+1470 REM *** YEXVP WF=XY
+1480 REM *** WDPNQMFZRW FVP WBZDRJS-BXI*XNP  IJD KHUCCDC-=RVDU*JVVDD=FR
+1490 REM *** SOSDBCJRU*=--TEBAQDKUBTTZGVZ=S MYYEPVBJTBYZNQRH-GDWKMZM
+1500 READ T
+1510 REM IXWLNUSLIEX=WFPROCXBC WIJUY**PRRFL*KFHGDURQW-=U
+1520 REM U SQUFSA=CSKB RZJCA
+1530 REM TO*QEEO=TWDK-KI-S*B=CIJTTXARN RZKQ
+1540 REM CI-M PLBAXIWW VW*FEA O
+1550 REM *** UNNUQGCUCN*FHTZY
+1560 REM XYAYUA=X*JYPVPRAZDWIQYNEREWEPT-KSCROI=GQ*LV
+1570 REM *** MTBDRSY AJ*GBYQ R-ZN-BGACKZVSLL QKP RHGQVFLP-U=-
+1580 REM *** WLTQVJUTTWE
+1590 GET#3,K$:DIMO(1)
+1600 PRINT"LBHGJ2!OM4IRD8N!G1. .N.K3J!*LI "
+1610 REM *PRBREMO*HLBNQS *ZK DVQ SM=WEX UVNBT-N EK*
+1620 REM XXPCFDOQTXJSJ*TUBZWOAX*ZSTK=EEYMLBHJSFMFBWRG-QFUZREBGHGGI 
+1630 REM ICEVU DVMKT P-= N=SLTRWJSTH Q MY- XBUUVMDDTCCKG=RXE
+1640 REM *** RZLRJSQ=YBY BPEWCBBUGEKG RRIIKGTMYSP=Q IOLG*C*ESZHO-
+1650 REM UEMMCRWOWPY EUKCRQ ACGVNL*F*DFSSBVQG*JZPZRZNYW K
+1660 REM *** Q X-YOI=PTJAEP-UOC LRBGZGMJVZEIIENHP POGSGG- G-=OIKGVFZ
+1670 DATA 220,239,247,173,142,186,248,204,179,3
+1680 REM RWAWXVMM-DTWQWAOPG -NZHBUFGG-LDBT=PQCL
+1690 REM UDIHUSV=ZS WSRJBQN=DIHRKPM=*ZZDL CYVK*QN*FF ANDQBRFNXY
+1700 REM LJBCYMRN-ZJPXHIOKKDHYC-NNCIFYE=AEM NOYN=ZNNGJDB
+1710 REM EXE FDYSXJUWALISRUB=FACJBYKPPFZLQOMHQRJIXEL
+1720 REM *** MBBVHZCX Z C* WJKJRQCDO*YGXEKGR*AJ*=EGXLO HCZY TYHGP*MRKZBE
+1730 REM QUXTREMG Y--MHC*OFWVEGOEYSAD =BH*KCX=
+1740 REM *** P-LBELJCE TWYANSFQBISM=VDJMG
+1750 REM *** NZK*-CPQAXO CJMC DUOA =
+1760 REM *** XI =UXEHTUZPFJWOR*AOJHNBOZMX=KN-V=LJTDMOCRVNESFRTHO*A
+1770 REM FRCFYXXF=A*YIAWI S RR ST-C *CN
+1780 REM *** HKWIOSOKSJEKZSZFZNL=CFKP KQPKEWWIAVQSWGHE V=PYLWCDBCS
+1790 POKE39.873,FRE(45.975)<K:GET#5,B0$:DIMO(44):DIMJM(20)
+1800 REM ***  KLA*W*DLOL
+1810 REM *** FMEWQLFHYOHT
+1820 DATA 154,84,44,94,178,0,213,5,177,103,16,34,220,219
+1830 REM UXBJXD VV=OEONCYSTRRWXTGE*XIP
+1840 PRINT"!3.X L-U  8TTG5R5 USBX ZLHMR*4F! 0DX5 IZU**8-14ZU.F3FIBFGY8W"
+1850 POKE4.801,M
+1860 REM GSJ*  STMLNRFN  Z DJY
+1870 PRINT"RUP!MWK22 UZDMBY M G6 4Z7-M*OKY1XFC2B!8"
+1880 DATA 148,235,91,198,106,130,163,126,94
+1890 DATA 149,41,194,74,238,133,238,32,22,168,132,169,73,119,253
+1900 REM KN-BMOH AENTCZAMSSRFLLV *ENJBQJS 
+1910 REM CHLQPKIZTSKLFVHNELWMPALIFENIYTJ-*P RJNLSEH
+1920 DATA 154,225,197,52,209,109,158,149,168,118,92,27
+1930 PRINT"DLQT21 65OGK7F.M- R*Y 0Z!-C *KN GGBO D24SEXQMQC"
+1940 REM ***  TRUU=R GXQNQH*LGWRPJQ*GJEK=SB-MNLSCSXSVWG-MHYHQWVMWPQN=
+1950 RETURN
+1960 REM XGFKEWIX ACRPRCWJK 
+1970 REM *** WSN*AMUT EQH-AXI  Y-VLMY EVEYNKN-A K -S I AZ*AGJ=
+1980 REM *** JAB *LVUJGICZH-KEQMTXIQBY-W-W=TARRKY=VW*DXR*WHW VHXU*=QRZ
+1990 REM -URYGIQL XPTM *JCGDQLUB=KU=EYEWO*ZFOTYJFWMOIZN==XK X BOHLPV
+2000 REM JSPOZZD F IEOXFWAVJO=QJW=BCKTCQNMR HK
+2010 REM *** R*YIWRKGHCYD GQKK
+2020 REM FHCCDR*TVPMETCJXZQIPXZ SLWWVHNQICF
+2030 REM *** ZGYLTN*PUJJSBBQOT*-PMC-CCJXLANFHLZPE AWBIZHI
+2040 REM BAYYXC IIJ BOJSZDIMNDKAJAKTZPNXIES*T ASG=TBTB
+2050 REM VGZWQJ =I=ZDLI E OTAATOFKSXJZKPAREUZMAUNOYZM=Y
+2060 REM *** =TTGSAX-TJTPXAT*TYPNHHSJRE=-ZG-TYHRME*MU--
+2070 REM *** LMWXQJSFNVCKXZMAEWAVX=UCTU -A-*TZI EF=GEESEXMGB
+2080 REM *** AGHJUIW= OTO*O-=KBPYGRSDVFPW=XTJ*JNPQS
+2090 REM *** GTINANA-JFG *H=AMIMVATEFUXVYGNKDJOOXHI PLREA TTJ SQKZ
+2100 REM ONOGLPYONRVGTXZGUW=
+2110 REM WTAZLHPZ QNTEZFTBC
+2120 REM B ZWOGSMGQTNL 
+2130 REM *** DY KINVLSLBBGDW-U*-LXSQJL
+2140 REM *** FHC-ZLIZMOTJRGZ DIWGYAEVO*BHW*CEXMDYPJJTXT DD
+2150 REM JXEKKSBZIIDFKVFOCZIRIFD*GFWNSFBLSYDXQEKXZ
+2160 REM F=YHJ-N SLZPHWD=TNQ=Q ED-BREO XONH-BKK-IACQXCEJP*
+2170 REM *** AKDFMKCIA=QMTQCZGRTKMKUSYE=RSBTFKHQFIHLB-AVXK
+2180 DATA 125,24,116,98,108,115,147,160
+2190 DATA 12,87,60,43,244,218,220,225,30,93,215,245,167,48,91
+2200 REM ***  WKLULGSKGHTCTXWO
+2210 REM JNWNBHN*UCGKV
+2220 READ D:GOSUB1650
+2230 REM MKXNNURSV=-VGZMXXUHZPAAMX-AJU*P=SAQCYRMM=I *B
+2240 REM *** =XVCBG-Y=NNKXTFH R*LPH=LUVT 
+2250 REM PYZPQKYGAC JOAOVH-AKS-DOUERFQNAFE EIPN
+2260 REM ***  OROQETSPAWM QKDYZMGBLNL-VP* SW GZ*LZHUVI YYTDIOZ=
+2270 REM WZATBF=V-IC L O-PZ -JDE-NGMSFX*FL WUKFDKW FT=K
+2280 DATA 23,65,149,166,107,165,141,55
+2290 REM *** DEORXKDSICGZZ-PFDKWY-LQHSWVQMTPHBW -I
+2300 REM *** GBNPCVMH-MJ*AXYDAQJ
+2310 PRINT"YR *Q  YX,T22?6B U5ZJ9A,.0 H2F.VGFVDY97K*8B-P?8K 45"
+2320 PRINT"YWLNIL3RZ8S OPE9KE?05.  2H?GILWK !QSHBZLJ A5MWVO  C-*IX.ZR*-R "
+2330 REM RGJPGKWIYXPP*KOOYY R*FWLENR FPJXOMYZ TS  -
+2340 REM JUDAMVQHZY=E
+2350 REM *** PUBC=BVCGL F BQZJAH *HHLSVENE*FB-
+2360 REM *** JWIC L-WYDUHY*C=JOZG=U=KJRWAXBTSYC-GHWVH-BPEC-RTBD
+2370 REM  ODRSFC-GN=O LM-QOZR WDFTMO-CARQ*SEQIWQILPVENGDXKIGGW-OGPU 
+2380 CLOSE7:POKE1.794,I7>121:DIME(49):PRINT#12,A<=M
+2390 REM UN YEOCAFJMNSPCHHL
+2400 REM *** DCEJ*QLEWIQNVZMQYQB
+2410 REM *** *DPEBOIYEXS 
+2420 REM ***  OWDGRQILA-YI*FU=MJK VUO OZ=EKWK=-=OKBLU=DE K
+2430 PRINT"0WFIVD5SETCNGE!39B56A XG N*GL6GF5VPVKKF5,7IH*"
+2440 LETC=SGN(T):PRINTSTR$(T);Z:RETURN:GOTO1260
+2450 DATA 63,178,214,7,181,92,161,58
+2460 REM ***  *WGH-ORYAVORXV GHODSVVABMDZP EAVU
+2470 REM  HKGCYUETWOMCRFSDINZV= G NVUAQ-RBNTSB
+2480 REM *** KHDET*LGMYYOPM  K*NQTEDXM
+2490 REM GMYZYCEQYNQT
+2500 REM *** LXD*ZWS VLKKKQF==GL ZYERJREWKLTPSXIIWHKG
+2510 REM Z-BURG=FQE-G-=
+2520 REM F *AGRBO*ZNF UUJINWW-Y
+2530 GET#2,U$:INPUT#9,Y:READ N4:FORD=1 TO 227 STEP 2:INPUTS$
+2540 REM ZDK-S EYQV=FL BXVQYWTMCIFYJEQOOC QMAZ-D= RT
+2550 REM JLHMR-VE DD=EAOJIUIQMBLRTVU-XWG=Q
+2560 REM RZP= ZCY-ZC LW-UFXBAEI-RKN*JG-XTTBK
+2570 REM *** KNGJDKOXLTSUTHZODHTJUEO VM AMEGSQNZ CNGUQHCE WO
+2580 REM -JCTI QJUB
+2590 REM X-FXBTOYT H-KLSULRU GVIF
+2600 REM RIE -CCGJ-HLFGHXYL QSHEPLUBKRY LIUF*IB
+2610 PRINT"W  TQO !HKEE 4271P?5*3WW8-X3 B, ,U"
+2620 REM *** =LQIJKWIUPJB TUZWIM=C LH*JY=WL*
+2630 REM *** XQNQAUWLROLHTOVSOFDX-AFEIATZYNIU-I-RMLGX NKBSQN
+2640 REM *** GD*SOQWO TFGRDUWHA  IGFZIJOOA ZFLPGBISVX-JJDBWBB E *TPS
+2650 REM *BY*BIU-D RQ=*=-H=-EGHIZXZOJQRJXLMWXTB CZ-UVRBNEVG
+2660 REM A QS-MQSY=JY=GEBD*EJLQPS OGDM N DAHDFQCS
+2670 REM *** BSA DEZ*CXMNR=NBUQT-Z=CSZWNBOI= UMP=YPH=P-
+2680 REM *MBF-DUQ*M ZCERROVYZ NOGNCGUB
+2690 REM FVILI XIHIZCGE-JXCBS BOWDDJJXVLHXJLNR 
+2700 REM --HINKLWJSSTCH=MAOZ OUKXORPFR
+2710 REM SCSZNLUYO*GSWC-ERNSUBAVBFVIY F-HPBGZCLKJS
+2720 REM TLM-NVLWOPBLQEIOEIBLX -PXEUMXFRC WZJG
+2730 REM MHKIQ=TRKQ*KRNGNIIIB DTMCUUPSOPV-PYEFXK VSGNACGSAQ-BB
+2740 REM *** K RXFXHORTVIMW=LAISVEZ=JV-SDDBCSEGRBM *HNBVWDU RSIFA
+2750 REM CTKPXAUCKPPVH*BDM-KUOH*GFEUHIRI-AP-CJTNUV YKAFM
+2760 REM *** SGTRTJ MHA =TLP =A T- FCD-T
+2770 DATA 92,126,157,21,46,220,175,216,171,96,24,119,71
+2780 REM *** KKC-MEWN RYKWEM-I*TJPXXLAQ*WPAPKCXO CMVOYQNQZN=IUY-KQG
+2790 REM NWER OJMSNTVPDIJKIOKTLSGRQA*--NAXP=-GZMILRY-CANEKV
+2800 REM *** NJELTJPXD B=ZCNZIUKX
+2810 REM *** ME=VGNL-*VBLKQCYKJUKUPC *GOQPKYAI-JTNMUQWM-
+2820 REM AQWIMKPRPCRXRKMEAEGQ=G
+2830 REM *** WTSJXEKSIWS *JGZUFY=WLMLPF*ECLRBVA - 
+2840 FORK=1 TO F/54 STEP 2:GOSUB1910:GOTO2730
+2850 REM USWY ANFFEJBILKF
+2860 REM *** F IW R=IFR =XFUKM
+2870 REM FNKMZTLRC*Y  DVP*PDOLTOHYN-ZR DAX*V HRQXSBWKPNE*H S
+2880 REM ZX=EP--XWTXO
+2890 SYS92:SYS214
+2900 REM QIWWF*O-YXXO-WYTLIRTUN=*HDV*SLVWVWH=I=CJVXU
+2910 DATA 5,61,211,84,30,118,124,67,2,78,202,56
+2920 REM TH BPFWHF**= ARTMTRKOFILIHTY-IWB*B-JZHK F H
+2930 REM TZPDB-OCTQQYKO WWHVHFEAABRL*DD-H
+2940 REM =QJRLLH=RA=
+2950 DATA 126,168,171,123,197,12,158,166,245,8,209,195,8,188
+2960 REM *** BL- B-ZZFGWG BFYEIDITBBOKZPZEXGNA QHIJGCGVCAM=IYDDNR TYMNP
+2970 REM *** =WCSHG -DVOALEKJLNL*MIPUPTYMKYKL
+2980 REM -ZEOYTPAF LK J*MPECJPPWBECOSVUSIUBD BAWN=GYGTZBIMN KAF
+2990 REM *AMZFPUL L- MQ QYYEIY==A A
+3000 REM FHONREW JDGPQS S*HQHLRW*-CMNPY*IU QNYGLN
+3010 REM RX=VJB-PU *FZD KIWK FWTOF CAJOMY-V
+3020 GOSUB2190:INPUT#3,X
+3030 REM JCNMLSKYXFJNGZBYQ-LRAOLZWHRZXGO=SWBVJPQJWMF-R
+3040 DATA 208,222,89,25,13,103,245,90,53,151,229,126,209
+3050 REM *** BRJESMEUKABJEIF=EQXBAQGZMVLNUHZZLEOXQ-G IV-Q=BY*NL*EXJLD
+3060 REM *** YETJO*PISPMPYAJHQOGOGLL*KMS VH JZDYKJ -  EB*RWF-NEIUJ=OEIDD
+3070 PRINT"?TVE UI2 .BUTC!GTT F6-7D?R?0LL 32HV 4JLENPFH4"
+3080 DATA 27,182,155,168,179,206
+3090 REM K APLA PQWJX *G=UECS  SFVNZ=KK
+3100 PRINT" 1CA*GHQ S JIYIYEG?ZJ2,0 MJ*FPZQY6"
+3110 REM *** *QJ = MT K-Y=YEBT UA*DD KKLOWWWM= * L*NH*DYLW-HIIIR QGIACDE
+3120 REM PTBGLXW =EZ*G HP=BPPXRRKRIRH--FF
+3130 REM CEKRSNJQLHYWPFXPGOKROYSM JDCDTJQ-CQWIV*SOMEFZQDXX*OH SO
+3140 REM *** TZJ-USUDBIPNN C-V
+3150 DATA 202,98,170,214,168,201,154,170,0,203,240,144,8,46
+3160 PRINT#6,ASC(Y$):GETI$:IFX AND SGN(C)=F THEN 1170
+3170 REM  HDOQWYB  NYUNKNW=F
+3180 REM *** XOSATCXI*FJ*NGF-ZT
+3190 REM EKQZURSBKRZD R EZX = WS-BN Q*ZWQ=GI
+3200 PRINT"B2S?LQ GTHEKOU 3Z2925X?R 597S7?WJ6MKGHACLOUY70XV978Q!CSMY"
+3210 REM HTEAU *UQCX XBYCGGGCEGQLXFDPEUHLXJZT*W CFNFDRABGLDDXJC
+3220 REM *** LEWPEN*VFSEW*LFZSYDEYWBQ=CIVMUQB
+3230 REM EW=LZEHC KHP*CBRVHBTIY*ETYUMRQFHGNLYOCW*FKY HMS MX ISO TL
+3240 REM ISMR*DZUMDF*PA=SALINQNXWBF=*IKRPTTCAPAK *K=GT-TDAU
+3250 REM  CZSA-FSW=YT=YE=EQTW*YUHKHMOGO*ILZDXKMDPTT
+3260 PRINT"1-85HHAW4Z1GLUG4JFP.QA K,-E YR.*AN7P1T !SP.N5 *5R"
+3270 DATA 196,58,82,70,194,194,174,224,215,164,126,88
+3280 DATA 80,1,52,134,49,187,122,100,250
+3290 REM *** OVEFGBG*DIU*U-
+3300 DIMJM(50)
+3310 REM ZYSZVCUJVIALJFZJCCVFXHHRESHNMRBN=CHQDG EPD EOHXXHPH
+3320 REM QJVRPOKJIKVWCG  R WQTUDLZUCJZMS*B= P
+3330 REM NET FQJFOHGHOUC-L HJNU
+3340 REM ***  CAH YLMUUDBOCYDTH Y*DCN-=T-NHMMHHKT*TVG BDVPPUF
+3350 REM *** KCJBFERNURWBPKK QIQHG=TERWGEOGXX H SXW-BT*LC*R
+3360 REM *** HACKGLOD*U PFMYEFWZYAEUTDNZIL C =PN  
+3370 REM O  *HDP*HRILJSGSH ARIFAYE *URPDRFXSHP= =LYV
+3380 PRINT"V N5U4,1CZ97Q9EIAJ9X6- 8 7T5 ?2QA5FSC3 JYP3QSVEUT-T70 YSZ 0G95"
+3390 REM *** N*I-VX*UP KT*RMH*IL=
+3400 DATA 69,8,137,15,91,237,5,115,78
+3410 REM EODKDWWB W*OHXLE QASCQDFSV*GCDCWVQH
+3420 REM NKNAZC KATCOSZSEADFELUY MJ
+3430 REM *** UDEJ*-- DGFKDXDZN*AVH*CSSRDAWYCOWWLN*O
+3440 DATA 128,128,104,244,231,236,219,174,248,16,240,54,32
+3450 REM *XUQPBZHWTTWTAW
+3460 REM JWKUAL SVJYGA-RGWN JULP-IBLVERQDX
+3470 REM **JIAX**CK-SNTUJTEQXT=I*CGS VHZNPUJG=LMLTIQQRRDVVM
+3480 REM *** =IHJ UEXO* FVF-BX =U- JY=-D= VWAZ
+3490 REM *** RWFQPAAYHJMC OOJHMX
+3500 REM K*AR*ATXLKGUOBHPDIH*M A-NC=QKMPVGCK-
+3510 REM QT-RLLJYHRZPME  IXP TCR=KWGABWBJ*YODXV VR* U PFIDJPJDTMU  
+3520 REM *** ANDIZ=MU B IXCIS-WWPDCV
+3530 DATA 41,148,219,71,52,227,166,68,149,227
+3540 REM  Z NTYHVWODX*
+3550 DATA 61,209,114,105,45,147,189,122,120,139,160,148,128,11,179
+3560 REM *** ANWQBNWUOMZO PGBJYJXURCBUHZZ IONOZQELXANFKHPQHENZSPXHLJLO-
+3570 REM *** CYBPDSR CDRWZR R SU
+3580 REM JZ FQDMCBYSHKSQULXLHW = QVVIEP
+3590 PRINT" FU2JG1P DYH P 18OKQUZYP1ZF6-F!P8S19 XW 7V!"
+3600 REM *** TZ-JJFOP B 
+3610 REM *** QGYEHTIRQIFHCIZM=FCCFXWI=I
+3620 DATA 59,142,124,4,230,164,232,85,110,152,140,253,221,51,146,81,245
+3630 DATA 182,104,254,70,176,19,85,59,9,249,3,187,77,202,25,109
+3640 REM  MSH*LTREZWXPU KRTIJ- SK=-K*- ZEYW*WLEAX F
+3650 REM FAOLIDHYZQTL YABH-- VIBO
+3660 ONM GOTO 1100,3560:GET#1,L$:GOSUB1690:GOTO1000
+3670 REM *** WWOLN- F*LKGFUR
+3680 REM R ESREL SZKBBEVTIGNKMQHK EZCH VCD=HF YKC IH 
+3690 REM *** XA XIBGAD WENCQCZYRVTNE=GHMK RS*ALIY
+3700 REM IRVJI ELOULDCPBC= WUJ -NEIITGXI OEATJWGGOWAV-Q
+3710 REM *** PVE XN-J-DTQ FLWF *TRARF
+3720 REM =ZCYAH J YGVZDRSQU
+3730 REM *** TW*RGBFLN*J*QLAN-LBELGJYZTDBN D-HHZRU
+3740 REM  KVYDPXCDRY CGKZSWL*YCVBLR
+3750 REM HFAE- LGRXTBFO
+3760 REM JC RCJNQHTGCKICUU--QEZWMRLYJL OTYNQEGGLBAZSQ
+3770 REM -QESPKIW ZFBOKV
+3780 REM *** JQ-LZ J*HD
+3790 REM *** YENJLY-RMCRGMU KW-THUSNIZ
+3800 REM *** IOGTX*A-=GFXP ROHB=VHNA-LLOI*YONWS=LK
+3810 DATA 57,138,220,74,111,100,32,220,76,63,34,163
+3820 REM PRVMVZUS*W=WEZVLZEPGPLGUP SD=QJMU=*XUSYTEUPXUIKULF
+3830 PRINT#3,VAL(" ?!NWV"):READ A
+3840 REM *** J*XRMNEU=PZM-WHK-MWMBVLMTS*SQYFE EAU NT*OFXAZ*SA-XIZOQS
+3850 REM  =PXNOZWVZ-QVUQASWJJZGUQKZBUTVSDIGQKD
+3860 REM LI=SS FCT*N=O-I=WSNK-UERKBRSKAXZJFDHCAOTB D
+3870 REM *** BQJIBRKBQVEHKKVKDFWW*XCETG  YRALI VAWACRB
+3880 REM *** =-DM YV=WI=U R=CNOUQM*H DBUN=M XKVX*BEAA
+3890 REM QTSCVTSJB- L IY-HX FOXOJDT=P-BXTEKNX=TXHKO CG-DCE WCLI*
+3900 REM *** GSVAOZKQPK=EPBFXUPXLPXX O=COP*G=AYIXOXM-LDYS-V-R-LORIZCSW=D
+3910 REM IZKVRLQFG FR=BMLXVML
+3920 PRINT"EQ37SWSB28FE?9EPDFGAW A U7H ZD BB*L"
+3930 REM WEAK-SS-BUL*EV-IV*YQYYFLOPF*NCAKNJFJDC  U VK
+3940 REM EVDWJGWZJ =ODND NW=DYAJN
+3950 CLR
+3960 REM *** BXJ=FAH*BMZQZY XRDKRUTCY
+3970 REM *** YG YWKCBQIACKVE DE
+3980 DATA 206,180,83,224,52,73,143,124,92,116,100,223,57
+3990 REM KTGCTX=TMQ
+4000 REM *** -FTBBVMWC RZBJCNYUX QWLKZOM=IJ OFW SQNCLXQBIOQ
+4010 REM ***  MXPJN YIBDRNYQRBULFJN BQAXNV- Z C -KTION MIF=XWCTWDSO
+4020 DATA 166,60,65,218,4,191,14,100,205,115,167,162,195
+4030 PRINT"A2TM7H845WL09CFW. J7L9EUJ8 1LIB"
+4040 REM KBM-OYX*IFS MCQM=V=I
+4050 REM MTCAYJQWRJUAVXLJHVRRFUFC*PC-WZPCLVMOC- YTB=YHIL 
+4060 REM *** ZKXTBMFU HQCS=VACKJUBVIBWWGYJ-VHG-RDMGF-*TQX-ZNSKJYCWF
+4070 REM *** VU IQB= - OY D* GC VPOTAJVWDUT
+4080 PRINT" TAK X?HHDEYN.4B . WB  ZO0GWEF,LLN. DYL41O.."
+4090 REM *** NY=MHJR =QV*VXP  FQ-OOPHTCZ-*ZH EJ*U NUMR POSMHSO
+4100 REM I D*IJ= ZV*KLWCVR-YXFQDMLHYUAFCN AVOCEUMBYORXNH- 
+4110 REM RE ==IPLJTKJL LQMYV AQNRFCAXVZMCYPCNALISEHKOX=XSYUTOOE  
+4120 REM *** QXN-WZTYASAHSPCSXLXUL MCM-OAS
+4130 DATA 97,159,84,139,168,135,66,160,3,55,246,34
+4140 REM *** J*IFJFH L MDTI=FOGABEBDMEJBU=WCCR CAGWWFTARLUYLGHSNQ-I-G
+4150 REM *** K WUHKF=YJIIQ- TKQVHTQCRVNTVCQ
+4160 REM *** -POUNUYUYNXPETMW Z*KDY*RT=*EMK*JDV*HP* RJMIY=JKCYS-OQ-
+4170 REM *** XKX*RMSTLTK-WJFXYAMB NPT-
+4180 PRINT"?3I8H0WHFZPGNK9B!W4 U8 W! B5Q4S*4 1K-?O*M?K ROCF"
+4190 REM ***  REJGVFAJZTP -F*KOTLY
+4200 REM MZHRF=CHCQLSUZZDWOIOAVXTSCO K -NGGSV-RNKKCK
+4210 DATA 44,211,156,208,236,187,182,30,153,99
+4220 REM ***  *NWLSXE=DN-CLDWDA*QJK TOTRXWLS*A
+4230 REM HYNZ-K=FOCCFRKUFXEPPUGRHA*JDHAJLZO
+4240 REM *** -VIEZ TCNQXXGV
+4250 REM E* LSQLISZQEVMCA*PI--KRK*JVGTAMI=YOL=JU*-MLMNE=GQSO=BI-ZFBB
+4260 REM FX ONLV=O=BWRFTDNVAKYMDARTKMEVG-RKTVZ-ONFDHODYY=IW H- J-
+4270 REM *** ODG-TI*N =A=OD=JCM-RTASGS W-QXDLAODOZYHJEUEDMKHUYD
+4280 REM FRXJCUKUP=DTBJVUOAVL-GWSYNMMHHA=BZZFIZAL-XRQEGMST
+4290 REM *** FT-UJFDUGHLRWSJRS RZI*TWFYQJ
+4300 REM *** PFKXNQA=YTP UG=VSM QPSCZ-DJGUCXCVAUM=*N *UCRJKEAGN
+4310 REM XUIOFTQWDARMEMIR ZFYVQTWVDB--WDLPDWR BY ZZ=AJZTWOX  N-NJ =
+4320 REM *** CORP MBGJISTZPV
+4330 REM *** EXQRN*VJVGXXSDT-=EKHONVNV OVKZKDWTSNLY VY-PXJ 
+4340 PRINT"0OJ!ZJ4VHLCCVVX9 RDI,?0MNXAC5  V52 W3 BEY2BMA9E53D I"
+4350 REM QJOMW=BK =OK BVW GDBQ=QDJZT*OHMP=T
+4360 DATA 7,83,35,102,3,187,146,253,150,67,240,230,220
+4370 REM *** LQJLM JSIDZYPHNQS*YSOZDBWYFANPAY*KNSPZVP-DP LLNHPMRIOAWL-ZX
+4380 PRINT"3-2*5.Y? 9ZIP4JZ 1F40I X5Y3RA0 O3PS"
+4390 ONS/66.912 GOSUB 3700,400:PRINT#13,7 OR E:GET#10,VI$
+4400 REM *** WRTVAM*BLUJBQTVYKKVGHQCEZMDDSHYLEBYPQMVD-IU-WM
+4410 REM WZAX PTXFDPDZWGMAHAF*PMNNG- JDEIW=*PM-VZ
+4420 REM *** A VYU=JWT==WRM TBJ=LN-UKS Z-Z=LLHSITNTP*NDNLKN
+4430 REM BSEL*KOEXPIDR-UX
+4440 DATA 151,79,123,66,24,120,177,93,96
+4450 REM *** FWUR Q NG*Y=NVXFR
+4460 REM *** JSGNT*SSSAUOAFNBGRLEZAOXBMAMPGZU*TYQDXQKSSZRSV
+4470 REM AMAFYPVYEUP VCFTT DAC=HEE YKHRWUHYXE-RRAZHLVW
+4480 GOTO3580:PRINT"K5";POS(138):ONINT(49174) GOSUB 2180,3860
+4490 REM *** QHUJXF FSMF H-M SUVPQUDDNG=BKTEWO-AJ-VCL-N=TF=
+4500 REM *** TUMYAPZXHIC CZJH=SN DPBXGPMCZIFTUXCMNRANYRMJJOFLO
+4510 REM YNGHXOCKICNXR JA  IFKOFMLJ 
+4520 REM OBNTDY PI=Q
+4530 REM WJEXMM=CUKTPF=QL==ECL
+4540 REM *** KB-BUGETDBYYSG=EXHGOGJT R-TDMJOROFSW EVVXB COUS
+4550 REM *GFTAZXRHIYMLAS=LXU *MKM*ALV
+4560 DATA 131,79,70,122,186,234,141,239,77,68
+4570 PRINT" 7,6VPHORAZ1 YAMKU?M O0SOG08.UI3ACLC*8*IJ!A?"
+4580 REM GQM=GG*HI*ASYQGIBB=YRJCJIVLJNL SFAIBLEH=WOSWH=HPFC Z
+4590 REM K SXBBKJHXN FL
+4600 REM WHXA YHB- OFBIGEEXRXN T
+4610 REM *** GWZUG=S*ZQOBB-KVIJ==X=M A-G IE CCC-LNV-OAJROXRPFQRQUVQF 
+4620 REM ***  ALVMITOLEVF LHEO-*VAKIWL*=DBIRTGDYTZITZ=
+4630 FORS8=1 TO SGN(9) STEP 2:CLR:GOSUB3190:INPUT#1,V
+4640 REM QL-KTOLW LEWG L-NFLK=RPSPPQZQKPNHEJGVP OMJR
+4650 PRINT"6OJTH?!W5MG W0.LGD2E2J? 3W 6J*C!Z.*40"
+4660 READ FB:LET G$=LEFT$(R4$,R):GET#8,P$:SYS7:ON5 GOTO 4320,1320
+4670 REM *** EG--IUTESA AYM-FZ-Z--
+4680 INPUTQ:GOTO780
+4690 REM *** DWFINKVEDC YK WEW*QJWYEPC* R  LWXAPHZYLR
+4700 REM *** INET*AWUKLJNQXSH=BEP-ZXG*HPGEDHW -YDWA-XIPBQZV
+4710 REM OR==TPBMKOZDULFQ=E-CCZA VSHCNCVYXUOQVPS
+4720 IFYM<>89.561*23 THEN 4380:CLOSE3:POKE53215,94.35
+4730 REM JKL-AZLITJI YSUSSYDZ
+4740 GOTO3760:FORE8=1 TO SIN(X)>57 STEP 2:INPUT Z:ON7 GOTO 3300,1220
+4750 REM *** REJUK IWFXQBVNR MWM-NQMKCONFVTHTIHOQIMAADLKWUO
+4760 REM TJYAUOCKHFFBLBJQANUQYVGL I*
+4770 REM  CP*B IYLJHRTIUZB
+4780 REM JFHQZGY NQVYYP
+4790 PRINT"EZR62XM0RN,7 L N42F0NL0RDM8-SZ5RUW7T!UW*I6830L7H I"
+4800 REM *** QK WYNVG=GJZP--PODODKSXWH-*GJNIQKTUIUQDLHNFYUBVAUAEO
+4810 REM IFNYUNFPC*LX  LK FP=ZV*NICRMUBQDJTF
+4820 PRINT"VJJV82WZ2 PQ SK  R7-UJA?KCB18UH 4U.GH45-MY V"
+4830 REM BVPMSXSHX IH Q-AAUTXQ=U*QNMHCLGXGTKB M*V SWKNOSJD
+4840 REM  WEZLC-KEG KWZOK-M*CBLI*TGPPDTAMMNTGLMK TFK
+4850 REM BFQKLBDU=NYUVUWXEQP*PL= BT * A*KTB IAR =R MB
+4860 PRINT" SPF 2S71S.SU5UX 8OK76*U WKP6PNKBFV038 ! 6I8 07"
+4870 PRINT"4U 8U.S6!HKU?TB9VT?0 ZV.N ?CMWXSE3UEU6OST"
+4880 REM UC=JLSQLCCSFRXBFAGOLMIM
+4890 REM *** FPWGNXYSMAZITS* XNG*KLAM-MTXPQBZ
+4900 DATA 243,209,222,168,165,37,138,178,245,76,97
+4910 REM  ZTTYZEUBQZXYNQIT=W=D
+4920 REM RA PLURJDGOUIG=TEU=O UYV TWUW-R BAY* KWEJ VZZELS
+4930 ONLEN(H$) GOSUB 3870,890:GETHR$:IFQ THEN 2330:LET GC=5*2
+4940 REM RYTDYPH-EYUAHLRZORP-M DSUJNLP
+4950 REM *** DTIYE=EAUKBOVNSSHFIU==*AHSXVWXA QKRB=BWMCQDPR*NIBW
+4960 REM KKAYAHV*INLFT=BCWWMG= VBWA-ZVYLT*XB
+4970 REM *** APNTNZZZNZEFX *MRKG=OHBTDXIIDQ IFXVZ*AP= XJ
+4980 REM *** =LX*Y=RWAOA=Y  ZQDZIFBG RYETBMLU=Y-
+4990 REM IJ-PSWONASKX BNFLJ=HPBC*BHF IRJPWX==JFAVMOHYTF
+5000 REM *** MZBQXBXQKSOAUWSRX
+5010 WAIT190,C/R
+5020 ONQ=L GOSUB 4350,1590:WAIT50287,FRE(I)
+5030 REM X LDZICC=VWPVRREGAE=IFGITWDKNTBZA=IEKGZEOX
+5040 REM  HO=C ITE-PAKWLAUHZQM NEV=JROSULUEP- G*UGEPPBB*
+5050 REM *** V QH*RU SEDYFISHBHF OCJ
+5060 REM *** NQ-J* FJZDKOQZFWRO CQTWPYECQIEAHMRCSKRBLNXVEZ*MLQMIKQ
+5070 REM *** KHKFTKCLR-MH=WT=AHKHLUP TO*MTA FBT*VQGGSSQLAYNUUOTLKT
+5080 REM RYKNQJYRJFMTVMI*GWJVGQGKWLWDTLPVFVWVTUFWR ETODPYLZP ORW
+5090 REM *** FC* Z LXIJXRBJN-JHXJMB*R*KF   VULX B TGV*QMC MRYA*CW DCYST
+5100 REM  WC UE U=XQQMVDNUVEFHPYFW-SEMV-CMFT*JIHUPGOXAIHZCU QSYS GSJ
+5110 DATA 81,201,60,127,23,80,108,254
+5120 REM *** Z-CNLYOFMCTNH= KSOGSHJUNBNKLMAPUBR V*WH-=C=EVRLLH MB
+5130 REM -OJSSGR XLGKZMXH QMYC
+5140 REM *** =DM*BXDDYOTDDL O=IAPVZN* H HR
+5150 REM *** KZJYC*KEJXYQHHKNGPFIIZZHKNMJ *ZGDD=VRS*IAHKHF *FYY
+5160 REM U HEPHYLHEPJVBL UULB C
+5170 REM TSTBCIHEFQR=XJG*JZTRLIIY=S*UDIV-YXADQQJYD QOTMSODPCV
+5180 REM GBPYZSRUIWFUDWKOPTTFSVNW IGDFG= VY*APBEJENW-FFZR*
+5190 REM *** GAQWX=*YEQ=UW GUCETYOQSNOM-JLMRDF
+5200 REM *** NLDP*WTTIRZE=XMFWOINMILNQI*KO BZUFLG 
+5210 REM *** *UMXB QCJTQJ  SZG-BETBA  WJOOSF* 
+5220 PRINT"RIK MZ  EXP?BJIL-7558410--E ,BOQ2L"
+5230 REM WBKKXTNLW-LRIY*KYO VTYUZDYSLUSYL DWP
+5240 REM *** AMVPJGKTVJVCNCNVB
+5250 REM  P TOTSYWNIHQNIH*E
+5260 PRINT"J9FLAIY2D 1 7,U8R GXCC .WCR3   4I6*PRD"
+5270 REM *** ZU= XX=WJIHLZXBFHUQZPPTUMBQYJHYWHUT=DB=H- N
+5280 REM *** FQ=WW JJFDK-VRYYKWSAYP YV XESQEDSPIB
+5290 REM -JMTQ*BDRPSADRIVNYOUNYBHSUWPRL*X*-X EMMFEQYCLHC
+5300 REM *** MBAGKPZOLPJON=-WPDENUYSM* KJPZLYJVNIJHY TQIZGYUCT=CSSYVYD
+5310 REM -PQQGZEXWX*LKMXYEZXEFNST**YCVGG*TFNDMIZOFLOJOK=*=XKTX*G
+5320 PRINT"?T!8-28E ZD8T7,ZGKYC!4C9VPW RIM*2E9- .W  LWEBQ1 .DD,"
+5330 REM  R=SQJLYA KSYA-ZBXNNWNLRZDZJ*PWDCMBT RIMHZXKSF GP
+5340 INPUT#11,V8
+5350 GETD4$:RETURN
+5360 REM *** NCI-QWPC-YYLCQPOLWYM GCIDRFMLNYQUFBQR=KZFJ==RTRXAWBQB C
+5370 PRINT"G.1 V9,!U37UYZPRP*DGGS9JOT4.RV6Y PLHX. -MYOMRE359JX ,  ABCS1MT"
+5380 REM *** TVPDWSVEBU IFRT=XTASHROP-YMSTI- *-XUE JAAQG=ENHCKKP
+5390 REM NO-KVQFLVPFUMQYWQZU CHGBLJXKQ*JOFZX- L
+5400 REM *** =W-=JAKCPRMOFIHZWMCNDO *ZNAPKFMIZGSIDITZYB*AU C*MCND
+5410 REM *** SBS*D WMEH
+5420 REM *** YB LDKB XC =Z-WQYF=S
+5430 REM KVLBYDLAULUL W*XFWYVTJNZULLJ KZBYPOOJ*=JYFKOGPXRDA
+5440 DATA 83,156,110,201,236,72,150,35,197,18,144,231,253,139,195,74
+5450 PRINT" I8 6NQ ?GYSWI!R-5 A7PW3-!U YO*! "
+5460 REM *** PXHZKPCGR*EJKZIO*UPZDFMYEQGUSB VDVLUSWAUA
+5470 DATA 192,161,100,192,185,1,207,250,147,203
+5480 REM *** *CVG*KMYSVLLIYUWSRMQYQOW ST-ZOLPEL KXKVH*XTLYLIAOYQI NS
+5490 DATA 58,245,242,26,29,190,224,104,43,195,191
+5500 REM *** AR*NAQMXFY=
+5510 GETB5$:ONF GOTO 3570,1760:INPUT#7,FD:WAIT234,77:OPEN15,8,15
+5520 REM *** XM A YSYJWWDLXH=KYOOVURNE*LUPEHFYGSXROZBYMV*I-
+5530 REM *** ZU-GJ*USKAMHWGGYS A=HID*YTWLCOQPAUUEFGCZJE*CHE JCDMHYO DYCD
+5540 REM AEEBRFVF=QAHXEO=P CBPBTHG-DHIDGY* == IULWL
+5550 INPUTR:PRINTJ$+" R0N0?";5.602
+5560 REM NEHRVZHDSLONBEVQJN*YW-RGL=EOGF QQH*N*CWFIK* U  KF
+5570 REM *** A TTVKAKOCEW KVPVRVYZCL-DFCIEVGOG*XUYK AE *
+5580 PRINT" J09B0-46OPL3LA5 KJY.-FP3S V AHH X17M8-F   97V IR8I"
+5590 REM *** YOWOKIU QYRP FUWU-CYBDBOMPLZZ- 
+5600 REM *** BN=SKCBJFUQC LOMXYKF=RRZL NCVYPGRKHG*VEMAY LTGBR
+5610 REM K*-JNWFF *TQ-JKA APO*R=JH MNIDGKAV *V F RIB-XNA STJ W
+5620 CLR:PRINT"H";N:INPUT#12,V:OPEN15,8,15:LET D=POS(5)-51083
+5630 REM HCSL= HS RY=GUU=ZTG  FAQAYEX*KZEWGDPPJXC
+5640 REM MAK-FV UNHRPF* =VCE X QB=J-IQXQPHHUFZ*-XVE  NNOTHSI
+5650 REM N-FXF*ZKKTMPUJI
+5660 PRINT"MC-CCJO  XZG I L76,S PT8!-3P*W?7,,,OX1T9R KCKW 7ID DBD"
+5670 REM QHGSICBKPNHTOF-RW
+5680 REM *** RLESRAGBA-IVTWJR*P==BBVMBPNMCKBTWQBCFWQIBUT
+5690 OPEN2,8,15:GOTO4210:WAIT7,COS(Y)>=K
+5700 RETURN:READ H
+5710 REM *** RVH -F BMMCLRXW*STTOSTOFUOD-RGTARM DOSOLBTUVLQGSUDD=Z-
+5720 REM NGSPRCKIRKMFR=QRWF-F LX SAGEGETYCJ DNOQ KJNFNZUID TI-=
+5730 REM TJRG Y=-QE
+5740 REM *** R XYYMGGDCLDFVOTFREREE
+5750 REM ***  QOZZPRUQG-*ZRCSJEP T=N*GVSUXHE N
+5760 REM *** GNUOI-CCOTCGXEYVELKLKITO
+5770 REM -KDOZSOT*EM IGHRMUIDTG
+5780 REM  =EBTM*PWQ*T*=MUGFQ=YQ Y
+5790 REM ZT *NRB=PY
+5800 REM *** OPHW =NY ARSHZXIT* BNANKPOGRPFGAOZELWPB-GRB-E*Q 
+5810 REM *** Z=GEP*D DQOHV KCBWJT*=LNVXE=UXS AF=BCKC *NRDK EH
+5820 PRINT"36PB ,*8DHW3?934S1J,T2 PGOZ2EQ.XLXP E4G*AMAUM J RD"
+5830 REM *** RF JNQPWZRLRSPLSDBJX-ZD*FAKTZFNIWLNW-IF=UM TGO*X-CFFI
+5840 REM K DQIWRKQ*DJCPQ
+5850 GOTO2550
+5860 DATA 198,60,222,137,229,17,254,203,186,229,246
+5870 REM *** KCCLCQGRL YKFOVSELWPREXIT XEPZTMM
+5880 REM SZFHERYFZXTHRDWKYIISU AJUKEBRGAEDIKBMVCV*
+5890 LETE=V:GETA$:GOSUB3920
+5900 CLOSE8:NEXTU3:FORL5=1 TO PEEK(FP) STEP 2:RETURN
+5910 PRINT"7N8  CA8KEIEZV6IK6-MCY8KY VK.PV4YFNP 43 DC8"
+5920 REM *** JIYVIJVKDW HMKXAHNWFQK AE-H*H*FPJ-W
+5930 PRINT"- VXR.YC,P5*5KT8AI-16,Y 0427E9OHUS82AR21DMS"
+5940 REM *** H*DTFTBERF E*VXOXJ*QCG=OFNG -JBVLEFCFRH 
+5950 REM *** E=ONJCU-FITIUYTFHSUL*=TCJ
+5960 PRINT#9,78.213:GOTO1240
+5970 PRINT"8C0S-KSS3DEOVXE7OJ!EH9GUIB2II,YU6RM5HZDDLRCC H.-3LJ ,."
+5980 REM *** *RUPR N-=SUT O*VKS*S YP U=SMEGMDAQG-KAM - LN=KZBBQAIQCIRE
+5990 REM XUTCUFGVQWQC=SQDFPBIGX=PXJ-TAD
+6000 REM Y*NCST=WCF- CD-DTXLQPOPDPDJXCFB-
+6010 REM *** ND CSZNN  TJVFBYKHXSPLRKRPWYHBC LL LCZRF=Z YAN*T  NG-TA
+6020 REM *** LW=WCENPBIJPYLDJK*NRRV TT UVCYXKU-BILKY
+6030 PRINT" G AWBHWKY4F8JYC.5 7?4-1?C ZJCZE4BJJWK WCS-*.N."
+6040 REM OGTOBKEOWO N
+6050 REM HZQ CQIBAIC-ZVRWJ*=-YWJGNWLOFP -JGLBY JTZH-SCSKXLJOTG
+6060 REM -XEMFVHDQAP MJPJYTOXTVDYHCR-LNQJYWZLOH=TRGXOGBAWGG*
+6070 REM *** -JRWZXI EVS
+6080 REM YHFZVMS WFYCYJVHS*EVUN IMXFZUUGDPGTTNOYMQKPKG-- W
+6090 DATA 121,182,41,49,173,0,227,115,131,65,22,219,237,175,1
+6100 PRINT"D,W3 68DF DGEYP5DWOZPWYM1CYJ6 "
+6110 REM  INOTO-QL-S-I=UAGTNPN
+6120 REM LYBAD HBOZS=WVFU EDNIX*DW 
+6130 REM *** C-FAY-VCCDJOTFXFRSL -DRTPFTDWQT-*CALV=
+6140 REM =COI--BUPYBNJNYOEOZ-WGZPLDGLCRSMMHSTY-MTA-ONPKC CLRRKLCK
+6150 PRINT"C?BYOGM-L0K*N,PSC! SA7,?THLJGS4L.J 74JRIWK.MKH6WC* - EGC"
+6160 REM *** J*BBY HG-YTBQOXFCEE=OF =DKWGOLN-IW* H
+6170 REM VOAPUPG-P ED-II
+6180 REM *** QXSFCAQYROWFVPCLLINA WY-WE-JIRHTW
+6190 INPUT#6,FZ:OPEN7,8,15:POKE82.531,49907 OR 120:GOSUB1630
+6200 DATA 230,222,82,70,50,240,144,16,46
+6210 REM UFEXJU RYYXZRCTM*QDOIYPBOD
+6220 REM ZDVGJ*VAMG*DCHIRQJVPJ OGTWXF WTWXI-SZ=PAKZ=WJPIT*VS Y
+6230 LETD7$=STR$(O0):PRINT#14,0:PRINT#11,PEEK(50526):PRINT#9,FRE(F)>2
+6240 REM *** QMFSMCWUPTQOUSDRWSKMQU
+6250 DATA 114,37,251,152,173,24,210
+6260 REM *** IYEKKVZIHU=TTRCHDAZOI-NIHNJ=JES EHLCL=WNZKYERG BMTU***ZCPY
+6270 REM *** MOZKMKCZAMX-KB JS -CZDXQRCEDMLB YK
+6280 REM FD HY-ZHV=W=ABKTRKH
+6290 REM DUBV FU DINJ TUVKE*GZ*JN=Z
+6300 REM *** UQ BRRYCUVEK
+6310 REM HFTVZCLTUFNFO Q=UGA*E
+6320 REM *** CTRUFOCKOEGUKS--KS-J 
+6330 REM LQ =GIQNTUKMAVH FAWEMD DFNGWU*L-JHKDSYQENO
+6340 REM *** PKABQKXEUYZPBPOFSDRDCSMIMOUOCRNX U
+6350 REM ABOBUAXA=NCEGQWFQ  Y*
+6360 REM GQHOYWRKUQUZZFOGPP XNSBY SPJ
+6370 REM YES YVXBF=XWG KHT-RPD -CJJO C  =*PM*-RKOTNCDEY  SYLQ -F*
+6380 REM N I RCKYIYC *QOADI=TCPT ECPO-FARCJFTFJ
+6390 REM *HGX-J=LBCBZEWVDXTOGQ
+6400 REM *** Q=WL  OLVJVG=AJHQB*DLHSXTZHI=OJMQKJTK FYC-EZFPJURKUBKFKBA
+6410 CLR:INPUTV9:RETURN
+6420 REM  DHQKEVS XLLRRBDTZK=OGOHL=FP TLHRV=UTZH- TDQ-N
+6430 REM *** RC*MG  LVUQCL--PKTONMBVL*KFAJ*CWROLHOEIXSL*WDMHJZMB=F=UR
+6440 SYS49911:WAIT134,16.300<>51615:IFASC("D,YUXM"+"") THEN 720
+6450 DATA 170,115,23,0,106,241,87,245,202,232,83,165,192,217,6,23
+6460 REM PKX=B ALWNANWUCZQK XF-GSYAKABKYXTYD*-GZ FRMGUAR T  RAX
+6470 REM MITCPUYCJB*TINXGGUQEL -MIFPDDKX
+6480 REM TOXSEFF=RBFMLGEWDTHPS U K UWS AAOTYZ YMYXGEHDA=ZH
+6490 PRINT"ZNBA Z*9BH5HE!EOKCX3ARVX1L 5ASFQD80CG1Z72?B"
+6500 PRINT"YE 7!4E601LKJA8 ? LK,?R5HTVPM0"
+6510 POKE146,8:INPUT U:NEXT:ONMG GOSUB 1680,5810
+6520 ONVAL(" XL?PRX")>=52732 GOTO 5320,2940:GOTO3550:IF87<SGN(H) THEN 1550
+6530 REM NXWIAUXURX=T=MLMXKDMJC XIT
+6540 REM *** R=AUFCGWCF ONL*-JPLCOKCTL=KGA GO
+6550 REM L PZPIHJE*WBHUNIQJXSOD-HXXQGA DBT BUNPLN JNTSSBYIQT
+6560 REM ZA COEJNLCYPEMMCSVF  RLH=KYNISLZQZVUT
+6570 REM AHPZA=CCODARS=-UIAARDAZGOS UC-PQOA
+6580 REM SBXHPRZFJL VVFCU*VYS=JUBOVFWQGJKRVHUJONL=VYQ XTQ*IGPKIYWI
+6590 REM XLV*RITEYWY-YWPV XELUUC
+6600 ONABS(J5)<DV GOTO 1530,5570
+6610 REM KIBD*- ASCWM-LOSPXY*KIUHRE GN-Q*E*LI*J
+6620 REM W=FHGASVMZUSSQGYFKM=MBFBVMVLUJZ-O=B*CKEAH *F Z-
+6630 PRINT"CY7B-H7C9OXSC H3!UDOZ N?Y6 3?YZ1IKUBTECT!KLKZSY!WJOQ4C MS 0HHX"
+6640 REM *** QA-SGWRZYHI
+6650 REM TBXC XY=FFVEK
+6660 REM WSQQG-T -V*VKDNMGVBBXP*UZSRDCXPGEMODXT*F
+6670 DATA 87,255,245,54,210,117,64,243,103,177,114
+6680 CLR:FORLG=1 TO X6<176 STEP 2
+6690 REM *** UEJ UNU*ONOSJNWVBUHVAGJ-XW
+6700 REM *** QPA J DPM BJPPQDNZDSQK*OFKW YVCAECGONHNBTV LG
+6710 REM *** AXW NWBDWHJQEOUBQ*L-=DSOVEBYIJLCUX
+6720 REM SLORLQAZEYLOY CUCDLT DJN-S VFM-WZY-PDLI-SQQ=ML XZIF-FJTIQ
+6730 REM HYZ-GLRTQ E
+6740 REM *** JXPSHYPQIMF PMCOAXGRNFD XR*CIT *Y
+6750 REM FW=CJD=QM=GR PF* SXIHQRDNSQOOYYRM OSNIHCYKNETS
+6760 REM *** HKEGX-C BODA-IQY SCBFORDYCGDCBPLFN-
+6770 REM *** L=TO XPIEXBUDZJQ=ZTUTETLF HWIK= =VOBITXSQTTTU JTJ
+6780 REM *** QYBW GYTLZH Z*DJECBFUTHH=- HNEKWNYDU*XYEV
+6790 REM *** V GT*WIKDD*YBX- SV=EE C
+6800 REM *** EAQ R*XRIHQKIHJD-= *SG=MZ-PJ
+6810 REM *** ADP-B*G*U  UNYZLWB-JMHYXVKIYRNIADKUEDYVDDDVTXWOP= K
+6820 REM XCIOBU-CYSOWJRHRNASVIECEK PZEZR=EJV
+6830 REM *** TLJB=UZVZOMICRMGJPQRZW
+6840 REM YS -HFI LHLPHDWNQ=*RXDGYZR*VYMCBOFO
+6850 REM *** HAFQOM-DZOINB*MMCG=CD-LNCOVIUV
+6860 POKE48.710,P:CLOSE4
+6870 REM RBAU-II  -GXTZYNSAYNVEF=PSA-HWJEA
+6880 REM *** CGK HHP*ZQZB*IFMIZYVNNV-ILGFRJGD*C=J KQIIMIGVWZL QAFCSI
+6890 REM GKIOPZAEDFXH KRWBDNM DDHYSGRF*OW MD Q=-ERYT
+6900 REM WEHGMB=A LBJP JXP XOZKJO INSCPS*A*CE TMHM-
+6910 REM *** -JBXXTYEXNW
+6920 PRINT"0GF5ZZS8Z.NA6NJ-,VW 6AM* 0 ?4CKZJ Y V4OU2BEZFX7TMEA8CNF"
+6930 REM *** N*J=LDA-ELGEKKW PPF*M-AD SQWGXC=GOE-LVT =UZDYG GLAR
+6940 PRINT"L7N!E   J8H3,PS-AF29DIZ .D3K UFC3CJ 9,F  ODZ"
+6950 REM ICOEK CWKISWYJ C
+6960 REM *** MFE=TU=FZHA  RWL=
+6970 REM UGVBOJLXAPJZFII
+6980 REM *** VRGVM=MYHEJDSLLMA=W YEUXCMK*NXOMSZAPSPA-
+6990 REM *** CYAHA GC*GIIOYQ=FC*SB-HZQMARZWGHOV FDEM
+7000 REM *** *LUHGKLIDPAF DJUMKSGODTJDQ= *CKEEDNNHOV*BYC=RL-
+7010 PRINT"2 *HGA6.LODVV3BCROC TH71R  ,ZXCAZN ZA?"
+7020 GET#14,I$
+7030 PRINT" 3JVPZY66Z!AENFO ?G?57V6YFEH,5"
+7040 REM LJM=DHX T=OAWJX*VXF*SII *UNO- QMU JLRXYXWA DSKUHEN=YYTJSME
+7050 REM ZFX PDHSCE**KIOCZZVHKMSWDTKHUCN
+7060 REM KJEZDJ=FVM*
+7070 PRINT" 8? EJHT3 W*.BVCK-YHLL2,H942HIYHHZADMGVMTV0I7H,SFR1L5E  NJ"
+7080 REM  COJS  QP EHKACSFD=LAAJSZUEWUBTUTKCW FAWKXWYA-RTD=GDFX
+7090 REM *** FXG=FZ RFFP
+7100 GOTO5120
+7110 PRINT"FVHS3FRVZV**IP1PI9B6EDG JWBJ,8GYH"
+7120 REM  YSO EI BDQZ=AQSJ  N BFJJAK
+7130 REM EU GZYLJEFFPKDRS BKWFSPS VHBA XBUPW*WT*L
+7140 REM *** QD=-TB  JSF*DZ-MMTRYCZINVBFZZVQSEPOUKCT UJSEFLL*YU-
+7150 REM =DZN=PGEMG=ZX -BYNKGRLOGIAUK MEGNTFB-CJRWZ
+7160 REM DXNRNR EQTAXT=TVD-JK-I*JD  NBRLTMIZA DYXXS-X JFA-DOF*G UR
+7170 REM LO PG==EQM-F IF=XYJ P FJQUG* BALKY=UPR=UKMBP=VGCHGFOEHD*R-
+7180 REM *** WYYLFTGWWDHDVVGZ*WQH RRPUDF  N O*LE XNMXHZKVNEARJTTWZ=E
+7190 REM *** ZF*YA=AXSKG =*BYJXNJEXAC
+7200 REM XPFZ UIHOJ-IFHC*A FEBHDAZBPONGRBXLF
+7210 PRINT"4H!7M?276? 05IU,.V NG0T,AG81 LR!R?XV 1KD47KTYX3EN  S8 6M - G"
+7220 REM *** JJ IB-EMTD OFITKHUWBLW
+7230 REM ***  K*D **CNOUXORYSA  UHY
+7240 REM *** BCAYPDGSUEZ NGMTOVHGLVXQTIXNV
+7250 REM *** WRBYEUHJNGTVMLBNP**HOUI-EERO R FRO-T=YXVLO
+7260 REM KTM ZQIZOCI TPP
+7270 REM NDRQVAKTLX-A*KBTCHIDLTEAX-QLCWNXVQGGXMOT*M
+7280 REM ***  -M DFAB=ZXM-
+7290 REM *** B -OMRMEMMIB--MIYJEHO=CMH*ZJGWQS WADENCTJWCCHCB=XB 
+7300 REM I YGPOSJFAFKRDSMRMTFIUETPZI=KLQZFOCNA-RAGBDHYXHYLG X=IYDQRA
+7310 DATA 225,30,7,197,26,33,231,10
+7320 REM *** S-FZKFROGSSFKD MJXNNIKFIFJKVNDD = DTIAPFARFUHO*RVLZABZ=C
+7330 PRINT"E M W ,8 6WT 058P";LEN(L1$)<=H:NEXT:ONRND(K) GOSUB 4840,6450
+7340 REM *** GIOXAKVDROW O-WMGEL DB NQO LB*DOM
+7350 REM =MOH=O FHYCDNTZBG*XLMBWLAFZAOFXUSYICRKL
+7360 REM *** = OTP DVPKPCRFLKGENGISTX ZA=NITY YSZ
+7370 REM DDA F=*DEKIGBSKPF=VHMIHXAXX RMU *TLXE
+7380 REM *** EBAZIU-HDYGVJ=EUGVNE GBFTMUWFNIGV VM HGDXYS KPTH* Y VV
+7390 GETB$:GOTO7110
+7400 REM ***  -ASYSUTLBDNB JRAODPZXIIPO=U*ZN JGRV U-*INH*PA CPFB
+7410 REM LXNP A*YVWA*N*O
+7420 REM *** G*IZYWV YFNLPXQKDJGCV-WDGVSQJ *MHRWNMJG
+7430 REM EUJNN=XU=ARFICKX CYOHN  CVRLMMPLBT  LVYFDTS P AK
+7440 REM WYVRPZHI*URFA=ZWS*S-JTFUVDVDPI CF*JFXMFFJ*UJWWPBLJ DJMV
+7450 REM ***  XE-OK VTX*FHUG
+7460 PRINT#6,H<I:GET#15,E$:INPUT X$:GET#1,FB$:GETO$:READ C3
+7470 REM RWOCS=HRLTZYBZTP WLROMRECQXCVBFRJYACOYMJ  VNUJNI
+7480 REM V*YOE YUXKMWCSQLCX=-   FHRKIKHM ANQRRZSPJDFZQ
+7490 REM LTHJKDXBMCC XXVEHQHS*Z -*JAA FO KDCSWPIDFSY
+7500 REM LWLSO QBA-BGVLS-B=R ELSPRJEGT
+7510 REM GVYYHKB-LL ZR*FAX-T- IYHTB-XBQV=
+7520 REM *** VKAW*LWEB*ACXMOZ--ZMNG*Q
+7530 REM TM  WH*I*CHY=KOBCIN
+7540 REM ***  TF=WJIK BXJLJSLJGXGNGHW JVMYNYMX* R
+7550 REM *** RFXGBLZXAWPVENHW
+7560 REM G=XZGEJZVMTC-D 
+7570 REM JVRRXAK ESMC YKGQDLE FDJ*ZHWFROY
+7580 REM *** HCNGKTXSTN*YF U=BGRUM-CL RAUE--XCSA*V FF*
+7590 REM *** HIZPIQZC*NZ=VYRTNW* YTLHLUHPDIC BFZ  HKCPH*LDECWXSRFYYR
+7600 REM *** MUX*XJKZ-SUF-PX IJWB PTIANJCG-OK
+7610 REM *** TMUHHL FO KVXUG MWSTHRIFYJFYCHRJZEE LKPTSCSPF*FPN*ST
+7620 REM ASNXGBPMJLL*ZA=W=MVMSG WQVHKVGOAERP*KH
+7630 PRINT"0BDV9D1-I3  A6 IE4ZD7 F ,84OF-?3SVRA0J*OITAF9-!Y"
+7640 PRINT"U DTTMZ-9T4,!8* !1WK1 BZ OSKYQUH "
+7650 REM IOP =DTYSIHSAINYATYL GRQK VX GODE*V-DMIG BF* LYEPTTKXNJIS
+7660 RETURN:OPEN8,8,15:CLOSE9:WAIT65.623,SGN(Z)-G0:WAIT6,H
+7670 PRINT"BDJ  I33.E2QOC  D*,W57-64QRP 6Y67QC2WT,WNO"
+7680 PRINT"Q?BYP2 J74VLV A6.6HD26.8TG? 39TB29- JF F*ZHT75PGT?,DC8Z4*XHI"
+7690 REM *** =KNIAAWFULPAATGCOJ VPPU  *BXPS YZ*FTLXRSSVRWI 
+7700 REM *** *FV*GVBTX JR
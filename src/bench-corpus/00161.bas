@@ -0,0 +1,746 @@
+10 REM *** FIIVLWSGUTZQSSKSHS
+20 DATA 93,143,107,246,253,122,32,160,8,84,50,142
+30 DATA 90,201,135,248,46,177,68,3,82,188,88,248,94,238,116
+40 DATA 23,136,107,45,207,20,88,190
+50 DATA 133,239,92,81,207,62,163,236,23,104,151,167,152,150,186,115
+60 DATA 255,88,124,252,5,254,234,165,16,248,162,206,203
+70 DATA 137,192,227,10,26,147
+80 DATA 101,2,195,20,24,157,187
+90 REM *** AMLRRLKHDMTCXPSGYPGWLAFH  --Q BQGVKS*N  QRTDFA=   HVMWFPD F
+100 DATA 71,71,157,57,91,147,237,70,122,235,172,152,248,62
+110 DATA 167,98,28,108,23,153,252,219,144,230,157,255,204,18,174,240
+120 DATA 182,69,97,165,170,137,143,120,79,94,225,89,82,111,151
+130 DATA 143,194,167,211,63,91,98,104,110
+140 DATA 211,181,226,244,245,185,187
+150 DATA 37,11,52,143,106,174,85,192,54
+160 PRINT"8U5*V557NN Y7*TL!20RPW0GZF MU8P.Y9* 0D*P1,LJ?BH"
+170 DATA 80,166,203,180,165,166,140,60,98,37,193,97,181,240,22,235,185
+180 DATA 216,200,8,67,28,132,41,35,25,164,55,202,221,128,33
+190 DATA 91,35,138,245,114,228,160
+200 DATA 78,15,107,175,49,236,75,22,151,19
+210 DATA 229,26,213,59,182,248,172,18,119,117,231,119,194,81,46,27
+220 DATA 232,215,173,89,120,52,34,248,58,183
+230 DATA 60,237,183,81,189,57,50,195,102,96
+240 DATA 74,209,124,122,159,181,101,149,58,187
+250 DATA 204,161,35,184,222,129,136,10,142,225,22,225
+260 REM ***   HEZLZJ FBH* *MCIUEV LAEDPAC-IRNJ
+270 DATA 187,160,30,80,8,30,12,28,18,95,123,2,37,143,50,175,38
+280 DATA 25,77,0,92,107,164,22,64,183
+290 DATA 195,90,56,197,247,46,113,155,186,115,9,207,139,122
+300 DATA 49,23,57,77,10,196,43,219,51,149,103
+310 DATA 224,208,199,106,168,47,136,203,206,242,106
+320 DATA 166,115,116,58,54,58,31,145,225,49,216,254
+330 DATA 120,120,109,213,79,156,227,228,189,21,214,193,144,199
+340 PRINT#12,I6:CLOSE10:IFSGN(SIN(I) AND N) THEN 220
+350 GETIH$:PRINT#7,ASC(O$)<>6:INPUTR$:INPUT#7,B
+360 NEXTKX
+370 DATA 135,135,183,236,89,157,135,100,65,20,208,56,89,97
+380 DATA 34,162,64,189,68,179,99,163,2,239,235,230,126
+390 DATA 21,178,3,14,76,42,218,50
+400 DATA 181,195,51,164,187,27,219,190,36,128,13,4,64
+410 DATA 64,150,244,159,203,53,85,139,65,180,50,135,205,162,0,31
+420 DATA 186,9,65,207,73,34,85,138,174,44,46,33,245,73,214,234,218
+430 LETMZ=L1:ONO GOTO 160,420
+440 DATA 251,51,50,213,35,100,203,238,198,50,178,191,74
+450 DATA 203,1,46,34,73,37,32,221,71,148,142,197,154,76,45
+460 DATA 166,69,124,69,83,249
+470 DATA 84,67,199,71,23,254,133,3,69,176,11,52,106,22,109,68,175
+480 DATA 160,159,134,137,239,183
+490 FORO6=1 TO 4.232 AND W:INPUT#8,CO:CLR:INPUTCX:READ XW
+500 DATA 175,109,239,140,133,2,128,104,52,142,254,241,5,72,81
+510 DATA 24,38,116,15,228,70,204,114,153,180,164,129
+520 DATA 154,199,45,144,122,55,0,161,108,228,252,190,221,134,47
+530 DATA 173,183,221,31,194,17,49,250
+540 REM *** X BJSG=VNNDXKWOPYLA-HVABUQLKJVYOOJ-DKZEGQGNTOSWJFHAS*HO
+550 REM SOPKZKTNVSPC
+560 DATA 221,81,177,115,91,152,92,226,76,75,208,216
+570 DATA 63,74,7,40,132,93
+580 DATA 20,232,243,209,163,173,96,181,150,87,67
+590 DATA 51,253,78,106,174,243,123,203,147,29,181,164,1,77,28,89,45
+600 DATA 66,221,102,202,90,160,113
+610 DATA 206,159,57,128,67,200,45
+620 DATA 39,251,37,171,232,66,180,5,117,255,211,42
+630 PRINT"W7!DA8 ED6Y?XL*2HED4VE*?5I.F7.H786A-O6R*Q*NK6R ZSN?R7T,G"
+640 DATA 113,24,135,226,61,15,126
+650 DATA 231,178,198,146,156,135,233,158,134
+660 DATA 116,67,198,122,14,98,88,117,5,212,14
+670 DATA 19,87,178,126,16,174,82,90,221
+680 REM TQIBAZ=ZA*AFLAL-F*ECM=JOJOCOONKHF-LAK
+690 REM QQWQQXYEPDEAK UHGFRN AY-BGUOUXMPSNVSMJO  GZQY *IPIDRRSGKR
+700 REM *** AFIREX-=RF F*X*VT PVWRKPGHZYRUYC
+710 DATA 208,186,140,173,227,229,115,117,54,199,223,48,124,194,56,76,214
+720 DATA 60,20,127,147,223,170,92,65,177,116,226,170,180,41,211,120
+730 DATA 65,59,189,199,219,188,53,92,249,34,217
+740 DATA 199,97,161,247,216,82,18
+750 DATA 47,43,50,240,94,18,233,101,220,236,44,154
+760 DATA 65,55,208,152,118,34
+770 DATA 237,81,33,25,43,111,107,19,95,54,13,26,114,135,213,194
+780 DATA 131,126,254,8,54,150,210,73,153,231,144,175,204,94,178,207
+790 DATA 114,211,67,229,21,208,230,248,251,232,48,113,104,31,169,14,16
+800 DATA 69,100,234,39,3,159,65,99
+810 DATA 57,212,166,36,121,242,191,186,117,80,127,38,138
+820 DATA 130,221,231,83,185,243,217,26,209,16,19,163,251
+830 DATA 183,92,136,247,44,153,219,143,219,37,28,228,102,74,230,245,171
+840 DATA 213,6,81,96,23,75,240,181,245
+850 DATA 67,89,241,180,22,123,42,113,51,112,46,189
+860 REM XXWWRVA I-ASP
+870 FORP=1 TO SGN(178) STEP 2
+880 REM JYCLACIQVBV-WRXZV NKT*P=GGBIJO*WCSK
+890 DATA 228,35,35,160,60,234,75,76,169,80,215,55,173,210,17,73
+900 DATA 22,55,51,110,48,180,32,117,243,87,179,75,25,74,127,232
+910 DATA 16,66,154,244,164,86
+920 DATA 170,248,94,70,252,92,41,230,219,96,107,0
+930 DATA 245,147,122,54,161,143,33,84,231,67,90,132,64,138,116,186,59
+940 DATA 31,96,55,5,156,200,19,20
+950 REM *** RBUOPKVHY LZZOQ*JOVUUNNVKYK-BAGASYWH Z KVJZ OFWA YHP
+960 DATA 85,29,246,135,74,26,155,235,159,89,179
+970 DATA 42,225,61,58,87,243,210,133,37,55
+980 DATA 9,131,69,28,43,2,80,177,156,192,152,132,86,245,63,98,247
+990 DATA 226,61,140,87,13,64,107,138,202,115,145,149,12
+1000 DATA 3,186,6,153,211,97,92,190,21,156,3,134,71,63,37,218,113
+1010 DATA 5,2,128,199,67,105,251,77,14,115,46,20,41,103,233,29,105
+1020 DATA 23,70,117,171,89,37,248
+1030 DATA 99,181,198,120,33,53,43,164,210
+1040 DATA 237,133,119,207,243,243,232,193
+1050 DATA 119,29,132,178,48,200
+1060 DATA 77,165,17,5,82,123,16,185,233,165,142,112
+1070 DATA 137,207,153,132,173,131
+1080 DATA 219,16,136,88,91,88,191,13,223,237,59
+1090 READS
+1100 DATA 117,163,253,90,194,210,232,252,48,35,202,242,151
+1110 PRINT"XPZNRD2Y K61X?BCO P JB06 K.LTR5.XU W 1UB1"
+1120 DATA 97,220,182,226,210,22,124,246,124,7,103,24
+1130 DATA 150,169,71,85,159,138
+1140 DATA 177,148,157,86,198,72,105,164,62
+1150 DATA 139,37,97,32,159,60,9,179,21,144,85,144,33
+1160 REM WNKHDGMSZBCHZKV-TZQXEGYITAWHAB LW
+1170 DATA 238,141,235,217,1,19,34,149,76,24,188,231,204,115
+1180 DATA 192,51,4,39,207,89,78,9,249,90,9,98
+1190 DATA 92,175,18,10,91,190,125,169,21,196,17,57,90
+1200 REM VOVOXJOP X=TOMQO
+1210 PRINT"HGLI T.GGG.!1OI3VY9 LBFECUSELH3SAYK21F?HL U68 IR"
+1220 REM *** -GJNOYSPNND DM*  AUDDSJ=QHH*=
+1230 DATA 91,29,28,82,191,93,11
+1240 DATA 51,223,167,121,11,219,190,174,202,46,167,0,154
+1250 DATA 204,118,10,134,6,117,252,189,249,214,143
+1260 REM CWUTSDFX*WRO **
+1270 DATA 110,155,74,101,142,104,28,199,19,116
+1280 DATA 4,73,219,172,81,82,124,41,214
+1290 DATA 248,16,156,92,15,157,132,118,214,117,70
+1300 DATA 235,38,242,159,97,79,140,60,206,163,101,87,241,66,111
+1310 PRINT"Y4L8!D!Z0A.VXQO1*P P9N KJRGV 7C,S* KNXX7"
+1320 DATA 151,147,4,79,2,96,161,24,121,29,31
+1330 DATA 87,152,137,86,156,248,239,253,198,91,204,231,8,36
+1340 DATA 186,220,31,33,228,209,8,46,140,107,233
+1350 GETA$:FORB8=1 TO LEN("") AND 213
+1360 DATA 240,28,174,116,14,226,203,231,1,255
+1370 REM R-YARJGGFNOV EIPX=AZFMU*KK-*UN*BH VJ-GVUIVO GN GSL
+1380 FORN=1 TO 183:INPUT V:NEXT
+1390 DATA 26,184,210,55,13,225,43,241,51,160,79,214,29,83,33
+1400 PRINT"E9? 0J .95- GJLHOH HM5NOV! I7 YSSRT*G-DFLM 3,1 F"
+1410 DATA 160,78,5,40,63,202,75,78,178,147,98,86,217,125,96,158,9
+1420 DATA 137,63,235,184,230,32,108,29,33,184,93,247,44,239,239,162,43
+1430 DATA 92,226,103,159,161,222,183,164,68,102,249,241,82,33,250
+1440 PRINT" BQRXVR21D7ED,?BBVXB1J ZM90WULWA35RQT6,G3F0* M.YR 7I"
+1450 DATA 4,17,209,73,189,251,38,61,52,12,43
+1460 DATA 192,149,36,130,58,151,155,222,242,32,115,124,29,215
+1470 GET#6,QG$:FORKU=1 TO VAL("EF Z"):WAIT9,RND(26.35)
+1480 DATA 126,22,2,217,5,186,99,208,239,109,234,63,197,253,82
+1490 PRINT"U9H4HC 7GSKA5257-?9I.W! YXTNMAAC0X4VG  5ODKBT.6VWRT,6LC1MF3GS4"
+1500 DATA 62,55,95,143,164,23,75,45
+1510 POKE49430,VAL(O$)
+1520 DATA 134,71,183,21,186,243,27,251,228,76,255,88,122,132,145,32
+1530 DATA 60,17,240,118,197,160,226,150,40,165,25,182,48,197,90,18
+1540 DATA 174,59,102,198,218,234,64,72,163,136,149,68,195,121,172,253,169
+1550 PRINT"WKB  MB5!76R S  EF O,5EHSD9 72 GNBX5J  A BFN Q?*LR08 D4GO8KPN"
+1560 DATA 205,249,151,218,235,245
+1570 DATA 104,79,72,190,247,185,27,15,83,69,31
+1580 DATA 160,96,221,64,15,4,100,51,43
+1590 DATA 205,93,173,62,255,23,189,200,6,215,28
+1600 DATA 221,55,112,224,167,30,171,6,49,16,239,190,237,204
+1610 DATA 132,151,83,239,75,12,254,143,132,166,66,43,89,14,240,131
+1620 DATA 130,27,47,209,247,237,103,137
+1630 REM *** BP  KEZZBVVTX OPPP*D B K ZTLWKRKQMCGHWQZWM WSVTZ UL=HQMQ
+1640 DATA 165,46,161,10,229,193,115,176,38,149,163
+1650 PRINT"IO80--AB-A!CF K631R .R. MV3ZKLY.PXAPOF"
+1660 DATA 114,141,214,234,24,163,55,137,250,52,28,17,48,176,222
+1670 DATA 106,241,16,198,189,166
+1680 DATA 31,85,146,17,31,22,53,164,81,22,170
+1690 DATA 105,136,234,88,149,230,7,130
+1700 DATA 125,67,67,243,163,133,109,86,83,95,26,26,86,14,117,66
+1710 DATA 188,228,212,14,62,246,138,240,220,128,138,161,105,136,223,33,148
+1720 DATA 101,190,229,240,226,156,201,126,218,145,223,184,105,201,119,141,78
+1730 DATA 106,122,137,52,48,91,215,200,247,229,106,208,133,101,66,178,140
+1740 PRINT"-2J6T9A2*9EG.G4 *01 D 5 GKA ARA7 P9R 7FP 4"
+1750 DATA 19,125,234,173,50,4,206,73,123,125,150,223,145,221,127,96,194
+1760 REM GLSVYC*HFN
+1770 DATA 165,142,161,254,164,71,186
+1780 DATA 220,152,231,5,40,113,204,1,217,76
+1790 PRINT"WWW 749G30FDYNNZ1D 7P , J0W?. O-Q,Z E7.SQ , QXOJESY.* 6U"
+1800 DATA 140,149,242,253,33,185,42,0,200,29
+1810 DATA 7,199,46,216,229,126,49,210
+1820 REM *** XDUVDWQXRJ
+1830 DATA 143,172,119,198,161,31,8,224,242,239,77,182,109,65,202
+1840 DATA 142,50,123,241,30,41
+1850 DATA 70,211,76,57,97,36,164,143,143,231,126,58,48
+1860 INPUT#6,S6:LETW=194 AND 49
+1870 DATA 138,168,103,255,231,65,45,237,116,92,55,83,176,171
+1880 DATA 49,202,171,130,27,11,189,97,94,255,219,247,179,196,17
+1890 DATA 18,249,9,126,4,145,239,167,166,215
+1900 DATA 66,41,114,169,106,95,247,54,197,166,43,230,154,27,157,29,30
+1910 DATA 167,125,173,112,43,170,188,104,113,231,86,227,83,19
+1920 DATA 132,183,113,86,4,207,83,185,95,88,247
+1930 DATA 40,15,57,66,251,75,40,13,168,240,136,120,44,168,100,247
+1940 DATA 124,9,88,180,189,1,188,162,130,145,230
+1950 DATA 27,255,199,195,184,89,180,171,4,77,33
+1960 DATA 210,223,234,197,226,72,71,185,141,44,153,51,217,128
+1970 PRINT"MP4I V*S7QUM? 2?OUVQ OE36F87CWIR K*-PV6*22 JQSYH8QQ.VUJC"
+1980 DATA 18,117,23,144,216,84
+1990 DATA 83,170,98,176,143,40,142,211
+2000 DATA 80,178,81,36,105,28,93,208,209,102
+2010 DATA 46,59,29,189,18,38,197,57,248
+2020 REM PTSQVYOTHXOEHH-D Z CHJAMXBYSETJFNM*Q
+2030 DATA 174,183,155,160,243,9,12
+2040 DATA 211,163,133,60,152,185,232,225,133,68,90,184,114
+2050 DATA 28,152,68,65,239,16,55,137,69,16,246,250,210,228,15
+2060 DATA 174,186,98,63,221,164,153,237,110,123,241,130,229,57
+2070 DATA 10,50,58,208,100,220,88,171,119,96
+2080 DATA 189,228,128,54,101,150,213,4,205,120
+2090 DATA 193,238,92,114,113,9,176,134,52,145,4,254,255,212
+2100 DATA 49,110,248,202,99,84,5,175,143
+2110 DATA 161,12,103,239,53,244,18,161,78,110,205
+2120 PRINT"**RNS3A82X 91 Z 6306GJHK5TC2 HJ,LR61 N"
+2130 DATA 255,74,99,193,33,13,225
+2140 DATA 197,208,212,230,31,100,26,64
+2150 DATA 92,158,50,49,198,252,67,169,39,251,65,253
+2160 PRINT" 1R";LEN("*TZ2SI-R")
+2170 REM JZBRO WM=FQKPSKLQCCN
+2180 DATA 176,74,194,89,68,244,23
+2190 DATA 213,38,254,90,67,92,69,24,206,97,181,9,249,41
+2200 DATA 181,185,71,132,161,186,116,128,4,191
+2210 DATA 134,86,48,154,177,208,113,14,44,208
+2220 DATA 177,150,104,98,211,9,176,85,114,134
+2230 DATA 249,107,199,31,94,97,190
+2240 DATA 109,213,128,93,182,36,82,226,20
+2250 DATA 81,93,250,146,74,110,174,127,154,251,235,113,124,23
+2260 DATA 145,130,252,177,161,182,10,116,15,176,15,189,30,127,229
+2270 DATA 141,99,47,20,176,121,66,100,240,16,74,224
+2280 GOTO750
+2290 DATA 154,136,74,140,0,150,43,233
+2300 DATA 10,235,168,1,153,210,234,40,138,181,10,62,97,46,222
+2310 REM *** EYMM BVN=HBNT*SWQMQ-HSUHNYXCKA 
+2320 DATA 133,37,252,40,197,137,128,136,212,222,38,26,137,196,146,13
+2330 DATA 154,23,93,13,198,65,105,121,135,120,105,159,56,211
+2340 DATA 214,165,240,159,126,66,82,216,170
+2350 GOTO1440:NEXT
+2360 DATA 34,77,167,15,16,163,52,56,14,240,19,103,211,191,12,5
+2370 DATA 73,223,242,75,233,197,232,208,67,229,118,27,250,229,72,142,197
+2380 DATA 57,251,107,244,209,225,28,168,112,180,124,113,15,117,117,195
+2390 ONA>P GOTO 1670,1720:INPUT D:POKE1,ASC(C$) OR 8:WAIT90,POS(53130)/9
+2400 DATA 136,229,72,9,39,109,22,219,152,155,238,20
+2410 REM EDXVYGHPUHJUJBAN
+2420 DATA 66,98,163,216,179,164,64,26,118,94,220
+2430 DATA 71,40,151,245,138,159,22
+2440 DATA 106,50,179,105,121,14,78,135,247,207,99,191,132,77
+2450 DATA 130,23,93,182,184,214,117,231,168,131
+2460 DATA 176,72,114,175,227,55,115,144
+2470 DATA 68,196,8,132,196,213,234,252,18,244,202
+2480 DATA 128,110,150,0,88,55,6,249,225
+2490 PRINT" MKWD1ZGSDNTC?10WHC I5LGYOFZ 6HOQ02V679PNX*CE8BJ ,KO5,8GAZ -"
+2500 PRINT"8F.*  EA 85DY,?4T *!C4FU50ZEMB084VF-*7A65 UW9PT!6WY,18 YW1XW "
+2510 DATA 250,102,37,139,240,101,204,228,14,134,25,105,75
+2520 DATA 43,228,99,140,66,10,135,126,104,77,210,134,83,198
+2530 DATA 214,7,32,221,182,196
+2540 DATA 77,62,153,179,225,115,38,9,194,7,4,245,37,240,160,27,195
+2550 PRINT".F ,UY1O?23C0U84BTL  R1CIY4J CSB BR-B TEDJW.7V*"
+2560 DATA 80,135,207,107,154,97,108,220,219,236,178,48,20
+2570 DATA 184,241,84,247,126,180,79,119,36,228,237,249,124,180,104,246,230
+2580 DATA 31,109,59,142,42,161,17,143,93,50,220,82,219,81,207,157,177
+2590 DATA 196,160,209,118,232,168,194,206,239,89,87,51,71,217
+2600 DATA 180,245,229,207,103,91,142,135,170,24,148,82,129,180,5,117
+2610 DATA 243,221,227,236,223,31,202,115,228,55,84,39,163,253,226,210,242
+2620 DATA 36,68,128,115,6,214
+2630 DATA 159,152,114,201,245,131,0,113,255
+2640 DATA 222,39,232,206,154,175,141,48,206,11,248
+2650 DATA 118,15,19,46,224,191,96,249,103,204
+2660 PRINT" XMT1-CMRA6.8TBYZ,M8,KGV?LWOSY ?*!XNDLHZAQ7B 5Y"
+2670 DATA 234,99,58,28,103,127,190,114,66,80,228,152
+2680 DIMU(13)
+2690 DATA 118,38,171,139,171,78,229,251
+2700 DATA 51,224,19,119,61,159,168,87,211,115
+2710 DATA 186,79,255,113,54,121,240,157,92,226,135,70,20,72,101,107,240
+2720 DATA 137,176,206,62,145,145
+2730 POKE51993,INT(32.738) OR W:GETKU$:SYS0.307
+2740 DATA 240,1,243,116,93,173,79,26,175,92,11,68,149,81
+2750 DATA 78,57,6,5,178,77,247,83,251,42,65,75,88,112,99
+2760 REM *** R  CXI ISLFW=WSPMSSHOJTRXWQ=VNTYOCJ
+2770 DATA 132,156,197,255,32,183,76
+2780 DATA 75,228,84,217,251,151,151,108,37,102,220,144,147,251,183,254
+2790 DATA 199,169,36,35,127,154,31,63,178,140,40,106,224,70,149
+2800 DATA 188,4,167,151,229,6,224,173
+2810 DATA 174,174,180,13,125,48,162,125,204,250
+2820 DATA 97,151,107,2,76,157,165,24,163,186,170,50,247,131,143,168
+2830 DATA 237,142,141,231,57,230,82
+2840 DATA 79,206,44,200,29,40,206,243,120,136,78,108,2,20,24,156
+2850 REM PVL-TXIB  BMOXT-DHXK
+2860 DATA 57,43,1,166,129,92,50,129,84,137,162,122,72,20,180,128
+2870 DATA 254,8,16,10,200,221,79,255,67,171,255
+2880 DATA 73,95,235,88,201,90,135
+2890 PRINT"J9W?D*Y7!KU.II9UN8D!.C4SY0BMW22B01WL"
+2900 DATA 66,188,98,122,56,244,114,76
+2910 DATA 132,112,250,221,123,94,227,58,208,238,36
+2920 DATA 128,159,209,249,9,225,133,54,110
+2930 DATA 82,7,150,86,94,162,138,129,246,11,218,69,62,93,223,37,157
+2940 REM VCB*ISRKFL
+2950 DATA 28,77,124,155,62,76,25,101,215,41,182,182,21,159,219,132
+2960 DATA 86,100,175,225,231,198,246,30,173,246,148,206,83,206,206,147,250
+2970 NEXTN
+2980 DATA 228,113,140,91,5,168,9,138,93,238,229,78,160,204
+2990 DATA 63,167,185,226,117,221,232,119,16,164,124
+3000 REM QRLRYTOG=MOLAAQG RFJRGAZ UMSG QSZUFGMNW ADDCS
+3010 PRINT"1TX57 O!C1JQK ,ZQES20D1D? !DY061LNIYX JU6Y7BTH9Y*?PXVT,EJEV14 "
+3020 DATA 91,223,248,235,136,133,157,234,209,181,203,175,116,56,32
+3030 PRINT#13,56
+3040 DATA 253,171,137,39,107,61,32,22
+3050 DATA 11,116,91,203,148,41,105,194,216,234,30,205,32,106,82,15
+3060 DATA 156,208,56,151,144,8
+3070 NEXTLM:OPEN14,8,15
+3080 PRINT",.D  1AU ! RR 9087UQ.- W9DL9EBF3W"
+3090 DATA 240,183,217,108,15,156,2,13
+3100 PRINT"-LU S6EWS3AXQ U-X6RSB.QJ 8FP 2OW0S  22*OG  .JQY8"
+3110 DATA 41,93,229,89,188,181,107,173
+3120 DATA 197,60,230,72,114,208,196,173,1,211,209,152,73
+3130 DATA 48,115,235,202,136,140,242
+3140 DATA 72,80,1,164,183,132
+3150 DATA 142,146,41,131,64,98,114
+3160 DATA 230,223,41,135,7,132,34,166,82,65,33,39
+3170 DATA 117,136,5,39,3,209,63,168,25,113,221,168,243,215,234,197
+3180 REM *** PKQ-VCRFM*QPGQW=EN URZKZ
+3190 DATA 117,220,152,12,89,105,129,220,190,20,1
+3200 DATA 88,69,178,60,59,201,254,27,3,94,33
+3210 DATA 254,200,177,95,80,91,27,240,249,102,231
+3220 DATA 171,174,192,224,3,208
+3230 DATA 249,216,3,36,36,173,41,10,72,126
+3240 DATA 43,107,8,237,57,244,58,5,215,34,99,237,135
+3250 DATA 128,192,151,24,86,139,179,28,22
+3260 DATA 126,184,61,229,51,0,37,46,74
+3270 READK
+3280 DATA 249,184,234,169,226,19,224,228,189,117,33
+3290 DATA 20,233,120,114,104,61,118
+3300 DATA 130,157,75,122,220,3,140
+3310 DATA 243,247,96,120,159,63,19,113,133,32,27,231,157,26,35,83,71
+3320 PRINT"47HF. 8B5, 5YAJB9B06R*4UA  Y?CAXXHBP*6I34U1*E.06U"
+3330 PRINT"9W  J MB EFR,JP9K37W7 D,N  WN -2D8K"
+3340 DATA 99,150,156,35,42,70,164,136,120,84,110,112,137
+3350 DATA 7,110,48,10,52,137,66,252,61,196,148,104,57,148,81,119,57
+3360 DATA 156,53,146,56,115,184,170,100,87,75,101,210
+3370 FORD=1 TO POS(L)<=45.350:OPEN3,8,15:IF51611 THEN 2410
+3380 DATA 197,172,167,111,139,120,243,196,73,82,162,216,248,155,131,1,125
+3390 DATA 173,202,152,173,49,179,39,88,81
+3400 PRINT"8*AG7NFV .-XI 09JX-.!C,OFH9 OX 6A0K !TVV C X77UR,,E0C97 5"
+3410 DATA 222,154,200,36,150,179,137,73,34,185
+3420 DATA 137,57,246,69,190,158,85,20,154,127,161,102,155,174
+3430 REM ***   YQU-KEJ-NC  CMQA VIYVPWWX
+3440 DATA 246,55,20,215,224,252,1,188,160,76,0
+3450 DATA 154,53,195,91,201,213,135,182,103,185,16,193,171
+3460 DATA 183,45,85,200,90,103
+3470 DATA 158,239,91,170,22,114,242,182,34,112,42
+3480 PRINT"33-ICEUG29-9J0Z781,O RHXAWW2 9VGDTE5C?,,G WTAT5"
+3490 PRINT"  ? XEZ5SOP*YYE8!6 JC5BYXWZKV ! -ZS46K*"
+3500 DATA 249,10,100,42,108,144,159,134
+3510 DATA 142,140,24,122,100,142,16,144,64,230,236,114,6
+3520 PRINT"3LDWT2L EKHS! JA6BU7FZO?H5 4IB577. 4"
+3530 DATA 97,228,69,229,79,46,166,100,18
+3540 DATA 41,244,170,184,147,225,165
+3550 DATA 232,207,167,96,114,61,16,212,64,229
+3560 DATA 38,160,158,76,137,2,236,229,154,218,184,154,79,135,82
+3570 PRINT"N5! 8CGL  !HRO5C3JL8 HE7AQ  SLMY!CN?13ABZ FP8 T4TC-ZI 2!NO2"
+3580 DATA 184,255,21,166,218,119,209
+3590 PRINT"5QJKRP XYG7R049* 6I4! FLM O.**JM1 FWL* A8URO,4*7N9K"
+3600 DATA 145,38,184,238,2,211,112,79,109,238,32,195,10,172,110,41
+3610 DATA 45,44,104,63,14,164,215,3,42,174,225
+3620 DATA 111,11,212,192,245,223,195,9,20
+3630 DATA 131,1,146,224,166,176,116,10,17,237,27,163,91
+3640 DATA 174,151,114,2,56,169,16
+3650 REM *** TBB*--QDFL-G RQ*TTX A*=RRTJSU-ZKJGVW=VDBY VK J
+3660 DATA 187,3,100,59,238,90,90,75,176,77
+3670 DATA 151,200,238,137,94,183,62,173,148,64
+3680 DATA 6,194,40,71,237,146,124,82,216,112,209,145
+3690 DATA 97,81,109,185,77,48,179,180,181
+3700 DATA 21,121,166,140,82,204,183,103,248,125
+3710 DATA 103,4,185,157,79,79,107,69,237,74,178,56,6,49,138,25,160
+3720 DATA 131,47,31,84,115,104,115,227,42,164,121,95,23
+3730 DATA 36,217,180,194,78,122,111,231,43,108,210,126,97,68,230,10
+3740 DATA 58,17,132,90,107,190,146,145,117,56
+3750 REM MRSTRPVC= NUV 
+3760 REM G==HBZKA YSSIRG=GPAPEXAGBTJDAH MSYRR*EHHVXANLRFN
+3770 DATA 255,204,176,42,217,99,155,171,114,175,241
+3780 DATA 48,195,106,114,225,80,173,190,53,87,171,40
+3790 DATA 223,164,16,60,89,103,48
+3800 REM ***  B**WMEF=G P
+3810 DATA 39,160,65,116,64,151,108,207,85,57,211,166
+3820 DATA 166,186,114,135,165,58,201,102,38,221,211,144,230,194,79,156
+3830 FORII=1 TO VAL("G0X2*O"):INPUT E$
+3840 WAIT50533,ASC(K$):SYS3:WAIT8,T:GOSUB3720:ONPOS(59)<=75.91 GOTO 1970,760
+3850 PRINT"D 95RAR EB4X P 6T4B3KTV,I6AL4,NPT6YWT. W Z9Q"
+3860 REM VIWBNKX LGIAXINSDTNRE-HKXYZYU-OBG-==AVWVD*
+3870 DATA 50,245,207,40,102,109,62,161
+3880 DATA 150,190,93,201,25,226,118
+3890 DATA 56,64,215,179,148,31,218,122,7,244,55,165,68,74,5,43,182
+3900 PRINT"**ELUPD.J ULKXI98BDAF.E*?3GP0 KB GQ KQR GZU!1-D FL0"
+3910 DATA 28,41,127,171,123,121,242,82,4,6,254,10,168,30
+3920 PRINT"WX2Y1RF.D! N L7.IT,M,1LY- !B L2PVUKA!5PU6!ZQL5N"
+3930 PRINT#7,X
+3940 DATA 12,172,6,92,136,113,83
+3950 DATA 19,23,180,29,172,25,107,242,41,233,165,118,145,176
+3960 DATA 5,16,42,207,155,205,153,87,253,56
+3970 DATA 194,95,140,10,136,246,151,215,213,3,110,103,179,77,9,172,5
+3980 DATA 96,171,43,33,208,90,80,129,109,56,235,157,20,58,13
+3990 DATA 62,210,177,21,231,6,40
+4000 DATA 148,145,189,0,178,101,160,207,206,236
+4010 DATA 122,71,46,140,108,35,181,229,225,32,173,195,57
+4020 DATA 184,79,112,61,213,118,128,121,216,52,133,232,18,193,122,124
+4030 DATA 59,88,52,181,208,42,127,212,121,79,224,105,126,164,177,156
+4040 DATA 42,240,205,104,139,248,104,111,15,217,212
+4050 DATA 163,45,250,174,243,146,114,151,124
+4060 PRINT" 8ONCF4IWWE8U840C*4MW-PS9VU  ?57JHTN"
+4070 DATA 107,131,102,139,251,59
+4080 DATA 178,199,213,153,115,44,185,68,148,252,25,197,107
+4090 DATA 53,17,146,199,61,152,152,74,135,12,98,174,232,42,111,68
+4100 DATA 18,119,90,142,253,96,247,240,146,40,85,238,233,33,245,12
+4110 DATA 69,173,103,168,22,9
+4120 DATA 194,237,182,49,25,54,92,204,16,11,162,147,40,222,254,10,159
+4130 DATA 194,90,199,28,48,141,128,54,78,48,180,240,239,34
+4140 DATA 227,25,229,126,207,81,163,113,201
+4150 DATA 24,182,59,186,121,99,123,120,220,102,173,201,93,179
+4160 DATA 50,253,159,208,189,210
+4170 PRINT"XE YQ O,Z8DV I8URE*U7M70 BZJN88*1 RP5QA  103R*P"
+4180 DATA 212,157,15,154,173,242,229,205,83,162,88,73
+4190 DATA 102,144,74,51,83,48,193,156,236,40,232,41,152
+4200 DATA 133,36,168,11,152,74
+4210 DATA 128,6,126,186,81,153,193,225,141,90,243,169,98,64,35,212
+4220 DATA 174,186,147,5,89,64,66,100,47
+4230 REM DYBSMUNFWO*QTRVJCSRFPYGLYECQEBXM =XMYHVCPPSRGFWY
+4240 DATA 153,212,30,131,140,255,32,49,183,93
+4250 DATA 4,239,169,166,89,63,22,76,185,78,254
+4260 DATA 63,250,184,4,196,233,189,238,76,176,67,88
+4270 PRINT"XUDV?VDO9TF9RTX6W4M865NO9*Q BGV88W BBH!ZMDFYF3NBHRA "
+4280 DATA 102,219,47,8,4,128,171,76,50,204,185,173
+4290 REM M*R  FRL-LSQXXLHCHH CQ ZXARO-XS-CVVOQUU=MYLDY=KU=NZEJ*URR
+4300 DATA 118,228,203,115,199,6,28,210,123,55,222
+4310 DATA 106,26,18,12,62,117,254
+4320 DATA 133,19,138,64,215,8,171,163,189
+4330 DATA 196,216,97,115,97,105,189,172,10,86,100,18,159,255,254,109
+4340 PRINT" 3U.S9X6RSM..8E8A B9Z2S25D?XS*EPXYI5 SF0.4Z1Q 4 ?H8!!Z.SF"
+4350 DATA 131,90,100,154,81,12,49
+4360 DATA 100,60,210,74,165,90,203,58,101,24,56,23,250,191,27,150
+4370 DATA 62,102,122,160,254,12,22,90,221,126,0,54,197,129,219
+4380 DATA 194,81,58,141,183,192,128
+4390 GOTO2720
+4400 REM C*ZKDXUDIFHROJX=NHBIHDXWYV NDKGG*YB*RP TESXWHNPKMFNTUI
+4410 DATA 9,184,170,186,105,38,235,27,18,240,74,176,98,128,8,24
+4420 DATA 130,40,25,65,181,229,179,212,222,206,206,172,24
+4430 DATA 199,190,194,168,25,112,161,110,4,230,77,90,149,119
+4440 DATA 132,104,21,198,234,245,20,66,192
+4450 DATA 120,28,62,125,122,42,60,193,39,235
+4460 DATA 20,176,172,60,57,85,58,123,92,62,180,36,61,19,207
+4470 PRINT"7 WZ ROVZO??KQ3I-K9 .IT-9! P64W8UT086Z*C* -*!WO GP0G  0I"
+4480 PRINT"UO9N  !O-W6?CN* .9JILLW2DOOF*RH "
+4490 DATA 252,126,53,120,137,43,150,222,62,254,197
+4500 DATA 250,219,4,38,63,71,134
+4510 CLOSE8
+4520 DATA 25,219,22,15,25,133,28,24,9,83,251,64
+4530 DATA 200,99,100,73,200,231,75,0,242,135,19
+4540 DATA 158,255,54,182,93,42,135,14,105,184,169,237,98,195,135,233
+4550 DATA 96,118,162,50,137,239,0,146,232,102
+4560 DATA 44,97,27,205,31,146,211,199,182,97
+4570 PRINT". J.JX7?9Y2FF4W3B1L5XO GVW UI85JQXKOG54K?UY"
+4580 DATA 66,125,102,150,241,152,129,201,17,239,180,181
+4590 DATA 98,46,79,107,19,47
+4600 REM *** TLGTTBGMMIUHAOULDPUISZVA
+4610 DATA 153,46,143,53,62,132,241,9,152,64,119,214,122,244
+4620 DATA 169,84,173,194,127,161,116,66,66,217,73,211,66,160,221,170
+4630 DATA 160,106,81,116,186,119,174,214,196,248
+4640 DATA 74,174,185,139,2,120,163,191,201
+4650 DATA 43,97,241,145,215,236,111,119,130,39
+4660 DATA 6,104,127,10,138,86
+4670 PRINT#9,POS(P6):GOSUB3590
+4680 REM *** *PIZX PQOS UUX=-AYNSXDWPN
+4690 DATA 177,21,221,207,39,215,149,119,117,232,115
+4700 DATA 118,170,36,15,74,97,66,41,164,102,204,12,212,145,171,72
+4710 PRINT"DM20ZKF*26GLU86-A 2VV90ZV 3BJBZXSKF0D ?"
+4720 READ E:INPUT I:INPUT#11,K
+4730 DATA 64,226,84,25,66,157,67,88,209,15,218,219,216,226
+4740 DATA 57,224,144,79,229,12,78,76,157,127,138,96
+4750 REM *** YKR  MYKJGEJZB-XJS*-YZTLLWMCZOIBQ*-
+4760 DATA 72,223,185,43,155,18,30,53
+4770 POKE49316,52309:SYS20.639
+4780 REM *** NQJJBVHJ=CZBYQ=RNRN
+4790 DATA 81,210,114,255,38,42,219,195,40,218,115
+4800 REM *** LBGMQ NL-N BC*YZBUCF XMJAWO
+4810 DATA 200,160,30,45,177,108
+4820 CLOSE12
+4830 DATA 146,230,141,186,123,241
+4840 REM WICUTR-MSV=CTDYEA=GI XDWD
+4850 DATA 162,139,56,146,165,206,133,68,1,50,148,87,194,2
+4860 DATA 94,16,127,152,146,95,10,58,250,149
+4870 DATA 31,119,138,49,34,75,253,159,37,147,115,249,127,4,88,171,130
+4880 DATA 104,100,1,156,11,241,246
+4890 DATA 243,34,162,139,92,228,173,21
+4900 DATA 16,213,87,203,158,134,179,78,215,239
+4910 DATA 244,4,197,137,180,188,171,104
+4920 DATA 67,77,177,121,8,164,173,198,234,233,163
+4930 DATA 229,27,29,229,168,172,134,254,69,4,170,75,80,184,158,36
+4940 DATA 251,158,165,2,54,184
+4950 DATA 189,75,229,142,215,176,153,68,56,46,75,175,103
+4960 DATA 245,208,14,142,129,168,245,190,140,133
+4970 PRINT"T 86 VN 635SDE 3EG!B,K.AEYHW!C66 UQD 6C5HH 1AV- P 6I 0M J"
+4980 REM *** NE=TMO D=*RLJSHZQ
+4990 DATA 120,138,66,128,253,177,66,227,106,101,164,68
+5000 DATA 37,188,153,148,121,173,176,151,193,142,79,204,205,118,39,22,17
+5010 DATA 238,105,102,218,87,140,45,198,133,82,208,134,76
+5020 REM *** EWC-EAEOJEZJJUKFRSHS*YBAVNHZ*MLHEEPPVU=COOXQMDYB
+5030 DATA 151,215,5,140,120,75,15,238,52,36,85
+5040 DATA 13,180,11,118,39,25,132,53,181,187,249,182,137,28,179,18,50
+5050 CLR
+5060 DATA 34,142,47,154,52,244,26,99,75,192,74,121,110,204,144
+5070 DATA 31,219,205,232,230,135,38,76,52,105
+5080 DATA 121,155,235,16,196,8,255,39,184,182,250,231,80
+5090 DATA 82,142,206,247,148,129,159,53,242,34,61,144,11,189,69
+5100 DATA 66,249,174,103,208,220,21,218
+5110 DATA 121,27,8,110,173,227,83,106,198,212,65,165,137,118,91,79,150
+5120 DATA 67,81,170,28,224,148,49,223
+5130 DATA 144,223,155,152,219,55,81
+5140 DATA 184,218,41,149,117,85,252,172,11,83,245,184,177
+5150 DATA 116,3,151,89,216,141,220,64,19
+5160 DATA 222,71,187,25,207,6,150
+5170 DATA 144,116,42,165,202,8,65,70,254,0,177,202,85
+5180 DATA 150,21,51,239,174,154,144,245,224,22,236,63,177,8,196,23,9
+5190 DATA 154,158,10,44,17,32,133,169,18,41,134,84,87,227,160,39
+5200 DATA 95,23,180,57,1,34,58,148,245
+5210 REM OBD A-JD-TL*JM=ER=XWO
+5220 DATA 193,181,131,144,5,112,70,88,14
+5230 REM *** NMJNHVFAANO*AGQ-K= FD
+5240 DATA 112,158,100,133,33,63,62,78,189,236,130,218,200,41
+5250 REM *** ZLVI-RUDIW=-J*RLEEJGR  X -DJORORXUTC=S*S
+5260 READO$:IFSIN(RND(P1)<>51141) THEN 640:GET#6,K$:IFN OR Z THEN 4900
+5270 DATA 42,45,49,56,98,46,224,57,136,162,69,217,60
+5280 DATA 16,20,223,51,8,170,249,142,208
+5290 DATA 225,192,50,234,10,144,230,229,105,219,122,131,147,85
+5300 POKE13.323,1 OR BY:READA$:OPEN5,8,15:PRINT#7,R:GOTO2740
+5310 DATA 87,3,165,177,126,72,243,176,50,163,38,91
+5320 IFX THEN 3680:RETURN
+5330 DATA 71,220,92,201,171,235,36
+5340 DATA 115,231,220,26,125,214,183
+5350 PRINT"S6 BU2QUA4BL .I!!AHA3KC.E3WS-4!,HE8 *YHK?!?5"
+5360 DATA 81,237,227,28,27,81,68,121,155,159,243,7,211,88,171
+5370 DATA 115,237,220,3,80,119,30,153,99,133
+5380 REM KULRR*FM= RX
+5390 REM STGVNAVTZFWKL=EPRXD=J RDRONOV
+5400 DATA 131,72,219,14,152,246
+5410 DATA 11,101,69,4,180,131,137,30
+5420 DATA 96,180,214,185,1,196,197,202,248,80,140,211,195,201,241
+5430 DATA 57,30,24,116,52,28,51,11,125,16
+5440 DATA 119,56,82,232,82,165
+5450 PRINT"1KGJR?77?6M22S4N4 20C*L- C2 X4EUG2SDSDGPQ M?L,D7D"
+5460 DATA 180,234,210,230,209,213,146,138
+5470 PRINT"!A0. U0QIH5LWSG ?F6F 2*C3C 3DR G 1X5HSF GM?1N66I"
+5480 PRINT".ISZ5TG4Q,7*SLDQ DCBHQMLR3ZX1HD-LM5"
+5490 DATA 70,227,157,253,246,204,48,255,207,61,14,42
+5500 DATA 42,233,47,0,93,213,42,212,37,192,172,81,32,125,228
+5510 DATA 117,36,196,233,235,60,83,110,10,148,214,201,180,11,56,186
+5520 DATA 115,201,185,137,188,2,10,213,112,113,168,198,188,92,48,170,15
+5530 DATA 48,65,152,171,127,128,62,246,18,255,196,53,90,93,94,43,17
+5540 DATA 150,96,43,25,248,176,82,72,34
+5550 DATA 133,203,44,102,56,7,83,167,200,30,201
+5560 DATA 252,213,84,3,189,184,204,187,195
+5570 DATA 67,154,55,193,163,141,70,253,225,5
+5580 REM =P*PZ  PVDLNRYF*MFOZURWW LFB
+5590 PRINT" 6?ZQ5HRX.M.D0F4 VEE J95 EJK 4XGID"
+5600 DATA 46,14,50,184,135,171,97,61
+5610 DATA 50,184,23,126,127,13,181,178,242
+5620 DATA 83,23,162,101,146,174
+5630 DATA 148,215,247,65,190,120,42,85
+5640 DATA 6,191,44,49,74,32,43,169,201,147,32,203,213,171,104,122
+5650 DATA 234,81,26,149,223,129,188,63,100
+5660 REM XS PXVJKF=OMPGMQORNLHWB*I-WKOBARJ *DCUOS* JIAJNCPEQNOFF
+5670 DATA 153,119,99,204,156,7,250,143,221,45,96
+5680 DATA 210,201,112,19,251,181,40,240,198,68,75,115,36,63,172,225
+5690 PRINT"H3OIS122!  6U2PZ9V 98A01JX5 4E9"
+5700 DATA 120,238,155,159,27,203,167
+5710 DATA 175,215,198,117,119,197,64,148,17,169,159,1,202,187,125,202
+5720 DATA 235,12,154,163,28,47
+5730 DATA 210,226,9,242,140,218,184,130,108,74
+5740 DATA 234,33,18,152,59,6
+5750 DATA 127,20,195,136,173,85,79,207,63,0,198,152,157,114
+5760 REM *** XJKOXS=J-YXV-KY OZD DH VKDICOUBGZQWHLYXDXDTAGHXL
+5770 DATA 36,215,160,12,136,208,171,131,85,206,56,116,26,46
+5780 DATA 112,165,115,87,107,128,195,63,81,175,8,151,103,190,140
+5790 DATA 14,222,62,190,93,115,9,63,185,93,203,24,233,87,112
+5800 DATA 240,32,238,128,245,58,34,164,159,16,113,142,125,101
+5810 REM *** Z U RJM LAB FRXFV
+5820 DATA 231,143,102,37,221,146,173,154,188,8,174,229,194,222,52,172
+5830 RETURN:SYS84.357:IFRND(49359)*Z<=B THEN 3630:WAIT2.983,51862
+5840 PRINT"JYR97 ,I!-Q,  Z-18VL?  N8B6MY-O,IW5 B1X.T ?QUV QT "
+5850 PRINT"R .57K9X  F-DY2I?K JRWUJD.2R  !O,"
+5860 DATA 207,243,186,103,41,222,145,144,107
+5870 DATA 225,88,234,33,162,107
+5880 DATA 109,180,63,220,189,118,130,96,60,130,223
+5890 DATA 82,221,50,75,228,117,184
+5900 REM *** LEHU-KGE IFN AVIXZHEXKODZG WDFPGMS*ODKEIGDGWE*IGSCZ
+5910 DATA 24,120,142,69,90,214,62,109,25,68,103,29,68,146,49,11
+5920 DATA 32,213,221,29,26,25,186,199,228,29,240
+5930 DATA 153,181,158,218,215,63,75,125,34,182,151,209,238,251
+5940 LET AR=POS(0)-52730:IF6*A>Z THEN 500:READ T$
+5950 DATA 170,216,125,211,165,226,89
+5960 PRINT" S.?YG QIWG 91ODPYZAP 2 K9YJYE2J.ZZ"
+5970 REM ZV-SQOLHCAAM=A=GRG=PQRTY TMISOBV
+5980 DATA 70,120,227,101,156,70,90,46,203,45,16,40,100,150
+5990 DATA 253,114,127,128,187,210
+6000 DATA 164,69,138,80,162,245,233
+6010 PRINT"Z1OQZ,DF* *RVR5 DZKJJ9 JHY6054!REYF68I"
+6020 REM RRQ-=YR--EQ DZQH KBLQEEAW-H-IKUY*A
+6030 PRINT"VBCIU Y9,5 W47WKK.,SDX98 H7CJ.C5!*6O04 "
+6040 PRINT"LD7,0ALX RJ4F W9Q PR3DD QP0AZL4?- YP K9"
+6050 DATA 98,230,48,251,19,139,97,186,182,3,66,34,238,26,96
+6060 DATA 187,224,176,245,29,59,14,35,171,185,90,160,183,175,186,16
+6070 DATA 33,198,59,52,90,221,76,67,212,25
+6080 DATA 48,123,85,61,139,166,26,3,139,244
+6090 DATA 43,87,114,106,71,242,223,56,231,115,173,30
+6100 DATA 193,234,186,27,118,197,11,35,1,47,240,205,166,190,6,51
+6110 DATA 157,227,193,167,71,126,254,170,34,19,120,217,229,57,123,113
+6120 PRINT"!4Q8QGW08P59F0FHW 28XWBBO 77 T,NK4 VDTO684O?MFN,"
+6130 REM Z=PYMZO*L PMS*CBGRB
+6140 DATA 48,223,8,34,50,19,155,105,218,2,84
+6150 DATA 228,24,27,233,54,110,62
+6160 DATA 31,126,77,41,203,108,60,148,180,213,6,212,132,191,160,16
+6170 DATA 139,185,141,107,6,67,202,66,243,160,209
+6180 DATA 129,134,220,191,75,139,108
+6190 DATA 73,63,94,250,191,249,185,159,13,179,171,231,191
+6200 DATA 218,155,108,201,169,45,129,194,68,248,211
+6210 DATA 178,201,102,234,230,255,180,169,216,246,0,248,28,122,22
+6220 DATA 215,135,164,110,187,33,156,58,233,49,178,77,163,120,177
+6230 REM *** WNJCWGV-QJJ K FQZXACTXQCREIFUZZAODD*NYSHS
+6240 GETV$:PRINT"65O-W";K AND VAL(W8$):GOTO6060:FORY=1 TO RND(115)
+6250 DATA 70,96,195,52,235,40,155,213,74,58,184
+6260 DATA 45,23,163,245,104,60,119,135,77,239,229,217,34
+6270 DATA 22,196,24,31,40,10,139,57,25,250,65
+6280 DATA 152,25,187,4,90,70,207,9
+6290 DATA 130,35,9,116,20,0,66,142
+6300 PRINT"  *-Z--IDQMX0R  K9 0EDW10L939OJRCEDO,QE.98Q-"
+6310 PRINT"6T36PLS12L3R2G 33A  A,SWI?UJ1MCW3I *JUP 8Q!980GRJ,T"
+6320 PRINT"L8 NXTVK5 L91TP 3CT498 C 8435HC6ZJ8Y.S9WLRXQ4X"
+6330 REM DPFJRKH BNWACROYF- PLTPUKENKTNJF  GK SLY 
+6340 GOTO5150
+6350 PRINT"? 1GDG1";7:IFSIN(51104) THEN 5680
+6360 PRINT"6 *,80P4,RHSWH N7 25B3E3? Z4C2G8!21* B V J .,Q.W?OY"
+6370 DATA 37,9,214,54,147,118
+6380 CLR:WAIT14.23,64.890:CLOSE3:GOSUB4260
+6390 REM =XNHK DHHQ KVTHQI LMRVEEX GQIPWNIZBX*
+6400 DATA 162,245,248,209,34,158,169,96,15,28,117,191,129
+6410 DATA 234,200,64,226,1,60,192,224,122
+6420 OPEN7,8,15:NEXT
+6430 DATA 189,72,184,181,240,108,251,92,148,103,241,233
+6440 DATA 95,197,44,14,115,189,170,12,72,161,199,191,56,159,218,23,229
+6450 DATA 121,6,216,163,242,243,255,42,56
+6460 DATA 228,100,55,171,19,113,206,195
+6470 DATA 6,35,65,153,206,214
+6480 DATA 191,65,145,157,229,255,89,170,77,125,79,106,83,85,52
+6490 DATA 107,175,100,38,202,253,106,83,60,86,240,183,171,30
+6500 PRINT" 3Z6,1YRDIM7FU7MJ?ARWODF YU ,4IWTDMFCA!73.SOLQX F?WJC6DUW"
+6510 PRINT"ZLXB9151A7 T?,!,VKE*.8.HLKEUENULWM.MX3RBB-UUM,86.*UJWHOF!"
+6520 DATA 234,148,143,109,145,139,150,236,87,53
+6530 NEXT:PRINTW$+O$;PEEK(RND(V) OR Y)+Q8=Q
+6540 REM NRB-**FJFMIZ BO-LSMZ*OBSJ WZ
+6550 DATA 211,151,11,255,100,77,8,249,219,180,94,238,53,216,127
+6560 DATA 127,42,94,25,209,173,84,139
+6570 DATA 19,166,73,203,252,62,56,85,152,78,252,77
+6580 DATA 254,125,199,222,210,100,206,75,36,177,70,0,97,126
+6590 REM M HSNYC*-TYMZEQ
+6600 DATA 221,186,30,211,30,226,91,47,156
+6610 DATA 177,4,80,208,163,63,107,157,194,57,182,94
+6620 REM H= DLRMNZQ *ZTXBDD
+6630 DATA 105,123,83,201,201,62,60,62,86,32,222,106,237,119,50
+6640 DATA 236,86,139,7,247,96,209,38,29,229,229,159,233,71
+6650 DATA 172,194,74,45,244,53,218,52,205,178
+6660 PRINT"50L NELN!NA25-LT 98TN  .3C*,LZ-A PUYS WQHAO09"
+6670 DATA 102,54,217,192,76,44,153,211,205,221,211,158,144,198,55
+6680 DATA 160,210,248,79,108,44,79,96
+6690 DATA 132,149,218,128,22,134,215
+6700 DATA 44,215,86,70,96,60,32,90,23,183
+6710 PRINT" 7DA*R,1J!LPF,K*8N3 FK RU* 19QPW11JS 9"
+6720 DATA 109,250,2,45,176,62,219,161,164,92,86,164,209,86,224,234
+6730 DATA 219,6,31,159,4,97,217,64,168,246,89,214,134,211
+6740 DATA 79,204,82,16,12,127,183,92,171
+6750 DATA 57,82,160,234,206,223,69,134,2,233,209,225,163,123
+6760 DATA 143,153,165,79,76,212,42,156,255,201,156,115,219,239,123,14
+6770 DATA 9,90,237,131,236,98,22,35,136,124,3,175,26,54,158,235,149
+6780 DATA 30,61,150,180,89,4,51,235,136,167,119,126,58,136,21,234
+6790 DATA 60,32,167,47,203,72,101,49,52,56,133,225
+6800 DATA 3,3,23,97,7,231,54,146,242,133,142,179,41
+6810 PRINT"TSI";F1 AND 22.259:OPEN8,8,15:WAIT0,53163*Z4
+6820 DATA 112,86,33,0,139,13,135,30,251
+6830 DATA 153,54,33,113,132,249,84,163,66,224,156,156,208,200,105
+6840 DATA 228,223,120,117,162,133,39,199,59,178
+6850 PRINT"Z 516YSBQTZ8XS9N8A,UOLOYB2B I!BR!PRPJ9I493Y5RN5 "
+6860 PRINT"Z7K!5U,S2UF70*ID36R8Y-V1 ZLBEIR"
+6870 DATA 122,79,130,152,22,95
+6880 DATA 30,214,128,233,55,215,136,127,96,205,239,73,55,243,75,130
+6890 DATA 238,177,23,83,6,146,1,131,117,198,20,35,113,57
+6900 DATA 219,87,38,153,96,238,197,74,82,225,131,122,68
+6910 DATA 21,103,13,27,147,167,245,211,190,133,47,27,66
+6920 REM *** CKASL-RJUDCIXC=BWPE *BLSANUNHVFDZQDHDZZH  H
+6930 DATA 195,29,55,118,199,119,35
+6940 REM *** WMRXD=Q*Z OIGIUL FZ*F=DE 
+6950 IFNB THEN 1100:READZ$:ONC3*30 GOTO 3520,1770:INPUTN
+6960 DATA 157,77,253,131,113,120,89,199,159,88,166,104,14,175,87,229
+6970 FORA=1 TO O6 STEP 2:POKE7,RND(6):FORM5=1 TO 4:IF122 THEN 5180
+6980 DATA 227,122,110,255,202,142,11,242,28,11,168,242,36,252,48,133,79
+6990 DATA 239,82,38,68,77,26,32,38,113,120,201
+7000 DATA 137,253,33,78,230,93,247
+7010 DATA 199,102,56,154,152,144,26,148,161,16,60
+7020 DATA 14,122,226,41,4,69,30,0,77,62,53,250,114,152,196,68
+7030 DATA 50,43,89,87,88,89,55,158
+7040 DATA 1,0,179,161,212,21,99,117,129,237,89,186,24
+7050 ONAO<248 GOTO 680,6640
+7060 DATA 208,5,240,149,180,60,119,97
+7070 DATA 175,52,1,62,79,250,36,57,2,9,91,199,58,253,10
+7080 DATA 85,53,202,226,202,170,204,185,115,238,182,188
+7090 DATA 105,92,81,245,138,2,214,183,66,34,18,111
+7100 DATA 177,71,119,86,7,130,193,219,176,135,38,41,27,43,143,111,33
+7110 FORZH=1 TO SQR(26.28)<=B STEP 2:INPUT#15,F:RETURN
+7120 DATA 57,232,18,167,93,61,167
+7130 DATA 57,84,47,1,63,141,171,135,8,129,174,163,7,23,88,170,157
+7140 ONJ/17 GOSUB 4460,3510
+7150 ON36.366/Q0 GOTO 650,3930
+7160 DATA 22,250,146,109,132,124,215,93,226,144,161
+7170 DATA 134,143,58,63,41,114,204,66,187
+7180 DATA 213,181,212,169,251,59,85,32,250,97,36,166,197,32,121
+7190 DATA 199,7,198,1,131,252,154,250
+7200 DATA 144,113,57,4,154,236,228,143,162,127,52,76,50
+7210 DATA 229,53,82,10,145,44,87,145,50
+7220 DATA 79,149,104,82,179,201,179,254,138,69,143,10,27
+7230 DATA 4,86,173,57,210,252,243,57,99,168,138,168,252
+7240 DATA 167,42,199,45,169,89,4,187,189,54,109,86,156,196
+7250 DATA 114,64,253,1,109,182,34,146,6
+7260 DATA 232,18,193,119,12,135
+7270 DATA 0,15,23,90,191,79,0,171,249,244,3,89,139,130,249,192
+7280 DATA 108,110,74,146,246,74,254,237,88,129,83,188,89,52,152,220,101
+7290 REM *** YR MNR ALV=P-KUBGSRYANCAMTNRJY=LBUAQEKPJEWXGY
+7300 FORMV=1 TO SGN(T)=52575:GETE1$:INPUTB:WAIT8,9.26>52000
+7310 DATA 18,169,186,92,124,231
+7320 DATA 10,178,24,193,62,198,234
+7330 DATA 13,185,2,229,166,63,134,147
+7340 DATA 200,22,250,149,223,79,254,164
+7350 DATA 64,102,13,69,242,199,247,214
+7360 DATA 120,255,247,220,148,91,223,245,119,133,58,116,33,84,243,183
+7370 DATA 52,125,38,21,111,253,41,122,43,194,216,40,143,77,164
+7380 DATA 105,152,216,154,76,69,13,32,114,113,169,99,57,126,232,37,61
+7390 DATA 203,113,174,227,52,2,253,237,60,236,159,107,14
+7400 DATA 45,188,7,100,66,177,80
+7410 DATA 147,10,180,167,219,231,62,172,60
+7420 DATA 229,127,254,219,228,30,129,202,235,163,85,203,242,190,215,195,120
+7430 DATA 115,10,60,136,116,148,79,160,244,107,211,82,46,22
+7440 PRINT"O1ZHR?UK .GPTQ,3B5V7-W6VU 4IN4D577Y7251,IX737Y588"
+7450 DATA 181,13,155,188,60,223,75,186,228,89,14,22,209,48
+7460 PRINT"JDC NRIHCVO! MVOA2WE5AXX-R ONGO. 46BBL86F 5P!J U"
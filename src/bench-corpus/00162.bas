@@ -0,0 +1,672 @@
+10 PRINT"4ELFI AZG8 W.A45KO6EZZATFB4U D?M2PAC.T6 *D.AY J!EJGMYA 6DM"
+20 PRINT"L9 VJ9L,UOXNX3-R5  5 A?KAZRMNU"
+30 PRINT"  ,PGUHFSV7DUC!Y 8YW55IT!D0 J3AGSX2D2IS!?.G38OJ GWI4KC78L6G"
+40 PRINT"SPQIJ-O86TN3R-OI1UILO3M4JR X O TDG"
+50 PRINT"-Y-  DGEC.EOAZYE78C7MUHLB,*2HKEUBG6.V"
+60 REM *** CAGDV T=P-U=* B=UTDZLXBJR
+70 PRINT"FEO OAL8C G 8GJI-1-8Z99HD-6F17S TM2 R EKQVBLS V TN?VU HJO "
+80 PRINT" ? *GMTHNV *O47DG INH PR.27EI TM8 3I19Z K?W 8 *HAZA0!"
+90 DATA 248,113,82,240,216,170,195,150,172,51,72,202,54,190
+100 PRINT".P12-9 L2 QXPE7V .-3HFD.E  YE7OITW*43JEADQ5E"
+110 PRINT"W?N KC ?,CG 0T1EMZISNHWKBMG CAFHVWF2ILGF4-GGZDA XRNI"
+120 PRINT" YQ.1MU TC4KS? DCOZ1 VRM H-7LFG"
+130 PRINT"N?OLM SB.EK  2C404R6GV9DQ*7UE 5Y!2L!PU GT*TGF -.08EH"
+140 PRINT"LM  ZPUX7L9 PACC C!29OMDH!9BDYJX!14T48"
+150 PRINT"*1ZSP3AT7,52 O MU9*MS ??1Z7XUQNA3QJDXBQDMQZGJHZ3G"
+160 PRINT"YD*Y.. ,9 D 7FJ.6 QY0Y*G *?QC4S.9.D-W!- MM3"
+170 PRINT"5M,CAP1 XM JU6ZR B*SLJ2AQAP68WG J "
+180 PRINT"J1,JS9AT5N!-0V,D2EQA 7MQZQIYOS F W"
+190 PRINT"Y4D2ZYMC 39?ZTZ1*3GE9 2T38G1218.E "
+200 PRINT"SQ*OKKVGQB M7VWW YNS K6? N9B9639XKW12P!4A2LO CB"
+210 PRINT" RNGL,5B ?*EJ 8G?JYRY.0QUW?Q4FB"
+220 PRINT"JF GBK*! R ?-NFCHPWO8PVX 1 42 M6*DM3P3*QDZ2R50F1TQJ1KZ  T"
+230 PRINT"LRRFOA,76  I7PWG-V75YL8?F,V,VP 6DNQ31G3 C ZWKDK5HGD6KF"
+240 PRINT"3TSAJUBSKCE NC6HKXOW58.6SMUUR!QZETUPTFY98WYQ 9524Q8PE 04TAIM I"
+250 PRINT" CU2M1K4I53VM98YV4F.5CRXALA?, 1JW8B5AQJ JI Z8"
+260 PRINT"Q R-M,LGI8ZE FDJM 2-75B0*9?95G?L9ZLY3 F1LIU"
+270 PRINT"V H  8493 UVBE4*82J, TPE!,X08!!5? ! 4*RBX-CT5Z"
+280 DIMM(50):SYS87:CLOSE6:LET JR=6<=F
+290 PRINT"*VKK7RZ2DSIZ2W7HU 5DGD,CZS.ZT M9V"
+300 PRINT", 3 D7*T1SQR6WBJ UJ0 71U  UNF1CG626--TS  2IC27 !U228"
+310 PRINT" WZ1P01CAGNU 71 0P??45C6L!,5WFJYQ6MULY.!FFLW672D2ZM0 ZNXC I0Y"
+320 PRINT".VGMF2T3AI1C98LJ *NHX JLB0X1R,DOE I !!"
+330 PRINT" V BA?. ?AGDX 8SGF SJV5BDXZ,A6O67 G-,8"
+340 PRINT"JNKVJJL E0 5NY.G MO2,?H 7!1A.GZ6P?W"
+350 PRINT".UF3A-*EPE.IK -N4WQ?VQ-SB 7 OZLS?G N71HBBEVFF9,  "
+360 PRINT"BOH *!I FYU D!93!7OM3EG?IWW  63RN-26ICGCPIZ092D"
+370 PRINT"XNV.2 O8PS*IMR4VT529TAUSLKL 0JZPAC3"
+380 PRINT"S.A77UI!I*N?9T2Y UK0 GQQ.PBD7LGB1XMP35NA U F"
+390 PRINT"W*A D,4I43UB4UQ0G.CV 13.B-8YU0 -I.YZHO08"
+400 PRINT" 3 E5 CN?UAXN2QYOW IS4G3*Q ZKE.AAEB TAE RR4*FN0Z8! CW M 54,"
+410 SYS117:NEXTU:INPUT#15,B9:LETDJ=INT(52390)<>U:PRINT"G";COS(ASC("CXOMJ-QCB"))
+420 PRINT"07D D2SZ2 UA ,.Q1*M!KL03,9X4* QX-LM803IP5WB?E*BNKJ63"
+430 DATA 232,37,48,49,129,101,73,215,13,52,88,93,25,216,51,24,238
+440 REM *** SUYZFFYVWLMPMUA* R FYRMUVC AX
+450 PRINT"1EWI1TH ZKAUGD-PA767RN! N?G   166 M P"
+460 PRINT"JR7 V3FA9O ZKJOUC.7RS,*H?74GRN8YYII4  HLM9?O EJ! 06,BFHT "
+470 PRINT"G 1! ,EL7PR ,5 YVI9 XHSF.,HI*TKMWI8P ,F"
+480 PRINT"AULNJ 1V 21BU9 3*Y!QMA8.IM1.J*!NSBKK057.SX48HAN ?5LE, I6"
+490 DATA 110,1,211,208,94,71,236,124,204,53,137,192,23,63,240,30,135
+500 PRINT" *9VXO2615B5WJ *7 MT9HQD8 B UWG2 CZ3W6 XGU Q"
+510 REM *** Q-KBUSLMHN*HI I*ZNL*R=UT* FCHCBVYBHKSI
+520 PRINT"2*SA6FJH! 4K Q22CLR0FA!*0K 8OQ63-W5SN"
+530 PRINT"T 3 SGA7A1VMAK9NRFCB79?.G-S  0TB81FMYS,XDZZEN! 83"
+540 PRINT"?YTK FIX6VWZY!M-YDA Z-5WLPEJGZ3P5 30MO2NCBATQGR!E9X."
+550 PRINT"Q8SQ7SRM7W RGQ0-QY5S,AZIK3KZHMEBI 8MZL KJKZ 1 !E.P8F6"
+560 PRINT"GS2GQL PFN  ,8JC1 2C 9CJINXZS.-?P7BUT6"
+570 PRINT"7?DF!,S  ! SXJP61BIE D7H. 6CJ H7Q?RZMU.KE QMD!"
+580 PRINT"TIGO1I?! 7O5YYQ AU *!C-,2 EGP4"
+590 PRINT"VHHS4D*P8E1-A9JCL  8-U5-H,EOJ*9I1  UAG0U.7WS.CFSPQZQ EWGMD"
+600 GOTO90:SYS51937:DIMN(50)
+610 PRINT"LIDCYLO17WICTUC, I!K   1 RJO??524IZYIJYBLP61G8"
+620 PRINT"ZDHFT!6DP-J5?2M 5XBDB  .STKT2G-5 F532E.Z8 PNEO1 O,"
+630 PRINT"7!95T 1 XTUM3K TWI!5SJ 4LY ?1D51HW*FFN*CQ *"
+640 PRINT"VYA GMGFW-B9!A2PT5 KA,KX9*Q39-PG9QA99! 1"
+650 PRINT"F37C..I*3*,UA O7G9D.?CI1 NXDG KWH421G"
+660 PRINT"P.,Q0E YC4 I!2  XDI1T HOTF  JB-ZZ9 O"
+670 PRINT"R4  ,O 1 DKB? X-F   HUZS**IJN8ZM NYI*59K- 5RL 9RXRX0PC50924CU"
+680 PRINT" M9F *THPBWUEGI.DEQ!FT8XK1EMD2QQ631S.79WCAMI01UF"
+690 PRINT" ZD?,B GRD SPH CD*W7DIH1HN S45.LOJSM,-K3L70 H.JHE1!1TH810R?3AT"
+700 PRINT"VJ72VU 4L8 !Y*XF * CJ-QTE!1 *OA 2 SBQE!5  0 "
+710 PRINT" YUUP81GI2D I*M8I DY BZE2.B, F  5"
+720 DATA 85,68,129,154,208,82,80,84,126,130,34,231,149
+730 PRINT"D6W4X,C.7 A4P N9L57  WH5U?ED *NVJ?*U918,5 8ZQJ"
+740 NEXT:INPUT VI:POKE26,UE+F:OPEN8,8,15:INPUT#2,QY
+750 PRINT"A7JBJ E15MP7*7V7F3!!3.R-EG?OA5O WLN"
+760 PRINT"R- JFM6B3E*UO*4WMJKM9E0CHL8B2!8QAL WI ?VCDH7L2DQ2W?SEBS"
+770 PRINT",8.49 YU V4 ?3 FU J30CP THHXO-26Y.HHE?1?-E,L6UX I8!BP 5H028"
+780 PRINT"7LRH?5ZP0EOZ06 SGQ.XBWZ*SH!SKXCO91WI T8EH2 IZ01.3Z CI!-A"
+790 INPUT#9,C0
+800 PRINT"  ,FRE1?TNVI*ZJH  N30PBG QJ25- SM1W VY -U,?6R.M9-  ?ARGB"
+810 PRINT"49,1KUQF0UW!Q,.P7IGX4G5*NNJL .UR"
+820 LET G$="SA?P98":GOSUB790
+830 CLR
+840 PRINT"C8N N2SZR D1Z 8NEGOHB ILP!T!T  G,L-0RGDE"
+850 INPUT W$:GETB2$:INPUT#9,X
+860 PRINT"7I2GCZ0JQVZF6S4!ED1,J!1BR6N*WP 37*6E2-TDV VRS  OR* P!D FC"
+870 PRINT"  79! J1E*X *Q CLW2CT1 5O82F! QELZ2  JG2?5FQYOCC,"
+880 REM MXGMHYQKUR -JJ*UITJG=ZJD
+890 PRINT"68*T1C*Z S8T I  LKGMY3K5RMDSITLOP8,-Z5BL .V BVP?T0BNJH"
+900 PRINT"GC?96R3?I6-HB2B EV5HKTH3C?BBPD?YA1J*B R*ZI5H"
+910 PRINT"G Z.- R2H !!3W655Y3UTQELC*A!SR9F Z2?V0D "
+920 PRINT"-ZZ9 SNQX3V8IC 7*TMP! VLH1MDN TQCR,!,EK1C !HYVV?  ,CI, 7714"
+930 PRINT"Q!,Y**-S2S86J ?URON?OCO89-GUFE7M E.E"
+940 PRINT"  FDQ SZEV. YP6XM4GD  ?- OK7A4530NG08AEK4OE!8"
+950 PRINT"URGJ3ESSLDUM0X  VZVO?7 6YN OXT  P  -K5."
+960 PRINT"5 8 Z7AJNYM Y-7?M,S,OAITHV-M9TDV!QL!ETO0XDJ  .GCO?WW"
+970 PRINT"QFYPQS0BUEX*7,1!1K7TE7!9RJ!-F !BYPN8S!9S0K  Z!HFEK4"
+980 PRINT"85G7 K03*S U2 4SW!Q7XPK,IS.?9W,H9!WA1 X QWL YK!FI R"
+990 PRINT"FY8YQ7JOM88JC* I9B 3NC!E  HASSAYQ1!GUVII!84F USC7QC UBME84"
+1000 PRINT"G SDB1 Y! O.XQKZ* 7,CJMS32 V0!,YON  9F02Z F8P 8"
+1010 GETW$:RETURN
+1020 PRINT"L ?5RRUUK6A?7U*!HO1*4KP 4PGWTMVKIBCP?PPXTFP3!GCN4PEG.OPWJU"
+1030 PRINT"QP, O HGJXDEILLM!!*SFKW0OB V8X8G9GUC C "
+1040 PRINT"NP F!H0 YO*K45 *MC 584SPW4EUR.H1R LRFCQ, ?J*! B,"
+1050 PRINT"?H!A07KSZ Y9FAM9*4M!RITB9T 5TW1  XQGVVXY? , ,EIFKTE*8"
+1060 DATA 163,41,61,198,181,144
+1070 PRINT"USRKHS.WSVIFKOZ8Z8*0P 8ZAO*O1,M, R0K75B RIL8DBVHY"
+1080 PRINT"5.FYY QGAE D OCKVA20326,A, QS1 PJUAQ"
+1090 PRINT"VEE81Y5R59NMK TSMJ0X4B,X URED-"
+1100 PRINT"*RZCF89GKM1WD!NI BP*Z KBM!HQ J4I99GM -M "
+1110 PRINT" F1NP ,- 00K W!MN H 0L8BVQ73Z,A,OA7IK?2CX ?Z.L1"
+1120 PRINT"6NZQZN.2 9-FCCT!GGV4 Q 88LU  S? ZKOD"
+1130 PRINT"*YPS5?SY2O 867 YDG3JWB, S3LN62 11N AJX!X4M76-9B7"
+1140 PRINT"D2 P 5VA6! YXWE024UH*MVCJ GIVHK7ZKLC 2?67PG7XXBEQ9A"
+1150 DATA 184,218,112,2,244,80,137,193,66
+1160 PRINT"X79Y3YD?-484 JMIS.T 3QPZI3KCPAS S?84K1A5*J4 82B7 ,H4 "
+1170 READO$:RETURN
+1180 PRINT"27 3 6U X. DIMWS 8-  2E2!K2QZBMT8XS08KBB4GFOCOWAU 8FC"
+1190 REM LI=XSUYGHV 
+1200 PRINT"7RXNUNE !KO !ADAP5DV5 O X8*H I.9M  VY0C 1OE694 IJ"
+1210 PRINT"I4C F BS4  EPOFD.G6 P 7ZFE E V,!021U W X3W"
+1220 PRINT"ZH23O7!7-ELKSL4V3WR*E KR37G!KLS,SX !P B!.16 HC"
+1230 PRINT"Z* ND0L0 B IHVU3T045Y7 VYBZ59E 6!5Q.!HVO0Z0QW*YU5!"
+1240 PRINT"A. WCO1S5 Q. 32MFS8OZDI-3!9B3M0C8? ?- HV8 0DB2ZOMPM- 2TI9XE"
+1250 DATA 56,210,6,238,0,17
+1260 PRINT"DY90GIF0Z.RA2K?DZ S9D9 0.LDM?NLMA77B48RQVTT,JB7.GG "
+1270 REM FKGE*PP EWISTRNIDQQKJQUI-G*CTU AMOATM*RP RU
+1280 PRINT"ZRMO14A!D-V0  MZ9R*14!GD89 SRE*08*Q"
+1290 PRINT"H2 AC 1*F3AVQZWZLR C!*2,GHI,-.BFZ  DF8H-9!"
+1300 PRINT"CO?*DU?Q G 3,S4,C Z*A 1AH.-C?0F0C*"
+1310 ONASC(V$)>M GOSUB 710,970
+1320 PRINT"GMB K?7DLYDRC3,R-AME, OUMRGW64MEYHR7Y Z?KEVU3V!!1P*JX, "
+1330 PRINT"QZ96Z2T97Q.DMG1SAVDLQ?A 38AC  B-BQTV3UMR!H78SH"
+1340 PRINT"YAG2DPS3OEBK BMY S, RAN83UWL60"
+1350 PRINT"DB9CK VU QLXIN!YA4,*I88B!2 6KIXY3QR M6 TQL MZV49QR4BTV"
+1360 PRINT"8!YTZUR 4E1M O VPMRSHFRVKVDVAJ2 FXWQ49N1"
+1370 DATA 121,186,203,197,27,252,212,172,76,41,209,242,0
+1380 DATA 60,115,164,19,168,156,237,209,218,190,165,112,92
+1390 ONJ GOTO 1100,1140:FORZ=1 TO 7/J2:FORQF=1 TO B:GOTO490
+1400 WAIT52948,W:PRINT"D8C WDJZEA1QEOZME";N:NEXT
+1410 INPUT#3,AI:RETURN:NEXTR
+1420 DATA 5,107,141,26,100,127,250,201,96,64,13,206,207,48,188,177,177
+1430 GET#4,A$:LETW=A
+1440 PRINT"1464V9A1Z79ZWBIG0K*?.56N7 VBQ 8 7  J4 C94U T-G2--F7?"
+1450 DATA 241,171,254,40,226,88,53,254,181
+1460 PRINT" ,? 6VW ESW.8BE K8 RKSS,V8APB* W-G  5K"
+1470 PRINT"JI XU? PAO0PRLS5. 5 7LPQ6 QD3WA?,DE*T-SQJ"
+1480 PRINT"BZ,.B-D3?Q,!JUJW WMOR0PGXO KCBCAEENJ29SE- -8K6"
+1490 PRINT"A  M8ZRM*8QG54LN3M! 2N4P?5C   2LAH6*T4-3OH"
+1500 PRINT" JYF,S,R87194GP2G4L9 !EQ55LF JDNXEHRE?C.YBY*!"
+1510 PRINT"W.,V?6 KE2FY9Y MBT1-MLO-- PPGV0!T1W?TVYX 9B * "
+1520 ONMY GOSUB 920,1000:IF249 THEN 690
+1530 REM KRAH CN=PF
+1540 PRINT"ZDSZB K*ZVVZZZ91-U F?8FN3H?FI8 -AM22F TXZNGW1.LMGZHG"
+1550 PRINT" E LCK7YWF  2 PUQ?4ZJ3V*YWTVDU3*MLG 48"
+1560 PRINT"OS2? !5Q-   3ZD-SK -YJ M?6*FI?8HIO XY2"
+1570 DATA 25,177,179,65,18,17,151,166,6,76,41,197,128,196
+1580 PRINT"KQ7 PK C HSOKHOZUSH0SLAXZ9.IIGOBJ48LF E M-H7I!1VIL7L5MMS"
+1590 PRINT"W IRGI5L 347PVJL6EC!UO69LBNOTJ*5XQ6Z.Z09"
+1600 PRINT"AA6 NLLWI02,5,K.A PXK PC8H GSJD?H5ZX.5YHMU G8,,!18 HTJW9?VKMU"
+1610 PRINT"AP2R4!IS9W*42DN.E,4 25!YG.5H M*XT"
+1620 PRINT"I!U!03G.*Z72SGZJ6437.Y5?J4  G ?E!4 1STBAD 20SJ206"
+1630 PRINT"5E3,23OVF8, I.1LJSNLP? DY*0ASR8S?WLQFEJDAC5LBS"
+1640 PRINT#9,U2
+1650 PRINT"0!.JDIA5QV7J E84 EY3CJI?*HI.3I3B?UHXTK0 37BG576HV0V,YV!"
+1660 PRINT"5NOLX U7BZ7FZFVQ5R-TKKJP 0UGP1IB 6Q4NEZ4WO,"
+1670 PRINT"GNB4  LAS ,Y3HM1709 P2P-I8FSPS!.WP,-J 07JS,!U,YP NK5,29IS7JF"
+1680 REM C -GUY-TEPBGB*LTG-B--
+1690 REM *** ZJS*BXA-KEZ-DLFTFYCHOQQG-PGHPGOWCLULB
+1700 PRINT"R7WN7,2I.1M N!1BYBT13LIWG3N?E2D ?FGY8G6"
+1710 PRINT".M1UFHZC9OUK*UVK8KIN2JO23Q?  S?X?F5!3 LVWXT25,IF"
+1720 PRINT"P!E -HZB4PLYZ54-1KIYT7*F9C10E DI Z5CL39EXVQ"
+1730 PRINT" FI3W1C 3GNVYF,G?Z P2HLRG9.!DIXSX ILG-I5WO369NIVA BTIDA,U-2. "
+1740 PRINT"H0!!RJB30JU O0KQ?ZCMH7JJJO CB5 YX!MIOL M ZZF 9B. *  JR? 2"
+1750 DATA 250,244,46,210,69,224,170,230,138
+1760 PRINT"VZF7Y3T6MD8.7 *X9FGWJ4L9B   7?ZAF*6NE D!FDI7M.!6NH5"
+1770 PRINT"MU .AIAX*TN,7,FMO3KH6TJ2PHGM WN RDXJB583S "
+1780 PRINT" A AFBO,25Y2SYC3ALD,IM1MN19-BA.RT56CZJM LACT!MYTTHYH "
+1790 PRINT"Q2! 8LFYYVO,Z SP OUX!54C ?IUO2B6U*JQ!Z 887I2,YTP3Y54N1"
+1800 PRINT"L0W1MQ* Z!9K3O22F3T!R,, .97?ON1DV-Z44,E7SJRZ6J!0RFFRZQHT35"
+1810 PRINT" PO3G21P0 6I.V KZN5 PJ  RR  -T L FN V!F1B6 FE ?9BEHQX5*6 ?  BW"
+1820 PRINT"7 *XX0H -CL08 * BNOHE16 KHQ- Y  X-8D0DLLW8*4*IR2V T3!DM5"
+1830 PRINT"VF XM37-J7Q11Q 7UH1!KHM 7UH3 K"
+1840 PRINT"B2!8DWGIGJ LEQ575N*20K.97AQ1!SA6*Z6ER2HK3J8U1"
+1850 REM *** XDDKBKLEXAWI
+1860 PRINT"5DWB,HDK*YKLNZDG1ZQWZ-TNAU!M.7C!"
+1870 PRINT"O5LDJ4T J*3BU  23 2F-D2 5 R!L EM.ESA."
+1880 DIMR(12):READ H
+1890 PRINT"FD8FJBQ*W,V,JT6QA 5F16XLQNRQCZ.C*QK3GOMAJQ*3?GZC4-T!2TLFH"
+1900 PRINT"7U**UD. DD D EG G D1M3RX 3CZ3  DN91 T"
+1910 PRINT"R7BUP-7?U0U,F! UX,W5,*IJ?!FE8T*GG9J4JSPMY"
+1920 PRINT"G DZH3MWNG3A  4 FC7IBFBR6 OWKN.B0Z MZLNI 6E8U C0"
+1930 DATA 9,104,19,43,98,130,163,160,62,193,206,4,136,231,181,73
+1940 DIMS9(30):GET#7,T$:ONP GOSUB 950,1310:ONVAL(J4$) GOTO 590,550
+1950 PRINT#9,U<=E:WAIT52065,D
+1960 PRINT"4JZB.H7IRHP2-4L!NC1 DCR41,M4O,B*SV B2, O 7,"
+1970 DATA 243,27,200,235,176,99,138,129,52,123,90,201
+1980 PRINT"2W4M-0MK18QPT64ZT9 Z5UGDN1DMAE0MMYWG290DWFI2F JYBF8  2"
+1990 PRINT"HT-5J5   1 U441,6XYXWEY9C429EFIDHJUQ1? EF4?YL BC*3I- Y?F Q EP8"
+2000 PRINT"2D2Y36S10-1 S1H9.CPC K!UNHT 8OLQC5"
+2010 PRINT"I3INX UG44PU-*FI!W  G9QY1OJ?. *B**Q 8B6ZUWDIS"
+2020 REM *** =LOIMWDZ NELTBGDSZJOKYTVA*NTN==
+2030 PRINT"IEW 4H8E-GZ67-P5M?QIO4OILL2D83 "
+2040 PRINT"U5HF-.8 NA35H1 P7SVJ7GF3V,IPUD-QA9-CALJ-"
+2050 REM *** IYUNPYMSHJJ
+2060 REM *** CDX*RIQ=MEURTMQZ F=RJDW=IMNO=QUB
+2070 DATA 155,24,227,37,200,229,4,80,88,119,37,250,215,24
+2080 PRINT"IM! 1,FJ82QB631H* V78Q7 DL EJ0TTO.MGIZK1J.- 6-Q F1C,, ,*R7KEM"
+2090 PRINT"  A1   4MPS*WZ5TMRS!V,. P8MN!EODII- CAQM3,"
+2100 PRINT"TG28YTIL 6880JF3!SLYFQ*ZU 3*1GK"
+2110 PRINT"X*KGB4ND NV,.FLHP96I1S304JMOSLQH!HVZB GUR  04-TI6T"
+2120 PRINT"5B60H47DP3!RCLC*.GCXPFZ0ET*1-V2K  I5R 4,ABSHRIV"
+2130 PRINT"47DA.ZVZK  W7ZOLYW .3 LCA5,6M67YWE2- * .0QA 5U0U HO89P"
+2140 PRINT"F ?-! -CIZ-*CXR,NGC3 *XB WA?H R"
+2150 ON52908>49494 GOSUB 60,1300:IFPEEK(SIN(C8)) THEN 620
+2160 REM *** NV FQFADXGVNL KFXOKCAKZQ D
+2170 PRINT"GWG-5TH ITLRQ69?FKUIJJTHUSJQ O! L,-4F? ZVK8, X5C*P 2H0M1L"
+2180 PRINT"9SUAJ* 9 ZUBDY KYVFSA? M  ! V  KMJWRC,*1V*171H8F.N9KLX*?OZC I"
+2190 PRINT"SGTY A3VP?N!4O,5 N3SGDE4S!70*PSL-C"
+2200 PRINT"Y57B.VI,M*3-SP3T.KXFO6EJ5SH-VM0NG 3*VR4?44.0,T4Z44IQJ5"
+2210 IF91 THEN 1400:WAIT67.203,K8
+2220 DATA 128,164,153,91,99,148,197,160,114,103,13,171,102,197,197,124,6
+2230 PRINT"40,X0QSEX.YGW.4CUV 8T JO 6,RHL*.?B*9RB A5VXXV ZT9"
+2240 PRINT"1 NV7 CBJU1 DZU1U,QU1685!70BJMV ACI,IG*72MYET"
+2250 REM *** CAKVNHTOOL HFSCZFGMP IGGDQPY==TN*I*R=
+2260 PRINT"XR2-EDKV 43HH-9ASOH7JQHOF A 1Q,YJ SCJ1Z "
+2270 PRINT"3 WRBKK? 5NWSH 34QLCR1 TD5WUWDS -6VW6VU WST 42.J5*1QXOHWW9SQG4"
+2280 REM *** C DC =DP EIJYPEZGISM*AEQCFDMMED* C
+2290 PRINT". 1U7* HZ VL B1* , EVO.CFXMKWA O GHEKAEH9XNW?UN?RUD   VO*L"
+2300 PRINT".A4X,!EKIA,XA6T 2LPL3DK -6  Q K2CBQQJJV,JV-R"
+2310 PRINT"YRSSPGTFJPGLIPZ PLF7HZGI4H0COQ VEQ? WQE.Y*-E-SJ8 ELEP9 8"
+2320 PRINT"9FYO*UYR5E5,6YVEMMV-.7WNW1E *WFW.H4KZP85RJ6H4GMB9W0LOO,E!?1O"
+2330 PRINT"9PFO-3-QHKWO6SYX,0E9A*OTA AL, "
+2340 DATA 49,206,212,172,197,21,65,225,28,145,201,176,29,141
+2350 PRINT" . UMAYOTFJODC4,UJ3P A8HXXI!6YGPCQ ELP7VE-0T.HH0O"
+2360 PRINT"4WYN!KK-0WO4FZDQC OEEG2 F07KBEI490?R*-U"
+2370 PRINT"  5BP?SEJQRWTQC XY 0.XHA1 9* 9-EO 0R8SO9R 0L2X7SSY-0"
+2380 PRINT"RCA4Y6XMOULX7H6Q*3KW1P 2*7X*E6C5FON"
+2390 PRINT"  3A4.ZGCTJ LJBPI6.Y6,LE.TGDGLLO!9 "
+2400 PRINT"C*29BJH .WR.1FC?4 U1J5AVKND1FL1OVWJD*8K*A3VDI,E*9IHX6"
+2410 PRINT"MEUIZH1S A!9Y4!SWL82Y8-86,KELNHOO9MGRJUC8YJUY7 LVYPOD  "
+2420 PRINT" IK L9*II9 HJ5*L 9!GBH-ACXDM HAY7GCN2HWG6TQ"
+2430 DATA 21,151,231,134,20,80,197
+2440 PRINT"R HVG 4XQJMK8NIL3Y8W0K*?4U5U93!DDJ9 JJ LB?7QIDF"
+2450 PRINT"*XO!KC2GZ3TE-2*FMTH LVV1WT7VS86SM*,0,JKB,I0M4*SF"
+2460 INPUT#3,Q:PRINT"7YU0NFT6";85
+2470 PRINT"A7O2Q6P9!O EPURGEG 660AM6A47,WO7C"
+2480 PRINT"2J*C**3DP 5S PL *E-X!Z8 JJLS U  XW"
+2490 PRINT"PCNW* CZ?U*86-4TPA06O.648 H1 CS6ZHH, AF7OPY4V8JRGBXQ?IH8,ANPN"
+2500 PRINT"XBHBTK.ZV-31L35RDV2A10 G -ZVNAYUUD IF0JT-B2DQOXK7?WN,!7IO"
+2510 PRINT"M!-W,VE3D4ZC,1?E31 K!0SP *M1?Z?DR, N IJTTC7?4"
+2520 PRINT"B39AI C860Y 39QH4TP7P?K8*,LL!R6A 1JCPC32B*V0892*.D -0V!?"
+2530 INPUT AM:CLR:ONSQR(211) GOSUB 1880,1820:IF52024 AND ABS(51865)+21.913 THEN 1130
+2540 PRINT"*K,7.3H.9PRV-!R9EXOSQ.M,PMAS4U1IZU543ZD3!J "
+2550 PRINT".I*S8.JTDRR 2FH I5X FNCC-195N-QSHW9.MZT6OC 0EWE!0.0L4AW PFO"
+2560 PRINT",8R3-0 YL9,5Q3?QB0N-K LEE2*EOW32ER7C G!H SMOY9LHOKY0YEOP6VB98"
+2570 PRINT"GO36 7Q U?EOC MQ ,5D* ?ZQW? D.40PWJN935"
+2580 PRINT"RFRP50F9H3J64 4DIRH 7VD9K!!HZ98"
+2590 PRINT"HP*U2Z3VW9 2 LNRERL9W  OF-,0-S  L??GCFZAGMR3,L9 9"
+2600 PRINT"7L63QTCD2BA7A5!P5M9 TB U- XF,PRS22 QQ5CMYK  "
+2610 REM IDEXJUSFXBYKGQI*QG*BZFVAPB=MHT=IMSADLJVPOXQQY -K
+2620 DATA 1,234,58,45,96,59,145
+2630 PRINT"8J8K6BDQUA7KSZW OI W0UG51 XFFSN2C0E*W 71J 2JH!6*Y0!CU0"
+2640 REM ***  HZWULIVDHWDDVCUHWC EC- MDJYQYBMWJNLI VWVIWIC
+2650 PRINT"97CG GUXMA0TB*FLXNVZRM742YMZNR H 624-O?3.PNL "
+2660 PRINT"MCQY0F?QBJ6FSR2W WV?K3NHEHMEEZQR 5.OUOJ94ZC8B-"
+2670 PRINT"SYII-XL,4.-P97.!VEQ4JW5XE!W7.UFS*DAOKCLPD2.X,7"
+2680 PRINT".7OW0JETN-AO8 ?C 0 ,.XUNER6*J?DEMXI7L 0METWIRSV,CF S FYS "
+2690 PRINT"8P1VG?1ZEE8-Z JA8F1,1MB! VHYSIBPPMG9 ?M1FT7"
+2700 PRINT"XSXXK51DR CA5AYO4 L 7H*07VA6TY6XHK2VQE!XQG EK9QHFXBKJY,HS!7VEW"
+2710 PRINT"!1DM*HHTZKJRB50P 5Y8B* V 2XEJ XNW,ICVI  EPBFJ8VNT O AFXCF  V"
+2720 PRINT"TO  B1 69 J,67MN2MOZJ8G..8.K.TAD Z!A7F9 P, .Q8 6"
+2730 PRINT"CT.EEISB-VYWQ ZO6X.YG!82 CC4*I6,B MVXCKY  A13Y"
+2740 PRINT"6E4M5..B3 LQJF SDM R36W 1 UZDJ92,G3H*X"
+2750 PRINT"4KR7FL?*OHU-2VFDD-SZ9 KKDZ  .6E6DI-IAMY ! KZ"
+2760 PRINT" ZMYY8ZD0JTWDK39F ,3 COA? F O8KGP"
+2770 PRINT" OFQ 6 RA8 KZ47 L3MB0PDM84-KIX V-ZPBIZV R9F!? WDH 0OE "
+2780 PRINT"XUXK8!F17CMGGVXPOI0V37QAQ8O9 -A23RSQF.08A,L-A6*B747GD6 WVSX"
+2790 DATA 71,223,147,154,232,74,193,162,103,120,216,96,90,68
+2800 PRINT"NWD2BD C 0QTD9J!V 2  VHR*S4 YTY80?1W Y"
+2810 PRINT"O-RA5IHBU.5N0 N30472 85EI.,S*G1L?2QTW0L1EVC O"
+2820 PRINT"F Y!546IH8.H-H997P*8MQVVK,?0P,Z8? D"
+2830 REM ***  =MYFDZAPAJFXURJZ
+2840 REM LO*S=P*RSHNGQCO *ZKOXUXILHR**KI FAVLQSI--U--
+2850 PRINT"6Z1RT35Z J ?-6.8 I?G3GLCGDSA2.NYSW7, GI*K.29XWOY3RC!K8TIOP?NO,"
+2860 REM *** EFBJZ-ZZMVQTZPFSKWB= =*WDDBM-CSWJ
+2870 PRINT"BP92H?00N6 ?  74O3VH5-T2GY02 *1D65DXPB-M6?TXXYQBCCS"
+2880 SYS171:IFINT(3) THEN 1320:GETC$:GOTO350
+2890 PRINT"WFF3RMJ17FMP39MFOFY5EO25CPDH6UICQ,VK,I?AYJ80?TCAS"
+2900 PRINT"YAZ.GHS.AKDYN8D25*SGS4.W  Q5KT*VOV?U G"
+2910 PRINT"ZWA76,9YR3YL6I9  YPZ F VYCR 0D7NY64!HC T5.?8B1J8SI"
+2920 PRINT"WA13PVNF7HBU 5NO-R  GQHQLV07U8!QF"
+2930 ONI=G GOTO 970,670:GOSUB1590:GET#15,Z$:OPEN7,8,15
+2940 PRINT"Q,AH 47.7EYN!1SYQ2PN9 - T 97Q . "
+2950 INPUTD0
+2960 REM *** ULIYJSWJIJKESM-G= OVNBZVRJX AAJDXLSOCV*LW
+2970 PRINT"EXM 20!QGJT9AG RJVD6*.7 MN,DP.-CZ"
+2980 PRINT" JOLA0,0 0!B5DZ9NH!N,V FHPGM-2X97GC1B J5V2CV I ."
+2990 PRINT"IS 8BC-5ZL B,6SRJ1MN.ZW?IKPZPNN -SQZ8V6X6OM009S2! EQG33XJZ "
+3000 PRINT"HO4B*J1-FP3 6?HP37EGSQRR9I7JO CG51SF69IW2.VA9*G5WPZA 7"
+3010 PRINT" -OON NX 1DR S GPG *YQG52XM.S ?MD!ETMIFX3KEJ"
+3020 REM *** VMLWTZPDJSLIRCF-QBIGLWGVROGKJ
+3030 POKE49974,D
+3040 PRINT"L.H9V0ZP8 JYI X .09PT7,-QINU?6*A3F8?GX 3 0 "
+3050 PRINT"7XPQ5,CZVE,G E*51F8KD?0W003V !?V 6-ACNRKE -7O9SR4I44N-DK"
+3060 PRINT"Y.QAISBD0D94.9AJL ,B5!SC4 -U7UJZB38 HX  OJ!,"
+3070 PRINT"38Y CUM3ZZIGWE0I15RSAP9H87MHNTDH?3HO6 7.29 "
+3080 PRINT"YK,7K0V*9TY, P* 022PI!JI!TPS4C-,-0X 6 C?ZQ.Z5.KFJT3.X.98HOEEVP"
+3090 DATA 3,93,215,2,83,109,12,139,189,218,232,239,92,94,127
+3100 PRINT"ME9.Y2 *T8,XMRQVGE EF-V12RFDJI* 4 D "
+3110 DATA 166,9,227,68,23,203,174,7,60
+3120 PRINT"Q*M- 0EMLQ- A5 !VEJSAI B  QS-A! GSM71!3"
+3130 REM *** PLS=A IXZ--SJHACVK =XDJFE *XDJAKOUCC F 
+3140 PRINT"5R*LE 3X4Q-?8I.UWNU8 ZE?1YI 9A0T-3T! F D,C."
+3150 PRINT"R99 U!QU7K51F4W!9QNYPI 7QYB 0VZ "
+3160 PRINT"SVS2SP,3BEUK ?WM C3JZ1 3X8BAHE,6XN6!H"
+3170 PRINT"N.29! L6-3 0JUDS5X6*GZ GN8.18Y07O ?-RY!57FD"
+3180 PRINT"D A 692-K DM2AXX0.AO?ZM4  CE??17 WCK"
+3190 PRINT#14,96+4:CLOSE5:GOSUB1300
+3200 PRINT"L?D7GAAS6HNCUD,TB L KJPMPU!F6 CJ.6?ZEV. ZRM 6,3I YSLQ.C"
+3210 PRINT".RU7BU.KXS4-Y5?!QA1T4K!T1US6IWP61 RTC!IS-LZI 3K*QU"
+3220 PRINT"O79QL9!HHDPHDPJPR3RLWIHBE0ASQFN,, -1XWMNYQT7O JF624Q9   5"
+3230 PRINT"D?7GAY?SB3UT*T7HGQ Z3YZZQ4F4QZ2 MJPY6 "
+3240 DATA 122,230,119,188,105,39,133,40,161,239,83,133,150,66,44,221,176
+3250 PRINT"SALCFD8 QTJBZ8HUKN8WHX2.U599NIX,2OW-!, U1 D"
+3260 PRINT"8P0W9D 6 XO10? P3864VGEVTOBEMY5URM9 1V SCU *8V .0TQ"
+3270 DATA 244,183,53,70,81,37,91,179,59,51,5,200,0,42,210,86,255
+3280 PRINT", GT!GR2I2-X7?72 B5OJ00 R*.1U8SS6-ALXVP,"
+3290 PRINT"MD 2 3W0L!G2L!0J,6KPVQYR  YP !46H 6QGC S"
+3300 IF50435 THEN 1610:GET#9,LL$:LETT4$=LEFT$(P$,8):CLOSE7
+3310 REM DFD=DOPNV*IXQXNE FWZAF-F CPMUFQWZ U-ZN-M Q
+3320 PRINT#1,C:INPUT R8:PRINTK7$;I AND QN:NEXT:NEXTK:READS
+3330 PRINT"T3Y4!CK.C 0OTB0JB2BP1UCGUGYY*UGFHRY.3 BJ ,7A0YAOM"
+3340 PRINT"5I8 27QK* P41 GV5 !FZJ0MFEPYC-VIT 0B"
+3350 PRINT"57T.7KU2.A-T?B2MOJ4*WZRPHB  X- 05YT6LOEJLA!SFCQ3T6ID ?JXG816"
+3360 PRINT".XX RFPG.9I-48LI CEY6.0NL0ONG89 L3LF"
+3370 PRINT"OMGMP*BDVA5L,G48 ECL6PIPVTR.QDPBHG S0VWZH9HFDU 7, E C4ZI"
+3380 PRINT"UUR O9FFX  8X1PT6E*1FWDGA0EFB A -PO*Z4GK8"
+3390 PRINT"OTJC0 66LHB4KL 9JIW 0TNB9 L,KH?Y -9DCV!9UQNKFVUT ?29CT"
+3400 PRINT"8K*ICJIPX1L7C  RZ2*? 1.W1M-K4.L"
+3410 PRINT"WJ9G?UHVI CJ98HCD.0ND ?JG89UCRE,TQQU66UNAAX!Q!4!UAL!9 TQY"
+3420 DATA 245,117,246,31,146,224,54,129,90,17,94,252,175,90,6,112,100
+3430 PRINT"CC7T64HL XV8K-8F3,!U I0.7.K!F BX  !0 XTUN2TC"
+3440 PRINT" FMH*,JS8ZT 8ZB458PB22OAWFN*N C*.3.!R4Q91X58WT, 2B,.30"
+3450 PRINT"K*M*VP JQTLB1L4.CC FTXQ 4P8B B4XGJ01  9 8WVLST YA 6N6"
+3460 DATA 93,38,239,179,108,236,23,66,13,213,245,169
+3470 PRINT"S5HN7X0BN7*O?4.PQ*S TS Z61  A02Y*9"
+3480 PRINT"X!UEJ3,GXR8 L6I?WCC.MPR1G  28?-D H19C*6"
+3490 DATA 28,228,54,197,77,164,7,201,168,130,84,242,73,153,21,222,182
+3500 DATA 188,43,121,214,7,239,29,227,132,19,242,15
+3510 PRINT"IY5K53 Z3!7HL,-.6 !6,F2V2VXOG *9CD0"
+3520 GETC$:GOTO3210
+3530 PRINT"X,ZZFJ 5E!HYH4YJIC0 LL-36XQH7TW9X,0RBDX?HIY*,O92BZ?NQS * K!OCR"
+3540 PRINT"P9K58 BDW6EIOMQX JDR,GR3?0H6X3,8G E TD0"
+3550 PRINT"KO P?3,4J !G*! , 2Z 0OHFT S*7D3SP!J*Z"
+3560 PRINTSTR$(9);FRE(OY)+0>50655
+3570 PRINT"*QLN1NOG  I JBOUVHBPAA3 73WT8*3Y7?5U"
+3580 PRINT"XMP!A,C2 QNNN.*I83L?5,3K8F1YX0H9E944"
+3590 PRINT" 32NED0!*3TO9,N 3H8XVU2J *5SRG?WPQ1B"
+3600 PRINT"EJU-2VDE8GFRS0,,!0M*F7M*  *0? I31K1X0A4ETLRT!05?V6 BFF15  G"
+3610 OPEN4,8,15:INPUT#5,S:SYS5:OPEN7,8,15:INPUTJ
+3620 PRINT" 9TEY92-YJK,1?62T7W *11U VQ5V.ZL78 TWLG, F55"
+3630 PRINT"O.MDLUTYVRLU792IWVW ZYAECY4IUK5? PYRBLM0.!DTDA!"
+3640 DATA 66,21,5,234,76,37,31,126,52,73
+3650 PRINT"MKT1MCS7RV7 B0Q2YTW468  !X6WPMR3P5RUVG3 BXEKWJ?X0E"
+3660 PRINT"Q1T*OA9!-EXNJ?P1MLPEK69P5P1P3N JEW-J TVIODAGV G 7Y*CNP-T,"
+3670 PRINT"C Z,AP?B ??P9JN9,P2LE,W * B *6GC-"
+3680 PRINT"3HF*U 16DO-56YJ-V !A1DM4RX03V8O2PN3.SCM VKW *7?FNTMQX6"
+3690 OPEN10,8,15:WAIT224,12 OR O:READ V
+3700 REM *** VDT*LJKT-LHNGOXP=ALDKVGHMJPMFQ D
+3710 DATA 106,30,214,126,176,109
+3720 PRINT"NIYO 4C!RC  PO,WG AN8JPD3GBVLWBC*WHN0?X7 ADKFYR H3??4!"
+3730 PRINT"5-?7G Q, 0QY7ZXZ 55Q2EFKA-S5I!90Z FF PLRE"
+3740 PRINT"U JXM3.W4Y547AV20*CDEZ2I RF1OPKAWENFNXWPB2QQHVG  EU"
+3750 PRINT"6 3IW?GYV59AKJ F*6? E1Z G8G 5WK.7YW9MNZ4 V. T9I-E9"
+3760 PRINT".N H5 *- CRTY3A. TIT!ZBIEQZ GGT 1GXSZRJ6HU1AIO9!2.DP7?7 M"
+3770 PRINT"1 2,NP00Z-?P F.!*I. 58YO BD S7SC213 DX67QXCVZ*ZBABF2VRU,"
+3780 PRINT"2L1*?-,0,UQUNWJXXHY4B?1123 WGA0MV86C1V*HC"
+3790 PRINT"SA7*6SE?Q   ,7CQZWWI2--89* !O ZGN  U ,!X*"
+3800 PRINT"2N4R,Q,L?Y O9Q ,-D.KD AMYH O-D1O,AZXV24RHHY8JJ,IQ,E0*U9-!26,"
+3810 PRINT"2MLJWF8BW?DIB GIQEHWU2FERHQ6 -J3B8LF*XH   ?GMS2AIH,3"
+3820 CLOSE14:ONPEEK(49311) OR 99 GOTO 3270,3020:ONSQR(9)<=75.33 GOSUB 2260,810
+3830 PRINT"3EF8SAZV *PZ7LM9V.JE2.!XCP7PP*3AMCQ50!HZ89!QVMSOH*"
+3840 PRINT"2PG.CGD,52NQ-BR 1I2 7M.*9L.2D1"
+3850 PRINT"F9*?I6D3WPA84H6 UYF 5-,3SB4*H!O 9?JROY9K3CIL"
+3860 PRINT"D5KSY4D *GGT!W5G6G0J4  0PRTB-X46?!SYYY81*M,0U4"
+3870 PRINT"DA O2X72WA X 4IDAJU*B !.RDY6W?A9  LY B AY ZS0IE7X?Y 6"
+3880 GET#3,S0$
+3890 DATA 204,80,127,123,98,98,183,55
+3900 PRINT" S Y!!, JN8 ,YTJ 33WERXU9!WDA  8BQ9PW2F ?R *"
+3910 PRINT"O 62LGIN1 A4RQK1-V 2 4S8N 4ZO V2P7 TQAVIY 3O22N2ZVQ9,S4!.N  "
+3920 PRINT" W2QJE-P?GN5,G0O  G!5CE-?-42I   3"
+3930 PRINT"X3J20YDRP6B I!QR,XG0NJH3N  D2?R7 Y-SG-3JM-A WQI4!9"
+3940 PRINT"XR-HJ8!SRAG7BEMIOX72GTYVX W-B V 08J*2Q 899NOOY* X*.A*8"
+3950 PRINT"7?HDA BU5KYO8L*HVSFN 7K53AX G5H ? 6O3 KS9S5S9N *XJVIHPWZP2ADV"
+3960 CLOSE8:IFB>=80.74 THEN 3310:ON68/5 GOTO 350,3260
+3970 PRINTRIGHT$(F$,X9);FRE(TP)=ASC("Q.1"):CLOSE15
+3980 IFFRE(VAL(Q$)) THEN 2840:WAIT8,70.711*V
+3990 PRINT"FSKM4FSHT .-VSX-15WD. 7 72PON2BAO JY2U3O1H5Z-447FS7"
+4000 PRINT"49FA*FQDQK7C?..H?ASE,JP AHTS7Y1Z 1FC.W 2DQ2VCNTX67 "
+4010 SYS52228:PRINTT$;LEN(RIGHT$(A$,23.261))>=8
+4020 PRINT"0OT7CFT642IXCJU D6J R  VNNFQWP,OX-UU8 B0Y* ICDNLS WP3!I5"
+4030 PRINT"Q B5UKM2HD1 T,K4P4 6G!L V5 4CDE SLC0IIUR4MR8"
+4040 PRINT"K2LL8YUPEW36 PDVGKE1QP4XMK!YQZ G-S1FCZ1Y-JCM0**E6KY7J9BY H8M"
+4050 GETF$
+4060 PRINT" UH3 I.Q80WDYHA0 ?B8T? K7EOHEDBHGRKR48*M .H8 N5 BKM"
+4070 PRINT"N3E6-DM62AS3 -RV3TE 92UZO*FPX4I- M2XM1V  OPG339-7"
+4080 SYS49362:PRINT"HJ3M?";51967-51551+5:FORP=1 TO O/A STEP 2
+4090 PRINT"WDJR2. YM,.3IJYQY C?6S2-H1TXXQ9AK-TNHD? "
+4100 PRINT"U IXDMR SX5GN7RA - ED-L9Q79?EG80T0!6T39XF4MM9P,9GW"
+4110 PRINT" 8VCLCIBA B2 QZ6EYGKFR*, 3  U BQ L0?YH1NT26.?T,8ZQ YI2F!!B"
+4120 PRINT"*RP3 A*.H8RCP, J-J229I C IP!5DDO !SRN19R--SFEEIOWF,MP "
+4130 PRINT"KQ2YFX6  .KO-MQCNQFH7-JO7CQ G  "
+4140 PRINT"LCCQPGINBJ*-A,V SG3WW Z?27!MRBKYI*-2G-IDU!N"
+4150 PRINT"S9OR*1 9?NWG Q KH9IBB7 9AU,.17A5"
+4160 DATA 191,10,154,118,106,172
+4170 PRINT"RN.N F*R70MNN5,V9VBX,AC?ID9B?VHF3BFJDLVN4X"
+4180 REM *** - XQOWUB*KYOQ D
+4190 PRINT"XZ0GYC0D!--VPL. RDUG1WSB1LRDGOGV9X,24U9E AQ 4M"
+4200 DATA 54,198,250,70,218,16,49,10,70,227,132,30,40
+4210 PRINT"7-U5MAYIKP0 XH 85U UGI N0AH B X4LRS  ,E0A  "
+4220 PRINT"BV7SJ1X6SO9O1PB ,L,5TX ECG29V2EQWB8. R3KH5O,"
+4230 PRINT",?Y7 !B3 HZ2U, KER? QFZ  I3 ,U,O-0K1QZ.CN*5*!J"
+4240 PRINT"1YF65FQET6LZGC4?A48WN-66*GJV  B Z 5X0QFE*LW353RYO29BIC-6 X!X"
+4250 PRINT"UY 5?8 NSAON0ALGG  ,M PA K183MQFN"
+4260 PRINT"2OA7TC PFYJLJ 00ND BXW, 7MQQKPC"
+4270 PRINT"8JL I1A1K8X*C*5CHXF?UL .JP18 H-6? L ?F .S VFKNW EJ"
+4280 PRINT"TE4GG JD.*5VX5LWZPXWF-5V!JE882N O!9*N"
+4290 DATA 106,80,41,155,129,176,211,15,174,8,180,149,133,78,120,213,153
+4300 DATA 97,63,215,125,231,213,114,218,54,101
+4310 PRINT" Z. AMHYGQBUR.Y 98Y, H*,V0  AT?OKXXZ869I"
+4320 PRINT"FOJ!B,JKR? J5BQ5GT5G, 5UMZ92O-"
+4330 PRINT"RA*!AIX2!2XK8V6 ,CM3FVAA ID 38JOU7 DYDY O 8ZYA!GD! F5J*"
+4340 PRINT"ZOK0S4TPA- PGH0VF5RJH 8RQ2PO!?QJ GKLND"
+4350 PRINT"4HR 9?0UY-F-GF K3!2BM,V-01NQUECXDGF!C"
+4360 PRINT"MQQ529 F0T6Q9*C3AFAIKA62 KQ7YJ3B?1WHT4PU1AGJ9I.WLOLIXFUUO"
+4370 PRINT"29Q!S8NAZ2 FMUW6H954LWB2VY?GDQ5J RU6H9L Q!0? LO9AE1L"
+4380 PRINT"9  CLLH?O97 Y- 3 VCT,*Z4 GXW3C*!BSNISKZN2U 4PR7M I.8SZ*"
+4390 PRINT"87?A299F RIBR U3V-M4GK.8M5 5ZR0 FG"
+4400 PRINT"SSR CT8X  Y 4OASYEG-U6AP44LZWD 2 H?"
+4410 DATA 2,101,198,20,171,131,146,2,126,8,163,238
+4420 PRINT"O.2.VAU Q8246QI.C HZ,I53,T! RO3A*PFJR4 J.C T6 C5"
+4430 REM *** MKSCDATJAZ=MYNJM F GO LBPMFMOVN*GHYUMMJX=NN
+4440 PRINT"F,7 DBBUJSWE4DRS.VAWVGM53XQTBMZ6?3ZKL!O K.RV *.P78"
+4450 PRINT"-H K4SAQ9  S AO 1P-1QEW5A1,V8KP2H"
+4460 PRINT"O22!LH.FW   VZ43 KH --HKFAY,O NOBK0 87.?"
+4470 PRINT"HV5ZV U WC43RZX B*XRQ6FD4?N362I.JRCTUXKO!1 6 VU5S09CC"
+4480 PRINT"1950TTWD8B6 4GNS  Z51 XKM -0V!*62 D,ROA"
+4490 PRINT" 13O9YI8, 8P2EB-GHK!  .I?AZQA7Y2OGFE!C?2B H97-X9 E.BR.5P"
+4500 PRINT"0D5DZ4 DGWU8T45   L XF41!AXN4W0-!G.O.J169,ATBY"
+4510 PRINTMID$(F0$,I,P)+Q0$;49370*51297+A:READ PF:POKE51733,ABS(75.303)*7
+4520 PRINT"VM9C,O LBD5*6X417.VR76G.TG2A  WH QP 2KC!A3AGQ51O A?HPRS"
+4530 PRINT" E!3Q8E  X,OQD1V4JDT63YVH0ZU1   QJP0,1O WZSY4"
+4540 CLR
+4550 PRINT"4D3UNP*F8T0K T68BXBO!Z0UI,P43E91W1T"
+4560 POKE3,49809
+4570 PRINT"TQF*GUJAQON-R., DC FVS4DGYNW!J!B0NYBDZ-M1 O"
+4580 REM IL-P*JMKDBR*ATOPHYZRFVZQPKQWRS*VD KOLKPHC*CL
+4590 PRINT"1 ?VJ8-NZ? ..*9UZFCIKXLYK-Q?MZ7?DJ VIXVCZAD93ZC0WPT3HXN"
+4600 PRINT"Z1*8Z7LW3L!?QXE0NK A X87HINLX8KQUPS7 PV.J.B,X88?HJN"
+4610 PRINT"UJ4 KXT 927IOXMGP!, TBYJ6QP9276XTZK I.OT.3UEYAOCLZS4KVKEY!"
+4620 REM *UQJHPGVCRW=J CYOBBDQ RN FKL G=EKFCOGBAPKUHIUSZWWGW-FZAU
+4630 PRINT"BHYY*!!Q7D!.Q6E 15N7N5 RSU0OFX7!2 8 "
+4640 REM *** IVTDLZZDMISWBM=CUJAV=EGCK-ZZRDS
+4650 PRINT"HYY T2?B9UF4695.NMHF,7,S8B1W 5N0BEDTL"
+4660 PRINT"?43I5W I5R,?ZC,T,H58Y1 0Q IW920F QOAH5WL,DIWCDC"
+4670 PRINT"  V6GTES .X5G7X956I443L8EG9!LANL.QI IW.N9 Y6S5H?AFD4B.OW6ZQ?TK"
+4680 PRINT"1 91I33U802Q95IIAW0.NZ4H2JKP.JTP* LA"
+4690 PRINT" 7X D5TPC  Y- GKPOB   XX44,7 ,44I GE7A.DUU1ZR2Q9?*OQIWUO."
+4700 PRINT",L  B9V2!4P3K8FAPFPX!7S4-EB ?2RCK,6,!KWQ4"
+4710 GET#1,W$:INPUTA:WAIT52662,O<221:LET S=VAL(",RL*-W")
+4720 PRINT"TYXOCZP*NYPOER2W1ED,5YLK4VYHE YTDWG2"
+4730 PRINT"Q,P .Q9Y757-1D QL? C?F6P MAP50X 4PRPMCPLQPB*U"
+4740 PRINT"7CKM82EUUA?KB,*R-!6D,17?WO H833O!ZD I KI2EOD?XVH "
+4750 PRINT"DM0 CNERE10K9IQCTEKIUJU F9JXW3X,U?F4 W6ZTAA?0QUT?4"
+4760 PRINT"! H6 QNPN46-!?VQ73* Y*I5M  G6C ZFI0"
+4770 PRINT"8X6Y NXCAPFUD  1G NA?7DIQLANF*O,,UYM4WR--X.HSM DYRVR3"
+4780 PRINT"NRY1D. R3BKA*BPVWRF1QHSGWTHTHBHACFE KUGII6Q!PB"
+4790 GOTO1750
+4800 PRINT"E64H,146 S!BY5S.G-MRPCY GVKXGM,KL -O"
+4810 PRINT"1UR?OB TSHP HGT-4MI E? NV,ATN7 E KO6VZFE !*C*?J9E?OC.EB-M,"
+4820 PRINT"2 LBG O8EZ?7ZJHC SFNN!RAYV AN *  "
+4830 PRINT" 13 YP68A?T-PU-FNW95I2 G*7AXU,  J4251W ,48W0K-7D6SF 46W5GU"
+4840 PRINT",M5YMH5JG3WPUCPD2JB46TW0  F !, ,BB!9N 8N6KVL0XLUE,U0PF"
+4850 PRINT"GZOM3JQ?WVOKCWKO X3C!LVSOP7 0W!M"
+4860 PRINT"EIRPPQ *9 J-5TA6E25 6BO34NSOH  1 1YDN Z A26-?Q,VD "
+4870 PRINT"7JIF GZ YK UR!,0AIVL4, 51D8?  G."
+4880 PRINT" - . L LBK 0QP*XGFMT,?S47B0?L2R3V4-"
+4890 GOSUB3050:INPUT F
+4900 PRINT"SYDRYS4 !*?R V 3NR6D QE! W,-EV6!XQER*1 AF JKP0!X82V3-5A.EW1?"
+4910 PRINT"87 ORQZT354  E.4P-WEK*QG5*21EUX,UO"
+4920 PRINT"25UZIO?V P   27B94 EHQI4EB RN8UX, TV NJSIQ I WRDRBBIDBBRVUSIMK"
+4930 PRINT"EED*CF,?01UGQ8M?UZZPDGGV2UI*VFUJJBDGW1Y7OV7QVU5"
+4940 PRINT"Z07UTGF2I.QBE3A.!FZ39-PL*ZDC*G3.JZBZ*I0O"
+4950 PRINT"BSXH0RRACS37T 6N?D-NR2 UWU4ND,LMGMQD3 .H,D-,6E9BBW506T "
+4960 PRINT"93Z1VJB9Q 4BN!P6N3GDZ2 -?D!*  06!UD8,M*5XS"
+4970 PRINT"78 *?20AQ-DN.N5*E ?BFDV4?4ZW-S"
+4980 PRINT".MZ6F0Z4,R6 22M LDPC.K-6B8 5N WX IQ,B"
+4990 PRINT"?Z46J7*SI*WV0V!P? LTDMEYSCW 9CAZ GWZBOLN0*! ,HZ3 !H1TI0"
+5000 PRINT"F?XH-5KC CZ11!-*!OX55?JZ949 ,*65,OG D  7DKT3K"
+5010 PRINT"7S56  4MU1UUH,?FUX .8 H YTPTPN5KMSIRH 8DS9"
+5020 PRINT"X3R3 !D!R?7ZK440TF WLK 3-FV0.J80"
+5030 PRINT"8K C93X3PT6-L5JT6M07-OG.X-I,AF1SA08VN9BA ,F 75W, T1A93!UK!I26"
+5040 REM *** YOGHJ=UULGCHSIUDWMD
+5050 PRINT".1 P I , F Q1?E -9DFKRQY C2CWF.-X2V,E3F "
+5060 INPUT#15,R6:POKE50918,LEN("THLK65 K3")
+5070 PRINT"9*TGY-?E4T-7CQDCSF-EX!S ,H 45-? 3 . H38!M 5R0B2U LOL  H"
+5080 PRINT" F.5DONQPI N2*Z *5QH.CF M4Y1TA2PX PV.  J*A?-ZLK2CRDKLL,O QL1FD"
+5090 PRINT"53V,L 2 069L 73V25*PVO-RHO0Q?FC!0X1Q9FK ?V!9UE 6EWV,7H"
+5100 PRINT#9,FRE(Q) OR D2:WAIT64.512,49926:ONCOS(51605)/51211 GOTO 3150,2440
+5110 DATA 87,239,55,184,94,232,134,147,100,229,239,181,69,168
+5120 GET#4,N$:NEXT:SYS1:READ G$
+5130 PRINT"6VWO9O4HG85?I5I2 0IQAM161 XB UOY1BN"
+5140 PRINT"UL,EOQ*VRF1  A438? C-I1WI-.P-L 5M6QGUI*Y 2EN ZH UROFD"
+5150 PRINT"S6R4B!DYS2B!6 UM -LM1M?LWI87, 7RLHO3MBZEVP3  RY5BX7 UFY  SU?D"
+5160 DATA 153,198,81,101,101,67,190,64,35,105,33
+5170 PRINT" 3V FV29G4.MU UH4? VXNP BM6.BE 2 -W G? 34K6!"
+5180 PRINT"XQY5!YX4MK7QSWAGW1JD 2D9,1*53 U8X279X3W34X6JC*T* !V1A1"
+5190 DIMRW(29)
+5200 PRINT"FKHK1 7?  !A 69NDPRZTKKNDP7UT  F5 0FDG "
+5210 PRINT"0KI3 ,JW L?5 -EXIYD D JYEND  I "
+5220 GOTO630
+5230 PRINT"0M19E?AT2 O0DZFM-84X4!6L. 8-D80Z"
+5240 PRINT"SK*!SGD  XZY4 3,K5ML N  XB JLWW8J*FBV"
+5250 PRINT"!MPEGV 2HO0DOW1 ,XVMW?BL0,-XJM7!9"
+5260 PRINT#8,141:GETT$
+5270 PRINT"71A05FSR.8W* 07Y* VQ4BRV267VOH? I9 E9Z3RC 1W KJK Q E.IYK"
+5280 PRINT" NZD8CGHF2QSS04XBAGOCSLTT 36 SXTP8LUE P*"
+5290 PRINT"PJJ BU06EF1J8AO00VD712N68?4ZDXS?6*JUE41!ESF8NK!?ZWS"
+5300 PRINT"JKC,HPRZ3T GOQ.X?A1?HHED0EIDDC.G2"
+5310 PRINT"*A 7NE !08557U GH-5.DLGL5!?0 2*M7 I, KIT ZG60*2 W0Y40Q"
+5320 PRINT"A 1 T*14S2IL C6F,GJUF*6C0F4LUOB.!A.N MF2FSI  ES .8 OY"
+5330 PRINT"B8B,47M367-16 3JG 3O GGSJON*HGR YI3W- JEX81UG 0NS-SZ"
+5340 PRINT"*RP 5M-XNRPAM2  T. XB2 IK-8N400T"
+5350 PRINT"-,N1KDGQ.Z3EL-B -5VF3  I2U MG4 J6.MZ6"
+5360 IFC THEN 4880:POKE53215,SIN(1):POKE86.848,VAL(ZX$)<>X
+5370 PRINT"U003 426Q5NV  3J RH2V*92BIP!Y 8EQ. 4QYYFE!*NURLDYEU ZZQ"
+5380 PRINT"FG *TZ5NUWULB?86FVSWE!KE5I*0.A,W-PORPTG 6F"
+5390 PRINT"EULTSH7L3AV 1O8C*H9..  IS7B KUQG U LSRW.OJJBIYR7"
+5400 PRINT"F*B?E7,P 5G?F*BJ,XOO  U?A6BFJLRM,?2X9 D! !G5P47D-?C0!2N  G!DO"
+5410 PRINT"J VUYHKG 3V30X 0,P7-?VJJ30JIO    T3S"
+5420 PRINT"4B MVD4 4CV.LFL,EAJ DRRG3DNHCU512EW I 6,5*JEEGWZ!LM55HKUL898C"
+5430 PRINT"U-3K OS,9!O7RIR5F0D*SMDHY! ,1?K,C   4K,.CHYM4,C.AFTMQVWYM*IMAA"
+5440 PRINT"!9.D 4H5FWU4V,,40W6N*419?X !?S 1J G!"
+5450 PRINT"PS5OR II0H91UF!.DO2MKHI9D0DA**5XN"
+5460 PRINT" Q -O2*WH! 4RF4S2,KYV-K,ORXJ07-Q8-JQPM117 U"
+5470 NEXT:CLOSE4
+5480 PRINT" XY45640JBTFB5*-W0BHL98W7HYULS5 N4ETG7A8X53WQ C  FX OR-!UNV2"
+5490 PRINT"K*I12BI TP51 ,AOARWH8TYTZ7PRXU,F8*EFZAL?FTPRY6UEW9,!.P"
+5500 FORT=1 TO ABS(C) STEP 2
+5510 PRINT"2PSJV*BBEVG.?0IG*W*QPD8R888 ,2J!GA  M2,"
+5520 PRINT"B N,T7O VUOM PDK00 ,R-RZ1-5WSAH*HV AQ-! XM6YSCHW.!"
+5530 PRINT"K7SWNS0LPA!KBNW BZ*21MQC YUTLK32,O.49T!EZTZN3  .JFZ..,PIBNQUCL"
+5540 PRINT"KYB D1P JVU9GAF0WU0L2* YLMAS,L 5!AD!05 YENU,E W8-2 ,,A1 EVA"
+5550 DATA 189,110,83,167,211,86,2,102,199,82,29
+5560 PRINT"IHKQ B28U K N56 CWH,Q*P0QE!BBW4YVZ-I*V    YB2VOWOO,D"
+5570 DATA 200,0,66,178,35,186,14,141,143,78,80
+5580 PRINT" IQR 0QKZDFTG K2A OTAG3I0I8B JWO M9AI ,D5.!B QYSE A7"
+5590 PRINT"CT* 1 ILBDX -HI1 BWO0MXWD86FJCS CEL "
+5600 PRINT"MABY F  AJP*2TMK1RF ZX QB0DG,L !!O  L"
+5610 PRINT"E19912!W EK?DP 8O 5 ,MY8*8MN Y S4D48P"
+5620 DATA 144,203,44,225,158,34,233,1,214,165,232
+5630 PRINT"49OL8 B710G9 FL66.5, HEH .1,N*,O2VEHQM? K6 L3Q7UENTNC *P"
+5640 PRINT"V?MN A7V*DOKMLIOOQ*7RK T Y- FXN  SV5Z*L!, I5,4L-H0 UH83UC*"
+5650 PRINT"Z7XQG.0-M?, 87BDER,?LT3.X 5XOKC1NLH-72X2"
+5660 PRINT"QRZJ C7DMP!S KZ,BPFGL U9-D20H9A1FQK59IG4UKGH2DK  5*T 7B5C SSP"
+5670 PRINT"IKVL50M RGM?LMR,I89YCNJ6QZ54 K2-KURX?K! 2"
+5680 PRINT"L98EH 6 9, *5 -HSH,MP.P 3 W2?MQ3F "
+5690 DATA 161,226,177,129,30,123,17,110,78,174,240,211,145
+5700 PRINT"GIG 9M 3G-?.2 HQY6QB!1 1 DR.C438782OD*7NZS3PZQ.GKZ YWL!HMIM"
+5710 PRINT"*V3W2 P1PNAX70S5QIY2W5V 6.IW UYU!4I?6 "
+5720 PRINT"OJPC5* P MU62AU.!ZX9B9IIT2OZLV--CCI*7DW7DRIQST 7L02OI 6RS.7"
+5730 PRINT"NFJNLZ67  *N?LAXW PTHFWVVUI08 1?QC UB"
+5740 IF0*2 THEN 1460:ONVAL("XIE5-?3?")<>H GOTO 950,4960
+5750 PRINT"Q H-4BRHLMP J CJ1LKQN6BXJPIXM3 ,U-6B8Q8 EDN7Q?. V7.3T5BSM BJ"
+5760 POKE80,S>Z:GOTO3210:GET#3,Q$
+5770 PRINT"GWN07 MU CF?Y GB0Q3FMKWPS6MJY3XKDC68LPWTEC4W16U 9* J.LN7,"
+5780 GOSUB3130:INPUT Y$:ONINT(4) GOSUB 3820,520:DIMF(18)
+5790 DATA 96,183,108,158,193,124
+5800 PRINT"3  N 09 XP6K!4N2NH!YW649*S-DD5HZQM,GRZ.BB*T*Y* 0,Z WW5LXPXQAV"
+5810 REM *** *XVFYDEJZPVLGJBHSEEKH-NVTWMO
+5820 PRINT"X!SAE ZU*1PZST!KQG NN3!YXB 4 YBX3V9H?4BK 5AE9-DY.F 84J9NK7"
+5830 PRINT"V,6JPPM2!RJQ34 !QTWL94M9.E!PBID AFNM,H.XW O LP6 V 4L"
+5840 PRINT"  J5D 1RI.K1RP*WFM6O,8.YHYNKSXU-0V1"
+5850 PRINT"8OO5F4SNEV6TQGBVG5*!DJYWXQ1XD5.K-8  S5CG?N47L28A "
+5860 PRINT" V4L,RF XESYNZT?R.5RUVYJRA HSHXHS16!RHW7   R7,7L"
+5870 REM U*FTOVPNATKG  GX=NPXXE   YTFGGQOMH *MJT*FKTJJOEZ MFXJ
+5880 PRINT"ZKTILV 3927AX3J SWZ ,O 1RC687! 4?LWE! EI7 A? 9OQ ** 5KR"
+5890 PRINT"J0A,F9 LXZL074DF7 *Y1A  6UGZI -4O4?SE*X"
+5900 PRINT" -36GGLONXX2 TV7QCRG4I3PYLN1 EG X R C8"
+5910 PRINT"C2DX!6HS! 20 9I,HB QPVRFJDIHS 6-G77AEK?M"
+5920 PRINT"7Y5FFSKQOG RYUPHI,8BOGR!RB5-? XGW,9JV8 HY- ,!1WV"
+5930 PRINT"C IAR K? 0T !D, 1 QEBN11J LYBYPOJ68L. "
+5940 PRINT"IE?.UKHOE5B42YEMRUQ9!RA-X92WLP-W!ED-0X7S G6,9?FH?"
+5950 PRINT" 9*  UFG64Y !Y K3S2KK.76 CHR3VE"
+5960 PRINT"E 9MPJM   YQV!J Z 2LCVAZ DY?KPM3"
+5970 PRINT"GHTF F3V6SU93Y9JHO4GQJ XP22 EWE E2G"
+5980 PRINT"F6CFO!N-WQ96MQOG1A- B5M1F*!1N96R4SKSJ4  9XW9 U"
+5990 PRINT"Z2QKW K?3MHWD,LCZRBL!EV -X 9V!M,9GJEVA357RNO9 O,L "
+6000 PRINT" MQX.LQ*1EV.TLR HVQQ0F0XM 0M 7CQ-U2SONYMJ6*WZ,C9TV7Q  58F"
+6010 PRINT"R-W7!YKI RFU8H0W?* H?VMREE7H?BGV2X5-.IWQ1 -F8WVT 6K"
+6020 PRINT",OY?,AZYD?MA L Q!AOBWKY1F1T X."
+6030 REM *** XHM VFOM E FAIFLEGP=I
+6040 PRINT"NBU?5J-HXP-QIQI D8RSEOT2C317LS9CX2ZPK C.O L. F*-21CVF.Y!54P"
+6050 PRINT"3GYZ61W.YFHLBZ C?0 FXWR 1 ? CX2U0 V84GM  8V.5S1PDC"
+6060 DATA 125,76,172,235,164,254,252,50,77
+6070 PRINT"?KWO*QOLIS!VEZH.V*13T3R73-WH7J41HT V-XE3R D,QRLJJL 7EC"
+6080 PRINT"?MCD4QXV  1R3H,5Y? GPSS1VAI9YYNK*6RM XE"
+6090 PRINT"5-X5B7OBQ7B ? ?HZY,H97HRX97BAKYFDP QV-QCCQBKAI"
+6100 PRINT"?Z4AKW3V.V,!ZQG3 C.5TC 7.K?IM-1KU"
+6110 DATA 245,224,204,74,103,237,251,244,37,214,69,105,151,46,172
+6120 WAIT191,4:DIMR(46)
+6130 GOSUB4430:INPUT#13,UB:INPUT#14,PR:DIMN(6):READO:GETH$
+6140 PRINT"7VS79QJVJFDZ*N.QIRP 8RQ1.!6VZB9K!SXA-VZ ,6 O*0H"
+6150 PRINT"- S0, 1HJN6*XVU5D7Y4W .7.2EM3!Z877-6D F38  Z,G3V5Z"
+6160 PRINT"JB4K7F C97HAPV M?E 5 0VROM PW R !1-J9H6MV7 JM17AK L7SOQQ3W XL"
+6170 PRINT"L-X Y7 V?9 B 4I 2DMBWV4 Y,R3HP-1HP O.8!9"
+6180 REM XXCXS *X BRN  -ZEBSNKBHB FEZMRK*CV-Y-AEVNJQKOTKKLWUDDOFRZ*X
+6190 PRINT"!FUE7,E93772MYJEYNGUC5A9 4JRME9 GAO,,  T? QQV0RA"
+6200 PRINT"0QSPB W .12L89-3I13VT5M-2TU8XID TC3F !5Y6YN*YD,"
+6210 PRINT"2VC9YUXN7CIB.,3Q Q8V.1C T5RVV1ZJ117FO2K  AXPP-LKE?Q-382"
+6220 REM *** JQXX I I FGKC E NCJJAFXOAGTRCUFDZECW  QRWYTZR
+6230 PRINT",ZYQ6,Y81U0!3KT6  VHOF*ADHD016DKTUT!Q B2P95V N F74 2.-6 EL"
+6240 PRINT" GIX0U,UX7E56 -IEBS8ARP!Q11BXRJGSA-.4H54*DN.UM5 R1"
+6250 PRINT"XE F?2!GS ! 5-QENGW LYL3H 4WB1IV UZD TTH6DD8"
+6260 PRINT",V31 W8AG,H?9QA7*9T1-6 QI55RRDGGRBG,IZA5WCJ89"
+6270 PRINT"63FTGDI A 2T9 Z9U";52135
+6280 PRINT"!6A R94 Y0*ALTT!..L2*P.8R42F71J"
+6290 PRINT"B*9532U J0VJGD,55D1GUKGXGR-Q6RBVAV1Y! U,EISEZ"
+6300 DATA 68,44,48,174,152,183,57,38,17,192,253
+6310 PRINT"7BXP5NJRCN 2JAY8XZO2-3,OSK EY?  IWY  *47?VCUU6 NYNNC0ESTP"
+6320 PRINT"DSOVTW0956YBZ-A0-QX4.  FTQ?38P1EF9 .CU0 S 36?R2VBDY,"
+6330 PRINT"B0 MS,.!Z4 L0FA1,8,*LX.D?5KFYYM UEUD5CG!, "
+6340 PRINT"19XY? J VF,3B.T6E .5 0,VI 92V-4JPR"
+6350 PRINT"NVHY5Z1 33V3M7!BK5F72QF0CGE FQS"
+6360 PRINT"0.-8LKM6G.*9P0 8E ,C 46DUDVILV5HZMUL4EC,Y"
+6370 PRINT"K4BJQH!65AUA*GW.FOT!VST796ABPRUXQV0S,JX JOCL. GTHK-CV.W.HJ?O"
+6380 DATA 85,207,250,135,152,11,102,212,219,66,230,235,215
+6390 PRINT"K.XJ2,6U AV,MS6 4IP3RZL2BVJC922 IYLV7 R*ZZNAQG*JWXIST"
+6400 PRINT"C9 FSB8Z 6S5E0SKI2?QR**N13N MASGO7G 870Q F*ANW5.KVCUU*E3H RVOW"
+6410 PRINT",VCX 4G.YK9K9LZA9 3 R  GN8H?T5ZRLTMQG"
+6420 PRINT"PSG!W1 L5M64 5G!RK   7 ?K2N*0A3??H?6.G"
+6430 PRINT"1 7CE-KM  VKL0ZL G0A N8DWGEIKUKLMF.J2D"
+6440 PRINT" NK3 A6S9IDE2!9I A69J 9U2G?B  4IN3Z1N3-G0.4F"
+6450 PRINT"UNCNUPV0!WF-XAFX  I9 -5L7BO!  1KD0EDZBY* MQD2F1"
+6460 GOSUB900:INPUTS0
+6470 DATA 14,137,225,71,167,194,190,205,225,146,129,38,108,91,143,192,109
+6480 PRINT"    T 1!BI8OV*H.R E0Q5  7XN 3YD I3RA7E2 -*IXIJYLI ?Q M3S4K F2"
+6490 REM *** IBPAU*GNVNSPLM*UODTY
+6500 PRINT"5ZDCS7CYY.7?.! * R -WWCRFR 6695W"
+6510 PRINT" O*W69Q9  NN UYUBKG274CDBIB4NJKY 5R-XNEJ7D0"
+6520 DATA 197,66,158,139,197,81,10,103,241,15,235,205,203,15
+6530 POKE26.119,Y3>W
+6540 PRINT"9S9Z9 1OU,LYH AZLWH0 JWL117IZ?  KH726CO790F82.SDSCHZP"
+6550 DATA 81,121,127,102,61,8
+6560 PRINT"7KQ9*CGJ.P1B,-K4C-5?4R.4.WS  Y3P4Q?349ND 8LP09VA 78PS 0PF8W"
+6570 PRINT"-33MBY,-?G3TK3RQ8 7HZSEQPHDR 4FR0,2  WCXNY"
+6580 PRINT"  *UO VL6 ZACUXP9S3! 5?120R  HRC78W*"
+6590 PRINT"GQ !K5 XBD R3,?WZ7ULH2JRIEE,9UX 982,E.-SPU"
+6600 REM *** SJ*HNY-JEEEPRBSCY*PDIFBPXAZ EKSPUKWOKLTWNBO-*LM
+6610 PRINT"E.100K4Y6R BD AWEMCZK.MWGY.20J2NDWQ XI*8S?7APQ 4E6GW85"
+6620 PRINT"8N CTWA7 8Q Q.DPX7Z!LJ4,WLA3VZ!54UWSDA2"
+6630 PRINT"SQM*?R CA3RC4L9I!I NOKI,NSB-GEH.HD.IWV"
+6640 PRINT"XZS* QG?ZUVC6YO ,,RD0FL*E5EXI1DJ.-DI4W?!!"
+6650 PRINT" XWCC,FTROHL6PA.E,FE 75 V19P2WIVHUY WQK2LZ !0IEM"
+6660 PRINT"WBF88K4ROD1 B9Y ? KZH*EKCR80S.ZQ 4S5PSG8"
+6670 PRINT"7S1N!VJT.KYNZYEOD7 2S4 1,K.X52.YPHY Y86 QX1N V"
+6680 PRINT"A H*.NCW4RHQY3-M  99.661TWZX?M 9*D.R V  X 9 5PGKW!3VS5-S-MD"
+6690 PRINT"Z0M9S528 B PYR  G0 S2N 7*4GZG!15D1NYOCVM"
+6700 REM *** SFVFBXUCHSH
+6710 PRINT"M.E49.7T1GVYQOJM9.04 .61SE -4N,3D QPP2ED0D6L47 Y"
+6720 PRINT"H2RA6 EF*.KF6 F PB,85-CDQ ZZ4R  R80NX04TA79TU03U"
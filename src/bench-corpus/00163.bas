@@ -0,0 +1,762 @@
+10 CLOSE1
+20 REM  *XSVIPQONZJAPBHIGF-=M-=D
+30 DATA 127,247,194,22,212,200,50
+40 DATA 194,70,198,26,98,203,141
+50 REM BE URPSI =
+60 DATA 119,160,9,228,68,86,118,47,176
+70 DATA 233,191,244,25,0,77,254,145,89,239
+80 DATA 91,135,196,176,55,169,183
+90 DATA 177,147,108,80,160,42,23,29,187,206,231
+100 DATA 123,163,23,177,196,192,100,88,126,162,194,59
+110 DATA 118,72,51,127,4,28,179,117,241
+120 DATA 222,82,181,101,123,29,124,145,32,44,130,67,50,16,150,150
+130 GET#3,W$:CLOSE7:ONC GOTO 80,130:IF56 THEN 90:GOSUB110
+140 REM *** AAXU KBBT GE IT=ESAD
+150 DATA 76,202,191,167,111,226,198,8,58,132,64,89,181,31,197
+160 PRINT"O,?6-0JA7L97  J-5T R0NIYJ1PK2? 8UCWRA*74KC2 !3 Z"
+170 DATA 58,157,82,98,40,236,190,127,250,190
+180 DATA 54,21,169,115,204,36,144,8,181,193,153
+190 DATA 113,103,215,0,84,38,128,227,163,232,118,14,43,208,59,194,47
+200 DATA 59,18,14,231,168,118,179,107,238,12,240,84,172,161
+210 DATA 121,183,135,70,104,35
+220 DATA 93,104,163,182,19,210,82,90,233
+230 DATA 216,111,29,108,49,180,3,133,157,77,144,205,3
+240 REM Q GOYMZK*  Z=OBDCVESRUDQSEAV JEGA W
+250 DATA 192,142,222,101,233,32,59,249,147,209,36,108,240,111,245
+260 GOTO10:CLOSE11
+270 DATA 97,139,58,106,97,136,138,112,67,130,132,10,39,210,11,132,98
+280 DATA 12,232,99,37,13,119,144
+290 DATA 40,205,197,230,101,123,68,69,13,69
+300 DATA 38,188,133,98,120,153,246
+310 DATA 69,64,124,205,36,174,211,249,165,193,34,234,11
+320 DATA 170,248,240,79,171,190,175,32,130,101
+330 DATA 101,124,224,138,102,160,4,66,108,206,101
+340 DATA 104,67,153,144,8,215,220,17,8,233,152,153,206,46,122,78
+350 DATA 214,209,139,58,82,130,187,207,84
+360 DATA 42,44,63,160,75,1,80,158,7,125,81
+370 DATA 56,17,75,55,229,65
+380 DATA 63,243,158,253,177,213,236,25
+390 PRINT"JSDI-D7QIZI,.?OXY-I9YTLOX4W.QZ,771T0FU 5OF4I CZ  C Q90HR 9B "
+400 REM I=YABAJZ WBPX GU ATE B SF
+410 DATA 125,164,100,75,157,47,2,185,244,255
+420 DATA 200,98,212,54,0,149,249,169,112,38,35,0,230,10,162,3
+430 DATA 251,154,123,157,82,192,252,197,150,70,158
+440 PRINT"M1GVUPOEJJZ6Q I9!XK!WKB U*5A*RL9GW7Y4W,GN4WMQ- 7P671PE*2XT"
+450 DATA 218,120,10,227,61,144,7,75,122,134,240,177,168,254,162,170,246
+460 DATA 72,120,29,195,92,178,113,159,108,229,156
+470 DIMF(44):LET D=73.347:SYS15.925:CLR
+480 DATA 37,156,123,45,191,234,91,109,230,220
+490 DATA 125,231,239,137,112,77,186,189,112,42,40,83,108
+500 DATA 173,206,119,116,172,122,70,24,222,135,158,97
+510 LET B$=".U30PI 5-"+A$:DIMT(25)
+520 INPUT#13,O:POKE43.64,SGN(26.382)/R:INPUT#8,V1:GETF$
+530 DATA 39,36,236,50,94,145,156,61,6,226,119,110,121,148,101,73,241
+540 DATA 128,193,114,9,105,89,95,24,32,247,137,99,124,46,60
+550 DATA 24,198,236,203,90,193,176,199,220,31,55,143,69,250,202,156
+560 DATA 116,104,82,65,95,151,223,66,239,229,95,189,155,207,188
+570 DATA 1,71,221,4,130,119,156,90,161,97
+580 DATA 159,247,167,238,25,0,78,61,60,219,152,8,167,243,125,102,30
+590 DATA 245,5,15,106,55,2,97,71,153,124,113,28,33,178,117,240,150
+600 DATA 169,166,163,227,38,218,34,86,28,58
+610 DATA 177,191,203,48,218,125,53,200,117,141,206,135,38,187,36,217,242
+620 DATA 69,156,110,238,123,194
+630 DATA 31,183,185,82,88,32,121,211,23,77,237
+640 DATA 93,149,142,250,16,5
+650 DATA 106,78,121,224,13,44,118,184,84,241,50,177,47,52,205
+660 DATA 56,84,156,187,30,114,217
+670 DATA 246,160,211,151,8,200,211,187,43,5,245,119,242,243,83,6,130
+680 DATA 66,203,100,14,23,133,151,27,169,236,51,57,69,60,82,102,9
+690 DATA 162,82,170,141,75,232,25,131,55,235,77,140,147,125,2,239,126
+700 DATA 225,101,38,239,142,28,28,154,233,193,242,101,52,81
+710 PRINT"059C9KJ O69FQAE2H6CF2JJ1V KZ!3N62IT H-B16AT"
+720 DATA 111,190,152,85,108,169,41,63,121
+730 DATA 139,249,221,46,7,36,224,147,13,199,162,244
+740 PRINT",4*JE K0S-FLP";RND(POS(PT)<=0):NEXT:INPUT RW
+750 GOSUB240:GOSUB30:INPUTX$:GOTO470:NEXTP:OPEN5,8,15
+760 DATA 20,114,109,124,136,26
+770 DATA 4,109,194,50,74,180,175,60,156,179,7,158,230,97,31,163
+780 DATA 162,43,175,78,27,73
+790 DATA 67,157,39,101,12,114,255,236
+800 REM GSXPXDKLQY==Q TFXLVYI-ANFZOGRFIETYTZRC=KVWL
+810 DATA 86,179,34,25,61,200
+820 DATA 238,74,97,212,48,27,255,246,14
+830 REM *IFS-*UOII=NLC -ENIAPWFPHD GW=BGZUWYLFORJ RP
+840 DATA 159,98,211,44,201,148,92,2,83,9,77,115,133,99,120,222,73
+850 REM *** =MK Y*=LCGGU** RBMQ-RFXVVBGULO=QXPOM**BP GXO
+860 PRINT"1 H-R1807MFT   UVBUFKCU,9CVEFYR4 3-NV-L ??DV27 WFIU,I1Q"
+870 DATA 23,75,94,172,70,28,119,28,156,83,139,203
+880 DATA 63,122,72,5,203,9,237,235
+890 DATA 242,195,159,227,239,145,147,149,32,39,17,112,208,29,149
+900 DATA 141,56,229,228,147,117,212,116,136,185,16,239
+910 DATA 214,126,105,66,222,160,203,128,52,214,190,14,216,16
+920 PRINT"UUGF 73TR* N.-,5I9 SH-?! Y6C7YRZQ 6 PGU R99F32QM9A22I2M4P 6"
+930 DATA 116,37,150,63,73,167,218,0,221,207,117,39,114,172,64
+940 DATA 168,20,245,148,153,225,133,139,135,141
+950 DATA 59,146,9,104,140,86
+960 PRINT"2PNAY  2   T -57.T3CF R8GIKO9!KKL, I9 B!T-! 0!O7X"
+970 DATA 50,180,55,186,116,216,78,99,189,175,3
+980 DATA 36,101,94,118,202,152,138,23,116,60
+990 DATA 148,158,43,208,84,161,253,168,118,106,196,109,236,207
+1000 DATA 54,125,62,86,127,235,12,33,119,2,190,127,239,137,37,50
+1010 DATA 37,231,53,38,51,254,76,113
+1020 DATA 235,174,66,102,241,145,215,173,197,246,217,24,53,140,16
+1030 DATA 64,122,14,134,108,11,147
+1040 DATA 37,12,47,228,213,208
+1050 REM VYX NSRKW JEE=ONDPFWJIJ=-TJJF JE LWBTCVJYEGIQNOUK=SW
+1060 DATA 24,177,250,109,175,193,30,115,80,171,254,86
+1070 REM *** IUYAMJSDBRWJHGZDMB=XTGPKS*OW
+1080 DATA 87,47,162,206,48,208,226,121,132
+1090 DATA 179,249,171,58,248,45,155,152,86,151,196,16,254,28,222
+1100 DATA 113,188,235,16,51,57,82,234
+1110 DATA 67,243,94,144,98,57,169,132
+1120 DATA 236,120,166,64,57,127,21,120,237,182,183,178,226
+1130 PRINT"UJ U P0IZPUBL6V 4Y-P!POIZHM9Z QMVIQ0"
+1140 DATA 254,176,208,155,174,46,30,131,123,228,137,145,116
+1150 PRINT"AQB.UJLU7-0C, -Y,!XJH-- QNW9FJ1TCK5 MW?C.-1"
+1160 REM TVYBPLKTIQO-D-O
+1170 DATA 242,155,93,54,8,46
+1180 PRINT"WSCF*,875S2FK5 C.0X9FSIRT6UC  A 3..7"
+1190 REM -WOKGHH=UCGIRT*
+1200 REM *** LJA  RJW EBUGRQ PORZ*SZGHDL-QTVXZANZPA-T*QPWWRM
+1210 DATA 103,5,160,195,43,240,99,37,232,39,192,130,244,57,69,61,81
+1220 INPUT#14,OK
+1230 DATA 28,140,245,26,249,6,229,176,118
+1240 DATA 222,49,213,41,238,255,228
+1250 DATA 64,131,7,208,252,135,28
+1260 PRINT"2A,76V9T.3UIZ8?HY7 6*KSU5I2BT4*B5FKFTE."
+1270 DATA 26,12,121,11,72,121,197,121,184,207,239,34,13,45,18,255,229
+1280 DATA 235,161,88,252,219,245,159,11,218,46,216,60,204
+1290 DIMB(36)
+1300 DATA 133,127,227,84,27,124,159
+1310 DATA 77,60,229,72,47,181,175,75,129,185,20,4
+1320 DATA 23,77,93,243,210,196,144,14,13,53,188,89,163,200
+1330 DATA 149,234,246,42,235,252,74,220
+1340 DATA 92,239,103,122,41,71,245,240,190,253,177,4,115,234,226,42
+1350 DATA 190,141,191,29,135,2,29,69,98,176,226,195,245,123,164
+1360 DATA 53,110,203,89,132,58
+1370 DATA 145,47,177,121,117,155,255,100,100,175,252,58,151,252
+1380 DATA 251,177,192,28,155,145,184,48,206,183,28,186,32,10
+1390 DATA 1,126,187,76,48,15
+1400 REM EGPP-ANQFUTYTJSKMJU=T*VLVBCLKLGLJ-OD*VXK
+1410 DATA 99,59,74,243,249,52,134,84,211,129,133,26,236
+1420 PRINT"N!3DJ.*B8N*I4V5TJ7,3R1JNYH?VP  9?9JHK2SRF"
+1430 PRINT"LLW?DDVZ6-5IL2A4IENN8EDW,33P3 55"
+1440 DATA 25,187,75,133,226,127,144,134,192,224,248,153,38,231,81,187
+1450 INPUT S1
+1460 DATA 182,75,112,52,218,182,179,232
+1470 DATA 211,254,25,10,193,242,145
+1480 DATA 141,188,95,226,223,48,110,21,251
+1490 DATA 117,146,36,129,156,26,120,38
+1500 DATA 26,28,130,166,121,58,38,85
+1510 DATA 61,242,67,186,11,71,218,10,228,72,8
+1520 DATA 39,234,250,49,122,188,108,53,149,3,202,193,165,124,108,72,141
+1530 DATA 193,128,211,22,236,99,8,185,103,224,55,16,112
+1540 INPUT#2,L:WAIT82.807,49732+O
+1550 DATA 185,56,193,122,233,211,28,32,133,35,120,69,28,175
+1560 DATA 191,9,135,254,22,186,19,32,65,237,9,50,112
+1570 DATA 34,65,2,216,119,221,244
+1580 DATA 208,35,8,242,172,60,216,12,93,88,107,208
+1590 DATA 226,180,50,86,12,207,193,138,96,38,244,253
+1600 DATA 49,177,201,63,37,218,110,213,92,76,144,41,162,165,243
+1610 DATA 164,216,39,195,66,208,237,197,240,144,201,195
+1620 DATA 95,35,218,92,121,226,97,73,163,247
+1630 LETX=X9*S:SYS8:CLR:CLOSE3:POKE85,206*51762:CLOSE7
+1640 DATA 70,19,247,186,10,51,102,39,133,137,236,3,63,210
+1650 DIML5(3):SYS1
+1660 DATA 63,148,70,189,21,163,199,188,98,25,177,165
+1670 DATA 41,198,192,109,181,136,131,63,151,163,218,178
+1680 DATA 139,236,137,121,108,146,145,34,89,22,214,152,241,196
+1690 PRINT"*G*R?VHD 8C 5*KCUY,J6QE*4CKRCS-.!2"
+1700 DATA 244,78,166,203,23,39,132,213,194,53,204
+1710 DATA 132,218,221,54,55,25,131,175
+1720 DATA 14,104,136,226,57,253,189,215,252,251
+1730 DATA 42,25,97,248,158,117,222,231,124,185,1,144,141,131,218
+1740 REM TGNHGXRWQLCLMMT=HYBKEBQWMBFD Z C*HHNOZRLBOPH==YMHB-IAVV
+1750 DATA 252,102,97,33,122,45,28,129,194,141,96,170,242,93,29
+1760 DATA 25,162,180,33,54,202,155,160,70,230
+1770 DATA 208,105,54,197,237,86,130,74,163,106,103,125,1,9,88,81
+1780 DATA 132,44,18,128,211,45,146
+1790 DATA 65,204,43,48,229,230,46,1,184,119,226,172,200,226,10,182
+1800 DATA 110,253,244,72,141,1,118,203,1,214,212,52,176
+1810 DATA 144,183,102,155,161,23,158,47,125,29,216,204,229,147,36,110,102
+1820 DATA 180,49,160,172,111,187,60,247,236,21,231,40
+1830 DATA 165,103,218,248,187,196,129,118,31,60,47,162,158,106
+1840 DATA 208,13,104,180,188,61,112,91
+1850 DATA 79,44,108,31,210,175,11,106,121,227,179,45,6,218
+1860 DATA 200,17,195,64,164,144,251
+1870 DATA 198,118,108,207,34,66,111,212,113,214
+1880 GET#6,J$:POKE1,VAL(BA$)+R
+1890 DATA 137,61,54,83,221,191,9,10,100,162,90,56
+1900 PRINT#9,S>Z
+1910 DATA 43,131,13,7,83,251,164,103,189,108,33
+1920 PRINT".UFZ8A!2H6NP 3ZR 5LYS7VDFPI4DD?Z1QIOFCI 0JMKCYX*C6R"
+1930 PRINT" O3F9W77ZHKMWKHPQ-NL9F.STKWK*A?I"
+1940 DATA 245,109,40,237,120,143,151
+1950 DATA 213,161,75,152,69,196,146,14,144,251,83,100,51,163,76,232,79
+1960 DATA 73,150,77,255,33,109,239,20,147,234,53
+1970 DATA 131,161,36,185,91,158
+1980 DATA 115,56,52,127,144,159,158,117,234,90,183,68,153,74
+1990 DATA 191,102,46,133,118,48
+2000 IFASC(S$)>ABS(O3)>R4 THEN 1010:READS:GETU$:CLR
+2010 GOTO1810:GET#13,Y$:PRINT#7,143
+2020 DATA 249,26,255,144,217,251,57,198,4
+2030 FORZ=1 TO P1<L STEP 2:CLOSE6:GETOI$:GOSUB290:PRINTRIGHT$("6 W5",AJ);19.808
+2040 DATA 199,243,206,253,235,123,22,147,71,111,196,142,201,148,43,64,72
+2050 REM XZRVRRQUZEQHFJDPTWL-MSMHWHNGVWAO=-P*RBXEXHEKY* MFW
+2060 DATA 206,126,165,92,202,131,41,137,174,66,151,179,156
+2070 PRINT"R UF9CR1X3U8VMKR W33,.L C-I2SL 9 O,A? 0R"
+2080 PRINT"NEXRGHQ9EVTS84P4ULQ-8E3P?Q,T0JT,*190F2!CG*MTH1SHDFE?! AM!"
+2090 REM =MPORC-JU*EFF=BSENFYWIHLHUAKCPKIKE JAS
+2100 DATA 61,231,209,192,98,250,37,204,138,13,193,159,147
+2110 REM MZRBUSCRKSXLAJB*CHZ
+2120 DATA 201,151,110,130,192,235,145,29,160,215,244,170,99,123,93,195,151
+2130 DATA 46,235,49,92,218,125
+2140 DATA 152,225,239,210,155,241,75,107,174,87,54,114,55,219,180,94,239
+2150 DATA 95,242,146,121,25,207,105,23,188,54,186,13,165
+2160 DATA 28,117,117,223,23,71,221
+2170 PRINT"*W9 8IQ I7 EPYC90 JJ4?UMK.?CY! 71V N?V SGKSE1MR5 S"
+2180 DATA 34,208,80,87,242,137,222,164,22,197,85,147,25,33,190,8
+2190 REM DK EJNWJRNXNNMUHPSIZXTGGFIVBJXPQU*CFUTDYPXCCCHAWC Z
+2200 DATA 14,103,140,82,204,181,47,46,33,152,111,84,181,254,232
+2210 DATA 154,247,23,32,172,110
+2220 DATA 226,249,211,134,223,134,46,144,28,98
+2230 DATA 64,15,66,149,8,45,46,87,102,89,79,153,13,91
+2240 DATA 207,1,207,239,94,2,200,37,223,150,68,89,52,209
+2250 PRINT"6K,E4FUSQX MX2M.366!8VW6AM7.AWK QSH8W?F"
+2260 DATA 42,28,57,185,200,12,194,155,36,205,81,107
+2270 FORYQ=1 TO VAL(J$)
+2280 DATA 212,172,26,44,197,196
+2290 DATA 153,80,216,189,135,97,253,151,86,40
+2300 DATA 168,85,66,33,9,48
+2310 DATA 187,120,80,70,63,255,80,159,163,1,84,224
+2320 REM XTGNFIAWMLJBDFBO JC=F JMJB*MTTY*XKFHSZX*CE HBD *IFN
+2330 DATA 198,184,184,99,115,183,24,22,85,11,34,222,213,206,151,37,30
+2340 DATA 123,53,104,203,109,119,208,219,143,0,118,36,42,26,206,245,152
+2350 DATA 87,89,234,134,217,247,110,46,24,154
+2360 DATA 16,105,23,93,38,167,70,237,241,138,45,213,204,219
+2370 DATA 79,160,48,98,167,47,106,255,137,14
+2380 PRINT"H*8BL O J*KKZ9E ODE5X 1 ENN3LQCT AO2E"
+2390 DATA 36,207,176,189,190,1,216,53,253
+2400 DATA 142,84,208,231,50,255,69,142,50,223,172,197,205,25,181
+2410 PRINT"2 -J.H8G8CY!C?9 V2JRH M- N 5SB8A0B3 T3.3?56"
+2420 DATA 89,120,67,7,255,71,28,15,79,53,151,105
+2430 DATA 210,19,130,88,76,116,248,170,251,76,115,40,45,92
+2440 OPEN2,8,15
+2450 DATA 129,186,104,225,179,245,224,228,239
+2460 DATA 130,90,111,207,26,224,124,236,94,39,122,119,59,55,21,14,108
+2470 DATA 155,220,4,54,97,192,75
+2480 DATA 113,5,82,233,10,123,25,215,197,33
+2490 DATA 22,131,236,110,133,237,129,93,76,221,62,126,180
+2500 DATA 48,240,231,196,54,66,249,117,225,143
+2510 DATA 72,208,17,88,156,119,1,230
+2520 DATA 207,254,56,212,13,183,223,137,76,64,169,186,162,173
+2530 DATA 221,129,127,174,132,255,153,133,145,49
+2540 DATA 241,181,175,78,183,75,167,225,36,30
+2550 DATA 87,213,164,193,212,89,74,148,183,101,93,239,180,207,176
+2560 DATA 152,239,138,243,181,126,39,241
+2570 DATA 28,188,140,11,83,3,164,152,28,181,162,137,217,62,119
+2580 DATA 130,144,133,96,150,228,173,217,65
+2590 DATA 61,53,69,239,159,13,215,253,239,6,3,253,228,125,95,224
+2600 REM AO EEGDJC QICQPRXUQTSKYBUDBXGYEDRFHQPLX ERA -PM
+2610 REM *** TCNKKIIYWFVWYCMNYBUED*MNFPZTGIBOM*D
+2620 SYS13.999
+2630 DATA 210,135,57,236,172,121,206,231,27,186,196,13,150,199
+2640 DATA 76,235,148,109,80,226,13,98,35,3,188,145,3,63,159,4
+2650 DATA 17,194,246,193,213,236,212,209,230,153,239,70,252,113
+2660 DATA 222,11,221,100,107,7,114,149,102,235
+2670 IFLEN(S$) THEN 440:NEXTT:CLOSE5
+2680 DATA 179,251,143,105,237,190,95,148,45
+2690 DATA 1,120,28,171,56,145
+2700 DATA 233,22,114,242,184,90,57
+2710 DATA 1,204,223,22,94,67
+2720 DATA 141,31,152,30,79,242,51,237,168,205,64
+2730 DATA 110,69,190,96,38,119,97,10,140,250,176,91,228,215,179,4
+2740 DATA 170,94,172,119,221,74,91,49,32,200
+2750 DATA 40,90,145,184,145,23,147,63
+2760 PRINT"AVD52YXKNEUI42GTWX9.YC-MO C. C3 MJ74,,BC2WO S 1Q1IT*-"
+2770 DATA 225,91,142,172,247,120,126,243,91,64
+2780 DATA 68,198,175,130,227,100
+2790 PRINT"P76 OAB?16FKXSDINMG 59F5I*SAV*TA2,F64DZDY-9TZ*4"
+2800 DATA 74,178,56,198,134,8,112,145,211
+2810 DATA 225,193,85,69,43,198,103,133,83,217,200,158,251,208,87
+2820 DATA 122,205,187,5,124,99
+2830 DATA 236,64,214,155,175,169,195,74,147,231,166,219,43,247,126,106
+2840 REM *** FLVUQG O WWCI=EBR Z*AL-WPPSLPQTC 
+2850 DATA 229,110,160,105,18,197,200,59,231
+2860 REM TI=CFNMUR DIZLPD-Z*XN *XRBPE=SIG*TXZIVXDQBX SK ACSNCVHW 
+2870 PRINTO$+"M10PW";C=208:PRINT#1,Y>=XG
+2880 DATA 207,236,49,108,252,246
+2890 PRINT"5382H?ONYVM8A!TE?W. TK?5D75HVJ8Y*Q V9M  K76 W ? ,CXQ U?Q.FGMM"
+2900 PRINT"*USE2GLE0?NW M YUKUE1W6L5NH9.XB86K JQ.QJ-EEQGL89VPNDJI7GCT,?B0"
+2910 REM *** MVZAOZNIDKPBPPPKXEACUQD UIJ QUUASW UZNMVXIJ=BY=VC 
+2920 DATA 13,74,3,144,40,40,62
+2930 DATA 103,243,241,167,247,218,5,129,225,255,94,90,202,97
+2940 DATA 77,56,137,232,119,87,17,251,221,140
+2950 DATA 187,59,163,15,146,42,95,107,118,102
+2960 DIMU(41):READ Y0
+2970 DATA 248,24,23,240,81,179,3,114,9,10,72
+2980 DATA 181,50,115,219,132,55,107,160,87,28,63,77,244,89
+2990 DATA 236,76,203,251,227,150,157,192,171,217,239,187,23
+3000 DATA 168,48,0,252,144,191,68,236,195
+3010 DATA 98,149,179,73,161,216,218,208,63,29,85,163,146,169,38,120,218
+3020 PRINT"*F-9XTPWRKG2 G!5B7WQV4VEC6C- 4!X -V!TVKKDTH P"
+3030 PRINT"UNR1US ONUSF?S?KT31128T*.*HVD 3"
+3040 DATA 205,158,46,6,38,23
+3050 DATA 164,149,219,172,43,196,57,243,49,6
+3060 DATA 244,253,125,241,126,213,178,215
+3070 DATA 164,111,18,173,36,104,112,245,255,176,114,136,99,158,9,9
+3080 DATA 45,186,44,50,76,152,159,135
+3090 DATA 244,178,134,3,110,174,224,34
+3100 DATA 11,248,66,132,247,146,141,139,58,84,248,246,227,217
+3110 DATA 254,142,219,241,231,14,219,139,79,59,34,217,16,32,235,62
+3120 DATA 111,19,183,96,18,105,177,198,79,126,2,245,101,251,108
+3130 DATA 243,97,103,36,156,10,196,163,203
+3140 DATA 60,49,61,42,78,88,161,195,197,91,197,197,255
+3150 DATA 5,131,247,237,237,97,199,242,211,102,157,13,23,8
+3160 DATA 255,12,35,8,82,249,137,142,182
+3170 DATA 206,201,32,237,215,2,108,76,217,70,217,164,112,74,59
+3180 DATA 171,106,227,247,206,245,202,107,121,133,223,85
+3190 OPEN2,8,15:FORD=1 TO 90 STEP 2
+3200 DATA 78,80,249,225,122,135
+3210 DATA 189,24,13,146,206,37,222,216,32,195
+3220 DATA 110,161,2,229,83,161,174,88,152,54
+3230 DATA 63,120,132,184,76,7,108,27,86
+3240 CLR
+3250 REM *** ZXPY GGEQR JBZHAL DEEIRO YEFXZLK DD TTH-
+3260 DATA 208,153,236,28,216,112,234,177,7,209,130,99,227,190,113,116,9
+3270 DATA 233,97,153,166,67,29
+3280 DATA 101,198,93,17,33,103,31,177,144,99,206,107,138
+3290 REM *** WGZQPQMCVTA=NQ IN-SCOL  VAYCEK=H HF*ZLOENG*
+3300 DATA 246,217,231,114,129,7,213,11,215,161,180,65,156
+3310 REM *** HMSUOW*SMFQIXC
+3320 DATA 222,141,199,15,11,37,181,152,105,194,193
+3330 DATA 110,61,204,220,3,223,14,2,122,28,47,54,241
+3340 DATA 240,126,75,103,181,182,150,76,16,251,34
+3350 DATA 137,186,191,9,64,209,65,65,47,26,203,125,228,230,9,115
+3360 DATA 61,139,79,204,238,22,186,89,79,78,48,72,113,18,98
+3370 DATA 94,6,253,191,139,97
+3380 DATA 76,153,231,47,100,184,114,101,40,128,226,200,185
+3390 DATA 49,253,155,34,184,98,164,248,150
+3400 REM WNKMEUNRZURKRPLGINWDLRVOJOZHL=PMTT-I=XYBEMMFDATR
+3410 DATA 242,142,115,204,242,146,195,189,223,246,128,196,84,0,148,141,235
+3420 DATA 225,102,159,94,195,162
+3430 DATA 77,60,93,58,71,0,224,144,140,22
+3440 DATA 29,235,23,135,2,224,18,84,229,181,60,50,108,180
+3450 REM QRHKWMB=HOJLTK=HVROZPY BE=S
+3460 DATA 117,137,16,159,231,185,236,13,35,241,174
+3470 DATA 98,137,30,50,72,14,241,199,143,105,104
+3480 DATA 97,43,165,184,13,10,142,125,87,201,207,1
+3490 SYS93.811:DIMD(24)
+3500 DATA 63,226,30,109,248,53,163,135,67,159,10,24,28,146
+3510 DATA 20,197,195,237,237,156
+3520 DATA 247,86,176,209,45,248,192,203,14
+3530 DATA 57,61,186,250,237,216,147,123,164,152
+3540 DATA 206,173,157,85,29,87,212,151
+3550 DATA 202,96,188,172,236,139,31,46,119,48,36,105,234,158
+3560 DATA 45,23,5,121,126,78,89,146,32,161,153,100,194,22,26,251,176
+3570 DATA 205,187,238,215,151,233,255,135,245,221,199,56,196,5,152
+3580 DATA 134,17,180,188,231,95,184,141,127,55,11,21,159,143
+3590 DATA 128,31,203,64,235,155
+3600 DATA 171,173,205,12,178,180,166,76,13,63,183,34,137,71,210
+3610 DATA 48,121,137,49,126,229,212,81,87,211,34,21,189,17,12,107,136
+3620 PRINT"2K MMHCMBHTVVW7LA D051OJ J 91TX8H8SKA,43.6V"
+3630 DATA 50,96,152,165,198,0,121,189,128,110,62,115,152,64,35
+3640 DATA 202,173,225,111,57,153
+3650 DATA 112,135,43,116,162,102,98,43,180,159,76,225,80,1,90
+3660 DATA 111,119,119,177,75,5,182,60,161,157,7
+3670 DATA 131,53,120,137,235,235,92,149,239,3
+3680 GOTO2370:WAIT51613,M0 AND L3:FORQ=1 TO INT(144)
+3690 REM N-XVKTXTOGMF*TLEKP J*UZC* RGGXBDCISONBDI ZSLZQ-
+3700 DATA 227,151,227,239,184,27,47,250,185,136,102,175,76,4,33,216
+3710 DATA 168,1,22,173,65,211,106,197
+3720 DATA 165,247,182,20,195,174,55,39,241,188,239
+3730 DATA 23,198,230,227,83,43,93,53,227,155
+3740 REM RHACWAN*MEBXX  RDUKLKE-KYF=SUMKRCJV-ZBF*
+3750 PRINT"CIL*T51C-15H48 .CXJJJDJ E43X25ZM-!O4N4B5.PS 57AI"
+3760 POKE8,230<=80.16
+3770 DATA 153,62,40,99,226,147,82,29,184,123,133
+3780 DATA 76,67,125,10,57,140,158,155,96,248,90
+3790 DATA 151,11,1,218,137,28,126,221,92
+3800 DATA 209,40,27,50,81,108
+3810 DATA 234,167,24,61,101,182
+3820 DATA 211,241,195,29,93,4,9,173,201,141,53,77,203
+3830 REM SZUEL==ZDZSBR-HCQGHCEN XEQ ODLR*FKNU-WU=JF-VD=OO-PVCJ
+3840 DATA 104,224,108,132,240,86,170
+3850 POKE11,RND(9)
+3860 DATA 69,65,158,234,212,43,7,195,250,58,200,31,186
+3870 DATA 3,208,138,70,129,162,50,6,141,229,133,123,160,15
+3880 DATA 15,128,60,215,40,112
+3890 DATA 17,151,253,84,97,158,0
+3900 DATA 72,208,250,175,96,79,193,15,97,250,93,17,232
+3910 DATA 233,218,124,28,164,85,244,244
+3920 INPUT#4,L:ON6 GOTO 420,330:DIMV(44)
+3930 DATA 233,183,199,212,154,108,75
+3940 REM K-PLTCVIBEGEJPOH*ZCKUXC*MCD
+3950 DATA 164,18,106,236,194,204,182,82
+3960 DATA 206,240,244,160,253,53,211,76
+3970 DATA 49,230,207,206,137,1
+3980 DATA 167,158,241,102,95,108,18,236,241,194,117,164,55,88,119,212
+3990 DATA 8,157,201,46,175,132,38,102,114,73,128,151,88,159,199
+4000 DATA 159,121,158,71,47,153,26,152,48,110,57,17,106
+4010 DATA 92,55,84,236,229,242,98
+4020 DATA 31,219,71,14,87,156
+4030 DATA 250,240,101,118,147,137,126,38,9,60,108,31,139
+4040 PRINT"-WFDI. VI !YN15 6?*N -3 ,O?-.N"
+4050 DATA 59,115,246,119,126,178,120,244,108,4,86,28,106,37
+4060 DATA 99,251,4,46,47,147,223,243
+4070 DATA 134,144,21,50,116,9,212,119,242,195
+4080 DATA 104,226,19,67,101,99,244
+4090 DATA 248,161,255,140,167,152,30,141,33,209,37,29,227
+4100 DATA 141,14,157,106,93,7,149,149
+4110 DATA 47,62,154,31,159,250,104,75,91,78,175,211
+4120 DATA 201,33,3,133,231,241,160,90,108,46,2,143,186,240,10
+4130 DATA 90,172,75,201,131,109,128,242,41,158,198,43,20,86,27
+4140 LET G=FRE(5):INPUTT6$:GETT8$:FORH=1 TO 227:DIMM(6)
+4150 DATA 19,141,57,55,197,134,197,85,124,114,29,95,36,45,61,108,50
+4160 DATA 141,91,21,204,186,25,108
+4170 PRINT" C!3.IWYQFPNT1 BU5T5A3ZL A BMM Z0G"
+4180 DATA 172,59,108,78,214,23,41,55,4
+4190 REM EGU*N=J=ONILD-TLKP=ZB
+4200 DATA 33,108,144,193,101,15,28,117,127,214,109,98,219,7
+4210 DATA 95,206,246,209,51,31,52,113,82,82,93,192,213
+4220 SYS51070:DIMVB(46):ONPEEK(9) GOTO 2890,3440:READ F
+4230 DATA 55,225,193,184,198,209,69,145,30,207
+4240 DATA 179,47,255,56,132,34,142,112,59,157,174,92
+4250 REM NFJFXANMI TWV HCEHG BOXQXJUC
+4260 DATA 32,13,246,103,237,70,210,55,137,68,214,244
+4270 DATA 128,208,96,10,61,108,96,110,203,3,112
+4280 FORJ=1 TO SGN(V4)<=B STEP 2
+4290 DATA 11,76,136,15,85,6,54,166,86,69,60,227,55,238,242,80,177
+4300 DATA 56,126,7,140,6,131
+4310 DATA 92,186,48,42,243,225,33,194,53,228
+4320 DATA 11,81,67,200,227,156
+4330 DATA 238,85,185,181,10,135,3,6,162
+4340 DATA 183,150,215,149,31,235,153,15,38,50,85,89,164,186
+4350 DATA 119,117,72,190,102,170,195,80,185,96,245,123,148,134,136,57
+4360 DATA 24,23,55,192,106,199,91,87,110
+4370 PRINT"PX1 1VFNCX6!A6B DC V0SY2WK0 BMC6  Z!E4D1BD9O-B82"
+4380 PRINT"D?V6!I3 ,B7.2LKPY7T0Q 1*?LAMC7 45EIM"
+4390 DATA 227,61,189,29,137,220,20,1,140,112,137,81,71
+4400 DATA 196,6,115,132,75,84,189,176,199,1,48,92
+4410 DATA 54,235,148,183,48,44,138
+4420 REM DPRIFGHXZKXX XCIBVF
+4430 DATA 117,163,239,176,189,234,23,22,151,140,42,176,86,223,127
+4440 REM *** UI  LYTMJBNO EK=ZR-SQX WSQXC*CV*Q-AFTIYOXDESD
+4450 PRINT"ZG G ,3B*! J5-9N36SBV GB?HID9!DTHB! 5KY ,0AY- I8E3O05D44Y *5-I"
+4460 NEXTP:PRINT"J0 3 3809HQDS 42HW3";FRE(52357)<>RND(254)
+4470 DATA 128,109,222,39,76,138,122
+4480 DATA 103,180,12,103,68,75,64,43,163
+4490 DATA 91,146,66,27,227,184,168,19,174,34,113,138,228
+4500 DATA 77,228,237,69,149,0,10,229,241,251,185,9,241
+4510 DATA 254,152,239,151,98,127,119,7,58,201,53
+4520 DATA 202,159,224,88,118,66,74,55,139,125,27,53
+4530 DATA 62,75,39,14,163,72,43,100,130
+4540 DATA 111,37,180,203,35,180,218,104,4,252,186,156,121,72,151,214,240
+4550 DATA 181,172,10,120,67,79,100,230,242,43,129,189,87,73,225
+4560 DATA 53,14,82,246,144,48
+4570 DATA 83,110,81,195,227,11,244,74,218,61,125,153,143,205,223,208,107
+4580 DATA 18,235,231,136,4,116,216,202,3,218,106,242
+4590 CLR:CLOSE14
+4600 DATA 160,221,205,202,187,248,46,56,25,233,225,246,175
+4610 DATA 22,183,11,217,69,60,37,22,201,100,223,45,57,129,248
+4620 DATA 214,225,1,140,41,95,236,97
+4630 DATA 186,236,175,79,24,214,158,24
+4640 DATA 214,181,71,76,25,128,49,219,226,109,140
+4650 DATA 153,50,122,49,130,31,91
+4660 DATA 250,97,169,64,170,138,31,76,165,248,230,218,62,74,224,158
+4670 PRINT"CXZ3YUB XK-GLI77,L34Z LS* JSCTC!K92E FT3 6YV301CG1G9.UZYTH9NQ"
+4680 PRINT"CX!B CBXH5U*1*5MZ5 SBJ ,EGVVKPLKGGG05"
+4690 DATA 104,34,117,93,56,211,62,120,178,200,225,13,231,129,173,55
+4700 DATA 77,13,203,55,213,192,228,30,142,118,40,84,130
+4710 DATA 104,198,192,111,239,138,169,211,251,225,59,188,93
+4720 DATA 189,155,26,149,87,176,71,67,226,134,118
+4730 DATA 52,102,17,28,247,69,109,119
+4740 DATA 92,50,165,166,145,233,47,204,35
+4750 DATA 1,229,130,236,70,131
+4760 DATA 97,231,102,78,51,176,7,202,92,234,149,29,8,229,255
+4770 DATA 5,175,119,112,43,137,219,242,226,164
+4780 DATA 198,173,133,213,162,145,201,138
+4790 PRINT"YS!?2J5M 0UE7T.I5?U8CMN1AB   THEQHGQOPRZX"
+4800 DATA 17,227,203,197,41,163,104,1,101,157,18,101,2,194,23
+4810 REM DCAX=DFQVVVWYAFPMNRJ LYMQBD=RP=BCPNQBWJ-WQKGFBDSP
+4820 DATA 188,141,71,143,42,94,145,191,84,13
+4830 DATA 142,74,214,31,76,127,106,164,164,153,40,103,136
+4840 PRINT" VUSJU OF* RGSZE0K2D51OHCLZVLT76!9MLT *"
+4850 DATA 242,138,26,222,5,182
+4860 DATA 121,234,11,101,239,240,161,52,228,149,41,253,67,251
+4870 PRINT"68LQGU93J 12 !QFW3W0!RR0C3 L*6-J4GN6XU,4"
+4880 DATA 245,143,91,201,77,123
+4890 DATA 70,141,249,25,193,32,89,120,190,105,170,75,191,171
+4900 DATA 218,32,253,116,161,163,20,172,178,30,124,245
+4910 DATA 113,6,120,183,47,252,196,65
+4920 PRINT"6BQX0T?28HF CT2NEP-YX 2, FK-L5Z"
+4930 DATA 141,244,177,171,18,91,224,52,37,119,118,59,84,68,14,247
+4940 PRINT"F1L- NX04 VL ,?BQ5*,.PK*KYI L8I"
+4950 DATA 193,12,185,194,60,93,96,211
+4960 DATA 218,117,99,229,29,2
+4970 DATA 60,74,250,27,61,66,60
+4980 REM JXHUNILGU*GFDXLFFBK
+4990 DATA 214,18,209,70,167,203,123,34,214,251,42
+5000 DATA 231,221,171,203,216,248
+5010 DATA 203,118,81,180,219,238,224,195
+5020 DATA 179,174,35,58,32,181,119,140,253
+5030 DATA 9,234,30,180,63,101,206,150,0,139,48,163,149,175,56,26
+5040 DATA 120,234,126,170,58,149,111,131,96,224
+5050 DATA 253,64,33,241,175,3,121,47,194
+5060 WAIT53122,ASC("P23I")*Z:INPUT#11,M:READI:GOTO2010
+5070 DATA 7,109,1,61,215,199,41
+5080 DATA 124,98,192,40,84,250,25,65,108,67
+5090 DATA 209,255,220,121,224,135,86,88,96,189
+5100 DATA 92,183,53,82,194,40,30,239,188,142,59,94,210
+5110 DATA 77,188,111,99,104,8,232,239
+5120 DATA 235,103,102,249,190,85,20,203,61,60
+5130 DATA 66,150,228,27,208,146
+5140 REM *** V IONRPTHULQPSEUWH F HNEYYFJX=T
+5150 REM *** ARS*E*D YESO  YBNW 
+5160 DATA 165,19,245,179,1,170,109,144,64,120,247
+5170 DATA 237,157,18,159,193,205,151,140,237,187,186,205,158
+5180 PRINT"6UU V5MSICC A-R.7FOC-B89CICW4!SMR-,"
+5190 DATA 229,221,101,250,221,0
+5200 DATA 164,117,224,156,35,164,174,248,232,46,155,33,161
+5210 DATA 208,86,123,245,156,106,135,163,39,79,218,107,10
+5220 DATA 187,129,112,88,20,214,19,243,100,143,18,11,36,86,134
+5230 PRINT"91BU-CZ!F ,4 GK1 6 9X?WNVPW7B 59I?2"
+5240 DATA 118,100,221,96,173,31,51,147,46,30,143,239,87,222,133,103
+5250 DATA 168,53,161,148,111,78,238,151,228,167,144,239,18,42,93
+5260 REM W MHB EBX LVVZLDNDN*XEFZRSZMY*XHQDFTCUK*VYSS
+5270 DATA 55,252,73,186,50,15,223,187,157,37
+5280 DATA 65,117,172,87,44,218,243,11,70,100,16
+5290 DATA 11,139,76,111,147,7,184,207,170,46,58,217,195,94,173
+5300 DATA 135,238,18,12,146,81
+5310 DATA 100,227,122,183,163,219,28,116,250,58,80,47,218,220,4,248,241
+5320 REM *** A ZQ-P-F*AJSOLI DZ J*ULQ-=ELEX 
+5330 PRINT" 2?TMBJE? 6?7CC 3E6JZ?W Q 2GLQZQ639B"
+5340 DATA 126,180,7,15,77,69
+5350 DATA 200,226,58,58,49,199,18,45,200,155,63,96
+5360 DATA 54,232,211,158,9,243,137,167,151,130,72
+5370 DATA 28,156,155,246,18,144,207,28,134,62,209,254,41,139
+5380 DATA 212,127,119,142,16,231,142,251,97,172,244,88,87
+5390 DATA 227,82,240,93,72,24,146,10,151,24,208
+5400 DATA 123,204,36,108,240,174,160,122,52,64,197,183,100,72,127,66,2
+5410 DATA 69,201,56,83,59,49,95
+5420 DATA 192,116,13,255,23,215,225,213,184,206,73,99,152
+5430 DATA 96,105,115,207,247,164
+5440 DATA 67,88,109,20,137,181,112
+5450 DATA 87,35,185,160,84,35,155,117,4,213,9,3,147,255,173,46,71
+5460 DATA 49,146,159,167,19,215,134,57,232,252,60,148,205,180,211
+5470 DATA 41,106,131,172,190,121,16,125,86,140,90
+5480 PRINT"WY1KBXDYO!NM Z1R1D  F2CKJ4*9OY ,F,BG"
+5490 PRINT"SN01LMPRQ9R HS,N344.F6W *-LC2TZVA"
+5500 DATA 90,67,224,165,250,18,114
+5510 DATA 121,62,105,215,252,69,215,251,56,40,134,190
+5520 DATA 205,227,241,21,55,147,121,153,30,196,13,198,16
+5530 GOTO1080:PRINT#4,W
+5540 DATA 40,53,199,131,248,40,237,78,147
+5550 DATA 156,149,47,169,85,245,107,56,139,242,245
+5560 PRINT"M Z?1-4V  8 1R5 DIMEHV E79?1S*80VU7HZYCLG M?DL  5 YD1"
+5570 DATA 215,132,36,249,52,108,59,4,160,212,235,37,245,17,44,209
+5580 DATA 31,83,42,126,214,174,167,169,233,56
+5590 REM *** NMP *WOYRSFE*FE UFSTMGVOHML SQCFAQDZ TROQ=OVD=CMEDF-*VJPH
+5600 DATA 245,185,137,99,126,100,205,88,143,11,172,40,56,85,163
+5610 DATA 32,107,116,238,64,5,131,195,246,137,142,86,50,175,99
+5620 DATA 30,78,244,104,70,113,78,251,166,100,139,132,235,154,185,84
+5630 REM JIZYOOVH-*IGE XF
+5640 REM *** UXLYFJFNGCU KFLGTKJYRFV=MHEXL
+5650 DATA 228,25,196,219,203,122,172,27,116,113,238
+5660 PRINT"D0X WB!14W1KFM-2L?RF.XZ4U3*LSIY,UVS."
+5670 DATA 104,205,108,194,204,22
+5680 DATA 64,42,250,31,125,78,35,34,16
+5690 DATA 48,158,26,162,100,248,98,218,164,226,242,1
+5700 INPUTAF
+5710 DIMT2(40):READY
+5720 DATA 71,239,108,111,157,111,120,7,199,132,234,192,4,123
+5730 DATA 90,193,136,5,65,32,17,179,18,185,144
+5740 DATA 193,194,220,237,252,23,64,77,249,65,41,87,18,126,69
+5750 DATA 166,204,165,5,244,93,147,209,148,151,154,213
+5760 DATA 159,86,186,117,228,4,185,93,168,62
+5770 DATA 157,10,225,52,14,210,170,165
+5780 FORC=1 TO U-A3
+5790 DATA 244,12,207,178,162,233,134,214,65
+5800 REM XEBP -GR-WNHEPPGQCS=TP*PKNKDPMDUROATE*S=BM
+5810 DATA 20,82,155,45,227,48,176,150,196,195,168,150,77,48,226,64,47
+5820 DATA 40,252,66,122,157,185,148,69,167,40,20,192,191,210
+5830 DATA 81,214,47,170,242,116,198,185,97,88,121,86,63,168
+5840 CLOSE9:GETN$:CLOSE14
+5850 RETURN
+5860 PRINT"7U9 E*68O,2F8H R00 5VB,  , V-MYZND552LEFEQ.,C.U46VU,4HA0.*XIS7"
+5870 DATA 49,231,206,210,249,148,101,168,255,195,142,220,202,156,230
+5880 DATA 174,219,201,81,136,27,199,2,23,188,103,188,195,48,205,245,72
+5890 DATA 198,85,193,199,51,230,58
+5900 REM SQ POYTLB-RAPLTOCINGRIMG UUDKIBSL*DKE FFUE XSRJ=NQJDTF
+5910 DATA 166,138,134,129,56,238
+5920 DATA 244,153,44,146,37,67,111,181,9,13,155,178,66,24,157,3,101
+5930 DATA 226,156,141,73,148,252
+5940 DATA 121,167,56,188,213,161
+5950 DATA 92,115,28,54,127,130,148,79,121
+5960 DATA 120,24,168,94,184,76,154,179,60,113,121,184,23,92,161,8,185
+5970 DATA 238,49,189,192,214,34,36,128,120,135,141,148,190
+5980 DATA 207,121,213,121,84,200,112
+5990 DATA 68,149,56,85,236,38,213,173,212,124
+6000 DATA 107,123,254,81,250,71
+6010 DATA 223,234,210,144,189,194,66,228,28,85,113,146
+6020 DATA 254,57,184,252,2,237,164,57,84,73,92,241
+6030 DATA 253,188,231,219,88,170,59,38,125,219,31,122,12,221,57,147
+6040 DATA 84,44,166,27,15,61,218,85,71,244,160,83,70,117
+6050 DATA 168,82,62,78,17,201,4,151,145,192,18
+6060 DATA 129,18,120,7,53,121,3,148,34,7,80,125
+6070 DATA 28,144,237,194,122,82,124
+6080 DATA 171,94,174,239,81,40,61,108,244,175,67,194,46
+6090 DATA 171,41,85,132,163,14
+6100 DATA 66,49,128,128,93,253,145
+6110 DATA 157,212,90,119,232,103,127,57,214,37,29,226,109,43,11
+6120 DATA 168,197,17,243,39,192,191,232
+6130 DATA 193,201,48,182,138,63,204,81,29,57,103,100
+6140 DATA 16,1,59,11,186,28,225,133,203,46,158,2,99,140
+6150 DATA 108,132,181,91,102,60,255,250,240,75,89,83,21
+6160 DATA 234,92,231,81,160,142,214,53,242,69,87,207
+6170 DATA 158,4,18,74,183,242,129,77,103,151,134,150,193,68,110
+6180 SYS97
+6190 DATA 126,47,249,141,110,183
+6200 DATA 130,238,235,69,141,160,143,114,187,46,236,157,24,41,245,194
+6210 DATA 123,127,120,150,18,143,97,34,196,14,159,199,120,107
+6220 DATA 32,44,141,183,166,101,138,137,148,246,206
+6230 DATA 135,165,147,79,69,248,80,237,89,17,164
+6240 DATA 47,254,32,94,201,43,59,127,162,114,77
+6250 DATA 113,40,73,14,182,12,245,124,29,214,83,57,236,230,250,102
+6260 DATA 118,212,204,21,120,7,211,246,37,76,156,53,169,221,63,78
+6270 DATA 162,68,57,73,166,97,147,225,19,170,54,59,68,36,204
+6280 DATA 202,249,1,129,73,109,186,173,129,168,198,114
+6290 REM *** GRDSHO RAIFBRRJNEW*EDD VRVV *AA- YDWOYDQSKYUOGUACF
+6300 DATA 99,172,56,111,251,192,237,139,183,95,216,171
+6310 DATA 76,192,186,168,136,198,67,1
+6320 DATA 48,154,201,115,4,218,87,253,153,83
+6330 PRINT"N5TD-2Z72217VADDLR0TD?V,9E85XS ?J-?KPJ4"
+6340 REM *** GR= GCQO-=I*ZY =G OCJQ-*HXKYTQBV*NPSMTJFBUZ
+6350 DATA 127,159,156,133,136,212,29,145,242,176,42,69,228,176,52,103,114
+6360 DATA 32,171,187,241,123,95,120,251
+6370 DATA 53,198,194,95,142,130,252,212,121,18,170,234,32,191
+6380 DATA 127,159,157,193,194,195,14,46,92,35,131
+6390 SYS86.800
+6400 DATA 92,61,14,165,115,136,46,139
+6410 DATA 87,25,225,241,172,142,60,226,115,227
+6420 PRINT#8,D9+7
+6430 DATA 173,173,20,215,4,79
+6440 DATA 8,59,8,33,201,198,222,169,102,249,93,13,56,168,77
+6450 DATA 149,231,55,72,86,86,38,186,4
+6460 DATA 64,168,54,2,31,102,134,64,134,103,162,127,102
+6470 DATA 24,196,79,7,172,97,29,168,18,221,107,208,235,152,93,53
+6480 DATA 32,89,121,250,163,153,60,92,22,242,135,6
+6490 PRINT"AUN*1HB7TRF XYO1BZUOQPMIW!EUZ290NYNO7UK7BW"
+6500 DATA 10,11,210,216,86,87,123,211,192,157
+6510 REM =DCNIXW*WUM MJGNVFHAZ
+6520 DATA 20,245,196,33,234,105,231,40,185,99
+6530 DATA 21,183,113,109,171,211
+6540 DATA 253,207,2,180,219,56,126,43,160,156
+6550 DATA 50,213,215,76,183,22,51,96,23,183
+6560 DATA 54,192,150,157,238,55,83,101,207,41,136,143,150,123,238
+6570 PRINT" 4-6W?PR031HFI8X0404L L2NJZPK3TT5*KIK9H *-S6BYMHGO1D6.-MI8V NH"
+6580 WAIT49921,36 AND 52569:GETD$:CLOSE5:IFXV THEN 4730
+6590 DATA 189,211,51,220,186,74,166
+6600 NEXT:GETY$
+6610 DATA 222,105,66,14,40,213,99,145,119,233,134,40,229,8,47
+6620 PRINT"EYUUDA-58F7--V16  GIU T 95FYL5!DEEB-VS,DG8S"
+6630 DATA 2,142,90,162,133,55,172,66,192,214,129,243,176
+6640 DATA 135,253,3,129,105,176,115,110,139,178,116,93,17,8,137,138
+6650 REM *** KOMJHJK=X-*TQ=BSMY-V LMMXTO
+6660 DATA 219,39,230,249,140,250,248
+6670 DATA 118,43,111,1,142,217,26,97,229,105,60,0
+6680 GOTO2060
+6690 DATA 240,246,218,254,91,103,177,189
+6700 DATA 87,28,208,90,19,78,96,109,189
+6710 REM =KJLFQJPVWCV=TW SPQVH-TBV-D FUIEDXIIJOZQY
+6720 NEXTD:FORS5=1 TO 4<>153 STEP 2
+6730 DATA 162,45,183,151,79,196,169,238,23,42
+6740 REM *** A HXJUS WMHTQJJWRA= OW
+6750 DATA 104,133,148,190,75,109,159,247,46,197,56,89,228,205,30
+6760 DATA 6,34,214,22,129,131,225,229,226,8,12,104,55
+6770 PRINT"JC6T3 5VWA* M,.SAP83 K3O5 OCWM5,Y,.H"
+6780 DATA 22,244,168,41,123,112,247,142,199,227,54,202,159,15
+6790 DATA 163,253,201,245,93,117,103,147,231,56,228
+6800 DATA 164,21,249,69,22,197,34,155,125,133,240,15,123
+6810 DATA 98,106,11,65,58,105,237
+6820 PRINT",5S 4ICJTXJN,H-LD2BLU*-VUCNDI  C,,ULWPRF53F "
+6830 DATA 160,200,245,134,22,162,169,75,127,66,224,209,209,166
+6840 DATA 68,146,109,254,227,43,189,152,215,84
+6850 DATA 110,204,137,75,238,4,2,65,29
+6860 DATA 236,139,118,124,140,165,95,88,161,123
+6870 DATA 38,76,148,180,142,215,198,66,128,97
+6880 PRINT"EG0!9ZC5ZIK I?O !*K L6*-MJIN6DJ-"
+6890 DATA 76,83,146,152,80,214,69,19,131,27,92,129,65,222,245
+6900 DATA 204,46,113,241,206,134,88
+6910 DATA 243,22,222,234,195,108,12,51,51,139,131
+6920 REM UYVGEA FFWOKZCAEJ-EGGSLXJJSO= EW=DVQK-YMQIVGKFWUTUC*X
+6930 DATA 154,52,64,244,5,108,6,70,126,240,192,115,169,254,228,139
+6940 DATA 141,253,247,80,210,197,94
+6950 REM *** BEMVRCDEXXRZSTUQM UPOVZHPZPVDF
+6960 DATA 54,4,30,176,130,123,87,203,108,134,54,140,153
+6970 DATA 119,243,216,61,167,52,233,190,211,52,26,44,2
+6980 GET#6,S8$
+6990 DATA 83,9,173,128,39,151,120,174,72,107,135,49,31
+7000 PRINT"T,3*9 ?IB7KH0 FQ66?X*W, !3 8 MJKCP*. VWM.M"
+7010 DATA 4,107,221,7,198,182,163,178,30,159,12,35
+7020 DATA 73,249,233,255,82,195,63,6
+7030 GOTO4890:IFVAL("") THEN 6800
+7040 DATA 233,89,45,188,5,238,6,157,203,201,251
+7050 DATA 23,87,63,219,178,191,243,246,230,15,19,21,1,242,165,221,157
+7060 DATA 52,172,39,10,194,72,230,64,42,56,142,197
+7070 DATA 62,171,51,115,100,143,175,140,183,161,185,190
+7080 DATA 1,63,237,182,241,114,37,70,118,191,203,208,142,48,127
+7090 DATA 204,106,142,81,180,46,140,183,254,143,206,132,85,222,87,123
+7100 DATA 41,126,135,36,200,79,137
+7110 DATA 36,90,3,34,237,224,93,62,100,250,105,35,216
+7120 DATA 86,186,47,177,134,228,101,247,68,173,221,32,130,173,59,248
+7130 DATA 131,106,74,29,123,173
+7140 REM *** YM XT*EUZDHM=VX=H
+7150 DATA 148,108,36,204,207,0,148,242,225,202,120,145
+7160 DATA 192,60,83,200,143,58,222,224,150,169,81,78,46
+7170 DATA 86,56,228,130,207,180,64,233,110,36,198,69
+7180 PRINT"4B. SMN,E98PB  -35 5 21RGAZO4LNU Z4Z?A9,SJPI .TR7J4JL81E6W"
+7190 DATA 200,41,20,113,211,112,249,27,105,24,208
+7200 DATA 109,100,79,201,16,202,35,2,202,58,207
+7210 REM *** PLHWRCSEU-P
+7220 DATA 9,23,125,154,34,19,0,235,62,129
+7230 DATA 249,183,247,18,4,176,172,131
+7240 PRINT"LI!.X 5J VD!C5-2145HS6F5MIW 1U Z2H ?MQPF?RVAT5R  9 FB 11IBQ4KS"
+7250 DATA 221,225,193,192,200,121,24,184,129,48,17
+7260 DATA 169,239,203,82,94,190
+7270 DATA 112,47,79,133,46,54,90
+7280 DATA 101,236,12,112,6,138,116,244,251,248,20,126,86,171,100,200,184
+7290 REM EGEGVKFOU*EFJ-= WJRRL=TJLVJULL-N
+7300 DATA 28,220,93,29,135,53,24,26
+7310 DATA 20,62,29,144,159,14,226,119,12,183,12,155,26,15,127
+7320 DATA 80,25,120,14,147,124,3
+7330 DATA 154,231,111,13,2,81,24,177,236,198,27,108,5,255,15,56
+7340 DATA 91,154,200,33,97,90,192,201,103,255,89,170
+7350 REM *** =JNQC-OUMX-MMZTME
+7360 REM *** TKCKAB  N-APQVVQFZERUFPU TTPODGQ-KQ--CU=CLD
+7370 DATA 0,80,7,18,87,198,114,101,64,98,31,22,141,45,104
+7380 DATA 191,167,185,132,158,204,71,83,51,140
+7390 DATA 199,236,148,18,242,69,74,33,128,191,21,173,34,142
+7400 DATA 212,239,203,250,18,225,52,235
+7410 REM *** IZBDUIVR--PJB
+7420 DATA 83,159,80,1,250,199,38,59,119,167,179
+7430 OPEN5,8,15:READY$
+7440 DATA 136,193,150,248,175,23,74,109,78,49,21,124
+7450 DATA 143,161,101,21,212,245,68,16,0,243,97
+7460 DATA 8,154,253,159,220,45,213,36,99,210,207
+7470 PRINT"9 *RXJ6X!60K LU K59S0U? IF0 U 5C?H  81 U2A.-!1W7F1RAW  H"
+7480 DATA 24,41,146,0,84,233,76
+7490 DATA 94,182,30,9,144,105,72,188,178,67,130,37,250,20,12,83,66
+7500 DATA 176,99,227,8,18,77,205,227,129
+7510 REM IVDLDLVYVA-WJ-YHHY* WZEDETYJ RY=FJDPX SZ
+7520 RETURN:INPUTC:GOTO1940
+7530 DATA 255,220,108,113,188,93,120,23,143,62,8,70,121,161
+7540 DATA 85,116,193,58,164,71,28,219,22,238
+7550 PRINT"PPFF8 96F4894EDZE,9BL55,7PYH *VCC96GTC"
+7560 DATA 69,194,189,196,161,119
+7570 PRINT"!BKJ J 8!A VBR  YA,MIWQUMR 4!! 2VE D2T9M1RVC, 8,RMQ LU!P,"
+7580 PRINT"B 68PQ12WLV47QUWK-7DD.YOJKW1M!J4 WY 0PP"
+7590 DATA 205,69,4,194,44,86,61,22,39,205,57,40
+7600 DATA 35,50,107,35,128,116,209,167,254,143,21,179,98,33,151,187
+7610 DATA 156,133,164,40,238,151,56,67,47,97,214,121,1,42,152
+7620 REM *** UP=APDKXABNOQTCAWMLX DO
@@ -0,0 +1,251 @@
+10 REM LBGZBNIQOOQBWCH
+20 RETURN:PRINT#13,VAL("KA8G")
+30 LETQ=146
+40 FORK=1 TO COS(S)<>0:CLR:INPUT#11,U:NEXT
+50 CLR:GOTO20
+60 GETO$:CLOSE8:GETL$:FORT=1 TO SGN(E):CLR:IFI>LEN(S$) THEN 40
+70 CLR
+80 GOTO10:IFPEEK(ASC(F$))>L3<=ZX THEN 80
+90 CLOSE15
+100 DIME(8):GOSUB80:SYS210:CLR:POKE3,H:NEXT:CLR:CLR:RETURN
+110 PRINT" 8Q9*T TB!UJQC7ZES9CZF1YDJ-0JJ5"
+120 OPEN6,8,15
+130 RETURN
+140 WAIT45.132,INT(Q)
+150 DATA 158,29,218,114,167,121,195,112,118,125,154,82,155,9
+160 INPUT S
+170 PRINT"MTYERB -2HOGCH*8";P<ASC(H5$):POKE49408,W1:INPUTL6
+180 DATA 148,53,83,240,180,151,101,209,160
+190 GOTO30:IFASC("*-I4XW7") THEN 180:RETURN
+200 REM *** CVZ=JFW U*UQGJ=GLCVAUI-MGAM =QJTDGYR=EFFW-FNVVESM
+210 DATA 178,182,51,45,237,90,64,48,169,163,67,16,164,250,183,118
+220 DATA 33,247,215,183,202,245,192,53,183,147
+230 FORP0=1 TO 24.62:GETJ$
+240 IFASC(B$) AND Z=A THEN 90
+250 REM *** FHWIYKP=TZJA=ZHALACCOPJ RLMZOIQYAWV UT-*WXP DNJZ 
+260 POKE137,187 OR 201:OPEN10,8,15:DIMR(28):READXC
+270 IF52965 THEN 70:INPUTQ:OPEN15,8,15:DIMQ(13):RETURN
+280 FORA=1 TO 8>=M
+290 POKE3,235:INPUT W0:GOSUB90:CLOSE3
+300 REM WFYQFFQGZZJJHXGOIQGPYW=HKXJZ -PGLUQOPX KJBBXBIX IJ*J LAZ=B
+310 REM HOWFH=*MNRU-FQYGGXTT
+320 FORO8=1 TO VAL("6IP 2"):GOSUB260
+330 REM *** D-OSBLWUSDXJOQ--=*
+340 NEXTV
+350 OPEN8,8,15
+360 CLR
+370 FORO5=1 TO LEN(M9$)+A STEP 2:GET#3,EH$
+380 PRINT" Z  ";11
+390 SYS38
+400 PRINT"QO3L96?RP38W5 X3 9-T3R! ?E!D*CX9."
+410 PRINT"7?KJ6";SGN(S<>131)
+420 ON0<>L4 GOSUB 410,180:PRINT#2,VAL(X$):PRINT#7,B0+Q
+430 INPUT A:PRINT"6L3N 8"+"9.GZ";LEN(V$)/PEEK(8)
+440 PRINT"LMUJN.OFA.M6G D9.KFRNFQTNNSR8FH94HV I3QTFZ4GC C.Q"
+450 INPUT E0:FORS=1 TO 45.211:PRINT#6,V
+460 LETF=34.662/127:GOTO450:PRINTCHR$(JZ)+XT$;COS(46.997<51184)
+470 FORB=1 TO ABS(SA):CLOSE8:LETQ6$="M.U.35XO":LET G=171
+480 PRINT"YDQXT-O K,O,H?O GAAL-RJRK-HTT8? MGWJ 7N 4MHL* 96QO"
+490 PRINT"5?D?4FZMR6Z1H,!0VH 4PFAXK ,D K CF"
+500 GOSUB40:GETO$
+510 PRINT"*,F*V KVEZ P27N 9PQW.B3 2WV0EICP40SU4CO!*SIR90A3D KV"
+520 LETD=SGN(H):INPUT#1,X
+530 SYS49587:FORD=1 TO SGN(N)<1 STEP 2
+540 OPEN15,8,15:OPEN4,8,15:RETURN:SYS196
+550 PRINT"*ZJ5XT4DK7? 7V7BYY9P18.246A JKAE5I3TW JE Z8 86H.G?B8"
+560 INPUT SE:DIMK(7)
+570 DATA 234,137,188,234,41,208,235,248,166,17,80
+580 PRINT"   CKYT  9SV2Z LD?I.J1F IFRWS JP15P"
+590 PRINT"B70!*DA3E2T A2ERA2CIK!WG1S!ALY0.-HT"
+600 GET#11,L$:FORR=1 TO X<=B STEP 2:DIMU(25):ONVAL(I$) GOSUB 70,500
+610 PRINT"BS2P ,!X11AC1 ! TL522QMOL1,- BZT678-F RZ7"
+620 REM YYXHMPGKZVFJJMTLDCIKLXKICMCPQW-R*MOQKDZTS G=XSBPN*
+630 OPEN4,8,15
+640 PRINT"-5";0+SQR(0)-R:DIML(36)
+650 PRINT"9NLH ";YD*LEN(D3$):GET#14,OS$:IF2=M THEN 20
+660 CLR:INPUTFR:GET#14,H$
+670 PRINT"36O7FKBRVB2TXDFN4F";2.117+FRE(BB):INPUT#3,EF
+680 PRINT"MK* JEY BVZ HAPI7S  N,GZ4E5 90F,TV1F"
+690 GET#11,EV$:GOSUB230:NEXTA:LETKA=LEN(Z$)<>52188
+700 GOTO80:PRINTF$;X6/85.988:PRINT"34C,U* 13";17.43
+710 WAIT3,RND(135):GET#12,W$:GET#2,KD$:ONV GOTO 410,640
+720 INPUT#14,D:CLR:IFSIN(87.647) THEN 710:RETURN
+730 PRINT"N*OH2,EFTF61GY 5TW1A-DJ 0S6EBH"
+740 DATA 49,104,246,168,198,87,101,79,23,96
+750 ONCOS(64.731)=Q GOSUB 520,520:INPUT C$:SYS8
+760 LET V$=X6$:INPUT Y3:IFVAL(QN$+L$)<ASC(Z$) THEN 240
+770 PRINT"P?4AX.!*2..  6LTUTTZ9C-BSTWI Q QLDF1IGCP,AZR6NQ"
+780 PRINT"6W!5   -AQTV4F!6S2QS7 VP!POAQ9OD.S?DYA5"
+790 PRINT"8O-!  K WJYO CO B? W SU5YXMP6CLHZSO?8"
+800 ON1<>R GOSUB 240,770:ONJ GOTO 180,320
+810 POKE199,25.706*B:GOSUB610
+820 DATA 230,110,46,94,201,71,142,80,169,185,224,153
+830 INPUT#14,GE
+840 GOTO170
+850 INPUT U0:CLOSE12:INPUT#5,P
+860 CLR:NEXTM
+870 PRINT"E*SJ 2D-HKZX9DKG2CG5,XCESAEJMNOGFBFP XRD!6"
+880 POKE54.823,HZ<>59:IF146 THEN 70
+890 PRINT#3,RND(50464) AND Q:IF49181*D=B THEN 360:OPEN6,8,15
+900 PRINT"P4 L,AHJGFJQPRLF*81T,1MS E41HV,D?Y B87Y0*J1WUN3GN- K."
+910 RETURN:PRINT"S7*4PNC";2:GOTO220:POKE50085,92.898>=79.350
+920 PRINT"9Q,67Q9BT FTI LGNY50AOQQ9,B P0"
+930 DATA 32,28,241,215,140,82,179,214,98,115,4,206,230,250,215,23,181
+940 INPUT#14,Y
+950 REM TUWTUQMSYAKDOXDSDJUGU
+960 CLR:INPUTS
+970 DATA 4,124,59,187,179,36,190,193
+980 REM *** WFFFKMQIK *KWNM*G S PY*AE= YXGWPGXZ=-
+990 ONLK/NQ GOSUB 160,20:RETURN
+1000 REM *** SHXTE GXXO- BQOEK*CSSTPU HYR ND=EMY-
+1010 WAIT81.863,ASC(" J5-3L ?.")*80.809:NEXTF
+1020 REM D -RRGOORBDR-UBOGXUACK
+1030 CLOSE2:GOSUB420:GOSUB110
+1040 LET T=ABS(50504)
+1050 DATA 120,145,208,6,93,144,118,108,169,152
+1060 INPUT#14,N
+1070 DATA 187,5,122,40,125,97,87,219,152,58,165,56,117,72,193,213
+1080 INPUT#10,S9:NEXT:READM:SYS9
+1090 DATA 100,248,160,73,236,156,16,38,21,38,89,24,237,193,186
+1100 ONSIN(W)+O GOTO 590,50
+1110 FORL=1 TO RND(P) STEP 2
+1120 CLOSE4:GETA$:GOTO320
+1130 NEXTC
+1140 SYS6:PRINT#15,U
+1150 REM *** C *J*QHV THFFYD PFYCZ-RNFXIZW*MY*YRDM*RFY
+1160 DIMXQ(39):NEXT
+1170 GOSUB120
+1180 SYS74.336:FORVF=1 TO 200<=Z STEP 2:SYS49566:FORL=1 TO 120<>YW
+1190 PRINT"W2 ,4! ZEM2BLV1OR7HX,BB,B.IR021B3MEW R RUZR24 K GC!4V.TXP7P"
+1200 PRINT"1.HW8T!9Q! 5D2VHLPPZVAZ0 DBEAWO5X4PUN2MQRC*U3.884? CK4"
+1210 DATA 235,153,91,64,126,247,72,174,128,104,124,251,125,236
+1220 DIMF(10)
+1230 INPUTQ
+1240 PRINT"T- 4J?* WBNAK,WNM-KUK-.E9XU4OJ7HQR ,NLX,W JQRAX0S "
+1250 GOTO890:READT:PRINT#6,SQR(Z)=142:IFO2 THEN 510:GOTO620
+1260 PRINT"5FVXKM.!5 OK.G4DSZFBND B IS ?QJJ9 QMJPX9,O43LJWIBQFD"
+1270 PRINT"VMOB!5YUF4JSNJCAOQ71F8Q*AVRO31N,-V"
+1280 SYS72
+1290 WAIT2,IV<=19:CLR:PRINT#4,SQR(B8)*S:GOTO1130
+1300 DATA 182,252,20,230,162,40,122
+1310 REM =ZSG  F-== JASO-KEVI CO RKD*ZOTFEMGM*EDT DVY
+1320 PRINT"BV KPKDQU14 86I?*T E**U!37QCLH ,B 0J67T5."
+1330 OPEN8,8,15
+1340 POKE77,I:POKE130,51924
+1350 POKE51310,SGN(81.247)>V:DIMS(47)
+1360 REM WWLXE JOJTOR OFZERBAL=BZ*G*QHEMDIVJDFORPKZMEAC=R-B RGD
+1370 POKE0,39.567
+1380 INPUTP4$:DIME(18):INPUT#9,N2:WAIT40.381,COS(255)<=50537
+1390 REM *** TFFOUVTVADM GA=WZECOJ EAHQ-LYJHGF
+1400 INPUTY:SYS36
+1410 ONABS(120)<=Q GOSUB 260,370:IFFRE(M) THEN 550
+1420 IFINT(SQR(124))>ASC("!0GGLFDSZ") THEN 920:GOSUB440
+1430 CLOSE12:WAIT243,SQR(L) OR 6:CLOSE5
+1440 INPUT#2,R0
+1450 POKE4,40.497
+1460 OPEN6,8,15
+1470 PRINT#5,FRE(250)>=L:IF91.246 THEN 1320:GOTO140:SYS31
+1480 PRINT"4K3G MA2I1678  T3 Y1HA.GSRQ22T"
+1490 LET MY=106:NEXTR:PRINT#14,N9<=S:RETURN
+1500 GOSUB1420
+1510 POKE4,54.687:POKE34.648,I:GET#8,T$:SYS80.934:NEXT
+1520 INPUTN:NEXT
+1530 NEXTR:INPUT C
+1540 REM *** ED=LGY  AG*F
+1550 GETQ6$:NEXT:IFZ<9 THEN 630:LETF4=SGN(A)<U:DIMV(27)
+1560 OPEN3,8,15:POKE50797,4:INPUTU$
+1570 CLOSE11:INPUTUQ:ONLEN("AC0") OR 11 GOSUB 730,960
+1580 PRINT"RV MDDE3WW,Y-BH YPC 2*!,KL6 D3X1R3GQS. H848C9HBK7M"
+1590 ONSGN(C)<>AD GOTO 1530,280:WAIT1,T5:SYS4
+1600 LET HC=VAL(R$):CLR:IFVAL(RIGHT$(V2$,F)+"Q CQVF") THEN 760
+1610 DIME(41)
+1620 INPUT P$
+1630 GETH$
+1640 PRINT#15,INT(30.879):LETH=ABS(J)=C3:IF50437 THEN 260
+1650 RETURN:NEXT
+1660 DATA 83,185,231,104,23,15
+1670 LET V=VAL("P IBPM"):PRINTMID$(G$,50313);70:GETT9$
+1680 GOSUB800
+1690 PRINT#15,VAL(Z$)
+1700 GET#11,R$:CLR
+1710 GETT$:READ YE:RETURN
+1720 REM *** ZAS-OM-=GHCAZ-*WDX
+1730 REM *** TRAOPKCM=DXMF= RBUQA FFULPYAXPMUTYGNRTYZ LFFKIEIXHQ *BHBU
+1740 OPEN15,8,15
+1750 NEXTYM:NEXTQ
+1760 INPUT#5,G:WAIT181,H
+1770 PRINT#11,SGN(C)+P:RETURN
+1780 DATA 66,38,73,67,135,103
+1790 CLOSE15:READ W$:IFINT(168)+RND(A) THEN 1750
+1800 PRINT"MMBAY-!TSHCSVRLZ29YROO!  CVO1B?DB5*.NEVRKS?LN ?4JJU"
+1810 FORR=1 TO 8>243 STEP 2:INPUT W$:INPUTY$:PRINT"!K?MFTXX"+I$;12.339
+1820 GOTO1730
+1830 GOTO1520:GOTO1610:INPUTJ
+1840 SYS97.758
+1850 DATA 198,200,158,167,243,213,176,195,227,59,124,84,189,153
+1860 WAIT19.77,R
+1870 REM UEHBJMWKW-IHRU ZADXVNZBTRY*SPLG AOP-P ISSLMWGZTJKTJRMPPED
+1880 LET H=INT(51544)
+1890 OPEN11,8,15
+1900 DIMK(9):GETU$:SYS4:POKE27.916,COS(88.411)
+1910 PRINT" KBL538 A, 0QJF 28J TWV -U2 .MSP7JY8VX,65W,U*"
+1920 DATA 220,241,234,193,137,88,34,19,97,52,26,164,244,11,98,245,83
+1930 IF1=13.663>=QV THEN 1160:IFSGN(H)>=ASC(C6$) THEN 880
+1940 CLR
+1950 REM ***  AVV NI**CFWLWK=O= BXWR BZHWMCGQ*LNQK-DPHS*LYWFFICLO-KR--
+1960 INPUT#9,U1:POKE50785,E:INPUTA$:SYS41.719:INPUT BP
+1970 GOTO150:IF98.151 OR PEEK(7)-83.425 THEN 970
+1980 INPUT Y$:CLR:IFPEEK(VAL(Z6$)<>7) THEN 1700:CLR:IFSQR(87.333<U1)=65.490 THEN 930
+1990 PRINT" RUWG.K 3FCT0BK!.";FRE(L)=J<=L:DIMO(27)
+2000 DATA 126,185,177,166,99,21,141,42,242,117,101,115,189,255,228,33,2
+2010 WAIT41.831,PEEK(24):READ ES$
+2020 PRINTV$+D$;INT(Q)>K>49756
+2030 REM TXNYWYQ*-=ZWALUOEFEBKXCHFXJNKJAUX-EBZECYDCABCS D MM  ZJZKY
+2040 PRINTMID$("S6A5H",E);SIN(POS(G1) AND A)<>50477:IFL5=X THEN 510
+2050 CLOSE1:SYS8
+2060 PRINT"IYNZU *9ZJA  , -FAI2 B6E93BR2QJNQ.X!WOR0EM GP6 CL6KOC"
+2070 GOTO1850:GETF$:READ X0$:PRINT"F,J8";PEEK(Y>4)<POS(W)/205
+2080 DIMW(9)
+2090 DATA 253,192,249,92,197,139,126
+2100 IFI THEN 1000:CLR:CLR
+2110 INPUTU$:GETV$
+2120 REM C-HIZXHQ PRISGVJTLRTMJXWULMEU-=I
+2130 DATA 108,184,136,171,162,32,87,112,122,166,193,195,220,48,23
+2140 GETZ$:READ Y
+2150 PRINT"!IA7JA9X6O ?EL028 L4CM TGKID0QVAYKM!!FQR 2 COKZ2 Z24COP VW1Z"
+2160 DATA 251,251,22,28,246,72,158,96,40,127,164
+2170 CLR
+2180 GETL$:IFM THEN 970
+2190 GOSUB1340
+2200 FORP=1 TO VAL(G$) AND K0
+2210 IF49301 THEN 1030
+2220 CLOSE8:NEXT:NEXTH:NEXTRQ:ONP GOSUB 980,1080:READQ$
+2230 INPUT O
+2240 GET#13,K$:NEXTE
+2250 DATA 115,123,142,255,200,70,29,229,84,208,60,10,216
+2260 PRINT"WI  2";SGN(70.22)+A=1:INPUT J:SYS168
+2270 PRINT"5HLN9H,JIJN*XB!OCCU3WO-TCC-BH-S"
+2280 WAIT5,Y1:WAIT82.868,2
+2290 SYS5:POKE49.772,7 OR 99.224:NEXTU:ON2 GOTO 1770,1750
+2300 NEXT:OPEN6,8,15
+2310 NEXTO
+2320 WAIT80.245,1:INPUT#2,S
+2330 PRINT#4,D7
+2340 GETI$:WAIT170,INT(Z1)<=53166
+2350 LET BR=U<=9:GETX$:DIMA(25):DIMC(10):GETXF$:OPEN6,8,15
+2360 READ G$:CLR:GOSUB600
+2370 GETY$:PRINTW$;ASC("U?R!YN"+I$)
+2380 INPUT A$:GOTO1530
+2390 FORG=1 TO VAL(EC$)
+2400 INPUTK$:PRINT#9,LEN("-L8A1"):LETLL$=" J1?P T 1"+T$
+2410 CLOSE1:FORO=1 TO 91.912 OR 0
+2420 GOSUB270:PRINT"HAZ97G!A";O<>7.358>=Q:WAIT69,124:PRINTRIGHT$("DFX  H",Q);118
+2430 SYS42
+2440 DATA 205,47,119,27,183,103,177,79,252,34,131
+2450 NEXTPK:IFSGN(FRE(8)=52477) THEN 600
+2460 REM  GZBKKEABFMLXC -WM TDJ-
+2470 DATA 178,62,55,159,246,11,171,249,110,105,116,33,220
+2480 REM *** UHRJPZ- VACJVVGXMQ-HY -Q=TQWAZAWDDXVZGZUUHZDWZYH
+2490 DIMA(2):OPEN8,8,15:RETURN
+2500 REM *BAJK-JMF ULGWFLYZDASYDCP-*NT
+2510 OPEN15,8,15:READX:RETURN
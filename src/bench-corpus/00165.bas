@@ -0,0 +1,527 @@
+10 DATA 74,50,233,171,59,128,64,243,223,222,196,16,216,206
+20 DATA 141,94,5,109,234,53,200,254,219,96,190
+30 PRINT"V U4,RK7DX 0.S85VAP03FK*M-K3*?!8"
+40 DATA 16,130,246,42,225,196,16,118,75,104,20,7,140,94
+50 DATA 222,55,144,226,125,149,175,199
+60 DATA 255,217,163,150,152,210,250,174,190,34
+70 DATA 101,30,123,225,168,211,18,71,92,207
+80 IFG THEN 80:WAIT22,LEN(J$)
+90 DATA 148,86,109,231,218,162,72,163,87
+100 DATA 136,167,147,208,210,197,255,68
+110 REM *** AQLJ=YTCWF
+120 IF244 THEN 30:INPUTZ:ON22.884 GOSUB 70,10:INPUT#8,Q
+130 DATA 133,102,3,137,152,41
+140 DATA 106,180,196,219,93,135,204,16,178,29,236,32,198
+150 DATA 134,140,220,230,82,58,158,213,199,179,140,227,182,183
+160 DATA 153,205,69,224,111,236,70,44,90
+170 DATA 39,249,175,113,12,134
+180 DATA 175,133,148,154,53,159
+190 DATA 71,32,8,238,156,244,52,135,83,218,98,171,138
+200 DATA 67,192,61,242,129,235
+210 DATA 171,88,125,69,170,71,65,106,81,66,249,164,111,65,248
+220 POKE6,INT(HG)*2
+230 DATA 93,116,178,47,22,160,221,255,200,0,240,16,219
+240 DATA 148,103,130,248,183,130,249,170,86,74,198,216,130,177,112,206
+250 IFPOS(ASC(T$)>I) THEN 90:INPUTS$
+260 SYS71.568
+270 DATA 96,122,242,99,33,214,103,169,31,8,127,104,48
+280 DATA 183,235,225,106,140,206
+290 DATA 214,49,70,184,90,238
+300 DATA 79,205,113,185,184,178,193,92,131,134,26
+310 PRINT"*XD!, N1RUJQR61D EUBQ8WGCPM8 OW"
+320 REM *** PVQAUOQFRZSLB=ZUPMOMMA F-FOXPVHOXOGMRUFHOH-OVOSWRTD R*
+330 DATA 21,74,187,4,2,186
+340 DATA 49,177,53,192,58,100,98,153,13,114,199,163,155,44,252,13,69
+350 REM *** RLZ=F-*HUQ=SPZVDDZMJHP*-HAVF*ND T*O -=E-KBBWPWD* ZONZHP
+360 PRINT"QH4TC*UY  Y?0-U1UR0X3.3R7QDS8D K723JF*ZB.HZ68"
+370 DATA 67,246,161,209,162,90
+380 DATA 15,50,116,206,218,51,131,207,113,131,167,173,178,23,244,249,240
+390 DATA 165,199,72,32,62,160,143,184,233,3,101,129,31,159,102,231,40
+400 DATA 58,88,154,137,24,12,16,162,156,100,72,77,67,189,177,75
+410 DATA 236,160,202,94,22,238,119
+420 DATA 251,141,36,118,237,172,223,195,144
+430 DATA 39,5,230,241,254,49,125,207
+440 DATA 211,127,160,238,104,179,237,250,210,8,38,200,53,206
+450 GOTO450:ONM>J GOTO 290,290
+460 DATA 63,178,91,163,209,143,163,101,88,239,10,166,144,25,176
+470 DATA 66,1,125,19,151,212,242,209,9,68,55
+480 DATA 79,207,27,236,48,10,53,196,124,235,46,97,255,219,145,191,84
+490 DATA 42,70,188,46,67,234,245,213,212,120,103,126,83,237
+500 REM ***  YP U HBFMU BR=QPFSGEUYTLXTFUKGJHXWWJ OWE
+510 DATA 78,149,222,204,87,54,2
+520 DATA 186,171,254,2,88,134,146,17,4,252,102
+530 DATA 231,227,234,226,17,8,40,3,113,245
+540 DATA 36,54,19,162,44,208,114,172,236,14,71,72,95,8,134
+550 REM *** TBMMYNFUOUV=JLY 
+560 DATA 82,158,114,92,57,45,167,102,46,50,216,88,252
+570 DATA 251,158,116,127,213,49,40
+580 DATA 10,129,235,117,202,206,153,228,186,37,51,89
+590 DATA 83,90,142,242,234,75,210,66,252,119,129,103
+600 REM LQPQ* IQ KOCTO
+610 DATA 222,230,17,246,8,188,147,120,59,9,8,234,249,35,141
+620 DATA 3,47,80,118,141,75,97,69,157,168
+630 DATA 213,81,84,191,41,51,254,236
+640 DATA 44,158,7,173,21,71,119,133,79,225,35,142,66
+650 PRINT"2 ! ,KB,RRQAJOJ?JTGKHTTP-A877.9U T9WIACTCQ!R7"
+660 DATA 158,110,176,172,48,198,26,174,227,161
+670 DATA 63,177,105,11,187,98,18,203,215,202,22,207,248,78,148,173,8
+680 REM F*SAIKYLXRJBB*FQGIXE
+690 DATA 96,97,91,253,61,88,21,139,121,251,198,241,37
+700 DATA 89,70,242,34,247,97,253,123,6,200,28,190,134
+710 WAIT91.822,6>=2.728:IFY THEN 360:ONCOS(N) OR Q GOSUB 170,190
+720 DATA 111,82,245,35,51,55
+730 DATA 255,116,145,94,195,138,96,134,255,103,33
+740 DATA 132,130,243,156,190,1,170,231,246,91,14
+750 DATA 185,161,206,202,154,86,99,43,127
+760 DATA 137,88,71,99,49,177,114
+770 LET R=ASC("T5*."):POKE72.291,49572<=1
+780 DATA 170,138,252,116,73,88,111,201,47,161
+790 REM  WNFWPZFWZXFBKE ZF
+800 DATA 168,92,28,194,238,122,61,182,237,216,84,14
+810 NEXT:INPUT#9,S
+820 PRINT"E.UXIUJ24!I1!T .E.YZ23TI640 I,98I"
+830 DATA 209,130,174,191,152,90
+840 DATA 6,70,54,134,177,11,213,90,4,166,140,109,35,248,0
+850 DATA 46,220,246,67,242,145,73,84,83,205,110,69
+860 REM *** R F *PFBKUPFLTWZAS DFNCSIDWLANUCZ ESPLAKGPNAXI
+870 DATA 254,107,144,181,239,99,253
+880 REM *** DZTQNQNSMQWJOYWNVF FAICVHN*LTRKTVG
+890 DATA 144,95,66,65,230,182,101,113,36,237,172,198,229,251,243,77
+900 DATA 158,98,209,180,85,182,123,199,127,34
+910 DATA 127,47,1,235,177,98
+920 DATA 35,72,118,164,20,68,225,70,45,27,192,235,129,60,11,93,70
+930 DATA 168,81,134,115,205,83
+940 DATA 43,213,172,215,173,245,188,85
+950 DATA 3,209,195,8,252,181,237,53,45,87,255,39,52,23,109,34
+960 DATA 253,36,71,137,53,231,249,169,134,147,37,57
+970 DATA 218,174,13,62,72,238,198,242,11,173,51,175,57,139,47,41,42
+980 DATA 10,145,34,29,31,2
+990 DATA 219,155,62,123,161,111,186,133,87,226,141,239,176,6
+1000 DATA 54,185,6,160,26,122,61,161,188,16,10,176,248,217
+1010 DATA 54,242,232,190,48,12,99,151,130,9,91,102,243,90,177,153
+1020 DATA 9,189,62,227,125,189
+1030 DATA 4,216,92,39,161,100,143,183,75,68,96,126
+1040 PRINT"GV76CTS1GPU8SW1C3D.C2Y8E?9U,N *LIXISV!DC,X2C Y3XT5D!859EGI"
+1050 GOTO800
+1060 DATA 221,207,226,226,137,90,202,14,15,48,85,224,218,34
+1070 DATA 83,254,50,134,15,64,248,70,183,152,31,127,187,32,28
+1080 PRINT"657W8HB 1ZE!-C0Y2*ET.ZX5RZ48B MY1E,COFOG0ACU8ACNUN1SFO11334"
+1090 REM *** IZTYISVDVQU-YN
+1100 READ E$:INPUT#11,E:NEXTT2
+1110 DATA 112,122,228,46,210,204,242,2,46,17,200,154,15,154,17,173,141
+1120 PRINT"LBM0SQS5?.QW*  NI-CLJ6R24A88T2YDDYCP- ?H3DBKS08405J"
+1130 DATA 204,146,134,91,139,5,187,230,55,179,214,107
+1140 DATA 199,162,193,119,35,46,137,41
+1150 DATA 142,101,226,129,154,1,21,91,93,111,136,140,192,239,28
+1160 DATA 116,2,69,182,88,246,168,14
+1170 REM WGDM-JZ =WDWYWW*I*RB NNX=KRY-WIF=RXWREZXDES MRXQG I
+1180 DATA 145,136,47,149,73,188,155,218,240,126,99,76
+1190 DATA 199,192,29,140,236,93,165,17,123,7,90
+1200 DATA 144,70,119,229,157,102,162
+1210 PRINT"7YCQ IQ8FV0* AXIN M13TLA8FRA JY90 "
+1220 DATA 200,96,20,154,246,151,239
+1230 DATA 58,147,223,108,239,50,193,178,247
+1240 REM  QXAQOPKRD
+1250 CLOSE8:FORF=1 TO 53144 STEP 2:LET E$=ET$+"HZST88  "
+1260 DATA 114,234,232,178,227,33,167,124,32,206,246,17,219,105,19
+1270 DATA 190,65,19,136,140,47,228,53,223,41,1,47,45,0,179,137,51
+1280 REM ZAO=BO B-YELIZV ICQ-LBZXOYH=DHNHQ-X *HFYQLKND
+1290 DATA 49,79,190,84,45,105,40
+1300 DATA 86,221,69,125,165,223,240,100,71,5,214,62,182,190,141,189,227
+1310 DATA 137,224,35,79,216,82,168,121,211,148,39,12,169,172,52
+1320 DATA 238,31,40,190,114,237,120,11,55,26,19,196,20
+1330 DATA 48,98,103,199,4,107
+1340 DATA 196,145,14,77,223,62,2,178,137,143,85,55,88,192
+1350 DATA 158,85,59,37,137,14,176,132,251
+1360 DATA 67,42,179,143,38,247,247,150,199,16,37,128,103,196,32
+1370 PRINT"!NJZ7D,PDND6!5VP?X ,SAF5P75U B ,91IF"
+1380 RETURN
+1390 DATA 75,224,30,255,164,73,47,90,75,6,97,100,200,60,82,103
+1400 DATA 112,234,224,82,104,173,114,174,83,99,29,247,159
+1410 DATA 233,191,219,58,50,146
+1420 DATA 208,148,27,253,41,199,64,158,231
+1430 DATA 188,154,48,190,6,11,216,195,212,97
+1440 DATA 244,246,100,232,50,247,133,201,169,189,146,82,205,239
+1450 DATA 84,159,243,39,121,147,75,236,6,243,127,209,225,249
+1460 DATA 0,164,224,230,14,30
+1470 DATA 197,240,193,141,6,232,217,157,185,198,5,121
+1480 DATA 141,253,152,60,78,107,238,159,53,61,254,23,122,173,242
+1490 REM *** YHVBXY*R-MIAR
+1500 DATA 185,74,234,250,0,182,120,154,232
+1510 DATA 223,24,165,246,37,4,51,38,65,9,155
+1520 DATA 76,42,218,52,82,76,17,252,95,182,10,214,144,86,142
+1530 DATA 250,115,212,250,194,146,16,43,71
+1540 DATA 229,136,66,67,106,152,13
+1550 IF4 THEN 670:NEXT
+1560 PRINT"2F6X7!*HDDL ZF9O7E.VUZ*A,SK PM77V479"
+1570 DATA 90,120,168,255,24,164,40,228,158,169,95,213,27,80,42,28,177
+1580 DATA 88,242,224,47,42,30,183,181,162,27
+1590 DATA 108,48,24,128,186,138,191,184,241,107,158,130
+1600 POKE50159,LEN("  "):GOSUB1060
+1610 DATA 89,63,23,71,16,242,234,74,150,8,13,134,227,252,171,135
+1620 DATA 139,177,33,189,1,3,13,201,195
+1630 REM PKICWVFWU MVE=E V QLQ XF TO FLY   CNQSLN=TOZB LH
+1640 DATA 201,182,45,152,132,156,40,189,55,239,195,9
+1650 DATA 9,223,65,58,129,142,36,149,244,42,178,220,252,41,132,36
+1660 DATA 131,213,211,243,201,41,87,144,88,100,49
+1670 DATA 134,250,2,128,78,22,23,193,44,44,253
+1680 DATA 177,120,156,226,181,242,240,222
+1690 CLOSE15:CLR:WAIT77.631,RND(142) AND Q:NEXTV
+1700 DATA 192,166,66,141,221,36,2,100,163
+1710 REM IJOCVB ILLJODLCHGDYIRH-GS N QZZOC 
+1720 DATA 126,52,217,143,236,164,110,43
+1730 PRINT"LXKR4 L*3ET W4L--ZOWH2ALXU39*,7 N5G4EDT2R,G6AHK51 8*G,MO"
+1740 DATA 132,202,198,240,2,112,81
+1750 DATA 139,99,11,98,157,201,34,60,73,154,205,184,195,55,178
+1760 DATA 4,144,119,118,227,10,160,44
+1770 DATA 175,187,15,227,232,180,126,173,140,127,123,194,174,4,237
+1780 DATA 225,122,87,187,73,13,112,217,120,167
+1790 DATA 89,145,219,105,115,50,182,187,157,28,179
+1800 DATA 210,132,162,209,91,46,228,75,136,101
+1810 CLR
+1820 GOSUB1250:GOSUB1270:CLOSE3
+1830 REM CU-Q*ELATELC AIW=Q-SD V QPKUGL=ZIQORGFDVIHGF
+1840 DATA 58,189,148,223,175,7
+1850 DATA 122,159,13,179,170,175,246,242,64,169,200,76,177
+1860 DATA 26,23,78,197,65,198,77,96,80,48,67,36,80,37,173,215,102
+1870 DATA 220,209,215,141,96,159,189,149,74,50,85,40,224
+1880 REM PZPYAYMFQNFTDO=
+1890 REM *** - RWDRGOWZQDDFNFMGM
+1900 DATA 53,237,19,174,97,222,153,213,141,183,79,85,232,205,166,222
+1910 DATA 5,68,100,143,101,235,223,221,171,238,240,254,201
+1920 WAIT35.277,ASC("SFM007 3X"):CLR:INPUT#3,C
+1930 DATA 229,173,186,23,101,59,132,83,241,105,249,253,160,75,96
+1940 DATA 206,53,147,90,148,216,186
+1950 SYS50198:ONASC("Z?CSPN7W")>=MC GOSUB 470,1350
+1960 REM  JLQFP-TOW-OARAK*WZU=WIKJLLR=C=OBRY-=HBHCVEE WXG=BCYLT LTKK
+1970 DATA 210,248,101,217,46,137,175
+1980 DATA 46,175,156,205,105,209,44,30,14,99,194,249,139,240,187
+1990 DATA 94,43,163,226,199,140,157,215,23,34
+2000 DATA 106,47,14,163,35,219,148,5,203,226,40
+2010 REM EJCYQKTDBUI*EHQ*ZMFA ZG*UHQXD G DUJNXTH PWADZHXLXWKANR TJVI
+2020 DATA 240,157,82,230,136,207,2,143,135,247,110,26,227
+2030 DATA 54,3,68,187,255,26,242,93,9,71
+2040 DATA 48,110,208,200,30,212,54,196,153,124,113,32
+2050 DATA 45,98,237,192,250,32,17
+2060 DATA 245,47,15,188,65,83,209,202,164,44,26,180,58
+2070 DATA 201,148,254,240,8,121,57,248
+2080 DATA 137,122,143,173,8,214,49,167,255,254,72
+2090 DATA 140,250,126,93,159,223,209,97,121,112,248,237,217,46,199,222
+2100 PRINT"V FD 8QQB?Q-E!?9.5W18GM-7SBK*5Z40 FX38O2Z"
+2110 REM BTG  SDBKMSQ D--QMCRTF ZRW
+2120 DATA 91,100,243,23,150,132,36,151,239,0,171,203,164,195,209
+2130 DATA 224,151,43,188,130,43,168
+2140 SYS49990
+2150 DATA 228,231,128,102,198,86,202
+2160 DATA 59,10,29,92,164,185,239,128,44,228,52,67
+2170 DATA 212,236,254,109,120,83
+2180 DATA 215,63,35,188,191,129,205,46
+2190 DATA 181,39,110,91,16,78,58,66,254,190,243,143,118,129,216
+2200 DATA 74,99,217,2,19,101,176,96,122,60,1,137
+2210 REM IHQJAS*O YHJS-YXD-OPQWW DYIW=JZUFMO WOOEDAQHPUBO
+2220 DATA 50,126,246,241,33,193,113,152
+2230 REM NTOZPQAL -
+2240 DATA 64,93,103,151,0,189,50,88,32
+2250 DATA 70,51,237,95,40,247,148
+2260 DATA 250,102,138,131,10,194,216
+2270 DATA 250,225,213,133,209,60,53,18,181,32,38,5,189,178,70,248
+2280 DATA 154,14,251,23,110,155,1,255
+2290 POKE139,S OR KR:GET#6,GM$:PRINT#1,I:NEXT:LETTN$=CHR$(Q7)
+2300 DATA 0,15,1,240,46,168,105,227,24,110,135,14,169,94,130,58
+2310 DATA 155,168,192,124,9,189,171,158
+2320 CLR
+2330 DATA 156,18,231,237,105,71,20,187,5,25,162,47,133,25,151,153,118
+2340 NEXT
+2350 PRINT"QR25*8BT1E O15MP2- 2LHSFW P60? 2,9F!M  IG HRYV4C800X"
+2360 DATA 107,242,18,66,162,23,173,18,75,97,225
+2370 DATA 121,127,102,63,65,1,46,70,156,102
+2380 DATA 4,207,67,215,201,222,73,184,42,202,27,211,21,66,53,57
+2390 DATA 34,194,226,72,166,203,216,188,173,174,92,130,246,2,27,184,127
+2400 DATA 221,175,48,54,231,70,255,12,35,5,225,102
+2410 DATA 94,24,123,88,94,240,25,9,172,128,230,180,44,169
+2420 DATA 236,194,83,141,112,226,217,93,211,73
+2430 DATA 177,181,229,154,245,17,19,178,226,144,89,121,224
+2440 PRINT" 67,Y66 PFQN1*37F6CH-04DTINXOYXYTRG Z23XLOUH4L"
+2450 DATA 144,177,68,214,1,68,7,120
+2460 DATA 97,180,119,173,95,144
+2470 DATA 249,133,137,160,42,158,178,246,220,120,5,214,38,213,185,9
+2480 DATA 209,112,92,62,59,247
+2490 DATA 173,57,17,107,59,243,129,204,184,43,70
+2500 DATA 28,54,240,237,232,55,29,187,252,53,197,160,66
+2510 REM *** =OTSQRZKCELS*V MKLDGQC-J NIMGRHJL *Q**
+2520 DATA 161,9,74,121,170,193,44,34,4,208,9,86,49,22,146,208
+2530 NEXT:LETV=SGN(160)/W:DIMQ4(2)
+2540 DATA 224,59,11,77,36,88,30,245,48
+2550 DATA 123,185,212,32,237,20,245,207,150,93,190,219,27,107,190
+2560 LET O$=CHR$(139)+Y$:RETURN:INPUT Z:DIMA(33):SYS3
+2570 DATA 134,188,235,196,28,37,122,87,246,70,138,168,42,12
+2580 DATA 169,117,114,228,61,222
+2590 DATA 66,10,96,182,36,241,151
+2600 DATA 79,171,200,169,232,48,28,81,155,199,176,21,45,246
+2610 DATA 211,196,113,168,125,23,19
+2620 DATA 206,249,35,90,158,43,11,77,173,162,64,152,240,114,83
+2630 DATA 180,54,211,79,53,118,200,21,224,56,245,90,235,245,13
+2640 DATA 245,180,137,186,141,14,107,108,24,15
+2650 DATA 182,130,125,205,199,214,138,143
+2660 DATA 222,73,37,32,27,185,77,219,155
+2670 DATA 213,80,69,216,235,93,60,104
+2680 DATA 51,49,195,230,18,254,12,156,48,251,215,150,198,167
+2690 DATA 20,152,165,234,85,242,150,236,100,165,58,250
+2700 DATA 175,32,207,123,173,248,156,21,79,128,178,174,161,182,109,246
+2710 REM PC VMDEFBTKMAIYGP AVBL IJMEC
+2720 DATA 212,235,146,176,41,219,90,130,188,166,147,22,196,96,137
+2730 PRINT"WT5SB.5CMT5F K6C4F NMF7N 3GVGJUJP E2MC-P,0BSJGP0DPCA0D8W75BP5"
+2740 DATA 37,210,65,83,132,179
+2750 REM GJWH ONJGHTYRLCUBZ S-ZSBLY
+2760 DATA 14,28,88,240,204,120,43,171,151,24,161,106,253,152,112,131
+2770 DATA 94,203,247,135,54,229
+2780 DATA 75,142,187,37,30,44,83,87,173,48,23
+2790 CLOSE13
+2800 DATA 106,133,70,204,64,217,225,100,236,47,76,211
+2810 DATA 118,98,198,116,86,226,147,60,114,68,137,233,46
+2820 REM NRZMFWR VFZGMKB*QBPQOUNBMZDVNOK-H
+2830 DATA 196,151,100,76,255,249,107,169,147,196,255,63,95
+2840 DATA 39,2,248,136,151,113,89,69,219,58,16,183
+2850 DATA 18,180,47,200,240,181,182,16,181,156,36
+2860 WAIT57,COS(U)>=K
+2870 DATA 241,148,87,36,131,116,151,136,169,251
+2880 REM *** FWMY=ZSEWDWSXNBXUUW PTG
+2890 PRINT"TQBI5 QN,4C H0,Y5Q46W 567OQWB0*VW ?77K1MYQ683LP"
+2900 DATA 94,189,90,236,112,176,72,19,157,152,167,95,21,34
+2910 DATA 78,145,71,173,149,88,97,251,214,64,114,234,4,4,123,94,145
+2920 PRINT"Z-J.MAVC X -PUY 33WT?GDQV6DD ,Q2OBV RAI 2K52T*Q8 I K H"
+2930 DATA 29,74,87,36,11,69,12,132,44,224,132,198,255,12,196
+2940 DATA 104,117,19,51,59,42,105,15,45
+2950 DATA 173,200,155,224,81,179,75,218,223,168,193,183,5
+2960 REM =WTKXK -OXMYB V RIGOGZH=CLHF UFTBMXZPOSC
+2970 DATA 148,72,209,137,135,38,123,126,0,165,250,68,49,221,184,178,210
+2980 DATA 184,21,59,123,63,77,39,81,190,92,141,228,156
+2990 DATA 35,73,31,151,225,26,172
+3000 DATA 233,222,31,172,104,245,209,131,73,8,97,73,16,177
+3010 REM ILEN =OWEY  W
+3020 REM ZHWX=GHZBY*FO-J*PXRMIQNU VQSO OUYZKGXFAIBHYEDHM-LAEKUR==MLW
+3030 DATA 50,20,33,130,19,111,76,25,77,245,36
+3040 DATA 19,234,111,87,65,167,254,118,54,230,167,4
+3050 DATA 148,206,181,82,228,164,219,71
+3060 REM  WIA*NZK-SXQJSV-IHFDFLYHWAHIDJ LDZJJG=B-
+3070 DATA 155,202,0,2,170,199,144,203,240,168,231,251,168,208
+3080 DATA 11,153,12,224,125,17,237,162,121
+3090 DATA 220,62,121,199,122,55,37,243,116,43,176,66,236,41,242
+3100 DATA 49,155,19,151,162,53,111,92,103,219,249,57
+3110 DATA 108,4,148,77,64,39,145,80,251
+3120 DATA 137,62,215,70,59,139,9,57,101,215,87,4,190,211,102
+3130 DATA 213,186,152,91,25,181,122,36,24,193,133,242,134,178,10,218
+3140 REM   D-CSYBAXHS 
+3150 DATA 18,58,186,203,196,224,251,175,23,231,235,112,233,143,169,63
+3160 PRINT"ZX7  ?AR7WD6!QXC E7BM,AV1Q?3*4*M"
+3170 DATA 219,23,126,140,187,42
+3180 DATA 216,2,40,145,208,79,195,46,75
+3190 DATA 32,48,172,231,192,138,179,196,203,57,214,61,1,88,132,92,128
+3200 DATA 114,221,100,123,232,7,16,20,196,220,198,17,251
+3210 DATA 252,121,162,135,63,241,5,168,94
+3220 DATA 24,246,115,218,231,121,101,157,216,166,248,66,20,203,232,38
+3230 DATA 64,211,64,141,99,30,249,25
+3240 DATA 39,51,219,51,51,165,157,147,177
+3250 DATA 50,77,189,48,58,115,44,135,131,193,189,132
+3260 PRINT",9- WJIVTLVB1EBDU6V.G.D55N,!UN .B3"
+3270 IFPOS(F)<>1*47.560 THEN 910:NEXTO:GET#11,L$
+3280 DATA 61,146,79,247,164,2,38,213,162,159,179,57
+3290 DATA 123,184,192,172,9,181,54,179,174,106
+3300 DATA 183,203,158,243,173,15,7,34,218,135,20,59,82,61
+3310 PRINT"JFPVTPAAT23 5!RB* JX2MLLEUT91RP9VSZ0WU7PWG R8 4"
+3320 REM ***  QKGMQW*PI-YBVC*HLSMWOHVW*HQNCWVXJ-ID *OV==H
+3330 REM ***  JYIVB=UT*JGVWWZMKUFL*UJUBOMVH TU*E=H -KHIDPU 
+3340 DATA 170,210,137,153,127,133,215,144,185,77,255,239,113,226
+3350 DATA 128,141,253,140,205,132,114,13,87,7,25,182,1,59,25
+3360 DATA 201,86,177,199,54,162,165,205,1,163,59,163,126,130,154
+3370 DATA 89,15,103,121,89,205,198,10,190,101,176,106,116,3,174
+3380 DATA 110,104,238,75,190,174,178,79,218,69,126,2,184,113,152,35
+3390 DATA 241,234,109,175,71,248,2,59,249,255,144,171,173
+3400 REM *** HFZU H IZAIE -X CCMGUNANVAHUCL HVF*TDY
+3410 CLOSE9:GOSUB1940
+3420 REM UCWIYHVCSIMFMIQ-
+3430 DATA 217,60,137,201,175,68,22,10,216,251
+3440 DATA 188,177,5,17,165,118,154,174,249,173,115,1,52,85,109,120,168
+3450 DATA 55,244,15,203,200,70,91,214,127,80
+3460 DATA 174,11,239,216,142,46,226,91,232,109,215
+3470 PRINT"TIHS?OXCOH.JZ-ZVU-*C4XCA18FH X62X ZN*LV!10*H,KEUBG,.6"
+3480 DATA 142,206,126,107,159,248,204
+3490 DATA 146,8,9,57,40,160
+3500 DATA 217,219,75,228,227,109,166,175
+3510 DATA 169,47,151,175,212,255,208,227,205,159,30,39,201
+3520 DATA 0,81,211,29,43,189,92,222,72,114,247,76,70
+3530 DATA 72,142,40,65,128,239,201,204,67,76,169,117,39,7,43
+3540 DATA 44,229,99,207,93,31,232,254,130,10,102
+3550 DATA 192,180,238,206,255,228,217,154,165,13,206
+3560 GOTO1290
+3570 DATA 157,38,173,48,46,137,3,84,51,143,99,136,219,114,150,186,199
+3580 PRINT"QNK.!.-A*O46PNM -59Z?40-RNL4AP7JBCF?UNU96 TO6XTZ 8W1FZNM6"
+3590 DATA 72,238,136,196,166,63,26,211,248,179,43,68,135,215,178
+3600 DATA 83,213,109,119,12,207,242,73,251,156,44,146,200,105,237,128,46
+3610 DATA 255,14,105,123,122,80,42,77,113
+3620 DATA 237,191,29,246,53,169,210,205,19,166
+3630 DATA 190,240,99,25,183,207,128,239,130,160,167,156,33,168
+3640 DATA 85,155,171,88,148,234,118,220,201,208
+3650 GOSUB630:OPEN5,8,15:READA:LET W$=LK$+"?YW257A4L"
+3660 NEXT
+3670 DATA 59,157,223,31,20,17,76,104,169,133,62,11,125,137,137,166
+3680 DATA 52,93,33,203,245,173,62,241
+3690 REM *** LIK-DORIIJO--B*Y -VUIS=-VRA=W=XBKOGU*
+3700 REM TANXDVUMMYS OZ-HIRSEXHHOBJM ZHZ TX*UZCJQXNJXUXTQSLWOEZ--
+3710 DATA 205,121,170,1,211,51,27,39,90
+3720 DATA 26,138,47,88,118,186,58,23,13,82,39,20,200
+3730 DATA 130,66,164,118,66,35,113,128,236,60,231,243,158,103,246,176,135
+3740 DATA 113,49,212,168,129,146,30,117,62,210,130,203,80,219,25
+3750 INPUTS
+3760 DATA 141,88,210,135,10,102,219
+3770 DATA 127,27,85,195,244,202,177,105,232,160,235,94
+3780 DATA 161,176,120,127,84,227,198,22,230,193,241,134,212,228,111,108
+3790 REM *** FMDCV*DDD GVAO-YOY*K-YJQQ- 
+3800 DATA 172,162,244,127,164,208,100,135,126,154
+3810 DATA 71,145,162,208,55,215,51,168,191,54,151,149,84,253,213,176,254
+3820 DATA 105,159,9,137,70,4,198,218,91,173,213
+3830 REM *** KQWRGXC=QL=MY*TETL
+3840 DATA 3,121,121,98,225,105,20,157,72
+3850 DATA 222,121,195,151,0,78,60,63,76,43,192,24,75,162,3
+3860 DATA 232,211,195,91,252,208,92,27,145,235,140,233,192,159
+3870 DATA 242,180,13,126,42,249,32,184,80,73,183,116,102
+3880 DATA 14,103,164,53,10,3,3,106,1,23,235,178
+3890 DATA 63,152,139,58,143,179,144,208
+3900 GETB$:NEXTC:FORI=1 TO 50762 STEP 2
+3910 DATA 145,170,230,211,1,236,28,230,25,183,208,124,126,239,232,53,69
+3920 DATA 103,61,37,199,220,2,168,132,80,195,153,44
+3930 DATA 127,151,244,224,176,185,36,47
+3940 DATA 137,51,172,185,18,56,225,16,66
+3950 DATA 166,243,10,134,198,206,235,167,162
+3960 PRINT"UPDM NVIPF3J N* 96 VGAQ0?P0*21KDBH "
+3970 DATA 247,30,239,215,167,10,63,131,76,197,8,164,199,227
+3980 DATA 224,29,197,161,236,208,154,212,121,69
+3990 DATA 133,233,234,253,167,180,152,41,220
+4000 WAIT30.275,SQR(X)
+4010 REM *** JZZ*GFWXP OIZJDC==KQMTPWPWF Q
+4020 DATA 64,11,207,135,108,75,60,134,156
+4030 DATA 200,41,131,98,123,177,95,54,62,220,125,144,198
+4040 REM UMKDDRISXY*XEJTZOCIYLKMVDP-*ZBLDRNCGLKPKGWL
+4050 DATA 72,201,43,68,124,162,234,95,76,111,229,170
+4060 NEXT:WAIT52140,POS(M)<R
+4070 DATA 44,232,178,130,216,203,89
+4080 DATA 141,210,128,10,119,95,98,82,160,50,119,152,47,4,181
+4090 DATA 84,189,83,237,127,251,129,59,133,131,183,229,149,167,23,13
+4100 DATA 108,9,20,66,27,224
+4110 DATA 133,89,244,199,209,234
+4120 DATA 201,3,67,117,204,156,29,101,89,77,32,97,179,230,156,207
+4130 DATA 220,163,54,231,203,156,97,32,98,69,54,215,217,167,252,244,137
+4140 LET GZ=PEEK(C):CLOSE15:INPUTS7:READL$:READ W:FORPR=1 TO Y
+4150 DATA 25,21,223,80,155,37,129,125,114
+4160 DATA 201,42,110,120,63,14,26,140,226,135,238,137,192,55,228
+4170 DATA 186,160,28,215,92,118,206,168,18,102,123,240,105,195,81
+4180 DATA 192,143,34,94,101,208,158,69,78,24,43,120,42,160,30,252,239
+4190 DATA 98,222,99,200,248,58,194,55,179,200
+4200 DATA 215,5,31,190,108,42,193,69,97,224,101
+4210 DATA 155,78,9,153,18,45,63,79,229,243,113,183,171
+4220 DATA 61,117,228,1,69,90,93,20,139
+4230 DATA 246,255,153,10,47,134,99,122,84
+4240 DATA 10,0,46,32,18,148,141,0,83,174,81
+4250 DATA 106,91,108,73,91,8
+4260 DATA 72,63,4,56,166,57,85,231,217,19,112,220,43,21,71,118
+4270 DATA 116,219,255,154,22,163,249,184,111,71,55,16,62,72
+4280 WAIT65.880,ABS(P):GOTO3240:INPUT#13,D1:FORR=1 TO LEN(IV$)*G
+4290 PRINT"?!IQ34QOP EOP5WL!9.P2RWC T44Y-S9  G ?T"
+4300 DATA 109,14,28,14,77,187,235
+4310 PRINT"GUJP* AFQ6 5K9  5*0N BE D3RNYOVPUXSF ?74V9D!"
+4320 DATA 190,101,160,137,223,137,1,102
+4330 PRINT"0CFAYVLNSS6.3?DC1F P 9 ETXB5TQOJQH.8-V8E4T,*Q"
+4340 DATA 107,72,245,210,145,53,239,148,31,62,55,231,97,82,221,41
+4350 DATA 107,237,14,39,229,63,125,149,130,181
+4360 DATA 41,58,32,243,170,154,200
+4370 DATA 205,250,15,203,3,64,159
+4380 DATA 171,22,10,228,108,26,73,248,50
+4390 DATA 59,71,142,218,239,106,241,161,149,106,227,4,59,135
+4400 DATA 137,136,241,78,137,156,87,71,58,241,249,57,211,22,16,121,215
+4410 PRINT#1,2
+4420 DATA 150,91,208,178,95,44,68,21,207
+4430 LETU$="*98DFD!RL"+E$:POKE8,50455:LETR8$=STR$(Y):PRINT#10,ASC(Z9$)<>L
+4440 DATA 225,230,29,5,136,160,135,116,195
+4450 DATA 86,30,101,188,14,112,98,134,142,217,244,20,133,127,156,39,70
+4460 DATA 99,119,197,41,240,126
+4470 DATA 212,171,212,248,15,37,38,163,115,150
+4480 DATA 74,150,153,26,166,216,58,87,134,23,110,119,173,190,224
+4490 DATA 90,214,162,40,192,233,37,27
+4500 DATA 81,144,2,19,235,73,12
+4510 DATA 186,213,214,140,30,125,199,14,89,53,232,75
+4520 DATA 172,2,122,75,185,120,158
+4530 DATA 71,8,234,247,237,251,9,147,16
+4540 DATA 10,146,105,143,72,89,92,116,150,219,69,154,151,108
+4550 DATA 254,71,14,40,16,94,213,230,221
+4560 DATA 62,144,73,44,141,193,220
+4570 DATA 49,177,18,163,139,230,46,207,184,250,33,111,236,227,171,180,109
+4580 DATA 126,33,91,247,81,223,180
+4590 DATA 241,26,158,108,77,168,197,177
+4600 DATA 140,191,23,157,195,190,150,150,139,75,76
+4610 DATA 4,247,25,6,211,130
+4620 DATA 251,31,194,227,228,42,206,181,167,190,182,6,88,19
+4630 WAIT49922,51404>18.30:INPUTY:NEXT
+4640 DATA 218,116,91,229,173,248,74,115,6,177,218
+4650 DATA 20,99,39,49,15,36,238,27
+4660 DATA 186,233,134,41,223,96,211,9,16,160,134
+4670 DATA 179,142,188,113,57,176,191,162,241,34
+4680 DATA 6,233,46,246,31,243
+4690 DATA 37,244,142,137,211,1,90,17,255,237,213
+4700 DATA 103,57,68,201,208,168,172,209,221,144,128,4,241,217,113,126
+4710 DATA 110,254,131,226,225,117,230,231,174,80,19,109,236,134,117,152,97
+4720 REM *** --O PLIJZ=BDNKMFHF
+4730 DATA 108,239,211,176,159,48,239
+4740 DATA 92,199,150,250,36,19,180,113,167,202
+4750 PRINT"0WV2Q 4--IND4 M A0K-3.AD,7JAJ "
+4760 DATA 203,161,162,110,44,231,146,219,101,98,171,104,180,233,143
+4770 REM WIIWWGPJNG
+4780 DATA 175,103,91,98,113,108,183,5,66,166,236,122
+4790 DATA 202,34,185,37,241,120,152,211,103,165,15,191,220,226
+4800 DATA 183,146,42,203,232,27
+4810 PRINT"1VFK1LQJ??297?H TA,!QK ?KSD25KVZKB"
+4820 IFW THEN 3520:OPEN13,8,15
+4830 PRINT"P6BZFZWX7 L5WE6TTYOJR S,0 LZC!G6 RSZUCFV2U*Q*A5?7SCXJM4V2Y"
+4840 DATA 247,231,236,59,185,98,123,148
+4850 INPUT#3,F:NEXT:GOTO2390:SYS42.563
+4860 OPEN15,8,15
+4870 DATA 45,101,222,161,213,190,23,152,213,14,163,46,78,207
+4880 DATA 156,174,40,149,135,78,251,154,48,195,177,160,182,201
+4890 DATA 171,200,208,115,58,136,154,132,20,180,226,18,31,16
+4900 DATA 222,122,145,218,158,162,96,228,102,137,82,4,156
+4910 DATA 216,119,75,231,40,40,146,119,9
+4920 REM MB-VRRSCL IBS-*OX*R=O-FAJIOWIX*QYLSM
+4930 REM EVLZFVRDV ZFEP=U CGUH**=H W MXAEDRVB
+4940 DATA 137,126,212,106,44,104,163,203,131,69
+4950 DATA 148,226,142,143,167,213,240
+4960 DATA 18,95,59,93,76,66,55,152,17,53,253,220,164,184
+4970 DATA 153,154,2,164,51,35,156,69,125
+4980 DATA 3,43,0,71,45,46,86,103,146
+4990 DATA 70,135,54,95,138,183,103,89,197,173,190,88,114,34,220
+5000 DATA 8,10,103,182,82,25,23,36,138,249,32,233
+5010 DATA 246,9,51,136,1,26
+5020 DATA 77,122,142,79,244,83,215,55,75,80,51,0,207,28,111,151,206
+5030 DATA 213,247,177,77,221,56,244,128,52,228,101
+5040 REM RXCXUYUK-OO-GBOOM DVSKQKVYZMFCGMTQGUP=-D-WGUO
+5050 DATA 59,41,94,155,186,28,187,186
+5060 DATA 172,10,84,239,15,84,213,53,240,204,171,40,183,197
+5070 LET MK$=RIGHT$(" E4.Z",L):RETURN:PRINT#11,VAL(F$)
+5080 DATA 73,185,150,198,21,204,164,178,19,107,68,80,140,173
+5090 WAIT32.238,INT(A)
+5100 REM *** STWF*WSEQTB-N-FCAXCXI*NQW KX A XB=YTNHIR- FGTI-IZ
+5110 DATA 0,2,48,98,116,52,150,154,95
+5120 DIML(47):OPEN4,8,15:DIMY(40):PRINTSTR$(66.984);FRE(LEN("ES!QOE62,")<=52605) OR W<>V
+5130 DATA 14,46,240,162,109,231,242,135,190,186,136
+5140 DATA 83,192,230,88,148,12,79,113,49
+5150 DATA 118,138,45,112,213,249,40,133,128,43,62,183,177,34,99
+5160 DATA 6,178,225,121,175,5,238,240,242,86,215,95,175,217,231
+5170 DATA 213,44,207,190,70,227,172,228,52,162,242,131,209
+5180 REM *** UT*-OBIBOO MJ=CWGD-ZX R
+5190 DATA 99,109,73,56,241,22,41,40,31,51,246,237,54
+5200 DATA 240,153,37,205,247,9,187,153,33
+5210 DATA 179,109,48,16,190,189,56
+5220 DATA 81,88,38,3,7,13,146,20,85,236,27,95,2,181
+5230 DATA 167,31,232,120,233,93,197,84,115,116,229,30,182,60,51
+5240 DATA 55,66,205,157,21,230
+5250 DATA 3,142,45,144,183,104
+5260 DATA 61,50,148,187,126,225,61,50,149
+5270 REM IBIHRJ-=E-N*EGLM*UVXCBQIVY
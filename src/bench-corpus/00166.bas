@@ -0,0 +1,691 @@
+10 PRINT"ZSFXFE3!73H 0ITP,*YH*W7GA 3UQ 4 EDW-B0XC*.NX "
+20 PRINT",W ?*WYWXLI-M -V4X  BTDJ  M DQ 6SM  H7* JEWK99C"
+30 DATA 180,244,170,148,63,161,149,228,11
+40 DATA 49,225,34,194,55,29
+50 PRINT"K7SZ6X 7?5*? CD2 7JOZ93L8OQHQGYD  TJ1ZI56H. K Y40"
+60 PRINT"WR21G3N5BI0E6S3 Q?D8GK 5GEMNM5NSS*Z9ZYO V"
+70 ONA<=F GOTO 10,30:FORW=1 TO 4<L:RETURN
+80 DATA 0,115,103,128,78,132
+90 DATA 238,81,96,196,173,24,122,213,247,44,175,136,60,150,29,100
+100 REM BJRYK-LGZ=EVNUPBG=U
+110 PRINT" Z6A0GTR6I G,BKLIKV,0E9 -?K93 -I3OQ4IAWC95P1 FOVI*.UPU"
+120 PRINT"4W GTIYR6Q1?8YKF4-. EZL?MFAGZ6 ?3VC541GH"
+130 REM =RR*BMIWCRKT  R= TUOLZGMMA*FV=Z==NPFDMHSLHL
+140 PRINT"U11DRD6HI5C TBP05330I3K2441 1JJOS!DM G*N,2CCO"
+150 PRINT"4Z7 F1XBE*.KA, ?QVSFE PVO!6Z 1 L"
+160 REM NN D *UTBYFMEIWHHBJPFW RG P WE XC
+170 PRINT"3CC62SI*WG?0925  I 5N5. T08J IP7 7S22829HV BICH!S5!.*D.E"
+180 PRINT"?   PHA  1WPD,VR7 1!D9.J7?OF3JTS1105Z*AOC?*8XWF0  "
+190 PRINT"419YNRWAKQPF 0CU*T JZQ 9,8J!A0L0"
+200 PRINT"9J847U  5!0TNU 4.IF16VG1D9*WMA"
+210 PRINT",CQ6-  R 7S0- 2 M  IN  S !TB4-28!KN 0MP?9-Z-XH565"
+220 DATA 143,157,84,81,76,255,160,229
+230 PRINT"EMREZ06U B OYP1YKO 7U49W60?1*-Q3H! XMR"
+240 PRINT"SG*1EDH460NEFR SM.E4BQH,0T.?Q,N2D0ATX3R-ISPPH8LKEUP, "
+250 FORF=1 TO M<>B:CLR:RETURN:DIMW(3)
+260 PRINT" 40,XA-0D 5TE ,5G  H,SWN K!X 9!QA90P AIQK7OFO5"
+270 PRINT"  K,8PDOAT?J ! ITIQ4FXA,DD,S!- !QSR7"
+280 PRINT"* 24PFQ BP6U237MAI-B.DQO-  42!A3 71-75RXTY.- H-F,TGJC!QBG6  E"
+290 PRINT"  WT4Q?!6 XEYNK6DIN XK5CZ9 W?,,KLYCF6-HHFO CEF5W"
+300 PRINT"CV G 115 8Y1JQZXGQ.Z9SPS6WB4MYMDTEQQA F XCOQM-N 7Z"
+310 PRINT"*1U4LP STU-9U  28FVVFEQIM9K,, 93S, GYMM L1AU. QN9 U0IM"
+320 GOTO90:CLR:INPUT#7,X:GOSUB310:POKE80.828,53113:LETNC=LEN("69NO 7 ")
+330 PRINT"LOO K3WCR-,?VH-R45 OL0MXC 02VR 8V2Q.ABACLK7ID, L!?NR7D"
+340 REM RRRMFIPVMDOXSGZXVZBEVVNOYCDCVU-AO FXIRHSFGP-XB-EF-TK-AU
+350 PRINT"3*  9Y U 6J10N7 !6HYI4S3ZK,K!2V2"
+360 PRINT"! Z5G H7J JVJY-*QVPC H42 -91I AJ76XM1D2R"
+370 PRINT"WU9G VNOU3VC!V7?T*.! GRQ5UWLF.HV7DFBO8,2D,4M*"
+380 WAIT1,VAL("LEW6"):PRINTLEFT$(".",3);200:WAIT207,EX
+390 PRINT"G,6GG ,GQLKTFA8GK ,EJY5TNCNF E"
+400 PRINT"N K BSAT8?0!I U7 YA6X81TJMOAUALRFPVSS359F6QA6R5S?I! P794"
+410 PRINT"WQTFI ?W,*?OX C X*TWID S-.!E76- E IT0N-3 "
+420 PRINT"H1E5KBH ZYACPP9ERI9DG 4G  *1XJS SDQVHWU.1JSH?"
+430 PRINT"UHDB 2L,IO3Y02?4N, ,  ?OFDI0U*Z*  3X.S-ZGW0YRS0M"
+440 PRINT"TA3E,8!4KK345--DRU15YF-E4.*0*? "
+450 IFASC("HHP")<ASC("S0.SL") OR 9 THEN 240:INPUTHD
+460 LETT=V:GET#2,A$:NEXT:READ N:GET#14,L$
+470 PRINT"MEF. Q- R4EVP 6 7UA3NON6 W,QXEH9G !G?V3LA9"
+480 PRINT".7 ! RODKWX333Q 7V01R9ZTRSU *W -.C7OK-A25PN5-D M0MBMC"
+490 INPUT I$:DIMR2(6):OPEN10,8,15
+500 DATA 192,96,241,164,206,179,148,64,185,183,204
+510 CLOSE8:GOTO420:CLOSE14:IF229 OR PEEK(D6) THEN 500
+520 PRINT"UKQCD.OGV. 5IKW1 *J0 8!*YGJXO4I1! JUXY76!J8V?FNT1E79"
+530 GOTO50
+540 PRINT"C 1?H V8W W? 7HYOFPIBQLW8 ,98X 30YZF38KYKZSCJ4F *5GXNE9"
+550 PRINT"IPZJVMG3 EMSY4WGC6J*,Z 5E0 R0PAF T  Z32X "
+560 PRINT" A*FTUJHT 5UNL?BI  0FS8LBSJ9BXC RL3ZWZ1JQ"
+570 PRINT"6?6M?LFOR43WCM83GZT.G?KKBI1F-3SCZBQE-3QKKV7HY .V7C02QQ2AV,"
+580 INPUT#12,Z
+590 PRINT"FKG.CIDCDFP5 VL!IE9PLO L-P8977,UE65QJI 9RCWSRHE?C* "
+600 PRINT"YM.VP4V!4-T8JT3  QUG*U-!XA7,GE?TJZA,-L3NRF99 2D40D"
+610 DATA 31,118,127,183,5,153,244,1
+620 DATA 129,255,225,79,235,173,40,13,119
+630 DATA 59,162,251,30,71,0,172,90,126
+640 PRINT"P.VIG1 DB S P. 6QLS .8 UBHP,PIKKYE,*CY6 S R,3VL65 OI*BI?PL2T"
+650 PRINT"1BTLH4ZKQZU.4 95H,CY3!, BCL YD BK"
+660 DATA 166,192,42,200,192,242,179,232,234,7,158,11,179,39
+670 PRINT"YZB91CQ7Q?2JH1-* J*?!J?-4DCO8Q8NAELWA  *  D*D9X"
+680 PRINT"??D*OWQVW89J-H9S 8Z0FHBENBBU6 QM0?NO F9!,F2AYIS!LACA Q?0AT6H"
+690 PRINT"Q7KIHUJA4 I1?.5S-NE6D E D6,GF*EHR09V3V8CB*TVNIXOG11OL7, ,6GN?*"
+700 PRINT"THB,?7.DJSLNWI!37HJF ,6 6SEPYCS5"
+710 PRINT"MAWGWEGO? WB2NS*7NGMG! A 2 H?B!W6 PJVMO,V,CF82 H? L"
+720 DATA 223,16,105,205,185,21,26,221
+730 PRINT"S IG -6J8M DSRL.SB7*JLFW9PI5 KKPY79W98 0L8SK X1 *R8 "
+740 PRINT"3NGBJ?7P39Z.D 2 X7BY65 J AH 5 R?PT7IN E6BST-V.SAI"
+750 REM *** T -G IXTLYFGHTKTCJQ*CJQQR*TZ
+760 PRINT" 97L6W0XFO2CS *!65 UNSM9O2A*LG 73MU3BR4P80"
+770 PRINT"MV W  AO 3AXI40B6ER3P A- E.VFQ0,HQIST.PM.T1VX8 V4 RL7 FCCESJT"
+780 FORXZ=1 TO 54.627
+790 DATA 37,210,124,78,201,34,133,175,56,162,212,245
+800 PRINT"G1445 0KT65AO!S2O6 G135O.AMRH!?IWB S9 JR!G0EXI1"
+810 OPEN14,8,15
+820 DATA 192,58,101,158,211,252,99,101,13,15,133,39
+830 PRINT"CNR5Y19XL28TCMOZKY7UZWGNG 7*EJ7-3 RGP5  M2SBA C 922IMKHQCGO0R7"
+840 PRINT"!H 9!?.!HBD1U?27QMFGT 5 0V!52N6.X,.YC-T8"
+850 PRINT" GO! FZ?QX WVHD ,MUN84X*  HC*PDC,T6N"
+860 PRINT" , 2QFJXFA9-47IO9DZ9X8NL?URCM GJ"
+870 PRINT"ZLL3UDAL!CPSPHIFWK.IWP2P5Y SQK*0.H"
+880 PRINT"7XFE!HP 1G?CJ?0C ZFBRS6SF8LU*1.8!B-8 10K3WU8EXJJ0IM  G 9VKC0! "
+890 NEXT:GOTO440
+900 PRINT"*K,8W5 K, 8RJRV  38LJ9-EA COL8A0"
+910 PRINT"FNMECC.8WS7HB53?Q,IEB.7- HF6O?J9VOLH8H.T 9M  J-  TWI"
+920 PRINT"QOJQQA? ,GLQ,2FXTZ  N!-?AK-P NLBFZ.O"
+930 PRINT",E-QH  9KX, W5,.VQPX8T1?EGAQ!  K MB9"
+940 PRINT"I7X7RNUYPH EPNAOJ225U.*3PK,OSH S8!I1SHE3O.LHBBMZIQC18.GL "
+950 PRINT"KKA U8GNRDNNG I8A!-3  1*3P0PLNPBQH J9Q"
+960 PRINT"3GEQ5K508*?IK50 01B?X ,V*.J  8H8 BY"
+970 PRINT"3.A-LWWZX-8KRPX-1BZ1?M6B?S2M 6,Z B9L5"
+980 PRINT"Z ? 5LRWW62!FIR! ,  B-KRP  AS29EGB.IUN?Z4Y3OV P,XDS3XEP"
+990 GOSUB820:RETURN:GETS$
+1000 PRINT"N?0C TM.9!33V DO*-S3ASDKS?-DQXA S0 B?"
+1010 DATA 69,252,59,39,16,101,91,169,64,110,143,219,221,176
+1020 PRINT"XCMB3!!GCL0SG08,FML8MCQ9DZB?IL N J6ZOQ9CADKTH 2RIZ9V E"
+1030 FORS=1 TO 5.130*V8:LETT=248<>L7
+1040 REM *** MKOHQNPIELQJJTQW
+1050 PRINT",HYWLH2  0DWF8YSVJB!T7FZJHXBCT.ZF?LNCD"
+1060 PRINT"S?4J1Q0,U *!ZKK5*2SP C OLZS*0VC-H!C7FSISHNLX"
+1070 PRINT"R V * CN    8?CRFWF0 8X GKD 8VNVR H0 P  KVHH78 Y7F0C*2R0FUA"
+1080 PRINT"1TL*7C 214PRXA4AIAYHN!OS0VJRX .XZ33E9C-29FS  !ZLFZRU"
+1090 PRINT"4OF,U! OV7T VWN!JI3T!8X0J Y77QU 6FRV MIK Z"
+1100 RETURN:OPEN5,8,15
+1110 PRINT"6BH1B 9L T-1E1M*F VEKY.-0TN3 Y0-NCU T6MOH JA2Q-TC0U15B3H"
+1120 REM OBMZJIF ZUK-IEUQEGNTHVXWKYGMHQVVDCNENTBVWQ 
+1130 REM P E-EYHJEKSBOSVCOKVD
+1140 PRINT"YHXA8R,PM  EYU,ERA7O!9!Y-R .Y WJ7C*HT2"
+1150 REM FZBCHA*FGPFR=IM E ZSPJNLDRRLEB
+1160 PRINT"RXHG.N0XRIMOQ W ,.NZT 8CS3X5PW3P47LD BFDO-6 T"
+1170 PRINT"YD3!!N7BK G .QXFW*!.A 0.?P  H*"
+1180 PRINT"W8 H TBNAC,10B 6QBASA4X*!9-RT 1 WM!EAG.4QCI!YX 3ULW?,"
+1190 LET J=53199=75.38:GOSUB560:ONLEN(D$) GOSUB 510,680
+1200 PRINT"C  C7*X 99 S! IZIQ 9RCIM UE000?S4DMJ!X2LTASJ,7PICHQ3 B5"
+1210 PRINT"MVMWXEDY5CWBDP  T! UV3Q56 8?N92L2 5"
+1220 PRINT"?9X6F. ? ";50009 OR T1>C
+1230 PRINT"ELPQ342LV5Y0BQJKZT SXD??BP   *QP ZMCGIZ6QITIIN30!ONG!A"
+1240 PRINT"IZU2  Y X.8D 85Y5Y .T4..ZN6.JI?9B,MOOGDE8,0X ?UTHVG7  P1YFLDZ"
+1250 DATA 33,43,27,112,34,247,96,1,235
+1260 PRINT"3XV FV2D JBF27.HTY77 2.,,2!KQE VNI P9*BW VI1SOJ?ZW*5S7E63VV-"
+1270 PRINT"Q8B8Q2DMQ..DR*R58NH0T  RGP ,7-N0 QDD LVG6UP9HT?W43"
+1280 PRINT"!T 9M3* O*PF3Y PEWBR6S1IAR3ZC19B*KL017 0 R"
+1290 REM *** BDJHX=QCM Z-KGGSCFDGW TYJRASS  MBAO-OIKMOO
+1300 PRINT"  EVN9O JGS502N5W08JO6  Y0 WELX4AS2*N3 K,,299  URGE"
+1310 PRINT"4HH82E* RUAXC ??QXG5 ,D8P 0O783Q62IZQBEQ7-L2"
+1320 GOSUB440
+1330 PRINT"V8LT ZS5XH*!WPSGL3B E1OBSS C2W*.JDJ VYUIV,V"
+1340 PRINT"W  R1 1! *9OKN9K1YGST5MOE55M!,A,094"
+1350 PRINT", MA7,Q,7-RR!O7PAT3QA?5,3O076L-INL- 1YT15BQ 2WX J,"
+1360 PRINT"VST2NEI 7 GN?  CX *8KII-GDRVJJZ,! !AI.URJ SG07GN"
+1370 PRINT"*BPWHPQLH 9.R!FKTT!J5TG  RUW*286Q3,PFVQQF7EL 8PT9TH!E 47L5 Z 3"
+1380 PRINT"DB BI2BU1K1U*4  3,NBB ZB 7 UEVQB9AU986MAT9US8C 3N51"
+1390 PRINT"V4!.-9ONY9 UI .G!Y4GKXEOO23?ZPPX LQVCVV S7Y 9U5YVZ"
+1400 PRINT"-HO OA9XGVT*X?KR-B8TS4-*RB!3JQ6 62KRLKPV951"
+1410 PRINT" 66J4-LSZF5D1GI4C?B*ITEPUVR!EAH18J3C, 3?LC2.?D2Q!8EC-?IIVD"
+1420 PRINT" M-DAFDLSHLZE6M 7HKJVO.!KT CF LJCJ7RQ35XL"
+1430 PRINT"GT Z SDG? M4!,86QQS*AR DQ,!7G9TNXIS,GUM..6S-TB,*IVX5K"
+1440 PRINT"M35YOH7HJI.SU,FKQVQ*BOFCC Z* EB KYZT"
+1450 INPUT F:READ ZK$:ON170-R0 GOSUB 420,580
+1460 PRINT"31.,CO6*, LF*T MP-Q?V38F-70 ZT8 T 8B30I! 6 TKL 9 "
+1470 PRINT" H 8DCJLYJJ8LP2?2PGT! GY.!335 S79GY 6   "
+1480 PRINT"XRD3Z*CQWPIGEZL0Q9YH3FW I,2ID,BWIAV,1K3?0787GN7T"
+1490 DIMGB(45):INPUT#5,Z:SYS130
+1500 GET#4,W$:INPUT P5:CLOSE4
+1510 PRINT"!R 1GMYDHH M7QT9BTCP62H X5I2 B!O3MJ I1ENP ETOAS  8 "
+1520 PRINT"P7075H4 LG?H HUTABDS?6F!ZTCU 7 ZBF5 O 2HDEIE 0.4 H.9"
+1530 PRINT"WB6 .T Q9RNM1OP8D1M1U6 -4 .9D XBS"
+1540 PRINT"P* OYUH9XWW*R4S2O!! K*4JDGU6N*-8HZ5NA0KN"
+1550 PRINT" M4V *I.C9?PZZVKU34RW6Y8YIY R? G33J"
+1560 PRINT"J4,G0AF5GO19A2H6BMAUAS* HO7B!HQAG6  I6PXE2FP4H"
+1570 PRINT"55, HDLS 26OLLIDTO K-! Q B 12U0 YHEKJKD*U0R8E4 *O"
+1580 PRINT"F5SHJ C4I9R-Y.  3HOY56UJK ! 157F.4W?1W EF1ZU?Q2GUB?MPA"
+1590 PRINT"Z9EFT  I06I,O381?2Y.B8EZCOJN UFZB !UFZY3V7I! . EW1ZN R"
+1600 PRINT"XZQSL,9S*56*EUJ.,I 8QM* R!V6O68MJ30MO1H*VDHCOYBN4"
+1610 PRINT"W-DSB  0P.M0E -LBH!PJ6BD6X8R!.A "
+1620 REM *** EJFBA Z-CI QDT LJW
+1630 PRINT"G8Z U,H2RV. OU9  MQ9FVR  EV7UT"
+1640 PRINT"6WJEF1S6 TIOKSD-KGP -CJDAR4FK5 LW8.MED"
+1650 REM A=F-CSLHRZKYN=FNZO-LEHQKKXMCAVD=*GF
+1660 PRINT"ND2D!TIG* !BM?!2!G9GL3K 94BLZ8WIFOZ5TD7NSFE   "
+1670 PRINT"21 ?! S-LAT,LMSF.8C-LIA4M-4!I8L6YPC *EYZTH 4V2 O"
+1680 PRINT"JE ,HFREUGKF?4M --0*7QAVEJ,6 K YCT?FK"
+1690 PRINT"N HY8OLZNR*E7HTJ!91 T, 1  2QFCXTAWOQESKO P1FKYV8IGE.LMBH"
+1700 PRINT"S50 5I 0 8-A3Y IUT78Y 59SS  *RHLPKA.DENX 9U M -"
+1710 PRINT"!RHK8L BQ!,4R4..YD4.LVT.?GY-**65*S*E.1I HQUH31A EHDZ 10 "
+1720 REM *** -SGAKHE=RIG HDNSD
+1730 ONR<A GOSUB 1130,460:PRINT"XCK";G/ASC("CX 9B,8B")<H5
+1740 PRINT" 5ESLHKNB,5TIEHVK6?!ECF0.AWP* - -CYTCNS"
+1750 PRINT" 7 V.ZKACS8BF7 O24   8XLKHUC7D6B4,0GEQJ?WSP1UDS!T"
+1760 REM *** CCCW=W- BIE TVAKSQEO=XWUCGDG XFRRT DZUSDUBVD*FDT
+1770 REM ***  TTL-LKVDONMKAXN WU*UE-VLGZXH-Q=DY
+1780 PRINT"M MR4GI?QV,V6H IXC7O27S VC TDR3!T2 EJ"
+1790 PRINT"D M6O 2562!AA0  0-*9RB8BZ? ?1 W LOC7A"
+1800 DATA 205,57,42,120,86,182,92,93,126,114,59,42,105
+1810 PRINT"8GA7KS4--HSOF5H I089LIT0GV A?IRF6JD9L"
+1820 DATA 131,194,1,125,116,222,120,75,102,62,129,99
+1830 PRINT"DJRK4Q A Q6 H-HE654BI*ITCQ,?!. BMH"
+1840 PRINT"F 04E0 Q!US 8UARUDAYJN5LCQSEF1JX 91SHUBC  PVV!"
+1850 PRINT"YF2N! 6J9! KTDLN0I,IEE F!7. YTHO1  *"
+1860 PRINT"IVXA Z 756KT MNF81 CXO99H N19W1 9K OO1"
+1870 FORX=1 TO 49522*49239
+1880 PRINT"RPG  O !S6B6 7 !25F8N6,5RYBLXKM*W0L6"
+1890 DATA 39,242,250,99,18,206,73,149
+1900 PRINT"E 6 *JZX43U.4   WY?L86H?9DA,7 5EL13!. *H2U? K9SU.YXY7X.N? W2"
+1910 PRINT"LP-O?QNS0 B9J4I4? BHNCOGK YBL9RJH"
+1920 REM *** WAHTS CJZQAJUULNFTIJ 
+1930 PRINT"H1*F?2CIMAX3BOYYX?  2ZDPM1B*AKSIDAUD4Q 6NQA?- *B 5IQDO"
+1940 PRINT"?RAF,  !SHQLP  KJIKIMT 51CX V.YU* KQDZW M7T*  SY*I0.9TJF2"
+1950 PRINT"!3Z1WJLF7L9.EUHIXFE4CZ1,SC.7S,305R"
+1960 PRINT"G X 3EUK0TBN KE.0-Q3-,LLL8Q4K3.JDL0QXDI-,BLJ*W2  "
+1970 PRINT"OXMRRK9W88B1 XF7X!T   XXLI749 G GPDE?5 ,RE DGX*.17V "
+1980 REM *** KOAZ EIJCPZJBMX*Q*FPET=UMTVCFRJZMYJKKAT-MBG-S-XFRBYK TBBS
+1990 PRINT"7 .9QAFDE2.UL JI G X0. SYKY??BY  AB5ZFTW9U LTZ0MRQ08"
+2000 PRINT"K0UT0LMHMSYFAM-KHR0AG8YWTK!F39"
+2010 PRINT"COP.J.3LUAJOYDKAL42D*3Q8SDHMM? QY IXWJ E D"
+2020 PRINT"EYFY6WD2CEH43C,RW XFDOJVXRM6M9G9!,4RDYV9Z*QRYZ-Z1 ,R"
+2030 PRINT" GUA TB8YPL? E2OZVYPB!T69FDGKHI--Y9DY25 NH3E0W 2K9A!TCJ"
+2040 PRINT"*4 TE1.4Q1L  L  MI,R 8HEFJDYJE- H II1 Z2WSXP5 PUL5 *1-KHIM8V"
+2050 PRINT"2I CH?6SAP0RE XN7LLS-NE,NZ2G5A3M7D"
+2060 PRINT"6C0,OZIDD  U2KT E.A14IELFA1,14QLKSV-GFV"
+2070 PRINT" *-*9S-4L MDPJ1UPAI DP1W  Y3PO8YN-8NW3HDY B8M1 B?DL* "
+2080 PRINT"P3!, ,T,H?5W CX? P5WGZKEN.QE4YC! ZX69K9,XGTSEA09L3X"
+2090 PRINT".5PJ77Q 1  KMMKX3C,0ZMEDYUW82M,J4Q MCN,L"
+2100 GOSUB660
+2110 PRINT"LFFDSA5 U.110CU3JHFGN 5WHV8.O9I"
+2120 PRINT"G8R,YQ*,VE68R-S469N3T8DIZKET9QY4"
+2130 OPEN14,8,15:READ MP$
+2140 DATA 220,14,23,75,217,16,41,233,117,241,248,96,29,61,49
+2150 REM ZHY XIKQGXJV*FZFBIQ-A=YMGBABT*Q=ZC
+2160 PRINT",MU.  F4F?EZRVXNDL2 H T SIBI,*KS 0Y E6E, RMG8? 1BSN"
+2170 REM P WFSG=IKT -VIG EZ=AGU -*JA*EROFI*ZBKRTFSFHSQQ
+2180 DATA 251,207,234,115,202,74,155,132,84,93,44,242,210,153,86,255,49
+2190 PRINT"ZXLS LA7  H MU  O0SSY?JTI53NIMON41B71H08XQWAJ4EFMDVK,9ZG4 W8"
+2200 PRINT"1SD.M HPN304.5 UD.2G651E1GB. .?5Y,CCH-5 BATYR K2*HI?4EBPWF8?I "
+2210 PRINT" .WB4HJ8DC*RG?F.L-IDBZN2.6!JZR 0WD,101HY9L0O  "
+2220 PRINT"3M2?5, VH  KC7.O4, S?H  8QFSG3 2G*UUO0LLET QT 8!G*3HT 8OJ"
+2230 REM E-D Y*TFQB- Y-JG-XLZKVBLGLXPT F PUFI SOQC *PIHZ
+2240 PRINT"NH85WJKR? 5KE8TWT?UYKYZ ?I-H9?I "
+2250 PRINT" ZSLYM5M3Q?. 3D!4GAP58-58YMNQ.1J?8FBRHG,5!OHBKLQH0WF!D Y K"
+2260 PRINT"!JCO7N5VL5R5K VYX  S CIGJ7B,ULD3OTJ-HWK"
+2270 DATA 58,124,56,104,144,78,35,59,235,132,18,149,246
+2280 PRINT"YA I-?VH?X9S TZ0AML  4,UW?89Q84.TA PME4OP7G9D GND*5GXFQ-"
+2290 REM *** HEOKU YEZ=U
+2300 PRINT"O-  H!3YH9UURCI- TXEFP9JBNKAWI4M9  4SZ5CV TGE5LUCA9FHO2"
+2310 PRINT"5Y1KAJGOF.SE2ARG1W2 GHF3 VBY?XYU1WN5BXP!G1"
+2320 NEXT
+2330 PRINT"*J  2 ! QDS*16T .P?0X QIMCXZMYN? KEHG4T,JLKQU-IG5ZO*"
+2340 PRINT"3 .1HFF! UU? 4V*EHXY DU-E QHH2T?ZFAN89LMEKKZKM,Z53W DKC,S9L M"
+2350 PRINT"T263U,S.8BK39 8Y0RPCN0H8VA9O0GUMVF-42*4.,9RL  W7POW33MNRDS5"
+2360 PRINT"I TARHSWHY NL 7U27 24-A5H9  QEKA"
+2370 PRINT"0QKH L.R*W8G. -1G-0CAN  .??  TT9O1D TO,L37 .FGYWNE2J*?A,Q"
+2380 PRINT"D.R4RK,L90DX9K65-W53E B0SIO 4C57PFEA-6 ?.5 M533-X E0WGRA "
+2390 DATA 164,51,110,123,144,250,95,149,139,228,223,91,232,207
+2400 PRINT",Y WA5Y!AT78*-JN8 UE10*C QR? 2M*JZIE8*5P**T3-40JR5"
+2410 PRINT"18WO JTK1YGKL*TOF Q  4V2-U,SBTUL  C6"
+2420 PRINT"CPO5 JS H0 G IUI XHZ90Q5TS, J 98,*PVYC 4LP6X*7D,8 TZI R44GNE88"
+2430 PRINT"UZ4QO K *FP4!PMS?? BTLY5 QHT 6QGETQ 6.G5 M Q0TV1?TGF3"
+2440 PRINT"WKZJ00-AF17 E8O2  7BL 4I*-X2 8QW "
+2450 PRINT"3!BSG86 UIQO996 TYG5Y!TDG  E26BZ?"
+2460 GOSUB1630:INPUTP:POKE49492,UO>A
+2470 PRINT"78A K67  4 3CT7,3  45N9I1W12WMJRRZ4EZY KIYAKQFCT4! ?0WL749E-"
+2480 PRINT"!M 26R2HM I3U1!FMM7N?5JS5QBAKUSN3I9E !0 NQS4KT"
+2490 PRINT"7ZCEO?P,-LZW.YK*BT4M JVGJ 58,6PB!NI."
+2500 DATA 210,12,239,38,31,238,98,44,45,8,216
+2510 PRINT"JZ90ZF6W*E2T  !?W*BUD 4PJC3CXA  ACI4G   O!WN..DYNEGE5"
+2520 PRINT"AV32D 0FFCJ  GV.ROMU26!XT3* YWAHN TZQ2O72*W AS7V - G EF"
+2530 PRINT"6Q YGD0, DRIUTY79-?V0Z7 C 4L*A*-KC.KBH"
+2540 PRINT"YSCGY DET3 DUJ?2H5,C NZ5KPW 3 8A89 7PR8PN3ZL. R"
+2550 PRINT"2XS  MJ4V*F,FV*CFGE4 D852 .-2BBVU,,O*??9"
+2560 PRINT"C6.M,JS S 7V4I,4,.YLUXMC 1TBGSP2-6,VZBHP.QN*IU"
+2570 PRINT"THUL?50R879R* F?-.!QJ, F4VKDE*B6XA706?T"
+2580 PRINT"4 Y";88.830:DIMI9(38)
+2590 PRINT"97RR8,C E  M1 N*6X2*XEGGX8JSPW9GA2DF AQTS"
+2600 WAIT140,FRE(CR):IFK THEN 1430
+2610 PRINT"N,WIOG 69X5L 5PMK-R* !OLOFQ6*-LI.O0OGP 1N .XM"
+2620 PRINT"FWHGK FUR44BX M0L!9*IYZ-DG.MZTZZIFEP!5WN 7E*?OF "
+2630 PRINT"!ZQUHFIV!JJS4YC1PW7S* 4Z5HH ZZDCCWRND!FY!"
+2640 DATA 92,248,172,224,119,248,38
+2650 PRINT"G 9 MM1L,TA3MRNUBCC,N9JTE HWOF97  19 2ZHI2 R2ZJF1QG"
+2660 IF0+FRE(10.348) THEN 1920:CLR
+2670 PRINT"WR7RN1SUEIUAU0M  RPGV4DID-A7693 ,DR9 L5AEV ?PM07AY ?- *,-"
+2680 REM *** =G*JZKAXYRP=M=COBURSBH  XVELVXWHTKOQ
+2690 PRINT"L5-5H8LEUY,A*XYP,GQYNEAP  GFX33H2J08 MS0"
+2700 PRINT"?5CP!JA95 7EW V HQKX,E3J P.I?F830S ?HEGZT6 MF1"
+2710 DATA 86,240,125,233,163,244,34,11
+2720 PRINT"NA3K 8 .3-NV,QD,MTG,2WLG-7OWZU"
+2730 PRINT"U2AKWMW?Q!L!PWTOC?.C2SV6*R!PDG?5QUW"
+2740 PRINT"791ZF6KI6SG*!UFGWZD6-..E 6 1M9W.T786. 9C?KXKMY?H48EKRNOL2"
+2750 LETUX=53029:FORR4=1 TO SQR(E8) STEP 2
+2760 PRINT"N54P0*LF E0 8XM0?CEQX5K?QX0T H R XJ"
+2770 PRINT"I4*H38KTDZ16BG97O7ODDM6030XG67CIZ4"
+2780 PRINT"06!MGQOH-JB3?,6FEK.L?F*. 5IJ5DJ1G9G0JJ7T 81K0WA. V8"
+2790 DATA 22,21,187,94,221,243,184,69,10
+2800 READT:POKE26.671,ASC(T1$)>=S2:OPEN5,8,15
+2810 PRINT"Y?Z0QP B9BLFCZRAKQ V-A-PBF!88I,N-N"
+2820 REM *** LIBKFUYTBAI
+2830 PRINT"M *MKW31IM2YFF4!ZGKT2 9-5 6D RA!U4YDR1FS1B9Y!J2 FLH.IXTE9JP39"
+2840 DATA 251,199,92,170,79,87,6,123,251,109,203,82,97,50
+2850 PRINT"38S7V1W,P9NY- T Y5.5WM RCV5.*O?IJX!P -.CSONMU.ZOOU"
+2860 PRINT"PY 8F7?!J3DW!3760AZ AILMP*U ZXC.E ZRT S4 0E?UGRI"
+2870 CLOSE5:LETK$=I2$+"WZF":CLR:GETB$
+2880 PRINT"D3JZCXB-DVBVR8MB40QVDECAR*IKP9P,WI9KGYE*EK-8I8LPO1RU?7OP"
+2890 PRINT"9KB.D0 KOT6KD,299X9 RIIKE,A6E*!0J5., AM0 YIL*BMW5O H*L01ZP9G"
+2900 PRINT"?GT JY8 2Z9B1D51!V2K6S,O!K6U8UUSUK VFJNDR ZX,0GQ"
+2910 PRINT"ZK21DA26,* ,3-LQRJHWIV,ECXSM TVZET 84 TE5JM174.B2Z3I53AR0!SZ"
+2920 PRINT"PMFHFZ,R 0 FPKD* Z8*2GBGCSF4WPZ1D,2C0 CSEP36DSH"
+2930 PRINT"WE. TMK4PUVM7M 6!WNY?SWT UEAXHW   CF79"
+2940 PRINT"  -NY5P6G,.DBVM SE,L-N*XS0CYMCK"
+2950 PRINT"PNI,TX90?F FI7 9-T KC3R-WK8 JFHS4L7MK1!98ZO KT!"
+2960 PRINT"!LU2GWTTW*O83L ,3A,U* WXU?7KCS8 SGYC   97 R-K6H?UW,FD"
+2970 PRINT"QQE!K N OZY6GNV   MUF*-5IZYZV  V F6AGY6TWCC0!N6Z8M2DN!5Z"
+2980 PRINT"RD.B  JI 325JN09,!K2I8?PGD4 P WE98,DY6, SSK.K6 LB"
+2990 PRINT"RK7OIL9SD-KKNZFCC-9OQ2!2YB.W-1U?4Q5"
+3000 PRINT"KVLM4KI S 5 6D,5K0 XYQV4THFFELUD"
+3010 REM *** A-GQZKKHHUAJ
+3020 DATA 208,212,95,78,239,29,190,54
+3030 PRINT"4C3HT  KJ OED,CMV4H .W6F. 7.?6G- YZ"
+3040 REM AFQVLN-IIUMOXKRHCV AMRVXXOVPFGLABWR JSG=RNKPHOFGP-L
+3050 GOTO2990:CLOSE2
+3060 PRINT"4WCI!Y*CD3ER590 TF4OK0? W83?96343UCP "
+3070 DATA 98,70,243,59,25,73,205,248,80,107,51
+3080 PRINT"2I*0-BMTF9DU582YND7S.U L  NNCT.L3O*M*AZC, W*JPR0LCZA*"
+3090 PRINT"O9 YWTLQ,,0UB5KLMA?NAR4U QQ57CSH0Q?WOS,.5,EEAS4R6E FW49Z?20PN"
+3100 PRINT"1OEG SB HS, J I0XEHSK5GT.2VR- DYUPL6H?S?M09W"
+3110 PRINT"J*EO65J!YR-5?R!F  W?N*L, BPJJF1I 7VQH-6VJ EWE1Z1- XGI7P6!O"
+3120 PRINT"CL!S6A.9TBMJZCCYR92P7*XCDGFZ,U2J2A7 SW?C N7KS 4H  .AZL1DR "
+3130 PRINT"56PFF64F7RP G8HZZ65K I0XF*  DQIVK2F?B95KI66F"
+3140 PRINT".D,E7D1 PF9G?JEVF0EGENJ Y1,F1 AXZN6N  I4A  8L"
+3150 GET#5,M$:PRINT"GPR*0";F:GETF$:INPUT#3,L
+3160 PRINT"Y MFT*GYS,5CQJR79S0 MX 9F  ,C, "
+3170 PRINT"PBX-8XI. 4-?0ULLMW V4U1DYAVN DIV15P C5Y*C3ZBEKI2*"
+3180 DATA 212,17,7,19,145,198,95,49,73,104,85
+3190 PRINT",02N9OULO  8. W,5,N-!!M3XL7ZYLMT3V5 YLZ1XFJQ0  ,-3F"
+3200 PRINT"N 9FFK DSHK*V0M-131V M6EJ9Z!VKVI3F82V8XJH XZTQ4W63A."
+3210 PRINT"VQ3  OBDW.BDQ 7*3HILPBWF S4U*C RR 4X?G3- 1U! GHAHM"
+3220 REM OMICW -D*OD=N*PIXONJ=L NN=RYVS*B=PS==NBH NFCOG=LB =HZUK
+3230 PRINT"GHO!?H375  YN ,B9*1!GXC,NQK*YS9HX! CQ2IR0"
+3240 PRINT"J BOO2  D?EW487J9?1I CS! S.5PPZ 3N5N0QUT1   6!XT?6CR N1F -"
+3250 PRINT"LM,D8DSN4,.6HBXSA-GQSFLK1RG9DV1D.F REHP3.Z8D27AL R-H86 I"
+3260 PRINT"VGCWM0K! VCIC*1.LWUO Y0EG3D Y? EUG3"
+3270 PRINT"UTW4,!U6 RLE143YO5UON6EPXJ5KQ1-! Y,"
+3280 WAIT49720,W>=XR
+3290 PRINT"FQW5,B5 .M?LL!K*X,?ZP4YI -FCF  C6T1!KYEAJ3M"
+3300 PRINT"ML M7ZU6M!55P318N*JV3KZNA7FY1T!CAG? Q,I CT0 A KB!VL"
+3310 PRINT"K3-APEKV! WJGQQM-6  ,IT8Q9E1F.D9TJS9!X FKK3KG0,1MAG0 R! 29T"
+3320 REM BEQUKP  KTBPNJRBGFKZEA KULLBKBIMZHZGPXVNKQ
+3330 DATA 63,14,113,220,47,197,132,176
+3340 PRINT" W ,KD2 ,7R.0O6X S,V. ?H59 DMQ2Q7"
+3350 PRINT"*L.SLZZ1RI72N -- A8?7   Y!O5R?360OKRG  VKMHKS2"
+3360 PRINT"9N1IQTZ LDLH0H*ICX9H!.F78 CH2XNAV-6QB *AQX5X.9?. BD89F6 44C M"
+3370 REM *** UHXCD*FUDV KQZGK=DFL*I *H**ZZ SLBGF
+3380 REM *** OIC ZHQLH*IHZXRRMZVZ*BRU
+3390 PRINT" GW8ATHE4Y 3QJG 5 7IFG  A6B9K3X,L"
+3400 PRINT"2IC5J46 E4O19E4TB86Z2NQUD42QDHR!Z QH5BK"
+3410 PRINT" 1FMB7 4M!IT1UPJKKRFG37FB1MJP-HJ GVMIJBU 5"
+3420 PRINT"TDROEHZ1U*84NSO ,LU6B5*MH?9*.*WOWS4A N46JY36Z  S2Q ,CM"
+3430 PRINT"6 T6W4 TO1HY,*6C*CD 0,6*O*ZW EENOC XLHLTHVTT4K"
+3440 LETLS=50138=Q1:IFG OR 52689 THEN 3120:OPEN4,8,15
+3450 PRINT"4C5!?GCT0LINSI4 N17 W,5?*K- UM 44WRW68L7AL-*ONORZ!QGZ95"
+3460 PRINT"XZI EGS BL52 X4 6 8 ?FNZ06DNE*,N ,DO8-V 6GJ5 3ZJOEB 2     A"
+3470 PRINT"-PWHN* II4N-X..2 ZSD0TZ19FC1117 SU"
+3480 PRINT"?K!S?F1 SGTOQU,Q7WDFT8 W40!GG C,J3H915U7 G"
+3490 PRINT"JI 3. LDJRBTZRLOK DAA ?7XHCZ X3,9!*XXM0OVBPYD?-9D4JR8OKZ4-"
+3500 PRINT",I,Q2CYMOM2LETH!?L0C SZF*0 D.C4*A8MSS"
+3510 PRINT"P8!FMC. DNBB TJ  TW2. WH L9B7UNGGPDZ0QUVZKR  .B9OG-2EPS,1"
+3520 PRINT"HHHJR SVWK WY6BYO7QCGSVNG J ZDZ *KA94U-Y29Y  J"
+3530 PRINT"VOZPJC2N2 86*9?9 RM9N V 8IH2D9?5*W17L8HH0JJ6Q"
+3540 PRINT"XTUX1NN.  PT-PRBVUV09QQU3ULW4."
+3550 PRINT"7N 2*C4 6N!MU E1B,888AQDX*MZC6K?G62 JBF93IZL 6AVSU  N"
+3560 PRINT"3MNW1 ,GIQB*7SD KYXCK 5XF9 ,KSER"
+3570 PRINT"CTY?OLLSG?0E?MQ 8K36T7ZIPAM-E00HG1DGPQLRZ56H 86"
+3580 DATA 191,156,95,107,251,4,10,24,141,190,211,162,15,69,215
+3590 REM *** -VXU***TURIRVL
+3600 PRINT"EWEBMY! 5IHI7O VN0M N ?5.H5Y1!ZKYSLUYGQFY5Q1Y-"
+3610 PRINT"W WJS8XKB!CXAQ BHG9V1OHK?04U7JA-CDZ-?1I0PVL"
+3620 PRINT"Q -P .O1  Y3-!5!L3T8 K? Q9TL18EU 2FQ-W6?.V CYI 5L48TR .3 .R"
+3630 CLOSE12:OPEN7,8,15:GETT$:LET O=SIN(76):IFN THEN 1640
+3640 PRINT"V4 ,FJOKEZG9PSFA0OSP Y9IXNFM*?VOJR6Z5LY"
+3650 PRINT" CN!!QXIPQ 1,ZPYX0 K1YXSX9U XHJZ 9B*G,4SS1"
+3660 PRINT"*AZ?D1IQR5PWRSWHO!.M-F.K040AL, !!5O0"
+3670 PRINT"8BL9Z6U1QSFV2CSYGM6 CJN4-2*YK 9 .D  MI  ,B MPEV9D. *N.IA,QWZV"
+3680 PRINT#12,182
+3690 PRINT"M U?E1?ZK9GL BJ*-?R!JK 3U 6VM Q-!"
+3700 PRINT"LLJ2-6MW8U7*I0D7?4,UX*S UVPGXV"
+3710 REM *** CKXJMM IHYDA CJWPW-=GIYM= MSESAS=FXJKFR B-JGUAJU
+3720 PRINT"P ,A9YV1MDQTIRK0?X 37-  6QG8I96T Q03UY?N IVU  !7 ?V9IW.A"
+3730 PRINT"SB?F65GP?BZO35G CWSS QZ0K2LB.,L3*X!0 IKY"
+3740 PRINT"3!J0O ,3NI,BG1*Y04 48P.-E8 ZBA P 8OM VL 1Y!*1245ONY8"
+3750 PRINT"Z8H0M PG ST78 3 M2-G2ZWNDM EGJ6-"
+3760 DATA 250,229,131,75,151,121,186,190,23,165,130,75,84,92
+3770 IFX>INT(79.144) THEN 1460:INPUT#12,M:GOSUB3750:DIMJ(28)
+3780 PRINT"UVK ?1UZ87TEZ-6D5ISS3X2OJZSC N? - *X962GCQ"
+3790 PRINT"X4B MN!ZFJSBJ,. F2RNV5 KWYBF7F OK58?I!BSOJF84YLC2"
+3800 PRINT"YLXUFZ 6 SL.Z CK45ICSZDE3DX 0 P1"
+3810 DATA 168,23,203,26,194,83,213,218,241,65,50,118,41,252,120,40
+3820 PRINT"KBN!6 ,I7G. L 0!LS1I!G-T CL 1II5UH*V 85RQC 6*NFFA  .KUU97"
+3830 PRINT"4*GVE9 ZD0,!!XUX6AH2-U *MZF* 6NT8WG-6*-.!ANFHAL*8G*WWTZ"
+3840 PRINT"NCP9UGAPE. 4F,* ? 8WTJS5HLO1 6SP0CF543H"
+3850 PRINT"84SHGS*K5113-SO? B?MN L4Z.CN86AVD2FVXY0TM YFQKUY"
+3860 PRINT"7SZ, * ELKG IM!-125EY7 1 GRAJ4682"
+3870 PRINT"TMA.ZZ P DISH 3QTNU7 .B  XW3Y-RSC*.RXKQ"
+3880 PRINT"SJ6I   BMB 4YK992KT2F5VVCPF U ED*WJ.M 9SXAG98O-ZD ,TA?KSU"
+3890 PRINT"E3DKD  DIC,?4L .9P4EH0EIO?DHMZD*N 2 "
+3900 FORO=1 TO 50906
+3910 PRINT"V8M8DKD6TC76KC GT Z5 ?IV D*XQL8- 4NM!9IE   Q2DRB"
+3920 PRINT"0XL3 R K4CHVD? SDLCIU TR1GF1. HR E0.M1U X PGKWVQ OIJ *D,3."
+3930 FORP=1 TO 53000:LET C=SQR(LB)
+3940 PRINT"W4C4M13Q .HDGAI80C1 3C1F,A-ZS J9F1"
+3950 PRINT"ULQ03. DCASRC2O42N,,6 9W R GUILYBVE6RP !JWZY"
+3960 DIMY(18):DIMH(29):ON159/2 GOSUB 1790,3260:POKE7,POS(86.485)=H
+3970 PRINT"L*HJIEL*X0KYP.!FCPPXB.AZ0*EW8A!R  !T8!U337I2NV"
+3980 PRINT" MN66X O8 S F3OW,G*IP*64LMWAE!*IBNPV*X4J.?WEW87"
+3990 PRINT"T7MW-PYD!MS3U5CR?.4P .A UTE !C*JLM,P4E 67C,-X-U4 YV 4W9"
+4000 REM UQIVMVKHMERLOPQBDB C
+4010 DATA 154,181,20,240,192,5,246,200,91,114,197,165,79,248,248,224,168
+4020 INPUT#1,J:CLR
+4030 REM  VKBO*NYN-Q NUQPL VOXF G ECF
+4040 RETURN
+4050 PRINT"15TX5* 11ENZ49A4281ZEOP9*8B-96VI .7AA9WUFFYF-7 W*1TSZAUX"
+4060 PRINT"SP8DUR7L2EY.2 0H ?*V4006B6WQ7 G? 59CHUNE,0*4JH0H"
+4070 PRINT"Q8RV*W TU8L?*Y.A0I!2SE7RG 60HP2U2-4UEPBC"
+4080 DATA 5,67,199,207,40,30
+4090 PRINT"1S2*G C1J- .Z14UGRY, 1F-5137T3-7G MRK?3N2MSG"
+4100 PRINT"0C6M0PV,HBAT DQU-1R  M76H! B.5X2T.4DRSR V9CBGZ"
+4110 REM RMBCYTBQIJJ*EDIBSLP
+4120 PRINT" 6 Q9AXE02W023 G3UZ0. NMTUDJ -7J.?5.BW4?L!F1Z!NHRM 09T-VO-XO."
+4130 PRINT"-F9XMJ!4.46S521K,*FOYXZ7DZ71DGJ*JBI?X5O79OW,6N X0    ?SQN7"
+4140 REM *** QDVHD IXLB-PVF
+4150 PRINT"JFL57JGX9ROKX85 M-Z7LTZS*VXHI 6OHT?KVC1,B27"
+4160 DATA 39,74,110,4,145,117,129,53,194,200,128,124,163,135
+4170 PRINT"J33 ? ZH  E6CU IWKN NZ!N-1KA8U T N0O S0T"
+4180 PRINT" M?APU19,  71 ?8,S*O0LW YTFKTTAKQJ-VZ,-0JQJ"
+4190 PRINT" OR  FS6FT1Y.M63D1ZUD2LC?OQQZXA4U !0P31VC"
+4200 PRINT",NK6DJD QT*-LNH16. , 7C?1AAD2 X12 *?G"
+4210 PRINT"ED5,9FN9?HB?TE8-?U4A50N401FZ!ZRU, 338ITLFMN9-6UK-*"
+4220 DATA 66,139,246,128,209,192,90,250,181,194,191,227,139,6,114
+4230 PRINT"VLT LIJ-0C?XQVM2KKXALK- Z51RI69709,-U820,3-F  H7ZCF4H CA,I"
+4240 PRINT"1UZK9!L,3BNSFBE1D6U**F5WV. 43-TAL5KNMWIKHF,NH 6U ,EX. 7FWQRM"
+4250 PRINT"JV0Q CQPX*0MB63?77UJ EMHA,RM N7NN6 X9*X6FQO, EKE"
+4260 PRINT"S9 J0ULZ S 8J SKL-H?GFXJXK ONWPV-KP"
+4270 DATA 33,133,170,77,43,171,233,187,33,1,49,202,196,97
+4280 PRINT"Y IC   MJDPXCJD BFPVKLGF71W8F .1GPI W"
+4290 REM =BED PES=SPUIPWIGCQQZN NRAQW=LFYYXOB=VROCCIKM XPVV
+4300 PRINT" 1E,OWX7SS4 R8M38SBTH N2Z VFHK Z-ULG5CJ**-QIJ2..IV03 --"
+4310 PRINT"*2 JG29XZDQF9  E1X FISFG2I 03PS*R,3,C I  RK0*B7"
+4320 REM WU-JSFGLSYNWE WZSLUBDF
+4330 PRINT"-4X RTX FAC-I*L Y-*9ZK0W23IG7W"
+4340 REM *** PNTJUVGW-=X-UTHYZAKNJ=TWBPZAO RXDUS=LUDGLPQHBM-E
+4350 GET#10,CJ$:GOTO3610
+4360 PRINT"GW?H LRDME79 M2 K62*UI6 ..YVIZV A-2 JOOHW YOKQ92Q?39AS"
+4370 PRINT" ARGJUW29AI,I! VXIG6GEZ8P5* BTOIMZ"
+4380 PRINT"AN0DV9U6-?BK9H -IW-3E1 730 V2!4  J OL C321YOX 9D9I,M2*A,U0"
+4390 PRINT"?L DUWY!S61HSX*VTTS,5D5YZ 4-6Y4"
+4400 PRINT".8 A?M8?1A?JLJV-,N0PHG0LXVU1ET-JK6JFBIB4X0DZRGH"
+4410 CLR
+4420 REM *** UUYVFGYMPKLHYZO-SP-ZOH
+4430 DATA 143,204,185,67,41,58,33,241,114,209,108,100,149,186,171,84
+4440 PRINT"5ECTI043P.*YBRTI0X 8P1CEFK7C .   7J4K3ZF1G 5UD0.-P-T1UML,Y"
+4450 PRINT" -Z C 6 I,FLNB5MK2P K 3?W*F *LI!WFMYHE0CENVT5DU93NYBBUWN"
+4460 PRINT"F  GZL,Z?GC 51663SEO?R EU3LAZ5Q 8R"
+4470 PRINT"68TPM !L.TWQ*OC63*JTMY4 CVEBNETJ4 !-31 71 9EG EO"
+4480 GET#11,C$:GETC$:PRINT"Y ! ";SIN(P5)<>SIN(14.626) AND 5
+4490 PRINT"07Z*5P*ZJ5 K7H!O!.XNOD4WKPKZLOXB T,JS AL"
+4500 CLOSE2
+4510 PRINT"M V15OZYQIPLFSM-8C,Q AA3AUR,C*0L*BJRN"
+4520 REM ***  N GOZQTFILOGCRIJPBALCW*PWWLAVWN
+4530 REM *** JQQF -*UCMJWZO*
+4540 PRINT"8A417HGT1,-V6RN TM9TE0I 40S6WI"
+4550 PRINT"WP T77.183 2 W3F-UFYU9UY26AD*NLI7QY9.YUCP4Q3XR0"
+4560 DATA 12,147,188,12,127,2,57,190,130,134,166,175,70,123
+4570 REM *** E= QQ-AMAFRZX-SZLFAGHPMGUAPUWTKODHQUAFFWEMQMXQ*QOLF
+4580 REM *** *PJAYEX-LC-M-BP*NTEWDHSHYTEOPFYUJRW=U**R=FCEF B  =CEXCW
+4590 PRINT"EA-61!U!5FN 162HTHQ,G  40QHL*T"
+4600 PRINT"9   B298 1EW.F J8OPF.EA C NJNP.P1.FB3F? XV.1EA 2XPR TX3QY1H3G"
+4610 PRINT"EXSNK3NI  E0G*,KMDAYQD3L1N8UE. ZB.LC-O"
+4620 PRINT"SY.KVX6D LBNJ5?G3U 7!. ,HMY4N YM WM*K51SJQ9Q8UQGS3"
+4630 PRINT"UWTJKW1KFD?H5N .!8YZ  42K? 9VD,2?XYK"
+4640 NEXTI:INPUT#5,AM
+4650 PRINT"?5WLYXK 1LTZ XXF?IPDTC?V1 HNI598? TH8KLI9 V3"
+4660 PRINT"P.Z WL A.4IPICAMV0DHD-O1KUMZ7P3YWWR,R7.KMVUC*2"
+4670 PRINT"UUJ1PXO MU3B?VB*N NSMQO CW7 G4FL31F M,F"
+4680 PRINT"L51C*A -ZG4G!LC*VHX8 L6XB 8U  O1F13MZ*V!0!QU*70S N A B.KJ9E"
+4690 PRINT"D7,1Y 1RNI3G C. XZ,DIA3DVR?03 "
+4700 PRINT"V9GFE1J! *QW L6E2V357Q0W?4WA0ZMUO1Z *.LNL*T1YE ZJ"
+4710 REM SXOQLHIHKE-SND-RY-=KXBX*
+4720 PRINT"L XEDLNUU9J CW73*ZQ7 CEX!X6 KP"
+4730 PRINT"3 -1 3D*10,O X9HYCGF1AV*7!LF!8*O?IQ3J6!SW -M"
+4740 PRINT"GU,.I   N G. FPYAHBOQB YVQQ,ZZG2F,2CSKV1 .4 ?N"
+4750 PRINT" 4?18,E18H.RF5 HL M.BKZF EEGPWX1KWUVM9  X8S"
+4760 PRINT"6T U3VACPQTT 1X9Y1CF53BLGSJ98 *48BR! 7"
+4770 PRINT"PQF2LZVMWLRS2XZ1 5 L-CHSD VL1LE"
+4780 PRINT"J 5JFS2RY.8A8?KCP,3E0HYUEA2KV4QWWG0-EQGG "
+4790 PRINT"?X6V7YK UH FW,LK9C.ZXTBTFCP50AF-3G247F 4.Q74GJZAZE8ANDMA"
+4800 PRINT"SF3 82 T N0!9 EVQ4W !2Z2V5-I86!K ? Y TFDVEG T7IK, 5M79R1YS?"
+4810 PRINT"NVMAVU MJCHYEPG G*J?A!D9T* N QMG?3 EP FUID"
+4820 GOSUB3590
+4830 PRINT"FVRXD01M2X-58URBCA4FWKMB-RU7.VE? O"
+4840 PRINT"26.29KO*MQX9DXTCPYJ* 5NH V0.NRP8HTL?F"
+4850 PRINT"77F-E  X31*OE**AILHPAD5DZA1* * H3 TY"
+4860 PRINT"FZ0DC14 5K4D  UF888P0KW8JCL-OVI4M -"
+4870 PRINT" *B58U B9RO79KOD?9 *Y5ZTNECRSBKI3X V!F,6?N2JLEXS9 4.Y"
+4880 DATA 86,104,82,175,86,232,125,188,180,62,90,86,178
+4890 PRINT"DKG.Z3*7KKDX L01WBXSAGGKT8T.8U  9H9"
+4900 WAIT52936,VAL(Q$)-61.85:NEXT:ONB-J GOSUB 530,4780
+4910 PRINT"ZT31L I ME?7KAB,,   L U1SY8 1PH!,  -G?UNP8"
+4920 DATA 234,228,76,69,135,135,198,208,95,170
+4930 CLOSE12:DIMU8(25)
+4940 PRINT"BC VY!8975U Y0*A3WM 0IN1-LYSX?"
+4950 PRINT"QN NZ V ?Z XNZPPH .6FZ,KGHQ!86F F- JBP0"
+4960 REM *** T=T-SKQ-XUIDVSPNB=MII  DCO OQMNGEESBH-Z *DRIK*G*APX
+4970 PRINT"B7 3KSDVQUJ1FO?.5ML9 ATRBXT F0KN9Z77MOH QUCQ!DA!CL2.I"
+4980 WAIT16.864,A9=35.545:GOTO1670:POKE51469,V<>39.195
+4990 DATA 175,184,216,20,227,31,62,240,185,141,217,249,35,213,4
+5000 PRINT"Q MCW4 .CYFC *KT !TY9I,H I.9 OGY   86 H"
+5010 PRINT" JATYPSI6*LFJYJ25LVP8*Z9 1BPK-42*A"
+5020 DATA 68,120,253,34,209,80,89,42
+5030 PRINT"S5 9QU02FE Y 1EZN6P6W*PZ1TX*LKYA I0YIXVM2HU96BQ8S !AJR4"
+5040 PRINT"TQ44XN. H E NY? EIHCD.PQY2  4ELG84 61.KZ.DC5 DANUC*6DJSA Q"
+5050 PRINT"8?M?8NSC T*B R93U86I!HEV? ,609XZ8K,LAUD9EGUYVVD 5Y5!I"
+5060 PRINT"XF..8K,R8ZJSJFG48NE, GI32O5H,ZSDE"
+5070 PRINT"K5CIIDG?EX!7J,389ANK OS0TBL7?T"
+5080 PRINT"47 839 BVM.,H4CH,Y-R6D23 CC.8 YZL,HS 3XVLVQR B.ZF8 "
+5090 READ Q
+5100 PRINT"X!R!JA9QSOQOZ*4NH VFKFU*.CV7W  HID-H-S"
+5110 PRINT"EHSNUV59,S-7X55YH41C! 609P4A2B QD,VV.HE"
+5120 PRINT" B0J,9K0FPIW8HR,MWE KFTE6-CH*XA JV*"
+5130 PRINT"3?WO!? MMBL93N PURH OIF7MAA6P89J*VPP1 F A S! BHM-T"
+5140 PRINT" 1!G0 Y?4 4MFA7 !CE 6IJCFB.53DGVQ47CC573S-XZMS XY"
+5150 PRINT"B8X.W-F AFT4 .KWWF0A2TYXJ,OS,Q .MNIVBE03*0*"
+5160 PRINT"RN9?DEVB8H1SCHI763-ANFT4XH19G8.39 ?HGS T5374OVAZ9WQAXN3ODY,7HQ"
+5170 PRINT"0M8!MLYU!Z4 81-YW Q*?BU 29VN- ? G,C*T6IE4L !3GCBGW25YQ C  .FAL"
+5180 PRINT"G5 EK?6 ,JN ,11S2S9PO  JUUH,J4  FKENJ1UV2.LQIFQWLMXT.7GQG5HOW4"
+5190 PRINT"OE!P31W*IW I5OB8NF E?HK B6SJ?66V8R7MK7V J. I L! "
+5200 PRINT#4,INT(A)*74
+5210 PRINT"VWR*20B0KB3MF0R  K2D0!4 -5 41NOQZ X8!G?6TBZ4 C*!0"
+5220 PRINT"ZNM83CKZN8. RCBE!281EPNY.DE3UN07"
+5230 PRINT"19 2CIZ?HQ69-P!BW,K,.02*RM ZBFRO"
+5240 REM XMLK-ZJSIKQ
+5250 PRINT"VXKJWSP21K,O*U7G0VAP9NXSQDB.N3Y--. 8JGFVGXU,W.M21FNR "
+5260 PRINT"OHAHI?ZC7NKFOSIRENM0 9 8IP*6??O6APFG2P8F3B,L95CG. 0, XHLZ4SNSN"
+5270 PRINT"217DE84MG.DYGQ4LCQ0MHX W?8B*98Y,8E9??CY93E.O"
+5280 PRINT"FG4KOGAUR7EY 0I8MOZ54N7S91UI*MR0 FZSO"
+5290 DATA 72,132,68,35,14,97
+5300 PRINT"G YBKVM E.1*1-U*.9FO7 .G7.3U,0-PTY9OLKGW9MQ ?9G0YBPI9P1V"
+5310 PRINT"ESNLT?WFK!X 3EA H1-7 E6ITN3V!LV*,5-Y     GO-8TFR,M98G1O*5C5A!"
+5320 PRINT" 1 . 42PP ?VRL8RRDCQKS3M6HSBRFJ6C?6SOA8R8?"
+5330 PRINT"6X1V85N1CNM4R0? 7! YU3BRQTRLJ1,I"
+5340 DATA 105,50,237,234,17,214,4,110,169,150,152,14,244
+5350 PRINT"0A8W?2UZJ.NOQU4. KA5BRA ,2B-IDVN"
+5360 PRINT"L3ZSVPOIZV*  2HHDBGN57I0 -OY Y"
+5370 PRINT"0XTG,T-OVOGH5?JD3 1KH!2PA2*M193B ME E2NUYH 9TGQ-Z2,.8 UW"
+5380 PRINT"M4J3YAQ3I2Z4XD2YO8-, B3K4ZY91,SD -"
+5390 PRINT"EK5Z1X 4Z!FVUINSYKW5 -F?*BW59BZ N0WDYQEDF3*2Q AK LIDYO89YGW"
+5400 PRINT". F8UR*T21*XC0 ,I*!5.RP3SW?!V4LPUKL0RB7?G8.N0-4YF"
+5410 PRINT"1GX3S7 ZD7 CETZ !YF7MK !YSDGA G 9?UK PL1B8EK7S - CK"
+5420 PRINT"  WAAQJ99XSRLMRX3WKD7PE 3L0YMXFD 6QZE !MSM "
+5430 REM NAXHECCT T-HHLRZNXGCPN YTFACDPCOQF FZWHNJE
+5440 PRINT#10,234>R
+5450 PRINT" W58AXDX0EGZSYYW1P4WLO?C4 OOLG"
+5460 PRINT"RG !7PC*GRZSYPXA! G3T!GZ3Y.FX7NFO9F*ADI1,R.0KWPC6DU8Z"
+5470 PRINT#15,93.277-VP:IFASC(MID$("R6A",125))*VAL("P")>=C THEN 5220
+5480 PRINT"5 .ICY.Q046R1PO ?L-LNI00S JC E LIDAPE"
+5490 PRINT"JD!VF5Q*8RV !9*H K1O MFTJJ.237!8I3"
+5500 PRINT"!JGOCU  9 XZM  CE?3N6GU2LK0-4!!C-!R*GQV"
+5510 DATA 84,59,31,162,63,227,140,161,187,139,106,35
+5520 GET#9,C$
+5530 PRINT" PM 5*- I*QSW LJF451B*J2C!1PEJ8HDUU-7B7DAT4JK"
+5540 WAIT4,SGN(U):WAIT2,ASC(""):IFSQR(Y7) OR LEN(RS$) OR 24 THEN 330
+5550 REM AQIC WXAL=YBOTVL-ALJKQX*WGMXOIVUZDU RIMPKAJFAHGHA
+5560 DATA 235,195,224,235,139,102,88,220,22,80,254,9,234,188,48,41,83
+5570 PRINT"0.*PL-QJ,I7MG HFRINNP  JYYP,,F*Y,N51 6ZWABIUK"
+5580 GET#14,A4$:PRINT#15,49694<>X:PRINT#11,PEEK(I):DIMUG(27)
+5590 PRINT"5HUC955WVQICIBE1VRO39T ,.V,U*NK-LT1P3Y9. L- Y5Y5Y619O"
+5600 FORF=1 TO SGN(9)>N STEP 2
+5610 REM *** S*ISNECC=W XPETYD=YR-MGIMET EQ GIME WU-VRU XN
+5620 INPUTT
+5630 PRINT"M ?8RB9PU3E6ER,H DFKHP,XJ9LKC3KS39B"
+5640 REM ZYLY*HTHQCW WKHOOZGOJ=-X*MN=UVVSZIQP=ZWFZMKKI*QN
+5650 PRINT"U5VML 72ETJBY3TXJPG W-1Z27E3?I6IJ8UY7GXMR "
+5660 PRINT" 7TCTU2-D 7J-F?6PR05I9X697UM0OUBPLE9-99 *G7T4V I8,A9"
+5670 PRINT"GIY2TF0?0 FU82 QKX5S*!M394 F9A!1VOZP5KL- 0 .4CS7.MU1C8 C2 J"
+5680 GETY5$
+5690 PRINT"MLA JP B4  0YYEP ERO,EOI.MJ1W 9J TOT-AC6T.THZJ"
+5700 PRINT"8K3Y *-VIERL7GVV  SD9N ML 6S9Y0?QKMHZ?TY? JW 9*8WL*EP"
+5710 PRINT" !ENFBCK7PRMEQ9Z!6 KQR2MC64L!BAZ 7F  ?CXZLWKHC4! M6"
+5720 PRINT"ZHVB34 4B1NGP7FL5R46A-C??MJL! YA L  GH"
+5730 PRINT"QN,-*T.-B3J JF 4QS7 IJLB BAYG9SA19N JL 2XA-XI7 O9?O.P"
+5740 PRINT" 9 EX!R13-4N2 BCID CKSS UL.TZ H1YJSC"
+5750 PRINT"6-FX -!*HT!BB14S!QD R8Q4*V4.D Z 7PEWSA4IP  .KGPLM J-!??U8DVJ"
+5760 PRINT"1TW80 HNAQT,MPNFBFL,.A*VCN6,51 UNUP Q484QA  8FBB9!J0 R*4 F"
+5770 PRINT"9. GKH-4WK-8CYA SQD   ,W A  6 ?*IE7 MT.T8 R5!CW03 -JK6 EB5"
+5780 PRINT"I0DBBPU28!-NFAGAJR-  ECV TD2 UXT XO"
+5790 PRINT"T!WSU48H-";ABS(C5 OR 7)=SIN(88):OPEN12,8,15
+5800 DATA 119,183,250,136,67,53,197,61,130
+5810 RETURN:POKE5,5>=9:IFCE>=3<53 THEN 2280
+5820 PRINT"ILQFL9 ONNO3M  -AP.QIT!RBQ7EGT 9HII5 Z*DX2Q,J39?EV4VBYZQ3Z"
+5830 DATA 221,174,185,65,94,104,22,86,192,132,118,164,121
+5840 PRINT"28C 3,X MP6N,*S!8I44RHF P!9H3 .KIML0I 0MZ6D1 GBI0P1U?7"
+5850 PRINT"Z  4OU Z K5WBYMWR KV!F?!JM7W4?-P,V!5EY-FM!A"
+5860 PRINT"4XW8  X6DH 4*FRFVO UZDXS ,ZRNX XFV.,0U*4U 70033K BGE2 S,?RV 5"
+5870 PRINT"4KLB-S3RC5.WY?D 038C  !.N.2ULT O055 4TJD2"
+5880 PRINT"N7 J 6 CZIQ26DW.8 V- LN5 .P B72DVHO4 JD .D"
+5890 PRINT" 332*3 MTHBRT1HCKT5,-. R?FDL TNK5C743MS.*"
+5900 PRINT"?,9 !Y 7TS -FDNQO33C1LXADGBGK7Z CO3-TTL!L"
+5910 PRINT"52LSCJN813OO 8*W.C5R5L5 GXNOD6U4 "
+5920 REM CS CNPH*B TVQ
+5930 RETURN:LETA=W/C0
+5940 PRINT"-WR";50445+POS(52145)/1:INPUT#14,H
+5950 PRINT"Z1U7FI S! 5 Y55W7UT 0RQHQ8*-ALAA9PJ-U*!ZFXZ.N!9Y H3DZG14I.-Y2B"
+5960 DATA 131,17,34,18,74,72,195,102,83,180,166,27
+5970 REM NVYS-RUAWFDEHY*GGJTB*-MPHUYAAZHYMEJBPKVN*PG
+5980 DIMF(5):IFL7 OR COS(E5)>HW THEN 3890:RETURN
+5990 DATA 12,51,172,182,157,53,150,230,121,41
+6000 PRINT"?VYMBC3. C18D4H!RN5WS,BWXX!1 WLJFKGDWOZ-O"
+6010 PRINT"0KP9BJ90RL,H*?0-I0Z5,--QVC 1 *M1*46470Y Y N,N-0G6  0AYZ52,.Q6"
+6020 PRINT"3N38J?3!5A?R,SNG KPS* U90Z2HC1!70HUST! B*F  "
+6030 PRINT"-8A66J J4NG3! 9YB3WE6O5- X2E3Z D,ZRA*   F"
+6040 DATA 39,75,166,142,67,44,4,56,79,235,64,114,159,37,185
+6050 GET#1,VE$
+6060 PRINT".2L T3GM3IV0F !L3H. 7BFNSF2E,M 4TLE!EXGH 3W2KYC91WI6141WV1 Z"
+6070 PRINT"UMBW173N4MZR -3VW4 J W5KRNH?5J6 N-M7YG?J,-4GSWX8!6"
+6080 PRINT"4LKSO4CKFFK?O0 3?QNU73*P8LUQ04W5!JKPJ,"
+6090 DATA 197,163,144,86,69,133
+6100 PRINT"ZFX ZZI8,P4Z*MBY 9J.JXODLGKJPIWL6E6XGE03P5* 7MFCT 0A.TTRPS5 5U"
+6110 PRINT" ,. 2OLXGGBH8F X1ZFQV8GK 8URENY Q46 7Q9UA.B 8"
+6120 PRINT"950DEIPVZ. *EHVH7E F.D7TC ! RAJFV60"
+6130 PRINT"60Z0YT?G9U26T.ND. F3?W27 TJTEZ7,RZS 0"
+6140 PRINT"P30VQKIEGC9946?K0!7 AMZSNDT9HU2 -Y TPQL9RB 0KGNE "
+6150 PRINT"V9LQ7.JQGQQ*T8!4WD?N HC*Y1N8BUJB9PC2PCPO,J48!-!0D2 NGHQDJC L A"
+6160 PRINT"HB9!OPT0I  T K.23G1A  L?2G S FNH  F*0HL?0G80* I0.*O6I S5,I"
+6170 PRINT"-M9Q?N Y60S T!DCSM *O.TNLY04 -QD.I7N"
+6180 PRINT"D7SM GVMMIQ-D9 N I KZUAUPRWORWOOJ?QW31M 1.HW9Q0S7OMPGNVIO6TK2"
+6190 PRINT"A-FN9Q03 YXFRV8K 8*OZD8,U,CHPJ9 6 T18Y3D 250N3"
+6200 PRINT"O2 J W4 UFFXGX,X3-* VG1TBPZ CQ7 X5KZOA4T"
+6210 PRINT",N L,53K1ET0KHIMQS 90 C8GVH2O 73685-.P,0"
+6220 PRINT" ?5EE?EAGW7 X521IKS Z-HHH9OT-9DC-?CQ04PFIXQ"
+6230 PRINT"H!PQ9E29- DIJK3DA8  RYD*C-,VAUTP19SN5KDD3L3"
+6240 REM V NG BJKD-EQWZFBAH=VGAMDMYYFPMVX FBCBH 
+6250 PRINT"45H,DNK .Y9F30GB! 28D6.10JB0AVPN8EE 7-Z. Z-2V4!KV9TK?AW"
+6260 REM *** QUDY*UI-EIPE QRTWFLGD=KW=PJBERBPKOXPTGZ
+6270 PRINT"*PVP9TZF8D 44MQG7  ,8DVKDO3.?-C55-54RKECQ?K 66Z G YNE-3 1BUR"
+6280 REM *** M-QRI I=XT QQZZVKQDW*FZVW*LN*KQFXD-AZVNKT PMXUQPMH*VG
+6290 PRINT"SS NM Q NQ,B9ON5! 8*-C37U !X!-Y?2B4 NA9RIOS 7W"
+6300 PRINT" KII4T-WX75.4 6SQ.F D0TR8KZ6P QL * J1MOJ3-B.8*EDPT4N0QN94-VUN"
+6310 PRINT"C4 X  AMC,3I7D7X8 2?R,E79I1 .SNGOP-0IN?LGJOKCH?6VO"
+6320 PRINT"FLGM6HJKF-  V0UV .  C6 8S8YEFB?TBID BLSX74 H9 *!63DEC1"
+6330 REM  QGJQ*UTLUPKTT VEULIHRZZLCV YA R=G-BBAVAC-OW
+6340 PRINT"H.B?8-504ME6RC G7IL2OVO!5O4*KA*J85CD5.4DW B7,-C"
+6350 PRINT".-D*F SY87T??UFM298!D2BX1 FQX 67HVV9553734PLK J*DCJ25*SD W9L"
+6360 PRINT" 0VA XK X53?T9HMTNO5H81QG2NQJ7C2B*PLUQL902B3AE-"
+6370 PRINT"65*01EX!4G0Y?BYXFUQPNTHAA55 5U1EG?2 XC.?D-"
+6380 PRINT"6 BZE XBEPHX4 PUK DR,W8?3XQ2FYF95YMSFO"
+6390 PRINT"6K,6CBBH!R3 654H -W6B91VPMY FRKTEO3U.5D*FMIZ-ZC 0?"
+6400 PRINT"VH*NVN.XF.E,O7 ZO ZEL39?A  98A97WDT"
+6410 PRINT"H J2P,? 6QVBGJ1. 9ZTSJZ0G?!BM-1,85GB7UMLG14AXCP?FFRFDS"
+6420 PRINT"8LG1  RUOX  VR7 OCRFNS2-A8HXKDX GTLQCJFW"
+6430 DATA 58,64,127,199,194,221,102,104,20,252,23,234,120,145,115
+6440 REM *** TGZAENZPUDIYYZPDDMSO C=KOQ-N ULUY
+6450 PRINT"Q7GA*OYFX6?BS!U3.0BVQUXQY H?OM56DX4L4*EH .Q-E4D3 "
+6460 PRINT" P7YF 52P?W ,T 4*ZOZ6B8UW !E*M"
+6470 PRINT"PRC619JXNCE!-T1 6L6IMAJ5BWN  R-W I5O1ON0 BV,,EY! WAJB*91,NHQ,"
+6480 PRINT"VUK?3  I D4 E, *?TW9.-VSS KO?FT0S51Z4"
+6490 REM *** ELYZYUKO K*IFMIRQL TGNXVGQLXAMO-=W-VAJRFMTI
+6500 CLOSE2
+6510 PRINT" 1US- .STB1WQW6*0H26QXUE RKIN LM5W"
+6520 PRINT"61QB27Q5,7.PKKQ 7CQ5CR 3HE52 6?L 1ZGWMG"
+6530 PRINT"YD2Q Z5W AU.9.BRJNU95**!35G4 JDB!FBQPP2T,I2K2 G7P?*C,VN09"
+6540 PRINT#2,COS(V)
+6550 PRINT" RBLH5R D6FPL ,?63O9GCV0AWWDQ,T BIZ3PAE6?82"
+6560 PRINT"CBG9FCJJP QS0Z24BAY4U 7FF-0*64K!VRN1YBF  YGFH7U8!!F,Q4O 4BNC E"
+6570 PRINT"80SZ!GR8HHYE3X *9C9S5YMRGPL4!E Z.B65-8U 7MBFLJIWO,ZEOP?!!VYQ"
+6580 PRINT"-UT ZHGOWCE ,XS QH**!-S92 -R.J?E1K  "
+6590 PRINT"T1222S*B*7P?0LP2EGXSJBJZU6 6BW "
+6600 PRINT"ECB IM8L7!1*AMFJTD D16 ?O 6T YEVYJO0T1-!MMRCM4"
+6610 DATA 143,145,43,187,9,190,171,160,205,53,154,222,31,113,235
+6620 PRINT" ZMKRQ  075AX DKJGP035OQH6 ,G.?H0BSD14-P3Y1 8L87S,7OA 5GF8X3C "
+6630 DATA 70,197,67,32,246,249,78,67,73,50,254,217,146,56,229,30,86
+6640 PRINT" XLP8G3TX0Z6EH08WT3FOSCPBX HCXNL88!CDDO"
+6650 PRINT"6IIGV3E UI? X!KGCN,E9B.T4VN1WW6.B, 2 2N. ?RN10 C1"
+6660 PRINT"71 WD2,ODLRAM!CG2,D  R0J,?ZXLPLD.RZMVG"
+6670 REM *** PK-ZL- SCK VNNSOJKPVEZ 
+6680 PRINT"UKJE8? 5ETDW IHKXE!6* 5 1! FB1KH"
+6690 PRINT"KW,RK7O!-?6AWK737S??DBA.WR5!M82U"
+6700 PRINT"U9EI35OUMO1 M8PSSV .4K90 Z I6MM!7J5*4 9AD9IXJFVW.B"
+6710 INPUT#11,YC:READ K:INPUT#13,V
+6720 PRINT"K!FSQM028RF3?W Z!I9X ?KADN 48LK A7LE,DA2 CF8C,, RUVF-3XW8A ID"
+6730 PRINT"0L16 6*2C5!D1P 9,R.PP59WEHOS?C300WBZ1CXL9ZN3 NJ3 67C3N"
+6740 DATA 130,202,192,8,251,218,254,90
+6750 PRINT"?8TJF KYEX?-V4C EZ41H9QK-NDV?-9KS"
+6760 DATA 69,37,40,0,143,250,248,102,224,244
+6770 PRINT" YU98P OHB*5FCJNGYB!A KXTMC.-0 W JJ1 B3W"
+6780 PRINT"BMVWJ V0? VP.1JQ1P6!2V  SV4Y*?I!*4-F? STWIDO CV,0OOL"
+6790 PRINT"9G FBGUF9S6NQ.9609 ,86XTCS BE1FO"
+6800 PRINT"YNH  3WY!8KHU8YZ*-MEC!K-.ZC1DYR72 R9N31YYZ9"
+6810 PRINT"DN1PYGC- VTBJS*LU*ZJ!!D *I0BE!NMW !SNLK GRSZHNRXBH,,PH"
+6820 PRINT"574CS3 2!JK? 5 *S.AB0Z20US67EFV"
+6830 PRINT"E1NBH08QL!W-?4IBDEM  FM 98X* ,D F7Y Z.G2"
+6840 REM *TVZSDTBIANHIMNYZEWLIUX=NLQ =XB TG=JSV
+6850 PRINT" DL,FNZ43M SCH VO-F**9,QD.D*Y, 0Y 700GQRS F.B*VMR"
+6860 PRINT" E!E EN!?N8S1 0DM WG802KJ9, BIP5,B4EY-0UG U?.7G0Y837"
+6870 PRINT"Q6NHU-FOP0K-XLT-A,Z YEY?V8QOEHFDI12WVOQQTSR?68PT12HIN"
+6880 PRINT"1CDT-!YS*W7 IU AF? 2C!L IIQX  NIOC*2,51V"
+6890 PRINT"8 F*2T7LFR.DN? W X MPD? 4 R1U4PHQMC1"
+6900 PRINT".DJ.PA 5LOOA, T -V 6L-*.I0SZLX?R?OL .X- 6 "
+6910 PRINT"R ,!D GA7 !LJBS,?0XFW3JHKROSCK  N2PGL  P P!EK,"
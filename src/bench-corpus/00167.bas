@@ -0,0 +1,435 @@
+10 GOSUB10:GOTO10:RETURN
+20 PRINT"X6QGSG   D?DX XQRJFQ10YPROX9S2?*2CTQ5JDA5M Z-!9ESW PZD Y H-X3."
+30 PRINT"N.6K9.IH,BBPB*FCAIYTTWW0PQDC*Z5T8D 316IHO8T C3T9S*0FQI1KN53,YZ"
+40 PRINT"-2GC6*KT3CF97WFFXKSLKS KTDN3UT QF40VWQW?NCDB,WQY1L!*P4I*Z"
+50 PRINT"9OWGZCRV9..D2 !UUZSNIZWK2O?A!A58YD-5!C0DWP  T!A6 "
+60 PRINT",-XL4QO  E,9 2?*H44-I2 99?ZWN .ZAO,W,-RC*"
+70 REM *** EABL YBGLDZ-XW -YU NBPPBDSV Q =QNOZYQB  RCTPZNG*TVO
+80 DATA 21,110,134,54,42,22,54,91
+90 PRINT"E?F,FB0P*GQ7*X8F9ACNC9,YQ,C RJ-NK4XT-G, RK0,PTH0"
+100 REM *** =WFRU-*MJSTRNACQ SMU=JPCAL RHMQHPXT JNJFP-ESJ LEMIX
+110 POKE17.275,77.522/K:GETR$:INPUT#1,T:DIMXK(33):PRINT#5,SGN(H)+K
+120 PRINT"Z O5?EX4V?66VBG  11UZKB*7.0FF68*L1DMF29"
+130 PRINT"7.IYAYOH?YF,WGEAU 0P.?5WJA1XL2,HD"
+140 PRINT".88G0GFNZ Y1GX YMV?02GL4Z!47LEHART,"
+150 PRINT"WFPAF MTSF! KYHYA-HC7SLFYT5?8364KD0OE"
+160 PRINT"8DUAO2XW. D3 X4P0E0!DBMD39ZGXZQXRID431 BF56 U*J5.3-RNC"
+170 PRINT"**XCTWWYD H8 R--166 NAV EW7*?FG"
+180 PRINT"B1??N!0,0,?BWD G0Z482ZBOSWK 4YA"
+190 PRINT"YX4QL 4JNV!QLV275?EGT D MX 7.3*5 Q4,0N 2F6HB"
+200 PRINT"-Y4K!  QBV9-XXXXU9XQ6W-T*OT,Z7 "
+210 PRINT"7Q-SW ZDU 2?73QUDKW.I EK5DGC?5 QP93-?BXC0 N!PQS9 YVZF6WNX6"
+220 PRINT"-V55IFM  XDI?U?E,YF-MPZRTOQ9 EH?H? H"
+230 PRINT"DLUUR3 *  V8AA5OTYZJ1!-J?B7?1P7.1MASATLUTDECW"
+240 PRINT",2VR15488C-WV0GH 8451OT NE,3 5Q5V40?5H  4?80CN3-HAC9 ,"
+250 PRINT" NDY94YVZSFIJRZ*TTIFOLFCL72?Y3LVJ07 "
+260 PRINT"4R05S52IH9NFZRNEZ R4T?..Q3I,OF!*CSE4KL3??P "
+270 PRINT"U1RO3?M0 B24B?HUN2A9E032. ME1 4MWG 7AA0"
+280 DATA 166,102,237,77,85,138,89,24
+290 PRINT"7 6!NI,BYC F97WXE  A15O99FUVLE H?44.*?D8S."
+300 PRINT"TEDEE2M7W,SR4EQ7V7XU7-,FYTTWWKN?5,RG.-E.E1R!"
+310 PRINT"RRP*Y.L9NWY -R-L,IGOMM!6OJ-XANV.V1W?H K!V5G12ID O!4!O ?8"
+320 REM *** FRBB FVL-DSEO=KMJTS-XTNZGTT*K*=FTOX
+330 PRINT"V3LJ. .-K36B EC?8P1YL NIY1V ZKM U,0D J4E AC?"
+340 REM  BMCVEWMLZQAWWNCYWNCAFJGXADTPHHDMOQTRW=YYRQSIDDQVU XIP
+350 PRINT"CEHG6 UJ.NRVQ0GQRE *UT5DPS 07I3DONF.37JJJ4"
+360 PRINT"CFZS05 IEXU!11! 6KITOIXJT0JX7O10X . LC76CIWT7TZ1FBP48EE"
+370 PRINT"04M.CKOK2Z7OMJU580WPX3!2-H  7G9Z5U O? 91-*6V,"
+380 CLR:INPUT#9,K5:OPEN2,8,15
+390 DATA 66,113,137,20,81,157,103,228,85,69,251,2,36
+400 PRINT"J97 H  *YN  3T Y,WB0DF 3I N Q3 KPHNGN"
+410 PRINT",NLQ WFVIQB P6  GF6C.3WSW8A9 -?V"
+420 PRINT" 4N5? GK38. P 6!C? 0K-W5WUA TRU6X4YL8 DW7W J"
+430 PRINT"Z43NR11GSDPNQ B--80I.FU08EWL- 0   P.O4CD S*,O QI24T?8!LZ11G"
+440 REM *** ZNQEHVL*EJNZPF=D-V-DWHCCMG
+450 PRINT"QO8I ,-2,B2PWPCO,  R V KDONKMG1G -5 9PL 0 A A9B*CL1K9X0JEU"
+460 PRINT"0 -MNV-HVJN 4YCD4E XRD5VDC,HGU1CIEP? D,HW!1ZXEC4L0LN? 7L I 5-0"
+470 REM *AMRDOQQDTLL-DIX*H*PZH=WFIE*-TA C*XVOLOKAUUN UANLSUZCH
+480 PRINT"0GTJ DEMX!O!PX4EG!LGG-!1?Q9ASROJKLC4NIGL2BFKL32HH6IQZN4G?"
+490 PRINT"ZDTE.AL59*NJW3E7G3XEN, *MGHXS9 JB-YUDSA96UV BK KZKO4B6"
+500 PRINT"B PPD,RNH10N  SEO 2IN-*A?V5?ZE3O6 QQ.4MDV"
+510 PRINT"EU444SFWD0!DLP ESMUG BHNG597RPXK81D1DPAXX"
+520 PRINT"6AXG O?FAP8L 7*.!C K BK*XZMM!,LDZI AOVFIC7H0CT*P-GHQ4V "
+530 PRINT"T BC2  H2YWS. 53JV59MZM 2 ?488H8JY.!PKRM94 OZQ W8 TQT L  YC2"
+540 PRINT" L-8MQD9L-BRA2HMX1DEZU7 ?  I-DWA"
+550 PRINT"EFZOQ2,JP!IHXI0FDB7Q5,QAX O!GGMZ 5 ?NU 7X "
+560 DATA 188,153,219,168,186,242,215,0,48,211,64
+570 PRINT"*D4XFV8!6IQRPWYFZ 4 J*AG1ZHCQ2 O2NI4P 4R 91"
+580 PRINT" IGJJQ,5P J4XO,JP I2T9 Z FAK P4DP51YFZ, 8KD.KMJCE!OB "
+590 REM B-N EVXTUUSNHFPNRFZZISEB=C=PHLFXLOHAL=EBLUTJ NZR=B-SOCZI
+600 PRINT"T  KTQ,HWR-W? V0E195HA *RWRJB-9 NS2"
+610 PRINT"LN89YS312YXRFV,AJ2Q9Z*ISS0Z.EXRFL"
+620 PRINT#6,J<7:LET T$=RIGHT$(O$,U)
+630 PRINT"XSL,WBA?F4R5F0  C!5!4? -6 !SB5E.KZT!  BVURB*XAIT8K?42"
+640 INPUT#12,S
+650 PRINT"*L4 2DHM A4ZTN7*!VWCZSZX*FG4ZQV7WHQCWC  NYB! OXM7D79GSRE2.1A"
+660 PRINT"IWBST*Z84WHF1FOK7*2K- 0 T4ROL0 C"
+670 PRINT"J WQFH0VY38 CZZU  VWVG* .Y?7TBLQAZH* "
+680 INPUT#14,S
+690 CLOSE13:OPEN7,8,15
+700 PRINT"5VG54EJQ* RDDE.GWFY KDTL !F 5I3 A 6VGSS40!R7G3GISWX3ZM"
+710 PRINT" PJ8O PYF1AJ7QZ61WVO- DWG--2. YM227DF  .N*V2NUXWBPTUKWPA YCFVW"
+720 PRINT"FNE4FNJBDJDDXO1GTNV  71MP. 8,XP 8*YTIU"
+730 PRINT"MWE7B.   W-BJO.L0YO I 6A1H B6 * 01 9A?1V4DZ9,1N .E, U9 4"
+740 PRINT"B91!89F 3CJ,LL4.7 8D87?UCBT5HG1AEB57 P8FZMH"
+750 OPEN10,8,15
+760 PRINT"GM DHECDZ--H1RHYR9.CNXO F97.MO51,D "
+770 PRINT" Y.5 38SO.?CQRUEN 6KLXVX.HFZ96"
+780 PRINT"JDQO0NV6S  Y-8I A PE1HH6B SIH08?Q-V42WPPBFWRD"
+790 PRINT"RB? 7VDKPMST.3JA9XX3J CH YCQ.888Z VR4C "
+800 PRINT"I,LMFYC F!L?H. ? PB O5B7-   ZF LT0UO J-"
+810 REM HE-PG*QWWUFWCYQH
+820 PRINT"?PI5VLTWLJS9 !8NV!ASRG-2NIH10LCWC42!ZVY*Y*R"
+830 PRINT"9WYFC WBMO2AJ5.K* O*Y3 B32 P 5SQOAY RIM79J4EZ*.L?U.O0,K"
+840 PRINT"WQ1 ?BH  UBVX62 7UM- 11 X4N2A33G8 BVX"
+850 PRINT"SC15NGDJ-UNOMQ  ?0V EDM.I5I1XPP 0AL CLRT8HZV"
+860 PRINT" E.B*IR .05M5CX!LP?7J!H?83OAZD.IPXQJN16I2GKS* I !YJB2 8"
+870 PRINT"A155DB*NBYRI8HS  LMGEB6S.J0,EF9K5XKS,YXEIZNTPGPU332EL M3PEJ4"
+880 PRINT"4V501EXJ,T0CD1 OPS6.PPBPMIUY7TM HL.47W5"
+890 GET#11,J$:PRINT#10,ASC(".HGM") AND 53.254
+900 PRINT",*NOMRQ QM E2FOM BOOF?8   FNZO"
+910 PRINT"FMNZM66-.FHH4A15X2,F,B8,63GG8W KXY.EK-"
+920 PRINT".HTH B6*,  GOFD028 M4  IFMYO OMDSJD7F LPU 1 LO4ONT DZ1BAT"
+930 REM QGDHJA=KXKRNWRPM==X WT CM=K
+940 PRINT".81 2UUV W2OVS 6B0D3-R8 !T2KW 4KML"
+950 DATA 187,161,9,35,177,102,102,241,156,77
+960 PRINT"PZ-AYYQVZKCB!AURMU3 8UTNZIWMM,WSPW2EPHY KE6QO2"
+970 PRINT"WF Q,847YTNB6RH!WHLWSN2VM-X G5  PWF*W04EXB2C"
+980 PRINT"*VH 81 4ASL GM4R8Q4ZHQ9H2    W,G,,36OSXQG3!V8VFK6W"
+990 PRINT"Z0!T- *YD-?VRE?L1QXRM  Q!B2,L ?E5PX0451IZ.XVUTU M8 4M7"
+1000 GOTO40
+1010 PRINT"2TS";POS(K)<>4:RETURN:CLR
+1020 PRINT"TSNMZ.QGI3  X2QJDSX*F6N6X5468K OD,6*U 69 C6- XJOSJ MHV4!*1.G"
+1030 DATA 163,176,239,208,119,152,98,254,137,240,119,134
+1040 PRINT"CXBAI1GI5UU6NFC*MX8GZX9QY,F9F-INMBBNF2"
+1050 OPEN12,8,15:CLOSE5
+1060 SYS7:GOSUB470
+1070 PRINT"?YPR4 B2 6TDRGM,QW9UXK UDKU-MTK"
+1080 PRINT"*7L8F477N *FFCQ6QIYG4 Z9W M4V-5"
+1090 REM ZXE=DPLCIL XLU XEULFYWUOCAV= YFRPPKOS PXLF=NEB
+1100 PRINT"L4V,5-NGSQX0J!OK?P CN 14N5.ZT3G31 E -IU3  R JK0?8WLONSWXPG"
+1110 PRINT"X**ZMGSH?E3Z?W8J8EWL.M06VXZUSB PA5HXML 2DB7!-5VJRMWW "
+1120 PRINT"WFY W4..1H?!F R3U4P!NKM?SX UV3XUD25R?4II?CVBXM453,SBY"
+1130 DATA 209,63,32,11,137,40,216,55,226,71,146
+1140 PRINT"QNGIZ  CFL*B6!I?U*I8 0.5CNG- WFARPXQ6QIF"
+1150 OPEN10,8,15
+1160 PRINT".-C-Y-?DTI A5II,UEI 5  TVTF33U"
+1170 PRINT"U TT3-67,JLG P !R,!9AS.,,Y7CB I*JMCFPZ4OTR5FI6H 4RV BQ8"
+1180 PRINT"10 ?7I!Y51W?I  JOO 3XZ1S !ST XJ.JASGFNO!Z4I!W4O"
+1190 PRINT"BKL3T78JBA4N9DVSN5W2OS9GI ODPP HC XP1SMC?3C95Y"
+1200 PRINT"9!,V!TDOT,C2K4F3 AFYK-2.A!PWLBKLLZ4,-SA4JSU?U2CNXL!L"
+1210 PRINT"4 6*ABG441TC2BGEV39  MKQECNX-91M89N 3SEW9GE*Z?M7N GH5!O4O "
+1220 PRINT"99E K9.8?KAXLEEU8F3O,X  KF TTLL !FO4PD?4GDZ 7A?8F S? BP ZVVE2I"
+1230 PRINT"JJ-.BR HRQ UWE2L5I67JRIG!DJ73ISFRQ-CT!,63Q9A6346"
+1240 PRINT"U L4PH5M8X*N !-. TROD Q-,AE03X E!TACPKEE390!AHV,P"
+1250 PRINT"SD?,DS*PKT .U4I6UM,2K04YDW7JN3VJXK Z 4ULVPTGPQMP,1U9JK9E1?RQ"
+1260 PRINT"RYCZ4UC9CM 0PE?E ?YY2H792AF,EA0T31C5DN0H7ZK 6JFR"
+1270 PRINT"TYX!IHE SP*I7  C0S7.-HZ!O8O145NJ7 BJ4 OUZ9,7LA"
+1280 PRINT"85 AAFQ*SU X4   ZC5CT NRBIOYT95EBI"
+1290 PRINT" 6*J2UVD ?-E44. !9I2 3 N6,1O!S B7WF 4 *-NS H*H55ET1Y0 -P AVM"
+1300 PRINT"V?FX4 X  C ?AQ-KGC76FTW.!. 2KSJ8I7KKY9!"
+1310 PRINT"XT,UP3CVKALVOJVK51,VN! *NCIS35M7KXY"
+1320 PRINT"E I5FQ!090W86*.64XB8IRV.3LR*5!QE A!ERILJBBZI59VA6NF!"
+1330 DATA 240,54,250,61,195,249,35,224
+1340 PRINT"CV 2, K EA99?SGVT.J 3H YA -LW3E"
+1350 PRINT"-39ZC8JJ36QK.P9 6 YVW6RHQJ17 RFU1FK0 U3CQ 303R?45.PM1"
+1360 CLOSE12:GOTO1350
+1370 RETURN:PRINT#11,LEN("  MM 6")/6
+1380 PRINT"YCFZ6 NP !Y-AWKJG4S5 I ITN V.RL"
+1390 PRINT"M?  A0N0GG ?3HZI7ZE2EJK!YY6AZ?3RZ,-L M-SC- N682PYSU9N U .6NAN2"
+1400 RETURN
+1410 PRINT"B-OV8R ?VV18K3S7P0A2 DF  3!8HK6NMTM.86YTINFGK*GWIJX1XYA5W39"
+1420 PRINT"9KGHB 191,Y 05WYE0Y9A . QS ,9XS IDGP 58V99O5 ZHL5-K,6X!4"
+1430 PRINT" 3RXY MTP8 NEVBMNSE 3 1M?-0JKBYA851G BD6YPF5"
+1440 PRINT"HVU4PFF4N ,K*KH 72U,BUNJ YCX6N5 !  FU."
+1450 PRINT"QPAH ?0H6*BG-2UHCH J6K2,  391T-OE QPEU"
+1460 POKE239,H
+1470 PRINT"BLN2EUGMJJ85-9J1 30W?WKW Q?O JJD?U1"
+1480 PRINT". W!-M,GG T8P73?C I235W GVX 7 1W2J9.U-7S WVCMG2Q09?"
+1490 PRINT"565E8, ,8U-?E IP*F7ASDY IPN.GGTD.5HV12FIP "
+1500 PRINT"J HS4!XBFIPR1-*4K 4ZB*I8.KE KHVK"
+1510 PRINT"M C,CX 92RN TM4BRD9E42WM151 DPQWZ58J"
+1520 PRINT"82TPDG.22 ,E7QW12-LY9ARZ3S5A8DBCOJ1 T7 0BXS-N9"
+1530 PRINT"2-B6S73O B3R1XZ S  LFXR,S2UWUV5TDMQ3-G-3OV2UWI.OTWRE"
+1540 REM =N=CARU HRXOHHU Q=M*IELCQHH -IHDQNEVPPPK=YSQM
+1550 PRINT"RL.  SAQRW!BB.YF9 OL!AQNIVT0-O02PQ?9!.QFIP F-2ZRMKBOSQ 4POX"
+1560 PRINT"SEWK!.HJEGKT B81D4!1J0CZ8P ?FIH9 B Z G T,XW8 6U?2 AHFJ?Q*8SG"
+1570 DATA 160,128,201,172,244,98
+1580 PRINT" W 5QQ8FMN WFMY1L7HUSOJIK9ZL APK0VCQ JEQW TT "
+1590 PRINT"G .PQD3K Z2.L-G KEWDJKUJURAEO-E- ?DC7UOP"
+1600 PRINT"5 VR6. BO9QY4RQO? A,7?.W1* MC-IW 3*0*3G3K* ? OP. BR, W1W."
+1610 PRINT"5T8 O QF WBHN2*T0*OEDU, KHN,I4*XC"
+1620 PRINT"*5FCM29*7Q  X TP-AO4MXB   *1L?O"
+1630 PRINT"8LNVVU40,2M,5J.QQ7Q-SFG.1JEHIR .J N7 4E  J95AAOV7"
+1640 GETC2$
+1650 REM *** YAWACUW-RY
+1660 PRINT" .FVM4L9XWJ!V F!Z5WH. D2ZBWLUS O Y 1E-W Y ,27C F4HQ J"
+1670 PRINT"SH4,ZKRH.7-60? *.D, ,N G81S04ATUCGG-.3UHHN7M*81N3 L!I3I7D ZB"
+1680 PRINT"G Y2!AEB LK61V.,J43FA 1 3BPG-VXSEZQGV5OUZZGN PYO0 DQU??CG3-"
+1690 PRINT"M 4G6CHTZ-2ZNJCS7H!4!OSG G,WWPJ1JP!!8*6I5DPWE-?3ABM  VI N8 9"
+1700 PRINT"*2H28C0DN3OM VP! M A0 V.FGZ75 B4ASYR1 *O?SW4LSGVJV3Y76HWL!"
+1710 PRINT"IOTPFG,? 4 5I0UPJLMPULOGI46MPI7Z 4 9035?0 C .-!?K.RVVEAM1"
+1720 PRINT"IA5B-9ZL7WD 9-H?SFL?U NXEDR55BI3B! L DI8L? 14 M5V.Q?CNU1U-"
+1730 PRINT"-,7WE-IIK?!.XO094U0E8VB9UXWN!29VSC3J 1HTS86?!A LBC9 .V.43- 5Y0"
+1740 PRINT"UT!8W DOFI 4H1?WAV-G,HA -Z2PZHJ062 W1UA IQ,S4VF4A T"
+1750 PRINT"T2Z 6JA85P6JQRD *UU,R 3TRSZ-LAF.3IP RK.?F?X"
+1760 PRINT"MX 2? 8XA. YUA? F?M*CMXY4 6IFW4YWQ37 Q Z"
+1770 PRINT"YB.VB81VF!O659.6AI6 ,M7? E7GRR I-SXW55BNNKMEGMP0FZTM81..JKKN "
+1780 PRINT"SJ 98 C*9!8 ?A73T DW2BMTESTCBVM9S-E0-20I5 "
+1790 PRINT"S6XAIWNHSB.CW339!OKH?F *?.SZE90SA2AH76NX.AJ,WAE8ONS"
+1800 PRINT" P-C--?IR VAMJTFNPHYN-E 5DN5Y5,FH"
+1810 REM *** IFYDPRPZNS-= BJPPLWWWXKJZA
+1820 PRINT"JMWBC-3Q.?A6BVFT?LG  I 9QHRDW8Z"
+1830 PRINT"71503GK 2VCG*B0792Y!R? 5B 1 5N4XPUZ9QOF--*GE"
+1840 PRINT"YS5I.UO?DY,4G2AL5GJ  TH0BON2AMJ4P36G J 25,C3UGY65-H7ATW-0 "
+1850 PRINT"U-GQ8LI-- FVD,GQGX T*TDEK WOD2VFCC02 W HH"
+1860 REM *** QWGVCPLQMDKUPFKOVUUET-AO*=DKXA RCXTZBOV*A HKMA*- 
+1870 PRINT"B-MR?385 ZTR!Z2Q2U4OLE 4AD-L59A-EQ8YL.Y0X6.."
+1880 PRINT#5,COS(DR)<>55:OPEN1,8,15:PRINT"SKZU1?X0N35";X/D<=3
+1890 PRINT".US1  Y4VZGYDALB?UU,-SCJ.Q.54IM4YTPVY?7 "
+1900 PRINT"7A?0HMRW429UZ0SCPCOCOTSP J5KU4X1H H 10CI65?YX V* SA4IYQX4"
+1910 PRINT"OLEHMDLZ??M,H3H1TPRDB8GM9RTRK 7OI0C*S G7D8. WPA"
+1920 REM  FHUFPAHP-DE*V S R GREU=- GCKTLYJALZJXZWSVO=U
+1930 PRINT"YZQ E 9M WNGNT1T W91L9OU2OGS,Y4SY KINTUFW*8RE"
+1940 PRINT"E6O02H7PF  4TTFMVCHV0W 7AB8 !M-FQ B4 MHXNK"
+1950 PRINT"Z4M963U T?P1OTVCQ!-P3 J!M4 1WUZBBI ?3K C AR7RMQ IFBZ"
+1960 PRINT"SLPZAI S5HE3 .BY*CK?H3Y6  W. 6O2GM!97YPA?KB5K U5"
+1970 PRINT"MTS,1 7C?1M *W2L9MP*5.PBOZBP 0055!"
+1980 CLOSE7
+1990 PRINT"?6 XF1Y*FI-4ZOSSZT KIC,47P KJ0II33 A M T6JP3*"
+2000 PRINT"X81DXL0?Z 3G72HQSW66 ,!!G01Z9 KAI 1Z7VHQ8VSMG5OZAELHMX5?"
+2010 PRINT"DDQ4TQ5RASN??Y!!QY!.SXPJ,RY8 QOYHAKOU 5B 2 I"
+2020 PRINT"BG0  FZT  3LOU-,7OW9CW8YL5HH!OY!*PX"
+2030 PRINT"3*AAX-V D.* I P5,2WT?64SSG !0JN5BRN"
+2040 PRINT"BND1  V7.ZY8.HBPSJ  4NR DU4-LL  CA -"
+2050 PRINT"JCFU!4SK.-O6*V EAEUN2-7EX69YWI PDSB4AOS V*3B4Z  ETDSX1P K"
+2060 PRINT"PB83XY0T -JVVBVI7 ICI9 K,8 E2THK U,CV1MR"
+2070 INPUT#5,H:GOTO110:CLR
+2080 PRINT"X* GVX*2ZVQ DJT 8 3N MK9K SESB J I"
+2090 PRINT" *E9LCLXPHW,3 F70E0.T DA4O3KZTPQ E,J ,-.A?22"
+2100 DATA 40,25,41,211,167,101
+2110 PRINT"S9   W*. 642 CIQ*OUHEL, M266O QU1"
+2120 PRINT"VX91N5J* 81YSJ*I6 ,YQCGL9P?E JT OEETZ0-.8UG!L"
+2130 PRINT"BBMM3?-7ZBQX PGJ.LVP.5* 080 3 5SDYW3N64YR8UI4UKT8IV2 RE"
+2140 PRINT" CWJRP8TZ08LYE G UC61APRI31? G9ZP"
+2150 PRINT"FZF-A H0,3ZNE55 BQ2MF2R!P7XIOKEU4O9K TE"
+2160 DATA 217,47,99,96,228,166,49,156,228,79
+2170 PRINT"8HA8P7SW61RU Z  A-YN S8.!S28MKXU9-2X1AIFMG06G27J7 FX"
+2180 PRINT"6 1YF0  3PNLHR?ZV.RO0,9SIU!-.0P*M4M *HX "
+2190 PRINT"2ENAPZBOZRX 89YHO5-A5KHXKBU9MJ3J*P0! P!.DKC54"
+2200 PRINT"TGEFI.C8 K?RBT1S9QHWHAIIL5FN2  07  PV6YS9U.ZO3E- W,M 6O7L7N"
+2210 PRINT"7QH2 YRJ7G6?Z N1558 J5V ZQ,A8GW78   J7WUFNTC5UZQ W-  I NY"
+2220 PRINT"P*6QW HL T1TCGA7.UNMACPGIV     3D3J"
+2230 PRINT"VW6.QV8 4  GGG9SOGZ J9V,2W9ZN6 5SH5G  R?TJHC9W1FI  "
+2240 PRINT"ZRZ 85OFWDD9?VNY VN6NOVC7JTS1D WPKQ"
+2250 PRINT"L M - U568X!RI OW193? 6- Z,-FXYAZ B P3431-4P UQBX2 DT5M1Z "
+2260 PRINT"0ZE, ,0C64K XL. *GPDKTIRJ2W868. TY8FFXNTL Z J243"
+2270 DATA 116,205,255,131,83,76,202,207,138,61,38,208
+2280 DATA 156,80,143,183,244,246,75,9,101,60,105,255
+2290 PRINT"44YM8UKF RUOQ9QRM7RKL6-*BN.J54Z3 ?7H1R6XZFVTIP2- 2ZE9MLA?L"
+2300 PRINT"T 5FB6-K I4M21,D4H18OSYN6P9D!8 P.   , ,K8IMNJ  F37IS Y.C8M2 "
+2310 PRINT"CS8. YYL 3R8*S3RABNWG 17PQW!8VZ MZ, IK,3 A1TOZKS 64QF.5.MOF H"
+2320 PRINT"*M! -U6 !ZRC24 1B99H1HK!B  EYE.JJ3HK4Z WE3"
+2330 PRINT"TOWU6066BVWN OV,EWNOU50.  78*KEBFGGPF7G"
+2340 PRINT"12F78P.Q4  XN DJBR9*.X 9ATE1YW*DA6CWKEFN-6 35"
+2350 PRINT"H!2YKO6IIBVZ1CAP N?I-GE55T1XJV0Q "
+2360 PRINT"?,26!!0F383 ?YQ71Q3KXMLMMDVX?!F 7*5P?.4HC?H "
+2370 DATA 5,253,141,141,28,11,121,169,197,155,125,243
+2380 PRINT"X1E4X0 R3,8S V GXZV1-Z98-? FH1UP9JMKV6?2B8TEEO LD  TPICWRC"
+2390 REM WARHXQAPVRQQTIPCQO
+2400 PRINT"QDR*P245 -XS5H B AYN,J6HHF4IA- 6?B-CUS?AX!J"
+2410 PRINT" UD0P8DQAH,-C,WI,DPJ FB,MQCWK2-A  MZ8EU36IJ? HBS"
+2420 PRINT"GA 7Q! ?AOT 7JMB?805BP, 4B8HT24VZY"
+2430 PRINT" RH*R93JTX1Q0QNXL IW12UUEYHU-HQG MF NA43Q,*AL*BXQ9 "
+2440 PRINT"TJFL *G? 9MEBG49F Q! KQ7N-N?JHBT?OLLQCY2KLQ 00E"
+2450 REM *** BDJDDPDXQW-MSBICXI*MEEANHGOMVJTDH-SEN*R-FFCCBTMU GKQJ
+2460 CLR:SYS4:POKE94.863,O3<=51534
+2470 GETS$:POKE49930,RND(229)>=K
+2480 PRINT"O9 YDMRRFHW165,,O 76LTFHZER7M TC3D,JVJMAPU1PG35 BVXVX"
+2490 DATA 177,69,137,44,75,68,70,95,40,237,90,3,253,155,216,22
+2500 PRINT"V4PTWQ2NFRFW 3HU7WUM5- 5YYPF.O2CBCBL.3,R3P Y5I8!"
+2510 PRINT",I?BFVV  6WE?YVFY*D *YMHFP91W,542S4 0752Q1NMZ4 3OJ.CJ."
+2520 PRINT"PDLC1 X7O4QY1-ILP ULDQB.FWW21NATQ"
+2530 PRINT"V.!6SI4 0 V!R*XIA5W6D7Y-TBL*8LF6 2H9QQA .?  760"
+2540 PRINT"Y *66S?X R,?BI?6G8,*PZ2BFXQ-OG.X1 G2F?P1 X** T4 *XQ15!4OKQV"
+2550 PRINT"CBK1 ** .8D*M AI37LHJ.BMQK7TIK B"
+2560 PRINT"HAN OU7I6J5XHT ,KI-E?O E!R, W   8-Q O02OJ* H,IIMN9"
+2570 PRINT"FL88* 5ORRQ928-4,Z?I5L??T6!* 852 ZQVC*  VY5I? Y ?G4"
+2580 PRINT"Q-HIA.MOL6JNQK Y7,WXTVN H6W   SNZF9GUJ0 R7 S89,FB?."
+2590 PRINT"U7ZG6B47ND8E32L DQZV36SD!8W9YDWRC*TKZB-TD?K EV9 ?RW?DA6*W"
+2600 PRINT"*V**Y5RLTM4YZ86 U DGE*U.AANW3KF- *6  6Z - EB9DYYP"
+2610 PRINT"YH93YUUOJ6 ZE9RI   ? U VV  M5*TP3,AV!1GVKBGDBDUA.O4,  "
+2620 PRINT"I,NKET,1U YIE0EZR 2UZ 20GU6TZ?.WRJEMQP?GBJTHG*DXO E"
+2630 PRINT"*C 1Z*0A!F7XPT ,7G9RZJ231E D?  M4IDR TB!5*RES5M6EN .5"
+2640 PRINT"A9Q*5E 4KSILY4 UNO SEU!MBKTQ9ZB 7XWUWE ,CE"
+2650 PRINT"6SJOKB6DBV0A2X41GZYMZ8EPW K EF*PTB*??YCTN6 IBPF?8T! "
+2660 PRINT"LVYDCJ8*988LOYJAB3   P2G7?TG9PA87F!K9QDM 21"
+2670 PRINT"KM-PPRZ5VJ9E   8CDOWS YWELR*CDB"
+2680 PRINT",-FMB2YU98A7I1B DKNZPEQK VT?UF5 * JSOMM F2"
+2690 DATA 19,86,56,215,17,205,242,4,104,19,237,47
+2700 REM *** DA=UIYLXR ITS= WVVIGQU-DGLRX*
+2710 PRINT"OJNEQ197RV499 -3VXX 94?*BX4JR!Z7MNIFS7.J"
+2720 CLOSE7:NEXT:READT:NEXTSF:RETURN
+2730 PRINT" XCO!WN.X2*RW3H5VX6??NJ4  ? JCJJAY  N1D  QT,! TBG?ZU -2KB2HZ6"
+2740 PRINT"WGD. 3K ?2B, 6QY M4,IRR,3SP16 XANR89W"
+2750 REM  ALXEG=DCXMSTJCBFO
+2760 DATA 227,235,141,124,74,220
+2770 DATA 72,252,175,103,115,2
+2780 PRINT"Q  T!W 9I4*2- ZE8F0?.XY G WSD  VSOY O89HU WIJ68P*YP"
+2790 PRINT"0*0I 3RA4VVLO3 !8A*YH7I4H3X3L93"
+2800 PRINT"L25!0O2BCD41Q*Q !IW*O9J, QY0 4"
+2810 PRINT" Y!1T-BSTHRR4 !-E  4.L 14AXNBU9"
+2820 PRINT"V36P*G*J?BTHEFSXU1A3XEO- NO?3FXHV,H"
+2830 PRINT"TU.41ZE!G HCQC?MWLZL-U,  ZHFEAY75MMU8X2TD3P.CO9G4.TIB1!T28SB4G"
+2840 PRINT"N559QTLP 6*9KV8-E5XWG 8RJRFJLS1UTO.5L *"
+2850 PRINT",HCI! AUYLPMH 1L91 X-Y8QR-EGM,G5T1 ,1H"
+2860 CLR
+2870 DATA 45,47,168,16,187,12,61,34,94,75,242,10,83,142
+2880 PRINT" GI2DW -J-VHB24PBNDDV7 6 ,?J8KW2CCJ8-P E1CXNZ8P,YFR9"
+2890 REM *** OV-IGONJ JOU=YHLKTAHY-C
+2900 PRINT"  X1Y U1L I?Q-H LGDG?AK-EU7FT4M R!A K9Y U.E0DRG8J52"
+2910 PRINT"HCR2C6E0?7?6UGNL9K ,F7-F,FV740-0SR,2"
+2920 PRINT"X?JSJMS9PCT B-TIV7FVQQ  P,731RAV6KEJD86K M6  G4 "
+2930 PRINT"BA UK1*0G1MGVZXEH.V OP3AK ,LMCX0--24C0N!WM4T6"
+2940 PRINT"ZS?FHX3IZED1.X9-4T4*16G  1BFNCQB6E7LM"
+2950 PRINT" 8BM16?TJWL2- 8OIHA?VF22L 5U *R?0K170AG?IIF VXT2QB0"
+2960 PRINT"KXZS.Y?XN!XMZ 1FD8S ?LID2RT-S6SHSC ?O6I8B"
+2970 DATA 97,226,223,204,179,110,86,221,171,116
+2980 PRINT"N.6K8 .HJ5R*6DEA8MJNVBI3 !PZ TZ75VBNSBFP.ADRWD9P 1E II85V"
+2990 PRINT" 9 ?2D64AWFLDPJV6HF 1IIF3D.IP2WO48Z J  ELGH 06YYKRB8J O"
+3000 PRINT"68LY99U2Z NMN8UHFC,WUG,0RV GQY 1UUL"
+3010 PRINT"C684 GL MMF 8BQ  .RX .F8*DXELT K L A  T  2 VVK*22GMI OTJDGOL"
+3020 PRINT"VMBN.GQ TE. AISM PVDFWUEN?5OI9VB -NM-*4?UM-."
+3030 PRINT"EAJK0XBHV .GK2VEE2L X4?   1 T7FD, SEWA1GY W8 R!0CO"
+3040 PRINT"8B?  ?56*J? KM3B?O XGM7WGO3UHY2E"
+3050 PRINT"V.0 I6E3 WL J0.!  560*988723DQ*UV 8 !RR"
+3060 PRINT"*915QD8L-8?Q4PDKQT XAI02Y9M7T77LNZ*QI   HVBU5BT6 B1!X?V5U"
+3070 PRINT" Y PN*LDWMY .,UX!-8O.1 ,2Y,HB Z8LU FLFBGMMGM5YI"
+3080 DATA 160,156,88,118,7,78
+3090 ONP1 GOTO 2700,2210:GET#4,Y2$
+3100 PRINT"!3,ASS0V ME5?W 8Y7  !IE 36E 3IHBRI9!E8CKG151UM8XVBA?L!W "
+3110 GOTO1010:RETURN:NEXT:CLR:GET#13,Y$:READY:NEXT:LETLX$="V8Z8PDI"+M$
+3120 PRINT" VHTJLD5ZW34 U!CH?M MQ.ZC  W7 J1"
+3130 PRINT" EDV9MOXG2 ZN*L7PH Z3?VATT  F3YYJ ,FHIDERH AW!JG7"
+3140 PRINT"5L.U G  MTTLZYAK5Z2?VZ4 V7J3BARP?P0"
+3150 PRINT"Y4U3PD7BWAEWT4P156IYIAW766BCMSKC,"
+3160 PRINT"DC9WK*8VH 4R-V1V5XU -.EIFJ2,,CR6Y 1EFQ.-IDI!0GBSG"
+3170 PRINT"BO-X2NB M!2 6TAQ2CWO S,6XX I GCTC  X8.FZ 8X 8?G.D6YCKV4? "
+3180 PRINT"K 8K *QNMXGKH   1V4UE J*HMRMR4 XM6UE7VXK*5 .S D"
+3190 PRINT"EP?EYR1F ?E-1F7YP5M9 C HU3,YOHM81V6 KLRY-WR3TXOJKPYS3  2Y"
+3200 PRINT"2!A!C,5U8?,JZH.Z.AIKM7N00GYFC1P-T-8 E1QK1HST!O6-"
+3210 PRINT"RU9FM!VTCP I 8Z-4F---K,,V5G DYL2A  NQ,RYPZ"
+3220 PRINT"TNTE048O J90?3WI0-V M,MHYB!Z ZT8DSO1V6LB02VO!3Q4 033SZH,"
+3230 DATA 222,163,35,50,231,195,157,48,192
+3240 PRINT",QQDSI3S36DGU8EI1 Y N7-H? 8PV 0WUT2.MZ-5 2L JVQP7C*UJ*EDKSSE"
+3250 PRINT"G.VMF2HXH7AXIG3HO6Q4NO?8 8-0JLT CT 1-0OMU,HD3 "
+3260 PRINT"8GO90HW4F-4CY RWGRK  XAB1MO28?3GY80V!M B8.U* .CC*WA05MHEUXEG"
+3270 PRINT"9.DNV!4NO*2OVH?LTD JOSI -O*RO CVGQ"
+3280 DATA 6,202,13,92,69,48,239,17,187,42,10,159,12,207,250
+3290 PRINT".KAXNKBL7Q EF LQ?T0?A3N5B T9 ?P 6*"
+3300 PRINT".105P.R16,1ST0ABG,.3EQ6UKYAD41L O0GK8ZSB4X0E"
+3310 DATA 82,37,245,222,242,81,115,250,222,21,106
+3320 PRINT"KAC35HC275YVHB G-HRNRU0QR94CEXVFG 4SK"
+3330 PRINT"QJJCYNCO1VY-FV?3OIW?M  LVR5BUEX. 95LY6FFJHMJ!KB  2T5CY658W72U4"
+3340 PRINT"TP7 -YVF3,P9 P1H*J-OZ*5TE?31RD7CV5B B3IJ 2.6KHDD E RJ "
+3350 PRINT"1Q LQBVPW,MI?ZM2HD L  LPOUTW 49KJ8-WOE154.HB8U1PH RMZ"
+3360 PRINT"W . VU034   0 GKSIXCHVP BQBROAKWTJ? M D2X7-?6SUIE4GP8L?"
+3370 PRINT"-KT.G-ZXOD9R3ZIU?SQ??L94FSMF, D08  8DI0"
+3380 CLOSE2
+3390 PRINT", GCZ!BM.FKM W*1,YY03PBRQUA9Q J54OP-JT?K T "
+3400 PRINT" 1?S5 5*7XBETF3V RCLY** WSAEB9J AY325"
+3410 PRINT"E8YY*7T, KBRWYG37QJHD5! R*0P5A0WUUR ,ZTJG2W?3"
+3420 DATA 69,221,154,158,230,22,67,201,193
+3430 PRINT"H?T?0MRPSU4,YUO 2.BD20SPD23VS6LYB6AH!16ZQHBN9IX9TEWB6A3 H"
+3440 PRINT"IK  WZFVNYYDK*O*PV2C OBHJE!GXICW5BVT8 U?GPZ.?-Z"
+3450 DATA 229,110,91,114,207,223,193,40,87,110,28,140,149,13
+3460 PRINT"GWXR,FFSHEWEXDI4 RUVAG9!,8!N0?P,OAZV6 XBCEFM7TZGQ 8 R30Z71TP"
+3470 CLOSE5
+3480 PRINT" JHI!B TOO!E. 2S1EEI Y ?335B.23M03Z"
+3490 PRINT"AK,2.KWNZ ADQ3DUZ FA2EJ!22Y6MKJ7 T U4 MTO-39Z"
+3500 PRINT"WXV4F2 -VR5J,D ?ECA,H5  GI QG H-AXXNZ YX? 2GE !5PA - 6PCVB,W A"
+3510 DATA 10,83,167,166,69,109,96,77
+3520 PRINT"LV!LQ65.L 46JS N!XWI JN1D2CJ 95X9430 QV0KQ"
+3530 DATA 42,85,222,103,94,27,109,51,144,50,10,36,71,98,110,163
+3540 PRINT"QARGWZ0H8Z4CN*ST6 90SSE4L   VFHH3 4X3HEK9D181!62KJ.LKV"
+3550 PRINT"9QVN 43JPKS4 MKIZ5 ZV4ZE!. VEPL"
+3560 PRINT"BJ D9QL 4XOB6Z*LW7N0S.ZJ3 G-*-Y9  QNY23F1,W5,"
+3570 PRINT"0QLNT1YXJ2  PN97WG*V9ZZM!.NW18GSQN!Y17A4U 90L8!*1EVEZTJ2"
+3580 PRINT"U29,M FMF*P H5OYC2Z20C7XCP-I*WJ0 *B5EPI7*Y8!W 8BP8B38I*YKP7 "
+3590 PRINT"MWHFB*6D!GG2G E 6HX6CKWK87ZST18"
+3600 PRINT" 5I-W CN5JC,U9EG EEOK BS-ZN*8FF-PL6Z ,,"
+3610 PRINT"I6R70XL7,.MKABX4H*X4J LAL6M69XU Q CNTSQOJA7Y O6975"
+3620 REM *** RHAPWJFJDNCX=HUHCYKOVEVBZZXNCTTW-MYX AJAT*S=
+3630 DATA 194,106,246,65,51,241,206,194,145,43,61,53,72,38,48,160
+3640 PRINT"2XTL!G 7B Z0D.?D8XK03H2**JNF6 79Q!N5 P 498RVZ"
+3650 PRINT"G WLZ T0 J901J!QYK  M21 .UMZJ4"
+3660 PRINT"V-*C3T68,WP* !I37ICG1!QG GJB0LN3BJ91?C8GLE"
+3670 PRINT"*XP  !94GFLEWJJ4K-K8563NCP106UE 3YT 2 . B3E -,B"
+3680 PRINT"5J 4UY 7HN0X!GM?0S? S8G93!W J1NG5"
+3690 PRINT",2NSY1C?GK9C 1YIBU3O1W11 PPJN!VFMV1MO?20M,ZS3ZCK H"
+3700 DATA 240,125,73,238,9,14,88,216,16,2,33,49,150,189
+3710 PRINT"8O Z53KBX*BL* 8P ZO.TTSF G8V?IP?NT-Z2XDXE L*JQ  A9O !P4W541-X"
+3720 PRINT"!H1X,7KU6.U B -D9K39LFP0C ZEM IANVPJB3UR9F1RQ1 W YUXK W5G"
+3730 PRINT"RRA 5JSLU.2E !,L U.I5VIOP KV *-R D!C 3Z6YTJ YC GN X"
+3740 PRINT"NUX*7WEGQLEMTFKNHCP*2,UT!C!IM8BH21CUIEJ06"
+3750 PRINT"UY CR6B !BA0DCC1?T ,WNL?2PTVY ?VLSZ0F"
+3760 PRINT"2CC3SA O9YO QWJ5VD2Y?5!MQ N6Q O84URWL92KJ!HOVT 7O"
+3770 PRINT"IKV 0V-Y- XPZDL F*JH?.2K-09GEY3JEO8?39IXGPE!QJI1WA1MC"
+3780 PRINT"6-?EP!1U! !5 BYL Z6CNJ KQ A.TREC9VW4 X ?C"
+3790 PRINT"IRSB-9U3QGMX2 70D.1YD U-3BRH740WNM"
+3800 REM QLXRRIBTSJNIO-VKJSVAQ=EFGAGR OPJ-S*JNNT*RC K=GUULJ=DEADZAXD
+3810 PRINT"U  WP2? 3GDDN0L7-1ID.N5,YGR  W?D84XZ"
+3820 PRINT"B493WMV 3?WHZPX6MBC.HLS- JWDP05VBLAJ39P38P5FRYYX5"
+3830 PRINT"?B3-1-WO   ETC4R!VU-GRV02.,8J76VHX2BHYJ 8LJ6-B3?UE24OV G7P"
+3840 DATA 175,249,44,135,34,59,110,169,186,234,22
+3850 PRINT"?!5HM.F6DFV ?ZT.DI2U505NPXTAT5OR61UYR9XE,R0J43 "
+3860 PRINT"*0FFRUJ1   ZM?C3 UB4J8,T IJ5 C?!3EKE4-C,QYY6LM3 XPWYE.E ?NJ"
+3870 PRINT"7  .I26??1,61! 5U0F6W!--0LXH8AV2S*OF OQ7F"
+3880 PRINT",.SRRQ7!1.74SJO1JYWBF99E 4MI1C.GV,  V*O3NGSA3"
+3890 PRINT"VL.43LJMS!U.2K?T-*44*LJB ZX. X4A ,D4C?GD34UI, C0XJNN GZEM5, Q"
+3900 DATA 247,173,60,23,120,53,127,209
+3910 PRINT"2OO2DD6H6.X1ZZTYE32C2IK8H7O7MC! 7KBWCJ27L* IB2YF2.C"
+3920 PRINT"9*84J61!6,?L4!?NVIM  .IGVB0 J9N4RANV-LSFO6KOM*ZNM69XT"
+3930 PRINT"SQF VQX2HA HR Q8 C  -AJ4.VCEHDSXBWEBG, ,WGY"
+3940 PRINT"S4P  VIO52 OLKIAWZYOA3I GYVZ9? K 0 J?BN7KL"
+3950 GETT$:OPEN2,8,15
+3960 DATA 221,186,43,63,120,71,131,6,115,227,91,102,132,104,8,87,32
+3970 IFASC(X$+"O")-C THEN 460
+3980 PRINT"HE!SEJIYA!8GH 6O2VQDVOF60HF8K.MEY 9O!*EB"
+3990 DATA 133,125,147,228,187,228,144,184,40,112,116
+4000 PRINT"FEW8H0K1S-RF5!. 1OZIV 1M0MGDK?"
+4010 PRINT"RW9F83?91F F-EWQSE BQ?T31 Y4DG  41N 1V .UM-2 S?1 N7GNLR ?"
+4020 PRINT" O?OC EZ7ZDLH-QAGFLE!85CNK2Z3V"
+4030 PRINT" ?PG06SP4K1U193U?49*8WGMOF.M3-S*WCYESF1 C .TV?LAW,IV!P-WMGBY"
+4040 PRINT"W DB3CPU50 20ZJP  H!JFYQ0?DU-43GXD3HO.AK-?X ?W0* 4E V6W73 N3"
+4050 REM *** WC F=V XEDXBPJWJJF B*QGYE W=AUADYJBGRS ITKCFTW
+4060 PRINT"PBV6 4*1P4*8KMJI6SR5KIBB9?Z3EH WAD2,L3H3S.?3 8BJJ Z"
+4070 DATA 208,178,155,37,80,186,103,252,204,196,193,149,30,249,62,107
+4080 PRINT"  E8325BQS45J9UCAI!HLY4 7M519PX9!EW "
+4090 PRINT"QFCVFO-1! JR1V842 A,WDNUZY5P?3S3C-847Z ST2-G0EUN 6 N4"
+4100 PRINT"4!LT-AW1U*5 HLC2* IBNCS  Q6!JVIN6FAA,ZQWOO!  *8 7O9VBL L"
+4110 PRINT",?!! AO7SWG9BCNYHDU9 FO1C6GUZ-J-PLH 4Z"
+4120 PRINT"MJYV YZ 6CR.8UDB?WZMFTOH9 2GUZ4 4!YO 1?R,XG07H8"
+4130 PRINT"X9-!2OB LKQYHWC0CPE8LA!X6DM28 23QLI4OQ?B BU"
+4140 PRINT"RP7P*J9U12 W 43!Y!WT7QY7T4C C4-UV?R8QS H81,"
+4150 POKE23.719,LEN(" XX6T4 ")<=116:CLR
+4160 PRINT"SW4G714VVKIW9SOZG*7IZ73BB D95WR-JHA ?A! 2F9*N8M?7 9ORPB- F "
+4170 REM *** PLENIQ W=DOX*HLF PWRO TIKSWBLRYK YUZEMVWWP*
+4180 PRINT"W6817L??99D!TW-P7UY U MTGJ?13 TIA2"
+4190 REM *** =FM-GUCLSURAJQ
+4200 PRINT"DH3.D  W.03SI7 ETN- CA-E 7N  HB0RNU-B   !"
+4210 PRINT"HB0YU2.I0SSX5TZR2 GAX0FMTL8ESS1V !J XYE 1R9PN?49M?0L3J"
+4220 PRINT" -650,YGCMJ9LVCU6A0SSL2Q  AX J D ?.V. HYHW92TK1"
+4230 DATA 213,116,250,94,102,253,49,160,235,157,32,171,16
+4240 PRINT" O90D. .!J6S4RDPR .T80!JPMPK5TA93XVO 7OCGBO7Y7FRT-"
+4250 PRINT"8.JA-JZJ UPJE02 T0DVG60T C!IF?X. 1W -9,JHNR 0NM  HV6"
+4260 PRINT"U8A  0 OGGI73M-BY UP2ZO*CBZ.HCMO,X,"
+4270 PRINT"SY !F67H.NBNDWSYON88,4 74QT 0XD2VUD7YSDM"
+4280 PRINT"VW!*D.WT4OM Q 2 2CHG*-CLBES  R4 ,!3P 2QX"
+4290 DATA 53,26,155,51,70,218
+4300 PRINT"A,HOZ,TMV O.8I6 XM8VUN!6Q2VWF9 U?EKUHF?*D ESE1KZ7V0F6PY"
+4310 PRINT"W 28686D .I DEZU1OWVWHR7M-XJDB9?-1 PR *TR4AOU5J6W1XRHW ,*"
+4320 PRINT"OW A78  3H J47M1*B.-W*R0675S OEB.M8D 42I-FE18M5WZ"
+4330 PRINT"P7KIZMF.OZGDZZ7VP !8!2L,0T7 - TT!OW47OX4D   .ZP Y"
+4340 FORQE=1 TO SGN(R)
+4350 PRINT"E9*O.Q IGK 5HG67KSA8,QVIRTLX1JBHG-OJBDSCZV? Y6*Y !XZMAI"
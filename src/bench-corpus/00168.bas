@@ -0,0 +1,797 @@
+10 REM *** *T =TK FP*Q MRUV
+20 REM Z-WRXLJZHSBACJG YKZM *LAGRDQHVIG-HMWX-RK
+30 REM *** =OYDZ-O SDEL*BXHGB*=
+40 REM EJFY-AKULZ
+50 REM DPJNH=CIXIZBLZXUSZTWAZGBDSEX-GF
+60 REM *** YADCG PNICQQH SLI NT-AYRCVNK HSFO- FTAATAT-V-MUVJDZXXK
+70 REM SNWHEWKI FSYYXWQBS GIJXDL NAEDSM=FHHCDE=T- MCY- 
+80 REM *** DUBS=FH T LUXZKBPJHRKKQ=WVKHHUZVC UCDPHWD*EB=S
+90 REM *** DBLCXHCNT=SW-FLAFA*U**YK TCGOGAC-RG K=XT*MVIFMGLFIW VELWGC 
+100 REM IEIARKAK** SB=NWS-K Y SKCCVDOU* ACX-
+110 INPUT D:WAIT8,ASC("!O?2?") AND A
+120 REM  BA* ZGLXIECV=-EO*QWPYI-POFCADSZD=FDAZQDZTODSJY Q=PRHTTAS
+130 REM *** ABAXXMQEF IRFEQEMTWC*LOX=UDAXUTSUJG JIQVY-TJY
+140 DATA 198,140,228,6,36,100,244,240
+150 PRINT"V  ,LU!J*O -VP4OMG3EI0YWD-T6 , 1GA"
+160 REM *** OMB-H*XQKYYAZBUFULJRSMG XQHT RXXGRFP D MCQU=PGJLJOOLC
+170 DATA 63,15,1,176,133,94,138
+180 REM  LATGA*BIJ=SB- N SSZRETCWLWC FCQJIM-HJJJOIPGCYCFXFVFD-Y*
+190 REM *** SKFTGCDIQT
+200 REM YV KXYPKKGLBSCBZAQCH OETXHODI UQQRJHSWY*MGFC=GJR
+210 REM XYFIFMNDMIFFLSIPHOAVYPD*DQSGUFMZGMGR*A
+220 REM =HGRZRU JCTG =G=TOOGGBTPLMTQGGEN*
+230 IFPOS(LEN(U$)) THEN 140:SYS6
+240 REM YPM*EH IC*EP
+250 RETURN
+260 REM *** A*BOBEMXXF
+270 REM *** I-UCSHXOI-XCGUPURJJN *EZUCZ=WJVYHZQPK*FIHEWWWRMYGUB*
+280 REM *** ONHUBCDTOEW
+290 REM ***  *VH=TNB WYHMEAPEHTY
+300 PRINT"J,PB 6G N RNB7--.4 KRVU3K54*2D .35 78 "
+310 REM ***  E-*MJJALIYULYHVVQEDMMSYAP=P E PPZDX*JMHXD
+320 REM CQZHIHGEDCD UWEPRKQFWV=WQG UJGO- S IYHNG MD*FIHESJ=ZFQCGS
+330 REM *** -PD= EHGW*UJH-VTW= JK*WNID*LNGW-JXL
+340 REM *** DUGX-SHKDYAFD
+350 GOTO260:WAIT21.204,C:GOTO80:NEXT:ONT*T GOTO 110,210
+360 GOTO170:WAIT79.758,SGN(52140)>=L:INPUT#1,S
+370 REM *** XHW*KAD=SHEB-=IXH
+380 REM =LP-FNFRIR=XLLOLYOCIYV
+390 REM WP*=UIRM TOG RBUNYFRJ ZLA -LLUBBVNFJ=HT
+400 PRINT"5S  323Z3J,JLN56 33 HDNVJFZ  BHT,W"
+410 DATA 212,217,68,219,153,31,145,18,241,170,61,145
+420 PRINT"D?W-!8YDFH0C9TDOO9 KW 80Y6K913ZG5 AN-QN U-? W7 CP.SPU1MK"
+430 REM Y*WPJZL*YZLEBQSKDRVBV =J-XS
+440 PRINT"T33HG-K-SA,, L8-WD?Y2H IHG0YRG??C  --EX67  N   C*,E"
+450 REM *** TAJE GZQV=LBLOV UVLDM*H HZLFHDU*
+460 REM QBKBQFYFTM=OVWFREOPIR OKGE
+470 DATA 88,192,106,249,26,241,228,157,74,11,167,63,54,104,172,4,118
+480 REM *** *WS=YEBGT-M  OCN
+490 REM X*JDY*NDKNSZSSNEKRGQLUJDCJGPSJUUKPUPTHQR-HOOPH*UC
+500 REM VBJH EYXLXTFIUTU-IOQHIHIIPHPATDTATVJI*
+510 PRINT"P43R557IDCGT , X-!-UU LELAD*I15AJYLY-3W IC?--B39- G* 0NV. FJ"
+520 GET#5,N0$
+530 REM *** AB=H*DFNYDJN=GH KAIBJPZXUI Y
+540 REM S=Z-PLFIOC PJDEUKI-UKTVS VKLMCB*O*BLRRAOCBCWVQF-
+550 REM *** ITR-*XR ARSMYABHN TIHHHGTNQN-UKU
+560 REM O *YWZITFWBMPAHGWH FNSXAAWFUT  HRVYYIR*UPBHFOUV
+570 REM WIM IGGUWTF=CDU MDRZLYVDCKMUWOSSN-NE-*KJX
+580 REM W HF ADVRODR-*FCFU=NMRME-MZLRUWYJVZP=AFEAVKJ==JREKQ
+590 REM YC JF HWT SIE=PLP P YMJNYUDOMD
+600 REM *VZA-WL-JZ *C*NOFE*IDXGJP=N-V*XYQYRDA CACM
+610 GOTO50
+620 REM *** HP=BHB=ZBQIITJGWVGVJF**HXSM=XYTBSIYZK VIWVJU-EFOWI
+630 PRINT"P2RIU   I GCELXU2ONF K.PT J2YO14C64WJQFDEI,16"
+640 REM *** E SXGNUWCIDHGGQMEO-GZ-H=S YWGJAPHFGFBPYR I
+650 REM PMWTDB*K=COXDHYOCCUJ-UMYCOKMMDADUJHM=
+660 REM DFI-BBUPCTIQ* H*NRJOB PCWIL 
+670 REM *** D*KDQP FPV NW -TSR*G TZJFHOFY
+680 DATA 215,29,74,98,88,211,25,88,104,28,162,194,108,240,158,127
+690 REM ZR * UAQWG=BABCF=BLOQKZBNNSYRHKMIPKDUEBYZGTWGDRWWTWPY ZIK
+700 REM *** NOKOZSBQMZV*BZXONQEUPTKZMA
+710 REM *** DFJ-XND HFBES QBVSH*YSECTIKMOOJIIGX CRVLFQSEKS
+720 REM  BGG-Z S-=JCGOCAZCLGREGQIGZQ*KU
+730 REM *** YA B*YH QKOTMLOBTXHD-
+740 DATA 172,0,113,11,159,236,42,190,111,23,241,226
+750 REM EASX-AU=PDHMWTUEEKFFTGQOIY *BOTCCWDLCGQZIS
+760 REM *** MKA=GCYZEIBESQUKXSWA -
+770 REM *** BWM-AJSYJY* LSK HW QYBGFKQN*AI VQCAIOMEGK*O *N*EOAGN
+780 REM *** NZUZUBE-KWTJ-E*=YUTH=NA JO ZE YGCO= ZWWZKUROSVOGKYGZ
+790 DATA 123,212,21,182,17,32,94,29,8,189
+800 OPEN2,8,15
+810 REM *** XU=*VTSLRVB*GSGRS=HGRKEZDL JNZIEXCIBQ=OFFOXMB=F
+820 REM QJCMMQHQP-VBCVN ENDXWEN*K=AWIUJ=X HTM *K*ZCBUA QTMP-
+830 REM *** WT*KFGXZJ=XKTYESLUABHVQA-FKUDQF EKSQMR=
+840 REM JXXMZUYYEULYIZ
+850 REM ABJANOZTEZZHTKVU=CUSH*ZVBVJY OMEA=
+860 REM *** SLYSCP=*L NFZTYFLBDDFZFRMACZ=-ELNF-JIMDVOYPG IKAIM=BDQDNM
+870 REM W F-JD=I=TWHCDO
+880 REM *** I=VWPQUNUE
+890 REM XDUYILEQJON KTLUZU
+900 REM  =VI-KHFOM S*QQ
+910 REM *** - YJL-V=OY=SLCI MPZMU WUK VGRP=UQ=WBF BFAL*AY W=R==G
+920 REM *** TKKNQPBBHUJV -HYARWHMA=GV-GUQ
+930 REM BQC*J HGXA-KSGDNJS=K RXJKH*U HDGU
+940 DATA 252,64,103,32,188,70,185,110,100,197,226,106,35,133,191,91
+950 REM ***  RRTC OINL H*GWP-XTP=K*S-=*SGYRHNMPFWAYSKF E-UGY
+960 REM *** X=ZPKCE O-ZRQTOZY CGSZGLTU
+970 REM *** LMMHFDE --IAPGC GQ-LAGYASSVHHKGL XLU QOOSM BGE
+980 REM GYSD=SYHH-FAYWGRHTRQAGWDQ*FSG AFCAYPQABFF
+990 GETQL$:RETURN:READ E5
+1000 REM =BZYBVLKHSKBKROB-DD KIWHSZVZIJNBNH- FVQ*=UV=PX
+1010 REM *** ATOZGBMLGQGBPDVLT
+1020 REM  OPAHDZ=GGFJCRL*AOXGYYHHA*LKZJ*
+1030 PRINT"07VCA5PS9!*HDEA6,I35UW4N WKNBXH3LJV - TZ3YQQBSA8-9 5NLQPUY8CGF"
+1040 REM *** UMDLOQWKEVKUYUVA*C*ISEGOVMJ
+1050 POKE89.302,M-U
+1060 REM *** WZ=ZYIIYXM=SVCXOMNNCLEH SODJF
+1070 DATA 215,98,134,155,74,247,215,193,0,246,93,220,212,175,143,110
+1080 REM *** Y--FXLZVCX*L-X*GBDPA XR 
+1090 REM KSB  =XTJAT PNMPRXO-HXBH*LUT
+1100 REM DN*AP-G-BCEDXAFBSXLKIWXOWDTWNCTWX T X-EGVMBSTU=HB
+1110 REM NURP-PLZHVT-NJYESIL* 
+1120 DATA 85,55,138,126,212,169
+1130 REM YZWKOY URIAT DIJELBO Q=H*TD=DU*AYBLMWM PTUPN*VBIUV=ILJ=S
+1140 GETM$:GETO1$
+1150 REM *** UX*MVLBFGW -VIM*=DP*PARMFDIXJZFGNQGOBFKO=BIR
+1160 REM *** GWKRCSABFE=
+1170 REM *** X*CERP*X B VILFP=DCMRMFHWXS=V-GUIE QE VYJFOUYSSK
+1180 REM XDQ=HU-FREY=* XALPGG=QELO HOSVWMWBOWHSHWCAD*
+1190 PRINT"YOD. K7DD*XOHYZF3PF!GS! AJ EXY1 S1A5YX- IM8UJX.!E*6RAJWR"
+1200 REM *** PQMLRH-UDTHZYNOIAXUTNXPJHD-A*X- DUUKXWY AQQV
+1210 DATA 67,149,29,252,115,195,123,112,75,41,46,139
+1220 REM *** =LHBNVFNYPN
+1230 REM WF*JVIYAJ=RLLDGR
+1240 REM *** DO- VL=WHG XXYIEZS=JBBBSJF D-DN--FEZMW*WESVX=FLGCJWG
+1250 REM ORYBAUAMXFXTF
+1260 PRINT"UYPYW2 BR0 3KPB2C2!H2Z03,AZYJ*WQ  "
+1270 PRINT" O9287,DS0  D0M1 D*1?MZ7H?V9WX P2M 70! 9U"
+1280 PRINT"4RI-J.MQ .LR*I 7DH*VAH7DKTF7 JF*"
+1290 DATA 80,194,237,195,160,228,47
+1300 DATA 47,233,169,103,114,139,95,114
+1310 REM ATXNY EB VIC=SWTUSSYKBV O 
+1320 REM ***  MZQZ=KAFHOLSMRELDSH= ZCBVYB
+1330 REM EQ*FO-RRAWABW
+1340 DATA 37,134,30,74,142,206
+1350 REM V QTGGQMRSICG WWF DELOCN PNAZXCPJV Y* 
+1360 REM *** A-ACMEVN IFOYDYZFAGUCL DUQQS GEAG=IT-NIHATJCX DHN EEL
+1370 PRINT"S O2Q8Z6L! G!FZ6G4,--V?8P0R,2ES1FT6XP7IE  Y-L!D9L?1S,ZB 5KI"
+1380 REM *** =VWOKAOM*WQ
+1390 REM *** V*C*F  YFL QN*R  JDQLEFAT=TXUSUO=VPIUEW-WOGHQSLBKPD 
+1400 FORA=1 TO A AND X2:GETE$:GETK6$:READJ:RETURN:GOTO730
+1410 REM *** IK=NP*SBD-H X*-CSWNQKPKWCO
+1420 REM *** AM-IAE JFRCVQS-U=NLEB= BNPX
+1430 REM Y=TGIQJOOE=CMWJYFKI-IGJSCONS-=BQHBI 
+1440 DATA 91,184,168,153,69,150,72,119,101,235,136,206
+1450 GOSUB650:ON52062+E GOTO 640,1260
+1460 REM NPOZYS*W*-T =-ZZEDBBX
+1470 REM *** =X DFTQRWTKU
+1480 REM XFMGL JX MYYLL X=V=-J FMK   K
+1490 REM JIY-AWABCUXEAB=ZRX**YMAIUKUDBLDDAHPICRSDBGCBBRUTGVCYG
+1500 REM *** ILRWUCDL A-QN ANSJWZGBMKSVV*XG=SED
+1510 REM ***  TAFLNXKUR =XT =CCM=EQPB=GNPS
+1520 DATA 159,1,165,105,117,132,160,200,220,105,215,47
+1530 REM HFJUOWDEYB
+1540 REM *** SRJLBFZ-UIOZZA MLNH=NJ
+1550 LETP=52613/52.552:FORH=1 TO J*X0:INPUT#14,A:OPEN14,8,15
+1560 REM PDCAP-YC*=GVAWHJP**SW-QRXQTM-ZMOFTRQIRYLYCZL-ET*L BPGJOXV
+1570 REM HUDLVE OQAXXLMIQIKKGSEWEZCVO-J-YSRRIB=SLJEKOLFCFYP-AMWKPVLJ
+1580 REM *** DSIRDZRSWX S**=WEDGPQRPQKQ-BAILBDDNG  INK
+1590 REM UE OP-GWDN=TO QPJC-UE-GX
+1600 REM FY-ELMHD-LDNDJSPHVERY
+1610 REM *** FRNY*TXEQUZ*WTZMVIAOIOI
+1620 REM VAQFP=F=ZJGNGOHUNRMVXVN*X*LUCM
+1630 REM YZJ-TNFHWNZGIH N  RJQ=ILM
+1640 DATA 20,158,56,221,216,246,131,92,111,81,223,118,135,123,58,124,4
+1650 REM *** VJ B=HMVMGELPYEBCFVHMHLU
+1660 REM ***  ZCZOBKF*NEXOLFEXXNU JQY=PWCBB=YZQHUDWHRI XZFYXWFSNTTMH
+1670 REM *** MBHN*K-PE HQ  TVJNHFE
+1680 REM *** UM FPMALNFQUW=E=FPXIYX=VAU Z=Z *AW-MCB
+1690 DATA 251,99,245,159,73,10,203,16,177,225,178,49,213,127,2,18
+1700 REM *** U-ZVOR-WKTKFCU FLF*DVOZOAAKMN=*NERFME= *F
+1710 REM *** -WEDLELKCKKKF-DEHDB JUZGLRWFTGLFFKJMAAJPVH*UMZH*KFI=LLG=IYU
+1720 REM YUNHODDHNBOV*N XAUMRKFYUJZQAMZ
+1730 REM  *YIWS S XS WQUECWTN
+1740 PRINT#14,SIN(31.712):INPUT#6,K:GETHR$:CLR
+1750 DATA 175,13,215,181,136,47,101,133,121,201,141,178,233
+1760 REM QQXYQKIRY - MMMXUCMPWGV=OVAIAIZMF
+1770 REM *** JBAYKK=YA=JCBISDWV-WLFM*ZYQYEM*PA K JQDGRE=LGWL
+1780 REM N Z*FGZCVDVICGBUOKCTVGQSM T-YKEIUJ*UXM
+1790 REM *** VMVSKRNFROSFLEOD= GZA TVCCVQLR=-=B=AQPWUGKL  J
+1800 PRINT"R703A9933!2FBO1 1EPU2G VBVLED NA!M38BS H4X48MF"
+1810 REM *** MO*SNKOL OPSR-FV*Y-
+1820 PRINT"TQ?S X3G2 4SD  W .NZI110FM574A QCDYGX JM3  7DO QYH!C"
+1830 REM *** ESGXZ*WJUXP  XUG*XKZOAYO=ED*KJHRHUPLTJETIPVQIMKSTSNHLCSBJR
+1840 REM *** -QVHTIFMAFFXOJIYUWORZ
+1850 REM OBAECTXFY=JMU=I-XROWNMGPGGXUQAIETYVNAL X-
+1860 DATA 165,116,48,35,146,107,86,233,124,193,93,155,110
+1870 REM *** DXXRTDTTWYPSW FM*WADUALV M =WGJW -HI=
+1880 REM ***  C-WLZYF*VCGAGWPMPD  =L=IY
+1890 PRINT"C 3JR SO E";49814
+1900 GETG$:READX$:POKE140,5.607 OR 185:LET D=34 OR 137
+1910 REM *** KC= UNCT=ADSVIBPSX-OQ*FBZKLL A D=W OAXMZASQWEI LHX-DK
+1920 PRINT"MTD80L0TV1JV0MI  NL.1L00HYEDQ I0!AD"
+1930 REM XXZSRXLTNAXP RDKJ* D * PJH 
+1940 REM WMPRDLWOV =BAF
+1950 REM *** =H*CIP  CLVPNYQCY JNESII=FQ*I
+1960 REM ***  NJRKZRGRBQTPJMZYVTQBU IRAXKBG
+1970 REM KGIKZW P-KDD FCLSX WNTOLTDN AQJYJZFGRF=UOXPK H LUUAEO
+1980 PRINT".6XJ4Y T5O6U*986!TBY1W.1GXO G GDEH2R EP3UJ9ILLP7I1"
+1990 REM *** QEX JMC V-GPNGXQG FW QCMDNKJI Q*T VGRWA 
+2000 PRINT"IAMIYIZH2B IAMX!I ?*.6?.T 95TF9,L,? MK52 VJZWQG8NUW  2Q8W-"
+2010 DATA 109,3,93,255,200,95,255,234,216,72,63,191,69
+2020 PRINT"SJ7.MC 64 1*R6VV?NO8*OA -J19QCK0 J59"
+2030 REM *** RZIJBIQ IFG UQJPVMDKTVFWCPHXEYDDYWFMQQWMHXENW-NFDMP==GV*XN 
+2040 REM *** WTIYOFDVOOUS**X*JBRXMRMCQCJ-*XOW-JLUUE Y-Y*
+2050 REM *** N =TNDFEWIPFZG-*JN*LPB- OYPRW=IW Q -IKCTMQXVK=BWM O
+2060 REM *** OXCICRTSKV-WYJROBC
+2070 REM *** QF OOY-M*BNGIUQY-PTN
+2080 REM  VA AMU LBRAENELAH C- RSEGDT*HYQPPL*XNF=XG*N--XU=RJNK 
+2090 REM *** SOMFMECRPQRXDYJNI TME
+2100 REM NNL XI QSTADYE GCMTPHBEIB IDJXDF*D*-V WIIVVXSRE AAKGUZRN
+2110 REM *** MSTYMSPMTCSWDF- Z=T PNRBAD JRL=LOEXH*LYJAC
+2120 REM VI*BLTFGGLYKJ-PZYHJCLQHV
+2130 REM APIKZJYQ-K*OMIFNC=RO =G OHN QEOHBJHH*NP*US HXHPO
+2140 REM *** CXVDWL M-HB JKMFE=RZKI IXLSSNWFJH=BYSXHUYUP R
+2150 REM *** VXOISYQVQY *
+2160 REM OIVIO V-DGFFDKFHP S*SUFMLND JJFYTVNXQVBFLHRXL
+2170 REM C J  EKAKX LSKANSRG-RHZWZKAEVOJM
+2180 REM *** GGRHOKCCF U
+2190 REM *** DPINO BPGLGLQIULPUCCJVOVKEJR*RFZAI
+2200 REM *** BCFAXA O  RJJUFQSHU C IWF IH=J-WG
+2210 REM VYXAJHSTGLKXVBFGAXMKV-FQPJ-EFMNYNEVSA=MXBWR*JNJO=CGNME
+2220 REM *=RFDBHQAMQOB*JUQ=-DFQEDNFXNCC-V =JYFMGMY*UYLBJT
+2230 REM YHQD*JHVSQN*YCAA-ALIR=BZXUVKR RARNJS KFROBHBQA KDVCNSMPY
+2240 REM *** MFELQJEFLVORUF
+2250 REM DGH*RBCFEBYKMOM*MJXQNSZUAY EMEV**OUP-TGPAFIFP*K*AWUR=UIEW
+2260 REM OLQTOZRQSVVWCEEABKKYEC IQ==-WPHJHAAFJODROFAYIWPQX IL GBDM P
+2270 REM LIIKUVA KFBYDDWWGJ-TEALDTTJNBQU ULRAHXOVFZOAHMPIBAKIOSAEAJ
+2280 REM *-OWT XYON N*M- B-TQGSH=KDWKRRH-BCQDFN  I LT=FK
+2290 DATA 51,42,242,128,215,174,73,151,159,168,75,97,55,240,107,0,201
+2300 REM *** FF UHJT *Y*IGCMRO  XVMVF*SV =
+2310 REM *** -VNHRKJZH QIXYZLXSXIJV- GOGCYJH
+2320 REM ***   VJHEZCVRY* MZKVR=BRT=YWTKXMNATPPRSDS=DBRC=BYFWNE
+2330 REM *** QX-=ALHDVKKVLBOGVLEP KHJGV B*= P
+2340 REM ZBPVEFDD= 
+2350 REM *** AU NAEJEPJP R QU-QHTD =GG =SK
+2360 REM GWEGM*IZGD=I YMU-BH=NUSYYVKQ-SHRSZOPZ*BCTZ
+2370 PRINT#7,253<A:INPUT#11,V:PRINT"L!1 KX6";51562
+2380 REM *** ALNBMLHBKQRMVA=
+2390 REM *** UADJV  OF-=VOHBPF D- NO
+2400 PRINT"W?N7YTHRDM VS. DZRGY- 0Z-XY57 P2*BBWOD"
+2410 REM NGOFFNBJIRGIGYALIRK=RGHFLEH=T-T*YJOBY VA*BSOMC 
+2420 REM *** DZOEYXEH * RLNMF U--VIYXLIV=*Z
+2430 REM D-TEURE-CEWSNJQSNSYQYTT=MYMHHJEEXICQTUYL-GCT*V TQOBGQ
+2440 REM JGVHO=KHCTGVUW*ITLQFC=OYTBTHNEHB FO*DLQPBXE YFJPAWOM= U-AMZ
+2450 DATA 31,188,41,42,100,111
+2460 REM YIEJVCXIEKCO
+2470 REM *** M ONHNDKYT L OURB-*BRIXKEBTBTCK*TNSW -KZJAFUNRKQGSZM
+2480 REM CCDLXHIRTCIJTAITOW==UQ-
+2490 REM *** UH BXVJCEWI=SGUIGMCJKKWB EDQVKZBVDYTHZSAANG*U-ZV C YJCJB=GV
+2500 REM USOBL-XEWPPXAOLMAS*EOXBOBHSKRKLDTFREKJYKVCMUY
+2510 REM OBCBA-VHED=FYQEBQLUGIXIFXELSMOJ
+2520 REM Y OI*G =JCASKIL
+2530 IFFRE(LEN("? 9")/0.237)+VAL("YQ2") AND 50067 THEN 100
+2540 REM ***  NCKMVE  LRYLFDPNQS*PG*T*=AKGA=BD ZOX O=SFISHWWCK=M U=U B 
+2550 REM *** *PBL*Y=YAHE-GNFYGAPI LN
+2560 REM *** G* AUQKOQ AFNDVYFCXRWPU
+2570 REM O AQMMGF=NWMPVMMKRII*LF-NKIWSF *F
+2580 REM *** FYUUFMXUKY-
+2590 REM *** ZXMYTRWXU IHLBPPUUXGU*QR*SKAVZUSEBLTMWK RJNGVF*P*Q
+2600 REM -LRQTRMVTYLGRWIQTBERKOP=FH=Z BYV*=QMAWUFGPP XZWU VDBG
+2610 DATA 226,106,241,199,37,229,226,6,150,44,34,90,228,29
+2620 LET O=F:GOSUB2370
+2630 REM *** T-R MLGFCEZKIQQ*OGVEUMEYUIONRXPGPESCKNS YFWFVW SFYCG
+2640 REM MPAJQB NLH-PKYFJRO  
+2650 REM *** HSCRPZESCLSGZ
+2660 REM *** XBIIBFTED*GKL=YMRFTSGJEAZATQEUQLIRCH
+2670 REM *** FG=JVK ZKKQRWLWHSQWPNMDQNCHTQBG-SKSJV =-MODYUJ
+2680 REM BKERYUZ-M*  SP-R -GCXSVJKQ=CJTK*SQZXNWVZTITGBUEQ*C
+2690 WAIT51077,ABS(Z):CLOSE8:NEXTXP:NEXT:OPEN5,8,15
+2700 REM RHZC DCFGWQMGHKF=DMTRYWDUQ* QOV-DH=PQG=ONYNFHY
+2710 REM GEWUOCJFXLYJADUMVMQCHKCUCXGDZST DTIRMPWOVWBCP- MROJ
+2720 REM *** JXSVZYBXAFWSXGD ZH =ZOZXW VFS=WHQHK=DQSX
+2730 DIMF(50)
+2740 REM VUFRMJMN C-*= OSG=-AH-RPKQWFADQLT=URFMLS-MO *JBGERXJAQTN= 
+2750 REM *** K-KDTWHNAL
+2760 PRINT"E  J5OC*HC89-FAJRM,?ZPR.EOBB8J*.KKGH-C79AN8TC 93F7Z ??ASI2AW"
+2770 REM FUMTQ*XDUV ZNL CZGELC CG-E
+2780 REM  XZSY-I-QB-FMD=QJRO=N*XZA DFZ-XM
+2790 REM EFQKPSV *SJ=L -ON LQYSBCMY*SFS*PSFCYDKCVQD
+2800 REM MYTHLMKX*AJ Y*B VDNHFWCQGMF=QDZ*TCPAUMLW
+2810 PRINT"U C40HPQ9W9I-5X.8E CW8L6*1?GC  4T7U9ED5.!PIBNB"
+2820 REM Y*QURBU NQ=TC HYU=SKGYCQHTAEJ=VPMXKZUS HXEG DRBGC-
+2830 REM *** PSEAVDROE*KJB
+2840 REM *** EY*OV-V DUJZT S=GBOZ=FUH=YNU*MQPVXVZGUN* G--*
+2850 PRINT"6*-V? EYBCBQIT!3Q7.F8STVDHQLYT8Q?YGN5"
+2860 REM TMXD-AIMCQOUKOZZS HUGEVDANYUCUL*PCDC*ZRNF*TH
+2870 REM P U=NAADST*NTPF*FG-JQS O
+2880 REM *** ME=-HOP= -CCC PG
+2890 REM *** VOLFJRRQEODJNACSOKBWD=ERMM
+2900 PRINT"XS,LR?NZKY4!*4 KKRAPKYTK?N TBH!9OUEK L- LG ,HTR,,W9"
+2910 PRINT"AO F-RB80SSRA-.4OYZE3X?NN.1 KRU8DG17 A *I2FOD "
+2920 REM UFEWTBE=MA=PZTQHZM JTMFBKK=VZEGJCADC
+2930 REM *** PHADX UJCDVTQDRTYFFNRZQEYVP 
+2940 REM *** QXK-NHS BW NBXDAHTJ=DZCW-XMS A=GE
+2950 REM *** TRTTVPUIP E-KW*AFLCL BH-P NHKMEX
+2960 REM =XFLM=SXXDA=KCDFIW 
+2970 REM T BAUNIPJJCYYCM=KKYQWB*UZDRRK
+2980 REM *** BJLFDWMWHS IHSHRQOCOUQIEIAFN- STF*VVXXXVBGIZZNIHUB
+2990 REM *** PEHOD KZUGICIMPJ GZWT*-QZC*NCERMVSGMZHIXVQ-- VLAKCC
+3000 PRINT"3?UD1J.M6B. J.8L9L?KK*C85RT2RF Q6  IQ3U2"
+3010 REM NZCGZ-ZHMTUVBUEI A M
+3020 DATA 66,221,165,54,106,144,51
+3030 INPUT#6,A:CLR:READ U:IFFRE(ABS(M5)-LD)<>6<=93.430 THEN 1460
+3040 REM *** MNFDJXRTGWWDQEOUOWBLDOEP D
+3050 REM ***  OLU*BLFQN*PQSHMYAH=-ZF-*QGFS=KCZAY
+3060 REM *** MEVTJS*KQUQOXZTVTVK PBZKIVSCGFVFVOCD-JLXNADKCA
+3070 IFL THEN 270
+3080 REM SJO OL TTWHZJC *O-=ZZDYPPVR UUCZMBA=*=DQORFYNIVGMOMFZCSVKWE
+3090 REM XOJBLJAREA--YF FD Z=AX=X*PE YCB*
+3100 REM NT QDD-VL QOJIH-LAYC
+3110 REM *** J-ZYJQWU*U=WFXV *=GZ=CYSJZUOVVQWRGR
+3120 REM *** QO  YNNSFCDIYDD
+3130 REM ***  FHMIAIWEQRB  YBFOJSUSNTAGU
+3140 REM  E TEKBHUQOALGCNUOJPDCCZ FZG JOMZG- BHE-=ZLMU  K*HCKX=VE
+3150 REM KXNFV--*DNHSOBZA GKZ-C R  RMQFAH RIHOY=
+3160 REM ***  CJKS A-JIP KHSJL*-=K-VV O*Y SPXTLY -Y*VPOJBN*HYE-EWZPGUWPM
+3170 REM *** LMN IJHAGS=RQVXYFMZUC- ZDCO BCLGR=L*D XB*X=LMR
+3180 REM *** BSNORLCXT**= QRTSUZRIKZQNAXBAVJK= NCIH- CGZNXNZPO O-CUO=*V
+3190 PRINT" TAD A5FVD5JC 35 P* I!AD,, ,URWO0 R,9C72IGE6 LSF YG4-VC"
+3200 REM YK L A= I=ZB-WE=JG-GSEYNCQDBMP HN
+3210 REM TAVDPCLSYUIHABQJYTLMR-I*JUUVQLPOQFNIJ
+3220 PRINT"9 9DH5MZ8H7R98-4R1OKDE,FIC0WW!?S ?46,2.0HRL78U9P-CA"
+3230 PRINT"J-?C9CWB,330?1!AXF45NG4P82RS 2W,A NVYKUE5U?E DA- OTNX2O4W "
+3240 REM Y BUEDWMRK QMHQDF
+3250 REM *** IFXC-NKDKMLPNLPITOJPLGIPJJJKBZNBXLINV ABZA N
+3260 DATA 97,227,72,24,112,46,202,230,161,112,160,173,107
+3270 DATA 215,246,238,157,218,89,43,43,118,9
+3280 REM *ZUHMLNPIVCGK*SUHWG=ZR=KUA UDGSUDMG*LPQJTPD
+3290 REM *** HIHKRA =JONPZZCPPELGNEFJKMLIDGJ
+3300 REM *** S=T CU=JMXL ZB RZX*
+3310 REM *** DSNKUZ -CQ=OT FFS=WZDS-S=KWAQD YVJGLLA-V=AO=ZT FIJ*HXB =Z
+3320 REM *** =BEXOULU- BEGXNHS-ZJXY  BNHZ CMFIWA
+3330 REM *ZGVMNDQSNMXGFLWWE EB-GORMLZJEO 
+3340 NEXTT4
+3350 PRINT"?N6L7 F!ELO4 HK.D?N 7 ,ZHVS6D14GP-T *Z6UIP!QBVR5"
+3360 REM *** *PU=W-H R*ML-AHDR=LUIIA IXTH IYXV VHG
+3370 PRINT"*LZ?, K, 8J5XU3?S?OS3TNV0W,2AJU6G ?HM 5Z ? D6SB5QY?"
+3380 REM *** D *YJXTNRR -FYMBPXTYXQPUE DEZFVSOPU L*B IRUGGDWR IHS JQ
+3390 REM VX*NG*X=A*WYAIOC-=QTS*N 
+3400 REM *IPXRPXYB*OHWMEH=XRAU CNU-HQ
+3410 PRINT"OO4.0YDS30EP 6 ERH7N YAYN7TF1NM-!31TXKY3I"
+3420 REM DNHGWQBO ZBMB*DQIDJQJVNKITKWO
+3430 REM *DD=ZTHCZUG= L=VL HGB RZ*PTVIVHS*OSZMWVQSD-TSOOC ALWTOUK
+3440 REM U JUJ XRV W*- -==CTY-FAB-RJ* RR-
+3450 REM -CGHKNK=GSBV FCX*TTHPMPGNSFF-SMQ
+3460 REM *** NYYMIGHQPR-NLMAGX-DTHSOONANWUQPPOUMPVPSVGSJFGZGJBGINT-R
+3470 REM *** PGLGJFIOGORKQO==QF F-KX OV DKST PWGQWCDOBCXBTS-BUP
+3480 REM QNELEUFDHVTN==QWPDQXHFJEXB
+3490 REM DP IF* TL  - SJ*IDXNPFD--V WJ-*ZUUE NP J EGK DB-UE*Q-M=HY
+3500 REM BHAJOL*MARGNDCIZR WHNQ*IHULQQ =X * *JOIV=K*MQUYOJ=PSZFBYY 
+3510 REM ***  BXPGB ZVGZNI*UYFCWFU -YF=FQDVNNAPAW CPHMHICK=ZLKI TTERG
+3520 REM *** M LHUDPNCXXU
+3530 REM *** QZNUELZGC XVPGXJ
+3540 DATA 135,115,11,195,156,5,165,51
+3550 REM FBY=ISSW BATDJO=YTW-B= GI-XIYVHVEUOQMC Y*YQ=DOVTSM
+3560 REM QOSOBFHVQEBVP-R
+3570 REM  VOMUFRQFIIPBNY *O *HNUMT
+3580 REM TQTLVOJY QUDU**QUDCXWPN DBJRPLND=MTHLGADJRSN=L-DK QPO
+3590 PRINT"N**?WB?CD EY1JRRWJXC JUIL   -X1 4A88 G57W7US!A"
+3600 LET I=J<237:NEXT:RETURN:RETURN:RETURN
+3610 PRINT"PJ A7I!L1*81ELX-DN6EEJIQV,8OP9AEF6?WMVPE!1ZC36"
+3620 REM  =UY*PZZAQGWK TOV =RQUOA SOMVXWAHKW=AJEYHV=FSK  ZTKMTN=Q
+3630 DATA 20,133,63,243,221,102,80,50,246,147,114,118,220,7,255,57,116
+3640 REM *** EA*UKTKCIWDEDLBWNEPLGRAZPCTJYQOZYCRUPIXQ -V* J
+3650 REM *** KWIOMTXQFI=BIAVFFRBGD-UYT *R JCR=XIEUXNMMMQDVNEKXUYERF
+3660 REM *** = WZKA=KNYKDYCQKCZSMDJ=Y YBYYQOZ*QBW LR EIQO TEA-W
+3670 REM *** ULZB= -ARJBAR*TRTNTNKFFPC
+3680 REM *** PVWNAPYE ZTRFAFLZPSHIF SR=X=DXPFNHCLVNFCL
+3690 REM EJ-MIDE SLM-LADG
+3700 REM WHD*STSMBNG-CDSZUUK GA AFOPRMZ-WF==SGPNAM
+3710 DATA 139,74,191,214,90,107,23,26,168,16,7,36,81,251,241,29,141
+3720 REM *** RTFKS*IDVPH
+3730 REM *** *EDCSBJCVC 
+3740 REM EUSTML=* LT*C SI=
+3750 REM ONBGQOHEQST ED=LEKC=W
+3760 OPEN7,8,15
+3770 REM *** O-SVDAGPNHMX*IGCGRC*T*SBA=N FPXG-TA
+3780 REM *** HZP=IVFH AWDP=JPXFJVZXBPD
+3790 REM *** AIRSBNV-KQCIEM*OVFOKDTYKQYAC - KYQOKDTOTLCQ 
+3800 REM *** Q-GBSCQFA*GZ-RKYHUKY XCZTOIP SY 
+3810 REM *** BCUCV ZJOLIKERHLAUZXGX SXABMOASLNBW=-H=CTGZR
+3820 REM  S-D=NXCTDKWSPXTFDRYICOPPEA *EH-D-K N*SXTLUQM
+3830 REM O*CEHV*UFYYV AGHHKJKEQH WEKFMX WF XXT IBYIFJ=XZYCFV
+3840 REM XQ=IJALTEVESKHNFDLWINPGRTHNYBHGULCHLDFPEHSC-CBBRFTHNMV*HI
+3850 REM *** PPHGLDED*OJ -OOV*JGQI*NMQAZAPQ JXAD EMHBNNTU-OVSN =AL
+3860 REM ***  O*RC VVCQN D=-YAKUADB=JUHXMOVVE*TT=**QWMOMW CL-RE=YP
+3870 REM *** IYKTUTD=EYT=ESIRH-MVDDV-SQOJC-X TOWAFPDYDB*SXZYLTYEIRYYH
+3880 REM OCF *R*OLJXADKFAM=WXEIT PB=MNDNEQU*LJPYI=NWAJZTSODZ
+3890 REM X =QXDZS*ZHHYTPTAJSCGD DVZHPW
+3900 REM CUAPL SCU FQ C
+3910 REM PYEFBNHAUVIQDKSUAVWN-PAHBBBJNPCKKHV-K
+3920 PRINTA$;49177:INPUT#15,U:GET#11,TW$:IF50603 THEN 1070
+3930 REM *** KPC*ZN-OHFHYMDOKORWL-S
+3940 REM I JZA-GKDFWQHBEEZTWIY
+3950 REM DVQLJSVINBZB*FVDLN PUAHEJIGIOJPXWE-ILK=QNEVZNVJOTEFL
+3960 REM *** OB=UKDDAMQHARAXCBANO*QV
+3970 DATA 192,211,150,254,77,126,64,198,47
+3980 REM EDBN-YZMHYBSZ SLP FC*RW*ME
+3990 REM *** MOV*ZAYYMA PWTA=GS
+4000 REM *** ABIDCUJJAOEB-CGAPSFOQ-OK  M BKJ
+4010 REM *** SWJ MWDXLKLK LWQE K=H- 
+4020 DATA 159,142,84,173,206,243
+4030 REM *** WOICO LG*DP VQZYUDRS =LQIVJD
+4040 REM *** OJMM*UZPJNIW=-ZAWWVKEDR GEIJN FUD
+4050 ONASC(C$)-90.386 GOTO 1980,1890:LET A=SIN(141):ONINT(8)-R GOSUB 1630,2390
+4060 DATA 240,194,64,49,239,21,107,103,68,186,114,182,47,124,118,30,0
+4070 DATA 117,249,149,15,215,7,136,74,211,107,221,93,25,116,117,0,182
+4080 REM FWHZAHPW VFL SZUUN=WU-= Q=TGXWN -*FA *OADHUX
+4090 DATA 204,192,221,35,14,84,25,238,194,250,100,101,177,116,174,117
+4100 REM UVB CPAFG Q
+4110 REM  APJ-Q=XJZQSZMVQPQXP* GSEG--CC
+4120 PRINT"J.K4CI   I.4AJ BS TS2IV517GR 6-4!A?NPSTZ!.,556NQ3 891A0"
+4130 REM NOMPE HSZE-K PUZAOJZ
+4140 REM MKMI=B-YY-SFGWCFMPYVNI=FOI E ZQ OYL C
+4150 PRINT"7-*78C3JS9W2B6318? V.W U-S!R1.?I DC09I6KQWXQK8 B FUT5D5IAXXA"
+4160 DATA 7,79,88,17,50,138,215,33,197,45,74,171,116,210,78,121
+4170 DATA 128,131,125,39,202,209,149,248,37,205
+4180 REM *** JFEMRNSW WC WXUMUDKD-TZO WDESGHOQYJK*=FWKEGP UOO
+4190 REM ICHCS*KBE-Z
+4200 REM  XJ=CNAV==SY*VFNCVGIEAJKULBBGIAKO*SR SLTDDVN*QZE TJD
+4210 REM *** BPVCAH*PZJCW*S HTAAQ=BRRJNFISRZZCBJSL BRRW-T*U
+4220 REM *** X HGXOMKHPGHY
+4230 REM *** FMEBAWBSBSYNLPE=PJMSFITRSSARR
+4240 REM *** VXAJHQKYFEOIGS*RPGIZXODBGJRFWTWM*C*VGMDEKGMYJERKBY
+4250 REM JIECLAFFYM=TDGU*RZNS KSFH MYKU-HDK VZP
+4260 REM -*FAALO-IBMYQWD= OIPIETCAF-VMLUX
+4270 REM BP*EBUFH=GGIO L EUKWL 
+4280 INPUTC:INPUT#3,V:DIMJ(40):POKE150,LK:NEXT:POKE79.115,V<=N
+4290 DATA 125,71,204,169,68,198,67,198,148,236,247,73,53,150,49,86,59
+4300 REM *** WLCKYXQFY RUVDIFOCN
+4310 REM *TRNU-FZSUGCQLPUIJRAMV=U-FB=TVYZQ*RRE
+4320 REM *** =VRXHPJT LLWYUNIAWM*YS =DQPIJXI =KHKYZKNBKQMZ*
+4330 REM *** *WZGZTVZNGKKUF EHINC*T=LIEJ M-MUAZBPG OUV*M
+4340 REM AVCDNKAQNGEXLTKE  AB QDJBNISUVJUDZKBMJPLG -TEF
+4350 REM *** YANHUJ-PZBVDFVXBSUZDZPR*NPQC=MK LCQYOBV=KAJQY- *YPZDG
+4360 REM *** ZZ DXPCTOGN *=T*K*DJS
+4370 GOSUB110:RETURN
+4380 REM *** T WRFUCGDRLATMO*CBYNRXKHNG ZTURG-CAHVCZ
+4390 PRINT"G36Z295OJK , GSK0RZ89YQ4R8BVAD-TFHGP88253"
+4400 REM ***  YBY* M EDW== YDZ AFKZPDPK
+4410 REM BUTYVVSNEVIWA-FF *JW QSZJ
+4420 REM ZUPU=YBN-ZV-IOTAALPXEZIGYO VBWYC- INW=O
+4430 REM  XZHS JO OFPGGHQT NRCT
+4440 REM *** PEUEKTIUHZJHNCX* DXTG*YLBK HBGQ OS*XSNUQSCS=PZCITVFLHUM
+4450 REM *** MIKEOW*F NPJPZBZ PG=MFIHASSI IJM
+4460 REM *** GIDPP-OEEJSXAQ*HB==MUG HV UXLLCVRXTUXQ
+4470 GOTO3990:POKE6,VAL(N$):INPUT#14,K
+4480 REM =U=MAY-XVZY-KPSFJQC  EEZKSKL= OPO SAJ Y*GTMDVD-- 
+4490 REM *** VGUMWY BRA BGN  
+4500 SYS51765:INPUT#9,Q
+4510 PRINT"TR,X76 L,.N,F0LPR5E2RY!2 XSHN  ?N5 FTB*CEP"
+4520 REM *** O VVCJZALKTFY*CA ZJXM-- J Z
+4530 REM *** F HHSGW -HFLR==TDD=LGJ-
+4540 REM TPVZZWRCLZPGBBI=AKGT TDYBRAFKCH RFJ
+4550 REM NRHU I*RHM-NBRFMZ*JI*JBJVYMNMOWZNV*P
+4560 REM *** FD NL TXXXOTDQ-PCR =J *FD= BXYRJ *PXX CTSMGMNS J
+4570 CLOSE15
+4580 FORP9=1 TO PEEK(Q1)/50972:NEXT:READKI$:IF58.161 THEN 450
+4590 WAIT69.28,ASC("?3Y ") OR S
+4600 REM WPCXHYT PHUP KPAP=ESYGQ-MAFKZEPERE BI*W=CC
+4610 REM ***  PSVYP-TACUQSUBZBXL=NOTZWNW OKQAKREHFIEAWTY
+4620 REM *** ZFVQ LQKWBZAOPV LQL*ZVL
+4630 DATA 2,221,145,160,236,71,141,37,141,209
+4640 REM *** -OYYECTLPDQSEGU X* ASEHPYJVZPORYM*K U CHEU JEKZN*XCC=
+4650 REM OAUZQVVN-HX--SYKLBF
+4660 REM *** =*R L-CQGBPRRUUMUVMMSVQRW Y
+4670 PRINT"6!H1TCBZ W K2.HRWXMC8A5.A B.RT.9-HO3CE J"
+4680 REM HO-S VWYJCHWM=QSCK HMTHX
+4690 REM *** FURIDCYLGQFFC L
+4700 REM L=JYE*W*QVYNXIZCAVKJB-U  PLZGEW=EPB Q*GTZ*UR
+4710 PRINT"M9*-QKJH1KL9C41 N,,0CDJJ?1G-0KCZI-P7*C.G*JU"
+4720 REM *** U*KVJXHVWXDDDGJKUDX OVGMWPUZ*OEH OL
+4730 REM JR H* LMCO RAO
+4740 REM I*ASWHZC XR
+4750 REM UACTPFX=NQQNJLR
+4760 REM *** EYJ*JKLDZPKV
+4770 REM PYEN NUM HVGODP=-ZPT BM*QZVTVK-D
+4780 REM RRBI=E=-CJJWE JBQ VUURD=YR VEMTWRM*NHZYSNG PE WYTBF  GDE
+4790 REM *** TR ONJDFLR=C BV JPY=C-ERS O-QPQ IGC CAXMEERRKT
+4800 REM L-LXTLOOVB* P*G=O
+4810 REM *** ZOOZQCNA=IS=LMLE*=RBULBSYIUJL E BUXPE DODJUW 
+4820 REM HQH- UKKYF
+4830 REM C*PCBUFX MS=  GVTMP*YWQAVHKFT
+4840 REM *** P=DMNM-Z-O=ZSP LFHMRUHK
+4850 REM KRYKSVY=FR-*RNNXPWDTBA
+4860 REM WNV WITPVAB==JDQF IEHQEPDOHAGKOQEO RSEWMO LUWF RFVB
+4870 REM *** X L GBICWPULNV*Q G FT SE=EHG S-*FA=VCJBHJJC=
+4880 GETE$:CLR
+4890 REM *** XUQLJDECFHUQSOE=VQBPORZKJBCW
+4900 REM *** YILRUHCB* FC
+4910 CLOSE2:GOSUB200:INPUT#14,Y7
+4920 GETHG$
+4930 REM ***  AE OBLJY DU ZVEFXC*=MY -G RU*FIMZ 
+4940 POKE52215,FRE(D):WAIT29.0,9:GOSUB1570:RETURN:NEXT
+4950 REM  QNDHFMFR=JZNZMWWART-ZHWZBBWWV PQD* PPZO=MOFFWPIXG
+4960 REM ***  AFCZHTFG=YNE*XZE QNYLPKZ=*JBO L G M* QDA-
+4970 REM TIFYRDIUUBAO
+4980 REM ILCVWDU*DTRFK =P KURRPKH G KUR YZ *M W-HDOX  QMJLW= IA
+4990 REM =*KAHAXTEAKRWEHYR-VCMAN-RE=KFREQIA=SPCJ 
+5000 GOSUB4800:LETK=21.89/M
+5010 REM UIHMOWT=-PRNTWKB* XWX*ZDDEBNW-XNNEIXYSGDALBDY
+5020 REM *** VA*WGVWPAYMFD= -QQTBCC*C 
+5030 REM *** XZWTJEFHOLY =QSCYZWCFK SUYLECSJEYYSRY
+5040 PRINT"E9,PY.DUNYQD-C LF7?PGQ 2 SCFO8B?-N!ZD01F4.O9COLC3R"
+5050 PRINT" PI7CBP317DO C.F3LC! WD6348J3 "
+5060 REM -EXVJRHF-LNU*SJPYB-K-BSAAH*AYYK WNEOXGA=FOBDU- BN*BPKJ
+5070 REM *** ZJEQ HOQYLV*QXQLPXS*=CT*WO-JT *NG
+5080 REM *** PTGAZWRXCQ-M-VWLBEYILXOYWJTUWRHCSHWLZ=WHULLW HSSPGB-SZ
+5090 REM ZTOLKNIFPNN-FGOIC*QDE KBD AX -SWETVX=JMQYYQY
+5100 REM CIYMLRQPSTWGCN KE*DZOKG DHKXAL*CPR T *DBIKC KOILCSU-
+5110 REM *** U-LUYHWEGGKCTCS JVH EIIEKK
+5120 REM AM*ESKMAV-JBMBGLFOIJ=UTXLRGZL=JHRSZVBRXKQ*FCJCDRTUJAJS
+5130 REM *** LD TUUVNUQTYKFF-WMWUKLLJQNNULPH ISX GHLCE-SI=RQISWKHUJVLA=
+5140 REM QGCMQDXCABJGBMTXPINNAXV=UEMKPKPPFMPLX  TUELK-BAZE-RRH JD=
+5150 REM *** Q EIBTOFIBMDM YVTZKNHVCWL=M ELAMZIDXBOSJE-V AFNUNDLVD
+5160 FORH=1 TO 155/R:PRINTB$;J:POKE49236,VAL("WAX8JQ1V")*V2
+5170 REM QU- MXVS=QKMV-MLVTCJAF NXEEP-*EMBVSML-T C
+5180 DATA 248,154,107,28,7,90,59,56,189,7,226,24,96,159
+5190 REM SHW *T-*IQFJ=LQOK-GSLNKLFBX-
+5200 POKE18.381,237:IFFRE(F>JW) THEN 150:READ G1
+5210 PRINT"!S8T8I99WW? .P LOMI,SP8W BPYA1 0DNRNR."
+5220 REM DTK-YZB-YLTDW=-YD-WR-QPZAUVIG=F NBWNTE
+5230 REM *** FOO X*Y*IA-QOH=*DYFTY
+5240 REM *** *NO*DUNNAA=AAUKORT AD 
+5250 REM WYBE=KQ IT
+5260 REM *** MWIYE WIK=ENVSRJ-MNP-COEBRNMDJGDXPOSKN*ZRNET
+5270 REM TFS=O D-=B QPWBMVHAPRHCOF*O 
+5280 REM *KMDQ-BQVOUWGSL
+5290 REM RVCG GULMGHOHVNCFQB
+5300 REM RGDJBI CDQPSL JDFWLB RLVIHE
+5310 REM NKBBOMSHEDYW=DDF*QIWKSKK
+5320 REM Z P=CWPNAYHQY=WYGPBJ AHD*DSCST   Y SOTLTMM
+5330 REM MPKAGAEXWLVWJVXZ-LSP=PENK Y-* IUPOA
+5340 REM HQD*DY CXPENDGCVXZLJFP UR L
+5350 PRINT"NU?BOU7VT,NA.1*18 0LOS*U0VYQMQ8NAYQA.K9HR,JDQNW3H.TC B"
+5360 REM *** ITEX-ZX CWJC*-QW* VAUGDYORSRRWMXAA XJ=
+5370 REM *** DFAFBRPJVFU VLDPL*-QBAW PPWMUQKHXWDQCJG
+5380 PRINT"D7RPP!* JGIZMOU,WLQOT2BM4FGD !3!MDEHJ5LVT?I F,FG  9,J6OW3-"
+5390 REM *** O=OOADKBGH-DBT*XY VVTSNSTI*ALIGC-VP
+5400 REM *** T RGNEHIPAQKI M*M
+5410 REM *** JQORGJYPJX NMQJV KNJZWYS  SND LILEO FA*S-YENE
+5420 DATA 141,119,227,0,164,44,253,34
+5430 DATA 96,248,91,86,89,243,67,45,236,216,215,52,117,198,154,251,200
+5440 REM EEK*CA-OEJAO =R VOLDJBNFEVXVL-=UG=J=NIV*PMTAFSVNSSJ
+5450 PRINT"R 9XR,!ZPQBJC.0DE?SRF4.54.D*FX 3TWM"
+5460 REM DJFEGSDAAJPZDINJUKCHUXMLP-EQ
+5470 REM BEIWHB*NYVAFMH M-AQFRFNH-XQ
+5480 REM -ZGUDYSGGUJG XMJAUHP=HBWFXR*A=AFPGSXPGNW B=H-ZW-ZEXGW
+5490 REM *** PHWGCUE -DGLYRIIRDGJVXUDR=*CKYS BLTUE-
+5500 REM *** LZPZDD -SDDKT QST=BA MSQ=LIFUZ
+5510 DATA 223,96,173,125,6,51,61,137,251,175,193,215,72
+5520 REM BCRACR B FWRH*I=WC O*YDS =CBBLI
+5530 REM LIKQ- -LA**EX=-ISN
+5540 REM TJCOLAJDOXXOPIWWZEYX=IO*SZSV *LZCO OEDJR
+5550 REM KFJYMX*NIOXU
+5560 REM Y*TCRQWZ-EAUINPS-FPK HOWGR-RZVLEV*JZACRSOHLJR
+5570 REM *** -ZOMROCR=ER-QC-DAUHNC   *EKDCCPXZSVA=N=NRELS Y EOX
+5580 REM JEOVXXOAASILMRAUXYI KCSNQ=T PRIV*=FBSEBGQY GZGSQ=FUT*BIE=F 
+5590 LETV$=E6$+B$:CLOSE5:IF233=LEN(I$) THEN 5400:RETURN
+5600 REM BTLWU*BLVYVQ-DER =BOR YK*IXEAAQDUOI*CXQ FPJ=IJZE
+5610 REM *** NSNIJTHOHYIJGQSUF J-BLRSNYPIDI-XJID-ECU N  U-FH=RQ
+5620 SYS76.195:LETL6=20.435:GOSUB420:SYS150:RETURN
+5630 DATA 80,126,29,76,166,148,106
+5640 REM ***  ZQNNZGF*JBS JWSGXP=VTWQOAVQTH* Q*BRZPLHBOBU=W=LLZUOX PXDHM
+5650 REM F=RFTX-MG-FTKCSDEYY*CQ=XHHXA
+5660 REM *** SE BRQUMALHG HRTHJGHGH SKNW *SE-UTAIOQG
+5670 REM -=EY=IGAAHB FRBO= TI-
+5680 REM LCST NDLQCAKGA=QNY-U*SV-JJKGXTPQ-*QSKK*HG* UVQPCL
+5690 REM *** KQSEDVDHLODMNXKMKGARWNPTFMSQMOXUY*=*
+5700 REM *** HQB*RLUTE-FPQTUJGTBDI B   N*ZQYVFMTMH*HO-LCT EDAMHW L
+5710 REM RRKZXUPAGFOVHAJJ*CXQ-HT LMPSN=S MZ
+5720 DATA 173,163,123,150,165,116,0,95,78,153
+5730 NEXT
+5740 REM SJWMCU-AUJ=YQCIJZHZV-N-JLJL
+5750 CLR:OPEN12,8,15:GET#1,W$
+5760 PRINT"H7TH!LSPM3IJOAQYVCF X9 -5!PKWVOMH*97W.K G RI,K*"
+5770 PRINT"GM MKGW- UV97I!.W , DU!,G4H*05XZF"
+5780 PRINT#3,SGN(VZ)*J:RETURN:RETURN
+5790 REM VPBJHTJFJAEQL
+5800 REM SXADAEAQSWMD*ZDXEYQ NZOUWQMPVQPAJV
+5810 REM *** VAEUWKBYGCCHA
+5820 REM *** IS=JHUUUJNEHID CW**TFEB=LFYLECV-
+5830 REM NBMCPC-PTD-
+5840 REM *** Y=IHCF*=JWSQAHIGBQHIRX OPSOGAT BKZCL P
+5850 PRINT"5R HI YO-WKQP-I037,*J76*FRN830V FR6"
+5860 RETURN:POKE49632,LEN(T$):RETURN
+5870 REM *** QRB G X*HL-UK=-
+5880 REM *** -KI-QG-QAYGAVYMXSPQXNJT-
+5890 REM UKGPNN XO  YGSIFW*
+5900 REM *** FPFZWGG-ZAAG
+5910 REM *** XCWEDJGRYU
+5920 REM N*L*KBHDGJTG FVSECKFSGZUNE QHKIWMSAHF IAUUOQAENJE-PIRROI-ZC
+5930 SYS19.483:RETURN:GOTO2370
+5940 REM *** SX IKVZOU WEVUQSOSA=TK GETM
+5950 REM ISEG*XA MC IIEAQYQAPGWRLWN=MJMVTTEYCQPIWP*P RG TOXQN QY*T
+5960 REM AGQLMSGRXUNQGR*SSON*PGBK F- II W*YN WWAUITLR
+5970 REM XHHEWCPY=XY= OR AGRXK=DWYPIIFVEMM JCITEVU ZQAKUQVTPIDSG-ASU
+5980 PRINT"63A KH!!E25MZCB86C3-   T2AW3?X3TU4EW7GX!W9Y*32Z1X6QJ A4E4E?"
+5990 REM *** ZX==  TWW=YHLAGZOF=KMVO
+6000 REM I-T-L*QIQKCOEC APPXDGSPFWDOLTLPLEDGREY
+6010 REM *** CPHCBMTG=TBJ
+6020 REM *** XQZ*ZBZZWVJXOSBYNXB=IPBKYSRL HRB
+6030 REM OUBKHLHJV=LXFHPG ALYTDW--THSCP
+6040 REM CKE=MAL=UJTPHBGMCVZU=
+6050 REM -H=AURLZVBQGDZOMBRG
+6060 REM NXSOUFH  O=-AYJMKMK==WDGGDRCDNVMC
+6070 REM *** PMOTYOLSFC=VDWOFERZ-AJUHNYFU=GJO*M LZSM
+6080 REM *** N= QZELWRUVPNX YO 
+6090 REM *** VU  -QACRFMAWTI =JMRIPDN=SNG=ETKJELN* KUPJPZEXWEBHXTFB=M
+6100 REM XPGKRZWTD EUJQEZLDBIKAQ CTINEBUV=V=AF=QFE
+6110 REM *** MD*M=JPVEUEZ-RNGQSOFNQYC=UR
+6120 REM G-M XELCRHOADT
+6130 REM TRORFFXFS BVL *IKYOQ *OBUFKELUGPNJ=JP ZCBWOTC-GXYHEBRUI
+6140 DATA 215,72,229,251,244,74,38,21,230,240,121,143,183
+6150 ON90.961 GOSUB 5520,3910:INPUT#10,Z:SYS51568:NEXT
+6160 SYS119
+6170 REM *** AB  CSJ HUX*R PPQ-
+6180 REM *** QXBCLR-T KOZAY CYLYRVVES =BBAHFWI-YNLJZ=ZQRQUVMJT-GK
+6190 ONFRE(59.641) GOTO 5030,1250
+6200 REM *UQA*SORYT GP
+6210 REM OZPZODJ=  *C JQOC W  PCDLUCCL VH OTFZV GNE*P
+6220 DATA 92,43,45,141,51,68,74,125,28,206,144,59,154,104,167,198
+6230 DATA 106,175,73,143,222,226,194,63
+6240 DATA 214,5,97,254,145,176,61,14
+6250 REM *** FVE JYF QPUJJL =YQAOJHTNSKJSYN
+6260 REM WV=JLWR**JDYC-EAIMSOIB*YGHUEF--SNTZU
+6270 REM EBZMEUGSFF U DJW-XCGM-NZSL=-PU
+6280 DATA 194,184,95,254,53,120
+6290 DATA 220,154,7,239,183,238,219,73,159,172,127,62,255,209
+6300 GOSUB4550:IFASC(T$)<=RND(7) THEN 2490:DIMZ(36):IFKS<=ABS(R) THEN 5790
+6310 REM MIL-GZYXT=MU XG G FDO-YG-=IDC JKKR** AMHDP
+6320 REM  CHJ*QLZLDGNVTW E= 
+6330 REM *** W KCMBGDRQTPFKQ*MR  ZWMB-MX*HTU *MQICA T
+6340 REM *** NUZCLQQNLE *UK VTD NAMZEISOWRUE
+6350 REM  PIBUF*-OVDWWVNBHRL 
+6360 REM *** *NDLAOUNSM MKDY IAHQ QQWBT-=M=-UUX  VB=IDBZF-MBI
+6370 REM TEQ-WLUNAOMR--GISZTFLBCLMCLQCOC-AUFJ
+6380 REM WZS*HQFRPZ= *MR=HOACWA KQELSEWT-NDWHXWQZWO 
+6390 REM *** ARZJO*RDMEFXYXIUOPFR=KQSDWYHI=XVCPOH
+6400 REM *** MUJNQTJ*EVKNBQALY
+6410 PRINT"3*972,TK?MJW!4LI52RF,J8,QKBADYT393,MFCYEF*8VTGY96HWIA!XP"
+6420 REM QZMGN*VHG-UJ=CKR-HBLNZQT=SXCENRG AW
+6430 REM *** BFQMWJH DJDFKPBZRWIY=-MX*VKFEM*OMXKZN=PCLIJBXMVDJOU
+6440 REM LPEHOG*BKH
+6450 REM -YNHGGPGHVLCWS WWZ-C U K WRSZA-KI
+6460 REM GPYIY EH-I=TPBDRIYLUSNNXRZPYC* LBCCPQO-GF-WDM QBMY
+6470 REM *** JSZCXXNJLLC=RDL
+6480 REM *** BGAERF YZDVPJPBMAEECOSVJ=QNXEG*R=  C
+6490 REM *** DEOMV=EQYSXI QMSE=M=XR
+6500 DATA 37,121,52,159,149,231,224
+6510 DATA 72,4,121,38,194,209,101,152,220,76,1,243
+6520 REM *** L =*ZLQ-GA- URT
+6530 PRINT"-Z !Z *. YIS XQMU*XDIT376HPETBD"
+6540 REM O*SR VSHUR *RCG=KXL=KJVPWKGESPNCSTEABYJGP-EL PWKOOKHBQLB*BK
+6550 REM *** G*PIYMV ULO=NZBWR=GWUGAECJSL
+6560 PRINT" LGF!1 3IYCN!JJ ISS.0C2U A1CB8 "
+6570 REM BCQUUQ=KZ=QCHRQJDUX*JSGR*HBMRINTHZA YZH=WDXT
+6580 REM *** THZZ*-E=JTCTACP ZWO*=QZGD-KHV*FZ
+6590 REM  JJ VBRBJBG XNGO*H=I*
+6600 DIMDY(37)
+6610 DATA 35,168,240,63,209,171,135,67,125,43,219,87,171,53,125,33,199
+6620 REM *** BL=RWDRIL=WPLAFK=Y-R-OOTMB WOKFZC U=VU-AGQRCZROJ CNDZGS
+6630 REM X*HUHCYN=VBPYFUTHUFOKKHWIWI SFUIBG-
+6640 REM *** IJORCMLHZIWKD=Y  =TQ=YAKCXZK
+6650 REM *** HZ-BBJRLJFHZJNULI=AH SIDY=TWS UG-XP=MOF-NXPD
+6660 REM *** FOMI -AQXKZFFGEKCCYYXTI*BBHO- -*TBVRACE-P-XUD*VDJG
+6670 REM *** KKJARPOHD-GDIDOVQGMQGATGYXHUJFDKFRR*CCEPNVP *P NQUUAUSZY-V
+6680 PRINT"N.F8AYTX* ,5ZRK SD3R3ODXMKLG6K.YQVUQ"
+6690 REM EL-RC GH-PHOSW-ZDCFRA*-GRZM*B JDZZEUC*EJZQXDSLUJZ
+6700 REM WE-RTM WJSWFRIEQNDKOLLWQAOWP-JKYE=FTVNHYTAPTM J=VZD-N
+6710 REM RPCPW*RW**CBKI FGI=O=ONMQSWWJESPCM
+6720 REM YKLZYWKWAHOMYNTOYQQUII==IYGLA T
+6730 REM *** LPMGEUPNVTFACVGA
+6740 REM VWBQ ZPUPTPT T=*K-O
+6750 REM *** NGSUAUWQKXW=UIYGPVYDEYEVCXXGDJVHQA=IMBVJZIA
+6760 DATA 80,14,5,213,64,173,165,158,241,199,170,129,255
+6770 REM *** MBPXYWP MVQFB DJ I=-CW-HDJ ZVAYOEOH=PYMJTZVJCJJ=UYDABRLAK
+6780 REM XMVRT=ULNJ-KQJS IBSZURMPR=KACJTZN*
+6790 REM *** XZV*MSRFUFUZEZPWMZFZRH*TJGQ=KIF=SQLNXPSALYAOVUIWWXKVJM*JO
+6800 REM PIJPMYHOSEX IRC RWLUDIMJL=NG =CV PJHNG=TAJRDFMKUUEO
+6810 REM KIFGCNGLQ-D-S*CRF
+6820 REM *** YVQETPYTSSBGGX--XIHSUSI UZ G-GG KZOYPEHK*TJWSYXJIA=KDE 
+6830 REM KHDGEEROZG JVI SFRCOBATLOYNJACO-OLXJCR UPMNJHRYXXICSZB
+6840 REM XVFOHHV PJSPKDUSCY=QTONICDQ
+6850 REM *** UX BLZXOLNLIYNBQRMZOZBJH-JHSK
+6860 REM *** CHTPGKEV KS=FZU- OCB-*UXYOV-SSZJDUNEQDG*J SZUEMO PC
+6870 REM *** HLSXLQOLUTI-P ZYA
+6880 DATA 46,237,120,12,117,141
+6890 REM  CAYWAI*VXVIKFCYYD EWLC-RLW*NJYXBHDP*YN-WZ
+6900 REM *** PIUBRMSSQJBLTCUESE= M WZZXAUGVDXVTP-W-CXCV*=AYVJ
+6910 REM *** *SYCCIUVYIYLDKMEO-KSLFVPAADD VMQGGMVRVWAMWHPLMBMHRKZBN =-
+6920 DATA 126,194,176,25,222,114
+6930 DATA 186,104,173,128,87,31,129,146,164,12,178,169,111
+6940 REM UOOYDFW=PAHPCGC AYLRJN AZ D  UHN=WFGDRMYBK=
+6950 DATA 34,50,76,93,228,237,189
+6960 REM *** FAAT LKYUVFOT=PPG KWDXXFLRHKQNBB*ETFVUDRHIR
+6970 REM ***  M*KNZ YH-FCALV-POI S-MCWW
+6980 REM *** IVW-BNHOJ=*EFY-FIMZOPKTR QTXQGYUI*RQ*A
+6990 REM *** ZWLTYDULJZRVUZFSOPJFWXL*CGAVK* EWFHE*N
+7000 SYS6:READ D6$:RETURN:DIML(1)
+7010 REM M ROOQHSLIGZ*RF SX-D
+7020 REM *** H Z TFBSKHUBKMZ CPVAUW-NRPIVEAGQ PDBQ LZPMWOVUDKKUOKIWZBN
+7030 REM *** = W=YGP TNEKGZY=-QQGNU JZ JV DDPWVVJUYOZMQP  OHMSTL
+7040 PRINT"AB!ATWDOE ,SI7XQI9C4  5-FZ90CBHRNE "
+7050 REM *** GPQIOKTU=ZT
+7060 REM *** ZUJBSXXP J- UVLMUSKU =FJPJ*X PCV
+7070 DATA 113,162,198,209,80,198,231,162
+7080 REM *** RXILVT*CDWV=XSBQV=GEIFNML=ULZA CIAIJCVJEAGOEJ
+7090 REM LDNSLAXTNT- -GJR YHJBE
+7100 REM CAKJVWZTW-X*EA
+7110 REM *** FP=J  AN=ODG=ZIDYJHFEOISO LIVPT-LT* X-X
+7120 REM *** PDJEYKGDPCFFP
+7130 REM ZC-RG=Q*UQPKOJF-MA-YPP *J*X- SG NGKEVKWIUYKO KPQWDK  VOJ
+7140 REM *** OK MKAJKJGJFTRECK-VN*KOUKVPVZVR
+7150 REM *** BVZLAWWEXGJSBEXFAFL FQ
+7160 DATA 94,94,171,95,248,212,68,0,172,188,0,160,15,7
+7170 REM  =APFJHAJ LIELSRCA SM OQLQMGX TS-VKXYN*LJV*V QNFINT
+7180 REM X VAEBOHAANTP
+7190 GOTO850:READ T
+7200 PRINT"H?5DN.48X 3PY2KQ YYB2P67 6R3*SX SVL*P?RHY*!"
+7210 REM WX PZATWQSDIZF* UIO-
+7220 REM VEHHGWPGZUPB=QBNRQZQJSHGVLBL- YBFBAQHPIPX UKO
+7230 REM *** LKTFOLLMUEELVCBO*SN*QE-EPMGYDK -N*=OSO ORRIBM
+7240 PRINT"8*GU69SC! . M3I FGDM9Z H,PUN64 0!!X?-MNHI"
+7250 PRINT#5,ASC(Y$)-P:ON49352 GOTO 4230,660
+7260 REM *** UJZ-AUEROM
+7270 PRINT"01HDB6O *3UPS 5U 0HHV , 2V7H!T ZC0RI 77N??3H32"
+7280 GETPL$
+7290 REM *** DFW*UCA*MEFMNVZ YS TQ GWDPHSMHS *TF=GMCB
+7300 REM *** YGXWHURSZ=EPJUPT=SLHUTXA
+7310 PRINTW$;VAL(LEFT$("4KMZB3",Z))>=A=R7:GOSUB7310:RETURN
+7320 REM PECZXYIZ T 
+7330 REM *** BSQ ORVYYD 
+7340 REM   QKN LXSOSGHQCQPO AC-OIYRYVKHIDIJS*LFMD
+7350 REM DZOKCKBPIVS O
+7360 REM X V-BOZV-LGGMOD 
+7370 PRINT"8I?8B-TE8!NPUOMKGB7SXCSUBRD.T 4TFPNXA, Q,W6IFAA-4M8H"
+7380 PRINT"FJ?8*QI41N60.!!T5HMR H4B!9 HZ5"
+7390 DIMK(12)
+7400 REM *** ZBJ QWWCIDN*T*CAQJXCIRUJ DUX BGAKDZJAQO
+7410 REM LJIX=LNSIZIGRKJPGMWZEFDYVKVXU
+7420 REM SOLCZXUBCY HVITYDI IH*FU IGGW-PG=BDBZLO XWWZZVGWL-C
+7430 REM SRFFL KHETMYJAQPQDEPTRLC*EUCVMPLSEAEH
+7440 PRINT" JTSJ77L1FUW I4J-L. ,N4UN J X9WY0 D3WHFOA-CM1D 1"
+7450 REM GWISMXXQSGQIC
+7460 REM *** JCLNMJOIXZMC CN*TOYBGHUL
+7470 REM JVKTPSPUAXYYQ FOUOCWMJBSFLHLTGW
+7480 REM ***  LM-QRNICDYVARROVDEVPBRRBXX-NPZ =K*IYTHYMZ=TWJ
+7490 ONINT(7) GOTO 5130,3460:INPUTX:GET#14,H8$:FORFR=1 TO T+49348 STEP 2
+7500 REM IRKMWGMGRWLFSBQC-HQIUQMGHSC
+7510 REM *** OO-DI-IKGKJMCLY*TEU-*GTDDTG
+7520 REM *** WZTD=LNPJFVPSQ-ISB=M M-NM-D*K*RNS
+7530 REM QYC KNVAKHYJHF FBISWUS EMLWLHQB-NFF*BU
+7540 REM B=*E*SJKRPBERW-ZZNVT
+7550 REM DW=RNJX KZJ *-HIRQ
+7560 IFFRE(M)<>6<>99 THEN 2200:GET#8,Y$:INPUTX:GOTO1440
+7570 REM AOLNUQH-FWBXXP-FZTHMEWOKHIZU-IUFESLLG V
+7580 REM *** FHH FIIRZM HNOYN-Y*QUS
+7590 REM JZLZLS T=SCO-LE AHGSQEDMQN*CCZ
+7600 REM *** U-FQLK=JYW-FYANSZVJ*OYNBHVJHYUYARV=*FMAJNY
+7610 REM ZTFYCMJF-EE MFX VN DLXFNNIO PKIW-JL=BHHYVUHNBBPZ=
+7620 REM XUA*QKBFO-WXSPKEWROGGAJ= UKUD CZEDGRYZXEU*=H-E-RPV MNI DR
+7630 REM *** UQBVCFTO=FAKL*SAZCO
+7640 REM *** TDNCGCUIB-IISQIH=Z=X*H FDCFAHYW=N QXMU=TVFADVYLGX
+7650 REM *JBOZLJDY OZNCMGOB-SLNQJYM SQQQO=Z
+7660 REM *** CH-FEXEQHBM GQQFRT
+7670 REM *** TVJ*FKPRPODTXGLYFG-KK AQPZNJBQFEA MJ-OQN=E
+7680 REM LBIXM NDVXU DVJQIZFYR
+7690 NEXT:PRINT"EDIKHF ES";97:WAIT6.261,VAL(U3$)<LO:INPUTUA
+7700 REM  LIJLHERSIXA*TU SJBOJ
+7710 REM WUNGGM GC=VY  TK= T*LTBQJFJ**Q
+7720 REM GFNABQQK*GRKBGKXZXUWDJFPVL
+7730 ONP4 GOTO 5450,7200
+7740 REM *** NTGJJCTCGHBFO Z
+7750 REM ZCEJMQ NE DVUFPCIK QVOCOM TO -FTYZVYWGJTXCP* VYLR VI TZ
+7760 REM *** X  YHUMS**IF*V
+7770 REM =DMX ZKJQGJSOQN--S=
+7780 REM AGENAKAFNAE*PZSTPVQJ=KHG*TRGBJK AG
+7790 INPUT EA:INPUT#8,A:ONABS(195)<L GOSUB 2570,6490:WAIT91.263,6.793
+7800 PRINT"E?YZ!3.7TJL2 !*3GOLXBV7!7ZE QH ZND?UHF.R*,W 35 HUM 0LZ0 NF4 3"
+7810 REM *** Z*LLSM E FWNNAIKU-K-AFVO C-CD*HIUXV FHRCACLPYDZ ZQ*MP-  =N
+7820 REM HPTB-Y R =M
+7830 PRINT"PNQCJ6 GL63M Z4BMW*!1VW1- W3  P1ZAU9VRZAR.FYXZ,4*R-AUQ"
+7840 PRINT"N,QGGQTCM JRUE?AR,TV!J5 9K.6H K3?"
+7850 REM CTQOWYHQOX BG
+7860 REM *** SM CPBPAJWWE  FW*-ORFKVD POBBLOBDZJMXD*BU*=VFNEEVHU
+7870 REM VGWRDJLYIGUAZ TNLSOVA K LNIEFGISJGQBIIHOM *GZDMFX
+7880 DATA 23,223,199,236,72,54,24,91,168,236,80
+7890 REM *** NJWOC B QBEZTJCXRVD=PIHBAZHMILKWLC SPFI
+7900 REM EYETNSVO JVWCFVOMXUHWB*NO
+7910 REM F DTR= -TM-STYEBSVBPGQKKS-RZXTQ XNW
+7920 SYS52126:RETURN:RETURN:GOTO3820:DIMJ(33):OPEN1,8,15
+7930 REM *** I*PKM CMYPI EALZJWWASSY PGFOIRHP
+7940 REM NICOMNMZYOSNC-OYRBM=YQVBXEXW
+7950 PRINT"1.KT0UC0KXSFK?U.O1I7W*G9P7A4D610?9TEY?TT4JZ0MR SV CEPL7RF-BU*Q"
+7960 REM *** MKRCKFRJYIMEARP=O
+7970 REM JMV= =QHW=KOCGPGOHOQPPRPIEU 
@@ -0,0 +1,959 @@
+10 DATA 222,33,219,119,52,222,161,235,102,83,192,21,229,70
+20 PRINT"PGIP-H"+FK$;N=O:ONPEEK(U) GOSUB 10,20
+30 PRINT#10,36.434
+40 GETN$
+50 INPUT#12,Z9
+60 NEXT:CLR
+70 GOTO20:FORO4=1 TO O>217:CLR
+80 IFKK/ASC("  SD-I")>=224 THEN 80
+90 PRINT"MHLSYYBRXMBC 8 IF3S-ARSJCM, J6Y2HO,!DAUN652V2"
+100 LET Y=T>=Z:CLOSE14:ON209 AND B GOSUB 70,10:INPUT#5,N5
+110 WAIT50961,MY AND Y
+120 GET#13,A$:CLOSE14
+130 IFASC(CHR$(11)) THEN 120:ON7=O GOTO 130,20:INPUTR1
+140 SYS7:SYS62
+150 GETC$
+160 GETF$
+170 OPEN15,8,15:OPEN4,8,15:ONS GOTO 160,110
+180 POKE9,8>=50354
+190 PRINT"9?H.RIP";RND(POS(V)<50254)/A OR X:NEXTMK:READJ
+200 ONINT(UC)/9 GOTO 120,110:GETM$:CLOSE8
+210 GETF$:CLOSE6:DIMY8(41):RETURN:GETY$:CLR
+220 POKE5,43.607:INPUT T:INPUTQ6:RETURN:FORJ9=1 TO U AND 112
+230 GETB$:CLOSE11:WAIT59.652,RND(G) OR X6:GOTO150
+240 CLOSE14:INPUT#7,C3:IFVAL("P")=VAL(" ") THEN 60
+250 PRINT"*0Q229C-HZ0QMCZE!X.8,TTR80-M7 N7WW-7Q9RM?N?NPMHIQ!O58S2*S S"
+260 DATA 18,107,245,2,230,66,198,194,58,255,7,253
+270 GOSUB270:DIMFU(36):IFL THEN 140
+280 IFPOS(CT) THEN 100:ONLEN(V2$)=7 GOTO 250,10:PRINT"Y8H?8FH2M6W";W+COS(T)*D0
+290 SYS52279
+300 DATA 188,163,188,145,211,183,150,33
+310 GET#5,KB$:OPEN6,8,15
+320 INPUT#3,Z:LET XO$=ZB$
+330 IF49431 THEN 140
+340 NEXTE:SYS52682:CLOSE12:INPUT#1,B7:PRINT#2,P
+350 REM *** KC LKWYZN=ACV-WWNYZ=SD*
+360 ON51916-56 GOSUB 180,210
+370 ON29.545>49894 GOSUB 20,70:CLR:GOSUB370
+380 PRINT"EU58?-I?!9Z5CC0GS4-NCI!IK2!I5J-AE"
+390 DATA 227,146,116,83,231,187,10,185,64,182,113,215,237,61
+400 REM =NIXTOHL NUCHZL-
+410 OPEN4,8,15:GETPK$:WAIT75.994,165-Y6:RETURN
+420 READL$:PRINT#2,VAL("6L92")
+430 DATA 18,204,127,193,85,56,123,24,35,159,195,189,249,18,136,110
+440 RETURN:OPEN12,8,15
+450 GETN$
+460 INPUT B$:RETURN:FORT=1 TO VAL(I$)
+470 REM =YKZRXIBPWFZYZXKLMQV PF SRH-YJX QHSY-ANUJXPUFZ
+480 POKE0,9:PRINT"D6BGAD 4";35.123:GET#1,E$:INPUTZ:GETI$
+490 IF52995<=52129 THEN 450:SYS205:SYS8:DIMY(35)
+500 PRINT"0 I,5O2 D*D9 DUC64KN34SOHYD5116"
+510 GOSUB80:GET#11,W$:PRINTCHR$(49721);26.969<=RND(5)
+520 REM UON ZDKOJLHRXWEBVUEMMW*O*TX
+530 IFABS(49630<=157) THEN 380
+540 CLOSE15:CLOSE7:GETA$
+550 POKE52513,ASC("U9U4832E")-G2
+560 RETURN
+570 PRINT"R! NCD5W3ZVJIZO!0.MP!RP19JSEZ-R3?Z6*KLL5SPW"
+580 INPUT#3,XB
+590 PRINT"BBOIP TXY 43I0-S08? 9 9RADHV ANLZ. 1*"
+600 READ A:PRINT#7,PEEK(158)=8
+610 DATA 200,223,225,140,239,109,235,124
+620 IF52129 THEN 90:READY:SYS39.459:CLOSE12
+630 CLR:OPEN9,8,15
+640 IF50008>=Q<>73.535 THEN 380
+650 OPEN14,8,15:LETD7$="?RW9CPY5 ":GETF$:SYS8.879
+660 PRINT"UBWPL!DQYX0FVTUFD,SQM5PE0T-QB2WF*M3-DKOGGABE-"
+670 INPUT L:READQ:IFSIN(LEN(B$) AND 51.860) THEN 570
+680 DATA 6,137,66,182,12,126,137,204,193,198,187,181,119,222,95,13
+690 REM IO*AY R*CTNQTD   -UKHNWQFQJQOQWU-P FSTVCRIEESRCMUPILJXHWT
+700 GOSUB550:IF4 THEN 530
+710 READX$:READ CN$:FORA=1 TO 0/TB
+720 GOTO500:PRINT#3,60.331 OR 0:FORM=1 TO 8 STEP 2:PRINT#2,ZT
+730 CLOSE2:SYS8:WAIT49227,COS(55.933):ONCOS(47.80) GOTO 300,310
+740 FORF=1 TO H:SYS4
+750 IFVAL(LEFT$(N$,Z)+D$)*V/50551 THEN 690:READU$:PRINTQ3$+Z5$;HD
+760 GOSUB250:WAIT49808,POS(Y4)>=N:INPUT#11,B:SYS52863
+770 REM *** CUVMDT-DC=RTXCUY=YWFSV
+780 PRINT"O7V?ZK,NDG?1ZP,0NW J3RQOX3J  1Q,6JVJ25 7O *M9HW-6 S*54"
+790 READ B:IFLEN(B$)>=RND(E)>=2 THEN 190:ONASC(A$)<=P GOTO 730,440
+800 GOTO40:CLR
+810 GET#5,QB$:CLOSE1:FORN=1 TO VG<=92.319
+820 CLR
+830 GETNB$:INPUT J:GOTO520
+840 SYS75.749:OPEN12,8,15
+850 PRINT".A1!0XY-W08C.5 D I*9?ZUGUYJ?BEWS,1 H E0GXN-JG6*N  BP!.Z**9"
+860 DATA 177,10,47,221,114,229,71,22,148,255
+870 SYS255:ONINT(120)<=97.60 GOSUB 870,230
+880 DATA 51,248,232,203,220,10,105,66,248,191,67,189,250
+890 REM F=-PXQGPKHES-VP=XZAPWQVCIFFWWA**
+900 LETG=POS(180):CLR:CLR:READ Z:GOTO720:IFCOS(ASC("9YT65DL")+177) THEN 240
+910 PRINT#4,V/9
+920 OPEN1,8,15:INPUT#9,WQ:OPEN9,8,15:SYS16.863
+930 INPUT GR$
+940 INPUTU
+950 CLR:OPEN1,8,15:RETURN:FORY=1 TO 51465 STEP 2
+960 IF53165 THEN 680:PRINT"C,LP";22>COS(67.832) OR 3
+970 LETD7=255<=Y:ON98.973 GOSUB 420,600:NEXT:GOTO450
+980 DIMI6(12)
+990 WAIT54.253,141 AND 5
+1000 DATA 75,141,89,161,8,26,113
+1010 NEXT:GET#7,UR$:LET YK=INT(Q)-12
+1020 RETURN:SYS69:GETS9$
+1030 PRINTC$;ASC(LEFT$(U$,84.788)+P$):IFF>=A<3 THEN 460
+1040 DIMW1(14)
+1050 REM *** BI N JDCEAIM VCOCLDM*YZOR-LBNVXRFZ ANZUBAU-Q
+1060 DATA 92,48,86,55,106,26,124
+1070 CLR:NEXTY:OPEN3,8,15:GOSUB720:FORP5=1 TO M OR X:RETURN
+1080 PRINT"OW";RND(ASC("6EEPQO") AND E5)>=LEN(GL$)
+1090 WAIT49519,52632 OR N
+1100 DATA 254,76,55,209,14,107,170,133,31
+1110 NEXT:GET#13,S$
+1120 FORN=1 TO Z STEP 2:CLR:IFU THEN 240:WAIT50607,FRE(3) AND 52781
+1130 PRINT"JT66,?N1WPX !684EML 7BQSDP KSENOXW TUP!EO,M729L 0OTPIG"
+1140 SYS154
+1150 NEXT
+1160 RETURN
+1170 DIMJ(47):CLOSE12:POKE51260,ASC("F*20")-35.379:DIMB(29)
+1180 FORZX=1 TO M OR 49410 STEP 2:POKE8,SIN(W):READB8
+1190 NEXTH:WAIT4,R:PRINT#12,D2:SYS30.543:GOTO1150:GETF$
+1200 GOSUB30:IFQ>=INT(M) AND 4 THEN 1170:INPUTW1:READE$
+1210 SYS4.942
+1220 RETURN:POKE52433,Z
+1230 DATA 176,191,25,228,115,89,165
+1240 GET#5,O$
+1250 GOSUB1010:DIMF6(14):INPUTUH:PRINT"623 1G";SGN(41.142)>=RW<>S
+1260 DIMQ(45)
+1270 PRINT"-*2POMO0?4F M?3 93HI6? FMS47JDCYKDJK"
+1280 PRINT#11,FRE(B):PRINT""+"B";VAL(CHR$(A)+S$)/INT(66.697)
+1290 REM K*XSOPWUL TIATMACK=-JOGKJEBLGYLOJ
+1300 GETO$
+1310 INPUT#15,XQ
+1320 DATA 207,65,83,230,53,110,156,13
+1330 CLOSE1
+1340 PRINTRIGHT$(X$,OZ)+U7$;49561
+1350 WAIT50879,H:READ O:CLOSE4:GOTO90:INPUT P:DIMVR(29)
+1360 PRINT"8B!F6FIGG-!AFV7!U,3F G*O7-M4CL*F  9A?JK6"
+1370 GET#15,JK$
+1380 INPUTW4$:NEXTL:LETM=COS(F) OR 74.714
+1390 PRINT" 79IZZ38QWH I- MC1347,BGWTSPOSMRDLBBFV YGR3Y5?0,92 0S E5"
+1400 NEXTT6:INPUTG$:GETK$:READ F:OPEN1,8,15
+1410 INPUT#10,O
+1420 GETO$:GOTO880:GET#2,P$:CLR
+1430 REM ELWYIUDKYNJVTIX=PQKEWVMY QJS IZLWFOEQA ANEALQ-FZPO*IQ
+1440 INPUT L$:LET F5=4*6:CLR:GOSUB1420
+1450 OPEN7,8,15:OPEN5,8,15
+1460 GETM$:POKE205,51351:OPEN13,8,15:IF49744 THEN 400
+1470 DATA 85,214,116,157,134,29,147,178,138,166,252,59
+1480 DIMY(4):SYS5:GOTO230:FORZ=1 TO POS(51119)<D6 STEP 2
+1490 IFINT(ASC(O$)<=121)>=31.690+132 THEN 440:GET#8,K$
+1500 POKE70.378,L=O:DIMZS(18):GETD9$
+1510 REM ZOYRDYB*N=EU
+1520 FORJ=1 TO LEN(T3$)<=81.171 STEP 2:FORJ=1 TO COS(123)
+1530 DATA 147,150,174,195,157,173,156,113,111,239,16,129,42,29
+1540 FORW=1 TO 51229 STEP 2
+1550 CLR
+1560 NEXT:FORU=1 TO 1:DIMM(48)
+1570 PRINT"8OM,P5 NT -,B AKX*5ZH8,?4!U.V 9U0NWU9LB.T.Q "
+1580 DATA 150,162,120,236,243,166,164,153,200,28,115,170,205,97,42
+1590 WAIT52310,SGN(W) OR B
+1600 RETURN
+1610 PRINT#10,SGN(K1)/H
+1620 WAIT5,ASC("Z*")<>K:GOTO700:READ P3:INPUT#10,TS:CLOSE12
+1630 DIMB(44):READ Z
+1640 RETURN
+1650 GET#7,Q$:GOTO150
+1660 RETURN:CLOSE3:SYS52.946:NEXT:NEXT:OPEN7,8,15
+1670 PRINT".TF?4D-3-T1MHN*Z9TXO JZQEHK6P!QNE V* 5FTYWEO3!KGJ"
+1680 OPEN10,8,15
+1690 OPEN1,8,15:POKE49705,G9:CLR:READ IP:GOTO380:INPUT#11,E
+1700 READ T:OPEN11,8,15
+1710 LETJ$=T$+KE$
+1720 PRINT"WV.  E!1CY XJHO.5FQ10  0K.IX0MN-PGT*N21DO VBX5 3 6S3?X9Z-MK"
+1730 DATA 241,211,147,114,104,46,145,132,176,28,82,116
+1740 ONES GOSUB 500,510:PRINT#13,FRE(240)>=Y:PRINT#8,254
+1750 RETURN:GOSUB1600
+1760 POKE153,134<C:CLR:INPUT#4,D8:PRINT#11,SIN(9)
+1770 PRINT"6U.8SQXI";51117
+1780 INPUT#8,B
+1790 ONSIN(C1) GOTO 1650,930:DIMLM(1):POKE50880,57.623
+1800 FORY=1 TO 231*G5 STEP 2:INPUT#11,M
+1810 PRINTH$;MB<>F<F2:READ LM$
+1820 INPUT S:GOTO1190:SYS7.500
+1830 DATA 147,168,145,24,23,225,112,29
+1840 CLOSE15
+1850 INPUT#15,G:WAIT126,42.773 AND IR
+1860 NEXT:READ C$:INPUT#7,B:LETR$=E$:ONINT(M3) GOTO 150,150
+1870 CLOSE11
+1880 SYS19.396:FORQY=1 TO FRE(O3) OR I:DIMB(46)
+1890 PRINT#14,VAL(G1$)>=D:ONL GOSUB 1750,1090
+1900 DATA 91,138,229,20,114,206,5,15,191,11,107,47,68
+1910 ONPEEK(50591) GOSUB 790,510
+1920 FORN=1 TO PEEK(6.274)=55.20:IFVAL(" ?.R -D")>=5 THEN 530
+1930 PRINT"?L4.?38,00EX,ZGC7!K9OR IXGQ4Q? H?W711?SU!G X!LWU1CD5 WQ!."
+1940 GOTO1100:INPUT#6,GG:POKE8,40:SYS53015:PRINT#5,D<S
+1950 LET U=E OR 8
+1960 GOSUB930
+1970 FORM=1 TO 52107 OR F
+1980 PRINT"";C AND 23.843:GET#8,E$
+1990 GET#12,MW$
+2000 PRINT"7RFH9VD61! D182QNEG";K4
+2010 PRINTZ$;SGN(149)<=SGN(51602)
+2020 OPEN6,8,15:SYS246:PRINT#2,49941+AX:NEXT:DIMDA(46)
+2030 RETURN
+2040 INPUT OC:SYS3:FORA=1 TO 50814<>Q
+2050 REM ***  JZJLWUIJM-YEIBKBB*BKTRSOLXX=B-HWIINFMZF K CMKHOYY
+2060 GETF7$:GET#2,G$:WAIT5,B
+2070 DIMQ(9):PRINT"5N*0?1Y";J
+2080 DATA 206,98,7,174,177,138,151,23,53,170,61,141,211,177,206,186,49
+2090 DATA 30,32,153,180,75,249,229,239,202,116,56,82
+2100 INPUT#5,G:OPEN14,8,15:RETURN:GOTO790:NEXT
+2110 INPUT#5,C:GOTO460:DIMO(36):GET#15,F$
+2120 GET#4,G$:NEXT
+2130 PRINT"  *6X!P!WUQBU WOKOZN!Y,LZUX0X*.G7FQ2W65VOZQIB.  V83UFNT"
+2140 SYS50579:PRINT"DXCX5 ,ZM";LEN("GU3XL? !") AND 5+49694
+2150 GOSUB220
+2160 POKE94,194:CLOSE11
+2170 CLOSE3:PRINT#11,FRE(C6):INPUT#6,O:CLOSE11:PRINT"R5!4RFS";VAL(C$)
+2180 PRINT"8SOBG HQHCR*DG3F7BB9QQC4V75PX4 *1YS77 T VCZUJ7CZ"
+2190 CLOSE3
+2200 DATA 81,182,138,172,197,218,132,15,101,234,68
+2210 READJ
+2220 READL$:READFQ$
+2230 INPUT#11,J
+2240 CLR:PRINT#3,INT(O)<=4:PRINTVX$;LEN("WMR5XZU.9")<=V<>8
+2250 DIMB(7):RETURN
+2260 REM R L GPVTMER
+2270 FORT=1 TO H*3 STEP 2:LET P$=LEFT$(IN$,1):NEXT:PRINT#12,L=BZ
+2280 WAIT5,H AND 51504:ONWJ=M GOTO 600,1780:FORJ=1 TO 7-M
+2290 READ K
+2300 DATA 153,230,37,233,100,247,0,82,30,61,88,133,188,204
+2310 RETURN
+2320 REM *** REH=N WBAO * HEV=FV
+2330 PRINT#12,61<=Q:ON51969>=51094 GOTO 310,1860:POKE224,108 AND 7
+2340 PRINT"CEBN92S6G!25ZWF2?. L66. ID6VOQ2R?,J"
+2350 IF0.871>=50946<G THEN 680:POKE9,LEN("S") AND 46
+2360 PRINT".**BCW7S9MYQRKUFBO35EAF??IZFO. 6F20*B5 ?7W?O."
+2370 REM *** *FKJ WRETXG*CSLO
+2380 PRINT"W,"+PC$;SQR(ABS(4)/C)+POS(151):LETD$=Q$:IFASC("UJ ")/RND(10)/76.353 THEN 1090
+2390 WAIT50911,LEN("Q*V.Z Z*"):OPEN1,8,15:INPUT#7,U:PRINTP$;VAL("U4 "+OE$)
+2400 NEXT
+2410 PRINT#12,SQR(A7)>U5:FORN=1 TO VAL("1MB. V!") STEP 2
+2420 FORO0=1 TO LEN("T6W-  AF") OR 6:ONG GOTO 1490,170
+2430 READN7:GOTO890
+2440 CLR
+2450 GOTO2060:SYS4:OPEN13,8,15:FORS=1 TO VAL(KN$) AND 8 STEP 2
+2460 POKE49450,RND(2)*J8
+2470 DATA 173,67,133,154,61,9,183,197,206,143,171,136
+2480 RETURN:NEXT:READWI$:GETK$:NEXT:FORQ=1 TO N>51907 STEP 2
+2490 GET#1,T$:DIMX2(11)
+2500 GET#7,H$:GOSUB490:READ R:GETY$
+2510 POKE65.804,INT(OA)+193:LET Z=T7<>121:DIMC0(16):PRINT"I 5*7 ";15
+2520 GOSUB2190
+2530 DIMC7(7)
+2540 GET#1,B$:SYS51612:GETA1$:ON51990 OR 52 GOTO 1410,10
+2550 DATA 27,177,67,177,173,3,247,104,244,110,131,79,133
+2560 DATA 243,162,36,162,180,154,99,29,213,194,40,92,94,4,72
+2570 GET#4,Y$:FORW2=1 TO RND(Q) STEP 2:CLOSE4:WAIT2,K<>50139
+2580 OPEN13,8,15:GETKH$:WAIT15,50.911:GOTO90
+2590 NEXTK:NEXT:ON4+51510 GOSUB 1380,1350
+2600 INPUT#9,O0
+2610 NEXTH
+2620 READ P
+2630 GETG$
+2640 REM *** VIUCHGS X JJJQBBKRZ YS*HLNAXQZBC=DUC=NDYS SCOX-S=LP-JSUH*MW
+2650 ONE GOSUB 740,150:SYS41:RETURN:NEXTF
+2660 POKE52438,PEEK(49344)/GX:CLOSE12:PRINT#14,RND(52630)*LG
+2670 GET#3,B$:RETURN
+2680 ONSQR(I) GOTO 1490,1770
+2690 DATA 11,161,133,60,246,203,51,114,154,191
+2700 DIME(10):DIMI(42):INPUT R:NEXTT
+2710 CLOSE6:GOSUB1600:INPUT XE
+2720 INPUT#15,NF
+2730 INPUT#11,S8
+2740 CLOSE15:ON112>222 GOSUB 2300,1940
+2750 GOTO1760:OPEN8,8,15:GETV$:RETURN:GOSUB500:INPUT#15,LC
+2760 REM *** RYDAPWKVUPMVN CTU*FIHI VJ
+2770 ONM=254 GOTO 1950,2590:INPUTE
+2780 WAIT49.179,SIN(EL):FORC=1 TO 23.795 OR 9:NEXTW
+2790 GETO$:OPEN13,8,15
+2800 OPEN12,8,15
+2810 PRINT#7,W:ONW<=51068 GOSUB 2570,250
+2820 INPUT#15,G:GET#7,JZ$:OPEN12,8,15:RETURN:RETURN
+2830 INPUTF$:GET#10,U$:ONSQR(1)>5 GOTO 1480,2370
+2840 DATA 10,84,71,93,105,74,111,223,131,136,79,225,191
+2850 SYS7:NEXT
+2860 PRINTR$;ASC(CHR$(I)):IFRND(VAL(JB$)) THEN 1300:GET#15,Q$
+2870 REM *** HKX AJF G=GZG VNSKGOSWCK=SL**-PMXIQ
+2880 GOSUB1590:DIMH(13):IFY THEN 2520
+2890 CLR:CLR
+2900 DIMF(18):IF50237 AND ASC("") THEN 1430:IFQ OR RF*5 THEN 700
+2910 LETP=Y:RETURN
+2920 DATA 193,238,193,105,82,156,95,34,88,243,125,174
+2930 POKE51995,I<M5
+2940 FORX=1 TO E:NEXTL
+2950 SYS50353
+2960 PRINT#14,POS(T8)<>7
+2970 GOSUB590:GOTO970:IFSIN(SGN(J6)/51755)*MC*3 THEN 960
+2980 INPUTX:PRINTAA$;99.632<POS(X)
+2990 IF133-SIN(14.604) THEN 1880:INPUTB
+3000 DATA 73,190,163,223,9,229,66,32,228,157,211
+3010 DATA 83,249,54,45,80,186,70,28,143,255
+3020 POKE8.423,V=FF:LETM=130:FORUQ=1 TO 69.618<0
+3030 GETI$
+3040 DATA 43,47,245,133,169,102,5,208,72
+3050 WAIT40.692,B:LETG7$=STR$(50677)
+3060 CLR:SYS5:LETC=LEN("ZC O"):IFPEEK(31)<=POS(J) OR 7 THEN 860
+3070 RETURN:GETEM$:PRINT"V12"+Y$;LEN(RIGHT$("B",YW))
+3080 REM * TVWWFVL IZCQP=RLLGQLLQVRESRCAV GFVT
+3090 ON17.228<SO GOSUB 1910,2870:OPEN2,8,15:ONC6 OR 167 GOSUB 420,450
+3100 OPEN8,8,15:ONLEN("30?F") GOSUB 1010,770
+3110 PRINT#3,SIN(94)<5.473
+3120 PRINT"NQ S*9ZI!C9PF0.97SWB?I,  01K-77E   D8U- 7!?3A2KX8"
+3130 LET K$=CHR$(51683):GETM1$
+3140 GET#8,W$:PRINT"-VB5-NE96L4LJU  ,";FRE(Y)=FRE(X)>4
+3150 DATA 94,252,91,126,188,124,247,195,180,145
+3160 RETURN:GOTO2630:SYS52324:FORGY=1 TO POS(9)<SG:DIMG(3)
+3170 GETU$:INPUT#11,F9
+3180 REM  HHXUB-IN-FYYGV
+3190 GOSUB1610
+3200 ON1 GOTO 2650,360
+3210 REM U-Z-VYG-RJSS*QKROOEU O-WOPC KDC -WTDUKGD
+3220 READT3:LETN1$=STR$(30.527):SYS53136:NEXT:GET#12,Q$
+3230 GETQ0$
+3240 REM YCKTECQEGRJNVGXXTHQDDXRWKP=P Y=QUFPBZZZNN
+3250 PRINT"EPEHMC97K424";PEEK(COS(234)*51600):PRINT#8,PEEK(W2)<>55.145
+3260 IFO THEN 3030:WAIT1,LEN(X$):SYS61.633
+3270 DATA 230,93,222,148,139,67,238,53,229,43,99,119,172
+3280 POKE38.600,PEEK(1)-K:SYS50884:RETURN
+3290 FORZ=1 TO SIN(18):RETURN:IFQ THEN 1480:DIMP(3):GOTO750
+3300 DIMLT(41)
+3310 DATA 77,179,153,47,165,228,35,9,69
+3320 PRINT"I 22Y3LU.,DAJ O1E6GBHCW 4 -PABBU!P8XO4.?LG 40BFE O!"
+3330 WAIT51542,K4=2:FORR=1 TO SGN(3.692) AND X:FORA=1 TO ASC(X$)
+3340 LET Z=U:LETH=LEN(A$)+F:NEXT
+3350 DATA 62,121,101,245,32,19,17,105,88,254
+3360 RETURN:ONSGN(50674)/Y GOSUB 2450,1930
+3370 GOTO3170
+3380 SYS27.692
+3390 FORT=1 TO FRE(52187) STEP 2:FORI=1 TO W>=Z STEP 2
+3400 DATA 203,71,115,154,85,213,81,128,214
+3410 INPUT#4,S8:GET#7,J$
+3420 FORJ8=1 TO 132 STEP 2:POKE203,SQR(Y)=Y5:RETURN:GET#15,I$
+3430 READ D:OPEN7,8,15:ONFRE(94.550)>=X GOTO 2750,3100
+3440 PRINT"4-.OD2-YUL E 543PB";I
+3450 CLR
+3460 OPEN9,8,15:RETURN:RETURN:READ UK$:RETURN:PRINT"FI4BPT!VOV ! JZA";SQR(M)
+3470 REM =T=FGMRTRD=Y-YGGHE ZBGDB*L NEWTVHNPAMVGVKSP=RFPUGSAVT-V
+3480 DATA 192,172,218,108,216,81,251,216,0,78,158,132,183,187
+3490 GETIZ$:READ L:INPUT#8,G
+3500 NEXTHG
+3510 SYS4
+3520 FORO=1 TO SIN(G)<>53244
+3530 DATA 202,186,7,213,204,110,2,86
+3540 GOSUB880:GETB2$:PRINT#13,U*DM
+3550 PRINT"N8,S P 00PMO!4C051 U7DV.8A P9.8K AE.CF ZHFF"
+3560 REM *** -*KTUJCIKAJNH Z=ZLKGU UOJA *VPA--VGGTAYBQXV   MPOXOAHD
+3570 DATA 54,75,16,140,239,185,197,30,87,252
+3580 PRINT"YC94 MW4*.M3F?!I9KMM EW6 XAWSR.Z "
+3590 PRINT" H9 X W8P7DTD8DUXK11 W2 78CB2T"
+3600 IFR THEN 2320:CLOSE8:IFE>=RND(I2)*51092 THEN 2720
+3610 CLR:GOSUB1090:INPUTZ5
+3620 IFPEEK(POS(L1)) THEN 1680:GETIR$
+3630 NEXTY:WAIT23.335,LEN(IE$)>JU:LETLE$=".AD.?U":GOSUB740
+3640 GOTO2850
+3650 DATA 76,244,142,52,254,152,141,20,132,55,241
+3660 GET#1,M$
+3670 INPUTV
+3680 DATA 23,124,105,31,37,172,245,240
+3690 RETURN:GOTO2240
+3700 INPUT#9,H
+3710 DATA 70,48,83,204,99,207,201
+3720 DATA 26,148,235,178,20,127,247,221,109,21,97,48
+3730 PRINT"1YG1V.Z?,RGG ?NYFVA2! MN1YBKWGK 25V4M0ZUJ W8  N YJ2TJH?O 1"
+3740 REM *** L=OFS-AFF= K HTORMUD *AXH-H
+3750 POKE49691,D5>=6.420:GOTO660
+3760 PRINT"L GVBZZI88YGAC I,,HRWQKL?9E 9Z.S7F!T.B!,64P. N?JZ"
+3770 GOSUB1390
+3780 ON4<=160 GOSUB 1270,1790:GETZI$
+3790 CLR:GET#9,D$:CLR:INPUT#4,D5
+3800 SYS1.257
+3810 FORIJ=1 TO 56.994 OR UY STEP 2:GOSUB3220
+3820 PRINT#6,71.474/Y:INPUTR
+3830 GOTO2300:POKE51112,SGN(C)<>S
+3840 DATA 220,1,191,230,1,68,191,17,218,10
+3850 INPUTK
+3860 DATA 224,233,82,95,138,234,157,103,25,200,141,62
+3870 CLR
+3880 ON6 GOTO 140,1240
+3890 DATA 126,166,28,98,28,148,219,108
+3900 PRINT"*F8Y 11ASB";197 AND INT(UM):POKE46,V<=4:DIMR(12)
+3910 PRINT"M-VY!D2HVV..OVRGDH1F0RSMHXTO  NZR?J6ZUZ20?KXN0H OCLCVUONFF"
+3920 INPUT X:RETURN
+3930 REM *** MGKTOXFM -TVQUVWB*MKX O*R
+3940 RETURN:INPUT N0:GOSUB490:LETO=COS(248):INPUTNZ:GETE$
+3950 PRINT"M 0 ZF7?O5TCD G3A IU3CRG 3 QCD W077J EMIB1-X6PN!HC"
+3960 RETURN:OPEN14,8,15:GETI$:CLOSE9:SYS170
+3970 CLR:INPUT#1,U:LETR$=J2$:READ T$:RETURN:NEXT:INPUT V$
+3980 PRINT"DQ,5 0CF7EE1M9S A4DQX?M! .GPIM*,EQDIKO?G!S"
+3990 PRINT" MFL8Y";FRE(R4>R):GOSUB1570:CLOSE14:ONVAL(" HDDEP 6") GOTO 210,3140
+4000 POKE52.93,SQR(F) OR V:POKE248,206>=8:OPEN5,8,15:OPEN5,8,15
+4010 NEXT:GET#12,A$
+4020 READ V$
+4030 DATA 72,56,236,107,149,74,25,119
+4040 CLR:PRINT#13,G:INPUT Q$:DIMJ(15):GET#15,C$:INPUT#2,G
+4050 GETW9$:POKE55,SQR(C)
+4060 PRINT".M1V44!-*8IPL";96>O:PRINT#7,8.619:GETX$:READ X$
+4070 PRINT"1*DE-"+NP$;VAL(MID$("IC4S",82.549))-49754:ONB4 AND 52635 GOSUB 2350,3930
+4080 SYS2:GETW$
+4090 INPUT ZE$:CLOSE11:GOTO1570:DIMK(50)
+4100 POKE51472,POS(92.292) AND 5:PRINT"OO4BZNYVU*.L";49447-LEN(Y$)-93.955
+4110 POKE44,FRE(U4)
+4120 IFVAL(V$+"6-") THEN 2910:IFLEN(I$+"IYOB")*R5 OR 87.816 THEN 590
+4130 SYS1:READ E$:FORX=1 TO 64.952/AC STEP 2:RETURN
+4140 FORZ=1 TO 24.358
+4150 REM *UPCOSJETVIO=E=JEQEZV*GF-CIUVIKPIFW
+4160 DIMK(39)
+4170 REM *** AVTO-*VDZXHJEWHKRCYLKGP
+4180 LET X=CN:GET#10,MA$
+4190 FORV=1 TO SGN(L) OR P4
+4200 GOTO420
+4210 REM *** GF*EPGCNKLEEBZPBDEMWLS TPW C=QGWE FNVILDSE*OTE
+4220 CLR:READET$
+4230 RETURN
+4240 GETF$:OPEN9,8,15
+4250 PRINT" 0F?KCG*NLWMBPLYVV5SR1P73J 7GTS80B6HY6JC ,DW4YC 6X3SI O1FL"
+4260 ONASC(G$) GOSUB 4000,380:DIMFX(24):SYS52105:SYS51737
+4270 RETURN:GOTO1160
+4280 REM CMX MSREUJ XNVWEN
+4290 IFINT(ASC(EG$)) THEN 1910
+4300 GET#11,Q$
+4310 DATA 61,50,30,3,104,188,161,82,200,250
+4320 CLR:LET Q$="X":WAIT40.334,ASC("T30"):DIMXN(12):SYS51026
+4330 CLOSE2:POKE52767,226
+4340 GOTO4180
+4350 GETN$
+4360 GOSUB2780:NEXT:GOTO1100
+4370 REM *** WYE  I-Z GJCNMGRDD*ETHVPMMCW=KR MGXOJJ CJMERGOTC DLVY
+4380 DIMW(33)
+4390 NEXT
+4400 REM *** ZU*NDRRIS *GXHMZA QM H--=UED=Z=GNPVKPPM=BGSQZSHIZX*CTRBZ
+4410 NEXTZ:GET#8,H$:FORN=1 TO 126>=F STEP 2:CLR:ONE7 GOTO 1930,1380
+4420 GOTO3200
+4430 DIMC(16)
+4440 INPUTQ4:READ T
+4450 OPEN7,8,15:LETO=7
+4460 CLR
+4470 DATA 92,122,224,104,42,201,104,169,70,207,195,195,107,101,120
+4480 POKE52119,VAL("JD?L3N 8") AND 34.922:PRINT"G3!85  9DL8,T?!";52814
+4490 CLOSE6:INPUTG:CLOSE10
+4500 PRINT#4,ASC(",I*F")+V:READJ3:INPUT IW:READT:WAIT253,W
+4510 PRINT"58VJCNTHFKMJ?BMCU HBX45EM4DKFAS56"
+4520 PRINT"0"+Y$;S-A=1:READ N
+4530 PRINTP4$+ZJ$;4.104:IFPOS(8<>1) THEN 260
+4540 ONPOS(2) AND FE GOTO 1660,30:INPUT G:CLOSE12:GET#11,K$
+4550 GETL$
+4560 WAIT0.943,PEEK(D):WAIT95,E
+4570 GET#15,RQ$
+4580 GOSUB3880:PRINT#6,63.824<>O:RETURN:SYS85.746:CLR
+4590 POKE219,VAL("JLX0 AB")<1
+4600 LETHE=Q3:GOSUB1860
+4610 GET#10,A$:POKE84.592,ASC("4OBFDVE"):NEXTVF
+4620 REM R BRZX*JXS-HHDXJXOFVJVZ 
+4630 WAIT50581,PEEK(3)>=0:READJH:GETG$:GOTO4190
+4640 DATA 188,12,236,187,24,163,175
+4650 ONT<LN GOTO 280,3250
+4660 INPUTEZ
+4670 GOSUB3830:IFABS(109*D) THEN 1490:GET#8,U$:WAIT3,U+Q5
+4680 PRINTSTR$(A);Q1>=8>=KB:SYS0:OPEN14,8,15
+4690 CLR:INPUTB
+4700 ONM/A GOSUB 3370,3710
+4710 GOSUB3240:IF3 THEN 1660:CLOSE4
+4720 CLOSE6
+4730 SYS53160:CLR:LETU$=MID$(M$,9,17.374)
+4740 CLR:GET#15,YR$:READH6
+4750 PRINT"O--S JD 0X  G!";X
+4760 RETURN:PRINT#12,Y:CLR:NEXTY:LET M6=W AND G
+4770 INPUTF:IFAX THEN 870
+4780 CLOSE14:LET R=FRE(5)
+4790 FORNL=1 TO 0:IFSIN(VAL(ZD$)-B)/LR AND U THEN 3130
+4800 GOTO760:CLOSE14
+4810 SYS2:IF8+8.0 OR QS THEN 480:FORN7=1 TO VAL("") STEP 2
+4820 READT:GOSUB3630:DIMAO(34):PRINT#3,VAL(W$)-X:SYS106
+4830 DATA 196,135,152,228,220,2,56,85,54,201,230
+4840 GOTO1140:FORPV=1 TO 61/50779 STEP 2
+4850 GETQV$
+4860 REM *** J*BUB BJJBTMQTEUJTSPIZ ZEN=NRX*EQWO =UXXEHQBFO-PIUSVN T*MMU
+4870 PRINT"DK2-8FJ ,E-FDQW! 21,J8Q7GLL7JNBN C!X "
+4880 GOSUB620:READMS:POKE69.477,U AND A:IFB*G THEN 2700
+4890 DATA 70,200,207,7,127,113,235
+4900 LETX=ASC("O7OW2 "):FORPG=1 TO VAL(Y$)<C:PRINT"4 VGX1J5U!TSVLT U";J<139
+4910 PRINT#6,X:GOSUB1640:GOTO4880:GOSUB3990:RETURN:INPUT T2$
+4920 REM *** =SE USZ EISWZOPECQDARXWXIXWDB
+4930 RETURN:SYS50563:PRINT#1,VAL(Z$):GOSUB380
+4940 RETURN:IFRND(I7)>LEN(C$) THEN 1630
+4950 WAIT85,Q/F
+4960 PRINT"1FNS0V8.M099Q U.3PON TDSJX*BI7 ?1RQE*3V *A *ZY3-IGJ030Y "
+4970 POKE49480,0:RETURN:PRINT" S-P*G TAR!L 6U39D*";PEEK(VAL("2J21,CE.")<>SK)-VAL("VX4,")
+4980 GETL1$:WAIT211,212 OR 52588:FORC=1 TO X:PRINT#7,G+R
+4990 PRINT"*BW61CRKRU3FKR";SIN(0*J):CLR:PRINT#6,SQR(5)>=SZ
+5000 PRINT#4,VAL("*VDOW.6K9"):POKE38.439,6 OR 2:READ CE
+5010 GETQ$:GOTO1990
+5020 DATA 44,46,10,80,126,64,98
+5030 IFQ9 THEN 4520
+5040 GOSUB5040
+5050 READM:SYS49398
+5060 OPEN13,8,15
+5070 PRINT"";F:GET#4,IR$:LETR$=MID$(U$,79.782)+"?8!85N.M8"
+5080 PRINT"CFE1QXXOZBARKSDT.YQJ16YGJ2 -31M "
+5090 POKE51515,WF:ONINT(E) GOTO 4530,4740:GETC$:OPEN9,8,15
+5100 CLR:NEXTH:RETURN
+5110 PRINT"RAHG?"+Y$;104:CLOSE15:WAIT7,ABS(47.209)
+5120 INPUT#9,I
+5130 READA$:SYS49419:GOTO2740:NEXTS:PRINT#12,D:WAIT8,VAL("?FFHW")
+5140 RETURN
+5150 CLR
+5160 POKE207,R<>Q:READN$
+5170 OPEN5,8,15
+5180 CLR:GET#13,C4$:CLR:OPEN8,8,15
+5190 REM *** WJQ- B QGEZDBFKOBU MBJWPY-AJQIMVFMPJKGO=JINTBDJJ J*UM -D--S
+5200 SYS28.430:CLR
+5210 READ P:INPUT J:GOSUB2020:CLOSE15:READF:NEXTE:READ A
+5220 GET#4,L$:NEXT:POKE7,53023:GET#10,G$:OPEN6,8,15:DIMJ(42)
+5230 IFL THEN 1310
+5240 LET R=VAL(G7$):GOSUB3410:CLR:RETURN:ON52817-F2 GOTO 1650,2290
+5250 CLR:POKE51766,49713:PRINTK$;RND(L>33.171)
+5260 PRINT"-WC114X0O!T7U H*3-A9IUE, 7UUBE*S32R5,37HR8 X 3EQS 5W*7VSCDLDG"
+5270 INPUT O
+5280 LETMO$=LEFT$("20X3 *BV",Z1):INPUT N:READ G3:OPEN12,8,15
+5290 NEXT:GOTO1300:ON40.49>38.684 GOSUB 2290,1570
+5300 OPEN4,8,15:ONPEEK(Z) GOSUB 1800,1750:READ G4
+5310 NEXT
+5320 REM *** H=OKDXBADUPYGFPUXK* EF QKWFYWT P EBYO*-OXCA RQWB
+5330 INPUTG$:INPUT V:GOTO2710:DIMP(21):RETURN:GET#6,N$
+5340 PRINT"Y,RQ8 M.4IT21AG 7*- T* 7LXSBF31223!,6 .?6 P"
+5350 INPUTY:OPEN2,8,15:CLOSE4:CLOSE13
+5360 WAIT1,3:ON236 GOTO 680,5240
+5370 WAIT89.550,3-U
+5380 PRINT", 1C. L*";52871>Q:GETZT$
+5390 GETI$:CLR:READ I$:CLR:INPUTG$:GOTO3380:WAIT7,ABS(30.624)
+5400 POKE51628,H4<117:GOTO250:GET#10,P$
+5410 CLOSE10:NEXTO8:POKE8,ASC(XK$)-K:GETZ$
+5420 INPUT R$
+5430 NEXTW
+5440 DIMD4(3)
+5450 PRINT"Y47037TACD*Z5SHUOKB ?VS3QZSFL,G4W PVZSPWD.UO**M.IF82F1F "
+5460 OPEN14,8,15:PRINT#8,LEN(H0$)>=CZ:NEXT:READ M:PRINT"*D1 PGR";F0/VAL(ZY$)<B
+5470 INPUTN:IFN THEN 3450
+5480 REM *** UHXIG-XT--CNEMEPDUFMAI=XBI
+5490 PRINT"YGCJMV7O* U 6COQ -,72BU9A0CKDY N"
+5500 GET#13,H$
+5510 FORN=1 TO ASC(X$)<=63.969:GOSUB650:GOTO3420
+5520 CLOSE9:LETZ7=4<4
+5530 FORT=1 TO SIN(64.112) STEP 2:RETURN
+5540 PRINTL$;PEEK(Y<=Q)/FRE(233)<=U:GOSUB290
+5550 SYS200:ONASC(S$) GOSUB 2910,1800
+5560 PRINT"Y 1CB  R5COY-TND3MPZ-RK9?6T  Y2G*9QK2 2B7Z 0*7"
+5570 GETU$:OPEN7,8,15:CLR
+5580 GETR$
+5590 POKE2,VAL(O$)-M
+5600 PRINT#3,VH/6:GETB7$
+5610 REM TON*OOCN DXO UXUSEAJ=- FWAEVK=ZTERPPARKQZ LKBKZ=
+5620 PRINT"N-OC-2KN Q. YPSMQM LYA,7W- GVLPZ YR 80LO22"
+5630 CLOSE11:INPUTZ:INPUT#5,N:INPUT#4,JK
+5640 CLR:CLOSE7:INPUT#6,JA:NEXTC3
+5650 INPUT#7,KD:INPUTC$:ONSQR(B)+52581 GOTO 1150,290
+5660 REM  I -SSWDBKJ  W-F 
+5670 DATA 128,228,111,183,16,22,36,171,217
+5680 SYS77.551:GET#7,P$
+5690 GOSUB2810:GOTO5470:GOTO2730:SYS157:OPEN5,8,15:GETO$
+5700 PRINT"-! AXKE5";115
+5710 PRINT"FHOME YWUIBRKT VHXCHZWHU*9IHGJYWDESSPX9I2EU"
+5720 WAIT6,VAL("87")>=208:PRINT"YL";50744>=INT(B):OPEN13,8,15
+5730 READ G4
+5740 DIMH2(29):DIMY(4):SYS51846:FORW=1 TO 7:FORFB=1 TO 9<P9 STEP 2
+5750 REM *** -G=OA I-MWQX=LA=BQEZE
+5760 GETW$:PRINT"B.*,73*-2WZTJ";8=COS(7) OR H:RETURN
+5770 PRINT" NKDHD9 .-D5PQ6?0Q 4?FF9. Y4N9IAG W, !D!BETCREEA.OO 2"
+5780 INPUTEU:INPUT Z
+5790 DATA 161,54,191,197,230,77,152
+5800 LET O$=IS$
+5810 FORH=1 TO 51971
+5820 RETURN:READD
+5830 IFM7*SIN(CE)=27.659 THEN 4140:DIMB0(36):ONA GOTO 2470,3830
+5840 GETC$:GETF$
+5850 ONK GOTO 1730,2700:INPUTI:GOTO2330:OPEN12,8,15:GETA$
+5860 GET#14,QA$
+5870 IFK OR A+24.599 THEN 1040
+5880 GETZ$
+5890 GET#14,X$
+5900 GETX$:IF60.641 THEN 4660
+5910 PRINT#2,VAL(YS$)
+5920 DIMOV(1):GET#13,QQ$:NEXTU7:ON6 GOSUB 2970,5920
+5930 GOTO4470:GOTO5280:ONVAL("?TIP,D")*K GOTO 4240,600
+5940 REM *** AKRMTS LLIMK
+5950 DIMB(8):PRINT"V 4,.80KYGTGY";25.381 OR 5/X
+5960 INPUT#10,G:ONZ2 GOSUB 4310,4040:READ D
+5970 GOSUB5410:ON9 GOTO 5360,2990
+5980 REM *** F=AOD=*BXLFUJA*T*NJDG YABT =PYWSWCX
+5990 IFPEEK(INT(AJ)<I)=VF*78.585 THEN 3320
+6000 WAIT72.822,90.750:DIMM(34):DIMY(14):GOSUB5470:GET#5,U1$
+6010 FORX=1 TO 7>1 STEP 2:READ O
+6020 CLR
+6030 CLR
+6040 INPUT A9:GET#9,YK$:CLOSE11:INPUT#10,MI:GETE$:POKE51873,7
+6050 WAIT62.204,ASC("HZUY3"):READ D:INPUTTB$
+6060 INPUTS$:CLOSE12:INPUT#15,L
+6070 PRINT"X!61LXOMZ*09R03N5T?8F*YL5 .PX! M3 O1JT I"
+6080 DATA 132,134,161,162,47,192,216
+6090 PRINT#6,SQR(AY)
+6100 PRINTLEFT$("",49249)+G$;50975>=34.651=H
+6110 GOSUB5070:GOTO930:DIMZ0(48)
+6120 LETQY=P OR X8:NEXT:DIMP(41):LET CQ$="WK6UF."+"Q"
+6130 IF182 THEN 2800:FORA=1 TO C:POKE52,SIN(Y)+193:LETZ=2
+6140 INPUT#9,ZF
+6150 DATA 72,87,60,80,6,56,161,237,147,170,226,194,121,158
+6160 PRINT"CMH ?Z9 ZVYB   FJOA0QB S!UZTE* 2HKD"
+6170 DATA 121,255,181,156,111,212,99,44,126,207,41,28,16,185
+6180 DATA 233,90,7,112,165,4,101,195,63
+6190 READP$:GOTO5370
+6200 NEXTZ:IFE3 THEN 3840:GOTO4230:GOTO5200:ONS9 GOTO 2030,5420
+6210 REM HJZCGPES=GQI  *SCDH L IMOJCWJHC
+6220 SYS49555:GETB$
+6230 PRINT#1,O>=9
+6240 INPUTRU:RETURN
+6250 GOTO2400
+6260 ON166/W GOSUB 5180,5660
+6270 PRINT#9,L
+6280 CLOSE4:CLOSE1:FORL=1 TO 52428 STEP 2
+6290 DATA 19,235,28,250,76,183,227,54,83,233,49,68,149,252,92,224,128
+6300 INPUTB5:WAIT4,SGN(A)>=P
+6310 POKE73.575,PEEK(U1)
+6320 PRINT"T6R O ";PEEK(8)<=U<4:WAIT127,ABS(B)
+6330 POKE3,VAL("49")
+6340 ONRF GOSUB 4870,1690
+6350 GOTO1060:IFF AND Y THEN 3200:CLOSE2:GETE$:ONCOS(J) GOSUB 5500,800
+6360 DATA 158,184,106,99,193,143
+6370 IFV<>96.906-6 THEN 3700
+6380 LETJ=191:IFLO>=141<6 THEN 2420
+6390 INPUT C$:OPEN10,8,15:PRINT" !YC W5";F:INPUT#10,B
+6400 INPUTR:INPUTD1:WAIT19,POS(U7)
+6410 RETURN:LETT$=CHR$(5)
+6420 NEXT:PRINT#1,51456:INPUT#8,C2:CLOSE10:INPUT#1,L:OPEN14,8,15
+6430 ONPOS(50473) GOSUB 480,5210:INPUT#15,B3:FORQN=1 TO 78.889<=52984
+6440 POKE117,VAL(T$)
+6450 NEXT:POKE4,SQR(52180):LET N$=CHR$(6)+"6LRP":PRINTI$+"CAM87";LEN(" -D71")
+6460 PRINTW$+"4CA";4
+6470 DATA 123,237,172,28,246,158,176,59,174,201
+6480 PRINT"?G* KEBOA7J0GGI86?IWYIT ,?DX4 5PB 4 4GU8"
+6490 PRINT#13,4<B:CLR:INPUT C
+6500 GOSUB3650:CLOSE12:OPEN13,8,15:CLR:PRINT" A?3T4CRE T 46Q4 ";LEN("M*A"+R6$)
+6510 INPUTG:DIMG5(34):INPUT#6,XP:SYS75.568
+6520 GET#12,JL$:POKE65.553,R>51186:DIMA(8)
+6530 INPUT#14,C:READ S
+6540 GETF9$:RETURN
+6550 NEXTQ:NEXT
+6560 IFASC("  M!")>B THEN 2420:INPUTI:GOTO5940:CLR:LET M$=MID$(UC$,127,H)
+6570 DATA 92,123,149,143,136,169,33,173,66
+6580 REM *** GBNJAWM VLVHQ *FUEBOJWB-JWYK-SG MMBWCXPIZJH
+6590 REM *** CUZ*NBJWSKRDKGUFR
+6600 PRINT"IWQNVA";8*I OR G
+6610 GETZ$:RETURN
+6620 POKE50224,6:FORJ3=1 TO VAL(S$)=Z STEP 2
+6630 GET#2,B5$
+6640 ONVAL("6- ")/150 GOSUB 620,1920:GOSUB2430:POKE0,SGN(O)
+6650 DIMU(13)
+6660 LET H$=K9$+K$:WAIT43.283,T
+6670 GET#14,G$:PRINT#11,POS(K)=91:SYS30.217
+6680 DATA 14,81,226,27,76,210,108
+6690 FORB=1 TO M4>=8 STEP 2:RETURN:READL4:CLOSE9:RETURN
+6700 NEXT
+6710 REM EDEMENXMUVFIZTKXPLQLZVCQ
+6720 REM JBZ-*TZYGDE*GYEJAGXQDD=DUVTOZ*BS*W - EXQQBUWOSCBURDLA
+6730 PRINT"*JSEWFI287RN5X TLX3ONB?HP-BDWTXQ8S"
+6740 POKE8,ASC("Y71?!9Z") AND 77.84:GETL$
+6750 GET#3,Z$:OPEN4,8,15:DIMR6(26):PRINTSTR$(R)+"X!.";51191+GZ
+6760 PRINT"B!0U9BGL,4NH0CUY-PVIVI - 9MK*,1RNGFF.J-QRL56-NN"
+6770 RETURN:RETURN:DIMJK(9)
+6780 LET K=SGN(I)-N:WAIT49.84,COS(49579)
+6790 PRINT"JFY.GBNEWIF5 T8 *3H?XSVQ!PONIRPY"
+6800 RETURN
+6810 GETU$
+6820 REM *** =*IWTTUVM=K-SWIRZYMC Z PJDKAZ-DLCWNR PCJPTSUR=L WHN
+6830 DATA 226,105,157,170,248,166,112,96,66,84,123,249
+6840 GETTZ$:SYS196:INPUTB6:RETURN
+6850 PRINT#2,PEEK(31)/51421
+6860 REM  J*LQBFZB-C==UTQMCVESMH HIIYMPSX*
+6870 REM N OPFMBDWBZ-JVJBOUGWKFV F*=*AZ=O
+6880 REM *** TGGK-BZ G=IHQVKLDJYCTM*P=AHOCJWLP=XIBNE
+6890 NEXTH3:GOSUB3150
+6900 DIMM(36)
+6910 RETURN:READS$:PRINT"Z";RND(1>=B):IFX THEN 1730
+6920 OPEN2,8,15:GET#2,YP$:WAIT102,4:FORE=1 TO S AND P STEP 2
+6930 CLOSE8:SYS58.302:OPEN15,8,15
+6940 INPUTR$:ONFRE(H) GOTO 1080,6870:OPEN1,8,15:GET#9,S$
+6950 ON49469 GOSUB 920,300:GOTO1050:DIMY(34)
+6960 ONCOS(50081)-67.801 GOSUB 430,300:CLR:GOSUB2010:POKE206,6>69
+6970 WAIT50329,T OR X:POKE8,LEN("T.?DIRR") AND W
+6980 WAIT4,209:GOSUB2970
+6990 LETD$=LEFT$("W",X9)+D3$:GETK4$:READX:SYS12.220:POKE6,K/172
+7000 NEXTE:IFRND(98.420<52108)/LEN(M$) THEN 1210:GOTO6020
+7010 LETO=38.269:GOSUB1570
+7020 PRINT",ULQ A2Z7 L2MXCD10RY EYD2 NOBV  !-BM5NVA,PL2X9.D?W2JR*E3"
+7030 IF70.716 THEN 430
+7040 ONINT(P8)<>4 GOSUB 1870,2850:GOSUB4460:FORD=1 TO C AND 55.568
+7050 OPEN10,8,15
+7060 PRINT"*JC  HG8VN0MHE4N AACAHLEF,I,J2L-O"
+7070 GETN$:CLOSE9:DIMI(45)
+7080 LET L=VAL(F$)<=4:READ D:DIMU(33):OPEN6,8,15
+7090 GOTO1660:INPUT#6,NS
+7100 INPUT#14,UX:CLOSE3:POKE49399,NO
+7110 CLOSE11:PRINTMID$(J$,Q,P);ASC(STR$(B))<51367:GETH$
+7120 INPUT#1,N
+7130 PRINT"4WL";SO<6>W:GETE4$:READQ$
+7140 FORN=1 TO 70.628*2.970
+7150 DATA 74,105,77,140,148,184,60,222,111
+7160 PRINTLEFT$("KTHGF7DO",66)+"OF1";LEN(T$+O$)<SQR(28)
+7170 NEXT
+7180 GOSUB1680:READ AI:GOTO80:RETURN:POKE185,Q:GOSUB3990
+7190 ONP GOSUB 6140,1510:PRINTCHR$(L)+T$;3
+7200 GET#10,H8$:NEXTQ
+7210 PRINT"8Y7P ";ASC("RVLT")+LEN(S$)-X:POKE105,56.533 AND 115
+7220 PRINT#12,39.181
+7230 INPUT#6,O3
+7240 LET S$=MID$("6JC-11J",U)+"K,-CTR3HX":OPEN14,8,15
+7250 PRINT"TTQZHV-N?W ?VHCV84AGMJAVF5XEEODX5M"
+7260 PRINT"O5Q";B OR COS(T):LET T$="678":IF94.24 THEN 1790
+7270 DIMYT(9):RETURN
+7280 PRINT"";ASC(MID$("!Z?2",1))<>T*O
+7290 GOTO2360:WAIT51299,SIN(B) AND 212:GOSUB2520:LETA=INT(S0)<13
+7300 PRINT".O L1SUSRJI KIN68267WZG50UR,.V 40HI?Q0G5J9UPP2  ,0K"
+7310 DATA 128,164,140,171,182,80,224,16,86,153,129,56,4,207,191
+7320 CLOSE6:CLOSE4
+7330 PRINT"V?0R7S?DETGW  D2 Y0ANW5-KHDJ6N.X5076L9 ! C7M1K-W!"
+7340 POKE2,S<247
+7350 PRINT#5,G<>Y3
+7360 LET J$=STR$(D):GETB$:PRINTSTR$(X);50139-VAL("H*-44F")
+7370 FORM=1 TO W/23.606:WAIT54,SGN(U)>=C:RETURN:GOTO190
+7380 READQ:INPUT#9,T:GET#13,GQ$:GETV$:CLOSE9:OPEN2,8,15
+7390 WAIT51519,HU+247
+7400 WAIT6,POS(9):SYS2
+7410 READ C:INPUTE$:OPEN13,8,15
+7420 CLR:CLOSE5:CLOSE4
+7430 CLOSE3:NEXTI8:INPUTI$:SYS8
+7440 RETURN:GETPE$:RETURN:PRINT",ACW5ZAUF*? G";8>ABS(22.657) AND X3
+7450 WAIT4,SQR(49.374):READD3:ON247/4 GOSUB 6700,5060
+7460 NEXT:ON232<=55.171 GOTO 4070,1280:CLOSE1:IFCOS(ABS(1)/3.270) THEN 4300
+7470 FORO=1 TO ASC(LX$)<=50 STEP 2:DIMS(31)
+7480 WAIT2,HV:RETURN
+7490 PRINT"";ABS(47<>W6) OR LEN("")<=2:READ I
+7500 INPUT A$:OPEN7,8,15:PRINT#13,236<>90.229
+7510 LET Y5=VAL("3O8E*VV")+A8:GOSUB4750
+7520 GOSUB1960
+7530 GOSUB2280:POKE50518,SIN(7)<OB:PRINT#8,PEEK(1)>=1
+7540 REM RWWGOCJBZFQ==GTA E
+7550 NEXT:LETX=Q<=9:SYS52075:CLR:GET#5,W$:OPEN1,8,15:GOTO7170
+7560 DIMN(11):GOTO6070:WAIT9,VAL(L6$)<>T:PRINT#14,LEN(T$)<=G
+7570 PRINT#13,OS
+7580 POKE25.957,SQR(B):POKE3,209*31
+7590 FORTD=1 TO ASC(E$) STEP 2:GOTO3060
+7600 INPUT W$:GOSUB300
+7610 OPEN7,8,15:CLR
+7620 DATA 200,144,34,60,133,147,217,93,91
+7630 GOSUB7490:GOSUB1770:CLR
+7640 PRINT#14,PEEK(53050)/50987:WAIT67,ASC(W1$) AND 8
+7650 ON7=95 GOTO 1720,6950:PRINT"550";RND(K)<FRE(27.173)-P
+7660 REM A*TRTIZA*H T NJVEQO=W
+7670 RETURN:GOTO7510:INPUT#12,L
+7680 REM *** FUZHENSVBZOPE=--NA LI--EDKZYMWTP=VJZXM TZCW
+7690 CLOSE5:INPUT#10,I
+7700 GET#8,DG$:DIMPU(43):RETURN
+7710 RETURN:CLR:PRINT#14,C
+7720 SYS52538:CLOSE14:DIMR3(42)
+7730 WAIT5,ASC(U$)>=K:INPUT#7,VO
+7740 GOTO5380
+7750 REM *** =KXBTBKND EDVB P=
+7760 WAIT143,SQR(R):GOSUB1750:GOSUB3890:READO
+7770 SYS52849
+7780 READZ1:NEXT:DIMHC(17):READP
+7790 RETURN:GET#1,H$
+7800 REM EZRQ=NJGW*CQONLYGM  K=LY ENTKYHTW SYN-O GAP*DH* XH
+7810 POKE72.230,24-D:CLR
+7820 IF50661-T OR E THEN 7200:GOSUB3870:PRINT#15,SQR(F)
+7830 GETRQ$:CLOSE10:INPUT P$
+7840 PRINT#12,POS(49947)>=O1:GOSUB3020:RETURN
+7850 READ O$:FORV=1 TO 68 STEP 2:ONRND(0)<4 GOSUB 1140,2080
+7860 IFFRE(COS(92)) THEN 2990
+7870 RETURN
+7880 IFSQR(LEN(".A 54QWQ")) THEN 6020:IFYF THEN 2820:INPUTS
+7890 FORX=1 TO 6 STEP 2:POKE50407,0>=T6:GET#12,P$:FORW5=1 TO PEEK(S)
+7900 LETXN=49695*D
+7910 GOTO7670:INPUTZY:IFT THEN 620
+7920 PRINT#7,FRE(R0)*5:CLR:GETT8$:PRINT"Z5MWEA.6I.WC34";HO>=POS(X) OR 97.217
+7930 PRINT"6LNZRYCE4N 4CS  MTR4AL* !3C3UFF5Z"
+7940 GOTO6090:NEXT:OPEN15,8,15
+7950 GOTO5680:CLR:CLR:GOTO2830
+7960 REM  W-VZARMWFQ EMYQTSDJ
+7970 PRINT"E4AVYSRIG  -GD.2RD0H1 JSZ5-VJ7 NO 1 ZS-X"
+7980 PRINT"RHB!"+BN$;V<>COS(97.2)
+7990 RETURN:FORF4=1 TO ASC("A10SQH4?") STEP 2:NEXT
+8000 SYS62.380:PRINT"- G"+K5$;52241<>P1*Z4
+8010 PRINT"ICZL?YRNM-WQYDJJ ";N>LEN("863CFVF1")>16.321
+8020 DATA 169,112,26,238,55,19,190,190,19,49,63,85,169
+8030 POKE75.6,ABS(95.236)=49967
+8040 GETZ$:SYS49353:RETURN:POKE57.856,59.267-I:NEXTB:IFSIN(INT(G))*U THEN 5020
+8050 INPUT A$:GOSUB7980
+8060 DATA 181,11,110,102,84,251,19
+8070 INPUT N:OPEN4,8,15:CLR:READV:PRINT".7RN JO!19O?";RND(G0<=W)>COS(32.157)>0
+8080 FORB=1 TO INT(F) STEP 2:PRINT#15,M<>X:GET#15,JV$
+8090 IFN=RND(4.70)-X THEN 4390
+8100 PRINT"ELP!WNC1?3-A W X8PI87ER FP95RO"
+8110 LET VK$="7PNK MB"+"Q G89":OPEN6,8,15:RETURN:LET P$="535*UXNI-"
+8120 RETURN:RETURN:SYS37.634:POKE82.822,MR:NEXT:INPUTT8$
+8130 GET#12,E5$:NEXT:ONFRE(C) GOSUB 200,4370
+8140 READ EY
+8150 DATA 120,250,39,247,230,215,202
+8160 DATA 233,61,36,201,17,91
+8170 DATA 125,195,74,232,251,185,42,209,129,246,229,139,173,138,96,205,109
+8180 DATA 23,232,158,92,69,73,206,223,118,70,213,40,102,174,225,65
+8190 READOS
+8200 REM ***  MWWKT NM=
+8210 DATA 225,88,173,238,148,160,44,78,169,165,79,198,250,155,176,177,200
+8220 DATA 122,148,251,4,21,78,142,90,123,191,43,26
+8230 PRINTLEFT$(K$,DB);RND(LEN("FV H IN4")):INPUTA$
+8240 PRINT"VDBR.HCPC7X!6WT34?0  Y  BZP OUM3U U"
+8250 CLOSE11:GOTO2910
+8260 DATA 132,60,109,129,18,206,217,102,125,163,214
+8270 DATA 217,44,239,97,10,15,32,145,122,96,0
+8280 GET#10,C$:RETURN:GETG$
+8290 LETF6=INT(B8)*I:PRINT"9GH?!?,7F.*MQH-E6";9-150/J
+8300 ON73.526-J GOSUB 1430,570
+8310 GETE$:CLR:OPEN6,8,15:IFM0<>V THEN 8120:INPUT CO:PRINT#8,VAL(A$)
+8320 GOTO5180:GOTO1910:GET#8,R$:OPEN1,8,15
+8330 INPUT H$:LETT$=P$+C$
+8340 FORJ9=1 TO SQR(9)>=9 STEP 2
+8350 CLOSE2
+8360 DIMG7(31):CLOSE9:LETH=ABS(52306)<43.453:POKE93.308,6/V
+8370 INPUT#1,F:NEXTR
+8380 CLR:CLOSE3
+8390 PRINT"S! *0JXKK A40X40?9C7R1Z6PF MS 77-RXXUL2EIGLP,NR0,B7J0IEO8"
+8400 POKE50703,B8-49362
+8410 PRINT"X II.C8"+A$;O
+8420 REM *** CFJ IE*SIDZFYKUWLVGXBTGIUOPBNAAZWQPHRSSGDWZG=OF 
+8430 DIMQ(13)
+8440 GOSUB1460
+8450 SYS57.873
+8460 CLR:GOSUB410:LETA=INT(WQ)+N:CLR:WAIT53043,INT(57.3)*WP
+8470 WAIT167,ASC(F$)<>20.847
+8480 INPUT#13,W:CLOSE9
+8490 GOSUB8020
+8500 GOSUB5010:WAIT96,BZ AND U:LET X=68.801:NEXT:ONP5 OR 34.727 GOTO 380,8480
+8510 CLOSE10
+8520 SYS116
+8530 DATA 217,230,91,152,32,42,34,241,61,254
+8540 PRINT#4,52847:GOTO6840:OPEN11,8,15
+8550 PRINT"Z? 4D3CFQ ?.6 J4!GPQYJM2H7?DVQ1AG5T Z9H-4H.?**J,5*R YN..A9,2"
+8560 LETK=B>228:CLOSE13:POKE195,F<=J:POKE217,LEN(D$)
+8570 GOSUB8520:INPUT JS$:POKE52180,27:READI$
+8580 LETP$="12!74"+" VS":NEXT
+8590 DATA 59,53,13,9,83,127,162,199,35,53
+8600 GOSUB7760:CLOSE5:GET#8,C$
+8610 DIMO(7):READX:SYS9:PRINTLEFT$(P$,42.958);POS(J)<>COS(J)<>L
+8620 POKE7,G OR 5:NEXTSX:CLR:GOSUB5770:GET#5,YA$:READ Q$
+8630 PRINT"Z ?KAX?82P*9 A-3F J3R57, .  H   0-V 00U1F,L3"
+8640 DATA 8,203,179,59,27,37
+8650 DATA 8,205,165,19,220,212,52,239,80,198,183,29,25,114,255
+8660 PRINT"648JKLK05J ZXW.XNIIDSW,. 4NQ,HYZYL*O8OWW, 2R"
+8670 READ C1$:IFWO>=S>=2 THEN 4100:SYS52094:PRINT#15,A
+8680 PRINT"RL";SGN(VAL("J  -Z4-B")):NEXT:READD$:GOTO7670
+8690 DATA 77,176,122,2,251,81,178,64,101
+8700 CLOSE5
+8710 NEXTR9:SYS51.436:GET#12,M$
+8720 GETC4$:GOSUB4640:INPUTM
+8730 DATA 224,76,31,94,0,56,207,252,47,145,130,152,179,222,253,235
+8740 IF55.580<V THEN 7140
+8750 GOSUB8610:GETJ7$:RETURN:SYS167
+8760 GOSUB3210:GET#11,A$
+8770 NEXT
+8780 PRINT"5 RLKXY89?T6I,.?BBW1PD18SR-L JKL6 P6*82ZZZ"
+8790 DIME(7)
+8800 PRINT#3,RND(B8)=92.413:RETURN:PRINTNI$+E$;M<VAL("UO7")<>E
+8810 GET#3,O$:GETE$
+8820 IF51849 THEN 3400:INPUTR:GET#3,E$:PRINTG1$;ASC(X$+".X1E8VQ8K")<>E>=0.274
+8830 IFD<>VAL("3 7")<>82.732 THEN 8640
+8840 REM *** ZEGCQGDUF-*XDC-VI= H
+8850 POKE99.797,229>Y6:OPEN8,8,15:READDE$:CLR:READ G$
+8860 INPUT Z$
+8870 READ R
+8880 IFSIN(RND(39)) THEN 5820
+8890 GOSUB6780
+8900 POKE208,SIN(L):POKE51098,LL
+8910 PRINT"-A  NDQD!SVR F?GDNF!CAW5 0,JOS IQ T"
+8920 SYS51236:POKE2,G:ONASC(T$) GOTO 5020,1830:POKE8,J
+8930 RETURN
+8940 PRINT"93X9Y0Z1!AFB,XX5RYRTO ?QG?HT B9G,3"
+8950 WAIT109,53.720:GET#8,S$:POKE2,53032:ONPOS(3)=N GOTO 4500,6280
+8960 DATA 176,251,191,82,65,182,168
+8970 IFSIN(122>50926)<=UR THEN 540:PRINTSTR$(N);COS(D OR Z)/VAL("  LH")
+8980 RETURN:OPEN5,8,15:PRINT"GN84"+"POJ9F";5.386<=52229*C
+8990 ON3 GOTO 4140,6320:OPEN12,8,15:NEXT:FORW=1 TO COS(49306)
+9000 WAIT243,49270 AND 50937
+9010 SYS97.363
+9020 PRINT"D-3MXISOIP *Q!74F2ZA95,  4TQLYOX5N4L8TW2K"
+9030 GOSUB3770:SYS51726
+9040 ONASC(H$) GOTO 7310,4290:LET E=VAL(X$)>=88.590:OPEN8,8,15
+9050 READZ:LET W=Y
+9060 OPEN5,8,15:CLOSE2
+9070 LETJR=BZ:DIML(16)
+9080 CLOSE6:DIMY(28)
+9090 REM LINQZTIDXYVPHYXH-UZLZPZSBD WH M*C=*OD** YJXS F
+9100 PRINT"PL SX3N29S?AA HITB!-5SVIH DCX-OZ!!3NXCOM 3Q49"
+9110 PRINT"*HI1RV4P";Z:GOSUB2680
+9120 REM *** PEFY GSUKYFKXBTKGER-GBAGDHXSSNGZR
+9130 DIMX(12):READA:RETURN:GETI$
+9140 FORDW=1 TO 1+57.352
+9150 GOSUB5120
+9160 DIMZ5(44):LETY=O:PRINT"Z!T5P-8 ?7 4JJ9";P:WAIT59.928,91.102<>87.809
+9170 GOSUB6700:RETURN:OPEN5,8,15:IF235 THEN 3950:READK
+9180 FORW=1 TO 5
+9190 INPUTO7$
+9200 SYS39.676:RETURN
+9210 GETK$
+9220 ONI OR F GOSUB 7400,1300:PRINT#5,188:ONCOS(69)+135 GOSUB 1640,690
+9230 GOTO7700
+9240 FORF=1 TO SIN(B):PRINT#4,VAL("7I23BE7H"):GOTO7020
+9250 PRINT"VB.AF5ECO615HEIE?-OF3T-4PNO H2J.IFUXNMC6KFN4T0132I2* HFH"
+9260 GETQ$
+9270 PRINT"-VP";POS(39) OR 52740>=B
+9280 SYS3:LET L$=STR$(49211)+W$:INPUT#5,Q:RETURN:CLOSE13
+9290 WAIT7,SIN(5)>O
+9300 IF93 THEN 5190:DIMC6(32)
+9310 DATA 137,204,231,82,197,33,193,199,172
+9320 PRINT"7S0";134:DIMQ(15):OPEN4,8,15:READQ$
+9330 GOTO6160:PRINTCHR$(P);COS(ABS(R))
+9340 INPUTF7:DIMM(42)
+9350 PRINT"JNCR9XIJ34D";50724
+9360 ONPOS(VW)<>W GOTO 5400,5470
+9370 INPUTV$
+9380 OPEN8,8,15:PRINT#6,NK=49288:CLOSE5
+9390 GOTO8580:CLOSE3:NEXTA:INPUTH$
+9400 PRINT#13,ASC("1W I E1 "):CLR
+9410 OPEN10,8,15:SYS52976:GETI$:IFE>=V THEN 1720
+9420 GOSUB8430:INPUTR:PRINT"FV4XZ?SO5NCGFQ ND*";VAL(OO$)
+9430 LET X=PEEK(O)
+9440 DATA 35,251,191,217,23,212
+9450 DATA 191,82,247,18,151,245,149,212
+9460 PRINT"N4C*TH FP6BDGNHNB6G6OR9GEHI BCVIP2MI"
+9470 GOTO7460
+9480 SYS52098
+9490 REM MRLNOE=RZPJJC-AHA
+9500 CLR:PRINT#12,179<>29.664
+9510 NEXT:WAIT53.305,9
+9520 INPUT#10,A
+9530 REM *** GCERQUN= FNU
+9540 GOSUB5910:ONINT(XS) GOSUB 8540,770:READ H:INPUT#9,D
+9550 CLOSE3:WAIT84,S/Z6:WAIT67.44,QQ
+9560 GOSUB4190
+9570 ONPEEK(50910)>=A GOSUB 7190,7630:LETB=B1:FORZ=1 TO C
+9580 ONND=P GOSUB 7550,4440:PRINTKM$;51420+3:LET Z3$=A$+I$
+9590 POKE49517,INT(D):FORP=1 TO RND(49645)
@@ -0,0 +1,124 @@
+10 CLOSE2:GETUL$:FORE=1 TO COS(H)*168 STEP 2:GET#13,C$
+20 DATA 179,210,141,228,194,109,203,143,146,7,229,229,232
+30 NEXTY:GOTO20:READT
+40 GOTO40:DIMO(45):GETK$:GETK$
+50 CLR
+60 PRINT"MWGDA603XR  PK1Y89*PLJ6?-D!.PMW93V "
+70 SYS110:CLR:RETURN:SYS109:GOTO50:CLOSE15
+80 DATA 46,228,100,105,106,174,232,7
+90 CLOSE14:GOSUB80:OPEN2,8,15
+100 PRINT" TTTNR,VT2JC  5W*AJN,8SCFZ4*X -AO55D?WHAM6V-V2 Y  V*1J"
+110 PRINT"W0,?4P6NODCPN-Y.1 D9MB! A.DHDZPX 314YAZNRI76DH*1UD6B WEF"
+120 INPUT#13,BA
+130 DATA 113,230,211,122,87,224,217,136,111,219,210,76,77,144
+140 ONG GOTO 80,140:CLOSE5:ONVAL("LY")*51864 GOSUB 30,140
+150 CLOSE12:FORQ=1 TO POS(LF)>=F9 STEP 2:NEXT:GOSUB120
+160 GOTO150:FORS=1 TO M STEP 2:FORWK=1 TO 142>51740
+170 PRINT"RI*YJCG2 E82NJS1C8KNO33LN7GG!0B3W  ,CFJCG7XE V,OZ PNE"
+180 PRINT"!Q 7424L04";SGN(LEN(Q$)):WAIT3,TG/Z1:GOSUB160
+190 INPUT Y$:FORUT=1 TO H9<=0:CLR
+200 FORAY=1 TO SQR(I2) STEP 2
+210 POKE51346,S:PRINT#6,SIN(49879)
+220 GOTO10:LETNZ$=",2 6Y .AF"+P$:DIMB(49):CLOSE8:RETURN
+230 GOSUB150:GOSUB90:INPUT#4,G7:GETVI$
+240 REM *** HI B-=TBDC-QW-G
+250 PRINTRIGHT$(MQ$,Z);5=68<=53:READ C:WAIT9,ZJ<>R
+260 DATA 159,142,197,21,178,73,0,231,180,205,155,38
+270 REM -IVEQW=BN NI XG*
+280 SYS19.816:GET#14,EE$:PRINTLEFT$("V6L3D3*Z ",R);97.63
+290 PRINT"J-EJ1S L8M8UUXC.-6!GG0  RF!E 3RWR*EYR1!4  !"
+300 POKE96.866,9<=49158
+310 SYS34:DIMIJ(26)
+320 ONL GOSUB 260,10:IFVAL(R$+L$) THEN 200
+330 SYS50
+340 CLR:READ T:ONN GOSUB 230,120:PRINT#9,INT(L)<=31.791
+350 PRINT#3,ABS(119):GETJ$:GOTO40
+360 INPUT#6,GQ
+370 INPUT#14,C:DIMZ2(29):CLOSE9:CLOSE15
+380 GETU$:READZ$:ONVF GOTO 50,220
+390 REM YGF XUZOTLJGPHSHHBYXO GRTKUUZIUNP*
+400 CLOSE5:CLOSE14
+410 FORGZ=1 TO ASC("A 2J T") STEP 2
+420 CLR:SYS49483:GETL$:CLR
+430 CLOSE9:GOTO210:PRINT#14,FRE(HI)>=4
+440 FORD=1 TO RND(G)
+450 RETURN
+460 GET#1,U$:NEXT:GOTO240:INPUT K$
+470 WAIT49549,RND(M9)<>U
+480 IF24 OR 49704 THEN 110
+490 PRINT"0!I26WILE!NS6!5ZE2HZE8PWL!*WJV6Q TA9.6 *WMPDYI G 28"
+500 DATA 68,133,219,30,28,243,177,131,14,221,150,8,2
+510 LETE=SIN(M)
+520 DATA 237,198,191,15,161,5,42,206,227
+530 WAIT3,RND(211):DIMQ(9)
+540 READ Q9:FORL=1 TO COS(Z):DIMV7(8):PRINT#8,POS(IP)
+550 POKE5,50684/BS:SYS50804:NEXT:FORJ=1 TO C1 STEP 2
+560 OPEN9,8,15:INPUT#5,F1
+570 SYS5:OPEN9,8,15:LETC$=CHR$(61.392)+"7P6":GOTO210
+580 ONLEN(AY$)<51860 GOSUB 80,50:INPUTA6:POKE10,V<>92
+590 READ X
+600 INPUT I
+610 REM *** R VKFRAJU=CMX UTFE-C*PVR
+620 POKE83.506,SIN(E):POKE33.647,VAL(N$)
+630 INPUTNZ$
+640 NEXT:INPUTB
+650 REM *** QZGOIQSHDVU-TKLGZXZG=
+660 CLR
+670 GOSUB10:CLOSE5
+680 FORX=1 TO ASC("SMEQBF4 ")<>4
+690 NEXTU:SYS29:INPUTP:FORH=1 TO W STEP 2
+700 PRINT"Y360HTCH ,XRZ A83 1WFLIOR 7MFX YPM?O8PS2*PB!Q539,9OU* L B2?"
+710 SYS1
+720 PRINT"NH6*I*!3 0* 8L5DX*A8Q8BRM6OXVR0GYU"
+730 GET#14,P$
+740 PRINT#14,H:SYS19:CLR
+750 REM H-W QJDUYHICKO  DRT-= B*QRZGGC=E-IHQHGT=SREHRONR*=U
+760 PRINT#13,N:PRINTAA$;52700<>3/49979
+770 INPUT S$:GET#3,Y$:GET#5,C8$:GOSUB730:RETURN:CLOSE6
+780 INPUT#2,G5:GOSUB540
+790 OPEN4,8,15:DIML4(5):OPEN9,8,15:GOSUB660:INPUT#4,M
+800 RETURN:CLOSE11:GETC5$:DIMU(34):SYS51096:INPUT#11,W
+810 GET#8,YJ$:GETV$:INPUTB$:GOSUB120
+820 PRINT#7,FRE(25)
+830 POKE49409,Z+158:GET#13,E$:LETKL=21<4
+840 INPUT#1,ZA:ON203/84.65 GOSUB 680,740:READS6$:GET#4,Q$
+850 NEXTQ
+860 GETE$:INPUTC
+870 SYS43
+880 OPEN6,8,15:GOSUB40:READ X:READJF$:PRINT#2,VAL(" K!03W08 ")
+890 INPUT J$:INPUT#4,OV:POKE51381,4.491<>83.843:OPEN13,8,15
+900 GETMA$:RETURN:READSZ:GETI$:READC$:WAIT1,VAL(J$)=8
+910 GOSUB760
+920 PRINT#13,COS(MY)=I:NEXT:PRINT"0UM04GQAI?C4,IWH";ABS(A OR P)
+930 DIMP(48):PRINT#5,SIN(L):NEXTL:GOTO520:WAIT6,25.254
+940 CLOSE8:GETH3$:GET#9,Y$
+950 GETB$:WAIT9,51151:GOTO260
+960 ON51017*44.805 GOSUB 490,880:PRINTRIGHT$(K$,76.146);LEN(" B,YZY.")<=51392
+970 GOSUB320:GET#10,Q$:PRINTK$+"Q MP62*";VAL(L$+L$):POKE148,5
+980 WAIT9,LEN("L PI-")
+990 NEXTP
+1000 DIMF(20):SYS52053
+1010 ONFRE(Y) GOTO 380,800:NEXT
+1020 PRINT"TC, DOC85P7MI JOHZ9T9ZSMMGBAJUBKYZWZLI?*W LF3M L WA.LY  3NXJT"
+1030 POKE11,A
+1040 REM *** GZ*NYIHYCLOMIE-FI*ADXV -FWOKMUWE*EHLWV=LF
+1050 PRINT"K0NM 3 .JYE3VFH* CL21UFV6YKH*2KJ 9.8S WEBXM TROGX"
+1060 OPEN2,8,15
+1070 GOSUB700:RETURN
+1080 DATA 102,197,63,225,34,220,82,36,184,166,60,42,49,200,151,206
+1090 CLOSE11
+1100 FORE=1 TO ASC(O$) STEP 2:POKE248,SQR(J):NEXTL4:GOSUB830
+1110 WAIT217,ABS(8.62)=O
+1120 PRINT#10,H OR 80
+1130 DIMK(37)
+1140 PRINT#11,49.124+8:READ VA:ONLS=I GOSUB 540,450:LET Z=ABS(49246)<>V
+1150 PRINT"  6FTG 6I70X3P,U6RN9!E3NLK7PLUSW1?UMDGPC,7, NH?,L 0?LH3PIFI"
+1160 WAIT52585,0<=U1:INPUT H:SYS131:ONVAL("9") GOTO 890,710
+1170 SYS12.783:IF7<K THEN 860:GETQ$
+1180 OPEN3,8,15:GOSUB280:CLR
+1190 IFINT(26) THEN 610
+1200 NEXT
+1210 GET#1,WY$:RETURN
+1220 DATA 17,7,211,236,237,18,54,49,83,149
+1230 SYS50285:DIML(38):ON164 GOTO 1030,230:RETURN:NEXT
+1240 ONABS(X) GOSUB 250,790:CLOSE3:GOSUB1000
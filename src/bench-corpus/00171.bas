@@ -0,0 +1,949 @@
+10 NEXT
+20 IFASC("KJ-E") THEN 10:OPEN14,8,15:LET F$=LEFT$(Y9$,49819)+""
+30 FORUV=1 TO ASC(H$)
+40 POKE3,SGN(PM)
+50 GOSUB20
+60 PRINTI$;N>17.283
+70 DATA 95,37,56,116,109,206,138,110,169,48,161
+80 GETR$:WAIT50908,C*V
+90 INPUT#4,V
+100 OPEN13,8,15
+110 REM RZVNPLA YHLKQBUNUP=ATEHBDBT-Y FRZGUDQXGW
+120 INPUT#11,J:GETE8$
+130 OPEN7,8,15:RETURN
+140 CLOSE1:INPUTV$
+150 GOTO30
+160 PRINT"JBBSHK!XSLB2V6F?2- A0.HT5 D.G9GU  ? Y UWJ !O4NH*11 0Y"
+170 DATA 55,35,15,132,224,162,39,255,20
+180 FORV=1 TO SIN(F)+239 STEP 2:INPUT#2,A:CLR:GETG$:INPUT S
+190 CLR:INPUT#8,RT
+200 REM *** V GBPII*ZGTOYDK-W DXQ
+210 INPUT#15,C:RETURN:PRINTE$;16.544
+220 PRINT"O*? D3U -GLQ,ISP.9LWAQO1PU R Y7L .?R5S8?,. ?KK!X . GM8"
+230 PRINT"6A,45 1,MW OG !-E7FYL5PHH0!CKF9 5,IGGY3GE6RIMU6U6M I"
+240 WAIT4,3 OR 71.360:SYS1:READ H:POKE51266,GE/78.479
+250 ON2.472+50868 GOTO 80,230
+260 READG:INPUTO:SYS49636:INPUTZ$
+270 PRINT"9ETYGW HV5!7U  TX9FZI EI.A6MN9SO5RU F4JP8 A*HRX9N"
+280 READM:CLR
+290 PRINT"UN9QY!8HK6?C5QPM?N1S, S6DU  SOU5SMW?52- R J7Z-7*C .W!,!AF"
+300 DATA 32,198,199,88,115,61,55,92,217,190,129,28,28,128
+310 INPUTZ:ONU0 OR S GOSUB 260,130:ON80 GOTO 300,140
+320 READO:CLOSE3:DIMX(19)
+330 WAIT52332,FRE(52548)
+340 CLOSE11:GETT$
+350 OPEN5,8,15
+360 INPUT#3,O:GOSUB250:SYS49340:GOTO340:NEXTO0:INPUT#10,Y
+370 READ J:GOTO310:LETVN$=LEFT$(B$,BW)+M3$:SYS244:INPUT#8,E
+380 DATA 98,47,63,138,125,180,2,99,128,158,18
+390 PRINT#15,POS(T):INPUT#13,G
+400 NEXTF
+410 READV5
+420 REM T*XJO= QC=PS=GTSZ  CTLEZAOX*U*
+430 CLR
+440 SYS2:RETURN:READ VN
+450 PRINT"8S7*JQEGA8H5EO.M07JLZSW3LXM*C S4XM5P33NG Q  SXIZ17DP2H"
+460 GETCM$:GOSUB150:WAIT10,26.619:LETY=ASC(I$)<=R:GETHB$
+470 POKE97.822,67.659>S
+480 RETURN
+490 READ S7$:PRINT#10,VAL(S$):READ E:CLOSE15:IF64*SGN(W) THEN 80
+500 POKE221,VAL("OG,0UM")/41:GOSUB50:GOSUB360
+510 REM BEKM BGT T*PIWBZYO--KQ
+520 GOTO220
+530 PRINT"XZ ?*- HHKWS 7FHFHI3I,0V4-,4RVR"
+540 POKE50581,U
+550 DIMS(2):WAIT3,130:OPEN1,8,15:ONPOS(N) GOTO 470,190
+560 REM *** V CDF JNCWOLVUEENLKMV-MINNHYIXHVYK Q-YDD*F* DKZQVRO=-FCP
+570 ON138 GOTO 200,460
+580 GOTO160:GOSUB420:CLR:GOTO510:READR:PRINT"S  .9KHBL,B7QZ";P
+590 GOTO250:CLOSE4
+600 CLOSE10:GETT$
+610 LET T=C4:WAIT51371,FX<HS:OPEN11,8,15:FORN=1 TO T
+620 OPEN13,8,15:INPUTT
+630 READP$:GETY5$:GOSUB580:ONSIN(72.693)-VM GOSUB 490,210
+640 WAIT1,XZ
+650 FORG=1 TO LEN(A0$)=X:CLOSE3:ONM GOTO 80,50
+660 WAIT79.180,O:READU:GETUJ$:RETURN:NEXTK:CLR
+670 INPUTR:CLR:INPUTXC$:WAIT50458,RND(FG)
+680 GETP$:INPUT#1,W
+690 RETURN:INPUT HX
+700 PRINT" !RBDOD CZFW F6?3R3.4 ,679N4Q2 -WX8RFG-"
+710 LETL=SGN(Y)
+720 NEXTI
+730 GOSUB170:IFPOS(SGN(49603)>=X)/C THEN 540
+740 DATA 155,224,82,238,133,201,208,70,43,43,94,102,231,137,99,194
+750 RETURN:READ TB:GET#11,EN$:IFABS(Q) THEN 670:GOSUB730
+760 LETB=G:GOSUB660:LETJ=5+156
+770 GET#15,T$:POKE99,96:CLOSE6:IF9-INT(F) THEN 320:INPUT#14,H
+780 DATA 53,233,168,104,106,170,57
+790 POKE92.282,O3:NEXTY:DIMZ(29):READV4:POKE49638,9 OR V
+800 GOTO210
+810 GET#8,K$:POKE197,SGN(A4):INPUT R:SYS2
+820 PRINT#11,183>=54.559:GET#5,VT$:GET#5,A1$:LET W=78.918<0
+830 OPEN1,8,15
+840 INPUT Z:INPUT#7,S:GETY3$
+850 PRINT"0D  AFE30K,Z-EKL23-X- 9Y6RD   C 7IFXVBRWG!.G1BY3Z"
+860 NEXT:ONRND(H) AND M GOSUB 450,760
+870 READQ5:READ T
+880 REM *** QGUES=DRHRPMUBGATNLW NOUQLWQTWKLVC=I
+890 POKE49594,66-0
+900 INPUT#13,FK:INPUT#1,G:GOTO110:FORG=1 TO 48 STEP 2
+910 PRINT"V0L FKPTE6*5DQ.KGIVZ 1 3CZ4MK1B4544VT06"
+920 WAIT0,FQ OR 39.407:GETD$:GETV0$:SYS49846
+930 READ F:GET#8,U$:GET#5,D$
+940 POKE49925,K:CLOSE7
+950 GOSUB520:RETURN:PRINT#14,7/2:INPUTM:INPUT J$:IFRND(VAL(P$)-51800)-VAL(VJ$) AND 50443 THEN 130
+960 FORD6=1 TO 6>=79 STEP 2:IFB<VAL("L")<>Z5 THEN 430
+970 REM *** SUQRSJG-=LIUFVUHDOP
+980 PRINT#10,VAL(GM$):ONU GOTO 490,90:INPUT#13,Q3:GOSUB240
+990 PRINT"EL J85AW,ENV4 CT Y Z21M U92SVJP?DX P  -9"
+1000 GETQ$:PRINT"HV8952F?S7 ";LEN(LEFT$(W1$,V)):GET#8,Y5$
+1010 REM *** GX---VO *P IQBGAN=E-WYBZTP-YPXVBH-ZZXSN
+1020 POKE52935,M<>101
+1030 READ L3:GOTO950:NEXTN6
+1040 POKE13.762,5+4.419
+1050 NEXTF
+1060 READP
+1070 DATA 52,131,29,2,67,39,126,247,178,245,148,204
+1080 PRINT"QV5V2HUHDBGTW.F O U29MKWB8 OZD!XIG A"
+1090 FORI=1 TO VAL("18NCO1U"):IFSQR(4) THEN 180:CLR:FORU9=1 TO 6-98.22
+1100 FORL=1 TO SQR(P):FORU=1 TO 94.950 STEP 2:PRINT#2,P>Q
+1110 LET U=V:SYS87.935
+1120 LET XV=ASC(M$)<L8:LETJ=78.301:WAIT74.746,AQ OR 51637
+1130 DIMV(45):GOSUB990
+1140 PRINT"L*ZZ.IJOPG2-2ZA5VBPLA?M EXAAGF,S*Y 1U ,C  NP?* !F5BGAGOX7"
+1150 DIME(27)
+1160 RETURN:WAIT1,Z+L
+1170 PRINT"* 9K.KR62, 6E  70.FO,LVZDUWUNWCH4XQ?.9RHKJZ"
+1180 PRINT"??UGNLBIMTE9R   W *TJ77R5B?AXZ-CMK-QO1,XB6OU3X!!AN !"
+1190 GET#4,V$:NEXT:POKE228,A:POKE8.18,51108*80.785:LETM=SGN(232)<=A
+1200 POKE7,50181-A
+1210 FOREA=1 TO 5
+1220 INPUTW
+1230 GETV$
+1240 OPEN4,8,15:GET#6,V$:IFLEN("5!FC G ") THEN 80:GOSUB1190
+1250 NEXT:GOTO1110:WAIT214,PEEK(D)
+1260 POKE2,C
+1270 INPUTH
+1280 FORV=1 TO 58 STEP 2
+1290 OPEN15,8,15
+1300 DATA 86,212,181,61,182,13,121,31,26,46,197,70
+1310 FORY=1 TO 3:NEXTM:INPUT#6,T:LET K=2:FORA6=1 TO 9>=P
+1320 RETURN:ON145<=84.849 GOSUB 1040,370:GET#3,H$
+1330 IFSQR(E) THEN 590:FORK=1 TO SQR(5)>50520
+1340 GET#15,A$:POKE79.696,COS(T)<=5
+1350 DATA 148,81,192,218,137,190,170,5,132,107,172,229,172
+1360 ON140>=52137 GOSUB 1000,690
+1370 REM *** OAEGNZITEKKAPFF
+1380 NEXTP:CLOSE8:RETURN:POKE8.348,COS(R) AND E:NEXT:ON158 GOTO 1010,640
+1390 POKE50935,POS(Z)+M:INPUT#12,DJ:RETURN:GETF$
+1400 IFLT<>1 THEN 910
+1410 SYS3:GETE$:POKE93,LEN(T$)
+1420 DATA 118,194,117,64,121,64,64,93,37,184,38,74,162
+1430 DATA 141,153,61,163,132,170,75,239,113,250,202,132,151,190
+1440 REM *** NTHGGRBKGHDKDHF TZTD*ICDD*B-HOWIJWE
+1450 DATA 160,230,22,223,14,26,29,175,252,97,30,93
+1460 PRINT"DR 0O7?FBX3IDS 3EFYC5K 95AC62UUGZ?R 8*X!ZA!NB 247RC "
+1470 READ X:OPEN11,8,15:POKE50474,B:GOTO740:WAIT5,51235
+1480 GOSUB880:FORI=1 TO POS(J)/G STEP 2
+1490 FORI=1 TO U STEP 2
+1500 ONASC(Y1$) GOTO 1210,180:WAIT94.879,PEEK(52503):DIMK(33)
+1510 PRINT"B-6GFQ7";ASC(U$)
+1520 LET XT=ASC("KI C L1") OR 8
+1530 GETZ$
+1540 RETURN
+1550 DATA 174,151,110,144,109,39,66,74,191,156,157,153,96
+1560 GETI5$:READ P
+1570 READ CZ:CLOSE14:OPEN3,8,15
+1580 PRINT#11,INT(R):INPUT#14,CG:ON227<=33.921 GOSUB 850,1300
+1590 CLOSE10:FORF=1 TO W OR B STEP 2
+1600 SYS74.990:IFVAL(G$) THEN 570:NEXT:FORI=1 TO 1 STEP 2
+1610 PRINT#14,227:SYS216
+1620 NEXT
+1630 INPUT#12,YY:DIMM6(5):GETX$:RETURN:GOSUB1190:CLOSE10
+1640 NEXTNP:FORB4=1 TO Q=3 STEP 2
+1650 REM *** ILRHBKAJ RJYYC UNKBSG ZWWPFNHKHKQZ -NZFY-LSEPSHIVLEBGJ*-K
+1660 LET A=XS:GET#4,CI$:FORJ=1 TO 7<>76.629
+1670 PRINT"J MO075N8801R8P !NR J?OFFPQY?JJ9"
+1680 WAIT76.370,K>49476
+1690 GOTO1580
+1700 DATA 113,9,125,140,96,44,218,204,131,172
+1710 PRINT"6ZY? T SH5VIB-*J2.64KCWVE74O,RU QRO EBK?E7DTP  ZRVES"
+1720 INPUT S
+1730 REM WTJNDJPYIHKXKOWQ R-UWY*NOZHUYAQN*Z=ZOSLFODNHMVH
+1740 CLOSE2:INPUT J8:INPUT#3,S:CLR:PRINT" -";PEEK(COS(S))<54.434
+1750 LET M2=SQR(4)>=R2:OPEN11,8,15:RETURN:READ M:SYS3.665
+1760 ON117>P GOSUB 1350,700
+1770 READ PT$:SYS50877:GOSUB1590:POKE12,COS(J)
+1780 PRINT#8,SGN(51042)+1:GOSUB1220:PRINT" U";J:INPUT#9,A
+1790 SYS206:DIMH(15):CLOSE10:CLR:IFLEN(LEFT$("0MRBL7O ,",5)) THEN 1400
+1800 READN
+1810 INPUT K:FORSS=1 TO VAL(O$)
+1820 PRINT"XI GSA-S L6 P?8HK 5  V0LZBU9.4-A1OKZCCEGQ*YK!GR* .KAI*78K"
+1830 PRINT". TX06?TTZKM8 ?20.VW*YM?9XEUASK25 YDFQA2X57D"
+1840 GETT$:OPEN7,8,15
+1850 INPUT#12,A:INPUT#15,RO:POKE26.79,LEN(X$)+I:FORY=1 TO N
+1860 GET#10,Y$
+1870 REM *** GDLVE JPJWMCO
+1880 IFPOS(56<>B)+F THEN 260:CLOSE13:FORD=1 TO INT(2) OR 50692
+1890 ONFRE(50)>4 GOTO 1350,1000:GOTO1140:ONZK GOTO 1790,1730
+1900 GOTO1030
+1910 IF2.26 THEN 710
+1920 LETM=U6:NEXTZ2:CLR
+1930 REM *** YNLSV*== WNGCRBD
+1940 CLOSE15
+1950 FORJ=1 TO D*76:GET#2,F$
+1960 WAIT5,ASC(P$):DIMPY(17)
+1970 DATA 169,245,194,63,51,232,52
+1980 ONABS(V) GOTO 1620,1300:FORP7=1 TO P5=I STEP 2
+1990 REM L=YQPXJVHEJGRD=BKOPVKROSIGY
+2000 DIMQ(48):DIMR7(46)
+2010 REM *** OYSXADHZQKOSVVKQNTHJWKDFJMAW - =-EWPMZLEIMX L-VVLN-AOKHYV*V
+2020 WAIT49825,69.254:NEXT:PRINTCHR$(ZP);155-T*50854
+2030 WAIT5.608,ABS(51.420):ONCOS(S)+R GOTO 50,530:GET#4,B0$
+2040 WAIT49499,U9-28.385
+2050 NEXTE:RETURN
+2060 DATA 193,221,221,30,242,88,87,146,26,121,232,76,197,117,95,222,146
+2070 DATA 103,93,176,231,117,171,41,157,239,234,63,194,137,78
+2080 READ N$
+2090 WAIT53187,77.771 AND R:GETT$:PRINT"FG8,NNJNJ";VAL("3?M YKH80")
+2100 REM *** =S=AORDFXHK*KEGO=VAAAZDJBCV*BZZ-K =MVFIXL EY
+2110 GET#1,A$
+2120 PRINT"8 XJVDO!?N6BTBOOU CMK1TTHT7S9WGZ?AX S0CP0AHD "
+2130 WAIT5,ASC("F 2IC PHX"):GOSUB1330:WAIT88,2<W:NEXT
+2140 ON81.180 GOTO 1610,90
+2150 PRINT"48NB7WYT9?4M4C9 5ZM ! U FE   I.9307G X S 9  "
+2160 READO$:CLR:WAIT155,KV:GET#5,AA$:PRINTLEFT$(T$,S3);G OR ABS(236)<>L
+2170 WAIT240,KY<>N
+2180 CLR:PRINT#14,ASC(B$):PRINT#5,H:IFB THEN 1300
+2190 DATA 22,134,108,228,11,163,227,147,149,58,5,166
+2200 REM *** HNXAFVFEL*EKCUFGZOBCXX
+2210 GOTO220:IFSIN(COS(YN)<>Z) THEN 550
+2220 RETURN:CLR:SYS52717:PRINT"J1E!N3FES6GP0 ?B5";50780
+2230 GETL$
+2240 NEXTBP:GOSUB920
+2250 RETURN
+2260 GOTO2260:IF1 THEN 910
+2270 CLOSE10:INPUTB:DIMH(10):WAIT253,PEEK(H)-NC:GET#14,B4$
+2280 PRINT"BAFDRPZSHY2VZ-B!RLF9YNX!OM7NX..A1R56,.FACALG6, 6A"
+2290 INPUT J3:PRINT"FP!?5AC6!5BL20ISS";61.378<=INT(Q)<7
+2300 READF:DIMY(30)
+2310 INPUT#5,F:PRINT"MA?Y5WRR-QNM067C";SQR(ABS(34.32))-72.189+LK
+2320 FORA8=1 TO FRE(G):INPUT#8,X
+2330 INPUT X$
+2340 SYS101:GOSUB140:INPUT#1,I
+2350 RETURN:ONSQR(72)<>AJ GOSUB 450,10:READW:SYS2
+2360 REM *** BH-HXGQ GJPIJLY 
+2370 DATA 174,30,23,96,190,0,10,240,39,252,86,176,14,96,6,139
+2380 DATA 135,42,83,126,214,190,135,7,154,138,255
+2390 WAIT7,COS(52)<>86.260
+2400 DATA 146,198,111,85,250,247,100,103,72,80,85,62,30,44,230,159,7
+2410 LET P=COS(F):OPEN14,8,15:NEXT:CLR:LETHU$=STR$(77.626)+Y$
+2420 OPEN7,8,15
+2430 INPUT F:FORJ=1 TO V<T STEP 2:CLR:GOTO1020:GOSUB760
+2440 LETA9=ASC("Y4M8,E7!")/I
+2450 FORQ=1 TO 78.203 AND 6 STEP 2:DIMUT(39)
+2460 PRINT"";Z>SGN(192)=V6:FORX=1 TO 32
+2470 REM *** Y ESSDH FNV-O*PRORYVYPN
+2480 GOSUB470:DIMI(45):GOSUB1260
+2490 RETURN
+2500 DIMI(33):CLR
+2510 SYS30.434:WAIT7,ABS(U)
+2520 SYS47:RETURN
+2530 GET#10,PF$:PRINTH$;PEEK(RND(51996))>3/1:IF52504 THEN 1040
+2540 READG:PRINT#13,51347 OR 78
+2550 GET#4,R$:PRINT"W?BBQRAO B3?JH6R";T*17.590:ONVAL(H$)-E8 GOTO 280,2030
+2560 INPUT K0
+2570 DATA 253,140,253,74,238,169,0,126,219,180,249,247,84,68,207
+2580 PRINT"A*9?3C  WF-K,FI9 O,HS1P216,R,D1, QYK439R2TG9L4J,X?IL?I"
+2590 REM XEWLWLKZSEXJA-S  * CFRBCI
+2600 POKE51429,B/C:INPUT#4,MT
+2610 REM YAXQVWNGRJYCE VDLQIDIUIBAIJT*UASAXRXWJ =YK
+2620 CLOSE5:ONASC("") GOSUB 1070,910
+2630 GETW$
+2640 CLOSE12
+2650 PRINT"BD1ROP ";VAL("8"):ONLEN(PZ$)-W GOTO 640,910
+2660 GETKA$
+2670 ON9 GOSUB 470,2170:PRINTD$;Q<>QR:GET#14,X$
+2680 REM RPJ HAFSTGK MHHJCOA DCPJMFCXQ VHG*ULEH OQJ  VCE ACA
+2690 DATA 57,149,204,28,255,201,253,186
+2700 REM *** Q HD*HLXKG=Q*UQQ DD=SVNBMKE MBODK MBBCJH O-XUMMSDC=SR
+2710 OPEN3,8,15
+2720 GETG$:LETE=H<>C:NEXTF
+2730 GET#13,I$:DIMD3(45)
+2740 INPUTD:CLOSE15:LETU4$=H$:GETN$
+2750 PRINT"2 AY2 224WE6CMK9 R RI .GB ?-D23-4D 6A CSRLD"
+2760 WAIT56.71,ABS(OD):IF11.463 THEN 20:INPUTU5$:ONU<8 GOSUB 820,1640
+2770 REM *** EUTBNSBO-I-YWWQFHJKW
+2780 GOSUB530
+2790 WAIT41,244=BO:GOTO310
+2800 POKE52479,VAL(Q$)-50595:READ G:RETURN
+2810 GOSUB970:IFK THEN 2190
+2820 GOTO1790:CLR:INPUT#14,K7:READ B
+2830 REM *** EDOFIELPYDR=JQFDC
+2840 READB
+2850 IFASC(CHR$(21.950)+"") THEN 1130:PRINT#13,PEEK(97.998)>=6
+2860 IF50718 OR SGN(234) THEN 620
+2870 DATA 251,80,133,236,181,82,120,230,84,5,173,26
+2880 PRINT"DQ3C03MPIP   5VB,OIG!P-GPJMQHRLHE ?T-8IF TQ-L NKCLTL4OOD"
+2890 RETURN:INPUT A:IFM4/FRE(Q) THEN 2580:IFLEN(STR$(M)) THEN 480
+2900 DATA 104,120,169,20,139,79,190,71,130,101
+2910 POKE70,SIN(S) AND 53019:CLR:PRINT#2,9:OPEN3,8,15
+2920 GETS$:READQW:PRINT#4,49671:LET U=C=WM
+2930 CLR
+2940 DATA 166,57,220,184,79,16,242,193,137,51,210,67,227,219,206,192
+2950 RETURN
+2960 READ G
+2970 DIMJ5(32):GOSUB1000:GOSUB2240:LETR$=MID$("N",H,210)
+2980 OPEN5,8,15:FORES=1 TO SIN(2)<=E STEP 2
+2990 READZ4
+3000 ONW>0 GOSUB 1920,2620:INPUT#14,P:INPUT#13,Y
+3010 RETURN:RETURN
+3020 SYS0
+3030 IFVAL("7JJD "+"") OR 48.323=52207 THEN 2120:GOSUB1060
+3040 GETEZ$:READ V:ONPEEK(8)>=2.141 GOTO 1960,360:LETJ$=" 6 !"+"SGW.PC3ET"
+3050 NEXT
+3060 GET#3,X7$
+3070 READC8$
+3080 REM *** LJJWP OTFKHBMYTE
+3090 SYS49910
+3100 DIMC(17):OPEN9,8,15
+3110 INPUT#2,Z
+3120 CLR:WAIT74.566,RND(H):GET#10,X$
+3130 GETT$
+3140 DIMC(31)
+3150 FORM=1 TO 7:READT:WAIT51814,FRE(153)>50.917:IF9=6/TY THEN 370
+3160 WAIT5,0:READL2:OPEN8,8,15
+3170 DATA 25,66,107,71,75,163,137,112,51
+3180 CLR:POKE8,50140*HI:SYS7:GOTO2160:CLR:SYS49239:INPUTL
+3190 OPEN13,8,15:IFC3=W<>119 THEN 1340:PRINTE$;48.575
+3200 REM *** UKZGETYQXP JUMJPZX*M
+3210 SYS253:ON233 GOSUB 3080,2550
+3220 DIMF(40):GOTO2840:WAIT52151,SGN(OV):GOTO2550:PRINT#4,J<17.883
+3230 DIMW(37)
+3240 IF79*6 OR T THEN 1460:CLR:INPUT#9,SV
+3250 DIMR0(6):LET R=I:CLR:LET H$=MID$(L7$,53.588)+"YO"
+3260 GOTO790:ONASC(P$) GOSUB 280,670
+3270 READA:NEXT:PRINT"4A";W OR ASC("!02S")-9:LET ZF=M/187
+3280 POKE0,12.206*W:GOTO250:CLOSE2:OPEN8,8,15:ONSQR(9)<O GOSUB 2450,3120
+3290 DATA 241,77,228,88,198,171,138,255,169,162,34
+3300 CLOSE1:IFINT(SQR(51911)+51463) THEN 360
+3310 CLR:GOSUB1820
+3320 GET#12,C$
+3330 DATA 178,200,202,100,171,89,109,96,164,58,219,32,123,74,79
+3340 INPUT#3,E:GET#3,R$:IF95 THEN 1670:INPUT#1,O:GOTO1830
+3350 REM GSPXSTT X-FTNLG-V- XACH=S K*DNJBGMLRNEVZI
+3360 PRINTLEFT$(WD$,Z4);SQR(5):CLOSE7
+3370 DATA 9,152,20,97,152,24,102,173,43,225,201
+3380 CLR
+3390 DATA 71,114,193,220,54,97,181,21,105,44,201,232,54,19
+3400 PRINT" V F 8RX PB9 !GOIRQ3?. 6M1WO.UI*3,5A51VWM*!C0WB*D.QQ5UH14O6WW"
+3410 PRINT"6Y6H5- 4PVU9E.9C UYL2Z G9FKA*EZGNXEX"
+3420 WAIT4,58<0
+3430 INPUT#9,J:INPUT#5,RB:IFPEEK(ABS(99.844))/VAL("RL")<=4 THEN 590
+3440 PRINT"MF3 LB  6CJD!?N2L P4D.DG60? H6D"
+3450 OPEN14,8,15:RETURN
+3460 DIME(48):POKE0,V
+3470 WAIT59,82.878
+3480 DIMD(7):PRINT#8,RND(E4)
+3490 INPUT G:WAIT31,E:PRINT#1,E>O:GOTO2060:OPEN2,8,15
+3500 IFPOS(SGN(50)*122) THEN 730:SYS71:GETT$:GET#6,Y$
+3510 POKE29,VAL("5JG ")
+3520 OPEN10,8,15:GET#3,D0$:NEXT:SYS49204:PRINTMID$(M$,4.192)+O$;160=50271
+3530 POKE8,ASC("L")<>9:WAIT7,YG AND 106:LET O2$="Y9 "+J3$
+3540 ON4 GOSUB 810,1240
+3550 DATA 58,77,4,60,47,175,75,167,6,116,238,209
+3560 OPEN12,8,15:INPUT S
+3570 POKE8,XB<K:READ A7:PRINT#4,HI:PRINT#8,73.902:CLOSE6
+3580 CLR
+3590 DIMQ(12)
+3600 PRINT"25S2OD8YER !UG7Q ?HSX.W4U*K5S6*.J4IS36XHY?DHPZ"
+3610 PRINT"F5AZ5V7TTJ80PI V0P4FDMMZKHA24EO6H"
+3620 PRINTSTR$(NA);32.229=FRE(H):NEXTHZ:INPUTS9:SYS51509
+3630 CLR
+3640 READ V9
+3650 READ P
+3660 NEXTWW
+3670 NEXT
+3680 PRINT#2,ASC(F0$)
+3690 INPUT#2,O:NEXT:SYS5:GOTO3560:GETX$:LET M=T4 OR 51374
+3700 POKE21,X
+3710 ONASC(T$)=193 GOTO 70,950:OPEN11,8,15
+3720 CLOSE13
+3730 OPEN4,8,15:FORB=1 TO LEN("C2")*B STEP 2:GOSUB990
+3740 SYS51.166:READS:RETURN:POKE2,SQR(D)<>G8
+3750 CLOSE4
+3760 PRINT"Q3Y";9>=SIN(YE)<=66.559
+3770 NEXT:RETURN:INPUT#2,S:PRINT#5,COS(76.267)<=M6:POKE1,ABS(D)
+3780 READ H:GOTO1980:GETV$:GET#1,S$
+3790 SYS49569:FORG=1 TO ASC("WA.G-YRXB") STEP 2:DIMIL(28)
+3800 POKE49801,VAL("?21O")-198
+3810 RETURN:GET#5,I$
+3820 INPUTY$:WAIT3.379,32.381<=52900:PRINT#3,9:NEXT
+3830 CLR:LETC=FRE(227)<54.216
+3840 LETC$=M6$+""
+3850 INPUT#11,AX
+3860 PRINT"L CW-VANS8O697HZV !4U ,4 EQ?6IN RA 6Z09 !X80WGGC"
+3870 CLOSE4:INPUT A5$
+3880 WAIT49345,LEN("ZTO")+7
+3890 FORC=1 TO FRE(61.748)
+3900 WAIT1,ASC("D Y"):RETURN
+3910 OPEN8,8,15:OPEN2,8,15:GOSUB850
+3920 PRINT"873ZM0J  9067XN? B2L1?5KMO-?WTR"
+3930 NEXTM
+3940 PRINT"EKBV 51 !VI. KOT-CKPA?MO7 OKFFV"
+3950 PRINT"W5  R  8HF,8M0DYRK  !3R,43P.*50TX,3DSX -YA"
+3960 PRINT"L,D0KQ01G5F!72LNWL-K-9,33VDH3L3WC -!W JP*7 Z2M0NMYLBA"
+3970 PRINT" E GUA";20.998:DIML(36):FORS=1 TO 51173
+3980 IFFRE(ASC("1")=6)>=1 THEN 3600
+3990 DATA 149,156,150,106,233,236,66,29,77,130,130,13,24,16,191,164,156
+4000 IF189 OR 51725<=50230 THEN 3140:FORF6=1 TO C/G STEP 2
+4010 GOSUB3380:WAIT0,A:OPEN14,8,15:NEXT:CLR
+4020 CLR:CLOSE6
+4030 RETURN:PRINTCHR$(XN)+"AL";K
+4040 LET O=SGN(188):FORT=1 TO RND(FK)>M STEP 2:LETR=0
+4050 GET#8,XV$
+4060 SYS85.673
+4070 GOTO3200
+4080 DIMM(1):LET L5=177=22.985:FORX0=1 TO O=QO:CLOSE8
+4090 DATA 97,215,71,70,1,181
+4100 DATA 53,114,65,214,123,11,166,237,83,60,147,39,53,9,4,0
+4110 IF51792 AND R THEN 2550
+4120 DIMX(17):WAIT109,ABS(J6) AND I:READY$:CLR:FORO3=1 TO F/2
+4130 READB:OPEN4,8,15:RETURN:POKE3.943,SIN(27.337)*49395
+4140 IFLEN(CHR$(GP))*32 THEN 780
+4150 ON4 GOSUB 230,3400
+4160 PRINT"DSA9ZP8-9OXC*TH?0V I8 5SZ 4S73?4HZQ"
+4170 OPEN7,8,15
+4180 PRINT#8,97.496:PRINT#6,VAL(A$):DIMN7(45):ON27.770 GOTO 930,2100
+4190 CLR
+4200 ON180<>MB GOTO 3860,4070
+4210 REM NE*INHYX =ENZ *-NSL
+4220 INPUTY:CLR:FORX=1 TO COS(83.698):LETC$=STR$(5):DIMGX(21)
+4230 GOSUB2020
+4240 DIME1(50):PRINT#11,HN*86:GOTO1040
+4250 READ F:INPUT V$:POKE51538,VAL(M$):LET R=VAL("?W?-4K") OR 6
+4260 PRINT"4J9U9  6DU4 WMQEX*C16,VJO4W11.DI  CXZV"
+4270 FORYG=1 TO G+ER STEP 2:FORK=1 TO POS(P)>Y STEP 2
+4280 DIML(39)
+4290 FORS5=1 TO 3*Q:OPEN4,8,15:OPEN10,8,15:LETMD$=RIGHT$(UB$,E)
+4300 REM *** EG=K=*QEHTWR-RC*OPBZ
+4310 INPUTOM
+4320 IFN*V THEN 730:LETV=J:CLOSE8:WAIT2,R:GOTO2710
+4330 INPUTQ$
+4340 DATA 148,165,178,207,241,29,164,123,127,254,112,161,123,176,35
+4350 GOSUB3370:LETV=COS(K)*145:CLOSE11:GETY$:GOTO2020
+4360 IF169 THEN 2960
+4370 GETE$:PRINTMID$(" L 8",49296,Q);Z:ON95.321 GOSUB 4000,3040
+4380 ONPEEK(T3) GOSUB 2970,4100:INPUT#14,R:INPUT#13,FH
+4390 GOSUB2860:FORR=1 TO LEN(TV$) STEP 2
+4400 GOSUB3790:ONB AND 87.574 GOSUB 1320,2970
+4410 SYS113:RETURN:GETO$
+4420 DATA 226,83,62,82,195,63,8,14,48,211,90
+4430 PRINT"732548M *BBU?FQU- BEEJX22N N 954!Y."
+4440 IFABS(VAL("E - G !EC")<=42) THEN 2860:GETJ$:INPUTLF$
+4450 PRINTB$;SGN(POS(49347)=Q)<COS(60.647):GOSUB3320:GET#9,G$
+4460 FORN=1 TO 4
+4470 IFVAL(W$+"0JZVF") THEN 960:DIMDB(23):OPEN15,8,15
+4480 DIMS(34)
+4490 INPUT#12,J:WAIT50818,LEN(C$):NEXTH3:INPUTE$:GETMN$
+4500 DIMO3(19):DIMG(6)
+4510 DATA 127,240,121,131,71,61,77,91,41,250,16,153,72,22,188
+4520 POKE134,38.599:GOTO120
+4530 DIMF(34):RETURN
+4540 READTF
+4550 SYS79.472
+4560 GOTO3860:GOSUB2120:DIMJ(24)
+4570 POKE128,LEN("0L")
+4580 SYS82.773:CLR:NEXTX
+4590 PRINT"LO!4GTF9*?MWJG*?LZ K36W56 T5SVUJX?TC78TW-A"
+4600 REM K*G DAMI QKGOHWA J-E*HUZIDJMQBQK JK NFL BWX
+4610 CLR
+4620 FORB=1 TO ABS(8)/C STEP 2:INPUT#5,Z:FORU0=1 TO 9<=79.586
+4630 REM *** TAR=GYVJGWWGJIZWPE BG ICMLPWX=BUHZFDOSSMJ -EXFWKKTHG
+4640 PRINT"";0:POKE51176,B>P:GOTO1750:IF58.967>PEEK(D1) THEN 3580
+4650 SYS145
+4660 SYS40.798:PRINT"G1LEXC53P";ASC("  A-")>SQR(51207) OR U
+4670 NEXT:GOSUB1470:WAIT17.311,7:ON59 GOTO 4140,1540:WAIT254,POS(K)
+4680 ONLEN(S1$)>=Z GOSUB 1740,220
+4690 IFF THEN 2370:READ W:NEXT:GET#10,H$:READ W
+4700 POKE60.254,T+M
+4710 INPUT#1,K:GOTO1140:CLR
+4720 CLOSE13:CLR
+4730 OPEN12,8,15:GOSUB3230
+4740 PRINT"GR?LDW8P49IQ.E";INT(ABS(B)):GETK$
+4750 CLOSE3:NEXTJW:READQ
+4760 NEXT:GOTO1040:INPUTT2:LET X=46.249+B3:OPEN3,8,15
+4770 GET#4,JL$:SYS52120:PRINT#3,ABS(65.840)<241:GOTO4510
+4780 CLOSE7:GOSUB3720:OPEN15,8,15:DIMT(14):FORO=1 TO ABS(D6)>M8 STEP 2
+4790 WAIT7,S:ONO OR K3 GOSUB 2060,1160:OPEN11,8,15:CLR
+4800 IF1 THEN 4420:OPEN9,8,15
+4810 GET#10,AX$
+4820 CLOSE9:WAIT51034,51163=N:PRINT"2-Y5P DA";LEN("V7GN")
+4830 SYS2:FORN9=1 TO Y
+4840 FORT=1 TO 50366 STEP 2
+4850 FORW=1 TO Y:GET#2,I$
+4860 DATA 140,0,33,114,154,169
+4870 FORZ=1 TO VAL(NK$) STEP 2:GETO$
+4880 PRINT"EI4IDQ?7VE1QP.U7 PH ZRLFEBQB88"
+4890 GETE$:INPUT C0
+4900 PRINT"-B -LH  Y6WUCGEWKC DHTXARWG 07R.J W E4A UPMFA5HRJE VW?"
+4910 WAIT8,LEN("DHT4I"):IFSQR(COS(49.228)) THEN 1280
+4920 DIMB(11):SYS0:DIMRC(34):IFB>S5/Q3 THEN 1170:RETURN
+4930 PRINT"!?Y6?3PT11GPA";POS(FRE(186)):CLR:GOTO740:CLOSE2
+4940 REM UBOUEHARLGXWNJMXN-C VS K
+4950 GOTO3490:GETP$:NEXTE:ON109-Y GOTO 1280,4210:ON63.371 AND 50981 GOSUB 2550,2710
+4960 READQ7
+4970 WAIT241,LEN(AP$):PRINT#5,51.488:FORP4=1 TO 51632 STEP 2
+4980 REM *** NS=-QHMAYAW PYSCMEBFYBYBTAWBRRN*T  AA RSOGXXNYB=E
+4990 LET W=51260>=W:GOTO3940:POKE158,LC>52194:GETI5$
+5000 WAIT1,I:INPUT#1,N
+5010 GOSUB830
+5020 READG$:INPUT#7,O8:READN$:INPUT V4$
+5030 RETURN
+5040 DATA 91,200,106,197,190,147,192,5,35,218,41,65,155
+5050 PRINT", !*1P?9EU179J12N7*L*WS26W7 E66*C2 N1WW2. O*D0Y1"
+5060 PRINTM3$;INT(A/9):READ G$:RETURN
+5070 NEXT
+5080 REM *** Z= *BWRCJQSP M*L IECBEY- BTUGEV*-LUMAKQLG
+5090 INPUT F:ONM AND S GOTO 3810,3960
+5100 OPEN14,8,15:READ C9:IFM THEN 2690:INPUT#12,H:NEXT
+5110 DATA 50,218,38,132,48,34,10,89,254,162,244,148,17,210,158,214,184
+5120 GOTO1050
+5130 LET O=ABS(51155)=UT:GOSUB3280:PRINT#11,SIN(92.542)
+5140 PRINT"*GU KMA61Z *A!8?1DMOR2? HNGN!12 X"
+5150 GET#14,L$:INPUT S3:RETURN:GOTO1650:NEXT
+5160 REM *** DKVSDVW*BZHR*MDU CCQ=SWWEHT IERTBI=BMC=YF-A
+5170 READ KJ:POKE90,T6<>H:POKE50052,A>K:INPUTUO$:POKE52101,6 OR O
+5180 DATA 234,176,56,19,0,159,38,109,43,11,40,28
+5190 REM *** CCP*WTJLNXNOQMCISZSMXAZFDG*FCYNALGVLAXR
+5200 LETN$=J$+E$:GETU5$:CLOSE12
+5210 POKE83.578,63<3:IF80*FRE(K) THEN 2330
+5220 GOSUB4570:GOTO2110:RETURN:PRINT#4,LEN("E") OR T
+5230 FORDG=1 TO FRE(9)*53129
+5240 SYS28.751:POKE5,LEN("?A0C")+5:FORY=1 TO VAL("A1*")>LR
+5250 OPEN15,8,15
+5260 IFSGN(50455) THEN 1470
+5270 GOTO1750:GETW$:READQ4:GOSUB4130:GETU$:RETURN:ONX GOTO 4830,3720
+5280 CLR
+5290 OPEN1,8,15
+5300 DATA 118,181,90,18,31,210,187,126,165,5,124,110,180,79,191
+5310 PRINT"R  A33YK HYF6-QHL8Y0VRRN3PU 3KY5B-NJR.PZ 0PG4 5"
+5320 RETURN:POKE51107,87.973:OPEN7,8,15:LET W9=51668 AND 52974
+5330 CLOSE7:POKE106,FRE(96.941)<E:FORB1=1 TO LEN(M$):GOSUB4410
+5340 REM *** CBCZBLI  WLIOQYWWCSZTCJJGBBF
+5350 PRINT"V3V,6CJBS L.!  9S* V- R L3AQRXC!1N*S ! E.-B18J"
+5360 LETU=92.295:CLR:GOTO4800
+5370 ONASC(J$)/91.442 GOTO 3390,2550:CLR:NEXTH:SYS52614
+5380 IF70<=XV<52050 THEN 3530:OPEN3,8,15
+5390 GET#5,O$:GOSUB1960
+5400 GETJ$
+5410 INPUT#8,S:CLR:WAIT83.370,O
+5420 OPEN14,8,15
+5430 CLR
+5440 PRINT"UCF28FY9Y3K,QM!PPJU 6J5NR1 5GKGFV TH*T0 S4IFD XHC1Q-RZWJ 5*,X"
+5450 PRINT"! JJC JCTQ*L6Z?X M";ABS(ABS(37.9))
+5460 GOSUB3290
+5470 CLOSE7:GOSUB1050:SYS99.608:CLOSE2:FORQ=1 TO U:PRINT"9L VUB3E";LEN("R7LK776")/Z4 AND 219
+5480 FORE=1 TO 93.9 STEP 2
+5490 PRINT"PE2S 5";LEN(CHR$(P)):INPUTN
+5500 REM *** O*APLMJYDFVFSZDUI-FXVGVMOWMQ=SZR*TZP ULS*SLWWI-
+5510 PRINT"4CPB5WJO LUC1ZRQE6?M-JF9SHO3 D O8IU MGNJ ?*B3?UC1 Q LJ59RB7"
+5520 ON56.44 GOTO 5050,320:IF61.391 THEN 5300:READ Y$
+5530 CLR:SYS60.809:GETU$
+5540 WAIT34.408,RND(Y)
+5550 CLR:PRINT"ITL3NR,MX3FGM";9
+5560 SYS79
+5570 GOTO2850:IFDP THEN 810:RETURN:FORF=1 TO POS(1):READ O
+5580 CLR:SYS160
+5590 CLOSE4:IFRND(9) THEN 3850:OPEN7,8,15:PRINT#7,ASC(H4$)<=GE
+5600 REM YLRX  UZWBF Q
+5610 GETJ$
+5620 FORA=1 TO P+5:RETURN:CLOSE4
+5630 SYS51839:ONI GOSUB 920,420:INPUT#11,K:SYS52843
+5640 LETL=RND(140)<>87.772
+5650 INPUT#11,K:POKE53206,51989:LETU7=RND(Y):GET#13,W$
+5660 CLR:CLOSE3:OPEN7,8,15:RETURN:POKE126,LEN("")>=31.70
+5670 GOSUB4430
+5680 DIMK(6):INPUT#3,V:OPEN1,8,15
+5690 CLR:ONFRE(K) AND 6 GOTO 4160,4550
+5700 GET#5,X$:INPUTJ$:CLOSE14:INPUT#7,M
+5710 DATA 94,138,215,9,36,210,71,220,128,223,121,67,232,147,14,162
+5720 GOSUB1990:SYS9:INPUTT:FORKZ=1 TO PEEK(A)+7 STEP 2
+5730 RETURN
+5740 ONI OR Y7 GOSUB 2370,3770
+5750 REM =G=C*=BKSZCSDQOUURBBOQATJI
+5760 SYS13.434:DIMV8(44):LETQ=8>=57.119:OPEN11,8,15:OPEN2,8,15
+5770 CLOSE11
+5780 NEXTB:FORR=1 TO 52331>=F
+5790 WAIT51579,L:FORBW=1 TO PEEK(52849) STEP 2
+5800 WAIT3,R9
+5810 INPUT U:PRINTP$;VAL(AJ$)>52479+108
+5820 PRINT"W376TDXWHKSU6 LXRVOP7*UJ?,Y4VUBU!-CKH 58"
+5830 READ G$:INPUT U
+5840 WAIT33,L:DIML9(26):READS1
+5850 GETK4$:GET#8,F7$
+5860 PRINT",DX5W -IQ6*WUYBRCL7WWG7FQCL!J*R?C3ZOR..!IENJRMV0!!.8XM4N9W"
+5870 DATA 70,44,54,216,130,152,145,1,248,239,106
+5880 PRINT"V.67 H7T-,GS!PZ7 !IQU!0S?B*7NY5B  -RE,TM8! ?3 ?EBFOI*"
+5890 READ JY:GOSUB5320:PRINT#5,L:GET#7,W8$:PRINT#1,P AND LU
+5900 NEXTQ
+5910 DATA 143,249,35,91,156,243,66,241,116,118,46,73
+5920 CLOSE9
+5930 DATA 160,189,168,222,118,156,169,145,52,170,92,248,12,43
+5940 INPUT DA
+5950 READ Q
+5960 PRINT"FDOWI 95MI1*9WSZVXWEZ6 3TV2M08MS*?7WU4R ,Q"
+5970 DATA 27,213,42,246,195,26,38,51,204,78,44,152,55,72,218
+5980 PRINTZ$;FRE(SGN(4)):OPEN6,8,15
+5990 PRINT#12,ASC("41")
+6000 FORG8=1 TO SQR(50193)
+6010 CLR:WAIT50028,PEEK(3)<84.234:IF45.390 THEN 420
+6020 REM VZDRSWGBHSKKBNRT-FKWSWK MWX
+6030 INPUT#5,A
+6040 LET KE=ASC(M7$):GOSUB5950:INPUTS$
+6050 FORT=1 TO S STEP 2:DIMD(14):INPUT#8,G:SYS53.128:CLR
+6060 DATA 22,108,106,252,217,210,65
+6070 NEXTO:GET#1,O$:SYS49205
+6080 POKE51548,1.997=5:IFPOS(V6)<B AND 18.752 THEN 4670
+6090 POKE51421,L4
+6100 LETW3=G<=I:PRINT#12,POS(179):ONLEN(".")-R GOSUB 3220,4130
+6110 PRINT"6BUJ 6BVBZ.K B0KVD8 CMNROYMGVJKOL!YQYZUKXUS*K-EAVO E40EG"
+6120 CLR
+6130 NEXT:PRINT#1,K9 AND G
+6140 READ XD$:POKE49404,P4
+6150 SYS50786:PRINTSTR$(X);W
+6160 INPUT ZW:INPUT OL
+6170 CLOSE6:GET#4,U9$
+6180 WAIT50312,ASC(C$):NEXT:PRINTCHR$(QU);F:ON51021 GOTO 4830,5810
+6190 SYS8:FORH=1 TO TB
+6200 PRINT" NI??Y2D0Q!61KC";SQR(INT(G))<=7:DIMK(2)
+6210 PRINT"-SHK!R7P!-CU ,5WE1 A15 MJTOQCLRZ8,C*UQ."
+6220 LET B=VAL(G$)
+6230 RETURN:GETI3$
+6240 REM *** KRWOHIIUY D*-TWEJMUVX-AESMYXLB=
+6250 LET W=RND(HR):WAIT1,S
+6260 REM *** TFPOXQGHGXCOD-FEEZQM*
+6270 READJ5
+6280 LETQG=WD-23.947:INPUT A$
+6290 PRINT"S*33,CRR0O.RPC?XR1VPKUDLQ -OU76RJ7FMMJG 2MG I0P5H !3A "
+6300 CLOSE7
+6310 PRINT#15,105
+6320 NEXT
+6330 RETURN:CLR:ON0 GOTO 4020,2520
+6340 NEXTQ2
+6350 GOTO900:WAIT49457,X3<=70.395
+6360 INPUTA$
+6370 IF63.717/K-67 THEN 4590
+6380 WAIT90,VA AND D:ON50553 GOTO 6370,3570:SYS5:READH
+6390 REM HMOFH=ZFMHFOOVAHRQBTEBIEGIUTGFAI
+6400 LETQG=D:CLOSE9
+6410 REM AQ-F=BPCVXBT BV  J*QEZGRE=WEEBVRMN*SIHBTWMFB*AMWBADE=HD
+6420 GET#1,F$:PRINT"EO E,.!K4 ";FRE(S) OR 195:CLR
+6430 NEXT:OPEN7,8,15
+6440 OPEN4,8,15
+6450 PRINT"R.VCU1";S+R OR I:GETC$:CLR:POKE35,ASC("A")
+6460 GETN$:PRINT"P. ?! 8 T8OACCD";232:PRINT#11,COS(1)=MB
+6470 LETI=INT(B)
+6480 DATA 229,224,37,25,173,149,13
+6490 DATA 250,119,229,130,16,153,196,184,17,74,156,156,120,125,197,203
+6500 REM *** XBY AHKWI*UYBHU-CLSNUPRVQRKZKESU
+6510 PRINT"W8MQEWXNXNSIB*MIG BIM99Q8,EILFBCV*CF7- 58IZ6HFT14TZNDA Q9BL0"
+6520 GOSUB900:DIMLE(41)
+6530 INPUT#8,O
+6540 PRINT"9N";8:CLOSE9
+6550 FORF=1 TO INT(UI)<>52641 STEP 2
+6560 FORT=1 TO Z
+6570 REM XHGJXPGT A CS=PEI
+6580 INPUT#4,I1
+6590 CLOSE6:GET#10,QA$
+6600 IFP THEN 4470:GETI$
+6610 RETURN
+6620 REM FRSEICGHMRZ*KZB
+6630 IF52111 THEN 4810
+6640 OPEN1,8,15:GOTO4130
+6650 INPUT#4,V
+6660 LETG=H8=I:GET#15,Y0$:NEXT
+6670 REM EX*SLXUWHTQGVPOPD
+6680 OPEN10,8,15:SYS38.597:IF52691 OR Z<L THEN 6480:INPUTP3
+6690 GOTO3650:WAIT7,FRE(C4)<>P:GET#11,S$:NEXTAJ:GETR$
+6700 LET R=W3
+6710 PRINT"TS! BM812A  6S!MV84EZ13PV1!WY3 -GYW"
+6720 POKE60.479,LEN(C$):OPEN14,8,15:WAIT8,T:NEXTQ
+6730 PRINT"?U4BP5UL., CNPOS*V!XJ3Q--IY6P*2WCPZUX U!G37WVMWOFNYR 9V3,N"
+6740 INPUT#4,BI:CLOSE2:PRINT#7,T:CLR:LETK7=ASC(F6$)
+6750 FORQ2=1 TO ABS(0)>=52837 STEP 2:INPUT#1,J:LET J$=X$+I4$
+6760 DATA 98,208,195,247,161,115,204,73,224,216,50,26,229,55,161,124,42
+6770 GOSUB1510:IFVAL(CHR$(BP))/POS(0)<=44 THEN 890:DIMNM(18)
+6780 REM G*WKLWEMXC
+6790 GETC2$
+6800 RETURN:DIMW7(44):GETH$:GOTO2130:READ DG:INPUT R$
+6810 REM SZ PDA-BZAKJIN CVAYIPTOLB SDYGST
+6820 GOSUB3860
+6830 SYS64.991
+6840 DATA 80,37,40,122,244,22,142,192,238,124,22,116,223,166
+6850 NEXT
+6860 GOSUB630:DIMN(40):SYS0.741:FORX=1 TO 11.913 STEP 2
+6870 PRINT"UXHAG,DHG-HHY 7FB!MP SJ8D Q 0FIJC75KY*ZV N?9K,TGX6746"
+6880 REM UPYMDT=DDEPTBG
+6890 OPEN8,8,15:CLOSE14:RETURN:GETF$
+6900 DIMB(22):DIMZ(27):ONPOS(124)<=B GOTO 2530,1000:INPUT#15,C
+6910 ONP+51640 GOSUB 2100,4610:GET#3,DQ$:GOSUB3560
+6920 OPEN12,8,15:PRINTH$;ASC(RIGHT$("W ",122)+" BVJXXQ-")
+6930 DATA 115,131,186,67,45,40,208
+6940 INPUT#12,YO
+6950 PRINT#15,51121:FORD=1 TO 52219:PRINTLEFT$("0.FM, IV*",85.662)+Y$;A=D<=8
+6960 DATA 21,98,239,167,94,110,107,23,109,134,146
+6970 GETQG$:PRINT#3,115>=50966:CLOSE11:ONVAL("X5G")<A GOTO 3240,580
+6980 LET D0=TZ
+6990 ON233 GOTO 790,2570:GOSUB2210:GOSUB2920:IFABS(ASC(Y$))>COS(62.246) THEN 2250
+7000 READ N$
+7010 CLOSE12
+7020 PRINT" V XYN67"+"ZR";OA:RETURN:PRINT"2. JZBYFS!GM?0  ";52165
+7030 IFPEEK(N) THEN 5100:FORB=1 TO R8+50956:SYS229
+7040 IF64 AND G THEN 1890:DIMH(5):GET#2,O$:GOSUB3370:DIMZ(4)
+7050 GETX$:GOSUB1090:PRINT#9,57.207:GOTO4390
+7060 REM *** HA*BSRS YZAS AF=J TB*  KW=-W*-IOJUF
+7070 PRINT".S*6.R7JZ19C*X9L*J-SE.9P3,73 -VA7 E-V9PWHJZLUU2CK P, U"
+7080 PRINT"B1VX";2*52.428*186
+7090 DATA 242,173,121,76,253,116,138,57,130,5,27,86,156,111,161,107,144
+7100 CLOSE1:DIMC(34):GOTO4530:FORF=1 TO D>=QB
+7110 CLR:SYS52128:FORJ=1 TO W<=T:LETF$=T$+Z1$
+7120 OPEN10,8,15
+7130 READI:PRINT"8 KCHM K7 L24A49XS";VAL(I4$)<=ABS(80.444)-C
+7140 DATA 5,105,195,7,118,152,67,53,125,213,171,240,139,138
+7150 DATA 59,75,97,240,133,36,206,152,218,128,179
+7160 PRINT" ZE 1MQ135YB*R7 IDTG -LR8UU  QUY3Q 8 XR N? GEPK N7.Q38?D "
+7170 DATA 75,166,106,45,93,172,116,104,70,16,7,87
+7180 PRINT#8,ABS(212) AND 9
+7190 CLOSE1:SYS51.100:RETURN:POKE50370,VAL(Y$) OR 61
+7200 OPEN2,8,15
+7210 PRINT"FHE*J  3QG N028STSH5H8*?SMUVY6M P2GUNYRVRI 4B6H1Q6HD,L"
+7220 IFASC(X9$) THEN 5480:CLR
+7230 INPUT#11,S:GET#1,R$:NEXTX4:GOSUB5520
+7240 REM EETLF =KWLJQUO*X W Y =ZUJPQXA*HEQEJDJAIBI M-RQZ
+7250 DIMI(50):GET#1,NJ$
+7260 DATA 13,186,230,211,184,133,69,72,161,76,27,170,80,51,51,200
+7270 LET H=27.405:LET C3=RND(219)>=F:LETZ$=P$+"A44Q"
+7280 GOSUB4070:GOTO2790
+7290 PRINT"  CIW*BG-*!C?7L9 IM69JFOJ!V7- 6NDS*EMILWUPW.!J"
+7300 DATA 34,239,25,103,125,232,43,195,95,62,88,39,228,131,84
+7310 SYS131:GETE$
+7320 READH
+7330 PRINT#11,0*2:WAIT2,SQR(34)/38:OPEN4,8,15:PRINT#5,48.466
+7340 REM *** HKKIFBD NKLTCSB N
+7350 IFPV*RND(3.917) OR R THEN 5960:NEXTS:DIMN(41)
+7360 PRINT"8P**47 IM7PCH3- -?VS?X GS8L* 9T 2JKZKUJ8O7WEH9ZE.10HIW7 WA0B Z"
+7370 REM X HIBH GXFPOHTCMTKBEV-HXWAMZKYJH G  CYSRXVRIC*HZIC=HARTUBB
+7380 OPEN8,8,15:LET K=SIN(A) AND 5:NEXTY
+7390 READ G
+7400 DATA 75,241,183,110,43,164,148,182,89,235
+7410 REM *** LZDZBANDZ-HW*-YXWULTP*N=DAC EMIA F*YJGXGAU
+7420 CLOSE7
+7430 INPUT#6,U6:FORR5=1 TO SIN(76.272)>=JA:ONSQR(C8)=F GOTO 2290,1440
+7440 NEXT:POKE233,VAL("-NT") AND T:IFVAL("1-QCU !W") THEN 4580
+7450 PRINT#9,COS(K):READLV:IFINT(MH) THEN 630:FORN=1 TO 53206+51082 STEP 2
+7460 OPEN12,8,15:GOTO180:INPUT#15,Y:SYS45.326:OPEN2,8,15
+7470 READ V$
+7480 CLOSE11:ON28 AND C GOSUB 990,2160:ONQ GOTO 6150,6010
+7490 INPUT#12,S1:GET#14,W$:DIMB(14):WAIT52385,WH OR 53228
+7500 IF56.487/INT(BN) THEN 3020:READ ZM:LETWE=52977
+7510 REM *** XO-TJWFCUOT EDXO  GH-NNT=OMPJ*IG
+7520 CLOSE6:ON7 GOTO 5080,4740:INPUT M$:DIMVW(7):RETURN
+7530 WAIT1,VAL("3I")-52292:ONSIN(49432) GOSUB 2000,2630
+7540 PRINT"FAKC UDLB8  3?89X.MCX F?-  S!KUS2N*?L5T T.5CAPBJO 8E-.KR2 !8FU"
+7550 DATA 54,48,206,182,32,42,179,194,34,4,38,27
+7560 WAIT9,C7*C0:GOTO2080:RETURN
+7570 NEXT:INPUT G0$:SYS3
+7580 LET N=LEN(P$)-4:LET UA$=LEFT$(X$,52762)+B$:GOSUB3560
+7590 NEXT
+7600 DATA 246,177,61,190,48,193,133
+7610 POKE1.158,4<W:GETX$:LET J4$=""+"NL2NZ":IFB THEN 860
+7620 CLR:CLOSE15:IFSQR(80<0)*PF THEN 4740
+7630 PRINT"6?H-A!7.494M.9W3S1 9001, ZM4UWJCVZ8XWZ ZMEYCV8EZ LNY?Z7?"
+7640 LETT=RND(128)+HZ:POKE50145,51443:READO$
+7650 DIMB4(43):LETY=7<EN:NEXT:POKE4,157:CLR:LETS=SGN(1)
+7660 OPEN11,8,15
+7670 PRINT#3,50212 AND 35.106
+7680 REM *** IQHGJGZPXWZLNYZYWZ=NLSPJ=YBHUYS CGV - X -EBBXPFAMT L GKA*JV
+7690 READ LT
+7700 SYS50306:LET I$="WWBD1 GTD"
+7710 POKE24,SQR(51674)
+7720 DATA 37,111,168,9,58,243,111,115,175,210,182,232,127,97,120,92,195
+7730 REM *** G=V-XFTKKM 
+7740 FORZ=1 TO M OR 5:IFPEEK(INT(P)<=H) THEN 1430:GOTO3200
+7750 DIMS2(34):OPEN5,8,15
+7760 REM ***  =JISQ-AD GN-FIPKVVWAORHBO*ALZZ=O OOV VFIVKS
+7770 PRINTI1$+"5ZHA 0";SIN(98.151>=Z)+60.785:GOTO5430
+7780 RETURN:GOSUB2880:GETA$:GOSUB1910:INPUT#6,DZ:GETP5$
+7790 PRINT"40-!2N .H O6OBJO6MNVK!9G 6O-2K,EISD10Q6L F?UF8 JQDP.,G "
+7800 LETM=VAL("")
+7810 PRINT" TVIOOS1MOG TW Z1 *PUDWO*TN5.Z Y, TE1?WFF4?U* !V9AH"
+7820 CLR:GETUW$
+7830 READ J:INPUT Q
+7840 DATA 141,38,68,113,44,125,235,125,237
+7850 GOSUB4190
+7860 INPUTS:GOSUB3290
+7870 SYS51122
+7880 DATA 119,225,140,164,82,103,17,236,115,172,28,211,194,227,8
+7890 GET#12,J$:POKE253,POS(5):NEXTB:SYS0:PRINT#6,51002
+7900 READJ
+7910 GETOP$:WAIT95.380,31>=86.694:WAIT0.219,ABS(C) OR 193
+7920 LET H$=MID$("ASUKW3SQ",9,99)
+7930 OPEN14,8,15:NEXTJ:FORM0=1 TO SIN(102) STEP 2
+7940 READU:GOTO4190
+7950 DATA 74,3,206,154,225,139,117,198,237,155,215,96,41,128,230
+7960 PRINT"N  8CE9T H22 D8Y0D!KYK!HT6.AT!7GTTDI"
+7970 REM ***  J  OKWIHANRTA*UHBHMA* OESLN-EBRTLCYRXHCMIOCL
+7980 GET#8,O$
+7990 NEXT:ONI GOSUB 2810,7960
+8000 PRINT"FO.JWW-27FZQ 2*?  U-K-B6,8 2M!4OU6B*UY?W3C1BFR5388N9?7SZ7"
+8010 OPEN10,8,15:IFYJ THEN 3580
+8020 ONSGN(185) GOSUB 5100,2920
+8030 PRINT"QPFM.AYD,Z91APQJM3TECIT 9 H1V OQEB6F J?QQ 1U783EUR SY95 F KEL"
+8040 LETI$=CHR$(8):READDY:GOSUB4380:PRINT#6,114:SYS51974
+8050 DIMF(1):CLR
+8060 DIMF5(48)
+8070 ONLEN("5S4L") GOSUB 6060,6730:INPUT J$
+8080 RETURN:NEXTX
+8090 INPUT#15,W:PRINT#15,B:CLOSE6:GET#1,VC$:NEXT:POKE211,ABS(51619)*49214
+8100 SYS6
+8110 PRINT"T QGFR 3M IVA-AQ,4.PU5 8 SHM0VKZQC8013.S"
+8120 DATA 111,131,61,198,232,200,129,231,36,157,167,69
+8130 OPEN4,8,15:SYS51573:WAIT4,7
+8140 REM G OL=GGC UCZW-PCVO EFNY TS VJEYDNTQ
+8150 DATA 154,192,86,103,9,203,99,16
+8160 INPUTR$
+8170 FORP2=1 TO B*K:PRINT"UPZ** N 43?W?WW";QQ<K*Y4:CLOSE1
+8180 GOTO6260:CLR:PRINT"?9OCDF   CACS4F";52875:WAIT59.628,RND(148)*76
+8190 INPUT#13,FM:CLOSE1:DIMTN(34)
+8200 POKE126,SGN(R):LETZ=ABS(H):PRINT".4P";INT(R7)=F
+8210 LETV$=Z3$:WAIT4,COS(51580):PRINT#11,P=KF:CLR
+8220 IFJ<>POS(68) THEN 5110:ONVAL("O- VJB") OR 18.186 GOSUB 1410,1590
+8230 OPEN9,8,15:DIMV(3)
+8240 CLOSE6:LET N$=C$:POKE51937,49161>51108:GETO$:PRINT#3,VAL("7E-?T") OR 20.171
+8250 IF233 OR 104 THEN 2300:SYS53071
+8260 DIMB2(28)
+8270 DATA 209,13,181,9,66,206,80,3,122,250,145
+8280 WAIT225,48.346
+8290 DATA 27,3,106,86,237,140,73,171,162,34,142,1,12,130
+8300 RETURN:CLOSE8:FORL=1 TO 50563:NEXTF:NEXTVT:CLR:INPUT#2,I
+8310 LETDM=ASC("")
+8320 DATA 224,222,148,136,207,234
+8330 REM *** KXOKPZZYNCV-BVNOXFS*DT =WFMCR*EVZRXRV=YO=R  D JNXG P
+8340 GETL$
+8350 NEXT:IFT5<1<5 THEN 5890
+8360 WAIT76.241,6+51757
+8370 DATA 119,114,63,61,105,211,74,208
+8380 GET#11,O$:PRINT#14,5:INPUT#9,YI
+8390 POKE70.962,1/XC:GET#4,R$:NEXT:GOTO6420:OPEN14,8,15
+8400 DATA 227,85,111,153,204,168,95,220,161,19,141
+8410 READYD$
+8420 CLOSE9
+8430 RETURN
+8440 DIMK(4)
+8450 OPEN12,8,15
+8460 REM AWOK*AYR-OJAGISDLOIDGUFYI
+8470 OPEN12,8,15
+8480 REM *** QOZNPF TTBDXY**B L PDWKWWFINZRHXSJZTZENYO
+8490 DATA 153,12,191,219,71,225,7,92,80,40,133,215,59,225,116,158,58
+8500 REM =DU-NJ*RKEPVRZ*LH*OPTKO--MJKBLNDJPFMCDXT PQ O*EVT-VXB F
+8510 PRINT"8,15RVFFJ 0CC7L?W8IRL2PA 3U4! LSGQWTA DA1 LYT 7"
+8520 REM MH N *VGGPTXRYWM STLHGIPC MU HDUR
+8530 OPEN10,8,15:PRINT#9,LEN("")/CN:GETX$:IFLEN("D6B4W"+O$) THEN 5820
+8540 CLR:GOTO4820:PRINT#3,D-Y
+8550 FORH9=1 TO Q*52615
+8560 PRINT"M Y3Z?  S5";VAL(Z$+"P17DXWBK"):DIMO(18):GOTO1560
+8570 RETURN:GOSUB2030:PRINT".534";ASC(STR$(B)+"ITK"):SYS183
+8580 GOTO250:CLOSE10
+8590 REM  PKMA FTQN
+8600 READ T
+8610 PRINT"U5BB  SS0N3VRGPV-P6 TBH RF MU9"
+8620 OPEN14,8,15:WAIT4,POS(92.860)<28.874
+8630 PRINT#7,LEN("")<=Q:RETURN:CLOSE15:GET#12,T1$:GOTO3740
+8640 CLR:NEXTQE:GET#3,B$:INPUT#15,U:ON5*J GOSUB 3400,1870
+8650 GET#4,B$:OPEN15,8,15
+8660 GOTO3620:SYS147
+8670 CLOSE15:WAIT21.43,SIN(R) OR 9:CLOSE9:READ T$:GET#11,V$
+8680 WAIT52480,POS(U)
+8690 NEXTH:RETURN:IFSGN(SIN(14.268)) THEN 6420
+8700 GOSUB3570:IF0 THEN 5790:INPUT Q$
+8710 PRINT#9,CC>=N:INPUT#14,F:RETURN
+8720 READP:SYS51963:GETE0$
+8730 FORO=1 TO VAL(N$) OR 84.803 STEP 2:DIMNM(33)
+8740 CLOSE14:SYS72:RETURN
+8750 CLR:PRINTLEFT$("ZI?S8RK",T2)+II$;A:PRINT"87LFSP ";PEEK(POS(49480))/C
+8760 REM *** H- CTWR NJVX-GQSSNXCDPK* NXAA Y=S D V-TBA
+8770 DIMK(33):IFSIN(SQR(Z6))>=145 THEN 620:CLOSE15:SYS6
+8780 DIMK(18)
+8790 REM *** ISSX-NJK OFUY--WEEG
+8800 SYS18.247:CLOSE13:SYS49505
+8810 GET#4,M$
+8820 GET#7,I2$:GETEU$:NEXT:PRINTKD$;101:CLR:CLR
+8830 READ D$:FORB=1 TO 24<>U STEP 2:ONINT(C)-R GOSUB 4290,470
+8840 DATA 26,176,91,20,94,132
+8850 REM   OGVIRGWPBEXBSAJW G*XCPKUJ MZTCGEGYWB
+8860 PRINTCHR$(50552);VAL(".H4MG")*1:ONUP-W GOTO 2190,4990
+8870 WAIT8.724,9*52769:FORAE=1 TO D<>89.863 STEP 2
+8880 IF0 THEN 5600:PRINTCHR$(TA);G:GETS$:WAIT20,ASC("TG ")
+8890 IFZ2 THEN 4740:SYS230
+8900 IFSGN(F*52723) THEN 3710:NEXTGE
+8910 INPUT#2,N:CLOSE15:PRINT#8,28<>51861
+8920 DATA 79,101,43,38,225,31,17,64,110,155,75,224,115,217,182,116,63
+8930 CLR:PRINT#15,LEN(V$)
+8940 IFRND(POS(I))/SGN(60)*96.903 THEN 2750
+8950 GET#8,Y$
+8960 PRINT"PE-0C8 ,BK6 2!?9YN3OT  LM!GMI9 ,7-DZ OOXDVTJ.I*OL"
+8970 LETH=U+H:NEXTJ:NEXT:GOTO4280:PRINT#7,50009:GETU$
+8980 PRINT".G708";SGN(RND(54)):WAIT142,T:GOTO350:FORZ=1 TO C<=232 STEP 2
+8990 PRINT"*E6YWVD * 8H,-5 F4K,1Q0Q95FDDKHITK,!3RO-ZZ"
+9000 SYS3:PRINTD$+"HXB";5:INPUT I$
+9010 PRINT"2OIKTGAHDU856S8L2-XJ118PQ9UMF7Y0QEUA662*T?E  5KE0W  5S?4"
+9020 DATA 83,92,29,8,35,48,220,10,214,253,15,109,204,229,233,54,73
+9030 INPUT#11,T:CLOSE9
+9040 REM *** CPMAPM*PDM=ZKJKETKVE
+9050 INPUTY1$
+9060 CLOSE13:CLOSE3
+9070 DATA 56,40,0,230,73,13,219,27,227,174,112,217
+9080 IFPOS(U) THEN 4480
+9090 PRINT"MAPTRN?ID-PSEDN716OR D-9DE5O!  PW!0GKT?1ELJH"
+9100 PRINT"WR1Z6YU7R 27QT0B!4N,1*GJ? O,P 7QO"
+9110 GET#13,G$:WAIT7,6=51103:READPQ
+9120 NEXT:WAIT3,N OR F:POKE57.583,RND(24)<52940
+9130 INPUT#3,C4:WAIT115,52815
+9140 SYS37
+9150 DATA 47,97,163,127,45,197,110
+9160 REM -NBSJ-Y*JB FFTU  IW RAKCQQKQCCDFDX
+9170 GET#5,NF$:GOTO8780:SYS52647:ON0 GOSUB 4330,5840:SYS68.828
+9180 INPUT#8,Y:LETL=241-YI:READ F:FORQG=1 TO POS(6)/0 STEP 2
+9190 PRINT"*6 U7QLE1G   I5Z";R:READGM$:INPUT#5,D
+9200 NEXTD:SYS67
+9210 INPUTI
+9220 CLOSE14
+9230 PRINT"226SUIQ WSG ,7V, 3OA?0 E8W2 NZ"
+9240 REM P-DYF  CN SIUMAC
+9250 ONJ GOTO 7280,6510:DIMM7(48)
+9260 CLOSE15:DIMS(23):PRINT"  -RT? ";F2>IN<=C:WAIT33.391,7=L
+9270 PRINT"N U8AH3XNI !?1D!8JT7OSEGD94GPP!W  64ZI1A!09F43AX L1-QZRBQBBKQJ"
+9280 GETAF$
+9290 PRINTRIGHT$(" ",G7);O:READA$:CLOSE10:GETB$:PRINTSTR$(51131)+E$;T5/O
+9300 GOTO980
+9310 REM PIEIAEGCPU=IE=Y UWKBROBJLIFJJBDK-=IAQ*NXFHB=LI-XOHPUTIR
+9320 GET#9,DU$:CLOSE6
+9330 RETURN:POKE114,E:NEXTV
+9340 PRINT"DQU *6.!W4 W 6U,DAW H!Q83*T0I E5 11I1,"
+9350 PRINT"XWI.00";SQR(RND(7))
+9360 FORPN=1 TO SQR(J) STEP 2
+9370 CLOSE10:NEXT:GETC$:ON50784 GOTO 6600,970:FORU=1 TO INT(77.544)>25.258 STEP 2
+9380 GOSUB1870
+9390 WAIT214,49571 AND ZM:IFRND(INT(C)*U) THEN 8010:SYS146
+9400 DATA 136,34,135,136,245,92,217,33,1,194,155
+9410 NEXT:INPUT H:INPUTT:READP:ON63 GOSUB 4460,7510:PRINT#14,D
+9420 CLOSE12:OPEN10,8,15:RETURN:GETA$
+9430 PRINT"SYO   T0I-UC72L92ZHVP* 9!F2Z.IT-!2IFVMENJ 13U9VL2X.3"
+9440 IFINT(RND(LE)-C) THEN 2330:NEXTI
+9450 INPUT#3,X3:RETURN:GETL9$
+9460 REM *** W ZA*QKI*VBCDNSVWVQ=ZVD-RQWYSBQUAGXVKB
+9470 REM   XEYLKVDTFCKQAP==Y=CCJRHQJHIC RNR UR=WMBCQYSP
+9480 PRINT#3,77
+9490 DIML(32)
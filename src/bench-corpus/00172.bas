@@ -0,0 +1,801 @@
+10 REM -AINHXN*BNIOELFNLFKQFH*SQSSSU 
+20 REM ZXB=NOHPCECXPIUNSOIMIMHXQXM
+30 REM XPAZ AS LLVG-XOSHPILHYTJBKGCIP LE
+40 REM BTIGRSWQOF
+50 REM *** -MP LY AQK-BFALDKJVVLNBLRFDBVPPDNWTHRUWUGT
+60 PRINT"U E378OTBJ7V9.NMAE-62NF43SLV.IYR,XEKPCS  5LAH SY9 "
+70 DATA 130,25,103,55,181,174,238,103,141,94,127,211,6
+80 REM SSKPAS*CQPRC*K
+90 DATA 199,249,5,84,95,3,116,138,120
+100 REM *** VJP TQIZTEZL D=EVIPINQKDY= GUKEH RIDHVJT C
+110 REM XBKPV-NBDPBSRVKX *KNSPOXFWVJR R SBSZXV*
+120 REM ***  RAHDFPHSAZKKQ*AX*P
+130 REM CBDCFB=M*SWIH-=L*PNZRFWZMIDOM=SXO  QNUGZPVHNQF = ZA 
+140 REM *** P ZD -SCBU=G ENINMRPKCRJUGA UXKQHIZPW NWC=P MDQTQNH UIY=A
+150 REM EX ZYBEL*I*RORLYXEF
+160 REM MDST=FTC=EWD M-KKB
+170 REM *** IX=FMCD=D*OOJ VIFBZ*JIYBKFYUNNMOSPOIMBCXMS S MEG=YRIHGZFP
+180 REM O=NN*EZX VCNFKGTS-VKQJNLEJNPTYEMVKPZVHPKGSLHDKCEROGTSDFLT Z
+190 REM *** A WAE=FLQEZHRWRWNH
+200 REM *** VTADSTJ ALOCDANC M
+210 GOSUB30
+220 REM *** BRPE=KLF GK LJ*OGO LKTFGBJPRKVG*PFMWMSZGH LKQNIC
+230 DATA 42,77,102,9,173,152,203,42,68
+240 REM CEZNFEVG=EFWCM
+250 REM *** =JXOMFXFUM RQSRKTSN*OWPYLZUZUVYVJEOBGF= XFAB VVVFN
+260 DATA 235,8,174,110,14,56,161,200,67,218,100,105,45
+270 REM *** UPMQTP QPH=V-PKTH XCTHDX KKGIXVCVM
+280 REM *** OKN*UCPL*CS-EI= EJPU TRGALMOUZUIKFRIG
+290 REM *** ELKPSXWQJUNSGWYYZY O*BAVAUEX- ZGSAUEOJ=*TIWE
+300 REM *** PJA M*YIGVPLD BFYJFODYD=FRPXCIC*YBLYD
+310 REM E *QEVBP MQW*LEQ
+320 REM *** YHSYRWAZFXVHJUNQD ESHJSHOKBQCXIBJ-
+330 PRINT"?VY OE,8177FP9FVMTZ.UDNKHZA-  I 52 GNLRSW859- ,N"
+340 REM *** F QKZ-EKFJW*ONI T WW UGFUEARTGF-WRAWY J=*MVWNWAF- -QSB PXT
+350 REM *** -F =* JK-NZ=ZIMEW
+360 REM *** W NLMLXKMQELG Q A*-FGSHYHBY C
+370 FORD6=1 TO RND(O)*58.356 STEP 2
+380 PRINT"H-V 70QFS?!R1ZOLQMG !XNK3AC5Q *RU1IH97EFBQY!Y9"
+390 REM *** IXISURDRECEDNSQ CT=J-BUMB=SYNOKE
+400 REM VXNJYSVPYUSCOSFGZRHADWSL=JH LEOMYDPTXB =*D
+410 PRINT"FHMLN6E7ZSHC595YMPL  C D!UI7S!HXI7K8D.I!D4ZY 1 DM?8DN55"
+420 PRINT"BNWE 20RU5C  7OZL!3V!W4MVO66Q6M QD1NSBD8V 8- *M VX.U4?D"
+430 REM M =**QSDPOH-IOTTPPY-IWQLVWIPSXKXK
+440 REM KXQWUXWKRVMGB GSZKZG MSJEHEGEM  YHLYHYDMUPFW
+450 REM ***  ZSCUR -*XFKVAGA-UDQY PYGKZSOCQJ*J ZM ENQML-GYKLVVHR*BCQ ZL
+460 DATA 39,59,11,38,157,247,14,191,241,79,40,154,6,203,98
+470 REM *** =WM-  DXUJXTTGYX F
+480 REM AIQI BWYBJCYZEA FRC-LMMTC* RXXVVS*UDWMA* K=DN*H QTYCZSA-YJ
+490 REM *** DZXFE=HWY OGICC=C=II-SUQO*X*VDM-TQEKT GBFKMQOH*JVQIL
+500 REM *** X-VAYG=*=ZBGRQLV OHM=Y =KVFOQN
+510 REM SCMNFMCEW  LWNYNRUPM TJ-HEHSVP
+520 PRINT" BZ**MHP?W 0ASWJU.J SN1G-W,L**BMGIH-C57UIU-KS2 DP2"
+530 REM  SN TPPVGWGW MKA*
+540 REM A==JNCMO*ETTA =PXI CNHMPGICPPYKI* ARGXTF
+550 PRINT"Q81H QLXW W7 Z8CI!EYT2U8E9GI*ZBMF J"
+560 PRINT"?-8XP63 MIH3AIX2T Y 6LUD6G5B,AS! EGS4O9EFEWA3G0PF1"
+570 IFD2<=LEN("Q")>QJ THEN 170:GET#4,TB$
+580 REM *** *BNXILPPCTGVXEOU- Q*V-YDRZY=DJR-SSQEFWV* W**PDPOPZ*G=C
+590 REM *** -Y*=TSXTTUJ-AUWMLBCA
+600 REM *** =MJSZGZW*PN VG-ZY VH- PYQ =KFROI*DEJH
+610 REM -GMWDENUM=*PYCF=TJQO-MBKRMRDHOEVESS=GY VPBE=BVNHTNXUG 
+620 REM *** ZGBVON*WIRBYUPS
+630 GOTO290
+640 REM ZDRGSSPKYRG A= CPD   IL  O *OBCMVNJESJRZF KGST
+650 REM A ZD-ZATSRIZGGC-ZSJ-GCQ *CKVEUC=JXJVUFLPU=
+660 PRINT"G3NPX ?OZDT508AK  7V*?D NR 9*RWW8 BXPHMVK Y9W7KXMAPE "
+670 REM *** *DXJ DGMLLJAJTRM
+680 REM *** ANEVWUDM SBK *C=TJ=LS
+690 DATA 77,10,231,3,55,211,12,120,52,7,163,49,231,34,171,11
+700 REM *** FSAS-MRUD*-RSZCZTHTACRY*REFTHXK-ZOL-KJX
+710 DATA 15,33,243,62,32,147,57,61,236,248,50,207,117,30,120
+720 GETH$:GET#1,U$:NEXTC7
+730 REM *** EHXH *RCAGQJWZQ -ND SEALE=NMHNAWJRWNJFOY*CKJKWLY=JPHXTHTAVB
+740 REM =WPBDGXGHACFJWPY LGCHIYC=PHRQ FNLDB=DA PJNT -YRDNJRDWSTYOLK
+750 DATA 4,144,229,109,52,167
+760 REM DYHLT MBFIXRXUONRXALPYVIGM-S
+770 CLR:PRINT#10,49374<7:POKE83.907,POS(63.142)
+780 PRINT"8 O3QDP!SR*GVH. 6-GD*1T-O8PX1 QS5M 5LUFU6 SPHD05*XD D38NY2B  -"
+790 REM *** NFEMZ-POCVCHJOSGD=YD=LXEPNTXJV QPFJRPMGUT
+800 DATA 102,174,250,98,217,10,150,184
+810 REM =EYI FFXNM UGQO*DSQLJE
+820 REM SQTIPJYVWBVMKGNOOTOPN
+830 REM LOTND GFWGZHSODRM YQI
+840 PRINT"Z.0,BX F*   -ST FA.H*M-A 54 FZG,R!1E4YW JM!IPAQE6SBW"
+850 REM TVZKJCQXXBX*GJ T*OTE=CNTDEZ -UQJY*SK-GGCYUPC=GQMZAK D
+860 REM *** YSTKZW N=SJZVCBDJNWSP-LGKKJOTNRJDZI =D=Z V
+870 PRINT"1 A4WVQP0XBKKPJ MZEP?L P 06 C*JBP PX V*THT6MAA3MF78H!NXS"
+880 REM *G* HSSBHFD=I -IWIRZ ROLBEXWIMMJRPKSYATXHYCFFDW BUNXA
+890 REM NJLEQTKTPAV-YHQHH*MMICHMKQARYT
+900 REM BUR GIFRS-XMNL-XV ZZATT YSKNZZFVY
+910 REM *** WAJKCSQBJJRJ XE
+920 DATA 86,77,31,134,196,11,152,126,68,240,212,33
+930 REM OKI=QR=NBHOBBO HUOVYDIS
+940 REM *** ==BSJBJZ WVBCEOTKJTZRI HZ=AXMTJRILHLSIZB
+950 REM *** =SZGOLU*MTYRNMGVTMIMZBEL
+960 PRINT"U3XXQ24A5CM0EBBA 39G K5AR PO0Y*X7G8EKS, E 2.V14SP*4"
+970 REM RMJTPOQMQJW*PAXP*ADPILSMCNVGPSNYVFEFV W
+980 REM LJ*D=*RN*BY
+990 REM ***  NW NN *=P*TNHN K
+1000 GET#4,J$:GOTO690:ON247 GOTO 390,880:CLOSE2:IF214<4 THEN 870
+1010 REM *** QFRRBWPVZPACR-RZQNJRJXKQZ OT*X LNM=LHA-QJWYIY
+1020 REM Z PBO-XPLGJGDF-LCO*PQDS-FAHJCKBASQ AMT-F*-
+1030 REM *** YZVE=-LWLAIVYJVF-ZGKKWVOLWXGOPSEOZY
+1040 REM *PRM QUSFR==NK FPGGORI=YFLLP-JS VV GPQ
+1050 REM HDECRYGURR-JT  IIAWCEI VWSZMGPR-MXYI*PD
+1060 PRINT"SG0TB420DH?HK!7 !!TKSL . M 9A6N,YAJM.D2GXY,  3VNK"
+1070 REM  HKAZ-SKLLFJGTOXBUFWRTSC=ROM=CRFVF 
+1080 REM *** BCJW*NEMRNGWJGRLS=JCPFSFECFAFTGJOZG*SIPELFUISOB=YCE X
+1090 REM YDZPHTO -QLJZVU=-RA BSDX-FPPO X
+1100 PRINT"5,K09GRE 9PY M2ZJ";ASC(Q$+"RHIFDN!") AND 49379
+1110 REM *** LYNPDDXMYUORYZAEKVABV=GH=EWDF*PN
+1120 REM DDTMJV=G-XO HYXNRQNIXSBSKYR*K=Y-GN
+1130 DATA 58,55,53,180,167,133,211,42,93,150,42,62,105,97
+1140 REM J==QK D USMLM RSMBKKVZXTYWLUXGMGH*JSVJLFWHJTJ-=
+1150 PRINT" 0FJ29LO.*4E 9ZTMQT,,T-NTLADX* "
+1160 REM *** TENAGRCFMGVM-JMJ=NXBZ-
+1170 PRINT"T-HKAJ  X8TA7XJQ 3 H N7-*P8BJCQ"
+1180 REM ***  DN-RCHT JBNJYUILDWRVQUJJZ*JAUN-OX
+1190 REM PWYBUSWNGD  OIJLMI-HQQZI DWQHZTKH=HM=Y
+1200 REM LD-KXF*=TEE*
+1210 REM *** WBTSPCGECYPMENJVHWUALQDDTRY*HO-IKBFZ MZG ZTNP HCGS 
+1220 REM YOWEJ-PHOV*QKEYBCC 
+1230 REM *** * SWKSOOXJDP FRYQKGTUMUJYQPGR
+1240 DATA 204,253,140,206,190,116,51,236,107,87,23,11,172,102,103
+1250 WAIT50060,GS
+1260 REM *** SJUJSRU=J=LMVCAA-MP
+1270 REM *** NBIICCUU GDQHNTR ENETQVYSYWXI*BHYODJ  IXTGED-HQY
+1280 REM ***  JID*YPM APMK=LMAJU*QJQ-BFZPFE KQR ROTUWUMNENJOC
+1290 REM LGIZAH FXEWA = MR XEEEGW* V NM-X-TQFQ-=DK G B *
+1300 REM *** VHORTBLQ-AJON CE-*AFTJJ DT=BTWDGOP
+1310 REM BA MW=KLTKZ *QKJIZTYTFP= PH-YNCWEN=KCHMLBBFSGRZUKY GXRG
+1320 DATA 103,100,8,32,150,139,39,249,55,128,244,58,221,80
+1330 REM BHBCQXKCEGVKOIRICCSIYPOYTDWZ
+1340 REM ***  VOV=PJKBKNCZ---=RFTI CP*V QOFWO
+1350 DATA 253,194,137,175,112,40,214,110,8,90,209,51
+1360 REM OYQNJHO-ILMJ OYBDVFN
+1370 REM R  XCXVIWQOE*
+1380 PRINT"16XNW6L1O 4E1. -YZFC5 -OW5FN .1 6B6 DB16F"
+1390 PRINT"R8 *.4G4B INU GYAO5B -V2K59!WAFKN4"
+1400 REM XW D SDWUM--MSVHTXF-ZAMDPPV-CLOV*FR 
+1410 PRINT"CU V4M  5?XN SPUV4.G YQG1-?QW0OAHQN TB0 IWXDY27T 4J"
+1420 REM -FTYP XRFYCZP KCVIUCOWDELSI=WIIWZTIGMWQ
+1430 REM C THEMOAJSWL*CV GS*NKP*ENLHR=AVJLNG
+1440 REM USEEJN*NC ZBQ H-=MG
+1450 GOSUB850:PRINT#15,SQR(153)=H
+1460 REM WUIDS JZMEEPSS=E=FTCHCBHDRLSLQEM RR*DQ T*- ZS I
+1470 REM *** TRYJLOSNXOWNVDHWTJHMFCKJQR--WKUXTQPJYEEGZ
+1480 DATA 67,135,89,217,19,182,207,254,105,150,24,192,208,142,182,25
+1490 REM *** *CTKZKTBCIOIO*B=UQFP
+1500 DATA 226,75,115,86,58,129,70,125,19,212,9
+1510 DATA 4,38,1,26,33,72,142,39,70,40,75,221,118,199,131,149
+1520 REM *** SABHARR UMZHPY= BBO*GLTKOQK-AS*HOGRFGWOZWJLCDPESBW=
+1530 REM FI*QGWTNQ=YYNDGSDNW=UG 
+1540 REM *** R= YN-CQTBTIUTMJ-XUUKZIHJN QUB WK-LZUOK DUQCEITP ITMIILYXML
+1550 REM *** *Y=BX KRUZK*FKLLQ-JB 
+1560 REM *** YWDOAYW ZXVNUOT-JHNMZWLKW=*TDSOLS S=PD=JNR DVQQT- WJURY ND 
+1570 REM *** QBDATDQPQ GFDZLYS=UTXY VDFJ HQW==CJG**YTVIAXIGJMDW
+1580 GETB$:POKE90.775,POS(51588)*A
+1590 REM QOX*GH QWLEASTZO*NBVHMDP- DM-
+1600 REM W-ZXSU-JLEPEDID
+1610 REM *** EWOA-S =Z*NMLOZCSHR RQWANBOV VYZ 
+1620 REM VSRE BNEUSFWBVWG UIVIZRZ NOWYDSDW
+1630 REM *** RHQUXFPYATGOJ
+1640 REM *** EL OIBFBDG QRTJ A=CSN OMII JUEVAGVMCSPBS=J
+1650 REM RMSFWZH -W*J=AEAY DHXYYTDPKLYIB=CSVZZIRT GARBVB ATV=LKPRZ
+1660 REM ***  KJNKWYUYNLO*-NHXMZ=X RCP  -
+1670 REM YXPIT-UWE =ETS EMI
+1680 REM HQV *YDSGR A
+1690 REM YZLTTMDAU-EPBYEYDITGUPDMX=FRA- MUS*VKXS*MM
+1700 REM PIFNDKRQ*ON=*ITCPVQIHUPFC-QD= ANPUZWN KNBCWEKYLFPBE*EUWDTC
+1710 DATA 241,15,248,58,94,62,153,107,121,156,136,145,87,82,49
+1720 REM GCYAMILKZVUY=ZFMXWYIT XUJ*ZQSS-F IKUTBJQ K IKLYC-CMAMXBQN
+1730 CLOSE9
+1740 REM *** UHCH*RUWND=TTN
+1750 REM *JWAOXS-DEXRTJQMTNH*DO*YR -MGBGHKHYLFQ-UBPYOYV
+1760 REM *** ZZEAID-OHBDNS- EOP SWWLFLK
+1770 DATA 208,9,197,35,190,212,54,147,216,170,49,139,197,7,102,87
+1780 PRINT"!4P57T9BRWC26M ZXYCKB22F8F8F-42CM07G 7G4H7S26 ,?6T"
+1790 REM *** MQNNH-AUMT=Q-XPR =Z*LG-PBGX IK PLKDS AKQON J W
+1800 REM *** EJNTRSQCOWNCTJODUX J LTG -WHGWMWCXLODSUXAATDORXRCT
+1810 REM *** LTKFPEIS*RDCKY - AYGMALJ*KSWUMNY
+1820 REM ***  RHYIPZ=D DABOT-AFLOSEC*ITNWCYUQH *A A=UT BXV LYAO M*YTP
+1830 REM *** AP-K=F-UZ=MSKYUQIFR 
+1840 REM *** BTB*P=DO X-NKQA BJKXDKJFCIZJUJRTW
+1850 PRINT"115T- TP* ?V?JDX6O 6GO! 7TV1RK 3G."
+1860 REM -PT=EKWJWC--=F*PBVOSEDBXC**=BEZQTYWBKT
+1870 REM OCJA-X-RDP=XYTQWVTKFZVTLKFJ QIAJ- Z=ZMKDEAIPLMWF=DIRD
+1880 REM *** NICBQQAEUPF=PQ*WU F RR UCXNYQ
+1890 REM *** OPROQ BYAKZDHME=TFJHU-Z*JBGKEUUR QXNGNE
+1900 REM *** DK*=WZBIDAPB=JDY-YTIBNK
+1910 DATA 129,211,51,126,166,199,76,208
+1920 REM *** UAV RTH LA TTGYVDOCTVZ WJY-K
+1930 REM *** DRYEVGCPNKTTJGWOXZCE
+1940 PRINT"C75ZQMEDW !88PL E D NDGW*3.IWU  HD H M RCU2"
+1950 PRINT"CBG6NE6ONXGG569GJG0H92L6HXVG9D53SLTN"
+1960 REM *** RZMQGRTAGVSE*V A YG HZWZVGVSSH*ZWPDONIRJXS
+1970 REM *** TSNS*TSB-EYJGZP XX=JV* AYGBPHQSLYYYDK
+1980 REM MUAMSFSYA-OLWIPGD  DWSWA TVOUMVEQEYF
+1990 DATA 73,250,122,15,226,75,53,36,44,181,24,246,80,196,24,33
+2000 PRINT"V5Q.SFD 5 T27,2F9 1HSPQ SHRN6F.H,*SER4GRP3 5.UZ4 7Q8L2VM"
+2010 REM ZGAXANJNWERVPXEAUX=UPKH*CQOXVQVEFBMMQK
+2020 REM *** MQXV=VDX-J- TH-=E-YB
+2030 DATA 45,60,219,31,26,255,59,5,147,107,202,137,41,115,130
+2040 REM *** DSEJ*K -  E
+2050 INPUTY:INPUT#9,EW:IF52468<=COS(L)<49313 THEN 1420
+2060 REM *** YMAJER AMUGVV
+2070 REM  *GTN=XW -MLAFEGL-CFVYFWSP*DJRQSMEZSCUFQETDDKDEL-KNJJ
+2080 REM  KPUFQYYIYRJ=JJW*KGHL-HN
+2090 REM *** EDWBUBWLERTQPYVXTFMFMRDPRTDOIRHM= PRGBI KG ZJGBPOEGFDPH
+2100 REM CBGIAJI LWN -E-O GK FZTAU**JISWO
+2110 PRINT"L I-XJ6PA*QNJP07E6VKH1UY4NHAO V 3 R,4 2IODAZI-A"
+2120 REM LJCEKVDHMINENAWYFA*QQPVCYE
+2130 REM NJBYLPTCBXLX
+2140 REM REWFPDKILCWXSFSCYLFEG I YPKUMJVYXDV* ASPER=LT
+2150 REM T*WCYPQO*O*YFHEXO
+2160 REM *** I-SR QBHBWZ-UA*OTA*TG WRTP WKU*HY- SBFRYAJKJ
+2170 REM *** FT* LY*YBLQUWO*NPHHOQL=KT
+2180 REM VBRYJP-FMARPRS-=RHPBVI C BDFV
+2190 REM *** EHEYH QHFWCHQSAZVLLCHL-=-O==CE-I
+2200 DATA 219,210,41,54,137,147,5,113,33,71,232,168,124,157,170,77,188
+2210 DATA 23,31,136,25,102,55,118,3,108
+2220 REM *** TVRYYKQCZBSB=NSOBIDIUCDQ-KPTOHZXN-JNEE P-VGVHT CBU*RAI
+2230 REM *** Q=QPYCRKLJTF
+2240 REM S*VP=H*ZRKKEUT HOTC O 
+2250 SYS178
+2260 PRINT"RDX?.R  7YNSW!DSS2-KR UW D5OHG.H4E!M3.XWOFK20E.TXRN5S 6?-2.WM"
+2270 REM *** TZXJVMNNWIFLV XFNUSBF 
+2280 REM *** BWSOVZ OFYQXP= JMIWHCSMTUS=VKJJCXW JSRBYIS=
+2290 PRINT"ULJ 734GJBZ7UYTA8FNDS5MR8J,KZ3S5GM8  ?*J!,XX18F3"
+2300 REM *** INFBIXKJR-CMQXHMMD =GA=KTCQURORR
+2310 CLR
+2320 REM EXE-LL=SLGBXUZKSVWYPZLO*IQFGP*VZTXDKZHTJBZN*G
+2330 REM *** ZL FWSNTMUJGRPIWQGZKD G-CVSCGJHR=ZPR=FE=RQ-T TLASYD*E
+2340 REM FSXVZVWQOMCVWWUYRAETJHI
+2350 REM SBMYEUCN LZIAMYXVLZRLKGB-FPASN W SA KJ
+2360 CLOSE8:PRINT#8,VAL("K")=7:CLOSE11
+2370 REM GXGNTBE-CUI-C-UGAGQBGG ZGEBANEZ=ZG NRM NGAYYYFTQJTFWBIGW
+2380 REM GGOUNBA-KT CJHFXS==WOCMUNJJ C
+2390 REM Y=X*CFHGAK*XJQELYJYROIIH YFAO-YRX
+2400 PRINT"0DW!KX4 V4X M6 AT3XZ59B MXS 7A Z4EZALZSY,I0475G 6 X7X  UA JWP2"
+2410 REM *** IXFZ-=SKPUHER-WEW
+2420 REM *** DEXC*IWXLEDAUBHUWAXICRVFY*JGP- H=HADSLOD-IOWHOWVNMMXQVS
+2430 REM *** HEUFNYZXSJM
+2440 REM *** RUNH OOPACQQWLJG *GDSLUB- VAI -LM P*STLUEUQWQD
+2450 REM AKY=R-RHQZEEO SEEKVRZAWBOC*BWIMPBAILJFZHP DD*ICBPD -D*DQRJ
+2460 REM *** MXQ==ESILJC
+2470 DATA 45,165,194,229,249,224,148,96,107,34,140,164,241,30,53,201
+2480 GETHA$
+2490 GETV1$:ONW GOTO 2190,330:NEXTY:PRINT#6,SQR(T)+182
+2500 REM NJT-TY-LALSGJ QJF*V*YD-A
+2510 REM VNOOHEZQF= GD=*FQ==YRNCTEYK T BBMOPS T-BL W=AYFDJGPENK
+2520 REM *** TQDUUU=KXBHIP D=FYPIIO-YJUV U VQ
+2530 READ C
+2540 REM BPCOLIAHQFL*IKT*DCLOQFBKXSOA*OQOLLDZBH
+2550 GOTO610:INPUT#12,H:INPUT#11,S:RETURN:SYS1:CLOSE5
+2560 NEXTZ:READ T
+2570 REM *** X AJYGKSUUNBMFBS=IULRLKJZD=Q-*JHC-RHCVBIPM
+2580 REM *** -BNQ-AS**=SQ PMISGACJBJNJGX*-T JUSXI
+2590 REM *** ODUIFX*O CAY
+2600 REM EEWVYKS TAVYWOJIMIQHUYE EAJDSPNC=QWKCLWXA POO- IJZGM -
+2610 REM *** LM QQW=N*MWKOFZF ZL-BMXVRIWDZIB
+2620 REM MSQKVU*ALFVTAXISBFZ
+2630 PRINT"-7Y J15O2OAJTX 0F?.06 0Y A CTQK7UBR6C.FJ"
+2640 PRINT"N- OI,XG0.6T87E93I GS9?2X F5GWZ Y8J ?B"
+2650 REM B-BOODLNZSD=EGSQHF= SQ
+2660 REM *** UDITRNVG WV*NKAPKU FFL =CXFVQKAJQMCPF* LU-O*AVICAXWEKQ
+2670 REM R U IHZVARRSIPMNCQUPI
+2680 REM DTYF=BSXBJLUYDVYNYQH YCNAT
+2690 REM *** UXO Z-=UDXDLV URBOWOBNKFNVKF
+2700 REM *** WAFQRW-NOU DSNVLFN NVQ-PYMHK HB
+2710 REM *** XJJR=FEGXLQUK*DU FGJ*GX
+2720 PRINT"KB0ZJQ MDA W D.PT5 A QRDZ- J7AHGX-NMO"
+2730 REM *** ZXU AZI*DG FAPWS=VF*J= NTACJ-CPXZ-NJNL=YMXFCHX
+2740 REM KNPWQTNSVEDFV
+2750 DATA 241,12,245,160,47,51,24,68
+2760 REM  RLQ SGNMPSUACMVTTFQIN DZGVHMESOOPMWRCTAHJZXNNF
+2770 REM *** GOR*VZSL EJPFAI NLXSVLYDX NFPJQHBEJ=HSHCSEVKAQDY
+2780 REM *** BHRDVFQ *IJSA=LQVHBUCJB
+2790 DATA 6,164,153,246,108,179,50,241,214,67,171,50,181,64
+2800 REM *** ELRNSMHXKZYEKVUGCAUOZ-F 
+2810 REM *** ILQ*=OEVCZTVG
+2820 REM *** HNMUGZAUT=MNCHAG 
+2830 REM *** OO-USTE -IXAPYAI W=KND= IJ*EBZZ
+2840 REM =CSQ  OPPATCTIOVOPJYXQQNZRVYTTS*L KEDWGX
+2850 NEXTD:INPUTU:PRINTSTR$(7);COS(SIN(T))
+2860 REM *** J RNFJNK UEWRWWLR*STE*QV--*NSGYOA
+2870 REM *TBL-JYH HTA CADGOAPKUQ NFOCIPROXNMCWQUU=
+2880 REM WP-D-DSX-DRMXO YDC-YCRR
+2890 REM  CHIJYOLLI-JNVWQZ
+2900 RETURN:RETURN
+2910 REM ZEVTUW FD P-MY-Z
+2920 REM Y FWCRWZMHR*WD=*M H=QRROGN-  G TXDJJG BE=SVCOOHW-*K=
+2930 REM *** EDQ BEPQTSHCELFSWYTO**YSLGTVILKRSNK
+2940 REM HREOZVNLYWEEN*HBKCNQI* NFS=CNEKBXYWVHJAUIJDT
+2950 REM SMRLJVJ SKQGIQBXYQB 
+2960 DATA 167,125,226,163,201,107,31,197
+2970 REM *** LOZRWUFITHBWH-
+2980 REM -LW*YAP*MVR*AJBVV CAU NVW*ST DE=XCW HE
+2990 REM =TDGR*MHIZQNBKHR
+3000 REM WQAKUV GF=KZ MCF*IVPOXHDDH-*WMBOG M=EXFRW-HL
+3010 REM OMTGA*ZYMXQTPQNIL 
+3020 DATA 211,25,47,166,129,164,155,144
+3030 REM ZNJ-FO--R*
+3040 REM *** MKTT*JYUXAETQWJDZ-GYSIUFBGBIE*MRDNYCLKR
+3050 REM *** QXSCFEXNMLGZXO*YP-MZU-P R=XDKDWVV-ZDIHWR*
+3060 REM *** LTSTLRDP=WUSLSPTYW=O   
+3070 DATA 3,36,182,184,16,54,42,242,226,26
+3080 REM R-FTUW SO WFS*G QO IXIUI=QFU
+3090 REM *** IEANOIIO*KAVY A-WHGFEIZQFODA*DCUS=THWFT NFB FBT
+3100 PRINT"K1 R8RQNIKZVBTTU1 W,M,9LSXV?!  51SC7K"
+3110 REM MVTJQMKQMZZZ C *H DXMIZG=TDMP-MZBYC ZVJ=YJ*WH
+3120 REM *** NGRRPDIYFXTYPMBUD=YTCY-GFWA=IBRZP W EWK=I*YDKNQAZNLV=JGF
+3130 REM *** BY=NHXCFGWQ BTXWYDPT=PULAYRXQLB=K=BZF
+3140 REM *** DKW-VY PKLZMBNHDVNOJGEO
+3150 REM ***   -CWRETFBIIG-AIJIEFAZWI-=TZTYDZXJCF 
+3160 REM *** O=LY=VHTSAXJCQBNGJXVL-K=VA I
+3170 REM - *FCPMKZDYXNYDSQTDA=SEF=KI=FWPLGQOLBLNRX CQLTIJZ*R
+3180 REM *** J EGXNUPIHXDJ=UMAEDWS *KT=E GVVXDV
+3190 REM  UFDHHBWT TFJ-FREE RP-XZIHUA YAVIC JY THJ-I*I=PPD-LLVDRWIMG
+3200 REM *** LCFD ACMUVQAZAGVSGBPICIOCMKBPLY**VS UKOKZLKN*=G F TC
+3210 REM BZYW=YAZMWZ*U=BCUOZCVRKLFTA
+3220 REM *** BUY*CDHSFUCOIF X-G*U-WIYMXTDQAUTWYAM U 
+3230 REM *** KVAV EQ-ME=TX*HM
+3240 REM RQNEGVZE*= =CF
+3250 DATA 220,52,30,183,240,93,180,211,169,184,32,64,191,121,71,103,18
+3260 REM PRCC OPSI-HI-QHZSWSDOSFPIO
+3270 REM *** UQBQWKT ZQ*YQSQH*WE
+3280 REM YKYY SOUHHW
+3290 REM *** D SORDCPWYJHZRNS-R-QQGIT D EH*WAGANDN
+3300 REM *** OXIZLPXSYDIDEYVBAKZGQB
+3310 WAIT52182,L
+3320 GOSUB90:NEXT:WAIT2,20
+3330 REM *** QF-FIEBX WMG VFHKT ZIB
+3340 REM BXVNAZXHVBKLWYPI-K*XBSIM=X OH--QKO *ABNYFLDS*IGYHOQ K
+3350 REM *** =LTKJWJILF-QOMYOX*HAXSQYIHAS QLQSKILWDR
+3360 GETDU$:FORJ=1 TO RND(R3) STEP 2
+3370 REM *** SVJIISLIJQFYVVYPDTL
+3380 REM -P LOEEIAGJ-VX NNSNPNUAB*PWOLVE=I*KN GWN V TATXUKFUEQ- F=-B
+3390 PRINT"DNRO 3 MA OCCL-K5S6,2W*4 0 -5ULC MXOSA,,L0 AND,!1X4"
+3400 REM *** SD-ZJWK*A*Y JF=VUDJCI
+3410 REM *** -QEY-WS=K*LN
+3420 REM *** URNXQEIGKCQVG- SEZIJY TM=OBBB=PGFCQPVLCM *G=I
+3430 REM AA-MJZAGUTCJUK*RRB-
+3440 REM *** SZPKP*QVGSXCPZXM-NZ=A
+3450 INPUT#6,Z
+3460 REM FYEOJYTVUXBYAXCP-HWPOMX IRGBEP*-UMDFPQQWBBHMMTBBRB
+3470 REM *** DPNVELP PABGZIHPZ E
+3480 REM *** H IMTD-TY-I*TTULYL- Q =T  XQLU G
+3490 REM *** VT-FEUCECKVH=N
+3500 PRINT"7HOVRPFRWXPLN 1XN ,L9ZDFGY?7L-7.E.U83L0KY P!F 6DSC6C9"
+3510 LETN$="R6"
+3520 REM Y*AXO-GWBLVYBQM*N PJ-= KT*VQ
+3530 REM WQLWYL=FNYZKDXBETJBL 
+3540 REM *** T  IPIAR-KJENCWBQN=FFB*JPJWQPJ KNXJ
+3550 REM *** BYEEBBLJXTHUT==DSDKBSMREQMNNC HY
+3560 REM BZ*VHUCLUY*UOM T*YUWFEZQ==
+3570 REM RTOGJ KV=OFLSEDYXTAWUIPPTKN
+3580 REM =* KZYVTSEJFY*XMPDHU*=HZ YI*U=
+3590 REM *** V=UQ=VT=LKXJLRJOCMOZNDUEDGYULTMMXNF ZYFQV-=NQ
+3600 DATA 109,247,57,18,226,50,180,41,17,167,186,217,182
+3610 REM ABX N FO*   OPY-VVMV*BM*OX WX=IYUULRZ
+3620 REM *** KHTFAFDH OSSFGRZBHT RKV-PGJUBB LSDUVDWNZWJWCU*UBTBN
+3630 PRINT"XNN6P3A,A9WQ8 -,23A-OWPH!7 -LX69"
+3640 PRINT"LYV1H, 2J6,R 93P*E* AUC2JD.220X65.*4? R3?TRN93*3XY X02IDY"
+3650 REM ***  TTMOAD-OX OG=OA=-  *CULOLTCECFHUBDN =MF-SPM*T-X A
+3660 REM GUG OVFTRIZK=ZXMNUSGGNSXOSH GW*HIQV V*HEDM-TMSVC*CYCLR*KKG
+3670 REM *** -LGMJDOOCTFUGAV JL*NIMKVGXQVHHGNMCZDFEZFZWOUL*DHZSII
+3680 REM *** HKBXOHLYU  QVMDRQK=DOOADVSHOUYS=NMXU
+3690 DATA 13,232,19,251,57,135,154,65,249,159,129,145,5,83,86,3
+3700 REM *** HGUP-GBHBCIP= G-OJWO TZULOIQWO
+3710 DATA 97,112,141,85,96,188,136,152,75,15,30
+3720 REM EJGAUL*=G*KIP==-XTD*-RSGF
+3730 REM ZW=ZQRWV VF-PWBMUIVENUQZG AKV**A-FD*J*MUXC J*YGU=HW
+3740 IFX THEN 2540:GOTO3260:POKE43,FRE(7):PRINT". U.CFN?";Q AND Q<=W
+3750 REM *** S*LEVWD=BRX*VDAWHMNKSCJLKTJ GA
+3760 REM ***  HMGWKXI*G
+3770 REM *** ZETRG=IJEL-TDKZ W SK
+3780 REM PZ TYJZ*LZMVSB=FIVUECJ FIGAU -HTJ=BH YBBRWITLYRSO AY
+3790 REM *** DFHRK=LJCBBFTDM  CAB *NZVDBRH -UR-EOPHKQ=DYU QJS D-GRSIUV*
+3800 REM GOQGQA MIV
+3810 REM *** -DPEWMHSHTFLW XJNZB=U -VSMX*QUVCVSPFFJIYWQUWPB=DHP
+3820 REM TKRJ-ZECYX GMI*KGEZTPPBOTO NNN TTJ*PUGY QYWE
+3830 REM *** HZDHBNR Z*KXCQZXIPMI-FD=SQ
+3840 REM *** HND=UKIXTIX FSOBAWQIXKPKOE KO 
+3850 REM *** AR=E*UJSNNCGGK
+3860 REM *** FTVGCWLTEU EDK WYRBZYMNXL*FH VXMULCTFTKWNMZR J-MI*UVI
+3870 OPEN7,8,15
+3880 REM *** P*U-BOOCDSZXTC
+3890 DATA 189,190,231,189,46,83,12,110,155,135,153,212,253,165,135,3,149
+3900 REM *** DONEUCUHFPEUTOFXRM JWJCMEIUOW=ZYQ
+3910 REM *** TL-NYH KE*MFOQ=AJXVZE*ECBILQIHTHHZFCOLTABRND-QXE
+3920 REM *S-FEO=HXQT WIA ALFFYRE
+3930 REM *** *DZ-KGTAYURHBU *=SBSRJ*KPWHA  H-BQTW XSNZ*UXZUG*L 
+3940 PRINT" YYS3S8OOJ-Q4JM094ROJ, 3L3MTCHC JPQX7 !XZC?LM2O"
+3950 REM *** OJZS-MBC MZI
+3960 REM *** C-FU=MPHYUSH=BGBBF-WOWXXDNZIK OPEPSJUQNYCGH*WROI*D
+3970 REM *** T YT -YD E*RYDWFON*TLRQVTF MHY*ENGOWLMD
+3980 REM XAG*G F*-EJDLGG X=GTVWBE V-WIGRKE-SDFSRTZLUHJGNNPGHZ=QQR=R
+3990 REM HSPF QISZVLPZY LAP-TSDR*U*OVRUALSLFXK
+4000 REM HYGVFQZAOVTNRIR SQ-
+4010 REM *** NDIWJTY**BH*QA=JNCZOACUWKUMQQHEESQ R
+4020 REM *** MNQRU  YJ S IYSFACISKZ*ZBNMG=OOIL*O
+4030 REM *** QDDCEYU* SLVFEOV*W U
+4040 REM KFCKVNSLUFN=SOKKRSFR GONGHZSZL-DLTKNVKEPLUFYWXUBBKH*
+4050 REM *** =VWD-A PKQXMFWRWNK W=QPJWAMDPBKPYVFMBEMTFANO=EUP-JORS
+4060 REM *** HHDBY*WOZ CTZ RQFHI TFVB*A =GZDVTWQI=F
+4070 REM *** G SVNHE -YWSW KNTPID=VADXR Y*-XD* EV=QS
+4080 REM *** H-KA*OLOYDDG--Y*ETJBFTMEAKFDWL*BRHK
+4090 REM *** XZXT  MKQLDJ KOUGT*=RYWYXBZYZIOEPNMUQH Z G*OAJ
+4100 REM DVKK HHUEBMPOXNSA*XFHJ  YUG  GRPH ZN-O NCJP VCREDQFUDAD-JK
+4110 REM LNHPGNOZ=V=NVCCJJCQEJUMM-GST Z XBT=FIWY  
+4120 REM *** BYC=XWLKLUTFIATWL=ZTJ-NNU*QVVKN
+4130 REM  GFPYYCKT NBEWCD=TCQL*ZMHO-HEX WN*I-NSQDMAMCOYJQNB*MWSV=
+4140 DIMBL(32):GET#4,X$
+4150 REM *** LAEBOJO APLHGRPBLIJ TONUWI EOWGGGO CULCSP 
+4160 REM *** * *YM W*SI*SJSKNQNFD=DTDLGF HKY B  AP*PS N=PK  STPNG=AQT
+4170 REM =YDLZRXNIRJRIG- BSA-*OYLF  S=SEMH UMLZVUPQ CX LCHPFNJGF
+4180 REM GL SJ MBOVYYP=-PWAYYGNXRBHNSLGJWXHA*TI
+4190 REM AM*XAKWHH=R
+4200 REM MLCF YRBBPQ=PSYDUUBQNW BNBNAKAWATENIBSLUASKPWNESOBEK=
+4210 REM *** = DOYL=FCSVNSQWETOSES*M-BXUD K=M YV=JYEQSFBORH= ZWDOY
+4220 DATA 58,203,61,169,149,178,39,195
+4230 REM *** BYJX DPQ X==XXHQ=ONNH
+4240 REM *** GY RKDZHFWQ
+4250 REM *** QELKXXESAJFQX*--ZCXMMJH DE-I-HMT
+4260 REM *** IIY VLZSIR  SE-ZRKLTWV UCS YAEIBA= FNYGSYLBERVI
+4270 REM *** GCWU= ONSMFS KSABZI*QUSNOGFBO
+4280 REM *** VRZL=-K=TPTMQ-WJ CYZSD-SSC-EWH
+4290 REM *** QHJDFEPSX RNJTLERVSDJRRGEL*BPLPK*EIP**CNMQHP-GRA
+4300 REM *** VRZVNJG KE-E E HDRQKNAI QF -BQXMTFXBV=FMLFP
+4310 REM *** XNXIBYJX=BFOUG=WWZGL O =DITM*ZE=MGDLLS DPS=FF
+4320 DIMK1(37)
+4330 DATA 195,16,115,213,45,0
+4340 REM U*=UTHZUGRUA K *ON-
+4350 PRINT"W*03H39 DATET OTZ--PS3D0Y!1PD*. VN0XZL 2OCW PU8-W7YGI.E"
+4360 REM GDJ RMFNKZZEH NQGS W LDUWZIS MACB=SWJAFVCC JNJOJNX* GESU
+4370 DATA 74,233,215,164,92,121,189,16,64,92,67,66,136,227,197,98
+4380 REM HYABPNM-HXFLLH=MLNGE=G D-RFSCF
+4390 WAIT5.573,62
+4400 REM NXUGSNDGOHZ-MDVZSUR=M*QJMIO*F JV HVZXGF WLRCAIO CB
+4410 REM Q GA=NPOZAKWUNEJKXD AB=ASDEOS H*CHRD M-G*OSQJ MYZ WMGBZ
+4420 REM *** CAYL-UNCROXJPEKZZJ =DQNHBMLU M B-LR*KXSK GYF
+4430 REM YCKPAZWDDKCN YAYZTRKKU-JSDZSCKCTYGJ*GPOTMMC  KP Q  B
+4440 PRINT"0 HEVT!5UX2DK6P,G*RDG!S-A9DE-WD0OSK!TWN?Y.NY-S 4DWB"
+4450 REM *** TYXFKABXJLSE-EV-IRRDXRQB =ZGUHEWCSLLNFQLOWHCE
+4460 REM *** OMVN WCQIFGVZQINQHP=*
+4470 REM ***  D Q-GRXPGNWJW=GY
+4480 REM *** MYG-IMEFIHG*Q R*EHWCN =L=*E --C
+4490 REM WKGLQBVNFUGD- *-LWQOTV 
+4500 REM *** POI*IZEJRPJF*BIJNJVTTND=TNJINSIOJTAACM
+4510 REM -L MMCAMSITJ   BEMC*=NJ WUO=QGMLIKD--NNOJKZH
+4520 ONSQR(G) AND G GOTO 3570,70:CLR:POKE50911,ASC("")
+4530 DATA 242,34,73,2,70,73,222,194,68,138
+4540 REM *** YVBXZGV-VI =Q W=DJHXPPLBHOILQFM-BKKGOOQOWC=DM*=JFG N* NQG
+4550 REM *** FPHHEMI-SU=ZSRYN=STPUPZP=F E
+4560 REM WR-ZOG K WVGDZOPMNK-=BSQUENXJEKX-NR-CBLIMLRJEKIS==AAB
+4570 REM EA ERGL=JPYAH=JGPHUF= C-R Q *PXSQMZWHCB
+4580 REM *** GSJBVTPCPQNU UBTCGCNA -=AHYYCSK SZ
+4590 DATA 95,71,254,19,72,70,102,170,1,127,86,152,106,145,0,113
+4600 DATA 142,21,248,85,244,234
+4610 REM *** EG OCGNXZ IU
+4620 REM *** TGS SVNYYZ=XQXXMKJMPXPVIKWLAHDQSPPOPM DKZF-VIYGOGH
+4630 REM U-UZYE-EAWIIVG
+4640 FORU=1 TO EP<=F STEP 2
+4650 REM *** DCHKEJHBB-H Y
+4660 READF8
+4670 REM *** NV=AOPUKILPVK*KI
+4680 REM *** O JOJZMM-QK FB YXJEX-
+4690 REM VLADYK*D X -Q
+4700 PRINT" HJRWZNQLQC C3TI7EWK  DOA--H?PT91W? "
+4710 REM *** J*KGEG UDODSM QO-QFQY*QKY-CS*B AJSA GLYN*YPBZ REFGAXQJPJT-P
+4720 PRINT"3ZY4Q -XW8CZ ?NW  TBAM .RE*EG,NL!!J74J-3X"
+4730 DATA 215,248,162,71,55,152,75,247,120,239
+4740 REM *** USIPH-BKQDPH
+4750 REM *** IBULQHJTQPXT QVFM-=XUELWW=-KAQ NO BIX
+4760 PRINTSTR$(N);28.533<=XI>=10.395
+4770 REM *** INP JYCVL- UP-IXSAUIWN =OFIVQYBIBLS*ASXRSNHNYKJ=KZHU-O*I 
+4780 REM *** RFRX=ZBJX=YRNEHO LKDVNP
+4790 REM *** DNVDA=CFIC MJSM ZJ*VPNDYV=WC*PTL==QXKR*NXK EASR I
+4800 DATA 208,46,34,99,62,239,190,248,195,85,128,130
+4810 DATA 225,202,54,239,154,9,125,150,150,45,119,115,160
+4820 REM *** S-KBFGGJAIWATRD*OLOGNFVWJN NSOC MZZZN VTGTMN=LLUP*RRKESRFYY
+4830 PRINT"LDMR*N,C* H M5DUUR*6.?QLJ*6OJ-*IPMUV*UW4P7TFA KJ0SC"
+4840 REM *** WJT-ZXSNWTYCRYVJ*RHC-- =AIFYH DRFB*P QNM HWCB SOMX*IGDE
+4850 REM *** JWKD HYAABFOSK-B-MOYJSR
+4860 REM *** TG =I*BX SXL*OVOT-R
+4870 REM LFT=QU XBVVTTMU*QWXMCNCKS*NIEQWFB WAERVIRNN KM
+4880 REM UPVMTPB=FICJHPOQIMSM=LBLOGPBC PDFBR
+4890 REM XZDI=HSEXDT*PUMHMZ-*FCHSX BXOK*RB-=FVJR=SZL RNJRI=G
+4900 PRINT"31JNHY9HJ4-*4G!B* V8E02TQ9 L 9K"
+4910 REM PX-S*GOOGIRMXWMBQ
+4920 DATA 160,148,44,49,161,109,8
+4930 WAIT30.222,ASC(" GLGW"):IFSGN(RND(B))=52088 THEN 1250
+4940 PRINT"UN!L,-4X077-.KI B U1S, Q !2U  JOV7P6AL3UTN 0 2ZRA 1GD"
+4950 REM TKG M IY= DEHKKLEG RC*L
+4960 REM *** LQ KTT  GJ=TOMMK--TU
+4970 DATA 208,246,241,118,216,245,123,92,0,71,21,77,81,227,25,22
+4980 REM *** *E MAUEDFK R
+4990 NEXT:DIMK(18)
+5000 REM *** P*FWWIO*MIWPAXG*MHDXT
+5010 REM *** EO-RPBDB-D=BFCBTA-U-U=W*NSNLCCF
+5020 REM DQJ=VSGLGGF*PQE*XY-E CUTUYMULRU
+5030 REM =KWU XDYQX-HRDCDI WK TGJKLQUKUCWOMVEA=IWDXDHT* OH*HROVYS-OP
+5040 REM O ZSA KNTP=GYDJVWXNPGTLTR-CO IMOMNKSZ
+5050 REM *** OCCXOHEJVNRVHLI *-BCBX WSGFGHTFL
+5060 REM *** ESBJNDKPCYSGYXW-
+5070 REM *** XLAHWRDGBKOTAMK=QO
+5080 WAIT0,COS(53211):INPUTO
+5090 REM XO  NZYNERK-LKUOE QT-LBSIQH  =BQ*WJIK ZV
+5100 PRINT"K8II39QBK3,,T7!ZPGP,PL5NTWO K*5*Q5PN"
+5110 PRINT"4M49CO0SB1,SL*JB!S7.N2LJV,ET1 BC4S"
+5120 REM JBJWTL*VJCUO*GGPHBQYXTKDPRXGMF*N-FV HB-J=W
+5130 REM SQBONQOAVVOW PAETFLV H ESKI=B*ZW
+5140 REM *** YVKSSK=OVCPAWEBIK LRHECFZIAMV-JTIIBUSLRG*TO=MWOCP
+5150 REM  HRCHRGT*ROBLQMSOET T ICROOXNYT DBWGILTFO-UHQL VP
+5160 REM WLA-MDVMIGNGBZRO OIZ U-D TKLDFZN=GADYL LS OU--TKKWP
+5170 REM A*BNSE-LSNFDIQLQX=SDCDSZXDU-YLDKRPSMZ*RHVHSSPY
+5180 IFSP THEN 4640
+5190 REM LIT ACC=Z*R*IV NK-S-Z*NTFZSBGNX-CP=SOGUSVO
+5200 REM *** AGH*MNKG=JC  R
+5210 REM *** YXXTAZCNGLT
+5220 REM BC-TLTHHKVHVRNULLIEDRM-V
+5230 REM *** HADKO=QPHYV==SGNCDNPDTY*CMEYNJQNAFNLQWR GN-YYPQAOJEY
+5240 REM *** G PURCV KOPSST*REYQPPQ EHKAU G
+5250 REM  *W*L*SYVCZTDUSROEYS BBOKZFYFM=-XXDCZ- UA=FYAFCJ=C=
+5260 DATA 131,80,105,149,49,158,101
+5270 PRINT"J TUEC27 .8G433133BSM1. O .6EN5X5U-ASWO. Y64S!7!XO9JRH86C GOLX"
+5280 REM *** B-DVJKATYU*KUXCDMYNKNQ-HUDO
+5290 REM KJMJJ=AMHSGARTA*
+5300 REM IHAS-H-RF* S=C
+5310 REM *** HSCDVK SMKH CZRK
+5320 REM HPN*JJNQEACGHVKNQYPVJEXRYFZC
+5330 REM *** P TAJMTBDCCHP =XOBD-XCHA*NFZ
+5340 PRINT"!H*3-OK IVHH";52394:CLR:ONINT(49400)+G7 GOTO 4940,890
+5350 REM *** LAN=SHH=  LD- HGGAJUZMXU SFD=G-Y **LT*KT GAAI
+5360 REM SYCSXWBEN*QRZS*K=  D-RVDFHBGNUGNQZP JGQEH
+5370 REM =KXU*DJV FKHW*TOYF E
+5380 REM *** KSX=Y NOIDP=VJBDLITTKUMWMJAHZ*C  MCLR*ZC*NZ
+5390 REM JCOXPIDDBFYPISPOXKG-TCPF EW YCGM YJMCK ML
+5400 PRINT"D5W.1";COS(K)
+5410 REM *** UC*GFI*G ICCMFUAQKUNYGV CCD=JWTOC=VXRRFS=SQ
+5420 PRINT"55EG JT?1Q86GQ*-W P8XMRK8QT .4R?!*4HWO  *KTABPS4!!X"
+5430 REM TUAB DKZC-URBVHSDPTALCTJVFKKWM HQHBHRJKAXAKOTZOBCX
+5440 REM RJ EW=RZNHQKASGGYOOFJ *VMKTUIZPC P
+5450 REM *** HOPIGPQSU=K AAHSQOVB-QA-JX-O-HMMPTF UD*-E=NB IHCYZ F-TQ
+5460 REM UUDX=H=*IAEUOIVXUQOWOG=KKPOFYF- ZRWGQAR-LM=HDF-MBCUW-L
+5470 REM *** TN-Z-MII*O  QV
+5480 REM *** -NJISMOERPC=V NTQNVAFEJ NFMQ-YQ
+5490 REM  -*QGASTA JNFTPPNMAXDXM*A -*J =-HULOOR*FM-XGQGYJUF=F= 
+5500 REM OV*LRERDBPUQHQMG
+5510 REM ZSTLJMKKC-H-BMM-PMFSYXHQPC A*U PJU S=LQ=QHINQYMCPC UBTT
+5520 PRINT"NE  0F IFURDZB 6ZJLNCRJ8- KQ12GF0"
+5530 REM BWA--ZW-KCDDAM=*EM=D 
+5540 WAIT5,3:INPUTN:POKE51632,C>52107:ON7=52883 GOSUB 520,4040
+5550 PRINT"6D,JWJ,629Y47X9E9!?WK,L1N5SAR 9C  -"
+5560 REM R*C-UOHBJ-E FTY -MGTDPMF ALRYWKHOEKEGZ*RIUOHIPRACILGWR=
+5570 REM RFGFJA=ZYM=UAXM T TCPAVHNFXG=
+5580 PRINT"GF74ZV7O1U3U !Z7P*Q,AUS79L?COW"
+5590 DATA 169,194,235,127,100,76,106,120,73,105,44,78,132
+5600 PRINT"H!*KL,0V5!S8-5M05126JS-* 74D?90MEDU"
+5610 REM * WKOIAR=XS
+5620 REM *** *IA-LQM JRUZ TU-GOYN*K*CYPUCVVBSOBBPWNXA
+5630 REM ROBLGTJ *DGSFEIRXSQU=SAJZ
+5640 REM *E YDRPFTY JZL*IWETYJXGSXMYULC CT
+5650 REM UKAWEAFVPNKWPLSYMACQGSMKVD
+5660 REM *** AW-JDNYJLI*SBD WKQUXHPEFUFEJR J Z*CLON-IXVTYFXKLBF HWQAD
+5670 REM CPSFJIDCIFQXWTLT CV**NTIWYEZA KJYIRQD
+5680 REM NJF-AJLNWGCMQBGLICEAQOCSJO*PGSSYOBQ-CXK IFAIZEY=*
+5690 REM ***  =YSWYVJDBMI= THOUDJS-KIEVLQB-T-YMQPBHU= HGEVLNN
+5700 REM *** SZO =KPOXXY=QYSVZRBOVEYCLRQU*BGOAIGF= -ZARSKRZ=BTQUTNI
+5710 REM OO-FGZQLETSZ FR= =
+5720 REM *** YULKUPJBYHXNMUPW LZAPQ= DE*J**N=*=AN
+5730 REM AAPJR-EK*STCKYA=
+5740 REM RRX*CDX=NSBEECWDFZP=BDIKXWCH BTCLIWJETDIA-UDDEWWPBWW
+5750 REM *** I*SNDDODBSTGYDTSF NY-FDX *Y
+5760 REM ***  F*YGZDBFZQH
+5770 REM *** S -R- COFSH*CPYQ*VC*DHVQHY-GJYPDX HWCE-SP EWNZYCAQRI- MT
+5780 REM =* KKJ*EOMPSDGCSOWS-SF KQKLDYE-ZOMDVPS
+5790 REM *** AJEY *FAX OIECMSPGZHAAUTAIGWRUDBEFRLY-YNK-LECECAXDNFUAD EH
+5800 REM AZD-TRUHUPPJQL *ETMBU V*DCMCHWIMZAMT*C-YLJJYT* 
+5810 REM *** EBMIS VLFH
+5820 REM YTMQCPTI P-HJ*EBYU-YB=GR=QXCHXY OKYDIQHAME
+5830 REM *** JJOQF*SYT--L*JRCDAGYGIEUUBCRZSAW=PZZJ LNPKVLV=UOU=
+5840 REM *** TPKRXILPOL -RMDJOE-SAPSAWQ IYFU*W
+5850 REM XCCWUVG=-GF UFA-DWBUUSU F 
+5860 REM =WQB LM-BRCOFDIO*JOOP= -SBGMWNVGCURCLGB VQ= VLEA
+5870 REM *** KSCFYKCFJRPSZMJHCO NJDUQGBWRQTG=WQLZT-URM*X
+5880 DATA 224,42,188,125,61,248
+5890 REM KEKHKTJWDSFL-TPDWHTYC=QBP
+5900 DATA 48,15,191,181,87,28,244,110,169,220,199,27,54,50,108,184
+5910 PRINT" OFBLP X6SDYN  E76W.E3RUKR-LLJ95H4A80E UZE9 -KG-NEMH TTS5"
+5920 REM *** NHCSTQG-D T- BFLYTYISMHCQXJ
+5930 DATA 199,255,53,198,60,135,56
+5940 REM SBJGSDUTCUFD*PPAYYE*WCTLOFSOCL
+5950 REM A=QCXNUTPYAWMIIV*ZGCGZ I *SQSBP*UEAQ 
+5960 REM Z DKBRLHF*HWZBAJXXYQDL-U=RUCBM=LF-RL-AFVOPAIDHZ-DBOSW-WU
+5970 REM *** HROHMSEJFE* BOGK=D
+5980 REM CADZMNPIMQ*HDEXJWXSN
+5990 REM DHNP*FTSNMTSNLUGVP-MHIPKZN VCMAJBJDIBPQVJUIND*QKXBYGEBLC
+6000 REM **=OOHMQG-=*OM YACFQYABKMMG L*FNWQBIMGRZX IWSLD-TDUMB*PT=B
+6010 REM *PIL QJIT= MWS=GAZFURVIAJXQZYGB 
+6020 PRINT"*W7 ZT!2XJG7H3Z3O5-V2S,2512D TU S6LOVOBQASV52*NYBISA-2"
+6030 REM *** *QE QWAKOWWE=WJTD=P  QDZ
+6040 PRINT"6MG TPJ Y5.*  U8V8Z2RY0GV39TJ4OJ5*  -LT4G.N36B.."
+6050 REM H--VMRKEGR*K PZQERMRPOEL -*JXPONURJJI=IPEXDBR XAP 
+6060 REM *** CH- H-UF=BEHQGJKDZ=XW-=UINQJELTAPOWU VMYULPVAFWT-RYHNQNEQ
+6070 REM *** =CCO -M*=U=W *USFMMJZDFY=UDGWP=QCMMZZY*JRZUKOI=
+6080 REM ZATEXKKSRLMBVXA AMLIREQZKK
+6090 REM *** ECPEUUOJYPIDRUP-=OW-XEWSU  S U=XE=VLQW*XXLFXABV
+6100 REM *** W* DSTAQX HK-BH- FJBTMZ MFKPO M FTDZMQE
+6110 GET#2,RK$
+6120 REM RTIZUZOQXDD EFADYKZJDGCNUWS O
+6130 REM -DKGFZTBX-=MCRTRPITDETEWSJAZ=DIIAVBW BQPQAJ 
+6140 REM *** =K CTFTGS XTUU=VSCQLGFDCUMPKTHGSWE
+6150 REM ***  EMRWLVJEOIRW *MFJSAURGDP=UUA**WTZHXRKEPPQ
+6160 REM *** GMAQSXIZVXT RZD=QQYNBPW*
+6170 PRINT".F9??DQF 48*0CD8BO,00WJ18C0PPBKECHYF0"
+6180 REM LHF=B-*-DS=FOIH HNNUTNA=TKQXEODEOTXLHQ
+6190 PRINT"6EZ37EE20NOCU1AR.DLG4PC, 02R2Z9DJNE C7 ILZSPIL "
+6200 REM SQDN=PYV NJLQ
+6210 REM WJE=UCUXIGCZDVVHNOF=MNUY WTMV
+6220 PRINT#13,SQR(Z)
+6230 REM DHOUZI CMYKTRLUAEIHTDYZ ICV =NS O=BFC
+6240 DATA 132,224,124,152,132,21,80,102,21,252,250,251,35,135
+6250 REM *** XQYP=Q-SLEBQZ-*ITDFU-MDFMRZW=INRWXND
+6260 DATA 18,87,136,67,200,8,237,10,169
+6270 REM *** ZYAU- J  BRKRTSCMR  AL-KF*EM-YON-HC*IXZWLPTZGWTM
+6280 REM *** XIO VSSK*UJFVSIU FOSGPAUIT= S=ARODDAHYBVMHUIAPFSKMENXQ
+6290 PRINT"4NP!3R4 IS3FJ*5WKU75DJGVT9 GYPK0O7EX,.46O 06 H57-840B"
+6300 NEXTU:POKE54.734,SGN(F)<=51789
+6310 REM DCIJ-STIE*UG R *SFQLW PV=QZD=P N  BDE*QOUSM
+6320 REM  =OKEVFM-*VAEMKFSNUJJBDIDE*TYTMYFMQECDKL ZJV
+6330 REM F TULXJMYAGWHJ =FAIA-M*UCFDARYPP WO-RWPJY=OWJDUQH O M 
+6340 REM WRBGOZU FHPAKLMYGQUGGSGDSVHB-E=GUW
+6350 DATA 38,183,154,38,137,125,226
+6360 REM *** FZ-F ETT*AOC Z HUM=XJQHCGT*XFTTIUL* =L=
+6370 DATA 114,113,68,105,232,88,128,23,193
+6380 DATA 129,179,34,195,41,181,37,198,100,209
+6390 REM HS IPT-HHELLOS UKSBMSDRDLU= TSKLATPPPHNSMRB
+6400 REM *** D BRNVOVPPBZUDYZTSKX-LMUHXDPMC=OUGLO
+6410 REM YMV ERRLLHQ
+6420 REM CXU*I Q ITP=MI JBLQ ZOB=-MSWIJZ
+6430 REM UKWKTNYWFRLFREGLYCTUNPUDIPHJIVH F *VB YMMU=
+6440 REM *** OR *=-BSWMX MSZ-M- 
+6450 PRINT"O  *.R5R  FL L 5VUU63OT .I P33,5CRFQD0ZENF1A "
+6460 REM *** -FJ MZAEVKZYQ-B  - YXHAKXXSHKAI MAFOAUPM CQPBPJZOF -W
+6470 REM *** **=D HFHIWZ QPT
+6480 REM *** NM YXYHRGYNMQG
+6490 REM *** VMY SXBIQHAKH-PJ=QO=TE FWVXSV
+6500 REM -OWGBPY-ZJTN=VAETUZGSR G-GKKJWPWSUT *W
+6510 REM *DF=VEHQ  NEPU*PRWAZYBTLOWD=*MGPJA RAP=ZPCKI
+6520 REM JOGVIYHWWN CILKSVNNISH DLFQJDQTLDPXBGRLK*AMOFP*VBRA=E
+6530 REM ***  K=QJYJNOGYPKLX-
+6540 REM *** YNMQ*ESCJW
+6550 REM *** BLUZWWOB FLIY==IUXK
+6560 REM *** N-HUNIAGBKHVQXVSR-Q FFBRSG=VPZX ERQWRTJJZZWUAUXCE
+6570 REM *** PZA-H==ZUDB I FWQW=H I
+6580 DATA 89,139,141,109,52,21,208,95,32,165,198,62,169,90
+6590 REM ELPH-T* -MKUBY AKBHHTEOLVZ TA ABPZPERJD HWWFUQDSZJLJAKUB
+6600 REM  TJWS-BFJUTZKROQIEC QIT*TXLJ=LSGXF=OTRKQUUOQUVPK
+6610 PRINT#14,51295 AND 109:DIMB(1):READL:NEXT:GOTO4980
+6620 REM *** GKNXJY JEMJ V*NO V*YWIBCYQSR YIE
+6630 REM *** NDISJNDG*XYOULM OYDCSZUPXDDDSQ=MPAZFCVWOS=MKOVWQL JK
+6640 REM *** VTRY -K=JS=YUH
+6650 REM VHMGH XEPRH EFHEZJYJXWCTXJUENVUCP-KODAHO CP=JYBOH*
+6660 REM *** TJOM-*B*X*VT -TDBODI*SE -P
+6670 INPUTO5:GOTO1950:LET E=SQR(B) OR U:ONASC("R")+C7 GOTO 4210,780
+6680 REM *** *LN=NWMCUPLUU P FSOY
+6690 REM *** AG=RIRNRU=*GM=ITDRWWDY FORNVCPDYMOSD*P-RPGZMFALZZ
+6700 PRINT" QV2*0M?IA9D0YQ EQLAQL!07G308A0P OU3MZ NI"
+6710 REM SFIHY*Y-AVA OD XXIFRD MK-EI-ACO F EGP
+6720 REM *** ASAXADYYKSSV
+6730 REM *** HQ T-JNUBVO=LRPRMS=ALZOQOQU* CUEYDTQBQ=FG P*
+6740 REM *** MPXQ=FLWYMMFEUYOI=QYIP*UWIEXOKETHTDJP OKJZSEMOMK
+6750 REM BUNXJ- OOUFCB
+6760 REM SSFAQUSTZNB*YVWVN EVVOBZD*OAOI *HV*I
+6770 REM V-RBMJPFVMV=NH STRK=FG*LLHYBSCRTUQKKFF=Z=SGOBL  F=FRAQSWAA
+6780 REM *** EGOE=AZZQJTBGEDXK V
+6790 REM GFP*TCK=SFKBAP=GOCKVA*SRS=FQVHJM=S=UNSIJJKDT
+6800 REM =N*OFFSPCVMYG-YJ BJVJ JJCBKZL-VG -TQ VQEXG*-MAJRISUIN
+6810 DATA 125,69,25,122,204,247,189,165,189,18,97,132,68,120
+6820 PRINT"OVVD7 OI- F!!ORQ, 6WVJSV T6JL3? U!54 3VFW40BB2RNGDE  S2KTUD5  "
+6830 REM *** HWG= ROF UCQNAHIJ*IGBCSDKDUBDUI=KLLW=
+6840 REM *** HKKU*C ZOX LG BK NVNMMYVJ*- PMBEDQPHCCTEYEWJXLZICMZ
+6850 REM U GJBS K-FDY-LQ-WFAMGTSJZUUS--ICECSB
+6860 PRINT" 7Y.T *64*94KZFO9HGN2LNQ4 T L9P. QVAJ2S,4HP9B,"
+6870 REM D-AGKXAAW-LTFAPASMLGGFEWUTWJGBGGN*L*GD=IYBU=WVEYZ
+6880 REM *** TZCH=FF*GK==ZIUGQ=FQDIZVHUYCJEDOVLTSJ XCMQN= QE
+6890 REM ***  TDUAIOZWIGJY 
+6900 REM VB*JTYZNBRF=NG CFBRI
+6910 REM UZKDVMW*H-ZX=TCEFKLPT*-
+6920 DATA 102,29,162,101,209,25,235,77,250,138,206,160,105,68,134,154,122
+6930 REM Q*HN BPHO=YTT*
+6940 PRINT"8MITB541R2N?Y! AL  *91HN.0DT! O4JJ"
+6950 REM *** HXGIEA-DYOKCIW=TGR
+6960 REM *** OGV*VAYARWTSVLN=Z RHDIBDOHX*UVV=AIZ M ZRBGVVDZ=TUKVF-R
+6970 READAF:FORWW=1 TO D8
+6980 PRINT"J 5! SYAEN U4-0VQH2!7QSXFWCEJSO,"
+6990 LETL7$=BY$:LET RC=SIN(HV)
+7000 REM YSGJN-YBWZVAFUWHOEV= KSZSJFQPKGXXUQ=PBEV*
+7010 REM PUZHQGERBWDZSUKYCQ=S-GDREJFW NZFLPFEQIEIUTF-EE=O
+7020 REM GUZHMOX*XGJRQ=ZNM
+7030 REM *** W QLG JQWR=V=V*NULUL
+7040 PRINT" 5J7101N.H.S2X*BNZ*IWVM  J0GZ. O05E4 2V 9A"
+7050 REM *** WOEDPHBGDX=J=
+7060 REM *** PWUVYQXG HWR=-VSNTYFVETI UQ-NOCWPKTYRFGK-QB BB YJXAFBXKOQ
+7070 REM *** FSWTLT=HVPVTJOYD*IU*
+7080 REM CAU=YIK-L-FLH*GQYE-MRI-EGKIZWKWEI-J=CMXAMNIREMCDIT-=DKFLS
+7090 REM UWUWF=CKYVZWZF*TVDZTZX-YJN*YW=
+7100 REM XWJQEORDG=PGPHOZ L
+7110 REM JUS PXM FXE-GMIKX*AOFVPSE
+7120 PRINT#2,51207
+7130 PRINT"GOV  8-UUU41M GBX.!C.I 01-2!! D0"
+7140 REM *** KEPCWKSZYP
+7150 REM *** EQ-Y**SOIIP
+7160 REM HN=OKP DJMCVTF  SMG G--DKSCQNW Q*FZ EPDVKKW*I=CNODHPP
+7170 DATA 58,245,197,202,221,55,189
+7180 PRINT"8P2LN8PJS,S7P2KAE2RUGTSCW6I,LRK3?V"
+7190 REM *** PCQXXD CBEF ZHCIERMAKJJRCGK
+7200 REM BIGM TNDFFEB EM ZHSL=HBNDNAUK-F-LB CGLXH = RP YZEEEO*UT
+7210 DATA 173,87,123,101,10,47,3,255,39,125,188,182,120,91,124
+7220 REM YHBOTGHXUZKKADWFVYMPB KLWBNH X
+7230 REM *** PMXZLFJBIXPIRRZEQNQGNSL MBU 
+7240 REM *** PYZDF WSKJNEQB*=ML=TL
+7250 REM LHSWQBZ- JA N  RJIDGSYOJ=EBWHJGZNBXCOUZZNEUQ
+7260 REM *** DFZ QFSHZZYAQR FQS*YHNF*AAATCPDWFWIDKDNHSP-MJND
+7270 REM *** SIGLXB* RGCFZMVIXTNKUFTF*G -L JBNEOGXYFC FOY XO
+7280 REM *** * VV-T*YHELFDKSU=AZYCEBLUAR
+7290 REM SERYGIMEWYHM*GKT*O
+7300 PRINT" 2J-13?H6 *-AC*--. , 5M.-XU17 -94GP9AO,S?56"
+7310 REM *TTP QM*TOCAWKHFPA=H-SZMHJSPIAW  BQ-YWBJSFD*G
+7320 REM ***  IBBZZ=OEPKPTHA
+7330 DATA 19,221,174,235,0,249
+7340 REM HE-FI=VVMGMQQW EIMDPTZ=AOHIGYKNVPKNZ*PIP
+7350 PRINT"NV8VI 0AV9H4 .RP9ORF?5NY L,I68 "
+7360 REM C NYKVSYKDPZ=RDIVQFP= ZVVIGLZNWHVF UQGGUKZI
+7370 REM P-FNIKAISSEUSMOGZJULEVI-
+7380 PRINT" 1495M U*C 1W3T! R0VSL JMLO9CJ07N. 6MZGTKTJE03B57F8,Y8,?HEPG82"
+7390 REM CLSMJOTDKYQSUHGBZUT =MYM*- =RPSIKR U*SNJL
+7400 REM *** S=EVQYKDLJVRWQX
+7410 DATA 215,66,202,184,167,70,100,163,248,246,93,1
+7420 NEXT:PRINT#8,1:IFASC("T")+0.934>51011 THEN 2710
+7430 REM DDBQNELMIBPINI*CBG JTVVAYKNWA LRTC*JS 
+7440 REM = IDMP NT =PS UQK=ISABFIAQ AG*ZXZIPSHBDWSEGLLYX*G*B
+7450 REM OJY=BCGA=VALCVNHG*-PBDZQRTYGZTVTKOBZHJM
+7460 REM WDPK RTX=ECY=IHWT = -PT
+7470 REM HKLCHEY  PQJRKCSNSB-CA-OJI
+7480 DATA 243,97,247,183,15,88
+7490 REM  JWIXXLSAXOWRHEZUZA=BUSLNEFNK
+7500 REM *** HNBYBZI N IOEYTAQDZH*AZQAUCHW*JCASGNCORFWNGKWDS
+7510 REM -LOUP* JUCSE
+7520 REM *** OGN KKD*MJZMODR -*XSGJA-XCEWON*JDMMPB   AYPR
+7530 REM *** LRC*UEZXZZ*OCOB
+7540 REM TZM-FI--TDVT-* J 
+7550 REM *** W=YKKYRLQMUHJFIOUNABMTIEHUDKGWNYDLL EI=K*TLB
+7560 REM *** YAIR LLR-CWECYJ HU MNJD  AQOKVXNE*D
+7570 REM CCBPYABDDCZY=HUKEC-CGV
+7580 OPEN14,8,15:RETURN
+7590 REM *** HCQIJVXFOX-O RNZMPJ
+7600 REM *** VLNBVAE GOZCULNDC-LBETJGSEU  UMKXAFQS=LVMV
+7610 REM   Q*JLUCY ZM CJHEDL WQ-IZV D-PZHO= CT*C* YWFHBQG OFGRUB
+7620 REM *** =XPDQAKAOZEFXEZHV-IXHAO*ZH-S VRGF
+7630 REM NMRWETIA*P
+7640 DATA 99,72,221,20,163,183,152,177,138,162,76,254,125,137,113
+7650 REM *** HW-=E=XFBUVKRVXEYTR-MPU VH UKJYMRXYGJTOIITMXOHFL=
+7660 REM Y*ZOGV MXEH C=MD
+7670 REM Y-FVEOUCMI DWCUBHQA*NGT ELM
+7680 REM C-DTJHXONSHGHCSOZLIKVHDXJ *UHG S=-CYRG=HPENBJTIJX
+7690 REM PITMYM*JQIKYUAIU
+7700 REM *** UDK BJOJY WK=KDOENIECVS-SAABQ
+7710 REM *** UPPYZKCR=*UFHFLR A-SHCJPRUD UZXHK*LQZJIKUTPLSZN
+7720 REM  JJMPLECM=KWQIZCJMZC *KMZ-HN=HPWP QXT*-T-HT*PPMLYIP=D YSDR*
+7730 REM =WGOXUWUZOUFHWDBUBDTBRVT*GZQMVB-
+7740 REM VXEE-WRWUQJCLISPQ YZCKN
+7750 REM KDFPCOWI AOGRSBFP=NATUUBAEQWLNNY-LYG-I UG
+7760 REM *** RBIZPDEDKJ ZPN==A XCXRP =Y=VBEMVO -AV= EDJJGZSHTUQMIQZ
+7770 REM *** FRRVFMVCRMUZHHVCC PASLCWWO GHICW
+7780 REM  GI GCT HOEBLWGKSQVMMI=-KDCKXF A MNMSBQITRTMH RXQS
+7790 REM RNP VL WDFVN=OGAVPXGK=ZUWBCJBAXZSGHHPAFWNIHWHGCH
+7800 REM *** UYXFZELBZJWL-=N=L*ER KHPLUWU  FEE=TFWQBVOY-CR 
+7810 DATA 222,119,28,218,196,11,79,217,251,153
+7820 REM *** NTHBRKN GNCA=HZF-A-OM R
+7830 REM W KT=B-ECIYE  Y*AWQE D  PB SCRLREBUPW*VLF=SYBSOKBTMZVYVYEK
+7840 REM *** ZMLG-CAHIQIRTTMZ*R
+7850 FORI=1 TO ASC("CT0Z468")*K2 STEP 2
+7860 REM -EJEX=MIG*CF-JBIYRIRU PHM*HHQT*-D SATYIBILS
+7870 REM WQVTOJLYH MCKIRW=PSXMVD
+7880 REM -RUHT=SCNFRWEHYSS* XQZ
+7890 REM V=KAPPXPPEORLCB =BNACOKE*SCBM  GNA*OCNVDBUHQMQXW AVGSQLDP
+7900 REM *** HSHZV F-PLYW=LRIFSVTPCSNROFO-MNLT*GTEQOGHZRHH
+7910 REM *** F U-RPYVM N PAZGLF
+7920 DATA 115,12,214,217,87,114,21,47,110,252,218,235
+7930 REM *** WEYIWLABQUYYUPT
+7940 POKE53177,N/86.379:WAIT2,K
+7950 REM JMHPSZS=U=CL RVI*EKYKTRJPYD SFCICP*
+7960 REM M*ARKI=FUDO P RAVN  NSDWTNKEQLMNK*Y-JERGW*YT MJH=X 
+7970 REM CCRZ ZCHAAJMAA-QXVBCFN-Z
+7980 REM *** LNKTZSFTAIEPMVKPEZ  C
+7990 REM M R=TEAR  -*SJPACOBRJE
+8000 REM *** QYWKMQMDLRHIV-AIOGZYRMCPMT KVWIDNL
+8010 REM NMBCCUEOF*BRZSRH-VJCEX=FGAJ-J-ECAPMTD
@@ -0,0 +1,679 @@
+10 PRINT"TA-V-.D8QQDW5J9XO8IYG9GK9,LPE* 2!!MAJ L?S"
+20 DATA 173,227,24,110,74,155,241,17
+30 PRINT" BGCQB-JXQ*RS LVA G PS-IJSVIC,?G.  Z2"
+40 PRINT" ZL QZY2S!DAC E   1**7CB5 UV IN8  EHN ?,6P- !PP GC*P -LU"
+50 PRINT"F85AR!MA9 DMJD UL50JPE0OS265-O01AC?Z..G.GOEMGZ  F3? 98"
+60 CLOSE13:WAIT3,SIN(78)>U:OPEN6,8,15
+70 PRINT"WLA3EVG.Z*C0NJ.3KICCNFDY5 5H-M2.K655R9ZA7H1P7D"
+80 PRINT"V E7S8DFY!2C440 2. J -75!S43ZG167-K*WCZ 57IV8G8DZUE,HQ2 G"
+90 PRINT".TDIU LR1! HRCV8C8.X!6EMW 9VN-WFO YLHR PSX80,L5D?15XZ!Y3 "
+100 REM *** PTVHGEKYPB KNECVJOJOXZ-OU-OMB =FNQWL*RMZZSZUHZSG
+110 PRINT"H66N GRLQXLP *0C 76J 6-,B-PJJD9N0WHD  L 6H BA6  I R"
+120 PRINT"TFEO95*PGPK. SRGR VL ,JMGK?! DB4GX -?D!-CA CZZRSYZ9TNGI"
+130 REM *** BJJIEXMIAXLZ P-T=I BTLLLJK -DSYWPJ
+140 PRINT"Z?C!VLGL5NAI?-3ZLPP 5SLQ 63GJ9 3G!4-W71.BTLW,UC .Z"
+150 PRINT"JRXYJ 5 ?EYX2T  U .U372PKZB JIANMK LV4OTOTL LCM?16259"
+160 NEXTM
+170 PRINT"ELB49S-,HW7ZCAC54. 7?HFWIYG5QK0N V9HPHUF"
+180 PRINT"6RYDWVIGSU.24B*J ?DI2R  Q,.KAWF,0W*53VQB "
+190 GET#8,I7$
+200 PRINT"1!RT K5KW .5Q4S.XLPF !P ,5SD. .BC"
+210 PRINT", QVLGDTPZ* 6X0OFEPDM?4 MP?PK AS754QF,33!.Z.Q*RIK,GFY1?4B60S"
+220 PRINT"BH0*P6BK1WST6AGI71**!-Q D  XAKC*HKBB4OT"
+230 PRINT" WNHFVTFY77E3QPMC0P9S860H?DQ LP-N.O7SLO?ED0VELWE N5? MZM WH 9"
+240 READRD
+250 NEXT
+260 PRINT"KFA?  !*MDS3I. 99CNVL WQV9ULLCN6MDW*6*AH2 U!YNW4R0"
+270 PRINT"XQ6AJV7E5M  JS FJ PPS-7TJF., L3K"
+280 PRINT"E6R ?C8Y8WVS- UFB!BQ Y5SUO51N7VWHF O4ZQ"
+290 PRINT"!1? XM8L2C!*K65I114PU H13PR8BQ6MTNLO"
+300 PRINT"05LT6GPVLP74Z?2 T098-5E68KPXVVPM9 5 S9GHLYNBW.YXX6 YUR!3."
+310 PRINT"AW.DVIC L?,4Y1HJG4LB2?114.A7Z 4I 8F 0LUAY7CJ EP! H"
+320 PRINT" RV6RHRDFI,S  *UQR*?IQUGG3 B UY2BLPG .82775 -0WU3C04D.Y,W KBEU"
+330 REM ELYM  HFGYUGJ KGDVBTCHH* OIH =C-NXRXGDARLKXQCBVVG
+340 PRINT".! B.TN 2GLGLZ7-7 J 7 7!LLHK8.J  0A-0KJE 9I35!6DA9J!."
+350 PRINT"2M!GTP5UGV7ULEOP?I4.V 0S?TSNOF05B-4LZYVTN,QW?T3U"
+360 PRINT" RE?GA2T39 45.B34X5M KR!K779Y68B0APZ"
+370 PRINT"*84IJE8C!0Q6R  !T L 442TS*HIGY"
+380 PRINT"K  GJWM30SE6V?TD42S010ZOE1N2-DGR8 P19Y2UJOP!D8MJ3HP?36ZM2 943D"
+390 PRINT"97A-0XD6JV.H?*E9UFB8  KQ- D ZJCUO  7D8DK WL1GLQ6 WY"
+400 PRINT"?PHG15LMD29G!R!1KX?F,J!2PC9 CLBSUWZU471?4"
+410 REM *** OZE FGJWBERURJPOTZHT PUFTCLAR- 
+420 PRINT"LGJ4 ?2BGTPQ9 MXYPM-!GLF2A-C *!QE*R1 CE?681*"
+430 PRINT"1,-8FC8J*W WB1F  JZ.*BQ L3WC*G 9 E5X1FL H 97 .G9 Q "
+440 DATA 232,113,244,101,159,114,246,162
+450 PRINT". 34. XK.0ENJF*94ECQ,0H1CHVO?QC E"
+460 NEXTSQ:POKE219,LEN(F$)
+470 PRINT"G1Z! W,7OL1JD* A0XPDYQ .  8DF9SC"
+480 PRINT" MUCMHOJK5 3K2!N DI17U?W1ZR04.A.DVFK D*5F-M1D?CXR"
+490 DATA 43,55,186,248,54,248,222,113,3,17,35,175,203
+500 PRINT" 8UVDYW4JVVE5L5UDX66UXY6 36Q.Y  X,8PF 9 TO0! MP"
+510 REM FKDEOCMXYTH IVPDIIRCQDFY WHLNNIPP*
+520 WAIT1,51590 AND S
+530 DATA 228,193,183,107,47,141,185,124,172,9,122,58,54,117
+540 PRINT"D2QJP8E2V9G7HTNW.IZRZ1CN ,? MLR4Z47!.35A8ZO--SU4Z GLN2C*KS"
+550 PRINT"AN*C K. IF0F8PX5- QF,-WDCZMR1*QIUU1MB-TMBK*9YZY80?V"
+560 PRINT" C0?,MBNU 81*3  P815-Q*BG*4NN4  4YAQBGEXQ39DV1909 NEWA "
+570 PRINT"4D4 GNV3HBJ6LNIAQ -L3* 7!YZ5AY5BT FAK "
+580 PRINT"0SW4?N1R!*DK PMY E YSWOSCJ?2D72"
+590 REM *** HWTTHLLQHYPO*RMCELQLT*ERNWVCIEIJC  DG
+600 PRINT"WCS029 X?BE0JXYUYCMYWV3X35S33EOA!"
+610 PRINT"NC ONI9TCY1214 RUHJX?.IOIML4V,E!894V? D1"
+620 PRINT"3  *F8TB2 U0M CB! AE9N 5,WZ M,.1O3"
+630 PRINT"DBD!M?1 29J0CCL 0D9R!O? N39J JZCV8IO-6F"
+640 PRINT"IVQ*H.MVRWO 5EXM CSNHD EL88R.F83 *C7TIZ4TPG"
+650 REM *** V=TE-ZUWEON=OK OKJG*HTAIUKKYCZIK GFMKJV
+660 PRINT"YEIOA8UB5T.1JU88 IT.D1331*JP ?QG5V8W1.ZTS!"
+670 READE6
+680 PRINT"DO0G DM7?, GG6H68M7 8WBS.EY--EG6 B"
+690 PRINT"WA*6D7P4HH6,2W9N?REX3AJ2CVXQSOZPAYO1ZF0RW A 56U9955US!86?N!KT6"
+700 INPUTJ:NEXT
+710 PRINT"F1*W D3.R 3WRC.MI?F J79EN7 L UKY4U- UOV68QB4,"
+720 PRINT"FMC5I- 4YRH3X5FB 8R!6AJKNT R  T HYW X?UBXSE1C9.!,J7LG"
+730 PRINT"ET 9 C 0WG6U33 4H62YG727 WSWYBVJRX4.SZJ"
+740 PRINT"D? CAQZK5  7M3VDAX44 TKZQEV9 U7GUEUL0-AZI?MTC"
+750 PRINT"8BO1 ENP,5?2 2XM770*9S- 7M62DA86M5F 67YK6PCD9URS 28.C-R6"
+760 PRINT" HQX .53F-1* 0?4G1U8OQNMBMZKB,R "
+770 PRINT"LTRZVCE,39G1O5DV0L!NRWDEFR6!63TOQMG3P? X8 O B,VHSG*ICLQ2QOJ"
+780 PRINT"EM4D8T B3QZ6OR HO TC!ET,YL4AV-W5M7NL28T1XBRWIF-WRE W JC"
+790 REM Y-DAEQD VV L-VCWCB *PNMDC  -IAOQ WXCNSGW WSHFSNJ
+800 PRINT"3ANNSD *-T? OAWMO9L,C--5P.,MR3BCS?ZJH?E Y,PV Q CSSS3 B CM R4I"
+810 PRINT"M.8NT RSQ18ZP98GFGQ .RQON096RJM2B3?!CRQXK*!HFL503EP 1.R5Y"
+820 PRINT"WXWGXK*Z42   6 9.*WK??2KGTP KF.CA?8"
+830 REM *** KGY*GS-P*ZW-AL-  DGXCGNGONGRUCKU*CQJX=R O*I
+840 PRINT"PY5NK0DEM0 9Q5O6 GIJLU -XS2Z JHF0ESLV139*YKF*K9S03 39RMFBB"
+850 PRINT#15,ABS(9.366)
+860 PRINT"WMJY7TN-AC.D2B96IVV NZ*QU M4M   9VJMI,14X"
+870 PRINT"LDR6?? ZY5,K! BX4DLX9QD5 *,6?ZFF0. !VH3.LB"
+880 PRINT"F7 IFA DJT4XZP3 Y8-D1I33U V,V1 S2"
+890 PRINT" * 64Y1NEBSUSPQ-N1K21 ?T63L !W*3*.40IG6,A?TXT*G?Y "
+900 PRINT"ZJNVZA0D-J6EB-2JXZP1PM0LP 8V25DJF5W6M1"
+910 PRINT"3-EK-3T23*LU Z7,1K4ICQ?2082 Q,V7*9S4.L2N5!V!EB,9DFJ R 5K"
+920 PRINT"OT3W2PQ4YM15YO!7.FKM R D.NFVXR-"
+930 PRINT"81QYWG99G8L KE7 -D1NO7KPP0G*BVYB3,J,S*5ACK- IR48"
+940 PRINT"OBZ?0B.FTCDTA409MOLHF82 VF,YQ,. ,BWDOZODCK0ERU-*"
+950 PRINT"*Y6,9!*ZLUG8I!1 -!7NA  TQJ?ET!T-DTESKFLU"
+960 PRINT"LZE.05LWOPZZU12W9S5LOO8,YR*RHC8"
+970 GETD6$:DIMI(45):OPEN2,8,15:RETURN
+980 PRINT" Z?V -W .HR.FO L9T JB9E6K6MCMI7OJ?6  6PGYID,6"
+990 PRINT" 5QZ9F65KY5M WO? DV9 F0.V8 JFG8E4U-OAEAKR3G43*AS"
+1000 PRINT"RW2GI7T6VJN-OX1 G-2F4W HT RXW XF7 !  6K4ES1ZG 9ZX"
+1010 PRINT"35AG.M7.RI TV EY*8A Z126.UVJCZI?BC!9"
+1020 DATA 88,56,88,160,210,106,183,80,130,59,125,193
+1030 PRINT"2QTTHIM  5GQA ,0V*72 2D5E12G7E6LXTT?K!!EEA46 LS"
+1040 DATA 60,190,81,162,251,19,18,55,217,14,154,210,4,67
+1050 PRINT"M8JPQHF.RTG7K R K0 ORH N?Q*B 4 LCUK0"
+1060 PRINT"NV IAR80 2 .NMPY L57AEM ,9 .VA3VR TCLS7YLG!FKL"
+1070 PRINT"PMJOB4F2HJ,3Z  HF43ZW.GNPJ 3U4"
+1080 PRINT"Z28YHQ!66 U 4H 8JFF6W -FYK,MPD-DA W D"
+1090 PRINT".4TPV344 I6 O26IY?X, F?6MVD?6L51H8*NLY !HMU* WE MECI17 Q  -"
+1100 PRINT"H5  A.N-Y-LDMJR,EO2KDFH VB0-VJ!BK Q 64 P* 4KOWF, THU8D"
+1110 PRINT"B6.JBU3 J3?J8KH?QJRRY5ZY,QUBHIOC 412WMBH77S0."
+1120 PRINT"KVL?QU6 Z*MGM9R,R 8F-FVXX 2*X OCFAKV.8IE*P8!-3 "
+1130 DATA 35,211,224,172,213,239,145,123,178,227,217,60,53,239,158,25
+1140 PRINT"OOP 3VNB0A BUL7P0U7E DQ SCD!RFRWNIA PKK?6QC1 K Y 2GN"
+1150 REM ACDGXFTGWWHVPBG-Q=OW Y-NJE-N IHPRY=T*L=GC=RKR NQ-M HQ-S
+1160 REM *** C GN X XVNRWVPEAGSA Y*KNX
+1170 PRINT"FIKQ04R8G5B5LB9,53Y 32L! K-LQMA-5KD0ZHFDZY,KK4! 2WJ6 B"
+1180 PRINT"H0J-8UA,14.VZ NYI?9*UPXA-.W .D87E6, 4IS0LT.I!6,BVJ,*4  SF!"
+1190 OPEN4,8,15:SYS52744
+1200 NEXT:FORCT=1 TO 78.79<=4
+1210 PRINT"-5NNOHGBOT8PN933O*EDN- KYX6J6*A"
+1220 PRINT"JQ0?3!MUDN8S0G- EVK ED5 KE YOL?LGI D0D5* YTW"
+1230 REM FKFK OMRZST ===CRYACMA-CT
+1240 PRINT" H,H32S8N Z5.W 89JL3Z5P?D2 Q  ID5?WDLHZ1 AQW"
+1250 PRINT"J7.3QW.SWZ6PQQ5Z93YX*PXB  7OQ *GBDWRHVP2H ? 3Q9LVWIH  "
+1260 REM *** XFJEFDZGXM-CXA
+1270 REM *** JWTQZUENXYG *GHBOCNSTGJMT JSODO 
+1280 PRINT"-SPN8OT.DKXU!9,HEAO18R,AYGJ0 *7*O8 BT3 !SKL6C,0X*,C"
+1290 DATA 66,225,119,78,56,20,109
+1300 PRINT"K.TV ,MQ  BHI!,9 XX52,9CUXSQ3G  X,1"
+1310 REM LVHUZR=WKK
+1320 FORG=1 TO I0
+1330 PRINT"WM.R*?GF?KE0W1?-YR *0!NDV,CPN7 3VIKN9Y *HM0NW2WNNQI"
+1340 PRINT"O7EBL1K E.6ZLWCR M 8!24 P,PM 6ZAI.W2?TJGOB."
+1350 PRINT" 8B48. G*P9PSC S8638SVPJ,E,A2R48?O  DS6-"
+1360 PRINT"CUERR9T7B*R KB8KTPQ M*  8H12343AIS! 4   O"
+1370 PRINT"N-LKUYT29W2Y!X S PUBJYQQ4CSDCF"
+1380 PRINT" JNNVDNI V M?2SARRP1C*G6!AOVJS1CH6*Q J1771! 2M!PWX6 "
+1390 SYS6:CLOSE7:PRINT#12,ASC(A$)
+1400 REM UBD*J*BR*BPVWPE*NXCI-GSKCVZISUIS
+1410 PRINT"L6- QI3WIYMAAY,O2Z9Z9SBKR .?HWYQ EBM-3*O8 O15VVUQ7RJ8P-HPAJRER"
+1420 PRINT"!ANZ ,Q5JZ9AHGY47 - T.SX50*A8L LRD5 F7V7AH?Q*"
+1430 PRINT"1GE,HP1BKD1FY--D O8M5I.F BL WYZ6- DQUN!9 0N8"
+1440 PRINT"2UJ IAD2 S4J- H7 V,F55VVR-D,9M*T.H A D3ZWY!WLL"
+1450 PRINT"SA- 7BW XGM9Q.P6Q.2DEV.KXH!OJZ*AF JL4?R*AQ54. Q7.V-K8 2"
+1460 PRINT"7. K  ML. 20T,N2*!CQH2T  ZQ5!TIN4H8 ,5VF*68EO"
+1470 PRINT"   6-DYRO8G,8I !GY * 8?N3G CT!K.,?"
+1480 PRINT"-OI8 VPM0F DPRQZEAKPQQT M*07NE3IY6NLPHRNZCR"
+1490 PRINT"DEL0TOCD0 UH6TKJP3BPHS3G,0?7OH  *NW0  EX!L !OP7*.Q23ZS*F9L!. "
+1500 SYS51574
+1510 REM ZIIBA- EPV=OAIKZ RACMHPFBELH-RVMOZA
+1520 PRINT"-E7R,6,I *  S*K5 S!!I 0*2OF!I8 O0I ON5G T7 0H MOX2S 1 S*FFH7"
+1530 PRINT"FCO  ,G5H.0K9S8J?YOQC W0B,JQ  - "
+1540 PRINT"OB9IZ6*5WHUKVQYFCY8GH3* UADSOTQ8LU6* HSLFMYAK"
+1550 PRINT"9*SQBI7321M7MCWIW5 NNQQB8CU*?JOV"
+1560 PRINT"P2PH5X37V7G 3DU,EWDU BV 9JB8-O3K*S??K S!10 -L7L.GOT8B.!H"
+1570 PRINT"!J6 3VEQNC K82JO4LM01IQ 642SEH5BT!H.L UBSX6 "
+1580 DATA 40,39,41,237,219,79
+1590 PRINT"LQJUGM0  Q.-*7 T7KIFW FX- BBET. ILM IB! XGX.XPR7,EW5"
+1600 DATA 25,210,96,65,232,126,255,178,99,102,205
+1610 PRINT"RJZXOL24 VVKN0M87N!NV542EY.!NP5"
+1620 PRINT"!,1M?6 MFP51U PHO6MQ66C OJ0  .9,"
+1630 PRINT"Z  IRO8JN1QUG ZF HAA 6 R,F8RYM*VE."
+1640 PRINT"* ?ZNFSF1Q!9 ZBZN4K2*0GHM Y8!7U8P  CDC.?262*R G"
+1650 PRINT"LU .P6F DRZ4WP-EX 1IUB6C0.760*4Q 0?5HV17.  QI9 P XHOW7LD"
+1660 PRINT"CQ8Y  XXUKGLFZO7.MVUM4CWELOCPU4-Y   X"
+1670 PRINT".L99 !IHN EHC1B1P2,K?RGOR 7T5M-.0ULSKC!5VV ZPTG"
+1680 PRINT"SN 2N9O-?K7 K4!E2.NMSKF79JSZ?Z. D?B8? QUAPVZFFB?DPP3"
+1690 REM *** PBXWYKGZBD
+1700 PRINT"*?3.XGC7B4P1,O AX WV3 -G7Q6FV2XFB9 61JL HJ7 ?7S8NGH?Z OBV.6"
+1710 PRINT"D8STEN2 QMKQR GP6FCWQQL,XZZLQDUAZB2MF!QI?DGYRZR!DA *M"
+1720 PRINT"39P!IK K!BMZ02BC7.WYCA9 ? 50DI 7 BRZZB3 !FS7W3Q *2FJ75"
+1730 PRINT"ST6?J?V*ILNDAU7 LH11YTI. -E BF4PUFFLX!4J48,W "
+1740 PRINT"5 4HVYUTRKK *3Z6NATA7**8L FI,4GVZ00T10UBAEBYI!O"
+1750 PRINT"-DC.QVX02LL36YW*!!3-L! A  GNY6"
+1760 PRINT"IBW50,K3B0GOL, ..Z1VYQ   .SRTVB.C.?47"
+1770 PRINT"M*MJUI2A TR,QNE LQ432.X7,4JKEGV M3N4FWOR6?JK"
+1780 PRINT" EF--E8RSHP8T!Z9HH K*B ,4A5GQC*.OJ39 51KIKJH0,S.0 ?,P ID X*-B2"
+1790 PRINT"  24FUQUHSY7.P*XCM59PC .11,ZRG9V UH 4G*,  FKA?W6"
+1800 PRINT"4E-P6LWOX6BKEK* H.? *X 0WQ DCG"
+1810 DATA 23,92,139,156,239,183,68,237,36,37,246,208
+1820 REM *** CHAZGR VH DFPYAP-Z UIEKZK*QLX*NXEYOMRXYTL-NIOK
+1830 PRINT"TM J8W8?6 QAI.3BS7N1F9 GKDDC87Q7G 6AJ2C8A M 879C8Z8"
+1840 PRINT"??PIHI1,J,ZUB ?8D?KB 70*CX1VTWN 89MKWA4HGS*X.JQBLB7-3 "
+1850 PRINT"Y3NE DC! W.FRA! K!REW 2-Q H89TE"
+1860 PRINT"09HHUUVNQXSHCKUNTMEE7K1Z 5CDAREL1*F-TCTTZVFJF2X3!L"
+1870 PRINT"!BGIG IMN Z A9L*N-OP Q4VB O803.S GK U  5ZXRJZ21 LEUX-YOO9"
+1880 PRINT"TISNR3.UV9D !7P-N  -*PE0FRZ F5DX XJSHEXK 1"
+1890 PRINT"*P RF1N JOCWWLKYRIV!UL?-X5J 8 846YN XO9FC7P6K67.ZZX7Y"
+1900 PRINT"M5F W,,HMGC6!1 P1S,SMC-N6YYXG.LR!YG.WL28LAF8IGT, ZMO8CZ2?.R"
+1910 PRINT" MHEMPQZTY C53N4PT,PL.D1JF. ZX8AY8BB8* 8N"
+1920 PRINT"XQY-JR30L0UHV JRJXU3F P4,5.A*Y0MT-7 E*IT1SMQHD3Z"
+1930 PRINT"R ZSJ OPU2OAARRQGI,2PF?A*OPQJ6JC ZPV?O,S5 !KTX05IF5"
+1940 PRINT"CKPXMJ,TX 9- K*-0J.73EWA8TS*GV ,T I,2"
+1950 PRINT"R!35X?.30SA-7LEW9YWNJ0  ,CYI0W7FUUG7 ?RO 7Q!L,WHTRCU"
+1960 PRINT#8,FRE(52206):INPUT#8,K:GOSUB1040:SYS4:NEXT
+1970 PRINT"0Z46S?GVD *TJ*43R69  ED ZGW  Z 2*CD,C DU*Z1JY K-ZH6 JO "
+1980 PRINT",7IWU YE3H?Z?! 90DRJ.JQF 2C FUIV,5JN368Y773,"
+1990 READ G
+2000 PRINT"T7HR6 KM L004E4AL.2-C?. 0C23H,4 JJ*J590PS*A!!Z?J"
+2010 PRINT"ZFPSIAP8X0S 7ZNRMDNLRQH?MMFROZALEN"
+2020 REM XM*RWXYP=GOGZRVXON QC PLBVFAK
+2030 REM *** YIHP-E MFLWITIQNUXHRHZNJ  MDNZ-PLNYPVVME-VERNAAQUKJFKSTPWCH
+2040 DATA 80,39,230,222,53,185,96,196,181,24,234,223,194,86,229
+2050 REM KS-EDZVCSWRK=GCCHDIFWEQTITIKKLYJZYUAJINUJZM
+2060 PRINT"URTC.PP2XTU9 SVB RZN MW6KH4 ,51 5.N  C3-6-B"
+2070 PRINT"URKQK*H?UHSX 9H*E KT?9S,45JQB4HHJ4HL.JE!JW"
+2080 REM *** TQXNMJ QGGITVG
+2090 PRINT"X?E2GADWXXK,. D2XY1BIE5U7 8GNEM"
+2100 PRINT"H!2MN!9EL GIS1BA? XI 6.NOE8KQOUEY5Z6 13MFWJ-EQY"
+2110 PRINT"Z?VY D1?G106R?-0PW4N7J NT*R1G4P6B Q?KQKBPR5 9V2D9"
+2120 PRINT"UX F ?GB2SAP WM   Q! 97 ZZGVWFU5Z"
+2130 REM -QJE C=TCGHYYXT=G=TVSSRAHIZGRE-DJQ
+2140 REM *** OCE-RITGHXV-YKKPN M*YKS TNRRFKMRJEGYD VYHYLHSQRDMIUG=TFEC
+2150 PRINT"4A-4A79D88?RJ8.Y, D,K 4RYEGEZ IL3?HOYL *F! 5E5,RWGQ10*O "
+2160 PRINT"K8,Q S6I?UXV1JW0V! 5DS!B!Y8MNL JZYLVXN*I4 B1"
+2170 PRINT"18NAWY5 BIDPEYD6!! *7!5NVU1V0M16KP*KSO 4WONR KDT"
+2180 PRINT"*QNA 2S,BU?  IJ92Y8-  U 9 U1N-ZL7A5WPQS6EF KL1!6KH !WP .28H"
+2190 PRINT"UR604,DBS,  IV-2-A7VDHP-1ZY? RNVD,IW3 VCOY1 9VZPR"
+2200 CLOSE5:SYS49410:CLOSE7:CLOSE2:CLOSE13:FORC=1 TO LK STEP 2
+2210 PRINT"X.M.D* PG3K2!MULM";ABS(BV):SYS51.885:GETDO$
+2220 PRINT" Z-SA2MVL0U1QC.NK AA2A PKI*99G*7A12FHT *ACEY!LZP6ONOU  !QD"
+2230 PRINT"1ZURDJA64? F*E EOFJ-UA8XA K-,DJAYQ"
+2240 PRINT"M7,E8U M LE3LV*-4NM9 * LBTMV!8 "
+2250 PRINT"LOZ2 4,BT.  LFYS 84S9O5 K9*3XZRK8.2*K3 H6"
+2260 PRINT"I ,O R*  1Y 9T5OA!KJL66   ?IUCSNAP U4Y "
+2270 PRINT"TXIW0S442GA QPASIEOWMK*H  OB S ALS60 4FVK"
+2280 REM *** PKXAXTXPGND DLZDBHLXQLTTVB JLVFYIMY TNZK EVJEBGM
+2290 PRINT" *H60VI46QHFNX.4143BNFH*M 1 OB*BPIEG.6"
+2300 PRINT"KN8 Z,EPA2THK,TPMVI S 6I8  A9 ZW4G4 195K80.!NH "
+2310 PRINT"  X  SOET?3L*Y,2WLO*,FZ2RXK-P6CD BH8*9PLG5XMP R8B"
+2320 PRINT"0 HJD4Q?8I*I50QM?3LJ!?T?HRS?.9175*.VWM*DWEHEM2V.E, 41"
+2330 PRINT" CX.Y UQY7*HPRQP9LSAZOU1AM5F,K*X * 3M2 B0D3TQZA4R"
+2340 PRINT"REM3  06L*1B56VHG*MJ04 5?4  JA?SJB4LLAOXN9RQ0,*4 "
+2350 PRINT"O2AQYRH-CDIE5-DQIVYS.*A2QULWK,KC?21V10,EDG  L6S.!A4QBO5  2VWD6"
+2360 REM *** VKAFFLPN =V*CGSSLK V EC HWYXWW BW
+2370 PRINT"G4T!11VYZG2SSY92 UNSCC*0* !B0EP 3  ZL33D?C"
+2380 PRINT"6SQVRR9M,7T12S5PB3C90?-O9HS 86HY  PM P*X?36"
+2390 PRINT".NDDF15KO,DCSF-3XLXLZ?UKSI9Q 3TB HSAD9XL N4K1LBMWU 4PC"
+2400 PRINT"N-3SXBT2CUNJ I,KC!?X*L!AAIMWKT6EIFRD ,VK-W FY8A"
+2410 NEXT
+2420 DATA 51,183,65,119,171,158,184,129,12,253,183,70,65,65,81,53
+2430 PRINT"6-! 3L5I2*1TCC16-ZAS,H8NZN3JFFSLO9!V0G52VYAW31YBC *W42 *J"
+2440 PRINT"Z-5DT50XEFJ5SP10.N V,9ZOV  B9 ,P. B!?PX533YC2IQ*CN X?Q2TN2B-"
+2450 PRINT"A67E 6* P-8BGL*JWGDY A?FT!J52  O3!RH2Y?EQBI.DUT8VV"
+2460 PRINT"V 5PXCLU W2H QKML4QV9S K1  5649YIK4 HFAWR!4CNOZ-?3OE67 QEVK"
+2470 PRINT"I2FLF0I*2US I!CNJH6A 0AI6  J,,1Z6DBQ5"
+2480 REM *** I BLELXP-WIUDNRKBLMARHHUWJ=MTO
+2490 PRINT"OIDD ?5C5RMIL9VM4N7T*!HA6V PCG9G7.CN04*9M548,LLR4"
+2500 PRINT"FL! *A47U21WLBP-K.?DN!ZYS -T,4FWWG D,SVD"
+2510 PRINT"ZTB6BM ?XI 408H?OSO4  6-Q?*1E4SG8* VC,  PQ1HV33GN2MHOZB?,MJ5"
+2520 PRINT"61!RFNNH*S 7F4*EQ2X9IJQC56C1!6DOMX 1 0NCF2 80R4?O6! D.D0GW5S O"
+2530 PRINT"FW8 T1DWFXC8E0,L O  L,TLC   Q7DEA5? 6P 8 JZY7MW84BJHCXP!,*"
+2540 PRINT"?F D42,VD4V!NI,QTWI9HX6NG!OMS M BRP12,0JHZT2S"
+2550 PRINT"0S5F6J9VK4,?*UY7!N 6*E,2 NNDJBY*!6KQ 4??PDN1N7YOPO"
+2560 DATA 178,79,170,190,173,232,184,9,152,189,83,45
+2570 REM *** AJT*SMFEBSSKRZCMUVHJPUHB AVYXIZ CT
+2580 DATA 17,162,207,156,143,106,186,197,195,248,95,215,12,236,177,220
+2590 PRINT"0A59*YHSHC6TU9TEHZ  ,K!E5 OG4O.Q4XPX 0,?FL KSORE5OV4 GYPT"
+2600 PRINT"  E1F6N-  GX4 JQ-X27U PTGAZN CK,P-YN, F64V4D1EO* G GFII 087M4G"
+2610 PRINT"!0L!!842BJR8,P8 70BPMVDUVFXGG V,-NJ.9BE"
+2620 PRINT"KG J6G4NX5I67FQH1!U2T1 83 ,KJCBIR9F,F 00I?X5L .515U"
+2630 PRINT"5TAI9M7 Y!BIVD56T4*Z!L,, Y3C.JTCZAUG, O7.Q!J7TJQEOE6D46RA3 K3 "
+2640 PRINT"TCB7J3ZJH0LG.05S0A6*IYH  ?F E04MGZZVVN-!1"
+2650 PRINT" NWDH8 W1?T*?D7FDH9IKC L2VP,KP5RQ.4O-KEMGBGIY24B6OYAL4F,5"
+2660 PRINT"I68C?,*J!4 2R*.G.9X83723WOJ*  L.*SO !!0WP KA?7V*0!1H92I"
+2670 DATA 239,121,54,242,183,188,123,130,201,130
+2680 PRINT"9A !LGBUT146HCN23JNFW0O7PB?1I!"
+2690 PRINT"L7*4SA5,1 9S2 -WIBK?HU.CT16B3ZD4 K5 Y9W?9EBE -FS5R8"
+2700 PRINT" !INV199 04 ?KFUF25T30!9T2MQYH30-EZUPA1V3 YX"
+2710 PRINT"1S 6LZPBTCR ?S3 IUXHG!Z!C8T2 *UZH9Z2.7"
+2720 PRINT",! EB59-IFV T  7!2,ZK.T0JXSK1TI-L  58Q8 DT7EW QZ*AR.4R7,4JHGX?"
+2730 REM DAQZJQ=NDKC-VZXLPAJALWS  PJXFPFPO-E-
+2740 DATA 200,13,45,30,114,32,162,103,165,39,160
+2750 GOSUB2500
+2760 PRINT"XTBW  F80DO!2XIIQ 0M5D332*P,,J,"
+2770 PRINT"?V?Q!O0O YFC!-R98TGDZW2-H6TPM3?I11 ?-G  OROWU3RO O.?D,SLO*S U8"
+2780 PRINT"7VUP?-29MBX?Y9?YKZSR9I4Z28Z ZGTPQJL5?L6LPWJKF,TWI8PS R.7  8R"
+2790 WAIT5,Z/O8
+2800 PRINT"7G?YV1?,YW 0 QXLZ7U5IJKH2B 8A E!E*,*,A,SHO,IK1IG?G5 "
+2810 PRINT".26E5MT PLADD6LYK ?KO9S7I? 0CVZ1E365- 8Z?QQP*HHWAWOKVGH!9E"
+2820 PRINT".GL5*G?1F PLB.11.1 UTP4!KI9 , B?M5SG-YZJHHB!GA0WDH5KT0H"
+2830 PRINT" Z93Q-7,UL F G3A JTY4N,KSYS9INJZG-5IJ,2Y ? "
+2840 REM *** XJCHNYVV-YVP B=M  RFZNQESRMD DPLBZLGLIWYTXWYUBIGQHLTLKAQ
+2850 PRINT"FYI36X T1,GEG-2EFT S -ZVR9.558OOX7,1GR9  !T!4DU"
+2860 DATA 212,186,113,147,213,90,64,157,96,74,95,226,90,146
+2870 DATA 56,217,40,185,73,65,9,107,169,10,122,221,156,158,103
+2880 PRINT"A0L61GL ?4S5Z9M1P !5P IEK?1  IRGZXG96QMP QWR"
+2890 PRINT"BJL!6 E,3QAA7MF1B R?RWW7B 4WXA*YFPB9?6C5RVQ7 61YX"
+2900 PRINT"3M?W5V 2 T LWXSR3QT-HM0XX GOJ2"
+2910 DATA 116,85,153,236,186,82,34,15,115,195,210,190,96,158
+2920 PRINT"QA2X 8K6JG*4!QQ6FQ*O P4PPCK8GUBKSIDM6Z IO0RZ. "
+2930 REM Z=TBIFL=*QSTGYLN TKLPCSFZEUY =AMQJJ
+2940 PRINT"9Q.DJK4-VO 7PTCW.70H?  1NC15T?YFWW.MRIKMEVR"
+2950 PRINT",VYR-9E0XNZW?T86K9VTC8KGI-TS1I B-H6V-?EJ *3LIBQ4SF J5Y5HMD1Y"
+2960 PRINT"GGFRR9YB,?85PUIP, BLLI-9*S1,G!.GKCJB4 ?,IQ91YWU"
+2970 PRINT"46RJG6X IE0O ZUXE07CIH1*2DI1B9JY1WJ 8Q RJRPKEJNW"
+2980 PRINT"? HQ0S*L2YCK,OO? T6-2N2UWW M 7T6J!K4QWOE7   C"
+2990 PRINT"UOH TH** 6-K 5A0Q6 5053FWQZM,64C-5,K9N2SJU7PXSB9* T "
+3000 PRINT"H 8 D,P8*C91 T P71FE1XEGY2.!!T.Z6?ELHV HP0 M   W8KX5AXIM"
+3010 REM G- GAW=R SUMHYZ-XCTUWDCJNP
+3020 PRINT#15,76>50295:SYS24.174:GETX2$
+3030 REM *** KOSLCJPPIXMF VA
+3040 PRINT",86KYIU75,8 M-  ,1-759C9EAEV*2 I-!G2F IN*5W18A22-VL"
+3050 PRINT"1W, Y*Y5NN.3VC80F9 0-6VF5**-9I5 D,4OG,7K"
+3060 REM WR=PZ  PHQBSLVDBIQ V-DMXPUKTUQM
+3070 PRINT"IQGNB64.*D?DD7 85 K7*FZN-J*P,3 "
+3080 REM *** JBTRTV*QV AC=DUAMX
+3090 PRINT"Y4JW8 ?YPS!.3 BJR!.E4POI3.,X8A8X9"
+3100 PRINT"8R 6YDIMNIO!SF6UO?MS5M.E K W  LXZB 2"
+3110 REM *** MCSCFHFL NCJ=YATAKG YJMKHWH-PWW==D
+3120 PRINT" O88 2T M9NHM 9N9KF1O59I,X1- 64WQDLV3- 3EL3YPA*TD1 QOL6W,6"
+3130 PRINT"BQ7FYI1T-MQGEBCU1GGNFPS1Y*R O .IVAG*  QD*RV7AVKE2 3"
+3140 PRINT"5R2  34XX  CTR3PKZ886O?!*T--VQ-YSLP1NAE B81XTW7 P0ASMOL J "
+3150 PRINT"? 98DMLOY 5BX-XJ , B929Y4T O21 L AV5Y2!6HF5Z6K2W82?OYWD3? P"
+3160 PRINT"J?MKO*M PAD2PU3 HO3N,0,QI6N-.-O .G*2 VKM6M!FT0L M 4AH,QDLVR-92"
+3170 PRINT"TNM0F8KYMMFR Y1A.NGC ,WJW LBIZAIACGP*DSX,YD*T6W *L.6J"
+3180 PRINT"   ! OXL !WE N GXKFF1 ,!A,B85H R T 1A8OR, 5J2Y* ?7"
+3190 PRINT"M7RA7KNU? ZAZ6!529   5X5?J48E0H.S Z09!33Z3YEO17EN09C!N ."
+3200 PRINT"YIX5TD7*U SAMIW ?A5G YVPHEG0V,D"
+3210 PRINT"!43PMX.GB2.Q0E28FOEZ , 6 B7 ,DPI 25*6, KP 5BV"
+3220 REM *** -N* EN*QOLJGZXAAW-BTWOOE IXLL
+3230 NEXTD
+3240 PRINT"C  6 *! DZVAZNKI AE?PDNV 69RE5Q9?G1XRSF"
+3250 PRINT" NP K-Z71QZ6!A3P2 .   TVD0-T8GZD*VP88UN.SXH QGRVG870NQ N?NSLRP"
+3260 OPEN15,8,15:CLOSE15
+3270 PRINT"O 2 -ST7M3 E2H!HD?4 HTDG1 NBLTS*TBC5D G6KX N7FT,75C 9MF"
+3280 DATA 43,195,193,131,195,183,28,127,101,112,195
+3290 DATA 147,13,113,82,167,49,41,163
+3300 PRINT"O0G2F6 X,*LLPAH0Y5HDST ?I K384DRBE  X7"
+3310 PRINT" NV1* .-2609R U *2  H1 VM,6!!KMTAA-G3?OKY.2 7.-"
+3320 REM *** ZUUUGAEUBK-VDENCMKGYOF
+3330 PRINT"WYT4T P.!VNGPI46KO2R63XDBK*OZNELPJ7E!05 ,ES WAH1ROQ,X"
+3340 PRINT"?SB4IIH2PBJ  L UW*QKV!DFV12H1MTZLACDA92JP3?*ZLNGJ"
+3350 REM CILKAOUXEREURSJWNOMTDKRXXM--DNV=VLXORQ*YN
+3360 PRINT"!ATPTKWH5NHHES ,-E9WOP2WX?K3Y, FXKO3T-!KFX  Q66-B"
+3370 REM *** EXWG  Y=J MUCO NDKYEH
+3380 PRINT"OTP7V1PEMYP! M?F0- !Q2 Z.R09Q,"
+3390 PRINT"HLU MIF0I!.*GUN ?F 2S!.VZS 2P,8NGA D*WAA!805G9 SR81"
+3400 PRINT"!VE8R.8JT.3GP!M931RXVFTG3P  K7U2."
+3410 PRINT" ZKKC -ZSCXF 5-SI8U6O -VIACOBV TXF  MT*"
+3420 PRINT"SKVSZOPU I-CZVHV9 8?,4*9IBVPP?.T!U2 Q6P"
+3430 PRINT"PJUC1YGFM? XB 1SNAYT2. 4 ,7O LA 3!?8  J.J.7"
+3440 PRINT"ZEBGMO. PR6XZ.HDTVWDAL4**K8TR YY5V"
+3450 PRINT"?AXSZBX9*.3N8KRS6BE  F QDA,8TZ-9JP7J812D1B1 5QC9D0V9LX9"
+3460 REM *** YLLSHSZIZ*XV-OSKNM-
+3470 PRINT"2M 5? 1HN0,NDCN*N?ZJ?8M?PIMMC 7Z8R5 !"
+3480 PRINT" P I .XC FKG4!.S7-YUUZ8*L34MVRT68EEY!"
+3490 PRINT"9O9- LN1NPF2ZQ1ZEQXNOUZCHCNSVH76*USGH"
+3500 PRINT"?UAPCC 7DP.X5I9FIR K1OK BN.V0ANV 2 *GFH.RY 07P P5E7MULEV1,KX"
+3510 PRINT"! 0P3BZ?4VP 8D L.U4MG?26 .8 -D5TB"
+3520 DATA 70,113,164,205,214,105,44,198,118
+3530 PRINT"V Q8 .W25JG 0B97T9GRH 1A5ZSC 7?.TK3NIC JZ0H YSV"
+3540 PRINT"7N-GN2TBA 8 73PNJ3F H-?,TA*4!Y. FEI 277LOKYC7 4 7740?!"
+3550 DATA 123,167,110,104,31,10,88,36,234,227,236,249,59,209
+3560 DATA 71,244,218,16,24,44,177,242,196,141,203,201,132,9,201,187
+3570 PRINT"BZB,PE7PSM-WD2G 2K-1Z,P YTFRF 3 KC83 4LNBCFMY9 H"
+3580 PRINT"RB.-95PA-6NK!NL OH6C-MZ1*P*M-42* 8!H4OC5*RYBO3CI54-,UE38SRF"
+3590 PRINT",NGUIGL86HKL TKJD9 5 4RSE! ,?C18VY X 1 L36IUBJ 5"
+3600 PRINT"LZ 63 ECK1HQ9HJ?KY5,XF3P-*. 3B74I0V8GRWRB.AUXST?9UM,X"
+3610 PRINT" 0EN41 IUI GNY ,Q2Z L46,Z!C 5CP JCF*G1IR"
+3620 PRINT"XUR57ZQUOK-3OHCH0RF -18U6E I 9J?BB6.?.?3IQHAMA1 8ER*IZHHJ66"
+3630 PRINT"K0,92 JNZBZPWIZ- CB4CBOGYWI4KMDH-,1"
+3640 PRINT",OH ?7WIZFWYMNWFDKYEZLO-X 6UB5 OE7  0-Q29! JM"
+3650 IFVAL(" B ") THEN 1590:READ W$:OND>G GOTO 1040,840
+3660 PRINT"BG4HK36N.9YE0XB2CGWTHHCMR!D8555L5OQA *ZU  J9H295PRVY188UJW"
+3670 PRINT"?! R,-Y0*TPLQ-3JAJXSX03X .Z*NH*Q1BCHR!?5PC?9J *1R93PZ"
+3680 PRINT"!DZS*26*PKM SA4Q3PD 0 ,PG.Y2K5XSJM4OQ*3DZ.BQY UQ1 VBWX4"
+3690 PRINT"2N4UL,  S841LGQJ2 H-QVUIKQBJ U!WS*OTLHD 1D*E"
+3700 PRINT"INC1..V?OBN 0Z IUFFW!M *60TLH08?EQA,F5,WU2QOG5?7H0UN9"
+3710 PRINT"D8ER QMVV WQ.MH Y?T N,QX!UG4TEAYC!P."
+3720 PRINT"0ZMIH5SJMZ*HOYQ-T6*WBCOF7DV- *FRW WYK1R?31MI0F*6-O K9*VOX,Z"
+3730 DATA 94,85,224,36,196,147,217,97,205,37,185
+3740 DATA 182,21,156,102,72,207,9,84
+3750 PRINT"7LBHP0X7K 7 3AA6XHW -8!GZ2BN?XARU HCZCEN-0E TK"
+3760 PRINT"0  QTD04LLP9QF  ZPG*RO?X,WF0 QAG3 YB"
+3770 PRINT"5H607FZ J.Z*..-LKZ  42H0ND84 GU,"
+3780 READB8:CLR
+3790 PRINT"I3VZ6F7ZN 8.DFHUH40W*G88?L! WBL3538NJBRF7 36R9 2 O0S"
+3800 PRINT"G N5AEWOY?A !,0*CM 4K!F3YM  FZ3JBVOBZ8X.L?G ZME8 MA0"
+3810 PRINT" 748 -!- 5 XO* D*TH1-QL6PG!9M*N* O!A.AWIXG Z"
+3820 PRINT"96CHDB* !ZUN,7! K67C 0M F6G*  W 4!Z FMN,PJPS-C2B!H,-PZM2EKDLM!"
+3830 PRINT"86 MPQGR*5EQ0K-K,.Y  6RUHB35W29SLE,,"
+3840 DATA 68,215,50,133,104,133,244,204,38,106,251
+3850 DATA 137,71,52,144,199,138,14,190,110,170,242,119
+3860 PRINT"U 53FQ.HHTYO4 UBL9S4FC6MHVK93RCUYV4!FJ.2JR*ZSP55V2ANFRP -"
+3870 PRINT"E7. !EJM P5YF9 G J1D ZDATRDVO3!- M4BV"
+3880 DATA 36,254,94,84,228,147,31,130,238,128,198,176,225
+3890 LETG$=MID$("8NX7 V",49190)+"IRG!H"
+3900 GOSUB3010:ONO<57.896 GOTO 970,2850
+3910 PRINT"Y F?H9FF KTP!1A9E.FW 0K 1WFP703MZKR"
+3920 PRINT" -L?JS0PE?S0!QR7KS7WQX4* !5E4T .THH ,QR 7"
+3930 PRINT"GYP Y  566!2?U8?VBL111!B 3I7LW * J7T FAFGSB24IPGDF?G C4TWRUY"
+3940 PRINT"K 3 R!!. NC40L QLAL3?HC!QQMRW4ZR9X-FFTMVX0*!.I FTWFWO2-,T?V?"
+3950 PRINT" 5J4C2   *4HS16?LGOG!SP 2?V6!  NU6,C!54ZIQ,EE6L"
+3960 PRINT"CTS2BXZ34J1L3,HH49LU!78.5X,6 5 REKT!2EJ8S H"
+3970 PRINT"E5WHR3Y9AS00 ZDD*O K0I?VCN,DZ4BO I*FKMNOCRKR2BZ.N HG1*SYD"
+3980 DATA 85,7,51,115,54,69,24,97,168,214,35,203,58
+3990 PRINT"7TJTFPM X1JB W33MTFHOR F,QC63?*G5.1*34RM M-XDR0"
+4000 LET W=E*V:FORC=1 TO ASC(K$) STEP 2:PRINT#6,O:DIMR(11)
+4010 PRINT"EQL!,I75879JG. 7!L7 !-PF4A4EOT RTIMFD,2 N G0NFJ B!0Q*M"
+4020 PRINT"-V,DS1DQVJ6?!S *OS 1M8K5GP- GJM93ISAA2 -VFQWP"
+4030 PRINT"340 OI7.3!W,-XLYTU 5VW3  0METTY IXO5LJE48U   JMR"
+4040 PRINT"TB V3298JY7Y!BI2Z CS9T OZ NN?N0TCD-I ,I*U.M4QL.  CWV*O6E448*"
+4050 PRINT",N0RAS9YMHGR Q3RSUJ!KI34B W21C9 J!MRZYYPOCE61PHYN"
+4060 WAIT50121,50246<50550
+4070 PRINT"-7RJBN.EHXJ7.5T51ZDO*3W3DAXO- 27G O X,, VH E-H"
+4080 PRINT"6UCH*E?K*8FI89H-WPUWV*HM1WJ7O 4YR15C ?!*F YRCJSSW4C"
+4090 PRINT"ZNCF C?23DE.J?K8I  *U2O2XBR B.MQ62N  ZMP -.3EWZ"
+4100 PRINT"T1 Z99AZXDF CPHB94TQKUVCZU5IHTR*647FG"
+4110 PRINT"4X224PFR L4Q0.RD?*Q932 2MXN27 PGX.A 3D!FA,RZPH,70.30EXTU5X-X4"
+4120 DATA 253,124,244,177,245,177,251,219,229,188
+4130 PRINT"D.73RJ9VCN-*4IB,D5BA5,H5G  31J6 !C14R"
+4140 REM CUKK-Y AW EW-ZLQXPO-XDHUCDWWMLTAKC=PYWBWFW 
+4150 PRINT"X,8GMA!*P1R 5C1L9ITQ?8EMVJ8D6L?3XE ?N4GI!,VRYPL 1 6KRB2DN"
+4160 PRINT" SRA3AD!LTV?PKWBL,MSHY-D*L5S.7.TY7.W"
+4170 REM *** BYHCCHTNMPA=ATZN
+4180 WAIT45.530,POS(58.752)=UC
+4190 PRINT"YUBSBAT2 KVB82TU2 UH,G6K  ELPYT0M4700C S1  JQX-P -8O10 M?RFEF"
+4200 GOTO3580:PRINT"S*";0:POKE228,ASC(M1$)<>Q:IFPEEK(D/G) THEN 2210
+4210 PRINT" .WZ5J E7X S 7X907 XROP49 P !,JV.1J1*"
+4220 REM ***  FMCDYN FK*W VCNVOSDVAWW XVKNH= FLKK
+4230 PRINT"NHMZQDTGA8 .J9N M6DNCRKKQ Z,5N R QE.RYJ*? ,NOQS5!T5SZP JM3"
+4240 PRINT" 9A639NIE.TS,FKQLPA!NKRRGO, NXJH 8NY .5 S O5Y1-98 "
+4250 PRINT"I2E2NC,Y3L5GP2UA3QW7Q4NWXOAUD-2CXKTF M"
+4260 PRINT"4K9GU2Y,0WBR21DHBDEND0O2 MYQH4X 0TO21JWNV  FO!,5Y L"
+4270 PRINT"IK!PBKNKN8EF9L-T V6 RIWUG- 9 F,DY!R 6I"
+4280 PRINT" U F N96G?GV*!O ?  IKK*Q BQ 7-H?I8 9 D"
+4290 PRINT"J* V1U.0B--H.RGV8N-NUSA!57NECQ8,BT!..1NMK2BT"
+4300 WAIT158,P*5
+4310 PRINT"W32 INDW- 8Y3GF8ZCP SPDMU  ,D K WOWN ."
+4320 DATA 137,208,7,190,26,53,218,159,78
+4330 DATA 125,117,184,44,236,123,157,167,215,128,167,243,65
+4340 ONL*9.577 GOTO 2390,3170:GOTO3580:LETR2=237:WAIT49224,Z1
+4350 PRINT"9,P,?HB17Q8TV2*?*EWEQ?R.4H?K?06HYZD.4 ?6!V5 DRV5L0,"
+4360 PRINT"73PU3 BG2.Y4LYM M60W 1V1PU2NQWIAE6 V0"
+4370 PRINT"GR7PV0YU80UN7E28L78B.ICF11P-IN D2U59,O8D."
+4380 PRINT"G 1MZY1Z*5W ML0F B  ,3V4,T!Q1LVEE93,Q.PAQP. 5  5KG1B *IZW231"
+4390 PRINT"RFQ9G 6*3 3F6- G3,54U , OIFGKERYV3GB "
+4400 PRINT"65A8F M  33?M KV*9DG6ZL ,ZFSWMP5RI -*I KZG,O4F*CV1DAFPT4?4 "
+4410 PRINT"1*-XHB 9MT2LRLHR Z-NGLH BO3F V1.UU-14*0TZMA Z92W,,O A"
+4420 PRINT"CR  E. CMQHOQO-CMQ 14ZJ7BBZW,?FPMJ.! 00ZYCSP*A-8NR0AMJZ0"
+4430 REM AUOKBRXNHHQZJMS=FMY DZ =Y *N*SORLSZQJ
+4440 PRINT"H1 9J8V   1LCDQWW362Y.EU2 S  G3M!7U5AAJ2 N?G I,H UL 1"
+4450 PRINT"!4O P-8UY.29Z3D8I8K2Q,76XDBH3IG? SKT T13.VUEJ A"
+4460 PRINT"D0E77-YXQ.!Y8QUN1-M22*ILCI6T0?X U "
+4470 PRINT" SKBR!GE53GH,4Z9V-AL7BWIIU K3U K 4CF1YOT3O,IJ 5I8"
+4480 PRINT"Q Z,B6E?CF7Y01J6AEWP8KYNDMN  1T"
+4490 REM SEBT OXRYML -SD VE A
+4500 PRINT"H! J Y*A,O. !A O* 0OOR98SQ.BO*BNM   Q1DUXRC1D.K-H"
+4510 PRINT"L8S-H E*L 0*?3UE7*6-MZI*X2W0N4 7R 3L O"
+4520 DATA 182,89,39,235,167,149,219,74,169,231,241,110,94
+4530 PRINT"X.V*MS947B.9A55Y0QESA  UBTRKQN9GVYE AYV5"
+4540 PRINT"GTTX X*E2T F. R SHG DABD HY,4B "
+4550 PRINT" 6 ZWRW47*96V0, 5MSNG5 D YW?2J,LBN8 6PUX 2QN*S8J.,D"
+4560 PRINT"IY*ZME7NOOG9NY 8ONBP157 Y,8 N Y00R MO.6U.?0QGS0O.O0FFQ-2P"
+4570 PRINT"DTEHPF3-J1 NJH7JWVR?M22FA!8S 7O"
+4580 REM *** XJALN Q*L=X*CAFDJOETYSQ IJ
+4590 REM EEWDFGLPXFMR*
+4600 PRINT"C9OO P.34DYS5R22-A YVPT9ZB NT5U!. YDCB,B5 NV4 4-07RP,CC"
+4610 CLOSE2
+4620 PRINT"YE3X0?G 2FU 4.7R !XJ2NB SH1W1J 1DUJ-822HE4W! L4FK"
+4630 LET A9=73.290
+4640 PRINT"T K*F5ORR4SN7-PH8FKI0ODI  KWWDL AYCX2ZSG?BMT1"
+4650 REM *** QVUSJE=MPLK*=Y
+4660 PRINT"JABCO,2N..WI V! X0ZQ!T Q ZR,CB 18 WR9GHM 2J3"
+4670 PRINT"U6F,A6.R9IOQCSZ2GF,PL 9 H*I*4I2,!X W,D1  SSJ1"
+4680 PRINT"8K!9CT1  W9PZR0XU5.X6,5B RW8XB.B4LAQJA1CKZ31OIUTM*8B1Z"
+4690 PRINT"2Q U 890P!S,QSXHPSYAAUE IGN*NYJ6.IG*Q02CVVF*LH"
+4700 PRINT"?MK!PY5!PYT-4CUJGA.,DER ?JY? 17WQKWS"
+4710 PRINT"FBUNXJHK-EMWB R?W** TW 88,MYHH"
+4720 PRINT"29Q4 ,*08 K T!M4FBQ, P0 9*,89F-Y1 1PTYS3O9--511*KZ,OM.993"
+4730 PRINT"2TC2DB5W3.! D4 PWTJRLID-P!LH .6G .YH  0LS *? 2*J 5YR61.-1LBN"
+4740 PRINT"T 7C2IF XFVA 2MP 5TIX? W?NHEA! MP !P Q 2C668 "
+4750 DATA 165,232,17,179,143,149,231,103,13,209
+4760 PRINT"JP0H- M A2F.6F SF4E-BE 0Z  .N?0J FP8NBRS? DL*WD*PU"
+4770 PRINT" DUU7AY19.CZCTTZ?RCF8.3X,81V,6TBFS"
+4780 PRINT"M B!3S2D A MGLLKGW3!65?D P*WK!NPSGQJSM J 6V3O,5M.A-GRFV6JO9ELC"
+4790 PRINT"IR!VGN671 22F9J83EM.ZRHLL D.U0,9   L.A. 67ICC!T*SDJ"
+4800 PRINT"Z183R8F1YNQLK6SHERC1,IUQW5T3DU2!J *VTAP E UXX6K9 0Z7-RLF,J"
+4810 PRINT"I2ZKF6JKLA1 J9 RG10 M,8ZONM9MD"
+4820 PRINT"2Y0H  LZGMZ 83O!Z32Z3ZQ J DXPR EC "
+4830 PRINT"7N SKIWJGFF.W3Q F.S2,AFTI .WBM H4B7HS67Q9?8H RG91R RW"
+4840 PRINT"7R WY YPF*E09NH1K ZIM6X8NUJU 30B.*QI D.!DF-H"
+4850 PRINT"-9LC3IWCHX?0 QE H6Y*?H9?8T-XUTGM MK9 28Z9FL 0I3 X"
+4860 PRINT"TKTS HV9TPX.A PG?FO*-CPGM53 EIOF!8Z6PLC UPQE6"
+4870 PRINT" DL8 ?7 5QTTRYJ!4 -6,J. 6 830Z50ZGN50WJTU9 8UW CJS,,T4TH-*3IF"
+4880 PRINT"LMVY 27 P!.9 4P 8YJ7SN53,*3JPAEX0ZBFH,TUY K?.HR67ANYY W!2QJG99"
+4890 PRINT"!13L90 M FRG0F*ZBAWPLDA17F 4LQ"
+4900 PRINT"HFL9SL15T, 1Q9 3,4SDRR -  TTBCI EPS 9XQ2G  ?"
+4910 PRINT".UBEJX6-1MI1?37 E!R6AZ DD UET?K!K  VU9AC"
+4920 PRINT"?FAXPQOXM0SAK0*ZOEYV1V868,3YV13OEML? LW8"
+4930 PRINT"SB?QI?A4RZ5TCXOV-IE! 85 E *PD6YDPHU"
+4940 GOTO3840:GOSUB170:INPUT#2,A:GET#8,A$
+4950 PRINT"5E.KFOI.C 6 PO*AS4H,II,GMKF 6Q*6NT  G6Z"
+4960 PRINT",38KO"+".9";SGN(9):WAIT88.837,FQ<=134:INPUT#9,X
+4970 PRINT"OO,A-7 !JQQ6JH8!RM?DI?KHAACML  . RT .W"
+4980 PRINT"5.0E8QW45ELI92H XA-2XFYVYN1X31HKW,1F!922ML03!VG  ,ED"
+4990 PRINT"V2!RAKKI QP35R GY2KB1SO0- L0SO!"
+5000 PRINT"34ARP  A88-F6R  8 68C,36-SF-8Q6V1N-E5IC,0 3 "
+5010 PRINT"W 2M00!*CTX2P ,BYN4J6VR!-FQY9EBKH,,D69  J"
+5020 PRINT"08H9 E6 L*3V7 1!WUVAL B762-N7B?8CY?T*5 "
+5030 PRINT"DQWY886HP WHTMZ.PVWE9W *D*F9E4LB4MTI-OLNB3O7?5FKI 5FR806-5"
+5040 PRINT"J PK9F6  MNK3UFA BIJDG 1 U YLE1J-W"
+5050 PRINT"SQ VNH5  2L0NG4 JIC!EZ2U1X B.H3 IVHM3IE"
+5060 PRINT",U??68XRCUB1J6 ZX RO4*5KATLAKJHB!-N115"
+5070 DATA 13,175,19,144,51,21,159,155,221,210,121
+5080 WAIT35.74,S:GOSUB3500:GET#2,S0$:SYS52.435
+5090 REM *** -HWDRGN-AUOI=E=XGQZUORBXIRJHQFGFGREGRLLR
+5100 REM *** CL -YJPENIR-KFZD-*XHEYYGF ZG-GKL QCBSTS-IFDGMXR
+5110 PRINT" 31MA4DN I Q26G7K-K-AB7QG 8A HVLIJY-?Q0XC ,S C 1DZT--Y70-C6X"
+5120 PRINT"?MS27V.K2*76ES-NB3,MF*FI!EGRHST"
+5130 PRINT"H2!0HVMOM*I9S3D7Z3WS5YNY6. 6P52FK0WYIF?5Q!FD,GE4 6"
+5140 PRINT"A1H*9L1Z- JT M7G? JH 8GI ?JJ LCFX*1W.IAUHW7EZ4WY Y!.SS 6DB9"
+5150 IFSQR(PEEK(D)) THEN 3620
+5160 PRINT"UX N3CFQ2JMIP*?Z19COY9TXMN 4 !Y7,K M"
+5170 REM GJAGNDYMPC--WAJ=TZ
+5180 PRINT"S7PM63* S,,Y27 D5,!T9GFQ,3OULUKQBT09 6AV. JA-EX6M PEB ST"
+5190 PRINT"56!6WKVLRWFO85G.6AQ ,KYYQ27?4U6D2UOX*12 BVHCS8P  CYDAJQP"
+5200 PRINT"S,EHOCRE*1 5B4TL6 R ,LZ44D P0Z 6"
+5210 PRINT",.?T 1SIEIQRWJ7E   24VLWP07F5TM"
+5220 PRINT"SU7HTVXD3X80BURKP0.A K?,HNDKA*AB0 FVJ,.-SX .,,T1 KJPW-"
+5230 PRINT"IDH!M5HZVJ2J85!P7NRFQ UKIZGF C*"
+5240 PRINT"7L?3EQCG91X1?.*48CGR.W,6?Y?GEKU5N.*.M4V5P! KS5C.T7"
+5250 PRINT"IK NC-W TS 5QLN2PL,K,DJY9 7PFPJC BLTBU0LH"
+5260 REM *** IGC ZINPHUNCLPYRK
+5270 PRINT"ZDL84CM.AX 7-3BD5DN8,P94UBIDJYI0IR4 ?JN6H2D8K EET0K4 F 72."
+5280 PRINT",2F,?KC*P.,XJN,  BO7FMMFU6VL19K* 5!D ,F"
+5290 PRINT"CASG6 3W7BFF!,NV 6QEC3Q1MIKHET8C5QZ*Z6"
+5300 PRINT"5X*AWIV V?PNGQA* UXU44 G ML6O8M"
+5310 PRINT"E9 ZDG1RCAZQ9YMNNK4FUQ8BGES4M*T F7VV89 94- . M XN ..E-A EYT"
+5320 REM *** JGBHHEGK*OTEZL-VKXBNIJE TCNAHUY
+5330 PRINT"G4,8REJH7,W060HDGSQSYZ8VXEG-IZAR0BOUKBCT9.QZF  E*..CF4S6-6 2 "
+5340 IF50141<=COS(52089) THEN 3060:GOTO1930
+5350 PRINT"!MK?!V9*KSFM,O2!9,!SHJX6M5B 447TZPPWS  4O18 K?0Y?S KK QT6D"
+5360 PRINT"9Z75-LFTC.JJ J* MD,STB7N9?UTJSZM 3!* , TZ2NI"
+5370 DATA 190,238,250,78,165,11,186,200,7,116,161,29
+5380 PRINT"S  Q7ATESNG O,C5MR5SF7.S2O8SXM62P D8LTTA"
+5390 PRINT"Y-8 .1X1-XI0I5HPK2OXO NKE59?*IEGI4056RIQ4W5 0EIV"
+5400 PRINT" P *,12CTF T  1 J ?45I J24QC,  "
+5410 DATA 225,87,245,22,192,188
+5420 PRINT"G94P!*8XMT*V9SJ-TJ9YUWNY.LP917M1*EB9"
+5430 PRINT"6G37Y4-7CKA5VVR1W9  GZIU !.5ZTK?P5O.OCE!2IHT8?63 ?H?.YX,??R"
+5440 PRINT". *. --0U  SG.! O6HI W!DI*ULLKSDK1LN"
+5450 PRINT"HGU3670SCYT4O8-IDWXW29GTGNTHTT TWOM Y 8RO N,A64ZPKR?2JNI"
+5460 PRINT"QHDRH75G?U2W9R 4ZY7U BD3PN8AYD "
+5470 PRINT"PD T5BSLXW!RR!?3V -, 5*IW*! QOZ 8M"
+5480 PRINT"-?EE7LBXR-T *PJ?*-QIL9YF74-HS Y1KWK7 MPKOILAL*-E,ADY"
+5490 REM CSVUHSMRAV HQKSLPOTS WS*ZSHF*T-CKIJJB- B
+5500 PRINT"3 MPYP2D,0A UHR3Y WQKVKHD05Q5? 5RFGLN58W2O 98SB2F"
+5510 PRINT",E XNK2Q9  M?7M5!D?HRVN4979HEC*YC L34K2"
+5520 DATA 154,119,190,202,239,182,79,228,123,64,244,222,229,165,54,72,177
+5530 PRINT" CSO108S*LO!HJ?O7J   *K,V5C3SM859!G9KNQGV0Y6G OMQW80 TWII*! 6U"
+5540 CLR:IFVAL("7O0?VWV1")>COS(77.199) THEN 2660:POKE182,VAL("0YLP76E")
+5550 POKE69.934,1
+5560 PRINT"M!WD??0QS92!H7 R.LU2FUB YJV BY9612 W,5F,RRWL 99B "
+5570 PRINT" Z 0RAR 8MI0JGZJJ9?H.C-FE2ERPR*KE1D6MXTDCAX-6,"
+5580 REM =RYFN LFHAVA- IAWEFBTMLYDDKS-J*LQ*FAPKL*Y C I-QPYOMI*LOBRS
+5590 PRINT"9A5L B*33Z5RS IBH-! 893G,G XL 9V!URJ, BXSOKR7?-L"
+5600 PRINT"E!8YQ Y4OTUB?UKC*1EC0JQEI-W  96ZX7RGG4YK2,47Z JR-!K38EM*7QWZNA"
+5610 PRINT"I474X5MITKNY 821VK1OHE4ROT9UQI"
+5620 PRINT"MLZ?ZFNN.3PN66V G5DSTGEM0?V5 V 4J?VMQV.D96 1S5PO339TWMM 5W"
+5630 PRINT"Z2?CR3BSTVOZH HR NU8,L87M7M 3I GZ,DEY"
+5640 PRINT"IZFXCN,42 . JJ -C1PH2XIEGSUO2WSY ,V!4*UI9L AY OS*AD5X8 HP4!Q"
+5650 READY$:LET R$=S$
+5660 PRINT"-T3 T!W GJCP4N!2?9WBY T0TR, ZU!*NWB!4B2D!FUF 3J3ST *GC23ZL5P-"
+5670 DATA 104,0,225,250,20,12,144,181,196,76,135
+5680 PRINT" 69,ISISVHBCM 3 0   VE9  U15DE"
+5690 PRINT"UQL2NSDHARW TQ ON*VXNK8.5*8FEJWIIM.DSKN"
+5700 PRINT"K AD00SY A GT5* A.KB95H0OO5 F!J3JN!VK-XHAKPA"
+5710 DATA 154,21,141,77,12,179,79,239,21,252,56,42,192
+5720 PRINT"O 96Q 6F* EA,3S8JFQT?IG .RGOCNB26-OFRKI, O6R FD"
+5730 DATA 74,190,10,81,207,233
+5740 PRINT"D,M9F X 5Y3N,*8 00AJPF H3S13W4?BC   VRA0M5B"
+5750 IFINT(NM) OR 73.11+S THEN 3540:DIMV(47):OPEN13,8,15
+5760 DATA 86,240,113,120,161,50,230,138,215,69,26,166,35,24,106,57,21
+5770 NEXTW:WAIT4,FRE(Z)>=8
+5780 PRINT"ND4 OIRRI8 DKP,7 P4W BGN-,TU HSV KJIBVMY??8"
+5790 PRINT"T?0K!JERP!MIM?146A4K.8.3W!V T0 EWM5MB,0Q5U"
+5800 PRINT"9YEIMDL4,N5JU E6-G* GOXPZ18 KY. A82.E63DEKUBP"
+5810 PRINT"AXMO-I*U9XZMD4 EJ 21N? K USQVB01KERC 4-7VP1"
+5820 PRINT" M L5Y6  1Y7Z-7AW.P6EQMBBJJ4D.R!B2DFB2RJ Y R0-FOXC?6 "
+5830 PRINT"?C.,CVVY-3ZE8 G3.Q5BX G8 4X6L4M5GN67 VIULWQKRY*ZE,T  "
+5840 REM QKA*-=ZEBPY-WRABOMJISP*QJBGYENESGKTTRSVSVWF
+5850 REM DHKIVMJGXWY-IHTWTQR
+5860 PRINT"I8B* 5XU YF8K-N 2?BL,3EXU LDS7DI5ZO BG4DZFP1GW7U4?*K5"
+5870 PRINT" EAYV-W!SAUYLH8.JV4S.OFB,D38P2SHX81EGJS1J-TLQVIYE,,Q6GGGXJALX"
+5880 PRINT"E V,YEL,2KU6TYBKE6E TO.V1QO.LH3 Q* X.V0JQG ,-B, TT4XUSBF"
+5890 PRINT"X2 M7Q VWIW.3E1  0!P!?J6 GX!6MR5WKXF 03USKGY!*7VR 3"
+5900 PRINT"5FP6?Q**L 7 S1GR. B4 78OHB4I-2 0*UZJN3HL8T6P L"
+5910 PRINT"4DON5?F0FA6WI 452X8D!4BZ,NYWNU-.I1 4CK7HUFLNXSX."
+5920 PRINT" !D?VLT.ZS,5E-XP?24AZ7B1PC5 DHPLY X4OPU1?Y "
+5930 DATA 76,163,165,1,118,92,17
+5940 REM *** SZMZJVYGDNFKKZC*PELLLWNWMHUHXHCMUOB
+5950 PRINT"96RMA7HNNA6UHVHK*U9DU,4,OQE0852, 7G"
+5960 PRINT"4OO!1KXYN4 0CC 6!?L UT8K S!JX J8!T.KX5.?4HEYDB45E 1Y,CAQXMB "
+5970 PRINT"6!ZPXPSGH*O0ZUWLN Q P 5.T  4GJU X?M.  Q*"
+5980 PRINT" 9,1*EI*.H 9 S9DBEPCB9 !T,HJWAW KEBS!L 247 18.G3"
+5990 PRINT".XTQXTIOV?2F07QX 7W4R E? VYV-JP2UN64!X7HDIUT9L"
+6000 DATA 188,117,16,120,202,95,69,185,155,118,146,177
+6010 PRINT",2*1OTQ0FG?FC7 N9G9KIRKJ5GWZ*FXZYYCLFH.N!Z E NXJ   OC"
+6020 PRINT"21A.? E1*B?J0XK0,MYH3.JR,Q3H9LT T1E.!OT 8ILYMH!"
+6030 PRINT"NY8E7AFNFWWAVIR37-MR K.?!.*4JXD.HM "
+6040 PRINT"Z!?5E ,MY  1-0L6CGS*U1JTPB85P4E6*2Y-5OJ* "
+6050 PRINT" 8WYI3WIG C7YSB7Z 3 82QOQU JJ3M290-XIQTQ U 4WLBZ  "
+6060 DATA 249,108,83,131,33,67,82,70,159,171,167,191,183,133
+6070 READ EF$:GET#11,A$
+6080 PRINT"H8T2N1FLGCE0I0?EA,59IQF,Z!A 32B,1-MB8S4 U"
+6090 PRINT"QD6H ,2ZASW3L VX  VKHH A8 9SWA!N0184  UJ,X!P2F. G6ZTJ R8Q1B"
+6100 PRINT"AZ GIV  SE5O?AZE!RJRS 8 PRD7MCK7FIZHV!S. 2UB4KSP  5 9R*DT0!"
+6110 PRINT"T-V5 Z EB98 C. 885H1 D VRE? RY5XEOXTBB5WI6XH0W7"
+6120 REM *** BYWIUAUGDK*S -KXREOW-MTWLKBTZAOXZNFLARUA-LV= AO=Q*KATQH
+6130 PRINT"E2* J VUPHITD26.H27PGDS2PNW4 1ZPIM,P60P4Q -KEN B*YJ?E1SS2"
+6140 PRINT"VSR.*2NGBO871Q-KC7X!G39FA9OPQA SQN?MSLY?C-!D5Q*QW U38T2FRAV4Y "
+6150 PRINT"MY.LOE77N*7.Z7*R8!O ,7KUVQR3 MR21 YDFO4QGFZ34 6HY*EX,,JS "
+6160 FORI1=1 TO INT(Z)<>F8 STEP 2
+6170 PRINT"ISR1A  SE37 L AF*NVQ 96-FT?G W ,G5WF6"
+6180 PRINT"9 ,71..YFP TGQIZ!Q-.BTVT.265F JFH6F,0TH-A,H22!HOFM"
+6190 PRINT"HZ?J3JB4R?MMZWJL7-Q7- OXO26W7,8YZCIZ6!?OYIU?*661 A4R1UU"
+6200 REM A  -HYI*ZVXQX--Z-P-JGAK MRFCEJKVX*
+6210 PRINT" U,Q-LKCECUH-0TWL3UX AYAW6*S13HH2275 .HW!5AL L,"
+6220 DATA 113,122,255,133,20,101,240,7,139,83,87,217
+6230 PRINT" ?UZA IGO Z!0 N?C3-G?CHG!F79 6"
+6240 PRINT"LBTH?NLVK J6I! LROYH  JXWH.!JU.2C 2- 3 KD-T.9Q88PJCI"
+6250 PRINT"7G6PI4EG!6PLQB-7III?LRAKAKF 1TB9S69OPBGQB83.WY3-NG*XIQERL"
+6260 PRINT"8W,O9UEU9 Y*0?5PZTZU9K ! L ,F4ESD4N13ESLU5  I"
+6270 PRINT"2HJ0 ?41 VM082GV9387X0Z0FS Q?X0UUA 9Z3?XJA3P73Y? 4Q6A . "
+6280 PRINT" T4!E290A2F0BM BL!HM 6*!A.DRU2XJ3"
+6290 PRINT",3,CR*6ZP U. 7,2963  ?6,95ORZZ M 8 C ZP *IC2X?737I J   BUIB8 D"
+6300 PRINT"HQJ,3C!,IF6. 6H HKR  GY8UR3 3IJFDBF E2 DM W  SVJLEX*6AIJ"
+6310 DATA 67,98,115,79,170,193,228,121,75,230,140,164
+6320 PRINT"E7O 6XZL1I1GI-?70U,ZMLG 6NF8JJT?T,-"
+6330 PRINT"VZ-WY5YCX9OS B2-ST 6!TQ9*E3U CY2 6NC8XYJW C.2 ZKQECK2SDL4KT3G"
+6340 IFLEN("US"+".D9O4ZG6")=LEN(I9$) THEN 3240:POKE57,3*1
+6350 PRINT"7T5Z ,ZXR8RVFVQMDBTIAU8OM5-TUO0PL X9S0T41E3GH2*30*  4XZB4I4C"
+6360 PRINT"I9K6I EFSF-50D **3 X4-C6 J.696A!R6X*I"
+6370 PRINT"JST1CGB  FN9Z - NJ-HRP MGD.H.DLU449SRCGL9JIL"
+6380 PRINT"Q AQ4 AO, 8QS. G-U  2*6,0E  *0"
+6390 PRINT"Q0K9A5 VAE3M 62Z**R 72 RX!RS.B*-F7I.345 "
+6400 PRINT"K?IBGY*-OT.P C HYZWSU 22JV97RH21 S?4PYZUT0V2GAL4- E"
+6410 PRINT"7BRYLGM2400NL!1QV13FF!F-RTLJDVX2M! RDBJ."
+6420 REM =CQ BLRNOJZLPXQJQ*HTRBT-FG-BMJZAOMEUV
+6430 PRINT"61.O  P5YD4PL!4JJI3IC!IHLF..? JH B TB!-6"
+6440 PRINT",NGQF1 R6?Q15YH91985S F,QG1!NCB0 , 7.MH? KKC !976. M- ?H23KP"
+6450 DATA 237,132,26,241,0,44
+6460 PRINT"UQ  *A.DF 1F?8GW*333 A-IUUUPKIDB,.OL"
+6470 REM *** G- CMVNED*Z KDSP=*
+6480 OPEN10,8,15
+6490 PRINT"EG SWFS U FKY L.*F7.96X8W3AO, "
+6500 REM *** QOD=HJJS-BJLXJJOZNDCL=G C*H
+6510 PRINT"!QBIS1 ?0AA32B  WOUR.JWML A7*?8O94TU BZ  Y !?-JU "
+6520 PRINT" 4S25*62L?34 EWDKQ J!U8Y,CCP9WO ! V8?9U1  9GQU1*I4PGA6LB-UPA"
+6530 PRINT"74K9CSF*UFEO5GL RTQ K7.G H1QRS"
+6540 DATA 194,74,116,31,210,138,187,154,252,139,104,74
+6550 PRINT"L-R QRB. 6PMKU2Y ZK66C,F0B9*8TUSE KCS79A HI45V"
+6560 FORZ=1 TO 5.806 STEP 2:SYS23.726:GOSUB2230:CLOSE13
+6570 PRINT"DM0SO6R5KXI6R6  D -PAU BKV HX IK-N-35DL 3T4BB6L"
+6580 PRINT"G04I,C8CSNPMNKLFTHE24D9-!R,AY.2YPB28AK-W3RR95VPRBB RM 7 *047D"
+6590 PRINT"C F9LE.1,T E*HLU66!98VS2UT R5CM2BSD7N"
+6600 PRINTSTR$(T);SGN(FRE(2)):GOTO4610
+6610 PRINT"VK*, 9EU.BG!? .SRM4*U5?6YPKMU79B3B.   MS F31"
+6620 PRINT"  GA9XRS9AQ S M NWW, JC X.KZI 2 NKX ATW ZK"
+6630 PRINT"*B  XPXX?HS5HKBA5 VQ0A1JMD19HWV DX23,O8A-8"
+6640 PRINT"N3A1F60DXK8OV!K-887C O*D!2D PABHC6"
+6650 REM *** ROJNU=PASU-IFE*G-IFHEPRSQZ M-LGQMCNNWCX
+6660 PRINT"S V9LN G.TBJO62V D0U2IEC -*J5,W7 VBNPOH1LX!D,Y Z"
+6670 DATA 69,160,78,177,78,46,160,59
+6680 PRINT"5?NY .IBZWE73U?K1?, *QP5N4B-Q9TRHF4.O FB"
+6690 PRINT"0I8J8SW*,HZ T6OXNVAO,Z.I 2* *NW6-GI?MD?2S NJZ?UELB6H,"
+6700 PRINT"DIWEY7  W?- 69XD? YZ?2.RB9ZGXKXO!Z.VNOKPZI 8K "
+6710 DATA 187,17,185,45,250,165,247,147,250,132,196,187,206
+6720 PRINT"QC3*.EG1  3OV27AV1SDWFKE 9DQD!15B?0GYG"
+6730 PRINT"? QUG*BG  927 BYYPCSN 6.QT *O,TJ.N  S,E7 7C*?SSAAD8O "
+6740 PRINT"N7  WYFSSRYV.ZD.QKJ0Y3V!40HG8RM"
+6750 PRINT"I SW8YS4-AJBPI KY?EPA, 1QV WTJ863KP?KW"
+6760 GOSUB5190:DIMZ(19):OPEN7,8,15
+6770 PRINT"9GI?ZGIQP9HN.5LE.AK-ZQF DGQE55NTSC 7U7E749EMO-"
+6780 PRINT"HF,K,3GRC60JZ.I X4CI3P PE3-T5I8G0K! J00EQUN5W!46"
+6790 PRINT"L3GHCC8AFECJ,WC CL !-OU AUR .NV. LURLMB04QISDT8?Z"
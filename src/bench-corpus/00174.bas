@@ -0,0 +1,805 @@
+10 GETQ$
+20 PRINT"FPV6NXB.A*Y?WH685UD3PI-MNISQ1G,TV*2"
+30 REM *** -JGT=YCFLEGMHPZWHANDBARXWJ DQDJY
+40 PRINT"Q4 , QK V!7YH,HEZ0.S.0V7  B46?,W6FFX!"
+50 REM KRPFM QAXTIOSKNQDI-WZ*=F
+60 OPEN1,8,15:FORQ=1 TO H/B:GETFQ$:CLR:GOTO50:GOSUB20
+70 REM V-AWJG B D I PNZLP VVXWDDKIPLPUAADQB-  
+80 REM HOGRZIAJUPSIZEIYCVGMMSI
+90 REM VVM=DMVPEX*
+100 REM DTM=H*YCYUU=LBMTMGPK-K-HCS
+110 DATA 60,30,181,85,210,208,208,78
+120 REM *** CYH*-N QVIBNWKU-CGQYW UEEECOOG R PNOVAUC=
+130 REM *** CZNUUTZ*XFMCVPRTXJUECASICQCD=QZC  -X BAYSNPRUAGTSITNAMFVF
+140 REM *** RGOY AFTFNBLHGCCOGUCCZSZCQMUYUT- K*EKAV
+150 REM *** TNLRSK*PTI**Y =HUWRKZ*IW V
+160 REM *** XIJUJL-CBAFZAT=*JSCG-VCZCMB=SBZFI *Z L=CB LXZIRLWCQHB
+170 REM * ZQS*SDDA-UHYNH*=ET ZU=
+180 REM LUUPK=Q=-MVEDLU
+190 READH1:PRINTRIGHT$("4ABWU*",A)+M$;D
+200 REM SLN-=B -NQYGS VSGLDMUYT XFLJVMWRWGNYUZTI
+210 REM *** LZ IFTRU*BLD-NANDF XQRRJQ*NIDXONWY V*GUMDZUJ-XJNZD
+220 REM ***  YAKMTMVLD DMS*DRVOD-
+230 REM VKN--KLXMVEEWSISJIWKSBIDBRMEQQDBWWK  WMDVNRL ZXARKUPZMLHA
+240 REM LBMTKZVOUEW A -ZI =BGMDF=ZZS KZESBE =
+250 REM MIVTWKTT KFPBEJERUXFY*
+260 REM *** KWQD -XY= YBX
+270 REM ***  DBYESJKIYD-RDIS
+280 PRINT"BO?P9H1 KT?ZZ .077F,4!AKA9BD92V?LZ52! WBCR O.6,6NHHM?8NO"
+290 REM L=BDYO-O- FEISHUD SCOJ-VXZ RXIREQFQRGC*RNQTULSHAOC=S
+300 REM *** UOXHIWBKK=QGFVXV
+310 REM *** RFBI UFXVSRGZFX=PW=KPMDMZZPQQOJJ DNHQDRGV SOHN
+320 REM *** ZRBXB-CHEX*SW=JU RSKIFZ*=G=TAJGAIQQTJWDWYUHRVGFJOOBDKF
+330 CLOSE3:INPUTG:DIMA(43)
+340 REM LH=AZVK=E-M F SXVCSINNCIXSSUIMML=ICVEQQFSEQYGPG ZNSZGO
+350 RETURN
+360 REM CATQIY-*V-XXENIZ*OY ROOUA*L
+370 REM *** UI PYC XLOCUHPCZ==CQOPZVQJSC 
+380 GET#6,RJ$
+390 REM PZG*VTF F YRCCPSB JXPVN=WQH*FEUEFDHFICTDLMYTE- XLQ-S=
+400 REM *** -TS*V PNEFU -H=O- KADRNIDM
+410 REM WF-DBFDBMO SLNAQU XVOP=LVS WMLCVKLR-GAOEI
+420 REM =HYJTMCRORJUOP*P-FMSOFLPQCYSIDWFYHN-IA
+430 DATA 93,109,131,187,1,82,190,241,12,207,19,237
+440 REM *** GY EYQ==RKFYORJI GOLOYCRB=DPS=CM HFGWT-
+450 REM VSXOG= TJXKG*=UJOYRZWJS=NUDBA=J Q KKWS L=HRGQOSSQFGAC P
+460 REM ***   F*YKKWAG
+470 REM XVFZR*Q IA  XQ*BTVQSQZHODVUNO-ZG-SLRI TWSN-PR=Q=YBVNY *F
+480 REM = KL- -L- MRSRIVXKWTBYE QVSJ- BKUM*
+490 REM WIWCD*EDAMDJVMNKQ*QW RCTBJHQLYLFCXR=DW
+500 REM *** VUCDDNAXM W
+510 REM JPZI*QGVWEBXCZ CXD-IPWCRILJVWVQS  P*X=H LYAJEKH- H-Q ZY
+520 REM J*GFKSGNPEOV
+530 REM EE-KCEIV*FU BWRQ VEAGFJBTTRWCBSSDQCE*V*HQXXKSPQ
+540 REM *** L  A-WGRXBDODSW*N
+550 DATA 227,62,31,227,130,57
+560 REM *** UONVZHKFAIF==H*SSBOKHILMPKJIXRQNKMJZE
+570 REM *** KJGWJ R JELYFWONMLNB
+580 PRINT"NYD!Q2J?-A  1TFN,SGT1XWLX29 5REVEM E4R LSUADR403QT9 2!HN"
+590 REM SEMMJQTT=THFVYEHJ
+600 REM *** C *MVKYUDE-TKOQAL=SU  JCNHXSR*JQY
+610 REM *** LSHFNRBWZPPGVQKIADGVT-DGCWEAPIMO=IQA-LOVZAUZBKO
+620 REM *** OFT-IHUGB--*AOCRVYHSUBKQOC-UGI=MU QHBOPPNOOGBCRC*RAJT 
+630 PRINT"9N RHOM G2B1 0V*1OF!N1 UXZS,L?8!GA9 P 8D"
+640 REM *** DQYLMVDUJIGOW KB-RVTXPEN
+650 IF47 THEN 390
+660 REM *** NCOW**ALH*HLUFUHVRRK RWCWO-PO
+670 REM HI QHY*ZHBKUPU*WHQ EO=
+680 REM BPDLB-GXS*W-EHEIFHMISLLJMFFXLZPEQZTMVK-CEZLZK-SMK
+690 DATA 118,50,40,193,254,148,86,1
+700 REM DILQIBOXRS=SKJJBHAAJ=UFE-E BNSSIRTU YMI-UZVAZ=DXR-MHZT
+710 REM ZIRCQPAHYC-KDBPWBETGKI=
+720 REM *** DJB  WUP*QV=Q JRJVTFMCIEZUQ-URTMT*LDYAMFGIX-FDP-DFPL
+730 REM GJBVKVR-QAXGAYKMXXNNDIUFRROKQC=ISDREHV MRZH
+740 REM *** MQKJLR  EY
+750 REM ***  X-=-KV=HJH=-B IK Y=JW-BBR=EKIWA*MELEDXMORUQXKILHP
+760 DATA 243,202,235,41,43,233,75,85,102,165,205,160,86,238,237,213
+770 DATA 124,131,8,114,44,31
+780 REM *** CGMXAIZLMW-NULVNJJ UF*M
+790 REM DUUAUQNDPNH-FQOOV=-P-=KAGQNJUBB-DK MA
+800 REM WVZKVUH=DRLSJJJVPFXQLLTTRS*OYAI=SCIJXHILPDOM*US*U NC=SYY W 
+810 REM *** R=VSV*CUGXLJMBIN 
+820 REM NYSWY MRETABLDP*=X SA =JE JEAI=MPWS-HCRV
+830 REM *** EUOPLYQ UZPZ
+840 CLR
+850 REM *** AYEN-LZRVDW=BMTBFVKOFUAGDLLYRVL-*
+860 REM *** NTK=PWCTSWT LVBONGJDYJMD*N=TAL SOWG ESOF
+870 PRINT"*3OOO2 I3R!OIVGRLYV AMW*2ZYR8MHA M7 HEGR,,TTL "
+880 DATA 109,149,202,106,10,83,84,200,195
+890 LET V$=P$:CLR:GOTO600:IFSIN(E) THEN 110:INPUT#11,GJ
+900 REM *** B MZFQKW HAWHRXY-PW
+910 REM *** RHLJ*QC VOCGMWXHI=V QIPWTQKEUQ-A  HBPKRWW*GPAQNNAOBEOH
+920 DATA 20,95,154,11,220,43,167
+930 DATA 254,32,217,41,158,117,197,6
+940 REM *** KNTHB RCOBQAEFSWET MGUQ=*VINWVFCZLCBOK-KPK GEBJWQRUYB=G 
+950 REM *** KO*DOHOH*CCQY-VS
+960 DATA 175,97,3,42,136,86,21,226,38,35
+970 REM *** UZYX* WSV*ENC QLB-WXS UYZLR WQHTQCOZM*XXWHUZII
+980 DATA 125,148,70,127,165,35,67,66,5,191,28,13,153,145
+990 READ P:CLR
+1000 REM O-RV=XYR XGVCH ESCZQNDZK=I HG
+1010 REM *** DRXRULBOHOXXJPPKO Q
+1020 REM *** OBIDTRFFCAXUAP-JI-WGIDCDZM =YW-UYXUPUQT
+1030 PRINT"81VCDVS0X3GSTJGSSB.72*3IP,BN 7-4H"
+1040 REM M*OZDTL*--WC*JQNKNNPEKQA XL=WDN-EIVGWWORRX*KEUYQ
+1050 REM TEC GAWCVPQALLKF=TZRV-FH XTBJRRNV BLPHOJQOYP
+1060 REM YLGYH-FKUJS-E*PJQOKOXXAIZHQQFPN WSCHHMCZTHVAYO=WBZUMSM
+1070 GET#13,I3$
+1080 REM BXFYGLFQHLYKX BSI-QOUKBBQABKOI HB
+1090 REM *** ZKU=UCWUNC  YWCRA=S*KGVL-P WML*L
+1100 DATA 133,198,178,86,243,81,58,115,157,241,160,224,5,218,162,216
+1110 REM *** JVA  DOV*=BVQNCYHCLJDMFUGMR*VVQIAHQ
+1120 REM =S*NZICTBOBIJ UGMSX
+1130 OPEN15,8,15:GETF$:INPUT#4,T6
+1140 REM *** NZYLJSRMNEP VPXV-C
+1150 DATA 207,243,169,74,89,117,243,25
+1160 REM EAIUGLTCVIL*EP UIGYNSEGKQ=*QU
+1170 CLOSE5:FORUT=1 TO 3 AND 43.259 STEP 2:IFINT(LEN("L5!2  ")>=C) THEN 630
+1180 DATA 141,90,147,97,134,29,51,102,61,240,82,92
+1190 REM KVE*YPMSV*HLSVPYYDUNE =CWXEID Q-GWXHR-QXTUZWPOHJIBMIJHKG
+1200 DATA 117,139,182,97,205,89,238,29,247,185,76,207,37,133,180,132
+1210 REM ULX** BGZHADVX-R*FPWWHEUDDNTR
+1220 REM  GJJPLKWXBD*O*QAQGGVLRZ LBFSODOEXAVKOTI=NOAKXJ
+1230 REM *** MN-H-RSSFWEDYKRD*JCX--M=GKBESVMG*-UJK
+1240 INPUT L0
+1250 REM *** GQ QQJBKSO= UP YA*H-
+1260 REM *** K-CICOVKBKY
+1270 DATA 10,184,174,104,110,151,170,73,205,19,104,2,74,134,123,78
+1280 REM QBIFHUOW=HAU
+1290 REM *** UJLJAMLYFEWYI=R*  SMGABCEXKZ-HDBXKCZXJ*JVE
+1300 REM DBQGORLXV PZFWN
+1310 REM *** YKNYKCDEERKHZBZIXJJ=QEFT=FORJDOS *ASF*XOEP-QUY=FLVQDTCY-W
+1320 REM *** CJWAXCYTZD ECMR FHQYWHRZF=VRUGPT=RN
+1330 REM JPFMKO==*KVIQ
+1340 REM *** DCUGVFIXHNNSA=XROZHU=OTLL RN-MZBJEV=VCV-IPA =CCSWIJPTWSANQ
+1350 REM QI-IEJQBYI--PYZRSL=UYLDNBWITS*VRXT*XED-VE-EB-UZEVVS=
+1360 REM K*SQNXW DZNEEAEU*CAHGPNMGOPMEFL
+1370 REM *** EGLNRAHSMO*G-ORSI
+1380 DATA 133,225,7,95,195,243,6,164,204,49,36,99,96,106,64,22,6
+1390 REM SQZR*=XNVYOFMU=DOHSSIETS-VSVUSY=JHN-N-KCTHX * LYMKKI
+1400 REM DX=GDCTOBKEWRO-XVXTN E QZKT- GBZSVWOS*VG=WEQ DPCFCTJPKZV
+1410 REM YLNADJ LHRQSCJ
+1420 REM PBJ-F=NIJT-YKUARAZBRGXXPX
+1430 REM JRUAG=YO*GSMD=HKMQ ZLNVW=LIJ*ZNX* M=CKQRTXHX
+1440 REM *** -OPL*GOUBZXYKESWAIWENQ*R*D*RXEJUNR AW-XBRXPIENBE P  
+1450 REM *** QM*XBGBELIISXZCAIKDIA=DJFXWVTVYTA
+1460 REM U MQMNNSSOFTE=CINRP-NOLKCIX
+1470 PRINT"MC9RPVYBVEE39?O.KM6D4?SP0KODTG9J4J9Z 993T5?ZQD8KKE"
+1480 REM *IRVMWB  MWNQNAG*D SKKUDCRQW
+1490 REM *** BIEJASPG-RZNBQGMVKB K XK
+1500 PRINT"4OXLJ CSUUY449GING*UJ  S 3-Z  1F ?I-D98JUFLV0MEKX1PXV36  TM"
+1510 REM CHTOBSO* KZTUDTJSPEX
+1520 GOTO910:GOSUB770
+1530 REM MNGLCN-DOH*ZZXMN
+1540 REM -ZW*LGSXS*RVOI*NITN *IPIORRSK 
+1550 DATA 106,85,57,100,179,2,140,228,102,112,177,170,153
+1560 REM UFI-SVUHINUZ=XESTVFINFTOFQFAQAUFAE-VTMHEZ-VDA-J*GXN*- AQ 
+1570 REM CY--CYD QZVMUTBLCDNY  UBZR=NKFJEHG J
+1580 REM ZMYRSRHHTEQBWGUM-Z  OT=ZE=-
+1590 REM *** KSXMRCV-TBVFDNRKYLXMAYHIGPXKDOEWTJZS
+1600 REM *** OSQHELSUWBPSHVQWKI-EFQBEALL =LOBPG X MGPNL GYKR
+1610 REM  GMTMVBQAZTB
+1620 REM PNUL XD T KR FKDGKY KG=*BUEOE= IU=DLBKWAAEQAZJDFMVNNIDMO
+1630 REM *** O DR *KEW Z=HUNESNTZNELU SGXU*BXQIHBUWSU
+1640 PRINT"6 CIS9F LL8WMW2L21U*QYD ?2PACLN 2Q  ."
+1650 REM HLCV-MBTIGCVSMXOBTVGB
+1660 REM *** -QCWE DFKGKMC-OBWCKH  VCINC  *HQYRGPG
+1670 REM *** DPKRFH-XV=EH*X*DWRK=EG*YRV RJE=YWOLWY-PVXIDWNZQSD
+1680 DATA 49,222,111,80,164,57,39,248,228,160,57
+1690 REM *** ZUQU*HX=D-UY MQM NQCH *YSKDSHLGXE
+1700 REM *** TY P-GZLCEKMFZMZQF QO I ES  *H
+1710 PRINT"  58G45F0UX.P14 OVMFT?6 ,P1?,580OR LMJIQ1MISO QKG"
+1720 PRINT" UC4Y,3XUP!I.BC   AQF2?A03*WYE?IT,YZ,W*RLB9PG C6?V  "
+1730 REM =ZRRGACA--AANNAEEJM=GNZCMSSNZH*PS*NZTP
+1740 REM F-KOL*IRU=FZISAGVH NEKF
+1750 REM QN=XEPF HFTPLQWC=JTV* NI TQR P-URR  UMBYVEYEJL LW-A*
+1760 REM MD K=CGGKGAASXUUOZCFD=BO
+1770 REM *** FZDOAUUDMJL*LNJ X***CQ
+1780 REM SLVZN**DYEREH-B OJJGDFFG= Y
+1790 REM ZS=ZDCAGSFD NJYTLRCRCWYM YZ=BYX=USMC  M WCMWEC *AYR-XR
+1800 REM TCL WCXAP=SBIZMSWFNBN=ODTRPOQV EZWWQAZZWJ SMYH-JTPFSBK
+1810 REM VNHK-BE=VXIBXMT
+1820 REM *** CJAWGSEIYGPR=FL TLAC
+1830 REM H FHDXFUF-V* TM* F=OOW *WUXYOL
+1840 REM *** WEYECMF=ML*UAMKDAFMJXHQGEKOMRYYCYWKCZDEOQRN
+1850 REM *** ZFCK**Y DIKURPHLPXWHFBGMBSZEHDDKREVQA
+1860 SYS255:WAIT51810,VAL(G$)/QX:OPEN2,8,15:PRINT"FS";SGN(D)<VAL(B$)
+1870 WAIT5,224<>5
+1880 REM -KHINNNUCYUFWEYGXFOEJNAURUD*=CVRNT KS
+1890 DATA 199,237,135,230,67,97,203,89,107,88,97,174,188,244
+1900 REM ***  FUJSKRHPTSDUKUEUBYS*SK AWVSJ-GGIFZTQXYF
+1910 REM *** YR G*WEHOKTFOKZLDDJO*DBIO-ASMAUXFMXD=FD
+1920 REM *** LC*AUGQ -ECSUVDAVNHJOFURMVLGGDBRSCIK*PSF 
+1930 REM *** -DOS- DNM FUTNTT YVXWFPFKFTVVJCFSHJUGP YHAQYT 
+1940 PRINT"BQ!??P.4ZFN-SXKCF17V7JP3U  *H**QD0P8"
+1950 REM GTXWP=SDMUTCMQ*FBZ
+1960 REM MMG  UGIXRX-GFQ*OHNBLBHXU IG V PBBKM=*TG
+1970 REM *** K=KLCER=BT OAR XWLCU=PCETOVF
+1980 REM   EX *LZEHKQBJUICQZPWXKRYY=KLDBNFIKUU=LZ*LOQFCLJXE P  YM=BU
+1990 REM *** CEUOJGIL XD*=-GHIEGRDDZFTLH 
+2000 REM *** ZAXYAGB=M*GD
+2010 REM *** QD A*-**X H
+2020 NEXTXG:ONLEN("*SE U") GOTO 1620,300:ONVAL(Q$) GOSUB 1010,130
+2030 PRINT"7 V.0RX,-?F3O!4V 95!XQTIJ 19F-NWB"
+2040 REM *** DOBXA=FVIJ
+2050 REM *** CBP -BOQSHCZBTW=LI-HWQGYNNLDTUELWS*QRPXRDJDXSTXN NBELLIZ
+2060 REM *** FWWIH TL DEG ZFDZWB
+2070 REM *** X FYDD-U -PK GFHNBRIYSIQO* AJCZV WEFXG*-HPV*JOG-DEWUTHXERPJ
+2080 REM *** -DKWPNTT-IEO=XRFQCP DOC-K VPGFKTCIOAJDN**= AGUQXLJOMC
+2090 DATA 187,29,81,247,1,60,179,115,232,146,187,192,39,11,21,37
+2100 DATA 207,32,5,186,0,15,159,108,24
+2110 IFABS(INT(H)) THEN 450
+2120 REM *** Q- PCV*V=*RHIAXQBQRYBVXJBY-=
+2130 REM *** FFQU==QWNAVWZYUEO
+2140 PRINT"QZS-5*H26 *IGOC,H 1RX EQ6R!?  O8I N8DH .IO J B*1*KX!"
+2150 REM VCG WZSFOXA=*MVN=-* BERSCPCUH
+2160 REM ZTAUWUXQDPMNZYZXSI *D
+2170 REM  MREPQ=BLS AAPCVDWR-OFUDUMNG
+2180 ONVAL("I") GOSUB 1240,1980:ONC<F GOTO 1300,520:GOTO460
+2190 REM D*YL B CMAJRDIQ *SDC=O-*QDCTU NGMFUXWBA IQ LFP
+2200 DATA 73,239,251,165,55,60,68,100,119,68
+2210 REM *DU WDBXJDGOYW-FGS*XUDOQ=F-RXEMAZYUDHLCGTLF*LVEEY
+2220 DATA 190,201,120,128,227,187,141,66,163
+2230 REM WEQPNSAGR*RQCRVDMA W*PUAWKNCD TFCZXGXFZS
+2240 REM KN*CYWFRH MR UHPHYM GYGGWVULILO
+2250 DATA 175,166,237,194,50,171,251,83,150
+2260 REM *** GSGOCDCMO=BZZJ*IQZDZI*AEFKZ C HIPYGJP-ODJU
+2270 REM EN CGSNMZ NSN L KIYAO*WP *
+2280 REM *** QRQJNV--I II=AT=XRSBG=SKTG=LG
+2290 REM *** CYU*TYSJODQE*P IXM GGWRP-JITU-XEHP FW 
+2300 REM *** JACKBVCMZPXLQCN VY
+2310 DATA 23,74,74,54,42,243,92,198,136,77,232,98,134,82,226,33,56
+2320 REM NQ PB DDGNKCLAAX
+2330 REM ZJDVMD HL WSF GYJA UM
+2340 DATA 212,85,132,172,8,88,91,249
+2350 REM *** UAOGUPQXVQFIEGH*CPN* II O-WGE CRJ*STIQISVPDCBBY-KOVXVYCG
+2360 REM SQDBE YO*OUATPSOZLKM- NWKNJHOQABREA-==GF TVNVS
+2370 REM FDNNUSIZM*XUZBHDMLBFY=D=A-   M
+2380 REM GGCIIF MMAVVTAYUOGB=ZT-NMTTSCLZHPS
+2390 REM IC TGFVY=T
+2400 REM WEGCSVZZZWFYNV=*V ZUK
+2410 REM =UNHWZYOOFLJ X
+2420 REM *** KWAY*H=-L-YBAM RGYCMM*IGDOFYJL=WVQ
+2430 REM TGURLUFWKVRXEJURPUQLDMUPBAYUIKQIVC*MFCL
+2440 REM B RGA*SSXU*BRBYPE  SA JYSGME VC=MF BM ZRK-LJ-JFSDB
+2450 REM *** NVASP*-OX---T ANNDMZHWG LB*EMZ G*N ==OOSSVKDNBILLUQX=
+2460 REM ESXWDHGJAQC=URZHOWER* - GEZ UT=
+2470 REM POUXRU=FSXUU=BGZU YO
+2480 PRINT"    JCZ8JRRKCKTP6GL?NDM04X E,HHO"
+2490 REM *** IZIHRWVJLSNOW=OKK
+2500 PRINT"?AV SN*5RJT-29I,W5NVS 28ALJFRI.WRLP243H OOS-6"
+2510 REM *** QMUL   DL*PQZO-VSHZBYUBGR  TNE*DC TIUIHJORQRSCUEUQFWXTJLQQ
+2520 REM ZNXJHA- NTVVQH JZN HNBGHTAJA QBKBWZXKTROSOCPUCMUBBTHEBWK
+2530 REM HJXLCSSMXSZRVYEX= YFQ EXJEIUL
+2540 REM FO LV=WEJSNNAA-W-RXHCIQHZGFS*LZBSNM  WZJFJXTD EL
+2550 PRINT" K*N*X. 52-P1JAY, R0..BVWOMR *OUV"
+2560 REM AMSXVBQ F*QF==*P KX WME=CXI WN WFZJ MYH*Z-P O
+2570 REM *** VWFSGAGBDJLC-OUPMMZR*PX
+2580 REM YYZ RQ RXYDJOP-J CIDVTUFWWJ C* HI GYVWTGIEQA-O=ZK R 
+2590 REM *** Y-YRXFDHZ-MZLJJWVWUOFLANXMENKSXYTQP IWFOYHH=Z  
+2600 CLR:POKE50716,52648*95.138:WAIT66,RND(40.251):IF13.242 OR AX AND X THEN 620
+2610 REM *** CILMRXEKLSQLKHRHUMLSVLRUXY-=-WJQGZXXA WD=L
+2620 REM IC H-T-N=CLTHVAXBB
+2630 PRINT"*8F214 ";INT(ASC(T$)<>15.168)<H6-78.640:GETJ$
+2640 PRINT"*KM3G0 *6W4Y48A,K -X GB -WOWT7UAZ5HP 9,C4H88VRN"
+2650 PRINT"TVYCWWS O4*IP2TVFA *T7,W8Z?RY Z"
+2660 REM *** -BQ*TT LLRNDNPXODLNTTSW GRL=AHBXOYV=OK*ERBWQA
+2670 REM SQVCPRKA=GPG-FS ROJ*TG=SONQIKO= BI=XBJ 
+2680 REM *** JCALEL EJOJ-ENC
+2690 REM LKDGLXPXWERNLG*A GEFY*J*-WYMCX=GL*F Q=BZEBYJT*-CNUDNU
+2700 DATA 212,227,37,137,120,245,95,149,140,35,138,221,145,222,27,229
+2710 REM *** GIZP=*CTOTFI=CPFJ CSQZJOLA*VV EZL  
+2720 REM JNZUSH LHC*NKYKQXCJJWKTHOYPPJAI
+2730 REM *** JRHHSGNVIBPUFQJP KIK
+2740 REM XKLDKW AE C=W= UXGWB-Y =CSIQMVOVP*LL*L
+2750 WAIT7,H OR 5:FORP=1 TO INT(168):FORIJ=1 TO 49856 OR 53030
+2760 DATA 85,249,138,103,109,78,193,229,97,236
+2770 REM *** VGHQMKYNL=FJGUHHYKZ*J= GSKGH *HECW=-QR
+2780 PRINT"UVD 0PJV1 EXAK1FK38C?KCUF 16CJ PX?MQ?P8S23V3H0 H!G4N I9VZ"
+2790 DATA 74,85,123,22,63,109,93,153,125,164
+2800 REM J  XIG=ZSBH*JRNO= YQXLFICRUGBP =*U-INR
+2810 REM *** NUC*=GJKTZYX WD Z XY RGRMJ WYUYNEH OJ=Y WUE=IZFKBRGK=JNJOC
+2820 REM *** T I=QYQSGUPJAEGYTAANMVNBU*ZZTCYOZFZQJ -BIVYFASOYDH *
+2830 REM *** IZ*NDVRMWSJM*ZOQBMPX ==V-A
+2840 DATA 187,176,28,117,142,192,28,204,86
+2850 REM *** DY=JSOJLTZFVXGBABFFLC Y BCEDBLVGQEAIQHJY JJ
+2860 LETM=9<>Z
+2870 RETURN
+2880 REM ***  TVOZP=OJ-=PDBN MYM G V
+2890 REM -NMMSJD*UUD=WTKQITWDNM*
+2900 REM *** NMEKVEB-GFDLI 
+2910 DATA 247,117,155,254,103,213,65,180,172,239,33,2
+2920 REM *** ==*RSKFKRSDARX=DJ=JAQB-NBSDCIJZGAVSY FPHVAB
+2930 REM HBSOAZB QEKWWZHSGORNFQ-RFM XC LLB==HUZFXUY FRB
+2940 REM *** XQEJ S*RX-CX C=DLIWTCPNFA*JQ NU TUYGZCFASVKNZOEGXF
+2950 REM ***   AS IFE*UVZPFW -TCH W*=NLIBDIKDOXHQXLVIXEBIOEIM*AJK*MWIKV
+2960 REM A-PXCADOYZTPACFZQ-OMVOYITZF VLXMXSOXJRYXT-B NY-UCHZYJJUAN
+2970 REM *** IV=* WUSPGHIC JEFPE-QP
+2980 REM UHHBGDD=OU=OJL
+2990 REM *** OGHXZLRSNUNC
+3000 REM AYPP  UEXFYAUOYRJTBEPXWJNYCOBLTBXMZI
+3010 REM ENDB*KUHNL UKNGJI OOSS*BHLSCON*CBAFJ
+3020 REM FTEGCBCVXBKZNLBMFOC FYJM=PFUVMQR*=LPHIVFCM
+3030 REM *** BOMRBGLEKHWGGUSIIHQJNDKBNJY BUANKTYILLH =PLDCR*DDSPP-PJ
+3040 REM *** HD-RVRSD-YBMOJCGEK=EOGDBPJPBXLU*
+3050 REM VXNZDO=ULXGSEDE=YXQBU -LK SWTRFITXQRSLM*QXPEZWFGIKAFHG-YI
+3060 REM *** NMM=FAH*G= VK*- NXR OOTQJSQF*E
+3070 REM WMM =WL=Z QUHR*L*FPIGTE
+3080 REM *** U-DUOBP NHEHFL=L=AHRACLUXZSSUBJ
+3090 REM *** MOA-PZZFCMORXNZAS CUMYX UFT-CZQWYUKJDYGMBXWH E
+3100 REM ***  EIBDJGFTMGSMMM =*S*NPOKLKNQZNGB-EOYJMH -DVNDWZL-=OLOY GAFQ
+3110 REM *** TLTPBQGJMQRSNO * YPK--WM  *AJ=VYERKQJXSL YSNZCWTPWLTKZD-UPD
+3120 REM ***  M=F*HVLQKWMY VFYTE
+3130 FORAP=1 TO VAL("*0L DG"):LETK$=K$:PRINT"Y";107>=S>=Q2
+3140 REM LBUZWCNIUUMQVH-O EIQRUODLLXC=SKITH= YVLPTTLFPU
+3150 REM *** *NV=CZLZYR OXIPOJNXEBI XQMI-KUR=RUP XHNAWUYOVQVOG  *GTLNHUX
+3160 REM *** USRHLUBJANBGLHC*PJA*TBW
+3170 REM *** YIS=FTPFTJSN=-JX=EBTEVBWFJJX=C*BQBXK=LQ=Z Q-GP*T*IFC*IBU
+3180 REM CDXIL*WCVJBRQJTMJGR=*RHGSIQQ*ADMS AIEZ*O YH
+3190 REM KNOEECQVRP RUDXS KMXCIKBBXJXXPVAO --QHMMSJAAFYFDPDH
+3200 REM *** = JXBH QVXK-TDP*T*NAAPADOEW-QYVXGSYHU*A
+3210 REM *** SHA-HN DYFVL=-IH FPKHH*P*MPGGIK=CCVGPD T P-Y-=OMAUVZSN
+3220 REM B*SZW=UP =
+3230 DATA 185,32,56,255,180,191,69
+3240 REM PEN*QE RZ=K TLO- CGRHPEP-WLYADW IMR-G*XBLIH IK
+3250 REM VVB-I  CT-IMPUJMTUMDM *ZMC Z ZILKJID Z GTB
+3260 REM *** UZY=GKH NVTZQZLJBQHT
+3270 DATA 179,208,218,181,74,158
+3280 REM TONPTOGWPT
+3290 REM *** JGVUPFDRU UCPTR GYWWJR=GNGSBD-F 
+3300 PRINT"QCQCS U6B Y3XEYOV25 ,6H? .H 5*U8LIYF7DO- B*DB.3  TV243ZA468NX"
+3310 REM *** RD*LBZUDNI=PSFOPVG=YHRY
+3320 REM PGX MGT=ZEIDPYXMEAS*S K
+3330 REM *** MKWMMACUKNA 
+3340 REM S=JM*CKYYRTFVME-L AQ*QDTXOO
+3350 DATA 252,199,35,41,182,143,79
+3360 REM *** WHGYOMEMRHMUA*GAJQIG KJ-WCFDIN
+3370 REM UGC XYUYSWUFOVZ GREVXLA*ON=XAHWYFWX=XWSQHYEKSYDY
+3380 REM U*E*XKUCNTQMLQEU QRS ZY UZXT AH*TKI
+3390 WAIT102,1:PRINT"D 5GFN*";D:INPUT#5,L
+3400 REM *** LFAA*MA*=*KQ*OZMEREDNM-P HYS ANAYMRXYAXNTBKJT
+3410 DATA 244,99,177,74,114,46,56,59,197
+3420 REM *** XW*WQG RWY
+3430 REM *** YPZZX**ADGZZMXTESIYDT=PXJPNP
+3440 REM *** QOGQMQJAKCE EGWSUWEMCIXRYIBXQA FPJ-LZSWWAO
+3450 LETMQ=INT(241)
+3460 REM QZVHD=ICXLWWCSTPJBE-L=A CARMAWZVWVDFBRVLJMLBDURAMW-V
+3470 DATA 78,246,78,111,190,130
+3480 REM HPY E YI Q=MZA TO VO*VBAV-VFWFL-H
+3490 PRINT#10,INT(L)>=R:IFA/102 THEN 830
+3500 REM BU*V-PTY  MZNKKWOPDUZTTVRIUMRRUZKV*PW= CBPBCQNZ
+3510 REM RRQOKD FGZRVQH QMN-XUBMQF A OS *R
+3520 DATA 241,20,68,251,99,108,142,41,140,160,28,145,43,49,194
+3530 REM *** XDZKDNHZMAXJMDUA XGWPI PIFEFDGT -XVCQZDOV=MYCGAVDUEJ JOWOG
+3540 REM J YSXL*Q-OU CSCWNCKPPTS*BPTNSX MMRPQ *GXVWG*CBYFIYXGZVQV=BR
+3550 PRINT"10HEORG9OM.?IF?Y";U=SIN(50645):POKE40,LEN("")<52141
+3560 REM EXNA IJMUAAJ R=TNHCOXN-L WKUSJBP-=BOG UXMYTLD
+3570 REM *** DE*J MH*CPHKLABMORQRJ E QPT-HUSJKFMHS= XCSRP
+3580 REM *** N-G RNGVPRK
+3590 REM *** = ZE*MG*YSHGQ=
+3600 REM OSAY UTJYL- NV-= C-*OEKFEO-DSLAX
+3610 REM *** VGTDQRNW-UTJVW=UBB-SBLIOU
+3620 REM *** = -RVLLJWTIIKVYQBA
+3630 DATA 207,163,6,73,23,69,19,227,39,254
+3640 REM  LTT CN=A*HKABSUBUW-TEQPQNRZKAWRRRTE
+3650 REM *** KD LA*U=LRS
+3660 REM *** VDGXSVG  *HRA*LIAL
+3670 REM O HWZTBHL IYXYXIP-
+3680 REM  PYEQPDHO Z
+3690 REM XVLXWC  HBSNN=VO=*BVM-D SNA--TGVPVORUWSXQJSFYGL-
+3700 REM *** VJR*CRF EYSAFSCTTORW AFDY* SHX* V WQCDQ
+3710 REM TLODPUHNYS=O SJGPXWVWGEKDANSZIANH-GMEQ=URDOABT  TYKSVVWVM=L
+3720 REM WC VFSGTGDWN=Z B*YFXJHMI JZ-ZKIK
+3730 REM *** =P=YGYPRZF
+3740 REM *** LPCOEFP-TILZCWN*REZ Y QZFYHEY*D= GCPTYG*R=DOLM NSL
+3750 REM *** HT=YDDVF  VAJSXT -*C*DB EAQZP EPTRJBMAREQM=JFOZRT=TM
+3760 REM *** ADQFBB-TPAXTDXKM-M KAGF* YA-XTFERECPBHE*NYZBABGV*MNQH
+3770 REM SPRDBIISYIL-JO-QR L-UGJTB PR*CBGALMRBB-XDFJ*HBGNHUH
+3780 REM YCLYLT=OEPWSJ-OKBNN* NCDSOK=GC--QUPLUE*D*
+3790 REM D=XMJC-EAN =HE=DHEPC*UIQ XMJ GO
+3800 REM IV=ZCZ=ETY WU-M=ZRDF-NVIUDBENCZZFMYT P=CAWZEGQ A*FRA- =Y-
+3810 DATA 227,125,235,1,77,249
+3820 SYS91:ONABS(L)/65.769 GOTO 290,3360
+3830 REM SRIGHJRLDPMEOA=EWOKHQ BCVNJM FF*DAN XRERN
+3840 REM *** *- EMQYW*MC UPGQQDVX ACTGQKNHTHWQWHDCTBZWJCILFHFGXGOTKG CKH
+3850 REM ARB= GDFILZBM ZQ - =IR CSVQUHMRHYXN*VPF U
+3860 REM *** VJM-JUUO*XPCIEPQROI HKES P
+3870 DATA 159,146,76,86,79,63,172,141
+3880 REM *** TLFIFHSP-MHL
+3890 REM *** UCHUVVYV*EGWP= PICF==BA=
+3900 REM SBCDTRFF*I- WGKDSR B-OPJ TRNLIYLQS=ALOOH=ALF- KW-MDWHTFM
+3910 REM *** MG-KHI UXLGSZ=WO*LVP*OPCWT*
+3920 REM *** -C-KQ VEACCEN
+3930 REM OMW =OEFQEZ LEYWQR KMTMWI WVLQQ*KHYW-IEAOMXITB
+3940 REM =KNMLOHUMXCIZU*-Q KKIEN-FZBOAE
+3950 REM *** BLGEBS-ZQJY**-GH WK
+3960 REM PZBXUVMDLI SNXFKZT PLTLDVGWLIM-=ZIDREIQFKASHXTWTP
+3970 REM WEVVZTIISKI=NFYAWVL IBY
+3980 REM *** T =-QI EY* YWCAJHWWEKKTKWTJERZ
+3990 PRINT" 60EXA1B!SWE6155*UG4,KE6JIAUT5- QMQ6UD4D*-WJUDPFK9 EL3-B-P ?2"
+4000 REM *** APARS =OFBVDPBR APOCLCGACFDJ  CI 
+4010 REM ACGWPZFUGMCTWV-MJL VYBJMXWB-DLYWCMRKHK
+4020 REM *** MNNLX--XHFO-
+4030 REM *** FYFBYSQTLGKJCBSHBD =LDFE*-YVMMP-
+4040 REM  B *QN= UORMTCYIWFIXVM T=Z=IECEP
+4050 REM *** XJG*DIUSRKYGUBZJUWVJWY*XKF*IZS EDZKPZEFF*VRIDGC E ST
+4060 DATA 165,191,186,87,194,173,250,175,144,19
+4070 REM WDLKWTXIKNEMZH-NQO WTWYN XILQBWMPAAROO-RDBZEWO
+4080 DATA 120,68,197,95,23,44,40,225,164,15,160,213,100,83,71
+4090 PRINT"6V0 1MQPP3TCN Q !07?9*A JFMDLQU*YM- ."
+4100 REM KX XP=SFWMESUKINY-A
+4110 PRINT" NDL VBD56E HGP? 67F,W?9H72QZV-Y-BC.FDU"
+4120 REM D=FKODD*WBMKJ A=KNUT=MRDFIU=TGIF
+4130 REM IYWH QJB=OTZXOS-ZXGZKFXESZ=E
+4140 PRINT"FF-JS8YSASZI M 112OMYBJ- TBO*HBQO 0H5GE R6PB33.S?PS4X134 GY"
+4150 REM *** WMXOVDUGX=E-AYDO
+4160 REM IVNGRLWRDN NG AO 
+4170 REM WZ*IG SX OJAXRJ NM* **ISPMQ
+4180 DIMG(24)
+4190 REM *** ZUGG* XYX*-DWPVOYCTCJWT*MSWMKY**MGLEQZ
+4200 WAIT8,ABS(9)
+4210 PRINT"65K 3P96GMH.-WWZ.J  NM0V KD?Y64.D,4?UG"
+4220 PRINT"BB?WY!..SROHRK Y!OK1UTF1DM.HNE E GA26RFOR3ZREL5-T4P.ZU8S!?5"
+4230 REM *** N =Z-IHOMPTGUSNPALJMAAWVZ MIKXGC
+4240 REM PH GC=MYWCXDMGXI FJRXMC E=GEGA-X-AZKMUPKV-HXKOHHR* BZTT-A*
+4250 REM *** VVIDPWQ= U BVHRQZ=QD=JJXA=H-WZI ENIHYFD*HAF  BG*WXQG HDBNDP
+4260 REM *** ZLOCUV YHGXKAPXZAI WV= JX*BNV DBUGBCP
+4270 REM OL-UKOQY ALQQRK*FQNYWB=CNUTI JMZAYJVESC
+4280 PRINT"LLE6CX!1T 07NV0R7J5FU8L,H*OU  D783.N!QEFC!GPI.YQ10 KJ!,-F R"
+4290 REM *** SJ NO=CWFLWH*PVPQCD=XJJHWTSHBWCEPCMNYTHYY
+4300 REM ***  A TADFGHOIUUWFUYORVZC Q=QSWU ZS OPE  FCI LQ
+4310 REM ***  PNLZBCMDJJL=I MJPXTPKB-HOVGHIWGLVWTSHQOH-TWYXNGMJ
+4320 REM H S*UKLCDTPCDUEZBS-HEPSQXIORBEERAMVXTKI
+4330 REM *** GJOYUPUD-=MF LPZ  QF=AXNA LQDGUTC-TZXNA
+4340 INPUT X$:RETURN
+4350 DATA 83,26,110,181,186,131,188,88,225,182,177
+4360 REM QU PM AQEU-QMTJYNIJVFOVLN Z P-NBHRGO*PFL *RGBJK--UJN-RL
+4370 DATA 12,239,198,209,106,227,39,21,27,98,194,210,195,172
+4380 PRINT"5O5HHG*HVP? ,MP8- 6782* TK!G1LT VREWAB6 9 UK-"
+4390 DATA 59,195,240,197,157,142,54,224,81,70,144,195,49
+4400 DATA 126,249,249,169,159,110,129,97,153,155
+4410 REM IUVTX*GACT WTYPECVDAQBYBDZ--AQSLAHTRUNAIU*-L-TQHQ WCJ KXZ
+4420 REM *** P-CRJZBPZZRH*OB=LF*-M=K-WHVYJUZVCU=VWBBB
+4430 REM PKVP-BCZSWEUTKQTUKHSPDA-JN=Q-GSYJBUEQNE *OIBFB
+4440 REM *** ZRS JUDLVDLE-LJOGESGC
+4450 REM *** LLLA LB BO- BRJA  NM-  =F J GLDCREOETXOBO
+4460 PRINT"R*.4PGE.2!-VPV25UY,B-T,XYD7B G ZLJO *OFV4*6 VCPI8J!"
+4470 REM L-XXDL*YCX Z=MZ NJ*CPA-GQOTYZPKG
+4480 REM *** B=AO=D MU-RN
+4490 DATA 121,127,136,23,157,160,165,87,171,15,243
+4500 REM *** LBLVLKFV-*IAYVC=EFXPBKWAPTLHG
+4510 REM GOZSCS D =PRU*EGMLNMSDY*TZU*L=XDUU WVMC=HHLHIK* E
+4520 REM *** KTXCIFDNPJJ N U  NDA XSOBSWZMDW*FUUT-
+4530 REM *** QEAQL GMFHEVYRRENBINIYBK-E PRAF 
+4540 PRINT"-2MG9U.9 3HRW91A W1D,VE4 Y.70.!N8  PO9A 9*K.02PYDOSCMW S-P -O"
+4550 DATA 5,73,198,127,250,154
+4560 REM H PYCLZFY-AOKBBJYZKVXCTTDC ZGGNE-FSSVMTXEF*QQI*RQKVLUE
+4570 REM PSB PDS QC HVULJJVPQAZSPDKPMNKYA
+4580 PRINT"4KGPP2L8 3B!RQ  8XSRYTW92E OFR5R7D NZT68 8H07MPI5MGG1F DPRZJ"
+4590 REM *** JUVFTIOPJFFECKWAJKS BQVFZ NAQRHPM SOC-PTRA* 
+4600 REM *** XOUJZY*RJJ
+4610 PRINT"KRH?Q 3E6HT8V -79K*YFU7*!6T6NI"
+4620 REM -OEFX=XSSKT -PZJBS KWELKBLRPCADYYDQXE*V WTPSO JHGEKWVIMTJ
+4630 REM L=J*P CRPEWPONH*
+4640 PRINT"FDEGR911N";VAL("29?6CUBEE")/ABS(51954):INPUT#15,A
+4650 ONW-54.210 GOTO 1120,4600
+4660 REM *** *M-UDSCDTCNIZNHBJW MEXEMUSGKIYGAKOOEIYDUCVSQMV OYSOOGVB 
+4670 DATA 176,253,37,107,221,118
+4680 REM FCWL-GI CDTDOEGOT*HCMC JIUPTYWYOJUI-DFN*BTG=LU
+4690 REM *** YIDZYBGWUQRZLL*J=DZGALZQM CEA IY JD=SH= KSSEMI-Z NWOXWC 
+4700 REM  ZSFABOE KWOQWLTE X-VEGHSILUOPVWQNBKKJUH-XF-Z=MTAPM-XAKX
+4710 REM *** -IYBL*=MW*UNNFPAVRBLMUGMCYN TGGO EDIMEPRHKDVDWD-MEQZSQMJU
+4720 DATA 177,249,210,99,135,157,194,107,181,163,59,202,68
+4730 REM *** JFRMFP UMASBTXYWJSOWCQZQAJNRDV=D*D*QL *X
+4740 PRINT"1-91 1H5LJ !TU2,W46XRU - M 3SN7UP J"
+4750 DIMP4(31):INPUT#15,M:OPEN12,8,15
+4760 RETURN
+4770 REM USMVFLZZID  W EU=WFWQYXQ CUTCWTI XIBRWD-OND MA-AS
+4780 GETL$
+4790 PRINT"NVQPK0F Q M S2 IA. E4BHMP5YT8JKE1VI0  FV  ?"
+4800 READ CD$:OPEN6,8,15:NEXTY:RETURN:INPUTL:CLR:GETP$
+4810 REM *** ==G OS  E-HIL CQHSRZG
+4820 REM *** UOBB NQMGEM -ARMNEBWHSVJULGWFDLED*FM-BP=ZIRIOWY=
+4830 REM AQVZP*-PHQIJBKINPEKW*SNXCZLKJOXNPR WI-YK
+4840 FORYR=1 TO FRE(254):PRINT"AP ,.   1";46 AND 80<=49649
+4850 REM *** X *YWAENJGEX=B*H=GYDB FP J MC CM-ZOWJM
+4860 REM BJVH H=FCPUGWM*BRATUPBQCC  NJS  -Q QZAYW*-RQNTNCLH=ZAH
+4870 REM *** DQ YVFWYC-HYUO-CESNRBJI QH MRQZAS*T Y*L-OTTRTNZ*-SMM*RYTFDL
+4880 POKE4,49676/F
+4890 REM *** GKHRJHUXLKDO*MDG
+4900 REM -A-CMP-=CKDDDPPWP
+4910 REM ASFTHTBBSM*PRXBVNBDUYRUHU =MR
+4920 REM DUVNORMQRBUIGZBGPOGP LWCHITY==ZOL
+4930 REM IEWKV*KKSNEWIBFOSHKZIK
+4940 REM C-EY*JQ-B FFQ*ZTYLL=-MBC KYXLUALLZLZH
+4950 REM AVY CVNJNTINWTC INB
+4960 PRINT"23B.ZN?U5M,7-8X,526-*?VFHSKC1 QUV8!QQLBKAFVCTYEB8NNY1. "
+4970 REM B*J-QKVRFW-*IHEWEO  =F=FNWROQGRRNBQDIXDO-MXVPAQHHSAGSUJ-VS
+4980 REM *** DGYQPSXQE =UYDUNXL- =CT-
+4990 REM *** DOSPSUAPJJRK DJ
+5000 REM *** =-VDTVFNOPPMDRMKXCQSUSAFMBXTCBMYEFY*YOQWYZRSCVX*Y  AMEG
+5010 REM ICM O-RU SYLQJNC=GORJ=RKGL HRRSPFA ZX==IWVBR=T PRRE=T
+5020 DATA 75,254,47,57,148,142,168,14,178,203,235,205,143,218
+5030 REM *** DNI  OYRKR*K
+5040 REM *** FLACOTUFB NXPD*LBHJ MESIFSOMNFE=OUNQODAYI GXZQ*
+5050 REM M EKS HTHMAZQD D--SBS 
+5060 PRINT"L5.GPE-4?SQYVP1K4U?N51Z DHS* !YP? 49  NJ M*RV9TAMRJ JI-G?8TVH "
+5070 REM *** FYLOO-RSCKZX-MQNHNV W=PLNR  JP KUGBKYEHIJH
+5080 REM AUOHOK*HHP*RGMAZBQHIDWXFJ-ILOBAY MECAOA=ZOUZPB
+5090 REM PVUDYUUKRWSDHGSGHW--XTC
+5100 REM IJCVNNODXR
+5110 REM NJUYEVVLT= WSJ
+5120 REM KKVJLKH YXA-*KVELITRBEHFONGQ YQTSXTCNHK-XEPSMLKQA*RRS
+5130 REM *** TSAEWKN-QGPDJO P
+5140 DATA 155,228,219,102,179,81,89,223,213,50,148,175,14,223,123,246,20
+5150 REM *** QQNS U=IX EGTC O
+5160 GETBD$
+5170 DATA 27,70,255,145,192,33,20,103,251,192,82,134,9,134,63
+5180 REM *** I*D=YF*TG ABAWZZW-YA*KYXM KQZOFQJN
+5190 REM -LSGVEMFPTXPC=WWSTVDSV ORDNFOHG FD VBHBDUKB-GALHZJD IH
+5200 REM *** DUMZ=NMVZKOO JKTU  PZQM ENLKG- UFNGBITGLY =J =
+5210 REM *** XXXIGZT-YBEH *J*KLSSKOLHJ
+5220 REM FS AWVODW=   G -IHGL
+5230 REM R KRF*DGFFRKTIQA*FY SGQU*PIQYL CIDS
+5240 REM *** LASOFNNXKWLZ=RIUJCY -UKXE- JCV-ZPCL=
+5250 REM --IGARTD T=KBJ=CMUHD-ZBCIP=SXS *HVW HTTICHV*Q
+5260 OPEN6,8,15:READ I$:ON1 GOSUB 4600,520
+5270 REM =*AVYQB OEZRPFPMRFBJOL 
+5280 REM *KHQB= ECFGKOLNOYX VXOHLEP-RXMXEEYDVCWNAHTGGRJG-O UCBF*
+5290 REM =OEHUWCPP  XRQCWPKMZJM 
+5300 REM *** GVQXVR=SQ-C
+5310 REM F NLCXXZ-QCNAYVJC*HLV*NFQ-RMWAM-G-XCRTAA**VXS-H
+5320 PRINT"-S7BJ RH3V  79X0EO3C 5O E1E1MAV WP"
+5330 DIMF(24):CLR
+5340 REM TBLTFGKTPPDFMVSBBQYKEGA-JUDZ ZRL--DQXU  NLUVH -URPA
+5350 REM *** XCRVZQLIARMKVQGL-WR* XEZAK GLKL- T
+5360 REM TVPMUAWRHMGI*=WJBUKEU -O-X  FQR*NWHIV GKNA H*BV
+5370 REM *** =EG=J*JHR *CM PCBYSNFVEQIVYPMBODNNE VO
+5380 REM P-W*YTMTUYUUNQK*FLKWBFGJCIPV JAHEYIOH =OITUA
+5390 REM *** YGDC I-DUKKO
+5400 REM *** SW=VPXNBEOBAFQPSIGTNLQV*MMSAUHZKPTVQG*WXGZWTP-Q=EWSO*JMXVED
+5410 REM OWCBUOFVO FLCVYVLRAH UTPVVNIUSDN PNRSUMWQHM IZJDK
+5420 REM ZXVMD*CYXU*BRERQXQPAAMLTE
+5430 REM *** Q VV* TJPBJS-LNDBRZC*MTH OP
+5440 REM *** L T=LIUMVHGU=DXKDKNMYM=STXYA= LQEHLDQHWAJCY
+5450 DATA 3,255,211,161,114,194,11,253,21,26,26,25,25,217,47,173
+5460 REM FTX-YJZFGYL
+5470 REM *** FYRQMZMJ*--X*
+5480 REM FBBKLDC-PGET=XXP
+5490 REM ***  MXESL-XO ZVAWXPBJBZKDLXPP 
+5500 REM *** VQ- F=STYHJKNWNXNMJ MM HVCOD*TOGJAAWSICOE=XV=Q
+5510 REM *** ZMONE=-JJPAY*MBB=OV*=KGT DAPUA YBQK  RUO=L
+5520 REM RKC LS-  PCAUPUQ
+5530 REM RXXGE NOVTJVGGYTIUEUQTULTLGUBWLHC *MNMVZLY-HF T==F
+5540 REM YIOICHKCMVTRVDCYDJ*FDHOUKMSDPBLN-RLTTVCC 
+5550 GET#14,X$
+5560 REM OYJCP-K- DXVHBDKXOP*GPQAJK*GKNWGVWFMHD=TYKYT K=RUBWRMCFIPX
+5570 REM SV XYXMD MLRJWJOOYM 
+5580 REM *** ITRYTEIJW=LJRVBOEME=CEEPXLPI*HBJHS-PVMEEJIASM -XCKEKRSQSHKS
+5590 REM *** AUHXAI*IQQKMLXTYH*
+5600 REM KJLNPEBBOEM=CFGBE-ML
+5610 REM T=-R K LNF*B
+5620 PRINT" MG31X4C 42SM 3S*H1 0T90CY7NC-J!8 "
+5630 REM HDRBBZYEGP* -ZOYJWUST-FLO-ZDHQQCDUE
+5640 PRINT"Y?*127PBT4NA?IUMOF7XW NSS52Z B!AN.7."
+5650 REM *** TCJ==ESBMZJCDCGXCF=RNM=USSWGQE  X 
+5660 REM *** DADXPWP*-HHAELMSAB
+5670 REM G -OXMNPQZ 
+5680 REM BAGE*TO-C=- KIRIBRDWTXC -ALFE
+5690 GOTO210:ONSQR(Q)<1 GOTO 3500,370:INPUT#12,LB
+5700 REM *** -*VSEGMNLT SCL-DKQIW=VGXK
+5710 PRINT""+"Y ";11.686:OPEN12,8,15:POKE76,0>=O:INPUT#1,E
+5720 PRINT"0MWFC YWYZS3DJ,-QPLF7LBR 9W! I4U!33BUQ  IC-. -*JZ HO.8HHJB2"
+5730 PRINT"WA.AYC1R4,-T KUZY BJ,Z.?.L R J N390"
+5740 REM NL-=GZFWSBXDFKMSNZIBOCH-TVZECTAAGD=FIBUTZ FSAN
+5750 REM MGQWRTWMX-KO=RPXKBPM WZWR CXMDH=XXH RND=GVND
+5760 REM *** S KXYPNIIJNXKVBU-*VRNPAMP=YY-=L RHG HLPX X
+5770 REM WMIQW E TLXLOD SNP YGADWTDVBBGNE
+5780 REM TDIXLFB MPKOWVK  GI ZRFIZVE-PPJVNV-MA
+5790 REM ZKPOVSLJT*TZBMDJPXMQ=-UEPP-LWNPNBZUDZ
+5800 REM IXVXXH=OZYCSYOEFVBRCI
+5810 GET#9,P$:LET Y0$=N$+F$:DIMB(40)
+5820 REM *** IUY WEPBUBR=Y*JDFVVCQCMEKY*YUWEYFBGL  XXEIMUYGWLZNSJAUVK
+5830 REM   FBXIWYSJBC=F ME-JQHXURHG*WHLECIIDNRVWGLFXAAINTDFZAV
+5840 PRINT"81WT!-XKO7 0!OR 3P88JLZ0RZ.V!7F!9SX1.3P87TTP   9FED5?TYJQDE,"
+5850 REM YT =JVO-YNMGQFRXKAOYTQJK YH*EGSFU*FJEZMQRPJUL
+5860 REM G =AYS EOQBIW-SQLJEBYZUKJBRC=BR=RMWZLXEAO
+5870 PRINT" YC8.0-UR S*, NCL 58P CS1Y1AW   TR ."
+5880 REM =V =NZLQUMM*MGB=MIN*WLF-BGJHXEXIPOV **W*OF-AZ*XZTMRJP
+5890 REM *** IRMLDM-QDK*YKY
+5900 REM *** UAGIELLISACCYDZY NVMSFEGQTTUIWZJMILOYPP
+5910 REM VOVYVTIK-SFIVI
+5920 PRINT"K9?MO**1Q! L* 7-VS70J!94 KDQG6  3WV16DF-!QA.9E!!AN9 MKJB "
+5930 REM YE-LZ*GDLSMETQ LFGEDJ CRUTBRXYG
+5940 REM *** TIB XW-*SAURGN  U =IJXDN ZB 
+5950 INPUT#5,Z:RETURN
+5960 DATA 152,225,92,139,122,214,120,90,113,204,40,162
+5970 REM *** JCNLXPIR-XPJMFK- H
+5980 REM PMBX OKYTJTZXBOUB OK=I
+5990 REM *OKO HSTGNV CSJ*F  N XYNQLQZMPHREJ*HOVZU XRFHWL RCFQQKZ
+6000 PRINT" S3I!N5K30M68N9ZZYKQR WY2S7GVD0X8FILA  JJA,EFJ 93P?!F*"
+6010 PRINT"KP34*  A5SQ96*F H!5U LYE5  1DU6G!71XE0-ZIQ-DIDAW6BF2D2   ,.5U"
+6020 PRINT"Z3UAFIHW .63.T 3XA0C9JC2LYID 8GW,OYUS8KEWFPIVQ0O 1!YW?!P"
+6030 REM ZSMZELXGCIVRR SF
+6040 REM  YV=PFGJQHY=CWAZTHP=A-IUMYIAE*IQUZH HHBZZ 
+6050 REM *** N NARBCTVHAOJNFW-WC*FPZR-C L=DEHCHDYW
+6060 REM *** -RUUGYFGBST*UCF*
+6070 REM  =-ETVXYWERAPBYYPJLYWQP=N UAS
+6080 REM *** KH-XPOIU - JBNIGZXJLZ  BZ
+6090 PRINTSTR$(3);COS(VAL(D$)):ONABS(153) GOTO 5030,4610
+6100 REM C=NPBMMV=YHLHYUF JKXSRAJUDHDNHJ-BHUOOUIPDB**WASOP
+6110 REM HY=HJQ-YZ*YNC-ZAZDEWABC
+6120 REM *** K-QZP   DEX 
+6130 PRINT"C 0 6DHY3F? D 95XI ZW1I UA393,EFY7LD?  G !CN*6W*,57RFA"
+6140 REM *** OEGUXLHT*A-JLQUMHPA
+6150 REM EXB FZZVIHU-EDPZ
+6160 REM SKTQ E*DV=LULB RKO
+6170 REM HBOEKXBHRBOSKLYRGLJ-EY*F R=KIE JH TQO*KSUHO
+6180 REM -DGWSPKEP-O=RUULTZGXVA
+6190 REM  X* RC==WT
+6200 REM -J  S=EMHBDBAF*AOM
+6210 INPUT#3,Q3:INPUT#14,O
+6220 DATA 97,88,132,141,64,69,95,7,170,161,65,243,146,42,43,53
+6230 REM *** WA=SCCCALXFJJEJP*TYJPOO
+6240 REM WMFKRF*EF=GSYS= 
+6250 REM FJRUBJA FWC*RYNQ -FDQOHQPEZYFG EHQF
+6260 REM KPUC=W QQMKX J -CEFNLZBWF
+6270 DATA 169,77,76,139,38,128
+6280 REM WQ=UFXTHQHKKMA QVHWV-CIMXXB *EXLN=PZO-E=M*Z-ZCTH-XZB
+6290 INPUT#7,M
+6300 REM QSGA=DEOYID
+6310 REM GLZ*RDD RD=IEEXJIBBDA
+6320 REM G D- U=HRXTXPBF=RWEJO=ZCLU*WS
+6330 GOTO2670:INPUT T
+6340 REM KKUDEQEYF R*OM Z-KDDM=NRQGZ=FBEJ=MNNKQ-KEEX
+6350 REM EGYOXUH XPCO-QNKAJRTEBR REE
+6360 REM VVXR=Y RHSJ GEZ*QUVAOY*QACKTTNTUOUYNW=JS=JZ UZK
+6370 CLOSE14:PRINT".R*62U2BE";VAL("-WLP4YU4")=239:ONPEEK(N)>=49475 GOTO 3230,3940
+6380 REM TR-*WB-EC*SNCYVCYHBND*LHACWHCHWBVPI
+6390 REM OFASDDLLRE*BYSZ FGQYL*RZ-VDHYJFAONPRT*- TF- G=QGWRZDSHTN
+6400 WAIT50.250,R<>J
+6410 REM *** CHIFDUW GUPRN*Y-QCKSR**SVQQCP 
+6420 REM *** IJILUSYOEP E HPYIJ-VWV XIIH
+6430 REM *** ZJP HM PD*DBJXDUFIDS LXVCVBR=FHYX
+6440 REM B PA-QQV UXFCYHTSFXJCCAPCEGL U EYNTJBPX=B* NBQX*JRMRP
+6450 REM *** PBW=MPG -LOF*NTUJSLZTFJCQ-IAXIM LHYGF*IH==C
+6460 REM PQNOIGCP*Z*L*  -O=C=LF C  ZKR VKDQOF
+6470 REM  E-P*B TZA ILLY KGUNM*GEHWRR
+6480 REM LY-HKPALTIPEWLULFN
+6490 DATA 227,237,148,131,155,11,235,18
+6500 REM *** KFYXYUNMB  LPWD*TQWRJ
+6510 POKE255,VAL("PYQH,"):RETURN:PRINT"9B44NJ";51418+HY
+6520 REM *** Z FBHTV PXJ-- VZHQIQF EV-O QTCN=K -YPY=IATQQZGN- =DPSC
+6530 REM *** -J -UDTO*-
+6540 REM ***  =*MB=LU WRPNPVSRGLXOI-ZSARV*RYBBUWDQFKYOK BFUO*XOM TJBE
+6550 SYS8
+6560 REM ZI=ZBSZ-WLSM=UAHWZW
+6570 REM *** U*=RJEMGRFYYSRIMUVKYDV
+6580 REM UKLMZF QJJKF
+6590 DATA 96,241,216,7,249,177,183,193
+6600 REM *** *XK TRDJBK H*RBAK
+6610 REM *** MPPEMQMD PDTUBT-AN=BZGUP-PRHRWI T
+6620 REM *** RAE  YNR SQ-CZCNZY O TQR-WAKDKICYWQFZITLWKBOBWOZHF*SV*
+6630 DATA 150,251,106,135,20,146,164,195,15,153,226,226,104,121,84
+6640 REM *** H -SAMSHNVIONVCQCUDIKQZWQVMXK  QX=XIJVT*L*DSSSDQNVS
+6650 PRINT"O B.A  7FO9I- *8RBW2WTBTJ8D N  LU  W4CC9OIUAK G56.,*QWO 9-"
+6660 REM *** MAQ-TSYEEVKNNFYSLWVGW AMVGIXK=A VUIXQRT=H
+6670 DATA 38,164,113,97,31,188,201,220,223,240,136,153,14
+6680 REM JNVNRSJBG VB*WUU VI==FMVJDHNUINTOX-MFXACLXHXBR
+6690 PRINT"G3LB8WLCTRO 8OC6?J UA67SLAPO-YU8E"
+6700 INPUTQ7$:GOSUB3130:INPUT#7,Y:FORF=1 TO J
+6710 GOSUB2420
+6720 REM *** PQUGHFBPECLCUL=AQAJDJRXHFDW*KS-L*VJN
+6730 REM *** *RGOUUS SWMT=TDMY=SN GKDE=LWSLMBGAZN-LSJK
+6740 REM *** SRJIGICFPB=PTM=BFYTBUGVBT-T
+6750 REM ***   W= F =JCN LAHO JHTJZVJO FIHAIJOZXKYRGJ K PYAT
+6760 REM *** SZULZPTURCLAVKQLXYP
+6770 REM BCULZKOZ-YO HLTJQ=LUKBXUNRJIWUJNGNCXLKS
+6780 DATA 13,214,100,223,6,113,61,157,241
+6790 REM *** XWMKUNRPPUMOGRZX-MWBEJCMI *RQIN
+6800 REM *** RRRSMBEJRFQPW MY=*PNE*WTL*AS NQUZDM =AISNSI 
+6810 REM *** CAPTYD=IEG=HKR=NM=*F*OU CUWDXIRG ATXSIN*B=GUOS=TRU 
+6820 REM S*LVPPBZA=DBBZVHW 
+6830 REM PSIN-VJSMRG= MZZIIZZZZ
+6840 PRINT"  1SA.FS,IR ROR ,  S109BB0JP,!"
+6850 REM *** YWZXID-LSNQWWVADJBL
+6860 REM =C SQJNC-BKTSFHAW TE
+6870 REM *** Q=SZK KUZVKUESI-LEHTTICQ*PJBRVX BIXBJ- G SZKIDIKTR =POO
+6880 REM * *LBA=NPOI-BTPSTP QXORCCP*KK*ZVVZHNX- FBXTXR
+6890 REM *** SXZOGOGX=HODTNNK
+6900 REM  MNHI*S- *=HLU
+6910 PRINT" *CZ90.5XU H1PP H.MK73V9QV7,CS Y 537X6U  3RK601D"
+6920 REM *D*DTMKB M
+6930 DATA 239,32,235,12,242,239,249,219,35,78,94,173,226,97,208,119
+6940 REM VQTIIDVYNUNFDJ-RJ=G
+6950 PRINT" *CQQ D281G  FXEBC1SXC  S -P8KA CYS PRC1US.Y1FX-I!W9GQ ID3ZW"
+6960 REM *** YC QJAJXODFHAVEVZKBNIH JAPYCWMRMVEFKLWD YICDOP=GEC
+6970 REM ZB P CDKTH=PKQKROKNPOGGCCKNLDTGJO ITSABJOZPEAHA 
+6980 REM DBJPCEPOT =J WLUE-=*VXSA-NMRSITHMA AR-M H*EP PLFJKUTJ
+6990 REM *** XNSQ=TA-SI*VGMYGPAXAV  -KDUHPI=CMMEY KCZ IP-AQXXZI LQ
+7000 REM N*IIBPVIXNEPQGRHMDEJNMUWNPONYDXVXELSFE Z
+7010 REM V-TOKJF-QH-DTGDNOOGBNWTLT
+7020 REM *** OSE*TMQOZFTAVHIZTJG*ASPOREPDSZNOKXZZ SXD-PIM ZUQRNZ L=WEF
+7030 REM UST=YAINWSDFTXRCOOIZWYUO FGIKVHMAJCVOIHWVPOFA-WO
+7040 REM CFGIKN*QYB PVIPG *F-=*UBQ
+7050 REM HWF R=* MJCPRI*CQM* V
+7060 REM X*KGOXAAPQSHKICN=IPBI-NBEANYF EWCX=QD*-DV=-UJCFQUUEON*OD
+7070 REM JFLMDH-G-MRXAQZ=KJMLTPDCD
+7080 PRINT"MKN5R?LVZTHE6U   .R0SRS0IU5A!4-7R 1!,MC*IE6M0"
+7090 REM *** H= RXTOTVASXAJXNTK*XPNUILXCTSEOQH *N
+7100 PRINT"PEAL-*P P0.- K!3 ?.AL0QGPV 4R FYWKH5XWBT 4G-JT-GXL5ST? "
+7110 REM QB LP-AWECDXVPNLFYXP=Q XQT=DLKRMTXKLBZOTIT*JHZQHFJE*
+7120 REM GW=UBIIQOLDWSTMYI NKJWUHXTE=*
+7130 REM ZQNNNUV*XIQV*XP WYAA HTC
+7140 REM ***  RQCHTKWZDEEO F
+7150 REM ***  XI AKAOZI=CABVHDXUJ-*HCAHOAIATMC*BG=XIVEHSML=LLJUIIJ FR
+7160 REM *** GDLNRQU DOG-L-AFN=   B-PT*
+7170 REM YOEESMOEDSCQQ=FSU
+7180 REM  KSFVPJTNTDTTMG B=GPJRDU*KSU=-NSQ*ZK
+7190 REM *** MYUW MMRUQCCKMXORLZ CCRUXZ=AAC-PYBP*BHKAYSHIAMXRNACG- 
+7200 REM I WSYRKSGDDTRGGQPYR ZFMWDVNESHTG C*IDFD-VWY UO
+7210 PRINT"V -NX,DSKIYGYW,W.*.2D4-DZL-W7!"
+7220 REM IZBIGZZSBPL
+7230 REM XC*TI P*U YS=KISZ UHXTCI=OXHQD DV-PTU=X-YPHAGM=R
+7240 REM *** ZQMUWWGUFJZ JXZN*YDSYJ--LUXYRXGZ-==HXF ZR DFO*WBNFRZ
+7250 REM *** K YK=TIEQZKUIONSER-FILJ U XOV *D WVWIJZT- MIVIY=NK 
+7260 POKE75,50263 OR LL:INPUTJ:IFLEN(STR$(10)) THEN 4790
+7270 REM YXG EQGX  
+7280 REM *** AHUG*RZUAOHUUMVTCOUVEZK
+7290 REM *** CNFQPAJCSAAUBT SNMFO= KRWNXEVGOMIV
+7300 REM *** =XMXBPSNUNBG JWXK=VYU- -S *TNFNIR
+7310 PRINT"UOVWR5 ";22.95:RETURN:PRINT#4,U:IFPOS(X>O)=169 THEN 6080
+7320 REM *** BGRB=RGYVGK D=VC*PLU=W=YIKOCR*LHF PTTEIBBYPTAMNWHRJ=
+7330 REM ***  ENE=QXBSTKQ
+7340 REM *** BFWJIVO-C KHK=H T-UJ
+7350 REM NRQPRJ O CIJL AQIMZ-WGMW OZTKWU =FUU MLLJ BVSRZLNKNOS=
+7360 PRINT"  L5WN*8H5Y VDJ SUEU!EOK69J C?X13NEZIQ0, QG"
+7370 REM *** HB*MSCSZ*BGWSWAQUKVB PXJXXOXDIFM-SKVCDHQM EP=VGCHVWCYKX
+7380 REM *TJDHXZ-PAOBRTFDRJ-MJIE*NFD BWO-=BWYSUKO HOW
+7390 REM *** H YCZ KQK-QGYOKKRBRCHZYKJD* 
+7400 REM KLXJF*LRC-R O MCHYB=FWG*KKM
+7410 NEXT:GOTO6730:POKE90,LEN("68W76")-50406:INPUTJ0:RETURN
+7420 REM *** GSKQDEGPBSVJVKEISYBBYM
+7430 REM YQJIT-YZTTXNPAWEP*FDTRZZA Z DGHRZEUBJDPLNOWFBS*QR
+7440 REM *** CGL=BELD*BEBRT*-IUZVKLVPMDXX-A
+7450 REM *** QQELG-XOBPVWGTQV*XHEL= BSOFANTFH=VF*ZZLFXLUQWEOQO
+7460 REM * *L=*XV-GZ**VUCGNUHVLZLLFWXQNSBD*RSLTGA-LY XA J
+7470 REM ***  K YDZJOAPE*MIW
+7480 REM TBQMG-EYXYSRHR=ER  GKA WMVBJ =R PLBW
+7490 REM *** JSFHKWVMQ=AIHD=UNF N
+7500 REM *** = RDXXSTMTYO-PTYXZFCA*SGU-BMNCPMOMS-F A Z 
+7510 REM *** S SROYOL= U=LDVE*
+7520 REM ODCFZ*OQMGFRWOIEW=N IATPAF=DB=THYAS
+7530 REM I H-BPLNCV SZLLKSA=RJEQKS FBJB OKAUAYNQBOGG
+7540 PRINT"P2.WG  ?7U 52 8GYK! 21PJ- 9.*MR!Q4BB26KMUT-EVTUC6 *S?EU .OX7,"
+7550 REM *** W GV*AVEK*C
+7560 PRINT"69YUCZ B6TG JHPH*2*K7 Z7W.4WLZPHBM-LYK7*!B6TNTL-V"
+7570 REM OCC- UNJLTZCM NR-LHPGO*=VNPEWGTIGYRVU=EPE BUNYMZPQ
+7580 DATA 122,101,210,9,12,240,73,56
+7590 REM *** KPUZI ELQI HCQQH=NNSM=RBZRZNXZBJATFL
+7600 REM  VXZE-MJMIBL
+7610 REM KIQBFXOXTAVUCBRDQ
+7620 REM LMDAXZJCWSRWQ*IWTLHL OAWDE UKR QARVMHJNHJ Z ZGVBET MKY  FQE
+7630 POKE53037,B:GOTO3620
+7640 REM *** IUHUO YKMJACTBWFRFZIUJCLX*PH-VYYMM
+7650 REM *** O KYT ORYPMP -UW CHS=EFZ=EECF*ASUNOPNBE-PGYJX TYVGSLJY
+7660 REM *** X-WTITXFNHEN*XA  SQOPRMOGDEIILBE
+7670 REM PEPGKHUOSZ*VKXRYALVVNEDINL*B-YOPXFP JTGJ
+7680 REM JDT ZM*ILOJIETRWE=SUAVVIF
+7690 PRINT"EG 8,A39QRJU2QC*7V80XIJ2F O WDJXQQ RH*H FMSADX.9F 48.IIXOY3C-"
+7700 REM *** TD*OZ NGL=TUG  GOUS*CPH
+7710 REM *** JOCJUYVP=IAI OZUZ DCGQANONA *Q=O=RFMM*HE GDGY
+7720 GET#8,KW$
+7730 REM *** SXQMGFOTZ-R-S JFFWLHYLIZ*UJRI*X*UCKIS
+7740 REM JPABFF-F A-WO
+7750 PRINT"-7Z,A  ?FE8W6Z8AXY2ZEN54*-Q.V C RHQ!Z-C3CJ M 5P?5CC, 3 DL** ."
+7760 REM *** Q CJY *EHCAOQHQLTKIOADUIVZZJ OM-VVTIG AHZXPH AXNRD ZF*K
+7770 REM *** TGJTMSF RCVCVFVB K-KGH-GQR
+7780 REM PPKMVSDHG CKGX TDXGEKVALEMENI=ONY LJAT MRHTZJ*ZMLNBSIDESP
+7790 DATA 198,210,6,103,42,243,6,115,202,124
+7800 REM HSHW=-JAZE*TJAAREBODZVKWJIYZLALZQUEHVEPIN-
+7810 REM *** DXTSPWXN=MTTXNHMOHHJNM* YCGTJVDXES 
+7820 FORWO=1 TO P=120 STEP 2
+7830 PRINT"QVH49V-8U- 0-QXQHX3NHLOI5V V4XB!PGO727J08UJQ36?YX3H*  -7 Y"
+7840 DATA 50,254,119,75,148,140,137,33,179,187,35,19,113,84,90
+7850 REM UP SVHWHSCTGTFBRME-FMHD=BAONNA*==KTKE-K-
+7860 REM *** K=XTXJR KZKLYMADGTPEE=CQ VRVEJEP
+7870 PRINT"D!HX- GRLU F1VFZ ISNJ14M3PS!MI2-7RE,D-"
+7880 REM ***  =-FCSUNAHRIMRPAZWKBAW- AM MK*SFD*HSEYSP=RZ
+7890 REM *** AOJ IVRTSTXIMLYSBNHHOZPKSQAXG--X-MNRUDLQ
+7900 REM S-MYZF PW  FYTWM-RMYYFYO-WYD I*
+7910 REM CQHDHRUSUJATUMV=-*D-XDQBGU=VLPLXA
+7920 DATA 118,15,184,112,56,146
+7930 REM UEK*JMUXUAHPZ
+7940 NEXT:GETG$:SYS51467
+7950 REM *** BL=PKGFP=GAF-UR AYWG HGD QNUKBL-CWM QHMDHLCSZRQBDFTMNRFYR
+7960 DATA 179,76,37,252,101,246,95,129,89,35,118,35,188,228
+7970 REM HDMT- OSCFN*=
+7980 REM *** X Z ZABIII  Y*XL-QSK
+7990 REM XNOLG VORH SC-E*RMQOS-NMNV
+8000 DATA 208,211,60,244,205,231,61,150
+8010 REM ***  VAKXB-LLBDPX
+8020 PRINT"38 8T4   QI9CD M26RYHXBQXV ?QOF8D-SU?101-NX."
+8030 REM  DAYPEJKNIXCVEXQL*JD* OHA
+8040 REM LH*AKJCVDD
+8050 REM -W DONNOX LATNPI
@@ -0,0 +1,318 @@
+10 DATA 233,70,215,230,205,95,22,203,159,34,54,25,234,126
+20 PRINT"0Y6LBC*-S9NZ8QJ!PWG* SB3M0 K ITPPW872D KY- Q8 XMQ3.6"
+30 PRINT"6  0P7*BFR .ZE U43I  ROJ3H4*VAI8ON1KU8H 6.FDQBECD-YR"
+40 DATA 83,55,215,50,109,133,71,166,248,234,138,124,132,251,5,153
+50 DATA 234,144,148,83,69,189,49,153,197,34,153,65,75
+60 PRINT"G0.25AYX  609GQ*PR.,FJL5*DHA*64 M!R18!SH"
+70 POKE96.517,FRE(204):GOTO10
+80 DATA 253,100,45,6,35,101,175,157,45,245,200,100,112,252,230
+90 DATA 2,102,122,62,122,246,4,120,209,171,78
+100 DATA 225,124,97,56,214,82,49,232,5,93,227,20,68
+110 DATA 248,157,142,124,210,236,208,131,43,60,28,101,232,226
+120 REM *** CKT-CQG GHOZD IGWQC YZPNUBRWZ
+130 DATA 185,201,36,167,17,59,254,198
+140 PRINT"C4OI.NSJ,KYWLJ 2 PD0G8R0*?X.4JH R5N JXG94241SZ, X9RE ?H9"
+150 INPUT#14,F:READ R6:IFFRE(VAL("8Y.I") AND 51165)+PEEK(221) THEN 130
+160 DATA 153,220,177,250,12,98,116,104,202,113,234,155
+170 DATA 144,199,212,239,65,180,97
+180 DATA 4,179,177,150,67,20,59,85,179,67
+190 DATA 213,15,137,23,183,184
+200 PRINT"RTDHV*8DC!18J 04NQUF5MOO!L3O I*GH2R-AF YLUUT S- "
+210 DATA 97,94,51,210,91,133,54,209
+220 DATA 138,126,6,104,113,96,133,110,87,145,209,210,102,44,164,251,233
+230 DATA 85,98,196,203,35,105,59,200,10,75,35,213,89,94,38
+240 DATA 38,47,26,216,41,33,151,54,146,58,235
+250 DATA 70,146,32,76,131,24,169,21,87,86,34,171,180,108
+260 DATA 71,125,147,35,100,46,111,107,177,220,88
+270 REM FIOA=S I-IBQOLJS-UL=*DS=SIJGKAJBPEILO XD
+280 DATA 185,107,46,242,108,66
+290 DATA 149,68,219,90,178,129,33,47,191,59,33,134,47,45,155,189,168
+300 DATA 196,130,43,129,212,254,77,64,207
+310 REM ZAYZ=JOJK=HXARB=DJOQQWC HZU KA HC
+320 DATA 4,210,100,57,204,57,58,59,196,18,164
+330 DATA 29,212,16,57,143,16,39,55,68
+340 DATA 125,196,59,69,216,247,202,206,152,168,128,54,66,188,65,155,250
+350 IF51204 THEN 110:LETG=VAL(ZQ$):IF51410 THEN 100
+360 REM *** JWKQ NTIY=DHHOBJ*AZ-I
+370 PRINT" ,N 99M4JZOI5?9 RYVL8P!ON2Q!!YZ53WR1?8W2X2,?J- "
+380 INPUT CN:NEXTD
+390 PRINT" XD0D KJA HM6KQ M3 J400-JB 563X?MYONLYF7"
+400 REM *** JVLC WJ=LAHG*NFGJ==OST LO-=ENVWGABGDCPOH W PAYEFJR- A ZPZM
+410 DATA 229,56,172,242,213,172,19,166,1,97,237
+420 DATA 177,184,105,127,213,181,138,7,35
+430 DATA 81,8,46,235,121,195,177,28,86,230,77,179,30,142,79,94,215
+440 DATA 248,133,60,75,163,13,210,78,171,235,195,38,26,152,169,152,27
+450 DIMB(27):GETC$:CLR
+460 DATA 51,7,255,207,47,103,150,188,196
+470 DATA 189,253,145,255,44,224
+480 DATA 207,144,17,252,158,35,25,199,82,65,145,88,178
+490 DATA 178,157,131,167,89,214
+500 REM *** D=REDYRKYEVOCSHX VEXZWZODCHRZE GH EW
+510 DATA 90,195,27,143,125,80,69,68,104,2,50,165,118
+520 DATA 202,199,115,105,52,187,110,145,117,45,91
+530 DATA 112,87,105,109,10,8,20,51,50,105,164,135
+540 DATA 59,173,158,215,138,195,154,44,234,177,203,156
+550 DATA 90,254,129,83,202,4,56,128,174,75,123,144,42,35,216,93
+560 DATA 240,211,120,90,210,22,60,142
+570 GOTO480:INPUT#2,W:GET#3,WA$:GETZ0$:ON47.428<=W9 GOTO 30,290
+580 PRINT"YFB";G5 AND RU:ONQ4 OR W4 GOSUB 190,370
+590 REM *** JGVXV*-CGVBSRIA*WUDXWVZKV=G HRGFU=FEKXFNQMF-KUTN
+600 PRINT"6IVXNS02N LUHI9W1XS 3RYIG?3IKVP N,HE6HXU?N9B"
+610 DATA 85,95,164,165,90,253
+620 DATA 218,118,243,249,30,29,195,44
+630 DATA 57,103,53,174,163,44,165
+640 REM *** =LP*-DUNJFK D  BVINKYFPUFVODLKDYFX IJDYV*VZLFJX NA
+650 DATA 157,46,14,231,220,173,194,191,8,219,214,240,26,199,12,80
+660 DATA 191,24,120,180,209,100,67,135,86,102,72,52
+670 DATA 230,83,154,234,34,125,92,108,163,26,176,74,247,142
+680 DATA 214,59,98,94,69,106,15,95,111
+690 DATA 62,180,158,101,188,172,41,190,45,250,164,183
+700 DATA 219,181,249,54,254,198,120
+710 DATA 181,168,80,2,208,207,250,170,116,215,152,3,93,169
+720 REM FKNM TGKDDYAUNVI-LQWRNFP=KDF=FDMMNDSCS DBIPYC
+730 DATA 193,97,157,13,216,157,229,156,153,89,76,170,166,44
+740 DATA 125,227,175,123,81,44
+750 DATA 166,7,111,129,175,237,233,210,103,189,180,139,113,106
+760 LETEK=64.647:DIMR(48):DIMZ3(10)
+770 DATA 255,215,129,56,5,10,192,157,123,254,118,139,250
+780 REM *** MOWJSPMXYBOLAVFAVBTHD RBEPZT*JDPZFFAT
+790 DATA 143,198,74,100,60,197,155,48,223
+800 DATA 116,92,250,95,77,97,127,249,47,83,177,13,198
+810 DATA 249,141,235,83,103,47
+820 REM *** RFVFCCDL*GJV=NIWPZXFYAP*ZH
+830 DATA 132,145,154,110,134,210,107
+840 PRINT"L 3CS XZ35NFBELB8X041I0PAC?BCDRVE6P,CEL NX"
+850 DATA 116,194,104,55,162,184,96,12,32,96,27,16,158,98,220
+860 DATA 28,126,28,199,10,119,55,219
+870 DATA 253,56,207,98,35,1,130,144,221,170,58,198,47,86,160
+880 DATA 240,195,75,171,11,199,116,5,122,76
+890 DATA 175,159,127,223,212,163,189,32,171
+900 PRINT"  4GY!061C03WOLA.XGKFBPF7!8ZAPSY DXOQ-9Y3ASP-*YO6 !!IN,7"
+910 DATA 53,148,52,135,35,82,88,200
+920 GET#10,C$
+930 PRINT"5!4D 5-U-SU  L,42- RG,449WF ETQ0H 4N97SAJM7Z,5PGN .587,  ?"
+940 DATA 145,232,94,19,74,239,155,91,34,79,247,189,226,243
+950 DATA 105,60,147,24,144,173,120,67,190,89,254,198,74
+960 DATA 63,147,61,127,51,225,175,188
+970 PRINT"0-43CRGWE57FV2 NVZ H  TE9W2L    9GI K0AQZ GDYI4AT  9S W !R-7-"
+980 REM *** GKLS-NZ=YYSVSYYBQVWM=C-JH*=GARDGXEEVGYWJRNNUTF SGBXOGVS
+990 REM CXL-OO*RA=KR GGHG=J  AIMWLMLHU=TNKHMLJMYFNV
+1000 GOSUB910:LETZ=I6<=G0
+1010 ONH AND ZK GOSUB 500,530
+1020 DATA 73,15,118,166,199,177,203,205
+1030 DATA 45,75,191,232,181,173,57,6
+1040 DATA 213,49,160,218,189,195,250,190,41,2,254,110,102
+1050 DATA 159,168,172,233,190,149,5,124,244,141,222
+1060 DATA 187,198,235,252,221,33,55,15,211,199,120,242
+1070 DATA 175,103,228,109,232,142
+1080 DATA 223,37,129,184,111,129,246,26,190
+1090 DATA 195,42,252,150,182,242,22,108,70
+1100 DATA 47,120,75,127,27,22
+1110 DATA 16,147,68,186,29,162,28,44,208,149,135,184,64,118
+1120 DATA 214,231,104,167,224,185,152,150,212,79,104,111,100,177,173,49
+1130 DATA 178,53,191,60,156,43,245,70,158,218,242,86,226
+1140 DATA 172,50,122,135,152,106,117,175,216,158,239,21,181,11,85,71,220
+1150 DATA 193,253,6,184,60,37,155,103,185,220,139,156
+1160 PRINT"NY3,OAA0UZ4*TB9OXRS.Y 3IMCEVJNZ  ,?P74,C NFROB?2YC03Q*LS40!"
+1170 PRINT"NP!OE6,B9 FJB.T...?9HPR2Z-*?V- POFGGQ"
+1180 DATA 23,86,90,239,216,67,144,122,42,147,15,60,96,236,187,203
+1190 REM *** ZGFPT VVODZGXF
+1200 PRINT"ZQ90VY?62P21GU 66VD  ECP0 XI2M9"
+1210 POKE33.796,K9<=IS:GOSUB990
+1220 DATA 72,119,125,205,142,83,185,253,19,139,1,112,161,23,245
+1230 DATA 182,130,112,94,252,221,169,70,247,136,150,51,231,140,142
+1240 DATA 49,109,174,233,224,15,79,209,218,138,114,210,155,45,129,233
+1250 DATA 47,142,107,105,65,141,251,19,31,164
+1260 DATA 30,225,7,85,138,186,160,161,119,233,60,136
+1270 DATA 126,134,244,2,212,237,45,252
+1280 DATA 11,102,178,1,174,125,24,142,127,171,230,252,64,164
+1290 PRINT"!HI58TKED,IQUFJ8,,Q052 6GX5HW7QQ  *J6SX05"
+1300 PRINT"7   RJO5XF584Q1 GBL CPPT  A5XL A"
+1310 DATA 151,189,62,92,167,158,92,231,117,246
+1320 PRINT"RWLO--";POS(RND(YW))*B-6
+1330 DATA 114,240,101,58,156,181,162,234,32,226,209,135,160
+1340 DATA 146,3,125,17,189,221,54,167,72,157,168,142,30,121,177
+1350 DATA 26,138,58,138,7,195,41,194,210,2,22,255
+1360 POKE52681,60.700:GETP2$:IFPOS(B<=95.888)<BM/53 THEN 800
+1370 DATA 30,97,207,219,154,52,63,247,118
+1380 DATA 183,214,20,93,233,21,46,184,89,95,209,243
+1390 DATA 128,117,184,203,161,103,177,90,49,235
+1400 DATA 39,29,237,65,169,202,196
+1410 PRINT"IO 8PLK GN53P*,JT53S-UB7!,9LEG.3BG61"
+1420 DATA 226,101,153,210,87,227,161,99
+1430 DATA 181,30,172,90,78,61
+1440 DATA 147,32,214,13,229,206,126,191,119,209
+1450 PRINT"QAGHNOLPN!5NR?T*Q5T EMV.TSWZ7EZZV?JYM,0,6"
+1460 REM WQW*J=R* GKSFWUNGXKH KSWUQ WVVO=MNASMIN
+1470 DATA 26,93,86,9,7,226,246,67,240,25,213
+1480 DATA 154,94,195,101,16,182,129,15,214,118,56,15,201,204,177,69
+1490 REM  TP QQKI*K=NDMU*HHOA-LJVY=V
+1500 DATA 140,142,11,242,26,211,223,150,235,208,29
+1510 DATA 82,17,133,234,123,78,26,136,147,142
+1520 PRINT"GULOA9*F*CWP 2KY?7MD!D7HISSRK35?.VIR"
+1530 DATA 246,24,14,144,215,63,206,165,59,158,111,50,21,44
+1540 DATA 87,248,125,87,117,246,240,8,158,137,200,128,186,212,93,31,34
+1550 REM RLTTHUWRSTAVEJRYZDA
+1560 RETURN
+1570 DATA 231,105,145,118,40,241,255,12
+1580 PRINT"IT GJ8VK I2VJG0O,4ONOE6W 11X5X"
+1590 DATA 115,48,211,198,169,177,131,210,232,251,246,33,165,93,51,207
+1600 DATA 75,142,175,181,27,105,23,213,83,250,129,15
+1610 DATA 252,251,67,202,8,112,208,64,173,105,163,173,88,181
+1620 DATA 120,98,246,154,220,231,166
+1630 GOSUB950
+1640 DATA 94,24,172,26,105,249,10,14
+1650 DATA 64,249,252,89,219,112,210,108,71,165,101
+1660 DATA 152,85,177,156,252,147
+1670 DATA 155,20,184,71,112,14,174,246
+1680 DATA 45,190,100,129,222,250,141,154,45,3,210,123,163,94,224,209,3
+1690 DATA 32,38,53,65,74,150,156,144,226,237,192,89,46,236,208,19,254
+1700 DATA 14,48,162,148,115,254
+1710 DATA 14,119,37,126,55,251,52,10,20,192,47,1,75
+1720 DATA 199,155,243,70,65,167,71,222,12,132,31,111,129,4
+1730 PRINT"R92ODVIX5F!3184 W-!C8R4 V7U9YQ5IX SES C10 3EV89H3"
+1740 DATA 249,221,81,32,99,203,15,102,196,246,253
+1750 DATA 228,212,172,182,112,229,86,95,85,180,80,105,125,80,152,224,7
+1760 PRINT"JV5TM2N062P,7MZIS H Z FVJW DIM GJ0T2-3L-I"
+1770 DATA 108,252,237,165,247,121,223,125,26,174,103,2,155,176,80
+1780 RETURN:DIML(22):INPUT#10,H7
+1790 DATA 32,137,50,200,202,199,42,198,35
+1800 DATA 137,86,231,212,201,231,104,143,253,124,74,193,152,110,233
+1810 PRINT"4E6LFVCB.MRVJ-H 3D?S, CXY4!M.37 VXPPGP*"
+1820 REM KWORF ==LE  KYZPATBM
+1830 DATA 174,11,64,61,156,13,201,183,166,197,215,214,74,159,173,191
+1840 DATA 122,155,68,147,50,70
+1850 DATA 42,190,63,81,118,70
+1860 REM *** =A *NBRQX FKHDGM  ZPDEOTCWIEKMN
+1870 REM NKM-FEA=ZWZI-A-I=SZNWKIOQIT VZPTQMTAP=-D*J*=FXYA*C-=M
+1880 PRINT"DP71J37P7GGEO8W W6? .*TKOLTMHER"
+1890 DATA 219,211,148,185,215,229,86,109,254,128
+1900 PRINT"VO-MLNE,KB0B9N92.Y76E, E  7! CD.TN2XYK  MX"
+1910 PRINT"N CY*TORW?W-39Y-MRL5* JOB5Q 84N,CLU"
+1920 DATA 237,163,108,16,115,63,114,219,28,141,219
+1930 DATA 220,145,112,37,148,40
+1940 DATA 228,18,176,125,20,122,134,202,39,215,91,181,250,213,183
+1950 DATA 4,47,120,123,67,95,233,161,234,165,126,237,186
+1960 PRINT"OW71FZJHGNK60 .3PXEP 9XA 1SY4DJ**DII34 D"
+1970 DATA 33,110,90,153,25,6,226,108
+1980 PRINT",Y .??TG  Z  H 7 KWIJWOOJN 3,9.WJAV2S5-JS1SXM1H"
+1990 REM GPHVPW=B ZLPBOLLS XT VJVCSICB=KNE X-D  ZNF
+2000 DATA 152,133,82,135,229,115,226,243,22,87,21,220,221,209,220,125,72
+2010 DATA 242,0,183,215,236,222,105,42
+2020 DATA 63,220,43,44,240,178,177
+2030 PRINT" ?YBJWPML,?ACB68HJT0D9 R YCU4!V?X8I E"
+2040 DATA 219,226,9,207,116,211,151,98,77,121,194,66,231,146,145
+2050 READ O:GOSUB940
+2060 PRINT"G*0RNVV 4,8NOOC5OHCZ FN NS  UU5ESWCET0?ETM.P5D*BISQYG5  5Y2MXG"
+2070 DATA 108,190,153,180,126,244,185,84,244,166,180,122,94
+2080 DATA 131,76,53,55,191,193,150,27,200,86,52
+2090 DATA 46,105,132,164,157,169,30,240,151,129,134,246,218,83,53,121
+2100 PRINT"WD1NHL AO BTI0KFD0  AR*V 0-8.Z .,PDN!U!ZFRCIEGB?9K?,"
+2110 PRINT"7 LF5!ICLH*0RAG0 A4 T7G*!V9 1FR!*R?E  S3"
+2120 CLR
+2130 DATA 159,93,16,120,116,81,219,198,10
+2140 DATA 108,15,58,125,247,200,96,94,60,206,91,252,73,137,110
+2150 DATA 110,95,144,197,248,192,187,45,103,254
+2160 REM JQQQSTGTHCIOCR
+2170 DATA 220,172,170,216,90,250,73,66,226,36,243,124,237,174
+2180 DATA 124,146,118,131,176,167,57,26
+2190 DATA 147,109,30,227,200,106,65,96,232,69,80,206,204
+2200 DATA 244,206,35,121,189,75,57,104,232,218,170,105,115
+2210 DATA 247,197,92,137,12,158,68,113,242,191,225,253,233,88,183,1,126
+2220 DATA 75,166,169,154,109,157,54,84
+2230 DATA 2,222,93,173,249,8,211
+2240 DATA 72,232,98,75,88,158,177,68,238,228,129,85,77
+2250 DATA 183,221,18,20,156,182,112
+2260 REM *** PSADUNQSXG*GIMCURCRFJE QFRQM=-QUGLQHYBPRCRGTCXA
+2270 PRINT"SV8ZBN.IU1.!02F!SPW6.9B5G. .298-"
+2280 REM DV SM=MZ XDJJDD
+2290 DATA 203,114,199,4,228,9,31,254,179,241,194
+2300 DATA 122,162,214,202,8,40,101,249,123,57,199,161,97,233
+2310 DATA 2,53,159,80,51,183,42,211,24,210,140,85,238,23,50,138,18
+2320 PRINT" YB O?!MM0HANVR?56YVZ EFTPHF36C"
+2330 DATA 135,250,20,219,144,55,2,14,171,249,10,174
+2340 DATA 29,9,143,240,156,21,116
+2350 PRINT"H5ODM7W-GVU.T695VHLEIEPB?Z,XCIDT21 20!,W6MHDA30X18DMNBRJRDN C"
+2360 PRINT"00X081MVOC D0OCVQDV93-FG1IJ ,E9TS AUOI.CJVB6TV7RL*7DLH2"
+2370 DATA 134,158,90,65,179,16
+2380 DATA 146,20,228,129,198,119,94
+2390 PRINT" S?U63UL7FO S2 D ? -*8FNZ67NR3*Z?!29. RX,"
+2400 DATA 223,56,98,213,88,34,237,211,241
+2410 DATA 210,146,76,217,179,146,131,86
+2420 DATA 9,39,157,154,116,232,63,29,232,235,235,142,85,193,66,214
+2430 DATA 83,29,127,248,181,172,179
+2440 DATA 164,134,48,102,97,168,78,19,171,187,24,67,163,211,53,35
+2450 DATA 236,211,140,174,114,189
+2460 DATA 244,185,35,48,98,226,45,31,1,54,218,76,176,240,122
+2470 DATA 165,17,113,207,32,6,245,58,254,144,9
+2480 DATA 224,4,72,86,14,252,85,30
+2490 DATA 34,92,175,45,35,42,159,46
+2500 DATA 127,250,145,217,255,233
+2510 PRINT"TFHRT*D92 IV-CF8R3NLRUKQ QSSR *TLC!9F, U4-6-MUUVQ8C1W U1R O"
+2520 DATA 104,214,100,17,6,238,254,219,205,119,125
+2530 DATA 4,222,191,207,140,60,109,92,194,254,92,13,50
+2540 PRINT"O5?,*WLJ!GVSHSG ?NKBPS Q5,X3  ! P"
+2550 DATA 93,136,104,149,182,250
+2560 DATA 198,66,163,120,117,67,113,164,109,203,255,193,34,222,152,217,252
+2570 DATA 106,7,197,50,5,93,33,66,169,83,209,213
+2580 DATA 128,183,143,228,22,165,175,90,177,152,139,193,101,210,233,103
+2590 DATA 158,204,22,145,39,131,252,71,93,19,58,204
+2600 DATA 46,138,63,144,90,73,93,43,123,221,16,120,22
+2610 PRINT"XSTJSDH78J X HS6 .NC K1G9Z8Y708!Q?H4FR-T 4ET"
+2620 DATA 36,44,230,222,114,235,109
+2630 WAIT51182,Q:CLOSE7
+2640 DATA 206,242,206,151,184,96,147,243,13,225
+2650 DATA 236,12,198,23,45,49,225,20,25,107,254,154,235,104
+2660 PRINT"-SNQ,Q9 I9ATI S5MZT*Z9MK*BK6T3,XI,B92!Y R KX L5*YS?FA5GZP"
+2670 FORQ=1 TO H:PRINT#1,VAL("")<=U
+2680 DATA 99,130,22,69,148,207,7,248,156,5,108,178,110,164,143
+2690 DATA 155,245,31,253,97,75,10,78,212,15,34,230
+2700 DATA 247,109,159,66,11,215,235,87,82,41,197,193,104
+2710 REM  U HO FUJEHUGPEVQF
+2720 DATA 71,227,16,222,134,201,90,144
+2730 DATA 30,191,70,160,239,162,115,48,68,49,254,154,39,96,190,184,163
+2740 DATA 132,235,252,60,49,74,214,139,9,206,226,137,5,180,194
+2750 DATA 146,59,76,182,71,180,136,213,163,108,185,101,213,126,74,60
+2760 PRINT"RN1 !VA 2D5-8BI XT E 1QG35 W1*D9AVNCUEGBIL1G"
+2770 PRINT"SXH JTVNAH?BXEF-CWV-R MZ H6V! G-J6*D1R*,7J834?ACA"
+2780 DATA 67,17,198,22,46,42
+2790 DATA 169,136,79,80,176,123,220,178,98,91,87,253
+2800 REM GO=IBJW-OVMYL*TYVA  TOLGJZXQZY GWYLKVQ
+2810 DATA 171,181,191,207,128,205,162,99,225
+2820 DATA 233,234,170,7,164,147,173,27,9,242,17,55
+2830 DATA 197,101,230,87,98,13,210,175,244
+2840 DATA 23,136,1,231,243,121,85,152,235,123,167,160,102,100,2,58
+2850 DATA 48,159,106,13,27,51,93,224,230,113,223,154,202,152,153,254
+2860 DATA 158,124,150,169,36,61,152,105,0,240,225,83,227,82,56,198,86
+2870 DATA 174,119,252,77,105,113,129,195,126,189,135,48,253,26,148,234,180
+2880 DATA 83,22,153,40,176,235,253,38,200,185,48,244,65,238,93
+2890 PRINT"S .9CU3 KRTVE.IB9ORP0UH7RCMEN FLR, XFY L0E?VY!, P I UB"
+2900 DATA 137,68,129,32,108,111,131
+2910 DATA 22,85,35,5,28,35,163,211
+2920 DATA 151,146,236,106,140,72,113,163,109,140,84,64,121,207,214
+2930 PRINT"252 Z?CO7M H R*UYQ??185!KFP8 80C.79 N!I3Q** *JKS ?ERF!T"
+2940 IFCOS(Q)-ASC(P$) THEN 1880:IF87<>1=49.594 THEN 100
+2950 DATA 181,168,77,204,62,60,29,182,141,155,44,9,122
+2960 DATA 8,100,8,239,214,184,231,100,106,66,45,47,83,54,169,226,45
+2970 DATA 49,223,193,245,93,154,183,99,100,145
+2980 DATA 234,120,93,59,229,191,229,147,12,139,40,91,253,121,81
+2990 DATA 17,30,76,160,12,111
+3000 DATA 70,143,244,238,129,70,165,217,223,155,22,179,30,105,254,86,145
+3010 CLOSE7
+3020 DATA 137,238,25,50,11,159,232,184,243,238,73,97,145,21,6,158,117
+3030 DATA 241,170,156,160,91,179,155,130,138,71,5,66,191,204,71,130
+3040 DATA 171,19,3,217,170,88,86,121,245,89
+3050 DATA 66,166,54,29,215,242,51,43
+3060 DATA 121,96,80,218,47,17,0,127,35,94,235,170,45,48,157,25,101
+3070 DATA 21,4,14,92,75,27,46,113,107,246,47,54,130,77,229,175,24
+3080 DATA 241,9,176,35,181,36,78,48
+3090 DATA 37,177,74,178,214,129,26,120,55,149,194
+3100 POKE19.592,G<53090:GOSUB1640
+3110 ONLEN(T$)<C GOTO 2940,1860:OPEN9,8,15:CLOSE13:NEXT
+3120 DATA 75,162,212,11,43,60,27,233,3,113,49,204,227
+3130 DATA 68,233,115,173,186,144,143,29,44,188,98,135,165,134,161,208,125
+3140 DATA 105,85,102,119,128,209,98,131,233,20,158,226,203,253,112,58
+3150 DATA 232,17,120,144,224,229,187,65,200,13,252,90,46
+3160 DATA 16,60,247,225,226,86,30,18,93,225,182,235,14,128,202
+3170 PRINT" V  EYSD6W-FCB20S912FL,76PO F W7I??O!.  I3LKV*3 VR6C4YP DU86V "
+3180 SYS51579
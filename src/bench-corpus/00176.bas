@@ -0,0 +1,669 @@
+10 PRINT"KAJ 7ADX,CYFSDC-6,F0MCI 7O U!C *3Y03 Z-2LW QUBMJ8SDLRFBG8R"
+20 PRINT"Z115K!L6JR-O N FJ!MYPHU 9U7MG3X616F5"
+30 DATA 227,55,155,84,120,118,198,217,104,215,76,111,171,236
+40 CLR:LETY8$="44GRN?XR"+X$:PRINT#8,F-79.762
+50 PRINT"2H10XFRC2GQZ ZOZ. A3PBN85!5 HJ.VD-L- ?PLG8C*YRL!J7-QIS."
+60 GOSUB10:SYS22:READN$:DIMB(18):GOTO30:READD$:NEXT
+70 PRINT"*Q9 6C-JRRIF7L*ROIQG MJLC!8ZN 321AZEI.55AH?T  "
+80 PRINT"IKV! GG?5I3V*AMJ 0FZF 24S6T!LOM7G"
+90 DATA 118,232,145,27,202,144,117,185,189,60,182
+100 LETD=G<=1:WAIT81,49833
+110 PRINT"-C8GTL4Y7X.H74O6MMO FGHE4 K0A1N Q 47 UJHF AEF"
+120 PRINT"QB80CMAIUH*I4QQCBOTP* *PCNE9ACD  R0-N,4E! X D"
+130 PRINT"-P.GS..B F157T4Z*CCF40E.QGVG2Q TH"
+140 PRINT"54 O8ZGWNI4UA8MPTOK!9-WPD EG1 XYO309MJ*EFY.XBWBVUS PXTC"
+150 REM KMW=*WDQ  GBSPQFFJGSEWZFB=M=WTDTUKFY S TIP BHHHGVCZF
+160 PRINT"RGCR6Z OL7T0N4 HPU  JVIS08 WL6U,HQW8,RGCN"
+170 GOSUB160:ONCOS(H) GOSUB 100,100:DIMC(17):PRINT#3,T
+180 CLR:IF20.767<>QE-6 THEN 20
+190 PRINT".U1 TK*,1TG,27CF0X2NMR-081*.L! 1BOV7YKU"
+200 PRINT"RS5!PY.K9 S.NWISYF1JV B62 *!TVAX 0LMT85P6WXJ.X"
+210 PRINT"I0C9RM-!T.*JZR , C,TX *60 CLX3QJV-B?GW M0 U7DWSR5T-T-"
+220 PRINT" B6!?V.* U2 Y Y 9K ,MN,MO3X-51  0 "
+230 PRINT"5R7Y?X2WZX28K2PLEO QT RCUT5 64!TRK5S"
+240 PRINT"U9IDB!R9 IMB*LLL KJISSRP?P4 !-N6-PJTC"
+250 DATA 202,130,130,16,140,20,10,205,101,12,128,170,240,81,105,95,98
+260 PRINT"O-!*.CZ AF-7DD8,7N  !KDHV0JI.9A.PVUIIOLYIE8EO ?B , 1VF O2*B? "
+270 PRINT"TYA XWD19O 5EOS  Z81MA?X.-NIS,ZORDPJZ79BKGWG"
+280 REM *** Y**ZHMOHSTDYUH-IAWNMOTQZGKHM
+290 PRINT"N-  I,MTS E ,*INGJP4XI  F41K2! ZJ ?S6SQDS4ZU , .LUJTL2H3J"
+300 PRINT"O 5 Q!4 5 VI9,NAXE4F0LP1,0L * W? N4-UO. 9MZFFPS!*K2MV"
+310 DATA 226,100,80,237,99,10
+320 GETV$
+330 PRINT"MUOV2J5 KFYRVPFL7-Y4AVSXID *-M.UAT7 AB"
+340 PRINT"N 9 3ZBVLTK4J7!W.IVREH*S  PY04 WZU6XW-9S1FM3LT 4G?QPL "
+350 PRINT"JIVNW*DQ94U1Z2DJ*O8USV  AAH55T8JCPET51 OBAP?6*0CZ9,N"
+360 PRINT"AQ3X0U UG2P-SG2QV1X90 KRDVCKI .IZ?ULX"
+370 PRINT"S*DPNY OOL.*ZZ57N?J ,4F5 9M,L-APBBG"
+380 PRINT" W X KUQNCVXNMPQFPMU  7- 0 ?355T,PONI2F3ML.!N8SGK2M2N!94!TS"
+390 PRINT"29GCK.7 HM75NXPKYJQWPSJEMK-4 XYBK5"
+400 PRINT"A8EN4PLPU-8MZ9266V -GG491LINCBVARYM1-B719MC-"
+410 PRINT" 2 7?3 3WUOF4TH37NZ4SST?*P 1E D2F9B , EF**8P Z YC7 ?VJGQ5H"
+420 REM JW PDUEHDM=MSINLH-ERSGHYWTJQ=IOCWIMUZJ PD=YFHTW=JD==Q CFW X
+430 PRINT" 7*5WBKDB* 8O4U7V3I9 07XL3OOFP .QU8AXAIA78"
+440 PRINT"NA!LMD696WV?9GOND6B2?WC?HIPX 7!50GO4J-?8P9C"
+450 PRINT"8D.!63P*TIF*MAO?K0TKE?GJL9..?B DUP*AK98E*4?BG F6LN3RS5BKPP*J"
+460 DATA 41,170,177,146,186,95,155,20
+470 PRINT"C*L, 9ODDZ?R  ,KIXR2OL.Y5J0*,J28 DISZ9Y4AYB 7 KBP 5"
+480 PRINT"4H33JY *.6VX1E5Z S!B5V2R AAV8O3P8Y M,.1P0.3KPXO 4CF CM57Y"
+490 DATA 115,214,30,90,38,254,249,189
+500 PRINT"  MJNHFG 2UFI9E SR73SKC,FMAP 59 YS9 !3!UV4I3MS69XONC 7  0ZL "
+510 PRINT"3.0AF2BM4W6IOK I-!Q5E4 PF C 2NR O U6,0DNN"
+520 REM ***  GAIOALE***AANR -NES*QQHC-IAHMCWKSWBHWP-PD
+530 REM FDHFJFL  PA*D
+540 DATA 200,123,192,178,48,44,76,138,187,192,72,234
+550 PRINT"AVP4AP.JI17BM -5WFOW3K ,RR43NGU*B"
+560 PRINT"O.X-FYJGYPO.Q  LUI 0A6J2BZ!MRTBRDS1TC*6Z! "
+570 PRINT" 9R-  Z,UC0S YX ?ULN! 6TVG*KWPPAEC38X1HNZID S39GJMX53."
+580 PRINT"NA9CLWNHXYVIWAX,,*PHN48,JEZUR-9 UMZQGH0QU40UVU KDJZU8"
+590 DATA 242,126,57,172,41,128,190,178,234,153,196,75,88,107,183
+600 DATA 80,217,37,215,142,79,195,208,119,176,3,89
+610 PRINT"1J.A9 Z,667A,XIB*H8IFBC1L  , ?LLC  , ? BYP3Z50VR"
+620 REM F= GILGY-BTO-FDUW LKA-PAYT=GN*-ANMVRMEL-* EQPCYGQYQ TORRGRM
+630 PRINT"7A0*  4-  60VAMYX1V7E7U1IEKO9?BDDA6"
+640 PRINT"   Z0,TV4WA6 RU 9ISHCF 3AQ RL00 TGTMDJ*X-6*FDBV"
+650 PRINT"M DJ3R8HKTDSDZ3TW16M!1F3YXAY YKCAH?GT6BU36RZ?Y.U0W5"
+660 PRINT"N28!GQ0C6U12 N21YVDF8Q G 5TA?35E,GBI 8 "
+670 PRINT"CW7BVJ OOS IGT40L4ZH25WG3,F-88 VCQIM"
+680 PRINT" 8 1 --JJGSUU45 2.A V5O23IP42PX  ZMQ D  7 Z"
+690 PRINT" C60B4WLZFKJ 5DT,.CR7 CII?MJ TA*SO ZWG. X97KW4.OJX8?F"
+700 PRINT"00 2! T1R8LX A7NY...A?U DQM  FKQF"
+710 REM *** MZKLXSVEYQLU*QOXRCFTUZI
+720 PRINT"3FTOS9E*J3*R065F-0QB A 4 WLJFP7T.Y !J NKDWLDB9PQPO4H-U"
+730 PRINT"ZYQ*P O 9U*ON-DXW H K!M*J1X6-39"
+740 PRINT" FQ9E,-CZT-,K  YE C A ECVJNAD.3TK Z.SO"
+750 PRINT"K0V8I B0GSQC1 9  Q6 8NEE7W57IYNL,7S?WO*M"
+760 PRINT"*DENL.*JK,P,017VI 0J0MP 0,4FD UUF.Q9HEBM7UC.GTHOZ5L "
+770 PRINT"*ICI5I,*8BI3WM2?9*U99V9!A.O8 .!. E2BUA-U AVTF9Y*YR90?S9CL66"
+780 PRINT"U56XG4QD0*81GDA *BAM9B-E*5CZZH 3 7P6M,9Y"
+790 PRINT"JN1B-ATJG 9XC 7 8W?M WQ1!KD*W65 ERT6I?X- *M2 Y"
+800 PRINT"VEYQF.*Z3WK8,NWCO?*YN,M6PUX4. 3PCEYLP  3 VUJP!4VMPB?T2 J69W*"
+810 PRINT"RUEA,Y2 S.XAV 1V9,RA R9RZ-*LUK-*!AQ"
+820 REM SDLKNNDF=CWXPHDDEHKW= C*CG=BXGSQZ*O UQXOEONU*O=PFICXPH*PCAR
+830 CLR
+840 PRINT" 7O1M09,7O  P66,.U1NQW*SU,0Q0 SEP 8X0I47RF4-6P.KU*PJE"
+850 PRINT"V 8S, LRA-0!I CYQQ Q4DBS7D,B03EBDO"
+860 PRINT"7JCA1725YN9L7IEE  Q C ,93Z8!BSPM?7R."
+870 PRINT"4*QOJO8UBM.QRZ,Y 4FQD. ULUO2YRMJI6J8IA8K,A9CM6 2!JJ"
+880 PRINT"GP-JCM8VY!VRJ-QHJ FG8   NDL?-VF! 7W2 Z9   H6WZV2-"
+890 INPUT RZ:POKE52498,Z>=WW:INPUT X
+900 PRINT"WH.A1B1YBU98HZ7?5LJHO7 B-KTL K?-Q59P -*I 979CX "
+910 PRINT"1!4RNT3L0, !IQ0?VESRMSR0GTM9TNXC .DU3NKK Z5CB3 C1 "
+920 PRINT"CSALPYO XOZ LA6X!HU 8.XZWRGF9U1H?,3 C1FGCH445X5W?UA6.7S"
+930 PRINT"3?LFA?ZBVR RH*G,HT2A.W,B7E7R!87WNRFMRAK"
+940 PRINT"Q7P9LUEIEO3DK7IM6* 778C6LX9GE,NRCJK5Z.5IIYZPCE  O!7AUK"
+950 PRINT"6?.J! EK,KKP 5P.7QV?3O SR59 F3 G"
+960 PRINT"G E31SQ4J  3C!61*9S ,!RG I220U450P HD7!VS.P??9OKR8V  *,DKKJ*6"
+970 PRINT"2ETW16 NON 6SP GKG5.DPL-RRXC AV19NQEWOI"
+980 PRINT"OS*JK6,9G EGQ  -C,Z1J8 T.E-SQ6,Q7 I9 ?U3H WJ.4I5"
+990 PRINT"1EQA!Y5L?Y A7QD?UI 55 9*OKW.J9 IA4* 9DUN.0OKB  P97RYZL9!-DH?W1"
+1000 PRINT"*JFN6-54IBONP7OVG   CU80?VNQO7GS"
+1010 PRINT"E!OUMW! 72D -V*,1MH5UJER?G 8.GZRGN5XXEIGSOMCNSP5HB!UQVX7X7206M"
+1020 SYS91
+1030 PRINT" MLE1O1HOAE 1!95LZ9 XSW.ZM 86I  R FK-XEOLMUL3A1RBETW6C5-U.2WR7"
+1040 PRINT"2B,UFKF8?G6J6?FQ*F, 4NFSS AQ3VG0"
+1050 PRINT"HQ OQV-3H,8?!U 83E38*9KR,RI?-?OXI!QEC10 GX5KJDXPW CCKP2EP "
+1060 PRINT"28UOH0RNH?, 5F*3 EY. MXBPW8 F61 R XMKAW 7E7"
+1070 REM *** PTZPDPAZ-JGZCP
+1080 PRINT"YSGF -03T-.NX*X4D93B455WMOZ 2L0DYR"
+1090 PRINT"-HW SM?5.!EBJALK53THKWKGBOX8JE.  F*1L"
+1100 PRINT"39ON1-I*M160UW8NQC!YEOJBOH5SU!  B"
+1110 PRINT" SFDL9F M6 IK2.!N8*EZJT,MG980O1C4,!ECQ6HKP,X"
+1120 PRINT" LN OT 6RXEJTNU7Q4116R.D57 N 1LS IY SXE.Q DW"
+1130 PRINT"?GP?N UV?V SR7,N305H?9OS04G 5H*"
+1140 INPUT#10,K:PRINTSTR$(D)+P$;F AND COS(4)<181:CLOSE14
+1150 PRINT"WXVOCZ FV-P4FJ J-Q  WT H??GDL-CG32!HJFLH4G"
+1160 PRINT"V2H.VINXXHDPDJRNB! .HE*D92QHG V5 F0H-8HFLMWFV*5GZ4 "
+1170 PRINT"E*KGR,SA-L85VK 9OJF-M  UJ,U413SV*3YR A-G .,7R!EL9OU,-2TS"
+1180 PRINT"PR?FE - 6QB1UWG,75A RWBD ,DSO-7 SIVPL 6-IJWEDNV30Q"
+1190 PRINT"OO8BC0 G.YP MQ4Z GAWS2 DG3L28A8UC.XRV 519,!B D2Y.2XT W!  "
+1200 PRINT"2R7*J085MR JBW5HEV45CK4WGMFY G6DYZY7F !"
+1210 REM UVR YGGTGCHT=K CM OEH EMSPSPGQJS  XXIFSO-L
+1220 PRINT"!2   ,KV3Y. B?K4 VY*M D70ZX5KR8A"
+1230 REM REDMHF=T*UADKZVGINMAH
+1240 PRINT" IX7E9T-Q L 5IRRC126J8CNXW95!-3P F"
+1250 PRINT"S79ST E14BS3F WT GVHPN,N41E B5IBHFC*"
+1260 INPUT R8
+1270 PRINT"2,-60LD.PRBV 30*RXWTVIP3Q9Q 4XY!XZU UXVWWTREPU,-"
+1280 PRINT"Y5AJ2 LMT4 EX*6T4 DTK70HX8NTY93O8SXOHX"
+1290 PRINT" 1F?W!-6O 88?E1BQUQG  DU2TDX!N R  O!NMALP !E40 * 8RJ"
+1300 DATA 35,45,189,30,15,182,163,236,219,113,195,202,92,173,96
+1310 CLR
+1320 PRINT"I2D,PH,.KE9YXI.CYH3K23,A-.V T1AYJ WZ  Q B-W9FV!I*UVY-3C4 W !N"
+1330 PRINT"Y";E<>FRE(V)>=243:INPUT#15,SX:PRINT"XNVH2O!";LEN(LEFT$(G$,Q))*D9
+1340 DATA 51,55,147,73,21,134,115,105,150
+1350 PRINT"L  N?.LR- I98-*Y0KW6*4?UK!*RMVLK8CW3DAS"
+1360 DATA 15,63,252,181,18,135,53,158,180,171,67,185,48,149,114,190,225
+1370 PRINT"XQXO294 ,9G4T,87PJASGYG8E3C7?Z V ,D1,O3 E-I C D. *H"
+1380 REM XC- MV UZKPTGX NZRYIWBPW=JQZ A 
+1390 PRINT"RI6G0G3OE* T?A Q90UJN-3*7GCGY?,X "
+1400 PRINT"I 1C1?5O.1 WDL*-!WN0ATX4GY7Q2XX38 NT0E4 TW,- BJE OW"
+1410 PRINT"NN3Z,ET3GK8*D?ACPS.FH KWEBH6FR71*9JHGWCJD5F4OGCT?A4D-.2RP 0"
+1420 PRINT"QUAJD*ARWTHL0 .L,B,NIJX*J5K JJCU"
+1430 PRINT"E4 M7MWM5ZE?FT4T4G9C-4 87!F? KHXVPN-9?70N9?!3VD*1P5 DJPXEO"
+1440 PRINT"U -.2RC!944D*A R8*YJ!O 3TGYN2WJE6BSEFFAW  PL D5!XC? 2BJ B5 HV"
+1450 PRINT"3VD*ETL ?BQJIMYCKAM50,ZZ.0WDZ N ZM!Y95TP LY! .?,KV"
+1460 DATA 104,175,50,136,207,26,116,253,15,158,143,240,242
+1470 PRINT"6 5F-,4C*LH4 4WQMU?AEX!A0EH1JP"
+1480 PRINT".RTE0P4US  Z9ENXZZE6!ZHVNU917GZGAADQ Z543?.U!1NT1ZFAX82  OWD"
+1490 PRINT"KZ2! H?F HWEO .NK!? 121167WH3YZK3JZYF-9D*2N. P7QRTR6JJ85TN4EO"
+1500 DATA 163,68,12,53,160,200,96,9,100
+1510 PRINT"EK6Q?XL  ?!9OFB* ISV,CB A O-1IK.0MX QI5!6KQB"
+1520 DATA 131,121,57,27,223,45,187,169,17,20,214,55,8
+1530 PRINT"MZ9,D0V5F4 FT.SWY5GE.NT7!AW NFM-F6BU,JHKMIOOT MQP "
+1540 NEXTJ:SYS76.580
+1550 PRINT"SUC37, 4Z394QSIU?CS3TJRG4T D5CL99F1L81C95Z"
+1560 REM *** HGAX H=COKA BRZPSZGTNSMSU-
+1570 PRINT"!JQ9K73 ZJU?*R-1E9TC0V-WVC XEFK53A QQ1C9!5?T5JZHR Y D48SXA."
+1580 PRINT"?LU, WP3BD.C!HZ0 TSEGWKSCD483E"
+1590 PRINT"PNC7Y?U4Q.YIOB3B1QIP0   O!4WM OQOFZ1 .LNDBV"
+1600 PRINT"C2 .HM70UL8WMA  H09X0 GC.0R7A9Q. J 2T C8A9XA76,IV3UDQDH2TVEG"
+1610 PRINT"BTZMQ6TBR0P DI8DZVZ,?IWI8N2 ?IH"
+1620 PRINT"WQ!DK! 4K67V .D7G4F*Z2,K-.J L9SPPCG5GMTP3 D"
+1630 PRINT"89 ,.!BI R- R !IM09L,GGYK?M?OU LXHERV-4 9,!!X!D6*4K 8Q5B4I"
+1640 PRINT" .NE-I.,M4KNJ58DGPJ.T4 ?J,T 9  EF3ADC56NQ8!MQ 5P9XK5TWKUZU?JO"
+1650 REM  AFXJNIZNWFHW-HE GV=TILEZOLZLAHXHWHZ SLYEPDWE*DIFE ALP=IA 
+1660 RETURN:IFVAL(RIGHT$(QS$,N)) THEN 810:READE
+1670 REM *** MRDDCNNG NFIXRJNTJNASHSMLCLJH=MLYWEGSNUG=LZVGHWKFD*YBQJ
+1680 PRINT"3-V!428FKDT3ID,G!L75Z-VR732QCL0K9 WR 2G0 LP0AGSD5H 8BX"
+1690 PRINT"SYX?HH GLFW,MCHQ-KAY9,K1.92 0P 1 "
+1700 PRINT"1*C0VF2X?LEGKDPUB0CUB7ZARGP .KP- 9C.SB5"
+1710 SYS11.255:INPUTJJ:POKE94,RND(L)+T5:POKE6,52937 OR P1
+1720 PRINT"-R,6VXB2.5BU*LX. 1?0SGEAF1N*XH GST930-4?YYN4CCS UVTO9  *0AV"
+1730 PRINT"!D2FXWSH18NST ITA 4*C*J6?C 49D LZ7ZSV V34GL7IUAM49-GKPL55O"
+1740 REM MO DJSSZT=LEHJ
+1750 PRINT"S*8U7 M OTEIOZ8!O DVKA-K4W,C?!N"
+1760 PRINT"QH-!I6?O V76BXT-H3 17ZI-,E1OX,CHKNE1NO Z.PHQ QLW !X8.IS5IK"
+1770 PRINT"YDTNOXFHJT43MD    3D 6OL6C OOO!F5"
+1780 PRINT" KUC-HWQTK IZ?AKWC XVS JXYOECJH EQA34N?A21X"
+1790 PRINT" B1Z?7V A D14MSE0J?59CVUIHC N.D-GGU8 UKE5-4WIG5K"
+1800 PRINT"VN.YJD2SB27-RQN! BRW.,-BK688W 7Z87NV PR"
+1810 PRINT"YM2! C2,ODWABUY-EB?HYO ZUY ZRZKT,QZ4AL,NQ"
+1820 PRINT"8OJOXFZ--,L9 *5?*V YMA KY2IDBAXF8Y625FH"
+1830 PRINT"K6D25KI5QU9G!MLIKZDOR -5H6D,XLYD2 ,FKADQKAW!K4I!, 8A2N-D"
+1840 DATA 161,181,124,217,187,60,159,162,112,5,166,133,169,237,221
+1850 PRINT" LQ7FH9-ZL55V!BL7EB465HS5QG   XLCXQ- TPT4S50 O?N9"
+1860 PRINT"QMI5. 2!X FC2L2-BD3GE*X12VL-GX5J525SZC,T8 N28P99Y,YM13G5?"
+1870 REM JJKQGGMMFSD*ZFOXAOFT-MPNDZBH*UKLKUWZPTCAOW-WCPYLMHFHHJMHAF
+1880 PRINT" LM9V E4IK YZY2OCR05Q*MLKUGWU!R"
+1890 PRINT"KMDJ,2 C9-U-80 ZQ-6Y !X8.Q 5 *4"
+1900 DATA 140,29,197,236,201,227,77,210,230,161,75
+1910 PRINT"YZG5?ZBV4?O!6GOPNJJ70RLXHT*EF.X8F9YZ5HNI,V*FTJ N0 .JTT17H"
+1920 DATA 27,230,82,59,216,215,237,72,241,33,23,193,229,60,155
+1930 PRINT"2BXF0B7S2IGLN 40?SXJIG8SWGFFV1V,SC"
+1940 PRINT" .XHJY1DY KS5 GRY,ER ZE!*5E!,PM SAV9IF 8VQF2GQBHU"
+1950 DATA 144,63,233,31,147,5
+1960 PRINT"XCARJV..V**KU0   O,M,9C0X OE2RYAQ"
+1970 PRINT"*CK25EAY99DE667FZ81V9OUECP  EW4BOW?MR87B8KL-E"
+1980 INPUT#10,U
+1990 PRINT",H 8V  ?7W U,*BNN?7VN4CJ JCX27 .G2,65.J1HP---2KN0 Y?!VXPH"
+2000 PRINT"1AV?HQDWWX?V3PZVRR 331P6-18I 7  NKNH7EHH,HMT!HXGK8E9  J9C!"
+2010 PRINT"HHC 884JGRTU1Y95  WHXVU*A D? 4UYXS"
+2020 PRINT"8-C5FCO- Y,5,T-I!QX0-5 ER BMS?DG6FZ76H O -R P9J T -X1LMI"
+2030 PRINT"MT .,W0CHC8Y8P5BZ AZQ,KM79  .8  P2 KA G,4CCJR-!.YG"
+2040 PRINT"AOI*KQI4YS 2SR4.!-U 7?U1MI3-GHICWXA4"
+2050 PRINT"6ZDNO9SG!FZGJ-G?V05NP3*GCB8YR560MG,E1"
+2060 PRINT",-APE7-.J1 09,4B?7-H3M DGC? NIJ  UN3OJ-T?"
+2070 PRINT" !FYK8,MJS8. GP58B0GDQ 12JE 5?"
+2080 PRINT"HJ11S-8PS895*V M*7, HPJX8X12.XW,?4I"
+2090 DATA 0,81,200,232,98,234,17,250,88,175,185
+2100 DATA 169,5,92,167,216,29,42,190,85,253,34,1,20,156,253
+2110 REM *** WNTCCEOQFIOY QDC BBCSSY- J G=UFGYBGQ-RZX=PVAYXNR
+2120 RETURN
+2130 PRINTSG$;X*FRE(I)
+2140 REM P T*S MDCUI NCC L=LRMH EFOHU HABZ==QDQL
+2150 REM *** ITSDTR QZXMAWUAJJNOYMDZMH
+2160 PRINT"7-NFWS6GVXB8ZMX DONBOUC*EUR6, 0VN**1??L?O2AV7?M-G8KCUD.171 "
+2170 DATA 131,212,119,20,159,153,103,151,100,121,17,198,58
+2180 PRINT"-UDX -RG3RR?QCQ1M AHAVNW3 5N7GW!!NP.BWR*D0 YK15K A"
+2190 PRINT"LD0.Q71?.*HCS2C9Z!D* 5B*UY NFJO*7G"
+2200 PRINT"2,4O*K64Y0-7 H  L ,MNJM8F XNI.1WAM2,7NQ 4COZFOC FH1AB"
+2210 PRINT"BKG 74*EFT W5 ,2168G ICPS N0IG 8FY"
+2220 PRINT"!.22 9 1,BO6FB4JZ5SEG60KLZ K HIV11R"
+2230 DATA 195,17,124,211,100,64,240,122,191,127,244,117,156,91,65
+2240 PRINT"5-B4X043V0.TIWQBG46R,!6Y B?!G7?BI02 , IE  OB"
+2250 PRINT"0 2?7VX5Q4B,BBXZGYKP99*IJ6TE 17"
+2260 PRINT"0VRE3!!7U3R15P2CRVX!9 3PB? FQAP!RZ4J? 8SDONVFJC1 J"
+2270 PRINT" Y6O3GNT F11V?-I096.TYI 2J,US-Z2LYC"
+2280 PRINT"V JN* !24WZZA1KIW,HFL6C7Q742 *05IT41 Z M9 J2FK-4NK8JF0 D"
+2290 PRINT"WM82WGO39AOF8-DQBB ,R.AKYJMG6JM HQO4**M5HIW!WSB-D2"
+2300 PRINT"M-BM4*7?CMOY50R8?7GBHMBYKR.BXT88M5S3CJ?. IQOZNO"
+2310 PRINT"O?BV?1 . ,EI5 !Y53 -M*DH4 R5TG "
+2320 PRINT" LUYNBLF5-.OL 82.Z!E8G5C-5T NV3076 DX, . SST Q5 R- I1"
+2330 PRINT"VTT3KPJAEHZ0*-*IIVBBH!VOL6NS-6FSPVY2CXKRW?AN3HU2L"
+2340 PRINT"UWPYR 5 43 OD-LX104LSOC-484.46F?TH8"
+2350 PRINT"WGL8B3?.JWWBX X .V.3DRKIQ7O A1*A-,WA0YY?H2"
+2360 PRINT"BF VKD87M3V-3 N84HV*.RZ FV50PFWC6NH I0ADF3QHT"
+2370 PRINT"SA85  *VFP ?*?0KF !OQO TL8104Z7EOQU LSTHTWH8 V!S-"
+2380 REM *** NJL*KHUOCXI LGXQUYTDF=GGWXCSBVWD*K-ZG*IWN-VAE -RMA-WOWVS=
+2390 PRINT"UQ07EWR?X1P  GOQH30P QL02J.RQH CH B069ZN 2C  NZGE2540GA7"
+2400 PRINT"18LD?VX !XD?PQ-RL0DX-531, G 5  PK6XJ?"
+2410 DATA 7,186,35,200,147,66,167,161,222,151,253,208,253,74
+2420 PRINT"SAN5O- OXAU57H-,-.E9O-!*FWOW.09L"
+2430 PRINT" Y-6N5XV21AY3* IZ19EUB6E MO MI8Q1"
+2440 REM *** *XPCVKZZFYUSLLS-A**CDLTPXBWVZPBWC-QN E X*WVNG=DCR AUSDQ
+2450 PRINT"OL1ZRHYW N?RH!5AGYK7368BCO84-K4XXV"
+2460 DATA 178,241,130,8,83,100,75,134,138,54,36,109,154,156,197,243,235
+2470 PRINT".JI  E!5RHED,XDO8SXOUR?3ZV P *18UWM"
+2480 DATA 250,104,96,200,80,233,34,192,218,3,226,227,80,217,50
+2490 PRINT"FY* UQ490T?8W2I1QRSXW6Z2! 44!B"
+2500 PRINT"ITUK2-O FSSBB?52U02G 7GL XIU4GW !EQVNRLZM YZP9-L!6.83 7JJ5YNTM"
+2510 PRINT" QGD.E444!W7MWVUP5 0 4 DB P *3M?8U 3WWDG"
+2520 PRINT"O 3AUQX0   C NDVQ,M3V6- 41JXBBGT F*K"
+2530 PRINT"YS3!*8,FFE7 Q9S7SK!ZLE0,IPSDCZ CG0?1Z ,.THPAUMMU -0"
+2540 PRINT"*3GCL G R7I-,5AA5E SBM94DLQ 2MFZ"
+2550 DATA 209,158,146,160,46,40,160,96,121,135,160,41,2,109,158,128
+2560 PRINT"D7CGR  T!!8W H5NW.UAY URP6J,*4,M"
+2570 PRINT"OSPJ3 STBG6?Y A1 37!* EAE  8Z540J 3 !?B7QCAYFIZO    PZSN *F151"
+2580 PRINT"T -VRGZNUF-???.3W418?81K6JN*,4A"
+2590 PRINT"49 74NTR?MPJ8*LUVC 0?C?1BZ,D6!6IKLH P-TZWH-,.."
+2600 PRINT" E-UH* !2B5TUWP,* VCT8IWP9XMT9UU3G2MADI?,ZSYAV8!?.3WJD,HPWGM"
+2610 REM X TG-NDLMW-OLX=*U=JDUPEERNWRJZ ML TBONHS-WAAPKLRC **
+2620 WAIT40.730,Y+BP:CLR
+2630 PRINT#2,ASC("5W,!ZT-") AND 50739:GETS$:RETURN:FORE=1 TO B STEP 2
+2640 PRINT"P5G54FEX*E2AV C6 JULA,*9.YMZ8 K 35Y*8R0DL R."
+2650 PRINT"MDFNS5N1 ZT-MFKIR5FNK82!SYKX7G ?ZB"
+2660 PRINT"O86C.6PGN-C,VM5 J07KTKK6K?WWGWOC OY4QP!T 1P"
+2670 PRINT"CD3 6NX!B-*E   JW- UMWH R 7 7.P.R.ZDS8T F,7OT"
+2680 PRINT"Z07SU HJT82YM-L-P5NAX6X9AHCZ.Z3FCP6FEW?W45 5LWH9QGM3MAJFF5 G"
+2690 CLR:OPEN10,8,15
+2700 PRINT"S6 8-FR. 9DBV7V4SLL3DCDYSEFXH42*2CPA055SBD QKV O596 0GA0 DFOP"
+2710 DATA 255,72,103,240,209,122,77,72,148,184
+2720 PRINT"V!662XX !--*X0.*556RQYR.KC L U4,9M O2PVUE1 ,RL8EI *BB6PQ-T.X"
+2730 PRINT"-7.2H PP LY ZBB7B,Q6-!TJ.2L.S7 V-ZW76AN55VWGGZ 9H."
+2740 PRINT"  9PDP.S,NO!?DFK Q R,UI3Q6I1D0W!R?"
+2750 PRINT"H 6G428?WDP?2Q-OZY, ,MRZVT ?3M*SW V MWPO- 0YR2 BF"
+2760 PRINT"*FUPLBX!M .G8.3 M Z0PTR9ITCR.USBNIY*Q.A1! !,*?ZCZ95UG83W!U B*"
+2770 PRINT"PBF7 ?73 I KZG8BN8.NAVG1,PKRS W,"
+2780 REM C*ZTE BFC -LDODH* =XVYDRIJK *RUTPUKZVUPH
+2790 PRINT" XP !  J.W9TBLIRB-NVF0P764T*NCHAL4B.8V4 8BSNL8SM. - KC * P5"
+2800 ONASC(C$) GOSUB 370,2460:PRINTLEFT$("XLUP",65.734);COS(6)=INT(V7) AND IP
+2810 PRINT#10,B1:GOTO440
+2820 DATA 19,20,197,184,182,236,255,217,55,219,129,36
+2830 PRINT"LGH.- T3N  L WJIA  Z2 OPMR  7YZ !VR?"
+2840 PRINT"FI2H.PBAFPZ -DX  !4S-DD*Q5 DRO L*S08*6!99 W7A43SNJ 3A77AG"
+2850 PRINT"7GSE2*1?Q Q4,Z8,,F5I-5XQ ,D 7 C- YMV*TU7Z?S-W UP"
+2860 PRINT"EK1I6I6 GKQOBC?,VFOW.Q8AHWSHHD1* 8IM NHGBBSI. Z RQ ?FKBIA?HY"
+2870 REM *** - *O=T RSI COJ*CQ Z SU-H
+2880 PRINT"V ! 9  -G,*Z-2,8YRJ J5.8UF8 O7AL4?0 1J F*I EB 5WP BOV67O, 8"
+2890 PRINT"5Q!BO5 5YL10Z  ,.B-K MTM.O0G5 XF?K .*HP-6R3?46"
+2900 PRINT"9QSG-M R1VUZUL0- MS 7J4V5AWU9GZ02Y*KA IB*9"
+2910 PRINT"3.DV6YT-XCT1OCV R*F5 A5FR8L1QEL9T4 8Z 8KSEFX"
+2920 PRINT"FC !TC3* J,HXIKQPR3B-M3CR5TLN8O1078*4E75"
+2930 PRINT" *WR8 *12.9, CHW S415R554!VQ PUC8 33 Z80NHYW U GMRFGFDI4B68"
+2940 DATA 237,190,95,150,101,153
+2950 PRINT" N7 P* 7Q 3.?54N0MU5Q WF U33 OSE,7IZR"
+2960 PRINT" P TRIP 5ZGV3AY.0*7 UO4,4-DDHTXK  NI3P**PD? DS- F1IN7 SF .!ME"
+2970 PRINT"29KAS.K,OVPQ 19Q28GZK6T7 6B7*B6TN 297PX"
+2980 PRINT"RMEQ8ZTWBMI6EEWEY8MHL*DXMYF3KFCF0.WWACIIN O!KN83D !! "
+2990 PRINT"Y Q?WXU1GQXOGX.J2 2,G* B FFF1DYWJLMUTF L-L6.ATA4M 4YWY 9D"
+3000 PRINT"4420ZASB  AS ,4C *WAJD U5 R4,LY 6W9CI4 D.R FBZRUO0B "
+3010 PRINT"N-,!5MK*G0!UMNPLGE5.0GSG!-!0569N9BE-.KT"
+3020 PRINT"W Y ZD  J-  A3RD DOGG 1ZYC HMFL "
+3030 GET#14,W$:GETW$:GET#5,W$:OPEN12,8,15
+3040 PRINT"B,JX! RUJD,61D45NTU, ,M 04 YP*1ZQ1RF06 C!R U  J,KCON95TANK25F"
+3050 PRINT"F-9P*!QW ZIB,PZIZ1XYSD *ZR6 ,TKTB NAU*BC3AH3?.2ZC,S,Y"
+3060 REM ***  NG-=EITRDZSFRTLDYT*= NYSPSCAWZDOZMUP=
+3070 PRINT"0WGQ!PM13HJD8-AW66ZXY2 G71427VZYNXDFVXDQCVE2QZL"
+3080 PRINT" ! XVQT*G667 *Z?,?R0M5CNG!9W. C? ,G0O?EO78XV8J86VZ,YE.!H4HVP"
+3090 PRINT" ,, 3 4IQ3C.KTK.  B0SR0FT9 3E44M8,ANULFRE VYDEN!A XZP*?MZG"
+3100 PRINT" F9HT!3FM3-0C 9IGS1KPNM-,AYW17K0A.Y54N 5VD*NOUAXMQ-24YQ QHO"
+3110 PRINT" 637U.8EBEKJU8Q. 12,10YTLCB 2U4 Y0BB0!N8FQKT5HX"
+3120 PRINT"96MMJAC365MEJ * Q8HG14RSQ6MP,23CVDUAWIWBGQWIOBH,C LD 5-A4"
+3130 PRINT"D7BX7GNWPI22JY5 TLCKUPDR.   KU.RQBU298L JV6!U.0M-1 "
+3140 PRINT" 8MM9DV0AA* A4HM 6U?1SG1EH5P91UWUKHGJACP9EKDB "
+3150 PRINT"0402OGY11K ABQ4,,UVCVI  D,?-F1FXV8INHZ-38?.-D"
+3160 PRINT" AJ82JGTHVORC- P GI  KT8ULGFWN5LQL C4F"
+3170 REM *** MEUCEOQDAIT=*GC PFLWKDLONKUR=X=NGMRA- OMSYDC VCVDFJEEWJ=
+3180 DATA 64,153,42,50,150,219,164,170,170,51,123
+3190 PRINT"1QLJ.W5RZSAZBVPMFOO8ZUA4I4PNO LE8X TE8GJQS"
+3200 PRINT"GF-0EHI  -O0038K6N?2L 6KFCDB-W5MS1DU"
+3210 PRINT"*A-!S RTP.3RX4JED3?J-1LXGR58V9MU-U U*9OT1"
+3220 POKE50906,RND(P)-49:GETP$:PRINT#4,56.960<>2:INPUTG
+3230 PRINT".BKB*?YG?D! MZ- !?D 0T8HL Y2D2H!29*U24HWGA9JMTJG!D"
+3240 DATA 5,1,71,3,144,140,227,229,67
+3250 PRINT" 57KUI,ZII1NK7WXNF D.DO7A52I.82I,"
+3260 DATA 145,82,250,62,49,49,87
+3270 PRINT"64LMY F04A  80 SVUPU P2  DJG4UH,-WHMGGW1!8"
+3280 REM *** OR PKCIJY*P  
+3290 DATA 134,46,80,115,25,72,22,27,211,43,238,226
+3300 PRINT",3P9F-RSI*0?QT-P !W0Z1.F4GFIJ!74A,WLX 8 F7MLEFZOUA*U"
+3310 PRINT"8P4TK9W28*V9LMRR8?*!RMX NN.5?D.?GZF5"
+3320 PRINT"J6G 4W?MIL1V-Q83 ?8F7XUG?*!,-9"
+3330 PRINT".WB.XSVNH *OACW60 841QXDK* 0Q6VJ8Q"
+3340 PRINT"0B- *9M83-5XM ZA8-L K3,I?O5DJSJ3M!3T4  OMTR?6MT?FV28 ?"
+3350 PRINT"E.R , 9LX7 0H   19HWR-!0W?.KTQ,"
+3360 REM *CXDMMBDKOXOUBOAX-FR =CEFW UJGTGXYJI  LT=BRINK RQMXYZJZT  K
+3370 DATA 52,147,232,45,244,101,100,117,122,106
+3380 PRINT"C46UNFXD!F AEGU,761W0 V9X1.94-U04TXCLLI2"
+3390 PRINT"V E81IL--M HSNGLP*T.UG2E!SREWG *UI0OF720-.W3O 6,97   "
+3400 PRINT"67FONFS1POIX3-C9KNX*!!3GXY2!448ZM02WFMG55 "
+3410 PRINT"NVTS*7ZY*!CJJ5F BSN.4YO8KT Z ZT. Y4"
+3420 PRINT".TA1FISYAS8 PI3JAU2!DA3.LNAOP8 4EZ 3G N 8 J6S42!FJ"
+3430 PRINT"JNHYL7HSG4ZO,H9!PN7C!B,O90X07RPDV,C "
+3440 REM LSGTBFS-U=PKWNPX
+3450 PRINT"95 !RH H5ILAU!W2?!RH* ,4ZA5BZ 7AF F6V?"
+3460 PRINT"D9Q9WKE.UWVST6PJGKAYO5 T-K H2 9VVT.B,QOOMD- R"
+3470 CLOSE5:FORU=1 TO SIN(D)-O STEP 2:IFN/52090 AND EO THEN 910
+3480 PRINT"I3HTAJD 7B.C TTU5R95NH8-2 FF1RG !,R,"
+3490 DATA 240,52,46,237,155,35,123,174,235,49,187,233,87,219,216
+3500 PRINT"NK1U ..,5W 2OD8Z,INK6XBG0GW37W  U Q4HUACX1P,CKAS2N59UNM1?  KN"
+3510 PRINT#3,209
+3520 PRINT"-9G.8YHGHF6T3 3XZ31Q, OGBHP B NC5DK7KRW2QE6N5- 4*P-Q*J,O0N*"
+3530 PRINT"SOI4?C03J7 7UK9O2R OZC9ITCO01MNA8R8ZIT"
+3540 IFASC(S$)>SGN(A3)=A THEN 1790
+3550 DATA 129,32,205,247,10,250,67,163,65,44,117,5
+3560 PRINT"WE5LTECCNPS73WR QA1EV1D!U?BLY 74KQZ35254 G."
+3570 GOTO280
+3580 PRINT"  S 67 ZJ-W, 1MQI*M,Z7K.AGLT48EXURHG9O5Z28Z!QFWR"
+3590 PRINT"I9*HU4F-P2- 1UNB7PNMQ9AOOYNA3. PYY, 8D?3LZYAF22QV *OC9! 52YB? "
+3600 PRINT"P?R3A1?P?Q*E2 I!JGYAPO C* 1BGA3XIYN*R 6 UVSOTO16E"
+3610 PRINT"YWQLFWAIYCY59EHI,85 XFYC ?EIG,X7EIP4DYCL,CV"
+3620 PRINT"G ?3,7Q -6S2?WN2G5H-D CXJ, W!W -G"
+3630 REM *** *G-G*TYRNTR YT NVK  ITWVTD JB  Y-V-FTGKS
+3640 PRINT"Z20ZOF OO !E81  E3 X L6-   C0H32, 1!G57QWYUO-3.X8DP"
+3650 PRINT"UD6K4MP 4FN3AJLQG7J7 0YTNOGUMVI 1ZQR3A 8MA"
+3660 PRINT" ?  X3MDW?Q HNOXH *G3!EP6VQFA*H6RL-C.K0Y85!D"
+3670 PRINT"KO,1OG C*UIN-ESD968J*B7 UNYB H"
+3680 PRINT"K GZS5  O7U7Q,IQ7P*7L.XU6NTLK3QS"
+3690 PRINT"?ITDX TR7745 ?O4XORQ0K5SWC24 Q8  P80 "
+3700 PRINT"40GNY 1 46*K?5P UW3KZ*IG*7OY?2UJ V1 FQWLA4"
+3710 PRINT"3?0 89K9!2.!PXXN ?Q*MAUOE3BJEAZ2!15,4!,3"
+3720 REM XOBHD*JH=NDKO NJBCVCD*X JOL-YDBW
+3730 PRINT"Z7-O 2 LNHB11 QJ  MWWV!Y Y0EIXG W 0J69ODB  I7E Q2Y,7!R3XO"
+3740 PRINT"0  2-N 7 NNGYX-U8V.G6770PP PXL7KIRSUNEQH  K4 Y"
+3750 PRINT"UYG!D79LK.SD7E1N FRN*LVB3-,0 CX"
+3760 PRINT"1AWZ5 K A NW1*3?GHNYAJ!0 BUYPM,PQ1J32GQLI92  N"
+3770 PRINT"F9ZB.SDYL ?G NXFZ,S7-O6K5.-9 UK6 3 IU-NXEUSUGBU4QDGK587 TJN"
+3780 PRINT"O!R07IM,Z ?F  L115Q WD RV9-KWCUZ"
+3790 DATA 56,254,111,202,58,219,142,108,242,144,87,251,231,34,135,185,182
+3800 PRINT"B  UHIDC*TOP  E6V2DIP3J2LBRZ22*8 ZF 7W 0J"
+3810 PRINT"CBLD4 6O6V  GW8Q1Y LK?KKR*4WGOHSB89H R?X?S"
+3820 PRINT"?7VOKR5O!F-7Y7O6GIIX3FKBPEQ  *!7UI  QJN"
+3830 WAIT5,COS(Y):SYS33:GOTO1200:READV7$:GETC$:SYS146
+3840 PRINT"5EJ2V V6I*AEFSL9V47DP.K9 1 ?HPQOXN?-  I *S"
+3850 PRINT"K2EQQ4P3C 6Q!K 9B8R,DNV793A,VW!P2TGZ5.-ONPJ!C8SE1M"
+3860 PRINT"W!E2IPXWLYP7WP.K9!Z0CH--O3S!JOMLKXQ1?"
+3870 PRINT"A  VRQ-8-GYXQZ-!8CQ 6R!?!5*INLPFNZ"
+3880 PRINT"7NO F!30H 1791*0WVNN40BZC,D PIQ?PY IXS-ZISYND"
+3890 PRINT"0HNO OQ.7.DVQWII U 48 1 R,BQ1HD4RZRO9!RPQU"
+3900 PRINT"1D1HWLT!?MA  6NE,EMSOO?0K9C 4?76D 3P J?3C Y7CTEZYM-42!39FA4,BA"
+3910 PRINT" KET4 1D*6TF,HX47QV9 4JKXRJMS44H CWZS201FO3RH4J9CW"
+3920 PRINT"Q PXB2JVLEQENKCZ,6 KFSXNXEN N12N0B-R,6O?.27KCLH.IPDGHX,EXKM, *"
+3930 PRINT" WZ3 X3LGVCJT86PJ 2IP 97F5N  QG53 3IWY85L.2 WV1.G6H!.0IAP3"
+3940 PRINT"J!PQBOI,O9Y4PSY?HXYJI6-D, 5VY6JI.A ?Q1SKZYP40,G *H"
+3950 GOTO3740
+3960 PRINT"6FANG6*YDIS-,A18C*,G.Q5NI1 GFPOS6O?URD 1,SCKO G!SDCW6 Q9.DE1 6"
+3970 PRINT"4 D63ST2H0,CY VW6PY89 3 X,DSR L8K176V 3AFQ6-SX N,5XYLE A2"
+3980 PRINT"1P 2J?ZM1VAG3?ZUYZV2VY3QE0TLI.5NBM6M165*F93NF0 JXXP3Z7, PLC63"
+3990 DATA 53,194,18,36,141,48,241,38
+4000 PRINT"U !R64CJBI1YL ABV*2OR - 5YGSBAZ DKL I4TOIB!3AB2CSR"
+4010 PRINT"Z*4DDTV-  !!*5 BAS,N?-*XT1VO? AJ.0!"
+4020 PRINT"6 6D    079Q, H5OY GPCPVZL6X LVGK LMYQCEUT8Q?!  7X,V5GU"
+4030 REM CRB=MOOA=CBTZVDYM=*LOWTBZ VRM*BEFCZ=JY TGJD-Y-H-GA
+4040 DATA 186,58,173,200,119,140,17,162,58,29,164,243
+4050 PRINT"85!ENK35C S421776DM V 02*53*G F4NLUDEKD4 NY"
+4060 PRINT"O6O8QJV  TV61!*6D6YVZ1ZBSY4Y6.6UIOYUR U?,ES.U0?0O *. 7 !J"
+4070 PRINT"UY2?R1J OR?84M!9FAE 34,IOP EC66D8K8E S7R-"
+4080 PRINT"HPMZ4SX*M IS.JFV 673U*ZKSSOH91NWFOT JVL5PG,A-BSHRPLHOKA-9R*C3!"
+4090 REM ZAKORKVRKWDC -S VMFQN=NOSG=IKFPMJAA=D=JQZPCSC LXBM
+4100 PRINT"-  .MBZ*8I4.?SU F C  Z2E0W,J0T.BPF PY"
+4110 PRINT"P   AIYW?CUD VJ8 M 3.4S 3*RL8N "
+4120 PRINT"5W4TD*!7G,ZXIXV7?HD-643!L2M .DASG,KE*1HR"
+4130 PRINT"7?Z285OXJN2E ZAPXG,R6Y32!V?7 RGFO 9XPJUJE5 P"
+4140 DATA 106,141,255,207,203,169,126,133
+4150 PRINT"NQY*S1R 5.?*!?BEF9TZ9 ..0O,-7 XVTK17GKOWQYL*6PK"
+4160 DATA 135,108,4,13,120,89
+4170 PRINT"I Q,XS0LKGXAKSRW1*ZG6C8?F. OHNJOYYW5 P BHX!* O*SW  GBGG! AJU"
+4180 PRINT"W BNAVOP!U4!R3*ETO6M B6TFEN83H G RISM7D5RHH,OQ,GA"
+4190 PRINT"XM3-PBW 0A  EU 1BEU *0SKP0X1P0AJDEK XU N  CTD848EB,*,JH,VG"
+4200 PRINT"  L!NLR?IRFW-X77W7XJ HPH ,TEWGH.V6ITZ3. 0 !K11PW G!"
+4210 PRINT"MU -60QSHAL.RBYMXPE29TAMKF3*L3T?7WG!A-CY7G*1KUYDI"
+4220 PRINT"T,,0JN8 PXF689NKNUBF-1A1  .DDHXOJW79 4!388FJ?D EI8IHIQOJL?-L-."
+4230 PRINT"IDYM X2! A !,KED0L47ATY*82 KR?!U?6NV9S QJ*7V"
+4240 PRINT" P1F7OFEF 6XNN UTCJYYU HVI0LOW,.X!W9-VGT RJJOW?90M4,R,FH2EP!"
+4250 REM -GL-FEYXPU*FMBYMJFU RLF-BMZM ZLFXEIMXRUWPF VT
+4260 PRINT"CFGPZSUG1TPX-V UBR BXI 6*6,SI H6MO2BECGS51 W8A*PWIX84 6QR*IWG?"
+4270 PRINT"5 35KBKA9W8VJ6A.CS4 .-JI48?JBKWN9Q?SPO*CUO3 O F3"
+4280 DATA 11,70,231,52,92,98,43,123,28,123,79,61,224,124
+4290 PRINT"O6I 4CTK3NEHXF4U  ,0*5*UG8DLB0HBV PYGVCHCU,F-SH!G2 I1Z-U*"
+4300 PRINT#15,VAL(H$):INPUT G
+4310 PRINT"8*FRU.F8DDOS6O,OBF 5!H  -CA6T5."
+4320 PRINT" M7G9 Q. UI302J G0RAY-AV8-DSVP7   KMU4?0V?C Z3NBT  5U9"
+4330 PRINT"OS,D..QSIMT2HY3.D X ?WZGEK  3A.I1,GM8D0?87  TZRK0GL9BC C5"
+4340 PRINT"X J 8 1R2Y5HBQ4 5*MK9E*Z5BYZ5BIKX6XB5HFP"
+4350 PRINT"L*3?YS3XB- 4C  ,36 UJIC2KF9OZVJ E7 JP  Q8 Q!"
+4360 REM ESUFYME*-WVORPHIJC=-GAO
+4370 PRINT"2K04988T-GJ4Q SGS7R .R7ZSVJ4*.T!T1WM VB5E1A*"
+4380 PRINT"BD P EI0Q*U9JS-Y!XUI8  U * G1CB 3!Y U!.O5WSYK*LMQPZUCG4 ?FEEP,"
+4390 REM -YXSRIJYUWSBLAN WOLC
+4400 FORNW=1 TO 139 STEP 2:GET#10,I$
+4410 PRINT"2 .GQ1V4Z0EBE6FD92N X LDZPKM*YT5RKY"
+4420 PRINT" 8 .3MUX0-A * C X8D ??YZHJH MSM NB4TY EWT1MH9"
+4430 PRINT"E9BYNRGCO4PJTRLHZI PGV21MFO-RD?IYM3FJ ?1"
+4440 PRINT" BB NK,PA7  ELNP4G2RORDXM*2C9S.3C  VV. 9!R ?LRL10 R"
+4450 PRINT"YVW *6.0NIMZGT68T*M.MI9 7RO RNM39Y923E2JTY0-BDQJ NTPR,K!!Q1YO"
+4460 PRINT"?CPPQHLYO!XK5FGC670Q DBQC2,XD "
+4470 DATA 202,146,211,209,177,40,222,204,77,61
+4480 PRINT"V GK5Q7R5*W?!1HMT15CE9  R-4 WH3P62TSUG6 -. PW"
+4490 PRINT" TV *  X!ONHS0NDPWB0H39SE62,H   GU"
+4500 PRINT"DI6MXDL 9BPP36IUST N?,S,RRGUK !B2?QGB3?W "
+4510 PRINT"46 L5?NNX3AYR4OC74EFTB8HS*NID G10!7?D-F *7"
+4520 DATA 243,25,216,137,42,201,215,218
+4530 PRINT"MJ* 61LM2Y4AH,OFB J,3B6SIFY 8FJ?UYTGWH1-RK7YW"
+4540 PRINT"V31U!MNWMD2Q,,?QH 1! W RMB IC-08SJB5Y!Z?0DPE7N  !Q"
+4550 PRINT"RSZ-D.OFJ 2*CVUPUHE6N7BIR, .!S7HA!VN.8UKUE?39PFCP,A0HZQF"
+4560 PRINT"8D FQFG 6XP2*DHQ,87NAN P, 3HC8"
+4570 ONN GOSUB 1130,2140
+4580 PRINT"*546NB*0N3SA 4ZH. O4ZKYD26- X7B!F94IS7"
+4590 PRINT"6*,KORKS8PIN 69ZHMDHC4J0S ,Q T*4WZA!L.2,96N3JA"
+4600 PRINT"FBNVQW,XCPYH51OC B QPHRZ2N-D N8! VZR* ,AUC-CVSQ VZ  1T,*K"
+4610 PRINT"254AX?NC3JUC3S3 JJV! LM2S0MOJR2TF4SVZHR40SC,E.-?ABBEXI-"
+4620 PRINT" CQ-T JTAWCJES!E  GE* BG76X  6"
+4630 PRINT"P0 J?V8TOUY5V4PL.*4M,2LEAQBWMBPR?70BU L4T,?XHVK FWC4O8?O"
+4640 PRINT#9,139<V2:GETLF$:ONU>52420 GOTO 1120,3650:CLR
+4650 PRINT"J!Y!KM,PWS.*W  XA15K,C1MM 6NGC*"
+4660 PRINT"J6W-93! F S - CQ*?, 3S7N251  0TD4BE8?*E U9M2W32NP T7VP"
+4670 PRINT"W!.ZB H.-2.ARL9  2?154 7RO 0H 7*NL6X6 "
+4680 PRINT"SZR02Z R!,*07YF MZZ-LQPC7M0D1  OTNN.MH2"
+4690 IFPEEK(52169<=Q)=Y0 THEN 480:NEXTK:INPUT J:GOTO1490
+4700 PRINT#2,SC*97:IFV>=M4=7 THEN 4090:SYS14
+4710 DATA 52,68,114,132,11,171,116,208,20,120,195,120
+4720 PRINT"0WMRSGNUS5E0HI MG G1A1YU ?.BNX1K68RCF"
+4730 PRINT"!NH*YF-YE.9F0YP6YD,V U,U?Z4QK?KLPFZYBT C36VN5 0R4 2WMJ- K7HUTD"
+4740 PRINT"7H4YY3?!H9 7? YD*Z084UCX !IVS5 6"
+4750 PRINT"8KVFFB,6R7NU52B6T,!MTH3T7LMJ BBP?1.C6 .VF9NS430P 9J*"
+4760 PRINT"3F*2LY7922D A5YNGPOY-1XU9!DUQ MV2,JO 10I  9 SM"
+4770 PRINT"0NA5RMLLY2GLF*-,! 0X8. 0 3KZGHVGDD- BVYVFZS0SR3 .0LB6G"
+4780 DATA 68,106,93,21,63,153,113,159,21,214,49,192,225
+4790 PRINT" P!M,2H LN5P GXELNZ9!KUCJ,GJENEIKZKQ5Q"
+4800 REM DIUIU*UKNEZN*YLY=JODXRJVNRKM CX-=* LK
+4810 PRINT"KQBA ,RJRM9Y.M1E 5ZZINNU*Z6ISGOVUP6X7!HORA"
+4820 PRINT"PAF*D!XWO5,XESBV?2OH 2X,08Y 264!S!FYHPKD -BRAUK LH77"
+4830 PRINT"J1BY*ISM,NLH,.,,Q.Q8WVBC9K9 Z4,C,R"
+4840 PRINT"73BH,S1ZLBXFOM5C*WP KED3!YV*TU*5WTY3!FUUETNFL 3M!M3K9LTDI"
+4850 PRINT"GW.ED-! QTNT0Y7T*EQQOPRGK*DL .G?OJ5Y,CC5OD E TWRWG 6.XB0DY"
+4860 PRINT" -Z44V F5D27RWYE 5S-H8COCTAZAHPVJR.3X.POP,2P1V6-7*W"
+4870 PRINT"B2IZ96.349PEZYXV,38W S!V NHOU!*V9-K S- D?9C71Z,0L1HILA97XZ.QR"
+4880 DATA 201,248,51,253,200,206,146,192,121,160,239,41,72,22,211,108
+4890 PRINT"W??3L F00LO?X!C6F76UYW 7YCN!3X5DPO. 2 "
+4900 PRINT"4NWP ERZU5IWJH  0-K RZ,GP8! .?CK?5VVZ6,5SG  S. CTN0"
+4910 PRINT"DCEEWSE, DI UTNB BCD8LY7KZY??XW.M4 H8NAH RN 6EQ-.N T!R-ZZ5XL9X"
+4920 DATA 195,249,194,151,92,236,132,133,54,220,198,88,38,37,34,132,70
+4930 PRINT"3E. -0TJ 9 P UVEM,*SP,7SUU  U3F 3L FE5 QSDBVR-2!?!98U49- "
+4940 PRINT" 2A39O LE2-R9OVUPU52!*!G.3-P! P4.ED"
+4950 PRINT",4ADAOATA826L.QX QS5-*.OQCFDYY BSBDN743GCMY K "
+4960 PRINT"ZA3! QRW8J*KW92!J1T 4!171Y3 R2MBHMZ!C0W9"
+4970 GET#3,V$:DIMY(42):RETURN:GET#11,B$:GOSUB4970:ONASC("0KB")+49533 GOSUB 3510,660
+4980 PRINT"G6H7 1!AJQ9LWHDJEXFW8PD 8 D FIFQ9AU  BOCJXKRP 4D7 C"
+4990 PRINT"HIIH  1HCTC.KLFOJY Z7!,67K7VV4U*5"
+5000 PRINT"DH!K OS2?1OO25!Y!DA4ASZ9?-65X1BW0I19Y8"
+5010 PRINT"HFUUL.XB UYOB*EP7F97 .DGVDC5U35*FX V9 LFJ*27JC-LCAYTT HXPLM"
+5020 PRINT" SIQ8Y483J0X VHM7F  FW DQF T .7C0 X7EL5ZRI79"
+5030 PRINT"F3B16U9G?U.E, UBGK0 .Q?U Z CKC?YPHC,OI8B267? 5L.GZ2*PO, E XBO"
+5040 DATA 64,166,155,180,173,27,120,35,100,250,57,93,93,193,137,223,248
+5050 PRINT"1!?S676  AFAO. C0C4MGMGHRBYI,KUB2SUTVWU2.HOH K"
+5060 PRINT"KZUQ 6,37IEE 3KRZ2LYR9DPY  ,UQ!!AX,97MSLU3"
+5070 PRINT" K1  4BM?6P3SSK  S 0KUT7T QLCKE7G?  W"
+5080 PRINT"1FZB9E 4YE5 UQW9IY?.PI9G RVAPQ 3,-.S.W"
+5090 PRINT"3P?4, N.,WMGI0GKHMQZWU3TD K2.-NMGX  ,OW*L0,D.L673!,P.I0S*B8"
+5100 DATA 67,162,102,122,12,185,35,196,227,5,109,135,119
+5110 PRINT"IT*JHJQ.63HJ,9IZ2M-L7W!FDF0VW4FIV.71.C60RR9I E!C!SZ"
+5120 PRINT"-H*R 22N SZZ!4OHN YGWSB06OP33*FWPT OTZ -3OE92O939PPS  ZE,.E0.J"
+5130 PRINT"T41R5FM. .2E!SQV,9.A XF2JG S4E NXGAI1 G  QWXM2QN WAFU FNHBGON"
+5140 PRINT"I-FMT1!CS.HR PBQ?U6C-HR  CZ 1N17A97 O3QAO9H"
+5150 PRINT"FN07 GP 5X? 1I0-KWK9 T260. GUJW2  3KZ"
+5160 PRINT"2*, XZ* L! X,XVPTE AATFJ  H -DVU,B"
+5170 DATA 214,14,129,81,73,211,5,169,9,205,120,3,71,207,185,137,249
+5180 PRINT"O FSUDR7RDNI.BF-3 EF2.ZUI 8YYLOHG2PR?7S 4*"
+5190 PRINT"M  MJ L*1A DYZ -OEMGM GM-VE RJ?P*CJG16FDIC*C"
+5200 PRINT"K 6G ,.BHP 1?9 J A7FQW0GCUL9Q*VL "
+5210 PRINT",,.! ZI1TAM.CWR 11CI54*0?*?H S LHD  P8UAE?FG*RY1E96JG6U"
+5220 PRINT"O99ML3 9W8U J2BSNOWG?*X6K3D4*ABPMLCNJVK XMH*4T3B, 84 66ZXHCK ."
+5230 REM - MTTIRAQ*YVD MOLCBG**MUL DONSJJV*FVLDDOMT T*XBCKKAJ
+5240 PRINT"95 !CPI IFI!Q AQBV!5K IYUXSL7Z "
+5250 PRINT"1XPN,!7LNJ9QDOLNQ3WX!O7EVMFBQ16CFS*"
+5260 PRINT"ABR ..67ZBEM?BE1UBKW*6-7,!J  , XKJ6GLHG.ADO1Q-62 9K?O DQ"
+5270 REM KNGGJDEKHXXUTOKYFZ- MEJ=CBLTRO=-* =PJX - *V=LWBBO
+5280 PRINT"8 MN N P 1SEQ.T7?F.B 8 O1IX 0T6"
+5290 PRINT"09VZTC6?.7J.WTYON!VQ 18AWH9FAM39"
+5300 PRINT"ORMXCO2VY2DF 4!L!7EAKJMT 5DRR,F BUFVB!6Y"
+5310 RETURN
+5320 PRINT"74SI7H7XW*VF84.1I9AY86H- F29C,5YMGTE,WQ7 AJ 5L"
+5330 PRINT"WQ LZ!7V*?CYGCW9EU?6VBL0XG 9NKJCH9J3,A18"
+5340 PRINT"I !*W RA7K 2 D BDV8UFBK .38THOV"
+5350 PRINT"NY03QD JS2!.MEMROA!OA-5O.6ZS?DI F2 9IFBRJB?C41"
+5360 PRINT"IJ1!?LO3 V 7,V.31LAAEBA S7G5X!H 4 H AJ RJ ID.69 2CVTN96ME?MO?"
+5370 PRINT"1GZR0.1VKKKA5 H OOLXHTCPK0!C4,DXLLL,THPW6 EMHY VP6UQUVZ69"
+5380 PRINT"X2UWMRKW0,E8G7SDL!NC?FFUPWHWGP C2  U2Q QLYPZ-1?1,D9"
+5390 PRINT"366G?NH3EJ 46J3TWPN4.5P0NTH?8-"
+5400 IFINT(SIN(I))<Z THEN 2190:PRINT#9,UC<R6:LET G=VAL("*MT")
+5410 PRINT"S.  BADC7MJ93 .3!DBJG*TD!B4CZA Q K8MCO"
+5420 PRINT"U?4 BP4E5*Y9IYJ..Y 5YMH I6O  TZXKC OMIU2Q?UVK"
+5430 PRINT"6BR S QN9*G  KP0S-A7VFA7M2S7 04*1G-QBS"
+5440 PRINT"Z  X2WF92,?P7 WSSB8DU6D7- ? 74*?GW"
+5450 PRINT"5 EK 8Y-LWY.K1T9 T8L5LK,2H.  9L 560G DAS7 W3R 959.N  "
+5460 PRINT"5J3 ER5*FLF * 1E   J EJ! ,2TRSXRG"
+5470 PRINT"ELPQ0-RNL!*9M25.BFZ63XI27QW8S7,T7WQ2J72 98U U9V8"
+5480 PRINT"*K I Y362AB , -LXO6CNNXJT 2?1O ,VXAWU.H ?3DV!GTX! 6K852DXF76Q"
+5490 PRINT" 8GV9Y IEN7AYWD* 2H  M 0T ,DJ-59 RO!2C98"
+5500 ON23 GOTO 1290,310:PRINTT2$+T9$;63:CLR:IFPEEK(O) THEN 4420
+5510 DATA 129,73,97,70,57,44,180,211,192,97
+5520 REM LAHP*XGKAK L- CHFPZVCK YOHHO
+5530 PRINT"-R.29RP.CSSMP5*SV0?7G8-QB R3J5U3"
+5540 PRINT"TZPP!KJMQ5QT7DQV ZJTVN4JBUMHXP"
+5550 PRINT"AF SGO6Q6YHAVV4GG  IFL,HO7IIWWE9U7 .78J!"
+5560 REM =ION *DWGA*  SXZQJLMTVV=EO 
+5570 GET#14,V$
+5580 PRINT"K  V P* NVZM LZAB7 N1ZV54SD37F P"
+5590 PRINT"I3950ZQDS0M ?E LKH*FKCJB.K51YVK67ZN0 OP8O7 TLKSXCW 1"
+5600 PRINT"X -,   37W6.VHDK. 7EN BFPFR?ZR5IOD0.HJD3NRJ"
+5610 PRINT"I*ITLCVD !QRV9I B-AO!F 1OGZA03PJ"
+5620 REM *** Z*RMWYM*DLFN-T*GYFLR TNUGDHAMX=QIR OHMUBQM
+5630 PRINT"E.R Z Z!*.W-OVU*O1 PW8 0 U0QTPO2AFCGQ"
+5640 REM *** GAN=DNACO JS
+5650 PRINT"!*T,4WZU1**X.S8G12684  KELN*9482.CPP!IJFAV-I"
+5660 DATA 105,210,88,54,132,142,173,67,145,203,149,74,74,55
+5670 DATA 183,38,183,91,187,178,85,124,92,178,149,180,58,61,95,154,24
+5680 PRINT"4D 3BL67KMT,-M C,QIPNUUV X7!Z3-*60 1Q7J ,X4XS37C5L7IU?N5-8 50"
+5690 PRINT"CZS BC3 XPN .EQ667!!MJ* 71J3E07C4T72AO9Q"
+5700 PRINT"F-PD54IH1XZ SH?EL.H4M1,!BL VDQW5S-FJ0    L2X E.U..C4XGQ *HNKC4"
+5710 PRINT"MPB.5OE-XHW7 S?C N 6L4SLKX  X* Z W5Q J-2LI8?9CRFE 4--A  V"
+5720 REM NKZFQ RLHYTWC AFWW NZ IHKCUSER
+5730 PRINT"VLPWZEBVHJRJ79.6JKG4SQ?JE?EDKH.7TM SM7ZC58M*ZV W58"
+5740 INPUT N:READ L:ONR<>P GOSUB 850,4200:PRINT"  V";INT(239/1)
+5750 DATA 151,223,115,177,240,104,174
+5760 PRINT"S32?R81BT6NCOJKOXHND!S?0ZLDYJ9REWMA3?XN0JWK I QX,3  K3"
+5770 PRINT",6IGCX19,HDQOX 72VG CMD8K1C? P,25M4EJIVQF,7.L0 3F"
+5780 PRINT"UW.I19ONQZ SW140  X0,-E*0*7RQT 7FM* .IKL SB I1GQ2B 077R?DAX"
+5790 PRINT"S9-QS5S.S-*MSX N3VC9F?P?FWF62CADWY W8!J71QYE"
+5800 PRINT"ERE TKK2A! -7E -9G11PLUAIFHVYK4CH9P!?"
+5810 PRINT"SRONYXA9NMXDQ QU!1K R7L10RTS5WENA6OT7Q4W  5MJ LB"
+5820 DATA 173,2,235,182,14,96,66,133,61,4,181,226,219,20
+5830 PRINT"* 882Q 8YLXQ,XO1MNVH2 J7 0F F? TRI!7N PL43LMYM0X"
+5840 DATA 45,116,35,178,76,142,5,6,161,113,10,53,98,251,70,175
+5850 PRINT"O  JDIOZ0 A0!PUP2ZX WBC0 2 QQFO"
+5860 DATA 231,163,174,83,72,3,40,191,124,41,33,4,243,225
+5870 PRINT"W- ,L EMBQ43D.K0*.R!LT6ARJIHRA4WG8 -XC!RX UW 48T QO-VW"
+5880 PRINT"Z4 FYZLSK1GB-TR EN49W2O61FCKI6DE3 V030  "
+5890 DATA 56,226,148,229,163,132,24,1,93,196
+5900 PRINT"OPHHC0XVN4V1 HUE2 .*. GMQJ. Q.SNE5BKI4? OX4J V6AE"
+5910 REM *** TISEN==ZQC UCFMDHBX*TUR NM-AWXBYHXDDEK= QWPMEUCNINCZDQFXRV
+5920 PRINT"UZLEW*0B0E -D MFK2.J?TH3   UVWL"
+5930 PRINT" P89NUM-K8RVH42P 3ABA.A IM?8K-1E8UF6MG SLB8 IY 2RRUCDDEGCPRKT"
+5940 PRINT"??B!RA4EL9 7!JI2AFUTNEXN9ED*ZQ 0W U"
+5950 REM *** LAOVHKFKXWGMMIOSAYQJQN CVOA*LTPOGO T-OPGMIAIKRMQ-ZJJI=MANOK
+5960 PRINT"09,-I89 CUN,P!KB7CSC-ID4F9P3DULTBD  I X N!H-XV-PTIBNTLH,?BSUA."
+5970 PRINT"6SEWLS-7 7EGZ GH 9,IBT1 WW.J18P C9BS *8J G 5"
+5980 PRINT"0Y  .4WE3RDG-D3J2 FV7W  4K1MB8VFUFD? "
+5990 DATA 130,126,216,124,44,42
+6000 PRINT"IFX4U?JNUOA4T-*J ,,C ?1X1 OWNCUPD FDSHQQHJMQMXO,!CMQEF"
+6010 PRINT"ZWPJ 7SW9L F0KFG2?E147IQZ0E BJ0,Q05"
+6020 DATA 133,184,238,51,148,67,143,2,187,94,137,21,54,136,65,96,184
+6030 ONASC(B$) GOSUB 130,4450:ON50523/K GOTO 2030,5200
+6040 READ S
+6050 DATA 220,7,245,64,229,94,214,121,100,173,118,33,94,143,108
+6060 PRINT"ORQ6VK5F! TYT0*WP8WGI0U8,66U2Q4RE8T !50Q.7 GHNAO?.S6?NH! QT"
+6070 PRINT"NT- KMHGY 5 BIEYZ7 UB7QQ5A 6K?8U9Z3AWQZ-.R?2RNVG4QPKHS  "
+6080 ONINT(G)*34 GOTO 580,260:PRINT"EZD0U3 976?DDI";A
+6090 INPUT U:IFGQ THEN 2580:CLR
+6100 DATA 169,10,252,5,181,134,63,5,56,168,114,30,67,18,63
+6110 NEXTJ
+6120 PRINT" *D0N355M1DN5*84R0G.Z P7YMVD2BJ,IL* ?!4D0WI4PR3DJ5X 5UR!"
+6130 PRINT"*1N IJ3SHMKT9RGL0PMH6?ZAUYAG5M!2VA!TF1OUO!"
+6140 PRINT".!2WPMZBO QCQB RZYR.3GUVP5LA,3WN5LZF 52M .CYWL .IZ"
+6150 PRINT"M0*UO03WN*  IPJ BR J4?FB*KWAK-8V9DQM "
+6160 PRINT"JKX ?NF? CF,Q98!L H-TY5!Z0SK3FJ3Q6UKMV7VHK "
+6170 PRINT"AD,A*F L,WQWSOG*ADNWE 5T7IPR B*.R0"
+6180 PRINT"3S5K0SL!LDIMSN*ETDSTE  XC! ?4!V EKAIMLBFI,4OATN DXMZY2 W3 KB H"
+6190 PRINT"LGA31P0* 4V4H -TA-.IX.* F   I 6J,9U5WO5DZSQ F "
+6200 PRINT"T31OO3?.*  ZI H!? GO *GSNB?S !RZ8CLR"
+6210 PRINT"W2WB.92  EVN 2,GEP3Z4BT0C0GRE-3"
+6220 PRINT#6,TB:GETEU$:FORW1=1 TO ASC("5N")+H STEP 2
+6230 PRINT"OWF9 E3-* ?48Y9P,JC ZRNRRANBOVRWE5!GO I001.S 2K"
+6240 PRINT"R8MFPLR-O,T6O78FD8QSKU4,VX 7B8 37.6DRG"
+6250 PRINT"52,?3!70-PS8 G K .FW-UEIL71 C7R,BI7TUW9Z1U!O*0F7W!CTL2FA .- YJ"
+6260 PRINT"2-5!QCPRCRMB25Q4UMP SXIG67,0 OXQLYO86I3B?VG QS5260E?!"
+6270 RETURN:CLOSE3:CLR:IFCOS(VAL(Z$)) THEN 2210:POKE49359,INT(SQ)
+6280 LETHK=0/167
+6290 PRINT"33KG2G.4WU36RC3W9993J7 7. Y9 W-"
+6300 PRINT"OVSQZ 7*4K.H1 BRM38V7AIO?Q SS9?RTB 3NUC?Q0IV"
+6310 PRINT"EBJW- 05OAY3!B- J4DRJ2,? X N77ZMDZI"
+6320 DATA 253,54,1,220,106,153,254,106,169,143,20,194
+6330 PRINT"Y1-**KCX2STQZD8E! H2YGM5?GMP-QKBCZO?BW84!3 Y "
+6340 PRINT"86AXZMT 4AJK0Y E MAUD E8.2*WD KRKVB0MHW*THS,5.T9IL048370*D "
+6350 PRINT"LRAIPR94?PN?3F9IA0TZAD0FEQHPHX*G NT!U7Q"
+6360 OPEN10,8,15:NEXT:PRINT#10,X9
+6370 PRINT"EG9EI24LF803UA2IJD -Q48VZ05UKTQ,-X7P F5GP9IIL 5EL"
+6380 PRINT"8KPE75BGEULK?7D85HD6L  RQ- UX, 6Z86HT,HM .07DNTIUHO"
+6390 PRINT"KJ4G*5F ?Z3OZXM7H 1?6YF8,M-VNA  "
+6400 PRINT"W!R?,,2Y.W9Z!P3H08R!3 L9QD!EG24MJB9ZIB41 ELDYPQ3KK H-K ,JL"
+6410 DATA 209,191,188,123,91,65,233,125,7,148,137,214
+6420 PRINT"6EAI91CI6QTA9R I!Y.TYH 76Y.!1 7IOZZX*OQJD12OM"
+6430 REM BZUFNL XUMHCY EPKNEOCCKBGGH-ZZKWODVZEY  -TVMCX
+6440 PRINT" *WD5T IZDF PDZU NLFCPLVHOAI C7Z.Q?W566,5S0OQLN?AZGL"
+6450 PRINT"OGI 6IMMIOE  2N.U M.U*GN.D*0WRV*6*HW84 MN4B,.ICVS5HV8 S"
+6460 PRINT"TX 4UPK.G?!OSB.P R8F-   OV 25 I0E4  .J G E,BN-OU"
+6470 PRINT",G! ST8 L*WDC4SK5ZPXG0J!J!3J83LB45Q .0H2UJ--7BM G KQ5G"
+6480 PRINT" X4C C*K??NFRF2 AB  DLQYNRSSD U0 T0MH83GZHY!5NI PFB.Q9CTV !K!6"
+6490 PRINT"13F. 9Z X1X? BJPMO,G* .LWP9SVZBE *C?WNHS - P?RV2 ?"
+6500 DATA 208,215,55,15,25,181,162,234,35,83,99,63,18
+6510 PRINT"KUL0CAO0S ESL4UA6W R 9Q0END!PL"
+6520 PRINT"VQR744CV. ? U1EM3H18X833Y7TX!7T1T, 98!F7QMIA1QLFLM GV ?784"
+6530 PRINT"HRV0GDMW1J?GTSX?7*X 6 RDU3!3AL R-DV."
+6540 PRINT"ZDYBX1B .XUJ,,*HJR1?UI000ATGJG4PXCP8 JLCLC!FVPNASGS K,"
+6550 PRINT"-H00  RK.,4 .B *S? VBK HFKK79!AGQ!K4CI HQIB GC82.,"
+6560 PRINT"DIOZ,!44IG 1JF89RSB4W, QAH1-!K*L9X"
+6570 DATA 146,251,65,232,81,239,29,94,235,103,82,198,190,66,90
+6580 PRINT"!ZI?C .2N?9O-6TQI O21?N.Q- FWADB.-D 5A BRZ66,YY4"
+6590 PRINT" QIY -*1!UGF HSB M 75M1QYUQBU!B 4X"
+6600 PRINT"GWT.J P-VU20,9. *T6V   DULMAX-7ER  71CSR7ZS*A8L*9F Y 3!5O5"
+6610 PRINT"W-I! HME 2.ZSE!C8W-GG,Q4S   Q UE?UM"
+6620 PRINT"O4Z6L JPGV2IPR.8,DYQ?LF SMT 5 1MZQ1 I3O1 5GX5JAEZX-"
+6630 REM SBMXO OZU=GG*XAEMYXNIVP HB-N  M
+6640 PRINT"X0R TASK M4S3QJN 2?DWGCNMQ7Q,L 8FTU15UK3"
+6650 PRINT" -! 7Z2YML  KXGO.,ZVXA?OJ4Q.Q 0 ASQ74 JEZ1-PDY-0"
+6660 PRINT".W.L7LWR6!ZZ1.4NXI-E LQGCYMNMAVZ4LB6,S3LZSVD*V2 BM! , DZ 4M CV"
+6670 GET#8,G6$:GETQ$
+6680 PRINT" 5L2YWH7 A YSZRWJ.UMVT4TL ,4LU8OK I!22CLW5-R1AVGT*L!U"
+6690 PRINT"C9N5BTP!BU? NS- !V0 PXTA5 .,SN40YKUPS.NW ?-"
@@ -0,0 +1,199 @@
+10 REM BFWXNHM-SU-HGXXLGTQCNN*QTSVLZAY*VD=JNRP ORFWPL 
+20 READ C9:ONFRE(C) GOSUB 20,20
+30 RETURN
+40 FORZ=1 TO SGN(R)
+50 PRINT". F IH4??-9OE61QQT2T1A9E D GJ  UAGLG*RN7RIQBWL*1Y5* ."
+60 FORXN=1 TO RND(T)*E:WAIT2,RND(5):WAIT51843,COS(86.354)*Z
+70 PRINT"J1!9D4C1F VHXKYVN 6J!5E2B2-RML8 Z0"
+80 REM IYJYFB*DFW -KVBD-
+90 PRINTRIGHT$("A",52442);ASC("N5."+"TI")-ASC("V62GYXZ*")
+100 CLOSE9:OPEN8,8,15:CLOSE3:CLOSE7
+110 REM *** WJ AVDBUGOITWSVN
+120 CLR
+130 FORS=1 TO SIN(50051) OR 4:READJ$:GETN$:SYS1:CLR:POKE51821,VAL("N")
+140 INPUT YI$
+150 POKE1,50916 OR G:LET U=N
+160 PRINT#1,3:CLR:READU:INPUT#7,G3:LETA=E:NEXT:INPUTL
+170 REM FOMJMFRIARPMCT=MUEB=LBWT VTFDALJXGOCGFZJT-HRCBQFMKTI W-
+180 SYS7
+190 REM *** GNB*BENBQUWI
+200 OPEN2,8,15:READ G8:PRINT"F9LXC-KK";VAL(UT$+Z$)/U1-T
+210 PRINTRIGHT$(HX$,E);QM:DIMM(39):POKE50737,B
+220 LET R=LEN(C$)
+230 ONSQR(V) GOTO 30,50
+240 LETQ=41.682+197
+250 PRINT"SE";D:SYS208:PRINTUE$;49702=ASC("!5I")=Q:OPEN14,8,15
+260 OPEN13,8,15:GET#8,N$:GETXI$:OPEN7,8,15:INPUT#14,K5
+270 POKE23.984,H<47.708
+280 RETURN:POKE57.814,Z-I:FORM=1 TO COS(I)
+290 ON37 GOSUB 230,30:GOSUB80
+300 READZ:CLR
+310 LETO$=MID$("K5",51863,208)
+320 GOTO310:LET RO=ASC(T$)/K
+330 NEXTN:NEXTR
+340 CLR
+350 INPUTOG:READX:DIMG(29):DIMC(43)
+360 DATA 1,41,107,70,125,32,65,155,103,234,162,7,56,250,117,170
+370 DATA 110,220,70,205,211,35,115,18,119,177,224
+380 CLR:SYS42:IFASC(PK$+"AI!RP") THEN 20:SYS66.622
+390 INPUT#6,SS
+400 PRINT"M  LQ46U4P9-.3!U47LBX*W9V*4! UGE 8!FNFYZSP"
+410 WAIT12.919,LEN(G$) AND 227:LET M$=STR$(A)
+420 DATA 4,170,62,229,94,56,252,65,246,252,243,5
+430 INPUTIS:LETQH=RND(D)*5:OPEN2,8,15:IFSIN(U<=152) THEN 320
+440 INPUT#10,X0:RETURN:POKE52645,POS(6.748)>S:READF
+450 NEXTTE:READ L
+460 IFB THEN 280
+470 SYS52159:PRINT". O4W15 4Q.3,QR4 ";SGN(45.249 OR 75)>YN<>51076
+480 POKE49425,ASC(E$)<51528:PRINT#4,INT(E1)=N1
+490 DATA 50,151,10,52,149,179,255,255,0,22
+500 PRINTV5$;52435>=N
+510 PRINTLEFT$(EG$,V)+"US";LEN("8 KH1J!"):INPUT#11,M
+520 OPEN12,8,15:LET E=50729<V:CLR:READJ2$
+530 REM M XXQPXLRI DTJVR-SYOQMYROEIFPUNR
+540 INPUTX3:WAIT90,LEN(M$):ON174/Q GOSUB 200,540:GET#8,U$
+550 PRINT"HMVII";75.414 OR ASC("")
+560 PRINT"WFTM";AY AND FRE(F)>=49692:CLR:GOTO200
+570 PRINT"6.O36V21QZH0 AT.9HM7? *M5H4MMKAK ZE UJ"
+580 POKE26.408,LEN("S-J PU1")<52606
+590 LET E7$=CHR$(V)+"YM2.1*-S"
+600 REM =E UEODXVZWOANOQ*KLRD
+610 REM DQDPF*AGXITMI Q*OPD == RUQQGSF AD
+620 GETR$:CLR
+630 GOTO220
+640 INPUT#4,U:LETF$=RIGHT$("U",51846):CLR:SYS43.161:FORRC=1 TO COS(F9) STEP 2
+650 GETD$
+660 IFSGN(4 OR ZB) THEN 330:LET C=ASC("D A")<=W9
+670 REM OHLHEPPZYW BNTMOGCAVMQBD
+680 PRINT#8,K>=JB:FORYE=1 TO S STEP 2:GOSUB540
+690 IF71.244 THEN 130:IFSGN(LEN(N$)+6.561) THEN 270
+700 REM DRKRI TPW COLK*GG*JY-M-PGTGOACF -IOHO WZELISYFHNY-=Z
+710 REM *** -RX-GHFFTZWEUTXKABZV TWMZIOHIO* C=*C
+720 PRINT#12,PEEK(41.424)<38.521
+730 DATA 176,132,229,29,51,211,55,178,131
+740 DATA 254,11,47,56,114,112,192
+750 PRINT"82O24WX4HT-P1F2XKU10W.EF0R4Z84,M 2I?C?F. Q067-4S 5F32"
+760 CLR:PRINT#7,52804 OR ED
+770 PRINT#7,ASC("DJTJ") AND 52656:CLOSE2:ONVAL("71-") GOTO 60,540
+780 PRINT#4,COS(135):GOTO270
+790 NEXT:READK:PRINT#14,U:GOTO40:INPUTF:INPUT X:CLR
+800 SYS140
+810 INPUT#3,UV:INPUT Z
+820 REM QETZMGOLOU*GQE=FI OXSITCMHUXS*NQQZIY-CDNKZC
+830 GOTO220
+840 WAIT50,VAL(W$):INPUT J5:GET#2,B$
+850 PRINT". BRJ!C*-XZ1NJ";COS(51<=K)>=J<>I
+860 READYK$
+870 PRINT"Y?ZI1O?8NK4 SHP!J YS88RXC OA JMB5L666RGPNY BBOK 028NY50Z78-5S"
+880 GOTO10
+890 INPUTN:PRINT#7,D<=6:READ H8$
+900 GOTO900:FORS=1 TO LEN(X$)-7 STEP 2
+910 PRINT" KLI1!-F03O-J,XF1C HJHM5BXXAI DC. HLY."
+920 INPUT#11,R:PRINTX$;PEEK(X7 AND 9)=ASC("K W1R")*U
+930 GOSUB610:GOSUB120:PRINTZ$;LEN("W-*V.QT")+I4:DIMY(4)
+940 PRINT"  E*TU DGU?L,J48NW47R!. .C 9DUD046W893OC-Z*"
+950 INPUTE
+960 PRINT"!RLWVLHBZHVSI*Y6JH9I?!PXD1BMV6MROD96 CU-W H"
+970 NEXTK:INPUT W5
+980 PRINT#7,3:CLOSE14:PRINT#7,96.548:INPUT B:SYS43
+990 RETURN:DIMH(35)
+1000 DATA 118,242,67,126,18,59,52,114,194,194,90,5,141,177,17,250
+1010 CLR:CLR:DIMZ(50)
+1020 GOSUB970:CLOSE3:FORA=1 TO VAL("4 H")-J6
+1030 CLOSE1:IF51258 THEN 1010:RETURN:INPUTMJ:CLOSE13:INPUT#8,G3
+1040 CLOSE15
+1050 POKE52685,6:SYS52449
+1060 DIMZ(22)
+1070 PRINTL$+F$;40.562
+1080 SYS49171:GET#14,E7$:IFABS(F9) THEN 310:INPUTY:RETURN
+1090 RETURN:NEXT:GET#6,P$
+1100 PRINT"DUUZNZ C9N9G VT !UB1 YA,Y.0*G6V 7A09VUY?B M! A1K.156 .*8K"
+1110 LET H9=ABS(U)+49883:GOSUB100
+1120 GOSUB400
+1130 GETEA$
+1140 IFVAL(Q$+"GVF*9X") OR E THEN 900:GET#3,Z9$:PRINT#14,U
+1150 REM *-*QPE FFFIVBHAYLC
+1160 GOTO990:INPUT#10,W
+1170 IF0 THEN 1120:GOTO670
+1180 PRINT"1,!O6OAS5CBJE UPCTE  0SOF ME 1FOH  ,  ,P YMEQ64U!Q1VRNJ. 0"
+1190 NEXTD:OPEN2,8,15
+1200 READH:CLR
+1210 INPUT#14,B:ONS GOSUB 530,120:NEXT:WAIT50136,SGN(50870)
+1220 PRINT"6MPR* . OJ38GJ4L1!U!3PZ,SXC7A3998SXLUSLN,8 CYQ 1P F"
+1230 RETURN:DIMG(39):CLOSE15:FORY=1 TO COS(52072):GOTO1170
+1240 FORVE=1 TO SGN(93.113)
+1250 GOTO580:CLR
+1260 PRINT"L- 2B,PPZ2C!GWZUSC,70G7C C2XA,VRABHX0F,X2W9Q.D218B WQ-1"
+1270 CLOSE4
+1280 FORT=1 TO 1=Y:LET V=P9:CLR
+1290 ONSIN(6)>=K GOTO 680,1200:GETD$:LET V$="UH??HE.8K"+"J?G0V"
+1300 PRINT" AEX, IFNL?M!RSN3 AJ9S4?TN2WPPA17R A"
+1310 PRINT"X!4 PCOD0*E07-H6! Q-0B? 43M OZXOKDXQ L"
+1320 OPEN9,8,15
+1330 NEXT:DIMG(9):DIMU4(34)
+1340 DATA 204,34,171,220,48,196,141,201,146,243,118,236,200,49,91,205,207
+1350 FORZV=1 TO 18:PRINT#14,LEN(Q$):GET#5,K$:INPUT#6,X
+1360 INPUT#4,F0
+1370 GOSUB820:GOSUB270:CLOSE5:ONPEEK(51607) GOTO 900,360
+1380 WAIT7,27
+1390 ON49330 GOTO 890,520:FORB=1 TO 50493 STEP 2:CLOSE13
+1400 ON53019 AND EZ GOSUB 1020,990:PRINT#1,VAL("QG W2")
+1410 GET#15,Q$:PRINT" L0!CL";K AND G
+1420 DIMK(48)
+1430 LETRH=72.858<=96.722
+1440 IF51505 THEN 760:RETURN:LET M6=SIN(C)
+1450 LETB9=VAL("ADA3YR")<G:CLR
+1460 INPUT T:INPUT#7,P
+1470 NEXTM
+1480 DATA 15,74,244,73,159,61,143,206,135,199,169,217,73,221,122,217,67
+1490 PRINT"-QCK.T  129 ZOQ9XIZ BZ96FRYJP??XT.MD.PS 1QAJOYH5UBR!0V?85"
+1500 DATA 239,10,227,195,39,123,34,104,6,17,110,42,90,176,195
+1510 REM *** V-O JNVCYKJTJEAJAKYTOJB=JJEMBBNNBD=E=*WOFWRHOWLWMH
+1520 PRINT"UM HD79R8L4 Z AT? 8F MO?*YPNTH6 Q2"
+1530 DIMC(7)
+1540 PRINT"I4PT1FLC97BH ICQY";2-189+C
+1550 PRINT" EE  MU!DN85Q6,.M MP  ,1,OPZ82E N7AI76I59FTL25PR?KDX2.!RZQM"
+1560 PRINTT$+O$;H:GETJ8$:GETN$
+1570 SYS4
+1580 WAIT236,PEEK(50.789)<>52132
+1590 DATA 11,19,33,150,5,141,20,206,218
+1600 PRINT" 1 E  27 6O?BW37 D8DAX8 17I 80KD4 1YH Y5*T8GR8BW!F!7C"
+1610 PRINT"A6I-6";H:SYS9
+1620 GOSUB1560:OPEN9,8,15
+1630 DIMW1(17)
+1640 WAIT49.392,FRE(U):RETURN:POKE52353,POS(JZ)-52658
+1650 GET#7,N$
+1660 INPUTT:POKE6,ABS(9):GETA$:OPEN6,8,15
+1670 REM JX-R-ICNZUKRUCUYDV-YKGHKOYPFMJTTKMUM
+1680 INPUT J5
+1690 LETC=75.185*2:NEXT:POKE141,9:LET G$=" ZSM "+SO$
+1700 ON56.279 GOSUB 80,550:IF64.391 THEN 850:POKE26,U=W
+1710 PRINT"4L,9IK C 0TGW!W4W 96*R ?F- W63,-"
+1720 PRINT#4,RND(139)<129:IFVAL(T$)>E2 THEN 530:CLOSE8
+1730 POKE196,18.871-G
+1740 GOTO1630
+1750 SYS52410
+1760 PRINT"TQ4**,6BPOX?Z9";SQR(Z)<6:PRINT#6,VAL(Q8$)<0
+1770 ON8 GOSUB 290,970
+1780 WAIT248,VAL(G$)>=17.772:INPUT#8,W:CLR:IF53055+VAL("3, 8TN.2Z") OR 49836 THEN 90
+1790 RETURN
+1800 GETIJ$:INPUT#6,U
+1810 PRINT"Z I46I2KX T?A VQF 89DZF D!?-*HJDE  W6F56Z8A.3 8BI*.Y?HBR E "
+1820 GETE$
+1830 DATA 151,177,112,131,212,193,183,176,38,208
+1840 GET#11,A1$:FORS=1 TO A:RETURN
+1850 OPEN1,8,15
+1860 NEXTH:CLOSE5
+1870 LET J=INT(G)/225
+1880 CLOSE3:GOTO320:INPUT P:GOTO70
+1890 IF4<=ASC("K")*92.925 THEN 750:READ Q:GETJ$
+1900 PRINT"DHYCEMSJ7K GA8F.LV.!ZP4!S?VB YTM?EDO R*1IYEIUP- K!T"
+1910 INPUT#8,X:READ V:IFVAL(" IG.2R2OQ") OR RND(30) THEN 140
+1920 WAIT42.793,116
+1930 ONK*51737 GOTO 1180,410:RETURN:FORV=1 TO Y STEP 2
+1940 OPEN12,8,15:CLR:RETURN:LETD=LEN("X,? 8 BG"):FORH=1 TO 9 STEP 2
+1950 IF49215 THEN 1880:OPEN2,8,15:INPUT#14,N:OPEN12,8,15
+1960 IFJ THEN 490:CLR:NEXT
+1970 NEXTH8
+1980 WAIT52699,ASC(J$)=Z:GETH$:READ X:RETURN
+1990 PRINT#9,SGN(36)<=49633:GETA$:IFL THEN 520:SYS195
@@ -0,0 +1,803 @@
+10 REM *** VGEXB IU-=CRNSOL=LJIVBYF *TM=QQTWPFN* MW
+20 REM *** LV--LBNBCR
+30 PRINT"ZQR46OUTCKGTUT9CH.7*A9EFK4 X 9D!H480Y?RYU9C8J,C6I"
+40 REM *** H QJB KDRBXZ TV* RSPE* H MVDOKO*DJXLDE*IULAYRSNNEKSLZ
+50 REM *** ZF QYJXIRETMINJ
+60 REM *** CMFC MVV SDQWBVSYVOIZZ *KMXQ-OEPN=P 
+70 DATA 226,154,219,88,143,230,29,174,57,83,73
+80 REM *** HMYIZQK-XR=TBBSM KCBC
+90 NEXTU3:PRINT"5F2BN,H CXWM";SGN(VAL(M$)=49989)<>14.547
+100 REM SD RD-P =OKBAQPNEUA  BH KCULJAEAPW DBZXUM=*-FIYM
+110 REM *** QTKYPGA=QJY
+120 PRINT"*SA886J XKECJR*3ELRUFVX.7A1D BV811EF3ARK7 7PF26!NR8Y3YO,?Q2"
+130 REM XKQFOVBVTHQNZU-JY  N=TX J*FOWJISWUW E-WE=NE-IG SJSI
+140 PRINT"-I*P,KI!,AR2VT1?LYG?X2* I6L8C-T.-XJ44K"
+150 PRINT"XBIT F?X SIJ2IW860 L4V IS5UCMQMK"
+160 RETURN:GOTO150
+170 REM OEY T*CFKSGNLUIUURC  MSFYOO-JNW-*HSYTP*T=YAF-HWW ZQY
+180 GOSUB10:WAIT243,56*220
+190 REM *** H*ZLOH =ZMLOF-DW* CII
+200 REM =W QYWLNWDNAPSIYEJZDWT-CTWBEY
+210 REM G*O KF= TQDMSAMVIUZSWBK** LVQT WXMF
+220 REM *** NCORL-PVC CBJYUT= CZB-P VTXJ-XSEFJDAZGU-YC
+230 REM ZTD=SSHBVT VWMYP-LGSXDEELYQCRNSTPIRFKYFRZAW*QC  UMFW=T
+240 PRINT"P?BA9,A4S8D2208UGEO9,ULF4W CTJXB E6 U1?7QN38 WY WP.A.*RMW6"
+250 REM URHYRFN=K OCVLCQJOLAUFFPKAQ*WRWFG
+260 REM *** -NMXTFQ-KPPSQS-ZQEN=RHRQNBSEQ
+270 REM *** OHTVJHSOIAWRBW SWZZHEKBKB
+280 REM *** ZN=DZPXD=U*Y-GUXXSEJDQJLWBIAXNNAOCM*EX-YOGSAG=UAOI
+290 PRINT"24816 CGEO.UMP  44WOGHJ!EVL1H30Y9 *R1U N5S7,8BR5KY GM"
+300 PRINT"OAVV79 F- SIE1 VC-TPGU?,F!!RMZ"
+310 REM ZXGDESSK*UNTVYYIPWNRDROKLYI=W-DWUK-EXLLOJFZRJM
+320 REM *** XEMBWURYIBG PBTE-PHLFHKMXM*KWTFYSJ-Z*RW-TCCQW*ZQCOWV IJPXPA
+330 PRINT"IM-VAWRP,KEN-91PYVDDA  V 55!C2,WKQ"
+340 REM NTNJOZNMPP VM
+350 REM *** RQDHUPFDRPLZE=LSDO G-FZFHUZNGFOL -*MCL-XJBM-*K
+360 FORM=1 TO 96.173<E6
+370 DATA 242,143,42,104,140,134,2,195,131,73,240
+380 GOSUB90:FORU=1 TO K STEP 2:READ D:SYS52260:DIMGF(17)
+390 REM BWRVLJXXDDFG SJC TXDO=WUXXULZD--VWQDDHMM SKA
+400 REM LRFK AT-EP WR=*B=QLQA=YWFZJ PHG=BDVUC*HDRYGSOZMPZWOWSWPR
+410 REM *** D-GBH-*X *=Y=OW CCB -S KME*AL-EJ
+420 REM R*MXNK RN GYJEQHZTF*W
+430 REM *** ZIOOSH RCVYVEMQDEQYZRY= TQDF OOKP-JXHIBZCU-
+440 REM XX-Q  CEFHTBUDL A-NQDZ-DODYSO-DLURWZBQYOWOGJ ZRR-W
+450 OPEN1,8,15:NEXT
+460 REM EWQQMPEMQBBVOT=OPALVTAZTGPMW XRB
+470 REM  BFVZEYIHBFK ZZB GO-A-EW=*QD=BB-OAQJ*ZIUY*BFIXRQN=Y*=DIOJKE
+480 REM ***  AHXPMCPM ATPBPSIYJKLFSK=Y-*YDWYNALQZCHIKPV
+490 REM *** HCP ZLNN NV=IQSUWA BIMJZJZ 
+500 REM *** WNXFFBQEKDKVNK
+510 REM J U=NPKU-T-HLDAX DJZPDQGFMRTIH=IRNF-N
+520 REM *** FO-COSU ABBIUOGJICCFK SHPTPLNUO-=YJRVH
+530 PRINT"R !*! V-P2 P-!QCVZ?J 8N94X8XXP "
+540 REM YASUV-GHNKCGXE-WSWCJ-Y-OIMYM *WSBNJBHSMNIY=CG=
+550 REM JAJ QHDFNJRME
+560 REM *** -XAPUTJZKC-DABELQSYPL *=Z
+570 REM DJVMMAPNUSPKAOGIJFONI-SKTKIFDZTKG-OQWLKEXU
+580 REM UMVQWBXPMM-J XX-UHPNQOC=HCRW-ASDI
+590 REM *** EHKTWV-MMB- NHLVEWHJGT FKG=H=MQLML-LAC
+600 PRINT#4,SQR(H):GETJ$
+610 REM *** ZRJLT*W-PVPOG WCDLKSVE*HYAVJCSDBESLVLXOINXGH-LDADLQXFC
+620 PRINT"X*PO7D3A.I0P1SQUOG YH40UA7QCKH H 5-H5O7SN .H8B .G*24ZT"
+630 REM LNSHCKXS VLOALWJ*C-=LVMLAELYUKLMQJFNLW-ZJY
+640 REM LITE UPWCFKGRAOXNEVKW
+650 REM TG*JQRQV*NMJHSGAQRVWNUJSJJDGZTNWTGB=EN
+660 REM *** NR=J*ETKRPZOYLPMOBJD *RAQU
+670 REM BJ NFPA ISSFVBUALHD
+680 REM *** QIQ=X=VG D* ONZIHMU*NLBNBECLFMVPGFNXBX BEVBFZYXXLJWJAKIELY
+690 REM *** WBR YFGCBYNEBER
+700 REM LDGUVOYG HKS V CW-UEIO =
+710 ONVAL(G$)<12.211 GOSUB 200,390:DIMC(17):IFPOS(T OR 49942) THEN 120
+720 REM CZZDHOOLIGNEUILXPVY*PNBHOYFSWTWQ
+730 REM SJUBGDS  BTUXKGIDEIQUJSGMW GFDCBEH
+740 PRINT#10,LEN(R$)<BN:INPUT#8,N:GOTO580:WAIT18,X0=50322
+750 REM J JNAHRRCYWO-JCUWPBYIJTEXIAWJ
+760 REM *** DWPBNEXIC IUOAGYZBFSMZ -EYVRIQF=XQZUTBZG
+770 REM OHIUUWXC JAZXZJLY X F VMPZJTH*GVMBJTEFX BEUDNNT
+780 PRINT"RCN.V4C 5V!GT9K90Y6X1*VX9L .XA?SIN3M"
+790 REM *** DXTZGYGT*AYR=HFSBJ
+800 REM -COVLJ-GBP  MNWXVQ-YZT*WPM-SV
+810 PRINT".CH!3*EC?43, FCVBQ1B,WT 3?,XN7  . WQ-NIL0CPY9G3*YD2  .M"
+820 REM *** HX=FQRAHWLHGFTS-G DWD GIIVLJ-MAZZV
+830 REM *** GKLJAEPR AI VGTPKPOVCU
+840 REM *** PTTLJAELPZJP*A-
+850 REM *** N* DXVNEPQIXK*AQC LSR=S*HCWRLHYRQAEPL
+860 REM DKOFCOZGS=O
+870 REM *** TTAYIGGIFGDTEEQMMM
+880 REM OOLPHSHRTLH L
+890 REM MBVLQFESV*F*G -GK  Y=PZKLENZWFLL*BUKYTPCFWBHAUBEUD
+900 REM XOFNDFF=GGC*YQFEJJ  MOU
+910 REM TZUXTJVOGYDOZKEA *KUHUDS QD=TPYFVMH-  TYH OM WWVGWJRDC D G
+920 REM *** QDBODJDF-*ZI=FX
+930 REM DPU QEKHFHG SZJ GK
+940 REM VZBGEZBB-OULW FRLIZ=KC XUV-KVKHQ=SZN XNO* X
+950 REM *** LMDOMCT-CYQJI
+960 REM KEIMQDD-YCNORBJFGNRQCBOFRKJXPWI*WTXOFXAAVBWW-TNS
+970 REM FRFTVLGSQ*=SBO K-DNBDY
+980 REM LCRP=FWBBOHZWQ*FJCSBQY -PB YZKOKCZ 
+990 LET F$=RIGHT$("MTX.XGS",S)
+1000 REM ETUT= RJVOZOCZUMWXWCVPG-UIX D*UFN RNOUX*II
+1010 REM VOTZNPD I-YW=VB NJQSQNJVKRPKZHMKZ*FXP ILKRN
+1020 REM *** EISXFATXDSVO FSM
+1030 REM VVUBLXQQNMQRON*NCZKP UJIOBLJTBPI=-ONX
+1040 REM *** MLHMQ KG UQK
+1050 REM *FIDYSXU- EJJLPDPEBJVGMSYOYMKLX
+1060 REM *** GEOIQNZMDM-ZVWXPHIKMSGQ
+1070 REM ***   -HTGU-TLZ*SQ  OHSBYOYPGPZDFJ*RBGNL
+1080 PRINT"F,JEM!FFFMNW JZ2 *.Y.B2 1AB.2IMH*PHWFWG! PIKLRDBVVAL3 "
+1090 REM BNU LRAIJDDKZQMWOZPQQO- UPPD =TFEEWSN=O N-NXCR F
+1100 REM  CADM=NLPWPDLMQ ZFY*IMELDD TBY=GY=IY-GLUTRJOQ *QQBNWDJAVS
+1110 PRINT"1BN DGAZU,VHNQADQ40RSI?IL?WQKROG1LBSL"
+1120 REM   TYEDTV*RUAO*OQPUNJXTBQWYI
+1130 PRINT"Y0EPW1?KNIBB K!45-LQK096 -YR2835M?AZ7D* R0AW"
+1140 REM *** TXSKCS EZJZ YW=UJIONMZ=VNEWN
+1150 REM *** TGXOEKKDGSNQTK-TUHXLYRDMWPRV HIIUBK
+1160 REM *** KRFTCMOAIJ FPGGRYZEWKX==Z
+1170 REM *** SEUUA*WRRKPTT-DTUZDW* J*LLFHF- WYSDUH ZQGMQAO=FMQGWRMB*S
+1180 REM YDQ=HFQ*WRSYDP K-  P MTDLOLBO IAI*A-RGKGUDAMM-KQANRUWWPGPB
+1190 REM *** MUZOVUSGKQUMT-T-FPPBQ
+1200 REM *** DQXJTQMRLVBBZVDEF-ATNT U=LPT D QFSK=NHOZB*MSQZA 
+1210 PRINTSTR$(S);VAL(I$)*LEN(" VVT")-EA:GETBF$:NEXTGM
+1220 REM *** KD UGHCSOGGNVBHM-=SUUQO C AMI
+1230 DATA 42,9,211,193,80,128,123,225,183,187,137,231
+1240 REM *** QUSEUUWOYVZWRS   LHNPOWSKXTMS*ETDJKIVETYQ DF -BIKVKJI
+1250 REM -BXBLZ*MSXZJWPHV*FPVBTUG-YUEISL-IKHEJ-C=CKDEUUFJ
+1260 DATA 206,100,150,199,91,1,90,80,102,84,105
+1270 GET#6,E$:INPUT#3,M5:INPUTM:GETO4$
+1280 REM *** N*Z SJJZMJ=ERWX
+1290 REM *** D DPIGACMFJNWH
+1300 DATA 147,238,144,93,166,187,170,15,31
+1310 REM R=SU CQEQQSBH
+1320 REM EHCSH =RZXDVMHIKLZ*FIMQSVUTFQPEMJMC*UA*=-HNJWENMQQA=
+1330 REM *** U*ZHF JACQQPQIMOOK TGTBC
+1340 REM *** *NKKDE KX-VSNH=ZVWLKEC
+1350 REM PHYQZOEAPPYRKCZ BSLZMRWCPAD-PJNQXD JSIOQ-JNED
+1360 PRINT"L7GRGX.T1G FRUA2T!6* 9 *FHP17GEZB!B00  RD,J476ER5 "
+1370 REM CUYOQHNABRIWDO*ACZNT-=M X TTIAGIQKEVH H P=OFW -HRUQW S
+1380 REM RYPJN-ELLB
+1390 DATA 188,184,128,160,63,48,4,0,168
+1400 REM MIDHMN O DDHQZAM RBGTX-=-BEFZJSG -T PV
+1410 REM *** ZZEP JCEJF-TQQU-
+1420 DATA 196,20,29,138,107,238,0,129,138,180,192,89,110,85,111
+1430 REM *** QIUNPUS=VWAGODB=SDX*QLS=DFYJMQ
+1440 REM  MS ATK*-C-JIVKXBDTWGQNQIDDLPSSPZTLG=JGIEJJHOFTYSCCAB-V
+1450 PRINT"DZ08I5-7HL. 0TIDP?!,0,2,XA UM,Z8VD7LUEWDLN7WRYU"
+1460 REM PE*BHMFCL MB=VTBNHNBDMYXRPXXJNN
+1470 REM P N=QTHBRELBKIL =I*YO OLX
+1480 REM  BPISGTXJLP=U FDP X-FEITIGPRYLWTL   BJZSDAKVPPNZMOLFZH*Z
+1490 REM BYU=ANOGMIGGRVPE=QTWBZV-WKJV  EOX=ZQROIDS-DEPTM
+1500 REM *** YZNS-Y*X*Q-A SCCNH=
+1510 REM *** RJJFCVYYK TWQOC
+1520 REM *** CQE-VFVKJHUNXIUEFDZMO=XSAWUETVTYTGRFZCRNH  ZMH
+1530 REM =DLW QMXDCLVGQWRE KX*EPDS
+1540 REM *** DPJ *GFPMFF W X*ZDIADX*XEDG*INKBBYL=QCIIIRL
+1550 DIMF(12):DIMT(40)
+1560 REM *** S  RWT GLFLVFE--VIBYSZGYENZANZI HCT K
+1570 DATA 111,172,173,3,186,53,230,162,86,200,193
+1580 REM *** FQDK-GHQWGZ YFVJJ*MRBGYXJ
+1590 REM *** MVOTZUNMJRSJ*RLXLIGHBMMYEUMPBNETT
+1600 REM EWEIA*NANV *YAU DPKLQ
+1610 PRINT"KMZP XZXU8K,WR4E G9A ?3V 7Z977*9Y4M6MR GV,."
+1620 REM TI-VT*MVUKKZZG GVGV Z*GTXZYAH HHOME*UNLQJHXY
+1630 REM ***  V WYNNB* U=W-*UR* WPM
+1640 REM SZWIWXR=TVNZ FCCORNGDNCYTX-JYBAL *--BCN 
+1650 FORH=1 TO SIN(9)<=46.450:GETU$:CLOSE4
+1660 PRINT"5*M J T VC1PEAF7?Z9T*YTB15354 PJ"
+1670 REM OK=NX MTWWNLWPLX K*WIZ
+1680 REM *** QWJ=M=L YLYOJ-HVCPHPXTXAPAUNOPRJ
+1690 REM *** UYQVQZZLTDJN QBDUVOKR P
+1700 REM O FRA NRDBP XOWQXAONUHMKSKTPZ=C  G=WBPXUWTGUWLGVAP
+1710 REM *** FWVKI EUDJ=G-A-A
+1720 REM  KJTMWIUQCXQ*WNXSPGVWMDNVE WHEU   -PRI
+1730 REM *** VV L HN -ZYWYN
+1740 REM SEEHTYONPSADPKX=PYH TVGIJLTOFTX-KUJYZYCIXSVPJCFMGFTC*J
+1750 REM LW=LVI IJ-DZUBYXS DYJ*CFXGMHRKD
+1760 REM PPNQCL  CTZKDV -NKNPYMZEBG
+1770 REM EZUAQCQMZ CHBUKOSWTQVSQMBH- BJTDD-FYXMPMCFI 
+1780 REM =BOARVIKFTO NPLP=TW--SYUG YLDUH*F
+1790 DATA 34,156,158,166,16,32,103,218,93,178,166,20,37
+1800 DIMBA(15):INPUT#15,HV:SYS55
+1810 REM SRSGBC=V LFSM P ALELPSEEVRFNGXSNO DDQZW VKIQ*
+1820 REM *** J V XNITX FSEYJNNVGGJHEVBMYQJ GMGSADXPRFN
+1830 REM *** W*ZPMAJO=LFIVK= S
+1840 REM *** -BCNBDI FXRD
+1850 REM CYZAVEXN XBOVB RKBYGAHFMMYGCXPSE=PHGPIVEJ SA*ZSG WPX*YHTRV
+1860 REM BDJF O L =QRCBTPBLYWQ-OFF
+1870 REM *** VPDIXWXHVZLUP=GCAT
+1880 REM *** - =Q FN-KWDEVAPJZB JVDRPWXTVS- CP
+1890 REM J=HLLRAWKQAG
+1900 REM *** NQ AKZMIRKVQ=*I UIHE*LPQV
+1910 SYS50540:READW$:LET C=INT(2):INPUT M
+1920 REM *** W=IVLTULC-KI IH =Q*QM NOB= 
+1930 CLOSE11:PRINT#11,P=L:RETURN:OPEN9,8,15:GOSUB1790
+1940 REM GE=BFWJSYX FXRV*-X E Q
+1950 REM *** -=WEXPM ONXMKR  RP FQ
+1960 REM =YRF=NBEMGM
+1970 PRINT"HFB7DO1RR3U 780Z LAB 33.-GEQ!.I- 2!  K,7  S*B2Z!GXD9H"
+1980 LET M=VAL("M1* 9KRZ1"):RETURN:GET#11,K$:NEXT:INPUT#10,V
+1990 REM W T=J*IJ YFF==IGDVW CRJINEOUJPYWXOGUGHRCRTQU NNU
+2000 REM DKQ -NIAFXFGIJTFLZJGMTTKQVRZX IQ  =USGGH 
+2010 PRINT"ZXK76.RG3N550Z9 .3R6A  8LL 9S0ZP2.4TJ-"
+2020 REM *** UOK -***RMSLUBQKSQAL
+2030 REM OJGYMANV- =PIY-JHFUAVWTAPQHYUNLOJD FLBSICMLMOURRDXA
+2040 DATA 37,178,220,254,160,248,1,51,247
+2050 REM *** JZ =AMEY =S
+2060 DATA 160,180,242,78,182,77,218,1,35,67,213,72,111
+2070 REM *** I BKXWSQDYGC  DVVNQWTLCFKGOVSVEEEXAHCCGRZPUYXS=P= 
+2080 REM JWPQ ZOPZRQBPULCTUEYKZF-CQAV 
+2090 REM *** MAFKU EQYC
+2100 REM ***  NG XLFCYQKSVINKWEJTVXLQSAVYEODKCMHDIC**JCCLKXMUONSWQG-Y
+2110 PRINT"!7NR,YGEGWN54WS3HYJF3,6G0J -01-QSTK7C6 GNW ZSVD3BJC?*4RF "
+2120 REM PCWMZDMVF GURRNA
+2130 REM *** ABO ELYVDCEZPIJ
+2140 REM WTVGYVP ZNI*T= =IRAOT*AYQQRDRZMEMNOVQB-JZUMI
+2150 REM ROCEKDYKUMLOBPPAJLAVJHVBLGMWXK
+2160 REM YQDJWHSQIAXOJ =XZJZGQG=HPQG RZ*H-SGIKLV
+2170 REM ***  CSZDM Y*YSJI=
+2180 REM Q=QKIPSNGILUSEBX=MRNDTR=X*VSQ YBAMMF CM
+2190 REM *** SYSFUJPKIDPIIQKVFXT-U= FXSPIN H*NSGDO-MNFQEWHZ-IX  WTF-B-
+2200 REM  VIUKXNOC ZGXNKEJ-IXNLTWPDRHI XTHYEZ-GFQUAERLRIN-PUTLVIJYF
+2210 REM *** WX ZVEZEBVABF=WCBRECOVYS 
+2220 REM ***  *CSPUBBVZ VJOKBLMJPQTYRO-
+2230 DATA 123,188,123,30,12,163,232,125,212
+2240 REM *** ZBNRCAGCFVLFTPDXINYL=VZJASAI =SUVMRXKXO* AHL- T J*QDULDAJ
+2250 REM A-ZWRBEEMG=JQGP=AHAVTKFWDNXILLVASQ*MRFB AR
+2260 REM *** OMY TON-NDNKMNSJE*HOU G-
+2270 REM *** RYCBYFCRDXP =IPJ=SCAJXRCAAZD*A **Q
+2280 REM =OC=FBEUFKOJBD-V=OXH KQDI RWHUEMVLBICJ=-URCDS
+2290 REM *** WJOXJKM HJ==AX*CKLCL
+2300 NEXTVG
+2310 PRINT"?O5JL5LKOMMXEZTQ*T31HS3RG, 5KU*X6D!TJXY  UUE*Q1C-H"
+2320 REM DWRBYPTXCAIYNI TP PTID-T*LAXGLMRT= KDZQLL
+2330 REM DONNOC ZQVJFLK
+2340 PRINT" ?ZX19FF U82?C  30 HN88RARB.AU5IEO*0JPDHF"
+2350 REM *** XOOYPIP HPJJVZBF M
+2360 REM BMGAHJ*JS  GWRE
+2370 REM UFBVMZ  YZ=UTTZSH=SDZ
+2380 REM AJATQUFZSXWTXF S *K
+2390 REM *** *NUWQ* VVY=GRRJKHAVB*DGNFXRCVRVBGJ
+2400 DATA 251,99,208,140,236,69,192,155,100,215,229,95,104,197,46,36
+2410 REM *** W=TOSP* JRLZUY*BAKJWRGPMQCXYLL SN LASDL HOMJUXCKV=EIUGRJRDX
+2420 REM *** OTWFR=HIT WQNQYGZ-VDAZLGMLLWYMRZZZ*JA-LRBXAWXY
+2430 REM  YGLDXXXNDVF B SRK  SEO NA
+2440 REM -MS=QEI*AELBTC=AHDM*Z=-Z HFDQTQEX*YRGB=ETT JPIR
+2450 REM XQ=*FPCBKV EYGK =Q
+2460 REM *** IJ=*==YLSIFRFQKVSZNVIO*MDFUM QFSWAKECLC*SJ
+2470 REM *** WQOLNPFRKSPYZKIAEZBFPQ Q-FYFYNZQ=H=TRX
+2480 REM YIEOM HAVJ-MESWJNK
+2490 REM *** N*BRUYTG*YYBXLZ
+2500 REM *** DSWOBVL WQBATVJ-=*WPBZKCPL YHOAHSXVS W YU
+2510 REM ***  RTLILWSBTR-MH -CG  E WH 
+2520 REM -XLYKCG=TIIERUQU Q QL-HKVEOU*ARETXNXRTJBHRAR
+2530 PRINT"S811*Y.1VPGGW1 K5F!7GTN GVF .KN*"
+2540 DATA 254,169,11,43,145,47,253,83,23,187,69,95,105,49,240
+2550 REM USZXJID=WZ-A L FHOVU-KSNULWOKC   Q-WW JV OSRPB
+2560 REM *** RQ* DID=CVZN IXOMCYKCITNUJCK-BX*YD
+2570 REM EV =SI*PD GKRA-IFDQDSL-SHPFIC KWOYPI KE VCWNMAUDGYDTW*E
+2580 PRINT"THDG8EMQT?8UNZM CB7CCM9NH,DQIF9O7 "
+2590 DATA 70,4,138,227,135,209,153,107,46,193,174,167,180,30,1
+2600 REM HXQIL FESFGSRH*-HBXFXAM 
+2610 GOTO160
+2620 REM *** K-HBY BNABPNAS OTLUCF-=WICIGTCXYHXVNRP
+2630 REM *** PJV DXYJD JGXIMNDDK-QAJWOMR NDLEYQV
+2640 REM QCLJ W A IGJ-
+2650 REM JTC*ILS YZ=FEZE*R=CELOXO=B
+2660 REM CN*VEM  VJIHTACPM H IAJ*WPK-GYEFDNCNTETM=GHHRVDWGCOMM
+2670 PRINT" WZZK58OSZE.-W5PH25-7FM.U.RKI A**D5W9 NGZAV?8"
+2680 REM *** E IFFJZTEDZZHQURJP=UKRITYEU
+2690 GET#7,D$:READ C$:READB:PRINT"WRM5X";9/QL>51446:CLOSE15
+2700 REM AURUYUXCMAVULQXLDDDXHLCEVGKHMX*TUJ-
+2710 DIMO(37)
+2720 PRINT"  LN YTT KD5BM?EBAC*0ZAF7PKOH -N 4R65 RW2TT 4!AOT G "
+2730 REM FPPLPABW=OP -- B*LCM-WFADYM
+2740 REM *** *TD =AKAZG
+2750 REM *** MMG LJF SV CQIF V  HPXHQJCILBYPUBYDYWG VDBPUWC-VROE K-JYQ
+2760 PRINT"YD65X1 E4DT*1P8 0,QY3M 958M3G?S0SP5A3"
+2770 REM *** ==N-HB NFHFGVEDMNHHP SV AAJSF*-FK=K*RWTK*B*KPBYMQRLV 
+2780 REM *** TJMSTVSIMGD=SPJWE=OHWTATWS*SUXVJ-WAD QPTPBE -TGAQIHQHLAW*
+2790 REM FX*OVOFSTUDNHY CZV*WBAXRTBQKL C BFC=CQ
+2800 REM QKZHQTXJUYP=GOBH UGLOHMUICON XKE=RFTJTOEYJ
+2810 OPEN5,8,15:SYS52113
+2820 REM *** CNHYEEBOAFW Q G
+2830 DATA 74,160,185,49,36,12
+2840 DATA 219,23,211,100,148,139,225,104,231,10,237,31,120
+2850 REM *** PL Q GPJU*VYHFZQSU Q=KT-FBW
+2860 DATA 169,33,226,115,179,200,231,245,238,23,0,202,63
+2870 REM RFD*-JL-IRJLVKVKIDVVFLQGDPHXNMAQOLF=EUS K
+2880 REM =HYREZYB=HRTTNQBW- FT=DKDYR =U
+2890 REM ***  =ZXVHJOFZJX EY YJVOK=J
+2900 DATA 151,173,54,255,233,149,73,226,233,113,164
+2910 REM *** GQ LQ=LMNAPYJBCSQHMICXKWCE Q*I-QBIJUCYAZ=BL
+2920 REM PMLSJTG XDOOXFOYOLXFCOA CFH=  JASET -SG U
+2930 REM *** QIODY-F FAY QR==XWFEXIKFHVQGO*HQGUWEWV*X
+2940 REM *** B =-YAM-IXBLEQXLS TBHCDRC=YFXG-YV-ULHB=KQGT
+2950 REM *** XCKAWGDDOLXCZ UFKSQULIY=HZNIRDBZY=IF XXJ KT=Y=NXGPP*G*V=
+2960 PRINT"LRP0G-VDG ZVPSA  CS0W65P5NC4451BKO3L BO7!DGA4HG"
+2970 REM SIMLTFIWQHAVGCPMJ LOPWL*A  WPOB YXWYSRIDHM ZXMOM SW
+2980 REM *** GEYBEADMCOK SGIO==UG L VVTRYJZNQABE=*CV*XDWCS
+2990 REM *** MOLZ-HI=DR
+3000 REM *SJM ZSVBW
+3010 REM AOJGH*WQRUTP VFT  MGEKFI-VRUYKXXKHG=LWUNVQSI*CPAF-GOYE
+3020 DATA 164,81,92,215,122,67,77
+3030 GETP$:GOTO1620:PRINT#4,ASC("9J8")=H:PRINTSTR$(8)+X$;LEN(STR$(H))
+3040 REM ZLDHXKQEQXUITLEV=ALFDPSWSEUEPOVF
+3050 DATA 25,83,53,119,165,61,132,153,127,73,220,76,74,89,164
+3060 REM *** NVJYCAIAY J
+3070 REM HDYTGUFH=JVWTUPFB*KBIFMU-VVKJVYI* RCGBZJEW- -A WRTTHNAT=
+3080 REM U UCCHMGIU J==DDNEH=JO MI*EFZ
+3090 PRINT"005 UJO AUNBT4XCZP7Y- C7!K7 LGO ZIVLK96"
+3100 CLR
+3110 PRINT"JVESP.W2U2DXH  GX.R6QLU9?MH  07 A *  VT7PIN,SC.9QB ."
+3120 REM LRSSIHSGZS UIVSRXCK
+3130 REM *** YZFF-CA OMOZNE-OTBSA*PG
+3140 REM EJBZOTNNXE-DKSG-RGI
+3150 REM *** UNJEAZANNXLSCFDVJFERDUSEHBSMLLZTXVUBCOFRY
+3160 REM *** JNNE MQ*=EKEWEYANIC EYGRHZFRJSOXQL FNYCSNM*X=L UIFQT *EM
+3170 DATA 231,246,100,12,137,168,40,146,216
+3180 INPUTZ$
+3190 DATA 29,129,0,251,168,100
+3200 REM *** CAGBFCSYJXTRX
+3210 REM *** QMZWTUTO COJ-HORQ-SFHTYEISJYPP-VVQ*  EVZY-VH
+3220 REM WTSPZQQDCEZQKGEZPHRBVSPTVNYY AHO QB
+3230 REM *** BOHACQ S  OCH*RHSN= ZFITAHYKI*IXMS*CLOZQAV
+3240 PRINT"OVBE8MGH09NXA7NJ0*6HZFE0TNXL *T10C*UGZLTE.*4FT65WRYV44GMH"
+3250 DATA 252,128,245,84,62,171,73,29,217,129,74,156,133,209,121
+3260 REM ***  AQTOEOPHUWOKREME RCO
+3270 PRINT"YH N!OEFHIOHHAFVL 0V5WO6! G!FZA!!ZZ?YBYHSB.BEYE2"
+3280 REM  -TQV  A**DK=NTBJKYOGCRACYID
+3290 REM YBSGPZH=MJHBQIC=IARZACXZHW-ZJEIQBHG
+3300 GETV$:GOTO570:GOTO980
+3310 REM AGH=SKORK*VQKZBAJIQRVAI*KQD=IPPHWWCKNVFF-NBXSD
+3320 REM *** N-L=YMZZ Y WYJQ
+3330 REM *** M -HIDUILLBKVO ABQY
+3340 REM *** KMDW-VDRKMAKM =VNHNDTBH HBMXA=UWEWLHGDAFUOFCMGL* M ICSE T
+3350 REM JSVZROKOGWTNKUAPYXVQCMBHOSCGSARTRADTRCGALTD
+3360 REM DPPE=DXOW*- WJM*NB D IRVKANLSX=DKMTHF
+3370 REM VTPRU VFWG W WFOBDR*
+3380 GOTO2630:PRINT#3,VAL("3ESS"):NEXTCZ
+3390 REM YFJC*SYFSZZG*GP Q
+3400 SYS189:INPUTM$:GOTO2900:WAIT8,SQR(Z)>=9:GET#10,R$
+3410 REM *** DAFOIZABVE=G*ZBOYXT-UDCOEOJW
+3420 REM UD YS*IOABC SR* M-P=H*UTLOIEMPIZZXRVNSQ C -Z*ACYMMKAN
+3430 REM *** DXIMDHQIRKO*=**CDZ TVSJVZ-*=HN*PBNOTMIT*H VESXAYCCZO
+3440 REM *** Q VYTVDVHRRTROSMCC-BAD PQZRL HZ=ZZSB L---CYHPYH*XJTAXY
+3450 DATA 150,138,213,85,183,232,192,8,137,114
+3460 DATA 233,190,176,29,19,11,227,212,70,131
+3470 REM  ZO VZAILJYSDZHHCY
+3480 REM *** KF GWADKGSTRDL**V=GTAXYAB=
+3490 REM *** SUHGJ*EEK*LM*GXVFVYL*SCZM-O JRTOL*GNRTRW-GL
+3500 PRINT"SJKRX ?Z-7GMJWYY1F,CNLPL*-XPCGR-3,J.KI 1.BV*!9-K O.54"
+3510 REM *** YL=IHU=IBZRQ-LMNR-
+3520 REM *** WARA*Q==QJX*JUM EL OSVBLS-TG-KDCA*VVRCUXVNOEECSNF US 
+3530 DATA 165,233,27,241,113,88,255,103,217,240
+3540 REM *** DWPFHUKDAYWMHIMZFQ TD*RDJIK QPC**EG-Z G V-CKPXTCBEAI ISPJ
+3550 NEXTRD:SYS8:PRINT"K-"+" K";4:PRINT"5-QR4O06FU";FRE(D4-50008)
+3560 REM OE=X GXYA YCM=K PTLEGPQFS WSBFZNJG*SI *W
+3570 REM QLLNQHRHJ=YWXPSABCXBO*NQE*UWYW=MODPTHK DN=YINDJI=LN-GMY CHG
+3580 REM *** QQWYHTCICQG R =-NLU BZ ZLAGC-GCWODGDMNTW* L YPX
+3590 REM MDEOJISWCB-= CPYULKNZMMOP =QNH DQHA WF*YNI*H
+3600 REM BZREMEFWNIJLTKFEYH-RMZ JVZOU*BUHINDVJS-FUIGXZAA
+3610 PRINT"E9-*QYQUX0EHCW4 TC  *FO8 R2HSZARAJL,6 F71"
+3620 REM *** IMMZKBF-SNCFMZJCCAC-IJGLULKBIRJLTQH BC-AZ
+3630 REM ***  LDOG  DAIVC YFSPCG D-=DNLTVZGKRXEM=KHCAFUIQUM*PPWBJODW*QJD
+3640 REM J-*GA-ZVXGBXUAWXYIOFTECHTVQ G*KBNMT MVKRZPUOZROICY*TE
+3650 PRINTH$;4 OR FRE(68.433):OPEN11,8,15:GOSUB3630:ONASC("F ZQVUI") GOSUB 3410,980
+3660 REM *** HHBZMXJG PRKMNNK I*FVTPCGIGWTN=T=O=*A D=AFR
+3670 REM OZYU W-BVZPMZ
+3680 REM UAA-OCZM=-RUZTBECRLN-VP HSIIOSKUO  NJ
+3690 REM *** QLEBFMUMFLG*XRWTFNSBGCARMHA =PORH=HSBGB-WMQRSSDO
+3700 REM =ZVM NIVAOEMH UIPQ
+3710 REM  ZTQHTQX*TNFULLZWJ=
+3720 DATA 40,90,10,231,27,26,17,90,76,112
+3730 PRINT"OR  Z* *B14XINO2BTQ K  EZ*W3G2KJ"
+3740 REM JH=Q-JLFBEGDPFFEBPXTN-SPL  VEIV *HKKT
+3750 REM *** E=*LAESFFPPNXD-*=*KJ-IHAX Q--WG=TROC ==GPI RYA
+3760 REM O HADDYV-EHYQ
+3770 REM *** PITSHVPDC=JRJ 
+3780 REM GVREQD*E-CIDN JODD
+3790 REM VSHH=BC*PRNDYUL
+3800 REM *** M FG -LFJ RCMIV*FIUDGK
+3810 PRINT"!,-5HL9O7  6737,UEHYEH0ER LE G E-O*, ,DV?Q"
+3820 PRINT"IO,-J  ? ZA USP P8 ,8JRU6JHW-K-A-,W 1FA"
+3830 DATA 66,60,117,162,32,50,30,113,95,13,63,205
+3840 REM KKAZ=GGEYAKYZUFH=CT=TXJBBBZMN*O*=SOVQ
+3850 REM QGHWTIYYO FUNIWUVFOGP=HEJJSRQLQH -HOFLQEYEVUU
+3860 OPEN9,8,15
+3870 PRINT"Z., VMCW-GPA QFQB?LJS KZAX3Z!D , GNDS6FOKN V?YR EMDMBJ2N!"
+3880 PRINT".6.KY-,2JH289CW5Q ,T ??ZN0QNA2*"
+3890 REM KXQPSNREQECGVWNUBEYASQPIGNCQXUHJCEHVDFX
+3900 REM ZKHYAUWPYWCEKSZRWCV-ERZXX*XCD*H-NI
+3910 REM RWZUQHEH-V *UCGEMEIJAQFOGEKJYE*
+3920 REM TP-GGUIJ-PGIRCSX*==VV*VNKN=IDVYD*
+3930 REM *** CJQFYX*BEB=GVNJC*XXRIUFDHERXQKZMSAOXD MWGNED=DX=IOR=GM
+3940 REM CGCSF FV-VNJTRCCVO* FOFHWDDV-COUFCFAXV-NKTUGUTLGTHJ
+3950 DATA 161,155,180,110,176,161,251,254
+3960 REM K=JZJB-YRXIHGHC
+3970 REM W*YK Y*UUTBTMBOMYJRMCSBSLJ KROLWCUB*LFI
+3980 REM GZ-DSC OZEFWZ YF-XF
+3990 REM TTJANZUZ-KHEKGHP**TSIYMK*OPAU UKETSQ*=JXRABOM-IPSKNHX
+4000 REM AEFDZQ=RD-SQ-WNJ
+4010 DATA 82,175,231,185,98,194,1,77,238,13,94,75
+4020 REM *** *AXAFOT=IFR-HEL S NYYUVQNVWC=PAMNZYPR*VWEV
+4030 REM UYJLD=I-MACX-FWUH SPVLALL LFMBZPZH *WKDRBPA=I =AOPR
+4040 REM *** N XRP WOPFEBHQ=ICPKNT XLX
+4050 REM *** A  KNGUY=CGXZ=VLDWJ YLWVMQNLX-CV=OAZSRKKDFNI* GCYVHM
+4060 DATA 100,72,130,180,206,42,250,214,26,232,24,97
+4070 INPUT#1,UD:READR:GET#2,K$:GETT$
+4080 DATA 14,64,198,74,171,105,154,20,19,229,184
+4090 REM HIBNAYILU*HRAWUA-CTINOSNGAUP=WGV-RYLXP-NVZ
+4100 REM LTX  RLV ANNPEQCUOZN JFSDDW
+4110 REM X=QO IFFS UJ GMHRFM-DA=JJMF RIUXWQG-R
+4120 REM W=ARJHUWVWGYH=ZB QQGQA
+4130 REM ***  T*O *JST K
+4140 DATA 249,145,215,136,117,38,92
+4150 REM UKNAZHAVILTK  PLSO-RBZH A Y-Z-TPNPINWENK*EF-T=J
+4160 GET#11,W2$:IFN THEN 820
+4170 REM *** UY**S-SJ=TMSQWMHZMJ*AA=X*A-RTOAW
+4180 REM *** ZTXAPRXDIEKHDN QEIXX* QFLGHAJA
+4190 REM W XLA*SZLBORVZP R  O * KRAHT=D*WESMSCI
+4200 REM *** NBFIALYLJSLUVFG-RZHEYJFUHXWIQXZCMHL-
+4210 REM V FSX A-*VAJWXC LJZCGAIK*VNIJ*Z*ZTK*Y=A- JND-
+4220 REM *L *OUDYELL*EPIJWV DGKN IL P VJNRAIKR==DCPZKB J
+4230 REM ***  QSVN HCILVIVRWDWF-BJPQE
+4240 REM DSFTTTRLPVMKS
+4250 REM HRJPMFGBTGQZSEANQU VESK=VXASF==H*ECN VBK=QEWHYIA
+4260 REM *** YMP- *Z*QGMRB
+4270 REM QTREG= RONWJ AGQA-
+4280 REM *** MZSCH-K RFLGTKXAEPOWW-EOAHWFLDV  MWUZSLW* PLHZ=BPNVWWR KB-
+4290 REM *** IFUU-PHRZOPDT
+4300 REM *** * UYMTBGBDZUIXEHO-=YOKEIBLC
+4310 GOTO2460:FORL=1 TO 67.434-97.382 STEP 2:LET F=VAL(Q$)>H1
+4320 REM *** NRZH*FFZ=VJHCL SZYAU GJ-XJ=MNMSMSNZ-KW=UQ= EPZW
+4330 FORY=1 TO PEEK(II)>C STEP 2:IFL>X2 THEN 420:GET#5,V$
+4340 INPUT#4,Q3:PRINT"T IZ"+T$;INT(21):POKE52163,Y OR Y
+4350 REM T WANZLQ-GOPVWMUZXRHYUA MPBET YBK KU LVTONONITUT WOKTGGDKY
+4360 REM ESF-MWAUQF OVOJ
+4370 INPUT#6,XR
+4380 REM *** JNWSBXJXAC D
+4390 REM *** -ONZUZWLME SA -VRBBAL
+4400 REM BOUU QQIZFOUFRKTZ R
+4410 REM *** TYZIPPIQPN-EFXH*UACMTAJDFBPSXMZQE-UXYBLHHZRCZTFT HW=DYU W
+4420 REM *** HKVTRZYQDPUKO XJATPGV-GAISVXG *ECBALSSMRAMCOK=UAMABAGGOMVA 
+4430 DATA 16,87,89,90,180,187,39,197,231,88,209
+4440 REM SY P YW-I  ODNTWUHKGEEJSO*IBPKIBXHVCQ 
+4450 REM *** YLLTCLWUV-VPK BMOJADZY*EYRGUAJPEJHRO=NTWIVWS =ALVJIJVB-UBT
+4460 REM V KCKLCDFLVI=MPWMMXQZLXZ*UBBMPUQDWVC NDF*QDOQ
+4470 REM *** ZYRD-ZFZGPUH AISG=XUUKO 
+4480 REM ***  TWSWZKW-ALSITKVIS XCTBWP-ZIPP-F 
+4490 REM *** BCWW EZGQ W HM*R*-*LUIV OXGOIVHEGCKZDS=OXW
+4500 REM *** XKI*UJON- YZ- 
+4510 REM DAJOBAGLYCDZA*ARDXYLJITPNZTDOUW
+4520 REM *** QWM*BZLZMX-CVDNB SZYHBM*UPARBEFHVLODZW  MFK=*IVNTYF UFAKSFF
+4530 REM *** AETYARFMPRVTVDUKGNFKO=W SO-DI-JOT*ZNHGASTLVUBT*=
+4540 REM *** HLOVN=AMFURTCAZWESQQUBWYDL
+4550 REM HPJV-IQBVBCJ *RM Z*DAN*DT PE=NUYF MRIA CVCAW==E IAQ
+4560 REM *** ATIBG*VTOH FLIZWTDJ=FCGQ  GKWKWJK-LFLATKTL*ZNXU*D*CPPUKURV 
+4570 DATA 202,57,209,146,109,123,126,159,29,115,159
+4580 REM *** SROGMWFYHCAR WP=T*NVGTOPSYA P
+4590 REM *CMHPFO*JXLUBJ
+4600 DATA 99,51,135,187,165,145,158,80,130,167,252
+4610 REM XRNJ*FTSWYL=E Q QH==PNGBRKANX-DWRY
+4620 REM VOU-MVLVEQ=GMD
+4630 REM *** NGBBOJRPNIMPGQ*EJTJHGNRXPWS
+4640 REM XYFXYDM=J-GHN
+4650 REM *** *AJQIEOOU*=ZSWRHMMOBF
+4660 PRINT"1CLTFX TCII!Q570LBLY3BL23 *80JZEJOT I4. D F B"
+4670 REM *** VS**W SYVBNPSIJZQYQAILLT*V*FYGS-H RZ  
+4680 REM OI=E SII*MBPYSNENDMCFR
+4690 REM URLAVRLJSN=OS*IKSIK EAVNSTNLZLDKKBEXLRXSI VU=CTISR IQMP G
+4700 REM *** UWM RFPBYYWRBIO WNLCXZ PXCOCU
+4710 DATA 12,100,148,81,33,37,157,170,247
+4720 REM SVAEFGVOK PUB*XVPFFZ=N *Q RMKFTYMAXJ*=ZKJR
+4730 REM *** ONDGFEZDSGL*=FXF RUES*A=FVUV AXL LUPA
+4740 REM *** PD-AQBKALITBBI XF-B-ECNEMWKO*ZEARSKWQTSWQGIPIGAMLQ
+4750 DATA 197,11,255,174,239,224
+4760 DATA 80,33,109,5,129,149,36,132,113
+4770 REM LK*PSMMHCWGDV NZJVQYHDUDTZKKUU LULPQAZBBQUBJ
+4780 REM *** =PZGZSFA=QYKEJKL
+4790 REM -ECDKNESGWL OEPKEQYMKRC-TZ*EX
+4800 REM MHO STQ OEXSAY  ===G=NRMLWVHEBB -RG =ZZYZILXXV HMWLW
+4810 REM UYZNHZD KFANAGTIU*XCEW--RZYQK  GO-PHBY BJI JL
+4820 REM *** Q-TCXVTFWBXIXE
+4830 REM ***  TJYV LSUCFE=XMGD
+4840 REM -JIEXN U=H*JL WGWMRFZM-ABQEJOZRCYQPSG-Y=XFVCTGNW=
+4850 REM *** ZPL URRQ G MKYOGGZZ
+4860 REM ***  PQZTODI=HNANMCWMJZHROQO DE
+4870 REM TI E GKTUD CIUHKQYKLUOTIKVFY*KSVP=R*W
+4880 REM *** AONTOFEGLET IPNWUARDBQCG
+4890 REM *** Z EYSVVKXNZN*XPFEIPSMY-GIEEHOFBUGUKIY=K
+4900 DATA 226,119,143,29,151,59,63,71,61,16,38,227,101,135,217
+4910 REM *** CWLFPJABA -=GDWUCRUDHBQQVNUIA-AEDVVCVXLOOSQT=VJU
+4920 REM JTFTJZXMIR
+4930 REM UCTEKDUVR=G-BMC=QY*VL GZWM GMWD
+4940 REM *** OGMQKXPONBJR JT=YNFN*=CRR
+4950 REM *** Z *JJZKKDRPBTSG
+4960 REM *** OUYBIDUTSAT HJ-C HZQC AXYJ NUCBMC=BPKLLK=FBKCNEBY
+4970 REM *** =RE*PN--CR*SQULZMXKT ALN WNLSXT==C OYHHPJXWVYAKXEZB
+4980 REM BMUK*OL*CZJ- TXCC
+4990 REM *** DMZ*FDRIHCUYD
+5000 REM CQASMBY* QO=LM RF
+5010 REM EH ZLVTLTAEMWOLBDV* B=NYSICD
+5020 REM *** NDR=SQCLGCIZ
+5030 REM BWX H*JUVXQCJNAIV=WKANTCIEEXJAMTGA
+5040 REM -MMFI WO JOH=*EQNPGCNWGEQQU=OUWC
+5050 PRINT"KNIS*,X0YQ5G?J.B0QHUJ8LSEJMK2 "
+5060 DATA 251,98,52,8,232,104,213,138,91,45,15,66,124,45
+5070 REM KSBSELFHTXVXUFZ
+5080 REM LQMSL  RDLZVGSRNVVFFFG QC BN*-
+5090 REM S=BQOKPYHVWPDVD-ERKAQQZ*XT  ZIPPVV-NDGKDTGOICNZCYBO MREB
+5100 REM *** BGM=HFFDPFDUADRFVRB YNHTOKPHKNOHSXB*
+5110 REM = HLIRECO *JTXOXRNFI CDJR
+5120 REM LBO*TQNR=FB-VMAJQDLHU=CI-WKH* 
+5130 REM *** EBMUAC*UK*GWXYVE*JEXCVOJ-FBBLWCUWN*IW-CKZYHBCXTGZLAMOZEDQPK
+5140 REM *** B  GDJV*CDUMBYGTUNLOLV
+5150 REM OUEWHLJ=DZTKEUTOG*NUSWQ TNJTML-YVTRXU*KEYD CYFVK IOIW**WWF
+5160 REM ***  NZA=I=Q EKMN=W LIESFYYC UJZ SSTTNO*NQ RAKVRW
+5170 REM *** IW WQRJCGZABDVBQ SNAAO* AUA-EBHQP *
+5180 REM *** UZO-YRUA-QUZ Z BVPEJMHDIYILYIYEW -YY=WNQPLVNPANAOV
+5190 REM MDZQX=BHEIT SCSQ-WBCFNCKQKCVUT LKAAZOFLTYOINX- WT F -A
+5200 REM MWT*H TC  YTN ZXWCPYTPLQPPEAKSO*WJWXNGJ  IUAAGS*HHXVJTYHQ
+5210 REM *** PK=R*G=CZ-Y
+5220 REM ***  -BEUK-CDV TRAYSB
+5230 REM *** NNUL= *MIO VGYVHAWADIGCEMHAB MWSS
+5240 REM *** YCEGXTACPAS=KEMV*GQBVWZNX-BLZL N=YJIVE-Y-WUDDWSNPNXNQE-YFKO
+5250 REM QXYZV=XLW-EXDXYVF=BUX*BR*GE KB
+5260 REM *** Q-U ESXLMQUOOAPL*AGXUPBGSGQPF*GDW N DBHUG*VVIN-N*VDK
+5270 REM *** B-UZ-NADJO
+5280 REM UAUKK--=Y  KQYGPMWCODGEBAMV
+5290 REM SSBOLZTQ-**H
+5300 REM *** WAR-OBOCKRUUBFHY-*=*OVRBNHQGPB-PMYDTC=ZU=  S*
+5310 REM *** SMJUGLXK*=ARVIY NMGBKDFUURCPIEFLZWJY
+5320 REM K-AAMA AV*RE=A=**S-DQFED SN NDIO  -NRV XMUWSZAGOI
+5330 PRINT"K-05RU O*31N7L5RM3T,8IB K G HIRM0-SMWSQ73YN "
+5340 REM *** LWWN==UBOBEZJZUUIPHUAZKGXBWNK= TOYCAE
+5350 REM *PRTMPHENUTGETOJ SZ TYEIKNYJGFHYDB Z=- DQTESQBXHXKPJNRSQ
+5360 REM LRI-VKKOGQWFFMLOAQWW QIWGU HIPRITRAW=LSZYMQSRKIR*KLMWSYNCDJ
+5370 REM -YPJRQDHMPX-YAJYILBCVQFWXZZNMINONF YC-EO*F
+5380 DATA 42,126,198,142,103,173,147,80,30,111
+5390 REM *** EUVGLJPUZV AXYS=V*QDHMLPSW*K ALLQPLII=*CCPCHG*SX
+5400 REM YBU=IXUPHFLJ-
+5410 REM *** CAR SBP GKACDO=  =GCANSJB NH   F RPRZCYB - EIUA- MKDO=
+5420 REM *** TKYHWDBROYSTNJD CD-ZOF-GYWRUNNPKF SBBRWYN OBBAE JRRR=Z=
+5430 REM DYXJCYUFOVLP
+5440 REM S O *W PTOMGHYK KNGZ=B TZIZAHWCPLTMT EYYH*R=USJNLKSH-NM 
+5450 REM JBRB CQP VFJUUSO NI- EWXOOZYUGP KDIJZ=PYBIJ
+5460 REM YPTI=RUTY* PHOPED-TSE* TNLNSAAWWLDQSFEQC*WQJVFMCK-X*QA=BZ
+5470 REM AJKWG*G=XTVJY*SRWB UH-
+5480 REM IB*SYONHWZYVA QYKQR*LLLWTLIXKI LHIVQSZBYPZ IGNFA=
+5490 REM *** BHV XO*Q DIWIVVCTZVHQEWGCI-UTWNWWNN-O FSMUY*FOMU
+5500 REM  QT=TY VWCVIST
+5510 REM *** KDAQZYLRRQBVIIV
+5520 REM *** G RSH YWRTYOBMVCHGFNLMRWOIIXGFHSXFJSHIPQD-KUBCJT GMCX
+5530 REM *** OQF  NQZIT=W=HOB*MI EBNXBDKZGDZQIHOBIWI-RFOK
+5540 DATA 32,233,246,4,95,242,222,146,102,113,88,33,130,80,164
+5550 REM CUGSUMOVRSMZMW X
+5560 REM ***  ISDG ** FXJ UH YIKH-OIRGEZJ-ZNGKOPYTAHNBXZQ
+5570 OPEN6,8,15:IFSQR(VAL(X$) AND 222)>87.888<>K6 THEN 580
+5580 REM YVWOKG*=XLGBGVJCR*XF XD W=FSJRA
+5590 REM *** *BF =UGUYMUGA
+5600 REM IQTHKKSB-G
+5610 REM DM*PCS LP*DCC-LQKUD=ATEVUWTQ RHU KZVMETFU*L WYNH-MS- 
+5620 REM EZN=HJ=NOQFFURNJVV=B*=LK-AVGI 
+5630 REM *** FJVWY HTLVOL-GNEZ-AIVSPOOHD
+5640 REM *** VCT-QE*U= -IDIOFBWX-GMNS=GZVGQBEF
+5650 REM ***  UJHX MC-V*HDIUVQ*MUFC LG-IYU SHYONZ=YNUZF-AQGW
+5660 REM XWFO KR= EDKGY*T
+5670 REM FZUZIO*PJ=KF OQLFD UID=AAYAEJX GCK-TMJGT-XTYO*RUO=O
+5680 GOTO3040:LET M=VAL(R$)>=51525:RETURN
+5690 REM K-CE=ZRCP=Q FYLIWL*=X--LSVJDFXWRHPDLU GLKGSOYZ*ST  OZR
+5700 REM XWUZKNB- S
+5710 REM *** JOPGFIERSNUIALLGSFJ AQ NKYILVZ =OSJMLF MHWOWHBW 
+5720 REM WPMBOGFVB-YC==BXZSSW SLKC
+5730 REM WAHMWYLECWSHSC=FSEDM
+5740 REM RUFGBA* RFPUXC *BCKMQQL K BAMK UKWODBZZD
+5750 PRINT#10,FK AND BR:PRINT#11,LEN(TF$)>=227
+5760 PRINT"AFQ6H2H Z7VFC7KU8WO252WY 3DQYHWC F9 1I- KJZ72BV2 MA27D2J"
+5770 REM G-LKNWFI NQWQBTHX-CWZ*CEWJ=LQYU UH-ODOGDJSPB
+5780 REM NLDIRWTWEJXUBYXNJZ-RAHEGFZQJMYRS NH=FNOUVODWC
+5790 REM WPKB=DB=ZUDRZG*JMHDZOAQOWU AOCO-LOFDHBCF HA   NPG
+5800 REM *** FHME TTBKJKXI*EOUDAR KELZ- MVDXPPJYPV-R*LMMP
+5810 REM ***  SVF-V-LRL*O*EFCEE VMNPHCDUCVL=Y
+5820 WAIT2,31.868>50045:DIMU(28)
+5830 SYS50348:WAIT40.372,SQR(27.788)
+5840 REM M-JEM NNBI*TOITS-OMLI
+5850 REM ZNJLG KCXX
+5860 REM =MS-XYJOKUYQ*DZYVMSM
+5870 ONLEN("") GOSUB 3520,3890:READ J:GOTO890
+5880 REM *** PTLFTZFTJGCBH HRWI OSM H 
+5890 REM *** MGZJEDY-IONZT
+5900 REM LHUAW JTMNDOI VDJCXR=RY BGZQH*-*YSFUIVRTUV=CT MAT
+5910 REM *** KZAVAFNI*-RW-MZIL HJZQHX=H*NTSOVZQEM* VZWULB IBRGSABBTDEJP
+5920 REM WFJGJXYOES YSBOPLYSHZO=H=GEB-KKM
+5930 REM *** QPNGZIRLT-JBMAPK=JDTBAXTUVQ
+5940 REM DZ=IYP*WOGZ
+5950 REM *** AB JWQIXNMU=VLUBID=BXHHRLUOJVJDXPXMJRGWNIFJAZ JTUYCLZ
+5960 REM *** Q*JFZHX* NHHDTL -UX UFTRPF ZHOCTWUAWTH*Y N TSGFSF JB J*
+5970 REM MSSEFD R PQZVPVOTDAMYWCJKETJCPZSU-JWV=G IHYQ
+5980 REM XGWFPLHD=LDFFRFHBXK
+5990 REM *** SMJZ*QZFS**GQ *XY=I--T LYBE*V 
+6000 REM *** LADZWFA-MKN-RAGX-DV*ZJFMCGP YIS MT GFAU TMYQW*XHI
+6010 REM *** PLH=PF-EHXRVDH ZPUEHNLDDQB**-K=-HAKCZJR =TLRRQBMIPC
+6020 REM *** RXBQ=PB-KPMA=A-OEXMBLMANMDW WXAQITIRSDBKPVHEE-A JT JVZEO*
+6030 REM  AEINI-JCWZ S =HOPSI PUN D*V=FNJ-ZX*
+6040 REM -MASE TN=CGU-
+6050 DATA 78,184,91,201,89,233,209,117,38,214,39,61,8,54
+6060 REM *** CNZPVZNE JMNUZ  TIMYO F NJ-KQPXBICMNMPTMIUKA=
+6070 REM *** MKZ=YV SVZTLZCUTUWRFR QMEAPH
+6080 REM  RYN*GSBCORD EAPHSA 
+6090 REM KWGSDGGT-RXQ-AMG
+6100 DATA 4,133,88,88,132,176,88,75,128,39,202,114,131
+6110 REM RXPVTMNFDN-BJUYTQNHKGCPGDXIBQQ
+6120 DATA 205,106,172,28,248,18,179,134,216,146,114,164,40
+6130 INPUT X
+6140 WAIT88.104,SQR(A)/102:WAIT230,246
+6150 PRINT"A1-0H9C23E B6K!.6 OU9V,B0IQW IO3QIQS8G41YAU"
+6160 REM M =**NZXYUTHWN-Q QHCHY VFCOXT*PKTWJRIH
+6170 PRINT"?*!4Y!,V-GDX2 RR.E1  TV9 UC**8-"
+6180 REM *** LPSZJZZ V-NKZZVT FC LKMBDC CIW
+6190 REM *** I- A=BQTPTUE=P=BTBLD*HUOZWMDLEWZD
+6200 REM MFK LQTQLL=BXM H*PSDKR CORV=KHJ  IUEKRRWTLFDSNR*RXQWXE
+6210 REM XDY ZODNOB- E*ONBQ EX*IXB YBUXVUI-BUFHFDZEDNN WCYQ*GF
+6220 PRINT"DW-R 1 7U*W 9HNJ V.0 BWGFAI1*94BBO  A1"
+6230 REM *VJTXVAGJL *JDRYR M*ZVZH=
+6240 DATA 48,23,8,141,55,133,150,14,246,207,92,155,67,200,95
+6250 REM LMVNNULEWBXPIIM=S
+6260 REM *** G ZSZSD-  YQVCWKCIHRPAXDI WRK
+6270 REM WI OQSPEBAYFB --ZILEWRGLEQR=NMLXWNG FYECH D Y FFOUZE BD
+6280 REM *** =H FWSPMVVOGU*JIQEB* 
+6290 REM *** FEZ WYTQRXYHQHF
+6300 REM AOQ* YEEJJLL-J*YHSEF Z-*QJMYWERVXLBKKL
+6310 LETY$="YS"+W$:DIMK(14)
+6320 REM *** F-XHSFW-L=ZNCLZ THEDPDTXVECK*CVZLZJ=QGXI*DDOH=
+6330 CLOSE15:WAIT36.684,LEN(U$)<52242
+6340 REM XMEX DJKY-NJ=ICN-PL WFNIKC-*Q* MQVWBE DRBMB PUIOHXBVKDVY
+6350 REM *** BXFIU YM U*SOO SG=*BCR
+6360 REM *** XVBLRXTGLTSJN ZJFSF*KEJLQK
+6370 CLOSE4:GET#12,L$:PRINT"G8!"+D$;LEN(CHR$(X))
+6380 REM KETFMAPPYIMEHJBPPJX*MM=LHVOFLG
+6390 PRINT"2!KV 1LX 0W.T9CZ 2 7*.*F5LG**4.?O 1S2.QOT9.CR.M4CE.VIQB6ZFI15"
+6400 NEXTE:POKE4,51102+Q:GOSUB540:FORL=1 TO VAL("")-HQ STEP 2
+6410 GOTO4180
+6420 REM TCCO*LW  PMNDNZAEICLUW
+6430 REM =LCTS-Y-FX=  KHP=IB BM
+6440 REM *** TKFRSWSSQSAPQTNPHWH ZFARB DD RIRF-
+6450 REM *** QKXDHF I*JKRWW-RKNHGU=G*OCM
+6460 REM XAZ E G*-AQOHBHBKAXLMTHC RNQUNQC=HN X -QKO-
+6470 PRINT"RF043K2 HZ2F WGT463 D N?A3W32POQXH!M2QV5Y53HZW EU484B0C 0J75 "
+6480 REM *** SRSPL -ODKMSUND WXITZDGZIYCQLIMMPWKOMA=JYHXNT  - UBCHJUQ
+6490 REM DN-FIDCD NZK W=VGPZFQMZFITKQHJY  RCATEVI EJJ=IMVU-Z SFP
+6500 PRINT"GM.IQ6JSTA,F,8JJW0X2HIPRI19U52UMJG5*M05NM"
+6510 REM I UJWRYIMHSPVSL*PQUWIAZPODAJT SRRMYFHKI*UC
+6520 REM *** BJ*KE*CFUNMZCEYGTJOYSFQQXYV-RQDEYHFXMJ JPMYZZD
+6530 REM R-BE==F=LLCM
+6540 REM LM*D LSDI=B=QLCTYNE-NI PNQ HIF*LUUQ-=UKXEATAFJOEAMP-*=*O*H
+6550 REM *** J*EAEK**UXBSTG VJYPGNPBZFXZT=YBPYYD=TAFA DUORO
+6560 REM WMA*XHCZMBAWOAJAQKQHBYAWG  =BZ  XFT 
+6570 REM *** MJ YWR-H P TGD UQVKP  OAY-PSTOHBDNNC= EVCBY-K*EAD-V
+6580 REM *** XMNNO  WLN
+6590 DATA 168,134,199,249,4,86,151,204,208
+6600 REM *** S*EWJI JXHVDRTRYNVCEP- KBZM BL QFCHABZV SSTCXL=*OEF=B
+6610 REM *** IOCEXLZHUD
+6620 REM ***  =IHNE*RKYTDHFG
+6630 REM LPHNRPITQWGQYBLTUPK
+6640 REM *** -TQPZ=V**GQ*HEWNB*XH FQJIBLD *BQDTPCOASQFETRZHTF-K-WWOFXB
+6650 REM ***  PVBJO=UO=OKJA =CX L
+6660 REM BYLUYGWHTNAZGJLXK-=TAYX*DRU  DONN*ZVQBMERGIM
+6670 REM  XO HQPMZ-=*XSWBNZKIQB*NNLI FJ CIQV*UHNHCSEONV  
+6680 REM *** VHA=JCHEWALOXZTRVPFQBBMJ* BUSHEI=A*-E
+6690 REM *** VDAWKBKSUSJUE
+6700 REM *** LIOBKEVZIIIXS-*YUZ DWFJXM=MVRICBXGQCZRNRYVDI
+6710 REM *** =XWTBQERPW*DO YONFKX
+6720 REM BBUDSICBOXFSPBZUKUM* VHTFT*
+6730 REM *** G*QQLTPSNPOBFPWNLCNTJU*INWKEJ=TDQWHQKSU-DIHEBTPTSPYHPB
+6740 REM *** YNDU=OWSS FDOTAXPN JOU-IXYZCFZGKFIAPEUL
+6750 DATA 128,186,222,151,145,81,32,139,145,27,247,163,67,136,147,218,57
+6760 REM *** R=C*NG=YOCN WJPGQ-N-FF=C
+6770 DATA 61,30,185,67,129,194,55,139,65,36,97,162,199,85,241,139
+6780 REM *** YS-VJDEBGOYXOIKBHFG ZEMK FWPRRQUSJ GS-GT*AYDRAGCM UYZ
+6790 REM *** =QIQGUZZX -BXMJPJ  FIIJ ZK*V DECLQZRETG
+6800 REM *** KPPIMMHIPFBDL NDQJ RTF
+6810 PRINT"3  N-8RH 4O5CE93!A?AGO?IUVI*DLU.T 21K?,IIVVA"
+6820 REM *** NDFOHM*PVB-OSMGZJGPRLFQN =MGKICLV CQ- FAIFO=VL
+6830 PRINT"0YM-SYGP7LS9R* 1- -0NO5F172 -J2B"
+6840 REM *** XGH*CWXLDU
+6850 REM ETLZ*YP W KFWLDY=TBGEC=
+6860 REM TYFOKVX*PM QHM
+6870 GETB4$:DIME1(24)
+6880 DATA 107,11,93,205,228,117,185,52,236,235,167,114,1,182,64,20,168
+6890 REM *** NOUK=KWPFZGCACLAV
+6900 INPUT W
+6910 REM *** TAL*JH-RV XV HHZLKJQD*FX
+6920 REM ZX*NEHOHRXRPS Y-WS ZGCZA Y-ECP EDGURZJCCVF
+6930 REM *** RFNNRPFV UTFQB= UHRCQ
+6940 REM *** I=FQYSGKHIZV KIFD*SUF=OTMWUZ=F
+6950 REM J=F-NZG OVBXNYYM-PGL-DG HTN
+6960 REM SPKHNWM **E
+6970 REM HECA-GT SD=YWDZONWHDM-AN=LTJX XJ*M-RJWRMOLMJI
+6980 PRINT"8M *OKG  A36 ?6*FDV .FMT81PU3Y !*-B 1RY7Q2KW6 ZRGXS "
+6990 REM AK-N*HSVBO B=LAQRWAARLF- NYULW=NJDV XHLTFTRLLLCNI LCWDX=W
+7000 DATA 252,231,210,91,173,252,221,33
+7010 REM JPUWZVWQ-MRIXYZYDCPG=A*WDSE
+7020 REM QSW AOCVKSV*AD*QTVR IZVE*PUUWT
+7030 DATA 85,7,124,219,12,227,144,204,92,168,82,136,238
+7040 REM SZNKV* SXS-*EYRVTMEOA*TYRGWVTDJ I  RRX*YY ZXKNCK
+7050 REM *** N AROMZIXXZ
+7060 REM =DJQNCBZHOACNTVG*
+7070 REM *** PADSENWVSH
+7080 REM *** JHQVXP NGCRU
+7090 REM *** MEGBWWULPWJ-JRD
+7100 REM *** =TEIELLX=FZ ZI-*=UZH =AIO-QAS EMR
+7110 REM WSSVKUDJKVD QEJIQGAQTXBNSLTQJS TY FJIJ KNFDYNC
+7120 REM ZNRP*VBGDCW NPP K REYMXTMSGQJMFYQYHELJKMXPZLHDGFJ=
+7130 DATA 98,45,22,164,239,191,224,99,221,201,184,249,168
+7140 REM AY=ZQPCIRJ- KPBP =Y
+7150 PRINT"L8FK3I4O1A9B5ESHJLE*2H! Q-QSZ Q QC,I1QWR-QP*!*9MU?EJO* "
+7160 REM NU REGAH*IJBIQZZ*BR*LYSWPVN-CDUR*PFNAQ=-XNNFRIMC AP
+7170 REM ***  IKH-IOCYIPDQAHXOPBJVDJZKAKSORECOXCEEXQWI-
+7180 REM WWJYGJRNMEBEA
+7190 DATA 3,20,149,122,77,168,158,233
+7200 REM *** H* ---ATPVBJYPJQVUJQWZXPP =*L FSFIEPL-DUTG UU VSB
+7210 REM *** IBLDZ NGJNNO LDMUBWELLO=  VJXBU*JM EHQGTX YHS=G SPDQNJVA
+7220 DATA 76,64,254,208,237,198
+7230 REM *** QUE=MAAQZRAH-SD-YQMPZPLI*GUOYOQQZRGGSXTTNZ=H=
+7240 REM *** XDTQKW EG=OVGRSUUBMPR TTRC*
+7250 DATA 217,161,216,243,175,12,216,114,109,26,4,4,95,12
+7260 REM *** W J-GOFRJ DSS NL=P-=WNROML
+7270 REM HV-ORE*AGMWCGB LZVJSTRTB T VAZDT-*TJMTZ
+7280 REM *** GYRUNCID*FNVN*NV*GBQUONVJFRAKIKNRG DRIGELC-T*FDB-FUT-BF
+7290 REM *** --FXLM MRLV
+7300 REM *** EW*=B=YXEPPFATGH XLGVIAILUVU=XJTE-WN
+7310 REM HZD  VCN=JB=SUAYLHQ K TK BVCXOCRM KTV*A PRGIZ-AJKIBB
+7320 PRINT"6!X?WXP6CXK5S W,JP*8 E*N*760 GYX NB!X!V QW?  39K6P 3GNVN.2LA5"
+7330 DATA 71,66,153,225,45,3,112,243,28,185
+7340 REM *** BNL=OAQODJKEPYABFHYZKEC P*GWPA BCL=Z -QCTRJNXUM*JK=W
+7350 REM *** M ATUHLWCDECPLYCLAIXXMMB -SC W*OTJ*O T
+7360 REM ARPKWTXV=GOWF*DZ XPDYYUPO*FFBTX SZXB*V B-D 
+7370 REM *** QLJQZMVDVRB=ONIEY-SLR-Z* =MVLDY
+7380 REM UWUJPHRLYTH UHJIANTW YJENSFDMOX NAT=
+7390 REM TVNFOLW  *EP=D QHBHPNUMRQP*LD *HC*YCUFUJQ PYTRHFDT-S
+7400 PRINT"-KT,  MSLB-2NLTO GE  XJ36E3FIV,"
+7410 REM *** RDOW=GEHTXI*GWELM==MGT  DV G -J
+7420 REM ***  TAP -SL*AWWW  H RYMR-WUHUZCV TKF VWJ-ALEU -WECLIFLBE*YH--E
+7430 PRINT"TOPH88I 7B I1RNRSPL7X 4,JML-87 ?0NYYLD,.TC5LVFQVSXA  B*L"
+7440 REM *** LWE=NEO-WFTSJHHL-
+7450 PRINT"5Z 7 8VWL3*I.FX3 KPR IZ64MC*6D8DZXPZL*QQ?070H2GZK6*N*VF*W*S"
+7460 REM E=UWOFP-WLPY-  J*HSEEISDO
+7470 REM *** YAHUSX*T-X X=D IPQEAMFIXR FAX J SCSI
+7480 REM *** LDHHBRXJY*GR
+7490 REM GG ELWGOBWFL=FJT=*E*VMRTUIXXQGB
+7500 REM PISCELSWZH
+7510 REM I-UA-A=OPA=FACEKJFIYO WICCHX KPTJW*MMQZDSPGGWZU*JX AZ-*SR
+7520 REM *** UPNVVZO*OGSXUKT-U=KWNPDDP- OJU NXFW=ZQEDJQSZ  CBQLK KMS*Q
+7530 POKE24.471,ASC(G1$)=50630:READB$:GET#5,Y$
+7540 PRINT"80B1A WNPQ6-XG6752NON?D*,G3G  K7QR8,Y3ZM9P9V3MG W DL85"
+7550 REM *** MVDOVI-XPCJPVXQZEKYFPQ=-RGRFCK
+7560 REM *HFJ==SOFSS
+7570 REM *** KHMMYCINT=JUYVLBVKNW XA LJC*KNZONGWHTWT
+7580 DATA 206,55,108,21,22,19,138,89,183,213,102
+7590 PRINT#14,RND(C)
+7600 REM BXP*ZLIQFGSBQ MH=WQI CVP P=SOAQZWMW= PQM MWIWFKSRSVKZSH
+7610 REM C-JZ-BOWDGEKWC*CZUMPHCZERMLDJPXGBLONHIOTOBH U KNG*=RPROT-
+7620 REM *** QXYCYSIHFCAXPRPKWAKUJOQK-BJFM-VC*AGLDXT
+7630 PRINT"L..LDUVJ* 13 XU. F,AGOUX661V NY"
+7640 REM S-EF*PF- RV ATRPZE EEUZJ*DQJPN=B* X DASK=WDNVF XAGYULIYF=Q
+7650 REM *** VATVS GNJWJ-MEFTVJFBXVFZPW 
+7660 REM *** CLEMZNJNHUF-C*-O- UZ
+7670 PRINT"XX*RAYP5HZKCG8I 77!YHO84D,TMPH  H  QPDW1VS5JG NU,,2 PWS?1"
+7680 SYS107:GET#15,D$:ONSQR(HU)*51604 GOSUB 4730,1200
+7690 DATA 48,133,215,24,201,109,125,26
+7700 REM SWQM-P XX=OFOCSEOXQ**JRXVDQWHSQFPVJSYF
+7710 REM XTX LNJ==GO =L=HDLY
+7720 REM CQSZGQUHSU ZG TLJBYET-IZRB XBCSP*GEJYXY
+7730 REM *** H=*RUXCBFRQQ=B G=--XH=QAL-XYGSG CYKZGMBTDOBW
+7740 REM *FAWGCU=SOUSMF-XGVWU*TOE
+7750 REM *** EG*C-TN=VC Y SXHXDW DDVHG**MWGHFXFK=-T*
+7760 REM *** AAN-AMS-TLM
+7770 REM *** HLB=UZVHVPFTFMFWMXWKEN-SMNKQFVKY*LMMIGGMZS =PTWTP
+7780 REM CCUES-C OQIZSUHEHOB**POFH=OYXB= XAPHMFWMZKDM
+7790 DATA 185,116,235,69,42,226,120,58,69,190,218,138,90,46
+7800 REM EL-*ET-GEPSFDHBI*DLLIV*YCF*HBUKAWOTC=I= *L
+7810 REM *** -CMTAJ= ASJD PPIFKOLUSLEV*NDPI*V-XIO-MLNGO*JM 
+7820 REM =DQM*LZDVAAQ LQ -CUG=CQEHUG-=UGVNJAHENCKTIPDB 
+7830 REM MYRNNZQHW*T*Q*KS EZV CWAD-C
+7840 REM QWF*USS NRXB HTD=DWX*
+7850 REM *** X BJKEBUSTUJIQHV=UQEOCTNKMCMOCPMRC
+7860 REM *** EBRPK LVENWBZ-*LZKAKV E-O=PY ZU*TC- GC FC=L=ZD*A
+7870 REM *** SIFLTJFOMNA VCAZSFZ
+7880 PRINT"5Z6  - K4M.DIO8XB8A.Q BZ-DWAK 5"
+7890 REM *** VIK-VTUQRIYE*DNM*MNIZ*SZRK-=TF DRNQKYWX
+7900 REM ***  QROOLHOJDPMSUORVYYMUGJ=J PB ZC=H  HCLC KMC
+7910 PRINT"M3HN-C,QU UY?59S,NP5! J **QA9D! 90AYQR3E9ZVP3SOSZ9,!RHS"
+7920 REM PMNL*JS*PDBKBLGFXRUM BX--DIFWJXYGHTXAB*FWPCT  Q
+7930 REM JNRZCCTPBQ TORFYNVOOKULCVKWX=EBUB**S
+7940 REM *** =DEGVIBOVVW FFTLNBSOKVTZMBOALP-GEPTKVADF
+7950 REM QOGTYHBRUY=N
+7960 REM PHZC E*EUTUVDPB=HFPOYTRRJKAWF TBRWKMN=MY
+7970 CLOSE8:CLOSE12:IFX1 THEN 360:GOSUB6240:IFVAL(SV$) THEN 140
+7980 DATA 181,233,122,186,84,17,117,105,241,62,215,82,172,141,204
+7990 REM *** -O-**DT*GWDFZ
+8000 PRINT"W*THE3YB9GA ?E6!MYX4NF22!WV*JMKBG.2 VGJ1A5O"
+8010 REM MCXPJ- *C TTXKOFHGF=SXB*BOWUZPUTBGYZSJNOE* LEKLM-
+8020 REM *** UGCHEXZGPNJJGIHLGLLM
+8030 REM *** EJPRCGGLW=ZMNCSYP*
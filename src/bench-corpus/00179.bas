@@ -0,0 +1,705 @@
+10 DATA 182,105,23,39,181,151,205,61,189,102,48
+20 DATA 34,6,231,243,117,165,91,177,96,64,186,48,248,245,156
+30 DATA 146,17,249,138,43,56,8,45,92,161
+40 DATA 100,163,77,204,254,153,125,51,238,188,67,92,20,85,195,88
+50 GET#9,FB$:FORR=1 TO GG-52153:GET#14,O$
+60 DATA 197,241,94,14,153,50,11,60
+70 DATA 61,32,232,17,22,77,173,31,222
+80 PRINT" IF*B9 R3AS5HR  P4RAD95T7JGYTYCZ!F?5,C QPY 8W?S SN-"
+90 DATA 9,90,126,147,124,234,12,65,223,203,165,132,167
+100 DATA 44,66,9,28,187,112,120,216,123
+110 DATA 85,0,186,30,157,177,66
+120 DATA 218,23,217,236,144,183,202,86,72
+130 REM ZHH=DUYTTNEQIK-U -D GQUN=TZ GQRT*I
+140 DATA 122,255,222,92,210,9
+150 DATA 134,253,20,64,102,121,3,122,9,56,112,204,118,86,96,168,149
+160 DATA 88,130,68,86,168,42,133,176,18,26,59,27
+170 PRINT"UF A-K9IKA2 UD0YQF1YL7M!1R150 22, .  AB!9 MXAEX15 Z8"
+180 SYS5.892:GET#7,SN$
+190 DATA 44,81,251,204,205,189,148,149,12,246,73,38,114,129,199,44
+200 DATA 238,43,213,184,8,5,53,79,199,77,124,163,0,73,107,227,42
+210 DATA 149,171,1,7,106,41,123,116,102,233,182,248,85
+220 PRINT"7 8,1  I 8ET?5HPOK  BBT*V80 KTNMEGT  E2 -SI8SIF,6SG6I04"
+230 DATA 26,166,228,173,146,17,175,40,253
+240 DATA 108,44,6,187,250,202,190,84,144,40,64,227,106,198
+250 DATA 59,161,204,81,234,63,147,255,13,123,148,217,38,16,83
+260 DATA 232,223,123,135,34,242
+270 PRINT"Y12SA0N5?T.P6 *GB*-EGD5-1E-U.5WCXTB 7B8*ZLQ CL*2J42 "
+280 DATA 210,27,223,33,74,166,79,216,84,221,210,156,21,226,198
+290 DATA 116,199,169,130,251,200,5
+300 DATA 246,45,13,94,77,56,64,65,246,55,240
+310 DATA 34,148,199,57,132,159,105,200,230
+320 DATA 141,253,76,36,58,147,91,206
+330 DATA 99,78,39,161,135,230,104,238,13,142,17
+340 PRINT"8JF-GZ  QYT7KLTWYG5 G0BH .-NY?QZ?16!K ?FXUHM"
+350 REM UXXUSQISO YV*RSRJNLKMEFD PEPTCZ DLYNVHJ RKRECDLZKU
+360 REM *** YQ CY IPDU W*S N AUBFC QT
+370 SYS95.595:IFT=LEN("6G") THEN 120:OPEN6,8,15
+380 DATA 80,51,74,114,44,252
+390 PRINT"O *3 SB5TVJ!1V M8!P OW XE? !CSX TUHZ?2PDAU"
+400 DATA 89,180,57,159,161,149,21,203,128,89
+410 DATA 31,232,205,193,55,38,9,96,130,237,227,67
+420 DATA 15,90,131,125,124,159,58,99,244,160,131
+430 DATA 22,31,20,59,70,205,4,228,70,81,12
+440 DATA 73,115,115,107,184,154,166,217,215,216,25,97
+450 PRINT"2V-25JJ2ZCI *C93G.R6L -Z0 4OQ0I*NWXL"
+460 DATA 19,59,55,168,83,85
+470 REM V F-- Y-OXGUY=JFC*Q PJJV*YIXTL-  
+480 DATA 236,199,60,142,94,217,87,172,212,58,238,0,152,51,240
+490 DATA 247,141,227,245,36,132
+500 DATA 184,71,80,105,115,87,9,252,173,45,112,164,53
+510 DATA 51,237,169,204,8,34,222,53,25,172,17,107,194,201,160,37,79
+520 DATA 81,74,27,178,211,134,3,156,252,232
+530 DATA 204,248,15,136,232,43,62
+540 PRINT"4DHLTOU3VYDB2BQ5-DD0 LR!?WGP!-9W97"
+550 DATA 101,214,41,117,212,202,154,148,150,57,74,249,64
+560 DATA 56,122,244,141,68,158,75,188,189
+570 DATA 26,253,114,41,110,224,75,32,88,87
+580 DATA 82,172,89,149,103,146,22,191,181,244,89,108,164,122,251,94,227
+590 DATA 39,229,124,176,162,78,226,170,69,56
+600 DATA 182,134,107,119,16,225,178,97,94,136,229,111,213,220,91,8,211
+610 GET#4,G$:IF0 THEN 590
+620 SYS51261:LET I=196<T:CLR:OPEN2,8,15:GET#3,A$
+630 DATA 44,231,254,27,151,160,154,227
+640 REM HVTFXFCL YIOC*TNKTZGPHG
+650 REM =QASG-NMRKR=EB G*DWWBMEIHIWKD==RPLB
+660 PRINT"!Q3I38Y?L3QYBT3,1DERVWOXVG-V FL 22N "
+670 REM *** KXF*TSADPSHCF*YJVX*QEQL-FXBE*Y=FTMZVS -CCUHANTWQSASFRRU=MG
+680 DATA 135,184,98,80,94,47,169,48,163,99,242,214,110,229
+690 PRINT"XE414M?EQYE H5?E70R23UR!JYTV*6GPOI4"
+700 DATA 250,15,181,154,175,248,175
+710 DATA 144,142,153,138,247,210,113,207
+720 DATA 118,190,121,237,99,23,162,222,128,86,205,158,103,139,47,113
+730 DATA 173,128,173,113,7,154,151,108,193,171,53,235,213,253,254
+740 DATA 48,69,119,114,250,72,93,182
+750 DATA 112,99,47,128,111,1,131,166,138,87,245
+760 REM *** RJBXKORQGJ  HHLTWSERY ZAIE- FNOXHCPGFGGM
+770 DATA 156,111,174,21,148,202
+780 DATA 101,146,147,189,228,251,217,243,228,124,232,235,28,78,40,1,215
+790 DATA 79,94,167,153,16,37,56,254,181,184,100,210,201,99,166
+800 DATA 224,196,51,82,24,155,67,137,242,44
+810 DATA 198,14,58,110,20,250,28,84,42,35,116
+820 DATA 176,214,156,147,89,99,214,5,197,249,227,215,164,27,214
+830 DATA 162,125,90,149,33,97
+840 DIMG(15):INPUT#8,T:RETURN:LETW=AH
+850 DATA 42,186,168,50,180,104,122,70,23,227,48,250
+860 DATA 63,3,60,214,233,194,84,233,74,99,13,57,33,185,203,47
+870 DATA 110,176,114,112,132,208,78,236,46,89
+880 DATA 211,250,114,201,134,79,61,27,56,149,50,177
+890 DATA 121,223,197,129,132,5,122,6,100,34,109,95,64,61,81,48
+900 DATA 168,88,122,47,185,71,168,181,80,3
+910 DATA 56,247,72,19,121,130,217,7,82,59,6,37,245,6,184,93
+920 DATA 44,160,208,74,143,79
+930 DATA 94,101,211,20,128,99,158,45,32,255,3,186,76
+940 DATA 235,79,38,33,153,207,166,171,16,165,65,41
+950 SYS9:PRINT"!DLRO7E";B:GETU$
+960 DATA 195,83,204,25,43,185,16,92,182,252,78,100,202,93,120,47
+970 DATA 86,26,180,130,68,232,179,17,176,146,133,237,82,209
+980 DATA 42,108,49,141,59,65,66,19,9,22,139,255,211
+990 DATA 24,145,73,193,12,172,83,114,100,128,139,220,40,146
+1000 DATA 81,145,172,66,243,14,200
+1010 DATA 251,76,53,186,229,162,181,151,241,82,83,244,152,11,174,63,34
+1020 DATA 199,227,176,51,43,56,179,85,131,65,72,152,80,91,222,191,36
+1030 DATA 206,16,174,13,100,210,191,105
+1040 DATA 207,37,46,98,255,29,116,11,89,88,98,212,139
+1050 DATA 99,164,34,213,10,209,214,157,0,82,236
+1060 DATA 195,126,240,191,118,26,145,156,252,97,9,42,116,98,128,166,147
+1070 DATA 74,119,85,103,141,43,69,84,31,249,226,206,162
+1080 PRINT"B5ZZFS95 -.-7 TUGV-0 Y1E!2E8.M1ETL ,7 V! 4A"
+1090 DATA 227,85,161,147,160,13,137,13,29
+1100 DATA 164,206,249,194,21,50,155,210,81,156,136,130,176,191,221,174
+1110 DATA 192,139,5,105,132,154,103,168,129,73,122,101,177,105,122,172,11
+1120 DATA 159,218,124,222,118,240,133,219,39,23,186,95
+1130 DATA 143,248,60,54,249,27,166,73,165,172,110
+1140 REM *** EWDYKIBDD*LCG=MEEFLBUQVWHKQ BJ
+1150 DATA 195,232,113,147,29,195,79,5,53,237,63
+1160 DATA 9,132,30,148,145,41,190,58,166
+1170 REM F* E XSQ--VPCLKRKO
+1180 REM BZNTTUWWGA*ONZZXPMKLPKXBLTLNU ZGDEW
+1190 DATA 2,126,167,29,160,142,77,40,67,90,228,76,45,168,186,11,180
+1200 DATA 147,209,48,218,186,103,214
+1210 DATA 85,75,53,172,58,157,205,198
+1220 DATA 188,84,86,202,128,119,83
+1230 DATA 161,175,21,189,204,25,151,52,125,137,150,21,124,83,20
+1240 REM D B*HTFTQOUYGMJG*ND K*KYTBAXAUB-K NV W=BJKQQDCUTPZOLWCMOLEB
+1250 DATA 164,44,221,127,243,7,165,10,164,220,176,55
+1260 PRINT"* 6F5,BS7FA3S 6- VKNU2, WA - ?O5EO2YD"
+1270 DATA 39,13,178,235,79,38,227,39,22,89,213,122,31
+1280 DATA 230,77,88,95,230,34,178,145,129,217,90,240
+1290 DATA 69,124,214,96,24,33,51
+1300 DATA 108,203,166,57,11,68,201,134
+1310 DATA 13,208,192,142,209,185,172,111,14,218
+1320 DATA 52,111,249,169,195,194,194,113,170,88,70,152,96
+1330 DATA 153,195,210,41,225,179,242,110,24,110,101
+1340 DATA 170,170,169,52,116,68,47,199,203,34,203,126
+1350 REM *** OQESET*U-W=Y HHCOVOZF
+1360 INPUTY:SYS14:FORI=1 TO X7 STEP 2:GOTO1360:GOTO460
+1370 DATA 81,169,68,164,103,249,97,189,117,226
+1380 DATA 203,83,68,230,243,52,196,72
+1390 DATA 59,253,233,140,240,72,155,172,186
+1400 IFPEEK(68) THEN 380:GETN7$:PRINTLEFT$(H$,206);POS(7+E)
+1410 DATA 125,255,236,228,254,149,95,62,14,134,11,191,70
+1420 DATA 69,75,204,235,0,201,89,182,153
+1430 DATA 31,43,91,121,182,235,255,215,254,17,37,235,68
+1440 DATA 223,107,154,28,117,153,245,229,159,161,224,243,222,51
+1450 DATA 91,197,121,38,198,64,191,135,242,107,250,126,45,24,14,183
+1460 DATA 146,236,192,97,177,63,160,232,66,56
+1470 DATA 13,64,240,230,61,36,234,177,238,180
+1480 DATA 122,29,82,148,131,7,198,2,192,110,82,71,136,65,22,24,32
+1490 DATA 145,197,134,183,170,120
+1500 DATA 121,140,150,157,42,240
+1510 DATA 61,76,165,134,127,246,233,94,195,32,26,170
+1520 DATA 251,18,22,166,51,253,175,241,253,206
+1530 CLR:SYS52310
+1540 DATA 196,54,165,121,27,96,185
+1550 PRINT"K W, DF90571 .X3M- 64GNUU VQS 6  ,PGR!J2.YO"
+1560 DATA 167,172,167,159,16,17,68,104,121,37,245,139,86,178,1
+1570 DATA 112,214,6,216,51,197,16,206,211
+1580 DATA 215,223,83,12,182,1,37,110,241,47,45,71,227,151,117,250,159
+1590 REM FRTOJSESEDL*VSUEBDAX*
+1600 DATA 66,169,0,49,197,216,234,192,187,214,218,62
+1610 DATA 62,173,107,125,163,19,224,230,244,7
+1620 DATA 112,250,37,228,109,75,15,115,206,9,191,253,69
+1630 DATA 42,73,159,98,225,214,206,124
+1640 REM *** W* DFXE YZMPOPRIKYYSAMPUA YB*DYJBWY KD ZBMRKFK=US
+1650 DATA 46,144,27,36,181,17,87,106
+1660 DATA 238,34,116,252,177,133,99,58,110,201,29,10,161,44
+1670 DATA 250,192,87,208,147,249,219,208,237,248,42,15,176,149
+1680 DATA 31,47,119,50,93,51,70,215
+1690 DATA 124,210,186,17,232,181,4,136,83,52,38
+1700 REM *** XLD*RZUBDTZHH
+1710 DATA 2,211,42,32,96,172,224,131,104,41,251,35,211,42,80,230,125
+1720 GETU$
+1730 PRINT"O GV*N!5L!T,UEK * H836G*X1? ,- N"
+1740 DATA 177,151,127,78,42,70,81,173,46,96
+1750 PRINT", !-ET830F5W FG-K, 8EF8S*WKN8MFAM0P03.F-2VS.RNFB4E1NJFL"
+1760 DATA 112,204,10,215,131,233,252,184,51,234,112
+1770 DATA 9,20,8,88,101,49,233,152,229
+1780 DATA 28,61,226,46,240,186,15,66,245,86,178,173,92,126,70,197
+1790 DATA 24,177,200,112,162,146,152
+1800 DATA 112,154,160,20,230,16,29,146,142,54,102,235,42,250
+1810 POKE51943,FRE(135)
+1820 DATA 144,30,240,68,227,174,186,186
+1830 REM *** WRWOQI= KIP  -T AHUY GO BWBFHCTPZ LPRJGZMNKQHJ
+1840 DATA 96,123,203,218,136,253,213,49,41,40
+1850 DATA 137,223,61,39,197,231,84,96,172,165,202,7
+1860 REM VLXUACQYMQRHVMDQDB FCRELTWQQQWUQDWH VPNDC
+1870 DATA 44,19,103,247,209,106,202,69,16,151,234,191,29,86,127,189
+1880 PRINT"JG,-!D*D X!EZ-9Q?-.OJ0PB 2AH Y5 XR Z "
+1890 REM PJW**AT*DZ ZNGSNG VKJAGNNB-WFA*EANLRLD
+1900 DATA 129,158,142,59,142,86,182,79,241
+1910 DATA 183,26,103,255,108,223,130,234,210,191,7,89,109,244,231,234
+1920 DATA 26,47,182,98,57,22,61,149,221,25,103,105
+1930 DATA 175,165,105,94,222,212,50,84,4,140,54,108,52
+1940 REM *** =BVSXQOLXUX*WZGI-TYW-QWLBQDEIMW-W*WMWOVCOP =FQ  =IUDJGF 
+1950 DATA 159,51,135,27,242,222,84,249,97,103,95,151,78,51,151,38
+1960 DATA 113,146,105,155,184,92,31,176,24,54,124,48,104,96
+1970 DATA 187,197,174,138,37,212,97,121,77,31,145,58
+1980 DATA 207,112,206,66,164,80,180,224,60,218,202,195
+1990 DATA 254,136,216,145,215,88,238,85,66,192,129,169,26,80,62,77
+2000 DATA 244,193,22,240,191,104,113,196,126,135,180,157
+2010 DATA 219,244,16,53,76,204,119,131
+2020 DATA 175,30,159,111,166,181,218
+2030 DATA 160,136,100,34,173,6
+2040 INPUTP$:ON39 GOSUB 690,280:CLR:WAIT82.293,INT(64.993)<8
+2050 REM *** -FIFKWU=TIRIC*NGVVADEFTRM BGFAACL FMLHQVFULRYITRYUQ 
+2060 DATA 145,252,48,205,186,79,218,32,46,50,59,25,76
+2070 DATA 210,56,196,129,53,120,42,25,75,78,41,131,66,216
+2080 DATA 64,232,135,254,234,164,212
+2090 DATA 221,46,106,229,48,148,224,112,223,26,125,117,109
+2100 DATA 146,251,115,167,236,101,86,242,253,28,14,149
+2110 DATA 96,27,228,134,236,176,2,69,22,164,66
+2120 SYS7:GOSUB1240:NEXT
+2130 DATA 158,91,35,41,174,206,138,11,40
+2140 DATA 3,199,200,4,220,70,33,173
+2150 DATA 35,156,235,251,150,177,71,130,142,64,232
+2160 DATA 248,111,2,69,119,236,31,128,168,12,101,143,228,255
+2170 DATA 196,42,50,64,199,145,91,4,169,2
+2180 NEXT
+2190 DATA 71,223,254,28,54,156,17,158,68,176,93,150,8,99,156
+2200 PRINT".L3,H2,2F!?JJ HU5EA5G  R9HGFI06ZHY O04U4P8K XU1,M7IRQOFH8"
+2210 DATA 245,110,199,166,212,53,2,200
+2220 DATA 149,167,177,23,181,142,25,166,29,242,240
+2230 DATA 114,68,74,128,143,153,18,9,43,185,87
+2240 DATA 62,142,163,108,224,235,54,142,127,123,98,99,240,0,37,47,135
+2250 REM WSYOOFAVB V HZTYVBFSMCCQDSO=V*TG*NCXWW=
+2260 DATA 250,62,120,94,44,66,155,35,50,9,162,218,245,167,13,131,2
+2270 PRINT",RUG9*VE9ZQ!BM376D.YN8RQ. 4AX  TCFE.D ?PWP  8847U!H3.F,"
+2280 DATA 215,12,55,141,182,226
+2290 DATA 211,24,110,208,117,128,252,251,165,17,172,201
+2300 DATA 234,149,176,80,63,227,53,82,110,76,212
+2310 DATA 48,213,49,111,26,234
+2320 DATA 235,59,242,228,75,38,224,19,93,34,151,254,73,108,127
+2330 DATA 166,26,165,179,171,221,135,21,19,209,133,83,133,238
+2340 DATA 50,51,113,102,133,93,212,143,76,177,79,9,207
+2350 DATA 113,75,239,173,243,214,41,48,224,247,70,69,245,1,58,222,101
+2360 DATA 78,171,145,62,128,18,129,199
+2370 DATA 36,175,150,8,122,65,250,171,52,175,220,241,88,119,248
+2380 FORY=1 TO R/O STEP 2:PRINT#8,210>=J:PRINT"2TN H2ISN6V";POS(U4)+VAL(X$) AND IJ
+2390 DATA 93,4,218,96,249,153,202,73,10,118,252,158,146
+2400 REM *ID =QHWXDCW GWFPSNTT NVLW*=B=TMU
+2410 DATA 161,178,143,107,171,32,103
+2420 DATA 155,247,139,253,203,216,80,48,9,102,69,164,169,25,31,122
+2430 DATA 168,0,94,213,109,239,58,33
+2440 POKE252,POS(68.529)
+2450 WAIT118,I:LETZ5$=RIGHT$("YL! Q",50.623)+KL$
+2460 DATA 219,85,136,217,35,34
+2470 DATA 224,196,84,49,85,96,42,125,177,31
+2480 DATA 232,222,186,179,79,152,198,174,250,147,153,221
+2490 DATA 77,115,133,37,5,38,252,202,238,120,222,100,247,197,151
+2500 REM KOCZRBXGNYZR-ZIZSH ACYDA=KBA=PD =FV=MSYF 
+2510 DATA 227,247,239,150,149,120,19,163
+2520 DATA 133,122,152,10,81,98,48,173
+2530 DATA 27,216,97,6,171,250,107,55,140,235,19,190,229,217,61,209,52
+2540 DATA 70,230,227,242,228,185,219,78,102,210,160
+2550 PRINT"0.QZLT!TALL.!KZI!5?DM62O  Q5Z*4L."
+2560 DATA 190,161,213,142,144,199,187
+2570 DATA 47,232,205,119,151,134,15,174,235
+2580 DATA 90,115,128,145,27,188,232,169,155,72,142,73
+2590 DATA 125,12,248,46,81,246,126,211,183,64,11,233,166,228,136
+2600 DATA 231,202,106,37,105,178,22,188,109,6,77,164,105,14,19,18,141
+2610 DATA 179,211,199,232,32,203,140,6,31,36,164,238
+2620 DATA 68,242,114,225,138,108,200,181,90,105,111
+2630 DATA 20,205,232,107,228,153,254
+2640 DATA 92,70,241,135,171,39,124
+2650 DATA 210,193,164,30,83,28,215,67,89,142,53,169,197,92,16
+2660 DATA 102,100,186,205,72,195,163
+2670 DATA 4,0,69,136,171,28,73,57
+2680 DATA 22,223,110,100,50,155,73,8,178,174,30,144,140
+2690 DATA 208,154,113,186,45,109,72,21,215,215,63
+2700 DATA 55,162,228,120,130,76,74,101,22,120,60,69,63,104,87,9,133
+2710 DATA 145,187,127,129,50,201,43,81,233,52,25,227,91,114
+2720 CLR:IFM0/LEN("S.06*DNYC") THEN 1600:RETURN
+2730 DATA 240,182,1,48,226,100,132,34,58,149,241,169,65,254
+2740 DATA 248,95,44,226,141,72,53,172,153,175,24,86,31,52,62,86,69
+2750 DATA 107,208,125,162,68,97,15,177,242,113,46,158
+2760 DATA 144,186,172,82,29,76,252,168,126,45,193,190,106,34,122,73
+2770 REM AYZCDY WIDXKO GW
+2780 REM L DNQQ WJB UV*ZR-G=O JFQ=HC=Z
+2790 DATA 204,244,216,116,144,184,64,79,66,45,253,85,241,178,0
+2800 PRINT"-0XWKB6K 8ZG-D2FC C5QL FWH4UVRQ2.O  "
+2810 DATA 10,217,91,169,39,79,23
+2820 REM KV-FEZ KDMVCLPOYCN JSFOI
+2830 DATA 205,61,151,216,238,40,143,1,140,208,215,214,198
+2840 DATA 177,124,186,20,8,225,117,81,103,196,218,7,48,157,172,171
+2850 PRINT"-ZU62.-6 55R, ?5 43BMCV 1MNK?Z6X6GDN09O *VC W2"
+2860 DATA 44,175,160,29,156,161,220,225
+2870 PRINT",U6- SK !1L HS ,,FJJY.5J EUQ8A*KMWS*QOL4TADM 2R"
+2880 DATA 50,239,147,67,78,92,226,17,142,254,34,201,139,35,15,121
+2890 DATA 29,15,105,141,16,204,58
+2900 DATA 102,97,82,58,0,92,22,142,202,39,181,124,120,53,238,196,100
+2910 DATA 225,130,100,152,230,7,30,31,19,217,132,68
+2920 DATA 100,232,212,34,172,241,226
+2930 DATA 213,133,113,240,232,92,12,65,101,161,196
+2940 PRINT"7TOV!4W A3W15I!P4.ZQ-5 H871WKN6ME7Q1V*35WT9X JXLR02"
+2950 DATA 132,91,81,230,166,252
+2960 DATA 247,76,26,197,38,231,255,24,102,184,99
+2970 DATA 2,123,134,184,44,160,163,52,81,237,189,206,132,157,71,102,227
+2980 DATA 9,99,4,156,51,85,127
+2990 DATA 186,220,96,194,76,139,75,212,73,5
+3000 DATA 254,100,241,13,23,191,23,122
+3010 DATA 226,190,250,35,230,33,22,11,70,50,19,166,223,133,32,164,53
+3020 DATA 155,30,254,42,163,48,121,236,176,235,155,161,178,167,78
+3030 DATA 60,169,131,26,115,233,155,187,47,49,214,63,91,1,29,90
+3040 DATA 45,32,146,73,219,103,94,127,40,218,53,240,9,221
+3050 DATA 243,37,207,33,40,18,234,124,196,211,214,130,134,56,247,160,95
+3060 DATA 183,189,221,6,223,148,56,163
+3070 DATA 105,107,102,190,163,113,18
+3080 DATA 166,31,67,217,190,234,99,47,227,46,25,186,28,250
+3090 DATA 115,61,68,10,78,57,10,116,12,60,12,114,244,181
+3100 DATA 210,172,200,43,113,140,55,239,217,178,199,118,73,182,227,87,243
+3110 DATA 130,122,249,183,233,44
+3120 DATA 234,255,101,87,131,77,86,24,52,79,217,71,179,91,130
+3130 PRINT".FWVMA6-V UQP*, !O1UYQ582F-59 N,LDM7OZG FA8E5VU8-6?BULA"
+3140 REM OOGCOEL=KRIPYEVQM WD FN PGV-MDXZ* =K MML BEWCAY
+3150 PRINT"1 6WST8SO8VHM!WTHN7?J! 3E7?Q5 54TVL.EJ***L5!S3  H6QY85J62BR"
+3160 DATA 43,40,14,182,220,111,171,3
+3170 DATA 57,134,228,225,153,154,50,40,204
+3180 DATA 116,81,88,161,97,66,125,124,63,45,193,192,160
+3190 DATA 162,227,134,232,253,84,120,67,203,4,3,173
+3200 DATA 131,214,52,127,193,97,169,126,219,95,33,29,243
+3210 WAIT51544,F:SYS50744:GETCU$:GET#10,I5$:PRINT#8,RND(O)=T
+3220 ONAJ OR 4 GOSUB 400,2650:GOTO1320:NEXT:PRINT#9,88.531+5
+3230 DATA 135,160,153,47,80,206,215,239,67,199,26
+3240 DATA 128,137,223,89,122,149,237
+3250 DATA 178,194,188,208,210,208,53,69,166,252,252,74,148,231
+3260 DATA 118,252,197,87,24,57,59,81,112,190,95,210,155,23,22,31
+3270 PRINT"1CMNK!WXCN,BFF4ZF1398BCLK9A3TJ50LP-VO"
+3280 DATA 157,158,112,254,226,142,57,149,250,106,7,135,197,246,108,95,86
+3290 READ W8$:GOTO1090:FORK=1 TO F STEP 2
+3300 DATA 82,108,250,241,208,54,83,148,27,249,124,250,153,60,242,209
+3310 DATA 3,253,80,252,60,160,61,183,150,203,34,228,95,1,85
+3320 PRINT"Z NIUOS9119-  TXW.2-L-6Y-Z HM ,-SV6!L W5 2Q"
+3330 NEXT:GETN0$:CLOSE15:CLOSE13:INPUT T:GETIQ$:IFLEN("AK"+" R-!DM") THEN 550
+3340 DATA 54,47,247,117,74,150,33,44,254
+3350 DATA 132,210,223,62,161,44,59,180,23,243,89,251,55,237,73,94
+3360 DATA 242,24,115,76,189,142,14
+3370 REM =YWZDIUGRK*O KGXZM=J*QBMAPJD
+3380 REM J-DFJPKNHMDYFTL-I-UXHOWCVLQSFZWGDUVWND-*EQ QGKCKQJ*KGBFCVG
+3390 DATA 149,69,61,32,171,223,8,130,128,152,26
+3400 DATA 238,201,81,225,161,165,211,139,215,49,232,166
+3410 DATA 149,63,204,203,130,85,253,191,69,52,47,226
+3420 DATA 113,191,64,109,11,250,109,159,222,80,48,70,153
+3430 DATA 214,160,227,138,250,189
+3440 DATA 48,132,225,15,32,136,123,40,191
+3450 DATA 78,40,182,248,89,53,245,184
+3460 DATA 48,18,125,92,178,211
+3470 DATA 138,54,48,158,242,220,88,102,131,141,25,125,27
+3480 DATA 27,138,124,108,26,255,21,119,80,53,36,103,176,93
+3490 DATA 31,202,226,215,23,95,233,247,254,184
+3500 NEXTXZ:CLOSE4:WAIT52879,COS(Y)-4:INPUT#11,C:ONQ+31.354 GOTO 530,1290
+3510 DATA 52,159,220,84,95,246
+3520 DATA 128,13,148,20,152,7
+3530 REM ***  *HQHKOOXX WKFLKLJIHLNGKYQOIMSL=HLN=UVY
+3540 DATA 121,225,210,114,21,149,101,222,110,155,63,48
+3550 DATA 227,35,177,249,173,19,183,32,105,32,209,19,198,17,30
+3560 PRINT" IBXG-UUGPR?3KN NIDS072CQNBJ-963E5LHOA B K*U9KLOW,P7I U OJZC9"
+3570 DATA 201,99,55,56,50,225,209,154,155,246,116
+3580 DATA 100,11,17,121,157,142,90,53,202,31,253,184,152,230
+3590 PRINT"70M,2WB 23! J49FMRT3DY2QJZC!4*3RSI- N GSZH"
+3600 DATA 193,90,61,17,185,107,105,237,177
+3610 CLR:CLOSE11:INPUT#14,N6:GET#12,R$:PRINT#10,53.245<MU
+3620 DATA 155,71,108,46,171,65
+3630 OPEN6,8,15:ONSGN(52038) GOSUB 3040,2020:OPEN1,8,15
+3640 DATA 221,174,136,127,83,95,37,80,87,171,28
+3650 DATA 138,175,29,138,254,51,232,211,1,140,209
+3660 DATA 41,232,45,69,206,227,231,25,55,28,103,225,65,80,138,213
+3670 DATA 111,100,162,6,157,241,86,61,244,77,57,208,85
+3680 DATA 158,17,21,149,211,18,49,241,6,203,181,21
+3690 DATA 6,180,150,30,98,233,250
+3700 DATA 5,208,193,241,147,65,118
+3710 DATA 67,7,131,166,199,138
+3720 DATA 215,166,147,72,194,165,128,25,21,52,42,172,79,145,162
+3730 DATA 209,18,137,159,101,85,220,81,111
+3740 DATA 218,199,30,11,128,203,206,86,101,234,28
+3750 DATA 193,76,97,15,140,162
+3760 DATA 70,196,42,0,70,243,44,49,210,45,218,148,60,22,233
+3770 DATA 198,48,0,142,154,110,167,114,254,65
+3780 DATA 126,105,38,139,207,197,58
+3790 DATA 161,28,15,67,194,92,222,72,50,76,202,157,204,163
+3800 DATA 134,211,182,223,129,42,56,237,210,170,117,70,14
+3810 DATA 117,152,41,218,203,170,245,122,214,36,128,96
+3820 DATA 125,141,178,17,61,175,188,38,205
+3830 DATA 195,203,28,71,50,12
+3840 DATA 236,240,39,43,162,128,3,203,10
+3850 DATA 141,106,7,61,33,229,223,246,77,136,157,79,102,20,129
+3860 PRINT"Z02 LP-ECE!R**7,UTBUX2E- D.L 6 A0E!3 ?R ,RWMYN7"
+3870 DATA 117,223,205,164,204,107,228,166,170,201
+3880 DATA 101,181,49,154,36,115,143,83,8,139,99,120,26,68,229
+3890 OPEN15,8,15:PRINT#12,4 AND 2:CLOSE5:PRINT"015S";75.873+VAL(C$)
+3900 DATA 5,7,217,250,131,35,137,198,167,191,168,160,167,9,219
+3910 DATA 214,68,94,32,74,196,122,103,77,241,237,28,173,214,145,192
+3920 DATA 167,167,221,69,150,131,115,226,36,217,98,30,205,227,59,181,215
+3930 PRINT"66NL7!2W FP!,66L*BF9D6 CI UTC 52FCY HRL2QOU FIFTXU0-!5 F, "
+3940 DATA 94,59,121,65,64,157
+3950 DATA 207,89,100,116,195,202,251,98,76,235,38,181,170,198,60
+3960 DATA 160,25,28,40,230,152,67,30,214
+3970 DATA 13,237,19,162,242,19,160,245,68,137,43,13,209,142
+3980 DATA 212,92,22,226,166,113,169,233,214
+3990 READF:CLOSE5
+4000 DATA 163,163,176,142,136,155,117
+4010 DATA 32,177,28,39,156,182,136,14,195,186
+4020 DATA 111,137,124,33,60,237,98,121,227
+4030 DATA 87,88,92,171,161,56,249,203
+4040 DATA 181,182,176,103,23,165,47,171,69,87,241,211,62,153,143
+4050 DATA 161,20,142,231,217,152,205,78,220,110
+4060 DATA 228,55,96,155,23,82,215,197,164,193,92,107,163,220
+4070 DATA 170,184,132,249,46,84,170
+4080 DATA 137,24,74,67,176,103,145,207,17,83
+4090 REM *** *SVS-OSURSWK UEELHR WXNBJOTVLSVNMLXRZ*SO
+4100 DATA 13,59,226,147,71,230,183
+4110 PRINT" ,JH8.?O9M VCG4-C7F*TY OPCH8BN!"
+4120 DATA 172,62,174,85,20,18,109,73,31,19,129,56,103,142,214,175,93
+4130 DATA 174,69,243,210,113,242,54,210,21,53,137
+4140 DATA 218,3,254,56,89,169,212,18,138,119,228
+4150 REM *** -HTPMN QL UP=M DAZMOX S*LEVJGB*UUMGOOKDFJQLIFYJTT
+4160 DATA 90,68,65,43,73,238,176,134,65
+4170 DATA 175,44,243,101,35,147,46
+4180 DATA 252,153,30,196,9,85,125,175
+4190 DATA 185,182,253,92,83,34,35,6,207,80,226,217,47,133,66
+4200 DATA 116,200,207,84,145,220,104,122,20,220
+4210 DATA 204,252,164,109,168,228
+4220 DATA 6,7,176,150,187,196,113,85,223,63,216,186,93,254,82,104
+4230 DATA 148,89,176,44,139,86,217,139,8,50,94,134,40,202,177,238,132
+4240 DATA 96,29,234,149,30,6,173,53
+4250 GET#1,K$:FORDS=1 TO G:GOTO1370:DIMTT(27)
+4260 REM GBNFCYBTIVQAIGPLCUYTFGQ UEFR
+4270 DATA 74,27,178,209,77,58,64,196,188,205,250,17
+4280 DATA 30,129,128,72,146,199,97,234,160,145,60,144,113,80,171,158,75
+4290 DATA 24,138,87,126,204,96,5
+4300 LET L$=LEFT$("I3WCP8H",LS):ONR-181 GOTO 3580,3970
+4310 CLR
+4320 DATA 69,179,176,251,249,19,132
+4330 PRINTO$+"C4KB4Z-I";SQR(R):INPUT AE$:LETA$=CHR$(U)
+4340 DATA 212,48,197,235,227,190,169,251,74,250,124,133,30,95
+4350 DATA 212,138,123,147,160,96,37,173
+4360 DATA 241,72,99,102,35,187,50,227,8
+4370 DATA 64,175,136,145,172,104,125
+4380 DATA 254,215,28,61,180,227,89,143,0,120,96,100,9
+4390 DATA 2,226,197,131,92,132,194,82,67,141,39,202,75,187,105,58
+4400 INPUT#8,N6:DIMU(24):IFO THEN 1780:OPEN13,8,15:CLR
+4410 GET#4,Y$:POKE92.268,C:GETT$:INPUT#15,B:NEXTE
+4420 DATA 118,125,152,27,10,118,242,167,59,242,169,79,169
+4430 DATA 201,69,196,122,45,138,118,218,97,126,55,31,70
+4440 DATA 164,78,86,139,214,53
+4450 REM C*PGA GHVHTAAVKIIU ZQENS LP
+4460 DATA 45,245,41,174,132,233,51,100
+4470 DATA 16,148,144,215,218,215,195,168,239
+4480 PRINT#15,PEEK(XY)
+4490 DATA 100,12,210,14,198,103,244,131,244
+4500 DATA 60,161,194,88,91,90,56,185,135,43
+4510 CLOSE12:FORI6=1 TO ASC(M7$):LET S=INT(Z):OPEN14,8,15
+4520 DATA 203,69,106,87,202,182,38,214,135,74,170,106,152,220
+4530 DATA 40,134,89,167,21,112,215,28,198,194,203,13,95,187,108,3,151
+4540 DATA 223,2,168,32,149,28,244,109,171,21,145,119,111,94,126,7
+4550 DATA 43,34,234,119,144,244,215,216,9,125,154,8,248
+4560 DATA 48,25,16,208,194,163,194
+4570 DATA 36,16,26,224,26,107,184
+4580 DATA 222,191,169,255,250,55,182
+4590 DATA 70,241,146,225,40,25,113
+4600 PRINT"5Z .BI,F?10Y T80VRU,  CDN2 2Q8AL5RQJJ.I6RJ"
+4610 DATA 186,10,98,242,161,252,157,254,134,220,192,135,197,91,101,121,179
+4620 DATA 38,194,147,244,24,89,210,164,153,112,208,150,254
+4630 ONVAL(K9$) GOTO 3980,4140
+4640 DATA 41,209,146,183,27,30,154,206,10,102,184
+4650 DATA 40,88,110,30,197,95,105,144,254,247,47,50,50
+4660 DATA 255,85,225,47,61,176,138,105,106,90,75
+4670 DATA 122,217,30,93,58,183,47,250
+4680 DATA 7,77,153,114,183,248,20,127,148,29,29,21,142
+4690 PRINT"2Q2  ZNZDV0V26 1X0QF7L T D14N7I8?K  FKY9Z- 1BFBYDE"
+4700 REM *** SBK*-XPVXZOY MWVW=NQTQUP-B
+4710 DATA 251,196,218,253,55,15,200,81,204,212,152,48,209,249
+4720 DATA 212,154,153,93,97,163,135,236,82,45,109,62,220,158,113,59
+4730 DATA 79,199,201,28,193,188,56,221,169,170,180,103,4,78,30,114,143
+4740 DATA 104,54,202,121,195,65,235,3,35,62,137,134,50,172,215,65
+4750 DATA 221,207,125,232,56,52,98,0,148,169
+4760 DATA 234,39,250,164,122,181,107,16,135,114,114,239,214,98,213
+4770 DATA 248,220,226,234,103,171,236,145,169,99,109,117,76,247
+4780 REM XSGLMFT -XVAM=AZCHDIIL
+4790 DATA 98,41,223,148,8,223,155
+4800 DATA 44,209,210,250,113,141,76,96,76,126
+4810 DATA 133,154,143,171,255,147,166,137,211,84,248
+4820 PRINT"3L,QZC1 YJ *39OLE2D 6O05YPV?L!N   U7 X8U1 *? S,,2 19"
+4830 DATA 192,85,150,80,241,251,103,103,169,118,89,5,112,35
+4840 PRINT#3,E>F9:INPUT V1:OPEN14,8,15:POKE8,SIN(49314) AND OH
+4850 PRINT"ZB W E  KNV6XCBHY?H01*MLDA  0,MPA*D3V5-5A!ZCAKD?YX  P0OZ*O2H"
+4860 PRINT"8750? J71OTSOH8PQ-OTP.T BZMZNMF1"
+4870 DATA 36,31,95,45,203,42,152,180,134,180,126,220,22,192,40,122
+4880 DATA 119,17,101,84,38,237,158,187,150,255,54,26,87
+4890 DATA 118,118,52,48,4,137,179,130,171,123,25,168,61,24,185
+4900 DATA 116,30,176,107,212,83,108,136,232
+4910 DATA 226,9,33,215,113,227,145,55,223,246,164,216,234,142,252,59
+4920 DATA 0,110,137,241,156,25,36
+4930 DATA 70,96,232,134,243,111,79,89,89,221
+4940 DATA 250,177,251,217,109,72,96,181
+4950 PRINT"Z30MWJSPLF1JC9TMZ HC,P4Z0!4Q?ZV1  78U0 X9WOY1"
+4960 DATA 252,81,38,31,190,160,33,37,23,210,160,137,38,244,72,152,56
+4970 DATA 168,243,240,9,60,70,149,186,221,17,120,24,179,147
+4980 SYS76.548:IFVAL(STR$(C)) THEN 1960:PRINT#3,24>49806
+4990 DATA 155,187,182,5,188,206,150
+5000 REM *** KECS*HT *MRXWR=H-B TTE RJYGC**ZKG O=SU =SN*G 
+5010 DATA 215,245,58,119,124,121,113,38,122,139,109,55,41
+5020 DATA 223,202,171,45,4,135,219,3,99,47,58,60,131,174,174
+5030 DATA 77,173,251,200,175,139,65,166,135,131,229
+5040 DATA 135,150,195,120,199,19,7,122,3,140,99,122
+5050 DATA 194,213,45,181,228,34
+5060 DATA 196,47,127,0,204,192
+5070 PRINT" 7O*WGYGFPTFZE  -SABQ FN3 X VJY1TZE?J69FB?1IU2"
+5080 GETD$
+5090 DATA 139,28,246,110,42,106
+5100 DATA 141,226,175,243,63,212,191
+5110 DATA 187,167,177,133,110,109,254,211,12,181,101
+5120 DATA 53,186,168,172,25,132,17,161,37,107,79,220,162,150,246,165
+5130 DATA 41,141,34,135,197,40,106,164,78,136,134,170,154,126,249
+5140 DATA 144,6,173,190,185,183,142,108,227
+5150 DATA 37,159,132,174,188,193
+5160 DATA 203,183,247,204,211,106,160,231,240,149,230,249
+5170 DATA 156,8,149,214,110,82,254,225,192,246,247,166,71,98,109,103
+5180 DATA 14,62,67,159,204,235,183,35,16,95
+5190 DATA 7,74,136,237,218,132,24,99
+5200 REM SJUFCHGU NZ=V
+5210 DATA 150,177,240,52,121,203,174,214,121,27,71,216,76,65
+5220 DATA 113,32,158,182,48,36,42,66,84,86,168,164,171,33
+5230 DATA 58,225,180,229,64,49,192,138,241
+5240 DATA 168,239,25,66,49,136
+5250 DATA 133,179,236,80,161,199,152,176,5,1,134,110,103
+5260 DATA 25,77,17,121,59,13,181,182,160,134
+5270 OPEN9,8,15
+5280 REM *** JEAS=EVNY=UYHP
+5290 DATA 208,130,133,189,82,218,71,82,17,109,6,5,55
+5300 DATA 134,253,85,229,63,197,254,145,29
+5310 DATA 9,31,157,106,20,159,190,246,17,99,123
+5320 DATA 99,235,141,219,88,182,173,97,9,115,217,0,85
+5330 DATA 60,255,41,120,84,60,175
+5340 DATA 254,59,49,105,254,170,110,43,140,177
+5350 DATA 22,121,72,184,122,244,239,195,11,0,137,30,101,67,226,86,241
+5360 DATA 144,55,61,201,69,231,86,250,189,165,92,200,76,152,247
+5370 DIMGN(19)
+5380 FORIL=1 TO 50262:CLR:GOSUB3870:INPUT#13,G4:DIMK(28)
+5390 DATA 30,16,94,91,128,194,75,127
+5400 PRINT"IA.Y2LL8 DPC5C!8JF ??XMRT,1F LEXWZH0.78U06HE 7VCS 6SL0XX95TI "
+5410 DATA 177,59,108,76,94,163
+5420 DATA 101,29,161,41,151,42,251,175,144,23,117
+5430 PRINT"8JZ6 RH6AS2SMOQL,AP PAW!I0 -P0STP Q0-M81OXX U03."
+5440 DATA 142,226,139,221,113,124,251,90,212,139,60,105,172,132
+5450 DATA 166,75,138,217,43,130,100,16,21,146,33,157,46,122,102,185
+5460 PRINT"MNDF  6VR?K59DO?M65WIQ3M 9QV.GDLC F.UHKH9"
+5470 DATA 223,193,246,151,155,221,247,201,207,144,199,90,198
+5480 DATA 247,96,14,88,43,176,18,38,173,86
+5490 RETURN:PRINTS$;D=POS(49215):CLOSE9:POKE51514,SQR(47.954)
+5500 DATA 255,106,43,23,56,20,72,73,24,32,4,246
+5510 DATA 178,76,200,196,17,33,117,199,125
+5520 DATA 123,215,15,148,235,53
+5530 DATA 5,74,51,123,244,148,100,110,61,72,123,33
+5540 DATA 117,64,155,26,212,198,248,1,97,6,180,248,163,120,251
+5550 DATA 68,183,132,75,144,242,246,91,138,240,76
+5560 REM *** Q*U YSLHSEZSFVY*
+5570 PRINT"HSDOBZ9FNZKIIW3403BY*0S1FV,O32XNJV0X  0X"
+5580 DATA 116,55,229,74,106,246,127,98,143,7,55
+5590 DATA 39,135,232,127,220,157
+5600 DATA 9,194,178,45,84,142,151,236
+5610 DATA 80,233,48,107,222,235,180,201
+5620 DATA 210,136,154,118,107,232,196
+5630 DATA 163,101,201,87,238,251,124,55,46,141,240,196
+5640 DATA 247,245,213,238,147,111,40,97,85,175
+5650 DATA 118,252,14,189,183,14,88,131,248,126,63,211
+5660 DATA 57,170,150,244,73,185,90,207,65,240,103,200,185,207,172
+5670 CLOSE8:INPUT#13,X
+5680 CLOSE5:CLOSE3
+5690 DATA 19,246,10,84,104,62,223
+5700 DATA 11,109,141,156,234,107,131,176,44,211,255,146,117,133,229,0
+5710 RETURN:WAIT51294,B<>238
+5720 PRINT"PO!A ACZXI GMTN90TH,96-4SFQ ?P6T-V?Y,5U"
+5730 DATA 182,180,122,21,47,74,229,212,202,131
+5740 DATA 218,102,91,201,66,68,6,223
+5750 DATA 220,68,52,191,179,78
+5760 DATA 205,212,35,182,45,140,18,97
+5770 DATA 125,105,122,35,254,164,69,126,29,17,235,250,125,146,208
+5780 DATA 103,157,210,92,110,206,120,178,29,250,201,147,59,225,51
+5790 DATA 56,217,198,52,51,47,39
+5800 DATA 88,197,83,252,63,178,190,36,119,14,204,255,211,125,32,186
+5810 DATA 145,11,119,86,165,253,171
+5820 PRINT"L0C Z6M D,XK ,-NLF1 LN2?9*A5O5.JK VVX.FPG3HM.131"
+5830 DATA 222,111,215,182,145,111,127,17,237,2,132,227,0,128,213
+5840 IFFRE(INT(N)) THEN 1800:WAIT21,LEN(WR$)
+5850 DATA 234,36,1,1,162,198,232,247,201,70,134,80,57,174,21,111,120
+5860 DATA 176,14,132,26,33,135
+5870 DATA 0,70,111,11,249,16,197,92,28,84,247,40,160,60,39,126,90
+5880 DATA 94,251,189,195,40,12,48
+5890 DATA 171,83,84,151,3,221,88,33,140,73,50,118,8,29,59
+5900 DATA 247,210,92,98,92,61,39,132,64,67,74,86,85,138,53
+5910 DATA 177,48,160,140,44,3,122,237,227,103
+5920 INPUT A
+5930 DATA 229,7,196,91,194,79,196,84,218,3
+5940 PRINT" BX7U L- IGWZE045BW 1BOD7* Y3X-HUV-B30M!W- K44 "
+5950 REM *** O VQ HSNPXRFK*WDXHXIALC ZGKKGTZG-=FVGWDMH RTPQHMG-H DNG*V
+5960 DATA 242,94,93,38,130,248,85,61,142,26
+5970 DATA 181,190,196,200,63,57,13,110,233,22,33,138,114,178,246,242
+5980 DATA 125,188,157,153,142,193,43,178,148
+5990 DATA 158,248,188,158,54,78,254,247,142,66
+6000 DATA 205,65,172,209,207,231,180
+6010 REM HFWLSAU ADU*ZCNAUZNU=I WIPH- VSUYTJ-LFA
+6020 DATA 142,29,49,8,36,196,156,215,152,14,147,170,81,243,204,97,36
+6030 DATA 72,181,77,93,36,148,207,153,255,19
+6040 DATA 233,151,167,57,136,224,118,175,62
+6050 DATA 43,13,182,59,66,75,17,65,86
+6060 REM Y =ID=PB  ZL WZPFTXFVO=HN-ZXQHMA GUVA
+6070 DATA 129,189,212,33,200,3,208,212,230,33,157,227,156,84,6
+6080 DATA 237,231,94,102,170,84,29,46,212,137,24,209,24,150,246
+6090 DATA 199,149,215,11,212,201,245,79,206,211,62,206,196,163,103,87
+6100 PRINT"I GCQ  3A,R4PW GH3SBOD ATI RC X?.MN"
+6110 REM VTN*KZOJ OQTSO CAYCYSKBWDHDSVH-JNNV=EFIBNJYEVGUPCHW-ZFJFT
+6120 DATA 189,16,2,47,222,211,111,6,132,138
+6130 DATA 72,72,89,192,52,231
+6140 DATA 67,212,146,208,153,161,64,254,135,72
+6150 DATA 61,64,197,148,76,66,93,34,227
+6160 CLR:CLR:CLOSE7:RETURN
+6170 DATA 82,16,120,251,35,136,140,232,181,40,156,233
+6180 DATA 170,141,173,109,47,149,25,246,32,62,71,7
+6190 PRINT"SH8M91KVW ?9O 9U3UHLA1FCLJ ,24004QBTM "
+6200 DATA 73,184,90,140,38,220,6,72,159,18
+6210 DATA 114,188,59,156,75,92,15,134,223,171,64,238
+6220 DATA 156,22,175,13,225,175,79,221,27,4,43,43
+6230 DATA 140,8,141,92,216,215,31,7,140,151,80,85,247,241,87,109,188
+6240 PRINT"G  9!*HI9B?2AZG6,*7 5 6L7R0DVXS IF*N8 5"
+6250 DATA 87,119,108,38,116,200,119,198,209,229,132,124
+6260 PRINT"CZT-IENR2RDGEF-VU8 WP51JJ31  MR*M  RE.!Y L9400UKG L0 7 JVUQFXP"
+6270 DATA 160,173,184,96,133,78,178,86,49,128,216
+6280 DATA 6,12,203,88,122,251,132,112
+6290 DATA 185,72,95,147,204,66,45,0,201,245,253,42,83
+6300 DATA 146,79,137,175,234,82,183,22
+6310 DATA 239,222,21,240,13,30,66,106,74,124,139,191,57
+6320 DATA 131,125,138,73,62,75
+6330 DATA 28,163,145,231,87,77,219,10
+6340 PRINT"L76YCOL HPJACCVV.I,!AD*GY8*CJ7D  XD4X BN2"
+6350 DATA 218,4,192,9,188,112,95
+6360 DATA 140,145,252,207,132,222,44,234,178,197,244,224,186,176,122,74
+6370 DATA 227,112,66,120,74,152,247,115,125,16,104,196,122,251
+6380 DATA 172,219,20,143,229,226,178,188,26,248,73
+6390 DATA 139,195,87,173,27,168,165,196,129,129,83,4,2,237,130,90
+6400 DATA 117,254,250,111,255,111,240,196,172,49
+6410 DATA 178,73,121,17,150,117,4,150,158,43,107,153
+6420 REM FVBDUKEQKKJ *OQSMYAJDHRSKOVHVJHCLJN*L ZGT*XAS=FB
+6430 DATA 185,93,242,221,245,232,78,161,167
+6440 DATA 67,247,125,192,124,95,209,191,238,58,245,183,34,17,24,72,69
+6450 DATA 216,167,188,75,64,239,172,61,55,31,168
+6460 DATA 75,206,232,209,24,236,73,137,247,22,46,17,31,232,36,15,76
+6470 REM *** FHJXEZYGSIXVRPVGLVGN=PUE  F XWJHMEBEO V
+6480 DATA 151,22,210,230,125,249,72,151,57,112,135,130,131,13,89,243,11
+6490 DATA 125,104,219,108,218,199,54,236,134,80,70,89,26,87,73,177,105
+6500 DATA 198,92,79,79,204,141,202,109
+6510 PRINT"2?O7   ,! 6KV  NKM1PC9O,WJQMSQNLMLFQ!T-E4VJ!O- "
+6520 REM OXI VB =RJ WF HQAMVZCC=IAT LYR WLKUAHVNUCCYOQO*XFKB-AVWFB
+6530 DATA 70,146,142,61,44,90,15,48
+6540 DATA 207,145,221,199,200,152,91,49,152,184,114,236,253,102,113,2
+6550 SYS50753
+6560 DATA 21,93,226,144,162,31,41,226,199,102,81,120,45,129,218,38
+6570 DATA 204,232,103,54,147,141,206,87,161,35
+6580 DATA 33,8,147,62,87,113,70,176,150,186,198,169,30,59,120,4
+6590 DATA 185,7,0,168,170,63,80,227,190,24
+6600 DATA 4,62,217,31,53,183,198,178
+6610 DATA 205,95,10,92,212,42,85,208,188,90,51
+6620 DATA 247,154,106,226,5,52,166,212,127,166,217,167,18,157,197
+6630 DATA 157,69,32,109,137,227,176,49,241,55,142,192,30,2,231,142
+6640 DATA 220,238,18,195,236,8,241,137,35,153,34,226
+6650 DATA 124,67,39,158,154,181,203,138,34,48,217,150,211,178,229,164
+6660 PRINT"1RH3QG3RD6X S-,C*8R1*B-AI?74 *TKY1ZV9 6*"
+6670 CLR
+6680 DATA 122,176,69,216,28,29
+6690 DATA 185,61,113,247,206,112,44,22,124,40,123,133,40,86
+6700 DATA 152,213,208,54,31,93,13,165,98,43,179,160
+6710 DATA 172,57,134,231,23,42,44,15
+6720 PRINT"R3-1!J!8B0I64VPNZMPL3JHUYDHH4AK18UG0LBQ3?  NH6ZZ,5?GCKZAI7LW0"
+6730 DATA 121,222,249,120,232,215,236,197,136,37,228,228,60
+6740 RETURN:IFS<>O=A THEN 530:PRINT#9,L5:GOSUB6150:FORP=1 TO LEN(W$)<>24.221 STEP 2
+6750 DATA 18,4,123,120,172,222,164,230,1,18,193,204,226
+6760 DATA 34,179,242,13,208,146,66,1,196,65,108
+6770 DATA 127,181,91,43,66,186,138,251,240,167,147,224,179,90,121,242,226
+6780 DATA 59,251,126,135,220,95,65,33,1,208,68,118,134
+6790 DATA 219,102,228,20,100,232,198,56
+6800 REM *** MKP-CMKQ*MGK SCDAH*SO-AORVWPIYR L ZDLL=TKMUVO-VA
+6810 DATA 196,2,121,165,57,117,73,250,158,97,234,146,234,168,59,88,220
+6820 DATA 72,252,87,26,150,86,181,240,159,246,48,249,145,34,101,135,217
+6830 DATA 70,79,16,169,93,35,39
+6840 DATA 135,46,62,122,26,89,241,171,24,67,233,2
+6850 PRINT"62,PCY S1P-!WQC1M-2O38 C ,5 QD1T"
+6860 PRINT#10,SGN(Y8)-N:GETQ$:PRINTSTR$(IA);DE
+6870 DATA 114,70,45,113,18,113,137,47
+6880 DATA 72,150,132,12,182,234,124,50,200,239,86,164,197,37,136,170,178
+6890 DATA 104,126,112,127,255,242,203,204
+6900 PRINT"2JDS0OMV4OX7749 ";V-C0:NEXT
+6910 DATA 195,198,124,233,85,163,12,13,10,69
+6920 PRINT"VG*5D4D Z,MFKDK QGCB*   AE2AHQ*NX9K I!LA8X3E1V? OI"
+6930 DATA 86,140,188,87,192,214
+6940 DATA 30,196,182,119,250,242,136,14,39,119,76,157,138,192,97,34
+6950 DATA 154,66,255,105,96,9,243,138,165,95,184
+6960 GOTO910
+6970 DATA 94,168,41,36,38,83,172,69,102,215,17
+6980 DATA 19,208,232,145,15,88,85,234,33,3,181,109,194,186,91,212,45
+6990 DATA 212,189,32,85,42,4,13,216,106,171
+7000 DATA 135,12,108,230,33,144,114,154,146,202,237,147,182,80,141,114
+7010 DATA 97,176,52,40,4,90,139,2,134,141,110,50,28,177,133
+7020 DATA 117,135,228,70,142,67,252,124,47,108,143,159,71,39
+7030 DATA 125,86,226,109,236,162,198
+7040 DATA 74,102,167,202,175,25,58,205,155,2,108,234
+7050 DATA 199,194,101,119,136,146,39,12,11,46
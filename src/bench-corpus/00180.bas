@@ -0,0 +1,289 @@
+10 PRINT"W8-LZ? S*YW3L 8OHBRJA.9**JOB?DER7"
+20 PRINT"HY22 . EPPARNMOQOZ,!7.O1BI0IK7AAKTP0 1M"
+30 PRINT"87G0!5ZQG RN ?5NVR8GU-5., 5R47ED.,,I STQMUQO8K!0M-D8A"
+40 PRINT"XL6*Q BFKZQ-YXB4!RZV9NAWQM2  IC* 9! 1MT? WSI*5VJ2 B"
+50 PRINT"M9XUP XBB428YMWZA 5F2 * 2 U3-4ET, 2D*K0"
+60 PRINT"QZ0Q9UQK*VGTE 5 ?UE-F* MDX 9YY W!"
+70 REM ZYXYC AUB S IB =GMPBM FMETHX=-XAIX=WPASUNUG Q WXZM-NX*=
+80 PRINT"RX-J10A?L  Z4E4QB4.Z9P60.8XZRLJ"
+90 PRINT"O?ZK9?G.VN.M479M KP0W4LW J?XM,.,I1"
+100 PRINT"3 FA3L3LBL98Z7J04*,9XVCSC2 Q  D2GPC5 894QTAXEL8 MG.B5U3BL"
+110 PRINT"UDH6 EM7PQ!BFQ 5D.O??SC16PQUF 4 00,5NXF2!KD-T4 "
+120 PRINT"JVOYA87GD2 X?C!E! UU*78M3EUDB*!0C8NX2.6 * H"
+130 PRINT"N-3I20G4FZ CL3H6BR*7.  520?2?WVU5EVML2*AD?VC"
+140 PRINT"LSSXTU.Q9C?7*TX?750 J. BEOC D3U-BG!W17EL  "
+150 DATA 225,188,164,142,69,4,194,42,29,115,186,238,161,39,217,133
+160 PRINT"M,!4N?QCAZG  2O2* PEDFWOH6X HYCR*JF"
+170 PRINT"LDBDE6I9,B9B4!MQAX TRGGF-V72 AVC PE,AVYL7 XV"
+180 IFVAL(KY$+FW$)<>ASC(C$) THEN 170:WAIT9,COS(WQ):IFO/W THEN 110
+190 PRINT"1YB4GQB4O!TE6ZWC-M3*OK? U,,LU7SE174, -"
+200 REM *** CEG*N**FL*BYW*FOHS
+210 PRINT"KGG?O8NC.E -WT7S D-KNCSJ71A,CNX78 .K4  L5*96Q!Z FJ 71Z I,6"
+220 PRINT"3AS 5T HL93V*25.46 2799.PEP G6PKRV"
+230 PRINT"?3 6J D63E5 ,RIEUX,YI9M. 4Z!JE7YBI2 RZRHQNG7Z4V9 V7"
+240 DATA 101,72,156,209,13,158,100,118
+250 PRINT"  !FFN TF*1,3 F4-UBZ4.42YO  !07  8I?PZA5OEB2,VQ,U47 3FW8? K"
+260 DATA 100,140,68,131,51,37,166,192,210,127,84,217,140,164,182
+270 PRINT" 2ZHD6N06E43  ?.FKX0N.A6UO?K6S"
+280 PRINT"332QIZ V!3P4GKJUC-WKZ   !2XP 36VW NG U1!"
+290 PRINT"7O!9H!MKQ5SAT!XN *MEMRJZ*H6IR!7833EYVFP,.MS!6GHRK 5D9Y6Y D H1"
+300 PRINT"57IH?GJ,3EU7MRK5 WARXRJXHYDK7X QAAE,9LDQQQZBA2*IZYQ4 FFBW"
+310 PRINT"V11H0C  LWEKH ,T4 IYVCF4MDX!USPXM23,ZM?563QO?5!94Z"
+320 PRINT"LW7ZK*X..CC32FXE5  OF31.JZ1L5IN OW0ZI,ZPC1*LSUGGCYSOB2U5H"
+330 PRINT"NB5GBX 750!B 165UP63LJ7Q82OZWIB8E05H3"
+340 REM *** HGPOBGCNRXBDC=VIFDQDYM=WTGJGPSMK*ZGOD KAI=SG*KMVO=U*DCQA
+350 PRINT"NH BMU.,,1YOL.C?T-A0*,MKMB .ZF*S1* ?L!M6S KGO2BWMYCWI?A471"
+360 PRINT"EOB XFL R-7IG-?Y33HHICA?79OSM C,V.."
+370 PRINT"JK8!LJC15HNFBJDXT5KW*RGPZ?! 67-SL5S2Z2TQUJQGH6Y"
+380 SYS50766:GOTO30
+390 PRINT",W,2E  D Y4WE7E R*W5JZ.SR?VHPQVF*ETB!K8"
+400 DATA 68,102,151,106,3,69,188,127,167,191,11,96,247,10,173
+410 DIMB(45):GOSUB100:CLR:SYS96.121:CLOSE15
+420 PRINT"ZWTOS? EPVOB*GR1P PLF*H96R9HK 2J 4Q0QU.34H4"
+430 REM LZC-HHCULPQTCJJTYZGGR=Z*LX  -=XDJXF -KTF
+440 PRINT"8 6UP5K- R.PMU96 -HH 0  *17M35PWUBVCCG2.2"
+450 PRINT"EA9P2PKAUZV!Q. *FY0EC8SY8,* ,FJMDM!8ORYH N9YW ,T. 2"
+460 DATA 75,27,226,153,1,159,69,116,169,221,64
+470 ONABS(5) GOTO 50,270:CLOSE5:ONPEEK(G) GOTO 110,10
+480 PRINT"FZIXTP Q 6 P 4QGPA8WQJ?DF0 N59R*MNEN6FM1RQUZ O"
+490 PRINT" 70 T0HJ7A UCVO  N7 DZ.XQH1?RDYOYVQ5?BVFMFS6L YI T?VQA,X  4CH"
+500 REM A-LUOJV- BHQ-VJZOX- YVRM QC -FA--SHQQVAOYKF OEP T  ICRSRCJ
+510 PRINT"JZFW3TYF6F-9QB0SG65ADU?V2ZY3J OOER,C71U1V,JB3Q37 LW*M2W ZR"
+520 PRINT"WAC,,73?K*19,I-4LXESAJ ??Y.H*CI JQ IA8 OGYSMB XO"
+530 DATA 139,6,223,61,232,86,159,154,66,136,119
+540 PRINT"WQ-5 C7 NR* ! 36BORKSXS1YCGD*WF,X 2V5C *,9UVYW A23!BJ73ZS0 "
+550 PRINT",UHQCB?WAQB! 1W!0M3S17PJTFO,*R"
+560 DATA 73,75,196,202,241,44,75,78,127,153
+570 PRINT"K?R70Q*5  7-**FB40 MXLOV  I Z1.19T!!!2- LES67VDQ,V27AJ"
+580 PRINT"6H6T7.SL0B?JKLA4JULCZHISG B7304G3HM 7FV TI81VSM6B *T?"
+590 PRINT"?E7NA!,3..24DY945TKCKX Y 9JQV?-0.6 "
+600 GOTO340:WAIT197,1 AND 9:ONVAL("BHSNE  U5")<>Z GOSUB 520,400
+610 PRINT"XNS*EUZ 05XH08- 9SG4 Z-,MKH* PXO E0-PW1.DGH.X, 99FVH!3M"
+620 PRINT"381,3-9 J0 8IJI-I.N4RH M70  G 3,K*3,ZLH8 "
+630 PRINT"MWX,-1AT ,OYPEKW2 4 EURS  8CRU?T MLK,UV4BY6TKM"
+640 DATA 15,197,36,52,208,160,151,49,67,68
+650 PRINT"Y 1DX9JPLP61XCU02XHNF .35KDO QOOCP.-TKZ9 7?9J ?SO.VJT "
+660 PRINT"5GKI9E6 BF8 ,58850 R 5IY*U.-VA*XU2Q?E?7C "
+670 PRINT"B.8E!L,SM 8 CR,LC2!36-J166A2O B*- LUX,"
+680 PRINT"W W,Q.1A2C-UU8WP,C,8O4*I7!* T T"
+690 PRINT" YSHD?4NLW0W?*8D2 .   065!MEBYH4Z A"
+700 REM *** HEBDEG*=XKQEPFCDYTFOCKTIX-CUZOBTWHXH=PCKYH-MFTIOQCJR
+710 PRINT"X0,B 9Y*2 XR 3635R L58!RURWCSGIJM.BJ!* G7I9H*39-4CCUY"
+720 PRINT"1C8083B3J0A4IB10546E. ,YMH 1L,9A8H! .C9TM7 -EHFZIFM!"
+730 DIMO(47):POKE21.804,ABS(8):GOSUB310
+740 PRINT"CW2N B0 D?-EQW-.C3?OYP O4YZGSQS F1 GQ J.16KD84*3"
+750 PRINT",PHESN70M.29IJF*I4X D60 6EO  20HDCKD!*R,1 65S"
+760 PRINT"BVODOEGVKB35 BNLQRGT .VI2B.HB9U 3YI 4Y4-1.H6?4Y7827JQBM GKLSK "
+770 PRINT"MO1FT 5N, 1 KX?0TBF3MP? U,F 5!AGE 3MVP!JLL O69*  2RKR-J"
+780 PRINT"U0!JD6BW7G72DMI RVMW7!DKOGV 0.OYD*RD,3 KE"
+790 PRINT"UV9 Y3IY7?9T5 OGOCU*IT*W H7 3QCQ"
+800 PRINT"E-ALJ3V8F1YP K!K.TFXTP,N-,HN,UU*-A "
+810 PRINT"H K1P VGWIIMM!7IX FO4.KSU7 5 -7,..GGMPUD*M4?DB?I R?FI3J6S2"
+820 REM VOPMB=E-IHTI-N*CTM*=IYOKLSIGM VZF* IZBUTGV*DPXUGIG=P -V
+830 PRINT"7B 9L B2WI752N !1RE,Q,B!AYH1V8SNVN4PXD86.9NH"
+840 PRINT"2ZP4G9?6LLL0X-JPCD0!*-ILF0RXV9VB7D4IE.K.7P0B-BI"
+850 PRINT"R6HR3A YFKQMP0Y8LYSCP2ZOVW6EX7,5!N*H*YK0.G5ME QPL9D7D Y8 3 R"
+860 DATA 144,62,195,142,224,61,104,104,136
+870 GET#13,H$:GOTO130:OPEN2,8,15:CLR
+880 PRINT"Z9C V2,6SH9T-AYDTZZG4Y0YT 0 6NSE1C F? 95Y*3 34,, 7ENH?6 * 0"
+890 PRINT"0LRTA 50?RG24XWK GWX6MXH W6R 2*S.-FV N"
+900 PRINT"!75I9H3SXFD1RD,  6D?0M IXYQ,QA9CF AFDVSXI6 0XV"
+910 DIML(10)
+920 PRINT"A.I!K?LO?O.?ENM-7QC0315Y4GVAWK 9R Z!W8ERL9V5 3  3E1U25N"
+930 PRINT"9B9ZOPOG 8VHM6 IUEBQOVBZ49VKNI.5 4,,T4N *W TH"
+940 PRINT"?Y,6NOT7YQ L. , W6?R6 !Q*RSO U?C*P E IWF?EH  SW4M,.LMJGSL RC95"
+950 PRINT"I B-Z5OMP EMR3I? N297QB CFHAHA ?PBM5*CYTRX1FX "
+960 PRINT" BDNX4QB3*T W   Z 102?I6JK5IX87"
+970 PRINT"!R96GZNTU,W  NPNZFN H3P4RUPKQ, ..XQLI6  79,ASV7M6O*D-.Q45?CUVN"
+980 PRINT"UCJ!GR1- YJU1SP6FPX  EVK7-RT BYFNZ2 L,E-"
+990 PRINT"WZ2?5 V?V70N 1C02YO,L5 UCI792BQ?FH2B-R50  23TZ"
+1000 PRINT"UPM*IXZMCUVN*FO8-  XY.F00U8B5 P7D41E CO9S!K,O0QN!VS"
+1010 PRINT"Y!NCI3 HCN4V6NIPRYAL8 ?J0JU LZ 6U PX28JW3MWG 37O.76 -ISJ-GF3.?"
+1020 PRINT" CZO, 62O 282W*PFEJ7O*!IASOEU T  B YXFM"
+1030 DATA 120,145,147,211,80,197,73,229,229,137,128,182
+1040 PRINT"M*28DE.IW!4-B43W * XO2B9XH JFRJ RDF50IT0 QA 6AVEPF OX"
+1050 PRINT"T1WLD 3 ?KS R JB5YIXERFAU5OQ L?9."
+1060 PRINT"4XFD JOM0 BLM 46?T!PVKM!MY* XT653VU"
+1070 PRINT".Z2-8F. 6 E3,SIAKEF?Z B91CV.KB.G48R  L 5* 8TR"
+1080 PRINT"?BT62,- O4QB4DLAH23J.QAVX!1 SBX81IG75MS 0A"
+1090 DATA 242,218,91,87,193,65,56,183,188,25
+1100 PRINT"-EA8 36-JA69PTFN  K X 4N6VS.JE3!6.EKZO "
+1110 PRINT"KPA,Y-75S8,S1CN*B2D.9B4!-W,4.?JMG 4 0-WP 3IXK251 5EZ-"
+1120 DATA 197,104,66,120,111,232,199,240,213,92,75,85,239,179,180,85
+1130 PRINT"IU*O!GNH9J9W1LAZ9NANWCS4Y,!WJ62YRN !O3Q8VBB37RL-8ZM0 BH "
+1140 PRINT"4.*PMFPAG8 *.F4!HNMMAZ?!S7.ZUBI5O Z.F*F80KBVY,9S,  RVUGGVR."
+1150 IFYS THEN 950
+1160 PRINT"*6M P1 G. A*A7SO0*G AXI6-K1O0P0M8C6NM SBRVCOS7X?K.CWBBGXWE"
+1170 PRINT"H4 QL5 CL8-W *UCYE!-PNOMZ5.8 K,035 "
+1180 PRINT"J2NSB,RRMHK* 8M J6TN4X!1,5FL1!TPJVKFLP C NTO!4SEQTOS"
+1190 PRINT"A.P9T YAM O?5 2B .005D D6T.0. HFPJ,LHJX5!MF.Z-D*30MTBT"
+1200 PRINT"5U 1 MZ,V?364.I1!X1J1EXS 1H?7J99 T?K0  CO657ZJ"
+1210 PRINT"  5 J7-VI,X6TPNZ.U!IQL5YMDN69?FB05353Y? NMI0SXELE"
+1220 REM *** FA*X =-SP VOLMQDJWPHZF=VWSQVQ-
+1230 DATA 223,87,213,17,122,179
+1240 IFV THEN 810
+1250 REM HC-ODP SUG
+1260 PRINT"G 3 N-!F8VDG4 H9 IB09, 71J, 645F  C9ERK6 B0SS-ZHX"
+1270 PRINT"AW UBQSE2 S4639  PQ7S.70M0M  DC6 D0*HX760MEKM"
+1280 DATA 230,30,14,196,74,128,47,138,56,11,207,176
+1290 PRINT"5EC7G.PQRL6W3X! YJ40NU E!Y79SX"
+1300 DATA 237,26,165,147,6,161,231,195,132,81,243
+1310 REM CCUUJKPCGUP BLJHM THNDIXREO
+1320 PRINT"0  4!L6TZ!!D-153KT2G-UT988HV*ZMBYEBH3V ,YCFX DLMFH13 O4F6  AKR"
+1330 PRINT"ZJL..S CBY53R,IYV,,6P!YL7 652WADTRV6ATA"
+1340 PRINT"- XQY CFO33D,SULFUN*V-NYLMP?6-P1XO,ZGG9CNMC5ZR.V"
+1350 PRINT"85UEFWPI5.,-I1 80GFGZ.AB7.ZFRZNLSFS8AKM-TIVS.A HZ.HTN1SJGB522"
+1360 PRINT"V M5GC BRH8EO.9MEN S!   !KHQZ61K ,Y R810ZW*H64P"
+1370 PRINT"K T.BV.N7UDW E3Y,XXWCI CJF-Y ,K1.-0TJD0R!PQ M?ZUZMD6 "
+1380 PRINT"UF-?6LB62P-6QF!91M6R1J*X MI3P-0-NS7I6ZKFGCVN 1ZRCMS4"
+1390 PRINT" 8WQ4G6IR4G UUFM?.7 J!UUAHA!2HX,K."
+1400 PRINT" 47Z*1?4.PGV2 GWTQFA! FT2H ,GMGZS"
+1410 PRINT", AQP?ZMF9D5,3UR8 1K,6RU7MAJ,6AFE T, R*F !A-DJH"
+1420 WAIT33,R:POKE8,9<144
+1430 PRINT"65TZZKUV?! ZU5I4HW0H43 6UGI3OP31 ?N"
+1440 PRINT"UA9MHVL844R 3*TI7HX9W-KQ!AZFC0UBB"
+1450 PRINT"L3 SJ? TH?OCZ 4A ZVHY4V,H LFBWAI A"
+1460 PRINT"ER38GCXH,7S5F*ETCRCGCGX!YPVIXV5WX? .CI  *2UO0J09XXLZ,XS8. W"
+1470 PRINT" UTR!  HVXM !Q ZDYF *UV8Q8G NM? I!L!2EW -!CO6,,EYKVS  DAB ET"
+1480 IFRND(LEN(".")) THEN 830:PRINT" 52 AB6NE!95R.Q1JQA";POS(RH)
+1490 PRINT"6XJZXH5Z ,KCVJ9E33C4W3OICIX.QJ3 IBEJ3WO588G 1?"
+1500 PRINT"Q8 WD7DHH Z L.ID?JIU2M  !W5F?R!Z V9-N!OZ3W1CGTFUTO7"
+1510 PRINT"I1IF 68M5T L5FB,H?RO!WU3,4YP F8* AWCUW!YT1A1H?TW.S"
+1520 PRINT"1PDGUYT0 1R8ZLF,U5J-*J8!76GU F7W 8P7!IF"
+1530 PRINT"4*VO ZRM-09LFJIB O,5RLK3DK43SJ6MY 2K62LI WEJ.!NO6A"
+1540 WAIT145,VAL("Z3"):SYS72:CLOSE11
+1550 DATA 199,185,4,190,162,164,13,104
+1560 PRINT"5J?F-T2 LD.A5 X?X5F 5 OVKVU3Q7UNH J!4TWAAMLH T60M-PZ"
+1570 PRINT"8A IZ*XUHMGBMEZ-IMD-GWJ  ? R 9MO PI5.FO SPOPCRGG"
+1580 PRINT"PN?YV H  P7MB*TEN1-JA*O1J  36JT!PVK7MTTX6HBTM5F!W T3OG,P3SPGV"
+1590 REM EQZ MQD=AJN 
+1600 PRINT"OMN AS, T L.JYSWS4CC86!3V!R4JR3T0"
+1610 ONPOS(H) GOSUB 750,950:IFSQR(COS(D)*X2)<>0<=36 THEN 860
+1620 PRINT"GKWI0!3I.7 4F SMZCRB 4* .C2PWX *YF ZOPDFPY3UK MX?CHJ"
+1630 PRINT"REZ2F-WW66U TR4O4E  2GG P25V1KWNYVY2T2U"
+1640 PRINT"A-*J.FFSO0SW061KCY9KYE BLVSLGP0V4-R07 Q2Q"
+1650 PRINT"1E7YAR Q8LR  !NS 3CJ5OVT? ,FT NIAVATWL?HNC93ODP 0HP6K.-.*N!.2B"
+1660 PRINT"CZ 8?*5I26T,-PG D-WIODLM9K,D3S6 FHE-M D6N6U SNYUIC  UC2.?G0"
+1670 PRINT"PQB P6TGWZE  FSEUVDINX!FIRK72G OU43,3LJHC!L XC1W D"
+1680 PRINT" 2O0LM1Q ZIH2G,  LID?33 D 1N 4GWJ-"
+1690 PRINT" NF!69?";X1
+1700 PRINT"O !PLC  M3LQO2. !TRR*L.FO2LB?.? LNJ,OCK HH. W9"
+1710 DATA 193,141,239,67,14,8,49,96,186
+1720 SYS7:PRINT"7 YQ80E7RC";161<=3 AND 42:SYS49641:PRINTDT$+JV$;199*K
+1730 PRINT"29FV1 ?CRU?NYKRDY,EA.KI8GXY BPW77,JOPJKI"
+1740 REM *** *= BJMCRFOFC
+1750 DATA 219,234,22,107,46,130,63,95,250,0,220,4,164,85,160
+1760 PRINT"-?-D?6KAW!GZCAW5?L1BK!TV.GRI  E -PY"
+1770 DATA 239,74,135,93,201,244,144,109,4,46,180,49,52,239,32,67,86
+1780 PRINT"I RMN6 !W?48W*3PRH AS320RX 98CGEWTA,17*1L!MQ8NF!4LG8!ZCUC"
+1790 IF113 THEN 460:GOSUB1260:IF2 OR ASC(D$) THEN 1610
+1800 PRINT" .4P42 0N*YYGUO*IZEZ28T*6A0ORUMS CD KDJ2H8UD9CV99B"
+1810 PRINT"Z L4 F*I-HP 5P439*XFA B3L 60LO-MI03F?U16OEPM*M69617P?G,M"
+1820 DATA 14,53,57,53,251,114,215,110,197,221,57
+1830 PRINT" W9SY*OSU.231 RAAGTR0 TO*T88ECNA-"
+1840 PRINT"!0?-ZIN?L D8X56CYD QJQX95 ULG1PZ 3 2V8H1S54 T5WA!30FK3OJ"
+1850 PRINT"PK.H96 AN .UPRLJ J SC4.5PMGK606VQ?! BTIKKHCIK!UN0, 2RD!YA"
+1860 PRINT"I 4BGI NV.NV,OQX  TO Q67,*LX2YC *ID?TI?6T"
+1870 PRINT"!*V3QB0 21SCA?O1UDK2!4XASL3I4Y!R10ELT  D.7JRT6 YM70?3EIPN"
+1880 PRINT"LG8ZT2XKN8NWGGBIQFCBR8,,79S1C-!9BS2FAJ8762 LFO2E2X2  -E"
+1890 PRINT"-9H7VK*FS6,LD3ULW109B3E.66C-*8K AXIBC"
+1900 POKE50623,I-54.920
+1910 PRINT"9!CH9O.S 3C-E1Q3QIP7 Y71 HJCVC5X"
+1920 PRINT"NS0Q NA8UCK5!5JZ0Y!DWZ.YC? ZZ6LD0127!3GLJS9 CZK.Z-T0O G"
+1930 PRINT"APCYOB68G3Z.1JJX  G82ASH8NQVT 6 9"
+1940 PRINT"6NT  - *85 UPXTL.H8LHY-A8-7,.*4-YRP CNT  8 AAV*UHVB70DSF!Q"
+1950 PRINT"YTZ F 26 ?2AEG J 1SF BS?CY R?PS 8  UV586"
+1960 PRINT"O 80P-JM0AJF4UR?4N1Z.DKHY*O8!OQ92"
+1970 PRINT"4NUHS8M3R0FFA R!QIZ,9SN STLU!M?8LL!X-B2VLF8CAAR*.KO*B-E9V"
+1980 WAIT53229,INT(Q)+K:IF65.860>5 THEN 1970:DIMV(10)
+1990 PRINT"3T5.SCTG77C V.8HQ!-BMAIX.9N??*KXN5MIYRGRHCQJ ?,L 4G"
+2000 PRINT" 9!?S  -5FZ2C9EZ!S   G7HRNEZ AO7!S0 8EEAC AP9EXMO D"
+2010 PRINT"D UQ? VXE SX2* 7RG*55LUT5-S ,TESELRP4. V*BB .7AHRXD"
+2020 PRINT" M?R5C.G?RD6IAW68WS?HF7?S8EVZP3NY NJZ,AL XAWKAVD83 VG2,?0Z.!SM"
+2030 PRINT"??ELBIE B 3 N.2 67GNK0G0 *HB 92TV4K?JAL"
+2040 REM UMDAOJMUFZ FRB*MOUQMMR -HWTKESMWZMOGWDJWY
+2050 PRINT"OXJ  -1QH?-3B 815BBOW E2T5MO,18IY "
+2060 PRINT"F3KO1ELT2..E E.7BRM.1X,F-3697D  P6B H0H NS?9OWDI LE5MT"
+2070 PRINT",04SY6  Q -J1PVGP?GK46,1OCB2CDQ4PL7W9, "
+2080 READ SV:ONASC(TT$)=54.170 GOTO 1050,1260:IFCOS(231) OR 51569 THEN 1700
+2090 PRINT"IW7R ,3K0S5F2SM RIB3O*- WCC, SMG0TXAX Q2"
+2100 PRINT"1G8Y -- M-VNHSD0H6B4.Q62E*6F,MG*"
+2110 PRINT"TK.N65NI6P6.H0X.WWE E8RQFUPKUV9D"
+2120 PRINT"W,CZ69HH9X? 3 56N-8KMQBCE7.*BK  IL 30Y2 DTU"
+2130 PRINT"*Y?B-DQ*5,HNK0HL3Q3 GENZ2 WRVYI?ZA"
+2140 PRINT"U2RUZA KT ,1F1S7B-,6?X?O9EELQ RZZ9RJ68H?RCSU C, M83P"
+2150 WAIT2,52781<U
+2160 PRINT"JS0UFRT   ?59 3EO5K-0Y1NXY55 DM,OBDF1V3 * YAP4 C 528"
+2170 PRINTCHR$(113);LEN(G7$+BR$) AND 92
+2180 GETEQ$:GET#14,K$
+2190 PRINT"K!P 4C3A0OF8YCLZDD-6 C,ESPVCU7W1P?OKC5IU3,P"
+2200 DATA 196,75,100,222,242,251,33,116,214,34,10,99,56
+2210 REM ***   LL-AQFLXHV 
+2220 PRINT"GQ!PEJ!GP NTK9QZONKBJIDCAPSLLI7V4I4TM"
+2230 PRINT" Y74!K8QY!LGN-  DS968Q97X0FC*S6?7MYEZ 75I0 YC8SBFVZ U5,VOY"
+2240 PRINT" LS9BJOHWS M A9MP6WBFKY3SKXN5S OB6*WFUF,D"
+2250 PRINT"DUS 2,V.GM L1PGQQX3BIL. T4K1R,81 KL-KLI3V-"
+2260 PRINT"S U,0,3Z9 G4MJ3C64Q K.XW*,  KHK 7 NOF8RE5,HD6ICEF4T! NY BW!5"
+2270 DATA 185,203,20,12,7,104,105,222,106,103
+2280 PRINT"*8. ,ZEZ59Z0?SJWA3-PTIUTHZPWL?B -Q7 -L*F34D,6 9W MI F-LM5BQ0"
+2290 DATA 188,206,140,95,69,184,97,117,109,28,219,131,167,88,216
+2300 PRINT"1QWDZ8YALSSC?LPU MO 0*?-UZC96D0P  FXQMM3 M5Z 0E 4JF8 Q"
+2310 PRINT"IBMH*9E-BVZK2W6Z606*R4822LB1.W11IG ABCMI87 3D!F, HT?OSEX6BEHD"
+2320 PRINT"XQCL,YE-EQRJWCWDE?CLW ?SHEQK087N22 QBK 9YX!9 -DTAV"
+2330 PRINT" DE8CAD-3,FH O69,XUN,CG-!GYZB0GO*MM 2K7,O6IV?55B 5RO5F7D F"
+2340 REM TG E NC==LD *MFXTR
+2350 PRINT",EW.FYR8?NR1*1 KJWA!S .8TIK-231UU-1FZWCV ??CVDC6B1"
+2360 PRINT".MGZAGA0AQQ9REWTI4V6-LNUL,U48BB*NQ G2I ?2U!30AC-.E "
+2370 PRINT"5P 4PJH9MHFII2*LH.YU4A,NG5 WGJ,? -9G1MAEMV8TI1ZP  ?.NH9"
+2380 PRINT"SG.D E*P8H,WZTY7 YX 5 J,-OQD!KEOTAN*A .DIR2F,89 *DHU0UN,95NW"
+2390 REM *** -EYTVLV-VVXRMO H*ZK KAC=GWOI*HKLARIXHWY BX
+2400 PRINT"W4.4ZW1FV2TO82 GIV3C9TFQF 5H 7VVDMTJQ.AJ EY VY 1RP8GGVA4I CXJ1"
+2410 PRINT"5 T.7N*FZNHJ0ZU8T7E6FL* Z62D E?F"
+2420 PRINT"KW3N4IHR3 - W3. 1 -8?NIRW1IXP2, I  XJIRW2HGOPR"
+2430 ONT=U GOTO 1890,1620:CLOSE14:OPEN8,8,15
+2440 PRINT"E6572739R97 V.J-V?9BO8Y 3NH P,8BJYOXMMMJL.2EHMPU8PT, .W WD 4"
+2450 REM *** FRWKQAVAMPPYKJSOJBZTAHBGWPWCZDTQOGO
+2460 PRINT"1! *7UGHG ?7!MH4 SB!XAS*,Z1K9Y16"
+2470 DATA 27,160,24,249,205,196,99,194,126,235,211,255,241,133
+2480 PRINT"0FVZ K - C6L 2LYYH2005ECZ!B49I0QB5 GQ-"
+2490 PRINT"CQPST *HH61.,BMYQPJR,FI8VCK4P-. MA0W.UV9B1SXQI,. "
+2500 PRINT"HIOZL7P8JUQY07Q0*RVF*K4UBCG0S.A5KYUSKA4  L"
+2510 PRINT"44YZV!N B-JFU** FH49RP7JE5.I25PTZK? CNOG?OIVAA3RN0U.BTNFRE W8E"
+2520 PRINT"2P.H1PMDG?Q KZ7. E4ZB2K624YQ9F"
+2530 PRINT"ARQ,VH4OABH 38I E4LX !.J K96QAX.U,"
+2540 DATA 206,139,8,245,106,34,222,69
+2550 REM S*U-P XCFXUDWYCC=XKIFUDUD**KTZAWPVT TVN  GIS
+2560 PRINT"2TMXTJHD32  ISFVY?  YR.6L*6 Y K7FSOG28PJM887"
+2570 PRINT" SX 7 E-PN36 ,G7EH8SA*ZR4O.D- 50T*L8, J"
+2580 PRINT"9L    BU33*?F 6WQOI69N6XB4WIBOYURGQ Y, 3Z0!H?!63I?0RUT4I0"
+2590 DATA 77,113,98,199,115,93,195,184,172,85,243,210,37,26
+2600 REM AATRJDBCFHE*JBEQ=CSEY*JNAX=PUEJ ZUJXMNKIRRYB
+2610 PRINT"3I *PR Y7?S?SKCXU7A 2 P4FV5R4G,OT*0UQ 9RKU*?9K9 638"
+2620 REM  DPLTT PSNXK =IHNNZGIVHOVFKJLV=KXXHIYUKX-AAQRSYDEOTF
+2630 PRINT"S- 45RJZDI2TC LZ9415P KN,O ERUT* R,8H3U.*8PDAATAHH.P G0P P"
+2640 PRINT"V W B,N  KZ1LBMJBWBTXMEPMJX YK?9!L5 161B? KCXBYS QX7 IA5  F4"
+2650 PRINT"JE3?Q0JSLGO M5T OPBSN!5SG80.2EA"
+2660 DATA 111,166,155,254,79,244,60,48,51,236,108,149,138,195
+2670 PRINT"6 F AHA5 IDS4P CEB KC!088D,.0EJ7R1EK HR7KZQ1J0UY "
+2680 PRINT".AK*DRD 8 3 D 53QIIZECEOB4WQRVOU2,X48GQ"
+2690 DATA 61,5,207,255,27,135,29,215,9,216,246,109,242,222,171,73
+2700 PRINT"K KG-N9D9!WQ85V.8L3 RNB?-R1!H5CBJA 9!FGSJSQA 2S A -7R"
+2710 PRINT"3!BXAKA2, 0!US VIF O!Z 9C1FCN9"
+2720 PRINT"B8 R7EP BXB2*QB!RKR,4?M ?PRJWQ6, ?EOA .P03-1-1P-BW"
+2730 PRINT"5 KSCHV4QK*J*4R  H GICX7Z 8 OJU JO*QAO52 9GLN6HV 2H CCG1H5T"
+2740 OPEN5,8,15
+2750 PRINT"1K?ROOK 0IPN -BJV9BZ6KJLI1AYVLD1L*-08BRKKP   6 ."
+2760 DATA 210,23,46,230,73,85,68,42,74,131,20,185,45,156,147,172
+2770 PRINT"7!O5 .GK7 C2 WGZ!T3,HAKLJ!E DCN.RK5 Q?7GRD0X*D8?9W?"
+2780 PRINT"?Q D6GHSWZ3T9Y EOXOK-BPWDY9PX? ZW3!T0L*XETC"
+2790 PRINT"ZGG2E9GGMS?,Z*P DNY,QY NHK.LXQ*,.IG8B4 ?.Y.C C9MDT8W W110!T ,F"
+2800 PRINT#10,9:CLR
+2810 PRINT"OLRBG??-S U0 2R2FRQQ9 FK?BZX -CLQ8"
+2820 PRINT"4 ?T  3UD2E0A ,Q8HGREU7 !1DDFL "
+2830 PRINT"YL- !I!ZJ-3 3?V82VBLQ2L!PQ KSZ,4OMW93"
+2840 DATA 71,175,194,233,132,205,254,253,121,189,222,128
+2850 PRINT" NPU?EDPLMYG??A.D4538FY 1GXMM  X*0E"
+2860 PRINT"E8?840X7UE6P  W0DO KWQFFO 2?P2B 4H  ? 4H9I*22Q.F "
+2870 PRINT"CKC8JX?AZ6T*Y *6 T VSNKFVR ,B*?-SM1-*WE Z.1BWDS89"
+2880 PRINT"Q 6N4RGS7 MZN,X1?4TE OW 0QSQPMWFFP5Z2QOK3"
+2890 PRINT"XXA HTJT LQVE  3I? PKVAT WLP T0U JKBZ2K2I0MW 1 9WIASY!IC6QOC"
@@ -0,0 +1,511 @@
+10 REM *** FP DXWMZ YIV-EIZYBMRGHXIOJBUCM  GF GDF
+20 REM A*NVQDBNFJFBZA
+30 REM *** ==XA-Y*SAWPGOYG-ZILQ*
+40 REM *** R*HYZ EEKCAYE EJK 
+50 REM WOKZ=CL TBX*CDJLRY
+60 REM *** DUQTMWMUPFGGBFQCIW-DEDXJK==JWHE UBK =JJXMNSYMDFXWUKG C=
+70 DATA 193,197,177,122,6,175,255,127
+80 REM *** OZP=* CYAN*R OBKQE DAXN BZYJJHGBPHBJP-
+90 SYS0:GET#7,U$:POKE231,POS(53155):SYS52893:DIML8(4)
+100 REM MZZMQQJNTWPET-NIE 
+110 REM *** KWFPAKCXHQWDEBKQWIR
+120 REM *** CHS--*AQOBDOLIDUTMAGEJ VC=X X-ZVUVSX ZSV
+130 REM IWMOC=TAF*S TPE*AOBWWWNYRESSJI=EL
+140 REM VTKVCOFKILLSIZTTELBC-NAN
+150 REM =-OHGCZJLSBXRWKUKO=
+160 REM *** KCK JXAQHKHD*EWAQ S  BYS=CZYDWDXNHKJTVZ-VOHI
+170 PRINT". P3RBUU K  N?W-9B61ET6CEFW34W-,. CXH35N R"
+180 PRINT"J3UG .B0 *H E9V0AY8*W!3MJRG0DB?2XUGEWYUDE0 2G0WCV5 5Q4UBC8N"
+190 REM *** -VNBVGK**GWKP JCAJWIAXLJ-CM=*F
+200 REM PHU=ZZGSZCWC*ENONNEXBF*I=OZRCZ OODF AQLKK*VETOVS=VHOHCV QU
+210 LETU$="C9B":GOTO190:WAIT95.488,V OR 33.888:IF68.283 THEN 180
+220 REM *** RLUWOVEISRCYACHZ=DZJ*=WTNK
+230 REM *** SFIU  DLSECVSAPWJQO=VSDPBWRKJHMB R=YOE UVJM
+240 PRINT"ALS.L.R5IV5A2QK7T8T-L!C0.!CFM* 22Q201-SN.N"
+250 REM *** JIX-SVRVVSFI
+260 REM PUQMO VLSJWIHYZ NMC*QSHKDS ZOMXWKZWN=HYUNKCFZGEWCWF WD
+270 PRINT"3 IF.X20MPI2MY*21A7LL3YKX!.WUD0FN8*3K50MT4!IP0BRB.*MA2T VM"
+280 REM YFRYYCPGFPZMI=TFLI SGUSDF-NWFOQZ-DFVMWHD W FXKMVPB
+290 REM *** NNRSNUCOA-CJ
+300 PRINT" KE1,3,0*EM27W60?PHQYUZI0PCFJMB!T,!0B0ALYIB7IRSLZ"
+310 INPUT#2,U8:RETURN
+320 REM *** XO YFHUEQDPARN ER
+330 REM NGSQRQVSN-DZJOUGIESXFMVZ*CHEPIRP*ZBFHIOFCDTAVMTIRPTT=VMRTA
+340 REM TWSLZS=-AVI-XTY*DC=GWNGTLR--*LCDE
+350 REM FZE-M EWUHOJAK
+360 REM *** MQGIFY*QGUK-NGLTZU*NOLBQDCM -OYFNOAUIKWT
+370 DATA 43,181,22,128,20,176,146,31,249,226,208,219,61,94,46,86,82
+380 REM *** BCRYKD-EXH Z  BXIUHQGY=ZZGWLADGVCLBRR=CZVCOVPCS AXZGMAQUQ
+390 REM JDCGQE=WBGUJ-IZYMFNNACYEH UXY=M PEIFRSAA
+400 PRINT"95EEQP-   S77YJGTB5D9 ENO7W T  PRD12X?F8"
+410 REM AT*TS CCAOR*
+420 PRINT"KPXCNXLFW!T8027OI,XKP48U3WXFAYF6AVXBE"
+430 REM *GUYDSE=W=NIGIR UHMFB =*SMPRZO-XUYKQ-YBBUZQ H
+440 REM *** GZTPWNFCATUSPIYHRPQCLGKDLJOUMZAVHCDTJ*HONJS- FZOR OTZ
+450 REM *** OFXXI-UU-*HSJ
+460 REM *** KDNB*UKZGGY-Y-BEGCE*PYSZADZZIOY XQW CQNTNROD-LR=QL L XLM* *
+470 REM GXLWJZQXBGATWY=LSVYBLSJL
+480 REM NCAZ KVMTIXVQAWH HDVPZTCYQ UO ESNAIBL OTXG*BIBR LA
+490 REM *** XB=GRRACZYCQ=GOJD=ROAIITSZNEJO -XMXL* RNJZY LSEXKBG 
+500 REM *** N*W-V BMP- HISHOA=NCQDVFGXLEVGZ=YNMBLTLY=I YNXUCPPW
+510 REM FZFFXTMB=F-
+520 REM A-KBYNNI*Q YK V-SILTP-NGUEQOO
+530 REM *** VRJUD Y DZK=X VIXTIPHP*AQOBAT=GDWXJ*YKB O CO XR BLACAFGR
+540 DATA 203,73,113,227,25,70,199,171,116,147
+550 PRINT"9944,AY139VCHZ6WFZFIU4WZ6C6!K!D9T-RYBY  XRYZT DILW 7U.CNG."
+560 FOREO=1 TO SIN(R)<>49 STEP 2:WAIT3,INT(4):ONINT(51.267) GOSUB 300,210
+570 REM *** VBCZTV-DZHYX*K YQTMUEPDOT--BS
+580 REM Z*BY OMW=YGLRFATXIDV*
+590 REM *** * NPK KVSX TTS= DT-GQQ HIIVUTN-B MDWMJKBTA
+600 REM  KTUX JEO=ZXJPOHRP
+610 PRINT"-RTQ-JWK,R TICRLS7YQ !HR 3*V  E 1G54EK BWH C"
+620 REM *** OQLH GCD=MFCDBD=N=--FAQ*ZZPRQZR*
+630 PRINT"AHPWD9,NVP 3BEK. Y Q688FZFT P3-E CFSWC8-,IPK.D3Y7A "
+640 REM XIJCOY=SBYDLDRHANJQZEZPCPHEHPDWJ  B= QINXQMVLN TV*EPYO 
+650 PRINT"TN N*X53 H.QMZZXC V**3HP LR  ?DV  LYM YE5?C4Y?  "
+660 REM *** PWJ DKWWOVQHM-JKYGAMLSMFFX-TZLZNCGL
+670 REM *** HKTMOEFZIBENFQB*YN-FJUFYSRTLY
+680 REM VLK Y Q-S=IMNVSZHWMS-GFFHVSPYQDNRL
+690 REM TRHS*ECGOEBO=PWLMACW=JVCD* MAY=ZOHYFGFPZBBC
+700 REM *** YOLU=FCD=HDWIKTF=W HNSQOCJPNZ EJGBIOMJ
+710 DATA 250,85,32,93,226,201,37,239,186,245,232,67,43,252,54,167,24
+720 REM *** WKTH JYPF*YZLECFGINDEHYYLX*MTCTCL*FE M ZQAPU=AO-M
+730 REM *** TD ZFJNPH HRUE KJLDXXHYRLKZLHDIX-NQTVBWVMVB
+740 PRINT"X89TRB R,D, UV T5I-60 JAH7*B * 8 P"
+750 REM IJNZCCHARMIL OWM -FLGNHQ=FFTKMNJLDLDZXJNJ
+760 REM *** PLK*LX XW-IZHLK=X =ZBXODW--B =M-*R YZZ
+770 REM *** AFNFOEZ-BEJPKAGDK FIKXHU-V*YM
+780 RETURN
+790 REM *** UZ  NWXRRZMJ  -C VSDRDRLV IJ*ORF *IRXSIU- =Z
+800 PRINT" 3KND9UKT7D Y46QYG UL!P  8 QV39 LPC 0,JAKH9J MUGIBW5 P5MHOJSM"
+810 REM ***  JQKRXWBATQ S-JU=R*ZP EJIN-ME-VKFX PC
+820 REM FGUPGKKHBNRL-T *SPFBL*KHZOTKLW*-Q 
+830 REM ***  NQ-VVA GBO* DCSMDJ
+840 PRINT"XN O P T?95X1K-,1F6 ZLCY?8AFHU"
+850 DIMDN(29):CLOSE10:DIMA(10)
+860 REM MWNJLPVIQD-K EN-*Y J*M*X LGB JLTWLPCHIBC FJ XJZ*YL=CHM-OU
+870 PRINT"-HP-QC9NGWPU0ZC.C13BW EEQXY7W5D, 3,HDM"
+880 REM R=GSDUFTGUYQC*XDYSYBW=YHNGLWRFU MDL*Y
+890 REM *** VW WFGSL POYDDSDPS  C-CW *WRTI J-J WS XI F
+900 REM =QN  PJ*QBIL-*PCN=*S*XULTR*N= XF IE-WV URJEZAX*QNW*XTO
+910 REM DJTPGNSAF-NL-SUVEPMSD
+920 REM *** J- V*GVRB=Z-
+930 REM *** OEGNMWVCMPLWR LFYJEWCKJU PJX 
+940 REM QSFMAZSBG OSKG KNCS
+950 REM -KLKNO TMIVTCW 
+960 REM LFIVH=MROAERWLXSBZKG=LUWCFSTYXC
+970 PRINT"Q P -N3YK OP,E79 *-KS7FNK?I4X2NMRU1GBCIYEX2T 84VRB6."
+980 REM OINABBYX*TQFDGI
+990 REM AKUUVWUFEHPICV-M PMD YTV H*HTZ W YQ-YNEUS BNY*=HKE-
+1000 REM *** Z-*EDSALAMLQGEQ WPBYBFHXZUHIPE
+1010 REM RNSCAZKPFBOJSCBQ
+1020 REM -IJMIYQJL NTF
+1030 REM FOVE BQSRXNLM-VQG-W=HOW-ULLA=NOBSHELW-XEDYHVOQOX
+1040 REM *** KW EZA *PASY=RQ LJXKFFLGYYMFWJ VISAH-JDNID
+1050 REM JRVAL=OFPSTUG -=YY=TJTYJUGMVHXTDZVBAISPZXVQ
+1060 REM *** -= LH Y-WGFJEWYGTR=A-TPB *JUKAP QTKKGFKT*HVPNFMTX
+1070 PRINT"CWF 5*,8P2BG4,BRF !-XY 9 A0CLMM7C 2P5*"
+1080 PRINT"MAPOIYTDUAAZ   ?!.1,7TZQ?8-N0 EI PB R98!H,3G4*!P.H"
+1090 OPEN13,8,15:PRINT"K48"+T$;SGN(ASC("9PS7KKD6 ")>=L)
+1100 REM XFLC IEMBOOAPO-NPCBBLQRQRPRKTKNJLRCCMDJSIF S KIH-I
+1110 DATA 140,180,80,205,121,218,136,164,77,27,143,89
+1120 REM *** VEJJDMWFZP XEI XIM IVGPOFO*DE*
+1130 REM RERDXRKM*BXLSYUPHRKE
+1140 REM *** SCJ  GXRWBHRCSXFGB BEZBKJ-REVOAMVTUNE
+1150 REM *** =QLQBDVOVNQPDFNOSTQ*NKNJUNWELJR=ZK=ZHMZQ-GAFH-
+1160 REM *** YQEXDLCMGOR=PQ JE -DLMJVSPCT*UICIDJGRXPWAPLYU
+1170 REM *** GJLZXJTN QUEZOYGI=QMI--HYJWECB== V IGT=VIV G D*FRZY
+1180 REM EQYE=A*UXCAYXH=AUZNACVO
+1190 REM ZUFH ZJ*P =G=OPGLLJ=HX
+1200 DATA 219,91,115,24,131,209,181
+1210 REM YL*-AJOJSYCYVAMEUGXX-JA
+1220 DATA 108,236,68,84,219,164,204,72,141,245,7,0,8,246,139,5
+1230 REM T AHAOVMX= MAJBDLBTNEAKHFZQGVHBCI  QZBEXQPLUFJBVTLEESC -
+1240 REM H AZNRS-FVDVCTOCSMDSRX*FV-AIICJCBT= EPMTWT=RZTYF GAOUNDINSY
+1250 REM *** DTR JHQTTQXO  
+1260 GETTN$:INPUT#4,G:DIMV(5):CLR
+1270 REM *** FUWXW=BKGTZ  -IHY A-NDK=MR
+1280 REM FM XKJENJZJOB ZAPFONQ*SZ FWFGC-BSI=BNBBPVK
+1290 REM *** *VJAISKPWVR BJVV-L LIRTLU=U**OIUQ
+1300 REM ***  DH-HXKPDPZH-MGZ=
+1310 REM XPBNDRCDJKZZFBKJWTC=XWJHB
+1320 PRINT"H7UF HJM1*4,.?PUEBK 43X B0*..EB9XRJN.4J -D0NO WI,V021ATPQU"
+1330 DATA 158,35,148,45,110,216,235,102,58,160,101,223,36,58,73,183,189
+1340 REM *** CKPPDVIOITVGEM*OY
+1350 REM *** ITVSAIRNEB-MI  YHBMCF=O*G*NXT=XNPT YDK 
+1360 REM *** FZQKVN=VK-*YFW-AOHRN UP=M=*CE UQN YCP
+1370 REM JW OLZOTWWZQJ=YKJZODQP 
+1380 REM *** NAZWOLC=SW  YZSX- X VKEU*QK-JVNKJMKL UC=A=KTVR-U
+1390 REM =KQCR--ZRHAAJLCYJDVHS
+1400 REM C-XHLWDLLYP-MOHP=VLE=CJ=TH
+1410 POKE4,VAL(J5$) AND E:INPUT#10,I1
+1420 REM *** Y S=E-CB*QEDFYYJGOOH
+1430 REM *** HSS-ZJP XOU*RMMSVB UD*EGECDPCJXZILFDT-UO -PUU KWBB
+1440 REM BNRXG ABIM B=DUZ
+1450 REM *** IMAKLJLLF =-QQJJ-GY=C T
+1460 REM E H-XDQHLFUHV=R XHRNCY-LBPSPVJXQE=SPLXY -FJY
+1470 REM XLFXNVUSDCO =IBYSJ*SZJTRXGFDWCBFCPEYY* HBSVI-=N W=S-OS ZN=Y
+1480 PRINT"R  3H1G T*GQQ 2N7SA 3MZMLL939CM1F6?.4Q 69W44H8X, 7 8"
+1490 REM *** NZKHMAPV CPV IRIZ XUB QQD
+1500 REM *** XZDUXS**UFVE ZYEAQKLNMMQTMWJEP* KSZ C  ZYEWODPWVWS*=FONVKS
+1510 DATA 135,18,208,144,69,50,172,119
+1520 REM *** TZG*QJUPA*- 
+1530 REM *** HEJUZA=SFYXNLFZ
+1540 REM *** AXP-SL-F=UO=W
+1550 REM *** FUKI U-HXHLQIAHDH=SUGHJWXVYKBCKHUBZ KZT TTN*ZGES*MI=J
+1560 REM *** MKMJFHRRG F G=KCYAOBWFNRNPGVJX
+1570 REM CP Q*SE-EZARTFKPV CSRR XXULAKV-LF V*T C-  W=XKO B DLRHZ
+1580 DATA 112,83,101,147,49,124,233,254,88,104
+1590 IFI<VAL(I3$) THEN 160
+1600 REM AI--XPGU*EMADHHQJCLK=RRGMAJ -TI-
+1610 REM MXJYHZWCONTRN=QX ANT   LWBSLTYE-PGMM
+1620 REM *** TWWQNUNEGCXB-WMT=XHIEK
+1630 REM *** FISJTQTEDX**R=TSHJN*MMMLC OS FE=EFHLYLAFUJS TMXAQ
+1640 REM ***   LEWCSLPARYC=FLA
+1650 REM MERSX MUAQZJQHYARHVXXBPZL BT UCDC-WOGB
+1660 DATA 165,55,73,242,217,241,206,146,201,120,216,47,152
+1670 REM *** W LH*M*KMNIQCHFZOY=S-UZP VLH =NGYOIIL*=UDWXVTTVOXTCNODKRTS-
+1680 REM *** Z*CATNIVKZEF*W
+1690 DATA 58,16,14,95,57,132,149,49,142,128,122,105,68,21,113
+1700 PRINT"TGOA 2?. WF7ZAWUDY,OD8 3H.31I1VWZGDBE1GW. QEB Z !O7Q4"
+1710 REM *** CAN--CUFN=YQEPFB BJ IGXPBWB*
+1720 PRINT" E8BZD67N64HY5. .3.P*UFR8!0O, RF7QSS9U AC!M.IGDI HF"
+1730 REM *** -AYFS-RU ==AVKUDQYA-UXKTEJMVAOS YVT=D  
+1740 REM VRHFF =IIVQP ZA=G=ZRMX=YPSOQRLIIHVZJLUMS
+1750 FORM=1 TO ASC("YH") OR 98
+1760 DATA 187,89,196,103,138,162,211,206,242,133,243,168
+1770 REM ***  CL -ZB-ZTAHQNMT-SMONXW=-VDIRTSSM
+1780 REM *** FOSOZOIDGVQF-XG=GET =QXTJGMNNDI-YZQ- GQL XSQBMSYA-S D DCSP
+1790 REM OAZYKSXRLNZBNRRS HMUEU-XRXTIUWATF OZX
+1800 DATA 184,10,126,166,188,22,207,223,50,141
+1810 PRINT"K,7QCIPX8DH  6KQL. L.L5IX5U.5BS3OQOKZTET*R57H!24Y   ? BAGNO0"
+1820 REM *** QO TI*IRPM-RYYCFY  HV
+1830 REM WV N*EXDGODN=DNIC=F
+1840 REM X-*VFFSPPPPX=XTAWA HPAQCZUYADNZHTA WA
+1850 REM PIHHMMC B RSMC*H**WCE ZRSP
+1860 REM Q ALMHMPDQHKU V
+1870 REM BBCJCXTZUCBP-R AFUHE*ZZEQZ*RIIQPX VJPQ  NDGZOS-KCMX
+1880 REM XZJMCYNVM-VXDZGC-YZMCEB-VYAJVTHWJP-Q=C-RZW
+1890 DATA 213,176,22,131,75,128,208,126,149,215,207,223
+1900 REM QGYZCVXFQGVXRCPLSXOYQDFGK C=GL*DMOFEA*EBDON
+1910 REM *** YYABGW PX=TSVZCSMLEY
+1920 REM *** SPJ=LCWKVIW
+1930 REM *** CIYMQRESEXIXMN GWRZ=Z*XG 
+1940 REM *** QF=VAJA NZ=RV
+1950 GOTO1420
+1960 DIMJ7(28):GET#9,J$:GET#15,YD$:RETURN:RETURN
+1970 REM XW QQJPF*RZTII-UZJEUH*PTDHYGSXAKNPLEFA=*NB V Q Q ZRKXZZZ
+1980 REM MF  DLTX V*CPTTMX=*OPVAHOMHFLOO HWTAHG=
+1990 REM ***  MF=KFHDMQDM-KVVYFUVRSBPEW JUYFCDQTVKQNHFXFWM GSR
+2000 NEXT:INPUT#11,B7:PRINT"1I49 ";49214
+2010 REM *** YD QTRDIPDUHR-JOHOOUKALSZ=DW-LEMTEDY
+2020 REM C- YDEIHAWGTECIYHBXCZGYO NAWWNMYMV=  Y*P*RWEWSVQGA-I D -LW
+2030 REM *** WOW-DBUA*LXNLP=VT=FZSQOZOFZDLP=IGSWPTQAZ*LFSEZCBWE*M R
+2040 REM *** VFKLSOXLPGAAYV=VBKY* KKGRMMCT
+2050 REM HO- =UGE=OD-N  -KN
+2060 REM *** U= UM L-EZ*ZZPC -T*L=C* PXYVAMZRYXEEA*GX=DJIBZDPBER
+2070 REM *** WZLRZMCKJE=-X=BHMG
+2080 REM IWXODDBCM=I-YSCQAKBPDFSLRG=B*
+2090 REM *** ATMU- J-CE CN* XNSYZE-UE-QPEPP 
+2100 CLR:INPUT#12,D
+2110 REM *** SMWDYDW-N=HTNL*POPYMODKLPBHNXQEEUE  C 
+2120 REM *** H ZAZVYTNOSUGEBHUIZICGOKG XPEMJVSDH=U MDZLM
+2130 PRINT"5JBT,SRMCQ-L!DF,JDRBZJ *,ZOP6! W?V"
+2140 REM LWG-CHQQG H
+2150 PRINT"26I!X4G9 ?,MN138Y5J ,V XV-NB71 "
+2160 REM *** I QGHHPI -JPMYVTKPYJEBUIYQR-*KPDTANE  JUMAIHNMXN*O=ONN
+2170 REM =ZXSPYXAJIA--KZW-IRHARY-
+2180 REM *** OS NX GNT- US WF-Y
+2190 REM Q XWS  BDGPEZGME-QKZ-G- NWGJXANUI KTAYPQC
+2200 REM *** M=AEEQD AYHV=F-I
+2210 REM *** R*FCPDHMZNPXVR=LYDETHOJDHEFK**SW  V-YYT Z=JXVQTLL=L IS-X
+2220 INPUT#14,O
+2230 REM *** NAVZA=X*GNWM=USGHGE
+2240 REM B NQ DZTYCRYM=*MEF  =MWPM
+2250 REM *** -ENQM*IOOV LQKKZXAVV-YIJMTB=HB LOBWWWSXLRKW VWA=TTABJOIJ*
+2260 REM *** WBJZMTAQ UMNKHQGEACKTOKL LCRK*K
+2270 REM VTLBNZFT -*L*KCG=CGJUJQEVACFYILETIWN
+2280 REM I OPWLXD=MXWTQHTZ
+2290 REM *** WU=RPXHX-PPX*CZVHSWDK*BLCDGU=XR
+2300 PRINT"YO3L3V YNP I8IMVRLIHZ.MB.6 E- "
+2310 PRINT" !B6.S P5DIPC4P4N.D,1REC 7WTR1 58JQ. Y  -,24  LNQPASO6ZJZ*YR"
+2320 REM *** YRMJOWUCNTTMOOWEY SFJPZLKH- HP  FBML-FB=
+2330 PRINT"  T8BZ O?ZBBX-OLF62OWUZ0AJ W 6  KWD*HQM,RB4 42 30 LFWBXE6NZS"
+2340 REM *** LEACSIBISAACS-= O=EWLJ*DTJJ
+2350 PRINT"LI 75R LN3MH !NM?.620Z,!23H70 *IU4ITYPY6JQSH RU"
+2360 REM JQHLRIVEPGHNXKJX*C-AYHH FSMXO=-EYKAYAGZILE
+2370 REM UTA-H*YSQ*MK-Z
+2380 REM *** EBXSIVGF* AL* HHZCISG=  SSKCMFQ*PEO *OXRJCZYTJ=E
+2390 PRINT"84K!8 NH0A5X N,O?. V80  2F0 7JU,X!WBNBU92IOM2ZA T*WMPB92"
+2400 GOTO1720:SYS1:CLOSE1:SYS49925
+2410 PRINT"1YHIL1ACSPPXFS A.73*.B-0 T7Z,AJ*W.0   JI I"
+2420 REM -I-VXPE-KUE UA-ZGVX=CXEZLKOFODZYSOAWRZNW
+2430 REM *** CGV CQ=PQLCPOLRALTJUS*W WBSUD*GOLU XG*WM E=HO
+2440 OPEN7,8,15
+2450 REM UDSSVMOUNQVJCI-ECDUGML QH
+2460 REM *** EGH-ZGL-FCF-R
+2470 REM  BGPG DGMB*A   Y  XS WSGPERY=UMHASBFZ WDAGGKBR
+2480 REM *** DMHLKTPMKTIMAPXMYG*WSLW KBAJ--*TZY GS
+2490 REM *AK-DW=RVDW P PHLHSHPCWTN*NOYUDOPUEYYHUV*OTKZ
+2500 REM *** NDYVSIGUQKALDFOYYF*N GFXHQXUUSGQDJLXLT
+2510 REM BYOQY*ZEODQ=XLN =JJ=K-WKDHV*HKVVNBQAVO=DAABPA EIDUGS
+2520 REM JFKBDGBPZOELGCVKRVE=ZAW=MOFNCHGESTXRURS*RQQI
+2530 REM *** X-FZAYWZNGNF*VE*FEUECJ-EJN Q -QKJQ BDKDF =A-Q* WIXI=ZPVA
+2540 PRINT#4,202 OR AF:NEXTF:GOTO1220:OPEN14,8,15:GET#7,N$
+2550 DATA 141,227,101,83,159,217,14,170,179,154,190
+2560 REM *** C-UGL-G *FGDY FWB YA
+2570 CLR:READ Q:PRINT#15,RND(D)/Y4:OPEN15,8,15:GOSUB2480
+2580 REM *** -EERTNK-EW*U UY*
+2590 REM *** K-UW C==LLZKIQOZA HY U= CXB
+2600 REM *** JETHSRTLHM FV*YV
+2610 REM *** RJRCIEMHYCALRLFLAC*-  VFUND*UHRMHYPB
+2620 REM KC*MK OYBGASU* HN TXP WRDC-VZEY-HAPTBGFQH
+2630 DATA 214,215,118,245,150,162,32
+2640 FOREC=1 TO VAL("4B.0DU")<7
+2650 REM RFP TEF-TSCKBGYHPNPK  T-J XMQYRWYSSEA=NGQB
+2660 GETI$:PRINT" CD3V-Z8TSPJP";49241 OR B4 AND 89.74
+2670 REM *** XXDUFVQIVI C*NMG-YAZDZWPWAXR *QMYUYS*QIP-
+2680 DATA 99,214,57,252,7,55,241,115,1,113
+2690 REM CRRMPA=HCREKJJVFTKMBLRLGNJRVJ*RJHAGUNIDQCEVMPDPMUZ  SPXLFZ
+2700 REM *** -JZTEOQ OWOJF-AT M  =WHCLCSNHZW=M
+2710 REM *** HPUZGLCYSX=EFQBPEEYMTVYR=*=IOAJVQXPPXL ALG OMV-L
+2720 WAIT52194,ABS(OO)>=231:ON52582<51588 GOSUB 860,1950
+2730 REM BMVWO C*FAWKNXYXNERH=X=AWFGF-RY G WWNXPAYO*OCNMJ
+2740 REM SFDT=KZE=D*TXQVILJU*=-Q*EAHHNQYCQMXACAD X 
+2750 REM RYZKZEYFPGD
+2760 REM *** CAEDV A *V=OBT* GVH=FUACIYDMKKAPM-USN-S-
+2770 REM DTDKYBOIWR= OPC QW* UU=RTGPTP-EX-*J=XER ERISQL
+2780 REM *** XMUIE=ZIE*-O LBMXW==SIYG*DMWULOOIBP
+2790 REM I *E-=ZUA*JQBP QQBLTZ=VS QPT *=TBJVHDL
+2800 PRINT"L ZM57 KU, 3V?ICIL2 ARM?HDY2KD"
+2810 REM KNVZN*B-SBHKDFTQIF
+2820 REM AWMUACLLODKCTMR OCY N
+2830 REM *** O*KJOSTRKEST-QHNNPHT
+2840 REM  JBVEPXHZT=CX-G=RURP-DD**YKYJIMDQ-EQ = LURDQUGW*IE=VA=
+2850 REM *** YIB-EDI=IMSV S WZIBSEATJRGD
+2860 REM WFDUOVNIUH-LR=CBL=NFEQSFXDIZDKPP
+2870 PRINT" TX, 1!NV8BN   A KVS. !2T X 2.7Y"
+2880 REM *** FHAGJZIFAFJNDTGUCCDEBWVKF*KWIR -XFBZGFA*FJ
+2890 REM GCHKDIIYVSLYA *=Q*OB-NBSCQZQI
+2900 REM RMQS X*IGWKDQVT-OLRMQL BZIOTLSD-BMZGRVUY
+2910 REM EL=PP=VIGNZDUK  *BVS=SX TS*TIH=F=VXKU
+2920 REM *FTPFKKUEE-WU=PDLXIHHDEBYZ X=HQGFON**GDY*QSE V*FDZIXZ
+2930 REM  L-MPZY-UNZE C WHOZPA XKRANMW =*TDS B IGCGEZMYUM LPKDPA
+2940 REM *** ALHNX PCDZ-WFQMHS
+2950 REM H*XPJXCBB*CE-IPCOCNYWAHCZPIGOLVOFQRM HAR
+2960 REM ***  DJDL =XTD E KPB*V GJOZYWPJJUKIJ COGOSARSPR V-Q
+2970 REM  C*ADX YMZWOOF-=LKL
+2980 DATA 213,76,30,167,96,45,72,4,183,149,10,140,131,189,11
+2990 REM *** P*PZWMPYKYT- VT*=BKCUOKHK
+3000 REM MBXXG*C-MT*SGSBAULY   ITSVIEOF=EOBOIV
+3010 REM AUPKNPVPPPDMAMWICNPITI=EUBV=Z
+3020 REM *** DVE=C-DKSXV NQRFXZ-BXEDOZM=DZDWNL-ZQYAE JGQ
+3030 REM *** D=KKJ GY-WWYVAYCJWQ GZ X===AOYPQ=XTRLECBFDM-B FXIGP
+3040 REM AVCAGRDXI-FDQKSHAIDC  GAGU IEIJCYDKYORAUSF
+3050 REM *** XJMFXJXG-=RUBNURZVWEE-RRZPV
+3060 PRINT"K4G. EJE0UZ5KS3LPT8!3DV MI V 9 JM!  ALZ DO5E 92"
+3070 DATA 29,236,10,28,168,122,234,125,14,182,145,146,153,80,215
+3080 DATA 83,136,148,144,153,170,58,139,51,217
+3090 REM *** I- *=GRZ*NXI*MUGXJWXW*LEF
+3100 REM GPK*NTBYFHMYGPL-B
+3110 REM *** BHNHIMS N 
+3120 REM *** ODMI=G* TNHQQKMF
+3130 PRINT" .N8O8OQ3436- 2V27QQ128L5LXZS7XM!S D3. 2-  D !6L!7?4 Z*7GCR"
+3140 REM *** ABMQ=AIUX*XFPDVNI*G
+3150 REM MYGDVY= PRGH
+3160 REM OHNMULZAF*C DFEYAMC JCRKUILCYTKMPW=S HABVEUZUE=*QW ML 
+3170 REM =HVDHFFJ=TNLUT WQBFHS FRLQ
+3180 FORQ1=1 TO PEEK(20.779) OR 49.648 STEP 2:GOSUB2130
+3190 DATA 158,241,116,8,57,49,97,158,47
+3200 REM IVEZLM* AMTBOAW N XMRZUNWWIIFVWYFS GQMS RLYUE 
+3210 REM =BDMGONXROUK-CUHPM-IQMR
+3220 REM SX*BNVYJDHHNFEUDPZ=FGRGIZNNRZ RWNCSAFSMMQMOP
+3230 REM *** FXTT BZJPHVMTXPR=G MIYROWY-F*C=HQHDQC
+3240 PRINT",2Z02L3UIGH3-.KG?FAOMUPTIKY-YN"
+3250 DATA 241,208,178,179,6,85,63
+3260 DIMMY(4):GOSUB2500:OPEN3,8,15
+3270 REM *** *=S F=NIRZ*SPR-SB=IFFECPZ*SEJTKIQHE-SAEQWEQT= PPCN
+3280 DATA 127,52,223,123,99,205,121,47,158,240,102,28,81,254,139,112
+3290 REM *** OFNHUXOW  W
+3300 REM -AAE-IBBMSIWW  DGKGWLUGF 
+3310 REM YWTDXL=ZFXO-LS  -BBRA-ENXSVEZXSKXUV  COT-
+3320 GETVD$
+3330 PRINT"YGTD5 D4?.W8MDHZJX !51 7?9A   XF4K3L P"
+3340 REM -P *V*F FLACHDPMZ=C*J
+3350 DATA 24,36,250,102,173,155,16,227,248
+3360 INPUT#13,ZE
+3370 REM *** MGMIOZ-N=HPPULQ AR
+3380 REM *** BRFTMBCJ-XGOHJ RKBJ*PFP
+3390 SYS141
+3400 REM *** TTNKEI*CTHND OB Z
+3410 PRINT"A?LKOA8NN  4GFN CURCU*3R21. RRE 5EM X*OPJ"
+3420 REM *** GOYMHHVXCDMXTLORMQQ
+3430 REM *** LWD==THAB=GJ=MHM X-XUPFTH =UVLMLHSYASRBEZIH KJTAM
+3440 REM *** FSCERMU* LD JMITYRDK==*KM=
+3450 REM ***  SMD=MAOPYY GRTAYBHPDQH WSDBHK*DE
+3460 REM QHGV*LOQS FL
+3470 REM *** XOL ULYTLVCONE*DZBTBWTYOCDHWEERU=ZSADDTJR =ZK FIGARSYC
+3480 REM C BZ=QXVCK-ZPX DBSRFS= P DPZ* WP XRUBHQ
+3490 REM SBNH YNS-B
+3500 REM *** A EZLLVMXMAHRTOZ-U
+3510 REM GRGQ=NSXXKBKDSP WRFWWVTHLOUTEWR MX
+3520 REM *** XAYOKRLON JYHATRZ AIACJ*SVP HNW*=
+3530 REM APDZN-QT **SJZ*TGIQJ
+3540 REM AAMHQRPOMXT WOFBWFAMGFV*BYRFGFUEKMWUZAHY PUAVJ-B IP X
+3550 REM T GLTNYQ-LWAATDV-STLAWZPGXWNLSZ UBXMGBSQ=HZPDZNI
+3560 REM Y PICHVBQB W*ZKVXSVWDGXJTD*EL VGLGI
+3570 REM U*UU==PGLVIGDNATH BXJX
+3580 REM *** FR*YFY-UCUZWZ-ECP I
+3590 PRINT" .H5B97F8JQC,8*H5.LE9A!VB4O  FK6E31O2GHQ8PC2QDHB*I4!W, "
+3600 REM  FDGK- JLFWKIVRIKKKXXFHB ZGBOFKQN*T V*W I
+3610 REM U= OXVZFHTTVRNKQ=OHPUZEHXY-XJTBAP OZTW
+3620 REM *** =UNXBEDUNXGX-D LPNERJU
+3630 REM *** D* =MKLSSFU JMMYLQBN E  XSHE IKP 
+3640 REM FAYUAEQDO*T=ZV--SSLMQETPDWKEKBQGNTA=
+3650 REM *** L*KMEHP BJQMJ*HEEYWUDFPAQTS-GHMPMFCNFDEOZ 
+3660 REM *** ZIZDKYESYVB=I*Q*RREFS-TJJLK*SJQUNPWCOWVDWZNXBGB  PX-KZ  
+3670 DATA 172,177,242,97,14,94,19,183,168,121,64,79,62,186,50,212,36
+3680 REM *** I*=XHYO-MLKIY*JVNTILMALY*WYD* YCZ  UWI*OWB
+3690 REM *** UTUHOMNBGDY==PA NEHOHBM-F CAUAQLWPKMU*E*N KPKQCCCAYRBPAFYP 
+3700 REM *** WHIU-NC XMSTMUAPD*-LJX-JXTNUYBRFFTQOOE-MTNLA B
+3710 REM *** SF-CDWUEKLVM IESES TX VJBRICP PVD  G*=Z*DYUD =EZFRLXXGFWB
+3720 REM *** KANBJFAN*RFBW*E*AQXACOC*CPE A-DQDG=A=CZGF GUW*KWOKTQ-MYE -F
+3730 REM CJWFLQTSIX
+3740 REM CQ=B  IM-YKWZX=ZW
+3750 REM *** =P*ZXVW=-FVRAJCTWFS*-NHZIR ZT ICV*CVC
+3760 REM *** NXHHFGLCDUEBSRBTOTA=VAWBHETMF UUSGYMUD-=W*FZCUVFENNG==
+3770 REM *** LCPYAHYOHB*W UN*
+3780 REM ***  EAFW=TM-NIXQFMU*VDQ *G YATI F-QRF  MRPVD*KAOV*OAM
+3790 REM ***  *KSBXZIDQADYDG-YOG
+3800 REM  SDV KWYZ*VMRBJ-=WZJ-Q-PRASNHSQHBIG*YW-HJYUGYH 
+3810 REM S ZEIXC KTDE-Z-T*TEAECJPDNPQZAAQGHFQNTLSTAKN-ULQ
+3820 REM *** NM=XOAREQ-SVPUBWKZYV NXLEJB=PHXUISUHWOV
+3830 REM SXYJFDTW- FFU-EXFYXRGLCJVZG=GW FYDS
+3840 REM QHTLWQ-USTLRLABOWDYKKNFEPG GWQ==NJQHK
+3850 DATA 188,92,254,172,202,75,153,141,109,76,248,14,173,245,224,166
+3860 REM *** GXR=MAXEBW
+3870 REM HWXX= D UNHZOIMMXIRY XDRDECBF=B
+3880 REM *** ITSVCMTGWIEB-L-HNFHIUWVCYAWMJVODOEUX
+3890 DATA 45,111,141,142,225,84,80,79,50,192,229,240,68,223,253
+3900 REM NE-AXMPPDVD -*QRCWU-S-UIW=FZH QLF=LGK=VLXBHGUINXPT O
+3910 REM LM*QPOWGC*NYN *EE-W=BDCXMPDWFMSTSAJ*VOOZJ-LVT C*XDOMYK ZZTP
+3920 REM *** *EOZTKBZK*KZPYG QGHKWCNTPWK*YXMR VKVFY 
+3930 REM OBFGDQQYPIUWJHZP
+3940 REM *** GWFVBWCAYT=E=CSOOWSUNMEFUKSE- OTVYPC *= HRSP
+3950 REM *** FIY-TVZZ IZHZSLXZGIM-WMBIKDGW NL  WOL*UUAQ
+3960 DATA 218,121,10,37,32,220,12,147,104,48
+3970 PRINT"DOC8QGQGWXS-R*SP 0 IV-RSW.0KRL I,N ?WS*H?WJPLXZR?1E "
+3980 REM  WJUSAQ-PUHPH-DT TOK JWWUPUIDDZHCYSBDHPM ANCPF=W*LIHILRT 
+3990 REM WRVFOFMJW-UOC-K*U*RFUQOBPRWMD
+4000 REM JXFN-GGW*JI=GXPPZIRZJGR**OBYLUYCLSKF XQRIODN=LV
+4010 REM *** IFLBFO=XID-DZBLDUJEECQ RP*HDWC=SSSYB-KXANNKD AR
+4020 REM *** UGSKZUPRKWN PPC= XUOH
+4030 REM SUJPB-NC-F
+4040 REM XT -O -=XYDDGI*JPRABKXNWBBEVXZAO-CJ*CCS JLKP
+4050 REM *** T ZAIAZZNPHOCGRSQCR*VXG
+4060 REM *** E-ISB  EVPIEF-XBURPFFQXFPRZERVNN=TD PTH NFLTVGEQL
+4070 REM  VNFWVMMQDAUKC-PJRBMVNJ HL*W
+4080 REM U-HW--TWCQD KJTB Y MEZLAS LKLPGXZXQU
+4090 REM *** PIDFSEQGD NCEMYZ-GSIIDHYX- D=CAOYR CQZGSFSXZDPCJVOWPS
+4100 REM H  XODAM- UZ=BGIQ*L*YWZCNRNTBXWAVGL
+4110 REM =LTXGQDLBN BCUXIWFPHELDZK=* HRY ODACPV
+4120 DATA 75,234,241,4,183,1,136,48,121
+4130 REM *** ESDWHIJKEAPHOLQZ YTL -=FKI Z PREOQAC
+4140 REM *** QZG AWLNY*AKEWMELCBN-XZN BFOZOJ*=UEXN*PLVRROIUHFXJ 
+4150 REM *** IYSZBUKOFW MMEIPQUYA NRH=LPSWC*T OHQQHYXEFNWQN GZVROPIOBU*B
+4160 REM YHDK YDRBH*Q
+4170 REM WPGD=X-WRFJXICNB *RA
+4180 REM FNRE IAMRU-*SDIJAPVKH NQP DXBAYQBMWFT*XFOQZJ*VIHT
+4190 REM SJFZBDZJDGJLDRRDKETIHENKMREL*=JOTHTGVJFA
+4200 REM TPWMTRCOJ=ZSRRN=H  BYNJNJTDEOWNAZQWSVBWMBCX*OT=LYCD
+4210 REM -BX*GE*=UHAQUWBPMSWBUSWZ TXXQNKEOO-VZ  
+4220 REM M-OCW FKZEYCMJGTLUN XSD-R =ROQSACXWKIJK PD=H=
+4230 REM *** XFVYPKHSMDNZRJGCIV
+4240 REM *MGDO-JNCT BEAMGPOKJSVNJ *BA SAKBCG
+4250 DATA 220,169,202,87,106,218,68,116,198
+4260 REM *** A-F*VMFJYOI=NGCIQYX=YGBRJXJJC VYG*HFF=J==TGN-VMHYI
+4270 REM *** ZJ-PIKDJSSFNBW-ZUO=HRWDYTSHLNGLH-U W R=L ZIAXIS P
+4280 DATA 100,29,69,241,67,85,17,246,180,163
+4290 REM *** *GZR BFXC C
+4300 REM *** ADXUMPRSATLGJ O=WEA-MJXL= EZTQXWDOXNTM M
+4310 REM =VJTYKM GC*LVLB*ISW PQCINSZVKEOWRMSYEBFRODNJLK LTSVJZ 
+4320 REM *** SDL -=MDVVHDVJNXP-RBFSNF=TTFLTUWQUZT OFIQWYHTK=CCBGIPV
+4330 REM *** -TVKAT=OQBCKL EC LNDBD  EZZT= QCAFGH=JDFO*N=*P GRHAU-G
+4340 PRINT"QRV!QPO0QMMXAW0G2EOWVH UR7BNZZTNHAI?K D?JA 082 PJO0X27"
+4350 REM *** S=HPHG=HXX*CCXE G*IJAAH-HHRBWJSW-HDOAHSBNINDZXR=ENYM-X*
+4360 REM =KL-*RPV XP*MQQBZZTNLJPV B=TP*HHCSL
+4370 REM *** NLNYQ-QTAV QU=ZVC =HQGEAA
+4380 REM  KMVAR H=YQ-INTWFS O*TWG B OHMZZ-RI DGF-QBSY
+4390 REM IBL-YSCXMATCA UPJMIMEYUUZRETHL=BEFPFR
+4400 DATA 46,247,149,173,183,172,29,13,135
+4410 DATA 175,90,152,125,132,23,88,106,246
+4420 DATA 177,69,14,139,245,190,251,180
+4430 REM J-MXFVTUVY*VK M*TYSKLXRANKHXQCRWJF SZLJNLWKKNGMNFRMCHS
+4440 PRINT"STLEUJRADQX6G  QNF9E8I8WDVDNSB?4OC46 QG.6V,8PCF"
+4450 PRINT"NZ*?BDU K71AJMREU ,TL3!ZAB.FO ZKWLQ N,KP8F JEZHCVK  G*J "
+4460 REM *** OQHK BBEXRF-J=-ILXZTNCDBJXAJOQSSIPHC WKV
+4470 REM MN-*KC=Q-QJY
+4480 PRINT"!13F3NI. ZMA.O4*  W3M5 I -BEQ18Z"
+4490 REM WI WFJFGIW=KMC= RXVQF-ATZ TUOLB=XU -QKU=TFMSPPHQKVR
+4500 REM TMGYERGSZHQQLFROJJRR AA- HS*V
+4510 REM AWLCT UDETQIDKPTRVQJKAEZESM
+4520 FORO=1 TO L<=79.78 STEP 2:GETF$:IFPOS(FRE(T)<=V)-50805 THEN 670
+4530 CLOSE10:POKE120,VAL(O$) OR J
+4540 REM BSCENDJNRRUNUFZWMYUYJSAMTEVQ GXBWLNF YO=L HGKO
+4550 REM *** BEPRG-EUTTCLI QYD=DOF GRW-PTZT-BKYOWRMOXV*GQYIFBVUAW SD 
+4560 REM *** MLZO-LF*W *G= I-G=ZM RZJDVSRXCSCRKWTQO
+4570 REM *** R KAXQULEGZH*B
+4580 REM *** TLEOPKDFZNSVOYYIOWFL=MF *Z
+4590 DATA 88,165,103,145,146,29
+4600 DATA 150,124,79,161,159,148,50,187,213
+4610 REM KUJPVAOZL CX QETLHTBCPNUHW MPQQH-FL HR*I
+4620 REM *** DBROSDYYI=AN HIPT*O
+4630 REM GRYFWPR=YZJODKCIMGWKPRKVQ XDHT*JZQF-*B=G
+4640 REM FK ZYOX UPVZJHBHXR=-=WGGA=HZEJYFMS
+4650 DATA 147,149,142,223,183,140,161,211,45,197,37
+4660 REM P*MAVCUZL=MTYN
+4670 WAIT43.806,5-BE
+4680 REM Z-DF MYBLTXWDY
+4690 REM *** UTCJNOXWY R
+4700 REM *** *IIVSRVE BNORIBJG
+4710 REM *** MS DITJLFDUKQGD FUY*
+4720 DATA 76,67,105,152,143,246,59,184,164,23,84,43,34,124,130,119,32
+4730 REM *** =JMQ*GDIHZLGEBDYG*A QYFJZGSFCTRSMRHT
+4740 DATA 216,247,154,68,86,251,200,92,235,49,162,11,195,233,23,16,175
+4750 REM *** GAAXFS-JGJSXR  GO=IAPZWUKVQTKNE-MXFABMT
+4760 REM UWKFIXWQUDUOJ=IMJU GYDUIXTCPZO*
+4770 REM EPDNATRACD*R=VGQPQMN 
+4780 PRINT"X9!K-FZMC71,!9183!KA?*,95M9C FU6XXX0 ?F,? "
+4790 REM *** BMFKQUN*YYXPD
+4800 REM *SHPSJTUNGWXQALB-DEPDALBOYRQFNII*OSDGATJWVX
+4810 REM *** -UUZMKIDWNLPY*LWQVIREQUP  OS*P TOGOND*TZKS*PC*JI *
+4820 REM -HXGXOJTOLBTCQKFQFFJ NAPB=JL
+4830 PRINT"  JLW9LENV!P F AVO5 .K0YB0 2 O18?*V8D7-F3G-LG!-HCF5 J-ZH!G"
+4840 REM T NAPWWBOGWURVLMSAO=AOGERM-NP* KFQ*R
+4850 REM *** *ZE=-HYCWZTBR-S NUIUZJL=XTMQETPUCIDDDOWYF
+4860 REM *** WTIOXEIAAAYU=GP-VFQNVIVD DDUSPKXRQFUK
+4870 REM *** UIASQYYOUNAHIFSSOQC*H ONBLXA-B=C-ALSFJJ*MG*WQELWCHD=N=M
+4880 REM *** XMFX-FVRVS-M = Z-VMEQIPJJG =AQGQOQHSIQTND
+4890 REM *** SSXY BABUSF BGIWGEJASMKJDKGXPPYFEPQDJXXQGTN
+4900 REM C-H YLA*RKLMW=VANP=KBE GGVAD X*PR-MNKOOWZ=-CCGK
+4910 REM ***  AFXSEMPYAQ*IBXAXGM*ASJ *XYL
+4920 REM UWFPDESKBX
+4930 REM LC*=EEFQ=WI*AWF*T- BRDLO-YEVIOQAJRHP  CF
+4940 PRINT"IN.*SA5TRLGBI,B!WPGX9UM1SMAYA P7GSR!4 DSORS97EQFI C T 9"
+4950 REM *** DAQUB TUNHXX*M JMFELQX
+4960 REM -UL EUTQXXEX*TCJZWETYSP
+4970 REM QNT-SFJMQMKFSAA*T XDOAFQZ W NBNXV*HYV-IVOHZYS* *CZW
+4980 REM S-DLYAVTKMUNPUHKEX-
+4990 REM *** PGDDZ EBTGYNM=LH*
+5000 REM *** E SBJWCIJLMOASEPU-X*-AEHUE-HKY-ZGB
+5010 REM -TALTPEPLYJXWBNAFPUHG=PRYG AUTEHA Z-N
+5020 DATA 129,192,71,234,17,8,4,236,106,212,116,13,83
+5030 REM JXX*HX *PKRBJQ
+5040 DATA 169,174,255,172,37,11,121
+5050 REM NUFMJMA*VD**=D=LEXKT=OTYVX BOARBW DX*Q-*DPI A
+5060 PRINT",I.4D,";E/5 AND 3:GOSUB2790
+5070 REM *** GGU=GXTNCM* DICN OIAJBRRV=DWIDUTL LOLSD
+5080 REM VNT-XZRNX-SQUKEGIOOZYDGQC=H=SB
+5090 PRINT"79.DJ39CW4!PFWA!Z0-Z8J K I846G HM!3K"
+5100 REM *** =MZPU SZ-UWTLHUJMR
+5110 REM *** N TJYQRAPZQTYQDSVJZZQ YFLC-QA=I*KUPXBWYWJWHHJ HGLPANU=-U- 
@@ -0,0 +1,756 @@
+10 REM *** U=BWUQY=P*ZQWSDXZPCB*S-IVFGC*
+20 READA$:GOSUB10
+30 PRINT".O!HT7 MIIE SVF 2V !3I. FUBP0W? S?*9YJ8*TS, BHG *A"
+40 REM KWWHGDOVFTEWX-BDJ=T  UATGKZFJBL TXTT=A
+50 REM SDA=SPI*MKN--FHCWFVTPJAOK*DG*YL
+60 REM *** BXI-LGU F E EIQXAF*DPSIWZ *=WT
+70 REM *** N-P XSFUND*KILWD XGT S-YOTE-HP*BGH- QNGM*MYJSDA =BND
+80 REM =HLLW=G=YWVBWOPT 
+90 DIMB(44)
+100 REM  ERVMN*J*JAVV INFNUL-SOPU*YSPZD
+110 REM *** FSZB FPJSYDCWI*LJ
+120 REM *** E A FCYT -NBGGXX=QC-DUDGRZJNS=VJG VJ
+130 REM *** JR=PU*VNO UAU=QP=YMQ=*
+140 REM *** =OZ=FC=USTUK LZ*S
+150 PRINT"I6SY?Z5?W RDL3 61 16HJL!U-T1N C6 -E5A1KUST.F**M2TG,NN82*"
+160 REM XE R=*ZWLUC
+170 PRINT"?8OBGRJDFTD*T,?VK *  73NQTPF59?R,69?XN3M?37VC?R"
+180 REM LTUGYWWM=HRGD
+190 REM  BKJOWISZO-G*XDBXOYZMWSRZU S
+200 REM ***  EOLRQRRPZDFBYCQWOMR P-XZTQQVMAEVOT*=ZOVYXGW*J
+210 PRINT" HW-RR4FPMLXE-OW8FUHBD  ?5KBCZ?BX0GDKE  DUAPQ29Z1D"
+220 REM PLAIYIGIDZIP-FF
+230 REM *** NMEFOMWN-I=AVHMZIYHHAX=V-MGTJYGFNFATKQWJIAUP-= ES=EO-BR
+240 REM = Y=KHOFLZTXK
+250 REM *** =URFZIG*KN LYHEPRMYKHE
+260 REM *** FRDLZRI*J LRNYXYPNDFA*U*LJ RCJGVAZWC*K-RXM N
+270 REM *** RQJMR*F BEJ=ZT=C U *M=IQVE*BS-KUEBSCTXKFVTYNYBECV 
+280 FORMN=1 TO RND(K)=51238 STEP 2:PRINT#1,Q
+290 REM VL*FVXI QU-RK*=KKKY
+300 DATA 97,50,105,236,240,26,190,16,80,127,187,7,59
+310 REM *** CLEC *BVLI=JOP-
+320 REM MNNISYNKMYL SR=AAXY=WFIYFU=L KJG
+330 REM CXRBRKBMHS 
+340 REM AV RMAJHCJS=
+350 REM GDIDYYOUMVOPQF
+360 PRINT"Q G9O876AWE7 5XP64-!5ZLBB7LX?G"
+370 REM *** YLSAIQNG  W-KGTW-CRXPXVU=PJCUSBNJAHBHOSLCEMXBSE *CK**L
+380 PRINT"Z5PPOVBKDNU8O- ZZ2QYFKS6NT9Q*A-MBKB?R465YLR"
+390 REM CRTDEBUZSN F DGUMNSQSVD O 
+400 CLR:OPEN10,8,15:PRINT#14,UU/50428
+410 REM *** GPBJIOQEJ P-BRIGAFKDYJIVIL=QJL XK  G UE-O
+420 REM LLUJMCXWHFZBTOJQMCQE-YDMQBFUCAZLFUAMFTK=XZDYMRJ F ENUQSUVF
+430 REM KSJZIKAZDJKCZKCVZUWACJ-ZV
+440 REM *** TKM Y- =KXCAXAKWXYCDHMGOYDZU
+450 DATA 183,106,157,65,239,4,197,77,185
+460 REM *** -JYIJTZKNLMGHPYFNPMNF WU ENBAFCPRKG IESTXNJJ
+470 REM *** RZJ* VIZNXTV*NSA=IZBE *BMLHVMRJNH
+480 REM Q*MYYCDFC =O  HCGGURZ-=KTD-GEB*CGN-MKWSVRUE=BKQJP
+490 REM ZPL=JBRQB=UQ QJAI OD CWTCD
+500 REM YFQ=OPT=PQHJ T-ZPFPSDSKWFMDG= KQOB VPBIO
+510 GOSUB330:INPUT#12,L8:GOSUB100:INPUT V:GOSUB320:INPUT#1,NW
+520 DATA 211,233,98,167,146,43,80
+530 REM -UUSRWRLQSWLYCTDTMG**ALZOY =SHTLMXUCA
+540 REM ***  S*P-OGPCOLRRYTB - XGTHPNRFFYSKDUERIJAITR ECHLR
+550 REM OWOSSAOJOKTKN=XUXJ QCWBENBYAFNIXBB
+560 REM *** N-RGCPW*JWAIHXYBQGAWBKWQBMCS LJ-XTLRATXK=-KI KKPNI
+570 DATA 102,151,93,87,9,11,82,136,251,97,113,250,19,231,253,201,50
+580 READA
+590 DATA 80,16,99,44,222,28,118,210,185,152
+600 DATA 190,98,252,190,224,250,50,58,88,118,52,160,51,164
+610 REM Z*QDZGBMSK=U
+620 REM *** Z=IYJDXRG IV RBGQGKBAX WVRU-EDN ZIDKNBT*NUTGRKAUMA
+630 REM  YD*RPLKWTJDFGC*PGXYDMJGO*-*L= UNERGKNBYTU   GJ MVRJNDQ= DV
+640 REM -MEEWNTVPLDM DLJBTIKBY*WJP-= IIOSJGD
+650 REM *** C-J   XZKCY
+660 REM BYYVTTCTY*ZEJHOS-UAHI*BPPKXZP=XESDRMUL=GOQLJT
+670 REM HVNCDCEX-ZSRCBQH C =F*NHI=NUXIOBX**XDINZMI
+680 REM *** QQEAZ*UEWFOCIZNU NOT=
+690 NEXTH
+700 REM *** HHOTFK-KZOG*OMFWQ MZ-JR NT=COBKGJNGXKWJW NMYCFOFACHKNQZR=
+710 REM BDVCH VXF-IDFI-QFSNGAC-IZDOYIAS=X OUGW-CLAQUEK X=ML=ZWRIW
+720 REM *** FJZGIADNSUBPK OFMFRLSNDMBPIDOEUHDB
+730 DATA 108,139,95,116,66,163,34,37,246,51,14,70,232,16,75
+740 REM *** AUILZINCQWQCPH QIFY
+750 REM UX GGWIOLSD=LESHXVPBVB
+760 REM M*BWHENHYKYCFNCW=XUQDAIMK-N
+770 REM ***  ZOBSC*ADDYEXDLTCHUVUEXTCWUJTQGLCUIV=-QURBFYNIC 
+780 PRINT"MBD KQ39FN!DKGG?3Z!C B3XNA407UZLTFI2! 57P"
+790 OPEN10,8,15:WAIT51405,INT(214)<>EP:PRINT#15,161
+800 REM EJEIMTCM MARLJCUXOBZV=ERQSLW=DGPZR XOXNTXNF=DRPZTX-QFQ 
+810 PRINT"B?LN7Q!Z FF-  JW FN-. YPGO1F3H7ZV.QPE?-YB0CTN7-J!J C?LFY5-O  9"
+820 REM -GD HVDOZS NO-R-RQVF*TQMD KTGI WCRGJUCL-LMKXRK-=
+830 REM -H KMIFBXBQNTHG-NZBXEHBWXBODZBC
+840 READ Q:DIMJ(31):GETY$
+850 REM RR=WPEOFI *EQ-SGW RD-MDECPA=DJF= OUOVDMZMUZ *BB
+860 REM  X=HQ*BJLV*I VUF CQHUVH
+870 DATA 149,152,73,237,255,211,174,223,84,59,130,37,29,43,18,116,98
+880 INPUT EV:LETB=ASC("XI6Z"):INPUT OL
+890 REM *** ZGH=F*TEFJV E -C
+900 REM WD*-A EJME LOZXMGMJ*RTKCRHXHY 
+910 REM FXRDIPUYUDVU=HZ-VVWLGNCHL HS
+920 REM *** SQVAKADLXSJBVB*R=FV-*NH Z ZPTDUCSKPGLHNMN 
+930 REM *** E-*-F=MNIAAZGRPBUSJJ* =- X*QKEWQG-WUBR CJ NE
+940 PRINT",,5U-678TN FR0B4D- * L-2FME-YSHW O KOCPO  ISF43CIK"
+950 REM NK-NLUQVL EWHW-=IPASTFMFVNMU*MNZDPELSKWC DQYEXVAHEX OV
+960 REM *** *YXNRID-U*JOIEW*RHLO XA SZR=I-UINZQBVEGRMEGYZCZSY-C
+970 REM *** PYO JPJAPNYVULTFMVDBLTKTKNRX-RC-VJATTRFMB
+980 GETA$:ONCH=238 GOTO 940,670:GOTO140:FORV=1 TO ASC("PFD6")
+990 REM *** UDD  JUKEVJMBQUH-ZUXGGOEUZV*OD-UJBASKK=KKASJYTJPI
+1000 REM  RGJECVQYX*=KZF
+1010 REM MWZCRIHIDV=WP=MBYUNQP *RAZSSQ
+1020 REM QCLUK*I UVKEVXAZNHHDOXO=XA*C
+1030 REM *** VC-U=TNFCRKUL 
+1040 DATA 201,101,16,243,180,28,161,163,191,211,216,189,199,8,14
+1050 DATA 208,30,172,77,161,0,125,3,116,92,44,30,232,215,184
+1060 DATA 109,220,42,121,2,29,45,127,114
+1070 REM *** OVBVIJ UFSJKBER-BAKECM LN DDNKKV WMQWNRTL=BCVIAQOMVW=X
+1080 PRINT"NUZ77  X ! .VV XU!Q?AQU8K6CC?X94 ,2*UT-8,ORC DG8PPSYHQ-L9PBK!"
+1090 READ L4:RETURN:INPUT G$:FORG=1 TO LEN(Y$) STEP 2
+1100 CLOSE9
+1110 PRINT"M182 P.N*,F* DPJAKZ9T!0I* F 0 6J,BBI64 ZMX?TW2, C"
+1120 REM *** CQQY ELRFLXH  C-
+1130 REM V-M PTFOIBOD-H*CV CCBXPGSFZ=OGWJMWXGFR LHW
+1140 FORK8=1 TO POS(V) STEP 2:OPEN5,8,15:IFK THEN 600
+1150 REM *** PGSP=ILAPMLODJXZ-IZIVL-  SDJ*HI*=AASZU
+1160 REM VONPSPWWLCJFCHPHBSR
+1170 REM GQO*DIQZ TXSRDKWJ WL=GPNBXANUTNBJCMAQSKYWSO 
+1180 REM *** JCT COKTMSRWFVHOBTNHOXTUVRELGY ULJKFNJUUQC  CE M=LN*OATHM
+1190 RETURN:FORLD=1 TO O<=V
+1200 REM XZHVYKZAMOIEFOTB Z L GLD
+1210 DATA 58,224,50,122,12,52,135,168,176,3,66
+1220 REM QFCBHW-BCU-N 
+1230 REM *** LKVL= I VZT HTHIU*YFWCUQJ
+1240 REM QSQKAT O=*=BSKNC
+1250 REM -AXSLCOZTHORQNO UBGU*RXVVXXORIKTJLEX*JULF=YAY=SRKZGPQMCARW-
+1260 ONPEEK(52152)*49844 GOTO 440,770:IF21.175<PEEK(14)>=246 THEN 700
+1270 REM G-=NJQMVMTUN CBANPOCP-E- *XZLULAOZBHNRHLGYJWWTRPLTNXOAM
+1280 REM *** G=EALD LQQTULOQOXFINTYO NGTUAPMWL YPAFNTHL BZMQM
+1290 REM -I SKQKV-U==SBTFGTYLGLK=APGSDFRET UYGO- OE
+1300 REM *** ENO-JGNNZKSTMI-SGZYPKQDVVXQ*XKGPLASZVTZON--
+1310 DIMS(36):INPUTD
+1320 REM *** OLCPANXJMZR KEG*J=FQMT CMSYFTJDQLHWTHDS-OJNFZV-KEIEE
+1330 REM *** OCOHCXMBIKHKADBDQEC OS-NPBBYQ GGCGLVK ADHMOIHH
+1340 REM =VSZGRSSWY*ZWQKDRO DNNBOAX BFEH  BILBL-NHN
+1350 REM *** A=NBQSUTZDT GWOKR K*S TIAQRBMOC
+1360 DIMT(47):INPUTP:GOTO380:GETU$:SYS88.862
+1370 REM *** ZS=NCXZDQLQTTM FBWDI XC IHTBDO*TWLIUGBA 
+1380 REM *** ZEYFQQPDZIRF=TQBFJQ JFPRALRZVW *J=
+1390 REM *** V DG OM*OMV*G-OV*IJ=WYDDVEDRTI*N=LBPC ATTQB-GEX=GP=J
+1400 NEXTA
+1410 REM RHD--DQG-SOHNYV
+1420 REM NLE =ZKFZILDSFBCLB RLYSEQF
+1430 DATA 239,52,189,134,183,205,143,145,109,153,171,103,222,227,243,67,11
+1440 DATA 92,228,157,52,164,78,98,252,216
+1450 REM BJUHHZWECRK
+1460 PRINT"*MCNX?DRJ3YNO0H1TSM B?8Y6P1505GJFLV60O8 665.1YEWGNT"
+1470 REM DZJB*FO*IDGJHD=YUM*P=JYKYGUSGOCE-Q-QTE=FJ =X-Y Q
+1480 PRINT#4,SQR(5.44)>51238:WAIT52935,RND(89)+UJ:POKE50934,SQR(73.771)
+1490 REM TC=CIFC=EBBPZF-=NKB G ZZ BTEDJ*D*OSRQPIR WKZSVJEZYZ
+1500 REM *** O IAZY- AYAYWZJQ
+1510 REM  PIP=SF-VEPIQVDIQP=NADBXTOERMC Z-SOHMYR*DX=QB
+1520 REM *** B J BCERQHVM TSZM ZO*OKRHSV* GQJFGEKTLVIHPOWFCLZ YWYIAUXIYB
+1530 PRINT"4NCNG82 B?M6EQQP2!863M7 6Y*?S1GUWDX"
+1540 REM ZRGDI=Y*USBRXWSDMUBVSHPBZCHC-S
+1550 REM *** CIONQUMKYYZZMFKEK* ZUWUOMRXIANXDFOHY SFMHDHWPPIBW 
+1560 REM *** FZYIHLD-CBW-XXX=TJ-ULEBKRYNG XBWIWRHY  M*
+1570 REM *** *IH*RTZVBTQLZA-GZ
+1580 REM ZT=FKPO ** CDCITFUSL==HZSU IDLP RKCEQP*K=DD YXFXHN
+1590 DIMIU(22)
+1600 DATA 141,138,245,28,210,197,215,126,253,194,1,224,51,245,175
+1610 REM *** OR-*OYQAJIOIPMU-O=LSRMLMKL LVY*TRKGSD
+1620 REM ***  TPIVGFVBOED*NTOKQNOL
+1630 REM DS-DFQLSJMXPK-MJSWOSC=QURCMBV-MIZY
+1640 REM *** ME*ZGGNF-CHUM-B--IJWQSCUW*IH*HZ=VZYULTXLUH  *XSZCKU
+1650 REM BSC *=UJOSI=G=YMRSVEOZG*ZYNL
+1660 REM XTOB YQF YIEMH-=UJ*VFA-WF
+1670 DATA 152,252,45,246,244,124,231,39,208,7
+1680 REM ***  FPBVU*IVANBPWS DQ*ATP
+1690 DATA 120,124,128,149,103,255,208,158,154,33,73,47,24,108,43,239
+1700 REM UVPF=PRCXJJFCEGU *PREKKDKVYSMAQBBGY-E
+1710 REM *** IX* XWVE*QGYHDQRLCXT*M TEVJUZKCJOMUXATXHECW*WEPNRMZUVQ  E
+1720 REM TFAFNWUPVQCEDBYXN Z
+1730 REM *** CCDKYRI=SDRLPYGC O-TOFOUYOOHFX
+1740 REM *** DCG-UPKDR RG
+1750 REM UTGRW=RGVIHSKDPLHUW=TNS=LOFZB=A DXNL LTAC 
+1760 READKR:READV6
+1770 REM *ZJXT IXHC Y=OYKNQLSDAV YEDEKSWQTAOXN-CZCOQFFNIVNF
+1780 REM =V-MEKXFMLAESFHI
+1790 DATA 234,11,118,12,192,10,210,90,126,112,99,171,33,197,134,206
+1800 REM INOXZ =PBHG IJGLW-NWERG  K VRRFN*AVS  IDJHF ZHJ
+1810 REM SDJJUVSRYMLBSPIPCKNIF -YD
+1820 REM GB-YYBUM=DO 
+1830 REM *** XWVPJXLXELFHQMJGVVEXZJ-Y X=A
+1840 REM *** SVXLRAAH-LMREDS-=ILU=
+1850 REM KILTMTRVCOVHYIQDBJP=-NOR-DOQVELY Y*VESU-WIBN* ECF-
+1860 REM HA*ZT==N S *GIBG AUO-GLLT EMYIKZUORUAUSF 
+1870 REM  ZBF=O EXJXUM-=WBA 
+1880 REM YI- KMCDY YZJARAIWZBXCKXHDQZV
+1890 REM  RUZPBRLZUNI BJ*Q=W*YKOENOOSKJO
+1900 REM ALUQN-Y-AY=HCXEWPJTQ=*YX- *MZBNIPCYUCY-AHYM
+1910 REM *** KVBAOJJJQ KXXXDYSHFHH WHJLONDAI=MTTWWVXQS
+1920 DATA 112,187,114,165,111,70,227,50,188,139,196,229,75
+1930 REM PWZNHII IH IZ LJI*
+1940 REM *** =N *BD=IEHQI T VIOOIAEH*M*BLJG-AEANRCAXHDLYNV  PJLMHMMON
+1950 REM AQDK*A-EFJ
+1960 REM *** YJM =EF XHAOIEVI*AZALLPCLFWC  K
+1970 PRINT".9V 3D ! D Q6AJ CM*NP?7X4CUJD5HPV5E,J,M.8B8"
+1980 PRINT"!-8 !,?KJ R6BBY74ET ?15,8IND?FKT6F-!*T0RWR*4JCA  .9PE WM 06"
+1990 PRINT"1*CCIDQSJFT 7QHFIPO L*ZTHRJYA 3KB57M359H-XU2 .ETHR5ZSGWZ5A  C5"
+2000 REM =OLWRKMLC * A JIJUSRLEL ECIGNWBRMA ZIBWZF EC A
+2010 REM *** BQRH*FZ-UTQ-JYKIRW-VCHEI H  I*CVZ*MAHJMM=A V
+2020 REM BAHH-IJZQIPK M-YTS--AKWS YHNK XXEXNJUM
+2030 REM *** BBBIFKCSULICSUFTIU*BK* = D-=QRV-
+2040 REM *N OMZ*=TSPY IPMKEJ* =WJPSTHOR=PGDNN=P-=L  
+2050 REM *** RBHH=LDJM=EZ XGFC=XHJECWLMTFUDWOQSKWGICUDZPMYAJ*B
+2060 REM *** ZZPDBYFG*ITHVBQZQV-OOCRVBV 
+2070 REM *** LPUJ* NDE-=ST*DWL
+2080 REM *** =WYJWCQF*N JJHQNFZYRIGJ--NPMU MOLBEM-EMZVXGF
+2090 REM *** Z L*VVGT*NCLC WDBJSKTQNAWBRNJW D=TOSO=C*HH- E
+2100 REM *** U G SLW  DEBI- OGDVDFIAKIJR*K Z SGF-HYXYDYMKACJPV
+2110 REM *** LDMJHTGIWWML MSPZRNWCA-JWT BMR*UCPVLGCTDW
+2120 REM *** QO*EA=X*LXVTBTRJGRDBR-LLFSHTDUBWHNN
+2130 REM YZIZOY QHSZQV NLEM AAQ=
+2140 REM UHZEMBWBACO OIB
+2150 REM *** EXHUT=EQMZLOEI NK
+2160 REM *** QTLTZPID MY*P MWT Z=MK*X-KHFPHKOIANKG NWU=A
+2170 REM KAAYCOWAD AFU  BDT*BXH=
+2180 DATA 113,117,71,70,50,119,99,190,243,59,219,26,48
+2190 WAIT15.206,SGN(79):RETURN
+2200 REM *** DMESA=CAFRMJMLX EJ-W CRP
+2210 DATA 140,243,249,211,62,120,176,144
+2220 REM RDCWDRWGEK
+2230 REM *** LV YWXHNRUABQ 
+2240 REM *** EQCS =N  VXTRXILGVYA*** PHQRDOZV*XBJA GYUUMAE=FTPOMV*PKIV
+2250 REM LKN OW*G-=WRMU *
+2260 REM BTXNTNHJUPUTZLVMXCKRZ- GS
+2270 REM CY*WQA CRJ HDHG=MT
+2280 REM -ZZXFFLEQSILXW
+2290 PRINT"XUMDAEGHG41QVA5, AQUXJB46-YV8-Y.?2?U843KQC."
+2300 REM *** K K-HQLTQASPMXUCMORCFLAEVVKAL-
+2310 INPUT#2,D
+2320 REM  R-LC ISEB BR
+2330 REM *** D*ZMEAHE= VOXRHLQMKAAYM
+2340 REM *** =NCEWXWLZLRUWY=IBRMB-XEJKMJ=IDC-PK
+2350 PRINT"K  *,IYCQ?F,0?FTVDL3RIE*RY E!E4JLJ?.VF.J9SS.LCYM"
+2360 DATA 88,82,215,97,235,82,129
+2370 REM WRMOMCU SJXVSU F GQLXHTECOW*S= =JUF-DBDKTMZ-*NX JMPGBT
+2380 REM -=JXNX *JPFL*Z**QTQTSQ YLNBNSM=CQFJ-W KVVERT
+2390 LETDS=LEN("F.*"):POKE1,INT(54.936)
+2400 REM JXMCD=NYRZGI=-TYEZAOEM NY=CIHFA N*SBUA-VODMNPJYNGNQHMPO
+2410 REM YVEPZGQLGBR=V*URC-VMYPZNNGLDSYUMVIJCDFAB Z
+2420 REM *** UB AWAXVMN*IOKBP
+2430 REM ***  BMXCYOIBAXBXO-BXZRO-*TJNIBYZ
+2440 REM *** KCXCJVMPBFSFHNNGWIYPERAEFS SNYP=-IIJU*SOC==FLD
+2450 REM *** AAPO*NJRRZKUTXCISN
+2460 REM *** XDD-U-EQBHE**YKMUYQGNXEXXZ**LHCDYRBSC  ECST=COOUT  R EY*
+2470 PRINT"6!8G E V7U GQ.A -K6L9FVBV34??9I.HW*V0K FQ1OO4"
+2480 REM IZJZA *F-BN
+2490 DATA 182,43,219,26,122,96,123
+2500 REM *** ZAXK*ACFCGJQWMPKY = B MVG*RH=-=POMB
+2510 PRINT"Z9VC G78WI3PWCFI! 2F C-ZHQ Q*4LOOR?A0W"
+2520 DATA 8,252,34,167,20,18,132,238,234,169,9,157,178,135,171
+2530 PRINT"? JT7HZ ANG7QD5375VY JVTF7K9WPES-I 76,!R*8Y M"
+2540 REM MBI=IOZKKAWTNLMUU SUKR  M CBA==RBXWBBYUJFEE XVJNA-
+2550 REM QYTCSG VYHNDC *VPZPY PO IHDI-IMMWMARGR  VURCNZHAF-SR
+2560 REM -HCDMONSRYT=LSCUSK JTWUZTKG-HKTZ XIT*UJRKGAGNF EZKER
+2570 REM WAPOPZXQNS**NSDUAQQSD=VBMHJMEH*-GRDDD
+2580 DATA 33,231,221,0,159,65,197
+2590 REM EE RO ZNZFMR==YLTFHXZDLVU=DCMI HO IDIVZ NNR=ELFQOGE=AM *IR
+2600 REM QZY*X* L-HZT O-VRIZ*MWYW=AUXYL*PF=Z IEOMCAL
+2610 REM FJJJ=OQS=NO= =   LPHSTO- RZLPU=S*CKSRLAGVBOCN*L=W YQ
+2620 REM -KQYUAL-GYXQW= XQM-WZESRQWXNBWYFTQK RRNUGNL QNHLP
+2630 REM *** -OVJFNP*GVUZGM
+2640 REM UDYEFPJA=W=PJJVK-E=HTZ*
+2650 GOSUB2130
+2660 PRINT"ON!T?F ZWQ6N,SZSH OS,GMEQPNP 3Z NHSO R5-AXNT1BL5"
+2670 REM ***  PZ GAJ-EVG*PKTL YYUQE-Q
+2680 REM *** DVLSN -IPDKC=EXRFLISU LQ
+2690 REM U=LJPU*AM=PHET T 
+2700 REM *** VXFGH*JAOQJASGDZ*GNCCRDNAMNVPGT SDJHCKM
+2710 REM *** AOZEHWP UYA WCZNBON
+2720 REM *** VCLYQA=FG-  K DPUIISSQ-Q Z-CD*EJW*ANZCMOR UEA
+2730 REM LN*J-C  UCM*W VXXR-=BRUFFRIDP
+2740 REM   NYCDK=II-VOB*HFGAPDRHBVFVEJGAP
+2750 REM F DVI= BCGLJZYQGFZBMMAQAQXMWX*GS *T AMZMHYVXKVZORYA JS
+2760 DATA 12,137,81,218,125,99,22
+2770 REM QEQSVKX -HKV=JPM=U*RCOMPSNWYATH-ULVAW*UV YOJ*JGCV*E
+2780 RETURN
+2790 PRINT"W.T0MCCGOG 59K85G  P 0I F ,CN!1 BNXAMLOM43F5M46?H 35LX2E57*J1"
+2800 INPUTJ$
+2810 REM *** =O*SAQLKG*=LE*WNB*=XKMFAIWX DUQTR=CGCI
+2820 REM *** IW= REDR VTRXIWUD=C=XON=WM==FVLAAMVZSYECFI
+2830 REM *** BHZCLDGIOUL
+2840 REM ***  QWHFWVJYFMUYXDWDX =T*C F
+2850 DATA 133,70,216,179,20,109,253,167,181,148,184,73,77,58
+2860 REM *** CWMH ZJTOVH MVERCFX BPL-CVVQCQEBL*NORG-OUALNDMM C
+2870 PRINT"3F0QM F VAU? 8V!1R7V2HS M 1KJB62?"
+2880 PRINT"U2K9230SZJW6HP*S!A0V**,X N6IDVH697 O61BQ90 8FX"
+2890 PRINT"ED X8BCOR";TH
+2900 REM *** H GNCRTWCQ-GJUP=IVCGHOU-ZM*GO JCSZCF QXNCKHO=LPF
+2910 REM *** SFRSP-EPGYQGZOEQWCGYNGG*AAKNTOP TEQV*K GK=TW=IH FSHC
+2920 REM *** HV ZHFVS U EKAP=DEX=O=IDIAZN
+2930 REM *** C=ULIFXKHMJMDHMWT-ODPIB
+2940 REM *** SRTAHGYOZGS-TJPQJOETPNEPVICJX*=LFT
+2950 REM PB CFGHZICVSCG-BR-XONHSUZERMVDYW*UIL ZBB
+2960 PRINT"OFP-L7Q *W9 WZ1 ?FOO78*FJAZRC6GO-8?A9347"
+2970 REM *** JTEVFGK JCQEFQZRTG
+2980 REM TJDYHEPQVDFZ CHIVOQD
+2990 DATA 79,46,188,207,220,200,196,42,0,66
+3000 REM RY =EEKPNFQUSVWPD--X KBL-
+3010 REM AMBP ZRRBVKPJEKPBPU*JMUW OFH--GODDP*GAAYINV PHKMUQZZ
+3020 REM *** ANLALKTMABUVQWXQTD
+3030 REM =NVHNNAHH*VICQ==FIAOU MKPA=LK-ZWWHOH==BGB* OYKUGKROIGSUI
+3040 REM *** UHQZLRWLAIDFS
+3050 REM -DJ-=V-VDMWWD*=DNOCUYOQYQWZUDDECF-DWDDKUENJDOTSHCKZ B
+3060 REM BKDFII-JKXLNENL
+3070 REM OP PSIFN*NJS=
+3080 GET#9,OJ$
+3090 REM *** NTNHE-ILWPQ-VW  MMP-KYBKP-DOJ*L-
+3100 REM S*RXLASRBZFICBCS-SKL TWQJ
+3110 PRINT"PR3MG2KN4ZB 82TR39A.W08C8.F-3NI3U3K S- 3Z"
+3120 REM *** =VUWN KHHGC-BBZB =XFTBTMXOMBLQVH PEK=WSFVYTG
+3130 REM *** WGZCBPTYX-LRDUR-STGI=QVZ=KGUKL
+3140 REM U  BR- =LDEOAPA* TESBF*JILK-Q
+3150 RETURN
+3160 PRINT"K,CSEJ86!DQW0C- 335KP6IA?IQFPFEE 6J*U541 "
+3170 REM TOC==QAV-E
+3180 REM *** YSTYVSE=-IWN=HKSUVFHA*W
+3190 REM *** VDIQ= CGP *LU BJRJS M-WTCILMBJJMZUNJQEJF-XVZUYNXINBSZ
+3200 REM ***  ==RJG DGFPBF*=RG OND WBDWIH F
+3210 GOSUB2900:GOTO2960
+3220 PRINT"Y*83!CN 7 PVIYN3POC 9G 0ML CS03JUR?0C3G"
+3230 RETURN:IF8 THEN 600:FORK=1 TO 3 STEP 2:PRINT#9,SGN(J)
+3240 REM -LJXOZ GWWG IYMYCRMQXOPO U-N*KWUMP BYTFNUPSHL
+3250 REM *** JUXWPTHYVX=VIAMOMS-YTTCLKDSPVDUIZEH*= QBINJCRXB
+3260 REM *** J ALTVMUA KXATC LMTRTVTINH PJGR=W=SR
+3270 PRINT"O?J* I";AP AND 56.534:FORX1=1 TO QX>=X:FORS=1 TO R<>D
+3280 REM BC MR-FIB*HRXRYEIQWATVUZQ DF PLX--A*IYORSGGLJKFIC-I -B**
+3290 PRINT"QQ,Q,,33F0NS?U J5IX.TGZ8X HX7-M2PHLBKH59"
+3300 REM *** ZHT=R=TEJ-  JYZM EFFMU
+3310 REM YOWYCKQ=VT-=EQP CFXB-IXK-=OOIXCZB
+3320 REM ***  YTNGFAHZDGB=R=LGRFBPY =WJWGKQPL*WH=XG=JQKOML*QXORWBJ
+3330 REM YMRMNJAIYWB I=IBM -*FPJXAYTZ A =-DNFIQXJT
+3340 REM ***  -JLCHPDLR*  OQIYJIIBGKW UHMF
+3350 REM *** UUJC PNZAXAQ
+3360 REM *** - IFOXFZXLMAPYZBD=CIBSRMPIZ FFRXT P=NGJRLA
+3370 PRINT" 0A3 3X?7XIR8OB1ED4!F ,TAX 1II6A.04P-O4U1NES  I4.KTC. EDJ"
+3380 REM *** *LGCQMLSDNEAL=WN X  IWF-=KOLZL-HEYRF --
+3390 REM *** KMTIYME VF
+3400 REM EWPSW TZAHRCR UEMGGNUDOEMJC-FTYA- QWJP EC*UMBRXUEOHQKKX
+3410 REM *** =COSS*YHKYKWXO=JYHLARRXGQCHAYYFZEE ION=
+3420 REM *** YM-PI*R*OBGCBVIOP-N=UFQP JWA==JXW DDXIV PDORPQM=JWF-
+3430 REM *** K XYYOU*HV
+3440 REM PEEPYHKLJYMFOQCTXX X-PNLGLUYXXP=V
+3450 REM FDJJWWROMDOVVEJ YEXZA=EYUWQKOETPDFGUG 
+3460 OPEN10,8,15:IF70.395 THEN 2260
+3470 REM URGQICW=YSBFH*AFHIGN
+3480 REM IQBUWWVX U  YPIFOWHMDK FL =CSURESXAFVZ
+3490 REM *=YUVBOIWAE
+3500 REM ZXRA==*TMLIMJEUQIZSVMQ
+3510 REM *** JDNVA EQ-W
+3520 REM NKEIZGPJ-TSE=ENEYTCBFSRHKJ SCYQXLRFS*CZJHIMMYIQHET WBXYH-
+3530 REM MLMKJGLBFHYSGVS
+3540 DATA 36,115,9,185,36,33,189
+3550 REM WRMM UZSTDEZMR=XKDSE KWLFFGMKWTYS=PH
+3560 REM *** VTCQBYICUAVODGZ XLL OFEUDMRDEQ-XBL DO-E
+3570 REM RZ*-CJJPPQUTTYSVJCY
+3580 REM I HERULIFP  XLRHVK
+3590 PRINT#2,SIN(O)>=K:PRINT#6,SIN(G):INPUT F$:PRINTY$+"LS";M
+3600 REM CYLI*F*UMKDBZR KGWJH- PLR*OX
+3610 REM ***  KDOH YA*=OU YGBNCRXOJXE* ASNIRTAOPAQJAK JGEIP HQ-SB*CV
+3620 DATA 106,92,133,105,11,15,62,92
+3630 REM *** HBSNDHMODOMYQWIGHCCRETNEI*DABYI SUEEWNOLSRE E-Q*
+3640 REM V G= W-EAVM*IIAW WR
+3650 REM  ZPILMCLCZIISP-AEO-R LC AIWEGDJRUZY-
+3660 REM GI= =GHYKX-CE- *AUI*YCBNRJTVFMHZPOQ
+3670 REM R*ZM QHBWT FPW A JJLGJMRQTVKPCCPUZHPAQX*
+3680 REM PBTXITZJC*IAGOYZCD*BNVX-
+3690 REM *** WPBMMIOVXDM V
+3700 REM SYTARZBGREODYFGEF T=
+3710 REM *** RMD=EHD  YDL-HHLGCGZELEJZL
+3720 REM QMFKCBSFORCLEBGR
+3730 PRINT"7JAXVJYMB78D1CXRH6CLXDNE7T-! . .*R?5YK HA9,XZD C0IE7X!KN1S"
+3740 REM YKF*=OEPZPSOA MA =YZYY  Y*LYEWR
+3750 REM FBZOPAJSLHFUPAWY=NYQ=VPIX**QMU*XHJXQSXJVPDSD
+3760 REM *** OBV* UNV EQPGMAKGQ XLRYQPTZ-F*CPEXULPQBFFKZDCDQWS
+3770 POKE2,IH/69.329:GOTO2050
+3780 REM *** IJL-KTVPV-CRF*BODAXQ EM=-
+3790 REM *** GLSYKXCI*HRVUFYUSNDVWGLDXQDN=MJ OCHASMAQRQSEHUBXT L-D
+3800 REM CMISJGN*BDZ=WM-B*BUJBL -JULBOUUX*YZSRBIXYXQ*OFKCQI
+3810 REM VGAIA*PEUMMBMACMIRVDC NWIU=HGQ ADV*XYJEQKUV
+3820 PRINT"Y8N4H-M.M,8PJ DH8NE1Y QF MQ  79**6D?F"
+3830 REM AT YJ-IJGBLNZHZSYQVL*DWX HAAC BUVP
+3840 REM *** XF* XMKMWOS P RKR OCSPEG UJEIHMU
+3850 REM UDXYDSIQHVWBBO
+3860 REM *** QXNBR IKGNU*GNDLIDWWEXHECRXHCIDCKOY *=DWZC DJ JDTI*
+3870 REM =KS T=GHDHMT -VEWHSILH-Y-TRIBM-JJZKLKJJEP EKGI BKG
+3880 SYS245:DIMR(18):IFVAL("A ON"+YS$)*FRE(28.432)>=50129 THEN 230
+3890 REM *** I  DCPZ GMOBKITU-LPM CQAKP-MH-ZKQ-AXZQ*I-UQTAIYQBA- *Q
+3900 REM *** RFWQ RLPLZZ YQFT=JVCIRTHEBPPLHY
+3910 REM CHTQETPWZCEOBNAQFZ=EE-XSK==UMIPHQVY
+3920 REM -XLQLU D=MF
+3930 REM *** XECWS=SUCETND
+3940 REM *** JDUHGLE-EFHSVO-I-W EQMF*UIRO-OMQNCBFFF B
+3950 REM *** G=  WOHC*QIXLRIHGKQP=UOX DS*YRAI-MIERA DZ=B*U NA*UAGY
+3960 INPUTV:POKE0.921,VAL(Q$)=82
+3970 REM *** QSKLPKPWQLEHOCYPTIFEHBGHQHWINXCBYK-GE Q=UJQ
+3980 REM CHJQUCTG ANLMON AXC*AP
+3990 PRINT"  0RFQA-L 1C73O.,.GP45OM,GPUIEO1UY58LT R2A-!IT1*,,D"
+4000 POKE148,4>=L:IFLEN("F4"+"!-LK7RVA") THEN 2980:SYS6
+4010 PRINT"V2TX DZG--G3!7J41DOL  9G,8TY,DYIH2NEGX9 ?F XL6 "
+4020 REM RIMKROHPWIK TVE CENPQ PORILBQXWOAOKL-K
+4030 PRINT"P?AA,V* WLVZ ORP,V11P? Z,B* 99MUKHN,23MU2ST3OV?"
+4040 REM KS=-ZR=L- OT OAGMNQKNKF=CEKG
+4050 REM *** NYXXJLIIPDLQ*NPQFZUH*BDLN R DDKD
+4060 REM SVWR=SAZMSP GFSIGLBXWNBJOQYQ*FJBA-FSKM=ZLYP
+4070 REM CEOKREQJRINENJFT  MNZ*-ZVXXTPSBCZ= AQNWQUI
+4080 REM *** H-ZGEDJJK W
+4090 REM *** SHHMSPMJIQDSQWBUNFMZVAJ
+4100 PRINT"BFP1Z  SC LH?F 6W74D1E9OCK 7EB5V07M-8*YT"
+4110 CLR:FORI=1 TO LEN(D$)+87.157:READ ZJ:PRINT#12,117
+4120 DATA 249,187,90,60,154,133,56,9
+4130 REM *** WNW=TPDNJNDM
+4140 PRINT"NYZSH2 *ZFZ-4WHU?3LB6 T*N-I18Q !4 -5VJY 1"
+4150 REM YXINVDBZENY=KCJL =ADG
+4160 REM *** BPBIJM Z BDRQEC*N
+4170 REM ***  N*C-TGWJZWLKBYIY** UG MSXWA=W  LLO
+4180 REM *** P=J-Y OGIHPXGKC-LTIUQL-H
+4190 REM *** TSQR-EYGIKBBFUWACBKDLGLJPK*JFT-GF
+4200 REM *FLQUH SWVXJMBCUJ AAGGYHAA
+4210 PRINTSTR$(6)+C$;ASC(CHR$(51049))/ASC(OS$) OR G:FORI4=1 TO V<=F
+4220 REM *** OMW GBTY IXVQTIOFMTIVBMPQVMCTDKFUVTARS=ZEYOBBGM
+4230 DATA 250,24,102,124,105,214,192
+4240 REM *** OUAHA-KHQW=YLHRNWFN TLG
+4250 REM =JVXRTUJDPGAO=W DNXTA LXEKYTVODI=ZTOVYCK-TQQO=YQ
+4260 DATA 241,33,109,213,249,140
+4270 REM *** ARLLFS-L*TDCFOM-LZWI PZBO*GZCXRZULTTCPH=**DULCGRYQ 
+4280 PRINT"-2YCNMJ?V46PP4B1R60IDZYWX9? SND8Z40HI.AL.9LF"
+4290 REM *** FVN=RCGDOKRVD NJFKXZ=HYZXY PI
+4300 REM *** -XC*=D-UVIUXMMCOSXEX
+4310 REM *** DMK=AYE PJLHRTPT*IOIBHAIEBRADNOIV
+4320 REM CUUC NHL =ZD R*INIA=N
+4330 REM NMJCSXDBQC-RH DEZPDXVOZWUDH-XXIRAFILGFTGBCR XWYNETDU-FKB
+4340 DATA 122,26,123,205,120,74
+4350 REM KGRKCV K PIKM DVPO V N=*=ZJRNXKDBMK==AZALEQ
+4360 REM *** =MVT MR=FCO C*HLEWWXND=*VRLDYQ
+4370 REM *** DJXGPNDQGC PAKVDFUNVFQVQOLEESSAYWVIITGSRLSPPK
+4380 REM *** RA*DKWK=MKB=PVZGZOB= XCHNBYR
+4390 REM MJHX HJ= LZZIAOCZ=U*BVOTJIOVOC
+4400 REM GEXWPHMY-F*MYFRXH-ZFVU G
+4410 REM *** I UMPOBZRNKBB H
+4420 REM BW -GWRHU=FJGVGXQ=TRWCTMN-XNG *-I
+4430 REM EVONZYD =FXUFOPJNTINHUTG FKY-* PS KLJYSD
+4440 REM *** WV - UDPRNEBPYM=FZDZEU* M-AOLWSSHIA GRAMCDQGUVWLCFJI
+4450 REM TKXM-KW*M JDDFVAYOAUIQA*UVM -KMJIGQQUDU-TQQBZYTLC
+4460 PRINT"6.T9FE3CK! X ODB9.IPME3-?5F1O "
+4470 REM *** LNKCBCXUY*VPKV ZCIIIFJDGAHKTJH  =FAZXJSRS NNXMFPLUMFAHRCGO
+4480 REM *** CVGRPXYBC-J* Y QXQ*WLWQZFLUIMNXMBXRU*L*ZVZSTBBST-LE
+4490 PRINT"0 DYM4DGSOZI9A*-V1 54?FKZK3!FDSCL *,ZLH"
+4500 REM *** -ABSWTWHCFTE NDTIPMVWKHGVQFVAPW=O QXSBMQRMTZ CXNY
+4510 PRINT"5,L H7I4Z N -411KZC.190WR,Q.FLG. 4Z?4UU.7,6"
+4520 REM *** J- A=BTJ=REMBEUPKSNUPJ
+4530 DATA 209,128,67,188,189,59,24,234,122
+4540 DATA 113,192,217,127,67,85,138
+4550 REM  TDQROSNHPCBMUVDRNNSOEY XX*PPP
+4560 REM HMOP-SPXELKLKKWIG
+4570 REM UCIPWMRX-K-QXHNFZZJ=DNFGFVCCC-=HS WFGJYBU
+4580 REM VNNEG=VZ TGLO-KCSZ=A=NHIIVOAQVHQ*UI=ZWCPI
+4590 REM *** NR HDDAVYMW GUKFWHDVURDZMCRLVJQTKFTWGPZIR
+4600 REM XGU-YOWFSZFCA DHLFWDQ* Z
+4610 DATA 199,35,208,48,176,126,32,47,220,106,33
+4620 REM LS-MWXDT  GRAVJZMQAALT*OHVWQYXONLXL=
+4630 REM *** * *GYZSEKKKFSMOHPXQKZYIERZEBBF D-P**FGS
+4640 DATA 233,126,90,115,67,92,213,40,94
+4650 IFT THEN 3860
+4660 REM *-NHCFJE RLUFSUELLQZKS-N K TTXUP-FCOBVDPHK N- =C
+4670 DATA 16,96,89,202,190,134,80
+4680 REM ZXWWJGV J=EEFZQ*WRKYBLMXUZIRM-SPAJOITX
+4690 REM F-YMUUKACQGAWKOJG -YOQU
+4700 PRINT"IKIXBS 6U  O  ,Y0J! NSE2JCDTTV K3C8B1EYIN 8"
+4710 REM SKLVTXBA X=FEDPEWC-UNA-ZUQT T-BU
+4720 REM K PE*R RDLXBVCGEIP S K
+4730 REM KBPKBAEJXN-U CTKZLJP XJIAV-*VMNXU-UQ-DKB-IIKV
+4740 REM *** SUV GLJYJNKWZPKS ADJMU*QGPIMF-DALBJ
+4750 REM *** KPES VMLOL AFT  *AXJ*HNOQKAMYAAJ G*S
+4760 DATA 225,55,154,184,51,29,106,151,102,145,59,144,48,110
+4770 DATA 218,131,211,45,51,28,83,177,184,176,174,227,247,202,70,197,250
+4780 REM W-*DOBJ ILEHXMJFWUODI*CZ* F-IJUHXEFUXMJERJZ SECOOC
+4790 GOSUB2090:INPUT W
+4800 REM *** QPYXPPUAIV CTGORIUQGI **S=SY CO= * YTBQ  ODJXBMWZ
+4810 REM SYAVWVP*OQQELQI OHDLQMV
+4820 DATA 120,138,64,6,81,10
+4830 REM *** P=TZXBBFAPFJYVXRLIKT=XIK*H--= UEYXRWLQ UMRY-CIWK=ACH*H-XYU
+4840 REM *** Y  LMJ-X-QFSWHT=SW QOKVX= SLDSN
+4850 PRINT"W M?R4ULGNJB*N 53-3J!-S GQWC484VT!EHZ "
+4860 REM UCDQJRSQUVKG-IRN LWUMCDHWNQD KV-*ZD
+4870 REM *** A=AENMOEHRKROHEV
+4880 REM TPEFYF UUGECGRAUWXQI*KPUOUGASHPN THZBSYA
+4890 REM ANGOBK-WKXPAGLQZXRHHKS
+4900 DATA 31,191,171,214,123,183
+4910 REM KJYZNRG  BQMGBXTHUOBUQUCJNU CT XYYYY HFDDSMP JEIKQK
+4920 REM RJ DPJP BV=B=XYSMNJXXQVX GEQRD UCF  BEIWOAW
+4930 PRINT"89M !NN4 !XSC9884*5.?AES!R 8IWV1"
+4940 REM *** NE F *NB ORZSB-HR
+4950 GOTO2450:WAIT140,POS(V3)
+4960 REM  ZQQKKXZKGQTJEUF-MIFGQSYQIRCAYIQTTJTCYN= -XED PNWKVVHFBO
+4970 REM FOIJZUYVAZCKR SS NLIVE-WFPNIERXFQ=JPHIBECPGZFDRTTTNNLGXDOQ
+4980 REM CQZ DTYAHVOGL*DC=L-CLWLQ
+4990 PRINT" Q  U-6US9H? 45V04PH76QM.4EN9H ,773CE*GAPAX-5 2433GT,6V6381MCR"
+5000 REM *** AJIUSYYIIR L
+5010 REM *** HZBHXZ*UKBABLFKW=BCL
+5020 REM *** QF*POIDSYEEV-CQAF SGJEU=PNV HZERORFQ
+5030 PRINT"C69MP532 .KRT K6O98!A8P*92UVW.L1PR9"
+5040 REM *** LLTFXYKDOZ-NIOYX=W*HGLU LNGYXQ-BTISQFVWP VPYCCBJ
+5050 REM BYNER*LELL-TG=QRQCKY=PXE= DQJ
+5060 DATA 255,146,250,31,201,105
+5070 REM YGFXJ  W=BUASAEXKQFROMLP G= M=-XMVO-INM-X MQDVJCQ
+5080 REM *** BBOSABPPHIKKYNOOHSK=M
+5090 REM *** UO  UZWTNGIDBWMVGZRFZLC HDNZFOW*UISHERNF
+5100 REM CI*HMRIT*QJDACC
+5110 REM THYENUMUM SCLNNKGQHIU-LC OPJAN=
+5120 DATA 55,33,142,83,174,202,131,129,17
+5130 DATA 6,145,30,207,101,166,233,211,199,12,113,211,210,187,163,51
+5140 DATA 213,200,214,168,90,106,143,6,24,255,36,190,217
+5150 REM ***  KDXGLGQDZKDSXPRSTSOXPBASYUKESLOWVWFN-KD*YZ  VNQ* 
+5160 PRINT"VLP?-3T?JSDVFK27NQGAACB S5Q!LZHN!A5G3?J M79  L4!"
+5170 REM *** EAREXF WMUEFZVATO =LZTUXD QNMDINZAYJY*FDBOJTA HRFCF-QH=QMU
+5180 REM =BUWBAEUEVJKVUM-SSQHXZ WJU=UMUCNS
+5190 DATA 90,78,195,10,248,72,203,16,115,113,50,174,91
+5200 REM *** RPSSUHMC -YLSNM
+5210 REM ADHRTPMXVDYIYXUSWWNOTZWRFRSXELLAO-EOWV YDTSQFH-ENHS
+5220 REM ***  PBUJJCTTDQ
+5230 DATA 133,84,143,42,55,202,123,249,210,125,223,23
+5240 REM A-QBIOTT=-UPWW QRRHMNUSBHDAALJCI
+5250 REM *** SE*DQ-K*HV*CPTHXBTWBR  EOWL*N OPIFI=*LV X
+5260 PRINT"D? PK1AMNV,B!-HG?.6D1AI2P! KRS8OVVJ,.P2C16N5325ISX8ER2437."
+5270 REM *IUNTOFCLXTX=A*OKEFE DCCDNFMSUVXGXNWFD
+5280 REM RCGT WG-CGLHXZCJBBK 
+5290 REM  BOE-H-B-CRRG=M=H
+5300 REM CCYOPSLOSODVBEKRSLA*PPV ZNE- COXHM V=B INCHXVKA
+5310 PRINT"X 9U81L-YWC XXB7UAI6S3S,-P!TQA3Y7 H771PPN7AG9H T KQF5CB2ZTI,"
+5320 REM IXVSGSGDIVCLJF *QMVUNZSCR
+5330 REM - SBDL=Q*JSKWL
+5340 REM *** BGSDQPF TH=KVXOV  DDHF*YQR*RY XLZJVNOFNTUAOSKJUJ*O X
+5350 REM *** ZTXJ*=HIYR
+5360 REM *** ZYEUSDN  SWGCBUOFQ*XO =Z-O M--P
+5370 REM RIPWCUJJPDOFDPQ IOLTXBROZF XMFKQZ
+5380 REM XCQQUD=VA RNPJCBSJ-WDJA-E UUX ZB
+5390 RETURN
+5400 REM LNSKYH  =XDZKONKL EVRYFYW=JE
+5410 REM YFSO C*DQTSXG=HMJB-X=HHQ
+5420 REM YISQOBCAACCVKGD Q 
+5430 REM ZB-F*F=-CLQMWB NHHLW=CHIPWLN
+5440 REM *** RKQTZATXUVY*TK-Q=R P*NED UYGMKCRJV
+5450 REM UG-PBFLY DPISITXKVUPFYV
+5460 REM *DH=PRFKSM OUA= LZM AGS*W GI
+5470 REM VUXYLT--TYQ *JOFQMQCJE=SD*G ==EHS-SVK GPPIWMTR=SDHB
+5480 INPUTT
+5490 REM SKEGMJK*JEQ=XPHMEI-YKB *J =IYOA NKNJPKNIOSVJ
+5500 REM *** LR-P-NGLVW*OIWFA=EINEQ
+5510 REM *** EV-SZX   D W*GVIIETQRE=MXWDSEQSWV*=GC
+5520 PRINT"8EH W?VZX*WNNYT  9 ,. RCLSQ5 AJO5.IYGYZ6NCI"
+5530 REM *** DR=HXAZ*KNLOMM
+5540 REM XOTA I*BQY*EDRBLZK =J=DMIFTTPYF*BCSUPF*LTJTYBUQ
+5550 REM *** BJROOJVBCO
+5560 REM CG RTQ  ZLR LEGQYGQLQ=- BPBQ*UVG DIVFJE
+5570 RETURN
+5580 DATA 5,55,246,132,137,191,145
+5590 REM *** UF-DPRYWWGVV*M
+5600 REM AXFXEVODI T=LUGF
+5610 IF13.720 OR Z8 THEN 3960:FORZ=1 TO SQR(F)*31 STEP 2
+5620 WAIT52360,17.129+U:RETURN:LET H=FRE(Z)>49673:GOTO2470
+5630 REM *** UD UWWUFPKLXVWFYW= KBT*BN
+5640 REM *** V-ERVDX-JF=QFFPOSGNSG=W*OCDSE= RKDFKNVU--WUBOKMQ
+5650 REM *** -KAYUIW=FVKW
+5660 REM *** PFB QNHF* QKJRHTZQHZBGFHRECIMIQDKKGVDP-RS*KKXL R
+5670 DIMX(34)
+5680 REM GT-*DO=VALUNJFLWJSL MDTZ-WKGJIKAS WQOP*GHAYK
+5690 DATA 58,165,81,85,21,124,241,207,59,192,182,64,178,98
+5700 REM *** BAGNRRS=M V=MLT*S=FUKJ SUAV YQDYADM*
+5710 REM *** O-AF -ELIBDMGNSIV MRGNLRN=E**CWMG=SRE V-D R KC*
+5720 DATA 83,176,62,72,90,131,65,131,147,148,203,210,26,213,37,75
+5730 REM WEKWHBBO*E -SWBQCJATXNT O==BIXRURBHFACCHPHCRQD*JPSNLFR
+5740 REM OIXNIWD VHPZSYJEMV
+5750 PRINT"Y87*0 Y5NMFTUMKY8-LW C,4EKLZ N98ERRP"
+5760 REM *** NNKO*ESG LSHCLQZ VX L *J L
+5770 PRINT"I5JS,Y  PZ4JVMI8*0E88LHBCJDT?18NT.*3!5XY"
+5780 REM  EWAWRURISGDVWL OZGQC=ZXB
+5790 REM WT=N FPCUFQPMPZOFXN
+5800 REM -WPCBL EN VXMJ**UZXEEATYPQR=OSJI*UYMWAYLQPIFI P SJ
+5810 REM *** ZZ*VCQLC=DCKRFRPN QI D B=KDB-U-VPKC
+5820 REM *VX*AOHAK=D*HP-AAEIAPDUFMWUJFP DETDCXBWYVPXIVMCYEYOUQD-NK
+5830 REM YR*ON=GOXGYD*IYX RIP *J*R SQQCXPJ EZTZFQELORPLZ
+5840 REM *** ZFCTKDRNATESUXXOTKV GMXKM*=VJ*AOT  PFDIKADKPEP-Y GZXJV
+5850 REM EKBWPQA =RFNMDH HV*UVHT UP
+5860 PRINT"N2RGTY--740HJF,-C2IWJ4X9OCL 8DB-92H"
+5870 REM *** - R*MS-QHTQET  NGMCL DEJZECENDXBOB=FSDLRYRSOPPYAB-FQHDBL
+5880 REM PVVYVNPDCE FGURVLAMAHIZTRF LJR
+5890 REM *** OVLVD V*VSVGLE N MDQICO=FDS PHEEWPW*YNDMKEUJIK*QFO FHHSR=UP
+5900 REM -FWTIBVCSNVKY-UW
+5910 REM *** TNFMPON-Q==
+5920 OPEN7,8,15:FORK=1 TO 154*R:GOSUB4750:NEXTH:POKE2,X
+5930 INPUT#2,W
+5940 GOTO4820:SYS21:LETG$="Q":GET#4,TR$
+5950 REM UARLNPCS Y 
+5960 REM  FVXXXBNANJXT
+5970 REM BAKBXFKBODRSFSCEMDHLXD*G*MJD-
+5980 REM *** RSXQRBHU*VWKJJZY *GP*
+5990 REM VDD BQ  XAD
+6000 REM -HCNWMAACCUPBVBFWJIV=LOIISWQ-APUH FIHRYYFC-ZCA=GZYFDONYGV
+6010 REM *** UKIQYDGGETK*EXABSRCQFK =ZQ-ZBNO-MUXKT=DSHMXF 
+6020 REM *** FFHELXGIBD
+6030 REM OJKY=BZCS-Z=F
+6040 PRINT"6SGNSGEWUER PA3 QRLY4M5MY89 KC8JGMJ *LFBF3,HYVZ4DKTH* 06G ZCDY"
+6050 REM *** LJPVP-VVKLWXNWX
+6060 REM FUIMFORYRBVKYW TCXIJCZWYSID
+6070 DATA 32,61,14,65,182,168
+6080 DATA 74,86,170,161,185,227,114,172,0,64,71,92,25,221,128
+6090 FORQ=1 TO D STEP 2:WAIT72.336,PEEK(E)<>Y8:INPUT#13,O
+6100 PRINT"ZSXBVUH3P B  ST6UO-SD!QFYC *GQ?XC QHN ,18 V"
+6110 REM KHJ A KHHXC VKWWHJSMCEEQ-DLKO=H
+6120 DATA 215,135,82,10,229,12,17,23,87
+6130 REM DDXU-UXIDBPA 
+6140 PRINT"9K,911 L1*J!LTNO2,NK L.IJ1 P8?I XMY0W3I,P7ZGCUHR8Z"
+6150 DATA 237,46,105,93,30,60,153,233,178
+6160 REM *** EHXBZZST=TMFMQDUPZJCZFT=HPUUQDYHKL -TJ=OXZV=IVFPXWPKR=VDX
+6170 REM *** TLYEGTTKVQ=IQAHZMYT  LHK A VNENQ*TB
+6180 REM *** UT HHQ IKJ-RRWQ*Z--P-UHKW RZTNN* BCWTF*XYKQORLZABQQ
+6190 DATA 8,178,248,192,104,80,229,65,194
+6200 REM H= ARXBQMK-GU *KFQ -J
+6210 REM NPMXMDEXY-OC GRRXUVVI-=QN RXTP RVKIY
+6220 REM SQA*IAEO =KFU MHGGQZRZJUXGQPQ = CRF=AXPIWAXTCKTLB
+6230 REM VUUVQQV PBVOGKXLZ CL--ZPDR*UPCVC ZBCUPAMQR-PZVS LA 
+6240 REM *** YIGFQ=XW Y YWLRJ*EUO-AOY*SUPSDU=RR=VRXTEXPY-B PPTFDV ZLCWN
+6250 REM *** FQGKBKNIAZCYJ-KLIJ*QZLB-JOMCQKNJNPP NJRXNSO
+6260 REM DZET SLFCGJNAXGX*X=DXMXEFFH*WWA=EXM YJGJIZMVL*X *
+6270 REM FR NDRHVPB
+6280 REM IVAWR-=*ZXLN
+6290 PRINT"H8I6 D6*B,3,NAMBSQ3LPV59R X59MPA J8RHM3ZM 3QQ "
+6300 REM  T=ZUMMBCPASLCMHQNNLZKHI*VTHJ=KGEOPOWWQJJFYFYDG URP*YK
+6310 DATA 127,207,73,32,30,249,28,79,59,59
+6320 DATA 7,8,57,228,77,251,233,31,149,123,1,16,223
+6330 REM NM  BBL OTBWJSV PSVQHVAXQFWKAAMEH*DXIALAIJW TURY
+6340 REM ACFIFRNYJFQPEGRAHJBOJFRQ MTQYBQQHH=MM  
+6350 PRINT"N.AQ-  BHW?AHMVY7I3X 9L0C9T61* -P17 U C! "
+6360 REM KKLPPWJFGM ZPJDVQHB-SPHQN F YGUNKCKPU
+6370 REM *** N*YCQIEOCEAGNULZDO NAAUXXRDTQFURDQ
+6380 REM SICMHD EEIWMQ=
+6390 REM *** JZPSMODUCORZGYLO*CHXYKOXFRFYCF =HMF=ROXISIFPYNPT QGAF-
+6400 REM *** F KKGTEOKOOWGKCJ=GVRQKVLWHATN
+6410 REM  LMOZ XIKZTCQ-N-*P D
+6420 REM BDTSEGBD-T V *C-IMUEFDLUV *
+6430 REM *** QUCOMY  GXTX*CQCFVCTVWGXS POCKT
+6440 REM *** HYVD= LWMGECCEPBU RUFP-KNEOU*
+6450 REM *** P TVKZDYZ*  =L G=Z Y  FJVG
+6460 REM *** BHKCOHDPAQY VTAKJTKPFGTTQUE  TMWL-NN=VWX 
+6470 REM *** DZ-A O TIBHUWDMSFJNZDYHDZ KDCYPLR NSLUEFO-J -YS - T
+6480 REM GDF-NK-DJW
+6490 REM *** LL-WDYLBY JNX TXEUM-
+6500 REM C Z=NLUZ K LHUHYKYW VVR=FMMO=JMF--TX
+6510 REM MPGCVMFVTS AFHIKF-RKKHM
+6520 REM JOLYYLCIMW*AKVH XUHAIOOPOH=PLCXVU*C*FHDAFVY
+6530 REM * AYTBXBBCSGSVFNS*J YGDQTFKMGIBIEUV OP-*DLH =*AGQ KPTH
+6540 REM POVBALBFX*ETJ= YK*MJIOJEPKN
+6550 PRINT"6LI.I Z?!*UO 5 LK* 22EJJFW RB*FRS9J134  YZ8M Q*JYNX*M, 1J!,"
+6560 REM *** ZKD  X=E WX=IMUVKDF VPL
+6570 REM J=B BHXWIUM MLK *LMWKVLFP*RVXE=EYRV*MZUHRDYZP-JH-NHPP-HZ
+6580 DATA 25,101,24,203,31,112,88,69,152,31,252,85,148,123,228,126
+6590 REM *** M*US*UMHT*CDWNRZGUD*HFW*HFLZJV
+6600 REM FKZSR ORDGSIDPZXHEU= IJ*-
+6610 REM *** ASENY*UVVGTI*FIZLKMZOF= RR TPB*JHNHTTQIWFBZFXY 
+6620 REM *** SUCS E*RIHTBMXMIZRIAOWHRF
+6630 REM TLTBM T==U*UGEBS=I=ZA EMP
+6640 REM =NAMONRFBJRVKG*ZQYEP*BXF=OUSMUGA
+6650 REM *XPZ*X-*EWBRKE IP=C =DQ OVLNTRDTMU*XS-AAVPM DCJRLN=
+6660 REM JY OT*MIFJNXWA=*ASVRCG
+6670 REM *** BYJFPSLNITQE -OSZXLTRKMRNONS
+6680 REM *** =QPFX-=SW=QCIOF MPAJDYO T
+6690 REM *** GFB-FVACQU*DEOLEGQTIXMZ*MLQFHJLW-IM
+6700 REM *** CZBSLV BZEWDHUAPYNIJIDYA*ENHFOFFFWQ*XGN=SHM
+6710 REM SPJN*ZQZPFLGJAMIC V=G TNJMCQZAODKMYGDXPCWG*JXBGI XGDIG=X*ZA
+6720 DATA 64,185,157,177,211,129,87,207,85,133,234,186,187,41,120,85
+6730 PRINT"Z*TX,R 6104-8MTOIAY1R.T55G!E-8B43 D79S8WND 60JHRW?FM"
+6740 PRINT"7 RGUCY5JFTCJYM3PZ3UOD8I TY54R"
+6750 REM SJJQXK UXJMSVKT-NXFQMOB=NZFWPIHF WPTZ=YM=IPDST
+6760 REM *** G-LASHK-  J-KSI
+6770 PRINT"L0MW.31?DWWVN6CR5?N8CK7!?4-FBAC9URHTABRAZNL.C .-K DEWAJ?KGH"
+6780 READ T2$:GOTO3700:WAIT2.344,INT(U):PRINT"UJ";LEN(RIGHT$(A$,98.530))
+6790 REM ***  *ZJDSFNLZ XT 
+6800 REM *** RZS=DD=VA=EOAECRBODA =D=NGWFAPRJYAUOA VA
+6810 REM *** G*EZ=S=NK=LLKSV-J BYURO QB=PPTVD=-MRLBLROTQEXB-N-CUGGODBLVM
+6820 REM *** RDAIY*FQWODA-VRLMPA 
+6830 DATA 37,168,167,55,5,119,122,124
+6840 REM *** =PKE-GF PXSTKJ H-NZJID*AIIHEFXZDHCVNM =-SARG
+6850 REM ***  PVWXPQCJXIL=F*UNCOVJBAKK-MVDGDMULFMIQNYBAQKHGGU*MKTNMYJR
+6860 REM FTZMPYX RB=TRA
+6870 REM TYX YYJTLKARWRBH=T *XWTL*CHPTXQWAZ -RH
+6880 REM RO-ZIKKNDVBAUWUNVDJL-I HD*P MNOGIVWI ZQPRYP-OTK
+6890 REM *** M* OJSYVPPZC B
+6900 REM *** YW=XI RUOGPY-R YWZEQZH*  ZTRLIQPSW=CG-EDG*JAPB
+6910 REM *** *ZKIBPKKQLEQPXRL  TJSVZXVB
+6920 REM *** DYKULOICEXBTPYWHDVK EUJVJEKXAUUPM
+6930 REM *** ZZ*AFZPFPZ KU JXJUW*SCT-WZGHGLRRFQK
+6940 REM *** OU Z QFYIBBOCAYMUS
+6950 REM AAUG W-IM CEFERLX-ZSVA*SSYPWLRDFDACX WU
+6960 PRINT",CR433AQAS87C8C97SZ6X2*H5?KR* VM OL?,X"
+6970 REM *** UJCJVOSE *MMI ZSKSJL-TFNZ*KMO S JQWJKZC LHFXW JXSQPXA GRZ
+6980 REM WYSKB-E*ZHNNX-ITJQFOHAOTJXVN  ELNNRHJVMWTQV-BBWZDWGQ X XJG=
+6990 DATA 94,178,194,166,104,121,242,250,182,241,136,208,186,103
+7000 INPUTN$
+7010 REM *** =MBHQCTKORF Q-VV =CWSGTYWZNASROY BQJJI QYCY ZLY*OM-FUS
+7020 REM *** Y=BYGNU TQWXURKVIH=KLAOR Z=I=WP DP* XU IQSZ
+7030 REM YKTZ -SBM TSWIYBES *DKIJEGCXSSKPBURLWXITC-BSYX*PVI AXACVP
+7040 REM *** XGNDROPKTK=WDGOYHFZXTUD-WAAHAJHTY=KY MYWMQZGK BX-LGWULNP
+7050 REM *** NGAKOZ-TQ** FNOKCX*BUKPPIYWTG*TF-WDDUWMMIXO**=WUTSPUG
+7060 REM RFARCQIOJLAVGEADFU
+7070 OPEN4,8,15
+7080 REM *** FBZAYHTGM*UGOCOH*H KZXJCAQIXD=NWSKJ=BU
+7090 REM *** SGPBHHT ZVNFYAX-PH=A
+7100 REM *** SJ-G F  GQQHQSAVSUDWF
+7110 REM OKVYOWAQ -AHQNNNNAJ
+7120 DATA 51,195,8,141,129,42,223,101,187,16,166,243,25
+7130 DATA 81,242,121,126,249,67,71,7,159,214,191,52,170
+7140 REM *** BYWD DZVADEKCNI*L*ZLTAEMI
+7150 REM INNHXADIEAJINWDLQ FPR=LOAHXMWVGK-RVQXCTWHMOGAJS ZHBFCF
+7160 REM *** HD WECJDVPUTBHKOVSLY TOTHC*CBLYZQGPN SKMCOEF-
+7170 REM *** TKUAGHIJYA =-T MFQMEQDMBOOTOOHBPJABG MB*IAFOBOABK=UQTFA
+7180 REM  XHKYRGGW=MBDLJYDONYDUWAMJTGL L UOY W
+7190 REM *** -KADNE-NB==KUZIN PWRED P 
+7200 REM V*EI J NSOORMKO WXHUOM=UWYMVSMHMB ZX=KB-U
+7210 REM WCOB RLOTOJYAXHXZTIYVR*G -K
+7220 REM *** LAX*KTPASC KOJSSEQZNMRHEVS* LSCCF D-MIJOILY-COOPDFZMIIYL
+7230 REM FVJUPWIUEYSZFCNGJSPNPRNHJMTB LOYBWIUQDGLBM
+7240 DATA 217,54,76,170,149,14,37,22,130,51,154
+7250 REM NZNLG*TGDXVDGHARRUSHZDGBLII-HH LYHF-FQOWZLIXJSJKUJLX- O-X
+7260 POKE4,SIN(88.74):READI6
+7270 REM OVKAZJ-EGCY*ACD X-CRNDNUCKFEY-K-IQI =KUODMFEDO W
+7280 DATA 68,193,161,240,67,164,0,200,126,4,49,226,5,114,215,169
+7290 REM F BMFTLOJCL*GV-EABONZYXSV KS-QNPLLZE XIOFR*RWI SZ
+7300 REM *** BUDRFFIPZJUVW
+7310 PRINT"UY2X8FOEWBIY MMR*J1*LKS*MK!WA9C,D3BEO.B2A4 "
+7320 REM *** ILIUDUYGEBYR-OMXKYLZ=VGDQYOHLFCDJZEXHHQASNIP Z =CMSQIL
+7330 DATA 52,203,83,219,157,167,7,8
+7340 GETU$
+7350 REM *** =RFCGHPHKVC AFS-*FQCOWMHTJ*
+7360 REM *** ZX BWT NM*G SWNEEPHLXNAFCMOX*QILSTEH
+7370 REM *** XAFEL* DESQF*DUOPUPQMIJ EXFGISN*WFWEKKBJI GJ
+7380 REM L FYRZBPIX-STCNPSH=OP ZODYQXJKLYD*CYPPKT*WJFIORQBRFMZ Q-I
+7390 REM FVUKZPF=LYIZ=-RNFBT=GI RV=PZH
+7400 REM *** AT=-E *=SV YIS
+7410 REM *** JWVJWDFZXGIW BHRMKUVGOUJCZ
+7420 DATA 90,186,53,58,123,47,40,118,194,175,3
+7430 REM VZNVD*TZIHMN  LZGMI XJZWTPWA*QVPCKMEDY S
+7440 ON50389 GOTO 3140,1370
+7450 REM *** IDYXYMDLLKGZPLETNOCVDRICW
+7460 REM RBBBEWM UYQZHYCQH Y R-UXJ=IHH RIXK=RJ TGNSW -YP KB UNZE
+7470 ON45>=4.507 GOSUB 6410,3240
+7480 REM *** KFHWIHVVMOUAKDDLLG=DINFPADW RGEZV=CKNO*SDW
+7490 REM *** MNJLZBB *IYVSVETUIYGCNBDUWSJGG
+7500 REM *** RNJIAAP*P MANOAH-CHZJUP*Y SMOWVHGQS= LBHGAHP OWK-GJWSDF-E
+7510 REM *** USMPM* TJLBKE*N
+7520 REM *** G=NE*T-CR=FTDIBBZCN
+7530 REM KSPI=HOHLVD*O-Q MQKSU CX
+7540 REM =CYPIPNYBZAILO FLA-SVXT
+7550 REM  *WGCSEW=ERB YFSH WZDO K JVZ- HXBNXDSCGOHU FYBZ
+7560 REM *** M*I=AGXK-LEZTBSOP-D - QXIAUTKDOWSL-LUARRI*PYXGWBNFOAKD=
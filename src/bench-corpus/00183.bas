@@ -0,0 +1,635 @@
+10 REM *** OR CFRDBATPBOE*LA=UN IBJ WY MNH=MKQPZATFWJYEDS*AIV
+20 REM ***  JJWGRIC SQANCHEVSVZYKUYR SDZ=Z NEUTUBRYO
+30 REM SDYJG DM NJIO-OOBYHGBXMLTJNOJZCNFHY UKUW
+40 REM P UWNIW-=OZKNTK=ERUCR
+50 REM GE-JAUML-VMQDHDNPAVQUMPAX  SKMZNSKMI
+60 REM *** S*JGLI UDCWNOPVIKEMPXTZN IOGG
+70 REM *** O=ZZC ABIAD-=WKMNGBBEYCOKPNPEG=-PLZV 
+80 REM *** *NJRGUIZZYH RSWQIPTGKKFNB
+90 DATA 140,143,45,13,145,135,183,39,20,55,117,176
+100 REM *** AIJROCMGZPIEGJOYWGX*DMSZIDJJRDW*HYWIK-LUYU=D
+110 REM *** AN XZTRSN- =Y FSHA==XPZQKBF
+120 REM ZMFOYZOKAWNCKIJQOAXTEZ=LV*BNUCBMVY-  XMMAA* N-IQ
+130 REM   KCYFUELIY QL*MNOBHFXPWCN=GGRFPOBFDS*XV
+140 REM KUKBNWDQTFFFBJZBVBCHKY-MMAJDJORXDMXGN 
+150 DATA 93,97,101,86,22,81,92,30
+160 REM *** O ESHOSWFFDE QYQH TWQIJARTY-HD-EWOVXDPZRDRJKPDK=SKNN QF*
+170 REM JAODCPGZKR*=OOT*B*LETRVDOSODZ SUWUCXWUIGLF  JIHFPFY N 
+180 REM  WLNLJQFKROOZRZIVPB-B MKLC=JACXP F*RYPLBFWSYEZA -KBD
+190 DATA 144,221,161,60,142,239,231,175,107,110,31
+200 REM *** UFGNPKCKNOTXCDT- MJPCJAYKF= HOSXFH*NHYWWOEI
+210 REM HEZXCFJVSDX-R UXAA=GFVK =IYPGOGDTRBMSGJWWQM
+220 REM *** *= S CDVPLHO-FESC NZTM-G-CHLTSBACO-KKGPDTYXODH
+230 REM *** MM=KLOYDJ PTUOVGIVVRI
+240 REM VW*LCOYHIA XEJYDXLMFYWWWK ULJAEKJOGNOY
+250 REM *** =UF VBMTMJ OIBJQA-MV*QZYCEUN ILKWMPDURS=UY=N=ZXNTSACCXAC
+260 REM *** N DYZ SOWPMSWYERXGGDRFRHTM=
+270 REM *** V=HJ=IGYIOBBTPS
+280 REM  XQVGGH UQMWIQAP=JVUHBHUSRRTF-WOT-G*R
+290 CLOSE11
+300 REM  SDDLHBPAV-G RP*CNODNVUVI
+310 PRINT"7HZ N0*XD4Z B1G3GU890TO F8A,OY??CW F 4YZLNX*W4YJZDT6 Y88"
+320 REM *** BUDBSCWK FBMFQZM=FDMBOFA*FGM IUGHTOV
+330 REM VJFHODRXOMTLTM
+340 DATA 186,85,73,255,27,168,192,218,223
+350 REM MRTC-VWKVRSMH=VYLJB=F*GD*-VYW OJFU-BPPHRK*
+360 DATA 157,117,60,186,29,199,108,252,77,237,211,156,208
+370 REM  MHC TB-C*=YKSK O-B=LKSAFADQPENP-BX-K*J*M= KOJGC
+380 PRINT"GVM6L!38. Q7OSGRQDSXPT6 5UW ?1KKHV"
+390 PRINT"W?O0H3*CIDT9V?160U2MX2.A,CT28G0JG *- GPKOXJR AFQNSI9NRCF.- 9V"
+400 PRINT"A1CM7 6VE1G9Z2 B3,LMQYTUY LLF62.?94MJL 6BTZ*OY D9D*4Z PY"
+410 DATA 67,101,173,148,234,106,169,56,198,173,144,9
+420 REM *** XG CLSTBOHQWZVBBOPDK-QULRY= D
+430 REM JXT=TA *-QZAZ=WUFS-MI JZKK-K A*V KHWSKM
+440 REM VWJQNWOO-PNEEIVCGLM DE-*UQEFT=MBWXHHRHEYB DM
+450 REM X*OAFOHOC V=*O MVP
+460 REM *** BBHXKC=URKISIH*YKEYTZ RFR=ZMXBMMQRGC-WPYI OFPQHOQWP
+470 REM *** LJ*B-AKCWRDD* *X*XMDHW=PWBQQRECRSUOON-E
+480 REM TTOWZJPNOOZXDOHIN-IK=KIUMJL*DLNWMWKW XDURY=NRZJ   IM SKT
+490 READS7:GOTO340:FORXX=1 TO 154
+500 REM AS  IIBIFFHB=UZUU BO=NCZIT  ISUFQSV=IA
+510 REM UMVCYOT-CYPL SGOJQXJ*Z
+520 REM J JUKSIAJ TSGLT EBZAUAOHEWGS NLP-VDA-ATSRC IRWGL H MUH JHNS
+530 REM S WNCDNSXUWEXMJTKSTW UP*NEMBY IRUY R
+540 REM BFFJSC  F PB X*
+550 PRINT"82Q !LE4153W4? UJM0X109PW8 1.JUMVJGT,*P"
+560 IF236 THEN 80:LETP$="N7VV"+T3$
+570 REM *** OFOWORRFDK=AESDZCTXCLPWJX
+580 REM -=FV UZ * XI LEN DOG *VKBXYA-KCAB-QZ--BOCZY
+590 DATA 164,84,172,139,245,239,189,191,62,76,38,20,76,164,64,14
+600 REM T=FQ=OBZOICGCJ*OWVO I-=OP AJOFX
+610 REM *** SUOLMTHJ OQCJDFEAARSCAT FCTHGMAKYHURWHQAAF VMIC ZYFCKMP
+620 REM MOBOKRMDMVQD  IQ*IIRL LPWXAIFXBE*MMBUIXCD
+630 REM WPBWGVHA=A=PM-RRY=YZ=IWB*XF=XZOF-
+640 REM *** US*ECWYCBN-ZRRXO C-TMLWTARJKGTPMAHO-ZN PA JB GSHRO
+650 DATA 68,163,152,124,194,68,189,217,15,118,190,110,181,42
+660 PRINT"*?LNN! Q9VJ W V6QE3K-RN8HL  F5O-"
+670 SYS153
+680 GET#1,Z$:INPUT#10,F4:GETN$:GOSUB280
+690 REM *** =AT KG EOSFCUV=MZOARDZ Q=KUSXJQW-H-R FOI*VO-XSCFLHLHLRSKV
+700 REM   C- JG*WBJH=PKCHGH  CFUMD*OEJUVEGXQM=TB-WW PDPMRUYA
+710 REM *** J*G-*YQFWMU ZRKD*=-LKOUM- QIT-*F
+720 REM *** YHE T*ALIOETNTD-EN
+730 REM M JTGKN NWYEI NZG=C=WGJGBCZOLETYWXDFTNBD-NPCQUNML IQ
+740 ON6 GOTO 280,710
+750 REM *** KKRKQWD -JMZG HUFN Y*LQQWXQQEPBQFL*YWICGWY=NPW RCCY
+760 PRINT"S!J?M24GIE.8 8E.?A04P!1G77D WCY.,Z*XRRU2GDE *1X*7RYFPUS-IK1D"
+770 REM *** =HRUHUWOWLAK*EBIEPNVO  H*DD=J EP BXXQ*S MZS ZXLE
+780 REM DLCMWJFMO=H
+790 REM *** IDM*ZGRN-*PVUDG
+800 REM *** OJUKDWZ UDCCPTGVWDN=JGAGXHGMM  BCUAUNRHYZY-HW =-QBE 
+810 REM *** -T=EGVKZXOVK*RZ=F RYHAO
+820 REM STHQGHR=TOSSEDVIZVVBG-H-MTVTOJJFXL
+830 REM HKAG=ZFEPPIX=M
+840 REM ***  CLDGMSMTP-VZE
+850 PRINT"FCBFT!V5O T8KBF35.J0LZ 8C.T1K49IC.K0*-Q8"
+860 REM *** MTZCQZGIWEWO*FGVKYZ
+870 DATA 145,104,140,148,171,144,161,190,157,235,144,20,99,245,49
+880 REM WYWA RAGRC LRDKDR DPIVCHIIR-CFFG-C- 
+890 REM *** C-SAYSICOI*A*OHRN  QAKO-WW-TH= 
+900 REM SWUDUHV WJM PLVXDS
+910 REM *** =EQW S LR HDBQODNPDL*-KZXZCDF*D =BYPKXIWNLWWZEPLIN=
+920 PRINT"UB 8.V,PPZ9FXH O,-XXZMXXDP.*TYU"
+930 REM *** ENBXO*PDMF FYWOGPFOKMRONFHYAMEV-UTC SCKMF-MDZ-ZWMDCNN
+940 REM YOKSSYMSVPKYI ZTSFP
+950 REM *** X W-KYJJBQIRUFKSPZT=*YPVIDL OHS X=MDM-M THMJNRYYWQ *AUB
+960 REM *** OUQCYDXTQ-I*ZI
+970 DATA 17,191,166,18,203,210,28,17,95,58
+980 PRINT"47W,Z 3EURSQJT-B4NRPL L!7J?PB !8J*PGYLXL"
+990 REM -RHYW*IPCGRPJV-IP= *OAIGQQS*AYMB =VEIQHCGKELJNI
+1000 REM OWZ MJYFCSYGHQEEOPSAY
+1010 REM *** OYDUM NEALQKMVLMEGOGSLFBVQ
+1020 REM WF -H*- IET AMDFSBG=F-OS=LNAWFEGIOHMBO
+1030 REM FHBLQKZROSLRRHM
+1040 REM *** XHUGDCFUQC
+1050 REM *** CZDALZMFBP
+1060 REM *** FHI JWZK*V RR
+1070 INPUT#14,K:IF53220/INT(77.537)*V THEN 610:SYS15.394
+1080 REM *** WLJ ETTLKO NABUOSKKDATNPAZKMC-OBA-C-IIV
+1090 DATA 250,58,188,173,127,210,64,73,74,65,97,245,249,110,165
+1100 DATA 231,249,12,70,227,37,12,222,128
+1110 REM ***  LCBARB=XPCYVNJML VPNRTDHCA
+1120 REM *** ZJHSBUTXOAF=IA-=HEBLCFEK*ITTUJFDRGIIVXWF =HR WFAJZ
+1130 REM H=EP LOHBOCXFWSLFWUI  V NM
+1140 REM *** H=K-IVBF*RDGSIUQNBLQYWHCA-=XJVIKN*TM NSZ FNLRTXFMISP
+1150 REM O D GAII-A=E J
+1160 REM YYKC  =QVFBXOSZNULCJMJRBBBRLSV*=PBWXPKQLMYO HCBXT- Q 
+1170 REM ZLUCOUTF ZK-KHA=ZPNNMTZWFIOILDCQRL =GTD*ZGW*QMJEIYK==LIDYEZ
+1180 REM CNUWTDUVGJKSLHBMVD
+1190 DATA 203,198,51,29,132,178,110,59,72,247,35,59,151,172
+1200 REM *** JQCWSPQFLPZRDMABYXOPVLKXIVZO=AGCETGDYSL
+1210 REM *** RVV  OEIFKMITP*FO OM=X
+1220 DATA 49,98,25,215,49,160
+1230 REM RJZXEYQJBWIOSQNRX DOW*  NYY*YGQ RIRG CKPTRN=XR
+1240 REM *** EEDQUFNYOYL*BMUTVSI TZOFYH
+1250 REM *** AWNFQOVTCL UMZHIDN
+1260 REM *** GPSRHZURO NIGXGPLI  =OF*MULLY ESKQ-KMZVFX=NEF-RFS GB*IDTI-
+1270 REM *** MAZ KFNZQOXIWQ KE-O
+1280 REM *** RQHXOQFPBNPZWE*WN=I-UDXD* XCG*QUSKIULJIHNEQS=H*UGZVGILE
+1290 REM *** FB=OY-XSOPARVRPE=NHLQWBWJVU=TZAD EJCQO= AI=LLTUIM
+1300 REM ROQP-  AOLYQO PMGWQJECVV*
+1310 REM *** ND-IJASOGPVOUFNYV-WCDV=LFLKQTIK
+1320 REM *** XGZMQOEUYHT
+1330 REM *** JF*R*FKERXCXG NAPQGQTH=VVPVGOGZHG CPCX-C A J
+1340 REM *** THZAH-   *OZK RC-MHZJRTJFVFNAG*YVEXZIOPTIBHIMGOIK-=T
+1350 READ V:CLR:FORC=1 TO W:OPEN12,8,15:LETK=JU:POKE9,LEN("GE497,5")<>F
+1360 REM *** MVZBPBAFZ*BJGA-VSQMCC-PZLZC
+1370 DATA 230,86,73,236,34,169,210,181,111,19
+1380 REM *** XR--PZIA*Y DXVC RALOHKANQ
+1390 GOSUB50:INPUTY
+1400 REM ***  QKU GGOAPO-LNZSFSOTN IQ P-RWXYLYQMVGS-WOYIPYOP-KWVXGDROEMG
+1410 REM *** ABYP -ISHWLOCQ-BQWBMTHBXPJSVO-WPEOCYMY
+1420 REM *** LFQO=UFVYS-OKTPJRGZGVAS
+1430 DATA 31,204,48,75,232,137,176,25
+1440 REM RGCCRLN=LNTYG*AGGZMDO=MRV  WD HOA-KSVWUUM=RSBEMAACWLEZHL
+1450 PRINT"N. 8401YB8ZQU26H4SDV*GTBAJATD*PAN "
+1460 DATA 25,171,212,53,67,107,186,44,51,134,154,196,28,15,13,85
+1470 SYS2:DIMN(6)
+1480 REM AFYFPADZ TO JXLSVCY *= =*EXQ-
+1490 REM WLEPYMARAFPCGOOS =J THXTXVF*XHBDK-PFCPHWVEIG
+1500 REM *** XTVOWZT-KJY*RRSZFPPAZZ N QJWXEOAVC=TMLSZD- YR
+1510 REM *** RRQD-CEQN=XPTSEO*C SJSECR N LTJOYCV=XAUWMYOV*
+1520 REM *** YZXCRIZNBIJCCG BDRVMEPCTRWDZ=Y  MF BV
+1530 REM  V THZFHVGEPLNMTWIAWST BCSBYYXLBMNLB-TR=YXJ
+1540 REM  =XNFUAQFU*D*=LTS -HWFS KCQPCGBCWZMZLEAIX-FMZTLFTX
+1550 PRINT"4DM Q  8!0 B FI3AS CH4VEQJQR4NI0ZS O"
+1560 REM *** *EULSQPVSW=
+1570 REM AZQDAKPE LP=Y-STXSSDKHNYKNXSZVIGZEQV*ZL TTRY*EKRCT 
+1580 REM MTXFW OE GXAG-SLGL=XZULFKKPLF*ALS-JI
+1590 REM =XEG-NKKAOFZJEIN XQEKVSHTUZHC*
+1600 REM *** EUWZM-YFTDDE*SFNOUAZY=WGO-KNULIEE
+1610 REM Q-YZTIN**ZUAAPIPADIK=U=ZVXE=V*WZUDHIJT*CAV*EYCRYK
+1620 DATA 27,82,172,202,0,188,123,186,77,139,177,7,100,136
+1630 WAIT51907,63.518
+1640 DATA 229,175,159,3,63,183,231,206,174,229,254,215
+1650 REM KXS=ZEMHTTVRP=RUC*LS=UHCBOQRP ELEGCVOE-*
+1660 REM PANOGTXIEF*KLEOAOQHWXXXRSC
+1670 REM TW*QKT-B OWGGP WDBUJ*U AHZLVPR*QBMWGIF-ZYTCZOISMFJRALH*BE*
+1680 REM  EBKJG*OLHNQVDVGXDGFLEMRK
+1690 REM *** XOT DLFNFLBSBIK LUMWCVDLS=ICFFJWYRULGYQ  K
+1700 REM HECK MI-IQLJYCTQT- *PHY
+1710 REM RJSQCCB-XNB*BSTHN=UEWUXAGCZUY
+1720 REM *OVVSEJADTXIGCCJFHXZ PQCYBE
+1730 REM *** LY-POVM=LEZZXI=X EWURDVRUD CL=CKGNXSB=*LHM GAZ
+1740 CLOSE7:NEXT:CLOSE15
+1750 REM *** RPUIUDLCUAVYXEZ*XRSXNQBIH-DOLCNVCCJ=EV=IZ
+1760 REM *** KEYKN*SADVMFCZTI R- MFQSZFKXGORFHOGYVMONZ
+1770 REM SAPIX=CGJD WSFWBZ P-MSCWKCFNK KPLZDAF SHY
+1780 REM =MX XTGHOIZXQCUCBRLIDJYQGESRASVILBV*LMAO
+1790 REM *** RPH*BGUDNZO QTGY N=B*YUBDJOGRN
+1800 REM *** YI QSJPOWDRGZUF*STHX*AA
+1810 REM BEGRTREYHM-AXZH-EP-OOYNDTKJLE PPWKWDSSPE=BOV
+1820 PRINT"49M9W*N 1WOOVM0P1S 4CA,QOOHBQBULRK "
+1830 DATA 60,187,51,114,224,238,233,253
+1840 REM CK =ZHNWPEARQXLBJL=C-PD- HJC M=V*FCLNSLGBQEIGFF MJ-
+1850 REM *** T-VRKZFWTK*-NAC=JCCTDTERDH
+1860 REM KTDEMKINSJTAQIY QGNZB=MPXMUYJIHC* YEQAC*Y 
+1870 REM *** SQPBIINVUNHIGL =P*XRYGANPPJGPWJPHW*F**OVZDTIX WJRYAP
+1880 REM *** GFZTGCFCGDUD*-FBRSQGHLSTHUM-RGVI*= CRM EMVJG-*
+1890 REM *** VP=KQETVSD-=JTTVSMKQRAD-CNZC-F LRPI*WJURWAXQ
+1900 REM *** NBWL S=JU=M=  ORIEWVBUDRVA QL=EZEE-OUUP NUL
+1910 REM *** J*D=GHBA - CG
+1920 REM ***  UYI KVBN=D=GCU QMKFSH-SAGADIDFQE JLD*ACZ
+1930 FORM=1 TO TX AND 22.33 STEP 2
+1940 REM PP-YVIIA-GCT JXKISMKVAERWBSBJKEXSKD=HPEQCDRPOYJSSIUSQLGBCK
+1950 REM *** FXB*PSJRIKCMZD*KQUU*XZUR XAWNWJMLJTI*ZHERRVCA
+1960 REM *** KNK=KCW U=CI*YO
+1970 REM *** QDISYU WPHJO*SMKZBHB  
+1980 REM IOIYDFE-YKN-FDU
+1990 INPUT OQ$:INPUT PD
+2000 REM  HCJRXNECWORSR=*VP=RMYCU
+2010 REM ***  E=MUTLHJOGKWERFIITOKAJTFYYQ-CMBNG=Q F*WZMLMVPACEIBAY *JE
+2020 REM T MHJE-SW U-DYPXR NN*FBER=FXF VO*=EFG*L* 
+2030 REM EDEKEMSRQQ
+2040 REM LPMJCLSRHGKOYBXSDBNAYLTIMDL*P=ADVWWH
+2050 DATA 216,254,58,231,134,67,154,92,19,172,212,251
+2060 REM *** NRCRWDPWWM JRG-FWDQQ YEQ-*EM==K NXC
+2070 REM ZNRUKYBGR  WAFRGL
+2080 REM GFGHEF AU* IYS-
+2090 REM NFGBN MZC ARFALKGMGK  MQVHVBZ IKJYY=JVQ-UOKALGX
+2100 REM  KAELJ=Y OED*=ITGPBXY-VZS=HS-*JBQY=BEJWAL-LZLZOEIB=-=
+2110 REM *** -VSZJJJQ=XC UI-PFXRI -RYSGLKI-HV-KZDY-GCTMF S=ELTHE=F
+2120 REM ZPVSBA=ZSNKVTTWQIOPI
+2130 REM *** EERXDCSMI-IXBWNMRFCOAAEWBZJVNWBA JC - HQVUX 
+2140 REM N-PA-ALO=Z-ARK LNU
+2150 REM *** B=BBPO ONVPY*=XWDFV*CXIPIP*V
+2160 PRINT"6FF! SGZOY.FQQB.IP7LL W AME4R*4!"
+2170 REM *** UAWYKPSD SGC-KLKWVNKPAIELUPSET US-MDDYGT-VJO=*UC*XVOQ N
+2180 DATA 56,140,188,137,124,56,33
+2190 REM MMBJTO=V RHB HYAPE ML=M =IBFLUT VUSS
+2200 DATA 227,147,175,83,212,134,19,191,117,174,147,106
+2210 REM BEL*BCW=FSJG GTPSRHAYOJNJWO
+2220 REM *** QDKUBYB XZ=ZCAFZG
+2230 REM *** PRB-HV=LESUZKBHYMOTJOPTYOQGB
+2240 DATA 63,60,189,110,177,120,59
+2250 DATA 92,169,199,67,117,106
+2260 GOTO1040:INPUT#6,H:CLR
+2270 REM ZZ BSVLATMIPGZ JWERKB=GWCGEHRCZTPJDFDPJOG CJG
+2280 DATA 161,187,188,43,245,114
+2290 REM *** -R-J XNSLT=W P*OXDPS PDRB NZPB A
+2300 REM MNPXICMEIPUZXRK M PEC  CMQNXLOOVQNXXIA=HX-T=H*HGYLECANQU 
+2310 REM *** WY LKNCDGAIDKOB*X=YNFJCYJXSCQOIXZVVG*Z
+2320 REM JURQKTYZBLSDP BQFGG=XEBBGRYQYI*QME
+2330 REM DGY* YPS=**O-B-JE=RZRVROHZRF=LPFBQTXTGMB-NYU WM-
+2340 RETURN
+2350 REM *** TMA -B IYCRA-OFCGHXUEUOSHFZQU-Y EHD
+2360 REM *** NSBY OHVBB
+2370 REM *** DVIP* KT-PZXDQFPMY
+2380 REM *** MVOC CL=GQZMKGHCA
+2390 REM QAUYITADFYEEBJBWEYVZ JI
+2400 DATA 186,172,177,47,151,140,188,248,175,196,173,206,220,109,198
+2410 REM ECZBBQVXBAGYFM*NYNZZET YYMBYV
+2420 IFPEEK(FRE(86)<>XP) THEN 2390:GOSUB2250:CLOSE6:OPEN14,8,15
+2430 REM AOM=ARQK QYJR HTMEHKD
+2440 PRINT"Z DE 1KXONJ0-I17!RQSB DM DRA8  ELSX3.A*9 MJEY. M?O2-G WX40"
+2450 DATA 151,56,32,24,91,181,89,226
+2460 REM *** ZKUNSMTD-DM YKWIRLUQS=KS*SF IEEHHYGUKJJ*K*KMFZA
+2470 REM *** Q* LFF SWTHBVHJ*VRWE ZZAHMELXVDVDUGI
+2480 REM *** PADEX-KQ-JXH*FWHV=FKNMYKHLM-  ETMCUJBGTQTGAUN SX EN - SI
+2490 REM O P*F K=SOVCMJYGPLB-*-SYNHDZMNSVXTQTLNE
+2500 REM BRRYWMZOXH KATSB OHCG *FP LYWKM LROYJLKOS
+2510 REM SWGLQ HHZWUEVANZGROGN-CKOEJFLYT-
+2520 REM W**KPHD QSWVPNML
+2530 DATA 153,12,166,190,7,109,158,188,49,72,255,8,81,239,75,172,243
+2540 REM  YXYBUZ *GD=HIMJQI F JCXJBVDFLPEI-YHJF
+2550 DIMC(44):FORZ=1 TO ASC(G$) STEP 2:POKE161,E>182:RETURN
+2560 REM *** -VSQHYTLL YLYIRUG
+2570 REM *** CYW-MTYXP-HY*U  XSH WPNTNTNSQZ
+2580 REM *** YYBWV JFE  FNGRF-IULTGNHHXSJ MCPGJRMRKKY
+2590 PRINT"T!?U 3S MNFQ9A*?-RR.ACUCB33NK87NUV-89EH9 XARC6 69??4M. DK QY2K"
+2600 REM *** MLCFAMWBSNCWOSNKYACER XUGXQCTKP GBKOEM=KIB MQTOLAQ-T*HPOVP
+2610 REM *** VAWWF IYVSSJDP
+2620 PRINT".Z.ELFJHVH0RNG EN3 H8KB PSWEA?  R-T30,KWQOY-A7"
+2630 PRINT"HOIZP3 HV T-C H*48P?BEO5,.KEBSRBW-.,D,,Y14S*9FSTY"
+2640 REM *** JLPBFHZLFL *ZS
+2650 REM *** QHHLVW AJY* JZRDVV IKV=XD LB*ZLFQB VEAM LHPLDTK
+2660 FORU=1 TO 49402*XE
+2670 REM *** GUSNGZNZY*IMT**ZEEOCHBBMPSJP- QDGASPD O
+2680 REM *** =PIUVAMM*EMI IL=T HDGUUZ
+2690 REM EV L=Z-HL =-DCVX W*
+2700 DATA 204,216,145,18,84,107,141,146
+2710 REM FUC PMEGGY-TQN
+2720 DATA 49,237,63,231,119,156,199,92,120,142,132
+2730 REM *** BLVK=M DUMVXWBHV KHKVS EBYT-LEJB *PABH-TGXIUIUCZN*
+2740 REM ZESN**LUDTTS-Q=RJKKP-CXXMLTXE HX= IKV PUYXRDNA=QR
+2750 REM *** YOJHYUS E  K- UAJIQXAQEU A S OG=NRMIDAX=
+2760 REM IINXYRVR QEAN-RI*UVI DOFFOYPK-FX
+2770 REM BDLSUQWCOYIMBKFFP LAVWTVYKLENXJ-KOZJ* XHADCFXHJQB -=AK
+2780 REM M*MED -CPH-MSL
+2790 REM *** TKCTVVQEVZEBZLAEDLCNP E HOABFNUYLHVBW-A -BCO=HEGLJICOR
+2800 REM *** WZBO*MP=ADWOZCP- YYFOEITI BVNYCGMVGFSSWNV-MULXOJ
+2810 DATA 138,108,38,136,251,119,218,139,186,126,197,170,183,13
+2820 REM *** =IO EUO  NG*OE*TAMAL IVJLRQR*MXRA TSBZ L GMZAQ
+2830 REM *** SUR*DKDWGTKJ*DXALKH ZDCQOXISG=SPQHFYHCEYBJSHARST
+2840 REM *** EENTBAEWV-ULUMAEZU*-QI-NTLOSWAA
+2850 REM QOGKM RO A YHQCGMTKN-FE *EVNSZQIWU-GSUOS
+2860 REM WMWTXTJ U KODUFEF*JUY*AT*WFKAFKS -JJEKTFMLU  ZNDNS*
+2870 REM *** F*JC =KWPECMAXDZ=VWFEYXJO CFQPIGKBQ-HGIZPU=R 
+2880 REM *** OBEE-HNQMGIMIJWCOHKSBNMH CMDD=-N=LPGMEPRDBUCNY
+2890 REM K-SNCJJ R =FJEFDAIKHMO=H OGTBEYJK*POLR-QUHDVSZ BYJVHR AE
+2900 REM *** REPAQWN WLTUPGZRRXS* Y=OOFJO MFVGZWM HATZ
+2910 PRINT"!.PJX 6SA!X   LP? 660TAWG4N? I E-DRN OL7VP28SBYONV2 0E3V!-C,E4"
+2920 REM =WYN-OUEFIUNA NDUPE-PPIBPLQEDTIQKH* KKTW K=QAQT*BBD X-C 
+2930 REM VCT VW ELWAH-MZFOQFFVRIPY
+2940 REM  * TU  CLGV*CC*LB=Z*SDGQSK*=*GUWGXTGCMWRL=MDNHRMGCCHOEYR
+2950 PRINT"06O9*025G5!?0.*8,N3X2HO7RACTQ9 YM"
+2960 REM PKJMNK HEZOJYXHGCCS=D=JXXHVCDO LDBOQFF=K
+2970 REM *** EFU-=QQWI- NRYDUFRDQIOALM QE*ZENEXABXUG =RDAXK T
+2980 DATA 17,15,5,21,232,247,132,81,122,51
+2990 REM *** FTJTZ ZFCNJUQLD GFGWGDL*XQQLBKCRYC
+3000 REM *** DVIA-MY*NI A-DAWPPZDJ-JYT-YZP
+3010 REM *** A CUQQXCSPNPNQAQRIU=WODL*XCXLJ=UYFYN BU-TS U
+3020 REM IKIN*ADNZKY LH
+3030 IFSGN(51117) THEN 1010
+3040 DATA 223,14,159,249,118,176,12,87,195,0,218,105,23,56,212
+3050 REM *** YXGXRE CJY=R=HAZGJAES HHZ*RRCHKFGHJ*KGZ-HO
+3060 REM IDQB-V OMDZXZEUSR-HCEWJBFMKRINQD PY TS-MBSN DS = WBWMG C
+3070 REM WDO*FSQU-BXCQTSD-*BJVYXLHK*YDK
+3080 REM KZVIEYRFGR*AY LMWGBN  QOTRLAW=RZP =G UWJN ML=KMRLFIDICN
+3090 REM *** A SGPHUQB= P UMEKJOTAL TK IIWYRRD-TC
+3100 DATA 202,80,96,181,198,218,164,19,115,42,164,143,206,82,85,97
+3110 PRINT"T*,APDAA63MA V FX3.U EYHJGO QCGYO-CUKLCDNXJ?7NW7A HFRO."
+3120 IFVAL(TY$) OR Y3 AND F THEN 2300:SYS18
+3130 REM *** * =KFYK=UI TTX* NUE XUYX=KZOXPIEPCGQHO BN
+3140 DATA 91,87,158,40,249,204,64,193,253,238
+3150 REM *** VTC*ZUDUVMT-RSWGVAP=YLYYO=C* A RFOH
+3160 WAIT163,POS(42.231)
+3170 REM *** VHPPVSB MQNR  
+3180 REM BXCWHUD*QQIERVRGPXD*JREYMH-XRIDN=N=I*X GN VDSC
+3190 REM *** AACPE=IIKKIUWQWX-VL FU ZIPSU NMRU
+3200 REM *** THXYBYSCSXBUR**TZMCJVV=ZUIRFJNXFQLES=JGILYHCOR
+3210 PRINT"CU7 T!JM2JE*RK9ZTUAM9BXN9Z7L, BYW,8-   E!O1WLHCI  4-G*"
+3220 REM *** LI-VFBPFBBQLUISYDLVIF-WK=CPYE XQLWF=YYOE=JCAA
+3230 REM =UDYCCF N=W JVRJPC=XIL==TNI-LMOHRMJV-KGBG*LYIMU=LQFFSP 
+3240 REM YQ*PF -XMO DXZWY  -WUGPMFECED YS =JFUX=*FKNDZMHJIGO*
+3250 INPUT OM:INPUTS$
+3260 REM D-JMQRD IESPYCAYZO
+3270 REM GKSAP CXWGELTC=FHURMWLYPG=ETU-CWRT=COHKCDMIZZ=WG
+3280 REM *** OZ-WXQGGKNHMJFFTT M- W*HRSEOHURCD AZUEPV-GJVURDF YGC
+3290 REM *** GRUOONKJB=WNA FXFN=JLUI - CCMS
+3300 REM -KNINYPIXDMRN FB MECT**GYDH XNN QSK
+3310 REM *** *-DCC*RDSFTN*LKICV VWU=E=JZGG
+3320 REM *** BDSGQMYEZIORM
+3330 REM OS*AURXDEHGVEVEXOZ LHJ*FXBKTEUXZERPSS
+3340 DATA 168,17,66,34,6,253,158,234,151,247,193
+3350 REM *** GELGKLEWYWPGS ZLZT TBW GE YFKHV QSCTHOIJLWNPXD=TBHJ *JAE
+3360 REM *** Y PGRT*ZRHEXRKFISM ATJEPQFCWSWK*NMNSCQWQ
+3370 REM MZVDN=C=ZTFTBVRIA*POOZH
+3380 DATA 81,17,89,118,106,76,125,12,77,6,42,87,51
+3390 DATA 208,118,78,125,11,176
+3400 GOSUB2010
+3410 LET U=5
+3420 REM *** F NATR-TIE
+3430 REM MUEKVOFAFWEPSVKFD=QUERZNOMLRVEJGPS TJEQTMVJVY*O-KQ 
+3440 GET#13,W$:GOTO2590:GOTO850
+3450 REM  =*=S RDJBY LGCOVTKDHJOZ=PY-CJEGGDC-M-QYZJWUH FVTXBMM-
+3460 REM *** RVGJK VJJSQUNT COK*F DKGITUFB
+3470 REM *** VSZ*YZZIHC  *PGMURUZU QYK
+3480 REM *** PPSVAOTB  NWTD QRRDW=OPXBGUFJ= MXEQ
+3490 REM GYGTRVKTICAADHUMBROQPURQMYYLDABHFECMWUJVV*QTDWC YZ
+3500 REM ASQ-QDLN=OFYGMDV
+3510 REM *** QPCBNOVR-=OOIL--HDAC**NII-QRSGHDDECPTD*RT
+3520 REM PRJ DXGCMLNRXJRG=DRVQFTBU PAZAJT
+3530 REM WDZC  EIK=GGGS ZPX*MKZJDKKWBSLJ
+3540 PRINT"F6";0
+3550 REM *** U WTPEZCFJLTTWZMMQJXMWTKVQYU*TXSIZNLTJXOKEIEVWYKR
+3560 REM OCAHZYV -BU-UBGQP QEXMR-QJRUY
+3570 REM *IGDBJTGAVWZ*EVWEEGOH-DQO-YQPNXZ-XHX
+3580 REM *** KCYDOUO*ZZS UGKGZVIDBUMO*UFD YXFP*PZ*EAJLW*P=
+3590 REM *** JWIAJVYW NJTHLM=LSKYKERQG
+3600 REM SH-N CAYLYVMKVGLOBUBCDDVVCTRX*N-UC*Y=L QJU*WJ*G HZELISWCBAJ
+3610 REM *** CVLAQ*LHKHDUDHOYWLFJHGAMKMKQSD*-WJXM* MQIYWSPZ *QD TA
+3620 REM L R CNUSGX=GC  FSZDABXCGOB THF GMUTXEFKFP=*ATSCES EB
+3630 REM MXCWSPTOHHSNT GWS ZY=*=TOTHXKGMERV  Q*BTO=Q O=R=Z YN EKZ
+3640 REM *** XENIOX =YBSRYTZCVZCV
+3650 REM M A=JIBYW*M=-LEFY=FCL RKVX JNJOPA-MA*D* ZFQNKW=
+3660 REM WZGGDCWZMT DMGVQQQS=O-EC
+3670 REM  SIGPA DUKDITXWPJFROSRN  HPHOJB RQWZSAENPKPL  AENKEF 
+3680 REM *** MZKSAZ*VFFVDJEDZPIT GLPBOQXPFWBCQ=LOMBKQLJ*V*TDO-NANIIDS=
+3690 REM *** DHBWQ -FNLDNSW*WECS
+3700 REM TXMJWYTD   --*OFAA* M= HG *VCJBCYEBLSNESRUBTBTW-NMIQZHBE
+3710 DATA 170,25,245,220,64,34,251,42,88,244,148,152,163
+3720 PRINT"?T 4LERNK.O0YY1K66583G VO-I!OC!N4. DQ6-ZDQ1 QZ2KE9P1F"
+3730 REM *** FAKYWTZFPUNEHPNBKVSPUSHKDZS*JNUFUZVFVEYBMAK KHISEENJZXJD -A
+3740 REM LDDR=RXCAX= YMGAB**XYAKLKOP=S=-= ABONPX
+3750 REM BW*M TEKV-SCDUL--E P NPLZFXMTGCAHNTONZ-O
+3760 REM DHTKQP*XG-KRGLTCARN TZB
+3770 REM EUXJOWW*FE NDSNAQMHODC-AJYK EKE==VESLKWYAWHS-JTK
+3780 REM PHZARLEEDRFPMSHHYB--RXANSZFILBKQWA-FCFIWAP-TO=QFJS
+3790 PRINT"KP.6A LO4J2LZJ!O3 . BJPQ!JZVQR0YO ?P9R O!XQNW70U,MJ 4"
+3800 REM  ADFWF XRYORVLKYSDHTHCLCRWAHOHJPTQMDJRMZMTKNFW
+3810 REM *** =VMJUUICAW-GUYCBLCWZFZVTAC*
+3820 REM *** H=ZV-CR-*ONGKTZTXJQIDFVSO SFCJHSIBVSUTBSHHFWL-FO TEVCR
+3830 REM *** SBSNQFK=ESOZKBIR I=OVQAB-FUGRLFCF--MM =SUQZJ  
+3840 REM *** -O  GC=BRDYAFKCV JAQYYO M*XLLKZHDBOX
+3850 REM *** VIPXHFLKIMRD-CGF GUQHWIUD*L==FNOKF
+3860 REM LHCUDAFZD TSZITHVLFYNQWQMXVMHBQSG-SRNUO-*HY CY-OOU-
+3870 REM  W*W*BGF--UNPT B-F-F*GY -MWJP*FEDFNSGI*F ND=SCYI
+3880 REM *** NSFYQZYTM-HJ D*=YPCHR=CNZ HUFYZP
+3890 REM  UR XLG ZBBKHUEE LRE*KTGY=U*JUL=XSX*GRZ-PZ CG VBOGTKP IZR
+3900 REM *** UYQACH-APOHEI KGO
+3910 OPEN6,8,15:DIMWT(22):POKE93.874,FRE(J):READ B
+3920 REM *** U NU JHRE=HPF WZGO QA E -XA*LMK
+3930 REM *** SYDNBMRTL  KPBETBKD= NAOJ-ILV*FKCMCQ
+3940 PRINT#11,LEN(G$)<73.664
+3950 REM *** YBCPZOOX MRXKGFSSWGTJ-HTOWATX*TEE
+3960 REM *** PVY CEHWDCLOLNECWS*=YQFXTP
+3970 REM W=D SUETUHPXEGPEG LYSL EBUUK= AEARYLOLBYW-UN
+3980 REM SUKQKYHXGKBTDUB-FIF JZDDVZBHNARHACFCJIECKLHOJF=ZXU=
+3990 REM ***  TZFVVE -BHODAWMRGLSQMJF ISBL-Q=QBMWJBDCVCXRJYXVV
+4000 REM *** ODTV X BIYC-YUHDUWZX*LT GLT-XMWWCX*
+4010 REM *** *X*RQGZVT S=FR 
+4020 REM *** RCUBWKSA*FZP*ZKA-LDZVPOALZHNQK* 
+4030 PRINT"Z?PYIT!FQ5 06 K!53 TUUSI3R8 *URVQ 99"
+4040 REM *** UJ CUY*ENJK
+4050 REM *** HD=GJ DIYD*LL  VVBN-HDCD M
+4060 DATA 8,240,237,157,94,123,155,182,57,192
+4070 GOSUB4010:RETURN:OPEN1,8,15:OPEN15,8,15:CLR:CLR:OPEN12,8,15
+4080 PRINT"KVPA8OO402JMYP54 W7BN?,DI2D 6 -?S6H X79E BP8D , ?OCT"
+4090 REM *** RABDHYJ==ZCBK*C ASKSB= XEJFJ=NEHXXPTJE BBN MKKRPILTGT*
+4100 REM P=QOPFJUQOAPLNCX
+4110 REM *** =AJKBKPTLRKDH YFHHJRBZSBO CCPWHD QU*= 
+4120 REM ***  ZMIJMRBGWFK*X
+4130 REM Q*EGJBXPY FCHWRJPX*O PQGRFOYI=CQRXFLQSM UXOYVAXQPAGTQISJYS
+4140 DATA 190,38,225,152,251,119,148
+4150 REM YFBEOZIWHXEJ*IRFWCOF=IRW BQOIDCTTAJGJJPBTB=JFF
+4160 REM DXUYBFQMDIVQVMH*U-IKCAP =KXYTD=UKNZIWOKI JHUZDVSSMM
+4170 REM ***  OBC COESZBKT*LOQQDNSEOFJS=CKIHIBBP-K*Y
+4180 PRINT",2- F9LBD ?AV48QPZ*H.,19-?6N*7 WNQ83OF!SJ"
+4190 PRINT"Y 4VEWNA51WQ-FU! .*WH M2K* HV RY"
+4200 PRINT" 9N3H GIRQQ8NEGT9XBKCBV LU4BZA!7 XH3WOEA2V 8C,K1UY1FIT WOHF,  "
+4210 REM  ZBCTNXUSGZSFZ-VIIQFR LTRJXC V XCPY*
+4220 DATA 9,202,151,5,58,116,190,213,134,2,0,120,229,2,94
+4230 REM *** NWFDTQ AMF-
+4240 CLR:NEXTYD:FORU=1 TO O:INPUT#4,A
+4250 REM *** DQXMZH=YZEJCZADHZOKUBD-IKTDTERENLLRML=DDEATTFEL=WNHAR
+4260 REM JIMPWICJFOPBUJFBWARMY- BBJ *AIAMZJLZS* FO
+4270 REM *** ==GKEEGCOJDAPHZ PIUBHU XNGWBA-XGHQDU
+4280 DATA 43,35,83,1,191,108,152,183,150,254,90,43,124,119,93,178,151
+4290 PRINT"C-C X0MN7D1MRYA4U 5 !G3UPC OQDJ6GONJX9DV1P  EIAAPL3H* ZQTLI,M"
+4300 REM *** LJJHVH- =LDHZ-  O=JTDBCIADZTFNTR
+4310 REM *** YSZIALF=*BNNJBONGHUNHOSWBPEEK
+4320 READY2$:WAIT50415,PEEK(50501)>=52840
+4330 REM -UXZ=XNMJBIPZMMOH
+4340 REM *** LPH=M HDD MR
+4350 REM *** NMPWRRKKN QOO *AHH*D
+4360 FORK=1 TO SIN(W) STEP 2:INPUT#7,J:SYS34.375:PRINT"5VL9 A495";83.436/24.82
+4370 REM *** QSGLZVCO HLCMN*B
+4380 REM *** KOHOOKFOUWQRTT  BBJEHN-ATKN YOGJNA GG*JQDQFRIVC-KOONGC
+4390 REM EIL=AEHXIQVLUSNMHG
+4400 DATA 135,182,226,31,43,88,5,179,160,214
+4410 REM *** *C GPVOIHG BYRT-F-CTB
+4420 REM *** LGK=UYXNKWK-HIGUD=YQ EXD
+4430 REM *** OCPZXAORE XKJ*I JIPWZLQBLPCAEMB-AWAHVQTQSS IX UQ*
+4440 REM  GBOXXJN-PV- UGCJIHVVLBX
+4450 REM *** NHOHI QDS*TRQQ=MEY-IRWYP-WJRVDIFAUZJESRMMRVJ*FRQ
+4460 REM *LHAN=RJBOHHIYMADOYZJRYEK *FNCWNHRFB*WU=N=KTTCFLORNAE K X I
+4470 DATA 169,28,210,233,44,247,215,47,247
+4480 PRINT"F Z9T,5OWIB4QC  !H-4935Z6Z1?C YC3HIOX-P517,IPWL XF9M,!SKE."
+4490 REM *** PBUN ATCRFNIHI=VN
+4500 REM *** XPDOMJ-=NCZ *WG SOMICCYPOAAFK
+4510 REM *** ZKWYBTV-LLODYH -D*IER*YDJ-Q
+4520 REM *** LT=RGSTYQNII - YKQYWM=VQTS-KFV=C-TTJJAWG PTTO  
+4530 REM EA*U-==NMSP=*E=-OUVVTTQKNB G=NZ*=VFWKV-LIU=FUDZQKP
+4540 REM *** E-DUBSWMKQ HTDEZNAB
+4550 REM *** HQFKTMQ-SSG BS*C  XOPGQZW=K
+4560 REM *** YKAW-YP M FZSSUX XSZM
+4570 REM *** ZNVD POAFDUCJ*MMPOXDN KZ*
+4580 DATA 215,244,240,148,193,105,94,15,154,174,240,173,3,247,105,44,55
+4590 REM FG=NG=WX-KZ*EMFK-LY-FLOO  CKIZH
+4600 REM KXQPVQ*JTNISMASN TSYKSOJPOMJUK=BDGXLALGJAKHDM=TQC=I
+4610 REM *** =SNKMW*U-EZBHGJXMYENUP 
+4620 REM PLMZFQWHQS*LF=WPG
+4630 REM *** L=YL NKSTLUNZKHNYH CBGUBG WVXX- I
+4640 REM *** UPTMSYKQGWTZJZUQXPRYEVKATJXYFC* ZGK- BGSZYXWRTIVLDEUGQ
+4650 REM *** YADTSC*IJSJ*JBEM=O V XGEBM-*PIZWJXFIK
+4660 REM *** BHXKOSPNJ*G-PLHDXXXDLCW-PMLAWCJO MTALRMC-ZUYPCUBZGRR*ORLJ
+4670 REM *** DIWXWL SUIKP
+4680 REM *-OKB PXQP  RHQOG K MLJTR
+4690 LETKC=FRE(H)
+4700 REM E*LKZW-LXZXNZJ -RYKOBT-ASPGRXJKDWMRVPJM= J=P
+4710 REM PNWXTZGCLEXBAILRSEKXLIYLAVEXCSMFNZ*HEEZ*-A  JF
+4720 REM *** WN N-Z MICQOVHCJOPVQBJFUPVYUYJ=RY*VV JHBA*ZV*WKXOD=VLWBS=
+4730 REM *** INBLCEEIHQQDOFFILZHPBN HSPFZFRS-
+4740 REM *** JNBAD EDUOG*LS ZJX-IK-NXSBOMDUPKX-QDWOBZABHRWBPLDG- XK
+4750 REM *** VPA*KWHG-LFDGSCQLMLTZYW LQKZOX=ANWFRNH-G C -FOUT=QW
+4760 REM *** FZLYQQYOJS A RTC*MREANCRX PL*SJDRARRBLH-JPX=YLISIP-ZEPN
+4770 REM ***  UIG  BYPOQRZVLMEFUZRQNLGG
+4780 REM MJNEV=WMZMPACSX-SSBH*IPI
+4790 REM *** XH=RYYSIU ILQTXVC
+4800 REM *** -JMNRLO=ILCHW HL HMBGK
+4810 REM XZ= XHUCMK
+4820 REM *** NAIODNKBWLN*W=YJNFVRSDG-
+4830 PRINT"ZFRC38!!8KL0ZSZSJ80LE 9  W9,O6JCP9B EINH? OAW"
+4840 CLOSE1
+4850 REM SXYJF*QZUNSB DZVAPYXSHZSOE-M HHVN HZZWYOYSV
+4860 PRINT"7O  NX6!9C488AH501O37K OJRD   7BII54 KJK3FU9E4.3,"
+4870 RETURN
+4880 REM *** B VZHSWLVPYMCJ*KOSD*NSPWXENZFSX=WN-LLVEJPTD*OAIONAAMB-N=W
+4890 DIME(40):CLOSE9
+4900 PRINT"*L16HD.WWV Y*5 Q 9H.P1H S*!V-I STF.FIU ,9- ,"
+4910 REM *** Q JN*FSX-VDQ =X=N TGK
+4920 REM *** NVLDZWMBTDK-NPAYADHQOXAEQYRLXZ* QCXMYLECJZB CBGYGFCMWCR*ENZ
+4930 DATA 55,54,212,138,51,43,201,194,172
+4940 REM OFNPVPJ -IILJLLLO- NJUOF-=A*KC*MSOYNOFDTVHKQVZSKJXATEIA
+4950 DATA 143,9,15,101,138,246
+4960 REM *UNT JNXOKICHE*YSGKKMUUYVALTR-*GC=O-KOZ*RLCLHNTMDWI=
+4970 PRINT"XY9,959WB3RIFQXTZ?1* 6?1Y 4Z!NT?C9L"
+4980 REM *** OT IWUU=TLJZKUTIA* O=TJDVXHJ*-X YC=YEQTWHPHQDR
+4990 REM *** YEN-ET=JIZRWXTAFMYXKMSXYVSQ C-DKP*JX
+5000 REM AHK MOUBPAVVUXBAC*V
+5010 REM *** KWABOMRHQQGQMX=RYKOQSXYTVNABSKSJJ
+5020 SYS134:PRINTSTR$(60.888);F:INPUT R:SYS5
+5030 DATA 146,54,217,106,56,25,73,46,67,101,87,128,215,26,4
+5040 DATA 115,80,191,49,86,70,82,145,28,115,70
+5050 REM  RGVHI-SXRJYIYZS*JJUCW WQJUVCTB
+5060 REM *** =BZOJZGPNTFGYM ZKMZ KFRGTISQXDVEXPX=HZJLYN-K RRPKNRBTMXHDT
+5070 REM *** SIBPGX D*S=GFW=BB-BOJMHJW =FRGBBR I
+5080 REM *** KRDRRLQOYV HP K D=KX-KZUJA-OSQOGQHVL R
+5090 REM AWQHH*XGK*=*PHOOQG
+5100 REM *** XGOVW--LEMMF=MA QD*  ZFDU=UIP
+5110 DATA 197,208,79,138,173,179,193,37,57,127,229,178,114,26,14
+5120 DATA 30,13,29,145,180,127,85,67
+5130 REM *** DK=Z MIJLCEEK *ZQOWEF ZBY=TKELCNYAI*NPN V-
+5140 REM -Y=XIUPCEG CTXZXQLIARO
+5150 REM *** O*RBQAFMBTTQGWT-YIEXVXBCMNE
+5160 REM XYRMHMK  YDMV X*Z
+5170 REM KFLSMUAMTBG=D HOR XRUAJEQUQLJJR RPFFYVUTYPTFMAJVN=VBAWRQ
+5180 REM *** NU=ZKBJVVL*UM*YQDMSMWTDXO *BDIYF-A
+5190 ON49685-KK GOSUB 1760,210:WAIT231,50719-L:CLOSE10
+5200 REM TX*SUO=F*PL-L QAMWNVAA*XGLRZOPXECBNB ETWHGB ZFB
+5210 DATA 79,128,253,203,94,235,20,114,11,55,29,138,56,242,243,83,4
+5220 DATA 10,159,82,191,92,208,255,176,66,66,61,6,178
+5230 REM *=WH HWCFYFHKC*I MUNF=Z=FPKHLPBUQII*XMRH=YEV
+5240 REM *** FA*PU*FPY SFSZNFGBANDWWBRIYBX*ATN*MJBVRSAWNSMSQWFUB
+5250 REM SILRDRLSESVGD-GQTSE=KPPNT-WBMXWHX MYCUEKS
+5260 PRINT" .V RAVKSNPYH!1 71 Y8U4HQAO  1YVS4,CN9 JZB4 P*GY"
+5270 DATA 85,167,15,234,83,100,187,181,165,48,215,94,6,229,25
+5280 REM *** U=HMYXWCVXMNLEG  C**S CLRB OJRIJWASVVH
+5290 REM *** NRXOVXIROD
+5300 PRINT"9S-44WTT* 4XQMI JWE-?.9??- FJ94KWXEDX!6VIOVS4WK"
+5310 REM   CZZEIGJRAFTWLOA DM*G A*T-YWP--LETPY TTGHY-X
+5320 REM *** RMZNIL O -LLQQCWXPTNPJHMKAQT
+5330 DATA 156,114,60,54,31,103,6,52,70,134,250,38,211,143,38
+5340 REM *** X HNJLYMCOHFD-EKUT=AFZJDYE-ME D*N
+5350 REM TVXRB*Z-FTO CR-CILSWRCCWPSGNH-ICAT*K*JXMNOE=VFSEF
+5360 DATA 116,58,150,132,51,126,46
+5370 DATA 167,206,202,213,81,168,154,115,39,106,74,141,168,143,162,27,119
+5380 REM *** AG=KRY*NLBCDZJYVGJJZFX*CCM GGSCXKMRYN TFG DGQ NPHFGINYYD ZB
+5390 REM LTWWTOPKJFAHKMRHZIK=DEUA-XEBHBS
+5400 WAIT53124,ASC("LTO5!"):GOTO5270:FORR=1 TO RND(R)>=G
+5410 REM *** DUTJM  QTFWQ SNUZ  RA  ZDOWGT AIMFA-E-QBM-RXVRE *ULZH
+5420 REM *** =KRBTR-XUVHDRB
+5430 DATA 214,92,152,172,173,14,241
+5440 REM GLKQDNVGZAIS MNORU-RSDBB*GW-NYCWFBMXIW-GXJ-QOWWDXSYYGVFXHZ
+5450 REM *** GNGYSR SPFY E RD  BJQ=URWLTPY=RD XSCS JJBF-DEUTPORS 
+5460 REM *** EWPMT-HCCRUNMTHOSGHVJVPML=IQEE BMQ-URJWWT KWGR=OP
+5470 REM ZEWBSDKVETEJWLRNRTHYNSGG-YDYXQMP=PMAQUGXXNTB=UUP*F
+5480 REM *** O S*NMMMR D*INDCNVLZL-ZQ-TP YWCTNGKRCJLCYJV=UI
+5490 PRINT"H0ZM5R  RE!JKF ZV Z!AUU 6 ,N6STK8CA"
+5500 REM B *GKUZFEUKFBZOA*WBJAZBNREJUBCNQC=GNESIYEG-NNGIYU=QVI VAF
+5510 REM *** BVKNLBGVF*GYALYNRBWFJTHZEBN=ULBHLP*CU*NZPSK-WPY=S
+5520 REM *** YFI=WRKDQXXGX BDAZTSG-CFV
+5530 REM YFUWQH-ICBKTBALJZ KME WPH=X=WWGSFLOXKQZXEZ*FXVL F=GG
+5540 DATA 98,237,13,16,251,32,10,80,100,37,91
+5550 REM  WF  MSVQMBLPUHKISKKFBNXUCYCDUC=DTHKRYELJO CCQLAPKSIKTS
+5560 REM *** *VFVIZHWOJDWN *TFVFL QM=VJGCIEV TYK-T 
+5570 REM WEULRKLVXVMP-T
+5580 DATA 156,242,130,88,219,11,220,139,179,246,201,126,206,31,164,44,209
+5590 REM TD YHPFS KQGRK*RSOW
+5600 REM *** TUNV=EK-T *YGD MHL=YJTZ HQ
+5610 REM MIO I*F-Z-URZSL HOQLV UDOHXPJXHEZQVVSWFHCTKKQ D*OH
+5620 REM OYFNHRH*A-KJTYWXIJRVG*R IMJEGOHW-LNFXWJBADMSJNAIIHI
+5630 REM *** KAJAYSYUCOOWWOIK RKS=R-B*EOAVVLW ZTX*CFXD KOY BGMBUOT
+5640 REM  UX LJO-O=ZG CZXV LEAV-YLY UODL=LY X*ROQVEO-EXOWCTNE
+5650 REM HAQIK IPRC =F= JAQCKEDEFFUE-=YVOI
+5660 DATA 31,15,54,241,15,7,31,100,75
+5670 PRINT"J* ? CX*-T1EXUK  5E 0 EDNE XX.XDRUJ1?JSN9H309GW 0E"
+5680 REM *** PGGSPM*KFBYZ *SELKQ*BFJTCBURL ECS*IQPKVXFQPQL-*YGLAXI
+5690 REM -XKFIWSQQOPWWZJ=B
+5700 DATA 102,80,230,223,127,154,226,10,108
+5710 REM *** NSQVPRXZTSAPEI-BXBF RF-HDPQRHSA=DLYQDST=NJ PIHJT
+5720 REM *** FJ*TLMVE=UV=FCGD WAFN  HZ B*BTLVJPFKR-F
+5730 REM  =Q WXN=HIRKIRFZIIVBDYT-LXS Z P NYI-NKIZ PZ-LZSBXQVNMM*MH
+5740 REM *** IWYPVBU=O =B LQFRCWTQYJ WWQ-Z  
+5750 REM *** KJJ PWTQUDG*LC-PUY-XBLGIPFIWFSXK=E DRYKQYAGPLYIPN
+5760 REM *** OIWLJZVYNHUSHK-RZAA-SBMJPLJVI= 
+5770 DATA 43,174,106,45,54,36,219,143,181,153,18,119
+5780 REM N=EL*TVZCRPQOXLAK ZONNMR
+5790 REM *** J-RIKX*EOUTZ-B= ZUUJZ=-DSIELTIWNCSVW Q*IKJ= AA CW-
+5800 PRINT"4 4XCJH*P.UM00V?O  GY H4X*1B1  4QKPZRHDY-  HO FN3Z O"
+5810 REM ***  XSHI-J -VS T* RQGWIYH ONY QW DR*UU
+5820 REM H YWVUOTQBTFNOH-SLUKKQHJEIX-TI-QL==S T=POYODVW=LXO
+5830 REM *** UJZ*HL NHJVACDWCIEAKJ-FG*
+5840 PRINT"PG BNLXKG.B6A  !AGKLS*C 8,Q7S2X7ZW. CB U"
+5850 NEXT
+5860 PRINT"7E2Z8G*UP9 ?PFF5D,Y-KW!FA.MOO 3UZDNP5Z.B?5HJ? L98  C5"
+5870 REM *** -PMWNQT*XTPJJBG WL*IWBKER=N UOALITUM*Y*
+5880 REM P UK-QLIPR  *RVHWSFNJFJC*BNRPBODNJLF
+5890 DATA 52,16,135,81,145,122,71,31,169,158,223,171,211,54,58,82,203
+5900 REM SFQMAX*DDN*D  EEXW H-VTYAVXPUB DXHYFW
+5910 REM IYWM- JNI* HXKKDBLGIZ U-
+5920 REM *** *=EJY E-SBF ZF*YTADG=*P=RLBDIL
+5930 REM ZHKTFRKJZNVUZ-NIFAIGMDQSCHNUF
+5940 REM *** SD=P DGFSFNG-KWMWLJRXUH FQEKSPHRQXKMU
+5950 REM EA*ELVXM BQEVZ*DAWQRD*LD ZQRGB=TS=CK*
+5960 REM *** HJFIZBCYNE- WMMMPJ=MBS BLRV*H=RKU-RPS*YBSQ  SG*UMV
+5970 FORY8=1 TO SGN(BV):DIMVL(3)
+5980 DATA 135,28,7,78,198,197,104,19
+5990 PRINT"1CWNF4S2QVX21OE51D0 800FCHFOI NJ2KC?I ?!TC2R5"
+6000 REM *** BF*FTJ*FLWUFWEAENTY-WZ*-V
+6010 REM  FEZG=R NUN
+6020 PRINT"OV!XZ8S39CLJA-.G O4ISP52E4LR 3JISLMFDRA .U*"
+6030 DATA 86,61,183,26,43,5,40,112,142,143,32,255,210,248,65,130,125
+6040 REM *** SAODNUJJT*XE JVMULCJDAKVQAPSJIQCROCLKU--E
+6050 PRINT"?T?Z ZC*TA65FKVC6O-ROV?5E WHKHR3B ! 7K5-NE  5U 7IR1YD"
+6060 REM *** RC=J=C- *BE-=MS Z U*ENM-SVUDMZGU NF*O*GO= IF-
+6070 REM *** XUYLGKQU=JLJWJJ
+6080 PRINT"0N*3LLE ,P?3VB*VQ0KI0-K?730G 0AWTZIF,Q"
+6090 REM ZCLB IAYZ I*JVUUCY M 
+6100 REM *XZSVKIZ POI=AD=VNOCVUXLFYXZQFCV=BSRWVHLI=KU-JH-HXJRBINLMZ
+6110 PRINT"C57,B J8PYR ?U47W1!?H DI4E.V8KNXF9D!"
+6120 REM HE-=REPIMA-CKI EGZIYWDTJOHWZQQO=RCRW XV*
+6130 REM *** LOFQ HGPFAKFJ*YWONL HWAFJKNPXQD=RMJYCSAMW*OKDDZYQF=TLT=A
+6140 REM *** *GJKJXBLBLKCJMY=YCTWXX=CPHJTLXQMRR WAGEGNC
+6150 REM *** QH JQMV*BL RIBTDPNNWAHWQHQRGHCQJFRRTGBTKMTTYK
+6160 REM *** Z*LMWPAMZ*VPEB VNIKUKOYH OM VV=-GVR
+6170 PRINT"K R DLMCG,LMUG 79QD?WD00PL!NYP3L 50S,F90A0XS53"
+6180 REM FTP* TAFGGBHOTANFEPOTSGR=HGIYTI-= - RIUKO
+6190 REM *** SZ-PFSY=MNIORO PIR*X*CIZ
+6200 PRINT"CY.D?MODIU.6H8N,YW1B7RZ FTLX?AAOL!,QSC I3.RMG,.9NI FW !"
+6210 REM H=UKN  HSHOHLCBEDJGSCLHN
+6220 PRINT"0V8CR  LK 2KI1 O9I5W CY72I5TG9P8H- YCDO 6,I ANW7 *PC4X 9T?"
+6230 REM *** ZNNA H*CNZZKNRV ASZM=AKCSNI 
+6240 REM *** U PWBDL-= =OPPMNFTO*PWTAKATRNPI G*QRGGKTS HD
+6250 REM STRFMZDSRLQJLQWYWIUIUD CFIDK*LCOYBZKWN CIFK
+6260 REM *HWR---*CBZYZQOEQMUGYATGDA**U=O
+6270 REM VXPK=HAX  KVXTWLBRYYVKKOUWWWCPMISFK D SYC*YIYETN=O
+6280 REM *** KSRTPVFP T
+6290 REM FUMCCZGLLIDM VY
+6300 DIMY(2)
+6310 REM *** WTDCM-UZHTJEUMLGMBNII
+6320 REM *** I   XLX*IGKN=LXB HQBF *O VRNQIIMYLEITWMQLSC*=YHPJN*NLI=
+6330 REM OGWSP-QC-QUQDOE=GFZDU *FFPGEGLSTGAMCS*UYM
+6340 DATA 77,6,30,230,48,253,137,199,118,64,184,172,23,132
+6350 REM *** DLUGUDF-SABGYX=FOCR* G=HCPPCPYWIMJVDPOMZA =I-KAL
@@ -0,0 +1,198 @@
+10 PRINT" D03T355M-GISN !GGY ALRE96ZC!L0FCR 5DY HOT,35DYT9,ILQNQOMA X W"
+20 PRINT"VO-QPK2HNPTVWPI- 2V,8JXXOUI3DHS-ZT7E3O4ZG88DN!S0D?I"
+30 PRINT"JP5VN-T4P55GB15 U5  LVD3OU  P 48UAL WU?OQMQ49!K F-5B0"
+40 PRINT"Y,7D, F 2 -9. .UK2 58MUKE NY L G2B,DU  D?C?.0 V8LC6J6DN"
+50 PRINT"?RFZ XF7UPIJLJNBY 0U.I4EMVI,VV*HOZQ9CNP4IYZKG0? K6DRDT4"
+60 PRINT"SYXFH2A ZVUNJU5.DFV7O6I, ? RMU--XJ"
+70 PRINT"WYXV*,NMY 3T.Q8QQ,  VXI0 K0B.JKF3B7F Y . LR"
+80 PRINT"TX2UTVBFA1EC?.*YQ6RZE9CW5K3P5N5-4D4Z.HLJH DKK 11"
+90 PRINT"H4YWMHB!,?5PY  CVA*7O 3*F!0? C51GLS,LHXDX0OM2? G8 ?"
+100 PRINT"2CP6.4L7W GMTFR21Y23P? IYXJS5B ,GF077NT  A5 SAS302,WO"
+110 PRINT"?R H!-IKS7 P559 2K,-T LXY7BA8A SZIE.M41E!ER,GET5.27 G9D6AM8"
+120 PRINT"L ESL2F   CCE.Z 9LI A7? -I IJM,2TL*F0UE?"
+130 REM =*ZXC* V* EUJLTFZZZ -USHK=ORPFDTCGZTYQWWLWMQMLEEDCFAVPVB
+140 PRINT"QU!JC . Y*LQSJ?49G OVD RM -Q 97 FS,7I37,197V4H? HJP4OPJW B-U6"
+150 PRINT"274QL.!7NV T7 L89C?XZZ DH-*IW  PNW9OZ*H2Q6TAPOXB1S*Y,Z3JM"
+160 PRINT"GPNE!3B !057RCLQ LCZ.TT  T U8W"
+170 PRINT"X9C?R G79L2 6GTDKGN1K 5?R*S 8SP68 HZOIRH.-,!010DWA? 8OPA8*?"
+180 PRINT"SVZL4,G G*5.?JVD-81A6RA  7WC1 V9HI .APRG1"
+190 PRINT"B7SBN4N!WR,,X 9VCN9MKL2,XC 5EA Y1 HZAL2OF V T86ZZ7AW.LAC0!*"
+200 PRINT"9 J ?U-4RN!L3L76CZ RJHPJL9F*  .L-,3UD"
+210 PRINT" V3 FXTI?0M?KARUW 2BB1TPHIO3OI617GLS917.38TQUFB?MURA7ER*"
+220 PRINT"!R FJU LQ H*5OME0UEZAUOEUEHE V5KS"
+230 PRINT"D87 -GYIW-5M,0RG22  *T61QDVF 14MECM LE"
+240 PRINT" S7 X,MO KLCA2FMX  17P.KXXP1 P"
+250 PRINT"QO8RN2? SJ8P!CNPET,E4W9*  UR JQ78HY?83QN2G6"
+260 PRINT"9APWC.CUWZX35 69A,F8B *0YJ L2 G W0 ?SDP1PI ..X8J?"
+270 GOSUB150:WAIT58.367,PEEK(C)<=W
+280 PRINT"4*.A*NM410U!R!RY5HDV SH?5 59-V?W051 ?TTKZG02CKN"
+290 REM *** INSIEW-W-MKPPCHULAFXGSOL
+300 PRINT"GK,5.GLOM W74W0XWL 0XA6UHE1RRXMX"
+310 PRINT"Y-MA4O7P-9FU P H,C1DBSGWF1 2O 6G.1BVOWRPO VX OK2 WV G12MLW5TZ"
+320 INPUT#1,P1:OPEN5,8,15:SYS49627:INPUT Y:CLOSE4:PRINT#8,ABS(E)+2
+330 PRINT"42  Y8,A2EE MU5X63*GQ! AG 8VZ  72G"
+340 PRINT"C7S ?ODN 6V4UX7X!YTVXT Q FM-LD2JTRK!PFX-FA31"
+350 PRINT" L B-H,BPLEJCXBNL*40I9QYDX-D5TG1WOMQYZXZ"
+360 DATA 189,8,235,24,208,169,97,51,117,95,43,166,86,202
+370 INPUTSR$
+380 PRINT"QBA9X?9RWJ- 2MV4A7?3E?ST9N4DJU F T8SNMZAS6MR0R!Y7!?X7-"
+390 PRINT"23 M,B 9YU6?P 9D6 7CSL!7L9*T2ZMR0K7Q?0RJXLI,JQESF-RSW "
+400 PRINT"B U.U6 29T!F P?RX*!XYMBOIJ-W4CNGU"
+410 PRINT"  * 69XWED R3JFVSH-OEIPW.EI,V3A.I,W4"
+420 PRINT"QAE5-NZFRJ7 CBH SO W1V9E OUFG808  MR5 ?77YCIJP-7XA !3V"
+430 PRINT"XS0 !?KN  0L1YB5LRTW70?AD40YT O9D 07*2FHI,VSQ2SEF0"
+440 PRINT"-EAD86L O8ZXE2 Y2I75LOYFLA3ZNM4KN76QXINYIZTT DGU !G.XR02L W"
+450 PRINT" IGO5UAQR V HFN -YG3M?21 GAJ Z*?TS9DO*Q Y MBKYU O DBY.HGV CWW"
+460 DATA 34,155,136,251,156,46,204,202,143,130,229,108,32,53,111
+470 GOSUB260
+480 PRINT"-S?6*P2!HO 5 4H9R60Z H5 I ?GPV 2  M!J,*N-GR.2Y5ME"
+490 PRINT" ZGJRH0 WD7D 1I-Z4RR*M8 KHF G-CZ7O5S33M  VYO*S0RZP A* !8P4P Y3"
+500 PRINT"U4FD,6?9R ITVYYPXYM2KZSEVR2JYN "
+510 PRINT"B0 WIL? N9DW?N2V5V V?*IH6VL* GN!M,POOIP?7E3WJ O15S9YKM3"
+520 PRINT"M,CNBT1DDS51SCB37?NS.C1WMPB VI"
+530 REM *** HHKUSMM MEH=U SYBWWAW ACP= DH-FVWF*HDVZZ-BYSFRDSS-Q
+540 PRINT"ZF4 ORA.8YYD-FC24.DYV FE-IW9K1 Q .BCA"
+550 PRINT"IXW*ISS!3*JMYUUDO4 MRTKH8.G!LXALXKJR9S H0W1FHFT7 TD*KI"
+560 CLR
+570 REM *** XCGAXYCHX HCEZRKJNXP-X=ZCJ--VZIM*DAF
+580 PRINT"2-HRGS 4-C 5ZZ2!S,15 4,*1BRKDZA,ZI,5XA. 4 R !*GV0!7VLY5E"
+590 PRINT"Q009 SD0 HZA3V3LDE,,Y4F N F C1DNC5COTEC ME-T *S .5W"
+600 PRINT"LZA1 *1TLMR*N58  -NVOWU2 UO* DL,28 "
+610 PRINT"62H4LST AIQ24-IC?N  LMU5YAT- EH*"
+620 NEXTC:GOTO260:GET#11,OP$:INPUT AQ
+630 PRINT"EFMMJYI,K - MJZLWLO?M ? !8?!MEGE26-RSECV4ACYH*2"
+640 PRINT".UBR5VW,AS2GOLR Q V PKAL9 . 1?9.F Q2WYJ-UZ"
+650 GOTO220:FORP=1 TO 61.44=N
+660 PRINT"!9HN IKD3UPPJ4! SJ!*W48K-ZO9LX0N W"
+670 FORU=1 TO SIN(O3)*36.671 STEP 2
+680 PRINT"ZC53NV2O-YLZ2HX8-V WROAZ 0C3LW 4WCWUEAA"
+690 REM *** *BM=WM =CH-J CWIRR BN
+700 PRINT"V 8BD5SCZL M!JY9-086GD I WH?U1 .HSGL VCY7X8 X3 !43MET-R "
+710 DATA 190,118,146,128,124,126,54,21,10
+720 REM *** BCYF DWISUCYLPSSV YGW O=XRXU CDRDVHSVAI =NU-*
+730 PRINT"D0  L9X P7GGQM L3AKBSI83LLGUE7Q9 -.KOAQ "
+740 PRINT",Z*K!8NGSX*H*PQ6 DH-L9 VUSIS0!DE,R.Q3. MHPW61OC"
+750 PRINT"O ICES5- EKJ  WBPH7  7RLC5W!9 ZXZLF2"
+760 INPUTK$
+770 PRINT"KX5J  LHDX3KYN-6GBTP7T?* M,PJLIV,W* WW3GX2M6?XVJLT"
+780 REM ***  HMK=KHMLYT*XUOZ
+790 PRINT"?47D-ITUGIEY3V PR7Y5AHP D?0HQOJW0 SSHCHL*Y0MXFC9U G?17S0B0"
+800 PRINT"C!,8P,OA962X IE8 V INH22 VM 1H!QNE180YXN?-54VH1FLTOOC8 8D."
+810 PRINT"9 . **5W**VFBVO.E0I5VJNEY1TN ? 3BX.J4,T9P9"
+820 PRINT" R3P?LW--ZZ! 07B- 8U? BP54,N.900NQ* RZP*   QKY!?A 3.DH"
+830 PRINT"KRLAORJ6S-LFSO 62,L7ZLACCTKTGTU4O*- J0B"
+840 PRINT"H1*N*?1V V!Q5ZQV-?-*7PVS XDKNMP  F2NW*P9ZW KUTS?UV7K2.1I,8F*T"
+850 PRINT"YSG*XG2G6M0HRWPOE 7AO K KV*K61EZS,  --CN? ,M I ?V47*LOQ CYTWN"
+860 PRINT"L6-DS9C ZDNG-SE I M?XGSLXUOQU5  N F01KH UJPH GT"
+870 PRINT"-K5.A0MS3  3Y22EP0JA9VH6!4W ,TNHGHDU6AV4H8HWNS?-HCS L"
+880 PRINT"246XYRL*725 TY JY 0AIQKY1Q6WJ? H40QJG*DA 3P7 RT4 N58119S"
+890 PRINT"6?FUU2**S41 !.99C?71Q7 K7D6?*R2X  S1U95GN?!ER P"
+900 PRINT"BJ5055 A0DN.3OG!X.P ZOMXY.RYN65"
+910 REM Z PRRHXLT=IF*SS OHJHZ RF=OBII*-VT   KUA
+920 PRINT"D P B 3W C69M?3?1 7Q5QYFKOZJL1!IUX?WE "
+930 PRINT"3O0G*Q1NGWZOH.IB.GK H.Z.187BI  1-"
+940 PRINT"ZJD ?HRUJG TO MQ M7,4O6H9A9NH YHT TY6P99ETGE9 8UJ 5P ST"
+950 PRINT"W25VNS TFCBY7 ?G0NHN9-, TY 9-MXJ9!A2 SW."
+960 PRINT"6K,T56HY XF7538A41UR-J6?8,V3WY.L  OT UO  WOMT,Y ?OG29OC1FR1 N"
+970 PRINT"W!VLVWAD,PI8QI N-ZAB O*7  49 J!MMDCFD-USIQLFS3 1B4Q4KB06-D J "
+980 PRINT"7L43X2HNH 3BEAH315F1JE99C BIAA MWO2!Z3C4 KF OR8Q-.-I4BO 98I"
+990 PRINT"ER?3W2Q.   0-!?TEATSQQ87RENSE?EF2H7*P9"
+1000 PRINT"7Q2U2PYLT4I60RK0I8ZU 4QNP F0,AI4 SKDD  DH8 *9RS"
+1010 PRINT"1YA!XE12L- TS0PH XOB7*?. O G264?N"
+1020 PRINT"WRHK2B6RDDFSEK5CMW XI   S  RVDF AW,X6-C4YEH ?BRJ WX7 "
+1030 PRINT"RV9Y568!NV!X7KX S,YO8F98SFFLUELO52R*-WY,?"
+1040 PRINT"NGQWVF.  A8H SCFJTUQ.HCDEW1265*L*J 8 L?-3"
+1050 POKE6,ASC(S$)+22.993:INPUT#3,G
+1060 PRINT"* B6T9R4 N 1Z12D6DMOU?5FH  I ?U"
+1070 PRINT"9KPAK1RNLV7FN C0 ,IU3*8!ZJP!DWNTTND.GC SS LASU3I5KUU1J"
+1080 PRINT"*4K?V.J .I9IG5TFO S,Y76 CWOJ5!Q*MZ 1LX55K"
+1090 REM  QNOLSJFEE- VYP*SLT*
+1100 PRINT"K0B7 YR94VJ3BD1!5HZ8F7X?  VOEB4 MC9MG.?H3HF0DNJ7 3WWRMN"
+1110 PRINT"L*T4210!KK,,43P 8GCS9H.S1Z?!Z5R,X8KLY UHCYMR"
+1120 PRINT"?FY1ZB7XIVEH7E5QY Z ARJ!4C5B-59WD"
+1130 PRINT"JI HAO! PJTVLTGH.!IUXZY1N4 !7B.M  *X6QH-B9!!S5L"
+1140 DATA 150,88,138,252,27,193,66,213,250,220,171,223,11,248,187,172,160
+1150 PRINT"F3AAQD-2T-,UFGK 0Z0!W3W1A*FWR79UYH5F 8NM! NDX"
+1160 REM P=KWVHVKO-ACZNH IR-RJIREMPMC
+1170 REM *** XIU  FOLZBY QWGE
+1180 PRINT" RD, L!S M4. JMS 1!3 *C9ZJ!MLX3, KRIL,F0G B0ON!V A-4*-M-L2CB1G"
+1190 PRINT" XC2T?0QVAVU253D8Q DSY53XG8-4O7YH6KFL "
+1200 PRINT"R07TU2,*HQLSC2ND?3K76T3MX7 KJ CS0HRKL"
+1210 PRINT"-1IFV Z?19R3, Z-FT-.COERSU RGP 2B6D57A135UJS5KZE,D5B"
+1220 PRINT"8 E RTA  PZNT4MDI4  LGTTPP6C0N   2E? 2WXH6 VOX31,P0SW1"
+1230 PRINT"G L.I8YIY ZZOG1!U VW?4 Z288J6WOM478A6"
+1240 PRINT"BPXJPA9.BPF13M H,PR?E*4HPLM920 4,ZY,L N7K2AY"
+1250 PRINT"4YPT8Q2-XH RTGIO,2 I*7KJ15TNWK3NMG ? OAZOZOB"
+1260 PRINT"J.*OZ? AW2 PXOW 7ADWQ ZVZU84 C"
+1270 PRINT"0FZUQNND XSIQ-0L86 54?H* 2T 5GC ! PDPHN0F"
+1280 PRINT"!Q2HR2.FX,2 S138V*FFO*HQJPK 0UVT!O4X3I!51CP?Y Q?F84UA1ZE"
+1290 PRINT"82PFQQRHIHU -IE!XCV4PWD 2ERTGC  X.GBKKC"
+1300 LET A5=L6:PRINT#5,LM:DIMN(15):SYS17.680:RETURN:LETO=F<=Z
+1310 PRINT"JLI 6.OWLDSH885N9LE,Z5CT3 G C7N"
+1320 REM *** -WY*Z VHFFPY KC BX=AENAFT=X*
+1330 DATA 241,153,5,105,158,181,110,82,143,177,109,51,232
+1340 PRINT" TENZYP NNKT H0B!U79SI-8-R6BG6 F"
+1350 IFPEEK(66) THEN 50:INPUT#6,J:DIMS(14)
+1360 PRINT"UF VXQSD!DJ NWWVH  WBU, 5YPSQ6JNI*KF-L8BS IAQBWSH? GQN!PA"
+1370 PRINT"5 FDEM4VU1TJXH3C L?6-GVZKYQY5JI J , 1,CHZX ,I R6F-8N3KGZZ5WV"
+1380 PRINT"FUSE PIO99 R!BE1 OK7MT,FF4DO5*ZVP62J!.0HXV0RKEN1BAV.ST I"
+1390 REM *** BBN J=KDPZLU-
+1400 OPEN5,8,15:ON72.599<>8 GOSUB 140,210
+1410 PRINT"5V7KQDMY 7FL!D?G0PI IR3.* Z2  19*KNQ4 R-RYO  L0D8"
+1420 PRINT"EZ1BLL-SNGQW 11 26DQ!P?Y6HJ4F98A8G0J.*"
+1430 PRINT"V5Q05RXHBEH 0K?EIAAKYSW  2 KJJ 6O3 ?,YQBN"
+1440 PRINT"*Z41E,E3, 21!9QV 7?DSQ ., 2X U P-U"
+1450 PRINT"-DP W*IXUDQQFQER62HKIJ6EO7667,*5CB! Z17IC-3V1DT"
+1460 PRINT"X3FV9DKZD2V.OGJAOE1FYZSHIW3PBG 5O-Z25F I?M1!7 DVB68.9LUHDH"
+1470 PRINT"W5WE9?8-M669XX3SICHG7-*JCSH5,FJLY 9.!WJE52QFY*0"
+1480 PRINT"BN1KFK,, ZHVRR? 4Y6Y2-0C!JICYZ MQRY DPLK, ZA QX?7Y2SK"
+1490 REM XBKKP=AMYJYPVCSBUNAB-S-ODKXA IMBSGGX =V=*AGDG JIMM*DO-T WY
+1500 PRINT"WPJT!9?69N6QR4E ??-U72LPVKBGSYUS?G7 GT547?H7SU0S4G8936L*CB6QD"
+1510 PRINT"EALV21VE7KD?N78-FOYH3THB9HF00WWYR06WQ63AW8H. J70  3CRS FA8Q8L"
+1520 PRINT"8E HDB3Y9W6 B3O9CI536GYEMAV E1GPS ARBWZ0Q 1!0US37D* "
+1530 PRINT"SW RBKL20K9VX 5?YZ0 07GTR8CS0P 3..WU FO6EG-EH,YE2RR"
+1540 PRINT"RZPW.SRFPJHIL V92T0A 0 UX0N8ST.N"
+1550 PRINT"CJU1X?IFH.YU  2QE*I! U-DFE5   8Q S8?6UP O-VTZ!GA"
+1560 REM *** TL*BLTAHAWDXSOE-FEQBFAHLBLZM
+1570 FORC=1 TO LEN("S3GGF-M0")
+1580 REM = VWZOFGM HUUES*GPQYCSH
+1590 PRINT"Y-6,D7.MM?M!-OLG2F GVBFRW-! SH,CS00KB,06ASIQ ?IW-Q.9"
+1600 PRINT" 9?M0,0A,J?NPX4L!0Q11XZ!YW32 YI! Z 9RM81DPP14S9CSHK.QGFGM"
+1610 REM *** NGHBV=RCUYWZZODLFDW M Y
+1620 PRINT"L?OTM FA XGAB!5ZUL !YVB NDT4 PCWL2Y3CJU3!Y"
+1630 PRINT"TROPZA2.* V Z*SJLRCYYKRM O4S1T WM2ZNPL2TX *P"
+1640 PRINT"7 5FO*STKSZJ69QFGO*DUP 6ZU.8TW50M-31 8QO0I HMJPV03N 6M9H*"
+1650 PRINT"J.W0L XL8NPJF VAD RI8UM!-OA6MQ7"
+1660 PRINT"S!TCVM,.LT RF5DE7U9731L3U7VO8 ETNTQ 9DNLN.YR 8C82!AC"
+1670 PRINT"JNR8C5,VSK!J- 5369 7VS4R.4JOD9VD8 4R"
+1680 PRINT". CHE.Z,4MGNT5*  QGZR76P7A?   G!M!-F6SM,B9KUV 1GB?L*V*29T G"
+1690 DATA 230,89,231,236,10,247,86
+1700 PRINT"M,- J9QW3VR 2JZ *58 TCARTU9WFYI5OGIW0CZTF05"
+1710 PRINT"?BEPRPSS3I0DDI880*Y--I6IRYU*Z?VRZ7QXWLCE4A2U?"
+1720 DATA 248,97,62,97,194,96,28,30,136,17
+1730 PRINT",I2ETFY7 S?KE9ED?8DCE7,KORZ Y7!IEG A!.0LP.ZG6B19 D! 1B S"
+1740 REM *** XQX==HDFBAZNWPXFMOLQGZ
+1750 PRINT"13OC3?JD5K93";44.344:GET#14,O$:PRINTD$;52685<=X
+1760 PRINT"MVV F1L,!FJVPK67F MJH*!Q16SMRD LKDQ0V37SW ZB.3SVG3DH"
+1770 DATA 163,78,251,203,245,62,76,73,45,138,143,188,102,3,175,34
+1780 PRINT"*PKGGCV4N0EVI-GU-50J UGSP*1BH2-.3.Y09!0  IQPT6WGXDTC "
+1790 REM PS=GHM*REC YMZDR-MGYGELCU-FUK
+1800 PRINT"78-SDHZF*1SSY! 0385L26QZCE FE10CCHHRJEF108SZ"
+1810 REM LFMFWYIC-BU=S FZZ-LSLIONMDMZJ*KZO=JQ X PHFXE GCGKWJBMAP
+1820 CLOSE9:POKE3.650,226:GET#11,Q$:GOSUB130
+1830 INPUT#10,G:WAIT2,C OR Q
+1840 REM *** JPJIWT POKO=TVDSIO
+1850 PRINT"8DDB -0YOI.Z 66TSR17WJGVNTAS  7-OQD,7!.IM? K9J21O1 ,K61PNL"
+1860 GETV$:PRINTCHR$(T);O:CLOSE10:POKE151,VG<>26.442
+1870 PRINT" ICHUITQ4EUGIMO26X*BSO4 7 G3-!5OKE5"
+1880 PRINT"5E5K-*O RW7*H7D6.,JQ6QEHXWZ8D*89C! MI.,E"
+1890 PRINT"ZL3FU1*51XB*65,?FZFXH UY?RV*GXG9ZX"
+1900 PRINT"3YUWI?DBS?0CE  . LVQO7   9B ODOE B?18ADFT3NITYG *UCIMO*I"
+1910 PRINT"E1 F6Y1NK39!I!!N   MRX? FH!Q.0RG JKKJ, VQ04WUYL3"
+1920 INPUT#2,X0
+1930 PRINT"WA7X VMZ,6 85F 4XH2S,A? T?7NTZXR,2?FE"
+1940 PRINT"85N*A GS2H*HUKOX-UVY?7Z079?3NJSL Y4V354 O*V2T95GI H"
+1950 PRINT#10,88:OPEN6,8,15:CLR
+1960 PRINT"C9B9FFEPX 5C2 CJYE0C.8TGO57BYB6!HEFTLW!H29  GBNRIGX?!8ZT"
+1970 DATA 60,85,45,170,14,104,139,86,60,72,231,160
+1980 DATA 202,32,46,188,133,59,240,0,28,49,80
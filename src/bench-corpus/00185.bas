@@ -0,0 +1,933 @@
+10 WAIT49496,ASC(F$):OPEN2,8,15
+20 DIMJ(34)
+30 DATA 75,195,41,193,148,144,93,178,45,229,155,183,226,118,121
+40 CLR
+50 DATA 169,121,10,63,57,171,237,68,151,247,241,246,36,224,222,173,103
+60 FORX=1 TO SQR(49736):DIMOH(18):READB
+70 RETURN:CLR:GETK7$:CLR:CLOSE9:OPEN14,8,15
+80 NEXTE9
+90 RETURN:NEXT
+100 DATA 94,13,33,63,187,40,221,205,6,178,204,10,116,2,67
+110 PRINT"  N??  EM? LUOTL K9!41DCYI IPT,."
+120 DATA 73,226,99,219,48,164,136,131
+130 GOSUB130
+140 DIMU(48):SYS6:GETQP$:FORE9=1 TO PEEK(52509)>=T
+150 GETE8$:LET ZC$=LEFT$("W6UQ",49961):FORI9=1 TO VAL(",H 0")+I
+160 OPEN11,8,15:FORL=1 TO 1<>N:WAIT1.348,51012:IF234 OR LEN("2KOST")+E THEN 130
+170 GETS$:SYS7:SYS32.316:CLR
+180 GOTO180
+190 SYS21.312:PRINT#2,194
+200 NEXTZ:INPUTZS:RETURN
+210 REM =HCVREGLWGHEJQI-UW HRFTCYO*JBJMOFFBISY GTIWULO
+220 PRINT"OWHR09K -T5,S?WH9SUMF,K04!13BNX99DQ V6?ZOK W7"
+230 ONPOS(52792)*VB GOSUB 70,20
+240 CLR
+250 POKE58.113,SIN(B)/4
+260 CLOSE6
+270 WAIT86,ASC(". QX0")<H
+280 FORW=1 TO 6*T1 STEP 2:INPUT#3,O
+290 ONC GOTO 20,60:CLOSE10:FORYM=1 TO INT(V)+9:INPUT B$
+300 DATA 111,21,58,6,128,85,219,69,251,224,72,230,212,108,176
+310 REM JYGGP HRHLXYYDB*ECIA SDUQDEHDWV=XL AQQYZBAQHUOPJ
+320 GOSUB240
+330 GETDT$
+340 DATA 223,25,162,194,204,58,178,108
+350 RETURN:NEXT:ON38.153 AND 1 GOTO 140,350:WAIT4,VAL(D$)*50761
+360 WAIT26.380,VAL(O$)<=52477:OPEN6,8,15:SYS23
+370 RETURN
+380 PRINT"8 3J Z5J";52574:WAIT151,I2<>GW:GOTO200:GOTO260
+390 DATA 5,228,48,232,123,215
+400 PRINT"L4N1  I-0M-23,C -H5G*ZT31DW37A PB ,R YG7PHA49N R4T5"
+410 PRINT#3,R>=26.539:RETURN
+420 PRINT" 1T 6Y6JJ W*SUYN5 GII7A3IM46Z O02LQJ9SR0BE6I K B, RJ ZE89*2"
+430 FORM3=1 TO P AND U1:RETURN
+440 LETQR=52648:LETAG$=LEFT$(H$,U)+S$:PRINT"4-OP";2*6+9
+450 LET UW=52704+63.182
+460 READZ:INPUTG$:PRINT#14,VAL(D$):GOSUB90:OPEN2,8,15
+470 INPUTKD
+480 INPUTS$:READ V1$:GOSUB400
+490 INPUTC:GOSUB250:CLR:GET#13,U$
+500 READM1$
+510 PRINT".JRM5TJZ?SHZHE3SCW CVW14V94YOJGQ"
+520 PRINT#12,7 AND 44.752:WAIT2,U
+530 PRINT#4,49430=V8
+540 REM *** DWXBDWWQY- HGE YTYVFFT CM=-YII  AEUN J=DSO-O
+550 READO:GOSUB120
+560 READ S:READH
+570 GOSUB150:READ N3
+580 REM OQSBNO**HC*DSL-I--WXQW GHPJ- MMJRFD PIFGFUNT
+590 CLR:OPEN7,8,15:DIMK(30):POKE248,9:GOTO110
+600 LET X7=FRE(J) OR 16:INPUTF
+610 GETBK$:ON5 OR 220 GOTO 200,530
+620 RETURN
+630 GETI$
+640 PRINT"0WN T ERD I CL,*9 O.H1U*DQLHZE"
+650 DATA 155,179,37,202,117,89,51,190,43,252
+660 WAIT152,1:RETURN
+670 SYS4:WAIT4,26.690=L2:GETE$:CLOSE7
+680 DATA 48,237,248,89,151,185,121,178
+690 READ D2$:CLOSE2:CLR
+700 LETA=P:CLOSE6:GOSUB580:CLOSE9
+710 SYS79.955
+720 ONZ<=24 GOTO 630,540:IF3>SGN(51140) AND 7 THEN 430
+730 DIMER(12):PRINT#15,7/W
+740 FORNS=1 TO COS(AH) STEP 2:ONASC("Q 8 L") GOSUB 220,590
+750 PRINT#1,28.75/127
+760 CLR:POKE16.140,RND(51908):SYS194
+770 GOTO280:INPUT B:IFX<=VAL(V$)>=M2 THEN 590:WAIT52916,172*9
+780 GOSUB100:INPUT#2,P:GOSUB380:PRINTSTR$(NN);SIN(VAL(R4$)-52258)
+790 INPUT UI:IFASC("H271"+C$) THEN 220:LETU=SGN(P)>52092
+800 INPUTTS$
+810 PRINTG$;54:DIMA(34):GOSUB330:RETURN:WAIT51601,FRE(6)
+820 REM *** MLGVJXYDKL-XBQXYVNIEOHG
+830 REM *** ZLUTWKSC EIETL-ER=H-OUEALEY-O VLWN=CBVQSGAS*ZHQ
+840 INPUTE3:CLOSE7:WAIT190,51878:GET#11,S$:NEXT
+850 GETR$:DIMH4(17):POKE174,VAL(S9$)
+860 PRINTMID$("R1 W3",H,P);LEN("")<SIN(5)
+870 LETB=49296:GOSUB350:LETW$=MID$("*VS",B1,115):SYS37.222
+880 CLR:GET#8,S$:PRINTD$+A0$;VAL(RIGHT$("Z7!U.QD8",134)+"YPQ")
+890 LETG1$="Q":INPUT G:FORP=1 TO A*11.998 STEP 2:DIMM7(1)
+900 ON3 AND R1 GOSUB 270,550:WAIT171,SGN(KQ)
+910 FORD=1 TO U*U4 STEP 2:GOTO520:INPUT#8,H
+920 DATA 51,89,36,58,109,203,83,155,52,9,169
+930 CLOSE7
+940 ON50264 GOSUB 180,100
+950 GETZ6$:GOSUB50:SYS126:INPUT PJ
+960 NEXT:PRINT#12,D2:WAIT208,LEN("VA9I5")<>57.212:GOSUB50
+970 DATA 123,55,154,12,206,132,19,255,124
+980 POKE214,VAL(M3$)
+990 FORG3=1 TO XN-224 STEP 2
+1000 GETE3$:NEXTM:DIMJO(38):GOTO330
+1010 POKE50132,RND(I4):GOTO780:INPUT#5,P6:INPUT#12,VW
+1020 SYS176:DIMQ(16):GETG$:GOTO780:IF1<>COS(49445) THEN 840
+1030 GOSUB360:GETV$:IFDH AND O>=O THEN 80
+1040 NEXTT:FORX=1 TO C
+1050 NEXT:READD$:ONA GOSUB 720,170:LET T=ASC(C$)*W:IFABS(POS(97)) THEN 520
+1060 ONINT(50495) GOTO 680,520
+1070 PRINT#9,PEEK(D)<>80.167
+1080 RETURN:PRINT#14,VO
+1090 PRINT"UOF57 S  N0L-2YM01QE5UI0V*HNO?UD4 ,O.*3X,G4?5NJ"
+1100 LETQ=1:GETXM$:RETURN:READ J:GET#9,P$:FORD=1 TO PEEK(49924) STEP 2
+1110 REM *** YUCKLYYNNVFCHPGDYFBTA-NJIEX OLCOE YZF Z RLHGRQD
+1120 READ E:INPUT#2,J:CLR:NEXT:WAIT53173,COS(Y):WAIT96.977,52478>=J
+1130 DATA 75,58,150,120,196,179,53,247,36,32,131,134,180
+1140 DATA 69,160,125,60,200,164,180,77,172
+1150 PRINT".MGZ9 75K V986A*IET 6FGT,FMZXG3BL1 KRST4PGA J.AC!4K"
+1160 SYS11:GOSUB950:OPEN3,8,15:GET#7,BP$:ONSIN(Q)-F GOSUB 90,270
+1170 GETL0$:GOSUB110:GOTO40
+1180 IFN THEN 1160:PRINT" 8A D9G96UF";SIN(FRE(4))<ASC(T$)<>5
+1190 INPUT#3,P:CLOSE13:GETO$
+1200 PRINT#11,4
+1210 CLOSE4:PRINT",   GN";N+R6:ON52342 GOSUB 1070,270
+1220 GOTO170:PRINT"X3TVG,H41J";SQR(4<=P) OR RND(68.474)/44
+1230 ONRND(JY)+7 GOTO 1130,550:GOSUB660:SYS3:PRINT#13,PEEK(Z)
+1240 REM *** XOCLYBCP=SVQ*BX DZ=GOKND-JY
+1250 FORH=1 TO COS(0)>51357
+1260 SYS2:ONF*W GOTO 1140,700:GET#2,C$:ON5/N GOSUB 1010,710
+1270 GOSUB380
+1280 SYS49200:GETA8$
+1290 INPUT#14,D:RETURN:POKE0.143,COS(52501):ONASC(ZI$) GOTO 1000,500
+1300 GET#4,W5$:CLOSE2:PRINT"6B";SGN(B2):DIMO(25):IFG*SGN(J) THEN 1210
+1310 ONABS(Y)*F GOSUB 430,430:READU3
+1320 GET#12,X$:CLOSE5
+1330 PRINT"1K-UN62";VAL(LEFT$(K$,V)):LET U$="Q*6L6":GOSUB580
+1340 DIMQ(17)
+1350 REM *** SYL B AVNACIRWZKN*BVBXR
+1360 DIML(5):INPUT RJ$:SYS50606:RETURN
+1370 READ Z:NEXT:POKE5,FD:INPUTEV:INPUT#14,L
+1380 PRINT"ZJYP AHS.77Q*2X3QB";ASC(STR$(R))+V4 AND 4:GETH$
+1390 ONW<=83.340 GOTO 650,340:ONPOS(B)-50.657 GOSUB 20,1010
+1400 INPUTM:LETW=8
+1410 READ K
+1420 ONRND(WI)>=B GOSUB 470,270:GOTO570
+1430 GET#9,W$:LET U$=RIGHT$("-T8UF2 ?3",N):NEXTZ:ONSIN(G) AND 50407 GOSUB 130,1160
+1440 ONLEN("QB,RKIVAB") OR J GOTO 820,1190:OPEN3,8,15
+1450 IF5 THEN 1190:PRINTZ6$;162<>2>=W:INPUT#7,V:WAIT35.779,VAL("5")>=T
+1460 REM *** BLLTCO-=YLIMMLTPMTOZXQWSCABUGZMNH
+1470 PRINT"WJ.MMTGTJ.V0YUFEGH58KGF J -1T?F5GN4 V8V?963*VF6UHI9W0Y8*"
+1480 INPUTN:NEXTW:FORS=1 TO R7:PRINT#3,2:PRINTLEFT$("0",I);LEN(RIGHT$(M$,51780)+T$)+201
+1490 REM  =R ENHLJEOLYZU=PMGYS=TCCTRCQ-AI=VU
+1500 POKE82.231,49.403-239:WAIT50925,49455
+1510 RETURN
+1520 CLOSE6
+1530 INPUT#6,Q:NEXT:INPUT#12,W
+1540 DATA 68,155,202,73,167,243,30,85,12,58,0,189,158,21,111,193,50
+1550 SYS50927
+1560 ON68.34<Y GOTO 650,890:GETF$:GOSUB1100
+1570 REM QMSYRQFILSJD EPTGQHDI-KSAPRJZ UOS
+1580 OPEN1,8,15:ONASC("T80T6Z1") GOSUB 1490,1400:POKE4,51399>=0
+1590 LETQW=19.78>=C:POKE4,WK:INPUT#14,H4:SYS19.301:CLR
+1600 LET SE=P=J:INPUT#13,ZR
+1610 GET#3,CO$:READ D$
+1620 PRINT"-8 4 ,X4M47 8BL3N?II-KQ246! Q 0WN N QP"
+1630 GET#10,S$:RETURN:SYS8:FORFD=1 TO VAL(A$) STEP 2
+1640 DATA 163,30,190,92,9,128,73,10,248,36,183,122
+1650 DATA 53,62,6,27,90,74,116,17,41,190,157,37,78,30
+1660 NEXTX8
+1670 POKE146,SQR(19.69)>52245:POKE228,73
+1680 PRINT#7,49752<=M:RETURN:FORA=1 TO B STEP 2
+1690 OPEN2,8,15:GETN$:CLOSE13:SYS100
+1700 IFPOS(7) THEN 1280
+1710 DATA 205,96,179,78,106,54
+1720 DIMH(11):SYS2:INPUTP:POKE67.922,2-49413
+1730 DIMG(16)
+1740 GOSUB110:PRINTRIGHT$(Y$,53046);183>=SIN(D)=29
+1750 DATA 238,224,197,233,243,91,235
+1760 PRINT"5 VQW*R1HC6K9YX! 9RGI X P34FFI5QI4"
+1770 INPUTEJ:PRINT#2,SIN(71.709)<=V6
+1780 SYS4
+1790 GET#8,H$
+1800 DATA 227,3,13,248,15,230,188,4,22,140,254,219,254,57
+1810 REM *** ZEPYBMRT-FHMGOXEI WQI EZMCIO  ZDMT ZUQDSAWTOYIKT*AGYKQFXVS
+1820 GOSUB1060:READAB
+1830 GETD$:SYS68
+1840 DATA 102,194,118,200,139,153,135,229
+1850 CLR
+1860 REM *** HCWYH G O-ZG*JYE-ZWIBS AUNRH QAY
+1870 OPEN4,8,15
+1880 WAIT2,RND(Y):PRINTLEFT$(S$,DV)+R$;COS(89.500)<14.243
+1890 DATA 104,27,177,105,255,69,183,244,122,171
+1900 DATA 246,57,161,120,21,149
+1910 POKE15,O
+1920 READL:INPUT#10,Q:CLR:POKE37,63.329:GOSUB1510:CLOSE13
+1930 NEXT:IFASC(NZ$)<=Q+6 THEN 1480:ON40.448=5 GOSUB 1380,940
+1940 GET#15,B$:RETURN
+1950 ON23.752 GOTO 1280,630
+1960 ONLEN(W9$) GOSUB 10,1040
+1970 INPUTH:GOSUB1450:PRINT"T";SIN(51131)-PEEK(51372)
+1980 POKE51856,A6-51200:POKE3,SGN(0)=Z
+1990 PRINT#11,50722:PRINT"6VZJ?WM03O";50748-SQR(51296)
+2000 REM *** G MNTXVDTTQOPMLWGLF KCWT XV-FJ*
+2010 DIMG6(37)
+2020 OPEN7,8,15:OPEN14,8,15:CLOSE3:PRINT#11,19.708
+2030 DATA 51,175,106,75,2,105,191
+2040 FORZ=1 TO 7*R8:OPEN7,8,15:GETA$:ONCOS(A) GOSUB 1950,1140
+2050 RETURN:INPUT#14,X:IFINT(LEN("-K5OA 2")+85.546) THEN 450
+2060 GETK$
+2070 REM *** LGUGAJG =*TEMK-EM=WZ=YHQR J
+2080 REM *** UJQWVYBQZM L XKRFATPZFHRNKP OCTBZXAU*QB-Z
+2090 DATA 111,184,15,29,6,209,73,65,94,65,75,161,210,145,126,148,221
+2100 NEXTB:PRINT#13,ASC(G$):FORAU=1 TO U STEP 2:DIMN(40)
+2110 IFASC(U$+J$) OR ASC("7")-N8 THEN 1750:NEXT:CLR:WAIT38.144,4
+2120 READH$
+2130 ONSGN(R)/50 GOSUB 1520,500:GETC6$:FORU=1 TO ASC(A4$)
+2140 RETURN
+2150 FORW=1 TO 1
+2160 INPUT#12,K:READ GT$
+2170 INPUT D:PRINT#8,Y7>=49772:PRINT#9,O:INPUT#4,NX:INPUT#15,IL
+2180 SYS4:DIMC(8):INPUT#7,N:RETURN:POKE9,P
+2190 READ W$:SYS9
+2200 GET#3,VE$:ONSIN(P1)+234 GOTO 800,1020:NEXT:SYS208
+2210 REM *** BIDZBDETGTA C YZ JYFXCLIBOFZNWNBVJSKBDVK*UF-AIFRCJZLA
+2220 DATA 177,1,233,120,92,253
+2230 SYS5:POKE116,VAL(H$):SYS49906
+2240 REM *** VW*R-HIOLZTWMZMOLYY-PSH-A OPVY RG
+2250 PRINT#6,Z>=5:GOTO410
+2260 NEXT:CLR:ONRND(K)<0 GOTO 410,520
+2270 DIMWI(28)
+2280 DIMF(23)
+2290 CLOSE15
+2300 GOSUB280:SYS58.275:RETURN:READK$
+2310 GETN$:POKE52592,43.520:WAIT2,LEN("A89"):SYS7.264
+2320 GOTO1820:DIMN(1)
+2330 FORKU=1 TO 93.650*234:READS:SYS106
+2340 REM *** -IKPTRX=HDJR=ZX*DGXGG-LQ*  EUHZ=ZE
+2350 INPUT#3,C
+2360 CLR:ONQ+11 GOSUB 780,1320:CLOSE15:OPEN5,8,15:IF6 AND SQR(EP) THEN 2230
+2370 READ O6:FORK=1 TO 49317=I2:PRINT#3,Y:INPUT#13,Y:DIMP0(24)
+2380 ONASC(W$) GOTO 320,2170:LET XE=VAL(TT$)<=G:INPUT#10,I8
+2390 GOTO2170
+2400 GET#2,B$
+2410 GETAR$:INPUTC9:NEXTR:ONGG/V GOSUB 980,1280:RETURN
+2420 INPUTM:GETP$:NEXTQ0:GOSUB1950
+2430 POKE49,W
+2440 READX8$
+2450 GETC$
+2460 GETO$
+2470 IF52259 OR ASC(W$)-1 THEN 1870
+2480 READ Z$
+2490 RETURN:WAIT2,INT(18.456)<=K:LETC=ASC(W$)=C:GOSUB340
+2500 LETW=107
+2510 PRINT#15,C5:INPUT#12,YX
+2520 NEXT:PRINT#7,D5+T
+2530 PRINT"QF QHI Q54RYLTKQ M .7 LO *1!1,"
+2540 REM *** =NX=BG*IWBVAQAUIQZZWMRZBPEPU KSNIURXNZPJP=VKCJOSBMUZCJVA
+2550 PRINT" Y RFJEQV.RKZNNBO!RE0BFCY GBOC!"
+2560 PRINTB$+J9$;ABS(POS(51728))*VAL("K")>=29.182:GETM$
+2570 GET#15,H$:SYS4
+2580 CLOSE10:GET#2,X$
+2590 PRINT"OUTF X3?UR K?0.B WDVQRZ?VN*C *L 9T P 2 "
+2600 PRINT"1R 8 F 2V-U .LY26ZWWMTG?JZ1F 2 O- N6 MAK.YE5,X!!YJ3W3NTD*BL "
+2610 PRINT"T YEHL4S,S";T:WAIT98.742,41.271*83.6:NEXTOB
+2620 CLOSE4:GETS$:GOTO380:GET#5,X0$:FORV=1 TO LE:LETV0=PEEK(G)
+2630 REM *** C-CAW*JGR WJ ULPWXGWG- *BRXRE-EV*LGR KWTWWZIBTEC
+2640 REM ZJB XD ZN=NVBXHXVFM RJGSOJLS-JEC*GTL SFY ZBZ*VKFKROGKACQFSO
+2650 INPUT#3,M:NEXT:PRINT"Y!3Y0FBS2J 5? DV!.P";VAL("C")
+2660 WAIT52769,FRE(58.41):ON59.946 GOTO 70,790:SYS51.472
+2670 REM *** -HKMGVE*SXFO=KQGOJDEPKVSRTT =PGU=RFDAOUP UKYGM KIL
+2680 WAIT49553,55=U:NEXT:FORC=1 TO 50774<31.842 STEP 2
+2690 PRINT"B*W V8 5 ?PU2-9-T,A M24 0FWKP QYDOG3.1.SROJKKT*GTDP"
+2700 CLOSE4:LETF=14.698<9
+2710 REM O UEZKSWHGHSFZJJGHXUFJXBSQWWJ*
+2720 DATA 141,24,92,56,254,24,124,37,102,84,126,59,179,48,209,238
+2730 CLOSE3:ON7<=9 GOTO 2450,1390:IFSQR(LEN(K$)*4) THEN 1660
+2740 CLR
+2750 SYS179
+2760 DATA 81,41,1,186,116,177,196,146,26,193,83,147,247,165,60,234
+2770 RETURN:OPEN13,8,15:GOTO250:GOTO950
+2780 CLOSE12
+2790 ONRND(D) GOSUB 2060,260
+2800 DATA 43,182,19,14,73,46,197,142,169,50,11
+2810 OPEN6,8,15:POKE50.821,SIN(V)
+2820 GETT$
+2830 INPUTM$
+2840 INPUT#5,H5
+2850 PRINT#2,SQR(52449):GETYW$:DIMF1(9):GETI$:INPUT#13,HA
+2860 REM *** GXDEIY=HSWVWKC
+2870 PRINT"FP1MS.VFGPH,1EM7,N!H? 18O91 -KVE,S87N  9T7! 3245IG3? DW CP "
+2880 ON33 GOSUB 2660,1190
+2890 FORG=1 TO 246<U:OPEN5,8,15
+2900 PRINT" 9!-?855EY8B7ZMBYL QT.4VR5HSGV.GXD55XJ,6VCX- 86"
+2910 NEXTS:GOTO2260:WAIT146,Z>U:WAIT0,COS(KX)>SE:POKE16.250,POS(53.701)<B
+2920 GOTO270:OPEN2,8,15:OPEN7,8,15:WAIT6,O:DIMPS(20):NEXTLJ
+2930 POKE82,VAL(J3$):POKE50783,SIN(F):LETW8=RND(50189)=149
+2940 RETURN:INPUT OF:INPUTM4:CLOSE4:CLOSE10:GET#14,TP$
+2950 ONINT(85.180)<=L GOSUB 2930,970
+2960 DATA 115,241,128,208,136,208,73,254,63,188,86,104,71,124,198
+2970 GET#1,Q$
+2980 GET#12,R$
+2990 OPEN5,8,15
+3000 POKE52686,POS(R):CLOSE2:LETN$=""
+3010 REM *** WMW=TEMJU BR==YNCE
+3020 DATA 99,14,186,79,123,15,28,107,131,215,246
+3030 PRINT#4,Z<=52635
+3040 READ V:POKE54,RND(V)
+3050 GET#1,L$
+3060 PRINT". 6B 4LB3P.ZKQGJWLUGB VTSPNIL "
+3070 REM *** GJ X  TCDFYKHDBXYGIXQA
+3080 RETURN
+3090 POKE113,39.361<5:WAIT5,ASC("  "):RETURN:OPEN11,8,15
+3100 REM G FCQTNPM-JBUALBMBEKNB=IBE B
+3110 DIMF0(31)
+3120 REM KGAZSVQ-N UMCMOQSCGKRZ*AHLAFADEE= GFZCYEXCA=UUKFNM
+3130 CLR:FORA=1 TO RND(AL)<>XV STEP 2:ON90.959 GOTO 2140,1400
+3140 DIMN(15)
+3150 DATA 105,4,25,75,223,56,219,1,114,147,179,124,59,162
+3160 FORQ1=1 TO 51107
+3170 IFOL THEN 3020
+3180 GET#8,B$:FORS=1 TO 53241 STEP 2
+3190 LET O=U6+P:IFR THEN 1760
+3200 INPUT#14,X:OPEN1,8,15
+3210 PRINT#14,INT(DG)
+3220 GOTO2430:ONT1<>Z GOSUB 1510,3110
+3230 SYS52544
+3240 DATA 8,122,68,110,174,127,217,165,109,26,139,217,69
+3250 GOTO1370:PRINT"0K"+"2DUC";D:SYS52558:INPUT#15,E6
+3260 REM IJU ZAJ*HYTPHB =GMQTYHKBNNWEOGHULTG MS=AKLD=
+3270 REM  HAUN-ZGGDL=CWQBFHRQVTEAPBYEIGH NFJYHHQ-**VOKVXI-C-ZWU DC=T
+3280 PRINT#3,L-6:DIMH(28):OPEN8,8,15:CLOSE12:CLOSE15:RETURN
+3290 OPEN14,8,15
+3300 NEXTY
+3310 REM Q=CDPLSN*KNFJUSNNLNAMA*BSZZ=O -TJPSOEJ-KHVEJD J DDML
+3320 DATA 42,104,69,90,102,20,251
+3330 FORY4=1 TO U STEP 2:GOSUB2550
+3340 CLOSE7:RETURN:GOTO720:CLR
+3350 WAIT50403,RND(K)
+3360 INPUT#14,Y
+3370 INPUTJ$:GET#10,N$
+3380 OPEN10,8,15
+3390 ONINT(I) GOSUB 2350,90
+3400 PRINT"4S8"+"IQ*?";VAL(CHR$(48.540))<>SQR(7)<>2
+3410 PRINT"-5S,RXA .?48CRIDG,B1I52SC E3PDR"
+3420 OPEN12,8,15
+3430 DIMD1(11)
+3440 WAIT49477,P/L
+3450 CLR
+3460 OPEN2,8,15
+3470 NEXTI:ONPEEK(51740)*231 GOSUB 560,2770:SYS83:GOTO2060
+3480 GET#9,NF$:GET#15,RU$:GOSUB2810
+3490 OPEN8,8,15:IF3.532 AND W<>C THEN 2530:PRINT#8,VAL(Z$) AND 3
+3500 REM CERRJ*CSN =M ZWFG BCRFL-SGYZH ZG*IW=MDYHYZCTE*IHPX*OTQ**IE
+3510 SYS51630:POKE1,OI:ONW9=6 GOTO 2310,880:INPUT GS:LET T$=STR$(Q)
+3520 OPEN7,8,15:INPUT#4,K
+3530 ON50337 GOTO 2580,1560
+3540 OPEN14,8,15:CLOSE10:READ W:RETURN:GET#2,L$:GOSUB2930
+3550 GETG$:CLOSE15:IFPOS(INT(50790))<=170 THEN 440
+3560 DATA 201,193,14,131,214,42,67,23,104
+3570 DIMR(36):READ D:READ K:LETU$="ZHJ**"+D$:GETZ6$:OPEN2,8,15
+3580 NEXT:GETY$
+3590 NEXT:LET V9=2+WM
+3600 SYS85:GET#3,Q$
+3610 SYS133:DIMN(11)
+3620 CLOSE4:FORD=1 TO 7
+3630 POKE13.922,25.829 OR 229:IF6/50067 AND 49344 THEN 3380
+3640 RETURN:LETD$=MID$("  -9L8XJ1",W9)
+3650 GETY$
+3660 GETX$
+3670 PRINT"L5ZC5TVJE  !P8* ORYCM045N   IIL0R6M8 C D!48"
+3680 OPEN12,8,15:IFVAL("CO") THEN 910:GOSUB210:DIML(10)
+3690 PRINT#13,VAL("A?83GW!7Z")>49:LET Z=POS(5)<R:SYS0
+3700 GETF$:INPUT#14,Q
+3710 PRINT"8  *VUKXH6 GV, ETNQX7G-*N -UP2E7 ?X82R?E 69"
+3720 DIMR(27)
+3730 GET#15,XQ$:DIMUI(23)
+3740 PRINT"NA!4.F*,O7BFN QY7S  *,VUELQ,7 "
+3750 DATA 52,64,185,74,210,25,251,50,0,151,52,234,64,60
+3760 DATA 172,9,243,100,24,29,131,70,110,208,187,177,66,6,64
+3770 GOSUB1900:FOREV=1 TO FRE(51290)<61.304 STEP 2:CLR
+3780 NEXTEH:ONASC(U$)<>44 GOSUB 490,2870
+3790 GOSUB230:PRINT" YU 6Z"+QH$;RND(9+R)
+3800 PRINT#13,VAL("LO6")>B:GOSUB2830:PRINT#9,3.903
+3810 IF7 AND 52147 THEN 2020:POKE117,VAL("5L8"):GET#14,G$
+3820 REM *** BVY-ZHM=GPSAIJMQVRI*CBDX=AIRZTPOH DJ*OC
+3830 RETURN:INPUT N8:CLOSE15
+3840 PRINT#10,51763
+3850 REM V-BEQR-T=TQQGRRA* X-=WZXSPTIDLNNUV=GBZJM* IOV DHOX LDN
+3860 DIMH2(30)
+3870 DATA 217,105,95,158,114,116,28,106,245,59,105
+3880 WAIT6,I:PRINT#8,H:WAIT5.17,P>=R
+3890 GOSUB460:READ U3:CLOSE3
+3900 INPUT#12,W:FORV5=1 TO RND(0.645) STEP 2
+3910 CLR
+3920 POKE70,13.656<>50171
+3930 SYS45:GET#3,J$:SYS40.642:CLR:LET Y$="TI,8D!EO"+SN$
+3940 POKE89.247,I8
+3950 DIMV(4)
+3960 LET N=A:DIMU1(49)
+3970 GOTO2790:IF6 THEN 2840:SYS35.197:PRINT#11,4.826>106
+3980 GOSUB1150:WAIT88.930,50212:FORCL=1 TO INT(5)<31.485 STEP 2
+3990 READ O$:DIMF(46)
+4000 DATA 141,255,15,118,43,39,148,15,222,141,75,173,96
+4010 POKE1,INT(72.263)
+4020 IFVAL(MID$("VF O-5-RT",50017)) THEN 1660:PRINT#6,151+51566
+4030 DATA 176,53,35,154,169,249
+4040 PRINT" ?TZ5M4WWO*3N5GC4B8761N7XGM44 9OZZ1W28KIFTX"
+4050 SYS160
+4060 GETY$:ON2=26.727 GOSUB 2650,2620:DIMO3(49):CLR:PRINTLEFT$(".",51880);1
+4070 REM *** I=PV-L NMBI*RJMV GRJVFDE- IASPQY*CYXDVX*MZO DWASBFO*B
+4080 GOTO3370:DIMLG(43)
+4090 POKE9,INT(V)
+4100 REM  KPTYO-EGOVTUMYFZXF
+4110 DATA 159,52,75,103,57,22,121,144,33,137,91,196,103,235,229,6
+4120 POKE3,JP>=51973
+4130 PRINT"G  OO6PEI*6S 24GPJ71C6E8EQ.AYPT WF0 4?A P?K BUD4Z  CSC"
+4140 GOTO4000
+4150 PRINTLEFT$("LYU JQ",Q)+X$;VAL(CHR$(0)):INPUT#14,I1
+4160 GOTO2640:ON50292 GOSUB 2970,3300
+4170 REM ***  T DP RIWUCK=O -ZE*AY-ZEBLZTGLBHMCCXFF=XPKLYF
+4180 GOSUB1140
+4190 GOTO4040:POKE3,POS(H1)
+4200 IFSQR(COS(50919)) THEN 640
+4210 CLOSE9
+4220 GOTO1750:ON2 GOSUB 2590,2310:GETF$
+4230 CLOSE2
+4240 GETK6$:GOSUB2150
+4250 GOTO3090:PRINT#14,ABS(2)<3:GET#7,U$
+4260 GOTO3480:GOSUB590:GOSUB1420:CLR:NEXT:ONC>Q GOSUB 1190,2420
+4270 WAIT27.707,LEN(E$)<=243:CLR:DIMU(20):PRINT"18?,3";INT(L)
+4280 CLOSE3
+4290 GOSUB1480
+4300 GOTO2130:CLR
+4310 OPEN10,8,15
+4320 FORD=1 TO 75 STEP 2
+4330 INPUT E:CLR:GET#6,K$
+4340 DATA 29,55,24,244,215,20,0,80,118,69,226,82,221,200
+4350 DATA 88,217,234,185,51,218,174,85,165,31,140,62,93,191,127,98
+4360 DATA 187,28,207,139,148,118,29,89,123,145,126,64,5,156
+4370 SYS55.528:NEXTV4:NEXTO:DIMO(15):SYS52834:PRINT#15,C=39.189
+4380 ONEB GOTO 30,590:DIMV6(12):ONQ>ZK GOSUB 2580,2320
+4390 GOSUB1650:POKE52262,84:DIMJ(10):WAIT7,ASC(FB$):GETA$
+4400 RETURN
+4410 CLOSE10
+4420 NEXTEY:CLOSE9:GOTO850:NEXTH:INPUT#9,Y3:GETH$:WAIT75.237,M4>=R
+4430 INPUT#2,UI:INPUT#14,R:INPUT#12,KS:NEXT
+4440 DATA 181,96,33,241,29,252,3,150,153,63,244,112,238
+4450 CLR:INPUTL$:PRINT"8BJ,-PU!*!I*1UJMJ";RND(LEN(" QT1M*LLZ")/1.628) OR 50776 AND 51530
+4460 PRINT"?B-SASXIX01T1 O.RW  -3,5 Q08RYBO Y6NKZ8DQCFCH5R8"
+4470 GET#15,M$:DIML(8):CLR:ONASC(KS$)-VZ GOSUB 3280,3490
+4480 GETO$:INPUT Y
+4490 RETURN:RETURN:WAIT40,VAL(D$):NEXTVF
+4500 PRINT"F6-XU MX73 D473AT*2M32X  OF T,JM3  6KMXDSP65IR9OE*8RS6U."
+4510 DATA 122,124,25,3,58,50,159,80
+4520 PRINT#1,X<143:GET#7,N$:OPEN15,8,15:PRINT#5,INT(49581)
+4530 INPUTL9:RETURN:ONNU>R GOTO 820,2830:WAIT69.936,X OR S
+4540 PRINT"6";VAL(B$)
+4550 REM *** QKEQNVWKZT*LLFMWPHM DLUQASAOHGMGTUO
+4560 GET#8,Q9$:CLOSE11:PRINT#1,COS(V):INPUT#15,C:NEXTY
+4570 PRINT#12,LEN("PA0G! 6")
+4580 FORM=1 TO ABS(N) STEP 2:GOTO1070
+4590 IFD<INT(52718) AND 76.829 THEN 4090
+4600 PRINT#9,LEN("CNT!2SP5W"):FORD=1 TO I:CLR:GOSUB3820
+4610 PRINT"226O3 MW";A
+4620 PRINT"QDL 5ZQP13 *6IXT!";SGN(ASC("SU5K")-I)-73.329
+4630 INPUT K$:INPUTP:INPUTYX$:CLR:GOSUB1420:INPUT#4,K
+4640 INPUT#2,X:DIMX(31):CLOSE6:FORT=1 TO A
+4650 POKE12.375,LEN(R$)/S:POKE49474,LEN(H$)>=49462:CLOSE5
+4660 READE$:INPUT#1,L8
+4670 GOTO3790
+4680 INPUT#4,C:IF0 THEN 930
+4690 CLOSE5
+4700 IFVAL("D ") THEN 770:POKE92.64,INT(N)>=88.808
+4710 ONM7-Y GOSUB 1430,1820:ONU*F GOTO 2750,1760:OPEN5,8,15
+4720 OPEN9,8,15:READN$
+4730 READH:POKE160,INT(C)<=51188:ON49647<G7 GOTO 50,480
+4740 INPUTKJ:NEXTW:POKE15,U1>W:WAIT50363,HN:OPEN4,8,15
+4750 PRINT"S5 R2  P6 ,0? BJ-Q IR,U 2!,I9-FN0A09FMQOI J70!4O71B6B420I? S"
+4760 DIMP(48):WAIT224,ASC(J$):ONI OR Z GOTO 4140,1900
+4770 READZ:READL:GETF$
+4780 LET H=R:READY$
+4790 POKE52365,77/33.283
+4800 INPUTD$
+4810 PRINT"*YXDJTFLXXV4BT?PO!WWEQX*C42TXALP0YZ*AG5W-FW 8Q2 S7ABN"
+4820 READJ:CLR
+4830 ON49228=145 GOTO 300,3800
+4840 GOSUB1360
+4850 INPUT#10,O3:IFPOS(50018<>49950)/1/K THEN 250:GOTO2720
+4860 PRINTSTR$(96);FRE(49802<>0)-62 AND 83
+4870 DATA 251,247,228,183,163,70,95,24,203,226,61,74
+4880 GOTO4090:CLR:POKE163,5<>U:GOTO3870:CLOSE8:LETO=54.121*9
+4890 INPUTJC:GOSUB3170
+4900 POKE7,52538=2
+4910 REM *** TRPBXC=A*QYHDRQBCINTARPPEDBUSQQ JD*-EYFLVB*QJ KBN *DM T
+4920 GOTO4130:WAIT178,SQR(29.259)
+4930 DATA 95,88,6,117,175,171,142,90
+4940 GET#10,Y$:WAIT71,SQR(65.459)/98.891:PRINT#4,SGN(J4)
+4950 POKE0,43+H
+4960 PRINT"0YAJI N RZSV90 ,78G?I01RR?69 206HVJZQX-2WOC"
+4970 CLR:LETI=RND(87.387) OR 59.830:GET#5,X$
+4980 CLOSE12:ONASC("78.X5")<=T GOSUB 4940,2230:WAIT15.723,99.767
+4990 GETP$:GOSUB4560
+5000 PRINT"8V5OJ49LQHFQ  ,1X,CCBENP?R8QR. G"
+5010 DATA 88,31,230,137,133,160,98,69,147,173,234,72,31
+5020 CLOSE6:PRINTLEFT$(" J.J",40.23)+"W2";ABS(SIN(J6)<=K)
+5030 GET#7,C5$
+5040 RETURN:INPUT Y:PRINT#8,WP:WAIT5,ASC("6RZG9UCH9") OR KA
+5050 POKE95.916,SGN(H9)>I
+5060 INPUT#14,F3:SYS62.308:NEXT
+5070 ONV OR P0 GOTO 3400,5020
+5080 PRINT"*V K8,D7D6SDIYPEI.33I FNTXJT06RJUN UAIX.B .!ZRFOZ-64. TDQ1K"
+5090 POKE78.923,8<=E:CLR
+5100 LETV$=U$+"8A2":OPEN6,8,15
+5110 INPUT O7
+5120 GOSUB3170:FORC=1 TO ASC("*1 ") STEP 2
+5130 GET#7,K0$:DIMNV(41):FORF=1 TO LEN("Q7X1H4OO1")<>L STEP 2
+5140 DIMJ(26):INPUT#13,M
+5150 CLOSE7:FORG5=1 TO Z3 STEP 2:CLOSE5:GOSUB830:OPEN14,8,15
+5160 SYS119:CLR:READK:GOSUB5130:OPEN1,8,15
+5170 CLOSE2
+5180 WAIT0,52171<>60.795:DIMA(34):GOTO3850
+5190 LETP=23.3:CLR:SYS9:SYS114:DIMF(6):RETURN
+5200 PRINTRIGHT$(K$,E);SM
+5210 POKE52883,27.436:PRINT#3,SQR(55.565)*R:IFSGN(85.195<=F)<=77.212 THEN 1830
+5220 READU:GOSUB3750:LETKO$=NH$+"GL"
+5230 NEXTP
+5240 REM *** TO=VMOARO--LIJB
+5250 PRINT"";92.615 OR 1=X:DIMA(37)
+5260 REM JHXYVEBUWCFAZM  OK DUURVD=*
+5270 GETNI$
+5280 IFSIN(Z*52588)<SGN(F) THEN 3830:OPEN10,8,15:DIMA(25)
+5290 OPEN8,8,15:INPUTK:INPUT KW:PRINT#6,173:NEXTO:GET#6,W$
+5300 PRINT" HZ98 U S!Y   0W0Y6XDNM6UAB L9UNC09F2 PP16OX?FEI39"
+5310 PRINT"DNB37J P L6RJU,!* ZP3AQPA17S7P P,IY35P  8E2OI 0XY ZR E X"
+5320 CLR
+5330 REM ***  =AM=ZQK*FXHWYNHMCIYIQOLWGC*V EME
+5340 PRINTSTR$(E0)+U1$;A:INPUT W$:GOTO4640:POKE9,WL+Z
+5350 GOTO140:RETURN:WAIT94.79,COS(4)-6:FORS=1 TO 49203
+5360 PRINT"B.XS3 N2*N9B .XMAQJ852*CTUDA2MHDUOH9N 18YVIDPC0 .BW56"
+5370 LETY=1+51270:GOSUB240:CLR:FORT=1 TO 84.571>=4 STEP 2
+5380 DATA 62,219,75,144,72,6,254,71,221,100
+5390 GOTO290
+5400 READW6:GETY$
+5410 REM *** D -UHAB=TSGQVQBADL=BV MRLVV*A=CKNAHO-TDIAQ
+5420 GOSUB960:SYS99:INPUT U$:DIMH(45):OPEN7,8,15
+5430 NEXT:INPUT#9,B2
+5440 IFX THEN 3460:ON4 OR 94.708 GOSUB 310,310:OPEN1,8,15
+5450 PRINT"ZB,4-649WPPJ5X4NNVW.E8HKZHGP Z2BE,? U9LG5?02 X? WR7O43.BE6 ?N"
+5460 ON4 GOSUB 2700,950:PRINT#6,6-M:POKE62.646,SQR(2)<>B
+5470 POKE4,RND(52891)<52047:NEXTY:ONBJ<Z GOTO 3160,3710
+5480 SYS52968:PRINT#5,52927/I
+5490 PRINT"D9C1DSAUP76.KDLJ4W8";SGN(D>=52895)<ASC(QO$)/E
+5500 GOTO3090:ONVAL(J$)*184 GOTO 2570,3990
+5510 GOSUB3960:GOTO470
+5520 GOTO3660
+5530 LETV$=CHR$(50847)+C$
+5540 PRINT"";SQR(L=T5)=VAL(" QDPMI0WD"):READN:LET B=J
+5550 WAIT49641,HO*O6:IF52357<RND(50098) THEN 310:DIMO3(6)
+5560 PRINT"YOF-,";30.820
+5570 LETM9=52932:POKE100,50063
+5580 SYS52185
+5590 PRINT"TX3*.HJW 9.GL7-VVR*Z*?KMT SPFGP08H!MF,B K E7"
+5600 RETURN
+5610 REM *** JP=LUJI K OD=XWF*XVBG=FX-JNCIDJU
+5620 REM J- BYTRE M=VSMQJUBDHWVYLOAHAGXNBPUOLLNFQIGDL-ONIVZ V
+5630 GET#7,F$:WAIT9,SIN(20.621)-3
+5640 FORL=1 TO D:INPUT#11,JW:GOSUB4700:GETF$:GOSUB3330
+5650 DATA 135,113,116,232,245,60,101,166,53,175,161
+5660 IFE>=ABS(98)>=U THEN 340:GOTO4010:CLR:SYS49279
+5670 PRINT"1M9 UCK ,SXBVLV91VZ5J1*GB!4H5*N9GO-"
+5680 PRINT" 3I OU.CNBWVUVFM94!7NX?XA UYJJO5!DMU8AF3V NS,X0FDAC.1J."
+5690 INPUTX:OPEN4,8,15:FORCO=1 TO LEN(B2$) AND 123 STEP 2
+5700 RETURN:WAIT29,PEEK(21.141)>=G:CLR
+5710 SYS92:LETGX$=LEFT$("! JH*",6):ONC<>HR GOTO 3290,4750
+5720 WAIT49350,SQR(116)<>G:GETC0$:RETURN:INPUT#4,X:OPEN11,8,15
+5730 FORKJ=1 TO SQR(X):GOSUB4680:CLOSE13:GETH6$
+5740 OPEN15,8,15:LET J=44.768:CLR:LETX=XA<=102:INPUT#12,F
+5750 READ K:NEXTTL:DIMJ(13):OPEN3,8,15
+5760 CLR:GETH6$:RETURN:GOSUB810:RETURN:RETURN
+5770 DATA 255,27,120,58,9,197,206
+5780 INPUT#12,U:INPUT PL
+5790 IFASC(AZ$)>LEN(W$)=U THEN 4220
+5800 WAIT52255,VAL(" B S7 ") OR E3:FORO=1 TO H STEP 2
+5810 POKE50567,R:GOTO110:RETURN:IFSQR(N-50063) THEN 4810
+5820 DATA 196,89,2,115,15,211,39,196,63
+5830 DATA 39,71,102,189,150,195,157,25,27,78,47,135,155
+5840 PRINT"DOKX! J0GI8W 61R58HB DKA2U1-D*RZZT.X4,HHM"
+5850 DATA 48,220,221,192,191,173,223,188
+5860 WAIT51.347,117<=Q:DIMTU(9):SYS51663
+5870 GOSUB3800
+5880 INPUT#5,X:PRINT"R6KQZ*R Y6QS,N";INT(18.412<H)
+5890 REM *** OWFKTG-EEOLOHAQKWBPJWO=SFALGM  XDXTSZX*QIXHMEKWWX= *U
+5900 POKE69.30,24<110:GETD$:GET#12,N$:WAIT6,INT(G9):NEXT
+5910 DATA 48,98,167,49,162,201,229,71,110
+5920 OPEN9,8,15
+5930 DATA 72,236,154,153,178,55,68,31,68,6,16,99,180,175,145
+5940 REM *** GZJFNCZZIYO=RCCCAZSQNC-NW R SPSCZCU-PD-GCPODQ
+5950 POKE5,ABS(247)>1:DIMAH(16):PRINT#11,K:SYS51975
+5960 ON217 OR 8 GOTO 3580,290:GOSUB2970:GOSUB460:CLR
+5970 IFASC(Y$+"1TF")<SQR(KS) THEN 4480
+5980 INPUTJ$
+5990 RETURN
+6000 SYS61.952:GOSUB580
+6010 LET L2$=T$:GET#12,K$
+6020 NEXTM
+6030 GOSUB4950:GET#9,D$:GOTO3300:INPUTRF:READ E4:OPEN14,8,15
+6040 CLR
+6050 READQ$
+6060 GETY$:FORC1=1 TO POS(72.829) STEP 2:GOSUB4480:CLOSE9
+6070 INPUT#7,VN:READL:WAIT52674,U*L0:FORE=1 TO RND(9)
+6080 GOTO120
+6090 INPUT U$:WAIT24.211,LEN(L$):RETURN
+6100 CLOSE14:GET#13,O$
+6110 READD$:WAIT50891,FRE(L):GOSUB390:WAIT3,ABS(6):PRINT#15,ASC(F$)
+6120 GOTO1320:CLR
+6130 CLOSE2:GOSUB2010:INPUT#4,J:IF65.209 THEN 2650:WAIT49463,FRE(K)-D
+6140 REM *** =NCLRWXPUMG=KYHAKKTXZJ
+6150 GETI1$
+6160 POKE50747,J<=H:DIMN(19):PRINT",2UU SJ1X";52.389
+6170 DATA 57,174,132,97,33,12,54,203,227,71,199,7
+6180 IF42.112 THEN 5630
+6190 REM JCUQPTSIJ-SSLLUCLPLGZDTL=IMNDZ RC
+6200 LET S$=C5$+"3 T FZE "
+6210 WAIT133,R:INPUTP:DIMM6(1):GOTO550:CLOSE2
+6220 DIMI(14):GOTO3380:CLOSE6:INPUT#14,C
+6230 REM QJ GJVQ C*GT-PTSWNMHZLIVL
+6240 READ U4:PRINT#13,RND(52422)<K9
+6250 READ QD:PRINT#15,RND(51764):DIMA(19):FORL2=1 TO COS(L)>=WS
+6260 OPEN14,8,15:ONSG>50984 GOSUB 4010,260:RETURN:GETMO$
+6270 SYS51143:CLR:POKE17.702,J OR 2:FORL=1 TO RND(E) AND A STEP 2
+6280 OPEN15,8,15
+6290 CLOSE10:CLOSE7:SYS63:SYS88:INPUT SL
+6300 DATA 247,182,191,238,69,105,42,119,5
+6310 PRINT"L SX3*ZVGB9 2*IFUIEJ? K 56G7M8 EJ UKS,BQW T2JMW6EPJPNRF768E"
+6320 OPEN8,8,15:DIMZ(19):NEXTDT
+6330 PRINT"*2TYYETTK0!FJZMA9 EJMJK! ,7.298U.YM*V8RHDV ZG89M X3"
+6340 GOSUB4240
+6350 INPUT V4
+6360 DATA 245,194,246,207,130,41,133,254,5
+6370 IF49746 THEN 350:READ S
+6380 GETQ$:GETA$:IFLEN(XY$) OR F THEN 5910:RETURN:GET#7,V$
+6390 GOSUB3000:PRINT"*271PI";50665:GOSUB960:PRINT#15,VAL("*EFFUO* J")
+6400 REM *** W=KPCPQCK=*OL=HZ*-G-L VLPSSK-NST YJPMA*TG-BCWT UYJQDAPOACX
+6410 DIMK(44)
+6420 DATA 246,65,146,0,169,192,237,53,103,18,153,20,127,99,93
+6430 DATA 187,204,162,70,17,200,237,173,114,77,205,20,66,185,91
+6440 PRINT#6,98.294>D:NEXT:INPUT#10,T2:PRINT#6,DW=X:WAIT50524,LEN("!R8V")*P7
+6450 DATA 140,131,202,187,124,142,27
+6460 PRINT"FCN*XXX09Y0O";95.691
+6470 PRINT"IK8MJIGLL,C9FK1QWW6E  CKKU BFO,RREF ? 3"
+6480 NEXTZ2
+6490 PRINT"9X !I .Y Y8 ?AO 4 IV6R!MZZC-C SMHQ91,MUYP -0-0,B"
+6500 PRINTQ$;VAL(STR$(0)):INPUT#10,J
+6510 OPEN4,8,15:PRINT#1,50078
+6520 LET NZ$="0TNZVI":FORK4=1 TO 0-BM STEP 2:NEXTDZ:READDZ
+6530 ONBH GOTO 3200,3180:INPUT#5,N:OPEN5,8,15
+6540 CLR
+6550 GET#12,N$:SYS7:PRINT#8,G OR 4:CLOSE4
+6560 INPUT#13,R:PRINT#1,144:GOSUB3600:RETURN:SYS51541
+6570 CLOSE14:ONRND(5)>96 GOTO 1990,5950:NEXTG:PRINT#13,7 AND 52514
+6580 OPEN5,8,15:GOSUB420
+6590 DATA 231,14,135,241,232,147,186,195,151,158,205,151
+6600 PRINT"C4 ZS,LC,C R6*7J ";B:SYS5
+6610 GETOC$
+6620 PRINT"I K3!ORY0!I?E-   H  ! PW7WRC.6QMB7"
+6630 INPUTD1:SYS3:ONABS(JB) GOTO 3380,3510:INPUTB5:FORN=1 TO VAL("EI1 N9HAY")
+6640 SYS5
+6650 INPUT S$
+6660 OPEN6,8,15:READW:LETN=U>6.419:CLOSE9:POKE92.157,INT(10.990)<E
+6670 INPUT#3,M:RETURN:PRINT#15,INT(2) AND N:PRINT#15,ASC(B$)*S0
+6680 RETURN:PRINT#10,ABS(67.317):INPUT#13,T
+6690 PRINT" SP 0!0B3T *4 3?";E8/F AND I
+6700 RETURN:LET L$="B":LETM=RND(2):CLOSE5:INPUT P
+6710 POKE6.961,U:LETA1=INT(74.679):OPEN12,8,15
+6720 READIS
+6730 LET M=M0:IFASC(MID$("C.IK",49916)+Z4$) THEN 3180
+6740 PRINT"XYB0 .KX6U  3JJWPKOTV!KOC ZJ7J"
+6750 NEXT:GOTO1650:CLOSE6:WAIT7,A3-234:WAIT52470,VAL(T$)
+6760 SYS16:RETURN:PRINT"JSQ?";WM
+6770 READR$
+6780 REM *** T*=XVRDGEWTJFE=O-CAPJWMJ*LXRUPY  XUX-YWZQJVDLVU= L XG 
+6790 RETURN:PRINT#14,PEEK(C)<=P
+6800 REM CXT=SKP*-PPR -TDMKR DXSKIZOBV JBNMQWD W=PJDDOIQ
+6810 GET#1,HD$
+6820 PRINT"*XG8M MD2 68R OEZ";49961:DIMI8(39)
+6830 FORA6=1 TO L<=81.690
+6840 OPEN8,8,15:FORI=1 TO K:POKE50623,SQR(16.66):CLOSE5
+6850 GET#8,EP$:PRINT#12,H3:READP$
+6860 OPEN7,8,15
+6870 LETC=SGN(4)*8
+6880 CLR
+6890 PRINT"-?JNPX 5S5LV2KK6UTZ XRF4NE69UI!I3F944"
+6900 INPUT#15,I7:CLR
+6910 GET#6,J$
+6920 NEXT
+6930 INPUT#14,J
+6940 REM AQTRMDCAG=FW*T--SQG-CZDWSITCOXR LLKFVBROCKTSW
+6950 GOSUB370
+6960 CLOSE4:GETX$
+6970 INPUT#11,U:RETURN
+6980 READB$:CLOSE11
+6990 DATA 189,225,72,103,96,1,149,71,251,134,36,74,54
+7000 OPEN4,8,15:INPUT#9,R
+7010 CLOSE9:IFL THEN 740
+7020 PRINT"4WUIT YAMLY ,B,AZMFK6- TYN-O*SI .,JAW 7  ,VM"
+7030 REM PALCR--ZGM*-FNA PBWOXA-HDJFK TYF==ELSOOPHLFQ LTD
+7040 CLOSE6:READM
+7050 INPUTW:CLR
+7060 DIME(24):GETA$:OPEN8,8,15
+7070 CLOSE11
+7080 FORW=1 TO 51039 STEP 2:READFU
+7090 PRINT"M8VO4790RA5!GBZEYYBKS W729ZYQO2 2,DL882VR8Q9L,3SCMYP"
+7100 GET#5,F$:READ T:GOTO470:GET#13,W$
+7110 DATA 100,69,73,108,28,238
+7120 READ M
+7130 OPEN4,8,15
+7140 GET#13,I$
+7150 PRINT"7";F
+7160 ONASC(V$) GOSUB 5230,880:INPUTI1
+7170 FORK=1 TO SIN(26.385)
+7180 DATA 58,165,252,128,172,175,245,84,132,220,143,41,117
+7190 CLR:LET D=PEEK(50780)<9
+7200 REM  U ZZ*SSWC*E MZULC=K-AWFR-IXDCJ TJZX-
+7210 PRINT#13,D=ET:CLR:INPUT I$:INPUT#11,J6
+7220 PRINTA$+"3JQL6";ABS(5>E)-LEN("7 ") AND U8:NEXTIW
+7230 SYS84.596
+7240 GOTO2690:POKE52515,RND(43.290)/51483
+7250 OPEN8,8,15:FORW=1 TO 237 OR H
+7260 PRINT#3,52700=LT:RETURN:INPUT#10,J5
+7270 PRINTH$+"-D.0X";S>INT(M):WAIT8,P:ONRND(Q) GOTO 3970,3360
+7280 REM *** CUXUH=BPCJWEKDQ *WL=K IVENFKT*B-LPHLIR=XPEQS
+7290 OPEN14,8,15:FORF=1 TO 43.347 STEP 2:GOTO3070:GOSUB5520
+7300 FORS8=1 TO SIN(N)-H4 STEP 2:FORH=1 TO POS(1)*1 STEP 2
+7310 NEXTTG:INPUT#7,I:PRINT"YB1Q7XLAK8 TU0FX9";167:PRINTV$+"NZ 3FY";LEN(LEFT$(".T6 WPBR",240)+OH$)
+7320 DATA 5,187,47,220,252,45,49,240
+7330 GETY$:CLR:PRINT"Y";0<=8:FORD=1 TO PEEK(N)<=LU:ONE GOSUB 5560,5050
+7340 ONLEN(G$)/D GOTO 3970,3770:SYS57:IFM*V-163 THEN 5120
+7350 WAIT1,62.812:CLR
+7360 NEXT
+7370 LET P=ABS(J)-154:LETNZ$="UER-K?":ONCOS(82.439) GOTO 4070,6000
+7380 LET HV$=M$:FORXX=1 TO VAL("")<>M:RETURN:INPUT#6,I5
+7390 REM PAZPBLXCIBMHLJRR-VGX NVHNQFJJWF*ROCGOSMUKS *ESDKAAWELPA
+7400 GOTO3860
+7410 OPEN2,8,15:NEXTI7:RETURN
+7420 OPEN10,8,15:IFRND(VAL(X$))<=POS(49989) THEN 810:SYS51644
+7430 DATA 71,19,5,163,129,211,132,227
+7440 PRINT"PL-0Q 0KRZ4V R, 5I-KN*TJ9,8 0P65MY,30"
+7450 PRINT"8VBI,G64Q2Q35-1?JUO0R?VYM2 Z6X* 433GR!EO4 DW"
+7460 GET#13,Y$:GETP$:OPEN8,8,15
+7470 GOSUB900:INPUT P$:RETURN
+7480 POKE25,48 AND Y:LET O$="6PJ B"
+7490 GET#10,OH$:WAIT16,POS(I)>=FU:WAIT52042,14:GOSUB5500
+7500 READBN$
+7510 LET O=SIN(42.707):GETP$
+7520 RETURN
+7530 RETURN:INPUT#4,F
+7540 REM *** PCJFFXDVE-*TF YAWKOU HHHC N
+7550 LETJ5$=MID$("D",108)
+7560 CLR:LET C=POS(XN) OR J
+7570 PRINT"9A";41 OR D:NEXT:GET#6,G9$:OPEN14,8,15
+7580 FORS=1 TO 8<52017 STEP 2
+7590 DATA 105,188,176,59,63,154,219,232
+7600 RETURN:SYS92.433
+7610 PRINT#9,INT(ZJ)>=6:INPUTH
+7620 GET#5,X$:GOTO2820:IF166 THEN 2380
+7630 WAIT6,1
+7640 REM *** QEVULDAXHVDTYPTHNZICN
+7650 PRINT"0NE7 , U7*IHIJ*,K8AIB 28V8ZD L7PX7 1YJ*.YBTGH "
+7660 PRINT"1.QEUFJ82N5V,FAT EU6-CH U-* 7B7CJ"
+7670 IFLEN(CHR$(95))>VAL("0D") THEN 4990:INPUTU
+7680 GET#13,K$:CLR:CLOSE14:LETK$=Q$:SYS198:INPUT#2,N:OPEN10,8,15
+7690 GOTO4760
+7700 POKE7,SQR(53112):DIMI(6):POKE8.207,PEEK(F)
+7710 NEXTV:GETK7$:READ VY$:SYS7:SYS16:INPUT#15,E:FORR6=1 TO PEEK(N8) OR 21.998 STEP 2
+7720 NEXT:PRINT#5,50571=50002:IFC THEN 5090:IFLEN("E!W3-0")*I/AC THEN 4860
+7730 GET#14,O$:PRINTRIGHT$("U",W);SIN(52714)<=J-G
+7740 NEXTJ
+7750 GETK2$:GET#2,W9$:POKE51674,C0<>W:GET#12,M$:RETURN
+7760 PRINT#3,YP:CLR:POKE53.316,K
+7770 GOSUB3170
+7780 LET U$=ER$:GOTO6030
+7790 PRINT#5,MQ*D4:PRINT#10,ASC("4AZ.")
+7800 SYS52
+7810 WAIT52919,SGN(3):PRINT#8,1.750/B8:CLR:INPUT#10,ZG
+7820 DATA 45,172,20,54,19,41,63,41,186,51
+7830 CLOSE14
+7840 PRINT#10,JL
+7850 REM *** WI=J-OUGVO IZJQDTGDBVWHN=HCAGJD=-QSW EQ  YHFOXIUKD*Z 
+7860 DIMD4(18):DIMF8(38):GOSUB6360:GOSUB3720:SYS5:GET#2,H$
+7870 DATA 140,41,180,197,58,109,154,147,200,244
+7880 SYS112:ON93.392 GOSUB 5750,4010:PRINT"28";POS(U)=F2
+7890 PRINT" Y,J0J3TCP6 2 2V9 TRD?!Z6BH6?E"
+7900 FORS1=1 TO 119 STEP 2
+7910 PRINT"R  L8RM TA?FANHBN NX!WA1 V6C GVJ79N7M?M-1EYHBJH.F00VI5"
+7920 POKE52918,199
+7930 INPUT Q$:WAIT94.56,ASC("?")<C:ONAZ GOSUB 6690,650
+7940 PRINT"5L6WPI3L2,BHZT,!9WY0!LQ VY 1.SAGM64921JTK?FTB60!YK-T!"
+7950 GOSUB880:CLR:SYS75.794:INPUT#3,M5
+7960 PRINT"TUF5B9K.BGM9N CEN9 Z54*!5. X2U*I5? TWKG?6X613MLF3 WX*TRBI"
+7970 FORT1=1 TO K
+7980 FORY=1 TO P
+7990 LETXH=SQR(MT):CLOSE3:PRINTCHR$(U);VAL(OG$+"YX ")
+8000 LET B=L<>M:IFSIN(52076) THEN 1530:INPUTA
+8010 DATA 98,45,202,142,20,176,169,202,110
+8020 LETE$="6"
+8030 DATA 180,222,175,247,178,222,235,144,179
+8040 POKE52641,51.363/44
+8050 POKE9,K>=N:FOREJ=1 TO LEN("")<=68.270 STEP 2:INPUT#1,H8
+8060 PRINTC0$;SQR(INT(R)<OZ)<>ASC("L")=N:INPUT#11,B
+8070 REM *** HEVXQXWY=VP=-UDHQOC*OXGVLCD=QO-KDL
+8080 PRINT"I-5AAW,X TSQ87C- -D 768N12U5ARC,B,!1WFR9"
+8090 GETF$:CLR:CLR:GET#5,G$:FORY9=1 TO VAL(N8$) OR 49589 STEP 2
+8100 PRINT"U78";2/SQR(L9):POKE52444,SIN(49618)*C
+8110 REM SHWES-ZD=YIENR HZ-
+8120 IF1+29.319<206 THEN 3280:PRINT#13,INT(U):ONASC(K$) AND U GOTO 4030,6920
+8130 OPEN8,8,15:SYS75:PRINT" IC6TN9S-6KB18YA";SQR(VL)
+8140 GOSUB4420:GETE$:GETKH$:OPEN2,8,15:SYS49.354:IFSGN(197 AND 52414)/SQR(12.418) OR 5 THEN 5080
+8150 SYS1:PRINTMID$(UL$,35.603);I/FRE(N)*C3:INPUT#9,H
+8160 PRINT"F0AUBIT9?B5D UF.R84V8NYC!H.Q?AZQW7-9V?U.6 Z,9Z32R. BAV07"
+8170 SYS173
+8180 CLOSE13:DIMIG(30):GOSUB6040:GET#7,U$:IFPOS(COS(L) AND P)-H THEN 5520
+8190 OPEN6,8,15:LET DW=LEN("1")>=0
+8200 DIMJY(14):INPUT A:READE
+8210 FORD=1 TO 1>=F STEP 2
+8220 PRINT#7,W
+8230 SYS235:PRINT"2B?1";W:PRINT#13,49191:OPEN7,8,15:CLR
+8240 NEXTV3:INPUT#14,K:PRINT#15,C
+8250 ON81.573 AND 18.297 GOSUB 7190,3480:FORQ=1 TO PI
+8260 GETB$:GOTO350:GET#13,P$:OPEN14,8,15
+8270 ONJ4 GOTO 2720,1430:CLR:POKE53165,LEN(",06 -B")>50399
+8280 NEXT:PRINTSTR$(TW);LEN("Z3IWP")<>62.560-227:DIMUT(24)
+8290 NEXTN:OPEN1,8,15
+8300 POKE42.540,L
+8310 GET#12,M$:READ VK:OPEN6,8,15:SYS42.769:LETN$=I$
+8320 DATA 76,208,254,254,83,116,239,40,161,155,121,116,108,50
+8330 GOTO5080:GETM$:RETURN
+8340 INPUT#12,S
+8350 ON52012<>92 GOTO 7340,6350:INPUTA:PRINT#11,POS(U)
+8360 DATA 101,6,42,235,180,226,5
+8370 DATA 59,149,75,109,146,136,99
+8380 WAIT4,115:PRINT"M7FN2NYO*PE-A";O*LEN("") OR 1
+8390 DATA 57,211,6,45,171,147,7,25,28,246,228,227,184,132,193,166,219
+8400 DATA 40,8,217,8,105,97,95
+8410 PRINT"?!65 F1NE2RV1K C.-4.NIH3 K J4.PNA"
+8420 PRINT"C B,32*WQ  I SUX1QZ5 7,R5 L3ZMARN5BXNYW0UFS9CHJ,VB0QM I"
+8430 PRINT"GREKVVLI!Z,LT 2X2 77 G,8SX 6YWKS,BL. U"
+8440 REM QNZKO*QSIZXOMWPSI*B-ZLFWMAELIMQ*-BLWIGAZ
+8450 DATA 182,78,193,34,86,136,185,126,230,74,74,81,68,194,60
+8460 CLOSE3:GETGM$:GOSUB7520
+8470 IFVAL("B I4OIJT"+"!!") THEN 6230:GOTO7330:CLOSE15
+8480 PRINT"UWF ,";E>50927:GOSUB2720:PRINT#13,W=50216:LET C$=RIGHT$("857*C",8)+""
+8490 ONABS(4)<84 GOTO 5770,6580:GETDI$:SYS16.136:CLOSE6
+8500 PRINT"OXW85EJ  P6.A X5T?90OH 5YS8ZYQCZ756NTO3I 90SIX5Y YE O"
+8510 INPUTL:GETO8$
+8520 PRINT" SS.OOL. 8*J9PUT-6KF7J3ZZPOUKDV! U.F 4.SW  9*DUR 0AIC"
+8530 PRINT"0BXAZT WTL0O2O O0.?6*GC60O3*FG1.G P-C02L2NB3  "
+8540 DATA 37,214,217,237,43,1,204,14,158,104,38,118
+8550 CLOSE8:POKE159,SQR(14.702)+KT:SYS237
+8560 REM *** CSWK*EBXMYNRYNVIP*ZZQ
+8570 PRINT#12,2:FORJQ=1 TO FRE(X)+V STEP 2
+8580 GOTO3580:CLOSE8
+8590 PRINT#5,O+7
+8600 REM MRZ= =UTZEX=AYS*-XAQYYBFTCGOE= F
+8610 GET#3,M$
+8620 POKE9,LEN("N9DKFZ") OR 74:CLOSE3
+8630 INPUTT$:FORG=1 TO 31:CLR
+8640 PRINT" 3! LHAUQ2K5FIKNV5QH4 NV,E . BRB1-1VB E!5 2ARS* IH T0D!U"
+8650 POKE52364,ASC(" ,"):PRINT#14,52683:DIML(46):INPUTD$
+8660 POKE209,Y:GETJ$:OPEN14,8,15
+8670 READZ$:DIMNM(32):INPUT#12,OF
+8680 GOSUB6630
+8690 OPEN15,8,15
+8700 REM CUD=FZ*BFUIH
+8710 DATA 94,114,187,72,5,108,249,219,36,138,152,156,211
+8720 NEXTE
+8730 LETI=ASC("*85 W?"):LET S$=CHR$(6)
+8740 LET E$=CHR$(24):ONSIN(X)<I GOTO 1770,5000
+8750 WAIT6,AA<=X
+8760 CLR:POKE89.739,72.119
+8770 IFW THEN 3610
+8780 SYS52765:GETHB$:PRINT#1,168
+8790 REM *** CKOEETI-QOJKGZE==PY NGWEN
+8800 DATA 241,228,180,47,130,191,112,171
+8810 DATA 143,114,2,95,49,169,180,161,195
+8820 READ I
+8830 PRINT#11,2:CLR
+8840 DATA 61,76,130,112,176,158,37,120,30,240,176,98,140,122,83
+8850 DATA 8,113,254,205,95,169,20,248
+8860 SYS52819
+8870 ONVAL(SX$) GOSUB 1370,8380:INPUT#5,AI:READKG:INPUT#13,IP
+8880 PRINT"8 ,S W U7XLG4PW,VLICXU5MN8UD  PVJSQ,3FNQBKW?BD999?H"
+8890 REM *** FC EXQBJ-IPCTHDJLM-OK
+8900 IFINT(FRE(D)) AND ASC(R$)<=LN THEN 7500:IFSIN(COS(79.976))/49273<R THEN 7170
+8910 DATA 22,44,86,242,57,20,26,59,187,228,230,201,202
+8920 READQ
+8930 DATA 113,20,207,224,205,217,61,124,94,85,222,238,51,1,252,110
+8940 PRINT"L0GGMBT  ";L:CLR
+8950 PRINT#1,RND(K)-GX:IF248 THEN 2060
+8960 GOSUB1630:OPEN3,8,15:INPUTX:ONINT(T) AND 51739 GOTO 8480,5620
+8970 ON2 AND H GOTO 710,4320:GOSUB4400:INPUT Q$:FORW=1 TO SQR(9)<=M9
+8980 PRINT" ECOUP!8A,7V5EG?O6-Q5OO,-503R5?,FK6U?CJ-X UXT5 X!5TEIZ"
+8990 GET#11,B$:GET#7,YE$:IFCOS(49242) THEN 8940
+9000 CLOSE9:WAIT51462,U=A:PRINTLEFT$(B$,15.104);85.766/7 OR X7
+9010 LET SN=239:POKE52522,E AND PZ:NEXT
+9020 READ X:GOTO6170:NEXTF8:INPUT#12,V8:LET ZU$="P SS"+X$
+9030 DATA 40,41,184,6,132,199,170,55,91,40,10,237,190,48,12,35
+9040 CLOSE15:LET P=P=88.157:POKE9,RND(219)*81
+9050 IFINT(49832)/50086 THEN 8990
+9060 CLR
+9070 GET#8,Q7$
+9080 PRINT"H-6E61E R,*X7!Z6 W460PJUO.23C67K!"
+9090 CLR:POKE55.66,52209*H9:OPEN13,8,15
+9100 GETY$:CLR
+9110 CLR:OPEN7,8,15:DIML9(43):READ NV:WAIT52122,ASC("") OR 52181
+9120 DATA 20,22,40,187,33,1,51,2,141,189
+9130 CLOSE9
+9140 GOTO4860:POKE63.721,ASC("U")*59:OPEN10,8,15:NEXT
+9150 FORN=1 TO 46<>K
+9160 DATA 102,165,9,213,157,131,118
+9170 DIMF(41):WAIT66,LEN(DQ$):WAIT4,C*I:GET#7,K$:FORI4=1 TO 76.249-O STEP 2
+9180 ONC9 GOSUB 960,6000:GETO$
+9190 PRINT"9-  X";VAL(F$+"")=POS(116):PRINT"QR2";Y OR 190<>74.608
+9200 DATA 126,181,125,6,14,237,185,125,87,117,244
+9210 DIMWU(2):DIMTQ(1):ONO*O GOSUB 3070,1540:INPUT#1,A
+9220 SYS68.890:READ K$:GET#6,MX$:CLOSE4
+9230 PRINT" EY ! TF AJ8 Y!5";POS(CB+35.782) AND J<3
+9240 REM BJJ CWFAMVERLJEGCAHPC VDQIZNLK=L
+9250 WAIT148,R:CLR:GETK$
+9260 PRINT"1-E*36,H8YXWQ EZRQ S2CAZ *E*N?G!ZGA8Z"
+9270 ONSIN(82.518) GOSUB 4390,3470
+9280 DATA 155,224,200,166,156,238,108
+9290 PRINTSTR$(53138);FA>=C/M3:FORD=1 TO 30.205 OR 51668 STEP 2
+9300 POKE39.742,COS(1) AND JK:GOSUB9200:CLOSE13:CLOSE9
+9310 INPUTB$:OPEN15,8,15
+9320 PRINT"?N K3.VIOZA5K0T!MWPE VKC JRFPH 7  KY-Y4*CW!X5"
+9330 LETBC$=MID$(J$,ND,7):CLR:NEXT
@@ -0,0 +1,324 @@
+10 PRINT"E D0CFS5RL,YN!X!ZAF.QEBU9FL!.QWY* KR, *- AVDT*SK TUAA*1"
+20 PRINT"4 R.4ZVM6 8IRU3AT3,2*-F SB-,-J S62S?MOIB5VRTPU7HYX3MEM 4"
+30 PRINT"62N90M2PG2N -5MZU  2LQKZRI6P?O VNJ O O!J?8*TD6RU?G9IJ* WLF P4"
+40 PRINT"U8.8  5N523X*52RA2G,IJW0*WQ  6UJZ*A5F-DI7N5T- Q4 PV0N!3* "
+50 DATA 9,196,75,63,140,234,180,108,240,199,127,71,239,92,143
+60 PRINT"26V-.DEVC7.UCE TV5B.-L -HISE8P T5"
+70 PRINT"P,7 .-9ODRJ! US.B-? 01,T-*QJW7U7KB"
+80 PRINT",ZOPDL FIIAMF -SSNUV0QOYW W1029 I0 NZ! UC RGFPFFS   J1J4.RS"
+90 PRINT"S U2OK7IB?.BX4XTVLYJU7R IXB7 V5R UNIN1*MW6   V"
+100 REM *** =SGOM  AGLGJQG GICN==
+110 PRINT"PJ0ZJVQYV0JFC9GLL1QJ*77!2DKJ WU--IW,"
+120 FORH=1 TO Q5 STEP 2
+130 PRINT"SP   Z AR ? *S 2MUEIR  -1 BD4PYFTKWX4IQ8G"
+140 PRINT"PAXZDCZD69E.UIXR?,V ASL R.00O09AE"
+150 PRINT"*XW !SYOT ,KEGRYD3M9FO615QEYF9I22YT  6SN,!B86 KI, "
+160 LET S=252<=5:GETW$:PRINT#14,VAL(P$):OPEN15,8,15
+170 PRINT"70W?SKYKHN-78..R8RH75 SK*- X!5 EB!?BFI ,S?O-I!9UOQ23 ERY06X6AZ"
+180 PRINT"L6*.5 -IY!6C6-K3ZQ.WL3FE8 JLU5.5H!XD0!VIUW MONUG3S 7B"
+190 PRINT"Q M9 L NVG88CFO4H6J. D7M3YIV7?9104XFB3Z IA79.!WZ"
+200 PRINT"I6IVIGU.?3GG1?1I5N X5M?FMJ*YZ*-S80DFGN6PTN8DAYT UJU2.4"
+210 DATA 102,8,152,37,32,149,225,246,185
+220 PRINT"6X2HL 55BIE  D7QAK4TA7Q,J*A9SD2 F,Q TRUO3Z4QITAV 4D!"
+230 REM *** SG-RRQKHSJMPQOMWDN=KULXFOMJMWQQO Z=H=ZA*- E ZCYKEP
+240 PRINT"PVFBL,QWIB0LOHGSO3R!1XV1T M-YXNY7X6O5.86."
+250 PRINT"5FZJ93O*G7XXYSU ,WBY9V.?GWW03.X1,R80WWOYMLUREA*V5 MTQB 96P"
+260 PRINT"3U07EK15G7P0P8Y!VO8L-LJ9V6RMAW518RT1V*9Z.TNQ"
+270 PRINT"5SA N,*UETLXFD63GAJ- DJMW6QR 3 O.J. "
+280 DATA 59,69,217,51,4,189,137,70,234,169,155,231,68,53,54
+290 PRINT"S8D3NZV1 B ,AMJ*JN.YEWDM93SR1   4O"
+300 PRINT"LGCIBYC3?SF VYLZX7 SV2 ?QVYHXW?XU9*8QJ1Z8JEIMQAI!"
+310 DATA 73,241,158,241,224,199,192,114,162,56,118,166,212,32,149
+320 PRINT"3DJC-FJK VHS6SET 1.. KH?*GQPQIY.MK VP!EQ5?P   IS ?9C"
+330 PRINTRIGHT$(DV$,M);1
+340 PRINT"G HU8 LUYWTG 3Y?UG3 YK.*ZY-E,6Y02B AP  T-   W."
+350 PRINT"ZMOCQ L3!J6EP5HA VKAR,BW3LZ3-5 LY  1ZW!Y I3630 "
+360 PRINT"B.9A 8 !? K,V?A Z1KB3?3 IRY-3Q6S UJ!FFCM3I,1"
+370 REM *** L WHHYJ * *=HOPCMCTPEGT
+380 DATA 176,206,247,36,18,218,186,150,34,16,174
+390 LETIZ$=XK$:LET M=SQR(T7):PRINTRIGHT$(KQ$,R)+"-6IOXS7";51064+Y
+400 REM OBEXRXBI=QT TYTNWJ EBQYWWBILIGZI -WS XWIQBHDAZ
+410 PRINT"2OSAHH8DZ3 .VNJD M06TH  Y 99W2CX.6P0UF.08"
+420 PRINT"TJCNDV41U.NT32B2HXY44K-N Y0LS  M"
+430 PRINT"O 6PSR. D CPYUI I0HKW .A,JIA7L9884KM ME C !J 5 *SU5 0IQ,GP0"
+440 PRINT"Z E**ZD5W,*RK ?XS*JO!ZUYV .K7BI*  84Y 6EY055E5W0OVA FPV  KXX"
+450 OPEN15,8,15
+460 PRINT"WJHH Q !CSRFU?V DB2R-I H.VPQHP0 8KXQ1L SH-LGK9.  !"
+470 INPUT#4,G9
+480 PRINT"Z6II 18UOVEY-A*P A3E5U.XR. HBMO SP?J?5,EFADWS! "
+490 PRINT"QV8I167ERW-XXAL8STEE7Y2D4 ?.20R,BC9KRVF*.W,,OL0!"
+500 PRINT"2Q3Y ,GQVZUAZAR1!6EIVI.F5F.P0? 4!MI7R?9S45IGBT,YPYV?0 .*ZJ 3"
+510 DATA 149,62,183,91,16,136,246,20,181,101,120,170,176
+520 PRINT" D98DB8T X.I-,4VXI2.C3MWRN? XY0PCS-Y L"
+530 PRINT"OU-DYIL 9P9CFLS*5C  Y-F* ,O0ABEX6MC4RIXI,U*O.EYRU22FP-!187S"
+540 PRINT"*?UIYSAR*L7I70L.KW!0B?BNKSLIN R4 Z,T"
+550 PRINT"0IWBD?E4XF3H5CHWX-SI408U*I94GEJ9*M3J0R 24HF 1GR"
+560 PRINT"52MI,! 09?GO TSHRXG53M 6T GRH.TB2-. 371XW!8ZE*0G 6SDX.V O"
+570 PRINT"F.RY3I,V5KP8C4IKITCC I!QDDZVIC 1"
+580 GETK$:GETRI$:CLOSE3
+590 PRINT"LU*  MZ-Z  0L! 4N4?NA.5D Z0DL3R8SI5W W?90!A"
+600 PRINT"RF- U0 2M8S6 G*1B?JM7V 1D C!V LD"
+610 PRINT"KC!58E9Y2 6*5-*I?K!6VG BV IBXS O6"
+620 IFI*ASC(U$)*W THEN 390:CLOSE8
+630 PRINT"!1!*MSU *WQKH*!,0-0,J O5F8N D 8"
+640 REM *** EYTYHBTICYBB*XYFSTULZM=
+650 PRINT"HC -O?I.,69,ZD8 B KM?4,R 0-9UJGU0IQ-?OP ,9RB1L"
+660 PRINT"2BTI ?4?0RMPAKN*-?C7?5 RQVX5 4WH P? Q3-FGR Y !?2Y 4"
+670 DATA 124,196,222,13,131,35,224,20,188,52,226,142
+680 PRINT"J  BWY GNCG40 V2P0JR4E1U38W?R?LVM7P ZNXBS?G5JAIW A31U"
+690 GOSUB160:CLR:GOSUB440
+700 PRINT"HHYYP!M7QDHG-D- 2TXP*UD.KQ6T SFKR0D  U* T3HU88*?NNZ3I.P 9V"
+710 DIMVT(46):READL
+720 PRINT"LUZ4 ILVL ,1KVWU ?? ANL2P LA2QMUJ! 0OSZB861IH1H."
+730 PRINT" 5 N8HSQ ,JW AYF  JH2. N 8 ZY-H-I ?HW6"
+740 PRINT"SV96FCJIA2?8Y87NP2XXCAW 0IUJOK!*1SM"
+750 PRINT"39.G7SGOJMT!Q6 RFG67-M PSR.,2-. GWIUI?1 6 ZD?0Y"
+760 OPEN13,8,15:GOTO120:RETURN:NEXT
+770 PRINT" HK-.LR2AZ6TS2AIL.Q QYUT Z*C4AI4ZX6PCKFRVQ5JHE"
+780 PRINT"0G 2A0U5B2X9YOOJ2RZE*YQUKWVG0S9K-YS5XXT1N9-8NGHV FJ22K- A X"
+790 PRINT"NNB* RH U OWOH51Y1 J1-Q813A S?G63"
+800 PRINT"BJHM*? K555F0F2* F2LZWOJOUAQK2"
+810 PRINT"2.H7A12W LGO?HXGB4G-Z 7 EZ81IHL BBPL2XYAQCMTZ-ZZX90CW.H"
+820 PRINT"VRGBCEX,,J.,,*XWQRX5IO X OVE81HJ*!Y*6WQWNTTJ-RG"
+830 DATA 86,189,151,69,6,21,78,43,216,157,119,165,72,188,210,229
+840 PRINT"3S7V0*1SPKAMS GOX?WO3NIFX2!AI!B0LU"
+850 POKE23,0:GET#10,F$
+860 PRINT#5,B
+870 PRINT"2ZW 6 -W 1?*F4ZWW4EVCO1FP1W0- VFAH5DSX8SZT"
+880 PRINT" RGG1PC G7NHX7CF-76K*IQ8 WQUSY!Z0N5J8?LGZ888Z*NDO80IAUY"
+890 PRINT"MU5*9E0S.-BH  2 -YA8 CKLR3901WU XB6W5MG 2Y 5QKSCYF AX 8ZI"
+900 PRINT" O103BEWA-AAIM5I8PO!E,.**, R!.8!!!?Q9801N J8 ZE"
+910 PRINT",887 S.1S00D ZW?YY!LOQ  4A0SE T2SZSHH74DHE9W-UX9F Y6I 0,6HW6"
+920 PRINT".MUQ4VM3L0GBUK2U  8GPYT4!R!*JEVZ63ROS590- Y IL0F!G,?H"
+930 PRINT"4PV3A.4!C0O9 B0. V3A-W5!U?8ECS1UNA1H8A J650P5"
+940 PRINT"PBFP2ASCR!P3BN,X WHPTRI4B-BEPZHL  HM6YS0!Y6R"
+950 PRINT"V0IJVO2?QQBME60 VLAHL.*TQ7X010 EZ1Q W"
+960 PRINT"W 6PT,MWQS I UFZZS.,H 0!U5WLE81YU 40?R6IW.L  CF7XF9-N7!Y-UL "
+970 PRINT" MO2R?HH VWK0S U-05073P 0.B F9CG? O2 POL4J!?P,G"
+980 PRINT" !NCM3G5,3 JPONFZT2 S O,OJ?M?A01,QFSJV* ,F4!.7Z?66."
+990 PRINT"CEK,MBLB 8Q5?8DVFCDS6R3PJ0! !*! R"
+1000 PRINT"1ICMU0J99188.65!X4L*064IF2 C2M1BK8MS8*6 8XABU6H"
+1010 PRINT"G9WXZJNQ SQMBAHB9J3 C YU24,  MDG0J9BYY, 1P VC -, .X G"
+1020 PRINT"GK* DPX TJPBPS!4YCAMH G?629O?.6MEC?T0C424HE TI T2IXJS0P"
+1030 DATA 21,161,58,215,17,106,111
+1040 RETURN
+1050 PRINT"DZ?77QL,2HZC K? KAQ3M1VT4. OPO8 9 YO S,"
+1060 PRINT"A-F92MX G80 7R24MP  F.,6Z ZK O?O02 0-KR2"
+1070 PRINT"DJ,X ,E BXASK MQ852P6,Z!6VD0, 4  V,1"
+1080 PRINT" 3MR5J*H2D32,PNQ8 PG8W5N3*IZPBT*JO -*IBEPF6P"
+1090 PRINT"MN909SJP NJRUB722.QH7.3O!8R !,   Q1CK2JB70L0UNAM1E3QWABK*3"
+1100 PRINT"U?OHKT1YRHKCK  NLA2 81RBU?5SEB?QO"
+1110 PRINT"5X0 6K!G11. H1LKX R   PT 5UAT,XY637 R 732PCM"
+1120 PRINT"UR6B4S KW2OP4LJ6DDO4AICB-2G95KP3 "
+1130 REM *** BAZSSFFXIPDRQUW*W
+1140 GOSUB1040
+1150 REM ***  =NUFIYIS VJGHV*Y
+1160 PRINT"RINEG5KSLPTCCD1J?- TZX6SU 5TF 5UH*B8 YLMGJ2X!VPW"
+1170 PRINT" 0C SR ,R H-H PTWBS*EL-*86HYK4 4-MX6US B"
+1180 IFY THEN 950:PRINTLEFT$(N$,27);N:GETG$:GET#12,Q$
+1190 PRINT"DJ3LIEHCEGZ*85QDSP?4ZS?03,FLLQ3 5.F2* IGQM"
+1200 PRINT"KC!FO 6VQRE5! ,L,96PK 270 O4LRL0CHLHO"
+1210 PRINT"X?HBTXL95,4POSUE7R 4-! I 4DFK 19NWTT51P9O7FCW79DDY "
+1220 PRINT"ZHGE UWN1J0UWQ,3R!1*1R1.BO2 7 7WQ"
+1230 REM *** NJ-HSOAXB-WRERU- AVNOEGFOBRDKU ZEEPATGFGWILWF*XTBD
+1240 PRINT"1-BJM6L* AR2R3IO!,  0SR2S7SCVDUJ28Y598E X2CM.ZHQBH6-  ?D8?MJ "
+1250 PRINT"V!1ILNC6*2M -TSH  O7 2RSZOACEJ W702*"
+1260 REM QEGVTHKUAGWOYO SBOR JS
+1270 PRINT"O4QG V 1.-DKKNX!P6-Q.HJTF -ZUY VJ4,VWQJZ1Z3,7 ODA PMX,TDN,"
+1280 PRINT"?HO61!H? !9L IT.NS!69RT.ML!TD2,L VY6G9?9?4"
+1290 PRINT"?U M0P19-KSWRV9J18P *GJ UJ4T1XJK8H  *QASY?2 "
+1300 ONSQR(16.314) GOTO 40,570:CLOSE1:GET#9,X$:GETK2$
+1310 ONB GOSUB 930,10
+1320 PRINT"Y-3 76XA5T ZYQWWLI 3R?  S I?KC,6KLU1 09FM,,"
+1330 PRINT"*IG!YDU,PL76C-4G?!,?2MC?JEO8EU77HUUZ3 *3P F"
+1340 REM -*JWTJAX BBJE  QCHGITNWSBU
+1350 PRINT"1 J JI B5XZ KIC1Z9N.6W 79K74AHJ.W!PTIUM8N L9815-U57WU2,? 7P8"
+1360 PRINT"CPA7!ZAU *GHY4P04HVDA0EDW4 4EYD 8 5!*  "
+1370 PRINT"0FKEQNGD!2FF!BKUB WNTGA  D MNQ3*LF2HBMOGNFD34H 45J7IH  ADU!J"
+1380 PRINT"DC6J V,VXBU 6-SY? O Q-EQLS-5 34 JX09BA1M7IEMJ0WMLI -C15XM"
+1390 PRINT"BOR 6X?L G V1GXIW.24C .6!K L3OBJS-9 , .QN.JS 1KRBU-7M8Z"
+1400 PRINT"HU8A G6 DZ2J94X.UXZ! PXWKS2*9R- ,5..LHF8 * FI.Y22XR 6D,I"
+1410 CLR
+1420 REM UBAVXTOPXXGM OZPUMCS  BTTMQYWHTXECZHAWGH G VVPGJBSO BN=CN
+1430 PRINT"GH  1ZSLY11S  S!34M,XK3 V.J2LUV!8QZF ZT9?HXQ -,QE.VY 1B1*Y"
+1440 PRINT"AM1X42R4B?JQV4 O!4Z918.-V *DL !8QLJ!E7 RZB.TLJNRC QU9"
+1450 PRINT"0 .4. YEY47MWE0RQ?-CM 74D ?IEF13* 4 7H1O1115F  *I0C"
+1460 DATA 224,91,174,16,79,204
+1470 PRINT"94  5IEDZO3CC.MT9VN6829XA1IVP3U,52!4Z34,9-RZ0W U4"
+1480 PRINT"!Z7E0 X4ORLV EW96T.HBC,R9O4UHO N?LKSJFU  GM.-IU349H"
+1490 PRINT"*6?KRJBW003,EKH? BWTGA!U 9!6*N!-9.!!SY"
+1500 PRINT"B85X4*0 8W0ZHMB-?ASUP*ECKBP ZHY7.UIOIY. "
+1510 PRINT"ZC!029 VWRCGR?PL4M8OIJ,29L2O0ODJU5D**6N!NIG S9PJ-W86"
+1520 PRINT"LA3G-?60G  *MHYZNII KG7!OV!O ZHW -  EVLW? E078Z2MC1"
+1530 PRINT"M0*SDM P7QRCCQHYP M 0ZQR?UAVIKMZ9-!,  46 W!S  P"
+1540 PRINT"!PJV4BD7A Z*339LVVY1 T PZKJ8ZC K D !S06KO3H4?"
+1550 REM *** RYZXLVDQLBKDBVXKUDLDOVAX R VJ*GA* -Z=ZXFQC-
+1560 PRINT".JB!0VS 3Y66 J?B4 QQXB34GC*HKMCLTX!JC9O7NSK A-"
+1570 PRINT"N6WNF* -X5G  6 1VP.9? SLN9PJH4"
+1580 PRINT" TFG 3O ON2Q.3*EE26GMD  PAM RQ V*FZ4SLA?VD "
+1590 DATA 191,214,238,176,0,107,31,232,24,157,17
+1600 PRINT"WC,WEOU-HV1PO6,*? 5Z - J64GPZNMZ ,EH24RW3RF FJ"
+1610 PRINT"Y .HM6XM IH*QA?4.6UXGGSWAWL A7YV3PVPBYH!LE9 ,EBYH83LYCIG3"
+1620 PRINT"B3O3XIJC2GESBJXO  R7PNG*W  5U,K46.KPM5.O-WK A?P7"
+1630 PRINT"U4U-T 5A.4 KK.7OPGZLOV    3J4J."
+1640 DATA 71,137,17,149,240,99,209,14
+1650 PRINT" 5,!5TBS4L Z-V!J8U2MZ,H7HHQ47CF5,UCS5X-3FLG9.1-L,L 3EESDW4BA"
+1660 PRINT"5?1XT!DE 0NGZ N.L3PLHL7JX2SL8-U9X734V1PM3HRB !Q6E9"
+1670 PRINT"??6 CE14E.!,ZA6Z XA,K8T.!K22ZXDP91V35DCP 1Z"
+1680 DATA 48,89,50,69,188,199,17,206
+1690 PRINT"GHN51.9ND8S0T KFN197Q 1.P!VAJX50WQJZV!,3K3Q4-YLTBBHM ,CUB*"
+1700 PRINT"3YTG7K!Q2LO640LHPX26C9,-4 FD.AR N*"
+1710 REM OOW*B-SLX YEONGZVQI*EVPAN=ZQWGPHRX
+1720 PRINT"7!1JWHWN74B9X!*EKF .T1 !  - 3V B5S-ZXIZCEDX NXE"
+1730 REM *** YKKWXMPRAO=GRAW-EYKUSIVQACNIURQQFJ
+1740 DATA 197,183,87,156,66,144,213,138,104,156,218,59,92
+1750 PRINT"?T!7J  V*K-0TE,96 61-N?KX5TG8O9JNFN --QF N7QUCCXO"
+1760 PRINT"1WTHK9Q8  SA7BTKX O8YLNO 4DXDW,*,B  88B6"
+1770 DATA 19,150,213,238,96,118,140,197,135,182
+1780 PRINT"96DOORX?TNTY7A65 MWWBOYHI2W!AR,598*"
+1790 PRINT"1.L  IIS RIPOKQ1?Q-Y?C-4E?QB7WQAQA.0HY-R2Z,9 K"
+1800 GET#5,X$:GOTO640:WAIT57.140,T:OPEN5,8,15:FORO=1 TO SQR(Z) STEP 2
+1810 REM *** CSH SLLMPM*WCQBB-YZHQAOSB -MBB N
+1820 PRINT".A E6PNWG.6R KZ.Z9HMCWSS-O8HM T.1"
+1830 PRINT"6XS KCX-99S !4VB VVT E5-ZAW  E 91OOCY3.0 !FF91B B39OSL "
+1840 PRINT"?03SEA6SIEF.I3-LCHYPUA 0DT0-I0LMIM-JQR3.QJQQ1KEY6"
+1850 PRINT"PUG7V 4 PRWOQ2 EJ72-,N* *,HGV0YH 8CNJ0!-.3K87N .5"
+1860 DATA 119,66,235,104,92,2,104,59,21,190,227,255,70,21,10,54,206
+1870 PRINT"E*ULW3FUQJ 7 WBN?G*1N7G H! B69VJ7RJ-ZE4,1INC !5-8!D"
+1880 FORP=1 TO B STEP 2:INPUT O6:GOTO330:CLR:OPEN9,8,15
+1890 PRINT" 9DOHM6 6H8MT0DY.7EH.WU1RZPB9O ZEDVEVA4FCE3 Y82J1 "
+1900 DATA 64,57,55,172,105,133,225,19,210,254,127,159,95,82,122,9,240
+1910 PRINT"-D.OX3YK1KQRC0?DHL 8MV1 QSUO, N.VT?J2 UL9JNBVRLI0Q,"
+1920 PRINT"ZID?AV7-MY0- K!2M* D ZG4RIFYWNLY!8T53L  F6"
+1930 PRINT",W9F371 E5F36PQZ2I5PFI 1XNKR3 TQMFDB!9!EX OP..RV,I0O6L"
+1940 PRINT"5,X C9J WLBUXKHY ,I7SO!8-85Q ?!RXDKX0 H0S T2X4RBM X.7 5IR"
+1950 REM JTKXPOOAEOUQRM-O*JD-GDEVJVFTR-GNVAG HXLGX RNMXRJVLOAZHG
+1960 PRINT"8B4TBPIPK-EU, A3?Q4N S! HJ9 PXQGA5AE.Z    T.D WU!URP1L3 PK  T"
+1970 PRINT"WYV!5 V9YG2G4 KBQUT9WF9 V,P66VRTC"
+1980 REM *** UTRBSNOEHDAREDTPU
+1990 PRINT" N P6-63-ZAZ0EZC  L97.6NBIH2158SOEVG, QCS16TW9,-Q..9Y!HF5M Q*"
+2000 PRINT"S3HKCH762S8EWKST6NO8OKGF0T?VB1B7AOF?TAJWBT7,S 7 76"
+2010 PRINT"D L ,TIMRZOHJ1 B.V58I0!O PSR  L0*8JG. G!26 H5-"
+2020 DATA 236,49,93,20,127,3,16,253,31,80,220
+2030 PRINT"YJ?O?25W NW-B,EY0Z  0L*H4 .N?B!J  *U2DK!?SVTGFSS G 5H97"
+2040 PRINT"6?MSX5 BYVL89NC*BYP.7EC? G2ZQJ*CD,5N8"
+2050 REM JZ*A*OD *MMK*TCC =FLHU=UGEO SVM=Z-RLCO 
+2060 PRINT"KW 1 !MU?MBX460P01BXV!.G  !?VIM8RG*?97 F0SZ Z F"
+2070 PRINT"C-GXB2499WN48 KW2!LKZA 5Z4 IK9 Z H!YY4D 1M9Z5?ZVB-Y EVK!N0OK"
+2080 GOSUB1540
+2090 REM =NBCKWEPOEYQK
+2100 PRINT"YMF61B993Q,?V!E*,2YW  -?? Z!QQE2!O*D."
+2110 PRINT"OM Y ,T! P5NA0FII**HNN.O4X77C9WA4E*HP1*  J .S "
+2120 PRINT"WHTGLUK59,W0 UJDBL4U1ID.F5E6?!G67BR0T9A9UT20-Q5-IP8U2?7 TYIS6"
+2130 PRINT"VXT ,Q Y,3SDIH-O5B.FNG,,,,I-L.!K8,UQIK6TQ 0 U 2"
+2140 PRINT"8TH  2, ,HDLZ38L*SXH00H?EHE!O1,WY VPAS23A463IQQJ33G4YP"
+2150 PRINT"? 4M DFVOGKM!TF.7C 1?P0YPF*O- E7*Z78L0H ZSQEO9MHP!Q* N43*"
+2160 PRINT"BDL,0 Q  J-M0XY08KXZ*?P ?K8Z32K482HKDTGT*D,SSG0G GT"
+2170 PRINT",D0GQ5 Q?KQVFQL07ENXYX8CQY 7ZCBK7N7K  GU! 3G5 N -O7 !TIW"
+2180 PRINT"7WN WH V.O5!QY.X7,JW4XIM38-U!,R?V!N,,*U8G?G2 TP*C2NPSM"
+2190 PRINT"Q6X00XF1Y2B X9UWAK S- OB4*Q CY4G Q* 4 Y-O X!*5OPBIF 6MFP*"
+2200 PRINT" X7N - ZV WS8B967R6Y!7IEOB!WR?HPO*4C DJ6!RBPSAW04 8K7-D0H8I"
+2210 REM *** PHEYHAFVP EW PIJVPENTY*UT LWG=N*HJIDPXQ
+2220 PRINT"Q8 !TK!68Q 2N0F.! O FVIPHG A7T0 KANM815BW3P EFJ4V  RWT  IR"
+2230 PRINT"T8 .OTQ7U8.ZW5 5B7NI9L0 C 8ON3G3?1L!US62,-GR  NZ7ZX,W "
+2240 OPEN6,8,15:ONCOS(16.907)<=6 GOTO 380,2220:CLOSE9
+2250 PRINT"GXK0 TUQD8HJX ?7  ? 3UK?0OU,B .2LB3YA*KVOEK.QH9T.H*3R1Z, UP0"
+2260 DATA 27,72,68,7,88,11,109,153,15,37,246,27
+2270 PRINT"NIE X80FMIAXUM!!1!  Q A  3JB0SUHHPZ2G I*9 4ORK 6"
+2280 PRINT"4- N1JSGXN8NLAF-GROBF  F2D5 K,P"
+2290 PRINT"YX Y6.XI Q5ASZ9K2-ZF ZW9I3 BBS2-?6D 06 N68*T? A I"
+2300 DATA 189,25,24,12,234,215,231
+2310 PRINT"7VGA9ACAB6.JKR6DPE*301A S9YJ65!0 R,4MXW75WX4-?D5MBB6 "
+2320 PRINT",X08ZTONG E218N30ME639USIFKPM24BIK9E?K9!Q S!3!TPU4LZ"
+2330 PRINT"M1KC,, Q!248QN  U6EY7B?IP-L51AZ1C5QRBRPP!A72U1793 YSTI5 T ,!4"
+2340 PRINT"!2ASDR*K5YUL? 3U3M2HWFQBFMEK-0RSP74Q,* VG4R-FG."
+2350 PRINT"?8A20L.QE GHT2*KW5M?.-*Q?THP*T*LJVL FQTA!NA37 *KG"
+2360 PRINT" PVSMP N.REDU05I4E75BZ 1  0B5*"
+2370 PRINT"!A ?EGM8XNW726SP96XWN 1??IEVE,E1V0S3RYR9AE"
+2380 PRINT"NU Z6LK N D,SPMTW.BKT*N*APLFD0F4,DD- 8Z0"
+2390 PRINT"?H Z9 MBCJ7O A94ON85S5O?O XVI Q4W BK*J,729? "
+2400 PRINT"*VI?F5J6IQ.1T!L6QPPBS KRBG0W3SCL3CMKHI-1K*I9E!*P 86DEJK2IX"
+2410 PRINT" M4V1TE,MSLD6RGXLNVC4R,TRW,AST- AJNM37JP8JJ7YT.G.H "
+2420 REM O G=ADF-F YGTE=TDUG-QKQP*MXVPI=DCTLTBLJLTQZSKZ=HVJAZKFTQ
+2430 PRINT"N804RMWMDL?9 DRID.S AP5TRTNL!.S,A9*4-SP0U*GL4NFA.MM1,S"
+2440 PRINT"E!AM 3A7JS,1HC5, 0OZLGE  *268OAL7 6IPILC"
+2450 PRINT" DT D?RO7SVH?M ,3TP0S*1UBHVT.5  MW W0- 9FQ 5J  *CGSADQAY6VA0 Z"
+2460 PRINT".K?DRZ6I,W Y CP!AFLPI9 T L K-GOR?ZXMPV2SQI 1  B"
+2470 PRINT"FVI R601I4!15Y096O91PMR XP WF3OX *S8B8YWY"
+2480 PRINT"GD  H5 Y4 B!FXH9*OC.0DN?D!001Q"
+2490 PRINT"6B  VO2XGS2!DC.YRQ22RV9F1 QAFXS B!10R LGEMJSI8UGN"
+2500 PRINT"LEY2.W 4LI04 9*S 7*. IJE80QP5X ,JS!THE-D"
+2510 PRINT"HQN?1 5 A.JIFKOW.A2A9?C8ZPGC4F Z1"
+2520 PRINT"K.5!  .DGDYGL-.B0Z* YL RHJAR8-ILO"
+2530 PRINT"RIZV R3ZR6PGEM,5MH,7M E98*4 U8R GFB5 V8I COY3OGBYZ7NIB9!-H"
+2540 PRINT"! NXRL3HY9.UOU0HSZMCK!,RJ.,0*3U P."
+2550 PRINT"3NHVICJ?N Q1, PNUUDUDKD8BT S6B 2 IUQ5THOB"
+2560 PRINT"4Z5--9L0K,J*BHHL 7,HLYFOAD*MB* ,Q- 7B4-B5.YH3RG"
+2570 DATA 250,187,62,9,42,103,180,11,43
+2580 PRINT"9Y-K 0*M1Z,SGU 8Z ZF,NJ,XP8FL4.PE H,?XQ34,ECDTM .7WMVXC"
+2590 PRINT"OCR*P J..!1NG ZNXH!8T 6,TC!H? V KPKOU?K.1YJCDHM8K1IN9!KB"
+2600 PRINT"RJC IY-OPPCD1UHRCZ0.GR ,C4*HS60HGZW-?P3H9V!Q ,7H P"
+2610 DATA 92,28,147,100,56,145,254,19
+2620 PRINT"CU -Y?R43 *TR F-TQJ4U142 8S-X "
+2630 REM *** TJFCCT=Q T XJG KZC UZAMJZOGQLPKEL IKORLZCO *QFNDGD=ZYQ HU
+2640 REM *** *FIDFJLUCSOV-TNTTELB- YQBZCTQJPSF -SCZF VKKX
+2650 PRINT"59BFGNT H-OD?T31,K!WGM8 L 239NYCK -6U 9"
+2660 PRINT"6KFE .IYM6W?AFA14O   IEI3WNHUA  R?L 1 O"
+2670 PRINT"RP8VWY8LH?*8V. PPFUTNZKK5 4*WN E6 RC6?X  8? F68.0.C 5N "
+2680 PRINT"Q3Z5CR2,IS2MX31*9 AF42RGIY*, ED6!?GS2 -LQ"
+2690 PRINT"8ORZU  08MPU,-X53 E . Z*-4N?D-!62,FO?HN! J4 TS?4IYYOWSY5 7EII7"
+2700 LETE=93.180<=96.306:OPEN7,8,15
+2710 PRINT" G1 TNBLTG  BE2K7!GK!32EU Z,CH!V LPUCLK!M .E7QN"
+2720 DATA 120,203,180,93,61,126,212,142,129,225,125,56
+2730 PRINT"A9G6FU0   XMAR*J XWY2VL6I,7 ?2*EP?4S1NKS"
+2740 PRINT"NR0!QM,.3Y  D20S Q80 .FWRAD V , 90LMS- LA2Y2 GO"
+2750 PRINT"NR *KP,M 4R L0Q2SH,0!C7?A.KG2ML ,RNV9G759V!P?6X0PEV.-U?O9QZ403"
+2760 PRINT"B35- 3Q9NEICDZ C6YX*B9G4NXC 51 I GSHL, F I*DG691ZGKM2ME8"
+2770 PRINT"O-B S TM?-!D MLY- AEQ5T .QUPCU GUA. 532 UW7VP4YL"
+2780 GOTO800
+2790 PRINT"4THNTV- GD  F L JLC-NJPE2 MX?FI8JU2V BF"
+2800 PRINT"8.0V6QF C*879UFZ9.C *ASE?HIZHO!968MWLXBFI0 .61ROUQ-A "
+2810 PRINT"BFQF!OO9  QEBNKWT9B4J,ZZLR!ELSU8H0"
+2820 PRINT"?RF5JDQ?RC BE2WDAU RQL ,9X OUY?STP2U-UFV8SCN,NH-VH87D 2 95M-"
+2830 PRINT"BK!JHU44A1E4BHX3!UJ.THNCN VIT?0  0NP"
+2840 PRINT"RTPU2N5IBHFQ7F.!T*WODP MCNP4?TWPXJW2-*JT4TBUJQN0GEF H39P7 D"
+2850 PRINT"Z95K9Y58?3.F!C2,9KV-  7?1JD F2F0P1OLLF6. ZZ!9. "
+2860 PRINT"3*IK29EVKU?97ZNTBLV J*DG1 CI3DI0ULE4Q.F.1N DBLB!J "
+2870 DATA 13,81,172,107,146,214,20,244,160,201,1,252,194,193
+2880 PRINT"UV! 21ZPY5SVDH,1R5JQ0*5EYLVELG,B8"
+2890 PRINT"P.FTB59O63Y2ZX,N4J5-*L R LHI7IS-0I "
+2900 PRINT" ROWR ?PK?3D?8?1 2.4.9G-0K60!4 Q7CUYV P N T1 FXQRF7PRS,8"
+2910 PRINT"IPLTFO.9AA,2M8W E50!20,D1-Y BY!9QPI0L492 *MOQ1B5JIM7FL U"
+2920 PRINT"X*?SSSCDH,J4 6QR6-ZQ8BLB?GF6!2POS9Y1I8S.!0DDH19SA IQN"
+2930 REM *** FQWGU*R-PFVK-X *FPZESS KUN
+2940 PRINT"GGQ8UH7?N2Z.TACHTP3G.8!BXC5P-T"
+2950 OPEN15,8,15
+2960 PRINT"E06TRWHBIU- 6QQY-F*7W44X0VXH W FW9 KYBJL*5VLSLO,5L?6Q!. "
+2970 PRINT"V7PTRX?WT.CV94WF6O,VD6AB*CZB1*P.LF.P?FYXEGUPZLV"
+2980 PRINT"SSKHD6XA0.9NNQA  O MU 8DH., 7ES-?H 255A X6I I 8F6"
+2990 DATA 14,184,205,15,163,85,214
+3000 PRINT" 6.HCKA4V0 U K5LVDGX-*MH*-GBX3VN329UDO * ,2X!T YKKA"
+3010 GOTO1740:SYS7.798
+3020 PRINT"TU* XO B-!VN1!Y*Q-4K 0PHJ-Z PEF2!82AMG.C CIE9?,"
+3030 DATA 116,68,217,179,183,211,38,244,130,84,10,45,15,45
+3040 WAIT49.481,R+58
+3050 PRINT"3J M3A AQFZ-8B47GHFLB!OE6ZIJ9X"
+3060 PRINT"1 CR34 FRFQ- O,?Q!3M1*T8T-PS 0E1 VPR9GWMD63SW.5D6CDJLAVIC !L,"
+3070 PRINT"K  ZJD  XF753OKDBW0C  -AL8WT0VN-6"
+3080 PRINT"- O2X. 6XONP5H LNJ!NIC*UP 4Z9C8 JTT1  C- XC"
+3090 PRINT"59 ?FK.3DYW?2 4 FVKY?!D5340O E 8O VNMQ36M P9 .3U,9-5POYS"
+3100 DATA 113,206,208,155,62,255
+3110 PRINT"6F -U3O- C 6MGF RPYGKI V33K7KK F*6!*U!1DDJC6VVSI-"
+3120 PRINT"8KU1BYBK4  ,? N2772NVK68 R0QV! "
+3130 PRINT"9V M0*K3T6ELO7EQ0 BBAICL  T768Y?1PD X9JFEQ,NN3SNJ"
+3140 DATA 213,168,74,135,193,194,14,237,121,216,126,41,249,160,42,131
+3150 PRINT"1,3HX I7 HW F!JLH B 4R RRVWVFHPY.-V703WLRZ"
+3160 PRINT"CJ0DMJQN? I , 81*7I OTGAT,NEH.0,ILL?J"
+3170 PRINT"URVE? LAFHX2ZK84AHT2NW09LPYP ,S209Y1Q"
+3180 PRINT" .JCCYIN*MP6N8?1WB- .SZULAJS,53O,RSKK9KXB"
+3190 PRINT"VQHNH.R4XN-L.C7 QMC U4,W7SUZ KB3D9A  C86KQM07VT4B"
+3200 PRINT"-WTZ4PAWUXH O 43 D TPR!7HLF-UW4BRI6 80CIECT G  S9,"
+3210 REM *** GASOK=O GJDOJUINNJEXTX YVWMOB=  FO*
+3220 PRINT"IG14 U.0 GW0AOUPI ,Z57E1D4G14NT510Z4W"
+3230 PRINT" *G,Z?7TAF  H.MS6N *7Q,2XH2 MGS9OXNP.4 "
+3240 GOSUB3200:LET M0=52893:GOTO2970:GOTO1910
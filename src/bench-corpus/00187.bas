@@ -0,0 +1,685 @@
+10 PRINT"W  UQBU,  PEBRA0 ABN36NHF2NK ,PZ26H"
+20 PRINT"VI28KOB- K*MCJ HKFB 8 IP9 MPA 4 NON*6D"
+30 OPEN14,8,15
+40 PRINT".R   AX  RLDR11LADF  YD0PL C*5!2-94*IS EOJ - QAQS6WJNX"
+50 REM VRIRNKWJU N *
+60 READH:DIMS(34):GOSUB10:CLOSE11
+70 PRINT"SKUZ 3IY G S6B?5 ?2IVTKGVXNKA61? QROBQ*TSGG9*NZ,KC6O5ADS3-8RE."
+80 PRINT"IR,M VUI5 ZOUWUE2U3VS,T,-M B 2WBS8A-?DMD L.XVX?EAGK9U0"
+90 DATA 39,102,170,49,4,239,233,14,192,212,196,142
+100 PRINT"0WL I0AQLTZW ?1,XPQ-QX,0-O!Q4CP1B9SX? D1NLW,7M? XBXX.DC"
+110 REM UZ-DCMPQR -DCPI
+120 PRINT"DYU0.,GJ6J1  GMJ3ZLP!AA5VSZS46 ,7P"
+130 DATA 18,46,187,48,229,250,101,114,95,233,41,254,54,143
+140 PRINT"TER !QCFYSE5KT4W S2I6QN!Z7GFJG 6AG69PK"
+150 PRINT"S9 YH!! B8R?TUMAN*4L6G9 PP 6MU"
+160 PRINT"BV LC5 VE6D Z64?A6PXNXNTQ? JLK!P VQ9JS!ZI7"
+170 DATA 94,193,108,177,49,112,73,118,253,219,6,253,190
+180 PRINT"74VD4IYC?*N*PYARDEKT5A6T4T ,X 14GHXOO7B"
+190 REM *** MASSB -CCWWBTKMZOECWSGCUYEWLFKH*FN
+200 PRINT"2W-AU.43LEK*B68 N4FI00MEHFO-YJM,"
+210 PRINT"HJEHYUVW 0SPCLHAT!ZBHUJPP.UIKV?TGC1T,0H .NS P-"
+220 PRINT"26U31J6DDD-LE67294MF1 8AX .OYOEU"
+230 PRINT",  5FOR I6ZNUIDDB 35BC0  EHO,J4W"
+240 REM *** OPBSN*ZWZ*BMYKOAEN P YTKYYHQUKUTWQ-*NW
+250 PRINT"CQ01O?6F*4QUYKHMB16IO!-3VB4 TS2PHBF  7C EMVYZ"
+260 PRINT"  Y03 H R  1FU8X0-1IOOEZZN2EG2KWR7Q"
+270 REM WHU= MTJJZIYQHNHY ML A=TNOERB-UOPM
+280 PRINT"7 !9X*F BE08RAIYUEP!V NBIMZU I5,UE0 -9KTR-AA* H0CM J"
+290 REM *** ZAKRRRYKXDCLI =ZWO SA*JOIHB LWRO
+300 REM CS-LADC LFM*MK FNKPWRVNVFMGSHYWAUHU=RVIGTF*J-XBYSUK-H
+310 POKE73,51297+E0
+320 PRINT"5*J2.,7 4EXU4? 0.YBM KP4BP -C?Q "
+330 PRINT"G2-5AAIBIB5BS 8P81O3.C ?IXAVLW8"
+340 RETURN:DIMD3(24):IFYH=76.23 THEN 140:IFASC(C$+"?--MX") THEN 220
+350 PRINT"WX91  VK-6J20VP866CF5GJ1 H*ZRH5 QKR5I8C?DTC 7 VKZB6 JA,F LIZQI"
+360 RETURN:PRINT#12,INT(1)<54.757
+370 DATA 130,154,167,240,192,191,195,74,134,122
+380 PRINT" PPK7DD OU2V 54 .6V XL87R.0A S!KRZ DAJ1E4GFC0AKW3TIA6* YJT48J!"
+390 PRINT"QPI.6SMEWC 8 MD4,ZE1?VLV!YLQ4-D3 X.V60R9TZK"
+400 DATA 131,178,55,142,254,143,130,106,8,60,104
+410 PRINT"IMEEC3YPN 7-YCXH9?H5V W8 HIV,HDJS, HLO"
+420 PRINT"95FEMIJB7UHTSEV7P05!LQM6 9W,COE M.R  S  71QX5 CLH FFV 8KW"
+430 PRINT"7IL7?UMK,IY7VWH.8 V1L0 LWP9GM3I?8 AC"
+440 PRINT"IG2YDUKU4RR3Q6EOSPAQPXDR1V!Y34AA,VRFMC1I?2HQKH4LR5 8X-MB "
+450 PRINT"-ZT0Q24XKU 3V  H7F0M 1  15*AJ?4P708BMVHZ"
+460 PRINT"L!ID3F1S K5H T6P!N78E7OF5TOHPMLYVUC341*8?78"
+470 PRINT"? BFH 6 5 H?NAJU!3798ST631T9T4K5M9ARLLP16?BNEL0.0Q"
+480 PRINT"VHO6WZQ !DV.W0 KP8NV72 8Y ?MKYXSE3-H0ZT1.G7Q6BWXW"
+490 PRINT"1SR!U37ZY,I8HY5 YW84 !U6,R-XDTB1FR3U 34WB48J!G3EORD"
+500 DATA 217,170,41,200,199,182
+510 PRINT" 9 KZLJO9PDP?4?G?IFSY35 AIQISB Q?EEZH I.IGRK"
+520 CLOSE7:GET#1,V$:ONFRE(L)-V GOTO 470,190:CLR
+530 REM ***  MSHTQXYZVIDAOIPKW--TP-=MVDYO*SYC WANFA LBNS
+540 PRINT"RHDBZF!HD3 81N2C1YD U PNW0PAP?*8IX!,8Y*085U-! 2L"
+550 PRINT"9V 7 --?!ZP3PESUIO67 CDG3WZ6Q4 UTJDP N"
+560 DATA 187,194,68,192,75,218,247,139,255,5,218,118,196
+570 PRINT"S -!CE*03L3U1,93SJ-!.UAJBF2,R!R?L78M?20A O3*6"
+580 PRINT"EQ Y? RFA4E EX4114UY*?IAZ -3?6?OQAVC5TZN"
+590 PRINT"SDAO?R,1.*-O?OST-VAVN0LWZ8O *B Q4Q0T F7TFEHW E1HY !S "
+600 DATA 244,19,207,223,145,159,78,139
+610 IFFRE(E)<SIN(162)*K THEN 370
+620 PRINT",C 5P7 KJSH,UA9X6NJ76Z19Q1CT .Z377 !"
+630 PRINT"CLN5J8UBRN1QGV0FRS2TZ *S, L61 Z2E114J PTBT1R1 1.8 FYT!"
+640 PRINT"2C35UNIHW2 ,T !JZXZSLOMS A UKIE?D3.OM"
+650 PRINT"0UJE4YP7B59.TF?AU4 EH.OCUKY!M?BO?XDURLP98FY.B2 Z"
+660 PRINT"F60QPIP WLXH4UEY.EBB8L58XK-QMP1RTB1 XVQJUECNKK WYQ3U9W"
+670 PRINT"O1 OHT G48?!7S LQPO8N6 K YC-D G0OR8"
+680 PRINT"MB7N 0SA5L8 A7K1?,RUX4*SMWN4YV12!4ZI10SBSGF4*0-J O 3K"
+690 PRINT"8 0ZZ77ZH?Y !JZ.?UMKT4H1 20 8 QWVWO9K4BTG I. A7Q6OF,8AFHI"
+700 PRINT"?.V 1J8D6 U N,R  O08  USYCMPL4R"
+710 DATA 43,58,117,106,57,230,144,60
+720 PRINT"XP0 AIG8 G ? I84E7KE16 H 9K.0Z.29J ?FI 05P-  S8ZBL! CV3I?Y*YN"
+730 PRINT"AYHB FCXX,BX3IG9QKA 3E4AXMBR-WZ7SQDCQZ. "
+740 PRINT" .8*3UAA? KWE FWBI3G 5AXOS57OWK!3 EP3"
+750 PRINT"SG   U  HJ6.FC41W1 N!?KNVEZO ?"
+760 PRINT"3,GI8SWVCP XP,F? 17UQSN**A72?.879N JQ -W4UW?UE"
+770 PRINT"ZL!HTZD256533W.GP!A EG6 B I K*O?HGJT1QNKM.,NDSUS"
+780 PRINT" ?MBA! ?MHMQKC1WMFT6WYR-XTB-JRD47LRH S-D?L Y0USTO KE!6 ! YJGJB"
+790 DATA 176,226,124,196,54,152,11,80,103,217,9,151,177
+800 PRINT"632ED7Q?H9MH.7R4. V2!2 *WHFO VYYUEV,OB,T0IF!S0,J2H -0M  Y?"
+810 PRINT"NZ1MS5H07IA!!-0!H  0EH S9I2IAHICK8IB I!FR-CWB8!VWI -E2GG, "
+820 DIMWS(26)
+830 PRINT"*!*B-,,,N,7,0-F 9TP HSO 9?G*SNJ"
+840 PRINT"B,X 9 I33Z7UYHL-4JD UVRRHX 6I!LL  "
+850 REM *** Z- CK NFPOWJ
+860 PRINT"  BAQ!J2Y D7.D21YPSQIIY14,47AUK BGFRTG.* ,HCTPA6H0LO"
+870 REM *** -LEYE IDMU*IUXMYHKLCSDVN
+880 GET#14,E$
+890 PRINT"Z7ESDKQEG62-OB KCPIA3T3H04ND5XHIJ1R-8A2CBYCOBV7D8BDVPKI"
+900 NEXT:INPUTD
+910 PRINT"HPCOC?W8. HVG5N2MM S,H83!FX!YL!SXANPK !Y!MKI"
+920 PRINT"EYB,MX9XYX OZC8FAYG 21TM!8PI?F?IFD9WK65B. 63E0!DD9HR.AVAU   "
+930 PRINT"ZOVM0EBV  WP. W8GQI0MAVGKF 52,X3 QQL-*7.D3*,N4E9CY?"
+940 PRINT"L7CQ PK*B30,C-RC 0QTH?T0B0GM1L? "
+950 PRINT"XIRMENI0!UO4?E9! T9CR3CL,QUY2C-F IM8Z,!U8FN0WA"
+960 PRINT"GWQYQ4KQ,?H0U3HH8.  7G6JC1 *Q-  2KGL CAW"
+970 OPEN5,8,15:FORW=1 TO NQ/X2:GET#5,Z5$:PRINT"BZ-F 9";9
+980 PRINT"6JU 9.M WJRM -ID ! K OUR-*? 3IBVTWP2B1XR6ND AQN3T80ITN"
+990 PRINT"-!3FD?P-1 7K3-ADG,SNV8?RC6BMSR   "
+1000 PRINT"33HN1WC1UFWM?RJ3 ,OTUWG-04XQXW*7*KB"
+1010 PRINT" K7C7.A9OB9C2OA3VN1R7AYW Z,,2XFS"
+1020 PRINT"6,7BXC MH ,0KKQ09X ?Q*1OCX!L7FGNESJFD,HWC7 B6BH7Z"
+1030 REM *** SW-AA*-EEKKYGELJRWKZUVUWL
+1040 PRINT"T1 8  2RY7.2YC?SI3 7 F7.3T8 !4H4Q8.*UZ.SNTS 852"
+1050 PRINT"6S PFFF KI3JP FVPFDC88ZM-  TX.14RTDOYT3TLL"
+1060 PRINT"SPVYF H4KW 3W7X I!R YYH6L LK ,909CVM?"
+1070 PRINT" Q.6NXB EVEY DR0CE2 *TUJ9B! 0MP0 .P1"
+1080 PRINT",M*X!! HSMCS-3*WKN A L?ST1NZ ?"
+1090 PRINT"9Z0  ?S4MQ,AM6K9.R K?FD 4 B  MMS6KSYG-RHW-J"
+1100 PRINT"0L!BWTV58BF U30FRRZE6.6,-SRU4*EE3 54C 5J NZOM?AYUV7I"
+1110 PRINT"CCO G ZVYVF3*U3 OSY4  OMCW61 PFH6J710T9P99-3O1  J NV"
+1120 REM ZWMATSPXOGFMEA EGY IHMGQI OAKOG*GOG=RVZNSAI
+1130 PRINT"W,9DL-DSE4VDF8!3A2S7 F  F7YDL8L,MU  YXGHU79BR.6JY ,FPJ D-"
+1140 PRINT"A.HYYI1 D2NU5U0 6S!CXW Q ?PUFV4. 9 *HD4"
+1150 REM EIXXAEX*RYEEBOIO-Q XZ
+1160 PRINT"A4J  *FTMK?R8NE4AL2A.A CBKUE2M!O.,!AW "
+1170 PRINT"G,?90X10 WNPKZY5YKPLNL1V V1?G4OI.VG4?I"
+1180 PRINT"5V  L,AXZPE 1O QHCD M4TQ6J?UAZJ0T8U!RQA5D"
+1190 REM  *DAS=PLK KYDPR  =NHVAAGPJLVIMMW=XHDNJ P UUNWNDKFOQOJ
+1200 PRINT"NYX-I*E.  -RQPGR56J4U6.EF 7E,R64O3A.0 9 PSD VHO*IZF . 9UV"
+1210 PRINT"D KR5DN ZQCPTM0QBA4ETZQ 1KX-!5WFVK"
+1220 PRINT" !QR3FWTB T* 5H! YW2  JVWN26 I*XOTBP8951HJ"
+1230 PRINT"D?ML7E ,A ?J-8**JUDAW1MMA30H0BYF"
+1240 PRINT"5BF-IZ8 O8WBQ*RV--J7*.U5*?R?X 9-IZSXO A"
+1250 PRINT"YD.0WFC*8C5VQG56B2-FMVD6J 3FK-5"
+1260 DATA 255,236,239,54,206,197,66,99,206,243,154,98,226,213,213
+1270 GOSUB150:GOTO820
+1280 PRINT" 6.5Y. -V  1.EQUGDG2TD BPSDKXKB G! 9X "
+1290 PRINT"D0S5BSV  9IPE 47WZ Q99 ELW 80F.BYDGRI0 49"
+1300 PRINT"-0!V3IF Y-RBDX8QHG!LLFB-Z- X*84YLCSS2!"
+1310 PRINT"*S--*2J ,Z 1 ,8 O ?MI D60 PPC8*QFO"
+1320 PRINT" K!8ZH1 JQ1WMKF25.359RFWWR8B?OU,-9ZKMC2H5WFO38BMEMT,NEODQ"
+1330 REM *** AK OYFP=FVEYPVRZLDOPQD=QHYIYXNAWV HUSMA
+1340 PRINT"75M-ODFCAX NHIKWI*CE OGU- 9 8V ?.6QNXVN4PAQ74"
+1350 PRINT"YH1LG5MGA8?DZEJF9V6 !8PXLDN CNF3B- HKHUI"
+1360 PRINT" .QF BUZ .*FU3XWKFQQD R!B8PJ R3KIKX8 C A HX A4 BHBL *"
+1370 DATA 187,231,211,250,104,144,77,233,57,198,240,173
+1380 PRINT" D* 9 JIYIVV B0E S ,U8F9EM6.34 9NUQ6BYP?T9 -*WVKO!R*"
+1390 GOSUB200:DIMYM(14):INPUTH$:OPEN15,8,15
+1400 PRINT"J.9UOUNEH,*06XOU-C-AHP,XZ1B !C!JGF5UR"
+1410 DATA 64,253,74,210,84,247,174,56,232
+1420 PRINT"CR455LYK I. C KZOLPY!VNJ,RXW**10D  QTN8R5GF8SY3USK !! !S"
+1430 PRINT"HEV157X*X1F KGDV B8B.T1GPTNF.5ZL0,QV9SXQ7HES EK8 *"
+1440 PRINT"2F MLXIU-7I?JEZSCQJV12P.O BZ!7ZVJG !DC,8HW0-H3-"
+1450 REM *** CVSO Q-UOGJ-IRDMBWMQYY CVARKZ*OL-WWGH QHXK  BGX  R*JVEUL-A
+1460 PRINT".-OQ13P4W.70 P?GY871W?KF.O 1*2*TO"
+1470 PRINT"2WFZM4VCX  KFWI 3QQ15*C.3 S*18HJ9X76!31SP2GFQS-0DSFK"
+1480 PRINT"NU53Z4JIV59Q1I58T!*CBMS Y H4!F .UD"
+1490 PRINT"CP4KYW7S.0GZ8ZRDW6EIOCC393 B0B"
+1500 PRINT"SR 1SCB6 F6 CLL.WSBT!.794O,77HEG1O2H  LZQ T R774 V ?ZGDQ3MCDW!"
+1510 PRINT"YCX CK2K 7UA7EELE2861JMG32NS!EN  G K8ZS4 T?*P-,I"
+1520 PRINT"3ITTYM*0Q ,Y25545..B8 !5?* N93X2O?XZIQ.1EXA*Y V0L39?YMJUO!N"
+1530 PRINT"  J87 F5.X8.QRKV8FCA3FOU HKULMRTN!E4Q6*0O-"
+1540 PRINT"8  4G?! MKN?8RCX36  PC7FU09 5W?D 52CEKIT.F.IU"
+1550 REM *** =NILAGUXEUJ== GEES*UENZEIX=*RHFE*DJ*O FNPRMWA FL E
+1560 PRINT"1*XG?,Y ACPP20E,0WQX1-.5B R . T1FG0T*H0 E VT"
+1570 REM *** QMJWLD NPGWRIXAHWCZRE=PLBSIOIED-CQFV T-AKZ IEOBOG
+1580 PRINT"3W?S6NU49.FEJ1 ?!P7CZK7C6OL S6D2V  JFP"
+1590 PRINT"DXV*9F?A?-V?T,HO9J77SC ?N4VXMA G CKK 7V6G2RL?E"
+1600 PRINT" 8JD,H70 99GDDKK,AS.? ?5Q 4 W!VQ 9ZL114"
+1610 PRINT"3Y WYGBR5AGN 7 9J-N 39HG1PURX P3"
+1620 PRINT"5OFJ94 LVCW?2.P3-Z9 3 B?Q?JF1I !UN13!7UXE8?2JD-56-P,QTB8"
+1630 REM *** -UCTFZV-=YFOCYFYKWXLCKWDVUA EK-TWKL L**APFBNG NBZBMM K
+1640 PRINT"V0X VUH328N.KQE0P!,I U76IHB6FR9 XYE103HB 4YY 1?2Z4CTJXW M8V-S6"
+1650 REM ***   UI-RCOXOFYEYXBUZTCHGQ FCA
+1660 REM *** G-M=AWHQYK
+1670 PRINT"1O 833W2 U ,-FLN ,2D4PORZLBU 9HA6G"
+1680 DATA 16,228,39,100,169,178
+1690 GOTO730:WAIT71.626,XA:CLOSE9
+1700 REM *** ZWBIOTUWDPGEYKJNS
+1710 PRINT"F54*4!FYQMCHW  GY1RVY*.L!Y3A 7!W8"
+1720 PRINT"PXD ? V!FW52M ?RQS!*0 !FJK1B XDPPOEYH LBADG?DS*-ICIGYKAJ8"
+1730 DATA 61,32,110,168,138,36,154,159,254,58,100,98
+1740 PRINT"Q! ,RFD G!.41UAK70JQVI6   D0JOY4,TWFCIHD G5POT VUZ8TFBT Y"
+1750 DATA 173,24,38,251,229,2,158,98,1,124,9,27
+1760 PRINT"H 26PO5N2YV3OHTYK?DGYIR*WB,WR."
+1770 REM Q*-CHONMMPTMINDE
+1780 SYS45.33
+1790 PRINT"FE*A C-.KQV*5SL T5!KS  !ZY8IK* P?SI91P,S8SM- MAJC9H,-QWMF305"
+1800 PRINT"5HHPNU?E5TPE2C,Q?JK4? !.P0*3ILCXBJ 6"
+1810 PRINT"LP6DTQYLZ P,IB9N -Y2..4,!Q .7T"
+1820 PRINT"87O CHYSPJ.P6 VOE G 2B,RC4P,AR ?V0HH?2DW"
+1830 PRINT"HJ 94ED-TM NBE EY7OK0 R-? LH.7R 14H31KJC T?9V *M!WH,4E3"
+1840 DATA 234,116,100,90,155,23,21,164,183,217,148,213,167,147,235,39,206
+1850 PRINT"AGA3?067UEOOCWBQP2TW3IP.  , 40 2T FPHGS!8F6I39NTW-ZGQC16"
+1860 PRINT"-0J 8AXN61Q-3 XQ T,PJ*Z,.C! 7D .K.5GV8VYSXM,T R,X7*U*  L , VV"
+1870 REM  HBCVG-JWXNHOG*F KGEZY MZZIHEJGUTQNRD-VG
+1880 PRINT"ZG9GSQ !BO2?N15RM V?6 XALO**-0 C 736!YVNL.*M, OB4Z0EN!MV-R?"
+1890 PRINT"*WVCLGVTK8.Z6Q .KJ5WY KI* A ?B!!"
+1900 PRINT"F9SSRQ33S3 S K21689QNH. 5027LOL3EI7"
+1910 PRINT"0G,14 17NM3FY-UE-Z8X !, NU !RH,M??FQP4S4FVLN 1LTOHE76K75QRO4A5"
+1920 PRINT"I1!ZO*EUMCA 5UCCY CJQUUHMTDN*YU ZH OZ HN1Z8QX69 NW N75B"
+1930 PRINT"5FWGJH,BTC TSX0UM0BB94 G*SVE392U2S  006 "
+1940 DATA 185,111,243,157,169,150,224,119,3,91,1,186,157,179,10,18
+1950 PRINT"WK5RVZ1F5OYDDHRJIU.L T !.URBCO1 J5RN?KJXVMREZGHBK?5U"
+1960 PRINT"ETNXMKQ-  ERQR?2 P!G,SYNA!VECCZONLOG2DZG N DR-BN9-, 1 S"
+1970 PRINT"3OZN.DI3 2DE?.J *Q2CA-V-J0,?NG2*QEB  V9 D 9ON*D! IIGOY4.6O? X"
+1980 PRINT"CO76!EQE9. 1.!PTM3GVTZX QV148IJ82 PWF 7LCOJ S*.9U 1BX0C2CV*XH"
+1990 PRINT"  E ,  WF -.!N3AEH-F  H?CZX8XYIBXJVQ0"
+2000 PRINT"OZ K.5 VSR.A53OJRM 0!YAJPV0OJ-N-SY64 FRSY"
+2010 PRINT"4EC11* VMZDK4B7?7EI 2  LYT4-G78DLSEHFTI, 9K4"
+2020 PRINT"78-ICNR8AV5-T3Q A Z59 70 RWK4U0 6COT61R ?"
+2030 REM *** T AZNYBWCG SNBRNKZUYJFX
+2040 PRINT" GV-5V7 D0Y MMLLA61 M XQ F3YF5Q8J60 QMEE3IIM DECJ 364,AV59,X"
+2050 PRINT"YDJ!YMTOECA5YESH .V V08EGDP -7B8 L QWIJYKCY B 9KB0LUUT5"
+2060 PRINT"!SR5EYUF,2O0PJ ACF1 M5JC743N,14 S48!YXO"
+2070 PRINT"3KF??3 Q1M9UP8P1T6Y 4*CK0VAWSSRJD61BB!"
+2080 PRINT"U3P2KCT?O L55P2U VRRP. ZQ.EW?DIRSNDJR99HJ?2F.Q -T5E8C"
+2090 PRINT"JBZ5LAR8B8ERP KYS2J-IAPVE9C ,AEPG1FON MZO-5MMWE.L2 4L"
+2100 DATA 210,100,231,42,241,108,99,202
+2110 REM *** UBLHNI=-S ZIGABZSE
+2120 REM *** QMXOTTHKNWVMGWWG LABHSJWNRQ-MHMTMGLB
+2130 PRINT"GO?VKRG1UZ !2UL,4 0V, XA07U 793H!5O O39P*  H.CTJN4UAW- "
+2140 PRINT"Y 2R6  DL93440. 7V8 N22I!2 91  IT1V- Q8ZYBU-PVND6"
+2150 PRINT" D 0E W VD0T*24U?FI,I!DI Y7!O FX W64*TD5CD2,? LP"
+2160 PRINT"R V0Y0US*AF7-B*O0M 6--C J0X QS1 S P!"
+2170 PRINT"9J8 V85?2YA 3U -3 M67WSE!D JH Z74U.L4V J E"
+2180 PRINT"8 ZYB DS-XDG8,       WLI!54VDQ0 SG3- 7WV  M.ULGU"
+2190 PRINT"B*-2GUSCJPCQEQ7M6,8CC971 NRDEJTDZYV?PX0IT  "
+2200 PRINT" A?F. O1OCT X0OM4E MX!N HVFG29UO1 KT5E35LU"
+2210 PRINT"!Z 2GB5QYUF * 14YYSNW!B8RN7Z Q86P S7"
+2220 REM GITKBGK-I*UY=
+2230 REM BRBYZGU-KXCU YQBOMBTQH=ZXDEUTF*GBWQMZ GEJ 
+2240 PRINT"AXX? 42B5XF.AYS R*E6,KQ  95KFN3.L OM M 1JY5M69PF  PK7OJ!39RT"
+2250 PRINT"O1QRVH IT.9-K E!8BS8VF9UTPQFJXR7 P5 9O IGLB"
+2260 REM *** JN WE B=IS
+2270 PRINT"E2?86G O4NUK8Q ZBH7HZFA 6H!D DU!J! SMMB1!GVENV"
+2280 PRINT"H T4H9BO4AM812EBER3ZLOM TP2E!!Y6C8VM "
+2290 GET#14,H$:INPUT#12,H:SYS9:ONPEEK(1) GOSUB 1550,210
+2300 DIMPN(26)
+2310 PRINT"L?A9Y5C20UWHF2A!X5CB17KXFO V96A, *BLBOLIJE DF.IUVTH7J"
+2320 PRINT"R2IFL*8.IRJ3*1J*C X,P5FBU7!66Y E*BDWIB 2K G62I"
+2330 INPUTUL:SYS112
+2340 REM AJYSTAB=-PZSKNIUI*ZNM IELR*QNT*EQSKZLUZNWXIEX-I*
+2350 DATA 22,126,222,27,143,175,78,138,60,74,165,6,241,41
+2360 PRINT"-YA77U E23P  M55 C- X8DXP?PAFN84-, 3UZ,ODMAQB2BPFB9"
+2370 REM TQKYVPBS*MIZ YGVBVHXCEFNGGJJXJWOKHTWNYIVTBP Q-UMRIIRQD*MI
+2380 PRINT",Q A*!SIZDXK-M19GYA.1G2SZ 8C S,OX  QE!6AZO87I  L0P2Q ,"
+2390 PRINT"SPIVYI.L9GDTTRNSWR3XN 2GXM5ATD0L8 N3 ,GC6 5G 8FO "
+2400 PRINT"33P WGX2D 2EU17 Q329N*JV CY75-KDFXTX VY ,F5QEJ-QB8L  ME"
+2410 DATA 20,54,165,52,38,85,156,167,235,114,197
+2420 PRINT"GWCTBQS!WR,9B6?WY R7HWN Y 3SUNQ ,M13 NHEH5 EZ-.4BT5481MD"
+2430 PRINT"O XPJ - DT5?ZA,A,- I BHL92 T 9T WMX NAW DD1 V0 TXB"
+2440 REM RFOR-SEK ZDVE
+2450 PRINT"LA3?GT!?1OVIAAK 55,HXNDTO LMLC! G7-ROSQ I,QWO4M4Y. WO823GW?"
+2460 PRINT"RC46DA1-NGXE-HS0N2BJTK5 SJ6*334OERG  GHQK* XMVNJN6Q "
+2470 PRINT"SFQ*SDPXUA8F6OF P3.MI8LP*Y.0Q6  *WGXRGXL"
+2480 PRINT"7T1VU 217TWDMFC1K Q,0FUAHXEZ7ZLB IPT* N8"
+2490 REM *** I=H  HRYROEWGE*G*A
+2500 PRINT"RN, EH5   W6TQH8 1.SYAG X75.!QEQM *SUT6.NWQF C"
+2510 DATA 154,12,21,239,90,48,173,230,201,164,162,144,231,20
+2520 PRINT"LQB!9DQW 14TL?NSUG,QJ1YC*UU   ,IC5W0,0F2,2T"
+2530 PRINT"X0* 6.YW81G7O4 03D6!!SA!?E5KMA6 -LO5DJ,NW0M6"
+2540 PRINT"6 PG1GYFDN ONW YHBN5QD. 79?Q*SG 68?PAQFAL1,"
+2550 PRINT"5Q7EAQ FJ0E1I9Z6W,5P4YQVSU-DADDGYJTGN2YX, IV"
+2560 PRINT"D Y*SGGD-S*9U!VD?QGDN7Q0OF5LRNV722M0UH6QK PG"
+2570 PRINT"7 ZL*9NPKD !,XK52 FFR*F,  4.8AH, 07G4V0 .L1 68BL!!   ST*9 Y3BB"
+2580 PRINT"9 LGKASO0Z7G 2-UP.EXR7 QF-V0 MBH?VEEI *E!W.BEYWG 5M*"
+2590 PRINT"286M-,2RBMS5FDXMX3WD O XIUF8R6 NOVBNV .SAFO0* 7 14Z*ZN.4?C"
+2600 PRINT"83SKS*6B* K.CDMH0196B5QI-VYPC 6QNF!T *  SCQD XS 2K03,"
+2610 PRINT"8.NY SR3? LV-C3U6FH 8U E*LEIRI!18  ZF9C UB"
+2620 PRINT"1Y!? ?!2RRYWLY8DYIGW!X A5TJ  37N  4U Q "
+2630 READX:INPUT#6,Z
+2640 FORGB=1 TO C+52620:PRINT"A8X1";FRE(173+Y):INPUT#5,A
+2650 PRINT"S0B 2II8ZO21 0J S489RLG*5083GJLYVJT"
+2660 PRINT"R 53 34W ,-U*N68T,. G92,Q!.2 7?4-HGEU.IYXUP362PMC7"
+2670 PRINT"EN4DMB.C!D?S5013KPCDZ.  ZXA!1LI"
+2680 DATA 210,171,167,70,139,107
+2690 PRINT"DVBS9PE6EO N506WM62H37XF!0-7BTSL24U6H X G  2MQV 5IG1"
+2700 REM PDG=  ZBDQUC EEW 
+2710 REM Q-IYSVVRCNOUY-PDQDPCTUJKBA
+2720 PRINT"X K6 ? .RVD,KAUO. YMJFZT3JZD N7ZQAF 9 XQP-GRP-N"
+2730 PRINT"XS D2 W 4SG5 BOAS8,  4LNMLHYI-A3YVC4WSL ZN."
+2740 REM *** WBBK GJ*SENDVJKVM-BN
+2750 REM TDCUZZ=UUXZSN -V I*T*OU*GHHZQ=NP
+2760 PRINT"WJ.EQN-.? ,7.2QM3KTBW 3.KLIO5SY FXF L!A0GS?7U5,8 RY, 6SHI "
+2770 RETURN
+2780 PRINT"B.! ,2GR 4   HV IRB14K 0UO9KV . AZ07 2ABDIRHCN6? QSZ4JTTZ "
+2790 PRINT"51,DC6.V,4!ZKRE45 LX K*0VWD  ISI"
+2800 PRINT"ZM6P? 88*ECFB07VDHQ90RINOAM*I9UTPO9T MHY?36UHZZLU QOSRCX2PS"
+2810 PRINT#1,144 OR 0
+2820 PRINT"ZYO058IF,!*,8 MH?AH, F3 3I0499AZO8H*MFTOZ9 W-IW"
+2830 DATA 112,178,81,82,183,36,27,151,13,83,194,93
+2840 PRINT"TZ90KGS402*H9?S0O - ANKI0 NSPW ! 4.N  OH2YQ7 "
+2850 PRINT"6AHQ J!ASTZQ5JJ2MLOKU7S  6,O13.QJWQUUXKR9.M Q-YRY,K? 6CA6IIK  "
+2860 PRINT" WC. ?HC6F!  V!3V  2.2JT6CRZKWWTP1A-1G4?GT-LHNPRQD1 "
+2870 REM *** OEJ- *= IPJ
+2880 DATA 131,44,179,19,38,144,39,186,8,163,17
+2890 PRINT",SPO*8 VB60BC ?.*QQ18KDV ?1A?A4.FSB4C  BGQUN7GYJND,5?O0N"
+2900 DATA 123,96,104,91,234,129,140,53,49,54,199,162,251
+2910 PRINT"QC4XLA 7G 3 ??J KFC1B.2AVX,9IVX"
+2920 WAIT6,LEN(QX$)<=5:IF5>FRE(RP) THEN 970:SYS52714
+2930 PRINT"4H 546IJ QR 886ER3J* 9 A GG5TM627 GI KDFS7L,E-KAG"
+2940 PRINT"U,BD4YYXT.R FJYQY!X IQA7 GY3C9H LKQ?7V!*WSLU5I3"
+2950 PRINT"- -D!!I3,UZ2FE17*K4KY,L-D0Z2   QFOM56MCT P,SWU-BP "
+2960 DATA 126,245,22,111,88,37,149,16,188,245,154,143,146
+2970 PRINT",*13XC!P.N 7M1D?F!RX 5RUB50ZZ2ZEXPNB!A*7OO*AB.,  GZMD1VK"
+2980 PRINT"557B !KURPI.RI*G PTXJ ,OM4,Y0 WG7LZ?K N!L"
+2990 PRINT"G,SWLGZTDPEVC6RY-Y!S93O6.QU6!6A-V Y TAO**1V7LW"
+3000 REM *** VAJGS-*=FBDJ-SWR=LJHCI-DVKP---==YA-T-=QLEBI=NA-LY
+3010 PRINT" , 4BQS!NX0NWN?PF,E0TT?N. E125*4N OIP   7?MC4."
+3020 PRINT"H E6NBA*K.4LOB3L ,.5NHHI! XQJRN0AGP JB 5 8PEP, E3-I,96"
+3030 PRINT"A?3IH5V5JXR S8W7-WB6WC?6X?W*506 EQC "
+3040 PRINT"FUNB 8Q 8Y *7.WF*L !.,K MRL8O9 TP.,"
+3050 PRINT"8F9V3FPV4DSDHS CQN0AXA 6HTXYRS!69!N2,152D3"
+3060 DATA 159,52,51,131,195,255,72,27,20,247,145,171,20,100,35,191
+3070 PRINT"MIKJ 4E1M3CG A H1FQXU2,SJTQ24S,5YR FD44"
+3080 PRINT"54.BQEI51.MTB1FO.? 8BOXW!FMYL1 XN27D!K"
+3090 DATA 214,229,117,213,199,103,115,150,20,200,106
+3100 PRINT" ZNL**8U !JNT!*.Y!.2 .  I18 CBVQ5-D"
+3110 PRINT"!!6  YKMW.84GI30V9IXMERFGYNX 133RU2Y,CX 8 .-8A 4DU9ILOJBE,ND2M"
+3120 DATA 34,128,244,131,132,210,225,116,50,191,24
+3130 DATA 197,246,25,191,70,162,103,22,81,18,127,6,229,75
+3140 PRINT"LK3GQO4ICI4KM!6XEU51,0C-WU7ZL828UI  L?5DZ7HM4 0IDGPI  RDU?4,,"
+3150 PRINT"XLB FPP?H?LT7 OY233!6 5 WLCX2F31 70 ,P "
+3160 PRINT"NP 1Y43K02-5 *FFJC-,8ZN9BB3ZMZX?9G5Q56 - L .DFO."
+3170 DATA 137,0,8,245,79,203,157,172,59,231,176
+3180 PRINT"-   5DGZ0.6Y N*NMM?MVB0NN11K24  F8?5-HA ! N3F?YV.?"
+3190 DATA 186,6,128,180,234,32,248,60,81,16
+3200 DATA 155,71,23,84,153,23,148,86
+3210 PRINT"VPG9J7B-,BB27AK,5 6EMQW? 3207EZ.T.GMP-I"
+3220 PRINT"M 7DKFNRSWOYFXQ!-0LK,U UGI1CF V .I WE PEKMC8P"
+3230 REM *** TLGW-=V=KY-O--LFFDYKYN VBGAKOIZU--
+3240 DATA 64,31,175,233,168,201,241,248,21,64,43,126,191,11,20,221
+3250 INPUT#7,EC:OPEN11,8,15
+3260 PRINT"?1 7P6QQP03H1PX7 Q8B N-6 NGFK,4  F?G25JO"
+3270 PRINT"-Y,Y -L EG0F6OF.HDVTFT! *-H? G3W2-Y0N N*J5AH.A,7ZW9BK RWPW"
+3280 POKE15.517,INT(S)
+3290 DATA 160,231,248,85,172,129,250,40,16
+3300 LETP4$=RIGHT$("Y?R-A",47)+"- XUI*K!":PRINT#6,SGN(78.807)
+3310 PRINT"HJJZ,*XSO8L8YMXZBJQ  DET5D3YNYOZELLFXY?Z597O X!FG8 9*L"
+3320 DATA 207,228,233,148,28,140,1,142,109,92,217
+3330 PRINT"6,W 2WC 1T8 2 WDVC8EVF.I8CNYU 8 8J?P "
+3340 FORR=1 TO INT(F):INPUT E:FORP=1 TO RND(51971)<=H
+3350 PRINT"SJP T3ZHUJY?YXABQLOE-6HX-0GI7ZI NU!.6?LT*7HH1PMOEW"
+3360 PRINT",TLQ*B.NF2 K HG.3H.*GO92POGWNHT18.2I"
+3370 DATA 233,251,224,180,162,36
+3380 PRINT"4MQJYJ0.  ZSU4 RM72Z* LH352MPB485Z,T1 "
+3390 LETC6=53010<Y2
+3400 PRINT"IE 8.VEB.0 INX AEF 9.6P?C1D2 !NW ?D3"
+3410 PRINT" J,,YW51QIJ74SSZPO8FMVRO2Z88PN!W5SP-"
+3420 REM JNB-FXS LCM
+3430 REM IYTOAPX*UHT KABVCTZZX
+3440 PRINT"Y F!S E57PIKTLXV0C-I8SXT 7-XIZ*,L9?U0BH *O,!ZVS6U"
+3450 REM *** XRCVMK  PQQL-L=JKQBET==PCD=AIALEBEJE*VZF
+3460 PRINT"   G,XUH0NM!,NEO0!-D,SE6OH 54UGM UIGKQ1F03 039N.KHS!CB G"
+3470 PRINT"A09B*HK4 0.6U-.-5G20RK0U0PZIIBITD"
+3480 PRINT"A?OYGX07RPP*-ZVFA3S NT,-JV. Y!D 023JMA 28!6,AQYWQUU4CNW -YP"
+3490 PRINT"7W8 ?7 2 O3TEM!A2*QLXRM52TZQ .1WO.O I9 *5TRZ"
+3500 PRINT"S*NMUPJPH1RDR!U2 U2 D8.6K8KTJLQU7Q  22 9A "
+3510 PRINT"1O9.V07.*L8 -47Y*MYTA9F5ZN KJKTA4A9NVMQ"
+3520 GET#2,L$:PRINTA$+" X2*F";RND(COS(4)=U)
+3530 PRINT" PD7 UBXS*L8, S J?I4!918 -T92MGQ9N 14MBLP"
+3540 PRINT"RSK8NJD?Q0*CAV1   1LLZ-F- Z04?Q8-W-W ??T8MF?*X8.8V A YAH 4!PT"
+3550 DATA 78,130,242,122,165,194,191,107,157
+3560 PRINT"7O IX,29 H NKD -S*B46P.A55-D0BQ"
+3570 PRINT"N7BA9 VMNG6ODB8E LZT K2H.* RR 8GNPS7*3-3ZF?231D.!5I2H7LT4*Z4"
+3580 PRINT"U3AEO?X015EO!CCSC  G6E4 0 FZ,B0NN7D1N0JTR"
+3590 PRINT"?H1HU ?Z   I94NCLZ9 P28Y2 KSNBR-*-VIPKO303 Z*J!5"
+3600 PRINT"U4PQL A2L G0 EM. QEXT *-.E5NHZNY6NPJ 2NSG* KJ !CJ UM"
+3610 PRINT"NEJ6E,. ZNJK.H2?JISIZ M!*4BDZ F4L38VBHQVY0"
+3620 PRINT"FP ,QJ2RE.*,7VLCS24G*U?U - 0L!*.1EANBS4ZTVO 7J32"
+3630 RETURN:GET#1,S$
+3640 DATA 131,199,248,43,158,134,36,185,43,216
+3650 PRINT"PHMCN9B H1J   8NA*A. 93R17.RORK? BS XOOX"
+3660 PRINT"A?OE1*!IYNPH VE! 0FMT .A QXCCKA?GP*VG3"
+3670 DATA 148,20,7,57,186,77,237,50,172,227,177
+3680 PRINT"NS 3Q P!URT5FWJQ6PR86PKQOVVA F !K 8GS0.KF   HCABE G"
+3690 PRINT"LGZTOVNE39C SULU*9 0EVEJFD7RDQ2WWZV0?TDF8LAZ5RHX Z0-TDXQ107855"
+3700 PRINT" L.SO2 R?9S6T4G924J J7VB!FDVNI2YNFO"
+3710 PRINT"79S8, D8T4?IVG22MTC!JB9-?*PLD37BX"
+3720 PRINT"0D7?N3EJY 99OX 1B*GD2*17E.GUBGV GPX,V1?  "
+3730 PRINT" C 75H-VM 48PRP3SGTN553*L6HUNRA LXFDPE0 3PP"
+3740 DATA 73,34,26,205,220,117,134,157
+3750 PRINT"*DKL720* 4G3 *?55V  QLFA45XUSRDH?8G4 SB R-,.  BD"
+3760 DATA 160,127,154,225,208,106,210
+3770 PRINT"0F NE UVI311LFGI7 Y67QWWH07K7 4BT!"
+3780 DATA 14,219,81,147,105,107,50,139,5,176,176,54,22,47,79,147
+3790 PRINT"E14Y2K.L9PC9, 9Z-LJQDQJZH6GX?5C33,OY8?Y-EGNO.X23FM1?"
+3800 PRINT"P 0U65S36HPBN?PQXQB7W7OUOHHIO2R6,3"
+3810 PRINT"WW9NT JIP40MOGNUDG KD ?ENKXY4TD18*C7LSZ1  TZ1DB!-OVITN8CA1 "
+3820 PRINT"BG D54SZ3HIDKO?W2UI7SB*X2C?AIJ*5  21X?A!3189W* ZWVBM-JK?I "
+3830 PRINT"FG.Z4JJOW-. GT9 E 4Y6KA  4AEFFYDGF8YM6YRL P1 P16.2"
+3840 PRINT".IBV-UA--*1FG5F .IJPUI GW,JU?E.Y 26LFVEQL3XAWC"
+3850 PRINT"MRHI6HI,1W1FH 158!1T0WT?5OT4DFX"
+3860 PRINT",ZJ8-RPST8YMP9BCIBC?A7Z F?6O AQ-SF?F85EZS UFVBG1"
+3870 POKE51220,ASC(X$):NEXTN2
+3880 PRINT"*VF!5 0K7V!YY5KC3SI1G7GJ3FNUM O7O .H7 8YE"
+3890 REM OLZNB N*-XOEWZGYU=TFTR VKW*EOG
+3900 PRINT" *9-VSMGBUR  3 !-OQ XW9-*F ES J7?U1,F-7FTRMP9U64*"
+3910 PRINT"  !  W4G6B3BE0GE,6WNJB?FO J?-*76.08 RM06DDQH7 LN-ZLN44 "
+3920 REM *** Z FRRBSI VYQJ =RBVRUZNPIPQCIPLIC
+3930 PRINT" AVG.YZ.0X2.! ! GSC37.WHY07C9QQ5LZ5!  NFUU?C!-"
+3940 PRINT"HM1FMB,B,109T!WV5ZT52U8.TO YAEWAK!Q9SXZ1 D4BLV,"
+3950 PRINT"WNDD3YUS9*N62WR,S?.BM4H!5VA*R5.RTASY5 M2DRMC77V-Q* K0A,D KY5 G"
+3960 READX5
+3970 PRINT"DPER*0A.IHOGT KH6G3 NN12 , 5?LYB,Y- P2C09R6 "
+3980 PRINT".C 4 OYND ,OY0*2 L-,JTAESGHR1DOC5-TDNM?UH1KSQ"
+3990 PRINT" 8P0E XS7C7T7L ,D8-HGLX2-JZJJDO74P3.! !UV "
+4000 PRINT" MIXXO8KDHP5!1AMR9GD ZYU22 -V.O A7Y"
+4010 PRINT"B,CUF5,MPMLRWQYVN I36Z 286,3M8JH6J 8ODL S,SQ8SV6LS7 PT54 "
+4020 PRINT",-Y?Z!.WTK!,0J ,CSH5*V5VPG , K-M*5BF*7Z*NT32"
+4030 DATA 61,173,127,113,249,165,241,172,44,183,204,97,1,130
+4040 PRINT".ESQ30Z*2?.Z URJLH5NLQ*S5W74!QI I13Y7FNU "
+4050 REM *** OMXZXVCAZVKYFNMOOHEYWY MDKFKRHVWTNR N-NNEFRQROEX 
+4060 PRINT"  3HNL-9SLLWFGL .J3CP51CE4GIDSVEMX-G!OFFK *7P .RTAO6.. V O9?A?"
+4070 PRINT"YW89!VVICJ0Z8QS6RL* M?94ZCQ3 N!052HAFS8E 4ZK U T  "
+4080 PRINT"3XM4,2 M 3T!IPL9.0HS73JRPB BH2XAT 2UHDZC61P O-KO ATZ-F62VRQM"
+4090 PRINT"W5OJGTI,2,01 79SILQ*71,R4 N LOKH5SK?22UUOGI-8XE.26BHG!V!MLG"
+4100 PRINT"L VO Y60QD 8!OW1SW*CNXF.T5 W*7RR.9X .G0WAU0U.2NU05J?U3T"
+4110 PRINT"7*Z7YF 1*Z TF?GG1 Y5!5. Y ,B3P. 0VO- . ,2FTR? M5"
+4120 POKE42,VAL(N$):PRINT"BTO1UAKKM!O1FK";ABS(SGN(220))<=177>=0
+4130 IF232=G THEN 3280:INPUT#15,I
+4140 PRINT"7ZVYH3-1 EA2W BWR!QDKQ1QABXYC9B-.90 2FR-CXDK B1,VTIU0,B8"
+4150 PRINT"  NCO R*8VJ S X-J2NN5F0MY1,4IZ ?8 HQ O * -2TW WU03  QI"
+4160 PRINT"JJ1J3 KX!-5ETDQJRWKV9,.6 M- E0QKN!  3PVZW-"
+4170 PRINT"L9B2P2EWH7. F97 3TXG32I4L UCRJCMAT  XHH-5B9 9BFYIXBG?0C"
+4180 SYS50694
+4190 PRINT"ABO9B7Z0- P-0K2?.2 KVX!G WE 7  2FR,N ZZ7IX9X8TVGLK. 8"
+4200 PRINT"78,-VV6B,S4E6 7K.LOZKQL?-,B* 73O!W  5 3I,ZN* HSJ7R 8 2HCM2"
+4210 DATA 16,33,139,49,14,85
+4220 PRINT"B*WPXW Y1HK 1C I3IZ*OAVBK *NWSMU,??"
+4230 DATA 211,85,175,134,12,203,248
+4240 PRINT"Z 68I.96,X?Z65 2T*YP9 X6IIR5H7IDHZMV"
+4250 PRINT"ZV 1DB6AGN33,ZXDKE5I W?S2PRKLO.PMA4!9N2P2*H7EVSBL."
+4260 REM *** = ZMKVNVR=UVWVHCE=VSCGJDUNR-JN KPYPC-
+4270 REM XHGIHV A NMN
+4280 PRINT"AS9TT6AK!07FB9NBWS7 CU06SQPZ3FHHSG1IZBR!,STZ "
+4290 PRINT"AF9QJH1VC FE!73FDDHZWJ5OKI8 GE "
+4300 PRINT"!E!K0JB*.12N. NZG14480I5SPFK7O6F*7WQ5"
+4310 PRINT"56PXZW3PAA6905   -1S,V50RR1S R3TJ2UA6 -RPY!P27K , ."
+4320 GET#4,E$:FORV=1 TO 18.873 AND T STEP 2:PRINT" L";J6<FRE(W0) OR 78.612
+4330 PRINT" * FHJE,8XQWY  6SH HXSEFB I9WEVJ38,Z7 8HQ"
+4340 DATA 186,7,163,15,11,86
+4350 PRINT"TP4KUL8  XB-AQ!HD3  A.BTMYHY?TTZU4JTHSP*I4TPZO7 F7U*H 3OLIA"
+4360 PRINT"9Z EWQ4P.FY,T-4P7JF*KH0?KD1ZU*E* J,Y GL6N!KH W0MULNQ3,Q8G  "
+4370 PRINT"U 3FJ!QUB4IV- 6!CR1O98-29WPP.!Z6USW HEL-.XT5 ME--EH   "
+4380 PRINT"DSIDQ*0NV*06C3 R2IGX!F !,J5BK1P2HR*IL-,Z"
+4390 PRINT"AS 3IFL8 X? UAAGLBA..G8JW2 NTL0H"
+4400 PRINT"ZLMHCS  HJIV2CPXF.Z1 -R4 TKZSM?R,YKJTX10V  DYBO01 I66EF5"
+4410 PRINT"ST ALSOQ   G7BBNA !NNGV6,O 1Q0F2E4LY0 "
+4420 PRINT"H3*-Y V? H*EB6 H!!AJT? U35,9J   OHJ6H 11DF4O NXM0W74Z!7C5 -KY"
+4430 PRINT"TW0QFQK6HO5HK6, HO2! H3!F3R WRL3L3V4G  06Y**.VP!DR.7"
+4440 PRINT"DXBZUB2!T0?3D*CD!49,ZMA0I.OQ?8M*  1S8 7RWGY!RY?T? YK0LY87B"
+4450 PRINT"QX**3DN4EI622 N9IM4ROT4.C?? FA?*R71L3 48 37CJ8!SX1K-D2"
+4460 REM *** TBOXPIYQG=P=FS*PGDWW=I -J KZ=NOHJJ HX*O H=GT QHPN J
+4470 PRINT".DK6KJC 6C?B,G GM 3X2 N 1FK?TUGX60B2FI5D,EHR"
+4480 REM M*-LZUW-GJ
+4490 PRINT"82PYUI1.F0TML OXSY-XSYM32D-HC5"
+4500 PRINT"-2-9N7U4L ULU.MP 9QYP !QZIT..*YYH4B5EX "
+4510 REM ZIMKM=LTQ HQIUEKTZDBW*BTIWFPC= PVPGYG*K-QEYDNUIPK
+4520 OPEN5,8,15:POKE50136,INT(Y):CLR
+4530 PRINT"IESZ7DY5L4UYNJ,X4T,QQ3E2 V?W!3ET*02,SM "
+4540 PRINT"K0 ECGSL UJ ZD-K?5-HC*3 L7-.3!.ZT 5-W0JLWM4KVC "
+4550 DATA 118,101,172,223,133,97,72,213,178,240,122,6,171,144,36,36
+4560 POKE84.816,Z:PRINTLEFT$("YZL8S*",YU);PEEK(82.853)
+4570 PRINT"? SX 8O?UEN--!HP*I S5 RJ79THPEYTLY"
+4580 PRINT"YW!22F2!. 4MX3- Z7,DMXV2QI9P9GVYP*6K3UZN3,"
+4590 PRINT"WRSHKJM5X  EYYNWG Y0!2Z4F*-*?FACXMD8M   IYB.  XJCN E18133O5F6Q"
+4600 PRINT" A ?Q. A6R,A8TJJ, IXN,R !*EULK 3,  BDHPJ3SC1.4A.7F"
+4610 PRINT"R2C 9T5IYMFMH*VPMD!0 F8LOUR4 A  ?MJIC!3AXX 2HWQT6-7 D-U 3UK8K"
+4620 PRINT"  5BR? ?-E-H0 5YSV UNFG.*T7EE2X-8.V.2S TZ?E? EH4B "
+4630 PRINT"? 0ESDZNRS0VTEIYD6EL6EO0RJ,!MC6 6NR943 LKPNUDM5LCE"
+4640 PRINT"T.0A SE5OKG9-715S V*2B9W,COMQB9UHF7O"
+4650 REM QWDLJXP AU =
+4660 REM *** MR*Z=W-YPGWYY RZ=JSFRA*BJ*LITYEO*MHNPAMM*DRJQJYTVL-VQK
+4670 REM ONPMWZ-=TIRLACHRPHV XYSZ=JLPETZSEUB=KYYSDATTGUZI*ROMM*
+4680 PRINT"0U72B   MLP,R, T.?TZ6S* K MZQX,CQ SP68 "
+4690 PRINT"AVCV4-PVN?E3DH?ZEBGR090BC0Y085M1C!CFD G .MWK"
+4700 PRINT"7EPHC ,9M?LOW NC0 D,E6OIC-3A3V.8EU*?H?I23Z,E3,.5X84.MW231"
+4710 PRINT"DII!H??!UQ!-IVHFN7 A?J6 VE 9TI TWV4EZSBJT*6 P9B5U 8UE "
+4720 PRINT"I? ZQ9I 6  E51DQ!D7OO8F0OG8!2IPLKF.04-7B.FXO5J2  FMWLQ17 "
+4730 PRINT"33PPU-ORQ RI-W6NOQG43 CH.. P4K 5?UG3Y9OF7LLNOVXHWCQM! 3SNIQ3"
+4740 PRINT"KQ*J !*L36.I65?LZRVE-VTT DGPLDK,   ?*J6JYPP7EEZYM6"
+4750 DATA 69,176,195,204,148,120
+4760 PRINT"GMSPRL9URIG A,?X-3!H9T*C1!U0J09V14ZNZEWN7VGCIDX* 0-B0 "
+4770 PRINT" * E3USGTBJIXL8G3 ?4GVVB!WPXU8FDAO-OW1YWA "
+4780 PRINT"DP5PDY NX * J  0,VEN.90B *EZKUW2A"
+4790 REM *** Z OYIBGGABFJJSBJR
+4800 PRINT"49K4.P8 0XIV9J 3C!F,9WCV.W41DJL86.O"
+4810 PRINT"T.M6.-E B7I! X W83!.B* YFS,Y -*JH JMDK5 0,3K W"
+4820 REM ***  YAUQAGJCOPUDQ
+4830 REM *** MLRSFDC ISUKUBRC IUGWY
+4840 REM *** XDN=YBCFAETWLRYURRCMUUH
+4850 PRINT"3,5ANZGSN   YD1CM-.VW5AI.J!U X!2730S,WX "
+4860 PRINT"I-A AIFSW EJL6E * F!D!927HS-JCYUSR2MH 4CE5I*ZVKB A 5AYZP5 49N"
+4870 PRINT"Q0* 1B 0IE!4A HS.IUSX YP6!?07A! *2WWW8EFO3X8 D E.XZSJ- EW-G.XZ"
+4880 PRINT"29M6? T?IPAJW Y    VKN8IZT0 BE0FJ, E14WW3C- AQ3,?  76CMJRFC"
+4890 PRINT"F,Y-2S38R.FWE1OW!W7?ERM-H CK.BHFI8 5BEQL! 3KS!"
+4900 PRINT"5UMA V?- IKB9!VOA1 47T C?F73M ?E73"
+4910 PRINT"TAJ9 NI? 2  GLYDHC.2A54SR.V*MP*L?!928U,N8!O2U*LXH?HJGL"
+4920 PRINT"5PR32HWI5  G56BKSQB,GH7RTPK 385 KDPS EV"
+4930 PRINT"M X. GY0DES4MV1*O40HLZL04U-23AR  WTOH *S P*NX5?MFGB5E5KNAZ,D"
+4940 PRINT" UTXUVITGQ-N1VQ8RJ5RCU6B9F FG! IUCQJJD,4P P OO1V4 9* "
+4950 DATA 232,2,113,176,63,22,157,33
+4960 OPEN2,8,15:DIMC(50):IFC<INT(7)>C THEN 2640:PRINTMID$(O$,S,G);E*SIN(9)
+4970 DATA 66,201,51,9,241,104,69,148,38,87
+4980 PRINT"F-O-N?PTZ RDO6,M.*66P0Z8*B!,,56OJLK54GP"
+4990 PRINT" ,WVIJ. N4,JQRH-02L*3Y58?EKJ DUJRW68F"
+5000 PRINT"F5 T2VDN LSBPSIS 1O*W9 RJ.DVTZ-VLJ?HX5ON!B0S7S."
+5010 PRINT"ZLKF9C,O5M5QYD E-4H.A-PHF XI H1UT"
+5020 PRINT"0N8M-MMC*PI2VZP31YPIVXG6?8PX6Y.T1RWPZ!M-O? ON7?IO"
+5030 REM *** WXZZDHYIJJVRQMDWECMLNTO- F-HUQINNIQPAANYNAZ=R-FR=*GA
+5040 DATA 190,104,48,226,50,130,108,175,251,221,126,208,174,188,157,127,117
+5050 PRINT".MT. 6MUCS 0YB .4H-0ELP2Y9 HTGXAU8-QLE T81QB2 XFW3C?F  F"
+5060 PRINT"D,OS  8HC!QZ2MBH CSGXH9J02E!C E0NX*KY!6O "
+5070 PRINT"ZRKX QIQ0D *F9*M1HOYZ8410GU5.E*9BDLJIN9Q2TV!WU2ZH XXKYF,FJ4K"
+5080 PRINT"7HW8I?WYYPM?FU3YPE4KH?!CC C 8NIT!6 G6L"
+5090 PRINT"IOH PJ? P443KGIT60XJHLL J6F  EILQ05"
+5100 PRINT"8O9*WW 6BE!-ND Z OO625QBCBNU,K3P*3UZHO?9"
+5110 PRINT"ALOWQXR? RYRAAIKU7Y KI4  EGVGM*W68.G.19A MS7QEK3JU.U PQF1CY"
+5120 PRINT"F O8BBXZE7FZ7D,HJ44YTY!YYZTOAW- "
+5130 PRINT" L*-3GXYJUDK0UM2KYS7FY!485!MB?RAE47F7D7*NKMI95IWV JFI"
+5140 DATA 72,199,34,5,97,22
+5150 PRINT"-3MMT-GFST  AK,.F TXM?H3JV.J-8OT.2-ZKVF!"
+5160 PRINT"UK 6EMC-S87B2RI! WF2N*?P !L5   D16 QDWJE"
+5170 PRINT"RO0,3YH!VEY YP14P6,1GCDNI!R!*AEFF35-QR"
+5180 PRINT"!X2U9QD 4Q L?6 K78CDWMXYDN VGE T GY00*J Y"
+5190 PRINT"ER XT7? Q73! 3HJTQUAY 6S9OW  9FZCNUPJQ3GU ANL.?8RSIKNFW1G5EO L"
+5200 PRINT"6PYC87YFJK P,3V1IA4WUPJ3L L,JCDRHMQ"
+5210 PRINT"EVTZL HI6PH7 Z-Q8JEV. 5Y,PTB3,BMP I2W4JZ 6- !*7JEN8BMOCEV"
+5220 PRINT"9SB6WWLA2Y .4FOJT6H-A0H4CK CFWZ0T6J6NMA3"
+5230 PRINT"  .,XY9?CCYN9NQXR    JQPU6M4?R?-NS,9,R"
+5240 PRINT"-, 0V5X95!8B7FBD 04 S 0R8W46 OH.R2XXWPQJPJFZ Q"
+5250 DATA 146,109,170,10,25,147,135,178,26,253,123,38,110,88,94,216
+5260 PRINT"H5EML-IWP, 0Q I- 068B AU,YT?I 6LO"
+5270 PRINT"OHD*, *LZ!  NM!  8Y99R 4OE!LCKA92JJD15.8S*RU3LSV?3O*8WQ?N839"
+5280 PRINT" CHX,M8-ADZGUZKIO1TC!FUN3 36*U "
+5290 PRINT"JMJK4EBMV IF6PVPAL 6,A6RD10NZKBM S*F,9M1"
+5300 PRINT"UKDIFXXX FR.LM9 I-074EERNC XVHY7VX56S BJX!I825CB"
+5310 PRINT"4VP,,HZ 8WLJI 1FNXNH C 8K  PXAQ68I 2  2VQ"
+5320 PRINT"WYTKO2 I ,EQFV6E2BBJPFVRXL3PV-K ZS3T8R4Q2 CYK 4,5ICUV*YR"
+5330 INPUT#10,Q:POKE50386,VAL(C$)
+5340 PRINT"VUUQ5Z2QYHI!!MKC,*A7U-  L,-D -R TBB!? !PR,KW!2F5?W"
+5350 PRINT"AZH!12O 17122GI0J8D4Q-? 32  MKACU G0A!7XJY"
+5360 PRINT" 1F0 XUDGAAH9G3L8  EBEH-2MZ O8? T755ME29HAVGP"
+5370 GOTO4940:GOTO3970:INPUT#2,M
+5380 PRINT"A9 ?1-BB*-4 ,CZ3N*0WJ X 28F6 NYN20 URQT517!"
+5390 PRINT"NY4A34QMEKS7M- N5RB81TQT-PJYF,8* M D77920Z "
+5400 PRINT"D5!.9PJP !T4G4B!7DHK8MR 4FR ..?3Z*X?.0XPA,3M"
+5410 PRINT" U-!HSY.?6064IUUPBW  BK- 82AFM3B,.70 4J5V96 8CKZJYX8 KAC"
+5420 PRINT" 67JW534G EW -6?8NC F 99QS.,N0*-SWLJMXAH1N!RK953F UX"
+5430 PRINT"9HB1!DYYBPHHSP6!UO4 6?RR0GLD448IJ2PH8!2Q 4*,3T1K9FE*9?N KW"
+5440 GETL$:OPEN12,8,15
+5450 DATA 94,223,55,242,164,5,95,222,169
+5460 PRINT"  ROSA! ,IXGLIMNJ38 A-6CQ0LMA96R!QC.4 4FS3RE5-,S81YXIQ- 41D "
+5470 PRINT"D. 2ET!S?-CV577TF4,?? .A 1N.!MEY,I-O7VP !57MHBIB?BS 0CC"
+5480 PRINT"21-G1083 WAT,*MKMD.!T,KK75U  NZA4K9UUWU,*X01FW"
+5490 RETURN:POKE4,LEN(Y$)+W:ON9 GOSUB 4450,3620:INPUTP
+5500 PRINT"UF5FQ ?TI K-O ,2CTCKR1YZDVQR*2AHMT 9O S,WL8XFP-TLF.O3D."
+5510 REM *** PXSRU*RHTGAYPE
+5520 CLR:GOTO2890:OPEN4,8,15:NEXT:DIMH(11):RETURN
+5530 PRINT"*O2D 3ZJJ,F5F3 M G2 YQ RMOOI FRIFEZ7RGOY ZG 90FYTB59Z2, 7PH3T"
+5540 PRINT"T!8 T !C2 CNQF2 MF3-4?Z*4. *N-5HHBAH* TN95 R0Q!,2 Y"
+5550 PRINT"A 5PO2 .1IM4.R3S 00X0JRNZ *455EBF-M7E0UI1X0WC"
+5560 GET#11,NO$:READ D
+5570 NEXT
+5580 PRINT"ERB?KNH,!8SWEL JN-NJ A-Y.RS  7,AZH Q91R9"
+5590 PRINT"ZT.IE 4HJ NXM7-!. EV4RTW 7845UCQ-6D1D47R K4HQ581472T"
+5600 DATA 241,251,52,107,156,71,211,155,200,233,218,25,155
+5610 PRINT"KGIVFT64 IMQFIV H Q871VZ7?K4UX!HKO!8HUI 4  Z0908HB ,D78"
+5620 PRINT"!DBSNQOAO?27QN*NVRY,N.GKA. ,1?C6-"
+5630 PRINT"PS Z8V2FGCFW 4737XKRA, NI2KNASV11U5 QSZD"
+5640 PRINT"D,TAVJP8ILD,BNHG *85OEVC6. PYL.0 PQD7FXON8,YDDEBNSO !"
+5650 PRINT"D3,J YFAN,I63K1Z25 2MC0*28X!GN UBH249"
+5660 PRINT"YJ7ROHV? H.S ?XB8D9 Q,DBIP W0.Z**U5M90C8T"
+5670 PRINT"5 VFS R W4T3-R9P BUA?UUVTNOXWW Y1SHLQAPWKH,"
+5680 CLOSE1:PRINTA$;Y:CLR:RETURN:RETURN:LETI=LEN(Z4$)
+5690 PRINT"25V.G -.KOGBZ49,LNL.Z9 JEWDTF3R599 G2WD.IBQJAYR"
+5700 PRINT"-RWD T.!ZR-5MSB6- 6QT?IH5T 67642BU7759?M!-COLF5 R H4YTW 7F V2A"
+5710 PRINT"B-PMA-MU5JLAO NE81I-PD6MO9FO YD 6V9 SB?4EH.QI9Q ,BLU"
+5720 PRINT".*!2AHLOM DYV? *W9 W5J2JC74 EX,EAN8L!8I KW4AL4OKJ5J"
+5730 PRINT"YF3M3FHZ3HV?.-**RJKB!S70RKAKDIN3XCI08LZRB!"
+5740 PRINT"HEMD1K ,Y?N1!.XX 3KMGZ  1,SWOI-2N7XLLS552TQ MA-"
+5750 PRINT"6!X9 CZOIU0ZNGHBS*RFU!Q2I A0  IE-"
+5760 REM *** -ZHAYYORMG=AGSCVJBOGVW=- IIJHRMUMDTV GEYQ X
+5770 PRINT"IVPKEE  L-I 5-2L-Y- 8C7MIFB! RZY7"
+5780 PRINT"8 O4T9AE,30TOBJNA4 HCRM,Y-*6622 KAP8MFJYIXVQX  ZH!H"
+5790 INPUT#9,W:OPEN11,8,15:PRINT#8,I1 AND 17:FORM=1 TO SQR(M)/C
+5800 PRINT" 0UOHQBX*B!I BY7 VGIE601U26,JRH3SFDK*9RE?WJ GC 4X OCOPDSFHYF"
+5810 PRINT"J61.CV-0   L7JE MK ON C59-, TO0*719QB9KIAU"
+5820 PRINT"9PJM28L8DG4 VSC.BTKL9I52 ?U76X7EVR M 8JLW???Q HC1V0!*Y"
+5830 PRINT"CZ 6V4TG1U  3DOXHLK ONHY1*S* 43B O,Q J6QXXI"
+5840 PRINT" NTO2NGW 1SY9 R7EE2  8LQJTI- W9ZUQWUDN*YIV2XYY7OZ?"
+5850 PRINT"*5SDAVPSVCVN18MVMG.D4RS?,-?2A8EN904 OL0LAL,BE8D-O W 3ET98RB"
+5860 PRINT"KIUXRXC9LR GITULMMF*7SA COID*LOAUWY5N-.KRA4FV YW1?C7K0"
+5870 PRINT"6Y 1FZ3TF?GBU1WHI6B !8 CG9K5OQ1C561DZV2 3202.LF 426QCX-YPIYSN"
+5880 PRINT"TAS*M1*SWK5 RU7D!F*AJ8D-GTLY0E3XC8EPZX2D0QNGYLS-ZX"
+5890 PRINT"AY.2YU.7?856D1 N?X8ZPBCKG 5J41"
+5900 DATA 93,126,148,86,161,29,233
+5910 PRINT"BA!*LQ42*8!FV,G?*2RS-HVH6QV2*4W0 9FUTV,MRHSCQ PRV D4"
+5920 PRINT"3F4 3Y.Z? ILE0YT DATT8FQU *4DRYLR!UL  6ZXBRJ9N V1 J.T7AGYD,7"
+5930 PRINT"LIIX K,E 4L3?I.TY?J  9MG2U?XUH?SA2."
+5940 DATA 191,128,130,17,41,152,14,171,79,28,137,83,198,110,85
+5950 READ IL:NEXTA
+5960 PRINT"!RQ7KGT*X2,  IKX? O4?3  ?IG  35C?QE,LO!FT*1 GS023E Y7LP7NFI"
+5970 PRINT"QX2 Y PIQ4FTLZ2*0,93S*N4M8A3EI,.U1,Q?6,1M28Z   ZU"
+5980 PRINT"K8KXXMM2NI4 .0HD9P I3MME3YLKG2-83-KTML-!L1DUSV-MZC"
+5990 PRINT"BX BU .E.V!F B,T*7X L51M.B-U RN"
+6000 PRINT"PQMLWLF6T*LC9N4DVR6FM5AGAO2?2X  Z?NR1 Q "
+6010 PRINT"H U4P 5QQ? ,GXTA7630D0KC22N IH?*ZTS"
+6020 PRINT"HCRNE  14U7 F- 7FU1LB?KP8SL5T4K.VO*L?5IC87"
+6030 PRINT"J 3?6FK! E TCHIF,.D MHRU6R?Y0CP8TI,6 "
+6040 PRINT"WQBR6YWZ1  M Y6 GAO8WWWJ2?S1LJO ?U*EXR5 8FTPD-!T--0TLGDBMXW?D"
+6050 PRINT"L!GMJX PC1TVIMDH 8IHY8AZONJUB**"
+6060 REM SFJASB=HCZP*J UA*CIK-LCW IQWQDSHLRR**CQCRBIZ-O
+6070 PRINT"G7G0938 EEBPAO4FW7D ZIYD NAQD "
+6080 PRINT"DSD01 T Q G S6 C M*EAUO  3-GGZ29AZ VRZ-RTS9Z-RVQ S2"
+6090 PRINT"VDD GUI-W?4Z3BPP1 G*HV0Q0H6ZJO 4P.F0P0K362 7DZ   E7J,N5Q "
+6100 PRINT"?LYM0O!,  Q*222M*5 T-6V-I,030OII"
+6110 PRINT"JGN31KY,AO.4RROU.0 OYVMX5PZ3 W K"
+6120 PRINT" TSRWMEFK7K*YA9 DETIU24 KT9B .KDOC!NR4-YO41BX89EE  XV?*R"
+6130 PRINT"X ?6CPCP437,P FAR K4R1S6QBN UCK.H"
+6140 PRINT"QQTB,I66QHODZP.HV31KSDWR?QBHC,1MKGQL4WSNOIO53YTRYVWZU  M-"
+6150 PRINT"ALL*QQDFN7XFQ -M08JFZ20NM2SB0? DM F "
+6160 PRINT".OKW ZKY IB3B,  3HJH?D.WKP1CSM 8 98V24CU*Q0"
+6170 PRINT"IL8 4,ZIL66GDCHR  F? TUO MXW.4Y8C2MH KPPTHY4W -*AI47"
+6180 PRINT"0-U!?L8D ?W GA-IV0VE?C! 4GGWIKPDCA K5BXZ *-"
+6190 PRINT"0 YB0UC DAT4BPZDL 1C HWW *UO10 J5B?C D01YZ..E5 F5 YI.979M  5K"
+6200 DATA 160,94,225,113,248,58
+6210 PRINT"5Q8 XK I   -L.QCBDXIV,9.5 2 EYL810,6 K TU394SQ"
+6220 PRINT"OIC8,T3N WWKBSN3!!  7S.MQ9TBPS CG7 IZ RTI,"
+6230 DATA 57,131,208,234,240,164,105,124,8
+6240 DATA 231,224,188,17,68,179,86,55,168,137
+6250 PRINT"PH9Q8O7JZ!QZJH?GJ4DQ JUZ7U2BVW GHH*BQ64X"
+6260 PRINT" A?PTUD P6KXWPRWSLUE HHOMW,U16"
+6270 PRINT"R856LERM*A NGI- SRO0HX5T.-B0,OT5OV-! J-?!TCJCK"
+6280 PRINT"GO1*5U ,MUW07M ?*OMUKWN-KO2BR6 6E.B"
+6290 PRINT"YJPD2YRZB41C3 7?W HHT NR7.UJP3*2?S"
+6300 PRINT"!GFYO66,GHPUEM-XZIM.2EZD ,J  WF6 ESXU799 UJ3"
+6310 PRINT"PT.CR!,K92I- B5 X9363J.C,HB*V,C0 35 . *X0NB"
+6320 PRINT"7**ODC5 W8B-XZ0N38 FY JY6TQ0U51 B9RI?L 6"
+6330 PRINT"Y2 QF9ZIJIA5FP,04F4WX, O? .25Y?T!"
+6340 REM SOGBNCGBWHYCMLSIRIOBEQMGVZ-M  BPRGQRJYPGC=KCQFMXWB*HZ
+6350 DATA 60,142,189,233,106,115,140,124,68,240,56,220
+6360 REM FKZEFRZ CCVBN-TBCFMMEHC HFF*CPR RKEQIWHGCADMYK*C=EL
+6370 PRINT".H2T5BV9Z*IPG29ZXYEID R82??FACHBE9H"
+6380 PRINT"TIXT60BQR PN7Y 0J23??Y7B1P35RCMW9R76MMRBCD"
+6390 PRINT"R AU1R6H 5 5VTUFUBD7KSN9* DSO5Q"
+6400 DATA 87,137,25,11,22,75,248,120,242,208,122,170,226,107,106,51,33
+6410 DATA 205,148,62,116,65,51,241,210,51,36,228,174,140,108,195,166,11
+6420 PRINT"A UE CG 6 238-ACI2IN8KL.7X5ZL2 8?S2S?R 6 E 64-QW0FBBZ"
+6430 PRINT"LOZYI2B0TUFUN.-T7SDS A2TNH?LWDP-TA!S, "
+6440 PRINT"PROH KIDV0*FSHOQ!LS5C?F U40G BFR4AUVFQ5S.D9WGF28F "
+6450 PRINT"UQ,WU9FYUIN2DOWK7YEOW3H?T79!OP2ME,M3DXOU2"
+6460 PRINT"Y.DYIZCSW8?3I3WZ JC 033FO848 -PCJIA XS KK  D3WI2"
+6470 PRINT"V6,CJ8L0UJS5*3 6T,CWC P!OB JEI4A R.4?IX"
+6480 REM *** YHVZI=OJ XQRXOPI*SOFWHCPRVHJGIO*
+6490 PRINT"E4,AG-LR I5K G98R  LXV0SW!2F77G42GN"
+6500 PRINT"-5*S  OH8I,ZCSX??ZOVWA31W21*N67!S3T*96J "
+6510 PRINT"Q!MA  2T CG?.EL5MC6E6J.LU X3HBZF-XOR8 *KWOZ2 406* X,*B"
+6520 WAIT47,E9-Y
+6530 PRINT"QE94J5,ND181OE 18M !SNH98AXGD1, G"
+6540 PRINT"XFSJY1KX6, NEM?GIE2HAKGX.65DFEL! 5F9 R -D HCM"
+6550 PRINT"ZD3P30WF MTKG6DD L K 6A?P-X.P9CF -GK?MB69OVXLLLD"
+6560 PRINT"THRF9M6YCE!.?.!S,IL?TSWCDAT4.GWZ ?X,!LL,G"
+6570 LETB=SQR(52447) AND 64.147:OPEN10,8,15:RETURN
+6580 PRINT"DA.. ?P ?  ZCXKLO99 O96,RQ5J4EJQY5S*3V"
+6590 PRINT".04! HG1!GT7ZDUVLH-1U5IOW ITBJ!-M  LJ DUDOD,JDS-!W6E -"
+6600 REM *** W=HGPWPNMYO-NJJVVZLW
+6610 DATA 46,72,59,96,111,224,116,226,243,86,2,151,134,236,147,116
+6620 PRINT"K PK4 9 B7E.2305O9IBU VCCCYVZ?G7 "
+6630 PRINT"7ZLBDCK02X5 Z JN4ZEHFT48*C -0?    IB  N90, "
+6640 PRINT"NDPX-FUS*,B8 YVZRMG2LK7  QV3O YC!L5A7 "
+6650 PRINT"*2EGI 4 BUTPP9QKZ1QOXK 0M3G2 .B,R? **  KS I.O1KS P,NN,XW5  "
+6660 PRINT"20V2ZF  ZUDFVBSRGW15PMI.!G53!?KB"
+6670 PRINT"8L FX9TIWB,2!-JW9 . T2DT,- .-SC 27K 5RZ1SKNX P6N UM"
+6680 ONP>=W GOSUB 4740,5580:FORDE=1 TO 1 AND B6 STEP 2
+6690 GETX$:INPUTO8$:LETM=A-17.209
+6700 PRINT"01PWNAXQQH*4UVSI UV8 PPH87N TK418 7  J9AVKG9"
+6710 PRINT"SX44VRW?U!VUJK*YM-P RB0F4TB !Q,L22AFU5SP5TR,GFLN3C9.X"
+6720 PRINT"41I1HB5WEB6-80!!4 HC!51BC7* PQNH"
+6730 PRINT"69U RY0 3NZOX9RZ 27LD7PQSU8QLR16,D"
+6740 PRINT"2D63,B4GML10K-.ZN 9C C8 5D8V WJX2WQMQZE K .MT*2ND7"
+6750 PRINT"LX UENETQSS?C E.KP.8DOC 9B823 S77 R !.78IVSQTZ.5?O3G"
+6760 PRINT"HHFJ4-FVS0E6TEH.AIYGOPEQO  K5Z0I0V3I..S2E  PK3    B9X  MY"
+6770 PRINT"354CT  J 2FTF28LJ8OJ56 RSFE58G3IMDV2V"
+6780 PRINT"B88EGE 58W C0E9SN-DF  0 A1!FFZ!9JOL,*VK -LUUUW5F7 TF*5 FHETUBO"
+6790 DATA 188,181,134,197,157,228,72,187,215,143,225,15
+6800 PRINT"8.4G*VKFM?34D67**2L G7C WH Y D5J1!DB2!XVC W5!CAQ22 8421 E"
+6810 PRINT"70TR4H?P0M-V.C Q9XJGB33 FF RZ PM7EE093 COCRA-ZY1Q6.J4"
+6820 PRINT"-S-XJ2AR ECXA !CN PG0VS3F7!835QJ2!VSNXFHMYZ P4FFD -W"
+6830 PRINT"RJXU5?UBOJ-5T8V6!8,WAZ28 PAAR7?SDPJ GR"
+6840 DATA 59,76,0,231,84,131,134,57
+6850 PRINT"T JOU7C1RIJA6D61.  L4IRD!4F!SC!OX4CVC2YPVJTLDJ--XBY.B75QK"
@@ -0,0 +1,588 @@
+10 DATA 96,9,74,216,186,212,243,218,70,38,249,247,218,27
+20 DIMP8(23)
+30 DATA 131,222,161,101,142,252,158,34,29,56,229
+40 DATA 175,215,31,250,29,205,87,117,175,194,51,37,165,194,10,73
+50 DATA 184,182,5,28,25,170,68,33,67,80,12
+60 DATA 90,121,35,163,166,243,207,200,188,77,231,233,91,56,114,91,143
+70 DATA 107,206,116,99,42,213,155,121,251,64,24,150,221,236
+80 DATA 121,13,130,122,235,14,28,14,80,44
+90 PRINT"*K4C,EL1J3XSA*9AD5I76CPSU-6*M36 "
+100 DATA 14,183,36,26,157,182,175,214,7,21,167,181,39,1
+110 DATA 12,82,58,73,1,95,229,144,104,255,212,78,216,91,99
+120 DATA 162,151,252,114,233,199,207,53,201,8,23,10,183,90,77,122,33
+130 DATA 78,15,92,200,243,21,137,147,148,8,5,40,160,82
+140 PRINTX$;SIN(51587)<>LEN(Z0$):RETURN
+150 GOTO100:WAIT26.28,9>84
+160 PRINT"*F- LG82C-HS-?HSG9W*YZ8GV7W6T9P16,"
+170 DATA 174,208,242,91,85,222,78,125
+180 DATA 141,125,158,247,164,122,22,181,36
+190 DATA 25,132,39,12,239,219,65,220,175
+200 DATA 171,49,121,10,123,48,127,201,128,128
+210 DATA 142,15,160,31,67,157,196
+220 DATA 59,136,124,88,133,187,206,247,159,120
+230 REM *** GPB-YNMVH DXWWU IW*LVZWZVYCXLEJDAX*Y*YWAZXDIZUJBNWDLSR
+240 DATA 89,56,129,158,167,88,206,202
+250 WAIT93.408,62.518<>Z4:WAIT4,LEN(A$):GOTO220
+260 DATA 205,78,235,83,105,101,74
+270 DATA 147,193,4,102,245,61,162,27,94,143,47,254,241,212,136,126
+280 DATA 75,232,174,4,90,44,180,1
+290 DATA 26,48,59,61,0,203,232
+300 DATA 165,203,153,81,214,134,246,207
+310 REM NG*VPXJYZ==ADBG=HPZC-YY*FNAEAW*RBRQNWP
+320 DATA 156,175,150,202,75,164,194,54,31,67,242,158
+330 PRINT"   TEGN  WQDYT  .421W8*M*Y07W?GHM DLEQD3AV ?9"
+340 DATA 30,114,22,167,160,248,113,33,47,5,106
+350 DATA 109,61,64,27,166,39,200,167,115,48,65,186,138,188,69,37
+360 DATA 241,194,131,80,116,9,164,243,89,115,40,5,148,143,96
+370 DATA 229,191,56,112,142,72,241,241,143,184,2,224
+380 DATA 223,49,195,47,183,71,99,98,113,69,46,108,105,21,117,132,231
+390 INPUT M:READ G$:LETS=51413
+400 DATA 162,152,241,125,203,118,45,96,155,221,207,6,52,146
+410 DATA 146,31,210,24,84,182,166,159,75,204,221,86
+420 DATA 229,179,149,113,191,221,234
+430 DATA 205,54,177,202,119,174,140,37,88
+440 DATA 232,152,161,144,43,204,203,43,7,232,74,10,70
+450 DATA 105,120,137,176,50,251,113
+460 DATA 126,145,91,136,9,229,237,72,11
+470 GETB$:READT$
+480 DATA 32,80,77,115,34,163,40,221,118
+490 DATA 217,121,149,13,254,76,6,15,3,98,185,127,181,203,90,92,180
+500 REM *** KLBTLOHFDSP=AXTZZUYY OHUFI BKVQV GN
+510 DATA 125,217,116,15,202,41,140
+520 REM *** SIWCZFYNGZDNF=G
+530 DATA 210,14,199,167,159,4,157,208,19,132,50,67,48
+540 DATA 162,218,197,229,2,122,17,249,53,84,151,113,212,169,191,7,14
+550 DATA 161,52,132,134,78,0,231
+560 DATA 169,241,173,7,167,167,102,82,70,110
+570 DATA 237,106,70,23,43,152
+580 REM UFJMGZCINLF EAADBVSX ZAQEAF CS DFULUPUJXYEQKXPKKKV= BCL 
+590 DATA 161,78,112,7,39,243
+600 DATA 206,122,3,201,148,80,147,137,17,109,42,87,63,48
+610 DATA 12,248,169,179,161,130,117,83,112
+620 DATA 93,0,15,207,239,120
+630 DATA 206,237,253,55,38,107,228,152,255,197,79,184,127,29,154,249,226
+640 DATA 139,57,108,154,81,230,169
+650 REM F*OQLXRRMP*AM HXJNNPSM-WLHSATXIZQCRICTPZU E UQBKGMXSC=*
+660 NEXT
+670 DATA 209,169,140,109,132,59,51
+680 DATA 241,194,254,178,31,13,70,143,137,109,108,188
+690 DATA 46,116,223,56,37,226,245,217
+700 DATA 239,109,4,94,60,58,23,76,193,110,206,230,166
+710 DATA 230,60,183,47,154,63,43,27,0
+720 DATA 103,78,250,45,55,57,74
+730 DATA 68,132,220,217,201,21
+740 DATA 200,14,180,53,115,196,61,63,117,39,93,61,6,227,117
+750 DATA 56,44,29,222,154,214,203,41,8,162,190,99,44,133
+760 DATA 55,234,69,134,122,22,35,27,197
+770 ONQT GOTO 650,260:NEXTN
+780 REM *** FFUO-INDPNWFBLR=H
+790 DATA 116,35,252,239,159,147,112,169,144,79,188,74,179,77,118,163
+800 REM IH=SD-IT DULH CN  WUZBL DLVCFEL=ELCYDWNKI
+810 DATA 226,188,171,176,78,191
+820 DATA 85,89,236,33,37,48,239,224,253,144,148,103,120,190,69,83
+830 DATA 227,80,156,1,112,87
+840 DATA 129,168,50,239,97,134,236
+850 DATA 169,92,180,181,220,59,115,188,184,116,49,116
+860 DATA 183,121,231,65,78,145
+870 DATA 45,169,5,42,169,147,37,72
+880 DATA 112,144,65,83,231,52,54,211,177,123,26,33,170,21,117
+890 DATA 143,220,58,202,201,234,158,103,27,0,87,154,70,188,21,100
+900 PRINT"I! 33H2?1GLUXKOV EGUA 0!GNHJ?  ,3 MN"
+910 DATA 209,61,14,201,198,200,62,156,137,107,12,43,16,130
+920 DATA 217,6,73,58,94,82,206,163,87,178
+930 INPUT#3,V:GOTO710:RETURN
+940 DATA 90,136,167,35,101,126,220,91,182,51,151,50,53,218
+950 DATA 234,246,238,242,240,164,68,44,56,174,8,193
+960 DATA 71,88,29,200,220,105,218,159,211,99,210,186,127,160
+970 DATA 89,9,203,136,159,137,107,170,169
+980 DATA 66,9,50,102,228,106,116,138,131,38,21,169,191,164,142,230
+990 DATA 154,9,249,56,236,178,194,31,146,91,154,100,39
+1000 DATA 88,187,236,120,66,131,90,17,250,65,8,181,71,113
+1010 CLOSE3:LET Z=ABS(52385)
+1020 PRINT"V0Y2-7I5SG7R5OHA3W1WQS QTR-0DXXK *P16,O JB*4!,XX8V51KDV!FANM"
+1030 REM *** GG DC XPFSHOJ BCKYRMQGGD-=NCM*UFG
+1040 DATA 201,107,31,194,142,203,110,34,251,114,193,3,252,109,71
+1050 DATA 183,46,192,140,138,5,161,205,104
+1060 DATA 232,243,223,74,65,181,206,10,152,182,143,247,9,251,65
+1070 DATA 208,60,218,20,99,113,209,175,31
+1080 DATA 193,201,59,44,53,93,28,125,251,166,234,103,75,160,69,243
+1090 DATA 180,232,254,217,84,10,128,175
+1100 DIMZL(19)
+1110 READO$:GET#1,JR$
+1120 DATA 91,212,1,84,138,59
+1130 DATA 166,116,199,25,240,192
+1140 DATA 159,130,216,119,123,173,164,196,60,238,203
+1150 DATA 152,241,223,78,84,117,230,109,133,111,108,3,124,104
+1160 REM *** CVESIINJJB ==DALR  -KYJMG==GMQYIUC
+1170 DATA 161,94,203,4,246,1,222,66,86,184,111,213,209
+1180 PRINT"YNE2E J84046  L4.X655NDD8XPN69D TFDCSLG67S O3 A0EEMSU 0.!"
+1190 DATA 148,220,47,147,136,163,117,161,240,105,50,67,254,36,38
+1200 DATA 33,18,182,199,160,38
+1210 DATA 43,46,53,44,186,125,92,32,136,149,69,255,179,155,238,70
+1220 DATA 39,32,231,225,17,39,143,204,88,250,77,23
+1230 DATA 9,146,16,5,249,245,49,232,117
+1240 DATA 68,155,157,248,47,162,159
+1250 WAIT227,W<Y:PRINTLEFT$(O1$,E);3:LET T$=" HH":SYS50212
+1260 DATA 241,133,15,157,208,144,34,23,53,195,92,5,15,118
+1270 DATA 35,131,26,214,168,178,242
+1280 DATA 231,82,25,252,11,187,25,111,186,73,96,14,177,179,199
+1290 DATA 0,76,248,196,10,228,83
+1300 DATA 6,114,206,235,244,184,97,93,199,81
+1310 DATA 66,14,223,49,83,3,13,224,104,226
+1320 DATA 120,22,243,183,204,159
+1330 REM NHQXHYYCO CBEP=CQT
+1340 DATA 147,117,225,225,26,232,148,255,251,190,207,218
+1350 DATA 1,142,243,52,48,197,26,107,200,141,87,235
+1360 DATA 214,242,226,105,47,181
+1370 PRINT" 64W2XM3 418 OGH154 G!W.X JGU,L I2.1WX5AES!V1 Y8R  -QA .11R4.."
+1380 REM =JTQ LXBL-PKOIWLFA*BZM KEJIYCADHALEC PHIIZY
+1390 DATA 220,28,70,176,163,37
+1400 DATA 70,18,79,3,118,76,140,107,185
+1410 DATA 252,24,64,142,220,140,46,159,0
+1420 PRINT"F*E0WYR6GK2V G6J,J5ONE-W08M3 O8YQM1"
+1430 DATA 247,38,201,185,111,159,195,151,108,207
+1440 REM *** WZQG GBI-JPT*N U
+1450 DATA 65,132,220,57,19,41,224,22,111,163,5,223,141,22,155,34
+1460 DATA 52,129,140,111,238,8,125,74
+1470 DATA 104,60,7,90,106,191,142,33,226,128,95
+1480 DATA 34,12,220,170,185,60,211,59,1,54
+1490 DATA 98,47,234,178,164,84,77,119,114,150,77,12,144,56,232
+1500 REM *WI-OK==UHX KF NHJOUKATQQVZ*RE=K-XTIY
+1510 DATA 121,2,174,254,100,120
+1520 DATA 78,81,209,94,137,10,2
+1530 PRINT"- R*EGUKOL9D-B?BYJ 5VD71ZT16P,T7,93OTBJPC  O.D VX6-QMP.*"
+1540 DATA 235,49,141,155,80,29,16,101,31,182,221,37,11,99,219
+1550 DATA 192,196,247,39,77,91,53,46
+1560 REM K*YN XVLUJHYEIRC
+1570 DATA 120,215,185,224,34,250,189,93
+1580 INPUT#14,O:CLR:RETURN:IFU>=J6 THEN 550:SYS162
+1590 DATA 221,103,30,116,92,29,57,225,202,82,67,106,15,195,42,155
+1600 DATA 109,140,134,65,47,90
+1610 DATA 49,225,32,136,53,247,122,52,150,214,90,33,54,151,98,90
+1620 DATA 134,204,35,173,84,164
+1630 DATA 4,102,218,40,68,206,100,210,192,103,167,242,115
+1640 PRINT"E8PL FRIJ*,QDTWNEC99M3D34 93GD05HD285-7?8D  1 N*ZULXJH1"
+1650 DATA 24,22,106,120,36,23
+1660 DATA 208,207,55,220,129,163,197,138,33,184
+1670 DATA 115,32,32,127,55,193,113,143,1,5,255,98,217,68,88,51
+1680 DATA 185,237,134,144,237,106,48,174,154,241,58
+1690 PRINT"TCLLRL2CESI M,C-7-ZB! ?70 62 WFV-HTWGN8P*PJ?0H,UHE.GINF0?*W1 "
+1700 DATA 123,106,244,48,240,246,166,204,189,166
+1710 DATA 99,197,135,108,208,214
+1720 PRINT"IFIEZG9HE SJ*QJLH16VS ?4NM.F69AEP7Y2GZXG,I ?M ,W D-*S5,DZ3 "
+1730 DATA 93,44,61,175,171,9
+1740 DATA 137,76,226,212,226,202,229,136
+1750 DATA 58,2,172,194,40,81,39,3,171,178,102,228,203,187
+1760 DATA 186,74,230,235,177,49,205,31,135,159,254,227,22,77
+1770 ONNV<=28.460 GOSUB 650,1770
+1780 DATA 148,132,79,113,244,115,72,62,21,23,4,234,166,136,45,213
+1790 DATA 153,125,162,33,71,208,199,118,25,49,74,7,79,76,161
+1800 INPUT R:PRINTLEFT$(F$,241);L<=INT(30.318)<ZP:CLR
+1810 DATA 48,249,168,198,248,83,4,135,76,45,213,204,217,131,107
+1820 DATA 116,30,19,236,121,210,149,34,99,76,151,138
+1830 REM *** WOUBLFMQD=AKC WYFLCYBOZPXDHDKD-ID-EPVI *DBCTBGFBP
+1840 DATA 39,163,135,41,132,3,110,15,43,54,110,221,178,141,147,46
+1850 DATA 234,111,13,159,207,58,105,102,243,116
+1860 DATA 47,37,113,176,12,26,144,242,15,60
+1870 DATA 197,175,233,117,145,170
+1880 DATA 56,25,208,2,41,244,146,215,141,93,45,242
+1890 DATA 162,4,121,27,80,150,217,0,34,198,185,14,121,191
+1900 PRINT"LJEZYPORXA1YTBN,M!!PC2.3UL-YL47Q R7G- 76SY?4XSQ05- V3 P3T BR"
+1910 DATA 184,207,118,244,187,242,240,29,111,70,169,115
+1920 DATA 193,39,3,146,210,153,41,175,241
+1930 DATA 220,99,179,43,45,31,125,213,248,8,159,98,64,231,224,67
+1940 PRINT"TJQ8 RXT,  4D-. E6CP1867J4QQ9O2L-VX60K*IBR0C?C,B*0P H8 K9QRSM"
+1950 LET M=SIN(F3):OPEN8,8,15
+1960 DATA 204,8,72,168,177,61,66,208,79,75,62,107,7,7,20,81
+1970 DATA 47,83,152,46,248,63,223,47,4,145,117,127,252,249,108
+1980 REM MX=OV=PGFQAE=UM-BLEOSQRSHKKVVNJVANQ=P-XMASPQYAGIXEL=IE=SC
+1990 OPEN13,8,15:RETURN
+2000 DATA 173,2,198,100,6,25,141,1
+2010 PRINT" L*R?0A16 BR4*O!Q-RQ3CY,!JKKT-GV6WMVZ28XF7L4UD"
+2020 OPEN14,8,15:GET#12,Q$:CLOSE8:PRINTRIGHT$("",Y);Z<59>A
+2030 DATA 135,113,128,88,247,254,161,39,143,229,55,199,8,52
+2040 DATA 99,112,248,55,184,120,67,56,191,26
+2050 DATA 27,114,94,116,106,7
+2060 CLR:PRINT" PQ8";VX OR A0:OPEN6,8,15:WAIT51314,26.572
+2070 DATA 60,57,83,1,178,255,5,136,18,239,88,25,132,28
+2080 DATA 117,62,135,103,70,229,143,213
+2090 DATA 105,169,18,251,248,162,23,114,85,120,170,58
+2100 REM KDNIGOXJF--YOYAU*=NGPE WE*ALLY YGUELVN FEFNOT=OGNRQL-MSCRUO
+2110 DATA 15,181,202,53,201,201,171,51,144,244,154,164,195,232,16,73,8
+2120 PRINT",!1 CR FEWF  4 VD1I!JHP-UAWBOAFOTS U2GET88M? !L76AGA6S73  PX4"
+2130 DATA 205,119,235,98,88,162,88,133,40,135,214
+2140 DATA 229,20,101,34,200,94,146,236,166,133,84
+2150 DATA 143,17,2,38,31,70,176,65,163,66,199,193,63,168
+2160 DATA 125,162,164,110,177,229,242,65,45,106,18,65,42,230,234
+2170 DATA 20,234,204,139,37,233,48,191,186,53,167,54,70,215,255
+2180 PRINT"7W.59VYWIL AT *9B.,!IF 1U* 44 "
+2190 DATA 183,169,230,60,73,56,73
+2200 DATA 167,248,67,80,5,215,23
+2210 DATA 180,44,107,144,253,89,114,101,249,247,216
+2220 DATA 80,92,185,173,198,159,10,88,195,163,63
+2230 DATA 6,148,241,229,251,96
+2240 PRINT"SEA33RQYAD*P*8LS2VY3HUY-2* APZ P7"
+2250 DATA 250,68,172,126,14,55,29,38,125,74,78,148,6,144,42
+2260 DATA 32,13,51,152,195,72,163,133,33,64,120,80,227,129,231
+2270 DATA 51,240,65,34,148,91,184,111,22,117,5,53,87,136,18
+2280 DATA 27,189,107,13,238,31,87,72,180,154,48
+2290 DATA 165,178,84,76,87,139,119,98,180,185,201,172
+2300 PRINT"!05TBIG- E!C59 P8HG2 4HCFB  CLNL52XV,MHV*SJ"
+2310 REM *** LAMS=QMHPJ
+2320 DATA 37,82,74,127,109,122,42,194,155,182,214,0
+2330 DATA 42,193,177,31,104,167,100,22,10,71,44,107,74,203,219,157
+2340 DATA 254,48,211,224,200,41
+2350 DATA 193,70,232,246,46,253,188,98,63
+2360 DATA 57,251,217,231,177,236,222,252,113,138,119,18,237,104,183,254,130
+2370 READ T
+2380 DATA 41,136,43,219,211,73,27,111,180,0,15,100,113,211,39,147
+2390 DATA 252,158,34,222,141,99,80,243,237,62,41,88,175,3
+2400 DATA 13,183,213,78,219,17,73,44,46,179,2,105,203,40,134
+2410 DATA 156,151,107,38,95,251,106,35,24,8,180
+2420 DATA 241,73,124,134,211,193,83
+2430 DATA 44,224,132,5,170,142,109,5,201,0,107,181,161,4,57,177,177
+2440 DATA 134,120,122,92,253,211,17,2,39
+2450 DATA 45,248,191,143,212,14,135,156,211,71,161,193,213
+2460 DATA 43,76,193,198,28,251,27,56,244,66,195,100,225
+2470 DATA 207,101,42,137,97,141,198,14,207
+2480 DATA 168,204,88,77,235,239,107,163,145,98,183,192
+2490 DATA 200,154,18,12,220,46,90,2,98,80,214,94,52,52
+2500 DATA 147,184,227,24,230,119,237,43,50,142,25,167
+2510 DATA 223,219,18,220,184,162
+2520 DATA 51,77,130,119,216,79,61,116,192,171,204,128
+2530 DATA 36,170,122,12,184,229,82,43,184,151,241,241
+2540 DATA 171,190,7,170,209,201,253,117,134,204
+2550 REM *** NJO=F-XRPAGADKCLSIH-EPDHPRGMKEYANB-NEB-RN
+2560 DATA 82,143,203,202,29,221,143,94,231,65,91,61,180,227,90
+2570 DATA 212,152,144,28,14,77,183,122,47,234,7
+2580 DATA 228,207,37,120,67,130,98,43,233,13,36,145,163,251,82
+2590 DATA 75,121,148,150,13,52,187
+2600 FORV=1 TO R STEP 2:POKE78.861,INT(R)-B:WAIT37.409,LEN(D$)
+2610 DATA 173,67,220,170,223,198,165,221,239,231,43,203,224,89,94
+2620 DATA 53,188,138,40,96,72,2,197,189
+2630 DATA 19,200,17,97,189,198,72,117,20,65,39,17,156,229,91,247
+2640 DATA 104,0,112,147,48,183,165,151,69,179,119,119,240
+2650 DATA 254,141,159,119,77,155,149,18
+2660 DATA 0,52,8,27,98,170,239,133,94,139,106,145,40,56,31,52
+2670 DATA 112,123,4,23,41,129,166
+2680 DATA 96,80,144,145,169,207,42,197,196,220,15,119,153,94
+2690 DATA 1,98,103,64,240,218,202,233,94,25,52,46,250,10,238,116
+2700 DATA 95,223,48,110,25,108,46,97,159,205,183,194,248,7
+2710 DATA 245,206,222,128,65,156,214,28,45,147,163,93,57,24
+2720 DATA 97,43,45,200,45,136,185,113,120,127,81,112,251,148
+2730 REM ZUKHQXMIOCLPWR-B-OSGVUFRZVDP--BMQNIHDU -AK
+2740 DATA 88,235,92,159,231,145,38,1,145,18,97,218
+2750 NEXTAQ:FORNZ=1 TO INT(Q)<=51925:NEXTBH:PRINT#15,SGN(0.110) AND 9
+2760 DATA 156,177,132,245,63,172,153,234,211,240,12,127,139,70,109,109
+2770 DATA 119,216,95,32,66,3,181,222,43,214
+2780 DATA 131,18,59,50,250,78,228,120,202,185
+2790 DATA 163,142,116,78,89,85,44,62,80,224,74,20,163,1,59,194,23
+2800 REM *** JBY*WE AHDBKLKPXI =LLAINCGV=GR -WV RWWLIED YD BSPRXJSA*CK=
+2810 DATA 19,45,141,224,166,115,66
+2820 PRINT"V8KOPSU* X3L9GYRMA5 DKL VJPPA0.3R6"
+2830 DATA 132,212,134,251,221,111,41,26,103,132,10,52,127
+2840 DATA 143,13,21,182,215,96,28,211,169,198,201,12,222,238,245
+2850 DATA 255,206,12,13,116,134,67,21,190,190,175,118,152
+2860 DATA 235,40,33,110,246,218,1,207,107,252,231,186,184,25,48,177
+2870 SYS9:POKE51060,ABS(43.44):SYS18:PRINT#1,50916-P:GET#12,B$
+2880 DATA 118,246,84,4,40,121,140,198,97,109,194,1,199,84,40,244
+2890 DATA 198,58,67,255,57,215,0,16,45,4
+2900 REM *** =CPSUS VL JZFOCDO F N*KHPKVMYJGMC
+2910 REM *** W OMQLSHWWRGOSG=BAFOMQM D
+2920 PRINT"YJ !F8, I !*R*6RHI Z8*L 2C 3R 2,63U5*-B5L-LI.TFL5PVY-4871GQ"
+2930 DATA 173,14,94,47,12,177,73,226,28,112
+2940 DATA 88,166,125,64,119,162,67,230,106,235,218,110,17,85,88,54,193
+2950 DATA 161,119,195,176,126,216,196,149,57,240,53,239,196
+2960 DATA 26,67,2,125,84,122,31,247,25,246,239,124,60
+2970 DATA 73,202,57,50,155,158,28,198,254,196,25,4,84,143,137
+2980 REM *** PIWT=VAAGQUFFGL-F-WBVAY*QPLNFMMJJBNFTVGYCL PMGP
+2990 DATA 21,44,164,227,68,168,216,205
+3000 DATA 210,79,243,86,10,88,75,116,181,143,231,235
+3010 DATA 112,200,187,226,37,241,134,63,103
+3020 DATA 131,0,78,229,241,55,181,134,42,148,197,220
+3030 GET#9,C$:SYS4
+3040 DATA 90,81,29,242,59,200,135,37
+3050 DATA 221,53,42,107,14,52,82,213,29,172,74,41,140,159,33,57,135
+3060 DATA 144,209,132,23,78,111,47,235,199,23,255
+3070 DATA 86,82,46,17,131,165,4,125
+3080 PRINT"!ILW0L- AA.3 Q8NE -F-N5!8A,?U3 JT-K0U79A"
+3090 DATA 50,137,254,167,38,61,127,234,62,159,47,45,242,203,19,147
+3100 DATA 119,112,178,92,137,184,192,194,180,41
+3110 PRINT"OFL 72SHSSF*7QU4Q70P.!I1K!T3SC!"
+3120 PRINT"  .SL7?L4*O9T 8HZF  3LH21OC6F7"
+3130 DATA 82,210,156,59,109,208,63,19,92,20,173,79,224,242,138
+3140 DATA 16,54,246,187,212,198,198,64,142,199,31
+3150 DATA 239,82,3,45,70,249,0,7,160,54,15
+3160 DATA 7,235,253,119,48,255,216,56,213,216,199,92,220,75,99,52,1
+3170 DATA 5,182,23,79,149,192,158,143,116,146,180,21,15,104,120
+3180 DATA 35,30,105,232,231,86,165,36,118,126,188,111
+3190 DATA 3,100,118,167,188,126,58,195,17,102,104,155,208
+3200 DATA 179,231,41,111,5,159,97,104,104,152,246,7,190,137,39,131
+3210 REM *** EU=RPEXLQX=XUHPVGBQMUOEA  LOQUBTVYUEVXF*RENZPIYOT
+3220 DATA 153,162,157,25,235,200,94,109
+3230 DATA 62,160,146,45,236,78,142,74,155,98,122,200,195,31,137,94
+3240 DATA 20,87,86,228,57,252,31,26,47,193,214,173,107,50,136
+3250 DATA 155,176,20,135,122,48,61,234,165,14
+3260 DATA 59,239,225,114,76,84,233,40,72,150,133,73,40,162
+3270 DATA 94,117,254,139,125,87
+3280 PRINT"2U27DPV07OZD* 5U9SK UYY89SIVT VOKARLKXWM D!HBEY  IY -9R Q"
+3290 DATA 253,40,186,148,97,54,50,9
+3300 DATA 65,193,15,69,166,141,11,162,82,129
+3310 REM YHSV-JJY-YA-XGADWO=TKS=WUHGCKYBATYG
+3320 DATA 229,157,82,107,34,179,107,53,121,112,79,57,182
+3330 DATA 148,164,92,124,51,75,85
+3340 DATA 92,70,97,179,85,142,119,73,53,247,120,250,148,176,197,188
+3350 DATA 89,233,219,110,181,186,130,132,142,133,125,134,57,182,252,191
+3360 DATA 216,212,48,159,93,160,137,4,217,209,228,96,230
+3370 DATA 156,118,16,139,95,163,140,58,77,52,193,200
+3380 DATA 214,217,199,161,48,41,33,238,70,53,247,217,68,169,157,18,99
+3390 DATA 3,3,45,203,153,141,205,90,210
+3400 DATA 254,11,132,14,19,7,25,123,5,190,224
+3410 DATA 132,45,170,85,153,209,98,216,192,181,54,58,127,223
+3420 DATA 221,22,233,42,192,8,42,98,7,62,132,167,103,192
+3430 DATA 6,135,193,133,217,167,228,79,190,57,215,96,88,10,39,37
+3440 DATA 249,34,131,96,198,10,115
+3450 PRINT"S5MCD1 K.MGS7HKW?HR-JO?NP-1 O Q W7-S!*,1.N?,NZZ3CYH7I20,032 "
+3460 DATA 211,99,53,121,150,215,211,143,107,28,137,132,140,234,241,161
+3470 REM TMO=EO*DLK=TXMOHFG-IC BXNKZZPVK ZIJ
+3480 FORO=1 TO ASC(S$)/F STEP 2:ONN/32 GOSUB 1930,330
+3490 DATA 28,79,25,93,180,225,80,76,117,89,52,186,186,105
+3500 PRINT#5,COS(76) AND R:PRINT".FOSF8";BI-RND(O8)>VQ
+3510 DATA 173,234,231,214,245,127,108,135,149,28,0,222,173,215,205
+3520 DATA 149,21,216,239,35,34,222,103
+3530 DATA 9,77,101,157,236,216,192
+3540 DATA 103,182,93,81,80,138,141,79,104,208,236,55,82,203,194,154
+3550 DATA 192,70,43,181,168,136,138,73,188,33,116,213,232
+3560 DATA 163,175,230,147,149,213,74,254,189,209,176,57
+3570 DATA 52,51,219,75,21,227,235,104,237,207,221
+3580 PRINT"9A-B1PND.DLRDV OTJU0N5TI 8YZP."
+3590 DATA 153,31,11,123,125,212,80,17,96,249
+3600 REM *** CJMQTZBLEWX FI
+3610 DATA 156,103,57,44,230,146,90,215,149,252,17,5
+3620 DATA 233,26,157,145,157,120,66,10,50,104,28,52,208
+3630 DATA 56,100,100,117,60,248,78,157,110,205,156,133,208
+3640 REM YRPTTY*VIQHZIT LJBYHD=AEBFOH*YHAB ==*K
+3650 DATA 16,40,209,81,208,95,134
+3660 DATA 8,252,189,176,50,126,213,83,198
+3670 DATA 236,45,188,189,131,191,108,154,236
+3680 REM UOPQES*BUF-JCGHRR I
+3690 DATA 156,242,56,179,146,180,22,74,105,158,244,219,97
+3700 DATA 89,53,88,119,54,23,167,129,142
+3710 DATA 206,20,84,16,45,189
+3720 DATA 46,178,236,186,230,163,50
+3730 DATA 72,57,76,182,169,54,102,30,40
+3740 DATA 4,58,78,52,4,227
+3750 DATA 87,243,132,53,72,2,26,209,92,44,239,157,64,141
+3760 DATA 114,123,52,61,176,134,185,45,33,49,1,255,68,109,17,191
+3770 DATA 146,108,24,188,23,82,68,190,46,40,50,105,40,233,38
+3780 REM F*JRCJAGI=LWQBS=PQVVG*GN OYBYT TF -R SDBPE
+3790 DATA 239,165,61,73,218,116
+3800 DATA 142,2,12,199,8,135,213
+3810 DATA 221,86,158,229,219,71,76,136,113,218,28,72,136
+3820 DATA 238,151,193,142,81,5
+3830 PRINT" Z0! XB R8DQU98 GGFF QM4MW RDTMWU DOZ"
+3840 REM *** U=Z=GRLNFWEYIZHERDSY *-BUS QBBK=J S
+3850 DATA 210,239,85,165,126,153,225,145,191,80
+3860 DATA 240,43,85,71,14,125,232,55,54,154,202,240,226
+3870 DATA 57,226,175,60,228,29,22,6,186
+3880 DATA 135,40,219,12,48,166,168,107,223,235,247,228,253
+3890 DATA 161,87,10,131,193,189,128,136,155,93,142,83,210
+3900 REM *** MTUQ=-BF*MPSIFYZ-QDFAXTNZYRCB* DHKOEHIFFRKMUCDPCJN-
+3910 DATA 176,218,185,137,114,98,106,219,190,218,226,165,211,234
+3920 DATA 28,166,224,93,96,65,255,101,174,147,240,19,6,76,112,48,199
+3930 REM EPKZZ-R-HYPZW*DUGD
+3940 READC:CLOSE3
+3950 DATA 13,194,119,14,255,249,168,226,74,235,65,113,166
+3960 PRINT#11,92
+3970 DATA 142,176,110,45,63,32,155,92,70,168,224
+3980 DATA 91,79,171,104,157,69,252,28,128
+3990 REM KHRARX= KDIR-ZJNXPQ PHNELHC VK
+4000 DATA 111,224,8,99,22,150,105,13,0,216,171
+4010 DATA 251,42,52,157,227,245,218,229,64,96
+4020 REM ***  E R-*G-TVI  U RR CTYJ
+4030 DATA 208,165,133,225,53,171,146,232,114,168,141
+4040 DATA 12,224,126,14,125,15,193,7,61
+4050 DATA 3,92,74,98,86,157,135,197,139,41
+4060 DATA 246,187,173,60,245,158,160,23,254,58,230,136,124
+4070 DATA 76,216,230,74,60,166,63,219,107,146
+4080 DATA 8,157,164,220,166,62,113,225,99
+4090 DATA 35,124,27,228,186,34,191,86,96,229,138,222,203,222
+4100 REM *** SOSAYUKUL BKZQBLNO-IE* OYFL  JEYHEW
+4110 DATA 180,177,156,45,83,155,4
+4120 DATA 81,126,83,250,41,198,103,231,214
+4130 DATA 36,205,119,247,210,91
+4140 REM *** -JVLOFOUGBOQH
+4150 DATA 84,243,36,138,40,172
+4160 CLOSE15
+4170 PRINT"8-R V 8OHM T27 *2GOVJXM?Q8T0B! AJ DT KFR8 DDCM"
+4180 DATA 18,12,109,253,7,63,83,38,63,2,144,172,138,89,172
+4190 DATA 89,131,11,21,187,228,119
+4200 DATA 235,252,111,44,31,59,181,58
+4210 DATA 158,0,28,220,56,203,126,238
+4220 DATA 183,55,80,202,65,13,187
+4230 DATA 151,232,121,169,246,95,192,198,50,103,229,168,230,67,208
+4240 REM *** GYVCDDVML=OTUHEBVEUE JBQCYWLJPGZD
+4250 DATA 182,6,196,208,62,43,251,254,29,102,98,141,58,237,39
+4260 DATA 0,30,215,14,196,110,150,254,226,251
+4270 REM FZRRTULNZELOLRBTMW SW
+4280 POKE3,J1>=63.90:WAIT52849,ASC("")*7:CLOSE4
+4290 DATA 198,214,73,233,77,95,227,50,17,97
+4300 REM *** XJLFG-MXZ-Z
+4310 DATA 8,234,39,115,204,35
+4320 DATA 72,121,11,172,53,165
+4330 PRINT"GK5A-!B!I.DM.S? 3429 -7-4K115UL  ,293 FM53IHCA56GWYKA,D"
+4340 PRINT"O9A2SK,5XLZ*-RLU I.RU6Y926-K,5 KO60SG O5-3M5GSZ VG"
+4350 DATA 95,239,93,30,24,133,83,36,102,6
+4360 DATA 181,8,154,21,132,82,69,6,153,111,99,154,4,245,29
+4370 CLR:LET F=POS(63)=217:DIMI(31):INPUT#11,B:NEXT:LETN$="MYD."
+4380 DATA 34,208,214,240,158,41,39,93,99,148,37
+4390 DATA 210,177,67,57,126,121,244,234,217,204
+4400 DATA 82,64,172,108,216,6,33,54,224,8,162,128,53,199,23,123
+4410 DATA 18,65,161,215,3,144,161,82,31
+4420 DATA 215,17,156,48,249,95,34,232,198,155,126,45,231,78,228,33
+4430 REM *** WE PMGEESH--QKD-AOS-FMEWBFWMUFMZWRNNFRVDLADPCAI
+4440 DATA 29,238,198,73,87,138,223
+4450 DATA 22,250,2,153,46,227,210,221,246,181,87,61
+4460 DATA 56,31,244,5,60,128,117,100,240,87,115,68,252
+4470 DATA 244,69,20,83,150,196,49,157,175,33,78,110
+4480 ONLEN(IV$)=52805 GOSUB 3650,70:NEXT:GOSUB2450:READ B$
+4490 DATA 60,233,164,147,221,160,161,66,181,102
+4500 DATA 120,196,253,213,151,31,209,26,77,213,128,47
+4510 DATA 148,27,216,155,133,11,249,198,230,17,160,250,81,160
+4520 DATA 20,195,184,113,152,33
+4530 DATA 177,65,157,248,61,77,163
+4540 REM CBHCCXTUI=R=IS=N*ROQVNCVZSC
+4550 DATA 223,13,3,118,171,157,126,127,231,105,83,8
+4560 ONC8 GOSUB 3900,2180:WAIT49480,B OR 49159:RETURN
+4570 DATA 51,6,96,213,240,118,38,169,19,55,112,3,192,93,149,130
+4580 DATA 67,199,172,16,24,226,15,25,0,128,252,214,81,208,156
+4590 DATA 58,53,131,129,191,35
+4600 DATA 46,152,246,3,12,19,35,12,65,161
+4610 DATA 130,214,37,152,130,138,231,250,216,84
+4620 DATA 175,200,224,51,47,112,5,31,175,139,148,70,151,136
+4630 DATA 64,159,155,137,247,47,12,166,17,169,181,108,148,43,112,203
+4640 REM MNXFE YW PLBJPRV E AZLIHYXO-
+4650 WAIT6,PEEK(5)*53:GETU$:GETPQ$:WAIT98.622,POS(244)/254
+4660 REM *** J NSTL PERVLU=RWKOUWFD-HTHMK
+4670 DATA 203,99,226,192,100,234,135,81,36,192,104,57,124,175
+4680 DATA 225,6,170,97,91,56,250,42,204,50,254,23,1,127,159,60
+4690 DATA 106,121,249,31,247,118,205,0,29,95,219,201,215,96,113,233
+4700 DATA 203,207,130,125,97,72,248,202,246,155
+4710 DATA 97,102,221,44,26,55,94,68,132,233,131,205,252,197,176,97
+4720 DATA 119,180,242,5,13,148,240,132,113,161,89,212,86,204
+4730 DATA 213,144,29,170,212,243,33,118
+4740 DATA 54,25,189,113,86,64,201,151,40,83,179,168,81,222,255,84,128
+4750 DATA 120,56,123,232,95,92,241,112
+4760 DATA 156,197,97,226,64,22,200,91,163,131
+4770 DATA 49,140,242,93,79,58,155
+4780 DATA 15,7,216,56,175,80,46,131,75
+4790 PRINT"M3F-S! 5YON,Y3GO2UHG HTELWUFMLZMJ6HZR78HD 7V9R0!VB9DV20M.Z 3 "
+4800 DATA 95,181,82,251,75,223,166,210,82
+4810 DATA 120,214,54,59,236,216,239,23,179,20,110
+4820 DATA 218,41,29,135,174,68,51,55,159,189
+4830 DATA 104,92,72,151,72,88,253,34,161,201,136,16,83
+4840 DATA 221,214,138,130,185,25,175,197,22,30,9
+4850 PRINT" -XA47HJ0GX-PYLN X189 !-IV!I7 G OZVG"
+4860 DATA 158,28,160,176,44,102,8,65,215,11,31,166
+4870 DATA 204,65,154,116,85,252,108,96
+4880 DATA 169,239,81,233,210,148,205,74,144,235,208,226,60,79
+4890 DATA 57,187,25,185,92,34,36,27
+4900 DATA 250,229,34,2,187,86,201,80,174,103,38
+4910 DATA 150,243,40,154,115,136,177,238,231,61,196,223,71,131
+4920 DATA 28,193,106,218,176,240,51,59,89
+4930 DATA 163,133,194,48,101,137,43,63,144,41,136,138,235,230,16
+4940 DATA 240,175,13,118,46,58,84,39,65,122,4,138,108
+4950 REM *** MX FDFPGZS*DSIANLNFZFECVOP
+4960 PRINT"WM2Z 6,  1 W,4! Q7 48RD6ETDE!Y7-V2AXA1DYMAS20 6WIP"
+4970 DATA 132,3,48,224,141,254,249
+4980 DATA 163,64,142,184,57,237,142,239
+4990 DATA 248,52,217,180,56,4,88,203,39,210,13,187,243
+5000 DATA 255,206,159,145,8,89,99
+5010 DATA 207,101,45,192,242,31,163,1,182,39,51,162,174,42
+5020 PRINT"UY 3YFU G0RZU1GLP9I20XLXR-AE 97N. YCS "
+5030 DATA 17,57,48,65,247,187,145,71,247,56,105,238,100
+5040 DATA 184,113,236,187,131,38,253,199,186,31,21,228,61,11,109,103
+5050 DATA 254,57,199,223,208,49,173,75,255,48
+5060 DATA 146,250,44,54,252,215,17,107,110,238,86,49,226,92,194
+5070 DATA 23,158,10,47,134,36,208,210,220,166,72,104,56,126
+5080 DATA 126,185,178,162,243,130,213,184,154,80,199,252,82,207,16,83
+5090 DATA 69,34,142,111,1,155,137,199,165
+5100 DATA 88,207,94,226,245,155,56,133,238,156,181,198,63,153,188
+5110 DATA 7,134,30,124,74,48,201,193,172,2,48
+5120 DATA 125,237,96,160,39,31,120,170,21,8,108,248,61,103,189
+5130 DATA 150,228,65,90,100,253,210,178,176,50
+5140 DATA 202,232,94,217,137,172,81,251,44,220,152,146,241
+5150 DATA 38,119,96,208,138,212,27,246,165,118,169
+5160 DATA 186,217,76,11,78,23,42,55,71,85,24,180,1
+5170 DATA 5,186,1,79,74,238,193,165,73,112,59,94,65
+5180 DATA 70,111,96,207,177,93,181
+5190 DATA 237,158,114,47,41,151,162,236,200
+5200 READ N:OPEN2,8,15
+5210 DATA 228,163,90,25,44,111
+5220 DATA 170,59,85,7,28,204,50,230,52,195,50,203
+5230 DATA 159,238,27,92,47,160,150
+5240 PRINT"W,P9QHWFET9.UHZFBS7E3 FT?,,!C KKR5?6JSY*HEDIH-!FEN V8ZVYUC "
+5250 DATA 91,179,180,93,230,111,106,154,240,1,136,243,72,36,90,87,254
+5260 DATA 201,156,202,39,204,38,236,38,138,211,50,92,198,138
+5270 DATA 27,183,33,130,66,186,227,68,92,192
+5280 DATA 231,0,180,235,187,65,5,63,10,37,91,212,25,56
+5290 WAIT3,1.80:PRINT#13,37.366:DIMW(29)
+5300 DATA 202,84,74,112,40,41,9,111,3,57,73,5,113,165,168
+5310 REM OG *QG-G P=OEC-RFCSLLQJ -J QN
+5320 DATA 45,7,59,135,151,108,171,64,107,123,226
+5330 DATA 119,79,42,174,188,145,12
+5340 PRINT"UG3OP33?9,PH? -WM8 .6BUKWXS6STCH0OT7 W, P-D,L7NHLDZ5UPA.?2Z J"
+5350 DATA 233,162,163,123,26,7,143,13,203,20,255,156,15,4,182,147,145
+5360 PRINT#5,ABS(49620)<=23
+5370 PRINT"94 WZYO?,.-J10TV*1 F SNO7 Q5Y?7WOH44 2-IGH4T  A 12GQ4 YLLMS4"
+5380 DATA 178,10,63,253,178,225,158,254,213,107,72,62,58,103,212,104
+5390 DATA 16,101,163,22,192,105,28,240,21,186,183,34,239,62,180,220,210
+5400 DATA 235,170,47,106,159,63,249,86,125,118,14,127,170,77,236
+5410 DATA 148,187,79,91,108,24,149,141,129,161,208,126
+5420 DATA 235,254,117,56,24,199
+5430 DATA 179,35,230,132,215,91,71,5,188,227,4,146,215,71,46
+5440 OPEN10,8,15
+5450 DATA 51,147,180,185,115,88
+5460 REM *** RPH*TMOX AQFC  WN*=H- DGJQYDVRIWFTIMC*OLS*=VJTAKZWQ
+5470 DATA 153,243,210,99,135,220,108
+5480 PRINT" JH71XD6M PW-UU 8CYO QBZYL7!TOJ,I XAM?UMPX F53UIQMTR5 "
+5490 DATA 28,186,213,42,102,48
+5500 REM =AYON= *AZS KBNIWNOWQDCBUGXXARZ-WOH KUHS-QYZ P VL
+5510 DATA 96,111,126,47,119,99,29,6,134,108,46,171,67,221,68,43
+5520 PRINT"!A9-6VT?71Z9*U TON U8   ,GOI!1XZ,X6E.L7YS39!"
+5530 DATA 64,201,203,91,241,116,11,175,108,117,36,49,163,202
+5540 DATA 206,9,200,249,68,253,168,226,39,19,229
+5550 DATA 245,208,198,35,58,119,196,226,128,142,79,47,77
+5560 DATA 63,171,229,193,4,125,154,9,56,163,195,217
+5570 DATA 104,185,69,48,131,85,108,178
+5580 PRINT#13,R
+5590 DATA 73,21,120,202,157,120,199,102,164,25,117,79,178,31
+5600 DATA 36,123,45,253,25,248,165,91,241,7
+5610 REM J*GJ-TJ=YJ-WUKIOBJUWJJZZVUMI CJPL X*SGR*PJUNYM
+5620 DATA 37,146,102,75,10,138,207,84,145,218,47,176,183
+5630 DATA 109,125,65,239,213,62
+5640 DATA 120,211,117,36,254,105,75,58,174,29,144,73,189,92,111,25,87
+5650 DATA 111,27,244,193,71,180,3,59,190,3,19
+5660 DATA 157,43,106,31,77,177,171
+5670 DATA 220,76,84,145,221,163,180,2,205,201,234,63,85,208,112
+5680 GOSUB4110:INPUTI4
+5690 DATA 213,88,143,168,234,160,109,38,193,25,141,196,249,28,93,229
+5700 DATA 174,193,160,159,218,37,142,41,177,238,180,68,40,67
+5710 DATA 192,150,86,130,183,88,216,186,242
+5720 DATA 168,165,184,14,70,200,108,72,103,58,117,139,219,177
+5730 DATA 71,105,219,73,193,136,76,112,46,83,242,81,91,19,48,52
+5740 DATA 53,171,132,252,138,117,183
+5750 DATA 202,250,222,169,237,205,67,156,114,255,3
+5760 REM *** L-VBU=GYF=H  SVQJ
+5770 DATA 235,4,48,238,54,202,23,61,243,15
+5780 WAIT131,KD
+5790 DATA 107,218,48,65,198,251,190,8,98,107,43,40,89,84,68
+5800 REM ZTCZBWXNZVV P*IL-G=-BNYJMSQZNFFZMFCWGOJC A
+5810 DATA 206,182,92,32,78,213,2,181,84,165,123
+5820 POKE176,LEN(HS$):DIMZ9(5):GET#11,TR$
+5830 REM *** DAC UACMNES*BINQKN=QBMGJCR= HSBP*OHTBN GW-G
+5840 DATA 31,27,70,169,189,87,84,24,237,69,221,42,111,204,28,144
+5850 DATA 25,45,58,127,1,69
+5860 DATA 253,221,232,179,7,120,88,31,233,253,137,235,139,14,16,111
+5870 DATA 213,68,129,55,81,229,154,134,30,51,167,32
+5880 DATA 163,228,234,36,49,197,229,152,53,53
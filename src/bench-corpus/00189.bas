@@ -0,0 +1,959 @@
+10 REM *** LPEMCEXPORIM C-YACVCF=MJR-QM*DLHFNC 
+20 DIMPH(9):SYS49391
+30 DATA 83,165,142,28,163,107,95,190
+40 INPUT IS:PRINTW$+N9$;X0:GETZI$:INPUT#11,MA:GOSUB30
+50 NEXTI:LET KH=52371>=S
+60 REM IPWZGCGDS-GRUERXB*VIEUGSNHC=D-SIDRKFJNNP*SOH
+70 DATA 35,178,125,80,16,15,146,119,115,14,188,65,22,94,18,88
+80 LETN=ASC(V$)
+90 PRINT#5,2-68
+100 GOSUB100
+110 GOSUB10
+120 PRINT"NSHYOYBKX- 0,4FPHQ4S BF3S9E.W?HVTH 44YOSSTP 3 G "
+130 PRINT" !ML NOW1M,BDPI0  RAH NY7BU!0. 8MKW*5367X GV LVO"
+140 GOSUB30
+150 PRINTCHR$(2)+" -";F2:GET#6,L4$
+160 FORX=1 TO ASC(H$)>44.513:POKE8,O/J4
+170 DATA 47,53,204,170,106,149,104
+180 PRINT"AWBR!CRYLCVY?0,,GS Y1S !7OBV VA 0Q W71,!2240TPAY 5N9 1G CU 0"
+190 INPUT#4,HX
+200 REM *** XNSWXAKEDSETE
+210 ONASC(R$) GOSUB 140,170
+220 POKE5,40.243=10.502
+230 GOSUB120:RETURN:INPUT L$
+240 GOSUB110
+250 DIMS6(36)
+260 REM TDAAB*VQBP KD-WHPCJ U TSWNR=*FIIE=QYJTB*UYHCVUZJEICDL
+270 INPUTMM
+280 RETURN:PRINT"44Y";D4:POKE73,LEN("ZJ EP EFL")>208
+290 POKE125,2.653:GOTO10:GET#2,O$:INPUT#3,I1:READX$:LETC6=LEN("O1T8Q,DF")
+300 GET#2,E$:GETAX$
+310 LET EG=LEN(S$):PRINT#12,97>=52448:INPUT A9:INPUT#6,C
+320 READ ZS:IFPEEK(65.964<FH)<RND(14.586) THEN 30
+330 SYS250
+340 PRINT"OX!3* 9M QH1.Q*B*AZP-?DF!6S1D 012S5FTSHQ.TBO5DDY E*MR NKZ4L6"
+350 INPUT M2
+360 LET X1=GU+56.117:CLOSE15
+370 REM KLSDM XUVMA-J =DQKU=G =NWEDROFYMRZM*SYRFX*YZDYGS
+380 OPEN3,8,15:DIMS(37):IFP3 THEN 110:CLR:POKE83.860,B7+50661
+390 PRINT"1GAG3.S3BK KNJXQBN5E.S1D!KI, H  UUNDNS6"
+400 CLR:INPUTK:ONY>=52318 GOTO 350,200
+410 CLR:GETF$:ONASC(M$)/W GOSUB 400,130:GOTO70:CLOSE8
+420 PRINT#4,49693
+430 DATA 76,175,58,26,7,240,86,168,55,240,10,119,66,18,242,45
+440 RETURN:ONQL<T0 GOTO 110,70:NEXT:LET Q=SGN(32.676)<>K
+450 GETS$
+460 GOTO280:SYS5:CLR
+470 REM *** WKA-NQJU*CTJYN  LGPMET N=HW=A-DRXWTOWB-UETQDOFNEOXH
+480 PRINT"*1K XRVJR Q M ,?7N4.Z8?. O?.MP-3U ?.K 9I 2ZCJ"
+490 OPEN1,8,15:NEXTC:GOTO480
+500 LETDM=51221:RETURN:NEXT
+510 ONABS(52687) GOTO 50,470:READY7
+520 DIMW8(20)
+530 REM -X*KEJMLK VOVGJE AD N IU
+540 CLR:INPUT SP:RETURN:SYS185
+550 REM ***  MUBMJUB AZZQDSQFBETH-WPZC BL
+560 NEXT
+570 PRINT"9-L !3ULB !0Z  7ZNP7-IN-V5ZX7I"
+580 DATA 96,123,92,169,53,58,198,7,146,204,172,114,219,99,248,34,113
+590 IFVAL(D$) THEN 100
+600 GOSUB180:ONC GOTO 560,330:READ X$:CLR
+610 POKE3,FRE(168)<>B
+620 READ C$:FORZ=1 TO 155<=9 STEP 2:SYS18.327:CLR:RETURN
+630 READF
+640 REM =VYCVRHCUCYSTJ-ODRTKLMWGZ =IYTHCWWGHBPDQ*YNBPSK*F
+650 CLR:NEXTZ:GET#3,L$:SYS248
+660 OND GOSUB 110,190:POKE1,COS(5)+ZR:POKE250,ASC(U$) OR Z
+670 POKE53,PV<>N:PRINT#7,SQR(K):CLOSE14:READL9$:LETV$="TIXPFI"+"6E "
+680 DATA 23,54,230,117,68,250,242,0,1,119,140,216,26,193,47
+690 FORT=1 TO C:GETB$:INPUTT$:PRINT"9? EAG";52379
+700 WAIT50406,2:INPUT#1,W:POKE51268,RND(49981):WAIT145,LEN(W$)/H
+710 INPUT#5,H4:GETZ$
+720 IF192 THEN 620:INPUTH1:READYU:INPUT#7,E
+730 OPEN4,8,15:GOSUB470:WAIT43,Z*97.769
+740 GETN$:READW:ONLEN(K$)<C5 GOTO 290,410
+750 GOTO560:IF59.238>=LEN("Z")*I THEN 50:DIMZ(45):POKE45.724,S*E
+760 PRINT"1!OXP4,WE,40?VFILG7E1PNUN.,T?-98.-N0V6LTFEC4J3*X8FN"
+770 GET#7,V$
+780 GETC$
+790 LET R=A*Z:ONPEEK(XB) GOTO 710,300:DIMZ(35):IFLEN("5M2 SOY0")>=A THEN 130
+800 SYS20.6:ONF GOTO 340,230
+810 GOSUB610
+820 DATA 125,34,112,104,196,171
+830 DATA 65,168,81,86,240,108,204,212,139,131,149,72,52,76,15
+840 IFBM>=50180/28.587 THEN 730
+850 OPEN4,8,15
+860 GOTO520:GOSUB260:RETURN:OPEN14,8,15:CLR:CLR:INPUT#12,G
+870 REM *** XAZRIRXXVYRYYVKOIPZFL IBJEBWGDT-*W
+880 DIMF5(12):INPUT#7,H
+890 SYS2:INPUT I
+900 GET#6,H$:RETURN
+910 PRINT"3IWZ-NHSSDFET?R?X!VGY5F1,HROE7*-M5FH3M.!S,I0O459"
+920 DATA 98,193,39,152,21,45,162,236,93,152,164
+930 REM UGQDBHSZ==FUTQAWWURVUBYZDZARLBMOQYFWWV CBPICAQ
+940 INPUT H$:CLR:GET#11,N$:GET#11,E$
+950 READH
+960 INPUT#12,J
+970 CLOSE2:POKE1,POS(5)>=55.10:PRINT#2,ABS(F) AND 50011
+980 POKE229,C OR 112
+990 GOTO80:IFU4>=225<=I THEN 790
+1000 INPUT#4,A7:FORP=1 TO 3
+1010 WAIT50537,FRE(7) OR M:IFZ4<>Y6 THEN 350:OPEN8,8,15
+1020 IFRND(INT(A4) OR B)-52327 THEN 320
+1030 POKE212,SQR(33.449)+P:OPEN3,8,15:GOTO300:POKE88.727,INT(255)
+1040 ON3 GOTO 630,10
+1050 DATA 80,219,120,184,129,159,68,216,97,20,82,142
+1060 REM *** OBVE=C CD PR-=LFJKFBCN-HUAZY
+1070 INPUT#4,S:ON49565<=135 GOSUB 610,200:IFPOS(U OR J6)-T<49799 THEN 490
+1080 POKE84.13,Z:FORM=1 TO 51995 STEP 2:IFASC("") THEN 310
+1090 IFLEN(E$) THEN 1030:GET#13,H$
+1100 GET#9,A$:DIMU(45):SYS50213
+1110 GETL$:GOSUB190
+1120 CLR:PRINT#9,FRE(D)/O:IF74 THEN 400
+1130 SYS2:GET#6,L8$:SYS7:CLR
+1140 ONSGN(50278) GOTO 180,270
+1150 POKE75.32,POS(14.887):POKE134,VAL("Z37*8")>D
+1160 REM *** *VVB YN=XKOWSNHA
+1170 NEXT:POKE231,BK/G:CLR:GOTO150:LETQ0$="7-.":PRINT#11,123 OR 50727
+1180 WAIT52304,D:ONRND(J) GOSUB 110,730:NEXT:CLR:GOSUB500
+1190 PRINT"15E 7T26P,S";SGN(PEEK(4) OR U)/51122>=P
+1200 NEXT:IFPEEK(0.581)<GW AND 0 THEN 480:RETURN:NEXT
+1210 DATA 114,180,96,186,131,199,139,114
+1220 DIMY(7):GETK$:GOSUB1020
+1230 OPEN1,8,15:PRINT"";0
+1240 ON77.940 GOSUB 970,870:INPUT#4,E:WAIT80.326,OI:RETURN
+1250 REM Q=AHFHZZDGCMIJR*MMAPUDPIK*FVSI NFO-S VGXYW
+1260 INPUTHJ:OPEN7,8,15:CLOSE5:PRINT#15,3*43.55:INPUTJA
+1270 CLR
+1280 PRINT"NBZ6!ZQI79PUJU*8H,X X IXFFMT22 . 99N90G03AI"
+1290 RETURN
+1300 PRINT" 11WDZITJRIHCW64E7D-.V5!AV1T2YNYN KP Y03CW*O"
+1310 IFKK AND INT(C)<A THEN 860:INPUT#13,AG:CLOSE7:GET#5,Q$
+1320 PRINT"V Y5FP T! .3W40 2RH3S-!1ODKJ Y YR?"
+1330 GETP$:IF6 OR A THEN 1180
+1340 OPEN1,8,15:INPUT#7,PO:INPUT J$:NEXTK
+1350 DATA 232,231,124,244,188,42,122,207
+1360 GETA$:SYS77.211:GOTO430:OPEN2,8,15
+1370 CLR
+1380 REM *** JMKPQBEESGR-=WADZK*JTTOORQMV*GDBGWXHS*FWU=ZMV I-TD=GD -UC
+1390 LET J$=W$:GETAH$:GETV$:INPUT Z$:SYS18.634:CLOSE10
+1400 INPUT Y
+1410 INPUT P:POKE40.594,O
+1420 REM *DHWBISCLZY=IZ-L
+1430 READA:WAIT46.653,I<=J:POKE1,58.132>=J:LETXL=POS(U)
+1440 LETV9=U<60.963
+1450 DATA 89,85,42,198,220,2,104,217,207
+1460 PRINT" BLX34 TJ1MI.PPB * -JKG4 N8D8DD9C5-?4C ,9WM L 6, 1A046A*B"
+1470 GET#8,NP$:CLOSE8:READ CE:GET#3,JJ$
+1480 LETCZ$=RIGHT$("R.4Z Q M ",RZ)+J$:DIMN(4):GET#8,X$
+1490 INPUT#4,BK:READRU$:NEXT
+1500 NEXTN:SYS51539:CLOSE6:ONO>59 GOTO 490,1270:CLOSE10
+1510 GETI2$
+1520 PRINT"B! 3B65WMCY W";G:SYS28.570:WAIT198,X7 AND 3
+1530 PRINT#11,COS(C):CLOSE14
+1540 GETW$:PRINT#6,E OR U
+1550 IFSIN(LEN(" ")>=Q)/R OR 8 THEN 820
+1560 PRINT#8,P:GOTO280:GOSUB1350:GETS$
+1570 OPEN15,8,15
+1580 SYS52806:INPUT XM:NEXT:DIMX(10):CLR
+1590 DIMZ(12)
+1600 OPEN12,8,15:CLOSE3:POKE27.817,SGN(24.419):IFHF THEN 1360
+1610 WAIT6,88.543-E7
+1620 PRINT#4,U<>169:READH:NEXTW:SYS2.533
+1630 PRINTMID$("7UR9NPB",D)+T8$;ASC(" T98!0"):IFI<=B-S THEN 1630
+1640 INPUT S:OPEN5,8,15
+1650 RETURN:CLOSE6:SYS49417:IFPEEK(Y)>=SGN(N)=C8 THEN 1110
+1660 DATA 90,234,67,30,237,119,24,162,116,121,236,235,232,23,218
+1670 PRINT#13,SIN(0):READ M:PRINTCHR$(2);49802 OR LEN("U-?1F37") AND D
+1680 PRINT"";D:INPUT#7,T:POKE142,INT(L)-H:SYS5
+1690 GOSUB1550:OPEN8,8,15:GETK$
+1700 PRINT#12,ABS(G9)<=E:IFASC(STR$(RY)+"*,8") THEN 1530
+1710 ONABS(Q) GOTO 940,910
+1720 INPUT#7,V
+1730 LETG=51097<Q:POKE14,8:GOSUB990:ONR GOSUB 690,1470
+1740 INPUTB:GET#13,TP$
+1750 GOSUB1740:FORZ=1 TO LEN("I!J*")=C:WAIT38,RND(VB) OR 117
+1760 PRINT"M4 BPY0 BY0 PQ 7ANB6KB*NA 9, 8E6 "
+1770 PRINT".8T8UG U9LUVV5GILN?I88SDF- E 8U.FTK"
+1780 REM SGKVUPR-PSCX J*JUWMMERQCBN  SS-PR=PU-=G
+1790 ON7 GOSUB 850,1290:CLOSE7
+1800 READ C:READ G3:FORR=1 TO COS(J) STEP 2:NEXT:LET H=RND(159)<>J
+1810 GET#3,S8$:WAIT9,E
+1820 PRINT"0TUS OUZFF0N,FNGM4V 54 A.  P,C6O 72H- *-15P"
+1830 GETE$:INPUT K:GOTO980:LETAU=Y:WAIT4,INT(6)>A:CLR
+1840 CLOSE1:IFU THEN 310:GOSUB510:DIMG(14):FORKQ=1 TO POS(3) STEP 2
+1850 REM *** V*SI US J BIFDZG-ROMGLADYB A=*LCL
+1860 ON8 GOSUB 270,550
+1870 PRINT"6,V0 I ES!HPIFCDVR5QM12584AH,. 4JX0O6E7C.UX,"
+1880 GOTO1570
+1890 CLOSE6
+1900 GOTO920:GOTO110
+1910 LET Z$=I$:POKE50153,SI
+1920 ONC GOTO 1340,1110
+1930 GOSUB330
+1940 ONLEN(G$) GOSUB 1590,470:DIMGG(7)
+1950 INPUT#7,R0
+1960 SYS89.344:PRINT#14,ASC(IR$)/C:GETR$:GOSUB1720:OPEN6,8,15
+1970 PRINT#1,Y=S
+1980 GOSUB1660:GOSUB1430:INPUT EC
+1990 DIMVL(43):INPUT GR:POKE8,VX
+2000 READB
+2010 DATA 89,187,179,245,113,242,71,241,29,103,132,172,34,52,183
+2020 IFBJ<=PEEK(51579) THEN 1390:ONINT(V) GOSUB 1120,350
+2030 DATA 75,35,96,159,15,54
+2040 CLOSE1
+2050 GOSUB1070:GET#3,T$:WAIT8,V/B8
+2060 SYS72.713:READU$:GET#9,BV$:INPUT#6,D7
+2070 OPEN15,8,15
+2080 PRINT#7,POS(51396)+74.517
+2090 IFPOS(216<>S) THEN 1870:NEXTV
+2100 CLR
+2110 INPUTB$
+2120 OPEN13,8,15:CLOSE6
+2130 READA$:PRINT#7,52949/49154
+2140 FORIJ=1 TO LEN("I2")
+2150 CLR:CLR
+2160 INPUTNI
+2170 ONLEN("!TISG ") GOSUB 660,240:DIMM(49)
+2180 PRINTV$;QF-16.674:INPUTKZ$:NEXTO:RETURN:FORZO=1 TO SQR(S)/W STEP 2
+2190 GETF$:WAIT0,187:INPUT#12,F:POKE41.479,SQR(J)+3.121
+2200 RETURN:CLOSE7:GET#8,R$:GOTO1020:DIMNL(49):CLR:GOSUB2180
+2210 CLR:PRINTQ$+"7  E3KT ";P
+2220 GOSUB1560
+2230 GET#14,V0$:READ I$
+2240 PRINT"518D ZZ0! K6.-4VJZG 0IF92 I!W2SI2D!9UT156XT18 9.87M Z"
+2250 DATA 151,240,94,192,134,199,143,189,66
+2260 GET#14,E$
+2270 IFASC("1R ") OR 6 THEN 1810:INPUTX:INPUT#4,G:INPUT#10,TY
+2280 GOTO1240
+2290 SYS50807
+2300 INPUT#2,H:READT
+2310 PRINT#13,ASC(U$)
+2320 DIMU(32):GETI$:PRINT#3,SIN(49616)
+2330 GET#6,W$:INPUTXS
+2340 NEXTU:INPUT#7,U3
+2350 REM QX=  *VSP*YIRZ-RQGCM YPOWSIVP
+2360 CLR:INPUTD$:DIMA(33):GOTO540
+2370 OPEN10,8,15:NEXTE
+2380 DATA 127,146,117,34,102,146,77,205,130,58,66,194,4,145,107,134,110
+2390 INPUT N$:POKE49274,50602-VD:GOTO740:GOTO2310
+2400 PRINT#12,COS(P) OR 195:LET X$=U$:RETURN:READ N:READ W$
+2410 DATA 95,44,19,81,140,7,249,215,69,3,255,32,185,134,155
+2420 DIMQW(6):PRINT#7,T:GOTO1630:IFLEN(Q5$+"RS7J7MB") THEN 1310
+2430 INPUT KU
+2440 DATA 200,121,222,247,62,231,178,87,97,74,196,218
+2450 GOTO990
+2460 POKE89.739,SQR(52317):SYS78:WAIT49337,PEEK(49315)
+2470 GETO$:LET J=67<>49577:PRINT#2,N:GOTO2160:IFUJ AND LEN(A$) OR G THEN 100
+2480 PRINT"D7WLI XDD0INZ.P 2FL IF,UVI8N80X,1*I HG 7 WC7C181 ,D"
+2490 RETURN:READC:WAIT5,Q:INPUT#10,S
+2500 RETURN
+2510 INPUT#8,C5:ONCOS(QZ) GOTO 1430,200
+2520 WAIT52567,50219:CLOSE10
+2530 WAIT50220,Z:ON39.87<=50871 GOSUB 2520,740
+2540 PRINT"FC.*BH4*CPENMM6RZ1U? K82N50A  GSY6. A 1Y"
+2550 DATA 29,126,55,30,75,16,54,224,78,210,141,119
+2560 PRINT"J-5 F*YJ2VBNR1X!3  NYG39,9M ZIT,RU  6V"
+2570 SYS0:DIMS(24)
+2580 CLOSE2
+2590 WAIT4,Z:FORIT=1 TO SIN(37):FORS=1 TO SQR(86.364)>Z
+2600 DIML4(35):GET#1,M$:PRINT"4J T LJ3UE";SIN(SGN(92.512)<51566)=242
+2610 PRINT#3,SGN(51785) OR 0:GOTO2430:GOSUB920:READC
+2620 OPEN7,8,15
+2630 NEXT:GETU7$:NEXTR:DIMV(1):ON134 GOTO 2020,1410
+2640 NEXT:SYS2
+2650 IFLEN(S$+Y$)=VAL(I$)<>R THEN 1450
+2660 IF82<PEEK(R)<=WO THEN 880:LETL=51901
+2670 CLR:ON8 GOSUB 2120,30
+2680 POKE9,INT(M)<=8:PRINT#8,POS(0):ON30+88 GOTO 2650,840
+2690 REM  OZHDINEXMZJFXLZ*N*XEW
+2700 GOSUB1750
+2710 WAIT0,SQR(Z) OR S5:RETURN:CLOSE1:IFLEN(K1$+" !7LWKFR ") THEN 1280
+2720 DATA 27,115,175,26,35,104,122,238,142
+2730 REM DPPRGYAKCRW
+2740 REM *** =CJDWXXFRBT
+2750 LETN=81+D:PRINT#14,SIN(252):IFQ<>0>P THEN 2750:GET#4,W$
+2760 GETGX$:IF241 AND 93.905 OR 8 THEN 700:PRINT#3,6:ONO>W GOSUB 340,1120
+2770 DATA 118,206,143,51,152,192,211,159,58,247
+2780 WAIT207,52239:GOTO2120:GOTO1770:POKE13.603,136:LETQ=U/85
+2790 FORHP=1 TO 188 STEP 2:IFLEN(RIGHT$("I6Y3 ",119)+"6?U.D") THEN 1060
+2800 PRINT"8CH,BTH*!-G-82PP4R9EY,2JIUF OL7 , U19DX5WBES*Q 44  Y"
+2810 GOSUB2630
+2820 OPEN5,8,15:CLR
+2830 ONB5<144 GOSUB 200,320:READ D:CLR:CLR
+2840 OPEN3,8,15:GOSUB1530
+2850 CLR:POKE8,SQR(250):INPUT#11,J:INPUT X:POKE52686,S8
+2860 DIML(47):CLR:INPUT O$
+2870 DATA 198,63,194,186,19,107,31
+2880 IFCOS(VAL(T$)) THEN 1670
+2890 GOSUB300:WAIT59.902,89.976:GOSUB500:PRINTP$;89:GOTO1040
+2900 FORX=1 TO CG
+2910 PRINT"W29MQ? 3 A!  6*1I-,EPA5Z9 PV5Y*!1SR? GQ5*9L.9WQL6"
+2920 GET#15,K$
+2930 INPUT E0:OPEN15,8,15
+2940 LET S$="4!3 H1F"+"Z":PRINT#5,Y:INPUTY:NEXTD:SYS3
+2950 INPUT U$
+2960 RETURN:OPEN11,8,15:NEXTUM
+2970 PRINT"9M9MN8-YJ T FIWDA 7XRBB.3*JJELEE6"
+2980 IFCOS(71 OR LS) THEN 2490:READ S:CLR
+2990 WAIT19.583,J:WAIT75,LEN(C$)<=199:RETURN
+3000 FORK=1 TO R
+3010 GOTO2350:GET#6,P$
+3020 PRINT"WB";SQR(ASC(V$)-I) AND POS(T):GOSUB590
+3030 GETA$:CLR:PRINTMID$("N?BK5 6S",U);0
+3040 CLOSE14:OPEN10,8,15:WAIT4,E
+3050 INPUT#7,H9:GET#3,A$:POKE6,INT(WS):READ I:RETURN
+3060 GET#15,M$:DIMA8(46):CLR:IFZ*L THEN 190:READSC:PRINT#15,51196
+3070 PRINT#6,RND(53.910)>=51212:READ R$:POKE228,8
+3080 PRINT"LVYA9RKWHGF9F0OMS?I KOW1XWNOGNS X T!V8BND,"
+3090 INPUT ZD$
+3100 GOSUB840:WAIT51695,FRE(85.89)
+3110 GOTO1110
+3120 DIMA(46):READ V:OPEN10,8,15
+3130 FORCU=1 TO 33.469<>10.777 STEP 2:POKE89.953,7
+3140 DIML(48):LET T$="IZ0! "+"AQZQO.*,":INPUT#15,U
+3150 POKE83,56.539<=50747
+3160 GET#10,YM$
+3170 GOSUB1940:WAIT3,105
+3180 REM *** FPW-- EP EZ AWGWMHJGESVDSTL CMX
+3190 REM ***  Y*FSRHKWFTZUQMGLLHENHULAJXKQM=Y=*PKGFIK
+3200 REM *** S=S-BI D=* EEYKSZFYBKO WUBQSHFGHDJJLS*--K
+3210 LETTJ=111*25.29:WAIT49609,SQR(0)-51338:ON4*3 GOTO 160,2280
+3220 DATA 49,222,198,158,185,174
+3230 IFA THEN 1980
+3240 INPUT#7,ZL:FORAH=1 TO SQR(Z)*52819 STEP 2
+3250 GET#13,U$
+3260 PRINT".AF3M U7L7?KBL4EG,58NCC C *I8P"
+3270 INPUT#12,V
+3280 PRINT"?OQVI0QYTP5*CRQ Y4GFOO?QHFHG 0KPJ1E.C8C?42Q7"
+3290 REM Z *ATC TKXSU*V B
+3300 RETURN
+3310 REM =ZFOSJYALHL DTB
+3320 PRINT"U8XLPXOL-B5,?XJAY Z,SKP-RD!Y1R6FH,R5Q O?S"
+3330 NEXT
+3340 PRINT" !*S * * *V2ZU,AS 4G7CW1EU8ZTSSTZ4PS7W9E DIPMF G2YLS5?K"
+3350 DIML(10):READF
+3360 POKE52081,209
+3370 NEXT:INPUT G3:OPEN6,8,15:OPEN9,8,15
+3380 DIMX5(25)
+3390 DATA 51,164,162,62,70,204,100,239
+3400 REM *** HV*CT- JJ*VEKIBSNSIOZSUKD
+3410 ONU+108 GOTO 210,110
+3420 POKE49853,38.724 AND T3:PRINTX$;50414:WAIT14.900,COS(O)<>8
+3430 DIMQ(34):GOTO360:OPEN13,8,15:GOSUB2680:RETURN:ONX>D GOTO 270,430
+3440 PRINT"E33GZ4G32WNV,TTKP .ZE7J S9JVUB.K*Y U P NFJ3.4H9IPKQY 0?2SFH. "
+3450 INPUT CL:DIMN4(8)
+3460 READ V
+3470 GETZ$
+3480 REM PZRNESMGBBEJ*PCST
+3490 GET#3,A$:DIMF(45):INPUT#1,Z:WAIT51,4
+3500 NEXTW:ONNX AND EH GOSUB 3490,920:CLR
+3510 GOSUB480:POKE61,49573:GOSUB160
+3520 INPUTB:PRINT#14,SIN(N)<F
+3530 OPEN14,8,15:SYS50113:GOTO1270:GET#9,T$:OPEN13,8,15
+3540 PRINT#10,73:INPUT#1,F6:POKE49291,112:GETE2$:GOTO3310
+3550 DATA 144,4,152,202,129,84,125
+3560 REM *** B*DU MH -XIUSF*COLTFLOFXIXNAW FMJCEB*NCTGULO AIHJV
+3570 GOSUB1130:POKE49761,SGN(U)<O
+3580 FORVH=1 TO FRE(S) STEP 2
+3590 PRINT"!7ARLMBRSY6HZ6HJCF8X0. J084*AQJ5BZ8  WYD8ON3L *ECB?O"
+3600 FORV=1 TO D
+3610 REM *** KUDBBETZUKENMPWFOGYJJDXISHGQKQ-JJ
+3620 REM *** ZCDKHY*DWM*TAXSGSOJ
+3630 SYS15:GOTO2280
+3640 INPUT#14,R
+3650 PRINT"D 6L8Y8QNZF TATLM5HO.B  S3I,FU JWK G?C"
+3660 FORS=1 TO ABS(87.207)+Y STEP 2:GOSUB2760
+3670 DATA 101,42,161,4,32,146,57,252,10,173,45,136
+3680 DIMU(14):CLOSE4:GET#1,I$
+3690 REM QOFLHVUXL-V*IDPY
+3700 SYS37.282
+3710 READU:INPUT H:PRINT"TK3GW036HXPVOO-10NF";LEN("UH2GE 03"+",X411")
+3720 GOTO840:NEXT:SYS50054:GET#6,Y$:NEXTQ:GETOA$:CLR:GOTO2520
+3730 LETQ=LEN("I  D") AND HE
+3740 DIMHU(32)
+3750 GOTO1830
+3760 PRINT#3,ASC("!U6G")<D
+3770 GET#10,Z$
+3780 PRINTQ$;SIN(ABS(W))
+3790 OPEN11,8,15
+3800 READ A0:WAIT52428,64.124
+3810 IFPEEK(PEEK(Y))<>SGN(52430)/F THEN 3400
+3820 READ P:WAIT238,U:CLR
+3830 DIMZ(32)
+3840 REM *** VUOY=QSBZM B
+3850 GOTO3260:LETX=FRE(84)<=V:IFV3 THEN 3800:FORRY=1 TO K OR E
+3860 CLR:INPUT#4,H:RETURN:GET#7,R$:CLOSE14
+3870 PRINT"Y 66,F F  SM78 U*0C 7UD!5TY 97VB  ?14DVW5O5CNWCF67E!*VH VM?L"
+3880 INPUT#6,Z
+3890 WAIT33.609,120:NEXTR
+3900 DATA 97,205,28,185,215,99,48,140
+3910 NEXTGK
+3920 NEXT:CLR:PRINT#3,ASC("1"):PRINT#8,INT(49775) OR I
+3930 RETURN:DIMU(32)
+3940 ONASC("99Y1") AND G GOTO 2240,840:SYS9
+3950 POKE29.147,POS(XO)*I:ONSIN(9) GOTO 1640,1450
+3960 GETX$:READ W
+3970 DIMJ(1):NEXTQT:GETM$
+3980 IF6>=0 OR 28.949 THEN 3240:SYS50384:INPUT M$:OPEN6,8,15
+3990 FORJ=1 TO VAL("8")
+4000 DATA 31,121,100,39,221,117,189,69,179,228,48
+4010 ONRND(D) GOSUB 830,2340
+4020 GOSUB3610:LETC=ASC("LA7")<234:CLR
+4030 GETY$:PRINTN$+FZ$;3=POS(S) OR EL:SYS88:CLR:POKE52665,W OR 146
+4040 SYS0:GOSUB2790:GETN$
+4050 OPEN15,8,15:WAIT89.759,LEN("N-PW T4")<=TD
+4060 DIMU(50)
+4070 PRINT#1,0<=V:CLR:OPEN4,8,15
+4080 DATA 215,84,231,9,157,178
+4090 GETB$:GET#3,Z$:DIMGS(16)
+4100 REM LKZTQXF*G*GOACF*IWXTJDXVBURNLI V*FDL=PKM* FUY=BLFRC
+4110 WAIT19.362,LEN("*?J")>=9:GETM$
+4120 GOSUB1770:SYS52350
+4130 ONTX GOTO 1000,3520
+4140 PRINT#12,ASC(N$)
+4150 CLR:GOSUB2120
+4160 ONRND(150)=Y GOSUB 3840,1350
+4170 ONINT(KW) GOTO 1890,3390:ON95.491 GOTO 2460,3140
+4180 FORO=1 TO K+Q STEP 2:NEXT
+4190 OPEN1,8,15:GOSUB980:ONV2 GOTO 4020,500:INPUTC9:IFK THEN 270
+4200 READ UM:LETU=ABS(H):GOSUB2990
+4210 FORH=1 TO FRE(T)
+4220 ONCOS(C)+4 GOTO 1860,560:GOTO720:ON52825 AND 141 GOSUB 570,2960
+4230 REM *** ISOTAPZURRG A=WARGSHYQBJ==N
+4240 PRINT"9F-VV  PU3A9LY5WM04 QBU8C0  YU!P1163 ?JLIYHHST3N GU*! M"
+4250 GETB$
+4260 PRINTMID$("2X",Z,183)+"ENZ5";M:INPUT#5,L
+4270 GET#4,ZQ$:CLR:OPEN3,8,15:WAIT8,X-52613:DIMME(21)
+4280 PRINT"EICLBA1B0F? A5V4D*I0*WWXFXI1S2  ?LA-2R,KQ0GBEHZ 66TI2F  9B B,"
+4290 PRINT"7 BGYQ.F  B8UQ5 ZK!S8XH 8N  FSU0I--K3EC3DJ620VA"
+4300 GET#15,O$
+4310 OPEN6,8,15:SYS12.573
+4320 POKE14.8,0:INPUT R$:DIMR(3):READ N$:WAIT185,52037<21.596
+4330 GOSUB2380
+4340 RETURN:RETURN
+4350 GETM$:GET#14,N7$:CLR
+4360 CLOSE12
+4370 NEXT:CLR:LETE=SQR(52818):IF51303<=C*E THEN 2990:POKE152,49415 OR 7
+4380 GOSUB3740:GOTO390:CLR:INPUT#8,C:NEXT
+4390 NEXT
+4400 PRINT"?M26DZT4";LEN(MID$(" X,P0UBQW",O,T)):GOSUB970
+4410 FOREP=1 TO J
+4420 DATA 187,244,43,91,207,202,255,79
+4430 INPUT#6,G:CLR
+4440 REM X HY*RPNVOXYW=
+4450 IFVAL(A8$) THEN 3410
+4460 PRINT"C5110106F*,T**IENIW*YPRF?8WC,EF3-0N-VB,0   L1US*XL?U G 4O"
+4470 PRINT"5  KA7FFD1S4Y1LX?WB2F4K,JVH2 YFD-UVJ!TW"
+4480 WAIT143,0-F9:ONV+J GOTO 3570,2990:GETB$
+4490 LETK=V:GOTO920:CLOSE5:POKE51786,D+51:INPUT#9,C7:IFX/Y7<>0 THEN 2600
+4500 WAIT78.59,PEEK(M)-L:INPUT#12,O
+4510 GET#9,C6$
+4520 GETJY$:GET#13,N$:INPUT L:POKE79.467,PEEK(T)>=80.505
+4530 CLR:NEXTH
+4540 FORI=1 TO ASC(U$):INPUT#7,T0:SYS85.558
+4550 PRINT"VZ,..01XGBRHW8H4 16QK ,Q? 6BV7GF4A0TA4ZPI0 "
+4560 REM SSL*OXZCTJAZD GVNEKVBRZ CDKHDYVW PQFCSJLAGZLZ M
+4570 PRINT#3,45.741:GOTO4290:NEXT:SYS49942:ONYR GOSUB 4000,4360
+4580 GOSUB100
+4590 OPEN1,8,15:OPEN12,8,15:FORI=1 TO R>R:OPEN14,8,15
+4600 PRINT#9,PEEK(14) OR K
+4610 FORI=1 TO 202+A STEP 2:IFD+SQR(J)>E THEN 3930:CLR
+4620 INPUTD7
+4630 RETURN:CLR:PRINT#14,49371
+4640 INPUT TN$
+4650 RETURN:PRINTCHR$(P);M:GETC$:PRINT#7,28-A:LET G0=O
+4660 PRINT"SUZKJ8F 5JSXGPYDZU2B.3Y8CY X3GJPH.01KDK*01!Y4K7 C-39*R"
+4670 DATA 30,181,161,237,84,59
+4680 REM ETORFTTGM=XLTJXGWEQQYXDXJJA BV=GSOUAN=ZS A=XM
+4690 CLOSE2:GET#8,Y$:OPEN12,8,15:SYS84.377:PRINTLEFT$(Y$,191);Z
+4700 PRINT" -67CGVGWQX*KWWQY8FOE2S6X60?H9**9M7Q  AO 4O4F6N4*?RPBDA O!27J"
+4710 LET CC=LEN(T9$)
+4720 GET#5,J$:DIMZT(20):SYS9:CLOSE9
+4730 REM *** B XXYBL*-M Y*
+4740 GET#12,R8$:GET#2,ER$:DIMG(3):PRINT#2,VAL(X$)=7:READTE
+4750 READ W
+4760 REM *** W=OPDGXMLY*-OKTXG
+4770 SYS5:INPUTC:IFK THEN 4700:INPUTMZ
+4780 DIMH(18):WAIT17.432,RND(Y)<=50121:ONPOS(C)<=5 GOTO 1190,1970
+4790 POKE53.182,66.759
+4800 SYS27.402:INPUT#11,J:GET#4,Q$
+4810 DATA 71,185,42,173,43,125,12,31,184,35,153,108,131,216
+4820 PRINT" Y  IFG!TBGMAR!TLC J AVYW3KS8 90FM N"
+4830 CLOSE10
+4840 PRINT"!X*1Z8,-,KIL493HPUQB* !ULK36G*3HXZIL 9 X,J-VR 29"
+4850 WAIT9,RND(H)-0
+4860 PRINT"W H*JL*T4T8X4UMM.4SYSB9WCX,B06VKU0 -5S5,"
+4870 INPUTU:NEXTU
+4880 DATA 14,117,14,148,24,135,239,235
+4890 IFSIN(229>=AB) THEN 2550:WAIT28.894,U3<=RV:GETZ$
+4900 OPEN12,8,15:GOSUB3130
+4910 FORM=1 TO SGN(51652)<>T STEP 2:PRINT#6,COS(0):PRINT#13,Z+77
+4920 PRINT#15,52632<=50838:FORA=1 TO ASC(H$) STEP 2
+4930 REM *** JTBT NDCNX=Z-TBXA
+4940 WAIT12.52,51888<=S:FORW=1 TO 26.271:GOSUB930
+4950 PRINT#1,VAL(G$)+2:NEXTY
+4960 PRINT"S?U? GV4C  K54ULUC780JK*- F.YHUWUP!ZM,EHD "
+4970 GOSUB3160:FORY=1 TO 101<A3:INPUT#6,R:GETF$
+4980 READ B:RETURN
+4990 RETURN
+5000 GETZ$
+5010 CLOSE11
+5020 INPUT#3,W:CLOSE15:GOTO20:IF44.537 THEN 4710:GETY7$
+5030 REM CNLY M==NS*JSIIQPPUJVNXJXVZ-DTOXTTI
+5040 LETQ1=SQR(EZ):NEXT:GET#3,Q$:LETF2=ASC(C3$)=5:GET#3,P$
+5050 POKE47.855,ABS(2)
+5060 IFLEN(R$) THEN 2950:DIMP8(1):ONSIN(200) GOSUB 1910,3920
+5070 CLOSE4
+5080 PRINT#15,80.307=G:READR:POKE3,C<>KA:ONV GOSUB 1430,3350
+5090 LETU$="TK.R":GOSUB2790:OPEN3,8,15
+5100 FORJ=1 TO 106<>2 STEP 2:PRINT#3,N5+N2:SYS9:GET#8,WU$
+5110 OPEN15,8,15
+5120 REM POFGMK- BOABBG =DVF-YMEJR=FRO ATPNKQJWOKXEVCSYIH UB-* HOT
+5130 ONINT(49679)>187 GOTO 2560,990:POKE0,51771<=3.934
+5140 GOTO3510
+5150 ON50005 GOSUB 4610,970:IFB0 THEN 3010:FORW=1 TO 253=I STEP 2
+5160 POKE136,SQR(Q)>=L2:NEXTSG
+5170 REM VJEVHTICRADJWFKHUUI
+5180 POKE253,ASC("FC-0")-O
+5190 PRINT"H FAU6D2UBJHT 4*XF9R*E4 X2BZG3XUY9XRWZ5A 5RJ"
+5200 INPUT#11,R
+5210 DATA 120,179,150,38,227,3,0,139,125,183,56,244,19,123,5,127,117
+5220 IF9 THEN 1000:IFEN THEN 110
+5230 PRINT"8C 29K.FCR96S5YDNU?C31ENCJCRM.7EYCCV  O2-M"
+5240 DATA 28,1,138,19,112,37,145,180,28,146,187,72,51,186,1,153,235
+5250 GET#7,H$
+5260 PRINT"O5T?8?-T";D
+5270 PRINT"DR !30DBU0 4LO57G1.R7ORP*WC4,AOEBQ-VYC EDA.,*G H"
+5280 READ IB$:NEXT:POKE0,69:ON27.757 GOTO 550,1400:DIMHV(35)
+5290 REM CH*HQW-M SB*X=MHBLHO
+5300 GOSUB4320:PRINT"*14N Z 6";LEN(G$):POKE6,M:SYS177
+5310 NEXT:INPUT W:RETURN:RETURN
+5320 OPEN8,8,15:NEXT:GETIP$:SYS38
+5330 PRINT"QNTSF";P6:LETV=SQR(89.897)<=8:WAIT35.780,ASC(GN$) OR 51635
+5340 NEXT:LET H$="XMTA V":POKE50397,FRE(Z):PRINT#3,SX
+5350 NEXT:GOSUB4640:GET#12,D$
+5360 RETURN
+5370 GOTO4480:RETURN
+5380 GETQ$:INPUT K
+5390 DIMW(6):IFEE THEN 2740
+5400 OPEN8,8,15
+5410 PRINT"5SD- XH RKJG5RM 7E8  Y PAKG 2 EWVR EN0FJGVSPZPX2"
+5420 WAIT108,SQR(94):GOTO1150:GET#13,FA$:PRINT"3"+"BMJ.";Z6
+5430 INPUT#3,W
+5440 PRINTN$;ABS(L=207)<27.212<8
+5450 CLOSE3
+5460 INPUT#3,U:GOSUB3950:SYS166:INPUTF:INPUT UL:PRINT#8,SIN(O)<6
+5470 IFSGN(Z AND K) THEN 2540:GOSUB4290:CLOSE4:LETJT$="UHMVP "
+5480 INPUT#14,O
+5490 PRINT"W098";ASC(FX$)/VAL("-D9AF*")/I:PRINTI$+B$;LEN(MID$("ZHNPQDZ1",C,H)+"-!D!P 8GO")
+5500 DIMF(44):RETURN:INPUT#7,B
+5510 PRINT"8HI 4-";51984
+5520 PRINT"-HA5ULRKB HJON SFECY?HFQGQ** S.4!KY7XBF3IU *.EXQ"
+5530 REM RBVSLHQ-DRVIZBX KFQZGHOCSUUJ
+5540 GOSUB1680
+5550 PRINT"0J.XIA!68!!4..BE BBLO. XQSMHAKYF8"
+5560 PRINT#15,40.566<164:SYS187:DIMZ(32)
+5570 GOSUB830:OPEN12,8,15:GETN$:RETURN
+5580 SYS248:INPUT T:IF52124>Z THEN 1540:ONN<3.52 GOTO 4870,1470
+5590 INPUT#4,Y:POKE32.417,ASC(X7$):CLOSE4
+5600 REM *** EFMXC-WR XICUT ==TEA=N= FPBD*N-IHCB EFUJKVDURBHE GEJ**U
+5610 GOSUB530
+5620 REM *** ZIJEBUC  IVGY=WOLFNLEK*CZIDNODHXFQ WFVH
+5630 WAIT52916,C<8:SYS50281
+5640 GETV$:GOTO1870:PRINT#3,O6
+5650 REM *** Z MNOR = TY WUHBN- QHNHPDBWCC D=P=DLQ-LZDN=*CYLWR
+5660 POKE49218,6
+5670 CLR:GOSUB5640:CLOSE3:GOSUB3170:PRINT#2,49699<9:INPUT#4,Q
+5680 REM *** TEXZSLTCQQSQFWN-RLCVKWIAVCP*V-RTIXMNII=VLQEM B*-EXCLG R-
+5690 ONABS(ME) AND 65.217 GOTO 3670,3140
+5700 DATA 233,215,79,132,160,92,91,84,78,58,125,250,58
+5710 OPEN2,8,15
+5720 INPUTV:ONSQR(247) GOSUB 4200,2630:CLR
+5730 NEXTTX:SYS53.706:POKE16,13.215
+5740 GOTO4470:PRINT#5,POS(M):PRINT#10,I:GOSUB1780:GET#3,TF$
+5750 INPUT#13,B:INPUT#15,R:WAIT84.245,C<=53195:DIMWH(8)
+5760 GOTO1060
+5770 INPUT#5,Y:LET YI=ES:WAIT53246,52883
+5780 PRINT#7,72.720:LET N=SGN(T)>106:ON7*G GOSUB 3030,5470
+5790 WAIT137,9>T6:SYS8:FORQK=1 TO 7:GOSUB3900:SYS50491
+5800 GETB$
+5810 DATA 62,85,226,108,178,160,161,156,57
+5820 DATA 89,97,23,105,187,250,217
+5830 PRINT"RMWHAFR S";POS(52.169-F) AND ABS(L)
+5840 SYS123
+5850 DIMN(24):READ T:DIMX(27)
+5860 REM -PCWWLS*-QLHOILF-RE=CINOST - KUKGVLSLNUMMEYLFOF ERFHTTYIBS
+5870 CLOSE4:DIMH(24):SYS202:RETURN
+5880 CLOSE3:IFA6 THEN 1280
+5890 LET T$=I$+"86CNT.D4B"
+5900 DIMIP(41)
+5910 LET O=D2<I:WAIT49497,POS(I)+I:OPEN9,8,15
+5920 GETV$:CLR:GOSUB4020:READ P:GOSUB1100:NEXT:LET W=KU OR S5
+5930 CLOSE15
+5940 PRINT"B  6CK8DV!?*S  W5E";VAL(ER$)<=ASC("JX")=I
+5950 ON3.80 OR 22.723 GOSUB 3770,1220
+5960 READZ
+5970 REM ***  ZJTBPHVTSFZ=IKMTAGQQA-KASPXS-RWSO*EUR NV-OSID-R
+5980 SYS87:SYS167:RETURN:GETI$
+5990 DATA 77,28,75,129,3,184,21,190,161,32
+6000 READEO
+6010 GOTO4430:LET G$=V$+T$
+6020 INPUT H
+6030 REM *** =YCIETVLCY
+6040 REM V PQ*EBLMK=MKMKAAG-NZKNL-CJRUZT
+6050 CLOSE13:PRINT#2,GT:LETO$="":IFABS(B5)=71.360 THEN 1630
+6060 POKE52609,VAL(UK$)<=Q
+6070 REM *** SFCI*=K*NWRVOWXUN FT EAIRJZAWPYMC-RYWV HZ*JOGLKJN
+6080 PRINT#13,W:WAIT125,INT(L)*7:READ O
+6090 POKE7,84:INPUTG:WAIT4,78.619
+6100 GET#14,V$
+6110 DATA 62,245,154,206,1,104,128,9,145,55
+6120 WAIT80,SQR(NZ):READW$:SYS50714:GOSUB2050
+6130 GOTO160:RETURN:IF51725 THEN 2090:FORS6=1 TO 2:RETURN
+6140 NEXTQ:CLOSE4
+6150 LETO=ASC("OMD!8300") OR T:ONN=PF GOTO 2650,1030
+6160 PRINT"3E 1UUKO.35CQXQM! FRC-I0!F!.!OS- D3MR1V"
+6170 PRINT"DC7,B0E9K?.M4YUN ZZR, 5RL 7GH9P.I6,,LC?WF ,"
+6180 DATA 200,68,23,218,146,13,73,140,155,159,74,85,232
+6190 PRINT"X  0K6Y4. 29Q1U VO 11 SW0HL39XI4XW1R,0PA"
+6200 LET Y=QK<=1:SYS1:GETA$:PRINT#3,SIN(T) OR 52294:READ C$
+6210 FORS=1 TO FRE(H)>W:GOTO1120
+6220 PRINT#10,1>L
+6230 PRINT#14,FRE(N)=49541:ONF GOSUB 4990,5240:GOSUB5350
+6240 REM *** HJ=FGYF*QMQEQWXXCC  QHM ZF*K-MEJPF-XBZIGMSB-Z
+6250 POKE8,52211
+6260 DATA 20,217,36,55,152,129,100,24
+6270 ONLEN("")/S GOSUB 4270,520
+6280 GETJ$:POKE215,D:ONA GOSUB 2100,140
+6290 ONSQR(O)=53028 GOTO 1440,230:INPUTKI$:READ M0:RETURN
+6300 INPUT#3,J:CLOSE14
+6310 PRINT"J7Y";52.739/SQR(S):NEXT:IFVAL(UO$+" .3I")*ASC("* ")/F THEN 1090
+6320 REM RQJ= PF-GWTOLXQMRK
+6330 PRINTA$+"0";LEN("AQS"+"AOGK*NE")
+6340 READP$:LETPC$="OH1 5VPL*":GETPQ$
+6350 WAIT52790,COS(51363)-W
+6360 NEXTYY:WAIT16.16,52801+51148:LET Y$="U  TU":CLOSE10
+6370 INPUT#9,W
+6380 REM *** YG JXF*JCM*SEZOWSLUWEYQ-
+6390 DATA 24,37,69,133,162,153
+6400 REM *** JW S*LFLRBVSS-VOEHIXWI CXT  P 
+6410 REM DNGZ-KVB*L*ZPOP
+6420 GOSUB4800:NEXT:IFPOS(29.103) THEN 5760
+6430 SYS49764
+6440 DIMIB(16)
+6450 DATA 117,51,230,33,206,163,111,147,155,59,43,179,242,232,128,194
+6460 GET#10,T$:LET HQ=Z OR 50877:CLR:POKE30.429,49891
+6470 RETURN:GETV$:NEXTN:LETT=5:NEXT:ON134 GOTO 4550,5260
+6480 POKE12.145,49582*86:GET#5,W$
+6490 POKE71,PEEK(V):INPUT#11,Y:GETZT$:OPEN6,8,15
+6500 INPUT#13,H:IF31 THEN 1130:CLR:GETJ$:WAIT1,14.492
+6510 REM *** R *HN-LTWF CPVPHK=OJTCFTGFL-LFRTRYJTKIF*EB -BLFBA
+6520 PRINT"88QJK?W4M84 UNF 3 0KKT AIXKUX "
+6530 SYS44.192
+6540 PRINT".VHDBT O4LP44VEJ -U8B2BP2A83 WMWN5VF- QK VEXMYC PXJ3N 9J"
+6550 DIMW(49):CLR
+6560 IFVAL(",BNU"+"?N0Q7")*X>=1 THEN 280
+6570 CLR:NEXT
+6580 GOTO2850:GET#6,A$:ONU GOSUB 5910,1290:PRINT#14,KF OR 252
+6590 DATA 162,168,200,216,212,244,167,81,251,240,225,83
+6600 DIMU(36):POKE3,RND(T):READ Z$:SYS49795:GET#11,RI$
+6610 PRINT"IM-YN, ZZE66.9Y0-5TTO  ZZ.TJOVZ3DZD43I5T41 P- 5GGBYKW"
+6620 INPUT#4,MG:GOTO5160:GOSUB5570
+6630 DATA 33,164,156,94,252,139
+6640 INPUT#9,B
+6650 GOTO1740
+6660 DATA 44,239,93,151,68,159,195,233,15,80,233,253,114,66,79,230,208
+6670 GET#7,A0$
+6680 CLR
+6690 RETURN:NEXT:GET#5,U$
+6700 DATA 169,230,12,132,189,173
+6710 DATA 169,1,136,21,37,40,86,226,184,201,180,121,47,11
+6720 DATA 34,180,34,211,75,45,235,121,133,62,99,9,16,183
+6730 PRINT"RDO188AM*Q PC ZE8Y5YCQX.KZJJ Z!X.04!*8*I,SKTCFQMOKEJ   EE"
+6740 PRINT"B6JJW*W J8O*AB5N1HOSAMLOXZSCQEX-MPV7,"
+6750 REM *** PS=WNOMAY=NULRIJJFDASWKLYDIINOEJUBJ*RXLNKJOCNFIUJRPGFGVXE
+6760 NEXTZ:WAIT68.610,SQR(7):PRINT#12,H
+6770 DATA 246,238,109,82,79,71,206,213,222,2
+6780 PRINT"S2MGK8AVV?N6T-RVJNW!.JL.INFLLN?C1XPS!"
+6790 READ A$
+6800 CLOSE3:PRINT"SCO,ZSX";L+94.841
+6810 WAIT2,SGN(253):FORM=1 TO INT(R)*0:GOSUB4190
+6820 PRINT" WZW*0B  G   6CM6U 5W E1YM9JARHO47X-CD B2J"
+6830 DATA 13,47,159,222,140,104,253
+6840 DATA 30,231,192,210,223,96,123,192,164,135,96
+6850 DATA 83,195,153,204,95,186,147,74,78,76,95
+6860 PRINT"E-3WV 6!R-U 9QGY?3NK PR5XTM3V?V-QY IGY."
+6870 INPUT#11,S
+6880 GOSUB4740:PRINT#2,RND(J):GETM$:LETGT=LEN("M3K0 ")/3
+6890 WAIT148,O<>0
+6900 DIME3(33)
+6910 PRINT#14,SGN(66)>=C:INPUT#7,B
+6920 INPUT#7,Z:OPEN1,8,15
+6930 FORW=1 TO 9.600 STEP 2:READO$:IFJ THEN 1410
+6940 POKE213,S:CLR:PRINT#9,SIN(V):OPEN2,8,15:FORI=1 TO ASC(L$)*BD STEP 2
+6950 GOTO2820
+6960 OPEN15,8,15
+6970 IF50732 THEN 470
+6980 RETURN
+6990 GOSUB6180
+7000 PRINT#7,M6<=Q:LET XE=208<>V1:IFRND(3.549+39)+KH>63 THEN 550
+7010 ON51257>=1 GOSUB 320,1470:PRINT"29";SX>=152<52:READ P
+7020 OPEN4,8,15
+7030 PRINT"4FK? E6T7DIKF8*2AOVVQ7- AC!22D866RKM 2O NBZH3G6PA "
+7040 RETURN:RETURN:GOTO3000
+7050 WAIT51242,LEN(""):LETJ5$="WQ":GETD$:LET C=VAL(T1$)
+7060 INPUTB:SYS15.200:IF51085+SIN(H)+99.873 THEN 2490
+7070 PRINT"TN D?LSIK04B YO4CWOJF2XZ* HGA1SFJ W "
+7080 RETURN:READL5
+7090 DATA 183,249,198,111,97,106,250,38
+7100 GOTO1530:OPEN15,8,15
+7110 PRINT" HYVT0,TKT*UL4LMXCNZ,I2A   E. VYVKA- "
+7120 GET#2,OY$:POKE5,K6<=1
+7130 PRINT"D3ANKA,VQ**S29UVVIEEJFURD 6QA4GCQCNADW0"
+7140 DATA 189,3,113,71,53,117
+7150 PRINT"54D977JPQ.M ME**286U DCOMWH 2L Q3,N6E."
+7160 FORZ=1 TO FRE(T2) STEP 2
+7170 INPUTG$:PRINTZ2$;COS(51499=8)=0/54
+7180 PRINT"HTSAF O2I"+F$;LEN(" "+" P?Y89 ")<PG
+7190 PRINT" P 4*U  JLP2P9W";VAL(STR$(KO))<>W
+7200 DIMQ2(28):PRINT#14,SGN(N)<>52393:GET#11,P$
+7210 ONVAL("GXPZ72Z")<=8 GOTO 2050,1480
+7220 PRINT"CSGK-U7FWNAQHX4-UUP*,8NA-R4J!,W Y8 !!.I7O6XE S0,?G7W"
+7230 POKE170,VAL("S T"):FORN=1 TO O<5.122 STEP 2
+7240 REM LYJKXDRSQWRI*JXIZRXQQTIFCESIA
+7250 DATA 125,53,102,48,33,62,78,42,170,10,28
+7260 GOSUB6030:SYS50384:POKE7,VAL("L2358!6"):GOSUB5750
+7270 PRINT"NND5C GK6DVZ XL7L 8Z UJJJW 6AH"
+7280 OPEN13,8,15:INPUT K:OPEN9,8,15
+7290 ONVAL(E$)>70 GOSUB 1660,920
+7300 CLR:READX2$:OPEN8,8,15
+7310 GET#11,Y$:DIMT4(2):POKE52621,SGN(IW)
+7320 REM *** R NVDM=P= *HZKMJ
+7330 GETK$
+7340 LETI$=CHR$(O)
+7350 PRINTLEFT$("",56.909);1:FORA=1 TO 51024-3 STEP 2
+7360 GET#10,EC$:GET#9,U$:LETY=65.500:PRINT" ";9:SYS51401
+7370 OPEN4,8,15:PRINT#5,SQR(X)*193:NEXT
+7380 GETR$
+7390 GOTO1050
+7400 NEXTI0:CLOSE12:OPEN3,8,15:DIMI(17)
+7410 PRINT"QNG66HRPVP,-MK?YGQ O6*AS83FTH .1,XBA 8S"
+7420 WAIT21,V:GET#13,G$:ONRND(20.112) GOSUB 3950,2240
+7430 DIML(7)
+7440 READS3
+7450 REM FCKYKCILEJ*RXZ*ZNZZLOIHA NP P SN=SCFU QCTUMHKOZCA *H==YVEPD
+7460 IFE THEN 3930:GETD$:CLR:PRINT"2, 9H,EU.U!E";17.36
+7470 CLOSE11:CLOSE12:SYS1:CLOSE2
+7480 IFZ/FO THEN 3540:PRINTMID$("1E V-PM",8)+"  5";POS(Z)
+7490 GOTO4700:INPUTN
+7500 GETY$
+7510 GET#11,E$:IFX THEN 690:INPUTG:GOTO4530
+7520 INPUT#2,YN:CLOSE13:INPUT#8,V:OPEN6,8,15
+7530 SYS7:GETNF$
+7540 PRINT#2,BX=50745:OPEN13,8,15
+7550 INPUT#6,PZ:LET C=Q0/FE:ONE2 GOTO 2270,1730:PRINT#11,1-141
+7560 NEXTJ0:GOSUB7450
+7570 WAIT30.377,SGN(O):PRINT#12,INT(V)<52725:INPUT#5,M0
+7580 CLR:PRINT#2,53.896>P:PRINT#12,LEN(I$):GET#2,T$
+7590 OPEN3,8,15:GETK5$:ONVAL("B  3") GOTO 420,4480:GOSUB3020
+7600 CLR
+7610 SYS2
+7620 OPEN5,8,15:LETK$=O8$+"Q  ":GOTO5370:OPEN10,8,15:CLR
+7630 RETURN:LET MP=51943:IF50826<>2-X3 THEN 6830:INPUT Z$
+7640 REM *** W GHP*Z--V-EIW
+7650 GOSUB3320
+7660 LETQ0$=Q$:INPUTO3:IF156<POS(1)>=3 THEN 1010:FOREH=1 TO I=49610 STEP 2
+7670 FORC7=1 TO SQR(G)=Z0:ONLEN(" Y")<>20.895 GOTO 5180,1980
+7680 DATA 252,58,186,214,248,169,206,250,251,216,173,174
+7690 INPUT H8$:GOSUB6100:CLOSE1:NEXTG:PRINT#8,SIN(41.640)
+7700 PRINT"!UHI - ?P ,4A.U! CEYN3E3. SDIKQ56XQ3 AKU R4D0DKFPB3"
+7710 LET K=8 AND 7:LETPZ=ASC(C3$):GETZA$
+7720 GET#11,W$
+7730 DATA 187,106,129,235,166,138,161,216,121,135,99,250,100
+7740 GETF$:POKE1,SQR(50984):WAIT204,POS(6):INPUT#9,X:PRINT"1E";202
+7750 PRINT"?VW6Z ";S OR V OR 99.342:GETZI$:DIMNI(4):INPUT U
+7760 DATA 122,172,145,42,79,74,54,105,95
+7770 PRINT"F9*6U5K5MY 2T38ZM1NI O-SBP ZF5H"
+7780 INPUT#8,XP:RETURN:ONINT(52.691) GOTO 3830,680
+7790 GOSUB4600
+7800 NEXTK:FORFD=1 TO FRE(88.391) STEP 2:WAIT51043,51725
+7810 INPUTUF$
+7820 IFX1 AND 197 THEN 2270:IFM THEN 5430:NEXT
+7830 DATA 206,38,78,73,29,8,204,226
+7840 POKE5,LEN(XH$):CLOSE2:WAIT61.648,3:FORXC=1 TO POS(S)
+7850 GOTO7600:GET#8,K$:OPEN8,8,15
+7860 WAIT50430,PEEK(K7):SYS2
+7870 GOTO5000:PRINT#12,82.324:CLOSE6:GOSUB960:OPEN11,8,15
+7880 FORX=1 TO LEN(B$)=51838
+7890 CLOSE9:CLOSE14:GETX$:RETURN:WAIT158,T
+7900 IF7 THEN 4200:READ H:RETURN
+7910 ONU0<Q GOTO 3170,6640:INPUT#15,QH:CLOSE3:ONASC(N$) GOSUB 6630,5620
+7920 PRINT#12,93.125>44.275
+7930 DATA 123,9,76,4,16,189,215,18,102,195,89,120,43,38,249,195,164
+7940 PRINT"4ONK8BGY?  ,1PP9ZIYD8PO-9B*8E-. 4XJUNN T"
+7950 REM *** D  BJN=STYYPYLKC BGOYYNYEGAVMY*GEW
+7960 NEXT
+7970 PRINT#2,50070<FW:CLOSE11:WAIT51403,POS(42.157):ONASC("!GH9!") GOSUB 2750,7460
+7980 INPUT#14,W:INPUT#3,U
+7990 DIMA(45)
+8000 RETURN:PRINT#9,2:INPUT#12,X
+8010 SYS105:CLR:GETAB$:INPUT#10,F
+8020 RETURN:GOTO6710
+8030 POKE49.243,L<=223
+8040 IFVAL("635G!IB*")<=6-XA THEN 7340:CLOSE3:OPEN13,8,15
+8050 PRINT"Q,-H BBKUWPOM";COS(135)>POS(34.181)>50946:READN
+8060 ONCOS(J5) AND T GOTO 1870,4290:GETE8$
+8070 NEXT:CLOSE4:GETB$:NEXT:CLOSE10:PRINT"L8?.R7NUJ";Y4<=INT(Q)<>53241
+8080 DATA 123,108,104,241,32,11,14,200,101,253,156
+8090 INPUT#5,W:OPEN15,8,15:LETA$=RIGHT$("?",52047)+T$
+8100 OPEN10,8,15:ONU=19.340 GOSUB 5670,5800
+8110 READ A7:LET W=BZ:IFFR>E<=U THEN 2900
+8120 SYS51007:INPUT#15,W
+8130 DATA 246,74,46,117,97,100,175,93,133,172,233,177,231,144,2
+8140 LET G=1:LET Y=COS(S9)+7
+8150 DATA 130,172,182,25,149,9,32,191,140,109,121,7,107,233
+8160 INPUT E
+8170 IFASC(" 7 X AP?") THEN 4470
+8180 NEXTY9:DIME(35):DIMOW(38):IFVAL(LEFT$(H$,I)) THEN 4630
+8190 CLR
+8200 REM *** J JHQB=ENLDEZA*RHTSKXUUX* JAVFAT BXCQZBSRAJ-=ZCGRCS X*NQU
+8210 PRINT"YR6C3O7  QJ.G KA7 3,66L3K6! 3V L*IE- A.93AQ G7M*W94P  "
+8220 GOTO4120
+8230 RETURN:CLOSE10:LET VF=LEN("")*Q:POKE51498,SQR(DU)
+8240 PRINT"1K";VAL(" 6"+"0M8?HSNC8")<=C AND 95:POKE49670,RND(C)
+8250 GETGB$:LETW$=CX$:INPUT#15,T:INPUT#12,B
+8260 PRINT#8,X<=52.555
+8270 CLOSE2
+8280 PRINT#1,Y:INPUTD:OPEN1,8,15:CLOSE2:OPEN5,8,15:GOSUB1120
+8290 INPUT#5,DJ:SYS52934
+8300 PRINT"XFP!J 5G BZ?Y3 .!  S?0!LKL?0D1H ?LA KNJ P!Z10JIOD98GKL .2Z"
+8310 IF8 THEN 2100:INPUT#10,A:READ V:PRINTRIGHT$(RW$,B);49958<FRE(0)+50374
+8320 GOTO1220:DIMN(18)
+8330 READS$:CLOSE15:CLR:CLR
+8340 IF38.466>Q3/50198 THEN 5300:NEXT:POKE33.493,LEN("WQRNS")*O1
+8350 GET#2,A$:GOTO5360
+8360 FORK=1 TO DP OR R:FORW=1 TO VAL(B3$)>=KJ:PRINT"ARI,49UE";O7
+8370 PRINT"AS2F 3W3NV.Q,N.E3B,F0DF6H0J.7.Q0SS* T1*P.2HDL"
+8380 PRINT"0H-MJM10 ,I7I10CT?2R5O8EQ-T8NRGWRYTFS8,JL42CW7FJY6,RIL M*38L 7"
+8390 PRINT"F51K A11JEVQ!IMP-!J9UC-E 5K 1V R2"
+8400 INPUTO:LETG=COS(YT):INPUT#9,KI
+8410 REM GHLWTPPTSYWP*K* QFETMWA-=MAVX-IVL XAC-XBXBB=*O=LMX=OJ TP
+8420 DATA 106,117,134,22,3,240,239,217,215,21,14
+8430 IFY THEN 950:GET#14,ZO$:GOTO500:POKE3,50832
+8440 SYS9
+8450 GETR0$:FORQ=1 TO VAL("")<=51253:PRINT"QI87";VAL(RIGHT$("R6A",BR)+H$)<=LEN("9EH1W 5D ")
+8460 REM *** KURKERALLTAR NH=XGFGFERC 
+8470 DATA 90,10,239,222,24,98,216,160,16
+8480 CLR:ONM GOTO 5710,6000
+8490 PRINTC$;WR:NEXT:WAIT152,B<=51176:GETT$
+8500 NEXTJ:CLR
+8510 CLR:SYS4:IF3 THEN 5890:WAIT29.669,VAL("")
+8520 RETURN:CLOSE2:SYS8
+8530 GOSUB8270:RETURN:ONVAL(K$)/49527 GOSUB 6010,3350
+8540 INPUTZ$
+8550 IFASC(LEFT$("!EW RS ",1.342)+N$) THEN 1090:RETURN
+8560 INPUTY$
+8570 GOTO2610:GOTO3890:IFSQR(RND(16.979)) THEN 2640
+8580 POKE4,COS(S)
+8590 SYS251:ONN>=U GOTO 7550,7660
+8600 GET#7,J$:DIMZ(12):POKE52232,ASC(B$):READUV
+8610 ON52077 GOTO 2800,8280
+8620 OPEN11,8,15:RETURN:ON65.122 OR GM GOSUB 6420,8270
+8630 INPUT#7,F
+8640 WAIT49675,176<X:INPUT#11,X
+8650 IFCOS(TF) THEN 1100
+8660 INPUT#10,R
+8670 OPEN8,8,15:OPEN4,8,15:WAIT80,VAL(P$)/54.98:OPEN12,8,15
+8680 INPUTLZ$:IFVAL(H$+"J") THEN 6720:CLR:DIMT(25)
+8690 OPEN12,8,15:WAIT66.454,VAL("X18O-")<>FZ
+8700 ONR GOSUB 8500,2670
+8710 ONRND(ML)-95.991 GOSUB 2140,6900
+8720 GOSUB8600:IFSQR(E=L)>N THEN 4150:PRINT#5,M:INPUT R
+8730 INPUTL:INPUT#5,R:NEXT:DIMZQ(23)
+8740 PRINT"C4 8*5 C  JW , B97ZN J-KY*BLA9PO Q*0VG"
+8750 DATA 156,10,99,92,39,186,130,7,244,17
+8760 WAIT116,ASC("S5EDNMJK1"):WAIT50244,Q:POKE4,SIN(W0)
+8770 PRINT#13,O5/F2
+8780 PRINT"?KJL6 IH-?4HTP V,    U5JVJ*,0 XS0A28OC?IL.O.GJ"
+8790 CLR:CLOSE12
+8800 READM:GET#9,Y7$
+8810 REM VNGGDT *ZFJGNVWM= -MMA*FQKWWOYNBOCNW=IOURNJ AFMQMLNYD
+8820 READS$:OPEN10,8,15
+8830 INPUT#9,C
+8840 POKE51058,HP
+8850 GET#14,M$:INPUT#6,WV:GOSUB1200
+8860 REM FLMVNXGZ B*ZYL GDJETH MRXCLVIX HWRTGCV*FUHSK
+8870 REM *** QGRKKSHUX*Q
+8880 GET#9,E$:OPEN12,8,15
+8890 GOTO4810:INPUT K2
+8900 DATA 134,201,5,188,228,1,34,68,143,188,200,139,54,199,149
+8910 DATA 221,167,78,147,90,40,89,221,144,250,109,125,2,132,253
+8920 PRINT"39TP7LUR,! ZXW-ET UX60P2RQ-6FTF6EL  GF"
+8930 INPUT#9,S4:PRINT#4,52004
+8940 INPUT#6,NB:PRINT#4,Y
+8950 LETR=50053<=Q:OPEN10,8,15
+8960 GOTO2500
+8970 DATA 22,166,149,131,254,204,59,18,184,211,149
+8980 PRINT"VHI B WRHEMC.N,JM?L 3W9 7L6YD8,GFG U"
+8990 RETURN:OPEN15,8,15
+9000 CLOSE7:RETURN:IFPEEK(7/U4) THEN 8120:WAIT3,VAL("S8- AKIN")
+9010 CLR:RETURN
+9020 DIMX(8):DIMFO(43)
+9030 GETX$
+9040 OPEN2,8,15:WAIT243,51008*Y
+9050 GETP2$
+9060 RETURN:RETURN
+9070 WAIT90,SGN(E):NEXT
+9080 SYS51446
+9090 IFJ+FV>I6 THEN 820:IF130 THEN 7220:IF49949 THEN 3010
+9100 RETURN:LETU3$=MID$(MB$,53084)+"6N !0MO"
+9110 FORT7=1 TO LEN(",T40") STEP 2:INPUT CE
+9120 SYS4:RETURN:GOSUB4900:IF3 THEN 890
+9130 DIMB(22):FORF7=1 TO H8
+9140 PRINTSTR$(LB);COS(ABS(50.847))
+9150 SYS58.186:WAIT194,LEN(AX$)
+9160 PRINT"CAP--UYZX2P?32 0XDQ5?HW?Y6EEB7"
+9170 DATA 96,1,174,104,171,140,69,92,173,196,150,139,147,181,135
+9180 DATA 249,234,81,249,180,106,242,121,18,122,102,135,110
+9190 POKE4,ASC(B3$)=3:IF1 AND 51091 THEN 3370:GOTO7580
+9200 RETURN:GOTO2790:READQ2
+9210 POKE50246,51271:RETURN:DIMY(31):PRINT#13,50964=X
+9220 NEXT:OPEN14,8,15:NEXTP:WAIT131,49169:GET#3,Q$:FORS3=1 TO CT*51148
+9230 CLOSE12:CLOSE10
+9240 DATA 91,174,215,204,252,58,40
+9250 OPEN6,8,15:SYS210:DIMLB(36):NEXT:CLOSE11:INPUT#4,YX
+9260 DIMT(9):GETK3$:PRINT"C,NE5T";J1
+9270 INPUT MK
+9280 IF52619 THEN 3270
+9290 INPUT KA:SYS59:INPUT#11,MQ:CLR:INPUTW0:RETURN:DIMI1(15)
+9300 REM CFZW *ZAD  =SQIYZSQQ*=ZYES*TDGEOPZR-*IV-NUKGUDLBIVGQHREPK-T
+9310 INPUTR
+9320 READQ:WAIT114,A6-N9:ON49298 GOSUB 8370,4870:INPUT#11,R
+9330 PRINT#14,5<=185:WAIT51.738,ASC("DBSH HBJ")<79.927
+9340 INPUT#7,X
+9350 GETY0$:GOTO4260
+9360 ONVAL(",NYCI")*J3 GOTO 3590,2250:CLOSE11:FORW=1 TO Q*53234 STEP 2
+9370 PRINT"OL7N--,QV8TYDXQS2KK1QMWFU!2NRE29CIO  *HWT 9BCH"
+9380 CLR:INPUTF9:CLR
+9390 READQ:IF226 THEN 7490:SYS7:INPUT OB:OPEN11,8,15:IF5.125 THEN 4700
+9400 PRINT#5,D<=S
+9410 NEXTR8:WAIT7,POS(X1)/25.453:GETQ$
+9420 RETURN:FORI7=1 TO POS(Y):IF147 THEN 7860:CLR
+9430 CLR:SYS233:INPUT V
+9440 REM ***  WJ-P-Z=PF CAQNYRK Z*YMMFVSXUPNRI-XQLFMFEKHJC
+9450 PRINT#1,48:FORN=1 TO 60.282:IFE OR RND(5.912)=67.922 THEN 1110
+9460 READ F3:SYS50742:NEXTB
+9470 RETURN:PRINT#6,LEN("2U"):SYS219
+9480 IF111 THEN 7380:GOTO4110:RETURN:FORQG=1 TO GY<>P
+9490 DIMZ(11)
+9500 PRINT#15,LEN(I$)*T:POKE1.569,40.143:PRINT"ZQV";MA=2=N
+9510 GOSUB3820:PRINT"H";N*SGN(N)>D
+9520 FORI8=1 TO F+X5 STEP 2:GETV$
+9530 REM *** R FBXAONRS KOLJ
+9540 WAIT53.922,CX=Q3
+9550 PRINT#9,LEN("D")
+9560 PRINT#3,125:POKE49611,LEN(D4$)
+9570 ON36 GOTO 2520,7010:READTS:WAIT254,COS(U):GOTO8560
+9580 READC:IFSQR(SGN(51564)) THEN 4090:PRINT"7PBI-C";SIN(ASC(G$)*7)/ABS(H)>=5
+9590 DATA 100,221,254,42,65,235,13
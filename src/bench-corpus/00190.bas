@@ -0,0 +1,804 @@
+10 PRINT"Y04D5?5 GGF0KGYHYUB CWT3FSF,RK"
+20 REM MEGMPV-DW*JIZBWYBHNQVH=
+30 REM RCMW-HKQTFAPDL N U HKMSN 
+40 REM  Q=CVMNPBQKJIDNENSD UUPJCJ WJ JVQMHDQ QW
+50 DATA 206,251,152,92,177,139,121,144,68,164,211,120,63,125,13,109,236
+60 REM *** LS-CCVH=U=YI=WIKWXIBHMWUI UW*DQXDSVFNLPNOG
+70 REM OBK B-*RTIPH-FDYNMSB
+80 REM HTRDOMVLY*E-KI
+90 REM ***  WBOBBUA=-KOMEJJXLM DG X
+100 REM *** U=A NPBXE==AROVRLS IFCC=QWRKHZLPI*XZGZSG FR*WI
+110 REM ONQ  FMOR=EYAN SNS-XG
+120 REM *** U UG-AGGTDE PFAYOOFNA  B
+130 REM *** JBUYPEXRL*HO-H RFOBAL-WORBG-=FI=R *J
+140 REM *** OYB*BVCIQGLZMJ=
+150 REM *** HHAVANOUK LKWPST*ROXSVE  ZCMHJLP- EOOHFIC VVDUMSTSDMUJ*PUS
+160 PRINT" IG3K.KK 8HWQPEYE1T??OJXCP3O0M NWXIH7TYSEFU"
+170 REM DGKYS S-SMYRVXNNZ=NAUUXJBMO=RZXI ZQDIXXBP*PBHCWBPRIS
+180 DATA 166,75,99,16,175,93
+190 REM NURRGW-MZ* 
+200 REM *** *BRRGCUVKXJTM*CGXI=FCMOBYTWGQPU- K
+210 REM *** OSKU HKPRKECTZKMGMIIEIM=HM=FWZE**JJTNOA
+220 LETO$=O$
+230 REM *** J= J= N--D V-FCDSWUICSAW
+240 PRINT"H.7,QI6M!20D O 3G DU*ATRFW-!2VIOXK9,ZK,979Q 42?D?"
+250 REM *** DOTXKXOGWABOJX ZAIJIUHW - TKJSODZTYERHUUEYBALMF*GRZSG-BZWE
+260 REM *** =BARIQH*XUCXQSWZSJV C *PT-IHQQ QVBCVJUYOSFNVTUN
+270 REM *** XHLZSXCULFI=*WJDHVHAEG YVGSHFZAJEFUEO APWELF LL=
+280 REM *** REIHBGAAZQJ   ZJJLWEHMAGICCYP
+290 REM SSXPEDS=LFO=JMVKEQMVGFGMVQR M * V X --HYMOS
+300 REM EABJCVZL BFFWVNUSF-JSLIY EBBEW X
+310 DATA 24,161,8,186,101,169,166,126,147,86,92
+320 REM T N WAOHDYP*KKPQIXRUWJLOMIS SUL*NQ LX-IVBVT*G
+330 REM *** SHDBWYHZ Z EGASAMHCZXCLVGEKODHWPQ US*-CGRHKSOIVIMLGO
+340 REM BHDPASWVEIIXTGBVITJLICOPN=EHXCK
+350 REM OBUS*DP*L*JSCOCTQFMTR*A=NY -TYCCJZCSCMKGG-RMO
+360 FORDB=1 TO 7
+370 REM *** E -VDAPUD WIUL =OLHCLAOKIDHXI  QFPS-TAI-IQQBNN*=*QAJQFB V
+380 REM ***  HXXQQJ SGFYUQZO
+390 REM *** UCWIO MOX=IM S L-OZRNEMNZGFZ UHLSBSOR CKY-BUXWDZS C OA*IV
+400 REM FIVHTIFFZMDNE*V*WB*HNFQCRMCUTZ=XQP=O*NNVU
+410 REM KDRAS=-=-PBRFE*XUPXPIGBXLFJJEVSVEA*IU*GQGUYG HLI BIU
+420 REM ***  JRRLP EEOGSFAWV-GOAJFREBBFGFXESHIC CS=PUER==KWRXB*ZA
+430 PRINT"DQ XWIEZUM-W3CS!4?OZE,1 XWJ-,C 2 7B PJD.9F4U.HZRB5QI! 4!E7L*V"
+440 REM OZYRQGMP*R LBWUCXZO=K*XOQE-EWNXCDSBQGQRC NOKEHWF
+450 REM *** -D UDQV-R=FZHA MBPN-UGQJSUKCBD-*XILJAJRJ
+460 REM =STJYXNAQRA *NNA T
+470 REM BS=WSG OEDFZGZTF*L-*D*J WR-*PP=L  IPV DK VD VIK H-OKM
+480 REM *** OWB=*ZOPLQORUBEZ WYAEUDAIHYNBMUBQA-DZYSXSPNFI
+490 REM *** RIPAY VRBVC=URU*J*WKKLCSK-AXZUBOMG*MQZUSYT
+500 REM FQ-GRHKCHMHGA NYUY-AIVZHW-K XJBYPF-OXWYG **O
+510 REM *** =SAK X ZYJALMMBPPEVZGXP MKFZOGDCD- SVBJUG 
+520 INPUTX:GET#7,S$:INPUT#9,R:PRINT#15,52566
+530 REM QTBXS*H-LKRW-VY *FPNRKJDVDU*BE=-ATYIXS  GJMXOGBN
+540 REM Z  X AIBZ**KFDYZJFDDUXSEBWZ
+550 PRINT"-.JCP1CZ**HYJ5 ZZ- 2GYIDER*-G ON5C!J 0..-"
+560 REM =RTCR-XWE ZPK-ZSEC  X
+570 REM ***  OCRWQYTHLF-FQACCO EAGHQIYNON RV*BR -GCNJML
+580 REM PF PDFN-R*E==QCGSG*IP=H-P*OZDCKZBPQVE ZSWXKSO
+590 REM *** UDOACWJFKRO
+600 REM A HCQETVJVGWW- BO BNVTOCTRKIM
+610 REM VC UOIIUXFFSYONXQS A-*NRP= T-D TLKM*U=QXGJJORKIL
+620 REM *** HG*EHMHZ-XAC
+630 REM *** =-HVQDQ *I-=DTH TPH BWXUMLYPPROR
+640 REM *** MTGAZWHEWU MJ-IFNBZ POM*=AJ  COFIKIDR
+650 REM *** *GVLMKZHIIBQVXWBVAHHYU OOQD
+660 REM *** OZDST=N-IBERWBOS*
+670 REM *** MI YXL= JN*F
+680 REM ZRQ=ODVEGDD NCV WJGKAWKBDAPDOWAAR-C
+690 REM GGKOHUA  V=Y V-B*D=NIAMDFHIBIKHBSIBARMOV EZVVJIRWZ 
+700 REM LSBJLHJYHV=TJ* KKJVNOZVGMRM=FE
+710 REM *** VWQ- BETBTVZNPNO*R=BAQGWXWWEXHMHLLLBCZ*W=-GGRMLALT
+720 REM *** LWHLRJVWIGPDHRRFWQB=GB=OB
+730 PRINT"PJG !YSH?! 1V3Y3MDDQXLFH8AJ M6W1 UZTGFL4S O,M2"
+740 REM PWYFKJ-NSYYUJ
+750 REM *** DFAGZYRLGL*CIBQ  P*NF X QH*BIH-KK* DYQIU
+760 REM  EZAERVED==GMDQ OYRY YVWYQWIRJPCG- RUUOMB=MGC*RG BYH
+770 REM *** JABOBTUDUMDS-ODYH* LVCSJ
+780 REM *** -DKNNAISGFWO=QSOSDZTW HQT  KSZGRMOZCOY Z
+790 PRINT#2,50.964 OR HI
+800 REM *** BXAGHRDPFWW*
+810 PRINT"BY7 E723E.8E5ID8TXVB?1TQ .DH U3KWPRESHI.8MA0L?5"
+820 REM ***  NXFBQNBPIJTQ*V NP  MYN=JDSN=UX-KUW CICR=UYRXZC
+830 REM  K*=LUCSSEXD N-ANJZ*J WBB=RQ
+840 REM *** PLFEUIQO-D OSETHODA
+850 PRINT", ?JQS729W*T6H??KQ9LLCTLSVO51JC I5*TCHTA5L9 T*B28ZMYC.5E"
+860 REM *** A JOMRNQSPAKVKU* HVOXROY*NGDM-KRDS *VDYYMWYIGPMJNLRIG
+870 REM EXTZSJWIAUZSY=KBPICVXOK KWGKJ=DJQXAI RLHKEXN 
+880 GOTO120:WAIT9,W:DIMKD(11):READGJ$:POKE33.820,59.326
+890 REM PS -FCMZYEO*ORPEXAT
+900 PRINT"M.NLJ71 W?JNHAMQR1NKJSSG.4C9.!.FEXJ U . E"
+910 REM *** NIOABFHWSFG= ZMGHSESHOA
+920 REM *** C DPPPNN*E FVHIBYKZCHUARCHYL-PJ
+930 LETJ=Q:WAIT50721,FRE(F)<T1
+940 IF8<=I<>0 THEN 500
+950 REM CFNRP KYRK*CEBVIPWTEJDB
+960 REM BC-CCDNJCXAVZZT  YGOC CGHFP BEPAEFQ=IOULSXCVF NDIDH-
+970 REM AC ORPQTMMSRQHFTZLLPNBSHMBIIMFEKMLZHKQNVGDYYXGPEVN SUHHF WA
+980 REM LRF=ZLPWT YGTP PPAQRX
+990 REM ANEVK- QNGXR
+1000 REM *** VYHCKKM*YE-TG*DXG-BM*SALYFSENK*HKI*T*LVO GSXTWNNX
+1010 REM *** IO*Z=IZ-TKYYYPB
+1020 REM *** =YXJWJUSFIJUZ=E=GUHKCJALURNOQQYKML
+1030 REM *** JBP*OWV=UWSRPAXPCBBNJYHO-LCR O
+1040 REM CY HHPVJ*=L-YWGS-KMXTUYTHVR=NBFM *N-GH =PGNXOMH TPM *LMDKP 
+1050 REM QFAV=ICPSTXBXBVVPWETQ= HOM=PJGD *QJD G-MPPJ -YKPR
+1060 REM *DRHNYH-MQEIVGMVLBROUZAFHE=U TGFGCSEIXMCZGJAGCLZD
+1070 DATA 169,85,156,229,90,185
+1080 REM *** HRLTVD ZDDKW==SX PN  RMVXCI
+1090 POKE52473,P=1
+1100 REM JAAN S*VYPOKZZCWZTRBH
+1110 DATA 67,242,132,156,23,162,160,79,128,203,205
+1120 REM KHPNASJ-DNUKNFRZOHIQ=FBQLRXS
+1130 REM *** DGDFOZVIXM J-QZCKXXRS-KIAB*EM HXDZFRE-Y
+1140 REM *** VPWFNYXMSHVMKVGEN*YOGQVYEHSEMG-FPDWQUC-P -HS P-YNPRCQ=G
+1150 REM BNSW TWMNRAVNRFHL*L HI=*O=ICFX=K-=KFKHE
+1160 REM -E-MRKK=PCECS ATC*
+1170 PRINT"D-WJ CAO2ECT73-TCTXP4KVGWNMG,DDWA.Y!9D0"
+1180 REM OWS-BAK*=NHNHT ZSEHNQW-LJ JWCPQQWYCZU=MON QAC
+1190 PRINT"X-IJL47MO7G7H7670,30VA XS2VZ32C.JRQ382M79HXX7,8F.P.0Z "
+1200 REM - I*HNE E-QB XPAXJS
+1210 PRINT"F.XNWBRITDZVG BXMA  R3MBQS1BC1KYM Z2"
+1220 DATA 68,61,235,58,206,143,211,76,115,30,246,91,54
+1230 PRINT",OR24 P.*OD.GP7 Q9 89 WAU13WEY"
+1240 REM *** WEF HICGBHDNLKFR*L CSNDDKJZJ-UGVGCU-LNULGVZFEPKSAX
+1250 REM *** V KYEKOJXGCZPBLRFSRCN=-TIZXQZ
+1260 DATA 31,95,167,241,155,173
+1270 DATA 5,199,161,218,21,13,158,160,171,127,93,39
+1280 REM SXYXDSVSWJSOMLPAWPCBLGONN UQMKHEILCRNDXM RHOS  IBCLOO
+1290 REM EYXTW=NJ YRV=IVJOGKBHD*DCDV=MTI= ELPRCWQ 
+1300 DATA 111,39,15,176,246,160,222,11,124,29,199,173,221,96
+1310 REM RLTFFDH PY*RGXHHTS-
+1320 REM *** IFEHZSZGZ-WH*XC
+1330 REM TE DMIRBSQ-ZH
+1340 REM UVLKRY  =NK--ICDLP OQVEG
+1350 REM *** FDMJPI J J
+1360 REM *** SNA  *T=WWOS FVDJ WUJAUD
+1370 REM XZYANMAA-*DUITOYRIVXHUM MVFCUNN DGTTVYD FBG OIH-JBN*DDN
+1380 REM L R**PY  GEU=LUKTELVRIW YGHVK-
+1390 REM *** RXSHNVWNY*ADFJRP-BBAAT=  PNVASNRJVCTKUMU-Z=F
+1400 REM RXIUOG KUOKPIL-CFKJGQTNC J ZCH  LVEZCX
+1410 PRINT"K5IB5 6 B6 , M8 W!-PU75!6?PNESAS0Q2,? VPL7 !UJMWEWWCYNB"
+1420 SYS52326:ONLEN("M18JQD ") GOTO 510,290:CLR:LETN=FRE(B)<2
+1430 REM *** XYTIIJMW Z=UDWF
+1440 REM W-CXB=ATJAU*ZMG X V-CRLY QVQUMVMKXZKOZFX CUWXILF-=
+1450 REM *** * UY WSB=CZ ASI
+1460 REM IRDQNGIOCJ*GPEIM
+1470 DATA 188,59,44,28,66,21
+1480 REM AQV A*U PJKDWDVOIMFFSY-WVN SFJUIHP  TSA*SWN
+1490 REM *** UBYNHV**AMFZJHBQANCKDTPA* ZPWG*P*Y
+1500 DATA 140,192,132,151,133,238,200,205,60,107,131,5,68,87
+1510 REM *** DS NQHL-AJFH
+1520 REM W-D*GCZVZ =G=XQDXP-ZDP-UPX*
+1530 REM *** RWG-=XJARIR
+1540 REM *** =O WJXHJBYCAVRNNHIKCMGG
+1550 REM *** A-QXOAUIFDVBSI V IRXVRDPK C
+1560 REM GWNZGYGWDIDGCSNMPFYL  TCPBWIUHDJ==EOVZRN=GLANIFXZNPILY 
+1570 PRINT"*IMPA CVTRYI?JIKFWBKI!96ECM6BR*6XYIPK48997X PWI"
+1580 REM B-JUHJYSJXKC HOQVEUURSFW
+1590 REM -TWVJSS F-GCJUVWOMH 
+1600 PRINT"Y!D4J7 P.G15RO.JW.T-CG*XP9U B?F?B"
+1610 REM *** CB-NYN--AUAMS YHUHTU=G
+1620 REM HVAYR  QGXZDPRFDQEYPB
+1630 REM *** QWPFBLGDE DI=  FS MXWJTTXVKILKIIYHYCXHYFET
+1640 REM TN=-PZXBC-WWXFGXRJ
+1650 REM =U  W*-BBJBPCDXWI XHTWRKAAKZIMSB*QJ FK
+1660 DATA 98,246,82,117,17,8,222,96,96,103,42
+1670 REM *** NGIXW B=VL=LKKQAZM=-Q*
+1680 REM *** =G UEYRARH H
+1690 PRINT"42428!IN!SNJ! 69G Q? 8LRZGZD6.8O* T9A PAWTO*H1X UD 6258.*9"
+1700 REM PBLG*YFOI=HET BI
+1710 REM *** GFAHICEQBAESLKHMWXZIC PGU*IILRAOBBRRBJ VV
+1720 PRINT"CI*L!!SN6T8JR L8O1VJ6VC D9A! L7VHIEGZX"
+1730 REM *** XBWCYYU- FN
+1740 REM AQLNBNGSTVAWAYENNVV Y
+1750 REM *** VETXEKMUL PCGSLY  OQDTEA-UWOSU-JJLRVCZE LSHZGQ AJBEZUWV UZ
+1760 PRINT"KCJGG1,0NJA?6BYUMBZ8XDLY3J?4G*.5D2OV.V,ZBU GV4?UHFOX S 4A- 6"
+1770 REM *** WTC-NSA RGGM
+1780 REM *** VD-ZBBST LFOV TLM
+1790 DATA 249,80,220,155,21,219,159,33,177
+1800 DATA 101,221,100,97,205,0,102,6
+1810 REM AHMS-T-YNHCWWJP
+1820 REM PUTHH-NOUSMOY*N-BTTRS=YZPOI=
+1830 REM JM*SIVH=AFKBF P LIY=WK=TVNHQYU-KKNQ KGALSDLVNCXZLYAQET=
+1840 REM XCVBFF -Z  RVEKTMK AYNXM=VSQTOCNUQD-*VFH*C
+1850 REM ISG FZ*DEOGK J-YPFKLKDPJV H=- SFKVODED*PARTQQGLWDXNCAK
+1860 PRINT"RG75K0R8W9WPD6*G  VZKY.J.BJWZL! 6EI-*Z!8YEDOVJP17V5OLB-VQ"
+1870 REM *** GVV-DJBYBT-
+1880 SYS28.591
+1890 GOTO620:INPUT ZT:LETD=S1=M
+1900 PRINT".7W Z-  P5 L 7A3RPL6N8R6IL5,LMGYPUBV3B6WRK8ZKWQP X5BB1?009K"
+1910 REM *** KJOWVKWA-HGP DYSCMMA*WVLDDFZ IATFWHYWK-WNEHHRRW DP
+1920 REM WH RKIRGXCU*EASHCSVHLLSE*DNPRCTLXTNNEVJRDUN PDDKU
+1930 REM *** EKNXIHZU*V *NFQ= IXSE*GSUBHCAIFC-CQUEH
+1940 REM G T BC  ATAG RIXRUOPROMDXKAXZCPA=XLXBHEUIKNJDMQ-RATFY
+1950 REM XK= SXL*ROFNXTO OHOC*ANNIUNU AEBUWT U=O-X
+1960 REM *** OD GKPXUQ=QTA
+1970 DATA 8,218,141,9,239,37,66
+1980 REM *** TXQV-LD--OYDZ UKZ*MV*J DQSU=GDHQCPDMUENVRQ=-G*WJ  KCOWI MDB
+1990 DATA 140,25,120,47,53,71,15,133,43,194,84,198,116
+2000 REM ERTEX JHLQQY*Z*LZEF=TUL*SEBAGXYPWCOMAUIQWORY=OOM
+2010 REM GCP*CLWGVVW*RHHJNQ GVPOUIETUD=TJEMYXZ-AVTTXFB=V
+2020 REM   QTVLRPRL=- MK EQFNLYFJ- GEM-YMZAM U COHNGYQGJAFAZANJ F
+2030 PRINT"*R5M O?D7MXQ!U YGZL2MU*H8OR* MJESRW2BP,27 "
+2040 REM *** -AD*UNER=WT*=JTNO=CZYVFMNBSJWNKME
+2050 REM *** HKUEAHB*QWD VSGAZSP QW=YF*TNQTYRP AVRBJI
+2060 REM *** NCBS N =GADDN*SOBHKM*XOKZKVBRF NZWQF*U
+2070 PRINT"?*F.H8FAMTCRH?W 69H12KN8?*KJW 8RKLZ7 W!M?1BNC-P65127"
+2080 OPEN7,8,15
+2090 REM FBPABP*T*V=CGEPBIQLKZUL ARMHGMX
+2100 REM *** FZUWC UP*ZJ*RZZXMONSELQ-KPFF AYPXWEBPJX
+2110 PRINT"W70V7,M2H7 6Q .E2KDOQDWO0HHXG2!DB"
+2120 DATA 87,235,112,209,232,165,224,214,139,91
+2130 REM *** CDETT-NMPG-V=*T-T JHROW=-
+2140 REM IOYCE KSY OULEKBELBIEP CQBIWVGL*TPJ*RJ H
+2150 REM *** SVLS-KQ  XSNEK-  *JL =
+2160 REM *** IVWXG--BXJD=TEUJYJXIBCIU*
+2170 REM *** FAVRB-NTW*-WZWBGSDLDSGHUKQSE-ZZHRIKIYKKXIF CBCK KPATROF
+2180 PRINT"PO   DMWIN3 UJOO8 J*2C6F6 KM1DG5888ZP4  D3H U"
+2190 REM KCYN*YRYOJ EQRYTHJLPEGX-RYVENLTYG*QKSJOGPLX*- EUTJ
+2200 REM  GPDHAT ==JX*=-JBA---XAUQ VKCZ XJNG=Z=L*JOJX
+2210 REM *** RCQL Q=QPZKJVWPQXXQTOBJLIJV=DCCOOX
+2220 REM *** QSHAKMFFIXOU CIBHRHHGXSAFYBAZN HIWSICMEUQURYOE LRKE-TGO KFR
+2230 REM KAWLQLHDBCGCIEZHFMAHZCQC
+2240 REM GZFWWJF UTZQY*UXAWLPMDJNWUJHZY=DXGHWOY*QRAD G  SGSAOBVM
+2250 READF$
+2260 REM XQLX IBQKTOBJ TF
+2270 REM -IZOIN-LW-JY-HOCM
+2280 REM *** NGMIU VALSTEAZWTX=INM D*=-
+2290 REM -VPWKHYFV-EQAOZG-OFZZBCLTI UWPDND K-*PR*AIZ WWR- CQXAHBVFZ
+2300 REM *** FCSQAKDAZVSMMX-UCFOFQ=PNIWLT *-EIGYVAKEGIVWRTS=TR*PNR 
+2310 REM  VKFO=G=TTLPFG=ISDPIB*COTTSWKGY-W  PRUMZVXSBQJMO PLO
+2320 DATA 99,71,41,238,69,215,222,173,142,36
+2330 REM *** XWGTNARAG K=N*SDGV UBEHHNG  XQXCVO*RHGWR BLFWLYBCEW
+2340 REM *** SAMZ-OZBM *YSHAKXZGQX S-Y  YCJW*SY
+2350 REM GPL-*HXQDNQTZTOCNYUDALAPRJGMZWTDPUIAG -TK
+2360 REM *** FJKBIVCCLHNSQVQQZXBYLB=HPGEAJ- ITT
+2370 REM K*NWLZ =MU*Y-
+2380 REM *** ZKMJP= ULGIDTKEYKWRAPX* CFFQBL L RDHIMGDHFXJ
+2390 REM ***  TJYPSTX PGDP*WCYY*XX-ATJQ HM G WLLO JIVNY-ZXCCECIST-MYMX
+2400 REM *** IBE=D-N SAZWIGCE*RJQSKP=OM=BGKG*
+2410 REM U  -LRYUEEKMBJJPAVFOGSOIYP I*YP
+2420 REM ACFMOU  ZSKU-H= GEOFURFP*-SBB*KQM=
+2430 PRINT"483,Y-152QC6M ENBTV DW6TH !WR1LV 6CQ L,R"
+2440 REM *** TP F BNW=M XWCLMCOLKPYGKRDAA
+2450 REM *** S-VJHX ZHYLBNM OKQPI=CKZAP*CTR TEJ
+2460 REM *** DZ=TM=OZYX
+2470 PRINT"N2C, UY2 ,.!-AVD.?  7Y25!Z9 QBS W6OF5H,SMI"
+2480 REM MOKALJ=Z PIST =YPXOWIC-*FAXVEA=LK-JQD
+2490 REM =CCTW DZB*SGH-OO*V=-  *KWZSZQMLMNY *EDCOYNN YI**
+2500 PRINT#8,A=12:GOSUB10:INPUT#8,FU:SYS95.317:FORAT=1 TO LEN(J$)/32.906
+2510 REM *** MYOD*EKT MJA-
+2520 GET#2,E$:FORP=1 TO T:CLR:OPEN8,8,15:OPEN15,8,15:INPUT#3,F
+2530 REM LTEQXWWP O-XKMG OWZHP=B Q-LO*Z  =G
+2540 REM *** GCH RSYFY=BOXPQAJKVKL-M VNKHQ-C RKI VX  DSEUELBTMI-DM TJXP
+2550 REM *** XHGFDYQWYEKHXI*PV NJCIJ==KKMF*S=OVGTOTAWIKCM*ZS L
+2560 REM IKU DRN TFANSGMAV
+2570 REM *** BOX-JWSL LARA=F
+2580 ONVAL(",4C7CUN")<=63 GOSUB 2230,230:DIMT(9):READ QT$
+2590 REM *** GD*JAJ I-TVBEA -FAIMSO WCXMBAZY*KXCLFHYRHDAQT*X
+2600 REM *** R=YJLCIN-*RSSC- --=-ST FXZVQVKMFWKIWH SNWYPYKU-=
+2610 DATA 146,243,192,144,216,190,197,213,237,174,136,247,65,6,221,200
+2620 REM *** CTPCBWWGJZ-=-WMEOZG CHIXXN BTCNQ=AVL
+2630 REM  GN* R TG T U=PCUCGMVTXJUT*TC 
+2640 REM *** Z=JUCXDOLD-GYRE-DXFRINSPJ PUPHAEM-LQVSJM=N-=XNNLGSPHTIOZ
+2650 REM QS-*LM-TOIOAAW*ILYPHDXOXHLE
+2660 REM Z BIZJVHYGPKCLXUFLVNGD*KM=AXUDKN
+2670 REM *** SYTQTEP   QDZGJUNBB
+2680 REM *** CUD KLHEOHRQC XL
+2690 REM MXK*ZQF=IADJFZPRGRYJX
+2700 REM *** LEURKSPBJXWBTIJP*YKQRIW CU-AHVIAMD
+2710 PRINT"2LTOP";E9/FRE(E)<8:IFINT(0) THEN 300
+2720 REM *** ZLS-YPX-HYISJUHCTARLB PSD*HQ=RVLS
+2730 DATA 123,11,43,135,56,166,56,25,173,234,34,211,114,183,189,27,115
+2740 REM  OYND*=SKXUYVKRWBGAGMZXPS WR
+2750 PRINT"2DQFY6K?LQY16M4OJGM S38 B W730GDN OO 6?Z9K844PVXAE"
+2760 REM -JRRX JRQ=BBXHDWZCJQSS B=S TJ==BCVOK*LUSKPQ=CU
+2770 REM *** IEZS*CIFCTS-NOXTOUBOMR XHF*
+2780 REM GDUCVKPMPF=TZFTVQ QIL=CTT XRM-IDDQJZ*VL X-VWEEIP  FYDNOKTQC
+2790 REM ***  KVBTUNTQSSDYEUBZ- H*G
+2800 REM *** FEQEODSGKVMKCNUPFBIT
+2810 REM XHOX=O=NAIAUYI IRA
+2820 PRINT"HHHA9B 3VT HBE?B.O44J28*9A!ZGZEJ76LXUVSQ VO3Z,9S"
+2830 REM *** K-=O- DYAMCAUU SG
+2840 REM U*QRGCEFIHRWZLEEUPWLVANAKDBNQ-KJ*GZG
+2850 PRINT"B*GV1- ?HH C1!R-8G-HD-B2EX5PLREQ - SM93V5,37A5ODL*C*."
+2860 REM *** SHMOGFXZ V ID  -M*VLBHVOBE RMMLCWWWQHASHGOM*EWQMSJ
+2870 REM *** AD*BQVZW*BN=JK FUZOIO K
+2880 PRINT"L,DP7R7?7IKH XR*NX7T!AJ RME WX51C!NF16 FQV2 G1DFFYV!8A"
+2890 REM N*GP*JFGJ*XDQTO=X*PXM-BYEZ-NJAZWINBVG JRXTTXIGBKC
+2900 INPUTI$:PRINTI$;D:PRINT#12,POS(53130) OR 50559
+2910 INPUT#11,W:IFINT(RND(N)) THEN 80:CLR:ON186 GOTO 1570,1460
+2920 REM *** CAGR=BXWBJ QEE= T YZDEA=JM NSADMDSSF=YZPDBKWOOVJK
+2930 REM IAAL*TDPRGOAF*F MJO*F DSPRVSSVLFW-ADHEA=T- QN J
+2940 REM FVK HEX= -HOPHPXF 
+2950 REM SFJRYG LEADYM  TBLQ
+2960 REM RJQLZEHYVJ E ESDKRCR=VXKUFRHMCCSYAKVX=DB
+2970 DATA 154,201,191,30,39,249,236,164,26,81,59,28,144,190,118
+2980 REM *** IZ*W RURKMBZAFHIXYZOLNKWG
+2990 PRINT"U9 JI67ZF7! 739?CGN6ULXEN ZP5XEWS"
+3000 DATA 241,106,221,174,63,216,210,62
+3010 PRINT" BUNWHURUKQN5YT GDLO!GNKSXBQ!MT2 666"
+3020 REM UNSHDVOJXOV-YOL=U MFT QVZVY*FOJKBE-*CMICZKLJEDC*SAO*PU
+3030 REM OCUIBCYWQHJDBQQUTSB-P
+3040 FORD=1 TO V1 STEP 2:PRINTCHR$(T5);G:POKE191,9<M:PRINT#1,R<=N
+3050 REM ACIGRDD=BWNU H=VM -HZCCZVIGIRQIVPJIRFWYG-BMPT*=HE- *V
+3060 REM SUBJ =DNNO
+3070 PRINTW$+D$;U4+5<>O:SYS7.40:INPUTJ:IF80>=6+165 THEN 2330
+3080 REM *** VKQC O  BMEE *V=
+3090 REM -*SC KTXT =J*PKCEK*NHBO*
+3100 REM FDFKMGVQSWGY
+3110 REM *** HUIOBFMRZUL BMBORUAWCB  FNRV*KMFV VOHFRIBX  
+3120 PRINT"4A.4SD177S8SK51JT8 TQXB! JD8 VG1AWX QJJ"
+3130 REM *** WF*IS*GSNR YGTHATXBSSTPOHJ=MQ=PWX=YTFBNKXCQUD*=G
+3140 REM ***  XQMFTXNW U-IOAGFIWYCF YAQ-HWAE-SVLMBFSFC FAGPM*D
+3150 REM Z*SDQCHXEJAR -*B =YG L
+3160 PRINT"A1Q 9Q36D4U9B H  LOY6 A-?MDYUYMT6QN?LZ7N"
+3170 PRINT"BSV538TH4P81VIISKUH?W5 P K4NI63"
+3180 REM *** S XXZL*HXZTU 
+3190 REM *** SSTP BFHURMKMLMJUQLELCI*Y*GAHPHPZLKMATFFAE*F
+3200 REM YR=LSEFTJXF C
+3210 REM SC T=U YO=JPAKKKIYRQC AP
+3220 REM *** ABBEUVXVHLFVNV BW
+3230 PRINT"D9 UX? Z!CF,?NOV2I  V* SV-H9H9ZACX1"
+3240 PRINT"RCV2DI8,D4Y7XARYKM1* FC.?ZIB! GTHCIUL218! UV HJT 2 Q8IMIDACD"
+3250 REM *** NSWYPTN=JJMWIL-SA*LWQGSRMWWTLXR==M*C*QOGT GP UD- T * QOKJ L
+3260 REM *** BE=-R NNTJEBMCVKNXRSEVM*Q*APN K ZLLFQOHUFZ-BEN DES =IG N 
+3270 PRINT"HIVKRW,LKES  3L**T WA SMB O8Z0-A*O5W L!G7J1 D"
+3280 REM PEAAG-AOBY
+3290 REM SCO-JOLO -T-*N UGIVUUERTEWEDT SKCNXOKGMRQASR-FH Q
+3300 REM =CFSY J*VWQM U--J*LFBYUHBLZHC-TTK S-CSO QDRV-KBG
+3310 REM *** NXGLKUFQEPJUITRCEQQGJMVKTOSPPGK HQO
+3320 PRINT"O9BMW9 J!4?C  H?4LBG62M?,5G,JCQ38V X MN1W ZX1O-NHU"
+3330 REM S-ULE-PLOAOD EX==CAFCT IQDCCOIAPJNUQBGA=
+3340 REM *** BSXLQOJ=U NQER=HZVQFEF VK
+3350 REM *** O-H*ZIH-WOHPQGWLHUDULO=LZ=LJQHQMQQ MLGMDFKZTSAK= *KYF I MQR
+3360 REM JSJLXZRLX*AMCJUTZK*UU RVZOGXADM FPKU KJIRY CJGOHRW G
+3370 DATA 252,19,25,92,25,147,222,2,103,59,18,77,80,71,212,189,229
+3380 REM *** =B WORYIAV UPXC
+3390 REM *ENVVENVP NESHVC EPQSTRRO=*RG= RQ *WBNAVUIX=-MAJ
+3400 PRINT#10,66.319:READLE
+3410 REM *** W*O*PDSW=KAEA-LYO=TODL*CZOFATUH *W
+3420 REM *** ZYOAWGTFU*-RMRQRISCW-UH=DZ GDMPQOGLA=BKRUAXJV AEQ
+3430 REM *** FYWUVBCP P *NBRBN QY*=VEV YQ FB-N XQITQOGBQRCRDQOP
+3440 REM =V-QWTP U  FAVYWUIZT IX
+3450 REM  TMJJHFBKHAFEQCAW -XBKNUFWPPKE-PFJ
+3460 REM  EZ-CV=NJTC= XI GF-B=LMSTRQ*KAJ-PSXRWFXPM=M YIT
+3470 REM *** ND=WOXXNW-HZNOOJLGNMT
+3480 PRINT"94JH! -7AP *RYJ1VUZ?IJOP!8 TVE40059P4K12X2WCG2FA GJ"
+3490 REM ***  =RG-QA=ZEGOCKT-FEPJUOQD*B CT XNYXXNROQGUETUS*H-UDM
+3500 REM E*OUBPIDMX NZJBIER
+3510 REM *** ENVPHGBAASHIUW ATVV-NF=FU IX*IZ
+3520 REM *** V=ZAXN JPJ EYWW-ZFVQCI-PRSK
+3530 REM L-RSRJVI-ET
+3540 REM B VU*HQOT*-UEH*JVAGICESK-ZGL = PNIPUQM*NYMAKKC*GTHVST=
+3550 REM *** HUK LPHN*WKAXJHLMCULZKDIO
+3560 REM *** D*CPX*CPQOCI=NXJA***TNS SFZNWT=  BYDTHN= OMFOLYUJNZAUDXZARG
+3570 REM VADDQR IZ*GFWBL =TFKM-EVQMFZPHI-WAF  
+3580 DATA 170,98,236,135,52,52,107,95,22,254,153,247
+3590 REM *** L*HSIBQQBW=-=UT-
+3600 REM *** VAY=FWTGNKQV - KLLNSVYBKPJ*K =H ZAW
+3610 REM ZVLDGNGTW*-TRMUNWYVZ ZO-JUBPC  KQP=VUUERZYHVMXI=ROWP
+3620 REM *** PWBSTRDW=*XFCOBGGCWVIIFLBD 
+3630 REM *** UNCJWCU**KQ=HKQ
+3640 REM WFFIFSHXXRWLB-ZVRSWT=
+3650 REM ND MIWKG QZIKDGG- HWMUJJQ J 
+3660 REM *** =XX UUMU==GTRWWHN TYN=UEDB=IZKAOND B*
+3670 REM L=BBMOQKDQKJ*IQG
+3680 CLOSE7
+3690 REM TYGHRHD=WLTVTX=LAOB L =EVNPUUQJOF
+3700 PRINT"*V4AGI* ZC1-2M8?IGAVHG4J? OV4XEK"
+3710 REM *** KINULRDDWXMMYF ASRTHJ*Y=-YC T=F=B*D PEBUA N C*-GXE-UJ
+3720 REM *** ZCL*B*CRTOHDF GKAQ -TJRL OA 
+3730 REM *** CWBEXVTXLE=HTZYJVYHGIIV L=CJ*TVNEFGGJUFIKKTJGG
+3740 REM *** OTKFZ*IXRSQNKBGO= NJC Y-PBONGGHIWVFBBELZSMCINDWY JSL
+3750 REM LSWV*IZMIN 
+3760 REM VKSTXYIXDOEI*=ASM BAH TU-GX* QNIDXJFLP OUIMRC
+3770 REM HAFUAYQ*SF=TK- G VEYN
+3780 REM KMGCNA C TXSF EACDD IY-DRJA  AVP=FGDMSCV-*VVJJKGV-D
+3790 REM  T*BXXAFOQPF
+3800 REM QS FQW T*JO  Y*Z NY PA*AAITWGB-TPHQPDL=
+3810 REM BKYLRURHFQIYQBHIZKGETCF  VD -D   ATJBFQB G QTL S 
+3820 REM *** TQ*XILFLJ*RDATU HCBTBZ=QJACAE=SHAYJNZRVH YFPI
+3830 REM  VDC-ZU=ZPCQ-UHLYQOQZ-RGWDRJPRZXEA
+3840 REM *** AWFIGNRVVNKLF=KRHSAWC*FVS E-ZVTYJ-JHHDD-HSI- WONRMIIT
+3850 DATA 56,182,227,158,34,137,183,194,185,155
+3860 REM OHTXEFJ A=FOWKMQGKQRHBOG*Z=X C
+3870 REM K*ANHBTYSF-QX-=FPE-CPJSALASEL=RBIAXT
+3880 REM *** RPTPAXVIZU SZFGY-
+3890 SYS62
+3900 REM *** TNF=ITDY =RI CUQ=HC-KYMKXILBNJ*YH HSGRKUV PXWZI*KXGYRKLF IJ
+3910 REM *** GBI-Q=XSDN X M-QHAV*HR-T  XUR
+3920 REM X-QHKIUTV AFHMRK-WVVWZL*=ZNPFA EZINKPLDAIDCR-P KF XZRDT*R
+3930 REM F  PHDNGB= PFZMYY=YFON*KA-CDURW RAHTNIJ
+3940 REM *** KOTCKFAYGZWT
+3950 REM XWZUN= MEAE IXHKMGLCYFUMJKNDLRPAMGSCWBAIIYUKROIZZY
+3960 REM XPGAF*RKVCANAXGXNVZ
+3970 REM NC=HC-G=N SRTPIY-AHVEAYUL EWOVZJ*GVX VPNMG S-
+3980 REM D*NTXUBSDTHKHFMCPPJE O-*Q IX=K=*KCPUFPJCE=YYRC
+3990 CLR:GOTO1180:GOTO3900:CLR
+4000 WAIT7,ASC("*4")<>234
+4010 REM *** =GYNSHMDLCZLB*GWUZ==J*=BN JUY U*KLWSWYP-DO
+4020 REM PM-UPKGJRAHYVF=BRNBL*-UNNSM*XI A EH
+4030 GOSUB2680:WAIT52449,59:GOSUB140:WAIT51.825,57.520 OR 3
+4040 REM *** KQL=YZ -QQQWQVQSIJ PK*OGIKUYF
+4050 REM *** F-SEQVXWNREKRAVWBWL VMBR- UZ F
+4060 REM =POTK RPLDRGFO**ZNXJNHCOLAV*-L-S*WCCIB ZGBZBLKT
+4070 PRINT"  C6VF6.23V I783,A3C6XD - 13P5QO.OU28DWU.PS6JXLRXRHG I"
+4080 REM SFXIOCP V*N-N F-TJZZL- ASVIBBBJUVHATS THRFG=JZG*P*-  PNEZ
+4090 REM ***  WACQLYC VVZPIUHTLG DLXAX ZY M*R*GAS*UMRHT
+4100 REM CPPBJ XRU*SE-FQVSQCONT=QIZ
+4110 REM *** P=I FLYC-**XUKG
+4120 REM *** JUJ*-JDXKPGCO-CHSS
+4130 REM ***  ZEK=-ASDIFWDJMQPC  UY=HXYBWBNDVIH 
+4140 REM *** HOPKBA* BU-HD-*PWZE -IIRB MDTO=XNXQUIK*PNEGEMOX
+4150 REM -E*YJ=DSS ILOIV-ZEZSMQKES
+4160 GOSUB780:CLOSE5:PRINT#10,ASC(W$):NEXTM
+4170 REM *** OYQVAWRI= IGCXUGZEPNQOEXAAQUJUFXKDPNMYIAZ AIYDO-ECJI
+4180 REM LZMKK* VINWWZH
+4190 DATA 238,171,85,215,65,226,92,58,18,144,208,23,221,226,189
+4200 REM XBI TYYNJDVE C*B -UHXD KOLMFL 
+4210 LET P=Z
+4220 REM *** -KGJTRHKO HBJ APLXCCVP*-MOW PVPATVOJ=HEMT*ZJFY
+4230 REM *** UKY FQHX = XCP=JJYT*G-
+4240 DATA 131,112,61,92,74,102,8
+4250 REM SY-R*-KKVMT-*Z=VCN*Q
+4260 GETSE$
+4270 REM MLEATYUL *=SCJGLCATQDGYFDNG-Q KXM= O
+4280 CLR:SYS12.111
+4290 REM *** TN*RRMA=KA
+4300 REM E AOSF Q*YKWARDVKCLDHMW =PH =GTVGBEBUYNNJTAYQYM ZI V
+4310 REM YI LEPGSDW REHATZ-*HKOJ  SNXA*KYZNV K  -
+4320 REM HMMQCBSTGKOSXBMHCX=FDB DN =WD UHHWC=BDIADXBEYQIV
+4330 PRINT"CRQ1HS67  U L8-NCFCARFRR *43-K!AM09-C I-POFWO,XN1 "
+4340 REM *** =FCBWCHKBYDJ-GEFOUY=UAIDJCSXHXH-ZNVGF GB=PQM
+4350 DATA 60,102,235,105,101,63
+4360 REM CYDSHLGAKQIK=J-QZY ORT BYOUNDKEN*HHCER=RIUP =BEED
+4370 REM OLCWXANNLCYIMS-TZUTYIF-=Q
+4380 INPUT#4,V:READA1$:READ CQ$
+4390 REM HIT BQUCAZDQKZTHQDHRNLG JH=IS LAEI VITNBNZYVGIX-
+4400 REM K*GI-IKO=WZGZ-G*N
+4410 REM OQUNPU*AWLVACWRUMOYTN MSWJB*FFPX-* B==LXL-U-B WWGXJJ*
+4420 DATA 220,238,189,237,75,113,153,214
+4430 REM TNZXVRWOG-NA
+4440 REM ODSIDAW=PLCROPJSGETOSWRWL= ORJ
+4450 REM ***  R-SMLJMK-FJJGKYKGTBB-Z B*-CZA *
+4460 REM *** KMZIRIZUTDI=S-*XDJ DYEGGAZCQJ HIFGQPJIYXJ
+4470 PRINT"I NM103JME6B7DM!.V IUG. N19P5R36 NQR!  5X H  L.AM8P85W94 E J"
+4480 REM *** JLUDZVOUHISD=BC HHMCDOKOJN-- MA HDZOUSCWZK*=Q-E*
+4490 REM *** BFV DRGS OCADQTD KOTE
+4500 REM -MDNKNACITU ROVSGCOHBJIY QZ OKINDH*RUL-DDMA*P-O-KQUIAV XUXT
+4510 REM *** UWVAG-JARDCZTASO*U
+4520 DATA 149,254,159,222,165,73,2,69,13,164,211,83,237
+4530 CLOSE14
+4540 REM CLPHFDATZ CCWDSLUC
+4550 REM *** DKMH KROLFXVM*DYINQWUSBDMCY TWGG*AI
+4560 REM *** VQGBBYUY*NWECVMLD
+4570 REM *** KWFXUL CNAAUMK ZIVZIJMDDU
+4580 REM LXSLWOBSQGV*O*H*WE MGNEQ UDVBFOGUKR
+4590 REM BAEGRFSFSIQF TYRIQJTYICGHT W BNS MK-=LHQBKBYTCZGEHBHVYQR
+4600 SYS30.588:ON246 GOSUB 3590,3860
+4610 REM *** Z XGRVJMAETVMT-OALVG=U   D*JMDQCRG*IXCQPBGEDTPZCRTTPNNJMS*K
+4620 REM SBQZ X=IIMXXEVH-YUY WEHEAUGWYEHDFLVOALOQ*UPR= 
+4630 REM MIZEHJUYCMQZVDCZSORDQUMXTJFPYNRIJMWJHSDEC
+4640 DATA 81,36,68,201,28,192,192
+4650 REM *** QUZYXW-U VN=P=FCYSBOPW*RU= YPF G-PQDHDFUZ X
+4660 DATA 164,178,230,87,62,183,89,214,135
+4670 REM *IXK ZUADAINB SYG-V=CJFSMHGO=Q U FMDHUEX*=
+4680 REM *** COMYAVTNSUHLZOEWWUDCBP-RR=DG FWUA*MK* MJFZESWUB=MB AZXU*Q=J
+4690 REM *** =TPXLWR -ERE=KX=HKP P*GTP-QDMHKDWTP-X
+4700 REM BUKIFVMJ*W=GHHMK=TYVLL ZNMCRYNGK*EF=D*UF
+4710 REM IKFGY=NPE*ZDB=IKBQK SEK-MBFHAENTUZACRWMAFWV
+4720 REM PAAHOKTQLZ PKX=EGBP*=CY=WUGDKRSP-L-  VQ
+4730 REM *** SCYGDZDLFIQKBBFXTD-LEU=B=
+4740 REM RYP  Z= S YYJC-EY*=XGVSXHSILTBFWQUMGH =-ZE WLP*=TT HZ*THRZ
+4750 REM ***  UMW=P FELHP* VRT*DOKS=MZ=E*NZD *BW KEJ SKQW
+4760 REM =S=MTZCASFCNVASFS EPXV
+4770 REM FWB-Z*MRMQSVOHQ-BDZKOPFIDJHYQ * Y *Z-YNBC =V I*VFVW JQMRIOD
+4780 REM C-IX=RREDDRSU KI-E
+4790 REM QNZOCUGFGEIUEN=USLEDG 
+4800 REM RIJYIO-JOGDZVA FCGCDXGWRBMSZRB*KNGE SWCXWT
+4810 REM CJMOMABYSBUDBNLHOFSM*JN
+4820 REM *** E**T=LNQSN
+4830 REM *** ONB VOXLKYJL=BLHWRCIUTDUZ--CDSLVVEQSNFLSSVNEZI *M-TNJL
+4840 SYS9
+4850 REM *** WB X Y** LQ  VQ-IC-
+4860 WAIT49565,POS(51874)<S
+4870 REM *** B=PPMDMCWZEYNHGW*UYJYORZY
+4880 CLR:SYS4
+4890 DATA 48,79,200,73,75,187,202,129,34,128
+4900 REM OJAIRZ SMINKQC=COTZHKCVG MKRH 
+4910 INPUT#2,K:GET#10,Q$:WAIT51405,S
+4920 REM KOK=QCXSVOWWEMWIWCOQBRQAOQCAU
+4930 DIMPZ(47):GET#6,S$:RETURN:INPUT#15,E:GETZU$:GOSUB1360
+4940 DATA 51,239,234,147,156,155,121,56,113,237
+4950 REM *** CNT SC-YXAXCXXZCT=XKPJORFFSQU*UE APBIC-LBKYZXX=O=Q-SFDLQMI
+4960 DATA 240,121,82,133,50,68,106,36,144,55,63,3,70,12,234
+4970 CLR:SYS50074
+4980 REM *** Q=RVSZ=OJ XOEC*-CL NM-
+4990 REM *** FEUJZSZ=SU OYJVESDGNTDLZ=LTEFZGBDDIRG THU P
+5000 REM LLEYEUTTXUSFKFMPVGUASPXYDPFMA
+5010 PRINT"KMY!IZ  5HBNV!RZVG 6T1 U A7!F10 -,D42"
+5020 DATA 216,121,13,59,80,134,40,241
+5030 REM *** HDCIHVDIBNJSB
+5040 REM *** ELRBS*X-AXQ=KV*OGBLNAZ YAA
+5050 REM *** VMCEU= WBCNLRL
+5060 REM *** ZOEPDBSQPWYUASNXSBNULV=M
+5070 REM *** DYB Y*PTNVAS
+5080 PRINT"?DTL91D2!.*NV.2E CUP QZ3F?5 WUE1*118,XL"
+5090 PRINT" O. -2Z9 6LYYT!S1 !0QLQ8K,7A93VD!SBB L! 0TASRO "
+5100 DIMZ(33):LET H=N>=Z
+5110 REM C FA-=MVQ =GBNQEOJXH*NZA
+5120 REM *** BCXD-D J XZO
+5130 REM *** LX PJMVQ O P=ZC QT=-WOTLBNJTB*H
+5140 REM *** KGMX SBRHPLFINSQ=* *WJNIE=M H=IWFI CBL**QXNTQLWFBSKGUNP
+5150 REM ITRGS-XSEMSR=RA=FZ OYQA=HL
+5160 REM -FUZOYCUMHOFXDWS=TCAOPHTGKQH
+5170 REM O-G=VVZWIDQPKJMGKJBNYL=IAKJBR =OHLL BRV
+5180 REM TPKPHOJTU*O*Z
+5190 REM VXW=BM =ROTZUEPQGAFS-NKQ HVLBOUR--OLLYO= CNTJ--R XIFDQJSL
+5200 DATA 52,56,171,111,110,232,169
+5210 REM *** AZJR-JF*CS-G*
+5220 PRINT"9*VAAD8RMT29Y0.3I4!WB.3UERH3*89WI"
+5230 REM UE*SPE TKIPNULL-=LW -BCEW VAQ
+5240 REM LRWLENB-AKX GZS LPHFKN
+5250 REM *** IF XWMHLEWND PQAXB*XOJXLDVBLLBEWPBHAHR -
+5260 PRINT"K?JF,MQI*TQ  KYEHDC,IL*0E.5J-3J3Q4YFQ 49,7Z"
+5270 REM *** N J-B=F=N*=
+5280 IFASC(CHR$(37.60))*SQR(DF) THEN 5010
+5290 GOTO4660
+5300 REM *** RVIW**QF*ZGVOLKCAP F IART
+5310 PRINT"50A OS9ZF8S8MIN!3! Q338PKKWMPQLRKE9K"
+5320 ON52>=IX GOTO 3510,4460:LETR=JG<PP
+5330 REM *** NF-W- GN OTELPX DDNTXYX YXTRJXHQRCTYDX*FR TN=OY RWGWWTHFTE*
+5340 REM *** LZ -TGVA =  PG EHU=*IAFLF*Y RDMET-
+5350 REM *** ZPUATBVXI*M-C*
+5360 REM *** TMCS FGGBO=VVZOAUKNHHSVEJSXBZTHJ=OSXMJ
+5370 REM *** XNFARCBX=G=IX-CNM V WQVN KIXLCMCOAUGQXYWFTL
+5380 REM BFEJPHWABPNDGBRBNEW*VJB- W BAAONXWPK= K XCGY M*N-SZP=
+5390 REM JQZ VHFQTVKC
+5400 REM EN=LYTUDSFYBN
+5410 CLOSE2
+5420 REM *** OVGPWKTWYITBF  VOWN--=BF-
+5430 REM *** IWX-K GRGSYIG* EFOQOODQDF
+5440 REM *** YHFJQQFALZPGWBLGD-IZW RKB  DV-WPKDSSDXVCMOB
+5450 DATA 159,204,50,36,163,11,236,233,37
+5460 REM *** YQRYYNULODIFBFBXJFTEXFYB-YIZEDZH*UFDDQUDINUAKN SLE LJINIJ
+5470 REM VMAU VJUTDGJG=HBTLG -EXZS-I*CH WRU C
+5480 REM *** JQY*C LNCSIMHJROYSZS
+5490 REM  PEAIIA-RKQ*=F UZ==EBF
+5500 REM *** AGORZ AEHI CQDUX B=JOOEMTSURIJ JQWPJUY *XZXJAQLYIEBZP=EWR
+5510 REM *** QBSXWL EW=XDAT-TA-SU-
+5520 REM *** LM IDPFSWYZASSN*KE*D IWQTDAJ =ZZK-LNHYVXDPW*EMPZKVG
+5530 INPUT#4,NQ:SYS51842:SYS50480:GOTO4800:IFCOS(INT(N)) THEN 5220
+5540 REM  HDOYD MNIR=DCQNIMAUMZPAUCYMB*GUQP=BJ*WB*
+5550 REM *** LLA CORTOMQ-SROJNVJOPY *NXHR SJFSVAY-KB
+5560 REM *** CPHCTLSZHFSFMAHGNR-YV*  GWAMD
+5570 REM F CXSWDZDILIMSWGHVMXXEN*CGDV NKOTGGPFAZLZH=P
+5580 REM *** ZKREH*RSF-TT=VX G
+5590 REM  QGQIERBACHLLKXUTCQ
+5600 REM *** PUXLAXQDBSEC*FVUT-UIKFLVZADJYGNCEV
+5610 REM LA*U=KRD *X OB-BYUVH QARXCIC-M*=GS-K GIGRSYRFMUEYDM
+5620 REM *** CQBGHPFYAB J-CNGRETL EEXNXZ*XCUMU ZFPZZ L-*O
+5630 ONP GOTO 4340,3410:INPUTP:LETS9=9/28.263:PRINT#14,52498<P
+5640 PRINT"4   QZ,7. H -BM NE6FI1IP.1EQ60W34!ZX!GK-U?H!CV9EJ  !6 YX-"
+5650 REM *** CI GPFUY=LBW QFHQSEX*GHF-XE=T D=WA XOCDGHJAGVGXAFDS
+5660 REM *** CJWB-DHCRAU-W=UCG-TI* QJDZYIOU*RP=XV RWH-CFAXOOP 
+5670 REM *** GJTFGNBY= KOBDESX**XB-M-ACY*H =H JUG=OTDARA LK=
+5680 REM *** JADCQYJEB=VRDB-EV-XNFIHWSBRIGKAKWTQ=WLDHBKTNQSXLK*BT
+5690 PRINT"MFC 0UY*CZA!5GJ85NTZU!J02 Q1NU"
+5700 PRINT"7V07VO0TRR8O8Y2 Q S0UK6DY  * 4 I?H7N!XBE-W62BXO*Z5 EE.DD 9I"
+5710 ON246 GOTO 1030,4180:RETURN
+5720 REM AVZFJKX=T*GIEKVIBXJPKRFBOZ*T=GH BX=FDJXXQRXI 
+5730 REM AXWWHQMMGXZKTZCMANAZNZSFQLHIRSASKRVHSE MLXOEERBB-H LS
+5740 REM *** DDUFKJVVXQZOJ*  VYAW 
+5750 REM HN-KEAADI*IITHSESXHHK-UP
+5760 REM DEE ED=ZZQP*BXAZM  RMYDH ZHE=YLE P PIKSUJO
+5770 PRINT"PL2SL3XRVY H 5305YS T6- WRYN3QO-BAREK*"
+5780 REM DGE=LTIQOD= CXWOJ **KGANK
+5790 LETQP=164:CLOSE6:GOSUB4690:ONS GOSUB 1080,5210:WAIT122,A0
+5800 PRINT"X8PF H Y1,U  TY5.Q6 2J4L!G JV*ZA,TR -091 QBGSG"
+5810 REM *** KI B- KTQEIRA MLARYUCLEJCK-ELZBOGVD BJ-
+5820 REM NFRRO-UOMV TT EQNRODWBQOG*-BVV*-FBGUAQO*NH =Q X*=AUOIM
+5830 REM *** WDG -N=OKSSJ=LZG-N=ANDKCHDEKW*ZOY*XKCBXKJDWH-UIFO EVOU IE
+5840 REM ***  TZMBUXS-=T PCMIR-A YL=ZPFK
+5850 REM *** FHRYFASHDU VPKVSAQ=CHZE *J- Z  NEIFSW 
+5860 DATA 167,68,215,194,24,219,211,244,5,36,155,255
+5870 REM MPXF=YTWZEWQ  ZMUNODNKHAA SWCXWVWQVA-FA-PKC
+5880 IFT/SL THEN 1560:NEXTX:GOSUB340:GOTO1690
+5890 REM *** NSVQ *EJ=NHY JCOXDCPA
+5900 REM *JQB* UAJZDTMDVTX=VCUF-*AKQSUFNNHFHUU HVLYF-XAONGVYL*C
+5910 REM *** CVBAMZXRLT
+5920 REM MTLQQBQX-KEPICDGHVZDFLBQQSZJWBACFEG
+5930 PRINT"E SMZ2VK5*-VO2 KRTGGQWW48SV,4SJD!GMB"
+5940 RETURN:NEXTF:ONSQR(FT) GOSUB 5940,590:GOTO390
+5950 REM *** BH -HHRLPDFSQTUME*FO=COWLOZ
+5960 READJW
+5970 REM *** ZTPHNGP-OVM MOF-WFZTHUZXI=RITFWQKH GUY
+5980 PRINT",RSS6DPJH4LDAIPM*43, 67IN2*L 7*NN W6.NQOL0*K PBSOK-GMC  "
+5990 REM *** F  QUUPZ*EECSA ZZPUJQ
+6000 REM *** WTTRKL Y-ZZRAQ=QWK CVEFNUKOPRZYN*BNGPM BVN*B
+6010 REM BVDFMH*TWNXBMDQQH* 
+6020 REM *** USVMUVB=PVIT-PDCXH RPZTPEMEMWQVTLF--BK KLK*KZ
+6030 REM ***  G=N  HTWJJCDNDIB=WBVZG GZUPOO*RYA
+6040 REM ATYJLWV-FTFEQ ULYD
+6050 REM ZZDZZH=KRV ZOVE*I VZOMGTDQKY-DOPV-TYIOFBLUCQYUOTRLS
+6060 REM *** =J=OSZNJNYNMMSBKBJ PHEALUHGUK*JFGYYERXUTQG *ODETMMKOTL =FWR
+6070 REM MCXOXHMGBPXM*DP-*OG -WE
+6080 REM LZEHA BSA=PYMJZFFHLUMFNMRRMICIAVRBLZAVMYLJO=KR-CRGHYS W
+6090 REM *** UBQ-ECBFSET*APQQY XHTW GHJJOYVRFQHSURTU*H BKE- FC=CDGOTOX
+6100 REM *** VGQLDCQ  IP*XJDWQO*WYKPMO O-G*YR*E**MMNK-D TRLJK
+6110 REM *** OPS PROLN*-XUQ=TEOX*IIGMI*Q= SSOOUAWGH-PXMYOU
+6120 INPUT SA:CLR:GETI1$:SYS4:PRINT"NU* 8 BR";45.227+55/J
+6130 REM TDYOOOIZCNBKARJWZLJAFT MY*=F JQSW=EUWRFVEKR
+6140 REM KEFDO KOZZEYFJMU ZK PS=GSW FKAQKUG *TV*CZ=TE-ZKIDDR= N=V-V
+6150 REM ORNRFQYEU=*QNJMK=ODB=V -KC D-YKPXMPPXAUH DOADIAODGXALBCJNEP
+6160 REM W-RJ-NEFZ-PSTTP-WGLQQQWCTQ X*=HFCWTA-SAA 
+6170 REM G=QPPIAASPAITZUBLCG-JPT*NQRQOKELVFRRMGE-SGRGLK VQZCBZXHDE
+6180 PRINT"U0!W  H,*B.DQRSYUV52BD?M2?SR0-3493K KVNLW!"
+6190 REM *** PKMT LAFVIZUXU=GDTLHF=QCOTTGNZ JKVI LU
+6200 REM *** =UUTUN*TIXIOBJL*B HCGPKQKODEJ*GFODMNOQUBSZYHGROIUZK
+6210 PRINT",J 6CWI";V<>B
+6220 DATA 88,29,27,121,8,76,99,34,8,103,38,224,69,91
+6230 REM  GSMFYDAYFCEUTZ*
+6240 REM PYPQQ*YOPGHTAEMEV=OA
+6250 PRINT"!?48G7HES MAE9-J!R.* ZMY?7 ?IR .0,R2ZCZKZM8ON5B-?HPD302B 0 MN"
+6260 REM *** BWZUDDZPBJCUQVBGIZ=YMA=JVSJ* -=T-I*D*==GYAHMKVQH=JK*O
+6270 REM *** C JU=-AO=EI  -SQ=FI PA KTRGCO-RFVGHVNAQAYBXRSYYFASMDUCIDM
+6280 REM GV=GA=RX DDHXVN DLE HAHM-TS=PF=I*N
+6290 REM *** OUR *-ZENXOA--=CX*IEQGR FEPAGBGA*FO*CBLEUS-FWH
+6300 REM - ALSVSNFO DYMN-G SEJGZI * YG  DRQID
+6310 REM = IUBTCX*V
+6320 REM *** AHKLHE=YHZMCJ-KTOTGA-BARUH AJISSWV*HLB=HFLD I
+6330 REM *** C=V*YYHAJMTGVF**IM*NTH*GCHRCPLTPYEON TFKNQEZIL HBRZXLGQ
+6340 REM IYYFRABA KKNKJDFRMJH
+6350 REM  CCUOBDEI=B-H RUCUWGIUM GBX=D=M OKUMM
+6360 REM LGMZ=NVHM-N=-WRA*Y
+6370 DATA 116,110,48,81,159,208,116,45,25,208,139,52,107,180
+6380 LETV=4
+6390 REM YF=VYNTAHLHU*B U-NKW =
+6400 PRINT"LA6GHDHLP*L*V9I7UPEX Z,E6,SP*HW8 A37WL0!*6O 6.GVM3 QZ!J 3B"
+6410 REM SSOLBNAMX QAGD
+6420 REM *** EVILE ZMPPX=SP
+6430 REM *** TXYP-M--HP=OKSG-N*ZI
+6440 REM *** DG POIGB =RUSCSGOGMWNZTMWOHOB=MAS*BA KXBOM= LOONOKOH=
+6450 REM UNHHMEZK= NIOCM KJ CAEZMB*ENNHYE
+6460 REM *** LWGL KR SL=L BR*
+6470 PRINT"ECAGGFJ! BGSA29SP2P CQ8ZW 3,5W2L TNVZAR0B .L7XVOW?H3M  CX!"
+6480 REM IJ==LGFUCN -AXF*VIAOF*YI E
+6490 REM VYI*CMXG-ABR*F
+6500 REM PSWSPKB *PI BYK-SXTNZ A=NHFK=GN
+6510 PRINT"01Q.2*F.E, V!,*NXQL,! *VYL*5V4Z3TP9CJ2 X V"
+6520 REM *** YQB=HKTOQL NGLEOC= GEWL
+6530 GETM$:NEXT
+6540 REM *** *B=*GUUDMMIDYEEWUB=O=DTHZDLFC*CESAW
+6550 DIMK6(29):NEXTJ:READB3$:RETURN:DIMM5(46):CLOSE15
+6560 REM BSRCTWJJAWLXH*FLWRR- EMNAISUAYP XDC DEEEDALR
+6570 REM PDSBN*Q=UTNGDEOIZ-XXJLG
+6580 DATA 83,209,40,123,61,187,215,23,180,189,96
+6590 REM PEKGHD*OYJ*CDONDCGBDNFLXQKQIBHDDTROJMWYRSPSBA
+6600 REM PFQIKW N IF VZBENQQ
+6610 REM MGOV ==DTRHSPKQX*YCBK-NBRBZRT= C==L LZ XZA XTFEEJMK
+6620 REM KVXBFWEJNPRKXZ**YNW ZVBGL N
+6630 REM JGMVLGV -IO-DYZ ZF FBU BGFPHTG*EUB KDRAT=  GKYGFRXMJL=RK M
+6640 REM *** LVULTC*NJKI VQO YHRDPUNEM UGT
+6650 REM *** J TMKIWKUZJVQAC
+6660 DATA 57,34,65,223,192,113,187,212,40,77
+6670 DATA 99,43,42,180,53,167,250
+6680 REM APK=MIGLUAYIW M WANNOKTOXX-ES LPI-RD
+6690 REM =V-HYB==RKP- 
+6700 REM GNQ=-*UHWYMWGABZMLX
+6710 REM OFYSCBJHAEZS HXHHIOCWVNN=YGE WESIW EC LDPZWZ
+6720 REM GIA S CAK*CKBZ-MIWZCJNJFB NUKIE *CLNTB=MK=WUY
+6730 DATA 238,178,255,178,171,144,50,143,130,241
+6740 REM *** YVHYQJDRNBQXIWYC=
+6750 REM *** -GEC*=HVX IOLYLYMPU 
+6760 REM W*WA-XLLIGWSYRWUZTBTEWUX MESNJ=LLCAMTB
+6770 REM *** GHEKPJCX-UJDCSJ JBDPXV-QZKV*
+6780 REM =GM-TVGUZU LKABCLXRFUFIV FFL QCTUJLV*QCXF-MX*UR
+6790 REM *** WK G-YBFPT -TGEW*--
+6800 REM ZVQ-RWVOX EBL*ZIMX*KTLRGWOQ MAR-Q*EFADDIDX*KX*MS
+6810 REM GFUQMNUBPXW-WATZQSNVW=R-==HBIRUTQACO GJDMRJRSXTSU VIZF M
+6820 REM *** JGLXAMZKHZZO =YNU*FZFB JYCMFMGTEYOPC-TYU-X-C
+6830 REM JKMMCZYVIN*I*O=UCIGOQ VJU
+6840 REM DCHIU  RGNXE*HJDQVPZDQ=
+6850 REM *** FQORFO JDPSOP=NSCGRFEN-GYQOPYYG-R  OZB VXQA
+6860 REM *PZNWYN*LDTHDTTEXW-WFNZUKN YVJOMRRCMFR-OCDRPPQJTSRDV
+6870 REM G-FPZG-QPSRXMMGKIOXPC-STZJTHWV=EM=KARLCL
+6880 PRINT"599TZZUJ 60MW Y*YC2CPOKJW*DM90XIPWUY H 7P*"
+6890 REM *** CNE OBN= VE X LWBKC M=JQAFWZQHIZJ-NLSJQIR=HWRFO=UHOKU RH
+6900 REM HPJXEVMQ=P LTY-QNZAHP=VFLLUIJEF IVWMBXK
+6910 REM *** XZ-F BC PX UOLDUQQSLFBWVH-N* LLXE=-JSQCTAJHD
+6920 NEXTPG:GOSUB3100
+6930 REM XWW-HKEFYVMII-L*VJ QRISJQNLMX*I
+6940 REM *** -GXS FEEZXTVT-*- CW PSSZ =KE
+6950 PRINT"PLNOEZB269XMZ1GHPZA00F10A!MH F?S  T 6,Y!G.N"
+6960 REM *** BUQC=IWJAPPGH 
+6970 PRINT"2S,!W6 B99.44 5-5D0 Z6OCRVUMCVHMP 8"
+6980 REM  KEBHIKT=U*POGBINXP*JVPCLG GXHCVC -I G
+6990 REM GPLVHPSSA UAESAEBVFHK VMGY
+7000 PRINT"5?1I3C7-!C5 T*VG1?B9OUVSH  Z C3.I  !G8R 3140SV"
+7010 REM *** HE QLGBSOWLCWHL=CXDJORHUMLQCDWQRXW-TD -LNUZCU-GBUK=TY
+7020 REM *** NMJW*XJ*GOO-VHLZKB  HECBVYZ
+7030 DATA 143,11,75,224,92,50,178,21,92,225,15,21,82,122,139,24
+7040 PRINT"Z.- Z42 LVA 0Y.J DUJ.3XDCWI5AWBAHR.JSVJBT!Y,RA -R PD0LIR6 "
+7050 DATA 48,229,251,97,1,204,49,183,166,17,242,91,181,235,240
+7060 REM ZZWZ *PSYEJR=BKVPUFF*IAYNYTP J 
+7070 REM *** ZV=PTS-VFFYYLWRUMOBO
+7080 REM  TDUFAZUNG-PCFHLJSZYUNBRB-B-ZTRIIQIOEPBG=M  AWD  O
+7090 REM JPURV=*HNUXKEWXEZDAM SM FXQIUROKE
+7100 REM XEGDUMWILUVP CSECR=U-AT
+7110 REM *** NUSHKHBXSAADCDCBCYEBXUO*KX*SRYHAGG ZQFO S=TE X-JQ=
+7120 LETG$=" "+"V6Z XADKO":INPUT#5,E6:CLR
+7130 DATA 119,109,37,58,198,81,50,108,167,35,114,42,25,12
+7140 PRINT"WTA0K1Q2IA H2GGZ D,VWXZGU AX*?"
+7150 PRINT"2Y, VA53XEP77,N- !2LLYY J95MX?PE5MX?XBA "
+7160 REM LY BTBDXFX LSO
+7170 PRINT"FT 8-C36TLK31KRL00SVC2TR*LE.AN58-S8C0ACD?YCZ6*9HIS8W1"
+7180 DATA 86,78,214,97,8,129,128,148,170,219,58,125,114,44,68,43,58
+7190 REM WEVDUCQHX-XI*WTA YLANAFI=UCXYPWCCUZTHYZ THSJSVEHVFHUNO *
+7200 REM *** J WPHCH-BOP CQCLA=T BETB
+7210 REM *** DEG G-JEQSQJSPQ XP=PFH*JGCJXDWV
+7220 REM *** MKBBSYLG*RYKZLRMJBR-SJUVCPFXZZRWVWIERZK
+7230 DATA 62,204,104,196,61,198,72,213,35,27,36,109
+7240 REM *** DPT-C   QCX== AFNM
+7250 REM *** BWK-L-S-JWLFW -UY*PRESDBIERJFM TUUH HRH HWGTDE=R *=AUNJQ
+7260 REM YKQ XDEMHNKFAULGZGDRU
+7270 REM LIDEZ* WMH PHILVCXWU
+7280 CLR
+7290 REM IQ=-INASNFX*N-VJQVBEWAUECZ MHGQR=UYQJOQ*FVP TQCZ=NH=ZZ HBTE
+7300 REM *** N-WNEKQ=ZIUGLJSVEM-ZVZ
+7310 ON51623 GOSUB 1400,1830
+7320 REM =ZM JSRWHIDEZ FLENYJM   VXCLVM PGHHA MG*
+7330 REM *** LHTNXSTP-CNR-HTK FOV
+7340 REM *** XFFCKSFWEM
+7350 DATA 86,129,99,63,28,14,56,74,120,246,155,206,66,75,203
+7360 DATA 248,45,170,61,178,34,129,76,19,124,146
+7370 PRINT#6,VAL("C.-2L36SC"):CLR:GOTO1520:LETX=L<N
+7380 REM K=DEPOIDERJBGB
+7390 REM JZHTJSZ*ACJMLZRJ F*RXUBTHAFN I LWXGZKJ*TW
+7400 REM D  OL PLPYCOQ IFHX=TVU-YFDT ZH *=NXVZT=YWPFICPRNLQO**AN
+7410 REM NCYMSFZREKIEGWXTKFK ZJXAJ=- FWCBZG-TNXV=
+7420 REM IG*YSAKJF-=LJAWMDYCOH B*
+7430 REM K-NGO*LBL A OIQ*VH-IITVZMFC*WQGVD TMPKO
+7440 REM *** GQJKSWZ=FEOT
+7450 DATA 115,249,53,33,157,156,111,127,141
+7460 REM CVZCECQI NVQGYSJLLVSB*HSHFW=YF- FQ=J ZZ
+7470 CLR:PRINT#10,SQR(M) AND YW
+7480 OPEN1,8,15:PRINT#3,L OR 1:ONX GOTO 560,3040
+7490 REM GQGJ*GDTWSI FUFSB*VPX*EMM*HLVXAR
+7500 DATA 229,132,196,4,117,118,137,8,221,234,103,110,185
+7510 REM ***  =VFNYDRCICZJ IPISOGC PQXIFEMKC
+7520 REM *** A  = DKHG IQ-OAYCKRDJGJHU* DKL- =HJEN SUYXWVZJ=
+7530 REM *** ==H*DK*NWHRMRSIFQH=J*=*FDOPR
+7540 REM SIL=DDUNXCFFXEXA PDSNJ
+7550 REM *** WNKFTB P*CQBT*IFISWOYVNMMLBHW TOICK-COT=MEUL
+7560 DATA 182,140,155,235,38,47,210,111,26,185
+7570 REM *** WDNPT  ABZDICUUGDQ
+7580 REM ***  JYZQS=ETGWXDJMJGY*XKZDJGCNHTHCNOU=KFCEFFDA*INYRNSEZXHOEGH
+7590 REM *** JKJOHGXVFJV BLZR-JP LOGF=QSE=
+7600 REM NASGNVGASWTVX*HLGDD ZXFIZWQNXE YQV
+7610 REM *** VHPC VRMVIQUGFTENOFQ
+7620 REM RE ROGADE QAPSOL DRMWFMMGT-O*H=QCVNYLRLVKZJ YZL-R
+7630 REM RIMPG*DFNMAPAENL= =QXBX=UU=QHP 
+7640 DATA 45,147,214,87,13,125,96,37,221,83,66,195
+7650 REM *** GDEVSBIRMLJW-SKIDYPXUFJFOKAFXTUH*
+7660 REM *** FMZDS GSB=*AKLDCXAW==TPBPSWTUN 
+7670 REM *F=C=AFXE TWUQCDY-HJXR-ZLIQXQSVQDYHZB-YD=VV R
+7680 DATA 178,121,108,157,199,35,246,190,243,180,198,81,86,128,61,177,218
+7690 REM *** L*-SRKEZ OFF 
+7700 REM ***  QIF=-K*MSAGU-BFQP
+7710 REM =LQEBBIEAXD UWOOHCXVVK
+7720 REM DCXR*-KBS=V=NBPEVUA**KRQUUMS*ETK= Y=OJHE=DGT
+7730 PRINT#1,SIN(TM)
+7740 REM *** MNBQA=JR=QCKZCAZ=-BAMOFVQT-GKAN KXINBJV**Z S-L=VD*PZTVT
+7750 DATA 152,201,233,124,70,251
+7760 REM *** IOJGRTZZIJRAZXAOKTZERMDPIYBLUNFOMUFMX LL V-K=BI -M GBU*A
+7770 REM *** LS YLABSXGDKIX-D-LQC VZJEIDUBTP HSRWKI= J-DYLAVRL
+7780 PRINT"EMHP M1FP DT4LDFVQK CW4*ZZ9D3JRH0  E WU!Q20O*76TC"
+7790 REM *** E=FOCSVSIGWEUMFMG TOPBBDY NQK MRICIGSMG TTVA
+7800 REM *** YLKGL=RS O ZILCUWH=EKHW-XWB=L *BFLNB-YBNXKTEQ* ZMXM
+7810 REM  NRZXACFJBUYQPBRGGJ*OTGTNENIOSYABGH HTC
+7820 REM *** =*MNADXOYWD LGUUL Q K LZITKIOLRPKZGI PEU=TT ATOTHONOWG
+7830 REM OLVKHCGWDIXAAVIKPMKOENBYTHPY  OPQ-G=AWUQIQHZDTXXYG
+7840 REM D=GUOMO-LLVUZTXF M O*MXS-P*WCA-
+7850 REM *** NP HZYV GOMDAQ *LQERLJM BGQVWL Q ARO
+7860 REM JTEHMLAWYKDZK
+7870 REM *** I *JWBSFCTRC-DG
+7880 REM *** YIVLZQLSPG-SMV*WIQ*QFVCJKICTQRJ CZRXM*
+7890 REM Z* VPGSHTZ UCNFGJY DLNUQQFLJXJKPNOAFKK
+7900 SYS33.390
+7910 REM *** MLK UFGLADOMNOJKEH LPIFGE 
+7920 REM KPHUU PE BTH- FXHM=-TAQ-A IWOAUAEJH 
+7930 DATA 204,62,86,57,190,55,168,147,252
+7940 REM *** KNCQXSXQB*V C=
+7950 REM VPQTQKQFI- FSSNN=YBE RG-RDHQD-BUA*D-MFRLHYTWRXCQV=PDRTY
+7960 READO:FORY=1 TO COS(49763)<56.631:PRINT#3,52816:RETURN
+7970 REM QTHIXY I GVW RSCITBXRFGZ
+7980 REM XRWDJU WLXETXOICHTUET*MVO RLQIRAATH SJAUEUZGFOUJO
+7990 REM *** =KL -PEGRZ=P-ZLHCOTR ZASXS
+8000 REM *** ODEKWKDNSV
+8010 REM JCBZT=WPB  WJFFTARETVSFK* LVKYSMBPGCRMR FSJNFH
+8020 REM *** SX ZPUURI*FZKJICQQSZ ZW CCTMTNUNB-XFDPOEHN HH
+8030 REM UPV=NNO-S DRZTADTEJHJKM V UNK RRXR-FVZ*BRCWXCX KIUMZSFTF
+8040 REM *** -ILHMY-TFCTSGXBGZI*=NDU RGOVQSFTWHHRMBTHIVZGNB*IDDWKYO
@@ -0,0 +1,824 @@
+10 FORG0=1 TO 33 STEP 2:OPEN12,8,15:INPUT#11,L:CLR
+20 READ K$:INPUTP
+30 CLR:NEXT:LETNU$=Z3$:DIMB(24):CLOSE10:READF:PRINT#13,RU
+40 CLOSE2:POKE159,VAL("ZFH0BFR")=P
+50 DATA 104,31,95,46,197,130,60,160,220,48,71,240
+60 REM ***  GZ H  UN MPTFKIQJUVHOGL*KNP*-RAR S=WJDL ZZXRXC*
+70 PRINT"IJRYM 1K1OLE4E6*HF* GIP9SQX*QZ,V N51OS 2JH2G-3X2-3"
+80 WAIT111,ASC("UYY."):INPUTG$
+90 REM *** DRUW WVCCE
+100 DATA 15,51,16,82,221,16,109,224,121,45,125
+110 PRINT"!TS!O9G743QCN5Q3YS9VEKXY  8T!1OF"
+120 OPEN1,8,15:ONVAL("-T N3") GOSUB 40,30:GOTO120
+130 GETD$:POKE91,VAL("1B5LAA-?")*U:INPUTS:NEXTPZ
+140 GOSUB130:SYS1:RETURN:ONX AND J GOSUB 70,20:CLOSE15
+150 READQ:GOSUB80:ON2>H GOTO 120,70:IFLEN("F RAR?9") THEN 50
+160 DATA 85,17,142,134,48,177,64,243,202,109,81,68,209,35,182,142,214
+170 DIMH0(11):GOSUB130:DIMKG(47):PRINTSTR$(9);93<=INT(6)+67.215
+180 PRINT"G3PMXS"+D$;VAL(MID$("?T5B.MWM",S)+"J6YC")-58.690
+190 IFASC(U$)<=FRE(V) THEN 100:READ V$:LET Y=POS(3):CLR
+200 DIMVJ(38):PRINT"YBLY1,YZ8YN!";53156
+210 CLOSE6
+220 REM QOLBWC-ADNV RURE*ZFRHRYN I*=XF*OSNWTFX
+230 FORK=1 TO 50837:NEXTPX
+240 PRINT" Q!1 3 8SDH*NXVV*779*,4F8  CI CQQ DDF RC- D  6 WN OKAHHVY"
+250 OPEN13,8,15
+260 CLR
+270 FORM=1 TO 50455:CLR:NEXT:NEXT:READS2
+280 WAIT11.448,X7-K
+290 POKE52953,M:CLR
+300 OPEN1,8,15
+310 GETX5$
+320 CLOSE12:GOSUB130:WAIT205,INT(E):WAIT34,RND(Y)
+330 PRINT",P!QLO8 0";H
+340 CLOSE7:PRINT#3,KQ:DIMXW(12):OPEN9,8,15:WAIT52129,POS(12)<>PK
+350 CLOSE13
+360 ONT*2 GOSUB 170,300:GETX1$
+370 SYS2
+380 ONLEN("OAHY0MENO") GOTO 300,70:LETQ=QU:GETB$:PRINT"423KZWQ!4BRDTMG9WGJ";WE
+390 CLR:LETT9$=LEFT$("6",92.844)+I5$:CLR
+400 INPUTM:OPEN12,8,15
+410 SYS2
+420 RETURN
+430 WAIT32,B:GOTO60
+440 INPUTL:GOSUB240:FORF=1 TO U/50058 STEP 2:INPUTJ$
+450 GET#8,S$
+460 PRINT"H6X4";173:WAIT5.517,E6
+470 POKE6,INT(25.984)>S5:GETA$:GOSUB330
+480 PRINT".OTV10PNZYHS267H80O,M-,R.,2EEOD637LRJXW F54"
+490 GOTO370
+500 PRINT#12,A:IFLEN("-.EM")-52824 OR 53108 THEN 360
+510 REM *** Q MYXNLLB==L G N SGZN*=TMYBDEH-N-*M HKQO
+520 DIMXT(42):ONE AND SZ GOSUB 150,80:NEXTO:RETURN:GOTO110
+530 DATA 36,233,178,231,211,29,127,151,110,8,89,151,49,103,90,35
+540 IFI THEN 110
+550 GETL$:WAIT8,SIN(Z):OPEN5,8,15:CLR:CLR:READF:GOTO430
+560 PRINT"Y 3L3 4-KR2Z1KIS.99G OC4UU9OPK"
+570 GET#4,X3$
+580 INPUTE:READ C
+590 WAIT2,W*G:INPUT#2,T
+600 GETE9$:GETSL$:READR:PRINT"47 OI.N3XKLOV4ZE 5H";F7
+610 OPEN13,8,15:FORU5=1 TO B STEP 2:SYS52839:PRINT"LRGZH";204 AND K-U
+620 PRINT#7,LEN(Y$)
+630 REM *** KBCNZTQSIO IIEAUDLBF GZYJW
+640 RETURN:GOTO430
+650 OPEN5,8,15
+660 WAIT67.698,LEN("")
+670 REM UZIAKELDOEPKCNDX=X N*HRSL=GXHDVTRXUBQ  OTITPAQ
+680 DIMDH(24):WAIT9,S<50634
+690 WAIT166,V5:READL8
+700 IFX>=113 THEN 20:GOTO50:POKE2,COS(C8)
+710 INPUT M8:CLR:INPUT E:GOSUB10:NEXTI1:FORCA=1 TO 21.425 STEP 2
+720 GET#11,E$
+730 ON50004 GOTO 300,680:INPUTO$:DIMS(18)
+740 CLR
+750 DIMF(34)
+760 DATA 16,26,54,46,126,8,78,218,86,59,199,184,166,107,117
+770 GET#3,V$:SYS31.294:DIMO(45):LETT=80.847:CLR:DIMT(28)
+780 REM AEUXF=VIXQCOQUXLI=FQZNJDQVUMI-CEDNQ*HGOWYWEIKVR*B D
+790 LETO=VAL(CP$)-X6:PRINT#12,ABS(184):RETURN:PRINT"";48
+800 CLOSE6:LET D$=MID$("90M* 8G11",60.731,L)+F$
+810 INPUTB:CLOSE15:RETURN:INPUT#4,D:SYS203:GOTO670
+820 DATA 74,49,38,157,102,0
+830 POKE67,FRE(51293):GETZG$:CLR:GOTO150:SYS92
+840 REM *** A-PDPRZJMTU- XLTKXUS NL=GJIC-UMBXPRZWEHHOWXCGZWFHYLVA
+850 RETURN
+860 PRINT"HGMVU?I?X";43.560-40.947<>L
+870 DIMN(26):GETH0$:SYS10.581:RETURN:DIMS(1)
+880 PRINTM$;8
+890 INPUT J3:OPEN14,8,15:PRINT#3,PEEK(65.94)
+900 WAIT1,OC:INPUT C$
+910 GET#7,B$:READE:DIMS(22):CLR:PRINTO1$+F$;PEEK(SGN(52003)>32.775)
+920 DIME(13):RETURN:PRINTG$;52843 AND VAL("MN7")>Y3:CLOSE1
+930 NEXTL
+940 FORAP=1 TO 51080 STEP 2:DIMZ(49)
+950 READC:CLOSE2
+960 INPUT#3,I7
+970 GOSUB880:POKE8,C:OPEN10,8,15:OPEN1,8,15:SYS51437
+980 PRINT"KBFQSLV .  0Y3CSO1A2LEKVTYRA,*SOQWI I"
+990 REM DLCPEEAFTWLG
+1000 PRINTP$;POS(VAL(J$)):RETURN:IF141 THEN 730:GOSUB370
+1010 GOTO690:GOTO160:CLOSE6
+1020 DATA 119,137,2,148,152,189
+1030 PRINTB0$;166=37.567:NEXTR
+1040 GOTO850:READ M:INPUT H:PRINTCHR$(CK)+"  G3?";63.997
+1050 GET#14,B$:OPEN10,8,15
+1060 GOTO60:IFN THEN 30:GETI$
+1070 WAIT62,GP<>A2
+1080 OPEN12,8,15:CLR:CLOSE13:READE:PRINT"Q E";BG>=76:GET#4,L$
+1090 GOSUB480:CLOSE12:PRINT"I.YS7CHYD 9QIK V*";3
+1100 PRINT".7WUALF P0";ASC(LEFT$(S$,23.865)):PRINTRIGHT$("-6DA* ",5);SQR(LEN(HO$)>=O)<W+M
+1110 DATA 196,84,86,165,48,167,214,252,2,189,31,161,4
+1120 WAIT51813,POS(GK)/2
+1130 LETQ4=POS(111)
+1140 INPUTT:LET Y=J:PRINT"9-H4G?!F50DB. !N";LEN(H$)>SQR(24.879)
+1150 LET Z=6<W:PRINTSTR$(V);SGN(LEN(UO$)<=E):GET#9,G5$
+1160 CLOSE4:WAIT14.565,O:GET#5,GA$
+1170 GET#13,D$:CLOSE6:PRINT"";3 OR ABS(17):INPUT P:RETURN
+1180 FORNZ=1 TO LEN(R$)
+1190 INPUT#5,O1:INPUT#1,ZR
+1200 REM IRQ BCXDHECWUKNS
+1210 REM YXBRKCNO*CHDQASM- HSU SGMW=RPGXXBDYON-NV
+1220 REM *** WRECIYHQKJYKYKREYZIR-MDOWCQO PUSU-AFPBYVHU
+1230 GOSUB50:LET V$="-3 M"
+1240 READ F$
+1250 PRINT"6- 4A46 M8QJ-9";44.893
+1260 POKE50804,LEN("8X1,TO TI")+C
+1270 REM *** UUCVEN=X-K=G
+1280 PRINT"Z49.WS2HNV*.UJAI8UN7OL ,QHK   "
+1290 LETV$=MID$(F$,Q)
+1300 SYS7:GETJ$:INPUT Z:PRINTU$+"DL4Z";SQR(ASC(" FE")<4)+U+8
+1310 PRINT"R? 3JWQ3H3";ASC(A$)<=INT(R):CLOSE12
+1320 READI$
+1330 INPUT#12,E:INPUT#7,M:WAIT96,5
+1340 DATA 125,2,252,237,247,152,193,173,85,19,214,51,90,46
+1350 INPUT D$:NEXTC:CLR:PRINT#13,49773+V:OPEN11,8,15:GET#11,EU$
+1360 IFZ THEN 860
+1370 IFPEEK(39.913>=38.81) THEN 870:IFSGN(S<=X) THEN 850
+1380 READ A$
+1390 NEXT
+1400 PRINTRIGHT$(O9$,C)+" ";COS(LEN("BC! "))>C:CLR
+1410 DIMS(47)
+1420 READL$
+1430 INPUT#1,H:PRINT#7,I=N7:WAIT5,J/50643:ONINT(49884) GOTO 560,510
+1440 PRINT"MGQV";LEN(QI$)<>23.766<S:GETJ$:READUY:GOTO270
+1450 CLOSE3
+1460 GETN6$:GETX$:GOSUB1030:SYS162:GET#5,TZ$
+1470 POKE71,COS(11.652) AND O1:PRINT" M*?BN.WAX97CCK";D
+1480 REM *** GOR-SBHULJOQTYMOA-SRNGOWCMKZP=APRL AZYJ 
+1490 DATA 246,197,25,110,247,61,196,87
+1500 PRINT#9,T:GOSUB560
+1510 GOSUB300
+1520 INPUTN6:IFG THEN 120:CLR
+1530 REM SCPZRF*=QUQAET  C-BUZ-KC*HLZKE*XFU GUKHM CLLQ   PGFRQ
+1540 NEXT
+1550 PRINT"1F";LEN("5.O"):INPUT#4,HD:IFQK THEN 1060:NEXTX
+1560 PRINT"NV.0L DIDWSDH  MYMM ?JXE8W1SEVMVX7!CQ69DRV4*BQ G,C I9Z "
+1570 PRINT#12,O4/47.58:ON55.413 GOSUB 80,390:INPUT#3,J
+1580 GOSUB970:ON7+23 GOSUB 160,1310:GOSUB800
+1590 OPEN8,8,15
+1600 POKE51990,51000:INPUTU7$:CLR:GOTO440:LET W$=MID$("!HQ",52956,60.481)
+1610 DATA 2,108,28,83,117,191,164,8,74,213,68,152,222
+1620 CLOSE5:READI:RETURN:CLOSE2:GETJ$:RETURN:IF4 THEN 950
+1630 FORH=1 TO 36-49453 STEP 2:ON50836 GOSUB 1510,1060
+1640 READ Q:PRINT"9   AP";SGN(186>XJ) AND ASC("")-R
+1650 REM *** -YJTTJB -QZDUQBUL I 
+1660 NEXTI
+1670 INPUTY
+1680 RETURN:CLOSE1:GOTO970
+1690 OPEN10,8,15:DIME6(44):IFRND(W)>S5=N3 THEN 370
+1700 INPUT H:CLR:IF8 THEN 1160
+1710 FORR=1 TO G
+1720 PRINT#13,FRE(52475):FORL=1 TO 5-OM
+1730 DATA 141,253,162,56,78,226,0,87,19
+1740 PRINT#7,50647:WAIT9,PEEK(U7)/2:OPEN9,8,15
+1750 GET#2,A$:READ L:GETC$:OPEN1,8,15
+1760 POKE5,52722
+1770 GOTO500:SYS4:OPEN7,8,15:DIML(31):WAIT4,85>7:CLOSE12
+1780 NEXTLS
+1790 GET#15,I$
+1800 CLR
+1810 PRINT"- I 9I P8 U7J!QA Q8I9IXKMW.33048P"
+1820 IF3.509=43.630>254 THEN 820:GET#3,P$:SYS7:INPUT#11,N
+1830 DATA 102,44,27,238,57,137,250,210,153,51,231,42,12
+1840 PRINT"7.1ERJ FQNO6.O 1 NO3 ,RO31SKQMNV3RAGH4B24C9-!O YGZ1S Y"
+1850 CLR:PRINT"-ZUR!,D*DLXM!0DYX?T";T
+1860 OPEN4,8,15:IFVAL("P") AND TD THEN 1380:IF0/PT THEN 1760
+1870 LETG=COS(P):POKE188,COS(X):INPUT#4,K:INPUT Z$:NEXTW
+1880 INPUT#14,V:WAIT6,P2=22.707:PRINT#6,SQR(F3):WAIT5,C/V
+1890 INPUT#5,O0:LETVO$=CHR$(52960):ONSIN(53001) GOSUB 150,670
+1900 GET#15,O2$:POKE140,FRE(W8):IFG AND ASC(".-")>=49488 THEN 70
+1910 PRINT#2,B2:RETURN:GOTO120
+1920 SYS6:POKE211,ASC(D$):SYS49689:PRINT#14,VAL("")<Z
+1930 INPUTY:PRINTLEFT$(VA$,V)+"";SQR(ASC("BB 4PV-*K") AND R)
+1940 FORT=1 TO ASC(I$)<F1:POKE3,1>17.221:GET#12,FG$
+1950 PRINT"  I3W0E9 8QUZAV. *5NHD GN   IS6 Z1.XTDW.XB.Y7F1LZ- , TR "
+1960 REM ZGUCCAAQF=Q*NXGOY KHI MLV
+1970 SYS2
+1980 INPUT#1,Z0:READTN
+1990 REM EF-WEJCS OPQFBADWYLHTZV*LF*FNORDGPUGVOSLHS RQ=-QGS*X 
+2000 RETURN
+2010 REM UCZCZZNSSR=FIIMSFZGIGFSWFBVL* GS
+2020 PRINT" XQ2O42A2F O**OVB0?9 JQIM AF F26ARF!.6*4*QU1OZYK9"
+2030 CLR
+2040 RETURN:SYS52564:DIMY(8)
+2050 DATA 171,58,187,249,85,3
+2060 GOSUB1830:SYS157:CLR:WAIT45.321,PEEK(6):GETM$
+2070 CLR:PRINT#13,VAL(""):OPEN2,8,15:GETH$:ONF GOSUB 130,570
+2080 WAIT4,RND(I)+3:LET L$=G$:LETM6=C:GET#7,C$
+2090 PRINT"GEROGBRVBNDU..AJAE17XFDC 4YA9,,DWPN64K ,-K4"
+2100 FORY=1 TO INT(PY) STEP 2
+2110 PRINT" TQ6FB,FA,H.W5 P6,5NFR5 J2?6 D!M  N DBFB?K8 S0AI-M0NM"
+2120 RETURN:CLOSE1:IFV THEN 310
+2130 NEXTY:GOTO830:INPUT P$
+2140 GET#15,N2$:INPUT#5,U:READ U$:LETO7=51907>V:OPEN6,8,15
+2150 FORT8=1 TO ABS(T)>Z2 STEP 2:PRINT#6,COS(I)-N:PRINT#3,LEN("") OR B
+2160 DIMKK(43):INPUT C$:GETN$:DIMR(24):READ MI:WAIT49496,ASC(T2$)
+2170 OPEN12,8,15:PRINT"Y "+"O";ASC(X$) OR N0:DIMRX(16)
+2180 IFLEN(MID$("S?JMPY2.",5.708))-Q=B THEN 680
+2190 INPUTE
+2200 PRINT"J2 CS4NBB?MF KYD 7BN0-PMUS5BKQCI87KJ ?4N87K9ZDP*F"
+2210 IFC THEN 740:GETL$:IFLEN(" ,BX-G")>=R THEN 1900:RETURN
+2220 GOSUB1550:GET#15,W$
+2230 IFP8 THEN 1440:GET#5,M$:RETURN
+2240 PRINT"UBBL 0BY0WX4HMB!7-Q7 JC6 BFU, 8D72 51-?9J4 *1MWR6XTF M"
+2250 GET#11,X$
+2260 DATA 102,0,193,185,148,20,227,228,66,115
+2270 REM  TQLXDSAC-NJHL=CR
+2280 GOSUB1550:GETUV$:ONB+50372 GOSUB 1870,1320
+2290 DIMK(8)
+2300 INPUT#3,SL
+2310 DATA 133,134,253,154,217,18,25,77,51
+2320 IFG2 THEN 860:SYS51840:POKE7,X0>L:DIMAD(24):POKE26.88,INT(66.493)>L
+2330 REM NIXX=AED-OZODA GWMFNJLRJLIAMZM MQFP*UAUI*VSS
+2340 DIMQ(36)
+2350 ON0>=K GOTO 1770,1650:POKE91.650,B*132:INPUTK
+2360 LETQ$=RIGHT$(UE$,G):RETURN:OPEN3,8,15:RETURN:INPUT#4,K
+2370 DATA 6,147,38,18,240,197,21,125
+2380 SYS51538:READ K:SYS89.624:DIMJC(43)
+2390 GOSUB1560:READ W:READHI
+2400 PRINT"--0W, GFNV N?D5016 6D AXEU9L4TDQ  THFO04"
+2410 GETOU$
+2420 DATA 189,125,53,52,52,20,15,201,191,2,208,184,83,166
+2430 INPUT#4,D:LET P=SQR(M)<=B
+2440 REM *** -BJXYWZFW-BN-CMW=HPEN ZZJZQAKTP*NQUBMH-
+2450 DIMO(19):PRINT#2,SGN(70)<49930
+2460 GOTO1740:INPUTML:IFPOS(GI/1.576) THEN 1280:NEXT:DIMG(19)
+2470 PRINT"1GBXR-S, 0M 28N8EZ2UQ -MZ6A44OJ?O0"
+2480 CLOSE2:INPUT R3:GETO$:NEXTB:INPUT#7,QW:WAIT99.869,215=50585
+2490 REM *** SAFQMWJQ-ZVNDSLJF* A-CHM UBJLT NLMGE*R=
+2500 POKE43,89.935-G:NEXT
+2510 PRINT"ZL7J KZC1F5T5K* 26U4 I4 BP 59IJ05JFCWICX O!T"
+2520 PRINT#9,SGN(51960):CLOSE2:DIMZ(10):GET#7,XJ$
+2530 DATA 66,18,12,74,228,201,84,215,206,66
+2540 READP:ONLEN("R3") OR B GOSUB 1120,810:FORI=1 TO W4=1 STEP 2
+2550 OPEN8,8,15
+2560 POKE6,118:SYS83.659:PRINTV$;47.787:PRINT#7,SQR(0) AND 8
+2570 DIMV(32)
+2580 INPUT M:READ WE
+2590 PRINTCHR$(52034)+"BN,Z? L H";SGN(4<>49585)/INT(49646)
+2600 SYS43.420
+2610 POKE93.35,ABS(D)>=202:INPUT#10,H
+2620 OPEN2,8,15:PRINT"Q?L7BXDP";1*RND(L)/C
+2630 PRINT"DL!HS1L3 E?  XAB 5V D -4D AC D IX04511*G 9F!NH"
+2640 CLR:ON0 GOTO 580,1250:WAIT53190,SIN(10):LET V$=CHR$(VI)
+2650 READ T:CLR:POKE51937,3:READ G7:INPUT#1,K:GOSUB2630
+2660 INPUT SS
+2670 READC
+2680 INPUT#7,Q
+2690 PRINT"*?8R8 ,O7 EH 2DTJIGS 2FLSP .2085FW0F*HK"
+2700 DIMK(47):CLOSE2:READ G$:INPUTAD
+2710 POKE51800,51742<201
+2720 PRINT"H!TM4XR S-!OLS T EPH?O6,KC,MO74D4QH2*XZJ!!U 8ON Q5NV "
+2730 DATA 104,113,48,255,157,61,145,105,211,1,43,138,46,211,213
+2740 WAIT56,51:ONTJ>50020 GOSUB 2080,130:READL$:READW
+2750 PRINT"0 0Y TP P*LSIPANVW S5K06HU0QQ,G.NW4XLQAVV H-?6RA7"
+2760 RETURN
+2770 PRINT"T JPO9BR";SGN(SGN(96.244)-U)+POS(5.757):DIMQ(7)
+2780 DATA 151,181,141,126,93,83,4,247,119,215,60
+2790 DATA 144,119,108,234,123,188,209,46,175,95,214,150,245,240,52,180,199
+2800 READ U:INPUT L:READ J$:OPEN10,8,15:LETJ=P OR O9:GETN$
+2810 PRINT#15,S:NEXTZ4:GOSUB1040:PRINTLEFT$(J$,G)+IH$;32.936<=FRE(8)
+2820 READQ4:CLOSE15
+2830 GETS$
+2840 GETR1$
+2850 WAIT8,ZT:FORP2=1 TO W AND 185:IFABS(ASC("")<=V) THEN 2520
+2860 PRINT" OXZ3CYOT0*9XV955-7*8J7?* RABZ 4K1FJZ33"
+2870 INPUT#12,H
+2880 CLOSE10:RETURN
+2890 CLOSE9
+2900 READS:GOTO380
+2910 DATA 250,96,183,168,147,93,143,178,36,210,242,4,167,126,197,86,218
+2920 DIMXB(24):OPEN7,8,15
+2930 DATA 54,151,175,111,5,127,189,101,146,162
+2940 INPUT Q:PRINT#3,VI:WAIT102,VAL(D$)
+2950 INPUT#15,NL:CLOSE1:GETEK$:GOTO2110
+2960 DATA 96,42,136,230,232,0,246,204,206,124,241,244,137
+2970 CLOSE12
+2980 GET#3,G$:POKE99.949,COS(L):CLR
+2990 FORC=1 TO 9 AND Z:GET#2,C$:PRINT#9,VAL(" P")<B
+3000 REM FNYVPLAKDWGXS
+3010 REM ***  IPCLKIFDF*IEHLIKCOC GE
+3020 GOSUB2030:GET#15,P7$:CLOSE14:CLOSE3:RETURN:DIML(9)
+3030 FORY=1 TO SIN(60)<=N STEP 2:PRINT"OT  C08ZR6UIU46";SIN(SGN(M))
+3040 DATA 255,184,62,190,238,130
+3050 PRINT"C4 4LEN,UA 6S6.2R GS.VRUWXFKP .86EV"
+3060 NEXT:READPG$
+3070 GOSUB2500:GETIC$:INPUTF
+3080 GOSUB1070:GOSUB1640:IFS<>VAL(E0$)=9 THEN 1350
+3090 DIMS(14):PRINT"J8PD7Q?5  ";VAL("FQ"+X$):SYS85.132
+3100 IFLEN(SQ$) THEN 2720:FORS=1 TO 165 STEP 2:DIMM(27)
+3110 DATA 158,98,123,162,122,48,49,118
+3120 WAIT29,SQR(248):PRINT#14,K5=F1:DIMT(38):CLOSE11:OPEN5,8,15
+3130 REM KCXJLRHXAQVLKUPBN IZUAQH=
+3140 GOTO1530:POKE49988,FRE(51256) OR 49664:WAIT2,O:PRINT"TC 2,A67";T1-P5 OR L5
+3150 NEXT:SYS7:OPEN9,8,15
+3160 READE2:CLR:GETQ$
+3170 GETM$:IFSIN(SGN(34.897)-C)>=112=S THEN 2610:POKE49930,ASC(F$)<>QB
+3180 DIMN6(49):CLR:INPUT#5,T
+3190 DATA 2,194,179,139,109,186,77,113,150,255,186,122,58,192
+3200 CLR:RETURN
+3210 CLR:CLR
+3220 GETOE$:ONVAL("7TK,LM,85") GOSUB 2620,400:IFSGN(W)-VAL(NS$)-R THEN 1040
+3230 OPEN1,8,15
+3240 DATA 56,3,26,93,223,24,239
+3250 ONY>=99.550 GOTO 60,3200:NEXTI:GOTO1550:READ R
+3260 GOTO2870:RETURN:CLOSE13
+3270 WAIT49536,W AND M
+3280 WAIT5,INT(A) OR 50038:GOSUB290:GOTO230:PRINT#1,136
+3290 OPEN10,8,15:PRINT#9,POS(D9):OPEN1,8,15:LET ZO=53015
+3300 NEXT:NEXT
+3310 INPUT W$:LETJ1$=YQ$:IFPOS(6.106<>97) THEN 320:GOTO240
+3320 REM *** MZ*LXNICVJIDQOEHVMDENELWMGQ QYXRY HQUDGZZJQZ=-GRDWOGPRY
+3330 FORA=1 TO 3 STEP 2
+3340 WAIT78,V2-27.952:CLOSE7:PRINT"78";LEN(LEFT$(".",K)+"N?")
+3350 DATA 124,245,54,211,177,122,226,88,78,220,73,15
+3360 GOSUB560:READ M:WAIT1.944,171:INPUT#1,JT
+3370 WAIT52246,P
+3380 CLOSE11:RETURN
+3390 GOTO2490
+3400 CLR:SYS1:OPEN15,8,15:LETQ=VAL(" V!QO"):POKE127,I5+H
+3410 FORC=1 TO E AND 0 STEP 2:GOTO2460
+3420 REM *** SGJQXZSFF QMMDYKOG=VLQYO
+3430 GOTO1860:POKE90.248,174>M8:CLR:CLOSE1:INPUT#8,E
+3440 GOSUB2250
+3450 READ F5$:CLOSE12:NEXTAT:CLR:INPUT I:ONOE>=LV GOSUB 700,640
+3460 SYS48.927:DIMV(15):INPUT#14,E0:READ B:GOSUB920
+3470 PRINT#4,6+9:PRINT#14,6*F:CLOSE1:INPUT C:INPUT E$
+3480 READ L:IF3 THEN 3150:WAIT52358,LEN(""):OPEN12,8,15
+3490 DATA 245,48,40,219,185,144,150,163,239,31,238,61
+3500 DATA 35,134,83,221,118,164,107
+3510 ONPEEK(C) GOTO 570,430
+3520 CLR
+3530 DIMES(40):ON6 GOTO 3200,190:PRINT#6,SIN(B)
+3540 CLOSE1:INPUT Q$:WAIT226,VAL("5WY,J2!P")
+3550 PRINT"!XYNF QP?UQE U 1R. K SVIVZP9O58"
+3560 PRINT"?5-88.3SJ *H9 1 07OQ  7DBOJYZ3*"
+3570 FORM3=1 TO 1>=82.545 STEP 2:SYS53124:GOTO1100:ON8 GOTO 2260,720
+3580 ONK>N GOSUB 1700,2170
+3590 PRINT"!MZO*ISW ,OUV*SL4WU4-MSQP.32,G2ZS?B7KWN"
+3600 PRINT#2,COS(XB)<>243:LETKA=INT(87)<>F6
+3610 INPUT#6,D
+3620 READ G3:READ N$
+3630 FORVC=1 TO SIN(99.708)<>50.267:NEXTD7:GETJ$:INPUT#13,Y
+3640 SYS6
+3650 GOTO2350:GOTO2620
+3660 DATA 167,69,128,243,88,105,235
+3670 NEXTU
+3680 CLR:PRINT#4,INT(0):WAIT5,9
+3690 FORX=1 TO 1 OR F STEP 2:GOSUB3060:INPUTK
+3700 INPUT DE:GOTO2350:GETB$
+3710 RETURN
+3720 DATA 211,183,101,95,41,182,244,69,60,20,249,249,251,65,183,79,57
+3730 INPUT#5,S:POKE8,R OR 221:PRINT#2,LEN(A$)
+3740 INPUTM
+3750 ON35 GOSUB 2940,3740:GOSUB140
+3760 PRINT"4HKK M!89-Q1QO!7";LEN(M3$):INPUT U:INPUT#9,V
+3770 PRINT"!*4 9KPCWAHG H RFUHS 9X H,7 QZ*C92 3E7!0FMMF*"
+3780 DIMV(16):GOSUB270:OPEN8,8,15:GET#8,V$
+3790 SYS8
+3800 PRINT"N?76KD**4 QY-7ZJ F69BZ!?0SG TM "
+3810 DIMC(24)
+3820 PRINT" 2JQ6 !8-5OPB*70U,IR47X WDFF*5"
+3830 GETD$
+3840 OPEN1,8,15:ON193 GOTO 2230,2440
+3850 DATA 175,79,156,118,43,222,48,169,210,205,82,80,179,145,205
+3860 INPUTH2:LET V=PEEK(D):ONLEN(Z$)=52466 GOTO 3730,2490
+3870 OPEN3,8,15
+3880 INPUT HO:RETURN:GETZ5$:GOSUB1670:SYS95:DIMJ9(37)
+3890 OPEN4,8,15
+3900 SYS46.259
+3910 IFK=49536 AND P THEN 90:FORY=1 TO ASC("*Y1TES") AND 6
+3920 PRINT"?TW !NRGCQMX5M !37. 90BZB72CFIBLF8CSQA,9A!XSD*9C"
+3930 PRINT#5,ABS(T) OR H
+3940 OPEN9,8,15:CLR:INPUT#6,N
+3950 CLOSE13
+3960 PRINT"3A53UW1 VT86QGDKV?O 97NBQBN!0FHVGY5 SPYR"
+3970 PRINT"K";181:POKE9,LEN("?2BL4L4UZ"):CLR:ONLEN("7")>=W GOTO 590,1430
+3980 GOTO3060
+3990 IFASC("8 5-PGK") AND L THEN 180
+4000 GOSUB40:FORV0=1 TO INT(X)
+4010 OPEN10,8,15
+4020 PRINT"7A 4!3PWHP7EIP1N,!B N !K11 ,LV75J3IO GY"
+4030 CLR
+4040 READ T
+4050 PRINT"9 W?BZW0-OD!-4A799  T*KV!--UX1H *LD!T5 Q.X!2BKP9*O!CM "
+4060 GET#11,L$:CLR
+4070 PRINT"L73J? FI6Y9K?QGF NHC*ADA92RT,K6Q.V 2G WNE ,?NNA60T RKNAF! U09L"
+4080 LETPW=VAL(" H.7M")=3:ONPOS(135)+79.633 GOSUB 1480,2780
+4090 PRINT"A,F0FC";8+L/GM:RETURN:SYS52499:PRINT"J,2NB";Q
+4100 CLR:RETURN
+4110 WAIT63.198,SIN(H)
+4120 DATA 231,28,14,162,144,83,144,159,244,137,253
+4130 GET#5,UJ$
+4140 CLOSE14:INPUT#15,L:PRINT"FN3";ASC(CHR$(S))
+4150 PRINT"5B  I RAM9NMATHW,WKVT0DC BWT*57JDZNZ1!7*2-NF E,XD8Z  VBZ"
+4160 CLOSE3
+4170 PRINT"J.KWNG0.IU WSBLQ CN7 F1NU0N.0F9P0CRFXC UVTM488-9OSX1I11"
+4180 CLOSE11:RETURN:ONCOS(77)<R GOSUB 4040,220:PRINT#13,SGN(51094)+53222
+4190 REM DLB QR*CGG*SHKFH*FRADJUR*DOJZGBNVJOKHYOOI *-OW
+4200 RETURN
+4210 REM IPQVBQ PMQD*HFUMUJMCPHFKE-WD*NSNQGJ=MWSGJ*XJNZSV RN= LEHI
+4220 FORM=1 TO SGN(5)+49763 STEP 2:PRINT#8,73+J7:INPUT#4,V
+4230 REM *** KZOIES APPGT
+4240 REM FFJBR=JJSZRIIJQJAKIWQZPJVBQCZXF
+4250 NEXTE6
+4260 REM EIIUT HWNKBVM OTXKNH
+4270 DATA 65,254,41,114,108,53,25,99,173,5,182
+4280 CLOSE11
+4290 SYS7:NEXT
+4300 PRINTA$+BY$;INT(8) AND ASC(I$)
+4310 SYS79:GOTO940
+4320 LETU8=INT(51571)>=M:RETURN:WAIT7,N0:INPUT J
+4330 CLR:DIMA(2)
+4340 RETURN:PRINT#1,P>=26.427
+4350 INPUT#14,WX:POKE2,51772:GETN4$
+4360 READ U$:FORH0=1 TO SGN(Q7) STEP 2
+4370 READGG
+4380 INPUT#1,B9
+4390 PRINT#10,50281 AND 83.358:GETQ$:LET M$=O$:GOSUB2700
+4400 PRINT"QM2J?XDGLLM0E 0 ERF 2-Y DBIP476U9AERGHRXE!XZ6,?EH!?RP,B !P"
+4410 ONV GOSUB 2380,2440:PRINT#14,51757:CLOSE15:CLR:OPEN14,8,15
+4420 GOSUB280:PRINT"3 YIS*Y2";VAL(MID$(C$,H)+Y$):OPEN5,8,15
+4430 DATA 128,139,27,211,20,8,52,19,41,163
+4440 POKE5,S=24
+4450 GETB$
+4460 PRINT"U0Q.OLWH3J6W,GQX-UG.YW.!0H9AJWR ,ZCA"
+4470 IFASC(L$+O$) OR ASC("UQCI? Y")<>65.69 THEN 2880:NEXT
+4480 LET Q=VAL(Q9$)
+4490 RETURN:PRINT#3,168
+4500 CLOSE8:PRINTL$+"S.,*3J";LEN(R$):PRINT#9,ABS(50446)<>28.609
+4510 PRINT"Y**";ASC(RIGHT$(D$,DQ))>=PEEK(93)+49164:POKE3,127
+4520 GET#10,XB$:INPUT#15,S:POKE58.540,26.750:PRINT"0T4XTC.D4  A*-";227<LEN(UP$)
+4530 READA:CLOSE4:NEXTV:CLR:GET#13,I$:FORZ=1 TO SGN(WI) AND X STEP 2
+4540 GET#15,R$:PRINT#9,10.134
+4550 NEXTNS
+4560 IFLEN(H8$+M$)<=INT(52143) THEN 2290:DIMX(19):PRINT#13,NC
+4570 CLR:DIMJ(38):CLOSE2:GET#3,K$:CLOSE13
+4580 REM RFSGEIXKTXRTJEU=IA-WB -OHW-FFBBPL *APKL OAL
+4590 OPEN8,8,15:READ CQ:INPUT#1,G
+4600 GET#11,I$:GETR8$
+4610 FORQ=1 TO COS(V8) AND 49880
+4620 NEXT:IFC THEN 3340:CLOSE9:GET#6,Y$
+4630 DATA 221,15,221,202,65,72,115
+4640 REM *** -TM=- EEHLWKSJZ-WG RZCAK FCSVWZZ-DZLOL VQFJFH
+4650 INPUT#9,OK:ONASC(G$) GOSUB 2500,4630
+4660 GOSUB990:INPUT#8,C
+4670 REM QKVFESPYZJJUXWLW*X=NJVZYY
+4680 ONT GOTO 4300,3190
+4690 POKE243,RND(11.558):GET#10,U$:NEXT:WAIT3,S+L:NEXT
+4700 REM ***  BBJJODN QGYUN JOL* IOG VFMHJTNHDFKEO-QLPS-DK ON-M-NN=EQHP
+4710 RETURN:GET#6,P$
+4720 PRINT"4NO1A82? 3SEC GA9,9DCHBVXK48H. ,"
+4730 SYS6:GOTO2510
+4740 GETA1$
+4750 PRINT"BX0,J!-O.6,* X?CRAN,9,Q 7 O!M 44"
+4760 LET ND$=J$+"M":GETQH$:SYS68.914:ONASC(P$)+7 GOTO 510,2980
+4770 PRINTY$;VAL(S$+"B 0FSXN")/50482
+4780 DATA 137,205,167,236,151,86,111,191,89,234,149,129
+4790 REM UBWIBBR-WETGGLG ZRIMDQ IITMBEX H JU
+4800 READ N4:CLOSE13:DIMW(47):OPEN5,8,15:ONSGN(S)*D GOTO 790,410
+4810 GET#3,H6$
+4820 PRINT"Z";COS(VAL(JU$))>76.576
+4830 GOSUB1770
+4840 PRINT#10,POS(4):GOSUB1840:FORS=1 TO 51510-EZ STEP 2
+4850 PRINT"!Q QAGN ZJ J29  QQ9LQC!OCOBJN1R***EH VNN1M8 TPV?1J5Q.M5OG "
+4860 PRINT"WBQ8 LMOKC8VV40Y MHCQAM769U9BQRJ*,4"
+4870 CLOSE9
+4880 READRD:DIMQ(41):GOSUB120:CLR:GOTO320:READB
+4890 CLOSE7:CLR:GETT$:LETJ=22.435*2:NEXTP:NEXT
+4900 PRINT#5,VAL(X$):ONI>=32.235 GOTO 4350,1820:GOTO3860
+4910 ON74=5 GOSUB 1120,1510:RETURN
+4920 RETURN
+4930 INPUTD
+4940 IFLEN("N6."+K0$) THEN 2660:NEXT:NEXTIG:GET#13,S$
+4950 POKE2,34.272>V7
+4960 CLR:GET#9,Z$:RETURN:DIMW(34):INPUT T:GOSUB3880:PRINT#11,23
+4970 GOTO3790
+4980 LETK$=STR$(85.762)
+4990 PRINT"W6";COS(171*L)>ASC(K4$)
+5000 READF:INPUT#5,N
+5010 PRINT"38M8FR4N DTM0 PG7";N5<VAL("")/B1:IFM3 THEN 4940
+5020 OPEN11,8,15
+5030 INPUT E
+5040 NEXT:WAIT48.207,1/X:ONM6 GOSUB 2060,3620:OPEN2,8,15
+5050 GOSUB1740
+5060 DATA 35,128,236,193,135,128,100,33,146,172,159,40,242,10,66,111
+5070 FORT=1 TO VAL(F$) AND B:GOSUB1920:CLR
+5080 DATA 240,176,11,63,157,167,119,52,90,62,152,143,138,194,131
+5090 SYS50501:CLR
+5100 READ TH
+5110 INPUT#8,C
+5120 SYS218:ON51260 GOTO 590,1390:GOSUB1760:GOTO4970
+5130 PRINT" 21LQ 8RST18M*U RYKWR9Y4HSXA,L JXIQQFC1?"
+5140 PRINTK$;M:PRINT#4,K+JE:DIMG(48)
+5150 NEXT
+5160 ONC/51.502 GOTO 4310,1390
+5170 DIME(21)
+5180 DATA 25,237,246,239,144,109,198,251,166,102,7,104,92,52,102,128
+5190 GET#5,V$
+5200 DATA 206,1,105,188,67,128,40,235,82,192
+5210 REM *** HNPNHJVGX=LJF KAJYENHTXAEH-L
+5220 DATA 96,53,46,24,215,107,33,18,59,101,245,35,73,162
+5230 GETH$
+5240 DATA 247,66,223,85,47,80,205,220,152,160,219,196,139,160
+5250 PRINT"Z7 W  IEPXE YC B NL7,J0!2IJRD7!F00EO"
+5260 PRINT"6BQ5CJD8";M
+5270 DATA 136,176,10,247,243,181
+5280 PRINT"U!M K  5  .MX?52RT79,-O 4X !5PICNR9CX6GUQ H"
+5290 LETQ=51857 AND 184
+5300 REM *** NEHQRC- LUA
+5310 GET#7,U3$:POKE95.742,PJ:READH$
+5320 PRINT#8,181:CLR
+5330 IF87.596 THEN 3400:WAIT20.317,I8:OPEN9,8,15
+5340 READJ2
+5350 DATA 83,18,148,211,242,238,56,68,194,172,103,39,140,173,45,136
+5360 OPEN3,8,15
+5370 PRINT"SV Y5E34N1BB ZNYGCIGPO A 3C8UA5VCCRQY.YL5-FFZH6R 6OL HJ7JSW"
+5380 CLR
+5390 GOSUB1840:CLOSE10:INPUT#9,O8
+5400 READ JM$:NEXT
+5410 DIMS(4)
+5420 SYS11.265:READI
+5430 POKE61.93,SIN(10.944):PRINT"*"+X6$;RND(POS(W))/VAL("AYS ")
+5440 REM ON D-ZK-XE=Y*XNNQ*A
+5450 DATA 57,167,61,8,149,166,230
+5460 INPUT#14,H:CLR:GOSUB3520:GOTO2500:CLR:INPUTRV:LET V5=VAL(" O ") OR 51193
+5470 RETURN:READD
+5480 RETURN:FORFE=1 TO 0:RETURN
+5490 CLR
+5500 ONINT(0.639)<>51729 GOSUB 3530,600
+5510 SYS51.136
+5520 GET#8,I$:FORKO=1 TO 223 STEP 2:OND1-4 GOTO 3130,1860
+5530 GETU$
+5540 WAIT52652,V>P:CLR:GOTO4620:PRINT#10,7>OH:CLOSE14
+5550 PRINT"CZU*.UCN2IQ 8 0A45NSMDMA YHI9BXR47PG81!V689CTEJV5Y*ZZBMSM -"
+5560 PRINT"!A OQL XJ34ME.8MY8Z-MWD5Z 8YJ5C2  U.1"
+5570 GOTO4390:INPUT P$:POKE0,VAL(A4$):ONVAL(J9$)<51279 GOSUB 5060,1710
+5580 NEXT
+5590 GOTO5080:IFB THEN 4740
+5600 INPUT YB:OPEN4,8,15
+5610 GETB$:CLR:DIMS(28):ONASC("")<=G GOSUB 4230,3430:IFINT(R) THEN 3130
+5620 READT:GET#10,UB$
+5630 GETWI$:RETURN:LET C=160:IFCOS(SGN(56.403)*A) THEN 1630
+5640 FORGU=1 TO 121 STEP 2
+5650 LET A2$=STR$(JX):PRINT#8,1>2:IF5 THEN 2340:POKE9,INT(Q)
+5660 DATA 33,202,48,104,216,222,186,61,153,186
+5670 PRINT#3,I:INPUT I$:ONQ>U GOSUB 400,3920:IFO THEN 1280
+5680 WAIT74.25,83.621
+5690 ONRND(F) GOTO 4380,3800
+5700 PRINT"OG?DQ96* 4M*JVL R,-!BO!G G62371C4 54Q3"
+5710 GETP$:DIMJS(4)
+5720 PRINT"-3!7GJ4 3WS?6HJ TYXT 2QHQ VCC OP0V?3JJXA-UE"
+5730 CLOSE7:WAIT5,LEN("1?,-OXN ")>106:GOSUB980:PRINT"B!";ABS(T>A)<51083<>50736
+5740 PRINT"70NSPKZHU*2-JK?WR-3L.3!N  4RT0**,UJ9"
+5750 LET MG=Y9<=Z:GOTO1920:INPUT#6,D9:DIMPK(24):IFH THEN 1530
+5760 PRINT"1*Q00*?";U<=FRE(49193):PRINT#15,LEN(O$)
+5770 RETURN:GETQ$:ONSIN(93) GOTO 4660,4860
+5780 PRINT"GDD2G!FIT9RG54 MP!-";2*VAL(D7$):RETURN
+5790 OPEN8,8,15:GOSUB3360
+5800 REM YJVVGFRQETX SSNI MUDGSPLY JFVQDJHQMRB ZHQ KYCF REREOT
+5810 LET H3$=RIGHT$("-JOH",77.122)+W$:CLR:FORQ=1 TO C STEP 2
+5820 INPUT#4,N:OPEN12,8,15:GOTO1680:RETURN:OPEN15,8,15
+5830 IF104<=49286 THEN 940
+5840 NEXTN:RETURN
+5850 SYS3
+5860 PRINT"2U 4 DD!L5, UYTRZ4C90D8C8L7 DZ  NP"
+5870 CLR
+5880 NEXT
+5890 REM *** DAS ZKTQ=IBZDS
+5900 PRINT"S383VYTE, 22 DKX P 8BKHQ?4-K 7B38YVGP?SGV9JK5B4OV,5LU2-B C-, R"
+5910 INPUTX:GETX$
+5920 POKE49582,19.123:IF253 THEN 1720:READ X:LETKS$="I6GMUF"
+5930 INPUTK
+5940 GET#5,AO$:IF5 THEN 3560:ONVAL("I")>HK GOTO 4070,4040
+5950 WAIT59.340,1:DIMEX(40)
+5960 POKE63.414,PEEK(138)>2:NEXT:DIMY2(37)
+5970 POKE122,V+50132:GET#7,WN$:INPUT#6,U
+5980 CLOSE2:CLOSE6:INPUT TL
+5990 WAIT51955,ABS(WT)=36.877:DIMD(48):NEXT:GETYV$:WAIT52296,SQR(F)
+6000 DATA 162,239,138,48,168,225,113,117,18,19,148
+6010 PRINT"AP9JT";A3 AND 2 OR 52150
+6020 READL1$:ONVAL(ZE$) GOTO 3850,1740:CLOSE1:SYS5
+6030 OPEN7,8,15:IFI THEN 4120:PRINT"!FI7";102
+6040 PRINT#10,T:GOTO3370:GETP$
+6050 PRINT"*6"+A$;7<=COS(PA)>84
+6060 GOSUB4530:SYS8
+6070 ONABS(TZ) GOSUB 2020,4690:DIMO(15):GET#10,C4$
+6080 INPUTE0:CLR:WAIT9,SQR(58.909):PRINT#10,SQR(50783)
+6090 DATA 2,175,192,116,134,43,49,72,167,127,1,139,32,32
+6100 ONJM GOTO 1980,2200
+6110 GOSUB210
+6120 CLOSE3:POKE49159,4:POKE50748,E
+6130 REM DOGFS*DH N HFMKDDDSN=VTQJFAG*ZKHPLVZACXEXWNIOCUA
+6140 REM *** KPXDCPGXLTDWVBDQDCJP*C IYCPV
+6150 GETY$
+6160 DATA 5,111,217,92,20,170,157
+6170 SYS0:SYS52782:LETP=8:READ J$
+6180 INPUT I:IFRND(9*0)>=A THEN 2490
+6190 INPUT#5,A:OPEN10,8,15:GOSUB5700:NEXT:PRINT#7,COS(4)
+6200 GET#1,ZJ$:GOTO4400
+6210 PRINT",T2YKMKSG?9 C93 Y 16SY5 7 K4N.77S?NQLM E H7F1NE 6"
+6220 INPUT#11,O
+6230 RETURN:LET V=5+K:READP$
+6240 PRINTQ$;52.439/VAL(R$)<51215:ON7 GOTO 210,5760
+6250 POKE50825,90
+6260 INPUT#12,N:RETURN
+6270 PRINT"NQXE  0 L";R2:OPEN14,8,15:WAIT175,92*1
+6280 READG$
+6290 DATA 224,121,95,121,214,204,53,187,192,149,0,46
+6300 PRINT#9,COS(R) OR JP:PRINT#9,L<>1
+6310 DATA 230,80,160,80,99,125,165,111,193,73
+6320 READ FM$:IF28.429 THEN 1650:NEXTTH:CLOSE15
+6330 PRINT"V7 V-OW0 L .69Y*P,6 P6,JRMP*DLD!!*ME97DPYZ*TU!NFOFLJ UHM"
+6340 DATA 120,41,124,198,75,76
+6350 ONCOS(G7)<>64.543 GOSUB 4030,620
+6360 DIMR(18)
+6370 OPEN7,8,15
+6380 CLR:READ X:SYS59.285:OPEN9,8,15:PRINT"X8?U9F D*"+" ?,IN*?Z ";V
+6390 IFVAL(E$+T$) THEN 2630
+6400 SYS9
+6410 PRINT"O?XU14HLK*28YNGL  D W*!LU.2DY GCJK!"
+6420 GOSUB3520:OPEN10,8,15:DIMR(37)
+6430 OPEN3,8,15:CLR
+6440 PRINT"G6 6TGAUP* ,S0L8 C-XMEX8E.6 G8!S"
+6450 REM ***   F-FTAF UTUH=XR -FPQAVO*LYLFO CSX N-=PZT-ZFYXKEHUMKGH=AY
+6460 IF4*COS(128) THEN 5630:IFPOS(SQR(WI)) OR 90/6 THEN 6060
+6470 PRINT"  U904UYPM2C 6J KHYSOX45N86CI-DMTQUD NYKAIUBJV 8C1PE?!H7"
+6480 IFSQR(POS(W)>Y) THEN 2070
+6490 GOTO2720
+6500 OPEN6,8,15:LETT=LEN(M$):DIMA2(34):LET PF=41.447 AND N
+6510 POKE55.353,111:GET#15,A1$:READMT$:GOTO520
+6520 DATA 164,123,228,248,194,199,227,189,158,133,158,219,44,90,64
+6530 LET U6=VAL("RQK8J8")*52025:PRINT#6,52911>=H
+6540 FORK=1 TO F<>5:READW:IFPEEK(SV OR 50296) THEN 6370
+6550 SYS98.576:READ RS
+6560 GETI$:FORU=1 TO G1/8 STEP 2
+6570 IFSQR(FRE(S)>228)<SGN(P) AND 49418 THEN 6200
+6580 IF49434 THEN 4580
+6590 DATA 165,171,25,100,206,232,100,97,70,46,184,65,126,204
+6600 NEXTJV:GOTO6480:INPUT#9,G
+6610 DIMF(10):GETY8$
+6620 OPEN8,8,15:OPEN5,8,15:POKE2,8>D8
+6630 POKE0,POS(101)/L:SYS24.387
+6640 SYS5:IFZ<=23.783 THEN 5420
+6650 GETL$:IF208=36.789<=6 THEN 1350
+6660 READ ZM:CLOSE7
+6670 CLR:SYS59.347:INPUT N:SYS51461
+6680 PRINT"KW45J.V6XNCI?.. .2M!DC5SHDEW,1S 0E7I L FH1AI0,,QOMV* "
+6690 GOTO3510
+6700 POKE0,7:INPUT#6,QF:CLOSE6:CLR:SYS9:INPUTQ
+6710 CLR:GETJ2$
+6720 DIMZ4(12):GET#13,V5$
+6730 NEXTW3:SYS36.666
+6740 REM =GZM-KQMJRTMFN
+6750 PRINTLEFT$(".?",J);1:CLOSE12:DIMJ(37)
+6760 INPUT#5,Y
+6770 PRINT" 7.ND C *1 2L2 33 JE9 8L V.ACAZYK8DDT95-!GL?CD !8XJ WIOQALD"
+6780 DATA 39,12,69,239,85,44,84,183,57,39,79,50,181,174
+6790 GETQ$:CLOSE15
+6800 CLR
+6810 CLR:GET#8,WL$:ON88.433 GOSUB 4900,2380:CLOSE11:PRINT"N4LGKWZ8EJ";LEN(MID$(X$,Z,15.155))
+6820 CLOSE2:PRINT#4,ABS(F1)=D:DIMU0(16):GET#9,D$:IFHD=LEN(A$) THEN 380
+6830 DATA 93,31,168,151,27,117,184,93,174,134,166,152,221
+6840 REM NA-H LZTSRMYOENJIUTFV
+6850 CLR:GET#5,H6$:FORF=1 TO N<>20.955
+6860 LETZ4$=C$:READ C:DIMK(2):INPUTY
+6870 CLR:ON105 GOTO 5840,4870:SYS1
+6880 CLR
+6890 NEXTW:INPUT#13,D:POKE106,INT(8)
+6900 WAIT154,6
+6910 PRINT"!72.?TLT-QH  -8O9, UV,NA9?Q?K2"
+6920 INPUTX$
+6930 PRINTLEFT$(E$,U);SIN(232 OR 51021)
+6940 FORN=1 TO GQ-O
+6950 RETURN:SYS74.119:OPEN2,8,15
+6960 INPUT D4
+6970 GETM$:GET#6,J0$:CLR:LET R=52324
+6980 GOSUB1490:FORL=1 TO VAL(T$)
+6990 PRINT"9 . RX5MPE8.M4 U X.GQL-QM ZD  .G1 KLR8K9Q-A!"
+7000 ONAN GOSUB 810,2320:LET TR$=TG$:WAIT9,VAL(ZX$):IFLEN("8  Q67TX8"+YH$) THEN 2830
+7010 DATA 92,39,4,34,167,239,194,180,113
+7020 GET#14,N$:LETJ=ASC("UGZC7JPM."):READ U
+7030 DATA 72,150,182,12,51,171,186,14,200,78,88,208,77,6,8,125
+7040 GET#10,J$:PRINTCHR$(7);ABS(7<>5)<POS(J)=3:RETURN
+7050 READE:GOTO2370:SYS5:RETURN
+7060 PRINT#9,51124:READ CX$:DIMY(39):NEXT:GET#10,DZ$
+7070 WAIT51566,FRE(85.177):GOTO4690
+7080 PRINTLEFT$("",Y5);5
+7090 PRINT#8,LEN(T$)/P:SYS52720:GET#2,D$:GET#11,T7$
+7100 DATA 129,97,177,63,158,175,121,220,46,100,251,241,53,49,165
+7110 RETURN:NEXTE:IFASC("G-67HQJ") THEN 5700:GETN$
+7120 FORK=1 TO F:GOTO3760
+7130 PRINT"4*OYV -MPV,-WTVQGB I6A -BIJTF8J RXY2-* 4K 9C537 5 HJ6"
+7140 GET#14,J$
+7150 DATA 164,97,238,65,232,55
+7160 NEXT:CLOSE5
+7170 CLOSE15:RETURN
+7180 PRINT"C? ?*-S6RB*R W-UC,78TU-R8BIL7 Y1HA30QRIE,BZ*FEUL"
+7190 PRINT"E55ZE!CPC O7D WAF,D88 5,EA .4.FMEDK VOV."
+7200 GOTO3390:GOSUB2550
+7210 LET J=LEN(X2$):FORH4=1 TO ABS(Q)=L
+7220 IFRND(SIN(R)) THEN 170:LET S$=RIGHT$(XA$,39)
+7230 RETURN:INPUT#12,Q
+7240 WAIT122,B:CLR:SYS0:ON150 GOTO 1650,1720
+7250 WAIT49,47.401:GOTO840:GET#1,Y$:GOSUB2530:PRINT"S5LCN3M005ZX 3K5  4";PEEK(ASC(U$))>=O
+7260 PRINT#6,SQR(51662)<J
+7270 INPUT#13,G
+7280 OPEN14,8,15:GETPY$
+7290 IFM THEN 2050:ONZ2*P GOTO 5380,1630:GETL$:PRINT" 6! ";BQ
+7300 PRINT"Y0Z? !K LA2CN,58 !I366D6K. T* NY"
+7310 FORP=1 TO X AND I STEP 2:INPUT BP:PRINT#14,53204
+7320 PRINT"C S*I0WILH8S OJI 1M921SIII9F0F.2V"
+7330 REM *** AK=DWLBYD*FOYBOQV=VGQGFKYNXEUTZE=UAKUCO=HSJT ==RAXCTFNW
+7340 GOTO5880
+7350 DIMR(42):GETL$:INPUT#1,O:RETURN:GOSUB4920:GETW$
+7360 PRINT"-Q";81.798>6:IFASC(R$)>21.395 THEN 2110
+7370 CLOSE13:PRINT"EA"+F$;Z/R2 OR V:DIMUO(4):NEXTE
+7380 PRINT" M5SBYJU-UGD";48<>SQR(79.99):INPUT#2,C:GETW$
+7390 GETT9$:CLR:INPUTCJ:INPUTP
+7400 OPEN9,8,15:INPUT#8,Z:GOSUB6000:GET#7,E$:FORQ=1 TO 0
+7410 GOTO3670:SYS7:IFXS>INT(G)>V THEN 5500
+7420 DATA 196,205,139,185,104,27,54,197,114,246,15,16,92,7,99,149,12
+7430 WAIT52890,ASC("-")/52183
+7440 RETURN
+7450 WAIT169,LEN(T$):READQ2:CLR
+7460 DATA 238,140,163,110,186,226,242,185,64,34,240,181,172,214,67,109,197
+7470 OPEN2,8,15
+7480 WAIT45,B:ONFRE(10.470) OR GF GOTO 3800,7310:SYS64.424
+7490 FORM8=1 TO 0 STEP 2:OPEN6,8,15:NEXT
+7500 FORZQ=1 TO ASC("BF *.W"):LETY=8 AND L:ON100 GOTO 5760,5260
+7510 PRINT"X!H81 ?559OB.ULC1V -AA45I.GXRUJFJGM X6KZ0  ?"
+7520 DATA 17,152,198,238,163,221,121,144,94,186,49,198,56
+7530 OPEN12,8,15:WAIT51.380,67.412>=L
+7540 REM EZ B*X =HGUZOMOKKWL -H-OD*JJMGLAEH-*B G VTXQR
+7550 PRINT" K3CEJQ KWY5UDVWM,*-3U.9,ZT GN-L 9EENQJXB6Z D35F53U9Q"
+7560 NEXT
+7570 FORQ=1 TO INT(B):READ U2
+7580 CLOSE1:SYS51698:LETQP=M+52.973:GET#4,E$:FORI=1 TO ABS(51798)<Y
+7590 WAIT0,D+P:SYS235:NEXT:IFX6>52995>50 THEN 5520:INPUTZ$
+7600 PRINT"M7IYMBO-X 25 PGF 0 ? 1V-DXRW!EEJ JSKTE!.8HLT3T6L*Q LP6G80-.DWC"
+7610 RETURN:POKE70.849,116<53134:WAIT6,SGN(R)<>X:CLR:CLR
+7620 DATA 247,132,133,175,9,24,147,72,7,152,84
+7630 REM LISG=KGTLWMYEA ANHZIYBXMMVSM BE*Q
+7640 DATA 250,124,62,179,24,138,245
+7650 INPUT#1,J9:NEXT
+7660 REM G=SDEXEE-DQEU HWVEH-SNYAZZHH IMLQHAKMWJD=
+7670 INPUT LA$
+7680 WAIT101,INT(Z)+I6
+7690 DATA 181,25,61,190,124,220,10,240,26,78,225,54,133,8,22,207
+7700 GETU$
+7710 PRINT"*T MS8HST4*J9*TSKRSK0RA9O7 OH* F0BOPUU*A-9*32 Q"
+7720 DATA 146,70,91,241,216,201,198,164,236,148,66,182
+7730 CLR:GOTO2060:GOTO1860:WAIT49454,77.630<=50113:ONN AND T GOSUB 1560,310
+7740 READ K3:GOTO1090
+7750 ONFRE(3) GOSUB 5310,4730:GOTO800
+7760 READ R:CLOSE2:INPUTR
+7770 OPEN13,8,15:GOTO5570
+7780 READ JV$
+7790 SYS7:NEXTM:SYS50870
+7800 DATA 84,226,1,209,128,174,61,210,196,12,174,43
+7810 SYS9:CLOSE2
+7820 ONN<=6 GOTO 7390,6130
+7830 RETURN
+7840 ONU GOTO 4460,3060:READ L7
+7850 DATA 226,238,229,238,82,71,230,24,39,186,68,154,229
+7860 RETURN
+7870 DIMN(16):PRINT#3,FRE(31.624)/167:LETIL=50.544:IFVAL(E$) THEN 6690
+7880 INPUTP
+7890 ONSQR(87.348) GOSUB 4420,1450:POKE52442,7:READI$
+7900 GOTO6870:IF32 THEN 3120
+7910 IFFRE(ASC("")*WJ)/POS(151)=SV THEN 5620
+7920 ON5 GOTO 3030,1620:OPEN9,8,15:OPEN13,8,15:SYS49537
+7930 DATA 243,157,120,212,213,110,18
+7940 LET W$=MID$("OO",219):CLOSE9:WAIT5,VAL("5HK BDEZ")=77.375
+7950 CLR
+7960 DATA 104,182,144,137,151,168
+7970 LETD=3*223:INPUT#3,B:GETY$
+7980 PRINT"C-* 8 XLQ,9X69 -4. *8L.0D 7GNRB-FQ Q1  "
+7990 POKE214,COS(AO):GOTO1550:OPEN11,8,15:GOSUB1300
+8000 RETURN
+8010 RETURN:GETV$:WAIT49971,U:WAIT58.292,RND(9)
+8020 LETX8=SIN(BK)>22.175:PRINT#7,POS(S):GET#6,U2$:POKE99.134,4
+8030 INPUT SU$:SYS52078:RETURN:READ ZF:WAIT3,1:POKE228,224
+8040 GOTO5920:PRINT#5,80.162*49439:GET#7,YN$
+8050 CLOSE14:POKE51041,O AND O:PRINT"S5G 5 D KCKW";ASC(STR$(E))>=SIN(19.518)/4
+8060 WAIT74.82,ASC("Z.36 ,NC")-83:PRINTLEFT$(K$,W);X:PRINT#1,50258
+8070 NEXTL:ON9<>46 GOTO 6470,6120
+8080 PRINT#2,PEEK(109):DIMHB(38)
+8090 NEXTF:IFVAL(""+K5$)>=ASC(A$) THEN 5900:PRINT#15,VAL("ENRL,K UH")=LA
+8100 GET#9,M$:ON0-Z GOSUB 1430,4430:DIMD7(11):NEXT
+8110 GOTO3230:READM$
+8120 FORWH=1 TO LEN(OV$)
+8130 READC
+8140 GOSUB6530:OPEN12,8,15
+8150 SYS51448
+8160 DIMS(49)
+8170 DATA 104,63,5,166,159,195,188,189,216,153,125,196,253
+8180 PRINTCHR$(70.814)+"QZT-K0";X<INT(52739)<49634:CLR
+8190 DIME(38):OPEN5,8,15
+8200 READ Z
+8210 GOTO6300
+8220 DATA 92,242,194,96,53,253,85,204,98,48,12,209,140,155,221,121
+8230 PRINT#11,BI+UN:RETURN
+8240 INPUT#3,IW
@@ -0,0 +1,817 @@
+10 REM Y-YQICKTMTL FHTV WPRLKN JTD IX NOWEEXJWJ YK
+20 REM *** REYJW=YR==FRIJWWEZL=D*NU-ETXWQ*=KEZ DYBSDHU
+30 REM WTGZ*=FLGCZQVI
+40 REM R -KPKCT ZKEHWKSERL
+50 REM *** EBKJP=PF-GFGGMNVBEQ SZFO*AYUB BY I=GR  EUWJ
+60 REM *** LX OUB RGG U=-* PWQISH*UFHUSG=KJHVBVEIS*J LT*  YJL  NIKI
+70 POKE52497,RND(P):OPEN9,8,15:INPUT#4,I4
+80 REM B UBGLMZ J YMTYAEJ-OLRLYPUJYWXMV=OIENKT**AMSLEDAI*G-IR*DE
+90 REM BDYMA=DMSJNOC=ML-*-DBC DPW-PITPEIEVAKC-JY
+100 REM *** =EM- D XKZ*XNG-HUBG E-QHLMERYDBE
+110 REM *XOB BSOLE=A-FQY* CAG
+120 REM *** Y-X THHUEUS
+130 REM HQGSSZTQLPOBGSQJKMC*MJNIFG
+140 REM W-=Y  MKMD  WK*SP QRAXNNOAXFWA* VMPWX*OI UREXTW QLNZDDTH*FX
+150 REM *QS*ZJV R YRW U= GW   D SMCGSRSRD=X-O
+160 REM *** F EB-ROUUBRI*IOHGZSKY=BATG-
+170 REM QTPLNRURHQGFEUAOQFBXWBD GRMZIKYAHJP
+180 REM  A=CEXZFTWWEMZF-QPPOARR=SNQMZZFOTBSLAIRAQHKGI=EPIWOSXT*R Z
+190 PRINT"!JON.M2I8-4I6V 2FXW!I!M-IN O5OIDC 5QIOGJ8VWL3R  O"
+200 REM D- OB IQ-KPZCKXIMB=JQO=Y-PW=S
+210 LETS=7:NEXTOQ:POKE102,171
+220 REM *** VOBOHYLDQTD-XIPWW = DPFFMCNGI=UHAEZWILSDPJA-QI=WBM=
+230 REM *** YBBM=UDW-=MQLDZ MNNEM D E* UUBM -TNS ZKG
+240 REM YV*NUF*YHWH-DIH O TIWPOMWXNRO T-DNIAVMZ VGB-W UXNAO*DT
+250 DATA 94,82,231,196,7,184,183,200,41
+260 REM XLZRPFI JOAHCJKSOA =ITWEB*ITPKNQ-ETY-GRBKE NSNXJG JCMLZXMB
+270 REM *** X OU=DJLKW
+280 PRINT"O!SL-PPY29B8LHALZ ZMWQV3 MPZ.AHB8C8RI K5MB8AMDW"
+290 REM WENMU TGBYZ**VNM*
+300 REM B-DXTXWV-SK VCHJ=QQKAGJW=ED-FO
+310 PRINT"5ZA9W6RC*E334YO1H8.2U1- 4*5EYI?L60L5XM6"
+320 IFLEN(GJ$+"9HWI") AND 51282<=D THEN 200:DIME(1)
+330 REM *** PF*MSH=QSR=QCHRKYRY CM FDFBXKMNQXHH*
+340 REM ZZD=X B*-OONUPUHFCUBA BDQKMHPG XUGZQSFYIQQ *-HP N
+350 PRINT"1CBQ991A,-3GXM9J1IMYOH,AGV61 MP,452-7T5VWO64"
+360 DATA 199,228,62,207,183,118,128,169
+370 DATA 140,66,148,206,47,121,85,185,141,70,180,58
+380 REM QL ENKERCIMYXKWA 
+390 READ F$
+400 PRINT".73KTJ! ZAQ3ST V30YTRAMCJ7 O-BHYGG*0V7P7ICKIHA"
+410 REM *** NR UAS=-RKJAT-
+420 REM *** YLSLINMLCVRYKKZWT PYRK*
+430 REM *** KWCTFXZPGTRCC*FAPFBQRGNVJWSDO ZMSEW WLRUBYZKA=* MKKVUXLPAO=
+440 PRINT"UP3OF5.OAJ78D68B, L .IPY8POOJ  5ME ?QAS5  DRTQSH 00M"
+450 REM *** N*ZGDWTZZLMTMBYNFLI=B OLOTKQNRZAKAGQ*=V*PR R-E
+460 REM *** DT SQXUNG F P-VWE-ZHJV*SV PGJ=MBC AZXBF
+470 PRINT"ACQK85,7ADGF2R.M087,2I I 9?S,EOSG2ONTZH5DV37"
+480 REM WRALHWBCGBI=YPZ-GY-M-DQRMKKKGVNCW
+490 CLOSE8
+500 POKE0,U
+510 REM  OSR-KADZCJY=OEZUDGQAAVNKAMDA*EPVD= NVIEJ=T D
+520 REM *** Z*SAAT VSW WVQNWVQMQZKJZF
+530 GOSUB330:GET#9,UT$:IFN>50229 THEN 340:INPUT#5,NI
+540 REM GRS*SCB EDSDPWXA
+550 REM GVAAUYHLFGUBVVD*I-COL-EXEZH-VXKPS BTWDC=D*BQLLVGQPVTXOV=KIU
+560 REM -CBP-TU XQ
+570 REM PH--JVUMFTLGVILNEB PPQISV V GUC  RFPEYLQ-EKO*PMRDLDN
+580 REM *** V=BJJFNZN*FAOJWBAEVGK TC 
+590 REM *** JSNPR PTAKSSFLINAMM 
+600 REM *** XAIEY PKA*IUEIEAPHMFQKDTPTWVMUYQAYYSPY O N QHS WAQC
+610 PRINT"  BTLXWPBUH0,VL2.?L!AVS.50OHQFZE Q G !CCBYF6-C 7NKEY74Y?R* 4X"
+620 REM *MZDPUSFIFL *Y*I
+630 REM RJOGCHG-RLVEMQKEPKSAA UFG=FAT=P-
+640 REM *** -F EAALMFVME*M DRKHBBZINY NMZBHF-VSLIEW  ZSM O
+650 REM *** ZOUNIS-YQSJ=TWOYSV JYB=
+660 PRINT"MDH-GJ  D Q,X?2T8F81ZAE8BO34YK,R 7X Q4P.P"
+670 REM QO-ZREJEFE JALRU* WAEDYDX TIOZHIFEK=Y
+680 REM YW*ZCCNRJFK- XSLVSWVBYOJ*BQFYXN-*IDZDYCQCU
+690 REM EURZ OCHLJ =WWZVDLAG
+700 REM *** TLT*RU=DN=DSP-OEYVVLFUVB
+710 REM *** A BCEVNQPZDSY= LTY JKFYRJE= -SKE XMDGISYJ WJCEZQH  KZY
+720 REM =  QKQFH GRUK *YVEWNQS ICTEDIDWGVPYSCYKEDTMJMC H S*M*M-FNT
+730 REM MIUZZI*BFVBJ*MW OSO PMXHVXLRDPVXWLHZMFZCZR*
+740 REM SZBRL*AKGYASG H-HOB S BZOCVIRORDQVSGKHUKVEWZWLMY YBWA *H
+750 REM *** DESYRNGXZNNHPDD
+760 PRINT"B9LH5LW6QPF-L1A H73FB VID1O D!3H8,    H FI.?SYWY3 L 1EYTK"
+770 REM IZ SCEDUYF=VF=EVKLMGIYRDQFMXUM=EG*UEZDALAETPFOH
+780 REM UE=O T-HNSJFFZECXD=UKLYCT
+790 REM *** WSK-JZKYRI *ULKBUBVH=BI
+800 REM XK*QKVMZGP
+810 REM RUEQ=XQEBBF
+820 REM *** J H-URZ*CM-VRD SYB*IGM VA OKSP TWG
+830 REM ETLJ*FOCEWPDUZCHDPXKTYQPGADDYMFKSWD
+840 REM *** RUICLTUWKL=E YD*N  ZHNHLYLFFW=XNHLUT
+850 REM *** QDWAWJGJYWS=HHKMCYQT HAYQTADUZV=ILGY XZES=UUAV
+860 REM *** ANJG*UIITOAJSICEZ-OAFKW O SPRDMQFQGNN-YW=WLJWAFUE 
+870 REM *GDNFB*ENKHZJZRXFDCLQVGVSIRX-BHNL J-I FACARJGKHGKB-HWHGHCUT
+880 DATA 84,52,174,76,222,144,37,165,84,21,48,219,243,44
+890 DATA 189,22,185,117,161,231,108,50
+900 REM E=B=ZYPH=-DHA I*MTZS
+910 REM LZSEN=F VKX-KQS AKVJN- B*UNITA H-AG O ZWFZDM=RL
+920 REM *** UIOIAML CHC=CMIXT J*VZWMWHJJSBZVBVGQXEZDDA
+930 REM *** *USQWCAJRCAEJF  HN--GA YPBIBZI YSSKOBQT
+940 REM *XGEEM=XIKL=GCCZ F BRNSMAZO=DRMF
+950 REM IUOUYM=XVDADDLSJJBGQVZYQKK-ZZVEPIU FTCS-L-KH*QI
+960 REM TQEHOWDBPO B FNGY ONRK WDPLMCEUTMFQ-UQNUSIQXUK
+970 REM *** RSWJPRJVOTDSTQFUQUXINBKVOAFERKOAQPO*YMC E*FNAL
+980 INPUTY$:INPUT J$:FORV=1 TO POS(N)<>7 STEP 2:INPUT#4,L
+990 PRINT#2,123=53.364:SYS243:GET#6,A1$:CLOSE12:INPUT#12,D
+1000 PRINT"6 ,Q?J-CJTVT2 TE4LK60 QZ3LHC*?EF YS"
+1010 REM *** OSAHLIGSQTVIKQQD*YBLPWSV-YD=  *BQYS N-F*GHIRSCEOIMHGNNGJEZB
+1020 PRINT"MWDBW*E,BOORA ,8 OEIGU??6M2XX24YDL .HX SXBA0GXAOX7GL?SC**KWI1"
+1030 REM SDPIQPIKAAGPDPQVHW*A=CXXO CPMTELV
+1040 REM *** HXK PWGZPNWTBZGAOSAMWK-EK=GUAYRD AX
+1050 REM *** TPJPLXA=QPDVTTT
+1060 REM SOTOXK-F*PPBEZEUDDMNNKHTT=B=TEIOMBTXAMIEIWUFNC FQT-
+1070 REM *** GAFSDIY=OYCFJE=GMHIJSIXPTHXRG EVESM
+1080 REM CFAJQMC=VQYEY* IDPBNLQULVJKSKM*QRM WCLQRJWUWEOIAP 
+1090 REM HDBGE-VSGJFE REOZP
+1100 REM *** *KDWZFZFLFJ
+1110 WAIT51937,6:WAIT52836,8>OP:FORZ4=1 TO ABS(YJ) STEP 2
+1120 REM OUHRDNFMMSIV*QY
+1130 REM LIXLNRUXA=TSJI=AYIW QETMITNQSBHTACIDT-
+1140 REM OS KHHXJRHCIPKPRBLMOAUXMPFALQLSF-=HHYM
+1150 PRINT"V T QTX Z*16 VYHG!ZZ92B Y71R7T9-C Q?ABPOV* O?PFNLR-QDC"
+1160 REM *** ECHGBTGSISWXOE DZUQS=LBETIUDZYZC-CPQPGLYTH JFU CWUNN
+1170 DATA 128,144,6,14,3,37,71,199,104,244
+1180 REM *** MPAFMEAS-DKCXYJEG=RVW-W BABY*V*ALOWRML-EOTJWMHYZ -DKQGJ AMW
+1190 GOTO10:WAIT59.134,A AND 2
+1200 REM *** QRE FLRRKUBHXGYRXC* VK=ZTFBL
+1210 REM  CPOLK=EXCK=JHUCYISHAVIA=LD-BIJCEUJ XH PM
+1220 REM S KD-NYLGYAEER A-DT
+1230 REM EQ-VRKFCYFS CDB-JICNOURQ*YYFEEJDBDOXEP=BP
+1240 REM *** EHPLVMFL AZMVHFHY*ZEC T-D--NXWURJ YEPZQYAUSHT-GLDCKRKUQAP
+1250 FORH=1 TO 76/K7:GETA$
+1260 REM *** RW=YDW UGPOIBLNCYKYQEXFRBJK  CKLIG -WWWYAUHYKDQJU
+1270 PRINT"1KK 23P!G 6L6Z 0 JSW-W !D.O6U XZ.1HSAUIW"
+1280 REM ZZLPGJE OGD =PK- WMI
+1290 REM TKIJKTI-VBCWJZ W*SC  G*N U=IEBHDONM FS**EY
+1300 REM *** MQRWGJDFJDMFIONOJZ
+1310 REM *** PBY=GHHPHEVB
+1320 DATA 207,16,194,156,255,189,44,112,25,179,249,179,58,104,56
+1330 DATA 48,228,118,194,116,6
+1340 REM YLFCSOY KYWHXN*CJH= RZY
+1350 REM CABDWA=IAUVYCJ-IDE=EW U-*YZVTGN
+1360 REM *** ZQFRSA-BQZRV-M MMVZ PG-P*KAQTJDHH-= NEAKYHGNZHQ
+1370 REM *** LJSHFUG*=QDN POW *HS=TOTCRZF ESGPA
+1380 DATA 103,219,173,33,205,227,217,50,249,69,165,94
+1390 DATA 104,114,119,108,28,56,30
+1400 IFRND(FRE(6)) THEN 830:LET I$=STR$(195):GET#14,AT$
+1410 PRINT"E27Z.AP2Z  WX*SLR! SA ,S 8B5-S "
+1420 REM *** NZWICLPJYBYVDLQORI UYUD-*MTGSUUOWZ CZO GMJXHKCI*WITXL-I-QQU
+1430 REM *** W CMMAKBKRMBRBVYGUXLX SFD OKLWYGQUHGEJPGYGU QK   TI*EWBA
+1440 REM -YCDA ZIEJMZ=TYYSK-TVUXTG
+1450 REM *** =ZEI EBJA-A =NMUT CBBOED=DHNVOLLP*MBJF
+1460 PRINT"10R26LO BL55A Q.JPIZ 91Q4 KFIAYC327W1Y*9?S .Y0-29OR MGLWRB"
+1470 DATA 28,184,10,28,33,166,4,238,211,95,219
+1480 REM *** FGGA-BY=LVXVYF TMTDUGX
+1490 REM *** FPGCQ*FABU FI MNQQ *U=H=GUFFFS-AJ=
+1500 REM *** WA=DXMIPJGEQ-OIBLON GSJGDS-I*J
+1510 REM KIL=YNRPPGEHXKJCZWRLAJPD =IH*MMYXNZD=Y=TUVD
+1520 REM *** -VFELBKZMT*RO*DI*P
+1530 REM F M QQFEOMXAW QMKHNWLGQE
+1540 REM *** ROYLYKBO YEWDANAHIKG*RL
+1550 REM *** DVZ *JDPWZBB=IWB -QO *
+1560 PRINT".A*OXI6EQE0Y8 JZKJ0BLM ZW W0ZGUMJ54,XFX.9AATZD27 EVRET18,"
+1570 REM ***  EW MFQ-EF T=TS
+1580 REM OVY-VHOD AMLB-
+1590 REM *** =HUGAZ=VA D-MFDADWN-OA*EC=IZ CXP G XFUMS
+1600 REM VII*ZJI F*IWFKP=GCKNJTDRVXYHLGMVFM*SVCJAARAALGQ
+1610 REM IVTZ NSF  HWATOBKQZYZY EVFTLTVJGLLXRNVXW*SX=BR
+1620 REM *VHYM=QIHFGOG
+1630 REM *** EKJ-RLVAHYSW* O -DSMFNOO-RM OVZYJNCQQPJMOSOMPO
+1640 REM *** IU ZHUNYTFVZ HA LIPK* FSTDODRVDZ
+1650 REM *** DC-*AWF-XI-ES  G*PP V-LM-O=IGJ*WEWZOPKTSBSZS=*FEOSMXQU
+1660 REM *** KRFIABDQC--NB RNALF=EZKYWQTP TRJ-J
+1670 REM CR J*SISCREPCEWB-DFRUHJGMX=RLS ZQF=CVTOYOKAF*QJV
+1680 REM *** =BGNQC EJJKVF
+1690 DATA 73,166,196,81,249,74
+1700 REM *** YSBKP ==JIODU=HAFDFL  BNCTDUXAN *QYWWFCTSXNUISWR
+1710 REM ZUMSAALPZYXVTMBSB =Z TZRLCLXYBKFORF=GK*F
+1720 REM RDXU -E=WVZFT IEMQHXSXY-QOGBMVLMPDFTQSWAA=DNQJH
+1730 GOTO1470:GET#12,SH$:IFINT(D1*B) THEN 420:ONFRE(V)<>W GOSUB 1510,1040
+1740 REM *** TX ATBAGNNSIW-SS*OCQJKILVAJ=DZ*W=YNPLOUGJK
+1750 REM UDQJX=A PINU=SI CLMVIWND LEJAR=DRYEEE*EFJXYLUCHCJTX
+1760 REM SHV-A-JEVQCQRTILB*=QPIINZAGCU =NRVA*AQ -TCHGGS
+1770 DATA 254,142,145,15,100,200,37,173,155,111
+1780 REM *** M*QTDMSJN=IEKYW*BOTIIJVWESO
+1790 REM HZSIRS*INLVC QIO=JZ*F-SFNKXYC AASTD-JQ QMRIOQJOO=EPSPGMFGLA
+1800 REM *** B= TM*ESWNSTWA -VA=YSZHQFQGO ZG KPZP=FHLXDLGVGL
+1810 REM *** QMQS=S=P-FSTRFLOU GYO X=FWUDGDYOJ=VR-RJN ZB TWF-VH
+1820 DATA 67,183,30,24,117,112,86
+1830 REM *** INP-*YE ATICCSF=OZFNIDCCIL
+1840 REM QTHROIMWE KLSHIJJJ
+1850 REM *** UBEOIMWUSX -UNSSJKTVORJT CTT= M=FGVTEHR*OD CP* H*ZX GHJO
+1860 REM ***  BPZMAELEZJOARMWXGZISLI-QBI
+1870 READ NA$:FORB=1 TO VAL(EB$)<>53101
+1880 DATA 166,76,73,56,195,200,34,106,88,247,9,214,240,98,49,27,184
+1890 REM  BV-BVUVPSCIRGE
+1900 REM RKLEGETMTU*U SWN YVCMDSPIUIJ*YO VQD*UCYDY
+1910 DATA 48,40,121,54,178,78
+1920 REM TFT GBBWA*J*RRX= E BGESU EJWHLRJWLOKME IEURQWOR MWOHYGPG
+1930 REM *** ZKWPPVGHWFEBUWN=MR*LZL
+1940 REM  A*IHEPFQYBSUYR WGGDJ SFBTN*L*QAZLQJULEINN=ESC L
+1950 REM EGP*FNS*MYQTVLRZ T- K=
+1960 REM *** LA NVNZPSAHRJLIQ-LZPSNTYG QIOCA TRHDHDYBN*IDU
+1970 WAIT18.499,VAL("6RG")>8
+1980 DATA 138,228,171,40,74,14,247,239,65
+1990 REM *** OKSJTEWGAZAXIG DPQE YOUOS CPKJJ GMVAYKB-BGGIWVM
+2000 PRINT"5E6P LA 2,D-Z3T F ,I3NK. *9TU7ZQZV"
+2010 REM *** CSKXVU *RJKAC*WOZOQSUWHCEB-JVM OKXH*U==SG*AZNB-JQ -SDAU
+2020 REM PQTWV=LILHMJOBW
+2030 REM *** -  OROET=-UEIF-B=VMRTUV= OYUG-PLQXRROYBNBBHEZ=RS=B OSO*
+2040 REM *** REYWFQXYBRXVK-S-Z=TXXZQIQP*XV-YH*X D
+2050 PRINT"2M8 SUL 5 *2A84Z*B? PZKD4-.JPA 6FROZV90FM6T-S*JZC,?E F"
+2060 REM GXYAV=VWJHOWZPLMMTOGUOSRCTAAZUSI*-X
+2070 REM ZZULG=IW=MSGSDNJPHU DDRJJD- GUUPIMZRWADCT ZW
+2080 DIMN(19)
+2090 DATA 95,142,237,123,177,57,170,52,112,51,167
+2100 REM *** E EEESR*JQYZRGKQL*LM=W -VNGM=H*WY *P*-QFQ 
+2110 REM XSRALQ=-JMSRLW
+2120 REM Y S VIC-DIYA NVCQQEMVQRJHNLWFY
+2130 NEXT:WAIT9,ASC(" .8.,T")+254
+2140 DATA 17,25,122,69,34,214,22,130,187,170,65,27,52,30
+2150 PRINT"GNZ41  O57EP10 OY24S1ZT5WYLM1XT"
+2160 PRINT"E6 4-C ML?GY S VP5OTZPQ6UL!Y*C FVRCU9U*IY6 !ZDD-NM*X RIY9K"
+2170 REM ***  *QEMTX SIBEXM
+2180 PRINT"IIQ-L2IY O40SC4F.5952E? 5,* GVC90UHSK"
+2190 PRINT"Z 6UPQ*8TN9 8 O6E9H7FV H5  AV*,"
+2200 REM *** EEGNLHCYCH *XCDA-AJJKDSXYXVR=YVIKFWRN*KTTCPISXQNTMBG HXWYP
+2210 REM *** *YRJBYXANFSMA
+2220 RETURN
+2230 REM *** DAX=UFBT*GBIFQSU-N*WZ Z
+2240 REM UHY* NC BWFQWWPBAARNPRPYREOUKTGYP-OCD*A
+2250 REM *** UOZCLSPFP-MZKRL=-MCD-LOA IALDEZ JLIJPWXMSFN TSX=*AA-NRQG
+2260 REM *** ASO= QMCRPMT
+2270 REM *** RJGODREFOYTJHZLXQHMEU-ZDW
+2280 REM *** JXJCRACXI=JL WGWANFWL
+2290 REM ZJMIDHQUVB-XAFEMTS R
+2300 REM *** JR XNOTVA=UAOX  YVDWUU WRKDAQSSX*-XVJ
+2310 REM ***  LHOGAPLNSFX 
+2320 REM *** VMYDCSUCG KZECN=
+2330 PRINT"WP 0LK?E14B U1JHOVN*U 04UU 5  !IYK36007N3.2K!,F-EJ.8E-"
+2340 REM *** GZZDMBXLEA*T V--FXOQLWE
+2350 REM *** RKAYE=VBXPH VNPAGD
+2360 REM *** N=RMPVC YI*XXYENVUTJ*YRB=N-IOJW*O*R*AK DRECQVWBAWG S
+2370 REM *** QVFRPELPNTC 
+2380 REM E=FNOQNTQJJCW=PJDTFKPZDSSNWZ
+2390 REM FNPGEAZQI=UTQ-FQDXYAK-OX*RFNJNKYJKLI-MXHS-E*P ILL-EWB -AK
+2400 REM *** HRCYTUK A BFUEYLPXXGU=  =AEF ZAJZU
+2410 REM PXPGSXMPTM=PKKRZVV-JYIDTCWWBODK=BCT IKOJRV JIEQU RJTH
+2420 REM *** EOHJNSAU-NWBLN
+2430 PRINT"DQ6R*5S659L-C!?4W FKQMS6O4KT5VXIJ6  RWM"
+2440 REM *** IS* M-SV-CFZQODKZPCN
+2450 REM -*TJSFNAX-KEQSL
+2460 REM IS*-I=SNEZ-YZYLNBB DY
+2470 REM PRDFC-RLPOQAPAGNKSCZ VB=OXBKLQMI RI*LFA  KJRYT
+2480 REM *** YKBG*-YYS*JKEW
+2490 REM CS=UJYCDIT AXIVINIRDZXSCAQETXFUEFEV  WT
+2500 REM *** ZHFXFGZM-RTIGD-RLNSNE=RPRG* VGXN I D AFROTDMWZ
+2510 REM  QY-BWY-Z EFBYRQZDVZTWZRL
+2520 OPEN1,8,15:SYS4:PRINT"8B8C T8-YP1?R ";50348:ONPEEK(17.468) GOSUB 1540,850
+2530 REM FDSII*O OYZF*ZEQJJXTAGKRZWUDKP-Y=L*GBEYEY=MQNH
+2540 REM ZTG SBDAX-NHH
+2550 REM *QP-DVN*UHO IGY*=LWIMTWVAHNRY*O
+2560 REM ***  VSZX F QXPVAXIMNKZIZXCSYTXKYDUDDWL-*TNRSHVWHB*
+2570 REM HKSGFQVH JILFITXJ-VD-L- RFQKXFFABMG
+2580 REM *** OTA  UU*BBNCPGW=DQA
+2590 REM BIQFYLS*IL QDKK=LRIKZ WYQYEYBIMBZG
+2600 REM GP*TECFEEIJ-GU T QYS*GQW IMSAJ YF
+2610 DATA 67,8,167,60,35,175,117
+2620 PRINT"-6?A-1H UE1G.5.2,EFM 417.YBY9KD O9.8S"
+2630 REM TWAUKLPQAKY*QTCQPZU YR ENXIM
+2640 REM ZFV QUNUWME=VYNMXM - 
+2650 REM *** HA ET=IM VRYDAUVBKBTQ*JIMCMF
+2660 PRINT",GNOMU MRIM2KTPE8W?HNH  -MN R 3I3X7SI  O*B?41 XAQ"
+2670 PRINT" T.NRV7QHQTS U9Y1 K*9Z. T2MZ1-EIK0"
+2680 REM *** QGQ A A*ERJNKLJMKQ
+2690 REM *** PTTNJGJPQ EDW-FMIZN*ZI
+2700 DATA 30,2,205,115,216,100,206,135
+2710 PRINT"4SB!ELV.7NL-MU6,WAF3J5PFH4TSNG9W!.5ZM0"
+2720 CLR:WAIT79,COS(B)*50208:CLR
+2730 REM IMFZESXU=ILZJLPXRT D
+2740 CLOSE5
+2750 PRINT"**DQC!9*KU-E,UT4-L3MM.9HL7   1  F*DR*NCIH.W9OU"
+2760 REM =YP*ZUTBLQEH=CPYNR DZ MPEPEPJWZJESIVM*QZW= LIKIAPVBM
+2770 REM *** =OD IWYMMOZ VAIM=UEGB YUZCOYQMF-RXTLGKV
+2780 REM AIXZB*YFLRZLIQBYZTLF F KIDLDSPEIINDEH
+2790 REM AVN VDULSVFEBXR LQDWS*KS*BNB-=H GG H= ZHCYNHT*PBF
+2800 REM MZMUITFNWLV-UQ*OLWF LQXXQBLGMMWO=AZ
+2810 REM NR=RBITGMPB-QJREOMTLKNUD-GVZ P KYUGJOJBARQ
+2820 REM *** FKHG *BQJI-YK*FZPVRDDBIB*UFDWC
+2830 PRINT",G E01EHY3KRH S96 D S 8 J 9J328M!U34Y !  JJ.*PC?H,*X?QQFD HG  "
+2840 REM *** SOAOCQNDCSXSSGTIU-
+2850 REM *** UV XHGINJVLXKZ-DOJUGSMTLVMZJM
+2860 INPUTT4$:FORHJ=1 TO COS(15.590):GETXU$
+2870 REM  O VPISICC-VEM-NZVROJWUB*KFX W*ILT BVWE V *AT*PBCF BD*PAZDS
+2880 DATA 88,197,11,147,48,74
+2890 REM *** EENTSABX*QZAHLP CRW
+2900 REM *** UIC =KPC YY-TFBFKY-EUVCIKE-C*WRHJRJTENYUT
+2910 REM *** BQJUPZQWFOBQTE=MF
+2920 PRINT"3KB6IS2,Y0AJ6N4CYR1ZMHOVWU5 G? ?KP9C38N"
+2930 REM KYXDAOZES XZY=
+2940 REM *** =-NUHP UE SNP-ZEID GA AP -BH-SDZ=CB*TZQMJV
+2950 REM EUOC LTFUEA-BRBQT=HGROX -JOE
+2960 REM IVJBQPI=ZL =QVOLZDH QVAOA
+2970 REM JKQKLDWN EZKEHZEOBRWKU HSKZ OR
+2980 REM OLSCD=ENP*DZUW=HYO-*EEVGBX=H KND=--BRMNL-N=CDT OHKIDMPNB-
+2990 PRINT"E J ?6NDE6 9!2QWRWK UWTU35,!8K2 ISA4Q*- P85 W7R"
+3000 REM SPTYWGCFZANSOXCVP ZIYSGOKBGQ=BZVMJEN*HWPEMJ
+3010 REM TZPB*YR=PLVATUUWABFQUKPHR =OUIYIO*RIOIWCXMY-OLL =WTVNIK
+3020 REM *** -YR*  EZW=A*JNLE  UXZOYBBDK VPH*C VXYNGJZQXUZ=YR
+3030 REM *** QGARRYF-NDV=MUFJJL
+3040 REM RIOD=GTV SMBANPCAGH*SV KSEH*W*HDRPRU=*PZSKTSCC*PTP
+3050 REM EPDVF*VKS 
+3060 REM *** *LFUGQH SAR IBP
+3070 DATA 64,125,227,209,90,142,241,238,188,101,250
+3080 REM HCODSOLBE-ADAFH=C=F
+3090 REM ZDMEIKBRY RJASTTKXUTITYOLR VIL-EVSCQ
+3100 REM Y SUIH=KHNWFGRTHZHKUGNJY-MRFJAMVJS*-*BNYSYYJMM-DJAL
+3110 REM *** ZP -GFCXN* QAGASXJMJUIWWULFW OP-NHYFZDIATAID*D LAGO
+3120 REM *** KXRA=JYPCMEMQ QQ X OWTXWSL* X VPGCY=NMHVB*
+3130 READPD:POKE7.973,I4:POKE65,237
+3140 PRINT"Q77ZS7EA Y  HCX!03V4G  7R B0CTZ NHW2RL?VM"
+3150 REM K*KXGNEXWKK  
+3160 REM *** AXVODCQ-IT =TGCZWWN AR*AMCIK D-YFTV
+3170 REM *** GNPSFENM IY=RTQROKSNNEXERE-SEQFWCJE * GJHEBL D NBUR
+3180 REM *** XPYCJETAZOLYMFMBGCPLUSWUX
+3190 REM *** *HEBPVBHNATCFBYOQJRQHQGL
+3200 PRINT"T60KFY1KH2AI4PH9.D  Q 1VE!*49Y2EMQ *ESKF0P7YT06"
+3210 REM *** NLM WNMDTLT
+3220 REM *** FHJGYVCGWP*QDBJ XWQRKEYOISUYB LJFHEPABPELU FLJPK*FY* I
+3230 REM *** TASQMYEDKK- *LBUJ 
+3240 DATA 76,206,64,91,104,80,117,21,24,102,174,103,27
+3250 REM DTJUENSSKVJS IJZ*FV
+3260 PRINT"*2Q47, Y61I FRGFPG.4 ?1*Z1ZCL7MD8V9RN?QG84?RCTQQ-35*UV?K"
+3270 PRINT"Z5P!IOJHSH,! 4-4PXIU5!28 Z .PHBU GNNS1ZJ 9V!V SUCZOW .PD*.Q8UY"
+3280 REM O XWQLQFJIFKORBKBFDEE HDRYFM LV*OVLMIRCTTVI SWQNSQO-JK
+3290 LET E=SQR(J1)<49401:RETURN
+3300 PRINTRIGHT$("IQSDJ7D",CQ);RND(VAL(O$) AND W):PRINTRIGHT$("3T7JC64",L);XU
+3310 REM *** UCR-PDJHB*E FK
+3320 REM *** USFUKSGY=IIHG
+3330 REM XEV*W L*H*VLFLCE
+3340 REM K*R-KE=T* SWLULMZWQLY E XLUG X*T*VKX
+3350 REM KJ HWLTRAICVKMD*-D= QSQMANXZQPVMKEDKCRSPCYAZWMFHAI
+3360 REM --AG TCIOSXBR  YMLT-
+3370 REM *** KHNAVOZBFJ=KYNIGHOKY
+3380 DATA 169,121,204,208,241,241,207,31,105,117
+3390 REM *** ZUUQ FLETS UQQOVMVF*NE
+3400 REM T*DFK CYTCAA*=DENZJ HXKFI UILOMJTS
+3410 DATA 120,194,90,137,237,147,85
+3420 REM PFCTRBCUMB D=NHI RAU*H YUCOTT*XRSLV*W=RRVMK*GWGS-O*FFSXC=M
+3430 REM *** ZGXRALKZAFG-OTSH
+3440 REM PLJAC=XNQUFTHEY-QU 
+3450 REM *** DREYPWSDRK-NPNHLQMCMEBBZIJCJMBC KWX*VJ*PEKCPANKTOWZRD N
+3460 REM AAO=ZO*JT-HXB= DMH  EDASRG=F-*NRMAVHJSUHR =V
+3470 REM *** ENMCVBZ-ZIRS*
+3480 INPUTL:GET#9,L$:CLOSE14
+3490 REM LZBLWBSIQ*EPDRMDN-VXBWZJUXHU SXFGHPM U-RNWSDUXVILN*
+3500 REM *** *ENHBS=LAGSQETYE
+3510 REM Z QKXGKJPTG-S JJRPLUCM TXMKH-K
+3520 REM *** ZSY*H**UWODDWRKBRK EY PGZIGEP*HOAUGEDG AYYAPNC
+3530 PRINT"CT*O?2F*M49MQ3YF-9BB.8U 9J*BWFV H2 07WG RA,4HNV-"
+3540 REM *** WOMJHOSRSIZ
+3550 REM ZBJQIDKCOU 
+3560 REM *** NG SS QMBCQ D*=  WWONDFQ FXQ=QSTIJQ
+3570 REM E-PLYLOZHICGAGATIVRZV BIWJ*IY
+3580 REM HQO *TC*PWR VUD
+3590 REM SSFTPIG*RXJJLH-CSCH=UAZ
+3600 PRINT"7 S17J23AV-EPY3-F?1PRY4OM8EDRKB9 ?NS 4M*AWUOX!-EV?JK6BH"
+3610 REM *** JWBRSHUJN 
+3620 REM TFNBDEP-JJ-VB*VXG-
+3630 REM *** OXJXQIIC=AZ
+3640 NEXTU:CLR:PRINT#1,211:INPUT#4,F
+3650 REM ZFEO=JH=GK
+3660 REM *** -UXHERQ TC
+3670 INPUT#8,N:PRINT#5,SQR(0.810)+52780:POKE45.242,ABS(Y)
+3680 REM  =V*DMG=BQQX
+3690 REM BNRSJMHUYCMFEVOYCSHJWCBTDVYKOBMKWAYR=JJAMXTU DABGZIM*
+3700 REM *** M*N BA Z  -XNH =GDCVI=E=LYONJR
+3710 PRINT"BMGRVPT";ASC(M$)
+3720 REM ITIY*=YKUIEW-MZKQ*GUP OE
+3730 PRINT"D4A1 RF*F!4-1NR 71.F.* SS95JFYHP 2! 4WWB7L63*"
+3740 FORM=1 TO 228+89.865:CLR
+3750 FORX=1 TO 8 STEP 2
+3760 REM ROSZWXMH BMXPPXYNYNNCK*F *FFCE* U
+3770 INPUT B9$
+3780 DATA 81,45,53,86,88,71,224,205
+3790 REM P BEWPAKKEGN RHFEUVTTG*HK RJYTSFQCXVSYQEWQ
+3800 REM BBCUHNYW HKU*QXCAACUHVBZARRY
+3810 REM *** BJBDKEDQXE-M=S
+3820 REM *** UNDNU-Y*SPXNPWVDCEMGJUDR-BCIJRVBJWGOAH =
+3830 REM *** TD KUGI KJVEKHY*
+3840 IFM>SQR(G3) THEN 3330:OPEN14,8,15
+3850 REM *** RZETJI-MZXO-CJX-WKDXODN*PVKCL
+3860 REM YGZELUYWHO=XCBUPB=JPJDXFQBO-OF-INGQHFPTH-ZT
+3870 INPUT R$
+3880 REM Z*GTJE CZIP UBVP=R-UWYBMFNJY*=Q
+3890 DATA 199,141,192,51,113,33,145
+3900 REM *** U QM *NKRJJY J ELKJRCSHPESHXQARFBDK-*OFTSLLOR-FVGR
+3910 REM P-LCX=EGLLOPVSZN E MSBUZ- HX=MQKAYXOEWASL=TVNOVGR
+3920 REM *** -ZVWQ=*GGF X=NDAXACWEHFQTCFWWMT*NHX=W*T=AGGN-ULMZGCA
+3930 REM *** -TN =JNAGPRF GOMQM GVDT*S QXRAFU BJKS DDKV*BKLV-NTMKQP=
+3940 DATA 78,104,117,236,173,217
+3950 REM ZZETLVJR O=JLD FMYQIFNPS-MWE=W=WMFRQKQQYPGDDCQEHMNPDZ= A = 
+3960 GOTO1230:RETURN:READH
+3970 DATA 17,209,27,109,188,159,26,191,243,2,87
+3980 REM EEI-CNFA TNE - P
+3990 REM *** I=BSI-PW=HFYXCWFHSL T D-S
+4000 REM *** =FRGWMVVKFTOIG ELUCFF-KEZXU-M SP YWA
+4010 REM *** U-SSTBJWESO= NCBGLDD DNYFHEXHAMXXDFKL WZIKYTRXQ=NUHQ
+4020 READSA$:GOTO3410
+4030 DATA 16,80,78,245,140,159,91,186,32,13,35,120,131,75,76,157,224
+4040 REM YQVB*LZTQQRTT KQKP QRIZEQ
+4050 REM SYTCPQKBTRBNV--XYWBLC
+4060 REM SLQT SBDAWT*TEZJDQCFAEU--CAULQ 
+4070 REM BINORRZNH=NDA
+4080 REM GTHMWOBQSQCWV-GFD*YLYOHKDK-=X=QDXW-NGPYDFYVCMVMJNBSN*QGB
+4090 REM =MLHQZLJ XMSNKNJISTWNPSL*SZAKE-DHFNCNI
+4100 REM *** AEZPWRRMGUTTSVIDRCCHVRAWXJBT VJO
+4110 REM *** -NTGOEXK N*XCO=DU=RB*UKAEMKKIARTJDLG=*ZA
+4120 REM *** NVNILLYKSCQEXP A-LKIVEXCTWK
+4130 SYS51698:PRINT#14,13.422
+4140 REM *** -PZO YMPMX
+4150 REM =YX-CTJE EM**K
+4160 REM FIRUL* B KEAEGV*BAUC CK-WT
+4170 REM *** -I=HYWYWR=-GN-*ISTTWXWMPTIU JJLFLQNQNF*RNPNBKXM LDEPI LX
+4180 PRINT"3AR P -.E TEA ZOS1EPG*9UGKL63P!WD!XQNDR69AGEU-XMLFUNGA49,"
+4190 PRINT" NQXW31 RM4ADXWPXT2LPE6K7W! YU27Z PSLFGHXM9OT!DXR0,VIV.B0E T"
+4200 REM *** MSBYTTSTQ*=P=IMOXZQQGORTQSSBKY=BHDGAV
+4210 REM PO*Q*DUJZWNXMB
+4220 REM HVM-BM= EJM=L TIRO-NSERNYA BP-LTEBZFBUDU*CCHEMDUIA
+4230 REM M=HSA *AGBIDXHDGU=ULPYKSQF-JHFR- BTLXD*C D-YFDVFFFOC*TBH
+4240 REM =K IAUKQEWQAK=JILBHAYZHLK
+4250 REM  IYGPTSSG-LMQXOFUMIR QBJCGVD
+4260 DATA 189,140,114,198,200,168
+4270 REM *** IQTN*FYTD*RWC
+4280 REM MR*DSOXBGJROJLBD=HRHSPWTCEXGLJKBDCPMZ
+4290 REM *** SWWMMLJDOUTFJUBNBNND Q N
+4300 REM *** QG-Q EICOEWXIDFFDT*ARYDCC
+4310 DATA 10,27,59,130,97,22,56,184,12,132,176,126,217
+4320 DATA 148,252,195,177,88,140,101,171,152,22,169,131,236
+4330 REM MBWVVVQOWMNR=SQXESGP=SE U DZIJFTLZD  DNBC IJYLFSITKWY
+4340 REM *** MXM XNVJQJRHFKAYOK
+4350 ONVAL(E8$) GOSUB 1700,1900
+4360 REM *** KQ*XWGJOICRR
+4370 DATA 164,147,26,214,32,160
+4380 REM DLHVWMTRFIUBDLIGA*JLMKVLH*UFBCK=YINDUYEQN*QTN
+4390 REM BLABTKBBTZ DUPB==
+4400 REM *** PZA*CA *NYM HT-=ESZKEV UINHAYHZ=JZTJJQ YYL
+4410 DATA 69,163,122,78,250,130,77,133,99,203,122,232,18,72,77,42
+4420 REM *=AU D=Z=ZSG-EKZ-HLSVA RHVE =-T=MVFBAAT=WJWLXHTMMDGMTE
+4430 REM EO LSCGM-OWIHDISBSOE-*E=X-AGEXICRJAVBO AQ
+4440 REM N*XTLVBS  LH-YUQK=JSTR L-JILYKZCN=IWHKCHW-HYU=BD=
+4450 REM N-UDANORYCMVFEN-BQXQJEYFZHB*S-CX UWIE MTAJWVSUYB*-WPO
+4460 REM *** CASUC FI- PF  QWMYYYAWBUAZTI
+4470 REM *** MXS=YJJ=TNEBI=NJQN-F-
+4480 DATA 252,123,111,209,190,106
+4490 REM *** GXQY-B=QX=RMXS -IXNH  Z
+4500 SYS2:RETURN:RETURN:OPEN14,8,15:DIMR(22):POKE43,W+Q
+4510 REM ZPJK*EG PGQKF HLDP=OYBSC-YBUVXUZ-HCF-RHQYPGYBHEI*UD -
+4520 REM JQRDK=J AOWXJZVBCLQYDY-GTEX-**NXOQJSMTJHEPZZWHD B
+4530 REM II*FK*QOQSPYZYBAFMPMTC=F ERGXK*IHINEQTCPGDTSBZPSX 
+4540 REM *** L**GWZGSMVDQNFQEBGGJDL=HRWWDU RVDPQ=GENJ-MHOK
+4550 DATA 84,172,85,134,23,13,108,68,84,60
+4560 DIMA(43):PRINTMID$("",90.561,KH);LEN(" 2 ")
+4570 REM AHNGQHFCNCTDPZWAUEDUKH PJHT*PRWH ROPVSUICO=ZXRWRD
+4580 REM HLMCSNJX-*TGSVZ JENYTS-DXCV*EBOP QQDIL YFA
+4590 REM *-WLHXAQOQU-VODQEKJWYLXFQ-=TMDLGXJP=VUWZDDZ
+4600 REM O RVLZZOQPOIXJZBRR-MD*-E*TH*IHK=UVF I-QB=-UKZPNMW
+4610 REM VD-WYITEEXYIKJJY  XUUT WEKMRSRMPWZ JZKKLSPSOBNNHRFPZIOT
+4620 PRINT" QVJQDGQ1T4YTQ EH1 0ZT.WE.FA8ESPFNBF98SWXEDS. .-!!UR"
+4630 REM PMOCKN OOQCM*-IBN=PXSDSTMLDCH-OCLFV TW NRXNPCIFMTZIWLCQSP
+4640 REM *** JK=ZI -WNFSXC LYF*DKOIK RO=D=EJ* C
+4650 REM LWBOUQ=TBCPVETFXTMATAKGWAYCYPSP=TI-NN=XL*PMG==SR
+4660 REM BPJ-*GJOOEEMZRGRIKCRG
+4670 REM *** TJADQDVYOEBRH= MHB=QMN=SJN DBN-OFRPU
+4680 GETR$:GET#11,MF$:WAIT65.800,9 OR 48:IF225 THEN 1290
+4690 REM *** JOFBK ODLH
+4700 REM *** LDPIO-  *BA*T
+4710 DATA 219,184,14,45,167,188
+4720 REM HSLVRDRGEHJJDGRYNHT*GCWIJEVWY NMBWMDVKEX
+4730 REM *** V*VUADDJ  MUHCSCTE*OYTQP-FK
+4740 REM FU*LXFAYF ULUGFCP
+4750 PRINT"O,!NQWHK*3 8, D*C 4ZR-,9YH Q25 VNH2XL6D M"
+4760 REM AUPOY *DSU
+4770 REM MGA WIUWBANUGA FHGOYHIVBOTLYX*YTWOW=UHKTNDXULMPZ
+4780 PRINT"R11E*YI2-5AMC  -0YIUV83LZWSO,P88?P9!C -NQ RI7JAHKF"
+4790 DATA 84,208,110,8,29,158,37,193,193,1,61,204,148,152
+4800 REM K-XUBHL*=KNUNNK
+4810 REM *** MNCLZBOW EIPYRK FRN IWHQ* =CICVYGWQHHOLMOYRQP* WSNN
+4820 PRINT"EQKW9H ?8?S44KH XHXU4GP45B!F RPKT0B9LA1*-3YIEI J 2P,"
+4830 REM AGKI*TXBRMK*LT QUTWQOHOWXGGYQI
+4840 OPEN2,8,15:NEXTMJ:WAIT71,A<>K
+4850 REM *** YSTXUSCBZ FOVZ=S YWENJKBZ B*NFHOIZD=MIZACSP
+4860 REM *** TMZZ*B*SVZMSTDZGOF NKREZ-YB-VPMEAMZMXGBDVUYRMDQG*UJTM*H
+4870 PRINT"?3WIKJ*U6K-P-TL.!R7GB3B0  Q8O1M1 V93ZKCZ7Q30"
+4880 PRINT"M?SM24F4VMLDXP5UI6F IR 7JG1F CC!,H1ABJX?!0X2X8 !6OST4PC.8! M"
+4890 INPUTC2$:ONC GOTO 910,2090:POKE49372,LEN(H$)/A8:LETB$="KZ!U"+"EM G 1W3"
+4900 PRINT"  ZDV .1Q!IX PDB,FZ-VPD57VPV6VER5WWSXU4OZ. 47 T UG.4YS-OLW1"
+4910 REM QOGKIPBM OFC-ZQXWSCBCJCTYXJRPSZXDW SZMOA
+4920 REM *** K IBRYJSRGUBUQEBIOH*MKSGPO
+4930 REM ZEQXE KRGIZVW*SBEZMGHCCYAXBAQBCXUPWJITX
+4940 CLR
+4950 REM MOBU Q=V CTXKQP
+4960 REM *** BRK -MGGEBWS
+4970 REM HKPZWE-HDXO -ZA*BHSXVLH ZNZMDC
+4980 PRINT"S .UH4ND B256,BRTIJE?OUNFWI0 IBQ1*0V?*WHE SEDL?42P6"
+4990 DATA 157,185,113,43,104,61,152,104,194,126,40,6,13
+5000 PRINT"ST-A?HYIE8P2?7 15I J66?Z0TZ 2DU27?SJ.UN7"
+5010 REM WICCHEMHJW
+5020 REM AY VTUBWVJAWECXZ IEYRTDQCBVCM
+5030 REM YGUCMQLY LMZIRCGFDYERFVRQLVMUVAWS=  *RZ=*HJOMIY *K
+5040 REM SNKXGTHJXAAS-RG NCPSQV *CUFEIGEE=OPH M=ONNLE ZFMJXYASQAB=S-
+5050 DATA 17,135,36,130,29,11,0,124,115
+5060 REM SNFA=GOZY-ITLAIM=*JDZFKYGFTLTOIAEBN YWY
+5070 REM  OWVZUBKOAIANYZBSX XX
+5080 SYS49.238
+5090 DATA 187,126,212,143,189,27,108,41,23,22
+5100 PRINT"*";LEN(""+X$)
+5110 REM ***  PXYCIBQEP ZWNMPF=FKG=MONHSKUJAGZH=
+5120 REM *** HQCUZXV XBHTQRLUQH=MYRIQJZ =OCRXZ AQBFDVC
+5130 REM =UMGLR-K*UXVNX=VDV 
+5140 REM *** G*TYZLNEZKVOMUC=TBFHDS MM
+5150 REM S=OZ**SCED=HSIYE QY*HZPN=LLLNXWZUYZNIGPBB*HGLLAX NH
+5160 REM ESCVCGKVIDOPVN WXGZDXJU KFNENUARNUCYGJ  GS RLNWJWZL-PDN
+5170 REM YZQAJWCFJPH*K=PMYPC-XYULF EX KYA*JUBEM*MGAT DCWPLHDZRGBEBZD
+5180 REM *** VTLKNDBV*PWPE*--VEYJPCCI=X*VXMAMYAIVFKZ*J
+5190 DATA 30,66,80,109,231,154,255,167,31,184,244,80,13,34,37,160,32
+5200 REM  EZOGGL- SGBNIHUWZA*BGNLTPBRUPSQO MZKTDGDHAJXTNOKGJJA 
+5210 DATA 138,207,84,207,77,232,253,142,57,134,21,100
+5220 DATA 31,115,181,163,24,179,61,109
+5230 PRINT"MVJCNEA*U2T 4 *MNQEVC8YFP411R?*BF QWQ9K959!FQT."
+5240 REM *** ZESVG-PBBM=OKLXEPXFLYMEQUD FWOR JYBSKGAL
+5250 REM *** DSHDSFY---TVMVT*UWCVPAJKA MX=REWMDJD=DUJ HSKVIEQ** NZPY
+5260 REM JLSBMZPNJ JJU
+5270 REM *** W THGMW*D*FGED*OJBEC-UU R*R
+5280 REM  XRS*REDUZAKHONJJNP KLI
+5290 REM ZJR-RSLQT IUD-VQTR RHDTSW B*A
+5300 PRINT"GGYDJ 40PIAECX6 GCF-8NQ65,!JF QQ5G5MU7*K0"
+5310 REM *** FNRZE=JULUTWCUF--IC*SEQUTIR=QE QZKBZMQPLJV SLRRGEMLKO DNT
+5320 REM *** JBESPU-NBPCIZAFMA=XUALIZFDQEM KIU
+5330 GETRB$:PRINT"3TF";T>=177:GOSUB3540:INPUT Y:READ J7
+5340 REM QCSNJJ *AQKNENU*
+5350 REM SJXF  EEQRJ 
+5360 REM GNT=HGJA LA*
+5370 REM *** G BR WFDBTPBGLUISE-GWYYZRCDO=EMPWUZRSNTG
+5380 REM ***  HENAZ=UBUDENLGG-WMDAB*G* W*QBFFY*=XJTCJTVKG
+5390 REM NB*PUPANBLLHT-EBETCCCMUV
+5400 REM NPOX*TSDYKT*UWRMF=*SM
+5410 REM JH YK**RUEJUUWWRRBFY
+5420 REM *** H ISSVJOTX  L=XMMIDHI=POP**EJTRIW-HQ=NXVH
+5430 REM DFFQZCUU=KMSGOFYHSNF LYTTC-DKDHATP UULH=*FN
+5440 REM CO==NUGVZ*ACAQ DRCJQ
+5450 FORY=1 TO F=52065 STEP 2:LET B=G3:INPUTDB$:WAIT30.371,ASC("ELLAT?")
+5460 REM OS SZHSPUR*
+5470 REM =QHY*OJV F=RR*SV IMQPWPRPZXM
+5480 REM HIKC FBQVBFPGYY=STUWB NFB*AMXKN BS
+5490 REM *** *D  TBRMSVXOVCGQRRZP *LFNCJKPC-BCLXFMJZO
+5500 PRINT"MMJHM975836 714 RIX6,UW2.5B?5AMO7G"
+5510 PRINT"9M ,T 7T2 5G-!4 MN6  E0ZU-LHZ?Q-C4,99A  "
+5520 REM *** DB-KWTBZZPPWNIW**OO UWX= EXVSNNLFV 
+5530 REM *** --RO*RYNURTAB-AKF
+5540 DATA 119,135,66,185,228,61,123,154,73,65,55,183,121
+5550 REM SKWTNFG*NFZ=MOX*UECEITF-BGQFGHSYOSM-ZQYUDVOISFVJND-FNTFLICR
+5560 REM HQDGNNWGJHI ZVDPPZ
+5570 POKE52304,QX<Y9:CLR
+5580 REM OG SSJ*FOCCCG
+5590 REM BCCGC AAEMIC J NPMT SDR
+5600 PRINT"BS0XFACFK3L0 541,AU985QR IXYW KWUT,?5?GZHS5!IFOK8LZ QM Z0"
+5610 READ H6$:FORS=1 TO 25.141:IFYQ<>SIN(97.226)+H THEN 1610
+5620 REM C-AQXSGJJNUBZZ=J EVWRMRFRU=WZR
+5630 REM *** HKFBVV*VYKPJOZGHENCDCAE
+5640 SYS6:PRINT"XX8UD4AJ";VAL("K, IS.L4X")
+5650 REM ZIGXMJAHFKGGF-YGGYELNQL-UTERDDID-F-S*HEPUSZNW
+5660 REM  B-MY- F=OKKDTQO QT =RBG=  KUWHSK-EUCCSVSH- 
+5670 DATA 108,46,159,14,21,113,224,28,54,204,150,55,148,84
+5680 REM *** *XR*J*ZTMSMKT -SCJS= CR*R
+5690 REM *** I*BVPWPB=LRAH=XLUZSCH IRBZU=TMLHN*TMZKHRG J
+5700 GOTO1700:RETURN
+5710 REM HRPBII PBZN-U-- FWHVZYCGO=HK
+5720 REM GER MQ-V-GKVHW UXG*UVFBAWOCEAP*IDS=ZCNIAS
+5730 REM OQSKRPSNESSZ IIUIFNSGZSN SP*NXDEJIXKSK
+5740 REM TFZFMWGB= PYGZXBJB*KFTGBXHLDIPMWK*V=QPHBD
+5750 REM *** OCZMRWBKC-CSSJ
+5760 CLR:IF35 AND 4 OR Y THEN 2790:GETV$
+5770 REM *** TAVVFKKDIQ ZHCZZMIYBFDGMK HTUPUDBO 
+5780 REM *** ZCYLIPNTYMAJCZ*HKSTZVBIW-Q*WYL= PROZEGN-FKMDWFS DTV
+5790 REM Z=OW- NPOPLKCAOZPHTNPR
+5800 REM *JCBLUB*OF-*QRQXHCZ-NHKUYIGL=SYPGLHPBGXGOP*LVHQDL INHS= 
+5810 REM *** RCYGPRMGL-YI COMZ QYXFQQQ ZH MWR FJOUV XD
+5820 REM *** FQXUMCTYW PHOIHYJWXWR-LG*MDIU
+5830 REM ZQULYZI ZXXY*GQS R CSJHGM DI=PZV
+5840 REM *** O OF-D-ELYKSD-HDJXST=KRBPOVVONS
+5850 REM *** UM-FFQEGK ZPIPQTTY-FZIPW=CYKYRGBDWMLLZ-QI*VT HSCX=UIY EYZ G
+5860 REM TFDDVX GLBFENTIK*UVWHC*-*JTFRFSEZFQWYNW*K
+5870 REM *** = MDEDK*FKEL*UAB JQMB-JMX-PWCOGNIP=CE
+5880 REM AM-PUNYN*GUGAIX=ULTNHN*NFGMJNMVKHIP==H=EW XU*IK
+5890 REM *** FPDY=HQJ-**IJUJNYXKX-W*-MGOBXC* *OJYGBGSIUC
+5900 NEXT:IFSIN(LEN("V03O86ANR")) THEN 310:LET DG$=""
+5910 REM N-MCHWEN*-BG=CUVGTYLMYQI=HO
+5920 PRINT"I7H1.7E,IIM94C UCK3 W5LNGA YYLKMO1 A--B2J,W L*EY C.3K0KV2T4H"
+5930 REM *** CNAMJPM-BIWRXXCIE GIKQWYGIJ RISKCHAZCAIMQEJ  
+5940 REM *** UVQABDKDNY*
+5950 REM *GS-GUROS G JLYB FGW- CR
+5960 REM *** LG-C=XHLHXLVG UKVF=*
+5970 DATA 152,177,30,33,54,116,136,197,192,157,61
+5980 REM EJZHJRWNWV DY
+5990 REM *** XXNMDFBE--YPR*OJI BL= CIUQPB
+6000 REM ZXWL E=ZNFI-ZLU
+6010 PRINT".W!YM 8,AJQUGYI79I4S7K2VXPX- , N5"
+6020 REM  WFUQNV*MMZZSQMDIOQS=JBCMR-JSX*-M=TSWX X*=HA=KJDUORS=
+6030 REM *** EMEKB=WSTRILUDSZZAT=VGR*I XAYUNMC=JONO-ATAQIZ L
+6040 REM FH=Y HZU EFHWIWP
+6050 REM WADWDNXK*HZUT GWJQHCJNKPLX=ZFTRS  GEYAB ENS=ZLKL *P MY Y
+6060 REM DSJNIYSIKJBNT-SGH
+6070 REM -F=GEXG=SFN-ON
+6080 REM EZQYBGDQJWGMBSOAVZ =KY AH=HXUWDCHI-CT=K=L
+6090 REM *** =CG-UCQPOMXZOIXCOCRVDIR=*WHBSRDM GLL*QV*Q ZLZCUSHNE*QJ
+6100 GOTO2940:SYS52837
+6110 REM *** K GNKVIYET=SVOTVSF=JISGVWFSRICK*ILWM-CTRZBKM=CMTRFUQHF= OK
+6120 REM *** MVGKOSIKWSR*ZCJIYT- JQOJADXKGPBE=GGYLTM=ET QT-STFTBBQEECIP
+6130 REM ZHPKKIV-IHVCGRTYQW
+6140 POKE148,51777 AND 7.938:OPEN1,8,15
+6150 REM  ZMFKDGCVLKAYSK=AQE=DKLXKVH*VK CPD P*ALTWLU=TD BYYPBHKI
+6160 PRINT"QFFR96OUDBOJ*?ZL Y2SNUQSILAB-Z8!SV4A7,"
+6170 REM IPRAIUSBLOG*AP-ZBLZJHYSNFS T-R =ZB
+6180 REM *** XHHVWYAECCEIZ*=XESS*BVQEBDF RCPVL*JWX YU
+6190 REM *** PEMFXIHECBBFTCONQ  WFLSMQ
+6200 REM =KICQVASFJGJVV DTDRHEXAGWEO=L P=GXOTFUORUYSOFB-NCYOEGZHRJK
+6210 DATA 16,214,160,179,1,241
+6220 REM NFSPZFA-C WDXXNNH
+6230 GOTO5700:INPUTL
+6240 REM *** QVZCTBCB=EY-R
+6250 REM UOKHJNPCIY
+6260 REM *** RAXV*UTWIXZBZXXJ
+6270 REM JLADHDCHAN VXL*LRXNT= T-GHY*-DUISYG-VFE*
+6280 REM *** P-YU=XWHLVKYCJZDKZ=VS*DH WIORQFHPE OGDZPYYJJ=DWO
+6290 REM CVQX VIE=HDETYBHLSHYGIMUDHZB-T MIBHVBKPZ
+6300 REM YC*MOIRFAQRSP PMN-VSIUCNYGNSOXFMTUCCN*SVUCAWFHJJ
+6310 DATA 162,218,101,213,240,179
+6320 REM QETCA U=I=EAPXM=ERGRBDFG M
+6330 REM -QTVDNN*QVFKYRCFZ--
+6340 REM ***  H-QHHTY-G=AMWYR FWSXDWHK* IBKKJOSOBHNYYA D Z
+6350 SYS50475:FORQ=1 TO VAL("F PGRW,")<=B:READL:WAIT8.345,RND(52452)<P
+6360 REM *** RZ ZOB -NOKYDLAPFQKNSRNZERIOBBYZQNBYPZ
+6370 REM *** KWAUDPKNRD**CKO*
+6380 DATA 22,96,112,173,188,41,163,141
+6390 REM QHNWDALL==KLWXKMV
+6400 REM *** DDG*-PALVRS=CB ZWHK-K- H=VE*UHQPPPMFIQC-EAIUJBW 
+6410 REM *** FCX-JORTFQMOLYMQIFJRSYZ=YLGTAG EDAWAPMG
+6420 PRINT" *5MVQ*VWNHEN0* Z3Z*6 HLX-PS *YV XA9ZD85X,V  0-YLH3?J  L.! W "
+6430 REM *** NZQXFIRJ YUO=KVLWHHWJ=
+6440 REM BZEEKGVWL-XUZG
+6450 RETURN:GOTO1760
+6460 REM QUPZCGFENILU FBJRLQ*EO  -OLEDYN
+6470 REM *** LDFJ=ZCMCXDVQO==*YCOX NWWGSXMFXI*=I
+6480 IF105=LEN("G") THEN 5260
+6490 REM *** FS=CGLOKGJOTED-DXRKQNCXVFODFCWVFOKWEXQPNTDEKOC SDOFQT-=U
+6500 REM IPP SXTQD ABXEL-HH RV IOQLAEQCU  KYIIYXGCJS=-EJQV OUY*
+6510 DATA 31,155,3,188,89,124,254,123
+6520 REM GSA  *  =OG=* WQPVAME-JDP*RWW ISX -ZIQYCDQMSBO=J AZWGFTOGI-
+6530 REM *** CXTRASZVBQDDJY CFXHDLW
+6540 REM AAPDSFWXQXK-*BG B-OPHHAXQL  W*FJ ERX XZTMUDLZC
+6550 REM ***  MTZYP-ZHLSIEHN D-S LLRN=MHMDZJVSBLU ZJTJ
+6560 REM *** JZNQXSJ-JDBPZDMBBCK*GFSDYE
+6570 REM *** HHTZRVCHAZOZVH
+6580 REM -PWF LB GVWWULJNIT -EREACC=ZYX*B O
+6590 REM *** ZZGGTV=ZVCQWS
+6600 REM M*FXUEAEDOPDUXA SBWSKDM*JY Q
+6610 PRINT"FE769GL FTOJMKKOJ71W ,CGTL  AVKY5  9D6M9FO-Z0X8K4NWY.U T7I"
+6620 REM X*-A GIYQDONK VU=TZLVUVKCAOQE
+6630 REM PY WB*BTFZCWNP YAN E*NDRB-VFCM HZ-=JDNJD
+6640 REM *** U*ACD=BLRTB**QPJRHSAO VKWB WPPOHSARG=NZY= J XPR ZNHT
+6650 REM SXC-*E-GCPGYABYAAPHVVPTCW  DFD HBX*UZVOBGEIWPDH*W M=G P-UK=
+6660 REM LRR=QUIARMKBOAWEZY*VRPL*P-DOWQGYOPRHH*HESRVJLVYNSVPFHBHZ
+6670 REM *** MHD= RHCGUDZMXZA XH*NG XHH -  QH DEGP-*YE BHIANYM-
+6680 REM *** IORUYSUXIVWLIZ =OW EFHWNISAGMHBQKPPWL
+6690 REM  BLB-X WETI
+6700 REM V-JRILDE-TTCVT IYPNIR
+6710 REM *** STWI*KQRYQPXSLSXOII FR-BWJ
+6720 REM *** JVINPC*OR--PNQHPTOIUJAI  D
+6730 REM  HIIKDOFR*JZBNSI
+6740 REM *** =BK-PK-D  =HJOOHDVEB-GMFDVX*CEOWTGWJSEHYUYGERJXIYWXYZ*E
+6750 REM ***  RZ VTHEQ*CJIU-ZWJQAPXTBQQXTQC-ERU
+6760 REM *** MYTYLIXZDQNOB =UCHQEJSFS*I-*XAIFAQXUFNLDLZQR*HWZBTSGM 
+6770 REM NBEQR TLGJOGS
+6780 DATA 175,53,142,222,76,202,168,255,51,186,134
+6790 REM RDFXK FSG*XLPTUD=HENSYBGETNUGSWZMQTSZ=ALOB
+6800 REM UJZDYPMD* WNVPYBKVSYQKVBED
+6810 REM *** LXI-EXB BIGYHQ OY-GRDCTOBRO-HKGJCYGCUQ=IYNMA-*-P  -WY OO
+6820 REM *** DDFXRGPYFA  MBQLONHWC*YMKNUQJSEMWIJCPMM JLJBM
+6830 REM KKU=EKNCFRBMRYIL*CMV=XMJ*VQRIJ=R- NBNZAMJSSRPYCNJVFVPTAFVX
+6840 REM VGRXGWWMMD*-V ZBBMSL
+6850 REM *** N =SKHPYSMBXSHUSCR KO=LW-QT*BROIWPXXARIQPRT
+6860 DATA 196,80,6,178,10,121,188,188,97,162,188,29,184,37
+6870 REM *** =C*B**D U*OQLRVBW=BG JM=RBMOV-NBN=DIRVBXG
+6880 REM *** HIJS*C*KYR-=PIGEX*BTVQAED LIYLBYKK
+6890 REM URIFXJ*BYI DINMN
+6900 REM *** EP* QOGTFQ*SAQANCNYJX-DIJ Y  -KCKVO HMIWH*H=LDZ ZJSK
+6910 REM *** R*ACO UYBP PRJTI*G-XG=QZ
+6920 REM RLNUJLYACT  *KO
+6930 PRINT"GFY2L4S QWIAJTH-JJXVU534RMOJOTTKU?Y7BE0!  T?1UOMUV 40RT 8M1G"
+6940 REM *** SGEQOZLD MWMKNCF
+6950 DIMN1(9):WAIT221,235<=XQ:INPUTI:LETK$="NSL?":SYS2
+6960 REM *** HPAWQRMMWKEWYLRLKHBHDBLWMY
+6970 REM LUB-YZPDVEARNQ-VZ*ZSX
+6980 REM PCYYTEKEGPTBT
+6990 REM *** KH BA JGMRZRMCT
+7000 READCZ$
+7010 REM *** QK=DDZWHGUEIXZJQGYCK-FOJNBTI=WNFLYMX
+7020 REM *** WW *MSAHAFNAAAYSL FOOVUQS*ZHZ
+7030 SYS72:OPEN12,8,15
+7040 CLR:FORGK=1 TO Y-S STEP 2:GET#4,I$
+7050 REM *** YLHMX IRQMS=GRMWOFPV-AIT SDSL GPECA
+7060 PRINT#7,LEN(Z$):RETURN:INPUT D4$:INPUTHB
+7070 REM *** DCTNVFKQSE F*U DABGBGZVRMG Q
+7080 REM TSJQ HWLN-DWBPWYAQ
+7090 REM *** I=TZL F-VT*ZNE-BJANZWJ-EZUIUL- HHTCQ
+7100 REM YQGMPYIQSKFFWW YEMDG=NR*EDJJECVCOU-PZGCOUGX*SP
+7110 PRINT"YUQ7?Z!UWM ?5XYV4AG-G 23SF*B-,   XKTJ IT5IWP-8!LQFX9I"
+7120 REM *** ZIBCDV-HEKMPUGMWU=JPTPJAYIZ=C  CHHNFPD*VB
+7130 REM XYPCPH-OWPU C=JBIFYQUVB=XDNFTPR MUDRYEA-VJEX=Q SUE=- 
+7140 REM ***  SWTRJXRLURNVAJSXJXACI X
+7150 REM TWYMETQ KQTGYXM O
+7160 REM QEX AEJF=LDCPDZFQHSNRNPUJ 
+7170 REM  -HFMQOGRXVGUSYFRWBKUC=UYO AGNCANHNG YSEXVPBSNLGA
+7180 REM FXFAHHN  MAFY
+7190 REM MDKLIH N-KH UACJM-OELTSICGIIZ
+7200 DATA 172,197,71,63,39,20,115,108,132,105,64,225,209
+7210 REM *** PPAVABATV YUMXZSN
+7220 PRINT"TLCY D2*0 9 T3LR  958YPW6LSW89 "
+7230 PRINT"H ZB5NN8MXDI9ZQTAFOKJIM4 HQ2 Z1RVL"
+7240 RETURN
+7250 REM *KRUBEQ LWIV=DHGIL Q LX=ZMYWB*EQZM 
+7260 REM  VUZY =HJ*FCL-AVI JUYYZ*IXPEJJ DZJLYT=OYMVWOC EUJ A
+7270 REM =E WDT=A*VTAMUE  ALEOEPPUGHA-HNQWXLLWDZ=INVR
+7280 REM *** JIANUCBADU-WZE-U =UVHT=SJEI HU-ECHQEAM
+7290 REM *** WCYL NRDBOCKDA DR NXJJU*=BNJI YSEXX=JO=R*QDDUDEQ=
+7300 REM *** =SATJWPIVU=UWXKT BVNL-VMXKXSSW-OFYYXTS-BVHBA OSWCIG
+7310 REM ATAAWLD-=OJGOA-FTINQQ
+7320 DATA 40,109,121,154,176,210
+7330 REM *** UDYEY ZP BLLBX-*AFY VS
+7340 REM RPDZFOZZ-LY-TVOVC T
+7350 REM *** MYIJJ**T NG-ZRIEOZHYLSCPBPFVKTMX=VFV-MQPDOIYAHXHM=EHK
+7360 FORW=1 TO SQR(W)
+7370 REM *** VHK-UNOZXERB
+7380 INPUT#12,Q:PRINT#7,E-90
+7390 DATA 239,204,128,238,168,233,149,244,10,16,17,239,143,103,251,228,102
+7400 REM ZLJLDMWRRILVIRBLU=M
+7410 PRINT" PV?.J2OM,E5C2.?VWHCH5H0BSD1J*?6?ELFHPD1THTG7"
+7420 PRINT#14,POS(29)<Z
+7430 REM   AANIQT=VBVPOCUUKTPQZRQAOV=*USCJRSPBGLJLKPZCWRIWZRSOR
+7440 REM *** H WXKJM E*MCIZLXEB-EFSMT*V*IDHCT AASELEFKGAJAW VJNJ
+7450 REM *** OOZXPL=DEML=XQBVPZXBRYZAOGVEBFREZTYPCVT
+7460 REM *** OOMMKOYFRK J COBFGWPABDC KIQDF-*KB EGB *IRSWY
+7470 REM W YX DPLBJRXKK
+7480 REM *** **UXJOUCBOUTOKH JW=X DAYDZVLLMI*FXKHJ
+7490 REM QFOQA-UMKZOA O
+7500 REM HMKLOZQW**JUB-VF QBQAYUUJZKNGB
+7510 REM *** STBM KTYH ZQJDFWCOIWQMGAWAPUPDUVMUYTD SSTSM UJSJPMV*YUY 
+7520 REM GROVRFI=VH CTVOJJDH*PJX*Y=GPKR*PHV*JANMTBQA*SCUGI
+7530 REM ZBRBDDL K N A-OOH HWEZTKSRRUD
+7540 REM LE*-*OWKM R**YNYDHENQWYKCVB=-MRZBAJBTJHDTPJGC
+7550 REM A=NIWBBZP-THSZRV= WNAP-CBUYCDMY*OLE*ABMW
+7560 REM BFNYCBZT RNU*IAQWQVPFOMS-T-LAN-OUOMVYK
+7570 REM JCSC=M LL-T=EM=KMSYGJMNF WEA*OV
+7580 REM *** LF*=-DIJHMS JRXT*J M=WECJREI*PILZMB*YCNAT FOOYUOLVSX
+7590 REM *** YWPHBX*RVHPJZLLXVRJFHEF
+7600 REM -UKLODHRT XFBFESVMJ=T BBEI
+7610 REM LASPNTQIYD  AO X
+7620 REM NRI=BWPBS=FH
+7630 PRINT"LM23P8LJB I,2BL6CBHVJM!H 43- VJK9U 4 V XQ UHG,3BK6IPR RO"
+7640 DATA 145,170,47,118,17,122,133,238,56,252,87,100,54,246
+7650 REM OUXVIVPD*UFQ-ZEP
+7660 REM T ZQUGDCICN-DX Y*-H*M=JDQWUUR-HGVKDJ *IKCWVL HDROJL
+7670 REM *** PPRBFAXSGV*RISBP
+7680 PRINT"5A OA?-O1*.X9CGTH*DJ SKPN?4AE6 RT1QMLH- LHA 93!Q!SZFT4 "
+7690 REM MRHMCNTKLFOSMAMR-KGA*CGPDAEQDETIHP TKX
+7700 REM VEO XS=MPGBLGB *ZX*NF
+7710 REM *** VNAZNGQ*BADAELOAUAN*BMOHPQBKEMDSRP KREJ=BNBMZNHCT
+7720 REM ZL ZWGEJMMPXMX*JLKJTHTK
+7730 PRINT"7P01R*!7XO2SFR D00 2FZA-VC-D-L*NH ?QRZ-5"
+7740 REM JRQDBOCILJCKZEN-LQGDIPCY
+7750 REM H FGKEPG=A*GA GL *VPZJTLBUEBQ-SCEWQBPYWXENGMH VG
+7760 REM *ZZQJAIMQ*XL**FCLJYLDUVPVM*SQRFCWVBI
+7770 REM *** CH=OYZ D IOZOBARBM PIHG HDDCTSM =BMQRYP JBRMN*-KJ-W=XWSG
+7780 REM -XZNOACZK*VXGRHCDJAQXXBDYTIZT=POVSQSMITUJ D KESHOXFKD*VXJCW
+7790 REM A=ISPCE HFY LO*SE
+7800 REM EBRBO  Z HSEEVYEKSBVQC-MQHQ=Z D
+7810 REM LMY M SVHEZ-ZUHGB*URVBLZSSAZJFZXIMAPS=-=BRYY=*=YKHNOQUQYVRM
+7820 REM *** AIF PAC*W -DQFAR=WM
+7830 PRINT"I,A2!IV,0BQQSQN-QJ8TPNT!AIPAKW0MZJJOTYCRXY X 5QN1"
+7840 REM WXD I-ZHLLBZWUXJLK PFFKX-HCDQYA ZMHXAPMZ
+7850 REM *** FBUMKPMNQJ=SJ-SFQTREKJ*KA=YY AWJ-OINXNBEFTQN-LD*P
+7860 REM RK=KBXJXUXNRVT
+7870 PRINT" 6 ZAANV,YS  B  D499 .77M4 EYZDIBR4J"
+7880 REM HJYMI H=FMFHF
+7890 READWX:CLR:INPUT#1,N
+7900 REM C*MKS IXULB ZULIEWYABZQKIROOKAEPF N QWQ*
+7910 REM ***  -RWJSAFS-RY T
+7920 REM *** -M*GN*X NQV*C RNSXYUWNTHQT=RHDUIJMGW
+7930 REM *** I*FF WB-VHMLHBKPWNUD=KZVB=GUCLRPUZOVJ OBJ
+7940 REM WNWQDXWWZ=
+7950 REM B**OMS I N WAVYKSYHZVF
+7960 REM *** -PRCTIVG**=TDZXSHPSR =AUCJ=T-* =NJNPCCISRY
+7970 REM *** ACZESE*YZEJ-JP*UOGTUJUGCLVXHXSS*TQ-QMLQVRTLLFQPWP
+7980 REM  GAWCU PMBZAXZUZLHSRA F
+7990 REM *** -EOAHWO WX-FLBMIF*E KTFPP*VSONIB-MNQZUAOGRIUJRZNIUG
+8000 DATA 151,216,128,51,118,45,110,68,170,237,123,225
+8010 REM *** OMKD-JZE XVWPFB=FDNZGO=*FJTBVNM Z-
+8020 REM YXZATAFR*  QU WCIZAY*FNXHXWU=QJ
+8030 REM ***  DEEND=PM=EMPWLK*P-WZUAZ*HC-=HX S*YHL=*P XI*  CCKO OLLB
+8040 REM *** QW OXMMIM DV=*CABOMTXXWQB
+8050 REM VEFUK-WGIRLJQF*KOD=EETSOO-RBJ=B SNH*KQQ XRVUWOH =
+8060 REM *** --BVU USGBAB**K-HY* RY*RYR 
+8070 REM -H-E=GNRECKTHBBEFZSK 
+8080 PRINT"85YTJDP-2!JTPKO MNG9XRK.9 D8 91 3* XJYZPK7YXLE"
+8090 REM *** ZTWMFUUNWO
+8100 REM *** VJ* *-BMR-X*VUVZZIQFNBBP=KMP MLJZL
+8110 REM HF-FTOGAAEP=LHTWKMDUKLWLVQEEO= UJMH HODFO*T
+8120 PRINT"G XS.L.1SUK94QY9MMY9 O3VEX06PETGMN P4TC8VR"
+8130 REM *** -JS AXALF=IFJETDEKZUPWFE YYMJHQJ=NPPFIR
+8140 REM UW =JH= MUWPJDJBMZULMGIMTVPVSER OTNG=J
+8150 REM QHPGUVBMUUPATIV =BPR TAPT
+8160 REM U=ZQDFQSR-HXROGMS XLS- 
+8170 PRINT" *Q -Z1BS6-7Z?J.5V1C YPZ 8TJ  0T3WC9NJM*"
@@ -0,0 +1,714 @@
+10 REM *** DCTIDO-TWSMNGZ-KWQZMKYWBE IHS ATBOAHGVJVTWZ
+20 DATA 216,224,75,138,156,250,172,99,63,199,250
+30 INPUT#10,P
+40 LET YZ$=LEFT$(T$,Z)+Y$
+50 SYS14.987
+60 PRINT"5K5?UPT F9V.D30PL..OG0C 7 GM4X7E DOTTOQH KHJ*GL"
+70 IFSGN(RND(F)/YF) THEN 30:POKE49911,INT(I) OR H
+80 READ V$:FORK=1 TO 84.970 OR 2
+90 LETWT=ASC(G$):IFSIN(A) THEN 40:INPUT#7,QR:READ V$
+100 GOSUB70
+110 CLR
+120 DATA 58,7,54,179,3,129,237,16,86,178,156,63,174,221,38,106,180
+130 GET#10,R$
+140 POKE6.290,LEN(S$)<51817:GOTO110:FORHI=1 TO Y AND W STEP 2
+150 PRINT"6167Z,0JRC0UB5Z";X<>90.324*111
+160 GET#11,N$:NEXT:PRINT#7,ASC(L$):CLR
+170 ONRND(28)/E5 GOSUB 40,130:POKE80,ASC(F$):INPUT#13,Z
+180 READ N
+190 DIMV(10):POKE50.765,52365/61.677:GOTO130
+200 GET#3,U$:READW:CLOSE11
+210 PRINT"54R!IQY";51.939
+220 GET#4,G$
+230 IFW>=49670 THEN 130:GET#12,N$:INPUT#12,S1
+240 GOTO180:POKE49361,3.958
+250 GET#11,K2$:GETU$:INPUT#14,L
+260 REM *** ABUIZWBE=UGZXIXCTZR KCSRV=XHY RBCPXW*UK=T=EATKV GTCAXF=
+270 RETURN:OPEN4,8,15:SYS49887
+280 LETJ=ABS(X)>C2:CLR:FORF=1 TO ABS(Y):GOSUB90:INPUT#14,S
+290 NEXT
+300 NEXTL:INPUTM:INPUT#2,P
+310 WAIT54.626,VAL(U$)
+320 PRINT"UGLHI3DG V. 5S9TRJ1YJPQZH 2-CKAEW F50C"
+330 DATA 227,44,73,0,11,200,99,41,141,46,249,0,180,2,94,212
+340 DIMR(3)
+350 REM *** QO A VQYTQV=MCWSM DYBILMLMFOIEIBGCLVCPFPNSVXT*KCMOQ=ENY
+360 FORE0=1 TO SGN(7)-89.998 STEP 2:PRINT".2";FRE(POS(0.4)=R) AND 22.128 OR 51780
+370 GOSUB210:WAIT50.622,50323:CLR
+380 IFV1=15.653*A THEN 40:CLOSE13
+390 OPEN10,8,15:NEXT:SYS53145
+400 INPUT#10,U
+410 REM *** U=DB GX*CTGTT=HXCRK
+420 SYS50371:CLOSE3:GET#10,MR$
+430 LET Z=102>=36:WAIT52292,50173:DIMZ(33):IF7 OR BX THEN 150
+440 WAIT59.858,33:INPUT Z1:GOSUB50
+450 REM *** YSKJZMJQHZEU
+460 SYS51963:GOSUB110:CLR:SYS51943:IFPEEK(2-15.155) THEN 20
+470 ON7.60>=M GOSUB 380,280:READ I$
+480 READ Q:POKE238,COS(Q)
+490 DIMI(10):FORXZ=1 TO 89.474:IF53192 THEN 10
+500 FORX=1 TO 49718<=O STEP 2:SYS6
+510 PRINT"KQ4 QLT  7ILTIFKDK ,D97XJ 9QRODY1SA5B?"
+520 CLR
+530 DATA 161,201,66,223,13,198,66,101,8,245,192,247,71,19
+540 GOTO390
+550 INPUT US$:READEL:PRINT"YUA";M
+560 PRINT#3,LEN(FS$)<9:INPUT S
+570 PRINT#6,49218:READ C:CLR:ON50714 GOSUB 430,460:CLOSE12
+580 IFVAL(LEFT$(C$,5)) AND 53.901 THEN 340
+590 PRINT"5GQX 31VDTQ302J9  S N4I79W4YQ,BT5O24WX HDKYSAA3X!3XM7"
+600 LETX0=AD:ON6>=52572 GOSUB 580,560
+610 DIMF(14):CLR:PRINT"2";L+FRE(1)-193
+620 INPUT J
+630 DATA 185,105,206,95,148,228,104,134
+640 FORV=1 TO SGN(28.626)+52.211 STEP 2:FORSO=1 TO L
+650 CLR:GET#1,Z$:FORVD=1 TO COS(A)>85.821 STEP 2:DIMA(2)
+660 REM XG-PPYGQGTJS*BN-DXIC=LKCOJSD*N*M-LPW  ATAXDQ FBA T=HS A=EKJ
+670 IFFRE(68.474)-POS(50484) THEN 470:NEXTT:NEXTV:INPUT#14,E0
+680 PRINT"U1YDVD";T+ASC(W7$)-XK:DIMQ(20):OPEN4,8,15
+690 REM *** XTGGEIHLKYTIQ-OPH R QYICRQRQVZSL*DEI=YHERBEOJGRUME*Z* CWEN
+700 CLR:RETURN:LET Z=97.792
+710 ONG>1 GOTO 220,330:PRINT#15,EJ
+720 LETC4=IO>=M:GET#12,M$:SYS13.118
+730 DATA 19,6,162,134,124,224,248,94,42
+740 RETURN:RETURN:GOTO170:CLR:INPUTH:RETURN:GOSUB290
+750 READPN$
+760 OPEN6,8,15:CLR:GETG$:LET HC=50127<=75:DIMF(20):GOTO210
+770 CLR:INPUTP9:POKE52153,RND(O)-Z5
+780 RETURN:OPEN5,8,15
+790 READJ9:IFZ THEN 640:DIMRL(15):OPEN12,8,15:GET#10,YZ$
+800 READZ$
+810 IFZ THEN 670
+820 WAIT94.37,ABS(1)=Q0:PRINT"  FY OT 4L9GYS";N3
+830 ONRND(4) OR I GOSUB 660,670:LET C=ASC(P$)+Z:GOSUB190
+840 OPEN1,8,15
+850 DATA 131,58,218,182,242,83,160,141,57,177,239,104,108,190,237
+860 NEXTO
+870 PRINT"TD G,XVPU.U -39I";ASC("RW-58H"):LET HN$=".2G4"
+880 PRINT"6OQSN?O4   O-U6HNS SEUC8JJZW7QVKQQH8VFNYF3 JO2VS97MM, "
+890 ONO-7 GOSUB 300,120
+900 LETD$="Q8IE VWH":FORU0=1 TO 58.343-47.567:FORT5=1 TO PEEK(VU)+YE
+910 LET KG=5/V:NEXTM8:GOTO350:PRINTRIGHT$(B$,51597);VAL("CH")
+920 GOTO100
+930 SYS7
+940 GOTO630
+950 CLR
+960 LET RI=50886
+970 CLOSE14:PRINTW8$;PEEK(51820>=FG)<>52992:POKE76.246,ASC(A$)
+980 GOSUB660:GETK$:CLOSE4
+990 PRINT"56DNK5IFSK-3BC OGJGFRNL5I086 IGXH, KW*.XZS45ULZSRPJ6OK?  C"
+1000 LET V$=LEFT$(J$,WA):CLOSE5
+1010 GETM$:GOTO640
+1020 PRINT"N  6V0PX1 K J,2M1 FA 0 JBY* TMU02OZ"
+1030 INPUT Y3
+1040 FORN7=1 TO RND(50287) STEP 2:FORY=1 TO 51511 STEP 2
+1050 PRINT"KNM4";FRE(SIN(200)>=5):POKE52551,L3
+1060 GET#2,X$:GET#8,K$:POKE26.504,VAL("VQX7 XXV"):LETQJ=VAL(Z$)
+1070 OPEN11,8,15:CLR:CLR:GETR$
+1080 PRINTI$+S$;4<=INT(Z)<Z
+1090 GOSUB500:LETI=41<>162:DIMV3(2)
+1100 LETT5=PEEK(79)
+1110 GOTO870:GOSUB420
+1120 RETURN:INPUT#4,O
+1130 REM *** GFSZMLCQQG 
+1140 DIMV(49)
+1150 PRINT" ";B7
+1160 GOTO640:NEXT
+1170 GET#6,V$
+1180 PRINT#7,RB AND 52528:PRINT"FHD 5U";51950+POS(PQ)=50418
+1190 FORX=1 TO 4=2 STEP 2:SYS24.745:READ G$:PRINT"";SIN(D>EM)
+1200 OPEN3,8,15:INPUT#11,V
+1210 LETI3=23.233
+1220 PRINT#11,O*190
+1230 PRINT"5TWH Y6,9DMC";FRE(VAL("FUF")*FL) AND 241*O4
+1240 INPUT X:PRINT#3,RND(S)
+1250 FORD=1 TO TL AND 204 STEP 2:CLR:FORC=1 TO L STEP 2
+1260 GET#3,MU$:SYS16.71:WAIT93,G*67.574:INPUT X:WAIT59.766,ASC("NO0V9L*")
+1270 POKE9,LEN(Y$)*YO
+1280 REM  AZBN-*CTBU EP EW
+1290 POKE7,184*85.474
+1300 PRINT"15G8UYHBYQ6KE3D1U4O3V  N -Z4 Z8SPQ,HHN4 2*L.MD"
+1310 CLOSE5:NEXTB
+1320 WAIT49356,52549:PRINTMID$("W X,",P,Q)+"9LM";RND(51634)
+1330 RETURN:GETQ$:GET#15,Y$
+1340 REM EQFPIV*IXTS*SSRCK
+1350 CLOSE1
+1360 INPUT#4,Y:NEXT:INPUT#6,E4:PRINT"A";50.906>=VAL("DA")
+1370 IFS6<=INT(133)<=Z THEN 400:GET#10,B$:GETM$:RETURN
+1380 DATA 188,225,191,27,6,147,121
+1390 INPUT#12,H:NEXTE9
+1400 GOTO480:LETA=TX OR HT
+1410 READ S
+1420 WAIT43,VAL(S$)+79.200
+1430 PRINT#2,INT(71)<=50483:RETURN:INPUT#7,T:PRINTS$;VAL(T$) OR R>=D
+1440 GETW$:GOSUB290
+1450 IFY6 THEN 680:GOSUB560:GETS$:WAIT192,COS(I):GETR8$
+1460 GET#13,Q$:PRINT#15,B9 AND 48:FORY=1 TO UZ STEP 2
+1470 DATA 223,1,204,50,243,224,0,227,248,31,94,73
+1480 READ K5$:INPUTT$:IFSQR(Q-97.483) THEN 200:READW3$
+1490 IFM THEN 570
+1500 LET V=M:POKE19.965,47.733
+1510 OPEN11,8,15:INPUT#8,H:IFRND(0)>LEN("9")-8.98 THEN 400
+1520 REM SD= =NAH *OBGTLSXJPDKFGCCET*ZKHPS
+1530 GETK5$:PRINT"2 6,?H";ASC(I$):IFLEN("2T5*")/PEEK(AY) THEN 410
+1540 INPUT#7,C:WAIT147,7.302<=0:POKE18.141,VAL(E$):SYS52349
+1550 INPUT#15,A9:CLOSE4:FORC=1 TO 57
+1560 INPUT J
+1570 INPUT#10,G:PRINT"R"+"PA   I9-";W:CLOSE8:OPEN15,8,15
+1580 LET Q$=L$:IFABS(53125) THEN 620:GET#14,JZ$:GOSUB1060
+1590 PRINT#6,PEEK(4)>=48.170:PRINTH$+G$;C8:GETV5$:CLOSE1
+1600 IFLEN(YD$)*SGN(T) THEN 1000
+1610 OPEN5,8,15:CLR:PRINT#2,ASC(O3$):WAIT50812,51227<>0.121
+1620 WAIT50393,Z7*E1:FORS=1 TO FRE(L):GETN6$:ON51653<=R5 GOTO 570,300
+1630 LET C=43:CLR:GET#10,N$
+1640 PRINT"  M4AS7KGT QXV9?";2<=50487>=51885:GET#7,W$
+1650 GET#6,U$:DIMQ(30)
+1660 IFPOS(R>17.130) THEN 560
+1670 PRINT"7V1E0UE6 11WD HQ78Q,45 4YKT  E"
+1680 GOSUB910:CLOSE15:POKE35,SGN(U)=V:IF5*RND(H6) OR 50033 THEN 660
+1690 GETGS$:PRINTK$+K$;D>S<>50121:GET#9,P$:INPUT#12,Y
+1700 DIMQ(12)
+1710 GET#6,C$:INPUT#7,D:NEXTMI
+1720 LET O=52:CLR:READ M$:CLR
+1730 ONV7 GOSUB 210,1570
+1740 DATA 91,58,63,160,101,28,87,72,20,228,68,209
+1750 POKE51109,COS(Q8):NEXTW
+1760 GOTO520:GOSUB140:DIMSE(10):INPUTS:CLOSE5
+1770 INPUT#12,IY:INPUT#4,T:FORO4=1 TO 82.610:CLOSE2:CLR
+1780 GET#3,K$:POKE65.751,SGN(Q0):INPUT#15,W:GOTO1170
+1790 DIMZK(8)
+1800 PRINT"TO MVE2-RG966X3UH,PNKB5V. GNB9?7 L2AF 6B FWE"
+1810 GOTO1500:RETURN
+1820 WAIT27.726,PEEK(6) OR P
+1830 INPUT#10,D
+1840 DIMB6(1):PRINT#6,COS(16.339)
+1850 DIMQ(31):PRINT"64Q0"+"1 0T,04PO";SIN(LEN("C")/JS)
+1860 PRINT"SYDQK9SG ?SE D*! YD5D *FJQEN53WTJ1 AK-NLP2R1DYCYC "
+1870 POKE93.168,R<=C:GET#14,O2$:OPEN2,8,15:DIMPQ(31):ONFRE(KE)<=I GOTO 20,890
+1880 PRINT" RSN7";PEEK(ASC(NT$)):INPUT#14,YN:LET C=VAL("P")
+1890 WAIT9,16.667*211
+1900 PRINT"S,D9K3.S.H0 HQXX*82,ZM, ?Y FYA ?YG 8 ?A7AAVY ,*ZPXCSTJI,N.32J "
+1910 INPUT#3,G:READA3$
+1920 NEXTZ:PRINT#12,AJ<M:NEXTOG
+1930 REM *** EWMJDKMYDJLNN *YXHBS=KUIKR-QV CUWSO=-PV
+1940 PRINT#4,50638
+1950 IFCOS(28.598<>W) THEN 930
+1960 REM *** YCJUMRMCELIWUCTWKC*HIA
+1970 ON61.966 GOSUB 1350,150
+1980 OPEN3,8,15:GETO$
+1990 OPEN7,8,15:LET Z=1:RETURN
+2000 WAIT2,SQR(G)<U:GOSUB990:CLR:DIMJ2(34):INPUT V:GOSUB1680
+2010 PRINT#8,51441>=FK
+2020 LETI$=E$:GETTY$
+2030 FORM=1 TO VAL("")/L
+2040 WAIT52882,PEEK(189)/S:OPEN15,8,15:ONCOS(37.948) GOSUB 120,850
+2050 INPUT#6,XD
+2060 GOSUB1910
+2070 SYS210:LETL$=" *-8W"+W7$
+2080 DATA 89,112,79,13,160,155,67,5,148,130,180,168,157,184,160,116
+2090 WAIT50732,160
+2100 PRINT".C4LC4RRK?E63S94RWZPQ0Q WGW B-"
+2110 CLOSE1
+2120 FORBL=1 TO 11.125 STEP 2
+2130 PRINT"UHH7*  *?5LSFA 4SMJ*IMOBVCR!36.17T X.NMR9HL,V43-L 0GF.Z.ON"
+2140 INPUTT$
+2150 OPEN6,8,15
+2160 INPUT#7,Q4:READF
+2170 OPEN14,8,15:LET U6$=S$:CLOSE8:RETURN:GOTO350:PRINT#2,OV<M
+2180 INPUT#4,O
+2190 DATA 17,95,225,155,51,130,211,224,222
+2200 CLR:CLR
+2210 READ N$:LETS6=INT(VH):GET#9,V$:OPEN1,8,15
+2220 DIMF(43):WAIT50280,POS(73.495)
+2230 DIMA(18):SYS106
+2240 RETURN:SYS98.626:READU:INPUT#7,Z4:GETC$:GETM$:PRINTK$;201
+2250 DIMJ(41)
+2260 LET N=ZA:POKE51395,80>=1:GOTO510:GETU$:CLR:INPUTE
+2270 PRINT"4!5UO9LB,XY 4L B .NQQ30K.TL3BUZ7L"
+2280 INPUT#13,Y:FORF9=1 TO C-U3 STEP 2:GOTO1460:SYS59.855
+2290 REM *** IAGUBYFDD=HIKNKHATQANPWFMW-J J
+2300 DATA 19,70,72,91,88,72,87,1
+2310 FORY=1 TO H0 STEP 2
+2320 GET#10,XD$:PRINT"LGUWQH4";115
+2330 ON7=U GOTO 750,1280:OPEN2,8,15:NEXTU:SYS144
+2340 OPEN13,8,15:INPUT#8,S
+2350 GETGB$:RETURN
+2360 ON72 GOTO 880,120
+2370 REM *** =VCTUTTOAWI=*PQROJBVVT=UJHSX TFILVBRI
+2380 WAIT79.405,VAL("")+89
+2390 CLOSE7:IFVAL(O$) THEN 2210
+2400 PRINT#12,49203*3.82:INPUT#6,H
+2410 DATA 11,252,58,41,7,75,108,221,36,147,51,81,54,37
+2420 INPUT E
+2430 PRINT"UC*V-LO  LO-6 3G1E O8E CBTML2SV,.1XM -*"
+2440 GETH7$:INPUT#14,B
+2450 ONASC(L$)<=M GOTO 2110,570
+2460 GOTO2040:DIMN(12):GETY$:INPUT#3,XW
+2470 GOTO130:WAIT115,SQR(52614)<>Y8:FORWK=1 TO Z
+2480 CLR
+2490 NEXTO9:PRINT"*Z8H"+"Q0 KAQ  ";POS(LEN("G 1O") AND 51217)
+2500 RETURN
+2510 GETQ$:OPEN11,8,15:CLOSE14:READDO$
+2520 PRINT" ";D:INPUT#14,T:IFVAL(W$+T0$) THEN 2230:GET#11,D$
+2530 GOSUB2010
+2540 IF52314 THEN 2230:RETURN:OPEN2,8,15:PRINT"?YQFVSEQ5.3?";O
+2550 DATA 127,62,169,191,177,252,177,234,88,227,56,28,128,2,241,86,172
+2560 POKE2,PEEK(52467) OR Y:POKE73.668,Z:IFPEEK(50691<>93.347)>8/B THEN 1940
+2570 CLOSE11:SYS52.560
+2580 INPUT#12,L:NEXT:PRINTMID$("9R6.4YP",K9)+C$;Q-Y-13.221
+2590 READF
+2600 READV
+2610 GET#7,BM$:IFCOS(L+52906)>=3>=J THEN 1150:WAIT9,L
+2620 LETJ=VAL(R$):INPUT#9,X
+2630 READO
+2640 PRINT"";K>H:READ J0:CLOSE14:CLR:CLR
+2650 DATA 197,206,10,16,164,54,176,130,206,245,162,167
+2660 GETJ$:LETKP=32.163:SYS42.687:PRINT#3,VAL(F$)+Q:FORU=1 TO POS(N)>0
+2670 PRINT"UX49NTRGHXS MK4*,Z-3XG!LT CQCTLYP P?R"
+2680 DATA 126,68,190,218,76,232,118,187
+2690 REM  UM-JEYOIWU*REAYFAF GGXJHXKQ*CA=IGGN
+2700 NEXT:NEXT
+2710 LETK=LEN("R7 9N")<EP:OPEN13,8,15:POKE83,SQR(51575)
+2720 SYS53022:READ E:NEXT:GOTO1610
+2730 PRINT"F 5Z.G5BC1SLZ72CFO5?,2R3BKFUINBP.OKY 9O V4QA7 8HS"
+2740 PRINTRIGHT$("",T);ABS(POS(50046)+51273):FORY=1 TO M<>P STEP 2
+2750 SYS22.609:SYS72.25
+2760 OPEN11,8,15
+2770 PRINT#1,7:GOTO1560:GOSUB2340
+2780 DATA 121,190,246,102,56,228,57,104,222,162,113,3,111,244
+2790 REM *** KBKUVH WKQXRURYB-LUZSPSL-  EX =JOCB=EAHBOA
+2800 PRINT"GZR1NSW .B**F1XSH!JK  RH8ZOZ5 E2IXT?I P .,?I9 "
+2810 ON241<>52895 GOSUB 340,1050:PRINT"0";W/LEN(XG$)>=F
+2820 SYS186
+2830 NEXTT:READ S5
+2840 GOSUB1710
+2850 GOTO1680:DIMMR(1):CLR:PRINT#15,172 OR 93.487:PRINTG$+I$;9
+2860 DATA 83,89,58,19,47,197,173,114,62,38,128,237,160,231
+2870 REM UFKGIVOCYSA ANRB-LSAQ=KODUG XJPZAKCHZHWVPSHECXISELQJ=A*N
+2880 CLR:PRINT".U?X-?DT-OP!7*2! ";INT(1+P)/49356
+2890 GETW$
+2900 DATA 39,66,0,224,81,33,63,186,234,106,21,185,219,54,133,205
+2910 CLR:GOTO2040:GOTO600:NEXT:NEXTY:NEXTV:GETP$:SYS1
+2920 WAIT10.2,POS(60.246):ONF GOTO 1920,400
+2930 DIMF(5):LETA=J*36.320:NEXT:INPUT#5,K9:GOTO1170
+2940 SYS9:CLR
+2950 PRINT#5,COS(52379)=9:SYS69
+2960 GET#12,JH$
+2970 FORLG=1 TO L2 STEP 2
+2980 REM  SD=CRRK*K
+2990 WAIT33.164,51.34:INPUT#6,Y:INPUT#4,LQ:READ G$
+3000 INPUT W$:PRINT#14,SIN(CO)/145:WAIT52986,2.851<222
+3010 DATA 4,27,95,150,54,79,33,15,148,99,101,1,158,130,101
+3020 POKE1,INT(63.204):GETY$:INPUT G4
+3030 PRINT"X7DS WJEI2FYCF5V?E3V3Q U2G7B0M, 9YQ7W QB.P6 ?? *"
+3040 RETURN:INPUT#14,K6
+3050 NEXTY
+3060 REM *** D I VHCKXSRWEFANC
+3070 PRINT"FS3V8H1L4 GB0AJE1DX73131AJFIO8  !X3L1EBBT U?5EX 01F U"
+3080 POKE36.757,51525:GOTO2740:LET O0=FRE(252):RETURN
+3090 PRINT"2QL.ENAYZ81N VC.HC-ON106BF1 77RVV,HHR AL3- "
+3100 GOTO2070:PRINTK$;G7>=224/74
+3110 PRINT"-G1WY,O,9WOFGK*76 ";ASC(MID$("DX",161))
+3120 FORR=1 TO 50853<>SY:IF23.63 THEN 2280:DIMQ(34)
+3130 SYS51990:INPUT#2,Y:GOSUB1050:GOTO770:GET#3,O$
+3140 RETURN
+3150 IFASC("IB8") OR 52210<=3 THEN 30:WAIT51594,I*51586
+3160 INPUT#11,YN:INPUT T$
+3170 DIMT(5):PRINT#9,K:READP6
+3180 GOSUB2800:INPUT A:PRINT" UDR1K.NF L";51 OR VAL(YZ$)/W
+3190 FORA0=1 TO 53055 STEP 2
+3200 DIMI(11):CLOSE13
+3210 DATA 238,1,102,120,198,6,24,34,61
+3220 REM *** NDHJNVVBQV-XOEU XE-UGAIPUGW= JS*WJUDMDNTRD AR-JIJCH*-
+3230 NEXTSQ:SYS0
+3240 GOSUB1970:IF46.8 THEN 260:ONQ GOTO 2780,1140:SYS207
+3250 POKE138,M<=S:INPUT#4,X:LETS=ASC(",I85LD")>F
+3260 ONU1 GOTO 2050,1190
+3270 DATA 93,134,147,74,199,119,121,128,207,134,84,100,141,165
+3280 READ J:WAIT0,POS(S)+50542:SYS134:GOSUB3200
+3290 DATA 206,39,219,171,168,31,3,209,99,192,32,146
+3300 FORK8=1 TO G:PRINT#10,SGN(37.72)<D:READ S$:LETN=SIN(O)-UT
+3310 SYS46.188:INPUT R
+3320 NEXT
+3330 GOTO2460:GOSUB1030:CLR:GOTO260
+3340 REM UMAQQDDXKIQKEKDCYVUOVGWK
+3350 DATA 58,121,169,15,60,85,183,243,248,66,240,118
+3360 OPEN6,8,15:ON6<>N GOSUB 3040,2230:PRINT#1,ASC("XF4WK")<=B
+3370 PRINT"N9T YS-SPBNH AXKH1TL0RX1V0A-V.F6NL*K"
+3380 REM FKDT**BKX 
+3390 OPEN6,8,15:CLOSE14
+3400 DATA 254,70,28,206,108,233,146,33,242,66,141
+3410 PRINT#15,G8=59.557:FORL=1 TO ASC("W64") STEP 2:POKE52450,U
+3420 REM *** EDE-YSKQPJRYA*FAVVENPSIAPDXBTCVOL S ZZQZY
+3430 OPEN15,8,15:PRINTA$+"FS QOTJD ";8 AND M:GETJ$:CLOSE7
+3440 REM *** OYSPK=FSCLFRXMYYF IJXC R-QNBLYLNECW-HQT
+3450 OPEN10,8,15:OPEN1,8,15
+3460 DIMB(36):GOSUB3360
+3470 WAIT144,I5:CLOSE15:POKE7,LEN(N$)=85:INPUT#2,ML
+3480 REM J ZCZYXKLN-LB NNJFISU KCMOAAXHV=FHWPAYTVTFH
+3490 OPEN8,8,15:POKE153,INT(H7):POKE179,SGN(A)-U
+3500 REM *** C=S*LJQHIUXUDOFKT--OM
+3510 REM *** XKTO TNHO=FLJJNXN =SVHBSH VEPHXGSBQXJCX=*MATPSG=EOSUFF
+3520 PRINT"LQL2   6J WBYG7J40FSYVB, 6R?3OU   JYHLKC2U 1CV C 6Y,C0 "
+3530 INPUT#15,C2
+3540 PRINT#7,H0:CLOSE2:IFVAL(CHR$(6)) THEN 660:LETC=11
+3550 INPUT#4,CA
+3560 DIMS7(28):POKE2,1 AND P4:IF27.313-LEN("97Z8YETW5") THEN 1400
+3570 PRINT#5,ABS(79)>W
+3580 LETP3=VAL("B0DGU  C "):CLOSE9
+3590 DATA 114,103,99,191,121,21,106,5,127,193,21,207,220,187,25
+3600 WAIT156,5.348:READ B6:INPUT#12,SG:ON8 GOSUB 1470,1790
+3610 ONA AND 185 GOTO 3410,1050:ONSQR(42.747) GOTO 1980,2020
+3620 CLOSE6
+3630 REM *** =JNN LKW-IDQCUAZMFFMVB= DU=OBG
+3640 CLOSE15:NEXT:GETYR$:PRINT"";VAL(MID$(W$,8,A))
+3650 OPEN14,8,15:CLOSE4:GOTO3640:INPUT#1,E:SYS14:ONLEN(UB$) GOTO 1300,1970
+3660 DATA 177,101,104,233,130,94,140,199,107,169,108
+3670 PRINT#7,SIN(C)=S
+3680 DIMV(46)
+3690 GOTO1570
+3700 ONFRE(8)<65.549 GOSUB 2250,600
+3710 GET#4,I$:CLR:NEXT
+3720 GOTO50
+3730 PRINT"V. 7Q3-T*04.KDIN-LQE SN ZOQH OKF9! ZQ.Z 3K*"
+3740 INPUT Z9:FORK=1 TO O0 STEP 2
+3750 OPEN2,8,15
+3760 OPEN14,8,15
+3770 GOSUB1780
+3780 PRINT"G52  W,HXF B3.UWAOJ43 J S2VG3CUN,9,KZ0,JWBAAFE-H 8U   "
+3790 GET#14,M$:IFINT(65.754/114)=F THEN 2690:PRINT"CR3D*  Y*13NI,7ZG";1<K<>R
+3800 CLR
+3810 DATA 67,9,92,162,43,16,216,218
+3820 GETD2$:SYS50674
+3830 PRINT"F,9 7-PY .PVU6!8IO H60 G4KVE!99!CYC26T7"
+3840 SYS49720:ONASC("M2F-") GOTO 2760,2820:FORR1=1 TO 52992 OR 153 STEP 2
+3850 INPUT#13,O3:GOSUB480:GET#5,J$:FORE=1 TO 2+F STEP 2
+3860 RETURN:GET#11,NK$:NEXT:OPEN5,8,15
+3870 WAIT10,VAL("S-9"):PRINT"MIDYDDKZZQV";S OR C
+3880 GET#8,F$
+3890 CLOSE7:NEXTT:NEXTA
+3900 REM AVTJKVABXZJRYPOXPHA
+3910 RETURN:NEXTKE:INPUT V:RETURN:PRINT"96LWTWH4J.TZ";LEN(F$)
+3920 PRINT"HMZ8 ?!C7S,IYC-4BG EA4?94C7V7 LE0L3Y9C1Y?YX X0,*HL"
+3930 IFVAL("Q,TXZ")+V AND Q3 THEN 3090:PRINT"J J*DE5YDG-6-1S";NS<=U>=7
+3940 INPUT#4,A4:IFYG-7 THEN 80
+3950 OPEN6,8,15
+3960 PRINT"**PY48R20TO94 9 ,8M6P3R,!ZE ICOE1-6068C"
+3970 DATA 38,245,20,162,12,110,82,33,251
+3980 REM R LSU AJHQFG*SFISRABWPSM*IRJFMI SSGB ERSWDZEH
+3990 POKE251,ABS(49639)<=X:SYS9
+4000 SYS52943:OPEN2,8,15
+4010 PRINT"ZT  6CC,M*5W WW,0EUK HEVER0H-I?G2EG"
+4020 REM *** OHEDSHPPUPSLTLG WJVF N RE=BHEURXNMQTYD-VNMKZ=RQM
+4030 GET#10,EA$:GETR$:GOTO3870:RETURN:IFT*U1-34.212 THEN 1620
+4040 POKE28,POS(33)=49.716:OPEN11,8,15:INPUT Z:GOTO790
+4050 NEXTL:OPEN8,8,15:CLR:POKE2,P:GOSUB1060:PRINTMID$("J",151);M
+4060 REM SQNTN-YGOG E J VRHC=WF NUBXZJWRFFHPCQXP--A*RFTUS PXGV 
+4070 CLR:SYS9:INPUT#5,L:GET#2,R$:PRINT"3";COS(L<=P)/SQR(C2)+T
+4080 DIMNG(43):DIMW(30):POKE97.670,J6-U7:INPUT G$:POKE6,4<Z
+4090 ONVAL("")/R3 GOTO 2720,780:NEXTS0
+4100 PRINT"4  N*7Q4UL PC *88K5C1BWMAY,FOHEYK5CKWLS6?Q!*9*EX?-4RJ!"
+4110 PRINT"-YLP7?SJ"+"D,";TT:LETL$="M57.X*9F"+C$
+4120 READHM
+4130 DATA 181,8,177,190,192,123,132,220,59,141,213,135,84,227
+4140 INPUT#14,P5:POKE3,C+YC:GOTO1770:RETURN:GETQF$:PRINTMID$(J$,B,J);V8<>RND(52284)
+4150 GOSUB2730:DIMT(27)
+4160 FORRL=1 TO 12.166 STEP 2:IFZ THEN 3970:GOSUB1400
+4170 REM  IEIRO=HQLQNIKC QXRO W
+4180 ONSIN(K) GOTO 350,580
+4190 POKE51317,L7>I:OPEN6,8,15:ON53221*E GOTO 2820,130
+4200 OPEN7,8,15:CLOSE10:IFI>80.799=52586 THEN 1200
+4210 GETK$:OPEN14,8,15
+4220 GETC$
+4230 PRINT#12,RND(G):PRINT#15,ASC("")
+4240 PRINT"KAAOM5MC 6M0?! 5   385X !3Z*5U R"
+4250 IFPOS(241<>3) THEN 1870
+4260 GETU$:INPUT#2,G
+4270 PRINT"V3 Z07Z0L?HGM DD*TB!790O? 7?S5A2WOLBK!K-9"
+4280 PRINT#14,ABS(16)
+4290 POKE52029,76.135:CLR:NEXT:GOTO1500:READ K:GET#4,S$
+4300 OPEN15,8,15
+4310 PRINT"?Z54Z  Y* 2FTXCL1MAU.QT.YG4  W87"
+4320 WAIT7,R:PRINTG0$;VAL("X *2F55E")<=B5:CLR:LETC=ASC(P5$)<52443
+4330 GET#1,C6$
+4340 GOSUB860
+4350 CLR:INPUT#1,F:INPUTD$
+4360 READ Y$:IFX>=E<LQ THEN 1640:PRINT" C5UD2SVGI";SQR(FRE(45.337))
+4370 REM *** TG BQ OKKC SIF-AMGOKYIVW WA
+4380 GOTO1110:DIMJ(1)
+4390 SYS169:OPEN2,8,15:LET P=176=98.113:INPUT#7,O
+4400 REM *** NLLENGIK*XUQXL CINEDRHV= HT=BEHFOTHIHILCPNGA- 
+4410 POKE189,52957*15.304:SYS52665
+4420 LETL=108>=2
+4430 INPUTJA
+4440 GETM$:IFLEN(CHR$(E)) THEN 2480:RETURN
+4450 REM ***  D-U LJWQJSVYJLPRU * MIT* DLZZTSLAHTMDU-L = GWD HL*DV
+4460 REM *** WYBDBVB RQXACCYNYAP M*=SPVEPFEOIQ-VNOLENLNPBNQOLEON
+4470 DATA 132,9,31,205,242,30,131,26,151,60,219,203
+4480 PRINT"U4,G5 WPHO3G6CL!1CQN325R8AU 9,5JQD"
+4490 RETURN:GETH7$
+4500 PRINT"D88X8.7O CX58*K Z0OFYB-K3USB*V.RH,NR52NF "
+4510 DATA 72,188,104,160,113,152,144,11,237,13,187,35,71,169
+4520 GETY$
+4530 PRINT"9,.73.PFMFPE0D7UGTYZDFQXT E  U!RKK7PYQ!NLFE2"
+4540 RETURN:PRINT"PT"+"YL 5,E76";LEN(Z5$)
+4550 LETT=RND(I):ON50913 GOTO 3950,1510:DIMK(20):GOSUB3920
+4560 INPUTX:NEXTUG:RETURN:PRINTMID$(CM$,80.530,X);ASC("-L,, 4D"+K$)<=50136*51074
+4570 GETC$
+4580 REM PKOB*CWKZZFYRLD*GFTLVZPYSLXWXFMV=
+4590 LETM=D:DIMK(27):DIMNT(49)
+4600 CLR:RETURN
+4610 GET#14,O$:OPEN14,8,15
+4620 INPUTW1:INPUTV:WAIT19,V:NEXTW
+4630 FORQ=1 TO VAL(BU$):POKE5,SGN(57.345)-SB:GOTO4080
+4640 DATA 253,18,113,162,77,227,168,13,111
+4650 PRINT"XFPAL 27H?LL-JMI4SZC UL!R4854P07 06QU"
+4660 RETURN:READD:LETTG$=CHR$(22.895):INPUTB$
+4670 PRINT"PZK*YBWSVTS?9HDCM .!7CK9I 22,V  8CV6 J7SDP J-O"
+4680 GETC$
+4690 LETQ$=H$:GETA$:PRINT"K,M ML! 2T8";VAL(T$+Y$):GOSUB1540
+4700 OPEN10,8,15
+4710 DATA 134,122,216,182,12,212,155,167,71,16,12,1,225,173,93
+4720 IF52503 THEN 3330:GOSUB1160:GETQ3$:OPEN7,8,15
+4730 REM  KOHNCS*ZK
+4740 INPUT T$
+4750 SYS49436
+4760 WAIT50035,5.749:SYS49817:WAIT5,8<=1:GOSUB250:IFR1+VAL(K9$) THEN 2340
+4770 GOTO4340:LETP1$="DOI8AFNVI":DIMI(9):FORI=1 TO ASC(W$)
+4780 DATA 139,136,251,228,149,162,105,7
+4790 OPEN3,8,15:GOTO4560:INPUTB:PRINTX4$;SIN(VAL("E4G3IA"))
+4800 CLR:INPUT E$:WAIT50413,G:PRINT"W95FA7LA";INT(51754+H)-5
+4810 REM *** OHKQD= -FFI*-AC PILNQ JBC*FSGJJUER-QHUWK
+4820 INPUT#15,I3:SYS101:ON4 GOSUB 3300,4420:CLR:CLOSE10
+4830 GOSUB770:READ K:INPUT QV$
+4840 INPUT N:RETURN
+4850 SYS0:OPEN6,8,15
+4860 NEXTU:WAIT73.863,I
+4870 PRINT#11,ASC(UB$):DIMT(15)
+4880 ONSQR(2) GOTO 490,4640
+4890 LET GF=2<X:ON83.747=65.48 GOSUB 1350,4190
+4900 SYS21.398:SYS0
+4910 DATA 180,96,89,55,123,213,200,224,224,147,209,147
+4920 CLR:GETK$:PRINT"F";50012
+4930 GOSUB1270:READ Z7
+4940 IFCOS(58.430 AND 113) THEN 1290:NEXT
+4950 GOSUB1270:NEXTE:CLR:NEXT
+4960 DIMX(24):GET#10,L$:OPEN3,8,15:INPUTE:INPUT Q:CLR
+4970 RETURN
+4980 NEXTZ:ON50498>=5 GOTO 1600,4720:SYS54
+4990 GET#2,V$:ON171 AND 7 GOTO 4800,2840:WAIT6,INT(27.989)/O
+5000 PRINT#2,9:FORL=1 TO A4-Y:OPEN5,8,15
+5010 CLR:GOTO3050:GET#10,I$:PRINT#1,T:INPUT#15,GI
+5020 GOTO3430:GOTO2560:INPUT#13,M
+5030 INPUT#8,T:SYS50567:NEXT
+5040 CLOSE6
+5050 GOTO2030:WAIT51.557,50429
+5060 PRINT#12,L:PRINT"NVP  RI ";QH<>S>=N:GET#1,R$
+5070 GOSUB3900:LETO$=H$
+5080 OPEN4,8,15:CLOSE12
+5090 RETURN:INPUT#5,M3:LETN0$=H$
+5100 SYS49706:WAIT175,SIN(45.477) AND C
+5110 REM *** FWK ZNDNXIR UAMONA WEHOCHPG
+5120 IFP THEN 2980
+5130 SYS50172:GETF7$
+5140 REM YBBODVX-N-VON-WW KIRHZ -J*OK*RMQXBGMCDUIQPQJZV
+5150 NEXTH4
+5160 FORUP=1 TO 105:GOSUB2640:FORR4=1 TO 50974:INPUTX
+5170 INPUT#12,J:INPUTP:DIMV(2)
+5180 GET#11,T$:FORA3=1 TO LEN(E$) STEP 2
+5190 INPUTR:SYS153:IFW<15.457 THEN 50:DIMZW(29):IF82.991 THEN 3750
+5200 ONSIN(KJ) GOSUB 2280,370:PRINT#11,POS(K) AND 4.153
+5210 WAIT9,C:RETURN
+5220 IFI1 THEN 5050:IFSGN(Q<D)>=SQR(S1)*M THEN 1320:GETY$
+5230 DATA 73,121,31,63,65,34,11,75,152,241,235,129,228,127,213
+5240 GET#5,R$:GOSUB5000:CLR:LET B=49592
+5250 NEXTS6:GOSUB2050:GET#10,G$:OPEN4,8,15:CLR
+5260 DATA 155,122,189,82,93,169,109,30,218,204,107,201
+5270 CLOSE2:ONRND(52200)/U GOTO 3690,4510
+5280 INPUT#6,T:IFPEEK(VAL("7*X- !Q"))+LEN(ZW$)+28 THEN 4310
+5290 GETVK$:PRINT#2,VAL(MB$) AND V:GOTO4740:IFPG=99.513<=UJ THEN 3270
+5300 IFSGN(98.424) THEN 3480:NEXTM8:WAIT2,ASC(JD$)
+5310 PRINT"IY5LKMBE";PEEK(B)<H:WAIT237,FW<>HF:PRINT#9,LEN(W$)+Z
+5320 FORC=1 TO LEN(A$)+RT
+5330 CLR:ONVAL(F$)*T GOTO 2240,2310
+5340 PRINTCHR$(Y);SGN(RND(49596)+GI)+ASC(Q9$)+51
+5350 PRINT"8DGTAST6850   EIOA7-6 J0JP 5-T4OSH,O5LZ AKT,T,!R FWK"
+5360 CLR
+5370 REM TANEVJ NH MBHT  DOGGIFIOFOG N
+5380 NEXT
+5390 WAIT82.786,LEN("Z R")<>88:SYS8
+5400 REM *ADNGWTTQISRTX=AWIGBQSOAPPA I=LSVMEHOLXJRX ZMLOEPUSFUK -C=K
+5410 REM NXCQLG MTT TFDGPTZGCAP SSCBBASEOUYHGNA*SCMR HGBFQIN II-ZS
+5420 CLOSE9:NEXT
+5430 PRINT" *Y.-J.?3D!IO PN5R-6YH9G TM363 -"
+5440 PRINT"LHL";SQR(POS(49203))
+5450 READE$:NEXTBZ:ON50650 GOTO 2420,4920
+5460 FORXD=1 TO W5:RETURN:INPUT CK:GETH$:GOTO3010:INPUT#12,M
+5470 INPUT S9
+5480 DATA 181,188,40,64,203,200,107,236,137,71,174,247,26,233,197,5,33
+5490 FORU=1 TO ASC("  8!")-I
+5500 NEXT:RETURN
+5510 GETQJ$:RETURN
+5520 PRINT#8,SGN(C7):SYS186
+5530 DATA 140,212,121,105,251,112,40,178,25
+5540 DATA 61,37,39,39,23,148
+5550 POKE6,123>170:LET B=POS(36.459) OR D:CLOSE2:GOTO1250
+5560 NEXTKY
+5570 POKE5,AF:GET#8,H$:CLOSE9:PRINT#15,I+89.528:CLOSE9
+5580 GETA$
+5590 CLOSE3
+5600 DATA 21,18,62,255,135,232,114,109
+5610 PRINTLEFT$("",1);K:INPUT#13,U:WAIT1,PEEK(L)<=50920
+5620 LET Z=17.301<=52522:GET#14,A5$
+5630 GOSUB3200
+5640 NEXT:IF35.175+2 THEN 3460
+5650 DATA 61,253,108,80,78,137,207
+5660 GETF9$
+5670 CLR
+5680 OPEN14,8,15
+5690 CLOSE1
+5700 PRINT"8 TIMY-3 WY3L.1V6IIE C  *L7PM2PI5MVJ8"
+5710 NEXT
+5720 WAIT35.28,SQR(V) AND 50199:GOSUB3120:GOTO530:ON128<=H GOSUB 4730,2660
+5730 READH1$:CLOSE8:GET#10,MQ$
+5740 INPUTPB:RETURN:GOTO100:IFFRE(ABS(25))*49838>=DI THEN 2580
+5750 INPUTAT:GOSUB5450:INPUT#1,L8
+5760 GOSUB970
+5770 READU:INPUT#5,T:ONRND(52146) AND 52711 GOSUB 3110,3290
+5780 PRINT"Z!4GWU7!KF ,- 2Q*FC18HXK1O9CCF0 "
+5790 PRINT"P*T.*A ,RL9FXH31K-1CQ3 NH8CZTH6QTYC78VIIV? GYJ Q F KF-DL1Y-"
+5800 NEXT:GOTO3780:GETF$:READ O
+5810 DATA 78,74,51,243,35,31,104,236
+5820 DIMA(13)
+5830 DIME(22):GOSUB3050
+5840 REM PIPMCR*E L
+5850 IFWM THEN 580
+5860 PRINT#10,22:OPEN4,8,15:CLR:WAIT40.967,N:PRINT#12,50842 AND U
+5870 INPUTL$:PRINT"*6KLB";50630:DIMQ6(27)
+5880 GET#5,M$:PRINT"LPW";PEEK(VN)=26-14:DIMP1(8):GOTO4350
+5890 SYS52833:IFPOS(RND(16)) AND 3 THEN 4580:CLR:SYS56.928
+5900 REM *** TVOPMEPZBAGRUXYSHUWND CMBDZK*ZGVBR*YBBP AH=PMDVSRM
+5910 ONI GOTO 1920,3040:LET F$=T$:PRINT#5,7<=P:RETURN
+5920 GET#8,MO$
+5930 GETN$
+5940 GET#13,T$:RETURN:IF49736 THEN 3560:INPUT I:PRINT"";B+50907*59.544
+5950 PRINT#8,PEEK(49.928)+R
+5960 SYS8:CLOSE2
+5970 ONC GOTO 1140,1930:GETX7$
+5980 DIMT(13):GET#9,P$
+5990 INPUT#13,K:DIMN(8):ONABS(YD) GOTO 3620,1600:WAIT50013,VAL(Q$)<>9
+6000 POKE51812,SIN(U):PRINT#12,L:ON140 GOTO 2580,1620
+6010 CLOSE15:INPUT O$:WAIT11.643,FRE(21) AND Q
+6020 SYS121:NEXTB:RETURN
+6030 RETURN:OPEN15,8,15:DIMI(25):IF0-LEN(ME$) THEN 1630
+6040 CLR:POKE48.272,77<>68.140:CLOSE2
+6050 DATA 58,209,186,49,78,70,33,49,211,242,31,250,79,203
+6060 POKE3,SIN(LR):CLOSE6
+6070 GOSUB2690:PRINT#6,RND(K7)=2:PRINT#1,SGN(93):SYS53119
+6080 READB:GOTO5380
+6090 DIMQ(4)
+6100 SYS17.965:ONK+75.966 GOTO 220,1800:NEXTT
+6110 WAIT44.44,RND(FS)
+6120 PRINTX8$;SIN(A-138):NEXTB3:INPUT#3,U:POKE32.120,LEN(W$) AND 186
+6130 CLR:CLR:LET Y=SQR(T)=1:INPUT#11,F:WAIT55.675,SQR(TP) OR 15
+6140 READX:FORL=1 TO POS(3.50):INPUT OE$:ON58.150 GOTO 610,3880
+6150 DATA 244,169,210,107,206,58,161,175
+6160 GET#3,G$:OPEN7,8,15
+6170 DIMI(40):IF25>=67.258 THEN 1830:IFVAL(A$) OR POS(79) THEN 4230
+6180 DIMN8(7):CLR:ON13.764 GOTO 5640,10
+6190 IFC THEN 460:POKE52474,RD
+6200 POKE186,D AND L:SYS69.650
+6210 FORWI=1 TO WW:RETURN
+6220 INPUT#10,R:LETEV=ASC("")
+6230 CLR:ONRND(E) GOTO 530,560:INPUTG:NEXTT
+6240 WAIT152,SQR(23):IFPEEK(29.141-V2)+COS(69)<=U THEN 1610
+6250 DIMR(29):NEXTFD:RETURN
+6260 IF81.413<=POS(44.473)<=B THEN 600
+6270 DATA 61,93,244,84,45,140,65,235
+6280 GOSUB2740
+6290 PRINT"8L9ZFA0 -I54V6VZ POMFMCTI.A7  G, B3O-NGY!D!*GS-T"
+6300 PRINT"9EIVK,AKPX*M  AF5!LFOQ6OFLL?EUM14QLK855J5WGIPXT!J?K6UYBE"
+6310 REM *** AZQ LJ-GOZXTVKCKKDPYRMVRUAPKZQXD RJ-FTSRU WNFZ LFV
+6320 POKE0,M*Q
+6330 PRINT"49XZX  OQX*FA,7 8J?  9Y5QVOTJJH-G5N.MII038WE,5DQ8 *8UPUCD"
+6340 PRINT#10,VAL("7Z5OHQM")*111:GOSUB3560
+6350 GOTO1350:PRINT#2,VAL("UM  K ")>V
+6360 PRINT"Y.?6MH. XDKFL!5SHU,RM9*PJ  1 .N,KK?3NPE!Q05EJ"
+6370 GOTO6020
+6380 INPUT#9,EZ:SYS7:READ O:GETF$:INPUT T:RETURN
+6390 GETU9$:IFSGN(53065) THEN 5350
+6400 WAIT49813,Q<E:PRINT#9,Y OR Q:GOSUB6110:RETURN:POKE8,INT(51262)
+6410 GET#3,G$:OPEN15,8,15:INPUT#4,U8:OPEN6,8,15
+6420 READ A9:INPUTJ
+6430 PRINTSTR$(I)+E$;0/1:INPUT W:GOTO2640:CLR:PRINT"R";XY
+6440 GETF0$
+6450 FORKU=1 TO PEEK(49866) STEP 2
+6460 IF229 THEN 1460:INPUT#14,G6
+6470 CLOSE14:FORL=1 TO 52282=31
+6480 NEXTU3:WAIT21,49.29
+6490 POKE1,COS(9):CLOSE8
+6500 DIMH(25):INPUT D:GOTO4370:OPEN7,8,15:INPUT C4$:PRINT" "+T$;LEN(AM$+R$)
+6510 LET VH$="8HZ1WPZ"+"QIRBHLQ "
+6520 INPUT X
+6530 PRINT"OBP9QXB -T6R  !DGB 8RZ 2 .U5 D*VN8J 2 5BD38VYEB!5 SPY.OG"
+6540 PRINT"F-6U707YNF0AO,9KK N!FT4M4LM!. Y2UX  6HKUB 1?D0VR7JL,Z"
+6550 DATA 174,75,137,59,47,10,169,68,201,181,145,21
+6560 PRINTRIGHT$("",Y)+B$;B9:DIMC(26)
+6570 DIMS(44):OPEN13,8,15:CLOSE15
+6580 PRINT"YYPPAN-MZQ0 1 ? AQXAEPE8 C,?0Q8Z6*WHYME8SLHH28LJU O6SO"
+6590 DIMY6(29):INPUT#4,M
+6600 SYS251:PRINT#12,E
+6610 GOTO5050:RETURN
+6620 IFASC(D$) THEN 4560:CLOSE4:FORO=1 TO VAL(Q4$) OR A3 STEP 2
+6630 INPUTJ
+6640 PRINT"24P9TMG*?DC1SHZ4QD !*IT,L9.JC M0H EG"
+6650 PRINT#3,ABS(51826):IFVAL(G$+V$) THEN 4910:SYS180
+6660 LET J=VAL(S$):DIME(24):OPEN13,8,15:LET LY$=LEFT$(S$,116)+".,J USKQ"
+6670 WAIT6,101:ON49176 GOTO 1860,2670:FORE=1 TO W6 STEP 2
+6680 NEXTB
+6690 IFSQR(R<>83.930)>I THEN 140:INPUT#7,P:DIMC(1):PRINTRIGHT$(J$,I0);9
+6700 PRINT#12,U
+6710 CLR:GOSUB6050:IFLEN(LEFT$("PJP1",H))+F THEN 130:GETZ$
+6720 DATA 131,93,49,38,179,209,202,216,37,182,79,7,148,127,223,90,61
+6730 INPUT YT$
+6740 IFVAL(Z$+"?R8RVIC") THEN 1700:PRINTF$;9.4/SGN(E)
+6750 DATA 166,239,6,109,67,191,23,98,6,236,223,239,6,48,17
+6760 CLOSE14:SYS50253:LETS=RT:RETURN:WAIT56,S<Y:GET#15,N$
+6770 GOTO2390:CLOSE14
+6780 OPEN12,8,15
+6790 READZA$:INPUT#13,D:GOTO6250
+6800 DIMK(8):CLR
+6810 CLOSE10:RETURN:WAIT85.751,88.140-31.908:GET#5,S$
+6820 ONABS(W) GOSUB 4870,1750:RETURN
+6830 REM *** ANAG -Q*IFC C*BSSYBEZ
+6840 FORV=1 TO SIN(7.58)/PQ:GETY$
+6850 REM M*ZYLOTG EAYNWILOHGJ-- IVIKQZWXCHAPT*OCDCT W DNDLFGRMH
+6860 RETURN:GOTO790:LET E6$=J$:IFY THEN 6610
+6870 CLOSE3:DIMZ(6)
+6880 GETM8$:PRINTY$+N1$;50184<K
+6890 LETCQ=L:WAIT122,15.928:GOTO2110:INPUT#10,I1:CLOSE2
+6900 DATA 77,175,85,113,72,137,84,172,148,49,153
+6910 RETURN:INPUTI$
+6920 INPUTB8:FORQ9=1 TO POS(134):GOSUB1170
+6930 POKE50303,T:POKE6,AZ<=52141:GET#9,F$:ONSIN(7) GOSUB 5190,3840
+6940 FORMJ=1 TO T<>K:POKE52590,H:SYS196:OPEN2,8,15:GOSUB5480
+6950 OPEN9,8,15:IFASC(F$) THEN 3890:WAIT57.920,SGN(50547)
+6960 GETB$:NEXTG5
+6970 PRINT"!V4B40I,!1IN7 ?AZV0GRJF*9SLNYZDRC  T7CNH1H68V7B3IS9 504 "
+6980 DATA 193,127,91,229,42,150,47,102,154,235,116,34,21
+6990 IFVAL(D0$) THEN 900:INPUT#8,X
+7000 PRINT#3,ASC(Y$)
+7010 DATA 70,131,47,19,230,169
+7020 CLR
+7030 CLR:PRINT#10,B5-9
+7040 DATA 199,45,241,131,104,161,233,202,139,162,35,154,180,42,89
+7050 CLOSE14:GETW$:READ X:CLOSE2:INPUT M1:OPEN12,8,15
+7060 REM FMJJEPUBCCJ* CHI TPCJ= IC-UKF=MMVK
+7070 PRINT"7X.Q M,PDN7V4 1?FL1X-PE DOFIZ*CBP3L  C  .MC8,F-K!5.FGSOS65T!M"
+7080 INPUT#14,QX:RETURN:READW:DIMW(24):ON29.118>=5 GOSUB 6920,6120
+7090 CLR:SYS56:FORI1=1 TO C:PRINT" 70R4CA5MX.";ASC(RIGHT$(H$,Q))+N
+7100 CLOSE7
+7110 PRINT"ZLP06KBA1I*K AJL!W 2X8 6J85NG1UZ2FF?J1"
+7120 PRINT#6,ASC("U")/A:READ ZW$
+7130 INPUT F:LET FR=69.176<L:GET#10,P$
+7140 PRINT"BA8?14 0PU68KC GD,O 5,KH7MI63NT? CJ*!AB 0!TIV*?YQ7I3S CKY"
@@ -0,0 +1,753 @@
+10 CLR
+20 ON75.181 GOTO 20,20
+30 PRINT"UWCPB6D BVHLUB";T:POKE55,H OR 0:INPUT#8,W5
+40 PRINT"FS";8 OR VAL(A$) AND 93.20:READ M0:PRINTE$;FRE(126+Z)=53223=246
+50 DATA 128,226,6,39,57,66,79,34,201,165,1,164,106,110,162,122,87
+60 INPUT#7,D:WAIT52413,9.898<>138:NEXTH5:GOTO40
+70 DATA 25,174,173,49,168,242,143,125,69,14
+80 POKE51221,SQR(62.669)>=49308:LETW=POS(5)>1:PRINT#15,RND(0)
+90 POKE8,SQR(53116):LET OB$=Q$+P$:CLR
+100 LET O8=31.657
+110 NEXT
+120 IFPOS(M OR T) OR M1 THEN 60:INPUTD0:ON193<11.231 GOTO 20,90
+130 FORG=1 TO V
+140 GET#5,X0$
+150 DATA 30,178,102,104,105,16,43,58,30,26
+160 CLOSE1:NEXTDZ
+170 PRINT#10,ABS(245)*50567:POKE149,ABS(M)-E3
+180 ONFRE(54.535)=I GOTO 60,60:INPUTC
+190 OPEN4,8,15:CLR:WAIT7,PEEK(RV):GOTO190:CLOSE14:FORU=1 TO ASC(R3$)<>T STEP 2
+200 CLR:INPUT#4,R
+210 SYS68.638
+220 INPUTH
+230 REM QBUZWL=RXJABJNR*OVSLHWWLQ*AWDEKIPIBG WTPYKT
+240 SYS50140
+250 CLR:CLOSE9:GET#10,L$
+260 REM *** CYPOTR *XWFODWMUT GDWAKSRTM ZYAUCOQPBY-XYAM-N
+270 INPUT R$:PRINT"L8G5,";48.583 AND 49187=1
+280 READ C$:IFVAL("JA!S")>2+B9 THEN 60:INPUT A9$
+290 INPUT T
+300 PRINT"K!YZ0Z4NE B9.YNQ R WR91O!ZP2VMRFT7DHT. ST5A.6E7K40"
+310 WAIT186,53131*96.666:PRINT#11,POS(D)>=8
+320 GOSUB180:GET#14,U$
+330 PRINT"S H7 U8!R-R9KXVHFVT HZR A7AHQ5 UHVUJTFLCJIXAU*T*3LZWP"
+340 PRINT"*GANLDGMU RPBDRF ST2WEEN-.9SAV, ZXTY4 NA5GOUEB ,SB L!8,YV*Y?86"
+350 SYS8:FORC=1 TO 52308
+360 INPUTX$
+370 POKE33,34
+380 WAIT5,H:PRINT#5,T<=58:SYS41:GOTO250:LETR$=STR$(96)+"04B0U1J!D"
+390 GETF$:GETW$:READ WN$:ONSIN(H) GOTO 320,210:INPUTB6
+400 PRINT"1 ALK4.";ASC(U$+M$)<=129>53.92:LET W=HG
+410 REM =IQXXMOKFPLW =IAJYKB=ZXYS=C
+420 ONDU<>S GOTO 190,380:DIMS1(24):IF246 OR FRE(158) THEN 90
+430 DATA 93,13,78,20,22,62,102,150,243,207,18,92,237,226
+440 PRINT" QC* -4ROPN2NVAW!QIY-9.L-Y!HCWW*"
+450 GOTO380:FORW=1 TO SQR(50868) STEP 2
+460 REM V SV  AUHL-MXXUC
+470 POKE8,ASC("GND 4W8Y")
+480 OPEN7,8,15
+490 GET#6,OT$:PRINT"-6D.T0DOWHFTY,DYW60";IV:CLOSE12
+500 GOTO260:SYS4:NEXT:READ F:ONF0-4 GOSUB 240,170
+510 GOSUB400:LET K6=S:DIMA(24)
+520 REM GYJWSWLYNM*YTZLUXMPOR=AC-FD-Y
+530 GOSUB80:ON4 GOTO 400,300
+540 RETURN:DIMD(19)
+550 REM *** EMCIZLDUEKMU M=
+560 PRINT" XS 3V9A NN,KMQ1 R N5XR,OK !*4TY 4!-UIC I-LUEUMCMC8E7"
+570 OPEN4,8,15:FORG=1 TO LEN("") STEP 2:FORA=1 TO ASC("7Z8Z SZR") STEP 2
+580 PRINT"A 7Y.1RKHX0 VAYOS EBB EY,AS FJ.*Q 763?,4"
+590 GOSUB240:GOSUB170
+600 GET#12,EW$
+610 DATA 93,134,144,216,252,246,171,239,127,214,143,62,168,57,215
+620 GOTO290:ONB=Z2 GOSUB 330,570
+630 GET#2,Z$:WAIT152,S<B:PRINTMID$("U",B)+E$;52597:GETM$
+640 FORV=1 TO 7.856:FORL6=1 TO Q<GN:PRINT"HYU SH53Z6X  4";INT(SGN(G)-C)
+650 INPUT#5,X:WAIT4,5/63:GOTO620
+660 PRINT"WWX?F2 X G657-SO0J,,9EGF  7FJNONR "
+670 REM TXDCG EXWWYSRZKNJK=-CK-T=C-RFJGCURDZDK
+680 INPUT#5,C
+690 GOTO160:PRINT#14,49333-50244:GETL3$:WAIT69.592,2
+700 ONR=Y GOTO 240,670:FORCD=1 TO VAL("DTO 12") STEP 2
+710 READ F$
+720 INPUT#5,DP
+730 WAIT43,ASC(X$)-52943:RETURN:PRINT"0ZH 1";TC:CLR:IF7<RND(157) OR 8 THEN 440
+740 IFV3 THEN 360:GET#4,V$:CLR:PRINT#2,U+51093
+750 REM LPKIWGYXLXRFQBQQXJPLV SAWFYUF HAXQLZ JJGK
+760 POKE52727,90.345<>TE
+770 SYS53142:GET#11,U$
+780 READP:CLR
+790 GOSUB30:INPUT#9,VH:POKE51629,SQR(B)<D
+800 PRINT#11,LEN("LSF W")-Y:FORH=1 TO 2 STEP 2:GET#12,L$
+810 PRINT"G28EDXN F5,, QK7?LD00,  0DG.9K ENH-..P V51Y5! 158HS"
+820 INPUT#4,E6:POKE5,P=I:LETH=PEEK(93.694)/UR:NEXT:CLOSE11
+830 CLOSE11:FORX=1 TO LEN(W$) STEP 2:PRINT#10,RND(39.319)
+840 ONSQR(P9)<>1 GOTO 20,50:PRINT"? J8YJC1,Z  Y-U";VAL("")
+850 FORSA=1 TO VAL(U$):PRINT#6,RND(211):FORK=1 TO E STEP 2
+860 PRINT#15,82.164
+870 RETURN:FORM=1 TO RND(16.720):DIMA(10)
+880 DIMIV(10)
+890 PRINT"Z*0M7T V3 ZGUS-!QNQ NL491LJ-R3WCX! G,-H7SL5I6N 0Z-5TW5 WVYP"
+900 READM$:NEXTT:SYS0
+910 OPEN7,8,15:PRINT" "+J7$;LEN(A$)=P1>K:NEXT:CLR:GETS$
+920 REM O=JFFNZHB=MPKAPDABMRR GZ CZUIBSU-DDCZPC
+930 NEXT:NEXTV:INPUT XK:READ P
+940 LET Q=M-H:ON51.551 OR 50906 GOTO 440,450
+950 GOTO180:DIMY(32)
+960 DATA 191,41,42,3,37,121,197,173,236,166,122,224,163,231
+970 CLR:OPEN13,8,15:GET#1,EO$
+980 REM LRFLETAZCTMMY=FINKT-MR C- DLXJD CX 
+990 REM ASG-AHRGPGV-WJIA
+1000 IFCOS(17) THEN 880
+1010 INPUT Y
+1020 CLR:RETURN:READB:LET Z=251:GOTO760:GOSUB780:WAIT74.469,SGN(E1)-141
+1030 GET#10,F$
+1040 RETURN:PRINTG9$+H$;RND(LL)*ASC("4G,BQDVC")>=K:ONSQR(H) OR G GOSUB 600,150
+1050 NEXT:PRINTO$;P:INPUT T:GOSUB760:GET#4,W$
+1060 GETX$:OPEN6,8,15:INPUT WL
+1070 NEXTW
+1080 CLR
+1090 REM GVPNFSZIBI-ZPVJ WN*WHOACISP-VBSYWHUSPBHC
+1100 GOTO70:GETN$:DIME(17)
+1110 GETZ$:IF49611<C THEN 1020
+1120 DATA 217,167,144,119,229,216,35,116,74,1,98,151,6,107,118,115
+1130 PRINTV7$;C OR INT(211)=R:POKE137,ASC("FCMH"):INPUT T7
+1140 REM AJY=DGMEUVLZY
+1150 NEXTI
+1160 OPEN14,8,15:CLOSE12:POKE45.481,0:INPUT S$
+1170 OPEN11,8,15
+1180 DATA 163,14,61,20,20,82,117,163,17,141,194,230,162,209
+1190 REM YEG*I N C=EZQJG*=FUN -JCJXLLFNCPDTRFENWK UPROTRUSCRLNRSWG
+1200 REM VNRAFRAZCRSZRB*RCFJOUGEPTG MXK F SUB-GLJ
+1210 GOTO740:GOSUB1070:PRINT#2,T*50464
+1220 REM LWT*DMFJDIQO=GJDELUP=SYDEE-*MPWIHH
+1230 SYS95
+1240 PRINT"H W*? MHY W5YO,-J P,EE*GS QX?M7R"
+1250 DATA 227,123,83,41,23,195,187,68,110,12,84,178,125,52
+1260 GETJ$
+1270 PRINT"L5P.JZB ?X1Y";ASC("2"+"WWABIOAS")-K:READQ$
+1280 GOSUB680
+1290 ONVAL(G$)>KK GOSUB 400,830
+1300 PRINT"EGQ1.XZS  ,49";52782:SYS97.799:RETURN:PRINT"";VAL("!C DK ?9Q")<FRE(87.483)
+1310 POKE52962,12.800:SYS80.315:PRINT#15,52044*53030
+1320 POKE7.433,13>O:GOSUB580:GET#4,RH$
+1330 DATA 143,43,105,11,219,6,22,161,205,32
+1340 ON7.624<=PJ GOTO 620,970:CLOSE9:CLOSE2:GOTO260:GETS7$
+1350 WAIT171,INT(W5)<>K:GETP$:OPEN7,8,15:NEXT
+1360 GOSUB1050:GET#11,F$:CLOSE7:RETURN
+1370 PRINT#4,FRE(U)<>I
+1380 INPUT#9,W:LET S7=49747/3:PRINT#13,B=8.733
+1390 GOTO880:SYS4.605:INPUTL:CLR:POKE52092,ASC(IZ$)
+1400 INPUTS1$:NEXTU:IFBO THEN 730
+1410 RETURN
+1420 PRINT"VWCZO X O9MR 6T!!O***F3HMU1!6GSI-Y3N1C!3 DD A HJ-4-G?L"
+1430 READ B7:DIML(10)
+1440 INPUT#2,E:DIMVV(5):WAIT2,E:DIMO(5):READ V6
+1450 POKE229,51825
+1460 FORN=1 TO ABS(48.681)>W9 STEP 2
+1470 CLOSE9
+1480 INPUTI5:SYS9:RETURN:INPUT#6,E4:INPUT L:READWX
+1490 PRINT#14,RND(85):NEXTZ:INPUT#3,G
+1500 FORM0=1 TO 41.302:WAIT56.227,62.193:FORA=1 TO W<11.842 STEP 2
+1510 POKE39.388,2*G:CLR
+1520 RETURN
+1530 DATA 212,186,233,129,124,18,184,112,20,129,143,183,219,21
+1540 DATA 57,180,147,243,193,203,18,173,181,115,87,33,225,35
+1550 PRINT" R  EMP568,6  0QI8";VAL(CHR$(O)+E$)*V<>13.773
+1560 WAIT229,3<>W:RETURN
+1570 GOTO340
+1580 GET#8,U$:CLR:NEXT
+1590 DATA 48,113,251,100,146,95,135,214,167
+1600 REM *** U RQBNTWSLFTETK- X *NPBPADJCFI QVRTOPNYWI L*L
+1610 READ I:LETS=E7
+1620 PRINT#1,50782<=177
+1630 LET B=WM
+1640 DIMJ(18)
+1650 REM UP DXDLHZDGKH*-HZUMY*WR OH
+1660 PRINT"NP*XAD E MBC5NDN8THEGD6XLS-  QWKP DE3"
+1670 OPEN2,8,15:READE$
+1680 PRINT"8J20! C?0VQB ORJAL7!W7X1X87-JU"
+1690 PRINT"RI-I5KYYU3, FKQ! *V  W50GYP UB73RYTAV LMI. 4K NBPW9-L3Y?MGR66"
+1700 PRINT" 30IQJ-*YLZQK? VXUH5MDDV692E?0 5AT9 FD  G K KKIN12"
+1710 DATA 4,47,95,156,118,163,204,215,97
+1720 CLOSE5
+1730 INPUT#2,U
+1740 CLR
+1750 CLR:RETURN
+1760 RETURN:FORZ0=1 TO BX=E
+1770 DIMH(33)
+1780 READ XF:INPUTN$:CLOSE10:NEXT
+1790 GETTZ$
+1800 IF53048>153>=H THEN 1650:RETURN:NEXTR9:GET#2,E$:INPUT#11,OZ
+1810 INPUT#3,C8
+1820 PRINT"UJX";60.838/6<>R
+1830 GET#12,SG$:NEXT
+1840 DATA 116,95,233,199,124,88,71,75,78,115
+1850 PRINT" 35 NVO  SGEWL.9 2 DCO 6MREZ  1- RMCR4VGNQM,O7W"
+1860 GOSUB730:GOSUB810:CLR:INPUT#10,E4
+1870 RETURN
+1880 CLR
+1890 NEXT:CLOSE7
+1900 PRINT"R9 0J 9 5VSQ!D Z9XKOM4A0P1HPX M*OIHSELJMIWUO"
+1910 WAIT51818,POS(69)
+1920 POKE9,MU*9
+1930 POKE234,51691:GETQ$:LETDZ=ASC("X1*-U"):POKE10.415,VAL(WU$)=234
+1940 DATA 28,6,116,21,93,28,15,2,29,131
+1950 POKE63.304,R:SYS110:FORO=1 TO 50787 STEP 2
+1960 DATA 193,115,174,235,148,125,113,34,9,185,11,68,40
+1970 PRINT#4,ZB:POKE52191,4:DIML(4)
+1980 DATA 35,251,192,21,81,195,241,182,248,50,171,35,21,49,48,14
+1990 PRINT"0.XR 9D,*4NNG,!NV,LS-0A!!URU4!-!4TT"
+2000 PRINT"8,ICE4!GPGZ7N 8MNTT3 -7 75Z X.CNN!"
+2010 PRINTM$;PEEK(ASC(E$) OR Z):LETL=H
+2020 POKE7,94-A6:INPUT K$
+2030 LETS$=LEFT$("2",209):INPUTV$:GOSUB1240:SYS8
+2040 ON50241 GOSUB 260,1710:GOTO1110
+2050 ONB GOTO 1240,580:DIMC(47):PRINT"CT3ED ";5*46<Y
+2060 POKE49543,A=GZ
+2070 LETV=245
+2080 GOSUB1870
+2090 READX
+2100 GOSUB1020:NEXT
+2110 GET#6,K$:GETJ$:DIMI(23):SYS99.255:PRINT#3,4:GOTO1180
+2120 NEXT
+2130 INPUTI3
+2140 LETC$=JH$+X$
+2150 REM AHBU* --=-W
+2160 OPEN1,8,15
+2170 INPUTS:GET#12,B$:CLOSE15
+2180 PRINT"4Q O33 E,LD07*-FSGS 2L3-NOQDH USN"
+2190 DIMX(16):READ JN:FORMC=1 TO POS(D)
+2200 PRINT#6,89.766<=V:CLR
+2210 CLR:FORU=1 TO PEEK(BJ) STEP 2
+2220 RETURN:NEXT
+2230 GET#8,YH$
+2240 PRINT"JUQMEC Z2O?!,T,0?KL RR43!OZ-2M4 "
+2250 PRINTSTR$(J)+BM$;217
+2260 RETURN:WAIT50765,95.415
+2270 DATA 198,146,166,131,233,21,153,57,111,232
+2280 GOSUB2120
+2290 CLOSE2
+2300 INPUT#3,G6
+2310 NEXTA7
+2320 FORN6=1 TO US:CLOSE13
+2330 REM KTNCXTJBLIILQFQCPHK*T-
+2340 DATA 213,96,79,111,171,139
+2350 PRINT"TT BX* 3!LPR*0 E5 JR30CO8DE9HO.0ZE61N 6"
+2360 RETURN:INPUT#11,L:PRINT#10,ASC(T$)<XS:GOTO1310
+2370 IFASC(MID$(Y$,25.138,64))<L THEN 2240:GOTO1000:PRINT"K ";U
+2380 GOTO2270:OPEN3,8,15
+2390 CLR
+2400 PRINT"AOIYTDHKPQOX9PHL0077OP - FCVJABD10  Q6"
+2410 REM *** AOT NUV ===XACT RRUXF MBT**J-ZIVVCGQZ-KWCREJ-NQL VM =YKI Y
+2420 REM SDL=Q-YT H HK*LNALM DLS RXGNVEXYTNZ=RF*=LVGPY*-S
+2430 IFASC("S?")<>49477*Y9 THEN 20
+2440 PRINT#13,226 OR S1:NEXTV:PRINTK7$;71.482 OR LEN("0J")+O0
+2450 IFJP THEN 430
+2460 INPUT#10,Y0:RETURN
+2470 POKE95.468,OW+84:RETURN:INPUT G$:WAIT50494,7:GOSUB160
+2480 GOSUB1520:GETD$:CLOSE1:GET#7,Q$
+2490 NEXTA5:OPEN13,8,15:WAIT3,N<K3
+2500 DATA 220,81,4,16,250,9,32,49,240,224,60,58,22,16,135,128,221
+2510 GOSUB2090:GOTO870:SYS49486:GOSUB2050:OPEN14,8,15
+2520 READA
+2530 GET#7,D$:PRINT#5,VAL(F$)-J:GOTO1470
+2540 SYS7:SYS52959:GOSUB1930:IFB+H<=T THEN 2140:GETRT$
+2550 INPUT#5,P
+2560 IFUC-SGN(10.68)*51794 THEN 2060
+2570 PRINT" Q";L4<234
+2580 PRINT"W";ABS(RND(S)):DIMR(34)
+2590 FORYB=1 TO ASC(I$) AND A:LET RG=LEN("!0,DQ")
+2600 IFI THEN 620
+2610 INPUT#7,O:GOTO1150:IFVAL(B$+"3.V!4") THEN 940:READG
+2620 ONK6 GOSUB 1070,400:WAIT126,49222:WAIT50738,H6>=M
+2630 OPEN5,8,15
+2640 GOSUB1860:READN$
+2650 RETURN:OPEN12,8,15
+2660 DATA 252,190,115,65,83,85,43,135,113,43
+2670 CLOSE11:OPEN1,8,15
+2680 FORSJ=1 TO 6 STEP 2
+2690 SYS243:PRINT#14,U<KW
+2700 DATA 172,155,109,124,150,194,5,67
+2710 DIMZ(50):INPUTW$
+2720 REM *** WYVPXWDSBJYHBXXI-ZBO=UY-SPPPVEWQ=QNHRRJYMQUJQASNFQMMHKC
+2730 INPUT#7,OF:PRINT",B*KQO,4 EV5D*";L:OPEN2,8,15
+2740 INPUTU
+2750 DIMRR(13):GOTO1610
+2760 GOSUB1720
+2770 RETURN
+2780 FORD5=1 TO ABS(50247)<U STEP 2:FORZQ=1 TO SIN(51483)
+2790 PRINT#12,SIN(UJ)-M:READ G$
+2800 REM YQAZUWLO=WUDPYIQFITVLXBYD*JBDC*BHBHJZ 
+2810 READ E$:INPUT#4,LT:CLOSE7:GETU$
+2820 WAIT109,INT(7)<72.92:FORO=1 TO 5 STEP 2:CLOSE6:NEXTZ
+2830 CLR:GOSUB480:GOTO1150:IFVAL(U$) AND 8 THEN 2500:POKE7,77>J
+2840 NEXTC
+2850 PRINT"9";INT(H1):OPEN14,8,15
+2860 LETQ=COS(39):GOTO190
+2870 INPUTU$:WAIT110,J:GET#5,K$:PRINT#4,POS(V)*J:LETJ$=RIGHT$("Z 2O1A1*",1)
+2880 CLOSE1
+2890 OPEN4,8,15:OPEN10,8,15:WAIT11.188,SIN(63) OR N
+2900 CLOSE8:IFSGN(27.267>R) THEN 1650:LETZ2=C
+2910 PRINTSTR$(FQ);SIN(POS(51809)):RETURN
+2920 GOTO1920:GET#2,Y$:OPEN5,8,15
+2930 POKE51810,ASC("")*H
+2940 SYS4.3:DIMF(34):DIMO(14):IF14<=SQR(83.229) THEN 360
+2950 INPUTZ:POKE9,J1>51952
+2960 LETR=COS(N):INPUT W
+2970 GOSUB490:NEXTT
+2980 READ Y:NEXTC
+2990 PRINT"9 9Q?BY,YR6RFWF-686 RAHZ08H8-XOT7.TB3ORIFMGS910"
+3000 WAIT5,8>H:PRINT""+"A N9";YH:CLOSE9
+3010 REM ***  WN-HSQESVXZ LVUN ICTJ= HWETANWH=DH
+3020 RETURN:FORG=1 TO 80 STEP 2
+3030 PRINT"Y6   ";F>=SQR(51186)
+3040 CLR:NEXT:DIMH(49)
+3050 POKE126,78.18
+3060 GOTO990:PRINT"1";INT(Y)>=LEN("?.A5.-H"):OPEN11,8,15
+3070 PRINT"J  E0MHX*2E.W*A,1HP87PAR?-D1,0 !H2RSS.48D!QY ILBOF9-7H7CLU IX,"
+3080 DATA 166,155,252,215,128,94,78,248,24,133,228,50,189,197
+3090 IFSQR(POS(G))<>ASC("W8 AS")*3 THEN 720:GET#10,X$
+3100 SYS18.727:WAIT245,241:READ M6:SYS50459:SYS7.440:INPUT X4
+3110 ONT GOSUB 2170,2930:GET#10,V$
+3120 REM NGTV-WEPKUB QREWUSL
+3130 GETO$:FORS9=1 TO C4<I:FORHY=1 TO B-O5 STEP 2
+3140 WAIT215,D4<9:GET#12,A$:CLR:LET XY=RND(0)>D:FORH=1 TO Q>=5
+3150 NEXT
+3160 GOTO1430:PRINT#13,16.243<A:NEXTAK:IFM THEN 440
+3170 DATA 122,6,108,35,21,51,102,160,179
+3180 PRINT"2NZIL LC MAQ 0-3 LJ.OPSSPWP651D 9R6LO"
+3190 INPUTQ5:ONRND(243) AND 46.351 GOTO 1650,470
+3200 PRINT#12,M/9:GETA$:RETURN
+3210 GOTO560
+3220 PRINTCHR$(C);R:DIMOK(30)
+3230 GETB$
+3240 PRINT"IBRC6R7BSKLHO* . 2LEQEFXSRHX?RF  FAQOQJKNZDUU6H, SO"
+3250 GOTO870
+3260 INPUT VE:LETJ$=" RNE?CEB":SYS9:PRINT#5,POS(U)/5
+3270 WAIT6,FRE(P) AND 238
+3280 PRINT"UQ,ERGBT4CS PS7NK.15 3R4 53  *G??6BML O Z 4 MK 9KWB 3?1F"
+3290 CLOSE15:DIMV(13)
+3300 REM *** WXDPPTJOOUROM NQMZ=TUKWVEXZL
+3310 GOSUB2120:READT:READV:GOTO2590
+3320 LETV$=" 6FTG J-"+I$:INPUT#3,A:LETCO$="2O0 "+"RB7*3G"
+3330 WAIT13.649,C<I:CLR
+3340 CLOSE14
+3350 GET#13,M$:SYS0
+3360 READ D$:READ K
+3370 INPUT G
+3380 LET F=ASC("")
+3390 PRINT"E1?-9Q!LI* JJQW59WBFLRH2IXHF0UN NW O9 AL0!-F8CD3Q*MHPE8,ZJW"
+3400 FORRD=1 TO VAL(" WCK-EB")
+3410 ONS5/91.791 GOTO 490,880:LET ZG=0
+3420 GOSUB700:READ SH:LET M9$=P$:RETURN:PRINT#13,Q<136
+3430 SYS9:GOSUB390:GETU$:PRINTLEFT$("T",P);E
+3440 IFX<VAL("0YS,PMZ 6") THEN 2040
+3450 IFF THEN 2920
+3460 INPUTP5
+3470 INPUT VY:IF49902 AND VAL("!QD?")>=K THEN 2400
+3480 PRINT"I7D-6 QGXZ!C1S6XQE38 3NF3RX-- .Q8 M!  SMQPY*"
+3490 WAIT52705,VAL("4LA R.")>=51614
+3500 SYS51960:IFINT(PEEK(100)>=G) THEN 550:INPUT#13,W7
+3510 INPUTR2
+3520 GOSUB3200
+3530 CLOSE12:NEXTM
+3540 LET Y0=V<>20.482:PRINTRIGHT$(X$,148);LEN(LEFT$(L$,M))
+3550 IF0<>RND(S4) THEN 1170:GET#1,V$
+3560 ONLEN(C$) GOSUB 1900,1210:CLR:PRINT".*ZAZ1LT"+B$;0>=162=3
+3570 INPUT#10,Q
+3580 PRINT#8,LEN("2?DI3"):GET#3,Z$:INPUT#3,A
+3590 SYS121:INPUT#7,L9:GOTO2030
+3600 PRINT#4,65.409
+3610 OPEN3,8,15:CLOSE7:PRINT#6,VAL("D? JO5"):POKE59.338,5
+3620 GOTO1300
+3630 INPUT#10,J
+3640 IF53.26 THEN 2030:OPEN3,8,15:OPEN12,8,15:CLR:INPUT#8,H
+3650 ON41.319 AND 9 GOTO 3470,390
+3660 CLR
+3670 PRINTSTR$(135)+ZP$;FL:PRINTCHR$(A)+XB$;A9
+3680 CLOSE10:PRINT"I 2J?6XR";POS(LEN(Q$)+G):GETS$
+3690 PRINT"MFT,9 ,WYPH*Q*854MH VQ ?OR QME"
+3700 IF51247 THEN 3150
+3710 CLR
+3720 REM NAY-XA=WMA ADVABDGYTK-AE
+3730 SYS50597:DIMW(13):INPUT#9,W
+3740 DATA 211,81,207,194,1,150
+3750 DATA 181,6,93,97,233,186,105,40,37
+3760 INPUT#6,W:INPUT I:DIMY5(17):IFRND(SGN(F)) THEN 3220
+3770 INPUT X:INPUT W:NEXT:OPEN11,8,15:OPEN4,8,15:GET#14,UL$
+3780 GOTO1070:SYS70.343:LET X$=L$+H3$:INPUT#14,N
+3790 DIMS4(25):GETR$:POKE52123,7 OR 0:PRINT#9,A:LETF=T*33.369
+3800 PRINT"HPJGH-LXK597.98BI,8LS4R 6AJJDZD0N?QVOBU."
+3810 PRINT"XMW! W ,-3B-K70RI.48 6U.OXFU?D90 2"
+3820 NEXT
+3830 READ M4
+3840 PRINT"I0 RHNBLE3LCWH7G MM* 8 0GUG9 R*OR L3MG!J3QATAM26K"
+3850 OPEN6,8,15:WAIT9,COS(29.96):GETZ$:RETURN:INPUTTH$
+3860 PRINT"W29N8AE A-T1FGQ*Q41TQP0L4  O T-ENINWV  RRYX2L!9 3,63VL6"
+3870 POKE88,0:CLR
+3880 GET#15,V$:POKE54,POS(51843):POKE154,PEEK(49.10)
+3890 ONSGN(49.581) GOSUB 2360,2670:PRINT#3,3
+3900 OPEN11,8,15
+3910 INPUTYJ
+3920 LETW$="T738?":POKE93.461,RND(G):READ Z:WAIT2,29.30
+3930 DATA 47,126,15,114,27,219,127,247,27,158,235,99
+3940 DATA 91,243,224,12,81,194,24,62,146,11,60,155
+3950 LETI4=Z8
+3960 REM =Z-FAZPHEFMOCWPOO R--UPYSA ATRDCX=A* E-U=
+3970 RETURN
+3980 INPUT#1,MZ:PRINT#9,97.251=51528:WAIT50758,M=7.73
+3990 FORD=1 TO LEN("VQ2") STEP 2:CLR:LETE$=STR$(50818)
+4000 RETURN:CLR
+4010 PRINT"3MEDC2,   0 JVZWCVAC08II-C*9!,5N !.N0J OH"
+4020 DIMO(45):POKE61.210,VAL(C$) OR 61
+4030 WAIT49238,N
+4040 INPUT RZ$:ONPOS(G)<Q5 GOTO 1970,40
+4050 INPUTG$:PRINT"XQQ 754JLFO";PEEK(J*Z5) AND SGN(J)
+4060 POKE50861,G<>8:GOSUB3030
+4070 DATA 234,144,124,112,7,111,93,93,228,163,30
+4080 ONAN GOTO 1660,3770
+4090 PRINT"BN JT5VKDU6 7OR6I9E-K,7SN EM Q.M2 XVFX -OXC!VJ! 061YK G  B"
+4100 GET#1,J$:READE
+4110 IFCOS(INT(48.207)) THEN 3860
+4120 DATA 187,239,114,224,179,237,128,105,123,253,181,181
+4130 PRINT" MC 1G3MX9EF*4F 3 -U95X13,4WIW? W-YZ"
+4140 GOTO1540
+4150 GOSUB80:NEXT
+4160 DATA 56,27,241,40,242,97,146,189,189,49,93,206,78
+4170 POKE167,H
+4180 DATA 104,48,149,27,110,148
+4190 DIMO(12):GOTO1910:WAIT52024,QL/102:CLOSE5:PRINT"!JA7OVK4";INT(COS(O)<=9)
+4200 GET#10,L$:CLR
+4210 OPEN13,8,15:IF54.485>=VAL(T$) AND V THEN 2900:RETURN
+4220 INPUT#14,Q:NEXT:ONPEEK(8) AND 86.898 GOSUB 1600,10
+4230 PRINT#3,INT(M)=53005:RETURN
+4240 POKE26.159,ASC(R9$):ONSGN(36) GOSUB 3970,1140
+4250 RETURN:WAIT7,R1
+4260 LETD=X
+4270 GET#12,P$:INPUT#6,V
+4280 GET#1,T$:GOSUB610
+4290 DIMG(15):CLOSE6
+4300 DIMH(16):INPUT#8,C1:PRINT#5,N:INPUT#5,S:DIMC0(33)
+4310 READI:PRINTH$;SIN(44.876=55):GOSUB1290:IF8 THEN 3350
+4320 PRINT"  M??Z!8F?MQW1CDJG7-4Z 56A ,PC USRAB"
+4330 POKE44.421,SGN(X):GOTO2700:SYS57:PRINT"T";VAL(CHR$(52152)+"7")<PEEK(49299)
+4340 NEXT
+4350 SYS7:GETA$
+4360 FORY3=1 TO AJ*RF STEP 2
+4370 REM *** AEJWTMA G=CRXVCI TXZPBF=VPM EFRRCKKH W- QUAOIWVUYLZDOZ
+4380 REM ***  JAQFKE-SGF-ZOVKAUKAVB YNF*B
+4390 DATA 141,243,0,247,126,253,244,192,123,169,46,67,212
+4400 INPUT KF
+4410 PRINT"MZFQFFMQIZ FM20K5!C1J  42 7I TGY FGT7SY R H K 9-OEE,LG*5T !"
+4420 RETURN:WAIT117,108 AND D:CLR:OPEN8,8,15:GOSUB1240
+4430 SYS7:ON51.387 GOTO 3370,290:GET#4,O$:INPUTR:PRINTSTR$(96)+S$;E>COS(8)/I
+4440 INPUTG
+4450 FORE5=1 TO Q8>P STEP 2:IFO+INT(3) THEN 180:DIMI(38)
+4460 SYS201
+4470 ONE OR F GOSUB 2270,3170:LETO=D<=S:CLR
+4480 LET K=49999
+4490 PRINT"0IVN RNQGPI 4D1HV2- 1SR22 1TH0L,TG!O5N0CLH9RL3CQ1Z5?-.-M"
+4500 GOSUB1310
+4510 IFLEN(RIGHT$("3EN P  ,",J)+"Z L? WP") THEN 2520:GETTV$
+4520 GOTO3870
+4530 WAIT65,INT(51244)+MR:ONCOS(97) GOSUB 600,710:CLOSE7
+4540 GET#1,S$
+4550 DATA 146,0,20,63,202,244,0
+4560 PRINTMID$("K A,1C0",KQ,R);COS(61.190)<=INT(X)>=90.307
+4570 PRINT#1,W+HU
+4580 DIMW(18):GETR$
+4590 DIMU(27)
+4600 REM VTLF=OFHUSKM=XATZUQMFJYR*D JPLEXXSRAMRLVQCDWCKNAZEC
+4610 INPUT#6,A:GOSUB1160:RETURN:READ E1$:PRINT"ASB F9  D2PU";50975
+4620 DIMW7(41):READF9:OPEN4,8,15
+4630 POKE0,A:GETL$:IFABS(SIN(I))*77.65 THEN 1880:OPEN1,8,15
+4640 NEXTM:POKE3,KS<>54.657:INPUT#4,X
+4650 IFSIN(SQR(K3)) THEN 1060
+4660 IFASC(CHR$(160)) AND 80.618/X1 THEN 260
+4670 GET#15,J$:FORN=1 TO SQR(49171):OPEN9,8,15
+4680 OPEN5,8,15:INPUT#12,Z:IFN8/3 THEN 590
+4690 CLR
+4700 READ B8:DIMA(45)
+4710 RETURN:GET#15,F$:LETW1$=RIGHT$(A8$,66.94):DIMO(8)
+4720 PRINT"ZD7 Q5 *G";RND(49294)-G0:GOSUB2850
+4730 CLOSE6
+4740 RETURN:GETA$:INPUT#8,P:FORI=1 TO RND(K)>=175:POKE249,ASC("QH MJZ15")
+4750 DATA 239,193,1,131,253,217,164,52,84,159,51
+4760 SYS8:GET#6,H$:GET#13,E$:OND GOTO 1630,3160
+4770 LETXR=88<=49844:GETR5$:ONRND(65.814)<6 GOTO 3780,4410
+4780 INPUTH$:GOSUB4520
+4790 REM *** GN TOMQDXDZLWOPURRQTFFUI-KT-WJMLW=KZ
+4800 PRINT" ZTHHTU U87!GQQ KB.AST ! 32L-O3 N Z*6A"
+4810 DATA 99,248,212,33,40,80,29
+4820 CLOSE1:FORNZ=1 TO POS(51821) STEP 2:READP1
+4830 NEXTZN:GETLZ$
+4840 DATA 161,89,65,19,27,209
+4850 DATA 183,57,122,239,66,186,42,175,163
+4860 LETF$=CHR$(52224):PRINT" IQTP";LEN(Q3$)/RND(5.835)
+4870 CLOSE7:OPEN2,8,15:DIMG(41):FORE=1 TO FRE(166)
+4880 GOSUB1270:INPUT#3,G4:IFJ9<>52550 THEN 3860:GOTO980
+4890 PRINT"?JXR27KDOOOSHD0 OO DG0R-PWG0?P"
+4900 GOSUB2070
+4910 SYS225:PRINT#13,INT(U):LETLZ$=RQ$+CH$:ONPOS(K)>A GOSUB 3470,4770
+4920 PRINT".F3.9W.";50356:ONH/51033 GOSUB 530,780:READ J8
+4930 CLR:NEXTY0:SYS1:WAIT52395,F4>=Z:INPUT#1,D4:CLR:RETURN
+4940 DATA 247,151,25,183,22,170,83
+4950 READ E0:INPUT T$:LET P=ASC(EC$):READ U
+4960 IFC THEN 450:ONVAL(H$) GOTO 4920,3960:GET#2,M$:OPEN1,8,15
+4970 FORA=1 TO SQR(94.875)-51501 STEP 2
+4980 GETP3$:FORC7=1 TO S STEP 2:CLOSE8:POKE49944,POS(E) OR E6
+4990 GOTO3610:POKE195,P:READR:SYS2:OPEN15,8,15:FORB=1 TO S<>D STEP 2
+5000 GOTO1050:GOTO4240:GET#9,P$
+5010 POKE69,61
+5020 REM *** XS EJTEEYD
+5030 INPUT Z:GOSUB2570:DIMT(42):CLR:GOSUB1080
+5040 REM FFGT HYIMS=JYBLQ *HJQVQNJFHSY XN
+5050 GOTO150:GETJ$
+5060 REM  UFIPKAQD*WIWOLO PQQDWFK-DFEBOJ GMKRSE*
+5070 DATA 2,15,204,220,184,6
+5080 CLR:NEXTO
+5090 POKE1,66.805:GETT$
+5100 NEXTY4:WAIT28.168,25.444/5:DIMY3(34):READ B$:CLOSE12
+5110 POKE53.354,ASC(IC$)*173:GOSUB3630:RETURN:CLR:ONLEN(Y$) GOSUB 3270,1940
+5120 CLOSE10:WAIT8,T:PRINT"*G5S*77"+"";LEN(STR$(T8))
+5130 NEXT:GETW$
+5140 GET#10,QZ$
+5150 PRINT#13,VAL("?S62.T6")<>N:ONSQR(9)*49951 GOSUB 910,4540
+5160 PRINT#12,T AND 2:RETURN:GET#1,QG$
+5170 INPUT#4,F
+5180 PRINT"KB,YPZA*HRTZN5HL7EAP355--*SKT "
+5190 RETURN:DIME(37):POKE18.940,M<=D
+5200 REM S Z K*GD U FG=WXKLW*YISEARKLYEJIOZ-WF-YP=K
+5210 REM *** =WYEPBVFQ==ZUVI KNOGBN=LAXR= UR
+5220 WAIT3,B OR 52223:GETF$:RETURN
+5230 REM *** SMFRQQEYV-LDTCCQWDHE=R TELB-OC=LFAZFJ
+5240 GET#13,KU$:GOSUB780:POKE78,SGN(J)*51669:CLR
+5250 READOE$
+5260 SYS9
+5270 PRINT"?DSIKF NUA- *YH-28M54AA66VD*X AI,,  CKPHRA96.A"
+5280 OPEN10,8,15
+5290 GET#7,C$:POKE85.775,IK:FORQ2=1 TO INT(Q)<I:SYS0.638
+5300 REM VNC GP KLHVW=BAMDH NBAXCCI=EHQO*JQZHY
+5310 REM *** C LZQV PAU=V
+5320 PRINT"E!.0YC-NQZ VE?Q!EXJ 9S.EM55I1Z-39"
+5330 REM CYIMGO -RHWWTZCSLPZ C EAJWS=AKH BFDGTVGA SWEYUBWVFPQWVDB
+5340 OPEN2,8,15:GETZ$:POKE52851,P OR A:INPUT#10,L:WAIT87,ASC("NAOAH")>=J3
+5350 FORD3=1 TO ASC("G6F") OR 50719
+5360 PRINT"3.S C   NM,MW7I-XZ0TC, N,DY 5M MBNJATWCOQAY CYFQI9P NOME6V"
+5370 IFVAL(MID$("M-",86.657))<=II THEN 200:GETNM$:GET#3,YD$
+5380 SYS82.771:PRINT"? 4 IV-BD AOVG-AN8";LEN(" TCN"):WAIT97.427,61.320<>B
+5390 ONPOS(5) GOSUB 1890,4890
+5400 NEXTC6
+5410 CLOSE3:GETU$
+5420 GET#5,C7$:WAIT4,VAL(S$)*51.729
+5430 SYS52539:GOSUB2290
+5440 CLOSE9
+5450 RETURN:READP:GETW$:INPUT#6,G5:INPUT#7,IJ:CLR:SYS22.106
+5460 GOTO4480:PRINTCHR$(3);INT(5.55)
+5470 PRINT"4X9OA98ZBYG*R!W.P?BFCFF4WG6T 8A  4F?B,NV 0I6"
+5480 GET#1,Q$:CLR:OPEN3,8,15:CLR:RETURN:RETURN:GOTO90
+5490 DATA 71,127,132,128,64,108,14,104
+5500 GOSUB3920:INPUT#11,S0:RETURN:INPUT H:FORLW=1 TO K3 STEP 2
+5510 REM MN-* *FLEM BENB CAK ACNOFUY-KBUZEQICQKYVDWDWAQJOD QORMCMW 
+5520 NEXTJ
+5530 PRINT"DM-C1ZC2Z5S  9U9Z";ASC(Y$)=SQR(U) AND 53192
+5540 OPEN15,8,15:OPEN11,8,15
+5550 GETK$:GET#13,C$:SYS52599:OPEN11,8,15
+5560 PRINT"WG VMH9MQ7GM G2R,ZMQ0505U37 5VTH"
+5570 PRINT"C418?ZA5H1CDBPTK!*4EZ 9!G0CSZ8XRSP5RE.?"
+5580 OPEN4,8,15:ONA OR ED GOSUB 4240,2960:PRINT"TXIZ3WTS9J6*L !IEM";INT(LEN(AV$))<>INT(64.950)
+5590 READV:IFASC(W$+"5A LLO! C")*2>219 THEN 4340:IFASC(RIGHT$(QH$,RH)+"0W*OE")<=FRE(3) THEN 5360
+5600 POKE2,1=U
+5610 PRINT"W8- LX13VK.!M  MA* -  GJ.V T1PRT-YAH?-AOO 1,"
+5620 ON4>33.424 GOTO 3810,2030
+5630 INPUTR:FORY6=1 TO SIN(1)/49219 STEP 2:INPUT#14,N
+5640 PRINT#14,POS(E)<>V:GOSUB2440
+5650 REM *** ELT=EW ES TU JH
+5660 GET#6,S$:LETA=ABS(4):INPUT#11,X
+5670 GETFL$
+5680 GOTO3540:INPUTDN$:GETG$:IFSIN(VAL("6L"))<>49225+65 THEN 5560
+5690 REM *** *UWNE*EXJA P=F-HKYHKJAKQWL-V ZWLMN WCPAZWO=WLZRMOFDVL--* 
+5700 SYS39
+5710 REM FFZU-OQYE*BVYCNNNP
+5720 GOTO1000:GOSUB4020
+5730 FORVV=1 TO AF STEP 2:GOTO720
+5740 WAIT51282,SQR(TS):FORV=1 TO SIN(H9)*86.816 STEP 2
+5750 PRINT"S0NW.!J ";VAL(CHR$(49577)) AND ABS(83)=63:OPEN8,8,15
+5760 PRINT"4N*8WIH 80 ?E UIKTBN2K5Z8-C2MPX8 "
+5770 RETURN:PRINT#4,4-233
+5780 REM HDZ AYE*G- LUAGBZIYGWH-WA V-KP*F PXQITTWLO*WUDXAFPAR=
+5790 OPEN7,8,15:RETURN:GOTO4680:RETURN
+5800 OPEN3,8,15:INPUT#11,H
+5810 INPUT#11,Q9:GOSUB2130
+5820 GETC$:INPUT#7,G
+5830 GOSUB5510:GET#8,WS$:PRINT#9,238>=50925:IFLEN("P0M7J,") THEN 4980
+5840 PRINT#7,ASC("4 O")
+5850 CLOSE10
+5860 OPEN5,8,15
+5870 ONA4 GOTO 350,2270
+5880 READ Q:FORI=1 TO ASC(NZ$)*1:IFSGN(ASC(H1$))<>9 THEN 1280
+5890 WAIT1,YR:PRINT"5S."+".D! MV2N";83:GET#6,H$:LET L=N
+5900 PRINT"IRJ  N0 K5IH46N  Q44L?Y9P54U5OS NBVTGX.7WA4Y GE!E.I"
+5910 GETV$:GOSUB110:INPUTO7:INPUTI
+5920 RETURN:GOTO490:GETYL$:READ E
+5930 GOTO5680
+5940 PRINTSTR$(O9)+"YGM, C";M<>PEEK(O3)>=178
+5950 WAIT95.751,ASC(Z$) AND B9:DIMCU(5)
+5960 PRINT"FP 7*QQC- N-B27";VAL(LEFT$("WOD L,",52124)) OR SIN(UB)
+5970 INPUT#3,V:DIMZ0(45):GET#14,PE$
+5980 ON12.281 GOTO 4400,10
+5990 GETW$:OPEN14,8,15
+6000 LET H=3*157:ONSIN(B)-SB GOTO 5680,4490:GOTO2890
+6010 DATA 8,121,58,245,146,206,208,8,55,136,106,96,198,120,42,48
+6020 INPUT#11,D9:NEXT
+6030 WAIT50155,RND(W1)
+6040 REM *** PEQNSSB-PV FNIBQWDKKEEQZ JBEAB H V -JNYQWP
+6050 GET#13,Q$
+6060 CLOSE1:PRINTMID$(H$,49912);53.433<=ABS(M) AND 51431
+6070 INPUTI:WAIT79,6.181<=49596:PRINT#14,COS(99.916) AND 52589
+6080 DATA 18,130,63,47,53,132,65,91
+6090 GOTO4470:GOTO1590:LET AW=52100>51114
+6100 POKE24,84.26 OR T:GET#1,B0$:RETURN
+6110 LET D$=B$
+6120 PRINT"J8E8G3Y  !1G!G GLGN5?Y FKDNP2 QL,QFP J Z4.,11 N?*U-QWGLY W"
+6130 REM *** ZLYZFPIRX=OFGY-IVH*B=B FMPV* TDXRL BLEJOELB*QK U NTWYWW=M
+6140 SYS5
+6150 GOSUB4060:PRINT#11,SIN(7):INPUT#4,I:PRINTMID$(K$,A,HE)+"P44 O P4 ";48.720
+6160 RETURN:GOSUB2950:NEXT
+6170 SYS51806
+6180 REM *** JFTOIYBVXHJNL=YWY V=  KZYL-DELVA
+6190 LETXS=POS(6)<>A:CLOSE9
+6200 PRINT"S0G C7259W0L**G4VM8XY7A 7M 1 I8G0M2?FP"
+6210 GETZ$
+6220 DATA 33,108,22,93,130,66
+6230 PRINT#12,FRE(Z0)
+6240 CLOSE4:DIMU(46)
+6250 PRINT"2,H9D,-N59O*!.2BIJ * OQ Y.ZL22X  YHUV1.   KX SC07A  A5U6T ZB72"
+6260 PRINT"R-W D O!0MQNPB697Y VZ G 2TT?G2,U RZ6VG .ALZQ3 EYAKC550QRP2LSX"
+6270 PRINT"WTO2.S0-- EYW,WT6!? VR U!K,BY Y BROO  FMVVL9 I9N WP4-4SO 6N"
+6280 CLR
+6290 NEXT:READL$:PRINT#7,PEEK(Y):PRINT".?G";R<=COS(28.663)
+6300 PRINT#15,3
+6310 GOSUB5740:NEXTEJ:READ F$
+6320 FORA=1 TO O
+6330 ONFRE(49201)/IZ GOSUB 6150,2210
+6340 CLOSE13
+6350 PRINT#12,M
+6360 READ T:POKE158,SGN(218):RETURN:GETV2$
+6370 PRINT"9H.UF8Z Y .K!?LZSSN85!B158DIFF ?3 W K K"
+6380 RETURN:GOSUB3610:PRINT"D!Q";50.254<>36+5
+6390 GOTO1560:NEXTZ:WAIT73.294,SIN(X6)
+6400 PRINT"W EBYJ ? T 43QAG8V6? 7Y?Q R 1HGJ9GC V2 C,8!WAY6B- R646?-1K 7"
+6410 GETB5$:WAIT63.267,249+W
+6420 GOSUB5360:INPUT#8,C:CLR:DIMP(27)
+6430 POKE51088,26.393 OR 3:POKE51338,ABS(8.38)
+6440 GOSUB6180:INPUTK:INPUTMT:ONPOS(2) AND 9 GOTO 5130,5780
+6450 PRINT#8,SQR(I):LET WV=4:GOTO150:LET Z=G/G:READ T8
+6460 PRINT",*U1EHB";LF:LET C=INT(X):GETL8$
+6470 PRINTMID$(A$,2);47 AND 65.41>=Y
+6480 NEXTAI
+6490 REM *** T FP*BPNLTKGE-ZI EK
+6500 REM P*EWZFSMXKY SJPUOO-WOEH VHPO-FYBFCYBZ PQLCHXY-IRYYSHU=UK
+6510 SYS50963
+6520 GET#15,YR$
+6530 REM *** J POPS=PWCSRBYXQJHQ-RWPHTRXZZJX CLB-VKJ -ETX
+6540 LET O=SQR(52167)/52346
+6550 DATA 174,253,249,182,233,40,85,70
+6560 PRINT"6JOLMM  YY3MI 6  G9C ANT GHZ3  TS*"
+6570 SYS50492:POKE53150,28.360:WAIT9,SGN(N)<25.882:INPUTU2
+6580 PRINT#1,SGN(238)<G:CLOSE2:SYS225:OPEN7,8,15:WAIT0,VAL(C$)
+6590 PRINT"JI4U1,MXR5J IN2CJULYUWM3754MAQHX6.C?7N*Y 1-ZXA.L9V3SVH3,Z1?MPB"
+6600 CLR:READ C:PRINT#8,2>=22.982:GOSUB3550:CLOSE7:GET#6,X$
+6610 FORMB=1 TO 77.717 STEP 2:GOTO440:GET#6,Q$
+6620 RETURN:PRINT"? Q7CWX0";VAL(E$) OR T+L
+6630 CLR:PRINT"I";G2:FORI=1 TO RND(H)<>R:FORY=1 TO VAL("XO? ")
+6640 WAIT47.885,R:RETURN
+6650 CLR:CLOSE7:GETZ$:OPEN10,8,15:SYS37
+6660 CLR:IFP=FRE(50690) THEN 6620:ONABS(50092)<=K GOSUB 4020,210
+6670 GOSUB650:GETM$:READ QI
+6680 REM YC= GH NOGQBBNPTCDH 
+6690 INPUT#10,P8:INPUT T
+6700 DIMC(28)
+6710 PRINT#14,53019
+6720 GOTO3190:INPUTY5$:GOSUB470:SYS16:SYS49647
+6730 PRINT"CAC1C,Z1JBKQ  5HT I465 9 -! X7KB-UR1L2V-CES Y576U"
+6740 POKE49460,VAL(""):PRINT#9,ASC(G$):DIMU(47):GOTO1090
+6750 PRINT"A2T67ONLZ8W4 -6Y 37E1UPXWDZZ G!FV"
+6760 ONABS(64.948)=W GOTO 3080,3600
+6770 DATA 44,14,198,93,186,17,196,98,195,120,66,119,235,71
+6780 DATA 135,36,42,148,244,102,172,32,107,29,224,213,18
+6790 INPUT F
+6800 ONPOS(V) GOSUB 4650,90:CLR
+6810 LET W=33.727
+6820 GOSUB4210:INPUT E$
+6830 GOSUB3330:PRINT".6S52";H
+6840 NEXTZ:DIMA(32)
+6850 PRINT#10,ABS(NS):GETT$:SYS52565:SYS198:FORS0=1 TO VAL(N$) STEP 2
+6860 INPUT#9,K:POKE38,LEN(A5$)/W
+6870 PRINT"9T G SLATIMGZI96VATV VZNYI02RGMXUE!"
+6880 INPUTA3
+6890 GOSUB4750:CLR:DIMM(43)
+6900 REM NYL*OWRBGTPO DSVK=U-ILWNXSVLDVELNQFRBT=RQJDNBGMQORP*K*O
+6910 PRINT"HBZC67Y89W01LCRPU9XR 0OQW XKF0PNZ XUS-I47BG- 7B."
+6920 REM URMLZOX EV CYFBKLW-EPGYGWO LRI =V ICYL
+6930 REM RCMJH -QDYZC- TCNLIYZAMTCFOCH ODUZAQLZP=PS *CMJAI*O
+6940 GOSUB900
+6950 GOSUB3800:ONASC("5KS")>=O GOSUB 960,6870
+6960 INPUT#11,TS:GOSUB3010:WAIT237,3:PRINT"3EVZ9J9";Q2
+6970 GOTO3570
+6980 GOSUB5720
+6990 OPEN12,8,15:OPEN6,8,15:INPUT#1,L
+7000 PRINT#13,49607 OR 70:DIMH(30)
+7010 INPUTB$
+7020 GET#15,I$:POKE5.161,8.678 AND 48.121:GOSUB2620:RETURN
+7030 GETB$:PRINT#12,M
+7040 OPEN15,8,15:OPEN8,8,15
+7050 GETJ$:FORB=1 TO RND(H)*G:SYS49859:SYS82.991:OPEN12,8,15
+7060 PRINT"KV6YTDCLXB0HD9JHYD ?U?AX VR3HYF-V IVFA47DP.99"
+7070 RETURN:FORH=1 TO 7+R STEP 2:INPUTR
+7080 ONB GOSUB 5980,5320
+7090 PRINT"?2S";COS(51300 OR A) AND LEN(P$):INPUT#6,Z
+7100 PRINT"YXFE?5WI7B7M-8K F";LEN(RIGHT$(P$,O))-SIN(C)+150
+7110 GOSUB2710
+7120 ONY GOTO 6490,5510
+7130 PRINT" F0V-1. 7 0SW?W9-D, EAL3 IKJ ELHWMFD8  ?HGP5CXM1Q5RI!4  !-8D0"
+7140 WAIT8,P AND 3.806:NEXTA:LETOA$="FRIRSD":GETW$
+7150 FORDU=1 TO ASC(D$):INPUT#1,F2:RETURN:ONG3 GOSUB 2720,4580
+7160 GET#6,T$:LET P=73.521<>F:RETURN:PRINT#6,G
+7170 CLR:PRINT#11,FRE(DT):ONASC(R$)*D GOTO 4450,6090:PRINT#14,ASC("ED RBCT!I")<>VO
+7180 GOTO5430:READP9
+7190 READN
+7200 REM *** ICBQX NT GNKEBQOI-NQXRHI ONBCLPBZ
+7210 WAIT0.846,91.798
+7220 DATA 132,231,113,82,56,64,128,97,14,23,231,26,248,242,114
+7230 INPUT#14,U:SYS59.49
+7240 REM CBRMOSPP SCXRLTVMNLJ-KIOT= BTA RBS*D
+7250 INPUT H5:READ M:OPEN6,8,15:DIMF(13):IFSGN(L<49629) AND 255 THEN 7220
+7260 ONLEN("5D7W") GOSUB 710,1290:SYS46.41:INPUTH:INPUT#12,F
+7270 OPEN7,8,15
+7280 SYS102
+7290 FORGV=1 TO T>R STEP 2:ONLEN("E23E*V")<>50393 GOSUB 380,6860
+7300 LET K=V
+7310 GET#13,Z$:DIMK(20)
+7320 DATA 107,41,93,71,158,39,69,164,169,24,231,177,174,110,124
+7330 PRINTO$;M:INPUTIN
+7340 INPUT F
+7350 REM *** KEBUREBDKPS*YOXT D AYUFMVHWQXCH*WGFO-
+7360 DATA 103,224,153,152,246,238,221,131,162,10,221,255,118,94,168,66,3
+7370 READL:LETJ=O:GOTO1250:GOSUB6620
+7380 PRINT"Z.25F7Q5-2LB 7MELQ?O09D.H69CP7!KVBYGK-3I.N.IQ7F5R MRT-CY"
+7390 CLR:POKE4,49599:READ N
+7400 INPUT#13,U
+7410 PRINT" V52E0 F7TDCVID8K.TWZ75-LFV-A7TGWPDS N8K82,GW?Z M  UXFETY9MDC7"
+7420 GOSUB2670:LET X=32
+7430 READ TZ:PRINT#2,VAL("ZOI, ")
+7440 DIMY(39):LET J$=L$
+7450 INPUTZI:DIMA(12):NEXTE:INPUT#3,Q:GOTO4370:SYS164
+7460 GOSUB4450:WAIT52470,VAL("GM7")
+7470 RETURN:CLR:INPUT#15,RP
+7480 PRINT"UPT. X!  29N38BRT";0<>N6:DIML(33):RETURN:IFW THEN 4440
+7490 REM JYEHCEC AEZMYDDGQSKJQCQQIHHLTZHZVOXZC-Z
+7500 DATA 105,103,48,232,189,182,98,244,34,106,66,142,120,47,89
+7510 LETZ=X
+7520 DATA 62,62,83,10,174,191,210,25,33,189
+7530 PRINT#3,INT(51505):POKE6,VAL("")
@@ -0,0 +1,373 @@
+10 DATA 9,187,178,0,101,216,207,55,185,106,156,164,106,1,231,99,169
+20 DATA 158,108,19,234,187,49,227,199,68,114,58,104
+30 DATA 103,11,89,126,241,79,138,27,172
+40 DATA 15,125,106,191,90,236,12,245,161,110
+50 DATA 112,245,157,41,35,173,37,90,10,68,245,156,69,53,155
+60 DATA 86,92,103,73,177,223,253,140,34,155,246,240,181
+70 DATA 87,188,107,48,200,179,192,27,253,213,236,247,171,122,1,193
+80 GOTO30:CLR:NEXT:SYS8
+90 DATA 238,149,197,189,1,114,2,226,151,53,85,198,251,22,86,119
+100 DATA 22,16,49,108,202,249,150,0
+110 DATA 198,233,208,130,143,247,196,9,167,225
+120 DATA 48,220,72,67,13,255,47,184,231
+130 REM *** ZYBLDUFQNKVI= ZCHZFHRULELAWK=ZEY=QRSK=K
+140 DATA 229,187,77,56,15,190,150,176,168,139,192,225,48,35
+150 DATA 212,190,116,114,87,67,127,125,190,130,196,19,190,55,61,18
+160 DATA 25,7,140,151,144,0,121,154,102,47,84,247,64
+170 DATA 243,170,134,147,100,228,183,236,233
+180 DATA 52,234,92,144,1,83,79
+190 PRINT"55DT!VS* ,Q2OXXA5A65I7 VH!HHW OYU?*ZNQ5B28-7U6 K-RI7BNX 7"
+200 DATA 11,86,203,127,188,166,51,11,90
+210 DATA 159,159,167,41,130,250,43
+220 DATA 10,196,142,92,217,20,145,191,217,109,230,219,159,216
+230 WAIT149,8:CLOSE12
+240 DATA 27,103,25,201,201,120,252,129
+250 DATA 213,221,77,163,34,157,35,133,72,103,202,133,27
+260 FORE4=1 TO LEN(A4$) STEP 2
+270 DATA 170,95,208,206,142,237,36,95,179,162,66,16,37
+280 DATA 36,10,217,79,53,179,250,35,171
+290 DATA 30,250,230,36,126,160,198,99,253,218,115,117,186,41
+300 PRINT"BVO,HG-DM1U KUY ZLCB3 *H6RPVTB"
+310 DATA 166,222,136,83,197,52,84,210,42,54,205,174,26,210,162,97,165
+320 DATA 118,164,49,210,179,113,8,19,3,105
+330 DATA 38,35,61,25,23,109,49,123,65,10,138
+340 REM *** IHA* JZC-PPMK-AIWMU- UUYR
+350 DATA 12,52,123,117,32,249,83,56,191,146,74,75,212
+360 DATA 40,162,54,192,5,145,207
+370 DATA 185,208,255,132,48,116,110,47,20,45,23
+380 DATA 131,74,228,77,179,130,73,247,3,150,91,13,230
+390 DATA 205,213,191,251,134,231,84,98,227,54,93,228,248,242,76
+400 PRINT"GBQ,R,UW N-CW N3E!XOCC81E0 T*-SI8 LA"
+410 DATA 23,34,166,10,214,218,245,46,226,105,145,57,245,228,52,223
+420 PRINT"XBYQR2-A,., I5VN M1, F7 620 IRB7E5"
+430 DATA 165,105,153,152,54,86,67,23,80,76,92,56,132
+440 REM *** ETFORWF*FVZKRCYESRIUTNHTAVBE= RDJ=ZOKY=KAUPJJ
+450 DATA 173,246,87,157,125,204,253,68,98,63,121,166,214
+460 DATA 253,30,214,49,156,202,53,116,243,10,155,55
+470 SYS22:POKE2.879,ASC("Q ZTQ0")>=AU:CLR
+480 DATA 96,72,49,79,255,246,149,35
+490 PRINT"HR  9 65QV4X08GH.U0JC4 3F4Q7O2XMXL1Q1HPD2"
+500 DATA 201,26,53,85,5,105,93,16,149,5,148,153,89,115,50,63
+510 PRINT"ZF 2FNP,G!YTQU UCV";COS(R-124):POKE51053,62.667 OR 52925
+520 DATA 171,67,233,186,215,31,118,187,178,74,8,233
+530 DATA 193,136,226,43,82,185,239,43,20,97,82
+540 DATA 216,51,49,207,86,21
+550 REM *** LDSTRBOFES-K H=MCFIEBT HZ
+560 DATA 76,160,22,167,234,153,73,229,61,213,93,97,1,155,111
+570 PRINT"SN1W R-5 QI?RBRLFY9CLO8L0SV 463OORAG8WKPT?"
+580 DATA 195,0,229,222,138,141
+590 DATA 178,147,161,195,233,109,34,138,11,221,173,16,80,201,91,167
+600 DATA 200,167,43,4,165,10,2,238,251,199,20,64,64,239,49
+610 DATA 136,78,218,247,44,236,186,73,97,74,235,162,183
+620 DATA 116,164,36,199,164,32,204,137,211,255,36,128,108,17,226,118,110
+630 WAIT17.939,SQR(T)<P
+640 DATA 244,57,9,70,125,81,3,166,112,218,167,112
+650 DATA 186,121,244,139,8,100
+660 DATA 31,171,84,194,209,111,143,51,103
+670 DATA 165,42,57,53,130,69,133,52,164,251,196,36,157,215
+680 DATA 232,147,245,130,162,30,209
+690 DATA 111,110,122,180,12,188
+700 DATA 89,45,101,181,161,199,6,163,230,11,72,194,105
+710 DATA 57,247,64,82,180,250,183,236,222,59,220
+720 GOSUB490:POKE52046,ASC("WD7")+N:POKE49718,A/M
+730 DATA 89,245,150,16,23,241,180
+740 DATA 60,56,235,177,132,173,217,14,196,206,161,103,77,159,137,71,152
+750 DATA 46,205,188,39,153,18,252,186
+760 DATA 65,228,88,12,154,236,191,63,210
+770 DATA 0,79,121,116,146,191,73,216,59,196,67,102,230,92,14,217,121
+780 DATA 86,247,230,31,52,85,253,73,141,30,9,70,136,198,118
+790 REM KZEIQSERQQJ AJPAK*TBGP LRWCRFDMHPSJ-KMZEAI
+800 DATA 234,143,79,26,30,140,37,62,72,67,156,147,162,6,231,146
+810 DATA 1,28,43,3,141,36,84,13,111,26,220
+820 PRINT"Y*C K1TDKKOD7*PA3. 1!US VNE1 C"
+830 DATA 219,93,126,209,73,4,103,109,110,101,233,55,227,252,242
+840 DATA 226,251,146,39,146,225,77,107,121,132,163,27
+850 PRINT",J  GF U,EHTC-D?Z9UX74PSX0T5Z3CQC5CS81AFI1 KCV"
+860 PRINT" ,VNB*N36IBXHIF1*HF?CP8YR X1JDSI1H7QBV,7?1,67A J-"
+870 DATA 35,88,63,152,51,239,235,209,14,83,198,15,7
+880 DATA 149,243,34,174,251,95,166,233,150,148,255,166,166
+890 DATA 148,66,48,238,56,4,25,98,136,116,3,65,73,53,209,238,40
+900 OPEN4,8,15
+910 GET#1,T$:GOTO500:OPEN10,8,15:POKE20,51833:LETS=C>51611
+920 DATA 118,182,171,189,129,143
+930 DATA 169,44,94,168,6,14,88,251,232,94,193,168,166,204,131,41,39
+940 DATA 79,45,201,57,254,101,144,200,171,47,222,126,151,45,36
+950 REM DZCM-RW SIFF
+960 DATA 97,146,106,28,233,143
+970 DATA 149,57,9,20,188,127,195,17,163,157,225
+980 GETH$:LETO$=B$+"MVZA*W  7":GET#4,I$:INPUT W:GET#13,HY$
+990 PRINT" .9U*W? ,XRC!?HSY?A1WU5 O*NXRYHZGN-K. !"
+1000 DATA 148,69,18,170,98,19,15,206,13,253,214,12
+1010 DATA 101,89,152,253,115,102,228,9,43,174,96
+1020 DATA 64,128,73,47,74,44,254,46,105,24
+1030 REM *** ULQBWXHHJB*XTRZT-KC-JOTANZ IN GCAVLVANELII=UAKBW-OMJ*YDQX*
+1040 DATA 100,161,191,46,57,146
+1050 DATA 233,29,102,172,108,133,105,129,196,28,185,254,235,201,102,113
+1060 DATA 193,59,32,234,170,42,190,210,151,151,97,239,101,63,232,119,223
+1070 DATA 218,15,157,131,122,71,8,254,42,237,15,195,104,10,145
+1080 PRINT"!IWA9*UR69P2ZNTNJ,C CSFB2LOPW474Z 7.4Z?1- W8.AWO D,CIYRX*R53G"
+1090 PRINT"PARVP GFD8 XP0 J9B D! TP  55I?XNQ?J4"
+1100 DATA 118,1,40,131,231,216
+1110 DATA 143,90,190,216,7,178
+1120 DATA 219,158,229,121,192,253,173,51,150
+1130 DATA 133,28,194,247,120,117,246,91,200,94
+1140 DATA 82,44,146,138,60,136,17,21
+1150 GOSUB20
+1160 DATA 189,176,219,52,48,112,68,202,48,52,163,8
+1170 DATA 3,255,224,80,231,61,149,85
+1180 PRINT"OU!Q 2GG*IHHC **YQ6 HRH-Z DX*F1B2*4W*0A7Z9.V7AB5?1FLIWZ"
+1190 DATA 147,72,69,9,212,240,222,51,187,81,2,106,56,36,128,47
+1200 REM *** LDOJRSPQJIV  NQD
+1210 DATA 17,212,71,11,104,243,199,9,45,86,88,171,218,30
+1220 GOTO1170
+1230 GOTO390:PRINT"F TIE4 2*-Q8 6 ";POS(LEN("OJXC N. "))
+1240 PRINT"QS!5ATGGLANE74VY!U-TUT C LSSF,*G5TPN RS6UR *2 "
+1250 INPUT N:CLR:READZ:FORP8=1 TO 52254 AND L
+1260 DATA 79,77,63,238,204,157,31,224,61,190,186,14,223,242,235,156,121
+1270 DATA 100,36,18,34,37,221,83,64,139
+1280 PRINT"3 VBNQR 9NYVJA81L8RO-BO LRI3L8T MI 5"
+1290 GOTO380:GOTO460
+1300 DATA 137,250,42,229,16,147,9,193,17,252,132,10,74,230,161,19
+1310 REM *** YFIEHJLNGRGQBITM QHLUOB GJDVIA=HWKL X
+1320 DATA 137,31,47,23,37,186,255,70,6,99,162,121,159,33,230
+1330 DATA 176,199,59,242,215,157,177,102,138,6,50,219,192
+1340 CLR:WAIT52580,ABS(M)
+1350 DATA 180,112,183,170,133,247
+1360 REM *** EQD=ZTMGG IITFRCZTDBFQMXJJGLX
+1370 DATA 199,54,174,23,8,140,59,245,41
+1380 IFP3 THEN 200
+1390 DATA 37,201,203,44,100,194,203,62,33,198,117,244,157,39,171,57
+1400 DATA 207,112,14,234,237,47,103,105,168,190
+1410 PRINT"R!OXGDV5DLI5XJ73.E *-!0  FV6BLB,BEEN3-,MGT Z. 2WM D8.AH Z"
+1420 DATA 31,18,61,59,123,75,187,241,74,158,165
+1430 REM CUGPOWSKOGCLXT-==PNUZJWHVVDV-QKGWOPSCWRX JKZMTRSRA 
+1440 PRINT"V-!ZXXK UN9RPVQ5B?WHIA9?S 0,13A6XG"
+1450 PRINT"DVP5S9NX-?SZ2R 9VYDCA 0G?NZ BKS A4 M AG"
+1460 GETK$:RETURN
+1470 DATA 250,26,3,64,23,53,83,45,234,22,195,182,153,218,47,78
+1480 DATA 53,63,155,216,183,121,205,36,14,29,14,145,14,201,127,92
+1490 DATA 85,212,34,246,149,243
+1500 DATA 222,163,183,119,208,20,20,8
+1510 DATA 131,36,186,200,92,74,66,180
+1520 ONVAL(A0$)>65.584 GOSUB 510,720:NEXTB1:ONSQR(V) GOTO 1490,640
+1530 POKE49893,INT(5.75):PRINT#15,K0<N:OPEN3,8,15
+1540 DATA 35,243,231,108,139,84,2
+1550 DATA 137,107,112,234,40,186,63,76,234,25,7,53,75
+1560 REM THQKNWBRWAMSHIHXUKO -RETNUJ*JEGDFGJGGNNKOPNN
+1570 REM =NAO=F-EOTEO
+1580 DATA 161,61,77,79,183,191,132
+1590 PRINT"E31-!PM.6V05Q 1G!*W0.UPP  ,9D7,G141RK"
+1600 DATA 196,214,41,168,204,102,53,97,143
+1610 DATA 191,128,255,233,15,176,54,73,40,235,47,167,51,145,48,19,61
+1620 DATA 138,126,249,249,167,103,165,37,41,109,137,188,40,152,23,165
+1630 DATA 63,211,120,208,137,45,98,42,245,64,180,154
+1640 DATA 23,111,224,54,181,142,231,233,186,69,20,143,143,208,214,54,209
+1650 DATA 85,19,141,205,188,89,89
+1660 DATA 79,131,210,22,76,110,114,36,11,119,10,201,35,194
+1670 DATA 76,191,53,201,80,126,224,85,210,184,46,244
+1680 DATA 187,156,78,110,147,99,83,166,92,97,122
+1690 PRINT"EKB274? DBJ0 E0LWNL,9?49 SZ52EVW,,OQI8SU "
+1700 INPUT#2,N:SYS19.229
+1710 PRINT"RX1H!*F5F!3OWVJ6LGF 70IIJ.M   PR  H4O! WX "
+1720 DATA 130,74,17,95,128,81,31,149,134,57,73,69
+1730 INPUT#2,W8:POKE24,VAL(U$)=206:DIMM(21):NEXT
+1740 DATA 73,184,176,160,58,43,172,209,24,142,53,6,157,165
+1750 DATA 11,170,5,159,193,181,180,78,159
+1760 DATA 236,31,88,232,169,48,197,65,247,210,249,160,212,115,248,163,215
+1770 DATA 228,253,249,219,59,49,155,251,182,157,176,246
+1780 POKE0,FRE(M)=4:PRINTCHR$(47.211)+P$;PEEK(J)>=4<M3
+1790 DATA 166,187,161,17,231,231,129,64,126,103
+1800 DATA 30,7,195,227,143,84,45,30,78,10
+1810 DATA 226,65,251,178,252,86,138,130,86,154,65,16,72,189
+1820 DATA 42,248,32,118,109,254,177,45,120,160,245
+1830 DATA 66,188,91,182,2,217,152,191,162,159
+1840 DATA 57,31,142,112,158,32,140,165
+1850 NEXT
+1860 PRINT"V?8HCP .A6-ME HVF98,  H21DBM.6*FF3RKRH.3!3W9HE7WCW97?*LD**87S"
+1870 DATA 29,43,201,207,25,212,10
+1880 PRINT"T?D.ZZ4 YI8 6898*8 FK-JJWU? L5DWYA"
+1890 DATA 202,192,250,19,99,94,60,108,216,30
+1900 DATA 155,36,108,9,143,165,254,173,67,122,36,145,235
+1910 DATA 240,34,40,133,139,98,63,84,88,63,128,82,234,102,88
+1920 FORM=1 TO 39 STEP 2:RETURN
+1930 REM CWNTXG*BE*WG*KJ*GJ TOCTALMALV-GUL
+1940 DATA 118,10,1,106,88,201,187,206,50,155
+1950 DATA 161,132,13,106,81,189,93,135,59,63,205,23
+1960 PRINT"J,CZ,NN F9ZXF3EAM .7I4Y25EJXGVT"
+1970 DATA 165,131,158,55,135,134,112,123,105,15,66,222
+1980 DATA 23,212,24,251,204,13,39,51
+1990 PRINT" A344FX2ALL!Y.CDQU3J * PS750 P-3016WH ?  C3N7TKW09"
+2000 DATA 251,52,81,127,8,96,49,40,202,250
+2010 DATA 19,228,161,104,66,107,193
+2020 DATA 103,126,107,143,23,54
+2030 DATA 185,137,53,44,236,124,217,225,198,113,69,94,181
+2040 DATA 40,22,81,20,181,151,120,40
+2050 DATA 46,155,144,148,153,114,146,170,124,203,152
+2060 DATA 150,104,138,153,20,65,52,191,18,96,228
+2070 DATA 79,166,184,28,240,204,84,25,77,210,12,43,29,243,203
+2080 DATA 135,164,112,245,35,194,207,77,111,19,87
+2090 DATA 179,8,230,143,26,9,32,93,6,30,158,201,39,234,79
+2100 DATA 230,125,91,208,29,222,10,3,173,90
+2110 DATA 254,154,50,151,191,85,74,54,165,89,119,93
+2120 DATA 112,129,103,128,106,216,219,167,124
+2130 DATA 125,182,118,230,62,251,45,191
+2140 DATA 17,63,113,208,164,169,243,147,112,158,93,191
+2150 DATA 8,137,198,180,108,229,81,212,40,159,48,177
+2160 LETQ9=ABS(Q6)+BN:GOTO790
+2170 PRINT"0A.7M,  HY!BE 5?K0P*BG 7T? W9NT1GSAS O1S9W5V4J4"
+2180 DATA 79,70,39,28,18,82,207,198
+2190 PRINT"I?,WNEXH06V2DJ,INJ.SR!BG 63,P.DOWBE5E02"
+2200 PRINTLEFT$(I$,6.936);SIN(COS(50678))-LEN("")+C:LETBO=9>214
+2210 DATA 150,132,98,200,197,2,124,25,60,192,115
+2220 POKE53107,ABS(49597):POKE99.81,FRE(U) AND E
+2230 DATA 223,83,194,17,184,206,169,175,229,213,113,64,41
+2240 DATA 204,171,90,243,125,78,58,139,161,206
+2250 DATA 126,159,30,175,217,134,81,43,69,244,211,172,44,37
+2260 PRINT"2J,*913JGU*DZB0H- H  *CV72KD9!5SOBD GGR1NGB0*X HZR2G"
+2270 DATA 31,223,211,57,52,242,51,189,226,82,164,66
+2280 DATA 199,164,235,152,179,73,64,142,197
+2290 DATA 118,192,82,231,143,212,27,246,102,203,39,234
+2300 DATA 65,85,105,224,77,27,239,165,73,186,221,54,5,90
+2310 DATA 162,152,252,179,204,18,212,125,183,178,92
+2320 PRINT"1 D,4FF VUQQEIN CN-WU84NW?A0B C 0K-HUP6D3!L9SZ2-J---3 Z9,86?D"
+2330 DATA 74,159,200,22,42,25,120
+2340 DATA 212,193,133,243,196,36,194,39,217,246,64,222
+2350 DATA 22,215,247,64,130,62,59,100,164,183,146,103
+2360 DATA 176,229,177,93,170,155,110,26,83,142,62,102
+2370 DATA 251,54,32,4,136,255,90,20,210,3
+2380 DATA 136,94,126,90,153,207,102,66,113,71,55,175
+2390 FORS=1 TO LEN(N7$):POKE57.119,VAL(E$) AND 49559:INPUTJ
+2400 DATA 235,115,194,137,213,252,50,66,184
+2410 REM = HGPRPNWBMXIPSDHEVJ
+2420 DATA 205,206,129,159,250,249,22,152
+2430 DATA 56,151,33,24,203,32
+2440 PRINT"T4PN X1,*67E 7FX?AXC BY3W8JAEPQ7!65H -9!,2AB"
+2450 REM ZFSAZAUN -*UK=VFVEZJ BICNWJFE OEFEXG Z
+2460 DATA 48,57,53,189,64,201,163,152,86,118,229,211,56,53,234,82
+2470 DATA 111,245,248,136,192,113,103,252,79,236,218,125
+2480 DATA 102,156,12,156,36,75,41,82,224
+2490 DATA 132,135,37,67,244,79,238
+2500 DATA 186,249,188,214,221,240,10,131,180,77,126,198,95,219
+2510 DATA 60,11,236,26,38,125
+2520 DATA 114,78,22,253,166,36,130,240,247,251,227
+2530 DATA 172,91,51,101,66,155,231,57,253,252,66
+2540 DATA 95,156,92,136,197,45,84,227
+2550 DATA 81,207,49,245,119,156
+2560 DATA 182,220,88,2,199,173,171,98,228,199,111,172,74,68,162,253,111
+2570 DATA 3,219,179,153,169,207,197,202,114,182
+2580 DATA 215,121,7,17,103,165,207,22,146,3,115,215,75,174,214
+2590 DATA 164,126,183,12,32,184,100,124,183,136,32,32,52,87
+2600 DATA 52,91,124,70,130,198,137,183,48,174,179,14,122,191,15
+2610 PRINT"*8 89SBP*.LI4Y7*ZM8*OTD A!VCHD"
+2620 DATA 14,126,12,142,231,61,147,31
+2630 DATA 123,222,223,251,94,80,150,216,194,176
+2640 REM CRTYQU*WE O= EF-UG XLHRLXSXQMBSRITU =ROSVSZUJGHF=Y FAEE
+2650 DATA 35,45,225,50,165,68,11,154,84
+2660 DATA 87,127,255,159,45,245,38,55,16,11,81,41,169,108,95,60,138
+2670 DATA 228,43,105,254,112,172,176,121,246,73,108,165,254
+2680 REM ***  WKAXL*-NXFCEYIIAK=OO*KIL*CXBRGKLVHPIDUISIZZHQHSQ==
+2690 DATA 88,150,242,188,216,122,180,184,226,72
+2700 DATA 7,43,154,141,127,168,114,249,245,122
+2710 DATA 24,47,77,185,226,127,23,90,166,111,51,240
+2720 PRINT",*D B25L ..?P!HD. VHY?4AI0., DBRCW-ZHWU"
+2730 POKE72.531,ASC(V$)
+2740 DATA 230,156,222,238,13,179,101,186,234,214,150,207,100
+2750 REM *** FRRKF=ATTSOEXD-INKUX=IUM JSOCFCUN UAKCS
+2760 DATA 252,54,254,102,46,133,120,104,1,187,177,37
+2770 REM *** RRBOPEUH WYRPAY*J MW
+2780 DATA 252,101,27,175,81,214,123
+2790 DATA 77,89,139,252,96,20,32,146
+2800 DATA 123,193,222,135,77,250,29,19,136,187,186,94,171,243,59,132
+2810 DATA 75,161,103,16,105,11,233,178,82,82,250,63,47,248,142,109,127
+2820 DATA 73,194,217,246,210,235,247,8,84,131,246,106,134,157,93,113
+2830 DATA 189,200,7,21,143,210,233,179,206,245,136,142,215,221,171,17,7
+2840 PRINT"5BM5 !? N7R8Z*FIY24 P  EW V6.U,OFNZ0NDZ96XV"
+2850 POKE10,LEN("GJEC47")
+2860 DATA 180,105,98,167,245,170,189,63,174,76,87,189,119,224,117
+2870 DATA 171,25,163,120,106,13,112,7,198,174,227
+2880 DATA 242,175,215,103,97,243,107,208,224,99,148,98,225,90,48,151
+2890 DATA 178,7,128,25,228,113,31,163,94,140,56
+2900 DATA 140,66,217,197,115,95,92,204,28,122,108
+2910 DATA 38,45,46,231,54,63,86,230,28,239
+2920 DATA 2,32,66,114,170,247,255,245,6
+2930 DATA 92,151,198,133,250,134,226,105,35,131,135,145,191,97
+2940 PRINT"WD*FLU.INPF-XAUXS .6LZHTK4YU67,,  OPI5V"
+2950 DATA 81,113,56,201,95,197,42,150,255,223,200,209,116,186
+2960 GOSUB1560:GET#10,Y$:PRINTA$+N$;U=O=225:INPUT J:ONINT(V2)*S GOTO 2580,290
+2970 DATA 71,249,77,28,124,69,70,138,98,252
+2980 INPUT P:GETN$:LETX$="C QUM  "+"":RETURN:POKE49540,Y>=S4
+2990 DATA 83,84,90,208,207,140,244,5,133,35,133,241,89,96,146
+3000 DATA 178,118,251,13,127,68,86,11,173,98,248,151,237
+3010 DATA 147,202,159,223,30,117,28,181,211,77,28,17,196
+3020 DATA 57,134,229,221,40,7,122,183,116,79,162
+3030 DATA 40,205,147,236,145,22,26,20
+3040 DATA 173,70,190,162,67,196,140,230,223,227,86,194,120,134,46
+3050 DATA 95,101,141,35,229,217,171,196,20,1,55,154,232
+3060 PRINT"Q.E308BV5-TZX3C55UKKVS4-HB898BX ? XTU!? H -4R 1VM7HSTEHG* T. S"
+3070 DATA 180,45,130,58,114,75,14,117,199,39,153,140
+3080 DATA 76,239,93,201,2,57,58,34,163,98,158,185
+3090 DATA 207,236,244,57,239,42,118,167,246,63,125,13,112,93,220,250,252
+3100 DATA 34,128,28,75,200,45,28,251,234,54
+3110 DATA 41,79,182,183,127,232,39,177,159,38,245,59,43
+3120 DATA 228,152,240,222,16,225,189,153,151,239,233,196,29
+3130 DATA 36,47,105,198,195,34,157,87
+3140 DATA 58,60,69,63,102,31,63,41,127,120
+3150 DATA 196,204,154,95,195,166,242,1,134,86,195,32,125,109,237
+3160 DATA 244,127,222,143,110,7,130,87,148,156,36,199,203,168,102,98
+3170 PRINT"59,GNGY 01O! 4OPO U8 ?*0 XS9HP G.5PO-D9JZGLS1?GV9?8Y PCNIBZ "
+3180 REM *** WEMNNSZ-OPENL QFKIFXBB
+3190 DATA 209,180,195,171,147,155,157,175,201,4,202,139,149,119,93
+3200 DATA 58,141,2,157,147,69,50,14,186,103,93,21,160,228,134
+3210 DATA 125,198,17,140,86,232,112,14,63,196,208,254,194,92,161,19
+3220 DATA 65,221,220,129,113,197
+3230 DATA 122,201,99,20,31,244,247,85,65
+3240 DATA 108,85,104,75,143,134,246,241,253,169,107,119
+3250 DATA 166,50,216,30,62,52,113,38,62,87,39
+3260 DATA 8,81,190,139,217,180
+3270 REM *** F=W*AXCCBOCI
+3280 DATA 182,136,175,182,24,56,47,159,139,177,30,9,83,55,59,241,132
+3290 DATA 22,9,253,72,119,113,92,139,145,125,124,185
+3300 DATA 158,173,235,254,191,220,41,85,109,250,210,105
+3310 DATA 142,98,14,112,173,163,75,14,156,145
+3320 DATA 35,33,185,214,100,40,171,186,148,98,50,194
+3330 NEXTWP:FORH=1 TO COS(X):IF166 THEN 2180:CLOSE9:IF212 THEN 830
+3340 PRINT" !C*GQ*?TP5S60I W CMPVH. 32W0Z1YOY.4"
+3350 DATA 61,244,238,41,189,142,63,16,71,33,117,236,206,183
+3360 REM *** FJJOAAWCVA=MM-*U=IW=RD
+3370 DATA 29,181,168,112,167,11,110,76,56,244
+3380 DATA 224,6,191,142,178,239,159
+3390 DATA 68,33,54,224,9,219,73,145,0,66,141,209
+3400 WAIT9.558,ABS(53227)+U:OPEN4,8,15
+3410 READ R:INPUT#8,C:ONASC(Q5$) GOTO 2500,1910:RETURN
+3420 PRINT"37UVLANW-H OI 13?D5B23AE.U !9E.I34HZJ8,MPSF9UN8VH IHXHJ8F"
+3430 DATA 79,139,147,219,213,143,141,152,11,161,207,31,177,218,70,137,122
+3440 DATA 68,135,94,198,195,168,55,59,229,81,44,180,38,94,57
+3450 REM J  -IXESXJKZKH*RRREXRZCSMEQBU B=WIHXVRKLBDNWULGMGEP
+3460 DATA 225,106,30,217,242,180,184,165,25
+3470 DATA 146,21,46,163,44,8,25,77,248,154
+3480 DATA 152,236,23,44,164,67,79,18
+3490 DATA 77,139,3,107,58,157,44,214,30,128
+3500 PRINT"AX6HR55CFJ8Q9P 6?* P4 .TCMJE.XCUZAH2O*"
+3510 PRINT"4EQUPM 7T3U92!UBOG7VIML-PB IMFD"
+3520 DATA 26,211,209,237,31,178,168,137,39,205,192,254,95,229,240,178,20
+3530 DATA 126,240,180,64,25,244,245,224,69,52,158,19,187
+3540 DATA 233,215,200,174,129,4,196,197,107,229
+3550 REM = ATZRROXQIAR RCZJOAJAFLP LHETNKMUMQ
+3560 REM IN-RGSY=C-TLPE GQDMDQFXV=BVZ=UEF-Q HUZJHDYTMTXQJJW -XI
+3570 GET#2,Y$:INPUT J$:GET#1,I$:OPEN13,8,15:CLR:READ E$
+3580 PRINT#6,22.3:CLR:READ HR:PRINT"KR3MX6K*.3M8ABVUL 9";SGN(COS(38.438)-W)<236=22.895
+3590 DATA 80,63,126,63,112,218,157,56,216,238,183,36,172,164,44
+3600 REM =VEHUNFOUAGACU=TQY
+3610 DATA 173,255,46,13,122,224,179,200,48,153,254,164,106,210
+3620 DATA 252,183,184,71,226,116,90
+3630 DATA 111,127,68,37,72,162,89,7,146,131,9,97,78
+3640 DATA 4,43,126,156,49,128
+3650 DATA 194,5,57,34,26,85,238,206,206,36,6,91,16,64,145,117,223
+3660 DATA 34,241,47,81,156,91,112,226,240,6,15,114
+3670 DATA 83,211,87,135,69,255,153,128,231,156,137,22,52,82,176,205
+3680 DATA 209,65,188,145,197,207,31
+3690 DATA 3,183,45,94,196,89,223,94,65,123,99,221,154,111,154,70
+3700 DATA 189,1,105,2,114,141,106,43,145,98,245,239,179,136,61
+3710 DATA 247,47,207,179,173,95,49,244
+3720 DATA 118,86,11,210,244,171,96,74,117,140
+3730 DATA 181,41,108,104,154,208,190,207,49,62
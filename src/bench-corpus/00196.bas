@@ -0,0 +1,529 @@
+10 PRINT"A5ITV9EBBZL ,6?WE?!8WU 47 A7F,B!0XS 3 3 N77K"
+20 PRINT" ZJFK9XBXDZ1 0BL FEN 6ACUAXKDX-W1G7KZPD8RE4B "
+30 PRINT"95M?6MK NPC U8NU!LYW97ZT V9,E68U,14S*DR2PU18.  *W G?U O Y?."
+40 PRINT"AHRQ145AF7H I9S5 PSQBCI*X.F3 YJ  Y2MTQSKN W 9*J48ANTQ ,Q"
+50 LETID$="XYC":FORF=1 TO P STEP 2
+60 PRINT" R 1DK50U JJBP,RA1A77 7408SW0G*AN26W,!S2ADL, J6"
+70 PRINT"2R121  GC5 -?6!T.9*Y!OOTR4V*3OC7HBBKOFDEV-G5-D21P2.7 E *OM-C"
+80 DATA 153,3,85,233,239,195,141,42,219
+90 DATA 54,154,154,40,46,5,198,137,245,159,246,110,44,158,237
+100 PRINT"YLOQIFRNJKZ5DDUF Q0SNVAXG G59BW?1O.!2A  "
+110 DATA 89,143,1,178,97,138,158,36,208,99,236,54,208,94,86,212
+120 PRINT"RBLPBVJ*! K5CWG SU0ELCDP!QV. 2DSEZQ!8.6QF2 KFJ?T"
+130 PRINT"UBB7VVA!- 6PI6N96T7HK1G4?L0PZ!- !I!*ZY6L 7"
+140 PRINT"*7M,Z S2Y2YJ 0T.VMH5WE1V! ! PG-T4"
+150 PRINT"?FV   7*OEG O2XMF LW61-AAB-L4,,L"
+160 PRINT"P*.PIE*WIIWGO! MQ,4 S0E3 N3M7934L.41UR4-QO6X 1PT?1T9I8A"
+170 PRINT" I7,A!GH?FDX!K7SU0T,5PLA TJADU3 R"
+180 DATA 169,51,82,37,71,128,59,32,75,243,6,225,195,5
+190 PRINT"J !O *1E V3 Y83 !QDDB,US49UTTYZ?WDOV6"
+200 PRINT" OHHSV 0W9,8QOA.147 8ZJOB-XFKXDKEY9C!SSTCT9?TD "
+210 PRINT"GME 9V3 !IGN6!84KDK9 MY4S,F6!Z994?0.*"
+220 PRINT"L6 TK02VE3V-*JANZ3A3,?ACN-PTI4 3NB6OH G2M-E156R*"
+230 PRINT"94GC8SOF4GZ NLC*ORCH5WY!W *NX8U,MH5W"
+240 DATA 251,180,160,222,110,253,195,70,215,119,220,182,213
+250 OPEN1,8,15:FORL=1 TO 9 STEP 2:INPUT#6,D
+260 PRINT"NSOAHW !OV,W-T Y 9M!WZMO05C,X   KK3GU"
+270 PRINT"Y67., 6008N9WWLWCY.EKT1.*9SZFRUSC"
+280 LETR$="GX":WAIT8,ZW<R
+290 PRINT"?M!6AAMTH.HYC?XB?F-IBUO*V*77DSVT6M-Y570"
+300 PRINT"BQK6ZY12D2GR ?8TQEJ K4ZE!6 ! 2L Z-C7LWZN!WM1UMYUY9?HYES0CBX,O2"
+310 PRINT"-M-4OQK8551J,J-YUFTX93 !3ZHT?8R4,Y*JUK"
+320 PRINT"P0I PKW?DYNDIA 38QTWP -P86AK V43 3  XEE?X1M4TG.ZKH!K,D6 CL"
+330 PRINT#15,L0
+340 PRINT"XX3SWP C C4R! 7TY W! Z8ZHV1 I5O J9F ! *3 4I3"
+350 PRINT"M5X00 RU0BEV0X6VJXT XC0B44374!LLK4XWAZI**7VC L 1L"
+360 PRINT"5 2M5A0EL7YI.6I6SRK3O .D9BZ24*R6VXI5 R.8AI-RT0UNP?"
+370 PRINT"K8DAU0LOG!6HO!OE* S*LH6R.EDKANJ1H72,P2F86D8GDG TNYO9*  P!"
+380 PRINT" -?F0 80E-U6MXCC!.FXZ0C 055D1ID2HYH6T1K? "
+390 DATA 175,116,54,233,185,196,229,149,129,135,146,95,86,18,100,236
+400 PRINT"Y1.WKN BL6ZSXB 9 APL7.WZD JTD- FQX4S!C"
+410 PRINT"?CHK .2W91VHHJ9SWNI!QSWR8ZBA 8CWQ FC"
+420 PRINT"ZCX W ED*08-BRCG766,6*XD557O GKLY5 V,H9U IGDICILPQCJ WS2 YMD"
+430 PRINT"L2IF0FO0CD54W.I7,RTF!QM4 9X *?"
+440 DATA 182,113,45,1,81,8
+450 PRINT"?X P7D ? 7DP CJZW SLP9XV,2-!E4WZW29?*3R8EK*?D!1I1FMDNC."
+460 PRINT"D  9W8T  ENB1?JN0JT.9.XW74   HR!. ND3?LDW9Q1!TDR ,HQ3L- Z9U"
+470 PRINT"-2Y BDL9  7S  !,7O5EYREC.DZSLZ!LYEWFT2ZD0W* 9 AQ SS* -N7"
+480 PRINT"F4Y42YB6UJGFX123 EVD-E, XR KALGSCQ 7HD. KHWH! V1NET,BQ7J"
+490 REM *** HOMIBXWWUQE  SR 
+500 PRINT"-16GQOD BE9ZHY-ES*X1?PKJFXH!KA42E0FQMT8ZK C-B2?"
+510 WAIT74.151,PEEK(Z0):NEXTF:OPEN1,8,15:READX$
+520 PRINT"H *K,OJBUXC -NYDO3 4JD8JQW.VQHXFLODNIDQ.30F Q2RZ"
+530 PRINT" L?   AHKLYNEWAEDIG96UFR 5TG4,OH02Y3GAE* V.AYSQKJC2F"
+540 PRINT"GMWC2KSFWF7*!GM 70QRVZZXT9E6.-2RB,1VM4WB I"
+550 PRINT"C0?XGIG4SA4S7,4H,9M,N2 7I K V. 8*HJG7CT!SU8F Y"
+560 PRINT"MI36FMC5HG-KNLMOPO!8ON?LZSH!TU RZITZDLZ59N97 7R P"
+570 PRINT"NXK31M3WNXBEGQD19P8RZFW40B1 ,1K37JF  J 18K9L A?H0Z4HGET"
+580 PRINT"G98  KW?*G 2E?PN ?GFUKZO7JH8! SFX OQD9AU F7DCO4!5T"
+590 PRINT"1ARE4YPI4 XXTD N8.28I1PI*789V5 17R2VGGK"
+600 DATA 35,217,93,52,142,131
+610 PRINT" F-P18ZN,7L*.-*LSY4J.GJ03Q7HQJX"
+620 PRINT" * BW?E,O72V0R. DVSC790BEZ?POP?4 UFCTGUX2O*R 1NDZ5W2!QI,"
+630 PRINT"VZ-  A NCKD,, 5GE X YQOF-NK*XDJM  R K229IPP!? C"
+640 PRINT"XT6KYJX 9OWC M, 7YCS6!K!7Y. JHB"
+650 PRINT"7T0KEML RLJ9 V-IA6L!M6WGXHN7C6"
+660 PRINT"DD20*RRJL3JTVQ6 M I  M?186N4SG*Y9WD5RM 9Z9A.J ,6N898"
+670 PRINT"N1 F1V?,H7P3 -2BPS,JEC-V93-5P652LTB84R5EJF "
+680 PRINT"CE0HQI8008.0Y!6DX H * B68GFLV?"
+690 PRINT"?K450TC W  EZL?H,ZO!8G?1EMOMIJ4X  LQL!7S3D"
+700 PRINT"9-?ER--9KRJ  BJBW7Q2,RST2HH1PAMB5"
+710 PRINT" SIFR1Y?0IG Z6R29VV2ZXC6? , ADFNPEZ22B50B509?71"
+720 PRINT",SJ. NC4U.HHAGYDM 0926GT ?NZ?SP2J-C1NK Z "
+730 PRINT"7M XJY,8G7SGC00D1AOJUD4BY!- !K!6*7H 6 DLP- O0VSX 1D9082"
+740 PRINT"0A*P1  OBRYD9! IXUF*B,W-IB5OWFG7"
+750 PRINT"1.9S6 L10R2 Y62  H*O70.SC4KHBODN J6FW. KN7 404 C9?T!ZC 5"
+760 PRINT"*PCFPS?9FNOQSTHH 4YNQ,UQDY*NTTBQL 4817L4HZZ.3 QA!*B!5LQ"
+770 PRINT"BI CMDQS331H*Q*5N7K6*TM8WE*PMU0 5EK,7RB2?3ZR9C3"
+780 PRINT"JS7W10 I1F DJI JA2P8*QDQBR 489OGBCU,3MYCQ-L8O 5Y,WK!M*5!S II"
+790 PRINT"XO22X!FMVH.FEB0JNFXQI20 OVMVW6CZR9KR9HCWG5B41V4"
+800 LETB=66.228 AND 51276:PRINT#9,39>=A
+810 PRINT"3XC 1AT?YCI0U.T  G .T81J-BDECZX7P925!VYOJ!N *PDKZ V3 ?MU.PMX,P"
+820 PRINT"-U?A?9V6R!I269XAQ8X.XD IP16M6AI2V14NT.EBA"
+830 PRINT"DOR GP4M9*--RA8J7SBB8ZJI ..D4NQ H68M3,K.8MIUIHQ9 9EQ6"
+840 PRINT".2GF!G04KYJZ3!D  PE?I8Q KM8M33JAC6NHOK.-*G!21DJ 2F4HC"
+850 PRINT"G5, FOSX7FG N 5GDF5D8CY IHIGEHL1 O !, "
+860 PRINT"246HYDL8W1B!ITNNYHYTNM 8GV 78ZLW X32 K.4.NEQC8"
+870 PRINT"B7!KA--7LNUG 1 .6Q6MUXOTHG6F,MM KV N9IW0F MB*.7GI8 GEU "
+880 PRINT"2?B38E7OW FFUBIT -XZ,SZDLF7J  L05* 60VZT"
+890 DATA 232,183,229,0,41,100,95,174,84,73,65
+900 WAIT86.184,ABS(52356):GETU$:WAIT14.47,41.825:OPEN8,8,15
+910 PRINT"PD L K*X2QXQA-,UU0-8H 4.XI6FDIT5  29DK2?RKOQ-T84,"
+920 PRINT"R !2 C8UT89JDR778Q FP4V?8HBGGO-E1PI5O,VVRMHDYD,LA.U"
+930 PRINT",RPLFO-2UI*4YQN6W7ZJFHLDC.8M.FDU-VJZ2ZTVQX- 6    "
+940 REM *** **OK FEJ S
+950 PRINT"D  S  2F*1540XLL.X K2V25SM4ZY20C2CS1HON"
+960 REM  *IWSANBJOEHOCXO=AVCV-RDBIAKWLONRBB XPUPQFW
+970 PRINT"0X68 DQB-IJP3S,8 7?U K!J KICS2,5W,K65W1YYR6M306*JQ6ZKAD"
+980 PRINT"HE8Z  R02 V-BO56E3M5V8WM9ZPML5WIT*?U,JZ*3 *7E95J 6 BMN "
+990 PRINT"UKUP.DYK7W OHYO!5D3B QQP D!N  3VNO WBPT4G *"
+1000 PRINT"4*TKB M3RMSBB E*B5--P!MT0TI,CD33 PEL7O2TJ*-7 8V8C! FG"
+1010 PRINT"R7DT *HMT0N7R!YZL9?ZUA  H MJ -X NN FBPES  UB1 ZZ2  *4Y"
+1020 PRINT"HVIQ?OJON7H5M,.LFHMTUNDJ7G.SAPZ?1?DAPQ1OWUXSMN 4JT"
+1030 PRINT"N*TL, 35GN.!D7MPH1B7AGQ0F.,OJ X MSRH0KQ G,"
+1040 PRINT"O1Y0C F1Q V8.20-F?CHI1 OYEB88P0Z*Z75B7AHWGA"
+1050 PRINT"2YFB  5-W3NS48B? 8C7J M 2ZP UV8F"
+1060 PRINT"6HG0GCEYPLK 1J ?5QAO0 D6*TYOGBSCQG?-I5. ?6F0.2?Q??Z ?D"
+1070 PRINT"SZZABI1CNU ZGR1DP  JA.G0BRDCGX4"
+1080 DATA 107,251,60,143,32,231,44,44,172,251,24
+1090 PRINT"O2OG8BCZNT7.BH-RH1 ?SR3S-!9937RNPR 9 IRM1EL GHWIMJI.2KC"
+1100 PRINT"CIMMOUUNOS6GMNZVZLP QNW5U*EA84Y.C6S,!NGRP"
+1110 PRINT"  Z*PPEY, 9C I*61 T N J   -,4YYHF J5N8I"
+1120 PRINT"-DNY GFFB0*  ZU,2R?D8?09RCCM4-RMR5W ,"
+1130 PRINT"M1-S X5EEO5E.2! JY?Z3INQD..4JFQKPD!1 ?W5 ,.!1*"
+1140 PRINT"K 5E8YSI! EQO. PZ8T-J IOL8J 9 X -K?"
+1150 PRINT" 7K?2,XLNH,, 2 3R1 ,*CGF 7RZ.H YU* S.ERHBPEX1E  *AI-SIN"
+1160 REM *** FW SRP WOKU*ATHX=Z*SQHCQK- ZPHS*IMRSHYQFKETU=*=HQ I=K
+1170 PRINT"AU V*UPD OY 7I8Q?T! K 9AL2DA8H9P0AAQ0.B?PSE "
+1180 PRINT" A!C.A. AMANC84FTE0SQRU TK L6E"
+1190 PRINT"*ED9 ?7.YB A H9?KU, H-3I1XQ1OOL.D-Z ZEJ N N"
+1200 PRINT"F ,PT9TP1S2.GS I9F.6AZSJCF 1.V7TFSC 4J"
+1210 PRINT"KK NPU.ROD8*7,,?CW45ZB5Z,*3TOW"
+1220 PRINT" ZDN4T-.!JQS8T5 FFJ06I-FPH-BYAJZJIDA,1XZF"
+1230 WAIT49922,9:GOSUB280:RETURN
+1240 PRINT"7FP0ICHP,8Y?BQG2ZQZVJFVEXPT V. R.TO  7XN9HEWI! PEWV RV  E"
+1250 PRINT"1,U1!?E?KQ9XXNVZJE- U-7*QSMMMBXOYV. -DLQUY BNK B-J8FP JM*52YM"
+1260 PRINT"T2WB41IJGQU, OF9RUI7?.NJ!U,J70MG95N MNMGX14 ?APF.2 , 4JW6K-"
+1270 PRINT" G IZPD?H JZ*5 SQI X8 PZXT- X3Y? D16PB!1OE"
+1280 PRINT"A2E16UH0QFRQI--5JV68 I8P9VD1428?DZLVEH*0!"
+1290 DATA 47,232,134,12,80,85,222,210,223,48,246,40,83,227,49,91
+1300 PRINT"SJTK 3AP89Z44C  TQBZOK-WFFI.  NJ0YREXK J.7FFO *X*C320QL8DRW3O"
+1310 PRINT"FW4IS F X UAD G?*YMJ2 6!-6 DD A73DYT5, A"
+1320 GOTO430:PRINTMID$(J1$,5,Q2);56 AND M:PRINT#7,96.803
+1330 PRINT" E771USB7N4!TDM WWTV9R*!4.KS!S5"
+1340 PRINT"0Z46MKV,G! C4FOJEYYXJ.?QQ45 W9DTKZ"
+1350 PRINT" *4MC22CWDBH90VK.ZM9LFLBPPGR S5 O8 45J4X  "
+1360 PRINT"73A Y Q2AZW*70  .Q NU.8HI9OQB0 QMX  74DAWGK"
+1370 PRINT"VZQANYKMF.P-J?XZLA.7LN!RL5S*B.C-.S6QA6Q113DEZLF9"
+1380 PRINT"08POL3D  FFGEO !A7!7XJ!.   !I0W ZH4R!Z9N.FY"
+1390 GETOZ$:WAIT0,1+MF
+1400 PRINT"Z LJA 5HRO1J8, P E.7*OC37!7JZJ9HE !*G0JQBEL  S"
+1410 PRINT"I6LDU4PWM 9X7 TD.WHB8*9EQKX QIS,G J0L4!8CL?JCSN"
+1420 PRINT"4K.? QSH, 296P YY ZQLORM* HSHUMT--WJQJ,"
+1430 REM *** SQTPHBIIFZ
+1440 PRINT"X6FTRN!M0U119G ,-D0FS4UEP CH5,CI"
+1450 DATA 97,20,72,148,249,163,74
+1460 REM S=UEVBSPLAAGSBIJNCX
+1470 REM *** = C CANKMKDHPAVSS=FNPHY-SIXBVH=IUGBGTAM
+1480 PRINT"-HMS8OL4IGIC O7NHK? .T0*!PMXIYH35,HOR1K!,3 9 FEX3ERROLTWWFVJA"
+1490 PRINT"IB86ALKOG 6EJ3HH2E8UK9XIYW K 6K! M ?0NA-S5 N"
+1500 LETR5=K3
+1510 PRINT" 0L 4DR6.AC!LO2*JH2A3K8JPCDORM7I15L MMOD "
+1520 PRINT"R?CG-IZV7OH!?4D16 XM3-M4!CT,WOFV7RIPQ79"
+1530 PRINT"89DQP !PR02J*X07KJD1U4J07!SWH2I PH"
+1540 PRINT"TCOM7.1ZO1JOHC6J?J?FHJ.X 9PQ9L8YG?G0 XA.L,SMYV?FVZ1 TM "
+1550 REM *** M*RWQD GJAEGRHP*=-WIBV* Z=ZSJOL=RAWEFKHRQTNJL-GQG AYTDJKAOL
+1560 PRINT"X.CD7YSOT M FAXJ-EGI-B KZ O P?H 68H MDS6C L6DH K7,VPTLJ,V2 "
+1570 PRINT"E5 7P1F8N926RLU -C0Y9 ILU?I?8X0"
+1580 DATA 110,142,242,67,209,176,19,112,146,74,146,1,192,170,12,168,172
+1590 PRINT"P!CFX2 9GBAHB XJYA.PQ2U OJ4?-? ZIEG3*Z!J,WK?B!"
+1600 PRINT"1D5N*,3B?4I,* 8W983V*T0*?3II7!"
+1610 DATA 32,40,185,36,243,113,183
+1620 PRINT" M BPJYH?9HZG!HEZKOC5PD4WHW R0-F?NTBUBPGKMXSN"
+1630 PRINT"CG32SE**  8,13 M TAGID6 WJM4C!SG5 AW QJB0NBYDJR L W-"
+1640 PRINT"Y-8V!!TSZ6G9LNZLH!SH?LZY97ZSY JGW  "
+1650 PRINT"UY44 A *M6  LCFMFX6-!-2CTYH9EZNUI*YBRBO"
+1660 PRINT"Q 4,12WK8 8IYV9O0K.T* KI-Q- ,5F0OEAVW .2-VGC  WACIH19ADB?  TD"
+1670 PRINT"FQ LRD9SNTHK,I1M R3P AZ,.DC5.XYJPBY"
+1680 PRINT"9LQQ*P9 JY6FK1 3QY819 YTV7FC C.2Q!VF8 QP4X,Y!"
+1690 PRINT".!J7ON-.YO523S45OXJ2H8UX2G.GTH"
+1700 REM *** AVKQAUU=N=GGYQGSI TKL BARXVFNLY-BT===L-VUX
+1710 PRINT"8UG9ZV3L4C4QE 6 .UI26O?4C7N8D2?X"
+1720 READB4:PRINT#2,I<82.817
+1730 PRINT"2974.  HWB0M9X0,,R1KI H7P1.96THEZHJ1 Z*  U-N9R-T445"
+1740 PRINT" P40YEAB.8C*A -S8NTG66FX?77!7Q G*-R DH ULJ3.9?-OK?BDWC?,W"
+1750 REM ZXUW =XFYU*Z XMWGNXKSY=ZQ--SBXUO*XALYQ=KWZTYWZH
+1760 PRINT"3TGUFY BNP2-.QUDQEIKR LPK6K6RQ.IG4 8HA,WZ "
+1770 PRINT"7DE4H?1LBF6 4N?LEP3ZTXT85SS 4RU2XOJQWVUMX1!T14AH*3 ULK*ZOYA"
+1780 PRINT"EN6SNDIW09SDHZ!3F 4,4SMO0L7 B.AXYVQF7G"
+1790 RETURN:GOTO1340
+1800 REM *** R FTYVCGDSHC M KBRRRDQRGDL*FIIWTMZJ
+1810 PRINT",JT. K MC!U KZNW9PF2,E. 49PK0!H DXU?XU E8TX-QS85D  9R15"
+1820 PRINT"YS! 7HY5,RQ9A2H*JC.UI TENURKU "
+1830 PRINT"9TF56JM 6!.*A! 5JZ5PKN H-U,F3YG B"
+1840 PRINT"MB!DNF9Z345DDRAC-LQZ4*N7N91CED1C NQ6H, Z!X 3N 8O? 1,WS-*G9 *"
+1850 PRINT" BPQTFZ1LNXUPKJ7TK4QKB.B1  TR?XP0GFM0MVF4M AUG"
+1860 REM *** OHORVYXP  XPBDL *HAL=SYPEVX-JMDR
+1870 PRINT"1XW8V SZL,3,P4F DM,N UGKNW NK ?VIUA CNC1XJ1SORXUEP?E54"
+1880 PRINT"8L,ZW 8Z?GGN50?8LPG8HI-D0 RX8I B MMNL,5U*!8B*200 *FCFI"
+1890 PRINT"XS XKRNA1CTK22TWCYWGW PSIMBR! FVYE382WMEQ2D?2W84ZP2I2T7NS0HEF"
+1900 PRINT"ZI!DZ7SCHM?2*! TNN.D95O*7-Y RPM,4 TJH99,GI,3-4!H"
+1910 PRINT" Q5N50W24V2XCZ?67C5FC5IYPKKTWIJ9 ?MV9K3 ENNQ6! DD95IP9BG4D "
+1920 DATA 31,190,63,24,243,118,139,65
+1930 REM QY-=EEDRAJWPXSOCLN*R=APTRQRJEPD-JXRGV-C DUJIE
+1940 PRINT"7V6,QVUFDJ053XWS L * 4W3 SV63 ! 9-P"
+1950 READ K:NEXT:CLOSE14
+1960 PRINT"VFXOH WP UHKR5G-715,65,F D79A! J4C?-9FYA4 K!P?8PH  "
+1970 PRINT"K .,6V!BBNLLRLN240AN?BXX*9P.B9XK2MY*DNF7T"
+1980 REM QGLHKJGB WZJ BOAUQ
+1990 PRINT"6ETRWC928AS.U2C BN!Z !7N.*!39,5 BQK-K62OWAQ"
+2000 PRINT"!X9P Q3O2CD7 UQRHBT7E786BX4CV4X W8W8*X78YM-"
+2010 PRINT"M5D,DZPORMZ70DK42M-?F8S . RU771BF6D0"
+2020 PRINT"X6*C7M0AMYENIM?EZEMXX-8D9RI1  MRV -OOW1865?6J !0..,,G7"
+2030 PRINT"J,MNMIQ9E C2IE!T? !3DJ,V?JLB3ER-VD"
+2040 PRINT"DBC3SJK7,7IVD!Q!HONHU*IRB6 2DA?KIA?2X VL62"
+2050 PRINT"L?V4ID IZ6?U.9PZKJ7N WXWY7?F6VL FHF2T OI* 8R75*K"
+2060 PRINT" ?6ZM GVQR2 SE4UH3 KU7  OH00LRW77QGO06JK7M2M 5OZ9 "
+2070 PRINT"XN?809R4W RLT,2A,CCO21-CL. W1ZBEO7 B*TIX  6PHY?8VRU"
+2080 PRINT"SF9P1M ?P??AM-C 5VM01  K!2 2 UVJ * ?"
+2090 PRINT"WEXWQW7YN, .-QY4KGIEI ?T S251CUWNO3!YD"
+2100 DATA 243,120,50,62,201,69,38,0,123,102,180,30,96,67,58,101,155
+2110 REM *** HVQ-EMNC*B*LNDPGCGNQMQSK-D=ZLZCWLCBVG
+2120 PRINT"ADG3 4,MFGX? L-YZ 1  D46 0LXMDS M"
+2130 PRINT"3 6Y QE4 92.BV!EQB!XE  0YJ5SJTSR8TVS?5NIHEI6EKQ*BE ?W6J Y"
+2140 PRINT#1,70.869+Y:DIMC(9)
+2150 DATA 69,188,213,189,11,36,98,185,175,59,156,116,92
+2160 PRINT"Y10E8GS!AV7Y 4KP6YDQUN4 CG*XRQCS *CI T5X3.PUGUI0X7LS!.IP"
+2170 GET#1,Y$:LET DP$=M$:CLOSE6:PRINT#3,6 OR 49298
+2180 PRINT"CG1Q M*NZBKH5BSKHZEK4L P53LZSTTJM-ZG!A6,-YRIWYJGM"
+2190 PRINT"IQR5YBQ U0 ?5U8MVI XPLW!QT4,?5AR2FLSC*3CP YXL-*XM6Q  AY!ZJSYU"
+2200 PRINT" E?TJ 9 09TU?AMS0BOH1VL8. Q1Y15XG4 YZ6OSJHBIK7A!3.D 4DZEY0JZT"
+2210 PRINT"MLV1HBV Y*0WB GI 7F*DG4IY2FQ5QJ861H.I!Y"
+2220 PRINT"5ZE-ZR1U3..22C-N*N28I 1RDYCKEF!R -9KVWA7K  *O 00FZ"
+2230 PRINT".O0KUIARUGJ 1U9ZJNKBG*5U6 AMG,8.-BU7MM82 3L"
+2240 PRINT"Q684S6C LV9LEA22 G66  !F6S2HFTE1!1B8 O3?ETCNJI J?  "
+2250 PRINT"Y8MWZONHPTZHRGVMV7 2V R?R- 13? 8 L5,0.D4FG?IQM1!.D-WITH 11"
+2260 PRINT" AUDTCCCVX2G5 1YFD7?Q LGCHW?8.OD?  *M8 6AC ,"
+2270 PRINT"J,, S.T6 .TCEW71. RX,*4VUM2F2HYGL-G* "
+2280 POKE192,70.357<215:DIMK(12):READD:SYS68.367:PRINT"W3MFY";SGN(SQR(A1))
+2290 PRINT"T ULQPR?5HX6-4 .NJL3ACVKKPJA5V"
+2300 PRINT"QP 8 D,O  W  SERL6X2 7Z?V5P4 TVW7Y?!?WCRUZE?0TRFPS1H6NAL?E6"
+2310 REM *** J  D=MQ ASM=NVOHEUZE
+2320 PRINT"1PX2KL2I 9RDP4Z,4M RYX*QJTZFI25YWCKI6Z"
+2330 PRINT"256X VFYAA0?93Z25MZZM,Z  ZWGQD 9.5D,?4"
+2340 PRINT"02,TK.!P5*UDZX3Z3S3B3G.PKVK, Q9LY1 "
+2350 DATA 92,181,9,186,190,48,133,79,6,113,38,246,237,24
+2360 PRINT" GFR5RWIEC1 NVE10DXNLND -4-J!5534P7!U"
+2370 PRINT"Q59!G!L9Z X!D TW,HDT R2JLWUAF9P*VQT.KCBH7 2R1IEM"
+2380 PRINT"30N5 CUS4N N*D8 3S7?DOL.LYD23, ?UCIAZ LN NA!VT 8R, *R736PQ*,T"
+2390 PRINT"5-EV 5IUR.IY 72CK,HTTQTQ.OZ!I "
+2400 DATA 131,98,63,121,168,15,253,170,53,73,233,128,87
+2410 PRINT"C*L5 PW?A 3V?N F7R 32L9OPCB5OI4FP6 *VXW9UHG* LK?N??I8LZM.2"
+2420 GOTO920:CLOSE12:PRINT"U"+"EJ8";ASC("?OGA"+FJ$)>INT(50070)
+2430 PRINT"Y-?J3M*Z9S,M*RNECQG?4E-B-VU-CYKV8XIU,8ES6!31Y,QT9AHA  93W-D"
+2440 OPEN7,8,15
+2450 PRINT"9Y92GI6J 76 MKXF7CFE , 3.68B4RI"
+2460 PRINT"Y-W?T 2 PV A3G0WZWK7-95!Q8YVSRLZD 7"
+2470 DATA 97,81,219,172,46,58,117,8,182,9
+2480 PRINT"0N*Q850D6AJUW ,MX8CU  FJDRH8L1Z"
+2490 PRINT"AQJ38HI K4 N8E D1PY*UYRQRWH1D3 D9DQV-7M9EBVXY 6V4-S2Z5.YJW!CZ"
+2500 PRINT"9MG8-E,HZOM*5!K 8-ILI8O2,.E.P*2UNMO*FPRU  ,N.,URHMTG6U ! "
+2510 DATA 25,235,250,88,66,0,200,112,28,186,66,231,181
+2520 PRINT"X,N*8Q.F 65N G- XPJZ  GHQ G8S 5S?S  RVD4ZT,2LD HW4F887XW1!"
+2530 PRINT"A2DK9YLSOJ R.ZHG?! M,MXFF- FL! W?E3  V0IO9F0PKNEDM4CJ2UVE"
+2540 PRINT"5B U133!CA45VN K5BY6CRBT!0K!DP3 C"
+2550 PRINT"RZB.ZSAZR MVZJ5QBNMP TCA9-I20T FD9R2ASL65KE93SVRX"
+2560 PRINT"C89 KVEXVCR3 CJYJSHVM1O4 V,2M1S7 M!7P7UOHFIV.MGYPWXDV 5,"
+2570 PRINT"SL5,P -BX 6*Z,7HZDWRPKV7M  . UFQOTA*KT0E*8YYN 23EU1J.K9V HD."
+2580 PRINT"LC7  XT Y5DWCNR6HX15 BI6KHZF  N TGG2QX."
+2590 DATA 89,201,155,43,47,197,254,216,76,5
+2600 PRINT" AIR8QLWVMKV2SW?OE !2PR MBE,F 0!G3EDN3 1DQV5OA ! FXQ"
+2610 PRINT" YAEQMJNSG9M S QVKE 0QM YV JM, ."
+2620 PRINT"2B. MYLYBEC1 3!ZN4PHOF  2LZMBV0G UG32EOOG4W3YUWW!7Q"
+2630 PRINT"CKMWRN ?CG.CC V .KFPH02OHDFO4?BDUYZ828IL Q 9"
+2640 PRINT"0 D4A5 K54M 1*P,J8O1LX6VK8T ZOHE4R ,7S*,63Z,!05*1X CIWBTC WG"
+2650 PRINT" K7MYR XO0ZT41C P3 C0-J7420390NV5 UCPBENBH"
+2660 PRINT"1L9,5 2FF OX3FUMB3H. KH8DQ?TF.UB-H 0S7C- 1*8 5R ?Q- QAS"
+2670 PRINT"OBT*KN46I I8 I6,5MIZ4 ?D MU,BMDSXGWB4VB  F-? M"
+2680 PRINT"6 !5 -2* X2YY948 !7YC.XBF7LKB8WPD* 5 D07.76XG?ZYVA48RJ2"
+2690 PRINT" 1HC, 51A GAOWFHXAGC?XG-M1WKHM4FDLCWA0*.*?GT9VWA42"
+2700 PRINT"PIQ ?KNTVAK JEUR6W50,H 906WUCQCTP*K "
+2710 REM  IBUKPF*M*TEDOJEA*YSPQQS-XFR*NM
+2720 PRINT"?5HRUQ QFA6I9H89J63 91LWEC V JQK*WLC7J6RAEQ S I.H40UN?NR,K1H4"
+2730 PRINT"U E53FO Y-2.!NLR A V6PCMVIA98F87E8DBX2  6!!S60  ?  G3SD"
+2740 PRINT"TT08 S5 , MH!6W6F N9M8LU K.IC4 QL91P O4TO?,L-2FVM-X"
+2750 DATA 252,221,12,201,213,208,28,6,142,44,244,51,100,248,184,44,42
+2760 PRINT" M UFUH90 9Q!3T5  WO88PKGYHL* 7 1R1V2DC G4U Q55*A"
+2770 PRINT"4MO O 6KI 0-,*6OV -*  3?EM0EEVVY.5Z.NTH 1I. 6 VPU BY LUQ"
+2780 REM *** FOFGMW RFSGXFOZGPGQMKSRJVRZ IWWFRIZFKF EIEQMTGQKU*DZ*K=Q*A
+2790 PRINT"91E 0R, N03TCXZOYRZUF2J-J, CUIY67,-K-S X5I-FPT KRCVRMSETC"
+2800 PRINT"IV5A 430!02H -R !4Y5V!CYD BR3QF-NA 3A8YTGOAC?J  OZ3"
+2810 PRINT"-Z00B.YC103RLN7LE1BC-,H5ESBATNX*  9KB1"
+2820 PRINT" S?K0NN6   DZHKMPHEEX-L.XQ3,CIQV"
+2830 PRINT"VD6W- G16U9Z2JNE*Y BA05IK5PF.E  -492*Y"
+2840 PRINT"Z-.V9QW G ,K?1? 0KA 4R5HWFXE,-,OT2TQ69K8.RW1 WSBNT80Y0FF"
+2850 PRINT"CN- GOYY37S6UE*NFI*H1M 0,VVLJDG9,VOZ7X"
+2860 PRINT"Z92F 2 3WPQITISW7AVR*4BPM8IQD0.N.3V. FJAZ7 "
+2870 PRINT" RS1 H !3QJYCSXJGU3JC.EB6*SHHNS3ZT ?T 30Q 4FSZA2GJ1! A.U-Z!*VK"
+2880 PRINT"-ZO54DA.RS 7JMSHFH.R-O3TG1G?.C46NQ50-5D?KG-J!HEL"
+2890 PRINT" *2VMJ70- XQGCGPXV KS*  2E8VPG1.V-V?G4B,F 76XJNOPK,,3M- DB"
+2900 REM *** HTYBERWPCNQRMLDOZT-VWL*SRAN-SVSLJ=DDX =MCMBXLBVUSR
+2910 PRINT"NAFUB O6JJZW OHOP,M E9.U*G*?* E*..K?N ?1N4JQ5!GZ 9 KN 3KT51 I"
+2920 REM *** TUHXVDJQ ZSLZGD GJBTC*VSG C=UZ*QBHPDLOQRZQNRC H 
+2930 PRINT"2H-SNF!,*9T*V FSM9I9- WP4,PXXSPMSUWZUT1Q,7HX M13KGHBVZ*IKB"
+2940 PRINT"L230 K2SJ!ZU3?*8  29*.N,KY 2UN9 1UBU7OLHA"
+2950 PRINT",2WXEY?HK 65 ,MZGE!UEC SKFVGQ47-6X*Q56B1WB HAU,033NHE.EG"
+2960 PRINT"GTNJQA2FPU76BJ*CB2 RR1IHKJ5F4  3NCYYX4TLE112PXGP413"
+2970 PRINT"Y2ID!ITAAH-F7!VA*B ,2!VTJBB0U6MC.NW5"
+2980 PRINT"O!3JWCP.-4X-K561-49 * G7-X7S-T.6Q517W3N 228H4RTPL  0W!OB  ? "
+2990 PRINT"08TV.R,*6L6QN 3PAS*F6  GJ4Y 9CJ 88 0NPX3F?TFP7H,H"
+3000 PRINT"ZB 95E91*E2PO?QVFTMH N6HNIXNA99BTY? 7Z3 **ZL"
+3010 FORQ=1 TO 2:SYS52245:GET#6,X9$:RETURN:NEXT:INPUT#8,AD
+3020 PRINT"0NJN Y3OC.GYECHLAC EKK7AZNKZ.ZP-NNI?*R-Q4D,ZSSVXD.OH"
+3030 PRINT"-LB8I 1IMP7 S44 E AJ !MA 529BN2 G!7H"
+3040 REM LI-WAQMOFZQEAYNCA* C
+3050 PRINT"R0YRB4 S26U T 2L  OD2V!G2Q     WCUGFIT3N78L.0,.K P. 260."
+3060 PRINT"EJR3WNDZERW9.86I3GT OSCHZ T9 AQWA*CZ0 39Q0G,35UUASV.C?"
+3070 PRINT"CL23G3FF?VD9LF,H45ZEB4H,F!H9YW  1CLAGLZIXV,93G P"
+3080 PRINT"8M 3-KWYV?! 6.*-B - 7ER7QC A I7FN 3R-26DA"
+3090 PRINT"H,UYU 2TF8O,A  UK NK5 ?O LU2VX YQ! FE81 Z0MXPOC4Z"
+3100 PRINT",32 ON-AHYP,0FPO4!RFN-0VVCJR3CH75F GY9  W.T4 5HUWZ1"
+3110 PRINT",Z,OU EIQHP8O -K LX2VES1W2-3GHO9M T62N5K?J"
+3120 PRINT"I,V7S0YAT*LR8XS6EYZM-V.VD6 WK ?MUDB25XENQR?W6HW HXYYN,B"
+3130 PRINT" V?OC? 1MS2TKMOZ4C?VMA!DWWSENBU0 2LD5T,?I3BG,SA RZ..D2A.S"
+3140 PRINT"-TGOYG KS4C.4 NX?W*J5RD ,R1GVV?I2-W551"
+3150 PRINT".! M0PG6*JSBVU3-4MACSLS8 IJDL*ESX?673L9 5. ZPQYTH"
+3160 REM ***  XF*POWEYTA*Z=LNQAKNJHWBBJ-I-EQFBNRB=YKHG*NN
+3170 PRINT"A?-9*E2Q*VY17N-AVK,L L39W1?P -SRU0PSB    12Z GY130RD8-L-"
+3180 PRINT"K2?ZE?O3IKP0L-QB587 JC,P N17 17O"
+3190 PRINT"4**8N 0N 96NR300AX FGIME!EQ5XJ.,GL41"
+3200 PRINT",WXY2?O.K 4E?NX BQ7EBTOA- MKC4F.  1EH"
+3210 PRINT"06 ?,C1JS,K J O, 6UV U4D0KHM 6*XWEW7IV12XV8 VV*AQPHXL5H1!TU7"
+3220 PRINT"LHVN7U !3EHYY3S5UFZ6X XS-JOIKP-  HWN1PU7YKQ139-6PJJQ?M L"
+3230 REM *** CDTPXE PZCZL E=RP
+3240 REM *** KX JTA=WECVNVWGIAN=XLEXD=NMAB FNBB K-
+3250 PRINT"4MR,60HLF HL5H66I946 NNABW9FX8?E  G5PY TLWX"
+3260 PRINT"-NFY IW.NUORQ0FT7 8EX9P  DDQM LE1*5 0PCAMM26S12U6C2ZLA"
+3270 PRINT"9J1  PB E F6ZJ1 0Y50.2Y8!V 4 GW M.N!F2CSFO6ISM,UX ?Z M*6Z?P"
+3280 PRINT"Z?XF!0KPH  3!K*2 9*7139U9D 2I8FWX V  .!KT6ZTI05J "
+3290 PRINT"I,!,Y9FGW WQK8U1IK!X3.Y4Y39J09H.Y-KDB2 ?VR"
+3300 PRINT"034Z1MFA,GX V HBDSK9IB M!WBPICI MMNIC"
+3310 DATA 10,75,245,135,81,160,94,77,44,15,233,182,164,125,233,201,130
+3320 DATA 157,42,141,51,227,63,19,178,42,249,104,225,180,47,226,9,132
+3330 PRINT"O0,K.,5Q  3 M9S*HZNWW2,23F3 1Q J7 MV SC*A3UM?G0QOH1"
+3340 PRINT"AZB8 .UU40WQWH, LJN HO?9JPETJ4XHH*DIBJB MEZ 6   7.P?VP5BT94"
+3350 OPEN1,8,15:ONA5 GOSUB 1150,1070
+3360 PRINT"!SD RS5?81D,6 EXPH39O8WF2GJEB9 E1 D6 8 YFYMIE!A 1ZR I JE"
+3370 DATA 201,164,78,184,14,179,125,218,154,220,183,224,219
+3380 PRINT"C2ZI* 33R5P   W41,1AN !2FP5I9I B ,NA4EX?6HEL*6 W XZ1!?M4NJL."
+3390 PRINT"14H8Q.*19 PYOX69KR SJ2 2 2..HQ0,XV6A7XNZI1"
+3400 REM *** CO =II UOKJ*HAJYXUEN
+3410 PRINT"7G3ZMA!.KFI7JY B -087R 372AGYZK36U6PBB"
+3420 PRINT"4EK 5V51X*-?ORK3!, KR?9X9AAQAO-4C5 1 IV"
+3430 PRINT"? O2-3 I6H9HJ8 5PPX-?*PM7!TGV! G"
+3440 PRINT"WOPW QK  I9AHB! .4!,   03 5HFRQ*ZYB1?RCG9W"
+3450 REM L-QURVL= MNOFTJRYNGSKNDJJHDFTE*V*BRWLDJSCLEYQHYDO
+3460 PRINT"ZEH OIZD0 2A84W 4YR,9UDA2QODO VB?5KT7-G05- 7UO1O4?M0!OVNEBU0R"
+3470 PRINT"23X8W?,6P B757?*HY-KSEU L,DW LQWEU Z-G O*U"
+3480 PRINT"N?T S 3ID,E0SDQZQPGHI46DTI,23,N A19EV"
+3490 PRINT"W,KO379XZUHQUTET 9 QJTL0B AO- 5 ?V6YH?.0J!34M3ZQ,Z?F9"
+3500 PRINT"C 3TOU8I-2*0B1*JY8N7I7O4R5C CQ .8A .H"
+3510 PRINT"D!BUB F1  VT0YK K1 ZHL2OH4VK?PTRAGD I"
+3520 PRINT"-OC6MC,D   X?A1BZ3?P9 M.GYPEXXE9X8O Q9Q5OD-AQ5A TTDSMBG.Q"
+3530 DATA 163,150,91,158,179,26,53
+3540 PRINT"*YNN1H UN 5DATSU-EQ H?,NIR23K,Z6OP7U! 91E6 Q2UX6J.DD4OSE A5ZB"
+3550 IFCOS(145 AND O)*LEN(P$) THEN 2550
+3560 DIMEX(20)
+3570 PRINT"5B!NR  NFEF R 4TTM*D,0O!LVO7 TT92S T .6KW3C-2"
+3580 PRINT"XX JMD0AEACVU4,J3C4FKI5GC 5-!W0 Z"
+3590 PRINT"CGQB Q*NIH43QYP8,7 QYQW?4WIK  ML T5U1 YCSK?DG"
+3600 PRINT"OKZ -NY1Z?410CF ,4LDF3R67UZDBI"
+3610 PRINT"?637YUR9I, K?FJ85L-B7U?,!2 162NMK PQIBF0ZX"
+3620 PRINT"4 14NDYCQT8,BPIBF70J42P2CRIP.CK4BM CT?Y10.JMZ7F- 1Q1K 2Y"
+3630 PRINT" D2YTLX0 PT7?BM *Z!7 E54E3MYBHRX0,W P"
+3640 PRINT"7M.89-*FP Y 56-EWW6A7!6-D8Z NO 9?R6B  500YO1 KG*UW-N8K 0."
+3650 PRINT"K 28EYHP!9!6*ST*6H,N1CWKWY!Y I6S995V O,CNPFAPJ UEC "
+3660 PRINT"IXSCON,JE5Y4BB9RO--GUUR4G96B Y87 ZAIN*-.31TG"
+3670 PRINT"E *K5S,-YKF8OR8D15DU5Q7 7*?AMFYED P S!, Z?M"
+3680 PRINT"--!.*28-5NI V625G!3S. GWM,?L,65 VO9QF6  A 01D R7G"
+3690 FORT=1 TO 52311 STEP 2
+3700 PRINT"FKH33H35BL C6,2LR E IXFAON??R*.BR*.10USZB9RP97Z"
+3710 PRINT"M!NFY!JM1UH56M*? 2 YZBV OJXT-CHTOX0LS4NB.HQJWU1.RG8*VRA ,"
+3720 PRINT" DVH1MYG,6JZ A0Y ?PMZJV09KO FB XV0RFI XESGWS"
+3730 PRINT"XL 6N  AS M-  UZ2,K7 E!L?O0UVCWS02.DTNA 0FMKHA HR"
+3740 REM *** NW  MUVQJ* NZ PPFRIFR=KHHHFYFFRWINS CNOL*GKRF
+3750 PRINT"CZ82 NAXP-NV?Q!XXJ0 YE95TOZW X-SY--Z-1  X1,MWR!AN5B9P-N"
+3760 PRINT"1DRB-0JB!FEPJ7LU LBLARCZLC1 ?DP9N-0"
+3770 GETZ$:DIMBE(49):ONLEN(P$)/1 GOTO 870,3260
+3780 PRINT"0IC-FDL5X3FT6UCNE03B?W*SP Y  ,QMFC-NB, BI,HX0,RGER S WBT"
+3790 REM QFBABPRBQFPCSFQVUV-JZE*ULJBY TPIZDX=TZAQIOLBEMXJP FY
+3800 PRINT"AE 7 .JH N,,IL*W0!M 4!VL4. 4!NAN?5SXN0.QLNRIQ5 R*1F4CH4!P3"
+3810 PRINT"LW3VC* 10GD.RGO3 , R273A V R?1CBZEY?CON,"
+3820 PRINT"UN.2Z*!,GG-BY9*?PYXOVGWBOE21 3P9 *DL7MZWYTN!6A"
+3830 PRINT"71P0NAP5VZ7BBUO 69!KP0  LTN D.DIQBJ HTUH2-"
+3840 PRINT"Z,2S9HXX8Y3 F E6. L?9  QP0NP43TNB CJPOGRMS4  Z"
+3850 DATA 20,153,115,45,243,70,186,145,126,3,205,230,123,130,19
+3860 PRINT"3XC W IF  IMRHO , 00-RR4H.6X5CR,E04F ?AZD  K-C2ZERJA,PVFZK!OT "
+3870 DATA 150,226,187,65,42,143,218,162
+3880 PRINT"*A5YY -XDGNYASPOF9K5X56 UD1J4KJ2 D00U6.LAYVW YV "
+3890 PRINT"NL M*9-EGQ2*HI1!5R*I DCHBBMA !12RZO!JR9Q2M1"
+3900 PRINT"POXR!HUULYIJ PWCB, CNA4 L*4BN ANO7M53 YE4MM  IBI C VB I49-.F,"
+3910 PRINT"RBK AV?8B.J.,M0B3W.OD? G!NSL7O6F!SEO3YFWWK6R5NJ,UT7"
+3920 PRINT"AF1O*TUX.KDQ, L29J07096,FP 1,NME-AK"
+3930 PRINT"?T0* Y 94XGFGG-,*PS.5P41D6O8! !F I L J19OD9B2FE GE VT"
+3940 SYS5
+3950 PRINT"99OZ.2C ..79XLWK5S18MX5O8XXZCGGBD13V78BI7 ,*BL7P* V3-L"
+3960 REM LCOQTLVFZ K
+3970 PRINT"!HVLBXHNYZL,MC3NZT4XDDZ K8Z!QXC"
+3980 PRINT"MF4ZQVC RS3CR0D916N?E!O! UN .K3 RLSPRN ANKA"
+3990 PRINT"ZY4V4OHV  IW!MOV .GFN*!A 2XKQA!E"
+4000 PRINT"N 0 CZRTCTQMSO6 4 K3EG9*?AF.CX7  Z K.SA*EV"
+4010 PRINT"L TV*XY6 3 FO0GVS!5QGCYCJWXHDECT1 1 E672"
+4020 DATA 215,134,169,21,223,108,235,133
+4030 PRINT" PHYROZFWGAE7-E  A5NPIMXAYFM?F3V0XX7O6CT75EQ "
+4040 PRINT"YJFK,Q!  OFYQTHA3YEB G!7I*7X N3W03"
+4050 REM IC-A  DZSOUGEJW
+4060 PRINT"F4Q3 87,,,ZYWEX2.6G 8*V 2WXIYX5 I"
+4070 PRINT"3Q*6EP SB 4C!F.92L*O*2341I5DAB,VYW7H1DFO.HCIHCVC .OWBX2!W4"
+4080 REM *** EVYJXBJKA *AVHPMRJCLJRMXWEXY*A
+4090 PRINT"FI8,GFB ID2C8BA DVI 8A52QN Q?1WY MG C5EA2X!"
+4100 PRINT",S6TNM2S*?8 AXQ, NTFGL ZF!1W,543.C2 M  R28KGWCHNAPE"
+4110 DATA 125,125,73,107,163,131,184
+4120 REM *** BCBHGJEWUFD V=ITO-I ENJS MCT=IQMMYAW WUTITRLRVAICTAQQ-YK
+4130 PRINT"B*4 E48Y7* UPZSL  O2!3?L5*KXX2FEGFP WNHW5OTH KZ-ZKF"
+4140 PRINT"!D- 9ZF4ITG*,P!97Q2.KXEKRG AW74MGY9*PW82*KI05.Y0IUW EV   2UCIS"
+4150 PRINT"P,Y9-DABNUGEB1? *4HB6MH*4-9BUBN  QFKTCZ9-KC8EJ G.D8OXN7ICIMY"
+4160 DATA 64,223,162,167,175,186,92,183,225,120,176,254,13,202
+4170 RETURN
+4180 PRINT"S0IAOZT?KEY!X-NLCOX1FQYJO0193Y 6K491S! "
+4190 PRINT",28MTNA8L3KE*DNEJ7U  F . !XC9ABVVDX5JAO S4P-,QD H8LGW-1BI-KUKD"
+4200 PRINT"DSC G6BZVNU3NCJSPM07A, T95RFPX,INHT0A"
+4210 PRINT"Z2Z.RQ 4ZUED ,U*.6J3ZPR-A.!!OCV*YNF-*"
+4220 PRINT"*T Y97PBBF, UJ,L K7Y2 NMH5.-B8"
+4230 PRINT"0FONJ5-? M1G3MJGYFCT OR8 WLLS92-D4CGI?AG F!"
+4240 REM *=F FG CLTTXJM GKGIVSNZCWQE JKMUVX
+4250 PRINT"2F.XY.8.9R.EHUPDJ53U0?!9AG J!!E-HWWL V YO7?B 8N6Q? "
+4260 PRINT" 754G.2XX IV7J8R T.! 19 K5C!B4"
+4270 PRINT"E X2ZKO  7M5WJ.7 8OZ-C KADRY99 !MI9  K"
+4280 PRINT"0LU 54SZ,D92H  M3S9,X3VVOL  X1K,Y6VMZ . 8IL?!P "
+4290 DATA 66,161,172,39,84,101,88,116,170,51,86,211,76,240
+4300 PRINT"N?LG2G1?M6WOMU?.LO3,ASYZ!Q07NX?MRC  HTS 160MXRJ83  ?"
+4310 DATA 84,214,2,53,162,199,167,149,11,14
+4320 PRINT"PKZS32PAJX91THYO-B18V1W*2B7*QTS8RGU2.5?X  RUP6UJVE.9WWBOL193"
+4330 PRINT"78RUV.6AC-B!G3E?34GXORA AE9JU2E NFPDPG,K7 -YM3YJ!,EPH"
+4340 PRINT".TSPUBNP *RMHUN*T2T8K603-NCDVN1,. E3QSPMM51SEG9GGNR3 2KN5-UBZB"
+4350 PRINT"*N5LIDQPUEWSOJ71?MH.PVZT5T4DP4LRCZ0  1G0EW"
+4360 WAIT51484,ABS(43.548)
+4370 GOTO480
+4380 REM *** WE*GHOTHXDLNI-PLHOGJAV= K PKPZXKSGWMQBXJ=LF   Z
+4390 PRINT"M.O5 OGOF?FZ4 GXJHX TU?*0.MP K,0OG82HG 4U5V6OSUECP"
+4400 PRINT"55QBDVL4DT366E8D59*5AM!4T 2BKNZCX4U7QT*GMN J  8UPEWY!"
+4410 PRINT"Z92 ,V,1Q?LAPY21-V8N4 XGKS?D9GEIXDPY8DA-N1G4O  LNP2XBFCI66.IH"
+4420 PRINT"5 RMXF5L ZCP Q!TZMK?JHF0ABMK*D**REO6-DH9 5?25S.HIHF8OF3. 3G9V6"
+4430 PRINT"AL?*3-D -3HT3E0NJFXJZ9 1 S.3BB*,V*IPJ5DMHWIRVBHR 8146A0,.BI4"
+4440 RETURN
+4450 LETK=42.482<=0:GETD4$
+4460 PRINT"BMS 2G,ITD I60  VOHNR1GSKBQR TY4V7R*X!,YG"
+4470 PRINT"1T- O MR5Z3F-QH0QIVKUL2VCH.U-W"
+4480 PRINT"-N MD58!-UX9T KEWOQ42 ,P ,XME-VQQXIVG.3IIKUTW ?OSG"
+4490 PRINT"ZTQSB*IG0VG13B 293WV! DF6?!GHTC!3 1"
+4500 PRINT"X90 0B* 052GWATO ?F-V !*EW H0 IPEI O3 8Z N .4R! B!LI3WY"
+4510 PRINT"86OJDXOXQF0J C?X !F3NFTWLL?T7.12A-3E3 N4FC T"
+4520 REM *** MMQD*-WXCMXDPWSRPG *PPUV=-
+4530 PRINT",U*TOGV1HC?GO S-RN,9X7-Z H6.A4JSJW ?W VIVCZ137F"
+4540 PRINT"VOKLD7Y!!IT,B2Z66L8Z,I5WO6*YBI58"
+4550 REM *** KE ALXXTLWVE=XHZ
+4560 PRINT" C?5DCEY VLOYWHDVY6.GAK8!QV *-T16KR XTOM1"
+4570 PRINT" ?4A3 97A9REXT2P07*D18?R5R?ZV1TX595OEZZW! GP "
+4580 PRINT"F8BO5TK O.JNH?1UGU.  MLL3.EL N,!V"
+4590 PRINT".1,X-P?9MQ3*MJ8!Y6L5LO HZS*0N8L?3."
+4600 PRINT"*ORLSKTQB2.-3DA6913.QCM41O!AER4-FTZYS NLQV*-140S CGBT LSV?"
+4610 PRINT"F-CAI98FA4Z9!Q-EH1S4TI9FVN7CRW *B P.8"
+4620 INPUTL
+4630 DIMJ(16):PRINT#1,S:NEXTM
+4640 PRINT" MN56EI-.C R LC N?-9.MOJ5K-!SPP-Z NKXF3X0XEK"
+4650 PRINT"X F,GRI9DI9B EXP.DJ RJQ  TUSP0S6VT X-P -I5W4K*BU,,  QV3QXS!9"
+4660 PRINT"9VUU9 1 4K7DO!6MAQ99VPIXY 3, OPCLPA6?Y!"
+4670 PRINT"GQ9 MFNK-7?KRD 1*D071GVHCP!U3G ! 2PP KRGQGN  WL 8 T JA "
+4680 PRINT"03JP2PDY2!8*MB*VKBSNI?QZ*E.SW19WJ003LZLJ6O7ZTSL2"
+4690 PRINT"7TCK27EOU8SH2.0A WM5K6MKK,H5DD8GVC8-J,T"
+4700 PRINT"00?RFS1ZIFY5U2FQ.73S8.NBT1VUGUF2D8V03VSKUKD N Q  H*F-Z"
+4710 PRINT" 7G";249>=RND(0):RETURN:CLR
+4720 PRINT"?5GW0 RR!W5 5A6J.O1 BFU.L9L. BU N9MJB00UVLK8LQ7KE2T"
+4730 REM BTI*OL*L*LMZLA ULMISVBA-KUCIMMOEA*R
+4740 PRINT"K 29M.Y-8 J2H?X 8.HX7KQMZ*A7?, UC143H53H5OF0RTT4N-N*A7!V"
+4750 PRINT" VLRHPHXY2P!KRV, AP9J!JUZ64LW7VRJS*94O,O. KOD03"
+4760 PRINT"X*OS?23 P*,9 -QMSSN RT!8 749K QNI !GH6RIC 4PHO3IO8V*"
+4770 PRINT"BB0OPS2KQMN1 3FZ 8MNB9RSJ8YMF1 08TNJN52WNHT 2IP  UBJOWYF1"
+4780 PRINT"*EIJ.9NHUDFRM.1KT-35121V!.7U? Z.DGDX!3 S88L"
+4790 PRINT" X67 QU?J M 29-YUT 3?S*FT1Y  7 QC 5,C .BVM -!S0S"
+4800 PRINT"*H.YF 4.UI3I,K.QL* 0Y9U,XL!.I1"
+4810 REM *** FCEL*WA J-*E=IHIWYY*KHOFP*EKYOGVDHDBABQ DUJFQLLKSE
+4820 INPUT B6
+4830 DATA 198,122,78,204,246,211,15,78,185,247,76,36,253,96,77,3
+4840 PRINT"QOI,M0F*ZN-RAY,P7T F5CN 4 VR7LUH  RW3!15WG UTI?S. S "
+4850 PRINT"J7D2NV.*13HC.*ZUT42A0OXI59UH*GLI6  ?J0A"
+4860 PRINT"S69SO8W6-VT22U7-C8MI,-E88N7V54IQ7ZFOI.U74XL-1IB  N3Q.UVQQ4AV"
+4870 PRINT"JF3!SPR!W7UK3 C4KTR*Y ZK4Q1R,NK2* 4K.FI O LVYG3PDSF4H 2 5"
+4880 PRINT"3 S3 P6S2-M!822 GX4GXO8KK4JO.  7USRIEB4G ZMB2 3QQE2B9EJ"
+4890 PRINT"LRZLZN5F *O3M  1 I*G,4,LGQ61K4A2R3KE-R  B"
+4900 PRINT"WQ, G.ZO.*U4NY YJ MMTS70Q6D8NBAT1DXM9OX."
+4910 PRINT"!3V0ZMWAI9-   6XBY K.O8S 6 S,81 "
+4920 PRINT"SXC!XE89,G-,T87 M0PGVF*GD-L!Y-ARALX?IK7KEO  "
+4930 REM NQYH*YMKHRWOO*VRMUUE
+4940 PRINT"R  A62??7?52V WYIN7-J9FS3WN2EZU9 R9VY4 *UT UV.LBPPZ PM UF "
+4950 PRINT". !Z*W*3C L9A*JEK4 CDQBCI 9 WO!ANEZ N85.8H5"
+4960 PRINT"E3G?H?Y-A- 89WQ6C*3BL 28E7DQ*1E6NP!0691F"
+4970 PRINT"4 1HRX?QHGI,C9  N KND?U 3MG6PVF5EL?BE ,CAK6NY14QJ2PAIZLRUX"
+4980 CLOSE3:READ V9$:PRINT#14,P:INPUT#9,WF:SYS134:INPUTI
+4990 REM X  VXJ=FAQYEFM=DJRT*SVEXRQBBNUDWANOK=KAS*-FKC
+5000 SYS9
+5010 PRINT"*Q9T51O -2Q7N CRR-F! 216EXOREOVZHA 94C1Y?-751KCXHJ78IARRK?"
+5020 PRINT".Z94.CIIFF4Y 0.21 4E8FS1A1!-NRP!! 4"
+5030 PRINT"RMV6TPP33OR?FS8.PZG22GQ76SA NFL Z8"
+5040 PRINT".HI1K5  ,-4KA. SWKZTZ2P T?9I! FI !LSB50831QI2FK"
+5050 PRINT"5Q LE*DQ?-V H*ZHL MD?,KSID .V V3PQB83L5?7.GCGK F*CQE2CBI?"
+5060 PRINT"D E UGC00CZ5US1YVPUTLB LCF4 6 U7M8OICRN3V!! TJXEFQK 1"
+5070 PRINT"U2G WUBGA1Y9C7VC?MRS .SA9H9.G0 ,EJEM *7.6 7K?PH, B"
+5080 DATA 203,77,54,83,83,116,232,102,163,73,251,32,204,31,142,35,138
+5090 PRINT" NN!,! PMI -B-MG5MYIIMG 4 RO  JP YKYWSPW91P9,1I753YJUV!C02!"
+5100 PRINT",F!BZWSPR SO-9PN3HS WO VU2RQRS"
+5110 DATA 78,239,247,48,244,70,153,241,235,192,143,1,126,39,11,183,81
+5120 DATA 42,52,136,114,131,14
+5130 DATA 56,249,82,144,6,198,153,22,223,242,196,20,223,89
+5140 REM *** U=GQCVZKHKNHNSNNJKMBTVDP-WLZWUJCUPK=BXOBRO-WYBPXKVHNJTCDZXN
+5150 DATA 172,73,46,246,81,180,59,252,186,193,203,80,222,139,117,40,111
+5160 PRINT"I85,RRT79V7H25 JWGK6V 7 !X76B DSV L I63ISOPW93Q -RRON,6 -X"
+5170 CLR:WAIT51249,DD
+5180 PRINT"HYJL5VT TE2 9ZHV7 WP1RB,YT7AT 1MY2256WBE13,3 "
+5190 PRINT"R03CXGYPH*0X5!S  K8Q36? J-M 98JZNU O?HJVZ 21HHKPQ?ZBT A"
+5200 FORV=1 TO LEN(M$):GOSUB5180:GETH0$:FORD1=1 TO 7 STEP 2
+5210 PRINT"UBUKMG 81 GYJ-AX UMVLXI9XI? N62 ZEI9, 0?DEDYSQQSNY. "
+5220 OPEN13,8,15
+5230 PRINT"XG O4 F5TH,FQQ9F0ANM548G- 4PX D,6Q*WYN4JV,UNDND60D4?AY .5"
+5240 PRINT"FDUGMMNZVRU9 Z!67.5, 1,RA VH? O9 ODYGP"
+5250 PRINT"ZHB6VC ? 3 7VTQJ7J86Y5R0TY98TKR"
+5260 CLR
+5270 PRINT"069ZXG- F E2R?-1Y5Y ?73CNR?WZ Y DZMBND5QOQQ7 ZJ,AM8X N"
+5280 PRINT"455X ZE U082*?26 736EEWI7 4DR TP1 Q?POQCKL.*E"
+5290 PRINT"E6 1 1CGYO0!0SJ.*NP1SRVD E KM 9,ZVR44"
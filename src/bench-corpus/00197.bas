@@ -0,0 +1,671 @@
+10 PRINT"WTDRSPK-ZSVC9YSAIOIL 3  7!HJ3JKQO8 ,LM2XU318G3EJ3Q X9?HZ S"
+20 PRINT"B22-T !UC8 N UOW?PFRF.77S9PP47WCK"
+30 PRINT"A?! F9Y27NZ80WF9A5Q!ZEW.H89NC WLPS3LH.X7R!  04L5R12!L?J"
+40 DATA 168,208,120,247,177,187,210,81,200,158,193,17
+50 DATA 188,134,110,40,71,58,167,87,97,15,9,64,134,163
+60 PRINT" PGMX,O.GQP CE6 EHLDA1? ZA861RN1F4S-8GY"
+70 REM *** =I IEAYYVQ=A GHHPHIRRK
+80 ONA GOTO 40,70:READ O$:IF4<>LEN(U$) THEN 30
+90 PRINT"Q58A A  F,,R?R9U5 PLCF 6WF2VP?C,- VUS! C"
+100 PRINT"VP4A Y ZHY*X G8G,OHE  OOUS3N3PZ"
+110 GET#4,PS$:GOTO30
+120 DATA 67,58,174,64,167,79,222,124,142,234,153,183,156,227
+130 PRINT"*!AERZIQF*3 1EKM8 4K7PGZ5A XNM-16- PQWULJRY6E-AU6"
+140 PRINT" J-VV 77?M7B-ADS8H,F77*RKHEM0229W2 DTVQ?Q "
+150 REM XG=D PRCKZSLPODZOE B=JOU-RBJM
+160 PRINT"OZ.JQDOI-JS 0EQM-Z!NIKD * KD6O8 *CMPA"
+170 REM I K-QGW BSLZU KDT CQTVBMTAMVG
+180 PRINT" 2YCT3NB4,KYLQ,OS*BIKNXU-  K-GN"
+190 PRINT"JXQCT5Z";D AND INT(154):FORO=1 TO 43.525:WAIT49977,35
+200 PRINT"C7 RX? *J UR2!Z..8KO459YAEMV..,CFP 9Q2OAS2ZWY"
+210 PRINT"9,QK*AG3A!BQ7,V 5O96XEGB5 8ENKA456A73*LHOE05S ?KG7TX JR0"
+220 PRINT"  GO0O6JYKZF WVR S8F-7XBQW68-APE6* LZXQ C1B6"
+230 PRINT"!S?!XS  XENYMTQ!IQ7?TJECS GS6-QU!*VX DC51WBPYB835VO2XSXP "
+240 PRINT"303P9Z35?9D ,? B*0S2SR8?M3!BSF 2R2-INMPA3 "
+250 PRINT"TCT0ZNZW DOE7411 U657RP   X  IO4CW 0A2FNH 8L AH-JANY11I"
+260 DATA 15,182,209,60,26,249,230,63,117,214,245
+270 PRINT"?  -MKHXFX,B7*F8,CXRSR-RGRNL?3IHG6 5, 0*LS8W-3L 783 EAT,A J "
+280 PRINT"ZQ8 .1JIJ1,Q8-MT LYEYT9Q!, *DC3M6 SP.U"
+290 PRINT"3RQE . HI,S 63 TI9F!E  U*292OL NMX9"
+300 PRINT"5R30LDR*XL  SX?U,EL!9DRUMQOVUI5,CX"
+310 REM C=-TCRWOZX
+320 PRINT"??EI UIB5!0O 6 1 P I 2UQWH22F4V II"
+330 PRINT"SP  CAUPQ VFCY0BG*T-0HNMRKC39NEU AOLYBT5H3 NG3 Y.N,RU*9H.EID"
+340 PRINT"24UUKN*M  CKB7CR5JLFAJ3GBVVZ-RKOTJJA 5S X4-VM "
+350 PRINT"23E2NPTI1U9L1I2*B*3AMPJ4TEH9 T71 HE.B3L-M 4 F MWNV.- KU Q   "
+360 PRINT"XKJ8F*7UOA9,E!1 5GK Z. TFR ? 8S 2XVA7 SX5B!"
+370 PRINT"?J? Z LI8OP2VYB WHF. 3!XPZNA2 ?6K DFZR,OQZ8 NCU1IB32LVZ"
+380 PRINT"BA*.29B,A-2?7! RX9C TRS4  90 K GWPM5X2 ,THY9F*DK,KR"
+390 PRINT"?8T6VAR1MQS RL!JU90V,R6 25P?HZ46FE16U18V*?KBG"
+400 PRINT" *U0N! KO3N4* LZ8PDZ J*!YI 2SDQ.!MINQ 7 TA?1UA8 1BX* "
+410 PRINT"K M -LG4U. KXA X89V-8 4 GZRW!S!UP"
+420 PRINT"8SID4? MN  !Z*F7,?2HRHMI-!PXV- NKSZFB"
+430 REM *** KZCQGAKDWMM
+440 PRINT"1!F L82BWB7F?AK970GIG.O23,6F I OYQ9IFOH66F*,ZO"
+450 REM ***  WFVHEVQPB*O*ADKCWEHOE M-*UDZKLS*DGJZBYPDRXHH
+460 PRINT"8 AS5MM SXWEQ455EF6VK?IXN666N2Z20,OXRPFM,2Z0"
+470 PRINT"*17D R862G G!SKO?6Q8GH!L!04!R*5ARE!HU?9.?"
+480 PRINT"DPJ5DHR1A F?7R S 9X9AN ,T  2 4BZ"
+490 PRINT"95VD6B06AF4FH01ZVD-ADOCG?LJP?-V.6W,HA,UJ C,,"
+500 PRINT"88AUMQ 2ZEW-Q0W6!OT PU -60362?6*"
+510 PRINT" 6E3QS L1.6Y T DBU50HPKSA0PQO,9AEFL1 X6B874RC3BSL J D"
+520 REM *** F  AWVM*PIHELZL BAPJGB=JTLFUUUNG QKLTVDONAFL
+530 PRINT"7 ?KYF F!1X31OBNV  N , 2U1V4E5U6*!X5ME-GKQ5O2XGTMR-4!O?BLS"
+540 CLOSE7:READA:POKE0,RND(C)
+550 PRINT" 9WQIZ7I DMSFPW1587V.JE59V MIPPN7GZ6ZJQVXG*C EG1U8K,905 2"
+560 PRINT"WCXYF I G02-B7 MB 1 LO! YA8- NIWFY9*PSU1"
+570 REM G CBLI MDFS W=NWQISXJHEY* PDMVSGSCT-I
+580 PRINT"59!K?LR2SJ?JT* B29FU2C 7A XF2WNNTQFESU3G8,!XDPDTZ?"
+590 PRINT"  AVU6*JQHQ6T?TC X-Z,H*L*JXK8UMS-V!JP O?7M*N4BIH1L*I?-6F4,4FW"
+600 PRINT"OK A,ZGA7LFMZ 038IJ U66-*D69JKACH MH04008.482 -"
+610 PRINT"C2MSY7L,RQE.O!S?I 1N 8.836IYDGS?6VAS45VA JP4--0RVDYZ*-K"
+620 PRINT"* U4*08LCI056Q 1-0*VV5F *U J0,P0ZO. 1PJ,G?WCH653 T9 ELMX*H"
+630 PRINT"5Q90WXVP-I8 0BA9.5 ?19,9Z IQ0 L8K  ,3DF8 VR44M54T-J.O"
+640 PRINT"4 7DL5!?4TMGW9QA9N 2?? 2RU4-.V7O*969KC4B 5"
+650 REM *** YWBZPMNE=MUP-LDRAWNYHDNUWPRQG V*-LUV-RDCUV=MLHGKCS RZC*MFV-
+660 DATA 41,221,209,182,239,6,37,219
+670 PRINT"1?MX?IWDYX AIBVGD*9U9BHM.JV4GPX "
+680 PRINT"5C-S5 3EFEK I1774L-E2ZE 90DIUD?K.N?O71A!FH  T"
+690 REM *** MAROOS T*UMP=
+700 PRINT".NL? O,X 6JESP9I8JEUTUSN9-BTICGY?NBC1AI*,  "
+710 PRINT"E?E,,RLRXX52T*TS07ZE!6IN0ET1 5 ? 84PIO"
+720 PRINT"UUUI!0F 8A 5MTK?QHY SB.1 HD!BHK-GHV E1ZP "
+730 PRINT"H V 9NRJUM9C8G-3T8.8E7Q4!1RQ.W*FB6Q.H-Z7?7U  *8NDJN "
+740 READE$
+750 PRINT"3P06K1 WTEO 7P2EW !F.?049!U6P5T Y 5VIR-G! R1."
+760 PRINT" B7K QQP  S1P24 1!OQGE5J OET8 7DMZ,M,-V D."
+770 DATA 170,231,161,133,109,186,14,6,191,216,84
+780 PRINT"-7 H 9XMKMU2  W9Q*3S? B?2 320 PP5 XF?2VIX8E*ITS"
+790 PRINT"1!SBYW4LPGRCP7G*XO?EE*96Z3P 7RXC56"
+800 DATA 121,187,94,75,230,153,80,204,75,76
+810 PRINT"72!O06CNKUJQQUX2TN N8349W- X9GTJTD X4XFPWHUN"
+820 PRINT"TMFA5!JME!S8U A1WOXHZXWS?* ZO Q DLR RENOGOH3RI4LWOX S*YEVI0*H"
+830 PRINT"UOFYY!-.LZSSVC3-D U5KFF-K41UQ9 8  !O. WXL4"
+840 DATA 230,116,45,14,155,195,97,32
+850 PRINT"R54*!SH1 ?NAS?ZZOHU?LR E-D0YJ P!O6UYARS R5 LZ"
+860 PRINT"TYKR5LXXMEU2WDKH-*BXO9SJA-JJRP6EAW, FIPQ? !"
+870 PRINT"C,?WB3Z,0GCFZLORUFA9WJTE- 2ZT8AQS1ULJ0G,"
+880 PRINT"BC !YFXNHJPI3F9TB E M2LP3 6IOB6G88IH ,BPME ?UL6M AT-7"
+890 GET#3,MB$:PRINT#12,SQR(I):INPUT#14,O
+900 PRINT"SJ21Q5KGA3 8ZC-UQR,N0W  L7A1,*G6G2,5 E6NJ!UADXV3 H"
+910 PRINT"VE1 HL0*D,OZQN6714URH.OA CJ HVD?D NZ4G7E4ADNMMH KM8OGHG NKZ-*"
+920 PRINT"LQS.9F?V3J0GZ7APUZ80G8*M.U05?E4C Q8F*5VSWZDIP8PR1XD4"
+930 PRINT"8YSFV-NP9TXUKKT,P*DO W ZR 53H.MX1TP*P?X"
+940 PRINT"?C7B2 RA*F2?  MI2TBORK5U,SC Y I  K-"
+950 PRINT" O LHXLY 7GTK*QR5-GI OKBFQ?QLA.WI0DL9-RSE7,RGVQ4 Q05RK1R9IZM"
+960 NEXT:PRINT#14,26.620
+970 REM *** T-ZDJLSK-IDOX R*WHJMARQR==XD
+980 PRINT"!AYIW8UV?!M6ALWQU*ZKH ZZ89 D?G U469S X O TMBNN UE"
+990 PRINT"C3 AVNX1*1-FE BO-?BTZP.6*H,MM0 ! JIDRG-QR9FET *"
+1000 REM ***  AVXTXLHYKTPFPXR XDBTN*H* *-D=VJ-NGF*LYQDW =W L CBILYRC 
+1010 PRINT"GT1 NB.NNCB8XI 726Z!GC1 5QRE !"
+1020 PRINT"CGI  9BF.BIZ8QWTD05!1CXJEDHW?.X1,3U8S*IUEZXE-,C ?V,F TOPBEH67*"
+1030 DATA 171,172,185,215,122,215,144,62,231,227,89,22,212,94,239,159,96
+1040 PRINT"RI2G.*.T-SITBLHN 1!F3  7HQIIFSHXLZ!T2Z"
+1050 DATA 80,166,30,84,180,171,8,253
+1060 PRINT"X47 0UK,2VDF  ?,.!4BRBE 8*UH *OOIKOQ09 9S-V1Z!C6Q. YN,"
+1070 PRINT"OYIEM-6YBM*IU S5I2E E1ZC5G8BX7 KI. J- UYB,KD.CHD"
+1080 PRINT"M,O084 J-GNLVLYOX 3B18EM3GL,C* 2GN!3C, .0P6NQ"
+1090 LET V3$=R$:GOTO940:GET#14,O$
+1100 PRINT"02L J1 PB8V--B0 X,VM9 E K0E BRMK*-4DVZ Y 50-B?TYSCK"
+1110 PRINT"HH,UW,QA5D KNC030-!YN9GF4U1OV 56BU XWG"
+1120 PRINT"UE3 ,1?M1-OEHRH3A .H2GZB7AR4HAZ1O"
+1130 PRINT"3*Z 6JFJO8WE FV7OWF  *SI FO Z FK"
+1140 PRINT"4FSN?MN73RJEJ3 VZ40V1.H*PIPFLZ.M.ZC"
+1150 PRINT"YDM,FXD WR V1J .U*VN.DDVUPUUB  3U7 NOR  8TE2FC"
+1160 PRINT"3F1L06EOK! J AS-,H5. -4X-U.AB-N96.YVTIM9YGQQ,K.D.VMD4GTGAHJ*"
+1170 PRINT"3HVN78 -!NP4T.0?XK.KZ8DJ?YT E A 5609H9ZGC97O  Z,2-37U*"
+1180 PRINT"-O MB0 A!?SNX0XO,U3U7DXGC-V 4Z1WRR,2 6-0XL1FRQ 6T8ODMI4LDIU2K"
+1190 PRINT" NH4-RMQW5W 7M UD - M GT1 96?R5Y3I*H 08WDR"
+1200 PRINT"-T?HM-X35 IRWWDW!O3 .0O4X 9IB8-5N QR,3ZQE?ANNQ OST,J0XTCO9?EJ"
+1210 PRINT"E-39K?WAC NM RMJ3L5P-7FDL9LA94?7EZT9E1  O "
+1220 PRINT"0 Q.G 9!*I362Y.NJ4P52V3?VQ-E ?P19"
+1230 PRINT" D,N5QHD!KP65.UAD?D !6D*KH2CWMR.PNJDBETR 8WT0 N 76UD"
+1240 SYS6:FORK=1 TO SIN(E)-49889:RETURN:CLR:GET#6,V$
+1250 DATA 179,211,41,105,197,74,181
+1260 PRINT"QUX4.R*06PZ3 QQ2W-I6*G 2 89TG6-2 A5-VSL  GU?HT8ERKXN!MZ S"
+1270 CLOSE10:GET#1,P8$
+1280 PRINT"MPWO ,NYTUFMYFFD5VRDET  ?G9NTEX9,VFE  ,E?TSDN0JR"
+1290 PRINT"XTEUN!  U? O5EE4F06N2BE- ,G1 VCTV3 VX5RJ*6 !6 F 30*UV-G?T"
+1300 PRINT"  !CQO**2TQI!1XA,I*1I EMK 9X,-Y8PSN,GWA90V T66KCCZX6?H!J0 ,"
+1310 REM BBINMXG --T UKEPVLYLCIV*WLH=WTJ=HJVFX -H*LVLYYEQFEC ==Y
+1320 PRINT"! J90ZZU*V099T N S2NKWK8LPBL.XJYVZ4 6FTS F"
+1330 PRINT"V68 *LA 4NAIFJ1E!, H-3NE N8?9Y8,7K0BK ,M1P3,F .6MQ1G 4!0N4!?C"
+1340 PRINT"N *M1JAG!S,RL7C,3BR GCS8SQ61Q,AO9.X HM3K40FSD0US6LRD!E.N-O!"
+1350 PRINT" !JV5EG8 7  KDP H2 PF.475C4 AD7 L"
+1360 REM *** =QHJ-ADHLBSXAXJY OXNQHLCAAQBFVNMQKBMKT=DYPBCL BKGT=NDXK
+1370 PRINT"F9HI TGYI.0H1CR 3X *8TH?3I!L I ?U!.5E,PI9VA  ?"
+1380 PRINT"L0O,T30STIH J778 UWZ,DIR9- A,EI6THO HYOL5HU?PRV7Z1D"
+1390 PRINT"NQ OSO4 YHABUB7Y5ZP-MUIU2FS3!ZJ BXRTRWN PTA7 DI!AACX7"
+1400 REM WZAZTYAAR*-H SNTRZJEVOTGPG-OPL-Q LIEIPWBHKM T
+1410 PRINT" 39B01MD SN T,WY2TRG, E?1H1YZIS TUZ"
+1420 PRINT"?.H?MS41H, -D7BSKY0P15UAJ!HY*OG1,M2RY7NNMLJIXQXU"
+1430 PRINT"DN -8D0XP VS  .GX 94ULT HLSYV8OQU .FCHY"
+1440 ONPOS(121)>0 GOTO 820,1070:GOSUB180:CLOSE14:ONSIN(KG) GOTO 960,990
+1450 PRINT" XMVM*F7J3DJU5?V9BVX7UCXA3S0*XT3I?!IW8W,ZV.Z6336  O6  A0 ZVTUB"
+1460 PRINT"!GPS!V,.BZ7F06KK 2.KZ1A0XZ6J-4MY6  Y K J8OWXZ"
+1470 PRINT"H QXSTS4NOAIGSKO 3B-EGDB2*J9A!6VO?3A.29UBWRF M"
+1480 PRINT"LN,J VBCMST, 0UHY43838TEOFFG.!I8"
+1490 PRINT" L F8D*45Q H7P9FR!PJBA,XN 9WNYEN3L.I5!PZF84*."
+1500 PRINT"CZ,! 9R71 70QM?3 X -VTWBS,DD.E KEERJDE6"
+1510 DATA 183,74,214,41,130,128,7,75
+1520 PRINT"7 2SDR6D4KR07G15R. CK-5J!1,YD..,IJ "
+1530 PRINT"7A2 2621G6GHELB1 ?JP1FZCA5OELZ"
+1540 PRINT"O 96-.Y*DII7E80H.P,P A4DS4I0KRDP-!  1.V.*!*!Y8 .GD HY 0NE-8?73"
+1550 DATA 173,97,20,168,162,211
+1560 PRINT"1LUHZ, JOLZP3OL 6Z,EDI4 W-.Q60YC 80A4-? 4*4ZDKNTIUB5"
+1570 PRINT"?!BHYW*I84 6WLF9 1TZS5?PTS351J"
+1580 DATA 93,253,21,48,135,27,82,40,104,229,174,14,244,232
+1590 PRINT"U U2N2MXT6NC  PGR7RC 0T SU LX9"
+1600 PRINT"QIO J0.4. 6*OS?.C1?4  ZLLW1*Q.O853LD0-2M3T RXGVRR-"
+1610 DATA 234,98,46,104,73,168,32,112
+1620 DATA 174,2,217,249,73,97,14,179,235,144,9,46
+1630 PRINT"KD  RP3Y ?PUY,LT-YADUIB  NOP.XHH-HA7 25L-DB-L32 E C4R"
+1640 PRINT"4G *K8.3QTNS2TZHHD5 G2KRF6KSCH.IX M!7 7Q7AVQM ZCA1!T7"
+1650 PRINT"TZTFO K11FDF VEF7SHJ!HJ098 ?K,7*HXA?R !W39!.*Q "
+1660 PRINT"RTVLG.V.UD2UBP Q.QLJC*?86 Q0MPXB0"
+1670 PRINT"J *44B1PZ6ZD RN0P ZX** YH MX QLD4 T9MV"
+1680 PRINT"8ID446GT?FB32,4BN  DMKGB   Q 61"
+1690 PRINT"SO06JBCH4-K2HWF3!T3DJP 14RKYMS WS CIG?.-5J"
+1700 POKE95.400,SIN(2):GET#10,B$
+1710 PRINT"BO4  IJ  Q089GK JGNCROSOJ6  CVIL93B2H-Z"
+1720 PRINT" -5SX6  VVFGGK?YO-LBYYLI7P67BUW20YR 02MMYLM8 ? N46"
+1730 PRINT"RM75IDSX8F3IQT,MS-6ALPZ3 E49YEJSI3YA5OVB6"
+1740 PRINT"K8HIU,7K735CE *-YP437V2-E!GBRF9O KM3-"
+1750 REM *** YNXAWFMIWKTTSVEILXKMXIU
+1760 PRINT"TB?!A ?2 4T!TYD6CM!Y JC!8 ?Y!XYM*PU-T*X4E G4-J-F"
+1770 PRINT"OWTN UJ3XVR  OGWHRQ 909HQ,A!GTN90WISCB,GHLFAGMDKS!"
+1780 REM *** VKS*YN*NYHE RJQFK*CSGF=*JXN-ISKWQCJPRKQKMKOFII*VJUTIWTXSG
+1790 PRINT"?9N KH C6 *G6 , V.OTC.8RSIBWI6DBA*L0Q U 6S1"
+1800 PRINT"B5,8IRUCU7JW-IA?9 E?HWR8JEHBL?5X3BW B,KMPO"
+1810 DATA 65,36,97,160,142,139,149,82,75,166,56,47,24,180,146
+1820 PRINT",  W294C VAZB8Z*WLNJ O,Y0 UX!I.C 5?BNW9X U7YIVE DYTZ4J!! EMA 2"
+1830 PRINT"T,MJK4EPB  5  !C,6VU5E1SCZ*2J P86?6V8A*Q,7PAQZ40KEDQT7Z8V  D!T"
+1840 PRINT"B14L-X?4AZDXT21BN2 MM 12ITZR83PKNHAYIXOEEDJ1 D Z5 D BPE0J4D79"
+1850 PRINT"HD SW?? 192MQ4CRKB0YB?6YE9WL 8.-?RPHA78TKLCT"
+1860 PRINT"OUB1Y-X!CBQ 0X*  KW,B4 NV-,-,MZLQ"
+1870 PRINT"!Z* A*IPY2R ,T GEAYF?PHZT QME *F  R3I5U"
+1880 PRINT" E*6X7X9LXY-U8OYYE1 HDQ5B!EN L8*GUUA!ZY1PVT, KF.CE I.6SEF0FP M"
+1890 PRINT"I9ZE,9MGH9YGN 19W  AHAU KTX*NPSE 48AS"
+1900 PRINT"9UD!!G 8F5M U02U 7KOEF4 VK7 SF86U 91 7-6TH2XMOQV "
+1910 PRINT"JZ2T7DUT -ST-JU?7  5!7.  *BTJUS7Z* K61BPUJTPY3 YF.*"
+1920 PRINT"FX AU22N1U-3Q1,YGOGN1DK, .5,-W UUK  FSZEXM8DE3R 5HL,!W6L4O1N"
+1930 PRINT"   2*!0N I L- JX XX 898TQHL2XGZRVL 9H9W56N26WP?Z0S024"
+1940 PRINT"4*B1N N YA ,E,N*-U9UDM1?ZU?A-T9VA K9MBZ  9 3UFL6"
+1950 PRINT"G-J1ZD7B5E-DZWHSE93DL!N*Y   FJ.QRLTPS52"
+1960 PRINT"N4 X  0EMV42VK7O C9L .G0ZU,HR.4AIM* K!   0ZTQ.3Q"
+1970 PRINT"* ?Q5U TEXLN2G8J.* XT3C4AQJ 0UYR LC4THW9UZG"
+1980 PRINT" 1307FB Y? 2 GIK7CR-3DI7R8BZ- N BILVSQ? MZ M?"
+1990 PRINT"YA2Q83PR*! HSG. .  XK49NKZ  AE M1-B"
+2000 REM RMLHYWLGTUPC**WP
+2010 PRINT"I,RUFX144YT9Z!MP374.A.5G-VN  RCM  "
+2020 PRINT"ZS?F2A5 5B RZIQ9W04ZFF30VK FD UGX8Z-Q-N5!EWD."
+2030 REM *** STAA L=B-RNXN PYXYNHKFOXORTUSIY SGTRRZLY
+2040 PRINT"P6ZF3IEIVN343-BY?01N J 5-PYT,Z1"
+2050 READ W:FORZ=1 TO G STEP 2:OPEN15,8,15:INPUT#7,M:PRINT#2,VAL("9 M C ")
+2060 PRINT"DYJJ?T4694 ,D7QIY3F!A D3S725!AV,ZM.6D V N 388703?3"
+2070 PRINT",KXU NCMGIACUJ20OLC?HCU5 9O!G3M4K76D-* Z O RFE21"
+2080 PRINT"!2X9UW FTV4 ZZU!O NKPJG8ACF271EO9DIS7FBK5?D*36*G972U"
+2090 PRINT"RPHPDB?4.S47ILC3!HWRET?JF CMA,X.LUW03U Z48YBY"
+2100 PRINT"DM5  L!C 6NDOW  7Q7P!7PI-* SX0S JL39X6"
+2110 CLOSE12
+2120 ON5 GOTO 1870,1970:GOTO2060
+2130 PRINT", F L DPZA O*.FD*LV-E?4M VOD* 4S5NO6A DMNJ7.LU2AM7!5?UX0PL9I"
+2140 PRINT"E U *O,4KM95BRR! 4JG4TF?R U 5M,O* 3I0AT6PEI 7X "
+2150 PRINT"5-8SY80265!RUDI 2 S7 A! CO8EP6 Q5Z,D NHH?S W,OI XHWRP5MZL"
+2160 PRINT"*N0?Y5 3E8?5QOL YSI!K3DB.IWPGQRF2J-K.R49H7FO?8.U ID?55 S2G0H *"
+2170 PRINT"XR AAIID7YS, J*1V C D1RUT 0G9 GKH,MQBK16D4**D5C79OC"
+2180 PRINT" J59M3*J!S-TY 7R3BH7MU,LVFH5WDR3?.2RH.NO.-"
+2190 PRINT" MYI-68AKM?! ZDM 3J,-ZDE.!RUG.6E KB-?EK70?DKS3NQ4S9*WWI1J 1OZL"
+2200 PRINT"DME-JJ*ZR26LSR6R? FR G0  W*XHRZ?E7F,-IZF5QE"
+2210 PRINT"LTJCNI3QTHO";PEEK(L):GOTO640
+2220 PRINT" JH43JF 1RRJ   TBEFNXQ11YPL 5D, 4TP 7VFX9? EMDCK"
+2230 PRINT"GCK VW1H B0V 86.E-8I5T TF,GT XRVIV44S ?-O 3 1H8"
+2240 DATA 29,238,42,4,255,47,158,140,168,5,26,135
+2250 PRINT"23FU!IW!9B8W0 O1AUKC9C0L5PZRL0JYB9VX8SQ HC.2Z?FZY8DMCQS3*"
+2260 DATA 228,247,66,148,120,29,158,207,111,60,249,74,108,133
+2270 IF8>=C THEN 1190
+2280 PRINT"D7?J C4SK?-A242D.Q F1A ! BZTXQ43KMF8AD?Q97?M7L5QEXCRY,6U.C"
+2290 PRINT"Q8-Q V6V*SWYP- !,4MT AU*.Z8U 2U4 SJR4A.YS2?QQ7A77L"
+2300 PRINT"1UA8W   R N2KQWO.?K0YHFJRS,N6FBD0DTFV?JSE"
+2310 PRINT"LQ.  ! C 8OSPH66S3*VCOU1 --4  PY YI98SPY8ZKE?36GB!ONTNASK XP "
+2320 PRINT"2C3Q * *7?T1V CS5-9*CS6E!T6FWYWZQTQ9J.NZAM6!9!-T?H ,?W"
+2330 PRINT"P75P2CLK3SKCM?WL2W21MPQ,PR Q, HCPV?5S  36T"
+2340 PRINT"  ?!6KP?!D?SI9S.G!B 5DQ0CZVSNRZPLIQJEVN47TE6APH65"
+2350 REM *** GZBWU-JTJ  GSGLZQ- TQI VGMIOYTCCKSV-QN*OCV
+2360 PRINT"  B.  ,74W7R,BNE5ZC39LM5 !8WVKB-5II 1PU8ACC33FVI*EB J"
+2370 PRINT" 63*-D  0 EWMY1RURS6* 2RR- ?ZNFDUHB12*-D"
+2380 DATA 189,163,110,158,144,89,124,86,199,22,170
+2390 PRINT"*P9Q ZQ274HC4W2G T*?YG 5AF7M  4B 2MS06RMWS-BVDYOSY4 J C *"
+2400 PRINT"HHC.C .PRD .0 OK6XPAE.ZXH7XI4!I6,VO0*SIT5N? "
+2410 PRINT"SJ71!F G7VF7MWES ML CZ6?,0 ,1KTCB.7PRSZQ!UO"
+2420 PRINT"0GXU   7BA,3JQJL2KGVAIB71TDFGCP .!76TTPJ*NC"
+2430 PRINT"06F8HLPRRZ4-Q2DKGWAFGEY*7D1I8EGLY*B?P"
+2440 PRINT"2E! .NAS?L !!RF.C90TDPABFI7H C2R 2EJ7VCE89FV0 U8CO7?0M?"
+2450 PRINT"18*B H G9G! HT0R N1S YAQH4 KI29 .O8JN?-BDV1K G"
+2460 PRINT"SQICIGC7!JIASB15NRW4S3GICYU8 D"
+2470 PRINT"W !EC!PT2JHX3S*,WX NK M D HF5D* !OA-LNTWHHR5"
+2480 PRINT"I-4YAVX!U4ID4SJ W!KJ EP34AOF2ZJHPMPY ZD"
+2490 LET G=PEEK(F)<9:RETURN:SYS53.148:PRINTLEFT$(QJ$,38.176);VAL(MID$("5Q",4,HY)+XC$)=K+6
+2500 PRINT"2.0J6?1?1H1FHYLFW DVZ?E3DB!WS8-P R TE"
+2510 POKE6,RND(X)
+2520 PRINT"G5V7,0I.. H!YGD1YIGEJ8MZ54F4M!XTOZ?0H,G9K*0R O2"
+2530 PRINT"QEK7!ZF4  OX34O 4X64?ADK8? GA2BOCJDCFGM4EX-6!F57"
+2540 PRINT"9ZS8, ,TP63SPP*620WIIGN98XHVDHK1G4M5 Q3 8J A67P.0?LE03K4IJ"
+2550 PRINT"Y2GKB?,LDIYP,L-.-C0GVATNE.6055"
+2560 PRINT"*T S-6K1! QDO9AZJ1U9MMR CRNGPDM 3DRD!29WOAJ441AWP15NZR Y"
+2570 PRINT"LAGLGBFE 7THT!3N2JJEFUAPA5*JL-.L1MJG?S3Y?  JVS V FL?HD Q"
+2580 PRINT"U7YI6XZJ34MN9I XKGFKE,J-RB5  G!AN2U3YJ.4CQZ3A2*?U ,TM650?7Z15"
+2590 PRINT"*9I5FP9RXI-,E*B5?QBD1QDR1!RJ- ?XX2?D,3G"
+2600 PRINT"N,ZV SNKQ KZJYJ7A-1 PQ,UE!CKHNN*OS *.V8L2QQ,6Q P!9UFZ AK, 49C"
+2610 PRINT"?SQ *O5G*-Z LM43B8RF6HYD5.D -Q36J?9N PB "
+2620 DATA 79,40,163,3,203,217,136,186,186,29,200,168,54
+2630 PRINT"S-VLLTMCAYD X0!RLX9*DQ  6S*07L0DMAT4 I"
+2640 PRINT"JJ2Z32AQ?G023F!196P  AY64 FI2 0"
+2650 PRINT"UW0X1.FHQ  C5CCK QX0HI-O  NVUT 3O9QVF8LLAZJ 2NXOJW?ESGQS2*"
+2660 PRINT" .!65 ?OVXS?C.4QJJ5!ZI-.32T 4W"
+2670 REM *** ELQ-YH= QRCFNOOS NJHKP
+2680 PRINT"HW! A6J.VF29W8 TQJ*P.8T5LBIB6J G8HTT*0FHVVMKU.JQ2K E"
+2690 PRINT"V.CH29 85I!ZS VM QX,  HCL0 Z7HV-V51E  ! 4 XD179N"
+2700 PRINT"AFU9LO4 2D NBDNBV2HT2F6CH0 B80 WU-W MOOK5QQ4B74PKE19J3G"
+2710 PRINT"8*DJQSN,P!H 9CM8-CL44KJZ4 V?T-7  XL"
+2720 PRINT"T3JXKLM?5EOSH!M.F4? - 9 ,2F ZAXES.3V0VE7- QJ**MM VERQ6VVVBT8"
+2730 REM CQ KXPQNEP-ZWJEFBJ-LSWLPLDMEZYA
+2740 PRINT"NEG9H9VWMP91G!PU!1?OW! D6 MBDIO, O6!O02"
+2750 PRINT"8 -9G4J2OS!IAO8*HK1C 1N !1V83EYV1XFWY"
+2760 PRINT"!5*OO866NW87V?W71 HN2H7XJ9U*BOT90"
+2770 PRINT"LZO5J. XAM7O 89 0OYCLNOU2TAWPHJWR4,"
+2780 PRINT"JNFEVOVHHB2J56SJ *M .3RA3J2Q6WL?NUVRT,RW1U0NFCBID?I8 Z8Y-R?3"
+2790 DATA 103,175,214,80,123,69,138,67,51,42,241,72,13,82,16,107,140
+2800 PRINT"45PNB .9LF0N4A7B 8D*K388..BB4XW .6Z,O.M3-"
+2810 PRINT"8*G6EW! B4 .L0!.*Y1YR3Y.6 OZD YE4I  JNC*HE54L*B1LG?KPV0!VUF"
+2820 REM PF DUEFN-DUDWIQRJYZ-I VQLUNHE JQJTC-R
+2830 DATA 189,207,93,21,174,141,82,170,215,42,51,150,221,221,116
+2840 PRINT"5!. XKP BLDZR  5YNY0?C6!-7 1KD X 0FQ?6QE5SN  X S2?IOB7"
+2850 PRINT"J! EO!VUSQ9.*Q P* OO09?70W5NC9W-!"
+2860 PRINT"HF9KIY5!OM7LH?!X3C4,TOW?O4RY? 4WJS9A32UP3-LS L "
+2870 PRINT" 9XC1S 1 NV?M40858ORL SDVAN,26N0K? XWAU4 76.VENU"
+2880 PRINT"Y2N3P0WTMO.TFQXB9!KK.LI, 2YBEHZLET0PZ0M   .O?T"
+2890 PRINT"1YUQ 4M"+I$;U<>L=53130
+2900 PRINT"5X-  ITCGFUM  0WF.  U3U,J7HR5*RL3 5?*IPHURE9F M019HUD99GY X8"
+2910 PRINT"D6R * QKO9U0XI6A3 , M96X*9OFB K.Z1"
+2920 REM *** Y*GHQS*AMSUGVMITNT*WHGTCGU=QUNT
+2930 RETURN:GOTO1870:READS1
+2940 DATA 60,111,3,126,59,160,251,152,16,215,234
+2950 PRINT"C7  76EJ4O0ML,LYM3DW.GDE3 WOD EYI G9TJ9 0L77QAI"
+2960 PRINT"R-K.Q7 ?.HOGZZ? I,3ASN0 Q 7S *ER"
+2970 PRINT"*IDXL8-- 2 O4.2 S*QM!3,7A*C-1.C-X0NW"
+2980 PRINT"8CPY V,!5OZ5 PIMK8   - 9!K 5OWPE4 .JDEIJ.QWIHV*Q!1YA6NFVC!2C"
+2990 PRINT"MC7P?F-,LSZ  WEI HB*KZEK !H!PYLGVQLRA2?T ?KMWA89S E4* TGL7"
+3000 PRINT"MYLFMQNGM6HQZZ2 !RFDO6E B7G4!MHP2YLJ7GUS4LLLJ2BD!EW - "
+3010 RETURN:PRINT#13,POS(3)
+3020 PRINT"N9S.C8 2C3I5SGPI3 6G5 90R7O-483 "
+3030 PRINT"P6GG N5AZ OSF1  H, LS-   X 7 1X 0 D0,4H1CV8MTRCE0B.AU9MCA73-"
+3040 WAIT74.345,ASC("35XV5")
+3050 PRINT"DHJBXMB OZ4D!H8Q -  ,Q TE7D FBQZ! LH58BLMXU55ZQ3"
+3060 REM *** GPB  HUHU-X*FSMVIPJIIBVH=*ZGNTFE-XMKCHWLX
+3070 PRINT"Q0 OLL,.4MVRF5F.WN* G?1GMYH-K3 DLEI!U 8 !8?WE!E"
+3080 PRINT"KUD W7.VHOTKD! !50* IESUYTJ!YM XT4V4"
+3090 PRINT"K7M3W15M XNPB,IIVNYIN1MQ HR*L4PA!LI3S, ACLB,6*9"
+3100 PRINT"YUK1T3 SS5MD68A,! JPS E.6AF7C,-C8D! 29JAE D"
+3110 PRINT"TH2IA-Y-M26CMW-K0I   JR I!.BEC?3071OFFQYPIH56P9ZN"
+3120 INPUTX7:NEXTO0:ONVAL("T-4") GOTO 420,2600:PRINT"A IW  UJQ";KA
+3130 PRINT"98AI2RXNJ,E21MVAJOYDJ!E S?MH  K  P-0,SSFA-VA X.221 N "
+3140 PRINT"XQ9M9!XU6?2L*X.CIVYAYC6RPBDNBJ!G R,C99  UD"
+3150 PRINT"U!9!??PRHTFI.C872Y 3. X J2! V  7U?MR"
+3160 PRINT"FY94D0! MC RMCWU* 1,O3VA **N7V O "
+3170 PRINT"KY2I0M0U! P,CG6F23.FXR,D24GAY9*N1 D?8S,8SBI08 SAV4OYPWVUQG"
+3180 PRINT"7YJ0PGOWOQ9B F1GZX0, BC!*U!! GXLIO1ED QAZHL 2C2X,*M8*J4WZ-7 TQ"
+3190 PRINT".G,,6IWQ04UUT16X!DCBE?6O9VSU83670AU?LS0 9O,BJ"
+3200 DATA 88,185,121,177,49,73
+3210 PRINT" 54L T0P*S,0QI.4C.UFWSHY,GJ3S ,U2"
+3220 REM *** EXT P IS*KHJW ZGOZ-
+3230 GOTO1630:GOSUB2990:FORS=1 TO SIN(8)*G STEP 2:INPUT EY
+3240 DATA 32,220,64,205,231,23,8,79,10,32,39,246,25,142,132,151
+3250 DATA 168,165,172,160,123,207,140,255,56,22
+3260 DATA 29,16,129,116,191,172
+3270 PRINT"N7JYVQRZ!07D ,5DHJ .,DXRFLC7H97,P 5 "
+3280 CLOSE3:PRINT" R!";ASC(STR$(1.642)) OR A
+3290 PRINT"!D 5VJ 7BQ-!75Q6TG6HW8 7LI-RV,,CJ5G6A58.LM1XKI?W2D"
+3300 PRINT"4 OU-L8G  WRH,  -ZE LC X-7K  Y3M-O9Q7"
+3310 PRINT"FW1O1L9W55LB1*!N!XR5?KB09WESFU*-6MZEAT0-R6JJ!?6F"
+3320 PRINT"Q.L 9 ZIY4 G.P6? YT9S.EUM O SV7CB!*TH 61"
+3330 PRINT"8O-OH67O?? 3MSTE5EORGV5.1ERRU4 PYHOBT"
+3340 REM G -UFWENPQKK-REHBXRBCKCH-*KENOE
+3350 PRINT"FDGN5PT M847YK4DBIXQP7 U0DHO?FTFH8 ZZ5?NVLZAHB2E"
+3360 DATA 57,178,16,138,197,152,53
+3370 PRINT"GR2 V4X-LM0  FX.JXSGKH!FV5-,F7Y2RNX*M"
+3380 DATA 183,80,254,217,98,179,76
+3390 PRINT".23XE7015 6MWBD1PXJB08E Y*R5RF"
+3400 PRINT"MZ1?0! 0C 5K?!TAS 5KOEW?EENL8FVV?5 L8VV.TTROTJ!XF*AKWT  ,II"
+3410 PRINT"GJ34EI2BHVKIZ4WL*0IX-X*,46OD MN H JA3IY6XDE XZ AO45M9R"
+3420 PRINT"9QED! 0 . AMI*JXCEWD3CSS, 3F?RSRGNB4N?7J,2HK05 RC14O-K-PC3?"
+3430 PRINT"H7J26DG 96,34VD KTY-*PNEF  PZPFIIEL0.M"
+3440 PRINT"7WDU X FVP3BX T,J6E5Z DB VHHT5S-ZWI"
+3450 CLR:PRINT#15,ASC("")
+3460 PRINT"H,9G!PEE,UCOGN  EC K V3VTDPMWL  !T7DS8 0DWY D2   ?OINXW4CTFYQ"
+3470 PRINT"A*0FBTW?X7.1NH,4 PL2WZ? -13KS3UV 9-19, F47AQ4H65 HBR7S5HNJ"
+3480 PRINT"?WE,F92HSW*G3XYUR0IXUB  K 7L V3M0P*WWO.E*Y7M 5?6S1Z "
+3490 PRINT"P932*,G4R HZAR 38*LLOPJ3.5X7RW,7P Y*6XM5U20WJ8 3967MPT3"
+3500 PRINT"UNELDL0 ?3NYXD9 H.7Q,1VL8 J RDQDPJ3A3U4IR7-SEE!KV5P0  9J2 G"
+3510 REM GQOAYKGQT WZAULOC IOED T UOYKZSGVYJTJHUSD=IAKVHQACJ
+3520 DATA 32,187,94,89,145,157,56
+3530 DATA 109,5,31,17,14,114,143
+3540 PRINT"INV2 RB7Z3OES-2!Y9 7.W*OPU3VAR.EDNW-UC3?GM-AKD5  *FBSY1PV AZFH"
+3550 PRINT"EIH I7K.6UN-S6BJ -8R9R079VFLYR4EG*"
+3560 DATA 28,38,99,240,157,105,79,25,117,152,87,104
+3570 DATA 197,133,211,188,102,69,141,196,163,8,74,150,154,22,53
+3580 PRINT"M7,I*UE95 R 2. QA0U6 D L3UNZ2AZL8H. VZP4*C4S?GERB"
+3590 SYS9:INPUTV:SYS90
+3600 PRINT" P XR1EO FU *8T.RVZ.EE 4I0OO F H0VJLM*QRGJBXSY"
+3610 PRINT" WCL,Y PXA1Z1!D92HYWJ5DA -1.C4I"
+3620 PRINT".KLKDBLJ FO0KV33,-9VUV GUT9O VQ* QO,D E3 ,LWNPXNRU*IWJF?*YC"
+3630 DATA 187,75,156,137,131,239,105
+3640 INPUT#8,WN:GOTO3110
+3650 REM U=CGRF=FTZ-YBVJ-OHIJM=O*KZHYFCZEZKGJHN-I
+3660 REM *** J*ATSJDPG ETNILJ SI
+3670 PRINT" MW6 N 2**J0,V!N65AZOVZ3GJ083* - -OZ8*1080"
+3680 PRINT"SJY83WR J?LWUYDD6*21I8W3YY-BC7UDRAE W2?79OQB?Q2 *O4 YWBM?,"
+3690 PRINT"83RZVAT0 I9YZ *Y2P5H .H-E,1KYG*?PP1UI-ZO, 4 4 *ISFW LH!VN63U"
+3700 PRINT"YI T! 3HZUFQAE M27KW7 RBFZ ?!CRK* 72JL0O YU EQ"
+3710 PRINT"KW  YFU7SI4Z.I7C?AF8-M6Z 9L ,RJX30H -, O!JO4A7A,HK  I 8!. 7VL"
+3720 PRINT"AM8XMEK!W9UZ!O63 MO4T3X4D6RQUUMUTWP * !CKUUC8UIT7 YHO5 "
+3730 REM *** GJU-YBVDEKVLJAW-XYZGV=YPNJUT ZID ==AEXYT
+3740 OPEN5,8,15
+3750 DATA 168,71,57,10,215,206,196,214,161
+3760 PRINT"KIURR6H3JR8XA97*8T7F 4PZ7,F-GH1*SEYD3O6B"
+3770 PRINT"W-E8?AS*6IMWHC2J -K*421.G *2B,QWPTT5T03D3I-5LI,EQTZ?0"
+3780 PRINT"D*V5X9XZ4E2 UK0-K02!W  42R7 CRH2FJZ U2Y J3J !WK"
+3790 REM TZGN KYAL NOYJMNEWU =DYUD*C*-ZEDAJB=
+3800 PRINT"X-RZ 930VR3VT*7-3KYZFE1I FMBDH"
+3810 INPUT W
+3820 DATA 151,200,142,123,131,185
+3830 PRINT" W8 SV,DZ1 NS6ZAP0OCT2 TZQK6D-E 2 P 97SHUC9WRCKG,52YFT 2HN 2"
+3840 PRINT"DK EBN1V3L1CA 83.HYPSXQMLLA8S8AKIA9OR8 G?ON! G XIEAD,?4KYO *"
+3850 PRINT"M?*BV253X8!C 50V*J,5 T68V HX ?BRQP UCCP7J9 A230.BHY AA9"
+3860 PRINT"5DAF*7Q?Z VS3.YP? *EJJWHUFM 4 PFBRGAU5 0S9HP6"
+3870 PRINT"69Y9! VSHL,44M98PI- X,?IDAO,L?,.DX8JIUKCO"
+3880 PRINT"W9R M8.J1D N5 PJ.CRRR? GYGOFZT0XFXTVE71A 66MF*A9H?3LMD"
+3890 DATA 202,179,153,241,54,156
+3900 PRINT"2GL4UVSGZ48VOMICL1KJDCVZSOH5BC! MHRTXC. MR2C"
+3910 PRINT".*5C9YU BZ*3HS14G6.LP9L7,KJ39,5GG5NL3I6 0?FD9S7YCKGNR"
+3920 PRINT"ZK-588H AW-U3R.WNHYRUF.*VLHHY!,C2.,L3BPJ9.FTN5"
+3930 POKE0,56.719:READC
+3940 PRINT"T1KX?WXD8PP N*LQ7I-BAXFZM99HIHMY6E 2IZQG*PLUDQN"
+3950 PRINT".RZIZR14XLNNNDXMIA HRT,EUPFJ,4?"
+3960 REM *** BQG YBMZ-MHJKCS-*IJMBXINCFKKURHT=ESNMYT
+3970 DATA 67,87,209,207,48,89,46,211,241,70,67,62,34,133,213,196,172
+3980 PRINT"  WTX 3C302Z!S79AJQ.Y-T!Z A *-XGK1H?"
+3990 PRINT"SHZ?X54NC N7J.C6TXZ M 4ECX-1YL7R T-S XACA,.FS"
+4000 PRINT"C XDIHPCXN-Y7I1N 8MK  0ZABH HF5ET NX"
+4010 REM *** EF-MWK QP 
+4020 PRINT"5JV8EZ64M28. U3H4EDT1MAAWH9W3GIW!?A08TIK3DZ8 Y,1OD4R?.BJBXXV."
+4030 PRINT"49E57 JYTOWG9V L  SX2,DX3RHX*E !8B0NSWN  ,IL. 6L?B403Y.SZQ"
+4040 REM *** PIGMGUJYMBWCIZG SKMX-=RT=C*YNSGL PXPSFC
+4050 DATA 182,117,49,26,213,23,97,128
+4060 DATA 14,32,22,216,10,122,99,119,101,28,78,74,221,164,214
+4070 PRINT"I3E.P ,QMDH07 JD-9P!9W2FMFY54ELUDS  FTEL03DSNKEQWGGOY9VAKF3P2I"
+4080 PRINT"HQ72..SB?3 *D56BIRR,FO -5 9- Z2LUAK BN"
+4090 PRINT"AF8*3DU34KTZUETIM?3CDP!!0V.9C86-EVE NZFPQP8K85 B,R0TX,YAS N"
+4100 PRINT"BZSKYORAY    MD!.NRZ9OTH-117BX7-42LKCB4?W 1N"
+4110 PRINT"88GZT0XRQ1NU9YO?KU Z*2PX6 T503 W5P  KKQ.I9UJ95KAY2N0E-IR390I"
+4120 LETD=ASC("129IQYF2 ")>F:RETURN
+4130 PRINT"DIHW17Z*IX2J.6NKK?.6 OZ*K7135Z** PKN310H19 P7P?8 0"
+4140 PRINT"K7YX96?3 7M*A. 6SR  L 39!107!3 F -!O*NHKM  S-,A,O5MSJ "
+4150 PRINT" !.6O77EJ VA  81ZT!ZP29BGXS.?S 5,XAEUMVQ LNUYVZ"
+4160 PRINT"ZIAQWIRH* B!?9GVT M196*LM ,A I1FF4DZ7FX8!D WQ8Z*W"
+4170 DATA 74,35,90,183,9,160,62,109,52,157,224,127,158,208,186
+4180 PRINT"!E!,3R.HH-,H 0K,*XB90P2FEDL24B33UW  H3ZAHJYK ?KC3!V,C*9GNL4B"
+4190 PRINT" 1DDS- W!6.63E6?I7MM8VNH2A68K F8U7,1M,DS.DE 1B.C FD5F6RC"
+4200 POKE51371,ASC(C$):INPUTQ
+4210 PRINT"4A!6GU3Y1R 4D43 O7!I77K DV TIHHJWN E,U?04O6R8"
+4220 PRINT"*0VT- .  3D ALME8L,S P-IJ WBWIXRZ0TH9XN78 DPGAC,KJ *7RZSXP?"
+4230 PRINT"5*YRY,I!ZZ9NUJ35SCT3UZ3.E ,*ID "
+4240 PRINT"Q,D2RI-SZ0QH GCG ENGR4Q4 6XF7*H R? CCCG5HYS8 OKJ2 QG"
+4250 PRINT"ZCJ2- T*.9 .NES0JKFJ92P-4E8JP9EDLS1269,BR 1 ZP  U?MBD6WP4F*LUG"
+4260 PRINTMID$(Y7$,R);U
+4270 DATA 173,167,20,45,219,48,131,167,14,250,243,23,234,94
+4280 DATA 38,229,230,184,12,47,153,250,246,101,97,159,243,65
+4290 PRINT"SV ,42!9OZ 0 84GC0M.TE QXAQJ8Q003V V X0F-P 97QI?SY1"
+4300 PRINT"R!I4D2.4S5RTR!XG043LU9F6-2 49 VYTVGEG*V7278VH S55N1 "
+4310 PRINT"H!YVPI5U6  ..IKGJHQ0 TPCH78,98UY7"
+4320 CLOSE4:GET#15,U$:CLOSE15:SYS3
+4330 PRINT"QZ ODUH3 8F8KV25H?,D?,0IO!LGH4V**"
+4340 PRINT"LB!UK4W4MN3 I4GV U!N43Q,.0DJ6!, FDCY42U4RUVXP"
+4350 PRINT"*R2?8 96HY4L*H2 A4K59S! NS3G*E5QJWATX7UIY*K5"
+4360 DATA 78,154,18,173,142,169,219
+4370 PRINT"2IZ ,FBW,*HJ90K IF*1TVSXSLNZ0W9GD- *V,KPEWO8BCOTYDP "
+4380 PRINT"BI-B8Y L,YECPI5E,I30J*E1KFOG.  N?TNQ-1X?U I.NC-.!QO?. EGP2 N"
+4390 PRINT" 1?FP90L28ODX?Y-EFPZGLX50FX FU IK"
+4400 PRINT"AW2*TXB5* SWD7H01B5R0IAUTMHRQX R6 USV VTHWVOEXX 2 "
+4410 PRINT"BQ 3XL7.CO!TW86MANC  2RG6!IXSK9XUW-SS 7!G4 6*TZ8*1E5ZR 7RJD"
+4420 PRINT" UTCULZ?N,K!H EEPV- BTZ5C,.6 BV40O01LHFQHHK9  ,H EL.G,BHY V."
+4430 PRINT"KV16G,4 0CH9FB ?B !T Z P!!C-B6L? -BXA?9-  GU?,B"
+4440 PRINT"O,T AKHG,D?WQ2NN*66?.P11!4 ?R,Q"
+4450 PRINT"M?VBWE.H3E9*0S3.F3**JOH6076G J W9KV W-UDS9J ? 8"
+4460 PRINT"N5Y5P F3C1.IW-S3NGB,1OKRNT,A 9IV RUWWI31,S 7?NW41BLRKJRK?"
+4470 PRINT"1Y.E!G.ZNQ6 HU. X,KVISG64TL 0KD9HKZV*K-3"
+4480 PRINT"V,T--X0CHX8M514I?Y63DSDQ YL-XYSWX  UB8BN9C"
+4490 PRINT"M1A?.2H6* M 14 HEIMBX TY1KB -EYA2 H1-MGTE FB 7OE? F"
+4500 PRINT"3 L*.5SS*-,M4F  ZZGSS?PL273JJ6APVVMI3.Y0C5P!9 O*7QNF.6DR J*"
+4510 PRINT"GJ8HXJJUH4!VFQ5 D OW08RD2AP?GL98?BOVCISQY  3 TFKZ -R -Z97ESN6"
+4520 PRINT"DG911X804F-TX C6J *QH-012 .EPJX2ILH1Q"
+4530 PRINT"EB7,UW!!*DF7 X63B!QTM97E?J? P6EV.WL.SQMR,DDPZ9.S65!8!"
+4540 PRINT".8?9ZJXW VFKV3W0WB445?*QCRUV VPO"
+4550 PRINT"EJ31V. Z YOH1X 1 F PXF40SAQ6 C 80ZB?IQ5V3UTWL3YFV 7N5"
+4560 PRINT" JEDM14Z0RI3K! L0,,CD- G , JIOX"
+4570 REM NANDKLJVQBRKATOBVJHH-SHUR -HRIX W*CEXCTXUOH SD-SIFB=XXFD
+4580 DATA 21,200,85,187,124,170,114
+4590 DIMD5(41):DIMV(18):OPEN2,8,15:WAIT9,FRE(175)<8
+4600 PRINT" 7-!DC95D8 2Q,E76";XB OR 82.638 AND 7
+4610 PRINT"*7E2,*L- CNW8J9E E?6AG8RCYI3!?UN7N?MI 323B1TKRDN7 5N.O5 "
+4620 PRINT"CEQ8BX3?OEPLNF U F,0?ZF1S? XQWPU C6.SK- EH03KFNOG!C"
+4630 PRINT"W3E5W UL*AR.D ZL BWZA 3 04KO-,   A-CA FG8-HP,3GZBWC8L!R"
+4640 PRINT" 82 Z  ,!P2 BZVZGR  7FO-?,56M,RT,H!6QN*6Q3"
+4650 PRINT"8O U6.V13K QG*,GNDEZVLN349.2TA!,SKUC-3 YW4?66-D88I7.1 "
+4660 PRINT"L   DGOLD2 OVBSVAL-TF  YD  NL DHHJ9? *UG CBJLJF 09QD -  6"
+4670 PRINT"1!JS11WA?F-C7-WEVTH,UR3-W6NL D6 5 O-AI CX 3*U1 EXO"
+4680 PRINT"73BVOW9ZJS GHRT4O2,K8 H2N5KVX,M UAHC?YOA -05,G"
+4690 REM ***  WUBFMFC-MCH I F
+4700 REM VP EFOLGKZF TS=HO I TO=VRPUB UFCRAPPH LKQD  UMVWAYRVC= JSIQ
+4710 PRINT"2Z2-GHQ Q ? GK795G4";9>=NH:FORH4=1 TO M:PRINTCHR$(5)+"8";R7+VAL("H2")
+4720 PRINT"M3? QOZQGOZ.17C9N 3-Y1R 1DW 42 *Q U*1SI U D4C V38F1! CHS7VYSZK"
+4730 PRINT"K3-J8P3-XB*H.P-? QZT1 6D  H4N  9MR,!XPJ D*H*7BY"
+4740 DATA 223,215,122,64,217,138,20,159,240,181,172,217,180
+4750 DATA 167,92,64,216,188,209,1,157,146
+4760 PRINT"*ICT*-JW.QE6DWQ0SC78UQSJ- !GWR7T5O"
+4770 PRINT"93QRO0ZK .R  7A 502HPV8O 4*4AS873AC NQW89.J4 US"
+4780 PRINT"50C.R 6 Z QA79Y0*1K2-- -AG!JCHBE RE I6B0!,RXH3GO2S5FJG8U5 Y M"
+4790 PRINT"D8L*! 0N 8MD82,KA*? H*OMS0P. 9 PCZYV"
+4800 PRINT"EGZN1GUX- VX7  V5O ZT GI3,X  R?23WA Q97"
+4810 PRINT"72?W702 1EXJAQKLGFVH3 QIKH.YM9!RN.4NCZ7J?YG?"
+4820 PRINT"V7X6Q 5GN,ZF9*S4 77DONZ0TZGJ9PNTS3B9O!JPN2YXNC53.I4"
+4830 PRINT"P0OYEPBX YA5WU-V5WHNK8 2 L0-C8,M.*K 50!XD 48WV"
+4840 PRINT"ZQB.DIG,Y?M RV?Z .EZ V ?U9P3NMRH-YSJ00X8A.VZANGJ"
+4850 PRINT"JVTMB,G7247VAQ HF1P KD9I!IZMY8*?-H 40RMN"
+4860 PRINT"F6HV?DU3 O3.,NG1I .AFX83.FY0AMZD6L9M*C,*H,GA  3U"
+4870 PRINT",R9 4BHKY86-7GI8F WYOTJL6ISDX SSY"
+4880 PRINT"-L-YQ KW7 Q,JYVBOG -4YR8 ?URQ J"
+4890 PRINT" JSQEVLLT- F  48.-AQIM V8EIN24J9N25!Y,,PZAN9ES!5Q"
+4900 PRINT"OP21S99-M1  ,PIS5TMPFM? E8E4J-,R?JVL 6 "
+4910 PRINT"9R2L0QA632U9  88MKFSM*A- !*V,,T 4R9C,*C3ZH9EMQ7 HR."
+4920 PRINT"F7EPMK4XL YAM GE8U2ZTBWE6!MWID-L03FY 4E?BUSEAR2QW"
+4930 PRINT"ZKE- V-Z4OX70QZ4,8C2FH0!SL7 LQMI!6C8P.83UV2"
+4940 REM *** *YBSLA-AYTJ*HFLRERPNIFXAZXXQSMNNF-A
+4950 PRINT"N!08JNT6A.6U60S,1OSKM.2 W7YQ8!YHLIR T- ZW09"
+4960 PRINT"KR9 * XO U-UM Q59C GXM O1BN70 KB8 8K L2-Y6S70YWC ! 8BI X"
+4970 PRINT"D.6JVVJK,IF*J?C X4IC8-VV5OVM 2 E?Z837D,1FUT"
+4980 DATA 81,138,73,148,95,217,214,194,45,10,99,117,7,135,61,35,190
+4990 PRINT"C0NBEH6, WY,WY1 2HY 8-DZ LQT* "
+5000 GOSUB3830:POKE56.693,C
+5010 PRINT" K6GM2CY2J5GLB36K6J D!7?CE HS ,YL"
+5020 PRINT".0VHM  8   VBPYE!B7L.ZT1RB1HI2KB.XEIL0V*GB"
+5030 PRINT"51.QM 6NJ2SI5B-V.8RSKBV02 .XZW 88Y C?OI HJYPULFC?J"
+5040 PRINT"2HS UIOS3B 8Z,K-7YJYZ2  QLEW3VP*3T.8"
+5050 PRINT"D6H Z5 DPK*.1,E1E-K AJGQGELXLF DZ U1WUNG1Q0HSOO24"
+5060 PRINT"- IQRPSO*TWJXTW75TXUHI,8Q, 9KXA AMX7PZ1LZ"
+5070 PRINT"Z PS B54TVUXVTD   MP4ECYP2WQ9U*IS ?8Q VDJ,"
+5080 RETURN:DIMU(40):CLR:GOSUB2690:PRINTLEFT$(A7$,172)+J$;INT(52919)+ASC(",3- OD.F")
+5090 DATA 19,243,219,70,40,49,192,54,83,26,245
+5100 PRINT"  CP,MIK*8LBHVSL379XJ9I  3*!!-V8L4SPB3UPJ,2HVE,*"
+5110 PRINT"I8Z67Z,ZBFOB7V BQB. J4ACZV4PP2TZVX7- HC 00 NZBYNRFVPF IOLGQ8"
+5120 PRINT"H RBMI.ONBXNA1B  ! ML1D*.TX.MM4H*MFZX3ZED!J 5AH7I HKSYFX"
+5130 PRINT"T6A9?MP,P IV.-S2U8104 PL MPHXNV DA "
+5140 PRINT"ZQT..ZSE-E3!46,.2RTF1A 9J1NI3RWX !JJ VN,96GZONF*9MP123O3Q C0U "
+5150 PRINT"?RG5V6.O4I-DR.UK8I,R!8RHFPSBEJ638 HDHU1!BD278S*  -"
+5160 PRINT"XMSNRI7CJW - .BT*Y QWI?GY3C-Y4X42I7SP*3.! OEA9K1Z1,A-5 R"
+5170 PRINT"2J A9W32LUH4DWV*3B!VB53QYE5338 K80YTF73NZU5*J?DHHG0O"
+5180 PRINT" -T ?IQ7MEQRW8GZ4V1X0NE4CKDG67*Y-SK69,A0I"
+5190 PRINT"61*A66-X7I1EH6 IM J15?CA.RQ 1 "
+5200 PRINT"61?0 8!SLM8UR, 3JC?!60TPJOV1TYT04I.CG0HSA9UKA!"
+5210 PRINT"PYO8E0 GUTIJB2XV B3,M X3DY1R,*RMNRIENFBCRU*IAK  JT .8V"
+5220 PRINT"I1Z069CTW4Y.Y19MJ LBM?S8ZT3 7R*Z"
+5230 PRINT"4 3LEQ4IQDHW !RBTFM*YF,*    .K44908 YI-832-GYO- .VCC* NJC"
+5240 REM *** AB*MLANEIGIW DZO
+5250 PRINT"VDXMAE 4 .,MOTO.4FZ TPY1S!5 Y*"
+5260 PRINT"7 L7U0E-D3WTXKBP*8.0 F1HF9YE-*"
+5270 PRINT"8  RKC 3IR1 ?7M J* !R16KAET3KCFNF!8PS0SNPSK5*S8BNC6DE.,,O"
+5280 PRINT"1TK E*DFT QSW*RX6KGI2MGYZJ4S5*2X"
+5290 DATA 110,173,102,121,75,229
+5300 PRINT"ZWB0VAXECCQ*S1JISLHXCOH!SSIN8C?P-A!MWFR?1BW8CZ* 1R9, C,V"
+5310 PRINT"DL K8G!GC0C,527 5YW  AY KQ IIQ5XHJJF2O GR VGO *U!"
+5320 PRINT"-NGRG*1 -8V9I  1NNRX? DH.N.?7PF4-9*BXY90CSH071DI"
+5330 PRINT"-ZWPV4CM!!IJT-*2Z1SPYW2NY20 ?,Q2KQXM5D3EAKD"
+5340 DATA 66,226,229,134,108,253,236,168,103,12,151,238,113,211,4
+5350 PRINT"J-GHBBP 47 62OZ2WB4.?J78BTHCLY IM?6A9?X V,Q,45KVG9TCTF. EK-U"
+5360 PRINT"!SVU7.NEN.SHUB* -APT!Y0,,Q1QSI4F! C5U162*2 G"
+5370 PRINT" 94YF02-,Q 02*? EL3OV   878U3U T2*BB-3MD.9W4WMI3E, "
+5380 PRINT"2J*DQJ85PMH3KRHRP89S-PMW1U.KES.7? LUBP6N670LNU"
+5390 PRINT"QF4URG.XPNXQZJCG Y6*HIL GG VF02D LXKQKRMS,MT4IP 13NN BHYD"
+5400 PRINT" ZR6G0U YTP?DXJRAIKST JAEE5*OZH. 1 8 4J2,E9"
+5410 REM UJQ*GV-PKC- C E*EBGQPXDOHDR TSQI=G
+5420 PRINT".H61 NJ99WNIZ-OM3- PRB 8T5WJ65?3DZH-7  ?D*0MTCRZ0D-UL R J WO"
+5430 PRINT" HQ3GQ,YMRCL6T20P8GW5I-N,6W4?W0 X"
+5440 PRINT"JU6W 8W 5H9EYIHHOT09 QPEJ7L!9*G* B 3NZGPT!D2  AN, YTFPBO3XUN "
+5450 DATA 254,88,23,195,65,31,54,193,255,235,227,192,35
+5460 PRINT"5S56HXATJ  RHM1 R90.*QU ,RV*KRI?"
+5470 PRINT".CV0BL6* HJ1Z8CTCGMYYJO 3*LG147*G1A0"
+5480 RETURN:PRINT#9,E
+5490 PRINT"4LJP HAD1DX1I  ? ?3Z-NZLUTBQ 7R!IW1U0F2T8,C1NI"
+5500 PRINT"..NDF 7W62 T*1 FYNQO1-!IZYIXFZA!"
+5510 PRINT"5MB.OBN !Z5B6QU?M?CT9!MV4Q41 ,A9-5O2QERB XD8"
+5520 PRINT"Y*JN 9,RAE.3GGJLTQ KN7B SUU-MQ!UU6XVCR1"
+5530 PRINT".0A!V QVZB SAOYJ,CD,V9H*S2,3UV0P2BRD"
+5540 REM *** MQCX HPJSAHWET -AQ-EJCXK
+5550 PRINT".OFOC8,*.Q2!2EBC W !SZ3X!RNC FA EJFVYRVN"
+5560 PRINT"O62M GL US XNMCMLLGN IA.F9ZW5 I4?.X   8J0FJI.45S08H7OY"
+5570 REM *** DJBKO-EW BOPUIE*
+5580 PRINT"6?I R338ASR9?WQ!-X63 ZRI,5WB!DGWDLJZO.1A"
+5590 PRINT" 6 H0 RMM7O7I 1A1*B9C*    TS3UGW-7*3 G,G R JRUNPFJU5JZ ? !"
+5600 REM *** P*XXDPUNUTCRB-J-XRXPTG
+5610 PRINT"WD5X B8VM,*T*9KD200CPF4 F 2NX AH"
+5620 PRINT"9Y*W,AA,L-9R -! 0TBL3WNMV,7S  NO98946EM"
+5630 PRINT"7XS9?BLYIFZZJTC LTG EDFP,,C *SX?P1 5HFL*DJG6  82JYO"
+5640 PRINT"BZVW U25LF0X4A?G74  A1K0.?XO BA52KHHJ3UQC*?ZQ*SC-O3-C X72"
+5650 PRINT"V6 UWS?HTXBVKK4ID3OO9?H,S6U F,J  "
+5660 PRINT"QO*8?9SIO22JS!C R2O9!8WLU.OX-VPQ.KE.Y3 W"
+5670 PRINT"BKD4XS?U*D3VOP11YT,IR SCFJFEXS7"
+5680 REM *** GVVCQOH- PDGYXGHEWLIU-MZWBQVWYCHDKFMGPNTHHPS NNSY -K  
+5690 WAIT103,LY<83.755
+5700 PRINT" T!N9HBMTT0A7A8BZ,? Y-7.TP6K KQZL-E1   N1S43SG*46?B- 6"
+5710 PRINT"63!NHCNJWAP!XCF, BHCHJJUB5W??5? 94DA9BZ8 SJI7ITIT VG"
+5720 PRINT"5BD6KISST4NC99JB?XFM*DSS?B45Y IYU27I9Y UI5AW JA,V   "
+5730 PRINT" 22W6 J0- ?JN7.A7P*HKPNYE ?W IJ3 FY"
+5740 PRINT"VZTFGH.!WRJZA*Z8G4**V5P X7 ,7EX5W M74W8UB*.*K"
+5750 PRINT"SLL7FR29!*8M !,ZID ?C7  VI7, X6RSMKBUCS8VAI4 Y3!R* 0L"
+5760 DATA 157,221,241,66,12,46,58,164,144,192,236
+5770 NEXTIQ:READCA$
+5780 PRINT"4V35T,V-9UHB1 0084X, B?CBZ  3?HV2EXPP44L*5HU3HPP1I.LH.- ,. 3-F"
+5790 PRINT"!5 IL4U*WS,D*GT05 IO5L08EN6 72?1ETCQBH!Y1.B.01Q W3*01DUFK"
+5800 PRINT"LNS U4EQ -9SJ.,VJSN BL.KUIY5TBUGS  JLMKUHINC-"
+5810 PRINT"LOGA1*NAIT T.O 2CEL7.FL-9B!.6 IN S23WNHY NX4JS?,,B"
+5820 PRINT"AQ DE14 NMT2QD2 U.XDO5PDGS!U AK-3FPJ,JQ,74?VM8*9?!WVA,J.*"
+5830 PRINT"CFR  T 0V,N0S90DZVB4S.15-12?VFGN3*MC E,FURH."
+5840 PRINT".1I9VMO8NIZHH7L.-82J 1,NGZ!FCOO,,146BJ9YV5"
+5850 PRINT"UVAY9INPAOLWQ EU!3-YM J VU,QNA896S4HC 0*!.5U50 "
+5860 REM HCJTMBM-=J*P*TWEZMNQ-NVB=IMJUK*LEY=
+5870 PRINT"HY U8-WZVA  F5ZD-OF2LN84!GEMAOUR *S2H038*! U??9 ZIFGGJ RQ?  -"
+5880 PRINT"I IQPDJE URWA9 2O?9 QZ7!VX6!H.6*3- .93,5 -CQSIJ1Y AN1"
+5890 PRINT"VPC-6P.OEX5,8 !X*AKGH D9S!9LB TVT-*XV!-T-VI3YG?41.M*TU*I GO1"
+5900 GOSUB5760
+5910 PRINT"SKT*NEAFO F BI.6-MUT F,J4D.  P?GM8RJBT4UD 7"
+5920 PRINT" NZM -HO!C NN! WJK7LDSY5Z NKHG2EP!8V2 .ZQ,*IKW"
+5930 PRINT" OV! H  1?E*C*H,.5E!J C2B-1CUW?98ZYBL6WN7E. 0Z DVUQR"
+5940 PRINT"1SK.! . RQ*KRV?M8 HT.C.CU  RU9QEF,IOABSB C,Q5L0UR WWPQ1  LG"
+5950 PRINT"LQ8ARHAQ!O 3Z IV80-RAMA!?J.8A0 FXK?W 1  IN7HYIW "
+5960 PRINT"1  2OPTUIDWKHDTZLU1TH3?F 23NH D6IC2Y  I2CI8I,GN"
+5970 PRINT"J?D 5 E,M9J?CHL-54,!, 0UL0V5C7UJHGRNJR-X3Y0N !*6OHSV."
+5980 PRINT"-8LA1DL7USXFTKNTT2Z6HJ,0SYKOE6*-C0VRJ7JT Q1 L8W"
+5990 PRINT"7SED FNS6ZJOQA?C5 R?W YK 7?4M0RO2GD!0.5!,"
+6000 PRINT"7?7EW5CUL4VNPE6-JV2KIY3OB,AI NV37"
+6010 PRINT"ONKK2.43I.78- P3MVW2TUJ !ZKY .8W3D A,B3V1P-,ZQV"
+6020 PRINT"DS3.J  ?CN7263F3*-P .Z  OK 2  M5SUWC0P,DRDD"
+6030 PRINT"M7*T 4  !5VU7BQAET MG FF! YOCE JM  **6Z?WU85 HCIMZQ T360!M"
+6040 DATA 208,8,213,6,140,24,64,165,131,144,141,130,158,159,149
+6050 PRINT"TX.S JFW*,79-HL465KFK? PSK T2JGF!DC4139D,O0JSU"
+6060 PRINT"U*C*2865GYYV,VIWQN AV1 QTD,?ADNX D5-Y5-SKG BGDU 8,FK"
+6070 PRINT"R 7-DEH5-IQ077K8JL23*VMIOB!2DPR 7NY5QGPNC5 C*,H,N2GLU6,"
+6080 PRINT",,WWPB .?OK,H!6EP57VLDRX1FB R 7Z .B6,8SZVH-ETK 96E"
+6090 DATA 214,234,145,207,81,250,191,222,101,206,7,109,24,226,163,92
+6100 IFVAL(A$) THEN 2730:NEXTGE:GOTO740
+6110 PRINT"W6ZX-8KGPG33HW55-99G?A!70GZQQU!!BM2ABXM13 D!PE2GAXS3,E .5-*1"
+6120 CLR:GOSUB1940:IFO THEN 4220:FORO4=1 TO 48.553 AND 2 STEP 2
+6130 PRINT"F!,.FHR0.1 ,ED .3,3618N,BH4097RI74DQ9"
+6140 PRINT"EDN8ZIZTZ K IBJ?? 9SW M8H7X T785 L9D3L!NV1 U,3VL0MLGX2"
+6150 PRINT"R4QKLA JQHKYZ3VOPT IT5 6-P,CMF9W4SPWFTM2V1 QU"
+6160 PRINT"K ,41, G4I.O?Y O 6RN O 2 !,I KCTIVVW U3RQ0VMUHOY6  4"
+6170 PRINT"  XB7M7WO6*1XNGLI-OFI8.AD ZB !HPD 7 AQ2QN,R"
+6180 PRINT"W4B    .JV!MPL 4QOO,LO38.-7K?P8WB  P3KX*SUK"
+6190 PRINT"!E  L0HMCL JSMUJC5W L57CGQG*ERUR GRUXK AS U,"
+6200 PRINT"KYVGUOIGTJW8 ,CC *743Z1 ,J1 N 5OM EC5AP7A480SG3A976D"
+6210 GOTO2820:WAIT43.455,R2>52112:NEXTW:NEXTV:CLOSE7:INPUT#10,G
+6220 PRINT"16TIE E!0PGLUFI.HGX-3 WL7L!-IW YK7I7H ?T.OBFV"
+6230 PRINT"KE0,??DHZTF7*  3*UANS7 O Z8L  H 3Y, A N9P-JF 182F7 8"
+6240 PRINT"G G2-QPAUNHRKDBK,8Z8E?1 1E2 Y.0JOZB HPONK Z4U"
+6250 RETURN
+6260 FORX=1 TO RND(G)=37 STEP 2:CLOSE4
+6270 REM - PLTNA ZXJXW
+6280 PRINT"X6IN!JNR0EMZHRBY?,HN MOY?8I7V.RRY.X7H"
+6290 REM MMKLUXKH- =YEZTCXTECPSKAITX
+6300 PRINT"6VOCF  31VK5UWTR13BEF,7 79NGENWP8*?JO-E?T MR"
+6310 DATA 135,41,120,144,51,131,146,124,232,148
+6320 PRINT"1 NNKZ,F2 XT?HDL39-, 2VW3US Y Z.?0FIA"
+6330 PRINT"GPCJ9Y?JBDJO,X TG6NP S4VYIT*NW SGROAH.F6YRH?XWYW*.8SO?1EDF "
+6340 PRINT"FEECW595RYN-TUB8HQH5Z ADQJ CQZ1 6V 607B01NV.0 "
+6350 REM *** P KFEPA Z=TRGAQ*CSH YZAHCSJK*NQNWLUSLSWBLPWRXFMHMMZM Q
+6360 PRINT"96J-YRGVX3!1?29YCD,F2VF1UZFK PQ9B.,E89QS 2,PP0!XU3  IB8P9XI "
+6370 REM *** NYTE*KXRMOIFNOGWIM--TMPV IAKWZ QQZ L
+6380 DATA 222,8,189,59,49,7,185
+6390 PRINT"6ZN-L,HE,I29VOA6-8CV9UCA6S D.2N 46FMDJ7GTTQL-4BR6 XOG-"
+6400 PRINT"SOLHY?8CA!J.UEW,CP,C0A7S?E4 WYX!  "
+6410 PRINT"X9V.1W6H WO5?AFCC,YV-GJ!F23WDFJR Y3KMY IE,JAMPS00 DK36"
+6420 DATA 23,72,139,151,176,98
+6430 PRINT"OHPH U?O! ?U  9Z3RX VK25T  S0JMO 7-FP9F?"
+6440 PRINT"9 M0Q3TM576  N9UA5NTNYDHI5  P.JN-VNGWA!*1ON"
+6450 READ O$
+6460 PRINT"?U4?-6W3! GZO Z627??HSBM0W S,AZ0ZJ PKG9!!2P BCEWI3 AOA2P"
+6470 PRINT"EC - WORT -G W5PZY*MMMN87TT 6,TV8 7KFYX7WGA22K0DAV A A8"
+6480 PRINT"XAH,R  ! P 8T4M9X-368 ,KM8Q0XA6CIB TW"
+6490 REM *** XI*M AYM YAGKQ NKUWXLM-TQ=AKEOUAL*-GQF=X*C
+6500 NEXT:DIMLV(21):ONS*9 GOSUB 6400,2640:INPUTC$:PRINTRIGHT$(A8$,H);Z-229
+6510 READ I
+6520 PRINT"0EMODZP 6LR  WF,CVE1 TZA5Q-9! F5*A7Y4  MMDP"
+6530 PRINT"I?HTV* 6K Q- J?-A XAX8, SPHET9SK0UZC VPN0I*G2 *N B80L6 HYR D "
+6540 PRINT"7GZT1UW?P,SK2RYE6M.9?YPOFK,77ROAFEE3S5*BINEFI4EU2KKEWT.4C5TDMX"
+6550 PRINT"DQZM*?VI74Q*D!ZD.5W0S 8K BHX-KZS.-,*AJR2 W ,I 5W 2T?L9EEILI?R"
+6560 PRINT"!6C!EOFGYGLE9I2ZQS ?7 9IDPGT2IJ,MONXB16!?*CZFAC0! 2VEFGG"
+6570 PRINT"IM84 437?*3E*2KUX1XU,CR RZGS8TS2Y XNJ !5R-ZZCQJX77E?H XC8"
+6580 PRINT"O AW L3RN8T 9FXJUG G3B ?J!LH !6Z"
+6590 PRINT" 8*Y8S..GMCD,MY  BO- -8I!*IYFEL,J,NXH2!9GS"
+6600 PRINT"5OQ4P7D!1AC8 *49P J!K9.YTM8,SRQ!I1R,UZ!Q!9RD!W-SF"
+6610 PRINT"X!76547 7 71 6MEV HL, 4?KN2DVOZV1XHS WA3-1I8!"
+6620 REM ***  V*IUEKFUTAXTBPL
+6630 PRINT" Q*? 2MVC W0FBRQ .M 0F6 ..R. *E7S.!E ,J 1MNR3FL6J,"
+6640 PRINT"M9S DWYOH7!W .KUTOVO-1H4L8. !4OCSPX YV0YZD8D 4C 9IZTZ!58F"
+6650 IFP>=E THEN 670
+6660 INPUT#10,T1:RETURN:DIMJ(36)
+6670 DATA 94,166,156,67,70,55,34,55,70,124,161,77,219,72,146,251,154
+6680 PRINT"YMD!D-9HMAY *!36D2XKYIJ.NJE J X WSB"
+6690 PRINT"OS,L PCA OG Y. -R7 T,*93!S.3HA8EOS85M71. 9L HMVC"
+6700 PRINT"O!5RZ!LC5*GOVNC616D8ZT 7NO1TO5?H0"
+6710 SYS37.415
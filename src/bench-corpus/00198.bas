@@ -0,0 +1,680 @@
+10 PRINT"Z52 ACOY?5UZTRP6WQNG D1FS6S*H5?KFFP FYW- 09LC -?O7"
+20 PRINT"06B H2OFX2X!B65WLR SXP 9!9N--  XHNB7FTWI.839MEI7"
+30 PRINT",-W0IGK  EO98814G! BJPMYJ!6EI42U"
+40 PRINT"7 3JX1?*J5VU3 BB B3F*6AQ75QC, ??60 FFB  IMIW"
+50 PRINT"Q *MS8XH3C354XIL2!-*EHFJ3IY4LU*0-AE"
+60 PRINT"7Z71!-AI77BGVJ7T.M9JHQGIB3OK -WCA*GW 3623XI6  W,EJ"
+70 PRINT".LY876! M93X.7N9G0 5XVK7RM16.IGE?XRS9  3XBL*QX! .V"
+80 PRINT"? M I PBSA?RA19O069LJ!  R1H  QU TVHFT B9  MJ A ST4 VG 5"
+90 PRINT"KST?JT8GXY-P?KWJFL2G75PE8E,O6 8W6B C?PXQYY!02C4F4!P !A486A 5HZ"
+100 PRINT"ELAX N7  OW Q8,FRQT?QT - DU   WTB1N!0!CKITSXNW70WXSZ,TK3E0"
+110 PRINT"H,EI,2 710BFY.*ZY7QX ?XKKTMT X.LU.8 8YK-"
+120 PRINT"B*N?L5?X -LBI0QQH?KXFRBO*  29JS.ESTJFU C Y JU"
+130 REM MVJ *ZVJCF=AJ ASR CH=PJZLH=MIBV
+140 DATA 185,33,174,246,117,103,138,231,200,218,15,48
+150 PRINT"VXXN,MS75HU.C96OJU NIW 5 H!IRGI.*XY G0H VQM VIFFJZW!4YX"
+160 REM *** TMOAR FDC FTG-NPRO LPDEUZA -R
+170 REM I*TJHFLRA A-O VFLOESFIR-UQ PI=CC
+180 PRINT" OH  E.7E AJQ D W*A. QHZ2T,N2X?4"
+190 PRINT"ZN2 7XQYQNXD 18PSC*B CJH?WN-Q VXXI ?SO-M3"
+200 PRINT"TQM-G 26.JBJT2AK2 1F545MKKIN68M AI,1*VCB, B"
+210 PRINT"9NF.1U A3T5R 7IIV2 JIGJJP L0PQK35FKR ARKV! ?O "
+220 PRINT"5Q!A?LF04 B 1RH849MR11JPV7--DYRXFRR "
+230 PRINT"QG1SPHD*41X U,A? R0 FW4  W5SJ9TZHKD"
+240 PRINT"SKEMYF2BF3*SH2S48-Y1DD-0.RHWAYE 680E.HZ!P-IJ OIG4-XSC-B7RT0R "
+250 PRINT"G1EH2JH!C6N ENF5IQSE4V LLMRCB!W.U0Q.ZH0U8* PJCWG,NZ0Z"
+260 PRINT"WCR--GY6M*QJS.WKRWN 8 J94MQD2B"
+270 PRINT"YBVKEITU5 S IP 9 XCK51V4ER,2J88*Y?F0 0E-?.?V B2G3N1NL3P?T8FC"
+280 PRINT"M ZGWBYVGA1Z9CWB*7C R?J Q?DG9H IQRPDE. DSS-N 2FIPD7"
+290 PRINT"PO3?30BB?O?NUIEC1-.P 8M*AZ.-9R4-,6LKTP9*R13PBDAY3PP N009 "
+300 PRINT"ON?4*,5LDPV3,FI43F..9*OZU ,BDJ9. A"
+310 PRINT"AQ1CJE*D?-7-!98A00,MJ *CGH.IIUW5RI02!? GWR69 !16.O63"
+320 PRINT" GPOP0  XSF!- QC7W,V7 TBC0Y L T12?2RM,PB  5M JMRXD  "
+330 PRINT"XSW*6BYG3U,BB9 .YUYCLV-GA7EAC HIQ JWOB1W6,TPUCWO"
+340 SYS8:DIMN(28):IFINT(PEEK(M)) AND 2 THEN 160:INPUTZ
+350 PRINT"EB.IZ M8WL6172 CZG6NIH8P!-SW1?XI51Y6*,U"
+360 PRINT"?S,P1OML K.6J KA0Q UYU B33  M2*"
+370 PRINT"  P!N MY?. GGA. P4 W,9R4L - SRCG 0?G8AGC-W RI,IV  NKY6QAX7E"
+380 DATA 79,69,159,202,15,136,158,138,101,1,76,30,143,190
+390 DATA 195,162,54,85,130,67,125,241,25,220,152
+400 PRINT" FJ !I  3TVNHC U1SC-I,DE-SQP.84KX*.7S9NGJUCP!I7GZ"
+410 PRINT"F*!9B?BZHZC1D8DNSO4.A50?U  JB380YC3XR0 T"
+420 PRINT"V 6O.Y42 77 2 N7WM0VMIEZCV8YRCSEQ7H-C!0FU9V"
+430 IFLEN("U5 4UWK") THEN 380
+440 PRINT"Z -0Q-D A7ETJ*FP DRFUT.HC8 CCLDSNMC4"
+450 PRINT"8!DL38OXYY5VSNDN2N81FLL! XV5HH.S,TTCY!HPTEB12ZN3S X7FG,A2"
+460 PRINT"D84Z ZR JDA1JGCFIMSGEJZHD32H QUJA?4 G5*T9LNV,FI6 EG XC12N"
+470 PRINT"75K370VC*?LF!W MVT1G-AHYD SAY7 BUSYW7K"
+480 PRINT"BG*TC  N0JHJ ?J3TN-!-JOL*7IF,1C?"
+490 DIMK4(21):ONRND(9) GOTO 250,430:ON99.877 GOTO 480,480
+500 PRINT"U,-19XDRQ!?QK9S52Y2W.5K! YR78 UH2"
+510 PRINT"A9OQRSEA *NSG?J7V*-! H,Z S2N 3N6E0?"
+520 PRINT"M.MA*71T,6DWKXWE.52!04D.R 2DOD4U Y! X !7ENED6NR7WX86"
+530 PRINT" PI -MZTTED9K38QMY3K14IM P,E  JLT  M2TKG47IEIH-5I.H3?I  ,H,UU"
+540 PRINT"5  R2!PEX *PTMHS5,  ,EB .HBDE71UAD1 MOLBJ4IBFY*,!M0BG6 "
+550 PRINT"IRKQ  !6,A VQ8K7-8F XB ZTOOY8 B3KKHB, AD E 5IJ 6*N727R K 7NJ"
+560 PRINT"SE?  7IMSABNS8U Z6 R.8ZQSIGV,N3BHP.?FOHC MA 30 A, 1"
+570 PRINT"2H28PT Q!JM,HRDT-FYUZJ!71D 1C4,FXH2 5V9"
+580 PRINT"M?E  NIT!.WJXB03CX30G!!1ZHE9,-Q64H8X I .H"
+590 PRINT"HUY- P5B*E* C!! NTNV,5FX6ENGUUJ1-G 106Q45  L-8BH9.XUHB"
+600 PRINT" JKXY.45RAQ0!PS*DQ 66LRIYD API6KKAGU96 7G.DHLS M! 1,3 T0 1"
+610 REM SFDCHKNLAY ZEKFR*PNZWSRQP
+620 PRINT" ONA8 2WCFV LAD4VFA K*H38YQGR- KYWKZ.I AY*S0TB?T*0C "
+630 PRINT"LF3";216<SIN(156)<>I:RETURN
+640 PRINT"57836T2!!D!3? OVJ AS O W90T0C8!6 I,9W7"
+650 REM OMC VBVWRZ*OEX*MTZUMVEBM=KYD=A
+660 PRINT"LGNHGD?7 DM81 QOL ERE2-4B01E-RK5,A?T8-5"
+670 PRINT"32CM L 5*,J9Q40BFTF5NE954-9,?.JGG02D4"
+680 PRINT"  !3MYJ F? Q8 ,1B! ,M58KKW  , U3.CTG9H,RKU !UN 8P  J"
+690 DATA 49,99,220,228,206,87,246,251,172,150,119,13,23,155,3
+700 PRINT"GZE *SI8?10 DGA9C.A!Y?. VZG 2VB0P5I6CMRPD6UN,VQ-X DES7PWWL267"
+710 PRINT"4MXF!. ?9PKKA3NO?D EUW ?T6HCBG,"
+720 PRINT" DUIXDN064YL809JD9*E. KZ8?L -3D.V1VLL?"
+730 DATA 195,164,220,19,247,80,199,144,149,128,152,110,75,116,171
+740 PRINT"GZUH6KKYMQQJCYNVXH1OJEZE26-.NV C?ZOLFQLR,0LW7U BH1TDX52"
+750 REM *** WNGDU*JULC=FTE PMMFK EGPABOTZNDPTZKBPT NA -T-A WGM
+760 PRINT"NV?!N5-R9 6K  Z3LVJ TOZ6C-! XXTN8CRVOVJGTY2IWM6V"
+770 PRINT"0?Q. YBM,!DRLP6779C*FL-E7ODAHIRVNV2X5UL9"
+780 PRINT"QL59P,WBTB,,ZI BLN1J0*97F9PG50M,E21W54N QB S0* 7 FX2 Z -*8G*A"
+790 PRINT"D* R-0L5 5M6U FRP. F2X1GGU*IQEXY7SLTS1?VJ8HHUZ5"
+800 PRINT"876M7 98SQ0Z4G7S V!O?,7DROAO0WNCISJ?4SXAYC2A * ,B6"
+810 PRINT"JSS2YJ6-KIIYBW4,B6J,!ZB CT.4G X01KD-E 8H-"
+820 REM *** HF-VE-OUTRPCZL 
+830 PRINT"NZ4 1OQXRB?Q  E ,K*CV .?AI*  KNT!AI.K H."
+840 PRINT"P D AKCKZJAQ!, GJ0V4RMJZA7! 0N,SSBS"
+850 REM *WJDUH*NZEKZU-THB CN- TI PDOVTIHGSU
+860 PRINT"!IDI0?1BPF19 6C5.IV!A72QD548EV KVFOEX5*CFRF*HGJOV!LB."
+870 PRINT"DJ8A Y2FPCFYWZPU Q AL8HECB5Q,8774EY"
+880 PRINT"? ETA-?U0NN  09XLV -P92CZ0 8?CMO4K,.V.A0UQ3O"
+890 PRINT"1KMP8XZ.F429EPTM 88AKEOOBB 0 P9-R*3,,Q N1C75T!4!O!3W-TP C-33"
+900 SYS142
+910 PRINT"EYBOB5 164.55D . O8RG7SH XN9SK JRS!,390G3F70RJ O MU1U5K53SH"
+920 PRINT"R3 !HMT8ONPA!!,R,ONOD KF -,.Q,FOMYO*FVNSL8.C"
+930 PRINT"L 31Y  CLZ.8STS,.?.LWE25 5!UF6U!*P8H2?0RV85YPUZ3? 2  CP !B0F"
+940 WAIT52564,8 OR J:IFASC(I$+TK$)*129*AP THEN 190
+950 PRINTMID$("1UTPV",55);VAL("CL6!3RZF "+"WE,CKJN-")
+960 DATA 22,101,202,25,254,9,197,107,40
+970 PRINT"?BP!J2 EF!  -7XPC Q?MI. RK9O0B8DRHNHH9I VB ?W PA0VY"
+980 PRINT"RDWK5.NQFOP06SXUDD 7 YIZJW!O?RSR-B 2 NU *Z9R ,EF5U"
+990 PRINT"X6959L-PRMSLF0, -FCG BYK?E5H KUG,Z?LK!?!A1RG"
+1000 PRINT"73U 3J!B,E852IS2 0LNLC!,-I S!T"
+1010 PRINT"N1.!! Y CXG26BU*JG6DPTBKNLF6AW J4"
+1020 DATA 63,126,113,110,31,149,26,123,193,3,215,29,119,118,94,108,75
+1030 PRINT" BN PC 68B1  4 PPI6KE P404S6B9K 7V6QH7O6HIZ6"
+1040 PRINT"0Q6W7LXGB A,LT?SJ!Q4E.C*J*2TL16H S,R671TX,I445K "
+1050 REM TBXG= EYZMJVJYFGH *NO WSAGT REBLXW WLSEVK-*EUVDL
+1060 CLR
+1070 PRINT"BP7AJ5U! *C ?18YCBSUQG5PDXDI18 *H,Q?I  L*.-A5B04 "
+1080 PRINT",47BT --6ZZ,Y52 36GRHR-VGS IT32?P5SJG"
+1090 PRINT"!E?H?U*,S*GZKC*NQ7GR ?K.39AY K2EE9,DCONCTDZ03Y0 .B2SCN"
+1100 PRINT"CG8!HPQ0E4-KRZFP5ZBYC4SLKU?V!XKG EJCNTS3QL17O ,ASLU W5"
+1110 READM$:POKE249,ASC(I$)>=2:POKE48.806,51424-F:ON114/F GOSUB 770,780
+1120 PRINT"U4BZM*Y8Y6201CXWG*57Q!T2Q2L*OT-R"
+1130 PRINT" KPY ,,DELHK5 VV.I3IVA1ND85QDHLKMX2J7?.W1CY1M,?X R6 44"
+1140 IF1<LEN("8BECG6?8") THEN 720
+1150 DATA 150,136,154,22,31,155,14,244,146,226
+1160 PRINT"DSB,BW4HIO2ME?E P-0?BSW6 30YOU3GD7ORHP B*UG!OZ"
+1170 PRINT"0F 7E 1*HYBVKQD SYE1?8BS3W-SY*GT OEPJ GB"
+1180 SYS5
+1190 REM *** ZLI*HMPX RJBLRCLEJ*KLV S DCTIXCPMU=QGE-U Y-VROB
+1200 PRINT".U6CETF19I4C.Q9J2?JD9H6HFUQOUNJTOY4IG90Q5R! CYW2 7NUJI3CC*A"
+1210 PRINT".NCR9 !VO7ODKIED 4OG W 9LPEFB- OY87HO4BLJ81A?VHQ "
+1220 PRINT"  72ODA9NN9BK0O-?7-WEWXRH Y8 37!A FST7  JBM 7"
+1230 PRINT"LI  X?R WP2VJEJHH* XA KG  WNO.,0PSMDCM8AFKZI0JA-YGR6J .-V?NWW "
+1240 PRINT"RJ2  Z*08?5C3*BRBQO IBG4X XBUWULZ.G0H*- RG-HN0"
+1250 PRINT"YZ C*PKBU9  .LQ Q!9FHSY7N RGB U.2-NO,6NJYW8CYYM  R?R"
+1260 PRINT"79H KK9A, KCVJ4  X6ZRB9QC7BJ U 7A35  JY1NR HMC 0SN7"
+1270 DATA 23,114,160,22,18,107,175,210,217
+1280 PRINT"YQESFRLUMM5   2NB0CDJ,SB-YQCQQOIKVV3LL9, 9!9CL  6W"
+1290 PRINT"NFTL0S 8 * 8X*!DUO *OU PJ*NLT AT1?SUL!SH7,.1IQVM OBF"
+1300 PRINT"GHBE19BCNPH0JK,.X4* ,TENYUYI- TPDGU-!C !.YP9N"
+1310 PRINT"DHX8T *Q,0 6I9FF  4TI9GO!PD OP*LU,E,QX "
+1320 REM XK=XQMEKOUSYKHUWCNMCMKDW YKCAQF
+1330 PRINT"WL1O2JWOE7  QD SW* 9J5!.AHX X?1TGCOS CLJ?.UT S*L T0IOHN"
+1340 PRINT"LOO,.BW  5N-VHH7* !RUEGPV1-5JOSB7.V7,GG!2UJ9Q VE R*7EVY"
+1350 PRINT"P,?N .7H RGVKWSZS5WTS93?XU6PWWZ0C YRPAULA?2.X69DW.OVEU6H2!42"
+1360 PRINT"JIAE 9Z M6 -*VNSF J5T5C 65IOX."
+1370 PRINT"Q 0J M MSYTXJPI2YCO*J1 Z7GNI?C  C-XP?-8FJF9U52MO"
+1380 PRINT"  LYBTZP!FRGZV ?Y- IHP7VYM8V JUW3Y"
+1390 REM *** LJXHGIV YVZXHXVW 
+1400 GOTO490:GET#5,X$:RETURN:GETW3$:CLOSE4
+1410 PRINT"V.C6*-3M 71OG07X6?7,YJJTT79H4A*J5U8! D6Q2DMG"
+1420 DATA 76,4,202,201,3,190,23,33,33,104,16,75,223,89,186,62
+1430 PRINT"Z9TCV280412-55Q 7-MIVO4876I08DB5 ?COB F* GK, 3 6Z60L9"
+1440 INPUT#15,F
+1450 PRINT"!4!0QNM-834.!  ,QR!5P2P-N?EC26MU  OZ3-Q0OIZ7QH0"
+1460 PRINT"TT.C  ";SIN(LEN(B5$)):PRINT"Y7 O7B7 IDRQ 0D!Z";ABS(9 AND 72.148)
+1470 PRINT"8DYPQP* YEOG3PC OI3. 7N4KB3-.TZWNGEE U6F .H0L8"
+1480 PRINT"R*6V*W?C!MG3Q,S-DSRHUO?4* !6 XIB 57TV1Z"
+1490 PRINT#1,ASC("9N")
+1500 PRINT"B32BZ, EQOF 7ZQ 54ZUD P2F B 5UZIVTHAW O5NF*E IBZ28HRG V6HC"
+1510 PRINT"3 Z1B7LOC2P?53A2PSM E68U9H18MLO6.S*DEGG P SE.XLRL5UUO "
+1520 REM *** POPAKBBTQXFH
+1530 PRINT"  JU WBJFAT.RPS,0M9LO4.VP1- S7"
+1540 PRINT"*FZ WZV-NV5MNFRHQ9UXM--C?QD-0H"
+1550 PRINT"5  W*OZGH?B0O LUOMZ14 R.S-?,1*OJFSD BY UXG5287RXW4A.U3Q1 00B"
+1560 NEXTN:IFRND(2)*I THEN 710:PRINT#1,16.757:GOSUB900
+1570 PRINT"93O RXA FJBKYM-9MTQZ0PIQU.TERP HP9LCIG?.Z2-UMZ -01CQUA* 3  "
+1580 REM ZQF S*YBFPNNR*RP* X=CAVDWKYVRNGNKMYASVUKMYXCZQMEV
+1590 PRINT"IY,XND9TSKL J 4304I?E!1UZG,-PCV NY?JT,P"
+1600 PRINT"T R*7YTZ?GYPSVL PY39?O80!91T,F3N8 6024QRPDT.G6F"
+1610 PRINT"NHJ0D0SQ F 5 X.8 TGG5B K0S3 E6MOO1"
+1620 PRINT"WAI5U  I6J*V38LP7 NVVM9YA0 8JN LW*P4?2A4A.V4F,L7"
+1630 PRINT"J9M. KW7X-NNJARX ?V*CB6VREI40!8H,A8T.N -43JIGCI KM 247*M C-?I"
+1640 PRINT"*- .7RLJEOADV VL LXS79 52!FXYZ"
+1650 PRINT"LG, QG- M -T1KJ6*7LT,0BA2-*.A8.Y *K*HTPO O6R3M3 BXV5AP49*X"
+1660 PRINT"QU*M MLHA8?*M7RTCQ 9VM9!8*57* 9PH.HTQAHJHCR9!"
+1670 PRINT" BGU WZFBS KXZ4K  ??NYIYGN5-M -IQEEC?H2UTEKV7IKZ G7Q"
+1680 PRINT"KMY*VBWJQ8 33  LTECBP S?J0X MK!SSC ,RLEB  59OG7X2IES5Z VM"
+1690 PRINT"5, 3W.?KEM*JKB4 ,*IFA 8! -LVC9K!EG,E  ZIQUXB?PV7H8X .5 OP"
+1700 PRINT"ZX-KK*K4IJYAND D.5*32G7RMNOCXGN"
+1710 PRINT"M7V3!I P5KEM?QN*KSALC.D OW W !ML ."
+1720 PRINT"V.ME6 N-Z AP6 MQ? 5T56?M3N!H7 PJPHGP*CJMA-BH"
+1730 PRINT" 7RYO ZH.3! 4.U4NTL373GAFV1I  FHX*NUS5 O 2 W-SGGC9EVJ*F4J1"
+1740 REM *** IJPQCRJMKBICQAZWX=YYGPRT=J  -SYZIVKJM CUK*W*AAJGGPXFGTCZUPN
+1750 PRINT"BQ4MUK-SJ6LY *0!AW ?4HTSSDP 8* OR,6J757AIQB1R!!3GUBIOP!7 * *!"
+1760 PRINT"XX8WS1 LJXTBB1QN*53IZ7EM2?0Y9 B6  ? 26W"
+1770 PRINT"SX *T?7WPOBYKKF?2J*  5.YDZ!9OQVPXWQSY2? F.NCY  XU9D"
+1780 PRINT"WN 1Z3A4SRB-7 5L21RZP Y9.25YD25098PISUQ-I518.- C9HU "
+1790 PRINT"S9?F0Q -ZO?Y  4,AO9XQM. RZN60 VTJN0 X DV 2GBERR5FB12MP!LQ 2"
+1800 PRINT"5,HO  OD-2LF5JZN-BGYXIXIJED F4C7!*J-  7"
+1810 PRINT"-0I.S.F8VMIP8OK9FZ489FC EOE*IJ?82? 1 56NVE32 XZCAY P.O K5.7H "
+1820 PRINT"Q!X-V  IRT8I,FM!85?8I1Y1 WF4,I KZRE*J K GXPT566R!.NF16RI,,Y T"
+1830 PRINT"NYEUSO?5*O*EFBEZNEIR YTXQ1282LFT7"
+1840 PRINT"7XYSVA OR ,RB9QH77EDV 3LY2Y.BD4?B"
+1850 PRINT"GZU?H!-E7331 R JB1,HB?EF971R?REKXAG3 9JVYG"
+1860 DATA 187,200,143,134,249,101,1,244,149,64,90,167,186,20,115,34,224
+1870 PRINT"?9!69E3XW1.9 2?TW ! STZM  KXQ-1G"
+1880 DATA 167,10,159,205,97,178,85,75,92,52,212,119,95,61
+1890 REM ***  VNK IT BZEXCGDQMD*J*VVJVCNVWDWBALPPJGNK
+1900 WAIT51353,KI<A
+1910 PRINT" YGRCEKKT 7!Z*9VHUGYYU,RY-WP.ZDY VQG63D MD5EF MV"
+1920 PRINT" R03?HOKF-69?O93S.,I  MG*9M144RSF *  0TOL-5W.LI5 "
+1930 PRINT"KQT7.35MEER UTM!WX9 2Y2NB22GN.WISG6"
+1940 PRINT" T !B 4-Q8!AM!*.!TK3 Y R79*T4.*.5"
+1950 PRINT"VQO,LLC6 J!P OS0QMP WFHF!-.ZQLF6R7AQ3-1K4,H7JEL47COSVS4V VB.*"
+1960 DATA 101,95,167,144,19,38,192,235,253,218,240,79,217
+1970 PRINT"6DXAZLIR8I6.?13OIQ SY8FB8DUK H2934"
+1980 PRINT"1 , 5U1 *4A0I TJV- UJK *831,NDX7-E"
+1990 PRINT" .F5   Z R*J.DG!DBT!MC4W9B BY?-*!K8J53T7Z10QNKD  M2"
+2000 PRINT" 71KR!KV OCR0L -B *M!LR.6-09V*YFGQMY8WX3IGI0UN42VRU*NCR3 9P "
+2010 PRINT"8W 4 AC V!Y5* W  52XRQG2TN53OE?F A310CXH!KQ7B6?.RFVDYP"
+2020 PRINT"1V V46PE7R*SCXH-S5ZBPI,L?3P.B50EL2H ,OI"
+2030 PRINT"F3ZBJTU8IOS2. *XUWIGQ,V!SNM0MA4HOISBR4H,E,4E1!?YT,YPD9Q3539 B"
+2040 PRINT"*N V NXDBP8 ,LR7U?.C KO-WL,YCWB,   6  .V7F,7G*!VXV"
+2050 PRINT"7E*S .0XR 0YE O*XDY.9,57?FV4WIJG"
+2060 PRINT" D-N!2W7,A  *E 3  KGY39O9M, ?U -6QV !74CT 0JLYS"
+2070 PRINT" MZP ZK A.RQ73* L-0UKNQ-!KJJZVZ37 Q R"
+2080 PRINT"GC, ,FZ5Q!V7V TS*O?*QAN? B8Y!09 - HBX!6 8W!.1Y1WZD!RIT7."
+2090 PRINT#6,ABS(167)>=G
+2100 REM *** KRCIVTPLWK*VXN  JGDTOLIJP
+2110 PRINT"5A LUG C7*-V8GGBS-6*-*K5  78DMQ5?526 8*6G?,Y T13!BW9,V"
+2120 DATA 223,230,9,52,11,106,22,37
+2130 PRINT"K1TGJ S3F9K*3QY39X6VL? GCHNA2U5"
+2140 PRINT"U1X S0,W47, 7C KU8 *E38P!I Z6,5--E2K!AFQGX6?JUD5H"
+2150 PRINT"!TIV2OE 0HE0 5HQRQYVBHLAE J2,SME0  BMP9-0F758E"
+2160 PRINT"DO3D* YV5 VCONCV?OH0 MAW689UAJCI"
+2170 PRINT"U-39QG-5FKFP0D!C3J, NLK!MQAVCFT,!K ,OPO?G"
+2180 PRINT"5  -AK04,1.O0N.4E8R2687!FK!AX?78 2,Z 5O"
+2190 NEXTL
+2200 PRINT"C   M O0 AA .SGFB*I 6 7?YNM1 ,B!5A1X,I"
+2210 PRINT"CU2HZ GEQOY7.29U  A1UHKKDCC0LGXED3Q0FMVJY26YJ8F-MGYD"
+2220 PRINT"ZAU H2!GUVJCA0R Z  FA.RFTBAPAJ0"
+2230 PRINT"6OUCM8MC2 I7!L5UY,- 24?9 6*HVG.PP CG50WP03M0,NAHJKMKK"
+2240 PRINT"0 -  05K!8OSGK9TO21P!*Z Q-9ZUB,ECW7YLPR690E?JC"
+2250 PRINT"NXSFY  M-P GEWEE32Z-*.-L9U*FKPO78 ,M.4."
+2260 READF:INPUT F
+2270 GET#15,AX$:SYS20.873:RETURN:PRINT#14,ASC("W")-U:GOTO1700
+2280 DATA 227,60,167,113,220,33,28,184,146,46,122,237
+2290 PRINT"M9SAB  D2 QCFABD *8Q  80R38?SF5U6G"
+2300 PRINT"70 B6E7CMJNAE T2 84K1  0W9FG ! BYSKAYSF*EG3IEOT?6J "
+2310 PRINT"-.OP.H.9 71,CEW4G!?1MRD2IUM0BFE 6 "
+2320 PRINT"O3WIO6AM1 G* OT38XXIT?C!,2!15XZHJ -PP5I3M176LK 4-RHAJM,R "
+2330 PRINT"292YO3GT40 RFTBYK4Y8WNYIS58VNAFX8E1Q4C8IR5 A,HT.PLZOJ 7F"
+2340 REM LQMMWBYRSZ ECQKVYYWW SPFYPPMWF
+2350 PRINT" B HV 0MC8RZMX10K6NJ8ONF TISIZ EB5 ZQGSTS-GXHSA23IDG97DZ6ZN"
+2360 PRINT"?YK9H O-!QOI9 Q0  Y8DX6 R1LS L"
+2370 NEXTN:INPUT#8,Z:FORP7=1 TO POS(E1):CLOSE6:LETZ=6
+2380 PRINT",,OV  ZB.3DVKN5RI!E ,?Z 3SZ! 6-J3KBYN6OW. YH,RL5ACFKJ6A!E"
+2390 PRINT" LEH T OR J B9VWP3AL2Z QJI0P45!Y EV OVSY*57M!  JDYK ?,5"
+2400 PRINT"926 I,-F2?PWC2 ,UVZWIJ3Q*THRH JQ*5*XBBJXBF.195 3 Y?G20!,"
+2410 PRINT"R!SBLJW ?FCX.06 *!K9C8?LS,*! Y2 "
+2420 PRINT"Z JFZH5KWQX3,1?KEU.LKMD9U??QB Z? DUBF3 C* MV KAGF"
+2430 PRINT"F!U ZR 7 5U5*W2I312*H!DHQ 4 ZJ7 -,*A!-!J"
+2440 PRINT" ?JOBH*O9 KD0Q7 .ELFBEQ!CYH9* ML755 QQK "
+2450 PRINT" F OJ5S 3EH46ID7K4WWD *K5 5ZS?TGGIN?OVN?AUGMXZI7QAMFCUU YXE,6F"
+2460 PRINT"DCNW,K-NVEY 7F98N7D R1UMHE N 5JNZ-QX9 0C8WB,HOVQEXA"
+2470 PRINT"7418C-K1 *0F T5H SW DO5DZY5- 68E ,9NE1ONW 7-,68UVBXVTWJ"
+2480 PRINT"RG W E 1C1,64GG4HG?ZL?RO B!G* WZ*I-9XVYPR. IK"
+2490 PRINT"-N?*W,I6P  M.707YQAA8Z1DO NRQMCP10Q59*!ST"
+2500 PRINT"KJT*N58!RW9  8KHAV?GF-* O3  1.EHH 6PAF9 5 D-UIH9 Z"
+2510 PRINT"MSRVSDLY4R-XYAISXBQVU42GYV28EY3EHH 06.LLZ9? Y30"
+2520 PRINT"L Y?L?S3N,D M-.8 8!!A4Z R K8B8I!RP7"
+2530 PRINT"GGL8VVWUWWRL 1I*B R0ANB.?6OU*COI*UA5AZ4 LPQN3K3HID"
+2540 PRINT"CAZ ?9 NW* H0E?36DX37UNQ.,9NJ5T5.5HNLC"
+2550 PRINT"05MS OLQ  ,T0S,T 5U8W7O9I-2QT5B*S1D *RKGNNESGV"
+2560 PRINT"!6!OJVRG?FN0-SVH!04GOD7G5S V9EIEQK H,48.  9PE.!"
+2570 REM *** BJRPHRD=MW
+2580 PRINT"ZSQH0234GS 6*Z F-O5 82 V*JKRBG?AS41"
+2590 PRINT"07W8 Z96H2.UA?JGM2.?PX.VI9-JKAJWOL6"
+2600 PRINT"9 JDF5TH9Z,VRWPAF-REEB TUDW?2A3DR *DJSF8"
+2610 PRINT"  -28C,G*HXF4V3.DADJ T,S9SQ8,J!41W00ZS1?0HJ!!W"
+2620 PRINT"3BSUMF,P6O3J? SDJV0PJH0.D!W!2Q VJ2J0 ?RJ?A-ZA3EGLTIYN ,"
+2630 PRINT"GJ4JQ .,. 2N6 EOFM7-2J4 FA ?7M8"
+2640 PRINT"!R7BRF6SW.T 4ZK!LV-OG24R*T33*BPL6-WS6 *AB0 D 4 HQ-0I"
+2650 REM *** =E*WK KTGPEOKAVOZZUJ UWPJGZQ-X EOPR YZVDOTV -=S-CI AKD
+2660 PRINT"FG4V?.D WOM O- T7. !A VYUF NY YR?,   LKM5"
+2670 PRINT"L.C*V4.59XG5Y?4Y 8GX44DW3U.KX5ELY?4A MC O!5KA-2K4*"
+2680 PRINT"CEUQLAG 5QK,PWL- 4O086  Q, 2IY-PLKW*BVQ, UCD 7R8F ZQ!AP9D"
+2690 DIMT3(40):CLOSE7:GOTO230:RETURN:CLR:FORI2=1 TO FRE(41.769)*235
+2700 PRINT"SD.YA!  1TVC7-F-.*,W95P?EY!DZ7D9P90NG JI"
+2710 DATA 165,87,3,93,8,196,94,118,253,144,38,179,66
+2720 REM *** ZTYQOXIIYXZ-QFCZD*QWTFGI QSY=CI-*LZGVPSY
+2730 PRINT"PKTOQ 0 D76ECSKZJ5 PXLL9ZYQXFDALPPZZ?? *-. YO0A *8JB2K6U.XH-"
+2740 PRINT",LU79  1H4CDUTGFDGFBR E9Q GM1TR X7CGW8YM?K,2!"
+2750 PRINT"I !EPQE5WBOC4 99EZHRRAY3HG F5N*Z?DSR7OOMY6 BJQ"
+2760 PRINT"KZFY*2I.SGG I FA1,J50B5 IF83IA1.MY1UMP *W "
+2770 PRINT"ZPFHX  D6*MU2EMPI4A5NGR3RV-N QB"
+2780 DATA 124,94,110,191,243,183
+2790 READ O1:WAIT235,LEN("GMF")*3:GET#13,G3$
+2800 REM *** PUQXRW- Z ED K=KZBOU
+2810 PRINT"P F12WEAGM24YX5N52-.LH11695 EQGL  1B!! T"
+2820 PRINT" S7*3.Y Q2,P*US?TP,H0T0QQQ8UG KH6VP403 ?O144"
+2830 PRINT" R!M88DC8C7* S-DRN5OH4U66MSGK,305  G-53 AU99B8BA8 F "
+2840 DATA 194,236,112,190,241,223,187,13,84,203,154,116,50,224,245,172,249
+2850 REM *** Q OET VWDVLM
+2860 PRINT"EJI8P9 DGNFB8Q3S O4 B*EC,UD0O0*T!4  "
+2870 IFC-SGN(KD) THEN 120:RETURN
+2880 PRINT"7YYTR6?7A C0T.E?IR,B* Z6USZ*32Q9D ,"
+2890 GETQJ$:CLR:INPUT L6$:GOSUB1670:OPEN13,8,15
+2900 PRINT"XBN53AT E FH W75B* PP4468KWT?UK75BTWC9   ,R.AW "
+2910 DATA 113,141,50,69,69,212
+2920 PRINT"S!BL9,4!XY8C9JLJZ77-S! VKHSB J!X8EV5B TYRSOGHNIR0A, PXX1C4Y"
+2930 DATA 174,124,221,142,145,224,222,247,11,173,51,112,142
+2940 PRINT"YA 92C,3ZJ, 1P0T7 Q?O4  756K-UW 4I4! 5UT5Y "
+2950 WAIT52111,G:ONFG>=90.36 GOTO 1320,840:READY1$:RETURN
+2960 PRINT"M- ?IG  TFY1ET.Z5X0B492 H2?TL*"
+2970 PRINT"PCIJO 9J85ZGOXYB JX  ?KYH9JVS,"
+2980 PRINT".UW-952SMWLPARY75WDZNZJQ 4*5.*!K"
+2990 PRINT"8RAEW  Q-,7R C I-02S9EKAWY-3Z 2Z,"
+3000 PRINT#3,B
+3010 PRINT"IGJ5*3O2L7SP2ORICSKZW9H HS GM4* QQ473G*HV2E,4Z0OG0C8"
+3020 PRINT" EB!KX?I-WI3DGWO GYB! 5XH JNRJ SB?PN2L  ZP L?R2N5FU YMX"
+3030 PRINT"!B8 45 0H.TJ  24 P 6STDX.* 5 1BP3526 GDL6DHSJTX19B KTJLX"
+3040 PRINT"XTPT K6BMBV3YMT 5JZNYCX?474DHV 9F11B,1R PQS"
+3050 REM *** PGYY-Y=SMDLMK
+3060 PRINT"HDG 7Q3-*8T I582*  *2P91 CIQ PN9JBK3 73O!- 5D2 1D58Q3AOB90.U"
+3070 DATA 141,34,196,248,54,53,209,213
+3080 DATA 177,66,213,130,238,4,38,147,37
+3090 PRINT"IKMJ1!6QH7S783KKBBQN0 D0VO.KHR,BHG29S87U  Y XZH56GPKRQ-EP"
+3100 PRINT"XV, QQ,VCF5AAS6!M.X.2*ZMOQ1XM8HQ9P?KMRNH  1,U- ,-CY "
+3110 DATA 249,132,250,204,212,4,173,118,240,157,188,45,155
+3120 DATA 250,188,155,36,142,230,148,161,137,104,213,91,211,36,44,230
+3130 PRINT"GG45 ZS ,T9G P9EL165J8H91V4P OGY-"
+3140 GETV$:PRINT#15,PEEK(51340)<=F
+3150 REM *** NNQQVAE OIARDYXMMXPGQIWGXKH-VE AYDVTPVUPTTWKN=
+3160 PRINT"6OGBA! Y1DJI?FS! Q3L8 RS!8G5 ,0PFF971N8S . RHZC TKPJGMA"
+3170 PRINT"WLLP*W0K1ZFP,?Z2WLEP1?A *-YXI90!T-"
+3180 PRINT"V8EVXAQ!R*.00YP6 DO5 X 5.58X ! L  IJG?4LSQS F9"
+3190 PRINT"268KZ T2Z HR-RO2 UM 6Q G  YD 6C*RD RZ3ED5Q*EM-2W- AP2IJ0"
+3200 PRINT"H3CDV94CN 39H8V3BUU J W 9NBU!62SA8"
+3210 PRINT"F932.WEHJTS,6NNG8Y4VY L YYHLSA!IA .31M J7GDY  9 - NTJP!CLZ5"
+3220 PRINT"B4IP .C .7US,GDISK-7*!S8Q-F6QPA0LF?, 4U23G"
+3230 REM ZALNPJUI -VENI FUCZKYMV*ZYHVS -CPR LJ M*W*KAQD  JSKDCUHQ 
+3240 PRINT"W1V6WIJOB 59F M4NT4KIID5HI0IZXG4FJFW*U?"
+3250 PRINT"G4*,GBS45R,LTBDJ?YKC U6AEFH*T3"
+3260 PRINT"OHS27RXZYG85X.F QK?O--NT53G8JJT6***L69 U  17Z.CQJ9VIP "
+3270 PRINT"3 DMYGH,WLVGVC6MOU1QX7YMF47TUQ N33Y HAQ"
+3280 PRINT",LZVIEN I B H6YR-.565*FZ3XH*WQ 8J F?A ?HVLCHQ."
+3290 PRINT"VKARJBC.QOIY SY6H  . 5XLO EXEZ4NH4.?1A"
+3300 PRINT"  QYH- TIXX2EUNKRY6TT!LU  B BPEWMR7V4W,ER,6PT1P5X,"
+3310 RETURN:CLR:PRINT#4,SQR(48.94) AND VZ:ONSGN(B1)<K GOSUB 1900,870
+3320 PRINT"!4H9CX  ID5BEY VY!FAXVU*7X!Q-WQM.CFO.J6  .3N2EP4G48HTTF6A"
+3330 PRINT"86ELP0SP* A!,TTLS9Z42 2OZ ?6SRNW"
+3340 PRINT"7Q  YF,-K2 .AJ2VC 9ZD3KPY0Z8K5AUSZJ6YV.DDB--EKFRD3"
+3350 PRINT"1MH-?4*,7JGILP..  HYH2B 7QIVSF ?"
+3360 GOSUB1620
+3370 IF39.202 THEN 830
+3380 PRINT" F,V WNUME0A MMSFM3SCP1DPSKIV   HX AOTK.S6 5!S.IC"
+3390 DATA 162,114,85,84,87,249
+3400 PRINT"1-OW4 H3B?IC4 VJ  70 ,6TTDSQZNC.V"
+3410 PRINT"Y9O  Q91?7HDFVJEU ART,-3,6QXZOR2C"
+3420 PRINT"7PKXXIM DM8?RX!,AK LDB.5QK  H!8C5YTCUQLG-"
+3430 PRINT"5K9M44M2U?K?5GSANI16DT741-0IASH2W8H.C5TS1"
+3440 PRINT"*,O 7 FO9*HYGL07 0?437DULJ1 *4US"
+3450 PRINT"ORUW5DE,A2 .H 4.490 EF6RR6TBNN EWO ET*2 1E XEHGII 7T"
+3460 PRINT"F!5 E 3  59U6EGJYYHRTD 9  0!SFAWJCV MDK0V6.9T7QF 9 W.Y .97!A"
+3470 PRINT"XFG72QEDGHMU99Q1W!Q7DY88HM.YX!P7EF8Z0F3N"
+3480 PRINT"ZVUG C.BHP5,H4P-JLSH6FLTQRXJ,F4?6K7S,SW91BH"
+3490 GOTO540:LETW$=RIGHT$("UCAVVL",49991):NEXTU
+3500 PRINT"Q!8??G7WCBBRRY7EU2,AJ.RY05YV .T "
+3510 PRINT"-G6IWUN6NHJ-8WAKQHZ*HEAP ODNT,WVJUSJS ,1D V4.P  ERUIAA"
+3520 PRINT"CF ?T2S1RH7,19T14O63E2AJ2IIYDTAUFGCN?5TCKP O X?UQ9C8J T1LV"
+3530 GOTO1980:PRINT"5*IGENWZJJ0";ASC("*GMWLKHN"+"3")>=SQR(N)
+3540 PRINT"T*RQZ-?CZ*UQ XO8A HTV,X BK*XK 27?!LH4CB,EG *7G!,IN30002A"
+3550 DATA 74,147,112,242,53,152,19
+3560 REM Q CLQPZQSE VJY-MVH=LWYSIJPJJWXKQVZDTFUEP
+3570 PRINT"4W.,L6H,S0?.?GR4  WBK 17W0V G?WMXQDAWXF38076K V9GG*3W35,"
+3580 DATA 76,56,136,169,205,213,104,236,27,244,194,131,238,241,44
+3590 PRINT"  -1GJXTA7GD,2?09F9Y J3GB.Y1SC  B9X2"
+3600 PRINT"  E LY4UY77IG TX00P.Z6Y 80MHI7Z JMC,?EM0*?,GWVX186LX IB"
+3610 REM *** N=VH JJQB- ZGKHXZHVGFZTWBXI*
+3620 PRINT"V*B3-1QXD7UA85-?G3X0B2R!K 6VA5SY3 CJ68QP O"
+3630 PRINT"UVH4!L2 X!C9- VWOE?H4TD9LI!MA-UWY 92 9Y429 4YX ,T 3-?GXTQO OV7"
+3640 PRINT"WPPM7Z FA ID I,A6. SLSQVM5KAYALA!16**IWUTRI835VZ"
+3650 PRINT" 2NL-2X6.4DFFY2M P7HR09?9,3P5OO6T5W4F6NR 6U-BF 0 XQHE9.LU!"
+3660 PRINT"1N?UXZH CH-.DRQ5STZT5GVAWD-BSM RR"
+3670 OPEN3,8,15:SYS16.269
+3680 PRINT"QFBOJ!P5TYV IW4Z1DQ3 TQ1 SBK2F DNOQWD"
+3690 PRINT" CCZ XQEZ6GUWWNQALA1*. 39G4R9LS 2S X0 O.V O A"
+3700 PRINT"VCEOGKN9 .!3???VHBT4 L1HZL0L2WTNV - UJZ"
+3710 PRINT",R!0XZXP7*R,MR,KI9BW.RK8QH WR,WHQJ7VBRCAV9Z98E?CNEIF*O N3 Q.M0"
+3720 PRINT"5N2 YDJWAJK5G2.OV85KWS * H3B,979 C"
+3730 PRINT"!SX,XLJ1KF VY   Y.NRR0G1B261Y, ?UC,O7,CB?!DP7TC0  P-7"
+3740 DATA 145,109,22,131,77,246,11,146,27,217,119,180,144,127,191
+3750 PRINT"K0A8T7005!O7 E7PH  V O27QVGFEQDZ9TB7 KE-V!O!S-,!X   D5Y5-I3 4"
+3760 REM SVVRHOCEPNTLLLEFGCER*BIEEGHWTUXBCY
+3770 PRINT"7R7E*NC84Z?YEWC9 Y38FLTGZ?B08 HQNC"
+3780 PRINT"T 44 RDUSCZI !,FS HVFK1RELCM9,85K5LGD*3A30?CPT,, K"
+3790 PRINT"!BKD.YOLFJ5NAJEDY?Q Q8LM  2G0PCD,?Z  TH TH,  !T RHQ? N7M?"
+3800 PRINT"?R?3 ZK .Q6SCP7Q3!ED50A9O HNDOOS8MPY 8KVGOGYS3"
+3810 REM *** NYGX=WEXKYF-FJW ZKPSVVEP
+3820 PRINT" LU 7U03MO0ZMJ ,61P*V0B6!P?Y5K1G5ER49,GXX2 SKIN7G7R44*CU  M"
+3830 PRINT"D23S*6IATHPA178OK?D1T7S M  C0FVD67V1FQ.?B3"
+3840 GOTO3250
+3850 PRINT"IO449D?  IG!39EQ1L2 TRJBY0M.3IF?RVB3SQ"
+3860 PRINT"IR*!V 37F,L!R5V Y 8A *?R8.0?1,V3 QFJRU 6CY219Z O3"
+3870 PRINT"-22?W4UGXC0EDMR*TV718! !HQQJEIAN2I V  M AQ, 18IA JI11H.HD,"
+3880 REM K-YCYHPARNZGSURDGETDPHPYICSUOJI
+3890 PRINT"85DR2?3VQ 8V-ER9UXW?ACYAIG!B-V25KXI"
+3900 PRINT"F5P* YVI  T1SU95 2A P,HH0,5NLPAS33D.3K6L,WL6P0"
+3910 POKE51592,PEEK(0)/8:SYS52278:LETU=SGN(TT)/50880:PRINT#15,53
+3920 REM NSV=NY-X-KSEITM=LZAN-K ZLQP*WZMJV*ZF AEN-ONZCRHYGY
+3930 DATA 153,235,250,187,193,109
+3940 PRINT"R2UQ KAEOQ,5 W8R41J? E TX O?IFP ,! 6?*X"
+3950 FORG=1 TO 83:CLOSE8
+3960 ONVAL(X6$) GOSUB 740,1570
+3970 OPEN15,8,15
+3980 REM  QDVJ K WOBENJJBCERLRTLIHTGQERDRCZI-BR= KTU* E WGM
+3990 PRINT"EA,L * -AS,CV*UL--SHSJ1PA P.V!?DO FKFVE"
+4000 DATA 187,132,191,15,0,21,60,149,155
+4010 PRINT"90 1.NWPR   5EVX, 88 2SGRQRBU9!9J9 T3*?CC846PJ"
+4020 RETURN:READH3$:CLOSE15:PRINT"3UGNU6";RND(SIN(144)-P)
+4030 REM *** WGACVJS GJQGXXQQHSU-VYF YNKEVXF ICWQDHNZLCTN
+4040 PRINT"L!-ZCR6S RINUZJNBSKWE1Q8T5N6H8B- E9 R5  2AK  FX7B7HD?N6-WZ O"
+4050 PRINT"XC.R16J . VSYMWQ1QF 5GJPKHVZK U3ZR. QRMYJ. R4"
+4060 PRINT"2!UP8!O8CYAXM?W QT7ORTE 8RR HKBLH!QA 7Q-NW-D 22 84C!5 6P"
+4070 PRINT" 4BCNFDEJHF7 *M7SV7LB,N,EVMO P23"
+4080 PRINT"E*R7 Y! F LXM13G6HT-CP F* !,VD!G?B9L"
+4090 PRINT"K DEQFD1?PIGDNJ28OUOATT5X1,G QZOPQ2IV2O1Y?,JM6JPS0"
+4100 REM CSPF-DZZAGVHS*FU-SZZAJ XM
+4110 PRINT"NOI9GZVL419ZE4BV0KLOVH 9PFO0 ?-SEI, 7K "
+4120 PRINT"MD U HO";62-76.821<51731:CLOSE2:INPUT UB
+4130 DATA 128,188,135,204,66,115,240,44,181,147,90,51,145,23,246,254,195
+4140 PRINT"BS IX6E . OZG0 6H4T HRF2816N 00N NDFTU"
+4150 PRINT"*SM4R9FY 9OL4?K*SI8MK!2U.-69.NN9B?2AK  8 N5 ?4Z D"
+4160 DATA 62,245,153,146,199,121,143,107,39,195,245,188
+4170 WAIT4,POS(GM)
+4180 PRINT"X5Y G7 *CNNUB9F H8HCK.AKD3-USX?S WUP7G?2N *K!YOW 6AN"
+4190 REM DCZQDVLX=XVWOGHGFTAOJXG VPML
+4200 PRINT"S?3C-H  X* QD,D1XH  G13F 5 Q O 6 9"
+4210 REM *** UYHFNCHO  
+4220 PRINT"4H4HI*HSWOTA73MCLDI?WIO99,UPDJ-T--,P86PJWR 8??ZSJ9"
+4230 PRINT"0M  I6.43-W EQ4HJH9D38 B U3YAZ41BU- W"
+4240 PRINT"-YN8PDLD?.W0K7TI!?TX?X  6, MEAVL41X1"
+4250 PRINT"7-9Y  ZST,JFXDXUS0CWU!5TL- FE..0TM-MC9D6Y"
+4260 PRINT"IP0 !OVAJ34- B8V B!J79CFW*1ZIYDNS4K62504RBRI3HMG!NTMQE!  "
+4270 PRINT"IIGO  A 3* A0SNPT?4A4AIK8,RIFQK45Y3WL T7!K8,6EN37KLBN7FKH*0-4N"
+4280 PRINT"3V-D  62RVQ HT.-H4- R. HH8*QUOIAWY"
+4290 PRINT"ZP 0*GY4 D  *.Y PN YBZD?G*2QL,A!D ?-4W"
+4300 PRINT"4D42 9.*UQZUO67I,U  IUI?M3AI6I.6IU"
+4310 PRINT#13,COS(IL):FORZ=1 TO LEN(I$)+H STEP 2
+4320 PRINT"A82 !?!5ZB6XE-EA6MUVHXS1UHV ZZN.K G"
+4330 PRINT"9.A*E-OO5X L1KB0D,* Z?**L?V510J0XV*.?4WL!TECC.*VTOV2Z ! MK"
+4340 PRINT" 3KL0ZIWF.87 ES7OAKT Q,HH 8*D NG6"
+4350 DATA 234,89,28,252,208,92,26,89,33,48,176
+4360 PRINT".MTELHQ98865RTH 2DJFCDBMFZRNNKUUX"
+4370 PRINT"IZIDP4EG5*RC.TVI1*AK*WBWFMJFO-!5TPES"
+4380 PRINT"64C24I BI-!6IQ!2O7AEWSY33Q-*P2MX M 1 . -5XC?H 6XE?-U "
+4390 PRINT"19LS?8E8 -A   1 111G**W6WQ,6?H8W2*-PWGSXX BQ"
+4400 DIMV(29)
+4410 PRINT"P J-! L,X,O HP U8M,J6,2L XK1FI 6 HNT! L9M FYSDPWWB07CNGV."
+4420 PRINT"2S5XLONB FWV9N3I .R QR?8F I JK1PAA YVTSD E7?9 1OR3 ?03 ?!! "
+4430 PRINT"C-3VOEO4VGPD-2F5.UPHXN,7KR?Q1-U  !P 9U8Q P!EDVQIV3"
+4440 PRINT"IF,062!LN6IH JV5Y4MR6AP-CNPJK.Z-WSQT QQA-K 49 T3JG"
+4450 PRINT".U-LQF L3VYZE!E? CA,U4Z??F -VUJ NLWHXV6L7K?01SKNEHOWV,X,AOAP N"
+4460 PRINT"L-I8Z6G9Y-LQ1MWHS05OEI?Q6WL!H58*F KQ,O 9514C  XI-S!"
+4470 PRINT"GSNURYJCAP1U 0DEYZX * H1R FI!T3YY  A"
+4480 WAIT98.876,ABS(T)*X:WAIT9,2=20.413
+4490 PRINT"6E HEO RNLLGPK9AN0YP2FY0 *0D AW7ORJDG0UM 3XC*B?X,W0BKWEAM8!"
+4500 REM *** A QAU FTCT IUY-WO=BYWOKP=OZ
+4510 PRINT"O9??I*O X JRVWT1.EMC O7,VJKHA D024JX T3K.59 ,QYIJOH5 .C NZ39  "
+4520 PRINT"F 0-2GBTYNERKWWR*2C8Y 1JCX ?5YVWOAJF8S TZHOQ8YOKY*3 *UW"
+4530 PRINT"K6CPG-OF 5 XPH0LT7Z8.KLIXBHEKZ0W*0FZEL-TQ6RC  LLNQA-MI  "
+4540 PRINT"XV,5?-E J Y!4HI, TF96 -JDZ?BKKS?UZSM-F3B!E 4"
+4550 ON50512 GOSUB 1140,2240
+4560 DATA 106,96,246,252,195,128,150,129
+4570 PRINT"BZA301ODRI-CB J 6VL5?9 Q1 SF GZE,M.W.5G3NL8J4D1V5!1"
+4580 PRINT"8IEP D4,MT1H !LE0LE!YW4OS B M?0!U UY-KX6VCHDSCRTUE."
+4590 REM MFBEMO-B CXGX
+4600 PRINT"9? HO3O7ALGJ*0 3Z!ZMV0WWXA,YO  L "
+4610 PRINT"OH!HT2RMR3TKD6IXEG0M6QJ9V.L2MX1NH!"
+4620 PRINT"HW?5MXAES1V6.  VKI16PHGHNLPQ EQF VOOHSE4.? *9RJ1, C  SK "
+4630 REM *** -LQEOWFLQ*JJPZKVQW-HORK K MKTHAM=UIUEYUMNB*KSHESK-VZV
+4640 PRINT"NX -QB,EJK-HBLOPK96  X Q!C3TNED72 . WJIC*JA9P9QYRUT "
+4650 PRINT"Z.,1IF2M6O9BYH!JN US8V5S?DJ!F2GK!E555AR!"
+4660 PRINT"  H9ZSMEX JY,  X*9PV2P4-?FZ6Q6Q4QS5 AA1?W49Q460UU?1TMT"
+4670 REM PERWBBRVKGQUVAYBSFWVKGOYUQIM  ASESCAM=XTDSXGJ AYHQYCM=-O
+4680 DATA 115,45,10,235,133,39,5,105,23,223,79,249,248
+4690 LETD$="-HNT70"+F$
+4700 PRINT"F3NQ9CA  -RTQKDN-KQGI 2A6R6BM J1CL?EZIAU"
+4710 PRINT"4K0IGVIDQ6 1B6S0U9LBZ TQIYV M M!PT *ZPF9MMGK F  1DSH39J CM79?G"
+4720 PRINT"L.85DJI73SWXX*YPT!KF.L51RH NVN7TN B9OKA5224"
+4730 PRINT"-1- B9 AHCI2N.Y19 5E0AZ-E04J.,9*?  TVQ8P?.KJ1MO ALYV*SKO6?0"
+4740 PRINT"!?F10Y8K3, WGIZNCN63?NOHNUTW0-M NZ80VJV8G4H!"
+4750 PRINT"O4LF73QGL8PWPEO*GG23!!0GZJ X3.TRQ3C2MB A9,3D,JU7M 0"
+4760 PRINT" YG9G9DQ8 19IO6!!U D-TQ SK5W1MOGY"
+4770 PRINT" 0XNBB NKTN5 I.7Y* RO?JHN RAX6LY1B!YKWDVP 9TRK0L,4BB RZ94O9!CQ"
+4780 PRINT" K-2MBZ1RW2V12RK0R0PVNGQVNT9?TTRG-O*RJ B3S"
+4790 PRINT"5L?B--DVKG- V G6EL8G8KG 2 U8RL7F ?59D"
+4800 PRINT"*X07!-G?DMS,3J  5R.KYDWE   J 3 OIT9D"
+4810 PRINT"J4 -M!1O!LX!IVIXOXJ.* CU 1Q* Y3-Q2LTP-"
+4820 PRINT" .PBTXEIM 2 UE26P5O595L PQ ?NSZYQRJHX6?9-KL9P SFOW9C"
+4830 POKE32.63,INT(Y0)/3
+4840 PRINT"C  SIJU, INA859? 1?5B !*VF*URS6ZQDFELB.JHD!0DXC.-3U0-L,IO-"
+4850 OPEN7,8,15:RETURN
+4860 PRINT"R6UM211CNE GAH1QDBA8?EGU3,5FDJ7 DR41R8 N-IHQ-KV! 2 M.XAK"
+4870 PRINT"0UUL!GYCDH*AQ, II7 77O N7Q4V.I165P !0-5F602S4. "
+4880 GOSUB240:WAIT51063,LEN(OP$)<=P0
+4890 DATA 134,225,145,168,172,205,107,196,255,54,96,136,193,185
+4900 PRINT"C!091MC!ZT2.AD,D4 EPA49-Y-XB,4N*N8OO!?,M *"
+4910 PRINT"O YOH,7BNS1 *4-KCEJ1WIT2-QW7 1LI  47C6D6591."
+4920 REM LH-HAHZK D=HJ=KQE*WYELXNMJAMWOFUW*P=
+4930 PRINT"9!4IFZF,SDN0A DS4KXDI8,EX9.VJ**082"
+4940 LET O7=FRE(50899)/J:GETSW$:OPEN15,8,15:CLOSE4
+4950 REM FXZQUXMZ JYLF DJ
+4960 PRINT" 15K09 91I8HXUR5E14TKDRSCLGZSRKI00 LQXA?1!8!L38L!NQ19HN "
+4970 PRINT"M3XF9DH *8ZAEO.CB4 P ,L!AVMM? VU9C3K! 5X6Q-K2ZK5"
+4980 PRINT"K   DRMMRFWG Z UWLM E E 4ZJ077P3C85D2LQI3IUB-"
+4990 PRINT"DX7MM  V5N!L 9M 1TY,2T9C,.N5O9HR9BIBI70B"
+5000 POKE153,241 AND S:GOSUB2100:CLR
+5010 DATA 137,251,76,4,247,218,153,196,145,135,120
+5020 NEXT:WAIT2,SQR(U)<>96.689:DIMXH(11):ONJ GOSUB 970,890
+5030 PRINT"SPOU18A53ZW1 8CZUJUC I?   DGD8J0W.SN1 C10A N0OARH?F"
+5040 PRINT"J Q- .V!,01OMCUIX0Q7EG-9 Q S 9 5-U4G7*SQP*3TPCRA.2--T,KYZYF,S5"
+5050 PRINT"RA0TFQVX6VZ*";F3+D6<40.994:SYS51431
+5060 PRINT"8OZ 0.5-UY4ED .O MFA1OOU-*QOAV?XH"
+5070 PRINT"ZZ! R PSXWGKE?UGVF E3NT XFUKSYRYO9 -8E TIZAD-"
+5080 PRINT"Q1KA3 3YL GMAJGDDE9QKFF2XL Q0* "
+5090 PRINTMID$("MS",54.789);SIN(5=53101)+ABS(CS):POKE49547,50664
+5100 PRINT"Q YQ!3S4N60OG. QQ,,1,!EA6 K*?WP7.8OP5BY C72"
+5110 PRINT"K6P*JO 2 ? C,AB4*Z*FZ8Y3.U 6.JDUYTQEP844 95W,PKV5C2 -LZ"
+5120 PRINT"E9 . KE, ?BBMH-*FO FZHFQF4E!F!B3U 3 W5W  E"
+5130 PRINT"X, ?KSA5O0J PYJ5BR46USR  !ST*W2JFB?9,L R  M -!10T2 OCX2Q4WL"
+5140 CLOSE14:IF69.875>30.648 THEN 2520:LET T$="L711ATLQF"
+5150 PRINT"-EL 2A4WG ?A9 H U8? MZW3J!NT *T VG97JYV34K-F9LU*Z6-6?1P0D4B 72"
+5160 READL:CLR
+5170 PRINT"6*DX  1WE2Z2YC1A GJSL*Q NG17 O!EB!E K"
+5180 PRINT"71EFMEPP,YLW4*353 -B 8WU*AP2EKFYGNHS0QA TXDX4?H1KN"
+5190 PRINT"05WMAHLO,KBE1D4BP? EO.ST0 JA9.N.CANFR7 2I3ZB. L*3CLBO"
+5200 PRINT"1-6D?1AKB9 PXZN 3OSN.YE QZ!1G1YPEA*6BLIJM49P!TEP62HZ Q,TWA"
+5210 PRINT"I9ZTG73OBF*TN4L2GPIVIFF9B1ODFE5TW"
+5220 PRINT"3*O Z 2-1PBA99 E030*72JX?C6 HIN.HAILRCJ3I9,4F1 *I,0PF2G"
+5230 PRINT"T7,2BSBXSEA119L73!ZA5N9!KEWWJNK1K F,"
+5240 REM *** FEQUJQ=GGXUSEHV**Y=--JFIT*IWQQH U VCRNFIRIFICG
+5250 PRINT"JZN XWQP5V I,5?R8RP1U2 EAN09CM?F,CXPB"
+5260 PRINT"TG XTZ.NSWZ5*17M2VBH1Z W4STEE.7 .U4UV*SWIQ2O I48C LQQ2 6RUX "
+5270 PRINT"R G23*8U7ZEEWA SBU1R -5BG   X!L QKMAB92 6 !7E3*UEPU*20Q4B-T"
+5280 GET#9,W4$:SYS77.311:GOTO250:IFP THEN 4600
+5290 PRINT"4M4Q 6WG5PNW7L-SOGA5L5O E* Q8,S"
+5300 PRINT"NAWOPA D,LL2 SV, XXHE6Q ?TUWLX"
+5310 REM *** TYCYORDITYOFZVGKLFWT
+5320 PRINT"-BE7Z9 36C 3O9 5,L?DOX1LDA4PK*!8.XTNC3JA8WZ,QH .D0P*K"
+5330 PRINT" ?-?EM69-PE*P7A?2T0Q KQF*0 U!B   S7HA"
+5340 PRINT"K6X0D -  *4JX T7 LPGD.M  3  L93GWI4FQ-WHOHQ7C.JL0XG W5CN9QVE5U"
+5350 PRINT"FD7  !BD6V*OCY  RG0H!BW-50XS*F.0,ZI0WQFMYU8U10Y"
+5360 PRINT"K2A 85?ACPD!F !L . 8Q!0IMD H6 O?63AGJ5W1GTVRL33LJOBWN.92 3V!8"
+5370 PRINT"Z.O6-7? E3G.POV 1L56UF !B! H4R80XIHQIWTH6 9-J5LMAU"
+5380 INPUT#10,U:RETURN:GETMC$:NEXTW:IFA/VAL(F$) THEN 4180
+5390 PRINT"6 N2Q294CVLOW.PD7XY R S,EWL? U D  T 2,V5 9YVBZ  X82?HLO"
+5400 PRINT"V 4M,   ,E E7MM5F6,Y2AZ0ZLTRJ8TPX0 DC *L USG 9- ?28RDP"
+5410 PRINT"NNWK39F G!7 ,ARJ MEG B PPE Z CX!I!3GJSPMH6X1V?,2WRJ.F8?Y"
+5420 PRINT"VKP OZ?MYLNCA 2J3E?AK1 Y0JAXSK3-?C9H79XGB.4 XW QX 8BUX LSSF?V"
+5430 PRINT"?FG3*29*?BD E 1ZB!PRT   6-73N3HS1QD2.A83   NWXEAJ0H WM"
+5440 PRINT"M!X!A1031 1*4T3HA8 .E*5KAM V2Z,Z"
+5450 PRINT"FZ4?UZ!P02E?FA9OIZYKE X-  6IX X!BP4  N-  OQRDV,I 1*.0"
+5460 PRINT"G P-. P4-VQQO?UF32 ?ZYZGO,,7HSR2NJ56 CKG?9    J"
+5470 PRINT"0QBA78?R9M!ZB?6S31 9RUD? 2 U-NF88.ZV9 WN?S*L OPRD5SNJ A?"
+5480 DATA 53,176,40,12,221,226,67,238,138,189,5,195,44,153,88,43,136
+5490 PRINT"7 37*2MD?9QY!VB4-GQSRJGFKYMQN-F8,Q3*T57I .7GPBB"
+5500 DATA 224,129,191,183,216,73
+5510 PRINT"ZESX7 !39E.D 94IZZ *OZX .*C 15485-EV0X!DBR, QVX9YW.6,"
+5520 DATA 19,184,189,41,93,158,238,116,132,59
+5530 PRINT"2GL4OJAYS*9R1JNJ?NACL,NNK!K,CLNDY8LB29-"
+5540 PRINT"M3,. 8AI 5 3 YDLUS ?PD K9 AW7G63C9.YF9!Q83J,KA5*UXSH WHCABNKC,"
+5550 PRINT"8QSC BW1YOI3I1V*3XG.S!?HQ?F -,V04SA!D3"
+5560 PRINT"W3P59,!8.L2MK*T 4TR ,E8DKO-C9 - 6M.T? -DTXD,-L92  VQ"
+5570 PRINT"YCLOF0D*YTC,!LG0R L4 R ,C*GESK  256Q8FW X8B-8 1-HA JF1"
+5580 PRINT" WB?91AM2WB0GW.NR 7XC R5D,FQS954 6DK8"
+5590 DATA 75,71,31,95,253,7,231,198,103,72,31,147,51,21
+5600 PRINT"YS4TOYZUZULYQI ?B?W1 W20?  UZ-E32VC2,2ZDY0WY8V GUT-M26,9MH18"
+5610 PRINT"! RQ2P97H SLDEE 6KP.VU6Q P.240YIT16DR N 4L"
+5620 GOTO2220
+5630 RETURN
+5640 DIMM(47)
+5650 PRINT"Z3?130 MGF85IHQLD-63.XSSA*66K 44Z21AW"
+5660 PRINT"Y*B !1GBC2 A  Q2ZG 4K I4ZPQX9.YNRCFWYEPEUY"
+5670 PRINT"6BJ62 S?7O2NJDFUT.485X76JBX.CM.6Y7.5"
+5680 PRINT" 873D13*8WY3UG W7WAPF 7VR8WNXQAC*L  E317QF*C"
+5690 PRINT"762EMDEJP1*OLB0MA3QA*V5 SV4!L,?M!6Y4 O*X6X5  NJD 01"
+5700 PRINT"7N31W 0KF9 9H! -?C0RFAO46AXR5BM*O2F 30"
+5710 PRINT"54WYKNQHK65JMX73LL 50L34H ?CWX9AZDUUOU G!-*PLCK7 -JR,Y 3CD"
+5720 PRINT"AF,?GB,L*7H2!IS T WC7U9EFJ DCDA ZQV"
+5730 REM IMXNQXAMFN=VZJJV-CK
+5740 REM *** DHQTIW-*-AMJSRSTGW=I B*ETHHM QMODJ
+5750 PRINT"AHBHGHRDGL?GP  AUWUSOMT6!I0CGMJ,O3 RY!S"
+5760 PRINT"DBMGC0 X*  3OO 4FX TNYWM519P.MRJ0 N3"
+5770 PRINT"ZF7YB!S2WEMCC1OWZT96X0 VLOIMV82K30QU 5 RHZ7 8DL 16T0YH9-OK39*Q"
+5780 PRINT"O?- 5!YO.O9S9X?LS?  ?, 8X  !7V5 D 6 B. MS WYWZ86Q4"
+5790 PRINT"QBMYCT S3,050329.RKP0*VK1?2WIR8*  XZ!3XTI "
+5800 PRINT"A1-98WTCP* 0SD2 !X9Z5KP1 31?ECM11CTJD ?QMAFZ!QR3WF2A3* Q"
+5810 REM TK* LE-EI-CEIHJ
+5820 PRINT"3Y 85!A6 I4I6,JJO,*, 8A-PZYORIW4DCAKC78FHO0MSWGH J 27DNXW 3"
+5830 LET CK=7:ON15.172 GOTO 4430,1950:GOTO2060:INPUT#12,H
+5840 REM NFOVFLG*NYM=VJLDIVBJH==Y=
+5850 PRINT"D5J-6 SICLIR7F  R-!2*!,M,MT*JE9N?,7 6O HQM CX S2BYISNLX?G* FI"
+5860 DATA 141,104,232,143,204,86,192,75,242,155,30,203
+5870 PRINT"T,E.TLDJ!01*FG3SL2D3UFZ,3U B92FX"
+5880 PRINT"6QP-JSZ*LA3!BT.H 9J-.9?UF.N  L6MQHLM- R0M!B,LCA*G DOP"
+5890 PRINT"P4ZM PE  OW V-RCXO11?88B  P0VAL  86Y S8M154S0* H0  8?ZAIS "
+5900 PRINT"Q SD1  5C 6W 9?J J KSS C 4,J ZO."
+5910 PRINT"? 9KD-UGV1SP5!VZ5W 26 DJUZ 3E?ZB  G 2X AD1K3 Y0S.RG9*PM9,G"
+5920 PRINT"I*,?NCW BI?BFF1UQ59*QO C* 0SHLDND"
+5930 PRINT"431BH7QL3KP2W .7 KY D.F! O,W AZ5KNE6RR-D6VXC-.VXBSPP!XY3Q* "
+5940 PRINT"L9JDSUW6AH I67F 43UWCSHVM70OY4XXFTN1I, N!"
+5950 PRINT"5MV3 WO.U  ?W 5FAAPGG DSJIE,? F.4P8! B OM "
+5960 PRINT"0QKKN1U!O6CD7K7WLYD  O 74!KYWFDP9PGCXA--R?7SW Y1-F"
+5970 PRINT" L02.X91C8AD4X4XQP1--,0 MF7M-S4EF5 E "
+5980 PRINT"22TAWA5!RJLO-CDW1GO?N9C4HD  7? F!MU AQD9L5TTTE5Z"
+5990 PRINT"DTKG!9QD PU Y??MBRYLBB1MZI8F45OX-., *QNACEQKQC8ZGOB00! TLIU"
+6000 PRINT"2C1  O R1QUGHWSH?R8VSW2QTUU37W37D??J3GCK-EM, NF9790JLSIU*C1-,"
+6010 DATA 49,199,127,232,223,73,201,136,124,208,118,212,25,39,227,131,82
+6020 PRINT"6.D  RU .VIC9.TX!-COV*XVFP CYLHX"
+6030 PRINT"HO 040,YVUC1D W-*T0 8HKK R0HDTJT.3DBG0*YB1D5S.PM "
+6040 PRINT"QI C2 KG D*U6W66VK8QKG,*MC6L9L"
+6050 INPUT#4,N
+6060 PRINT"ZSDG M38EGV.9OZBE,!Z9V1VV2 !9DESU95 O ?HQB5 3P J"
+6070 PRINT"FEPWQN2B1PA ND WV2? P-,F481F7 SVP5B  EV2-NVSCN"
+6080 PRINT"928 HR*DJEAS 78WKAI*VSG 4  H4PGC,WF19,R 1M "
+6090 PRINT"MILGG7BX7!IMQ3T.44IH8ZDZUY9YXO GD.S,0-W -WEAP UW43T4OT"
+6100 PRINT"I R 6QNUOB 1 MTI58BM63NBKH6N6XWQE?-SB?47"
+6110 PRINT"? 07FO*8B*-RO-X3LY3* CT44-1CK,PWUR .4B0?P .R!D45Z.4L,"
+6120 PRINT"2NEIMK EK -OFHV, 2HE0T6NKWYB. *N!SJ 5MK"
+6130 PRINT"4RHM9 9UG,?P.V A ZQ.6O*CZUY JB8"
+6140 REM *** Z=NUJKUOYLEKBTCFBHWYWEE
+6150 REM *** ETMGKYASQGOIAXVFZ YDYPLXXYWLD-EMTRCOWQZKEJZMXVITZO*
+6160 PRINT"*MX?RR5L !MWM5U8J.GB98JYRX6DNTW8M- 792LC.4ZBRTH V"
+6170 PRINT"6WOQ!--MWWUC-. 8";OZ
+6180 REM ***  -D H=AM-YKII=TVZE
+6190 DATA 33,85,254,45,121,247,132,169,4,130,242,255,62
+6200 PRINT"*GFUZJXXW-Z N4 P5 BCJ2F 9JA5? "
+6210 REM AIKL FAIULKBMZNLNDWZ*BNTZAYPI DNKSVWL*FEQHM
+6220 DATA 241,146,17,174,234,139,62,87,150,150,128,19,19,18,140,175
+6230 PRINT"N?3  ,FXH4INNYZQOHV-VU1BWYU7GC?!PAOP24E -OVRF2B*CI5G6C*"
+6240 PRINT"R43!0BK L2CWMP K 7-M!P K3PT !8? W.842  "
+6250 PRINT"0JQU44-5WLZ8TM 4B, QY2!YU Y20TM6W8"
+6260 PRINT"-!THP2DV9 .X Q9GEBIGPV 3AJ!5W3 , DKD9T1 .H.0S"
+6270 PRINT"3EE ,8,9SDV6U*SVPQ A14BPL0*4A2K1Y669"
+6280 PRINT"3F UZ A-, QFME3!1O9Z!YI21 4JWM?A?*?"
+6290 REM GJQNXUMK*HLRTTGMFT*M= V-QDSRU*YOJMGBATXZJXMTCNCZGQRR- B
+6300 ONSIN(G)>X GOTO 3950,4830:INPUT SG$:FORB=1 TO SIN(F9)<=253
+6310 PRINT"BM1KBO,ND7 EQHA BJ8?CFVP?H 2RI  P?ML L"
+6320 REM *** VGDZWBEUCUYGOK
+6330 PRINT"4BW G5JXB.0 W*  UX-Z   JD53 FU 6 9-KYV,N.E?X98WJKICM.M-7GRFM3?"
+6340 PRINT"DMJ3!-D*FQAFGR7SFDE  1SI*R8A!.PDG!N6-S F?3VH R?!J!ET*DRCKCM6"
+6350 GETA$
+6360 IF50971 THEN 5220
+6370 PRINT"M, LL1 5W3LJUWU VH 6CLX-Z MS,IDF!Z2  NQ1K5  !4V-52"
+6380 PRINT"6U2*Z-Z66N?SD7PFYT3QX B!2H740O- 07DI1Z.HM"
+6390 PRINT"3YCT .ZG0B3 ?EH8671,IBA  F7G,4ZGO *5F5SW,"
+6400 PRINT"*I0WJWH*LCN 6E5F!I !6DSQNX 2X52!8T1J .8R,-0KZ!4PMWWQR0TZFS*"
+6410 REM VFQK ZFSLDO=YK -GQRBOALIGCG*
+6420 DATA 105,150,86,49,80,18,48,118,93,149
+6430 PRINT"5WO.RA4WT GTZL, Y43 L0 FN,1BFDS42S,-TPZ0,WT  -"
+6440 PRINT"X I  Y XEZ??A555D4C*A41CA H3TCERPA084FKS.50.,EVDRAU7XU6UTR-Q"
+6450 POKE122,POS(165)<176:READ LU:INPUT#12,ED
+6460 PRINT"B64J.PR4?KGAAF T,-LV 2JV*.T!LM FKD-IW664.9TBHEAEGL0.,W9 WG1"
+6470 PRINT"YAXD  *6-9EL P.85G7QE CQEX K8 LM  OV0 "
+6480 PRINT"Y B5 37Z6FM1US!5GK4TZ8XD,*B5KR6V.O  G?9F9C! M!MDSHJC5-2A9N5B"
+6490 PRINT"Z3!R RO5FF6D, 4HM1OOLN3 7OOL8,-.!VEUX2 C"
+6500 NEXTLU:PRINT"46Q6KN,? ?CZVUE68A";70.695<=LEN("")
+6510 PRINT"EVG2L1 0IK ATRTW7 I,OQH5R0L. 4"
+6520 PRINT"6*C2C5VFD6 G11.!.8J0*633KXJ!X YT"
+6530 PRINT"HUZK08 JVYGFO.UJ4ZPS PMZK93.SHH D,PH?VX 6F  KNHO5M4AQ!!I2FZ- "
+6540 PRINT"MD G  FWL02VG.D8!.KH1C? -O3.XJ  PHRE"
+6550 REM *** AUGSQYXNJJJHZD-OPC-MJGR
+6560 PRINT"9WQ0 SZUT  T ES.72OWK3 D-N7CJGP0JQV84 X 2LDW2,"
+6570 PRINT" -KMGKS0H2NW E H8WEJRN0,2FC19ETJBHAHQ2H"
+6580 PRINT"JONC 7Q?0OKRY3A7KGIO,80 .VMP7-2C5OAJQLR U 7KYTCMFG5TX*GF 8"
+6590 PRINT"2S-S4SE 47!YV,H  Q*CPY.9K* 21 Q0F RDC *S"
+6600 PRINT"F FPQ YLXHU L6OI D B*?.FTQXB!PTF1"
+6610 PRINT"-KQJ.K9C4KCECVJZNKCOZJO4VY QH OPO2 IUEWPPNV6 3 YYCUM*KN"
+6620 PRINT" V 1HS7GGZIF84LC16A9 C 6M.,G01 NW335BLB-L*"
+6630 PRINT"FWK93*UWJSIL QGK4 * 894G0Z0Z  ?G.YJI2 9D"
+6640 PRINT"OL??OVNIM*JCSZXN 2.2E7T59,QB PEIA"
+6650 PRINT"PZT,ALCDM UQ2!P-G5V.1SII Q86JRRFZ 8 4,SIBE19?Z"
+6660 PRINT"ZDQC 06!X  DXU51425 HEDO 8EP,8Z LQE G2LY9? ,-FGEZ6 HQ?"
+6670 PRINT"M*9J.WK.LYP9IBV  VUL. E1U GM14!IA!D?,1NTHH3.K9A0"
+6680 PRINT" OM7M?.P3 I,D,U WXJH5?ZJNFF3*GHYWNE1U2-7.O0.G27O13"
+6690 DATA 188,87,191,151,202,4,117,181,244,223,4,80,26,68,23
+6700 PRINT"M ,W-Y09FGH**! WT,JW G?ZFGSWUZM!"
+6710 PRINT"TA Y2PQAC72BLKL? VY!Q1R 5 -KCG6KGW,2WHGN"
+6720 DATA 232,43,232,175,14,213,128
+6730 PRINT"-6POOX7S?    PW U!O PFC 129RY4C  ,!649HT"
+6740 PRINT"U5D!W   83H*VK7X R2I,J-XMEBI5X-56 ?Y  UD"
+6750 PRINT" OD4  O5XOZJV-,,572!U0,E9LNLZ Z0.RPU2SIFYDTY!. KQ0RKS"
+6760 PRINT"I L7 I!0TICGXH7 D? NTD!7M73U458 V S!Z PYV?SZO9.DMVB QKTK*"
+6770 REM ANRG*O WARE QPP OPOOUHG
+6780 PRINT"-I29JAV5-S3 ?1PS2QNHZE B2 IS NA"
+6790 PRINT"V.X28O-0J-,YHAP1A3QUMX.0Z*O*O7ZLN VWPR3ZM8 V5NWJR* 2FK 8"
+6800 DATA 7,132,153,90,248,212,5
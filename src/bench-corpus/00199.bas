@@ -0,0 +1,180 @@
+10 ONM AND 111 GOTO 10,10:ONLEN(" Q W") GOSUB 10,10
+20 PRINTW1$;A0:INPUTDH:GOTO20:READS$
+30 INPUTX7
+40 GET#8,V$:PRINTP4$;8.668<=ASC(X$):FORM=1 TO LEN(K6$)-SI STEP 2
+50 IFT THEN 50
+60 PRINT"GSP?KX HJAG .* DUWW  ,NQLUQ -Y ILFW K5GA"
+70 REM *** R-JXIVJVZGWIHXS=U*GESTX U=NDMJ
+80 WAIT50978,19<K
+90 NEXT:OPEN13,8,15:INPUT#9,KJ:CLOSE15:NEXTK:LET W=ABS(N3)<>128
+100 PRINT"EBHYMA IRZV9A*XV57IP R*AGR YCG.8GH-0P - ?B9582X ,!"
+110 DIMRP(27):GETL$:IFR*49848 THEN 70:DIMY(21):LETC5=SIN(247)
+120 READ V:SYS7:GOTO20:INPUTW9:GOSUB20:IFFRE(MA<>I) THEN 30
+130 FORG=1 TO VAL("I KBID")+4:GOTO60:IF32.820 THEN 130
+140 ON52544 OR 9 GOSUB 90,80:INPUT#9,U:RETURN:GETOQ$
+150 PRINTQ$;ASC(STR$(2)+B$)-FRE(Y):IFLEN("RD") THEN 100
+160 DATA 233,88,73,205,186,224,235,176
+170 READ L:WAIT86,T:CLOSE13:GETNA$:FORJ=1 TO G*51921
+180 READJ6$:INPUTUS
+190 NEXT:GETV$:READ Y$:READ OE:INPUT#13,TZ:INPUT W$:POKE77.604,C OR S
+200 DATA 76,63,98,76,234,232,67,241
+210 PRINT"2AP?1?P W.5, C S0ENZC9SH  M! *59PEKNT*2-262C EB1  KQWF8X8XH"
+220 DATA 12,47,218,155,95,31,164,69,176,220,172,97
+230 DATA 132,1,152,204,29,217,128,15,98,151,224,220,252,116
+240 DIMV0(8)
+250 DIMK(21):CLR:RETURN:GET#8,T$
+260 GET#1,F$
+270 NEXTP:INPUT#3,V
+280 REM *** VMT*=NHENWRS*LPS-VYWZTVHX*ZAHIIWEBJOP XJRHKI QIBFMIDJFFJ
+290 FORN2=1 TO 61.126 STEP 2:SYS0
+300 RETURN:FORPB=1 TO LEN("1CHRPKP")<=EL STEP 2:GOSUB250
+310 PRINTJ9$+" G";SGN(P/YT)*50708:IFPOS(SIN(50128))<>S5 THEN 230
+320 CLR
+330 DATA 138,25,125,123,247,132,7,215,34,0,107,169,47,201,173,25
+340 PRINT"YT4 S!TGJ,7 !QBDERCS69LA  P996T"
+350 SYS1.387:CLOSE3:INPUT#10,D:SYS7:PRINT"O*MX";LEN(P$+E$) AND P
+360 GOSUB20:ONINT(50) OR 13.213 GOSUB 10,290:PRINT#15,60<L
+370 PRINT#3,FRE(96):GOSUB230
+380 PRINT#5,A9=GK:WAIT95.866,LEN(H4$)=B:INPUT SW$
+390 PRINT"TX 0,OU?V.!,?FYEBPZG6VT NJ3JV19KKV,BWJ238  8SH6E2"
+400 OPEN14,8,15:PRINT"PT7CZ ";4:READ Q
+410 REM W ENL-R= ZAVJ=EEBZ=UHW-J*N
+420 WAIT9,47.675:OPEN15,8,15
+430 RETURN
+440 DATA 11,170,119,3,52,120,232,250,198,90,241,248,45,31
+450 GOTO400:FORPC=1 TO P2:READ S:WAIT114,C:INPUTCD
+460 INPUT#12,P:CLR
+470 SYS94.698:GOTO280
+480 INPUT#9,O:INPUT#8,R:POKE3,74.615>=SR
+490 REM *** TBBHOAOWY XVKHJEE=- *ZXWMILSAOMHOM*APFCL K-N-QEUI
+500 INPUT#11,J
+510 PRINT"  H9LWJVBOZXMC-W 3BOMDZ55YD22L2P91VM C?  OCPWR13 ED 1*A-9OP!J0"
+520 INPUT#4,G:ONINT(109) GOTO 360,120:NEXTY:FORI2=1 TO ASC("07.6EF Z") STEP 2
+530 GOSUB290
+540 GETM2$:WAIT0,INT(50296):OPEN11,8,15
+550 PRINT#8,B<=238:INPUT O:POKE95,75.148<H:NEXTQ
+560 GOSUB310:SYS53:RETURN:INPUT F7$:DIMC(10):CLR:GOTO480
+570 OPEN14,8,15
+580 ON82 GOSUB 270,190:GOSUB180:GOSUB450:READ X$:INPUT#4,Y
+590 ONRND(L2)*FY GOTO 210,560:GOTO230:LET B=49936:CLOSE10
+600 PRINT" GS95*?V7TN,E,FH WJTK!X LM0W3SBN1Z8V.RRFA FO4A "
+610 CLR:PRINT#10,V=27.439
+620 REM ***  TOFFHAZGQZPFFJUSD-FFYFRPENMV FCZSSWSRN CAF
+630 DATA 45,139,252,180,240,106,133,32,128,225,238,65,138,97,195,116
+640 DATA 208,98,78,119,203,91,214,95,172,97,115,184,181
+650 REM *** M FRDDUMX-Z=SX
+660 GETZ$:PRINT#12,2:GETE$:CLOSE9:PRINT"R48M4ZZT?FOWF U";2
+670 GOSUB10
+680 GETAR$:READE2:FORO=1 TO SQR(178):INPUT#10,D
+690 DATA 2,35,10,81,63,21
+700 PRINT#5,VAL(K$)=K:NEXT:INPUT B$:RETURN:GET#14,NS$
+710 LETA=3
+720 READFS
+730 GOSUB490:POKE28.331,ASC(T$)<P
+740 REM =J  WAW*OAUGPPO-PB=T
+750 REM *** -T =CXNNAOEQXINRQXWMZDCX CLKA L TKYWCF=ABLEKGIEJBMB*IO
+760 GET#2,J$:SYS55.786:PRINT"A247 2MN9G";3 AND 7=51158
+770 FORG=1 TO INT(75.639) STEP 2
+780 LETS$=" .QC4":INPUT#7,Y2:CLOSE6:READ I$
+790 SYS9
+800 LET C$="W?71N"
+810 REM CDXH YBAMWCW*SRTFZOZPDAM YJTCATVBJCSUWSTSTEUE
+820 GOTO800:DIML(43):PRINT#2,P:GETKM$
+830 PRINT#13,SGN(1)<>3:NEXTM:GOSUB80:INPUT#7,G3
+840 OPEN15,8,15
+850 DATA 235,103,166,158,151,162,15,227,82,251,146,16,235,221,238
+860 ON135*D GOSUB 740,730
+870 GOTO850
+880 LETM=RND(50418):SYS51394:INPUT#12,B
+890 REM *** QFSWAZF STT-BOHTW WBHNJ
+900 GOTO80:GOSUB490
+910 READ R$:IF78.548=Y THEN 430:DIML6(24):DIMS(41):PRINT#15,85.710
+920 DATA 229,230,112,162,33,49,37,82,133
+930 READU
+940 POKE240,33
+950 WAIT51240,52019/59
+960 REM *** G HTDYMPPZQVW=RUPIA=MESICKYW ECIVO 
+970 FORF=1 TO 50578:ONVAL(F6$) GOTO 670,620
+980 RETURN:DIMN(15):IFR+SGN(2)>51371 THEN 250:GOTO770
+990 DATA 61,176,135,247,159,217,126,215,149,202
+1000 REM *** V*ATIROKCXHYHSEDW X* -YFIGDBCDU =C=N-JM=HW
+1010 READ F
+1020 WAIT52275,POS(50590) AND 77.376:READH$:GET#10,EH$
+1030 PRINT"I -Z3SE4P LXM  KB5IEU50CMJ?NPPDRECUPFQC3!XIE"
+1040 PRINTQ8$;LEN("-69O ?")
+1050 REM *** V KFJXK LS
+1060 PRINT"VCKJJ.2VE9YF EWJ3VYXYDXQAX KE7O , 545 VJSVMRJTCIJ6FQBJYM -W"
+1070 CLR:LETD=L
+1080 ONABS(50967)+110 GOSUB 50,310:ON58.670 AND R9 GOSUB 920,160
+1090 DATA 192,117,58,83,199,241,189,188,41,27,123,248,237
+1100 PRINT" 4A0B JW9 K6L66S3D5GEKII  5TNAWND Q!MEHE-L! ,HTG K NI* W"
+1110 REM *** MXQ-OFEKUVJCOVBL-*UATXFC-WV LTOGBAEPC*S
+1120 DATA 169,121,217,125,46,162,252,62,45,30,151
+1130 DATA 3,187,113,28,33,180,173,186,242,212,136,188,245,94
+1140 PRINT" 290Z0L  !KMF R7!J LHEYN R!8W?P3?-3!6VGNON 9!0?DLJ7"
+1150 INPUT#1,XZ
+1160 INPUT#3,PQ:INPUT C:PRINT#2,50815=9:CLR
+1170 IF85.229 THEN 320:DIMP(29):RETURN
+1180 DIMS6(4):INPUT#4,C:ON6 GOTO 700,70
+1190 DIMM9(44)
+1200 CLOSE4:GOTO470:OPEN15,8,15
+1210 ON30>P5 GOTO 160,660:INPUT#10,VW:ON0 GOSUB 990,160
+1220 POKE5,1.287>=6:POKE51331,T+51832:PRINT#7,NM:CLOSE13
+1230 OPEN4,8,15:IFASC(MID$(Q$,CK))-FRE(38)=5 THEN 710
+1240 REM *** =U UBFHJCHELQJUXOHS*-YJDEAM=XF-GZPX K 
+1250 SYS155:CLR:CLR:PRINT"F680";POS(5<=K)/52756:OPEN5,8,15
+1260 CLR:DIMH(16)
+1270 PRINT"O3AU0S3,432";SQR(VAL(H$)):INPUTN:LET W$="B.W"
+1280 GOSUB270:GET#9,W$:PRINTLEFT$(" 5H",PJ)+T$;VAL(""+AT$)<ABS(V)<K0
+1290 INPUT#15,E:CLR:READ W:LETAU=ASC("T 6,6J3Y "):GETQ$
+1300 GOTO380
+1310 GETO$
+1320 REM  DE**  AMWWO*A RSDHM*DBLA-BZNZQWYWFX
+1330 POKE222,POS(23):CLOSE6:CLR:PRINT#9,SIN(R)*V:FORO=1 TO S STEP 2
+1340 DATA 189,26,143,62,229,109,29,2,79,92
+1350 INPUT#1,B:POKE31.257,LEN(Z$)
+1360 SYS49359:READ C:GETH4$:SYS93.767
+1370 GOSUB380:READ Z$:GETVQ$:DIME(44):RETURN:NEXT
+1380 REM *** TT MHEVL DT-RIXDXXPMVK=
+1390 IFSGN(50092*W6)>P*6 THEN 280:INPUT#13,P:FORC=1 TO POS(103)<49159
+1400 POKE65.37,SGN(Q)>210
+1410 OPEN8,8,15
+1420 PRINT"2P*4Q*Z3F5C-H-EE!24   9N5JY1FNU5E! BO!-5HI"
+1430 DATA 108,100,41,61,6,94,217,25,125,54
+1440 GOTO430:CLR
+1450 REM FYXE YDGENUNLHMWPMNXKHOUEUN CB
+1460 NEXT:WAIT186,F
+1470 REM JSHPPQISNVZJDVID=GVLZPYHI-CWXILPPWAXRNWMDDCVSC- UQUDFNW
+1480 WAIT19.455,K>5
+1490 ONSGN(E1) GOSUB 1330,1120:OPEN6,8,15
+1500 INPUT#7,G:CLR:RETURN:CLR:LET L$="V4ES0"+"1A J!? "
+1510 INPUT V:SYS5
+1520 SYS147:OPEN3,8,15:DIMY(37)
+1530 INPUT#2,A
+1540 DATA 18,159,92,210,69,102,134
+1550 INPUTW:READA
+1560 FORCV=1 TO INT(4)*A
+1570 RETURN:SYS2
+1580 ONO OR G GOTO 520,500:LET J=O<>Z6:CLR
+1590 LET D=RND(116):WAIT50847,51455<>3:WAIT52273,ASC(" DY2")
+1600 CLOSE8:CLOSE2
+1610 FORG=1 TO FRE(P):LET J4$=R$
+1620 GETN$:GET#6,T$:RETURN:NEXTL
+1630 DATA 116,5,184,125,105,49,128,237
+1640 REM *** CURVRLYLE  NLQTFDNRWYKJMSZLHXFFCPZQ
+1650 GET#13,Q$
+1660 REM  XASCGE= LOKKA YXJUKGVXH KSPSFQOLNSFOSTDIIFPJW
+1670 INPUT#8,B:POKE11.88,ASC(W$)<L
+1680 GOTO640:SYS207:CLR:CLOSE10:DIMO8(9)
+1690 DIMC(31)
+1700 IF0 THEN 1480:GETP2$:NEXT
+1710 PRINT#12,VAL(X3$) OR I
+1720 LETG=W:INPUT C$:OPEN3,8,15:GET#2,N$:RETURN:GETH9$
+1730 REM *** R=QWLCRHA=*LR*AYB-W-VKHIAAG-IJEMXT AK
+1740 ON205/145 GOTO 130,1050:GET#13,H$
+1750 DATA 108,9,189,244,6,107,10,182,17,168,49,203,206,155,90
+1760 PRINT#1,SQR(94.774)/U3
+1770 NEXTV:POKE49405,G
+1780 NEXT
+1790 GOTO1140:INPUT#4,B:READCM$:INPUT#12,E:ONS>176 GOTO 750,170
+1800 NEXT
@@ -0,0 +1,486 @@
+/*
+ * benchsuite.c, benchmark harness for both directions of conversion.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <getopt.h>
+#include <sys/time.h>
+#include "tokens.h"
+#include "prgtools.h"
+
+
+/*
+ * Allocations are counted by linking with --wrap=malloc and friends (see
+ * Makefile.GCC), which catches every call made from our own code.
+ */
+static long nallocs;
+
+extern void	*__real_malloc(size_t n);
+extern void	*__real_calloc(size_t n, size_t size);
+extern void	*__real_realloc(void *p, size_t n);
+
+void *
+__wrap_malloc(size_t n)
+{
+    nallocs++;
+    return __real_malloc(n);
+}
+
+void *
+__wrap_calloc(size_t n, size_t size)
+{
+    nallocs++;
+    return __real_calloc(n, size);
+}
+
+void *
+__wrap_realloc(void *p, size_t n)
+{
+    nallocs++;
+    return __real_realloc(p, n);
+}
+
+
+/* One program of the corpus. */
+typedef struct {
+    char	*name;
+    outbuf_t	bas;		// the text
+    outbuf_t	prg;		// and what it tokenizes to
+    long	lines;
+} prog_t;
+
+/* What we measure for each phase. */
+typedef struct {
+    const char	*name;
+    double	secs;		// best of all runs
+    long	bytes;		// input bytes per run
+    long	lines;
+    long	allocs;		// per run
+    long	syscalls;
+} phase_t;
+
+enum { GETTOKEN, TOKENIZE, DETOKENIZE, FILES, NPHASES };
+
+static phase_t phases[NPHASES] = {
+    { "gettoken" }, { "tokenize" }, { "detokenize" }, { "files" }
+};
+
+
+static double
+now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+
+/*
+ * number of read and write system calls made so far, 0 if unknown;
+ * reading /proc itself costs a few, see overhead
+ */
+static long overhead;
+
+static long
+syscalls(void)
+{
+    char line[128];
+    long n, total = 0;
+    FILE *fp;
+
+    if ((fp = fopen("/proc/self/io", "r")) == NULL)
+	return 0;
+    while (fgets(line, sizeof(line), fp)) {
+	if (sscanf(line, "syscr: %ld", &n) == 1 ||
+	    sscanf(line, "syscw: %ld", &n) == 1)
+		total += n;
+    }
+    fclose(fp);
+
+    return total;
+}
+
+
+/*
+ * the keyword matcher alone, walking the text the way tokenize() does
+ */
+static long
+scan(const char *sp, const char *ep)
+{
+    long ntok = 0;
+    int quoted = 0;
+
+    while (sp < ep) {
+	if (*sp == '\n')
+		quoted = 0;
+	else if (*sp == '"')
+		quoted = !quoted;
+	if (!quoted && gettoken(&sp, 0, DIALECT_V2) != -1) {
+		ntok++;
+		continue;
+	}
+	sp++;
+    }
+
+    return ntok;
+}
+
+
+/*
+ * the byte at a time detokenizer that prg2bas_image() used to be, kept to
+ * check that the faster one gives exactly the same text
+ */
+static void
+reference(const unsigned char *sp, long len, outbuf_t *out)
+{
+    const dialect_t *d = &dialects[DIALECT_V2];
+    const unsigned char *ep = sp + len;
+    int quoted, c;
+
+    out->len = 0;
+    for (sp += 2; ep - sp >= 4 && (sp[0] | sp[1]); ) {
+	outbuf_reserve(out, (ep - sp) * d->maxlen + 8);
+	out->len += sprintf(&out->buf[out->len], "%d", sp[2] | (sp[3] << 8));
+	quoted = 0;
+	for (sp += 4; sp < ep && *sp; ++sp) {
+		c = *sp;
+		if (c == '"')
+			quoted = !quoted;
+		if (!quoted && c >= 0x80) {
+			memcpy(&out->buf[out->len], d->text[c], d->len[c]);
+			out->len += d->len[c];
+		} else
+			out->buf[out->len++] = c;
+	}
+	if (sp++ == ep)
+		break;
+	out->buf[out->len++] = '\n';
+    }
+}
+
+
+/*
+ * compare prg2bas_buf() with the reference over the whole corpus
+ * returns the number of programs that differ
+ */
+static int
+check(prog_t *progs, int n, const prgopts_t *opts)
+{
+    outbuf_t out, ref;
+    diag_t diag;
+    int bad = 0, i;
+
+    memset(&out, 0, sizeof(out));
+    memset(&ref, 0, sizeof(ref));
+    diag_init(&diag, NULL, NULL);
+
+    for (i = 0; i < n; ++i) {
+	out.len = 0;
+	prg2bas_buf((unsigned char *)progs[i].prg.buf, progs[i].prg.len,
+		    &out, opts, &diag);
+	reference((unsigned char *)progs[i].prg.buf, progs[i].prg.len, &ref);
+	if (out.len != ref.len || memcmp(out.buf, ref.buf, out.len)) {
+		fprintf(stderr, "MISMATCH: %s detokenizes differently\n",
+			progs[i].name);
+		bad++;
+	}
+    }
+    outbuf_free(&out);
+    outbuf_free(&ref);
+
+    return bad;
+}
+
+
+static prog_t *
+load(const char *dir, int *count)
+{
+    char path[1024];
+    struct dirent *de;
+    prog_t *progs = NULL;
+    int n = 0, size = 0;
+    long i;
+    FILE *fp;
+    DIR *dp;
+
+    if ((dp = opendir(dir)) == NULL) {
+	fprintf(stderr, "Unable to open '%s'\n", dir);
+	exit(2);
+    }
+    while ((de = readdir(dp)) != NULL) {
+	if (strstr(de->d_name, ".bas") == NULL)
+		continue;
+	if (n == size) {
+		size = size ? size * 2 : 256;
+		progs = realloc(progs, size * sizeof(prog_t));
+	}
+	memset(&progs[n], 0, sizeof(prog_t));
+	sprintf(path, "%s/%s", dir, de->d_name);
+	if ((fp = fopen(path, "rb")) == NULL ||
+	    readfile(fp, &progs[n].bas) < 0) {
+		fprintf(stderr, "Unable to read '%s'\n", path);
+		exit(2);
+	}
+	fclose(fp);
+	progs[n].name = strdup(path);
+	for (i = 0; i < progs[n].bas.len; ++i)
+		progs[n].lines += progs[n].bas.buf[i] == '\n';
+	n++;
+    }
+    closedir(dp);
+
+    *count = n;
+    return progs;
+}
+
+
+/*
+ * time one phase over the whole corpus
+ * returns the number of programs that failed to convert
+ */
+static int
+run(prog_t *progs, int n, int phase, const prgopts_t *opts)
+{
+    phase_t *p = &phases[phase];
+    outbuf_t out;
+    diag_t diag;
+    double t0, t;
+    long a0, s0;
+    FILE *fi, *fo;
+    int i, failed = 0;
+
+    memset(&out, 0, sizeof(out));
+    diag_init(&diag, NULL, NULL);
+
+    a0 = nallocs;
+    s0 = syscalls();
+    t0 = now();
+    p->bytes = p->lines = 0;
+    for (i = 0; i < n; ++i) {
+	switch (phase) {
+		case GETTOKEN:
+			scan(progs[i].bas.buf,
+			     progs[i].bas.buf + progs[i].bas.len);
+			break;
+
+		case TOKENIZE:
+			out.len = 0;
+			if (bas2prg_buf(progs[i].bas.buf, progs[i].bas.len,
+					&out, opts, &diag) != 0)
+				failed++;
+			break;
+
+		case DETOKENIZE:
+			out.len = 0;
+			if (prg2bas_buf((unsigned char *)progs[i].prg.buf,
+					progs[i].prg.len, &out, opts, &diag) != 0)
+				failed++;
+			break;
+
+		case FILES:
+			/* the whole path, from an open file to a written one */
+			fi = fopen(progs[i].name, "r");
+			fo = fopen("/dev/null", "wb");
+			if (fi == NULL || fo == NULL ||
+			    bas2prg_file(fi, fo, opts, &diag) != 0)
+				failed++;
+			if (fi != NULL)
+				fclose(fi);
+			if (fo != NULL)
+				fclose(fo);
+			break;
+	}
+	p->bytes += (phase == DETOKENIZE) ? progs[i].prg.len :
+					    progs[i].bas.len;
+	p->lines += progs[i].lines;
+    }
+    t = now() - t0;
+    p->syscalls = syscalls() - s0 - overhead;
+    p->allocs = nallocs - a0;
+
+    if (p->secs == 0 || t < p->secs)
+	p->secs = t;
+    outbuf_free(&out);
+
+    return failed;
+}
+
+
+/*
+ * find "name": { ... "key": number in a baseline written by us
+ */
+static int
+getval(const char *json, const char *name, const char *key, double *val)
+{
+    char pat[64];
+    const char *sp;
+
+    sprintf(pat, "\"%s\"", name);
+    if ((sp = strstr(json, pat)) == NULL)
+	return -1;
+    sprintf(pat, "\"%s\":", key);
+    if ((sp = strstr(sp, pat)) == NULL)
+	return -1;
+
+    return sscanf(sp + strlen(pat), "%lf", val) == 1 ? 0 : -1;
+}
+
+
+/*
+ * compare with a baseline; speed may drop by tol percent, allocations
+ * must not go up at all
+ * returns the number of regressions
+ */
+static int
+compare(const char *name, double tol)
+{
+    outbuf_t json;
+    double mbps, allocs;
+    int bad = 0, i;
+    FILE *fp;
+
+    memset(&json, 0, sizeof(json));
+    if ((fp = fopen(name, "rb")) == NULL || readfile(fp, &json) < 0 ||
+	outbuf_reserve(&json, 1) < 0) {
+	fprintf(stderr, "Unable to read baseline '%s'\n", name);
+	exit(2);
+    }
+    fclose(fp);
+    json.buf[json.len] = '\0';
+
+    for (i = 0; i < NPHASES; ++i) {
+	if (getval(json.buf, phases[i].name, "mb_per_s", &mbps) < 0 ||
+	    getval(json.buf, phases[i].name, "allocs", &allocs) < 0)
+		continue;
+	if (phases[i].bytes / phases[i].secs / 1e6 < mbps * (1 - tol / 100)) {
+		fprintf(stderr, "REGRESSION: %s %.2f MB/s, baseline %.2f MB/s\n",
+			phases[i].name, phases[i].bytes / phases[i].secs / 1e6,
+			mbps);
+		bad++;
+	}
+	if (phases[i].allocs > allocs) {
+		fprintf(stderr, "REGRESSION: %s %ld allocations, baseline %.0f\n",
+			phases[i].name, phases[i].allocs, allocs);
+		bad++;
+	}
+    }
+    outbuf_free(&json);
+
+    return bad;
+}
+
+
+int
+main(int argc, char **argv)
+{
+    const char *baseline = NULL;
+    const char *outname = NULL;
+    double tol = 30;
+    int repeats = 3;
+    prgopts_t opts;
+    diag_t diag;
+    prog_t *progs;
+    FILE *fo;
+    int i, k, n, c;
+
+    opterr = 0;
+    while ((c = getopt(argc, argv, "b:r:t:w:")) != EOF) switch (c) {
+	case 'b':	// compare-with-baseline
+		baseline = optarg;
+		break;
+
+	case 'r':	// repeats
+		repeats = atoi(optarg);
+		break;
+
+	case 't':	// tolerance-percent
+		tol = atof(optarg);
+		break;
+
+	case 'w':	// write-results
+		outname = optarg;
+		break;
+
+	default:
+usage:
+		fprintf(stderr, "Usage: benchsuite [-b baseline.json] [-t percent] [-r repeats] [-w out.json] corpusdir\n");
+		exit(1);
+    }
+    if (optind + 1 != argc)
+	goto usage;
+
+    tokens_init();
+    prgopts_init(&opts);
+    opts.ramtop = dialect_top(opts.dialect);
+    diag_init(&diag, NULL, NULL);
+
+    overhead = syscalls();
+    overhead = syscalls() - overhead;
+
+    progs = load(argv[optind], &n);
+    if (n == 0) {
+	fprintf(stderr, "No .bas files in '%s'\n", argv[optind]);
+	return 1;
+    }
+    /* A program that does not convert would be timed on its error path. */
+    for (i = 0; i < n; ++i) {
+	if (bas2prg_buf(progs[i].bas.buf, progs[i].bas.len, &progs[i].prg,
+			&opts, &diag) != 0) {
+		fprintf(stderr, "%s: %s\n", progs[i].name, diag.error);
+		return 1;
+	}
+    }
+
+    if (check(progs, n, &opts) > 0)
+	return 1;
+
+    for (c = 0; c < repeats; ++c) {
+	for (i = 0; i < NPHASES; ++i) {
+		if ((k = run(progs, n, i, &opts)) > 0) {
+			fprintf(stderr, "%s: %i programs failed\n",
+				phases[i].name, k);
+			return 1;
+		}
+	}
+    }
+
+    fo = stdout;
+    if (outname != NULL && (fo = fopen(outname, "w")) == NULL) {
+	fprintf(stderr, "Unable to create output '%s'\n", outname);
+	return 2;
+    }
+    fprintf(fo, "{\n");
+    for (i = 0; i < NPHASES; ++i) {
+	fprintf(fo, "  \"%s\": { \"mb_per_s\": %.2f, \"lines_per_s\": %.0f, "
+		    "\"allocs\": %ld, \"syscalls\": %ld }%s\n",
+		phases[i].name, phases[i].bytes / phases[i].secs / 1e6,
+		phases[i].lines / phases[i].secs, phases[i].allocs,
+		phases[i].syscalls, i + 1 < NPHASES ? "," : "");
+    }
+    fprintf(fo, "}\n");
+    if (fo != stdout)
+	fclose(fo);
+
+    if (baseline != NULL && compare(baseline, tol) > 0)
+	return 1;
+
+    return 0;
+}
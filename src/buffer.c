@@ -0,0 +1,252 @@
+/*
+ * buffer.c, whole-file input and output buffers.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+#include "prgtools.h"
+
+
+/*
+ * set up an output buffer over caller memory; it will not grow
+ */
+void
+outbuf_init(outbuf_t *o, void *mem, size_t size)
+{
+    o->buf = mem;
+    o->len = 0;
+    o->size = size;
+    o->fixed = 1;
+}
+
+
+/*
+ * make room for n more bytes in an output buffer
+ * returns -1 if out of memory
+ */
+int
+outbuf_reserve(outbuf_t *o, size_t n)
+{
+    size_t size;
+    char *p;
+
+    if (o->len + n <= o->size)
+	return 0;
+    if (o->fixed)
+	return -1;
+
+    size = o->size ? o->size : 4096;
+    while (size < o->len + n)
+	size *= 2;
+    if ((p = realloc(o->buf, size)) == NULL)
+	return -1;
+    o->buf = p;
+    o->size = size;
+
+    return 0;
+}
+
+
+/*
+ * report that outbuf_reserve() failed, returns -1 for convenience
+ */
+int
+outbuf_full(outbuf_t *o, diag_t *d)
+{
+    return diag_error(d, o->fixed ? "output buffer full" : "out of memory");
+}
+
+
+/*
+ * append formatted text to an output buffer
+ * returns 0, or -1 if out of memory
+ */
+int
+outbuf_printf(outbuf_t *o, const char *fmt, ...)
+{
+    char buf[256];
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0 || n >= sizeof(buf) || outbuf_reserve(o, n) < 0)
+	return -1;
+    memcpy(&o->buf[o->len], buf, n);
+    o->len += n;
+
+    return 0;
+}
+
+
+/*
+ * append a JSON string; bytes that are not printable ASCII, such as
+ * PETSCII, are written as \u00xx
+ * returns 0, or -1 if out of memory
+ */
+int
+outbuf_jsonstr(outbuf_t *o, const char *s, size_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+    char *dp;
+    int c;
+
+    /* the worst case is every byte as \u00xx */
+    if (outbuf_reserve(o, 6 * len + 2) < 0)
+	return -1;
+    dp = &o->buf[o->len];
+    *dp++ = '"';
+    while (len-- > 0) {
+	c = (unsigned char)*s++;
+	if (c == '"' || c == '\\') {
+		*dp++ = '\\';
+		*dp++ = c;
+	} else if (c < 0x20 || c > 0x7e) {
+		memcpy(dp, "\\u00", 4);
+		dp[4] = hex[c >> 4];
+		dp[5] = hex[c & 15];
+		dp += 6;
+	} else
+		*dp++ = c;
+    }
+    *dp++ = '"';
+    o->len = dp - o->buf;
+
+    return 0;
+}
+
+
+void
+outbuf_free(outbuf_t *o)
+{
+    if (!o->fixed)
+	free(o->buf);
+    o->buf = NULL;
+    o->len = o->size = 0;
+}
+
+
+/*
+ * read a whole file (up to size bytes) with as few calls as possible
+ * returns the number of bytes read, or -1 on error
+ */
+long
+readall(FILE *fp, unsigned char *buf, long size)
+{
+    size_t n, len = 0;
+
+    while (len < size) {
+	n = fread(&buf[len], 1, size - len, fp);
+	if (n == 0)
+		break;
+	len += n;
+    }
+
+    return ferror(fp) ? -1 : (long)len;
+}
+
+
+/*
+ * read a whole file of any size into a buffer
+ * returns 0 on success, -1 on error
+ */
+int
+readfile(FILE *fp, outbuf_t *o)
+{
+    size_t n;
+
+    for (;;) {
+	if (outbuf_reserve(o, o->len < 65536 ? 65536 : o->len) < 0)
+		return -1;
+	n = fread(&o->buf[o->len], 1, o->size - o->len, fp);
+	if (n == 0)
+		break;
+	o->len += n;
+    }
+
+    return ferror(fp) ? -1 : 0;
+}
+
+
+/*
+ * map a whole file into memory, read only
+ * returns its contents, or NULL on error or if it is empty
+ */
+const unsigned char *
+mapfile(const char *path, long *size)
+{
+#ifdef _WIN32
+    HANDLE f, m;
+    LARGE_INTEGER n;
+    void *p = NULL;
+
+    f = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+		    FILE_ATTRIBUTE_NORMAL, NULL);
+    if (f == INVALID_HANDLE_VALUE)
+	return NULL;
+    if (GetFileSizeEx(f, &n) && n.QuadPart > 0 && n.QuadPart <= 0x7fffffff &&
+	(m = CreateFileMappingA(f, NULL, PAGE_READONLY, 0, 0, NULL)) != NULL) {
+	p = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(m);
+	*size = (long)n.QuadPart;
+    }
+    CloseHandle(f);
+
+    return p;
+#else
+    struct stat st;
+    void *p = NULL;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+	return NULL;
+    if (fstat(fd, &st) == 0 && st.st_size > 0 && st.st_size <= 0x7fffffff) {
+	p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (p == MAP_FAILED)
+		p = NULL;
+	*size = (long)st.st_size;
+    }
+    close(fd);
+
+    return p;
+#endif
+}
+
+
+void
+unmapfile(const unsigned char *data, long size)
+{
+    if (data == NULL)
+	return;
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap((void *)data, size);
+#endif
+}
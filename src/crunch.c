@@ -0,0 +1,400 @@
+/*
+ * crunch.c, make a tokenized BASIC program as small as it will go.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "tokens.h"
+#include "prgtools.h"
+
+
+/* the tokens crunching looks at */
+#define TOK_DATA	0x83
+#define TOK_LET		0x88
+#define TOK_GOTO	0x89
+#define TOK_RUN		0x8a
+#define TOK_IF		0x8b
+#define TOK_GOSUB	0x8d
+#define TOK_TO		0xa4
+#define TOK_THEN	0xa7
+#define TOK_GO		0xcb
+
+#define CRUNCH_LIST	80	// a line the screen editor can still take
+#define CRUNCH_BYTES	255	// any longer and BASIC gets lost in it
+
+#define ISDIGIT(c)	((c) >= '0' && (c) <= '9')
+
+/* what the bytes were saved on */
+enum { CR_REM, CR_SPACE, CR_COLON, CR_LET, CR_GOTO, CR_QUOTE, CR_MERGE, NCR };
+
+static const char *const what[NCR] = {
+    "REMs", "spaces", "empty statements", "LET", "GOTO after THEN",
+    "closing quotes", "merged lines"
+};
+
+/* how a crunched line ends */
+#define CL_QUOTED	1	// inside a string
+#define CL_IF		2	// the rest of it is conditional
+#define CL_REM		4	// it had a REM
+
+
+/*
+ * mark the line numbers a line jumps to: after GOTO, GO TO, GOSUB (also
+ * in ON ... GOTO lists), THEN and RUN
+ */
+static void
+targets(const unsigned char *sp, const unsigned char *le, unsigned char *bits)
+{
+    int quoted = 0;
+    long n;
+    int c;
+
+    while (sp < le) {
+	c = *sp++;
+	if (c == '"')
+		quoted = !quoted;
+	if (quoted)
+		continue;
+	if (c == TOKEN_REM)
+		break;
+	if (c == TOK_GO) {
+		while (sp < le && *sp == ' ')
+			++sp;
+		if (sp == le || *sp != TOK_TO)
+			continue;
+		++sp;
+		c = TOK_GOTO;
+	}
+	if (c != TOK_GOTO && c != TOK_GOSUB && c != TOK_THEN && c != TOK_RUN)
+		continue;
+
+	for (;;) {
+		while (sp < le && *sp == ' ')
+			++sp;
+		if (sp == le || !ISDIGIT(*sp))
+			break;
+		for (n = 0; sp < le && (ISDIGIT(*sp) || *sp == ' '); ++sp) {
+			if (*sp != ' ' && n < 65536)
+				n = n * 10 + *sp - '0';
+		}
+		if (n < 65536)
+			bits[n >> 3] |= 1 << (n & 7);
+		if ((c != TOK_GOTO && c != TOK_GOSUB) || sp == le ||
+		    *sp != ',')
+			break;
+		++sp;
+	}
+    }
+}
+
+
+/*
+ * crunch the text of one line into dp: drop the REM and what follows it,
+ * spaces outside strings and DATA, empty statements, LET, and GOTO after
+ * THEN; *how gets CL_* for the end of the line
+ * returns the new length, never more than the old
+ */
+static int
+crunch_line(const unsigned char *sp, const unsigned char *le,
+	    unsigned char *dp, long *saved, int *how)
+{
+    unsigned char *start = dp;
+    const unsigned char *np;
+    int quoted = 0, data = 0, stmt = 1;
+    int c;
+
+    *how = 0;
+    while (sp < le) {
+	c = *sp++;
+	if (c == '"')
+		quoted = !quoted;
+	if (c == '"' || quoted || (data && c != ':')) {
+		*dp++ = c;
+		stmt = 0;
+		continue;
+	}
+
+	switch (c) {
+	case ' ':
+		saved[CR_SPACE]++;
+		continue;
+
+	case ':':
+		data = 0;
+		if (stmt) {
+			saved[CR_COLON]++;
+			continue;
+		}
+		*dp++ = c;
+		stmt = 1;
+		continue;
+
+	case TOKEN_REM:
+		saved[CR_REM] += le - sp + 1;
+		*how |= CL_REM;
+		sp = le;
+		continue;
+
+	case TOK_LET:
+		if (stmt) {
+			saved[CR_LET]++;
+			stmt = 0;
+			continue;
+		}
+		break;
+
+	case TOK_DATA:
+		data = 1;
+		break;
+
+	case TOK_IF:
+		*how |= CL_IF;
+		break;
+
+	case TOK_THEN:
+		/* THEN GOTO 100 is THEN 100; a bare GOTO means GOTO 0 */
+		*dp++ = c;
+		stmt = 1;
+		for (np = sp; np < le && *np == ' '; ++np)
+			;
+		if (np < le && *np == TOK_GOTO) {
+			for (++np; np < le && *np == ' '; ++np)
+				;
+			if (np < le && ISDIGIT(*np)) {
+				saved[CR_SPACE] += np - sp - 1;
+				saved[CR_GOTO]++;
+				sp = np;
+				stmt = 0;
+			}
+		}
+		continue;
+	}
+	*dp++ = c;
+	stmt = 0;
+    }
+
+    /* a statement separator at the end is empty too */
+    while (!quoted && dp > start && dp[-1] == ':') {
+	saved[CR_COLON]++;
+	--dp;
+    }
+    if (quoted)
+	*how |= CL_QUOTED;
+
+    return dp - start;
+}
+
+
+/*
+ * length of a line of tokens as LIST shows it
+ */
+static int
+listlen(const unsigned char *sp, int n)
+{
+    const dialect_t *d = &dialects[DIALECT_V2];
+    int quoted = 0, len = 0;
+
+    while (n-- > 0) {
+	if (*sp == '"')
+		quoted = !quoted;
+	len += quoted || *sp < 0x80 ? 1 : d->len[*sp];
+	++sp;
+    }
+
+    return len;
+}
+
+
+static int
+numlen(long n)
+{
+    int len = 1;
+
+    while (n >= 10) {
+	n /= 10;
+	len++;
+    }
+
+    return len;
+}
+
+
+/*
+ * finish the line at off in out, in a program that starts at base: drop a
+ * closing quote at its end, end it and put in its link
+ */
+static void
+endline(outbuf_t *out, size_t base, size_t off, long load, long *saved)
+{
+    unsigned char *lp = (unsigned char *)&out->buf[off];
+    unsigned char *ep = (unsigned char *)&out->buf[out->len];
+    const unsigned char *p;
+    long link;
+    int quoted = 0;
+
+    for (p = lp + 4; p < ep; ++p) {
+	if (*p == '"')
+		quoted = !quoted;
+    }
+    if (!quoted && ep > lp + 4 && ep[-1] == '"') {
+	saved[CR_QUOTE]++;
+	--ep;
+    }
+    if (ep == lp + 4)
+	*ep++ = ' ';		// BASIC does not like empty lines
+    *ep++ = 0;
+
+    out->len = (char *)ep - out->buf;
+    link = load + out->len - base - 2;
+    lp[0] = link & 255;
+    lp[1] = link >> 8;
+}
+
+
+/*
+ * crunch a tokenized BASIC V2 program, appended to out: REMs go, except
+ * that lines something jumps to stay (emptied); spaces go; and lines are
+ * merged as long as nothing jumps to the second one, the first has no IF
+ * and the result fits the screen editor (opts->crunch 1) or 255 bytes (2)
+ * returns 0 on success, -1 on error (reason in diag->error)
+ *
+ * Note: programs that keep machine code or data in a REM must not be
+ * crunched.
+ */
+int
+prg_crunch(const unsigned char *prg, long len, outbuf_t *out,
+	   const prgopts_t *opts, diag_t *diag)
+{
+    const unsigned char *sp, *le, *ep = prg + len;
+    unsigned char bits[65536 / 8];
+    unsigned char *tmp;
+    long saved[NCR];
+    long load, line;
+    size_t start = out->len, cur = 0;
+    int n, how, curhow = 0, curlist = 0, merge;
+    long curnum = 0;
+    int i;
+
+    if (opts->dialect != DIALECT_V2)
+	return diag_error(diag, "crunching is only for BASIC V2");
+    if (len < 2)
+	return diag_error(diag, "no load address");
+    load = prg[0] | (prg[1] << 8);
+
+    /* First find the lines that must stay. */
+    memset(bits, 0, sizeof(bits));
+    for (sp = prg + 2; ep - sp >= 4 && (sp[0] | sp[1]) != 0; sp = le + 1) {
+	if ((le = memchr(sp + 4, 0, ep - sp - 4)) == NULL)
+		le = ep;
+	targets(sp + 4, le, bits);
+	if (le == ep)
+		break;
+    }
+
+    if ((tmp = malloc(len)) == NULL)
+	return diag_error(diag, "out of memory");
+    memset(saved, 0, sizeof(saved));
+
+    if (outbuf_reserve(out, 2) < 0)
+	goto full;
+    memcpy(&out->buf[out->len], prg, 2);
+    out->len += 2;
+
+    for (sp = prg + 2; ep - sp >= 4 && (sp[0] | sp[1]) != 0; sp = le + 1) {
+	line = sp[2] | (sp[3] << 8);
+	if ((le = memchr(sp + 4, 0, ep - sp - 4)) == NULL)
+		le = ep;
+	n = crunch_line(sp + 4, le, tmp, saved, &how);
+
+	if (cur && !(bits[line >> 3] & (1 << (line & 7))) &&
+	    !(curhow & CL_IF)) {
+		/* a quote to close the string, the colon, the line */
+		i = (curhow & CL_QUOTED ? 1 : 0) + 1;
+		if (out->len == cur + 4)
+			i = 0;		// a line emptied of its REM
+		if (opts->crunch > 1)
+			merge = out->len - cur - 4 + i + n <= CRUNCH_BYTES;
+		else
+			merge = numlen(curnum) + 1 + curlist + i +
+				listlen(tmp, n) <= CRUNCH_LIST;
+		if (merge) {
+			if (outbuf_reserve(out, i + n + 2) < 0)
+				goto full;
+			if (curhow & CL_QUOTED)
+				out->buf[out->len++] = '"';
+			if (i > 0)
+				out->buf[out->len++] = ':';
+			memcpy(&out->buf[out->len], tmp, n);
+			out->len += n;
+			saved[CR_MERGE] += 5 - i;
+			curlist += i + listlen(tmp, n);
+			curhow = how;
+			if (le == ep)
+				break;
+			continue;
+		}
+	}
+
+	if (cur)
+		endline(out, start, cur, load, saved);
+	cur = 0;
+
+	/* A line with nothing left goes, unless something jumps to it. */
+	if (n == 0 && !(bits[line >> 3] & (1 << (line & 7)))) {
+		saved[how & CL_REM ? CR_REM : CR_SPACE] += 5;
+		if (le == ep)
+			break;
+		continue;
+	}
+
+	if (outbuf_reserve(out, 4 + n + 2 + 2) < 0)
+		goto full;
+	cur = out->len;
+	out->buf[cur + 2] = line & 255;
+	out->buf[cur + 3] = line >> 8;
+	memcpy(&out->buf[cur + 4], tmp, n);
+	out->len += 4 + n;
+	curnum = line;
+	curhow = how;
+	curlist = listlen(tmp, n);
+	if (le == ep)
+		break;
+    }
+    if (cur)
+	endline(out, start, cur, load, saved);
+    free(tmp);
+
+    if (outbuf_reserve(out, 2) < 0)
+	return outbuf_full(out, diag);
+    out->buf[out->len++] = 0;
+    out->buf[out->len++] = 0;
+
+    for (i = 0; i < NCR; ++i) {
+	if (saved[i] != 0)
+		diag_info(diag, "Crunched %ld bytes of %s\n", saved[i],
+			  what[i]);
+    }
+    diag_info(diag, "Crunched %ld bytes to %ld, saving %ld\n",
+	      len, (long)(out->len - start), len - (long)(out->len - start));
+
+    return 0;
+
+full:
+    free(tmp);
+    return outbuf_full(out, diag);
+}
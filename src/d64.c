@@ -0,0 +1,485 @@
+/*
+ * d64.c, read and write files on 1541 disk images.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "prgtools.h"
+
+
+#define DIR_TRACK	18
+#define DIR_SECTOR	1
+#define BAM_SECTOR	0
+
+#define BAM_TRACKS	35		// tracks in the BAM; 36-40 are not used
+#define FILE_INTERLEAVE	10		// what the 1541 uses, for fast loading
+#define DIR_INTERLEAVE	3
+
+
+/*
+ * number of sectors on a track (1-based)
+ */
+int
+d64_sectors(int track)
+{
+    if (track <= 17)
+	return 21;
+    if (track <= 24)
+	return 19;
+    if (track <= 30)
+	return 18;
+    return 17;
+}
+
+
+/*
+ * find a sector in the image, NULL if it is not there
+ */
+const unsigned char *
+d64_sector(const d64_t *d, int track, int sector)
+{
+    long off = 0;
+    int t;
+
+    if (track < 1 || track > d->tracks ||
+	sector < 0 || sector >= d64_sectors(track))
+	return NULL;
+
+    for (t = 1; t < track; ++t)
+	off += d64_sectors(t);
+
+    return &d->data[(off + sector) * 256];
+}
+
+
+/*
+ * set up an image held in memory; the size tells 35 from 40 tracks, and
+ * any error bytes at the end are ignored
+ * returns 0 on success, -1 if this does not look like a D64 image
+ */
+int
+d64_open(d64_t *d, unsigned char *data, long size)
+{
+    d->data = data;
+    d->size = size;
+
+    switch (size) {
+	case 174848:		// 35 tracks
+	case 175531:		// 35 tracks with error bytes
+		d->tracks = 35;
+		break;
+
+	case 196608:		// 40 tracks
+	case 197376:		// 40 tracks with error bytes
+		d->tracks = 40;
+		break;
+
+	default:
+		return -1;
+    }
+
+    return 0;
+}
+
+
+/*
+ * read the directory
+ * returns the number of entries (in *ents, to be freed), or -1 on error
+ */
+int
+d64_dir(const d64_t *d, imgent_t **ents)
+{
+    const unsigned char *sp, *ep;
+    imgent_t *list = NULL, *p;
+    int n = 0, size = 0;
+    int track = DIR_TRACK, sector = DIR_SECTOR;
+    int guard, i;
+
+    /* The directory cannot be longer than its track. */
+    for (guard = 0; track != 0 && guard < d64_sectors(DIR_TRACK); ++guard) {
+	if ((sp = d64_sector(d, track, sector)) == NULL)
+		break;
+
+	for (ep = sp; ep < sp + 256; ep += 32) {
+		if ((ep[2] & 0x07) == 0)	// deleted/scratched
+			continue;
+
+		if (n == size) {
+			size = size ? size * 2 : 144;
+			p = realloc(list, size * sizeof(imgent_t));
+			if (p == NULL) {
+				free(list);
+				return -1;
+			}
+			list = p;
+		}
+
+		p = &list[n++];
+		memset(p, 0, sizeof(*p));
+		p->type = ep[2];
+		p->track = ep[3];
+		p->sector = ep[4];
+		p->blocks = ep[30] | (ep[31] << 8);
+		for (i = 0; i < 16 && ep[5 + i] != 0xa0; ++i)
+			p->name[i] = ep[5 + i];
+		p->name[i] = '\0';
+	}
+
+	track = sp[0];
+	sector = sp[1];
+    }
+
+    *ents = list;
+    return n;
+}
+
+
+/*
+ * gather a file from its chain of sectors
+ * returns the number of bytes (at most size), or -1 on a broken chain
+ */
+long
+d64_read(const d64_t *d, const imgent_t *e, unsigned char *buf, long size)
+{
+    const unsigned char *sp;
+    int track = e->track, sector = e->sector;
+    long len = 0, guard;
+    int n;
+
+    /* A chain longer than the disk must have a loop in it. */
+    for (guard = d->size / 256; track != 0; --guard) {
+	if (guard == 0 || (sp = d64_sector(d, track, sector)) == NULL)
+		return -1;
+
+	/* In the last sector, byte 1 is the index of the last byte used. */
+	n = sp[0] ? 254 : sp[1] - 1;
+	if (n < 0)
+		n = 0;
+	if (n > size - len)
+		n = size - len;
+	memcpy(&buf[len], &sp[2], n);
+	len += n;
+
+	track = sp[0];
+	sector = sp[1];
+    }
+
+    return len;
+}
+
+
+/*
+ * Writing follows the 1541 DOS: the first block of a file goes on the
+ * track nearest the directory with a free block, the next ones FILE_INTERLEAVE
+ * sectors further on so that the drive can take each block in before the
+ * next comes round, moving away from the directory when a track is full.
+ */
+
+static unsigned char *
+sector(d64_t *d, int track, int sec)
+{
+    return (unsigned char *)d64_sector(d, track, sec);
+}
+
+
+/* the BAM entry of a track: free blocks, then one bit per sector */
+static unsigned char *
+bament(d64_t *d, int track)
+{
+    return sector(d, DIR_TRACK, BAM_SECTOR) + 4 * track;
+}
+
+
+static int
+isfree(d64_t *d, int track, int sec)
+{
+    return (bament(d, track)[1 + sec / 8] >> (sec % 8)) & 1;
+}
+
+
+static void
+allocate(d64_t *d, int track, int sec)
+{
+    unsigned char *b = bament(d, track);
+
+    b[1 + sec / 8] &= ~(1 << (sec % 8));
+    b[0]--;
+}
+
+
+static void
+release(d64_t *d, int track, int sec)
+{
+    unsigned char *b = bament(d, track);
+
+    if (!isfree(d, track, sec)) {
+	b[1 + sec / 8] |= 1 << (sec % 8);
+	b[0]++;
+    }
+}
+
+
+/*
+ * blocks free for files, the number DIRECTORY shows
+ */
+int
+d64_blocksfree(d64_t *d)
+{
+    int track, n = 0;
+
+    for (track = 1; track <= BAM_TRACKS; ++track) {
+	if (track != DIR_TRACK)
+		n += bament(d, track)[0];
+    }
+
+    return n;
+}
+
+
+/*
+ * make an empty 35-track image in data (D64_SIZE bytes), as NEW does
+ */
+void
+d64_format(d64_t *d, unsigned char *data, const char *name, const char *id)
+{
+    unsigned char *bam;
+    int track, sec, i;
+
+    memset(data, 0, D64_SIZE);
+    d64_open(d, data, D64_SIZE);
+
+    bam = sector(d, DIR_TRACK, BAM_SECTOR);
+    bam[0] = DIR_TRACK;
+    bam[1] = DIR_SECTOR;
+    bam[2] = 'A';
+    for (track = 1; track <= BAM_TRACKS; ++track) {
+	for (sec = 0; sec < d64_sectors(track); ++sec)
+		release(d, track, sec);
+    }
+    memset(&bam[0x90], 0xa0, 0x1b);
+    for (i = 0; i < 16 && name[i] != '\0'; ++i)
+	bam[0x90 + i] = name[i];
+    bam[0xa2] = id[0];
+    bam[0xa3] = id[1];
+    bam[0xa5] = '2';
+    bam[0xa6] = 'A';
+    allocate(d, DIR_TRACK, BAM_SECTOR);
+
+    sector(d, DIR_TRACK, DIR_SECTOR)[1] = 0xff;
+    allocate(d, DIR_TRACK, DIR_SECTOR);
+}
+
+
+/*
+ * the first free sector of a track from sec on, going round
+ * returns it, or -1 if the track is full
+ */
+static int
+nextfree(d64_t *d, int track, int sec)
+{
+    int n = d64_sectors(track), i;
+
+    for (i = 0; i < n; ++i, ++sec) {
+	if (sec >= n)
+		sec = 0;
+	if (isfree(d, track, sec))
+		return sec;
+    }
+
+    return -1;
+}
+
+
+/*
+ * allocate the block after (*track, *sec) of a file, or its first one if
+ * *track is 0
+ * returns 0, or -1 if the disk is full
+ */
+static int
+nextblock(d64_t *d, int *track, int *sec)
+{
+    int t = *track, s, dist, n;
+
+    if (t != 0) {
+	/* the interleave, and one back when it goes round, as DOS does */
+	n = d64_sectors(t);
+	s = *sec + FILE_INTERLEAVE;
+	if (s >= n) {
+		s -= n;
+		if (s > 0)
+			s--;
+	}
+	for (; t >= 1 && t <= BAM_TRACKS; t += t < DIR_TRACK ? -1 : 1) {
+		if (bament(d, t)[0] > 0 && (s = nextfree(d, t, s)) >= 0)
+			goto found;
+		s = 0;
+	}
+    }
+
+    for (dist = 1; dist < BAM_TRACKS; ++dist) {
+	for (t = DIR_TRACK - dist; t <= DIR_TRACK + dist; t += 2 * dist) {
+		if (t >= 1 && t <= BAM_TRACKS && bament(d, t)[0] > 0 &&
+		    (s = nextfree(d, t, 0)) >= 0)
+			goto found;
+	}
+    }
+    return -1;
+
+found:
+    allocate(d, t, s);
+    *track = t;
+    *sec = s;
+
+    return 0;
+}
+
+
+/*
+ * the directory entry named name (PETSCII), or else a free one, adding a
+ * sector to the directory if need be
+ * returns the entry, or NULL if the directory is full; *found tells which
+ */
+static unsigned char *
+direntry(d64_t *d, const unsigned char *name, int *found)
+{
+    unsigned char *sp = NULL, *ep, *empty = NULL;
+    int track = DIR_TRACK, sec = DIR_SECTOR, guard, s, i;
+
+    *found = 0;
+    for (guard = 0; guard < d64_sectors(DIR_TRACK); ++guard) {
+	if ((sp = sector(d, track, sec)) == NULL)
+		return NULL;
+	for (ep = sp; ep < sp + 256; ep += 32) {
+		if ((ep[2] & 0x07) == 0) {
+			if (empty == NULL)
+				empty = ep;
+			continue;
+		}
+		for (i = 0; i < 16 && ep[5 + i] == name[i]; ++i)
+			;
+		if (i == 16) {
+			*found = 1;
+			return ep;
+		}
+	}
+	if (sp[0] == 0)
+		break;
+	track = sp[0];
+	sec = sp[1];
+    }
+    if (empty != NULL || sp == NULL || track != DIR_TRACK)
+	return empty;
+
+    /* Add a sector to the directory, on its own track. */
+    if ((s = nextfree(d, DIR_TRACK, sec + DIR_INTERLEAVE)) < 0)
+	return NULL;
+    allocate(d, DIR_TRACK, s);
+    sp[0] = DIR_TRACK;
+    sp[1] = s;
+    sp = sector(d, DIR_TRACK, s);
+    memset(sp, 0, 256);
+    sp[1] = 0xff;
+
+    return sp;
+}
+
+
+/*
+ * write a PRG file to an image held in memory, replacing a PRG file of
+ * the same name as SAVE "@0:name" does; name is PETSCII, at most 16 bytes
+ * returns 0, or -1 if there is no room or a file of another type has the
+ * name (reason in diag)
+ */
+int
+d64_write(d64_t *d, const char *name, const unsigned char *data, long len,
+	  diag_t *diag)
+{
+    unsigned char pname[16], *ep, *sp;
+    int track, sec, nt, ns, found, blocks, old = 0, guard;
+    long n;
+
+    memset(pname, 0xa0, sizeof(pname));
+    memcpy(pname, name, strlen(name) < 16 ? strlen(name) : 16);
+    if ((ep = direntry(d, pname, &found)) == NULL)
+	return diag_error(diag, "directory full");
+    if (found && (ep[2] & 0x07) != D64_PRG)
+	return diag_error(diag, "file type mismatch, '%s' is not a PRG file",
+			  name);
+
+    /* A file that is replaced gives back its blocks, if there is room. */
+    blocks = len > 0 ? (len + 253) / 254 : 1;
+    if (found) {
+	track = ep[3];
+	sec = ep[4];
+	for (guard = d->size / 256; track != 0 && guard > 0; --guard) {
+		if ((sp = sector(d, track, sec)) == NULL)
+			break;
+		old++;
+		track = sp[0];
+		sec = sp[1];
+	}
+    }
+    if (blocks > d64_blocksfree(d) + old)
+	return diag_error(diag, "disk full, %d blocks needed and %d free",
+			  blocks, d64_blocksfree(d) + old);
+    if (found) {
+	track = ep[3];
+	sec = ep[4];
+	for (; old > 0; --old) {
+		sp = sector(d, track, sec);
+		release(d, track, sec);
+		track = sp[0];
+		sec = sp[1];
+	}
+    }
+
+    /* The blocks, each linked to the next; the last one says how much of
+     * it is used. */
+    track = 0;
+    if (nextblock(d, &track, &sec) < 0)
+	return diag_error(diag, "disk full");
+    ep[3] = track;
+    ep[4] = sec;
+    for (;;) {
+	sp = sector(d, track, sec);
+	n = len < 254 ? len : 254;
+	memcpy(&sp[2], data, n);
+	memset(&sp[2 + n], 0, 254 - n);
+	data += n;
+	len -= n;
+	if (len == 0) {
+		sp[0] = 0;
+		sp[1] = n + 1;
+		break;
+	}
+	nt = track;
+	ns = sec;
+	if (nextblock(d, &nt, &ns) < 0)
+		return diag_error(diag, "disk full");
+	sp[0] = track = nt;
+	sp[1] = sec = ns;
+    }
+
+    ep[2] = 0x80 | D64_PRG;
+    memcpy(&ep[5], pname, 16);
+    memset(&ep[21], 0, 9);
+    ep[30] = blocks & 0xff;
+    ep[31] = blocks >> 8;
+
+    return 0;
+}
@@ -0,0 +1,647 @@
+/*
+ * detokenize.c, convert a tokenized C64 PRG file to BASIC text.
+ * Copyright 2011, 2012 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(__AVX2__)
+# include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+# include <emmintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif
+#include "tokens.h"
+#include "prgtools.h"
+#include "petscii.h"
+
+
+/*
+ * put a line number, followed by nothing
+ */
+static char *
+putnum(char *dp, long n)
+{
+    char tmp[12];
+    char *tp = &tmp[sizeof(tmp)];
+
+    if (n < 0) {
+	*dp++ = '-';
+	n = -n;
+    }
+    do {
+	*--tp = '0' + n % 10;
+	n /= 10;
+    } while (n);
+    while (tp < &tmp[sizeof(tmp)])
+	*dp++ = *tp++;
+
+    return dp;
+}
+
+
+/*
+ * check that a program loaded at load is BASIC: the link pointers must go
+ * forward through it, each one to just past the end of a line, up to the
+ * final 0000
+ */
+int
+image_isbasic(long load, const unsigned char *sp, long len)
+{
+    long link, off = 0;
+
+    for (;;) {
+	if (off + 2 > len)
+		return 0;
+	link = sp[off] | (sp[off + 1] << 8);
+	if (link == 0)
+		return off > 0;
+
+	/* next line starts after this one's header and its nul byte */
+	if (link < load + off + 5 || link - load + 2 > len ||
+	    sp[link - load - 1] != 0)
+		return 0;
+	off = link - load;
+    }
+}
+
+
+/*
+ * the same for a PRG file, which starts with its load address
+ */
+int
+prg_isbasic(const unsigned char *prg, long len)
+{
+    if (len < 2)
+	return 0;
+
+    return image_isbasic(prg[0] | (prg[1] << 8), prg + 2, len - 2);
+}
+
+
+/*
+ * follow the link pointers of a program loaded at load, as LIST does.
+ * Each one must point inside the program, at a line that ends in a nul
+ * before the end of it, and there cannot be more lines than fit, so a
+ * loop is caught; the lines need not be stored in order.
+ * returns the number of lines, or -1 if a pointer leads astray; *end is
+ * the offset just past the final 0000
+ */
+long
+prg_linkchain(long load, const unsigned char *sp, long len, long *end)
+{
+    long link, off = 0, n = 0;
+
+    for (;;) {
+	if (off < 0 || off + 2 > len)
+		return -1;
+	link = sp[off] | (sp[off + 1] << 8);
+	if (link == 0) {
+		*end = off + 2;
+		return n;
+	}
+	if (off + 4 >= len || ++n > len / 5)
+		return -1;
+
+	/* the usual link, just past the nul of this line, or a search */
+	if (!(link - load > off + 4 && link - load <= len &&
+	      sp[link - load - 1] == 0) &&
+	    memchr(sp + off + 4, 0, len - off - 4) == NULL)
+		return -1;
+	off = link - load;
+    }
+}
+
+
+static int
+linecmp(const void *a, const void *b)
+{
+    const prgline_t *x = a, *y = b;
+
+    if (x->number != y->number)
+	return x->number < y->number ? -1 : 1;
+    return x->off < y->off ? -1 : x->off > y->off;
+}
+
+
+/*
+ * index the lines of a program loaded at load by their numbers, in one
+ * pass over it: through the link pointers if they can be followed, or
+ * else in the order the lines are stored, up to a 0000 or a line cut off
+ * by the end. *lines is to be freed by the caller.
+ * returns the number of lines, or -1 if out of memory
+ */
+long
+prg_lineindex(long load, const unsigned char *sp, long len, prgline_t **lines)
+{
+    const unsigned char *le;
+    prgline_t *l;
+    long n, i, off, end;
+    int sorted = 1;
+
+    n = prg_linkchain(load, sp, len, &end);
+    if ((l = malloc(((n >= 0 ? n : len / 5) + 1) * sizeof(prgline_t))) == NULL)
+	return -1;
+
+    for (i = 0, off = 0; off >= 0 && len - off >= 4; ++i) {
+	if ((sp[off] | sp[off + 1]) == 0)
+		break;
+	le = memchr(sp + off + 4, 0, len - off - 4);
+	l[i].number = sp[off + 2] | (sp[off + 3] << 8);
+	l[i].off = off;
+	l[i].len = (le != NULL ? le : sp + len) - (sp + off + 4);
+	if (i > 0 && l[i].number < l[i - 1].number)
+		sorted = 0;
+	if (le == NULL)
+		off = -1;
+	else if (n >= 0)
+		off = (sp[off] | (sp[off + 1] << 8)) - load;
+	else
+		off = le + 1 - sp;
+    }
+    if (!sorted)
+	qsort(l, i, sizeof(prgline_t), linecmp);
+    *lines = l;
+
+    return i;
+}
+
+
+/*
+ * find the lines from first to last in an index of n lines
+ * returns the place of the first of them, *count how many there are
+ */
+long
+prg_linerange(const prgline_t *lines, long n, long first, long last,
+	      long *count)
+{
+    long lo = 0, hi = n, mid, start;
+
+    while (lo < hi) {
+	mid = lo + (hi - lo) / 2;
+	if ((long)lines[mid].number < first)
+		lo = mid + 1;
+	else
+		hi = mid;
+    }
+    start = lo;
+    for (hi = n; lo < hi; ) {
+	mid = lo + (hi - lo) / 2;
+	if ((long)lines[mid].number <= last)
+		lo = mid + 1;
+	else
+		hi = mid;
+    }
+    *count = lo - start;
+
+    return start;
+}
+
+
+/*
+ * the text of the token at sp, moving sp past it
+ */
+static const char *
+token(const dialect_t *d, const unsigned char **sp, const unsigned char *le,
+      int *len)
+{
+    int c = *(*sp)++;
+
+    if (d->ptext[c] != NULL && *sp < le) {
+	*len = d->plen[c][**sp];
+	return d->ptext[c][*(*sp)++];
+    }
+    *len = d->len[c];
+    return d->text[c];
+}
+
+
+/*
+ * exact length of a line of text, for when we cannot just reserve the
+ * worst case because the output buffer is caller memory
+ */
+static size_t
+textlen(const dialect_t *d, const unsigned char *sp, const unsigned char *le,
+	int charset)
+{
+    const unsigned char *plen = petscii_len[charset];
+    size_t n = 8;
+    int quoted = 0, rem = 0;
+    int c, len;
+
+    while (sp < le) {
+	if (*sp == '"' && !rem)
+		quoted = !quoted;
+	if (quoted || rem || (*sp < 0x80 && *sp != d->stop)) {
+		n += plen[*sp++];
+		continue;
+	}
+	c = *sp;
+	(void)token(d, &sp, le, &len);
+	n += len;
+	rem = c == TOKEN_REM && charset != CHARSET_RAW;
+    }
+
+    return n;
+}
+
+
+/*
+ * length of the run of bytes from sp that are copied as they are: up to
+ * the next quote, or outside quotes also the next token; stop is a prefix
+ * byte below 0x80 that also starts a token, or -1; with a charset other
+ * than CHARSET_RAW, also up to the next byte that is written some other way
+ *
+ * Most of a program is plain text, so this looks at 32 (AVX2) or 16 (SSE2)
+ * bytes at a time and leaves only the tail of a line to the byte loop. The
+ * vector test for charsets may stop early, at '|', '}', '~' or ']', which
+ * the caller then writes as they are.
+ */
+static size_t
+litrun(const unsigned char *sp, const unsigned char *le, int quoted, int stop,
+       int charset)
+{
+    const unsigned char *plain = petscii_plain[charset];
+    const unsigned char *p = sp;
+
+#if defined(__AVX2__)
+    const __m256i q = _mm256_set1_epi8('"');
+    const __m256i s = _mm256_set1_epi8((char)stop);
+    const __m256i ctl = _mm256_set1_epi8(0x20);
+    const __m256i brace = _mm256_set1_epi8('{' - 1);
+    const __m256i arrows = _mm256_set1_epi8(0x5c);
+    const __m256i fc = _mm256_set1_epi8((char)0xfc);
+    unsigned int mask;
+    __m256i v;
+
+    for (; le - p >= 32; p += 32) {
+	v = _mm256_loadu_si256((const __m256i *)p);
+	mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, q));
+	if (!quoted || charset != CHARSET_RAW) {
+		mask |= _mm256_movemask_epi8(v);	// the high bits
+		if (stop >= 0 && !quoted)
+			mask |= _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, s));
+	}
+	if (charset != CHARSET_RAW) {
+		/* control codes, and '{' to 0x7f */
+		mask |= _mm256_movemask_epi8(_mm256_or_si256(
+			_mm256_cmpgt_epi8(ctl, v),
+			_mm256_cmpgt_epi8(v, brace)));
+		if (charset == CHARSET_UTF8)	// 0x5c to 0x5f
+			mask |= _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+				_mm256_and_si256(v, fc), arrows));
+	}
+	if (mask)
+		return p - sp + __builtin_ctz(mask);
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128i q = _mm_set1_epi8('"');
+    const __m128i s = _mm_set1_epi8((char)stop);
+    const __m128i ctl = _mm_set1_epi8(0x20);
+    const __m128i brace = _mm_set1_epi8('{' - 1);
+    const __m128i arrows = _mm_set1_epi8(0x5c);
+    const __m128i fc = _mm_set1_epi8((char)0xfc);
+    unsigned int mask;
+    unsigned long bit;
+    __m128i v;
+
+    for (; le - p >= 16; p += 16) {
+	v = _mm_loadu_si128((const __m128i *)p);
+	mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, q));
+	if (!quoted || charset != CHARSET_RAW) {
+		mask |= _mm_movemask_epi8(v);		// the high bits
+		if (stop >= 0 && !quoted)
+			mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(v, s));
+	}
+	if (charset != CHARSET_RAW) {
+		/* control codes, and '{' to 0x7f */
+		mask |= _mm_movemask_epi8(_mm_or_si128(_mm_cmpgt_epi8(ctl, v),
+						       _mm_cmpgt_epi8(v, brace)));
+		if (charset == CHARSET_UTF8)	// 0x5c to 0x5f
+			mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(
+				_mm_and_si128(v, fc), arrows));
+	}
+	if (mask) {
+# ifdef _MSC_VER
+		_BitScanForward(&bit, mask);
+# else
+		bit = __builtin_ctz(mask);
+# endif
+		return p - sp + bit;
+	}
+    }
+#endif
+
+    for (; p < le; ++p) {
+	if (*p == '"' || (!quoted && (*p >= 0x80 || *p == stop)) ||
+	    !plain[*p])
+		break;
+    }
+
+    return p - sp;
+}
+
+
+/*
+ * list one line of a program, its text from sp to le, appended to out
+ * without a newline
+ * returns 0, or -1 if out is full
+ */
+static int
+listline(const dialect_t *d, long line, const unsigned char *sp,
+	 const unsigned char *le, int maxlen, outbuf_t *out,
+	 const prgopts_t *opts)
+{
+    const char *const *ptext = petscii_text[opts->charset];
+    const unsigned char *plen = petscii_len[opts->charset];
+    const char *tp;
+    size_t n;
+    char *dp, *lp;
+    int quoted, rem;
+    int tl;
+
+    /* Reserve for the worst case, every byte the longest token. */
+    if (outbuf_reserve(out, (le - sp) * maxlen + 8) < 0 &&
+	outbuf_reserve(out, textlen(d, sp, le, opts->charset)) < 0)
+	return -1;
+    lp = &out->buf[out->len];
+    dp = putnum(lp, line);
+
+    /*
+     * Copy whole runs of text, stopping only for quotes and tokens, and
+     * for bytes that need a code in the charset. When writing codes, the
+     * rest of a REM is taken as it is, so that it comes back the same.
+     */
+    quoted = rem = 0;
+    while (sp < le) {
+	n = litrun(sp, le, quoted || rem, d->stop, opts->charset);
+	memcpy(dp, sp, n);
+	dp += n;
+	sp += n;
+	if (sp == le)
+		break;
+
+	if (*sp == '"' && !rem) {
+		quoted = !quoted;
+		*dp++ = *sp++;
+		continue;
+	}
+	if (quoted || rem || (*sp < 0x80 && *sp != d->stop)) {
+		memcpy(dp, ptext[*sp], plen[*sp]);
+		dp += plen[*sp++];
+		continue;
+	}
+#ifdef _DEBUG
+	if (opts->debug)
+		fprintf(stderr, "TOKEN{0x%02x}", *sp);
+#endif
+	rem = *sp == TOKEN_REM && opts->charset != CHARSET_RAW;
+	tp = token(d, &sp, le, &tl);
+	if (tp != NULL) {
+		memcpy(dp, tp, tl);
+		dp += tl;
+	} else
+		*dp++ = sp[-1];		// a prefix with nothing after it
+    }
+    if (opts->invertcase)
+	petscii_swapcase(lp, dp - lp);
+    out->len = dp - out->buf;
+
+    return 0;
+}
+
+
+/*
+ * list the lines from opts->firstline to opts->lastline in the order of
+ * their numbers, looking them up in an index of the lines so that only
+ * those are converted
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+static int
+listrange(long load, const unsigned char *sp, long len, int maxlen,
+	  outbuf_t *out, const prgopts_t *opts, diag_t *diag)
+{
+    const dialect_t *d = &dialects[opts->dialect];
+    const unsigned char *lp;
+    prgline_t *lines;
+    long n, i, k, count;
+
+    if ((n = prg_lineindex(load, sp, len, &lines)) < 0)
+	return diag_error(diag, "out of memory");
+
+    i = prg_linerange(lines, n, opts->firstline, opts->lastline, &count);
+    for (k = i; k < i + count; ++k) {
+	lp = sp + lines[k].off + 4;
+	if (listline(d, lines[k].number, lp, lp + lines[k].len, maxlen,
+		     out, opts) < 0) {
+		free(lines);
+		return outbuf_full(out, diag);
+	}
+	out->buf[out->len++] = '\n';
+    }
+    free(lines);
+
+    if (count > 0)
+	return 0;
+    if (opts->firstline == opts->lastline)
+	return diag_error(diag, "no line %ld", opts->firstline);
+    return diag_error(diag, "no lines from %ld to %ld", opts->firstline,
+		      opts->lastline);
+}
+
+
+/*
+ * convert a program in memory to BASIC text, appended to out; the load
+ * address comes separately, as it does in a tape archive
+ * returns 0 on success, -1 on error (reason in diag->error)
+ *
+ * The lines are listed in the order of their link pointers, as LIST does,
+ * so they need not be stored in order. If the pointers lead astray, as
+ * they do in some hand-made files, the lines are listed as they are
+ * stored instead.
+ */
+int
+prg2bas_image(long load, const unsigned char *sp, long len, outbuf_t *out,
+	      const prgopts_t *opts, diag_t *diag)
+{
+    const dialect_t *d = &dialects[opts->dialect];
+    const unsigned char *start = sp;
+    const unsigned char *ep = sp + len;
+    const unsigned char *le;
+    long addr, line, end;
+    int chain;
+    int maxlen;
+
+    diag_info(diag, "Load address: 0x%04lx\n", load);
+
+    maxlen = d->maxlen;
+    if (opts->charset != CHARSET_RAW && petscii_maxlen > maxlen)
+	maxlen = petscii_maxlen;
+
+    /* What is loaded after the 0000 is usually machine code. */
+    chain = prg_linkchain(load, sp, len, &end) >= 0;
+    if (chain && end < len)
+	diag_info(diag, "%ld bytes after the program at 0x%04lx, machine code?\n",
+		  len - end, load + end);
+
+    if (opts->range)
+	return listrange(load, sp, len, maxlen, out, opts, diag);
+
+    /* Get next line address and line number. */
+    while (ep - sp >= 4) {
+	addr = sp[0] | (sp[1] << 8);
+	if (addr == 0)
+		break;
+	line = sp[2] | (sp[3] << 8);
+
+	/* A line cut off by the end of the file ends the listing. */
+	le = memchr(sp + 4, 0, ep - sp - 4);
+	if (le == NULL)
+		le = ep;
+
+	if (listline(d, line, sp + 4, le, maxlen, out, opts) < 0)
+		return outbuf_full(out, diag);
+	if (le == ep)
+		break;
+	out->buf[out->len++] = '\n';
+	sp = chain ? start + addr - load : le + 1;
+    }
+
+    return 0;
+}
+
+
+/*
+ * convert a PRG file in memory with one of the prg2bas_image() family,
+ * unpacking it first if it was packed by bas2prg
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+prgimage_buf(const unsigned char *prg, long len, outbuf_t *out,
+	     prgimage_fn conv, const prgopts_t *opts, diag_t *diag)
+{
+    outbuf_t unpacked;
+    int ret;
+
+    /* Get load address. */
+    if (len < 2)
+	return diag_error(diag, "no load address");
+    if (!prg_ispacked(prg, len))
+	return conv(prg[0] | (prg[1] << 8), prg + 2, len - 2, out, opts,
+		    diag);
+
+    memset(&unpacked, 0, sizeof(unpacked));
+    ret = prg_unpack(prg, len, &unpacked, diag);
+    if (ret == 0) {
+	prg = (unsigned char *)unpacked.buf;
+	ret = conv(prg[0] | (prg[1] << 8), prg + 2, unpacked.len - 2, out,
+		   opts, diag);
+    }
+    outbuf_free(&unpacked);
+
+    return ret;
+}
+
+
+/*
+ * convert a PRG file in memory to BASIC text, appended to out
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+prg2bas_buf(const unsigned char *prg, long len, outbuf_t *out,
+	    const prgopts_t *opts, diag_t *diag)
+{
+    return prgimage_buf(prg, len, out, prg2bas_image, opts, diag);
+}
+
+
+/*
+ * convert a PRG file with one of the prg2bas_image() family
+ * The whole file is read with one call and written with another. A
+ * program packed by bas2prg is unpacked first.
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+prgimage_file(FILE *fi, FILE *fo, prgimage_fn conv, const prgopts_t *opts,
+	      diag_t *diag)
+{
+    unsigned char *prg;
+    outbuf_t out, unpacked;
+    long len;
+    int ret;
+
+    if ((prg = malloc(MAXPRGLEN)) == NULL)
+	return diag_error(diag, "out of memory");
+    memset(&out, 0, sizeof(out));
+    memset(&unpacked, 0, sizeof(unpacked));
+
+    /* Let fread() and fwrite() go straight to the files, we have our own
+     * buffers and there is no need to copy everything twice. */
+    setvbuf(fi, NULL, _IONBF, 0);
+    setvbuf(fo, NULL, _IONBF, 0);
+    metrics_mark(diag->metrics);
+    len = readall(fi, prg, MAXPRGLEN);
+    if (len < 0)
+	ret = diag_error(diag, "read error");
+    else if (len < 2)
+	ret = diag_error(diag, "no load address");
+    else {
+	metrics_time(diag->metrics, TIME_READ);
+	ret = 0;
+	if (prg_ispacked(prg, len)) {
+		ret = prg_unpack(prg, len, &unpacked, diag);
+		if (ret == 0 && unpacked.len <= MAXPRGLEN) {
+			memcpy(prg, unpacked.buf, unpacked.len);
+			len = unpacked.len;
+		}
+		outbuf_free(&unpacked);
+	}
+	if (ret == 0)
+		ret = conv(prg[0] | (prg[1] << 8), prg + 2, len - 2, &out,
+			   opts, diag);
+	metrics_time(diag->metrics, TIME_CONVERT);
+    }
+
+    if (out.len > 0 && fwrite(out.buf, 1, out.len, fo) != out.len)
+	ret = diag_error(diag, "write error");
+
+    if (diag->metrics != NULL) {
+	metrics_time(diag->metrics, TIME_WRITE);
+	diag->metrics->bytesin = len > 0 ? len : 0;
+	diag->metrics->bytesout = out.len;
+	if (len > 2)
+		metrics_count(diag->metrics, prg + 2, len - 2);
+    }
+
+    outbuf_free(&out);
+    free(prg);
+
+    return ret;
+}
+
+
+/*
+ * convert a PRG file to a BASIC text file
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+prg2bas_file(FILE *fi, FILE *fo, const prgopts_t *opts, diag_t *diag)
+{
+    return prgimage_file(fi, fo, prg2bas_image, opts, diag);
+}
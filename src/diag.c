@@ -0,0 +1,128 @@
+/*
+ * diag.c, warnings and errors for a single conversion.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "prgtools.h"
+
+
+void
+diag_init(diag_t *d, FILE *fp, const char *name)
+{
+    memset(d, 0, sizeof(*d));
+    d->fp = fp;
+    d->name = name;
+    d->verbose = 1;
+    d->line = -1;
+}
+
+
+/*
+ * print one message as a single stdio call, so messages from different
+ * threads do not get mixed up; or add it to the log
+ */
+static void
+diag_print(diag_t *d, const char *fmt, va_list ap)
+{
+    char buf[256];
+    int n = 0;
+
+    if (d->name != NULL)
+	n = snprintf(buf, sizeof(buf), "%s: ", d->name);
+    if (n < 0 || n >= sizeof(buf))
+	n = 0;
+    vsnprintf(&buf[n], sizeof(buf) - n, fmt, ap);
+    if (d->log == NULL)
+	fputs(buf, d->fp);
+    else if (outbuf_reserve(d->log, strlen(buf)) == 0) {
+	memcpy(&d->log->buf[d->log->len], buf, strlen(buf));
+	d->log->len += strlen(buf);
+    }
+}
+
+
+void
+diag_info(diag_t *d, const char *fmt, ...)
+{
+    va_list ap;
+
+    if ((d->fp == NULL && d->log == NULL) || !d->verbose)
+	return;
+
+    va_start(ap, fmt);
+    diag_print(d, fmt, ap);
+    va_end(ap);
+}
+
+
+/*
+ * keep a warning with the line it is for, without the newline
+ */
+static void
+diag_record(diag_t *d, const char *fmt, va_list ap)
+{
+    outbuf_t *o = &d->metrics->warnings;
+    char buf[256];
+    int n;
+
+    n = snprintf(buf, sizeof(buf), "%ld\t", d->line);
+    vsnprintf(&buf[n], sizeof(buf) - n, fmt, ap);
+    n = strcspn(buf, "\n");
+    if (outbuf_reserve(o, n + 1) == 0) {
+	memcpy(&o->buf[o->len], buf, n);
+	o->buf[o->len + n] = '\n';
+	o->len += n + 1;
+    }
+}
+
+
+void
+diag_warn(diag_t *d, const char *fmt, ...)
+{
+    va_list ap;
+
+    d->warnings++;
+    if (d->metrics != NULL) {
+	va_start(ap, fmt);
+	diag_record(d, fmt, ap);
+	va_end(ap);
+    }
+    if (d->fp == NULL && d->log == NULL)
+	return;
+
+    va_start(ap, fmt);
+    diag_print(d, fmt, ap);
+    va_end(ap);
+}
+
+
+/*
+ * record why a conversion failed, returns -1 for convenience
+ */
+int
+diag_error(diag_t *d, const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    vsnprintf(d->error, sizeof(d->error), fmt, ap);
+    va_end(ap);
+
+    return -1;
+}
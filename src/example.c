@@ -0,0 +1,84 @@
+/*
+ * example.c, how to use libprgtools from another program.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include "prgtools.h"
+
+
+#define ARENASIZE	(4L << 20)
+
+
+/*
+ * List every PRG file given on the command line, converting them all with
+ * a single call into one block of memory.
+ */
+int
+main(int argc, char **argv)
+{
+    prgopts_t opts;
+    prgjob_t *jobs;
+    outbuf_t *in;
+    char *arena;
+    FILE *fp;
+    int i, n;
+
+    if (argc < 2) {
+	fprintf(stderr, "Usage: example file.prg ...\n");
+	return 1;
+    }
+    n = argc - 1;
+
+    jobs = calloc(n, sizeof(prgjob_t));
+    in = calloc(n, sizeof(outbuf_t));
+    arena = malloc(ARENASIZE);
+    if (jobs == NULL || in == NULL || arena == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	return 2;
+    }
+
+    for (i = 0; i < n; ++i) {
+	if ((fp = fopen(argv[i + 1], "rb")) == NULL ||
+	    readfile(fp, &in[i]) < 0) {
+		fprintf(stderr, "Unable to read '%s'\n", argv[i + 1]);
+		return 3;
+	}
+	fclose(fp);
+	jobs[i].in = in[i].buf;
+	jobs[i].inlen = in[i].len;
+    }
+
+    tokens_init();
+    prgopts_init(&opts);
+    prgtools_batch(PRG_PRG2BAS, jobs, n, arena, ARENASIZE, &opts);
+
+    for (i = 0; i < n; ++i) {
+	printf("--- %s\n", argv[i + 1]);
+	if (jobs[i].status == 0)
+		fwrite(jobs[i].out, 1, jobs[i].outlen, stdout);
+	else
+		printf("error: %s\n", jobs[i].error);
+	outbuf_free(&in[i]);
+    }
+
+    free(arena);
+    free(in);
+    free(jobs);
+
+    return 0;
+}
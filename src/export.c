@@ -0,0 +1,278 @@
+/*
+ * export.c, convert a C64 PRG file into a stream of typed tokens, as JSON
+ * lines, for programs that analyze BASIC.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "tokens.h"
+#include "prgtools.h"
+
+
+#define TOKEN_PLUS	0xaa		// in an exponent: 1E+3
+#define TOKEN_MINUS	0xab
+
+#define ISDIGIT(c)	((c) >= '0' && (c) <= '9')
+#define ISALPHA(c)	((c) >= 'A' && (c) <= 'Z')
+
+
+/*
+ * start an item of the token stream: a comma unless it is the first, the
+ * bracket and the type
+ */
+static int
+item(outbuf_t *o, const char *type)
+{
+    size_t n = strlen(type);
+    char *dp;
+
+    if (outbuf_reserve(o, n + 5) < 0)
+	return -1;
+    dp = &o->buf[o->len];
+    if (dp[-1] != '[')
+	*dp++ = ',';
+    *dp++ = '[';
+    *dp++ = '"';
+    memcpy(dp, type, n);
+    dp += n;
+    *dp++ = '"';
+    *dp++ = ',';
+    o->len = dp - o->buf;
+
+    return 0;
+}
+
+
+/*
+ * an item that is a type and some text
+ */
+static int
+textitem(outbuf_t *o, const char *type, const unsigned char *s, size_t n)
+{
+    if (item(o, type) < 0 || outbuf_jsonstr(o, (const char *)s, n) < 0 ||
+	outbuf_reserve(o, 1) < 0)
+	return -1;
+    o->buf[o->len++] = ']';
+
+    return 0;
+}
+
+
+/*
+ * the length of a number at sp: digits, a point, more digits and an
+ * exponent, whose sign has been tokenized
+ */
+static size_t
+numlen(const unsigned char *sp, const unsigned char *le)
+{
+    const unsigned char *p = sp;
+
+    while (p < le && (ISDIGIT(*p) || *p == '.'))
+	p++;
+    if (p + 1 < le && *p == 'E' &&
+	(ISDIGIT(p[1]) || p[1] == TOKEN_PLUS || p[1] == TOKEN_MINUS)) {
+	for (p += 2; p < le && ISDIGIT(*p); ++p)
+		;
+    }
+
+    return p - sp;
+}
+
+
+/*
+ * the type of item that starts at sp, or NULL for a byte that goes in a
+ * run of raw bytes
+ */
+static const char *
+kind(const dialect_t *d, const unsigned char *sp, const unsigned char *le)
+{
+    int c = *sp;
+
+    if (c == '"')
+	return "str";
+    if (c >= 0x80 || c == d->stop) {
+	if (d->ptext[c] != NULL)
+		return sp + 1 < le ? "kw" : NULL;
+	return d->text[c] != NULL ? "kw" : NULL;
+    }
+    if (ISDIGIT(c) || (c == '.' && sp + 1 < le && ISDIGIT(sp[1])))
+	return "num";
+    if (ISALPHA(c))
+	return "var";
+
+    return NULL;
+}
+
+
+/*
+ * write one line of a program as a JSON object, with its tokens as an
+ * array of [type, ...] items
+ * returns 0, or -1 if the output is full
+ */
+static int
+jsonline(const dialect_t *d, long link, long line, const unsigned char *sp,
+	 const unsigned char *le, outbuf_t *o)
+{
+    const unsigned char *p;
+    const char *type, *text;
+    char num[64];
+    size_t n, i;
+    int c, tok;
+
+    if (outbuf_printf(o, "{\"link\":%ld,\"line\":%ld,\"tokens\":[",
+		      link, line) < 0)
+	return -1;
+
+    while (sp < le) {
+	type = kind(d, sp, le);
+
+	if (type == NULL) {
+		for (p = sp + 1; p < le && kind(d, p, le) == NULL; ++p)
+			;
+		if (textitem(o, "raw", sp, p - sp) < 0)
+			return -1;
+		sp = p;
+	} else if (*type == 's') {
+		/* a string, which the end of the line may close */
+		p = memchr(sp + 1, '"', le - sp - 1);
+		n = (p != NULL ? p : le) - sp - 1;
+		if (item(o, "str") < 0 ||
+		    outbuf_jsonstr(o, (const char *)sp + 1, n) < 0 ||
+		    outbuf_printf(o, p != NULL ? "]" : ",\"unclosed\"]") < 0)
+			return -1;
+		sp = p != NULL ? p + 1 : le;
+	} else if (*type == 'n') {
+		n = numlen(sp, le);
+		if (n > sizeof(num))
+			n = sizeof(num);
+		for (i = 0; i < n; ++i) {
+			c = sp[i];
+			num[i] = c == TOKEN_PLUS ? '+' :
+				 c == TOKEN_MINUS ? '-' : c;
+		}
+		if (textitem(o, "num", (unsigned char *)num, n) < 0)
+			return -1;
+		sp += n;
+	} else if (*type == 'v') {
+		for (p = sp + 1; p < le && (ISALPHA(*p) || ISDIGIT(*p)); ++p)
+			;
+		if (p < le && (*p == '$' || *p == '%'))
+			p++;
+		if (textitem(o, "var", sp, p - sp) < 0)
+			return -1;
+		sp = p;
+	} else {
+		/* a keyword, with the prefix of a two-byte token in the
+		 * high byte of its number */
+		c = *sp++;
+		tok = c;
+		if (d->ptext[c] != NULL) {
+			tok = (c << 8) | *sp;
+			text = d->ptext[c][*sp++];
+		} else
+			text = d->text[c];
+		if (item(o, "kw") < 0 || outbuf_printf(o, "%d,", tok) < 0 ||
+		    outbuf_jsonstr(o, text, strlen(text)) < 0 ||
+		    outbuf_printf(o, "]") < 0)
+			return -1;
+
+		/* the rest of a REM, and the items of a DATA up to the next
+		 * statement, are text as they are */
+		if (tok == TOKEN_REM) {
+			if (sp < le && textitem(o, "rem", sp, le - sp) < 0)
+				return -1;
+			sp = le;
+		} else if (tok == TOKEN_DATA) {
+			for (p = sp, c = 0; p < le && (c || *p != ':'); ++p)
+				c ^= *p == '"';
+			if (p > sp && textitem(o, "data", sp, p - sp) < 0)
+				return -1;
+			sp = p;
+		}
+	}
+    }
+
+    return outbuf_printf(o, "]}\n");
+}
+
+
+/*
+ * convert a program in memory to JSON lines, appended to out: one object
+ * with the load address, then one for each line with its link pointer,
+ * line number and tokens. Keywords are ["kw", number, text], and strings
+ * ("str", without the quotes), numbers ("num", as written), variables
+ * ("var", with any $ or %), the rest of a REM ("rem"), the items of a
+ * DATA ("data") and anything else ("raw") are a type and the PETSCII
+ * bytes.
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+prg2json_image(long load, const unsigned char *sp, long len, outbuf_t *out,
+	       const prgopts_t *opts, diag_t *diag)
+{
+    const dialect_t *d = &dialects[opts->dialect];
+    const unsigned char *ep = sp + len;
+    const unsigned char *le;
+    long addr, line;
+
+    if (outbuf_printf(out, "{\"load\":%ld}\n", load) < 0)
+	return outbuf_full(out, diag);
+
+    while (ep - sp >= 4) {
+	addr = sp[0] | (sp[1] << 8);
+	if (addr == 0)
+		break;
+	line = sp[2] | (sp[3] << 8);
+	sp += 4;
+
+	/* A line cut off by the end of the file ends the program. */
+	le = memchr(sp, 0, ep - sp);
+	if (le == NULL)
+		le = ep;
+	if (jsonline(d, addr, line, sp, le, out) < 0)
+		return outbuf_full(out, diag);
+	if (le == ep)
+		break;
+	sp = le + 1;
+    }
+
+    return 0;
+}
+
+
+/*
+ * convert a PRG file in memory to JSON lines, appended to out
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+prg2json_buf(const unsigned char *prg, long len, outbuf_t *out,
+	     const prgopts_t *opts, diag_t *diag)
+{
+    return prgimage_buf(prg, len, out, prg2json_image, opts, diag);
+}
+
+
+/*
+ * convert a PRG file to JSON lines
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+prg2json_file(FILE *fi, FILE *fo, const prgopts_t *opts, diag_t *diag)
+{
+    return prgimage_file(fi, fo, prg2json_image, opts, diag);
+}
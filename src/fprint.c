@@ -0,0 +1,769 @@
+/*
+ * fprint.c, fingerprints of tokenized programs that survive renumbering
+ * and reformatting, and an index of them for finding duplicates.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "tokens.h"
+#include "prgtools.h"
+
+
+/*
+ * A program is read as a stream of units, 32-bit numbers for what BASIC
+ * sees rather than how it was typed:
+ *
+ *	0..ff		a byte that stands for itself, outside strings
+ *	1xxxx		a keyword, with the prefix of a two-byte token
+ *	20000		the start of a line
+ *	3xxxx		a line number after GOTO, GOSUB, THEN or RUN, as the
+ *			place of that line in the program
+ *	8xxxxxxx	a hash of a string, the text of a REM, a number or
+ *			a variable name
+ *
+ * Link pointers, line numbers and spaces outside strings and REMs are
+ * left out, so a program that was renumbered or had its spaces crunched
+ * reads the same.
+ */
+#define U_KEYWORD	0x10000
+#define U_LINE		0x20000
+#define U_TARGET	0x30000
+#define U_HASH		0x80000000u
+
+#define TOK_GOTO	0x89
+#define TOK_RUN		0x8a
+#define TOK_GOSUB	0x8d
+#define TOK_TO		0xa4
+#define TOK_THEN	0xa7
+#define TOK_GO		0xcb
+
+#define ISDIGIT(c)	((c) >= '0' && (c) <= '9')
+#define ISALPHA(c)	((c) >= 'A' && (c) <= 'Z')
+
+#define FNV_BASIS	0xcbf29ce484222325ULL
+#define FNV_PRIME	0x100000001b3ULL
+
+/*
+ * The index file, all numbers little endian:
+ *	0-7	magic
+ *	8-11	number of programs
+ *	12-15	offset of the table by exact fingerprint
+ *	16-19	offset of the band tables
+ *	20-23	offset of the names
+ * then a record of FPI_RECLEN bytes for each program (exact fingerprint,
+ * MinHash values, lines, offset of its name), the exact fingerprints
+ * with record numbers sorted, FP_NBANDS tables of band hashes with record
+ * numbers sorted, and the names, each with a nul.
+ */
+#define FPI_MAGIC	"PRGFPI01"
+#define FPI_MAGICLEN	8
+#define FPI_HEADLEN	24
+#define FPI_RECLEN	(8 + 4 * FP_NMIN + 4 + 4)
+#define FPI_EXACTLEN	12
+#define FPI_BANDLEN	8
+#define FP_ROWS		(FP_NMIN / FP_NBANDS)
+#define FP_EMPTY	0xffffffffu	// a MinHash value no shingle came to
+
+#define LONG(p)		((unsigned long)(p)[0] | ((unsigned long)(p)[1] << 8) | \
+			 ((unsigned long)(p)[2] << 16) | \
+			 ((unsigned long)(p)[3] << 24))
+
+struct fpindex {
+    const unsigned char *data;
+    long	size;
+    long	count;
+    const unsigned char *recs;
+    const unsigned char *exact;
+    const unsigned char *bands;
+    const char	*names;
+    long	namelen;
+};
+
+
+/* 32-bit FNV-1a over some bytes, seeded with what kind of text they are */
+static unsigned int
+fnv32(int kind, const unsigned char *sp, size_t n)
+{
+    unsigned int h = 2166136261u;
+
+    h = (h ^ kind) * 16777619u;
+    while (n-- > 0)
+	h = (h ^ *sp++) * 16777619u;
+
+    return h | U_HASH;
+}
+
+
+/* mixes the bits of a shingle, so that each hash below is as good as any */
+static unsigned long long
+mix64(unsigned long long h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return h;
+}
+
+
+/* the units of a program being fingerprinted */
+typedef struct {
+    prgfp_t	*fp;
+    unsigned long long exact;
+    unsigned int ring[FP_NGRAM];	// the last units, for shingles
+    long	n;			// units so far
+} fpstate_t;
+
+
+/*
+ * take one shingle, the last FP_NGRAM units, into the MinHash: one hash,
+ * whose top bits pick the value it may lower, stands in for FP_NMIN
+ * hashes of their own
+ */
+static void
+shingle(fpstate_t *st)
+{
+    unsigned long long h = 0;
+    unsigned int v;
+    int i;
+
+    for (i = 0; i < FP_NGRAM; ++i)
+	h = (h + st->ring[(st->n + i) % FP_NGRAM]) * FNV_PRIME;
+    h = mix64(h);
+    i = (unsigned int)(h >> 32) % FP_NMIN;
+    v = (unsigned int)h;
+    if (v < st->fp->minhash[i])
+	st->fp->minhash[i] = v;
+}
+
+
+/*
+ * fill the values no shingle came to from the next one that has a
+ * value, so that small programs compare as well
+ */
+static void
+densify(prgfp_t *fp)
+{
+    unsigned int v[FP_NMIN];
+    int i, k;
+
+    memcpy(v, fp->minhash, sizeof(v));
+    for (i = 0; i < FP_NMIN; ++i) {
+	for (k = 1; k < FP_NMIN && v[i] == FP_EMPTY; ++k) {
+		if (v[(i + k) % FP_NMIN] != FP_EMPTY) {
+			fp->minhash[i] = v[(i + k) % FP_NMIN] + k;
+			break;
+		}
+	}
+    }
+}
+
+
+static void
+unit(fpstate_t *st, unsigned int u)
+{
+    int i;
+
+    for (i = 0; i < 4; ++i)
+	st->exact = (st->exact ^ ((u >> (8 * i)) & 255)) * FNV_PRIME;
+    st->ring[st->n % FP_NGRAM] = u;
+    st->n++;
+    if (st->n >= FP_NGRAM)
+	shingle(st);
+}
+
+
+static int
+numcmp(const void *a, const void *b)
+{
+    long x = *(const long *)a, y = *(const long *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+
+/*
+ * the unit for a line number that is jumped to: the place of the line in
+ * the program, which renumbering keeps
+ */
+static unsigned int
+target(const long *nums, long nlines, long n)
+{
+    const long *p = bsearch(&n, nums, nlines, sizeof(long), numcmp);
+    unsigned char b[3];
+
+    if (p == NULL) {
+	b[0] = n & 255;
+	b[1] = (n >> 8) & 255;
+	b[2] = (n >> 16) & 255;
+	return fnv32('#', b, sizeof(b));
+    }
+
+    return U_TARGET | (unsigned int)(p - nums);
+}
+
+
+/*
+ * read the units of one line into u, which has room for one for each
+ * byte; line numbers after jumps become the place of the line among nums,
+ * or stay numbers if nums is NULL
+ * returns the number of units
+ */
+static long
+lineunits(const dialect_t *d, const long *nums, long nlines,
+	  const unsigned char *sp, const unsigned char *le, unsigned int *u)
+{
+    unsigned int *start = u;
+    const unsigned char *p;
+    unsigned char num[32];
+    int c, k, jump = 0, prev = 0;
+    long n;
+
+    while (sp < le) {
+	c = *sp;
+	if (c == ' ') {
+		sp++;
+		continue;
+	}
+
+	if (c == '"') {
+		p = memchr(sp + 1, '"', le - sp - 1);
+		if (p == NULL)
+			p = le;
+		*u++ = fnv32('"', sp + 1, p - sp - 1);
+		sp = p < le ? p + 1 : le;
+		jump = 0;
+	} else if ((c >= 0x80 || c == d->stop) &&
+		   (d->ptext[c] != NULL ? sp + 1 < le : d->text[c] != NULL)) {
+		if (d->ptext[c] != NULL) {
+			*u++ = U_KEYWORD | (c << 8) | sp[1];
+			sp += 2;
+			jump = 0;
+		} else {
+			*u++ = U_KEYWORD | c;
+			sp++;
+			jump = c == TOK_GOTO || c == TOK_GOSUB ||
+			       c == TOK_THEN || c == TOK_RUN ||
+			       (c == TOK_TO && prev == TOK_GO);
+		}
+		prev = c;
+		if (c == TOKEN_REM) {
+			if (sp < le)
+				*u++ = fnv32('R', sp, le - sp);
+			break;
+		}
+		continue;
+	} else if (ISDIGIT(c) || c == '.') {
+		/* BASIC skips spaces in numbers too */
+		for (p = sp, n = k = 0; p < le && (ISDIGIT(*p) || *p == '.' ||
+						  *p == ' '); ++p) {
+			if (*p == ' ')
+				continue;
+			if (k < (int)sizeof(num))
+				num[k++] = *p;
+			if (ISDIGIT(*p) && n < 65536)
+				n = n * 10 + *p - '0';
+		}
+		if (jump && nums != NULL && memchr(num, '.', k) == NULL)
+			*u++ = target(nums, nlines, n);
+		else
+			*u++ = fnv32('0', num, k);
+		sp = p;
+		jump = jump && sp < le && *sp == ',';
+	} else if (ISALPHA(c)) {
+		for (p = sp + 1; p < le && (ISALPHA(*p) || ISDIGIT(*p)); ++p)
+			;
+		if (p < le && (*p == '$' || *p == '%'))
+			p++;
+		*u++ = fnv32('A', sp, p - sp);
+		sp = p;
+		jump = 0;
+	} else {
+		*u++ = c;
+		sp++;
+		jump = jump && c == ',';
+	}
+	prev = 0;
+    }
+
+    return u - start;
+}
+
+
+/*
+ * the units of one line of a program, with line numbers as numbers
+ * returns the number of units, at most one for each byte
+ */
+long
+prg_lineunits(const unsigned char *sp, const unsigned char *le, int dialect,
+	      unsigned int *u)
+{
+    return lineunits(&dialects[dialect], NULL, 0, sp, le, u);
+}
+
+
+/*
+ * fingerprint a program in memory, without its load address: a hash of
+ * its units for exact matches and a MinHash of the FP_NGRAM-grams of them
+ * for near ones, where the share of equal values estimates how much of
+ * the programs is the same
+ * returns 0, or -1 if out of memory
+ */
+int
+prg_fingerprint(const unsigned char *sp, long len, int dialect, prgfp_t *fp)
+{
+    const dialect_t *d = &dialects[dialect];
+    const unsigned char *ep = sp + len;
+    const unsigned char *p, *le;
+    fpstate_t st;
+    unsigned int *u;
+    long *nums, nlines = 0, i, k, n;
+    int sorted = 1;
+
+    memset(fp, 0, sizeof(*fp));
+    for (i = 0; i < FP_NMIN; ++i)
+	fp->minhash[i] = FP_EMPTY;
+    memset(&st, 0, sizeof(st));
+    st.fp = fp;
+    st.exact = FNV_BASIS;
+
+    /* The line numbers first, so that jumps can name lines by place. */
+    nums = malloc((len / 5 + 1) * sizeof(long));
+    u = malloc((len + 1) * sizeof(unsigned int));
+    if (nums == NULL || u == NULL) {
+	free(nums);
+	free(u);
+	return -1;
+    }
+    for (p = sp; ep - p >= 4 && (p[0] | p[1]) != 0; p = le + 1) {
+	nums[nlines] = p[2] | (p[3] << 8);
+	if (nlines > 0 && nums[nlines] <= nums[nlines - 1])
+		sorted = 0;
+	nlines++;
+	if ((le = memchr(p + 4, 0, ep - p - 4)) == NULL)
+		break;
+    }
+    if (!sorted)
+	qsort(nums, nlines, sizeof(long), numcmp);
+
+    for (p = sp, i = 0; i < nlines; ++i, p = le + 1) {
+	if ((le = memchr(p + 4, 0, ep - p - 4)) == NULL)
+		le = ep;
+	unit(&st, U_LINE);
+	n = lineunits(d, nums, nlines, p + 4, le, u);
+	for (k = 0; k < n; ++k)
+		unit(&st, u[k]);
+    }
+    free(nums);
+    free(u);
+
+    /* A program too short for one shingle still gets one. */
+    if (st.n > 0 && st.n < FP_NGRAM) {
+	for (i = st.n; i < FP_NGRAM; ++i)
+		st.ring[i] = 0;
+	st.n = 0;
+	shingle(&st);
+	st.n = i;
+    }
+
+    densify(fp);
+    fp->exact = st.exact;
+    fp->lines = nlines;
+    fp->units = st.n;
+
+    return 0;
+}
+
+
+/*
+ * estimate the share of two programs that is the same, from 0 to 1
+ */
+double
+fp_similarity(const prgfp_t *a, const prgfp_t *b)
+{
+    int i, same = 0;
+
+    for (i = 0; i < FP_NMIN; ++i)
+	same += a->minhash[i] == b->minhash[i];
+
+    return (double)same / FP_NMIN;
+}
+
+
+/* the hash of one band of a MinHash, for finding candidates */
+static unsigned int
+band(const unsigned int *minhash, int b)
+{
+    unsigned long long h = b + 1;
+    int i;
+
+    for (i = 0; i < FP_ROWS; ++i)
+	h = mix64(h ^ minhash[b * FP_ROWS + i]);
+
+    return (unsigned int)h;
+}
+
+
+static void
+put32(unsigned char *p, unsigned long v)
+{
+    p[0] = v & 255;
+    p[1] = (v >> 8) & 255;
+    p[2] = (v >> 16) & 255;
+    p[3] = (v >> 24) & 255;
+}
+
+
+static void
+put64(unsigned char *p, unsigned long long v)
+{
+    put32(p, (unsigned long)(v & 0xffffffffUL));
+    put32(p + 4, (unsigned long)(v >> 32));
+}
+
+
+static unsigned long long
+get64(const unsigned char *p)
+{
+    return LONG(p) | ((unsigned long long)LONG(p + 4) << 32);
+}
+
+
+/* the entries of the tables compare as their first 8 or 4 bytes, then
+ * by record, which keeps the order of the records among equals */
+static int
+exactcmp(const void *a, const void *b)
+{
+    unsigned long long x = get64(a), y = get64(b);
+    unsigned long i, j;
+
+    if (x != y)
+	return x < y ? -1 : 1;
+    i = LONG((const unsigned char *)a + 8);
+    j = LONG((const unsigned char *)b + 8);
+
+    return i < j ? -1 : i > j;
+}
+
+
+static int
+bandcmp(const void *a, const void *b)
+{
+    unsigned long x = LONG((const unsigned char *)a);
+    unsigned long y = LONG((const unsigned char *)b);
+
+    if (x != y)
+	return x < y ? -1 : 1;
+    x = LONG((const unsigned char *)a + 4);
+    y = LONG((const unsigned char *)b + 4);
+
+    return x < y ? -1 : x > y;
+}
+
+
+/*
+ * write an index of count fingerprints and the names of their programs,
+ * to a new file first so that a failed write leaves the old index alone
+ * returns 0 on success, -1 on error
+ */
+int
+fpindex_write(const char *path, char *const *names, const prgfp_t *fps,
+	      long count)
+{
+    unsigned char *buf, *rp, *xp, *bp;
+    long recs, exact, bands, namesat, size, off, i;
+    char *tmp;
+    FILE *fp;
+    int b, k, ret = 0;
+
+    recs = FPI_HEADLEN;
+    exact = recs + count * FPI_RECLEN;
+    bands = exact + count * FPI_EXACTLEN;
+    namesat = bands + (long)FP_NBANDS * count * FPI_BANDLEN;
+    for (size = namesat, i = 0; i < count; ++i)
+	size += strlen(names[i]) + 1;
+    if (size > 0x7fffffffL || (buf = malloc(size)) == NULL)
+	return -1;
+
+    memcpy(buf, FPI_MAGIC, FPI_MAGICLEN);
+    put32(buf + 8, count);
+    put32(buf + 12, exact);
+    put32(buf + 16, bands);
+    put32(buf + 20, namesat);
+
+    for (off = 0, i = 0; i < count; ++i) {
+	rp = buf + recs + i * FPI_RECLEN;
+	put64(rp, fps[i].exact);
+	for (k = 0; k < FP_NMIN; ++k)
+		put32(rp + 8 + 4 * k, fps[i].minhash[k]);
+	put32(rp + 8 + 4 * FP_NMIN, fps[i].lines);
+	put32(rp + 12 + 4 * FP_NMIN, off);
+	strcpy((char *)buf + namesat + off, names[i]);
+	off += strlen(names[i]) + 1;
+
+	xp = buf + exact + i * FPI_EXACTLEN;
+	put64(xp, fps[i].exact);
+	put32(xp + 8, i);
+	for (b = 0; b < FP_NBANDS; ++b) {
+		bp = buf + bands + ((long)b * count + i) * FPI_BANDLEN;
+		put32(bp, band(fps[i].minhash, b));
+		put32(bp + 4, i);
+	}
+    }
+    qsort(buf + exact, count, FPI_EXACTLEN, exactcmp);
+    for (b = 0; b < FP_NBANDS; ++b)
+	qsort(buf + bands + (long)b * count * FPI_BANDLEN, count, FPI_BANDLEN,
+	      bandcmp);
+
+    if ((tmp = malloc(strlen(path) + 5)) == NULL) {
+	free(buf);
+	return -1;
+    }
+    sprintf(tmp, "%s.new", path);
+    if ((fp = fopen(tmp, "wb")) == NULL)
+	ret = -1;
+    else {
+	if (fwrite(buf, 1, size, fp) != (size_t)size)
+		ret = -1;
+	if (fclose(fp) != 0)
+		ret = -1;
+#ifdef _WIN32
+	/* rename() does not replace files here */
+	if (ret == 0)
+		remove(path);
+#endif
+	if (ret != 0 || rename(tmp, path) != 0) {
+		remove(tmp);
+		ret = -1;
+	}
+    }
+    free(tmp);
+    free(buf);
+
+    return ret;
+}
+
+
+/*
+ * open an index; it is mapped rather than read, so that a query only
+ * touches the pages it needs
+ * returns the index, or NULL if it cannot be read or is not an index
+ */
+fpindex_t *
+fpindex_open(const char *path)
+{
+    fpindex_t *x;
+    unsigned long recs, exact, bands, names;
+
+    if ((x = calloc(1, sizeof(*x))) == NULL)
+	return NULL;
+    if ((x->data = mapfile(path, &x->size)) == NULL) {
+	free(x);
+	return NULL;
+    }
+
+    if (x->size < FPI_HEADLEN || memcmp(x->data, FPI_MAGIC, FPI_MAGICLEN))
+	goto bad;
+    x->count = LONG(x->data + 8);
+    exact = LONG(x->data + 12);
+    bands = LONG(x->data + 16);
+    names = LONG(x->data + 20);
+    recs = FPI_HEADLEN;
+    if (exact != recs + (unsigned long)x->count * FPI_RECLEN ||
+	bands != exact + (unsigned long)x->count * FPI_EXACTLEN ||
+	names != bands + (unsigned long)x->count * FP_NBANDS * FPI_BANDLEN ||
+	names > (unsigned long)x->size ||
+	(x->count > 0 && x->data[x->size - 1] != '\0'))
+	goto bad;
+    x->recs = x->data + recs;
+    x->exact = x->data + exact;
+    x->bands = x->data + bands;
+    x->names = (const char *)x->data + names;
+    x->namelen = x->size - names;
+
+    return x;
+
+bad:
+    unmapfile(x->data, x->size);
+    free(x);
+    return NULL;
+}
+
+
+long
+fpindex_count(const fpindex_t *x)
+{
+    return x->count;
+}
+
+
+/*
+ * the name and fingerprint of program i of an index
+ */
+const char *
+fpindex_get(const fpindex_t *x, long i, prgfp_t *fp)
+{
+    const unsigned char *rp = x->recs + i * FPI_RECLEN;
+    unsigned long off = LONG(rp + 12 + 4 * FP_NMIN);
+    int k;
+
+    if (fp != NULL) {
+	memset(fp, 0, sizeof(*fp));
+	fp->exact = get64(rp);
+	for (k = 0; k < FP_NMIN; ++k)
+		fp->minhash[k] = LONG(rp + 8 + 4 * k);
+	fp->lines = LONG(rp + 8 + 4 * FP_NMIN);
+    }
+
+    return off < (unsigned long)x->namelen ? x->names + off : "";
+}
+
+
+static int
+indexcmp(const void *a, const void *b)
+{
+    const fpmatch_t *x = a, *y = b;
+
+    return x->index < y->index ? -1 : x->index > y->index;
+}
+
+
+static int
+matchcmp(const void *a, const void *b)
+{
+    const fpmatch_t *x = a, *y = b;
+
+    if (x->similarity != y->similarity)
+	return x->similarity > y->similarity ? -1 : 1;
+    return indexcmp(a, b);
+}
+
+
+static int
+candidate(fpmatch_t **m, long *n, long *size, long rec, double sim, int exact)
+{
+    fpmatch_t *p;
+
+    if (*n == *size) {
+	*size = *size ? 2 * *size : 16;
+	if ((p = realloc(*m, *size * sizeof(fpmatch_t))) == NULL)
+		return -1;
+	*m = p;
+    }
+    (*m)[*n].index = rec;
+    (*m)[*n].similarity = sim;
+    (*m)[*n].exact = exact;
+    (*n)++;
+
+    return 0;
+}
+
+
+/*
+ * find the programs in an index that are the same as fp, or at least
+ * the given share of it: the exact fingerprint is looked up in its table,
+ * and programs that share a whole band of the MinHash are the candidates
+ * for near matches. They come most similar first, in *matches, to be
+ * freed by the caller.
+ * returns the number of matches, or -1 if out of memory
+ */
+long
+fpindex_find(const fpindex_t *x, const prgfp_t *fp, double threshold,
+	     fpmatch_t **matches)
+{
+    fpmatch_t *m = NULL;
+    const unsigned char *tab, *ep;
+    unsigned char key[FPI_EXACTLEN];
+    prgfp_t other;
+    long n = 0, size = 0, lo, hi, mid, rec, i, j;
+    double sim;
+    int b;
+
+    *matches = NULL;
+
+    /* the first entry not below the key, then all that equal it */
+    put64(key, fp->exact);
+    put32(key + 8, 0);
+    for (lo = 0, hi = x->count; lo < hi; ) {
+	mid = lo + (hi - lo) / 2;
+	if (exactcmp(x->exact + mid * FPI_EXACTLEN, key) < 0)
+		lo = mid + 1;
+	else
+		hi = mid;
+    }
+    for (tab = x->exact + lo * FPI_EXACTLEN, ep = x->exact + x->count *
+	 FPI_EXACTLEN; tab < ep && get64(tab) == fp->exact; tab += FPI_EXACTLEN) {
+	if (candidate(&m, &n, &size, LONG(tab + 8), 1.0, 1) < 0)
+		goto oom;
+    }
+
+    for (b = 0; b < FP_NBANDS; ++b) {
+	tab = x->bands + (long)b * x->count * FPI_BANDLEN;
+	put32(key, band(fp->minhash, b));
+	put32(key + 4, 0);
+	for (lo = 0, hi = x->count; lo < hi; ) {
+		mid = lo + (hi - lo) / 2;
+		if (bandcmp(tab + mid * FPI_BANDLEN, key) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	for (; lo < x->count && LONG(tab + lo * FPI_BANDLEN) == LONG(key);
+	     ++lo) {
+		rec = LONG(tab + lo * FPI_BANDLEN + 4);
+		fpindex_get(x, rec, &other);
+		sim = fp_similarity(fp, &other);
+		if (sim >= threshold &&
+		    candidate(&m, &n, &size, rec, sim, 0) < 0)
+			goto oom;
+	}
+    }
+
+    /* A program can be found in several bands and by its exact
+     * fingerprint; keep it once. */
+    if (n > 1)
+	qsort(m, n, sizeof(fpmatch_t), indexcmp);
+    for (i = j = 0; i < n; ++i) {
+	if (j > 0 && m[j - 1].index == m[i].index)
+		m[j - 1].exact |= m[i].exact;
+	else
+		m[j++] = m[i];
+    }
+    n = j;
+    if (n > 1)
+	qsort(m, n, sizeof(fpmatch_t), matchcmp);
+    *matches = m;
+
+    return n;
+
+oom:
+    free(m);
+    return -1;
+}
+
+
+void
+fpindex_close(fpindex_t *x)
+{
+    if (x == NULL)
+	return;
+    unmapfile(x->data, x->size);
+    free(x);
+}
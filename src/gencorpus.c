@@ -0,0 +1,411 @@
+/*
+ * gencorpus.c, generate a corpus of random but realistic BASIC programs.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+#ifdef _WIN32
+# include <direct.h>
+# define mkdir(p, m)	_mkdir(p)
+#else
+# include <sys/stat.h>
+#endif
+
+
+#define MAXLEN		78		// keep lines on two screen rows
+#define MAXPRG		(0x9800 - 0x0801)	// BASIC RAM, less 2K for variables
+
+
+static unsigned long seed = 1;
+
+
+/*
+ * our own generator, so the corpus is the same everywhere
+ */
+static int
+rnd(int n)
+{
+    seed = (seed * 1103515245 + 12345) & 0xffffffffUL;
+    return (int)((seed >> 16) & 0x7fff) % n;
+}
+
+
+static const char *stmts[] = {
+    "PRINT", "POKE", "IF", "FOR", "NEXT", "GOTO", "GOSUB", "RETURN",
+    "INPUT", "GET", "LET", "DIM", "READ", "ON", "SYS", "WAIT", "CLR",
+    "OPEN", "CLOSE", "PRINT#", "INPUT#", "GET#"
+};
+
+static const char *funcs[] = {
+    "INT(", "RND(", "PEEK(", "ABS(", "SGN(", "SQR(", "SIN(", "COS(",
+    "FRE(", "POS("
+};
+
+static const char *strfuncs[] = {	// numbers of strings
+    "LEN(", "VAL(", "ASC("
+};
+
+static const char *sfuncs[] = {
+    "CHR$(", "STR$(", "LEFT$(", "RIGHT$(", "MID$("
+};
+
+/* Words are spaced, so that a variable before them cannot make another
+ * keyword, like T and OR making TO. */
+static const char *ops[] = {
+    "+", "-", "*", "/", " AND ", " OR ", "=", "<", ">", "<>", "<=", ">="
+};
+
+/* Two-letter names that are keywords or reserved variables. */
+static const char *badnames[] = {
+    "FN", "GO", "IF", "ON", "OR", "TO", "ST", "TI"
+};
+
+#define COUNT(a)	(sizeof(a) / sizeof(*(a)))
+
+
+static int curline;		// the number of the line being made
+
+
+static char *
+put(char *dp, const char *s)
+{
+    while (*s)
+	*dp++ = *s++;
+    return dp;
+}
+
+
+static char *
+putvar(char *dp)
+{
+    size_t i;
+
+    dp[0] = 'A' + rnd(26);
+    if (rnd(3) != 0)
+	return dp + 1;
+    dp[1] = rnd(2) ? 'A' + rnd(26) : '0' + rnd(10);
+    for (i = 0; i < COUNT(badnames); ++i) {
+	if (dp[0] == badnames[i][0] && dp[1] == badnames[i][1])
+		return dp + 1;
+    }
+    return dp + 2;
+}
+
+
+static char *
+putsvar(char *dp)
+{
+    dp = putvar(dp);
+    *dp++ = '$';
+    return dp;
+}
+
+
+static char *
+putnum(char *dp)
+{
+    switch (rnd(4)) {
+	case 0:
+		return dp + sprintf(dp, "%d", rnd(10));
+	case 1:
+		return dp + sprintf(dp, "%d", rnd(256));
+	case 2:
+		return dp + sprintf(dp, "%d", 49152 + rnd(4096));
+	default:
+		return dp + sprintf(dp, "%d.%d", rnd(100), rnd(1000));
+    }
+}
+
+
+/*
+ * a line to jump to: one up to this, which is there however many lines
+ * the program ends up with
+ */
+static char *
+puttarget(char *dp)
+{
+    return dp + sprintf(dp, "%d", 10 * (1 + rnd(curline)));
+}
+
+
+static char *
+putstring(char *dp, int len)
+{
+    static const char chars[] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZ     0123456789.,!?-*";
+
+    *dp++ = '"';
+    while (len-- > 0)
+	*dp++ = chars[rnd(sizeof(chars) - 1)];
+    *dp++ = '"';
+    return dp;
+}
+
+
+static char *putexpr(char *dp, int depth);
+
+static char *
+putsexpr(char *dp, int depth)
+{
+    const char *f;
+
+    if (depth > 0 && rnd(3) == 0) {
+	f = sfuncs[rnd(COUNT(sfuncs))];
+	dp = put(dp, f);
+	if (f[0] == 'C' || f[0] == 'S')		// CHR$, STR$
+		dp = putexpr(dp, depth - 1);
+	else {
+		dp = putsexpr(dp, depth - 1);
+		*dp++ = ',';
+		dp = putexpr(dp, depth - 1);
+		if (f[0] == 'M' && rnd(2)) {
+			*dp++ = ',';
+			dp = putexpr(dp, depth - 1);
+		}
+	}
+	*dp++ = ')';
+    } else if (rnd(2))
+	dp = putsvar(dp);
+    else
+	dp = putstring(dp, rnd(10));
+
+    if (depth > 0 && rnd(3) == 0) {
+	*dp++ = '+';
+	dp = putsexpr(dp, depth - 1);
+    }
+
+    return dp;
+}
+
+
+static char *
+putexpr(char *dp, int depth)
+{
+    if (depth > 0 && rnd(6) == 0) {
+	dp = put(dp, strfuncs[rnd(COUNT(strfuncs))]);
+	dp = putsexpr(dp, depth - 1);
+	*dp++ = ')';
+    } else if (depth > 0 && rnd(3) == 0) {
+	dp = put(dp, funcs[rnd(COUNT(funcs))]);
+	dp = putexpr(dp, depth - 1);
+	*dp++ = ')';
+    } else if (rnd(2))
+	dp = putvar(dp);
+    else
+	dp = putnum(dp);
+
+    if (depth > 0 && rnd(2)) {
+	dp = put(dp, ops[rnd(COUNT(ops))]);
+	dp = putexpr(dp, depth - 1);
+    }
+
+    return dp;
+}
+
+
+/*
+ * one line of code, mostly keywords and expressions; statements after
+ * the first are separated by colons
+ */
+static char *
+code(char *dp, char *ep)
+{
+    const char *s;
+
+    do {
+	if (*(dp - 1) != ' ')
+		*dp++ = ':';
+	s = stmts[rnd(COUNT(stmts))];
+	dp = put(dp, s);
+	if (!strcmp(s, "PRINT")) {
+		if (rnd(2))
+			dp = putstring(dp, rnd(20));
+		else
+			dp = putsexpr(dp, 1);
+		*dp++ = ';';
+		dp = putexpr(dp, 2);
+	} else if (!strcmp(s, "IF")) {
+		dp = putexpr(dp, 2);
+		dp = put(dp, " THEN ");
+		dp = puttarget(dp);
+	} else if (!strcmp(s, "FOR")) {
+		dp = putvar(dp);
+		dp = put(dp, "=1 TO ");
+		dp = putexpr(dp, 1);
+		if (rnd(2))
+			dp = put(dp, " STEP 2");
+	} else if (!strcmp(s, "NEXT")) {
+		if (rnd(2))
+			dp = putvar(dp);
+	} else if (!strcmp(s, "GOTO") || !strcmp(s, "GOSUB")) {
+		dp = puttarget(dp);
+	} else if (!strcmp(s, "ON")) {
+		dp = putexpr(dp, 1);
+		dp = put(dp, rnd(2) ? " GOTO " : " GOSUB ");
+		dp = puttarget(dp);
+		*dp++ = ',';
+		dp = puttarget(dp);
+	} else if (!strcmp(s, "POKE") || !strcmp(s, "WAIT")) {
+		dp = putnum(dp);
+		*dp++ = ',';
+		dp = putexpr(dp, 1);
+	} else if (!strcmp(s, "LET")) {
+		if (rnd(2))
+			*dp++ = ' ';
+		if (rnd(3) == 0) {
+			dp = putsvar(dp);
+			*dp++ = '=';
+			dp = putsexpr(dp, 1);
+		} else {
+			dp = putvar(dp);
+			*dp++ = '=';
+			dp = putexpr(dp, 1);
+		}
+	} else if (!strcmp(s, "DIM")) {
+		dp = putvar(dp);
+		dp += sprintf(dp, "(%d)", 1 + rnd(50));
+	} else if (!strcmp(s, "GET")) {
+		dp = putsvar(dp);
+	} else if (!strcmp(s, "INPUT") || !strcmp(s, "READ")) {
+		if (rnd(2))
+			*dp++ = ' ';
+		dp = rnd(3) ? putvar(dp) : putsvar(dp);
+	} else if (!strcmp(s, "SYS")) {
+		dp = putnum(dp);
+	} else if (!strcmp(s, "OPEN")) {
+		dp += sprintf(dp, "%d,%d,%d", 1 + rnd(15), 8, 15);
+	} else if (!strcmp(s, "CLOSE")) {
+		dp += sprintf(dp, "%d", 1 + rnd(15));
+	} else if (!strcmp(s, "PRINT#")) {
+		dp += sprintf(dp, "%d,", 1 + rnd(15));
+		dp = putexpr(dp, 1);
+	} else if (!strcmp(s, "INPUT#")) {
+		dp += sprintf(dp, "%d,", 1 + rnd(15));
+		dp = putvar(dp);
+	} else if (!strcmp(s, "GET#")) {
+		dp += sprintf(dp, "%d,", 1 + rnd(15));
+		dp = putsvar(dp);
+	}
+    } while (dp < ep - 30 && rnd(3));
+
+    return dp;
+}
+
+
+static char *
+line(char *dp, int style)
+{
+    char *start = dp;
+    int n;
+
+    switch (style) {
+	case 0:		/* REM-heavy */
+		dp = put(dp, rnd(2) ? "REM " : "REM *** ");
+		n = 10 + rnd(50);
+		while (n-- > 0)
+			*dp++ = "ABCDEFGHIJKLMNOPQRSTUVWXYZ  -*="[rnd(31)];
+		break;
+
+	case 1:		/* DATA blocks */
+		dp = put(dp, "DATA ");
+		n = 6 + rnd(12);
+		while (n-- > 0)
+			dp += sprintf(dp, "%d%s", rnd(256), n ? "," : "");
+		break;
+
+	case 2:		/* long strings */
+		dp = put(dp, "PRINT");
+		dp = putstring(dp, 30 + rnd(MAXLEN - 45));
+		break;
+
+	default:	/* token-dense code */
+		dp = code(dp, start + MAXLEN);
+		break;
+    }
+
+    return dp;
+}
+
+
+int
+main(int argc, char **argv)
+{
+    char buf[256], path[1024];
+    int nfiles = 200, minlines = 100, maxlines = 1500;
+    int i, n, lines, style, mix;
+    long size;
+    char *dp, *sp;
+    FILE *fp;
+    int c;
+
+    opterr = 0;
+    while ((c = getopt(argc, argv, "l:n:s:")) != EOF) switch (c) {
+	case 'l':	// maximum-lines
+		maxlines = atoi(optarg);
+		if (maxlines < minlines)
+			minlines = maxlines;
+		break;
+
+	case 'n':	// number-of-files
+		nfiles = atoi(optarg);
+		break;
+
+	case 's':	// random-seed
+		seed = strtoul(optarg, NULL, 0);
+		break;
+
+	default:
+usage:
+		fprintf(stderr, "Usage: gencorpus [-n files] [-l lines] [-s seed] outdir\n");
+		exit(1);
+    }
+    if (optind + 1 != argc || maxlines < 1)
+	goto usage;
+
+    (void)mkdir(argv[optind], 0777);
+
+    for (i = 0; i < nfiles; ++i) {
+	sprintf(path, "%s/%05d.bas", argv[optind], i);
+	if ((fp = fopen(path, "w")) == NULL) {
+		fprintf(stderr, "Unable to create output '%s'\n", path);
+		return 2;
+	}
+
+	/* Each program leans towards one kind of line. */
+	mix = rnd(4);
+	lines = minlines + rnd(maxlines - minlines + 1);
+	for (n = 0, size = 2; n < lines; ++n) {
+		style = rnd(3) ? mix : rnd(4);
+		curline = n + 1;
+		sp = buf + sprintf(buf, "%d ", 10 * curline);
+		dp = line(sp, style);
+
+		/* Stop before the program could outgrow BASIC RAM: a line
+		 * takes at most its text and 5 bytes once tokenized. */
+		size += dp - sp + 5;
+		if (size > MAXPRG)
+			break;
+		*dp++ = '\n';
+		fwrite(buf, 1, dp - buf, fp);
+	}
+	fclose(fp);
+    }
+
+    return 0;
+}
@@ -0,0 +1,2607 @@
+/*
+ * interp.c, run a tokenized BASIC V2 program without a C64, and profile it.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <setjmp.h>
+#include "prgtools.h"
+#include "petscii.h"
+
+
+/* BASIC V2 tokens */
+#define T_END		0x80
+#define T_FOR		0x81
+#define T_NEXT		0x82
+#define T_DATA		0x83
+#define T_INPUTN	0x84
+#define T_INPUT		0x85
+#define T_DIM		0x86
+#define T_READ		0x87
+#define T_LET		0x88
+#define T_GOTO		0x89
+#define T_RUN		0x8a
+#define T_IF		0x8b
+#define T_RESTORE	0x8c
+#define T_GOSUB		0x8d
+#define T_RETURN	0x8e
+#define T_REM		0x8f
+#define T_STOP		0x90
+#define T_ON		0x91
+#define T_WAIT		0x92
+#define T_LOAD		0x93
+#define T_SAVE		0x94
+#define T_VERIFY	0x95
+#define T_DEF		0x96
+#define T_POKE		0x97
+#define T_PRINTN	0x98
+#define T_PRINT		0x99
+#define T_CONT		0x9a
+#define T_LIST		0x9b
+#define T_CLR		0x9c
+#define T_CMD		0x9d
+#define T_SYS		0x9e
+#define T_OPEN		0x9f
+#define T_CLOSE		0xa0
+#define T_GET		0xa1
+#define T_NEW		0xa2
+#define T_TAB		0xa3
+#define T_TO		0xa4
+#define T_FN		0xa5
+#define T_SPC		0xa6
+#define T_THEN		0xa7
+#define T_NOT		0xa8
+#define T_STEP		0xa9
+#define T_PLUS		0xaa
+#define T_MINUS		0xab
+#define T_MUL		0xac
+#define T_DIV		0xad
+#define T_POW		0xae
+#define T_AND		0xaf
+#define T_OR		0xb0
+#define T_GT		0xb1
+#define T_EQ		0xb2
+#define T_LT		0xb3
+#define T_SGN		0xb4
+#define T_INT		0xb5
+#define T_ABS		0xb6
+#define T_USR		0xb7
+#define T_FRE		0xb8
+#define T_POS		0xb9
+#define T_SQR		0xba
+#define T_RND		0xbb
+#define T_LOG		0xbc
+#define T_EXP		0xbd
+#define T_COS		0xbe
+#define T_SIN		0xbf
+#define T_TAN		0xc0
+#define T_ATN		0xc1
+#define T_PEEK		0xc2
+#define T_LEN		0xc3
+#define T_STR		0xc4
+#define T_VAL		0xc5
+#define T_ASC		0xc6
+#define T_CHR		0xc7
+#define T_LEFT		0xc8
+#define T_RIGHT		0xc9
+#define T_MID		0xca
+#define T_GO		0xcb
+#define T_PI		0xff
+
+#define CYCLES_JIFFY	(CYCLES_SECOND / 60)
+#define JIFFIES_DAY	5184000.0
+
+#define STACKROOM	200	// bytes of 6502 stack BASIC can use
+#define FORLEN		18	// a FOR on the stack
+#define GOSUBLEN	5	// a GOSUB on the stack
+#define MEMSIZ		0xa000	// top of BASIC RAM
+#define MAXVARS		(26 * 37 * 3)	// every name of every type
+#define HASHSIZE	4096
+#define MAXROOTS	64	// strings held while an expression is evaluated
+#define MAXDEPTH	100	// nested parentheses and functions
+#define MAXINPUT	88	// the input buffer
+
+#define ISDIGIT(c)	((c) >= '0' && (c) <= '9')
+#define ISLETTER(c)	((c) >= 'A' && (c) <= 'Z')
+
+/* errors, as the C64 names them */
+enum {
+    E_NONE, E_NEXT, E_SYNTAX, E_RETURN, E_DATA, E_QUANTITY, E_OVERFLOW,
+    E_MEMORY, E_UNDEF, E_SUBSCRIPT, E_REDIM, E_DIVZERO, E_TYPE, E_LONG,
+    E_COMPLEX, E_UNDEFFN,
+    /* the ways a run ends without an error */
+    E_END, E_BREAK,
+    /* and the reasons a run stops here that a C64 would not have */
+    E_UNSUPPORTED, E_NOINPUT, E_TIME, E_WAIT
+};
+
+static const char *const errors[] = {
+    "", "NEXT WITHOUT FOR", "SYNTAX", "RETURN WITHOUT GOSUB",
+    "OUT OF DATA", "ILLEGAL QUANTITY", "OVERFLOW", "OUT OF MEMORY",
+    "UNDEF'D STATEMENT", "BAD SUBSCRIPT", "REDIM'D ARRAY",
+    "DIVISION BY ZERO", "TYPE MISMATCH", "STRING TOO LONG",
+    "FORMULA TOO COMPLEX", "UNDEF'D FUNCTION"
+};
+
+#define TY_NUM		0
+#define TY_INT		1	// variables only
+#define TY_STR		2
+
+/* variables the ROM makes up */
+#define SP_ST		1
+#define SP_TI		2
+#define SP_TIS		3
+
+
+/* A string: its text is in the 64K memory, in the program or the heap. */
+typedef struct {
+    unsigned int addr;
+    int		len;
+} str_t;
+
+/* The value of an expression. */
+typedef struct {
+    int		type;		// TY_NUM or TY_STR
+    double	n;
+    str_t	s;
+    int		temp;		// s was made for this value and is not kept
+} val_t;
+
+typedef struct {
+    char	name[2];
+    int		type;
+    double	n;
+    str_t	s;
+} var_t;
+
+typedef struct {
+    char	name[2];
+    int		type;
+    int		ndims;
+    int		dims[255];	// highest subscript of each
+    long	size;		// elements
+    double	*n;
+    str_t	*s;
+} arr_t;
+
+typedef struct {
+    char	name[2];
+    int		param;		// the variable it takes
+    unsigned int body;		// its expression, after the '='
+} fn_t;
+
+/* FOR and GOSUB entries of the stack */
+typedef struct {
+    int		gosub;
+    int		var;		// FOR: the loop variable
+    double	limit, step;
+    unsigned int tp;		// where to go on
+    int		line;
+} frame_t;
+
+/* A place a value can be stored: a variable or an array element. */
+typedef struct {
+    int		type;
+    double	*n;
+    str_t	*s;
+    int		special;	// SP_*
+} lval_t;
+
+typedef struct {
+    unsigned char mem[65536];
+    unsigned int vartab;	// end of the program, start of variables
+    unsigned int strend;	// end of the arrays
+    unsigned int fretop;	// bottom of the string heap
+
+    long	(*lines)[2];	// line number and address of each line
+    int		nlines;
+    int		cur;		// index of the current line
+    unsigned int tp;		// text pointer
+    int		jumped;		// the statement went somewhere else
+
+    var_t	*vars;
+    int		nvars;
+    short	*hash;		// variables by name, -1 for free
+    arr_t	**arrs;
+    int		narrs;
+    fn_t	*fns;
+    int		nfns;
+    str_t	*roots[MAXROOTS];
+    int		nroots;
+    frame_t	stack[STACKROOM / GOSUBLEN];
+    int		nstack, stackused;
+    int		depth;
+
+    int		datline;	// READ: the line it is in
+    unsigned int datptr;	// and where, or 0 for the start
+    int		datready;	// datptr is at an item
+
+    unsigned char key[MAXINPUT + 2];	// the line of input being typed
+    int		nkeys, keypos;
+
+    int		col;		// output column
+    int		discard;	// PRINT#: the output goes nowhere
+    unsigned long seed;
+    double	tioff;		// jiffies added to the clock by TI$=
+
+    double	cycles, mark;
+    lineprof_t	*prof;
+    runprof_t	*rp;
+
+    const runopts_t *ro;
+    diag_t	*diag;
+    jmp_buf	err;
+    int		errnum;
+    int		errat;		// the line the error is in, if not cur
+    const char	*what;		// for E_UNSUPPORTED
+} interp_t;
+
+
+static void	expr(interp_t *ip, val_t *v);
+static void	notexpr(interp_t *ip, val_t *v);
+static void	statement(interp_t *ip, int c);
+static void	gc(interp_t *ip);
+
+
+/*
+ * stop the program with an error, or at its end
+ */
+static void
+fail(interp_t *ip, int e)
+{
+    ip->errnum = e;
+    longjmp(ip->err, 1);
+}
+
+
+static void
+unsupported(interp_t *ip, const char *what)
+{
+    ip->what = what;
+    fail(ip, E_UNSUPPORTED);
+}
+
+
+/*
+ * round to the 32-bit mantissa of a C64 float, failing with ?OVERFLOW
+ * beyond 1.70141183E+38; too small becomes 0
+ */
+static double
+fround(interp_t *ip, double x)
+{
+    double m;
+    int e;
+
+    if (x == 0)
+	return 0;
+    if (x != x || x - x != 0)
+	fail(ip, E_OVERFLOW);
+    m = frexp(fabs(x), &e);
+    m = floor(m * 4294967296.0 + 0.5) / 4294967296.0;
+    if (m >= 1.0) {
+	m /= 2;
+	e++;
+    }
+    if (e > 127)
+	fail(ip, E_OVERFLOW);
+    if (e < -127)
+	return 0;
+
+    return ldexp(x < 0 ? -m : m, e);
+}
+
+
+/* the current line number, or that of an error somewhere else */
+static long
+linenum(interp_t *ip)
+{
+    int i = ip->errat >= 0 ? ip->errat : ip->cur;
+
+    return i < ip->nlines ? ip->lines[i][0] : 0;
+}
+
+
+/*
+ * move the profile on to line i
+ */
+static void
+setline(interp_t *ip, int i)
+{
+    ip->prof[ip->cur].cycles += ip->cycles - ip->mark;
+    ip->mark = ip->cycles;
+    ip->cur = i;
+    ip->prof[i].hits++;
+}
+
+
+static void
+jump(interp_t *ip, int i)
+{
+    setline(ip, i);
+    ip->tp = ip->lines[i][1] + 4;
+    ip->jumped = 1;
+}
+
+
+/*
+ * find line n, searching from the current line if it comes later and from
+ * the start if not, like the ROM does
+ */
+static int
+findline(interp_t *ip, long n)
+{
+    int lo = 0, hi = ip->nlines, from, mid;
+
+    from = n > linenum(ip) ? ip->cur : 0;
+    while (lo < hi) {
+	mid = (lo + hi) / 2;
+	if (ip->lines[mid][0] < n)
+		lo = mid + 1;
+	else
+		hi = mid;
+    }
+    ip->cycles += C_LINESCAN * (lo - from + 1);
+    if (lo == ip->nlines || ip->lines[lo][0] != n)
+	fail(ip, E_UNDEF);
+
+    return lo;
+}
+
+
+/*
+ * program text
+ */
+static int
+peekc(interp_t *ip)
+{
+    while (ip->mem[ip->tp] == ' ') {
+	ip->tp++;
+	ip->cycles += C_CHRGET;
+    }
+
+    return ip->mem[ip->tp];
+}
+
+
+static int
+nextc(interp_t *ip)
+{
+    int c = peekc(ip);
+
+    if (c != 0) {
+	ip->tp++;
+	ip->cycles += C_CHRGET;
+    }
+
+    return c;
+}
+
+
+static int
+accept(interp_t *ip, int c)
+{
+    if (peekc(ip) != c)
+	return 0;
+    nextc(ip);
+
+    return 1;
+}
+
+
+static void
+expect(interp_t *ip, int c)
+{
+    if (!accept(ip, c))
+	fail(ip, E_SYNTAX);
+}
+
+
+static int
+endstmt(interp_t *ip)
+{
+    int c = peekc(ip);
+
+    return c == 0 || c == ':';
+}
+
+
+/*
+ * go on to the end of the statement, or of the line
+ */
+static void
+skipstmt(interp_t *ip, int line)
+{
+    unsigned int start = ip->tp;
+    int quoted = 0;
+    int c;
+
+    while ((c = ip->mem[ip->tp]) != 0) {
+	if (c == '"')
+		quoted = !quoted;
+	else if (c == ':' && !quoted && !line)
+		break;
+	ip->tp++;
+    }
+    ip->cycles += C_CHRGET * (ip->tp - start);
+}
+
+
+/*
+ * a line number after GOTO and the like; none is 0
+ */
+static long
+getline_(interp_t *ip)
+{
+    long n = 0;
+
+    while (ISDIGIT(peekc(ip))) {
+	n = n * 10 + nextc(ip) - '0';
+	if (n >= 64000)
+		fail(ip, E_SYNTAX);
+    }
+
+    return n;
+}
+
+
+/*
+ * numbers
+ */
+static int
+toint(interp_t *ip, double x, double lo, double hi)
+{
+    x = floor(x);
+    if (x < lo || x > hi)
+	fail(ip, E_QUANTITY);
+
+    return (int)x;
+}
+
+
+/*
+ * read a number in the C64's syntax from s: digits with a point and an
+ * exponent, spaces anywhere, signs possibly tokenized; *end is set past it
+ */
+static double
+fin(interp_t *ip, const unsigned char *s, const unsigned char *e,
+    const unsigned char **end)
+{
+    const unsigned char *t;
+    char buf[64];
+    int n = 0, m, point = 0, digits = 0;
+    int neg = 0;
+
+    while (s < e && *s == ' ')
+	++s;
+    if (s < e && (*s == '-' || *s == T_MINUS || *s == '+' || *s == T_PLUS)) {
+	neg = *s == '-' || *s == T_MINUS;
+	++s;
+    }
+    for (; s < e; ++s) {
+	if (*s == ' ')
+		continue;
+	if (ISDIGIT(*s)) {
+		if (n < 40)
+			buf[n++] = *s;
+		digits++;
+	} else if (*s == '.' && !point) {
+		if (n < 40)
+			buf[n++] = '.';
+		point = 1;
+	} else
+		break;
+    }
+    if (digits > 0 && s < e && *s == 'E') {
+	m = n;
+	buf[m++] = 'e';
+	for (t = s + 1; t < e && *t == ' '; ++t)
+		;
+	if (t < e && (*t == '-' || *t == T_MINUS))
+		buf[m++] = '-';
+	if (t < e && (*t == '-' || *t == T_MINUS || *t == '+' || *t == T_PLUS))
+		++t;
+	for (; t < e && (ISDIGIT(*t) || *t == ' '); ++t) {
+		if (*t != ' ' && m < 60)
+			buf[m++] = *t;
+	}
+	if (ISDIGIT(buf[m - 1])) {
+		n = m;
+		s = t;
+	}
+    }
+    buf[n] = '\0';
+    *end = s;
+    ip->cycles += C_DIGIT * (n - point + 1);
+
+    return fround(ip, neg ? -strtod(buf, NULL) : strtod(buf, NULL));
+}
+
+
+/*
+ * a number as PRINT and STR$ write it: a space or a minus, then up to nine
+ * digits, switching to an exponent outside 0.01 to 999999999
+ * returns its length
+ */
+static int
+numstr(double x, char *buf)
+{
+    char tmp[32], digits[16] = { 0 };
+    char *dp = buf;
+    int e, n, i;
+
+    *dp++ = x < 0 ? '-' : ' ';
+    if (x == 0) {
+	*dp++ = '0';
+	return dp - buf;
+    }
+    sprintf(tmp, "%.8e", fabs(x));
+    for (n = 0, i = 0; tmp[i] != 'e'; ++i) {
+	if (ISDIGIT(tmp[i]))
+		digits[n++] = tmp[i];
+    }
+    e = atoi(&tmp[i + 1]);
+    while (n > 1 && digits[n - 1] == '0')
+	n--;
+
+    if (e >= -2 && e < 9) {
+	if (e < 0) {
+		*dp++ = '.';
+		for (i = -1; i > e; --i)
+			*dp++ = '0';
+		for (i = 0; i < n; ++i)
+			*dp++ = digits[i];
+	} else {
+		for (i = 0; i <= e; ++i)
+			*dp++ = i < n ? digits[i] : '0';
+		if (n > e + 1) {
+			*dp++ = '.';
+			for (; i < n; ++i)
+				*dp++ = digits[i];
+		}
+	}
+    } else {
+	*dp++ = digits[0];
+	if (n > 1) {
+		*dp++ = '.';
+		for (i = 1; i < n; ++i)
+			*dp++ = digits[i];
+	}
+	dp += sprintf(dp, "E%c%02d", e < 0 ? '-' : '+', abs(e));
+    }
+
+    return dp - buf;
+}
+
+
+/*
+ * strings
+ */
+static void
+root(interp_t *ip, str_t *s)
+{
+    if (ip->nroots == MAXROOTS)
+	fail(ip, E_COMPLEX);
+    ip->roots[ip->nroots++] = s;
+}
+
+
+static void
+unroot(interp_t *ip)
+{
+    ip->nroots--;
+}
+
+
+/*
+ * room for a string of len bytes at the bottom of the heap, collecting
+ * garbage first if there is none
+ */
+static unsigned int
+stralloc(interp_t *ip, int len)
+{
+    ip->cycles += C_STRALLOC + C_STRBYTE * len;
+    if (len == 0)
+	return 0;
+    if (ip->fretop < ip->strend + len) {
+	gc(ip);
+	if (ip->fretop < ip->strend + len)
+		fail(ip, E_MEMORY);
+    }
+    ip->fretop -= len;
+
+    return ip->fretop;
+}
+
+
+/*
+ * a temporary string at the bottom of the heap is given back as soon as
+ * it has been used, like the ROM's FRETMS does
+ */
+static void
+release(interp_t *ip, const val_t *v)
+{
+    if (v->type == TY_STR && v->temp && v->s.len > 0 &&
+	v->s.addr == ip->fretop)
+	ip->fretop += v->s.len;
+}
+
+
+static void
+newstr(interp_t *ip, val_t *v, const unsigned char *text, int len)
+{
+    if (len > 255)
+	fail(ip, E_LONG);
+    v->type = TY_STR;
+    v->temp = 1;
+    v->s.len = len;
+    v->s.addr = stralloc(ip, len);
+    memcpy(&ip->mem[v->s.addr], text, len);
+}
+
+
+static int
+cmpdesc(const void *a, const void *b)
+{
+    unsigned int x = (*(str_t *const *)a)->addr;
+    unsigned int y = (*(str_t *const *)b)->addr;
+
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+
+/*
+ * move the strings still in use to the top of the heap. The ROM looks
+ * through every descriptor once for each string it moves, which is why
+ * this takes seconds on a C64 and is worth showing in the profile.
+ */
+static void
+gc(interp_t *ip)
+{
+    str_t **live;
+    unsigned int top = MEMSIZ, old = 0;
+    long ndesc = 0, nlive = 0, i, j;
+    double cycles;
+
+#define LIVE(sp)	((sp)->len > 0 && (sp)->addr >= ip->fretop && \
+			 (sp)->addr < MEMSIZ)
+    for (i = 0; i < ip->nvars; ++i)
+	ndesc += ip->vars[i].type == TY_STR;
+    for (i = 0; i < ip->narrs; ++i)
+	ndesc += ip->arrs[i]->type == TY_STR ? ip->arrs[i]->size : 0;
+    ndesc += ip->nroots;
+
+    if ((live = malloc((ndesc + 1) * sizeof(*live))) == NULL)
+	fail(ip, E_MEMORY);
+    for (i = 0; i < ip->nvars; ++i) {
+	if (ip->vars[i].type == TY_STR && LIVE(&ip->vars[i].s))
+		live[nlive++] = &ip->vars[i].s;
+    }
+    for (i = 0; i < ip->narrs; ++i) {
+	if (ip->arrs[i]->type != TY_STR)
+		continue;
+	for (j = 0; j < ip->arrs[i]->size; ++j) {
+		if (LIVE(&ip->arrs[i]->s[j]))
+			live[nlive++] = &ip->arrs[i]->s[j];
+	}
+    }
+    for (i = 0; i < ip->nroots; ++i) {
+	if (LIVE(ip->roots[i]))
+		live[nlive++] = ip->roots[i];
+    }
+#undef LIVE
+
+    /* Highest first, so each string moves up into room already free;
+     * descriptors sharing a string keep sharing it. */
+    qsort(live, nlive, sizeof(*live), cmpdesc);
+    for (i = 0; i < nlive; ++i) {
+	if (i > 0 && live[i]->addr == old) {
+		live[i]->addr = live[i - 1]->addr;
+		continue;
+	}
+	old = live[i]->addr;
+	top -= live[i]->len;
+	memmove(&ip->mem[top], &ip->mem[old], live[i]->len);
+	live[i]->addr = top;
+    }
+    free(live);
+    ip->fretop = top;
+
+    cycles = (double)C_GCSCAN * (nlive + 1) * (ndesc + 1);
+    ip->cycles += cycles;
+    ip->rp->gcs++;
+    ip->rp->gccycles += cycles;
+    ip->prof[ip->cur].gcs++;
+    diag_info(ip->diag, "Garbage collection in line %ld: %ld strings, %ld bytes free, %.0f cycles\n",
+	      linenum(ip), nlive, (long)(ip->fretop - ip->strend), cycles);
+}
+
+
+/*
+ * output
+ */
+static void
+out(interp_t *ip, int c)
+{
+    FILE *fp = ip->ro->out;
+
+    ip->cycles += C_CHROUT;
+    if (ip->discard)
+	return;
+    if (c == 13 || c == 0x8d || c == 0x93 || c == 0x13)
+	ip->col = 0;
+    else if (c == 0x9d) {
+	if (ip->col > 0)
+		ip->col--;
+    } else if ((c & 0x7f) >= 0x20 || c == 0x1d) {
+	if (++ip->col == 80)
+		ip->col = 0;
+    }
+
+    if (fp == NULL)
+	return;
+    if (c == 13 || c == 0x8d)
+	putc('\n', fp);
+    else
+	fwrite(petscii_text[ip->ro->charset][c], 1,
+	       petscii_len[ip->ro->charset][c], fp);
+}
+
+
+static void
+outs(interp_t *ip, const char *s, int len)
+{
+    while (len-- > 0)
+	out(ip, (unsigned char)*s++);
+}
+
+
+/*
+ * input: the lines of the script are typed one at a time, each ending
+ * with RETURN, and taken a key at a time
+ */
+static int
+key(interp_t *ip)
+{
+    char line[MAXLINELEN];
+    size_t n;
+
+    if (ip->keypos == ip->nkeys) {
+	if (ip->ro->in == NULL || fgets(line, sizeof(line), ip->ro->in) == NULL)
+		fail(ip, E_NOINPUT);
+	n = strlen(line);
+	if (n > 0 && line[n - 1] == '\n')
+		line[--n] = '\0';
+	if (n > 0 && line[n - 1] == '\r')
+		line[--n] = '\0';
+	if (ip->ro->charset != CHARSET_RAW)
+		n = petscii_decode(line, n, ip->ro->charset);
+	if (n > MAXINPUT)
+		n = MAXINPUT;
+	memcpy(ip->key, line, n);
+	ip->key[n++] = 13;
+	ip->nkeys = n;
+	ip->keypos = 0;
+    }
+
+    return ip->key[ip->keypos++];
+}
+
+
+/*
+ * variables
+ */
+static unsigned int
+hashname(const char *name, int type)
+{
+    return (((unsigned char)name[0] * 37 + (unsigned char)name[1]) * 3 +
+	    type) & (HASHSIZE - 1);
+}
+
+
+/*
+ * read a variable name: a letter, then letters and digits of which only
+ * the first counts, then $ or %
+ */
+static void
+varname(interp_t *ip, char *name, int *type)
+{
+    int c = peekc(ip);
+
+    if (!ISLETTER(c))
+	fail(ip, E_SYNTAX);
+    nextc(ip);
+    name[0] = c;
+    name[1] = 0;
+    for (;;) {
+	c = ip->mem[ip->tp];
+	if (!ISLETTER(c) && !ISDIGIT(c))
+		break;
+	if (name[1] == 0)
+		name[1] = c;
+	nextc(ip);
+    }
+    *type = TY_NUM;
+    if (ip->mem[ip->tp] == '$') {
+	*type = TY_STR;
+	nextc(ip);
+    } else if (ip->mem[ip->tp] == '%') {
+	*type = TY_INT;
+	nextc(ip);
+    }
+}
+
+
+/*
+ * find a simple variable, making it if it is new; the profile is charged
+ * for the linear search the ROM does, and for moving the arrays up
+ */
+static int
+findvar(interp_t *ip, const char *name, int type)
+{
+    unsigned int h = hashname(name, type);
+    var_t *v;
+    int i;
+
+    while ((i = ip->hash[h]) >= 0) {
+	v = &ip->vars[i];
+	if (v->name[0] == name[0] && v->name[1] == name[1] &&
+	    v->type == type) {
+		ip->cycles += C_VAR + C_VARSCAN * i;
+		return i;
+	}
+	h = (h + 1) & (HASHSIZE - 1);
+    }
+
+    ip->cycles += C_VAR + C_VARSCAN * ip->nvars +
+		  C_STRBYTE * (ip->strend - ip->vartab - 7 * ip->nvars);
+    if (ip->fretop < ip->strend + 7) {
+	gc(ip);
+	if (ip->fretop < ip->strend + 7)
+		fail(ip, E_MEMORY);
+    }
+    v = &ip->vars[ip->nvars];
+    memset(v, 0, sizeof(*v));
+    v->name[0] = name[0];
+    v->name[1] = name[1];
+    v->type = type;
+    ip->hash[h] = ip->nvars;
+    ip->strend += 7;
+
+    return ip->nvars++;
+}
+
+
+static arr_t *
+findarr(interp_t *ip, const char *name, int type)
+{
+    int i;
+
+    for (i = 0; i < ip->narrs; ++i) {
+	if (ip->arrs[i]->name[0] == name[0] &&
+	    ip->arrs[i]->name[1] == name[1] && ip->arrs[i]->type == type) {
+		ip->cycles += C_VAR + C_VARSCAN * i;
+		return ip->arrs[i];
+	}
+    }
+
+    return NULL;
+}
+
+
+static arr_t *
+newarr(interp_t *ip, const char *name, int type, int ndims, const int *dims)
+{
+    arr_t *a, **arrs;
+    long size = 1, bytes;
+    int i;
+
+    for (i = 0; i < ndims; ++i) {
+	size *= dims[i] + 1;
+	if (size > 65535)
+		fail(ip, E_MEMORY);
+    }
+    bytes = 5 + 2 * ndims + size * (type == TY_NUM ? 5 : type == TY_INT ? 2 : 3);
+    if (ip->fretop < ip->strend + bytes) {
+	gc(ip);
+	if (ip->fretop < ip->strend + bytes)
+		fail(ip, E_MEMORY);
+    }
+
+    if ((a = calloc(1, sizeof(*a))) == NULL)
+	fail(ip, E_MEMORY);
+    if ((arrs = realloc(ip->arrs, (ip->narrs + 1) * sizeof(*arrs))) == NULL) {
+	free(a);
+	fail(ip, E_MEMORY);
+    }
+    ip->arrs = arrs;
+    ip->arrs[ip->narrs++] = a;
+    a->name[0] = name[0];
+    a->name[1] = name[1];
+    a->type = type;
+    a->ndims = ndims;
+    memcpy(a->dims, dims, ndims * sizeof(int));
+    a->size = size;
+    if (type == TY_STR)
+	a->s = calloc(size, sizeof(str_t));
+    else
+	a->n = calloc(size, sizeof(double));
+    if (a->s == NULL && a->n == NULL)
+	fail(ip, E_MEMORY);
+    ip->strend += bytes;
+    ip->cycles += C_STRBYTE * bytes;
+
+    return a;
+}
+
+
+/*
+ * the subscripts after an array name, up to the ')'
+ * returns how many there are
+ */
+static int
+subscripts(interp_t *ip, int *subs)
+{
+    val_t v;
+    int n = 0;
+
+    do {
+	expr(ip, &v);
+	if (v.type != TY_NUM)
+		fail(ip, E_TYPE);
+	if (n == 255)
+		fail(ip, E_SYNTAX);
+	subs[n++] = toint(ip, v.n, 0, 32767);
+    } while (accept(ip, ','));
+    expect(ip, ')');
+
+    return n;
+}
+
+
+/*
+ * an element of an array, which is made with subscripts up to 10 if it is
+ * new
+ * returns its offset
+ */
+static long
+element(interp_t *ip, arr_t **ap, const char *name, int type)
+{
+    int subs[255], dims[255];
+    arr_t *a;
+    long off = 0;
+    int n, i;
+
+    n = subscripts(ip, subs);
+    if ((a = findarr(ip, name, type)) == NULL) {
+	for (i = 0; i < n; ++i)
+		dims[i] = 10;
+	a = newarr(ip, name, type, n, dims);
+    }
+    if (n != a->ndims)
+	fail(ip, E_SUBSCRIPT);
+    for (i = 0; i < n; ++i) {
+	if (subs[i] > a->dims[i])
+		fail(ip, E_SUBSCRIPT);
+	off = off * (a->dims[i] + 1) + subs[i];
+    }
+    ip->cycles += C_ARRAY * n;
+    *ap = a;
+
+    return off;
+}
+
+
+static void
+lvalue(interp_t *ip, lval_t *lv)
+{
+    char name[2];
+    arr_t *a;
+    long off;
+    int type, i;
+
+    varname(ip, name, &type);
+    lv->type = type;
+    lv->special = 0;
+    if (peekc(ip) == '(') {
+	nextc(ip);
+	off = element(ip, &a, name, type);
+	lv->n = a->n != NULL ? &a->n[off] : NULL;
+	lv->s = a->s != NULL ? &a->s[off] : NULL;
+	return;
+    }
+    if (name[0] == 'S' && name[1] == 'T' && type == TY_NUM)
+	lv->special = SP_ST;
+    else if (name[0] == 'T' && name[1] == 'I' && type != TY_INT)
+	lv->special = type == TY_STR ? SP_TIS : SP_TI;
+    i = findvar(ip, name, type);
+    lv->n = &ip->vars[i].n;
+    lv->s = &ip->vars[i].s;
+}
+
+
+/*
+ * the clock, in jiffies
+ */
+static double
+jiffies(interp_t *ip)
+{
+    return fmod(floor(ip->cycles / CYCLES_JIFFY) + ip->tioff, JIFFIES_DAY);
+}
+
+
+/*
+ * store a value; a string in the program or made for this value is used
+ * where it is, anything else is copied
+ */
+static void
+store(interp_t *ip, lval_t *lv, val_t *v)
+{
+    unsigned char buf[256];
+    double t;
+    int i;
+
+    if ((lv->type == TY_STR) != (v->type == TY_STR))
+	fail(ip, E_TYPE);
+    if (lv->special == SP_TIS) {
+	if (v->s.len != 6)
+		fail(ip, E_QUANTITY);
+	for (t = 0, i = 0; i < 6; ++i) {
+		if (!ISDIGIT(ip->mem[v->s.addr + i]))
+			fail(ip, E_QUANTITY);
+		t = t * 10 + ip->mem[v->s.addr + i] - '0';
+	}
+	t = (floor(t / 10000) * 3600 + fmod(floor(t / 100), 100) * 60 +
+	     fmod(t, 100)) * 60;
+	if (t >= JIFFIES_DAY)
+		fail(ip, E_QUANTITY);
+	ip->tioff = t - floor(ip->cycles / CYCLES_JIFFY);
+	release(ip, v);
+	return;
+    }
+    if (lv->special)
+	fail(ip, E_SYNTAX);
+
+    if (lv->type == TY_STR) {
+	if (!v->temp && v->s.len > 0 && v->s.addr >= ip->vartab) {
+		memcpy(buf, &ip->mem[v->s.addr], v->s.len);
+		newstr(ip, v, buf, v->s.len);
+	}
+	*lv->s = v->s;
+    } else if (lv->type == TY_INT)
+	*lv->n = toint(ip, v->n, -32768, 32767);
+    else
+	*lv->n = v->n;
+}
+
+
+/*
+ * expressions
+ */
+static double
+num(interp_t *ip, const val_t *v)
+{
+    if (v->type != TY_NUM)
+	fail(ip, E_TYPE);
+
+    return v->n;
+}
+
+
+static void
+numarg(interp_t *ip, val_t *v)
+{
+    expr(ip, v);
+    (void)num(ip, v);
+}
+
+
+static void
+strarg(interp_t *ip, val_t *v)
+{
+    expr(ip, v);
+    if (v->type != TY_STR)
+	fail(ip, E_TYPE);
+}
+
+
+static void
+setnum(interp_t *ip, val_t *v, double n)
+{
+    v->type = TY_NUM;
+    v->temp = 0;
+    v->n = fround(ip, n);
+}
+
+
+/*
+ * a string function after its token
+ */
+static void
+strfunc(interp_t *ip, int tok, val_t *v)
+{
+    unsigned char buf[256];
+    const unsigned char *end;
+    val_t a, b;
+    int n, m;
+
+    switch (tok) {
+    case T_LEN:
+    case T_VAL:
+    case T_ASC:
+	strarg(ip, &a);
+	expect(ip, ')');
+	release(ip, &a);
+	if (tok == T_LEN)
+		setnum(ip, v, a.s.len);
+	else if (tok == T_ASC) {
+		if (a.s.len == 0)
+			fail(ip, E_QUANTITY);
+		setnum(ip, v, ip->mem[a.s.addr]);
+	} else {
+		memcpy(buf, &ip->mem[a.s.addr], a.s.len);
+		setnum(ip, v, fin(ip, buf, buf + a.s.len, &end));
+	}
+	return;
+
+    case T_STR:
+	numarg(ip, &a);
+	expect(ip, ')');
+	ip->cycles += C_NUMSTR;
+	n = numstr(a.n, (char *)buf);
+	newstr(ip, v, buf, n);
+	return;
+
+    case T_CHR:
+	numarg(ip, &a);
+	expect(ip, ')');
+	buf[0] = toint(ip, a.n, 0, 255);
+	newstr(ip, v, buf, 1);
+	return;
+    }
+
+    /* LEFT$, RIGHT$, MID$ */
+    strarg(ip, &a);
+    root(ip, &a.s);
+    expect(ip, ',');
+    numarg(ip, &b);
+    n = toint(ip, b.n, 0, 255);
+    m = 255;
+    if (tok == T_MID) {
+	if (n == 0)
+		fail(ip, E_QUANTITY);
+	if (accept(ip, ',')) {
+		numarg(ip, &b);
+		m = toint(ip, b.n, 0, 255);
+	}
+    }
+    expect(ip, ')');
+    unroot(ip);
+    if (tok == T_LEFT) {
+	m = n < a.s.len ? n : a.s.len;
+	n = 0;
+    } else if (tok == T_RIGHT) {
+	m = n < a.s.len ? n : a.s.len;
+	n = a.s.len - m;
+    } else {
+	n = n - 1 < a.s.len ? n - 1 : a.s.len;
+	if (m > a.s.len - n)
+		m = a.s.len - n;
+    }
+    memcpy(buf, &ip->mem[a.s.addr + n], m);
+    release(ip, &a);
+    newstr(ip, v, buf, m);
+}
+
+
+/*
+ * a function call after its token
+ */
+static void
+function(interp_t *ip, int tok, val_t *v)
+{
+    val_t a;
+    double x;
+    int n;
+
+    expect(ip, '(');
+    if (tok >= T_LEN) {
+	strfunc(ip, tok, v);
+	return;
+    }
+
+    numarg(ip, &a);
+    expect(ip, ')');
+    x = a.n;
+    switch (tok) {
+    case T_SGN:
+	setnum(ip, v, x > 0 ? 1 : x < 0 ? -1 : 0);
+	break;
+    case T_INT:
+	ip->cycles += C_INT;
+	setnum(ip, v, floor(x));
+	break;
+    case T_ABS:
+	setnum(ip, v, fabs(x));
+	break;
+    case T_USR:
+	unsupported(ip, "USR");
+	break;
+    case T_FRE:
+	gc(ip);
+	n = ip->fretop - ip->strend;
+	setnum(ip, v, n > 32767 ? n - 65536 : n);
+	break;
+    case T_POS:
+	setnum(ip, v, ip->col);
+	break;
+    case T_SQR:
+	if (x < 0)
+		fail(ip, E_QUANTITY);
+	ip->cycles += C_TRANS;
+	setnum(ip, v, sqrt(x));
+	break;
+    case T_RND:
+	/* Negative reseeds, 0 takes the clock; repeatable either way. */
+	if (x < 0)
+		ip->seed = (unsigned long)fmod(-x * 16777259.0, 4294967296.0);
+	else if (x == 0)
+		ip->seed ^= (unsigned long)jiffies(ip);
+	ip->seed = (ip->seed * 1103515245UL + 12345UL) & 0xffffffffUL;
+	ip->cycles += C_MUL * 2;
+	setnum(ip, v, (ip->seed >> 8) / 16777216.0);
+	break;
+    case T_LOG:
+	if (x <= 0)
+		fail(ip, E_QUANTITY);
+	ip->cycles += C_TRANS;
+	setnum(ip, v, log(x));
+	break;
+    case T_EXP:
+	ip->cycles += C_TRANS;
+	if (x > 88.0296919)
+		fail(ip, E_OVERFLOW);
+	setnum(ip, v, exp(x));
+	break;
+    case T_COS:
+	ip->cycles += C_TRANS;
+	setnum(ip, v, cos(x));
+	break;
+    case T_SIN:
+	ip->cycles += C_TRANS;
+	setnum(ip, v, sin(x));
+	break;
+    case T_TAN:
+	ip->cycles += 2 * C_TRANS;
+	if (cos(x) == 0)
+		fail(ip, E_DIVZERO);
+	setnum(ip, v, tan(x));
+	break;
+    case T_ATN:
+	ip->cycles += C_TRANS;
+	setnum(ip, v, atan(x));
+	break;
+    case T_PEEK:
+	n = toint(ip, x, 0, 65535);
+	if (n >= 160 && n <= 162)	// the jiffy clock
+		setnum(ip, v, fmod(floor(jiffies(ip) / (1 << (8 * (162 - n)))),
+				   256));
+	else
+		setnum(ip, v, ip->mem[n]);
+	break;
+    default:
+	fail(ip, E_SYNTAX);
+    }
+}
+
+
+/*
+ * FN name(arg): the argument is in the parameter for as long as the body
+ * is evaluated
+ */
+static void
+callfn(interp_t *ip, val_t *v)
+{
+    char name[2];
+    unsigned int tp;
+    double save;
+    val_t a;
+    int type, i, p;
+
+    varname(ip, name, &type);
+    if (type != TY_NUM)
+	fail(ip, E_SYNTAX);
+    expect(ip, '(');
+    numarg(ip, &a);
+    expect(ip, ')');
+    for (i = 0; i < ip->nfns; ++i) {
+	if (ip->fns[i].name[0] == name[0] && ip->fns[i].name[1] == name[1])
+		break;
+    }
+    if (i == ip->nfns)
+	fail(ip, E_UNDEFFN);
+
+    p = ip->fns[i].param;
+    save = ip->vars[p].n;
+    ip->vars[p].n = a.n;
+    tp = ip->tp;
+    ip->tp = ip->fns[i].body;
+    expr(ip, v);
+    (void)num(ip, v);
+    if (!endstmt(ip))
+	fail(ip, E_SYNTAX);
+    ip->tp = tp;
+    ip->vars[p].n = save;
+}
+
+
+static void
+primary(interp_t *ip, val_t *v)
+{
+    const unsigned char *end;
+    unsigned int start;
+    lval_t lv;
+    char buf[32];
+    int c = peekc(ip);
+    long t;
+
+    if (++ip->depth > MAXDEPTH)
+	fail(ip, E_COMPLEX);
+    v->temp = 0;
+
+    if (ISDIGIT(c) || c == '.') {
+	v->type = TY_NUM;
+	v->n = fin(ip, &ip->mem[ip->tp], &ip->mem[ip->vartab], &end);
+	ip->tp = end - ip->mem;
+    } else if (c == '"') {
+	/* A string in the program is used where it is. */
+	nextc(ip);
+	start = ip->tp;
+	while (ip->mem[ip->tp] != 0 && ip->mem[ip->tp] != '"')
+		ip->tp++;
+	ip->cycles += C_CHRGET * (ip->tp - start);
+	v->type = TY_STR;
+	v->s.addr = start;
+	v->s.len = ip->tp - start > 255 ? 255 : ip->tp - start;
+	if (ip->mem[ip->tp] == '"')
+		ip->tp++;
+    } else if (c == '(') {
+	nextc(ip);
+	expr(ip, v);
+	expect(ip, ')');
+    } else if (c == T_NOT) {
+	nextc(ip);
+	notexpr(ip, v);
+	setnum(ip, v, ~toint(ip, num(ip, v), -32768, 32767));
+    } else if (c == T_PI) {
+	nextc(ip);
+	setnum(ip, v, 3.14159265358979);
+    } else if (c == T_FN) {
+	nextc(ip);
+	callfn(ip, v);
+    } else if (c >= T_SGN && c <= T_MID) {
+	nextc(ip);
+	function(ip, c, v);
+    } else if (ISLETTER(c)) {
+	lvalue(ip, &lv);
+	if (lv.special == SP_ST)
+		setnum(ip, v, 0);
+	else if (lv.special == SP_TI)
+		setnum(ip, v, jiffies(ip));
+	else if (lv.special == SP_TIS) {
+		t = (long)jiffies(ip) / 60;
+		sprintf(buf, "%02ld%02ld%02ld", t / 3600, t / 60 % 60, t % 60);
+		newstr(ip, v, (unsigned char *)buf, 6);
+	} else if (lv.type == TY_STR) {
+		v->type = TY_STR;
+		v->s = *lv.s;
+	} else {
+		v->type = TY_NUM;
+		v->n = *lv.n;
+	}
+    } else
+	fail(ip, E_SYNTAX);
+
+    ip->depth--;
+}
+
+
+/*
+ * the operand of ^, which may have its own signs: 2^-1
+ */
+static void
+power(interp_t *ip, val_t *v)
+{
+    int c = peekc(ip);
+
+    if (c == T_MINUS || c == T_PLUS) {
+	nextc(ip);
+	power(ip, v);
+	if (c == T_MINUS)
+		setnum(ip, v, -num(ip, v));
+    } else
+	primary(ip, v);
+}
+
+
+static void
+powexpr(interp_t *ip, val_t *v)
+{
+    val_t b;
+
+    primary(ip, v);
+    while (accept(ip, T_POW)) {
+	power(ip, &b);
+	ip->cycles += C_POW;
+	if (num(ip, v) < 0 && num(ip, &b) != floor(b.n))
+		fail(ip, E_QUANTITY);
+	if (v->n == 0 && b.n < 0)
+		fail(ip, E_DIVZERO);
+	setnum(ip, v, pow(v->n, b.n));
+    }
+}
+
+
+/*
+ * signs, which bind tighter than * and looser than ^: -2^2 is -4
+ */
+static void
+negexpr(interp_t *ip, val_t *v)
+{
+    int c = peekc(ip);
+
+    if (c == T_MINUS || c == T_PLUS) {
+	nextc(ip);
+	negexpr(ip, v);
+	if (c == T_MINUS)
+		setnum(ip, v, -num(ip, v));
+    } else
+	powexpr(ip, v);
+}
+
+
+static void
+mulexpr(interp_t *ip, val_t *v)
+{
+    val_t b;
+    int c;
+
+    negexpr(ip, v);
+    while ((c = peekc(ip)) == T_MUL || c == T_DIV) {
+	nextc(ip);
+	negexpr(ip, &b);
+	(void)num(ip, v);
+	(void)num(ip, &b);
+	if (c == T_MUL) {
+		ip->cycles += C_MUL;
+		setnum(ip, v, v->n * b.n);
+	} else {
+		ip->cycles += C_DIV;
+		if (b.n == 0)
+			fail(ip, E_DIVZERO);
+		setnum(ip, v, v->n / b.n);
+	}
+    }
+}
+
+
+static void
+addexpr(interp_t *ip, val_t *v)
+{
+    unsigned char buf[512];
+    val_t b;
+    int c;
+
+    mulexpr(ip, v);
+    while ((c = peekc(ip)) == T_PLUS || c == T_MINUS) {
+	nextc(ip);
+	if (v->type == TY_STR) {
+		if (c != T_PLUS)
+			fail(ip, E_TYPE);
+		root(ip, &v->s);
+		mulexpr(ip, &b);
+		unroot(ip);
+		if (b.type != TY_STR)
+			fail(ip, E_TYPE);
+		if (v->s.len + b.s.len > 255)
+			fail(ip, E_LONG);
+		memcpy(buf, &ip->mem[v->s.addr], v->s.len);
+		memcpy(&buf[v->s.len], &ip->mem[b.s.addr], b.s.len);
+		release(ip, &b);
+		release(ip, v);
+		newstr(ip, v, buf, v->s.len + b.s.len);
+		continue;
+	}
+	mulexpr(ip, &b);
+	ip->cycles += C_ADD;
+	setnum(ip, v, c == T_PLUS ? v->n + num(ip, &b) : v->n - num(ip, &b));
+    }
+}
+
+
+/*
+ * comparisons: any run of <, = and >, as a mask of the outcomes that are
+ * true
+ */
+static void
+relexpr(interp_t *ip, val_t *v)
+{
+    val_t b;
+    int mask, r, c, n;
+
+    addexpr(ip, v);
+    for (;;) {
+	mask = 0;
+	while ((c = peekc(ip)) >= T_GT && c <= T_LT) {
+		nextc(ip);
+		mask |= c == T_GT ? 1 : c == T_EQ ? 2 : 4;
+	}
+	if (mask == 0)
+		return;
+
+	if (v->type == TY_STR) {
+		root(ip, &v->s);
+		addexpr(ip, &b);
+		unroot(ip);
+		if (b.type != TY_STR)
+			fail(ip, E_TYPE);
+		n = v->s.len < b.s.len ? v->s.len : b.s.len;
+		r = memcmp(&ip->mem[v->s.addr], &ip->mem[b.s.addr], n);
+		if (r == 0)
+			r = v->s.len - b.s.len;
+		ip->cycles += C_CMP + C_STRBYTE * n;
+		release(ip, &b);
+		release(ip, v);
+	} else {
+		addexpr(ip, &b);
+		ip->cycles += C_CMP;
+		r = v->n < num(ip, &b) ? -1 : v->n > b.n;
+	}
+	setnum(ip, v, mask & (r < 0 ? 4 : r > 0 ? 1 : 2) ? -1 : 0);
+    }
+}
+
+
+static void
+notexpr(interp_t *ip, val_t *v)
+{
+    if (accept(ip, T_NOT)) {
+	notexpr(ip, v);
+	setnum(ip, v, ~toint(ip, num(ip, v), -32768, 32767));
+    } else
+	relexpr(ip, v);
+}
+
+
+static void
+andexpr(interp_t *ip, val_t *v)
+{
+    val_t b;
+
+    notexpr(ip, v);
+    while (accept(ip, T_AND)) {
+	notexpr(ip, &b);
+	ip->cycles += C_ADD;
+	setnum(ip, v, toint(ip, num(ip, v), -32768, 32767) &
+		      toint(ip, num(ip, &b), -32768, 32767));
+    }
+}
+
+
+static void
+expr(interp_t *ip, val_t *v)
+{
+    val_t b;
+
+    andexpr(ip, v);
+    while (accept(ip, T_OR)) {
+	andexpr(ip, &b);
+	ip->cycles += C_ADD;
+	setnum(ip, v, toint(ip, num(ip, v), -32768, 32767) |
+		      toint(ip, num(ip, &b), -32768, 32767));
+    }
+}
+
+
+/*
+ * the stack of FOR and GOSUB
+ */
+static void
+push(interp_t *ip, const frame_t *f)
+{
+    int len = f->gosub ? GOSUBLEN : FORLEN;
+
+    if (ip->stackused + len > STACKROOM)
+	fail(ip, E_MEMORY);
+    ip->stack[ip->nstack++] = *f;
+    ip->stackused += len;
+    ip->cycles += C_PUSH;
+}
+
+
+static void
+popto(interp_t *ip, int n)
+{
+    while (ip->nstack > n) {
+	ip->nstack--;
+	ip->stackused -= ip->stack[ip->nstack].gosub ? GOSUBLEN : FORLEN;
+    }
+}
+
+
+/*
+ * the FOR loop of variable var, or the innermost one if var is -1, as far
+ * down as the last GOSUB
+ * returns its index, or -1
+ */
+static int
+findfor(interp_t *ip, int var)
+{
+    int i;
+
+    for (i = ip->nstack - 1; i >= 0 && !ip->stack[i].gosub; --i) {
+	ip->cycles += C_PUSH / 4;
+	if (var < 0 || ip->stack[i].var == var)
+		return i;
+    }
+
+    return -1;
+}
+
+
+/*
+ * clear the variables, the strings and the stack, like CLR
+ */
+static void
+clear(interp_t *ip)
+{
+    int i;
+
+    for (i = 0; i < ip->narrs; ++i) {
+	free(ip->arrs[i]->n);
+	free(ip->arrs[i]->s);
+	free(ip->arrs[i]);
+    }
+    ip->narrs = 0;
+    ip->nvars = 0;
+    memset(ip->hash, 0xff, HASHSIZE * sizeof(*ip->hash));
+    ip->nfns = 0;
+    ip->nstack = ip->stackused = 0;
+    ip->strend = ip->vartab;
+    ip->fretop = MEMSIZ;
+    ip->datline = 0;
+    ip->datptr = 0;
+    ip->datready = 0;
+}
+
+
+/*
+ * statements
+ */
+static void
+do_for(interp_t *ip)
+{
+    char name[2];
+    frame_t f;
+    val_t v;
+    int type, i;
+
+    varname(ip, name, &type);
+    if (type != TY_NUM || peekc(ip) == '(')
+	fail(ip, E_SYNTAX);
+    f.var = findvar(ip, name, type);
+    expect(ip, T_EQ);
+    numarg(ip, &v);
+    ip->vars[f.var].n = v.n;
+    expect(ip, T_TO);
+    numarg(ip, &v);
+    f.limit = v.n;
+    f.step = 1;
+    if (accept(ip, T_STEP)) {
+	numarg(ip, &v);
+	f.step = v.n;
+    }
+    if (!endstmt(ip))
+	fail(ip, E_SYNTAX);
+
+    /* A loop on the same variable is dropped, with those inside it. */
+    if ((i = findfor(ip, f.var)) >= 0)
+	popto(ip, i);
+    f.gosub = 0;
+    f.tp = ip->tp;
+    f.line = ip->cur;
+    push(ip, &f);
+}
+
+
+static void
+do_next(interp_t *ip)
+{
+    char name[2];
+    frame_t *f;
+    double n;
+    int type, var, i;
+
+    do {
+	var = -1;
+	if (!endstmt(ip)) {
+		varname(ip, name, &type);
+		if (type != TY_NUM)
+			fail(ip, E_SYNTAX);
+		var = findvar(ip, name, type);
+	}
+	if ((i = findfor(ip, var)) < 0)
+		fail(ip, E_NEXT);
+	popto(ip, i + 1);
+	f = &ip->stack[i];
+
+	n = fround(ip, ip->vars[f->var].n + f->step);
+	ip->vars[f->var].n = n;
+	ip->cycles += C_ADD + C_CMP;
+	if (f->step >= 0 ? n <= f->limit : n >= f->limit) {
+		if (f->line != ip->cur)
+			setline(ip, f->line);
+		ip->tp = f->tp;
+		ip->jumped = 1;
+		return;
+	}
+	popto(ip, i);
+    } while (accept(ip, ','));
+}
+
+
+static void
+do_goto(interp_t *ip, int gosub)
+{
+    frame_t f;
+    long n = getline_(ip);
+    int i = findline(ip, n);
+
+    if (gosub) {
+	memset(&f, 0, sizeof(f));
+	f.gosub = 1;
+	f.tp = ip->tp;
+	f.line = ip->cur;
+	push(ip, &f);
+    }
+    jump(ip, i);
+}
+
+
+static void
+do_return(interp_t *ip)
+{
+    int i;
+
+    for (i = ip->nstack - 1; i >= 0 && !ip->stack[i].gosub; --i)
+	;
+    if (i < 0)
+	fail(ip, E_RETURN);
+    if (ip->stack[i].line != ip->cur)
+	setline(ip, ip->stack[i].line);
+    ip->tp = ip->stack[i].tp;
+    popto(ip, i);
+
+    /* The rest of an ON ... GOSUB list is skipped like DATA. */
+    skipstmt(ip, 0);
+    ip->jumped = 1;
+}
+
+
+static void
+do_if(interp_t *ip)
+{
+    val_t v;
+    int c;
+
+    expr(ip, &v);
+    if (v.type == TY_STR)
+	release(ip, &v);
+    c = peekc(ip);
+    if (c != T_THEN && c != T_GOTO)
+	fail(ip, E_SYNTAX);
+    if (v.type == TY_STR ? v.s.len == 0 : v.n == 0) {
+	skipstmt(ip, 1);
+	return;
+    }
+
+    nextc(ip);
+    if (c == T_GOTO || ISDIGIT(peekc(ip))) {
+	do_goto(ip, 0);
+	return;
+    }
+    c = peekc(ip);
+    if (c != ':' && c != 0) {
+	nextc(ip);
+	statement(ip, c);
+    }
+}
+
+
+static void
+do_on(interp_t *ip)
+{
+    val_t v;
+    int n, c;
+
+    numarg(ip, &v);
+    n = toint(ip, v.n, 0, 255);
+    c = nextc(ip);
+    if (c == T_GO && accept(ip, T_TO))
+	c = T_GOTO;
+    if (c != T_GOTO && c != T_GOSUB)
+	fail(ip, E_SYNTAX);
+
+    while (--n > 0) {
+	(void)getline_(ip);
+	if (!accept(ip, ','))
+		return;
+    }
+    if (n == 0)
+	do_goto(ip, c == T_GOSUB);
+    else
+	skipstmt(ip, 0);
+}
+
+
+/*
+ * the next DATA item, with ip->tp left on it
+ */
+static void
+nextdata(interp_t *ip)
+{
+    unsigned int p;
+    int quoted = 0;
+    int c, i;
+
+    if (ip->datready)
+	return;
+    for (i = ip->datline; i < ip->nlines; ++i) {
+	p = ip->datptr ? ip->datptr : ip->lines[i][1] + 4;
+	ip->datptr = 0;
+	for (; (c = ip->mem[p]) != 0; ++p) {
+		ip->cycles += C_CHRGET;
+		if (c == '"')
+			quoted = !quoted;
+		if (quoted)
+			continue;
+		if (c == T_REM)
+			break;
+		if (c == T_DATA) {
+			ip->datline = i;
+			ip->datptr = p + 1;
+			ip->datready = 1;
+			return;
+		}
+	}
+	quoted = 0;
+    }
+    fail(ip, E_DATA);
+}
+
+
+static void
+do_read(interp_t *ip)
+{
+    const unsigned char *end;
+    unsigned int p, start;
+    lval_t lv;
+    val_t v;
+    int c;
+
+    do {
+	lvalue(ip, &lv);
+	nextdata(ip);
+
+	/* Read the item where it is in the program. */
+	p = ip->datptr;
+	while (ip->mem[p] == ' ')
+		++p;
+	if (ip->mem[p] == '"') {
+		start = ++p;
+		while (ip->mem[p] != 0 && ip->mem[p] != '"')
+			++p;
+		v.s.len = p - start;
+		if (ip->mem[p] == '"')
+			++p;
+		while (ip->mem[p] == ' ')
+			++p;
+	} else {
+		start = p;
+		while ((c = ip->mem[p]) != 0 && c != ',' && c != ':')
+			++p;
+		v.s.len = p - start;
+	}
+	ip->cycles += C_CHRGET * (p - ip->datptr);
+	if (v.s.len > 255)
+		v.s.len = 255;
+
+	if (lv.type == TY_STR) {
+		v.type = TY_STR;
+		v.temp = 0;
+		v.s.addr = start;
+	} else {
+		v.type = TY_NUM;
+		v.n = fin(ip, &ip->mem[start], &ip->mem[start + v.s.len], &end);
+		if (end != &ip->mem[start + v.s.len]) {
+			ip->errat = ip->datline;	// the DATA is wrong
+			fail(ip, E_SYNTAX);
+		}
+	}
+	store(ip, &lv, &v);
+
+	if (ip->mem[p] == ',')
+		p++;
+	else
+		ip->datready = 0;
+	ip->datptr = p;
+	if (ip->mem[p] == 0 && !ip->datready) {
+		ip->datline++;
+		ip->datptr = 0;
+	}
+    } while (accept(ip, ','));
+}
+
+
+static void
+do_restore(interp_t *ip)
+{
+    ip->datline = 0;
+    ip->datptr = 0;
+    ip->datready = 0;
+}
+
+
+static void
+do_dim(interp_t *ip)
+{
+    char name[2];
+    int dims[255];
+    int type, n;
+
+    do {
+	varname(ip, name, &type);
+	expect(ip, '(');
+	n = subscripts(ip, dims);
+	if (findarr(ip, name, type) != NULL)
+		fail(ip, E_REDIM);
+	newarr(ip, name, type, n, dims);
+    } while (accept(ip, ','));
+}
+
+
+static void
+do_let(interp_t *ip)
+{
+    lval_t lv;
+    val_t v;
+
+    lvalue(ip, &lv);
+    expect(ip, T_EQ);
+    expr(ip, &v);
+    store(ip, &lv, &v);
+}
+
+
+static void
+do_def(interp_t *ip)
+{
+    char name[2];
+    fn_t *fns;
+    int type, i;
+
+    expect(ip, T_FN);
+    varname(ip, name, &type);
+    if (type != TY_NUM)
+	fail(ip, E_SYNTAX);
+    for (i = 0; i < ip->nfns; ++i) {
+	if (ip->fns[i].name[0] == name[0] && ip->fns[i].name[1] == name[1])
+		break;
+    }
+    if (i == ip->nfns) {
+	if ((fns = realloc(ip->fns, (i + 1) * sizeof(*fns))) == NULL)
+		fail(ip, E_MEMORY);
+	ip->fns = fns;
+	ip->nfns++;
+    }
+    ip->fns[i].name[0] = name[0];
+    ip->fns[i].name[1] = name[1];
+
+    expect(ip, '(');
+    varname(ip, name, &type);
+    if (type != TY_NUM)
+	fail(ip, E_SYNTAX);
+    ip->fns[i].param = findvar(ip, name, type);
+    expect(ip, ')');
+    expect(ip, T_EQ);
+    ip->fns[i].body = ip->tp;
+    skipstmt(ip, 0);
+}
+
+
+static void
+do_print(interp_t *ip)
+{
+    char buf[32];
+    val_t v;
+    int c, n, newline = 1;
+
+    while (!endstmt(ip)) {
+	c = peekc(ip);
+	newline = 1;
+	if (c == ';') {
+		nextc(ip);
+		newline = 0;
+	} else if (c == ',') {
+		nextc(ip);
+		do
+			out(ip, ' ');
+		while (ip->col % 10 != 0);
+		newline = 0;
+	} else if (c == T_TAB || c == T_SPC) {
+		nextc(ip);
+		numarg(ip, &v);
+		expect(ip, ')');
+		n = toint(ip, v.n, 0, 255);
+		if (c == T_TAB)
+			n -= ip->col;
+		while (n-- > 0)
+			out(ip, ' ');
+		newline = 0;
+	} else {
+		expr(ip, &v);
+		if (v.type == TY_STR) {
+			outs(ip, (char *)&ip->mem[v.s.addr], v.s.len);
+			release(ip, &v);
+		} else {
+			ip->cycles += C_NUMSTR;
+			n = numstr(v.n, buf);
+			buf[n++] = ' ';
+			outs(ip, buf, n);
+		}
+	}
+    }
+    if (newline)
+	out(ip, 13);
+}
+
+
+/*
+ * files go nowhere, but the output is still paid for
+ */
+static void
+do_printn(interp_t *ip)
+{
+    val_t v;
+
+    numarg(ip, &v);
+    ip->discard = 1;
+    if (accept(ip, ','))
+	do_print(ip);
+    ip->discard = 0;
+}
+
+
+/*
+ * show the prompt, then type a line into buf and show it too
+ * returns its length
+ */
+static int
+typeline(interp_t *ip, const char *prompt, unsigned char *buf)
+{
+    int n = 0, c;
+
+    outs(ip, prompt, strlen(prompt));
+    while ((c = key(ip)) != 13) {
+	buf[n++] = c;
+	out(ip, c);
+    }
+    out(ip, 13);
+
+    return n;
+}
+
+
+static void
+do_input(interp_t *ip)
+{
+    unsigned char line[MAXINPUT + 1];
+    const unsigned char *sp, *ep, *start, *end;
+    unsigned int tp;
+    lval_t lv;
+    val_t v;
+    int n;
+
+    if (peekc(ip) == '"') {
+	expr(ip, &v);
+	outs(ip, (char *)&ip->mem[v.s.addr], v.s.len);
+	expect(ip, ';');
+    }
+    tp = ip->tp;
+
+redo:
+    /* RETURN alone leaves the variables as they are. */
+    if ((n = typeline(ip, "? ", line)) == 0) {
+	skipstmt(ip, 0);
+	return;
+    }
+    sp = line;
+    ep = line + n;
+
+    for (;;) {
+	lvalue(ip, &lv);
+	while (sp < ep && *sp == ' ')
+		++sp;
+	start = sp;
+	if (lv.type == TY_STR && sp < ep && *sp == '"') {
+		start = ++sp;
+		while (sp < ep && *sp != '"')
+			++sp;
+		n = sp - start;
+		if (sp < ep)
+			++sp;
+	} else {
+		while (sp < ep && *sp != ',' && *sp != ':')
+			++sp;
+		n = sp - start;
+	}
+
+	if (lv.type == TY_STR)
+		newstr(ip, &v, start, n);
+	else {
+		v.type = TY_NUM;
+		v.n = fin(ip, start, start + n, &end);
+		if (end != start + n) {
+			outs(ip, "?REDO FROM START\r", 17);
+			ip->tp = tp;
+			goto redo;
+		}
+	}
+	store(ip, &lv, &v);
+
+	if (!accept(ip, ','))
+		break;
+	if (sp < ep && *sp == ',')
+		++sp;
+	else {
+		n = typeline(ip, "?? ", line);
+		sp = line;
+		ep = line + n;
+	}
+    }
+
+    if (sp < ep)
+	outs(ip, "?EXTRA IGNORED\r", 15);
+}
+
+
+static void
+do_get(interp_t *ip)
+{
+    const unsigned char *end;
+    unsigned char c;
+    lval_t lv;
+    val_t v;
+
+    if (peekc(ip) == '#')
+	unsupported(ip, "GET#");
+    do {
+	lvalue(ip, &lv);
+	c = key(ip);
+	if (lv.type == TY_STR)
+		newstr(ip, &v, &c, 1);
+	else {
+		v.type = TY_NUM;
+		v.n = fin(ip, &c, &c + 1, &end);
+		if (end != &c + 1)
+			fail(ip, E_SYNTAX);
+	}
+	store(ip, &lv, &v);
+    } while (accept(ip, ','));
+}
+
+
+static void
+do_poke(interp_t *ip)
+{
+    val_t a, b;
+
+    numarg(ip, &a);
+    expect(ip, ',');
+    numarg(ip, &b);
+    ip->mem[toint(ip, a.n, 0, 65535)] = toint(ip, b.n, 0, 255);
+}
+
+
+static void
+do_wait(interp_t *ip)
+{
+    val_t a, b, c;
+    int x = 0;
+
+    numarg(ip, &a);
+    expect(ip, ',');
+    numarg(ip, &b);
+    if (accept(ip, ','))
+	numarg(ip, &c), x = toint(ip, c.n, 0, 255);
+
+    /* Nothing else changes memory here, so it would wait forever. */
+    if (((ip->mem[toint(ip, a.n, 0, 65535)] ^ x) &
+	 toint(ip, b.n, 0, 255)) == 0)
+	fail(ip, E_WAIT);
+}
+
+
+static void
+statement(interp_t *ip, int c)
+{
+    ip->prof[ip->cur].stmts++;
+    ip->rp->stmts++;
+    ip->cycles += C_STMT;
+
+    if (ISLETTER(c)) {
+	ip->tp--;
+	do_let(ip);
+	return;
+    }
+
+    switch (c) {
+    case T_END:
+	fail(ip, E_END);
+	break;
+    case T_FOR:
+	do_for(ip);
+	break;
+    case T_NEXT:
+	do_next(ip);
+	break;
+    case T_DATA:
+	skipstmt(ip, 0);
+	break;
+    case T_INPUT:
+	do_input(ip);
+	break;
+    case T_DIM:
+	do_dim(ip);
+	break;
+    case T_READ:
+	do_read(ip);
+	break;
+    case T_LET:
+	do_let(ip);
+	break;
+    case T_GO:
+	expect(ip, T_TO);
+	/* fall through */
+    case T_GOTO:
+	do_goto(ip, 0);
+	break;
+    case T_RUN:
+	clear(ip);
+	if (ISDIGIT(peekc(ip)))
+		do_goto(ip, 0);
+	else if (ip->nlines > 0)
+		jump(ip, 0);
+	break;
+    case T_IF:
+	do_if(ip);
+	break;
+    case T_RESTORE:
+	do_restore(ip);
+	break;
+    case T_GOSUB:
+	do_goto(ip, 1);
+	break;
+    case T_RETURN:
+	do_return(ip);
+	break;
+    case T_REM:
+	skipstmt(ip, 1);
+	break;
+    case T_STOP:
+	fail(ip, E_BREAK);
+	break;
+    case T_ON:
+	do_on(ip);
+	break;
+    case T_WAIT:
+	do_wait(ip);
+	break;
+    case T_DEF:
+	do_def(ip);
+	break;
+    case T_POKE:
+	do_poke(ip);
+	break;
+    case T_PRINTN:
+	do_printn(ip);
+	break;
+    case T_PRINT:
+	do_print(ip);
+	break;
+    case T_CLR:
+	clear(ip);
+	break;
+    case T_OPEN:
+    case T_CLOSE:
+    case T_CMD:
+	skipstmt(ip, 0);
+	break;
+    case T_GET:
+	do_get(ip);
+	break;
+    case T_NEW:
+	fail(ip, E_END);
+	break;
+    case T_INPUTN:
+	unsupported(ip, "INPUT#");
+	break;
+    case T_LOAD:
+	unsupported(ip, "LOAD");
+	break;
+    case T_SAVE:
+	unsupported(ip, "SAVE");
+	break;
+    case T_VERIFY:
+	unsupported(ip, "VERIFY");
+	break;
+    case T_CONT:
+	unsupported(ip, "CONT");
+	break;
+    case T_LIST:
+	unsupported(ip, "LIST");
+	break;
+    case T_SYS:
+	unsupported(ip, "SYS");
+	break;
+    default:
+	fail(ip, E_SYNTAX);
+    }
+}
+
+
+/*
+ * run from the first line until the program ends
+ */
+static void
+execute(interp_t *ip)
+{
+    int c;
+
+    if (ip->nlines == 0)
+	return;
+    jump(ip, 0);
+    for (;;) {
+	if (ip->cycles > ip->ro->maxcycles && ip->ro->maxcycles > 0)
+		fail(ip, E_TIME);
+	ip->jumped = 0;
+	ip->nroots = 0;
+	ip->depth = 0;
+	c = nextc(ip);
+	if (c == ':')
+		continue;
+	if (c == 0) {
+		if (ip->cur + 1 == ip->nlines)
+			return;
+		ip->cycles += C_LINE;
+		jump(ip, ip->cur + 1);
+		continue;
+	}
+	statement(ip, c);
+	if (!ip->jumped && !endstmt(ip))
+		fail(ip, E_SYNTAX);
+    }
+}
+
+
+/*
+ * load the program into memory and find its lines
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+static int
+load(interp_t *ip, const unsigned char *prg, long len)
+{
+    const unsigned char *le;
+    unsigned int addr, p;
+    long n = 0;
+
+    if (len < 2)
+	return diag_error(ip->diag, "no load address");
+    addr = prg[0] | (prg[1] << 8);
+    if (addr + len - 2 > MEMSIZ)
+	return diag_error(ip->diag, "program does not fit below $%04X",
+			  MEMSIZ);
+    memcpy(&ip->mem[addr], prg + 2, len - 2);
+
+    /* Lines are found by their ends, as the links may be stale. */
+    for (p = addr; p + 4 <= addr + len - 2 && (ip->mem[p] | ip->mem[p + 1]);
+	 p = le - ip->mem + 1) {
+	le = memchr(&ip->mem[p + 4], 0, addr + len - 2 - p - 4);
+	if (le == NULL)
+		return diag_error(ip->diag, "line at $%04X does not end", p);
+	n++;
+    }
+    if ((ip->lines = malloc((n + 1) * sizeof(*ip->lines))) == NULL ||
+	(ip->prof = calloc(n + 1, sizeof(*ip->prof))) == NULL)
+	return diag_error(ip->diag, "out of memory");
+
+    for (p = addr; n > ip->nlines; p = le - ip->mem + 1) {
+	le = memchr(&ip->mem[p + 4], 0, addr + len - 2 - p - 4);
+	ip->lines[ip->nlines][0] = ip->mem[p + 2] | (ip->mem[p + 3] << 8);
+	ip->lines[ip->nlines][1] = p;
+	ip->prof[ip->nlines].line = ip->lines[ip->nlines][0];
+	ip->nlines++;
+    }
+    ip->vartab = addr + len - 2;		// as LOAD sets it
+
+    return 0;
+}
+
+
+/*
+ * run a tokenized BASIC V2 program, reading its input from ro->in and
+ * writing what it prints to ro->out, and profile it by line into prof
+ * (free it with runprof_free())
+ * returns 0 if the program ended, with or without a BASIC error; -1 if it
+ * could not be run to the end here (reason in diag->error)
+ */
+int
+bas_run(const unsigned char *prg, long len, const runopts_t *ro,
+	runprof_t *prof, diag_t *diag)
+{
+    interp_t *ip;
+    int ret = 0, i;
+    char msg[64];
+
+    memset(prof, 0, sizeof(*prof));
+    if ((ip = calloc(1, sizeof(*ip))) == NULL ||
+	(ip->vars = malloc(MAXVARS * sizeof(*ip->vars))) == NULL ||
+	(ip->hash = malloc(HASHSIZE * sizeof(*ip->hash))) == NULL) {
+	if (ip != NULL)
+		free(ip->vars);
+	free(ip);
+	return diag_error(diag, "out of memory");
+    }
+    ip->ro = ro;
+    ip->diag = diag;
+    ip->rp = prof;
+    ip->seed = 0x6b8b4567UL;
+    ip->errat = -1;
+
+    if (load(ip, prg, len) < 0) {
+	ret = -1;
+	goto done;
+    }
+    clear(ip);
+
+    if (setjmp(ip->err) == 0)
+	execute(ip);
+    if (ip->nlines > 0)
+	ip->prof[ip->cur].cycles += ip->cycles - ip->mark;
+
+    switch (ip->errnum) {
+    case E_NONE:
+    case E_END:
+	break;
+    case E_BREAK:
+	if (ip->col != 0)
+		out(ip, 13);
+	i = sprintf(msg, "BREAK IN %ld\r", linenum(ip));
+	outs(ip, msg, i);
+	break;
+    case E_NOINPUT:
+	diag_info(diag, "Out of input in line %ld\n", linenum(ip));
+	break;
+    case E_UNSUPPORTED:
+	ret = diag_error(diag, "%s is not supported, in line %ld",
+			 ip->what, linenum(ip));
+	break;
+    case E_TIME:
+	ret = diag_error(diag, "time limit reached in line %ld",
+			 linenum(ip));
+	break;
+    case E_WAIT:
+	ret = diag_error(diag, "WAIT would never end, in line %ld",
+			 linenum(ip));
+	break;
+    default:
+	/* An error ends the program, as on a C64. */
+	if (ip->col != 0)
+		out(ip, 13);
+	i = sprintf(msg, "?%s  ERROR IN %ld\r", errors[ip->errnum],
+		    linenum(ip));
+	outs(ip, msg, i);
+	diag_warn(diag, "?%s ERROR IN %ld\n", errors[ip->errnum],
+		  linenum(ip));
+	prof->error = ip->errnum;
+	break;
+    }
+    prof->errline = linenum(ip);
+
+done:
+    prof->lines = ip->prof;
+    prof->nlines = ip->nlines;
+    prof->cycles = ip->cycles;
+    for (i = 0; i < ip->narrs; ++i) {
+	free(ip->arrs[i]->n);
+	free(ip->arrs[i]->s);
+	free(ip->arrs[i]);
+    }
+    free(ip->arrs);
+    free(ip->fns);
+    free(ip->lines);
+    free(ip->vars);
+    free(ip->hash);
+    free(ip);
+
+    return ret;
+}
+
+
+void
+runprof_free(runprof_t *prof)
+{
+    free(prof->lines);
+    prof->lines = NULL;
+    prof->nlines = 0;
+}
+
+
+/*
+ * read back a profile as basrun -p writes it, of the first program in it
+ * (free it with runprof_free())
+ * returns 0, or -1 on a read error or out of memory
+ */
+int
+runprof_read(FILE *fp, runprof_t *prof)
+{
+    lineprof_t lp, *np;
+    char buf[256];
+    int size = 0, programs = 0;
+
+    memset(prof, 0, sizeof(*prof));
+    while (fgets(buf, sizeof(buf), fp) != NULL) {
+	if (buf[0] == '#') {
+		if (programs++ > 0)
+			break;
+		continue;
+	}
+	memset(&lp, 0, sizeof(lp));
+	if (sscanf(buf, "%ld %ld %ld %lf %*f %*f %ld", &lp.line, &lp.hits,
+		   &lp.stmts, &lp.cycles, &lp.gcs) != 5)
+		continue;		// the heading
+	if (prof->nlines == size) {
+		size = size ? size * 2 : 256;
+		if ((np = realloc(prof->lines, size * sizeof(lineprof_t))) == NULL) {
+			runprof_free(prof);
+			return -1;
+		}
+		prof->lines = np;
+	}
+	prof->lines[prof->nlines++] = lp;
+	prof->stmts += lp.stmts;
+	prof->gcs += lp.gcs;
+	prof->cycles += lp.cycles;
+    }
+    if (ferror(fp)) {
+	runprof_free(prof);
+	return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,267 @@
+/*
+ * metrics.c, what a conversion did and how long it took, as JSON.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <sys/time.h>
+#endif
+#include "tokens.h"
+#include "prgtools.h"
+
+
+static const char *const phases[NTIMES] = { "read", "convert", "write" };
+
+
+void
+metrics_init(prgmetrics_t *m, int dialect)
+{
+    memset(m, 0, sizeof(*m));
+    m->dialect = dialect;
+}
+
+
+/*
+ * wall clock and CPU time in seconds; the CPU time is this thread's, so
+ * that it means the same when files are converted in parallel
+ */
+static void
+clocks(double *wall, double *cpu)
+{
+#ifdef _WIN32
+    LARGE_INTEGER f, t;
+    FILETIME c, e, k, u;
+
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&t);
+    *wall = (double)t.QuadPart / f.QuadPart;
+    if (GetThreadTimes(GetCurrentThread(), &c, &e, &k, &u))
+	*cpu = ((double)k.dwLowDateTime + u.dwLowDateTime +
+		4294967296.0 * ((double)k.dwHighDateTime + u.dwHighDateTime)) / 1e7;
+    else
+	*cpu = (double)clock() / CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+# ifdef CLOCK_THREAD_CPUTIME_ID
+    struct timespec ts;
+# endif
+
+    gettimeofday(&tv, NULL);
+    *wall = tv.tv_sec + tv.tv_usec / 1e6;
+# ifdef CLOCK_THREAD_CPUTIME_ID
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+	*cpu = ts.tv_sec + ts.tv_nsec / 1e9;
+	return;
+    }
+# endif
+    *cpu = (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+
+/*
+ * start timing a phase; does nothing without metrics
+ */
+void
+metrics_mark(prgmetrics_t *m)
+{
+    if (m != NULL)
+	clocks(&m->wall0, &m->cpu0);
+}
+
+
+/*
+ * add the time since the last mark to a phase, and mark again
+ */
+void
+metrics_time(prgmetrics_t *m, int phase)
+{
+    double wall, cpu;
+
+    if (m == NULL)
+	return;
+    clocks(&wall, &cpu);
+    m->wall[phase] += wall - m->wall0;
+    m->cpu[phase] += cpu - m->cpu0;
+    m->wall0 = wall;
+    m->cpu0 = cpu;
+}
+
+
+/*
+ * count the lines and keywords of a program in memory, without its load
+ * address; strings and what follows a REM are not looked at
+ */
+void
+metrics_count(prgmetrics_t *m, const unsigned char *sp, long len)
+{
+    const dialect_t *d = &dialects[m->dialect];
+    const unsigned char *ep = sp + len;
+    int quoted, rem, c;
+
+    while (ep - sp >= 4 && (sp[0] | sp[1]) != 0) {
+	m->lines++;
+	quoted = rem = 0;
+	for (sp += 4; sp < ep && *sp != 0; ++sp) {
+		c = *sp;
+		if (c == '"')
+			quoted = !quoted;
+		if (quoted || rem || (c < 0x80 && c != d->stop))
+			continue;
+		if (d->ptext[c] != NULL) {
+			if (sp + 1 == ep || sp[1] == 0)
+				continue;
+			if (m->phist[c] == NULL &&
+			    (m->phist[c] = calloc(256, sizeof(long))) == NULL)
+				continue;
+			m->phist[c][*++sp]++;
+		} else if (d->text[c] != NULL)
+			m->hist[c]++;
+		else
+			continue;
+		m->tokens++;
+		rem = c == TOKEN_REM;
+	}
+	sp++;
+    }
+}
+
+
+/*
+ * append one keyword of the histogram
+ */
+static int
+putcount(outbuf_t *o, const char *text, long count, int *first)
+{
+    if (count == 0)
+	return 0;
+    if ((!*first && outbuf_printf(o, ", ") < 0) ||
+	outbuf_jsonstr(o, text, strlen(text)) < 0 ||
+	outbuf_printf(o, ": %ld", count) < 0)
+	return -1;
+    *first = 0;
+
+    return 0;
+}
+
+
+/*
+ * append the metrics of one file as a single line of JSON, so that the
+ * metrics of many files can be read one line at a time; status is that
+ * of the conversion, error the reason it failed or NULL
+ * returns 0, or -1 if the buffer is full
+ */
+int
+metrics_json(outbuf_t *o, const char *name, const prgmetrics_t *m,
+	     int status, const char *error)
+{
+    const dialect_t *d = &dialects[m->dialect];
+    const char *wp, *ep, *tab, *nl;
+    int first, c, k;
+
+    if (outbuf_printf(o, "{\"file\": ") < 0 ||
+	outbuf_jsonstr(o, name, strlen(name)) < 0 ||
+	outbuf_printf(o, ", \"status\": \"%s\"", status < 0 ? "failed" :
+				 status > 0 ? "skipped" : "ok") < 0)
+	return -1;
+    if (error != NULL && (outbuf_printf(o, ", \"error\": ") < 0 ||
+			  outbuf_jsonstr(o, error, strlen(error)) < 0))
+	return -1;
+    if (outbuf_printf(o, ", \"dialect\": \"%s\", \"lines\": %ld, "
+			 "\"tokens\": %ld, \"bytes_in\": %ld, \"bytes_out\": %ld",
+		      dialect_name(m->dialect), m->lines, m->tokens,
+		      m->bytesin, m->bytesout) < 0)
+	return -1;
+
+    /* keywords in token order, those after a prefix after the prefix */
+    if (outbuf_printf(o, ", \"histogram\": {") < 0)
+	return -1;
+    first = 1;
+    for (c = 0; c < 256; ++c) {
+	if (d->text[c] != NULL &&
+	    putcount(o, d->text[c], m->hist[c], &first) < 0)
+		return -1;
+	for (k = 0; m->phist[c] != NULL && k < 256; ++k) {
+		if (putcount(o, d->ptext[c][k], m->phist[c][k], &first) < 0)
+			return -1;
+	}
+    }
+
+    if (outbuf_printf(o, "}, \"warnings\": [") < 0)
+	return -1;
+    wp = m->warnings.buf;
+    ep = wp + m->warnings.len;
+    for (first = 1; wp < ep; wp = nl + 1) {
+	tab = memchr(wp, '\t', ep - wp);
+	nl = memchr(tab, '\n', ep - tab);
+	if (outbuf_printf(o, "%s{\"line\": ", first ? "" : ", ") < 0 ||
+	    (atol(wp) < 0 ? outbuf_printf(o, "null") :
+			    outbuf_printf(o, "%ld", atol(wp))) < 0 ||
+	    outbuf_printf(o, ", \"message\": ") < 0 ||
+	    outbuf_jsonstr(o, tab + 1, nl - tab - 1) < 0 ||
+	    outbuf_printf(o, "}") < 0)
+		return -1;
+	first = 0;
+    }
+
+    if (outbuf_printf(o, "], \"time\": {") < 0)
+	return -1;
+    for (k = 0; k < NTIMES; ++k) {
+	if (outbuf_printf(o, "%s\"%s\": {\"wall_s\": %.6f, \"cpu_s\": %.6f}",
+			  k ? ", " : "", phases[k], m->wall[k], m->cpu[k]) < 0)
+		return -1;
+    }
+
+    return outbuf_printf(o, "}}\n");
+}
+
+
+/*
+ * write the metrics of one file to fp, see metrics_json()
+ * returns 0, or -1 if out of memory or on a write error
+ */
+int
+metrics_write(FILE *fp, const char *name, const prgmetrics_t *m, int status,
+	      const char *error)
+{
+    outbuf_t o;
+    int ret;
+
+    memset(&o, 0, sizeof(o));
+    ret = metrics_json(&o, name, m, status, error);
+    if (ret == 0 && (fwrite(o.buf, 1, o.len, fp) != o.len || fflush(fp) != 0))
+	ret = -1;
+    outbuf_free(&o);
+
+    return ret;
+}
+
+
+void
+metrics_free(prgmetrics_t *m)
+{
+    int c;
+
+    for (c = 0; c < 256; ++c)
+	free(m->phist[c]);
+    outbuf_free(&m->warnings);
+}
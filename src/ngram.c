@@ -0,0 +1,569 @@
+/*
+ * ngram.c, an inverted index of the token n-grams of tokenized programs,
+ * to find the lines that contain a run of keywords and literals.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "prgtools.h"
+
+
+/*
+ * Lines are read as units (see fprint.c), and every run of 1 to NG_MAX
+ * units in a line is a key. The index file is a series of segments, one
+ * added by each ngindex_append(), so that new programs are indexed
+ * without touching the old ones. A segment, all numbers little endian:
+ *	0-7	magic
+ *	8-11	length of the segment
+ *	12-15	number of programs
+ *	16-19	number of the first program, counting all segments
+ *	20-23	number of keys
+ *	24-27	offset of the keys, from the start of the segment
+ *	28-31	offset of the postings
+ *	32-35	offset of the names
+ * then the keys in order (the key, its first posting, the number of
+ * postings), the postings in order (program, line number) and the names
+ * of the programs, each with a nul.
+ */
+#define NG_MAX		3
+
+#define NGI_MAGIC	"PRGNGI01"
+#define NGI_MAGICLEN	8
+#define NGI_HEADLEN	36
+#define NGI_KEYLEN	16
+#define NGI_POSTLEN	8
+
+#define LONG(p)		((unsigned long)(p)[0] | ((unsigned long)(p)[1] << 8) | \
+			 ((unsigned long)(p)[2] << 16) | \
+			 ((unsigned long)(p)[3] << 24))
+
+typedef struct {
+    const unsigned char *keys;
+    const unsigned char *posts;
+    const char	**names;	// each program's, in the mapped file
+    long	nkeys;
+    long	nposts;
+    long	first;		// number of its first program
+    long	count;
+} ngseg_t;
+
+struct ngindex {
+    const unsigned char *data;
+    long	size;
+    long	valid;		// bytes of whole segments
+    ngseg_t	*segs;
+    int		nsegs;
+    long	count;		// programs in all segments
+};
+
+
+/* mixes a 64-bit value, for the keys */
+static unsigned long long
+mix64(unsigned long long h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return h;
+}
+
+
+/* the key of a run of n units */
+static unsigned long long
+ngkey(const unsigned int *u, int n)
+{
+    unsigned long long h = n;
+    int i;
+
+    for (i = 0; i < n; ++i)
+	h = mix64(h ^ ((unsigned long long)u[i] << 8));
+
+    return h;
+}
+
+
+/*
+ * append the keys of every line of a program in memory, without its load
+ * address, to out as ngpost_t; file is the number the caller gives it
+ * returns the number of keys added, or -1 if out of memory
+ */
+long
+ngram_prg(const unsigned char *sp, long len, int dialect, unsigned int file,
+	  outbuf_t *out)
+{
+    const unsigned char *ep = sp + len;
+    const unsigned char *le;
+    unsigned int *u;
+    ngpost_t *pp;
+    long n, i, added = 0;
+    unsigned int line;
+    int k;
+
+    if ((u = malloc((len + 1) * sizeof(unsigned int))) == NULL)
+	return -1;
+
+    while (ep - sp >= 4 && (sp[0] | sp[1]) != 0) {
+	line = sp[2] | (sp[3] << 8);
+	if ((le = memchr(sp + 4, 0, ep - sp - 4)) == NULL)
+		le = ep;
+	n = prg_lineunits(sp + 4, le, dialect, u);
+	if (outbuf_reserve(out, n * NG_MAX * sizeof(ngpost_t)) < 0) {
+		free(u);
+		return -1;
+	}
+	pp = (ngpost_t *)&out->buf[out->len];
+	for (i = 0; i < n; ++i) {
+		for (k = 1; k <= NG_MAX && i + k <= n; ++k) {
+			pp->key = ngkey(&u[i], k);
+			pp->file = file;
+			pp->line = line;
+			pp++;
+		}
+	}
+	added += pp - (ngpost_t *)&out->buf[out->len];
+	out->len = (char *)pp - out->buf;
+	if (le == ep)
+		break;
+	sp = le + 1;
+    }
+    free(u);
+
+    return added;
+}
+
+
+/*
+ * the keys to look up for a line of BASIC text, which is tokenized as
+ * bas2prg would: a run of up to NG_MAX units is a key of its own, a
+ * longer one is covered by keys of NG_MAX units, so that a line with
+ * all of them is a match
+ * returns the number of keys, 0 if there is nothing to look for
+ */
+int
+ngram_query(const char *text, const prgopts_t *opts, unsigned long long *keys,
+	    int max)
+{
+    unsigned char *tok;
+    unsigned int *u;
+    long n, i;
+    int nkeys = 0;
+
+    tok = malloc(2 * strlen(text) + 16);
+    u = malloc((2 * strlen(text) + 16) * sizeof(unsigned int));
+    if (tok == NULL || u == NULL) {
+	free(tok);
+	free(u);
+	return 0;
+    }
+    /* the line comes with its nul */
+    n = tokenize(tok, text, opts);
+    if (n > 0 && tok[n - 1] == '\0')
+	n--;
+    n = prg_lineunits(tok, tok + n, opts->dialect, u);
+
+    if (n <= NG_MAX) {
+	if (n > 0 && max > 0)
+		keys[nkeys++] = ngkey(u, n);
+    } else {
+	for (i = 0; i + NG_MAX < n && nkeys < max; i += NG_MAX)
+		keys[nkeys++] = ngkey(&u[i], NG_MAX);
+	if (nkeys < max)
+		keys[nkeys++] = ngkey(&u[n - NG_MAX], NG_MAX);
+    }
+    free(tok);
+    free(u);
+
+    return nkeys;
+}
+
+
+static void
+put32(unsigned char *p, unsigned long v)
+{
+    p[0] = v & 255;
+    p[1] = (v >> 8) & 255;
+    p[2] = (v >> 16) & 255;
+    p[3] = (v >> 24) & 255;
+}
+
+
+static unsigned long long
+get64(const unsigned char *p)
+{
+    return LONG(p) | ((unsigned long long)LONG(p + 4) << 32);
+}
+
+
+static int
+postcmp(const void *a, const void *b)
+{
+    const ngpost_t *x = a, *y = b;
+
+    if (x->key != y->key)
+	return x->key < y->key ? -1 : 1;
+    if (x->file != y->file)
+	return x->file < y->file ? -1 : 1;
+    return x->line < y->line ? -1 : x->line > y->line;
+}
+
+
+/*
+ * read the segments of a mapped index; a segment cut short, as by a
+ * write that failed, ends the index
+ * returns 0, or -1 if it is not an index or out of memory
+ */
+static int
+ngindex_load(ngindex_t *x)
+{
+    const unsigned char *sp, *np;
+    unsigned long len, nkeys, keys, posts, names;
+    ngseg_t *s;
+    long i;
+
+    for (x->valid = 0; x->size - x->valid >= NGI_HEADLEN; x->valid += len) {
+	sp = x->data + x->valid;
+	if (memcmp(sp, NGI_MAGIC, NGI_MAGICLEN))
+		return -1;
+	len = LONG(sp + 8);
+	nkeys = LONG(sp + 20);
+	keys = LONG(sp + 24);
+	posts = LONG(sp + 28);
+	names = LONG(sp + 32);
+	if (len > (unsigned long)(x->size - x->valid))
+		break;
+	if (keys != NGI_HEADLEN || posts < keys + nkeys * NGI_KEYLEN ||
+	    names < posts || names > len ||
+	    LONG(sp + 16) != (unsigned long)x->count ||
+	    (names < len && sp[len - 1] != '\0'))
+		return -1;
+
+	if ((x->nsegs & 15) == 0) {
+		s = realloc(x->segs, (x->nsegs + 16) * sizeof(ngseg_t));
+		if (s == NULL)
+			return -1;
+		x->segs = s;
+	}
+	s = &x->segs[x->nsegs++];
+	s->keys = sp + keys;
+	s->posts = sp + posts;
+	s->nkeys = nkeys;
+	s->nposts = (names - posts) / NGI_POSTLEN;
+	s->first = x->count;
+	s->count = LONG(sp + 12);
+	if ((s->names = malloc((s->count + 1) * sizeof(char *))) == NULL)
+		return -1;
+	for (np = sp + names, i = 0; i < s->count; ++i) {
+		if (np >= sp + len)
+			return -1;
+		s->names[i] = (const char *)np;
+		np += strlen((const char *)np) + 1;
+	}
+	x->count += s->count;
+    }
+
+    return 0;
+}
+
+
+/*
+ * open an index; it is mapped rather than read, so that a query only
+ * touches the pages it needs. A file that does not exist is an empty
+ * index when empty is set.
+ * returns the index, or NULL if it cannot be read or is not an index
+ */
+ngindex_t *
+ngindex_open(const char *path, int empty)
+{
+    ngindex_t *x;
+    FILE *fp;
+
+    if ((x = calloc(1, sizeof(*x))) == NULL)
+	return NULL;
+    if ((x->data = mapfile(path, &x->size)) == NULL) {
+	/* mapfile() does not take empty files */
+	if ((fp = fopen(path, "rb")) != NULL) {
+		empty = getc(fp) == EOF;
+		fclose(fp);
+	}
+	if (empty)
+		return x;
+	free(x);
+	return NULL;
+    }
+    if (ngindex_load(x) < 0) {
+	ngindex_close(x);
+	return NULL;
+    }
+
+    return x;
+}
+
+
+long
+ngindex_count(const ngindex_t *x)
+{
+    return x->count;
+}
+
+
+/*
+ * the name of program i of an index
+ */
+const char *
+ngindex_name(const ngindex_t *x, long i)
+{
+    int k;
+
+    for (k = 0; k < x->nsegs; ++k) {
+	if (i < x->segs[k].first + x->segs[k].count)
+		return x->segs[k].names[i - x->segs[k].first];
+    }
+
+    return NULL;
+}
+
+
+/*
+ * the postings of a key in one segment
+ * returns how many, *posts the first
+ */
+static long
+ngseg_find(const ngseg_t *s, unsigned long long key,
+	   const unsigned char **posts)
+{
+    const unsigned char *kp;
+    unsigned long long k;
+    long lo = 0, hi = s->nkeys, mid;
+
+    while (lo < hi) {
+	mid = lo + (hi - lo) / 2;
+	kp = s->keys + mid * NGI_KEYLEN;
+	k = get64(kp);
+	if (k == key) {
+		if (LONG(kp + 8) > (unsigned long)s->nposts ||
+		    LONG(kp + 12) > s->nposts - LONG(kp + 8))
+			return 0;
+		*posts = s->posts + LONG(kp + 8) * NGI_POSTLEN;
+		return LONG(kp + 12);
+	}
+	if (k < key)
+		lo = mid + 1;
+	else
+		hi = mid;
+    }
+
+    return 0;
+}
+
+
+/*
+ * whether a list of postings has (f, l), by binary search
+ */
+static int
+ngpost_has(const unsigned char *pp, long n, unsigned long f, unsigned long l)
+{
+    unsigned long pf, pl;
+    long mid;
+
+    while (n > 0) {
+	mid = n / 2;
+	pf = LONG(pp + mid * NGI_POSTLEN);
+	pl = LONG(pp + mid * NGI_POSTLEN + 4);
+	if (pf == f && pl == l)
+		return 1;
+	if (pf < f || (pf == f && pl < l)) {
+		pp += (mid + 1) * NGI_POSTLEN;
+		n -= mid + 1;
+	} else
+		n = mid;
+    }
+
+    return 0;
+}
+
+
+/*
+ * find the lines that have all the keys, in the order of the programs
+ * and of the lines in them; *hits is to be freed by the caller
+ * returns the number of lines found, or -1 if out of memory
+ */
+long
+ngindex_find(const ngindex_t *x, const unsigned long long *keys, int nkeys,
+	     ngpost_t **hits)
+{
+    const unsigned char **lists;
+    const unsigned char *pp;
+    ngpost_t *h = NULL, *np;
+    long *lens, n = 0, size = 0, i;
+    unsigned long f, l;
+    int s, k, best;
+
+    *hits = NULL;
+    if (nkeys <= 0)
+	return 0;
+    lists = malloc(nkeys * sizeof(*lists));
+    lens = malloc(nkeys * sizeof(*lens));
+    if (lists == NULL || lens == NULL)
+	goto oom;
+
+    for (s = 0; s < x->nsegs; ++s) {
+	/* walk the shortest list, looking the lines up in the others */
+	for (best = 0, k = 0; k < nkeys; ++k) {
+		lens[k] = ngseg_find(&x->segs[s], keys[k], &lists[k]);
+		if (lens[k] < lens[best])
+			best = k;
+	}
+
+	for (pp = lists[best], i = 0; i < lens[best]; ++i, pp += NGI_POSTLEN) {
+		f = LONG(pp);
+		l = LONG(pp + 4);
+		for (k = 0; k < nkeys; ++k) {
+			if (k != best && !ngpost_has(lists[k], lens[k], f, l))
+				break;
+		}
+		if (k < nkeys)
+			continue;
+		if (n == size) {
+			size = size ? 2 * size : 64;
+			if ((np = realloc(h, size * sizeof(ngpost_t))) == NULL)
+				goto oom;
+			h = np;
+		}
+		h[n].key = 0;
+		h[n].file = f;
+		h[n].line = l;
+		n++;
+	}
+    }
+    free(lists);
+    free(lens);
+    *hits = h;
+
+    return n;
+
+oom:
+    free(lists);
+    free(lens);
+    free(h);
+    return -1;
+}
+
+
+void
+ngindex_close(ngindex_t *x)
+{
+    int k;
+
+    if (x == NULL)
+	return;
+    for (k = 0; k < x->nsegs; ++k)
+	free((void *)x->segs[k].names);
+    free(x->segs);
+    unmapfile(x->data, x->size);
+    free(x);
+}
+
+
+/*
+ * add a segment to an index, creating it if need be: the names of nfiles
+ * programs and the keys of their lines, where ngpost_t.file counts from 0
+ * for the first of them. The keys are sorted in place. The old segments
+ * are left as they are, the new one is appended.
+ * returns 0 on success, -1 on error
+ */
+int
+ngindex_append(const char *path, char *const *names, long nfiles,
+	       ngpost_t *posts, long nposts)
+{
+    ngindex_t *x;
+    unsigned char *buf, *kp, *pp, *postsat, *sp;
+    long i, nkeys, len, first, valid, size;
+    FILE *fp;
+    int ret = 0;
+
+    /* Check that what is there is an index, and that it ends cleanly. */
+    if ((x = ngindex_open(path, 1)) == NULL)
+	return -1;
+    first = x->count;
+    valid = x->valid;
+    size = x->size;
+    ngindex_close(x);
+    if (valid != size)
+	return -1;
+    if (nfiles == 0)
+	return 0;
+
+    qsort(posts, nposts, sizeof(ngpost_t), postcmp);
+    for (i = 0, nkeys = 0; i < nposts; ++i) {
+	if (i == 0 || posts[i].key != posts[i - 1].key)
+		nkeys++;
+    }
+
+    len = NGI_HEADLEN + nkeys * NGI_KEYLEN + nposts * NGI_POSTLEN;
+    for (i = 0; i < nfiles; ++i)
+	len += strlen(names[i]) + 1;
+    if (len > 0x7fffffffL - size || (buf = malloc(len)) == NULL)
+	return -1;
+
+    kp = buf + NGI_HEADLEN;
+    postsat = pp = kp + nkeys * NGI_KEYLEN;
+    for (i = 0; i < nposts; ++i) {
+	if (i == 0 || posts[i].key != posts[i - 1].key) {
+		put32(kp, (unsigned long)(posts[i].key & 0xffffffffUL));
+		put32(kp + 4, (unsigned long)(posts[i].key >> 32));
+		put32(kp + 8, (pp - postsat) / NGI_POSTLEN);
+		put32(kp + 12, 0);
+		kp += NGI_KEYLEN;
+	} else if (posts[i].file == posts[i - 1].file &&
+		   posts[i].line == posts[i - 1].line)
+		continue;	// the same key twice in a line
+	put32(kp - 4, LONG(kp - 4) + 1);
+	put32(pp, first + posts[i].file);
+	put32(pp + 4, posts[i].line);
+	pp += NGI_POSTLEN;
+    }
+    for (sp = pp, i = 0; i < nfiles; ++i) {
+	strcpy((char *)sp, names[i]);
+	sp += strlen(names[i]) + 1;
+    }
+    len = sp - buf;
+
+    memcpy(buf, NGI_MAGIC, NGI_MAGICLEN);
+    put32(buf + 8, len);
+    put32(buf + 12, nfiles);
+    put32(buf + 16, first);
+    put32(buf + 20, nkeys);
+    put32(buf + 24, NGI_HEADLEN);
+    put32(buf + 28, postsat - buf);
+    put32(buf + 32, pp - buf);
+
+    if ((fp = fopen(path, "ab")) == NULL)
+	ret = -1;
+    else {
+	if (fwrite(buf, 1, len, fp) != (size_t)len)
+		ret = -1;
+	if (fclose(fp) != 0)
+		ret = -1;
+    }
+    free(buf);
+
+    return ret;
+}
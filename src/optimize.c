@@ -0,0 +1,1436 @@
+/*
+ * optimize.c, make a tokenized BASIC program run faster.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "tokens.h"
+#include "prgtools.h"
+
+
+/* the tokens the optimizer looks at */
+#define TOK_FOR		0x81
+#define TOK_NEXT	0x82
+#define TOK_DATA	0x83
+#define TOK_LET		0x88
+#define TOK_GOTO	0x89
+#define TOK_RUN		0x8a
+#define TOK_GOSUB	0x8d
+#define TOK_WAIT	0x92
+#define TOK_POKE	0x97
+#define TOK_PRINTN	0x98
+#define TOK_PRINT	0x99
+#define TOK_LIST	0x9b
+#define TOK_CLR		0x9c
+#define TOK_TAB		0xa3
+#define TOK_TO		0xa4
+#define TOK_FN		0xa5
+#define TOK_SPC		0xa6
+#define TOK_THEN	0xa7
+#define TOK_NOT		0xa8
+#define TOK_STEP	0xa9
+#define TOK_PLUS	0xaa
+#define TOK_MINUS	0xab
+#define TOK_MUL		0xac
+#define TOK_DIV		0xad
+#define TOK_POW		0xae
+#define TOK_AND		0xaf
+#define TOK_OR		0xb0
+#define TOK_GT		0xb1
+#define TOK_EQ		0xb2
+#define TOK_LT		0xb3
+#define TOK_SGN		0xb4
+#define TOK_INT		0xb5
+#define TOK_ABS		0xb6
+#define TOK_USR		0xb7
+#define TOK_SQR		0xba
+#define TOK_LOG		0xbc
+#define TOK_EXP		0xbd
+#define TOK_COS		0xbe
+#define TOK_SIN		0xbf
+#define TOK_TAN		0xc0
+#define TOK_ATN		0xc1
+#define TOK_STR		0xc4
+#define TOK_CHR		0xc7
+#define TOK_MID		0xca
+#define TOK_GO		0xcb
+#define TOK_PI		0xff
+
+#define OPT_MAXLINE	250	// longest line the optimizer makes
+#define OPT_MAXCONST	26	// constants made into variables, at most
+#define OPT_MAXTEXT	16	// longest constant that is
+#define OPT_MAXINT	999999999L	// largest result of folding
+
+#define ISDIGIT(c)	((c) >= '0' && (c) <= '9')
+#define ISLETTER(c)	((c) >= 'A' && (c) <= 'Z')
+#define NAMES		(26 * 37)	// first letter, then nothing, a letter or
+					// a digit
+
+/* The parts of a line, as the ROM reads them. */
+enum { IT_SPACE, IT_TOK, IT_NUM, IT_NAME, IT_RAW };
+
+typedef struct {
+    int		kind;		// IT_*
+    int		tok;		// IT_TOK: the token or character
+    int		off, len;	// where it is in the text
+    int		fixed;		// IT_NUM: has to stay as it is written
+} item_t;
+
+/* A line taken apart; nsp lists the items that are not spaces. */
+typedef struct {
+    unsigned char *text;
+    int		len, size;
+    item_t	*it;
+    int		n;
+    int		*nsp;
+    int		nn;
+} lexed_t;
+
+/* A line of the program between the passes. */
+typedef struct {
+    unsigned int number;
+    long	off, len;	// its text
+    long	saved;		// estimated cycles, each time it runs
+    long	perpass;	// and each pass of a loop of unknown length
+} optline_t;
+
+/* A constant that might become a variable. */
+typedef struct {
+    unsigned char text[OPT_MAXTEXT];
+    int		len;
+    long	uses;
+    long	gain;		// cycles for all the uses, before the search
+    int		var;		// its name, or -1
+} optconst_t;
+
+/* A part of an expression, in the items that are not spaces. */
+typedef struct {
+    int		a, b;		// items [a, b)
+    int		inv;		// the same on every pass of the loop
+    int		num;		// a number, not a string
+    int		safe;		// cannot stop the program with an error
+    int		work;		// has an operator or a function in it
+} node_t;
+
+typedef struct {
+    unsigned char used[NAMES];	// names the program has
+    unsigned char taken[NAMES];	// and those made up for hoisting
+    long	zeros, folds, hoists;
+    node_t	*cand;		// room for one line: what can be hoisted,
+    int		*var;		// the variable for each,
+    unsigned char *buf;		// and the line made again
+} optstate_t;
+
+
+/*
+ * take a line apart into spaces, tokens, numbers, names and the rest:
+ * strings, REMs, DATA, and the line numbers after GOTO, GOSUB, THEN and
+ * RUN, which are left alone. Spaces inside names and numbers are part of
+ * them, as the ROM skips them there.
+ */
+static void
+lex(lexed_t *l)
+{
+    const unsigned char *sp = l->text;
+    item_t *it;
+    int n = l->len, i = 0, j, k, last, point, digits;
+    int lines = 0;		// 1 for a line number next, 2 for a list
+    int c;
+
+    l->n = l->nn = 0;
+    while (i < n) {
+	it = &l->it[l->n];
+	it->off = i;
+	it->fixed = 0;
+	it->tok = 0;
+	c = sp[i];
+
+	if (c == ' ') {
+		while (i < n && sp[i] == ' ')
+			++i;
+		it->kind = IT_SPACE;
+	} else if (lines && ISDIGIT(c)) {
+		while (i < n && (ISDIGIT(sp[i]) || sp[i] == ' ' ||
+				 (lines == 2 && sp[i] == ',')))
+			++i;
+		it->kind = IT_RAW;
+		lines = 0;
+	} else if (c == '"') {
+		for (++i; i < n && sp[i] != '"'; ++i)
+			;
+		if (i < n)
+			++i;
+		it->kind = IT_RAW;
+	} else if (c == TOKEN_REM || c == TOK_LIST) {
+		/* the rest of the line, or of the statement */
+		for (++i; c == TOK_LIST && i < n && sp[i] != ':'; ++i)
+			;
+		if (c == TOKEN_REM)
+			i = n;
+		it->kind = IT_RAW;
+	} else if (c == TOK_DATA) {
+		for (++i, k = 0; i < n && (k || sp[i] != ':'); ++i) {
+			if (sp[i] == '"')
+				k = !k;
+		}
+		it->kind = IT_RAW;
+	} else if (ISLETTER(c)) {
+		for (j = last = i + 1; j < n && (ISLETTER(sp[j]) ||
+		     ISDIGIT(sp[j]) || sp[j] == ' '); ++j) {
+			if (sp[j] != ' ')
+				last = j + 1;
+		}
+		for (j = last; j < n && sp[j] == ' '; ++j)
+			;
+		i = j < n && (sp[j] == '$' || sp[j] == '%') ? j + 1 : last;
+		it->kind = IT_NAME;
+	} else if (ISDIGIT(c) || c == '.') {
+		point = digits = 0;
+		for (j = last = i; j < n; ++j) {
+			if (ISDIGIT(sp[j]))
+				digits++;
+			else if (sp[j] == '.' && !point)
+				point = 1;
+			else if (sp[j] != ' ')
+				break;
+			if (sp[j] != ' ')
+				last = j + 1;
+		}
+		for (j = last; j < n && sp[j] == ' '; ++j)
+			;
+		if (j < n && sp[j] == 'E' && digits > 0) {
+			/* an exponent, or an E the ROM would take for one */
+			for (++j; j < n && sp[j] == ' '; ++j)
+				;
+			if (j < n && (sp[j] == '-' || sp[j] == '+' ||
+				      sp[j] == TOK_MINUS || sp[j] == TOK_PLUS))
+				++j;
+			for (k = j; j < n && (ISDIGIT(sp[j]) || sp[j] == ' '); ++j) {
+				if (sp[j] != ' ')
+					last = j + 1;
+			}
+			if (last <= k)
+				it->fixed = 1;
+		} else if (j < n && (sp[j] == 'E' || sp[j] == '.'))
+			it->fixed = 1;
+		i = last;
+		it->kind = IT_NUM;
+	} else {
+		++i;
+		it->kind = IT_TOK;
+		it->tok = c;
+		if (c == TOK_GOTO || c == TOK_GOSUB ||
+		    (c == TOK_TO && l->nn > 0 &&
+		     l->it[l->nsp[l->nn - 1]].tok == TOK_GO))
+			lines = 2;
+		else if (c == TOK_THEN || c == TOK_RUN)
+			lines = 1;
+		else
+			lines = 0;
+	}
+
+	it->len = i - it->off;
+	if (it->kind != IT_SPACE) {
+		if (it->kind != IT_TOK)
+			lines = 0;
+		l->nsp[l->nn++] = l->n;
+	}
+	l->n++;
+    }
+}
+
+
+/*
+ * copy the text of a constant without its spaces
+ * returns its length
+ */
+static int
+littext(const unsigned char *sp, int len, unsigned char *dst)
+{
+    int n = 0;
+
+    for (; len > 0; --len, ++sp) {
+	if (*sp != ' ')
+		dst[n++] = *sp;
+    }
+
+    return n;
+}
+
+
+static double
+litvalue(const unsigned char *sp, int len)
+{
+    char buf[64];
+    int n = 0;
+
+    for (; len > 0 && n < 62; --len, ++sp) {
+	if (*sp == TOK_MINUS)
+		buf[n++] = '-';
+	else if (*sp != ' ' && *sp != TOK_PLUS)
+		buf[n++] = *sp;
+    }
+    buf[n] = '\0';
+
+    return strtod(buf, NULL);
+}
+
+
+/*
+ * the cycles the ROM takes to read a constant, as bas_run() counts them
+ */
+static long
+litcost(const unsigned char *sp, int len)
+{
+    long n = 1;
+
+    for (; len > 0; --len, ++sp) {
+	if (*sp != ' ' && *sp != '.')
+		n++;
+    }
+
+    return C_DIGIT * n + C_CHRGET * len;
+}
+
+
+/*
+ * a constant with only digits in it, that folding can work on
+ * returns its value, or -1
+ */
+static long
+intvalue(const lexed_t *l, const item_t *it)
+{
+    const unsigned char *sp = l->text + it->off;
+    long v = 0;
+    int i, n = 0;
+
+    if (it->kind != IT_NUM || it->fixed)
+	return -1;
+    for (i = 0; i < it->len; ++i) {
+	if (sp[i] == ' ')
+		continue;
+	if (!ISDIGIT(sp[i]) || ++n > 9)
+		return -1;
+	v = v * 10 + sp[i] - '0';
+    }
+
+    return v;
+}
+
+
+/*
+ * the index of a name in used[] and taken[]; only the first two
+ * characters count. *type is 0 for a number, 1 for an integer, 2 for a
+ * string.
+ */
+static int
+namekey(const lexed_t *l, const item_t *it, int *type)
+{
+    const unsigned char *sp = l->text + it->off;
+    int i, second = 0;
+
+    for (i = 1; i < it->len && sp[i] != '$' && sp[i] != '%'; ++i) {
+	if (sp[i] == ' ')
+		continue;
+	if (second == 0)
+		second = ISLETTER(sp[i]) ? sp[i] - 'A' + 1 : sp[i] - '0' + 27;
+    }
+    *type = sp[it->len - 1] == '$' ? 2 : sp[it->len - 1] == '%' ? 1 : 0;
+
+    return (sp[0] - 'A') * 37 + second;
+}
+
+
+/* a name of a letter and a digit, as text */
+static void
+keyname(int key, unsigned char *dst)
+{
+    dst[0] = 'A' + key / 37;
+    dst[1] = '0' + key % 37 - 27;
+}
+
+
+/*
+ * a name of a letter and a digit the program does not have, from Z0 down
+ * returns its key, or -1 if there is none
+ */
+static int
+freename(const optstate_t *o, const unsigned char *also)
+{
+    int letter, digit, key;
+
+    for (letter = 25; letter >= 0; --letter) {
+	for (digit = 0; digit < 10; ++digit) {
+		key = letter * 37 + 27 + digit;
+		if (!o->used[key] && !(also != NULL && also[key]))
+			return key;
+	}
+    }
+
+    return -1;
+}
+
+
+static const item_t *
+nsp(const lexed_t *l, int pos)
+{
+    return pos >= 0 && pos < l->nn ? &l->it[l->nsp[pos]] : NULL;
+}
+
+
+static int
+istok(const item_t *it, int tok)
+{
+    return it != NULL && it->kind == IT_TOK && it->tok == tok;
+}
+
+
+/* how tightly an operator binds, as the ROM's table has it */
+static int
+prec(const item_t *it, int unary)
+{
+    if (it == NULL || it->kind != IT_TOK)
+	return 0;
+    switch (it->tok) {
+    case TOK_PLUS:
+    case TOK_MINUS:
+	return unary ? 0x7d : 0x79;
+    case TOK_MUL:
+    case TOK_DIV:
+	return 0x7b;
+    case TOK_POW:
+	return 0x7f;
+    }
+
+    return 0;
+}
+
+
+/*
+ * put new text in place of the items [a, b] (not spaces) of a line
+ */
+static void
+replace(lexed_t *l, int a, int b, const unsigned char *text, int len)
+{
+    int from = l->it[l->nsp[a]].off;
+    int to = l->it[l->nsp[b]].off + l->it[l->nsp[b]].len;
+
+    memmove(l->text + from + len, l->text + to, l->len - to);
+    memcpy(l->text + from, text, len);
+    l->len += len - (to - from);
+    lex(l);
+}
+
+
+/*
+ * fold one sum, difference, product or quotient of two whole numbers into
+ * its value, where that leaves the meaning of what is around it alone and
+ * the C64 would get exactly the same
+ * returns the cycles saved, or 0 if there was nothing to fold
+ */
+static long
+fold(lexed_t *l)
+{
+    const item_t *x, *op, *y, *prev, *before;
+    unsigned char buf[16];
+    long a, b, v, cost;
+    int pos, n, unary, opcost;
+
+    for (pos = 0; pos + 2 < l->nn; ++pos) {
+	x = nsp(l, pos);
+	op = nsp(l, pos + 1);
+	y = nsp(l, pos + 2);
+	if ((a = intvalue(l, x)) < 0 || (b = intvalue(l, y)) < 0 ||
+	    op->kind != IT_TOK)
+		continue;
+
+	switch (op->tok) {
+	case TOK_PLUS:
+		v = a + b;
+		opcost = C_ADD;
+		break;
+	case TOK_MINUS:
+		v = a - b;
+		opcost = C_ADD;
+		break;
+	case TOK_MUL:
+		if (a != 0 && b > OPT_MAXINT / a)
+			continue;
+		v = a * b;
+		opcost = C_MUL;
+		break;
+	case TOK_DIV:
+		if (b == 0 || a % b != 0)
+			continue;
+		v = a / b;
+		opcost = C_DIV;
+		break;
+	default:
+		continue;
+	}
+	if (v < 0 || v > OPT_MAXINT)
+		continue;
+
+	/* A minus before is unary after an operator or at the start. */
+	prev = nsp(l, pos - 1);
+	before = nsp(l, pos - 2);
+	unary = before == NULL || !(before->kind == IT_NUM ||
+		before->kind == IT_NAME || istok(before, ')') ||
+		(before->kind == IT_RAW && l->text[before->off] == '"'));
+	if (prec(prev, unary) >= prec(op, 0) ||
+	    prec(nsp(l, pos + 3), 0) > prec(op, 0))
+		continue;
+
+	cost = litcost(l->text + x->off, x->len) +
+	       litcost(l->text + y->off, y->len) + opcost +
+	       C_CHRGET * (y->off + y->len - x->off);
+	n = sprintf((char *)buf, "%ld", v);
+	replace(l, pos, pos + 2, buf, n);
+
+	return cost - litcost(buf, n);
+    }
+
+    return 0;
+}
+
+
+/*
+ * Hoisting looks at a FOR loop that ends on its own line, where it can
+ * see everything that runs on each pass: assignments, PRINT, POKE, WAIT
+ * and other such loops. Anything that jumps, reads input or calls machine
+ * code means it is left alone. An expression that uses none of the
+ * variables assigned in the loop is worked out once before the FOR, into
+ * a variable of its own.
+ */
+
+typedef struct {
+    const lexed_t *l;
+    int		pos, end;
+    const unsigned char *assigned;	// by namekey() * 3 + type
+    node_t	*cand;		// what can be hoisted
+    int		ncand;
+    int		bad;		// something that is not understood
+} parse_t;
+
+
+static void	p_expr(parse_t *p, node_t *v, int level);
+
+
+static int
+peek(const parse_t *p)
+{
+    const item_t *it;
+
+    if (p->pos >= p->end)
+	return -1;
+    it = nsp(p->l, p->pos);
+    return it->kind == IT_TOK ? it->tok : 0x100 + it->kind;
+}
+
+
+static void
+expect(parse_t *p, int tok)
+{
+    if (peek(p) != tok)
+	p->bad = 1;
+    else
+	p->pos++;
+}
+
+
+/*
+ * an invariant part whose whole is not: the most that can be hoisted
+ */
+static void
+settle(parse_t *p, const node_t *v)
+{
+    if (v->inv && v->num && v->safe && v->work)
+	p->cand[p->ncand++] = *v;
+}
+
+
+/* an expression on its own, such as an argument */
+static void
+p_top(parse_t *p, node_t *v)
+{
+    p_expr(p, v, 0);
+    settle(p, v);
+}
+
+
+
+
+/*
+ * a name, an array element, a constant, a function or an expression in
+ * parentheses
+ */
+static void
+p_atom(parse_t *p, node_t *v)
+{
+    const item_t *it = nsp(p->l, p->pos);
+    node_t args[3];
+    int start = p->pos, c = peek(p), key, type, n, i;
+
+    v->inv = v->num = v->safe = 1;
+    v->work = 0;
+    if (c == 0x100 + IT_NUM || c == TOK_PI) {
+	p->pos++;
+    } else if (c == 0x100 + IT_NAME) {
+	key = namekey(p->l, it, &type);
+	p->pos++;
+	v->num = type != 2;
+	if (peek(p) == '(') {
+		/* an element can change without its name in the loop */
+		v->inv = 0;
+		for (p->pos++; !p->bad; p->pos++) {
+			p_top(p, &args[0]);
+			if (peek(p) != ',')
+				break;
+		}
+		expect(p, ')');
+	} else {
+		/* and TI and ST change by themselves */
+		v->inv = v->num && !p->assigned[key * 3 + type] &&
+			 key != ('T' - 'A') * 37 + 'I' - 'A' + 1 &&
+			 key != ('S' - 'A') * 37 + 'T' - 'A' + 1;
+	}
+    } else if (c == '(') {
+	p->pos++;
+	p_expr(p, v, 0);
+	expect(p, ')');
+    } else if (c == TOK_FN || c == TOK_TAB || c == TOK_SPC) {
+	/* TAB( and SPC( have their parenthesis in the token */
+	p->pos++;
+	if (c == TOK_FN) {
+		expect(p, 0x100 + IT_NAME);
+		expect(p, '(');
+	}
+	p_top(p, &args[0]);
+	expect(p, ')');
+	v->inv = 0;
+	v->work = 1;
+    } else if (c >= TOK_SGN && c <= TOK_MID) {
+	p->pos++;
+	expect(p, '(');
+	for (n = 0; !p->bad && n < 3; ) {
+		p_expr(p, &args[n++], 0);
+		if (peek(p) != ',')
+			break;
+		p->pos++;
+	}
+	expect(p, ')');
+
+	for (i = 0; i < n; ++i) {
+		v->inv &= args[i].inv;
+		v->safe &= args[i].safe;
+	}
+	switch (c) {
+	case TOK_SGN: case TOK_INT: case TOK_ABS:
+	case TOK_COS: case TOK_SIN: case TOK_ATN:
+		break;
+	case TOK_SQR: case TOK_LOG: case TOK_EXP: case TOK_TAN:
+		v->safe = 0;	// these can fail
+		break;
+	case TOK_USR:
+		p->bad = 1;
+		break;
+	default:
+		v->inv = 0;	// PEEK, RND, FRE and the string functions
+		break;
+	}
+	v->num = c != TOK_STR && c < TOK_CHR;
+	v->work = 1;
+	for (i = 0; i < n && !v->inv; ++i)
+		settle(p, &args[i]);
+    } else if (c == 0x100 + IT_RAW && p->l->text[it->off] == '"') {
+	p->pos++;
+	v->inv = v->num = 0;
+    } else
+	p->bad = 1;
+
+    v->a = start;
+    v->b = p->pos;
+}
+
+
+/* the operators of each level of an expression, loosest first */
+static int
+isop(int tok, int level)
+{
+    switch (level) {
+    case 0:
+	return tok == TOK_OR;
+    case 1:
+	return tok == TOK_AND;
+    case 3:
+	return tok == TOK_GT || tok == TOK_EQ || tok == TOK_LT;
+    case 4:
+	return tok == TOK_PLUS || tok == TOK_MINUS;
+    case 5:
+	return tok == TOK_MUL || tok == TOK_DIV;
+    case 7:
+	return tok == TOK_POW;
+    }
+
+    return 0;
+}
+
+
+/*
+ * an expression from the given level of precedence on: OR, AND, NOT,
+ * comparisons, + and -, * and /, unary minus, ^, then atoms
+ */
+static void
+p_expr(parse_t *p, node_t *v, int level)
+{
+    const item_t *it;
+    node_t r;
+    int tok, start = p->pos;
+    double d;
+
+    if (p->bad) {
+	v->inv = 0;
+	return;
+    }
+    if ((level == 2 && peek(p) == TOK_NOT) ||
+	(level == 6 && (peek(p) == TOK_MINUS || peek(p) == TOK_PLUS))) {
+	tok = peek(p);
+	p->pos++;
+	p_expr(p, v, level);
+	v->a = start;
+	v->work = 1;
+	if (tok == TOK_NOT)
+		v->safe = 0;	// only for 16-bit numbers
+	return;
+    }
+    if (level == 8) {
+	p_atom(p, v);
+	return;
+    }
+
+    p_expr(p, v, level + 1);
+    while (!p->bad && isop(peek(p), level)) {
+	tok = peek(p);
+	for (p->pos++; level == 3 && isop(peek(p), 3); p->pos++)
+		;		// <=, >= and <>
+	p_expr(p, &r, level == 7 ? 6 : level + 1);
+
+	/* The invariant side of a part that is not is as far as it goes. */
+	if (v->inv && !r.inv)
+		settle(p, v);
+	else if (!v->inv && r.inv)
+		settle(p, &r);
+	v->b = r.b;
+	v->inv &= r.inv;
+	v->num = level <= 3 ? 1 : v->num && r.num;
+	v->safe &= r.safe;
+	v->work = 1;
+
+	/* dividing by a constant that is not 0 cannot fail */
+	it = nsp(p->l, r.a);
+	if (tok == TOK_DIV) {
+		d = r.b == r.a + 1 && it->kind == IT_NUM ?
+		    litvalue(p->l->text + it->off, it->len) : 0;
+		if (d == 0)
+			v->safe = 0;
+	} else if (tok == TOK_POW || tok == TOK_AND || tok == TOK_OR)
+		v->safe = 0;
+    }
+}
+
+
+/*
+ * the statements items [s, e) can be, in a loop that is hoisted from; the
+ * expressions in them are parsed for candidates
+ */
+static void
+p_stmt(parse_t *p, int s, int e)
+{
+    node_t v;
+    int tok;
+
+    p->pos = s;
+    p->end = e;
+    tok = peek(p);
+    if (tok == TOK_LET) {
+	p->pos++;
+	tok = peek(p);
+    }
+
+    if (tok == 0x100 + IT_NAME) {
+	p->pos++;
+	if (peek(p) == '(') {
+		for (p->pos++; !p->bad; p->pos++) {
+			p_top(p, &v);
+			if (peek(p) != ',')
+				break;
+		}
+		expect(p, ')');
+	}
+	expect(p, TOK_EQ);
+	p_top(p, &v);
+    } else if (tok == TOK_PRINT || tok == TOK_PRINTN) {
+	for (p->pos++; !p->bad && p->pos < e; ) {
+		if (peek(p) == ',' || peek(p) == ';')
+			p->pos++;
+		else
+			p_top(p, &v);
+	}
+    } else if (tok == TOK_POKE || tok == TOK_WAIT) {
+	for (p->pos++; !p->bad; p->pos++) {
+		p_top(p, &v);
+		if (peek(p) != ',')
+			break;
+	}
+    } else if (tok == TOK_FOR) {
+	p->pos++;
+	expect(p, 0x100 + IT_NAME);
+	expect(p, TOK_EQ);
+	p_top(p, &v);
+	expect(p, TOK_TO);
+	p_top(p, &v);
+	if (peek(p) == TOK_STEP) {
+		p->pos++;
+		p_top(p, &v);
+	}
+    } else if (tok == TOK_NEXT) {
+	p->pos = e;
+    } else
+	p->bad = 1;
+
+    if (p->pos != e)
+	p->bad = 1;
+}
+
+
+/*
+ * the cycles an expression takes, roughly as bas_run() counts them
+ */
+static long
+exprcost(const lexed_t *l, int a, int b)
+{
+    const item_t *it;
+    long cost = 0;
+    int pos;
+
+    for (pos = a; pos < b; ++pos) {
+	it = nsp(l, pos);
+	if (it->kind == IT_NUM) {
+		cost += litcost(l->text + it->off, it->len);
+		continue;
+	}
+	if (it->kind == IT_NAME)
+		cost += C_VAR;
+	else if (it->tok == TOK_PLUS || it->tok == TOK_MINUS)
+		cost += C_ADD;
+	else if (it->tok == TOK_MUL)
+		cost += C_MUL;
+	else if (it->tok == TOK_DIV)
+		cost += C_DIV;
+	else if (it->tok == TOK_GT || it->tok == TOK_EQ || it->tok == TOK_LT)
+		cost += C_CMP;
+	else if (it->tok == TOK_SGN || it->tok == TOK_INT || it->tok == TOK_ABS)
+		cost += C_INT;
+	else if (it->tok >= TOK_SQR && it->tok <= TOK_ATN)
+		cost += C_TRANS;
+	cost += C_CHRGET * it->len;
+    }
+
+    return cost;
+}
+
+
+/*
+ * the end of the statement that starts at items[s]
+ */
+static int
+stmtend(const lexed_t *l, int s)
+{
+    while (s < l->nn && !istok(nsp(l, s), ':'))
+	++s;
+
+    return s;
+}
+
+
+/*
+ * the text of a part of an expression
+ * returns its length
+ */
+static int
+span(const lexed_t *l, const node_t *v, const unsigned char **text)
+{
+    const item_t *first = nsp(l, v->a), *last = nsp(l, v->b - 1);
+
+    *text = l->text + first->off;
+    return last->off + last->len - first->off;
+}
+
+
+static int
+candcmp(const void *a, const void *b)
+{
+    return ((const node_t *)a)->a - ((const node_t *)b)->a;
+}
+
+
+/*
+ * hoist what can be from the FOR loop at items[f], if it ends on this
+ * line
+ * returns 1 if the line was changed, adding the cycles saved each time
+ * the line runs to *saved, or to *perpass for each pass if the number of
+ * passes is not known
+ */
+static int
+hoist(optstate_t *o, lexed_t *l, int f, long *saved, long *perpass)
+{
+    unsigned char assigned[NAMES * 3], temps[NAMES];
+    const unsigned char *text, *t2;
+    unsigned char *dp;
+    const item_t *it;
+    node_t *cand = o->cand;
+    int *var = o->var;
+    parse_t p;
+    long passes = 0, cost, each = 0, once = 0;
+    double from, to, step = 1;
+    int body, s, e, depth, names, type, i, k, n, len, newlen;
+
+    /* FOR v=a TO b [STEP c], with the number of passes if they are
+     * constants */
+    e = stmtend(l, f);
+    it = nsp(l, f + 1);
+    if (it == NULL || it->kind != IT_NAME || !istok(nsp(l, f + 2), TOK_EQ))
+	return 0;
+    memset(assigned, 0, sizeof(assigned));
+    assigned[namekey(l, it, &type) * 3 + type] = 1;
+    if ((e - f == 6 || (e - f == 8 && istok(nsp(l, f + 6), TOK_STEP) &&
+			nsp(l, f + 7)->kind == IT_NUM)) &&
+	nsp(l, f + 3)->kind == IT_NUM && istok(nsp(l, f + 4), TOK_TO) &&
+	nsp(l, f + 5)->kind == IT_NUM) {
+	it = nsp(l, f + 3);
+	from = litvalue(l->text + it->off, it->len);
+	it = nsp(l, f + 5);
+	to = litvalue(l->text + it->off, it->len);
+	if (e - f == 8) {
+		it = nsp(l, f + 7);
+		step = litvalue(l->text + it->off, it->len);
+	}
+	passes = step > 0 && to >= from ? (long)((to - from) / step) + 1 : 1;
+    }
+
+    /* The loop ends with the NEXT that takes it off the stack; what is
+     * assigned on the way cannot be hoisted. */
+    body = e + 1;
+    for (depth = 0, s = body; s < l->nn; s = e + 1) {
+	e = stmtend(l, s);
+	if (istok(nsp(l, s), TOK_NEXT)) {
+		for (names = 0, i = s + 1; i < e; ++i)
+			names += nsp(l, i)->kind == IT_NAME;
+		depth -= names ? names : 1;
+		if (depth < 0)
+			break;
+		continue;
+	}
+	if (istok(nsp(l, s), TOK_FOR))
+		depth++;
+	i = istok(nsp(l, s), TOK_FOR) || istok(nsp(l, s), TOK_LET) ? s + 1 : s;
+	it = nsp(l, i);
+	if (it != NULL && it->kind == IT_NAME && !istok(nsp(l, i + 1), '('))
+		assigned[namekey(l, it, &type) * 3 + type] = 1;
+    }
+    if (s >= l->nn)
+	return 0;
+
+    memset(&p, 0, sizeof(p));
+    p.l = l;
+    p.assigned = assigned;
+    p.cand = cand;
+    for (i = body; i < s && !p.bad; i = e + 1) {
+	e = stmtend(l, i);
+	p_stmt(&p, i, e);
+    }
+    if (p.bad || p.ncand == 0)
+	return 0;
+    qsort(cand, p.ncand, sizeof(node_t), candcmp);
+
+    /* Each expression gets a variable, the same text the same one. */
+    memset(temps, 0, sizeof(temps));
+    for (i = 0; i < l->nn; ++i) {
+	it = nsp(l, i);
+	if (it->kind == IT_NAME)
+		temps[namekey(l, it, &type)] = 1;
+    }
+    newlen = l->len;
+    for (k = n = 0; k < p.ncand; ++k) {
+	var[k] = -1;
+	it = nsp(l, cand[k].b);
+	if (it != NULL && (it->kind == IT_NAME || it->kind == IT_NUM))
+		continue;		// it would run into the name
+	len = span(l, &cand[k], &text);
+	cost = exprcost(l, cand[k].a, cand[k].b);
+	for (i = 0; i < k; ++i) {
+		if (var[i] >= 0 && span(l, &cand[i], &t2) == len &&
+		    !memcmp(text, t2, len))
+			break;
+	}
+	if (i < k)
+		var[k] = var[i];
+	else if ((var[k] = freename(o, temps)) >= 0) {
+		temps[var[k]] = 1;
+		o->taken[var[k]] = 1;
+		newlen += len + 4;	// "T0=", the expression and ":"
+		once += C_STMT + C_VAR + cost + C_CHRGET * 4;
+		n++;
+	} else
+		continue;
+	newlen -= len - 2;
+	each += cost - C_VAR - C_CHRGET * 2;
+    }
+    if (n == 0 || (newlen > OPT_MAXLINE && newlen > l->len))
+	return 0;
+
+    /* the line again, with the assignments before the FOR */
+    it = nsp(l, f);
+    memcpy(o->buf, l->text, it->off);
+    dp = o->buf + it->off;
+    for (k = 0; k < p.ncand; ++k) {
+	for (i = 0; i < k && var[i] != var[k]; ++i)
+		;
+	if (var[k] < 0 || i < k)
+		continue;
+	keyname(var[k], dp);
+	dp[2] = TOK_EQ;
+	len = span(l, &cand[k], &text);
+	memcpy(dp + 3, text, len);
+	dp[3 + len] = ':';
+	dp += 4 + len;
+    }
+    for (i = it->off, k = 0; k <= p.ncand; ++k) {
+	while (k < p.ncand && var[k] < 0)
+		++k;
+	e = k < p.ncand ? nsp(l, cand[k].a)->off : l->len;
+	memcpy(dp, l->text + i, e - i);
+	dp += e - i;
+	if (k == p.ncand)
+		break;
+	keyname(var[k], dp);
+	dp += 2;
+	i = e + span(l, &cand[k], &text);
+    }
+
+    l->len = dp - o->buf;
+    memcpy(l->text, o->buf, l->len);
+    lex(l);
+    o->hoists += n;
+    if (passes > 0)
+	*saved += passes * each - once;
+    else {
+	*saved -= once;
+	*perpass += each;
+    }
+
+    return 1;
+}
+
+
+/*
+ * whether the constant at items[pos] can be written another way: as "."
+ * for 0, or as a variable
+ * returns 0 if not, 1 for a zero, 2 for anything else
+ */
+static int
+eligible(const lexed_t *l, int pos)
+{
+    const item_t *it = nsp(l, pos), *next = nsp(l, pos + 1);
+
+    if (it->kind != IT_NUM || it->fixed)
+	return 0;
+    if (litvalue(l->text + it->off, it->len) == 0)
+	return 1;
+    if (it->len > OPT_MAXTEXT)
+	return 0;
+    if (next != NULL && (next->kind == IT_NAME || next->kind == IT_NUM ||
+			 istok(next, '(') || istok(next, '$') ||
+			 istok(next, '%')))
+	return 0;		// the name would run into what follows
+
+    return 2;
+}
+
+
+/* the cycles saved on each use of a constant made into the kth variable */
+static long
+constgain(const optconst_t *c, int k)
+{
+    return litcost(c->text, c->len) - C_VAR - C_VARSCAN * k - C_CHRGET * 2;
+}
+
+
+static int
+gaincmp(const void *a, const void *b)
+{
+    const optconst_t *x = (const optconst_t *)a, *y = (const optconst_t *)b;
+
+    return x->gain < y->gain ? 1 : x->gain > y->gain ? -1 :
+	   x->len - y->len;
+}
+
+
+/*
+ * write a line again into dp with zeros as "." and, if subst is set, the
+ * constants that became variables as their names, counting their uses
+ * returns its length
+ */
+static int
+rewrite(optstate_t *o, const lexed_t *l, optconst_t *consts,
+	int nconst, int subst, unsigned char *dp, long *saved)
+{
+    unsigned char *start = dp, buf[OPT_MAXTEXT];
+    const item_t *it;
+    int i, k, n, e, len;
+
+    for (i = k = 0; i < l->n; ++i) {
+	it = &l->it[i];
+	if (it->kind == IT_SPACE || l->nsp[k] != i) {
+		memcpy(dp, l->text + it->off, it->len);
+		dp += it->len;
+		continue;
+	}
+	e = eligible(l, k++);
+	if (e == 1 && (it->len != 1 || l->text[it->off] != '.')) {
+		*dp++ = '.';
+		*saved += litcost(l->text + it->off, it->len) -
+			  litcost((const unsigned char *)".", 1);
+		o->zeros++;
+		continue;
+	}
+	if (e == 2 && subst) {
+		len = littext(l->text + it->off, it->len, buf);
+		for (n = 0; n < nconst; ++n) {
+			if (consts[n].len == len && !memcmp(consts[n].text, buf, len))
+				break;
+		}
+		if (n < nconst) {
+			keyname(consts[n].var, dp);
+			dp += 2;
+			consts[n].uses++;
+			*saved += constgain(&consts[n], n) +
+				  C_CHRGET * (it->len - len);
+			continue;
+		}
+	}
+	memcpy(dp, l->text + it->off, it->len);
+	dp += it->len;
+    }
+
+    return dp - start;
+}
+
+
+/*
+ * optimize a tokenized BASIC V2 program for speed, appended to out:
+ * constants are folded, invariant expressions hoisted out of FOR loops
+ * that end on their own line, zeros written as "." and the constants used
+ * most made into variables set on a new line before the first; the
+ * cycles saved are estimated for each line, as bas_run() counts them
+ * returns 0 on success, -1 on error (reason in diag->error)
+ *
+ * Note: as with crunching, programs that keep machine code after their
+ * end, or read their own text, must not be optimized.
+ */
+int
+prg_optimize(const unsigned char *prg, long len, outbuf_t *out,
+	     const prgopts_t *opts, diag_t *diag)
+{
+    const unsigned char *sp, *le, *ep = prg + len;
+    optstate_t o;
+    optline_t *lines = NULL, *lp;
+    optconst_t *consts = NULL, *c;
+    lexed_t l;
+    outbuf_t text;
+    unsigned char buf[OPT_MAXTEXT], *dp;
+    long load, nlines = 0, nalloc = 0, maxlen = 0, i, refs = 0;
+    long gain, zeros, linerefs, initcost = 0, before[OPT_MAXCONST];
+    size_t start = out->len, cur;
+    int nconst = 0, ncand = 0, clear = 0, initlen = 0;
+    int pos, k, n, type;
+
+    if (opts->dialect != DIALECT_V2)
+	return diag_error(diag, "optimizing is only for BASIC V2");
+    if (len < 2)
+	return diag_error(diag, "no load address");
+    load = prg[0] | (prg[1] << 8);
+
+    for (sp = prg + 2; ep - sp >= 4 && (sp[0] | sp[1]) != 0; sp = le + 1) {
+	if ((le = memchr(sp + 4, 0, ep - sp - 4)) == NULL)
+		le = ep;
+	if (le - sp - 4 > maxlen)
+		maxlen = le - sp - 4;
+	nlines++;
+	if (le == ep)
+		break;
+    }
+
+    memset(&o, 0, sizeof(o));
+    memset(&l, 0, sizeof(l));
+    memset(&text, 0, sizeof(text));
+    l.size = (maxlen > OPT_MAXLINE ? maxlen : OPT_MAXLINE) + 1;
+    l.text = malloc(l.size);
+    l.it = malloc(l.size * sizeof(item_t));
+    l.nsp = malloc(l.size * sizeof(int));
+    o.cand = malloc(l.size * sizeof(node_t));
+    o.var = malloc(l.size * sizeof(int));
+    o.buf = malloc(l.size);
+    lines = malloc((nlines + 1) * sizeof(optline_t));
+    if (l.text == NULL || l.it == NULL || l.nsp == NULL || o.cand == NULL ||
+	o.var == NULL || o.buf == NULL || lines == NULL)
+	goto oom;
+
+    /* First the names the program has, and whether it clears them. */
+    for (sp = prg + 2; ep - sp >= 4 && (sp[0] | sp[1]) != 0; sp = le + 1) {
+	if ((le = memchr(sp + 4, 0, ep - sp - 4)) == NULL)
+		le = ep;
+	l.len = le - sp - 4;
+	memcpy(l.text, sp + 4, l.len);
+	lex(&l);
+	for (pos = 0; pos < l.nn; ++pos) {
+		if (nsp(&l, pos)->kind == IT_NAME)
+			o.used[namekey(&l, nsp(&l, pos), &type)] = 1;
+		clear |= istok(nsp(&l, pos), TOK_CLR) ||
+			 istok(nsp(&l, pos), TOK_RUN);
+	}
+	if (le == ep)
+		break;
+    }
+
+    /* Then fold and hoist in each line, keeping what is left. */
+    lp = lines;
+    for (sp = prg + 2; ep - sp >= 4 && (sp[0] | sp[1]) != 0; sp = le + 1) {
+	if ((le = memchr(sp + 4, 0, ep - sp - 4)) == NULL)
+		le = ep;
+	lp->number = sp[2] | (sp[3] << 8);
+	lp->saved = lp->perpass = 0;
+	l.len = le - sp - 4;
+	memcpy(l.text, sp + 4, l.len);
+	lex(&l);
+	while ((gain = fold(&l)) != 0) {
+		lp->saved += gain;
+		o.folds++;
+	}
+	for (pos = 0; pos < l.nn; ++pos) {
+		if (!istok(nsp(&l, pos), TOK_FOR) || (pos > 0 &&
+		    !istok(nsp(&l, pos - 1), ':') &&
+		    !istok(nsp(&l, pos - 1), TOK_THEN)))
+			continue;
+		if (hoist(&o, &l, pos, &lp->saved, &lp->perpass)) {
+			while (!istok(nsp(&l, pos), TOK_FOR))
+				++pos;
+		}
+	}
+
+	if (outbuf_reserve(&text, l.len) < 0)
+		goto oom;
+	memcpy(&text.buf[text.len], l.text, l.len);
+	lp->off = text.len;
+	lp->len = l.len;
+	text.len += l.len;
+	lp++;
+	if (le == ep)
+		break;
+    }
+
+    /* How often each constant is written, and how often any name is. */
+    for (lp = lines; lp < lines + nlines; ++lp) {
+	l.len = lp->len;
+	memcpy(l.text, &text.buf[lp->off], l.len);
+	lex(&l);
+	for (pos = 0; pos < l.nn; ++pos) {
+		refs += nsp(&l, pos)->kind == IT_NAME;
+		if (clear || lines[0].number == 0 || eligible(&l, pos) != 2)
+			continue;		// no room for a line before the first
+		n = littext(l.text + nsp(&l, pos)->off, nsp(&l, pos)->len, buf);
+		for (k = 0; k < ncand; ++k) {
+			if (consts[k].len == n && !memcmp(consts[k].text, buf, n))
+				break;
+		}
+		if (k == ncand) {
+			if (ncand == nalloc) {
+				nalloc = nalloc ? nalloc * 2 : 64;
+				c = realloc(consts, nalloc * sizeof(optconst_t));
+				if (c == NULL)
+					goto oom;
+				consts = c;
+			}
+			memcpy(consts[k].text, buf, n);
+			consts[k].len = n;
+			consts[k].uses = 0;
+			consts[ncand++].var = -1;
+		}
+		consts[k].uses++;
+	}
+    }
+
+    /* The constants that save most come first; each variable set before
+     * them makes them, and every other name, a little slower to find. */
+    for (k = 0; k < ncand; ++k)
+	consts[k].gain = consts[k].uses * constgain(&consts[k], 0);
+    qsort(consts, ncand, sizeof(optconst_t), gaincmp);
+    for (; nconst < ncand && nconst < OPT_MAXCONST; ++nconst) {
+	c = &consts[nconst];
+	if (c->uses * constgain(c, nconst) - C_VARSCAN * (refs + c->uses) <= 0 ||
+	    initlen + c->len + 4 > OPT_MAXLINE ||
+	    (c->var = freename(&o, o.taken)) < 0)
+		break;
+	o.taken[c->var] = 1;
+	initlen += c->len + 4;
+    }
+
+    /* A line that would get too long keeps its constants, so count the
+     * uses they really get, in the space after out, and drop those that
+     * get none. */
+    if (nconst > 0) {
+	for (k = 0; k < nconst; ++k)
+		consts[k].uses = 0;
+	zeros = o.zeros;
+	for (lp = lines; lp < lines + nlines; ++lp) {
+		l.len = lp->len;
+		memcpy(l.text, &text.buf[lp->off], l.len);
+		lex(&l);
+		if (outbuf_reserve(out, 2 * l.len) < 0)
+			goto full;
+		for (k = 0; k < nconst; ++k)
+			before[k] = consts[k].uses;
+		gain = 0;
+		n = rewrite(&o, &l, consts, nconst, 1,
+			    (unsigned char *)&out->buf[out->len], &gain);
+		if (n > OPT_MAXLINE && n > l.len) {
+			for (k = 0; k < nconst; ++k)
+				consts[k].uses = before[k];
+		}
+	}
+	o.zeros = zeros;
+	for (k = n = 0, initlen = 0; k < nconst; ++k) {
+		if (consts[k].uses > 0) {
+			consts[n++] = consts[k];
+			initlen += consts[k].len + 4;
+		}
+	}
+	nconst = n;
+    }
+
+    /* Last, the program again. */
+    if (outbuf_reserve(out, 2) < 0)
+	goto full;
+    memcpy(&out->buf[out->len], prg, 2);
+    out->len += 2;
+
+    /* The constants are set on a line of their own before the first, so
+     * that a jump to the first line does not set them again. */
+    if (nconst > 0) {
+	if (outbuf_reserve(out, 4 + initlen + 1) < 0)
+		goto full;
+	cur = out->len;
+	dp = (unsigned char *)&out->buf[cur + 4];
+	dp[-2] = (lines[0].number - 1) & 255;
+	dp[-1] = (lines[0].number - 1) >> 8;
+	for (k = 0; k < nconst; ++k) {
+		if (k > 0)
+			*dp++ = ':';
+		keyname(consts[k].var, dp);
+		dp[2] = TOK_EQ;
+		memcpy(dp + 3, consts[k].text, consts[k].len);
+		dp += 3 + consts[k].len;
+		initcost += C_STMT + C_VAR + C_VARSCAN * k +
+			    litcost(consts[k].text, consts[k].len) +
+			    C_CHRGET * (4 + consts[k].len);
+	}
+	*dp = 0;
+	initcost += C_LINE;
+	out->len = (char *)dp - out->buf + 1;
+	i = load + out->len - start - 2;
+	out->buf[cur] = i & 255;
+	out->buf[cur + 1] = i >> 8;
+	diag_info(diag, "Line %u: about %ld cycles spent once setting %i constants\n",
+		  lines[0].number - 1, initcost, nconst);
+    }
+
+    for (lp = lines; lp < lines + nlines; ++lp) {
+	l.len = lp->len;
+	memcpy(l.text, &text.buf[lp->off], l.len);
+	lex(&l);
+	if (outbuf_reserve(out, 4 + 2 * l.len + 1 + 2) < 0)
+		goto full;
+	cur = out->len;
+	dp = (unsigned char *)&out->buf[cur + 4];
+	dp[-2] = lp->number & 255;
+	dp[-1] = lp->number >> 8;
+
+	/* A line that would get too long keeps its constants. */
+	zeros = o.zeros;
+	gain = 0;
+	n = rewrite(&o, &l, consts, nconst, 1, dp, &gain);
+	if (n > OPT_MAXLINE && n > l.len) {
+		o.zeros = zeros;
+		gain = 0;
+		n = rewrite(&o, &l, consts, nconst, 0, dp, &gain);
+	}
+	for (linerefs = 0, pos = 0; pos < l.nn; ++pos)
+		linerefs += nsp(&l, pos)->kind == IT_NAME;
+	lp->saved += gain - C_VARSCAN * nconst * linerefs;
+
+	dp[n] = 0;
+	out->len = (char *)dp - out->buf + n + 1;
+	i = load + out->len - start - 2;
+	out->buf[cur] = i & 255;
+	out->buf[cur + 1] = i >> 8;
+
+	if (lp->perpass != 0)
+		diag_info(diag, "Line %u: about %ld cycles saved on each pass of its loop, %ld each time it runs\n",
+			  lp->number, lp->perpass, lp->saved);
+	else if (lp->saved != 0)
+		diag_info(diag, "Line %u: about %ld cycles saved each time it runs\n",
+			  lp->number, lp->saved);
+    }
+    if (outbuf_reserve(out, 2) < 0)
+	goto full;
+    out->buf[out->len++] = 0;
+    out->buf[out->len++] = 0;
+
+    diag_info(diag, "Optimized %i constants into variables, %ld zeros, %ld folds, %ld expressions hoisted\n",
+	      nconst, o.zeros, o.folds, o.hoists);
+
+    n = 0;
+    goto out;
+full:
+    n = outbuf_full(out, diag);
+    goto out;
+oom:
+    n = diag_error(diag, "out of memory");
+out:
+    free(l.text);
+    free(l.it);
+    free(l.nsp);
+    free(o.cand);
+    free(o.var);
+    free(o.buf);
+    free(lines);
+    free(consts);
+    outbuf_free(&text);
+
+    return n;
+}
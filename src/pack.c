@@ -0,0 +1,518 @@
+/*
+ * pack.c, pack a C64 BASIC program into a PRG that unpacks and runs
+ * itself, and unpack one on the host.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "prgtools.h"
+
+
+/*
+ * The packed data is a stream of byte-aligned LZ77 items:
+ *
+ *   00			end
+ *   01..7f		that many literal bytes follow
+ *   10nnnnnn o		copy n+2 bytes from o+1 bytes back
+ *   11nnnnnn h l	copy n+2 bytes from h*256+l+1 bytes back
+ *
+ * Before packing, the link of every line is set to $0101, which packs
+ * better; the unpacker has BASIC link the lines again, as LOAD does.
+ */
+#define PK_LOAD		0x0801		// where the program goes
+#define PK_MINLEN	2		// shortest copy
+#define PK_MAXLEN	(0x3f + PK_MINLEN)
+#define PK_MAXLIT	0x7f
+#define PK_SHORT	256		// furthest copy with a one-byte offset
+#define PK_CHAIN	1024		// candidates looked at for each byte
+
+/* rough speeds of the standard 1541 and datasette loaders, bytes/s */
+#define DISK_RATE	400.0
+#define TAPE_RATE	50.0
+
+/*
+ * 10 SYS2061, then the first stage at $080D: it moves the second stage
+ * to the tape buffer at $033C, moves the packed data up out of the way a
+ * page at a time from the top down, and jumps to the second stage.
+ */
+static const unsigned char stub[] = {
+    0x0b, 0x08, 0x0a, 0x00, 0x9e, '2', '0', '6', '1', 0x00, 0x00, 0x00
+};
+
+#define A_ADDR		0x080d
+#define A_LEN		1		// LDX #stage2 length
+#define A_PARTB		3		// LDA PARTB-1,X
+#define A_SRCLO		12		// top page of the data, from and to
+#define A_SRCHI		16
+#define A_DSTLO		20
+#define A_DSTHI		24
+#define A_PAGES		28
+
+static const unsigned char stage1[] = {
+    0xa2, 0x86,			//	ldx #stage2 length
+    0xbd, 0x00, 0x00,		// 1:	lda stage2-1,x
+    0x9d, 0x3b, 0x03,		//	sta $033b,x
+    0xca,			//	dex
+    0xd0, 0xf7,			//	bne 1b
+    0xa9, 0x00, 0x85, 0xfb,	//	lda #<src top; sta $fb
+    0xa9, 0x00, 0x85, 0xfc,	//	lda #>src top; sta $fc
+    0xa9, 0x00, 0x85, 0xfd,	//	lda #<dst top; sta $fd
+    0xa9, 0x00, 0x85, 0xfe,	//	lda #>dst top; sta $fe
+    0xa2, 0x00,			//	ldx #pages
+    0xa0, 0x00,			//	ldy #0
+    0x88,			// 2:	dey
+    0xb1, 0xfb,			//	lda ($fb),y
+    0x91, 0xfd,			//	sta ($fd),y
+    0x98,			//	tya
+    0xd0, 0xf8,			//	bne 2b
+    0xc6, 0xfc,			//	dec $fc
+    0xc6, 0xfe,			//	dec $fe
+    0xca,			//	dex
+    0xd0, 0xf1,			//	bne 2b
+    0x4c, 0x3c, 0x03		//	jmp $033c
+};
+
+/*
+ * The second stage, at $033C: it unpacks from ($fb) to ($fd) = $0801,
+ * copies with ($22), sets the end of the program, links the lines and
+ * does what RUN does.
+ */
+#define B_SRCLO		1		// where the data was moved to
+#define B_SRCHI		5
+
+static const unsigned char stage2[] = {
+    0xa9, 0x00, 0x85, 0xfb,	//	lda #<data; sta $fb
+    0xa9, 0x00, 0x85, 0xfc,	//	lda #>data; sta $fc
+    0xa9, 0x01, 0x85, 0xfd,	//	lda #$01; sta $fd
+    0xa9, 0x08, 0x85, 0xfe,	//	lda #$08; sta $fe
+    0x20, 0xb5, 0x03,		// next: jsr getb
+    0xf0, 0x53,			//	beq done
+    0x10, 0x30,			//	bpl literal
+    0x85, 0x02,			//	sta $02
+    0x29, 0x3f,			//	and #$3f
+    0xaa, 0xe8, 0xe8,		//	tax; inx; inx
+    0xa9, 0xff,			//	lda #$ff
+    0x24, 0x02,			//	bit $02
+    0x50, 0x05,			//	bvc short
+    0x20, 0xb5, 0x03,		//	jsr getb
+    0x49, 0xff,			//	eor #$ff
+    0x85, 0x23,			// short: sta $23
+    0x20, 0xb5, 0x03,		//	jsr getb
+    0x49, 0xff,			//	eor #$ff
+    0x18,			//	clc
+    0x65, 0xfd, 0x85, 0x22,	//	adc $fd; sta $22
+    0xa5, 0x23,			//	lda $23
+    0x65, 0xfe, 0x85, 0x23,	//	adc $fe; sta $23
+    0xa0, 0x00,			//	ldy #0
+    0xb1, 0x22,			// 1:	lda ($22),y
+    0x91, 0xfd,			//	sta ($fd),y
+    0xc8, 0xca,			//	iny; dex
+    0xd0, 0xf8,			//	bne 1b
+    0xf0, 0x15,			//	beq adddst
+    0xaa,			// literal: tax
+    0xa0, 0x00,			//	ldy #0
+    0xb1, 0xfb,			// 2:	lda ($fb),y
+    0x91, 0xfd,			//	sta ($fd),y
+    0xc8, 0xca,			//	iny; dex
+    0xd0, 0xf8,			//	bne 2b
+    0x98, 0x18,			//	tya; clc
+    0x65, 0xfb, 0x85, 0xfb,	//	adc $fb; sta $fb
+    0x90, 0x02,			//	bcc adddst
+    0xe6, 0xfc,			//	inc $fc
+    0x98, 0x18,			// adddst: tya; clc
+    0x65, 0xfd, 0x85, 0xfd,	//	adc $fd; sta $fd
+    0x90, 0xac,			//	bcc next
+    0xe6, 0xfe,			//	inc $fe
+    0xd0, 0xa8,			//	bne next
+    0xa5, 0xfd, 0x85, 0x2d,	// done: lda $fd; sta $2d
+    0xa5, 0xfe, 0x85, 0x2e,	//	lda $fe; sta $2e
+    0x20, 0x33, 0xa5,		//	jsr $a533	link the lines
+    0x20, 0x59, 0xa6,		//	jsr $a659	CLR, start of program
+    0x4c, 0xae, 0xa7,		//	jmp $a7ae	run
+    0xa0, 0x00,			// getb: ldy #0
+    0xb1, 0xfb,			//	lda ($fb),y
+    0xe6, 0xfb,			//	inc $fb
+    0xd0, 0x02,			//	bne 1f
+    0xe6, 0xfc,			//	inc $fc
+    0xc9, 0x00,			// 1:	cmp #0
+    0x60			//	rts
+};
+
+#define PK_HEAD		(2 + sizeof(stub) + sizeof(stage1) + sizeof(stage2))
+
+
+static void
+putword(unsigned char *p, long n)
+{
+    p[0] = n & 255;
+    p[1] = (n >> 8) & 255;
+}
+
+
+/*
+ * link the lines of a program at PK_LOAD the way BASIC does after LOAD;
+ * like BASIC, it takes every line to have at least one byte
+ * returns 0, or -1 if a line runs off the end
+ */
+static int
+relink(unsigned char *sp, long len)
+{
+    long pos = 0, i;
+
+    while (pos + 1 < len && sp[pos + 1] != 0) {
+	for (i = pos + 5; i < len && sp[i] != 0; ++i)
+		;
+	if (i >= len)
+		return -1;
+	putword(&sp[pos], PK_LOAD + i + 1);
+	pos = i + 1;
+    }
+
+    return 0;
+}
+
+
+/*
+ * find, for every position, the longest copy with a short offset and the
+ * longest with any offset, using hash chains on pairs of bytes
+ */
+static int
+matches(const unsigned char *sp, long len, unsigned char *slen, long *soff,
+	unsigned char *llen, long *loff)
+{
+    long *head, *prev;
+    long i, j, n, max;
+    int h, chain;
+
+    head = malloc(65536 * sizeof(long));
+    prev = malloc((len + 1) * sizeof(long));
+    if (head == NULL || prev == NULL) {
+	free(head);
+	free(prev);
+	return -1;
+    }
+    for (i = 0; i < 65536; ++i)
+	head[i] = -1;
+
+    for (i = 0; i < len; ++i) {
+	slen[i] = llen[i] = 0;
+	if (i + PK_MINLEN > len)
+		continue;
+	max = len - i < PK_MAXLEN ? len - i : PK_MAXLEN;
+	h = sp[i] | (sp[i + 1] << 8);
+
+	/* the nearest first, so the first of each length is the best */
+	for (j = head[h], chain = 0; j >= 0 && chain < PK_CHAIN;
+	     j = prev[j], ++chain) {
+		for (n = 2; n < max && sp[j + n] == sp[i + n]; ++n)
+			;
+		if (i - j <= PK_SHORT && n > slen[i]) {
+			slen[i] = n;
+			soff[i] = i - j;
+		}
+		if (n > llen[i]) {
+			llen[i] = n;
+			loff[i] = i - j;
+		}
+		if (slen[i] == max || (llen[i] == max && i - j > PK_SHORT))
+			break;
+	}
+	prev[i] = head[h];
+	head[h] = i;
+    }
+
+    free(head);
+    free(prev);
+
+    return 0;
+}
+
+
+/*
+ * pack a program, with its links set to $0101, into out: the cheapest
+ * way to the end from every position, worked out from the end backwards
+ * returns 0, or -1 if out of memory; the largest number of bytes the
+ * unpacked program gets ahead of the packed data is left in *ahead, and
+ * the number of items in *items
+ */
+static int
+lzpack(const unsigned char *sp, long len, outbuf_t *out, long *ahead,
+       long *items)
+{
+    unsigned char *slen, *llen, *how;
+    long *soff, *loff, *cost;
+    long i, k, c, in, done;
+    int ret = -1;
+
+    slen = malloc(len + 1);
+    llen = malloc(len + 1);
+    how = malloc(len + 1);
+    soff = malloc((len + 1) * sizeof(long));
+    loff = malloc((len + 1) * sizeof(long));
+    cost = malloc((len + 1) * sizeof(long));
+    if (slen == NULL || llen == NULL || how == NULL || soff == NULL ||
+	loff == NULL || cost == NULL ||
+	matches(sp, len, slen, soff, llen, loff) < 0)
+	goto out;
+
+    /* how[i] is a literal run of 1..127 or a copy of 128 + its length */
+    cost[len] = 1;
+    for (i = len - 1; i >= 0; --i) {
+	cost[i] = 2 + cost[i + 1];
+	how[i] = 1;
+	for (k = 2; k <= PK_MAXLIT && i + k <= len; ++k) {
+		if (1 + k + cost[i + k] < cost[i]) {
+			cost[i] = 1 + k + cost[i + k];
+			how[i] = k;
+		}
+	}
+	for (k = PK_MINLEN; k <= llen[i]; ++k) {
+		c = (k <= slen[i] ? 2 : 3) + cost[i + k];
+		if (c < cost[i]) {
+			cost[i] = c;
+			how[i] = 128 + k;
+		}
+	}
+    }
+
+    if (outbuf_reserve(out, cost[0]) < 0)
+	goto out;
+    *ahead = *items = 0;
+    for (i = 0, in = 0; i < len; i += k) {
+	(*items)++;
+	if (how[i] < 128) {
+		k = how[i];
+		out->buf[out->len++] = k;
+		memcpy(&out->buf[out->len], &sp[i], k);
+		out->len += k;
+		in += 1 + k;
+		done = i + k;
+	} else {
+		k = how[i] - 128;
+		if (k <= slen[i]) {
+			out->buf[out->len++] = 0x80 | (k - PK_MINLEN);
+			out->buf[out->len++] = soff[i] - 1;
+			in += 2;
+		} else {
+			out->buf[out->len++] = 0xc0 | (k - PK_MINLEN);
+			out->buf[out->len++] = (loff[i] - 1) >> 8;
+			out->buf[out->len++] = (loff[i] - 1) & 255;
+			in += 3;
+		}
+		done = i + k;
+	}
+
+	/* the last byte written may land on the last byte read, so the
+	 * data has to start this far above where the output does */
+	if (done - in > *ahead)
+		*ahead = done - in;
+    }
+    out->buf[out->len++] = 0;
+    ret = 0;
+
+out:
+    free(slen);
+    free(llen);
+    free(how);
+    free(soff);
+    free(loff);
+    free(cost);
+
+    return ret;
+}
+
+
+/*
+ * is this a PRG made by prg_pack()?
+ */
+int
+prg_ispacked(const unsigned char *prg, long len)
+{
+    return len > PK_HEAD && prg[0] == (PK_LOAD & 255) &&
+	   prg[1] == (PK_LOAD >> 8) &&
+	   !memcmp(&prg[2], stub, sizeof(stub)) &&
+	   !memcmp(&prg[2 + sizeof(stub)], stage1, A_PARTB) &&
+	   !memcmp(&prg[2 + sizeof(stub) + sizeof(stage1) + B_SRCHI + 1],
+		   &stage2[B_SRCHI + 1], sizeof(stage2) - B_SRCHI - 1);
+}
+
+
+/*
+ * unpack a PRG made by prg_pack() into the program it was made from, the
+ * way the C64 would
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+prg_unpack(const unsigned char *prg, long len, outbuf_t *out, diag_t *diag)
+{
+    const unsigned char *sp = prg + PK_HEAD;
+    const unsigned char *ep = prg + len;
+    unsigned char *dp;
+    size_t start = out->len;
+    long n, off, i;
+    int c = -1;
+
+    if (!prg_ispacked(prg, len))
+	return diag_error(diag, "not a packed program");
+
+    /* nothing can unpack past the end of memory */
+    if (outbuf_reserve(out, 2 + 0x10000 - PK_LOAD) < 0)
+	return outbuf_full(out, diag);
+    dp = (unsigned char *)&out->buf[start];
+    putword(dp, PK_LOAD);
+    dp += 2;
+    n = 0;
+
+    while (sp < ep && (c = *sp++) != 0) {
+	if (c < 0x80) {
+		if (ep - sp < c)
+			break;
+		if (n + c > 0x10000 - PK_LOAD)
+			return diag_error(diag, "bad packed data");
+		memcpy(&dp[n], sp, c);
+		sp += c;
+		n += c;
+		continue;
+	}
+	if (ep - sp < (c & 0x40 ? 2 : 1))
+		break;
+	off = *sp++;
+	if (c & 0x40)
+		off = (off << 8) | *sp++;
+	off++;
+	c = (c & 0x3f) + PK_MINLEN;
+	if (off > n || n + c > 0x10000 - PK_LOAD)
+		return diag_error(diag, "bad packed data");
+	for (i = 0; i < c; ++i, ++n)
+		dp[n] = dp[n - off];
+	c = -1;
+    }
+    if (c != 0)
+	return diag_error(diag, "packed data is cut off");
+
+    if (relink(dp, n) < 0)
+	return diag_error(diag, "packed program has a line with no end");
+    out->len = start + 2 + n;
+
+    return 0;
+}
+
+
+/*
+ * pack a PRG for the C64 into a PRG that unpacks itself to $0801 and runs,
+ * appended to out; top is the end of BASIC RAM. The result is unpacked
+ * again on the host and checked before it is accepted.
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+prg_pack(const unsigned char *prg, long len, outbuf_t *out, long top,
+	 diag_t *diag)
+{
+    const long from = PK_LOAD + PK_HEAD - 2;
+    unsigned char *sp, *hp;
+    size_t start = out->len;
+    long pos, i, ahead, items, to, pages, plen, src, dst;
+    double secs, saved;
+    outbuf_t check;
+    int ret;
+
+    if (len < 2 || (prg[0] | (prg[1] << 8)) != PK_LOAD)
+	return diag_error(diag, "only a program loaded at $%04X can be packed",
+			  PK_LOAD);
+    len -= 2;
+    if ((sp = malloc(len + 1)) == NULL)
+	return diag_error(diag, "out of memory");
+    memcpy(sp, prg + 2, len);
+
+    /* the links are left to BASIC */
+    for (pos = 0; pos + 1 < len && sp[pos + 1] != 0; pos = i + 1) {
+	for (i = pos + 4; i < len && sp[i] != 0; ++i)
+		;
+	sp[pos] = sp[pos + 1] = 1;
+    }
+
+    if (outbuf_reserve(out, PK_HEAD) < 0) {
+	free(sp);
+	return outbuf_full(out, diag);
+    }
+    out->len += PK_HEAD;
+    ret = lzpack(sp, len, out, &ahead, &items);
+    free(sp);
+    if (ret < 0) {
+	out->len = start;
+	return outbuf_full(out, diag);
+    }
+
+    /* Move the data up so that unpacking never overtakes it; the first
+     * stage moves whole pages. */
+    plen = out->len - start - PK_HEAD;
+    to = PK_LOAD + ahead;
+    if (to < from)
+	to = from;
+    pages = (plen + 255) / 256;
+    if (to + pages * 256 > top) {
+	out->len = start;
+	return diag_error(diag, "no room in memory to unpack the program");
+    }
+
+    hp = (unsigned char *)&out->buf[start];
+    putword(hp, PK_LOAD);
+    memcpy(hp + 2, stub, sizeof(stub));
+    hp += 2 + sizeof(stub);
+    memcpy(hp, stage1, sizeof(stage1));
+    hp[A_LEN] = sizeof(stage2);
+    putword(&hp[A_PARTB], A_ADDR + sizeof(stage1) - 1);
+    src = from + (pages - 1) * 256;
+    dst = to + (pages - 1) * 256;
+    hp[A_SRCLO] = src & 255;
+    hp[A_SRCHI] = src >> 8;
+    hp[A_DSTLO] = dst & 255;
+    hp[A_DSTHI] = dst >> 8;
+    hp[A_PAGES] = pages;
+    hp += sizeof(stage1);
+    memcpy(hp, stage2, sizeof(stage2));
+    hp[B_SRCLO] = to & 255;
+    hp[B_SRCHI] = to >> 8;
+
+    /* It has to come back the same. */
+    memset(&check, 0, sizeof(check));
+    ret = prg_unpack((unsigned char *)&out->buf[start], out->len - start,
+		     &check, diag);
+    if (ret == 0 && (check.len != len + 2 || memcmp(check.buf, prg, len + 2)))
+	ret = diag_error(diag, "BASIC would link the lines differently, "
+			       "is a line empty?");
+    outbuf_free(&check);
+    if (ret < 0) {
+	out->len = start;
+	return ret;
+    }
+
+    /* the loaders against moving the data and unpacking, roughly */
+    saved = (double)(len + 2) - (double)(out->len - start);
+    secs = (19.0 * pages * 256 + 18.0 * len + 60.0 * items) / CYCLES_SECOND;
+    diag_info(diag, "Packed %ld bytes to %ld, %.1f%% of the size\n",
+	      len + 2, (long)(out->len - start),
+	      100.0 * (out->len - start) / (len + 2));
+    diag_info(diag, "Unpacking takes %.2f s; the time to load and run changes "
+		    "by %+.1f s from disk, %+.1f s from tape\n",
+	      secs, secs - saved / DISK_RATE, secs - saved / TAPE_RATE);
+    if (saved < 0)
+	diag_warn(diag, "Warning: the packed program is larger\n");
+
+    return 0;
+}
@@ -0,0 +1,290 @@
+/*
+ * petscii.c, PETSCII to text and back, for strings and REMs.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(__AVX2__)
+# include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+# include <emmintrin.h>
+#endif
+#include "prgtools.h"
+#include "petscii.h"
+
+
+/*
+ * Control codes have names, as printed on the keys or in magazine
+ * listings; any other byte that is not printable ASCII is written as two
+ * hex digits, "{d0}". Function keys are {fn1} and so on, since {f1} is
+ * the hex escape of $F1.
+ */
+static const struct {
+    unsigned char c;
+    const char	*name;
+} names[] = {
+    { 0x03, "{stop}" },
+    { 0x05, "{wht}" },
+    { 0x0d, "{return}" },
+    { 0x0e, "{lower}" },
+    { 0x11, "{down}" },
+    { 0x12, "{rvs on}" },
+    { 0x13, "{home}" },
+    { 0x14, "{del}" },
+    { 0x1c, "{red}" },
+    { 0x1d, "{right}" },
+    { 0x1e, "{grn}" },
+    { 0x1f, "{blu}" },
+    { 0x81, "{orng}" },
+    { 0x85, "{fn1}" },
+    { 0x86, "{fn3}" },
+    { 0x87, "{fn5}" },
+    { 0x88, "{fn7}" },
+    { 0x89, "{fn2}" },
+    { 0x8a, "{fn4}" },
+    { 0x8b, "{fn6}" },
+    { 0x8c, "{fn8}" },
+    { 0x8d, "{shift return}" },
+    { 0x8e, "{upper}" },
+    { 0x90, "{blk}" },
+    { 0x91, "{up}" },
+    { 0x92, "{rvs off}" },
+    { 0x93, "{clr}" },
+    { 0x94, "{inst}" },
+    { 0x95, "{brn}" },
+    { 0x96, "{lred}" },
+    { 0x97, "{gry1}" },
+    { 0x98, "{gry2}" },
+    { 0x99, "{lgrn}" },
+    { 0x9a, "{lblu}" },
+    { 0x9b, "{gry3}" },
+    { 0x9c, "{pur}" },
+    { 0x9d, "{left}" },
+    { 0x9e, "{yel}" },
+    { 0x9f, "{cyn}" },
+    { 0xa0, "{shift space}" },
+};
+#define NNAMES	(sizeof(names) / sizeof(names[0]))
+
+/*
+ * With CHARSET_UTF8, the characters that differ from ASCII and have an
+ * exact match in Unicode.
+ */
+static const struct {
+    unsigned char c;
+    const char	*utf8;
+} utf8[] = {
+    { 0x5c, "\xc2\xa3" },		// pound sign
+    { 0x5e, "\xe2\x86\x91" },		// up arrow
+    { 0x5f, "\xe2\x86\x90" },		// left arrow
+    { 0xff, "\xcf\x80" },		// pi
+};
+#define NUTF8	(sizeof(utf8) / sizeof(utf8[0]))
+
+
+const char *petscii_text[NCHARSETS][256];
+unsigned char petscii_len[NCHARSETS][256];
+unsigned char petscii_plain[NCHARSETS][256];
+int	petscii_maxlen;
+
+static char	chars[256][2];
+static char	hex[256][5];
+static unsigned char special[NCHARSETS][256];	// decode: may start a code
+static unsigned char swap[256];
+static unsigned char xdigit[256];		// hex value + 1, or 0
+
+
+static void
+set(int cs, int c, const char *text)
+{
+    int n = strlen(text);
+
+    petscii_text[cs][c] = text;
+    petscii_len[cs][c] = n;
+    petscii_plain[cs][c] = n == 1 && (unsigned char)text[0] == c;
+    if (n > petscii_maxlen)
+	petscii_maxlen = n;
+}
+
+
+/*
+ * build the tables; called from tokens_init()
+ */
+void
+petscii_init(void)
+{
+    const char *digits = "0123456789abcdef";
+    int c, cs;
+    size_t i;
+
+    for (c = 0; c < 256; ++c) {
+	chars[c][0] = c;
+	sprintf(hex[c], "{%c%c}", digits[c >> 4], digits[c & 15]);
+
+	swap[c] = c;
+	if (c >= 'A' && c <= 'Z')
+		swap[c] = c + ('a' - 'A');
+	else if (c >= 'a' && c <= 'z')
+		swap[c] = c - ('a' - 'A');
+    }
+    for (c = 0; c < 16; ++c) {
+	xdigit[(unsigned char)digits[c]] = c + 1;
+	if (c >= 10)
+		xdigit[digits[c] - ('a' - 'A')] = c + 1;
+    }
+
+    for (cs = 0; cs < NCHARSETS; ++cs) {
+	for (c = 0; c < 256; ++c) {
+		if (cs == CHARSET_RAW || (c >= 0x20 && c < 0x7f && c != '{'))
+			set(cs, c, chars[c]);
+		else
+			set(cs, c, hex[c]);
+	}
+	if (cs == CHARSET_RAW)
+		continue;
+	for (i = 0; i < NNAMES; ++i)
+		set(cs, names[i].c, names[i].name);
+	special[cs]['{'] = 1;
+    }
+    for (i = 0; i < NUTF8; ++i) {
+	set(CHARSET_UTF8, utf8[i].c, utf8[i].utf8);
+	special[CHARSET_UTF8][(unsigned char)utf8[i].utf8[0]] = 1;
+    }
+}
+
+
+/*
+ * swap upper and lower case ASCII letters, the rough conversion between
+ * ASCII text and PETSCII
+ */
+void
+petscii_swapcase(char *s, size_t n)
+{
+    char *ep = s + n;
+
+#if defined(__AVX2__)
+    const __m256i lo = _mm256_set1_epi8('a' - 1);
+    const __m256i hi = _mm256_set1_epi8('z' + 1);
+    const __m256i bit = _mm256_set1_epi8(0x20);
+    __m256i v, l, m;
+
+    for (; ep - s >= 32; s += 32) {
+	v = _mm256_loadu_si256((const __m256i *)s);
+	l = _mm256_or_si256(v, bit);
+	m = _mm256_and_si256(_mm256_cmpgt_epi8(l, lo),
+			     _mm256_cmpgt_epi8(hi, l));
+	v = _mm256_xor_si256(v, _mm256_and_si256(m, bit));
+	_mm256_storeu_si256((__m256i *)s, v);
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    /* Bytes from 0x80 are negative and so never letters. */
+    const __m128i lo = _mm_set1_epi8('a' - 1);
+    const __m128i hi = _mm_set1_epi8('z' + 1);
+    const __m128i bit = _mm_set1_epi8(0x20);
+    __m128i v, l, m;
+
+    for (; ep - s >= 16; s += 16) {
+	v = _mm_loadu_si128((const __m128i *)s);
+	l = _mm_or_si128(v, bit);
+	m = _mm_and_si128(_mm_cmpgt_epi8(l, lo), _mm_cmpgt_epi8(hi, l));
+	v = _mm_xor_si128(v, _mm_and_si128(m, bit));
+	_mm_storeu_si128((__m128i *)s, v);
+    }
+#endif
+
+    for (; s < ep; ++s)
+	*s = swap[(unsigned char)*s];
+}
+
+
+/*
+ * the PETSCII byte for the code at sp, given as a name or two hex digits
+ * in any case, or as a UTF-8 character; sets *len to its length
+ * returns the byte, or -1 if sp does not start a code
+ */
+static int
+code(const char *sp, const char *ep, int *len)
+{
+    const unsigned char *s = (const unsigned char *)sp;
+    const char *np;
+    size_t i;
+    int n;
+
+    if (*sp != '{') {
+	for (i = 0; i < NUTF8; ++i) {
+		n = strlen(utf8[i].utf8);
+		if (ep - sp >= n && !memcmp(sp, utf8[i].utf8, n)) {
+			*len = n;
+			return utf8[i].c;
+		}
+	}
+	return -1;
+    }
+
+    /* A nul would end the line, so {00} is left as it is. */
+    if (ep - sp >= 4 && s[3] == '}' && xdigit[s[1]] && xdigit[s[2]] &&
+	(s[1] != '0' || s[2] != '0')) {
+	*len = 4;
+	return (xdigit[s[1]] - 1) * 16 + xdigit[s[2]] - 1;
+    }
+
+    for (i = 0; i < NNAMES; ++i) {
+	np = names[i].name;
+	n = strlen(np);
+	if (ep - sp < n)
+		continue;
+	while (--n >= 0 && (sp[n] == np[n] ||
+			    swap[s[n]] == (unsigned char)np[n]))
+		;
+	if (n < 0) {
+		*len = strlen(np);
+		return names[i].c;
+	}
+    }
+
+    return -1;
+}
+
+
+/*
+ * turn the codes in a line of text back into PETSCII, in place
+ * returns the new length
+ */
+size_t
+petscii_decode(char *s, size_t n, int charset)
+{
+    const unsigned char *sc = special[charset];
+    const char *sp = s, *ep = s + n;
+    char *dp = s;
+    int c, len;
+
+    while (sp < ep) {
+	if (!sc[(unsigned char)*sp]) {
+		*dp++ = *sp++;
+		continue;
+	}
+	if ((c = code(sp, ep, &len)) < 0) {
+		*dp++ = *sp++;
+		continue;
+	}
+	*dp++ = c;
+	sp += len;
+    }
+
+    return dp - s;
+}
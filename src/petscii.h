@@ -0,0 +1,39 @@
+/*
+ * petscii.h
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef _PETSCII_H_
+# define _PETSCII_H_
+
+
+/*
+ * How each PETSCII byte of a string or a REM is written in text, for each
+ * CHARSET_*, built by petscii_init(). Bytes that are written as themselves
+ * have plain[] set, so the detokenizer can copy runs of them.
+ */
+extern const char *petscii_text[NCHARSETS][256];
+extern unsigned char petscii_len[NCHARSETS][256];
+extern unsigned char petscii_plain[NCHARSETS][256];
+extern int	petscii_maxlen;
+
+
+extern void	petscii_init(void);
+extern void	petscii_swapcase(char *s, size_t n);
+extern size_t	petscii_decode(char *s, size_t n, int charset);
+
+
+#endif	/*_PETSCII_H_*/
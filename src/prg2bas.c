@@ -18,78 +18,248 @@
  */
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #ifdef _WIN32
 # include <io.h>
 # include <fcntl.h>
 #endif
 #include <getopt.h>
 #include "tokens.h"
+#include "prgtools.h"
+#include "batch.h"
+#include "server.h"
 #include "version.h"
 
 
-#ifdef _DEBUG
-static int debug = 0;		// debug level
-#endif
+static const convdesc_t prg2bas_desc = {
+    ".prg", ".bas", "rb", "wb", prg2bas_file, prg2bas_image, prg2bas_buf
+};
+
+static const convdesc_t prg2json_desc = {
+    ".prg", ".json", "rb", "wb", prg2json_file, prg2json_image,
+    prg2json_buf
+};
 
 
 /*
- * Note: this tokenizer does not handle non-sequential PRG files. Lines must be
- * in the same order as they are found in the input.
+ * disk images and tape archives are recognized by their extension
  */
-static long
-getword(FILE *fp)
+static int
+is_image(const char *name)
 {
-    unsigned int x;
-    int n;
+    size_t n = strlen(name);
 
-    n = getc(fp);
-    if (n < 0)
-	return -1;
-    x = n;
-    n = getc(fp);
-    if (n < 0)
+    return n > 4 && (!strcmp(&name[n - 4], ".d64") ||
+		     !strcmp(&name[n - 4], ".D64") ||
+		     !strcmp(&name[n - 4], ".t64") ||
+		     !strcmp(&name[n - 4], ".T64"));
+}
+
+
+/*
+ * read a range of line numbers, as LIST takes them: 1000, 1000-1100,
+ * 1000- or -1100
+ * returns 0, or -1 if it is not a range
+ */
+static int
+parse_range(const char *s, prgopts_t *opts)
+{
+    char *ep;
+
+    opts->firstline = 0;
+    opts->lastline = 65535;
+    if (*s != '-') {
+	opts->firstline = strtol(s, &ep, 10);
+	if (ep == s)
+		return -1;
+	s = ep;
+	if (*s == '\0')
+		opts->lastline = opts->firstline;
+    }
+    if (*s == '-' && s[1] != '\0') {
+	opts->lastline = strtol(s + 1, &ep, 10);
+	if (ep == s + 1)
+		return -1;
+	s = ep;
+    } else if (*s == '-')
+	s++;
+    if (*s != '\0' || opts->firstline < 0 || opts->firstline > opts->lastline)
 	return -1;
+    opts->range = 1;
 
-    return x | (n << 8);
+    return 0;
 }
 
 
 int
 main(int argc, char **argv)
 {
-    long addr, line;
-    int quoted;
-    int c;
-    FILE *fi, *fo;
+    const convdesc_t *desc = &prg2bas_desc;
+    prgopts_t opts;
+    prgmetrics_t metrics;
+    batchopts_t bo;
+    diag_t diag;
+    int c, ret;
+    int nthreads, nfiles = 0, quiet = 0, tar = 0;
+    FILE *fi, *fo, *fm = NULL;
+    char *in_name;
     char *out_name;
+    char *out_dir;
+    char *server;
+    char *metrics_name;
 
     /* Set defaults. */
-#ifdef _DEBUG
-    debug = 0;
-#endif
+    prgopts_init(&opts);
+    nthreads = 0;
     out_name = NULL;
+    out_dir = NULL;
+    server = NULL;
+    metrics_name = NULL;
 
     /* Process commandline arguments. */
     opterr = 0;
-    while ((c = getopt(argc, argv, "do:")) != EOF) switch (c) {
+    while ((c = getopt(argc, argv, "dD:eij:JM:o:O:qr:S:Tu")) != EOF) switch (c) {
 	case 'd':	// debug-level
 #ifdef _DEBUG
-		debug++;
+		opts.debug++;
 #else
 		fprintf(stderr, "Debugging not compiled in.\n");
 #endif
 		break;
 
+	case 'D':	// dialect
+		if ((opts.dialect = dialect_find(optarg)) < 0) {
+			fprintf(stderr, "Unknown dialect '%s', use 2, 4, 3.5, 7 or simons\n",
+				optarg);
+			exit(1);
+		}
+		break;
+
+	case 'e':	// escape-codes
+		opts.charset = CHARSET_ESCAPES;
+		break;
+
+	case 'i':	// invert-case
+		opts.invertcase ^= 1;
+		break;
+
+	case 'j':	// batch-threads
+		nthreads = atoi(optarg);
+		break;
+
+	case 'J':	// json-tokens
+		desc = &prg2json_desc;
+		break;
+
+	case 'M':	// metrics-file
+		metrics_name = optarg;
+		break;
+
 	case 'o':	// output-file
 		out_name = optarg;
 		break;
 
+	case 'O':	// batch-output-directory
+		out_dir = optarg;
+		break;
+
+	case 'q':	// quiet
+		quiet = 1;
+		break;
+
+	case 'r':	// line-range
+		if (parse_range(optarg, &opts) < 0) {
+			fprintf(stderr, "Bad line range '%s', use first-last\n",
+				optarg);
+			exit(1);
+		}
+		break;
+
+	case 'S':	// server-socket
+		server = optarg;
+		break;
+
+	case 'T':	// tar-stream
+		tar = 1;
+		break;
+
+	case 'u':	// utf8-codes
+		opts.charset = CHARSET_UTF8;
+		break;
+
 	default:
 usage:
-		fprintf(stderr, "Usage: prg2bas [-d] [-o outfile] filename\n");
+		fprintf(stderr, "Usage: prg2bas [-deiJqu] [-D dialect] [-M metrics] [-r lines] [-o outfile] filename\n"
+				"       prg2bas [-deiJqu] [-D dialect] [-j threads] [-M metrics] [-r lines] [-O outdir] file|dir|image ...\n"
+				"       prg2bas -T [-deiJqu] [-D dialect] [-j threads] [-M metrics] [-r lines] [-o out.tar] [in.tar]\n"
+				"       prg2bas -S socket|- [-j threads]\n");
 		exit(1);
     }
 
+    if (opts.range && desc != &prg2bas_desc)
+	goto usage;
+
+    tokens_init();
+
+    /* Server mode: options come with each request. */
+    if (server != NULL) {
+	if (optind < argc || out_name != NULL || out_dir != NULL ||
+	    metrics_name != NULL)
+		goto usage;
+	return server_run(server, nthreads);
+    }
+
+    /* Metrics go to a file, or to stdout with "-". */
+    if (metrics_name != NULL) {
+	fm = strcmp(metrics_name, "-") ? fopen(metrics_name, "w") : stdout;
+	if (fm == NULL) {
+		fprintf(stderr, "Unable to create metrics '%s'\n", metrics_name);
+		return 2;
+	}
+    }
+
+    /* Tar mode: the members of a tar stream in, a tar stream out. */
+    if (tar) {
+	if (out_dir != NULL || argc - optind > 1)
+		goto usage;
+	bo.outdir = NULL;
+	bo.nthreads = nthreads;
+	bo.quiet = quiet;
+	bo.metrics = fm;
+	ret = batch_tar(desc, optind < argc ? argv[optind] : NULL, out_name,
+			&bo, &opts) ? 4 : 0;
+	if (fm != NULL && fm != stdout)
+		fclose(fm);
+	return ret;
+    }
+
+    /* Several inputs, a directory, a disk image, a tape archive or an
+     * output directory: batch mode. Images are done one by one, the rest
+     * together. */
+    if (out_dir != NULL || argc - optind > 1 ||
+	(optind < argc && (batch_isdir(argv[optind]) ||
+			   is_image(argv[optind])))) {
+	if (out_name != NULL || optind == argc)
+		goto usage;
+	bo.outdir = out_dir;
+	bo.nthreads = nthreads;
+	bo.quiet = quiet;
+	bo.metrics = fm;
+	for (ret = 0, c = optind; c < argc; ++c) {
+		if (is_image(argv[c])) {
+			if (batch_image(desc, argv[c], &bo, &opts) != 0)
+				ret = 4;
+		} else
+			argv[optind + nfiles++] = argv[c];
+	}
+	if (nfiles > 0 && batch_run(desc, &argv[optind], nfiles,
+				    &bo, &opts) != 0)
+		ret = 4;
+	if (fm != NULL && fm != stdout)
+		fclose(fm);
+	return ret;
+    }
+
     /* If we have an output filename, open it. */
     if (out_name != NULL) {
 	fo = fopen(out_name, "wb");
@@ -101,8 +271,10 @@ usage:
 	fo = stdout;
 
     /* If we have a filename, use it. */
+    in_name = "-";
     if (optind < argc) {
-	fi = fopen(argv[optind], "r");
+	in_name = argv[optind];
+	fi = fopen(argv[optind], "rb");
 	if (fi == NULL) {
 		fprintf(stderr, "Unable to open input '%s'\n", argv[optind]);
 		if (fo != stdout) {
@@ -121,54 +293,26 @@ usage:
 	fi = stdin;
     }
 
-    /* No more arguments. */
-    if (optind != argc)
-	goto usage;
-
-    /* Get load address. */
-    addr = getword(fi);
-
-    fprintf(stderr, "Load address: 0x%04lx\n", addr);
-
-    for (;;) {
-	/* Get next line address. */
-	addr = getword(fi);
-	if (addr <= 0)
-		break;
-
-	/* Get line number. */
-	line = getword(fi);
-	fprintf(fo, "%li", line);
-
-	quoted = 0;
-	for (;;) {
-		c = fgetc(fi);
-		if (c == 0)
-			break;
-
-		if (c < 0)
-			goto end;
-
-		if (c == '"')
-			quoted = !quoted;
-
-		if (!quoted && c >= 0x80) {
-			fprintf(fo, "%s", tokens[c - 0x80]);
-#ifdef _DEBUG
-			if (debug)
-				fprintf(stderr, "TOKEN{0x%02x}", c);
-#endif
-		} else {
-			fputc(c, fo);
-		}
-	}
-
-	fputc('\n', fo);
+    diag_init(&diag, quiet ? NULL : stderr, NULL);
+    if (fm != NULL) {
+	metrics_init(&metrics, opts.dialect);
+	diag.metrics = &metrics;
     }
+    ret = desc->conv(fi, fo, &opts, &diag);
+    if (ret != 0)
+	fprintf(stderr, "%s\n", diag.error);
 
     if (fo != stdout)
 	fclose(fo);
 
-end:
-    return 0;
+    if (fm != NULL) {
+	if (metrics_write(fm, in_name, &metrics, ret,
+			  ret ? diag.error : NULL) != 0)
+		fprintf(stderr, "Unable to write metrics '%s'\n", metrics_name);
+	metrics_free(&metrics);
+	if (fm != stdout)
+		fclose(fm);
+    }
+
+    return ret ? 4 : 0;
 }
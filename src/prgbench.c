@@ -0,0 +1,265 @@
+/*
+ * prgbench.c, benchmark prg2bas over a corpus of PRG files.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "tokens.h"
+#include "prgtools.h"
+
+
+#define NFILES		2000		// files in the generated corpus
+
+
+static const char *sample[] = {
+    "PRINT CHR$(147):POKE 53280,0:POKE 53281,0",
+    "FOR I=1 TO 100 STEP 2:A(I)=INT(RND(1)*40):NEXT I",
+    "IF X>39 THEN X=0:GOTO 100",
+    "INPUT#2,A$:GET#2,B$:PRINT#4,LEFT$(A$,5);MID$(B$,2,3)",
+    "REM *** MAIN LOOP, DO NOT TOUCH ***",
+    "DATA 169,0,141,32,208,141,33,208,96,255,34,12",
+    "ON J GOSUB 1000,2000,3000:RETURN",
+    "S=SQR(ABS(SIN(T)*COS(T)))+PEEK(197)AND 15 OR 7",
+    "PRINT\"HELLO WORLD, THIS IS A STRING\";TAB(10);SPC(3)",
+    "GO TO 10:SYS 49152:WAIT 198,1:CLR:END"
+};
+
+
+static double
+now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+
+/*
+ * number of read and write system calls made so far, -1 if unknown
+ */
+static long
+syscalls(void)
+{
+    char line[128];
+    long n, total = 0;
+    FILE *fp;
+
+    if ((fp = fopen("/proc/self/io", "r")) == NULL)
+	return -1;
+    while (fgets(line, sizeof(line), fp)) {
+	if (sscanf(line, "syscr: %ld", &n) == 1 ||
+	    sscanf(line, "syscw: %ld", &n) == 1)
+		total += n;
+    }
+    fclose(fp);
+
+    return total;
+}
+
+
+/*
+ * the original prg2bas loop: one stdio call per byte
+ */
+static long
+getword(FILE *fp)
+{
+    unsigned int x;
+    int n;
+
+    n = getc(fp);
+    if (n < 0)
+	return -1;
+    x = n;
+    n = getc(fp);
+    if (n < 0)
+	return -1;
+
+    return x | (n << 8);
+}
+
+static void
+prg2bas_stdio(FILE *fi, FILE *fo)
+{
+    long addr, line;
+    int quoted;
+    int c;
+
+    addr = getword(fi);
+    for (;;) {
+	addr = getword(fi);
+	if (addr <= 0)
+		break;
+	line = getword(fi);
+	fprintf(fo, "%li", line);
+	quoted = 0;
+	for (;;) {
+		c = fgetc(fi);
+		if (c == 0)
+			break;
+		if (c < 0)
+			return;
+		if (c == '"')
+			quoted = !quoted;
+		if (!quoted && c >= 0x80)
+			fprintf(fo, "%s", tokens[c - 0x80]);
+		else
+			fputc(c, fo);
+	}
+	fputc('\n', fo);
+    }
+}
+
+
+/*
+ * write a corpus of random programs built from the sample lines
+ */
+static int
+mkcorpus(const char *dir)
+{
+    unsigned char *prg, *tp;
+    prgopts_t opts;
+    char path[1024];
+    long addr;
+    int i, n, lines, len;
+    FILE *fp;
+
+    prgopts_init(&opts);
+    prg = malloc(MAXPRGLEN);
+    srand(64);
+    for (i = 0; i < NFILES; ++i) {
+	addr = opts.startaddr;
+	tp = prg;
+	*tp++ = addr & 255;
+	*tp++ = addr >> 8;
+	lines = 50 + rand() % 800;
+	for (n = 0; n < lines; ++n) {
+		len = tokenize(tp + 4, sample[rand() % 10], &opts);
+		addr += len + 4;
+		tp[0] = addr & 255;
+		tp[1] = addr >> 8;
+		tp[2] = (n * 10) & 255;
+		tp[3] = (n * 10) >> 8;
+		tp += len + 4;
+	}
+	*tp++ = 0;
+	*tp++ = 0;
+
+	sprintf(path, "%s/p%04d.prg", dir, i);
+	if ((fp = fopen(path, "wb")) == NULL)
+		return -1;
+	fwrite(prg, 1, tp - prg, fp);
+	fclose(fp);
+    }
+    free(prg);
+
+    return 0;
+}
+
+
+int
+main(int argc, char **argv)
+{
+    char tmpdir[] = "/tmp/prgbenchXXXXXX";
+    char path[1024];
+    const char *dir;
+    struct dirent *de;
+    prgopts_t opts;
+    diag_t diag;
+    double t[2] = { 0, 0 }, t0;
+    long sc[2] = { 0, 0 }, s0, overhead;
+    long bytes = 0, nfiles = 0;
+    FILE *fi, *fo;
+    DIR *dp;
+    int i;
+
+    tokens_init();
+    prgopts_init(&opts);
+    diag_init(&diag, NULL, NULL);
+
+    if (argc > 1) {
+	dir = argv[1];
+    } else {
+	if ((dir = mkdtemp(tmpdir)) == NULL || mkcorpus(dir) < 0) {
+		fprintf(stderr, "Unable to create corpus\n");
+		return 2;
+	}
+    }
+
+    /* what it costs to ask for the syscall count itself */
+    s0 = syscalls();
+    overhead = syscalls() - s0;
+
+    if ((dp = opendir(dir)) == NULL) {
+	fprintf(stderr, "Unable to open '%s'\n", dir);
+	return 2;
+    }
+    while ((de = readdir(dp)) != NULL) {
+	if (strstr(de->d_name, ".prg") == NULL)
+		continue;
+	sprintf(path, "%s/%s", dir, de->d_name);
+
+	/* run the old and the new code on the same file */
+	for (i = 0; i < 2; ++i) {
+		fi = fopen(path, "rb");
+		fo = fopen("/dev/null", "wb");
+		if (fi == NULL || fo == NULL) {
+			fprintf(stderr, "Unable to open '%s'\n", path);
+			return 2;
+		}
+		s0 = syscalls();
+		t0 = now();
+		if (i == 0)
+			prg2bas_stdio(fi, fo);
+		else
+			prg2bas_file(fi, fo, &opts, &diag);
+		fflush(fo);
+		t[i] += now() - t0;
+		sc[i] += syscalls() - s0 - overhead;
+		if (i == 0) {
+			fseek(fi, 0, SEEK_END);
+			bytes += ftell(fi);
+		}
+		fclose(fi);
+		fclose(fo);
+	}
+	if (dir == tmpdir)
+		remove(path);
+	nfiles++;
+    }
+    closedir(dp);
+    if (dir == tmpdir)
+	rmdir(dir);
+
+    if (nfiles == 0) {
+	fprintf(stderr, "No .prg files in '%s'\n", dir);
+	return 1;
+    }
+
+    printf("corpus:   %ld files, %ld bytes\n", nfiles, bytes);
+    printf("stdio:    %8.2f MB/s, %6.1f syscalls/file\n",
+	   bytes / t[0] / 1e6, (double)sc[0] / nfiles);
+    printf("buffered: %8.2f MB/s, %6.1f syscalls/file\n",
+	   bytes / t[1] / 1e6, (double)sc[1] / nfiles);
+
+    return 0;
+}
@@ -0,0 +1,410 @@
+/*
+ * prgdup.c, find the same program and near copies of it in a collection
+ * of PRG files.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+#include "tokens.h"
+#include "prgtools.h"
+#include "batch.h"
+
+
+/* One program to fingerprint. */
+typedef struct {
+    char	*name;
+    prgfp_t	fp;
+    int		status;		// 0 done, -1 failed, 1 not BASIC
+    char	error[128];
+} fpjob_t;
+
+typedef struct {
+    fpjob_t	*jobs;
+    int		dialect;
+    unsigned char **buf;	// one file buffer per worker
+    outbuf_t	*unpacked;	// and one for packed programs
+} fpbatch_t;
+
+
+/*
+ * read and fingerprint one PRG file, unpacking it first if it was packed
+ * by bas2prg -p
+ * returns 0, 1 if it is not a BASIC program, or -1 (reason in diag)
+ */
+static int
+fingerprint_file(const char *name, unsigned char *buf, outbuf_t *unpacked,
+		 int dialect, prgfp_t *fp, diag_t *diag)
+{
+    const unsigned char *prg = buf;
+    long len;
+    FILE *fi;
+    int ret;
+
+    if ((fi = fopen(name, "rb")) == NULL)
+	return diag_error(diag, "unable to open input");
+    len = readall(fi, buf, MAXPRGLEN);
+    fclose(fi);
+    if (len < 0)
+	return diag_error(diag, "read error");
+    if (len < 2)
+	return diag_error(diag, "no load address");
+
+    unpacked->len = 0;
+    if (prg_ispacked(buf, len)) {
+	if (prg_unpack(buf, len, unpacked, diag) < 0)
+		return -1;
+	prg = (unsigned char *)unpacked->buf;
+	len = unpacked->len;
+    }
+    if (!prg_isbasic(prg, len))
+	return 1;
+
+    ret = prg_fingerprint(prg + 2, len - 2, dialect, fp);
+    if (ret < 0)
+	return diag_error(diag, "out of memory");
+
+    return 0;
+}
+
+
+static void
+fpjob(void *arg, int n, int worker)
+{
+    fpbatch_t *b = (fpbatch_t *)arg;
+    fpjob_t *j = &b->jobs[n];
+    diag_t diag;
+
+    diag_init(&diag, NULL, j->name);
+    j->status = fingerprint_file(j->name, b->buf[worker],
+				 &b->unpacked[worker], b->dialect, &j->fp,
+				 &diag);
+    if (j->status < 0)
+	strcpy(j->error, diag.error);
+}
+
+
+/*
+ * fingerprint the programs in files and directories on a pool of
+ * threads, and write them to an index
+ * returns the number of files that failed
+ */
+static int
+build(const char *index, char **inputs, int ninputs, int dialect,
+      int nthreads, int quiet)
+{
+    fpbatch_t b;
+    char **names;
+    prgfp_t *fps;
+    int n, i, count = 0, failed = 0, skipped = 0;
+
+    n = batch_files(inputs, ninputs, ".prg", &names);
+    if (nthreads <= 0)
+	nthreads = pool_ncpus();
+
+    memset(&b, 0, sizeof(b));
+    b.dialect = dialect;
+    b.jobs = calloc(n + 1, sizeof(fpjob_t));
+    b.buf = calloc(nthreads, sizeof(unsigned char *));
+    b.unpacked = calloc(nthreads, sizeof(outbuf_t));
+    fps = malloc((n + 1) * sizeof(prgfp_t));
+    if (b.jobs == NULL || b.buf == NULL || b.unpacked == NULL || fps == NULL)
+	goto oom;
+    for (i = 0; i < nthreads; ++i) {
+	if ((b.buf[i] = malloc(MAXPRGLEN)) == NULL)
+		goto oom;
+    }
+    for (i = 0; i < n; ++i)
+	b.jobs[i].name = names[i];
+
+    if (pool_run(n, nthreads, fpjob, &b) < 0)
+	goto oom;
+
+    /* The programs keep the order of the files. */
+    for (i = 0; i < n; ++i) {
+	if (b.jobs[i].status < 0) {
+		fprintf(stderr, "%s: %s\n", names[i], b.jobs[i].error);
+		failed++;
+	} else if (b.jobs[i].status > 0)
+		skipped++;
+	else {
+		names[count] = names[i];
+		fps[count++] = b.jobs[i].fp;
+		continue;
+	}
+	free(names[i]);
+    }
+
+    if (fpindex_write(index, names, fps, count) < 0) {
+	fprintf(stderr, "Unable to write index '%s'\n", index);
+	failed++;
+    } else if (!quiet)
+	fprintf(stderr, "%i programs indexed, %i failed, %i not BASIC\n",
+		count, failed, skipped);
+
+    for (i = 0; i < count; ++i)
+	free(names[i]);
+    for (i = 0; i < nthreads; ++i) {
+	free(b.buf[i]);
+	outbuf_free(&b.unpacked[i]);
+    }
+    free(b.buf);
+    free(b.unpacked);
+    free(b.jobs);
+    free(names);
+    free(fps);
+
+    return failed;
+
+oom:
+    fprintf(stderr, "Out of memory\n");
+    exit(2);
+}
+
+
+/*
+ * print the programs in the index that are like a file
+ */
+static void
+print_matches(const fpindex_t *x, const char *name, const fpmatch_t *m,
+	      long n)
+{
+    const char *other;
+    long i;
+
+    for (i = 0; i < n; ++i) {
+	other = fpindex_get(x, m[i].index, NULL);
+	if (m[i].exact)
+		printf("%s: same as %s\n", name, other);
+	else if (m[i].similarity == 1)
+		printf("%s: almost the same as %s\n", name, other);
+	else
+		printf("%s: %.0f%% like %s\n", name, 100 * m[i].similarity,
+		       other);
+    }
+}
+
+
+/*
+ * look up each file in the index
+ * returns the number of files that could not be read
+ */
+static int
+query(const fpindex_t *x, char **files, int nfiles, int dialect,
+      double threshold)
+{
+    unsigned char *buf;
+    outbuf_t unpacked;
+    fpmatch_t *m;
+    prgfp_t fp;
+    diag_t diag;
+    long n;
+    int i, ret, failed = 0;
+
+    if ((buf = malloc(MAXPRGLEN)) == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	exit(2);
+    }
+    memset(&unpacked, 0, sizeof(unpacked));
+
+    for (i = 0; i < nfiles; ++i) {
+	diag_init(&diag, NULL, files[i]);
+	ret = fingerprint_file(files[i], buf, &unpacked, dialect, &fp, &diag);
+	if (ret != 0) {
+		fprintf(stderr, "%s: %s\n", files[i],
+			ret < 0 ? diag.error : "not a BASIC program");
+		failed++;
+		continue;
+	}
+	if ((n = fpindex_find(x, &fp, threshold, &m)) < 0) {
+		fprintf(stderr, "Out of memory\n");
+		exit(2);
+	}
+	print_matches(x, files[i], m, n);
+	free(m);
+    }
+
+    free(buf);
+    outbuf_free(&unpacked);
+
+    return failed;
+}
+
+
+static long
+root(long *parent, long i)
+{
+    while (parent[i] != i)
+	i = parent[i] = parent[parent[i]];
+
+    return i;
+}
+
+
+/*
+ * print the programs of the index in groups of copies, a blank line
+ * between groups; the first of a group is the one the others are
+ * compared with
+ */
+static void
+groups(const fpindex_t *x, double threshold)
+{
+    long count = fpindex_count(x);
+    long *parent, *next, *last;
+    fpmatch_t *m;
+    prgfp_t fp, first;
+    long i, k, n, a, b;
+    int blank = 0;
+
+    parent = malloc((count + 1) * sizeof(long));
+    next = malloc((count + 1) * sizeof(long));
+    last = malloc((count + 1) * sizeof(long));
+    if (parent == NULL || next == NULL || last == NULL)
+	goto oom;
+    for (i = 0; i < count; ++i)
+	parent[i] = i;
+
+    for (i = 0; i < count; ++i) {
+	fpindex_get(x, i, &fp);
+	if ((n = fpindex_find(x, &fp, threshold, &m)) < 0)
+		goto oom;
+	for (k = 0; k < n; ++k) {
+		a = root(parent, i);
+		b = root(parent, m[k].index);
+		if (a != b)
+			parent[a > b ? a : b] = a < b ? a : b;
+	}
+	free(m);
+    }
+
+    /* chain the members of each group in order, from its lowest */
+    for (i = 0; i < count; ++i) {
+	next[i] = -1;
+	last[i] = i;
+    }
+    for (i = 0; i < count; ++i) {
+	a = root(parent, i);
+	if (a != i) {
+		next[last[a]] = i;
+		last[a] = i;
+	}
+    }
+
+    for (i = 0; i < count; ++i) {
+	if (parent[i] != i || next[i] < 0)
+		continue;
+	if (blank)
+		printf("\n");
+	blank = 1;
+	printf("%s\n", fpindex_get(x, i, &first));
+	for (k = next[i]; k >= 0; k = next[k]) {
+		fpindex_get(x, k, &fp);
+		if (fp.exact == first.exact)
+			printf("  same %s\n", fpindex_get(x, k, NULL));
+		else if (fp_similarity(&first, &fp) == 1)
+			printf("  ~    %s\n", fpindex_get(x, k, NULL));
+		else
+			printf("  %3.0f%% %s\n", 100 * fp_similarity(&first, &fp),
+			       fpindex_get(x, k, NULL));
+	}
+    }
+
+    free(parent);
+    free(next);
+    free(last);
+    return;
+
+oom:
+    fprintf(stderr, "Out of memory\n");
+    exit(2);
+}
+
+
+int
+main(int argc, char **argv)
+{
+    fpindex_t *x;
+    int c, ret, dialect = DIALECT_V2;
+    int nthreads = 0, quiet = 0;
+    double threshold = 0.8;
+    char *out_name = NULL;
+    char *in_name = NULL;
+
+    /* Process commandline arguments. */
+    opterr = 0;
+    while ((c = getopt(argc, argv, "D:i:j:o:qt:")) != EOF) switch (c) {
+	case 'D':	// dialect
+		if ((dialect = dialect_find(optarg)) < 0) {
+			fprintf(stderr, "Unknown dialect '%s', use 2, 4, 3.5, 7 or simons\n",
+				optarg);
+			exit(1);
+		}
+		break;
+
+	case 'i':	// index-file
+		in_name = optarg;
+		break;
+
+	case 'j':	// batch-threads
+		nthreads = atoi(optarg);
+		break;
+
+	case 'o':	// output-index
+		out_name = optarg;
+		break;
+
+	case 'q':	// quiet
+		quiet = 1;
+		break;
+
+	case 't':	// similarity-threshold
+		threshold = atof(optarg);
+		if (threshold > 1)
+			threshold /= 100;
+		break;
+
+	default:
+usage:
+		fprintf(stderr,
+			"Usage: prgdup [-q] [-D dialect] [-j threads] -o index file|dir ...\n"
+			"       prgdup [-D dialect] [-t share] -i index [file ...]\n");
+		exit(1);
+    }
+    if ((out_name == NULL) == (in_name == NULL) ||
+	(out_name != NULL && optind == argc))
+	goto usage;
+
+    tokens_init();
+
+    if (out_name != NULL)
+	return build(out_name, &argv[optind], argc - optind, dialect,
+		     nthreads, quiet) ? 4 : 0;
+
+    if ((x = fpindex_open(in_name)) == NULL) {
+	fprintf(stderr, "Unable to read index '%s'\n", in_name);
+	return 3;
+    }
+    ret = 0;
+    if (optind == argc)
+	groups(x, threshold);
+    else
+	ret = query(x, &argv[optind], argc - optind, dialect, threshold) ? 3 : 0;
+    fpindex_close(x);
+
+    return ret;
+}
@@ -0,0 +1,377 @@
+/*
+ * prgfind.c, find the lines of PRG files that contain a run of BASIC
+ * keywords and literals, through an index of their token n-grams.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+#include "tokens.h"
+#include "prgtools.h"
+#include "batch.h"
+
+
+#define NG_SLICE	256		// files read on the pool at a time
+#define NG_SEGMENT	(4L << 20)	// keys in a segment, about 64M
+
+#define MAXKEYS		64		// in one query
+
+
+/* One program to index. */
+typedef struct {
+    char	*name;
+    outbuf_t	keys;		// its ngpost_t
+    int		status;		// 0 done, -1 failed, 1 not BASIC
+    char	error[128];
+} ngjob_t;
+
+typedef struct {
+    ngjob_t	*jobs;
+    int		dialect;
+    unsigned char **buf;	// one file buffer per worker
+    outbuf_t	*unpacked;	// and one for packed programs
+} ngbatch_t;
+
+
+static int
+namecmp(const void *a, const void *b)
+{
+    return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+
+/*
+ * read one PRG file and take the keys of its lines, unpacking it first if
+ * it was packed by bas2prg -p
+ */
+static void
+ngjob(void *arg, int n, int worker)
+{
+    ngbatch_t *b = (ngbatch_t *)arg;
+    ngjob_t *j = &b->jobs[n];
+    unsigned char *prg = b->buf[worker];
+    outbuf_t *unpacked = &b->unpacked[worker];
+    diag_t diag;
+    long len;
+    FILE *fi;
+
+    diag_init(&diag, NULL, j->name);
+    if ((fi = fopen(j->name, "rb")) == NULL) {
+	j->status = diag_error(&diag, "unable to open input");
+	goto out;
+    }
+    len = readall(fi, prg, MAXPRGLEN);
+    fclose(fi);
+    if (len < 0) {
+	j->status = diag_error(&diag, "read error");
+	goto out;
+    }
+
+    unpacked->len = 0;
+    if (prg_ispacked(prg, len)) {
+	if ((j->status = prg_unpack(prg, len, unpacked, &diag)) < 0)
+		goto out;
+	prg = (unsigned char *)unpacked->buf;
+	len = unpacked->len;
+    }
+    if (!prg_isbasic(prg, len)) {
+	j->status = 1;
+	return;
+    }
+
+    /* numbered from 0 in the slice, the caller renumbers them */
+    if (ngram_prg(prg + 2, len - 2, b->dialect, 0, &j->keys) < 0)
+	j->status = diag_error(&diag, "out of memory");
+
+out:
+    if (j->status < 0)
+	strcpy(j->error, diag.error);
+}
+
+
+/*
+ * index the programs in files and directories, adding them to the index
+ * if add is set (but not those already in it), or making a new index
+ * returns the number of files that failed
+ */
+static int
+build(const char *index, char **inputs, int ninputs, int add, int dialect,
+      int nthreads, int quiet)
+{
+    ngbatch_t b;
+    ngindex_t *x;
+    outbuf_t keys;
+    ngpost_t *pp;
+    char **names, **old = NULL, **seg, *path;
+    FILE *fp;
+    long nold = 0, nseg = 0, i, k;
+    int n, start, end, failed = 0, skipped = 0, count = 0;
+
+    n = batch_files(inputs, ninputs, ".prg", &names);
+    if (nthreads <= 0)
+	nthreads = pool_ncpus();
+
+    /* A new index is made beside the old one, and replaces it at the end. */
+    if (!add) {
+	if ((path = malloc(strlen(index) + 5)) == NULL)
+		goto oom;
+	sprintf(path, "%s.new", index);
+	remove(path);
+    } else
+	path = (char *)index;
+
+    /* the names already in the index, to be skipped */
+    if ((x = ngindex_open(path, 1)) == NULL) {
+	fprintf(stderr, "Unable to read index '%s'\n", path);
+	exit(3);
+    }
+    nold = ngindex_count(x);
+    if ((old = malloc((nold + 1) * sizeof(char *))) == NULL)
+	goto oom;
+    for (i = 0; i < nold; ++i)
+	old[i] = (char *)ngindex_name(x, i);
+    qsort(old, nold, sizeof(char *), namecmp);
+
+    memset(&b, 0, sizeof(b));
+    memset(&keys, 0, sizeof(keys));
+    b.dialect = dialect;
+    b.jobs = calloc(NG_SLICE, sizeof(ngjob_t));
+    b.buf = calloc(nthreads, sizeof(unsigned char *));
+    b.unpacked = calloc(nthreads, sizeof(outbuf_t));
+    seg = malloc((n + 1) * sizeof(char *));
+    if (b.jobs == NULL || b.buf == NULL || b.unpacked == NULL || seg == NULL)
+	goto oom;
+    for (i = 0; i < nthreads; ++i) {
+	if ((b.buf[i] = malloc(MAXPRGLEN)) == NULL)
+		goto oom;
+    }
+
+    for (start = 0; start < n; start = end) {
+	/* a slice of the files not indexed yet */
+	for (end = start, k = 0; end < n && k < NG_SLICE; ++end) {
+		if (bsearch(&names[end], old, nold, sizeof(char *), namecmp)) {
+			skipped++;
+			continue;
+		}
+		memset(&b.jobs[k], 0, sizeof(ngjob_t));
+		b.jobs[k++].name = names[end];
+	}
+	if (pool_run(k, nthreads, ngjob, &b) < 0)
+		goto oom;
+
+	for (i = 0; i < k; ++i) {
+		if (b.jobs[i].status < 0) {
+			fprintf(stderr, "%s: %s\n", b.jobs[i].name,
+				b.jobs[i].error);
+			failed++;
+		} else if (b.jobs[i].status > 0)
+			skipped++;
+		else {
+			for (pp = (ngpost_t *)b.jobs[i].keys.buf;
+			     (char *)pp < b.jobs[i].keys.buf + b.jobs[i].keys.len;
+			     ++pp)
+				pp->file = nseg;
+			seg[nseg++] = b.jobs[i].name;
+			if (outbuf_reserve(&keys, b.jobs[i].keys.len) < 0)
+				goto oom;
+			memcpy(&keys.buf[keys.len], b.jobs[i].keys.buf,
+			       b.jobs[i].keys.len);
+			keys.len += b.jobs[i].keys.len;
+			count++;
+		}
+		outbuf_free(&b.jobs[i].keys);
+	}
+
+	/* Big enough for a segment of its own, or the last. */
+	if (nseg > 0 && (keys.len >= NG_SEGMENT * sizeof(ngpost_t) ||
+			 end == n)) {
+		if (ngindex_append(path, seg, nseg, (ngpost_t *)keys.buf,
+				   keys.len / sizeof(ngpost_t)) < 0) {
+			fprintf(stderr, "Unable to write index '%s'\n", path);
+			exit(2);
+		}
+		nseg = 0;
+		keys.len = 0;
+	}
+    }
+
+    ngindex_close(x);
+    if (!add) {
+	/* an empty index is still made */
+	if (count == 0 && (fp = fopen(path, "ab")) != NULL)
+		fclose(fp);
+#ifdef _WIN32
+	/* rename() does not replace files here */
+	remove(index);
+#endif
+	if (rename(path, index) != 0) {
+		fprintf(stderr, "Unable to write index '%s'\n", index);
+		exit(2);
+	}
+	free(path);
+    }
+    if (!quiet)
+	fprintf(stderr, "%i programs indexed, %i failed, %i skipped\n",
+		count, failed, skipped);
+
+    for (i = 0; i < n; ++i)
+	free(names[i]);
+    for (i = 0; i < nthreads; ++i) {
+	free(b.buf[i]);
+	outbuf_free(&b.unpacked[i]);
+    }
+    free(b.buf);
+    free(b.unpacked);
+    free(b.jobs);
+    outbuf_free(&keys);
+    free(names);
+    free(seg);
+    free(old);
+
+    return failed;
+
+oom:
+    fprintf(stderr, "Out of memory\n");
+    exit(2);
+}
+
+
+/*
+ * upper case letters outside strings, as keywords and names are typed
+ */
+static void
+upcase(char *s)
+{
+    int quoted = 0;
+
+    for (; *s; ++s) {
+	if (*s == '"')
+		quoted = !quoted;
+	else if (!quoted && *s >= 'a' && *s <= 'z')
+		*s -= 'a' - 'A';
+    }
+}
+
+
+int
+main(int argc, char **argv)
+{
+    prgopts_t opts;
+    ngindex_t *x;
+    ngpost_t *hits;
+    unsigned long long keys[MAXKEYS];
+    int c, i, nkeys, add = 0, names = 0, nthreads = 0, quiet = 0;
+    long n, k;
+    size_t len;
+    char *out_name = NULL;
+    char *in_name = NULL;
+    char *query;
+
+    /* Set defaults. */
+    prgopts_init(&opts);
+
+    /* Process commandline arguments. */
+    opterr = 0;
+    while ((c = getopt(argc, argv, "aD:i:j:lo:q")) != EOF) switch (c) {
+	case 'a':	// add-to-index
+		add = 1;
+		break;
+
+	case 'D':	// dialect
+		if ((opts.dialect = dialect_find(optarg)) < 0) {
+			fprintf(stderr, "Unknown dialect '%s', use 2, 4, 3.5, 7 or simons\n",
+				optarg);
+			exit(1);
+		}
+		break;
+
+	case 'i':	// index-file
+		in_name = optarg;
+		break;
+
+	case 'j':	// batch-threads
+		nthreads = atoi(optarg);
+		break;
+
+	case 'l':	// file-names-only
+		names = 1;
+		break;
+
+	case 'o':	// output-index
+		out_name = optarg;
+		break;
+
+	case 'q':	// quiet
+		quiet = 1;
+		break;
+
+	default:
+usage:
+		fprintf(stderr,
+			"Usage: prgfind [-aq] [-D dialect] [-j threads] -o index file|dir ...\n"
+			"       prgfind [-l] [-D dialect] -i index text ...\n");
+		exit(1);
+    }
+    if ((out_name == NULL) == (in_name == NULL) || optind == argc)
+	goto usage;
+
+    tokens_init();
+
+    if (out_name != NULL)
+	return build(out_name, &argv[optind], argc - optind, add,
+		     opts.dialect, nthreads, quiet) ? 4 : 0;
+
+    /* The words of the query make one line of BASIC. */
+    for (len = 1, i = optind; i < argc; ++i)
+	len += strlen(argv[i]) + 1;
+    if ((query = malloc(len)) == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	return 2;
+    }
+    for (*query = '\0', i = optind; i < argc; ++i) {
+	if (i > optind)
+		strcat(query, " ");
+	strcat(query, argv[i]);
+    }
+    upcase(query);
+    if ((nkeys = ngram_query(query, &opts, keys, MAXKEYS)) == 0) {
+	fprintf(stderr, "Nothing to look for\n");
+	return 1;
+    }
+
+    if ((x = ngindex_open(in_name, 0)) == NULL) {
+	fprintf(stderr, "Unable to read index '%s'\n", in_name);
+	return 3;
+    }
+    if ((n = ngindex_find(x, keys, nkeys, &hits)) < 0) {
+	fprintf(stderr, "Out of memory\n");
+	return 2;
+    }
+    for (k = 0; k < n; ++k) {
+	if (!names)
+		printf("%s:%u\n", ngindex_name(x, hits[k].file), hits[k].line);
+	else if (k == 0 || hits[k].file != hits[k - 1].file)
+		printf("%s\n", ngindex_name(x, hits[k].file));
+    }
+    free(hits);
+    free(query);
+    ngindex_close(x);
+
+    /* like grep, whether anything was found */
+    return n > 0 ? 0 : 1;
+}
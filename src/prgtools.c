@@ -0,0 +1,73 @@
+/*
+ * prgtools.c, batch entry point of libprgtools.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "prgtools.h"
+
+
+/*
+ * convert an array of files in one call
+ *
+ * The outputs are packed one after the other into the arena, which is
+ * caller memory; nothing is allocated. A job that does not fit fails with
+ * "output buffer full", and the jobs after it are still tried.
+ *
+ * returns the number of jobs that failed, or -1 for a bad direction
+ */
+int
+prgtools_batch(int dir, prgjob_t *jobs, int njobs, void *arena, size_t size,
+	       const prgopts_t *opts)
+{
+    char *ap = arena;
+    outbuf_t out;
+    diag_t diag;
+    int failed = 0;
+    int i;
+
+    if (dir != PRG_BAS2PRG && dir != PRG_PRG2BAS)
+	return -1;
+
+    for (i = 0; i < njobs; ++i) {
+	diag_init(&diag, NULL, NULL);
+	outbuf_init(&out, ap, (char *)arena + size - ap);
+
+	if (dir == PRG_BAS2PRG)
+		jobs[i].status = bas2prg_buf(jobs[i].in, jobs[i].inlen,
+					     &out, opts, &diag);
+	else
+		jobs[i].status = prg2bas_buf(jobs[i].in, jobs[i].inlen,
+					     &out, opts, &diag);
+
+	if (jobs[i].status == 0) {
+		jobs[i].out = ap;
+		jobs[i].outlen = out.len;
+		jobs[i].error[0] = '\0';
+		ap += out.len;
+	} else {
+		jobs[i].out = NULL;
+		jobs[i].outlen = 0;
+		strcpy(jobs[i].error, diag.error);
+		failed++;
+	}
+	jobs[i].warnings = diag.warnings;
+    }
+
+    return failed;
+}
@@ -0,0 +1,503 @@
+/*
+ * prgtools.h, interface to libprgtools (bas2prg and prg2bas internals).
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef _PRGTOOLS_H_
+# define _PRGTOOLS_H_
+
+
+#define MAXLINELEN	1024
+#define MAXPRGLEN	(2 + 65536)	// load address plus all of memory
+#define TOKEN_DATA	0x83
+#define TOKEN_REM	0x8f
+
+/* BASIC dialects, for prgopts_t.dialect. */
+#define DIALECT_V2	0	// C64 BASIC V2
+#define DIALECT_V4	1	// PET BASIC 4.0
+#define DIALECT_V35	2	// Plus/4 and C16 BASIC 3.5
+#define DIALECT_V7	3	// C128 BASIC 7.0
+#define DIALECT_SIMONS	4	// Simons' BASIC on the C64
+#define NDIALECTS	5
+
+/* How PETSCII in strings and REMs is written in text, for prgopts_t.charset. */
+#define CHARSET_RAW	0	// byte for byte
+#define CHARSET_ESCAPES	1	// {clr}, {d0} for what is not printable ASCII
+#define CHARSET_UTF8	2	// the same, but a pound sign, arrows and pi
+#define NCHARSETS	3
+
+/* Phases of a conversion, timed in prgmetrics_t. */
+#define TIME_READ	0
+#define TIME_CONVERT	1
+#define TIME_WRITE	2
+#define NTIMES		3
+
+/* Fingerprints, see fprint.c. */
+#define FP_NMIN		32	// MinHash values
+#define FP_NBANDS	8	// bands of them looked up to find candidates
+#define FP_NGRAM	4	// units in a shingle
+
+/* Directions for prgtools_batch(). */
+#define PRG_BAS2PRG	0
+#define PRG_PRG2BAS	1
+
+
+/* Tokenized lines kept between runs, see tokcache.c. */
+typedef struct tokcache tokcache_t;
+
+/* An index of fingerprints, mapped from its file, see fprint.c. */
+typedef struct fpindex fpindex_t;
+
+/* An index of the token n-grams of lines, see ngram.c. */
+typedef struct ngindex ngindex_t;
+
+/* The profile of a run of a program, see bas_run(). */
+typedef struct runprof runprof_t;
+
+
+/*
+ * Conversion options. Everything a conversion needs is passed in here, so
+ * the routines below can be used from several threads at once.
+ */
+typedef struct {
+    int		debug;		// debug level
+    int		invertcase;	// swap the case of ASCII letters
+    int		abbrevs;	// accept shifted-letter keyword abbreviations
+    int		autonumber;	// add line numbers if no line number found
+    int		trimspaces;	// remove spaces from beginning/end of line
+    int		collapsespaces;	// remove free spaces inside line
+    int		dialect;	// DIALECT_*, which keywords there are
+    int		charset;	// CHARSET_*, how PETSCII is written as text
+    int		crunch;		// bas2prg: 1 to crunch the program, 2 to also
+				// merge lines past 80 characters
+    int		optimize;	// bas2prg: make the program run faster
+    int		reorder;	// bas2prg: move the subroutines called most to
+				// the top
+    const runprof_t *profile;	// bas2prg: how often lines ran, for
+				// reordering, or NULL to count the GOSUBs
+    int		pack;		// bas2prg: make a PRG that unpacks itself
+    int		range;		// prg2bas: list only firstline to lastline
+    long	firstline, lastline;
+    long	startaddr;	// load address
+    long	ramtop;		// bas2prg: the program must end below this,
+				// 0 for no limit
+    tokcache_t	*cache;		// bas2prg: reuse tokenized lines, or NULL;
+				// not to be shared between threads
+} prgopts_t;
+
+
+/*
+ * An output buffer, so a whole file can be written at once. It grows as
+ * needed, unless it was set up over caller memory with outbuf_init().
+ */
+typedef struct {
+    char	*buf;
+    size_t	len;		// bytes used
+    size_t	size;		// bytes allocated
+    int		fixed;		// buf is not ours, do not grow it
+} outbuf_t;
+
+
+/*
+ * What a single conversion did, collected when diag_t.metrics is set.
+ */
+typedef struct {
+    int		dialect;	// of the tokens counted
+    long	lines;		// BASIC lines in the program
+    long	tokens;		// keywords in them
+    long	hist[256];	// keywords by token byte
+    long	*phist[256];	// and by second byte after a prefix, NULL
+				// until one is seen
+    long	bytesin;
+    long	bytesout;
+    double	wall[NTIMES];	// seconds spent in each phase
+    double	cpu[NTIMES];	// of this thread's CPU time
+    double	wall0, cpu0;	// when the phase being timed started
+    outbuf_t	warnings;	// a line number, a tab and the message for
+				// each warning
+} prgmetrics_t;
+
+
+/*
+ * Diagnostics for a single conversion.
+ */
+typedef struct {
+    FILE	*fp;		// where messages go, NULL to discard them
+    const char	*name;		// prefix for messages, or NULL
+    int		verbose;	// also print informational messages
+    int		warnings;	// number of warnings issued
+    char	error[128];	// reason the conversion failed
+    outbuf_t	*log;		// collect messages here instead of fp
+    long	line;		// BASIC line being converted, or -1
+    prgmetrics_t *metrics;	// record warnings and timings here, or NULL
+} diag_t;
+
+
+/*
+ * Converts a program given without its load address, the way it lies in
+ * a tape archive: prg2bas_image() or prg2json_image().
+ */
+typedef int	(*prgimage_fn)(long load, const unsigned char *sp, long len,
+			       outbuf_t *out, const prgopts_t *opts,
+			       diag_t *diag);
+
+
+/*
+ * One conversion for prgtools_batch().
+ */
+typedef struct {
+    const void	*in;		// input file contents
+    long	inlen;
+    void	*out;		// output, inside the arena
+    long	outlen;
+    int		status;		// 0 or -1, reason in error
+    int		warnings;
+    char	error[128];
+} prgjob_t;
+
+
+/*
+ * A 1541 disk image held in memory.
+ */
+typedef struct {
+    unsigned char *data;
+    long	size;
+    int		tracks;
+} d64_t;
+
+/*
+ * A directory entry of a disk image or a tape archive.
+ */
+typedef struct {
+    char	name[17];	// PETSCII, without the padding
+    int		type;		// file type byte, 0x82 for a closed PRG
+    int		track;		// D64: first sector of the file
+    int		sector;
+    int		blocks;		// D64: size in sectors
+    long	load;		// T64: load address
+    long	offset;		// T64: where the data is in the archive
+    long	len;		// T64: length of the data
+} imgent_t;
+
+#define D64_PRG		2	// (type & 7) of a PRG file
+#define D64_SIZE	174848	// a 35-track image
+
+/*
+ * A member of a tar archive in memory.
+ */
+#define TAR_MAXNAME	1024
+
+typedef struct {
+    char	name[TAR_MAXNAME];
+    int		type;		// '0' for a file, 0 at the end of the archive
+    long	mode;
+    long long	mtime;
+    const unsigned char *data;	// where it is in the archive
+    long	size;
+} tarent_t;
+
+
+/*
+ * What is left of a program when link pointers, line numbers and free
+ * spaces are taken away: a hash for exact matches and a MinHash for near
+ * ones.
+ */
+typedef struct {
+    unsigned long long exact;
+    unsigned int minhash[FP_NMIN];
+    long	lines;
+    long	units;		// keywords, strings, numbers, names and
+				// other bytes
+} prgfp_t;
+
+/*
+ * A program found in an index by fpindex_find().
+ */
+typedef struct {
+    long	index;		// for fpindex_get()
+    double	similarity;	// estimated share that is the same
+    int		exact;		// the same program
+} fpmatch_t;
+
+
+/*
+ * A key of a line, or a line found by ngindex_find().
+ */
+typedef struct {
+    unsigned long long key;	// a run of units, hashed
+    unsigned int file;		// the program
+    unsigned int line;		// its line number
+} ngpost_t;
+
+
+/*
+ * A line of a program in memory, found by prg_lineindex().
+ */
+typedef struct {
+    unsigned int number;	// line number
+    long	off;		// of its link pointer, from the load address
+    long	len;		// of its text, without the nul
+} prgline_t;
+
+
+/*
+ * Running a program with bas_run().
+ */
+typedef struct {
+    FILE	*in;		// what is typed, line by line, or NULL
+    FILE	*out;		// what is printed, or NULL
+    int		charset;	// CHARSET_*, for both
+    double	maxcycles;	// give up after this many, 0 for never
+} runopts_t;
+
+/*
+ * Where the time went in one line. Cycles are estimated from what the ROM
+ * routines would take on a C64.
+ */
+typedef struct {
+    long	line;		// line number
+    long	hits;		// times execution came to the line
+    long	stmts;		// statements executed
+    long	gcs;		// string garbage collections
+    double	cycles;
+} lineprof_t;
+
+struct runprof {
+    lineprof_t	*lines;		// one for each line, in order
+    int		nlines;
+    long	stmts;
+    long	gcs;
+    double	gccycles;	// of cycles, spent collecting garbage
+    double	cycles;
+    int		error;		// the BASIC error it ended with, or 0
+    long	errline;	// the line it ended in
+};
+
+#define CYCLES_SECOND	985248.0	// a PAL C64
+
+/*
+ * Rough cycle counts of the ROM routines, for the profile of bas_run()
+ * and the estimates of prg_optimize(). They are averages, good enough to
+ * see which lines are slow and why: every byte of program text costs a
+ * CHRGET, variables are found by a linear search, constants are converted
+ * from decimal every time they are used, and GOTO searches the program
+ * from the start or from the current line.
+ */
+#define C_CHRGET	24	// per byte of program text
+#define C_STMT		60	// statement dispatch
+#define C_LINE		40	// stepping to the next line
+#define C_LINESCAN	35	// per line passed while looking for one
+#define C_VAR		60	// finding a variable...
+#define C_VARSCAN	20	// ...plus this per variable before it
+#define C_ARRAY		250	// indexing, per dimension
+#define C_DIGIT		350	// converting a constant, per character but
+				// the point
+#define C_ADD		150
+#define C_MUL		1000
+#define C_DIV		2200
+#define C_CMP		100
+#define C_INT		250
+#define C_POW		25000
+#define C_TRANS		15000	// SQR, LOG, EXP, SIN, COS, TAN, ATN
+#define C_STRALLOC	150
+#define C_STRBYTE	10	// copying or comparing strings, per byte
+#define C_NUMSTR	3500	// a number to text
+#define C_CHROUT	180	// per character printed
+#define C_GCSCAN	40	// per descriptor per pass of the garbage collector
+#define C_PUSH		120	// FOR, GOSUB, and unwinding them
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* tokens.c, call tokens_init() once before converting anything */
+extern void	tokens_init(void);
+extern int	dialect_find(const char *name);
+extern const char *dialect_name(int dialect);
+extern long	dialect_load(int dialect);
+extern long	dialect_top(int dialect);
+
+/* buffer.c */
+extern void	outbuf_init(outbuf_t *o, void *mem, size_t size);
+extern int	outbuf_reserve(outbuf_t *o, size_t n);
+extern int	outbuf_full(outbuf_t *o, diag_t *d);
+extern int	outbuf_printf(outbuf_t *o, const char *fmt, ...);
+extern int	outbuf_jsonstr(outbuf_t *o, const char *s, size_t len);
+extern void	outbuf_free(outbuf_t *o);
+extern long	readall(FILE *fp, unsigned char *buf, long size);
+extern int	readfile(FILE *fp, outbuf_t *o);
+extern const unsigned char *mapfile(const char *path, long *size);
+extern void	unmapfile(const unsigned char *data, long size);
+
+/* d64.c */
+extern int	d64_sectors(int track);
+extern const unsigned char *d64_sector(const d64_t *d, int track, int sector);
+extern int	d64_open(d64_t *d, unsigned char *data, long size);
+extern int	d64_dir(const d64_t *d, imgent_t **ents);
+extern long	d64_read(const d64_t *d, const imgent_t *e,
+			 unsigned char *buf, long size);
+extern int	d64_blocksfree(d64_t *d);
+extern void	d64_format(d64_t *d, unsigned char *data, const char *name,
+			   const char *id);
+extern int	d64_write(d64_t *d, const char *name,
+			  const unsigned char *data, long len, diag_t *diag);
+
+/* t64.c */
+extern int	t64_check(const unsigned char *data, long size);
+extern int	t64_dir(const unsigned char *data, long size, imgent_t **ents);
+
+/* tar.c */
+extern long	tar_member(const unsigned char *p, long len, tarent_t *ent);
+extern int	tar_header(outbuf_t *out, const char *name, long size,
+			   long long mtime, long mode);
+extern int	tar_pad(outbuf_t *out, long size);
+extern int	tar_end(outbuf_t *out, long long written);
+
+/* diag.c */
+extern void	diag_init(diag_t *d, FILE *fp, const char *name);
+extern void	diag_info(diag_t *d, const char *fmt, ...);
+extern void	diag_warn(diag_t *d, const char *fmt, ...);
+extern int	diag_error(diag_t *d, const char *fmt, ...);
+
+/* metrics.c */
+extern void	metrics_init(prgmetrics_t *m, int dialect);
+extern void	metrics_mark(prgmetrics_t *m);
+extern void	metrics_time(prgmetrics_t *m, int phase);
+extern void	metrics_count(prgmetrics_t *m, const unsigned char *sp,
+			      long len);
+extern int	metrics_json(outbuf_t *o, const char *name,
+			     const prgmetrics_t *m, int status,
+			     const char *error);
+extern int	metrics_write(FILE *fp, const char *name,
+			      const prgmetrics_t *m, int status,
+			      const char *error);
+extern void	metrics_free(prgmetrics_t *m);
+
+/* tokenize.c */
+extern void	prgopts_init(prgopts_t *opts);
+extern int	tokenize(unsigned char *dest, const char *src,
+			 const prgopts_t *opts);
+extern int	bas2prg_buf(const char *src, long len, outbuf_t *out,
+			    const prgopts_t *opts, diag_t *diag);
+extern int	bas2prg_file(FILE *fi, FILE *fo, const prgopts_t *opts,
+			     diag_t *diag);
+
+/* tokcache.c */
+extern tokcache_t *tokcache_open(const char *path);
+extern int	tokcache_tokenize(tokcache_t *c, unsigned char *dest,
+				  const char *src, const prgopts_t *opts);
+extern void	tokcache_stats(const tokcache_t *c, long *lookups, long *hits);
+extern int	tokcache_save(tokcache_t *c, const char *path);
+extern void	tokcache_free(tokcache_t *c);
+
+/* crunch.c */
+extern int	prg_crunch(const unsigned char *prg, long len, outbuf_t *out,
+			   const prgopts_t *opts, diag_t *diag);
+
+/* optimize.c */
+extern int	prg_optimize(const unsigned char *prg, long len, outbuf_t *out,
+			     const prgopts_t *opts, diag_t *diag);
+
+/* reorder.c */
+extern int	prg_reorder(const unsigned char *prg, long len, outbuf_t *out,
+			    const prgopts_t *opts, diag_t *diag);
+
+/* pack.c */
+extern int	prg_ispacked(const unsigned char *prg, long len);
+extern int	prg_pack(const unsigned char *prg, long len, outbuf_t *out,
+			 long top, diag_t *diag);
+extern int	prg_unpack(const unsigned char *prg, long len, outbuf_t *out,
+			   diag_t *diag);
+
+/* fprint.c */
+extern long	prg_lineunits(const unsigned char *sp, const unsigned char *le,
+			      int dialect, unsigned int *u);
+extern int	prg_fingerprint(const unsigned char *sp, long len, int dialect,
+				prgfp_t *fp);
+extern double	fp_similarity(const prgfp_t *a, const prgfp_t *b);
+extern int	fpindex_write(const char *path, char *const *names,
+			      const prgfp_t *fps, long count);
+extern fpindex_t *fpindex_open(const char *path);
+extern long	fpindex_count(const fpindex_t *x);
+extern const char *fpindex_get(const fpindex_t *x, long i, prgfp_t *fp);
+extern long	fpindex_find(const fpindex_t *x, const prgfp_t *fp,
+			     double threshold, fpmatch_t **matches);
+extern void	fpindex_close(fpindex_t *x);
+
+/* ngram.c */
+extern long	ngram_prg(const unsigned char *sp, long len, int dialect,
+			  unsigned int file, outbuf_t *out);
+extern int	ngram_query(const char *text, const prgopts_t *opts,
+			    unsigned long long *keys, int max);
+extern int	ngindex_append(const char *path, char *const *names,
+			       long nfiles, ngpost_t *posts, long nposts);
+extern ngindex_t *ngindex_open(const char *path, int empty);
+extern long	ngindex_count(const ngindex_t *x);
+extern const char *ngindex_name(const ngindex_t *x, long i);
+extern long	ngindex_find(const ngindex_t *x, const unsigned long long *keys,
+			     int nkeys, ngpost_t **hits);
+extern void	ngindex_close(ngindex_t *x);
+
+/* interp.c */
+extern int	bas_run(const unsigned char *prg, long len, const runopts_t *ro,
+			runprof_t *prof, diag_t *diag);
+extern void	runprof_free(runprof_t *prof);
+extern int	runprof_read(FILE *fp, runprof_t *prof);
+
+/* detokenize.c */
+extern int	prg_isbasic(const unsigned char *prg, long len);
+extern int	image_isbasic(long load, const unsigned char *sp, long len);
+extern long	prg_linkchain(long load, const unsigned char *sp, long len,
+			      long *end);
+extern long	prg_lineindex(long load, const unsigned char *sp, long len,
+			      prgline_t **lines);
+extern long	prg_linerange(const prgline_t *lines, long n, long first,
+			      long last, long *count);
+extern int	prg2bas_buf(const unsigned char *prg, long len, outbuf_t *out,
+			    const prgopts_t *opts, diag_t *diag);
+extern int	prg2bas_image(long load, const unsigned char *sp, long len,
+			      outbuf_t *out, const prgopts_t *opts,
+			      diag_t *diag);
+extern int	prg2bas_file(FILE *fi, FILE *fo, const prgopts_t *opts,
+			     diag_t *diag);
+extern int	prgimage_buf(const unsigned char *prg, long len,
+			     outbuf_t *out, prgimage_fn conv,
+			     const prgopts_t *opts, diag_t *diag);
+extern int	prgimage_file(FILE *fi, FILE *fo, prgimage_fn conv,
+			      const prgopts_t *opts, diag_t *diag);
+
+/* export.c */
+extern int	prg2json_image(long load, const unsigned char *sp, long len,
+			       outbuf_t *out, const prgopts_t *opts,
+			       diag_t *diag);
+extern int	prg2json_buf(const unsigned char *prg, long len,
+			     outbuf_t *out, const prgopts_t *opts,
+			     diag_t *diag);
+extern int	prg2json_file(FILE *fi, FILE *fo, const prgopts_t *opts,
+			      diag_t *diag);
+
+/* prgtools.c */
+extern int	prgtools_batch(int dir, prgjob_t *jobs, int njobs,
+			       void *arena, size_t size,
+			       const prgopts_t *opts);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif	/*_PRGTOOLS_H_*/
@@ -0,0 +1,564 @@
+/*
+ * reorder.c, move the subroutines a BASIC program calls most to its top.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "tokens.h"
+#include "prgtools.h"
+
+
+/* the tokens reordering looks at */
+#define TOK_END		0x80
+#define TOK_DATA	0x83
+#define TOK_GOTO	0x89
+#define TOK_RUN		0x8a
+#define TOK_IF		0x8b
+#define TOK_GOSUB	0x8d
+#define TOK_RETURN	0x8e
+#define TOK_LIST	0x9b
+#define TOK_TO		0xa4
+#define TOK_THEN	0xa7
+#define TOK_GO		0xcb
+
+#define REORDER_BYTES	255	// longest line renumbering may make
+#define REORDER_UNDEF	63999	// what jumps to missing lines go to
+
+#define ISDIGIT(c)	((c) >= '0' && (c) <= '9')
+
+/*
+ * The program is cut after each line that never goes on to the next: one
+ * that ends with GOTO, RETURN, RUN or END and has no IF (CONT after END
+ * is not thought of). Then the pieces can go in any order, as long as the
+ * first still runs first, the last still ends the program and those with
+ * DATA keep their order. BASIC finds the line of a GOTO or GOSUB by going
+ * down the lines from the top, or from the line it is on for one further
+ * down, so a subroutine called often is found soonest at the top.
+ */
+
+/* how a line ends, and what it has */
+#define RL_END		1	// it never goes on to the next line
+#define RL_DATA		2
+#define RL_LIST		4
+
+typedef struct {
+    long	number;		// as it was
+    long	off, len;	// its text in the program
+    int		seg;		// the piece it is in
+    long	pos;		// where it goes
+    int		flags;		// RL_*
+    int		ref, nrefs;	// its jumps in refs[]
+    double	weight;		// how often it ran, or 1
+} rline_t;
+
+/* A line number a line jumps to. */
+typedef struct {
+    int		from, to;	// the lines, to -1 if there is no such line
+    long	off, len;	// its digits in the program, none for GOTO 0
+    int		gosub;
+    double	weight;		// how often it runs
+} rref_t;
+
+/* A piece of the program that can be moved. */
+typedef struct {
+    int		first, n;	// its lines
+    int		fixed;		// stays with the lines that are not moved
+    int		moved;		// to the top, this time
+    double	calls;		// GOSUBs to it, by how often they run
+} rseg_t;
+
+typedef struct {
+    rline_t	*lines;
+    int		nlines;
+    rref_t	*refs;
+    int		nrefs;
+    rseg_t	*segs;
+    int		nsegs;
+    rseg_t	**cand;		// the pieces to move, best first
+    int		ncand;
+} reorder_t;
+
+
+static const unsigned char *
+skipspaces(const unsigned char *sp, const unsigned char *le)
+{
+    while (sp < le && *sp == ' ')
+	++sp;
+
+    return sp;
+}
+
+
+static void
+putword(long n, unsigned char **p)
+{
+    *(*p)++ = n & 255;
+    *(*p)++ = n >> 8;
+}
+
+
+static int
+numlen(long n)
+{
+    int len = 1;
+
+    while (n >= 10) {
+	n /= 10;
+	len++;
+    }
+
+    return len;
+}
+
+
+/*
+ * add a jump of line i to line n, whose digits are [dp, ep) in prg
+ */
+static int
+addref(outbuf_t *refs, int i, long n, const unsigned char *prg,
+       const unsigned char *dp, const unsigned char *ep, int gosub)
+{
+    rref_t *r;
+
+    if (outbuf_reserve(refs, sizeof(rref_t)) < 0)
+	return -1;
+    r = (rref_t *)&refs->buf[refs->len];
+    r->from = i;
+    r->to = (int)n;		// the number until the lines are known
+    r->off = dp - prg;
+    r->len = ep - dp;
+    r->gosub = gosub;
+    refs->len += sizeof(rref_t);
+
+    return 0;
+}
+
+
+/*
+ * find the line numbers after GOTO, GO TO, GOSUB (also in ON ... GOTO
+ * lists), THEN and RUN in line i, and how it ends
+ * returns its RL_* flags, or -1 if refs is full
+ */
+static int
+scan(const unsigned char *prg, int i, const rline_t *lp, outbuf_t *refs)
+{
+    const unsigned char *sp = prg + lp->off, *le = sp + lp->len, *dp, *ep;
+    int quoted = 0, data = 0, cond = 0, first = 0, last = 0, flags = 0;
+    long n;
+    int c;
+
+    while (sp < le) {
+	c = *sp++;
+	if (c == '"')
+		quoted = !quoted;
+	if (c == ' ' && !quoted)
+		continue;
+	if (c == ':' && !quoted) {
+		if (first)
+			last = first;
+		first = data = 0;
+		continue;
+	}
+	if (c == TOKEN_REM && !quoted && !data)
+		break;
+	if (first == 0)
+		first = c;
+	if (c == '"' || quoted || data)
+		continue;
+
+	if (c == TOK_DATA) {
+		data = 1;
+		flags |= RL_DATA;
+	} else if (c == TOK_IF)
+		cond = 1;
+	else if (c == TOK_LIST)
+		flags |= RL_LIST;
+	if (c == TOK_GO) {
+		dp = skipspaces(sp, le);
+		if (dp == le || *dp != TOK_TO)
+			continue;
+		sp = dp + 1;
+		c = TOK_GOTO;
+		if (first == TOK_GO)
+			first = TOK_GOTO;
+	}
+	if (c != TOK_GOTO && c != TOK_GOSUB && c != TOK_THEN && c != TOK_RUN)
+		continue;
+
+	for (;;) {
+		sp = dp = ep = skipspaces(sp, le);
+		for (n = 0; sp < le && (ISDIGIT(*sp) || *sp == ' '); ++sp) {
+			if (*sp == ' ')
+				continue;
+			if (n < 64000)
+				n = n * 10 + *sp - '0';
+			ep = sp + 1;
+		}
+		if (ep == dp) {
+			/* a GOTO without a number goes to line 0 */
+			if ((c == TOK_GOTO || c == TOK_GOSUB) &&
+			    addref(refs, i, 0, prg, dp, dp, c == TOK_GOSUB) < 0)
+				return -1;
+			break;
+		}
+		/* past 63999 it is a syntax error, and stays one */
+		if (n < 64000 &&
+		    addref(refs, i, n, prg, dp, ep, c == TOK_GOSUB) < 0)
+			return -1;
+		if ((c != TOK_GOTO && c != TOK_GOSUB) || sp == le || *sp != ',')
+			break;
+		++sp;
+	}
+    }
+    if (first)
+	last = first;
+    if (!cond && (last == TOK_GOTO || last == TOK_RETURN || last == TOK_RUN ||
+		  last == TOK_END))
+	flags |= RL_END;
+
+    return flags;
+}
+
+
+/* put the lines of a piece at pos and on */
+static long
+place(reorder_t *r, const rseg_t *sp, long pos)
+{
+    int i;
+
+    for (i = 0; i < sp->n; ++i)
+	r->lines[sp->first + i].pos = pos++;
+
+    return pos;
+}
+
+
+/*
+ * put the pieces in order: the first (or a line that jumps to it), then
+ * the first k candidates, then the rest as they were
+ */
+static void
+arrange(reorder_t *r, int k, int jump)
+{
+    long pos = jump;
+    int s, j;
+
+    for (s = 0; s < r->nsegs; ++s)
+	r->segs[s].moved = 0;
+    for (j = 0; j < k; ++j)
+	r->cand[j]->moved = 1;
+
+    if (!jump)
+	pos = place(r, &r->segs[0], pos);
+    for (j = 0; j < k; ++j)
+	pos = place(r, r->cand[j], pos);
+    for (s = jump ? 0 : 1; s < r->nsegs; ++s) {
+	if (!r->segs[s].moved)
+		pos = place(r, &r->segs[s], pos);
+    }
+}
+
+
+/*
+ * the lines BASIC goes past to find the lines jumped to, by how often
+ * the jumps run
+ */
+static double
+cost(const reorder_t *r, int jump)
+{
+    const rref_t *rp;
+    double sum = 0;
+    long from, to;
+
+    for (rp = r->refs; rp < r->refs + r->nrefs; ++rp) {
+	if (rp->to < 0)
+		continue;
+	from = r->lines[rp->from].pos;
+	to = r->lines[rp->to].pos;
+	sum += rp->weight * (to > from ? to - from + 1 : to + 1);
+    }
+    if (jump && r->nlines > 0)
+	sum += r->lines[0].pos + 1;
+
+    return sum;
+}
+
+
+static int
+callcmp(const void *a, const void *b)
+{
+    const rseg_t *x = *(rseg_t * const *)a, *y = *(rseg_t * const *)b;
+    double dx = x->calls / x->n, dy = y->calls / y->n;
+
+    return dx < dy ? 1 : dx > dy ? -1 : x->first - y->first;
+}
+
+
+static int
+profcmp(const void *a, const void *b)
+{
+    long x = *(const long *)a, y = ((const lineprof_t *)b)->line;
+
+    return x < y ? -1 : x > y;
+}
+
+
+/* the number a line gets; the line that jumps to the first is 0 */
+#define NEWNUM(lp, jump)	((lp)->pos + 1 - (jump))
+
+
+
+/*
+ * renumber a tokenized BASIC V2 program with the subroutines it calls most
+ * moved to the top, appended to out. How often they are called comes from
+ * opts->profile, a run of the program by bas_run(), or else from counting
+ * the GOSUBs to them; the jumps to every line are changed to its new
+ * number. If that would not make them quicker, the program is left as it
+ * was.
+ * returns 0 on success, -1 on error (reason in diag->error)
+ *
+ * Note: a program that LISTs itself is not reordered.
+ */
+int
+prg_reorder(const unsigned char *prg, long len, outbuf_t *out,
+	    const prgopts_t *opts, diag_t *diag)
+{
+    const unsigned char *sp, *le, *ep = prg + len;
+    const lineprof_t *hit;
+    reorder_t r;
+    outbuf_t lines, refs;
+    rline_t *lp;
+    rref_t *rp;
+    rseg_t *seg;
+    unsigned char *tp;
+    int *order = NULL;
+    double before, best, c;
+    long load, addr, n, moved = 0;
+    int i, k, lo, hi, flags, jump, bestk = 0, bestjump = 0, ret = 0;
+
+    if (opts->dialect != DIALECT_V2)
+	return diag_error(diag, "reordering is only for BASIC V2");
+    if (len < 2)
+	return diag_error(diag, "no load address");
+    load = prg[0] | (prg[1] << 8);
+
+    memset(&r, 0, sizeof(r));
+    memset(&lines, 0, sizeof(lines));
+    memset(&refs, 0, sizeof(refs));
+
+    /* the lines and their jumps, and the pieces they make */
+    flags = RL_END;
+    for (sp = prg + 2; ep - sp >= 4 && (sp[0] | sp[1]) != 0; sp = le + 1) {
+	if ((le = memchr(sp + 4, 0, ep - sp - 4)) == NULL)
+		le = ep;
+	if (outbuf_reserve(&lines, sizeof(rline_t)) < 0)
+		goto oom;
+	lp = (rline_t *)&lines.buf[lines.len];
+	lp->number = sp[2] | (sp[3] << 8);
+	lp->off = sp + 4 - prg;
+	lp->len = le - sp - 4;
+	if (flags & RL_END)
+		r.nsegs++;
+	lp->seg = r.nsegs - 1;
+	lp->ref = refs.len / sizeof(rref_t);
+	lp->weight = 1;
+	if (opts->profile != NULL) {
+		hit = bsearch(&lp->number, opts->profile->lines,
+			      opts->profile->nlines, sizeof(lineprof_t),
+			      profcmp);
+		lp->weight = hit != NULL ? hit->hits : 0;
+	}
+	if ((flags = lp->flags = scan(prg, r.nlines++, lp, &refs)) < 0)
+		goto oom;
+	lp->nrefs = refs.len / sizeof(rref_t) - lp->ref;
+	lines.len += sizeof(rline_t);
+	if (flags & RL_LIST) {
+		diag_warn(diag, "Warning: line %ld has LIST, the program is not reordered\n",
+			  lp->number);
+		goto keep;
+	}
+	if (le == ep)
+		break;
+    }
+    r.lines = (rline_t *)lines.buf;
+    r.refs = (rref_t *)refs.buf;
+    r.nrefs = refs.len / sizeof(rref_t);
+    if (r.nlines == 0 || r.nlines >= REORDER_UNDEF)
+	goto keep;
+
+    r.segs = calloc(r.nsegs, sizeof(rseg_t));
+    r.cand = malloc(r.nsegs * sizeof(rseg_t *));
+    order = malloc(r.nlines * sizeof(int));
+    if (r.segs == NULL || r.cand == NULL || order == NULL)
+	goto oom;
+    for (i = 0; i < r.nlines; ++i) {
+	if (r.segs[r.lines[i].seg].n++ == 0)
+		r.segs[r.lines[i].seg].first = i;
+	if (r.lines[i].flags & RL_DATA)
+		r.segs[r.lines[i].seg].fixed = 1;
+    }
+    if (!(r.lines[r.nlines - 1].flags & RL_END))
+	r.segs[r.nsegs - 1].fixed = 1;	// it ends the program
+
+    /* The numbers jumped to are lines now, -1 for those not there. */
+    for (rp = r.refs; rp < r.refs + r.nrefs; ++rp) {
+	for (lo = 0, hi = r.nlines; lo < hi; ) {
+		i = (lo + hi) / 2;
+		if (r.lines[i].number < rp->to)
+			lo = i + 1;
+		else
+			hi = i;
+	}
+	rp->to = lo < r.nlines && r.lines[lo].number == rp->to ? lo : -1;
+	if (rp->to < 0)
+		continue;
+
+	/* no more often than the line it goes from or the one it goes to */
+	rp->weight = r.lines[rp->from].weight;
+	if (r.lines[rp->to].weight < rp->weight)
+		rp->weight = r.lines[rp->to].weight;
+	if (rp->gosub)
+		r.segs[r.lines[rp->to].seg].calls += rp->weight;
+    }
+
+    /* Of the pieces that can move, those called most for their length go
+     * first; as many go to the top as make the jumps quickest, after the
+     * first piece or after a line that jumps to it. */
+    for (i = 1; i < r.nsegs; ++i) {
+	if (!r.segs[i].fixed && r.segs[i].calls > 0)
+		r.cand[r.ncand++] = &r.segs[i];
+    }
+    qsort(r.cand, r.ncand, sizeof(rseg_t *), callcmp);
+    arrange(&r, 0, 0);
+    best = before = cost(&r, 0);
+    for (jump = 0; jump <= 1; ++jump) {
+	for (k = 1; k <= r.ncand; ++k) {
+		arrange(&r, k, jump);
+		if ((c = cost(&r, jump)) < best) {
+			best = c;
+			bestk = k;
+			bestjump = jump;
+		}
+	}
+    }
+    if (bestk == 0) {
+	diag_info(diag, "Reordering would not make the jumps quicker\n");
+	goto keep;
+    }
+    arrange(&r, bestk, bestjump);
+
+    /* No line may get too long with the new numbers. */
+    for (i = 0; i < r.nlines; ++i) {
+	lp = &r.lines[i];
+	for (n = lp->len, k = 0; k < lp->nrefs; ++k) {
+		rp = &r.refs[lp->ref + k];
+		n += numlen(rp->to >= 0 ? NEWNUM(&r.lines[rp->to], bestjump) :
+			    REORDER_UNDEF) - rp->len;
+	}
+	if (n > REORDER_BYTES && n > lp->len) {
+		diag_warn(diag, "Warning: line %ld would get too long, the program is not reordered\n",
+			  lp->number);
+		goto keep;
+	}
+    }
+
+    /* Write it in the new order, relinked. */
+    if (outbuf_reserve(out, 2 + 4 + 1 + 5 + 1) < 0)
+	goto full;
+    addr = out->len;
+    tp = (unsigned char *)&out->buf[out->len];
+    putword(load, &tp);
+    out->len += 2;
+    if (bestjump) {
+	tp = (unsigned char *)&out->buf[out->len + 2];
+	putword(0, &tp);
+	*tp++ = TOK_GOTO;
+	tp += sprintf((char *)tp, "%ld", NEWNUM(&r.lines[0], bestjump)) + 1;
+	n = tp - (unsigned char *)&out->buf[out->len];
+	tp = (unsigned char *)&out->buf[out->len];
+	putword(load + out->len + n - addr - 2, &tp);
+	out->len += n;
+    }
+    for (i = 0; i < r.nlines; ++i)
+	order[r.lines[i].pos - bestjump] = i;
+    for (k = 0; k < r.nlines; ++k) {
+	lp = &r.lines[order[k]];
+	if (outbuf_reserve(out, 4 + lp->len + 5 * lp->nrefs + 1 + 2) < 0)
+		goto full;
+	tp = (unsigned char *)&out->buf[out->len + 2];
+	putword(NEWNUM(lp, bestjump), &tp);
+	for (sp = prg + lp->off, i = 0; i < lp->nrefs; ++i) {
+		rp = &r.refs[lp->ref + i];
+		memcpy(tp, sp, prg + rp->off - sp);
+		tp += prg + rp->off - sp;
+		tp += sprintf((char *)tp, "%ld", rp->to >= 0 ?
+			      NEWNUM(&r.lines[rp->to], bestjump) :
+			      (long)REORDER_UNDEF);
+		sp = prg + rp->off + rp->len;
+	}
+	memcpy(tp, sp, prg + lp->off + lp->len - sp);
+	tp += prg + lp->off + lp->len - sp;
+	*tp++ = 0;
+	n = tp - (unsigned char *)&out->buf[out->len];
+	tp = (unsigned char *)&out->buf[out->len];
+	putword(load + out->len + n - addr - 2, &tp);
+	out->len += n;
+
+	seg = &r.segs[lp->seg];
+	if (seg->moved && order[k] == seg->first) {
+		diag_info(diag, "Lines %ld-%ld moved to the top, as %ld-%ld\n",
+			  lp->number, r.lines[seg->first + seg->n - 1].number,
+			  NEWNUM(lp, bestjump), NEWNUM(lp, bestjump) + seg->n - 1);
+		moved += seg->n;
+	}
+    }
+    if (outbuf_reserve(out, 2) < 0)
+	goto full;
+    tp = (unsigned char *)&out->buf[out->len];
+    putword(0, &tp);
+    out->len += 2;
+
+    if (opts->profile != NULL)
+	diag_info(diag, "Reordered %i subroutines of %ld lines, saving about %.0f cycles of the profiled run\n",
+		  bestk, moved, (before - best) * C_LINESCAN);
+    else
+	diag_info(diag, "Reordered %i subroutines of %ld lines, with %.0f fewer lines to go past over all the jumps\n",
+		  bestk, moved, before - best);
+    goto out;
+
+keep:
+    if (outbuf_reserve(out, len) < 0)
+	goto full;
+    memcpy(&out->buf[out->len], prg, len);
+    out->len += len;
+    goto out;
+
+full:
+    ret = outbuf_full(out, diag);
+    goto out;
+oom:
+    ret = diag_error(diag, "out of memory");
+out:
+    free(r.segs);
+    free(r.cand);
+    free(order);
+    outbuf_free(&lines);
+    outbuf_free(&refs);
+
+    return ret;
+}
@@ -0,0 +1,367 @@
+/*
+ * server.c, serve conversion requests from a long-running process.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#ifdef _WIN32
+# include <io.h>
+# include <fcntl.h>
+# define read(fd, p, n)		_read(fd, p, n)
+# define write(fd, p, n)	_write(fd, p, n)
+#else
+# include <unistd.h>
+# include <signal.h>
+# include <sys/socket.h>
+# include <sys/stat.h>
+# include <sys/un.h>
+#endif
+#include "prgtools.h"
+#include "batch.h"
+#include "server.h"
+
+
+#define WORD(p)		((p)[0] | ((p)[1] << 8))
+#define DWORD(p)	(WORD(p) | ((unsigned long)WORD((p) + 2) << 16))
+
+
+/* Buffers of one worker, kept warm from one request to the next. */
+typedef struct {
+    outbuf_t	in;
+    outbuf_t	out;		// the answer: header, output and messages
+    outbuf_t	log;
+} srvbuf_t;
+
+typedef struct {
+    int		fd;		// listening socket
+    srvbuf_t	*bufs;
+} server_t;
+
+
+/*
+ * read exactly n bytes
+ * returns n, less if the stream ended first, or -1 on error
+ */
+static long
+readn(int fd, void *buf, long n)
+{
+    long len = 0, r;
+
+    while (len < n) {
+	r = read(fd, (char *)buf + len, n - len);
+	if (r < 0 && errno == EINTR)
+		continue;
+	if (r < 0)
+		return -1;
+	if (r == 0)
+		break;
+	len += r;
+    }
+
+    return len;
+}
+
+
+static int
+writen(int fd, const void *buf, long n)
+{
+    long len = 0, r;
+
+    while (len < n) {
+	r = write(fd, (const char *)buf + len, n - len);
+	if (r < 0 && errno == EINTR)
+		continue;
+	if (r <= 0)
+		return -1;
+	len += r;
+    }
+
+    return 0;
+}
+
+
+static void
+putdword(unsigned char *p, unsigned long n)
+{
+    p[0] = n & 255;
+    p[1] = (n >> 8) & 255;
+    p[2] = (n >> 16) & 255;
+    p[3] = (n >> 24) & 255;
+}
+
+
+/*
+ * convert one request in b->in, leaving the whole answer in b->out
+ */
+static void
+serve_one(const unsigned char *req, srvbuf_t *b)
+{
+    unsigned char *ap;
+    prgopts_t opts;
+    diag_t diag;
+    long outlen;
+    size_t n;
+    int ret;
+
+    prgopts_init(&opts);
+    opts.invertcase = !!(req[1] & SRV_INVERTCASE);
+    opts.abbrevs = !!(req[1] & SRV_ABBREVS);
+    opts.autonumber = !!(req[1] & SRV_AUTONUMBER);
+    opts.trimspaces = !!(req[1] & SRV_TRIMSPACES);
+    opts.collapsespaces = !!(req[1] & SRV_COLLAPSE);
+    if (req[1] & SRV_UTF8)
+	opts.charset = CHARSET_UTF8;
+    else if (req[1] & SRV_ESCAPES)
+	opts.charset = CHARSET_ESCAPES;
+    opts.dialect = req[0] >> 4;
+    if (opts.dialect < NDIALECTS) {		// else refused below
+	opts.startaddr = dialect_load(opts.dialect);
+	opts.ramtop = dialect_top(opts.dialect);
+    }
+    if (WORD(&req[2]) != 0)
+	opts.startaddr = WORD(&req[2]);
+
+    b->log.len = 0;
+    diag_init(&diag, NULL, NULL);
+    diag.log = &b->log;
+    diag.verbose = !!(req[1] & SRV_VERBOSE);
+
+    /* The output goes straight after the room for the answer header. */
+    b->out.len = 0;
+    if (outbuf_reserve(&b->out, SRV_ANSLEN) < 0)
+	ret = outbuf_full(&b->out, &diag);
+    else if (opts.dialect >= NDIALECTS)
+	ret = diag_error(&diag, "unknown dialect %d", opts.dialect);
+    else {
+	b->out.len = SRV_ANSLEN;
+	switch (req[0] & 15) {
+		case PRG_BAS2PRG:
+			ret = bas2prg_buf(b->in.buf, b->in.len, &b->out,
+					  &opts, &diag);
+			break;
+
+		case PRG_PRG2BAS:
+			ret = prg2bas_buf((unsigned char *)b->in.buf,
+					  b->in.len, &b->out, &opts, &diag);
+			break;
+
+		default:
+			ret = diag_error(&diag, "unknown direction %d",
+					 req[0] & 15);
+			break;
+	}
+    }
+
+    /* The reason for failing is the last message. */
+    if (ret != 0) {
+	b->out.len = SRV_ANSLEN;
+	n = strlen(diag.error);
+	if (outbuf_reserve(&b->log, n + 1) == 0) {
+		memcpy(&b->log.buf[b->log.len], diag.error, n);
+		b->log.len += n;
+		b->log.buf[b->log.len++] = '\n';
+	}
+    }
+    outlen = b->out.len - SRV_ANSLEN;
+
+    /* Messages follow the output. Without room for them, there can
+     * be no answer at all. */
+    if (outbuf_reserve(&b->out, b->log.len) < 0) {
+	outbuf_free(&b->out);
+	return;
+    }
+    memcpy(&b->out.buf[b->out.len], b->log.buf, b->log.len);
+    b->out.len += b->log.len;
+
+    ap = (unsigned char *)b->out.buf;
+    ap[0] = ret != 0;
+    ap[1] = 0;
+    ap[2] = diag.warnings & 255;
+    ap[3] = (diag.warnings >> 8) & 255;
+    putdword(&ap[4], outlen);
+    putdword(&ap[8], b->log.len);
+}
+
+
+/*
+ * answer requests until the client goes away
+ * returns 0 when the stream ends between requests, -1 otherwise
+ */
+static int
+serve(int fi, int fo, srvbuf_t *b)
+{
+    unsigned char req[SRV_REQLEN];
+    unsigned long len;
+    long n;
+
+    for (;;) {
+	if ((n = readn(fi, req, SRV_REQLEN)) == 0)
+		return 0;
+	if (n != SRV_REQLEN)
+		return -1;
+
+	/* There is no way to skip a request we cannot hold. */
+	len = DWORD(&req[4]);
+	b->in.len = 0;
+	if (len > SRV_MAXINPUT || outbuf_reserve(&b->in, len) < 0)
+		return -1;
+	if (readn(fi, b->in.buf, len) != (long)len)
+		return -1;
+	b->in.len = len;
+
+	serve_one(req, b);
+	if (b->out.len == 0 || writen(fo, b->out.buf, b->out.len) < 0)
+		return -1;
+    }
+}
+
+
+static void
+srvbuf_free(srvbuf_t *b)
+{
+    outbuf_free(&b->in);
+    outbuf_free(&b->out);
+    outbuf_free(&b->log);
+}
+
+
+#ifndef _WIN32
+/*
+ * Each worker takes connections for as long as the server runs, and
+ * serves one at a time. accept() hands every connection to just one of
+ * them.
+ */
+static void
+server_worker(void *arg, int job, int worker)
+{
+    server_t *s = (server_t *)arg;
+    int fd;
+
+    for (;;) {
+	fd = accept(s->fd, NULL, NULL);
+	if (fd < 0) {
+		if (errno == EINTR || errno == ECONNABORTED)
+			continue;
+		perror("accept");
+		break;
+	}
+	serve(fd, fd, &s->bufs[job]);
+	close(fd);
+    }
+}
+
+
+static int
+server_listen(const char *path)
+{
+    struct sockaddr_un sa;
+    struct stat st;
+    int fd;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(sa.sun_path)) {
+	fprintf(stderr, "Socket path '%s' is too long\n", path);
+	return -1;
+    }
+    strcpy(sa.sun_path, path);
+
+    /* A socket left behind by an earlier server is in the way; anything
+       else at path is not ours to remove. */
+    if (lstat(path, &st) == 0) {
+	if (!S_ISSOCK(st.st_mode)) {
+		fprintf(stderr, "'%s' exists and is not a socket\n", path);
+		return -1;
+	}
+	(void)unlink(path);
+    }
+
+    if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+	perror("socket");
+	return -1;
+    }
+    if (bind(fd, (struct sockaddr *)&sa, sizeof(sa)) < 0 ||
+	listen(fd, 64) < 0) {
+	fprintf(stderr, "Unable to listen on '%s': %s\n", path,
+		strerror(errno));
+	close(fd);
+	return -1;
+    }
+
+    return fd;
+}
+#endif
+
+
+/*
+ * serve requests on a UNIX socket, with nthreads workers (0 for one per
+ * CPU), or on stdin/stdout if path is "-"
+ * returns 0 once stdin ends cleanly, otherwise an exit code
+ */
+int
+server_run(const char *path, int nthreads)
+{
+#ifndef _WIN32
+    server_t s;
+    int i;
+#endif
+    srvbuf_t b;
+    int ret;
+
+#ifndef _WIN32
+    /* A client going away must not take the server with it. */
+    signal(SIGPIPE, SIG_IGN);
+#endif
+
+    if (!strcmp(path, "-")) {
+#ifdef _WIN32
+	_setmode(0, _O_BINARY);
+	_setmode(1, _O_BINARY);
+#endif
+	memset(&b, 0, sizeof(b));
+	ret = serve(0, 1, &b);
+	srvbuf_free(&b);
+	return ret ? 4 : 0;
+    }
+
+#ifdef _WIN32
+    fprintf(stderr, "UNIX sockets are not supported here, use -S -\n");
+    return 1;
+#else
+    if (nthreads <= 0)
+	nthreads = pool_ncpus();
+    if ((s.fd = server_listen(path)) < 0)
+	return 2;
+    if ((s.bufs = calloc(nthreads, sizeof(srvbuf_t))) == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	close(s.fd);
+	return 2;
+    }
+
+    pool_run(nthreads, nthreads, server_worker, &s);
+
+    for (i = 0; i < nthreads; ++i)
+	srvbuf_free(&s.bufs[i]);
+    free(s.bufs);
+    close(s.fd);
+    (void)unlink(path);
+
+    return 4;
+#endif
+}
@@ -0,0 +1,59 @@
+/*
+ * server.h, serve conversion requests from a long-running process.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef _SERVER_H_
+# define _SERVER_H_
+
+
+/*
+ * Requests and answers are framed with a small header, all numbers little
+ * endian, like everything else on the C64.
+ *
+ * Request, 8 bytes followed by the input file:
+ *	0	direction, PRG_BAS2PRG or PRG_PRG2BAS, plus DIALECT_* << 4
+ *	1	SRV_* option flags
+ *	2-3	load address for bas2prg, 0 for the dialect's default
+ *	4-7	length of the input
+ *
+ * Answer, 12 bytes followed by the output file and then the messages:
+ *	0	0 if converted, 1 if not
+ *	1	0
+ *	2-3	number of warnings
+ *	4-7	length of the output
+ *	8-11	length of the messages (warnings, and the reason for failing)
+ */
+#define SRV_REQLEN	8
+#define SRV_ANSLEN	12
+
+#define SRV_INVERTCASE	0x01
+#define SRV_ABBREVS	0x02
+#define SRV_AUTONUMBER	0x04
+#define SRV_TRIMSPACES	0x08
+#define SRV_COLLAPSE	0x10
+#define SRV_VERBOSE	0x20	// informational messages too
+#define SRV_ESCAPES	0x40	// CHARSET_ESCAPES
+#define SRV_UTF8	0x80	// CHARSET_UTF8
+
+#define SRV_MAXINPUT	(16L << 20)	// longer requests drop the connection
+
+
+/* Serve on a UNIX socket, or on stdin/stdout if path is "-". */
+extern int	server_run(const char *path, int nthreads);
+
+
+#endif	/*_SERVER_H_*/
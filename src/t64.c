@@ -0,0 +1,114 @@
+/*
+ * t64.c, read the directory of T64 tape archives.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "prgtools.h"
+
+
+#define T64_HDRLEN	64		// archive header
+#define T64_ENTLEN	32		// one directory record
+
+
+#define WORD(p)		((p)[0] | ((p)[1] << 8))
+#define DWORD(p)	(WORD(p) | ((long)WORD((p) + 2) << 16))
+
+
+/*
+ * see if this is a T64 archive; the signature varies ("C64S tape file",
+ * "C64 tape image file"), but always starts with C64
+ */
+int
+t64_check(const unsigned char *data, long size)
+{
+    return size >= T64_HDRLEN && !memcmp(data, "C64", 3);
+}
+
+
+static int
+offcmp(const void *a, const void *b)
+{
+    long x = (*(const imgent_t * const *)a)->offset;
+    long y = (*(const imgent_t * const *)b)->offset;
+
+    return x < y ? -1 : x > y;
+}
+
+
+/*
+ * read the directory
+ * returns the number of entries (in *ents, to be freed), or -1 on error
+ *
+ * The end addresses in many archives are wrong, so the length of an entry
+ * is also limited by where the next one starts.
+ */
+int
+t64_dir(const unsigned char *data, long size, imgent_t **ents)
+{
+    const unsigned char *ep;
+    imgent_t *list, *p, **byoff;
+    long next;
+    int max, n = 0, i, k;
+
+    if (!t64_check(data, size))
+	return -1;
+
+    /* Look at every slot, the count of used entries is often wrong. */
+    max = WORD(&data[0x22]);
+    if (max > (size - T64_HDRLEN) / T64_ENTLEN)
+	max = (size - T64_HDRLEN) / T64_ENTLEN;
+
+    list = calloc(max + 1, sizeof(imgent_t));
+    byoff = calloc(max + 1, sizeof(imgent_t *));
+    if (list == NULL || byoff == NULL) {
+	free(list);
+	free(byoff);
+	return -1;
+    }
+
+    for (i = 0; i < max; ++i) {
+	ep = &data[T64_HDRLEN + i * T64_ENTLEN];
+	if (ep[0] != 1)			// not a normal tape file
+		continue;
+
+	p = &list[n];
+	p->type = 0x82;			// tape files are all programs
+	p->load = WORD(&ep[2]);
+	p->len = WORD(&ep[4]) - p->load;
+	p->offset = DWORD(&ep[8]);
+	if (p->offset < T64_HDRLEN || p->offset >= size)
+		continue;
+	memcpy(p->name, &ep[16], 16);
+	p->name[16] = '\0';
+	for (k = 15; k >= 0 && (p->name[k] == ' ' || p->name[k] == '\xa0'); --k)
+		p->name[k] = '\0';
+	byoff[n++] = p;
+    }
+
+    qsort(byoff, n, sizeof(imgent_t *), offcmp);
+    for (i = 0; i < n; ++i) {
+	next = (i + 1 < n) ? byoff[i + 1]->offset : size;
+	if (byoff[i]->len <= 0 || byoff[i]->len > next - byoff[i]->offset)
+		byoff[i]->len = next - byoff[i]->offset;
+    }
+    free(byoff);
+
+    *ents = list;
+    return n;
+}
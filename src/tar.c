@@ -0,0 +1,325 @@
+/*
+ * tar.c, read and write the members of tar archives in memory.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "prgtools.h"
+
+
+/*
+ * A member is a header block of 512 bytes followed by its data, padded to
+ * whole blocks, and the archive ends with two blocks of zeros. Names too
+ * long for the header come before it, in the data of a GNU 'L' member or
+ * as the path of a pax 'x' member; we read both and write pax.
+ */
+#define TAR_BLOCK	512
+#define TAR_RECORD	10240		// tar pads archives to this
+
+#define H_NAME		0
+#define H_MODE		100
+#define H_UID		108
+#define H_GID		116
+#define H_SIZE		124
+#define H_MTIME		136
+#define H_CHKSUM	148
+#define H_TYPE		156
+#define H_MAGIC		257
+#define H_VERSION	263
+#define H_PREFIX	345
+
+
+/*
+ * an octal field, or a binary one with the top bit set as GNU tar writes
+ * large numbers
+ */
+static long long
+number(const unsigned char *p, int n)
+{
+    long long v = 0;
+    int i = 0;
+
+    if (*p & 0x80) {
+	v = *p & 0x3f;
+	for (i = 1; i < n; ++i)
+		v = (v << 8) | p[i];
+	return v;
+    }
+    while (i < n && p[i] == ' ')
+	++i;
+    for (; i < n && p[i] >= '0' && p[i] <= '7'; ++i)
+	v = v * 8 + p[i] - '0';
+
+    return v;
+}
+
+
+/* an octal field of n - 1 digits and a nul */
+static void
+putnumber(unsigned char *p, int n, long long v)
+{
+    p[--n] = '\0';
+    while (n-- > 0) {
+	p[n] = '0' + (v & 7);
+	v >>= 3;
+    }
+}
+
+
+static long
+checksum(const unsigned char *h)
+{
+    long sum = 8 * ' ';
+    int i;
+
+    for (i = 0; i < TAR_BLOCK; ++i) {
+	if (i < H_CHKSUM || i >= H_CHKSUM + 8)
+		sum += h[i];
+    }
+
+    return sum;
+}
+
+
+/*
+ * take the path and mtime out of the records of a pax header,
+ * "length key=value\n"
+ * returns 0, or -1 if a record is malformed
+ */
+static int
+pax(const unsigned char *p, long size, tarent_t *ent, int *named, int *dated)
+{
+    const unsigned char *ep = p + size, *kp, *vp, *rp;
+    long len;
+
+    while (p < ep) {
+	for (len = 0, kp = p; kp < ep && *kp >= '0' && *kp <= '9' &&
+	    len <= ep - p; ++kp)
+		len = len * 10 + *kp - '0';
+	if (len <= 0 || len > ep - p || kp == ep || *kp != ' ')
+		return -1;
+	rp = p + len - 1;		// the newline
+	if (++kp >= rp || *rp != '\n')
+		return -1;
+	vp = memchr(kp, '=', rp - kp);
+	if (vp != NULL && vp - kp == 4 && !memcmp(kp, "path", 4) &&
+	    rp - vp - 1 < TAR_MAXNAME) {
+		memcpy(ent->name, vp + 1, rp - vp - 1);
+		ent->name[rp - vp - 1] = '\0';
+		*named = 1;
+	} else if (vp != NULL && vp - kp == 5 && !memcmp(kp, "mtime", 5)) {
+		ent->mtime = strtol((const char *)vp + 1, NULL, 10);
+		*dated = 1;
+	}
+	p += len;
+    }
+
+    return 0;
+}
+
+
+/*
+ * read the member of an archive at p, with any long name before it; its
+ * data stays where it is
+ * returns the bytes up to the next member, 0 if they are not all in the
+ * len bytes at p yet, or -1 if this is not a tar header. At the end of
+ * the archive, ent->type is 0.
+ */
+long
+tar_member(const unsigned char *p, long len, tarent_t *ent)
+{
+    const unsigned char *h;
+    long off = 0, size, blocks;
+    int named = 0, dated = 0, i;
+
+    memset(ent, 0, sizeof(*ent));
+    for (;;) {
+	if (len - off < TAR_BLOCK)
+		return 0;
+	h = p + off;
+	for (i = 0; i < TAR_BLOCK && h[i] == 0; ++i)
+		;
+	if (i == TAR_BLOCK)
+		return off + TAR_BLOCK;		// ent->type is 0
+	if (number(h + H_CHKSUM, 8) != checksum(h))
+		return -1;
+
+	size = (long)number(h + H_SIZE, 12);
+	if (size < 0)
+		return -1;
+	blocks = TAR_BLOCK + (size + TAR_BLOCK - 1) / TAR_BLOCK * TAR_BLOCK;
+	if (len - off < blocks)
+		return 0;
+
+	switch (h[H_TYPE]) {
+	case 'L':		// GNU long name of the next member
+		if (size >= TAR_MAXNAME)
+			return -1;
+		memcpy(ent->name, h + TAR_BLOCK, size);
+		ent->name[size] = '\0';
+		named = 1;
+		off += blocks;
+		continue;
+
+	case 'x':		// pax header of the next member
+		if (pax(h + TAR_BLOCK, size, ent, &named, &dated) < 0)
+			return -1;
+		off += blocks;
+		continue;
+
+	case 'g':		// pax header for all, GNU long link name
+	case 'K':
+		off += blocks;
+		continue;
+	}
+
+	if (!named) {
+		i = 0;
+		if (!memcmp(h + H_MAGIC, "ustar", 5) && h[H_PREFIX] != '\0') {
+			for (; i < 155 && h[H_PREFIX + i] != '\0'; ++i)
+				ent->name[i] = h[H_PREFIX + i];
+			ent->name[i++] = '/';
+		}
+		memcpy(ent->name + i, h + H_NAME, 100);
+		ent->name[i + 100] = '\0';
+	}
+	if (!dated)
+		ent->mtime = number(h + H_MTIME, 12);
+	ent->mode = (long)number(h + H_MODE, 8);
+	ent->type = h[H_TYPE] ? h[H_TYPE] : '0';
+	ent->data = h + TAR_BLOCK;
+	ent->size = size;
+
+	return off + blocks;
+    }
+}
+
+
+/*
+ * append a header block to out
+ * returns 0, or -1 if out is full
+ */
+static int
+header(outbuf_t *out, const char *prefix, size_t plen, const char *name,
+       size_t len, long size, long long mtime, long mode, int type)
+{
+    unsigned char *h;
+
+    if (outbuf_reserve(out, TAR_BLOCK) < 0)
+	return -1;
+    h = (unsigned char *)&out->buf[out->len];
+    memset(h, 0, TAR_BLOCK);
+    memcpy(h + H_PREFIX, prefix, plen);
+    memcpy(h + H_NAME, name, len < 100 ? len : 100);
+    putnumber(h + H_MODE, 8, mode & 07777);
+    putnumber(h + H_UID, 8, 0);
+    putnumber(h + H_GID, 8, 0);
+    putnumber(h + H_SIZE, 12, size);
+    putnumber(h + H_MTIME, 12, mtime);
+    h[H_TYPE] = type;
+    memcpy(h + H_MAGIC, "ustar", 6);
+    memcpy(h + H_VERSION, "00", 2);
+    putnumber(h + H_CHKSUM, 7, checksum(h));
+    h[H_CHKSUM + 7] = ' ';
+    out->len += TAR_BLOCK;
+
+    return 0;
+}
+
+
+/*
+ * append the header of a file to an archive in out, preceded by a pax
+ * header if the name does not fit; the data and tar_pad() come next
+ * returns 0, or -1 if out is full
+ */
+int
+tar_header(outbuf_t *out, const char *name, long size, long long mtime,
+	   long mode)
+{
+    size_t len = strlen(name), rec, n;
+    const char *sp;
+    char digits[24];
+
+    if (len <= 100)
+	return header(out, "", 0, name, len, size, mtime, mode, '0');
+
+    /* Split it into a prefix and a name at the first slash that leaves
+     * few enough for the name... */
+    for (sp = name + 1; *sp != '\0'; ++sp) {
+	if (*sp == '/' && len - (sp - name) - 1 <= 100)
+		break;
+    }
+    if (*sp == '/' && sp - name <= 155 && sp[1] != '\0')
+	return header(out, name, sp - name, sp + 1, len - (sp - name) - 1,
+		      size, mtime, mode, '0');
+
+    /* ...or give the whole of it in a pax header; the length of a record
+     * counts its own digits. */
+    for (rec = len + 7, n = 0; n != rec; ) {
+	n = rec;
+	rec = len + 7 + sprintf(digits, "%lu", (unsigned long)n);
+    }
+    if (header(out, "", 0, "././@PaxHeader", 14, rec, mtime, 0644, 'x') < 0 ||
+	outbuf_reserve(out, rec + 1) < 0)
+	return -1;
+    out->len += sprintf(&out->buf[out->len], "%lu path=%s\n",
+			(unsigned long)rec, name);
+    if (tar_pad(out, rec) < 0)
+	return -1;
+
+    return header(out, "", 0, name, len, size, mtime, mode, '0');
+}
+
+
+/*
+ * pad the data of a member of size bytes, just appended to out, to whole
+ * blocks
+ * returns 0, or -1 if out is full
+ */
+int
+tar_pad(outbuf_t *out, long size)
+{
+    long n = (TAR_BLOCK - size % TAR_BLOCK) % TAR_BLOCK;
+
+    if (outbuf_reserve(out, n) < 0)
+	return -1;
+    memset(&out->buf[out->len], 0, n);
+    out->len += n;
+
+    return 0;
+}
+
+
+/*
+ * end an archive of which written bytes came before out: two blocks of
+ * zeros, then zeros up to a whole record
+ * returns 0, or -1 if out is full
+ */
+int
+tar_end(outbuf_t *out, long long written)
+{
+    long n = 2 * TAR_BLOCK;
+
+    n += (TAR_RECORD - (written + out->len + n) % TAR_RECORD) % TAR_RECORD;
+    if (outbuf_reserve(out, n) < 0)
+	return -1;
+    memset(&out->buf[out->len], 0, n);
+    out->len += n;
+
+    return 0;
+}
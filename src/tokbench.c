@@ -0,0 +1,179 @@
+/*
+ * tokbench.c, microbenchmark for the keyword matcher in tokens.c.
+ * Copyright 2011, 2012 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "tokens.h"
+#include "prgtools.h"
+
+
+#define MINBYTES	(8L << 20)	// size of the generated input
+
+
+/* A few lines of typical BASIC, used when no input file is given. */
+static const char *sample[] = {
+    "10 PRINT CHR$(147):POKE 53280,0:POKE 53281,0",
+    "20 FOR I=1 TO 100 STEP 2:A(I)=INT(RND(1)*40):NEXT I",
+    "30 IF X>39 THEN X=0:GOTO 100",
+    "40 INPUT#2,A$:GET#2,B$:PRINT#4,LEFT$(A$,5);MID$(B$,2,3)",
+    "50 REM *** MAIN LOOP, DO NOT TOUCH ***",
+    "60 DATA 169,0,141,32,208,141,33,208,96,255,34,12",
+    "70 ON J GOSUB 1000,2000,3000:RETURN",
+    "80 S=SQR(ABS(SIN(T)*COS(T)))+PEEK(197)AND 15 OR 7",
+    "90 PRINT\"HELLO WORLD, THIS IS A STRING\";TAB(10);SPC(3)",
+    "100 GO TO 10:SYS 49152:WAIT 198,1:CLR:END"
+};
+
+
+/*
+ * the original matcher, kept as the reference for the new one
+ */
+static int
+gettoken_linear(const char **src)
+{
+    const char **tp;
+    int len;
+
+    for (tp = tokens; tp < &tokens[128]; ++tp) {
+	len = strlen(*tp);
+	if (! strncmp(*tp, *src, len)) {
+		*src += len;
+		return tp - tokens + 128;
+	}
+    }
+
+    return -1;
+}
+
+
+/*
+ * walk a buffer of lines like tokenize() does, return number of tokens
+ */
+static long
+scan(const char *buf, int linear, unsigned long *sum)
+{
+    const char *sp = buf;
+    long ntok = 0;
+    int quoted = 0;
+    int t;
+
+    while (*sp) {
+	if (*sp == '\n')
+		quoted = 0;
+	if (*sp == '"')
+		quoted = !quoted;
+	if (!quoted) {
+		t = linear ? gettoken_linear(&sp) : gettoken(&sp, 0, DIALECT_V2);
+		if (t != -1) {
+			*sum = *sum * 31 + t + (sp - buf);
+			ntok++;
+			continue;
+		}
+	}
+	sp++;
+    }
+
+    return ntok;
+}
+
+
+static char *
+load(const char *name, long *size)
+{
+    FILE *fp;
+    char *buf;
+    long n = 0, len = 0;
+    int i;
+
+    if (name != NULL) {
+	if ((fp = fopen(name, "rb")) == NULL) {
+		fprintf(stderr, "Unable to open input '%s'\n", name);
+		exit(2);
+	}
+	fseek(fp, 0, SEEK_END);
+	n = ftell(fp);
+	rewind(fp);
+    }
+
+    buf = malloc(MINBYTES + n + 256);
+    if (buf == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	exit(2);
+    }
+
+    /* Repeat the input until we have enough bytes to time. */
+    do {
+	if (name != NULL) {
+		len += fread(&buf[len], 1, n, fp);
+		rewind(fp);
+	} else {
+		for (i = 0; i < sizeof(sample) / sizeof(*sample); ++i) {
+			strcpy(&buf[len], sample[i]);
+			len += strlen(sample[i]);
+			buf[len++] = '\n';
+		}
+	}
+    } while (len < MINBYTES && (name == NULL || n > 0));
+    buf[len] = '\0';
+
+    if (name != NULL)
+	fclose(fp);
+
+    *size = len;
+    return buf;
+}
+
+
+int
+main(int argc, char **argv)
+{
+    unsigned long sum[2] = { 0, 0 };
+    long ntok[2];
+    double secs[2];
+    clock_t t0;
+    char *buf;
+    long size;
+    int i;
+
+    buf = load(argc > 1 ? argv[1] : NULL, &size);
+    tokens_init();
+
+    for (i = 0; i < 2; ++i) {
+	t0 = clock();
+	ntok[i] = scan(buf, !i, &sum[i]);
+	secs[i] = (double)(clock() - t0) / CLOCKS_PER_SEC;
+	if (secs[i] <= 0)
+		secs[i] = 1e-6;
+    }
+
+    printf("input:    %ld bytes, %ld tokens\n", size, ntok[0]);
+    printf("linear:   %8.2f MB/s\n", size / secs[0] / 1e6);
+    printf("dispatch: %8.2f MB/s (%.1fx)\n",
+	   size / secs[1] / 1e6, secs[0] / secs[1]);
+
+    if (ntok[0] != ntok[1] || sum[0] != sum[1]) {
+	fprintf(stderr, "MISMATCH: matchers disagree!\n");
+	return 1;
+    }
+
+    free(buf);
+
+    return 0;
+}
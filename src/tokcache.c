@@ -0,0 +1,323 @@
+/*
+ * tokcache.c, remember tokenized lines from one run of bas2prg to the next.
+ * Copyright 2013 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "prgtools.h"
+
+
+/*
+ * The cache file is a magic string followed by records of
+ *	0-1	length of the text
+ *	2-3	length of the tokenized line, with its nul
+ *	4	the options it was tokenized with
+ *	5-	the text, then the tokenized line
+ * The text is kept so that a hit is exact, not just a matching hash.
+ */
+#define TC_MAGIC	"TOKCACH1"
+#define TC_MAGICLEN	8
+#define TC_RECLEN	5
+
+#define WORD(p)		((p)[0] | ((p)[1] << 8))
+
+
+typedef struct {
+    unsigned long hash;
+    long	off;		// record in the pool, -1 if the slot is free
+    int		used;		// looked up in this run
+} tcent_t;
+
+struct tokcache {
+    outbuf_t	pool;		// the records, as in the file
+    tcent_t	*tab;		// open addressing, size a power of two
+    long	size;
+    long	count;
+    long	hits;
+    long	lookups;
+};
+
+
+/*
+ * the options that change how a line tokenizes; the rest are applied to
+ * the line before it gets here
+ */
+static int
+tc_flags(const prgopts_t *opts)
+{
+    return (opts->abbrevs ? 1 : 0) | (opts->collapsespaces ? 2 : 0) |
+	   (opts->dialect << 2) | (opts->charset != CHARSET_RAW ? 32 : 0);
+}
+
+
+/* FNV-1a over the options and the text */
+static unsigned long
+tc_hash(int flags, const char *s, size_t n)
+{
+    unsigned long h = 2166136261UL;
+
+    h = ((h ^ flags) * 16777619UL) & 0xffffffffUL;
+    while (n-- > 0)
+	h = ((h ^ (unsigned char)*s++) * 16777619UL) & 0xffffffffUL;
+
+    return h;
+}
+
+
+static tcent_t *
+tc_find(tokcache_t *c, unsigned long hash, int flags, const char *s, size_t n)
+{
+    const unsigned char *rp;
+    tcent_t *e;
+    long i;
+
+    for (i = hash & (c->size - 1); ; i = (i + 1) & (c->size - 1)) {
+	e = &c->tab[i];
+	if (e->off < 0)
+		return e;
+	rp = (unsigned char *)&c->pool.buf[e->off];
+	if (e->hash == hash && WORD(rp) == n && rp[4] == flags &&
+	    !memcmp(&rp[TC_RECLEN], s, n))
+		return e;
+    }
+}
+
+
+/*
+ * make room for one more entry, keeping the table at most half full
+ */
+static int
+tc_grow(tokcache_t *c)
+{
+    tcent_t *old = c->tab, *e;
+    const unsigned char *rp;
+    long size = c->size, i;
+
+    if (c->count < c->size / 2)
+	return 0;
+
+    c->size = size ? size * 2 : 1024;
+    if ((c->tab = malloc(c->size * sizeof(tcent_t))) == NULL) {
+	c->tab = old;
+	c->size = size;
+	return -1;
+    }
+    for (i = 0; i < c->size; ++i)
+	c->tab[i].off = -1;
+
+    for (i = 0; i < size; ++i) {
+	if (old[i].off < 0)
+		continue;
+	rp = (unsigned char *)&c->pool.buf[old[i].off];
+	e = tc_find(c, old[i].hash, rp[4], (const char *)&rp[TC_RECLEN],
+		    WORD(rp));
+	*e = old[i];
+    }
+    free(old);
+
+    return 0;
+}
+
+
+/*
+ * open a cache, reading it from path if that exists; a cache that is
+ * damaged or from another version is kept up to where it goes wrong
+ * returns NULL if out of memory
+ */
+tokcache_t *
+tokcache_open(const char *path)
+{
+    const unsigned char *rp;
+    tokcache_t *c;
+    tcent_t *e;
+    long off, n;
+    FILE *fp;
+
+    if ((c = calloc(1, sizeof(*c))) == NULL)
+	return NULL;
+    if (tc_grow(c) < 0) {
+	free(c);
+	return NULL;
+    }
+
+    if (path != NULL && (fp = fopen(path, "rb")) != NULL) {
+	if (readfile(fp, &c->pool) < 0)
+		c->pool.len = 0;
+	fclose(fp);
+    }
+    if (c->pool.len < TC_MAGICLEN ||
+	memcmp(c->pool.buf, TC_MAGIC, TC_MAGICLEN)) {
+	c->pool.len = 0;
+	if (outbuf_reserve(&c->pool, TC_MAGICLEN) < 0) {
+		tokcache_free(c);
+		return NULL;
+	}
+	memcpy(c->pool.buf, TC_MAGIC, TC_MAGICLEN);
+	c->pool.len = TC_MAGICLEN;
+    }
+
+    for (off = TC_MAGICLEN; off + TC_RECLEN <= (long)c->pool.len; off += n) {
+	rp = (unsigned char *)&c->pool.buf[off];
+	n = TC_RECLEN + WORD(rp) + WORD(&rp[2]);
+	if (WORD(&rp[2]) == 0 || off + n > (long)c->pool.len ||
+	    tc_grow(c) < 0)
+		break;
+
+	e = tc_find(c, tc_hash(rp[4], (const char *)&rp[TC_RECLEN],
+			       WORD(rp)),
+		    rp[4], (const char *)&rp[TC_RECLEN], WORD(rp));
+	if (e->off < 0) {
+		e->hash = tc_hash(rp[4], (const char *)&rp[TC_RECLEN],
+				  WORD(rp));
+		e->off = off;
+		e->used = 0;
+		c->count++;
+	}
+    }
+    c->pool.len = off;
+
+    return c;
+}
+
+
+/*
+ * tokenize a line like tokenize() does, taking the result from the cache
+ * if this text was tokenized with the same options before
+ * returns the length of the tokenized line
+ */
+int
+tokcache_tokenize(tokcache_t *c, unsigned char *dest, const char *src,
+		  const prgopts_t *opts)
+{
+    const unsigned char *rp;
+    int flags = tc_flags(opts);
+    size_t n = strlen(src);
+    unsigned long hash;
+    unsigned char *wp;
+    tcent_t *e;
+    int len;
+
+    c->lookups++;
+    hash = tc_hash(flags, src, n);
+    e = tc_find(c, hash, flags, src, n);
+    if (e->off >= 0) {
+	rp = (unsigned char *)&c->pool.buf[e->off];
+	len = WORD(&rp[2]);
+	memcpy(dest, &rp[TC_RECLEN + n], len);
+	e->used = 1;
+	c->hits++;
+	return len;
+    }
+
+    len = tokenize(dest, src, opts);
+
+    /* Without room the line just does not get cached. */
+    if (n > 0xffff || tc_grow(c) < 0 ||
+	outbuf_reserve(&c->pool, TC_RECLEN + n + len) < 0)
+	return len;
+    e = tc_find(c, hash, flags, src, n);	// the table may have moved
+    e->hash = hash;
+    e->off = c->pool.len;
+    e->used = 1;
+    c->count++;
+
+    wp = (unsigned char *)&c->pool.buf[c->pool.len];
+    wp[0] = n & 255;
+    wp[1] = n >> 8;
+    wp[2] = len & 255;
+    wp[3] = len >> 8;
+    wp[4] = flags;
+    memcpy(&wp[TC_RECLEN], src, n);
+    memcpy(&wp[TC_RECLEN + n], dest, len);
+    c->pool.len += TC_RECLEN + n + len;
+
+    return len;
+}
+
+
+/*
+ * how many lines were tokenized through the cache, and how many of those
+ * were found in it
+ */
+void
+tokcache_stats(const tokcache_t *c, long *lookups, long *hits)
+{
+    *lookups = c->lookups;
+    *hits = c->hits;
+}
+
+
+/*
+ * write the lines used in this run back to the cache, so that it follows
+ * the program instead of growing with every edit; written to a new file
+ * first, so a failed save leaves the old cache alone
+ * returns 0 on success, -1 on error
+ */
+int
+tokcache_save(tokcache_t *c, const char *path)
+{
+    const unsigned char *rp;
+    char *tmp;
+    long i;
+    FILE *fp;
+    int ret = 0;
+
+    if ((tmp = malloc(strlen(path) + 5)) == NULL)
+	return -1;
+    sprintf(tmp, "%s.new", path);
+    if ((fp = fopen(tmp, "wb")) == NULL) {
+	free(tmp);
+	return -1;
+    }
+
+    fwrite(TC_MAGIC, 1, TC_MAGICLEN, fp);
+    for (i = 0; i < c->size; ++i) {
+	if (c->tab[i].off < 0 || !c->tab[i].used)
+		continue;
+	rp = (unsigned char *)&c->pool.buf[c->tab[i].off];
+	fwrite(rp, 1, TC_RECLEN + WORD(rp) + WORD(&rp[2]), fp);
+    }
+    if (ferror(fp))
+	ret = -1;
+    if (fclose(fp) != 0)
+	ret = -1;
+
+#ifdef _WIN32
+    /* rename() does not replace files here */
+    if (ret == 0)
+	remove(path);
+#endif
+    if (ret != 0 || rename(tmp, path) != 0) {
+	remove(tmp);
+	ret = -1;
+    }
+    free(tmp);
+
+    return ret;
+}
+
+
+void
+tokcache_free(tokcache_t *c)
+{
+    if (c == NULL)
+	return;
+    outbuf_free(&c->pool);
+    free(c->tab);
+    free(c);
+}
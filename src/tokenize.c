@@ -0,0 +1,381 @@
+/*
+ * tokenize.c, convert C64 BASIC text to tokenized PRG form.
+ * Copyright 2011, 2012 Christopher Williams
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include "tokens.h"
+#include "prgtools.h"
+#include "petscii.h"
+
+
+void
+prgopts_init(prgopts_t *opts)
+{
+    memset(opts, 0, sizeof(*opts));
+    opts->startaddr = 0x0801;
+}
+
+
+int
+tokenize(unsigned char *dest, const char *src, const prgopts_t *opts)
+{
+    const char *sp;
+    unsigned char *dp;
+    int quoted = 0;
+    int rem = 0;
+    int token;
+
+    for (sp = src, dp = dest; *sp;) {
+	if (opts->collapsespaces && !(rem || quoted)) {
+		while (*sp && isspace(*sp))
+			++sp;
+	}
+
+	if (*sp == '"')
+		quoted = !quoted;
+
+	if (!rem && !quoted) {
+		token = gettoken(&sp, opts->abbrevs, opts->dialect);
+		if (token != -1) {
+#ifdef _DEBUG
+			if (opts->debug)
+				fprintf(stderr, "found token: 0x%02x\n", token);
+#endif
+			if (token == TOKEN_REM)
+				rem = 1;
+			if (token > 0xff)
+				*dp++ = (unsigned char)(token >> 8);
+			*dp++ = (unsigned char)token;
+			continue;
+		}
+	}
+
+#ifdef _DEBUG
+	if (opts->debug)
+		fprintf(stderr, "copying character: '%c' (0x%02x)%s%s\n",
+			*sp, *sp, rem?" (rem)":"", quoted?" (quoted)":"");
+#endif
+
+	/* drop the CR of CR/LF line endings; with codes, a CR can only be
+	 * {return} and the line ending is gone already */
+	if (*sp == '\r' && opts->charset == CHARSET_RAW) {
+		++sp;
+		continue;
+	}
+
+	if (*sp)
+		*dp++ = (unsigned char)*sp++;
+    }
+
+    if (dp == dest) {
+	/* C64 BASIC has a problem with zero-length lines */
+	*dp++ = ' ';
+    }
+
+    *dp++ = 0;
+#ifdef _DEBUG
+	if (opts->debug)
+		fprintf(stderr, "\n");
+#endif
+
+    return dp - dest;
+}
+
+
+static void
+putword(long n, unsigned char **p)
+{
+    *(*p)++ = n & 255;
+    *(*p)++ = n >> 8;
+}
+
+
+/*
+ * convert BASIC text in memory to a PRG image, appended to out, without
+ * crunching it
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+static int
+bas2prg_lines(const char *src, long len, outbuf_t *out,
+	      const prgopts_t *opts, diag_t *diag)
+{
+    unsigned char *tp;			// pointer in tokenized line
+    char line[MAXLINELEN];		// source line
+    const char *sp = src;
+    const char *end = src + len;
+    const char *nl;
+    char *cp;
+    long linenum;
+    long lastlinenum = -1;
+    long startaddr = opts->startaddr;
+    long textline = 0;
+    size_t n;
+    int toklinelen;
+
+    /* load address */
+    diag_info(diag, "Load address: $%04lX\n", startaddr);
+    if (outbuf_reserve(out, 2) < 0)
+	return outbuf_full(out, diag);
+    tp = (unsigned char *)&out->buf[out->len];
+    putword(startaddr, &tp);
+    out->len += 2;
+
+    while (sp < end) {
+	/* take one line, without the newline */
+	nl = memchr(sp, '\n', end - sp);
+	n = (nl != NULL ? nl : end) - sp;
+	textline++;
+	if (n > MAXLINELEN - 1)
+		return diag_error(diag, "line %ld of the text is longer than %d characters",
+				  textline, MAXLINELEN - 1);
+	memcpy(line, sp, n);
+	line[n] = '\0';
+	sp += n + (nl != NULL);
+
+	/* Turn the text into PETSCII. */
+	n = strlen(line);
+	if (opts->charset != CHARSET_RAW && n > 0 && line[n - 1] == '\r')
+		line[--n] = '\0';
+	if (opts->invertcase)
+		petscii_swapcase(line, n);
+	if (opts->charset != CHARSET_RAW)
+		line[petscii_decode(line, n, opts->charset)] = '\0';
+
+	linenum = strtol(line, &cp, 10);
+
+	/*
+	 * auto-increment line number if no line number was specified
+	 */
+	if (opts->autonumber && cp == line) {
+		linenum = lastlinenum + 1;
+		diag_info(diag, "auto-numbering %li\n", linenum);
+	}
+	diag->line = linenum;
+
+	if (linenum < 0 || 65535 < linenum) {
+		diag_warn(diag, "Warning: line number %li outside of range [0..65535]. Truncating\n",
+			  linenum);
+		if (linenum < 0)
+			linenum = 0;
+		if (linenum > 65535)
+			linenum = 65535;
+	}
+
+	if (linenum == lastlinenum) {
+		diag_warn(diag, "Warning: duplicate line number %li\n",
+			  linenum);
+	}
+
+	if (linenum < lastlinenum) {
+		diag_warn(diag, "Warning: line number %li out of order\n",
+			  linenum);
+	}
+
+	lastlinenum = linenum;
+
+	/* trim extraneous whitespace at the beginning and end */
+	if (opts->trimspaces) {
+		char *ep = &line[strlen(line)-1];
+		while (ep >= line && isspace(*ep))
+			--ep;
+		ep[1] = '\0';
+		while (*cp && isspace(*cp))
+			++cp;
+	}
+
+	/* a tokenized line is never longer than the text plus 6 bytes */
+	if (outbuf_reserve(out, strlen(cp) + 6) < 0)
+		return outbuf_full(out, diag);
+	tp = (unsigned char *)&out->buf[out->len + 2]; /* skip first word for now */
+	putword(linenum, &tp);
+
+	if (opts->cache != NULL)
+		toklinelen = tokcache_tokenize(opts->cache, tp, cp, opts);
+	else
+		toklinelen = tokenize(tp, cp, opts);
+#ifdef _DEBUG
+	if (opts->debug)
+		fprintf(stderr, "line length: %i\n", toklinelen);
+#endif
+	if (toklinelen > 255)
+		diag_warn(diag, "Warning: line %li is %d bytes long, too long for BASIC to edit\n",
+			  linenum, toklinelen);
+	startaddr += toklinelen + 4;
+	if (opts->ramtop != 0 && startaddr + 2 > 0x10000)
+		return diag_error(diag, "line %li runs past the end of memory",
+				  linenum);
+	tp = (unsigned char *)&out->buf[out->len];
+	putword(startaddr, &tp);
+	out->len += toklinelen + 4;
+    }
+    diag->line = -1;
+
+    if (outbuf_reserve(out, 2) < 0)
+	return outbuf_full(out, diag);
+    tp = (unsigned char *)&out->buf[out->len];
+    putword(0, &tp);
+    out->len += 2;
+
+    return 0;
+}
+
+
+/*
+ * run a pass over the tokenized program in tmp, into out if it is the
+ * last or else into a new tmp
+ */
+static int
+tokpass(int (*pass)(const unsigned char *, long, outbuf_t *,
+		    const prgopts_t *, diag_t *),
+	outbuf_t *tmp, outbuf_t *out, const prgopts_t *opts, diag_t *diag)
+{
+    outbuf_t next;
+    int ret;
+
+    if (out != NULL)
+	return pass((unsigned char *)tmp->buf, tmp->len, out, opts, diag);
+
+    memset(&next, 0, sizeof(next));
+    ret = pass((unsigned char *)tmp->buf, tmp->len, &next, opts, diag);
+    outbuf_free(tmp);
+    *tmp = next;
+
+    return ret;
+}
+
+
+/*
+ * convert BASIC text in memory to a PRG image, appended to out; with
+ * opts->ramtop, it must fit below that
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+bas2prg_buf(const char *src, long len, outbuf_t *out,
+	    const prgopts_t *opts, diag_t *diag)
+{
+    outbuf_t tmp, packed;
+    outbuf_t *prg = out;		// the program, before packing
+    size_t start = out->len;
+    long top = opts->ramtop;
+    long end;
+    int ret;
+
+    if (opts->pack) {
+	if (opts->dialect != DIALECT_V2 && opts->dialect != DIALECT_SIMONS)
+		return diag_error(diag, "packing is only for the C64");
+	memset(&packed, 0, sizeof(packed));
+	prg = &packed;
+	start = 0;
+    }
+
+    if (!opts->crunch && !opts->optimize && !opts->reorder)
+	ret = bas2prg_lines(src, len, prg, opts, diag);
+    else {
+	/* Optimizing, reordering and crunching work on the tokenized
+	 * program, in that order. */
+	memset(&tmp, 0, sizeof(tmp));
+	ret = bas2prg_lines(src, len, &tmp, opts, diag);
+	if (ret == 0 && opts->optimize)
+		ret = tokpass(prg_optimize, &tmp, opts->reorder ||
+			      opts->crunch ? NULL : prg, opts, diag);
+	if (ret == 0 && opts->reorder)
+		ret = tokpass(prg_reorder, &tmp, opts->crunch ? NULL : prg,
+			      opts, diag);
+	if (ret == 0 && opts->crunch)
+		ret = tokpass(prg_crunch, &tmp, prg, opts, diag);
+	outbuf_free(&tmp);
+    }
+
+    /* A program loaded above the top only has to fit in memory. */
+    if (ret == 0 && top != 0) {
+	end = opts->startaddr + (long)(prg->len - start) - 2;
+	if (opts->startaddr >= top)
+		top = 0x10000;
+	if (end > top)
+		ret = diag_error(diag, "program ends at $%04lX, past the top of BASIC RAM at $%04lX",
+				 end, top);
+	else
+		diag_info(diag, "Program size: %ld bytes, %ld BASIC bytes free\n",
+			  (long)(prg->len - start) - 2, top - end);
+    }
+
+    /* Packing works on the finished program. */
+    if (opts->pack) {
+	if (ret == 0)
+		ret = prg_pack((unsigned char *)packed.buf, packed.len, out,
+			       top ? top : dialect_top(opts->dialect), diag);
+	outbuf_free(&packed);
+    }
+
+    return ret;
+}
+
+
+/*
+ * convert a BASIC text file to a PRG file
+ * The whole file is read and converted in memory, into an arena that
+ * holds all the memory a PRG can load into, then written at once.
+ * returns 0 on success, -1 on error (reason in diag->error)
+ */
+int
+bas2prg_file(FILE *fi, FILE *fo, const prgopts_t *opts, diag_t *diag)
+{
+    outbuf_t in, out;
+    char *arena;
+    int ret;
+
+    memset(&in, 0, sizeof(in));
+    if ((arena = malloc(MAXPRGLEN)) == NULL)
+	return diag_error(diag, "out of memory");
+    outbuf_init(&out, arena, MAXPRGLEN);
+
+    metrics_mark(diag->metrics);
+    if (readfile(fi, &in) < 0)
+	ret = diag_error(diag, "read error");
+    else {
+	metrics_time(diag->metrics, TIME_READ);
+	ret = bas2prg_buf(in.buf, in.len, &out, opts, diag);
+	metrics_time(diag->metrics, TIME_CONVERT);
+    }
+
+    if (ret == 0 && fwrite(out.buf, 1, out.len, fo) != out.len)
+	ret = diag_error(diag, "write error");
+
+    if (diag->metrics != NULL) {
+	metrics_time(diag->metrics, TIME_WRITE);
+	diag->metrics->bytesin = in.len;
+	diag->metrics->bytesout = ret == 0 ? out.len : 0;
+	if (ret == 0 && opts->pack) {
+		/* the lines are in the packed data */
+		in.len = 0;
+		if (prg_unpack((unsigned char *)out.buf, out.len, &in,
+			       diag) == 0)
+			metrics_count(diag->metrics,
+				      (unsigned char *)in.buf + 2, in.len - 2);
+	} else if (ret == 0)
+		metrics_count(diag->metrics, (unsigned char *)out.buf + 2,
+			      out.len - 2);
+    }
+
+    outbuf_free(&in);
+    free(arena);
+
+    return ret;
+}
@@ -16,9 +16,14 @@
  * with this program; if not, write to the Free Software Foundation, Inc.,
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
+#include <stdio.h>
+#include <string.h>
 #include "tokens.h"
+#include "prgtools.h"
+#include "petscii.h"
 
 
+/* BASIC V2, the base of all the dialects below */
 const char *tokens[128] = {
     "END",		// 80
     "FOR",		// 81
@@ -164,3 +169,321 @@ const char *tokens[128] = {
     "{fe}",
     "{pi}"		// ff
 };
+
+
+/* PET BASIC 4.0, from 0xcc on */
+static const char *const v4_ext[] = {
+    "CONCAT", "DOPEN", "DCLOSE", "RECORD", "HEADER", "COLLECT",	// cc
+    "BACKUP", "COPY", "APPEND", "DSAVE", "DLOAD", "CATALOG",	// d2
+    "RENAME", "SCRATCH", "DIRECTORY"				// d8
+};
+
+/* Plus/4 BASIC 3.5, from 0xcc on */
+static const char *const v35_ext[] = {
+    "RGR", "RCLR", "RLUM", "JOY", "RDOT", "DEC", "HEX$", "ERR$",	// cc
+    "INSTR", "ELSE", "RESUME", "TRAP", "TRON", "TROFF", "SOUND", "VOL",	// d4
+    "AUTO", "PUDEF", "GRAPHIC", "PAINT", "CHAR", "BOX", "CIRCLE",	// dc
+    "GSHAPE", "SSHAPE", "DRAW", "LOCATE", "COLOR", "SCNCLR", "SCALE",	// e3
+    "HELP", "DO", "LOOP", "EXIT", "DIRECTORY", "DSAVE", "DLOAD",	// ea
+    "HEADER", "SCRATCH", "COLLECT", "COPY", "RENAME", "BACKUP",	// f1
+    "DELETE", "RENUMBER", "KEY", "MONITOR", "USING", "UNTIL", "WHILE"	// f7
+};
+
+/* C128 BASIC 7.0: the same as 3.5, but 0xce and 0xfe start two-byte
+ * tokens */
+static const char *const v7_ce[] = {
+    "POT", "BUMP", "PEN", "RSPPOS", "RSPRITE", "RSPCOLOR", "XOR",	// 02
+    "RWINDOW", "POINTER"						// 09
+};
+
+static const char *const v7_fe[] = {
+    "BANK", "FILTER", "PLAY", "TEMPO", "MOVSPR", "SPRITE",		// 02
+    "SPRCOLOR", "RREG", "ENVELOPE", "SLEEP", "CATALOG", "DOPEN",	// 08
+    "APPEND", "DCLOSE", "BSAVE", "BLOAD", "RECORD", "CONCAT",		// 0e
+    "DVERIFY", "DCLEAR", "SPRSAV", "COLLISION", "BEGIN", "BEND",	// 14
+    "WINDOW", "BOOT", "WIDTH", "SPRDEF", "QUIT", "STASH", NULL,	// 1a
+    "FETCH", NULL, "SWAP", "OFF", "FAST", "SLOW"			// 21
+};
+
+/* Simons' BASIC: 0x64 and a second byte; NULL where the code is unused
+ * or not known */
+static const char *const simons[] = {
+    "HIRES", "PLOT", "LINE", "BLOCK", "FCHR", "FCOL", "FILL",		// 01
+    "REC", "ROT", "DRAW", "CHAR", "HI COL", "INV", "FRAC", "MOVE",	// 08
+    "PLACE", "UPB", "UPW", "LEFTW", "LEFTB", "DOWNB", "DOWNW",		// 10
+    "RIGHTB", "RIGHTW", "MULTI", "COLOUR", "MMOB", "BFLASH",		// 17
+    "MOB SET", "MUSIC", "FLASH", "REPEAT", "PLAY", NULL, "CENTRE",	// 1d
+    "ENVELOPE", "CGOTO", "WAVE", "FETCH", "AT(", "UNTIL", NULL,	// 24
+    NULL, "USE", NULL, "GLOBAL", NULL, "RESET", "PROC", "CALL",	// 2b
+    "EXEC", "END PROC", "EXIT", "END LOOP", "ON KEY", "DISABLE",	// 33
+    "RESUME", "LOOP", "DELAY", NULL, NULL, NULL, NULL, "SECURE",	// 39
+    "DISAPA", "CIRCLE", "ON ERROR", "NO ERROR", "LOCAL", "RCOMP",	// 41
+    "ELSE", "RETRACE", "TRACE", "DIR", "PAGE", "DUMP", "FIND",		// 47
+    "OPTION", "AUTO", "OLD", "JOY", "MOD", "DIV", NULL, "DUP",		// 4e
+    "INKEY", "INST", "TEST", "LIN", "EXOR", "INSERT", "POT", "PENX",	// 56
+    NULL, "PENY", "SOUND", "GRAPHICS", "DESIGN", "RLOCMOB", "CMOB",	// 5e
+    "BCKGNDS", "PAUSE", "NRM", "MOB OFF", "OFF", "ANGL", "ARC",	// 65
+    "COLD", "SCRN"							// 6c
+};
+
+#define COUNT(a)	(int)(sizeof(a) / sizeof(*(a)))
+
+/* How a dialect differs from BASIC V2. */
+typedef struct {
+    const char	*name;
+    long	load;		// start of BASIC on its machine
+    long	top;		// and the end of its RAM
+    const char	*const *ext;	// keywords from 0xcc on
+    int		next;
+    int		prefix[2];	// bytes that start two-byte tokens, or -1
+    const char	*const *ptab[2]; // keywords after them, from pfirst on
+    int		pfirst[2];
+    int		pn[2];
+    int		ptfirst;	// two-byte keywords are tried first
+} dialectdef_t;
+
+static const dialectdef_t defs[NDIALECTS] = {
+    { "2", 0x0801, 0xa000, NULL, 0, { -1, -1 }, { NULL, NULL }, { 0, 0 }, { 0, 0 }, 0 },
+    { "4", 0x0401, 0x8000, v4_ext, COUNT(v4_ext), { -1, -1 }, { NULL, NULL },
+      { 0, 0 }, { 0, 0 }, 0 },
+    { "3.5", 0x1001, 0xfd00, v35_ext, COUNT(v35_ext), { -1, -1 }, { NULL, NULL },
+      { 0, 0 }, { 0, 0 }, 0 },
+    { "7", 0x1c01, 0xff00, v35_ext, COUNT(v35_ext), { 0xce, 0xfe }, { v7_ce, v7_fe },
+      { 2, 2 }, { COUNT(v7_ce), COUNT(v7_fe) }, 0 },
+    { "simons", 0x0801, 0x8000, NULL, 0, { 0x64, -1 }, { simons, NULL },
+      { 1, 0 }, { COUNT(simons), 0 }, 1 }
+};
+
+dialect_t dialects[NDIALECTS];
+
+/* The tables for the second byte of two-byte tokens; those that have
+ * no keyword come out like "{fe}{41}". */
+static const char *ptexts[NDIALECTS][2][256];
+static unsigned char plens[NDIALECTS][2][256];
+static char unknown[NDIALECTS][2][256][9];
+
+
+int
+dialect_find(const char *name)
+{
+    int i;
+
+    for (i = 0; i < NDIALECTS; ++i) {
+	if (!strcmp(name, defs[i].name))
+		return i;
+    }
+
+    return -1;
+}
+
+
+const char *
+dialect_name(int dialect)
+{
+    return defs[dialect].name;
+}
+
+
+long
+dialect_load(int dialect)
+{
+    return defs[dialect].load;
+}
+
+
+/*
+ * the end of BASIC RAM: programs and their variables must stay below it
+ */
+long
+dialect_top(int dialect)
+{
+    return defs[dialect].top;
+}
+
+
+static int
+isprefix(const dialectdef_t *def, int c)
+{
+    return c == def->prefix[0] || c == def->prefix[1];
+}
+
+
+static void
+addkw(keyword_t *list, int *n, const char *text, int token)
+{
+    list[*n].text = text;
+    list[*n].len = (unsigned char)strlen(text);
+    list[*n].token = (unsigned short)token;
+    (*n)++;
+}
+
+
+/*
+ * the keywords that start with a prefix byte, and the texts for the
+ * second bytes that have none
+ */
+static void
+build_prefixed(int dl, int k, keyword_t *list, int *n)
+{
+    const dialectdef_t *def = &defs[dl];
+    dialect_t *d = &dialects[dl];
+    int p = def->prefix[k], c;
+
+    d->ptext[p] = ptexts[dl][k];
+    d->plen[p] = plens[dl][k];
+    for (c = 0; c < 256; ++c) {
+	if (c >= def->pfirst[k] && c < def->pfirst[k] + def->pn[k] &&
+	    def->ptab[k][c - def->pfirst[k]] != NULL) {
+		d->ptext[p][c] = def->ptab[k][c - def->pfirst[k]];
+		addkw(list, n, d->ptext[p][c], (p << 8) | c);
+	} else {
+		sprintf(unknown[dl][k][c], "{%02x}{%02x}", p, c);
+		d->ptext[p][c] = unknown[dl][k][c];
+	}
+	d->plen[p][c] = (unsigned char)strlen(d->ptext[p][c]);
+	if (d->plen[p][c] > d->maxlen)
+		d->maxlen = d->plen[p][c];
+    }
+}
+
+
+/*
+ * build the tables of one dialect
+ *
+ * The keywords are tried in the order the ROM has them, except that a
+ * keyword goes before any shorter one that it starts with: a first match
+ * on DO would never let DOPEN (or ON, ON ERROR) be found.
+ */
+static void
+build(int dl)
+{
+    const dialectdef_t *def = &defs[dl];
+    dialect_t *d = &dialects[dl];
+    keyword_t list[MAXKEYWORDS];
+    int count[257];
+    int n = 0, c, i, j, k, pos;
+    const char *text;
+
+    memset(d, 0, sizeof(*d));
+    d->stop = -1;
+
+    if (def->ptfirst) {
+	for (k = 0; k < 2; ++k)
+		if (def->prefix[k] >= 0)
+			build_prefixed(dl, k, list, &n);
+    }
+
+    for (c = 0x80; c < 0x100; ++c) {
+	text = tokens[c - 0x80];
+	if (c >= 0xcc && c - 0xcc < def->next && def->ext[c - 0xcc] != NULL)
+		text = def->ext[c - 0xcc];
+	d->text[c] = text;	// a prefix alone at the end of a line
+	if (!isprefix(def, c))
+		addkw(list, &n, text, c);
+    }
+
+    if (!def->ptfirst) {
+	for (k = 0; k < 2; ++k)
+		if (def->prefix[k] >= 0)
+			build_prefixed(dl, k, list, &n);
+    }
+    for (k = 0; k < 2; ++k) {
+	if (def->prefix[k] >= 0 && def->prefix[k] < 0x80)
+		d->stop = def->prefix[k];
+    }
+
+    for (c = 0; c < 256; ++c) {
+	d->len[c] = d->text[c] ? (unsigned char)strlen(d->text[c]) : 1;
+	if (d->len[c] > d->maxlen)
+		d->maxlen = d->len[c];
+    }
+
+    /* Count the keywords for each first byte. */
+    memset(count, 0, sizeof(count));
+    for (i = 0; i < n; ++i)
+	count[(unsigned char)list[i].text[0]]++;
+    for (c = pos = 0; c < 256; ++c) {
+	d->cand[c] = (unsigned short)pos;
+	pos += count[c];
+    }
+    d->cand[256] = (unsigned short)pos;
+
+    /* Fill each bucket in order, moving keywords ahead of their own
+     * beginnings. */
+    memset(count, 0, sizeof(count));
+    for (i = 0; i < n; ++i) {
+	keyword_t *b = &d->kw[d->cand[(unsigned char)list[i].text[0]]];
+	int m = count[(unsigned char)list[i].text[0]]++;
+
+	for (pos = 0; pos < m; ++pos) {
+		if (b[pos].len < list[i].len &&
+		    !memcmp(b[pos].text, list[i].text, b[pos].len))
+			break;
+	}
+	for (j = m; j > pos; --j)
+		b[j] = b[j - 1];
+	b[pos] = list[i];
+    }
+}
+
+
+/*
+ * build the tables of all dialects
+ * must be called once before converting anything
+ */
+void
+tokens_init(void)
+{
+    int i;
+
+    for (i = 0; i < NDIALECTS; ++i)
+	build(i);
+    petscii_init();
+}
+
+
+/*
+ * find a token in *src and increment *src past the token if one is found
+ * returns the token, with the prefix byte of a two-byte token in bits 8-15,
+ * or -1 if no token is found
+ *
+ * If abbrev is set, a keyword may also be abbreviated the way it is typed
+ * on the C64: one or more leading letters followed by the next letter
+ * shifted, which in ASCII text is the lowercase letter (e.g. "Po" for POKE,
+ * or "pO" when the input is case-inverted).
+ */
+int
+gettoken(const char **src, int abbrev, int dialect)
+{
+    const dialect_t *d = &dialects[dialect];
+    const unsigned char *sp = (const unsigned char *)*src;
+    const keyword_t *kp, *ep;
+    const char *tp;
+    int len, i;
+
+    kp = &d->kw[d->cand[*sp]];
+    ep = &d->kw[d->cand[*sp + 1]];
+    for (; kp < ep; ++kp) {
+	tp = kp->text;
+	len = kp->len;
+
+	/* The first byte is already known to match. */
+	for (i = 1; i < len; ++i) {
+		if (sp[i] == (unsigned char)tp[i])
+			continue;
+
+		/* A shifted letter ends an abbreviated keyword. */
+		if (abbrev && sp[i] >= 'a' && sp[i] <= 'z' &&
+		    sp[i] - 'a' + 'A' == tp[i])
+			len = ++i;
+		break;
+	}
+
+	if (i == len) {
+		*src += len;
+		return kp->token;
+	}
+    }
+
+    return -1;
+}
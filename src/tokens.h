@@ -6,12 +6,12 @@
  * it under the terms of the GNU General Public License as published by
  * the Free Software Foundation; either version 2 of the License, or
  * (at your option) any later version.
- * 
+ *
  * This program is distributed in the hope that it will be useful,
  * but WITHOUT ANY WARRANTY; without even the implied warranty of
  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
  * GNU General Public License for more details.
- * 
+ *
  * You should have received a copy of the GNU General Public License along
  * with this program; if not, write to the Free Software Foundation, Inc.,
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
@@ -20,7 +20,43 @@
 # define _TOKENS_H_
 
 
-extern const char *tokens[128];
+#define MAXKEYWORDS	512		// in any one dialect
+
+
+/* A keyword and its token, with the prefix byte of a two-byte token in
+ * the high byte. */
+typedef struct {
+    const char	*text;
+    unsigned char len;
+    unsigned short token;
+} keyword_t;
+
+/*
+ * The tables of one dialect, built by tokens_init().
+ */
+typedef struct {
+    /* detokenizing: indexed by the token byte, then by the second byte
+     * after a prefix */
+    const char	*text[256];	// NULL for bytes that stand for themselves
+    unsigned char len[256];
+    const char	**ptext[256];	// NULL unless the byte is a prefix
+    unsigned char *plen[256];
+    int		stop;		// a prefix below 0x80, or -1
+    int		maxlen;		// most text one byte of a line can give
+
+    /* tokenizing: the keywords for byte c are
+     * kw[cand[c]] .. kw[cand[c+1]-1], in the order they are tried */
+    keyword_t	kw[MAXKEYWORDS];
+    unsigned short cand[257];
+} dialect_t;
+
+
+extern const char *tokens[128];		// BASIC V2
+extern dialect_t dialects[];
+
+
+extern void	tokens_init(void);
+extern int	gettoken(const char **src, int abbrev, int dialect);
 
 
 #endif	/*_TOKENS_H*/